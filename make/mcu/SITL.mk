@@ -0,0 +1,72 @@
+#
+# SITL (software in the loop) Make file include
+#
+# Builds the firmware as a native executable for the build host. There is
+# no linker script, startup code or vendor library: the simulated hardware
+# backend lives in src/main/target/SITL.
+#
+
+TARGET_FLASH    := 2048
+HSE_VALUE       =
+
+ARCH_FLAGS      = -Wdouble-promotion
+DEVICE_FLAGS    = -DSIMULATOR_BUILD
+LD_SCRIPT       =
+STARTUP_SRC     =
+
+SITL_CC        ?= gcc
+SITL_CXX       ?= g++
+
+MCU_COMMON_SRC = \
+            drivers/accgyro/accgyro.c \
+            drivers/accgyro/accgyro_fake.c \
+            drivers/barometer/barometer_fake.c \
+            drivers/compass/compass_fake.c \
+            blackbox/blackbox_decoder.c
+
+# Drivers that talk to on-chip peripherals, replaced by target/SITL/*.c
+MCU_EXCLUDES = \
+            drivers/adc.c \
+            drivers/bus_busdev_i2c.c \
+            drivers/bus_busdev_spi.c \
+            drivers/bus_i2c_soft.c \
+            drivers/bus_spi.c \
+            drivers/exti.c \
+            drivers/io.c \
+            drivers/light_led.c \
+            drivers/persistent.c \
+            drivers/pwm_esc_detect.c \
+            drivers/pwm_mapping.c \
+            drivers/pwm_output.c \
+            drivers/rcc.c \
+            drivers/rx_pwm.c \
+            drivers/serial_uart.c \
+            drivers/sound_beeper.c \
+            drivers/stack_check.c \
+            drivers/system.c \
+            drivers/time.c \
+            drivers/timer.c \
+            drivers/usb_msc.c \
+            drivers/lights_io.c \
+            drivers/pinio.c \
+            drivers/io_pca9685.c \
+            drivers/irlock.c \
+            drivers/rx_nrf24l01.c \
+            drivers/rx_spi.c \
+            drivers/rx_xn297.c \
+            drivers/1-wire.c \
+            drivers/1-wire/ds_crc.c \
+            drivers/1-wire/ds2482.c \
+            drivers/temperature/ds18b20.c \
+            drivers/temperature/lm75.c \
+            drivers/pitotmeter_adc.c \
+            drivers/pitotmeter_ms4525.c \
+            drivers/display_ug2864hsweg01.c \
+            drivers/rangefinder/rangefinder_hcsr04.c \
+            drivers/rangefinder/rangefinder_hcsr04_i2c.c \
+            drivers/rangefinder/rangefinder_srf10.c \
+            drivers/rangefinder/rangefinder_vl53l0x.c \
+            fc/fc_hardfaults.c
+
+# Settings generator and build stamp evaluate the headers with a C++ compiler
+export SETTINGS_CXX := $(SITL_CXX)
@@ -159,6 +159,7 @@ COMMON_SRC = \
             uav_interconnect/uav_interconnect_rangefinder.c \
             blackbox/blackbox.c \
             blackbox/blackbox_encoding.c \
+            blackbox/blackbox_huffman.c \
             blackbox/blackbox_io.c \
             cms/cms.c \
             cms/cms_menu_battery.c \
@@ -26,8 +26,8 @@ ifeq ($(filter $(TARGET),$(VALID_TARGETS)),)
 $(error Target '$(TARGET)' is not valid, must be one of $(VALID_TARGETS). Have you prepared a valid target.mk?)
 endif
 
-ifeq ($(filter $(TARGET),$(F3_TARGETS) $(F4_TARGETS) $(F7_TARGETS)),)
-$(error Target '$(TARGET)' has not specified a valid STM group, must be one of F3, F405, F411, F427 or F7x. Have you prepared a valid target.mk?)
+ifeq ($(filter $(TARGET),$(F3_TARGETS) $(F4_TARGETS) $(F7_TARGETS) $(SITL_TARGETS)),)
+$(error Target '$(TARGET)' has not specified a valid STM group, must be one of F3, F405, F411, F427, F7x or SITL. Have you prepared a valid target.mk?)
 endif
 
 ifeq ($(TARGET),$(filter $(TARGET),$(F3_TARGETS)))
@@ -60,6 +60,9 @@ TARGET_MCU_GROUP 	:= STM32F7
 else ifeq ($(TARGET),$(filter $(TARGET), $(F7X6XG_TARGETS)))
 TARGET_MCU			:= STM32F7X6XG
 TARGET_MCU_GROUP 	:= STM32F7
+else ifeq ($(TARGET),$(filter $(TARGET), $(SITL_TARGETS)))
+TARGET_MCU			:= SITL
+TARGET_MCU_GROUP 	:= SITL
 else
 $(error Unknown target MCU specified.)
 endif
@@ -0,0 +1,1560 @@
+// This file has been automatically generated by utils/settings.rb
+// Don't make any modifications to it. They will be lost.
+
+#include "platform.h"
+#include "config/parameter_group_ids.h"
+#include "fc/settings.h"
+#include "sensors/gyro.h"
+#include "flight/dynamic_gyro_notch.h"
+#include "fc/config.h"
+#include "sensors/acceleration.h"
+#include "sensors/rangefinder.h"
+#include "sensors/opflow.h"
+#include "sensors/compass.h"
+#include "sensors/barometer.h"
+#include "sensors/pitotmeter.h"
+#include "rx/rx.h"
+#include "rx/spektrum.h"
+#include "blackbox/blackbox.h"
+#include "flight/mixer.h"
+#include "flight/failsafe.h"
+#include "sensors/boardalignment.h"
+#include "sensors/battery.h"
+#include "sensors/battery.h"
+#include "flight/servos.h"
+#include "fc/controlrate_profile.h"
+#include "io/serial.h"
+#include "flight/imu.h"
+#include "fc/rc_controls.h"
+#include "flight/pid.h"
+#include "navigation/navigation.h"
+#include "io/serial.h"
+#include "telemetry/telemetry.h"
+#include "telemetry/frsky_d.h"
+#include "telemetry/sim.h"
+#include "common/color.h"
+#include "io/ledstrip.h"
+#include "io/osd.h"
+#include "drivers/osd.h"
+#include "fc/config.h"
+#include "fc/rc_modes.h"
+#include "fc/stats.h"
+#include "common/time.h"
+#include "drivers/display.h"
+#include "io/vtx_control.h"
+#include "drivers/vtx_common.h"
+#include "io/vtx.h"
+#include "common/log.h"
+#include "sensors/esc_sensor.h"
+const pgn_t settingsPgn[] = {
+	PG_GYRO_CONFIG,
+	PG_ADC_CHANNEL_CONFIG,
+	PG_ACCELEROMETER_CONFIG,
+	PG_RANGEFINDER_CONFIG,
+	PG_OPFLOW_CONFIG,
+	PG_COMPASS_CONFIG,
+	PG_BAROMETER_CONFIG,
+	PG_PITOTMETER_CONFIG,
+	PG_RX_CONFIG,
+	PG_BLACKBOX_CONFIG,
+	PG_MOTOR_CONFIG,
+	PG_FAILSAFE_CONFIG,
+	PG_BOARD_ALIGNMENT,
+	PG_BATTERY_METERS_CONFIG,
+	PG_BATTERY_PROFILES,
+	PG_MIXER_CONFIG,
+	PG_REVERSIBLE_MOTORS_CONFIG,
+	PG_SERVO_CONFIG,
+	PG_CONTROL_RATE_PROFILES,
+	PG_SERIAL_CONFIG,
+	PG_IMU_CONFIG,
+	PG_ARMING_CONFIG,
+	PG_GENERAL_SETTINGS,
+	PG_RPM_FILTER_CONFIG,
+	PG_GPS_CONFIG,
+	PG_RC_CONTROLS_CONFIG,
+	PG_PID_PROFILE,
+	PG_PID_AUTOTUNE_CONFIG,
+	PG_POSITION_ESTIMATION_CONFIG,
+	PG_NAV_CONFIG,
+	PG_TELEMETRY_CONFIG,
+	PG_LED_STRIP_CONFIG,
+	PG_OSD_CONFIG,
+	PG_SYSTEM_CONFIG,
+	PG_MODE_ACTIVATION_OPERATOR_CONFIG,
+	PG_STATS_CONFIG,
+	PG_TIME_CONFIG,
+	PG_DISPLAY_CONFIG,
+	PG_VTX_CONFIG,
+	PG_VTX_SETTINGS_CONFIG,
+	PG_LOG_CONFIG,
+	PG_ESC_SENSOR_CONFIG,
+};
+const uint8_t settingsPgnCounts[] = {
+	22,
+	4,
+	12,
+	2,
+	3,
+	10,
+	3,
+	3,
+	16,
+	4,
+	9,
+	13,
+	3,
+	10,
+	9,
+	5,
+	3,
+	6,
+	16,
+	1,
+	7,
+	3,
+	1,
+	4,
+	7,
+	7,
+	78,
+	5,
+	22,
+	68,
+	27,
+	1,
+	45,
+	4,
+	1,
+	4,
+	2,
+	1,
+	1,
+	6,
+	2,
+	1,
+};
+static const uint8_t settingNamesWords[] = {
+	0x70,0x6c, /* "nav" */ 
+	0x3,0x5c, /* "fw" */ 
+	0xd,0x18, /* "mc" */ 
+	0x1f,0x32, /* "osd" */ 
+	0x2,0x41,0xa1, /* "rate" */ 
+	0x40,0x7c,0xc9,0xe0, /* "gyro" */ 
+	0x80, /* "p" */ 
+	0x32,0x1b, /* "yaw" */ 
+	0x81,0x2e,0xd, /* "inav" */ 
+	0x80,0xd4,0xb8, /* "min" */ 
+	0xd,0xe, /* "max" */ 
+	0x0,0x16,0x6,0x4d, /* "alarm" */ 
+	0x6, /* "z" */ 
+	0x81,0x4,0xd0,0x68, /* "pitch" */ 
+	0x4,0x1f,0x30, /* "pos" */ 
+	0x18,0x29,0x64,0xc2,0x62, /* "failsafe" */ 
+	0x81,0x1a, /* "hz" */ 
+	0x4,0x9e,0xc6, /* "roll" */ 
+	0x2,0x99,0x81, /* "type" */ 
+	0x41,0x70, /* "w" */ 
+	0x4,0x63, /* "acc" */ 
+	0x2, /* "i" */ 
+	0x41,0x8c, /* "xy" */ 
+	0x80,0x2e,0x3b,0xa, /* "angle" */ 
+	0x6,0x6,0xae,0x1a, /* "launch" */ 
+	0x0,0xc8,0x18, /* "lpf" */ 
+	0x12,0xa2, /* "rth" */ 
+	0x1,0x44,0xb4,0xa0, /* "time" */ 
+	0xb,0x12,0x77, /* "align" */ 
+	0x0,0x80, /* "d" */ 
+	0x3c,0x26, /* "gps" */ 
+	0x6,0x84,0xe0, /* "mag" */ 
+	0x73,0xe8,0x34, /* "notch" */ 
+	0x2,0x88,0x91,0x66,0x87,0xb0,0x80, /* "threshold" */ 
+	0x45,0x48, /* "hud" */ 
+	0x9,0xc0,0xa5,0x20, /* "speed" */ 
+	0x28,0x89, /* "thr" */ 
+	0x0,0x85,0x9,0x4,0x17,0x10, /* "deadband" */ 
+	0x9,0x6d, /* "imu" */ 
+	0x40,0xd7,0xd1,0xf2, /* "motor" */ 
+	0x5, /* "v" */ 
+	0x80,0x20,0xc9,0xe0, /* "baro" */ 
+	0x14,0x82,0xb4,0xb8,0xe0, /* "braking" */ 
+	0x21,0x58,0x1c, /* "delay" */ 
+	0x81,0x1,0x91,0x2e,0x19,0x14, /* "hardware" */ 
+	0xc,0x2d,0x8a,0xc0, /* "level" */ 
+	0x34,0x2e,0xa8,0x58, /* "manual" */ 
+	0xa,0x15,0xb0, /* "temp" */ 
+	0x5,0x11,0x27,0xd2,0x8c,0x28, /* "throttle" */ 
+	0x2c,0x20,0xd0, /* "vbat" */ 
+	0x16,0x2b, /* "vel" */ 
+	0x1,0x67,0xb2,0x81,0x39, /* "voltage" */ 
+	0x41,0x6a,0x60, /* "vtx" */ 
+	0x1,0x65,0x13,0x4a,0x90,0xa0, /* "altitude" */ 
+	0xd,0x68,0xf0, /* "auto" */ 
+	0xd,0x1,0x73,0x8a,0xc0, /* "channel" */ 
+	0xd,0x89,0x68, /* "climb" */ 
+	0x80,0x4c,0xb8,0x2d,0x48, /* "dynamic" */ 
+	0xc0,0x5c,0x41,0xe0, /* "expo" */ 
+	0x34,0xa6,0xbc, /* "frsky" */ 
+	0x81,0x89,0x6a,0x68, /* "limit" */ 
+	0x6,0xbc,0x85, /* "mode" */ 
+	0x3,0xcc,0x69,0x96,0x80, /* "offset" */ 
+	0x90, /* "rc" */ 
+	0xc1,0x29,0xcd,0x20, /* "rssi" */ 
+	0x19,0x58,0xc0, /* "cell" */ 
+	0xe,0xb2,0x91,0x5d,0x40, /* "current" */ 
+	0x11,0x33,0xc,0x9a, /* "disarm" */ 
+	0x2,0x26,0x74,0xb,0x86,0x50, /* "distance" */ 
+	0x26,0x85,0x93, /* "iterm" */ 
+	0x40,0xc7,0xdc, /* "low" */ 
+	0xd,0xd,0x98,0x97,0x2c, /* "mavlink" */ 
+	0x10,0x7d,0xcb,0x20, /* "power" */ 
+	0x4c,0x61,0x61, /* "scale" */ 
+	0x41,0x32,0xca,0xcf, /* "servo" */ 
+	0x4,0xe8,0x1a,0x4c, /* "stats" */ 
+	0x1b,0x20, /* "3d" */ 
+	0x2,0x31,0x95,0x80, /* "accel" */ 
+	0x9,0x6, /* "adc" */ 
+	0x0,0xb2,0x80, /* "alt" */ 
+	0x10,0x69,0x42,0xcb,0x20, /* "battery" */ 
+	0x13,0x2,0x35,0x89,0xf8, /* "blackbox" */ 
+	0x0,0x9e,0xf9,0xd0, /* "boost" */ 
+	0x3,0xc,0x2,0x34,0xd3,0x20, /* "capacity" */ 
+	0x19, /* "cd" */ 
+	0x0,0x39,0x55,0x33,0x28, /* "cruise" */ 
+	0x7,0x5a,0x3c,0xc6, /* "cutoff" */ 
+	0x1,0x6,0xd0, /* "dcm" */ 
+	0x12,0x85,0x93, /* "dterm" */ 
+	0x40,0x63, /* "ff" */ 
+	0x0,0xc9,0x65,0xb,0x20, /* "filter" */ 
+	0x21,0xed,0x28, /* "home" */ 
+	0x16,0x16,0x34,0x2e, /* "kalman" */ 
+	0x3,0x2,0xe2,0x25,0xc7, /* "landing" */ 
+	0x3,0x4b,0x42,0xc8, /* "meter" */ 
+	0x12,0x9,0x3,0x20, /* "radar" */ 
+	0x48,0x2e,0x39, /* "range" */ 
+	0x41,0x28,0x34, /* "rpm" */ 
+	0x13,0x4b, /* "sim" */ 
+	0x41,0x3b,0xa6,0x83,0x40, /* "switch" */ 
+	0x28,0x56,0x15,0xa5,0xa4,0xb2, /* "telemetry" */ 
+	0xa,0x25,0xa5,0x7d,0x68, /* "timeout" */ 
+	0xa,0xb9,0x34, /* "unit" */ 
+	0x6, /* "x" */ 
+	0x0,0x11,0x8c,0xe1,0x4b, /* "accgain" */ 
+	0x80,0x11,0x8f,0x45,0x93, /* "acczero" */ 
+	0xc0,0x17,0x51,0x27,0x90,0x6c,0x9a,0x64, /* "antigravity" */ 
+	0x1,0xad,0x1f,0x4a,0xb8,0xa0, /* "autotune" */ 
+	0x10,0x5c,0xb0, /* "bank" */ 
+	0x9,0xe1,0x91, /* "board" */ 
+	0x0,0x30,0xb4,0xb2,0x8, /* "camera" */ 
+	0x6,0xf7,0x52,0x4f,0x60, /* "control" */ 
+	0x8,0x99,0x14,0x74,0x4b,0xdc, /* "direction" */ 
+	0x2,0xb8,0x22,0x61,0x48, /* "enabled" */ 
+	0x2,0xb8,0xb2,0x3e, /* "energy" */ 
+	0x40,0x5b,0x15,0xd4, /* "event" */ 
+	0x1,0xcc,0xf9,0xc,0xa0, /* "gforce" */ 
+	0x40,0x58,0x62,0x56,0xc,0x2e, /* "halfduplex" */ 
+	0x0,0x82,0x1c, /* "hdg" */ 
+	0x8,0x28,0x48,0x97,0x1c, /* "heading" */ 
+	0x8,0x7b,0x8, /* "hold" */ 
+	0x4,0x91,0x85, /* "idle" */ 
+	0x2,0x4e,0xe7,0xc8,0xa0, /* "ignore" */ 
+	0x4b,0xa8,0x59,0x58,0x2c, /* "interval" */ 
+	0x2,0x5d,0x62,0xca,0x85,0x20, /* "inverted" */ 
+	0x1a,0x13,0xe8,0xb2,0x78, /* "magzero" */ 
+	0x1a,0x19,0x1d,0x2e, /* "margin" */ 
+	0x3,0xe0,0x66,0x3e,0xe0, /* "opflow" */ 
+	0x82,0x68,0xfa, /* "pitot" */ 
+	0x2,0x17,0x68, /* "pwm" */ 
+	0x22, /* "q" */ 
+	0x9,0x15,0x81,0xc0, /* "relax" */ 
+	0x26,0x59,0x24,0x2c,0x96, /* "serialrx" */ 
+	0x1,0x3a,0xc8,0xc1,0x19, /* "surface" */ 
+	0x41,0x47,0xd0,0x2c, /* "total" */ 
+	0x5,0x20,0x10, /* "tpa" */ 
+	0x5e,0x0, /* "wp" */ 
+	0xc8, /* "y" */ 
+	0x2,0x99,0x35,0xe4,0x28, /* "airmode" */ 
+	0x2,0x99,0x4e,0x5,0x29, /* "airspeed" */ 
+	0x0,0x1c,0x26,0x60, /* "axis" */ 
+	0x10,0x68, /* "bat" */ 
+	0x1,0xa0,0x2e, /* "chan" */ 
+	0x0,0xd0,0x51,0xac, /* "check" */ 
+	0x4,0x29,0x83,0x56,0x50, /* "default" */ 
+	0x4,0x2b,0x9e,0xd0, /* "denom" */ 
+	0x10,0xb4,0x28,0xe8, /* "detect" */ 
+	0x2,0x26,0x70, /* "disp" */ 
+	0x1,0x13,0x3a, /* "dist" */ 
+	0x0,0xad,0x2c,0x8e, /* "emerg" */ 
+	0x2,0xc2,0xc0, /* "epv" */ 
+	0x2c,0xc6, /* "esc" */ 
+	0x3,0x4,0x74,0x7c, /* "factor" */ 
+	0x80,0x64,0xca,0x74, /* "first" */ 
+	0x1,0x98,0xfb, /* "flow" */ 
+	0x80,0xcf,0xb0, /* "fov" */ 
+	0x10, /* "h" */ 
+	0x4,0x24,0xe8, /* "high" */ 
+	0x2,0x5c,0x36,0x25,0xc1,0xa2,0x5e,0xe0, /* "inclination" */ 
+	0x2d,0x20, /* "ki" */ 
+	0x5c, /* "kp" */ 
+	0x0,0xc7,0x9c, /* "log" */ 
+	0xc,0x7a,0x68,0x59, /* "loiter" */ 
+	0x1,0x8f,0xbc,0x3,0x39, /* "lowpass" */ 
+	0x81,0x90,0x37, /* "lpf2" */ 
+	0x0,0xd2,0x91,0x21,0x70, /* "median" */ 
+	0x1a,0xf2,0x15,0x80, /* "model" */ 
+	0x71,0x4e, /* "neg" */ 
+	0x8,0x24,0x80, /* "pid" */ 
+	0x82,0x49,0x3a,0xb4, /* "pidsum" */ 
+	0x10,0x4d, /* "pit" */ 
+	0x1,0x9,0x3c,0x65,0x25,0x64,0x50, /* "procedure" */ 
+	0x42,0x4f,0xa3,0xc6,0xf6, /* "protocol" */ 
+	0x2,0x12,0x7d,0x92,0x42,0xc8, /* "provider" */ 
+	0x12,0x9,0x13,0x59, /* "radius" */ 
+	0x82,0x41,0x71,0xca,0x64,0xb8,0x85,0x90, /* "rangefinder" */ 
+	0x24,0x59, /* "res" */ 
+	0x82,0x45,0x99,0x68, /* "reset" */ 
+	0x9,0x60, /* "rx" */ 
+	0x13,0xa0,0x4e,0x5e, /* "stage2" */ 
+	0x2,0x74,0xcb,0xa, /* "style" */ 
+	0x9,0xe5,0xc3, /* "sync" */ 
+	0x5,0x11,0x27,0xdc, /* "throw" */ 
+	0x14,0x90,0x5d,0x36,0xa6,0x80, /* "transmit" */ 
+	0xa6, /* "tz" */ 
+	0x81,0x59,0x94, /* "use" */ 
+	0x15,0x99,0x46, /* "usec" */ 
+	0xb,0x86,0x4e,0x4b,0x8e, /* "warning" */ 
+	0x0,0x89,0xf2,0xa0, /* "abort" */ 
+	0x2,0x31,0x95,0x85,0x90,0x68,0xf9, /* "accelerator" */ 
+	0x0,0x28,0x48, /* "ahi" */ 
+	0x2,0xc6,0x3e,0xe0, /* "allow" */ 
+	0xb,0x82,0xcc,0xcc,0xb2, /* "analyser" */ 
+	0x0,0x61,0x6,0x24,0xa4, /* "applied" */ 
+	0x0,0x6b,0x47,0xb4,0x34,0x48, /* "automatic" */ 
+	0xc0,0x20,0xb8,0x80, /* "band" */ 
+	0x10,0x6a,0x40, /* "baud" */ 
+	0x8,0xa5,0x81,0x64, /* "beeper" */ 
+	0x1,0x24,0x33, /* "bias" */ 
+	0x0,0x92,0xe2, /* "bind" */ 
+	0x0,0x52,0x28,0x57,0x7,0xa5,0xd4, /* "breakpoint" */ 
+	0x0,0xc2,0xc0, /* "cal" */ 
+	0xc,0x2c,0x48,0xa4,0x1a,0x25,0xee, /* "calibration" */ 
+	0x0,0xca,0xc6,0x4c, /* "cells" */ 
+	0x3,0x2b,0xa8,0x59, /* "center" */ 
+	0x0,0x68,0xc,0x82,0x3a,0x16,0x40, /* "character" */ 
+	0x1b,0xda,0xd0,0xb8,0x80, /* "command" */ 
+	0x1b,0xdb,0x0, /* "comp" */ 
+	0xd,0xed,0x84,0x8b,0x39,0xa5,0xee, /* "compression" */ 
+	0x0,0xde,0xe3,0x24,0xe0, /* "config" */ 
+	0x1b,0xdd,0x3a,0x5,0xd4, /* "constant" */ 
+	0x0,0xde,0xf9,0x11,0x2e,0xd,0xa, /* "coordinate" */ 
+	0x1,0xbd,0xf2,0x22,0x5c,0x1a,0x16,0x60, /* "coordinates" */ 
+	0x1b,0xea,0xea, /* "count" */ 
+	0x0,0x72,0x4d,0x12,0x30,0xb0, /* "critical" */ 
+	0x3,0x93,0xe7,0x34,0x5,0x32,0x98, /* "crosshairs" */ 
+	0x9,0xd1,0x3d,0xf3,0xa7,0x4f,0x99,0x3f,0xa4,0x2b,0x28,0x1e,0xb2,0x6,0xea,0x34, /* "d_boost_gyro_delta_lpf_hz" */ 
+	0x2,0x74,0x4f,0x7c,0xe9,0xd6,0x87,0x1d,0xd,0x3a,0x11,0x8c,0xac,0x2c,0x83,0x44,0xbd,0xc0, /* "d_boost_max_at_acceleration" */ 
+	0x21,0x45,0x53, /* "debug" */ 
+	0x80,0x85,0x19,0x58, /* "decel" */ 
+	0x2,0x14,0x65,0x61,0x64,0x1a,0x25,0xee, /* "deceleration" */ 
+	0x1,0xa,0x34,0xb4,0x2c,0x98, /* "decimals" */ 
+	0x8,0x51,0xb0, /* "decl" */ 
+	0x4,0x28,0xd8,0x97,0x6,0x89,0x7b, /* "declination" */ 
+	0x80,0x42,0x98,0x35,0x65,0x26, /* "defaults" */ 
+	0x2,0x14,0xf2,0x29,0x66, /* "degrees" */ 
+	0x2,0x16,0xc9,0x19, /* "device" */ 
+	0x40,0x44,0x9d,0x34,0x98, /* "digits" */ 
+	0x8,0x99,0x95,0xc7,0x9,0xca, /* "disengage" */ 
+	0x2,0x26,0x70,0x60,0x73,0xd3,0x3e,0x43,0x2f,0x67,0x7e,0x89,0x89,0x72, /* "display_force_sw_blink" */ 
+	0xc0,0x44,0xd8,0xa0, /* "dive" */ 
+	0x23,0xee,0xe0, /* "down" */ 
+	0x12,0x74, /* "dst" */ 
+	0x1,0x32,0xe0, /* "dyn" */ 
+	0x16,0x8, /* "eph" */ 
+	0x1,0x66,0x3e,0xcc,0xae,0x9b,0xe5,0xd6,0x26,0x74,0x2b,0xba,0xf7,0x33,0x20, /* "esc_sensor_listen_only" */ 
+	0x2e,0x28, /* "ext" */ 
+	0x2,0xe2,0x92,0xf, /* "extra1" */ 
+	0x80,0x5c,0x52,0x41,0xe0, /* "extra2" */ 
+	0xc,0x9c,0x14,0x9d,0xba,0x5c,0x7e,0x86,0xb4,0x7f,0x43,0x26, /* "fixed_wing_auto_arm" */ 
+	0x80,0xcc,0x9,0xe6, /* "flags" */ 
+	0x3,0x30,0x30,0x2c,0x9e,0xe0, /* "flaperon" */ 
+	0x19,0x81,0x84, /* "flaps" */ 
+	0xc0,0x67,0xc9,0xa1,0xa0, /* "format" */ 
+	0xd,0xb, /* "fpv" */ 
+	0x0,0xd2,0x2c,0x6a,0x57,0xf,0x20, /* "frequency" */ 
+	0x35,0x4a,0xc0, /* "fuel" */ 
+	0x1a,0xfd,0xd,0x68,0xfa,0x55,0xc5,0xe9,0x8d,0xda,0x3f,0xa9,0xed,0x6, /* "fw_autotune_ff_to_i_tc" */ 
+	0x3,0x5f,0xa1,0xad,0x1f,0x4a,0xb8,0xbd,0x31,0xbb,0x47,0xf6,0x1d,0x38,0x52,0xe0, /* "fw_autotune_ff_to_p_gain" */ 
+	0x1a,0xfd,0x4d,0xb,0x26,0xf5,0x89,0x6a,0x69,0xd9,0xd1,0x23,0x5f,0x60,0xf9,0xa6,0x89,0x7b, /* "fw_iterm_limit_stick_position" */ 
+	0x80,0x6b,0xf6,0x95,0x93,0xba,0x19,0xcd,0x33,0xa7,0x72,0x1b,0xf4,0xe1,0x4b, /* "fw_turn_assist_yaw_gain" */ 
+	0x80,0x70,0xa5,0xc0, /* "gain" */ 
+	0x3c,0x27,0xda,0x89,0x8f,0xc7,0x6b,0x32,0xf4,0xe1,0x62,0x58,0x57, /* "gps_ublox_use_galileo" */ 
+	0x81,0x1,0x93,0x5e,0xe4,0x8e,0x60, /* "harmonics" */ 
+	0x40,0x66, /* "has" */ 
+	0x4,0x3d,0xa5,0x83,0xd2,0xea, /* "homepoint" */ 
+	0x1,0xf,0x6a,0x5c,0x70, /* "homing" */ 
+	0x21,0xf2,0x4e,0x9e,0xe0, /* "horizon" */ 
+	0x21,0xf4,0xa0, /* "hott" */ 
+	0x10,0xfb,0x16,0x40, /* "hover" */ 
+	0x4f,0x6, /* "i2c" */ 
+	0x4,0x8a,0xb3, /* "ibus" */ 
+	0x2,0x5c,0x1b,0x74,0x2c,0x63,0xef,0xd2,0x14,0x24,0xec,0x8a,0x35,0xbd,0xc9,0x71, /* "inav_allow_dead_reckoning" */ 
+	0xc0,0x97,0x6,0xdd,0x3c,0x83,0x64,0xd3,0x3d,0x18,0x59,0xda,0x3d,0x85,0x90,0x5c,0x32, /* "inav_gravity_cal_tolerance" */ 
+	0x81,0x69,0x63, /* "kill" */ 
+	0x0,0xc0,0x88,0xac, /* "label" */ 
+	0x3,0x3,0x44,0xd2,0xa4,0x28, /* "latitude" */ 
+	0x18,0x1c,0xbe,0xb4, /* "layout" */ 
+	0x3,0xa,0x49,0xd2,0x49,0x80, /* "ledstrip" */ 
+	0x18,0xf3,0xa4,0x60, /* "logic" */ 
+	0x63,0xdc,0x74,0xd2,0xa4,0x28, /* "longitude" */ 
+	0x18,0xf7,0xc2,0x89,0x69, /* "looptime" */ 
+	0x40,0xca,0x34, /* "ltm" */ 
+	0xd,0xa,0x5c, /* "main" */ 
+	0x6,0xa4,0x80, /* "mid" */ 
+	0x6a,0x58,0xc4, /* "milli" */ 
+	0x81,0xa9,0x9c,0xd2,0xf7, /* "mission" */ 
+	0x1,0xa9,0xc0, /* "mix" */ 
+	0x1a,0xf9,0x3d,0xc0, /* "moron" */ 
+	0x70,0x5a,0x50, /* "name" */ 
+	0x38,0x36,0xe9,0x71,0x49,0x7,0xa1,0x93,0x52,0xe3,0xf6,0x61,0x31,0x69,0x90, /* "nav_extra_arming_safety" */ 
+	0x38,0x36,0xe9,0xaf,0xd0,0xb1,0x8f,0xbf,0x5a,0x17,0x54,0x2c,0xed,0x11,0x2e,0xa5,0xc3,0x91,0x43,0x32, /* "nav_fw_allow_manual_thr_increase" */ 
+	0x81,0xc1,0xb7,0x4d,0x7e,0xb0,0x2e,0x27,0x48,0x9b,0x17,0xa1,0x71,0xd8,0x50, /* "nav_fw_land_dive_angle" */ 
+	0x38,0x36,0xe9,0xaf,0xd8,0x3e,0x7d,0x41,0xf,0xd8,0x24,0x93,0xab,0x7a,0xc4,0xb5,0x34, /* "nav_fw_pos_hdg_pidsum_limit" */ 
+	0x3,0x83,0x6e,0xb0,0x2e,0x27,0x66,0xc7,0xdc,0x8f,0xbb,0xba,0xd0,0xe0,0x2c,0xa0, /* "nav_land_slowdown_maxalt" */ 
+	0x1c,0x1b,0x75,0x81,0x71,0x3b,0x36,0x3e,0xe4,0x7d,0xdd,0xd6,0xa5,0xc1,0x65, /* "nav_land_slowdown_minalt" */ 
+	0x0,0xe0,0xdb,0xad,0xe,0x3b,0x42,0xca,0x41,0x4b,0xba,0x67,0xb1,0x8f,0xbf,0x42,0xca, /* "nav_max_terrain_follow_alt" */ 
+	0x1,0xc1,0xb7,0x5a,0x3e,0x8a,0x41,0x5a,0x5c,0x7e,0x89,0xef,0x9d,0x3a,0x44,0xcc,0xae,0x38,0x4e,0x5e,0xce,0x5,0x29, /* "nav_mc_braking_boost_disengage_speed" */ 
+	0x0,0xe0,0xdb,0xad,0x1f,0x6c,0x56,0x77,0x19,0xe9,0x28,0x59,0x37,0xac,0x81,0xba,0x8d, /* "nav_mc_vel_xy_dterm_lpf_hz" */ 
+	0x1,0xc1,0xb7,0x6b,0x32,0xf5,0xa9,0x25,0x11,0x2e,0x99,0xf2,0xe8,0x59,0x44,0x3d,0x84, /* "nav_use_midthr_for_althold" */ 
+	0x3,0x8a,0x19,0x16,0x74, /* "nearest" */ 
+	0x3,0x8b,0x5a,0x48,0x2c, /* "neutral" */ 
+	0x3,0xaa,0xd0, /* "num" */ 
+	0x3c,0xc6, /* "off" */ 
+	0x3,0xdc, /* "on" */ 
+	0x7,0xc0,0xb2,0xd,0x1f,0x20, /* "operator" */ 
+	0x3e,0x64,0xe8,0x65,0x44,0x99,0x23,0x48,0x59,0xd4,0x3e,0x49,0xd3,0xdd,0xd6,0x87,0x1d,0x82,0x68,0x34, /* "osd_artificial_horizon_max_pitch" */ 
+	0x1,0xf3,0x27,0x43,0x2a,0x24,0xc9,0x1a,0x42,0xce,0xa1,0xf2,0x4e,0x9e,0xee,0xc8,0xb6,0x2c,0xa6,0x5e,0xc9,0xec,0x60, /* "osd_artificial_horizon_reverse_roll" */ 
+	0x1f,0x32,0x74,0xb3,0xa2,0x5a,0x1a,0x25,0xee,0x9f,0x6e,0x97,0x13,0xa3,0x7b,0x60,0x57,0x4c,0x34,0x4b,0xdc, /* "osd_estimations_wind_compensation" */ 
+	0x7,0xcc,0x9d,0x61,0x4d,0x4e,0xcd,0x24,0x28,0x83,0x2e,0xcc,0x72,0x7b,0x18, /* "osd_left_sidebar_scroll" */ 
+	0x7,0xcc,0x9d,0x83,0x2b,0x3e,0x8d,0xe4,0x2f,0x48,0x93,0xa6,0x93, /* "osd_plus_code_digits" */ 
+	0x3,0xe6,0x4e,0xc9,0x27,0x45,0x3b,0x34,0x90,0xa2,0xc,0xbb,0x31,0xc9,0xec,0x60, /* "osd_right_sidebar_scroll" */ 
+	0x1f,0x32,0x76,0x69,0x21,0x44,0x19,0x76,0x63,0x93,0xd8,0xce,0x86,0x52,0x7d,0xe6, /* "osd_sidebar_scroll_arrows" */ 
+	0x7,0xd8,0xb2,0x92,0x48,0x50, /* "override" */ 
+	0x3e,0xc5,0x94,0x92,0x42,0xcc, /* "overrides" */ 
+	0xf,0xb1,0x65,0x34,0x3d,0xf4, /* "overshoot" */ 
+	0x4,0x12,0xe0, /* "pin" */ 
+	0x41,0x34,0x1a,0x39,0x44,0x48, /* "pitch2thr" */ 
+	0x10,0x60,0x68,0x67,0xc9,0xa0, /* "platform" */ 
+	0x83,0xd8,0x59, /* "poles" */ 
+	0x82,0xf,0x9a,0x68,0x97,0xb8, /* "position" */ 
+	0x10,0x91,0x46,0x99,0xa5,0xee, /* "precision" */ 
+	0x4,0x24,0x5b,0x24,0xb7, /* "preview" */ 
+	0x4,0x24,0xf1,0x96,0x73, /* "process" */ 
+	0x4,0x2a,0xc9,0x94, /* "pulse" */ 
+	0x12,0x28,0x9e,0xfa, /* "reboot" */ 
+	0x2,0x45,0x19,0x53,0x62,0xc8, /* "receiver" */ 
+	0x12,0x28,0xdf,0x62,0xcb,0x20, /* "recovery" */ 
+	0x91,0x4c,0x59,0x15,0xc3,0x28, /* "reference" */ 
+	0x24,0x58,0x3e,0x54, /* "report" */ 
+	0x4,0x98,0xc0, /* "rll" */ 
+	0x49,0xf7, /* "row" */ 
+	0x4,0xb1,0xd9,0xc1,0x3d,0x91,0xba,0x34,0x5,0xce,0x2b,0x3a,0x37,0xd5,0xd4, /* "rx_spi_rf_channel_count" */ 
+	0x4,0xc2,0x62, /* "safe" */ 
+	0x82,0x61,0xa0, /* "sat" */ 
+	0x26,0x1a,0x4c, /* "sats" */ 
+	0x13,0x10,0x66, /* "sbas" */ 
+	0x9,0x8a,0xb3, /* "sbus" */ 
+	0x4,0xd0,0x19,0x41,0xc5,0x9c, /* "sharpness" */ 
+	0xc1,0x34,0x24,0xd4,0x23,0xee,0xe0, /* "shiftdown" */ 
+	0x4d,0x2d,0xe9,0xe4,0xfa,0xb8,0x9d,0x9d,0x3,0x44,0xbd,0xdd,0x75,0x5a,0x22,0xc8, /* "sim_ground_station_number" */ 
+	0x13,0x63,0xe0,0x50, /* "slope" */ 
+	0x4d,0xa1,0x63, /* "small" */ 
+	0x1,0x36,0x86,0x54,0x83,0xe5,0x40, /* "smartport" */ 
+	0x4d,0xaf,0x7d,0x10,0xe2,0xce,0x60, /* "smoothness" */ 
+	0x9b,0xea,0xe2, /* "sound" */ 
+	0x2,0x6f,0xac,0x86,0x50, /* "source" */ 
+	0x4e,0x5,0x5d,0x25,0x56, /* "spektrum" */ 
+	0x82,0x70,0x4b,0xab,0x0, /* "spinup" */ 
+	0x4e,0x43, /* "src" */ 
+	0x4,0xe8,0x1a,0x56,0x60, /* "status" */ 
+	0x9d,0x12,0x35, /* "stick" */ 
+	0x82,0x74,0x7c, /* "stop" */ 
+	0x1,0x3c,0xce,0x85,0x68, /* "system" */ 
+	0x28,0x14,0xb0, /* "tail" */ 
+	0x14,0x44,0x9f,0x4a,0x30,0xbd,0xa2,0x59,0x4e,0x8d,0xed,0x87,0x67,0x49, /* "throttle_tilt_comp_str" */ 
+	0x2,0x8f,0x61,0x64,0x17,0xc,0xa0, /* "tolerance" */ 
+	0xa3,0xe0,0x91,0xcc, /* "topics" */ 
+	0x14,0x92, /* "tri" */ 
+	0x41,0x57,0x6,0x4d,0x29, /* "unarmed" */ 
+	0x1,0x57,0x10,0xb2,0x9a,0x1e,0xfa, /* "undershoot" */ 
+	0x2,0xae,0x4d,0x26, /* "units" */ 
+	0xa,0xc0,0x81,0xa1, /* "update" */ 
+	0x41,0x58,0x51,0x2c,0xa0, /* "uptilt" */ 
+	0x2b,0x32,0xc8, /* "user" */ 
+	0x16,0x2b,0x1c,0x52, /* "velned" */ 
+	0x2,0xc5,0x63,0xc6,0x9a,0x64, /* "velocity" */ 
+	0x16,0x30,0x66, /* "vfas" */ 
+	0xb,0x24,0x85,0x78, /* "video" */ 
+	0x2c,0x99,0xd4,0x2c, /* "visual" */ 
+	0x5,0xca,0x93,0xa2,0x80, /* "weight" */ 
+	0xba,0x5c,0x4a,0xc0, /* "windup" */ 
+	0x18,0xce, /* "xyz" */ 
+	0x80,0x00
+};
+static const char wordSymbols[] = {'3','2','_','1',};
+const char * const table_acc_hardware[] = {
+	"NONE",
+	"AUTO",
+	"ADXL345",
+	"MPU6050",
+	"MMA845x",
+	"BMA280",
+	"LSM303DLHC",
+	"MPU6000",
+	"MPU6500",
+	"MPU9250",
+	"BMI160",
+	"ICM20689",
+	"FAKE",
+};
+const char * const table_airmodeHandlingType[] = {
+	"STICK_CENTER",
+	"THROTTLE_THRESHOLD",
+};
+const char * const table_alignment[] = {
+	"DEFAULT",
+	"CW0",
+	"CW90",
+	"CW180",
+	"CW270",
+	"CW0FLIP",
+	"CW90FLIP",
+	"CW180FLIP",
+	"CW270FLIP",
+};
+const char * const table_aux_operator[] = {
+	"OR",
+	"AND",
+};
+const char * const table_baro_hardware[] = {
+	"NONE",
+	"AUTO",
+	"BMP085",
+	"MS5611",
+	"BMP280",
+	"MS5607",
+	"LPS25H",
+	"SPL06",
+	"BMP388",
+	"DPS310",
+	"FAKE",
+};
+const char * const table_bat_capacity_unit[] = {
+	"MAH",
+	"MWH",
+};
+const char * const table_bat_voltage_source[] = {
+	"RAW",
+	"SAG_COMP",
+};
+const char * const table_blackbox_compression[] = {
+	"NONE",
+	"HUFFMAN",
+};
+const char * const table_blackbox_device[] = {
+	"SERIAL",
+	"SPIFLASH",
+	"SDCARD",
+};
+const char * const table_current_sensor[] = {
+	"NONE",
+	"ADC",
+	"VIRTUAL",
+	"ESC",
+};
+const char * const table_debug_modes[] = {
+	"NONE",
+	"GYRO",
+	"AGL",
+	"FLOW_RAW",
+	"FLOW",
+	"SBUS",
+	"FPORT",
+	"ALWAYS",
+	"SAG_COMP_VOLTAGE",
+	"VIBE",
+	"CRUISE",
+	"REM_FLIGHT_TIME",
+	"SMARTAUDIO",
+	"ACC",
+	"ITERM_RELAX",
+	"ERPM",
+	"RPM_FILTER",
+	"RPM_FREQ",
+	"NAV_YAW",
+	"DYNAMIC_FILTER",
+	"DYNAMIC_FILTER_FREQUENCY",
+	"IRLOCK",
+	"CD",
+	"KALMAN",
+	"SDCARD",
+};
+const char * const table_direction[] = {
+	"RIGHT",
+	"LEFT",
+	"YAW",
+};
+const char * const table_dynamicFilterAnalyserTable[] = {
+	"FFT",
+	"SDFT",
+};
+const char * const table_dynamicFilterRangeTable[] = {
+	"HIGH",
+	"MEDIUM",
+	"LOW",
+};
+const char * const table_failsafe_procedure[] = {
+	"SET-THR",
+	"DROP",
+	"RTH",
+	"NONE",
+};
+const char * const table_filter_type[] = {
+	"PT1",
+	"BIQUAD",
+};
+const char * const table_frsky_unit[] = {
+	"METRIC",
+	"IMPERIAL",
+};
+const char * const table_gps_dyn_model[] = {
+	"PEDESTRIAN",
+	"AIR_1G",
+	"AIR_4G",
+};
+const char * const table_gps_provider[] = {
+	"NMEA",
+	"UBLOX",
+	"UNUSED",
+	"NAZA",
+	"UBLOX7",
+	"MTK",
+};
+const char * const table_gps_sbas_mode[] = {
+	"AUTO",
+	"EGNOS",
+	"WAAS",
+	"MSAS",
+	"GAGAN",
+	"NONE",
+};
+const char * const table_gyro_lpf[] = {
+	"256HZ",
+	"188HZ",
+	"98HZ",
+	"42HZ",
+	"20HZ",
+	"10HZ",
+};
+const char * const table_i2c_speed[] = {
+	"400KHZ",
+	"800KHZ",
+	"100KHZ",
+	"200KHZ",
+};
+const char * const table_iterm_relax[] = {
+	"OFF",
+	"RP",
+	"RPY",
+};
+const char * const table_iterm_relax_type[] = {
+	"GYRO",
+	"SETPOINT",
+};
+const char * const table_log_level[] = {
+	"ERROR",
+	"WARNING",
+	"INFO",
+	"VERBOSE",
+	"DEBUG",
+};
+const char * const table_ltm_rates[] = {
+	"NORMAL",
+	"MEDIUM",
+	"SLOW",
+};
+const char * const table_mag_hardware[] = {
+	"NONE",
+	"AUTO",
+	"HMC5883",
+	"AK8975",
+	"GPSMAG",
+	"MAG3110",
+	"AK8963",
+	"IST8310",
+	"QMC5883",
+	"MPU9250",
+	"IST8308",
+	"LIS3MDL",
+	"FAKE",
+};
+const char * const table_motor_pwm_protocol[] = {
+	"STANDARD",
+	"ONESHOT125",
+	"ONESHOT42",
+	"MULTISHOT",
+	"BRUSHED",
+	"DSHOT150",
+	"DSHOT300",
+	"DSHOT600",
+	"DSHOT1200",
+	"SERIALSHOT",
+};
+const char * const table_nav_extra_arming_safety[] = {
+	"OFF",
+	"ON",
+	"ALLOW_BYPASS",
+};
+const char * const table_nav_rth_allow_landing[] = {
+	"NEVER",
+	"ALWAYS",
+	"FS_ONLY",
+};
+const char * const table_nav_rth_alt_mode[] = {
+	"CURRENT",
+	"EXTRA",
+	"FIXED",
+	"MAX",
+	"AT_LEAST",
+	"AT_LEAST_LINEAR_DESCENT",
+};
+const char * const table_nav_user_control_mode[] = {
+	"ATTI",
+	"CRUISE",
+};
+const char * const table_off_on[] = {
+	"OFF",
+	"ON",
+};
+const char * const table_opflow_hardware[] = {
+	"NONE",
+	"PMW3901",
+	"CXOF",
+	"MSP",
+	"FAKE",
+};
+const char * const table_osd_ahi_style[] = {
+	"DEFAULT",
+	"LINE",
+};
+const char * const table_osd_alignment[] = {
+	"LEFT",
+	"RIGHT",
+};
+const char * const table_osd_crosshairs_style[] = {
+	"DEFAULT",
+	"AIRCRAFT",
+	"TYPE3",
+	"TYPE4",
+	"TYPE5",
+	"TYPE6",
+	"TYPE7",
+};
+const char * const table_osd_sidebar_scroll[] = {
+	"NONE",
+	"ALTITUDE",
+	"GROUND_SPEED",
+	"HOME_DISTANCE",
+};
+const char * const table_osd_stats_energy_unit[] = {
+	"MAH",
+	"WH",
+};
+const char * const table_osd_unit[] = {
+	"IMPERIAL",
+	"METRIC",
+	"UK",
+};
+const char * const table_osd_video_system[] = {
+	"AUTO",
+	"PAL",
+	"NTSC",
+};
+const char * const table_pidTypeTable[] = {
+	"NONE",
+	"PID",
+	"PIFF",
+	"AUTO",
+};
+const char * const table_pitot_hardware[] = {
+	"NONE",
+	"AUTO",
+	"MS4525",
+	"ADC",
+	"VIRTUAL",
+	"FAKE",
+};
+const char * const table_platform_type[] = {
+	"MULTIROTOR",
+	"AIRPLANE",
+	"HELICOPTER",
+	"TRICOPTER",
+	"ROVER",
+	"BOAT",
+};
+const char * const table_rangefinder_hardware[] = {
+	"NONE",
+	"HCSR04",
+	"SRF10",
+	"INAV_I2C",
+	"VL53L0X",
+	"MSP",
+	"UIB",
+	"BENEWAKE",
+};
+const char * const table_receiver_type[] = {
+	"NONE",
+	"PPM",
+	"SERIAL",
+	"MSP",
+	"SPI",
+	"UIB",
+};
+const char * const table_reset_type[] = {
+	"NEVER",
+	"FIRST_ARM",
+	"EACH_ARM",
+};
+const char * const table_rssi_source[] = {
+	"NONE",
+	"AUTO",
+	"ADC",
+	"CHANNEL",
+	"PROTOCOL",
+	"MSP",
+};
+const char * const table_serial_rx[] = {
+	"SPEK1024",
+	"SPEK2048",
+	"SBUS",
+	"SUMD",
+	"SUMH",
+	"XB-B",
+	"XB-B-RJ01",
+	"IBUS",
+	"JETIEXBUS",
+	"CRSF",
+	"FPORT",
+	"SBUS_FAST",
+};
+const char * const table_servo_protocol[] = {
+	"PWM",
+	"SERVO_DRIVER",
+	"SBUS",
+};
+const char * const table_smartport_fuel_unit[] = {
+	"PERCENT",
+	"MAH",
+	"MWH",
+};
+const char * const table_tz_automatic_dst[] = {
+	"OFF",
+	"EU",
+	"USA",
+};
+const char * const table_voltage_sensor[] = {
+	"NONE",
+	"ADC",
+	"ESC",
+};
+const char * const table_vtx_low_power_disarm[] = {
+	"OFF",
+	"ON",
+	"UNTIL_FIRST_ARM",
+};
+static const lookupTableEntry_t settingLookupTables[] = {
+	{ table_acc_hardware, sizeof(table_acc_hardware) / sizeof(char*) },
+	{ table_airmodeHandlingType, sizeof(table_airmodeHandlingType) / sizeof(char*) },
+	{ table_alignment, sizeof(table_alignment) / sizeof(char*) },
+	{ table_aux_operator, sizeof(table_aux_operator) / sizeof(char*) },
+	{ table_baro_hardware, sizeof(table_baro_hardware) / sizeof(char*) },
+	{ table_bat_capacity_unit, sizeof(table_bat_capacity_unit) / sizeof(char*) },
+	{ table_bat_voltage_source, sizeof(table_bat_voltage_source) / sizeof(char*) },
+	{ table_blackbox_compression, sizeof(table_blackbox_compression) / sizeof(char*) },
+	{ table_blackbox_device, sizeof(table_blackbox_device) / sizeof(char*) },
+	{ table_current_sensor, sizeof(table_current_sensor) / sizeof(char*) },
+	{ table_debug_modes, sizeof(table_debug_modes) / sizeof(char*) },
+	{ table_direction, sizeof(table_direction) / sizeof(char*) },
+	{ table_dynamicFilterAnalyserTable, sizeof(table_dynamicFilterAnalyserTable) / sizeof(char*) },
+	{ table_dynamicFilterRangeTable, sizeof(table_dynamicFilterRangeTable) / sizeof(char*) },
+	{ table_failsafe_procedure, sizeof(table_failsafe_procedure) / sizeof(char*) },
+	{ table_filter_type, sizeof(table_filter_type) / sizeof(char*) },
+	{ table_frsky_unit, sizeof(table_frsky_unit) / sizeof(char*) },
+	{ table_gps_dyn_model, sizeof(table_gps_dyn_model) / sizeof(char*) },
+	{ table_gps_provider, sizeof(table_gps_provider) / sizeof(char*) },
+	{ table_gps_sbas_mode, sizeof(table_gps_sbas_mode) / sizeof(char*) },
+	{ table_gyro_lpf, sizeof(table_gyro_lpf) / sizeof(char*) },
+	{ table_i2c_speed, sizeof(table_i2c_speed) / sizeof(char*) },
+	{ table_iterm_relax, sizeof(table_iterm_relax) / sizeof(char*) },
+	{ table_iterm_relax_type, sizeof(table_iterm_relax_type) / sizeof(char*) },
+	{ table_log_level, sizeof(table_log_level) / sizeof(char*) },
+	{ table_ltm_rates, sizeof(table_ltm_rates) / sizeof(char*) },
+	{ table_mag_hardware, sizeof(table_mag_hardware) / sizeof(char*) },
+	{ table_motor_pwm_protocol, sizeof(table_motor_pwm_protocol) / sizeof(char*) },
+	{ table_nav_extra_arming_safety, sizeof(table_nav_extra_arming_safety) / sizeof(char*) },
+	{ table_nav_rth_allow_landing, sizeof(table_nav_rth_allow_landing) / sizeof(char*) },
+	{ table_nav_rth_alt_mode, sizeof(table_nav_rth_alt_mode) / sizeof(char*) },
+	{ table_nav_user_control_mode, sizeof(table_nav_user_control_mode) / sizeof(char*) },
+	{ table_off_on, sizeof(table_off_on) / sizeof(char*) },
+	{ table_opflow_hardware, sizeof(table_opflow_hardware) / sizeof(char*) },
+	{ table_osd_ahi_style, sizeof(table_osd_ahi_style) / sizeof(char*) },
+	{ table_osd_alignment, sizeof(table_osd_alignment) / sizeof(char*) },
+	{ table_osd_crosshairs_style, sizeof(table_osd_crosshairs_style) / sizeof(char*) },
+	{ table_osd_sidebar_scroll, sizeof(table_osd_sidebar_scroll) / sizeof(char*) },
+	{ table_osd_stats_energy_unit, sizeof(table_osd_stats_energy_unit) / sizeof(char*) },
+	{ table_osd_unit, sizeof(table_osd_unit) / sizeof(char*) },
+	{ table_osd_video_system, sizeof(table_osd_video_system) / sizeof(char*) },
+	{ table_pidTypeTable, sizeof(table_pidTypeTable) / sizeof(char*) },
+	{ table_pitot_hardware, sizeof(table_pitot_hardware) / sizeof(char*) },
+	{ table_platform_type, sizeof(table_platform_type) / sizeof(char*) },
+	{ table_rangefinder_hardware, sizeof(table_rangefinder_hardware) / sizeof(char*) },
+	{ table_receiver_type, sizeof(table_receiver_type) / sizeof(char*) },
+	{ table_reset_type, sizeof(table_reset_type) / sizeof(char*) },
+	{ table_rssi_source, sizeof(table_rssi_source) / sizeof(char*) },
+	{ table_serial_rx, sizeof(table_serial_rx) / sizeof(char*) },
+	{ table_servo_protocol, sizeof(table_servo_protocol) / sizeof(char*) },
+	{ table_smartport_fuel_unit, sizeof(table_smartport_fuel_unit) / sizeof(char*) },
+	{ table_tz_automatic_dst, sizeof(table_tz_automatic_dst) / sizeof(char*) },
+	{ table_voltage_sensor, sizeof(table_voltage_sensor) / sizeof(char*) },
+	{ table_vtx_low_power_disarm, sizeof(table_vtx_low_power_disarm) / sizeof(char*) },
+};
+static const uint32_t settingMinMaxTable[] = {
+	0,
+	100,
+	200,
+	1000,
+	1,
+	255,
+	2000,
+	10,
+	500,
+	65535,
+	10000,
+	5,
+	32767,
+	-32768,
+	4,
+	8,
+	20,
+	30,
+	50,
+	5000,
+	-1800,
+	-550,
+	2,
+	3,
+	180,
+	3600,
+	65000,
+	4294967295,
+	80,
+	90,
+	250,
+	1250,
+	-20,
+	60,
+	120,
+	900,
+	8192,
+	16000,
+	60000,
+	2147483647,
+	-800,
+	6,
+	15,
+	16,
+	45,
+	450,
+	750,
+	800,
+	1500,
+	2250,
+	4000,
+	9999,
+	500000,
+	-18000,
+	-10000,
+	-1440,
+	-1000,
+	-180,
+	-90,
+	-40,
+	-2,
+	-1,
+	9,
+	11,
+	13,
+	18,
+	32,
+	40,
+	48,
+	126,
+	128,
+	150,
+	300,
+	359,
+	400,
+	498,
+	600,
+	1440,
+	3000,
+	9000,
+	9990,
+	18000,
+	20000,
+	32000,
+	50000,
+};
+typedef uint8_t setting_min_max_idx_t;
+#define SETTING_INDEXES_GET_MIN(val) (val->config.minmax.indexes[0])
+#define SETTING_INDEXES_GET_MAX(val) (val->config.minmax.indexes[1])
+static const setting_t settingsTable[] = {
+	// PG_GYRO_CONFIG
+	{ {144, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 79}, offsetof(gyroConfig_t, looptime) },
+	{ {6, 182, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, gyroSync) },
+	{ {169, 1, 186, 2, 146, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 15}, offsetof(gyroConfig_t, pidProcessDenom) },
+	{ {29, 6, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(gyroConfig_t, gyro_align) },
+	{ {6, 45, 26, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_LPF }, offsetof(gyroConfig_t, gyro_lpf) },
+	{ {6, 26, 17, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(gyroConfig_t, gyro_soft_lpf_hz) },
+	{ {6, 26, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_soft_lpf_type) },
+	{ {151, 2, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 70}, offsetof(gyroConfig_t, gyroMovementCalibrationThreshold) },
+	{ {6, 33, 17, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_notch_hz) },
+	{ {6, 33, 87, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 8}, offsetof(gyroConfig_t, gyro_notch_cutoff) },
+	{ {6, 180, 1, 164, 1, 17}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_stage2_lowpass_hz) },
+	{ {6, 180, 1, 164, 1, 19}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_stage2_lowpass_type) },
+	{ {58, 6, 33, 114, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, dynamicGyroNotchEnabled) },
+	{ {58, 6, 33, 97, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERRANGETABLE }, offsetof(gyroConfig_t, dynamicGyroNotchRange) },
+	{ {58, 6, 33, 193, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERANALYSERTABLE }, offsetof(gyroConfig_t, dynamicGyroNotchAnalyser) },
+	{ {58, 6, 33, 214, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 23}, offsetof(gyroConfig_t, dynamicGyroNotchCount) },
+	{ {58, 6, 33, 131, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 3}, offsetof(gyroConfig_t, dynamicGyroNotchQ) },
+	{ {58, 6, 33, 10, 17, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {17, 3}, offsetof(gyroConfig_t, dynamicGyroNotchMinHz) },
+	{ {6, 93, 114, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, kalmanEnabled) },
+	{ {6, 93, 131, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 37}, offsetof(gyroConfig_t, kalman_q) },
+	{ {6, 93, 20, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 67}, offsetof(gyroConfig_t, kalman_w) },
+	{ {6, 93, 201, 2, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 37}, offsetof(gyroConfig_t, kalman_sharpness) },
+	// PG_ADC_CHANNEL_CONFIG
+	{ {50, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_BATTERY]) },
+	{ {65, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_RSSI]) },
+	{ {67, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_CURRENT]) },
+	{ {140, 1, 79, 56, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_AIRSPEED]) },
+	// PG_ACCELEROMETER_CONFIG
+	{ {21, 33, 17, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(accelerometerConfig_t, acc_notch_hz) },
+	{ {21, 33, 87, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 5}, offsetof(accelerometerConfig_t, acc_notch_cutoff) },
+	{ {29, 21, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(accelerometerConfig_t, acc_align) },
+	{ {21, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, offsetof(accelerometerConfig_t, acc_hardware) },
+	{ {21, 26, 17, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(accelerometerConfig_t, acc_lpf_hz) },
+	{ {21, 26, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(accelerometerConfig_t, acc_soft_lpf_type) },
+	{ {106, 104, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[X]) },
+	{ {106, 138, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Y]) },
+	{ {106, 13, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Z]) },
+	{ {105, 104, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {4, 36}, offsetof(accelerometerConfig_t, accGain.raw[X]) },
+	{ {105, 138, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {4, 36}, offsetof(accelerometerConfig_t, accGain.raw[Y]) },
+	{ {105, 13, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {4, 36}, offsetof(accelerometerConfig_t, accGain.raw[Z]) },
+	// PG_RANGEFINDER_CONFIG
+	{ {176, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RANGEFINDER_HARDWARE }, offsetof(rangefinderConfig_t, rangefinder_hardware) },
+	{ {176, 1, 166, 1, 91, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rangefinderConfig_t, use_median_filtering) },
+	// PG_OPFLOW_CONFIG
+	{ {128, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OPFLOW_HARDWARE }, offsetof(opticalFlowConfig_t, opflow_hardware) },
+	{ {128, 1, 74, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(opticalFlowConfig_t, opflow_scale) },
+	{ {29, 128, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(opticalFlowConfig_t, opflow_align) },
+	// PG_COMPASS_CONFIG
+	{ {29, 32, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(compassConfig_t, mag_align) },
+	{ {32, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, offsetof(compassConfig_t, mag_hardware) },
+	{ {32, 224, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {53, 81}, offsetof(compassConfig_t, mag_declination) },
+	{ {126, 104, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[X]) },
+	{ {126, 138, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Y]) },
+	{ {126, 13, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Z]) },
+	{ {32, 203, 1, 28, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 34}, offsetof(compassConfig_t, magCalibrationTimeLimit) },
+	{ {29, 32, 18, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, rollDeciDegrees) },
+	{ {29, 32, 14, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, pitchDeciDegrees) },
+	{ {29, 32, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, yawDeciDegrees) },
+	// PG_BAROMETER_CONFIG
+	{ {42, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, offsetof(barometerConfig_t, baro_hardware) },
+	{ {42, 166, 1, 91, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(barometerConfig_t, use_median_filtering) },
+	{ {42, 202, 1, 219, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(barometerConfig_t, baro_calibration_tolerance) },
+	// PG_PITOTMETER_CONFIG
+	{ {129, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PITOT_HARDWARE }, offsetof(pitotmeterConfig_t, pitot_hardware) },
+	{ {129, 1, 26, 148, 2, 17}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(pitotmeterConfig_t, pitot_lpf_milli_hz) },
+	{ {129, 1, 74, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pitotmeterConfig_t, pitot_scale) },
+	// PG_RX_CONFIG
+	{ {189, 2, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RECEIVER_TYPE }, offsetof(rxConfig_t, receiverType) },
+	{ {10, 144, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(rxConfig_t, mincheck) },
+	{ {11, 144, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(rxConfig_t, maxcheck) },
+	{ {65, 209, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RSSI_SOURCE }, offsetof(rxConfig_t, rssi_source) },
+	{ {65, 56, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 65}, offsetof(rxConfig_t, rssi_channel) },
+	{ {65, 10, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMin) },
+	{ {65, 11, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMax) },
+	{ {200, 2, 182, 1, 124, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 10}, offsetof(rxConfig_t, sbusSyncInterval) },
+	{ {64, 91, 246, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rcFilterFrequency) },
+	{ {133, 1, 174, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERIAL_RX }, offsetof(rxConfig_t, serialrx_provider) },
+	{ {133, 1, 125, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, serialrx_inverted) },
+	{ {195, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(rxConfig_t, rx_spi_rf_channel_count) },
+	{ {210, 2, 197, 2, 200, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(rxConfig_t, spektrum_sat_bind) },
+	{ {179, 1, 10, 187, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {46, 49}, offsetof(rxConfig_t, rx_min_usec) },
+	{ {179, 1, 11, 187, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {46, 49}, offsetof(rxConfig_t, rx_max_usec) },
+	{ {133, 1, 118, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, halfDuplex) },
+	// PG_BLACKBOX_CONFIG
+	{ {82, 5, 165, 2, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 9}, offsetof(blackboxConfig_t, rate_num) },
+	{ {82, 5, 146, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 9}, offsetof(blackboxConfig_t, rate_denom) },
+	{ {82, 227, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, offsetof(blackboxConfig_t, device) },
+	{ {82, 209, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_COMPRESSION }, offsetof(blackboxConfig_t, compression) },
+	// PG_MOTOR_CONFIG
+	{ {11, 49, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(motorConfig_t, maxthrottle) },
+	{ {10, 207, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 6}, offsetof(motorConfig_t, mincommand) },
+	{ {40, 130, 1, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 83}, offsetof(motorConfig_t, motorPwmRate) },
+	{ {40, 78, 28, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(motorConfig_t, motorAccelTimeMs) },
+	{ {40, 220, 1, 28, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(motorConfig_t, motorDecelTimeMs) },
+	{ {40, 130, 1, 173, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, offsetof(motorConfig_t, motorPwmProtocol) },
+	{ {49, 74, 0, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(motorConfig_t, throttleScale) },
+	{ {49, 122, 0, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {14, 17}, offsetof(motorConfig_t, throttleIdle) },
+	{ {40, 182, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {14, 5}, offsetof(motorConfig_t, motorPoleCount) },
+	// PG_FAILSAFE_CONFIG
+	{ {16, 44, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_delay) },
+	{ {16, 190, 2, 44, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_recovery_delay) },
+	{ {16, 166, 2, 44, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_off_delay) },
+	{ {16, 49, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(failsafeConfig_t, failsafe_throttle) },
+	{ {16, 49, 71, 44, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 72}, offsetof(failsafeConfig_t, failsafe_throttle_low_delay) },
+	{ {16, 172, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_procedure) },
+	{ {16, 214, 2, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(failsafeConfig_t, failsafe_stick_motion_threshold) },
+	{ {16, 2, 18, 24, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {40, 47}, offsetof(failsafeConfig_t, failsafe_fw_roll_angle) },
+	{ {16, 2, 14, 24, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {40, 47}, offsetof(failsafeConfig_t, failsafe_fw_pitch_angle) },
+	{ {16, 2, 8, 5, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {56, 3}, offsetof(failsafeConfig_t, failsafe_fw_yaw_rate) },
+	{ {16, 10, 69, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(failsafeConfig_t, failsafe_min_distance) },
+	{ {16, 10, 69, 172, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_min_distance_procedure) },
+	{ {16, 149, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(failsafeConfig_t, failsafe_mission) },
+	// PG_BOARD_ALIGNMENT
+	{ {29, 110, 18, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, rollDeciDegrees) },
+	{ {29, 110, 14, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, pitchDeciDegrees) },
+	{ {29, 110, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, yawDeciDegrees) },
+	// PG_BATTERY_METERS_CONFIG
+	{ {50, 95, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_SENSOR }, offsetof(batteryMetersConfig_t, voltage.type) },
+	{ {50, 74, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, voltage.scale) },
+	{ {67, 95, 74, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {54, 10}, offsetof(batteryMetersConfig_t, current.scale) },
+	{ {67, 95, 63, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(batteryMetersConfig_t, current.offset) },
+	{ {67, 95, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_SENSOR }, offsetof(batteryMetersConfig_t, current.type) },
+	{ {142, 1, 52, 212, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_VOLTAGE_SOURCE }, offsetof(batteryMetersConfig_t, voltageSource) },
+	{ {86, 73, 0, 0, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryMetersConfig_t, cruise_power) },
+	{ {122, 73, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, idle_power) },
+	{ {27, 115, 127, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(batteryMetersConfig_t, rth_energy_margin) },
+	{ {37, 208, 1, 233, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryMetersConfig_t, throttle_compensation_weight) },
+	// PG_BATTERY_PROFILES
+	{ {142, 1, 204, 1, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 15}, offsetof(batteryProfile_t, cells) },
+	{ {50, 66, 147, 1, 52, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellDetect) },
+	{ {50, 11, 66, 52, 0, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMax) },
+	{ {50, 10, 66, 52, 0, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMin) },
+	{ {50, 188, 1, 66, 52, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellWarning) },
+	{ {81, 84, 0, 0, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.value) },
+	{ {81, 84, 188, 1, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.warning) },
+	{ {81, 84, 215, 1, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.critical) },
+	{ {81, 84, 103, 0, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_CAPACITY_UNIT }, offsetof(batteryProfile_t, capacity.unit) },
+	// PG_MIXER_CONFIG
+	{ {40, 113, 125, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, motorDirectionInverted) },
+	{ {181, 2, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PLATFORM_TYPE }, offsetof(mixerConfig_t, platformType) },
+	{ {255, 1, 243, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, hasFlaps) },
+	{ {167, 1, 185, 2, 19, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {61, 12}, offsetof(mixerConfig_t, appliedMixerPreset) },
+	{ {2, 10, 49, 232, 1, 14}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 45}, offsetof(mixerConfig_t, fwMinThrottleDownPitchAngle) },
+	// PG_REVERSIBLE_MOTORS_CONFIG
+	{ {77, 38, 71, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(reversibleMotorsConfig_t, deadband_low) },
+	{ {77, 38, 158, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(reversibleMotorsConfig_t, deadband_high) },
+	{ {77, 164, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(reversibleMotorsConfig_t, neutral) },
+	// PG_SERVO_CONFIG
+	{ {75, 173, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERVO_PROTOCOL }, offsetof(servoConfig_t, servo_protocol) },
+	{ {75, 205, 1, 187, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(servoConfig_t, servoCenterPulse) },
+	{ {75, 130, 1, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 75}, offsetof(servoConfig_t, servoPwmRate) },
+	{ {75, 26, 17, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {0, 74}, offsetof(servoConfig_t, servo_lowpass_freq) },
+	{ {242, 1, 183, 1, 63, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 45}, offsetof(servoConfig_t, flaperon_throw_offset) },
+	{ {221, 2, 222, 2, 75, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(servoConfig_t, tri_unarmed_servo) },
+	// PG_CONTROL_RATE_PROFILES
+	{ {37, 147, 2, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcMid8) },
+	{ {37, 59, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcExpo8) },
+	{ {136, 1, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.dynPID) },
+	{ {136, 1, 201, 1, 0, 0}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {3, 6}, offsetof(controlRateConfig_t, throttle.pa_breakpoint) },
+	{ {2, 136, 1, 28, 211, 1}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 19}, offsetof(controlRateConfig_t, throttle.fixedWingTauMs) },
+	{ {64, 59, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcExpo8) },
+	{ {64, 8, 59, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcYawExpo8) },
+	{ {18, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {41, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_ROLL]) },
+	{ {14, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {41, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_PITCH]) },
+	{ {8, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {22, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_YAW]) },
+	{ {47, 64, 59, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcExpo8) },
+	{ {47, 64, 8, 59, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcYawExpo8) },
+	{ {47, 18, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_ROLL]) },
+	{ {47, 14, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_PITCH]) },
+	{ {47, 8, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_YAW]) },
+	{ {245, 1, 150, 2, 226, 1}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 18}, offsetof(controlRateConfig_t, misc.fpvCamAngleDegrees) },
+	// PG_SERIAL_CONFIG
+	{ {188, 2, 206, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {68, 69}, offsetof(serialConfig_t, reboot_character) },
+	// PG_IMU_CONFIG
+	{ {39, 88, 161, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_acc) },
+	{ {39, 88, 160, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_acc) },
+	{ {39, 88, 161, 1, 32, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_mag) },
+	{ {39, 88, 160, 1, 32, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_mag) },
+	{ {205, 2, 24, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 24}, offsetof(imuConfig_t, small_angle) },
+	{ {39, 21, 123, 5, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 16}, offsetof(imuConfig_t, acc_ignore_rate) },
+	{ {39, 21, 123, 204, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(imuConfig_t, acc_ignore_slope) },
+	// PG_ARMING_CONFIG
+	{ {240, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, fixed_wing_auto_arm) },
+	{ {68, 137, 2, 100, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, disarm_kill_switch) },
+	{ {100, 68, 44, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(armingConfig_t, switchDisarmDelayMs) },
+	// PG_GENERAL_SETTINGS
+	{ {194, 1, 225, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 23}, offsetof(generalSettings_t, appliedDefaults) },
+	// PG_RPM_FILTER_CONFIG
+	{ {98, 6, 91, 114, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rpmFilterConfig_t, gyro_filter_enabled) },
+	{ {98, 6, 254, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 23}, offsetof(rpmFilterConfig_t, gyro_harmonics) },
+	{ {98, 6, 10, 17, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 2}, offsetof(rpmFilterConfig_t, gyro_min_hz) },
+	{ {98, 6, 131, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 78}, offsetof(rpmFilterConfig_t, gyro_q) },
+	// PG_GPS_CONFIG
+	{ {31, 174, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_PROVIDER }, offsetof(gpsConfig_t, provider) },
+	{ {31, 199, 2, 62, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_SBAS_MODE }, offsetof(gpsConfig_t, sbasMode) },
+	{ {31, 234, 1, 167, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_DYN_MODEL }, offsetof(gpsConfig_t, dynModel) },
+	{ {31, 55, 210, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoConfig) },
+	{ {31, 55, 197, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoBaud) },
+	{ {253, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, ubloxUseGalileo) },
+	{ {31, 10, 198, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 7}, offsetof(gpsConfig_t, gpsMinSats) },
+	// PG_RC_CONTROLS_CONFIG
+	{ {38, 0, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 66}, offsetof(rcControlsConfig_t, deadband) },
+	{ {8, 38, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rcControlsConfig_t, yaw_deadband) },
+	{ {15, 121, 38, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {22, 30}, offsetof(rcControlsConfig_t, pos_hold_deadband) },
+	{ {80, 121, 38, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 30}, offsetof(rcControlsConfig_t, alt_hold_deadband) },
+	{ {77, 38, 49, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(rcControlsConfig_t, mid_throttle_deadband) },
+	{ {3, 139, 1, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AIRMODEHANDLINGTYPE }, offsetof(rcControlsConfig_t, airmodeHandlingType) },
+	{ {3, 139, 1, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(rcControlsConfig_t, airmodeThrottleThreshold) },
+	// PG_PID_PROFILE
+	{ {3, 7, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].P) },
+	{ {3, 22, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].I) },
+	{ {3, 30, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].D) },
+	{ {3, 85, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].FF) },
+	{ {3, 7, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].P) },
+	{ {3, 22, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].I) },
+	{ {3, 30, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].D) },
+	{ {3, 85, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].FF) },
+	{ {3, 7, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].P) },
+	{ {3, 22, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].I) },
+	{ {3, 30, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].D) },
+	{ {3, 85, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].FF) },
+	{ {3, 7, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].P) },
+	{ {3, 22, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].I) },
+	{ {3, 30, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].D) },
+	{ {2, 7, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].P) },
+	{ {2, 22, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].I) },
+	{ {2, 90, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].FF) },
+	{ {2, 7, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].P) },
+	{ {2, 22, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].I) },
+	{ {2, 90, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].FF) },
+	{ {2, 7, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].P) },
+	{ {2, 22, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].I) },
+	{ {2, 90, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].FF) },
+	{ {2, 7, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].P) },
+	{ {2, 22, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].I) },
+	{ {2, 30, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].D) },
+	{ {11, 24, 159, 1, 193, 2}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 35}, offsetof(pidProfile_t, max_angle_inclination[FD_ROLL]) },
+	{ {11, 24, 159, 1, 171, 1}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 35}, offsetof(pidProfile_t, max_angle_inclination[FD_PITCH]) },
+	{ {89, 26, 17, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf_hz) },
+	{ {89, 26, 19, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf_type) },
+	{ {89, 165, 1, 17, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf2_hz) },
+	{ {89, 165, 1, 19, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf2_type) },
+	{ {8, 26, 17, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, yaw_lpf_hz) },
+	{ {2, 70, 183, 1, 61, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, fixedWingItermThrowLimit) },
+	{ {2, 163, 1, 113, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DIRECTION }, offsetof(pidProfile_t, loiter_direction) },
+	{ {2, 191, 2, 140, 1, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {4, 19}, offsetof(pidProfile_t, fixedWingReferenceAirspeed) },
+	{ {251, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 22}, offsetof(pidProfile_t, fixedWingCoordinatedYawGain) },
+	{ {250, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, fixedWingItermLimitOnStickPosition) },
+	{ {170, 1, 61, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, offsetof(pidProfile_t, pidSumLimit) },
+	{ {170, 1, 61, 8, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, offsetof(pidProfile_t, pidSumLimitYaw) },
+	{ {70, 234, 2, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 29}, offsetof(pidProfile_t, itermWindupPointPercent) },
+	{ {5, 78, 61, 18, 14, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 52}, offsetof(pidProfile_t, axisAccelerationLimitRollPitch) },
+	{ {5, 78, 61, 8, 0, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 52}, offsetof(pidProfile_t, axisAccelerationLimitYaw) },
+	{ {120, 121, 5, 61, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 30}, offsetof(pidProfile_t, heading_hold_rate_limit) },
+	{ {1, 3, 15, 13, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_Z].P) },
+	{ {1, 3, 51, 13, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].P) },
+	{ {1, 3, 51, 13, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].I) },
+	{ {1, 3, 51, 13, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].D) },
+	{ {1, 3, 15, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_XY].P) },
+	{ {1, 3, 51, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].P) },
+	{ {1, 3, 51, 23, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].I) },
+	{ {1, 3, 51, 23, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].D) },
+	{ {1, 3, 51, 23, 90, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].FF) },
+	{ {1, 3, 120, 7, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_mc.pid[PID_HEADING].P) },
+	{ {161, 2, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidProfile_t, navVelXyDTermLpfHz) },
+	{ {1, 2, 15, 13, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].P) },
+	{ {1, 2, 15, 13, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].I) },
+	{ {1, 2, 15, 13, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].D) },
+	{ {1, 2, 15, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].P) },
+	{ {1, 2, 15, 23, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].I) },
+	{ {1, 2, 15, 23, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].D) },
+	{ {1, 2, 120, 7, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_HEADING].P) },
+	{ {1, 2, 15, 119, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].P) },
+	{ {1, 2, 15, 119, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].I) },
+	{ {1, 2, 15, 119, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].D) },
+	{ {156, 2, 0, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, offsetof(pidProfile_t, navFwPosHdgPidsumLimit) },
+	{ {3, 70, 132, 1, 19, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX_TYPE }, offsetof(pidProfile_t, iterm_relax_type) },
+	{ {3, 70, 132, 1, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX }, offsetof(pidProfile_t, iterm_relax) },
+	{ {3, 70, 132, 1, 87, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {4, 1}, offsetof(pidProfile_t, iterm_relax_cutoff) },
+	{ {30, 83, 153, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {4, 23}, offsetof(pidProfile_t, dBoostFactor) },
+	{ {218, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {3, 37}, offsetof(pidProfile_t, dBoostMaxAtAlleceleration) },
+	{ {217, 1, 0, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 30}, offsetof(pidProfile_t, dBoostGyroDeltaLpfHz) },
+	{ {107, 252, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {4, 16}, offsetof(pidProfile_t, antigravityGain) },
+	{ {107, 190, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {4, 16}, offsetof(pidProfile_t, antigravityAccelerator) },
+	{ {107, 87, 26, 17, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {4, 17}, offsetof(pidProfile_t, antigravityCutoff) },
+	{ {169, 1, 19, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PIDTYPETABLE }, offsetof(pidProfile_t, pidControllerType) },
+	{ {3, 85, 26, 17, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, controlDerivativeLpfHz) },
+	// PG_PID_AUTOTUNE_CONFIG
+	{ {2, 108, 178, 2, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 8}, offsetof(pidAutotuneConfig_t, fw_overshoot_time) },
+	{ {2, 108, 223, 2, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 8}, offsetof(pidAutotuneConfig_t, fw_undershoot_time) },
+	{ {2, 108, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_max_rate_threshold) },
+	{ {249, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_ff_to_p_gain) },
+	{ {248, 1, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 19}, offsetof(pidAutotuneConfig_t, fw_ff_to_i_time_constant) },
+	// PG_POSITION_ESTIMATION_CONFIG
+	{ {9, 55, 32, 223, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, automatic_mag_declination) },
+	{ {136, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(positionEstimationConfig_t, gravity_calibration_tolerance) },
+	{ {9, 186, 1, 31, 228, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, use_gps_velned) },
+	{ {135, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, allow_dead_reckoning) },
+	{ {9, 178, 1, 54, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_altitude_type) },
+	{ {9, 178, 1, 92, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_home_type) },
+	{ {9, 11, 134, 1, 54, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(positionEstimationConfig_t, max_surface_altitude) },
+	{ {9, 20, 13, 134, 1, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_p) },
+	{ {9, 20, 13, 134, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_v) },
+	{ {9, 20, 23, 155, 1, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_p) },
+	{ {9, 20, 23, 155, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_v) },
+	{ {9, 20, 13, 42, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_baro_p) },
+	{ {9, 20, 13, 31, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_p) },
+	{ {9, 20, 13, 31, 41, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_v) },
+	{ {9, 20, 23, 31, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_p) },
+	{ {9, 20, 23, 31, 41, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_v) },
+	{ {9, 20, 13, 177, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_res_v) },
+	{ {9, 20, 23, 177, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_res_v) },
+	{ {9, 20, 235, 2, 21, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(positionEstimationConfig_t, w_xyz_acc_p) },
+	{ {9, 20, 21, 199, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(positionEstimationConfig_t, w_acc_bias) },
+	{ {9, 11, 235, 1, 151, 1}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 51}, offsetof(positionEstimationConfig_t, max_eph_epv) },
+	{ {9, 42, 151, 1, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 51}, offsetof(positionEstimationConfig_t, baro_epv) },
+	// PG_NAV_CONFIG
+	{ {1, 68, 167, 2, 94, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.disarm_on_landing) },
+	{ {162, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.use_thr_mid_for_althold) },
+	{ {153, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_EXTRA_ARMING_SAFETY }, offsetof(navConfig_t, general.flags.extra_arming_safety) },
+	{ {1, 227, 2, 112, 62, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_USER_CONTROL_MODE }, offsetof(navConfig_t, general.flags.user_control_mode) },
+	{ {1, 183, 2, 102, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(navConfig_t, general.pos_failure_timeout) },
+	{ {1, 137, 1, 175, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 10}, offsetof(navConfig_t, general.waypoint_radius) },
+	{ {1, 137, 1, 196, 2, 69}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.waypoint_safe_distance) },
+	{ {1, 55, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_speed) },
+	{ {1, 55, 57, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_climb_rate) },
+	{ {1, 47, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_speed) },
+	{ {1, 47, 57, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_climb_rate) },
+	{ {1, 94, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.land_descent_rate) },
+	{ {158, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 3}, offsetof(navConfig_t, general.land_slowdown_minalt) },
+	{ {157, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 50}, offsetof(navConfig_t, general.land_slowdown_maxalt) },
+	{ {1, 150, 1, 94, 36, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.emerg_descent_rate) },
+	{ {1, 10, 27, 69, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, general.min_rth_distance) },
+	{ {1, 177, 2, 40, 215, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.auto_overrides_motor_stop) },
+	{ {1, 27, 57, 154, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_first) },
+	{ {1, 27, 57, 123, 150, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_ignore_emerg) },
+	{ {1, 27, 217, 2, 154, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_tail_first) },
+	{ {1, 27, 192, 1, 94, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALLOW_LANDING }, offsetof(navConfig_t, general.flags.rth_allow_landing) },
+	{ {1, 27, 80, 62, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALT_MODE }, offsetof(navConfig_t, general.flags.rth_alt_control_mode) },
+	{ {1, 27, 189, 1, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_abort_threshold) },
+	{ {159, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, general.max_terrain_follow_altitude) },
+	{ {1, 27, 54, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_altitude) },
+	{ {1, 27, 92, 54, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_home_altitude) },
+	{ {1, 27, 92, 63, 69, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_home_offset_distance) },
+	{ {1, 27, 92, 63, 113, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 73}, offsetof(navConfig_t, general.rth_home_offset_direction) },
+	{ {1, 3, 109, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {42, 44}, offsetof(navConfig_t, mc.max_bank_angle) },
+	{ {1, 3, 132, 2, 37, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, mc.hover_throttle) },
+	{ {1, 3, 55, 68, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 10}, offsetof(navConfig_t, mc.auto_disarm_delay) },
+	{ {1, 3, 43, 36, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.braking_speed_threshold) },
+	{ {1, 3, 43, 229, 1, 36}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.braking_disengage_speed) },
+	{ {1, 3, 43, 102, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 19}, offsetof(navConfig_t, mc.braking_timeout) },
+	{ {1, 3, 43, 83, 153, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, mc.braking_boost_factor) },
+	{ {1, 3, 43, 83, 102, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, mc.braking_boost_timeout) },
+	{ {1, 3, 43, 83, 36, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 3}, offsetof(navConfig_t, mc.braking_boost_speed_threshold) },
+	{ {160, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.braking_boost_disengage_speed) },
+	{ {1, 3, 43, 109, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {42, 33}, offsetof(navConfig_t, mc.braking_bank_angle) },
+	{ {1, 3, 15, 221, 1, 28}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(navConfig_t, mc.posDecelerationTime) },
+	{ {1, 3, 15, 59, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(navConfig_t, mc.posResponseExpo) },
+	{ {1, 2, 86, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, fw.cruise_throttle) },
+	{ {1, 2, 10, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, fw.min_throttle) },
+	{ {1, 2, 11, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, fw.max_throttle) },
+	{ {1, 2, 109, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_bank_angle) },
+	{ {1, 2, 57, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_climb_angle) },
+	{ {1, 2, 231, 1, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_dive_angle) },
+	{ {1, 2, 180, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(navConfig_t, fw.pitch_to_throttle) },
+	{ {1, 2, 163, 1, 175, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(navConfig_t, fw.loiter_radius) },
+	{ {1, 2, 86, 36, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(navConfig_t, fw.cruise_speed) },
+	{ {1, 2, 112, 207, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 62}, offsetof(navConfig_t, fw.control_smoothness) },
+	{ {155, 2, 0, 0, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(navConfig_t, fw.land_dive_angle) },
+	{ {1, 2, 25, 229, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 10}, offsetof(navConfig_t, fw.launch_velocity_thresh) },
+	{ {1, 2, 25, 78, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 82}, offsetof(navConfig_t, fw.launch_accel_thresh) },
+	{ {1, 2, 25, 11, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 24}, offsetof(navConfig_t, fw.launch_max_angle) },
+	{ {1, 2, 25, 147, 1, 28}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 3}, offsetof(navConfig_t, fw.launch_time_thresh) },
+	{ {1, 2, 25, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, fw.launch_throttle) },
+	{ {1, 2, 25, 122, 37, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, offsetof(navConfig_t, fw.launch_idle_throttle) },
+	{ {1, 2, 25, 40, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, fw.launch_motor_timer) },
+	{ {1, 2, 25, 211, 2, 28}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, fw.launch_motor_spinup_time) },
+	{ {1, 2, 25, 10, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_min_time) },
+	{ {1, 2, 25, 102, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_timeout) },
+	{ {1, 2, 25, 11, 54, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_max_altitude) },
+	{ {1, 2, 25, 57, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 44}, offsetof(navConfig_t, fw.launch_climb_angle) },
+	{ {1, 2, 86, 8, 5, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, offsetof(navConfig_t, fw.cruise_yaw_rate) },
+	{ {154, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.allow_manual_thr_increase) },
+	{ {1, 186, 1, 2, 8, 112}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.useFwNavYawControl) },
+	{ {1, 2, 8, 38, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 29}, offsetof(navConfig_t, fw.yawControlDeadband) },
+	// PG_TELEMETRY_CONFIG
+	{ {101, 100, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_switch) },
+	{ {101, 125, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_inverted) },
+	{ {60, 145, 1, 139, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {58, 29}, offsetof(telemetryConfig_t, gpsNoFixLatitude) },
+	{ {60, 145, 1, 143, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {57, 24}, offsetof(telemetryConfig_t, gpsNoFixLongitude) },
+	{ {60, 213, 1, 244, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, frsky_coordinate_format) },
+	{ {60, 103, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FRSKY_UNIT }, offsetof(telemetryConfig_t, frsky_unit) },
+	{ {60, 230, 2, 184, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, frsky_vfas_precision) },
+	{ {60, 14, 18, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, frsky_pitch_roll) },
+	{ {192, 2, 66, 52, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, report_cell_voltage) },
+	{ {131, 2, 12, 208, 2, 124}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 34}, offsetof(telemetryConfig_t, hottAlarmSoundInterval) },
+	{ {101, 118, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, halfDuplex) },
+	{ {206, 2, 247, 1, 103, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SMARTPORT_FUEL_UNIT }, offsetof(telemetryConfig_t, smartportFuelUnit) },
+	{ {134, 2, 101, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, ibusTelemetryType) },
+	{ {145, 2, 225, 2, 5, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LTM_RATES }, offsetof(telemetryConfig_t, ltmUpdateRate) },
+	{ {203, 2, 0, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 43}, offsetof(telemetryConfig_t, simGroundStationNumber) },
+	{ {99, 179, 2, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(telemetryConfig_t, simPin) },
+	{ {99, 184, 1, 124, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 9}, offsetof(telemetryConfig_t, simTransmitInterval) },
+	{ {99, 184, 1, 241, 1, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(telemetryConfig_t, simTransmitFlags) },
+	{ {21, 116, 34, 158, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdHigh) },
+	{ {21, 116, 34, 71, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 35}, offsetof(telemetryConfig_t, accEventThresholdLow) },
+	{ {21, 116, 34, 168, 1, 104}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdNegX) },
+	{ {99, 71, 54, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(telemetryConfig_t, simLowAltitude) },
+	{ {72, 237, 1, 213, 2, 5}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, mavlink.extended_status_rate) },
+	{ {72, 64, 143, 1, 5, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, mavlink.rc_channels_rate) },
+	{ {72, 15, 5, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, mavlink.position_rate) },
+	{ {72, 238, 1, 5, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, mavlink.extra1_rate) },
+	{ {72, 239, 1, 5, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, mavlink.extra2_rate) },
+	// PG_LED_STRIP_CONFIG
+	{ {141, 2, 232, 2, 198, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(ledStripConfig_t, ledstrip_visual_beeper) },
+	// PG_OSD_CONFIG
+	{ {4, 231, 2, 216, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_VIDEO_SYSTEM }, offsetof(osdConfig_t, video_system) },
+	{ {4, 194, 2, 202, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(osdConfig_t, row_shiftdown) },
+	{ {4, 224, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_UNIT }, offsetof(osdConfig_t, units) },
+	{ {4, 76, 115, 103, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_STATS_ENERGY_UNIT }, offsetof(osdConfig_t, stats_energy_unit) },
+	{ {4, 65, 12, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(osdConfig_t, rssi_alarm) },
+	{ {4, 28, 12, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 76}, offsetof(osdConfig_t, time_alarm) },
+	{ {4, 80, 12, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(osdConfig_t, alt_alarm) },
+	{ {4, 149, 1, 12, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 84}, offsetof(osdConfig_t, dist_alarm) },
+	{ {4, 168, 1, 80, 12, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(osdConfig_t, neg_alt_alarm) },
+	{ {4, 67, 12, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(osdConfig_t, current_alarm) },
+	{ {4, 117, 12, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 16}, offsetof(osdConfig_t, gforce_alarm) },
+	{ {4, 117, 141, 1, 12, 10}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(osdConfig_t, gforce_axis_alarm_min) },
+	{ {4, 117, 141, 1, 12, 11}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(osdConfig_t, gforce_axis_alarm_max) },
+	{ {4, 39, 48, 12, 10, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, imu_temp_alarm_min) },
+	{ {4, 39, 48, 12, 11, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, imu_temp_alarm_max) },
+	{ {4, 152, 1, 48, 12, 11}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 48}, offsetof(osdConfig_t, esc_temp_alarm_max) },
+	{ {4, 152, 1, 48, 12, 10}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 48}, offsetof(osdConfig_t, esc_temp_alarm_min) },
+	{ {4, 42, 48, 12, 10, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, baro_temp_alarm_min) },
+	{ {4, 42, 48, 12, 11, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, baro_temp_alarm_max) },
+	{ {4, 48, 138, 2, 29, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_ALIGNMENT }, offsetof(osdConfig_t, temp_label_align) },
+	{ {170, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, ahi_reverse_roll) },
+	{ {169, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 29}, offsetof(osdConfig_t, ahi_max_pitch) },
+	{ {4, 216, 1, 181, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_CROSSHAIRS_STYLE }, offsetof(osdConfig_t, crosshairs_style) },
+	{ {4, 130, 2, 63, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {60, 22}, offsetof(osdConfig_t, horizon_offset) },
+	{ {4, 111, 226, 2, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {59, 28}, offsetof(osdConfig_t, camera_uptilt) },
+	{ {4, 111, 156, 1, 157, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {33, 71}, offsetof(osdConfig_t, camera_fov_h) },
+	{ {4, 111, 156, 1, 41, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 34}, offsetof(osdConfig_t, camera_fov_v) },
+	{ {4, 35, 127, 157, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(osdConfig_t, hud_margin_h) },
+	{ {4, 35, 127, 41, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 23}, offsetof(osdConfig_t, hud_margin_v) },
+	{ {4, 35, 129, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, hud_homing) },
+	{ {4, 35, 128, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, hud_homepoint) },
+	{ {4, 35, 96, 148, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(osdConfig_t, hud_radar_disp) },
+	{ {4, 35, 96, 97, 10, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 17}, offsetof(osdConfig_t, hud_radar_range_min) },
+	{ {4, 35, 96, 97, 11, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 80}, offsetof(osdConfig_t, hud_radar_range_max) },
+	{ {4, 35, 96, 163, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 50}, offsetof(osdConfig_t, hud_radar_nearest) },
+	{ {4, 35, 137, 1, 148, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 23}, offsetof(osdConfig_t, hud_wp_disp) },
+	{ {172, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_SIDEBAR_SCROLL }, offsetof(osdConfig_t, left_sidebar_scroll) },
+	{ {174, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_SIDEBAR_SCROLL }, offsetof(osdConfig_t, right_sidebar_scroll) },
+	{ {175, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, sidebar_scroll_arrows) },
+	{ {4, 146, 2, 52, 222, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 22}, offsetof(osdConfig_t, main_voltage_decimals) },
+	{ {4, 212, 1, 228, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {15, 63}, offsetof(osdConfig_t, coordinate_digits) },
+	{ {171, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, estimations_wind_compensation) },
+	{ {4, 16, 100, 140, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, osd_failsafe_switch_layout) },
+	{ {173, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 64}, offsetof(osdConfig_t, plus_code_digits) },
+	{ {4, 191, 1, 181, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_AHI_STYLE }, offsetof(osdConfig_t, osd_ahi_style) },
+	// PG_SYSTEM_CONFIG
+	{ {133, 2, 36, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_I2C_SPEED }, offsetof(systemConfig_t, i2c_speed) },
+	{ {219, 1, 62, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG_MODES }, offsetof(systemConfig_t, debug_mode) },
+	{ {218, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(systemConfig_t, throttle_tilt_compensation_strength) },
+	{ {152, 2, 0, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 43}, offsetof(systemConfig_t, name) },
+	// PG_MODE_ACTIVATION_OPERATOR_CONFIG
+	{ {62, 97, 142, 2, 168, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AUX_OPERATOR }, offsetof(modeActivationOperatorConfig_t, modeActivationOperator) },
+	// PG_STATS_CONFIG
+	{ {76, 0, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(statsConfig_t, stats_enabled) },
+	{ {76, 135, 1, 28, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_time) },
+	{ {76, 135, 1, 149, 1, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_dist) },
+	{ {76, 135, 1, 115, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_energy) },
+	// PG_TIME_CONFIG
+	{ {185, 1, 63, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {55, 77}, offsetof(timeConfig_t, tz_offset) },
+	{ {185, 1, 195, 1, 233, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_TZ_AUTOMATIC_DST }, offsetof(timeConfig_t, tz_automatic_dst) },
+	// PG_DISPLAY_CONFIG
+	{ {230, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(displayConfig_t, force_sw_blink) },
+	// PG_VTX_CONFIG
+	{ {53, 118, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(vtxConfig_t, halfDuplex) },
+	// PG_VTX_SETTINGS_CONFIG
+	{ {53, 196, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(vtxSettingsConfig_t, band) },
+	{ {53, 56, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 15}, offsetof(vtxSettingsConfig_t, channel) },
+	{ {53, 73, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {4, 11}, offsetof(vtxSettingsConfig_t, power) },
+	{ {53, 71, 73, 68, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VTX_LOW_POWER_DISARM }, offsetof(vtxSettingsConfig_t, lowPowerDisarm) },
+	{ {53, 171, 1, 62, 143, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 15}, offsetof(vtxSettingsConfig_t, pitModeChan) },
+	{ {53, 11, 73, 176, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(vtxSettingsConfig_t, maxPowerOverride) },
+	// PG_LOG_CONFIG
+	{ {162, 1, 46, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOG_LEVEL }, offsetof(logConfig_t, level) },
+	{ {162, 1, 220, 2, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, offsetof(logConfig_t, topics) },
+	// PG_ESC_SENSOR_CONFIG
+	{ {236, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(escSensorConfig_t, listenOnly) },
+};
+#define SETTING_NAME_HASH_BUCKETS 189
+static const uint8_t settingNameHashSeeds[] = {
+	1, 8, 4, 7, 1, 4, 0, 2, 0, 1, 0, 0, 0, 9, 6, 9,
+	0, 22, 10, 2, 9, 0, 2, 1, 6, 8, 6, 7, 10, 3, 7, 24,
+	16, 2, 7, 13, 4, 2, 1, 0, 10, 1, 7, 2, 0, 7, 3, 15,
+	5, 17, 2, 7, 2, 3, 2, 3, 28, 4, 2, 7, 1, 0, 1, 6,
+	4, 20, 2, 6, 26, 1, 0, 20, 1, 10, 6, 98, 11, 3, 2, 9,
+	1, 8, 1, 3, 23, 12, 12, 10, 6, 52, 44, 9, 25, 32, 11, 34,
+	132, 21, 48, 11, 2, 1, 1, 61, 10, 3, 20, 102, 8, 5, 2, 8,
+	8, 18, 4, 13, 10, 56, 56, 1, 13, 12, 1, 7, 1, 3, 9, 4,
+	5, 4, 11, 19, 8, 70, 64, 0, 17, 4, 20, 1, 9, 1, 14, 0,
+	15, 19, 74, 7, 1, 10, 2, 2, 10, 16, 51, 14, 0, 92, 0, 23,
+	54, 13, 4, 4, 4, 10, 0, 20, 0, 4, 20, 10, 20, 1, 1, 33,
+	3, 30, 11, 0, 156, 28, 26, 36, 8, 1, 97, 89, 10,
+};
+static const uint16_t settingNameHashIndexes[] = {
+	170, 327, 426, 308, 112, 144, 177, 332, 155, 176, 302, 4, 196, 326, 444, 322,
+	421, 174, 245, 295, 102, 328, 238, 341, 340, 230, 336, 446, 240, 291, 63, 323,
+	362, 41, 356, 275, 379, 257, 304, 159, 294, 355, 50, 214, 278, 428, 145, 219,
+	207, 287, 172, 57, 359, 158, 193, 140, 386, 435, 404, 40, 390, 12, 84, 237,
+	449, 348, 110, 52, 77, 234, 45, 442, 445, 382, 165, 46, 33, 104, 20, 242,
+	289, 425, 149, 252, 152, 300, 330, 79, 200, 413, 190, 164, 42, 99, 329, 255,
+	199, 226, 90, 215, 447, 132, 371, 368, 350, 201, 166, 420, 358, 56, 253, 406,
+	76, 97, 126, 157, 127, 281, 423, 249, 179, 440, 309, 412, 173, 395, 285, 198,
+	254, 259, 48, 288, 280, 367, 414, 71, 403, 129, 111, 303, 217, 377, 192, 136,
+	284, 120, 123, 352, 78, 407, 272, 353, 27, 339, 24, 297, 437, 17, 182, 360,
+	344, 13, 231, 21, 410, 61, 417, 204, 261, 276, 168, 228, 218, 208, 106, 224,
+	239, 118, 393, 337, 366, 374, 357, 115, 354, 408, 32, 262, 335, 268, 381, 60,
+	298, 125, 388, 36, 29, 119, 194, 401, 154, 246, 100, 37, 274, 131, 35, 292,
+	363, 399, 103, 209, 175, 38, 243, 83, 387, 316, 334, 88, 232, 277, 92, 135,
+	89, 306, 301, 338, 271, 113, 310, 188, 197, 187, 345, 317, 229, 314, 91, 378,
+	427, 311, 10, 101, 349, 293, 375, 365, 203, 53, 264, 122, 116, 364, 62, 402,
+	189, 320, 169, 251, 439, 70, 315, 73, 43, 55, 385, 185, 205, 147, 19, 161,
+	256, 416, 432, 333, 8, 141, 241, 267, 438, 163, 216, 233, 222, 318, 270, 160,
+	380, 49, 11, 16, 269, 128, 86, 415, 373, 82, 75, 130, 235, 105, 434, 273,
+	30, 409, 351, 15, 14, 419, 25, 398, 211, 283, 156, 450, 422, 183, 108, 31,
+	312, 186, 376, 109, 325, 23, 2, 121, 68, 305, 220, 195, 124, 431, 443, 22,
+	64, 44, 59, 250, 85, 213, 307, 180, 331, 134, 133, 206, 1, 210, 167, 117,
+	139, 369, 69, 342, 191, 98, 178, 87, 436, 39, 143, 95, 286, 81, 7, 151,
+	346, 418, 247, 430, 225, 361, 223, 299, 400, 227, 94, 34, 448, 433, 72, 319,
+	47, 266, 148, 184, 181, 397, 58, 5, 142, 0, 9, 150, 321, 74, 212, 405,
+	279, 66, 296, 65, 153, 396, 244, 146, 424, 263, 383, 394, 138, 54, 6, 372,
+	258, 429, 202, 347, 137, 265, 343, 18, 290, 171, 80, 221, 93, 162, 96, 324,
+	248, 384, 391, 389, 370, 28, 313, 282, 3, 114, 26, 411, 51, 236, 392, 67,
+	441, 107, 260,
+};
@@ -0,0 +1,1481 @@
+// This file has been automatically generated by utils/settings.rb
+// Don't make any modifications to it. They will be lost.
+
+#pragma once
+#define SETTING_MAX_NAME_LENGTH 37
+#define SETTING_MAX_WORD_LENGTH 37
+#define SETTING_ENCODED_NAME_MAX_BYTES 6
+#define SETTINGS_WORDS_BITS_PER_CHAR 5
+#define SETTINGS_TABLE_COUNT 452
+typedef uint16_t setting_offset_t;
+#define SETTINGS_PGN_COUNT 42
+typedef int16_t setting_min_t;
+typedef uint32_t setting_max_t;
+#define SETTING_MIN_MAX_INDEX_BYTES 2
+enum {
+	TABLE_ACC_HARDWARE,
+	TABLE_AIRMODEHANDLINGTYPE,
+	TABLE_ALIGNMENT,
+	TABLE_AUX_OPERATOR,
+	TABLE_BARO_HARDWARE,
+	TABLE_BAT_CAPACITY_UNIT,
+	TABLE_BAT_VOLTAGE_SOURCE,
+	TABLE_BLACKBOX_COMPRESSION,
+	TABLE_BLACKBOX_DEVICE,
+	TABLE_CURRENT_SENSOR,
+	TABLE_DEBUG_MODES,
+	TABLE_DIRECTION,
+	TABLE_DYNAMICFILTERANALYSERTABLE,
+	TABLE_DYNAMICFILTERRANGETABLE,
+	TABLE_FAILSAFE_PROCEDURE,
+	TABLE_FILTER_TYPE,
+	TABLE_FRSKY_UNIT,
+	TABLE_GPS_DYN_MODEL,
+	TABLE_GPS_PROVIDER,
+	TABLE_GPS_SBAS_MODE,
+	TABLE_GYRO_LPF,
+	TABLE_I2C_SPEED,
+	TABLE_ITERM_RELAX,
+	TABLE_ITERM_RELAX_TYPE,
+	TABLE_LOG_LEVEL,
+	TABLE_LTM_RATES,
+	TABLE_MAG_HARDWARE,
+	TABLE_MOTOR_PWM_PROTOCOL,
+	TABLE_NAV_EXTRA_ARMING_SAFETY,
+	TABLE_NAV_RTH_ALLOW_LANDING,
+	TABLE_NAV_RTH_ALT_MODE,
+	TABLE_NAV_USER_CONTROL_MODE,
+	TABLE_OFF_ON,
+	TABLE_OPFLOW_HARDWARE,
+	TABLE_OSD_AHI_STYLE,
+	TABLE_OSD_ALIGNMENT,
+	TABLE_OSD_CROSSHAIRS_STYLE,
+	TABLE_OSD_SIDEBAR_SCROLL,
+	TABLE_OSD_STATS_ENERGY_UNIT,
+	TABLE_OSD_UNIT,
+	TABLE_OSD_VIDEO_SYSTEM,
+	TABLE_PIDTYPETABLE,
+	TABLE_PITOT_HARDWARE,
+	TABLE_PLATFORM_TYPE,
+	TABLE_RANGEFINDER_HARDWARE,
+	TABLE_RECEIVER_TYPE,
+	TABLE_RESET_TYPE,
+	TABLE_RSSI_SOURCE,
+	TABLE_SERIAL_RX,
+	TABLE_SERVO_PROTOCOL,
+	TABLE_SMARTPORT_FUEL_UNIT,
+	TABLE_TZ_AUTOMATIC_DST,
+	TABLE_VOLTAGE_SENSOR,
+	TABLE_VTX_LOW_POWER_DISARM,
+	LOOKUP_TABLE_COUNT,
+};
+extern const char * const table_acc_hardware[];
+extern const char * const table_airmodeHandlingType[];
+extern const char * const table_alignment[];
+extern const char * const table_aux_operator[];
+extern const char * const table_baro_hardware[];
+extern const char * const table_bat_capacity_unit[];
+extern const char * const table_bat_voltage_source[];
+extern const char * const table_blackbox_compression[];
+extern const char * const table_blackbox_device[];
+extern const char * const table_current_sensor[];
+extern const char * const table_debug_modes[];
+extern const char * const table_direction[];
+extern const char * const table_dynamicFilterAnalyserTable[];
+extern const char * const table_dynamicFilterRangeTable[];
+extern const char * const table_failsafe_procedure[];
+extern const char * const table_filter_type[];
+extern const char * const table_frsky_unit[];
+extern const char * const table_gps_dyn_model[];
+extern const char * const table_gps_provider[];
+extern const char * const table_gps_sbas_mode[];
+extern const char * const table_gyro_lpf[];
+extern const char * const table_i2c_speed[];
+extern const char * const table_iterm_relax[];
+extern const char * const table_iterm_relax_type[];
+extern const char * const table_log_level[];
+extern const char * const table_ltm_rates[];
+extern const char * const table_mag_hardware[];
+extern const char * const table_motor_pwm_protocol[];
+extern const char * const table_nav_extra_arming_safety[];
+extern const char * const table_nav_rth_allow_landing[];
+extern const char * const table_nav_rth_alt_mode[];
+extern const char * const table_nav_user_control_mode[];
+extern const char * const table_off_on[];
+extern const char * const table_opflow_hardware[];
+extern const char * const table_osd_ahi_style[];
+extern const char * const table_osd_alignment[];
+extern const char * const table_osd_crosshairs_style[];
+extern const char * const table_osd_sidebar_scroll[];
+extern const char * const table_osd_stats_energy_unit[];
+extern const char * const table_osd_unit[];
+extern const char * const table_osd_video_system[];
+extern const char * const table_pidTypeTable[];
+extern const char * const table_pitot_hardware[];
+extern const char * const table_platform_type[];
+extern const char * const table_rangefinder_hardware[];
+extern const char * const table_receiver_type[];
+extern const char * const table_reset_type[];
+extern const char * const table_rssi_source[];
+extern const char * const table_serial_rx[];
+extern const char * const table_servo_protocol[];
+extern const char * const table_smartport_fuel_unit[];
+extern const char * const table_tz_automatic_dst[];
+extern const char * const table_voltage_sensor[];
+extern const char * const table_vtx_low_power_disarm[];
+#define SETTING_LOOPTIME 0
+#define SETTING_LOOPTIME_MIN 0
+#define SETTING_LOOPTIME_MAX 9000
+#define SETTING_GYRO_SYNC 1
+#define SETTING_GYRO_SYNC_MIN 0
+#define SETTING_GYRO_SYNC_MAX 0
+#define SETTING_PID_PROCESS_DENOM 2
+#define SETTING_PID_PROCESS_DENOM_MIN 1
+#define SETTING_PID_PROCESS_DENOM_MAX 8
+#define SETTING_ALIGN_GYRO 3
+#define SETTING_ALIGN_GYRO_MIN 0
+#define SETTING_ALIGN_GYRO_MAX 0
+#define SETTING_GYRO_HARDWARE_LPF 4
+#define SETTING_GYRO_HARDWARE_LPF_MIN 0
+#define SETTING_GYRO_HARDWARE_LPF_MAX 0
+#define SETTING_GYRO_LPF_HZ 5
+#define SETTING_GYRO_LPF_HZ_MIN 0
+#define SETTING_GYRO_LPF_HZ_MAX 200
+#define SETTING_GYRO_LPF_TYPE 6
+#define SETTING_GYRO_LPF_TYPE_MIN 0
+#define SETTING_GYRO_LPF_TYPE_MAX 0
+#define SETTING_MORON_THRESHOLD 7
+#define SETTING_MORON_THRESHOLD_MIN 0
+#define SETTING_MORON_THRESHOLD_MAX 128
+#define SETTING_GYRO_NOTCH_HZ 8
+#define SETTING_GYRO_NOTCH_HZ_MIN 0
+#define SETTING_GYRO_NOTCH_HZ_MAX 500
+#define SETTING_GYRO_NOTCH_CUTOFF 9
+#define SETTING_GYRO_NOTCH_CUTOFF_MIN 1
+#define SETTING_GYRO_NOTCH_CUTOFF_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ 10
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE 11
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_ENABLED 12
+#define SETTING_DYNAMIC_GYRO_NOTCH_ENABLED_MIN 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_ENABLED_MAX 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_RANGE 13
+#define SETTING_DYNAMIC_GYRO_NOTCH_RANGE_MIN 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_RANGE_MAX 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_ANALYSER 14
+#define SETTING_DYNAMIC_GYRO_NOTCH_ANALYSER_MIN 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_ANALYSER_MAX 0
+#define SETTING_DYNAMIC_GYRO_NOTCH_COUNT 15
+#define SETTING_DYNAMIC_GYRO_NOTCH_COUNT_MIN 1
+#define SETTING_DYNAMIC_GYRO_NOTCH_COUNT_MAX 3
+#define SETTING_DYNAMIC_GYRO_NOTCH_Q 16
+#define SETTING_DYNAMIC_GYRO_NOTCH_Q_MIN 1
+#define SETTING_DYNAMIC_GYRO_NOTCH_Q_MAX 1000
+#define SETTING_DYNAMIC_GYRO_NOTCH_MIN_HZ 17
+#define SETTING_DYNAMIC_GYRO_NOTCH_MIN_HZ_MIN 30
+#define SETTING_DYNAMIC_GYRO_NOTCH_MIN_HZ_MAX 1000
+#define SETTING_GYRO_KALMAN_ENABLED 18
+#define SETTING_GYRO_KALMAN_ENABLED_MIN 0
+#define SETTING_GYRO_KALMAN_ENABLED_MAX 0
+#define SETTING_GYRO_KALMAN_Q 19
+#define SETTING_GYRO_KALMAN_Q_MIN 1
+#define SETTING_GYRO_KALMAN_Q_MAX 16000
+#define SETTING_GYRO_KALMAN_W 20
+#define SETTING_GYRO_KALMAN_W_MIN 1
+#define SETTING_GYRO_KALMAN_W_MAX 40
+#define SETTING_GYRO_KALMAN_SHARPNESS 21
+#define SETTING_GYRO_KALMAN_SHARPNESS_MIN 1
+#define SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000
+#define SETTING_VBAT_ADC_CHANNEL 22
+#define SETTING_VBAT_ADC_CHANNEL_MIN 0
+#define SETTING_VBAT_ADC_CHANNEL_MAX 4
+#define SETTING_RSSI_ADC_CHANNEL 23
+#define SETTING_RSSI_ADC_CHANNEL_MIN 0
+#define SETTING_RSSI_ADC_CHANNEL_MAX 4
+#define SETTING_CURRENT_ADC_CHANNEL 24
+#define SETTING_CURRENT_ADC_CHANNEL_MIN 0
+#define SETTING_CURRENT_ADC_CHANNEL_MAX 4
+#define SETTING_AIRSPEED_ADC_CHANNEL 25
+#define SETTING_AIRSPEED_ADC_CHANNEL_MIN 0
+#define SETTING_AIRSPEED_ADC_CHANNEL_MAX 4
+#define SETTING_ACC_NOTCH_HZ 26
+#define SETTING_ACC_NOTCH_HZ_MIN 0
+#define SETTING_ACC_NOTCH_HZ_MAX 255
+#define SETTING_ACC_NOTCH_CUTOFF 27
+#define SETTING_ACC_NOTCH_CUTOFF_MIN 1
+#define SETTING_ACC_NOTCH_CUTOFF_MAX 255
+#define SETTING_ALIGN_ACC 28
+#define SETTING_ALIGN_ACC_MIN 0
+#define SETTING_ALIGN_ACC_MAX 0
+#define SETTING_ACC_HARDWARE 29
+#define SETTING_ACC_HARDWARE_MIN 0
+#define SETTING_ACC_HARDWARE_MAX 0
+#define SETTING_ACC_LPF_HZ 30
+#define SETTING_ACC_LPF_HZ_MIN 0
+#define SETTING_ACC_LPF_HZ_MAX 200
+#define SETTING_ACC_LPF_TYPE 31
+#define SETTING_ACC_LPF_TYPE_MIN 0
+#define SETTING_ACC_LPF_TYPE_MAX 0
+#define SETTING_ACCZERO_X 32
+#define SETTING_ACCZERO_X_MIN -32768
+#define SETTING_ACCZERO_X_MAX 32767
+#define SETTING_ACCZERO_Y 33
+#define SETTING_ACCZERO_Y_MIN -32768
+#define SETTING_ACCZERO_Y_MAX 32767
+#define SETTING_ACCZERO_Z 34
+#define SETTING_ACCZERO_Z_MIN -32768
+#define SETTING_ACCZERO_Z_MAX 32767
+#define SETTING_ACCGAIN_X 35
+#define SETTING_ACCGAIN_X_MIN 1
+#define SETTING_ACCGAIN_X_MAX 8192
+#define SETTING_ACCGAIN_Y 36
+#define SETTING_ACCGAIN_Y_MIN 1
+#define SETTING_ACCGAIN_Y_MAX 8192
+#define SETTING_ACCGAIN_Z 37
+#define SETTING_ACCGAIN_Z_MIN 1
+#define SETTING_ACCGAIN_Z_MAX 8192
+#define SETTING_RANGEFINDER_HARDWARE 38
+#define SETTING_RANGEFINDER_HARDWARE_MIN 0
+#define SETTING_RANGEFINDER_HARDWARE_MAX 0
+#define SETTING_RANGEFINDER_MEDIAN_FILTER 39
+#define SETTING_RANGEFINDER_MEDIAN_FILTER_MIN 0
+#define SETTING_RANGEFINDER_MEDIAN_FILTER_MAX 0
+#define SETTING_OPFLOW_HARDWARE 40
+#define SETTING_OPFLOW_HARDWARE_MIN 0
+#define SETTING_OPFLOW_HARDWARE_MAX 0
+#define SETTING_OPFLOW_SCALE 41
+#define SETTING_OPFLOW_SCALE_MIN 0
+#define SETTING_OPFLOW_SCALE_MAX 10000
+#define SETTING_ALIGN_OPFLOW 42
+#define SETTING_ALIGN_OPFLOW_MIN 0
+#define SETTING_ALIGN_OPFLOW_MAX 0
+#define SETTING_ALIGN_MAG 43
+#define SETTING_ALIGN_MAG_MIN 0
+#define SETTING_ALIGN_MAG_MAX 0
+#define SETTING_MAG_HARDWARE 44
+#define SETTING_MAG_HARDWARE_MIN 0
+#define SETTING_MAG_HARDWARE_MAX 0
+#define SETTING_MAG_DECLINATION 45
+#define SETTING_MAG_DECLINATION_MIN -18000
+#define SETTING_MAG_DECLINATION_MAX 18000
+#define SETTING_MAGZERO_X 46
+#define SETTING_MAGZERO_X_MIN -32768
+#define SETTING_MAGZERO_X_MAX 32767
+#define SETTING_MAGZERO_Y 47
+#define SETTING_MAGZERO_Y_MIN -32768
+#define SETTING_MAGZERO_Y_MAX 32767
+#define SETTING_MAGZERO_Z 48
+#define SETTING_MAGZERO_Z_MIN -32768
+#define SETTING_MAGZERO_Z_MAX 32767
+#define SETTING_MAG_CALIBRATION_TIME 49
+#define SETTING_MAG_CALIBRATION_TIME_MIN 30
+#define SETTING_MAG_CALIBRATION_TIME_MAX 120
+#define SETTING_ALIGN_MAG_ROLL 50
+#define SETTING_ALIGN_MAG_ROLL_MIN -1800
+#define SETTING_ALIGN_MAG_ROLL_MAX 3600
+#define SETTING_ALIGN_MAG_PITCH 51
+#define SETTING_ALIGN_MAG_PITCH_MIN -1800
+#define SETTING_ALIGN_MAG_PITCH_MAX 3600
+#define SETTING_ALIGN_MAG_YAW 52
+#define SETTING_ALIGN_MAG_YAW_MIN -1800
+#define SETTING_ALIGN_MAG_YAW_MAX 3600
+#define SETTING_BARO_HARDWARE 53
+#define SETTING_BARO_HARDWARE_MIN 0
+#define SETTING_BARO_HARDWARE_MAX 0
+#define SETTING_BARO_MEDIAN_FILTER 54
+#define SETTING_BARO_MEDIAN_FILTER_MIN 0
+#define SETTING_BARO_MEDIAN_FILTER_MAX 0
+#define SETTING_BARO_CAL_TOLERANCE 55
+#define SETTING_BARO_CAL_TOLERANCE_MIN 0
+#define SETTING_BARO_CAL_TOLERANCE_MAX 1000
+#define SETTING_PITOT_HARDWARE 56
+#define SETTING_PITOT_HARDWARE_MIN 0
+#define SETTING_PITOT_HARDWARE_MAX 0
+#define SETTING_PITOT_LPF_MILLI_HZ 57
+#define SETTING_PITOT_LPF_MILLI_HZ_MIN 0
+#define SETTING_PITOT_LPF_MILLI_HZ_MAX 10000
+#define SETTING_PITOT_SCALE 58
+#define SETTING_PITOT_SCALE_MIN 0
+#define SETTING_PITOT_SCALE_MAX 100
+#define SETTING_RECEIVER_TYPE 59
+#define SETTING_RECEIVER_TYPE_MIN 0
+#define SETTING_RECEIVER_TYPE_MAX 0
+#define SETTING_MIN_CHECK 60
+#define SETTING_MIN_CHECK_MIN 1000
+#define SETTING_MIN_CHECK_MAX 2000
+#define SETTING_MAX_CHECK 61
+#define SETTING_MAX_CHECK_MIN 1000
+#define SETTING_MAX_CHECK_MAX 2000
+#define SETTING_RSSI_SOURCE 62
+#define SETTING_RSSI_SOURCE_MIN 0
+#define SETTING_RSSI_SOURCE_MAX 0
+#define SETTING_RSSI_CHANNEL 63
+#define SETTING_RSSI_CHANNEL_MIN 0
+#define SETTING_RSSI_CHANNEL_MAX 18
+#define SETTING_RSSI_MIN 64
+#define SETTING_RSSI_MIN_MIN 0
+#define SETTING_RSSI_MIN_MAX 100
+#define SETTING_RSSI_MAX 65
+#define SETTING_RSSI_MAX_MIN 0
+#define SETTING_RSSI_MAX_MAX 100
+#define SETTING_SBUS_SYNC_INTERVAL 66
+#define SETTING_SBUS_SYNC_INTERVAL_MIN 500
+#define SETTING_SBUS_SYNC_INTERVAL_MAX 10000
+#define SETTING_RC_FILTER_FREQUENCY 67
+#define SETTING_RC_FILTER_FREQUENCY_MIN 0
+#define SETTING_RC_FILTER_FREQUENCY_MAX 100
+#define SETTING_SERIALRX_PROVIDER 68
+#define SETTING_SERIALRX_PROVIDER_MIN 0
+#define SETTING_SERIALRX_PROVIDER_MAX 0
+#define SETTING_SERIALRX_INVERTED 69
+#define SETTING_SERIALRX_INVERTED_MIN 0
+#define SETTING_SERIALRX_INVERTED_MAX 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT 70
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8
+#define SETTING_SPEKTRUM_SAT_BIND 71
+#define SETTING_SPEKTRUM_SAT_BIND_MIN 0
+#define SETTING_SPEKTRUM_SAT_BIND_MAX 10
+#define SETTING_RX_MIN_USEC 72
+#define SETTING_RX_MIN_USEC_MIN 750
+#define SETTING_RX_MIN_USEC_MAX 2250
+#define SETTING_RX_MAX_USEC 73
+#define SETTING_RX_MAX_USEC_MIN 750
+#define SETTING_RX_MAX_USEC_MAX 2250
+#define SETTING_SERIALRX_HALFDUPLEX 74
+#define SETTING_SERIALRX_HALFDUPLEX_MIN 0
+#define SETTING_SERIALRX_HALFDUPLEX_MAX 0
+#define SETTING_BLACKBOX_RATE_NUM 75
+#define SETTING_BLACKBOX_RATE_NUM_MIN 1
+#define SETTING_BLACKBOX_RATE_NUM_MAX 65535
+#define SETTING_BLACKBOX_RATE_DENOM 76
+#define SETTING_BLACKBOX_RATE_DENOM_MIN 1
+#define SETTING_BLACKBOX_RATE_DENOM_MAX 65535
+#define SETTING_BLACKBOX_DEVICE 77
+#define SETTING_BLACKBOX_DEVICE_MIN 0
+#define SETTING_BLACKBOX_DEVICE_MAX 0
+#define SETTING_BLACKBOX_COMPRESSION 78
+#define SETTING_BLACKBOX_COMPRESSION_MIN 0
+#define SETTING_BLACKBOX_COMPRESSION_MAX 0
+#define SETTING_SDCARD_DETECT_INVERTED 79
+#define SETTING_SDCARD_DETECT_INVERTED_MIN 0
+#define SETTING_SDCARD_DETECT_INVERTED_MAX 0
+#define SETTING_MAX_THROTTLE 80
+#define SETTING_MAX_THROTTLE_MIN 1000
+#define SETTING_MAX_THROTTLE_MAX 2000
+#define SETTING_MIN_COMMAND 81
+#define SETTING_MIN_COMMAND_MIN 0
+#define SETTING_MIN_COMMAND_MAX 2000
+#define SETTING_MOTOR_PWM_RATE 82
+#define SETTING_MOTOR_PWM_RATE_MIN 50
+#define SETTING_MOTOR_PWM_RATE_MAX 32000
+#define SETTING_MOTOR_ACCEL_TIME 83
+#define SETTING_MOTOR_ACCEL_TIME_MIN 0
+#define SETTING_MOTOR_ACCEL_TIME_MAX 1000
+#define SETTING_MOTOR_DECEL_TIME 84
+#define SETTING_MOTOR_DECEL_TIME_MIN 0
+#define SETTING_MOTOR_DECEL_TIME_MAX 1000
+#define SETTING_MOTOR_PWM_PROTOCOL 85
+#define SETTING_MOTOR_PWM_PROTOCOL_MIN 0
+#define SETTING_MOTOR_PWM_PROTOCOL_MAX 0
+#define SETTING_THROTTLE_SCALE 86
+#define SETTING_THROTTLE_SCALE_MIN 0
+#define SETTING_THROTTLE_SCALE_MAX 1
+#define SETTING_THROTTLE_IDLE 87
+#define SETTING_THROTTLE_IDLE_MIN 4
+#define SETTING_THROTTLE_IDLE_MAX 30
+#define SETTING_MOTOR_POLES 88
+#define SETTING_MOTOR_POLES_MIN 4
+#define SETTING_MOTOR_POLES_MAX 255
+#define SETTING_FAILSAFE_DELAY 89
+#define SETTING_FAILSAFE_DELAY_MIN 0
+#define SETTING_FAILSAFE_DELAY_MAX 200
+#define SETTING_FAILSAFE_RECOVERY_DELAY 90
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200
+#define SETTING_FAILSAFE_OFF_DELAY 91
+#define SETTING_FAILSAFE_OFF_DELAY_MIN 0
+#define SETTING_FAILSAFE_OFF_DELAY_MAX 200
+#define SETTING_FAILSAFE_THROTTLE 92
+#define SETTING_FAILSAFE_THROTTLE_MIN 1000
+#define SETTING_FAILSAFE_THROTTLE_MAX 2000
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY 93
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300
+#define SETTING_FAILSAFE_PROCEDURE 94
+#define SETTING_FAILSAFE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD 95
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE 96
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE 97
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_YAW_RATE 98
+#define SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000
+#define SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000
+#define SETTING_FAILSAFE_MIN_DISTANCE 99
+#define SETTING_FAILSAFE_MIN_DISTANCE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 100
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_MISSION 101
+#define SETTING_FAILSAFE_MISSION_MIN 0
+#define SETTING_FAILSAFE_MISSION_MAX 0
+#define SETTING_ALIGN_BOARD_ROLL 102
+#define SETTING_ALIGN_BOARD_ROLL_MIN -1800
+#define SETTING_ALIGN_BOARD_ROLL_MAX 3600
+#define SETTING_ALIGN_BOARD_PITCH 103
+#define SETTING_ALIGN_BOARD_PITCH_MIN -1800
+#define SETTING_ALIGN_BOARD_PITCH_MAX 3600
+#define SETTING_ALIGN_BOARD_YAW 104
+#define SETTING_ALIGN_BOARD_YAW_MIN -1800
+#define SETTING_ALIGN_BOARD_YAW_MAX 3600
+#define SETTING_VBAT_METER_TYPE 105
+#define SETTING_VBAT_METER_TYPE_MIN 0
+#define SETTING_VBAT_METER_TYPE_MAX 0
+#define SETTING_VBAT_SCALE 106
+#define SETTING_VBAT_SCALE_MIN 0
+#define SETTING_VBAT_SCALE_MAX 65535
+#define SETTING_CURRENT_METER_SCALE 107
+#define SETTING_CURRENT_METER_SCALE_MIN -10000
+#define SETTING_CURRENT_METER_SCALE_MAX 10000
+#define SETTING_CURRENT_METER_OFFSET 108
+#define SETTING_CURRENT_METER_OFFSET_MIN -32768
+#define SETTING_CURRENT_METER_OFFSET_MAX 32767
+#define SETTING_CURRENT_METER_TYPE 109
+#define SETTING_CURRENT_METER_TYPE_MIN 0
+#define SETTING_CURRENT_METER_TYPE_MAX 0
+#define SETTING_BAT_VOLTAGE_SRC 110
+#define SETTING_BAT_VOLTAGE_SRC_MIN 0
+#define SETTING_BAT_VOLTAGE_SRC_MAX 0
+#define SETTING_CRUISE_POWER 111
+#define SETTING_CRUISE_POWER_MIN 0
+#define SETTING_CRUISE_POWER_MAX 4294967295
+#define SETTING_IDLE_POWER 112
+#define SETTING_IDLE_POWER_MIN 0
+#define SETTING_IDLE_POWER_MAX 65535
+#define SETTING_RTH_ENERGY_MARGIN 113
+#define SETTING_RTH_ENERGY_MARGIN_MIN 0
+#define SETTING_RTH_ENERGY_MARGIN_MAX 100
+#define SETTING_THR_COMP_WEIGHT 114
+#define SETTING_THR_COMP_WEIGHT_MIN 0
+#define SETTING_THR_COMP_WEIGHT_MAX 2
+#define SETTING_BAT_CELLS 115
+#define SETTING_BAT_CELLS_MIN 0
+#define SETTING_BAT_CELLS_MAX 8
+#define SETTING_VBAT_CELL_DETECT_VOLTAGE 116
+#define SETTING_VBAT_CELL_DETECT_VOLTAGE_MIN 100
+#define SETTING_VBAT_CELL_DETECT_VOLTAGE_MAX 500
+#define SETTING_VBAT_MAX_CELL_VOLTAGE 117
+#define SETTING_VBAT_MAX_CELL_VOLTAGE_MIN 100
+#define SETTING_VBAT_MAX_CELL_VOLTAGE_MAX 500
+#define SETTING_VBAT_MIN_CELL_VOLTAGE 118
+#define SETTING_VBAT_MIN_CELL_VOLTAGE_MIN 100
+#define SETTING_VBAT_MIN_CELL_VOLTAGE_MAX 500
+#define SETTING_VBAT_WARNING_CELL_VOLTAGE 119
+#define SETTING_VBAT_WARNING_CELL_VOLTAGE_MIN 100
+#define SETTING_VBAT_WARNING_CELL_VOLTAGE_MAX 500
+#define SETTING_BATTERY_CAPACITY 120
+#define SETTING_BATTERY_CAPACITY_MIN 0
+#define SETTING_BATTERY_CAPACITY_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_WARNING 121
+#define SETTING_BATTERY_CAPACITY_WARNING_MIN 0
+#define SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_CRITICAL 122
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_UNIT 123
+#define SETTING_BATTERY_CAPACITY_UNIT_MIN 0
+#define SETTING_BATTERY_CAPACITY_UNIT_MAX 0
+#define SETTING_MOTOR_DIRECTION_INVERTED 124
+#define SETTING_MOTOR_DIRECTION_INVERTED_MIN 0
+#define SETTING_MOTOR_DIRECTION_INVERTED_MAX 0
+#define SETTING_PLATFORM_TYPE 125
+#define SETTING_PLATFORM_TYPE_MIN 0
+#define SETTING_PLATFORM_TYPE_MAX 0
+#define SETTING_HAS_FLAPS 126
+#define SETTING_HAS_FLAPS_MIN 0
+#define SETTING_HAS_FLAPS_MAX 0
+#define SETTING_MODEL_PREVIEW_TYPE 127
+#define SETTING_MODEL_PREVIEW_TYPE_MIN -1
+#define SETTING_MODEL_PREVIEW_TYPE_MAX 32767
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH 128
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450
+#define SETTING_3D_DEADBAND_LOW 129
+#define SETTING_3D_DEADBAND_LOW_MIN 1000
+#define SETTING_3D_DEADBAND_LOW_MAX 2000
+#define SETTING_3D_DEADBAND_HIGH 130
+#define SETTING_3D_DEADBAND_HIGH_MIN 1000
+#define SETTING_3D_DEADBAND_HIGH_MAX 2000
+#define SETTING_3D_NEUTRAL 131
+#define SETTING_3D_NEUTRAL_MIN 1000
+#define SETTING_3D_NEUTRAL_MAX 2000
+#define SETTING_SERVO_PROTOCOL 132
+#define SETTING_SERVO_PROTOCOL_MIN 0
+#define SETTING_SERVO_PROTOCOL_MAX 0
+#define SETTING_SERVO_CENTER_PULSE 133
+#define SETTING_SERVO_CENTER_PULSE_MIN 1000
+#define SETTING_SERVO_CENTER_PULSE_MAX 2000
+#define SETTING_SERVO_PWM_RATE 134
+#define SETTING_SERVO_PWM_RATE_MIN 50
+#define SETTING_SERVO_PWM_RATE_MAX 498
+#define SETTING_SERVO_LPF_HZ 135
+#define SETTING_SERVO_LPF_HZ_MIN 0
+#define SETTING_SERVO_LPF_HZ_MAX 400
+#define SETTING_FLAPERON_THROW_OFFSET 136
+#define SETTING_FLAPERON_THROW_OFFSET_MIN 50
+#define SETTING_FLAPERON_THROW_OFFSET_MAX 450
+#define SETTING_TRI_UNARMED_SERVO 137
+#define SETTING_TRI_UNARMED_SERVO_MIN 0
+#define SETTING_TRI_UNARMED_SERVO_MAX 0
+#define SETTING_THR_MID 138
+#define SETTING_THR_MID_MIN 0
+#define SETTING_THR_MID_MAX 100
+#define SETTING_THR_EXPO 139
+#define SETTING_THR_EXPO_MIN 0
+#define SETTING_THR_EXPO_MAX 100
+#define SETTING_TPA_RATE 140
+#define SETTING_TPA_RATE_MIN 0
+#define SETTING_TPA_RATE_MAX 100
+#define SETTING_TPA_BREAKPOINT 141
+#define SETTING_TPA_BREAKPOINT_MIN 1000
+#define SETTING_TPA_BREAKPOINT_MAX 2000
+#define SETTING_FW_TPA_TIME_CONSTANT 142
+#define SETTING_FW_TPA_TIME_CONSTANT_MIN 0
+#define SETTING_FW_TPA_TIME_CONSTANT_MAX 5000
+#define SETTING_RC_EXPO 143
+#define SETTING_RC_EXPO_MIN 0
+#define SETTING_RC_EXPO_MAX 100
+#define SETTING_RC_YAW_EXPO 144
+#define SETTING_RC_YAW_EXPO_MIN 0
+#define SETTING_RC_YAW_EXPO_MAX 100
+#define SETTING_ROLL_RATE 145
+#define SETTING_ROLL_RATE_MIN 6
+#define SETTING_ROLL_RATE_MAX 180
+#define SETTING_PITCH_RATE 146
+#define SETTING_PITCH_RATE_MIN 6
+#define SETTING_PITCH_RATE_MAX 180
+#define SETTING_YAW_RATE 147
+#define SETTING_YAW_RATE_MIN 2
+#define SETTING_YAW_RATE_MAX 180
+#define SETTING_MANUAL_RC_EXPO 148
+#define SETTING_MANUAL_RC_EXPO_MIN 0
+#define SETTING_MANUAL_RC_EXPO_MAX 100
+#define SETTING_MANUAL_RC_YAW_EXPO 149
+#define SETTING_MANUAL_RC_YAW_EXPO_MIN 0
+#define SETTING_MANUAL_RC_YAW_EXPO_MAX 100
+#define SETTING_MANUAL_ROLL_RATE 150
+#define SETTING_MANUAL_ROLL_RATE_MIN 0
+#define SETTING_MANUAL_ROLL_RATE_MAX 100
+#define SETTING_MANUAL_PITCH_RATE 151
+#define SETTING_MANUAL_PITCH_RATE_MIN 0
+#define SETTING_MANUAL_PITCH_RATE_MAX 100
+#define SETTING_MANUAL_YAW_RATE 152
+#define SETTING_MANUAL_YAW_RATE_MIN 0
+#define SETTING_MANUAL_YAW_RATE_MAX 100
+#define SETTING_FPV_MIX_DEGREES 153
+#define SETTING_FPV_MIX_DEGREES_MIN 0
+#define SETTING_FPV_MIX_DEGREES_MAX 50
+#define SETTING_REBOOT_CHARACTER 154
+#define SETTING_REBOOT_CHARACTER_MIN 48
+#define SETTING_REBOOT_CHARACTER_MAX 126
+#define SETTING_IMU_DCM_KP 155
+#define SETTING_IMU_DCM_KP_MIN 0
+#define SETTING_IMU_DCM_KP_MAX 65535
+#define SETTING_IMU_DCM_KI 156
+#define SETTING_IMU_DCM_KI_MIN 0
+#define SETTING_IMU_DCM_KI_MAX 65535
+#define SETTING_IMU_DCM_KP_MAG 157
+#define SETTING_IMU_DCM_KP_MAG_MIN 0
+#define SETTING_IMU_DCM_KP_MAG_MAX 65535
+#define SETTING_IMU_DCM_KI_MAG 158
+#define SETTING_IMU_DCM_KI_MAG_MIN 0
+#define SETTING_IMU_DCM_KI_MAG_MAX 65535
+#define SETTING_SMALL_ANGLE 159
+#define SETTING_SMALL_ANGLE_MIN 0
+#define SETTING_SMALL_ANGLE_MAX 180
+#define SETTING_IMU_ACC_IGNORE_RATE 160
+#define SETTING_IMU_ACC_IGNORE_RATE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_RATE_MAX 20
+#define SETTING_IMU_ACC_IGNORE_SLOPE 161
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5
+#define SETTING_FIXED_WING_AUTO_ARM 162
+#define SETTING_FIXED_WING_AUTO_ARM_MIN 0
+#define SETTING_FIXED_WING_AUTO_ARM_MAX 0
+#define SETTING_DISARM_KILL_SWITCH 163
+#define SETTING_DISARM_KILL_SWITCH_MIN 0
+#define SETTING_DISARM_KILL_SWITCH_MAX 0
+#define SETTING_SWITCH_DISARM_DELAY 164
+#define SETTING_SWITCH_DISARM_DELAY_MIN 0
+#define SETTING_SWITCH_DISARM_DELAY_MAX 1000
+#define SETTING_APPLIED_DEFAULTS 165
+#define SETTING_APPLIED_DEFAULTS_MIN 0
+#define SETTING_APPLIED_DEFAULTS_MAX 3
+#define SETTING_RPM_GYRO_FILTER_ENABLED 166
+#define SETTING_RPM_GYRO_FILTER_ENABLED_MIN 0
+#define SETTING_RPM_GYRO_FILTER_ENABLED_MAX 0
+#define SETTING_RPM_GYRO_HARMONICS 167
+#define SETTING_RPM_GYRO_HARMONICS_MIN 1
+#define SETTING_RPM_GYRO_HARMONICS_MAX 3
+#define SETTING_RPM_GYRO_MIN_HZ 168
+#define SETTING_RPM_GYRO_MIN_HZ_MIN 30
+#define SETTING_RPM_GYRO_MIN_HZ_MAX 200
+#define SETTING_RPM_GYRO_Q 169
+#define SETTING_RPM_GYRO_Q_MIN 1
+#define SETTING_RPM_GYRO_Q_MAX 3000
+#define SETTING_GPS_PROVIDER 170
+#define SETTING_GPS_PROVIDER_MIN 0
+#define SETTING_GPS_PROVIDER_MAX 0
+#define SETTING_GPS_SBAS_MODE 171
+#define SETTING_GPS_SBAS_MODE_MIN 0
+#define SETTING_GPS_SBAS_MODE_MAX 0
+#define SETTING_GPS_DYN_MODEL 172
+#define SETTING_GPS_DYN_MODEL_MIN 0
+#define SETTING_GPS_DYN_MODEL_MAX 0
+#define SETTING_GPS_AUTO_CONFIG 173
+#define SETTING_GPS_AUTO_CONFIG_MIN 0
+#define SETTING_GPS_AUTO_CONFIG_MAX 0
+#define SETTING_GPS_AUTO_BAUD 174
+#define SETTING_GPS_AUTO_BAUD_MIN 0
+#define SETTING_GPS_AUTO_BAUD_MAX 0
+#define SETTING_GPS_UBLOX_USE_GALILEO 175
+#define SETTING_GPS_UBLOX_USE_GALILEO_MIN 0
+#define SETTING_GPS_UBLOX_USE_GALILEO_MAX 0
+#define SETTING_GPS_MIN_SATS 176
+#define SETTING_GPS_MIN_SATS_MIN 5
+#define SETTING_GPS_MIN_SATS_MAX 10
+#define SETTING_DEADBAND 177
+#define SETTING_DEADBAND_MIN 0
+#define SETTING_DEADBAND_MAX 32
+#define SETTING_YAW_DEADBAND 178
+#define SETTING_YAW_DEADBAND_MIN 0
+#define SETTING_YAW_DEADBAND_MAX 100
+#define SETTING_POS_HOLD_DEADBAND 179
+#define SETTING_POS_HOLD_DEADBAND_MIN 2
+#define SETTING_POS_HOLD_DEADBAND_MAX 250
+#define SETTING_ALT_HOLD_DEADBAND 180
+#define SETTING_ALT_HOLD_DEADBAND_MIN 10
+#define SETTING_ALT_HOLD_DEADBAND_MAX 250
+#define SETTING_3D_DEADBAND_THROTTLE 181
+#define SETTING_3D_DEADBAND_THROTTLE_MIN 0
+#define SETTING_3D_DEADBAND_THROTTLE_MAX 200
+#define SETTING_MC_AIRMODE_TYPE 182
+#define SETTING_MC_AIRMODE_TYPE_MIN 0
+#define SETTING_MC_AIRMODE_TYPE_MAX 0
+#define SETTING_MC_AIRMODE_THRESHOLD 183
+#define SETTING_MC_AIRMODE_THRESHOLD_MIN 1000
+#define SETTING_MC_AIRMODE_THRESHOLD_MAX 2000
+#define SETTING_MC_P_PITCH 184
+#define SETTING_MC_P_PITCH_MIN 0
+#define SETTING_MC_P_PITCH_MAX 200
+#define SETTING_MC_I_PITCH 185
+#define SETTING_MC_I_PITCH_MIN 0
+#define SETTING_MC_I_PITCH_MAX 200
+#define SETTING_MC_D_PITCH 186
+#define SETTING_MC_D_PITCH_MIN 0
+#define SETTING_MC_D_PITCH_MAX 200
+#define SETTING_MC_CD_PITCH 187
+#define SETTING_MC_CD_PITCH_MIN 0
+#define SETTING_MC_CD_PITCH_MAX 200
+#define SETTING_MC_P_ROLL 188
+#define SETTING_MC_P_ROLL_MIN 0
+#define SETTING_MC_P_ROLL_MAX 200
+#define SETTING_MC_I_ROLL 189
+#define SETTING_MC_I_ROLL_MIN 0
+#define SETTING_MC_I_ROLL_MAX 200
+#define SETTING_MC_D_ROLL 190
+#define SETTING_MC_D_ROLL_MIN 0
+#define SETTING_MC_D_ROLL_MAX 200
+#define SETTING_MC_CD_ROLL 191
+#define SETTING_MC_CD_ROLL_MIN 0
+#define SETTING_MC_CD_ROLL_MAX 200
+#define SETTING_MC_P_YAW 192
+#define SETTING_MC_P_YAW_MIN 0
+#define SETTING_MC_P_YAW_MAX 200
+#define SETTING_MC_I_YAW 193
+#define SETTING_MC_I_YAW_MIN 0
+#define SETTING_MC_I_YAW_MAX 200
+#define SETTING_MC_D_YAW 194
+#define SETTING_MC_D_YAW_MIN 0
+#define SETTING_MC_D_YAW_MAX 200
+#define SETTING_MC_CD_YAW 195
+#define SETTING_MC_CD_YAW_MIN 0
+#define SETTING_MC_CD_YAW_MAX 200
+#define SETTING_MC_P_LEVEL 196
+#define SETTING_MC_P_LEVEL_MIN 0
+#define SETTING_MC_P_LEVEL_MAX 200
+#define SETTING_MC_I_LEVEL 197
+#define SETTING_MC_I_LEVEL_MIN 0
+#define SETTING_MC_I_LEVEL_MAX 200
+#define SETTING_MC_D_LEVEL 198
+#define SETTING_MC_D_LEVEL_MIN 0
+#define SETTING_MC_D_LEVEL_MAX 200
+#define SETTING_FW_P_PITCH 199
+#define SETTING_FW_P_PITCH_MIN 0
+#define SETTING_FW_P_PITCH_MAX 200
+#define SETTING_FW_I_PITCH 200
+#define SETTING_FW_I_PITCH_MIN 0
+#define SETTING_FW_I_PITCH_MAX 200
+#define SETTING_FW_FF_PITCH 201
+#define SETTING_FW_FF_PITCH_MIN 0
+#define SETTING_FW_FF_PITCH_MAX 200
+#define SETTING_FW_P_ROLL 202
+#define SETTING_FW_P_ROLL_MIN 0
+#define SETTING_FW_P_ROLL_MAX 200
+#define SETTING_FW_I_ROLL 203
+#define SETTING_FW_I_ROLL_MIN 0
+#define SETTING_FW_I_ROLL_MAX 200
+#define SETTING_FW_FF_ROLL 204
+#define SETTING_FW_FF_ROLL_MIN 0
+#define SETTING_FW_FF_ROLL_MAX 200
+#define SETTING_FW_P_YAW 205
+#define SETTING_FW_P_YAW_MIN 0
+#define SETTING_FW_P_YAW_MAX 200
+#define SETTING_FW_I_YAW 206
+#define SETTING_FW_I_YAW_MIN 0
+#define SETTING_FW_I_YAW_MAX 200
+#define SETTING_FW_FF_YAW 207
+#define SETTING_FW_FF_YAW_MIN 0
+#define SETTING_FW_FF_YAW_MAX 200
+#define SETTING_FW_P_LEVEL 208
+#define SETTING_FW_P_LEVEL_MIN 0
+#define SETTING_FW_P_LEVEL_MAX 200
+#define SETTING_FW_I_LEVEL 209
+#define SETTING_FW_I_LEVEL_MIN 0
+#define SETTING_FW_I_LEVEL_MAX 200
+#define SETTING_FW_D_LEVEL 210
+#define SETTING_FW_D_LEVEL_MIN 0
+#define SETTING_FW_D_LEVEL_MAX 200
+#define SETTING_MAX_ANGLE_INCLINATION_RLL 211
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900
+#define SETTING_MAX_ANGLE_INCLINATION_PIT 212
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900
+#define SETTING_DTERM_LPF_HZ 213
+#define SETTING_DTERM_LPF_HZ_MIN 0
+#define SETTING_DTERM_LPF_HZ_MAX 500
+#define SETTING_DTERM_LPF_TYPE 214
+#define SETTING_DTERM_LPF_TYPE_MIN 0
+#define SETTING_DTERM_LPF_TYPE_MAX 0
+#define SETTING_DTERM_LPF2_HZ 215
+#define SETTING_DTERM_LPF2_HZ_MIN 0
+#define SETTING_DTERM_LPF2_HZ_MAX 500
+#define SETTING_DTERM_LPF2_TYPE 216
+#define SETTING_DTERM_LPF2_TYPE_MIN 0
+#define SETTING_DTERM_LPF2_TYPE_MAX 0
+#define SETTING_YAW_LPF_HZ 217
+#define SETTING_YAW_LPF_HZ_MIN 0
+#define SETTING_YAW_LPF_HZ_MAX 200
+#define SETTING_FW_ITERM_THROW_LIMIT 218
+#define SETTING_FW_ITERM_THROW_LIMIT_MIN 0
+#define SETTING_FW_ITERM_THROW_LIMIT_MAX 500
+#define SETTING_FW_LOITER_DIRECTION 219
+#define SETTING_FW_LOITER_DIRECTION_MIN 0
+#define SETTING_FW_LOITER_DIRECTION_MAX 0
+#define SETTING_FW_REFERENCE_AIRSPEED 220
+#define SETTING_FW_REFERENCE_AIRSPEED_MIN 1
+#define SETTING_FW_REFERENCE_AIRSPEED_MAX 5000
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN 221
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION 222
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1
+#define SETTING_PIDSUM_LIMIT 223
+#define SETTING_PIDSUM_LIMIT_MIN 100
+#define SETTING_PIDSUM_LIMIT_MAX 1000
+#define SETTING_PIDSUM_LIMIT_YAW 224
+#define SETTING_PIDSUM_LIMIT_YAW_MIN 100
+#define SETTING_PIDSUM_LIMIT_YAW_MAX 1000
+#define SETTING_ITERM_WINDUP 225
+#define SETTING_ITERM_WINDUP_MIN 0
+#define SETTING_ITERM_WINDUP_MAX 90
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 226
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000
+#define SETTING_RATE_ACCEL_LIMIT_YAW 227
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000
+#define SETTING_HEADING_HOLD_RATE_LIMIT 228
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250
+#define SETTING_NAV_MC_POS_Z_P 229
+#define SETTING_NAV_MC_POS_Z_P_MIN 0
+#define SETTING_NAV_MC_POS_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_P 230
+#define SETTING_NAV_MC_VEL_Z_P_MIN 0
+#define SETTING_NAV_MC_VEL_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_I 231
+#define SETTING_NAV_MC_VEL_Z_I_MIN 0
+#define SETTING_NAV_MC_VEL_Z_I_MAX 255
+#define SETTING_NAV_MC_VEL_Z_D 232
+#define SETTING_NAV_MC_VEL_Z_D_MIN 0
+#define SETTING_NAV_MC_VEL_Z_D_MAX 255
+#define SETTING_NAV_MC_POS_XY_P 233
+#define SETTING_NAV_MC_POS_XY_P_MIN 0
+#define SETTING_NAV_MC_POS_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_P 234
+#define SETTING_NAV_MC_VEL_XY_P_MIN 0
+#define SETTING_NAV_MC_VEL_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_I 235
+#define SETTING_NAV_MC_VEL_XY_I_MIN 0
+#define SETTING_NAV_MC_VEL_XY_I_MAX 255
+#define SETTING_NAV_MC_VEL_XY_D 236
+#define SETTING_NAV_MC_VEL_XY_D_MIN 0
+#define SETTING_NAV_MC_VEL_XY_D_MAX 255
+#define SETTING_NAV_MC_VEL_XY_FF 237
+#define SETTING_NAV_MC_VEL_XY_FF_MIN 0
+#define SETTING_NAV_MC_VEL_XY_FF_MAX 255
+#define SETTING_NAV_MC_HEADING_P 238
+#define SETTING_NAV_MC_HEADING_P_MIN 0
+#define SETTING_NAV_MC_HEADING_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 239
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100
+#define SETTING_NAV_FW_POS_Z_P 240
+#define SETTING_NAV_FW_POS_Z_P_MIN 0
+#define SETTING_NAV_FW_POS_Z_P_MAX 255
+#define SETTING_NAV_FW_POS_Z_I 241
+#define SETTING_NAV_FW_POS_Z_I_MIN 0
+#define SETTING_NAV_FW_POS_Z_I_MAX 255
+#define SETTING_NAV_FW_POS_Z_D 242
+#define SETTING_NAV_FW_POS_Z_D_MIN 0
+#define SETTING_NAV_FW_POS_Z_D_MAX 255
+#define SETTING_NAV_FW_POS_XY_P 243
+#define SETTING_NAV_FW_POS_XY_P_MIN 0
+#define SETTING_NAV_FW_POS_XY_P_MAX 255
+#define SETTING_NAV_FW_POS_XY_I 244
+#define SETTING_NAV_FW_POS_XY_I_MIN 0
+#define SETTING_NAV_FW_POS_XY_I_MAX 255
+#define SETTING_NAV_FW_POS_XY_D 245
+#define SETTING_NAV_FW_POS_XY_D_MIN 0
+#define SETTING_NAV_FW_POS_XY_D_MAX 255
+#define SETTING_NAV_FW_HEADING_P 246
+#define SETTING_NAV_FW_HEADING_P_MIN 0
+#define SETTING_NAV_FW_HEADING_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_P 247
+#define SETTING_NAV_FW_POS_HDG_P_MIN 0
+#define SETTING_NAV_FW_POS_HDG_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_I 248
+#define SETTING_NAV_FW_POS_HDG_I_MIN 0
+#define SETTING_NAV_FW_POS_HDG_I_MAX 255
+#define SETTING_NAV_FW_POS_HDG_D 249
+#define SETTING_NAV_FW_POS_HDG_D_MIN 0
+#define SETTING_NAV_FW_POS_HDG_D_MAX 255
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 250
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000
+#define SETTING_MC_ITERM_RELAX_TYPE 251
+#define SETTING_MC_ITERM_RELAX_TYPE_MIN 0
+#define SETTING_MC_ITERM_RELAX_TYPE_MAX 0
+#define SETTING_MC_ITERM_RELAX 252
+#define SETTING_MC_ITERM_RELAX_MIN 0
+#define SETTING_MC_ITERM_RELAX_MAX 0
+#define SETTING_MC_ITERM_RELAX_CUTOFF 253
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100
+#define SETTING_D_BOOST_FACTOR 254
+#define SETTING_D_BOOST_FACTOR_MIN 1
+#define SETTING_D_BOOST_FACTOR_MAX 3
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION 255
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 256
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250
+#define SETTING_ANTIGRAVITY_GAIN 257
+#define SETTING_ANTIGRAVITY_GAIN_MIN 1
+#define SETTING_ANTIGRAVITY_GAIN_MAX 20
+#define SETTING_ANTIGRAVITY_ACCELERATOR 258
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 259
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30
+#define SETTING_PID_TYPE 260
+#define SETTING_PID_TYPE_MIN 0
+#define SETTING_PID_TYPE_MAX 0
+#define SETTING_MC_CD_LPF_HZ 261
+#define SETTING_MC_CD_LPF_HZ_MIN 0
+#define SETTING_MC_CD_LPF_HZ_MAX 200
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 262
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 263
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_THRESHOLD 264
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 265
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC 266
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000
+#define SETTING_INAV_AUTO_MAG_DECL 267
+#define SETTING_INAV_AUTO_MAG_DECL_MIN 0
+#define SETTING_INAV_AUTO_MAG_DECL_MAX 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE 268
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255
+#define SETTING_INAV_USE_GPS_VELNED 269
+#define SETTING_INAV_USE_GPS_VELNED_MIN 0
+#define SETTING_INAV_USE_GPS_VELNED_MAX 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING 270
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0
+#define SETTING_INAV_RESET_ALTITUDE 271
+#define SETTING_INAV_RESET_ALTITUDE_MIN 0
+#define SETTING_INAV_RESET_ALTITUDE_MAX 0
+#define SETTING_INAV_RESET_HOME 272
+#define SETTING_INAV_RESET_HOME_MIN 0
+#define SETTING_INAV_RESET_HOME_MAX 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE 273
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000
+#define SETTING_INAV_W_Z_SURFACE_P 274
+#define SETTING_INAV_W_Z_SURFACE_P_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_P_MAX 100
+#define SETTING_INAV_W_Z_SURFACE_V 275
+#define SETTING_INAV_W_Z_SURFACE_V_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_V_MAX 100
+#define SETTING_INAV_W_XY_FLOW_P 276
+#define SETTING_INAV_W_XY_FLOW_P_MIN 0
+#define SETTING_INAV_W_XY_FLOW_P_MAX 100
+#define SETTING_INAV_W_XY_FLOW_V 277
+#define SETTING_INAV_W_XY_FLOW_V_MIN 0
+#define SETTING_INAV_W_XY_FLOW_V_MAX 100
+#define SETTING_INAV_W_Z_BARO_P 278
+#define SETTING_INAV_W_Z_BARO_P_MIN 0
+#define SETTING_INAV_W_Z_BARO_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_P 279
+#define SETTING_INAV_W_Z_GPS_P_MIN 0
+#define SETTING_INAV_W_Z_GPS_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_V 280
+#define SETTING_INAV_W_Z_GPS_V_MIN 0
+#define SETTING_INAV_W_Z_GPS_V_MAX 10
+#define SETTING_INAV_W_XY_GPS_P 281
+#define SETTING_INAV_W_XY_GPS_P_MIN 0
+#define SETTING_INAV_W_XY_GPS_P_MAX 10
+#define SETTING_INAV_W_XY_GPS_V 282
+#define SETTING_INAV_W_XY_GPS_V_MIN 0
+#define SETTING_INAV_W_XY_GPS_V_MAX 10
+#define SETTING_INAV_W_Z_RES_V 283
+#define SETTING_INAV_W_Z_RES_V_MIN 0
+#define SETTING_INAV_W_Z_RES_V_MAX 10
+#define SETTING_INAV_W_XY_RES_V 284
+#define SETTING_INAV_W_XY_RES_V_MIN 0
+#define SETTING_INAV_W_XY_RES_V_MAX 10
+#define SETTING_INAV_W_XYZ_ACC_P 285
+#define SETTING_INAV_W_XYZ_ACC_P_MIN 0
+#define SETTING_INAV_W_XYZ_ACC_P_MAX 1
+#define SETTING_INAV_W_ACC_BIAS 286
+#define SETTING_INAV_W_ACC_BIAS_MIN 0
+#define SETTING_INAV_W_ACC_BIAS_MAX 1
+#define SETTING_INAV_MAX_EPH_EPV 287
+#define SETTING_INAV_MAX_EPH_EPV_MIN 0
+#define SETTING_INAV_MAX_EPH_EPV_MAX 9999
+#define SETTING_INAV_BARO_EPV 288
+#define SETTING_INAV_BARO_EPV_MIN 0
+#define SETTING_INAV_BARO_EPV_MAX 9999
+#define SETTING_NAV_DISARM_ON_LANDING 289
+#define SETTING_NAV_DISARM_ON_LANDING_MIN 0
+#define SETTING_NAV_DISARM_ON_LANDING_MAX 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 290
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY 291
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0
+#define SETTING_NAV_USER_CONTROL_MODE 292
+#define SETTING_NAV_USER_CONTROL_MODE_MIN 0
+#define SETTING_NAV_USER_CONTROL_MODE_MAX 0
+#define SETTING_NAV_POSITION_TIMEOUT 293
+#define SETTING_NAV_POSITION_TIMEOUT_MIN 0
+#define SETTING_NAV_POSITION_TIMEOUT_MAX 10
+#define SETTING_NAV_WP_RADIUS 294
+#define SETTING_NAV_WP_RADIUS_MIN 10
+#define SETTING_NAV_WP_RADIUS_MAX 10000
+#define SETTING_NAV_WP_SAFE_DISTANCE 295
+#define SETTING_NAV_WP_SAFE_DISTANCE_MIN 0
+#define SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000
+#define SETTING_NAV_AUTO_SPEED 296
+#define SETTING_NAV_AUTO_SPEED_MIN 10
+#define SETTING_NAV_AUTO_SPEED_MAX 2000
+#define SETTING_NAV_AUTO_CLIMB_RATE 297
+#define SETTING_NAV_AUTO_CLIMB_RATE_MIN 10
+#define SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_MANUAL_SPEED 298
+#define SETTING_NAV_MANUAL_SPEED_MIN 10
+#define SETTING_NAV_MANUAL_SPEED_MAX 2000
+#define SETTING_NAV_MANUAL_CLIMB_RATE 299
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_LANDING_SPEED 300
+#define SETTING_NAV_LANDING_SPEED_MIN 100
+#define SETTING_NAV_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT 301
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT 302
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000
+#define SETTING_NAV_EMERG_LANDING_SPEED 303
+#define SETTING_NAV_EMERG_LANDING_SPEED_MIN 100
+#define SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_MIN_RTH_DISTANCE 304
+#define SETTING_NAV_MIN_RTH_DISTANCE_MIN 0
+#define SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP 305
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0
+#define SETTING_NAV_RTH_CLIMB_FIRST 306
+#define SETTING_NAV_RTH_CLIMB_FIRST_MIN 0
+#define SETTING_NAV_RTH_CLIMB_FIRST_MAX 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 307
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0
+#define SETTING_NAV_RTH_TAIL_FIRST 308
+#define SETTING_NAV_RTH_TAIL_FIRST_MIN 0
+#define SETTING_NAV_RTH_TAIL_FIRST_MAX 0
+#define SETTING_NAV_RTH_ALLOW_LANDING 309
+#define SETTING_NAV_RTH_ALLOW_LANDING_MIN 0
+#define SETTING_NAV_RTH_ALLOW_LANDING_MAX 0
+#define SETTING_NAV_RTH_ALT_MODE 310
+#define SETTING_NAV_RTH_ALT_MODE_MIN 0
+#define SETTING_NAV_RTH_ALT_MODE_MAX 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD 311
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 312
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000
+#define SETTING_NAV_RTH_ALTITUDE 313
+#define SETTING_NAV_RTH_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_ALTITUDE 314
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 315
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 316
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359
+#define SETTING_NAV_MC_BANK_ANGLE 317
+#define SETTING_NAV_MC_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BANK_ANGLE_MAX 45
+#define SETTING_NAV_MC_HOVER_THR 318
+#define SETTING_NAV_MC_HOVER_THR_MIN 1000
+#define SETTING_NAV_MC_HOVER_THR_MAX 2000
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY 319
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 320
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 321
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_TIMEOUT 322
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR 323
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 324
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 325
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 326
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE 327
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60
+#define SETTING_NAV_MC_POS_DECELERATION_TIME 328
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255
+#define SETTING_NAV_MC_POS_EXPO 329
+#define SETTING_NAV_MC_POS_EXPO_MIN 0
+#define SETTING_NAV_MC_POS_EXPO_MAX 255
+#define SETTING_NAV_FW_CRUISE_THR 330
+#define SETTING_NAV_FW_CRUISE_THR_MIN 1000
+#define SETTING_NAV_FW_CRUISE_THR_MAX 2000
+#define SETTING_NAV_FW_MIN_THR 331
+#define SETTING_NAV_FW_MIN_THR_MIN 1000
+#define SETTING_NAV_FW_MIN_THR_MAX 2000
+#define SETTING_NAV_FW_MAX_THR 332
+#define SETTING_NAV_FW_MAX_THR_MIN 1000
+#define SETTING_NAV_FW_MAX_THR_MAX 2000
+#define SETTING_NAV_FW_BANK_ANGLE 333
+#define SETTING_NAV_FW_BANK_ANGLE_MIN 5
+#define SETTING_NAV_FW_BANK_ANGLE_MAX 80
+#define SETTING_NAV_FW_CLIMB_ANGLE 334
+#define SETTING_NAV_FW_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_CLIMB_ANGLE_MAX 80
+#define SETTING_NAV_FW_DIVE_ANGLE 335
+#define SETTING_NAV_FW_DIVE_ANGLE_MIN 5
+#define SETTING_NAV_FW_DIVE_ANGLE_MAX 80
+#define SETTING_NAV_FW_PITCH2THR 336
+#define SETTING_NAV_FW_PITCH2THR_MIN 0
+#define SETTING_NAV_FW_PITCH2THR_MAX 100
+#define SETTING_NAV_FW_LOITER_RADIUS 337
+#define SETTING_NAV_FW_LOITER_RADIUS_MIN 0
+#define SETTING_NAV_FW_LOITER_RADIUS_MAX 10000
+#define SETTING_NAV_FW_CRUISE_SPEED 338
+#define SETTING_NAV_FW_CRUISE_SPEED_MIN 0
+#define SETTING_NAV_FW_CRUISE_SPEED_MAX 65535
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS 339
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE 340
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20
+#define SETTING_NAV_FW_LAUNCH_VELOCITY 341
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000
+#define SETTING_NAV_FW_LAUNCH_ACCEL 342
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE 343
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME 344
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_THR 345
+#define SETTING_NAV_FW_LAUNCH_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR 346
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 347
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME 348
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME 349
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT 350
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 351
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 352
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45
+#define SETTING_NAV_FW_CRUISE_YAW_RATE 353
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 354
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL 355
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0
+#define SETTING_NAV_FW_YAW_DEADBAND 356
+#define SETTING_NAV_FW_YAW_DEADBAND_MIN 0
+#define SETTING_NAV_FW_YAW_DEADBAND_MAX 90
+#define SETTING_TELEMETRY_SWITCH 357
+#define SETTING_TELEMETRY_SWITCH_MIN 0
+#define SETTING_TELEMETRY_SWITCH_MAX 0
+#define SETTING_TELEMETRY_INVERTED 358
+#define SETTING_TELEMETRY_INVERTED_MIN 0
+#define SETTING_TELEMETRY_INVERTED_MAX 0
+#define SETTING_FRSKY_DEFAULT_LATITUDE 359
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90
+#define SETTING_FRSKY_DEFAULT_LONGITUDE 360
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180
+#define SETTING_FRSKY_COORDINATES_FORMAT 361
+#define SETTING_FRSKY_COORDINATES_FORMAT_MIN 0
+#define SETTING_FRSKY_COORDINATES_FORMAT_MAX 1
+#define SETTING_FRSKY_UNIT 362
+#define SETTING_FRSKY_UNIT_MIN 0
+#define SETTING_FRSKY_UNIT_MAX 0
+#define SETTING_FRSKY_VFAS_PRECISION 363
+#define SETTING_FRSKY_VFAS_PRECISION_MIN 0
+#define SETTING_FRSKY_VFAS_PRECISION_MAX 1
+#define SETTING_FRSKY_PITCH_ROLL 364
+#define SETTING_FRSKY_PITCH_ROLL_MIN 0
+#define SETTING_FRSKY_PITCH_ROLL_MAX 0
+#define SETTING_REPORT_CELL_VOLTAGE 365
+#define SETTING_REPORT_CELL_VOLTAGE_MIN 0
+#define SETTING_REPORT_CELL_VOLTAGE_MAX 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL 366
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120
+#define SETTING_TELEMETRY_HALFDUPLEX 367
+#define SETTING_TELEMETRY_HALFDUPLEX_MIN 0
+#define SETTING_TELEMETRY_HALFDUPLEX_MAX 0
+#define SETTING_SMARTPORT_FUEL_UNIT 368
+#define SETTING_SMARTPORT_FUEL_UNIT_MIN 0
+#define SETTING_SMARTPORT_FUEL_UNIT_MAX 0
+#define SETTING_IBUS_TELEMETRY_TYPE 369
+#define SETTING_IBUS_TELEMETRY_TYPE_MIN 0
+#define SETTING_IBUS_TELEMETRY_TYPE_MAX 255
+#define SETTING_LTM_UPDATE_RATE 370
+#define SETTING_LTM_UPDATE_RATE_MIN 0
+#define SETTING_LTM_UPDATE_RATE_MAX 0
+#define SETTING_SIM_GROUND_STATION_NUMBER 371
+#define SETTING_SIM_GROUND_STATION_NUMBER_MIN 0
+#define SETTING_SIM_GROUND_STATION_NUMBER_MAX 16
+#define SETTING_SIM_PIN 372
+#define SETTING_SIM_PIN_MIN 0
+#define SETTING_SIM_PIN_MAX 8
+#define SETTING_SIM_TRANSMIT_INTERVAL 373
+#define SETTING_SIM_TRANSMIT_INTERVAL_MIN 10
+#define SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535
+#define SETTING_SIM_TRANSMIT_FLAGS 374
+#define SETTING_SIM_TRANSMIT_FLAGS_MIN 0
+#define SETTING_SIM_TRANSMIT_FLAGS_MAX 5
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH 375
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535
+#define SETTING_ACC_EVENT_THRESHOLD_LOW 376
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X 377
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535
+#define SETTING_SIM_LOW_ALTITUDE 378
+#define SETTING_SIM_LOW_ALTITUDE_MIN -32768
+#define SETTING_SIM_LOW_ALTITUDE_MAX 32767
+#define SETTING_MAVLINK_EXT_STATUS_RATE 379
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255
+#define SETTING_MAVLINK_RC_CHAN_RATE 380
+#define SETTING_MAVLINK_RC_CHAN_RATE_MIN 0
+#define SETTING_MAVLINK_RC_CHAN_RATE_MAX 255
+#define SETTING_MAVLINK_POS_RATE 381
+#define SETTING_MAVLINK_POS_RATE_MIN 0
+#define SETTING_MAVLINK_POS_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA1_RATE 382
+#define SETTING_MAVLINK_EXTRA1_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA1_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA2_RATE 383
+#define SETTING_MAVLINK_EXTRA2_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA2_RATE_MAX 255
+#define SETTING_LEDSTRIP_VISUAL_BEEPER 384
+#define SETTING_LEDSTRIP_VISUAL_BEEPER_MIN 0
+#define SETTING_LEDSTRIP_VISUAL_BEEPER_MAX 0
+#define SETTING_OSD_VIDEO_SYSTEM 385
+#define SETTING_OSD_VIDEO_SYSTEM_MIN 0
+#define SETTING_OSD_VIDEO_SYSTEM_MAX 0
+#define SETTING_OSD_ROW_SHIFTDOWN 386
+#define SETTING_OSD_ROW_SHIFTDOWN_MIN 0
+#define SETTING_OSD_ROW_SHIFTDOWN_MAX 1
+#define SETTING_OSD_UNITS 387
+#define SETTING_OSD_UNITS_MIN 0
+#define SETTING_OSD_UNITS_MAX 0
+#define SETTING_OSD_STATS_ENERGY_UNIT 388
+#define SETTING_OSD_STATS_ENERGY_UNIT_MIN 0
+#define SETTING_OSD_STATS_ENERGY_UNIT_MAX 0
+#define SETTING_OSD_RSSI_ALARM 389
+#define SETTING_OSD_RSSI_ALARM_MIN 0
+#define SETTING_OSD_RSSI_ALARM_MAX 100
+#define SETTING_OSD_TIME_ALARM 390
+#define SETTING_OSD_TIME_ALARM_MIN 0
+#define SETTING_OSD_TIME_ALARM_MAX 600
+#define SETTING_OSD_ALT_ALARM 391
+#define SETTING_OSD_ALT_ALARM_MIN 0
+#define SETTING_OSD_ALT_ALARM_MAX 10000
+#define SETTING_OSD_DIST_ALARM 392
+#define SETTING_OSD_DIST_ALARM_MIN 0
+#define SETTING_OSD_DIST_ALARM_MAX 50000
+#define SETTING_OSD_NEG_ALT_ALARM 393
+#define SETTING_OSD_NEG_ALT_ALARM_MIN 0
+#define SETTING_OSD_NEG_ALT_ALARM_MAX 10000
+#define SETTING_OSD_CURRENT_ALARM 394
+#define SETTING_OSD_CURRENT_ALARM_MIN 0
+#define SETTING_OSD_CURRENT_ALARM_MAX 255
+#define SETTING_OSD_GFORCE_ALARM 395
+#define SETTING_OSD_GFORCE_ALARM_MIN 0
+#define SETTING_OSD_GFORCE_ALARM_MAX 20
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MIN 396
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MIN_MIN -20
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MIN_MAX 20
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MAX 397
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MAX_MIN -20
+#define SETTING_OSD_GFORCE_AXIS_ALARM_MAX_MAX 20
+#define SETTING_OSD_IMU_TEMP_ALARM_MIN 398
+#define SETTING_OSD_IMU_TEMP_ALARM_MIN_MIN -550
+#define SETTING_OSD_IMU_TEMP_ALARM_MIN_MAX 1250
+#define SETTING_OSD_IMU_TEMP_ALARM_MAX 399
+#define SETTING_OSD_IMU_TEMP_ALARM_MAX_MIN -550
+#define SETTING_OSD_IMU_TEMP_ALARM_MAX_MAX 1250
+#define SETTING_OSD_ESC_TEMP_ALARM_MAX 400
+#define SETTING_OSD_ESC_TEMP_ALARM_MAX_MIN -550
+#define SETTING_OSD_ESC_TEMP_ALARM_MAX_MAX 1500
+#define SETTING_OSD_ESC_TEMP_ALARM_MIN 401
+#define SETTING_OSD_ESC_TEMP_ALARM_MIN_MIN -550
+#define SETTING_OSD_ESC_TEMP_ALARM_MIN_MAX 1500
+#define SETTING_OSD_BARO_TEMP_ALARM_MIN 402
+#define SETTING_OSD_BARO_TEMP_ALARM_MIN_MIN -550
+#define SETTING_OSD_BARO_TEMP_ALARM_MIN_MAX 1250
+#define SETTING_OSD_BARO_TEMP_ALARM_MAX 403
+#define SETTING_OSD_BARO_TEMP_ALARM_MAX_MIN -550
+#define SETTING_OSD_BARO_TEMP_ALARM_MAX_MAX 1250
+#define SETTING_OSD_TEMP_LABEL_ALIGN 404
+#define SETTING_OSD_TEMP_LABEL_ALIGN_MIN 0
+#define SETTING_OSD_TEMP_LABEL_ALIGN_MAX 0
+#define SETTING_OSD_ARTIFICIAL_HORIZON_REVERSE_ROLL 405
+#define SETTING_OSD_ARTIFICIAL_HORIZON_REVERSE_ROLL_MIN 0
+#define SETTING_OSD_ARTIFICIAL_HORIZON_REVERSE_ROLL_MAX 0
+#define SETTING_OSD_ARTIFICIAL_HORIZON_MAX_PITCH 406
+#define SETTING_OSD_ARTIFICIAL_HORIZON_MAX_PITCH_MIN 10
+#define SETTING_OSD_ARTIFICIAL_HORIZON_MAX_PITCH_MAX 90
+#define SETTING_OSD_CROSSHAIRS_STYLE 407
+#define SETTING_OSD_CROSSHAIRS_STYLE_MIN 0
+#define SETTING_OSD_CROSSHAIRS_STYLE_MAX 0
+#define SETTING_OSD_HORIZON_OFFSET 408
+#define SETTING_OSD_HORIZON_OFFSET_MIN -2
+#define SETTING_OSD_HORIZON_OFFSET_MAX 2
+#define SETTING_OSD_CAMERA_UPTILT 409
+#define SETTING_OSD_CAMERA_UPTILT_MIN -40
+#define SETTING_OSD_CAMERA_UPTILT_MAX 80
+#define SETTING_OSD_CAMERA_FOV_H 410
+#define SETTING_OSD_CAMERA_FOV_H_MIN 60
+#define SETTING_OSD_CAMERA_FOV_H_MAX 150
+#define SETTING_OSD_CAMERA_FOV_V 411
+#define SETTING_OSD_CAMERA_FOV_V_MIN 30
+#define SETTING_OSD_CAMERA_FOV_V_MAX 120
+#define SETTING_OSD_HUD_MARGIN_H 412
+#define SETTING_OSD_HUD_MARGIN_H_MIN 0
+#define SETTING_OSD_HUD_MARGIN_H_MAX 4
+#define SETTING_OSD_HUD_MARGIN_V 413
+#define SETTING_OSD_HUD_MARGIN_V_MIN 1
+#define SETTING_OSD_HUD_MARGIN_V_MAX 3
+#define SETTING_OSD_HUD_HOMING 414
+#define SETTING_OSD_HUD_HOMING_MIN 0
+#define SETTING_OSD_HUD_HOMING_MAX 0
+#define SETTING_OSD_HUD_HOMEPOINT 415
+#define SETTING_OSD_HUD_HOMEPOINT_MIN 0
+#define SETTING_OSD_HUD_HOMEPOINT_MAX 0
+#define SETTING_OSD_HUD_RADAR_DISP 416
+#define SETTING_OSD_HUD_RADAR_DISP_MIN 0
+#define SETTING_OSD_HUD_RADAR_DISP_MAX 4
+#define SETTING_OSD_HUD_RADAR_RANGE_MIN 417
+#define SETTING_OSD_HUD_RADAR_RANGE_MIN_MIN 1
+#define SETTING_OSD_HUD_RADAR_RANGE_MIN_MAX 30
+#define SETTING_OSD_HUD_RADAR_RANGE_MAX 418
+#define SETTING_OSD_HUD_RADAR_RANGE_MAX_MIN 100
+#define SETTING_OSD_HUD_RADAR_RANGE_MAX_MAX 9990
+#define SETTING_OSD_HUD_RADAR_NEAREST 419
+#define SETTING_OSD_HUD_RADAR_NEAREST_MIN 0
+#define SETTING_OSD_HUD_RADAR_NEAREST_MAX 4000
+#define SETTING_OSD_HUD_WP_DISP 420
+#define SETTING_OSD_HUD_WP_DISP_MIN 0
+#define SETTING_OSD_HUD_WP_DISP_MAX 3
+#define SETTING_OSD_LEFT_SIDEBAR_SCROLL 421
+#define SETTING_OSD_LEFT_SIDEBAR_SCROLL_MIN 0
+#define SETTING_OSD_LEFT_SIDEBAR_SCROLL_MAX 0
+#define SETTING_OSD_RIGHT_SIDEBAR_SCROLL 422
+#define SETTING_OSD_RIGHT_SIDEBAR_SCROLL_MIN 0
+#define SETTING_OSD_RIGHT_SIDEBAR_SCROLL_MAX 0
+#define SETTING_OSD_SIDEBAR_SCROLL_ARROWS 423
+#define SETTING_OSD_SIDEBAR_SCROLL_ARROWS_MIN 0
+#define SETTING_OSD_SIDEBAR_SCROLL_ARROWS_MAX 0
+#define SETTING_OSD_MAIN_VOLTAGE_DECIMALS 424
+#define SETTING_OSD_MAIN_VOLTAGE_DECIMALS_MIN 1
+#define SETTING_OSD_MAIN_VOLTAGE_DECIMALS_MAX 2
+#define SETTING_OSD_COORDINATE_DIGITS 425
+#define SETTING_OSD_COORDINATE_DIGITS_MIN 8
+#define SETTING_OSD_COORDINATE_DIGITS_MAX 11
+#define SETTING_OSD_ESTIMATIONS_WIND_COMPENSATION 426
+#define SETTING_OSD_ESTIMATIONS_WIND_COMPENSATION_MIN 0
+#define SETTING_OSD_ESTIMATIONS_WIND_COMPENSATION_MAX 0
+#define SETTING_OSD_FAILSAFE_SWITCH_LAYOUT 427
+#define SETTING_OSD_FAILSAFE_SWITCH_LAYOUT_MIN 0
+#define SETTING_OSD_FAILSAFE_SWITCH_LAYOUT_MAX 0
+#define SETTING_OSD_PLUS_CODE_DIGITS 428
+#define SETTING_OSD_PLUS_CODE_DIGITS_MIN 10
+#define SETTING_OSD_PLUS_CODE_DIGITS_MAX 13
+#define SETTING_OSD_AHI_STYLE 429
+#define SETTING_OSD_AHI_STYLE_MIN 0
+#define SETTING_OSD_AHI_STYLE_MAX 0
+#define SETTING_I2C_SPEED 430
+#define SETTING_I2C_SPEED_MIN 0
+#define SETTING_I2C_SPEED_MAX 0
+#define SETTING_DEBUG_MODE 431
+#define SETTING_DEBUG_MODE_MIN 0
+#define SETTING_DEBUG_MODE_MAX 0
+#define SETTING_THROTTLE_TILT_COMP_STR 432
+#define SETTING_THROTTLE_TILT_COMP_STR_MIN 0
+#define SETTING_THROTTLE_TILT_COMP_STR_MAX 100
+#define SETTING_NAME 433
+#define SETTING_NAME_MIN 0
+#define SETTING_NAME_MAX 16
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR 434
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0
+#define SETTING_STATS 435
+#define SETTING_STATS_MIN 0
+#define SETTING_STATS_MAX 0
+#define SETTING_STATS_TOTAL_TIME 436
+#define SETTING_STATS_TOTAL_TIME_MIN 0
+#define SETTING_STATS_TOTAL_TIME_MAX 2147483647
+#define SETTING_STATS_TOTAL_DIST 437
+#define SETTING_STATS_TOTAL_DIST_MIN 0
+#define SETTING_STATS_TOTAL_DIST_MAX 2147483647
+#define SETTING_STATS_TOTAL_ENERGY 438
+#define SETTING_STATS_TOTAL_ENERGY_MIN 0
+#define SETTING_STATS_TOTAL_ENERGY_MAX 2147483647
+#define SETTING_TZ_OFFSET 439
+#define SETTING_TZ_OFFSET_MIN -1440
+#define SETTING_TZ_OFFSET_MAX 1440
+#define SETTING_TZ_AUTOMATIC_DST 440
+#define SETTING_TZ_AUTOMATIC_DST_MIN 0
+#define SETTING_TZ_AUTOMATIC_DST_MAX 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK 441
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0
+#define SETTING_VTX_HALFDUPLEX 442
+#define SETTING_VTX_HALFDUPLEX_MIN 0
+#define SETTING_VTX_HALFDUPLEX_MAX 0
+#define SETTING_VTX_BAND 443
+#define SETTING_VTX_BAND_MIN 0
+#define SETTING_VTX_BAND_MAX 5
+#define SETTING_VTX_CHANNEL 444
+#define SETTING_VTX_CHANNEL_MIN 1
+#define SETTING_VTX_CHANNEL_MAX 8
+#define SETTING_VTX_POWER 445
+#define SETTING_VTX_POWER_MIN 1
+#define SETTING_VTX_POWER_MAX 5
+#define SETTING_VTX_LOW_POWER_DISARM 446
+#define SETTING_VTX_LOW_POWER_DISARM_MIN 0
+#define SETTING_VTX_LOW_POWER_DISARM_MAX 0
+#define SETTING_VTX_PIT_MODE_CHAN 447
+#define SETTING_VTX_PIT_MODE_CHAN_MIN 1
+#define SETTING_VTX_PIT_MODE_CHAN_MAX 8
+#define SETTING_VTX_MAX_POWER_OVERRIDE 448
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000
+#define SETTING_LOG_LEVEL 449
+#define SETTING_LOG_LEVEL_MIN 0
+#define SETTING_LOG_LEVEL_MAX 0
+#define SETTING_LOG_TOPICS 450
+#define SETTING_LOG_TOPICS_MIN 0
+#define SETTING_LOG_TOPICS_MAX 4294967295
+#define SETTING_ESC_SENSOR_LISTEN_ONLY 451
+#define SETTING_ESC_SENSOR_LISTEN_ONLY_MIN 0
+#define SETTING_ESC_SENSOR_LISTEN_ONLY_MAX 0
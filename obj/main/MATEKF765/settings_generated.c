@@ -0,0 +1,1573 @@
+// This file has been automatically generated by utils/settings.rb
+// Don't make any modifications to it. They will be lost.
+
+#include "platform.h"
+#include "config/parameter_group_ids.h"
+#include "fc/settings.h"
+#include "sensors/gyro.h"
+#include "flight/dynamic_gyro_notch.h"
+#include "fc/config.h"
+#include "sensors/acceleration.h"
+#include "sensors/rangefinder.h"
+#include "sensors/opflow.h"
+#include "sensors/compass.h"
+#include "sensors/barometer.h"
+#include "sensors/pitotmeter.h"
+#include "rx/rx.h"
+#include "rx/spektrum.h"
+#include "blackbox/blackbox.h"
+#include "flight/mixer.h"
+#include "flight/failsafe.h"
+#include "sensors/boardalignment.h"
+#include "sensors/battery.h"
+#include "sensors/battery.h"
+#include "flight/servos.h"
+#include "fc/controlrate_profile.h"
+#include "io/serial.h"
+#include "flight/imu.h"
+#include "fc/rc_controls.h"
+#include "flight/pid.h"
+#include "navigation/navigation.h"
+#include "io/serial.h"
+#include "telemetry/telemetry.h"
+#include "telemetry/frsky_d.h"
+#include "telemetry/sim.h"
+#include "common/color.h"
+#include "io/ledstrip.h"
+#include "io/osd.h"
+#include "drivers/osd.h"
+#include "fc/config.h"
+#include "fc/rc_modes.h"
+#include "fc/stats.h"
+#include "common/time.h"
+#include "drivers/display.h"
+#include "io/vtx_control.h"
+#include "drivers/vtx_common.h"
+#include "io/vtx.h"
+#include "io/piniobox.h"
+#include "common/log.h"
+#include "sensors/esc_sensor.h"
+const pgn_t settingsPgn[] = {
+	PG_GYRO_CONFIG,
+	PG_ADC_CHANNEL_CONFIG,
+	PG_ACCELEROMETER_CONFIG,
+	PG_RANGEFINDER_CONFIG,
+	PG_OPFLOW_CONFIG,
+	PG_COMPASS_CONFIG,
+	PG_BAROMETER_CONFIG,
+	PG_PITOTMETER_CONFIG,
+	PG_RX_CONFIG,
+	PG_BLACKBOX_CONFIG,
+	PG_MOTOR_CONFIG,
+	PG_FAILSAFE_CONFIG,
+	PG_BOARD_ALIGNMENT,
+	PG_BATTERY_METERS_CONFIG,
+	PG_BATTERY_PROFILES,
+	PG_MIXER_CONFIG,
+	PG_REVERSIBLE_MOTORS_CONFIG,
+	PG_SERVO_CONFIG,
+	PG_CONTROL_RATE_PROFILES,
+	PG_SERIAL_CONFIG,
+	PG_IMU_CONFIG,
+	PG_ARMING_CONFIG,
+	PG_GENERAL_SETTINGS,
+	PG_RPM_FILTER_CONFIG,
+	PG_GPS_CONFIG,
+	PG_RC_CONTROLS_CONFIG,
+	PG_PID_PROFILE,
+	PG_PID_AUTOTUNE_CONFIG,
+	PG_POSITION_ESTIMATION_CONFIG,
+	PG_NAV_CONFIG,
+	PG_TELEMETRY_CONFIG,
+	PG_LED_STRIP_CONFIG,
+	PG_OSD_CONFIG,
+	PG_SYSTEM_CONFIG,
+	PG_MODE_ACTIVATION_OPERATOR_CONFIG,
+	PG_STATS_CONFIG,
+	PG_TIME_CONFIG,
+	PG_DISPLAY_CONFIG,
+	PG_VTX_CONFIG,
+	PG_VTX_SETTINGS_CONFIG,
+	PG_PINIOBOX_CONFIG,
+	PG_LOG_CONFIG,
+	PG_ESC_SENSOR_CONFIG,
+};
+const uint8_t settingsPgnCounts[] = {
+	23,
+	4,
+	12,
+	2,
+	3,
+	10,
+	3,
+	3,
+	15,
+	5,
+	9,
+	13,
+	3,
+	10,
+	9,
+	5,
+	3,
+	6,
+	16,
+	1,
+	7,
+	3,
+	1,
+	4,
+	7,
+	7,
+	78,
+	5,
+	22,
+	68,
+	27,
+	1,
+	45,
+	4,
+	1,
+	4,
+	2,
+	1,
+	1,
+	6,
+	4,
+	2,
+	1,
+};
+static const uint8_t settingNamesWords[] = {
+	0x70,0x6c, /* "nav" */ 
+	0x3,0x5c, /* "fw" */ 
+	0xd,0x18, /* "mc" */ 
+	0x1f,0x32, /* "osd" */ 
+	0x2,0x41,0xa1, /* "rate" */ 
+	0x40,0x7c,0xc9,0xe0, /* "gyro" */ 
+	0x80, /* "p" */ 
+	0x32,0x1b, /* "yaw" */ 
+	0x81,0x2e,0xd, /* "inav" */ 
+	0x80,0xd4,0xb8, /* "min" */ 
+	0xd,0xe, /* "max" */ 
+	0x1,0xa0, /* "z" */ 
+	0x5,0x81,0x93, /* "alarm" */ 
+	0x41,0x4,0xd0,0x68, /* "pitch" */ 
+	0x4,0x1f,0x30, /* "pos" */ 
+	0x18,0x29,0x64,0xc2,0x62, /* "failsafe" */ 
+	0x81,0x1a, /* "hz" */ 
+	0x4,0x9e,0xc6, /* "roll" */ 
+	0x2,0x99,0x81, /* "type" */ 
+	0x41,0x70, /* "w" */ 
+	0x4,0x63, /* "acc" */ 
+	0x2, /* "i" */ 
+	0x41,0x8c, /* "xy" */ 
+	0x80,0x2e,0x3b,0xa, /* "angle" */ 
+	0x3,0xc2,0x60, /* "gps" */ 
+	0x60,0x6a,0xe1,0xa0, /* "launch" */ 
+	0xc,0x81, /* "lpf" */ 
+	0x81,0x44,0xb4,0xa0, /* "time" */ 
+	0xb,0x12,0x77, /* "align" */ 
+	0x0,0x80, /* "d" */ 
+	0x95,0x10, /* "rth" */ 
+	0x6,0x84,0xe0, /* "mag" */ 
+	0x73,0xe8,0x34, /* "notch" */ 
+	0x2,0x88,0x91,0x66,0x87,0xb0,0x80, /* "threshold" */ 
+	0x45,0x48, /* "hud" */ 
+	0x9,0xc0,0xa5,0x20, /* "speed" */ 
+	0x28,0x89, /* "thr" */ 
+	0x0,0x85,0x9,0x4,0x17,0x10, /* "deadband" */ 
+	0x9,0x6d, /* "imu" */ 
+	0x40,0xd7,0xd1,0xf2, /* "motor" */ 
+	0x5, /* "v" */ 
+	0x80,0x20,0xc9,0xe0, /* "baro" */ 
+	0x14,0x82,0xb4,0xb8,0xe0, /* "braking" */ 
+	0x21,0x58,0x1c, /* "delay" */ 
+	0x81,0x1,0x91,0x2e,0x19,0x14, /* "hardware" */ 
+	0xc,0x2d,0x8a,0xc0, /* "level" */ 
+	0x34,0x2e,0xa8,0x58, /* "manual" */ 
+	0xa,0x15,0xb0, /* "temp" */ 
+	0x5,0x11,0x27,0xd2,0x8c,0x28, /* "throttle" */ 
+	0x2c,0x20,0xd0, /* "vbat" */ 
+	0x16,0x2b, /* "vel" */ 
+	0x1,0x67,0xb2,0x81,0x39, /* "voltage" */ 
+	0x41,0x6a,0x60, /* "vtx" */ 
+	0x1,0x65,0x13,0x4a,0x90,0xa0, /* "altitude" */ 
+	0xd,0x68,0xf0, /* "auto" */ 
+	0xd,0x1,0x73,0x8a,0xc0, /* "channel" */ 
+	0x13,0x2e,0xb,0x52,0x30, /* "dynamic" */ 
+	0x17,0x10,0x78, /* "expo" */ 
+	0xd,0x29,0xaf,0x20, /* "frsky" */ 
+	0x62,0x5a,0x9a, /* "limit" */ 
+	0x1,0xaf,0x21, /* "mode" */ 
+	0x40,0xf3,0x1a,0x65,0xa0, /* "offset" */ 
+	0x24,0x30, /* "rc" */ 
+	0x4a,0x73,0x48, /* "rssi" */ 
+	0x6,0x56,0x30, /* "cell" */ 
+	0x3,0x62,0x5a,0x20, /* "climb" */ 
+	0xe,0xb2,0x91,0x5d,0x40, /* "current" */ 
+	0x11,0x33,0xc,0x9a, /* "disarm" */ 
+	0x2,0x26,0x74,0xb,0x86,0x50, /* "distance" */ 
+	0x26,0x85,0x93, /* "iterm" */ 
+	0x40,0xc7,0xdc, /* "low" */ 
+	0xd,0xd,0x98,0x97,0x2c, /* "mavlink" */ 
+	0x10,0x7d,0xcb,0x20, /* "power" */ 
+	0x4c,0x61,0x61, /* "scale" */ 
+	0x41,0x32,0xca,0xcf, /* "servo" */ 
+	0x4,0xe8,0x1a,0x4c, /* "stats" */ 
+	0x1b,0x20, /* "3d" */ 
+	0x2,0x31,0x95,0x80, /* "accel" */ 
+	0x9,0x6, /* "adc" */ 
+	0x0,0xb2,0x80, /* "alt" */ 
+	0x10,0x69,0x42,0xcb,0x20, /* "battery" */ 
+	0x13,0x2,0x35,0x89,0xf8, /* "blackbox" */ 
+	0x0,0x9e,0xf9,0xd0, /* "boost" */ 
+	0x3,0xc,0x2,0x34,0xd3,0x20, /* "capacity" */ 
+	0x19, /* "cd" */ 
+	0x0,0x39,0x55,0x33,0x28, /* "cruise" */ 
+	0x7,0x5a,0x3c,0xc6, /* "cutoff" */ 
+	0x1,0x6,0xd0, /* "dcm" */ 
+	0x12,0x85,0x93, /* "dterm" */ 
+	0x40,0x63, /* "ff" */ 
+	0x0,0xc9,0x65,0xb,0x20, /* "filter" */ 
+	0x21,0xed,0x28, /* "home" */ 
+	0x12,0xeb,0x16,0x54,0x29, /* "inverted" */ 
+	0x0,0xb0,0xb1,0xa1,0x70, /* "kalman" */ 
+	0x18,0x17,0x11,0x2e,0x38, /* "landing" */ 
+	0x1a,0x5a,0x16,0x40, /* "meter" */ 
+	0x82,0x5c,0x97, /* "pinio" */ 
+	0x82,0x41,0x20,0x64, /* "radar" */ 
+	0x9,0x5,0xc7,0x28, /* "range" */ 
+	0x25,0x6, /* "rpm" */ 
+	0x82,0x69,0x68, /* "sim" */ 
+	0x27,0x74,0xd0,0x68, /* "switch" */ 
+	0x5,0xa,0xc2,0xb4,0xb4,0x96, /* "telemetry" */ 
+	0x41,0x44,0xb4,0xaf,0xad, /* "timeout" */ 
+	0x1,0x57,0x26,0x80, /* "unit" */ 
+	0xac,0xca, /* "use" */ 
+	0xc, /* "x" */ 
+	0x0,0x23,0x19,0xc2,0x97, /* "accgain" */ 
+	0x0,0x23,0x1e,0x8b,0x27, /* "acczero" */ 
+	0x80,0x2e,0xa2,0x4f,0x20,0xd9,0x34,0xc8, /* "antigravity" */ 
+	0x3,0x5a,0x3e,0x95,0x71, /* "autotune" */ 
+	0x40,0x20,0xb9,0x60, /* "bank" */ 
+	0x13,0xc3,0x22, /* "board" */ 
+	0x0,0x61,0x69,0x64,0x10, /* "camera" */ 
+	0xd,0xee,0xa4,0x9e,0xc0, /* "control" */ 
+	0x10,0xb4,0x28,0xe8, /* "detect" */ 
+	0x2,0x26,0x45,0x1d,0x12,0xf7, /* "direction" */ 
+	0x0,0xae,0x8,0x98,0x52, /* "enabled" */ 
+	0x0,0xae,0x2c,0x8f,0x90, /* "energy" */ 
+	0x16,0xc5,0x75, /* "event" */ 
+	0x0,0x73,0x3e,0x43,0x28, /* "gforce" */ 
+	0x10,0x16,0x18,0x95,0x83,0xb,0x80, /* "halfduplex" */ 
+	0x20,0x87, /* "hdg" */ 
+	0x2,0xa,0x12,0x25,0xc7, /* "heading" */ 
+	0x2,0x1e,0xc2, /* "hold" */ 
+	0x1,0x24,0x61, /* "idle" */ 
+	0x40,0xd0,0x9f,0x45,0x93, /* "magzero" */ 
+	0xc0,0xd0,0xc8,0xe9,0x70, /* "margin" */ 
+	0x1f,0x3,0x31,0xf7, /* "opflow" */ 
+	0x4,0x13,0x47,0xd0, /* "pitot" */ 
+	0x10,0xbb, /* "pwm" */ 
+	0x41,0x10, /* "q" */ 
+	0x48,0xac,0xe, /* "relax" */ 
+	0x1,0x32,0xc9,0x21,0x64,0xb0, /* "serialrx" */ 
+	0x9,0xd6,0x46,0x8,0xca, /* "surface" */ 
+	0xa,0x3e,0x81,0x60, /* "total" */ 
+	0x29,0x0, /* "tpa" */ 
+	0x82,0xf0, /* "wp" */ 
+	0x6, /* "y" */ 
+	0x40,0x14,0xc9,0xaf,0x21, /* "airmode" */ 
+	0x40,0x14,0xca,0x70,0x29,0x48, /* "airspeed" */ 
+	0x0,0xe1,0x33, /* "axis" */ 
+	0x0,0x83,0x40, /* "bat" */ 
+	0xd,0x1,0x70, /* "chan" */ 
+	0x6,0x82,0x8d,0x60, /* "check" */ 
+	0x21,0x4c,0x1a,0xb2,0x80, /* "default" */ 
+	0x21,0x5c,0xf6, /* "denom" */ 
+	0x80,0x89,0x9c, /* "disp" */ 
+	0x0,0x44,0xce,0x80, /* "dist" */ 
+	0x2c,0x2c, /* "epv" */ 
+	0x2,0xcc,0x60, /* "esc" */ 
+	0x30,0x47,0x47,0xc8, /* "factor" */ 
+	0x6,0x4c,0xa7,0x40, /* "first" */ 
+	0x19,0x8f,0xb8, /* "flow" */ 
+	0xc,0xfb, /* "fov" */ 
+	0x1,0x0, /* "h" */ 
+	0x42,0x4e,0x80, /* "high" */ 
+	0x24,0xee,0x7c,0x8a, /* "ignore" */ 
+	0x4,0xb8,0x6c,0x4b,0x83,0x44,0xbd,0xc0, /* "inclination" */ 
+	0x4b,0xa8,0x59,0x58,0x2c, /* "interval" */ 
+	0x2,0xd2, /* "ki" */ 
+	0x5,0xc0, /* "kp" */ 
+	0xc,0x79, /* "log" */ 
+	0xc0,0xc7,0xa6,0x85,0x90, /* "loiter" */ 
+	0x18,0xfb,0xc0,0x33,0x98, /* "lowpass" */ 
+	0x19,0x3,0x70, /* "lpf2" */ 
+	0xd,0x29,0x12,0x17, /* "median" */ 
+	0x1,0xaf,0x21,0x58, /* "model" */ 
+	0x7,0x14,0xe0, /* "neg" */ 
+	0x82,0x48, /* "pid" */ 
+	0x8,0x24,0x93,0xab, /* "pidsum" */ 
+	0x41,0x4,0xd0, /* "pit" */ 
+	0x10,0x93,0xc6,0x52,0x56,0x45, /* "procedure" */ 
+	0x4,0x24,0xfa,0x3c,0x6f,0x60, /* "protocol" */ 
+	0x21,0x27,0xd9,0x24,0x2c, /* "provider" */ 
+	0x81,0x20,0x91,0x35,0x98, /* "radius" */ 
+	0x24,0x17,0x1c,0xa6,0x4b,0x88,0x59, /* "rangefinder" */ 
+	0x2,0x45,0x98, /* "res" */ 
+	0x24,0x59,0x96,0x80, /* "reset" */ 
+	0x96, /* "rx" */ 
+	0x1,0x3a,0x4,0xe5,0xe0, /* "stage2" */ 
+	0x27,0x4c,0xb0,0xa0, /* "style" */ 
+	0x9e,0x5c,0x30, /* "sync" */ 
+	0x51,0x12,0x7d, /* "throw" */ 
+	0xc1,0x49,0x5,0xd3,0x6a,0x68, /* "transmit" */ 
+	0xa,0x68, /* "tz" */ 
+	0x15,0x99,0x46, /* "usec" */ 
+	0xb,0x86,0x4e,0x4b,0x8e, /* "warning" */ 
+	0x0,0x89,0xf2,0xa0, /* "abort" */ 
+	0x2,0x31,0x95,0x85,0x90,0x68,0xf9, /* "accelerator" */ 
+	0x0,0x28,0x48, /* "ahi" */ 
+	0x2,0xc6,0x3e,0xe0, /* "allow" */ 
+	0xb,0x82,0xcc,0xcc,0xb2, /* "analyser" */ 
+	0x0,0x61,0x6,0x24,0xa4, /* "applied" */ 
+	0x0,0x6b,0x47,0xb4,0x34,0x48, /* "automatic" */ 
+	0xc0,0x20,0xb8,0x80, /* "band" */ 
+	0x10,0x6a,0x40, /* "baud" */ 
+	0x8,0xa5,0x81,0x64, /* "beeper" */ 
+	0x1,0x24,0x33, /* "bias" */ 
+	0x0,0x9f,0x8e, /* "box1" */ 
+	0x80,0x4f,0xc7, /* "box2" */ 
+	0x0,0x27,0xe3,0x60, /* "box3" */ 
+	0x13,0xf1,0xe0, /* "box4" */ 
+	0xa,0x45,0xa,0xe0,0xf4,0xba,0x80, /* "breakpoint" */ 
+	0x18,0x58, /* "cal" */ 
+	0x1,0x85,0x89,0x14,0x83,0x44,0xbd,0xc0, /* "calibration" */ 
+	0x19,0x58,0xc9, /* "cells" */ 
+	0x80,0x65,0x75,0xb,0x20, /* "center" */ 
+	0xd,0x1,0x90,0x47,0x42,0xc8, /* "character" */ 
+	0x3,0x7b,0x5a,0x17,0x10, /* "command" */ 
+	0x3,0x7b,0x60, /* "comp" */ 
+	0x1,0xbd,0xb0,0x91,0x67,0x34,0xbd,0xc0, /* "compression" */ 
+	0x1b,0xdc,0x64,0x9c, /* "config" */ 
+	0x3,0x7b,0xa7,0x40,0xba,0x80, /* "constant" */ 
+	0x1b,0xdf,0x22,0x25,0xc1,0xa1, /* "coordinate" */ 
+	0x40,0x37,0xbe,0x44,0x4b,0x83,0x42,0xcc, /* "coordinates" */ 
+	0x3,0x7d,0x5d,0x40, /* "count" */ 
+	0xe,0x49,0xa2,0x46,0x16, /* "critical" */ 
+	0x0,0x72,0x7c,0xe6,0x80,0xa6,0x53, /* "crosshairs" */ 
+	0x1,0x3e,0x27,0xbe,0x74,0xf9,0xf3,0x27,0xfc,0x85,0x65,0x3,0xf6,0x40,0xdf,0x46, /* "d_boost_gyro_delta_lpf_hz" */ 
+	0x80,0x4f,0x89,0xef,0x9d,0x3e,0xd0,0xe3,0xe1,0xa7,0xc2,0x31,0x95,0x85,0x90,0x68,0x97,0xb8, /* "d_boost_max_at_acceleration" */ 
+	0x4,0x28,0xaa,0x70, /* "debug" */ 
+	0x10,0xa3,0x2b, /* "decel" */ 
+	0x0,0x42,0x8c,0xac,0x2c,0x83,0x44,0xbd,0xc0, /* "deceleration" */ 
+	0x21,0x46,0x96,0x85,0x93, /* "decimals" */ 
+	0x1,0xa,0x36, /* "decl" */ 
+	0x0,0x85,0x1b,0x12,0xe0,0xd1,0x2f,0x70, /* "declination" */ 
+	0x8,0x53,0x6,0xac,0xa4, /* "defaults" */ 
+	0xc0,0x42,0x9e,0x45,0x2c, /* "degrees" */ 
+	0xc0,0x42,0xd9,0x23,0x28, /* "device" */ 
+	0x8,0x93,0xa6,0x93, /* "digits" */ 
+	0x1,0x13,0x32,0xb8,0xe1,0x39, /* "disengage" */ 
+	0x40,0x44,0xce,0xc,0xe,0x7e,0x67,0xc8,0x65,0xfc,0xef,0xf1,0x31,0x2e,0x58, /* "display_force_sw_blink" */ 
+	0x8,0x9b,0x14, /* "dive" */ 
+	0x4,0x7d,0xdc, /* "down" */ 
+	0x2,0x4e,0x80, /* "dst" */ 
+	0x26,0x5c, /* "dyn" */ 
+	0x2,0xb4,0xb2,0x38, /* "emerg" */ 
+	0xb,0x4, /* "eph" */ 
+	0x0,0xb3,0x1f,0xe6,0x57,0x4d,0xf2,0xfb,0x13,0x3a,0x15,0xdf,0x7b,0x99,0x90, /* "esc_sensor_listen_only" */ 
+	0x17,0x14, /* "ext" */ 
+	0x1,0x71,0x49,0x7,0xa0, /* "extra1" */ 
+	0x2e,0x29,0x20,0xf0, /* "extra2" */ 
+	0x6,0x4e,0xa,0x4f,0xdd,0x2e,0x3f,0xc3,0x5a,0x3f,0xe1,0x93, /* "fixed_wing_auto_arm" */ 
+	0x40,0x66,0x4,0xf3, /* "flags" */ 
+	0x1,0x98,0x18,0x16,0x4f,0x70, /* "flaperon" */ 
+	0xc,0xc0,0xc2,0x60, /* "flaps" */ 
+	0x33,0xe4,0xd0,0xd0, /* "format" */ 
+	0x6,0x85, /* "fpv" */ 
+	0x80,0x69,0x16,0x35,0x2b,0x87,0x90, /* "frequency" */ 
+	0x1a,0xa5,0x60, /* "fuel" */ 
+	0xd,0x7f,0x86,0xb4,0x7d,0x2a,0xe2,0xfc,0xc6,0xfd,0x1f,0xf4,0xfe,0x83, /* "fw_autotune_ff_to_i_tc" */ 
+	0x1,0xaf,0xf0,0xd6,0x8f,0xa5,0x5c,0x5f,0x98,0xdf,0xa3,0xff,0xf,0x9c,0x29,0x70, /* "fw_autotune_ff_to_p_gain" */ 
+	0xd,0x7f,0xa6,0x85,0x93,0x7e,0xc4,0xb5,0x34,0xfc,0xe8,0x91,0xaf,0xf0,0x7c,0xd3,0x44,0xbd,0xc0, /* "fw_iterm_limit_stick_position" */ 
+	0x35,0xff,0x4a,0xc9,0xdf,0xc,0xe6,0x99,0xd3,0xf9,0xd,0xfe,0x70,0xa5,0xc0, /* "fw_turn_assist_yaw_gain" */ 
+	0x38,0x52,0xe0, /* "gain" */ 
+	0x1c,0x2c,0x4b,0xa,0xf0, /* "galileo" */ 
+	0x20,0x32,0x6b,0xdc,0x91,0xcc, /* "harmonics" */ 
+	0x8,0xc, /* "has" */ 
+	0xc0,0x87,0xb4,0xb0,0x7a,0x5d,0x40, /* "homepoint" */ 
+	0x21,0xed,0x4b,0x8e, /* "homing" */ 
+	0x4,0x3e,0x49,0xd3,0xdc, /* "horizon" */ 
+	0x4,0x3e,0x94,0xf8,0x58,0x19,0x37,0xf3,0x7d,0x5c,0x4f,0xa5,0xd4,0x2c,0xac,0x16, /* "hott_alarm_sound_interval" */ 
+	0x1,0xf,0xb1,0x64, /* "hover" */ 
+	0x4,0xf0,0x60, /* "i2c" */ 
+	0x48,0xab,0x30, /* "ibus" */ 
+	0x25,0xc1,0xb7,0xc2,0xc6,0x3e,0xff,0x21,0x42,0x4f,0xc8,0xa3,0x5b,0xdc,0x97,0x1c, /* "inav_allow_dead_reckoning" */ 
+	0x9,0x70,0x6d,0xf3,0xc8,0x36,0x4d,0x33,0xf1,0x85,0x9f,0xa3,0xd8,0x59,0x5,0xc3,0x28, /* "inav_gravity_cal_tolerance" */ 
+	0x16,0x96,0x30, /* "kill" */ 
+	0xc,0x8,0x8a,0xc0, /* "label" */ 
+	0x30,0x34,0x4d,0x2a,0x42, /* "latitude" */ 
+	0x81,0x81,0xcb,0xeb,0x40, /* "layout" */ 
+	0x30,0xa4,0x9d,0x24,0x98, /* "ledstrip" */ 
+	0x1,0x8f,0x3a,0x46, /* "logic" */ 
+	0x6,0x3d,0xc7,0x4d,0x2a,0x42, /* "longitude" */ 
+	0x81,0x8f,0x7c,0x28,0x96,0x94, /* "looptime" */ 
+	0xc,0xa3, /* "ltm" */ 
+	0x40,0xd0,0xa5,0xc0, /* "main" */ 
+	0x6a,0x48, /* "mid" */ 
+	0x6,0xa5,0x8c,0x48, /* "milli" */ 
+	0x1a,0x99,0xcd,0x2f,0x70, /* "mission" */ 
+	0x1a,0x9c, /* "mix" */ 
+	0x1,0xaf,0x93,0xdc, /* "moron" */ 
+	0x7,0x5,0xa5, /* "name" */ 
+	0x3,0x83,0x6f,0x97,0x14,0x90,0x7e,0x19,0x35,0x2e,0x3f,0xe6,0x13,0x16,0x99, /* "nav_extra_arming_safety" */ 
+	0x3,0x83,0x6f,0x9a,0xff,0xb,0x18,0xfb,0xfd,0xa1,0x75,0x42,0xcf,0xd1,0x12,0xfa,0x5c,0x39,0x14,0x33,0x28, /* "nav_fw_allow_manual_thr_increase" */ 
+	0x1c,0x1b,0x7c,0xd7,0xfb,0x2,0xe2,0x7c,0x89,0xb1,0x7e,0x17,0x1d,0x85, /* "nav_fw_land_dive_angle" */ 
+	0x3,0x83,0x6f,0x9a,0xff,0x83,0xe7,0xf4,0x10,0xff,0x82,0x49,0x3a,0xb7,0xec,0x4b,0x53,0x40, /* "nav_fw_pos_hdg_pidsum_limit" */ 
+	0x38,0x36,0xfb,0x2,0xe2,0x7e,0x6c,0x7d,0xc8,0xfb,0xbb,0xed,0xe,0x2,0xca, /* "nav_land_slowdown_maxalt" */ 
+	0x1,0xc1,0xb7,0xd8,0x17,0x13,0xf3,0x63,0xee,0x47,0xdd,0xdf,0x6a,0x5c,0x16,0x50, /* "nav_land_slowdown_minalt" */ 
+	0xe,0xd,0xbe,0xd0,0xe3,0xf4,0x2c,0xa4,0x14,0xbb,0xe6,0x7b,0x18,0xfb,0xfc,0x2c,0xa0, /* "nav_max_terrain_follow_alt" */ 
+	0x1c,0x1b,0x7d,0xa3,0xf8,0xa4,0x15,0xa5,0xc7,0xf8,0x9e,0xf9,0xd3,0xe4,0x4c,0xca,0xe3,0x84,0xe5,0xfc,0xe0,0x52,0x90, /* "nav_mc_braking_boost_disengage_speed" */ 
+	0xe,0xd,0xbe,0xd1,0xfe,0xc5,0x67,0xf1,0x9f,0x92,0x85,0x93,0x7e,0xc8,0x1b,0xe8,0xd0, /* "nav_mc_vel_xy_dterm_lpf_hz" */ 
+	0x1c,0x1b,0x7e,0x54,0x47,0xc6,0xc4,0xb4,0x5f,0x49,0xdc,0xf9,0x17,0xe5,0x69,0x64,0x70, /* "nav_rth_climb_ignore_emerg" */ 
+	0x38,0x36,0xfd,0x66,0x5f,0xb5,0x24,0xa2,0x25,0xf3,0x3e,0x5f,0xb,0x28,0x87,0xb0,0x80, /* "nav_use_midthr_for_althold" */ 
+	0x71,0x43,0x22,0xce,0x80, /* "nearest" */ 
+	0x71,0x6b,0x49,0x5,0x80, /* "neutral" */ 
+	0x75,0x5a, /* "num" */ 
+	0x7,0x98,0xc0, /* "off" */ 
+	0x7b, /* "on" */ 
+	0x80,0xf8,0x16,0x41,0xa3,0xe4, /* "operator" */ 
+	0x7,0xcc,0x9f,0xc,0xa8,0x93,0x24,0x69,0xb,0x3e,0x87,0xc9,0x3a,0x7b,0xbe,0xd0,0xe3,0xf0,0x4d,0x6,0x80, /* "osd_artificial_horizon_max_pitch" */ 
+	0x3e,0x64,0xf8,0x65,0x44,0x99,0x23,0x48,0x59,0xf4,0x3e,0x49,0xd3,0xdd,0xf9,0x16,0xc5,0x94,0xcb,0xf9,0x3d,0x8c, /* "osd_artificial_horizon_reverse_roll" */ 
+	0x3,0xe6,0x4f,0x96,0x74,0x4b,0x43,0x44,0xbd,0xd3,0xfd,0xd2,0xe2,0x7c,0x6f,0x6c,0xa,0xe9,0x86,0x89,0x7b, /* "osd_estimations_wind_compensation" */ 
+	0x80,0xf9,0x93,0xec,0x29,0xa9,0xf9,0xa4,0x85,0x10,0x65,0xf9,0x8e,0x4f,0x63, /* "osd_left_sidebar_scroll" */ 
+	0x0,0xf9,0x93,0xf0,0x65,0x67,0xf1,0xbc,0x85,0xf9,0x12,0x74,0xd2,0x60, /* "osd_plus_code_digits" */ 
+	0x7c,0xc9,0xf9,0x24,0xe8,0xa7,0xe6,0x92,0x14,0x41,0x97,0xe6,0x39,0x3d,0x8c, /* "osd_right_sidebar_scroll" */ 
+	0x3,0xe6,0x4f,0xcd,0x24,0x28,0x83,0x2f,0xcc,0x72,0x7b,0x19,0xf0,0xca,0x4f,0xbc, /* "osd_sidebar_scroll_arrows" */ 
+	0xc0,0xfb,0x16,0x52,0x49,0xa, /* "override" */ 
+	0x7,0xd8,0xb2,0x92,0x48,0x59, /* "overrides" */ 
+	0x81,0xf6,0x2c,0xa6,0x87,0xbe,0x80, /* "overshoot" */ 
+	0x82,0x5c, /* "pin" */ 
+	0x8,0x26,0x83,0x47,0x28,0x89, /* "pitch2thr" */ 
+	0x2,0xc,0xd,0xc,0xf9,0x34, /* "platform" */ 
+	0x10,0x7b,0xb,0x30, /* "poles" */ 
+	0x41,0xf3,0x4d,0x12,0xf7, /* "position" */ 
+	0x2,0x12,0x28,0xd3,0x34,0xbd,0xc0, /* "precision" */ 
+	0x84,0x8b,0x64,0x96,0xe0, /* "preview" */ 
+	0x84,0x9e,0x32,0xce,0x60, /* "process" */ 
+	0x85,0x59,0x32, /* "pulse" */ 
+	0x82,0x45,0x13,0xdf,0x40, /* "reboot" */ 
+	0x48,0xa3,0x2a,0x6c,0x59, /* "receiver" */ 
+	0x2,0x45,0x1b,0xec,0x59,0x64, /* "recovery" */ 
+	0x12,0x29,0x8b,0x22,0xb8,0x65, /* "reference" */ 
+	0x4,0x8b,0x7,0xca,0x80, /* "report" */ 
+	0x93,0x18, /* "rll" */ 
+	0x9,0x3e,0xe0, /* "row" */ 
+	0x96,0x3f,0x38,0x27,0xf2,0x37,0xc6,0x80,0xb9,0xc5,0x67,0xc6,0xfa,0xba,0x80, /* "rx_spi_rf_channel_count" */ 
+	0x98,0x4c,0x50, /* "safe" */ 
+	0x4c,0x34,0x98, /* "sats" */ 
+	0x26,0x20,0xcc, /* "sbas" */ 
+	0x13,0x15,0x66, /* "sbus" */ 
+	0x9,0x90,0x61,0x91, /* "sdcard" */ 
+	0x1,0x34,0x6,0x50,0x71,0x67,0x30, /* "sharpness" */ 
+	0x4d,0x9,0x35,0x8,0xfb,0xb8, /* "shiftdown" */ 
+	0x13,0x4b,0x7e,0x79,0x3e,0xae,0x27,0xe7,0x40,0xd1,0x2f,0x77,0xdd,0x56,0x88,0xb2, /* "sim_ground_station_number" */ 
+	0x4,0xd8,0xf8,0x14, /* "slope" */ 
+	0x13,0x68,0x58,0xc0, /* "small" */ 
+	0x4d,0xa1,0x95,0x20,0xf9,0x50, /* "smartport" */ 
+	0x13,0x6b,0xdf,0x44,0x38,0xb3,0x98, /* "smoothness" */ 
+	0x26,0xfa,0xc8,0x65, /* "source" */ 
+	0x4,0xe0,0x97,0x56,0x0, /* "spinup" */ 
+	0x9c,0x86, /* "src" */ 
+	0x9,0xd0,0x34,0xac, /* "status" */ 
+	0xc1,0x3a,0x24,0x6b, /* "stick" */ 
+	0x4,0xe8,0xf8, /* "stop" */ 
+	0x2,0x79,0x9d,0xa,0xd0, /* "system" */ 
+	0x50,0x29,0x60, /* "tail" */ 
+	0x28,0x89,0x3e,0x94,0x61,0x7f,0x44,0xb2,0x9f,0x1b,0xdb,0xf,0xce,0x92, /* "throttle_tilt_comp_str" */ 
+	0x5,0x1e, /* "to" */ 
+	0xa,0x3d,0x85,0x90,0x5c,0x32, /* "tolerance" */ 
+	0x82,0x8f,0x82,0x47,0x30, /* "topics" */ 
+	0x52,0x49, /* "tri" */ 
+	0x5,0x44,0xc7,0xe0, /* "ublox" */ 
+	0x15,0x70,0x64,0xd2,0x90, /* "unarmed" */ 
+	0x15,0x71,0xb,0x29,0xa1,0xef,0xa0, /* "undershoot" */ 
+	0x2a,0xe4,0xd2,0x60, /* "units" */ 
+	0xac,0x8,0x1a,0x14, /* "update" */ 
+	0x15,0x85,0x12,0xca, /* "uptilt" */ 
+	0x2,0xb3,0x2c, /* "user" */ 
+	0x81,0x62,0xb1,0xc5,0x20, /* "velned" */ 
+	0x2c,0x56,0x3c,0x69,0xa6, /* "velocity" */ 
+	0x41,0x63,0x6,0x60, /* "vfas" */ 
+	0xb2,0x48,0x57, /* "video" */ 
+	0x82,0xc9,0x9d,0x42,0xc0, /* "visual" */ 
+	0x5c,0xa9,0x3a,0x28, /* "weight" */ 
+	0xb,0xa5,0xc4,0xac, /* "windup" */ 
+	0x1,0x8c,0xe8, /* "xyz" */ 
+	0x0,
+};
+static const char wordSymbols[] = {'3','2','1','4','_',};
+const char * const table_acc_hardware[] = {
+	"NONE",
+	"AUTO",
+	"ADXL345",
+	"MPU6050",
+	"MMA845x",
+	"BMA280",
+	"LSM303DLHC",
+	"MPU6000",
+	"MPU6500",
+	"MPU9250",
+	"BMI160",
+	"ICM20689",
+	"FAKE",
+};
+const char * const table_airmodeHandlingType[] = {
+	"STICK_CENTER",
+	"THROTTLE_THRESHOLD",
+};
+const char * const table_alignment[] = {
+	"DEFAULT",
+	"CW0",
+	"CW90",
+	"CW180",
+	"CW270",
+	"CW0FLIP",
+	"CW90FLIP",
+	"CW180FLIP",
+	"CW270FLIP",
+};
+const char * const table_aux_operator[] = {
+	"OR",
+	"AND",
+};
+const char * const table_baro_hardware[] = {
+	"NONE",
+	"AUTO",
+	"BMP085",
+	"MS5611",
+	"BMP280",
+	"MS5607",
+	"LPS25H",
+	"SPL06",
+	"BMP388",
+	"DPS310",
+	"FAKE",
+};
+const char * const table_bat_capacity_unit[] = {
+	"MAH",
+	"MWH",
+};
+const char * const table_bat_voltage_source[] = {
+	"RAW",
+	"SAG_COMP",
+};
+const char * const table_blackbox_compression[] = {
+	"NONE",
+	"HUFFMAN",
+};
+const char * const table_blackbox_device[] = {
+	"SERIAL",
+	"SPIFLASH",
+	"SDCARD",
+};
+const char * const table_current_sensor[] = {
+	"NONE",
+	"ADC",
+	"VIRTUAL",
+	"ESC",
+};
+const char * const table_debug_modes[] = {
+	"NONE",
+	"GYRO",
+	"AGL",
+	"FLOW_RAW",
+	"FLOW",
+	"SBUS",
+	"FPORT",
+	"ALWAYS",
+	"SAG_COMP_VOLTAGE",
+	"VIBE",
+	"CRUISE",
+	"REM_FLIGHT_TIME",
+	"SMARTAUDIO",
+	"ACC",
+	"ITERM_RELAX",
+	"ERPM",
+	"RPM_FILTER",
+	"RPM_FREQ",
+	"NAV_YAW",
+	"DYNAMIC_FILTER",
+	"DYNAMIC_FILTER_FREQUENCY",
+	"IRLOCK",
+	"CD",
+	"KALMAN",
+	"SDCARD",
+};
+const char * const table_direction[] = {
+	"RIGHT",
+	"LEFT",
+	"YAW",
+};
+const char * const table_dynamicFilterAnalyserTable[] = {
+	"FFT",
+	"SDFT",
+};
+const char * const table_dynamicFilterRangeTable[] = {
+	"HIGH",
+	"MEDIUM",
+	"LOW",
+};
+const char * const table_failsafe_procedure[] = {
+	"SET-THR",
+	"DROP",
+	"RTH",
+	"NONE",
+};
+const char * const table_filter_type[] = {
+	"PT1",
+	"BIQUAD",
+};
+const char * const table_frsky_unit[] = {
+	"METRIC",
+	"IMPERIAL",
+};
+const char * const table_gps_dyn_model[] = {
+	"PEDESTRIAN",
+	"AIR_1G",
+	"AIR_4G",
+};
+const char * const table_gps_provider[] = {
+	"NMEA",
+	"UBLOX",
+	"UNUSED",
+	"NAZA",
+	"UBLOX7",
+	"MTK",
+};
+const char * const table_gps_sbas_mode[] = {
+	"AUTO",
+	"EGNOS",
+	"WAAS",
+	"MSAS",
+	"GAGAN",
+	"NONE",
+};
+const char * const table_gyro_lpf[] = {
+	"256HZ",
+	"188HZ",
+	"98HZ",
+	"42HZ",
+	"20HZ",
+	"10HZ",
+};
+const char * const table_i2c_speed[] = {
+	"400KHZ",
+	"800KHZ",
+	"100KHZ",
+	"200KHZ",
+};
+const char * const table_iterm_relax[] = {
+	"OFF",
+	"RP",
+	"RPY",
+};
+const char * const table_iterm_relax_type[] = {
+	"GYRO",
+	"SETPOINT",
+};
+const char * const table_log_level[] = {
+	"ERROR",
+	"WARNING",
+	"INFO",
+	"VERBOSE",
+	"DEBUG",
+};
+const char * const table_ltm_rates[] = {
+	"NORMAL",
+	"MEDIUM",
+	"SLOW",
+};
+const char * const table_mag_hardware[] = {
+	"NONE",
+	"AUTO",
+	"HMC5883",
+	"AK8975",
+	"GPSMAG",
+	"MAG3110",
+	"AK8963",
+	"IST8310",
+	"QMC5883",
+	"MPU9250",
+	"IST8308",
+	"LIS3MDL",
+	"FAKE",
+};
+const char * const table_motor_pwm_protocol[] = {
+	"STANDARD",
+	"ONESHOT125",
+	"ONESHOT42",
+	"MULTISHOT",
+	"BRUSHED",
+	"DSHOT150",
+	"DSHOT300",
+	"DSHOT600",
+	"DSHOT1200",
+	"SERIALSHOT",
+};
+const char * const table_nav_extra_arming_safety[] = {
+	"OFF",
+	"ON",
+	"ALLOW_BYPASS",
+};
+const char * const table_nav_rth_allow_landing[] = {
+	"NEVER",
+	"ALWAYS",
+	"FS_ONLY",
+};
+const char * const table_nav_rth_alt_mode[] = {
+	"CURRENT",
+	"EXTRA",
+	"FIXED",
+	"MAX",
+	"AT_LEAST",
+	"AT_LEAST_LINEAR_DESCENT",
+};
+const char * const table_nav_user_control_mode[] = {
+	"ATTI",
+	"CRUISE",
+};
+const char * const table_off_on[] = {
+	"OFF",
+	"ON",
+};
+const char * const table_opflow_hardware[] = {
+	"NONE",
+	"PMW3901",
+	"CXOF",
+	"MSP",
+	"FAKE",
+};
+const char * const table_osd_ahi_style[] = {
+	"DEFAULT",
+	"LINE",
+};
+const char * const table_osd_alignment[] = {
+	"LEFT",
+	"RIGHT",
+};
+const char * const table_osd_crosshairs_style[] = {
+	"DEFAULT",
+	"AIRCRAFT",
+	"TYPE3",
+	"TYPE4",
+	"TYPE5",
+	"TYPE6",
+	"TYPE7",
+};
+const char * const table_osd_sidebar_scroll[] = {
+	"NONE",
+	"ALTITUDE",
+	"GROUND_SPEED",
+	"HOME_DISTANCE",
+};
+const char * const table_osd_stats_energy_unit[] = {
+	"MAH",
+	"WH",
+};
+const char * const table_osd_unit[] = {
+	"IMPERIAL",
+	"METRIC",
+	"UK",
+};
+const char * const table_osd_video_system[] = {
+	"AUTO",
+	"PAL",
+	"NTSC",
+};
+const char * const table_pidTypeTable[] = {
+	"NONE",
+	"PID",
+	"PIFF",
+	"AUTO",
+};
+const char * const table_pitot_hardware[] = {
+	"NONE",
+	"AUTO",
+	"MS4525",
+	"ADC",
+	"VIRTUAL",
+	"FAKE",
+};
+const char * const table_platform_type[] = {
+	"MULTIROTOR",
+	"AIRPLANE",
+	"HELICOPTER",
+	"TRICOPTER",
+	"ROVER",
+	"BOAT",
+};
+const char * const table_rangefinder_hardware[] = {
+	"NONE",
+	"HCSR04",
+	"SRF10",
+	"INAV_I2C",
+	"VL53L0X",
+	"MSP",
+	"UIB",
+	"BENEWAKE",
+};
+const char * const table_receiver_type[] = {
+	"NONE",
+	"PPM",
+	"SERIAL",
+	"MSP",
+	"SPI",
+	"UIB",
+};
+const char * const table_reset_type[] = {
+	"NEVER",
+	"FIRST_ARM",
+	"EACH_ARM",
+};
+const char * const table_rssi_source[] = {
+	"NONE",
+	"AUTO",
+	"ADC",
+	"CHANNEL",
+	"PROTOCOL",
+	"MSP",
+};
+const char * const table_serial_rx[] = {
+	"SPEK1024",
+	"SPEK2048",
+	"SBUS",
+	"SUMD",
+	"SUMH",
+	"XB-B",
+	"XB-B-RJ01",
+	"IBUS",
+	"JETIEXBUS",
+	"CRSF",
+	"FPORT",
+	"SBUS_FAST",
+};
+const char * const table_servo_protocol[] = {
+	"PWM",
+	"SERVO_DRIVER",
+	"SBUS",
+};
+const char * const table_smartport_fuel_unit[] = {
+	"PERCENT",
+	"MAH",
+	"MWH",
+};
+const char * const table_tz_automatic_dst[] = {
+	"OFF",
+	"EU",
+	"USA",
+};
+const char * const table_voltage_sensor[] = {
+	"NONE",
+	"ADC",
+	"ESC",
+};
+const char * const table_vtx_low_power_disarm[] = {
+	"OFF",
+	"ON",
+	"UNTIL_FIRST_ARM",
+};
+static const lookupTableEntry_t settingLookupTables[] = {
+	{ table_acc_hardware, sizeof(table_acc_hardware) / sizeof(char*) },
+	{ table_airmodeHandlingType, sizeof(table_airmodeHandlingType) / sizeof(char*) },
+	{ table_alignment, sizeof(table_alignment) / sizeof(char*) },
+	{ table_aux_operator, sizeof(table_aux_operator) / sizeof(char*) },
+	{ table_baro_hardware, sizeof(table_baro_hardware) / sizeof(char*) },
+	{ table_bat_capacity_unit, sizeof(table_bat_capacity_unit) / sizeof(char*) },
+	{ table_bat_voltage_source, sizeof(table_bat_voltage_source) / sizeof(char*) },
+	{ table_blackbox_compression, sizeof(table_blackbox_compression) / sizeof(char*) },
+	{ table_blackbox_device, sizeof(table_blackbox_device) / sizeof(char*) },
+	{ table_current_sensor, sizeof(table_current_sensor) / sizeof(char*) },
+	{ table_debug_modes, sizeof(table_debug_modes) / sizeof(char*) },
+	{ table_direction, sizeof(table_direction) / sizeof(char*) },
+	{ table_dynamicFilterAnalyserTable, sizeof(table_dynamicFilterAnalyserTable) / sizeof(char*) },
+	{ table_dynamicFilterRangeTable, sizeof(table_dynamicFilterRangeTable) / sizeof(char*) },
+	{ table_failsafe_procedure, sizeof(table_failsafe_procedure) / sizeof(char*) },
+	{ table_filter_type, sizeof(table_filter_type) / sizeof(char*) },
+	{ table_frsky_unit, sizeof(table_frsky_unit) / sizeof(char*) },
+	{ table_gps_dyn_model, sizeof(table_gps_dyn_model) / sizeof(char*) },
+	{ table_gps_provider, sizeof(table_gps_provider) / sizeof(char*) },
+	{ table_gps_sbas_mode, sizeof(table_gps_sbas_mode) / sizeof(char*) },
+	{ table_gyro_lpf, sizeof(table_gyro_lpf) / sizeof(char*) },
+	{ table_i2c_speed, sizeof(table_i2c_speed) / sizeof(char*) },
+	{ table_iterm_relax, sizeof(table_iterm_relax) / sizeof(char*) },
+	{ table_iterm_relax_type, sizeof(table_iterm_relax_type) / sizeof(char*) },
+	{ table_log_level, sizeof(table_log_level) / sizeof(char*) },
+	{ table_ltm_rates, sizeof(table_ltm_rates) / sizeof(char*) },
+	{ table_mag_hardware, sizeof(table_mag_hardware) / sizeof(char*) },
+	{ table_motor_pwm_protocol, sizeof(table_motor_pwm_protocol) / sizeof(char*) },
+	{ table_nav_extra_arming_safety, sizeof(table_nav_extra_arming_safety) / sizeof(char*) },
+	{ table_nav_rth_allow_landing, sizeof(table_nav_rth_allow_landing) / sizeof(char*) },
+	{ table_nav_rth_alt_mode, sizeof(table_nav_rth_alt_mode) / sizeof(char*) },
+	{ table_nav_user_control_mode, sizeof(table_nav_user_control_mode) / sizeof(char*) },
+	{ table_off_on, sizeof(table_off_on) / sizeof(char*) },
+	{ table_opflow_hardware, sizeof(table_opflow_hardware) / sizeof(char*) },
+	{ table_osd_ahi_style, sizeof(table_osd_ahi_style) / sizeof(char*) },
+	{ table_osd_alignment, sizeof(table_osd_alignment) / sizeof(char*) },
+	{ table_osd_crosshairs_style, sizeof(table_osd_crosshairs_style) / sizeof(char*) },
+	{ table_osd_sidebar_scroll, sizeof(table_osd_sidebar_scroll) / sizeof(char*) },
+	{ table_osd_stats_energy_unit, sizeof(table_osd_stats_energy_unit) / sizeof(char*) },
+	{ table_osd_unit, sizeof(table_osd_unit) / sizeof(char*) },
+	{ table_osd_video_system, sizeof(table_osd_video_system) / sizeof(char*) },
+	{ table_pidTypeTable, sizeof(table_pidTypeTable) / sizeof(char*) },
+	{ table_pitot_hardware, sizeof(table_pitot_hardware) / sizeof(char*) },
+	{ table_platform_type, sizeof(table_platform_type) / sizeof(char*) },
+	{ table_rangefinder_hardware, sizeof(table_rangefinder_hardware) / sizeof(char*) },
+	{ table_receiver_type, sizeof(table_receiver_type) / sizeof(char*) },
+	{ table_reset_type, sizeof(table_reset_type) / sizeof(char*) },
+	{ table_rssi_source, sizeof(table_rssi_source) / sizeof(char*) },
+	{ table_serial_rx, sizeof(table_serial_rx) / sizeof(char*) },
+	{ table_servo_protocol, sizeof(table_servo_protocol) / sizeof(char*) },
+	{ table_smartport_fuel_unit, sizeof(table_smartport_fuel_unit) / sizeof(char*) },
+	{ table_tz_automatic_dst, sizeof(table_tz_automatic_dst) / sizeof(char*) },
+	{ table_voltage_sensor, sizeof(table_voltage_sensor) / sizeof(char*) },
+	{ table_vtx_low_power_disarm, sizeof(table_vtx_low_power_disarm) / sizeof(char*) },
+};
+static const uint32_t settingMinMaxTable[] = {
+	0,
+	100,
+	200,
+	255,
+	1000,
+	1,
+	2000,
+	10,
+	500,
+	65535,
+	10000,
+	5,
+	32767,
+	-32768,
+	4,
+	8,
+	20,
+	30,
+	50,
+	5000,
+	-1800,
+	-550,
+	2,
+	3,
+	180,
+	3600,
+	65000,
+	4294967295,
+	80,
+	90,
+	250,
+	1250,
+	-20,
+	60,
+	120,
+	900,
+	8192,
+	16000,
+	60000,
+	2147483647,
+	-800,
+	6,
+	15,
+	16,
+	45,
+	450,
+	750,
+	800,
+	1500,
+	2250,
+	4000,
+	9999,
+	500000,
+	-18000,
+	-10000,
+	-1440,
+	-1000,
+	-180,
+	-90,
+	-40,
+	-2,
+	-1,
+	9,
+	11,
+	13,
+	18,
+	32,
+	40,
+	48,
+	126,
+	128,
+	150,
+	300,
+	359,
+	400,
+	498,
+	600,
+	1440,
+	3000,
+	9000,
+	9990,
+	18000,
+	20000,
+	32000,
+	50000,
+};
+typedef uint8_t setting_min_max_idx_t;
+#define SETTING_INDEXES_GET_MIN(val) (val->config.minmax.indexes[0])
+#define SETTING_INDEXES_GET_MAX(val) (val->config.minmax.indexes[1])
+static const setting_t settingsTable[] = {
+	// PG_GYRO_CONFIG
+	{ {148, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 79}, offsetof(gyroConfig_t, looptime) },
+	{ {6, 183, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, gyroSync) },
+	{ {170, 1, 191, 2, 147, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 15}, offsetof(gyroConfig_t, pidProcessDenom) },
+	{ {29, 6, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(gyroConfig_t, gyro_align) },
+	{ {6, 45, 27, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_LPF }, offsetof(gyroConfig_t, gyro_lpf) },
+	{ {6, 27, 17, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(gyroConfig_t, gyro_soft_lpf_hz) },
+	{ {6, 27, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_soft_lpf_type) },
+	{ {155, 2, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 70}, offsetof(gyroConfig_t, gyroMovementCalibrationThreshold) },
+	{ {6, 33, 17, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_notch_hz) },
+	{ {6, 33, 87, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 8}, offsetof(gyroConfig_t, gyro_notch_cutoff) },
+	{ {6, 181, 1, 165, 1, 17}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_stage2_lowpass_hz) },
+	{ {6, 181, 1, 165, 1, 19}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_stage2_lowpass_type) },
+	{ {57, 6, 33, 118, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, dynamicGyroNotchEnabled) },
+	{ {57, 6, 33, 99, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERRANGETABLE }, offsetof(gyroConfig_t, dynamicGyroNotchRange) },
+	{ {57, 6, 33, 193, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERANALYSERTABLE }, offsetof(gyroConfig_t, dynamicGyroNotchAnalyser) },
+	{ {57, 6, 33, 217, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 23}, offsetof(gyroConfig_t, dynamicGyroNotchCount) },
+	{ {57, 6, 33, 132, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 4}, offsetof(gyroConfig_t, dynamicGyroNotchQ) },
+	{ {57, 6, 33, 10, 17, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {17, 4}, offsetof(gyroConfig_t, dynamicGyroNotchMinHz) },
+	{ {6, 94, 118, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, kalmanEnabled) },
+	{ {6, 94, 132, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 37}, offsetof(gyroConfig_t, kalman_q) },
+	{ {6, 94, 20, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 67}, offsetof(gyroConfig_t, kalman_w) },
+	{ {6, 94, 206, 2, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 37}, offsetof(gyroConfig_t, kalman_sharpness) },
+	{ {6, 222, 2, 106, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(gyroConfig_t, gyro_to_use) },
+	// PG_ADC_CHANNEL_CONFIG
+	{ {50, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_BATTERY]) },
+	{ {64, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_RSSI]) },
+	{ {67, 79, 56, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_CURRENT]) },
+	{ {141, 1, 79, 56, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_AIRSPEED]) },
+	// PG_ACCELEROMETER_CONFIG
+	{ {21, 33, 17, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(accelerometerConfig_t, acc_notch_hz) },
+	{ {21, 33, 87, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 3}, offsetof(accelerometerConfig_t, acc_notch_cutoff) },
+	{ {29, 21, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(accelerometerConfig_t, acc_align) },
+	{ {21, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, offsetof(accelerometerConfig_t, acc_hardware) },
+	{ {21, 27, 17, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(accelerometerConfig_t, acc_lpf_hz) },
+	{ {21, 27, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(accelerometerConfig_t, acc_soft_lpf_type) },
+	{ {109, 107, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[X]) },
+	{ {109, 139, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Y]) },
+	{ {109, 12, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Z]) },
+	{ {108, 107, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 36}, offsetof(accelerometerConfig_t, accGain.raw[X]) },
+	{ {108, 139, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 36}, offsetof(accelerometerConfig_t, accGain.raw[Y]) },
+	{ {108, 12, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 36}, offsetof(accelerometerConfig_t, accGain.raw[Z]) },
+	// PG_RANGEFINDER_CONFIG
+	{ {177, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RANGEFINDER_HARDWARE }, offsetof(rangefinderConfig_t, rangefinder_hardware) },
+	{ {177, 1, 167, 1, 91, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rangefinderConfig_t, use_median_filtering) },
+	// PG_OPFLOW_CONFIG
+	{ {129, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OPFLOW_HARDWARE }, offsetof(opticalFlowConfig_t, opflow_hardware) },
+	{ {129, 1, 74, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(opticalFlowConfig_t, opflow_scale) },
+	{ {29, 129, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(opticalFlowConfig_t, opflow_align) },
+	// PG_COMPASS_CONFIG
+	{ {29, 32, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(compassConfig_t, mag_align) },
+	{ {32, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, offsetof(compassConfig_t, mag_hardware) },
+	{ {32, 227, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {53, 81}, offsetof(compassConfig_t, mag_declination) },
+	{ {127, 107, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[X]) },
+	{ {127, 139, 1, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Y]) },
+	{ {127, 12, 0, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Z]) },
+	{ {32, 206, 1, 28, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 34}, offsetof(compassConfig_t, magCalibrationTimeLimit) },
+	{ {29, 32, 18, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, rollDeciDegrees) },
+	{ {29, 32, 14, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, pitchDeciDegrees) },
+	{ {29, 32, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(compassConfig_t, yawDeciDegrees) },
+	// PG_BAROMETER_CONFIG
+	{ {42, 45, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, offsetof(barometerConfig_t, baro_hardware) },
+	{ {42, 167, 1, 91, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(barometerConfig_t, use_median_filtering) },
+	{ {42, 205, 1, 223, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(barometerConfig_t, baro_calibration_tolerance) },
+	// PG_PITOTMETER_CONFIG
+	{ {130, 1, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PITOT_HARDWARE }, offsetof(pitotmeterConfig_t, pitot_hardware) },
+	{ {130, 1, 27, 152, 2, 17}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(pitotmeterConfig_t, pitot_lpf_milli_hz) },
+	{ {130, 1, 74, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pitotmeterConfig_t, pitot_scale) },
+	// PG_RX_CONFIG
+	{ {194, 2, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RECEIVER_TYPE }, offsetof(rxConfig_t, receiverType) },
+	{ {10, 145, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(rxConfig_t, mincheck) },
+	{ {11, 145, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(rxConfig_t, maxcheck) },
+	{ {64, 213, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RSSI_SOURCE }, offsetof(rxConfig_t, rssi_source) },
+	{ {64, 56, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 65}, offsetof(rxConfig_t, rssi_channel) },
+	{ {64, 10, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMin) },
+	{ {64, 11, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMax) },
+	{ {204, 2, 183, 1, 160, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 10}, offsetof(rxConfig_t, sbusSyncInterval) },
+	{ {63, 91, 250, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rcFilterFrequency) },
+	{ {134, 1, 175, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERIAL_RX }, offsetof(rxConfig_t, serialrx_provider) },
+	{ {134, 1, 93, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, serialrx_inverted) },
+	{ {200, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(rxConfig_t, rx_spi_rf_channel_count) },
+	{ {180, 1, 10, 187, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {46, 49}, offsetof(rxConfig_t, rx_min_usec) },
+	{ {180, 1, 11, 187, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {46, 49}, offsetof(rxConfig_t, rx_max_usec) },
+	{ {134, 1, 122, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, halfDuplex) },
+	// PG_BLACKBOX_CONFIG
+	{ {82, 5, 170, 2, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, offsetof(blackboxConfig_t, rate_num) },
+	{ {82, 5, 147, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, offsetof(blackboxConfig_t, rate_denom) },
+	{ {82, 230, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, offsetof(blackboxConfig_t, device) },
+	{ {82, 212, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_COMPRESSION }, offsetof(blackboxConfig_t, compression) },
+	{ {205, 2, 116, 93, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(blackboxConfig_t, invertedCardDetection) },
+	// PG_MOTOR_CONFIG
+	{ {11, 49, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(motorConfig_t, maxthrottle) },
+	{ {10, 210, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 6}, offsetof(motorConfig_t, mincommand) },
+	{ {40, 131, 1, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 83}, offsetof(motorConfig_t, motorPwmRate) },
+	{ {40, 78, 28, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(motorConfig_t, motorAccelTimeMs) },
+	{ {40, 223, 1, 28, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(motorConfig_t, motorDecelTimeMs) },
+	{ {40, 131, 1, 174, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, offsetof(motorConfig_t, motorPwmProtocol) },
+	{ {49, 74, 0, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(motorConfig_t, throttleScale) },
+	{ {49, 126, 0, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {14, 17}, offsetof(motorConfig_t, throttleIdle) },
+	{ {40, 187, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {14, 3}, offsetof(motorConfig_t, motorPoleCount) },
+	// PG_FAILSAFE_CONFIG
+	{ {16, 44, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_delay) },
+	{ {16, 195, 2, 44, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_recovery_delay) },
+	{ {16, 171, 2, 44, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(failsafeConfig_t, failsafe_off_delay) },
+	{ {16, 49, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(failsafeConfig_t, failsafe_throttle) },
+	{ {16, 49, 71, 44, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 72}, offsetof(failsafeConfig_t, failsafe_throttle_low_delay) },
+	{ {16, 173, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_procedure) },
+	{ {16, 217, 2, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(failsafeConfig_t, failsafe_stick_motion_threshold) },
+	{ {16, 2, 18, 24, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {40, 47}, offsetof(failsafeConfig_t, failsafe_fw_roll_angle) },
+	{ {16, 2, 14, 24, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {40, 47}, offsetof(failsafeConfig_t, failsafe_fw_pitch_angle) },
+	{ {16, 2, 8, 5, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {56, 4}, offsetof(failsafeConfig_t, failsafe_fw_yaw_rate) },
+	{ {16, 10, 69, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(failsafeConfig_t, failsafe_min_distance) },
+	{ {16, 10, 69, 173, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_min_distance_procedure) },
+	{ {16, 153, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(failsafeConfig_t, failsafe_mission) },
+	// PG_BOARD_ALIGNMENT
+	{ {29, 113, 18, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, rollDeciDegrees) },
+	{ {29, 113, 14, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, pitchDeciDegrees) },
+	{ {29, 113, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {20, 25}, offsetof(boardAlignment_t, yawDeciDegrees) },
+	// PG_BATTERY_METERS_CONFIG
+	{ {50, 96, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_SENSOR }, offsetof(batteryMetersConfig_t, voltage.type) },
+	{ {50, 74, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, voltage.scale) },
+	{ {67, 96, 74, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {54, 10}, offsetof(batteryMetersConfig_t, current.scale) },
+	{ {67, 96, 62, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(batteryMetersConfig_t, current.offset) },
+	{ {67, 96, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_SENSOR }, offsetof(batteryMetersConfig_t, current.type) },
+	{ {143, 1, 52, 215, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_VOLTAGE_SOURCE }, offsetof(batteryMetersConfig_t, voltageSource) },
+	{ {86, 73, 0, 0, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryMetersConfig_t, cruise_power) },
+	{ {126, 73, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, idle_power) },
+	{ {31, 119, 128, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(batteryMetersConfig_t, rth_energy_margin) },
+	{ {37, 211, 1, 238, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryMetersConfig_t, throttle_compensation_weight) },
+	// PG_BATTERY_PROFILES
+	{ {143, 1, 207, 1, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 15}, offsetof(batteryProfile_t, cells) },
+	{ {50, 65, 116, 52, 0, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellDetect) },
+	{ {50, 11, 65, 52, 0, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMax) },
+	{ {50, 10, 65, 52, 0, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMin) },
+	{ {50, 188, 1, 65, 52, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellWarning) },
+	{ {81, 84, 0, 0, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.value) },
+	{ {81, 84, 188, 1, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.warning) },
+	{ {81, 84, 218, 1, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 27}, offsetof(batteryProfile_t, capacity.critical) },
+	{ {81, 84, 105, 0, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_CAPACITY_UNIT }, offsetof(batteryProfile_t, capacity.unit) },
+	// PG_MIXER_CONFIG
+	{ {40, 117, 93, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, motorDirectionInverted) },
+	{ {186, 2, 19, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PLATFORM_TYPE }, offsetof(mixerConfig_t, platformType) },
+	{ {131, 2, 247, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, hasFlaps) },
+	{ {168, 1, 190, 2, 19, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {61, 12}, offsetof(mixerConfig_t, appliedMixerPreset) },
+	{ {2, 10, 49, 235, 1, 14}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 45}, offsetof(mixerConfig_t, fwMinThrottleDownPitchAngle) },
+	// PG_REVERSIBLE_MOTORS_CONFIG
+	{ {77, 38, 71, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(reversibleMotorsConfig_t, deadband_low) },
+	{ {77, 38, 157, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(reversibleMotorsConfig_t, deadband_high) },
+	{ {77, 169, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(reversibleMotorsConfig_t, neutral) },
+	// PG_SERVO_CONFIG
+	{ {75, 174, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERVO_PROTOCOL }, offsetof(servoConfig_t, servo_protocol) },
+	{ {75, 208, 1, 192, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(servoConfig_t, servoCenterPulse) },
+	{ {75, 131, 1, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 75}, offsetof(servoConfig_t, servoPwmRate) },
+	{ {75, 27, 17, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {0, 74}, offsetof(servoConfig_t, servo_lowpass_freq) },
+	{ {246, 1, 184, 1, 62, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 45}, offsetof(servoConfig_t, flaperon_throw_offset) },
+	{ {225, 2, 227, 2, 75, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(servoConfig_t, tri_unarmed_servo) },
+	// PG_CONTROL_RATE_PROFILES
+	{ {37, 151, 2, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcMid8) },
+	{ {37, 58, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcExpo8) },
+	{ {137, 1, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.dynPID) },
+	{ {137, 1, 204, 1, 0, 0}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {4, 6}, offsetof(controlRateConfig_t, throttle.pa_breakpoint) },
+	{ {2, 137, 1, 28, 214, 1}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 19}, offsetof(controlRateConfig_t, throttle.fixedWingTauMs) },
+	{ {63, 58, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcExpo8) },
+	{ {63, 8, 58, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcYawExpo8) },
+	{ {18, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {41, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_ROLL]) },
+	{ {14, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {41, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_PITCH]) },
+	{ {8, 5, 0, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {22, 24}, offsetof(controlRateConfig_t, stabilized.rates[FD_YAW]) },
+	{ {47, 63, 58, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcExpo8) },
+	{ {47, 63, 8, 58, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcYawExpo8) },
+	{ {47, 18, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_ROLL]) },
+	{ {47, 14, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_PITCH]) },
+	{ {47, 8, 5, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_YAW]) },
+	{ {249, 1, 154, 2, 229, 1}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 18}, offsetof(controlRateConfig_t, misc.fpvCamAngleDegrees) },
+	// PG_SERIAL_CONFIG
+	{ {193, 2, 209, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {68, 69}, offsetof(serialConfig_t, reboot_character) },
+	// PG_IMU_CONFIG
+	{ {39, 88, 162, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_acc) },
+	{ {39, 88, 161, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_acc) },
+	{ {39, 88, 162, 1, 32, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_mag) },
+	{ {39, 88, 161, 1, 32, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_mag) },
+	{ {210, 2, 24, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 24}, offsetof(imuConfig_t, small_angle) },
+	{ {39, 21, 158, 1, 5, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 16}, offsetof(imuConfig_t, acc_ignore_rate) },
+	{ {39, 21, 158, 1, 209, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(imuConfig_t, acc_ignore_slope) },
+	// PG_ARMING_CONFIG
+	{ {244, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, fixed_wing_auto_arm) },
+	{ {68, 141, 2, 102, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, disarm_kill_switch) },
+	{ {102, 68, 44, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(armingConfig_t, switchDisarmDelayMs) },
+	// PG_GENERAL_SETTINGS
+	{ {194, 1, 228, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 23}, offsetof(generalSettings_t, appliedDefaults) },
+	// PG_RPM_FILTER_CONFIG
+	{ {100, 6, 91, 118, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rpmFilterConfig_t, gyro_filter_enabled) },
+	{ {100, 6, 130, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 23}, offsetof(rpmFilterConfig_t, gyro_harmonics) },
+	{ {100, 6, 10, 17, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 2}, offsetof(rpmFilterConfig_t, gyro_min_hz) },
+	{ {100, 6, 132, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 78}, offsetof(rpmFilterConfig_t, gyro_q) },
+	// PG_GPS_CONFIG
+	{ {25, 175, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_PROVIDER }, offsetof(gpsConfig_t, provider) },
+	{ {25, 203, 2, 61, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_SBAS_MODE }, offsetof(gpsConfig_t, sbasMode) },
+	{ {25, 237, 1, 168, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_DYN_MODEL }, offsetof(gpsConfig_t, dynModel) },
+	{ {25, 55, 213, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoConfig) },
+	{ {25, 55, 197, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoBaud) },
+	{ {25, 226, 2, 106, 129, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, ubloxUseGalileo) },
+	{ {25, 10, 202, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 7}, offsetof(gpsConfig_t, gpsMinSats) },
+	// PG_RC_CONTROLS_CONFIG
+	{ {38, 0, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 66}, offsetof(rcControlsConfig_t, deadband) },
+	{ {8, 38, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rcControlsConfig_t, yaw_deadband) },
+	{ {15, 125, 38, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {22, 30}, offsetof(rcControlsConfig_t, pos_hold_deadband) },
+	{ {80, 125, 38, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 30}, offsetof(rcControlsConfig_t, alt_hold_deadband) },
+	{ {77, 38, 49, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(rcControlsConfig_t, mid_throttle_deadband) },
+	{ {3, 140, 1, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AIRMODEHANDLINGTYPE }, offsetof(rcControlsConfig_t, airmodeHandlingType) },
+	{ {3, 140, 1, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(rcControlsConfig_t, airmodeThrottleThreshold) },
+	// PG_PID_PROFILE
+	{ {3, 7, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].P) },
+	{ {3, 22, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].I) },
+	{ {3, 30, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].D) },
+	{ {3, 85, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].FF) },
+	{ {3, 7, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].P) },
+	{ {3, 22, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].I) },
+	{ {3, 30, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].D) },
+	{ {3, 85, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].FF) },
+	{ {3, 7, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].P) },
+	{ {3, 22, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].I) },
+	{ {3, 30, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].D) },
+	{ {3, 85, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].FF) },
+	{ {3, 7, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].P) },
+	{ {3, 22, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].I) },
+	{ {3, 30, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].D) },
+	{ {2, 7, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].P) },
+	{ {2, 22, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].I) },
+	{ {2, 90, 14, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].FF) },
+	{ {2, 7, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].P) },
+	{ {2, 22, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].I) },
+	{ {2, 90, 18, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].FF) },
+	{ {2, 7, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].P) },
+	{ {2, 22, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].I) },
+	{ {2, 90, 8, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].FF) },
+	{ {2, 7, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].P) },
+	{ {2, 22, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].I) },
+	{ {2, 30, 46, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].D) },
+	{ {11, 24, 159, 1, 198, 2}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 35}, offsetof(pidProfile_t, max_angle_inclination[FD_ROLL]) },
+	{ {11, 24, 159, 1, 172, 1}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 35}, offsetof(pidProfile_t, max_angle_inclination[FD_PITCH]) },
+	{ {89, 27, 17, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf_hz) },
+	{ {89, 27, 19, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf_type) },
+	{ {89, 166, 1, 17, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf2_hz) },
+	{ {89, 166, 1, 19, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf2_type) },
+	{ {8, 27, 17, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, yaw_lpf_hz) },
+	{ {2, 70, 184, 1, 60, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, fixedWingItermThrowLimit) },
+	{ {2, 164, 1, 117, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DIRECTION }, offsetof(pidProfile_t, loiter_direction) },
+	{ {2, 196, 2, 141, 1, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 19}, offsetof(pidProfile_t, fixedWingReferenceAirspeed) },
+	{ {255, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 22}, offsetof(pidProfile_t, fixedWingCoordinatedYawGain) },
+	{ {254, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, fixedWingItermLimitOnStickPosition) },
+	{ {171, 1, 60, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 4}, offsetof(pidProfile_t, pidSumLimit) },
+	{ {171, 1, 60, 8, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 4}, offsetof(pidProfile_t, pidSumLimitYaw) },
+	{ {70, 239, 2, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 29}, offsetof(pidProfile_t, itermWindupPointPercent) },
+	{ {5, 78, 60, 18, 14, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 52}, offsetof(pidProfile_t, axisAccelerationLimitRollPitch) },
+	{ {5, 78, 60, 8, 0, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 52}, offsetof(pidProfile_t, axisAccelerationLimitYaw) },
+	{ {124, 125, 5, 60, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 30}, offsetof(pidProfile_t, heading_hold_rate_limit) },
+	{ {1, 3, 15, 12, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_Z].P) },
+	{ {1, 3, 51, 12, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].P) },
+	{ {1, 3, 51, 12, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].I) },
+	{ {1, 3, 51, 12, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].D) },
+	{ {1, 3, 15, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_XY].P) },
+	{ {1, 3, 51, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].P) },
+	{ {1, 3, 51, 23, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].I) },
+	{ {1, 3, 51, 23, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].D) },
+	{ {1, 3, 51, 23, 90, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].FF) },
+	{ {1, 3, 124, 7, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_HEADING].P) },
+	{ {165, 2, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidProfile_t, navVelXyDTermLpfHz) },
+	{ {1, 2, 15, 12, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].P) },
+	{ {1, 2, 15, 12, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].I) },
+	{ {1, 2, 15, 12, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].D) },
+	{ {1, 2, 15, 23, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].P) },
+	{ {1, 2, 15, 23, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].I) },
+	{ {1, 2, 15, 23, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].D) },
+	{ {1, 2, 124, 7, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_HEADING].P) },
+	{ {1, 2, 15, 123, 7, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].P) },
+	{ {1, 2, 15, 123, 22, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].I) },
+	{ {1, 2, 15, 123, 30, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].D) },
+	{ {160, 2, 0, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 4}, offsetof(pidProfile_t, navFwPosHdgPidsumLimit) },
+	{ {3, 70, 133, 1, 19, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX_TYPE }, offsetof(pidProfile_t, iterm_relax_type) },
+	{ {3, 70, 133, 1, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX }, offsetof(pidProfile_t, iterm_relax) },
+	{ {3, 70, 133, 1, 87, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 1}, offsetof(pidProfile_t, iterm_relax_cutoff) },
+	{ {30, 83, 152, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 23}, offsetof(pidProfile_t, dBoostFactor) },
+	{ {221, 1, 0, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {4, 37}, offsetof(pidProfile_t, dBoostMaxAtAlleceleration) },
+	{ {220, 1, 0, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 30}, offsetof(pidProfile_t, dBoostGyroDeltaLpfHz) },
+	{ {110, 128, 2, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 16}, offsetof(pidProfile_t, antigravityGain) },
+	{ {110, 190, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 16}, offsetof(pidProfile_t, antigravityAccelerator) },
+	{ {110, 87, 27, 17, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 17}, offsetof(pidProfile_t, antigravityCutoff) },
+	{ {170, 1, 19, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PIDTYPETABLE }, offsetof(pidProfile_t, pidControllerType) },
+	{ {3, 85, 27, 17, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, offsetof(pidProfile_t, controlDerivativeLpfHz) },
+	// PG_PID_AUTOTUNE_CONFIG
+	{ {2, 111, 183, 2, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 8}, offsetof(pidAutotuneConfig_t, fw_overshoot_time) },
+	{ {2, 111, 228, 2, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 8}, offsetof(pidAutotuneConfig_t, fw_undershoot_time) },
+	{ {2, 111, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_max_rate_threshold) },
+	{ {253, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_ff_to_p_gain) },
+	{ {252, 1, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 19}, offsetof(pidAutotuneConfig_t, fw_ff_to_i_time_constant) },
+	// PG_POSITION_ESTIMATION_CONFIG
+	{ {9, 55, 32, 226, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, automatic_mag_declination) },
+	{ {140, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(positionEstimationConfig_t, gravity_calibration_tolerance) },
+	{ {9, 106, 25, 233, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, use_gps_velned) },
+	{ {139, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, allow_dead_reckoning) },
+	{ {9, 179, 1, 54, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_altitude_type) },
+	{ {9, 179, 1, 92, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_home_type) },
+	{ {9, 11, 135, 1, 54, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(positionEstimationConfig_t, max_surface_altitude) },
+	{ {9, 20, 12, 135, 1, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_p) },
+	{ {9, 20, 12, 135, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_v) },
+	{ {9, 20, 23, 154, 1, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_p) },
+	{ {9, 20, 23, 154, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_v) },
+	{ {9, 20, 12, 42, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_baro_p) },
+	{ {9, 20, 12, 25, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_p) },
+	{ {9, 20, 12, 25, 41, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_v) },
+	{ {9, 20, 23, 25, 7, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_p) },
+	{ {9, 20, 23, 25, 41, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_v) },
+	{ {9, 20, 12, 178, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_res_v) },
+	{ {9, 20, 23, 178, 1, 41}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_res_v) },
+	{ {9, 20, 240, 2, 21, 7}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(positionEstimationConfig_t, w_xyz_acc_p) },
+	{ {9, 20, 21, 199, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(positionEstimationConfig_t, w_acc_bias) },
+	{ {9, 11, 239, 1, 150, 1}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 51}, offsetof(positionEstimationConfig_t, max_eph_epv) },
+	{ {9, 42, 150, 1, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 51}, offsetof(positionEstimationConfig_t, baro_epv) },
+	// PG_NAV_CONFIG
+	{ {1, 68, 172, 2, 95, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.disarm_on_landing) },
+	{ {167, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.use_thr_mid_for_althold) },
+	{ {157, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_EXTRA_ARMING_SAFETY }, offsetof(navConfig_t, general.flags.extra_arming_safety) },
+	{ {1, 232, 2, 115, 61, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_USER_CONTROL_MODE }, offsetof(navConfig_t, general.flags.user_control_mode) },
+	{ {1, 188, 2, 104, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(navConfig_t, general.pos_failure_timeout) },
+	{ {1, 138, 1, 176, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 10}, offsetof(navConfig_t, general.waypoint_radius) },
+	{ {1, 138, 1, 201, 2, 69}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.waypoint_safe_distance) },
+	{ {1, 55, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_speed) },
+	{ {1, 55, 66, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_climb_rate) },
+	{ {1, 47, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_speed) },
+	{ {1, 47, 66, 5, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_climb_rate) },
+	{ {1, 95, 36, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.land_descent_rate) },
+	{ {162, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {18, 4}, offsetof(navConfig_t, general.land_slowdown_minalt) },
+	{ {161, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 50}, offsetof(navConfig_t, general.land_slowdown_maxalt) },
+	{ {1, 238, 1, 95, 36, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.emerg_descent_rate) },
+	{ {1, 10, 31, 69, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, general.min_rth_distance) },
+	{ {1, 182, 2, 40, 218, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.auto_overrides_motor_stop) },
+	{ {1, 31, 66, 153, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_first) },
+	{ {166, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_ignore_emerg) },
+	{ {1, 31, 220, 2, 153, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_tail_first) },
+	{ {1, 31, 192, 1, 95, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALLOW_LANDING }, offsetof(navConfig_t, general.flags.rth_allow_landing) },
+	{ {1, 31, 80, 61, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALT_MODE }, offsetof(navConfig_t, general.flags.rth_alt_control_mode) },
+	{ {1, 31, 189, 1, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_abort_threshold) },
+	{ {163, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, general.max_terrain_follow_altitude) },
+	{ {1, 31, 54, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_altitude) },
+	{ {1, 31, 92, 54, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_home_altitude) },
+	{ {1, 31, 92, 62, 69, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 26}, offsetof(navConfig_t, general.rth_home_offset_distance) },
+	{ {1, 31, 92, 62, 117, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 73}, offsetof(navConfig_t, general.rth_home_offset_direction) },
+	{ {1, 3, 112, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {42, 44}, offsetof(navConfig_t, mc.max_bank_angle) },
+	{ {1, 3, 136, 2, 37, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, mc.hover_throttle) },
+	{ {1, 3, 55, 68, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 10}, offsetof(navConfig_t, mc.auto_disarm_delay) },
+	{ {1, 3, 43, 36, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, mc.braking_speed_threshold) },
+	{ {1, 3, 43, 232, 1, 36}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, mc.braking_disengage_speed) },
+	{ {1, 3, 43, 104, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 19}, offsetof(navConfig_t, mc.braking_timeout) },
+	{ {1, 3, 43, 83, 152, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, mc.braking_boost_factor) },
+	{ {1, 3, 43, 83, 104, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, mc.braking_boost_timeout) },
+	{ {1, 3, 43, 83, 36, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 4}, offsetof(navConfig_t, mc.braking_boost_speed_threshold) },
+	{ {164, 2, 0, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, mc.braking_boost_disengage_speed) },
+	{ {1, 3, 43, 112, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {42, 33}, offsetof(navConfig_t, mc.braking_bank_angle) },
+	{ {1, 3, 15, 224, 1, 28}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.posDecelerationTime) },
+	{ {1, 3, 15, 58, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.posResponseExpo) },
+	{ {1, 2, 86, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, fw.cruise_throttle) },
+	{ {1, 2, 10, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, fw.min_throttle) },
+	{ {1, 2, 11, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, fw.max_throttle) },
+	{ {1, 2, 112, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_bank_angle) },
+	{ {1, 2, 66, 24, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_climb_angle) },
+	{ {1, 2, 234, 1, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 28}, offsetof(navConfig_t, fw.max_dive_angle) },
+	{ {1, 2, 185, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(navConfig_t, fw.pitch_to_throttle) },
+	{ {1, 2, 164, 1, 176, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(navConfig_t, fw.loiter_radius) },
+	{ {1, 2, 86, 36, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(navConfig_t, fw.cruise_speed) },
+	{ {1, 2, 115, 212, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 62}, offsetof(navConfig_t, fw.control_smoothness) },
+	{ {159, 2, 0, 0, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(navConfig_t, fw.land_dive_angle) },
+	{ {1, 2, 26, 234, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 10}, offsetof(navConfig_t, fw.launch_velocity_thresh) },
+	{ {1, 2, 26, 78, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 82}, offsetof(navConfig_t, fw.launch_accel_thresh) },
+	{ {1, 2, 26, 11, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 24}, offsetof(navConfig_t, fw.launch_max_angle) },
+	{ {1, 2, 26, 116, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 4}, offsetof(navConfig_t, fw.launch_time_thresh) },
+	{ {1, 2, 26, 37, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, fw.launch_throttle) },
+	{ {1, 2, 26, 126, 37, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {4, 6}, offsetof(navConfig_t, fw.launch_idle_throttle) },
+	{ {1, 2, 26, 40, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(navConfig_t, fw.launch_motor_timer) },
+	{ {1, 2, 26, 214, 2, 28}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, fw.launch_motor_spinup_time) },
+	{ {1, 2, 26, 10, 28, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_min_time) },
+	{ {1, 2, 26, 104, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_timeout) },
+	{ {1, 2, 26, 11, 54, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(navConfig_t, fw.launch_max_altitude) },
+	{ {1, 2, 26, 66, 24, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {11, 44}, offsetof(navConfig_t, fw.launch_climb_angle) },
+	{ {1, 2, 86, 8, 5, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, offsetof(navConfig_t, fw.cruise_yaw_rate) },
+	{ {158, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.allow_manual_thr_increase) },
+	{ {1, 106, 2, 8, 115, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.useFwNavYawControl) },
+	{ {1, 2, 8, 38, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 29}, offsetof(navConfig_t, fw.yawControlDeadband) },
+	// PG_TELEMETRY_CONFIG
+	{ {103, 102, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_switch) },
+	{ {103, 93, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_inverted) },
+	{ {59, 146, 1, 143, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {58, 29}, offsetof(telemetryConfig_t, gpsNoFixLatitude) },
+	{ {59, 146, 1, 147, 2, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {57, 24}, offsetof(telemetryConfig_t, gpsNoFixLongitude) },
+	{ {59, 216, 1, 248, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, frsky_coordinate_format) },
+	{ {59, 105, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FRSKY_UNIT }, offsetof(telemetryConfig_t, frsky_unit) },
+	{ {59, 235, 2, 189, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, frsky_vfas_precision) },
+	{ {59, 14, 18, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, frsky_pitch_roll) },
+	{ {197, 2, 65, 52, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, report_cell_voltage) },
+	{ {135, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 34}, offsetof(telemetryConfig_t, hottAlarmSoundInterval) },
+	{ {103, 122, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, halfDuplex) },
+	{ {211, 2, 251, 1, 105, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SMARTPORT_FUEL_UNIT }, offsetof(telemetryConfig_t, smartportFuelUnit) },
+	{ {138, 2, 103, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, ibusTelemetryType) },
+	{ {149, 2, 230, 2, 5, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LTM_RATES }, offsetof(telemetryConfig_t, ltmUpdateRate) },
+	{ {208, 2, 0, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 43}, offsetof(telemetryConfig_t, simGroundStationNumber) },
+	{ {101, 184, 2, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(telemetryConfig_t, simPin) },
+	{ {101, 185, 1, 160, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 9}, offsetof(telemetryConfig_t, simTransmitInterval) },
+	{ {101, 185, 1, 245, 1, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(telemetryConfig_t, simTransmitFlags) },
+	{ {21, 120, 34, 157, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdHigh) },
+	{ {21, 120, 34, 71, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 35}, offsetof(telemetryConfig_t, accEventThresholdLow) },
+	{ {21, 120, 34, 169, 1, 107}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdNegX) },
+	{ {101, 71, 54, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(telemetryConfig_t, simLowAltitude) },
+	{ {72, 241, 1, 216, 2, 5}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, mavlink.extended_status_rate) },
+	{ {72, 63, 144, 1, 5, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, mavlink.rc_channels_rate) },
+	{ {72, 15, 5, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, mavlink.position_rate) },
+	{ {72, 242, 1, 5, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, mavlink.extra1_rate) },
+	{ {72, 243, 1, 5, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(telemetryConfig_t, mavlink.extra2_rate) },
+	// PG_LED_STRIP_CONFIG
+	{ {145, 2, 237, 2, 198, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(ledStripConfig_t, ledstrip_visual_beeper) },
+	// PG_OSD_CONFIG
+	{ {4, 236, 2, 219, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_VIDEO_SYSTEM }, offsetof(osdConfig_t, video_system) },
+	{ {4, 199, 2, 207, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(osdConfig_t, row_shiftdown) },
+	{ {4, 229, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_UNIT }, offsetof(osdConfig_t, units) },
+	{ {4, 76, 119, 105, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_STATS_ENERGY_UNIT }, offsetof(osdConfig_t, stats_energy_unit) },
+	{ {4, 64, 13, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(osdConfig_t, rssi_alarm) },
+	{ {4, 28, 13, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 76}, offsetof(osdConfig_t, time_alarm) },
+	{ {4, 80, 13, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(osdConfig_t, alt_alarm) },
+	{ {4, 149, 1, 13, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 84}, offsetof(osdConfig_t, dist_alarm) },
+	{ {4, 169, 1, 80, 13, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(osdConfig_t, neg_alt_alarm) },
+	{ {4, 67, 13, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(osdConfig_t, current_alarm) },
+	{ {4, 121, 13, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 16}, offsetof(osdConfig_t, gforce_alarm) },
+	{ {4, 121, 142, 1, 13, 10}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(osdConfig_t, gforce_axis_alarm_min) },
+	{ {4, 121, 142, 1, 13, 11}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {32, 16}, offsetof(osdConfig_t, gforce_axis_alarm_max) },
+	{ {4, 39, 48, 13, 10, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, imu_temp_alarm_min) },
+	{ {4, 39, 48, 13, 11, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, imu_temp_alarm_max) },
+	{ {4, 151, 1, 48, 13, 11}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 48}, offsetof(osdConfig_t, esc_temp_alarm_max) },
+	{ {4, 151, 1, 48, 13, 10}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 48}, offsetof(osdConfig_t, esc_temp_alarm_min) },
+	{ {4, 42, 48, 13, 10, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, baro_temp_alarm_min) },
+	{ {4, 42, 48, 13, 11, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {21, 31}, offsetof(osdConfig_t, baro_temp_alarm_max) },
+	{ {4, 48, 142, 2, 29, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_ALIGNMENT }, offsetof(osdConfig_t, temp_label_align) },
+	{ {175, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, ahi_reverse_roll) },
+	{ {174, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 29}, offsetof(osdConfig_t, ahi_max_pitch) },
+	{ {4, 219, 1, 182, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_CROSSHAIRS_STYLE }, offsetof(osdConfig_t, crosshairs_style) },
+	{ {4, 134, 2, 62, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {60, 22}, offsetof(osdConfig_t, horizon_offset) },
+	{ {4, 114, 231, 2, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {59, 28}, offsetof(osdConfig_t, camera_uptilt) },
+	{ {4, 114, 155, 1, 156, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {33, 71}, offsetof(osdConfig_t, camera_fov_h) },
+	{ {4, 114, 155, 1, 41, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 34}, offsetof(osdConfig_t, camera_fov_v) },
+	{ {4, 35, 128, 1, 156, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(osdConfig_t, hud_margin_h) },
+	{ {4, 35, 128, 1, 41, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 23}, offsetof(osdConfig_t, hud_margin_v) },
+	{ {4, 35, 133, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, hud_homing) },
+	{ {4, 35, 132, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, hud_homepoint) },
+	{ {4, 35, 98, 148, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 14}, offsetof(osdConfig_t, hud_radar_disp) },
+	{ {4, 35, 98, 99, 10, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 17}, offsetof(osdConfig_t, hud_radar_range_min) },
+	{ {4, 35, 98, 99, 11, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 80}, offsetof(osdConfig_t, hud_radar_range_max) },
+	{ {4, 35, 98, 168, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 50}, offsetof(osdConfig_t, hud_radar_nearest) },
+	{ {4, 35, 138, 1, 148, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 23}, offsetof(osdConfig_t, hud_wp_disp) },
+	{ {177, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_SIDEBAR_SCROLL }, offsetof(osdConfig_t, left_sidebar_scroll) },
+	{ {179, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_SIDEBAR_SCROLL }, offsetof(osdConfig_t, right_sidebar_scroll) },
+	{ {180, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, sidebar_scroll_arrows) },
+	{ {4, 150, 2, 52, 225, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 22}, offsetof(osdConfig_t, main_voltage_decimals) },
+	{ {4, 215, 1, 231, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {15, 63}, offsetof(osdConfig_t, coordinate_digits) },
+	{ {176, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, estimations_wind_compensation) },
+	{ {4, 16, 102, 144, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(osdConfig_t, osd_failsafe_switch_layout) },
+	{ {178, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 64}, offsetof(osdConfig_t, plus_code_digits) },
+	{ {4, 191, 1, 182, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OSD_AHI_STYLE }, offsetof(osdConfig_t, osd_ahi_style) },
+	// PG_SYSTEM_CONFIG
+	{ {137, 2, 36, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_I2C_SPEED }, offsetof(systemConfig_t, i2c_speed) },
+	{ {222, 1, 61, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG_MODES }, offsetof(systemConfig_t, debug_mode) },
+	{ {221, 2, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(systemConfig_t, throttle_tilt_compensation_strength) },
+	{ {156, 2, 0, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 43}, offsetof(systemConfig_t, name) },
+	// PG_MODE_ACTIVATION_OPERATOR_CONFIG
+	{ {61, 99, 146, 2, 173, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AUX_OPERATOR }, offsetof(modeActivationOperatorConfig_t, modeActivationOperator) },
+	// PG_STATS_CONFIG
+	{ {76, 0, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(statsConfig_t, stats_enabled) },
+	{ {76, 136, 1, 28, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_time) },
+	{ {76, 136, 1, 149, 1, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_dist) },
+	{ {76, 136, 1, 119, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, offsetof(statsConfig_t, stats_total_energy) },
+	// PG_TIME_CONFIG
+	{ {186, 1, 62, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {55, 77}, offsetof(timeConfig_t, tz_offset) },
+	{ {186, 1, 195, 1, 236, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_TZ_AUTOMATIC_DST }, offsetof(timeConfig_t, tz_automatic_dst) },
+	// PG_DISPLAY_CONFIG
+	{ {233, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(displayConfig_t, force_sw_blink) },
+	// PG_VTX_CONFIG
+	{ {53, 122, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(vtxConfig_t, halfDuplex) },
+	// PG_VTX_SETTINGS_CONFIG
+	{ {53, 196, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(vtxSettingsConfig_t, band) },
+	{ {53, 56, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 15}, offsetof(vtxSettingsConfig_t, channel) },
+	{ {53, 73, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 11}, offsetof(vtxSettingsConfig_t, power) },
+	{ {53, 71, 73, 68, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VTX_LOW_POWER_DISARM }, offsetof(vtxSettingsConfig_t, lowPowerDisarm) },
+	{ {53, 172, 1, 61, 144, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 15}, offsetof(vtxSettingsConfig_t, pitModeChan) },
+	{ {53, 11, 73, 181, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(vtxSettingsConfig_t, maxPowerOverride) },
+	// PG_PINIOBOX_CONFIG
+	{ {97, 200, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pinioBoxConfig_t, permanentId[0]) },
+	{ {97, 201, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pinioBoxConfig_t, permanentId[1]) },
+	{ {97, 202, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pinioBoxConfig_t, permanentId[2]) },
+	{ {97, 203, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pinioBoxConfig_t, permanentId[3]) },
+	// PG_LOG_CONFIG
+	{ {163, 1, 46, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOG_LEVEL }, offsetof(logConfig_t, level) },
+	{ {163, 1, 224, 2, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, offsetof(logConfig_t, topics) },
+	// PG_ESC_SENSOR_CONFIG
+	{ {240, 1, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(escSensorConfig_t, listenOnly) },
+};
+#define SETTING_NAME_HASH_BUCKETS 175
+static const uint8_t settingNameHashSeeds[] = {
+	8, 1, 27, 1, 10, 26, 4, 4, 36, 0, 1, 1, 68, 3, 1, 1,
+	18, 5, 24, 18, 1, 9, 38, 4, 11, 2, 10, 8, 1, 45, 25, 7,
+	7, 7, 5, 2, 2, 42, 1, 10, 6, 5, 66, 14, 2, 33, 1, 0,
+	41, 0, 46, 18, 4, 3, 9, 67, 4, 62, 2, 0, 1, 4, 26, 1,
+	1, 2, 13, 8, 3, 1, 12, 55, 11, 29, 25, 49, 12, 19, 22, 19,
+	36, 0, 22, 19, 5, 14, 0, 26, 15, 1, 11, 50, 1, 29, 2, 25,
+	14, 0, 1, 29, 0, 65, 4, 79, 12, 63, 8, 86, 10, 0, 11, 1,
+	0, 7, 14, 1, 0, 2, 154, 15, 7, 13, 12, 26, 14, 102, 20, 1,
+	10, 155, 3, 76, 74, 17, 4, 1, 1, 1, 0, 6, 76, 85, 6, 6,
+	25, 11, 132, 3, 1, 3, 24, 46, 1, 50, 102, 11, 40, 12, 20, 6,
+	5, 4, 2, 143, 12, 16, 246, 50, 11, 155, 31, 35, 14, 61, 59,
+};
+static const uint16_t settingNameHashIndexes[] = {
+	246, 280, 176, 17, 317, 433, 270, 379, 238, 161, 392, 111, 403, 55, 282, 185,
+	109, 171, 3, 306, 179, 243, 319, 112, 448, 73, 198, 94, 96, 385, 254, 157,
+	335, 455, 81, 137, 284, 186, 348, 174, 441, 223, 207, 453, 121, 237, 83, 292,
+	437, 126, 110, 365, 294, 133, 130, 202, 15, 318, 31, 127, 233, 153, 103, 125,
+	128, 143, 291, 219, 52, 1, 286, 276, 230, 32, 396, 325, 339, 411, 387, 256,
+	374, 422, 205, 156, 355, 170, 272, 64, 135, 363, 290, 160, 298, 120, 141, 63,
+	372, 92, 62, 47, 82, 425, 397, 164, 201, 138, 417, 70, 22, 382, 344, 106,
+	452, 214, 240, 93, 97, 187, 412, 5, 9, 49, 326, 300, 203, 389, 217, 346,
+	11, 283, 167, 78, 418, 218, 364, 175, 393, 216, 297, 102, 429, 342, 266, 349,
+	275, 221, 308, 190, 182, 91, 410, 447, 65, 229, 324, 440, 58, 424, 285, 80,
+	204, 151, 145, 36, 74, 0, 250, 178, 391, 85, 358, 38, 144, 378, 443, 44,
+	350, 84, 26, 255, 46, 408, 124, 347, 232, 208, 434, 316, 231, 210, 211, 39,
+	340, 173, 199, 296, 118, 129, 162, 399, 245, 419, 195, 228, 368, 247, 446, 236,
+	101, 414, 75, 61, 331, 327, 142, 154, 323, 227, 40, 33, 444, 357, 212, 76,
+	235, 369, 131, 16, 261, 407, 107, 158, 293, 421, 18, 53, 337, 10, 181, 6,
+	343, 116, 20, 375, 428, 413, 72, 12, 274, 148, 104, 405, 264, 423, 215, 277,
+	159, 278, 310, 304, 432, 183, 56, 257, 366, 253, 122, 77, 313, 90, 71, 139,
+	328, 242, 241, 395, 401, 100, 388, 271, 400, 95, 248, 88, 166, 409, 99, 329,
+	37, 315, 302, 209, 117, 14, 119, 390, 24, 415, 48, 224, 449, 341, 222, 244,
+	113, 345, 386, 267, 98, 288, 258, 60, 287, 105, 370, 192, 19, 416, 13, 147,
+	172, 45, 189, 251, 152, 301, 200, 334, 380, 225, 305, 289, 333, 259, 7, 314,
+	8, 249, 442, 239, 351, 356, 394, 194, 23, 86, 67, 312, 51, 398, 196, 59,
+	28, 163, 402, 155, 57, 41, 436, 354, 299, 4, 263, 35, 252, 336, 376, 426,
+	87, 115, 165, 50, 362, 381, 435, 54, 132, 320, 30, 367, 430, 146, 134, 279,
+	226, 184, 450, 322, 438, 307, 359, 21, 25, 68, 404, 149, 2, 361, 193, 69,
+	260, 273, 220, 332, 406, 114, 427, 168, 265, 140, 309, 89, 269, 108, 34, 123,
+	191, 377, 321, 451, 281, 371, 213, 43, 150, 29, 79, 262, 303, 360, 268, 206,
+	42, 384, 338, 180, 373, 431, 27, 352, 420, 330, 445, 197, 295, 383, 188, 311,
+	439, 234, 177, 136, 454, 66, 169, 353,
+};
@@ -0,0 +1,1387 @@
+// This file has been automatically generated by utils/settings.rb
+// Don't make any modifications to it. They will be lost.
+
+#include "platform.h"
+#include "config/parameter_group_ids.h"
+#include "fc/settings.h"
+#include "sensors/gyro.h"
+#include "flight/dynamic_gyro_notch.h"
+#include "fc/config.h"
+#include "sensors/acceleration.h"
+#include "sensors/rangefinder.h"
+#include "sensors/opflow.h"
+#include "sensors/compass.h"
+#include "sensors/barometer.h"
+#include "sensors/pitotmeter.h"
+#include "rx/rx.h"
+#include "rx/spektrum.h"
+#include "blackbox/blackbox.h"
+#include "flight/mixer.h"
+#include "flight/failsafe.h"
+#include "sensors/boardalignment.h"
+#include "sensors/battery.h"
+#include "sensors/battery.h"
+#include "flight/servos.h"
+#include "fc/controlrate_profile.h"
+#include "io/serial.h"
+#include "flight/imu.h"
+#include "fc/rc_controls.h"
+#include "flight/pid.h"
+#include "navigation/navigation.h"
+#include "io/serial.h"
+#include "telemetry/telemetry.h"
+#include "telemetry/frsky_d.h"
+#include "telemetry/sim.h"
+#include "fc/config.h"
+#include "fc/rc_modes.h"
+#include "fc/stats.h"
+#include "common/time.h"
+#include "drivers/display.h"
+#include "io/vtx_control.h"
+#include "drivers/vtx_common.h"
+#include "io/vtx.h"
+#include "common/log.h"
+const pgn_t settingsPgn[] = {
+	PG_GYRO_CONFIG,
+	PG_ADC_CHANNEL_CONFIG,
+	PG_ACCELEROMETER_CONFIG,
+	PG_RANGEFINDER_CONFIG,
+	PG_OPFLOW_CONFIG,
+	PG_COMPASS_CONFIG,
+	PG_BAROMETER_CONFIG,
+	PG_PITOTMETER_CONFIG,
+	PG_RX_CONFIG,
+	PG_BLACKBOX_CONFIG,
+	PG_MOTOR_CONFIG,
+	PG_FAILSAFE_CONFIG,
+	PG_BOARD_ALIGNMENT,
+	PG_BATTERY_METERS_CONFIG,
+	PG_BATTERY_PROFILES,
+	PG_MIXER_CONFIG,
+	PG_REVERSIBLE_MOTORS_CONFIG,
+	PG_SERVO_CONFIG,
+	PG_CONTROL_RATE_PROFILES,
+	PG_SERIAL_CONFIG,
+	PG_IMU_CONFIG,
+	PG_ARMING_CONFIG,
+	PG_GENERAL_SETTINGS,
+	PG_GPS_CONFIG,
+	PG_RC_CONTROLS_CONFIG,
+	PG_PID_PROFILE,
+	PG_PID_AUTOTUNE_CONFIG,
+	PG_POSITION_ESTIMATION_CONFIG,
+	PG_NAV_CONFIG,
+	PG_TELEMETRY_CONFIG,
+	PG_SYSTEM_CONFIG,
+	PG_MODE_ACTIVATION_OPERATOR_CONFIG,
+	PG_STATS_CONFIG,
+	PG_TIME_CONFIG,
+	PG_DISPLAY_CONFIG,
+	PG_VTX_CONFIG,
+	PG_VTX_SETTINGS_CONFIG,
+	PG_LOG_CONFIG,
+};
+const uint8_t settingsPgnCounts[] = {
+	23,
+	4,
+	12,
+	2,
+	3,
+	10,
+	3,
+	3,
+	15,
+	5,
+	9,
+	13,
+	3,
+	10,
+	9,
+	5,
+	3,
+	6,
+	16,
+	1,
+	7,
+	3,
+	1,
+	7,
+	7,
+	78,
+	5,
+	22,
+	68,
+	27,
+	4,
+	1,
+	4,
+	2,
+	1,
+	1,
+	6,
+	2,
+};
+static const uint8_t settingNamesWords[] = {
+	0x70,0x6c, /* "nav" */ 
+	0x3,0x5c, /* "fw" */ 
+	0xd,0x18, /* "mc" */ 
+	0x24,0x1a,0x14, /* "rate" */ 
+	0x10, /* "p" */ 
+	0x6,0x43,0x70, /* "yaw" */ 
+	0x1f,0x32,0x78, /* "gyro" */ 
+	0x34, /* "z" */ 
+	0x4,0xb8,0x36, /* "inav" */ 
+	0x4,0x13,0x41,0xa0, /* "pitch" */ 
+	0x10,0x7c, /* "pos" */ 
+	0xc1,0x27,0xb1,0x80, /* "roll" */ 
+	0x30,0x52,0xc9,0x84,0xc5, /* "failsafe" */ 
+	0x2, /* "i" */ 
+	0x41,0x4c,0xc0,0xa0, /* "type" */ 
+	0x46, /* "hz" */ 
+	0x80,0xc8,0x18, /* "lpf" */ 
+	0xd,0x4b, /* "min" */ 
+	0x80,0x40, /* "d" */ 
+	0x1e,0x13, /* "gps" */ 
+	0x3,0x3,0x57,0xd,0x0, /* "launch" */ 
+	0xb,0x12,0x77, /* "align" */ 
+	0x0,0x2e,0x3b,0xa, /* "angle" */ 
+	0x6,0x84,0xe0, /* "mag" */ 
+	0x68,0x70, /* "max" */ 
+	0x7,0x3e,0x83,0x40, /* "notch" */ 
+	0x25,0x44, /* "rth" */ 
+	0x3,0x19, /* "xy" */ 
+	0x0,0x46,0x30, /* "acc" */ 
+	0x51,0x12, /* "thr" */ 
+	0x5, /* "w" */ 
+	0xc0,0x42,0x84,0x82,0xb,0x88, /* "deadband" */ 
+	0xa,0x25,0xa5, /* "time" */ 
+	0x1,0xa,0xc0,0xe4, /* "delay" */ 
+	0x8,0xc,0x89,0x70,0xc8,0xa0, /* "hardware" */ 
+	0x61,0x6c,0x56, /* "level" */ 
+	0x1,0xa1,0x75,0x42,0xc0, /* "manual" */ 
+	0x35,0xf4,0x7c, /* "motor" */ 
+	0x81,0x38,0x14,0xa4, /* "speed" */ 
+	0x5,0x11,0x22,0xcd,0xf,0x61, /* "threshold" */ 
+	0x1,0x61,0x6,0x80, /* "vbat" */ 
+	0xb1,0x58, /* "vel" */ 
+	0xb,0x53,0x0, /* "vtx" */ 
+	0xb,0x28,0x9a,0x54,0x85, /* "altitude" */ 
+	0x0,0x6b,0x47, /* "auto" */ 
+	0x80,0x68,0xb,0x9c,0x56, /* "channel" */ 
+	0x0,0x99,0x70,0x5a,0x91, /* "dynamic" */ 
+	0x80,0xb8,0x83, /* "expo" */ 
+	0xc0,0x69,0x4d,0x79, /* "frsky" */ 
+	0x3,0x12,0xd4,0xd0, /* "limit" */ 
+	0x12,0x18, /* "rc" */ 
+	0x28,0x89,0x3e,0x94,0x61, /* "throttle" */ 
+	0x41,0x67,0xb2,0x81,0x39, /* "voltage" */ 
+	0x40,0x20,0xc9,0xe0, /* "baro" */ 
+	0x19,0x58,0xc0, /* "cell" */ 
+	0xd,0x89,0x68, /* "climb" */ 
+	0x80,0x44,0xcc,0x32,0x68, /* "disarm" */ 
+	0x12,0xda, /* "imu" */ 
+	0x81,0x34,0x2c,0x9a, /* "iterm" */ 
+	0x6,0x3e,0xe0, /* "low" */ 
+	0x6b,0xc8,0x50, /* "mode" */ 
+	0x3c,0xc6,0x99,0x68, /* "offset" */ 
+	0x8,0x3e,0xe5,0x90, /* "power" */ 
+	0x25,0x39,0xa4, /* "rssi" */ 
+	0x13,0x18,0x58,0x50, /* "scale" */ 
+	0x4c,0xb2,0xb3, /* "servo" */ 
+	0xc1,0xb2, /* "3d" */ 
+	0x0,0x23,0x19,0x58, /* "accel" */ 
+	0x0,0x90,0x60, /* "adc" */ 
+	0x10,0x69,0x42,0xcb,0x20, /* "battery" */ 
+	0x13,0x2,0x35,0x89,0xf8, /* "blackbox" */ 
+	0x0,0xc3,0x0,0x8d,0x34,0xc8, /* "capacity" */ 
+	0x6,0x40, /* "cd" */ 
+	0xe,0x55,0x4c,0xca, /* "cruise" */ 
+	0x1,0xd6,0x52,0x2b,0xa8, /* "current" */ 
+	0x1,0xd6,0x8f,0x31, /* "cutoff" */ 
+	0x80,0x41,0xb4, /* "dcm" */ 
+	0x4,0x4c,0xe8,0x17,0xc,0xa0, /* "distance" */ 
+	0x25,0xb,0x26, /* "dterm" */ 
+	0x80,0xc6, /* "ff" */ 
+	0x2,0x1e,0xd2, /* "home" */ 
+	0x81,0x2e,0xb1,0x65,0x42,0x90, /* "inverted" */ 
+	0xb,0xb,0x1a,0x17, /* "kalman" */ 
+	0x1,0x81,0x71,0x12,0xe3, /* "landing" */ 
+	0x81,0xa1,0xb3,0x12,0xe5, /* "mavlink" */ 
+	0x81,0xa5,0xa1,0x64, /* "meter" */ 
+	0x9,0xa5,0xa0, /* "sim" */ 
+	0x9d,0x3,0x49, /* "stats" */ 
+	0x82,0x85,0x61,0x5a,0x5a,0x4b,0x20, /* "telemetry" */ 
+	0x8,0xc6,0x70,0xa5,0xc0, /* "accgain" */ 
+	0x8,0xc7,0xa2,0xc9,0xe0, /* "acczero" */ 
+	0xb,0xa8,0x93,0xc8,0x36,0x4d,0x32, /* "antigravity" */ 
+	0x0,0xd6,0x8f,0xa5,0x5c,0x50, /* "autotune" */ 
+	0x8,0x2e,0x58, /* "bank" */ 
+	0x4,0xf0,0xc8,0x80, /* "board" */ 
+	0x14,0x82,0xb4,0xb8,0xe0, /* "braking" */ 
+	0x1b,0xdd,0x49,0x3d,0x80, /* "control" */ 
+	0x21,0x68,0x51,0xd0, /* "detect" */ 
+	0x4,0x4c,0x8a,0x3a,0x25,0xee, /* "direction" */ 
+	0x1,0x92,0xca,0x16,0x40, /* "filter" */ 
+	0x40,0x58,0x62,0x56,0xc,0x2e, /* "halfduplex" */ 
+	0x0,0x82,0x1c, /* "hdg" */ 
+	0x8,0x28,0x48,0x97,0x1c, /* "heading" */ 
+	0x8,0x7b,0x8, /* "hold" */ 
+	0x4,0x91,0x85, /* "idle" */ 
+	0x3,0x42,0x7d,0x16,0x4f, /* "magzero" */ 
+	0x3,0xe0,0x66,0x3e,0xe0, /* "opflow" */ 
+	0x82,0x68,0xfa, /* "pitot" */ 
+	0x2,0x17,0x68, /* "pwm" */ 
+	0x24,0x56,0x7,0x0, /* "relax" */ 
+	0x99,0x64,0x90,0xb2,0x58, /* "serialrx" */ 
+	0x4,0xeb,0x23,0x4,0x65, /* "surface" */ 
+	0x4,0xee,0x9a,0xd,0x0, /* "switch" */ 
+	0xa2,0x5a,0x57,0xd6,0x80, /* "timeout" */ 
+	0xa3,0xe8,0x16, /* "total" */ 
+	0x2,0xae,0x4d, /* "unit" */ 
+	0x1,0x59,0x94, /* "use" */ 
+	0x16, /* "v" */ 
+	0x6, /* "x" */ 
+	0x1,0x90, /* "y" */ 
+	0x5,0x32,0x6b,0xc8,0x50, /* "airmode" */ 
+	0x5,0x32,0x9c,0xa,0x52, /* "airspeed" */ 
+	0x0,0x2c,0xa0, /* "alt" */ 
+	0x4,0x1a, /* "bat" */ 
+	0x0,0x68,0xb, /* "chan" */ 
+	0x80,0x34,0x14,0x6b, /* "check" */ 
+	0x1,0xa,0x60,0xd5,0x94, /* "default" */ 
+	0x1,0x5c,0x11,0x30,0xa4, /* "enabled" */ 
+	0x1,0x5c,0x59,0x1f,0x20, /* "energy" */ 
+	0x5a, /* "ki" */ 
+	0x40,0xb8, /* "kp" */ 
+	0x1,0x8f,0x38, /* "log" */ 
+	0x19,0x3,0x70, /* "lpf2" */ 
+	0xd,0x29,0x12,0x17, /* "median" */ 
+	0x1,0xaf,0x21,0x58, /* "model" */ 
+	0x8,0x24,0x93,0xab, /* "pidsum" */ 
+	0x41,0x9,0x3c,0x65,0x25,0x64,0x50, /* "procedure" */ 
+	0x42,0x4f,0xa3,0xc6,0xf6, /* "protocol" */ 
+	0x2,0x12,0x7d,0x92,0x42,0xc8, /* "provider" */ 
+	0x11, /* "q" */ 
+	0x4,0x82,0xe3,0x94,0xc9,0x71,0xb,0x20, /* "rangefinder" */ 
+	0x48,0xb3,0x2d, /* "reset" */ 
+	0x1,0x2c, /* "rx" */ 
+	0x2,0x88,0x93,0xee, /* "throw" */ 
+	0xa,0x40,0x20, /* "tpa" */ 
+	0xa4,0x82,0xe9,0xb5,0x34, /* "transmit" */ 
+	0x5,0x66,0x51, /* "usec" */ 
+	0x82,0xe1,0x93,0x92,0xe3, /* "warning" */ 
+	0x80,0x22,0x7c,0xa8, /* "abort" */ 
+	0x0,0x8c,0x7d,0x2d,0x8a,0xea,0x76,0x88,0x91,0x66,0x87,0xb0,0x9d,0x42,0x4e,0x80, /* "acc_event_threshold_high" */ 
+	0x4,0x63,0xe9,0x6c,0x57,0x53,0xb4,0x44,0x8b,0x34,0x3d,0x84,0xeb,0x8a,0x7e,0xe0, /* "acc_event_threshold_neg_x" */ 
+	0x1,0x18,0xca,0xc2,0xc8,0x34,0x7c, /* "accelerator" */ 
+	0x80,0x16,0x31,0xf7, /* "allow" */ 
+	0x0,0x5c,0x16,0x66,0x65,0x90, /* "analyser" */ 
+	0x3,0x8,0x31,0x25,0x20, /* "applied" */ 
+	0x4,0x17,0x10, /* "band" */ 
+	0x2,0xd,0x48, /* "baud" */ 
+	0x1,0x24,0x33, /* "bias" */ 
+	0x0,0x9e,0xf9,0xd0, /* "boost" */ 
+	0x2,0x91,0x42,0xb8,0x3d,0x2e,0xa0, /* "breakpoint" */ 
+	0x6,0x16, /* "cal" */ 
+	0x0,0x61,0x62,0x45,0x20,0xd1,0x2f,0x70, /* "calibration" */ 
+	0x6,0x56,0x32,0x60, /* "cells" */ 
+	0x19,0x5d,0x42,0xc8, /* "center" */ 
+	0x3,0x40,0x64,0x11,0xd0,0xb2, /* "character" */ 
+	0x0,0xde,0xd6,0x85,0xc4, /* "command" */ 
+	0x0,0xde,0xd8, /* "comp" */ 
+	0x0,0x6f,0x6c,0x24,0x59,0xcd,0x2f,0x70, /* "compression" */ 
+	0x6,0xf7,0x19,0x27, /* "config" */ 
+	0x0,0xde,0xf9,0x11,0x2e,0xd,0xb,0x30, /* "coordinates" */ 
+	0xd,0xf5,0x75, /* "count" */ 
+	0x0,0x39,0x26,0x89,0x18,0x58, /* "critical" */ 
+	0x2,0x74,0x4f,0x7c,0xe9,0xd3,0xe6,0x4f,0xe9,0xa,0xca,0x7,0xac,0x81,0xba,0x8d, /* "d_boost_gyro_delta_lpf_hz" */ 
+	0x0,0x9d,0x13,0xdf,0x3a,0x75,0xa1,0xc7,0x43,0x4e,0x84,0x63,0x2b,0xb,0x20,0xd1,0x2f,0x70, /* "d_boost_max_at_acceleration" */ 
+	0x8,0x51,0x54,0xe0, /* "debug" */ 
+	0x21,0x46,0x56, /* "decel" */ 
+	0x0,0x85,0x1b, /* "decl" */ 
+	0x0,0x42,0x8d,0x89,0x70,0x68,0x97,0xb8, /* "declination" */ 
+	0x4,0x29,0x83,0x56,0x52,0x60, /* "defaults" */ 
+	0x21,0x5c,0xf6, /* "denom" */ 
+	0x80,0x85,0xb2,0x46,0x50, /* "device" */ 
+	0x11,0x33,0x83,0x3,0x9e,0x99,0xf2,0x19,0x7b,0x3b,0xf4,0x4c,0x4b,0x96, /* "display_force_sw_blink" */ 
+	0x2,0x26,0x74, /* "dist" */ 
+	0x1,0x13,0x62, /* "dive" */ 
+	0x80,0x99,0x70, /* "dyn" */ 
+	0xa,0xd2,0xc8,0xe0, /* "emerg" */ 
+	0x2c,0x2c, /* "epv" */ 
+	0x2,0xd8,0xae,0xa0, /* "event" */ 
+	0xb,0x8a,0x48,0x3e, /* "extra1" */ 
+	0x1,0x71,0x49,0x7,0x80, /* "extra2" */ 
+	0x30,0x47,0x47,0xc8, /* "factor" */ 
+	0x6,0x4c,0xa7,0x40, /* "first" */ 
+	0x19,0x38,0x29,0x3b,0x74,0xb8,0xfd,0xd,0x68,0xfe,0x86,0x4d, /* "fixed_wing_auto_arm" */ 
+	0x1,0x98,0x13,0xcc, /* "flags" */ 
+	0x6,0x60,0x60,0x59,0x3d,0xc0, /* "flaperon" */ 
+	0x33,0x3,0x9, /* "flaps" */ 
+	0x80,0xcf,0x93,0x43,0x40, /* "format" */ 
+	0x1a,0x16,0xeb,0x53,0x8e,0x90,0xa7,0x91,0x4b,0x30, /* "fpv_mix_degrees" */ 
+	0x1a,0x45,0x8d,0x4a,0xe1,0xe4, /* "frequency" */ 
+	0x6,0xa9,0x58, /* "fuel" */ 
+	0x3,0x5f,0xa1,0xad,0x1f,0x4a,0xb8,0xbd,0x31,0xbb,0x47,0xf5,0x3d,0xa0, /* "fw_autotune_ff_to_i_tc" */ 
+	0xc0,0x6b,0xf4,0x35,0xa3,0xe9,0x57,0x17,0xa6,0x37,0x68,0xfe,0xc3,0xa7,0xa,0x5c, /* "fw_autotune_ff_to_p_gain" */ 
+	0x3,0x5f,0xa9,0xa1,0x64,0xde,0xb1,0x2d,0x4d,0x3b,0x3a,0x24,0x6b,0xec,0x1f,0x34,0xd1,0x2f,0x70, /* "fw_iterm_limit_stick_position" */ 
+	0xd,0x7e,0xb5,0x2e,0xed,0x11,0x27,0xd2,0x8c,0x2f,0x48,0xfb,0xbb,0xb0,0x4d,0x6,0x80, /* "fw_min_throttle_down_pitch" */ 
+	0x1a,0xfd,0xa4,0x3,0xda,0x25,0xa5,0xe8,0xde,0xe9,0xd0,0x2e,0xa0, /* "fw_tpa_time_constant" */ 
+	0xd,0x7e,0xd2,0xb2,0x77,0x43,0x39,0xa6,0x74,0xee,0x43,0x7e,0x9c,0x29,0x70, /* "fw_turn_assist_yaw_gain" */ 
+	0xe,0x14,0xb8, /* "gain" */ 
+	0x7,0x84,0xfb,0x51,0x31,0xf8,0xed,0x66,0x5e,0x9c,0x2c,0x4b,0xa,0xf0, /* "gps_ublox_use_galileo" */ 
+	0x1f,0x32,0x7f,0x67,0x40,0x9c,0xbc,0xeb,0x1f,0x78,0x6,0x73,0xea,0x34, /* "gyro_stage2_lowpass_hz" */ 
+	0x3,0xe6,0x4f,0xec,0xe8,0x13,0x97,0x9d,0x63,0xef,0x0,0xce,0x7d,0xa6,0x60,0x50, /* "gyro_stage2_lowpass_type" */ 
+	0x20,0x33, /* "has" */ 
+	0x2,0x12,0x74, /* "high" */ 
+	0x1,0xf,0xa5,0x3a,0x16,0x6,0x4d,0xec,0xdf,0x57,0x13,0xa9,0x75,0xb,0x2b,0x5,0x80, /* "hott_alarm_sound_interval" */ 
+	0x43,0xec,0x59, /* "hover" */ 
+	0x1,0x3c,0x18, /* "i2c" */ 
+	0x12,0x2a,0xcc, /* "ibus" */ 
+	0x9,0x3b,0x9f,0x22, /* "ignore" */ 
+	0x81,0x2d,0xaf,0x42,0x31,0xf5,0x27,0x73,0xe4,0x5e,0xcd,0x8f,0x81, /* "imu_acc_ignore_slope" */ 
+	0x40,0x97,0x6,0xdd,0xb,0x18,0xfb,0xf4,0x85,0x9,0x3b,0x22,0x8d,0x6f,0x72,0x5c,0x70, /* "inav_allow_dead_reckoning" */ 
+	0x25,0xc1,0xb7,0x4f,0x20,0xd9,0x34,0xcf,0x46,0x16,0x76,0x8f,0x61,0x64,0x17,0xc,0xa0, /* "inav_gravity_cal_tolerance" */ 
+	0x4b,0x83,0x6e,0xb4,0x38,0xe9,0x60,0x8e,0x96,0x16, /* "inav_max_eph_epv" */ 
+	0x2,0x5c,0x1b,0x76,0xfd,0xc6,0x7a,0x66,0x3e,0xfd,0x80, /* "inav_w_xy_flow_p" */ 
+	0x12,0xe0,0xdb,0xb7,0xee,0x33,0xd3,0x31,0xf7,0xed, /* "inav_w_xy_flow_v" */ 
+	0x80,0x97,0x6,0xdd,0xbf,0x71,0x9e,0xc8,0xb3,0xed, /* "inav_w_xy_res_v" */ 
+	0x80,0x97,0x6,0xdd,0xbf,0x71,0x9d,0x74,0x23,0x1f,0x60, /* "inav_w_xyz_acc_p" */ 
+	0x4,0xb8,0x36,0xed,0xfb,0xae,0xc8,0xb3,0xed, /* "inav_w_z_res_v" */ 
+	0x80,0x97,0x50,0xb2,0xb0,0x58, /* "interval" */ 
+	0x5,0xa5,0x8c, /* "kill" */ 
+	0x3,0x3,0x44,0xd2,0xa4,0x28, /* "latitude" */ 
+	0x18,0xf4,0xd0,0xb2, /* "loiter" */ 
+	0x3,0x1e,0xe3,0xa6,0x95,0x21, /* "longitude" */ 
+	0x40,0xc7,0xbe,0x14,0x4b,0x4a, /* "looptime" */ 
+	0x6,0x51,0xa0, /* "ltm" */ 
+	0x68,0x64,0x74,0xb8, /* "margin" */ 
+	0xd,0xd,0x98,0x97,0x2f,0xa5,0xc5,0x3b,0x3a,0x6,0x95,0x9f,0x64,0x1a,0x14, /* "mavlink_ext_status_rate" */ 
+	0xd,0xe,0x3a,0x17,0x1d,0x85,0xea,0x5c,0x36,0x25,0xc1,0xa2,0x5e,0xee,0xc1,0x34, /* "max_angle_inclination_pit" */ 
+	0x3,0x43,0x8e,0x85,0xc7,0x61,0x7a,0x97,0xd,0x89,0x70,0x68,0x97,0xbb,0xb2,0x63, /* "max_angle_inclination_rll" */ 
+	0x0,0xd4,0x90, /* "mid" */ 
+	0xd,0x4b,0x18,0x90, /* "milli" */ 
+	0x35,0x33,0x9a,0x5e,0xe0, /* "mission" */ 
+	0x35,0xe4,0x2f,0x64,0x17,0x1c,0xbd,0x63,0xce,0x91,0xf5,0xf0,0x2c,0x83,0x47,0xc8, /* "mode_range_logic_operator" */ 
+	0xd,0x7c,0x9e,0xe0, /* "moron" */ 
+	0x38,0x2d,0x28, /* "name" */ 
+	0x1c,0x1b,0x74,0xb8,0xa4,0x83,0xd0,0xc9,0xa9,0x71,0xfb,0x30,0x98,0xb4,0xc8, /* "nav_extra_arming_safety" */ 
+	0x1c,0x1b,0x74,0xd7,0xe8,0x58,0xc7,0xdf,0xad,0xb,0xaa,0x16,0x76,0x88,0x97,0x52,0xe1,0xc8,0xa1,0x99, /* "nav_fw_allow_manual_thr_increase" */ 
+	0x40,0xe0,0xdb,0xa6,0xbf,0x58,0x17,0x13,0xa4,0x4d,0x8b,0xd0,0xb8,0xec,0x28, /* "nav_fw_land_dive_angle" */ 
+	0x1c,0x1b,0x74,0xd7,0xeb,0x3,0x57,0xd,0x1d,0x9c,0x12,0xea,0xc3,0xb4,0x4b,0x4a, /* "nav_fw_launch_spinup_time" */ 
+	0x7,0x6,0xdd,0x35,0xfa,0xc7,0xa6,0x85,0x97,0x64,0x12,0x26,0xb3, /* "nav_fw_loiter_radius" */ 
+	0x3,0x83,0x6e,0x9a,0xfd,0x83,0xe7,0xd4,0x10,0xfd,0x82,0x49,0x3a,0xb7,0xac,0x4b,0x53,0x40, /* "nav_fw_pos_hdg_pidsum_limit" */ 
+	0x38,0x36,0xeb,0x2,0xe2,0x76,0x6c,0x7d,0xc8,0xfb,0xbb,0xad,0xe,0x2,0xca, /* "nav_land_slowdown_maxalt" */ 
+	0x1,0xc1,0xb7,0x58,0x17,0x13,0xb3,0x63,0xee,0x47,0xdd,0xdd,0x6a,0x5c,0x16,0x50, /* "nav_land_slowdown_minalt" */ 
+	0xe,0xd,0xba,0xd0,0xe3,0xb4,0x2c,0xa4,0x14,0xbb,0xa6,0x7b,0x18,0xfb,0xf4,0x2c,0xa0, /* "nav_max_terrain_follow_alt" */ 
+	0x1c,0x1b,0x75,0xa3,0xe8,0xa4,0x15,0xa5,0xc7,0xe8,0x9e,0xf9,0xd3,0xa4,0x4c,0xca,0xe3,0x84,0xe5,0xec,0xe0,0x52,0x90, /* "nav_mc_braking_boost_disengage_speed" */ 
+	0xe,0xd,0xba,0xd1,0xf4,0x52,0xa,0xd2,0xe3,0xf4,0x4f,0x7c,0xe9,0xd3,0x4,0x74,0x7c, /* "nav_mc_braking_boost_factor" */ 
+	0x80,0xe0,0xdb,0xad,0x1f,0x45,0x20,0xad,0x2e,0x3f,0x44,0xf7,0xce,0x9d,0x9c,0xa,0x52,0x76,0x88,0x91,0x66,0x87,0xb0,0x80, /* "nav_mc_braking_boost_speed_threshold" */ 
+	0x70,0x6d,0xd6,0x8f,0xa2,0x90,0x56,0x97,0x1f,0xa2,0x7b,0xe7,0x4e,0xd1,0x2d,0x2b,0xeb,0x40, /* "nav_mc_braking_boost_timeout" */ 
+	0x38,0x36,0xeb,0x47,0xd1,0x48,0x2b,0x4b,0x8f,0xd2,0x26,0x65,0x71,0xc2,0x72,0xf6,0x70,0x29,0x48, /* "nav_mc_braking_disengage_speed" */ 
+	0x7,0x6,0xdd,0x68,0xfb,0x7,0xcf,0xa4,0x28,0xca,0xc2,0xc8,0x34,0x4b,0xdd,0xda,0x25,0xa5, /* "nav_mc_pos_deceleration_time" */ 
+	0x3,0x83,0x6e,0xb4,0x7d,0xb1,0x59,0xdc,0x67,0xa4,0xa1,0x64,0xde,0xb2,0x6,0xea,0x34, /* "nav_mc_vel_xy_dterm_lpf_hz" */ 
+	0x7,0x6,0xdd,0x7d,0x8b,0x29,0x24,0x85,0x9f,0x5a,0xfa,0x3e,0x5d,0x9d,0x1f,0x0, /* "nav_overrides_motor_stop" */ 
+	0x38,0x36,0xec,0xa8,0x8e,0x8d,0x89,0x68,0xba,0x93,0xb9,0xf2,0x2f,0x4a,0xd2,0xc8,0xe0, /* "nav_rth_climb_ignore_emerg" */ 
+	0x70,0x6d,0xd9,0x51,0x1d,0xa0,0x52,0xce,0x99,0x32,0x9d, /* "nav_rth_tail_first" */ 
+	0x0,0xe0,0xdb,0xb5,0x99,0x7a,0xd4,0x92,0x88,0x97,0x4c,0xf9,0x74,0x2c,0xa2,0x1e,0xc2, /* "nav_use_midthr_for_althold" */ 
+	0x1,0xc1,0xb7,0x6f,0xe,0xcc,0x26,0x2f,0x48,0x99,0xd0,0x2e,0x19, /* "nav_wp_safe_distance" */ 
+	0x40,0xe2,0xd6,0x92,0xb, /* "neutral" */ 
+	0x0,0xea,0xb4, /* "num" */ 
+	0xf,0x31, /* "off" */ 
+	0x80,0xf7, /* "on" */ 
+	0x1,0xf6,0x2c,0xa4,0x92,0x14, /* "override" */ 
+	0xf,0xb1,0x65,0x34,0x3d,0xf4, /* "overshoot" */ 
+	0x4,0x12,0x40, /* "pid" */ 
+	0x41,0x24,0xec,0x24,0xf1,0x96,0x73,0xe9,0xa,0xe7,0xb4, /* "pid_process_denom" */ 
+	0x10,0x4b, /* "pin" */ 
+	0x81,0x4,0xd0, /* "pit" */ 
+	0x10,0x4d,0x6,0x8e,0x51,0x12, /* "pitch2thr" */ 
+	0x4,0x18,0x1a,0x19,0xf2,0x68, /* "platform" */ 
+	0x20,0xf6,0x16,0x60, /* "poles" */ 
+	0x83,0xe6,0x9a,0x25,0xee, /* "position" */ 
+	0x4,0x24,0x51,0xa6,0x69,0x7b, /* "precision" */ 
+	0x81,0x9,0x16,0xc9,0x2d, /* "preview" */ 
+	0xc1,0xa,0xb2,0x65, /* "pulse" */ 
+	0x4,0x82,0x44,0xd6,0x60, /* "radius" */ 
+	0x90,0x5c,0x72, /* "range" */ 
+	0x82,0x45,0x13,0xdf,0x40, /* "reboot" */ 
+	0x48,0xa3,0x2a,0x6c,0x59, /* "receiver" */ 
+	0x2,0x45,0x1b,0xec,0x59,0x64, /* "recovery" */ 
+	0x12,0x29,0x8b,0x22,0xb8,0x65, /* "reference" */ 
+	0x4,0x8b,0x7,0xca,0x80, /* "report" */ 
+	0x96,0x3b,0x38,0x27,0xb2,0x37,0x46,0x80,0xb9,0xc5,0x67,0x46,0xfa,0xba,0x80, /* "rx_spi_rf_channel_count" */ 
+	0x98,0x69,0x30, /* "sats" */ 
+	0x4c,0x41,0x98, /* "sbas" */ 
+	0x26,0x2a,0xcf,0xb3,0xcb,0x87,0xd4,0xba,0x85,0x95,0x82,0xc0, /* "sbus_sync_interval" */ 
+	0x4c,0x83,0xc,0x88, /* "sdcard" */ 
+	0x9,0xa0,0x32,0x83,0x8b,0x39, /* "sharpness" */ 
+	0x82,0x69,0x6f,0x4f,0x27,0xd5,0xc4,0xec,0xe8,0x1a,0x25,0xee,0xeb,0xaa,0xd1,0x16,0x40, /* "sim_ground_station_number" */ 
+	0x9b,0x42,0xc6, /* "small" */ 
+	0x2,0x6d,0xc,0xa9,0x7,0xca,0x80, /* "smartport" */ 
+	0x9b,0x5e,0xfa,0x21,0xc5,0x9c, /* "smoothness" */ 
+	0xc1,0x37,0xd6,0x43,0x28, /* "source" */ 
+	0x27,0x21, /* "src" */ 
+	0x82,0x74,0x48,0xd6, /* "stick" */ 
+	0x9,0xe5,0xc3, /* "sync" */ 
+	0x5,0x11,0x27,0xd2,0x8c,0x2f,0x68,0x96,0x53,0xa3,0x7b,0x61,0xd9,0xd2,0x40, /* "throttle_tilt_comp_str" */ 
+	0xa3, /* "to" */ 
+	0xc1,0x47,0xb0,0xb2,0xb,0x86,0x50, /* "tolerance" */ 
+	0x51,0xf0,0x48,0xe6, /* "topics" */ 
+	0xa,0x49,0x20, /* "tri" */ 
+	0xa6, /* "tz" */ 
+	0x81,0x4d,0x74,0x35,0xa3,0xda,0x1a,0x24,0x7d,0x24,0xe8, /* "tz_automatic_dst" */ 
+	0xa,0xb8,0x32,0x69,0x48, /* "unarmed" */ 
+	0xa,0xb8,0x85,0x94,0xd0,0xf7,0xd0, /* "undershoot" */ 
+	0x15,0x81,0x3,0x42, /* "update" */ 
+	0x82,0xb3,0x2c, /* "user" */ 
+	0x81,0x62,0xb1,0xc5,0x20, /* "velned" */ 
+	0x2c,0x56,0x3c,0x69,0xa6, /* "velocity" */ 
+	0x41,0x63,0x6,0x60, /* "vfas" */ 
+	0xb9,0x52,0x74,0x50, /* "weight" */ 
+	0x17,0x4b,0x89,0x58, /* "windup" */ 
+	0x2,0xf0, /* "wp" */ 
+	0x0,0x00
+};
+static const char wordSymbols[] = {'3','2','_','1',};
+const char * const table_acc_hardware[] = {
+	"NONE",
+	"AUTO",
+	"ADXL345",
+	"MPU6050",
+	"MMA845x",
+	"BMA280",
+	"LSM303DLHC",
+	"MPU6000",
+	"MPU6500",
+	"MPU9250",
+	"BMI160",
+	"ICM20689",
+	"FAKE",
+};
+const char * const table_airmodeHandlingType[] = {
+	"STICK_CENTER",
+	"THROTTLE_THRESHOLD",
+};
+const char * const table_alignment[] = {
+	"DEFAULT",
+	"CW0",
+	"CW90",
+	"CW180",
+	"CW270",
+	"CW0FLIP",
+	"CW90FLIP",
+	"CW180FLIP",
+	"CW270FLIP",
+};
+const char * const table_aux_operator[] = {
+	"OR",
+	"AND",
+};
+const char * const table_baro_hardware[] = {
+	"NONE",
+	"AUTO",
+	"BMP085",
+	"MS5611",
+	"BMP280",
+	"MS5607",
+	"LPS25H",
+	"SPL06",
+	"BMP388",
+	"DPS310",
+	"FAKE",
+};
+const char * const table_bat_capacity_unit[] = {
+	"MAH",
+	"MWH",
+};
+const char * const table_bat_voltage_source[] = {
+	"RAW",
+	"SAG_COMP",
+};
+const char * const table_blackbox_compression[] = {
+	"NONE",
+	"HUFFMAN",
+};
+const char * const table_blackbox_device[] = {
+	"SERIAL",
+	"SPIFLASH",
+	"SDCARD",
+};
+const char * const table_current_sensor[] = {
+	"NONE",
+	"ADC",
+	"VIRTUAL",
+	"ESC",
+};
+const char * const table_debug_modes[] = {
+	"NONE",
+	"GYRO",
+	"AGL",
+	"FLOW_RAW",
+	"FLOW",
+	"SBUS",
+	"FPORT",
+	"ALWAYS",
+	"SAG_COMP_VOLTAGE",
+	"VIBE",
+	"CRUISE",
+	"REM_FLIGHT_TIME",
+	"SMARTAUDIO",
+	"ACC",
+	"ITERM_RELAX",
+	"ERPM",
+	"RPM_FILTER",
+	"RPM_FREQ",
+	"NAV_YAW",
+	"DYNAMIC_FILTER",
+	"DYNAMIC_FILTER_FREQUENCY",
+	"IRLOCK",
+	"CD",
+	"KALMAN",
+	"SDCARD",
+};
+const char * const table_direction[] = {
+	"RIGHT",
+	"LEFT",
+	"YAW",
+};
+const char * const table_dynamicFilterAnalyserTable[] = {
+	"FFT",
+	"SDFT",
+};
+const char * const table_dynamicFilterRangeTable[] = {
+	"HIGH",
+	"MEDIUM",
+	"LOW",
+};
+const char * const table_failsafe_procedure[] = {
+	"SET-THR",
+	"DROP",
+	"RTH",
+	"NONE",
+};
+const char * const table_filter_type[] = {
+	"PT1",
+	"BIQUAD",
+};
+const char * const table_frsky_unit[] = {
+	"METRIC",
+	"IMPERIAL",
+};
+const char * const table_gps_dyn_model[] = {
+	"PEDESTRIAN",
+	"AIR_1G",
+	"AIR_4G",
+};
+const char * const table_gps_provider[] = {
+	"NMEA",
+	"UBLOX",
+	"UNUSED",
+	"NAZA",
+	"UBLOX7",
+	"MTK",
+};
+const char * const table_gps_sbas_mode[] = {
+	"AUTO",
+	"EGNOS",
+	"WAAS",
+	"MSAS",
+	"GAGAN",
+	"NONE",
+};
+const char * const table_gyro_lpf[] = {
+	"256HZ",
+	"188HZ",
+	"98HZ",
+	"42HZ",
+	"20HZ",
+	"10HZ",
+};
+const char * const table_i2c_speed[] = {
+	"400KHZ",
+	"800KHZ",
+	"100KHZ",
+	"200KHZ",
+};
+const char * const table_iterm_relax[] = {
+	"OFF",
+	"RP",
+	"RPY",
+};
+const char * const table_iterm_relax_type[] = {
+	"GYRO",
+	"SETPOINT",
+};
+const char * const table_log_level[] = {
+	"ERROR",
+	"WARNING",
+	"INFO",
+	"VERBOSE",
+	"DEBUG",
+};
+const char * const table_ltm_rates[] = {
+	"NORMAL",
+	"MEDIUM",
+	"SLOW",
+};
+const char * const table_mag_hardware[] = {
+	"NONE",
+	"AUTO",
+	"HMC5883",
+	"AK8975",
+	"GPSMAG",
+	"MAG3110",
+	"AK8963",
+	"IST8310",
+	"QMC5883",
+	"MPU9250",
+	"IST8308",
+	"LIS3MDL",
+	"FAKE",
+};
+const char * const table_motor_pwm_protocol[] = {
+	"STANDARD",
+	"ONESHOT125",
+	"ONESHOT42",
+	"MULTISHOT",
+	"BRUSHED",
+	"DSHOT150",
+	"DSHOT300",
+	"DSHOT600",
+	"DSHOT1200",
+	"SERIALSHOT",
+};
+const char * const table_nav_extra_arming_safety[] = {
+	"OFF",
+	"ON",
+	"ALLOW_BYPASS",
+};
+const char * const table_nav_rth_allow_landing[] = {
+	"NEVER",
+	"ALWAYS",
+	"FS_ONLY",
+};
+const char * const table_nav_rth_alt_mode[] = {
+	"CURRENT",
+	"EXTRA",
+	"FIXED",
+	"MAX",
+	"AT_LEAST",
+	"AT_LEAST_LINEAR_DESCENT",
+};
+const char * const table_nav_user_control_mode[] = {
+	"ATTI",
+	"CRUISE",
+};
+const char * const table_off_on[] = {
+	"OFF",
+	"ON",
+};
+const char * const table_opflow_hardware[] = {
+	"NONE",
+	"PMW3901",
+	"CXOF",
+	"MSP",
+	"FAKE",
+};
+const char * const table_pidTypeTable[] = {
+	"NONE",
+	"PID",
+	"PIFF",
+	"AUTO",
+};
+const char * const table_pitot_hardware[] = {
+	"NONE",
+	"AUTO",
+	"MS4525",
+	"ADC",
+	"VIRTUAL",
+	"FAKE",
+};
+const char * const table_platform_type[] = {
+	"MULTIROTOR",
+	"AIRPLANE",
+	"HELICOPTER",
+	"TRICOPTER",
+	"ROVER",
+	"BOAT",
+};
+const char * const table_rangefinder_hardware[] = {
+	"NONE",
+	"HCSR04",
+	"SRF10",
+	"INAV_I2C",
+	"VL53L0X",
+	"MSP",
+	"UIB",
+	"BENEWAKE",
+};
+const char * const table_receiver_type[] = {
+	"NONE",
+	"PPM",
+	"SERIAL",
+	"MSP",
+	"SPI",
+	"UIB",
+};
+const char * const table_reset_type[] = {
+	"NEVER",
+	"FIRST_ARM",
+	"EACH_ARM",
+};
+const char * const table_rssi_source[] = {
+	"NONE",
+	"AUTO",
+	"ADC",
+	"CHANNEL",
+	"PROTOCOL",
+	"MSP",
+};
+const char * const table_serial_rx[] = {
+	"SPEK1024",
+	"SPEK2048",
+	"SBUS",
+	"SUMD",
+	"SUMH",
+	"XB-B",
+	"XB-B-RJ01",
+	"IBUS",
+	"JETIEXBUS",
+	"CRSF",
+	"FPORT",
+	"SBUS_FAST",
+};
+const char * const table_servo_protocol[] = {
+	"PWM",
+	"SERVO_DRIVER",
+	"SBUS",
+};
+const char * const table_smartport_fuel_unit[] = {
+	"PERCENT",
+	"MAH",
+	"MWH",
+};
+const char * const table_tz_automatic_dst[] = {
+	"OFF",
+	"EU",
+	"USA",
+};
+const char * const table_voltage_sensor[] = {
+	"NONE",
+	"ADC",
+	"ESC",
+};
+const char * const table_vtx_low_power_disarm[] = {
+	"OFF",
+	"ON",
+	"UNTIL_FIRST_ARM",
+};
+static const lookupTableEntry_t settingLookupTables[] = {
+	{ table_acc_hardware, sizeof(table_acc_hardware) / sizeof(char*) },
+	{ table_airmodeHandlingType, sizeof(table_airmodeHandlingType) / sizeof(char*) },
+	{ table_alignment, sizeof(table_alignment) / sizeof(char*) },
+	{ table_aux_operator, sizeof(table_aux_operator) / sizeof(char*) },
+	{ table_baro_hardware, sizeof(table_baro_hardware) / sizeof(char*) },
+	{ table_bat_capacity_unit, sizeof(table_bat_capacity_unit) / sizeof(char*) },
+	{ table_bat_voltage_source, sizeof(table_bat_voltage_source) / sizeof(char*) },
+	{ table_blackbox_compression, sizeof(table_blackbox_compression) / sizeof(char*) },
+	{ table_blackbox_device, sizeof(table_blackbox_device) / sizeof(char*) },
+	{ table_current_sensor, sizeof(table_current_sensor) / sizeof(char*) },
+	{ table_debug_modes, sizeof(table_debug_modes) / sizeof(char*) },
+	{ table_direction, sizeof(table_direction) / sizeof(char*) },
+	{ table_dynamicFilterAnalyserTable, sizeof(table_dynamicFilterAnalyserTable) / sizeof(char*) },
+	{ table_dynamicFilterRangeTable, sizeof(table_dynamicFilterRangeTable) / sizeof(char*) },
+	{ table_failsafe_procedure, sizeof(table_failsafe_procedure) / sizeof(char*) },
+	{ table_filter_type, sizeof(table_filter_type) / sizeof(char*) },
+	{ table_frsky_unit, sizeof(table_frsky_unit) / sizeof(char*) },
+	{ table_gps_dyn_model, sizeof(table_gps_dyn_model) / sizeof(char*) },
+	{ table_gps_provider, sizeof(table_gps_provider) / sizeof(char*) },
+	{ table_gps_sbas_mode, sizeof(table_gps_sbas_mode) / sizeof(char*) },
+	{ table_gyro_lpf, sizeof(table_gyro_lpf) / sizeof(char*) },
+	{ table_i2c_speed, sizeof(table_i2c_speed) / sizeof(char*) },
+	{ table_iterm_relax, sizeof(table_iterm_relax) / sizeof(char*) },
+	{ table_iterm_relax_type, sizeof(table_iterm_relax_type) / sizeof(char*) },
+	{ table_log_level, sizeof(table_log_level) / sizeof(char*) },
+	{ table_ltm_rates, sizeof(table_ltm_rates) / sizeof(char*) },
+	{ table_mag_hardware, sizeof(table_mag_hardware) / sizeof(char*) },
+	{ table_motor_pwm_protocol, sizeof(table_motor_pwm_protocol) / sizeof(char*) },
+	{ table_nav_extra_arming_safety, sizeof(table_nav_extra_arming_safety) / sizeof(char*) },
+	{ table_nav_rth_allow_landing, sizeof(table_nav_rth_allow_landing) / sizeof(char*) },
+	{ table_nav_rth_alt_mode, sizeof(table_nav_rth_alt_mode) / sizeof(char*) },
+	{ table_nav_user_control_mode, sizeof(table_nav_user_control_mode) / sizeof(char*) },
+	{ table_off_on, sizeof(table_off_on) / sizeof(char*) },
+	{ table_opflow_hardware, sizeof(table_opflow_hardware) / sizeof(char*) },
+	{ table_pidTypeTable, sizeof(table_pidTypeTable) / sizeof(char*) },
+	{ table_pitot_hardware, sizeof(table_pitot_hardware) / sizeof(char*) },
+	{ table_platform_type, sizeof(table_platform_type) / sizeof(char*) },
+	{ table_rangefinder_hardware, sizeof(table_rangefinder_hardware) / sizeof(char*) },
+	{ table_receiver_type, sizeof(table_receiver_type) / sizeof(char*) },
+	{ table_reset_type, sizeof(table_reset_type) / sizeof(char*) },
+	{ table_rssi_source, sizeof(table_rssi_source) / sizeof(char*) },
+	{ table_serial_rx, sizeof(table_serial_rx) / sizeof(char*) },
+	{ table_servo_protocol, sizeof(table_servo_protocol) / sizeof(char*) },
+	{ table_smartport_fuel_unit, sizeof(table_smartport_fuel_unit) / sizeof(char*) },
+	{ table_tz_automatic_dst, sizeof(table_tz_automatic_dst) / sizeof(char*) },
+	{ table_voltage_sensor, sizeof(table_voltage_sensor) / sizeof(char*) },
+	{ table_vtx_low_power_disarm, sizeof(table_vtx_low_power_disarm) / sizeof(char*) },
+};
+static const uint32_t settingMinMaxTable[] = {
+	0,
+	100,
+	1000,
+	200,
+	255,
+	1,
+	2000,
+	10,
+	500,
+	65535,
+	5,
+	10000,
+	32767,
+	-32768,
+	50,
+	5000,
+	-1800,
+	4,
+	8,
+	180,
+	3600,
+	65000,
+	4294967295,
+	2,
+	20,
+	30,
+	250,
+	3,
+	80,
+	90,
+	900,
+	8192,
+	16000,
+	60000,
+	2147483647,
+	-800,
+	6,
+	15,
+	16,
+	45,
+	60,
+	120,
+	450,
+	750,
+	800,
+	2250,
+	9999,
+	500000,
+	-18000,
+	-10000,
+	-1440,
+	-1000,
+	-180,
+	-90,
+	-20,
+	-1,
+	9,
+	18,
+	32,
+	40,
+	48,
+	126,
+	128,
+	300,
+	359,
+	400,
+	498,
+	1440,
+	4000,
+	9000,
+	18000,
+	20000,
+	32000,
+};
+typedef uint8_t setting_min_max_idx_t;
+#define SETTING_INDEXES_GET_MIN(val) (val->config.minmax.indexes[0])
+#define SETTING_INDEXES_GET_MAX(val) (val->config.minmax.indexes[1])
+static const setting_t settingsTable[] = {
+	// PG_GYRO_CONFIG
+	{ {232, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 69}, offsetof(gyroConfig_t, looptime) },
+	{ {7, 174, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, gyroSync) },
+	{ {144, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 18}, offsetof(gyroConfig_t, pidProcessDenom) },
+	{ {22, 7, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(gyroConfig_t, gyro_align) },
+	{ {7, 35, 17, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_LPF }, offsetof(gyroConfig_t, gyro_lpf) },
+	{ {7, 17, 16, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(gyroConfig_t, gyro_soft_lpf_hz) },
+	{ {7, 17, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_soft_lpf_type) },
+	{ {242, 1, 40, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 62}, offsetof(gyroConfig_t, gyroMovementCalibrationThreshold) },
+	{ {7, 26, 16, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_notch_hz) },
+	{ {7, 26, 76, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 8}, offsetof(gyroConfig_t, gyro_notch_cutoff) },
+	{ {209, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(gyroConfig_t, gyro_stage2_lowpass_hz) },
+	{ {210, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(gyroConfig_t, gyro_stage2_lowpass_type) },
+	{ {47, 7, 26, 128, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, dynamicGyroNotchEnabled) },
+	{ {47, 7, 26, 155, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERRANGETABLE }, offsetof(gyroConfig_t, dynamicGyroNotchRange) },
+	{ {47, 7, 26, 154, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DYNAMICFILTERANALYSERTABLE }, offsetof(gyroConfig_t, dynamicGyroNotchAnalyser) },
+	{ {47, 7, 26, 171, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 27}, offsetof(gyroConfig_t, dynamicGyroNotchCount) },
+	{ {47, 7, 26, 140, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 2}, offsetof(gyroConfig_t, dynamicGyroNotchQ) },
+	{ {47, 7, 26, 18, 16}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {25, 2}, offsetof(gyroConfig_t, dynamicGyroNotchMinHz) },
+	{ {7, 83, 128, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gyroConfig_t, kalmanEnabled) },
+	{ {7, 83, 140, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 32}, offsetof(gyroConfig_t, kalman_q) },
+	{ {7, 83, 31, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 59}, offsetof(gyroConfig_t, kalman_w) },
+	{ {7, 83, 166, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 32}, offsetof(gyroConfig_t, kalman_sharpness) },
+	{ {7, 176, 2, 117, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(gyroConfig_t, gyro_to_use) },
+	// PG_ADC_CHANNEL_CONFIG
+	{ {41, 69, 46, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 17}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_BATTERY]) },
+	{ {64, 69, 46, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 17}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_RSSI]) },
+	{ {75, 69, 46, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 17}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_CURRENT]) },
+	{ {122, 69, 46, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 17}, offsetof(adcChannelConfig_t, adcFunctionChannel[ADC_AIRSPEED]) },
+	// PG_ACCELEROMETER_CONFIG
+	{ {29, 26, 16, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(accelerometerConfig_t, acc_notch_hz) },
+	{ {29, 26, 76, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 4}, offsetof(accelerometerConfig_t, acc_notch_cutoff) },
+	{ {22, 29, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(accelerometerConfig_t, acc_align) },
+	{ {29, 35, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, offsetof(accelerometerConfig_t, acc_hardware) },
+	{ {29, 17, 16, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(accelerometerConfig_t, acc_lpf_hz) },
+	{ {29, 17, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(accelerometerConfig_t, acc_soft_lpf_type) },
+	{ {91, 119, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[X]) },
+	{ {91, 120, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Y]) },
+	{ {91, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(accelerometerConfig_t, accZero.raw[Z]) },
+	{ {90, 119, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 31}, offsetof(accelerometerConfig_t, accGain.raw[X]) },
+	{ {90, 120, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 31}, offsetof(accelerometerConfig_t, accGain.raw[Y]) },
+	{ {90, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 31}, offsetof(accelerometerConfig_t, accGain.raw[Z]) },
+	// PG_RANGEFINDER_CONFIG
+	{ {141, 1, 35, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RANGEFINDER_HARDWARE }, offsetof(rangefinderConfig_t, rangefinder_hardware) },
+	{ {141, 1, 134, 1, 100}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rangefinderConfig_t, use_median_filtering) },
+	// PG_OPFLOW_CONFIG
+	{ {107, 35, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OPFLOW_HARDWARE }, offsetof(opticalFlowConfig_t, opflow_hardware) },
+	{ {107, 65, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(opticalFlowConfig_t, opflow_scale) },
+	{ {22, 107, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(opticalFlowConfig_t, opflow_align) },
+	// PG_COMPASS_CONFIG
+	{ {22, 24, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, offsetof(compassConfig_t, mag_align) },
+	{ {24, 35, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, offsetof(compassConfig_t, mag_hardware) },
+	{ {24, 178, 1, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {48, 70}, offsetof(compassConfig_t, mag_declination) },
+	{ {106, 119, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[X]) },
+	{ {106, 120, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Y]) },
+	{ {106, 8, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(compassConfig_t, magZero.raw[Z]) },
+	{ {24, 162, 1, 33, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {25, 41}, offsetof(compassConfig_t, magCalibrationTimeLimit) },
+	{ {22, 24, 12, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(compassConfig_t, rollDeciDegrees) },
+	{ {22, 24, 10, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(compassConfig_t, pitchDeciDegrees) },
+	{ {22, 24, 6, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(compassConfig_t, yawDeciDegrees) },
+	// PG_BAROMETER_CONFIG
+	{ {54, 35, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, offsetof(barometerConfig_t, baro_hardware) },
+	{ {54, 134, 1, 100, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(barometerConfig_t, use_median_filtering) },
+	{ {54, 161, 1, 177, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(barometerConfig_t, baro_calibration_tolerance) },
+	// PG_PITOTMETER_CONFIG
+	{ {108, 35, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PITOT_HARDWARE }, offsetof(pitotmeterConfig_t, pitot_hardware) },
+	{ {108, 17, 239, 1, 16}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(pitotmeterConfig_t, pitot_lpf_milli_hz) },
+	{ {108, 65, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pitotmeterConfig_t, pitot_scale) },
+	// PG_RX_CONFIG
+	{ {157, 2, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RECEIVER_TYPE }, offsetof(rxConfig_t, receiverType) },
+	{ {18, 126, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(rxConfig_t, mincheck) },
+	{ {25, 126, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(rxConfig_t, maxcheck) },
+	{ {64, 171, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RSSI_SOURCE }, offsetof(rxConfig_t, rssi_source) },
+	{ {64, 46, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 57}, offsetof(rxConfig_t, rssi_channel) },
+	{ {64, 18, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMin) },
+	{ {64, 25, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rssiMax) },
+	{ {164, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 11}, offsetof(rxConfig_t, sbusSyncInterval) },
+	{ {51, 100, 199, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rxConfig_t, rcFilterFrequency) },
+	{ {111, 139, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERIAL_RX }, offsetof(rxConfig_t, serialrx_provider) },
+	{ {111, 82, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, serialrx_inverted) },
+	{ {161, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 18}, offsetof(rxConfig_t, rx_spi_rf_channel_count) },
+	{ {143, 1, 18, 147, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {43, 45}, offsetof(rxConfig_t, rx_min_usec) },
+	{ {143, 1, 25, 147, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {43, 45}, offsetof(rxConfig_t, rx_max_usec) },
+	{ {111, 101, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(rxConfig_t, halfDuplex) },
+	// PG_BLACKBOX_CONFIG
+	{ {71, 4, 138, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, offsetof(blackboxConfig_t, rate_num) },
+	{ {71, 4, 180, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, offsetof(blackboxConfig_t, rate_denom) },
+	{ {71, 181, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, offsetof(blackboxConfig_t, device) },
+	{ {71, 168, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_COMPRESSION }, offsetof(blackboxConfig_t, compression) },
+	{ {165, 2, 98, 82, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(blackboxConfig_t, invertedCardDetection) },
+	// PG_MOTOR_CONFIG
+	{ {25, 52, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(motorConfig_t, maxthrottle) },
+	{ {18, 166, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 6}, offsetof(motorConfig_t, mincommand) },
+	{ {38, 109, 4, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 72}, offsetof(motorConfig_t, motorPwmRate) },
+	{ {38, 68, 33, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(motorConfig_t, motorAccelTimeMs) },
+	{ {38, 176, 1, 33, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(motorConfig_t, motorDecelTimeMs) },
+	{ {38, 109, 138, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, offsetof(motorConfig_t, motorPwmProtocol) },
+	{ {52, 65, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(motorConfig_t, throttleScale) },
+	{ {52, 105, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {17, 25}, offsetof(motorConfig_t, throttleIdle) },
+	{ {38, 149, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {17, 4}, offsetof(motorConfig_t, motorPoleCount) },
+	// PG_FAILSAFE_CONFIG
+	{ {13, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(failsafeConfig_t, failsafe_delay) },
+	{ {13, 158, 2, 34, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(failsafeConfig_t, failsafe_recovery_delay) },
+	{ {13, 139, 2, 34, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(failsafeConfig_t, failsafe_off_delay) },
+	{ {13, 52, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(failsafeConfig_t, failsafe_throttle) },
+	{ {13, 52, 60, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 63}, offsetof(failsafeConfig_t, failsafe_throttle_low_delay) },
+	{ {13, 137, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_procedure) },
+	{ {13, 173, 2, 40, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, offsetof(failsafeConfig_t, failsafe_stick_motion_threshold) },
+	{ {13, 2, 12, 23, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {35, 44}, offsetof(failsafeConfig_t, failsafe_fw_roll_angle) },
+	{ {13, 2, 10, 23, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {35, 44}, offsetof(failsafeConfig_t, failsafe_fw_pitch_angle) },
+	{ {13, 2, 6, 4, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {51, 2}, offsetof(failsafeConfig_t, failsafe_fw_yaw_rate) },
+	{ {13, 18, 78, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(failsafeConfig_t, failsafe_min_distance) },
+	{ {13, 18, 78, 137, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, offsetof(failsafeConfig_t, failsafe_min_distance_procedure) },
+	{ {13, 240, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(failsafeConfig_t, failsafe_mission) },
+	// PG_BOARD_ALIGNMENT
+	{ {22, 95, 12, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(boardAlignment_t, rollDeciDegrees) },
+	{ {22, 95, 10, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(boardAlignment_t, pitchDeciDegrees) },
+	{ {22, 95, 6, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 20}, offsetof(boardAlignment_t, yawDeciDegrees) },
+	// PG_BATTERY_METERS_CONFIG
+	{ {41, 86, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_SENSOR }, offsetof(batteryMetersConfig_t, voltage.type) },
+	{ {41, 65, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, voltage.scale) },
+	{ {75, 86, 65, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {49, 11}, offsetof(batteryMetersConfig_t, current.scale) },
+	{ {75, 86, 62, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(batteryMetersConfig_t, current.offset) },
+	{ {75, 86, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_SENSOR }, offsetof(batteryMetersConfig_t, current.type) },
+	{ {124, 53, 172, 2, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_VOLTAGE_SOURCE }, offsetof(batteryMetersConfig_t, voltageSource) },
+	{ {74, 63, 0, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryMetersConfig_t, cruise_power) },
+	{ {105, 63, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(batteryMetersConfig_t, idle_power) },
+	{ {27, 129, 1, 234, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(batteryMetersConfig_t, rth_energy_margin) },
+	{ {30, 167, 1, 189, 2}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 23}, offsetof(batteryMetersConfig_t, throttle_compensation_weight) },
+	// PG_BATTERY_PROFILES
+	{ {124, 163, 1, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 18}, offsetof(batteryProfile_t, cells) },
+	{ {41, 55, 98, 53, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellDetect) },
+	{ {41, 25, 55, 53, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMax) },
+	{ {41, 18, 55, 53, 0}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellMin) },
+	{ {41, 148, 1, 55, 53}, VAR_UINT16 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {1, 8}, offsetof(batteryProfile_t, voltage.cellWarning) },
+	{ {70, 72, 0, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryProfile_t, capacity.value) },
+	{ {70, 72, 148, 1, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryProfile_t, capacity.warning) },
+	{ {70, 72, 172, 1, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 22}, offsetof(batteryProfile_t, capacity.critical) },
+	{ {70, 72, 116, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_CAPACITY_UNIT }, offsetof(batteryProfile_t, capacity.unit) },
+	// PG_MIXER_CONFIG
+	{ {38, 99, 82, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, motorDirectionInverted) },
+	{ {148, 2, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PLATFORM_TYPE }, offsetof(mixerConfig_t, platformType) },
+	{ {211, 1, 196, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(mixerConfig_t, hasFlaps) },
+	{ {135, 1, 152, 2, 15}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {55, 12}, offsetof(mixerConfig_t, appliedMixerPreset) },
+	{ {204, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 42}, offsetof(mixerConfig_t, fwMinThrottleDownPitchAngle) },
+	// PG_REVERSIBLE_MOTORS_CONFIG
+	{ {67, 32, 60, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(reversibleMotorsConfig_t, deadband_low) },
+	{ {67, 32, 212, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(reversibleMotorsConfig_t, deadband_high) },
+	{ {67, 137, 2, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(reversibleMotorsConfig_t, neutral) },
+	// PG_SERVO_CONFIG
+	{ {66, 138, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERVO_PROTOCOL }, offsetof(servoConfig_t, servo_protocol) },
+	{ {66, 164, 1, 153, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(servoConfig_t, servoCenterPulse) },
+	{ {66, 109, 4, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 66}, offsetof(servoConfig_t, servoPwmRate) },
+	{ {66, 17, 16, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {0, 65}, offsetof(servoConfig_t, servo_lowpass_freq) },
+	{ {195, 1, 144, 1, 62}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 42}, offsetof(servoConfig_t, flaperon_throw_offset) },
+	{ {179, 2, 182, 2, 66}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(servoConfig_t, tri_unarmed_servo) },
+	// PG_CONTROL_RATE_PROFILES
+	{ {30, 238, 1, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcMid8) },
+	{ {30, 48, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.rcExpo8) },
+	{ {145, 1, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, throttle.dynPID) },
+	{ {145, 1, 160, 1, 0}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {2, 6}, offsetof(controlRateConfig_t, throttle.pa_breakpoint) },
+	{ {205, 1, 0, 0, 0}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 15}, offsetof(controlRateConfig_t, throttle.fixedWingTauMs) },
+	{ {51, 48, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcExpo8) },
+	{ {51, 6, 48, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, stabilized.rcYawExpo8) },
+	{ {12, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {36, 19}, offsetof(controlRateConfig_t, stabilized.rates[FD_ROLL]) },
+	{ {10, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {36, 19}, offsetof(controlRateConfig_t, stabilized.rates[FD_PITCH]) },
+	{ {6, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {23, 19}, offsetof(controlRateConfig_t, stabilized.rates[FD_YAW]) },
+	{ {37, 51, 48, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcExpo8) },
+	{ {37, 51, 6, 48, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rcYawExpo8) },
+	{ {37, 12, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_ROLL]) },
+	{ {37, 10, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_PITCH]) },
+	{ {37, 6, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(controlRateConfig_t, manual.rates[FD_YAW]) },
+	{ {198, 1, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 14}, offsetof(controlRateConfig_t, misc.fpvCamAngleDegrees) },
+	// PG_SERIAL_CONFIG
+	{ {156, 2, 165, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {60, 61}, offsetof(serialConfig_t, reboot_character) },
+	// PG_IMU_CONFIG
+	{ {58, 77, 131, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_acc) },
+	{ {58, 77, 130, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_acc) },
+	{ {58, 77, 131, 1, 24}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_kp_mag) },
+	{ {58, 77, 130, 1, 24}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(imuConfig_t, dcm_ki_mag) },
+	{ {168, 2, 23, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, offsetof(imuConfig_t, small_angle) },
+	{ {58, 29, 217, 1, 4}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 24}, offsetof(imuConfig_t, acc_ignore_rate) },
+	{ {218, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(imuConfig_t, acc_ignore_slope) },
+	// PG_ARMING_CONFIG
+	{ {193, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, fixed_wing_auto_arm) },
+	{ {57, 228, 1, 113, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(armingConfig_t, disarm_kill_switch) },
+	{ {113, 57, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(armingConfig_t, switchDisarmDelayMs) },
+	// PG_GENERAL_SETTINGS
+	{ {155, 1, 179, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, offsetof(generalSettings_t, appliedDefaults) },
+	// PG_GPS_CONFIG
+	{ {20, 139, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_PROVIDER }, offsetof(gpsConfig_t, provider) },
+	{ {20, 163, 2, 61, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_SBAS_MODE }, offsetof(gpsConfig_t, sbasMode) },
+	{ {20, 185, 1, 135, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_DYN_MODEL }, offsetof(gpsConfig_t, dynModel) },
+	{ {20, 45, 169, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoConfig) },
+	{ {20, 45, 157, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, autoBaud) },
+	{ {208, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(gpsConfig_t, ubloxUseGalileo) },
+	{ {20, 18, 162, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 7}, offsetof(gpsConfig_t, gpsMinSats) },
+	// PG_RC_CONTROLS_CONFIG
+	{ {32, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 58}, offsetof(rcControlsConfig_t, deadband) },
+	{ {6, 32, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(rcControlsConfig_t, yaw_deadband) },
+	{ {11, 104, 32, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {23, 26}, offsetof(rcControlsConfig_t, pos_hold_deadband) },
+	{ {123, 104, 32, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 26}, offsetof(rcControlsConfig_t, alt_hold_deadband) },
+	{ {67, 32, 52, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(rcControlsConfig_t, mid_throttle_deadband) },
+	{ {3, 121, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AIRMODEHANDLINGTYPE }, offsetof(rcControlsConfig_t, airmodeHandlingType) },
+	{ {3, 121, 40, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(rcControlsConfig_t, airmodeThrottleThreshold) },
+	// PG_PID_PROFILE
+	{ {3, 5, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].P) },
+	{ {3, 14, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].I) },
+	{ {3, 19, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].D) },
+	{ {3, 73, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_PITCH].FF) },
+	{ {3, 5, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].P) },
+	{ {3, 14, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].I) },
+	{ {3, 19, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].D) },
+	{ {3, 73, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_ROLL].FF) },
+	{ {3, 5, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].P) },
+	{ {3, 14, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].I) },
+	{ {3, 19, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].D) },
+	{ {3, 73, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_YAW].FF) },
+	{ {3, 5, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].P) },
+	{ {3, 14, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].I) },
+	{ {3, 19, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_mc.pid[PID_LEVEL].D) },
+	{ {2, 5, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].P) },
+	{ {2, 14, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].I) },
+	{ {2, 80, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_PITCH].FF) },
+	{ {2, 5, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].P) },
+	{ {2, 14, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].I) },
+	{ {2, 80, 12, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_ROLL].FF) },
+	{ {2, 5, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].P) },
+	{ {2, 14, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].I) },
+	{ {2, 80, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_YAW].FF) },
+	{ {2, 5, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].P) },
+	{ {2, 14, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].I) },
+	{ {2, 19, 36, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, bank_fw.pid[PID_LEVEL].D) },
+	{ {237, 1, 0, 0, 0}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 30}, offsetof(pidProfile_t, max_angle_inclination[FD_ROLL]) },
+	{ {236, 1, 0, 0, 0}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 30}, offsetof(pidProfile_t, max_angle_inclination[FD_PITCH]) },
+	{ {79, 17, 16, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf_hz) },
+	{ {79, 17, 15, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf_type) },
+	{ {79, 133, 1, 16, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, dterm_lpf2_hz) },
+	{ {79, 133, 1, 15, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, offsetof(pidProfile_t, dterm_lpf2_type) },
+	{ {6, 17, 16, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, yaw_lpf_hz) },
+	{ {2, 59, 144, 1, 50}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, offsetof(pidProfile_t, fixedWingItermThrowLimit) },
+	{ {2, 230, 1, 99, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DIRECTION }, offsetof(pidProfile_t, loiter_direction) },
+	{ {2, 159, 2, 122, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 15}, offsetof(pidProfile_t, fixedWingReferenceAirspeed) },
+	{ {206, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 23}, offsetof(pidProfile_t, fixedWingCoordinatedYawGain) },
+	{ {203, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, offsetof(pidProfile_t, fixedWingItermLimitOnStickPosition) },
+	{ {136, 1, 50, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 2}, offsetof(pidProfile_t, pidSumLimit) },
+	{ {136, 1, 50, 6, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 2}, offsetof(pidProfile_t, pidSumLimitYaw) },
+	{ {59, 190, 2, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 29}, offsetof(pidProfile_t, itermWindupPointPercent) },
+	{ {4, 68, 50, 12, 10}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 47}, offsetof(pidProfile_t, axisAccelerationLimitRollPitch) },
+	{ {4, 68, 50, 6, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 47}, offsetof(pidProfile_t, axisAccelerationLimitYaw) },
+	{ {103, 104, 4, 50, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 26}, offsetof(pidProfile_t, heading_hold_rate_limit) },
+	{ {1, 3, 11, 8, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_Z].P) },
+	{ {1, 3, 42, 8, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].P) },
+	{ {1, 3, 42, 8, 14}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].I) },
+	{ {1, 3, 42, 8, 19}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_Z].D) },
+	{ {1, 3, 11, 28, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_POS_XY].P) },
+	{ {1, 3, 42, 28, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].P) },
+	{ {1, 3, 42, 28, 14}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].I) },
+	{ {1, 3, 42, 28, 19}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].D) },
+	{ {1, 3, 42, 28, 80}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_VEL_XY].FF) },
+	{ {1, 3, 103, 5, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_mc.pid[PID_HEADING].P) },
+	{ {131, 2, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidProfile_t, navVelXyDTermLpfHz) },
+	{ {1, 2, 11, 8, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].P) },
+	{ {1, 2, 11, 8, 14}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].I) },
+	{ {1, 2, 11, 8, 19}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_Z].D) },
+	{ {1, 2, 11, 28, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].P) },
+	{ {1, 2, 11, 28, 14}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].I) },
+	{ {1, 2, 11, 28, 19}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_XY].D) },
+	{ {1, 2, 103, 5, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_HEADING].P) },
+	{ {1, 2, 11, 102, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].P) },
+	{ {1, 2, 11, 102, 14}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].I) },
+	{ {1, 2, 11, 102, 19}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, offsetof(pidProfile_t, bank_fw.pid[PID_POS_HEADING].D) },
+	{ {249, 1, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 2}, offsetof(pidProfile_t, navFwPosHdgPidsumLimit) },
+	{ {3, 59, 110, 15, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX_TYPE }, offsetof(pidProfile_t, iterm_relax_type) },
+	{ {3, 59, 110, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX }, offsetof(pidProfile_t, iterm_relax) },
+	{ {3, 59, 110, 76, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 1}, offsetof(pidProfile_t, iterm_relax_cutoff) },
+	{ {19, 159, 1, 191, 1}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 27}, offsetof(pidProfile_t, dBoostFactor) },
+	{ {174, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {2, 32}, offsetof(pidProfile_t, dBoostMaxAtAlleceleration) },
+	{ {173, 1, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 26}, offsetof(pidProfile_t, dBoostGyroDeltaLpfHz) },
+	{ {92, 207, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 24}, offsetof(pidProfile_t, antigravityGain) },
+	{ {92, 152, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 24}, offsetof(pidProfile_t, antigravityAccelerator) },
+	{ {92, 76, 17, 16, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 25}, offsetof(pidProfile_t, antigravityCutoff) },
+	{ {143, 2, 15, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PIDTYPETABLE }, offsetof(pidProfile_t, pidControllerType) },
+	{ {3, 73, 17, 16, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 3}, offsetof(pidProfile_t, controlDerivativeLpfHz) },
+	// PG_PID_AUTOTUNE_CONFIG
+	{ {2, 93, 142, 2, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 8}, offsetof(pidAutotuneConfig_t, fw_overshoot_time) },
+	{ {2, 93, 183, 2, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 8}, offsetof(pidAutotuneConfig_t, fw_undershoot_time) },
+	{ {2, 93, 40, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_max_rate_threshold) },
+	{ {202, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(pidAutotuneConfig_t, fw_ff_to_p_gain) },
+	{ {201, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 15}, offsetof(pidAutotuneConfig_t, fw_ff_to_i_time_constant) },
+	// PG_POSITION_ESTIMATION_CONFIG
+	{ {9, 45, 24, 177, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, automatic_mag_declination) },
+	{ {220, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(positionEstimationConfig_t, gravity_calibration_tolerance) },
+	{ {9, 117, 20, 186, 2}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, use_gps_velned) },
+	{ {219, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(positionEstimationConfig_t, allow_dead_reckoning) },
+	{ {9, 142, 1, 44, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_altitude_type) },
+	{ {9, 142, 1, 81, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, offsetof(positionEstimationConfig_t, reset_home_type) },
+	{ {9, 25, 112, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(positionEstimationConfig_t, max_surface_altitude) },
+	{ {9, 31, 8, 112, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_p) },
+	{ {9, 31, 8, 112, 118}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_z_surface_v) },
+	{ {222, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_p) },
+	{ {223, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(positionEstimationConfig_t, w_xy_flow_v) },
+	{ {9, 31, 8, 54, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_baro_p) },
+	{ {9, 31, 8, 20, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_p) },
+	{ {9, 31, 8, 20, 118}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_gps_v) },
+	{ {9, 31, 28, 20, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_p) },
+	{ {9, 31, 28, 20, 118}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_gps_v) },
+	{ {226, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_z_res_v) },
+	{ {224, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(positionEstimationConfig_t, w_xy_res_v) },
+	{ {225, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(positionEstimationConfig_t, w_xyz_acc_p) },
+	{ {9, 31, 29, 158, 1}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(positionEstimationConfig_t, w_acc_bias) },
+	{ {221, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 46}, offsetof(positionEstimationConfig_t, max_eph_epv) },
+	{ {9, 54, 187, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 46}, offsetof(positionEstimationConfig_t, baro_epv) },
+	// PG_NAV_CONFIG
+	{ {1, 57, 140, 2, 84}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.disarm_on_landing) },
+	{ {135, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.use_thr_mid_for_althold) },
+	{ {244, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_EXTRA_ARMING_SAFETY }, offsetof(navConfig_t, general.flags.extra_arming_safety) },
+	{ {1, 185, 2, 97, 61}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_USER_CONTROL_MODE }, offsetof(navConfig_t, general.flags.user_control_mode) },
+	{ {1, 150, 2, 114, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 7}, offsetof(navConfig_t, general.pos_failure_timeout) },
+	{ {1, 191, 2, 154, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 11}, offsetof(navConfig_t, general.waypoint_radius) },
+	{ {136, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(navConfig_t, general.waypoint_safe_distance) },
+	{ {1, 45, 39, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_speed) },
+	{ {1, 45, 56, 4, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_auto_climb_rate) },
+	{ {1, 37, 39, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_speed) },
+	{ {1, 37, 56, 4, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, offsetof(navConfig_t, general.max_manual_climb_rate) },
+	{ {1, 84, 39, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.land_descent_rate) },
+	{ {251, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 2}, offsetof(navConfig_t, general.land_slowdown_minalt) },
+	{ {250, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 68}, offsetof(navConfig_t, general.land_slowdown_maxalt) },
+	{ {1, 186, 1, 84, 39}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, offsetof(navConfig_t, general.emerg_descent_rate) },
+	{ {1, 18, 27, 78, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(navConfig_t, general.min_rth_distance) },
+	{ {132, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.auto_overrides_motor_stop) },
+	{ {1, 27, 56, 192, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_first) },
+	{ {133, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_climb_ignore_emerg) },
+	{ {134, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, general.flags.rth_tail_first) },
+	{ {1, 27, 153, 1, 84}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALLOW_LANDING }, offsetof(navConfig_t, general.flags.rth_allow_landing) },
+	{ {1, 27, 123, 61, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALT_MODE }, offsetof(navConfig_t, general.flags.rth_alt_control_mode) },
+	{ {1, 27, 149, 1, 40}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(navConfig_t, general.rth_abort_threshold) },
+	{ {252, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, general.max_terrain_follow_altitude) },
+	{ {1, 27, 44, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(navConfig_t, general.rth_altitude) },
+	{ {1, 27, 81, 44, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(navConfig_t, general.rth_home_altitude) },
+	{ {1, 27, 81, 62, 78}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, offsetof(navConfig_t, general.rth_home_offset_distance) },
+	{ {1, 27, 81, 62, 99}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 64}, offsetof(navConfig_t, general.rth_home_offset_direction) },
+	{ {1, 3, 94, 23, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {37, 39}, offsetof(navConfig_t, mc.max_bank_angle) },
+	{ {1, 3, 214, 1, 30}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, mc.hover_throttle) },
+	{ {1, 3, 45, 57, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 11}, offsetof(navConfig_t, mc.auto_disarm_delay) },
+	{ {1, 3, 96, 39, 40}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, mc.braking_speed_threshold) },
+	{ {129, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, mc.braking_disengage_speed) },
+	{ {1, 3, 96, 114, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 15}, offsetof(navConfig_t, mc.braking_timeout) },
+	{ {254, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, offsetof(navConfig_t, mc.braking_boost_factor) },
+	{ {128, 2, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(navConfig_t, mc.braking_boost_timeout) },
+	{ {255, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 2}, offsetof(navConfig_t, mc.braking_boost_speed_threshold) },
+	{ {253, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, mc.braking_boost_disengage_speed) },
+	{ {1, 3, 96, 94, 23}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {37, 40}, offsetof(navConfig_t, mc.braking_bank_angle) },
+	{ {130, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, mc.posDecelerationTime) },
+	{ {1, 3, 11, 48, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(navConfig_t, mc.posResponseExpo) },
+	{ {1, 2, 74, 30, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, fw.cruise_throttle) },
+	{ {1, 2, 18, 30, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, fw.min_throttle) },
+	{ {1, 2, 25, 30, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, fw.max_throttle) },
+	{ {1, 2, 94, 23, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 28}, offsetof(navConfig_t, fw.max_bank_angle) },
+	{ {1, 2, 56, 23, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 28}, offsetof(navConfig_t, fw.max_climb_angle) },
+	{ {1, 2, 184, 1, 23}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 28}, offsetof(navConfig_t, fw.max_dive_angle) },
+	{ {1, 2, 147, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(navConfig_t, fw.pitch_to_throttle) },
+	{ {248, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(navConfig_t, fw.loiter_radius) },
+	{ {1, 2, 74, 39, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(navConfig_t, fw.cruise_speed) },
+	{ {1, 2, 97, 170, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 56}, offsetof(navConfig_t, fw.control_smoothness) },
+	{ {246, 1, 0, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {54, 24}, offsetof(navConfig_t, fw.land_dive_angle) },
+	{ {1, 2, 21, 187, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 11}, offsetof(navConfig_t, fw.launch_velocity_thresh) },
+	{ {1, 2, 21, 68, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 71}, offsetof(navConfig_t, fw.launch_accel_thresh) },
+	{ {1, 2, 21, 25, 23}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 19}, offsetof(navConfig_t, fw.launch_max_angle) },
+	{ {1, 2, 21, 98, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 2}, offsetof(navConfig_t, fw.launch_time_thresh) },
+	{ {1, 2, 21, 30, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, fw.launch_throttle) },
+	{ {1, 2, 21, 105, 30}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {2, 6}, offsetof(navConfig_t, fw.launch_idle_throttle) },
+	{ {1, 2, 21, 38, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, offsetof(navConfig_t, fw.launch_motor_timer) },
+	{ {247, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, offsetof(navConfig_t, fw.launch_motor_spinup_time) },
+	{ {1, 2, 21, 18, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, offsetof(navConfig_t, fw.launch_min_time) },
+	{ {1, 2, 21, 114, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, offsetof(navConfig_t, fw.launch_timeout) },
+	{ {1, 2, 21, 25, 44}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, offsetof(navConfig_t, fw.launch_max_altitude) },
+	{ {1, 2, 21, 56, 23}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 39}, offsetof(navConfig_t, fw.launch_climb_angle) },
+	{ {1, 2, 74, 6, 4}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 40}, offsetof(navConfig_t, fw.cruise_yaw_rate) },
+	{ {245, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.allow_manual_thr_increase) },
+	{ {1, 117, 2, 6, 97}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(navConfig_t, fw.useFwNavYawControl) },
+	{ {1, 2, 6, 32, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 29}, offsetof(navConfig_t, fw.yawControlDeadband) },
+	// PG_TELEMETRY_CONFIG
+	{ {89, 113, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_switch) },
+	{ {89, 82, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, telemetry_inverted) },
+	{ {49, 127, 229, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {53, 29}, offsetof(telemetryConfig_t, gpsNoFixLatitude) },
+	{ {49, 127, 231, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {52, 19}, offsetof(telemetryConfig_t, gpsNoFixLongitude) },
+	{ {49, 170, 1, 197, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, frsky_coordinate_format) },
+	{ {49, 116, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FRSKY_UNIT }, offsetof(telemetryConfig_t, frsky_unit) },
+	{ {49, 188, 2, 151, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, offsetof(telemetryConfig_t, frsky_vfas_precision) },
+	{ {49, 10, 12, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, frsky_pitch_roll) },
+	{ {160, 2, 55, 53, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, report_cell_voltage) },
+	{ {213, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 41}, offsetof(telemetryConfig_t, hottAlarmSoundInterval) },
+	{ {89, 101, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(telemetryConfig_t, halfDuplex) },
+	{ {169, 2, 200, 1, 116}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SMARTPORT_FUEL_UNIT }, offsetof(telemetryConfig_t, smartportFuelUnit) },
+	{ {216, 1, 89, 15, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, ibusTelemetryType) },
+	{ {233, 1, 184, 2, 4}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LTM_RATES }, offsetof(telemetryConfig_t, ltmUpdateRate) },
+	{ {167, 2, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(telemetryConfig_t, simGroundStationNumber) },
+	{ {87, 145, 2, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 18}, offsetof(telemetryConfig_t, simPin) },
+	{ {87, 146, 1, 227, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 9}, offsetof(telemetryConfig_t, simTransmitInterval) },
+	{ {87, 146, 1, 194, 1}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(telemetryConfig_t, simTransmitFlags) },
+	{ {150, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdHigh) },
+	{ {29, 188, 1, 40, 60}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 30}, offsetof(telemetryConfig_t, accEventThresholdLow) },
+	{ {151, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, offsetof(telemetryConfig_t, accEventThresholdNegX) },
+	{ {87, 60, 44, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, offsetof(telemetryConfig_t, simLowAltitude) },
+	{ {235, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, mavlink.extended_status_rate) },
+	{ {85, 51, 125, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, mavlink.rc_channels_rate) },
+	{ {85, 11, 4, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, mavlink.position_rate) },
+	{ {85, 189, 1, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, mavlink.extra1_rate) },
+	{ {85, 190, 1, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, offsetof(telemetryConfig_t, mavlink.extra2_rate) },
+	// PG_SYSTEM_CONFIG
+	{ {215, 1, 39, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_I2C_SPEED }, offsetof(systemConfig_t, i2c_speed) },
+	{ {175, 1, 61, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG_MODES }, offsetof(systemConfig_t, debug_mode) },
+	{ {175, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, offsetof(systemConfig_t, throttle_tilt_compensation_strength) },
+	{ {243, 1, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 38}, offsetof(systemConfig_t, name) },
+	// PG_MODE_ACTIVATION_OPERATOR_CONFIG
+	{ {241, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AUX_OPERATOR }, offsetof(modeActivationOperatorConfig_t, modeActivationOperator) },
+	// PG_STATS_CONFIG
+	{ {88, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(statsConfig_t, stats_enabled) },
+	{ {88, 115, 33, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 34}, offsetof(statsConfig_t, stats_total_time) },
+	{ {88, 115, 183, 1, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 34}, offsetof(statsConfig_t, stats_total_dist) },
+	{ {88, 115, 129, 1, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 34}, offsetof(statsConfig_t, stats_total_energy) },
+	// PG_TIME_CONFIG
+	{ {180, 2, 62, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {50, 67}, offsetof(timeConfig_t, tz_offset) },
+	{ {181, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_TZ_AUTOMATIC_DST }, offsetof(timeConfig_t, tz_automatic_dst) },
+	// PG_DISPLAY_CONFIG
+	{ {182, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(displayConfig_t, force_sw_blink) },
+	// PG_VTX_CONFIG
+	{ {43, 101, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, offsetof(vtxConfig_t, halfDuplex) },
+	// PG_VTX_SETTINGS_CONFIG
+	{ {43, 156, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, offsetof(vtxSettingsConfig_t, band) },
+	{ {43, 46, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 18}, offsetof(vtxSettingsConfig_t, channel) },
+	{ {43, 63, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 10}, offsetof(vtxSettingsConfig_t, power) },
+	{ {43, 60, 63, 57, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VTX_LOW_POWER_DISARM }, offsetof(vtxSettingsConfig_t, lowPowerDisarm) },
+	{ {43, 146, 2, 61, 125}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 18}, offsetof(vtxSettingsConfig_t, pitModeChan) },
+	{ {43, 25, 63, 141, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, offsetof(vtxSettingsConfig_t, maxPowerOverride) },
+	// PG_LOG_CONFIG
+	{ {132, 1, 36, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOG_LEVEL }, offsetof(logConfig_t, level) },
+	{ {132, 1, 178, 2, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 22}, offsetof(logConfig_t, topics) },
+};
+#define SETTING_NAME_HASH_BUCKETS 142
+static const uint8_t settingNameHashSeeds[] = {
+	10, 3, 10, 3, 6, 44, 1, 1, 2, 63, 11, 39, 14, 3, 9, 1,
+	9, 21, 6, 4, 32, 7, 10, 4, 7, 16, 1, 0, 12, 56, 1, 21,
+	8, 0, 10, 1, 11, 1, 55, 69, 12, 4, 9, 3, 12, 6, 1, 9,
+	18, 32, 1, 7, 10, 1, 3, 25, 12, 1, 9, 4, 0, 8, 14, 74,
+	50, 6, 16, 47, 4, 40, 11, 3, 66, 17, 93, 54, 15, 8, 32, 2,
+	2, 2, 2, 0, 40, 4, 21, 2, 10, 31, 5, 100, 1, 34, 8, 25,
+	23, 1, 24, 51, 0, 206, 11, 58, 16, 79, 37, 53, 18, 6, 53, 2,
+	17, 107, 52, 67, 34, 0, 32, 47, 33, 35, 6, 69, 39, 19, 134, 239,
+	31, 21, 24, 1, 4, 78, 4, 46, 0, 7, 79, 72, 67, 182,
+};
+static const uint16_t settingNameHashIndexes[] = {
+	85, 215, 366, 279, 394, 144, 64, 108, 112, 154, 167, 287, 385, 51, 76, 330,
+	352, 127, 56, 365, 140, 337, 253, 273, 220, 189, 374, 13, 66, 39, 15, 260,
+	211, 283, 132, 106, 30, 207, 123, 210, 256, 159, 133, 142, 304, 70, 81, 230,
+	325, 116, 389, 329, 264, 163, 22, 145, 282, 399, 20, 353, 198, 174, 21, 197,
+	4, 187, 180, 206, 89, 137, 7, 386, 149, 157, 320, 121, 45, 72, 160, 35,
+	83, 6, 42, 18, 199, 379, 3, 58, 341, 9, 131, 398, 252, 229, 209, 237,
+	221, 208, 383, 361, 343, 104, 319, 375, 327, 263, 261, 227, 354, 299, 113, 27,
+	251, 84, 59, 335, 297, 68, 41, 212, 270, 96, 176, 194, 218, 26, 286, 11,
+	387, 381, 323, 245, 334, 397, 24, 95, 376, 266, 360, 300, 91, 244, 178, 373,
+	234, 77, 368, 293, 240, 223, 336, 347, 44, 48, 302, 259, 53, 378, 185, 57,
+	295, 93, 301, 94, 148, 74, 396, 369, 306, 288, 107, 214, 105, 313, 101, 63,
+	114, 73, 173, 177, 331, 267, 29, 314, 190, 82, 310, 284, 235, 38, 278, 217,
+	285, 322, 182, 195, 126, 249, 400, 326, 158, 216, 298, 32, 226, 14, 16, 271,
+	246, 349, 122, 268, 31, 179, 99, 344, 315, 338, 311, 134, 357, 377, 318, 248,
+	321, 364, 356, 213, 181, 165, 47, 225, 161, 17, 79, 109, 355, 239, 280, 370,
+	55, 97, 333, 67, 92, 130, 75, 350, 262, 388, 10, 60, 303, 119, 28, 172,
+	170, 257, 1, 202, 241, 117, 54, 115, 351, 395, 186, 147, 238, 203, 98, 90,
+	102, 340, 372, 118, 200, 204, 128, 138, 192, 232, 291, 392, 348, 254, 236, 150,
+	120, 111, 65, 196, 80, 125, 8, 61, 384, 296, 290, 155, 382, 359, 265, 308,
+	34, 272, 292, 307, 87, 152, 33, 0, 103, 146, 275, 62, 281, 362, 233, 312,
+	363, 289, 141, 342, 100, 193, 309, 71, 247, 25, 78, 358, 40, 391, 183, 5,
+	269, 46, 243, 143, 305, 345, 164, 317, 228, 43, 69, 324, 367, 124, 277, 156,
+	274, 184, 166, 139, 171, 380, 153, 162, 135, 258, 151, 129, 222, 219, 231, 110,
+	19, 346, 191, 371, 2, 188, 393, 169, 339, 12, 37, 276, 390, 136, 205, 201,
+	242, 316, 86, 294, 52, 88, 49, 255, 224, 23, 36, 332, 250, 328, 168, 175,
+	50,
+};
@@ -0,0 +1,13917 @@
+# 0 "./src/main/blackbox/blackbox.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define DEBUG 1
+# 0 "<command-line>"
+#define SIMULATOR_BUILD 1
+# 0 "<command-line>"
+#define FLASH_SIZE 2048
+# 0 "<command-line>"
+#define USE_STDPERIPH_DRIVER 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "inav"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "5c97225"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "./src/main/blackbox/blackbox.c"
+# 18 "./src/main/blackbox/blackbox.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 19 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 20 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 21 "./src/main/blackbox/blackbox.c" 2
+# 1 "/usr/include/math.h" 1 3 4
+# 24 "/usr/include/math.h" 3 4
+#define _MATH_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 3 4
+#define _BITS_LIBM_SIMD_DECL_STUBS_H 1
+
+#define __DECL_SIMD_cos 
+#define __DECL_SIMD_cosf 
+#define __DECL_SIMD_cosl 
+#define __DECL_SIMD_cosf16 
+#define __DECL_SIMD_cosf32 
+#define __DECL_SIMD_cosf64 
+#define __DECL_SIMD_cosf128 
+#define __DECL_SIMD_cosf32x 
+#define __DECL_SIMD_cosf64x 
+#define __DECL_SIMD_cosf128x 
+
+#define __DECL_SIMD_sin 
+#define __DECL_SIMD_sinf 
+#define __DECL_SIMD_sinl 
+#define __DECL_SIMD_sinf16 
+#define __DECL_SIMD_sinf32 
+#define __DECL_SIMD_sinf64 
+#define __DECL_SIMD_sinf128 
+#define __DECL_SIMD_sinf32x 
+#define __DECL_SIMD_sinf64x 
+#define __DECL_SIMD_sinf128x 
+
+#define __DECL_SIMD_sincos 
+#define __DECL_SIMD_sincosf 
+#define __DECL_SIMD_sincosl 
+#define __DECL_SIMD_sincosf16 
+#define __DECL_SIMD_sincosf32 
+#define __DECL_SIMD_sincosf64 
+#define __DECL_SIMD_sincosf128 
+#define __DECL_SIMD_sincosf32x 
+#define __DECL_SIMD_sincosf64x 
+#define __DECL_SIMD_sincosf128x 
+
+#define __DECL_SIMD_log 
+#define __DECL_SIMD_logf 
+#define __DECL_SIMD_logl 
+#define __DECL_SIMD_logf16 
+#define __DECL_SIMD_logf32 
+#define __DECL_SIMD_logf64 
+#define __DECL_SIMD_logf128 
+#define __DECL_SIMD_logf32x 
+#define __DECL_SIMD_logf64x 
+#define __DECL_SIMD_logf128x 
+
+#define __DECL_SIMD_exp 
+#define __DECL_SIMD_expf 
+#define __DECL_SIMD_expl 
+#define __DECL_SIMD_expf16 
+#define __DECL_SIMD_expf32 
+#define __DECL_SIMD_expf64 
+#define __DECL_SIMD_expf128 
+#define __DECL_SIMD_expf32x 
+#define __DECL_SIMD_expf64x 
+#define __DECL_SIMD_expf128x 
+
+#define __DECL_SIMD_pow 
+#define __DECL_SIMD_powf 
+#define __DECL_SIMD_powl 
+#define __DECL_SIMD_powf16 
+#define __DECL_SIMD_powf32 
+#define __DECL_SIMD_powf64 
+#define __DECL_SIMD_powf128 
+#define __DECL_SIMD_powf32x 
+#define __DECL_SIMD_powf64x 
+#define __DECL_SIMD_powf128x 
+
+#define __DECL_SIMD_acos 
+#define __DECL_SIMD_acosf 
+#define __DECL_SIMD_acosl 
+#define __DECL_SIMD_acosf16 
+#define __DECL_SIMD_acosf32 
+#define __DECL_SIMD_acosf64 
+#define __DECL_SIMD_acosf128 
+#define __DECL_SIMD_acosf32x 
+#define __DECL_SIMD_acosf64x 
+#define __DECL_SIMD_acosf128x 
+
+#define __DECL_SIMD_atan 
+#define __DECL_SIMD_atanf 
+#define __DECL_SIMD_atanl 
+#define __DECL_SIMD_atanf16 
+#define __DECL_SIMD_atanf32 
+#define __DECL_SIMD_atanf64 
+#define __DECL_SIMD_atanf128 
+#define __DECL_SIMD_atanf32x 
+#define __DECL_SIMD_atanf64x 
+#define __DECL_SIMD_atanf128x 
+
+#define __DECL_SIMD_asin 
+#define __DECL_SIMD_asinf 
+#define __DECL_SIMD_asinl 
+#define __DECL_SIMD_asinf16 
+#define __DECL_SIMD_asinf32 
+#define __DECL_SIMD_asinf64 
+#define __DECL_SIMD_asinf128 
+#define __DECL_SIMD_asinf32x 
+#define __DECL_SIMD_asinf64x 
+#define __DECL_SIMD_asinf128x 
+
+#define __DECL_SIMD_hypot 
+#define __DECL_SIMD_hypotf 
+#define __DECL_SIMD_hypotl 
+#define __DECL_SIMD_hypotf16 
+#define __DECL_SIMD_hypotf32 
+#define __DECL_SIMD_hypotf64 
+#define __DECL_SIMD_hypotf128 
+#define __DECL_SIMD_hypotf32x 
+#define __DECL_SIMD_hypotf64x 
+#define __DECL_SIMD_hypotf128x 
+
+#define __DECL_SIMD_exp2 
+#define __DECL_SIMD_exp2f 
+#define __DECL_SIMD_exp2l 
+#define __DECL_SIMD_exp2f16 
+#define __DECL_SIMD_exp2f32 
+#define __DECL_SIMD_exp2f64 
+#define __DECL_SIMD_exp2f128 
+#define __DECL_SIMD_exp2f32x 
+#define __DECL_SIMD_exp2f64x 
+#define __DECL_SIMD_exp2f128x 
+
+#define __DECL_SIMD_exp10 
+#define __DECL_SIMD_exp10f 
+#define __DECL_SIMD_exp10l 
+#define __DECL_SIMD_exp10f16 
+#define __DECL_SIMD_exp10f32 
+#define __DECL_SIMD_exp10f64 
+#define __DECL_SIMD_exp10f128 
+#define __DECL_SIMD_exp10f32x 
+#define __DECL_SIMD_exp10f64x 
+#define __DECL_SIMD_exp10f128x 
+
+#define __DECL_SIMD_cosh 
+#define __DECL_SIMD_coshf 
+#define __DECL_SIMD_coshl 
+#define __DECL_SIMD_coshf16 
+#define __DECL_SIMD_coshf32 
+#define __DECL_SIMD_coshf64 
+#define __DECL_SIMD_coshf128 
+#define __DECL_SIMD_coshf32x 
+#define __DECL_SIMD_coshf64x 
+#define __DECL_SIMD_coshf128x 
+
+#define __DECL_SIMD_expm1 
+#define __DECL_SIMD_expm1f 
+#define __DECL_SIMD_expm1l 
+#define __DECL_SIMD_expm1f16 
+#define __DECL_SIMD_expm1f32 
+#define __DECL_SIMD_expm1f64 
+#define __DECL_SIMD_expm1f128 
+#define __DECL_SIMD_expm1f32x 
+#define __DECL_SIMD_expm1f64x 
+#define __DECL_SIMD_expm1f128x 
+
+#define __DECL_SIMD_sinh 
+#define __DECL_SIMD_sinhf 
+#define __DECL_SIMD_sinhl 
+#define __DECL_SIMD_sinhf16 
+#define __DECL_SIMD_sinhf32 
+#define __DECL_SIMD_sinhf64 
+#define __DECL_SIMD_sinhf128 
+#define __DECL_SIMD_sinhf32x 
+#define __DECL_SIMD_sinhf64x 
+#define __DECL_SIMD_sinhf128x 
+
+#define __DECL_SIMD_cbrt 
+#define __DECL_SIMD_cbrtf 
+#define __DECL_SIMD_cbrtl 
+#define __DECL_SIMD_cbrtf16 
+#define __DECL_SIMD_cbrtf32 
+#define __DECL_SIMD_cbrtf64 
+#define __DECL_SIMD_cbrtf128 
+#define __DECL_SIMD_cbrtf32x 
+#define __DECL_SIMD_cbrtf64x 
+#define __DECL_SIMD_cbrtf128x 
+
+#define __DECL_SIMD_atan2 
+#define __DECL_SIMD_atan2f 
+#define __DECL_SIMD_atan2l 
+#define __DECL_SIMD_atan2f16 
+#define __DECL_SIMD_atan2f32 
+#define __DECL_SIMD_atan2f64 
+#define __DECL_SIMD_atan2f128 
+#define __DECL_SIMD_atan2f32x 
+#define __DECL_SIMD_atan2f64x 
+#define __DECL_SIMD_atan2f128x 
+
+#define __DECL_SIMD_log10 
+#define __DECL_SIMD_log10f 
+#define __DECL_SIMD_log10l 
+#define __DECL_SIMD_log10f16 
+#define __DECL_SIMD_log10f32 
+#define __DECL_SIMD_log10f64 
+#define __DECL_SIMD_log10f128 
+#define __DECL_SIMD_log10f32x 
+#define __DECL_SIMD_log10f64x 
+#define __DECL_SIMD_log10f128x 
+
+#define __DECL_SIMD_log2 
+#define __DECL_SIMD_log2f 
+#define __DECL_SIMD_log2l 
+#define __DECL_SIMD_log2f16 
+#define __DECL_SIMD_log2f32 
+#define __DECL_SIMD_log2f64 
+#define __DECL_SIMD_log2f128 
+#define __DECL_SIMD_log2f32x 
+#define __DECL_SIMD_log2f64x 
+#define __DECL_SIMD_log2f128x 
+
+#define __DECL_SIMD_log1p 
+#define __DECL_SIMD_log1pf 
+#define __DECL_SIMD_log1pl 
+#define __DECL_SIMD_log1pf16 
+#define __DECL_SIMD_log1pf32 
+#define __DECL_SIMD_log1pf64 
+#define __DECL_SIMD_log1pf128 
+#define __DECL_SIMD_log1pf32x 
+#define __DECL_SIMD_log1pf64x 
+#define __DECL_SIMD_log1pf128x 
+
+#define __DECL_SIMD_atanh 
+#define __DECL_SIMD_atanhf 
+#define __DECL_SIMD_atanhl 
+#define __DECL_SIMD_atanhf16 
+#define __DECL_SIMD_atanhf32 
+#define __DECL_SIMD_atanhf64 
+#define __DECL_SIMD_atanhf128 
+#define __DECL_SIMD_atanhf32x 
+#define __DECL_SIMD_atanhf64x 
+#define __DECL_SIMD_atanhf128x 
+
+#define __DECL_SIMD_acosh 
+#define __DECL_SIMD_acoshf 
+#define __DECL_SIMD_acoshl 
+#define __DECL_SIMD_acoshf16 
+#define __DECL_SIMD_acoshf32 
+#define __DECL_SIMD_acoshf64 
+#define __DECL_SIMD_acoshf128 
+#define __DECL_SIMD_acoshf32x 
+#define __DECL_SIMD_acoshf64x 
+#define __DECL_SIMD_acoshf128x 
+
+#define __DECL_SIMD_erf 
+#define __DECL_SIMD_erff 
+#define __DECL_SIMD_erfl 
+#define __DECL_SIMD_erff16 
+#define __DECL_SIMD_erff32 
+#define __DECL_SIMD_erff64 
+#define __DECL_SIMD_erff128 
+#define __DECL_SIMD_erff32x 
+#define __DECL_SIMD_erff64x 
+#define __DECL_SIMD_erff128x 
+
+#define __DECL_SIMD_tanh 
+#define __DECL_SIMD_tanhf 
+#define __DECL_SIMD_tanhl 
+#define __DECL_SIMD_tanhf16 
+#define __DECL_SIMD_tanhf32 
+#define __DECL_SIMD_tanhf64 
+#define __DECL_SIMD_tanhf128 
+#define __DECL_SIMD_tanhf32x 
+#define __DECL_SIMD_tanhf64x 
+#define __DECL_SIMD_tanhf128x 
+
+#define __DECL_SIMD_asinh 
+#define __DECL_SIMD_asinhf 
+#define __DECL_SIMD_asinhl 
+#define __DECL_SIMD_asinhf16 
+#define __DECL_SIMD_asinhf32 
+#define __DECL_SIMD_asinhf64 
+#define __DECL_SIMD_asinhf128 
+#define __DECL_SIMD_asinhf32x 
+#define __DECL_SIMD_asinhf64x 
+#define __DECL_SIMD_asinhf128x 
+
+#define __DECL_SIMD_erfc 
+#define __DECL_SIMD_erfcf 
+#define __DECL_SIMD_erfcl 
+#define __DECL_SIMD_erfcf16 
+#define __DECL_SIMD_erfcf32 
+#define __DECL_SIMD_erfcf64 
+#define __DECL_SIMD_erfcf128 
+#define __DECL_SIMD_erfcf32x 
+#define __DECL_SIMD_erfcf64x 
+#define __DECL_SIMD_erfcf128x 
+
+#define __DECL_SIMD_tan 
+#define __DECL_SIMD_tanf 
+#define __DECL_SIMD_tanl 
+#define __DECL_SIMD_tanf16 
+#define __DECL_SIMD_tanf32 
+#define __DECL_SIMD_tanf64 
+#define __DECL_SIMD_tanf128 
+#define __DECL_SIMD_tanf32x 
+#define __DECL_SIMD_tanf64x 
+#define __DECL_SIMD_tanf128x 
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 44 "/usr/include/math.h" 2 3 4
+
+
+
+
+#define HUGE_VAL (__builtin_huge_val ())
+# 59 "/usr/include/math.h" 3 4
+#define HUGE_VALF (__builtin_huge_valf ())
+#define HUGE_VALL (__builtin_huge_vall ())
+# 91 "/usr/include/math.h" 3 4
+#define INFINITY (__builtin_inff ())
+
+
+
+
+
+
+#define NAN (__builtin_nanf (""))
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 3 4
+#define __GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 3 4
+#define __FP_LOGB0_IS_MIN 1
+#define __FP_LOGBNAN_IS_MIN 1
+# 205 "/usr/include/math.h" 2 3 4
+
+
+#define FP_ILOGB0 (-2147483647 - 1)
+
+
+
+
+#define FP_ILOGBNAN (-2147483647 - 1)
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+# 276 "/usr/include/math.h" 3 4
+#define __SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)
+
+#define __MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)
+
+
+
+#define __MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)
+
+
+
+#define __MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)
+
+#define __MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)
+
+
+#define __MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)
+
+#define __MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)
+
+
+#define __MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW
+
+#define __MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)
+
+
+
+#define __MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)
+
+
+#define __MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)
+
+
+#define _Mdouble_ double
+#define __MATH_PRECNAME(name,r) __CONCAT(name,r)
+#define __MATH_DECLARING_DOUBLE 1
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+
+
+
+
+#define _Mdouble_ float
+#define __MATH_PRECNAME(name,r) name ##f ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 393 "/usr/include/math.h" 3 4
+#define _Mdouble_ long double
+#define __MATH_PRECNAME(name,r) name ##l ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+#define __MATH_DECLARE_LDOUBLE 1
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 442 "/usr/include/math.h" 3 4
+#define _Mdouble_ _Float32
+#define __MATH_PRECNAME(name,r) name ##f32 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64
+#define __MATH_PRECNAME(name,r) name ##f64 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float128
+#define __MATH_PRECNAME(name,r) name ##f128 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float32x
+#define __MATH_PRECNAME(name,r) name ##f32x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64x
+#define __MATH_PRECNAME(name,r) name ##f64x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 543 "/usr/include/math.h" 3 4
+#undef __MATHDECL_1_IMPL
+#undef __MATHDECL_1
+#undef __MATHDECL_ALIAS
+#undef __MATHDECL
+#undef __MATHCALL
+
+
+#define __MATHCALL_NARROW_ARGS_1 (_Marg_ __x)
+#define __MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)
+#define __MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)
+#define __MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW
+
+#define __MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)
+
+
+#define __MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)
+# 845 "/usr/include/math.h" 3 4
+#undef __MATHCALL_NARROW_ARGS_1
+#undef __MATHCALL_NARROW_ARGS_2
+#undef __MATHCALL_NARROW_ARGS_3
+#undef __MATHCALL_NARROW_NORMAL
+#undef __MATHCALL_NARROW_REDIR
+#undef __MATHCALL_NARROW
+
+
+
+extern int signgam;
+# 884 "/usr/include/math.h" 3 4
+#define __MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,
+
+
+
+
+
+#define __MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,
+
+
+
+
+
+
+#define __MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+#define FP_NAN 0
+      0,
+    FP_INFINITE =
+#define FP_INFINITE 1
+      1,
+    FP_ZERO =
+#define FP_ZERO 2
+      2,
+    FP_SUBNORMAL =
+#define FP_SUBNORMAL 3
+      3,
+    FP_NORMAL =
+#define FP_NORMAL 4
+      4
+  };
+# 967 "/usr/include/math.h" 3 4
+#define fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)
+
+
+
+
+
+
+
+#define signbit(x) __builtin_signbit (x)
+# 994 "/usr/include/math.h" 3 4
+#define isfinite(x) __builtin_isfinite (x)
+
+
+
+
+
+
+
+#define isnormal(x) __builtin_isnormal (x)
+# 1011 "/usr/include/math.h" 3 4
+#define isnan(x) __builtin_isnan (x)
+# 1029 "/usr/include/math.h" 3 4
+#define isinf(x) __builtin_isinf_sign (x)
+
+
+
+
+
+#define MATH_ERRNO 1
+#define MATH_ERREXCEPT 2
+# 1048 "/usr/include/math.h" 3 4
+#define math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)
+# 1146 "/usr/include/math.h" 3 4
+#define M_E 2.7182818284590452354
+#define M_LOG2E 1.4426950408889634074
+#define M_LOG10E 0.43429448190325182765
+#define M_LN2 0.69314718055994530942
+#define M_LN10 2.30258509299404568402
+#define M_PI 3.14159265358979323846
+#define M_PI_2 1.57079632679489661923
+#define M_PI_4 0.78539816339744830962
+#define M_1_PI 0.31830988618379067154
+#define M_2_PI 0.63661977236758134308
+#define M_2_SQRTPI 1.12837916709551257390
+#define M_SQRT2 1.41421356237309504880
+#define M_SQRT1_2 0.70710678118654752440
+# 1305 "/usr/include/math.h" 3 4
+#define isgreater(x,y) __builtin_isgreater(x, y)
+#define isgreaterequal(x,y) __builtin_isgreaterequal(x, y)
+#define isless(x,y) __builtin_isless(x, y)
+#define islessequal(x,y) __builtin_islessequal(x, y)
+#define islessgreater(x,y) __builtin_islessgreater(x, y)
+#define isunordered(x,y) __builtin_isunordered(x, y)
+# 1471 "/usr/include/math.h" 3 4
+
+# 22 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 63 "./src/main/platform.h"
+# 1 "./src/main/target/common.h" 1
+# 18 "./src/main/target/common.h"
+       
+
+
+
+
+#define DYNAMIC_HEAP_SIZE 2048
+
+
+#define I2C1_OVERCLOCK false
+#define I2C2_OVERCLOCK false
+#define USE_I2C_PULLUP 
+
+#define USE_RX_PPM 
+#define USE_SERIAL_RX 
+#define USE_SERIALRX_SPEKTRUM 
+#define USE_SERIALRX_SBUS 
+#define USE_SERIALRX_IBUS 
+#define USE_SERIALRX_FPORT 
+
+#define COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)
+# 56 "./src/main/target/common.h"
+#define USE_ADC_AVERAGING 
+#define USE_64BIT_TIME 
+#define USE_BLACKBOX 
+#define USE_GPS 
+#define USE_GPS_PROTO_UBLOX 
+#define USE_NAV 
+#define USE_TELEMETRY 
+#define USE_TELEMETRY_LTM 
+#define USE_TELEMETRY_FRSKY 
+
+
+
+
+#define SCHEDULER_DELAY_LIMIT 100
+
+
+
+#define USE_MR_BRAKING_MODE 
+#define USE_PITOT 
+#define USE_PITOT_ADC 
+#define USE_PITOT_VIRTUAL 
+
+#define USE_DYNAMIC_FILTERS 
+#define USE_GYRO_KALMAN 
+#define USE_EXTENDED_CMS_MENUS 
+#define USE_UAV_INTERCONNECT 
+#define USE_RX_UIB 
+#define USE_HOTT_TEXTMODE 
+
+
+#define USE_GPS_PROTO_NAZA 
+
+
+#define USE_RANGEFINDER 
+#define USE_RANGEFINDER_MSP 
+#define USE_RANGEFINDER_BENEWAKE 
+#define USE_RANGEFINDER_VL53L0X 
+#define USE_RANGEFINDER_HCSR04_I2C 
+
+
+#define USE_OPFLOW 
+#define USE_OPFLOW_CXOF 
+#define USE_OPFLOW_MSP 
+
+#define USE_PITOT 
+#define USE_PITOT_MS4525 
+
+#define USE_1WIRE 
+#define USE_1WIRE_DS2482 
+
+#define USE_TEMPERATURE_SENSOR 
+#define USE_TEMPERATURE_LM75 
+#define USE_TEMPERATURE_DS18B20 
+
+#define USE_MSP_DISPLAYPORT 
+#define USE_DASHBOARD 
+#define DASHBOARD_ARMED_BITMAP 
+#define USE_OLED_UG2864 
+
+#define USE_PWM_DRIVER_PCA9685 
+
+#define USE_TELEMETRY_SIM 
+#define USE_FRSKYOSD 
+#define USE_DJI_HD_OSD 
+
+#define NAV_NON_VOLATILE_WAYPOINT_CLI 
+
+#define NAV_AUTO_MAG_DECLINATION_PRECISE 
+
+#define USE_D_BOOST 
+#define USE_ANTIGRAVITY 
+
+
+
+
+
+
+#define NAV_FIXED_WING_LANDING 
+#define USE_AUTOTUNE_FIXED_WING 
+#define USE_LOG 
+#define USE_STATS 
+#define USE_CMS 
+#define CMS_MENU_OSD 
+#define USE_GPS_PROTO_NMEA 
+#define USE_GPS_PROTO_MTK 
+#define NAV_GPS_GLITCH_DETECTION 
+#define NAV_NON_VOLATILE_WAYPOINT_STORAGE 
+#define USE_TELEMETRY_HOTT 
+#define USE_TELEMETRY_IBUS 
+#define USE_TELEMETRY_MAVLINK 
+#define USE_TELEMETRY_SMARTPORT 
+#define USE_TELEMETRY_CRSF 
+#define USE_MSP_OVER_TELEMETRY 
+
+#define USE_RX_MSP 
+
+#define USE_SERIALRX_SUMD 
+#define USE_SERIALRX_SUMH 
+#define USE_SERIALRX_XBUS 
+#define USE_SERIALRX_JETIEXBUS 
+#define USE_SERIALRX_CRSF 
+#define USE_PWM_SERVO_DRIVER 
+#define USE_SERIAL_PASSTHROUGH 
+#define NAV_MAX_WAYPOINTS 60
+#define USE_RCDEVICE 
+
+
+#define USE_VTX_CONTROL 
+#define USE_VTX_SMARTAUDIO 
+#define USE_VTX_TRAMP 
+#define USE_VTX_FFPV 
+
+
+#define USE_LOGIC_CONDITIONS 
+#define USE_GLOBAL_FUNCTIONS 
+#define USE_CLI_BATCH 
+
+
+
+#define RTC_AUTOMATIC_DST 
+
+#define USE_WIND_ESTIMATOR 
+# 64 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 25 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 29 "./src/main/target/SITL/target.h" 2
+
+
+
+
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+#define USBD_PRODUCT_STRING "SITL"
+
+#define USE_IMU_FAKE 
+#define USE_FAKE_BARO 
+#define USE_FAKE_MAG 
+#define USE_FAKE_GPS 
+
+#define USE_MAG 
+#define USE_BARO 
+
+#define USE_UART1 
+#define USE_UART2 
+#define USE_UART3 
+#define USE_UART4 
+#define USE_UART5 
+#define USE_UART6 
+#define USE_UART7 
+#define USE_UART8 
+#define SERIAL_PORT_COUNT 8
+
+#define DEFAULT_RX_TYPE RX_TYPE_MSP
+#define DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)
+
+#define MAX_PWM_OUTPUT_PORTS 16
+
+#define TARGET_IO_PORTA 0xffff
+#define TARGET_IO_PORTB 0xffff
+#define TARGET_IO_PORTC 0xffff
+
+
+#undef USE_DYNAMIC_FILTERS
+#undef USE_USB_MSC
+#undef USE_SERVO_SBUS
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+#undef USE_PWM_DRIVER_PCA9685
+#undef USE_PWM_SERVO_DRIVER
+#undef USE_RANGEFINDER
+#undef USE_RANGEFINDER_VL53L0X
+#undef USE_RANGEFINDER_HCSR04_I2C
+#undef USE_PITOT_MS4525
+#undef USE_PITOT_ADC
+#undef USE_1WIRE
+#undef USE_1WIRE_DS2482
+#undef USE_TEMPERATURE_SENSOR
+#undef USE_TEMPERATURE_LM75
+#undef USE_TEMPERATURE_DS18B20
+#undef USE_ADC
+#undef USE_VCP
+#undef USE_RX_PPM
+#undef USE_SERIALRX_SPEKTRUM
+#undef USE_RCDEVICE
+#undef USE_SERIAL_PASSTHROUGH
+#undef USE_ITCM_RAM
+
+#define SKIP_CLI_RESOURCES 
+
+
+#define USE_GYRO_STAGE_PROBE 
+
+
+#define U_ID_0 0
+#define U_ID_1 1
+#define U_ID_2 2
+
+
+
+# 101 "./src/main/target/SITL/target.h"
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct { void *test; } GPIO_TypeDef;
+typedef struct { void *test; } TIM_TypeDef;
+typedef struct { void *test; } SPI_TypeDef;
+typedef struct { void *test; } I2C_TypeDef;
+typedef struct { void *test; } USART_TypeDef;
+typedef struct { void *test; } DMA_Stream_TypeDef;
+typedef struct { void *test; } DMA_Channel_TypeDef;
+typedef uint32_t DMA_TypeDef;
+
+#define USART1 ((USART_TypeDef *)0x0001)
+#define USART2 ((USART_TypeDef *)0x0002)
+#define USART3 ((USART_TypeDef *)0x0003)
+#define UART4 ((USART_TypeDef *)0x0004)
+#define UART5 ((USART_TypeDef *)0x0005)
+#define USART6 ((USART_TypeDef *)0x0006)
+#define UART7 ((USART_TypeDef *)0x0007)
+#define UART8 ((USART_TypeDef *)0x0008)
+
+#define __NVIC_PRIO_BITS 4
+static inline void __set_BASEPRI(uint32_t basePri) { (void)basePri; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri) { (void)basePri; }
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __NOP(void) {}
+#define __NOINLINE __attribute__((noinline))
+
+extern uint32_t SystemCoreClock;
+
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+# 65 "./src/main/platform.h" 2
+# 1 "./src/main/target/sanity_check.h" 1
+# 25 "./src/main/target/sanity_check.h"
+       
+# 66 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 20 "./src/main/target/common_post.h"
+       
+
+
+
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+# 46 "./src/main/target/common_post.h"
+#define FAST_CODE 
+#define NOINLINE 
+# 61 "./src/main/target/common_post.h"
+#undef USE_DYNAMIC_FILTERS
+
+
+
+
+#define FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize("-Os")))
+#define FUNCTION_COMPILE_NORMAL __attribute__((optimize("-O2")))
+#define FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize("-Ofast")))
+#define FILE_COMPILE_FOR_SIZE _Pragma("GCC optimize(\"Os\")")
+#define FILE_COMPILE_NORMAL _Pragma("GCC optimize(\"O2\")")
+#define FILE_COMPILE_FOR_SPEED _Pragma("GCC optimize(\"Ofast\")")
+# 67 "./src/main/platform.h" 2
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+# 24 "./src/main/blackbox/blackbox.c" 2
+
+
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 18 "./src/main/blackbox/blackbox.h"
+       
+
+# 1 "./src/main/blackbox/blackbox_fielddefs.h" 1
+# 18 "./src/main/blackbox/blackbox_fielddefs.h"
+       
+
+
+
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/config/parameter_group.h" 1
+# 18 "./src/main/config/parameter_group.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+# 29 "./src/main/build/build_config.h"
+#define STATIC_UNIT_TESTED static
+#define STATIC_INLINE_UNIT_TESTED static inline
+#define INLINE_UNIT_TESTED inline
+#define UNIT_TESTED 
+
+
+
+
+
+#define REQUIRE_CC_ARM_PRINTF_SUPPORT 
+#define REQUIRE_PRINTF_LONG_SUPPORT 
+
+
+
+
+
+#define FASTRAM __attribute__ ((section(".fastram_bss"), aligned(4)))
+
+
+
+
+
+#define EXTENDED_FASTRAM 
+
+
+#define STATIC_FASTRAM static FASTRAM
+#define STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM
+# 24 "./src/main/config/parameter_group.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000,
+    PGR_SIZE_PROFILE_FLAG = 0x8000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgIsSystem(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == 0;}
+static inline uint16_t pgIsProfile(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == PGR_SIZE_PROFILE_FLAG;}
+
+#define PG_PACKED __attribute__((packed))
+# 75 "./src/main/config/parameter_group.h"
+extern const pgRegistry_t __pg_registry_start[] __asm("__start_pg_registry");
+extern const pgRegistry_t __pg_registry_end[] __asm("__stop_pg_registry");
+#define PG_REGISTER_ATTRIBUTES __attribute__ ((section("pg_registry"), used, aligned(4)))
+
+extern const uint8_t __pg_resetdata_start[] __asm("__start_pg_resetdata");
+extern const uint8_t __pg_resetdata_end[] __asm("__stop_pg_resetdata");
+#define PG_RESETDATA_ATTRIBUTES __attribute__ ((section("pg_resetdata"), used, aligned(2)))
+# 92 "./src/main/config/parameter_group.h"
+#define PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)
+
+
+#define PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)
+
+
+#define PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else
+# 107 "./src/main/config/parameter_group.h"
+#define PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)
+
+
+
+
+
+
+
+#define PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy
+# 124 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _SystemArray[_size]; extern _type _name ## _CopyArray[_size]; static inline const _type* _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy
+# 134 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy
+# 143 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name ## _System; _type _name ## _Copy; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }
+# 158 "./src/main/config/parameter_group.h"
+#define PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })
+
+
+
+
+#define PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+#define PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) _type _name ## _SystemArray[_size]; _type _name ## _CopyArray[_size]; extern const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }
+# 187 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+# 208 "./src/main/config/parameter_group.h"
+#define _PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;
+
+
+
+
+#define PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STATIC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; STATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_COUNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }
+# 228 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+
+
+#define PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }
+
+
+
+
+
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, int profileIndex, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size, uint8_t profileIndex);
+void pgResetAll(int profileCount);
+void pgResetCurrent(const pgRegistry_t *reg);
+
+# 257 "./src/main/config/parameter_group.h" 3 4
+_Bool 
+# 257 "./src/main/config/parameter_group.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg, int profileIndex);
+void pgActivateProfile(int profileIndex);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+typedef uint64_t timeUs_t;
+#define TIMEUS_MAX UINT64_MAX
+
+
+
+
+
+
+#define MILLISECS_PER_SEC 1000
+#define USECS_PER_SEC (1000 * 1000)
+
+#define HZ2US(hz) (1000000 / (hz))
+#define US2S(us) ((us) * 1e-6f)
+#define US2MS(us) ((us) * 1e-3f)
+#define MS2US(ms) ((ms) * 1000)
+#define MS2S(ms) ((ms) * 1e-3f)
+#define HZ2S(hz) US2S(HZ2US(hz))
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+typedef enum {
+    TZ_AUTO_DST_OFF,
+    TZ_AUTO_DST_EU,
+    TZ_AUTO_DST_USA,
+} tz_automatic_dst_e;
+
+typedef struct timeConfig_s {
+    int16_t tz_offset;
+    uint8_t tz_automatic_dst;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+#define FORMATTED_DATE_TIME_BUFSIZE 30
+
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *localDateTime, const dateTime_t *utcDateTime);
+
+
+
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 104 "./src/main/common/time.h" 3 4
+_Bool 
+# 104 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 105 "./src/main/common/time.h" 3 4
+_Bool 
+# 105 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 107 "./src/main/common/time.h" 3 4
+_Bool 
+# 107 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 108 "./src/main/common/time.h" 3 4
+_Bool 
+# 108 "./src/main/common/time.h"
+    rtcGetDateTimeLocal(dateTime_t *dt);
+
+# 109 "./src/main/common/time.h" 3 4
+_Bool 
+# 109 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 24 "./src/main/blackbox/blackbox_fielddefs.h" 2
+
+typedef enum FlightLogFieldCondition {
+    FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
+    FLIGHT_LOG_FIELD_CONDITION_SERVOS,
+
+    FLIGHT_LOG_FIELD_CONDITION_MAG,
+    FLIGHT_LOG_FIELD_CONDITION_BARO,
+    FLIGHT_LOG_FIELD_CONDITION_PITOT,
+    FLIGHT_LOG_FIELD_CONDITION_VBAT,
+    FLIGHT_LOG_FIELD_CONDITION_AMPERAGE,
+    FLIGHT_LOG_FIELD_CONDITION_SURFACE,
+    FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_MC_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_RSSI,
+
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2,
+
+    FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME,
+
+    FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+
+    FLIGHT_LOG_FIELD_CONDITION_NEVER,
+
+    FLIGHT_LOG_FIELD_CONDITION_FIRST = FLIGHT_LOG_FIELD_CONDITION_ALWAYS,
+    FLIGHT_LOG_FIELD_CONDITION_LAST = FLIGHT_LOG_FIELD_CONDITION_NEVER
+} FlightLogFieldCondition;
+
+typedef enum FlightLogFieldPredictor {
+
+    FLIGHT_LOG_FIELD_PREDICTOR_0 = 0,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS = 1,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE = 2,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2 = 3,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE = 4,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0 = 5,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_INC = 6,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD = 7,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_1500 = 8,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_VBATREF = 9,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10
+
+} FlightLogFieldPredictor;
+
+typedef enum FlightLogFieldEncoding {
+    FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB = 0,
+    FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB = 1,
+    FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT = 3,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB = 6,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32 = 7,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 = 8,
+    FLIGHT_LOG_FIELD_ENCODING_NULL = 9
+} FlightLogFieldEncoding;
+
+typedef enum FlightLogFieldSign {
+    FLIGHT_LOG_FIELD_UNSIGNED = 0,
+    FLIGHT_LOG_FIELD_SIGNED = 1
+} FlightLogFieldSign;
+
+typedef enum FlightLogCompression {
+    FLIGHT_LOG_COMPRESSION_NONE = 0,
+    FLIGHT_LOG_COMPRESSION_HUFFMAN = 1
+} FlightLogCompression;
+
+
+#define FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_IMU_FAILURE = 40,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct flightLogEvent_syncBeep_s {
+    uint32_t time;
+} flightLogEvent_syncBeep_t;
+
+typedef struct flightLogEvent_flightMode_s {
+    uint32_t flags;
+    uint32_t lastFlags;
+} flightLogEvent_flightMode_t;
+
+typedef struct flightLogEvent_inflightAdjustment_s {
+    uint8_t adjustmentFunction;
+    
+# 140 "./src/main/blackbox/blackbox_fielddefs.h" 3 4
+   _Bool 
+# 140 "./src/main/blackbox/blackbox_fielddefs.h"
+        floatFlag;
+    int32_t newValue;
+    float newFloatValue;
+} flightLogEvent_inflightAdjustment_t;
+
+typedef struct flightLogEvent_loggingResume_s {
+    uint32_t logIteration;
+    timeUs_t currentTimeUs;
+} flightLogEvent_loggingResume_t;
+
+typedef struct flightLogEvent_IMUError_s {
+    uint32_t errorCode;
+} flightLogEvent_IMUError_t;
+
+#define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
+
+typedef union flightLogEventData_u {
+    flightLogEvent_syncBeep_t syncBeep;
+    flightLogEvent_flightMode_t flightMode;
+    flightLogEvent_inflightAdjustment_t inflightAdjustment;
+    flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_IMUError_t imuError;
+} flightLogEventData_t;
+
+typedef struct flightLogEvent_s {
+    FlightLogEvent event;
+    flightLogEventData_t data;
+} flightLogEvent_t;
+# 21 "./src/main/blackbox/blackbox.h" 2
+
+
+
+typedef struct blackboxConfig_s {
+    uint16_t rate_num;
+    uint16_t rate_denom;
+    uint8_t device;
+    uint8_t invertedCardDetection;
+    uint8_t compression;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxProcess(timeUs_t currentTimeUs);
+void blackboxStart(void);
+void blackboxFinish(void);
+
+# 41 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 41 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+uint32_t blackboxGetSnapshotsDropped(void);
+# 28 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/blackbox/blackbox_encoding.h" 1
+# 18 "./src/main/blackbox/blackbox_encoding.h"
+       
+
+int blackboxPrintf(const char *fmt, ...);
+void blackboxPrintfHeaderLine(const char *name, const char *fmt, ...);
+int blackboxPrint(const char *s);
+
+void blackboxWriteUnsignedVB(uint32_t value);
+void blackboxWriteSignedVB(int32_t value);
+void blackboxWriteSignedVBArray(int32_t *array, int count);
+void blackboxWriteSigned16VBArray(int16_t *array, int count);
+void blackboxWriteS16(int16_t value);
+void blackboxWriteTag2_3S32(int32_t *values);
+void blackboxWriteTag8_4S16(int32_t *values);
+void blackboxWriteTag8_8SVB(int32_t *values, int valueCount);
+void blackboxWriteU32(int32_t value);
+void blackboxWriteFloat(float value);
+
+void blackboxCompressFrame(uint32_t frameStart, uint8_t compressedFrameType);
+# 29 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/blackbox/blackbox_io.h" 1
+# 18 "./src/main/blackbox/blackbox_io.h"
+       
+
+
+
+
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_SERIAL = 0,
+# 35 "./src/main/blackbox/blackbox_io.h"
+    BLACKBOX_DEVICE_END
+} BlackboxDevice;
+
+typedef enum {
+    BLACKBOX_RESERVE_SUCCESS,
+    BLACKBOX_RESERVE_TEMPORARY_FAILURE,
+    BLACKBOX_RESERVE_PERMANENT_FAILURE
+} blackboxBufferReserveStatus_e;
+
+
+
+
+
+#define BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256
+
+
+
+
+
+#define BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64
+
+
+
+
+
+
+#define BLACKBOX_WRITE_BUFFER_SIZE 256
+
+typedef struct blackboxWriteBuffer_s {
+    uint32_t flushedBytes;
+    uint16_t length;
+    uint8_t data[256];
+} blackboxWriteBuffer_t;
+
+extern int32_t blackboxHeaderBudget;
+extern blackboxWriteBuffer_t blackboxWriteBuffer;
+
+void blackboxOpen(void);
+void blackboxWriteBufferFlush(void);
+void blackboxWriteBuf(const uint8_t *data, int count);
+
+
+static inline uint32_t blackboxWriteBufferPosition(void)
+{
+    return blackboxWriteBuffer.flushedBytes + blackboxWriteBuffer.length;
+}
+
+static inline void blackboxWrite(uint8_t value)
+{
+    if (blackboxWriteBuffer.length == 256) {
+        blackboxWriteBufferFlush();
+    }
+    blackboxWriteBuffer.data[blackboxWriteBuffer.length++] = value;
+}
+
+void blackboxDeviceFlush(void);
+
+# 91 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 91 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceFlushForce(void);
+
+# 92 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 92 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceOpen(void);
+void blackboxDeviceClose(void);
+
+
+# 95 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 95 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceBeginLog(void);
+
+# 96 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 96 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceEndLog(
+# 96 "./src/main/blackbox/blackbox_io.h" 3 4
+                         _Bool 
+# 96 "./src/main/blackbox/blackbox_io.h"
+                              retainLog);
+
+
+# 98 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 98 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceFull(void);
+
+void blackboxReplenishHeaderBudget(void);
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+# 30 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/build/debug.h" 1
+# 18 "./src/main/build/debug.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 19 "./src/main/build/debug.h" 2
+
+
+
+#define DEBUG32_VALUE_COUNT 8
+extern int32_t debug[8];
+extern uint8_t debugMode;
+
+#define DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}
+
+#define DEBUG_SECTION_TIMES 
+
+
+
+extern timeUs_t sectionTimes[2][4];
+
+#define TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }
+
+
+
+
+#define TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }
+# 51 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_GYRO,
+    DEBUG_AGL,
+    DEBUG_FLOW_RAW,
+    DEBUG_FLOW,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_ALWAYS,
+    DEBUG_SAG_COMP_VOLTAGE,
+    DEBUG_VIBE,
+    DEBUG_CRUISE,
+    DEBUG_REM_FLIGHT_TIME,
+    DEBUG_SMARTAUDIO,
+    DEBUG_ACC,
+    DEBUG_ITERM_RELAX,
+    DEBUG_ERPM,
+    DEBUG_RPM_FILTER,
+    DEBUG_RPM_FREQ,
+    DEBUG_NAV_YAW,
+    DEBUG_DYNAMIC_FILTER,
+    DEBUG_DYNAMIC_FILTER_FREQUENCY,
+    DEBUG_IRLOCK,
+    DEBUG_CD,
+    DEBUG_KALMAN,
+    DEBUG_SDCARD,
+    DEBUG_COUNT
+} debugType_e;
+# 32 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/build/version.h" 1
+# 18 "./src/main/build/version.h"
+#define FC_VERSION_MAJOR 2
+#define FC_VERSION_MINOR 6
+#define FC_VERSION_PATCH_LEVEL 0
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+#define FC_VERSION_STRING STR(FC_VERSION_MAJOR) "." STR(FC_VERSION_MINOR) "." STR(FC_VERSION_PATCH_LEVEL)
+#define FC_FIRMWARE_NAME "INAV"
+
+#define MW_VERSION 231
+
+extern const char* const compilerVersion;
+extern const char* const targetName;
+
+#define GIT_SHORT_REVISION_LENGTH 8
+extern const char* const shortGitRevision;
+
+#define BUILD_DATE_LENGTH 11
+extern const char* const buildDate;
+
+#define BUILD_TIME_LENGTH 8
+extern const char* const buildTime;
+# 33 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/common/axis.h" 1
+# 18 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+#define XYZ_AXIS_COUNT 3
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+#define FLIGHT_DYNAMICS_INDEX_COUNT 3
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH,
+} angle_index_t;
+
+#define ANGLE_INDEX_COUNT 2
+# 35 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/common/encoding.h" 1
+# 18 "./src/main/common/encoding.h"
+       
+
+
+
+uint32_t castFloatBytesToInt(float f);
+uint32_t zigzagEncode(int32_t value);
+# 36 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 18 "./src/main/common/maths.h"
+       
+
+
+
+
+
+#define sq(x) ((x)*(x))
+
+
+
+#define FAST_MATH 
+
+
+
+#define M_PIf 3.14159265358979323846f
+#define M_LN2f 0.69314718055994530942f
+#define M_Ef 2.71828182845904523536f
+
+#define RAD (M_PIf / 180.0f)
+
+#define DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)
+#define CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)
+
+#define CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)
+#define DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)
+
+#define DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)
+#define DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)
+
+#define DEGREES_PER_DEKADEGREE 10
+#define DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)
+#define DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)
+
+#define DEGREES_TO_RADIANS(angle) ((angle) * RAD)
+#define RADIANS_TO_DEGREES(angle) ((angle) / RAD)
+#define DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)
+#define RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)
+
+#define RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)
+#define CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)
+
+#define CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))
+#define CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))
+#define CENTIMETERS_TO_METERS(cm) (cm / 100)
+
+#define METERS_TO_CENTIMETERS(m) (m * 100)
+
+
+#define _CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))
+
+
+
+
+
+#define _CHOOSE_VAR2(prefix,unique) prefix ##unique
+#define _CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)
+#define _CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )
+
+
+
+
+
+#define MIN(a,b) _CHOOSE(<, a, b)
+#define MAX(a,b) _CHOOSE(>, a, b)
+
+#define _ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))
+
+
+
+
+#define _ABS_I(x,var) _ABS_II(x, var)
+#define ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+typedef struct filterWithBufferSample_s {
+    float value;
+    uint32_t timestamp;
+} filterWithBufferSample_t;
+
+typedef struct filterWithBufferState_s {
+    uint16_t filter_size;
+    uint16_t sample_index;
+    filterWithBufferSample_t * samples;
+} filterWithBufferState_t;
+
+typedef struct {
+    float XtY[4];
+    float XtX[4][4];
+} sensorCalibrationState_t;
+
+void sensorCalibrationResetState(sensorCalibrationState_t * state);
+void sensorCalibrationPushSampleForOffsetCalculation(sensorCalibrationState_t * state, int32_t sample[3]);
+void sensorCalibrationPushSampleForScaleCalculation(sensorCalibrationState_t * state, int axis, int32_t sample[3], int target);
+
+# 128 "./src/main/common/maths.h" 3 4
+_Bool 
+# 128 "./src/main/common/maths.h"
+    sensorCalibrationSolveForOffset(sensorCalibrationState_t * state, float result[3]);
+
+# 129 "./src/main/common/maths.h" 3 4
+_Bool 
+# 129 "./src/main/common/maths.h"
+    sensorCalibrationSolveForScale(sensorCalibrationState_t * state, float result[3]);
+
+int gcd(int num, int denom);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadbandf(float value, float deadband);
+
+int constrain(int amt, int low, int high);
+float constrainf(float amt, float low, float high);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+float scaleRangef(float x, float srcMin, float srcMax, float destMin, float destMax);
+
+int32_t wrap_18000(int32_t angle);
+int32_t wrap_36000(int32_t angle);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+int16_t quickMedianFilter3_16(int16_t * v);
+int16_t quickMedianFilter5_16(int16_t * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+#define tan_approx(x) (sin_approx(x) / cos_approx(x))
+#define asin_approx(x) (M_PIf / 2 - acos_approx(x))
+# 174 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+float bellCurve(const float x, const float curveWidth);
+# 37 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 21 "./src/main/common/utils.h" 2
+
+
+#define ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))
+#define ARRAYEND(x) (&(x)[ARRAYLEN(x)])
+
+#define CONST_CAST(type,value) ((type)(value))
+
+#define CONCAT_HELPER(x,y) x ## y
+#define CONCAT(x,y) CONCAT_HELPER(x, y)
+
+#define CONCAT3_HELPER(x,y,z) x ## y ## z
+#define CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)
+
+#define CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w
+#define CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+
+#define EXPAND_I(x) x
+#define EXPAND(x) EXPAND_I(x)
+
+
+
+
+
+#define PP_CALL(macro,...) macro(__VA_ARGS__)
+
+
+#define UNUSED(x) (void)(x)
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+
+#define BIT(x) (1 << (x))
+
+#define STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))
+
+
+
+
+
+#define BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)
+#define BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))
+
+
+
+
+
+
+
+#define LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))
+#define LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))
+#define LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))
+#define LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))
+# 86 "./src/main/common/utils.h"
+#define container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))
+
+
+
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return a-b; }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return a-b; }
+# 100 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+
+
+
+
+
+
+#define FALLTHROUGH __attribute__ ((fallthrough))
+
+
+
+
+#define UNREACHABLE() __builtin_unreachable()
+
+#define ALIGNED(x) __attribute__ ((aligned(x)))
+#define ALWAYS_INLINE inline __attribute__ ((always_inline))
+# 39 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/config/feature.h" 1
+# 18 "./src/main/config/feature.h"
+       
+
+
+
+typedef struct featureConfig_s {
+    uint32_t enabledFeatures;
+} featureConfig_t;
+
+extern featureConfig_t featureConfig_System; extern featureConfig_t featureConfig_Copy; static inline const featureConfig_t* featureConfig(void) { return &featureConfig_System; } static inline featureConfig_t* featureConfigMutable(void) { return &featureConfig_System; } struct _dummy;
+
+void latchActiveFeatures(void);
+
+# 29 "./src/main/config/feature.h" 3 4
+_Bool 
+# 29 "./src/main/config/feature.h"
+    featureConfigured(uint32_t mask);
+
+# 30 "./src/main/config/feature.h" 3 4
+_Bool 
+# 30 "./src/main/config/feature.h"
+    feature(uint32_t mask);
+void featureSet(uint32_t mask);
+void featureClear(uint32_t mask);
+void featureClearAll(void);
+uint32_t featureMask(void);
+# 41 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/config/parameter_group_ids.h" 1
+# 19 "./src/main/config/parameter_group_ids.h"
+#define PG_CF_START 1
+#define PG_FAILSAFE_CONFIG 1
+#define PG_BOARD_ALIGNMENT 2
+
+#define PG_MOTOR_MIXER 4
+#define PG_BLACKBOX_CONFIG 5
+#define PG_MOTOR_CONFIG 6
+
+
+
+#define PG_GYRO_CONFIG 10
+#define PG_BATTERY_PROFILES 11
+#define PG_CONTROL_RATE_PROFILES 12
+#define PG_SERIAL_CONFIG 13
+#define PG_PID_PROFILE 14
+
+#define PG_ARMING_CONFIG 16
+
+#define PG_SYSTEM_CONFIG 18
+#define PG_FEATURE_CONFIG 19
+#define PG_MIXER_CONFIG 20
+#define PG_SERVO_MIXER 21
+#define PG_IMU_CONFIG 22
+
+#define PG_RX_CONFIG 24
+#define PG_RC_CONTROLS_CONFIG 25
+#define PG_REVERSIBLE_MOTORS_CONFIG 26
+#define PG_LED_STRIP_CONFIG 27
+
+
+#define PG_GPS_CONFIG 30
+#define PG_TELEMETRY_CONFIG 31
+
+
+
+#define PG_ACCELEROMETER_CONFIG 35
+
+
+#define PG_ADJUSTMENT_RANGE_CONFIG 37
+#define PG_BAROMETER_CONFIG 38
+
+#define PG_COMPASS_CONFIG 40
+#define PG_MODE_ACTIVATION_PROFILE 41
+
+#define PG_SERVO_PARAMS 42
+
+#define PG_RX_CHANNEL_RANGE_CONFIG 44
+#define PG_BATTERY_METERS_CONFIG 45
+
+
+
+
+
+
+
+#define PG_SERVO_CONFIG 52
+
+#define PG_VTX_CONFIG 54
+#define PG_ELERES_CONFIG 55
+#define PG_TEMP_SENSOR_CONFIG 56
+#define PG_CF_END 56
+
+
+
+
+
+
+#define PG_VTX_SETTINGS_CONFIG 259
+
+
+#define PG_INAV_START 1000
+#define PG_PITOTMETER_CONFIG 1000
+#define PG_POSITION_ESTIMATION_CONFIG 1001
+#define PG_NAV_CONFIG 1002
+#define PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003
+#define PG_OSD_CONFIG 1004
+#define PG_BEEPER_CONFIG 1005
+#define PG_RANGEFINDER_CONFIG 1006
+#define PG_WAYPOINT_MISSION_STORAGE 1007
+#define PG_PID_AUTOTUNE_CONFIG 1008
+#define PG_STATS_CONFIG 1009
+#define PG_ADC_CHANNEL_CONFIG 1010
+#define PG_TIME_CONFIG 1011
+#define PG_OPFLOW_CONFIG 1012
+#define PG_DISPLAY_CONFIG 1013
+#define PG_LIGHTS_CONFIG 1014
+#define PG_PINIOBOX_CONFIG 1015
+#define PG_LOGIC_CONDITIONS 1016
+#define PG_LOG_CONFIG 1017
+#define PG_RCDEVICE_CONFIG 1018
+#define PG_GENERAL_SETTINGS 1019
+#define PG_GLOBAL_FUNCTIONS 1020
+#define PG_ESC_SENSOR_CONFIG 1021
+#define PG_RPM_FILTER_CONFIG 1022
+#define PG_GLOBAL_VARIABLE_CONFIG 1023
+#define PG_INAV_END 1023
+
+
+
+
+
+
+
+#define PG_RESERVED_FOR_TESTING_1 4095
+#define PG_RESERVED_FOR_TESTING_2 4094
+#define PG_RESERVED_FOR_TESTING_3 4093
+
+#define PG_ID_INVALID 0
+#define PG_ID_FIRST PG_CF_START
+#define PG_ID_LAST PG_INAV_END
+# 43 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 18 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/exti.h" 1
+# 19 "./src/main/drivers/exti.h"
+       
+
+# 1 "./src/main/drivers/io_types.h" 1
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+
+
+#define IOTAG_NONE ((ioTag_t)0)
+
+
+#define IO_NONE ((IO_t)0)
+# 28 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 22 "./src/main/drivers/exti.h" 2
+
+
+typedef struct extiConfig_s {
+    ioTag_t tag;
+} extiConfig_t;
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+
+
+
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, EXTITrigger_TypeDef trigger);
+
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 44 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 44 "./src/main/drivers/exti.h"
+                             enable);
+# 24 "./src/main/drivers/accgyro/accgyro.h" 2
+# 1 "./src/main/drivers/sensor.h" 1
+# 18 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/bus.h" 1
+# 25 "./src/main/drivers/bus.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 18 "./src/main/drivers/resource.h"
+       
+
+#define RESOURCE_INDEX(x) (x + 1)
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMIO,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_SOFTSERIAL,
+    OWNER_ADC,
+    OWNER_SERIAL,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_RANGEFINDER,
+    OWNER_SYSTEM,
+    OWNER_SPI,
+    OWNER_I2C,
+    OWNER_SDCARD,
+    OWNER_FLASH,
+    OWNER_USB,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_BARO,
+    OWNER_MPU,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_LED,
+    OWNER_RX,
+    OWNER_TX,
+    OWNER_RX_SPI,
+    OWNER_VTX,
+    OWNER_SPI_PREINIT,
+    OWNER_COMPASS,
+    OWNER_TEMPERATURE,
+    OWNER_1WIRE,
+    OWNER_AIRSPEED,
+    OWNER_OLED_DISPLAY,
+    OWNER_PINIO,
+    OWNER_IRLOCK,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+
+
+
+typedef enum {
+    RESOURCE_NONE = 0,
+    RESOURCE_INPUT, RESOURCE_OUTPUT, RESOURCE_IO,
+    RESOURCE_TIMER,
+    RESOURCE_UART_TX, RESOURCE_UART_RX, RESOURCE_UART_TXRX,
+    RESOURCE_EXTI,
+    RESOURCE_I2C_SCL, RESOURCE_I2C_SDA,
+    RESOURCE_SPI_SCK, RESOURCE_SPI_MOSI, RESOURCE_SPI_MISO, RESOURCE_SPI_CS,
+    RESOURCE_ADC_CH1, RESOURCE_ADC_CH2, RESOURCE_ADC_CH3, RESOURCE_ADC_CH4,
+    RESOURCE_RX_CE,
+    RESOURCE_TOTAL_COUNT
+} resourceType_e;
+
+extern const char * const resourceNames[RESOURCE_TOTAL_COUNT];
+# 33 "./src/main/drivers/bus.h" 2
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 18 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+
+
+#define I2C_TIMEOUT (10000)
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+       
+
+typedef uint8_t rccPeriphTag_t;
+# 29 "./src/main/drivers/bus_i2c.h" 2
+
+typedef enum {
+    I2C_SPEED_100KHZ = 2,
+    I2C_SPEED_200KHZ = 3,
+    I2C_SPEED_400KHZ = 0,
+    I2C_SPEED_800KHZ = 1,
+} I2CSpeed;
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_EMULATED = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+
+
+
+    I2CDEV_COUNT
+} I2CDevice;
+
+typedef struct i2cDevice_s {
+    I2C_TypeDef *dev;
+    ioTag_t scl;
+    ioTag_t sda;
+    rccPeriphTag_t rcc;
+    I2CSpeed speed;
+
+
+
+
+
+} i2cDevice_t;
+
+void i2cSetSpeed(uint8_t speed);
+void i2cInit(I2CDevice device);
+
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, const uint8_t *data, 
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                                     _Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+                                                                                                          allowRawAccess);
+
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data, 
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                         _Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+                                                                              allowRawAccess);
+
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf, 
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                     _Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+                                                                                          allowRawAccess);
+
+uint16_t i2cGetErrorCounter(void);
+# 34 "./src/main/drivers/bus.h" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 18 "./src/main/drivers/bus_spi.h"
+       
+
+
+
+# 1 "./src/main/drivers/dma.h" 1
+# 18 "./src/main/drivers/dma.h"
+       
+
+
+
+struct dmaChannelDescriptor_s;
+
+typedef uint16_t dmaTag_t;
+typedef struct dmaChannelDescriptor_s * DMA_t;
+
+
+
+
+
+#define DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )
+#define DMA_NONE (0)
+
+#define DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )
+#define DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )
+#define DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )
+
+typedef void (*dmaCallbackHandlerFuncPtr)(DMA_t channelDescriptor);
+
+typedef struct dmaChannelDescriptor_s {
+    dmaTag_t tag;
+    DMA_TypeDef* dma;
+
+
+
+    DMA_Channel_TypeDef* ref;
+
+    dmaCallbackHandlerFuncPtr irqHandlerCallback;
+    uint32_t flagsShift;
+    IRQn_Type irqNumber;
+    uint32_t userParam;
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} dmaChannelDescriptor_t;
+# 87 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }
+# 97 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }
+
+
+
+
+#define DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)
+#define DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))
+
+#define DMA_IT_TCIF ((uint32_t)0x00000002)
+#define DMA_IT_HTIF ((uint32_t)0x00000004)
+#define DMA_IT_TEIF ((uint32_t)0x00000008)
+
+DMA_t dmaGetByRef(const DMA_Channel_TypeDef * ref);
+
+
+
+DMA_t dmaGetByTag(dmaTag_t tag);
+uint32_t dmaGetChannelByTag(dmaTag_t tag);
+resourceOwner_e dmaGetOwner(DMA_t dma);
+void dmaInit(DMA_t dma, resourceOwner_e owner, uint8_t resourceIndex);
+void dmaEnableClock(DMA_t dma);
+void dmaSetHandler(DMA_t dma, dmaCallbackHandlerFuncPtr callback, uint32_t priority, uint32_t userParam);
+void dmaCleanInterrupts(DMA_t dma);
+# 23 "./src/main/drivers/bus_spi.h" 2
+# 41 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATON = 0,
+    SPI_CLOCK_SLOW = 1,
+    SPI_CLOCK_STANDARD = 2,
+    SPI_CLOCK_FAST = 3,
+    SPI_CLOCK_ULTRAFAST = 4
+} SPIClockSpeed_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4
+} SPIDevice;
+
+
+
+
+
+
+#define SPIDEV_COUNT 4
+
+
+typedef struct SPIDevice_s {
+    SPI_TypeDef *dev;
+    ioTag_t nss;
+    ioTag_t sck;
+    ioTag_t mosi;
+    ioTag_t miso;
+    rccPeriphTag_t rcc;
+    uint8_t af;
+    const uint16_t * divisorMap;
+    volatile uint16_t errorCount;
+    
+# 75 "./src/main/drivers/bus_spi.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/bus_spi.h"
+        initDone;
+} spiDevice_t;
+
+
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+    spiInitDevice(SPIDevice device, 
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+                                    _Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+                                         leadingEdge);
+
+# 79 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 79 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+void spiSetSpeed(SPI_TypeDef *instance, SPIClockSpeed_e speed);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t in);
+
+# 82 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 82 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, uint8_t *rxData, const uint8_t *txData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef * spiInstanceByDevice(SPIDevice device);
+# 35 "./src/main/drivers/bus.h" 2
+
+
+#define BUS_SPI1 SPIDEV_1
+#define BUS_SPI2 SPIDEV_2
+#define BUS_SPI3 SPIDEV_3
+#define BUS_SPI4 SPIDEV_4
+
+#define BUS_I2C1 I2CDEV_1
+#define BUS_I2C2 I2CDEV_2
+#define BUS_I2C3 I2CDEV_3
+#define BUS_I2C4 I2CDEV_4
+#define BUS_I2C_EMULATED I2CINVALID
+
+#define BUS_SCRATCHPAD_MEMORY_SIZE (20)
+
+typedef enum {
+    BUS_SPEED_INITIALIZATION = 0,
+    BUS_SPEED_SLOW = 1,
+    BUS_SPEED_STANDARD = 2,
+    BUS_SPEED_FAST = 3,
+    BUS_SPEED_ULTRAFAST = 4
+} busSpeed_e;
+
+typedef enum {
+    BUSTYPE_ANY = 0,
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C = 1,
+    BUSTYPE_SPI = 2,
+    BUSTYPE_SDIO = 3,
+} busType_e;
+
+typedef enum {
+    BUSINDEX_1 = 0,
+    BUSINDEX_2 = 1,
+    BUSINDEX_3 = 2,
+    BUSINDEX_4 = 3
+} busIndex_e;
+
+
+
+typedef enum {
+    DEVHW_NONE = 0,
+
+
+    DEVHW_BMA280,
+    DEVHW_ADXL345,
+    DEVHW_MMA8452,
+    DEVHW_LSM303DLHC,
+
+
+    DEVHW_L3GD20,
+    DEVHW_L3G4200,
+
+
+    DEVHW_MPU3050,
+    DEVHW_MPU6000,
+    DEVHW_MPU6050,
+    DEVHW_MPU6500,
+    DEVHW_BMI160,
+    DEVHW_ICM20689,
+
+
+    DEVHW_MPU9250,
+
+
+    DEVHW_BMP085,
+    DEVHW_BMP280,
+    DEVHW_MS5611,
+    DEVHW_MS5607,
+    DEVHW_LPS25H,
+    DEVHW_SPL06,
+    DEVHW_BMP388,
+    DEVHW_DPS310,
+
+
+    DEVHW_HMC5883,
+    DEVHW_AK8963,
+    DEVHW_AK8975,
+    DEVHW_IST8310_0,
+    DEVHW_IST8310_1,
+    DEVHW_IST8308,
+    DEVHW_QMC5883,
+    DEVHW_MAG3110,
+    DEVHW_LIS3MDL,
+
+
+    DEVHW_LM75_0,
+    DEVHW_LM75_1,
+    DEVHW_LM75_2,
+    DEVHW_LM75_3,
+    DEVHW_LM75_4,
+    DEVHW_LM75_5,
+    DEVHW_LM75_6,
+    DEVHW_LM75_7,
+
+
+    DEVHW_DS2482,
+
+
+    DEVHW_MAX7456,
+
+
+    DEVHW_SRF10,
+    DEVHW_HCSR04_I2C,
+    DEVHW_VL53L0X,
+
+
+    DEVHW_MS4525,
+    DEVHW_PCA9685,
+    DEVHW_M25P16,
+    DEVHW_UG2864,
+    DEVHW_SDCARD,
+    DEVHW_IRLOCK,
+} devHardwareType_e;
+
+typedef enum {
+    DEVFLAGS_NONE = 0,
+    DEVFLAGS_USE_RAW_REGISTERS = (1 << 0),
+
+
+    DEVFLAGS_USE_MANUAL_DEVICE_SELECT = (1 << 1),
+    DEVFLAGS_SPI_MODE_0 = (1 << 2),
+} deviceFlags_e;
+
+typedef struct busDeviceDescriptor_s {
+    void * devicePtr;
+    busType_e busType;
+    devHardwareType_e devHwType;
+    uint8_t flags;
+    uint8_t tag;
+    uint8_t param;
+    union {
+# 179 "./src/main/drivers/bus.h"
+    } busdev;
+    ioTag_t irqPin;
+} busDeviceDescriptor_t;
+
+typedef struct busDevice_s {
+    const busDeviceDescriptor_t * descriptorPtr;
+    busType_e busType;
+    uint32_t flags;
+    uint32_t param;
+    union {
+# 201 "./src/main/drivers/bus.h"
+    } busdev;
+    IO_t irqPin;
+    uint32_t * scratchpad;
+
+
+} busDevice_t;
+
+
+
+
+
+
+extern const busDeviceDescriptor_t __busdev_registry_start[];
+extern const busDeviceDescriptor_t __busdev_registry_end[];
+#define BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(".busdev_registry"), used, aligned(4)))
+
+
+#define BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 237 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 256 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)
+
+
+
+
+typedef struct busTransferDescriptor_s {
+    uint8_t * rxBuf;
+    const uint8_t * txBuf;
+    uint32_t length;
+} busTransferDescriptor_t;
+
+
+
+# 277 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 277 "./src/main/drivers/bus.h"
+    i2cBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 278 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 278 "./src/main/drivers/bus.h"
+    i2cBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 279 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 279 "./src/main/drivers/bus.h"
+    i2cBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 280 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 280 "./src/main/drivers/bus.h"
+    i2cBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+
+
+# 282 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 282 "./src/main/drivers/bus.h"
+    spiBusInitHost(const busDevice_t * dev);
+
+# 283 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 283 "./src/main/drivers/bus.h"
+    spiBusIsBusy(const busDevice_t * dev);
+void spiBusSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+# 285 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 285 "./src/main/drivers/bus.h"
+    spiBusTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 286 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 286 "./src/main/drivers/bus.h"
+    spiBusTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * dsc, int count);
+
+# 287 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 287 "./src/main/drivers/bus.h"
+    spiBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 288 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 288 "./src/main/drivers/bus.h"
+    spiBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 289 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 289 "./src/main/drivers/bus.h"
+    spiBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 290 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 290 "./src/main/drivers/bus.h"
+    spiBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+void spiBusSelectDevice(const busDevice_t * dev);
+void spiBusDeselectDevice(const busDevice_t * dev);
+
+
+
+void busInit(void);
+
+
+busDevice_t * busDeviceInit(busType_e bus, devHardwareType_e hw, uint8_t tag, resourceOwner_e owner);
+busDevice_t * busDeviceOpen(busType_e bus, devHardwareType_e hw, uint8_t tag);
+void busDeviceDeInit(busDevice_t * dev);
+
+uint32_t busDeviceReadScratchpad(const busDevice_t * dev);
+void busDeviceWriteScratchpad(busDevice_t * dev, uint32_t value);
+void * busDeviceGetScratchpadMemory(const busDevice_t * dev);
+
+void busSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+
+void busSelectDevice(const busDevice_t * dev);
+void busDeselectDevice(const busDevice_t * dev);
+
+
+# 313 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 313 "./src/main/drivers/bus.h"
+    busWriteBuf(const busDevice_t * busdev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 314 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 314 "./src/main/drivers/bus.h"
+    busReadBuf(const busDevice_t * busdev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 315 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 315 "./src/main/drivers/bus.h"
+    busRead(const busDevice_t * busdev, uint8_t reg, uint8_t * data);
+
+# 316 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 316 "./src/main/drivers/bus.h"
+    busWrite(const busDevice_t * busdev, uint8_t reg, uint8_t data);
+
+
+# 318 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 318 "./src/main/drivers/bus.h"
+    busTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 319 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 319 "./src/main/drivers/bus.h"
+    busTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * buffers, int count);
+
+
+# 321 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 321 "./src/main/drivers/bus.h"
+    busIsBusy(const busDevice_t * dev);
+# 25 "./src/main/drivers/sensor.h" 2
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInitFuncPtr)(void);
+typedef 
+# 39 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 39 "./src/main/drivers/sensor.h"
+            (*sensorReadFuncPtr)(int16_t *data);
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 43 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 43 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 46 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 46 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroUpdateFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+typedef 
+# 49 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 49 "./src/main/drivers/sensor.h"
+            (*sensorGyroInterruptStatusFuncPtr)(struct gyroDev_s *gyro);
+struct magDev_s;
+typedef 
+# 51 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 51 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *mag);
+typedef 
+# 52 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 52 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *mag);
+struct temperatureDev_s;
+typedef 
+# 54 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 54 "./src/main/drivers/sensor.h"
+            (*sensorTempReadFuncPtr)(struct temperatureDev_s *tempDev, int16_t *temperature);
+struct opflowDev_s;
+typedef 
+# 56 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 56 "./src/main/drivers/sensor.h"
+            (*sensorOpflowInitFuncPtr)(struct opflowDev_s *mag);
+typedef 
+# 57 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 57 "./src/main/drivers/sensor.h"
+            (*sensorOpflowUpdateFuncPtr)(struct opflowDev_s *mag);
+# 25 "./src/main/drivers/accgyro/accgyro.h" 2
+
+#define GYRO_LPF_256HZ 0
+#define GYRO_LPF_188HZ 1
+#define GYRO_LPF_98HZ 2
+#define GYRO_LPF_42HZ 3
+#define GYRO_LPF_20HZ 4
+#define GYRO_LPF_10HZ 5
+#define GYRO_LPF_5HZ 6
+#define GYRO_LPF_NONE 7
+
+typedef struct {
+    uint8_t gyroLpf;
+    uint16_t gyroRateHz;
+    uint8_t gyroConfigValues[2];
+} gyroFilterAndRateConfig_t;
+
+#define GYRO_SAMPLE_BUFFER_SIZE 16
+
+typedef struct gyroSample_s {
+    timeUs_t timeUs;
+    int16_t gyroADCRaw[3];
+} gyroSample_t;
+
+
+typedef struct gyroSampleBuffer_s {
+    gyroSample_t samples[16];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t overflowCount;
+    volatile 
+# 54 "./src/main/drivers/accgyro/accgyro.h" 3 4
+            _Bool 
+# 54 "./src/main/drivers/accgyro/accgyro.h"
+                 enabled;
+} gyroSampleBuffer_t;
+
+typedef struct gyroDev_s {
+    busDevice_t * busDev;
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    sensorGyroInterruptStatusFuncPtr intStatusFn;
+    sensorGyroUpdateFuncPtr updateFn;
+    extiCallbackRec_t exti;
+    float scale;
+    int16_t gyroADCRaw[3];
+    int16_t gyroZero[3];
+    uint8_t imuSensorToUse;
+    uint8_t lpf;
+    uint32_t requestedSampleIntervalUs;
+    volatile 
+# 71 "./src/main/drivers/accgyro/accgyro.h" 3 4
+            _Bool 
+# 71 "./src/main/drivers/accgyro/accgyro.h"
+                 dataReady;
+    uint32_t sampleRateIntervalUs;
+    sensor_align_e gyroAlign;
+    gyroSampleBuffer_t sampleBuffer;
+} gyroDev_t;
+
+typedef struct accDev_s {
+    busDevice_t * busDev;
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    uint8_t imuSensorToUse;
+    sensor_align_e accAlign;
+} accDev_t;
+
+const gyroFilterAndRateConfig_t * chooseGyroConfig(uint8_t desiredLpf, uint16_t desiredRateHz, const gyroFilterAndRateConfig_t * configs, int count);
+void gyroIntExtiInit(struct gyroDev_s *gyro);
+
+# 89 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 89 "./src/main/drivers/accgyro/accgyro.h"
+    gyroCheckDataReady(struct gyroDev_s *gyro);
+
+# 90 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 90 "./src/main/drivers/accgyro/accgyro.h"
+    gyroSampleBufferIsSupported(const struct gyroDev_s *gyro, 
+# 90 "./src/main/drivers/accgyro/accgyro.h" 3 4
+                                                              _Bool 
+# 90 "./src/main/drivers/accgyro/accgyro.h"
+                                                                   slaveMagEnabled);
+void gyroSampleBufferStart(struct gyroDev_s *gyro);
+void gyroSampleBufferStop(struct gyroDev_s *gyro);
+
+# 93 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 93 "./src/main/drivers/accgyro/accgyro.h"
+    gyroSampleBufferPop(struct gyroDev_s *gyro, gyroSample_t *sample);
+uint8_t gyroSampleBufferCount(const struct gyroDev_s *gyro);
+# 45 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/drivers/compass/compass.h" 1
+# 18 "./src/main/drivers/compass/compass.h"
+       
+
+# 1 "./src/main/common/vector.h" 1
+# 18 "./src/main/common/vector.h"
+       
+
+
+
+
+
+
+typedef union {
+    float v[3];
+    struct {
+       float x,y,z;
+    };
+} fpVector3_t;
+
+typedef struct {
+    float m[3][3];
+} fpMat3_t;
+
+typedef struct {
+    fpVector3_t axis;
+    float angle;
+} fpAxisAngle_t;
+
+void rotationMatrixFromAngles(fpMat3_t * rmat, const fp_angles_t * angles);
+void rotationMatrixFromAxisAngle(fpMat3_t * rmat, const fpAxisAngle_t * a);
+
+static inline void vectorZero(fpVector3_t * v)
+{
+    v->x = 0.0f;
+    v->y = 0.0f;
+    v->z = 0.0f;
+}
+
+static inline fpVector3_t * rotationMatrixRotateVector(fpVector3_t * result, const fpVector3_t * a, const fpMat3_t * rmat)
+{
+    fpVector3_t r;
+
+    r.x = rmat->m[0][0] * a->x + rmat->m[1][0] * a->y + rmat->m[2][0] * a->z;
+    r.y = rmat->m[0][1] * a->x + rmat->m[1][1] * a->y + rmat->m[2][1] * a->z;
+    r.z = rmat->m[0][2] * a->x + rmat->m[1][2] * a->y + rmat->m[2][2] * a->z;
+
+    *result = r;
+    return result;
+}
+
+static inline float vectorNormSquared(const fpVector3_t * v)
+{
+    return ((v->x)*(v->x)) + ((v->y)*(v->y)) + ((v->z)*(v->z));
+}
+
+static inline fpVector3_t * vectorNormalize(fpVector3_t * result, const fpVector3_t * v)
+{
+    float length = sqrtf(vectorNormSquared(v));
+    if (length != 0) {
+        result->x = v->x / length;
+        result->y = v->y / length;
+        result->z = v->z / length;
+    }
+    else {
+        result->x = 0;
+        result->y = 0;
+        result->z = 0;
+    }
+    return result;
+}
+
+static inline fpVector3_t * vectorCrossProduct(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->y * b->z - a->z * b->y;
+    ab.y = a->z * b->x - a->x * b->z;
+    ab.z = a->x * b->y - a->y * b->x;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorAdd(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x + b->x;
+    ab.y = a->y + b->y;
+    ab.z = a->z + b->z;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorScale(fpVector3_t * result, const fpVector3_t * a, const float b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x * b;
+    ab.y = a->y * b;
+    ab.z = a->z * b;
+
+    *result = ab;
+    return result;
+}
+# 21 "./src/main/drivers/compass/compass.h" 2
+
+
+
+typedef struct magDev_s {
+    busDevice_t * busDev;
+    sensorMagInitFuncPtr init;
+    sensorMagReadFuncPtr read;
+    struct {
+        
+# 29 "./src/main/drivers/compass/compass.h" 3 4
+       _Bool 
+# 29 "./src/main/drivers/compass/compass.h"
+            useExternal;
+        union {
+            fpMat3_t externalRotation;
+            sensor_align_e onBoard;
+        };
+    } magAlign;
+    uint8_t magSensorToUse;
+    int16_t magADCRaw[3];
+} magDev_t;
+# 46 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/drivers/time.h" 1
+# 18 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 48 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/fc/config.h" 1
+# 18 "./src/main/fc/config.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/adc.h" 1
+# 18 "./src/main/drivers/adc.h"
+       
+
+
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_RSSI = 1,
+    ADC_CURRENT = 2,
+    ADC_AIRSPEED = 3,
+    ADC_FUNCTION_COUNT
+} adcFunction_e;
+
+typedef enum {
+    ADC_CHN_NONE = 0,
+    ADC_CHN_1 = 1,
+    ADC_CHN_2,
+    ADC_CHN_3,
+    ADC_CHN_4,
+    ADC_CHN_MAX = ADC_CHN_4,
+    ADC_CHN_COUNT
+} adcChannel_e;
+
+typedef struct drv_adc_config_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} drv_adc_config_t;
+
+void adcInit(drv_adc_config_t *init);
+uint16_t adcGetChannel(uint8_t channel);
+
+# 46 "./src/main/drivers/adc.h" 3 4
+_Bool 
+# 46 "./src/main/drivers/adc.h"
+    adcIsFunctionAssigned(uint8_t function);
+int adcGetFunctionChannelAllocation(uint8_t function);
+
+
+
+#define ADC_AVERAGE_N_SAMPLES 20
+# 25 "./src/main/fc/config.h" 2
+# 1 "./src/main/drivers/rx_pwm.h" 1
+# 18 "./src/main/drivers/rx_pwm.h"
+       
+
+#define PPM_RCVR_TIMEOUT 0
+
+struct timerHardware_s;
+
+# 23 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 23 "./src/main/drivers/rx_pwm.h"
+    ppmInConfig(const struct timerHardware_s *timerHardwarePtr);
+
+void pwmInConfig(const struct timerHardware_s *timerHardwarePtr, uint8_t channel);
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 29 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 29 "./src/main/drivers/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 32 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 32 "./src/main/drivers/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 26 "./src/main/fc/config.h" 2
+# 1 "./src/main/fc/stats.h" 1
+
+       
+
+
+typedef struct statsConfig_s {
+    uint32_t stats_total_time;
+    uint32_t stats_total_dist;
+
+
+
+    uint8_t stats_enabled;
+} statsConfig_t;
+
+uint32_t getFlyingEnergy(void);
+void statsOnArm(void);
+void statsOnDisarm(void);
+# 27 "./src/main/fc/config.h" 2
+
+#define MAX_PROFILE_COUNT 3
+#define ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500
+#define MAX_NAME_LENGTH 16
+
+typedef enum {
+    ASYNC_MODE_NONE,
+    ASYNC_MODE_GYRO,
+    ASYNC_MODE_ALL
+} asyncMode_e;
+
+typedef enum {
+    FEATURE_THR_VBAT_COMP = 1 << 0,
+    FEATURE_VBAT = 1 << 1,
+    FEATURE_TX_PROF_SEL = 1 << 2,
+    FEATURE_BAT_PROFILE_AUTOSWITCH = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_UNUSED_1 = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_UNUSED_3 = 1 << 8,
+    FEATURE_UNUSED_4 = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_CURRENT_METER = 1 << 11,
+    FEATURE_REVERSIBLE_MOTORS = 1 << 12,
+    FEATURE_UNUSED_5 = 1 << 13,
+    FEATURE_UNUSED_6 = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DASHBOARD = 1 << 17,
+    FEATURE_UNUSED_7 = 1 << 18,
+    FEATURE_BLACKBOX = 1 << 19,
+    FEATURE_UNUSED_10 = 1 << 20,
+    FEATURE_TRANSPONDER = 1 << 21,
+    FEATURE_AIRMODE = 1 << 22,
+    FEATURE_SUPEREXPO_RATES = 1 << 23,
+    FEATURE_VTX = 1 << 24,
+    FEATURE_UNUSED_8 = 1 << 25,
+    FEATURE_UNUSED_9 = 1 << 26,
+    FEATURE_UNUSED_11 = 1 << 27,
+    FEATURE_PWM_OUTPUT_ENABLE = 1 << 28,
+    FEATURE_OSD = 1 << 29,
+    FEATURE_FW_LAUNCH = 1 << 30,
+} features_e;
+
+typedef struct systemConfig_s {
+    uint8_t current_profile_index;
+    uint8_t current_battery_profile_index;
+    uint8_t debug_mode;
+    uint8_t i2c_speed;
+    uint8_t cpuUnderclock;
+    uint8_t throttle_tilt_compensation_strength;
+    char name[16 + 1];
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint32_t preferred_beeper_off_flags;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+
+typedef struct adcChannelConfig_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} adcChannelConfig_t;
+
+extern adcChannelConfig_t adcChannelConfig_System; extern adcChannelConfig_t adcChannelConfig_Copy; static inline const adcChannelConfig_t* adcChannelConfig(void) { return &adcChannelConfig_System; } static inline adcChannelConfig_t* adcChannelConfigMutable(void) { return &adcChannelConfig_System; } struct _dummy;
+
+
+
+extern statsConfig_t statsConfig_System; extern statsConfig_t statsConfig_Copy; static inline const statsConfig_t* statsConfig(void) { return &statsConfig_System; } static inline statsConfig_t* statsConfigMutable(void) { return &statsConfig_System; } struct _dummy;
+
+
+void beeperOffSet(uint32_t mask);
+void beeperOffSetAll(uint8_t beeperCount);
+void beeperOffClear(uint32_t mask);
+void beeperOffClearAll(void);
+uint32_t getBeeperOffMask(void);
+void setBeeperOffMask(uint32_t mask);
+uint32_t getPreferredBeeperOffMask(void);
+void setPreferredBeeperOffMask(uint32_t mask);
+
+void copyCurrentProfileToProfileSlot(uint8_t profileSlotIndex);
+
+void initEEPROM(void);
+void resetEEPROM(void);
+void readEEPROM(void);
+void writeEEPROM(void);
+void ensureEEPROMContainsValidData(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixConfig(void);
+void validateAndFixTargetConfig(void);
+
+uint8_t getConfigProfile(void);
+
+# 124 "./src/main/fc/config.h" 3 4
+_Bool 
+# 124 "./src/main/fc/config.h"
+    setConfigProfile(uint8_t profileIndex);
+void setConfigProfileAndWriteEEPROM(uint8_t profileIndex);
+
+uint8_t getConfigBatteryProfile(void);
+
+# 128 "./src/main/fc/config.h" 3 4
+_Bool 
+# 128 "./src/main/fc/config.h"
+    setConfigBatteryProfile(uint8_t profileIndex);
+void setConfigBatteryProfileAndWriteEEPROM(uint8_t profileIndex);
+
+
+# 131 "./src/main/fc/config.h" 3 4
+_Bool 
+# 131 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+void applyAndSaveBoardAlignmentDelta(int16_t roll, int16_t pitch);
+
+void createDefaultConfig(void);
+void resetConfigs(void);
+void targetConfiguration(void);
+
+uint32_t getLooptime(void);
+uint32_t getGyroLooptime(void);
+# 50 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 18 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+#define MAX_CONTROL_RATE_PROFILE_COUNT 3
+# 34 "./src/main/fc/controlrate_profile.h"
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20
+#define CONTROL_RATE_CONFIG_YAW_RATE_MAX 180
+#define CONTROL_RATE_CONFIG_YAW_RATE_MIN 2
+#define CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20
+
+#define CONTROL_RATE_CONFIG_TPA_MAX 100
+
+typedef struct controlRateConfig_s {
+
+    struct {
+        uint8_t rcMid8;
+        uint8_t rcExpo8;
+        uint8_t dynPID;
+        uint16_t pa_breakpoint;
+        uint16_t fixedWingTauMs;
+    } throttle;
+
+    struct {
+        uint8_t rcExpo8;
+        uint8_t rcYawExpo8;
+        uint8_t rates[3];
+    } stabilized;
+
+    struct {
+        uint8_t rcExpo8;
+        uint8_t rcYawExpo8;
+        uint8_t rates[3];
+    } manual;
+
+    struct {
+        uint8_t fpvCamAngleDegrees;
+    } misc;
+
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[3]; extern controlRateConfig_t controlRateProfiles_CopyArray[3]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[3] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern const controlRateConfig_t *currentControlRateProfile;
+
+void setControlRateProfile(uint8_t profileIndex);
+void changeControlRateProfile(uint8_t profileIndex);
+void activateControlRateConfig(void);
+uint8_t getCurrentControlRateProfile(void);
+# 51 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/fc_core.h" 1
+# 18 "./src/main/fc/fc_core.h"
+       
+
+
+
+
+
+typedef enum disarmReason_e {
+    DISARM_NONE = 0,
+    DISARM_TIMEOUT = 1,
+    DISARM_STICKS = 2,
+    DISARM_SWITCH_3D = 3,
+    DISARM_SWITCH = 4,
+    DISARM_KILLSWITCH = 5,
+    DISARM_FAILSAFE = 6,
+    DISARM_NAVIGATION = 7,
+    DISARM_REASON_COUNT
+} disarmReason_t;
+
+
+void handleInflightCalibrationStickPosition(void);
+
+void disarm(disarmReason_t disarmReason);
+void tryArm(void);
+disarmReason_t getDisarmReason(void);
+
+void emergencyArmingUpdate(
+# 43 "./src/main/fc/fc_core.h" 3 4
+                          _Bool 
+# 43 "./src/main/fc/fc_core.h"
+                               armingSwitchIsOn);
+
+
+# 45 "./src/main/fc/fc_core.h" 3 4
+_Bool 
+# 45 "./src/main/fc/fc_core.h"
+    isCalibrating(void);
+float getFlightTime(void);
+
+void fcReboot(
+# 48 "./src/main/fc/fc_core.h" 3 4
+             _Bool 
+# 48 "./src/main/fc/fc_core.h"
+                  bootLoader);
+# 52 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/rc_controls.h" 1
+# 18 "./src/main/fc/rc_controls.h"
+       
+
+
+
+#define AIRMODE_THROTTLE_THRESHOLD 1300
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8,
+    AUX9,
+    AUX10,
+    AUX11,
+    AUX12
+} rc_alias_e;
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+typedef enum {
+    THROTTLE_STATUS_TYPE_RC = 0,
+    THROTTLE_STATUS_TYPE_COMMAND
+} throttleStatusType_e;
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    STICK_CENTER = 0,
+    THROTTLE_THRESHOLD
+} airmodeAndAntiWindupHandlingType_e;
+
+typedef enum {
+    ROL_LO = (1 << (2 * ROLL)),
+    ROL_CE = (3 << (2 * ROLL)),
+    ROL_HI = (2 << (2 * ROLL)),
+
+    PIT_LO = (1 << (2 * PITCH)),
+    PIT_CE = (3 << (2 * PITCH)),
+    PIT_HI = (2 << (2 * PITCH)),
+
+    YAW_LO = (1 << (2 * YAW)),
+    YAW_CE = (3 << (2 * YAW)),
+    YAW_HI = (2 << (2 * YAW)),
+
+    THR_LO = (1 << (2 * THROTTLE)),
+    THR_CE = (3 << (2 * THROTTLE)),
+    THR_HI = (2 << (2 * THROTTLE))
+} stickPositions_e;
+
+extern int16_t rcCommand[4];
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t pos_hold_deadband;
+    uint8_t alt_hold_deadband;
+    uint16_t mid_throttle_deadband;
+    uint8_t airmodeHandlingType;
+    uint16_t airmodeThrottleThreshold;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t fixed_wing_auto_arm;
+    uint8_t disarm_kill_switch;
+    uint16_t switchDisarmDelayMs;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+stickPositions_e getRcStickPositions(void);
+
+# 104 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 104 "./src/main/fc/rc_controls.h"
+    checkStickPosition(stickPositions_e stickPos);
+
+
+# 106 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 106 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+
+# 107 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 107 "./src/main/fc/rc_controls.h"
+    areSticksDeflectedMoreThanPosHoldDeadband(void);
+throttleStatus_e calculateThrottleStatus(throttleStatusType_e type);
+rollPitchStatus_e calculateRollPitchCenterStatus(void);
+void processRcStickPositions(throttleStatus_e throttleStatus);
+
+int32_t getRcStickDeflection(int32_t axis);
+# 53 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/rc_modes.h" 1
+# 18 "./src/main/fc/rc_modes.h"
+       
+
+
+
+# 1 "./src/main/common/bitarray.h" 1
+# 18 "./src/main/common/bitarray.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "./src/main/common/bitarray.h" 2
+
+
+
+
+
+
+
+typedef uint32_t bitarrayElement_t;
+
+#define BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]
+
+
+# 33 "./src/main/common/bitarray.h" 3 4
+_Bool 
+# 33 "./src/main/common/bitarray.h"
+    bitArrayGet(const bitarrayElement_t *array, unsigned bit);
+void bitArraySet(bitarrayElement_t *array, unsigned bit);
+void bitArrayClr(bitarrayElement_t *array, unsigned bit);
+
+void bitArraySetAll(bitarrayElement_t *array, size_t size);
+void bitArrayClrAll(bitarrayElement_t *array, size_t size);
+
+#define BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))
+#define BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))
+
+
+
+
+
+int bitArrayFindFirstSet(const bitarrayElement_t *array, unsigned start_bit, size_t size);
+
+#define BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))
+# 23 "./src/main/fc/rc_modes.h" 2
+
+
+
+#define BOXID_NONE 255
+
+typedef enum {
+    BOXARM = 0,
+    BOXANGLE = 1,
+    BOXHORIZON = 2,
+    BOXNAVALTHOLD = 3,
+    BOXHEADINGHOLD = 4,
+    BOXHEADFREE = 5,
+    BOXHEADADJ = 6,
+    BOXCAMSTAB = 7,
+    BOXNAVRTH = 8,
+    BOXNAVPOSHOLD = 9,
+    BOXMANUAL = 10,
+    BOXBEEPERON = 11,
+    BOXLEDLOW = 12,
+    BOXLIGHTS = 13,
+    BOXNAVLAUNCH = 14,
+    BOXOSD = 15,
+    BOXTELEMETRY = 16,
+    BOXBLACKBOX = 17,
+    BOXFAILSAFE = 18,
+    BOXNAVWP = 19,
+    BOXAIRMODE = 20,
+    BOXHOMERESET = 21,
+    BOXGCSNAV = 22,
+    BOXKILLSWITCH = 23,
+    BOXSURFACE = 24,
+    BOXFLAPERON = 25,
+    BOXTURNASSIST = 26,
+    BOXAUTOTRIM = 27,
+    BOXAUTOTUNE = 28,
+    BOXCAMERA1 = 29,
+    BOXCAMERA2 = 30,
+    BOXCAMERA3 = 31,
+    BOXOSDALT1 = 32,
+    BOXOSDALT2 = 33,
+    BOXOSDALT3 = 34,
+    BOXNAVCRUISE = 35,
+    BOXBRAKING = 36,
+    BOXUSER1 = 37,
+    BOXUSER2 = 38,
+    BOXFPVANGLEMIX = 39,
+    BOXLOITERDIRCHN = 40,
+    BOXMSPRCOVERRIDE = 41,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+
+typedef struct boxBitmask_s { bitarrayElement_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+
+#define MAX_MODE_ACTIVATION_CONDITION_COUNT 20
+
+#define CHANNEL_RANGE_MIN 900
+#define CHANNEL_RANGE_MAX 2100
+
+#define CHANNEL_RANGE_STEP_WIDTH 25
+
+#define MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)
+#define CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define MIN_MODE_RANGE_STEP 0
+#define MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)
+
+
+
+
+
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+} modeActivationCondition_t;
+
+typedef enum {
+    MODE_OPERATOR_OR,
+    MODE_OPERATOR_AND
+} modeActivationOperator_e;
+
+typedef struct modeActivationOperatorConfig_s {
+    modeActivationOperator_e modeActivationOperator;
+} modeActivationOperatorConfig_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+extern modeActivationOperatorConfig_t modeActivationOperatorConfig_System; extern modeActivationOperatorConfig_t modeActivationOperatorConfig_Copy; static inline const modeActivationOperatorConfig_t* modeActivationOperatorConfig(void) { return &modeActivationOperatorConfig_System; } static inline modeActivationOperatorConfig_t* modeActivationOperatorConfigMutable(void) { return &modeActivationOperatorConfig_System; } struct _dummy;
+
+
+# 119 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 119 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 122 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 122 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+void processAirmode(void);
+
+# 125 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 125 "./src/main/fc/rc_modes.h"
+    isUsingNavigationModes(void);
+
+# 126 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 126 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+
+void updateActivatedModes(void);
+void updateUsedModeActivationConditionFlags(void);
+void configureModeActivationCondition(int macIndex, boxId_e modeId, uint8_t auxChannelIndex, uint16_t startPwm, uint16_t endPwm);
+# 54 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/fc/runtime_config.h" 1
+# 18 "./src/main/fc/runtime_config.h"
+       
+
+
+typedef enum {
+    ARMED = (1 << 2),
+    WAS_EVER_ARMED = (1 << 3),
+
+    ARMING_DISABLED_FAILSAFE_SYSTEM = (1 << 7),
+
+    ARMING_DISABLED_NOT_LEVEL = (1 << 8),
+    ARMING_DISABLED_SENSORS_CALIBRATING = (1 << 9),
+    ARMING_DISABLED_SYSTEM_OVERLOADED = (1 << 10),
+    ARMING_DISABLED_NAVIGATION_UNSAFE = (1 << 11),
+    ARMING_DISABLED_COMPASS_NOT_CALIBRATED = (1 << 12),
+    ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED = (1 << 13),
+    ARMING_DISABLED_ARM_SWITCH = (1 << 14),
+    ARMING_DISABLED_HARDWARE_FAILURE = (1 << 15),
+    ARMING_DISABLED_BOXFAILSAFE = (1 << 16),
+    ARMING_DISABLED_BOXKILLSWITCH = (1 << 17),
+    ARMING_DISABLED_RC_LINK = (1 << 18),
+    ARMING_DISABLED_THROTTLE = (1 << 19),
+    ARMING_DISABLED_CLI = (1 << 20),
+    ARMING_DISABLED_CMS_MENU = (1 << 21),
+    ARMING_DISABLED_OSD_MENU = (1 << 22),
+    ARMING_DISABLED_ROLLPITCH_NOT_CENTERED = (1 << 23),
+    ARMING_DISABLED_SERVO_AUTOTRIM = (1 << 24),
+    ARMING_DISABLED_OOM = (1 << 25),
+    ARMING_DISABLED_INVALID_SETTING = (1 << 26),
+    ARMING_DISABLED_PWM_OUTPUT_ERROR = (1 << 27),
+
+    ARMING_DISABLED_ALL_FLAGS = (ARMING_DISABLED_FAILSAFE_SYSTEM | ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_SENSORS_CALIBRATING |
+                                                       ARMING_DISABLED_SYSTEM_OVERLOADED | ARMING_DISABLED_NAVIGATION_UNSAFE |
+                                                       ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED |
+                                                       ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE | ARMING_DISABLED_BOXFAILSAFE |
+                                                       ARMING_DISABLED_BOXKILLSWITCH | ARMING_DISABLED_RC_LINK | ARMING_DISABLED_THROTTLE | ARMING_DISABLED_CLI |
+                                                       ARMING_DISABLED_CMS_MENU | ARMING_DISABLED_OSD_MENU | ARMING_DISABLED_ROLLPITCH_NOT_CENTERED |
+                                                       ARMING_DISABLED_SERVO_AUTOTRIM | ARMING_DISABLED_OOM | ARMING_DISABLED_INVALID_SETTING |
+                                                       ARMING_DISABLED_PWM_OUTPUT_ERROR),
+} armingFlag_e;
+
+
+
+
+
+
+#define ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)
+
+
+
+
+
+
+
+extern uint32_t armingFlags;
+
+extern const char *armingDisableFlagNames[];
+
+#define isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))
+#define DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))
+#define ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))
+#define ARMING_FLAG(mask) (armingFlags & (mask))
+
+
+
+armingFlag_e isArmingDisabledReason(void);
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    HEADING_MODE = (1 << 2),
+    NAV_ALTHOLD_MODE= (1 << 3),
+    NAV_RTH_MODE = (1 << 4),
+    NAV_POSHOLD_MODE= (1 << 5),
+    HEADFREE_MODE = (1 << 6),
+    NAV_LAUNCH_MODE = (1 << 7),
+    MANUAL_MODE = (1 << 8),
+    FAILSAFE_MODE = (1 << 9),
+    AUTO_TUNE = (1 << 10),
+    NAV_WP_MODE = (1 << 11),
+    NAV_CRUISE_MODE = (1 << 12),
+    FLAPERON = (1 << 13),
+    TURN_ASSISTANT = (1 << 14),
+} flightModeFlags_e;
+
+extern uint32_t flightModeFlags;
+
+#define DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)
+#define ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)
+#define FLIGHT_MODE(mask) (flightModeFlags & (mask))
+
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING_LEGACY = (1 << 4),
+    ANTI_WINDUP = (1 << 5),
+    FLAPERON_AVAILABLE = (1 << 6),
+    NAV_MOTOR_STOP_OR_IDLE = (1 << 7),
+    COMPASS_CALIBRATED = (1 << 8),
+    ACCELEROMETER_CALIBRATED = (1 << 9),
+    PWM_DRIVER_AVAILABLE = (1 << 10),
+    NAV_CRUISE_BRAKING = (1 << 11),
+    NAV_CRUISE_BRAKING_BOOST = (1 << 12),
+    NAV_CRUISE_BRAKING_LOCKED = (1 << 13),
+    NAV_EXTRA_ARMING_SAFETY_BYPASSED = (1 << 14),
+    AIRMODE_ACTIVE = (1 << 15),
+    ESC_SENSOR_ENABLED = (1 << 16),
+    AIRPLANE = (1 << 17),
+    MULTIROTOR = (1 << 18),
+    ROVER = (1 << 19),
+    BOAT = (1 << 20),
+    ALTITUDE_CONTROL = (1 << 21),
+    MOVE_FORWARD_ONLY = (1 << 22),
+    SET_REVERSIBLE_MOTORS_FORWARD = (1 << 23),
+    FW_HEADING_USE_YAW = (1 << 24),
+} stateFlags_t;
+
+#define DISABLE_STATE(mask) (stateFlags &= ~(mask))
+#define ENABLE_STATE(mask) (stateFlags |= (mask))
+#define STATE(mask) (stateFlags & (mask))
+
+extern uint32_t stateFlags;
+
+typedef enum {
+    FLM_MANUAL,
+    FLM_ACRO,
+    FLM_ACRO_AIR,
+    FLM_ANGLE,
+    FLM_HORIZON,
+    FLM_ALTITUDE_HOLD,
+    FLM_POSITION_HOLD,
+    FLM_RTH,
+    FLM_MISSION,
+    FLM_CRUISE,
+    FLM_LAUNCH,
+    FLM_FAILSAFE,
+    FLM_COUNT
+} flightModeForTelemetry_e;
+
+flightModeForTelemetry_e getFlightModeForTelemetry(void);
+
+uint32_t enableFlightMode(flightModeFlags_e mask);
+uint32_t disableFlightMode(flightModeFlags_e mask);
+
+
+# 163 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 163 "./src/main/fc/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+# 55 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/flight/failsafe.h" 1
+# 18 "./src/main/flight/failsafe.h"
+       
+
+
+
+#define FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)
+#define MILLIS_PER_TENTH_SECOND 100
+#define MILLIS_PER_SECOND 1000
+#define PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND
+#define PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND
+#define PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND
+#define PERIOD_RXDATA_FAILURE 200
+#define PERIOD_RXDATA_RECOVERY 200
+
+
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_recovery_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_procedure;
+
+    int16_t failsafe_fw_roll_angle;
+    int16_t failsafe_fw_pitch_angle;
+    int16_t failsafe_fw_yaw_rate;
+    uint16_t failsafe_stick_motion_threshold;
+    uint16_t failsafe_min_distance;
+    uint8_t failsafe_min_distance_procedure;
+    
+# 46 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 46 "./src/main/flight/failsafe.h"
+        failsafe_mission;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+
+
+
+
+    FAILSAFE_IDLE = 0,
+# 65 "./src/main/flight/failsafe.h"
+    FAILSAFE_RX_LOSS_DETECTED,
+
+
+
+
+
+
+
+    FAILSAFE_RX_LOSS_IDLE,
+# 82 "./src/main/flight/failsafe.h"
+    FAILSAFE_RETURN_TO_HOME,
+# 93 "./src/main/flight/failsafe.h"
+    FAILSAFE_LANDING,
+
+
+
+
+
+
+    FAILSAFE_LANDED,
+
+
+
+
+
+    FAILSAFE_RX_LOSS_MONITORING,
+
+
+
+
+    FAILSAFE_RX_LOSS_RECOVERED
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT,
+    FAILSAFE_PROCEDURE_RTH,
+    FAILSAFE_PROCEDURE_NONE
+} failsafeProcedure_e;
+
+typedef enum {
+    RTH_IDLE = 0,
+    RTH_IN_PROGRESS,
+    RTH_HAS_LANDED
+} rthState_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 134 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 134 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 135 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 135 "./src/main/flight/failsafe.h"
+        suspended;
+    
+# 136 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 136 "./src/main/flight/failsafe.h"
+        active;
+    
+# 137 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 137 "./src/main/flight/failsafe.h"
+        controlling;
+    timeMs_t rxDataFailurePeriod;
+    timeMs_t rxDataRecoveryPeriod;
+    timeMs_t validRxDataReceivedAt;
+    timeMs_t validRxDataFailedAt;
+    timeMs_t throttleLowPeriod;
+    timeMs_t landingShouldBeFinishedAt;
+    timeMs_t receivingRxDataPeriod;
+    timeMs_t receivingRxDataPeriodPreset;
+    failsafeProcedure_e activeProcedure;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+    int16_t lastGoodRcCommand[4];
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 159 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 159 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 160 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 160 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 161 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 161 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(void);
+void failsafeOnRxResume(void);
+
+# 164 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 164 "./src/main/flight/failsafe.h"
+    failsafeMayRequireNavigationMode(void);
+void failsafeApplyControlInput(void);
+
+# 166 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 166 "./src/main/flight/failsafe.h"
+    failsafeRequiresAngleMode(void);
+
+# 167 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 167 "./src/main/flight/failsafe.h"
+    failsafeRequiresMotorStop(void);
+
+# 168 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 168 "./src/main/flight/failsafe.h"
+    failsafeShouldApplyControlInput(void);
+
+# 169 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 169 "./src/main/flight/failsafe.h"
+    failsafeBypassNavigation(void);
+void failsafeUpdateRcCommandValues(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 57 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/imu.h" 1
+# 18 "./src/main/flight/imu.h"
+       
+
+
+
+
+# 1 "./src/main/common/quaternion.h" 1
+# 21 "./src/main/common/quaternion.h"
+       
+
+
+
+
+
+
+
+typedef struct {
+    float q0, q1, q2, q3;
+} fpQuaternion_t;
+
+static inline fpQuaternion_t * quaternionInitUnit(fpQuaternion_t * result)
+{
+    result->q0 = 1.0f;
+    result->q1 = 0.0f;
+    result->q2 = 0.0f;
+    result->q3 = 0.0f;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionInitFromVector(fpQuaternion_t * result, const fpVector3_t * v)
+{
+    result->q0 = 0.0f;
+    result->q1 = v->x;
+    result->q2 = v->y;
+    result->q3 = v->z;
+    return result;
+}
+
+static inline void quaternionToAxisAngle(fpAxisAngle_t * result, const fpQuaternion_t * q)
+{
+    fpAxisAngle_t a = {.axis = {{1.0f, 0.0f, 0.0f}}};
+
+    a.angle = 2.0f * acos_approx(constrainf(q->q0, -1.0f, 1.0f));
+
+    if (a.angle > 3.14159265358979323846f) {
+        a.angle -= 2.0f * 3.14159265358979323846f;
+    }
+
+    const float sinVal = sqrt(1.0f - q->q0 * q->q0);
+
+
+    if (sinVal > 1e-4f) {
+        a.axis.x = q->q1 / sinVal;
+        a.axis.y = q->q2 / sinVal;
+        a.axis.z = q->q3 / sinVal;
+    } else {
+        a.angle = 0;
+    }
+
+    *result = a;
+}
+
+static inline fpQuaternion_t * axisAngleToQuaternion(fpQuaternion_t * result, const fpAxisAngle_t * a)
+{
+  fpQuaternion_t q;
+  const float s = sin_approx(a->angle / 2.0f);
+
+  q.q0 = cos_approx(a->angle / 2.0f);
+  q.q1 = -a->axis.x * s;
+  q.q2 = -a->axis.y * s;
+  q.q3 = -a->axis.z * s;
+
+  *result = q;
+  return result;
+}
+
+static inline float quaternionNormSqared(const fpQuaternion_t * q)
+{
+    return ((q->q0)*(q->q0)) + ((q->q1)*(q->q1)) + ((q->q2)*(q->q2)) + ((q->q3)*(q->q3));
+}
+
+static inline fpQuaternion_t * quaternionMultiply(fpQuaternion_t * result, const fpQuaternion_t * a, const fpQuaternion_t * b)
+{
+  fpQuaternion_t p;
+
+  p.q0 = a->q0 * b->q0 - a->q1 * b->q1 - a->q2 * b->q2 - a->q3 * b->q3;
+  p.q1 = a->q0 * b->q1 + a->q1 * b->q0 + a->q2 * b->q3 - a->q3 * b->q2;
+  p.q2 = a->q0 * b->q2 - a->q1 * b->q3 + a->q2 * b->q0 + a->q3 * b->q1;
+  p.q3 = a->q0 * b->q3 + a->q1 * b->q2 - a->q2 * b->q1 + a->q3 * b->q0;
+
+  *result = p;
+  return result;
+}
+
+static inline fpQuaternion_t * quaternionScale(fpQuaternion_t * result, const fpQuaternion_t * a, const float b)
+{
+    fpQuaternion_t p;
+
+    p.q0 = a->q0 * b;
+    p.q1 = a->q1 * b;
+    p.q2 = a->q2 * b;
+    p.q3 = a->q3 * b;
+
+    *result = p;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionAdd(fpQuaternion_t * result, const fpQuaternion_t * a, const fpQuaternion_t * b)
+{
+    fpQuaternion_t p;
+
+    p.q0 = a->q0 + b->q0;
+    p.q1 = a->q1 + b->q1;
+    p.q2 = a->q2 + b->q2;
+    p.q3 = a->q3 + b->q3;
+
+    *result = p;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionConjugate(fpQuaternion_t * result, const fpQuaternion_t * q)
+{
+    result->q0 = q->q0;
+    result->q1 = -q->q1;
+    result->q2 = -q->q2;
+    result->q3 = -q->q3;
+
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionNormalize(fpQuaternion_t * result, const fpQuaternion_t * q)
+{
+    float mod = sqrtf(quaternionNormSqared(q));
+    if (mod < 1e-6f) {
+
+        result->q0 = 1;
+        result->q1 = 0;
+        result->q2 = 0;
+        result->q3 = 0;
+    }
+    else {
+        result->q0 = q->q0 / mod;
+        result->q1 = q->q1 / mod;
+        result->q2 = q->q2 / mod;
+        result->q3 = q->q3 / mod;
+    }
+
+    return result;
+}
+
+static inline fpVector3_t * quaternionRotateVector(fpVector3_t * result, const fpVector3_t * vect, const fpQuaternion_t * ref)
+{
+    fpQuaternion_t vectQuat, refConj;
+
+    vectQuat.q0 = 0;
+    vectQuat.q1 = vect->x;
+    vectQuat.q2 = vect->y;
+    vectQuat.q3 = vect->z;
+
+    quaternionConjugate(&refConj, ref);
+    quaternionMultiply(&vectQuat, &refConj, &vectQuat);
+    quaternionMultiply(&vectQuat, &vectQuat, ref);
+
+    result->x = vectQuat.q1;
+    result->y = vectQuat.q2;
+    result->z = vectQuat.q3;
+    return result;
+}
+
+static inline fpVector3_t * quaternionRotateVectorInv(fpVector3_t * result, const fpVector3_t * vect, const fpQuaternion_t * ref)
+{
+    fpQuaternion_t vectQuat, refConj;
+
+    vectQuat.q0 = 0;
+    vectQuat.q1 = vect->x;
+    vectQuat.q2 = vect->y;
+    vectQuat.q3 = vect->z;
+
+    quaternionConjugate(&refConj, ref);
+    quaternionMultiply(&vectQuat, ref, &vectQuat);
+    quaternionMultiply(&vectQuat, &vectQuat, &refConj);
+
+    result->x = vectQuat.q1;
+    result->y = vectQuat.q2;
+    result->z = vectQuat.q3;
+    return result;
+}
+# 24 "./src/main/flight/imu.h" 2
+
+
+
+extern fpVector3_t imuMeasuredAccelBF;
+extern fpVector3_t imuMeasuredRotationBF;
+
+typedef union {
+    int16_t raw[3];
+    struct {
+
+        int16_t roll;
+        int16_t pitch;
+        int16_t yaw;
+    } values;
+} attitudeEulerAngles_t;
+
+extern fpQuaternion_t orientation;
+extern attitudeEulerAngles_t attitude;
+extern float rMat[3][3];
+
+typedef struct imuConfig_s {
+    uint16_t dcm_kp_acc;
+    uint16_t dcm_ki_acc;
+    uint16_t dcm_kp_mag;
+    uint16_t dcm_ki_mag;
+    uint8_t small_angle;
+    uint8_t acc_ignore_rate;
+    uint8_t acc_ignore_slope;
+} imuConfig_t;
+
+extern imuConfig_t imuConfig_System; extern imuConfig_t imuConfig_Copy; static inline const imuConfig_t* imuConfig(void) { return &imuConfig_System; } static inline imuConfig_t* imuConfigMutable(void) { return &imuConfig_System; } struct _dummy;
+
+typedef struct imuRuntimeConfig_s {
+    float dcm_kp_acc;
+    float dcm_ki_acc;
+    float dcm_kp_mag;
+    float dcm_ki_mag;
+    uint8_t small_angle;
+} imuRuntimeConfig_t;
+
+void imuConfigure(void);
+
+void imuSetMagneticDeclination(float declinationDeg);
+void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuUpdateAccelerometer(void);
+float calculateCosTiltAngle(void);
+
+# 70 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 70 "./src/main/flight/imu.h"
+    isImuReady(void);
+
+# 71 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 71 "./src/main/flight/imu.h"
+    isImuHeadingValid(void);
+
+void imuTransformVectorBodyToEarth(fpVector3_t * v);
+void imuTransformVectorEarthToBody(fpVector3_t * v);
+
+void imuInit(void);
+# 58 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 18 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+
+#define MAX_SUPPORTED_MOTORS 12
+
+
+#define YAW_JUMP_PREVENTION_LIMIT_LOW 80
+#define YAW_JUMP_PREVENTION_LIMIT_HIGH 500
+
+#define FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450
+
+
+#define DSHOT_DISARM_COMMAND 0
+#define DSHOT_MIN_THROTTLE 48
+#define DSHOT_MAX_THROTTLE 2047
+#define DSHOT_3D_DEADBAND_LOW 1047
+#define DSHOT_3D_DEADBAND_HIGH 1048
+
+typedef enum {
+    PLATFORM_MULTIROTOR = 0,
+    PLATFORM_AIRPLANE = 1,
+    PLATFORM_HELICOPTER = 2,
+    PLATFORM_TRICOPTER = 3,
+    PLATFORM_ROVER = 4,
+    PLATFORM_BOAT = 5,
+    PLATFORM_OTHER = 6
+} flyingPlatformType_e;
+
+typedef struct motorAxisCorrectionLimits_s {
+    int16_t min;
+    int16_t max;
+} motorAxisCorrectionLimits_t;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t primaryMotorMixer_SystemArray[12]; extern motorMixer_t primaryMotorMixer_CopyArray[12]; static inline const motorMixer_t* primaryMotorMixer(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t* primaryMotorMixerMutable(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* primaryMotorMixer_array(void))[12] { return &primaryMotorMixer_SystemArray; } struct _dummy;
+
+typedef struct mixerConfig_s {
+    int8_t motorDirectionInverted;
+    uint8_t platformType;
+    
+# 68 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 68 "./src/main/flight/mixer.h"
+        hasFlaps;
+    int16_t appliedMixerPreset;
+    uint16_t fwMinThrottleDownPitchAngle;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct reversibleMotorsConfig_s {
+    uint16_t deadband_low;
+    uint16_t deadband_high;
+    uint16_t neutral;
+} reversibleMotorsConfig_t;
+
+extern reversibleMotorsConfig_t reversibleMotorsConfig_System; extern reversibleMotorsConfig_t reversibleMotorsConfig_Copy; static inline const reversibleMotorsConfig_t* reversibleMotorsConfig(void) { return &reversibleMotorsConfig_System; } static inline reversibleMotorsConfig_t* reversibleMotorsConfigMutable(void) { return &reversibleMotorsConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint16_t motorAccelTimeMs;
+    uint16_t motorDecelTimeMs;
+    uint16_t digitalIdleOffsetValue;
+    float throttleIdle;
+    float throttleScale;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+typedef enum {
+    MOTOR_STOPPED_USER,
+    MOTOR_STOPPED_AUTO,
+    MOTOR_RUNNING
+} motorStatus_e;
+
+typedef enum {
+    MOTOR_DIRECTION_FORWARD,
+    MOTOR_DIRECTION_BACKWARD,
+    MOTOR_DIRECTION_DEADBAND
+} reversibleMotorsThrottleState_e;
+
+extern int16_t motor[12];
+extern int16_t motor_disarmed[12];
+extern int mixerThrottleCommand;
+
+int getThrottleIdleValue(void);
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 118 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 118 "./src/main/flight/mixer.h"
+    mixerIsOutputSaturated(void);
+motorStatus_e getMotorStatus(void);
+
+void writeAllMotors(int16_t mc);
+void mixerInit(void);
+void mixerUpdateStateFlags(void);
+void mixerResetDisarmedMotors(void);
+void mixTable(const float dT);
+void writeMotors(void);
+void processServoAutotrim(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+void loadPrimaryMotorMixer(void);
+# 59 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 18 "./src/main/flight/pid.h"
+       
+
+
+
+
+#define GYRO_SATURATION_LIMIT 1800
+#define PID_SUM_LIMIT_MIN 100
+#define PID_SUM_LIMIT_MAX 1000
+#define PID_SUM_LIMIT_DEFAULT 500
+#define PID_SUM_LIMIT_YAW_DEFAULT 350
+
+#define HEADING_HOLD_RATE_LIMIT_MIN 10
+#define HEADING_HOLD_RATE_LIMIT_MAX 250
+#define HEADING_HOLD_RATE_LIMIT_DEFAULT 90
+
+#define FW_ITERM_THROW_LIMIT_DEFAULT 165
+#define FW_ITERM_THROW_LIMIT_MIN 0
+#define FW_ITERM_THROW_LIMIT_MAX 500
+
+#define AXIS_ACCEL_MIN_LIMIT 50
+
+#define HEADING_HOLD_ERROR_LPF_FREQ 2
+
+
+
+
+#define FP_PID_RATE_FF_MULTIPLIER 31.0f
+#define FP_PID_RATE_P_MULTIPLIER 31.0f
+#define FP_PID_RATE_I_MULTIPLIER 4.0f
+#define FP_PID_RATE_D_MULTIPLIER 1905.0f
+#define FP_PID_RATE_D_FF_MULTIPLIER 7270.0f
+#define FP_PID_LEVEL_P_MULTIPLIER 6.56f
+#define FP_PID_YAWHOLD_P_MULTIPLIER 80.0f
+
+#define MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f
+#define MC_ITERM_RELAX_CUTOFF_DEFAULT 15
+
+#define ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15
+
+typedef enum {
+
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_POS_Z,
+    PID_POS_XY,
+    PID_VEL_XY,
+    PID_SURFACE,
+    PID_LEVEL,
+    PID_HEADING,
+    PID_VEL_Z,
+    PID_POS_HEADING,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+
+typedef enum {
+    PID_TYPE_NONE = 0,
+    PID_TYPE_PID,
+    PID_TYPE_PIFF,
+    PID_TYPE_AUTO,
+} pidType_e;
+
+typedef struct pid8_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint8_t FF;
+} pid8_t;
+
+typedef struct pidBank_s {
+    pid8_t pid[PID_ITEM_COUNT];
+} pidBank_t;
+
+typedef enum {
+    ITERM_RELAX_OFF = 0,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO = 0,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+typedef struct pidProfile_s {
+    uint8_t pidControllerType;
+    pidBank_t bank_fw;
+    pidBank_t bank_mc;
+
+    uint8_t dterm_lpf_type;
+    uint16_t dterm_lpf_hz;
+
+    uint8_t dterm_lpf2_type;
+    uint16_t dterm_lpf2_hz;
+
+    uint8_t yaw_lpf_hz;
+
+    uint8_t heading_hold_rate_limit;
+
+    uint8_t itermWindupPointPercent;
+
+    uint32_t axisAccelerationLimitYaw;
+    uint32_t axisAccelerationLimitRollPitch;
+
+    int16_t max_angle_inclination[2];
+
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+
+
+    uint16_t fixedWingItermThrowLimit;
+    float fixedWingReferenceAirspeed;
+    float fixedWingCoordinatedYawGain;
+    float fixedWingItermLimitOnStickPosition;
+
+    uint8_t loiter_direction;
+    float navVelXyDTermLpfHz;
+
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+
+    float dBoostFactor;
+    float dBoostMaxAtAlleceleration;
+    uint8_t dBoostGyroDeltaLpfHz;
+    float antigravityGain;
+    float antigravityAccelerator;
+    uint8_t antigravityCutoff;
+
+    uint16_t navFwPosHdgPidsumLimit;
+    uint8_t controlDerivativeLpfHz;
+} pidProfile_t;
+
+typedef struct pidAutotuneConfig_s {
+    uint16_t fw_overshoot_time;
+    uint16_t fw_undershoot_time;
+    uint8_t fw_max_rate_threshold;
+    uint8_t fw_ff_to_p_gain;
+    uint16_t fw_ff_to_i_time_constant;
+} pidAutotuneConfig_t;
+
+extern pidProfile_t *pidProfile_ProfileCurrent; static inline const pidProfile_t* pidProfile(void) { return pidProfile_ProfileCurrent; } static inline pidProfile_t* pidProfileMutable(void) { return pidProfile_ProfileCurrent; } struct _dummy;
+extern pidAutotuneConfig_t pidAutotuneConfig_System; extern pidAutotuneConfig_t pidAutotuneConfig_Copy; static inline const pidAutotuneConfig_t* pidAutotuneConfig(void) { return &pidAutotuneConfig_System; } static inline pidAutotuneConfig_t* pidAutotuneConfigMutable(void) { return &pidAutotuneConfig_System; } struct _dummy;
+
+const pidBank_t * pidBank(void);
+pidBank_t * pidBankMutable(void);
+
+extern int16_t axisPID[];
+extern int32_t axisPID_P[], axisPID_I[], axisPID_D[], axisPID_Setpoint[];
+
+void pidInit(void);
+
+# 170 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 170 "./src/main/flight/pid.h"
+    pidInitFilters(void);
+void pidResetErrorAccumulators(void);
+void pidResetTPAFilter(void);
+
+struct controlRateConfig_s;
+struct motorConfig_s;
+struct rxConfig_s;
+
+void schedulePidGainsUpdate(void);
+void updatePIDCoefficients(float dT);
+void pidController(float dT);
+
+float pidRateToRcCommand(float rateDPS, uint8_t rate);
+int16_t pidAngleToRcCommand(float angleDeciDegrees, int16_t maxInclination);
+
+enum {
+    HEADING_HOLD_DISABLED = 0,
+    HEADING_HOLD_UPDATE_HEADING,
+    HEADING_HOLD_ENABLED
+};
+
+void updateHeadingHoldTarget(int16_t heading);
+void resetHeadingHoldTarget(int16_t heading);
+int16_t getHeadingHoldTarget(void);
+
+void autotuneUpdateState(void);
+void autotuneFixedWingUpdate(const flight_dynamics_index_t axis, float desiredRateDps, float reachedRateDps, float pidOutput);
+
+pidType_e pidIndexGetType(pidIndex_e pidIndex);
+# 60 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 18 "./src/main/flight/servos.h"
+       
+
+
+# 1 "./src/main/common/logic_condition.h" 1
+# 24 "./src/main/common/logic_condition.h"
+       
+
+
+
+
+#define MAX_LOGIC_CONDITIONS 16
+
+typedef enum {
+    LOGIC_CONDITION_TRUE = 0,
+    LOGIC_CONDITION_EQUAL,
+    LOGIC_CONDITION_GREATER_THAN,
+    LOGIC_CONDITION_LOWER_THAN,
+    LOGIC_CONDITION_LOW,
+    LOGIC_CONDITION_MID,
+    LOGIC_CONDITION_HIGH,
+    LOGIC_CONDITION_AND,
+    LOGIC_CONDITION_OR,
+    LOGIC_CONDITION_XOR,
+    LOGIC_CONDITION_NAND,
+    LOGIC_CONDITION_NOR,
+    LOGIC_CONDITION_NOT,
+    LOGIC_CONDITION_STICKY,
+    LOGIC_CONDITION_ADD,
+    LOGIC_CONDITION_SUB,
+    LOGIC_CONDITION_MUL,
+    LOGIC_CONDITION_DIV,
+    LOGIC_CONDITION_GVAR_SET,
+    LOGIC_CONDITION_GVAR_INC,
+    LOGIC_CONDITION_GVAR_DEC,
+    LOGIC_CONDITION_LAST
+} logicOperation_e;
+
+typedef enum logicOperandType_s {
+    LOGIC_CONDITION_OPERAND_TYPE_VALUE = 0,
+    LOGIC_CONDITION_OPERAND_TYPE_RC_CHANNEL,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT_MODE,
+    LOGIC_CONDITION_OPERAND_TYPE_LC,
+    LOGIC_CONDITION_OPERAND_TYPE_GVAR,
+    LOGIC_CONDITION_OPERAND_TYPE_LAST
+} logicOperandType_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_ARM_TIMER = 0,
+    LOGIC_CONDITION_OPERAND_FLIGHT_HOME_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TRIP_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_RSSI,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VBAT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CELL_VOLTAGE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CURRENT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MAH_DRAWN,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GPS_SATS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GROUD_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_3D_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_AIR_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ALTITUDE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VERTICAL_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TROTTLE_POS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ARMED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_AUTOLAUNCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ALTITUDE_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_POSITION_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_EMERGENCY_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_WP,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_YAW,
+} logicFlightOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_MANUAL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_POSHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_CRUISE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ALTHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ANGLE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_HORIZON,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_AIR,
+} logicFlightModeOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_FLAG_LATCH = 1 << 0,
+} logicConditionFlags_e;
+
+typedef struct logicOperand_s {
+    logicOperandType_e type;
+    int32_t value;
+} logicOperand_t;
+
+typedef struct logicCondition_s {
+    uint8_t enabled;
+    int8_t activatorId;
+    logicOperation_e operation;
+    logicOperand_t operandA;
+    logicOperand_t operandB;
+    uint8_t flags;
+} logicCondition_t;
+
+extern logicCondition_t logicConditions_SystemArray[16]; extern logicCondition_t logicConditions_CopyArray[16]; static inline const logicCondition_t* logicConditions(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t* logicConditionsMutable(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t (* logicConditions_array(void))[16] { return &logicConditions_SystemArray; } struct _dummy;
+
+typedef struct logicConditionState_s {
+    int value;
+    uint8_t flags;
+} logicConditionState_t;
+
+void logicConditionProcess(uint8_t i);
+
+int logicConditionGetOperandValue(logicOperandType_e type, int operand);
+
+int logicConditionGetValue(int8_t conditionId);
+void logicConditionUpdateTask(timeUs_t currentTimeUs);
+void logicConditionReset(void);
+# 22 "./src/main/flight/servos.h" 2
+
+#define MAX_SUPPORTED_SERVOS 16
+
+
+typedef enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH = 1,
+    INPUT_STABILIZED_YAW = 2,
+    INPUT_STABILIZED_THROTTLE = 3,
+    INPUT_RC_ROLL = 4,
+    INPUT_RC_PITCH = 5,
+    INPUT_RC_YAW = 6,
+    INPUT_RC_THROTTLE = 7,
+    INPUT_RC_CH5 = 8,
+    INPUT_RC_CH6 = 9,
+    INPUT_RC_CH7 = 10,
+    INPUT_RC_CH8 = 11,
+    INPUT_GIMBAL_PITCH = 12,
+    INPUT_GIMBAL_ROLL = 13,
+    INPUT_FEATURE_FLAPS = 14,
+    INPUT_RC_CH9 = 15,
+    INPUT_RC_CH10 = 16,
+    INPUT_RC_CH11 = 17,
+    INPUT_RC_CH12 = 18,
+    INPUT_RC_CH13 = 19,
+    INPUT_RC_CH14 = 20,
+    INPUT_RC_CH15 = 21,
+    INPUT_RC_CH16 = 22,
+    INPUT_STABILIZED_ROLL_PLUS = 23,
+    INPUT_STABILIZED_ROLL_MINUS = 24,
+    INPUT_STABILIZED_PITCH_PLUS = 25,
+    INPUT_STABILIZED_PITCH_MINUS = 26,
+    INPUT_STABILIZED_YAW_PLUS = 27,
+    INPUT_STABILIZED_YAW_MINUS = 28,
+    INPUT_MAX = 29,
+    INPUT_GVAR_0 = 30,
+    INPUT_GVAR_1 = 31,
+    INPUT_GVAR_2 = 32,
+    INPUT_GVAR_3 = 33,
+
+    INPUT_SOURCE_COUNT
+} inputSource_e;
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_ELEVATOR = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+} servoIndex_e;
+
+#define SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR
+#define SERVO_PLANE_INDEX_MAX SERVO_RUDDER
+
+#define SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT
+#define SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT
+
+#define SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1
+#define SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4
+
+#define SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1
+#define SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2
+
+#define FLAPERON_THROW_DEFAULT 200
+#define FLAPERON_THROW_MIN 50
+#define FLAPERON_THROW_MAX 450
+
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int16_t rate;
+    uint8_t speed;
+
+    int8_t conditionId;
+
+} servoMixer_t;
+
+#define MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)
+#define MAX_SERVO_SPEED UINT8_MAX
+#define SERVO_OUTPUT_MAX 2500
+#define SERVO_OUTPUT_MIN 500
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 16)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 16)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 16)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+typedef struct servoParam_s {
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[16]; extern servoParam_t servoParams_CopyArray[16]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[16] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    int16_t servo_lowpass_freq;
+    uint16_t flaperon_throw_offset;
+    uint8_t servo_protocol;
+    uint8_t tri_unarmed_servo;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoMetadata_s {
+    float scaleMax;
+    float scaleMin;
+} servoMetadata_t;
+
+extern int16_t servo[16];
+
+
+# 148 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 148 "./src/main/flight/servos.h"
+    isServoOutputEnabled(void);
+void setServoOutputEnabled(
+# 149 "./src/main/flight/servos.h" 3 4
+                          _Bool 
+# 149 "./src/main/flight/servos.h"
+                               flag);
+
+# 150 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 150 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void loadCustomServoMixer(void);
+void servoMixer(float dT);
+void servoComputeScalingFactors(uint8_t servoIndex);
+void servosInit(void);
+int getServoCount(void);
+# 61 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/rpm_filter.h" 1
+# 25 "./src/main/flight/rpm_filter.h"
+       
+
+
+
+
+typedef struct rpmFilterConfig_s {
+    uint8_t gyro_filter_enabled;
+    uint8_t dterm_filter_enabled;
+
+    uint8_t gyro_harmonics;
+    uint8_t gyro_min_hz;
+    uint16_t gyro_q;
+
+    uint8_t dterm_harmonics;
+    uint8_t dterm_min_hz;
+    uint16_t dterm_q;
+
+} rpmFilterConfig_t;
+
+extern rpmFilterConfig_t rpmFilterConfig_System; extern rpmFilterConfig_t rpmFilterConfig_Copy; static inline const rpmFilterConfig_t* rpmFilterConfig(void) { return &rpmFilterConfig_System; } static inline rpmFilterConfig_t* rpmFilterConfigMutable(void) { return &rpmFilterConfig_System; } struct _dummy;
+
+#define RPM_FILTER_UPDATE_RATE_HZ 500
+#define RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)
+
+void disableRpmFilters(void);
+void rpmFiltersInit(void);
+void rpmFilterUpdateTask(timeUs_t currentTimeUs);
+void rpmFilterGyroApply(float *values);
+# 62 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/io/beeper.h" 1
+# 18 "./src/main/io/beeper.h"
+       
+
+
+
+typedef enum {
+
+    BEEPER_SILENCE = 0,
+
+    BEEPER_RUNTIME_CALIBRATION_DONE,
+    BEEPER_HARDWARE_FAILURE,
+    BEEPER_RX_LOST,
+    BEEPER_RX_LOST_LANDING,
+    BEEPER_DISARMING,
+    BEEPER_ARMING,
+    BEEPER_ARMING_GPS_FIX,
+    BEEPER_BAT_CRIT_LOW,
+    BEEPER_BAT_LOW,
+    BEEPER_GPS_STATUS,
+    BEEPER_RX_SET,
+    BEEPER_ACTION_SUCCESS,
+    BEEPER_ACTION_FAIL,
+    BEEPER_READY_BEEP,
+    BEEPER_MULTI_BEEPS,
+    BEEPER_DISARM_REPEAT,
+    BEEPER_ARMED,
+    BEEPER_SYSTEM_INIT,
+    BEEPER_USB,
+    BEEPER_LAUNCH_MODE_ENABLED,
+    BEEPER_CAM_CONNECTION_OPEN,
+    BEEPER_CAM_CONNECTION_CLOSE,
+
+    BEEPER_ALL,
+    BEEPER_PREFERENCE,
+
+} beeperMode_e;
+
+void beeper(beeperMode_e mode);
+void beeperSilence(void);
+void beeperUpdate(timeUs_t currentTimeUs);
+void beeperConfirmationBeeps(uint8_t beepCount);
+uint32_t getArmingBeepTimeMicros(void);
+beeperMode_e beeperModeForTableIndex(int idx);
+const char *beeperNameForTableIndex(int idx);
+int beeperTableEntryCount(void);
+# 64 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/io/gps.h" 1
+# 18 "./src/main/io/gps.h"
+       
+
+
+
+
+
+
+
+#define GPS_DBHZ_MIN 0
+#define GPS_DBHZ_MAX 55
+
+#define LAT 0
+#define LON 1
+
+#define GPS_DEGREES_DIVIDER 10000000L
+
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX,
+    GPS_I2CNAV,
+    GPS_NAZA,
+    GPS_UBLOX7PLUS,
+    GPS_MTK,
+    GPS_PROVIDER_COUNT
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN,
+    SBAS_NONE
+} sbasMode_e;
+
+#define SBAS_MODE_MAX SBAS_GAGAN
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600,
+    GPS_BAUDRATE_COUNT
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON,
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+typedef enum {
+    GPS_DYNMODEL_PEDESTRIAN = 0,
+    GPS_DYNMODEL_AIR_1G,
+    GPS_DYNMODEL_AIR_4G,
+} gpsDynModel_e;
+
+typedef enum {
+    GPS_NO_FIX = 0,
+    GPS_FIX_2D,
+    GPS_FIX_3D
+} gpsFixType_e;
+
+#define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+    gpsDynModel_e dynModel;
+    
+# 94 "./src/main/io/gps.h" 3 4
+   _Bool 
+# 94 "./src/main/io/gps.h"
+        ubloxUseGalileo;
+    uint8_t gpsMinSats;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+} gpsLocation_t;
+
+#define HDOP_SCALE (100)
+
+typedef struct gpsSolutionData_s {
+    struct {
+        
+# 116 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 116 "./src/main/io/gps.h"
+            hasNewData;
+        
+# 117 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 117 "./src/main/io/gps.h"
+            gpsHeartbeat;
+        
+# 118 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 118 "./src/main/io/gps.h"
+            validVelNE;
+        
+# 119 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 119 "./src/main/io/gps.h"
+            validVelD;
+        
+# 120 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 120 "./src/main/io/gps.h"
+            validMag;
+        
+# 121 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 121 "./src/main/io/gps.h"
+            validEPE;
+        
+# 122 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 122 "./src/main/io/gps.h"
+            validTime;
+    } flags;
+
+    gpsFixType_e fixType;
+    uint8_t numSat;
+
+    gpsLocation_t llh;
+    int16_t magData[3];
+    int16_t velNED[3];
+
+    int16_t groundSpeed;
+    int16_t groundCourse;
+
+    uint16_t eph;
+    uint16_t epv;
+
+    uint16_t hdop;
+
+    dateTime_t time;
+
+} gpsSolutionData_t;
+
+typedef struct {
+    uint16_t lastMessageDt;
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t packetCount;
+} gpsStatistics_t;
+
+extern gpsSolutionData_t gpsSol;
+extern gpsStatistics_t gpsStats;
+
+struct magDev_s;
+
+# 155 "./src/main/io/gps.h" 3 4
+_Bool 
+# 155 "./src/main/io/gps.h"
+    gpsMagDetect(struct magDev_s *mag);
+void gpsPreInit(void);
+void gpsInit(void);
+
+
+
+# 160 "./src/main/io/gps.h" 3 4
+_Bool 
+# 160 "./src/main/io/gps.h"
+    gpsUpdate(void);
+void updateGpsIndicator(timeUs_t currentTimeUs);
+
+# 162 "./src/main/io/gps.h" 3 4
+_Bool 
+# 162 "./src/main/io/gps.h"
+    isGPSHealthy(void);
+
+# 163 "./src/main/io/gps.h" 3 4
+_Bool 
+# 163 "./src/main/io/gps.h"
+    isGPSHeadingValid(void);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+# 65 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/navigation/navigation.h" 1
+# 18 "./src/main/navigation/navigation.h"
+       
+
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 18 "./src/main/common/filter.h"
+       
+
+
+
+typedef struct rateLimitFilter_s {
+    float state;
+} rateLimitFilter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float RC;
+    float dT;
+} pt1Filter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef union {
+    biquadFilter_t biquad;
+    pt1Filter_t pt1;
+} filter_t;
+
+
+typedef struct pt1Filter3_s {
+    float state[3];
+    float k;
+} pt1Filter3_t;
+
+typedef struct biquadFilter3_s {
+    float b0[3], b1[3], b2[3], a1[3], a2[3];
+    float x1[3], x2[3], y1[3], y2[3];
+} biquadFilter3_t;
+
+typedef union {
+    biquadFilter3_t biquad;
+    pt1Filter3_t pt1;
+} filter3_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD
+} filterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH
+} biquadFilterType_e;
+
+typedef struct firFilter_s {
+    float *buf;
+    const float *coeffs;
+    uint8_t bufLength;
+    uint8_t coeffsLength;
+} firFilter_t;
+
+typedef float (*filterApplyFnPtr)(void *filter, float input);
+typedef float (*filterApply4FnPtr)(void *filter, float input, float f_cut, float dt);
+typedef void (*filter3ApplyFnPtr)(void *filter, float *values);
+
+float nullFilterApply(void *filter, float input);
+float nullFilterApply4(void *filter, float input, float f_cut, float dt);
+
+void pt1FilterInit(pt1Filter_t *filter, float f_cut, float dT);
+void pt1FilterInitRC(pt1Filter_t *filter, float tau, float dT);
+void pt1FilterSetTimeConstant(pt1Filter_t *filter, float tau);
+float pt1FilterGetLastOutput(pt1Filter_t *filter);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+float pt1FilterApply3(pt1Filter_t *filter, float input, float dT);
+float pt1FilterApply4(pt1Filter_t *filter, float input, float f_cut, float dt);
+void pt1FilterReset(pt1Filter_t *filter, float input);
+
+void rateLimitFilterInit(rateLimitFilter_t *filter);
+float rateLimitFilterApply4(rateLimitFilter_t *filter, float input, float rate_limit, float dT);
+
+void biquadFilterInitNotch(biquadFilter_t *filter, uint32_t samplingIntervalUs, uint16_t filterFreq, uint16_t cutoffHz);
+void biquadFilterInitLPF(biquadFilter_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs);
+void biquadFilterInit(biquadFilter_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs, float Q, biquadFilterType_e filterType);
+float biquadFilterApply(biquadFilter_t *filter, float sample);
+float biquadFilterReset(biquadFilter_t *filter, float value);
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFrequencyHz, float cutoffFrequencyHz);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+
+void nullFilter3Apply(void *filter, float *values);
+
+void pt1Filter3Init(pt1Filter3_t *filter, float f_cut, float dT);
+void pt1Filter3Apply(pt1Filter3_t *filter, float *values);
+
+void biquadFilter3InitNotch(biquadFilter3_t *filter, uint32_t samplingIntervalUs, uint16_t filterFreq, uint16_t cutoffHz);
+void biquadFilter3InitLPF(biquadFilter3_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs);
+void biquadFilter3Init(biquadFilter3_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs, float Q, biquadFilterType_e filterType);
+void biquadFilter3Update(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilter3UpdateAxis(biquadFilter3_t *filter, int axis, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilter3Apply(biquadFilter3_t *filter, float *values);
+void biquadFilter3ApplyDF1(biquadFilter3_t *filter, float *values);
+# 24 "./src/main/navigation/navigation.h" 2
+# 34 "./src/main/navigation/navigation.h"
+extern gpsLocation_t GPS_home;
+extern uint32_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+
+extern 
+# 38 "./src/main/navigation/navigation.h" 3 4
+      _Bool 
+# 38 "./src/main/navigation/navigation.h"
+           autoThrottleManuallyIncreased;
+
+
+void onNewGPSData(void);
+
+
+
+#define NAV_BLACKBOX 
+
+
+
+
+
+
+#define NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2
+
+enum {
+    NAV_GPS_ATTI = 0,
+    NAV_GPS_CRUISE = 1
+};
+
+enum {
+    NAV_LOITER_RIGHT = 0,
+    NAV_LOITER_LEFT = 1,
+    NAV_LOITER_YAW = 2
+};
+
+enum {
+    NAV_RTH_NO_ALT = 0,
+    NAV_RTH_EXTRA_ALT = 1,
+    NAV_RTH_CONST_ALT = 2,
+    NAV_RTH_MAX_ALT = 3,
+    NAV_RTH_AT_LEAST_ALT = 4,
+    NAV_RTH_AT_LEAST_ALT_LINEAR_DESCENT = 5,
+
+};
+
+enum {
+    NAV_HEADING_CONTROL_NONE = 0,
+    NAV_HEADING_CONTROL_AUTO,
+    NAV_HEADING_CONTROL_MANUAL
+};
+
+typedef enum {
+    NAV_RESET_NEVER = 0,
+    NAV_RESET_ON_FIRST_ARM,
+    NAV_RESET_ON_EACH_ARM,
+} nav_reset_type_e;
+
+typedef enum {
+    NAV_RTH_ALLOW_LANDING_NEVER = 0,
+    NAV_RTH_ALLOW_LANDING_ALWAYS = 1,
+    NAV_RTH_ALLOW_LANDING_FS_ONLY = 2,
+} navRTHAllowLanding_e;
+
+typedef enum {
+    NAV_EXTRA_ARMING_SAFETY_OFF = 0,
+    NAV_EXTRA_ARMING_SAFETY_ON = 1,
+    NAV_EXTRA_ARMING_SAFETY_ALLOW_BYPASS = 2,
+} navExtraArmingSafety_e;
+
+typedef enum {
+    NAV_ARMING_BLOCKER_NONE = 0,
+    NAV_ARMING_BLOCKER_MISSING_GPS_FIX = 1,
+    NAV_ARMING_BLOCKER_NAV_IS_ALREADY_ACTIVE = 2,
+    NAV_ARMING_BLOCKER_FIRST_WAYPOINT_TOO_FAR = 3,
+    NAV_ARMING_BLOCKER_JUMP_WAYPOINT_ERROR = 4,
+} navArmingBlocker_e;
+
+typedef struct positionEstimationConfig_s {
+    uint8_t automatic_mag_declination;
+    uint8_t reset_altitude_type;
+    uint8_t reset_home_type;
+    uint8_t gravity_calibration_tolerance;
+    uint8_t use_gps_velned;
+    uint8_t allow_dead_reckoning;
+
+    uint16_t max_surface_altitude;
+
+    float w_z_baro_p;
+
+    float w_z_surface_p;
+    float w_z_surface_v;
+
+    float w_z_gps_p;
+    float w_z_gps_v;
+
+    float w_xy_gps_p;
+    float w_xy_gps_v;
+
+    float w_xy_flow_p;
+    float w_xy_flow_v;
+
+    float w_z_res_v;
+    float w_xy_res_v;
+
+    float w_acc_bias;
+    float w_xyz_acc_p;
+
+    float max_eph_epv;
+    float baro_epv;
+} positionEstimationConfig_t;
+
+extern positionEstimationConfig_t positionEstimationConfig_System; extern positionEstimationConfig_t positionEstimationConfig_Copy; static inline const positionEstimationConfig_t* positionEstimationConfig(void) { return &positionEstimationConfig_System; } static inline positionEstimationConfig_t* positionEstimationConfigMutable(void) { return &positionEstimationConfig_System; } struct _dummy;
+
+typedef struct navConfig_s {
+
+    struct {
+        struct {
+            uint8_t use_thr_mid_for_althold;
+            uint8_t extra_arming_safety;
+            uint8_t user_control_mode;
+            uint8_t rth_alt_control_mode;
+            uint8_t rth_climb_first;
+            uint8_t rth_tail_first;
+            uint8_t disarm_on_landing;
+            uint8_t rth_allow_landing;
+            uint8_t rth_climb_ignore_emerg;
+            uint8_t auto_overrides_motor_stop;
+        } flags;
+
+        uint8_t pos_failure_timeout;
+        uint16_t waypoint_radius;
+        uint16_t waypoint_safe_distance;
+        uint16_t max_auto_speed;
+        uint16_t max_auto_climb_rate;
+        uint16_t max_manual_speed;
+        uint16_t max_manual_climb_rate;
+        uint16_t land_descent_rate;
+        uint16_t land_slowdown_minalt;
+        uint16_t land_slowdown_maxalt;
+        uint16_t emerg_descent_rate;
+        uint16_t rth_altitude;
+        uint16_t rth_home_altitude;
+        uint16_t min_rth_distance;
+        uint16_t rth_abort_threshold;
+        uint16_t max_terrain_follow_altitude;
+        uint16_t rth_home_offset_distance;
+        uint16_t rth_home_offset_direction;
+    } general;
+
+    struct {
+        uint8_t max_bank_angle;
+        uint16_t hover_throttle;
+        uint16_t auto_disarm_delay;
+        uint16_t braking_speed_threshold;
+        uint16_t braking_disengage_speed;
+        uint16_t braking_timeout;
+        uint8_t braking_boost_factor;
+        uint16_t braking_boost_timeout;
+        uint16_t braking_boost_speed_threshold;
+        uint16_t braking_boost_disengage_speed;
+        uint8_t braking_bank_angle;
+        uint8_t posDecelerationTime;
+        uint8_t posResponseExpo;
+    } mc;
+
+    struct {
+        uint8_t max_bank_angle;
+        uint8_t max_climb_angle;
+        uint8_t max_dive_angle;
+        uint16_t cruise_throttle;
+        uint16_t cruise_speed;
+        uint8_t control_smoothness;
+        uint16_t min_throttle;
+        uint16_t max_throttle;
+        uint8_t pitch_to_throttle;
+        uint16_t loiter_radius;
+        int8_t land_dive_angle;
+        uint16_t launch_velocity_thresh;
+        uint16_t launch_accel_thresh;
+        uint16_t launch_time_thresh;
+        uint16_t launch_idle_throttle;
+        uint16_t launch_throttle;
+        uint16_t launch_motor_timer;
+        uint16_t launch_motor_spinup_time;
+        uint16_t launch_min_time;
+        uint16_t launch_timeout;
+        uint16_t launch_max_altitude;
+        uint8_t launch_climb_angle;
+        uint8_t launch_max_angle;
+        uint8_t cruise_yaw_rate;
+        
+# 220 "./src/main/navigation/navigation.h" 3 4
+       _Bool 
+# 220 "./src/main/navigation/navigation.h"
+                allow_manual_thr_increase;
+        
+# 221 "./src/main/navigation/navigation.h" 3 4
+       _Bool 
+# 221 "./src/main/navigation/navigation.h"
+            useFwNavYawControl;
+        uint8_t yawControlDeadband;
+    } fw;
+} navConfig_t;
+
+extern navConfig_t navConfig_System; extern navConfig_t navConfig_Copy; static inline const navConfig_t* navConfig(void) { return &navConfig_System; } static inline navConfig_t* navConfigMutable(void) { return &navConfig_System; } struct _dummy;
+
+typedef struct gpsOrigin_s {
+    
+# 229 "./src/main/navigation/navigation.h" 3 4
+   _Bool 
+# 229 "./src/main/navigation/navigation.h"
+           valid;
+    float scale;
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+} gpsOrigin_t;
+
+typedef enum {
+    NAV_WP_ACTION_WAYPOINT = 0x01,
+    NAV_WP_ACTION_HOLD_TIME = 0x03,
+    NAV_WP_ACTION_RTH = 0x04,
+    NAV_WP_ACTION_SET_POI = 0x05,
+    NAV_WP_ACTION_JUMP = 0x06,
+    NAV_WP_ACTION_SET_HEAD = 0x07,
+    NAV_WP_ACTION_LAND = 0x08
+} navWaypointActions_e;
+
+typedef enum {
+    NAV_WP_HEAD_MODE_NONE = 0,
+    NAV_WP_HEAD_MODE_POI = 1,
+    NAV_WP_HEAD_MODE_FIXED = 2
+} navWaypointHeadings_e;
+
+typedef enum {
+    NAV_WP_FLAG_LAST = 0xA5
+} navWaypointFlags_e;
+
+typedef struct {
+    uint8_t action;
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+    int16_t p1, p2, p3;
+    uint8_t flag;
+} navWaypoint_t;
+
+typedef struct {
+    navWaypointHeadings_e mode;
+    uint32_t heading;
+    fpVector3_t poi_pos;
+} navWapointHeading_t;
+
+typedef struct radar_pois_s {
+    gpsLocation_t gps;
+    uint8_t state;
+    uint16_t heading;
+    uint16_t speed;
+    uint8_t lq;
+    uint16_t distance;
+    int16_t altitude;
+    int16_t direction;
+} radar_pois_t;
+
+#define RADAR_MAX_POIS 5
+
+extern radar_pois_t radar_pois[5];
+
+typedef struct {
+    fpVector3_t pos;
+    int32_t yaw;
+} navWaypointPosition_t;
+
+typedef struct navDestinationPath_s {
+    uint32_t distance;
+    int32_t bearing;
+} navDestinationPath_t;
+
+typedef struct {
+    float kP;
+    float kI;
+    float kD;
+    float kT;
+    float kFF;
+} pidControllerParam_t;
+
+typedef struct {
+    float kP;
+} pControllerParam_t;
+
+typedef struct {
+    
+# 309 "./src/main/navigation/navigation.h" 3 4
+   _Bool 
+# 309 "./src/main/navigation/navigation.h"
+        reset;
+    pidControllerParam_t param;
+    pt1Filter_t dterm_filter_state;
+    float dTermLpfHz;
+    float integrator;
+    float last_input;
+
+    float integral;
+    float proportional;
+    float derivative;
+    float feedForward;
+    float output_constrained;
+} pidController_t;
+
+typedef struct navigationPIDControllers_s {
+
+    pidController_t pos[3];
+    pidController_t vel[3];
+    pidController_t surface;
+
+
+    pidController_t fw_alt;
+    pidController_t fw_nav;
+    pidController_t fw_heading;
+} navigationPIDControllers_t;
+
+
+typedef enum {
+    MW_GPS_MODE_NONE = 0,
+    MW_GPS_MODE_HOLD,
+    MW_GPS_MODE_RTH,
+    MW_GPS_MODE_NAV,
+    MW_GPS_MODE_EMERG = 15
+} navSystemStatus_Mode_e;
+
+typedef enum {
+    MW_NAV_STATE_NONE = 0,
+    MW_NAV_STATE_RTH_START,
+    MW_NAV_STATE_RTH_ENROUTE,
+    MW_NAV_STATE_HOLD_INFINIT,
+    MW_NAV_STATE_HOLD_TIMED,
+    MW_NAV_STATE_WP_ENROUTE,
+    MW_NAV_STATE_PROCESS_NEXT,
+    MW_NAV_STATE_DO_JUMP,
+    MW_NAV_STATE_LAND_START,
+    MW_NAV_STATE_LAND_IN_PROGRESS,
+    MW_NAV_STATE_LANDED,
+    MW_NAV_STATE_LAND_SETTLE,
+    MW_NAV_STATE_LAND_START_DESCENT,
+    MW_NAV_STATE_HOVER_ABOVE_HOME,
+    MW_NAV_STATE_EMERGENCY_LANDING,
+} navSystemStatus_State_e;
+
+typedef enum {
+    MW_NAV_ERROR_NONE = 0,
+    MW_NAV_ERROR_TOOFAR,
+    MW_NAV_ERROR_SPOILED_GPS,
+    MW_NAV_ERROR_WP_CRC,
+    MW_NAV_ERROR_FINISH,
+    MW_NAV_ERROR_TIMEWAIT,
+    MW_NAV_ERROR_INVALID_JUMP,
+    MW_NAV_ERROR_INVALID_DATA,
+    MW_NAV_ERROR_WAIT_FOR_RTH_ALT,
+    MW_NAV_ERROR_GPS_FIX_LOST,
+    MW_NAV_ERROR_DISARMED,
+    MW_NAV_ERROR_LANDING
+} navSystemStatus_Error_e;
+
+typedef enum {
+    MW_NAV_FLAG_ADJUSTING_POSITION = 1 << 0,
+    MW_NAV_FLAG_ADJUSTING_ALTITUDE = 1 << 1,
+} navSystemStatus_Flags_e;
+
+typedef struct {
+    navSystemStatus_Mode_e mode;
+    navSystemStatus_State_e state;
+    navSystemStatus_Error_e error;
+    navSystemStatus_Flags_e flags;
+    uint8_t activeWpNumber;
+    navWaypointActions_e activeWpAction;
+} navSystemStatus_t;
+
+void navigationUsePIDs(void);
+void navigationInit(void);
+
+
+void updatePositionEstimator_BaroTopic(timeUs_t currentTimeUs);
+void updatePositionEstimator_OpticalFlowTopic(timeUs_t currentTimeUs);
+void updatePositionEstimator_SurfaceTopic(timeUs_t currentTimeUs, float newSurfaceAlt);
+void updatePositionEstimator_PitotTopic(timeUs_t currentTimeUs);
+
+
+void updateWaypointsAndNavigationMode(void);
+void updatePositionEstimator(void);
+void applyWaypointNavigationAndAltitudeHold(void);
+
+
+
+# 406 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 406 "./src/main/navigation/navigation.h"
+    navigationRequiresAngleMode(void);
+
+# 407 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 407 "./src/main/navigation/navigation.h"
+    navigationRequiresThrottleTiltCompensation(void);
+
+# 408 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 408 "./src/main/navigation/navigation.h"
+    navigationRequiresTurnAssistance(void);
+int8_t navigationGetHeadingControlState(void);
+
+
+
+navArmingBlocker_e navigationIsBlockingArming(
+# 413 "./src/main/navigation/navigation.h" 3 4
+                                             _Bool 
+# 413 "./src/main/navigation/navigation.h"
+                                                  *usedBypass);
+
+# 414 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 414 "./src/main/navigation/navigation.h"
+    navigationPositionEstimateIsHealthy(void);
+
+# 415 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 415 "./src/main/navigation/navigation.h"
+    navIsCalibrationComplete(void);
+
+# 416 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 416 "./src/main/navigation/navigation.h"
+    navigationTerrainFollowingEnabled(void);
+
+
+typedef struct {
+    uint8_t altStatus;
+    uint8_t posStatus;
+    uint8_t velStatus;
+    uint8_t aglStatus;
+    fpVector3_t pos;
+    fpVector3_t vel;
+    float agl;
+} navPositionAndVelocity_t;
+
+float getEstimatedActualVelocity(int axis);
+float getEstimatedActualPosition(int axis);
+uint32_t getTotalTravelDistance(void);
+void getEstimatedPositionAndVelocity(navPositionAndVelocity_t * pos);
+
+
+int getWaypointCount(void);
+
+# 436 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 436 "./src/main/navigation/navigation.h"
+    isWaypointListValid(void);
+void getWaypoint(uint8_t wpNumber, navWaypoint_t * wpData);
+void setWaypoint(uint8_t wpNumber, const navWaypoint_t * wpData);
+void resetWaypointList(void);
+
+# 440 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 440 "./src/main/navigation/navigation.h"
+    loadNonVolatileWaypointList(void);
+
+# 441 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 441 "./src/main/navigation/navigation.h"
+    saveNonVolatileWaypointList(void);
+
+float getFinalRTHAltitude(void);
+int16_t fixedWingPitchToThrottleCorrection(int16_t pitch);
+
+
+typedef enum {
+    GEO_ALT_ABSOLUTE,
+    GEO_ALT_RELATIVE
+} geoAltitudeConversionMode_e;
+
+typedef enum {
+    GEO_ORIGIN_SET,
+    GEO_ORIGIN_RESET_ALTITUDE
+} geoOriginResetMode_e;
+
+
+
+
+
+void geoSetOrigin(gpsOrigin_t *origin, const gpsLocation_t *llh, geoOriginResetMode_e resetMode);
+
+
+
+
+
+
+
+# 468 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 468 "./src/main/navigation/navigation.h"
+    geoConvertGeodeticToLocal(fpVector3_t *pos, const gpsOrigin_t *origin, const gpsLocation_t *llh, geoAltitudeConversionMode_e altConv);
+
+
+
+# 471 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 471 "./src/main/navigation/navigation.h"
+    geoConvertGeodeticToLocalOrigin(fpVector3_t * pos, const gpsLocation_t *llh, geoAltitudeConversionMode_e altConv);
+
+
+
+
+# 475 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 475 "./src/main/navigation/navigation.h"
+    geoConvertLocalToGeodetic(gpsLocation_t *llh, const gpsOrigin_t *origin, const fpVector3_t *pos);
+float geoCalculateMagDeclination(const gpsLocation_t * llh);
+
+
+
+# 479 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 479 "./src/main/navigation/navigation.h"
+    navCalculatePathToDestination(navDestinationPath_t *result, const fpVector3_t * destinationPos);
+
+
+void activateForcedRTH(void);
+void abortForcedRTH(void);
+rthState_e getStateOfForcedRTH(void);
+
+
+
+# 487 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 487 "./src/main/navigation/navigation.h"
+    navigationIsControllingThrottle(void);
+
+# 488 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 488 "./src/main/navigation/navigation.h"
+    isFixedWingAutoThrottleManuallyIncreased(void);
+
+# 489 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 489 "./src/main/navigation/navigation.h"
+    navigationIsFlyingAutonomousMode(void);
+
+# 490 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 490 "./src/main/navigation/navigation.h"
+    navigationIsExecutingAnEmergencyLanding(void);
+
+
+
+
+# 494 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 494 "./src/main/navigation/navigation.h"
+    navigationRTHAllowsLanding(void);
+
+
+# 496 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 496 "./src/main/navigation/navigation.h"
+    isNavLaunchEnabled(void);
+
+# 497 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 497 "./src/main/navigation/navigation.h"
+    isFixedWingLaunchDetected(void);
+
+# 498 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 498 "./src/main/navigation/navigation.h"
+    isFixedWingLaunchFinishedOrAborted(void);
+
+float calculateAverageSpeed(void);
+
+const navigationPIDControllers_t* getNavigationPIDControllers(void);
+
+int32_t navigationGetHeadingError(void);
+int32_t getCruiseHeadingAdjustment(void);
+
+# 506 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 506 "./src/main/navigation/navigation.h"
+    isAdjustingPosition(void);
+
+# 507 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 507 "./src/main/navigation/navigation.h"
+    isAdjustingHeading(void);
+
+
+
+
+
+int32_t navigationGetHomeHeading(void);
+
+
+extern navSystemStatus_t NAV_Status;
+
+extern int16_t navCurrentState;
+extern int16_t navActualVelocity[3];
+extern int16_t navDesiredVelocity[3];
+extern int32_t navTargetPosition[3];
+extern int32_t navLatestActualPosition[3];
+extern int16_t navActualSurface;
+extern uint16_t navFlags;
+extern uint16_t navEPH;
+extern uint16_t navEPV;
+extern int16_t navAccNEU[3];
+# 67 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 18 "./src/main/rx/rx.h"
+       
+
+
+
+
+
+
+
+#define STICK_CHANNEL_COUNT 4
+
+#define PWM_RANGE_MIN 1000
+#define PWM_RANGE_MAX 2000
+#define PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))
+
+#define PWM_PULSE_MIN 750
+#define PWM_PULSE_MAX 2250
+
+#define MIDRC_MIN 1200
+#define MIDRC_MAX 1700
+
+#define RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)
+#define CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)
+#define MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)
+
+#define DEFAULT_SERVO_MIN 1000
+#define DEFAULT_SERVO_MIDDLE 1500
+#define DEFAULT_SERVO_MAX 2000
+
+#define DELAY_50_HZ (1000000 / 50)
+#define DELAY_10_HZ (1000000 / 10)
+#define DELAY_5_HZ (1000000 / 5)
+
+#define RSSI_MAX_VALUE 1023
+
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3),
+} rxFrameState_e;
+
+typedef enum {
+    RX_TYPE_NONE = 0,
+    RX_TYPE_PPM = 1,
+    RX_TYPE_SERIAL = 2,
+    RX_TYPE_MSP = 3,
+    RX_TYPE_SPI = 4,
+    RX_TYPE_UIB = 5
+} rxReceiverType_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_FPORT = 10,
+    SERIALRX_SBUS_FAST = 11,
+} rxSerialReceiverType_e;
+
+#define MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16
+#define MAX_SUPPORTED_RC_CHANNEL_COUNT 18
+
+#define NON_AUX_CHANNEL_COUNT 4
+#define MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)
+
+extern const char rcChannelLetters[];
+
+#define MAX_MAPPABLE_RX_INPUTS 4
+
+#define MAX_INVALID_RX_PULSE_TIME 300
+
+#define RSSI_VISIBLE_VALUE_MIN 0
+#define RSSI_VISIBLE_VALUE_MAX 100
+#define RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxConfig_s {
+    uint8_t receiverType;
+    uint8_t rcmap[4];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    uint8_t rx_spi_protocol;
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssiMin;
+    uint8_t rssiMax;
+    uint16_t sbusSyncInterval;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t rcFilterFrequency;
+    uint16_t mspOverrideChannels;
+    uint8_t rssi_source;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+
+#define REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))
+
+typedef struct rxRuntimeConfig_s rxRuntimeConfig_t;
+typedef uint16_t (*rcReadRawDataFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(rxRuntimeConfig_t *rxRuntimeConfig);
+typedef 
+# 137 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 137 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+typedef uint16_t (*rcGetLinkQualityPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+
+typedef struct rxLinkQualityTracker_s {
+    timeMs_t lastUpdatedMs;
+    uint32_t lqAccumulator;
+    uint32_t lqCount;
+    uint32_t lqValue;
+} rxLinkQualityTracker_e;
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    timeUs_t rxRefreshRate;
+    timeUs_t rxSignalTimeout;
+    
+# 151 "./src/main/rx/rx.h" 3 4
+   _Bool 
+# 151 "./src/main/rx/rx.h"
+        requireFiltering;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    rxLinkQualityTracker_e * lqTracker;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef struct rcChannel_s {
+    int16_t raw;
+    int16_t data;
+    timeMs_t expiresAt;
+} rcChannel_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_AUTO,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+} rssiSource_e;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void lqTrackerReset(rxLinkQualityTracker_e * lqTracker);
+void lqTrackerAccumulate(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+void lqTrackerSet(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+uint16_t lqTrackerGet(rxLinkQualityTracker_e * lqTracker);
+
+void rxInit(void);
+void rxUpdateRSSISource(void);
+
+# 184 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 184 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime);
+
+# 185 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 185 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 186 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 186 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 187 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 187 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+# 188 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 188 "./src/main/rx/rx.h"
+    isRxPulseValid(uint16_t pulseDuration);
+
+uint8_t calculateChannelRemapping(const uint8_t *channelMap, uint8_t channelMapEntryCount, uint8_t channelToRemap);
+void parseRcChannels(const char *input);
+
+void setRSSIFromMSP(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+
+uint16_t getRSSI(void);
+rssiSource_e getRSSISource(void);
+
+void resetAllRxChannelRangeConfigurations(void);
+
+void suspendRxSignal(void);
+void resumeRxSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+
+
+
+
+
+int16_t rxGetChannelValue(unsigned channelNumber);
+
+
+
+int16_t rxGetRawChannelValue(unsigned channelNumber);
+# 69 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/rx/msp_override.h" 1
+# 18 "./src/main/rx/msp_override.h"
+       
+
+void mspOverrideInit(void);
+
+# 21 "./src/main/rx/msp_override.h" 3 4
+_Bool 
+# 21 "./src/main/rx/msp_override.h"
+    mspOverrideUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime);
+
+# 22 "./src/main/rx/msp_override.h" 3 4
+_Bool 
+# 22 "./src/main/rx/msp_override.h"
+    mspOverrideCalculateChannels(timeUs_t currentTimeUs);
+void mspOverrideChannels(rcChannel_t *rcChannels);
+
+# 24 "./src/main/rx/msp_override.h" 3 4
+_Bool 
+# 24 "./src/main/rx/msp_override.h"
+    mspOverrideIsReceivingSignal(void);
+
+# 25 "./src/main/rx/msp_override.h" 3 4
+_Bool 
+# 25 "./src/main/rx/msp_override.h"
+    mspOverrideIsInFailsafe(void);
+
+# 26 "./src/main/rx/msp_override.h" 3 4
+_Bool 
+# 26 "./src/main/rx/msp_override.h"
+    mspOverrideAreFlightChannelsValid(void);
+uint16_t mspOverrideGetRefreshRate(void);
+int16_t mspOverrideGetChannelValue(unsigned channelNumber);
+int16_t mspOverrideGetRawChannelValue(unsigned channelNumber);
+# 70 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/sensors/diagnostics.h" 1
+
+
+
+
+
+
+
+typedef enum {
+    HW_SENSOR_NONE = 0,
+    HW_SENSOR_OK = 1,
+    HW_SENSOR_UNAVAILABLE = 2,
+    HW_SENSOR_UNHEALTHY = 3,
+} hardwareSensorStatus_e;
+
+
+
+#define HW_SENSOR_IS_HEALTHY(status) (status == HW_SENSOR_NONE || status == HW_SENSOR_OK)
+
+hardwareSensorStatus_e getHwGyroStatus(void);
+hardwareSensorStatus_e getHwAccelerometerStatus(void);
+hardwareSensorStatus_e getHwCompassStatus(void);
+hardwareSensorStatus_e getHwBarometerStatus(void);
+hardwareSensorStatus_e getHwGPSStatus(void);
+hardwareSensorStatus_e getHwRangefinderStatus(void);
+hardwareSensorStatus_e getHwPitotmeterStatus(void);
+hardwareSensorStatus_e getHwOpticalFlowStatus(void);
+
+
+# 28 "./src/main/sensors/diagnostics.h" 3 4
+_Bool 
+# 28 "./src/main/sensors/diagnostics.h"
+    isHardwareHealthy(void);
+# 72 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/acceleration.h" 1
+# 18 "./src/main/sensors/acceleration.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/sensors/sensors.h" 1
+# 18 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_PITOT,
+    SENSOR_INDEX_OPFLOW,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+#define CALIBRATING_BARO_TIME_MS 2000
+#define CALIBRATING_PITOT_TIME_MS 2000
+#define CALIBRATING_GYRO_TIME_MS 2000
+#define CALIBRATING_ACC_TIME_MS 500
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_PITOT = 1 << 5,
+    SENSOR_OPFLOW = 1 << 6,
+    SENSOR_GPS = 1 << 7,
+    SENSOR_GPSMAG = 1 << 8,
+    SENSOR_TEMP = 1 << 9
+} sensors_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+# 26 "./src/main/sensors/acceleration.h" 2
+
+#define GRAVITY_CMSS 980.665f
+#define GRAVITY_MSS 9.80665f
+
+#define ACC_CLIPPING_THRESHOLD_G 7.9f
+#define ACC_VIBE_FLOOR_FILT_HZ 5.0f
+#define ACC_VIBE_FILT_HZ 2.0f
+
+
+typedef enum {
+    ACC_NONE = 0,
+    ACC_AUTODETECT = 1,
+    ACC_ADXL345 = 2,
+    ACC_MPU6050 = 3,
+    ACC_MMA8452 = 4,
+    ACC_BMA280 = 5,
+    ACC_LSM303DLHC = 6,
+    ACC_MPU6000 = 7,
+    ACC_MPU6500 = 8,
+    ACC_MPU9250 = 9,
+    ACC_BMI160 = 10,
+    ACC_ICM20689 = 11,
+    ACC_FAKE = 12,
+    ACC_MAX = ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct {
+    float min;
+    float max;
+} acc_extremes_t;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accTargetLooptime;
+    float accADCf[3];
+    float accVibeSq[3];
+    uint32_t accClipCount;
+    
+# 63 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 63 "./src/main/sensors/acceleration.h"
+        isClipped;
+    acc_extremes_t extremes[3];
+    float maxG;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct accelerometerConfig_s {
+    sensor_align_e acc_align;
+    uint8_t acc_hardware;
+    uint16_t acc_lpf_hz;
+    flightDynamicsTrims_t accZero;
+    flightDynamicsTrims_t accGain;
+    uint8_t acc_notch_hz;
+    uint8_t acc_notch_cutoff;
+    uint8_t acc_soft_lpf_type;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+# 83 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 83 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t accTargetLooptime);
+
+# 84 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 84 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accStartCalibration(void);
+void accGetMeasuredAcceleration(fpVector3_t *measuredAcc);
+const acc_extremes_t* accGetMeasuredExtremes(void);
+float accGetMeasuredMaxG(void);
+void updateAccExtremes(void);
+void accGetVibrationLevels(fpVector3_t *accVibeLevels);
+float accGetVibrationLevel(void);
+uint32_t accGetClipCount(void);
+
+# 93 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 93 "./src/main/sensors/acceleration.h"
+    accIsClipped(void);
+void accUpdate(void);
+void accSetCalibrationValues(void);
+void accInitFilters(void);
+
+# 97 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 97 "./src/main/sensors/acceleration.h"
+    accIsHealthy(void);
+
+# 98 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 98 "./src/main/sensors/acceleration.h"
+    accGetCalibrationAxisStatus(int axis);
+uint8_t accGetCalibrationAxisFlags(void);
+# 73 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 18 "./src/main/sensors/barometer.h"
+       
+
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 18 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+typedef 
+# 23 "./src/main/drivers/barometer/barometer.h" 3 4
+       _Bool 
+# 23 "./src/main/drivers/barometer/barometer.h"
+            (*baroOpFuncPtr)(struct baroDev_s * baro);
+typedef 
+# 24 "./src/main/drivers/barometer/barometer.h" 3 4
+       _Bool 
+# 24 "./src/main/drivers/barometer/barometer.h"
+            (*baroCalculateFuncPtr)(struct baroDev_s * baro, int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t * busDev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 23 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_NONE = 0,
+    BARO_AUTODETECT = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_MS5607 = 5,
+    BARO_LPS25H = 6,
+    BARO_SPL06 = 7,
+    BARO_BMP388 = 8,
+    BARO_DPS310 = 9,
+    BARO_FAKE = 10,
+    BARO_MAX = BARO_FAKE
+} baroSensor_e;
+
+typedef struct barometerConfig_s {
+    uint8_t baro_hardware;
+    uint8_t use_median_filtering;
+    uint16_t baro_calibration_tolerance;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+
+# 56 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 56 "./src/main/sensors/barometer.h"
+    baroInit(void);
+
+# 57 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 57 "./src/main/sensors/barometer.h"
+    baroIsCalibrationComplete(void);
+void baroStartCalibration(void);
+uint32_t baroUpdate(void);
+int32_t baroCalculateAltitude(void);
+int32_t baroGetLatestAltitude(void);
+int16_t baroGetTemperature(void);
+
+# 63 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 63 "./src/main/sensors/barometer.h"
+    baroIsHealthy(void);
+# 74 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 18 "./src/main/sensors/battery.h"
+       
+
+
+
+
+
+#define VBAT_SCALE_DEFAULT 1100
+
+#define VBAT_SCALE_MIN 0
+#define VBAT_SCALE_MAX 65535
+
+
+#define CURRENT_METER_SCALE 400
+
+
+
+#define CURRENT_METER_OFFSET 0
+
+
+
+#define MAX_BATTERY_PROFILE_COUNT 3
+
+
+typedef enum {
+    CURRENT_SENSOR_NONE = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_VIRTUAL,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MAX = CURRENT_SENSOR_VIRTUAL
+} currentSensor_e;
+
+typedef enum {
+    VOLTAGE_SENSOR_NONE = 0,
+    VOLTAGE_SENSOR_ADC,
+    VOLTAGE_SENSOR_ESC
+} voltageSensor_e;
+
+typedef enum {
+    BAT_CAPACITY_UNIT_MAH,
+    BAT_CAPACITY_UNIT_MWH,
+} batCapacityUnit_e;
+
+typedef struct {
+  uint8_t profile_index;
+  uint16_t max_voltage;
+} profile_comp_t;
+
+typedef enum {
+    BAT_VOLTAGE_RAW,
+    BAT_VOLTAGE_SAG_COMP
+} batVoltageSource_e;
+
+typedef struct batteryMetersConfig_s {
+
+    struct {
+        uint16_t scale;
+        voltageSensor_e type;
+    } voltage;
+
+    struct {
+        int16_t scale;
+        int16_t offset;
+        currentSensor_e type;
+    } current;
+
+    batVoltageSource_e voltageSource;
+
+    uint32_t cruise_power;
+    uint16_t idle_power;
+    uint8_t rth_energy_margin;
+
+    float throttle_compensation_weight;
+
+} batteryMetersConfig_t;
+
+typedef struct batteryProfile_s {
+
+    uint8_t cells;
+
+    struct {
+        uint16_t cellDetect;
+        uint16_t cellMax;
+        uint16_t cellMin;
+        uint16_t cellWarning;
+    } voltage;
+
+    struct {
+        uint32_t value;
+        uint32_t warning;
+        uint32_t critical;
+        batCapacityUnit_e unit;
+    } capacity;
+
+} batteryProfile_t;
+
+extern batteryMetersConfig_t batteryMetersConfig_System; extern batteryMetersConfig_t batteryMetersConfig_Copy; static inline const batteryMetersConfig_t* batteryMetersConfig(void) { return &batteryMetersConfig_System; } static inline batteryMetersConfig_t* batteryMetersConfigMutable(void) { return &batteryMetersConfig_System; } struct _dummy;
+extern batteryProfile_t batteryProfiles_SystemArray[3]; extern batteryProfile_t batteryProfiles_CopyArray[3]; static inline const batteryProfile_t* batteryProfiles(int _index) { return &batteryProfiles_SystemArray[_index]; } static inline batteryProfile_t* batteryProfilesMutable(int _index) { return &batteryProfiles_SystemArray[_index]; } static inline batteryProfile_t (* batteryProfiles_array(void))[3] { return &batteryProfiles_SystemArray; } struct _dummy;
+
+extern const batteryProfile_t *currentBatteryProfile;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT
+} batteryState_e;
+
+
+uint16_t batteryAdcToVoltage(uint16_t src);
+batteryState_e getBatteryState(void);
+
+# 128 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 128 "./src/main/sensors/battery.h"
+    batteryWasFullWhenPluggedIn(void);
+
+# 129 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/battery.h"
+    batteryUsesCapacityThresholds(void);
+void batteryInit(void);
+void setBatteryProfile(uint8_t profileIndex);
+void activateBatteryProfile(void);
+void batteryDisableProfileAutoswitch(void);
+
+
+# 135 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 135 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+
+# 136 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 136 "./src/main/sensors/battery.h"
+    isPowerSupplyImpedanceValid(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getBatteryRawVoltage(void);
+uint16_t getBatterySagCompensatedVoltage(void);
+uint16_t getBatteryWarningVoltage(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryRawAverageCellVoltage(void);
+uint16_t getBatteryAverageCellVoltage(void);
+uint16_t getBatterySagCompensatedAverageCellVoltage(void);
+uint32_t getBatteryRemainingCapacity(void);
+uint16_t getPowerSupplyImpedance(void);
+
+
+# 148 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 148 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int16_t getAmperage(void);
+int32_t getPower(void);
+int32_t getMAhDrawn(void);
+int32_t getMWhDrawn(void);
+
+void batteryUpdate(timeUs_t timeDelta);
+void currentMeterUpdate(timeUs_t timeDelta);
+void sagCompensatedVBatUpdate(timeUs_t currentTime, timeUs_t timeDelta);
+void powerMeterUpdate(timeUs_t timeDelta);
+
+uint8_t calculateBatteryPercentage(void);
+float calculateThrottleCompensationFactor(void);
+int32_t calculateAveragePower(void);
+int32_t calculateAverageEfficiency(void);
+int32_t heatLossesCompensatedPower(int32_t power);
+# 75 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 18 "./src/main/sensors/compass.h"
+       
+# 31 "./src/main/sensors/compass.h"
+typedef enum {
+    MAG_NONE = 0,
+    MAG_AUTODETECT = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_GPS = 4,
+    MAG_MAG3110 = 5,
+    MAG_AK8963 = 6,
+    MAG_IST8310 = 7,
+    MAG_QMC5883 = 8,
+    MAG_MPU9250 = 9,
+    MAG_IST8308 = 10,
+    MAG_LIS3MDL = 11,
+    MAG_FAKE = 12,
+    MAG_MAX = MAG_FAKE
+} magSensor_e;
+
+typedef struct mag_s {
+    magDev_t dev;
+    int32_t magADC[3];
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    flightDynamicsTrims_t magZero;
+    uint8_t mag_to_use;
+    uint8_t magCalibrationTimeLimit;
+    int16_t rollDeciDegrees;
+    int16_t pitchDeciDegrees;
+    int16_t yawDeciDegrees;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 70 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 70 "./src/main/sensors/compass.h"
+    compassDetect(magDev_t *dev, magSensor_e magHardwareToUse);
+
+# 71 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 71 "./src/main/sensors/compass.h"
+    compassInit(void);
+void compassUpdate(timeUs_t currentTimeUs);
+
+# 73 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 73 "./src/main/sensors/compass.h"
+    compassIsReady(void);
+
+# 74 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 74 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+# 76 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/gyro.h" 1
+# 18 "./src/main/sensors/gyro.h"
+       
+# 27 "./src/main/sensors/gyro.h"
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_AUTODETECT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_BMI160,
+    GYRO_ICM20689,
+    GYRO_FAKE
+} gyroSensor_e;
+
+typedef enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW
+} dynamicFilterRange_e;
+
+typedef enum {
+    DYN_NOTCH_ANALYSER_FFT = 0,
+    DYN_NOTCH_ANALYSER_SDFT
+} dynamicFilterAnalyser_e;
+
+#define DYN_NOTCH_RANGE_HZ_HIGH 2000
+#define DYN_NOTCH_RANGE_HZ_MEDIUM 1333
+#define DYN_NOTCH_RANGE_HZ_LOW 1000
+
+#define GYRO_PID_PROCESS_DENOM_MAX 8
+
+typedef struct gyro_s {
+    
+# 60 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 60 "./src/main/sensors/gyro.h"
+        initialized;
+    uint32_t targetLooptime;
+    uint32_t sampleLooptime;
+    uint8_t pidProcessDenom;
+    
+# 64 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 64 "./src/main/sensors/gyro.h"
+        sampleBufferActive;
+    timeUs_t lastSampleTimeUs;
+    timeDelta_t sampleDeltaTimeUs;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+typedef struct gyroConfig_s {
+    sensor_align_e gyro_align;
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyroSync;
+    uint16_t looptime;
+    uint8_t pidProcessDenom;
+    uint8_t gyro_lpf;
+    uint8_t gyro_soft_lpf_hz;
+    uint8_t gyro_soft_lpf_type;
+    uint8_t gyro_to_use;
+    uint16_t gyro_notch_hz;
+    uint16_t gyro_notch_cutoff;
+    uint16_t gyro_stage2_lowpass_hz;
+    uint8_t gyro_stage2_lowpass_type;
+    uint8_t dynamicGyroNotchRange;
+    uint16_t dynamicGyroNotchQ;
+    uint16_t dynamicGyroNotchMinHz;
+    uint8_t dynamicGyroNotchEnabled;
+    uint8_t dynamicGyroNotchAnalyser;
+    uint8_t dynamicGyroNotchCount;
+    uint16_t kalman_q;
+    uint16_t kalman_w;
+    uint16_t kalman_sharpness;
+    uint8_t kalmanEnabled;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+typedef enum {
+    GYRO_STAGE_RAW = 0,
+    GYRO_STAGE_RPM_FILTER,
+    GYRO_STAGE_LPF2,
+    GYRO_STAGE_LPF,
+    GYRO_STAGE_NOTCH,
+    GYRO_STAGE_DYN_NOTCH,
+    GYRO_STAGE_KALMAN,
+    GYRO_STAGE_COUNT
+} gyroFilterStage_e;
+
+
+
+void gyroStageProbe(gyroFilterStage_e stage, int axis, float value);
+#define GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)
+#define GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)
+
+
+
+
+
+
+# 121 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 121 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+void gyroGetMeasuredRotationRate(fpVector3_t *imuMeasuredRotationBF);
+void gyroUpdate(void);
+void gyroStartCalibration(void);
+
+# 125 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 125 "./src/main/sensors/gyro.h"
+    gyroIsCalibrationComplete(void);
+
+# 126 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 126 "./src/main/sensors/gyro.h"
+    gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 129 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/gyro.h"
+    gyroSyncCheckUpdate(void);
+void gyroSyncDisable(void);
+uint32_t gyroGetSampleBufferOverflowCount(void);
+# 77 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/pitotmeter.h" 1
+# 18 "./src/main/sensors/pitotmeter.h"
+       
+
+
+
+# 1 "./src/main/common/calibration.h" 1
+# 25 "./src/main/common/calibration.h"
+       
+# 35 "./src/main/common/calibration.h"
+typedef enum {
+    ZERO_CALIBRATION_NONE = 0,
+    ZERO_CALIBRATION_IN_PROGRESS,
+    ZERO_CALIBRATION_DONE,
+    ZERO_CALIBRATION_FAIL,
+} zeroCalibrationState_e;
+
+typedef struct {
+    zeroCalibrationState_e state;
+    timeMs_t startTimeMs;
+    timeMs_t windowSizeMs;
+    
+# 46 "./src/main/common/calibration.h" 3 4
+   _Bool 
+# 46 "./src/main/common/calibration.h"
+                           allowFailure;
+    unsigned sampleCount;
+    float stdDevThreshold;
+} zeroCalibrationParams_t;
+
+typedef struct {
+    float accumulatedValue;
+    stdev_t stdDev;
+} zeroCalibrationValue_t;
+
+typedef struct {
+    zeroCalibrationParams_t params;
+    zeroCalibrationValue_t val;
+} zeroCalibrationScalar_t;
+
+typedef struct {
+    zeroCalibrationParams_t params;
+    zeroCalibrationValue_t val[3];
+} zeroCalibrationVector_t;
+
+void zeroCalibrationStartS(zeroCalibrationScalar_t * s, timeMs_t window, float threshold, 
+# 66 "./src/main/common/calibration.h" 3 4
+                                                                                         _Bool 
+# 66 "./src/main/common/calibration.h"
+                                                                                              allowFailure);
+
+# 67 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 67 "./src/main/common/calibration.h"
+    zeroCalibrationIsCompleteS(zeroCalibrationScalar_t * s);
+
+# 68 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 68 "./src/main/common/calibration.h"
+    zeroCalibrationIsSuccessfulS(zeroCalibrationScalar_t * s);
+void zeroCalibrationAddValueS(zeroCalibrationScalar_t * s, const float v);
+void zeroCalibrationGetZeroS(zeroCalibrationScalar_t * s, float * v);
+
+void zeroCalibrationStartV(zeroCalibrationVector_t * s, timeMs_t window, float threshold, 
+# 72 "./src/main/common/calibration.h" 3 4
+                                                                                         _Bool 
+# 72 "./src/main/common/calibration.h"
+                                                                                              allowFailure);
+
+# 73 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 73 "./src/main/common/calibration.h"
+    zeroCalibrationIsCompleteV(zeroCalibrationVector_t * s);
+
+# 74 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 74 "./src/main/common/calibration.h"
+    zeroCalibrationIsSuccessfulV(zeroCalibrationVector_t * s);
+void zeroCalibrationAddValueV(zeroCalibrationVector_t * s, const fpVector3_t * v);
+void zeroCalibrationGetZeroV(zeroCalibrationVector_t * s, fpVector3_t * v);
+# 23 "./src/main/sensors/pitotmeter.h" 2
+
+# 1 "./src/main/drivers/pitotmeter.h" 1
+# 18 "./src/main/drivers/pitotmeter.h"
+       
+
+
+struct pitotDev_s;
+
+typedef 
+# 23 "./src/main/drivers/pitotmeter.h" 3 4
+       _Bool 
+# 23 "./src/main/drivers/pitotmeter.h"
+            (*pitotOpFuncPtr)(struct pitotDev_s * pitot);
+typedef void (*pitotCalculateFuncPtr)(struct pitotDev_s * pitot, float *pressure, float *temperature);
+
+typedef struct pitotDev_s {
+    busDevice_t * busDev;
+    uint16_t delay;
+    pitotOpFuncPtr start;
+    pitotOpFuncPtr get;
+    pitotCalculateFuncPtr calculate;
+} pitotDev_t;
+# 25 "./src/main/sensors/pitotmeter.h" 2
+
+typedef enum {
+    PITOT_NONE = 0,
+    PITOT_AUTODETECT = 1,
+    PITOT_MS4525 = 2,
+    PITOT_ADC = 3,
+    PITOT_VIRTUAL = 4,
+    PITOT_FAKE = 5,
+} pitotSensor_e;
+
+#define PITOT_MAX PITOT_FAKE
+#define PITOT_SAMPLE_COUNT_MAX 48
+
+typedef struct pitotmeterConfig_s {
+    uint8_t pitot_hardware;
+    uint16_t pitot_lpf_milli_hz;
+    float pitot_scale;
+} pitotmeterConfig_t;
+
+extern pitotmeterConfig_t pitotmeterConfig_System; extern pitotmeterConfig_t pitotmeterConfig_Copy; static inline const pitotmeterConfig_t* pitotmeterConfig(void) { return &pitotmeterConfig_System; } static inline pitotmeterConfig_t* pitotmeterConfigMutable(void) { return &pitotmeterConfig_System; } struct _dummy;
+
+typedef struct pito_s {
+    pitotDev_t dev;
+    float airSpeed;
+
+    zeroCalibrationScalar_t zeroCalibration;
+    pt1Filter_t lpfState;
+    timeUs_t lastMeasurementUs;
+    timeMs_t lastSeenHealthyMs;
+
+    float pressureZero;
+    float pressure;
+} pitot_t;
+
+
+
+#define AIR_DENSITY_SEA_LEVEL_15C 1.225f
+#define P0 101325.0f
+
+extern pitot_t pitot;
+
+
+# 66 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/pitotmeter.h"
+    pitotInit(void);
+
+# 67 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 67 "./src/main/sensors/pitotmeter.h"
+    pitotIsCalibrationComplete(void);
+void pitotStartCalibration(void);
+void pitotUpdate(void);
+int32_t pitotCalculateAirSpeed(void);
+
+# 71 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 71 "./src/main/sensors/pitotmeter.h"
+    pitotIsHealthy(void);
+# 78 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/rangefinder.h" 1
+# 18 "./src/main/sensors/rangefinder.h"
+       
+
+
+
+# 1 "./src/main/drivers/rangefinder/rangefinder.h" 1
+# 18 "./src/main/drivers/rangefinder/rangefinder.h"
+       
+
+
+# 1 "./src/main/drivers/io.h" 1
+# 18 "./src/main/drivers/io.h"
+       
+# 34 "./src/main/drivers/io.h"
+#define IO_TAG(pinid) DEFIO_TAG(pinid)
+# 73 "./src/main/drivers/io.h"
+#define IOCFG_OUT_PP 0
+#define IOCFG_OUT_OD 0
+#define IOCFG_AF_PP 0
+#define IOCFG_AF_OD 0
+#define IOCFG_IPD 0
+#define IOCFG_IPU 0
+#define IOCFG_IN_FLOATING 0
+
+
+
+
+
+
+# 1 "./src/main/drivers/io_def.h" 1
+       
+
+
+
+
+
+#define DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)
+#define DEFIO_TAG__NONE 0
+#define DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)
+#define DEFIO_TAG_E__NONE 0
+
+
+
+
+
+#define DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)
+#define DEFIO_REC__NONE NULL
+
+#define DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)
+
+
+
+#define DEFIO_REC_INDEXED(idx) (ioRecs + (idx))
+
+
+#define DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))
+#define DEFIO_TAG_ISEMPTY(tag) (!(tag))
+#define DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)
+#define DEFIO_TAG_PIN(tag) ((tag) & 0x0f)
+
+
+
+
+# 1 "./src/main/drivers/io_def_generated.h" 1
+       
+
+
+
+
+
+
+
+#define DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA
+#define DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_A_OFFSET (0)
+
+
+#define DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB
+#define DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)
+
+
+#define DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC
+#define DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_D_USED_MASK 0
+#define DEFIO_PORT_D_USED_COUNT 0
+
+#define DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_E_USED_MASK 0
+#define DEFIO_PORT_E_USED_COUNT 0
+
+#define DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_F_USED_MASK 0
+#define DEFIO_PORT_F_USED_COUNT 0
+
+#define DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_G_USED_MASK 0
+#define DEFIO_PORT_G_USED_COUNT 0
+
+#define DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)
+
+
+
+
+#define DEFIO_GPIOID__A 0
+#define DEFIO_GPIOID__B 1
+#define DEFIO_GPIOID__C 2
+#define DEFIO_GPIOID__D 3
+#define DEFIO_GPIOID__E 4
+#define DEFIO_GPIOID__F 5
+#define DEFIO_GPIOID__G 6
+
+
+
+
+
+#define DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+# 522 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET
+
+
+
+#define DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)
+# 1121 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_PORT_USED_COUNT 3
+#define DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK
+#define DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET
+# 35 "./src/main/drivers/io_def.h" 2
+# 87 "./src/main/drivers/io.h" 2
+
+
+# 88 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 88 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 89 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 89 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, resourceType_e resource, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+resourceType_e IOGetResources(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 22 "./src/main/drivers/rangefinder/rangefinder.h" 2
+
+
+#define RANGEFINDER_OUT_OF_RANGE (-1)
+#define RANGEFINDER_HARDWARE_FAILURE (-2)
+#define RANGEFINDER_NO_NEW_DATA (-3)
+
+struct rangefinderDev_s;
+
+typedef struct rangefinderHardwarePins_s {
+    ioTag_t triggerTag;
+    ioTag_t echoTag;
+} rangefinderHardwarePins_t;
+
+struct rangefinderDev_s;
+
+typedef void (*rangefinderOpInitFuncPtr)(struct rangefinderDev_s * dev);
+typedef void (*rangefinderOpStartFuncPtr)(struct rangefinderDev_s * dev);
+typedef int32_t (*rangefinderOpReadFuncPtr)(struct rangefinderDev_s * dev);
+
+typedef struct rangefinderDev_s {
+    busDevice_t * busDev;
+
+    timeMs_t delayMs;
+    int16_t maxRangeCm;
+
+
+    int16_t detectionConeDeciDegrees;
+    int16_t detectionConeExtendedDeciDegrees;
+
+
+    rangefinderOpInitFuncPtr init;
+    rangefinderOpStartFuncPtr update;
+    rangefinderOpReadFuncPtr read;
+} rangefinderDev_t;
+# 23 "./src/main/sensors/rangefinder.h" 2
+
+typedef enum {
+    RANGEFINDER_NONE = 0,
+    RANGEFINDER_HCSR04 = 1,
+    RANGEFINDER_SRF10 = 2,
+    RANGEFINDER_HCSR04I2C = 3,
+    RANGEFINDER_VL53L0X = 4,
+    RANGEFINDER_MSP = 5,
+    RANGEFINDER_UIB = 6,
+    RANGEFINDER_BENEWAKE = 7,
+} rangefinderType_e;
+
+typedef struct rangefinderConfig_s {
+    uint8_t rangefinder_hardware;
+    uint8_t use_median_filtering;
+} rangefinderConfig_t;
+
+extern rangefinderConfig_t rangefinderConfig_System; extern rangefinderConfig_t rangefinderConfig_Copy; static inline const rangefinderConfig_t* rangefinderConfig(void) { return &rangefinderConfig_System; } static inline rangefinderConfig_t* rangefinderConfigMutable(void) { return &rangefinderConfig_System; } struct _dummy;
+
+typedef struct rangefinder_s {
+    rangefinderDev_t dev;
+    float maxTiltCos;
+    int32_t rawAltitude;
+    int32_t calculatedAltitude;
+    timeMs_t lastValidResponseTimeMs;
+} rangefinder_t;
+
+extern rangefinder_t rangefinder;
+
+const rangefinderHardwarePins_t * rangefinderGetHardwarePins(void);
+
+
+# 54 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 54 "./src/main/sensors/rangefinder.h"
+    rangefinderInit(void);
+
+int32_t rangefinderGetLatestAltitude(void);
+int32_t rangefinderGetLatestRawAltitude(void);
+
+timeDelta_t rangefinderUpdate(void);
+
+# 60 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 60 "./src/main/sensors/rangefinder.h"
+    rangefinderProcess(float cosTiltAngle);
+
+# 61 "./src/main/sensors/rangefinder.h" 3 4
+_Bool 
+# 61 "./src/main/sensors/rangefinder.h"
+    rangefinderIsHealthy(void);
+# 79 "./src/main/blackbox/blackbox.c" 2
+
+# 1 "./src/main/sensors/esc_sensor.h" 1
+# 25 "./src/main/sensors/esc_sensor.h"
+       
+
+typedef struct {
+    uint8_t dataAge;
+    int8_t temperature;
+    int16_t voltage;
+    int32_t current;
+    uint32_t rpm;
+} escSensorData_t;
+
+typedef struct escSensorConfig_s {
+    uint16_t currentOffset;
+    uint8_t listenOnly;
+} escSensorConfig_t;
+
+extern escSensorConfig_t escSensorConfig_System; extern escSensorConfig_t escSensorConfig_Copy; static inline const escSensorConfig_t* escSensorConfig(void) { return &escSensorConfig_System; } static inline escSensorConfig_t* escSensorConfigMutable(void) { return &escSensorConfig_System; } struct _dummy;
+
+#define ESC_DATA_MAX_AGE 10
+#define ESC_DATA_INVALID 255
+#define ERPM_PER_LSB 100.0f
+
+
+# 46 "./src/main/sensors/esc_sensor.h" 3 4
+_Bool 
+# 46 "./src/main/sensors/esc_sensor.h"
+    escSensorInitialize(void);
+void escSensorUpdate(timeUs_t currentTimeUs);
+escSensorData_t * escSensorGetData(void);
+escSensorData_t * getEscTelemetry(uint8_t esc);
+uint32_t computeRpm(int16_t erpm);
+# 81 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/flight/wind_estimator.h" 1
+# 18 "./src/main/flight/wind_estimator.h"
+       
+# 28 "./src/main/flight/wind_estimator.h"
+
+# 28 "./src/main/flight/wind_estimator.h" 3 4
+_Bool 
+# 28 "./src/main/flight/wind_estimator.h"
+    isEstimatedWindSpeedValid(void);
+
+float getEstimatedWindSpeed(int axis);
+
+
+float getEstimatedHorizontalWindSpeed(uint16_t *angle);
+
+void updateWindEstimator(timeUs_t currentTimeUs);
+# 82 "./src/main/blackbox/blackbox.c" 2
+# 1 "./src/main/sensors/temperature.h" 1
+# 18 "./src/main/sensors/temperature.h"
+       
+
+
+
+#define TEMPERATURE_LABEL_LEN 4
+#define MAX_TEMP_SENSORS 8
+
+#define TEMPERATURE_INVALID_VALUE -1250
+
+typedef enum {
+    TEMP_SENSOR_NONE = 0,
+    TEMP_SENSOR_LM75,
+    TEMP_SENSOR_DS18B20
+} tempSensorType_e;
+
+typedef struct {
+    tempSensorType_e type;
+    uint64_t address;
+    int16_t alarm_min;
+    int16_t alarm_max;
+    uint8_t osdSymbol;
+    char label[4];
+} tempSensorConfig_t;
+
+extern tempSensorConfig_t tempSensorConfig_SystemArray[8]; extern tempSensorConfig_t tempSensorConfig_CopyArray[8]; static inline const tempSensorConfig_t* tempSensorConfig(int _index) { return &tempSensorConfig_SystemArray[_index]; } static inline tempSensorConfig_t* tempSensorConfigMutable(int _index) { return &tempSensorConfig_SystemArray[_index]; } static inline tempSensorConfig_t (* tempSensorConfig_array(void))[8] { return &tempSensorConfig_SystemArray; } struct _dummy;
+
+
+
+# 45 "./src/main/sensors/temperature.h" 3 4
+_Bool 
+# 45 "./src/main/sensors/temperature.h"
+    getIMUTemperature(int16_t *temperature);
+
+# 46 "./src/main/sensors/temperature.h" 3 4
+_Bool 
+# 46 "./src/main/sensors/temperature.h"
+    getBaroTemperature(int16_t *temperature);
+void temperatureUpdate(void);
+# 58 "./src/main/sensors/temperature.h"
+void resetTempSensorConfig(void);
+# 83 "./src/main/blackbox/blackbox.c" 2
+
+
+
+
+
+
+
+#define DEFAULT_BLACKBOX_DEVICE BLACKBOX_DEVICE_SERIAL
+
+
+
+
+
+#define BLACKBOX_INTERVED_CARD_DETECTION 0
+
+
+extern const blackboxConfig_t pgResetTemplate_blackboxConfig; blackboxConfig_t blackboxConfig_System; blackboxConfig_t blackboxConfig_Copy; extern const pgRegistry_t blackboxConfig_Registry; const pgRegistry_t blackboxConfig_Registry __attribute__ ((section("pg_registry"), used, aligned(4))) = { .pgn = 5 | (2 << 12), .size = sizeof(blackboxConfig_t) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&blackboxConfig_System, .copy = (uint8_t*)&blackboxConfig_Copy, .ptr = 0, .reset = {.ptr = (void*)&pgResetTemplate_blackboxConfig}, };
+
+const blackboxConfig_t pgResetTemplate_blackboxConfig __attribute__ ((section("pg_resetdata"), used, aligned(2))) = { .device = BLACKBOX_DEVICE_SERIAL, .rate_num = 1, .rate_denom = 1, .invertedCardDetection = 0, .compression = FLIGHT_LOG_COMPRESSION_NONE, }
+
+
+
+
+
+ ;
+
+#define BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200
+static const int32_t blackboxSInterval = 4096;
+
+
+
+#define PREDICT(x) CONCAT(FLIGHT_LOG_FIELD_PREDICTOR_, x)
+#define ENCODING(x) CONCAT(FLIGHT_LOG_FIELD_ENCODING_, x)
+#define CONDITION(x) CONCAT(FLIGHT_LOG_FIELD_CONDITION_, x)
+#define UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED
+#define SIGNED FLIGHT_LOG_FIELD_SIGNED
+
+static const char blackboxHeader[] =
+    "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+    "H Data version:2\n";
+
+static const char* const blackboxFieldHeaderNames[] = {
+    "name",
+    "signed",
+    "predictor",
+    "encoding",
+    "predictor",
+    "encoding"
+};
+
+
+typedef struct blackboxFieldDefinition_s {
+    const char *name;
+
+    int8_t fieldNameIndex;
+
+
+    uint8_t arr[1];
+} blackboxFieldDefinition_t;
+
+#define BLACKBOX_DELTA_FIELD_HEADER_COUNT ARRAYLEN(blackboxFieldHeaderNames)
+#define BLACKBOX_SIMPLE_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
+#define BLACKBOX_CONDITIONAL_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)
+
+typedef struct blackboxSimpleFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t predict;
+    uint8_t encode;
+} blackboxSimpleFieldDefinition_t;
+
+typedef struct blackboxConditionalFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t predict;
+    uint8_t encode;
+    uint8_t condition;
+} blackboxConditionalFieldDefinition_t;
+
+typedef struct blackboxDeltaFieldDefinition_s {
+    const char *name;
+    int8_t fieldNameIndex;
+
+    uint8_t isSigned;
+    uint8_t Ipredict;
+    uint8_t Iencode;
+    uint8_t Ppredict;
+    uint8_t Pencode;
+    uint8_t condition;
+} blackboxDeltaFieldDefinition_t;
+
+
+
+
+
+
+
+static const blackboxDeltaFieldDefinition_t blackboxMainFields[] = {
+
+    {"loopIteration",-1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_INC, .Pencode = FLIGHT_LOG_FIELD_ENCODING_NULL, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"time", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisRate", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisRate", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisRate", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisP", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"axisI", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisI", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisI", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"axisD", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0},
+    {"axisD", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1},
+    {"axisD", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2},
+
+    {"fwAltP", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwAltI", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwAltD", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwAltOut", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwPosP", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwPosI", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwPosD", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+    {"fwPosOut", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV},
+
+    {"mcPosAxisP", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcPosAxisP", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcPosAxisP", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisP", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisP", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisP", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisI", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisI", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisI", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisD", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisD", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisD", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisFF", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisFF", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisFF", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisOut",0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisOut",1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcVelAxisOut",2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcSurfaceP", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcSurfaceI", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcSurfaceD", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+    {"mcSurfaceOut",-1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_MC_NAV},
+
+
+    {"rcData", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcData", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcData", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcData", 3, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"rcCommand", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcCommand", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"rcCommand", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"rcCommand", 3, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+    {"vbat", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_VBATREF, .Iencode = FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_VBAT},
+    {"amperage", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_AMPERAGE},
+
+
+    {"magADC", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+    {"magADC", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+    {"magADC", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_MAG},
+
+
+    {"BaroAlt", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_BARO},
+
+
+    {"AirSpeed", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_PITOT},
+
+
+
+
+    {"rssi", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB, FLIGHT_LOG_FIELD_CONDITION_RSSI},
+
+
+    {"gyroADC", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"gyroADC", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"gyroADC", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"accSmooth", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"accSmooth", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"accSmooth", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"attitude", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"attitude", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"attitude", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"debug", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 3, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 4, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 5, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 6, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+    {"debug", 7, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_DEBUG},
+
+    {"motor", 0, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE, .Iencode = FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1},
+
+    {"motor", 1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2},
+    {"motor", 2, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3},
+    {"motor", 3, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4},
+    {"motor", 4, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5},
+    {"motor", 5, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6},
+    {"motor", 6, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7},
+    {"motor", 7, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8},
+
+
+    {"servo", 0, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 2, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 3, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 4, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 5, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 6, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 7, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 8, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 9, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 10, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 11, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 12, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 13, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 14, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+    {"servo", 15, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_1500, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_SERVOS},
+
+
+    {"navState", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navFlags", -1, FLIGHT_LOG_FIELD_UNSIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navEPH", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navEPV", -1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navPos", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navPos", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navPos", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navVel", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navVel", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navVel", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navAcc", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navAcc", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navAcc", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtVel", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtVel", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtVel", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtPos", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtPos", 1, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navTgtPos", 2, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"navSurf", 0, FLIGHT_LOG_FIELD_SIGNED, .Ipredict = FLIGHT_LOG_FIELD_PREDICTOR_0, .Iencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, .Ppredict = FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS, .Pencode = FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+
+};
+
+
+
+static const blackboxConditionalFieldDefinition_t blackboxGpsGFields[] = {
+    {"time", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME},
+    {"GPS_fixType", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_numSat", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_coord", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_coord", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_altitude", -1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_speed", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_ground_course", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_hdop", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_eph", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_epv", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_velned", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_velned", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS},
+    {"GPS_velned", 2, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB, FLIGHT_LOG_FIELD_CONDITION_ALWAYS}
+};
+
+
+static const blackboxSimpleFieldDefinition_t blackboxGpsHFields[] = {
+    {"GPS_home", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+    {"GPS_home", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB}
+};
+
+
+
+static const blackboxSimpleFieldDefinition_t blackboxSlowFields[] = {
+    {"flightModeFlags", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+    {"stateFlags", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+
+    {"failsafePhase", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32},
+    {"rxSignalReceived", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32},
+    {"rxFlightChannelsValid", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32},
+
+    {"hwHealthStatus", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+    {"powerSupplyImpedance", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+    {"sagCompensatedVBat", -1, FLIGHT_LOG_FIELD_UNSIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB},
+    {"wind", 0, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+    {"wind", 1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+    {"wind", 2, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+
+
+
+    {"IMUTemperature", -1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+
+    {"baroTemperature", -1, FLIGHT_LOG_FIELD_SIGNED, FLIGHT_LOG_FIELD_PREDICTOR_0, FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB},
+# 399 "./src/main/blackbox/blackbox.c"
+};
+
+typedef enum BlackboxState {
+    BLACKBOX_STATE_DISABLED = 0,
+    BLACKBOX_STATE_STOPPED,
+    BLACKBOX_STATE_PREPARE_LOG_FILE,
+    BLACKBOX_STATE_SEND_HEADER,
+    BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER,
+    BLACKBOX_STATE_SEND_GPS_H_HEADER,
+    BLACKBOX_STATE_SEND_GPS_G_HEADER,
+    BLACKBOX_STATE_SEND_SLOW_HEADER,
+    BLACKBOX_STATE_SEND_SYSINFO,
+    BLACKBOX_STATE_PAUSED,
+    BLACKBOX_STATE_RUNNING,
+    BLACKBOX_STATE_SHUTTING_DOWN
+} BlackboxState;
+
+#define BLACKBOX_FIRST_HEADER_SENDING_STATE BLACKBOX_STATE_SEND_HEADER
+#define BLACKBOX_LAST_HEADER_SENDING_STATE BLACKBOX_STATE_SEND_SYSINFO
+
+typedef struct blackboxMainState_s {
+    uint32_t time;
+
+    int32_t axisPID_P[3];
+    int32_t axisPID_I[3];
+    int32_t axisPID_D[3];
+    int32_t axisPID_Setpoint[3];
+
+    int32_t mcPosAxisP[3];
+    int32_t mcVelAxisPID[4][3];
+    int32_t mcVelAxisOutput[3];
+
+    int32_t mcSurfacePID[3];
+    int32_t mcSurfacePIDOutput;
+
+    int32_t fwAltPID[3];
+    int32_t fwAltPIDOutput;
+    int32_t fwPosPID[3];
+    int32_t fwPosPIDOutput;
+
+    int16_t rcData[4];
+    int16_t rcCommand[4];
+    int16_t gyroADC[3];
+    int16_t accADC[3];
+    int16_t attitude[3];
+    int32_t debug[8];
+    int16_t motor[12];
+    int16_t servo[16];
+
+    uint16_t vbat;
+    int16_t amperage;
+
+
+    int32_t BaroAlt;
+
+
+    int32_t airSpeed;
+
+
+    int16_t magADC[3];
+
+
+
+
+    uint16_t rssi;
+
+    int16_t navState;
+    uint16_t navFlags;
+    uint16_t navEPH;
+    uint16_t navEPV;
+    int32_t navPos[3];
+    int16_t navRealVel[3];
+    int16_t navAccNEU[3];
+    int16_t navTargetVel[3];
+    int32_t navTargetPos[3];
+    int16_t navHeading;
+    int16_t navTargetHeading;
+    int16_t navSurface;
+
+} blackboxMainState_t;
+
+typedef struct blackboxGpsState_s {
+    int32_t GPS_home[2];
+    int32_t GPS_coord[2];
+    uint8_t GPS_numSat;
+} blackboxGpsState_t;
+
+
+typedef struct blackboxSlowState_s {
+    uint32_t flightModeFlags;
+    uint32_t stateFlags;
+    uint8_t failsafePhase;
+    
+# 491 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 491 "./src/main/blackbox/blackbox.c"
+        rxSignalReceived;
+    
+# 492 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 492 "./src/main/blackbox/blackbox.c"
+        rxFlightChannelsValid;
+    int32_t hwHealthStatus;
+    uint16_t powerSupplyImpedance;
+    uint16_t sagCompensatedVBat;
+    int16_t wind[3];
+
+
+
+    int16_t imuTemperature;
+
+    int16_t baroTemperature;
+# 511 "./src/main/blackbox/blackbox.c"
+} __attribute__((__packed__)) blackboxSlowState_t;
+
+
+extern boxBitmask_t rcModeActivationMask;
+
+static BlackboxState blackboxState = BLACKBOX_STATE_DISABLED;
+
+static uint32_t blackboxLastArmingBeep = 0;
+static uint32_t blackboxLastFlightModeFlags = 0;
+
+static struct {
+    uint32_t headerIndex;
+
+
+
+
+    union {
+        int fieldIndex;
+        uint32_t startTime;
+    } u;
+} xmitState;
+
+
+static uint32_t blackboxConditionCache;
+
+typedef char assert_failed_too_many_flight_log_conditions [((sizeof(blackboxConditionCache) * 8) >= FLIGHT_LOG_FIELD_CONDITION_LAST) ? 1 : -1 ] __attribute__((unused));
+
+static uint32_t blackboxIFrameInterval;
+static uint32_t blackboxIteration;
+static uint16_t blackboxPFrameIndex;
+static uint16_t blackboxIFrameIndex;
+static 
+# 542 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 542 "./src/main/blackbox/blackbox.c"
+           blackboxLoggedAnyFrames;
+
+
+static uint32_t blackboxLoggedIteration;
+static uint32_t blackboxSlowFrameIteration;
+
+
+
+
+
+
+static uint16_t vbatReference;
+
+static blackboxGpsState_t gpsHistory;
+static blackboxSlowState_t slowHistory;
+
+
+
+
+
+
+
+#define BLACKBOX_SNAPSHOT_RING_SIZE 8
+#define BLACKBOX_SNAPSHOT_HISTORY_SLOTS 2
+
+typedef enum {
+    BLACKBOX_SNAPSHOT_INTRAFRAME = 1 << 0,
+    BLACKBOX_SNAPSHOT_RESUME = 1 << 1,
+    BLACKBOX_SNAPSHOT_SLOW_FRAME = 1 << 2,
+    BLACKBOX_SNAPSHOT_GPS_HOME = 1 << 3,
+} blackboxSnapshotFlags_e;
+
+typedef struct blackboxSnapshot_s {
+    blackboxMainState_t state;
+    uint32_t iteration;
+    uint8_t flags;
+} blackboxSnapshot_t;
+
+static blackboxSnapshot_t blackboxSnapshotRing[8];
+static volatile uint8_t blackboxSnapshotHead;
+static volatile uint8_t blackboxSnapshotTail;
+static uint8_t blackboxSnapshotPendingFlags;
+static uint32_t blackboxSnapshotsDropped;
+
+typedef char assert_failed_blackbox_snapshot_ring_size_not_power_of_two [((8 & (8 - 1)) == 0) ? 1 : -1 ] __attribute__((unused));
+
+static void blackboxLogQueuedSnapshots(void);
+
+
+static blackboxMainState_t* blackboxHistory[3];
+
+static 
+# 593 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 593 "./src/main/blackbox/blackbox.c"
+           blackboxModeActivationConditionPresent = 
+# 593 "./src/main/blackbox/blackbox.c" 3 4
+                                                    0
+# 593 "./src/main/blackbox/blackbox.c"
+                                                         ;
+
+
+
+
+uint32_t blackboxGetSnapshotsDropped(void)
+{
+    return blackboxSnapshotsDropped;
+}
+
+
+
+
+
+# 606 "./src/main/blackbox/blackbox.c" 3 4
+_Bool 
+# 606 "./src/main/blackbox/blackbox.c"
+    blackboxMayEditConfig(void)
+{
+    return blackboxState <= BLACKBOX_STATE_STOPPED;
+}
+
+static 
+# 611 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 611 "./src/main/blackbox/blackbox.c"
+           blackboxIsOnlyLoggingIntraframes(void)
+{
+    return blackboxConfig()->rate_num == 1 && blackboxConfig()->rate_denom == blackboxIFrameInterval;
+}
+
+static 
+# 616 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 616 "./src/main/blackbox/blackbox.c"
+           testBlackboxConditionUncached(FlightLogFieldCondition condition)
+{
+    switch (condition) {
+    case FLIGHT_LOG_FIELD_CONDITION_ALWAYS:
+        return 
+# 620 "./src/main/blackbox/blackbox.c" 3 4
+              1
+# 620 "./src/main/blackbox/blackbox.c"
+                  ;
+
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7:
+    case FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8:
+        return getMotorCount() >= condition - FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1 + 1;
+
+    case FLIGHT_LOG_FIELD_CONDITION_SERVOS:
+        return isMixerUsingServos();
+
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1:
+    case FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2:
+
+        return pidBank()->pid[condition - FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0].D != 0 || pidBank()->pid[condition - FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0].FF != 0;
+
+    case FLIGHT_LOG_FIELD_CONDITION_MAG:
+
+        return sensors(SENSOR_MAG);
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_BARO:
+
+        return sensors(SENSOR_BARO);
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_PITOT:
+
+        return sensors(SENSOR_PITOT);
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_VBAT:
+        return feature(FEATURE_VBAT);
+
+    case FLIGHT_LOG_FIELD_CONDITION_AMPERAGE:
+        return feature(FEATURE_CURRENT_METER) && batteryMetersConfig()->current.type == CURRENT_SENSOR_ADC;
+
+    case FLIGHT_LOG_FIELD_CONDITION_SURFACE:
+
+
+
+        return 
+# 672 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 672 "./src/main/blackbox/blackbox.c"
+                   ;
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV:
+
+        return (stateFlags & (FIXED_WING_LEGACY));
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_MC_NAV:
+
+        return !(stateFlags & (FIXED_WING_LEGACY));
+
+
+
+
+    case FLIGHT_LOG_FIELD_CONDITION_RSSI:
+
+
+        return getRSSISource() != RSSI_SOURCE_NONE;
+
+    case FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME:
+        return blackboxConfig()->rate_num < blackboxConfig()->rate_denom;
+
+    case FLIGHT_LOG_FIELD_CONDITION_DEBUG:
+        return debugMode != DEBUG_NONE;
+
+    case FLIGHT_LOG_FIELD_CONDITION_NEVER:
+        return 
+# 701 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 701 "./src/main/blackbox/blackbox.c"
+                   ;
+
+    default:
+        return 
+# 704 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 704 "./src/main/blackbox/blackbox.c"
+                   ;
+    }
+}
+
+static void blackboxBuildConditionCache(void)
+{
+    blackboxConditionCache = 0;
+    for (FlightLogFieldCondition cond = FLIGHT_LOG_FIELD_CONDITION_FIRST; cond <= FLIGHT_LOG_FIELD_CONDITION_LAST; cond++) {
+        if (testBlackboxConditionUncached(cond)) {
+            blackboxConditionCache |= 1 << cond;
+        }
+    }
+}
+
+static 
+# 718 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 718 "./src/main/blackbox/blackbox.c"
+           testBlackboxCondition(FlightLogFieldCondition condition)
+{
+    return (blackboxConditionCache & (1 << condition)) != 0;
+}
+
+static void blackboxSetState(BlackboxState newState)
+{
+
+    switch (newState) {
+    case BLACKBOX_STATE_PREPARE_LOG_FILE:
+        blackboxLoggedAnyFrames = 
+# 728 "./src/main/blackbox/blackbox.c" 3 4
+                                 0
+# 728 "./src/main/blackbox/blackbox.c"
+                                      ;
+        break;
+    case BLACKBOX_STATE_SEND_HEADER:
+        blackboxHeaderBudget = 0;
+        xmitState.headerIndex = 0;
+        xmitState.u.startTime = millis();
+        break;
+    case BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER:
+    case BLACKBOX_STATE_SEND_GPS_G_HEADER:
+    case BLACKBOX_STATE_SEND_GPS_H_HEADER:
+    case BLACKBOX_STATE_SEND_SLOW_HEADER:
+        xmitState.headerIndex = 0;
+        xmitState.u.fieldIndex = -1;
+        break;
+    case BLACKBOX_STATE_SEND_SYSINFO:
+        xmitState.headerIndex = 0;
+        break;
+    case BLACKBOX_STATE_RUNNING:
+        blackboxSnapshotPendingFlags |= BLACKBOX_SNAPSHOT_SLOW_FRAME;
+        break;
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+        xmitState.u.startTime = millis();
+        break;
+    default:
+        ;
+    }
+    blackboxState = newState;
+}
+
+static void writeIntraframe(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+
+    blackboxWrite('I');
+
+    blackboxWriteUnsignedVB(blackboxLoggedIteration);
+    blackboxWriteUnsignedVB(blackboxCurrent->time);
+
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_Setpoint, 3);
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_P, 3);
+    blackboxWriteSignedVBArray(blackboxCurrent->axisPID_I, 3);
+
+
+    for (int x = 0; x < 3; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x]);
+        }
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->fwAltPID, 3);
+        blackboxWriteSignedVB(blackboxCurrent->fwAltPIDOutput);
+        blackboxWriteSignedVBArray(blackboxCurrent->fwPosPID, 3);
+        blackboxWriteSignedVB(blackboxCurrent->fwPosPIDOutput);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MC_NAV)) {
+
+        blackboxWriteSignedVBArray(blackboxCurrent->mcPosAxisP, 3);
+
+        for (int i = 0; i < 4; i++) {
+            blackboxWriteSignedVBArray(blackboxCurrent->mcVelAxisPID[i], 3);
+        }
+
+        blackboxWriteSignedVBArray(blackboxCurrent->mcVelAxisOutput, 3);
+
+        blackboxWriteSignedVBArray(blackboxCurrent->mcSurfacePID, 3);
+        blackboxWriteSignedVB(blackboxCurrent->mcSurfacePIDOutput);
+    }
+
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->rcData, 4);
+
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->rcCommand, 3);
+
+
+
+
+
+    blackboxWriteUnsignedVB(blackboxCurrent->rcCommand[THROTTLE] - getThrottleIdleValue());
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+
+
+
+
+
+
+        blackboxWriteUnsignedVB((vbatReference - blackboxCurrent->vbat) & 0x3FFF);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE)) {
+
+        blackboxWriteSignedVB(blackboxCurrent->amperage);
+    }
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+        blackboxWriteSigned16VBArray(blackboxCurrent->magADC, 3);
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+        blackboxWriteSignedVB(blackboxCurrent->BaroAlt);
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_PITOT)) {
+        blackboxWriteSignedVB(blackboxCurrent->airSpeed);
+    }
+# 849 "./src/main/blackbox/blackbox.c"
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+        blackboxWriteUnsignedVB(blackboxCurrent->rssi);
+    }
+
+    blackboxWriteSigned16VBArray(blackboxCurrent->gyroADC, 3);
+    blackboxWriteSigned16VBArray(blackboxCurrent->accADC, 3);
+    blackboxWriteSigned16VBArray(blackboxCurrent->attitude, 3);
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+        blackboxWriteSignedVBArray(blackboxCurrent->debug, 8);
+    }
+
+
+    blackboxWriteUnsignedVB(blackboxCurrent->motor[0] - getThrottleIdleValue());
+
+
+    const int motorCount = getMotorCount();
+    for (int x = 1; x < motorCount; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->motor[x] - blackboxCurrent->motor[0]);
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_SERVOS)) {
+        for (int x = 0; x < 16; x++) {
+
+            blackboxWriteSignedVB(blackboxCurrent->servo[x] - 1500);
+        }
+    }
+
+
+    blackboxWriteSignedVB(blackboxCurrent->navState);
+
+    blackboxWriteSignedVB(blackboxCurrent->navFlags);
+    blackboxWriteSignedVB(blackboxCurrent->navEPH);
+    blackboxWriteSignedVB(blackboxCurrent->navEPV);
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navPos[x]);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navRealVel[x]);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navAccNEU[x]);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navTargetVel[x]);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navTargetPos[x]);
+    }
+
+    blackboxWriteSignedVB(blackboxCurrent->navSurface);
+
+
+
+
+
+    blackboxHistory[1] = blackboxHistory[0];
+
+    blackboxHistory[2] = blackboxHistory[0];
+
+    blackboxLoggedAnyFrames = 
+# 914 "./src/main/blackbox/blackbox.c" 3 4
+                             1
+# 914 "./src/main/blackbox/blackbox.c"
+                                 ;
+}
+
+static void blackboxWriteArrayUsingAveragePredictor16(int arrOffsetInHistory, int count)
+{
+    int16_t *curr = (int16_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
+    int16_t *prev1 = (int16_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
+    int16_t *prev2 = (int16_t*) ((char*) (blackboxHistory[2]) + arrOffsetInHistory);
+
+    for (int i = 0; i < count; i++) {
+
+        int32_t predictor = (prev1[i] + prev2[i]) / 2;
+
+        blackboxWriteSignedVB(curr[i] - predictor);
+    }
+}
+
+static void blackboxWriteArrayUsingAveragePredictor32(int arrOffsetInHistory, int count)
+{
+    int32_t *curr = (int32_t*) ((char*) (blackboxHistory[0]) + arrOffsetInHistory);
+    int32_t *prev1 = (int32_t*) ((char*) (blackboxHistory[1]) + arrOffsetInHistory);
+    int32_t *prev2 = (int32_t*) ((char*) (blackboxHistory[2]) + arrOffsetInHistory);
+
+    for (int i = 0; i < count; i++) {
+
+        int32_t predictor = ((int64_t)prev1[i] + (int64_t)prev2[i]) / 2;
+
+        blackboxWriteSignedVB(curr[i] - predictor);
+    }
+}
+
+static void writeInterframe(void)
+{
+    blackboxMainState_t *blackboxCurrent = blackboxHistory[0];
+    blackboxMainState_t *blackboxLast = blackboxHistory[1];
+
+    const uint32_t frameStart = blackboxWriteBufferPosition();
+
+    blackboxWrite('P');
+
+
+
+
+
+
+
+    blackboxWriteSignedVB((int32_t) (blackboxHistory[0]->time - 2 * blackboxHistory[1]->time + blackboxHistory[2]->time));
+
+    int32_t deltas[8];
+    arraySubInt32(deltas, blackboxCurrent->axisPID_Setpoint, blackboxLast->axisPID_Setpoint, 3);
+    blackboxWriteSignedVBArray(deltas, 3);
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_P, blackboxLast->axisPID_P, 3);
+    blackboxWriteSignedVBArray(deltas, 3);
+
+
+
+
+
+    arraySubInt32(deltas, blackboxCurrent->axisPID_I, blackboxLast->axisPID_I, 3);
+    blackboxWriteTag2_3S32(deltas);
+
+
+
+
+
+    for (int x = 0; x < 3; x++) {
+        if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0 + x)) {
+            blackboxWriteSignedVB(blackboxCurrent->axisPID_D[x] - blackboxLast->axisPID_D[x]);
+        }
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV)) {
+
+        arraySubInt32(deltas, blackboxCurrent->fwAltPID, blackboxLast->fwAltPID, 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+
+        blackboxWriteSignedVB(blackboxCurrent->fwAltPIDOutput - blackboxLast->fwAltPIDOutput);
+
+        arraySubInt32(deltas, blackboxCurrent->fwPosPID, blackboxLast->fwPosPID, 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+
+        blackboxWriteSignedVB(blackboxCurrent->fwPosPIDOutput - blackboxLast->fwPosPIDOutput);
+
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MC_NAV)) {
+        arraySubInt32(deltas, blackboxCurrent->mcPosAxisP, blackboxLast->mcPosAxisP, 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+
+        for (int i = 0; i < 4; i++) {
+            arraySubInt32(deltas, blackboxCurrent->mcVelAxisPID[i], blackboxLast->mcVelAxisPID[i], 3);
+            blackboxWriteSignedVBArray(deltas, 3);
+        }
+
+        arraySubInt32(deltas, blackboxCurrent->mcVelAxisOutput, blackboxLast->mcVelAxisOutput, 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+
+        arraySubInt32(deltas, blackboxCurrent->mcSurfacePID, blackboxLast->mcSurfacePID, 3);
+        blackboxWriteSignedVBArray(deltas, 3);
+
+        blackboxWriteSignedVB(blackboxCurrent->mcSurfacePIDOutput - blackboxLast->mcSurfacePIDOutput);
+    }
+
+
+
+
+
+
+
+    for (int x = 0; x < 4; x++) {
+        deltas[x] = blackboxCurrent->rcData[x] - blackboxLast->rcData[x];
+    }
+
+    blackboxWriteTag8_4S16(deltas);
+
+
+    for (int x = 0; x < 4; x++) {
+        deltas[x] = blackboxCurrent->rcCommand[x] - blackboxLast->rcCommand[x];
+    }
+
+    blackboxWriteTag8_4S16(deltas);
+
+
+    int optionalFieldCount = 0;
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->vbat - blackboxLast->vbat;
+    }
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_AMPERAGE)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->amperage - blackboxLast->amperage;
+    }
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_MAG)) {
+        for (int x = 0; x < 3; x++) {
+            deltas[optionalFieldCount++] = blackboxCurrent->magADC[x] - blackboxLast->magADC[x];
+        }
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_BARO)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->BaroAlt - blackboxLast->BaroAlt;
+    }
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_PITOT)) {
+        deltas[optionalFieldCount++] = blackboxCurrent->airSpeed - blackboxLast->airSpeed;
+    }
+# 1074 "./src/main/blackbox/blackbox.c"
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_RSSI)) {
+        deltas[optionalFieldCount++] = (int32_t) blackboxCurrent->rssi - blackboxLast->rssi;
+    }
+
+    blackboxWriteTag8_8SVB(deltas, optionalFieldCount);
+
+
+    blackboxWriteArrayUsingAveragePredictor16(
+# 1081 "./src/main/blackbox/blackbox.c" 3 4
+                                             __builtin_offsetof (
+# 1081 "./src/main/blackbox/blackbox.c"
+                                             blackboxMainState_t
+# 1081 "./src/main/blackbox/blackbox.c" 3 4
+                                             , 
+# 1081 "./src/main/blackbox/blackbox.c"
+                                             gyroADC
+# 1081 "./src/main/blackbox/blackbox.c" 3 4
+                                             )
+# 1081 "./src/main/blackbox/blackbox.c"
+                                                                                   , 3);
+    blackboxWriteArrayUsingAveragePredictor16(
+# 1082 "./src/main/blackbox/blackbox.c" 3 4
+                                             __builtin_offsetof (
+# 1082 "./src/main/blackbox/blackbox.c"
+                                             blackboxMainState_t
+# 1082 "./src/main/blackbox/blackbox.c" 3 4
+                                             , 
+# 1082 "./src/main/blackbox/blackbox.c"
+                                             accADC
+# 1082 "./src/main/blackbox/blackbox.c" 3 4
+                                             )
+# 1082 "./src/main/blackbox/blackbox.c"
+                                                                                  , 3);
+    blackboxWriteArrayUsingAveragePredictor16(
+# 1083 "./src/main/blackbox/blackbox.c" 3 4
+                                             __builtin_offsetof (
+# 1083 "./src/main/blackbox/blackbox.c"
+                                             blackboxMainState_t
+# 1083 "./src/main/blackbox/blackbox.c" 3 4
+                                             , 
+# 1083 "./src/main/blackbox/blackbox.c"
+                                             attitude
+# 1083 "./src/main/blackbox/blackbox.c" 3 4
+                                             )
+# 1083 "./src/main/blackbox/blackbox.c"
+                                                                                    , 3);
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_DEBUG)) {
+        blackboxWriteArrayUsingAveragePredictor32(
+# 1085 "./src/main/blackbox/blackbox.c" 3 4
+                                                 __builtin_offsetof (
+# 1085 "./src/main/blackbox/blackbox.c"
+                                                 blackboxMainState_t
+# 1085 "./src/main/blackbox/blackbox.c" 3 4
+                                                 , 
+# 1085 "./src/main/blackbox/blackbox.c"
+                                                 debug
+# 1085 "./src/main/blackbox/blackbox.c" 3 4
+                                                 )
+# 1085 "./src/main/blackbox/blackbox.c"
+                                                                                     , 8);
+    }
+    blackboxWriteArrayUsingAveragePredictor16(
+# 1087 "./src/main/blackbox/blackbox.c" 3 4
+                                             __builtin_offsetof (
+# 1087 "./src/main/blackbox/blackbox.c"
+                                             blackboxMainState_t
+# 1087 "./src/main/blackbox/blackbox.c" 3 4
+                                             , 
+# 1087 "./src/main/blackbox/blackbox.c"
+                                             motor
+# 1087 "./src/main/blackbox/blackbox.c" 3 4
+                                             )
+# 1087 "./src/main/blackbox/blackbox.c"
+                                                                                 , getMotorCount());
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_SERVOS)) {
+        blackboxWriteArrayUsingAveragePredictor16(
+# 1090 "./src/main/blackbox/blackbox.c" 3 4
+                                                 __builtin_offsetof (
+# 1090 "./src/main/blackbox/blackbox.c"
+                                                 blackboxMainState_t
+# 1090 "./src/main/blackbox/blackbox.c" 3 4
+                                                 , 
+# 1090 "./src/main/blackbox/blackbox.c"
+                                                 servo
+# 1090 "./src/main/blackbox/blackbox.c" 3 4
+                                                 )
+# 1090 "./src/main/blackbox/blackbox.c"
+                                                                                     , 16);
+    }
+
+
+    blackboxWriteSignedVB(blackboxCurrent->navState - blackboxLast->navState);
+
+    blackboxWriteSignedVB(blackboxCurrent->navFlags - blackboxLast->navFlags);
+    blackboxWriteSignedVB(blackboxCurrent->navEPH - blackboxLast->navEPH);
+    blackboxWriteSignedVB(blackboxCurrent->navEPV - blackboxLast->navEPV);
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxCurrent->navPos[x] - blackboxLast->navPos[x]);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxHistory[0]->navRealVel[x] - (blackboxHistory[1]->navRealVel[x] + blackboxHistory[2]->navRealVel[x]) / 2);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxHistory[0]->navAccNEU[x] - (blackboxHistory[1]->navAccNEU[x] + blackboxHistory[2]->navAccNEU[x]) / 2);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxHistory[0]->navTargetVel[x] - (blackboxHistory[1]->navTargetVel[x] + blackboxHistory[2]->navTargetVel[x]) / 2);
+    }
+
+    for (int x = 0; x < 3; x++) {
+        blackboxWriteSignedVB(blackboxHistory[0]->navTargetPos[x] - blackboxLast->navTargetPos[x]);
+    }
+
+    blackboxWriteSignedVB(blackboxCurrent->navSurface - blackboxLast->navSurface);
+
+
+    if (blackboxConfig()->compression == FLIGHT_LOG_COMPRESSION_HUFFMAN) {
+        blackboxCompressFrame(frameStart, 'C');
+    }
+
+
+    blackboxHistory[2] = blackboxHistory[1];
+    blackboxHistory[1] = blackboxHistory[0];
+
+    blackboxLoggedAnyFrames = 
+# 1131 "./src/main/blackbox/blackbox.c" 3 4
+                             1
+# 1131 "./src/main/blackbox/blackbox.c"
+                                 ;
+}
+
+
+
+static void writeSlowFrame(void)
+{
+    int32_t values[3];
+
+    blackboxWrite('S');
+
+    blackboxWriteUnsignedVB(slowHistory.flightModeFlags);
+    blackboxWriteUnsignedVB(slowHistory.stateFlags);
+
+
+
+
+    values[0] = slowHistory.failsafePhase;
+    values[1] = slowHistory.rxSignalReceived ? 1 : 0;
+    values[2] = slowHistory.rxFlightChannelsValid ? 1 : 0;
+    blackboxWriteTag2_3S32(values);
+
+    blackboxWriteUnsignedVB(slowHistory.hwHealthStatus);
+
+    blackboxWriteUnsignedVB(slowHistory.powerSupplyImpedance);
+    blackboxWriteUnsignedVB(slowHistory.sagCompensatedVBat);
+
+    blackboxWriteSigned16VBArray(slowHistory.wind, 3);
+
+
+
+
+
+    blackboxWriteSignedVB(slowHistory.imuTemperature);
+
+
+    blackboxWriteSignedVB(slowHistory.baroTemperature);
+# 1178 "./src/main/blackbox/blackbox.c"
+    blackboxSlowFrameIteration = blackboxLoggedIteration;
+}
+
+
+
+
+static void loadSlowState(blackboxSlowState_t *slow)
+{
+    memcpy(&slow->flightModeFlags, &rcModeActivationMask, sizeof(slow->flightModeFlags));
+    slow->stateFlags = stateFlags;
+    slow->failsafePhase = failsafePhase();
+    slow->rxSignalReceived = rxIsReceivingSignal();
+    slow->rxFlightChannelsValid = rxAreFlightChannelsValid();
+    slow->hwHealthStatus = (getHwGyroStatus() << 2 * 0) |
+                           (getHwAccelerometerStatus() << 2 * 1) |
+                           (getHwCompassStatus() << 2 * 2) |
+                           (getHwBarometerStatus() << 2 * 3) |
+                           (getHwGPSStatus() << 2 * 4) |
+                           (getHwRangefinderStatus() << 2 * 5) |
+                           (getHwPitotmeterStatus() << 2 * 6);
+    slow->powerSupplyImpedance = getPowerSupplyImpedance();
+    slow->sagCompensatedVBat = getBatterySagCompensatedVoltage();
+
+    for (int i = 0; i < 3; i++)
+    {
+
+        slow->wind[i] = getEstimatedWindSpeed(i);
+
+
+
+    }
+
+
+
+
+
+    
+# 1214 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 1214 "./src/main/blackbox/blackbox.c"
+        valid_temp;
+    valid_temp = getIMUTemperature(&slow->imuTemperature);
+    if (!valid_temp) slow->imuTemperature = -1250;
+
+
+    valid_temp = getBaroTemperature(&slow->baroTemperature);
+    if (!valid_temp) slow->baroTemperature = -1250;
+# 1235 "./src/main/blackbox/blackbox.c"
+}
+
+
+
+
+
+
+
+static 
+# 1243 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1243 "./src/main/blackbox/blackbox.c"
+           writeSlowFrameIfNeeded(
+# 1243 "./src/main/blackbox/blackbox.c" 3 4
+                                  _Bool 
+# 1243 "./src/main/blackbox/blackbox.c"
+                                       allowPeriodicWrite)
+{
+
+    
+# 1246 "./src/main/blackbox/blackbox.c" 3 4
+   _Bool 
+# 1246 "./src/main/blackbox/blackbox.c"
+        shouldWrite = allowPeriodicWrite && blackboxLoggedIteration - blackboxSlowFrameIteration >= (uint32_t)blackboxSInterval;
+
+    if (shouldWrite) {
+        loadSlowState(&slowHistory);
+    } else {
+        blackboxSlowState_t newSlowState;
+
+        loadSlowState(&newSlowState);
+
+
+        if (memcmp(&newSlowState, &slowHistory, sizeof(slowHistory)) != 0) {
+
+            memcpy(&slowHistory, &newSlowState, sizeof(slowHistory));
+            shouldWrite = 
+# 1259 "./src/main/blackbox/blackbox.c" 3 4
+                         1
+# 1259 "./src/main/blackbox/blackbox.c"
+                             ;
+        }
+    }
+
+    if (shouldWrite) {
+        writeSlowFrame();
+    }
+    return shouldWrite;
+}
+
+static void blackboxValidateConfig(void)
+{
+    if (blackboxConfig()->rate_num == 0 || blackboxConfig()->rate_denom == 0
+            || blackboxConfig()->rate_num >= blackboxConfig()->rate_denom) {
+        blackboxConfigMutable()->rate_num = 1;
+        blackboxConfigMutable()->rate_denom = 1;
+    } else {
+
+
+
+        const int div = gcd(blackboxConfig()->rate_num, blackboxConfig()->rate_denom);
+
+        blackboxConfigMutable()->rate_num /= div;
+        blackboxConfigMutable()->rate_denom /= div;
+    }
+
+
+    switch (blackboxConfig()->device) {
+
+
+
+
+
+
+    case BLACKBOX_DEVICE_SERIAL:
+
+        break;
+
+    default:
+        blackboxConfigMutable()->device = BLACKBOX_DEVICE_SERIAL;
+    }
+}
+
+static void blackboxResetIterationTimers(void)
+{
+    blackboxIteration = 0;
+    blackboxPFrameIndex = 0;
+    blackboxIFrameIndex = 0;
+}
+
+
+
+
+void blackboxStart(void)
+{
+    if (blackboxState != BLACKBOX_STATE_STOPPED) {
+        return;
+    }
+
+    blackboxValidateConfig();
+
+    if (!blackboxDeviceOpen()) {
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+        return;
+    }
+
+    memset(&gpsHistory, 0, sizeof(gpsHistory));
+
+    blackboxSnapshotHead = 0;
+    blackboxSnapshotTail = 0;
+    blackboxSnapshotPendingFlags = 0;
+    blackboxSnapshotsDropped = 0;
+
+    vbatReference = getBatteryRawVoltage();
+# 1341 "./src/main/blackbox/blackbox.c"
+    blackboxBuildConditionCache();
+
+    blackboxModeActivationConditionPresent = isModeActivationConditionPresent(BOXBLACKBOX);
+
+    blackboxResetIterationTimers();
+
+
+
+
+
+    blackboxLastArmingBeep = getArmingBeepTimeMicros();
+    memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags));
+
+    blackboxSetState(BLACKBOX_STATE_PREPARE_LOG_FILE);
+}
+
+
+
+
+void blackboxFinish(void)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_DISABLED:
+    case BLACKBOX_STATE_STOPPED:
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+
+        break;
+
+    case BLACKBOX_STATE_RUNNING:
+    case BLACKBOX_STATE_PAUSED:
+        blackboxLogQueuedSnapshots();
+        blackboxLogEvent(FLIGHT_LOG_EVENT_LOG_END, 
+# 1372 "./src/main/blackbox/blackbox.c" 3 4
+                                                  ((void *)0)
+# 1372 "./src/main/blackbox/blackbox.c"
+                                                      );
+        __attribute__ ((fallthrough));
+
+    default:
+        blackboxSetState(BLACKBOX_STATE_SHUTTING_DOWN);
+    }
+}
+
+
+static void writeGPSHomeFrame(void)
+{
+    blackboxWrite('H');
+
+    blackboxWriteSignedVB(GPS_home.lat);
+    blackboxWriteSignedVB(GPS_home.lon);
+
+
+    gpsHistory.GPS_home[0] = GPS_home.lat;
+    gpsHistory.GPS_home[1] = GPS_home.lon;
+}
+
+static void writeGPSFrame(timeUs_t currentTimeUs)
+{
+    blackboxWrite('G');
+
+
+
+
+
+
+
+    if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME)) {
+
+        blackboxWriteUnsignedVB(currentTimeUs - blackboxHistory[1]->time);
+    }
+
+    blackboxWriteUnsignedVB(gpsSol.fixType);
+    blackboxWriteUnsignedVB(gpsSol.numSat);
+    blackboxWriteSignedVB(gpsSol.llh.lat - gpsHistory.GPS_home[0]);
+    blackboxWriteSignedVB(gpsSol.llh.lon - gpsHistory.GPS_home[1]);
+    blackboxWriteSignedVB(gpsSol.llh.alt / 100);
+    blackboxWriteUnsignedVB(gpsSol.groundSpeed);
+    blackboxWriteUnsignedVB(gpsSol.groundCourse);
+    blackboxWriteUnsignedVB(gpsSol.hdop);
+    blackboxWriteUnsignedVB(gpsSol.eph);
+    blackboxWriteUnsignedVB(gpsSol.epv);
+    blackboxWriteSigned16VBArray(gpsSol.velNED, 3);
+
+    gpsHistory.GPS_numSat = gpsSol.numSat;
+    gpsHistory.GPS_coord[0] = gpsSol.llh.lat;
+    gpsHistory.GPS_coord[1] = gpsSol.llh.lon;
+}
+
+
+
+
+
+static void loadMainState(blackboxMainState_t *blackboxCurrent, timeUs_t currentTimeUs)
+{
+    blackboxCurrent->time = currentTimeUs;
+
+
+    const navigationPIDControllers_t *nav_pids = getNavigationPIDControllers();
+
+
+    for (int i = 0; i < 3; i++) {
+        blackboxCurrent->axisPID_Setpoint[i] = axisPID_Setpoint[i];
+        blackboxCurrent->axisPID_P[i] = axisPID_P[i];
+        blackboxCurrent->axisPID_I[i] = axisPID_I[i];
+        blackboxCurrent->axisPID_D[i] = axisPID_D[i];
+        blackboxCurrent->gyroADC[i] = lrintf(gyro.gyroADCf[i]);
+        blackboxCurrent->accADC[i] = lrintf(acc.accADCf[i] * acc.dev.acc_1G);
+
+        blackboxCurrent->magADC[i] = mag.magADC[i];
+
+
+        if (!(stateFlags & (FIXED_WING_LEGACY))) {
+
+            blackboxCurrent->mcPosAxisP[i] = lrintf(nav_pids->pos[i].output_constrained);
+
+
+            blackboxCurrent->mcVelAxisPID[0][i] = lrintf(nav_pids->vel[i].proportional);
+            blackboxCurrent->mcVelAxisPID[1][i] = lrintf(nav_pids->vel[i].integral);
+            blackboxCurrent->mcVelAxisPID[2][i] = lrintf(nav_pids->vel[i].derivative);
+            blackboxCurrent->mcVelAxisPID[3][i] = lrintf(nav_pids->vel[i].feedForward);
+            blackboxCurrent->mcVelAxisOutput[i] = lrintf(nav_pids->vel[i].output_constrained);
+        }
+
+    }
+
+
+    if ((stateFlags & (FIXED_WING_LEGACY))) {
+
+
+        blackboxCurrent->fwAltPID[0] = lrintf(nav_pids->fw_alt.proportional);
+        blackboxCurrent->fwAltPID[1] = lrintf(nav_pids->fw_alt.integral);
+        blackboxCurrent->fwAltPID[2] = lrintf(nav_pids->fw_alt.derivative);
+        blackboxCurrent->fwAltPIDOutput = lrintf(nav_pids->fw_alt.output_constrained);
+
+
+        blackboxCurrent->fwPosPID[0] = lrintf(nav_pids->fw_nav.proportional / 10);
+        blackboxCurrent->fwPosPID[1] = lrintf(nav_pids->fw_nav.integral / 10);
+        blackboxCurrent->fwPosPID[2] = lrintf(nav_pids->fw_nav.derivative / 10);
+        blackboxCurrent->fwPosPIDOutput = lrintf(nav_pids->fw_nav.output_constrained / 10);
+
+    } else {
+        blackboxCurrent->mcSurfacePID[0] = lrintf(nav_pids->surface.proportional / 10);
+        blackboxCurrent->mcSurfacePID[1] = lrintf(nav_pids->surface.integral / 10);
+        blackboxCurrent->mcSurfacePID[2] = lrintf(nav_pids->surface.derivative / 10);
+        blackboxCurrent->mcSurfacePIDOutput = lrintf(nav_pids->surface.output_constrained / 10);
+    }
+
+
+    for (int i = 0; i < 4; i++) {
+        blackboxCurrent->rcData[i] = rxGetChannelValue(i);
+        blackboxCurrent->rcCommand[i] = rcCommand[i];
+    }
+
+    blackboxCurrent->attitude[0] = attitude.values.roll;
+    blackboxCurrent->attitude[1] = attitude.values.pitch;
+    blackboxCurrent->attitude[2] = attitude.values.yaw;
+
+    for (int i = 0; i < 8; i++) {
+        blackboxCurrent->debug[i] = debug[i];
+    }
+
+    const int motorCount = getMotorCount();
+    for (int i = 0; i < motorCount; i++) {
+        blackboxCurrent->motor[i] = motor[i];
+    }
+
+    blackboxCurrent->vbat = getBatteryRawVoltage();
+    blackboxCurrent->amperage = getAmperage();
+
+
+    blackboxCurrent->BaroAlt = baro.BaroAlt;
+
+
+
+    blackboxCurrent->airSpeed = pitot.airSpeed;
+
+
+
+
+
+
+
+    blackboxCurrent->rssi = getRSSI();
+
+    for (int i = 0; i < 16; i++) {
+        blackboxCurrent->servo[i] = servo[i];
+    }
+
+
+    blackboxCurrent->navState = navCurrentState;
+    blackboxCurrent->navFlags = navFlags;
+    blackboxCurrent->navEPH = navEPH;
+    blackboxCurrent->navEPV = navEPV;
+    for (int i = 0; i < 3; i++) {
+        blackboxCurrent->navPos[i] = navLatestActualPosition[i];
+        blackboxCurrent->navRealVel[i] = navActualVelocity[i];
+        blackboxCurrent->navAccNEU[i] = navAccNEU[i];
+        blackboxCurrent->navTargetVel[i] = navDesiredVelocity[i];
+        blackboxCurrent->navTargetPos[i] = navTargetPosition[i];
+    }
+    blackboxCurrent->navSurface = navActualSurface;
+
+}
+# 1560 "./src/main/blackbox/blackbox.c"
+static 
+# 1560 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1560 "./src/main/blackbox/blackbox.c"
+           sendFieldDefinition(char mainFrameChar, char deltaFrameChar, const void *fieldDefinitions,
+        const void *secondFieldDefinition, int fieldCount, const uint8_t *conditions, const uint8_t *secondCondition)
+{
+    const blackboxFieldDefinition_t *def;
+    unsigned int headerCount;
+    static 
+# 1565 "./src/main/blackbox/blackbox.c" 3 4
+          _Bool 
+# 1565 "./src/main/blackbox/blackbox.c"
+               needComma = 
+# 1565 "./src/main/blackbox/blackbox.c" 3 4
+                           0
+# 1565 "./src/main/blackbox/blackbox.c"
+                                ;
+    size_t definitionStride = (char*) secondFieldDefinition - (char*) fieldDefinitions;
+    size_t conditionsStride = (char*) secondCondition - (char*) conditions;
+
+    if (deltaFrameChar) {
+        headerCount = (sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0]));
+    } else {
+        headerCount = ((sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0])) - 2);
+    }
+
+
+
+
+
+
+
+    if (xmitState.u.fieldIndex == -1) {
+        if (xmitState.headerIndex >= headerCount) {
+            return 
+# 1583 "./src/main/blackbox/blackbox.c" 3 4
+                  0
+# 1583 "./src/main/blackbox/blackbox.c"
+                       ;
+        }
+
+        uint32_t charsToBeWritten = strlen("H Field x :") + strlen(blackboxFieldHeaderNames[xmitState.headerIndex]);
+
+        if (blackboxDeviceReserveBufferSpace(charsToBeWritten) != BLACKBOX_RESERVE_SUCCESS) {
+            return 
+# 1589 "./src/main/blackbox/blackbox.c" 3 4
+                  1
+# 1589 "./src/main/blackbox/blackbox.c"
+                      ;
+        }
+
+        blackboxHeaderBudget -= blackboxPrintf("H Field %c %s:", xmitState.headerIndex >= ((sizeof(blackboxFieldHeaderNames) / sizeof((blackboxFieldHeaderNames)[0])) - 2) ? deltaFrameChar : mainFrameChar, blackboxFieldHeaderNames[xmitState.headerIndex]);
+
+        xmitState.u.fieldIndex++;
+        needComma = 
+# 1595 "./src/main/blackbox/blackbox.c" 3 4
+                   0
+# 1595 "./src/main/blackbox/blackbox.c"
+                        ;
+    }
+
+
+    const uint32_t LONGEST_INTEGER_STRLEN = 2;
+
+    for (; xmitState.u.fieldIndex < fieldCount; xmitState.u.fieldIndex++) {
+        def = (const blackboxFieldDefinition_t*) ((const char*)fieldDefinitions + definitionStride * xmitState.u.fieldIndex);
+
+        if (!conditions || testBlackboxCondition(conditions[conditionsStride * xmitState.u.fieldIndex])) {
+
+
+            int32_t bytesToWrite = 1;
+
+
+            if (xmitState.headerIndex == 0) {
+                bytesToWrite += strlen(def->name) + strlen("[]") + LONGEST_INTEGER_STRLEN;
+            } else {
+
+                bytesToWrite += LONGEST_INTEGER_STRLEN;
+            }
+
+
+            if (blackboxDeviceReserveBufferSpace(bytesToWrite) != BLACKBOX_RESERVE_SUCCESS) {
+
+                return 
+# 1620 "./src/main/blackbox/blackbox.c" 3 4
+                      1
+# 1620 "./src/main/blackbox/blackbox.c"
+                          ;
+            }
+
+            blackboxHeaderBudget -= bytesToWrite;
+
+            if (needComma) {
+                blackboxWrite(',');
+            } else {
+                needComma = 
+# 1628 "./src/main/blackbox/blackbox.c" 3 4
+                           1
+# 1628 "./src/main/blackbox/blackbox.c"
+                               ;
+            }
+
+
+            if (xmitState.headerIndex == 0) {
+                blackboxPrint(def->name);
+
+
+                if (def->fieldNameIndex != -1) {
+                    blackboxPrintf("[%d]", def->fieldNameIndex);
+                }
+            } else {
+
+                blackboxPrintf("%d", def->arr[xmitState.headerIndex - 1]);
+            }
+        }
+    }
+
+
+    if (xmitState.u.fieldIndex == fieldCount && blackboxDeviceReserveBufferSpace(1) == BLACKBOX_RESERVE_SUCCESS) {
+        blackboxHeaderBudget--;
+        blackboxWrite('\n');
+        xmitState.headerIndex++;
+        xmitState.u.fieldIndex = -1;
+    }
+
+    return xmitState.headerIndex < headerCount;
+}
+
+
+static char *blackboxGetStartDateTime(char *buf)
+{
+    dateTime_t dt;
+
+
+    rtcGetDateTime(&dt);
+    dateTimeFormatLocal(buf, &dt);
+    return buf;
+}
+
+
+#define BLACKBOX_PRINT_HEADER_LINE(name,format,...) case __COUNTER__: blackboxPrintfHeaderLine(name, format, __VA_ARGS__); break;
+
+
+#define BLACKBOX_PRINT_HEADER_LINE_CUSTOM(...) case __COUNTER__: {__VA_ARGS__}; break;
+# 1681 "./src/main/blackbox/blackbox.c"
+static 
+# 1681 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1681 "./src/main/blackbox/blackbox.c"
+           blackboxWriteSysinfo(void)
+{
+
+    if (blackboxDeviceReserveBufferSpace(64) != BLACKBOX_RESERVE_SUCCESS) {
+        return 
+# 1685 "./src/main/blackbox/blackbox.c" 3 4
+              0
+# 1685 "./src/main/blackbox/blackbox.c"
+                   ;
+    }
+
+    char buf[30];
+
+    switch (xmitState.headerIndex) {
+        case 0: blackboxPrintfHeaderLine("Firmware type", "%s", "Cleanflight"); break;;
+        case 1: blackboxPrintfHeaderLine("Firmware revision", "INAV %s (%s) %s", "2" "." "6" "." "0", shortGitRevision, targetName); break;;
+        case 2: blackboxPrintfHeaderLine("Firmware date", "%s %s", buildDate, buildTime); break;;
+        case 3: blackboxPrintfHeaderLine("Log start datetime", "%s", blackboxGetStartDateTime(buf)); break;;
+        case 4: blackboxPrintfHeaderLine("Craft name", "%s", systemConfig()->name); break;;
+        case 5: blackboxPrintfHeaderLine("P interval", "%u/%u", blackboxConfig()->rate_num, blackboxConfig()->rate_denom); break;;
+        case 6: blackboxPrintfHeaderLine("Data compression", "%d", blackboxConfig()->compression); break;;
+        case 7: blackboxPrintfHeaderLine("minthrottle", "%d", getThrottleIdleValue()); break;;
+        case 8: blackboxPrintfHeaderLine("maxthrottle", "%d", motorConfig()->maxthrottle); break;;
+        case 9: blackboxPrintfHeaderLine("gyro_scale", "0x%x", castFloatBytesToInt(1.0f)); break;;
+        case 10: blackboxPrintfHeaderLine("motorOutput", "%d,%d", getThrottleIdleValue(),motorConfig()->maxthrottle); break;;
+        case 11: blackboxPrintfHeaderLine("acc_1G", "%u", acc.dev.acc_1G); break;;
+
+        case 12: {if (testBlackboxCondition(FLIGHT_LOG_FIELD_CONDITION_VBAT)) { blackboxPrintfHeaderLine("vbat_scale", "%u", batteryMetersConfig()->voltage.scale / 10); } else { xmitState.headerIndex += 2; }}; break;
+
+
+
+
+
+             ;
+        case 13: blackboxPrintfHeaderLine("vbatcellvoltage", "%u,%u,%u", currentBatteryProfile->voltage.cellMin / 10, currentBatteryProfile->voltage.cellWarning / 10, currentBatteryProfile->voltage.cellMax / 10); break;
+
+                                                                                                                        ;
+        case 14: blackboxPrintfHeaderLine("vbatref", "%u", vbatReference); break;;
+
+        case 15: {if (feature(FEATURE_CURRENT_METER)) { blackboxPrintfHeaderLine("currentMeter", "%d,%d", batteryMetersConfig()->current.offset, batteryMetersConfig()->current.scale); }}; break;
+
+
+
+
+
+             ;
+
+        case 16: blackboxPrintfHeaderLine("looptime", "%d", getLooptime()); break;;
+        case 17: blackboxPrintfHeaderLine("pid_process_denom", "%d", gyro.pidProcessDenom); break;;
+        case 18: blackboxPrintfHeaderLine("rc_rate", "%d", 100); break;;
+        case 19: blackboxPrintfHeaderLine("rc_expo", "%d", currentControlRateProfile->stabilized.rcExpo8); break;;
+        case 20: blackboxPrintfHeaderLine("rc_yaw_expo", "%d", currentControlRateProfile->stabilized.rcYawExpo8); break;;
+        case 21: blackboxPrintfHeaderLine("thr_mid", "%d", currentControlRateProfile->throttle.rcMid8); break;;
+        case 22: blackboxPrintfHeaderLine("thr_expo", "%d", currentControlRateProfile->throttle.rcExpo8); break;;
+        case 23: blackboxPrintfHeaderLine("tpa_rate", "%d", currentControlRateProfile->throttle.dynPID); break;;
+        case 24: blackboxPrintfHeaderLine("tpa_breakpoint", "%d", currentControlRateProfile->throttle.pa_breakpoint); break;;
+        case 25: blackboxPrintfHeaderLine("rates", "%d,%d,%d", currentControlRateProfile->stabilized.rates[ROLL], currentControlRateProfile->stabilized.rates[PITCH], currentControlRateProfile->stabilized.rates[YAW]); break;
+
+                                                                                                                             ;
+        case 26: blackboxPrintfHeaderLine("rollPID", "%d,%d,%d", pidBank()->pid[PID_ROLL].P, pidBank()->pid[PID_ROLL].I, pidBank()->pid[PID_ROLL].D); break;
+
+                                                                                                       ;
+        case 27: blackboxPrintfHeaderLine("pitchPID", "%d,%d,%d", pidBank()->pid[PID_PITCH].P, pidBank()->pid[PID_PITCH].I, pidBank()->pid[PID_PITCH].D); break;
+
+                                                                                                        ;
+        case 28: blackboxPrintfHeaderLine("yawPID", "%d,%d,%d", pidBank()->pid[PID_YAW].P, pidBank()->pid[PID_YAW].I, pidBank()->pid[PID_YAW].D); break;
+
+                                                                                                      ;
+        case 29: blackboxPrintfHeaderLine("altPID", "%d,%d,%d", pidBank()->pid[PID_POS_Z].P, pidBank()->pid[PID_POS_Z].I, pidBank()->pid[PID_POS_Z].D); break;
+
+                                                                                                        ;
+        case 30: blackboxPrintfHeaderLine("posPID", "%d,%d,%d", pidBank()->pid[PID_POS_XY].P, pidBank()->pid[PID_POS_XY].I, pidBank()->pid[PID_POS_XY].D); break;
+
+                                                                                                         ;
+        case 31: blackboxPrintfHeaderLine("posrPID", "%d,%d,%d", pidBank()->pid[PID_VEL_XY].P, pidBank()->pid[PID_VEL_XY].I, pidBank()->pid[PID_VEL_XY].D); break;
+
+                                                                                                         ;
+        case 32: blackboxPrintfHeaderLine("levelPID", "%d,%d,%d", pidBank()->pid[PID_LEVEL].P, pidBank()->pid[PID_LEVEL].I, pidBank()->pid[PID_LEVEL].D); break;
+
+                                                                                                        ;
+        case 33: blackboxPrintfHeaderLine("magPID", "%d", pidBank()->pid[PID_HEADING].P); break;;
+        case 34: blackboxPrintfHeaderLine("velPID", "%d,%d,%d", pidBank()->pid[PID_VEL_Z].P, pidBank()->pid[PID_VEL_Z].I, pidBank()->pid[PID_VEL_Z].D); break;
+
+                                                                                                        ;
+        case 35: blackboxPrintfHeaderLine("yaw_lpf_hz", "%d", pidProfile()->yaw_lpf_hz); break;;
+        case 36: blackboxPrintfHeaderLine("dterm_lpf_hz", "%d", pidProfile()->dterm_lpf_hz); break;;
+        case 37: blackboxPrintfHeaderLine("dterm_lpf_type", "%d", pidProfile()->dterm_lpf_type); break;;
+        case 38: blackboxPrintfHeaderLine("dterm_lpf2_hz", "%d", pidProfile()->dterm_lpf2_hz); break;;
+        case 39: blackboxPrintfHeaderLine("dterm_lpf2_type", "%d", pidProfile()->dterm_lpf2_type); break;;
+        case 40: blackboxPrintfHeaderLine("deadband", "%d", rcControlsConfig()->deadband); break;;
+        case 41: blackboxPrintfHeaderLine("yaw_deadband", "%d", rcControlsConfig()->yaw_deadband); break;;
+        case 42: blackboxPrintfHeaderLine("gyro_lpf", "%d", gyroConfig()->gyro_lpf); break;;
+        case 43: blackboxPrintfHeaderLine("gyro_lpf_hz", "%d", gyroConfig()->gyro_soft_lpf_hz); break;;
+        case 44: blackboxPrintfHeaderLine("gyro_lpf_type", "%d", gyroConfig()->gyro_soft_lpf_type); break;;
+        case 45: blackboxPrintfHeaderLine("gyro_lpf2_hz", "%d", gyroConfig()->gyro_stage2_lowpass_hz); break;;
+        case 46: blackboxPrintfHeaderLine("dynamicGyroNotchRange", "%d", gyroConfig()->dynamicGyroNotchRange); break;;
+        case 47: blackboxPrintfHeaderLine("dynamicGyroNotchQ", "%d", gyroConfig()->dynamicGyroNotchQ); break;;
+        case 48: blackboxPrintfHeaderLine("dynamicGyroNotchMinHz", "%d", gyroConfig()->dynamicGyroNotchMinHz); break;;
+        case 49: blackboxPrintfHeaderLine("dynamicGyroNotchAnalyser", "%d", gyroConfig()->dynamicGyroNotchAnalyser); break;;
+        case 50: blackboxPrintfHeaderLine("dynamicGyroNotchCount", "%d", gyroConfig()->dynamicGyroNotchCount); break;;
+        case 51: blackboxPrintfHeaderLine("gyro_notch_hz", "%d,%d", gyroConfig()->gyro_notch_hz, 0); break;
+                                                                              ;
+        case 52: blackboxPrintfHeaderLine("gyro_notch_cutoff", "%d,%d", gyroConfig()->gyro_notch_cutoff, 1); break;
+                                                                              ;
+        case 53: blackboxPrintfHeaderLine("acc_lpf_hz", "%d", accelerometerConfig()->acc_lpf_hz); break;;
+        case 54: blackboxPrintfHeaderLine("acc_hardware", "%d", accelerometerConfig()->acc_hardware); break;;
+        case 55: blackboxPrintfHeaderLine("baro_hardware", "%d", barometerConfig()->baro_hardware); break;;
+        case 56: blackboxPrintfHeaderLine("mag_hardware", "%d", compassConfig()->mag_hardware); break;;
+        case 57: blackboxPrintfHeaderLine("serialrx_provider", "%d", rxConfig()->serialrx_provider); break;;
+        case 58: blackboxPrintfHeaderLine("motor_pwm_protocol", "%d", motorConfig()->motorPwmProtocol); break;;
+        case 59: blackboxPrintfHeaderLine("motor_pwm_rate", "%d", motorConfig()->motorPwmRate); break;;
+        case 60: blackboxPrintfHeaderLine("debug_mode", "%d", systemConfig()->debug_mode); break;;
+        case 61: blackboxPrintfHeaderLine("features", "%d", featureConfig()->enabledFeatures); break;;
+
+        case 62: blackboxPrintfHeaderLine("waypoints", "%d,%d", getWaypointCount(),isWaypointListValid()); break;;
+
+        case 63: blackboxPrintfHeaderLine("acc_notch_hz", "%d", accelerometerConfig()->acc_notch_hz); break;;
+        case 64: blackboxPrintfHeaderLine("acc_notch_cutoff", "%d", accelerometerConfig()->acc_notch_cutoff); break;;
+        case 65: blackboxPrintfHeaderLine("gyro_stage2_lowpass_hz", "%d", gyroConfig()->gyro_stage2_lowpass_hz); break;;
+        case 66: blackboxPrintfHeaderLine("pidSumLimit", "%d", pidProfile()->pidSumLimit); break;;
+        case 67: blackboxPrintfHeaderLine("pidSumLimitYaw", "%d", pidProfile()->pidSumLimitYaw); break;;
+        case 68: blackboxPrintfHeaderLine("axisAccelerationLimitYaw", "%d", pidProfile()->axisAccelerationLimitYaw); break;;
+        case 69: blackboxPrintfHeaderLine("axisAccelerationLimitRollPitch", "%d", pidProfile()->axisAccelerationLimitRollPitch); break;;
+
+
+
+
+
+
+        default:
+            return 
+# 1807 "./src/main/blackbox/blackbox.c" 3 4
+                  1
+# 1807 "./src/main/blackbox/blackbox.c"
+                      ;
+    }
+
+    xmitState.headerIndex++;
+    return 
+# 1811 "./src/main/blackbox/blackbox.c" 3 4
+          0
+# 1811 "./src/main/blackbox/blackbox.c"
+               ;
+}
+
+
+
+
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data)
+{
+
+    if (!(blackboxState == BLACKBOX_STATE_RUNNING || blackboxState == BLACKBOX_STATE_PAUSED)) {
+        return;
+    }
+
+
+    blackboxWrite('E');
+    blackboxWrite(event);
+
+
+    switch (event) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        blackboxWriteUnsignedVB(data->syncBeep.time);
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        blackboxWriteUnsignedVB(data->flightMode.flags);
+        blackboxWriteUnsignedVB(data->flightMode.lastFlags);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        if (data->inflightAdjustment.floatFlag) {
+            blackboxWrite(data->inflightAdjustment.adjustmentFunction + 128);
+            blackboxWriteFloat(data->inflightAdjustment.newFloatValue);
+        } else {
+            blackboxWrite(data->inflightAdjustment.adjustmentFunction);
+            blackboxWriteSignedVB(data->inflightAdjustment.newValue);
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        blackboxWriteUnsignedVB(data->loggingResume.logIteration);
+        blackboxWriteUnsignedVB(data->loggingResume.currentTimeUs);
+        break;
+    case FLIGHT_LOG_EVENT_IMU_FAILURE:
+        blackboxWriteUnsignedVB(data->imuError.errorCode);
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END:
+        blackboxPrintf("End of log (disarm reason:%d)", getDisarmReason());
+        blackboxWrite(0);
+        break;
+    }
+}
+
+
+static void blackboxCheckAndLogArmingBeep(void)
+{
+
+    if (getArmingBeepTimeMicros() != blackboxLastArmingBeep) {
+        blackboxLastArmingBeep = getArmingBeepTimeMicros();
+        flightLogEvent_syncBeep_t eventData;
+        eventData.time = blackboxLastArmingBeep;
+        blackboxLogEvent(FLIGHT_LOG_EVENT_SYNC_BEEP, (flightLogEventData_t *) &eventData);
+    }
+}
+
+
+static void blackboxCheckAndLogFlightMode(void)
+{
+
+    if (memcmp(&rcModeActivationMask, &blackboxLastFlightModeFlags, sizeof(blackboxLastFlightModeFlags))) {
+        flightLogEvent_flightMode_t eventData;
+        eventData.lastFlags = blackboxLastFlightModeFlags;
+        memcpy(&blackboxLastFlightModeFlags, &rcModeActivationMask, sizeof(blackboxLastFlightModeFlags));
+        memcpy(&eventData.flags, &rcModeActivationMask, sizeof(eventData.flags));
+        blackboxLogEvent(FLIGHT_LOG_EVENT_FLIGHTMODE, (flightLogEventData_t *)&eventData);
+    }
+}
+
+
+
+
+
+static 
+# 1889 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1889 "./src/main/blackbox/blackbox.c"
+           blackboxShouldLogPFrame(uint32_t pFrameIndex)
+{
+
+
+
+    return (pFrameIndex + blackboxConfig()->rate_num - 1) % blackboxConfig()->rate_denom < blackboxConfig()->rate_num;
+}
+
+static 
+# 1897 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 1897 "./src/main/blackbox/blackbox.c"
+           blackboxShouldLogIFrame(void)
+{
+    return blackboxPFrameIndex == 0;
+}
+
+
+static void blackboxAdvanceIterationTimers(void)
+{
+    blackboxIteration++;
+    blackboxPFrameIndex++;
+
+    if (blackboxPFrameIndex == blackboxIFrameInterval) {
+        blackboxPFrameIndex = 0;
+        blackboxIFrameIndex++;
+    }
+}
+
+static uint8_t blackboxSnapshotCount(void)
+{
+    return (blackboxSnapshotHead - blackboxSnapshotTail) & (8 - 1);
+}
+
+
+static void blackboxQueueIteration(timeUs_t currentTimeUs)
+{
+    uint8_t flags = blackboxSnapshotPendingFlags;
+
+
+    if (blackboxPFrameIndex == (blackboxIFrameInterval / 2) && blackboxIFrameIndex % 128 == 0) {
+
+        flags |= BLACKBOX_SNAPSHOT_GPS_HOME;
+        blackboxSnapshotPendingFlags = flags;
+    }
+
+
+
+    if (blackboxShouldLogIFrame()) {
+        flags |= BLACKBOX_SNAPSHOT_INTRAFRAME;
+    } else if (!blackboxShouldLogPFrame(blackboxPFrameIndex)) {
+        return;
+    } else if (flags & BLACKBOX_SNAPSHOT_RESUME) {
+
+        blackboxSnapshotsDropped++;
+        return;
+    }
+
+    if (blackboxSnapshotCount() >= 8 - 2) {
+
+        blackboxSnapshotsDropped++;
+        blackboxSnapshotPendingFlags |= BLACKBOX_SNAPSHOT_RESUME | BLACKBOX_SNAPSHOT_SLOW_FRAME;
+        return;
+    }
+
+    const uint8_t head = blackboxSnapshotHead;
+    blackboxSnapshot_t *snapshot = &blackboxSnapshotRing[head];
+
+    loadMainState(&snapshot->state, currentTimeUs);
+    snapshot->iteration = blackboxIteration;
+    snapshot->flags = flags;
+
+    blackboxSnapshotPendingFlags = 0;
+    blackboxSnapshotHead = (head + 1) & (8 - 1);
+}
+
+
+static void blackboxLogSnapshot(blackboxSnapshot_t *snapshot)
+{
+    blackboxLoggedIteration = snapshot->iteration;
+    blackboxHistory[0] = &snapshot->state;
+
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_RESUME) {
+
+        flightLogEvent_loggingResume_t resume;
+
+        resume.logIteration = snapshot->iteration;
+        resume.currentTimeUs = snapshot->state.time;
+
+        blackboxLogEvent(FLIGHT_LOG_EVENT_LOGGING_RESUME, (flightLogEventData_t *) &resume);
+    }
+
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_SLOW_FRAME) {
+        blackboxSlowFrameIteration = snapshot->iteration - blackboxSInterval;
+    }
+
+    if (snapshot->flags & BLACKBOX_SNAPSHOT_INTRAFRAME) {
+
+
+
+
+        writeSlowFrameIfNeeded(blackboxIsOnlyLoggingIntraframes());
+
+        writeIntraframe();
+    } else {
+        blackboxCheckAndLogArmingBeep();
+        blackboxCheckAndLogFlightMode();
+
+
+
+
+
+        writeSlowFrameIfNeeded(
+# 1997 "./src/main/blackbox/blackbox.c" 3 4
+                              1
+# 1997 "./src/main/blackbox/blackbox.c"
+                                  );
+
+        writeInterframe();
+    }
+
+
+    if (feature(FEATURE_GPS)) {
+
+
+
+
+
+
+
+        if (GPS_home.lat != gpsHistory.GPS_home[0] || GPS_home.lon != gpsHistory.GPS_home[1]
+            || (snapshot->flags & BLACKBOX_SNAPSHOT_GPS_HOME)) {
+
+            writeGPSHomeFrame();
+            writeGPSFrame(snapshot->state.time);
+        } else if (gpsSol.numSat != gpsHistory.GPS_numSat || gpsSol.llh.lat != gpsHistory.GPS_coord[0]
+                || gpsSol.llh.lon != gpsHistory.GPS_coord[1]) {
+
+            writeGPSFrame(snapshot->state.time);
+        }
+    }
+
+}
+
+
+static void blackboxLogQueuedSnapshots(void)
+{
+    while (blackboxSnapshotTail != blackboxSnapshotHead) {
+        const uint8_t tail = blackboxSnapshotTail;
+
+        blackboxLogSnapshot(&blackboxSnapshotRing[tail]);
+
+
+        blackboxDeviceFlush();
+
+        blackboxSnapshotTail = (tail + 1) & (8 - 1);
+    }
+}
+
+
+
+
+
+void blackboxUpdate(timeUs_t currentTimeUs)
+{
+    switch (blackboxState) {
+    case BLACKBOX_STATE_PAUSED:
+
+        if (IS_RC_MODE_ACTIVE(BOXBLACKBOX) && blackboxShouldLogIFrame()) {
+            blackboxSetState(BLACKBOX_STATE_RUNNING);
+            blackboxSnapshotPendingFlags |= BLACKBOX_SNAPSHOT_RESUME;
+
+            blackboxQueueIteration(currentTimeUs);
+        }
+
+        blackboxAdvanceIterationTimers();
+        break;
+    case BLACKBOX_STATE_RUNNING:
+
+        if (blackboxModeActivationConditionPresent && !IS_RC_MODE_ACTIVE(BOXBLACKBOX)) {
+            blackboxSetState(BLACKBOX_STATE_PAUSED);
+        } else {
+            blackboxQueueIteration(currentTimeUs);
+        }
+        blackboxAdvanceIterationTimers();
+        break;
+    default:
+        break;
+    }
+}
+
+
+
+
+void blackboxProcess(timeUs_t currentTimeUs)
+{
+    (void)(currentTimeUs);
+
+    if (blackboxState >= BLACKBOX_STATE_SEND_HEADER && blackboxState <= BLACKBOX_STATE_SEND_SYSINFO) {
+        blackboxReplenishHeaderBudget();
+    }
+
+    switch (blackboxState) {
+    case BLACKBOX_STATE_PREPARE_LOG_FILE:
+        if (blackboxDeviceBeginLog()) {
+            blackboxSetState(BLACKBOX_STATE_SEND_HEADER);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_HEADER:
+
+
+
+
+
+
+        if (millis() > xmitState.u.startTime + 100) {
+            if (blackboxDeviceReserveBufferSpace(64) == BLACKBOX_RESERVE_SUCCESS) {
+                for (int i = 0; i < 64 && blackboxHeader[xmitState.headerIndex] != '\0'; i++, xmitState.headerIndex++) {
+                    blackboxWrite(blackboxHeader[xmitState.headerIndex]);
+                    blackboxHeaderBudget--;
+                }
+
+                if (blackboxHeader[xmitState.headerIndex] == '\0') {
+                    blackboxPrintfHeaderLine("I interval", "%d", blackboxIFrameInterval);
+                    blackboxSetState(BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER);
+                }
+            }
+        }
+        break;
+    case BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER:
+
+        if (!sendFieldDefinition('I', 'P', blackboxMainFields, blackboxMainFields + 1, (sizeof(blackboxMainFields) / sizeof((blackboxMainFields)[0])),
+                &blackboxMainFields[0].condition, &blackboxMainFields[1].condition)) {
+
+            if (feature(FEATURE_GPS)) {
+                blackboxSetState(BLACKBOX_STATE_SEND_GPS_H_HEADER);
+            } else
+
+                blackboxSetState(BLACKBOX_STATE_SEND_SLOW_HEADER);
+        }
+        break;
+
+    case BLACKBOX_STATE_SEND_GPS_H_HEADER:
+
+        if (!sendFieldDefinition('H', 0, blackboxGpsHFields, blackboxGpsHFields + 1, (sizeof(blackboxGpsHFields) / sizeof((blackboxGpsHFields)[0])),
+                
+# 2126 "./src/main/blackbox/blackbox.c" 3 4
+               ((void *)0)
+# 2126 "./src/main/blackbox/blackbox.c"
+                   , 
+# 2126 "./src/main/blackbox/blackbox.c" 3 4
+                     ((void *)0)
+# 2126 "./src/main/blackbox/blackbox.c"
+                         )) {
+            blackboxSetState(BLACKBOX_STATE_SEND_GPS_G_HEADER);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_GPS_G_HEADER:
+
+        if (!sendFieldDefinition('G', 0, blackboxGpsGFields, blackboxGpsGFields + 1, (sizeof(blackboxGpsGFields) / sizeof((blackboxGpsGFields)[0])),
+                &blackboxGpsGFields[0].condition, &blackboxGpsGFields[1].condition)) {
+            blackboxSetState(BLACKBOX_STATE_SEND_SLOW_HEADER);
+        }
+        break;
+
+    case BLACKBOX_STATE_SEND_SLOW_HEADER:
+
+        if (!sendFieldDefinition('S', 0, blackboxSlowFields, blackboxSlowFields + 1, (sizeof(blackboxSlowFields) / sizeof((blackboxSlowFields)[0])),
+                
+# 2141 "./src/main/blackbox/blackbox.c" 3 4
+               ((void *)0)
+# 2141 "./src/main/blackbox/blackbox.c"
+                   , 
+# 2141 "./src/main/blackbox/blackbox.c" 3 4
+                     ((void *)0)
+# 2141 "./src/main/blackbox/blackbox.c"
+                         )) {
+            blackboxSetState(BLACKBOX_STATE_SEND_SYSINFO);
+        }
+        break;
+    case BLACKBOX_STATE_SEND_SYSINFO:
+
+
+
+        if (blackboxWriteSysinfo()) {
+
+
+
+
+
+            if (blackboxDeviceFlushForce()) {
+                blackboxSetState(BLACKBOX_STATE_RUNNING);
+            }
+        }
+        break;
+    case BLACKBOX_STATE_PAUSED:
+    case BLACKBOX_STATE_RUNNING:
+        blackboxLogQueuedSnapshots();
+        break;
+    case BLACKBOX_STATE_SHUTTING_DOWN:
+
+
+
+
+
+
+
+        if (blackboxDeviceEndLog(blackboxLoggedAnyFrames) && (millis() > xmitState.u.startTime + 200 || blackboxDeviceFlushForce())) {
+            blackboxDeviceClose();
+            blackboxSetState(BLACKBOX_STATE_STOPPED);
+        }
+        break;
+    default:
+        break;
+    }
+
+
+    if (isBlackboxDeviceFull()) {
+        blackboxSetState(BLACKBOX_STATE_STOPPED);
+    }
+}
+
+static 
+# 2187 "./src/main/blackbox/blackbox.c" 3 4
+      _Bool 
+# 2187 "./src/main/blackbox/blackbox.c"
+           canUseBlackboxWithCurrentConfiguration(void)
+{
+    return feature(FEATURE_BLACKBOX);
+}
+
+
+
+
+void blackboxInit(void)
+{
+    if (canUseBlackboxWithCurrentConfiguration()) {
+        blackboxSetState(BLACKBOX_STATE_STOPPED);
+    } else {
+        blackboxSetState(BLACKBOX_STATE_DISABLED);
+    }
+
+
+    int max_denom = 4096*1000 / gyroConfig()->looptime;
+    if (blackboxConfig()->rate_denom > max_denom) {
+        blackboxConfigMutable()->rate_denom = max_denom;
+    }
+
+    if (blackboxConfig()->rate_denom <= 32) {
+        blackboxIFrameInterval = 32;
+    }
+    else {
+
+        blackboxIFrameInterval = 1 << (32 - __builtin_clz (blackboxConfig()->rate_denom - 1));
+    }
+}
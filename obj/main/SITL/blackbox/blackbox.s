@@ -0,0 +1,29002 @@
+	.file	"blackbox.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 8 "./src/main/blackbox/blackbox.h"
+	.file 9 "./src/main/blackbox/blackbox_io.h"
+	.file 10 "./src/main/build/debug.h"
+	.file 11 "./src/main/build/version.h"
+	.file 12 "./src/main/common/maths.h"
+	.file 13 "./src/main/config/feature.h"
+	.file 14 "./src/main/drivers/io_types.h"
+	.file 15 "./src/main/drivers/resource.h"
+	.file 16 "./src/main/drivers/bus.h"
+	.file 17 "./src/main/drivers/sensor.h"
+	.file 18 "./src/main/drivers/accgyro/accgyro.h"
+	.file 19 "./src/main/drivers/compass/compass.h"
+	.file 20 "./src/main/common/vector.h"
+	.file 21 "./src/main/drivers/adc.h"
+	.file 22 "./src/main/fc/config.h"
+	.file 23 "./src/main/fc/controlrate_profile.h"
+	.file 24 "./src/main/fc/fc_core.h"
+	.file 25 "./src/main/fc/rc_controls.h"
+	.file 26 "./src/main/common/bitarray.h"
+	.file 27 "./src/main/fc/rc_modes.h"
+	.file 28 "./src/main/fc/runtime_config.h"
+	.file 29 "./src/main/flight/failsafe.h"
+	.file 30 "./src/main/flight/imu.h"
+	.file 31 "./src/main/flight/mixer.h"
+	.file 32 "./src/main/flight/pid.h"
+	.file 33 "./src/main/flight/servos.h"
+	.file 34 "./src/main/io/gps.h"
+	.file 35 "./src/main/common/filter.h"
+	.file 36 "./src/main/navigation/navigation.h"
+	.file 37 "./src/main/rx/rx.h"
+	.file 38 "./src/main/sensors/diagnostics.h"
+	.file 39 "./src/main/sensors/sensors.h"
+	.file 40 "./src/main/sensors/acceleration.h"
+	.file 41 "./src/main/drivers/barometer/barometer.h"
+	.file 42 "./src/main/sensors/barometer.h"
+	.file 43 "./src/main/sensors/battery.h"
+	.file 44 "./src/main/sensors/compass.h"
+	.file 45 "./src/main/sensors/gyro.h"
+	.file 46 "./src/main/common/calibration.h"
+	.file 47 "./src/main/drivers/pitotmeter.h"
+	.file 48 "./src/main/sensors/pitotmeter.h"
+	.file 49 "./src/main/blackbox/blackbox.c"
+	.file 50 "./src/main/common/encoding.h"
+	.file 51 "./src/main/blackbox/blackbox_encoding.h"
+	.file 52 "/usr/include/string.h"
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 54 "./src/main/sensors/temperature.h"
+	.file 55 "./src/main/flight/wind_estimator.h"
+	.file 56 "./src/main/drivers/time.h"
+	.file 57 "./src/main/io/beeper.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox.c.8490ad2d
+	.weak	blackbox.c.8490ad2d
+blackbox.c.8490ad2d:
+	.long	0x3fbc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x39
+	.long	.LASF3316
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2140
+	.uleb128 0x1b
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2141
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2142
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2143
+	.uleb128 0x3
+	.long	.LASF2145
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2144
+	.uleb128 0x3
+	.long	.LASF2146
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2147
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x1b
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2148
+	.uleb128 0x3
+	.long	.LASF2149
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2150
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF2151
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.long	.LASF2152
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x19
+	.long	0xac
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2153
+	.uleb128 0x3
+	.long	.LASF2154
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3b
+	.byte	0x8
+	.uleb128 0x6
+	.long	0xc6
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2155
+	.uleb128 0xa
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF2156
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF2157
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF2158
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0xa
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF2159
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x13
+	.long	0xa0
+	.uleb128 0x3
+	.long	.LASF2160
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xa
+	.long	0x107
+	.uleb128 0x3c
+	.long	0x107
+	.uleb128 0x3
+	.long	.LASF2161
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2162
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0xa
+	.long	0x129
+	.uleb128 0x3
+	.long	.LASF2163
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb3
+	.uleb128 0x3
+	.long	.LASF2164
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.long	0xcd
+	.uleb128 0xa
+	.long	0x152
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2165
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2166
+	.uleb128 0x3
+	.long	.LASF2167
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0x11d
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x1a4
+	.uleb128 0x15
+	.long	.LASF2168
+	.value	0xfff
+	.uleb128 0x15
+	.long	.LASF2169
+	.value	0xf000
+	.uleb128 0x15
+	.long	.LASF2170
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2172
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2173
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x1b0
+	.uleb128 0x28
+	.long	0x1bb
+	.uleb128 0x5
+	.long	0xbf
+	.byte	0
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x1dc
+	.uleb128 0x24
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x33
+	.byte	0xf
+	.long	0xbf
+	.uleb128 0x24
+	.string	"fn"
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x1dc
+	.byte	0
+	.uleb128 0x6
+	.long	0x1a4
+	.uleb128 0x8
+	.long	.LASF2182
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x23c
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xb
+	.long	0x16a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2175
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x23c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2176
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x23c
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xf
+	.long	0x241
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2177
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x1bb
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x107
+	.uleb128 0x6
+	.long	0x23c
+	.uleb128 0x3
+	.long	.LASF2178
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x1e1
+	.uleb128 0xa
+	.long	0x246
+	.uleb128 0x3
+	.long	.LASF2179
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x11
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF2180
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0x129
+	.uleb128 0x3
+	.long	.LASF2181
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x13a
+	.uleb128 0x8
+	.long	.LASF2183
+	.byte	0xa
+	.byte	0x6
+	.byte	0x49
+	.long	0x2e3
+	.uleb128 0x2
+	.long	.LASF2184
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xe
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2185
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0xd
+	.string	"day"
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2186
+	.byte	0x6
+	.byte	0x51
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2187
+	.byte	0x6
+	.byte	0x53
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2188
+	.byte	0x6
+	.byte	0x55
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2189
+	.byte	0x6
+	.byte	0x57
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2190
+	.byte	0x6
+	.byte	0x58
+	.byte	0x3
+	.long	0x27b
+	.uleb128 0x1e
+	.long	.LASF2218
+	.long	0x30
+	.byte	0x7
+	.byte	0x19
+	.long	0x3a1
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2218
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x3
+	.long	0x2ef
+	.uleb128 0x1e
+	.long	.LASF2219
+	.long	0x30
+	.byte	0x7
+	.byte	0x3d
+	.long	0x3ff
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0xa
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2231
+	.long	0x30
+	.byte	0x7
+	.byte	0x61
+	.long	0x439
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x9
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2239
+	.long	0x30
+	.byte	0x7
+	.byte	0x6b
+	.long	0x455
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2242
+	.long	0x30
+	.byte	0x7
+	.byte	0x70
+	.long	0x471
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2245
+	.long	0x30
+	.byte	0x7
+	.byte	0x78
+	.long	0x4a5
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2245
+	.byte	0x7
+	.byte	0x7f
+	.byte	0x3
+	.long	0x471
+	.uleb128 0x8
+	.long	.LASF2252
+	.byte	0x4
+	.byte	0x7
+	.byte	0x81
+	.long	0x4cb
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x7
+	.byte	0x82
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2254
+	.byte	0x7
+	.byte	0x83
+	.byte	0x3
+	.long	0x4b1
+	.uleb128 0x8
+	.long	.LASF2255
+	.byte	0x8
+	.byte	0x7
+	.byte	0x85
+	.long	0x4fe
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x7
+	.byte	0x86
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2257
+	.byte	0x7
+	.byte	0x87
+	.byte	0xe
+	.long	0x129
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2258
+	.byte	0x7
+	.byte	0x88
+	.byte	0x3
+	.long	0x4d7
+	.uleb128 0x8
+	.long	.LASF2259
+	.byte	0xc
+	.byte	0x7
+	.byte	0x8a
+	.long	0x54b
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x7
+	.byte	0x8b
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x9
+	.long	0x54b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x7
+	.byte	0x8d
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x7
+	.byte	0x8e
+	.byte	0xb
+	.long	0x15c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2264
+	.uleb128 0x3
+	.long	.LASF2265
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x3
+	.long	0x50a
+	.uleb128 0x8
+	.long	.LASF2266
+	.byte	0x10
+	.byte	0x7
+	.byte	0x91
+	.long	0x585
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x7
+	.byte	0x92
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0x7
+	.byte	0x93
+	.byte	0xe
+	.long	0x26f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2269
+	.byte	0x7
+	.byte	0x94
+	.byte	0x3
+	.long	0x55e
+	.uleb128 0x8
+	.long	.LASF2270
+	.byte	0x4
+	.byte	0x7
+	.byte	0x96
+	.long	0x5ab
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0x7
+	.byte	0x97
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2272
+	.byte	0x7
+	.byte	0x98
+	.byte	0x3
+	.long	0x591
+	.uleb128 0x2f
+	.long	.LASF2865
+	.byte	0x10
+	.byte	0x7
+	.byte	0x9c
+	.long	0x600
+	.uleb128 0x1f
+	.long	.LASF2273
+	.byte	0x7
+	.byte	0x9d
+	.byte	0x1f
+	.long	0x4cb
+	.uleb128 0x1f
+	.long	.LASF2274
+	.byte	0x7
+	.byte	0x9e
+	.byte	0x21
+	.long	0x4fe
+	.uleb128 0x1f
+	.long	.LASF2275
+	.byte	0x7
+	.byte	0x9f
+	.byte	0x29
+	.long	0x552
+	.uleb128 0x1f
+	.long	.LASF2276
+	.byte	0x7
+	.byte	0xa0
+	.byte	0x24
+	.long	0x585
+	.uleb128 0x1f
+	.long	.LASF2277
+	.byte	0x7
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x5ab
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2278
+	.byte	0x7
+	.byte	0xa2
+	.byte	0x3
+	.long	0x5b7
+	.uleb128 0x8
+	.long	.LASF2279
+	.byte	0x8
+	.byte	0x8
+	.byte	0x18
+	.long	0x65a
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x8
+	.byte	0x19
+	.byte	0xe
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2285
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x60c
+	.uleb128 0xa
+	.long	0x65a
+	.uleb128 0x9
+	.long	.LASF2286
+	.byte	0x8
+	.byte	0x20
+	.byte	0x19
+	.long	0x65a
+	.uleb128 0x9
+	.long	.LASF2287
+	.byte	0x8
+	.byte	0x20
+	.byte	0x48
+	.long	0x65a
+	.uleb128 0x1e
+	.long	.LASF2288
+	.long	0x30
+	.byte	0x9
+	.byte	0x19
+	.long	0x69f
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x1
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x9
+	.byte	0x26
+	.long	0x6bd
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2294
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x3
+	.long	0x69f
+	.uleb128 0x3d
+	.long	.LASF2295
+	.value	0x108
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x10
+	.long	0x6ff
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x9
+	.byte	0x40
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x9
+	.byte	0x41
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x9
+	.byte	0x42
+	.byte	0xd
+	.long	0x6ff
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.long	0x107
+	.long	0x70f
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2299
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x6c9
+	.uleb128 0x9
+	.long	.LASF2300
+	.byte	0x9
+	.byte	0x45
+	.byte	0x10
+	.long	0xea
+	.uleb128 0x9
+	.long	.LASF2301
+	.byte	0x9
+	.byte	0x46
+	.byte	0x1e
+	.long	0x70f
+	.uleb128 0xe
+	.long	0xea
+	.long	0x743
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2302
+	.byte	0xa
+	.byte	0x17
+	.byte	0x10
+	.long	0x733
+	.uleb128 0x9
+	.long	.LASF2303
+	.byte	0xa
+	.byte	0x18
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xa
+	.byte	0x33
+	.long	0x803
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x19
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2330
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x157
+	.uleb128 0x9
+	.long	.LASF2331
+	.byte	0xb
+	.byte	0x21
+	.byte	0x1a
+	.long	0x157
+	.uleb128 0x9
+	.long	.LASF2332
+	.byte	0xb
+	.byte	0x24
+	.byte	0x1a
+	.long	0x157
+	.uleb128 0x9
+	.long	.LASF2333
+	.byte	0xb
+	.byte	0x27
+	.byte	0x1a
+	.long	0x157
+	.uleb128 0xe
+	.long	0x15c
+	.long	0x843
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2334
+	.byte	0x14
+	.byte	0xc
+	.byte	0x67
+	.long	0x891
+	.uleb128 0x2
+	.long	.LASF2335
+	.byte	0xc
+	.byte	0x69
+	.byte	0xb
+	.long	0x15c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2336
+	.byte	0xc
+	.byte	0x69
+	.byte	0x13
+	.long	0x15c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2337
+	.byte	0xc
+	.byte	0x69
+	.byte	0x1b
+	.long	0x15c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2338
+	.byte	0xc
+	.byte	0x69
+	.byte	0x23
+	.long	0x15c
+	.byte	0xc
+	.uleb128 0xd
+	.string	"m_n"
+	.byte	0xc
+	.byte	0x6a
+	.byte	0x9
+	.long	0x88
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2339
+	.byte	0xc
+	.byte	0x6b
+	.byte	0x3
+	.long	0x843
+	.uleb128 0x8
+	.long	.LASF2340
+	.byte	0x4
+	.byte	0xd
+	.byte	0x16
+	.long	0x8b7
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0xd
+	.byte	0x17
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2342
+	.byte	0xd
+	.byte	0x18
+	.byte	0x3
+	.long	0x89d
+	.uleb128 0xa
+	.long	0x8b7
+	.uleb128 0x9
+	.long	.LASF2343
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x18
+	.long	0x8b7
+	.uleb128 0x3
+	.long	.LASF2344
+	.byte	0xe
+	.byte	0x7
+	.byte	0x11
+	.long	0x107
+	.uleb128 0x3
+	.long	.LASF2345
+	.byte	0xe
+	.byte	0x8
+	.byte	0xf
+	.long	0xbf
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xf
+	.byte	0x16
+	.long	0x9dc
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x25
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xf
+	.byte	0x43
+	.long	0xa66
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2398
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2399
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2400
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2401
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x14
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x10
+	.byte	0x3a
+	.long	0xa90
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2410
+	.byte	0x10
+	.byte	0x40
+	.byte	0x3
+	.long	0xa66
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x10
+	.byte	0x4b
+	.long	0xbd4
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2461
+	.byte	0x10
+	.byte	0x94
+	.byte	0x3
+	.long	0xa9c
+	.uleb128 0x30
+	.byte	0xa6
+	.uleb128 0x8
+	.long	.LASF2462
+	.byte	0x18
+	.byte	0x10
+	.byte	0x9f
+	.long	0xc57
+	.uleb128 0x2
+	.long	.LASF2463
+	.byte	0x10
+	.byte	0xa0
+	.byte	0xc
+	.long	0xbf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0x10
+	.byte	0xa1
+	.byte	0xf
+	.long	0xa90
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2465
+	.byte	0x10
+	.byte	0xa2
+	.byte	0x17
+	.long	0xbd4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x10
+	.byte	0xa3
+	.byte	0xd
+	.long	0x107
+	.byte	0x10
+	.uleb128 0xd
+	.string	"tag"
+	.byte	0x10
+	.byte	0xa4
+	.byte	0xd
+	.long	0x107
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2466
+	.byte	0x10
+	.byte	0xa5
+	.byte	0xd
+	.long	0x107
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0x10
+	.byte	0xb3
+	.byte	0x7
+	.long	0xbe0
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x10
+	.byte	0xb4
+	.byte	0xd
+	.long	0x8d4
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2469
+	.byte	0x10
+	.byte	0xb5
+	.byte	0x3
+	.long	0xbe2
+	.uleb128 0xa
+	.long	0xc57
+	.uleb128 0x30
+	.byte	0xbc
+	.uleb128 0x8
+	.long	.LASF2470
+	.byte	0x28
+	.byte	0x10
+	.byte	0xb7
+	.long	0xcd2
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x10
+	.byte	0xb8
+	.byte	0x23
+	.long	0xcd2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0x10
+	.byte	0xb9
+	.byte	0xf
+	.long	0xa90
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x10
+	.byte	0xba
+	.byte	0xe
+	.long	0x129
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2466
+	.byte	0x10
+	.byte	0xbb
+	.byte	0xe
+	.long	0x129
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0x10
+	.byte	0xc9
+	.byte	0x7
+	.long	0xc68
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0x10
+	.byte	0xca
+	.byte	0xa
+	.long	0x8e0
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0x10
+	.byte	0xcb
+	.byte	0x10
+	.long	0xcd7
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0xc63
+	.uleb128 0x6
+	.long	0x129
+	.uleb128 0x3
+	.long	.LASF2473
+	.byte	0x10
+	.byte	0xce
+	.byte	0x3
+	.long	0xc6a
+	.uleb128 0x6
+	.long	0x113
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x11
+	.byte	0x1a
+	.long	0xd2f
+	.uleb128 0x1
+	.long	.LASF2474
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2478
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2483
+	.byte	0x11
+	.byte	0x24
+	.byte	0x3
+	.long	0xced
+	.uleb128 0x6
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF2484
+	.byte	0x11
+	.byte	0x2a
+	.byte	0x10
+	.long	0xd4c
+	.uleb128 0x6
+	.long	0xd51
+	.uleb128 0x28
+	.long	0xd5c
+	.uleb128 0x5
+	.long	0xd5c
+	.byte	0
+	.uleb128 0x6
+	.long	0xd61
+	.uleb128 0x8
+	.long	.LASF2485
+	.byte	0x28
+	.byte	0x12
+	.byte	0x4d
+	.long	0xdc9
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x12
+	.byte	0x4e
+	.byte	0x13
+	.long	0xe85
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x12
+	.byte	0x4f
+	.byte	0x1a
+	.long	0xd40
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0x12
+	.byte	0x50
+	.byte	0x1a
+	.long	0xdc9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x12
+	.byte	0x51
+	.byte	0xe
+	.long	0x11d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x12
+	.byte	0x52
+	.byte	0xd
+	.long	0xe75
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0x12
+	.byte	0x53
+	.byte	0xd
+	.long	0x107
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2492
+	.byte	0x12
+	.byte	0x54
+	.byte	0x14
+	.long	0xd2f
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2493
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xf
+	.long	0xdd5
+	.uleb128 0x6
+	.long	0xdda
+	.uleb128 0x23
+	.long	0x54b
+	.long	0xde9
+	.uleb128 0x5
+	.long	0xd5c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2494
+	.byte	0x11
+	.byte	0x33
+	.byte	0xf
+	.long	0xdf5
+	.uleb128 0x6
+	.long	0xdfa
+	.uleb128 0x23
+	.long	0x54b
+	.long	0xe09
+	.uleb128 0x5
+	.long	0xe09
+	.byte	0
+	.uleb128 0x6
+	.long	0xe0e
+	.uleb128 0x8
+	.long	.LASF2495
+	.byte	0x48
+	.byte	0x13
+	.byte	0x18
+	.long	0xe69
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x13
+	.byte	0x19
+	.byte	0x13
+	.long	0xe85
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2496
+	.byte	0x13
+	.byte	0x1a
+	.byte	0x1a
+	.long	0xde9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2497
+	.byte	0x13
+	.byte	0x1b
+	.byte	0x1a
+	.long	0xe69
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2498
+	.byte	0x13
+	.byte	0x22
+	.byte	0x7
+	.long	0xeef
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2499
+	.byte	0x13
+	.byte	0x23
+	.byte	0xd
+	.long	0x107
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x13
+	.byte	0x24
+	.byte	0xd
+	.long	0xe75
+	.byte	0x42
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2501
+	.byte	0x11
+	.byte	0x34
+	.byte	0xf
+	.long	0xdf5
+	.uleb128 0xe
+	.long	0xde
+	.long	0xe85
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0xcdc
+	.uleb128 0x3
+	.long	.LASF2502
+	.byte	0x12
+	.byte	0x55
+	.byte	0x3
+	.long	0xd61
+	.uleb128 0x18
+	.byte	0x24
+	.byte	0x14
+	.byte	0x20
+	.byte	0x9
+	.long	0xeab
+	.uleb128 0xd
+	.string	"m"
+	.byte	0x14
+	.byte	0x21
+	.byte	0xb
+	.long	0xeab
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x15c
+	.long	0xec1
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2503
+	.byte	0x14
+	.byte	0x22
+	.byte	0x3
+	.long	0xe96
+	.uleb128 0x29
+	.byte	0x24
+	.byte	0x13
+	.byte	0x1e
+	.byte	0x9
+	.long	0xeef
+	.uleb128 0x1f
+	.long	.LASF2504
+	.byte	0x13
+	.byte	0x1f
+	.byte	0x16
+	.long	0xec1
+	.uleb128 0x1f
+	.long	.LASF2505
+	.byte	0x13
+	.byte	0x20
+	.byte	0x1c
+	.long	0xd2f
+	.byte	0
+	.uleb128 0x18
+	.byte	0x28
+	.byte	0x13
+	.byte	0x1c
+	.byte	0x5
+	.long	0xf0c
+	.uleb128 0x2
+	.long	.LASF2506
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xd
+	.long	0x54b
+	.byte	0
+	.uleb128 0x3e
+	.long	0xecd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2507
+	.byte	0x13
+	.byte	0x25
+	.byte	0x3
+	.long	0xe0e
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x15
+	.byte	0x16
+	.long	0xf42
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	0x107
+	.long	0xf52
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x16
+	.byte	0x26
+	.long	0x104d
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2516
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2521
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2522
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF2523
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF2524
+	.value	0x800
+	.uleb128 0x15
+	.long	.LASF2525
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF2526
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF2527
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF2528
+	.value	0x8000
+	.uleb128 0x13
+	.long	.LASF2529
+	.long	0x10000
+	.uleb128 0x13
+	.long	.LASF2530
+	.long	0x20000
+	.uleb128 0x13
+	.long	.LASF2531
+	.long	0x40000
+	.uleb128 0x13
+	.long	.LASF2532
+	.long	0x80000
+	.uleb128 0x13
+	.long	.LASF2533
+	.long	0x100000
+	.uleb128 0x13
+	.long	.LASF2534
+	.long	0x200000
+	.uleb128 0x13
+	.long	.LASF2535
+	.long	0x400000
+	.uleb128 0x13
+	.long	.LASF2536
+	.long	0x800000
+	.uleb128 0x13
+	.long	.LASF2537
+	.long	0x1000000
+	.uleb128 0x13
+	.long	.LASF2538
+	.long	0x2000000
+	.uleb128 0x13
+	.long	.LASF2539
+	.long	0x4000000
+	.uleb128 0x13
+	.long	.LASF2540
+	.long	0x8000000
+	.uleb128 0x13
+	.long	.LASF2541
+	.long	0x10000000
+	.uleb128 0x13
+	.long	.LASF2542
+	.long	0x20000000
+	.uleb128 0x13
+	.long	.LASF2543
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2544
+	.byte	0x17
+	.byte	0x16
+	.byte	0x48
+	.long	0x10b5
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x16
+	.byte	0x49
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2546
+	.byte	0x16
+	.byte	0x4a
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2547
+	.byte	0x16
+	.byte	0x4b
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0x16
+	.byte	0x4c
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2549
+	.byte	0x16
+	.byte	0x4d
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2550
+	.byte	0x16
+	.byte	0x4e
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x16
+	.byte	0x4f
+	.byte	0xa
+	.long	0x10b5
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.long	0xc6
+	.long	0x10c5
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2552
+	.byte	0x16
+	.byte	0x50
+	.byte	0x3
+	.long	0x104d
+	.uleb128 0xa
+	.long	0x10c5
+	.uleb128 0x9
+	.long	.LASF2553
+	.byte	0x16
+	.byte	0x52
+	.byte	0x17
+	.long	0x10c5
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x17
+	.byte	0x2d
+	.byte	0x5
+	.long	0x112d
+	.uleb128 0x2
+	.long	.LASF2554
+	.byte	0x17
+	.byte	0x2e
+	.byte	0x11
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x17
+	.byte	0x2f
+	.byte	0x11
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2556
+	.byte	0x17
+	.byte	0x30
+	.byte	0x11
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2557
+	.byte	0x17
+	.byte	0x31
+	.byte	0x12
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2558
+	.byte	0x17
+	.byte	0x32
+	.byte	0x12
+	.long	0x11d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x18
+	.byte	0x5
+	.byte	0x17
+	.byte	0x35
+	.byte	0x5
+	.long	0x115e
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x17
+	.byte	0x36
+	.byte	0x11
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2559
+	.byte	0x17
+	.byte	0x37
+	.byte	0x11
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2560
+	.byte	0x17
+	.byte	0x38
+	.byte	0x11
+	.long	0x115e
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x107
+	.long	0x116e
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.byte	0x5
+	.byte	0x17
+	.byte	0x3b
+	.byte	0x5
+	.long	0x119f
+	.uleb128 0x2
+	.long	.LASF2555
+	.byte	0x17
+	.byte	0x3c
+	.byte	0x11
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2559
+	.byte	0x17
+	.byte	0x3d
+	.byte	0x11
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2560
+	.byte	0x17
+	.byte	0x3e
+	.byte	0x11
+	.long	0x115e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.byte	0x1
+	.byte	0x17
+	.byte	0x41
+	.byte	0x5
+	.long	0x11b6
+	.uleb128 0x2
+	.long	.LASF2561
+	.byte	0x17
+	.byte	0x42
+	.byte	0x11
+	.long	0x107
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2562
+	.byte	0x14
+	.byte	0x17
+	.byte	0x2b
+	.long	0x11f7
+	.uleb128 0x2
+	.long	.LASF2563
+	.byte	0x17
+	.byte	0x33
+	.byte	0x7
+	.long	0x10e2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2564
+	.byte	0x17
+	.byte	0x39
+	.byte	0x7
+	.long	0x112d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2565
+	.byte	0x17
+	.byte	0x3f
+	.byte	0x7
+	.long	0x116e
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2566
+	.byte	0x17
+	.byte	0x43
+	.byte	0x7
+	.long	0x119f
+	.byte	0x12
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2567
+	.byte	0x17
+	.byte	0x45
+	.byte	0x3
+	.long	0x11b6
+	.uleb128 0xa
+	.long	0x11f7
+	.uleb128 0x9
+	.long	.LASF2568
+	.byte	0x17
+	.byte	0x49
+	.byte	0x23
+	.long	0x1214
+	.uleb128 0x6
+	.long	0x1203
+	.uleb128 0x1e
+	.long	.LASF2569
+	.long	0x30
+	.byte	0x18
+	.byte	0x18
+	.long	0x125f
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2572
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2579
+	.byte	0x18
+	.byte	0x22
+	.byte	0x3
+	.long	0x1219
+	.uleb128 0x1e
+	.long	.LASF2580
+	.long	0x30
+	.byte	0x19
+	.byte	0x18
+	.long	0x12db
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0x1
+	.uleb128 0x3f
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2589
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2590
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2591
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2592
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2593
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2594
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2595
+	.byte	0xf
+	.byte	0
+	.uleb128 0xe
+	.long	0xde
+	.long	0x12eb
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2596
+	.byte	0x19
+	.byte	0x51
+	.byte	0x10
+	.long	0x12db
+	.uleb128 0x8
+	.long	.LASF2597
+	.byte	0xa
+	.byte	0x19
+	.byte	0x53
+	.long	0x135f
+	.uleb128 0x2
+	.long	.LASF2598
+	.byte	0x19
+	.byte	0x54
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2599
+	.byte	0x19
+	.byte	0x55
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2600
+	.byte	0x19
+	.byte	0x56
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2601
+	.byte	0x19
+	.byte	0x57
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2602
+	.byte	0x19
+	.byte	0x58
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2603
+	.byte	0x19
+	.byte	0x59
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2604
+	.byte	0x19
+	.byte	0x5a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0x19
+	.byte	0x5b
+	.byte	0x3
+	.long	0x12f7
+	.uleb128 0xa
+	.long	0x135f
+	.uleb128 0x9
+	.long	.LASF2606
+	.byte	0x19
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x135f
+	.uleb128 0x3
+	.long	.LASF2607
+	.byte	0x1a
+	.byte	0x1d
+	.byte	0x12
+	.long	0x129
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x1b
+	.byte	0x1c
+	.long	0x1496
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2641
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2645
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2646
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2647
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2648
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2649
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2650
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2651
+	.byte	0x1b
+	.byte	0x48
+	.byte	0x3
+	.long	0x1388
+	.uleb128 0x8
+	.long	.LASF2652
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x4b
+	.long	0x14bc
+	.uleb128 0x2
+	.long	.LASF2653
+	.byte	0x1b
+	.byte	0x4b
+	.byte	0x31
+	.long	0x14bc
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x137c
+	.long	0x14cc
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2654
+	.byte	0x1b
+	.byte	0x4b
+	.byte	0x5a
+	.long	0x14a2
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x1c
+	.byte	0x6c
+	.long	0x159d
+	.uleb128 0x1
+	.long	.LASF2655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2657
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2658
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2659
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2660
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2661
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2662
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2663
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2664
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF2665
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF2666
+	.value	0x800
+	.uleb128 0x15
+	.long	.LASF2667
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF2668
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF2669
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF2670
+	.value	0x8000
+	.uleb128 0x13
+	.long	.LASF2671
+	.long	0x10000
+	.uleb128 0x13
+	.long	.LASF2672
+	.long	0x20000
+	.uleb128 0x13
+	.long	.LASF2673
+	.long	0x40000
+	.uleb128 0x13
+	.long	.LASF2674
+	.long	0x80000
+	.uleb128 0x13
+	.long	.LASF2675
+	.long	0x100000
+	.uleb128 0x13
+	.long	.LASF2676
+	.long	0x200000
+	.uleb128 0x13
+	.long	.LASF2677
+	.long	0x400000
+	.uleb128 0x13
+	.long	.LASF2678
+	.long	0x800000
+	.uleb128 0x13
+	.long	.LASF2679
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2680
+	.byte	0x1c
+	.byte	0x8c
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x1d
+	.byte	0x33
+	.long	0x15e5
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2682
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2689
+	.byte	0x1d
+	.byte	0x70
+	.byte	0x3
+	.long	0x15a9
+	.uleb128 0x18
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x20
+	.byte	0x5
+	.long	0x1622
+	.uleb128 0x2
+	.long	.LASF2690
+	.byte	0x1e
+	.byte	0x22
+	.byte	0x11
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2691
+	.byte	0x1e
+	.byte	0x23
+	.byte	0x11
+	.long	0xde
+	.byte	0x2
+	.uleb128 0xd
+	.string	"yaw"
+	.byte	0x1e
+	.byte	0x24
+	.byte	0x11
+	.long	0xde
+	.byte	0x4
+	.byte	0
+	.uleb128 0x29
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x1e
+	.byte	0x9
+	.long	0x1644
+	.uleb128 0x24
+	.string	"raw"
+	.byte	0x1e
+	.byte	0x1f
+	.byte	0xd
+	.long	0xe75
+	.uleb128 0x1f
+	.long	.LASF2692
+	.byte	0x1e
+	.byte	0x25
+	.byte	0x7
+	.long	0x15f1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2693
+	.byte	0x1e
+	.byte	0x26
+	.byte	0x3
+	.long	0x1622
+	.uleb128 0x9
+	.long	.LASF2694
+	.byte	0x1e
+	.byte	0x29
+	.byte	0x1e
+	.long	0x1644
+	.uleb128 0x8
+	.long	.LASF2695
+	.byte	0x1c
+	.byte	0x1f
+	.byte	0x53
+	.long	0x16eb
+	.uleb128 0x2
+	.long	.LASF2696
+	.byte	0x1f
+	.byte	0x55
+	.byte	0xe
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2697
+	.byte	0x1f
+	.byte	0x56
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2698
+	.byte	0x1f
+	.byte	0x57
+	.byte	0xe
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2699
+	.byte	0x1f
+	.byte	0x58
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2700
+	.byte	0x1f
+	.byte	0x59
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2701
+	.byte	0x1f
+	.byte	0x5a
+	.byte	0xe
+	.long	0x11d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2702
+	.byte	0x1f
+	.byte	0x5b
+	.byte	0xe
+	.long	0x11d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2703
+	.byte	0x1f
+	.byte	0x5c
+	.byte	0xb
+	.long	0x15c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2704
+	.byte	0x1f
+	.byte	0x5d
+	.byte	0xb
+	.long	0x15c
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2705
+	.byte	0x1f
+	.byte	0x5e
+	.byte	0xd
+	.long	0x107
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2706
+	.byte	0x1f
+	.byte	0x5f
+	.byte	0x3
+	.long	0x165c
+	.uleb128 0xa
+	.long	0x16eb
+	.uleb128 0x9
+	.long	.LASF2707
+	.byte	0x1f
+	.byte	0x61
+	.byte	0x16
+	.long	0x16eb
+	.uleb128 0xe
+	.long	0xde
+	.long	0x1718
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2708
+	.byte	0x1f
+	.byte	0x6f
+	.byte	0x10
+	.long	0x1708
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x20
+	.byte	0x39
+	.long	0x1778
+	.uleb128 0x1
+	.long	.LASF2709
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2721
+	.byte	0x4
+	.byte	0x20
+	.byte	0x51
+	.long	0x17b2
+	.uleb128 0xd
+	.string	"P"
+	.byte	0x20
+	.byte	0x52
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0xd
+	.string	"I"
+	.byte	0x20
+	.byte	0x53
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0xd
+	.string	"D"
+	.byte	0x20
+	.byte	0x54
+	.byte	0xd
+	.long	0x107
+	.byte	0x2
+	.uleb128 0xd
+	.string	"FF"
+	.byte	0x20
+	.byte	0x55
+	.byte	0xd
+	.long	0x107
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2722
+	.byte	0x20
+	.byte	0x56
+	.byte	0x3
+	.long	0x1778
+	.uleb128 0x8
+	.long	.LASF2723
+	.byte	0x2c
+	.byte	0x20
+	.byte	0x58
+	.long	0x17d8
+	.uleb128 0xd
+	.string	"pid"
+	.byte	0x20
+	.byte	0x59
+	.byte	0xc
+	.long	0x17d8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x17b2
+	.long	0x17e8
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2724
+	.byte	0x20
+	.byte	0x5a
+	.byte	0x3
+	.long	0x17be
+	.uleb128 0xa
+	.long	0x17e8
+	.uleb128 0x8
+	.long	.LASF2725
+	.byte	0xac
+	.byte	0x20
+	.byte	0x67
+	.long	0x19a6
+	.uleb128 0x2
+	.long	.LASF2726
+	.byte	0x20
+	.byte	0x68
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2727
+	.byte	0x20
+	.byte	0x69
+	.byte	0xf
+	.long	0x17e8
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2728
+	.byte	0x20
+	.byte	0x6a
+	.byte	0xf
+	.long	0x17e8
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF2729
+	.byte	0x20
+	.byte	0x6c
+	.byte	0xd
+	.long	0x107
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF2730
+	.byte	0x20
+	.byte	0x6d
+	.byte	0xe
+	.long	0x11d
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF2731
+	.byte	0x20
+	.byte	0x6f
+	.byte	0xd
+	.long	0x107
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2732
+	.byte	0x20
+	.byte	0x70
+	.byte	0xe
+	.long	0x11d
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF2733
+	.byte	0x20
+	.byte	0x72
+	.byte	0xd
+	.long	0x107
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2734
+	.byte	0x20
+	.byte	0x74
+	.byte	0xd
+	.long	0x107
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF2735
+	.byte	0x20
+	.byte	0x76
+	.byte	0xd
+	.long	0x107
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF2736
+	.byte	0x20
+	.byte	0x78
+	.byte	0xe
+	.long	0x129
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF2737
+	.byte	0x20
+	.byte	0x79
+	.byte	0xe
+	.long	0x129
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2738
+	.byte	0x20
+	.byte	0x7b
+	.byte	0xd
+	.long	0x19a6
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF2739
+	.byte	0x20
+	.byte	0x7d
+	.byte	0xe
+	.long	0x11d
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2740
+	.byte	0x20
+	.byte	0x7e
+	.byte	0xe
+	.long	0x11d
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF2741
+	.byte	0x20
+	.byte	0x81
+	.byte	0xe
+	.long	0x11d
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2742
+	.byte	0x20
+	.byte	0x82
+	.byte	0xb
+	.long	0x15c
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2743
+	.byte	0x20
+	.byte	0x83
+	.byte	0xb
+	.long	0x15c
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF2744
+	.byte	0x20
+	.byte	0x84
+	.byte	0xb
+	.long	0x15c
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2745
+	.byte	0x20
+	.byte	0x86
+	.byte	0xd
+	.long	0x107
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF2746
+	.byte	0x20
+	.byte	0x87
+	.byte	0xb
+	.long	0x15c
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2747
+	.byte	0x20
+	.byte	0x89
+	.byte	0xd
+	.long	0x107
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF2748
+	.byte	0x20
+	.byte	0x8a
+	.byte	0xd
+	.long	0x107
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF2749
+	.byte	0x20
+	.byte	0x8b
+	.byte	0xd
+	.long	0x107
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF2750
+	.byte	0x20
+	.byte	0x8d
+	.byte	0xb
+	.long	0x15c
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF2751
+	.byte	0x20
+	.byte	0x8e
+	.byte	0xb
+	.long	0x15c
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF2752
+	.byte	0x20
+	.byte	0x8f
+	.byte	0xd
+	.long	0x107
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2753
+	.byte	0x20
+	.byte	0x90
+	.byte	0xb
+	.long	0x15c
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF2754
+	.byte	0x20
+	.byte	0x91
+	.byte	0xb
+	.long	0x15c
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF2755
+	.byte	0x20
+	.byte	0x92
+	.byte	0xd
+	.long	0x107
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF2756
+	.byte	0x20
+	.byte	0x94
+	.byte	0xe
+	.long	0x11d
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF2757
+	.byte	0x20
+	.byte	0x95
+	.byte	0xd
+	.long	0x107
+	.byte	0xa8
+	.byte	0
+	.uleb128 0xe
+	.long	0xde
+	.long	0x19b6
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2758
+	.byte	0x20
+	.byte	0x96
+	.byte	0x3
+	.long	0x17f9
+	.uleb128 0xa
+	.long	0x19b6
+	.uleb128 0x9
+	.long	.LASF2759
+	.byte	0x20
+	.byte	0xa0
+	.byte	0x16
+	.long	0x19d3
+	.uleb128 0x6
+	.long	0x19b6
+	.uleb128 0xe
+	.long	0xea
+	.long	0x19e3
+	.uleb128 0x40
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2760
+	.byte	0x20
+	.byte	0xa7
+	.byte	0x10
+	.long	0x19d8
+	.uleb128 0x9
+	.long	.LASF2761
+	.byte	0x20
+	.byte	0xa7
+	.byte	0x1d
+	.long	0x19d8
+	.uleb128 0x9
+	.long	.LASF2762
+	.byte	0x20
+	.byte	0xa7
+	.byte	0x2a
+	.long	0x19d8
+	.uleb128 0x9
+	.long	.LASF2763
+	.byte	0x20
+	.byte	0xa7
+	.byte	0x37
+	.long	0x19d8
+	.uleb128 0xe
+	.long	0xde
+	.long	0x1a23
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2764
+	.byte	0x21
+	.byte	0x92
+	.byte	0x10
+	.long	0x1a13
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x22
+	.byte	0x50
+	.long	0x1a4d
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2768
+	.byte	0x22
+	.byte	0x54
+	.byte	0x3
+	.long	0x1a2f
+	.uleb128 0x8
+	.long	.LASF2769
+	.byte	0xc
+	.byte	0x22
+	.byte	0x6a
+	.long	0x1a8d
+	.uleb128 0xd
+	.string	"lat"
+	.byte	0x22
+	.byte	0x6b
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0xd
+	.string	"lon"
+	.byte	0x22
+	.byte	0x6c
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.uleb128 0xd
+	.string	"alt"
+	.byte	0x22
+	.byte	0x6d
+	.byte	0xd
+	.long	0xea
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2770
+	.byte	0x22
+	.byte	0x6e
+	.byte	0x3
+	.long	0x1a59
+	.uleb128 0x18
+	.byte	0x7
+	.byte	0x22
+	.byte	0x73
+	.byte	0x5
+	.long	0x1afe
+	.uleb128 0x2
+	.long	.LASF2771
+	.byte	0x22
+	.byte	0x74
+	.byte	0xd
+	.long	0x54b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2772
+	.byte	0x22
+	.byte	0x75
+	.byte	0xd
+	.long	0x54b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2773
+	.byte	0x22
+	.byte	0x76
+	.byte	0xd
+	.long	0x54b
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2774
+	.byte	0x22
+	.byte	0x77
+	.byte	0xd
+	.long	0x54b
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2775
+	.byte	0x22
+	.byte	0x78
+	.byte	0xd
+	.long	0x54b
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2776
+	.byte	0x22
+	.byte	0x79
+	.byte	0xd
+	.long	0x54b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2777
+	.byte	0x22
+	.byte	0x7a
+	.byte	0xd
+	.long	0x54b
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2778
+	.byte	0x3c
+	.byte	0x22
+	.byte	0x72
+	.long	0x1ba7
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x22
+	.byte	0x7b
+	.byte	0x7
+	.long	0x1a99
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0x22
+	.byte	0x7d
+	.byte	0x12
+	.long	0x1a4d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2780
+	.byte	0x22
+	.byte	0x7e
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.uleb128 0xd
+	.string	"llh"
+	.byte	0x22
+	.byte	0x80
+	.byte	0x13
+	.long	0x1a8d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2781
+	.byte	0x22
+	.byte	0x81
+	.byte	0xd
+	.long	0xe75
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2782
+	.byte	0x22
+	.byte	0x82
+	.byte	0xd
+	.long	0xe75
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0x22
+	.byte	0x84
+	.byte	0xd
+	.long	0xde
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x22
+	.byte	0x85
+	.byte	0xd
+	.long	0xde
+	.byte	0x2a
+	.uleb128 0xd
+	.string	"eph"
+	.byte	0x22
+	.byte	0x87
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2c
+	.uleb128 0xd
+	.string	"epv"
+	.byte	0x22
+	.byte	0x88
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x22
+	.byte	0x8a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x22
+	.byte	0x8c
+	.byte	0x10
+	.long	0x2e3
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2786
+	.byte	0x22
+	.byte	0x8e
+	.byte	0x3
+	.long	0x1afe
+	.uleb128 0x9
+	.long	.LASF2787
+	.byte	0x22
+	.byte	0x97
+	.byte	0x1a
+	.long	0x1ba7
+	.uleb128 0x8
+	.long	.LASF2788
+	.byte	0xc
+	.byte	0x23
+	.byte	0x1a
+	.long	0x1bf1
+	.uleb128 0x2
+	.long	.LASF2789
+	.byte	0x23
+	.byte	0x1b
+	.byte	0xb
+	.long	0x15c
+	.byte	0
+	.uleb128 0xd
+	.string	"RC"
+	.byte	0x23
+	.byte	0x1c
+	.byte	0xb
+	.long	0x15c
+	.byte	0x4
+	.uleb128 0xd
+	.string	"dT"
+	.byte	0x23
+	.byte	0x1d
+	.byte	0xb
+	.long	0x15c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2790
+	.byte	0x23
+	.byte	0x1e
+	.byte	0x3
+	.long	0x1bbf
+	.uleb128 0x6
+	.long	0x15c
+	.uleb128 0x9
+	.long	.LASF2791
+	.byte	0x24
+	.byte	0x22
+	.byte	0x16
+	.long	0x1a8d
+	.uleb128 0x2a
+	.byte	0x14
+	.byte	0x24
+	.value	0x128
+	.byte	0x9
+	.long	0x1c5b
+	.uleb128 0x20
+	.string	"kP"
+	.byte	0x24
+	.value	0x129
+	.byte	0xb
+	.long	0x15c
+	.byte	0
+	.uleb128 0x20
+	.string	"kI"
+	.byte	0x24
+	.value	0x12a
+	.byte	0xb
+	.long	0x15c
+	.byte	0x4
+	.uleb128 0x20
+	.string	"kD"
+	.byte	0x24
+	.value	0x12b
+	.byte	0xb
+	.long	0x15c
+	.byte	0x8
+	.uleb128 0x20
+	.string	"kT"
+	.byte	0x24
+	.value	0x12c
+	.byte	0xb
+	.long	0x15c
+	.byte	0xc
+	.uleb128 0x20
+	.string	"kFF"
+	.byte	0x24
+	.value	0x12d
+	.byte	0xb
+	.long	0x15c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2792
+	.byte	0x24
+	.value	0x12e
+	.byte	0x3
+	.long	0x1c0e
+	.uleb128 0x2a
+	.byte	0x44
+	.byte	0x24
+	.value	0x134
+	.byte	0x9
+	.long	0x1d0d
+	.uleb128 0x7
+	.long	.LASF2177
+	.byte	0x24
+	.value	0x135
+	.byte	0x9
+	.long	0x54b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2466
+	.byte	0x24
+	.value	0x136
+	.byte	0x1a
+	.long	0x1c5b
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF2793
+	.byte	0x24
+	.value	0x137
+	.byte	0x11
+	.long	0x1bf1
+	.byte	0x18
+	.uleb128 0x7
+	.long	.LASF2794
+	.byte	0x24
+	.value	0x138
+	.byte	0xb
+	.long	0x15c
+	.byte	0x24
+	.uleb128 0x7
+	.long	.LASF2795
+	.byte	0x24
+	.value	0x139
+	.byte	0xb
+	.long	0x15c
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF2796
+	.byte	0x24
+	.value	0x13a
+	.byte	0xb
+	.long	0x15c
+	.byte	0x2c
+	.uleb128 0x7
+	.long	.LASF2797
+	.byte	0x24
+	.value	0x13c
+	.byte	0xb
+	.long	0x15c
+	.byte	0x30
+	.uleb128 0x7
+	.long	.LASF2798
+	.byte	0x24
+	.value	0x13d
+	.byte	0xb
+	.long	0x15c
+	.byte	0x34
+	.uleb128 0x7
+	.long	.LASF2799
+	.byte	0x24
+	.value	0x13e
+	.byte	0xb
+	.long	0x15c
+	.byte	0x38
+	.uleb128 0x7
+	.long	.LASF2800
+	.byte	0x24
+	.value	0x13f
+	.byte	0xb
+	.long	0x15c
+	.byte	0x3c
+	.uleb128 0x7
+	.long	.LASF2801
+	.byte	0x24
+	.value	0x140
+	.byte	0xb
+	.long	0x15c
+	.byte	0x40
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2802
+	.byte	0x24
+	.value	0x141
+	.byte	0x3
+	.long	0x1c68
+	.uleb128 0x2b
+	.long	.LASF2803
+	.value	0x2a8
+	.byte	0x24
+	.value	0x143
+	.long	0x1d81
+	.uleb128 0x20
+	.string	"pos"
+	.byte	0x24
+	.value	0x145
+	.byte	0x15
+	.long	0x1d81
+	.byte	0
+	.uleb128 0x20
+	.string	"vel"
+	.byte	0x24
+	.value	0x146
+	.byte	0x15
+	.long	0x1d81
+	.byte	0xcc
+	.uleb128 0x11
+	.long	.LASF2804
+	.byte	0x24
+	.value	0x147
+	.byte	0x15
+	.long	0x1d0d
+	.value	0x198
+	.uleb128 0x11
+	.long	.LASF2805
+	.byte	0x24
+	.value	0x14a
+	.byte	0x15
+	.long	0x1d0d
+	.value	0x1dc
+	.uleb128 0x11
+	.long	.LASF2806
+	.byte	0x24
+	.value	0x14b
+	.byte	0x15
+	.long	0x1d0d
+	.value	0x220
+	.uleb128 0x11
+	.long	.LASF2807
+	.byte	0x24
+	.value	0x14c
+	.byte	0x15
+	.long	0x1d0d
+	.value	0x264
+	.byte	0
+	.uleb128 0xe
+	.long	0x1d0d
+	.long	0x1d91
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2808
+	.byte	0x24
+	.value	0x14d
+	.byte	0x3
+	.long	0x1d1a
+	.uleb128 0xa
+	.long	0x1d91
+	.uleb128 0x1c
+	.long	.LASF2809
+	.byte	0x24
+	.value	0x206
+	.byte	0x10
+	.long	0xde
+	.uleb128 0x1c
+	.long	.LASF2810
+	.byte	0x24
+	.value	0x207
+	.byte	0x10
+	.long	0xe75
+	.uleb128 0x1c
+	.long	.LASF2811
+	.byte	0x24
+	.value	0x208
+	.byte	0x10
+	.long	0xe75
+	.uleb128 0xe
+	.long	0xea
+	.long	0x1dda
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2812
+	.byte	0x24
+	.value	0x209
+	.byte	0x10
+	.long	0x1dca
+	.uleb128 0x1c
+	.long	.LASF2813
+	.byte	0x24
+	.value	0x20a
+	.byte	0x10
+	.long	0x1dca
+	.uleb128 0x1c
+	.long	.LASF2814
+	.byte	0x24
+	.value	0x20b
+	.byte	0x10
+	.long	0xde
+	.uleb128 0x1c
+	.long	.LASF2815
+	.byte	0x24
+	.value	0x20c
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x1c
+	.long	.LASF2816
+	.byte	0x24
+	.value	0x20d
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x1c
+	.long	.LASF2817
+	.byte	0x24
+	.value	0x20e
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x1c
+	.long	.LASF2818
+	.byte	0x24
+	.value	0x20f
+	.byte	0x10
+	.long	0xe75
+	.uleb128 0x8
+	.long	.LASF2819
+	.byte	0x28
+	.byte	0x25
+	.byte	0x6a
+	.long	0x1f53
+	.uleb128 0x2
+	.long	.LASF2820
+	.byte	0x25
+	.byte	0x6b
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2821
+	.byte	0x25
+	.byte	0x6c
+	.byte	0xd
+	.long	0xf42
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2822
+	.byte	0x25
+	.byte	0x6d
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2823
+	.byte	0x25
+	.byte	0x6e
+	.byte	0xd
+	.long	0x107
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2824
+	.byte	0x25
+	.byte	0x6f
+	.byte	0xd
+	.long	0x107
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2825
+	.byte	0x25
+	.byte	0x70
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2826
+	.byte	0x25
+	.byte	0x71
+	.byte	0xe
+	.long	0x129
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2827
+	.byte	0x25
+	.byte	0x72
+	.byte	0xd
+	.long	0x107
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2828
+	.byte	0x25
+	.byte	0x73
+	.byte	0xd
+	.long	0x107
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2829
+	.byte	0x25
+	.byte	0x74
+	.byte	0xd
+	.long	0x107
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2830
+	.byte	0x25
+	.byte	0x75
+	.byte	0xd
+	.long	0x107
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2831
+	.byte	0x25
+	.byte	0x76
+	.byte	0xd
+	.long	0x107
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2832
+	.byte	0x25
+	.byte	0x77
+	.byte	0xd
+	.long	0x107
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2833
+	.byte	0x25
+	.byte	0x78
+	.byte	0xe
+	.long	0x11d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2834
+	.byte	0x25
+	.byte	0x79
+	.byte	0xe
+	.long	0x11d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2835
+	.byte	0x25
+	.byte	0x7a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2836
+	.byte	0x25
+	.byte	0x7b
+	.byte	0xe
+	.long	0x11d
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2837
+	.byte	0x25
+	.byte	0x7c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2838
+	.byte	0x25
+	.byte	0x7d
+	.byte	0xd
+	.long	0x107
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2839
+	.byte	0x25
+	.byte	0x7e
+	.byte	0xe
+	.long	0x11d
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2840
+	.byte	0x25
+	.byte	0x7f
+	.byte	0xd
+	.long	0x107
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2841
+	.byte	0x25
+	.byte	0x80
+	.byte	0x3
+	.long	0x1e35
+	.uleb128 0xa
+	.long	0x1f53
+	.uleb128 0x9
+	.long	.LASF2842
+	.byte	0x25
+	.byte	0x82
+	.byte	0x13
+	.long	0x1f53
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x25
+	.byte	0xa6
+	.long	0x1fa0
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2849
+	.byte	0x25
+	.byte	0xad
+	.byte	0x3
+	.long	0x1f70
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x26
+	.byte	0x8
+	.long	0x1fd0
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2854
+	.byte	0x26
+	.byte	0xd
+	.byte	0x3
+	.long	0x1fac
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x27
+	.byte	0x14
+	.long	0x2018
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2863
+	.byte	0x6
+	.byte	0x27
+	.byte	0x1f
+	.long	0x204c
+	.uleb128 0x2
+	.long	.LASF2690
+	.byte	0x27
+	.byte	0x20
+	.byte	0xd
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2691
+	.byte	0x27
+	.byte	0x21
+	.byte	0xd
+	.long	0xde
+	.byte	0x2
+	.uleb128 0xd
+	.string	"yaw"
+	.byte	0x27
+	.byte	0x22
+	.byte	0xd
+	.long	0xde
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2864
+	.byte	0x27
+	.byte	0x23
+	.byte	0x3
+	.long	0x2018
+	.uleb128 0x2f
+	.long	.LASF2866
+	.byte	0x6
+	.byte	0x27
+	.byte	0x25
+	.long	0x207d
+	.uleb128 0x24
+	.string	"raw"
+	.byte	0x27
+	.byte	0x26
+	.byte	0xd
+	.long	0xe75
+	.uleb128 0x1f
+	.long	.LASF2692
+	.byte	0x27
+	.byte	0x27
+	.byte	0x1f
+	.long	0x204c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2867
+	.byte	0x27
+	.byte	0x28
+	.byte	0x3
+	.long	0x2058
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x27
+	.byte	0x30
+	.long	0x20d3
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2874
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2875
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF2876
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF2877
+	.value	0x200
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x28
+	.byte	0x34
+	.byte	0x9
+	.long	0x20f7
+	.uleb128 0xd
+	.string	"min"
+	.byte	0x28
+	.byte	0x35
+	.byte	0xb
+	.long	0x15c
+	.byte	0
+	.uleb128 0xd
+	.string	"max"
+	.byte	0x28
+	.byte	0x36
+	.byte	0xb
+	.long	0x15c
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2878
+	.byte	0x28
+	.byte	0x37
+	.byte	0x3
+	.long	0x20d3
+	.uleb128 0x8
+	.long	.LASF2879
+	.byte	0x68
+	.byte	0x28
+	.byte	0x39
+	.long	0x2178
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x28
+	.byte	0x3a
+	.byte	0xe
+	.long	0xe8a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2880
+	.byte	0x28
+	.byte	0x3b
+	.byte	0xe
+	.long	0x129
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2881
+	.byte	0x28
+	.byte	0x3c
+	.byte	0xb
+	.long	0x833
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2882
+	.byte	0x28
+	.byte	0x3d
+	.byte	0xb
+	.long	0x833
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2883
+	.byte	0x28
+	.byte	0x3e
+	.byte	0xe
+	.long	0x129
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2884
+	.byte	0x28
+	.byte	0x3f
+	.byte	0x9
+	.long	0x54b
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2885
+	.byte	0x28
+	.byte	0x40
+	.byte	0x14
+	.long	0x2178
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF2886
+	.byte	0x28
+	.byte	0x41
+	.byte	0xb
+	.long	0x15c
+	.byte	0x64
+	.byte	0
+	.uleb128 0xe
+	.long	0x20f7
+	.long	0x2188
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2887
+	.byte	0x28
+	.byte	0x42
+	.byte	0x3
+	.long	0x2103
+	.uleb128 0x31
+	.string	"acc"
+	.byte	0x28
+	.byte	0x44
+	.long	0x2188
+	.uleb128 0x8
+	.long	.LASF2888
+	.byte	0x18
+	.byte	0x28
+	.byte	0x46
+	.long	0x2214
+	.uleb128 0x2
+	.long	.LASF2889
+	.byte	0x28
+	.byte	0x47
+	.byte	0x14
+	.long	0xd2f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2890
+	.byte	0x28
+	.byte	0x48
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2891
+	.byte	0x28
+	.byte	0x49
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2892
+	.byte	0x28
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x207d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2893
+	.byte	0x28
+	.byte	0x4b
+	.byte	0x1b
+	.long	0x207d
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2894
+	.byte	0x28
+	.byte	0x4c
+	.byte	0xd
+	.long	0x107
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2895
+	.byte	0x28
+	.byte	0x4d
+	.byte	0xd
+	.long	0x107
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2896
+	.byte	0x28
+	.byte	0x4e
+	.byte	0xd
+	.long	0x107
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2897
+	.byte	0x28
+	.byte	0x4f
+	.byte	0x3
+	.long	0x219f
+	.uleb128 0xa
+	.long	0x2214
+	.uleb128 0x9
+	.long	.LASF2898
+	.byte	0x28
+	.byte	0x51
+	.byte	0x1e
+	.long	0x2214
+	.uleb128 0x3
+	.long	.LASF2899
+	.byte	0x29
+	.byte	0x17
+	.byte	0xf
+	.long	0x223d
+	.uleb128 0x6
+	.long	0x2242
+	.uleb128 0x23
+	.long	0x54b
+	.long	0x2251
+	.uleb128 0x5
+	.long	0x2251
+	.byte	0
+	.uleb128 0x6
+	.long	0x2256
+	.uleb128 0x8
+	.long	.LASF2900
+	.byte	0x38
+	.byte	0x29
+	.byte	0x1a
+	.long	0x22cb
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x29
+	.byte	0x1b
+	.byte	0x13
+	.long	0xe85
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2901
+	.byte	0x29
+	.byte	0x1c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2902
+	.byte	0x29
+	.byte	0x1d
+	.byte	0xe
+	.long	0x11d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2903
+	.byte	0x29
+	.byte	0x1e
+	.byte	0x13
+	.long	0x2231
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2904
+	.byte	0x29
+	.byte	0x1f
+	.byte	0x13
+	.long	0x2231
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2905
+	.byte	0x29
+	.byte	0x20
+	.byte	0x13
+	.long	0x2231
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2906
+	.byte	0x29
+	.byte	0x21
+	.byte	0x13
+	.long	0x2231
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2907
+	.byte	0x29
+	.byte	0x22
+	.byte	0x1a
+	.long	0x22cb
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2908
+	.byte	0x29
+	.byte	0x18
+	.byte	0xf
+	.long	0x22d7
+	.uleb128 0x6
+	.long	0x22dc
+	.uleb128 0x23
+	.long	0x54b
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x2251
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x22f5
+	.byte	0
+	.uleb128 0x6
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF2909
+	.byte	0x29
+	.byte	0x23
+	.byte	0x3
+	.long	0x2256
+	.uleb128 0x8
+	.long	.LASF2910
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x27
+	.long	0x233a
+	.uleb128 0x2
+	.long	.LASF2911
+	.byte	0x2a
+	.byte	0x28
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2912
+	.byte	0x2a
+	.byte	0x29
+	.byte	0xd
+	.long	0x107
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2913
+	.byte	0x2a
+	.byte	0x2a
+	.byte	0xe
+	.long	0x11d
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2914
+	.byte	0x2a
+	.byte	0x2b
+	.byte	0x3
+	.long	0x2306
+	.uleb128 0xa
+	.long	0x233a
+	.uleb128 0x9
+	.long	.LASF2915
+	.byte	0x2a
+	.byte	0x2d
+	.byte	0x1a
+	.long	0x233a
+	.uleb128 0x8
+	.long	.LASF2916
+	.byte	0x48
+	.byte	0x2a
+	.byte	0x2f
+	.long	0x2398
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x2a
+	.byte	0x30
+	.byte	0xf
+	.long	0x22fa
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2917
+	.byte	0x2a
+	.byte	0x31
+	.byte	0xd
+	.long	0xea
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2918
+	.byte	0x2a
+	.byte	0x32
+	.byte	0xd
+	.long	0xea
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2919
+	.byte	0x2a
+	.byte	0x33
+	.byte	0xd
+	.long	0xea
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2920
+	.byte	0x2a
+	.byte	0x34
+	.byte	0x3
+	.long	0x2357
+	.uleb128 0x9
+	.long	.LASF2921
+	.byte	0x2a
+	.byte	0x36
+	.byte	0xf
+	.long	0x2398
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x2b
+	.byte	0x29
+	.long	0x23da
+	.uleb128 0x1
+	.long	.LASF2922
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2923
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2924
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2925
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2926
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2927
+	.byte	0x2b
+	.byte	0x2f
+	.byte	0x3
+	.long	0x23b0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x2b
+	.byte	0x31
+	.long	0x2404
+	.uleb128 0x1
+	.long	.LASF2928
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2929
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2930
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2931
+	.byte	0x2b
+	.byte	0x35
+	.byte	0x3
+	.long	0x23e6
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x2b
+	.byte	0x37
+	.long	0x2428
+	.uleb128 0x1
+	.long	.LASF2932
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2933
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2934
+	.byte	0x2b
+	.byte	0x3a
+	.byte	0x3
+	.long	0x2410
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x2b
+	.byte	0x41
+	.long	0x244c
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2937
+	.byte	0x2b
+	.byte	0x44
+	.byte	0x3
+	.long	0x2434
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x48
+	.byte	0x5
+	.long	0x247c
+	.uleb128 0x2
+	.long	.LASF2938
+	.byte	0x2b
+	.byte	0x49
+	.byte	0x12
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2939
+	.byte	0x2b
+	.byte	0x4a
+	.byte	0x19
+	.long	0x2404
+	.byte	0x4
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x4d
+	.byte	0x5
+	.long	0x24ad
+	.uleb128 0x2
+	.long	.LASF2938
+	.byte	0x2b
+	.byte	0x4e
+	.byte	0x11
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2940
+	.byte	0x2b
+	.byte	0x4f
+	.byte	0x11
+	.long	0xde
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2939
+	.byte	0x2b
+	.byte	0x50
+	.byte	0x19
+	.long	0x23da
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2941
+	.byte	0x20
+	.byte	0x2b
+	.byte	0x46
+	.long	0x2515
+	.uleb128 0x2
+	.long	.LASF2942
+	.byte	0x2b
+	.byte	0x4b
+	.byte	0x7
+	.long	0x2458
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2943
+	.byte	0x2b
+	.byte	0x51
+	.byte	0x7
+	.long	0x247c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2944
+	.byte	0x2b
+	.byte	0x53
+	.byte	0x18
+	.long	0x244c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2945
+	.byte	0x2b
+	.byte	0x55
+	.byte	0xe
+	.long	0x129
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2946
+	.byte	0x2b
+	.byte	0x56
+	.byte	0xe
+	.long	0x11d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2947
+	.byte	0x2b
+	.byte	0x57
+	.byte	0xd
+	.long	0x107
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2948
+	.byte	0x2b
+	.byte	0x59
+	.byte	0xb
+	.long	0x15c
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2949
+	.byte	0x2b
+	.byte	0x5b
+	.byte	0x3
+	.long	0x24ad
+	.uleb128 0xa
+	.long	0x2515
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x61
+	.byte	0x5
+	.long	0x2564
+	.uleb128 0x2
+	.long	.LASF2950
+	.byte	0x2b
+	.byte	0x62
+	.byte	0x12
+	.long	0x11d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2951
+	.byte	0x2b
+	.byte	0x63
+	.byte	0x12
+	.long	0x11d
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2952
+	.byte	0x2b
+	.byte	0x64
+	.byte	0x12
+	.long	0x11d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2953
+	.byte	0x2b
+	.byte	0x65
+	.byte	0x12
+	.long	0x11d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x68
+	.byte	0x5
+	.long	0x25a2
+	.uleb128 0x2
+	.long	.LASF2954
+	.byte	0x2b
+	.byte	0x69
+	.byte	0x12
+	.long	0x129
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2955
+	.byte	0x2b
+	.byte	0x6a
+	.byte	0x12
+	.long	0x129
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2956
+	.byte	0x2b
+	.byte	0x6b
+	.byte	0x12
+	.long	0x129
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2957
+	.byte	0x2b
+	.byte	0x6c
+	.byte	0x1b
+	.long	0x2428
+	.byte	0xc
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2958
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0x5d
+	.long	0x25d6
+	.uleb128 0x2
+	.long	.LASF2959
+	.byte	0x2b
+	.byte	0x5f
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2942
+	.byte	0x2b
+	.byte	0x66
+	.byte	0x7
+	.long	0x2526
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2960
+	.byte	0x2b
+	.byte	0x6d
+	.byte	0x7
+	.long	0x2564
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2961
+	.byte	0x2b
+	.byte	0x6f
+	.byte	0x3
+	.long	0x25a2
+	.uleb128 0xa
+	.long	0x25d6
+	.uleb128 0x9
+	.long	.LASF2962
+	.byte	0x2b
+	.byte	0x71
+	.byte	0x1e
+	.long	0x2515
+	.uleb128 0x9
+	.long	.LASF2963
+	.byte	0x2b
+	.byte	0x74
+	.byte	0x20
+	.long	0x25ff
+	.uleb128 0x6
+	.long	0x25e2
+	.uleb128 0x8
+	.long	.LASF2964
+	.byte	0x58
+	.byte	0x2c
+	.byte	0x30
+	.long	0x262b
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x2c
+	.byte	0x31
+	.byte	0xe
+	.long	0xf0c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2965
+	.byte	0x2c
+	.byte	0x32
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x48
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2966
+	.byte	0x2c
+	.byte	0x33
+	.byte	0x3
+	.long	0x2604
+	.uleb128 0x31
+	.string	"mag"
+	.byte	0x2c
+	.byte	0x35
+	.long	0x262b
+	.uleb128 0x8
+	.long	.LASF2967
+	.byte	0x18
+	.byte	0x2c
+	.byte	0x37
+	.long	0x26c4
+	.uleb128 0x2
+	.long	.LASF2968
+	.byte	0x2c
+	.byte	0x38
+	.byte	0xd
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2969
+	.byte	0x2c
+	.byte	0x3a
+	.byte	0x14
+	.long	0xd2f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2970
+	.byte	0x2c
+	.byte	0x3b
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2971
+	.byte	0x2c
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x207d
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2972
+	.byte	0x2c
+	.byte	0x3d
+	.byte	0xd
+	.long	0x107
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2973
+	.byte	0x2c
+	.byte	0x3e
+	.byte	0xd
+	.long	0x107
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2974
+	.byte	0x2c
+	.byte	0x3f
+	.byte	0xd
+	.long	0xde
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2975
+	.byte	0x2c
+	.byte	0x40
+	.byte	0xd
+	.long	0xde
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2976
+	.byte	0x2c
+	.byte	0x41
+	.byte	0xd
+	.long	0xde
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2977
+	.byte	0x2c
+	.byte	0x42
+	.byte	0x3
+	.long	0x2642
+	.uleb128 0xa
+	.long	0x26c4
+	.uleb128 0x9
+	.long	.LASF2978
+	.byte	0x2c
+	.byte	0x44
+	.byte	0x18
+	.long	0x26c4
+	.uleb128 0x8
+	.long	.LASF2979
+	.byte	0x28
+	.byte	0x2d
+	.byte	0x3b
+	.long	0x2756
+	.uleb128 0x2
+	.long	.LASF2980
+	.byte	0x2d
+	.byte	0x3c
+	.byte	0x9
+	.long	0x54b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2981
+	.byte	0x2d
+	.byte	0x3d
+	.byte	0xe
+	.long	0x129
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2982
+	.byte	0x2d
+	.byte	0x3e
+	.byte	0xe
+	.long	0x129
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2983
+	.byte	0x2d
+	.byte	0x3f
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2984
+	.byte	0x2d
+	.byte	0x40
+	.byte	0x9
+	.long	0x54b
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2985
+	.byte	0x2d
+	.byte	0x41
+	.byte	0xe
+	.long	0x26f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2986
+	.byte	0x2d
+	.byte	0x42
+	.byte	0x11
+	.long	0x257
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2987
+	.byte	0x2d
+	.byte	0x43
+	.byte	0xb
+	.long	0x833
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2988
+	.byte	0x2d
+	.byte	0x44
+	.byte	0x3
+	.long	0x26e1
+	.uleb128 0x9
+	.long	.LASF2989
+	.byte	0x2d
+	.byte	0x46
+	.byte	0xf
+	.long	0x2756
+	.uleb128 0x8
+	.long	.LASF2990
+	.byte	0x28
+	.byte	0x2d
+	.byte	0x48
+	.long	0x28a6
+	.uleb128 0x2
+	.long	.LASF2991
+	.byte	0x2d
+	.byte	0x49
+	.byte	0x14
+	.long	0xd2f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2992
+	.byte	0x2d
+	.byte	0x4a
+	.byte	0xd
+	.long	0x107
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2993
+	.byte	0x2d
+	.byte	0x4b
+	.byte	0xd
+	.long	0x107
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2994
+	.byte	0x2d
+	.byte	0x4c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2983
+	.byte	0x2d
+	.byte	0x4d
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2995
+	.byte	0x2d
+	.byte	0x4e
+	.byte	0xd
+	.long	0x107
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2996
+	.byte	0x2d
+	.byte	0x4f
+	.byte	0xd
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2997
+	.byte	0x2d
+	.byte	0x50
+	.byte	0xd
+	.long	0x107
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2998
+	.byte	0x2d
+	.byte	0x51
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2999
+	.byte	0x2d
+	.byte	0x52
+	.byte	0xe
+	.long	0x11d
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3000
+	.byte	0x2d
+	.byte	0x53
+	.byte	0xe
+	.long	0x11d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3001
+	.byte	0x2d
+	.byte	0x54
+	.byte	0xe
+	.long	0x11d
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3002
+	.byte	0x2d
+	.byte	0x55
+	.byte	0xd
+	.long	0x107
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3003
+	.byte	0x2d
+	.byte	0x56
+	.byte	0xd
+	.long	0x107
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3004
+	.byte	0x2d
+	.byte	0x57
+	.byte	0xe
+	.long	0x11d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3005
+	.byte	0x2d
+	.byte	0x58
+	.byte	0xe
+	.long	0x11d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3006
+	.byte	0x2d
+	.byte	0x59
+	.byte	0xd
+	.long	0x107
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3007
+	.byte	0x2d
+	.byte	0x5a
+	.byte	0xd
+	.long	0x107
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF3008
+	.byte	0x2d
+	.byte	0x5b
+	.byte	0xd
+	.long	0x107
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3009
+	.byte	0x2d
+	.byte	0x5c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3010
+	.byte	0x2d
+	.byte	0x5d
+	.byte	0xe
+	.long	0x11d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3011
+	.byte	0x2d
+	.byte	0x5e
+	.byte	0xe
+	.long	0x11d
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3012
+	.byte	0x2d
+	.byte	0x5f
+	.byte	0xd
+	.long	0x107
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3013
+	.byte	0x2d
+	.byte	0x60
+	.byte	0x3
+	.long	0x276e
+	.uleb128 0xa
+	.long	0x28a6
+	.uleb128 0x9
+	.long	.LASF3014
+	.byte	0x2d
+	.byte	0x62
+	.byte	0x15
+	.long	0x28a6
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x2e
+	.byte	0x23
+	.long	0x28e7
+	.uleb128 0x1
+	.long	.LASF3015
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3016
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3017
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3018
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3019
+	.byte	0x2e
+	.byte	0x28
+	.byte	0x3
+	.long	0x28c3
+	.uleb128 0x18
+	.byte	0x18
+	.byte	0x2e
+	.byte	0x2a
+	.byte	0x9
+	.long	0x294b
+	.uleb128 0x2
+	.long	.LASF2789
+	.byte	0x2e
+	.byte	0x2b
+	.byte	0x1c
+	.long	0x28e7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3020
+	.byte	0x2e
+	.byte	0x2c
+	.byte	0xe
+	.long	0x263
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3021
+	.byte	0x2e
+	.byte	0x2d
+	.byte	0xe
+	.long	0x263
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3022
+	.byte	0x2e
+	.byte	0x2e
+	.byte	0x1c
+	.long	0x54b
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3023
+	.byte	0x2e
+	.byte	0x2f
+	.byte	0xe
+	.long	0x30
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3024
+	.byte	0x2e
+	.byte	0x30
+	.byte	0xb
+	.long	0x15c
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3025
+	.byte	0x2e
+	.byte	0x31
+	.byte	0x3
+	.long	0x28f3
+	.uleb128 0x18
+	.byte	0x18
+	.byte	0x2e
+	.byte	0x33
+	.byte	0x9
+	.long	0x297b
+	.uleb128 0x2
+	.long	.LASF3026
+	.byte	0x2e
+	.byte	0x34
+	.byte	0xb
+	.long	0x15c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3027
+	.byte	0x2e
+	.byte	0x35
+	.byte	0xd
+	.long	0x891
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3028
+	.byte	0x2e
+	.byte	0x36
+	.byte	0x3
+	.long	0x2957
+	.uleb128 0x18
+	.byte	0x30
+	.byte	0x2e
+	.byte	0x38
+	.byte	0x9
+	.long	0x29ab
+	.uleb128 0x2
+	.long	.LASF3029
+	.byte	0x2e
+	.byte	0x39
+	.byte	0x1d
+	.long	0x294b
+	.byte	0
+	.uleb128 0xd
+	.string	"val"
+	.byte	0x2e
+	.byte	0x3a
+	.byte	0x1c
+	.long	0x297b
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3030
+	.byte	0x2e
+	.byte	0x3b
+	.byte	0x3
+	.long	0x2987
+	.uleb128 0x3
+	.long	.LASF3031
+	.byte	0x2f
+	.byte	0x17
+	.byte	0xf
+	.long	0x29c3
+	.uleb128 0x6
+	.long	0x29c8
+	.uleb128 0x23
+	.long	0x54b
+	.long	0x29d7
+	.uleb128 0x5
+	.long	0x29d7
+	.byte	0
+	.uleb128 0x6
+	.long	0x29dc
+	.uleb128 0x8
+	.long	.LASF3032
+	.byte	0x28
+	.byte	0x2f
+	.byte	0x1a
+	.long	0x2a2a
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x2f
+	.byte	0x1b
+	.byte	0x13
+	.long	0xe85
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3033
+	.byte	0x2f
+	.byte	0x1c
+	.byte	0xe
+	.long	0x11d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3034
+	.byte	0x2f
+	.byte	0x1d
+	.byte	0x14
+	.long	0x29b7
+	.byte	0x10
+	.uleb128 0xd
+	.string	"get"
+	.byte	0x2f
+	.byte	0x1e
+	.byte	0x14
+	.long	0x29b7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2907
+	.byte	0x2f
+	.byte	0x1f
+	.byte	0x1b
+	.long	0x2a2a
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3035
+	.byte	0x2f
+	.byte	0x18
+	.byte	0x10
+	.long	0x2a36
+	.uleb128 0x6
+	.long	0x2a3b
+	.uleb128 0x28
+	.long	0x2a50
+	.uleb128 0x5
+	.long	0x29d7
+	.uleb128 0x5
+	.long	0x1bfd
+	.uleb128 0x5
+	.long	0x1bfd
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3036
+	.byte	0x2f
+	.byte	0x20
+	.byte	0x3
+	.long	0x29dc
+	.uleb128 0x8
+	.long	.LASF3037
+	.byte	0x80
+	.byte	0x30
+	.byte	0x2e
+	.long	0x2ad1
+	.uleb128 0xd
+	.string	"dev"
+	.byte	0x30
+	.byte	0x2f
+	.byte	0x10
+	.long	0x2a50
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3038
+	.byte	0x30
+	.byte	0x30
+	.byte	0xb
+	.long	0x15c
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3039
+	.byte	0x30
+	.byte	0x32
+	.byte	0x1d
+	.long	0x29ab
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF3040
+	.byte	0x30
+	.byte	0x33
+	.byte	0x11
+	.long	0x1bf1
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF3041
+	.byte	0x30
+	.byte	0x34
+	.byte	0xe
+	.long	0x26f
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF3042
+	.byte	0x30
+	.byte	0x35
+	.byte	0xe
+	.long	0x263
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF3043
+	.byte	0x30
+	.byte	0x37
+	.byte	0xb
+	.long	0x15c
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF3044
+	.byte	0x30
+	.byte	0x38
+	.byte	0xb
+	.long	0x15c
+	.byte	0x78
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3045
+	.byte	0x30
+	.byte	0x39
+	.byte	0x3
+	.long	0x2a5c
+	.uleb128 0x9
+	.long	.LASF3046
+	.byte	0x30
+	.byte	0x40
+	.byte	0x10
+	.long	0x2ad1
+	.uleb128 0x9
+	.long	.LASF3047
+	.byte	0x31
+	.byte	0x63
+	.byte	0x1f
+	.long	0x666
+	.uleb128 0x32
+	.long	0x66b
+	.byte	0x63
+	.byte	0x50
+	.uleb128 0x32
+	.long	0x677
+	.byte	0x63
+	.byte	0x78
+	.uleb128 0x9
+	.long	.LASF3048
+	.byte	0x31
+	.byte	0x63
+	.byte	0xa7
+	.long	0x252
+	.uleb128 0x41
+	.long	0x2b03
+	.byte	0xd3
+	.uleb128 0x42
+	.long	0x2ae9
+	.byte	0x65
+	.byte	0x18
+	.uleb128 0x43
+	.long	.LASF3317
+	.byte	0x31
+	.byte	0x6e
+	.byte	0x16
+	.long	0xf6
+	.value	0x1000
+	.uleb128 0xe
+	.long	0xcd
+	.long	0x2b3a
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x4e
+	.byte	0
+	.uleb128 0xa
+	.long	0x2b2a
+	.uleb128 0x2c
+	.long	.LASF3049
+	.byte	0x78
+	.byte	0x13
+	.long	0x2b3a
+	.uleb128 0xe
+	.long	0x157
+	.long	0x2b5a
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0xa
+	.long	0x2b4a
+	.uleb128 0x2c
+	.long	.LASF3050
+	.byte	0x7c
+	.byte	0x1a
+	.long	0x2b5a
+	.uleb128 0x8
+	.long	.LASF3051
+	.byte	0x10
+	.byte	0x31
+	.byte	0x86
+	.long	0x2b9e
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x31
+	.byte	0x87
+	.byte	0x11
+	.long	0x152
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x31
+	.byte	0x89
+	.byte	0xc
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0xd
+	.string	"arr"
+	.byte	0x31
+	.byte	0x8c
+	.byte	0xd
+	.long	0x2b9e
+	.byte	0x9
+	.byte	0
+	.uleb128 0xe
+	.long	0x107
+	.long	0x2bae
+	.uleb128 0xc
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3053
+	.byte	0x31
+	.byte	0x8d
+	.byte	0x3
+	.long	0x2b6a
+	.uleb128 0xa
+	.long	0x2bae
+	.uleb128 0x8
+	.long	.LASF3054
+	.byte	0x10
+	.byte	0x31
+	.byte	0x93
+	.long	0x2c0d
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x31
+	.byte	0x94
+	.byte	0x11
+	.long	0x152
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x31
+	.byte	0x95
+	.byte	0xc
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3055
+	.byte	0x31
+	.byte	0x97
+	.byte	0xd
+	.long	0x107
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3056
+	.byte	0x31
+	.byte	0x98
+	.byte	0xd
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3057
+	.byte	0x31
+	.byte	0x99
+	.byte	0xd
+	.long	0x107
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3058
+	.byte	0x31
+	.byte	0x9a
+	.byte	0x3
+	.long	0x2bbf
+	.uleb128 0xa
+	.long	0x2c0d
+	.uleb128 0x8
+	.long	.LASF3059
+	.byte	0x10
+	.byte	0x31
+	.byte	0x9c
+	.long	0x2c79
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x31
+	.byte	0x9d
+	.byte	0x11
+	.long	0x152
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x31
+	.byte	0x9e
+	.byte	0xc
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3055
+	.byte	0x31
+	.byte	0xa0
+	.byte	0xd
+	.long	0x107
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3056
+	.byte	0x31
+	.byte	0xa1
+	.byte	0xd
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3057
+	.byte	0x31
+	.byte	0xa2
+	.byte	0xd
+	.long	0x107
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3060
+	.byte	0x31
+	.byte	0xa3
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3061
+	.byte	0x31
+	.byte	0xa4
+	.byte	0x3
+	.long	0x2c1e
+	.uleb128 0xa
+	.long	0x2c79
+	.uleb128 0x8
+	.long	.LASF3062
+	.byte	0x10
+	.byte	0x31
+	.byte	0xa6
+	.long	0x2cff
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x31
+	.byte	0xa7
+	.byte	0x11
+	.long	0x152
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3052
+	.byte	0x31
+	.byte	0xa8
+	.byte	0xc
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3055
+	.byte	0x31
+	.byte	0xaa
+	.byte	0xd
+	.long	0x107
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3063
+	.byte	0x31
+	.byte	0xab
+	.byte	0xd
+	.long	0x107
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3064
+	.byte	0x31
+	.byte	0xac
+	.byte	0xd
+	.long	0x107
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3065
+	.byte	0x31
+	.byte	0xad
+	.byte	0xd
+	.long	0x107
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3066
+	.byte	0x31
+	.byte	0xae
+	.byte	0xd
+	.long	0x107
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF3060
+	.byte	0x31
+	.byte	0xaf
+	.byte	0xd
+	.long	0x107
+	.byte	0xe
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3067
+	.byte	0x31
+	.byte	0xb0
+	.byte	0x3
+	.long	0x2c8a
+	.uleb128 0xa
+	.long	0x2cff
+	.uleb128 0xe
+	.long	0x2d0b
+	.long	0x2d20
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x78
+	.byte	0
+	.uleb128 0xa
+	.long	0x2d10
+	.uleb128 0x2c
+	.long	.LASF3068
+	.byte	0xb8
+	.byte	0x2d
+	.long	0x2d20
+	.uleb128 0xe
+	.long	0x2c85
+	.long	0x2d40
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xd
+	.byte	0
+	.uleb128 0xa
+	.long	0x2d30
+	.uleb128 0x4
+	.long	.LASF3069
+	.value	0x153
+	.byte	0x33
+	.long	0x2d40
+	.uleb128 0xe
+	.long	0x2c19
+	.long	0x2d61
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0x2d51
+	.uleb128 0x4
+	.long	.LASF3070
+	.value	0x165
+	.byte	0x2e
+	.long	0x2d61
+	.uleb128 0xe
+	.long	0x2c19
+	.long	0x2d82
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xc
+	.byte	0
+	.uleb128 0xa
+	.long	0x2d72
+	.uleb128 0x4
+	.long	.LASF3071
+	.value	0x16c
+	.byte	0x2e
+	.long	0x2d82
+	.uleb128 0x44
+	.long	.LASF3072
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x31
+	.value	0x191
+	.byte	0xe
+	.long	0x2def
+	.uleb128 0x1
+	.long	.LASF3073
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3074
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3075
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3076
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3077
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3078
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3079
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3080
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3081
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3082
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3083
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3084
+	.byte	0xb
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3072
+	.byte	0x31
+	.value	0x19e
+	.byte	0x3
+	.long	0x2d93
+	.uleb128 0x2b
+	.long	.LASF3085
+	.value	0x178
+	.byte	0x31
+	.value	0x1a3
+	.long	0x304e
+	.uleb128 0x7
+	.long	.LASF2253
+	.byte	0x31
+	.value	0x1a4
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2760
+	.byte	0x31
+	.value	0x1a6
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF2761
+	.byte	0x31
+	.value	0x1a7
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x10
+	.uleb128 0x7
+	.long	.LASF2762
+	.byte	0x31
+	.value	0x1a8
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x1c
+	.uleb128 0x7
+	.long	.LASF2763
+	.byte	0x31
+	.value	0x1a9
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x28
+	.uleb128 0x7
+	.long	.LASF3086
+	.byte	0x31
+	.value	0x1ab
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x34
+	.uleb128 0x7
+	.long	.LASF3087
+	.byte	0x31
+	.value	0x1ac
+	.byte	0xd
+	.long	0x304e
+	.byte	0x40
+	.uleb128 0x7
+	.long	.LASF3088
+	.byte	0x31
+	.value	0x1ad
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x70
+	.uleb128 0x7
+	.long	.LASF3089
+	.byte	0x31
+	.value	0x1af
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x7c
+	.uleb128 0x7
+	.long	.LASF3090
+	.byte	0x31
+	.value	0x1b0
+	.byte	0xd
+	.long	0xea
+	.byte	0x88
+	.uleb128 0x7
+	.long	.LASF3091
+	.byte	0x31
+	.value	0x1b2
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x8c
+	.uleb128 0x7
+	.long	.LASF3092
+	.byte	0x31
+	.value	0x1b3
+	.byte	0xd
+	.long	0xea
+	.byte	0x98
+	.uleb128 0x7
+	.long	.LASF3093
+	.byte	0x31
+	.value	0x1b4
+	.byte	0xd
+	.long	0x1dca
+	.byte	0x9c
+	.uleb128 0x7
+	.long	.LASF3094
+	.byte	0x31
+	.value	0x1b5
+	.byte	0xd
+	.long	0xea
+	.byte	0xa8
+	.uleb128 0x7
+	.long	.LASF3095
+	.byte	0x31
+	.value	0x1b7
+	.byte	0xd
+	.long	0x12db
+	.byte	0xac
+	.uleb128 0x7
+	.long	.LASF2596
+	.byte	0x31
+	.value	0x1b8
+	.byte	0xd
+	.long	0x12db
+	.byte	0xb4
+	.uleb128 0x7
+	.long	.LASF3096
+	.byte	0x31
+	.value	0x1b9
+	.byte	0xd
+	.long	0xe75
+	.byte	0xbc
+	.uleb128 0x7
+	.long	.LASF3097
+	.byte	0x31
+	.value	0x1ba
+	.byte	0xd
+	.long	0xe75
+	.byte	0xc2
+	.uleb128 0x7
+	.long	.LASF2694
+	.byte	0x31
+	.value	0x1bb
+	.byte	0xd
+	.long	0xe75
+	.byte	0xc8
+	.uleb128 0x7
+	.long	.LASF2302
+	.byte	0x31
+	.value	0x1bc
+	.byte	0xd
+	.long	0x733
+	.byte	0xd0
+	.uleb128 0x7
+	.long	.LASF2708
+	.byte	0x31
+	.value	0x1bd
+	.byte	0xd
+	.long	0x1708
+	.byte	0xf0
+	.uleb128 0x11
+	.long	.LASF2764
+	.byte	0x31
+	.value	0x1be
+	.byte	0xd
+	.long	0x1a13
+	.value	0x108
+	.uleb128 0x11
+	.long	.LASF3098
+	.byte	0x31
+	.value	0x1c0
+	.byte	0xe
+	.long	0x11d
+	.value	0x128
+	.uleb128 0x11
+	.long	.LASF3099
+	.byte	0x31
+	.value	0x1c1
+	.byte	0xd
+	.long	0xde
+	.value	0x12a
+	.uleb128 0x11
+	.long	.LASF2917
+	.byte	0x31
+	.value	0x1c4
+	.byte	0xd
+	.long	0xea
+	.value	0x12c
+	.uleb128 0x11
+	.long	.LASF3038
+	.byte	0x31
+	.value	0x1c7
+	.byte	0xd
+	.long	0xea
+	.value	0x130
+	.uleb128 0x11
+	.long	.LASF2965
+	.byte	0x31
+	.value	0x1ca
+	.byte	0xd
+	.long	0xe75
+	.value	0x134
+	.uleb128 0x11
+	.long	.LASF3100
+	.byte	0x31
+	.value	0x1cf
+	.byte	0xe
+	.long	0x11d
+	.value	0x13a
+	.uleb128 0x11
+	.long	.LASF3101
+	.byte	0x31
+	.value	0x1d1
+	.byte	0xd
+	.long	0xde
+	.value	0x13c
+	.uleb128 0x11
+	.long	.LASF2815
+	.byte	0x31
+	.value	0x1d2
+	.byte	0xe
+	.long	0x11d
+	.value	0x13e
+	.uleb128 0x11
+	.long	.LASF2816
+	.byte	0x31
+	.value	0x1d3
+	.byte	0xe
+	.long	0x11d
+	.value	0x140
+	.uleb128 0x11
+	.long	.LASF2817
+	.byte	0x31
+	.value	0x1d4
+	.byte	0xe
+	.long	0x11d
+	.value	0x142
+	.uleb128 0x11
+	.long	.LASF3102
+	.byte	0x31
+	.value	0x1d5
+	.byte	0xd
+	.long	0x1dca
+	.value	0x144
+	.uleb128 0x11
+	.long	.LASF3103
+	.byte	0x31
+	.value	0x1d6
+	.byte	0xd
+	.long	0xe75
+	.value	0x150
+	.uleb128 0x11
+	.long	.LASF2818
+	.byte	0x31
+	.value	0x1d7
+	.byte	0xd
+	.long	0xe75
+	.value	0x156
+	.uleb128 0x11
+	.long	.LASF3104
+	.byte	0x31
+	.value	0x1d8
+	.byte	0xd
+	.long	0xe75
+	.value	0x15c
+	.uleb128 0x11
+	.long	.LASF3105
+	.byte	0x31
+	.value	0x1d9
+	.byte	0xd
+	.long	0x1dca
+	.value	0x164
+	.uleb128 0x11
+	.long	.LASF3106
+	.byte	0x31
+	.value	0x1da
+	.byte	0xd
+	.long	0xde
+	.value	0x170
+	.uleb128 0x11
+	.long	.LASF3107
+	.byte	0x31
+	.value	0x1db
+	.byte	0xd
+	.long	0xde
+	.value	0x172
+	.uleb128 0x11
+	.long	.LASF3108
+	.byte	0x31
+	.value	0x1dc
+	.byte	0xd
+	.long	0xde
+	.value	0x174
+	.byte	0
+	.uleb128 0xe
+	.long	0xea
+	.long	0x3064
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3109
+	.byte	0x31
+	.value	0x1de
+	.byte	0x3
+	.long	0x2dfc
+	.uleb128 0x33
+	.long	.LASF3110
+	.byte	0x14
+	.value	0x1e0
+	.long	0x30a8
+	.uleb128 0x7
+	.long	.LASF2791
+	.byte	0x31
+	.value	0x1e1
+	.byte	0xd
+	.long	0x30a8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3111
+	.byte	0x31
+	.value	0x1e2
+	.byte	0xd
+	.long	0x30a8
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF3112
+	.byte	0x31
+	.value	0x1e3
+	.byte	0xd
+	.long	0x107
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0xea
+	.long	0x30b8
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3113
+	.byte	0x31
+	.value	0x1e4
+	.byte	0x3
+	.long	0x3071
+	.uleb128 0x33
+	.long	.LASF3114
+	.byte	0x1d
+	.value	0x1e7
+	.long	0x316c
+	.uleb128 0x7
+	.long	.LASF3115
+	.byte	0x31
+	.value	0x1e8
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2680
+	.byte	0x31
+	.value	0x1e9
+	.byte	0xe
+	.long	0x129
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF3116
+	.byte	0x31
+	.value	0x1ea
+	.byte	0xd
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x7
+	.long	.LASF3117
+	.byte	0x31
+	.value	0x1eb
+	.byte	0x9
+	.long	0x54b
+	.byte	0x9
+	.uleb128 0x7
+	.long	.LASF3118
+	.byte	0x31
+	.value	0x1ec
+	.byte	0x9
+	.long	0x54b
+	.byte	0xa
+	.uleb128 0x7
+	.long	.LASF3119
+	.byte	0x31
+	.value	0x1ed
+	.byte	0xd
+	.long	0xea
+	.byte	0xb
+	.uleb128 0x7
+	.long	.LASF3120
+	.byte	0x31
+	.value	0x1ee
+	.byte	0xe
+	.long	0x11d
+	.byte	0xf
+	.uleb128 0x7
+	.long	.LASF3121
+	.byte	0x31
+	.value	0x1ef
+	.byte	0xe
+	.long	0x11d
+	.byte	0x11
+	.uleb128 0x7
+	.long	.LASF3122
+	.byte	0x31
+	.value	0x1f0
+	.byte	0xd
+	.long	0xe75
+	.byte	0x13
+	.uleb128 0x7
+	.long	.LASF3123
+	.byte	0x31
+	.value	0x1f4
+	.byte	0xd
+	.long	0xde
+	.byte	0x19
+	.uleb128 0x7
+	.long	.LASF2918
+	.byte	0x31
+	.value	0x1f6
+	.byte	0xd
+	.long	0xde
+	.byte	0x1b
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3124
+	.byte	0x31
+	.value	0x1ff
+	.byte	0x1f
+	.long	0x30c5
+	.uleb128 0x1c
+	.long	.LASF3125
+	.byte	0x31
+	.value	0x202
+	.byte	0x15
+	.long	0x14cc
+	.uleb128 0x4
+	.long	.LASF3126
+	.value	0x204
+	.byte	0x16
+	.long	0x2def
+	.uleb128 0x4
+	.long	.LASF3127
+	.value	0x206
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3128
+	.value	0x207
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x31
+	.value	0x20f
+	.byte	0x5
+	.long	0x31cd
+	.uleb128 0x34
+	.long	.LASF3129
+	.value	0x210
+	.byte	0xd
+	.long	0x88
+	.uleb128 0x34
+	.long	.LASF3130
+	.value	0x211
+	.byte	0x12
+	.long	0x129
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x31
+	.value	0x209
+	.byte	0x8
+	.long	0x31f2
+	.uleb128 0x7
+	.long	.LASF3131
+	.byte	0x31
+	.value	0x20a
+	.byte	0xe
+	.long	0x129
+	.byte	0
+	.uleb128 0x20
+	.string	"u"
+	.byte	0x31
+	.value	0x212
+	.byte	0x7
+	.long	0x31aa
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3132
+	.value	0x213
+	.byte	0x3
+	.long	0x31cd
+	.uleb128 0x4
+	.long	.LASF3133
+	.value	0x216
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3134
+	.value	0x21a
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3135
+	.value	0x21b
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3136
+	.value	0x21c
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x4
+	.long	.LASF3137
+	.value	0x21d
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x4
+	.long	.LASF3138
+	.value	0x21e
+	.byte	0xc
+	.long	0x54b
+	.uleb128 0x4
+	.long	.LASF3139
+	.value	0x221
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3140
+	.value	0x222
+	.byte	0x11
+	.long	0x129
+	.uleb128 0x4
+	.long	.LASF3141
+	.value	0x229
+	.byte	0x11
+	.long	0x11d
+	.uleb128 0x4
+	.long	.LASF3142
+	.value	0x22b
+	.byte	0x1b
+	.long	0x30b8
+	.uleb128 0x4
+	.long	.LASF3143
+	.value	0x22c
+	.byte	0x1c
+	.long	0x316c
+	.uleb128 0x46
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x31
+	.value	0x237
+	.byte	0xe
+	.long	0x32aa
+	.uleb128 0x1
+	.long	.LASF3144
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3145
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3147
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF3148
+	.value	0x180
+	.byte	0x31
+	.value	0x23e
+	.long	0x32e5
+	.uleb128 0x7
+	.long	.LASF2789
+	.byte	0x31
+	.value	0x23f
+	.byte	0x19
+	.long	0x3064
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF3149
+	.byte	0x31
+	.value	0x240
+	.byte	0xe
+	.long	0x129
+	.value	0x178
+	.uleb128 0x11
+	.long	.LASF2256
+	.byte	0x31
+	.value	0x241
+	.byte	0xd
+	.long	0x107
+	.value	0x17c
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3150
+	.byte	0x31
+	.value	0x242
+	.byte	0x3
+	.long	0x32aa
+	.uleb128 0xe
+	.long	0x32e5
+	.long	0x3302
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3151
+	.value	0x244
+	.byte	0x1b
+	.long	0x32f2
+	.uleb128 0x4
+	.long	.LASF3152
+	.value	0x245
+	.byte	0x19
+	.long	0x118
+	.uleb128 0x4
+	.long	.LASF3153
+	.value	0x246
+	.byte	0x19
+	.long	0x118
+	.uleb128 0x4
+	.long	.LASF3154
+	.value	0x247
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x4
+	.long	.LASF3155
+	.value	0x248
+	.byte	0x11
+	.long	0x129
+	.uleb128 0xe
+	.long	0x334e
+	.long	0x334e
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0x3064
+	.uleb128 0x4
+	.long	.LASF3156
+	.value	0x24f
+	.byte	0x1d
+	.long	0x333e
+	.uleb128 0x4
+	.long	.LASF3157
+	.value	0x251
+	.byte	0xc
+	.long	0x54b
+	.uleb128 0x16
+	.long	.LASF3158
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x5
+	.long	0x54b
+	.long	0x3386
+	.uleb128 0x5
+	.long	0xc1
+	.uleb128 0x5
+	.long	0x3386
+	.byte	0
+	.uleb128 0x6
+	.long	0x2e3
+	.uleb128 0x16
+	.long	.LASF3159
+	.byte	0x6
+	.byte	0x6b
+	.byte	0x5
+	.long	0x54b
+	.long	0x33a1
+	.uleb128 0x5
+	.long	0x3386
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3160
+	.value	0x1b3
+	.byte	0x5
+	.long	0x88
+	.uleb128 0x2d
+	.long	.LASF3161
+	.value	0x1b4
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0xf
+	.long	.LASF3162
+	.byte	0x16
+	.byte	0x8a
+	.byte	0xa
+	.long	0x129
+	.uleb128 0x16
+	.long	.LASF3163
+	.byte	0x32
+	.byte	0x16
+	.byte	0xa
+	.long	0x129
+	.long	0x33db
+	.uleb128 0x5
+	.long	0x15c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3164
+	.byte	0x33
+	.byte	0x16
+	.byte	0x5
+	.long	0x88
+	.long	0x33f1
+	.uleb128 0x5
+	.long	0x152
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF3165
+	.byte	0x34
+	.value	0x197
+	.byte	0xf
+	.long	0x146
+	.long	0x3408
+	.uleb128 0x5
+	.long	0x152
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3166
+	.byte	0x9
+	.byte	0x62
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0x25
+	.long	.LASF3171
+	.byte	0x5d
+	.uleb128 0x16
+	.long	.LASF3167
+	.byte	0x9
+	.byte	0x60
+	.byte	0x5
+	.long	0x54b
+	.long	0x3430
+	.uleb128 0x5
+	.long	0x54b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3168
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0x1d
+	.long	.LASF3181
+	.byte	0x33
+	.byte	0x15
+	.long	0x3453
+	.uleb128 0x5
+	.long	0x152
+	.uleb128 0x5
+	.long	0x152
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3169
+	.byte	0x9
+	.byte	0x65
+	.byte	0x1f
+	.long	0x6bd
+	.long	0x3469
+	.uleb128 0x5
+	.long	0xea
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3170
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0x25
+	.long	.LASF3172
+	.byte	0x64
+	.uleb128 0xf
+	.long	.LASF3173
+	.byte	0x25
+	.byte	0xc4
+	.byte	0xa
+	.long	0x11d
+	.uleb128 0xf
+	.long	.LASF3174
+	.byte	0x2b
+	.byte	0x95
+	.byte	0x9
+	.long	0xde
+	.uleb128 0x16
+	.long	.LASF3175
+	.byte	0x25
+	.byte	0xd2
+	.byte	0x9
+	.long	0xde
+	.long	0x34a9
+	.uleb128 0x5
+	.long	0x30
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF3176
+	.byte	0x35
+	.value	0x13d
+	.byte	0x11
+	.long	0xac
+	.long	0x34c0
+	.uleb128 0x5
+	.long	0x15c
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF3177
+	.value	0x1f6
+	.byte	0x23
+	.long	0x34cc
+	.uleb128 0x6
+	.long	0x1d9e
+	.uleb128 0x16
+	.long	.LASF3178
+	.byte	0x1b
+	.byte	0x77
+	.byte	0x5
+	.long	0x54b
+	.long	0x34e7
+	.uleb128 0x5
+	.long	0x1496
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3179
+	.byte	0x33
+	.byte	0x14
+	.byte	0x5
+	.long	0x88
+	.long	0x34fe
+	.uleb128 0x5
+	.long	0x152
+	.uleb128 0x36
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3180
+	.byte	0x18
+	.byte	0x29
+	.byte	0x10
+	.long	0x125f
+	.uleb128 0x1d
+	.long	.LASF3182
+	.byte	0x33
+	.byte	0x21
+	.long	0x351b
+	.uleb128 0x5
+	.long	0x15c
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3183
+	.byte	0x33
+	.byte	0x23
+	.long	0x3531
+	.uleb128 0x5
+	.long	0x129
+	.uleb128 0x5
+	.long	0x107
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3184
+	.byte	0x33
+	.byte	0x1f
+	.long	0x3547
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3185
+	.byte	0x33
+	.byte	0x1e
+	.long	0x3558
+	.uleb128 0x5
+	.long	0x22f5
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3186
+	.byte	0xc
+	.byte	0xae
+	.long	0x3578
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3187
+	.byte	0x33
+	.byte	0x1d
+	.long	0x3589
+	.uleb128 0x5
+	.long	0x22f5
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3188
+	.byte	0x36
+	.byte	0x2e
+	.byte	0x5
+	.long	0x54b
+	.long	0x359f
+	.uleb128 0x5
+	.long	0xd3b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3189
+	.byte	0x36
+	.byte	0x2d
+	.byte	0x5
+	.long	0x54b
+	.long	0x35b5
+	.uleb128 0x5
+	.long	0xd3b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3190
+	.byte	0x37
+	.byte	0x1e
+	.byte	0x7
+	.long	0x15c
+	.long	0x35cb
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3191
+	.byte	0x2b
+	.byte	0x8b
+	.byte	0xa
+	.long	0x11d
+	.uleb128 0xf
+	.long	.LASF3192
+	.byte	0x2b
+	.byte	0x92
+	.byte	0xa
+	.long	0x11d
+	.uleb128 0xf
+	.long	.LASF3193
+	.byte	0x26
+	.byte	0x19
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3194
+	.byte	0x26
+	.byte	0x18
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3195
+	.byte	0x26
+	.byte	0x17
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3196
+	.byte	0x26
+	.byte	0x16
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3197
+	.byte	0x26
+	.byte	0x15
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3198
+	.byte	0x26
+	.byte	0x14
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3199
+	.byte	0x26
+	.byte	0x13
+	.byte	0x18
+	.long	0x1fd0
+	.uleb128 0xf
+	.long	.LASF3200
+	.byte	0x25
+	.byte	0xba
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0xf
+	.long	.LASF3201
+	.byte	0x25
+	.byte	0xb9
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0xf
+	.long	.LASF3116
+	.byte	0x1d
+	.byte	0x9e
+	.byte	0x11
+	.long	0x15e5
+	.uleb128 0x16
+	.long	.LASF3202
+	.byte	0x34
+	.byte	0x40
+	.byte	0xc
+	.long	0x88
+	.long	0x367b
+	.uleb128 0x5
+	.long	0x367b
+	.uleb128 0x5
+	.long	0x367b
+	.uleb128 0x5
+	.long	0x146
+	.byte	0
+	.uleb128 0x6
+	.long	0x3680
+	.uleb128 0x47
+	.uleb128 0x25
+	.long	.LASF3203
+	.byte	0x49
+	.uleb128 0xf
+	.long	.LASF3204
+	.byte	0x1f
+	.byte	0x73
+	.byte	0x5
+	.long	0x88
+	.uleb128 0x1d
+	.long	.LASF3205
+	.byte	0x33
+	.byte	0x1b
+	.long	0x36a9
+	.uleb128 0x5
+	.long	0xd3b
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3206
+	.byte	0x33
+	.byte	0x19
+	.long	0x36ba
+	.uleb128 0x5
+	.long	0xea
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3207
+	.byte	0x33
+	.byte	0x1a
+	.long	0x36d0
+	.uleb128 0x5
+	.long	0x22f5
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3208
+	.byte	0x33
+	.byte	0x18
+	.long	0x36e1
+	.uleb128 0x5
+	.long	0x129
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF3209
+	.byte	0x5a
+	.uleb128 0xf
+	.long	.LASF2189
+	.byte	0x38
+	.byte	0x1d
+	.byte	0xa
+	.long	0x263
+	.uleb128 0xf
+	.long	.LASF3210
+	.byte	0x25
+	.byte	0xc5
+	.byte	0xe
+	.long	0x1fa0
+	.uleb128 0x16
+	.long	.LASF3211
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x5
+	.long	0x54b
+	.long	0x3715
+	.uleb128 0x5
+	.long	0x129
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3212
+	.byte	0x1c
+	.byte	0xa3
+	.byte	0x5
+	.long	0x54b
+	.long	0x372b
+	.uleb128 0x5
+	.long	0x129
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3213
+	.byte	0x20
+	.byte	0xa3
+	.byte	0x13
+	.long	0x3737
+	.uleb128 0x6
+	.long	0x17f4
+	.uleb128 0xf
+	.long	.LASF3214
+	.byte	0x21
+	.byte	0x96
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0xf
+	.long	.LASF3215
+	.byte	0x1f
+	.byte	0x74
+	.byte	0x9
+	.long	0x107
+	.uleb128 0x48
+	.string	"gcd"
+	.byte	0xc
+	.byte	0x83
+	.byte	0x5
+	.long	0x88
+	.long	0x376f
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x88
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3216
+	.byte	0x39
+	.byte	0x3a
+	.byte	0xa
+	.long	0x129
+	.uleb128 0x16
+	.long	.LASF3217
+	.byte	0x1b
+	.byte	0x7a
+	.byte	0x5
+	.long	0x54b
+	.long	0x3791
+	.uleb128 0x5
+	.long	0x1496
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3218
+	.byte	0x2b
+	.byte	0x8a
+	.byte	0xa
+	.long	0x11d
+	.uleb128 0x16
+	.long	.LASF3219
+	.byte	0x34
+	.byte	0x3d
+	.byte	0xe
+	.long	0xbf
+	.long	0x37bd
+	.uleb128 0x5
+	.long	0xbf
+	.uleb128 0x5
+	.long	0x88
+	.uleb128 0x5
+	.long	0x146
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF3220
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0x26
+	.long	.LASF3222
+	.value	0x893
+	.long	0x37e1
+	.uleb128 0x4
+	.long	.LASF3221
+	.value	0x89c
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3232
+	.value	0x88b
+	.byte	0xc
+	.long	0x54b
+	.uleb128 0x26
+	.long	.LASF3223
+	.value	0x81b
+	.long	0x3811
+	.uleb128 0x10
+	.long	.LASF2268
+	.value	0x81b
+	.byte	0x1f
+	.long	0x26f
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"i"
+	.value	0x832
+	.byte	0x1a
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3224
+	.value	0x7fc
+	.long	0x3829
+	.uleb128 0x10
+	.long	.LASF2268
+	.value	0x7fc
+	.byte	0x1e
+	.long	0x26f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3226
+	.value	0x7ea
+	.long	0x3843
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3225
+	.value	0x7ed
+	.byte	0x17
+	.long	0x113
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3227
+	.value	0x7aa
+	.long	0x3869
+	.uleb128 0x10
+	.long	.LASF3228
+	.value	0x7aa
+	.byte	0x35
+	.long	0x3869
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3229
+	.value	0x7b1
+	.byte	0x28
+	.long	0x585
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x32e5
+	.uleb128 0x19
+	.long	.LASF3230
+	.value	0x780
+	.long	0x38aa
+	.uleb128 0x10
+	.long	.LASF2268
+	.value	0x780
+	.byte	0x2d
+	.long	0x26f
+	.uleb128 0x4
+	.long	.LASF2256
+	.value	0x782
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x4
+	.long	.LASF3231
+	.value	0x79e
+	.byte	0x13
+	.long	0x113
+	.uleb128 0x4
+	.long	.LASF3228
+	.value	0x79f
+	.byte	0x19
+	.long	0x3869
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3233
+	.value	0x77a
+	.byte	0x10
+	.long	0x107
+	.uleb128 0x2e
+	.long	.LASF3264
+	.value	0x76f
+	.uleb128 0x27
+	.long	.LASF3234
+	.value	0x769
+	.byte	0xc
+	.long	0x54b
+	.uleb128 0x22
+	.long	.LASF3241
+	.value	0x761
+	.byte	0xc
+	.long	0x54b
+	.long	0x38e6
+	.uleb128 0x10
+	.long	.LASF3235
+	.value	0x761
+	.byte	0x2d
+	.long	0x129
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3236
+	.value	0x751
+	.long	0x3900
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3237
+	.value	0x755
+	.byte	0x25
+	.long	0x4fe
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3238
+	.value	0x745
+	.long	0x391a
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3237
+	.value	0x74a
+	.byte	0x23
+	.long	0x4cb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3239
+	.value	0x719
+	.long	0x393e
+	.uleb128 0x10
+	.long	.LASF3240
+	.value	0x719
+	.byte	0x26
+	.long	0x4a5
+	.uleb128 0x10
+	.long	.LASF2298
+	.value	0x719
+	.byte	0x43
+	.long	0x393e
+	.byte	0
+	.uleb128 0x6
+	.long	0x600
+	.uleb128 0x22
+	.long	.LASF3242
+	.value	0x691
+	.byte	0xc
+	.long	0x54b
+	.long	0x3960
+	.uleb128 0xb
+	.string	"buf"
+	.value	0x698
+	.byte	0xa
+	.long	0x3960
+	.byte	0
+	.uleb128 0xe
+	.long	0xc6
+	.long	0x3970
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x1d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3243
+	.value	0x67a
+	.byte	0xe
+	.long	0xc1
+	.long	0x3999
+	.uleb128 0x49
+	.string	"buf"
+	.byte	0x31
+	.value	0x67a
+	.byte	0x2d
+	.long	0xc1
+	.uleb128 0xb
+	.string	"dt"
+	.value	0x67c
+	.byte	0x10
+	.long	0x2e3
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3244
+	.value	0x618
+	.byte	0xc
+	.long	0x54b
+	.long	0x3a66
+	.uleb128 0x10
+	.long	.LASF3245
+	.value	0x618
+	.byte	0x25
+	.long	0xc6
+	.uleb128 0x10
+	.long	.LASF3246
+	.value	0x618
+	.byte	0x39
+	.long	0xc6
+	.uleb128 0x10
+	.long	.LASF3247
+	.value	0x618
+	.byte	0x55
+	.long	0x367b
+	.uleb128 0x10
+	.long	.LASF3248
+	.value	0x619
+	.byte	0x15
+	.long	0x367b
+	.uleb128 0x10
+	.long	.LASF3249
+	.value	0x619
+	.byte	0x30
+	.long	0x88
+	.uleb128 0x10
+	.long	.LASF3250
+	.value	0x619
+	.byte	0x4b
+	.long	0xce8
+	.uleb128 0x10
+	.long	.LASF3251
+	.value	0x619
+	.byte	0x66
+	.long	0xce8
+	.uleb128 0xb
+	.string	"def"
+	.value	0x61b
+	.byte	0x26
+	.long	0x3a66
+	.uleb128 0x4
+	.long	.LASF3252
+	.value	0x61c
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x4
+	.long	.LASF3253
+	.value	0x61d
+	.byte	0x10
+	.long	0x54b
+	.uleb128 0x4
+	.long	.LASF3254
+	.value	0x61e
+	.byte	0xc
+	.long	0x146
+	.uleb128 0x4
+	.long	.LASF3255
+	.value	0x61f
+	.byte	0xc
+	.long	0x146
+	.uleb128 0x4
+	.long	.LASF3256
+	.value	0x63f
+	.byte	0x14
+	.long	0x135
+	.uleb128 0x14
+	.long	0x3a57
+	.uleb128 0x4
+	.long	.LASF3257
+	.value	0x632
+	.byte	0x12
+	.long	0x129
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3258
+	.value	0x647
+	.byte	0x15
+	.long	0xea
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x2bba
+	.uleb128 0x19
+	.long	.LASF3259
+	.value	0x595
+	.long	0x3b03
+	.uleb128 0x10
+	.long	.LASF3260
+	.value	0x595
+	.byte	0x30
+	.long	0x334e
+	.uleb128 0x10
+	.long	.LASF2268
+	.value	0x595
+	.byte	0x4a
+	.long	0x26f
+	.uleb128 0x4
+	.long	.LASF3261
+	.value	0x59a
+	.byte	0x27
+	.long	0x34cc
+	.uleb128 0x4
+	.long	.LASF3262
+	.value	0x5da
+	.byte	0xf
+	.long	0x8f
+	.uleb128 0x14
+	.long	0x3ab6
+	.uleb128 0xb
+	.string	"i"
+	.value	0x59d
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3ac6
+	.uleb128 0xb
+	.string	"i"
+	.value	0x5cd
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3ad6
+	.uleb128 0xb
+	.string	"i"
+	.value	0x5d6
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3ae6
+	.uleb128 0xb
+	.string	"i"
+	.value	0x5db
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3af6
+	.uleb128 0xb
+	.string	"i"
+	.value	0x5f1
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"i"
+	.value	0x5fa
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3263
+	.value	0x571
+	.long	0x3b1b
+	.uleb128 0x10
+	.long	.LASF2268
+	.value	0x571
+	.byte	0x24
+	.long	0x26f
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3265
+	.value	0x565
+	.uleb128 0x37
+	.long	.LASF3266
+	.value	0x550
+	.uleb128 0x37
+	.long	.LASF3267
+	.value	0x520
+	.uleb128 0x2e
+	.long	.LASF3268
+	.value	0x516
+	.uleb128 0x19
+	.long	.LASF3269
+	.value	0x4f5
+	.long	0x3b51
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"div"
+	.value	0x4ff
+	.byte	0x13
+	.long	0x8f
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3270
+	.value	0x4db
+	.byte	0xc
+	.long	0x54b
+	.long	0x3b88
+	.uleb128 0x10
+	.long	.LASF3271
+	.value	0x4db
+	.byte	0x28
+	.long	0x54b
+	.uleb128 0x4
+	.long	.LASF3272
+	.value	0x4de
+	.byte	0x9
+	.long	0x54b
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3273
+	.value	0x4e3
+	.byte	0x1d
+	.long	0x316c
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3274
+	.value	0x4a0
+	.long	0x3bb8
+	.uleb128 0x10
+	.long	.LASF3275
+	.value	0x4a0
+	.byte	0x30
+	.long	0x3bb8
+	.uleb128 0x4
+	.long	.LASF3276
+	.value	0x4be
+	.byte	0x9
+	.long	0x54b
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"i"
+	.value	0x4b1
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x316c
+	.uleb128 0x19
+	.long	.LASF3277
+	.value	0x470
+	.long	0x3bd5
+	.uleb128 0x4
+	.long	.LASF2692
+	.value	0x472
+	.byte	0xd
+	.long	0x1dca
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3278
+	.value	0x3b1
+	.long	0x3cb9
+	.uleb128 0x4
+	.long	.LASF3260
+	.value	0x3b3
+	.byte	0x1a
+	.long	0x334e
+	.uleb128 0x4
+	.long	.LASF3279
+	.value	0x3b4
+	.byte	0x1a
+	.long	0x334e
+	.uleb128 0x4
+	.long	.LASF3280
+	.value	0x3b6
+	.byte	0x14
+	.long	0x135
+	.uleb128 0x4
+	.long	.LASF3281
+	.value	0x3c2
+	.byte	0xd
+	.long	0x733
+	.uleb128 0x4
+	.long	.LASF3282
+	.value	0x40e
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x14
+	.long	0x3c2c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x3d4
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c3c
+	.uleb128 0xb
+	.string	"i"
+	.value	0x3ec
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c4c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x400
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c5c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x407
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c6c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x41a
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c7c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x44c
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c8c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x450
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3c9c
+	.uleb128 0xb
+	.string	"x"
+	.value	0x454
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3cac
+	.uleb128 0xb
+	.string	"x"
+	.value	0x458
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"x"
+	.value	0x45c
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3283
+	.value	0x3a3
+	.long	0x3d1b
+	.uleb128 0x10
+	.long	.LASF3284
+	.value	0x3a3
+	.byte	0x3b
+	.long	0x88
+	.uleb128 0x10
+	.long	.LASF3285
+	.value	0x3a3
+	.byte	0x53
+	.long	0x88
+	.uleb128 0x4
+	.long	.LASF3286
+	.value	0x3a5
+	.byte	0xe
+	.long	0x22f5
+	.uleb128 0x4
+	.long	.LASF3287
+	.value	0x3a6
+	.byte	0xe
+	.long	0x22f5
+	.uleb128 0x4
+	.long	.LASF3288
+	.value	0x3a7
+	.byte	0xe
+	.long	0x22f5
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"i"
+	.value	0x3a9
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3289
+	.value	0x3ab
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3290
+	.value	0x395
+	.long	0x3d7d
+	.uleb128 0x10
+	.long	.LASF3284
+	.value	0x395
+	.byte	0x3b
+	.long	0x88
+	.uleb128 0x10
+	.long	.LASF3285
+	.value	0x395
+	.byte	0x53
+	.long	0x88
+	.uleb128 0x4
+	.long	.LASF3286
+	.value	0x397
+	.byte	0xe
+	.long	0xd3b
+	.uleb128 0x4
+	.long	.LASF3287
+	.value	0x398
+	.byte	0xe
+	.long	0xd3b
+	.uleb128 0x4
+	.long	.LASF3288
+	.value	0x399
+	.byte	0xe
+	.long	0xd3b
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"i"
+	.value	0x39b
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3289
+	.value	0x39d
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3291
+	.value	0x2f5
+	.long	0x3e2d
+	.uleb128 0x4
+	.long	.LASF3260
+	.value	0x2f7
+	.byte	0x1a
+	.long	0x334e
+	.uleb128 0x4
+	.long	.LASF3262
+	.value	0x361
+	.byte	0xf
+	.long	0x8f
+	.uleb128 0x14
+	.long	0x3db0
+	.uleb128 0xb
+	.string	"x"
+	.value	0x303
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3dc0
+	.uleb128 0xb
+	.string	"i"
+	.value	0x314
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3dd0
+	.uleb128 0xb
+	.string	"x"
+	.value	0x362
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3de0
+	.uleb128 0xb
+	.string	"x"
+	.value	0x367
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3df0
+	.uleb128 0xb
+	.string	"x"
+	.value	0x374
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3e00
+	.uleb128 0xb
+	.string	"x"
+	.value	0x378
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3e10
+	.uleb128 0xb
+	.string	"x"
+	.value	0x37c
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x3e20
+	.uleb128 0xb
+	.string	"x"
+	.value	0x380
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.string	"x"
+	.value	0x384
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3292
+	.value	0x2d3
+	.long	0x3e45
+	.uleb128 0x10
+	.long	.LASF3293
+	.value	0x2d3
+	.byte	0x2c
+	.long	0x2def
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3294
+	.value	0x2ce
+	.byte	0xc
+	.long	0x54b
+	.long	0x3e62
+	.uleb128 0x10
+	.long	.LASF3060
+	.value	0x2ce
+	.byte	0x3a
+	.long	0x3a1
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF3295
+	.value	0x2c4
+	.long	0x3e7c
+	.uleb128 0x17
+	.uleb128 0x4
+	.long	.LASF3296
+	.value	0x2c7
+	.byte	0x22
+	.long	0x3a1
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3297
+	.value	0x268
+	.byte	0xc
+	.long	0x54b
+	.long	0x3e99
+	.uleb128 0x10
+	.long	.LASF3060
+	.value	0x268
+	.byte	0x42
+	.long	0x3a1
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3298
+	.value	0x263
+	.byte	0xc
+	.long	0x54b
+	.uleb128 0x38
+	.long	.LASF3299
+	.value	0x25e
+	.byte	0x5
+	.long	0x54b
+	.uleb128 0x38
+	.long	.LASF3300
+	.value	0x256
+	.byte	0xa
+	.long	0x129
+	.uleb128 0x1a
+	.long	.LASF3301
+	.byte	0x2d
+	.byte	0x62
+	.byte	0x6f
+	.long	0x3ec9
+	.uleb128 0x6
+	.long	0x28b2
+	.uleb128 0x1a
+	.long	.LASF3302
+	.byte	0x2c
+	.byte	0x44
+	.byte	0x7e
+	.long	0x3eda
+	.uleb128 0x6
+	.long	0x26d0
+	.uleb128 0x1a
+	.long	.LASF3303
+	.byte	0x2b
+	.byte	0x71
+	.byte	0x9c
+	.long	0x3eeb
+	.uleb128 0x6
+	.long	0x2521
+	.uleb128 0x1a
+	.long	.LASF3304
+	.byte	0x2a
+	.byte	0x2d
+	.byte	0x88
+	.long	0x3efc
+	.uleb128 0x6
+	.long	0x2346
+	.uleb128 0x1a
+	.long	.LASF3305
+	.byte	0x28
+	.byte	0x51
+	.byte	0x9c
+	.long	0x3f0d
+	.uleb128 0x6
+	.long	0x2220
+	.uleb128 0x1a
+	.long	.LASF3306
+	.byte	0x25
+	.byte	0x82
+	.byte	0x65
+	.long	0x3f1e
+	.uleb128 0x6
+	.long	0x1f5f
+	.uleb128 0x1a
+	.long	.LASF3307
+	.byte	0x20
+	.byte	0xa0
+	.byte	0x53
+	.long	0x3f2f
+	.uleb128 0x6
+	.long	0x19c2
+	.uleb128 0x1a
+	.long	.LASF3308
+	.byte	0x1f
+	.byte	0x61
+	.byte	0x74
+	.long	0x3f40
+	.uleb128 0x6
+	.long	0x16f7
+	.uleb128 0x1a
+	.long	.LASF3309
+	.byte	0x19
+	.byte	0x5d
+	.byte	0x8d
+	.long	0x3f51
+	.uleb128 0x6
+	.long	0x136b
+	.uleb128 0x1a
+	.long	.LASF3310
+	.byte	0x16
+	.byte	0x52
+	.byte	0x79
+	.long	0x3f62
+	.uleb128 0x6
+	.long	0x10d1
+	.uleb128 0x1a
+	.long	.LASF3311
+	.byte	0xd
+	.byte	0x1a
+	.byte	0x7e
+	.long	0x3f73
+	.uleb128 0x6
+	.long	0x8c3
+	.uleb128 0x4a
+	.long	.LASF3312
+	.byte	0x9
+	.byte	0x52
+	.byte	0x14
+	.long	0x3f91
+	.uleb128 0x4b
+	.long	.LASF2954
+	.byte	0x9
+	.byte	0x52
+	.byte	0x2a
+	.long	0x107
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF3313
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x18
+	.long	0x129
+	.uleb128 0x1a
+	.long	.LASF3314
+	.byte	0x8
+	.byte	0x20
+	.byte	0xdb
+	.long	0x3fa9
+	.uleb128 0x6
+	.long	0x65a
+	.uleb128 0x1a
+	.long	.LASF3315
+	.byte	0x8
+	.byte	0x20
+	.byte	0x83
+	.long	0x3fba
+	.uleb128 0x6
+	.long	0x666
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 36
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 49
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x43
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x44
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x45
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x46
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x48
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 58 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 59 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 63 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 64 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 67 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 69 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x45
+	.file 70 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 77 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4e
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1004
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 86 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.file 87 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 88 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x58
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 89 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x59
+	.byte	0x4
+	.file 90 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.file 91 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 92 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 93 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x5d
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0x4
+	.file 94 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x12
+	.file 95 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5f
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1522
+	.byte	0x4
+	.file 96 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x60
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1523
+	.file 97 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x61
+	.byte	0x4
+	.byte	0x4
+	.file 98 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x62
+	.file 99 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1536
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1563
+	.byte	0x4
+	.file 100 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x64
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1564
+	.byte	0x4
+	.file 101 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1576
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x1e
+	.file 102 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x21
+	.file 103 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1642
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 104 "./src/main/flight/rpm_filter.h"
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 105 "./src/main/rx/msp_override.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1700
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x30
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 106 "./src/main/sensors/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x6a
+	.file 107 "./src/main/drivers/rangefinder/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6b
+	.file 108 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 109 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 110 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x4
+	.file 111 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x685
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x688
+	.long	.LASF2139
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1354
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1364
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1366
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.48.d431a1cf6653bca7fad963f04c7375d6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.10f237ed61a9ae208342a970c4692795,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1385
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1388
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1601
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rpm_filter.h.46.638ccbdb612f529ec85646b839a0f5ec,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1704
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1709
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1725
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1745
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.42.85deea106217bb5124375716e7a86067,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2119
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.temperature.h.22.e3be097e37ed0a45eba857cc18097eab,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2122
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x19
+	.long	.LASF1
+	.long	.LASF3318
+	.long	.LASF3319
+	.long	.LASF3320
+	.long	.LASF3321
+	.long	.LASF3322
+	.long	.LASF3323
+	.long	.LASF3324
+	.long	.LASF3325
+	.long	.LASF3326
+	.long	.LASF3327
+	.long	.LASF3328
+	.long	.LASF3329
+	.long	.LASF3330
+	.long	.LASF3331
+	.long	.LASF3332
+	.long	.LASF3333
+	.long	.LASF3334
+	.long	.LASF3335
+	.long	.LASF3336
+	.long	.LASF3337
+	.long	.LASF3338
+	.long	.LASF3339
+	.long	.LASF3340
+	.long	.LASF3341
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x70
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3342
+	.byte	0x14
+	.long	.LASF3343
+	.byte	0x14
+	.long	.LASF3344
+	.byte	0x14
+	.long	.LASF3345
+	.byte	0x18
+	.long	.LASF3346
+	.byte	0x4
+	.long	.LASF3347
+	.byte	0x3
+	.long	.LASF3348
+	.byte	0x1
+	.long	.LASF3349
+	.byte	0x1
+	.long	.LASF3350
+	.byte	0x1
+	.long	.LASF3351
+	.byte	0x2
+	.long	.LASF3352
+	.byte	0x2
+	.long	.LASF3353
+	.byte	0x3
+	.long	.LASF3354
+	.byte	0x4
+	.long	.LASF3355
+	.byte	0x9
+	.long	.LASF3356
+	.byte	0x9
+	.long	.LASF3357
+	.byte	0x9
+	.long	.LASF3358
+	.byte	0x9
+	.long	.LASF3359
+	.byte	0x5
+	.long	.LASF3360
+	.byte	0x7
+	.long	.LASF3361
+	.byte	0x3
+	.long	.LASF3362
+	.byte	0x9
+	.long	.LASF3363
+	.byte	0xa
+	.long	.LASF3364
+	.byte	0xa
+	.long	.LASF3365
+	.byte	0xa
+	.long	.LASF3366
+	.byte	0xa
+	.long	.LASF3367
+	.byte	0x3
+	.long	.LASF3368
+	.byte	0xa
+	.long	.LASF3369
+	.byte	0xa
+	.long	.LASF3370
+	.byte	0xb
+	.long	.LASF3371
+	.byte	0xb
+	.long	.LASF3372
+	.byte	0xb
+	.long	.LASF3373
+	.byte	0xb
+	.long	.LASF3374
+	.byte	0xb
+	.long	.LASF3375
+	.byte	0xc
+	.long	.LASF3376
+	.byte	0x3
+	.long	.LASF3377
+	.byte	0xd
+	.long	.LASF3378
+	.byte	0xe
+	.long	.LASF3379
+	.byte	0xf
+	.long	.LASF3380
+	.byte	0xf
+	.long	.LASF3381
+	.byte	0xf
+	.long	.LASF3382
+	.byte	0x6
+	.long	.LASF3382
+	.byte	0xf
+	.long	.LASF3383
+	.byte	0xf
+	.long	.LASF3360
+	.byte	0xf
+	.long	.LASF3384
+	.byte	0xf
+	.long	.LASF3385
+	.byte	0x3
+	.long	.LASF3386
+	.byte	0x9
+	.long	.LASF3386
+	.byte	0xf
+	.long	.LASF3387
+	.byte	0x1
+	.long	.LASF3388
+	.byte	0x3
+	.long	.LASF3389
+	.byte	0x1
+	.long	.LASF3390
+	.byte	0x17
+	.long	.LASF3391
+	.byte	0x14
+	.long	.LASF3392
+	.byte	0xf
+	.long	.LASF3393
+	.byte	0xb
+	.long	.LASF3347
+	.byte	0x9
+	.long	.LASF3394
+	.byte	0xc
+	.long	.LASF3395
+	.byte	0x17
+	.long	.LASF3396
+	.byte	0x18
+	.long	.LASF3397
+	.byte	0x18
+	.long	.LASF3397
+	.byte	0x17
+	.long	.LASF3398
+	.byte	0x14
+	.long	.LASF3399
+	.byte	0x17
+	.long	.LASF3400
+	.byte	0x17
+	.long	.LASF3401
+	.byte	0x14
+	.long	.LASF3402
+	.byte	0x14
+	.long	.LASF3403
+	.byte	0x16
+	.long	.LASF3404
+	.byte	0x14
+	.long	.LASF3405
+	.byte	0x15
+	.long	.LASF3406
+	.byte	0x15
+	.long	.LASF3407
+	.byte	0x14
+	.long	.LASF3408
+	.byte	0x14
+	.long	.LASF3409
+	.byte	0x14
+	.long	.LASF3410
+	.byte	0x13
+	.long	.LASF3411
+	.byte	0x13
+	.long	.LASF3412
+	.byte	0x17
+	.long	.LASF3413
+	.byte	0x17
+	.long	.LASF3414
+	.byte	0x14
+	.long	.LASF3415
+	.byte	0x14
+	.long	.LASF3416
+	.byte	0x14
+	.long	.LASF3417
+	.byte	0x14
+	.long	.LASF3418
+	.byte	0x14
+	.long	.LASF3419
+	.byte	0x14
+	.long	.LASF3420
+	.byte	0x14
+	.long	.LASF3421
+	.byte	0x14
+	.long	.LASF3422
+	.byte	0x12
+	.long	.LASF3423
+	.byte	0x11
+	.long	.LASF3424
+	.byte	0x10
+	.long	.LASF3425
+	.byte	0x11
+	.long	.LASF3426
+	.byte	0x11
+	.long	.LASF3427
+	.byte	0x2
+	.long	.LASF3428
+	.byte	0x3
+	.long	.LASF3429
+	.byte	0x3
+	.long	.LASF3430
+	.byte	0x4
+	.long	.LASF3431
+	.byte	0x9
+	.long	.LASF3432
+	.byte	0x9
+	.long	.LASF3433
+	.byte	0x9
+	.long	.LASF3434
+	.byte	0x9
+	.long	.LASF3435
+	.byte	0x9
+	.long	.LASF3436
+	.byte	0x9
+	.long	.LASF3437
+	.byte	0xa
+	.long	.LASF3438
+	.byte	0x3
+	.long	.LASF3439
+	.byte	0x3
+	.long	.LASF3440
+	.byte	0xb
+	.long	.LASF3441
+	.byte	0xe
+	.long	.LASF3442
+	.byte	0xf
+	.long	.LASF3442
+	.byte	0x8
+	.long	.LASF3443
+	.byte	0x9
+	.long	.LASF3444
+	.byte	0x9
+	.long	.LASF3445
+	.byte	0x9
+	.long	.LASF3446
+	.byte	0xf
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1878:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1640:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF839:
+	.string	"__DECL_SIMD_exp10l "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1149:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1683:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF3021:
+	.string	"windowSizeMs"
+.LASF2321:
+	.string	"DEBUG_RPM_FREQ"
+.LASF2752:
+	.string	"dBoostGyroDeltaLpfHz"
+.LASF2064:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1772:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2936:
+	.string	"BAT_VOLTAGE_SAG_COMP"
+.LASF1138:
+	.string	"USE_BLACKBOX "
+.LASF834:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1360:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF2884:
+	.string	"isClipped"
+.LASF1236:
+	.string	"_T_WCHAR "
+.LASF2111:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1155:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF2015:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF2601:
+	.string	"alt_hold_deadband"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF903:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2261:
+	.string	"floatFlag"
+.LASF2497:
+	.string	"read"
+.LASF1942:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2777:
+	.string	"validTime"
+.LASF2283:
+	.string	"invertedCardDetection"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF739:
+	.string	"__DECL_SIMD_sinl "
+.LASF1045:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2941:
+	.string	"batteryMetersConfig_s"
+.LASF1638:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF2949:
+	.string	"batteryMetersConfig_t"
+.LASF2838:
+	.string	"rcFilterFrequency"
+.LASF2143:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1657:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF1232:
+	.string	"__wchar_t__ "
+.LASF1856:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF2793:
+	.string	"dterm_filter_state"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF740:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2311:
+	.string	"DEBUG_ALWAYS"
+.LASF1563:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1341:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF2743:
+	.string	"fixedWingCoordinatedYawGain"
+.LASF1766:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1977:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF3156:
+	.string	"blackboxHistory"
+.LASF1653:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1150:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1900:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2023:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2378:
+	.string	"OWNER_1WIRE"
+.LASF1639:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1403:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2740:
+	.string	"pidSumLimitYaw"
+.LASF793:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2545:
+	.string	"current_profile_index"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1664:
+	.string	"LON 1"
+.LASF2912:
+	.string	"use_median_filtering"
+.LASF2169:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF374:
+	.string	"__unix 1"
+.LASF2325:
+	.string	"DEBUG_IRLOCK"
+.LASF2341:
+	.string	"enabledFeatures"
+.LASF2332:
+	.string	"buildDate"
+.LASF2288:
+	.string	"BlackboxDevice"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF2929:
+	.string	"VOLTAGE_SENSOR_ADC"
+.LASF2379:
+	.string	"OWNER_AIRSPEED"
+.LASF2972:
+	.string	"mag_to_use"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2136:
+	.string	"BLACKBOX_SNAPSHOT_RING_SIZE 8"
+.LASF2812:
+	.string	"navTargetPosition"
+.LASF3287:
+	.string	"prev1"
+.LASF2274:
+	.string	"flightMode"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF2471:
+	.string	"descriptorPtr"
+.LASF1759:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1814:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1299:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF816:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2828:
+	.string	"spektrum_sat_bind"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF3219:
+	.string	"memset"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF3272:
+	.string	"shouldWrite"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF937:
+	.string	"__DECL_SIMD_acosh "
+.LASF3031:
+	.string	"pitotOpFuncPtr"
+.LASF1418:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF3180:
+	.string	"getDisarmReason"
+.LASF3246:
+	.string	"deltaFrameChar"
+.LASF2263:
+	.string	"newFloatValue"
+.LASF2946:
+	.string	"idle_power"
+.LASF1682:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF3078:
+	.string	"BLACKBOX_STATE_SEND_GPS_H_HEADER"
+.LASF797:
+	.string	"__DECL_SIMD_atan "
+.LASF2794:
+	.string	"dTermLpfHz"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1867:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1334:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2987:
+	.string	"gyroADCf"
+.LASF2788:
+	.string	"pt1Filter_s"
+.LASF2217:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_LAST"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2011:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2695:
+	.string	"motorConfig_s"
+.LASF2815:
+	.string	"navFlags"
+.LASF1087:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2387:
+	.string	"RESOURCE_IO"
+.LASF2184:
+	.string	"year"
+.LASF2226:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_INC"
+.LASF1970:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1958:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF2412:
+	.string	"DEVHW_BMA280"
+.LASF1568:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF2719:
+	.string	"PID_POS_HEADING"
+.LASF1101:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF2214:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_DEBUG"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2132:
+	.string	"BLACKBOX_SIMPLE_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)"
+.LASF1647:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF1174:
+	.string	"USE_OLED_UG2864 "
+.LASF1143:
+	.string	"USE_TELEMETRY_LTM "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF3295:
+	.string	"blackboxBuildConditionCache"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2003:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1690:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF2551:
+	.string	"name"
+.LASF1107:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1269:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2802:
+	.string	"pidController_t"
+.LASF2090:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2346:
+	.string	"OWNER_FREE"
+.LASF1445:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1718:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF2935:
+	.string	"BAT_VOLTAGE_RAW"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2383:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF2839:
+	.string	"mspOverrideChannels"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1036:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1124:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2621:
+	.string	"BOXLIGHTS"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF786:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1857:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1340:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2744:
+	.string	"fixedWingItermLimitOnStickPosition"
+.LASF1535:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF2779:
+	.string	"fixType"
+.LASF3002:
+	.string	"gyro_stage2_lowpass_type"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1734:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF3213:
+	.string	"pidBank"
+.LASF1394:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1475:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1118:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2918:
+	.string	"baroTemperature"
+.LASF806:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF3229:
+	.string	"resume"
+.LASF2040:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1277:
+	.string	"USE_DASHBOARD"
+.LASF1916:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1157:
+	.string	"USE_RANGEFINDER "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF2612:
+	.string	"BOXHEADINGHOLD"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2301:
+	.string	"blackboxWriteBuffer"
+.LASF3198:
+	.string	"getHwAccelerometerStatus"
+.LASF1432:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF2484:
+	.string	"sensorAccInitFuncPtr"
+.LASF2858:
+	.string	"SENSOR_INDEX_MAG"
+.LASF3005:
+	.string	"dynamicGyroNotchMinHz"
+.LASF1082:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1321:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2088:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2747:
+	.string	"iterm_relax_type"
+.LASF2723:
+	.string	"pidBank_s"
+.LASF3095:
+	.string	"rcData"
+.LASF2724:
+	.string	"pidBank_t"
+.LASF2280:
+	.string	"rate_num"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF798:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2963:
+	.string	"currentBatteryProfile"
+.LASF2113:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF2162:
+	.string	"uint32_t"
+.LASF1736:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1842:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2902:
+	.string	"up_delay"
+.LASF2229:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_VBATREF"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2457:
+	.string	"DEVHW_M25P16"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1925:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF3040:
+	.string	"lpfState"
+.LASF2043:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1686:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF2762:
+	.string	"axisPID_D"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2233:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB"
+.LASF1584:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF3016:
+	.string	"ZERO_CALIBRATION_IN_PROGRESS"
+.LASF1502:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1632:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF2760:
+	.string	"axisPID_P"
+.LASF1494:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1166:
+	.string	"USE_1WIRE "
+.LASF2094:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2666:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1912:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2006:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1455:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1780:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2894:
+	.string	"acc_notch_hz"
+.LASF3242:
+	.string	"blackboxWriteSysinfo"
+.LASF2511:
+	.string	"ADC_AIRSPEED"
+.LASF2901:
+	.string	"ut_delay"
+.LASF3115:
+	.string	"flightModeFlags"
+.LASF1031:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1891:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3022:
+	.string	"allowFailure"
+.LASF2235:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB"
+.LASF3299:
+	.string	"blackboxMayEditConfig"
+.LASF731:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1672:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1490:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1228:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1539:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1887:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1018:
+	.string	"__f32(x) x ##f32"
+.LASF1528:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF3311:
+	.string	"featureConfig"
+.LASF1993:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2974:
+	.string	"rollDeciDegrees"
+.LASF2036:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1414:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1822:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2289:
+	.string	"BLACKBOX_DEVICE_SERIAL"
+.LASF1438:
+	.string	"BIT(x) (1 << (x))"
+.LASF1809:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF3116:
+	.string	"failsafePhase"
+.LASF2031:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2409:
+	.string	"BUSTYPE_SDIO"
+.LASF737:
+	.string	"__DECL_SIMD_sin "
+.LASF2388:
+	.string	"RESOURCE_TIMER"
+.LASF3238:
+	.string	"blackboxCheckAndLogArmingBeep"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1038:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2849:
+	.string	"rssiSource_e"
+.LASF2020:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2852:
+	.string	"HW_SENSOR_UNAVAILABLE"
+.LASF2693:
+	.string	"attitudeEulerAngles_t"
+.LASF3102:
+	.string	"navPos"
+.LASF1209:
+	.string	"USE_VTX_CONTROL "
+.LASF3163:
+	.string	"castFloatBytesToInt"
+.LASF736:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1956:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2097:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1593:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2614:
+	.string	"BOXHEADADJ"
+.LASF1070:
+	.string	"_Mdouble_ _Float64x"
+.LASF2446:
+	.string	"DEVHW_LM75_4"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF3117:
+	.string	"rxSignalReceived"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2645:
+	.string	"BOXUSER1"
+.LASF2419:
+	.string	"DEVHW_MPU6000"
+.LASF1116:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2425:
+	.string	"DEVHW_BMP085"
+.LASF1860:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2300:
+	.string	"blackboxHeaderBudget"
+.LASF2128:
+	.string	"CONDITION(x) CONCAT(FLIGHT_LOG_FIELD_CONDITION_, x)"
+.LASF3055:
+	.string	"isSigned"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF925:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1399:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2092:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1028:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF3045:
+	.string	"pitot_t"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF3312:
+	.string	"blackboxWrite"
+.LASF1576:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF2007:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1746:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF512:
+	.string	"__wur "
+.LASF2305:
+	.string	"DEBUG_GYRO"
+.LASF3097:
+	.string	"accADC"
+.LASF837:
+	.string	"__DECL_SIMD_exp10 "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF3129:
+	.string	"fieldIndex"
+.LASF2230:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME"
+.LASF1731:
+	.string	"IOCFG_IPD 0"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1687:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2499:
+	.string	"magSensorToUse"
+.LASF1088:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2922:
+	.string	"CURRENT_SENSOR_NONE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2081:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2360:
+	.string	"OWNER_I2C"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1002:
+	.string	"__f128(x) x ##f128"
+.LASF1260:
+	.string	"USE_UART2 "
+.LASF3218:
+	.string	"getBatteryRawVoltage"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF2109:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2174:
+	.string	"size"
+.LASF3261:
+	.string	"nav_pids"
+.LASF1991:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2189:
+	.string	"millis"
+.LASF1710:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF3049:
+	.string	"blackboxHeader"
+.LASF843:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2860:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF2058:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1437:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1106:
+	.string	"M_E 2.7182818284590452354"
+.LASF3181:
+	.string	"blackboxPrintfHeaderLine"
+.LASF2454:
+	.string	"DEVHW_VL53L0X"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2705:
+	.string	"motorPoleCount"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF3277:
+	.string	"writeSlowFrame"
+.LASF1313:
+	.string	"FAST_CODE "
+.LASF2487:
+	.string	"initFn"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1706:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2761:
+	.string	"axisPID_I"
+.LASF1843:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1135:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF762:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1272:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF2618:
+	.string	"BOXMANUAL"
+.LASF2873:
+	.string	"SENSOR_PITOT"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1726:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2807:
+	.string	"fw_heading"
+.LASF1172:
+	.string	"USE_DASHBOARD "
+.LASF763:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2637:
+	.string	"BOXCAMERA1"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2639:
+	.string	"BOXCAMERA3"
+.LASF727:
+	.string	"__DECL_SIMD_cos "
+.LASF2750:
+	.string	"dBoostFactor"
+.LASF1642:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1217:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1410:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF2164:
+	.string	"size_t"
+.LASF2290:
+	.string	"BLACKBOX_DEVICE_END"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2501:
+	.string	"sensorMagReadFuncPtr"
+.LASF2835:
+	.string	"maxcheck"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1306:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1755:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF3119:
+	.string	"hwHealthStatus"
+.LASF2340:
+	.string	"featureConfig_s"
+.LASF2342:
+	.string	"featureConfig_t"
+.LASF719:
+	.string	"NULL"
+.LASF1547:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF3264:
+	.string	"blackboxAdvanceIterationTimers"
+.LASF3286:
+	.string	"curr"
+.LASF1292:
+	.string	"USE_VCP"
+.LASF3228:
+	.string	"snapshot"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF3269:
+	.string	"blackboxValidateConfig"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF3029:
+	.string	"params"
+.LASF1374:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2245:
+	.string	"FlightLogEvent"
+.LASF2420:
+	.string	"DEVHW_MPU6050"
+.LASF1554:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1371:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2669:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF2926:
+	.string	"CURRENT_SENSOR_MAX"
+.LASF2824:
+	.string	"halfDuplex"
+.LASF3068:
+	.string	"blackboxMainFields"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF721:
+	.string	"__need_NULL"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF3086:
+	.string	"mcPosAxisP"
+.LASF2467:
+	.string	"busdev"
+.LASF916:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1457:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF992:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2398:
+	.string	"RESOURCE_SPI_CS"
+.LASF1032:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF3240:
+	.string	"event"
+.LASF2112:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1262:
+	.string	"USE_UART4 "
+.LASF1148:
+	.string	"USE_PITOT_ADC "
+.LASF1474:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF3017:
+	.string	"ZERO_CALIBRATION_DONE"
+.LASF1721:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF810:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1468:
+	.string	"PG_RX_CONFIG 24"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1796:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF3168:
+	.string	"blackboxDeviceFlushForce"
+.LASF2393:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2028:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF3282:
+	.string	"optionalFieldCount"
+.LASF1754:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1515:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1946:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF2309:
+	.string	"DEBUG_SBUS"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1864:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1961:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1675:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1160:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1747:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3263:
+	.string	"writeGPSFrame"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1600:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF790:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2384:
+	.string	"RESOURCE_NONE"
+.LASF2957:
+	.string	"unit"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2945:
+	.string	"cruise_power"
+.LASF1452:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF2770:
+	.string	"gpsLocation_t"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1649:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2644:
+	.string	"BOXBRAKING"
+.LASF2355:
+	.string	"OWNER_PINDEBUG"
+.LASF1413:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF3072:
+	.string	"BlackboxState"
+.LASF1014:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2617:
+	.string	"BOXNAVPOSHOLD"
+.LASF2846:
+	.string	"RSSI_SOURCE_RX_CHANNEL"
+.LASF3206:
+	.string	"blackboxWriteSignedVB"
+.LASF1022:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF3108:
+	.string	"navSurface"
+.LASF3289:
+	.string	"predictor"
+.LASF2349:
+	.string	"OWNER_PPMINPUT"
+.LASF3132:
+	.string	"xmitState"
+.LASF2970:
+	.string	"mag_hardware"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1328:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1424:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2944:
+	.string	"voltageSource"
+.LASF1114:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1202:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2749:
+	.string	"iterm_relax"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1794:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1048:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2071:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"USE_PITOT_MS4525"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2063:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2191:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_ALWAYS"
+.LASF1612:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF2137:
+	.string	"BLACKBOX_SNAPSHOT_HISTORY_SLOTS 2"
+.LASF901:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1792:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2002:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1615:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1488:
+	.string	"PG_INAV_START 1000"
+.LASF2572:
+	.string	"DISARM_STICKS"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2430:
+	.string	"DEVHW_SPL06"
+.LASF2105:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2024:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2316:
+	.string	"DEBUG_SMARTAUDIO"
+.LASF3134:
+	.string	"blackboxIFrameInterval"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2494:
+	.string	"sensorMagInitFuncPtr"
+.LASF913:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF2019:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF2955:
+	.string	"warning"
+.LASF1909:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF784:
+	.string	"__DECL_SIMD_powf32x "
+.LASF754:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1198:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2495:
+	.string	"magDev_s"
+.LASF2507:
+	.string	"magDev_t"
+.LASF1389:
+	.string	"sq(x) ((x)*(x))"
+.LASF1213:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2302:
+	.string	"debug"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1964:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1635:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF2413:
+	.string	"DEVHW_ADXL345"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2282:
+	.string	"device"
+.LASF1757:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2689:
+	.string	"failsafePhase_e"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2172:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF2146:
+	.string	"__uint8_t"
+.LASF2565:
+	.string	"manual"
+.LASF1834:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1560:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1735:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF2865:
+	.string	"flightLogEventData_u"
+.LASF1183:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2127:
+	.string	"ENCODING(x) CONCAT(FLIGHT_LOG_FIELD_ENCODING_, x)"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF770:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2560:
+	.string	"rates"
+.LASF1932:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2632:
+	.string	"BOXSURFACE"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1863:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1251:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF3149:
+	.string	"iteration"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2725:
+	.string	"pidProfile_s"
+.LASF2758:
+	.string	"pidProfile_t"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF376:
+	.string	"unix 1"
+.LASF1763:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1257:
+	.string	"USE_MAG "
+.LASF2250:
+	.string	"FLIGHT_LOG_EVENT_IMU_FAILURE"
+.LASF1507:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF730:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF3030:
+	.string	"zeroCalibrationScalar_t"
+.LASF3062:
+	.string	"blackboxDeltaFieldDefinition_s"
+.LASF3067:
+	.string	"blackboxDeltaFieldDefinition_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1408:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1623:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF3234:
+	.string	"blackboxShouldLogIFrame"
+.LASF1300:
+	.string	"U_ID_0 0"
+.LASF1924:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1572:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF2676:
+	.string	"ALTITUDE_CONTROL"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1713:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1178:
+	.string	"USE_DJI_HD_OSD "
+.LASF1273:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1462:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF2818:
+	.string	"navAccNEU"
+.LASF1196:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2713:
+	.string	"PID_POS_XY"
+.LASF1163:
+	.string	"USE_OPFLOW_CXOF "
+.LASF3216:
+	.string	"getArmingBeepTimeMicros"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1699:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF899:
+	.string	"__DECL_SIMD_log10l "
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF774:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1839:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1782:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2268:
+	.string	"currentTimeUs"
+.LASF2209:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_RSSI"
+.LASF2776:
+	.string	"validEPE"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1551:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF2039:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1159:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF3211:
+	.string	"feature"
+.LASF1658:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1608:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1042:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF2546:
+	.string	"current_battery_profile_index"
+.LASF1266:
+	.string	"USE_UART8 "
+.LASF3217:
+	.string	"isModeActivationConditionPresent"
+.LASF2269:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF1184:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF905:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2848:
+	.string	"RSSI_SOURCE_MSP"
+.LASF3280:
+	.string	"frameStart"
+.LASF1849:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF910:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1200:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2513:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF811:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2456:
+	.string	"DEVHW_PCA9685"
+.LASF3176:
+	.string	"lrintf"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2361:
+	.string	"OWNER_SDCARD"
+.LASF2107:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1963:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1152:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1091:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2878:
+	.string	"acc_extremes_t"
+.LASF2610:
+	.string	"BOXHORIZON"
+.LASF2223:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2"
+.LASF1820:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF791:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1548:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2422:
+	.string	"DEVHW_BMI160"
+.LASF3248:
+	.string	"secondFieldDefinition"
+.LASF783:
+	.string	"__DECL_SIMD_powf128 "
+.LASF753:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2664:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2951:
+	.string	"cellMax"
+.LASF2755:
+	.string	"antigravityCutoff"
+.LASF2530:
+	.string	"FEATURE_DASHBOARD"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2008:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1730:
+	.string	"IOCFG_AF_OD 0"
+.LASF2159:
+	.string	"int64_t"
+.LASF1397:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF817:
+	.string	"__DECL_SIMD_hypot "
+.LASF1910:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2780:
+	.string	"numSat"
+.LASF2296:
+	.string	"flushedBytes"
+.LASF2549:
+	.string	"cpuUnderclock"
+.LASF1921:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF2012:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF795:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1565:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2555:
+	.string	"rcExpo8"
+.LASF2670:
+	.string	"AIRMODE_ACTIVE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2799:
+	.string	"derivative"
+.LASF2134:
+	.string	"BLACKBOX_FIRST_HEADER_SENDING_STATE BLACKBOX_STATE_SEND_HEADER"
+.LASF856:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1669:
+	.string	"NAV_BLACKBOX "
+.LASF1454:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1601:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2411:
+	.string	"DEVHW_NONE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF705:
+	.string	"_T_SIZE "
+.LASF969:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2907:
+	.string	"calculate"
+.LASF2330:
+	.string	"targetName"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1204:
+	.string	"USE_SERIALRX_CRSF "
+.LASF3090:
+	.string	"mcSurfacePIDOutput"
+.LASF1245:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1505:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF3056:
+	.string	"predict"
+.LASF2181:
+	.string	"timeUs_t"
+.LASF862:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3098:
+	.string	"vbat"
+.LASF1906:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2832:
+	.string	"rssiMax"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2570:
+	.string	"DISARM_NONE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF2623:
+	.string	"BOXOSD"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF3127:
+	.string	"blackboxLastArmingBeep"
+.LASF1055:
+	.string	"_Mdouble_ float"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2504:
+	.string	"externalRotation"
+.LASF3089:
+	.string	"mcSurfacePID"
+.LASF1816:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2980:
+	.string	"initialized"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1629:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF2748:
+	.string	"iterm_relax_cutoff"
+.LASF2308:
+	.string	"DEBUG_FLOW"
+.LASF1368:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF1663:
+	.string	"LAT 0"
+.LASF1665:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1570:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF998:
+	.string	"__HAVE_FLOAT128 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2249:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF782:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1227:
+	.string	"___int_ptrdiff_t_h "
+.LASF2240:
+	.string	"FLIGHT_LOG_FIELD_UNSIGNED"
+.LASF1356:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1500:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1222:
+	.string	"_T_PTRDIFF_ "
+.LASF1244:
+	.string	"__INT_WCHAR_T_H "
+.LASF773:
+	.string	"__DECL_SIMD_expf128 "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1444:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF2213:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1934:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF3245:
+	.string	"mainFrameChar"
+.LASF2110:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1987:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2536:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF1561:
+	.string	"GYRO_LPF_NONE 7"
+.LASF3009:
+	.string	"kalman_q"
+.LASF3010:
+	.string	"kalman_w"
+.LASF2872:
+	.string	"SENSOR_RANGEFINDER"
+.LASF827:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1013:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF835:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1207:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1442:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF3209:
+	.string	"blackboxDeviceFlush"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF3185:
+	.string	"blackboxWriteTag8_4S16"
+.LASF1051:
+	.string	"_Mdouble_"
+.LASF2594:
+	.string	"AUX11"
+.LASF2595:
+	.string	"AUX12"
+.LASF1191:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF2890:
+	.string	"acc_hardware"
+.LASF2633:
+	.string	"BOXFLAPERON"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2035:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF771:
+	.string	"__DECL_SIMD_expf32 "
+.LASF3140:
+	.string	"blackboxSlowFrameIteration"
+.LASF1767:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2964:
+	.string	"mag_s"
+.LASF2966:
+	.string	"mag_t"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1486:
+	.string	"PG_CF_END 56"
+.LASF3165:
+	.string	"strlen"
+.LASF2984:
+	.string	"sampleBufferActive"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2192:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1"
+.LASF2193:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2"
+.LASF2194:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3"
+.LASF2195:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4"
+.LASF2179:
+	.string	"timeDelta_t"
+.LASF2197:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6"
+.LASF2198:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7"
+.LASF2199:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1574:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1815:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2646:
+	.string	"BOXUSER2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2069:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2842:
+	.string	"rxConfig_System"
+.LASF2221:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS"
+.LASF1674:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF2764:
+	.string	"servo"
+.LASF2685:
+	.string	"FAILSAFE_LANDING"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1545:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf "
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF864:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1696:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2599:
+	.string	"yaw_deadband"
+.LASF1291:
+	.string	"USE_ADC"
+.LASF2093:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1591:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1170:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2488:
+	.string	"readFn"
+.LASF2369:
+	.string	"OWNER_LED_STRIP"
+.LASF2207:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1072:
+	.string	"__MATHDECL_1_IMPL"
+.LASF3268:
+	.string	"blackboxResetIterationTimers"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1130:
+	.string	"USE_SERIAL_RX "
+.LASF2062:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2257:
+	.string	"lastFlags"
+.LASF1416:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2080:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2343:
+	.string	"featureConfig_System"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF2742:
+	.string	"fixedWingReferenceAirspeed"
+.LASF1314:
+	.string	"NOINLINE "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1983:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2242:
+	.string	"FlightLogCompression"
+.LASF2985:
+	.string	"lastSampleTimeUs"
+.LASF2238:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NULL"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1446:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1476:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2065:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2201:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_MAG"
+.LASF1758:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2351:
+	.string	"OWNER_SERVO"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF3081:
+	.string	"BLACKBOX_STATE_SEND_SYSINFO"
+.LASF3193:
+	.string	"getHwPitotmeterStatus"
+.LASF2784:
+	.string	"groundCourse"
+.LASF2580:
+	.string	"rc_alias"
+.LASF1743:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF804:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1057:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1744:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1443:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2885:
+	.string	"extremes"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF919:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1008:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF3004:
+	.string	"dynamicGyroNotchQ"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1975:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1823:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2520:
+	.string	"FEATURE_GPS"
+.LASF2416:
+	.string	"DEVHW_L3GD20"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2672:
+	.string	"AIRPLANE"
+.LASF2627:
+	.string	"BOXNAVWP"
+.LASF1241:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2358:
+	.string	"OWNER_SYSTEM"
+.LASF1681:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF3302:
+	.string	"compassConfig"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2677:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF2952:
+	.string	"cellMin"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2694:
+	.string	"attitude"
+.LASF2083:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"blackboxBufferReserveStatus_e"
+.LASF1905:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1846:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1605:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2911:
+	.string	"baro_hardware"
+.LASF1319:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2068:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2336:
+	.string	"m_newM"
+.LASF2338:
+	.string	"m_newS"
+.LASF2578:
+	.string	"DISARM_REASON_COUNT"
+.LASF2377:
+	.string	"OWNER_TEMPERATURE"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2615:
+	.string	"BOXCAMSTAB"
+.LASF1781:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF802:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF3249:
+	.string	"fieldCount"
+.LASF2732:
+	.string	"dterm_lpf2_hz"
+.LASF777:
+	.string	"__DECL_SIMD_pow "
+.LASF981:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1498:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1679:
+	.string	"MIDRC_MAX 1700"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1590:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1467:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1302:
+	.string	"U_ID_2 2"
+.LASF1888:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2851:
+	.string	"HW_SENSOR_OK"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1876:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF2492:
+	.string	"accAlign"
+.LASF1117:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2831:
+	.string	"rssiMin"
+.LASF1949:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1717:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF3274:
+	.string	"loadSlowState"
+.LASF2881:
+	.string	"accADCf"
+.LASF851:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2606:
+	.string	"rcControlsConfig_System"
+.LASF2514:
+	.string	"FEATURE_VBAT"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF3266:
+	.string	"blackboxFinish"
+.LASF1318:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2391:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2698:
+	.string	"motorPwmRate"
+.LASF3194:
+	.string	"getHwRangefinderStatus"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2116:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF854:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1579:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2967:
+	.string	"compassConfig_s"
+.LASF2977:
+	.string	"compassConfig_t"
+.LASF2481:
+	.string	"CW180_DEG_FLIP"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2149:
+	.string	"__uint16_t"
+.LASF2600:
+	.string	"pos_hold_deadband"
+.LASF2810:
+	.string	"navActualVelocity"
+.LASF1105:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2166:
+	.string	"double"
+.LASF2709:
+	.string	"PID_ROLL"
+.LASF1967:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2055:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF3094:
+	.string	"fwPosPIDOutput"
+.LASF1648:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF371:
+	.string	"__linux 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2510:
+	.string	"ADC_CURRENT"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2438:
+	.string	"DEVHW_IST8308"
+.LASF2635:
+	.string	"BOXAUTOTRIM"
+.LASF1483:
+	.string	"PG_VTX_CONFIG 54"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF3225:
+	.string	"tail"
+.LASF2820:
+	.string	"receiverType"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF929:
+	.string	"__DECL_SIMD_atanhl "
+.LASF2716:
+	.string	"PID_LEVEL"
+.LASF2000:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1001:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1312:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2630:
+	.string	"BOXGCSNAV"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF803:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2402:
+	.string	"RESOURCE_ADC_CH4"
+.LASF2273:
+	.string	"syncBeep"
+.LASF2163:
+	.string	"uint64_t"
+.LASF1187:
+	.string	"USE_CMS "
+.LASF1606:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1259:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2990:
+	.string	"gyroConfig_s"
+.LASF3013:
+	.string	"gyroConfig_t"
+.LASF1253:
+	.string	"USE_IMU_FAKE "
+.LASF2303:
+	.string	"debugMode"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF3202:
+	.string	"memcmp"
+.LASF3143:
+	.string	"slowHistory"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF814:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2928:
+	.string	"VOLTAGE_SENSOR_NONE"
+.LASF2476:
+	.string	"CW90_DEG"
+.LASF2078:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1305:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2916:
+	.string	"baro_s"
+.LASF2920:
+	.string	"baro_t"
+.LASF2933:
+	.string	"BAT_CAPACITY_UNIT_MWH"
+.LASF2550:
+	.string	"throttle_tilt_compensation_strength"
+.LASF2960:
+	.string	"capacity"
+.LASF1423:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2834:
+	.string	"mincheck"
+.LASF2185:
+	.string	"month"
+.LASF1750:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1234:
+	.string	"_WCHAR_T "
+.LASF3135:
+	.string	"blackboxIteration"
+.LASF1122:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2640:
+	.string	"BOXOSDALT1"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF747:
+	.string	"__DECL_SIMD_sincos "
+.LASF2423:
+	.string	"DEVHW_ICM20689"
+.LASF805:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF2522:
+	.string	"FEATURE_UNUSED_4"
+.LASF1994:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2538:
+	.string	"FEATURE_UNUSED_8"
+.LASF718:
+	.string	"__need_size_t"
+.LASF2539:
+	.string	"FEATURE_UNUSED_9"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF3003:
+	.string	"dynamicGyroNotchRange"
+.LASF2032:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF845:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF978:
+	.string	"__DECL_SIMD_erfcf "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF848:
+	.string	"__DECL_SIMD_coshf "
+.LASF2219:
+	.string	"FlightLogFieldPredictor"
+.LASF1205:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF2722:
+	.string	"pid8_t"
+.LASF1190:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1714:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF3151:
+	.string	"blackboxSnapshotRing"
+.LASF2854:
+	.string	"hardwareSensorStatus_e"
+.LASF1293:
+	.string	"USE_RX_PPM"
+.LASF2930:
+	.string	"VOLTAGE_SENSOR_ESC"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF914:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2086:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1422:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1261:
+	.string	"USE_UART3 "
+.LASF2264:
+	.string	"_Bool"
+.LASF1620:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2461:
+	.string	"devHardwareType_e"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF3025:
+	.string	"zeroCalibrationParams_t"
+.LASF1616:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF3066:
+	.string	"Pencode"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2220:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_0"
+.LASF1221:
+	.string	"_PTRDIFF_T "
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2292:
+	.string	"BLACKBOX_RESERVE_TEMPORARY_FAILURE"
+.LASF1700:
+	.string	"HW_SENSOR_IS_HEALTHY(status) (status == HW_SENSOR_NONE || status == HW_SENSOR_OK)"
+.LASF1654:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1771:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF853:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1496:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF1556:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1650:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF3204:
+	.string	"getThrottleIdleValue"
+.LASF3304:
+	.string	"barometerConfig"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF3153:
+	.string	"blackboxSnapshotTail"
+.LASF1353:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF788:
+	.string	"__DECL_SIMD_acosf "
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2563:
+	.string	"throttle"
+.LASF2650:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2658:
+	.string	"SMALL_ANGLE"
+.LASF1728:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1866:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3138:
+	.string	"blackboxLoggedAnyFrames"
+.LASF1885:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF3012:
+	.string	"kalmanEnabled"
+.LASF1375:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1722:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF1439:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF3083:
+	.string	"BLACKBOX_STATE_RUNNING"
+.LASF1263:
+	.string	"USE_UART5 "
+.LASF758:
+	.string	"__DECL_SIMD_logf "
+.LASF2751:
+	.string	"dBoostMaxAtAlleceleration"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2120:
+	.string	"TEMPERATURE_LABEL_LEN 4"
+.LASF1199:
+	.string	"USE_RX_MSP "
+.LASF1769:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2906:
+	.string	"get_up"
+.LASF1741:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1586:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1677:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2904:
+	.string	"get_ut"
+.LASF2026:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1301:
+	.string	"U_ID_1 1"
+.LASF1881:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2173:
+	.string	"pgResetFunc"
+.LASF1127:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2861:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1119:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2033:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF3000:
+	.string	"gyro_notch_cutoff"
+.LASF1033:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2773:
+	.string	"validVelNE"
+.LASF2696:
+	.string	"maxthrottle"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2754:
+	.string	"antigravityAccelerator"
+.LASF3207:
+	.string	"blackboxWriteSignedVBArray"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF396:
+	.string	"false 0"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF813:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2315:
+	.string	"DEBUG_REM_FLIGHT_TIME"
+.LASF2741:
+	.string	"fixedWingItermThrowLimit"
+.LASF2091:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1930:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF953:
+	.string	"__DECL_SIMD_erff128 "
+.LASF3192:
+	.string	"getPowerSupplyImpedance"
+.LASF2983:
+	.string	"pidProcessDenom"
+.LASF2464:
+	.string	"busType"
+.LASF2431:
+	.string	"DEVHW_BMP388"
+.LASF1947:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1939:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF3037:
+	.string	"pito_s"
+.LASF2047:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF3235:
+	.string	"pFrameIndex"
+.LASF1550:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1265:
+	.string	"USE_UART7 "
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1179:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF2307:
+	.string	"DEBUG_FLOW_RAW"
+.LASF1449:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2869:
+	.string	"SENSOR_ACC"
+.LASF1035:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2524:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1508:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF3307:
+	.string	"pidProfile"
+.LASF3275:
+	.string	"slow"
+.LASF1974:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1527:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF3142:
+	.string	"gpsHistory"
+.LASF957:
+	.string	"__DECL_SIMD_tanh "
+.LASF1288:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1988:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2797:
+	.string	"integral"
+.LASF3064:
+	.string	"Iencode"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1660:
+	.string	"RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)"
+.LASF2310:
+	.string	"DEBUG_FPORT"
+.LASF3290:
+	.string	"blackboxWriteArrayUsingAveragePredictor16"
+.LASF1458:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF1540:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF2863:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF3154:
+	.string	"blackboxSnapshotPendingFlags"
+.LASF2186:
+	.string	"hours"
+.LASF912:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF3291:
+	.string	"writeIntraframe"
+.LASF1751:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1776:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1121:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2051:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1248:
+	.string	"_BSD_WCHAR_T_"
+.LASF1113:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2079:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1289:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1966:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF979:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1441:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF849:
+	.string	"__DECL_SIMD_coshl "
+.LASF1511:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1562:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF3006:
+	.string	"dynamicGyroNotchEnabled"
+.LASF2919:
+	.string	"baroPressure"
+.LASF2603:
+	.string	"airmodeHandlingType"
+.LASF358:
+	.string	"__k8 1"
+.LASF2757:
+	.string	"controlDerivativeLpfHz"
+.LASF1695:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2917:
+	.string	"BaroAlt"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1688:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2246:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF1090:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1015:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2255:
+	.string	"flightLogEvent_flightMode_s"
+.LASF3241:
+	.string	"blackboxShouldLogPFrame"
+.LASF3096:
+	.string	"gyroADC"
+.LASF2625:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF2940:
+	.string	"offset"
+.LASF3223:
+	.string	"blackboxProcess"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2785:
+	.string	"hdop"
+.LASF1581:
+	.string	"BOXID_NONE 255"
+.LASF2381:
+	.string	"OWNER_PINIO"
+.LASF2414:
+	.string	"DEVHW_MMA8452"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1168:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1904:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1954:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1803:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF2424:
+	.string	"DEVHW_MPU9250"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF915:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1390:
+	.string	"FAST_MATH "
+.LASF3260:
+	.string	"blackboxCurrent"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2759:
+	.string	"pidProfile_ProfileCurrent"
+.LASF3316:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF3039:
+	.string	"zeroCalibration"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2474:
+	.string	"ALIGN_DEFAULT"
+.LASF1132:
+	.string	"USE_SERIALRX_SBUS "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF2145:
+	.string	"__int8_t"
+.LASF2910:
+	.string	"barometerConfig_s"
+.LASF2914:
+	.string	"barometerConfig_t"
+.LASF3188:
+	.string	"getBaroTemperature"
+.LASF1369:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF887:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1285:
+	.string	"USE_PITOT_ADC"
+.LASF1046:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1400:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2631:
+	.string	"BOXKILLSWITCH"
+.LASF1789:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF759:
+	.string	"__DECL_SIMD_logl "
+.LASF2808:
+	.string	"navigationPIDControllers_t"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF733:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1025:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1026:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1231:
+	.string	"__need_ptrdiff_t"
+.LASF760:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1162:
+	.string	"USE_OPFLOW "
+.LASF1156:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1543:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2853:
+	.string	"HW_SENSOR_UNHEALTHY"
+.LASF999:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1810:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF3052:
+	.string	"fieldNameIndex"
+.LASF1761:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF989:
+	.string	"__DECL_SIMD_tanl "
+.LASF1338:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF2403:
+	.string	"RESOURCE_RX_CE"
+.LASF2886:
+	.string	"maxG"
+.LASF1208:
+	.string	"USE_RCDEVICE "
+.LASF1645:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF2005:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF3018:
+	.string	"ZERO_CALIBRATION_FAIL"
+.LASF1831:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2661:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1411:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF2534:
+	.string	"FEATURE_TRANSPONDER"
+.LASF765:
+	.string	"__DECL_SIMD_logf64x "
+.LASF3214:
+	.string	"isMixerUsingServos"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2729:
+	.string	"dterm_lpf_type"
+.LASF1716:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF997:
+	.string	"_BITS_FLOATN_H "
+.LASF2070:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1250:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF2054:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2256:
+	.string	"flags"
+.LASF1604:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1421:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2056:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1134:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1738:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2634:
+	.string	"BOXTURNASSIST"
+.LASF2066:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2121:
+	.string	"MAX_TEMP_SENSORS 8"
+.LASF2965:
+	.string	"magADC"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1069:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1693:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF3032:
+	.string	"pitotDev_s"
+.LASF3036:
+	.string	"pitotDev_t"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF808:
+	.string	"__DECL_SIMD_asinf "
+.LASF990:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF750:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2665:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF2518:
+	.string	"FEATURE_UNUSED_1"
+.LASF2753:
+	.string	"antigravityGain"
+.LASF2521:
+	.string	"FEATURE_UNUSED_3"
+.LASF2523:
+	.string	"FEATURE_TELEMETRY"
+.LASF2526:
+	.string	"FEATURE_UNUSED_5"
+.LASF2527:
+	.string	"FEATURE_UNUSED_6"
+.LASF2531:
+	.string	"FEATURE_UNUSED_7"
+.LASF1385:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF987:
+	.string	"__DECL_SIMD_tan "
+.LASF1347:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1110:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2129:
+	.string	"UNSIGNED FLIGHT_LOG_FIELD_UNSIGNED"
+.LASF1463:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1959:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF2204:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_VBAT"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1742:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1943:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2356:
+	.string	"OWNER_TIMER"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF1142:
+	.string	"USE_TELEMETRY "
+.LASF1732:
+	.string	"IOCFG_IPU 0"
+.LASF2981:
+	.string	"targetLooptime"
+.LASF1406:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF2938:
+	.string	"scale"
+.LASF1428:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2320:
+	.string	"DEBUG_RPM_FILTER"
+.LASF1477:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF3019:
+	.string	"zeroCalibrationState_e"
+.LASF2996:
+	.string	"gyro_soft_lpf_hz"
+.LASF2478:
+	.string	"CW270_DEG"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1633:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF2800:
+	.string	"feedForward"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF3023:
+	.string	"sampleCount"
+.LASF1303:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1503:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1501:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1791:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2206:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_SURFACE"
+.LASF1609:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2118:
+	.string	"ESC_DATA_INVALID 255"
+.LASF3184:
+	.string	"blackboxWriteTag8_8SVB"
+.LASF2225:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1697:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF1564:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2085:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"__DECL_SIMD_powf64x "
+.LASF755:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1097:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2077:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF3273:
+	.string	"newSlowState"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF725:
+	.string	"_MATH_H 1"
+.LASF3167:
+	.string	"blackboxDeviceEndLog"
+.LASF1680:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF2804:
+	.string	"surface"
+.LASF1061:
+	.string	"_Mdouble_ _Float32"
+.LASF1363:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF349:
+	.string	"__amd64 1"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1911:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2626:
+	.string	"BOXFAILSAFE"
+.LASF1409:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF2959:
+	.string	"cells"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2668:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1495:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF2141:
+	.string	"short unsigned int"
+.LASF1066:
+	.string	"_Mdouble_ _Float128"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1821:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1470:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1412:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF2076:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1979:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2205:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AMPERAGE"
+.LASF1890:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF3011:
+	.string	"kalman_sharpness"
+.LASF789:
+	.string	"__DECL_SIMD_acosl "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2622:
+	.string	"BOXNAVLAUNCH"
+.LASF3195:
+	.string	"getHwGPSStatus"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1990:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1405:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1603:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1295:
+	.string	"USE_RCDEVICE"
+.LASF3088:
+	.string	"mcVelAxisOutput"
+.LASF2147:
+	.string	"__int16_t"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2756:
+	.string	"navFwPosHdgPidsumLimit"
+.LASF1276:
+	.string	"USE_SERVO_SBUS"
+.LASF3313:
+	.string	"blackboxWriteBufferPosition"
+.LASF3141:
+	.string	"vbatReference"
+.LASF2329:
+	.string	"DEBUG_COUNT"
+.LASF1596:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1512:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2126:
+	.string	"PREDICT(x) CONCAT(FLIGHT_LOG_FIELD_PREDICTOR_, x)"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2102:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2021:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2025:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2868:
+	.string	"SENSOR_GYRO"
+.LASF2017:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2525:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF3059:
+	.string	"blackboxConditionalFieldDefinition_s"
+.LASF3061:
+	.string	"blackboxConditionalFieldDefinition_t"
+.LASF2114:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF2638:
+	.string	"BOXCAMERA2"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF917:
+	.string	"__DECL_SIMD_log1p "
+.LASF2314:
+	.string	"DEBUG_CRUISE"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1595:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2921:
+	.string	"baro"
+.LASF775:
+	.string	"__DECL_SIMD_expf64x "
+.LASF3239:
+	.string	"blackboxLogEvent"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1161:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1376:
+	.string	"FC_VERSION_MINOR 6"
+.LASF2312:
+	.string	"DEBUG_SAG_COMP_VOLTAGE"
+.LASF1093:
+	.string	"FP_INFINITE 1"
+.LASF1326:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2352:
+	.string	"OWNER_SOFTSERIAL"
+.LASF3042:
+	.string	"lastSeenHealthyMs"
+.LASF2659:
+	.string	"FIXED_WING_LEGACY"
+.LASF2182:
+	.string	"pgRegistry_s"
+.LASF2178:
+	.string	"pgRegistry_t"
+.LASF2915:
+	.string	"barometerConfig_System"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1938:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1064:
+	.string	"_Mdouble_ _Float64"
+.LASF3092:
+	.string	"fwAltPIDOutput"
+.LASF2175:
+	.string	"address"
+.LASF3028:
+	.string	"zeroCalibrationValue_t"
+.LASF3060:
+	.string	"condition"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF761:
+	.string	"__DECL_SIMD_logf32 "
+.LASF2160:
+	.string	"uint8_t"
+.LASF2258:
+	.string	"flightLogEvent_flightMode_t"
+.LASF1006:
+	.string	"__HAVE_FLOAT32 1"
+.LASF3033:
+	.string	"delay"
+.LASF1192:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF809:
+	.string	"__DECL_SIMD_asinl "
+.LASF1779:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2502:
+	.string	"accDev_t"
+.LASF1309:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2543:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF2345:
+	.string	"IO_t"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2855:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF3247:
+	.string	"fieldDefinitions"
+.LASF3314:
+	.string	"blackboxConfigMutable"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1950:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2575:
+	.string	"DISARM_KILLSWITCH"
+.LASF1016:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2472:
+	.string	"scratchpad"
+.LASF3120:
+	.string	"powerSupplyImpedance"
+.LASF1145:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1520:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2947:
+	.string	"rth_energy_margin"
+.LASF1704:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF2131:
+	.string	"BLACKBOX_DELTA_FIELD_HEADER_COUNT ARRAYLEN(blackboxFieldHeaderNames)"
+.LASF2266:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF1555:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF2956:
+	.string	"critical"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1478:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1381:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF2942:
+	.string	"voltage"
+.LASF3131:
+	.string	"headerIndex"
+.LASF2684:
+	.string	"FAILSAFE_RETURN_TO_HOME"
+.LASF1723:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1914:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1158:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF2593:
+	.string	"AUX10"
+.LASF2228:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_1500"
+.LASF2180:
+	.string	"timeMs_t"
+.LASF991:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1258:
+	.string	"USE_BARO "
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1027:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1936:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF3170:
+	.string	"blackboxDeviceBeginLog"
+.LASF2165:
+	.string	"float"
+.LASF2001:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1976:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2480:
+	.string	"CW90_DEG_FLIP"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1852:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1330:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1708:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2286:
+	.string	"blackboxConfig_System"
+.LASF2140:
+	.string	"unsigned char"
+.LASF2975:
+	.string	"pitchDeciDegrees"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3175:
+	.string	"rxGetChannelValue"
+.LASF2701:
+	.string	"motorDecelTimeMs"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF857:
+	.string	"__DECL_SIMD_expm1 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1345:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1915:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2009:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1075:
+	.string	"__MATHDECL"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1359:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF3267:
+	.string	"blackboxStart"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1833:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1280:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2564:
+	.string	"stabilized"
+.LASF1634:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1806:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF3224:
+	.string	"blackboxUpdate"
+.LASF1146:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF3232:
+	.string	"canUseBlackboxWithCurrentConfiguration"
+.LASF1869:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1801:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1037:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2052:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF698:
+	.string	"__need_size_t "
+.LASF3208:
+	.string	"blackboxWriteUnsignedVB"
+.LASF2715:
+	.string	"PID_SURFACE"
+.LASF3300:
+	.string	"blackboxGetSnapshotsDropped"
+.LASF2468:
+	.string	"irqPin"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2087:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF3171:
+	.string	"blackboxDeviceClose"
+.LASF3146:
+	.string	"BLACKBOX_SNAPSHOT_SLOW_FRAME"
+.LASF373:
+	.string	"linux 1"
+.LASF2529:
+	.string	"FEATURE_LED_STRIP"
+.LASF2874:
+	.string	"SENSOR_OPFLOW"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2602:
+	.string	"mid_throttle_deadband"
+.LASF2706:
+	.string	"motorConfig_t"
+.LASF1920:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1352:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1537:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF2714:
+	.string	"PID_VEL_XY"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2089:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1154:
+	.string	"USE_RX_UIB "
+.LASF1506:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1848:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF2375:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1246:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3126:
+	.string	"blackboxState"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1725:
+	.string	"P0 101325.0f"
+.LASF3147:
+	.string	"BLACKBOX_SNAPSHOT_GPS_HOME"
+.LASF3148:
+	.string	"blackboxSnapshot_s"
+.LASF3150:
+	.string	"blackboxSnapshot_t"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1656:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2771:
+	.string	"hasNewData"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF2845:
+	.string	"RSSI_SOURCE_ADC"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2386:
+	.string	"RESOURCE_OUTPUT"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF3130:
+	.string	"startTime"
+.LASF3288:
+	.string	"prev2"
+.LASF1685:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1226:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1614:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2374:
+	.string	"OWNER_VTX"
+.LASF1940:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1729:
+	.string	"IOCFG_AF_PP 0"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF780:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2177:
+	.string	"reset"
+.LASF3057:
+	.string	"encode"
+.LASF3071:
+	.string	"blackboxSlowFields"
+.LASF1189:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1332:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2415:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1931:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2998:
+	.string	"gyro_to_use"
+.LASF3050:
+	.string	"blackboxFieldHeaderNames"
+.LASF1636:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2344:
+	.string	"ioTag_t"
+.LASF2939:
+	.string	"type"
+.LASF1774:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF2586:
+	.string	"AUX3"
+.LASF1542:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF787:
+	.string	"__DECL_SIMD_acos "
+.LASF3035:
+	.string	"pitotCalculateFuncPtr"
+.LASF3076:
+	.string	"BLACKBOX_STATE_SEND_HEADER"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2041:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF3262:
+	.string	"motorCount"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2489:
+	.string	"acc_1G"
+.LASF3250:
+	.string	"conditions"
+.LASF2234:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT"
+.LASF2986:
+	.string	"sampleDeltaTimeUs"
+.LASF1429:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF3205:
+	.string	"blackboxWriteSigned16VBArray"
+.LASF2506:
+	.string	"useExternal"
+.LASF3106:
+	.string	"navHeading"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1316:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1965:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1630:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF2433:
+	.string	"DEVHW_HMC5883"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2458:
+	.string	"DEVHW_UG2864"
+.LASF2231:
+	.string	"FlightLogFieldEncoding"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2774:
+	.string	"validVelD"
+.LASF2429:
+	.string	"DEVHW_LPS25H"
+.LASF812:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2042:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1684:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2541:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2537:
+	.string	"FEATURE_VTX"
+.LASF2628:
+	.string	"BOXAIRMODE"
+.LASF1989:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2962:
+	.string	"batteryMetersConfig_System"
+.LASF1218:
+	.string	"_STDDEF_H "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1466:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2354:
+	.string	"OWNER_SERIAL"
+.LASF3265:
+	.string	"writeGPSHomeFrame"
+.LASF2368:
+	.string	"OWNER_INVERTER"
+.LASF1637:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF1724:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF2496:
+	.string	"init"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1899:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2791:
+	.string	"GPS_home"
+.LASF2837:
+	.string	"rx_max_usec"
+.LASF1325:
+	.string	"UNIT_TESTED "
+.LASF2803:
+	.string	"navigationPIDControllers_s"
+.LASF728:
+	.string	"__DECL_SIMD_cosf "
+.LASF2200:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_SERVOS"
+.LASF1448:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1493:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1229:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2798:
+	.string	"proportional"
+.LASF1764:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF3174:
+	.string	"getAmperage"
+.LASF1773:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2470:
+	.string	"busDevice_s"
+.LASF1589:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2432:
+	.string	"DEVHW_DPS310"
+.LASF2768:
+	.string	"gpsFixType_e"
+.LASF3183:
+	.string	"blackboxCompressFrame"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1255:
+	.string	"USE_FAKE_MAG "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1186:
+	.string	"USE_STATS "
+.LASF960:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1096:
+	.string	"FP_NORMAL 4"
+.LASF2410:
+	.string	"busType_e"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1624:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1748:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1430:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF2727:
+	.string	"bank_fw"
+.LASF1059:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1459:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2367:
+	.string	"OWNER_MPU"
+.LASF2151:
+	.string	"__uint32_t"
+.LASF2318:
+	.string	"DEBUG_ITERM_RELAX"
+.LASF2016:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2954:
+	.string	"value"
+.LASF1447:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1052:
+	.string	"__MATH_PRECNAME"
+.LASF2473:
+	.string	"busDevice_t"
+.LASF1123:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1256:
+	.string	"USE_FAKE_GPS "
+.LASF2739:
+	.string	"pidSumLimit"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1370:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1798:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2509:
+	.string	"ADC_RSSI"
+.LASF2608:
+	.string	"BOXARM"
+.LASF3034:
+	.string	"start"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1858:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF855:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1197:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF3297:
+	.string	"testBlackboxConditionUncached"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1214:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF2660:
+	.string	"ANTI_WINDUP"
+.LASF1643:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF847:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2004:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1753:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1533:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF3107:
+	.string	"navTargetHeading"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1104:
+	.string	"MATH_ERREXCEPT 2"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2271:
+	.string	"errorCode"
+.LASF3257:
+	.string	"charsToBeWritten"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2272:
+	.string	"flightLogEvent_IMUError_t"
+.LASF1242:
+	.string	"_WCHAR_T_H "
+.LASF3315:
+	.string	"blackboxConfig"
+.LASF1362:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1929:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF3222:
+	.string	"blackboxInit"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1804:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2647:
+	.string	"BOXFPVANGLEMIX"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF3001:
+	.string	"gyro_stage2_lowpass_hz"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF2700:
+	.string	"motorAccelTimeMs"
+.LASF2254:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF1569:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1473:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2348:
+	.string	"OWNER_PWMINPUT"
+.LASF2895:
+	.string	"acc_notch_cutoff"
+.LASF1219:
+	.string	"_STDDEF_H_ "
+.LASF2656:
+	.string	"GPS_FIX"
+.LASF2782:
+	.string	"velNED"
+.LASF1224:
+	.string	"__PTRDIFF_T "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2882:
+	.string	"accVibeSq"
+.LASF2284:
+	.string	"compression"
+.LASF1005:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1661:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1517:
+	.string	"PG_ID_INVALID 0"
+.LASF2690:
+	.string	"roll"
+.LASF3054:
+	.string	"blackboxSimpleFieldDefinition_s"
+.LASF3058:
+	.string	"blackboxSimpleFieldDefinition_t"
+.LASF2573:
+	.string	"DISARM_SWITCH_3D"
+.LASF3298:
+	.string	"blackboxIsOnlyLoggingIntraframes"
+.LASF1392:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF2708:
+	.string	"motor"
+.LASF815:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF3285:
+	.string	"count"
+.LASF2583:
+	.string	"THROTTLE"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2122:
+	.string	"TEMPERATURE_INVALID_VALUE -1250"
+.LASF1307:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1737:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1526:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF2203:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_PITOT"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2350:
+	.string	"OWNER_MOTOR"
+.LASF1201:
+	.string	"USE_SERIALRX_SUMH "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2516:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2629:
+	.string	"BOXHOMERESET"
+.LASF1577:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF2596:
+	.string	"rcCommand"
+.LASF1223:
+	.string	"_T_PTRDIFF "
+.LASF892:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2726:
+	.string	"pidControllerType"
+.LASF1951:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1592:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF781:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1516:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF2979:
+	.string	"gyro_s"
+.LASF2988:
+	.string	"gyro_t"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2395:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1417:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF3038:
+	.string	"airSpeed"
+.LASF1030:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1480:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF3251:
+	.string	"secondCondition"
+.LASF3051:
+	.string	"blackboxFieldDefinition_s"
+.LASF3053:
+	.string	"blackboxFieldDefinition_t"
+.LASF1917:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2718:
+	.string	"PID_VEL_Z"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1997:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3189:
+	.string	"getIMUTemperature"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1489:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF2267:
+	.string	"logIteration"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f "
+.LASF3227:
+	.string	"blackboxLogSnapshot"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2707:
+	.string	"motorConfig_System"
+.LASF1740:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF729:
+	.string	"__DECL_SIMD_cosl "
+.LASF3155:
+	.string	"blackboxSnapshotsDropped"
+.LASF1827:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1671:
+	.string	"RADAR_MAX_POIS 5"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2319:
+	.string	"DEBUG_ERPM"
+.LASF3159:
+	.string	"rtcGetDateTime"
+.LASF2692:
+	.string	"values"
+.LASF1126:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF3073:
+	.string	"BLACKBOX_STATE_DISABLED"
+.LASF3173:
+	.string	"getRSSI"
+.LASF2896:
+	.string	"acc_soft_lpf_type"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2737:
+	.string	"axisAccelerationLimitRollPitch"
+.LASF1175:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF2075:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF996:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF2556:
+	.string	"dynPID"
+.LASF2790:
+	.string	"pt1Filter_t"
+.LASF1044:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1203:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1220:
+	.string	"_ANSI_STDDEF_H "
+.LASF954:
+	.string	"__DECL_SIMD_erff32x "
+.LASF2397:
+	.string	"RESOURCE_SPI_MISO"
+.LASF2441:
+	.string	"DEVHW_LIS3MDL"
+.LASF756:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1339:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1617:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF3161:
+	.string	"isWaypointListValid"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1366:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2277:
+	.string	"imuError"
+.LASF2968:
+	.string	"mag_declination"
+.LASF1382:
+	.string	"MW_VERSION 231"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1188:
+	.string	"CMS_MENU_OSD "
+.LASF2486:
+	.string	"busDev"
+.LASF1350:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1962:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2728:
+	.string	"bank_mc"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1651:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF3024:
+	.string	"stdDevThreshold"
+.LASF2053:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2867:
+	.string	"flightDynamicsTrims_t"
+.LASF2866:
+	.string	"flightDynamicsTrims_u"
+.LASF2482:
+	.string	"CW270_DEG_FLIP"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1017:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1103:
+	.string	"MATH_ERRNO 1"
+.LASF1167:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1137:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2735:
+	.string	"itermWindupPointPercent"
+.LASF1195:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF3310:
+	.string	"systemConfig"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1342:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1108:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1613:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF2535:
+	.string	"FEATURE_AIRMODE"
+.LASF1739:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2649:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF735:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF858:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1074:
+	.string	"__MATHDECL_ALIAS"
+.LASF2576:
+	.string	"DISARM_FAILSAFE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2364:
+	.string	"OWNER_BEEPER"
+.LASF2210:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0"
+.LASF2211:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1"
+.LASF2212:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2"
+.LASF1112:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF3043:
+	.string	"pressureZero"
+.LASF1249:
+	.string	"__need_wchar_t"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1559:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1380:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2104:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1875:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2830:
+	.string	"rssi_channel"
+.LASF3220:
+	.string	"blackboxDeviceOpen"
+.LASF1611:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2620:
+	.string	"BOXLEDLOW"
+.LASF2222:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE"
+.LASF2123:
+	.string	"DEFAULT_BLACKBOX_DEVICE BLACKBOX_DEVICE_SERIAL"
+.LASF2059:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2304:
+	.string	"DEBUG_NONE"
+.LASF2691:
+	.string	"pitch"
+.LASF2252:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF1694:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF1239:
+	.string	"_BSD_WCHAR_T_ "
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF3305:
+	.string	"accelerometerConfig"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF3169:
+	.string	"blackboxDeviceReserveBufferSpace"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1641:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1534:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF1056:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1786:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1519:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF3014:
+	.string	"gyroConfig_System"
+.LASF1287:
+	.string	"USE_1WIRE_DS2482"
+.LASF2674:
+	.string	"ROVER"
+.LASF2465:
+	.string	"devHwType"
+.LASF1897:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF3139:
+	.string	"blackboxLoggedIteration"
+.LASF1622:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF2030:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF394:
+	.string	"bool _Bool"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF801:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1646:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1895:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2663:
+	.string	"COMPASS_CALIBRATED"
+.LASF2953:
+	.string	"cellWarning"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1830:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2218:
+	.string	"FlightLogFieldCondition"
+.LASF776:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1109:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF3065:
+	.string	"Ppredict"
+.LASF988:
+	.string	"__DECL_SIMD_tanf "
+.LASF2571:
+	.string	"DISARM_TIMEOUT"
+.LASF1980:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2196:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5"
+.LASF829:
+	.string	"__DECL_SIMD_exp2l "
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF873:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1851:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2973:
+	.string	"magCalibrationTimeLimit"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1719:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF2331:
+	.string	"shortGitRevision"
+.LASF1873:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3105:
+	.string	"navTargetPos"
+.LASF1913:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2455:
+	.string	"DEVHW_MS4525"
+.LASF1240:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1532:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1968:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3271:
+	.string	"allowPeriodicWrite"
+.LASF1092:
+	.string	"FP_NAN 0"
+.LASF2322:
+	.string	"DEBUG_NAV_YAW"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2103:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2095:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"IOCFG_OUT_PP 0"
+.LASF3137:
+	.string	"blackboxIFrameIndex"
+.LASF779:
+	.string	"__DECL_SIMD_powl "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1720:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF2825:
+	.string	"rx_spi_protocol"
+.LASF3196:
+	.string	"getHwBarometerStatus"
+.LASF1870:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2130:
+	.string	"SIGNED FLIGHT_LOG_FIELD_SIGNED"
+.LASF1125:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF3221:
+	.string	"max_denom"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF3007:
+	.string	"dynamicGyroNotchAnalyser"
+.LASF3099:
+	.string	"amperage"
+.LASF3162:
+	.string	"getLooptime"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1655:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1549:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2826:
+	.string	"rx_spi_id"
+.LASF2335:
+	.string	"m_oldM"
+.LASF3233:
+	.string	"blackboxSnapshotCount"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2098:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2048:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1485:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1800:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2888:
+	.string	"accelerometerConfig_s"
+.LASF2897:
+	.string	"accelerometerConfig_t"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1819:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1933:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2879:
+	.string	"acc_s"
+.LASF2887:
+	.string	"acc_t"
+.LASF2148:
+	.string	"short int"
+.LASF2018:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1922:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1076:
+	.string	"__MATHCALL"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1978:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF3075:
+	.string	"BLACKBOX_STATE_PREPARE_LOG_FILE"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1308:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF898:
+	.string	"__DECL_SIMD_log10f "
+.LASF3254:
+	.string	"definitionStride"
+.LASF1136:
+	.string	"USE_ADC_AVERAGING "
+.LASF2673:
+	.string	"MULTIROTOR"
+.LASF2840:
+	.string	"rssi_source"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2819:
+	.string	"rxConfig_s"
+.LASF2841:
+	.string	"rxConfig_t"
+.LASF2686:
+	.string	"FAILSAFE_LANDED"
+.LASF1571:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1436:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF2382:
+	.string	"OWNER_IRLOCK"
+.LASF1235:
+	.string	"_T_WCHAR_ "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF700:
+	.string	"__size_t__ "
+.LASF1133:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2814:
+	.string	"navActualSurface"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1425:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2440:
+	.string	"DEVHW_MAG3110"
+.LASF3236:
+	.string	"blackboxCheckAndLogFlightMode"
+.LASF1396:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF859:
+	.string	"__DECL_SIMD_expm1l "
+.LASF3252:
+	.string	"headerCount"
+.LASF1985:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2462:
+	.string	"busDeviceDescriptor_s"
+.LASF2469:
+	.string	"busDeviceDescriptor_t"
+.LASF2745:
+	.string	"loiter_direction"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF3182:
+	.string	"blackboxWriteFloat"
+.LASF1337:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1351:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1111:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1998:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF3104:
+	.string	"navTargetVel"
+.LASF3177:
+	.string	"getNavigationPIDControllers"
+.LASF2813:
+	.string	"navLatestActualPosition"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2365:
+	.string	"OWNER_OSD"
+.LASF2392:
+	.string	"RESOURCE_EXTI"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1981:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1465:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2999:
+	.string	"gyro_notch_hz"
+.LASF1151:
+	.string	"USE_GYRO_KALMAN "
+.LASF1141:
+	.string	"USE_NAV "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2991:
+	.string	"gyro_align"
+.LASF1599:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1896:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2362:
+	.string	"OWNER_FLASH"
+.LASF1311:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1372:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1024:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF768:
+	.string	"__DECL_SIMD_expf "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1357:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF2931:
+	.string	"voltageSensor_e"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF3256:
+	.string	"LONGEST_INTEGER_STRLEN"
+.LASF2295:
+	.string	"blackboxWriteBuffer_s"
+.LASF2299:
+	.string	"blackboxWriteBuffer_t"
+.LASF1812:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF3279:
+	.string	"blackboxLast"
+.LASF1919:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF3187:
+	.string	"blackboxWriteTag2_3S32"
+.LASF1756:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2045:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1580:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1625:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2049:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1456:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2899:
+	.string	"baroOpFuncPtr"
+.LASF383:
+	.string	"SITL 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1021:
+	.string	"__f64x(x) x ##f64x"
+.LASF1420:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1388:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF3128:
+	.string	"blackboxLastFlightModeFlags"
+.LASF2913:
+	.string	"baro_calibration_tolerance"
+.LASF2969:
+	.string	"mag_align"
+.LASF1984:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2778:
+	.string	"gpsSolutionData_s"
+.LASF2786:
+	.string	"gpsSolutionData_t"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1237:
+	.string	"__WCHAR_T "
+.LASF2712:
+	.string	"PID_POS_Z"
+.LASF3199:
+	.string	"getHwGyroStatus"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1367:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1364:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF2624:
+	.string	"BOXTELEMETRY"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1969:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2927:
+	.string	"currentSensor_e"
+.LASF1715:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF2619:
+	.string	"BOXBEEPERON"
+.LASF2889:
+	.string	"acc_align"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1427:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2850:
+	.string	"HW_SENSOR_NONE"
+.LASF2542:
+	.string	"FEATURE_OSD"
+.LASF2337:
+	.string	"m_oldS"
+.LASF1698:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF2067:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2408:
+	.string	"BUSTYPE_SPI"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2153:
+	.string	"long int"
+.LASF2710:
+	.string	"PID_PITCH"
+.LASF2978:
+	.string	"compassConfig_System"
+.LASF1557:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF2498:
+	.string	"magAlign"
+.LASF1788:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2648:
+	.string	"BOXLOITERDIRCHN"
+.LASF2479:
+	.string	"CW0_DEG_FLIP"
+.LASF2993:
+	.string	"gyroSync"
+.LASF2100:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1802:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF807:
+	.string	"__DECL_SIMD_asin "
+.LASF2241:
+	.string	"FLIGHT_LOG_FIELD_SIGNED"
+.LASF1395:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2950:
+	.string	"cellDetect"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2616:
+	.string	"BOXNAVRTH"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1492:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1355:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2856:
+	.string	"SENSOR_INDEX_ACC"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1004:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3303:
+	.string	"batteryMetersConfig"
+.LASF1041:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3253:
+	.string	"needComma"
+.LASF1164:
+	.string	"USE_OPFLOW_MSP "
+.LASF1955:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2190:
+	.string	"dateTime_t"
+.LASF1039:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1996:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2787:
+	.string	"gpsSol"
+.LASF2997:
+	.string	"gyro_soft_lpf_type"
+.LASF1102:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2746:
+	.string	"navVelXyDTermLpfHz"
+.LASF2227:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD"
+.LASF1233:
+	.string	"__WCHAR_T__ "
+.LASF980:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF2326:
+	.string	"DEBUG_CD"
+.LASF1479:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2971:
+	.string	"magZero"
+.LASF2533:
+	.string	"FEATURE_UNUSED_10"
+.LASF2540:
+	.string	"FEATURE_UNUSED_11"
+.LASF3270:
+	.string	"writeSlowFrameIfNeeded"
+.LASF2262:
+	.string	"newValue"
+.LASF2870:
+	.string	"SENSOR_BARO"
+.LASF2139:
+	.string	"BLACKBOX_PRINT_HEADER_LINE_CUSTOM(...) case __COUNTER__: {__VA_ARGS__}; break;"
+.LASF2655:
+	.string	"GPS_FIX_HOME"
+.LASF2323:
+	.string	"DEBUG_DYNAMIC_FILTER"
+.LASF1073:
+	.string	"__MATHDECL_1"
+.LASF2651:
+	.string	"boxId_e"
+.LASF3121:
+	.string	"sagCompensatedVBat"
+.LASF2406:
+	.string	"BUSTYPE_NONE"
+.LASF1659:
+	.string	"RPM_FILTER_UPDATE_RATE_HZ 500"
+.LASF3178:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF2789:
+	.string	"state"
+.LASF3077:
+	.string	"BLACKBOX_STATE_SEND_MAIN_FIELD_HEADER"
+.LASF744:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1181:
+	.string	"USE_D_BOOST "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2943:
+	.string	"current"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF2451:
+	.string	"DEVHW_MAX7456"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1054:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF3145:
+	.string	"BLACKBOX_SNAPSHOT_RESUME"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF993:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1182:
+	.string	"USE_ANTIGRAVITY "
+.LASF2281:
+	.string	"rate_denom"
+.LASF3063:
+	.string	"Ipredict"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1777:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2781:
+	.string	"magData"
+.LASF911:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1752:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF395:
+	.string	"true 1"
+.LASF3230:
+	.string	"blackboxQueueIteration"
+.LASF2503:
+	.string	"fpMat3_t"
+.LASF1884:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1865:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF3255:
+	.string	"conditionsStride"
+.LASF889:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1775:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF3084:
+	.string	"BLACKBOX_STATE_SHUTTING_DOWN"
+.LASF1007:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2060:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1523:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF3244:
+	.string	"sendFieldDefinition"
+.LASF1100:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1095:
+	.string	"FP_SUBNORMAL 3"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2453:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF3191:
+	.string	"getBatterySagCompensatedVoltage"
+.LASF1497:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1099:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1023:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF2923:
+	.string	"CURRENT_SENSOR_ADC"
+.LASF1531:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF2399:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2400:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2401:
+	.string	"RESOURCE_ADC_CH3"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF726:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF3046:
+	.string	"pitot"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF2405:
+	.string	"BUSTYPE_ANY"
+.LASF769:
+	.string	"__DECL_SIMD_expl "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2721:
+	.string	"pid8_s"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2334:
+	.string	"stdev_s"
+.LASF2339:
+	.string	"stdev_t"
+.LASF1546:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2857:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1296:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2157:
+	.string	"int16_t"
+.LASF2099:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2013:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF796:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1628:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1944:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2253:
+	.string	"time"
+.LASF3201:
+	.string	"rxIsReceivingSignal"
+.LASF1619:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF3041:
+	.string	"lastMeasurementUs"
+.LASF742:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF2119:
+	.string	"ERPM_PER_LSB 100.0f"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1426:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2553:
+	.string	"systemConfig_System"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2500:
+	.string	"magADCRaw"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF3080:
+	.string	"BLACKBOX_STATE_SEND_SLOW_HEADER"
+.LASF2188:
+	.string	"seconds"
+.LASF1840:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2775:
+	.string	"validMag"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2135:
+	.string	"BLACKBOX_LAST_HEADER_SENDING_STATE BLACKBOX_STATE_SEND_SYSINFO"
+.LASF1861:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2515:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF778:
+	.string	"__DECL_SIMD_powf "
+.LASF896:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2568:
+	.string	"currentControlRateProfile"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1530:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1588:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2892:
+	.string	"accZero"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF732:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF2805:
+	.string	"fw_alt"
+.LASF1484:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF2836:
+	.string	"rx_min_usec"
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1063:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2251:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF1836:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1566:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1153:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1673:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF3091:
+	.string	"fwAltPID"
+.LASF2811:
+	.string	"navDesiredVelocity"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2883:
+	.string	"accClipCount"
+.LASF3203:
+	.string	"blackboxWriteBufferFlush"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF3087:
+	.string	"mcVelAxisPID"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1275:
+	.string	"USE_USB_MSC"
+.LASF1923:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF699:
+	.string	"__need_NULL "
+.LASF2260:
+	.string	"adjustmentFunction"
+.LASF1019:
+	.string	"__f64(x) x ##f64"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1598:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1451:
+	.string	"PG_CF_START 1"
+.LASF743:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF3306:
+	.string	"rxConfig"
+.LASF2357:
+	.string	"OWNER_RANGEFINDER"
+.LASF1268:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1882:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1678:
+	.string	"MIDRC_MIN 1200"
+.LASF939:
+	.string	"__DECL_SIMD_acoshl "
+.LASF2994:
+	.string	"looptime"
+.LASF3079:
+	.string	"BLACKBOX_STATE_SEND_GPS_G_HEADER"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2681:
+	.string	"FAILSAFE_IDLE"
+.LASF1212:
+	.string	"USE_VTX_FFPV "
+.LASF2566:
+	.string	"misc"
+.LASF1131:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2493:
+	.string	"sensorAccReadFuncPtr"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1461:
+	.string	"PG_PID_PROFILE 14"
+.LASF1472:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1320:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1000:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3281:
+	.string	"deltas"
+.LASF2765:
+	.string	"GPS_NO_FIX"
+.LASF2532:
+	.string	"FEATURE_BLACKBOX"
+.LASF1171:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2671:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF1707:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF967:
+	.string	"__DECL_SIMD_asinh "
+.LASF2821:
+	.string	"rcmap"
+.LASF1973:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3309:
+	.string	"rcControlsConfig"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1521:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1972:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"param"
+.LASF2738:
+	.string	"max_angle_inclination"
+.LASF1504:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2385:
+	.string	"RESOURCE_INPUT"
+.LASF1602:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1177:
+	.string	"USE_FRSKYOSD "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2989:
+	.string	"gyro"
+.LASF1281:
+	.string	"USE_RANGEFINDER"
+.LASF948:
+	.string	"__DECL_SIMD_erff "
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF877:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2875:
+	.string	"SENSOR_GPS"
+.LASF2730:
+	.string	"dterm_lpf_hz"
+.LASF3118:
+	.string	"rxFlightChannelsValid"
+.LASF1094:
+	.string	"FP_ZERO 2"
+.LASF2720:
+	.string	"PID_ITEM_COUNT"
+.LASF1460:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2404:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF2829:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF1336:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2317:
+	.string	"DEBUG_ACC"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1365:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF2905:
+	.string	"start_up"
+.LASF1583:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF2903:
+	.string	"start_ut"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2096:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF2435:
+	.string	"DEVHW_AK8975"
+.LASF1180:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1627:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1068:
+	.string	"_Mdouble_ _Float32x"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2371:
+	.string	"OWNER_RX"
+.LASF3158:
+	.string	"dateTimeFormatLocal"
+.LASF2806:
+	.string	"fw_nav"
+.LASF2183:
+	.string	"_dateTime_s"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1286:
+	.string	"USE_1WIRE"
+.LASF2084:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2270:
+	.string	"flightLogEvent_IMUError_s"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1618:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2607:
+	.string	"bitarrayElement_t"
+.LASF2557:
+	.string	"pa_breakpoint"
+.LASF2581:
+	.string	"ROLL"
+.LASF2554:
+	.string	"rcMid8"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2247:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF950:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2115:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2772:
+	.string	"gpsHeartbeat"
+.LASF2275:
+	.string	"inflightAdjustment"
+.LASF2822:
+	.string	"serialrx_provider"
+.LASF1712:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF1536:
+	.string	"SPIDEV_COUNT 4"
+.LASF2439:
+	.string	"DEVHW_QMC5883"
+.LASF2876:
+	.string	"SENSOR_GPSMAG"
+.LASF3190:
+	.string	"getEstimatedWindSpeed"
+.LASF1999:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"USE_LOG "
+.LASF2215:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_NEVER"
+.LASF1762:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2144:
+	.string	"signed char"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF766:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1487:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF2125:
+	.string	"BLACKBOX_SHUTDOWN_TIMEOUT_MILLIS 200"
+.LASF1434:
+	.string	"EXPAND_I(x) x"
+.LASF2736:
+	.string	"axisAccelerationLimitYaw"
+.LASF1140:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1349:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2937:
+	.string	"batVoltageSource_e"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1524:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF994:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2372:
+	.string	"OWNER_TX"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2609:
+	.string	"BOXANGLE"
+.LASF3284:
+	.string	"arrOffsetInHistory"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF3278:
+	.string	"writeInterframe"
+.LASF1749:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1538:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1071:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2763:
+	.string	"axisPID_Setpoint"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2558:
+	.string	"fixedWingTauMs"
+.LASF1928:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2877:
+	.string	"SENSOR_TEMP"
+.LASF1607:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1666:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2667:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF2187:
+	.string	"minutes"
+.LASF2050:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2082:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2505:
+	.string	"onBoard"
+.LASF2244:
+	.string	"FLIGHT_LOG_COMPRESSION_HUFFMAN"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1703:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF3136:
+	.string	"blackboxPFrameIndex"
+.LASF2769:
+	.string	"gpsLocation_s"
+.LASF3200:
+	.string	"rxAreFlightChannelsValid"
+.LASF1169:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1404:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1383:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF2992:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3070:
+	.string	"blackboxGpsHFields"
+.LASF2306:
+	.string	"DEBUG_AGL"
+.LASF2278:
+	.string	"flightLogEventData_t"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1020:
+	.string	"__f32x(x) x ##f32x"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF3226:
+	.string	"blackboxLogQueuedSnapshots"
+.LASF2154:
+	.string	"__uint64_t"
+.LASF1711:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1768:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2816:
+	.string	"navEPH"
+.LASF2687:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2074:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2817:
+	.string	"navEPV"
+.LASF2156:
+	.string	"int8_t"
+.LASF2796:
+	.string	"last_input"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1986:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1995:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2101:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF902:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1971:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2859:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF3317:
+	.string	"blackboxSInterval"
+.LASF2766:
+	.string	"GPS_FIX_2D"
+.LASF2891:
+	.string	"acc_lpf_hz"
+.LASF1386:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1941:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1893:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3296:
+	.string	"cond"
+.LASF2976:
+	.string	"yawDeciDegrees"
+.LASF2426:
+	.string	"DEVHW_BMP280"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2022:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1787:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2893:
+	.string	"accGain"
+.LASF3026:
+	.string	"accumulatedValue"
+.LASF2452:
+	.string	"DEVHW_SRF10"
+.LASF1903:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2170:
+	.string	"PGR_SIZE_MASK"
+.LASF1264:
+	.string	"USE_UART6 "
+.LASF1043:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1435:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1582:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2161:
+	.string	"uint16_t"
+.LASF2767:
+	.string	"GPS_FIX_3D"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1813:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3100:
+	.string	"rssi"
+.LASF2900:
+	.string	"baroDev_s"
+.LASF3231:
+	.string	"head"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2561:
+	.string	"fpvCamAngleDegrees"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1377:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF1335:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1279:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF2243:
+	.string	"FLIGHT_LOG_COMPRESSION_NONE"
+.LASF2014:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2291:
+	.string	"BLACKBOX_RESERVE_SUCCESS"
+.LASF2477:
+	.string	"CW180_DEG"
+.LASF2880:
+	.string	"accTargetLooptime"
+.LASF1935:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3074:
+	.string	"BLACKBOX_STATE_STOPPED"
+.LASF1631:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1541:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1402:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2958:
+	.string	"batteryProfile_s"
+.LASF2961:
+	.string	"batteryProfile_t"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF3044:
+	.string	"pressure"
+.LASF1361:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1176:
+	.string	"USE_TELEMETRY_SIM "
+.LASF818:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1450:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF2459:
+	.string	"DEVHW_SDCARD"
+.LASF1297:
+	.string	"USE_ITCM_RAM"
+.LASF2528:
+	.string	"FEATURE_RSSI_ADC"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1238:
+	.string	"_WCHAR_T_ "
+.LASF1193:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1225:
+	.string	"_PTRDIFF_T_ "
+.LASF2224:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE"
+.LASF2176:
+	.string	"copy"
+.LASF1829:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1960:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1662:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF2202:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_BARO"
+.LASF1373:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1270:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1329:
+	.string	"EXTENDED_FASTRAM "
+.LASF1139:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF890:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2359:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2057:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2847:
+	.string	"RSSI_SOURCE_RX_PROTOCOL"
+.LASF2421:
+	.string	"DEVHW_MPU6500"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1129:
+	.string	"USE_RX_PPM "
+.LASF895:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF927:
+	.string	"__DECL_SIMD_atanh "
+.LASF2208:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_MC_NAV"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF3048:
+	.string	"blackboxConfig_Registry"
+.LASF767:
+	.string	"__DECL_SIMD_exp "
+.LASF1083:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1084:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1085:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF2699:
+	.string	"motorPwmProtocol"
+.LASF1115:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1676:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2688:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF2475:
+	.string	"CW0_DEG"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF951:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2333:
+	.string	"buildTime"
+.LASF3210:
+	.string	"getRSSISource"
+.LASF1513:
+	.string	"PG_INAV_END 1023"
+.LASF1274:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1575:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2704:
+	.string	"throttleScale"
+.LASF956:
+	.string	"__DECL_SIMD_erff128x "
+.LASF748:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2662:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1667:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1670:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF3152:
+	.string	"blackboxSnapshotHead"
+.LASF1783:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1889:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1144:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1278:
+	.string	"USE_OLED_UG2864"
+.LASF2680:
+	.string	"stateFlags"
+.LASF1894:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2483:
+	.string	"sensor_align_e"
+.LASF1818:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2034:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2150:
+	.string	"__int32_t"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1029:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1271:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF955:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1040:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF3308:
+	.string	"motorConfig"
+.LASF1165:
+	.string	"USE_PITOT_MS4525 "
+.LASF1003:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1825:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF977:
+	.string	"__DECL_SIMD_erfc "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1393:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF869:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2653:
+	.string	"bits"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF2675:
+	.string	"BOAT"
+.LASF2485:
+	.string	"accDev_s"
+.LASF1510:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF3294:
+	.string	"testBlackboxCondition"
+.LASF2683:
+	.string	"FAILSAFE_RX_LOSS_IDLE"
+.LASF1908:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2679:
+	.string	"FW_HEADING_USE_YAW"
+.LASF2239:
+	.string	"FlightLogFieldSign"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2733:
+	.string	"yaw_lpf_hz"
+.LASF1358:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2133:
+	.string	"BLACKBOX_CONDITIONAL_FIELD_HEADER_COUNT (BLACKBOX_DELTA_FIELD_HEADER_COUNT - 2)"
+.LASF3293:
+	.string	"newState"
+.LASF1453:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1644:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF2380:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1315:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1927:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2124:
+	.string	"BLACKBOX_INTERVED_CARD_DETECTION 0"
+.LASF1691:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2167:
+	.string	"pgn_t"
+.LASF2717:
+	.string	"PID_HEADING"
+.LASF3125:
+	.string	"rcModeActivationMask"
+.LASF2248:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF3157:
+	.string	"blackboxModeActivationConditionPresent"
+.LASF2948:
+	.string	"throttle_compensation_weight"
+.LASF1594:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF3292:
+	.string	"blackboxSetState"
+.LASF1243:
+	.string	"___int_wchar_t_h "
+.LASF2436:
+	.string	"DEVHW_IST8310_0"
+.LASF2437:
+	.string	"DEVHW_IST8310_1"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1173:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2072:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2046:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF2394:
+	.string	"RESOURCE_I2C_SDA"
+.LASF2636:
+	.string	"BOXAUTOTUNE"
+.LASF3015:
+	.string	"ZERO_CALIBRATION_NONE"
+.LASF3093:
+	.string	"fwPosPID"
+.LASF2909:
+	.string	"baroDev_t"
+.LASF799:
+	.string	"__DECL_SIMD_atanl "
+.LASF2155:
+	.string	"char"
+.LASF1471:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF3283:
+	.string	"blackboxWriteArrayUsingAveragePredictor32"
+.LASF2353:
+	.string	"OWNER_ADC"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1304:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1194:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF3144:
+	.string	"BLACKBOX_SNAPSHOT_INTRAFRAME"
+.LASF1379:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2407:
+	.string	"BUSTYPE_I2C"
+.LASF1652:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF2792:
+	.string	"pidControllerParam_t"
+.LASF1702:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1378:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1058:
+	.string	"_Mdouble_ long double"
+.LASF2106:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF764:
+	.string	"__DECL_SIMD_logf32x "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF792:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF819:
+	.string	"__DECL_SIMD_hypotl "
+.LASF2574:
+	.string	"DISARM_SWITCH"
+.LASF2613:
+	.string	"BOXHEADFREE"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2491:
+	.string	"imuSensorToUse"
+.LASF2285:
+	.string	"blackboxConfig_t"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1298:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF2995:
+	.string	"gyro_lpf"
+.LASF1060:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2460:
+	.string	"DEVHW_IRLOCK"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2652:
+	.string	"boxBitmask_s"
+.LASF2654:
+	.string	"boxBitmask_t"
+.LASF1701:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1859:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2934:
+	.string	"batCapacityUnit_e"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF906:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF3069:
+	.string	"blackboxGpsGFields"
+.LASF2396:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF3101:
+	.string	"navState"
+.LASF1945:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1668:
+	.string	"HDOP_SCALE (100)"
+.LASF2376:
+	.string	"OWNER_COMPASS"
+.LASF850:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF1343:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1333:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF2428:
+	.string	"DEVHW_MS5607"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF947:
+	.string	"__DECL_SIMD_erf "
+.LASF2924:
+	.string	"CURRENT_SENSOR_VIRTUAL"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3122:
+	.string	"wind"
+.LASF1317:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF3110:
+	.string	"blackboxGpsState_s"
+.LASF3113:
+	.string	"blackboxGpsState_t"
+.LASF2450:
+	.string	"DEVHW_DS2482"
+.LASF2582:
+	.string	"PITCH"
+.LASF749:
+	.string	"__DECL_SIMD_sincosl "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1957:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2898:
+	.string	"accelerometerConfig_System"
+.LASF2138:
+	.string	"BLACKBOX_PRINT_HEADER_LINE(name,format,...) case __COUNTER__: blackboxPrintfHeaderLine(name, format, __VA_ARGS__); break;"
+.LASF1346:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1765:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF3301:
+	.string	"gyroConfig"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2427:
+	.string	"DEVHW_MS5611"
+.LASF2237:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF3259:
+	.string	"loadMainState"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2697:
+	.string	"mincommand"
+.LASF1898:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1290:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF3114:
+	.string	"blackboxSlowState_s"
+.LASF3124:
+	.string	"blackboxSlowState_t"
+.LASF1770:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2925:
+	.string	"CURRENT_SENSOR_ESC"
+.LASF3197:
+	.string	"getHwCompassStatus"
+.LASF2544:
+	.string	"systemConfig_s"
+.LASF2552:
+	.string	"systemConfig_t"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1689:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF1982:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1855:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1211:
+	.string	"USE_VTX_TRAMP "
+.LASF2347:
+	.string	"OWNER_PWMIO"
+.LASF2641:
+	.string	"BOXOSDALT2"
+.LASF2108:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2642:
+	.string	"BOXOSDALT3"
+.LASF2027:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1384:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF1872:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2490:
+	.string	"ADCRaw"
+.LASF1797:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF466:
+	.string	"__PMT"
+.LASF2801:
+	.string	"output_constrained"
+.LASF1310:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2795:
+	.string	"integrator"
+.LASF2643:
+	.string	"BOXNAVCRUISE"
+.LASF1431:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF2657:
+	.string	"CALIBRATE_MAG"
+.LASF2327:
+	.string	"DEBUG_KALMAN"
+.LASF2298:
+	.string	"data"
+.LASF2604:
+	.string	"airmodeThrottleThreshold"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2844:
+	.string	"RSSI_SOURCE_AUTO"
+.LASF1705:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF2370:
+	.string	"OWNER_LED"
+.LASF746:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1254:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1552:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF1760:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1854:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2390:
+	.string	"RESOURCE_UART_RX"
+.LASF2711:
+	.string	"PID_YAW"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF772:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2843:
+	.string	"RSSI_SOURCE_NONE"
+.LASF2010:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1323:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2559:
+	.string	"rcYawExpo8"
+.LASF2259:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF2265:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1327:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1098:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF908:
+	.string	"__DECL_SIMD_log2f "
+.LASF2287:
+	.string	"blackboxConfig_Copy"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF2982:
+	.string	"sampleLooptime"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2548:
+	.string	"i2c_speed"
+.LASF1824:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2577:
+	.string	"DISARM_NAVIGATION"
+.LASF1215:
+	.string	"USE_CLI_BATCH "
+.LASF2908:
+	.string	"baroCalculateFuncPtr"
+.LASF1544:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1331:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2702:
+	.string	"digitalIdleOffsetValue"
+.LASF995:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF3243:
+	.string	"blackboxGetStartDateTime"
+.LASF1845:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF907:
+	.string	"__DECL_SIMD_log2 "
+.LASF2547:
+	.string	"debug_mode"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF1482:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1926:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2833:
+	.string	"sbusSyncInterval"
+.LASF1918:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1745:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2061:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1573:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF1433:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF2434:
+	.string	"DEVHW_AK8963"
+.LASF1398:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF904:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2871:
+	.string	"SENSOR_MAG"
+.LASF2038:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2389:
+	.string	"RESOURCE_UART_TX"
+.LASF949:
+	.string	"__DECL_SIMD_erfl "
+.LASF1841:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF897:
+	.string	"__DECL_SIMD_log10 "
+.LASF920:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2597:
+	.string	"rcControlsConfig_s"
+.LASF2605:
+	.string	"rcControlsConfig_t"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1499:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF2232:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB"
+.LASF1558:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2442:
+	.string	"DEVHW_LM75_0"
+.LASF2443:
+	.string	"DEVHW_LM75_1"
+.LASF2444:
+	.string	"DEVHW_LM75_2"
+.LASF2445:
+	.string	"DEVHW_LM75_3"
+.LASF959:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2447:
+	.string	"DEVHW_LM75_5"
+.LASF2448:
+	.string	"DEVHW_LM75_6"
+.LASF2449:
+	.string	"DEVHW_LM75_7"
+.LASF2417:
+	.string	"DEVHW_L3G4200"
+.LASF3103:
+	.string	"navRealVel"
+.LASF2236:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF3172:
+	.string	"blackboxReplenishHeaderBudget"
+.LASF1626:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF2508:
+	.string	"ADC_BATTERY"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1464:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF3186:
+	.string	"arraySubInt32"
+.LASF800:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2519:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF3123:
+	.string	"imuTemperature"
+.LASF3166:
+	.string	"isBlackboxDeviceFull"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1902:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1034:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF3276:
+	.string	"valid_temp"
+.LASF2293:
+	.string	"BLACKBOX_RESERVE_PERMANENT_FAILURE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1419:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2584:
+	.string	"AUX1"
+.LASF2585:
+	.string	"AUX2"
+.LASF1012:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2587:
+	.string	"AUX4"
+.LASF2588:
+	.string	"AUX5"
+.LASF2589:
+	.string	"AUX6"
+.LASF2590:
+	.string	"AUX7"
+.LASF2591:
+	.string	"AUX8"
+.LASF2592:
+	.string	"AUX9"
+.LASF838:
+	.string	"__DECL_SIMD_exp10f "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2152:
+	.string	"__int64_t"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2168:
+	.string	"PGR_PGN_MASK"
+.LASF3164:
+	.string	"blackboxPrint"
+.LASF2324:
+	.string	"DEBUG_DYNAMIC_FILTER_FREQUENCY"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1294:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF3237:
+	.string	"eventData"
+.LASF3020:
+	.string	"startTimeMs"
+.LASF1587:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2512:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1883:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1247:
+	.string	"__DEFINED_wchar_t "
+.LASF1518:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1481:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1953:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1128:
+	.string	"USE_I2C_PULLUP "
+.LASF1795:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF757:
+	.string	"__DECL_SIMD_log "
+.LASF738:
+	.string	"__DECL_SIMD_sinf "
+.LASF1785:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1514:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2171:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2734:
+	.string	"heading_hold_rate_limit"
+.LASF2373:
+	.string	"OWNER_RX_SPI"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1525:
+	.string	"DMA_NONE (0)"
+.LASF3047:
+	.string	"pgResetTemplate_blackboxConfig"
+.LASF3215:
+	.string	"getMotorCount"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2363:
+	.string	"OWNER_USB"
+.LASF2366:
+	.string	"OWNER_BARO"
+.LASF1230:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1401:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF852:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF717:
+	.string	"__size_t "
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1948:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1837:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF745:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2809:
+	.string	"navCurrentState"
+.LASF1009:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF3179:
+	.string	"blackboxPrintf"
+.LASF3082:
+	.string	"BLACKBOX_STATE_PAUSED"
+.LASF1387:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3212:
+	.string	"sensors"
+.LASF3111:
+	.string	"GPS_coord"
+.LASF2328:
+	.string	"DEBUG_SDCARD"
+.LASF1120:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF2678:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1324:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2517:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2611:
+	.string	"BOXNAVALTHOLD"
+.LASF3085:
+	.string	"blackboxMainState_s"
+.LASF3109:
+	.string	"blackboxMainState_t"
+.LASF1267:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF3160:
+	.string	"getWaypointCount"
+.LASF1610:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2044:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2862:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF1597:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF867:
+	.string	"__DECL_SIMD_sinh "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF909:
+	.string	"__DECL_SIMD_log2l "
+.LASF1811:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2158:
+	.string	"int32_t"
+.LASF3133:
+	.string	"blackboxConditionCache"
+.LASF1879:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1578:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF513:
+	.string	"__always_inline"
+.LASF1937:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF2276:
+	.string	"loggingResume"
+.LASF2463:
+	.string	"devicePtr"
+.LASF2297:
+	.string	"length"
+.LASF2216:
+	.string	"FLIGHT_LOG_FIELD_CONDITION_FIRST"
+.LASF1407:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF794:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1952:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1853:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2827:
+	.string	"rx_spi_rf_channel_count"
+.LASF1585:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1147:
+	.string	"USE_PITOT "
+.LASF2864:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1469:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2598:
+	.string	"deadband"
+.LASF2569:
+	.string	"disarmReason_e"
+.LASF3008:
+	.string	"dynamicGyroNotchCount"
+.LASF3258:
+	.string	"bytesToWrite"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF3027:
+	.string	"stdDev"
+.LASF2579:
+	.string	"disarmReason_t"
+.LASF2117:
+	.string	"ESC_DATA_MAX_AGE 10"
+.LASF1252:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2823:
+	.string	"serialrx_inverted"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1567:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1282:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1709:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF2418:
+	.string	"DEVHW_MPU3050"
+.LASF2783:
+	.string	"groundSpeed"
+.LASF3112:
+	.string	"GPS_numSat"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1509:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1344:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2932:
+	.string	"BAT_CAPACITY_UNIT_MAH"
+.LASF2142:
+	.string	"unsigned int"
+.LASF2313:
+	.string	"DEBUG_VIBE"
+.LASF2703:
+	.string	"throttleIdle"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2279:
+	.string	"blackboxConfig_s"
+.LASF2731:
+	.string	"dterm_lpf2_type"
+.LASF1807:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1047:
+	.string	"_Mdouble_ double"
+.LASF2037:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF2029:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1733:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2682:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF2562:
+	.string	"controlRateConfig_s"
+.LASF2567:
+	.string	"controlRateConfig_t"
+.LASF1440:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3436:
+	.string	"rx_pwm.h"
+.LASF3441:
+	.string	"msp_override.h"
+.LASF3415:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3340:
+	.string	"/usr/include"
+.LASF3421:
+	.string	"mathcalls-helper-functions.h"
+.LASF3419:
+	.string	"fp-logb.h"
+.LASF3417:
+	.string	"floatn-common.h"
+.LASF3397:
+	.string	"stdint.h"
+.LASF3440:
+	.string	"rpm_filter.h"
+.LASF3422:
+	.string	"platform.h"
+.LASF3319:
+	.string	"src/main/build"
+.LASF3337:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3382:
+	.string	"barometer.h"
+.LASF3396:
+	.string	"stdbool.h"
+.LASF3347:
+	.string	"time.h"
+.LASF3401:
+	.string	"wordsize.h"
+.LASF3357:
+	.string	"bus.h"
+.LASF3377:
+	.string	"navigation.h"
+.LASF3333:
+	.string	"src/main/target/SITL"
+.LASF3391:
+	.string	"mathcalls.h"
+.LASF3389:
+	.string	"blackbox_encoding.h"
+.LASF3365:
+	.string	"fc_core.h"
+.LASF3426:
+	.string	"common_post.h"
+.LASF3430:
+	.string	"parameter_group_ids.h"
+.LASF3352:
+	.string	"version.h"
+.LASF3398:
+	.string	"libc-header-start.h"
+.LASF3370:
+	.string	"failsafe.h"
+.LASF3385:
+	.string	"calibration.h"
+.LASF3362:
+	.string	"adc.h"
+.LASF3341:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3323:
+	.string	"src/main/drivers/barometer"
+.LASF3349:
+	.string	"blackbox.h"
+.LASF3356:
+	.string	"resource.h"
+.LASF3374:
+	.string	"servos.h"
+.LASF3328:
+	.string	"src/main/flight"
+.LASF3442:
+	.string	"rangefinder.h"
+.LASF3371:
+	.string	"imu.h"
+.LASF3351:
+	.string	"debug.h"
+.LASF3395:
+	.string	"stdc-predef.h"
+.LASF3361:
+	.string	"vector.h"
+.LASF3413:
+	.string	"math.h"
+.LASF3336:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3392:
+	.string	"temperature.h"
+.LASF3444:
+	.string	"io_def.h"
+.LASF3438:
+	.string	"quaternion.h"
+.LASF3399:
+	.string	"features.h"
+.LASF3335:
+	.string	"src/main"
+.LASF3329:
+	.string	"src/main/io"
+.LASF3324:
+	.string	"src/main/drivers/compass"
+.LASF3321:
+	.string	"src/main/config"
+.LASF3400:
+	.string	"features-time64.h"
+.LASF3412:
+	.string	"strings.h"
+.LASF3360:
+	.string	"compass.h"
+.LASF3322:
+	.string	"src/main/drivers/accgyro"
+.LASF3394:
+	.string	"beeper.h"
+.LASF3369:
+	.string	"runtime_config.h"
+.LASF3363:
+	.string	"config.h"
+.LASF3405:
+	.string	"stubs.h"
+.LASF3384:
+	.string	"gyro.h"
+.LASF3420:
+	.string	"fp-fast.h"
+.LASF3408:
+	.string	"time64.h"
+.LASF3390:
+	.string	"string.h"
+.LASF3359:
+	.string	"accgyro.h"
+.LASF3434:
+	.string	"bus_spi.h"
+.LASF3379:
+	.string	"diagnostics.h"
+.LASF3424:
+	.string	"target.h"
+.LASF3353:
+	.string	"maths.h"
+.LASF3388:
+	.string	"encoding.h"
+.LASF3327:
+	.string	"src/main/fc"
+.LASF3409:
+	.string	"wchar.h"
+.LASF3402:
+	.string	"timesize.h"
+.LASF3320:
+	.string	"src/main/common"
+.LASF3378:
+	.string	"rx.h"
+.LASF3339:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3433:
+	.string	"rcc_types.h"
+.LASF3325:
+	.string	"src/main/drivers/rangefinder"
+.LASF3437:
+	.string	"stats.h"
+.LASF3375:
+	.string	"gps.h"
+.LASF3439:
+	.string	"logic_condition.h"
+.LASF3381:
+	.string	"acceleration.h"
+.LASF3345:
+	.string	"stddef.h"
+.LASF3376:
+	.string	"filter.h"
+.LASF3348:
+	.string	"blackbox_fielddefs.h"
+.LASF3416:
+	.string	"floatn.h"
+.LASF3432:
+	.string	"bus_i2c.h"
+.LASF3423:
+	.string	"common.h"
+.LASF3428:
+	.string	"axis.h"
+.LASF3406:
+	.string	"stubs-64.h"
+.LASF3443:
+	.string	"io.h"
+.LASF3346:
+	.string	"parameter_group.h"
+.LASF3364:
+	.string	"controlrate_profile.h"
+.LASF3373:
+	.string	"pid.h"
+.LASF3445:
+	.string	"io_def_generated.h"
+.LASF3354:
+	.string	"feature.h"
+.LASF3350:
+	.string	"blackbox_io.h"
+.LASF3372:
+	.string	"mixer.h"
+.LASF3431:
+	.string	"exti.h"
+.LASF3380:
+	.string	"sensors.h"
+.LASF3414:
+	.string	"math-vector.h"
+.LASF3368:
+	.string	"rc_modes.h"
+.LASF3344:
+	.string	"stdint-uintn.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox.c"
+.LASF3330:
+	.string	"src/main/navigation"
+.LASF3404:
+	.string	"long-double.h"
+.LASF3366:
+	.string	"rc_controls.h"
+.LASF3383:
+	.string	"battery.h"
+.LASF3403:
+	.string	"cdefs.h"
+.LASF3418:
+	.string	"flt-eval-method.h"
+.LASF3331:
+	.string	"src/main/rx"
+.LASF3407:
+	.string	"typesizes.h"
+.LASF3318:
+	.string	"src/main/blackbox"
+.LASF3386:
+	.string	"pitotmeter.h"
+.LASF3425:
+	.string	"sanity_check.h"
+.LASF3410:
+	.string	"locale_t.h"
+.LASF3334:
+	.string	"src/main/target"
+.LASF3358:
+	.string	"sensor.h"
+.LASF3326:
+	.string	"src/main/drivers"
+.LASF3367:
+	.string	"bitarray.h"
+.LASF3429:
+	.string	"utils.h"
+.LASF3427:
+	.string	"build_config.h"
+.LASF3435:
+	.string	"dma.h"
+.LASF3332:
+	.string	"src/main/sensors"
+.LASF3343:
+	.string	"stdint-intn.h"
+.LASF3393:
+	.string	"wind_estimator.h"
+.LASF3411:
+	.string	"__locale_t.h"
+.LASF3342:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3446:
+	.string	"esc_sensor.h"
+.LASF3387:
+	.string	"blackbox.c"
+.LASF3355:
+	.string	"io_types.h"
+.LASF3338:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\244\n5\""
+	.string	"\226g\223F\200\230Nk\272\235\221wD\271\331\244l\306s R\240\252\352\343{\317wB\034<\212+P\370N@\024\246\373H\222$I\022\231\370\034\206i\252\352#ou*-\360\335l)EGQ\321C\310\356&_k\235\210\f{"
+	.string	"x"
+	.string	"y"
+	.string	"3>\267\352\315\305\227\222\006\211\224\371>T\347\324\342\232\311\031dzz\355\265\307\033s\004b\016\274\035Id\214o\334~\357\025'UULQ\315r\026\005\212\261\bC|\3700}R\321\300\002s\357\262\220Y!\016W\341\372*\\]8\372\375\236\236\236\f\366\310K\263rS\030\271\251*;\364G\1779\b\374\215i\r.N\273\325\254\246\236\363\367o;\362W\246\243\354\211u\262kWWYuONMLKJ\f\376\036\037\325\013M\354\231t,\360\361H`\300L\001\337"
+	.string	"\037y\346\331\321\231\231\363\305\331\2163\363f\246\315\367\3076\334\362\\\022cg\371\362\270\\~\321\337X\272f\325\327\246\243\034\002\257h\261\321\227\203sSs\315\321\256\374\246\327|W\276r\364\034\251)]u\314\243\235\346\233N\363\323\240"
+	.string	"\2561\332\202s[\"\277\333#\362\236\374\223\007j\317\266\f\353kP\235\302\347\024\303\320\340\344\013\334\323\254\312\005\013\025\244\326W\233\342\034\0210.\n\350\250\212\206\231I\331\232\020\244\362f\305E\002\323L\250EZ\032]\351\027\372\244\177\301#Y{d\364v\253\340/\272\bh\023\374D\023}\363/\037\267\b\266\017=\264\320\342\b\035t\220\023\230\261\257 r\017\242\326\322\002\344\006\024\n\364\003}"
+	.string	"\350\347\037\003\373,\001\267\004V\315j\3529[\374\362\232p\275\261\030\222M\341\230\261\002\035=\332\032\213w}zX*v\260\320\264R\\!k|U(\202lM,\274\023C%{T\366L\004\233gW2J\254\257h\324P\020\256\327\036\033\026\tT\310#\253/m\2040\016\317mK\304U\315\350\370\216\204@\3668\375\344t\017qH\032\237\017\020M75\241aL\332\232\037\034\\\272.cF<\374\310\332\300\356:\004\213/`\250\331q"
+	.ascii	"\222\321M\255m \026\251C\"E\303\372\252\376\b\201\030\250\301"
+	.ascii	"=1\221)MRZ\3261\005R\"\247\250\254\003\022\300\3431\230)\225"
+	.ascii	"\242\031\231\214\244\234\262\222Jc! Q(B\307p\231ZP\260Y\201\373"
+	.ascii	"\3179-\206\223W\022\210A1L1x\221\357\327\370\270K\006\245scH"
+	.ascii	"\0202\\\232)\003\212\253 \320bh\276`\317\023d);\027\374\347\022"
+	.ascii	"P|*}x\"\376"
+	.string	"\215\001\342\334\250\024\246\315\2511=67i\375U)\303H8\b\005I\355\177\006\340'$6\374>+\303fV\026\206\342%\006\313\334\2266d\235\031\365\241\314N\357\235=}n\374\377\346\003\350A\032F\207.\005c\013\007\217Nn\017\234\322\351\270S\255\274\271\037R\335\315\330\371c\306b\233\302\303\355\375MS\001:\r\244\033'\263\370\242X&T\030I\234b\276=\337\341\002\177\350R]~:\347s4W\325\003<\211\342Hx/\177%\355;\202\225\276\0300\231{5\344(\344p\230,\226\2602?\334\317d4\017\256\241g\262\370\005\207J\373\275\320\256+\322\337\322\323\227\347O\375\203\367e\f<\021d\307\253\331r\226\311,\263\203\204v\335\341\347Q\222\274\273b\323jE\257\356\322\345\252\371\215\243\306\223=v\220K\247-\320\376\024Wx\272\264\235\351\336#\304*=\343\370\337\326\306\217\020\343\366\377e"
+	.ascii	"\024\317\316\037?\2254\213\207\211oKs\016\226\366sO\026\006\023"
+	.ascii	"\f\204$\324\032\006\246\277\273P]\340\265\033\031j\262sp5\001"
+	.ascii	"\216\225\f\246V`\316/\227\263E\273x\201~;\027}\322\330\365\b"
+	.ascii	"\031_\255\376\226\304-/i\025\304\350\211\016\342\311p\\\266&"
+	.ascii	"\367\207\275\033\203\230}![\fX\337\r\340K\003\353W\313\373O\227"
+	.ascii	"\260\027\331\2433Vi\016\357&4|pY\370\026\\\326\341\035\275\340"
+	.ascii	"(\222\334z\250\372\324([2\302N"
+	.text
+	.section	.gnu.lto_.ipa_sra.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`3\003\265\b"
+	.string	"\342\307\026\033@W\032\003\314\313\r"
+	.string	""
+	.string	" \213\313[\3309\336"
+	.string	"\002S\234>6\322\267\224)\005\252\256\350\r-\350\343\351p\334\004t\221\236\262rM\346\304\234\227\265T\026E\235H6\242\377+D\035M%\243\036\366\216m\241\270\004\342\260\206\302\022v\007\325/"
+	.ascii	"L\246\231j\336\246+\303\325\b_\250\320\326&I\007\200\002\242"
+	.ascii	"\262\231\003\022`S!Me\nQ\001\tIHA\251\202\362\034\240\262\345"
+	.ascii	"\355_Y5\206\3424ekL\310\355\262\272\276\255F5\271\202@Y\013w"
+	.ascii	"\033\026h\365\034\353S\334\332P\246\230\255\002b\351$\372\270"
+	.ascii	"\206\336\224|\364:\322\r'\223\203T\001J6\314\364\250\276\315"
+	.ascii	"\311NU\032\024f&\363uC\n \233\215\340\266\020\247\372\335$\365"
+	.ascii	"\225}\350\337\354A\2227tP\037\020+m~<\350\303Oh\344w\004\276"
+	.ascii	"\353P;\210>&\364!\357T\312\005\324\316.P\032 /\322o\320\322\300"
+	.ascii	"\241l\310[\342\371\220\221\363\250H\026\272{\346Rs?"
+	.text
+	.section	.gnu.lto_.inline.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\244\026\2658"
+	.string	"V\377\330H\200XN:z\004@\331's\373\301\177\234\335(\312\362\0263\030\025\3619\304\251\270\321\030B\213r\001E\3530\335\347\304\260}V\252\352\305\230\362\021\362\300?8\336g\273\234\247T~\200\245w\370(\264m\222'vo)S\273"
+	.string	"\302"
+	.string	"\312"
+	.string	"\315\345\212\332\016\004?\017t\344\237}\265\330of?\226"
+	.string	"@\252Q\224U\320\320\233\277=\321\024\310\315\367\325\177\246\355\275A{{\336\236\366\336\336`}B\327E\256\367\363\376D\357\321\364>\275A\275\302)\314\253\205\372\250\203\005\232\017x\371\336`\013\211rR\302|\337\033\254Ueqk\346\201\367~X%\2740\377\245{/\323\357\373\357\323<\006\306>\235\364\305>-\"'"
+	.ascii	"\316\177c\203\322\374|3=\031\343\3773\304\177\346%;\323\247G"
+	.ascii	"\034\347Ll\024RoQ?{\037\350x\240c\377\377\331~\013\373\336{\315"
+	.ascii	"\277\250BA!\241\360\364\317Eu.Y\225\244\300\257\340:-\002\375"
+	.ascii	"\226\"\340\t\353V\\\022\331;z\241ej*1+1\324\376\377i^\362O\033"
+	.ascii	"\277T\305\374i\245\327\260\254 s\006v\322\237\317v\357=P\\\340"
+	.ascii	"\333)j\233\377\201\200Z\254nb/\360\023\253\225\034\330\230\203"
+	.ascii	"\013\315\305&C\256QA\370\200\237\207\325g\324c\367\336\232\347"
+	.ascii	"\374\314Gj+;%\027\246K\252O\\|\245`\270\343\034\275n3\264\370"
+	.ascii	"n\203\022\375\344\243\232\206\302\354+A[h~\237\213\025\213\b"
+	.ascii	"\025\270\234\323\374}{\376D\323\243\251\220=\360@\276\347+Ty"
+	.ascii	"\\Q\313a\276\203\035\203L\352\252\207m\200\310\374\207\352\335"
+	.ascii	"\335\235\227\226\371_\241\271w\306\204\250\274\204\305\254\320"
+	.ascii	"\306\237\347\242m\203xh\346}\276\317 \017}\243\351;}\247\300"
+	.ascii	"\003\337\300 ~+\177\315w<\007h~o&P\033\037\363jT/\231\024\214"
+	.ascii	"\t\007\301\312\243\216q\357\335\371\207\253{\357MY\\\362\305"
+	.ascii	"\357\036\372\034\326\230w\370\371\374\032\223o\317\272\254\232"
+	.ascii	"\350\254\n/\250$\027\336\023\217O\345\243F\215\245\304r\005J"
+	.ascii	"\354\023SSJ\354\355\2557x\242~JK\242\005\307N1\030\232\271\247"
+	.ascii	"\331\314\320\254\204{Z\211G\"\313\354i#o\212\211\241\215,\323"
+	.ascii	"57D\312\267\234\002S\223\264\034H\204}\244\t'\034\016\036\201"
+	.ascii	"oTi\260p\373j\020\246\007UT\343`~M\252>\270\240x1\230'\340\237"
+	.ascii	"\331r\255\321\024\265Uy8ia\327\024\377\273\356\336\253`\353\336"
+	.ascii	";\340\306\237/Cl YuI6Rm,\247N0\327\221\\\234i1!\200u\246\245"
+	.ascii	"&\340E\023\346\227\3676\331\374\250\307G-\245\205\353\bZ\333"
+	.ascii	"\260\264\370\240\271\021\3372\003\035\201\267A\340\333\006y\250"
+	.ascii	"\315\266\264]\331\247\027Ve\247C\\\233\272\352\276\314\374\304"
+	.ascii	"\246\2614b\305\203\314\006\016\315\ft\224\365\033x\307\274\206"
+	.ascii	"\026\262\016[=\357\230\032"
+	.string	"Z\351\2740\264$\362HP\"\377K\252\312\340h\372^\332`\310\335\234E\035\346x\007\327\033\002V\344\254\306\016\357\322dx!{\027V+O7\202\370\216dY\246\375N$\264\303\346}HX\205\240\220kT7\304\032\245,.y\363 [\020_ z\246\326>\201\267\250\2619\032\031\241\221$)H\226\003\321\004\204)\307\234\203\346\001\022\340\0025E\323\250B\212\030dh$\020\021\021\tRFRP\322\214\001X\233Gt\2252\024\243PB\266Ogs\024\f\025\326\325\323\032M\205e\356\327'2%\373\365xc\265\001QC\215\352\023\261\212\3523/\262,\035\246\2537\342bm\375\365\021\235\2032\361\357\224\250l\340\321\276Wa\335|\327\034\372\347\024Tm|]-\207\366\326\252\317{\321\177q\022B\366*\245\202K;K3\271\373pF\270\332\300\353$\312\0059\311\2668 \221\2752\260\274\272'@"
+	.ascii	"\371X\201\345\335\247`\255p\331\002JM'\250"
+	.string	"Y/)\255\023P\367\246c\216\362\265\266\340\245\023\356\364\236l\300\250\240Y\336t7sGJ{6\211\221<\377\3622D\"\003K\331\036\352\257g\273\252\241^\250\002\213\207g,\333\016\f4\f\230\315\213\263\037\337~# \022y\365\243$?M\270\254\320\031\234\313\347G8\2107\334\242\004\251\246\021\026}\312\215 \333oY\226\370\310'\233E'\253\177\204\021\032\302\363>\213RF\376y*\032\266L\342\202\006\356[\335\177@\254u\366\356\275\261|{\247gD\324\363\236\203q\025\036X\256\226\311\032\030 M0\260e\274b\347\033\321\227\204\260\346Da\332ch\362\035M\307\326U$\227\315\252%G\324\320%Z\375\360\r\204\250\324R=Z\002\037p\030\375\314\323\034\330\006R\214\004\030\274\373BQ\305A]\252\227\303\201\321\323d\022v2\371D\252\252M\006\005\33403\bq\260\030\304\215\334\332\036d\341\331"
+	.string	"\221U/\344\202\354\034\314\365\246\205\256\025\310wt\237\026HPv*\252\335\2668\267R31\364\323F\342\346\005\017\241\272Pj\371`\344\330E]\213P\t\224u_z\301\335~\214\272+J\301\306vk\034\336g\213\276\250\323\361\035T\347\031\035$\227\376k\270[\320{#_\027\303\223\030\204@\2315Q\225\224\303\2741\264\330\255@nu\257$\305\215\301\026o\211\265\021\177\260\352\027\034H^\317U\0328\2712\330j\304lB"
+	.string	"P\266\240\b\250\340\376\005\375dB$\253\227\345OA0\215\036m\rP\214\314V\320\357\316C\214\342\034\256)\267\037\362\033\264:\207Wa\271\365\334\024\271f\377\2661M\t1\305Y\371Q\264]\327\033\313\2025\210\337(]\230\006\356\223\321\\\372"
+	.ascii	"\203\223o4\307\352\276\361\207\3006U)\244\252|;~\2054\005X\244"
+	.ascii	"'7#+X\026\034~\331 \202x\335\006\271\002Z\021\304~b\n\360\325"
+	.ascii	"C\316\205\256\216}\244\210\314u\217O\021n\232^\275\034\021\353"
+	.ascii	"\202\n\177\230\343\300\201\264:\260\206\271\373w6C\260\250\031"
+	.ascii	"(jm\277\224\235\373\341\252V\207\345\036$\334\353!Y\001\234`"
+	.ascii	"i\370?\bzq\360\226\022\332\266J|\230\026\017)\313*f1*\366\263"
+	.ascii	"\r-i\235\006\357\274zR_)\311\277\363=\273Q!\210\007Q\246\031"
+	.ascii	"\262\\2\216\252\002\013$\026\320\004\226\333\214\335A\243\342"
+	.ascii	"\255\336\207\277\034\301?\"\223\035I\367\345\220\b\0330\374\207"
+	.ascii	"\340l\b\017\02135[\257+\031f\024\204 \300\\\277\375\007\263\330"
+	.ascii	"\216\331\b\272Zf\335w\035\001\201\312\371\321o7\017p@o+\205\217"
+	.ascii	"D\350d\017y\307g\036\310P\023\f\246E\373\001\257^\344O\233\206"
+	.ascii	"n5\214r\271\212\3375S\333\313\273\254*\371ZMt\273WaYe\270N"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\227/]Y"
+	.ascii	"\252f\020\026@`,7\007\220\243g6\326\304\305\352\276\304\347W"
+	.ascii	"7\371\340\272\204\370\032\264m\027\300\007\360{m\030\331G\264"
+	.ascii	"\260]\263L\342\001\232\3142\351\350Go=\251\355\f\262\342\321"
+	.ascii	"\212\177\303\335\322\266\224)\005G\001O\001S\001zd3\302\017\345"
+	.ascii	"\335\214\360\003\2013\302\253\234\021>5\013\263\021\316@\352"
+	.ascii	"\355Eg\204\r\204\2603\302O\244\336W\336\347u\361\2140\215\324"
+	.ascii	"\356\352\031\341'\265\370W\237\263\315v\225\337\253\374b\231"
+	.ascii	"(\221\3377\376\232\207W|G\344\f\256G\344wjA\236<\371\035\305"
+	.ascii	"\234\263\277c\330;\206\321y\334\217\215\265iSV\366t>\347\311"
+	.ascii	"\363\361\203\207\364\220\262\217\354Ct7n\024\344\252\252wA\233"
+	.ascii	"E\326$rgg\301,\222\3513\267O\225C\370\007_6\372\377\0313\001"
+	.ascii	"\003r\344"
+	.string	"|l\2132H\211\320P\225Fg\377{\036\027k\212\343\341\360\255\266~\\\034\327\371\034\226\335]?. W\220[\320\342\210\002ee\002\334\315\314\262\230E\321=\216\363\373Z\355o\2235\204\317?\347\337\354\337\377\027\307\233qq\374c\377o(U\021\243de\354\037\304\371\207\363\037\307\356p\b\300SL\375\330\207\rqH\371\213\225_\254\374\342\376\363\315]\304X\340\255\266\277\325\316\237 \273\357q\024\305\\.g\251\241\324\360\335B;g\017\221_\375\237u\034\353x\323{\237}\365\371u\034\277H\346/\222\275\273\350\356\r\\\344\341~\265\003q\354(\215\354\363\372\001dY\331_\355Y\371\337\375v{\027\321\277\356\361\032~w\260%\212k\3267\262\336\b\020\364\334]D~\376\277\242\270!\377\211\374\266\377l:\317]\313\275\364\254\207\2373\rw\337I\031\341Q\320\303\201\263!\373\211\031>5\365.\225"
+	.ascii	"\001\202\300\f\303\335_"
+	.string	"\270\273 #\033\357\220z\\C\352}f\3142*!\265m\034R\333D\352\321uk\214H\275%\345I\356\025\177/\356fq\267\344\007\362\264\375\356h?M\327\024\005\"\365\326\26539\244\036ke^-\265'\244\336x~\350\236w\f\2079\030\324\226\324~\354L\233\322^D\352\255!&\264\355\220\332\266\315\310H\275_\315\273\305l-{\t\251\267'\362DB\266\016Z%G\210H\275\001\321\314H\275im\320\200\311\"\205\326\204\324\266.#L#Bj\033mG\246X\322\227\021\026\031\221\332\346/\022\312#\222\211a\300\214\2608Ed\"\372\320\233t$}H\363Q\243\271\350$\331R\230\021\316\207H\275\375\301\031\251\307L\246\343L\006\313\230\021\316MH\275\363\2172#\374\225\314\214\360\037\372=hF\370\343\220z\247\031\341\037#\365V3\302_f\315\b?\0272\035N\250\353W\b\036\372+\201_\246"
+	.ascii	"\007\363\335\250z\301\364I]K\255\233\237k\331e\256\245o\267U"
+	.ascii	"\376\242|=M\224\313kMKt=Y*OU\236\332\252k\020\200\237m\271\356"
+	.ascii	"~]\301\335\252\266\352\017\347\247\251\376v[B\255\323|r\366\\"
+	.ascii	"\205my\366\234\334\324]"
+	.string	"\231\272\355l\013D\325\340W\331es0_\224\367zj+\344\355|\274V\005\356x\274r\312\301|;\226-\203]j\272\253pn\225-\273S\327\257\255\001\016\365\023\2560\321 \316\273\312\027\005\334\307k\321\2544UU\264\350\017-\001T\321\266\\\317\364\344\3618\260\250W\231\3001\260\272\034O\2273\323\023\005\221\023\201s\031\246.\006\315M\235\366\341ph\265s7\334\365\273\217\362\246\317\371\343\257\332\377U;\377\217\227H\275\021L\271\211Y\322Qp\210a\262d\351\211\230&\034b\361~ \372\023\231=\236\3177\355\343s\3764\357\304\325\321\303\345\021\226o\007\232@\200\372\241\227\270AD\013\356~\345&q\207\210\027\236\246o7$n\0211\211{d?\020\256\367\363\371\246\215|~\263\354\354QQRz\210&\342.\021\235\270M\266\024\233\365\003\2621\"\347\374_\303\335\2039\3369XO\356\300\324a"
+	.string	"\252ly\256\271\337Z\262\250i\225\333R\323\\O\315\231\300\017\b\274\365m\241i\017X\236i\007\250\t\021,D\250\260\035\260:\253\034\253\313\265\340p\002K\n\345:W*gu9V\267\375\267\242 ng[\232\271v-[6\267\245\226"
+	.ascii	"\340\254N\373\371+\201\271\266W\256\035\236\\\250\223 \324mO"
+	.ascii	"K\256\365l\201h.\353\311\201*\312\262\347\032\374\251\274\\\331"
+	.ascii	"\226\036\246\200\350\017\312\317\264m\325\325\327z\225?(\367"
+	.ascii	"\322yM\240=y+\f\266B\024P\036\202B\315\317\264\344\261\273'\277"
+	.ascii	"\022\352\234<U\271\322\364\344I\271P\247\275w\256m\251\3055\372"
+	.ascii	"z\266\247\211\026x\256\253\220\027\345\347\017m\203\252\232:"
+	.ascii	"\371O\005\236\346\216eO\236\211\006\251x\353\216\267B\271\211"
+	.ascii	"\376FW\203^\347n\365\265N\356\3446\312s\325\332\225\301\026\347"
+	.ascii	"\354v\017X\353\030t\352*\277\332\264d\325`me\325\340x\246[\345"
+	.ascii	"\257\346\344\036\260\262\322\223\253\366\024\205s0\337\355\267"
+	.ascii	"\236\255)\345\344&\260\3242\313\323\334u\225_Q\356\344`>(?\203"
+	.ascii	"_\355\356V\241\027L\243\374\334\002\226*RP9\230\b jb=\331\257"
+	.ascii	"\264\004r(\340-P\250\006\202\220\250\342\372\036\203\216\314"
+	.ascii	"\210\210\210$IR\350\002\n\020\006fq\036H%\273\003\022@\342,\204"
+	.ascii	"\221\030\307Q\310\030B\b\"\306\020e\210H \"\301\214\210\210\334"
+	.ascii	"t\2665A\360#\022Z\354\250xT\0323\200Q\220\036\376#\236x\255P"
+	.ascii	"\214\210\214#\254w\232\263m%9\213\206\3452nD\b \264\003\2125"
+	.ascii	"\331q\326\264\"O\007U\307\271\221\331\220P \231\316\037F\361"
+	.ascii	"\016\320OI\312\325\211\201\301X\370\337\267\210\303u\026\230"
+	.ascii	".-k\262eX_!. _!\316\201\342\006\205\025\323\201\002\207!;\016"
+	.ascii	"s\f\364\214\020g\332\0173\013A\365Q\225&\020\253f\006t\212\242"
+	.ascii	"Ye\226L\006Y\343G\227\224a\206\004\315CN\313\022\227\r\316r\332"
+	.ascii	"\300\316#\271 W\363\035\227&\221]\307\276z\265\274Y:\302In\266"
+	.ascii	"\343O,B\247\013\247\263\271\236\274\277k=/\202 \027\314#\271"
+	.ascii	"\021\3027\025\371Tn\232\305\363\340i\037\207!\0322\025 3\275"
+	.ascii	"oe\327c\315\342\300\202\252\312\235\334\266D\210J:\bp\352\021"
+	.ascii	"+'\021\351=\362:/~i\250\344x\023A\261=:\226\327\220v.\222pD\374"
+	.ascii	"\004\257\373\244:w\221)QiH\232Y\241\214S\311\300\273\017\321"
+	.ascii	"L\210?\022\222\204\n\357Kb\317\264\302it\207b\266\374^9\320\322"
+	.ascii	"\3649\350\332\344\210.\2171\300\326k\254H\235Oh\300\251\r3\253"
+	.ascii	"X\225\026\317X\f\265\240k\345\t^\231\033\315\213\332\312U\210"
+	.ascii	"CrY\016\200V\347\304\243\207\206\317\230\307\362;\367I\345\303"
+	.ascii	"\315U\036\340.\325+\337*\251\036\031u\252\035\316\"\212DW,\327"
+	.ascii	"&\037*k?Nc\254\317-7\213\302 N\315\346\002\036\223p\224\n\341"
+	.ascii	"\341g\242U\312\327:\235/)\032\333l\002\231\023\305\020\177)\034"
+	.ascii	"U3]\253\227Q\016\360j\"s\354\004\276F\255Z\363\236d\206\233d"
+	.ascii	"\200\246i\251\370\313\213zo\311\217.\313\321\235\257%W\277\275"
+	.ascii	"B\247AU4\343\313GR\301\001\002\310\337H\247@\r\241\244F\2031"
+	.ascii	"\274\027%_k\313\272\301\240I\336\021Tc"
+	.ascii	"\262\323\311\2266C\204\240L\375\331A*4\330#Du\264\302\0228\234"
+	.ascii	"L\251\247\363[\3741u\210GQ:\007J\247hYw\221^\333\354k\302\321"
+	.ascii	"\241#\025JD\230\b\306z\0135\215\002,~<'\311\320I\320\243\277"
+	.ascii	"|1\246\366#5Ms)k0\206&\247\2468\337\253 \332H@2\344;\352\311"
+	.ascii	"\246\261\246\2763Y\240\360g\221\023\362\232\252\334\024\207\203"
+	.ascii	"Z`6\303\246\244t\241\307\250H\036\260\252u7\220\350\304{}\361"
+	.ascii	"\2736D\334\263\274QE\251\237\305C\0035\344\016\266\353[\336\321"
+	.ascii	"\323:\334\350\037j\016\367\216\206\234&A!\001\372+ GW\243\217"
+	.ascii	"\n\203TH\337\t`\001\021\213\214\253\301\271\227,6\2028\211.\337"
+	.ascii	"\320(\232\325\024f\271\254',\333\343T\372x\257r\"qm \256\024"
+	.ascii	"\024\222\334\030\223\316\217C\212)\201l\235\324\037\t\364r\""
+	.ascii	"\250\205\373#\031\315\335\235k\323\016\252I\2142)2\265\220sA"
+	.ascii	"\306\344s\242X\030\007\304?\336\364\221\310z}J\fZ\276&\273\327"
+	.ascii	"\327\022\027\220\331E\214\366\324\341MR\314\341\235B\005\336"
+	.ascii	"\002\016\204)\314I#~%*))8\337\204\316f\035\020\fc<\004\2218\024"
+	.ascii	"F&s0e\211X8\322\270\336\007Y\030-\265_<\021\231\355k\026\240"
+	.ascii	"\200i\362\252\002d\255h\223\024z\245\021\020|e\031<\226\301\023"
+	.ascii	"\r\301,\310\310\257:#\245\026]\214\304\376\021\275%<\314\216"
+	.ascii	"\255\351\367\321\310^^R\363Yf\306\357E\327\331\0061\005C\371"
+	.ascii	"6S\"\201^\342\275\231\200o\246}\307\310\t,\232\246\316\227\021"
+	.ascii	"_\2058@\377\307b\211\235\224\033\233\037\204\2332\330n\355\274"
+	.ascii	"Mj\030\315\240a\013\333\333_eu\247\213\332\352Q\037\373cP\276"
+	.ascii	"h\365\343\242\256%kZ\364[\323M\235&\030v\"%\271\320\272\324\022"
+	.ascii	"\370\254\257\357\"m\005\240\212\266\273Q\037\nx\n\220\262\255"
+	.ascii	"\237!\277w\321\224u.?\016\315\2239m\212\246\031]\\"
+	.string	"\341\200\370\340\002\020\233O\364\2049\230?\207\211L\006\372\274\250D\261\306t\330c\b\"$\023\036\253\212\226s!,\217\310\226\213\3026\2157f\006@\341\013L\242\033\230\232\2351\213\313\365\376\246o:gy\223\316\rO\222\327\3503m\257\254\237`,w\217 &\205J\366\301\237\306\242:\204\334\267\202+\275E\315\310'JU\\\335\375\314$\254l\2202\227z\226H\322\237\314U@\250\376\r\034\\f#\027\240\363>\027\306\270y\324\270\233\266~\242\335\335\305\326)Qh\020\016\\\242>]4\240\234\243-\205\023\350\271:\214\274ijL\363<\361iv\277\035~\277q\315\3744\001\216T\256^O\246\340ovU=\f\351\323J\372c\266N\2612Z\006y\345  \333\242\270\335'\370\323\372d\215NIl\324\275\216\213<O\214\t\257\377+\244P\264\017\241n\022 \003 \361\031\365\201s\034\376\314\223u"
+	.ascii	"M\300\301\312n\350\211?\245\t\316;\3138\3663t\242Q\354\260\374"
+	.ascii	"3\232\001L\326\242\211\355\350]\254\264\273t\333\2607a!\025J"
+	.ascii	"L\0078o-\312\235P\375l\024<;\312#^\320\001PI2\336\036\350\r\200"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.pureconst.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 q\r\003"
+	.string	"\022G\027!`O\322\001!\bnm\036\006\022\306\370\025VXA>!\340P\2020x\241\354q\333\324\232\244\211\035\3633;\22337\237\346f>\314\274L\313\254\274(\257\311\224\314\310\205|\217\351\230\215\3138\264\370\024\037\342\036>\303,|\204;\230\202\033\230\200[]jN\203\244\033MK\230\231'"
+	.text
+	.section	.gnu.lto_.ipa_modref.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\323\005\325\027"
+	.string	"v\034cD\020\261\2461P\244\b%\024P"
+	.string	"T\b\245\250\" Pw\351\326g\240\262g\bP\331\273@c\266\335\276U\334\225\357c\360[L\273\322\200 \316\t\260\323M\001\nK\266G\257\277-\223\377|\357\355\277SJ\001D"
+	.string	"R"
+	.string	"Z"
+	.string	"n\334j\243\356\266\025\224R\326\315\352\230K\351\023\350L0\257E.\330HM\367\313-\322V\345\256\312w\217\332\345\036\334\327r{</\266\355\272\327\236\273f\371w\262\235\007\270Ew\366\332\245\273\005\372i3\235\027\030\005\224D\356\247\370\2415\224\"\241\fQ\201\362\023\326\375\224"
+	.string	"f\335\017\020\253;\217:\022\337\347y#dDt!\274T\207\242\241\361@|\360\320aF\346t\016\367\264\306\017\224\276\327-\230\001\220\331ZkY6\346'aE\243\352\312\330\035uq4/\\\330\330\264`\361\032\345.\312\251f\305k\223\273&*jR|\006\305A\013H\020Lo\245\341:\241*&2Q\342\031\326\322ZZ\213A\253)"
+	.string	"\261)LES\230Z\341f\216\225\033\033P\335j\004\304\2319\346\234S\312\226DN\007\013\214\021\244j\0340\271\030?\254\272\001\225#R\bk\202\320\325\223\321\311\210\024\322\332\357\352\315\237\241-\206_h-xX`L\335K\351\333\006\n\245\004\201\025\351<\253P\nm'\220ZKh\204\224\273)/\204\202\265\343\326P^uNNH\377\240wP70\016\215\031+\0311`\334\004\200\324\250\341l\306j\266\240\220i\r\220\002!**n\021 \236\2212\222\302\224$\313\001\006\245wD\326$\0347\021^\334\320I&\311\342\244lgP\366\301\236\001\241-N,\013#e\240\233\255\327\023R\262\330$\303\n\021\304V7I{\351\257\205\367T\350\026\332OZq\226\024\306\300\316\334"
+	.ascii	"\234C0\254\257_\024ECg\270e\224\363j)1Q\364\366i\306Bi\360\003"
+	.ascii	"7=\021\002;\n\016\324\207kV\205\210\310,x\371\316]\334\006\024"
+	.ascii	"\311h\225Rc\027\331\320\007J\375]\361\223\326\034\261\225\177"
+	.ascii	"Q&\321\315\342\217\320||\001\212\302\235X\335\330\272\2702Q\247"
+	.ascii	"\215\353\356c6\246\204\357\205^\241NdUP\033)o-\220\b\253\262"
+	.ascii	"/<\335?\003\234\232\221\3259\377\265\324O\213\215\262t\307\261"
+	.ascii	"F\264f\212\031!2Dbd\214\273d\021\355\315\233o,D\2545\243\326"
+	.ascii	"\371\251\2257\003$\222\213\367\037\017ET\024\002\022\357\205"
+	.ascii	"\243\207\262\277\260]\020\300\301\005\366\"f\240\312\364\215"
+	.ascii	"+<\024\020\263\264?+\036\351P\205(\216\002z\356\321\202^\025"
+	.ascii	"\214\316\351\220\306[I\004\200n\242a? ^\024\356\264\2251\223"
+	.ascii	"\226\"\333\001\035j\213w'\273b\370L\257\013\233\220\243a\205"
+	.ascii	"\375\205\003\325\324\310\270\3435#6I\212\r\007h"
+	.text
+	.section	.gnu.lto_.lto.a6ede7cc99f41482,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.17.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`^\001\r\016"
+	.string	"\266\331]E"
+	.string	"\261&\035\363Ph\333\235\002\371\030\003s\345f>=s\320.\323I\335\320\213\357\275\323BP\\K\261!a\013\202\327\232\203(\263\326\226$\375\357&\315\217\356\271\307\022\240\367\334\\\257\371\322Z7\262\267\224)\005H"
+	.string	"C"
+	.string	"K"
+	.string	"\373\362\342f\3673`\004\036\217\346\354\032\377d6\353D\254Z<\273\253i\210s\207\232\234\377\232\203<V\352\360\303\025&\320\300\343\002\200\245\202\037=\253\031\257yr`u\231\237\007\273\353\364X\036\356x\333\021lK\260\377\005y\357\321_\301\036\257 36-\371r\272\\\310\330\314a\177\251\324\030\373p\025\306>\315\017\3124\324\264j:5\375\f\263\021C"
+	.string	"\316n\207\227\216\315\211-H\330~fs*\006\231v\210\002\3564,\326\r\372i\255v\250\2468\211tP\334\303\361\237\260T\325Ok\303K\227/W+U\264\203\003\263\264KN\362\236\tt\232\362\207\013\206i\334\330\200P\215\311\375\t\273\222N\354\250\262\307\366v\023'\217\335]\340\227\370\207\342\217xt\312J\036\t\031\031\035h \022\t\225B\001L)&#\225\350\n\241\215dB\206\215TR\032\231\2204\013$\243\023\255\204B\321B\005\274]0\2414\f\333\206\322\262o\017Wa \334\310i\321\316 \265\255r\026, :\273+b\233\276\202\302"
+	.string	"\231G\025\016f\\\024\006\034"
+	.ascii	"8\311\007K\275\231\320\306\024\330\365\237\023\033C`\261\253"
+	.ascii	"\322\271A\366\322\300-\023\b\020\027\253\f4\303*\020\002\333"
+	.ascii	"\275\203$p\257\017\222I*\354\025\025\215\231\271\3215\274/\023"
+	.ascii	"\n\230\032\"\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_blackboxConfig_Registry.127.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 \233U\004"
+	.string	"\224\007b"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\201\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\374\006us\317\006uq"
+	.string	"\005\001\006'\001\b\205\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\005"
+	.ascii	"\314R0\345z\230\305S\324}\003(\002"
+	.text
+	.section	.gnu.lto_pgResetTemplate_blackboxConfig.129.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 .q\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\001?\202\210\200(\177}\274\001{\274\001y\273\001w\273\001u\273\001"
+	.text
+	.section	.gnu.lto_blackboxHeader.131.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 b\021\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"Q"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\206\b\177"
+	.string	"OH Product:Blackbox flight data recorder by Nicholas Sherlock\nH Data version:2\n"
+	.text
+	.section	.gnu.lto_blackboxFieldHeaderNames.132.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"\255\006"
+	.string	"t\013\265"
+	.string	""
+	.string	""
+	.string	"P"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\250\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'8\206\b{\370\304Ry\276\004\230\304\002}\301\003\330\377\001y\304\002\005\001'C\206\bw\377\001u\307'K\206\bs\330\376\001q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\tencoding"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\npredictor"
+	.string	"\007signed"
+	.string	"\005name"
+	.string	"\013"
+	.string	"\016\253\3044\244\006\226"
+	.ascii	"\302A\246YI\346\323}\\I\341\323\351\006\345\036\006\212"
+	.text
+	.section	.gnu.lto_blackboxMainFields.133.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\275 \315R"
+	.string	"\332~x\034;0\244N\007\223\037\267\013n\260\033x/\227bRnL\371FHmO\217iXo"
+	.string	"\310\372:\260g\340\224X\350\236\273\247<p"
+	.string	"\253\304\353bX\221\252t\320!0\222)I\271\003\274\001\267\001\246\001\257\267\341\032\037\035\331\337\303qW\256\022%\366\375\344\022\027\025\331\367\373C}\210\220\330\377\323*\242\301\276BB\366\377v\330S\"\300>\301@\366\001u\330\323\334X_#F\354\003\206=\321a\275<\366\tu\035Vt\307>\341\266\303ut\354\027\252[.\212\021\035b\277p\373\235\241(~sc\337P\277\242\265(ncc\337p\347EgQ<\b\215\375C\315\2047\215\342@e\354\037n"
+	.string	"y}\242\370\217\037\366\0235R\017O\024\353\311\303~\342n\332\233\023\305u\350\260\257\250\235\370\334D1\2347\354+\356"
+	.string	"}i\242x\215\032\366\027\265"
+	.ascii	"Fd\242\330L\031\366\027\367\200F_\2428\f\030\366\0315\201\353"
+	.ascii	"\300\017\213\311\341\261-Q\334\005sa\237q\013AJ\357\224\365\346"
+	.ascii	"\002\310\246\373\364\227\005\213\3257\352&\200dU\250X}\343V\""
+	.ascii	"\245\\\201R\244\355;\352\246 v\022\305O\360W\373\216{\271\336"
+	.ascii	"\334\304\221cc\373\217\372Q%J\355?\356\301\351\242b\233\323\264"
+	.ascii	"\020\302H\210mN\333\205\206\205mV\323\206\217\034\265Ym\3738"
+	.ascii	"\004\374k\363\232\206\304\250\257\315k\033Q/\257\315lz\211\224"
+	.ascii	"\352\210\244\350\216\231\331\266\244::fv\323j\242\034\242C\314"
+	.ascii	"\354\266g\2547\373}R|sc\3467u\221-z\t\2651\363\333\276\214h\321"
+	.ascii	"\2336\210\231\341\364\025R\252b\275\031_\007\223\356\0022\254"
+	.ascii	"K\326\274S\347%Cr\311\266\356\224\353\226E\257 %K\256\231\027"
+	.ascii	"\330\227\214@L\234\356\004\365\302\\\362\362\222^*77AJ\361\352"
+	.ascii	"\200\351\346{\237\230nVo\242\252R(\013\212\222n\267!\330\325"
+	.ascii	"%\035OGH\204(\351x\373o\275YB\034\\\322\363\364\223\241BI\317"
+	.ascii	"\333\023\330\326\222\256\247\357\326\233)\fBK\272\336\256 (P"
+	.ascii	"\322\367\264\0052@I\337\333o\353\315\027\372\360\311\341~\032"
+	.ascii	"C\036<9\334og\250C'\207\377i\035H)6[o\326\020\007N\225\377\355"
+	.ascii	"\rm\330T9\240^\323\240\251r@<\353\315\034\312\220Iz\240f\263"
+	.ascii	"\336\334!\f\230\244\007n0\353\315\036\274|\227\244\023\356@J"
+	.ascii	"1\226\365\346\017\257\005\353\222\375\330\213U9\341\366\201\224"
+	.ascii	"b\257\365\346\003 \036\313\225\326\ru\210\2472\245u\303-\342"
+	.ascii	"\245QZ?\324P\377\365NZ?\234\264\336<\302\261\221\351\211\233"
+	.ascii	"D%JLW\324%\026\025\231\256h\002\2175\3574\022\"\323\027w\341"
+	.ascii	"z\363\tB9$X\314\260\020\2103\356@\024\201\216\004\255\374\222"
+	.ascii	"\316K\341\327\250\365\306\255\202o\257uG\275B\021\236/j\335q"
+	.ascii	"_:\026tvuL>M\273\265p9,<\350\210\016Y\275\332Fs\341\206\260\360"
+	.ascii	"\340\324\337\334\200\274\233\016\202\224\336\351z3\202\027ml"
+	.ascii	"L\376m\303H\033\304\344\341t\f3AL\036n\337<\353\3152\246d\314"
+	.ascii	"\217\323f~\3720?n\237\271\036\317\303\374\271\353\006\315N\035"
+	.ascii	"\253\237\333\203\344\304\261z:\235\346\306\333X=\335%\243\346"
+	.ascii	"j\322\260_\247\327\334L\031\366\3536\233\213\t\303\276\235ns"
+	.ascii	"\355\205}\273M\310\267\214\261\217\247\013yX\026\366\361\266"
+	.ascii	"!\267R\205\375<\255\272\271\324\301\\\n\373y^\326\233\033\274"
+	.ascii	"\335\351\024\tN\364'\376\305\006N\307\3578\036\337\343|\374\217"
+	.ascii	"\003\3622\017\344g\216\346j\276\346\204\274\220\303y\234'\362"
+	.ascii	"9\337~\347y\256\347}\316\310\377\034\320\037\371\240\037:$\227"
+	.ascii	"\344\211\316\350\223\334\222_\362\307\367\372'\017\345\245<\330"
+	.ascii	"Wy+\237\345\303~\313sy\375_^\314\217y3\177\346\325\374\232w\363"
+	.ascii	"o^\316\317y;\177\347\365\374\236\367\363\177~\372eo\366g\237"
+	.ascii	"\366j\337\366\204\336\355\337^\356\017\375\334\323\375\376\273"
+	.ascii	"\307\373\274\347\373\276\367\373\277\027|G_\370\206\217\370\221"
+	.ascii	"^\361\027\237\322W\372\306w\314N\362W\216\222\245yJ\246\222\261"
+	.ascii	"\344,y,o\311:\177\311b\362\230l&\237\311jP\3446\331M\216\223"
+	.ascii	"\345\344:\331N\316\223\365\344>\331O&\313\323,\350DF"
+	.string	"3Q\203B\233\027\330\227\f\261&\036t\336)Y>\313f7p\343\024R\352\200+n\314\201r\031\020\354\250\235\017\320\037+\354\270\235\317\036+\374\250\037O\276c\205\037w\035\2359\254\247i&8oXO\333l\326\260\256\026\267\246A\303\372\232n*C\206\365\265\355\004\030\006\f\353l\272-s\311^\272\260\316\266\023\b\310aYL\013\353nZ\301\200\\%_\311VXw\3633\002`RZ\177\333\177\240\344'\255\303\351;\331\353\261u\2707\227,Yy\234\227\231\304\330z\334N\220(\251\3659\235e\275Y\001\244\303\326\347\\\312z\363\202\177\204u\311\236\360\007\255\234\0167\2567\033`\020\b\230\364:\335\240\021\243\244\327m\007{zI\267\323\210\353\315\017\026\005\252\226\363\n\252|.\241SG\234\316,\002\352\262y\005\315<\232T\252)\251\255\253$J&\225\n\232\025\005\315\212\202fEA\263\242\246\244"
+	.string	"8\251\242E\232\266\234TTSR6l\b\330\272J\022\225\265\374A5%\025@\205r%\227\255\262\310\223\253\252m\016P\225P\245T\373\004\240\022\321R6\233N\032\355\323I\205*\207teu\311T>\227G\232\312&\246\262\t@\205fE9\237\312\031H\225\310ry\244\352y\025\325\244^mm=\263JC*\312\371T\302D\252F\240Ng\263\252m\225N\352\222\b\027\364\n\nU6\251L\256!K\"L\352\323\tu6\231Tg\327s\271\305\244.\241Jh\325\026S\231e\243K\251\325\244\342\240\252\361\203\252F\333Fu)\265"
+	.string	"\250Y\313\037[N*(\263G\227R\313ImE$q\016\301j\225YC\240\264\256\224M\250\366\271\005%\202\202\352<\262|BA\235\316'T"
+	.ascii	"\265\310\223\253\252K\251\205T\257\331=\273jw\355\026\272\206"
+	.ascii	".\334\215\273\211\356\334\265\273\373.\272xw\357\362\335F\327"
+	.ascii	"\357\006^\301;x\t\357\341\205t%\335\304\313x']K\367\322}\304"
+	.ascii	"^\030"
+	.string	"\n\216\202\301\360\024l\005_\301aX\013\366\2025\026\203\307\3403\030\rf\203\333\3408X\016\266\203\357\340=\230\017\006\204\311\260 l\206\323\260\032&\204\013a8\034\207\023\3419l\2077^\204\361\360\036\346\303~\370\017;\302\217\260!>\304\221\260$\314\210'aK\370\222{\271\023\207\342Q|\212S\361+\216\305\265\270\230s\361.\376\305\301\370\030'\343g\034\215\257q6\376\306\341\370\234\202%\250\"\2311\003u\244 )(\243Ri\r\"\r\021!\026\253+\017\022\300\261@\212b0\232\257\220U\024\210\310\004\nzZ\020|\023K\365=t\252[\267\305&\365\331\241#\225\026\327\270\324\323\n\300\203\333Gt(\344B5'\377\026\373)\301\353\301\"\217\265-\316z\177\314\243hx\002\226\246\235-\353\220\300\321V\026F\233u\321D(4\\Qm_\360\346e\363\245\020\017\263UZt/\024pP'\033"
+	.ascii	"\bl\215f\273\b\346\023J\350\"\224)\022\320\302\231\254\005\032"
+	.ascii	"\336\002\304\312\242\264\002\372\"\304f"
+	.string	"\246\351\271\245kx\352\360\200\340\013\264Y\363H\363\214q}\263\245%\330t\251\263\270\001\016\025\243\245\316\345\0068\244\230\2536\376\222N\035ZE\343\001X\027p%\241\372\031\346\003\034\033\007 Ie\3574<\221\346H\356\370{\221\207\217\245\300\370Y\335-\200\343\343~\322?\242\245T\355\017\216\372^\247\336\2006\272\241\032\b;\350\204nz\003\236\272\030\013\260M\265\242\316\364\002\030u\310\013\320{\225\245\316n\0022t\350\013\320M7J\213bR\347z"
+	.ascii	"\214:\350\005h\257\363\352TW{\264\234\233#\\Z\354\001\314\241"
+	.ascii	"eZ\230\367\276\tu\347\027\t\300; \027\317\344\206\316\37786\343"
+	.ascii	"\244\"\356\241\021(\211\334\243\003`\211\337wD\340\262w\206\250"
+	.ascii	"\304\330\237FpE\354\013\367\034\\\364\301y\032-\373\320\236\002"
+	.ascii	"\324\232*\264\3616Q\211\351\373\375\373\203$\337Vg\216"
+	.string	"\030\350\034\365&Oc\024\361\320\035\177@]\"\211?\233\207\310D\357\004\310\021KL\227\220\231\200^~\333\243N%&\262\001\316\032E\264:w\f\002Y\311\013[\215\2035\353\304\031\331\323\250\331%\227\276\351\021\336\352\204w\240\355\356\253\006B\024\317\003\233\322&=o\377\bzc\262\2166\356\377\312r i\354\305\006\257\322\355\241\371\300\215\331\306=\260G\274xMu\305N:(Vw\320\211\003\305*\207\234tP\\=8@f]T\202\006\344\254E+\230`\306Z$\203\ffg\007,\240u\346Q\2628\347/a\034\006\021&\215\273b\027\021Zg\313\202b\314\002\r'\005\032\254o\301j\313\\\303\032\373\341\002B\270 \200\201\030\241\017\267\253\024\023\022!\002q\333V\241Z\374\304\021\034;%1X\373\230U\234\033){y\34700\221\r,\237\271\232\244\226\271\245\205E\370\235\203ob`\321\022\006"
+	.string	"\366R\360|'\003\213l9(`\225\202\30171\260h\t\003"
+	.string	"{)x\276\223\201E\264\301\021\235\370\022\263AA\336R\221|\345\365\032\317\202\362\213}\323\265\212\343\0051\314\371\3412#\202\300q9\362\3674g\301\305\304\250Q\027Z\267\262|\242:W\320V\377g\214\205\316i\013\276:#\250\275\2477r\035X}uu\374\004Pn\037\225\b\210\f\024x%9E\201\3272\003\2242\3764"
+	.ascii	"76B3\320\031Z\21054\030X\327d\207>NJ\205@h\226;OW\241\244\013"
+	.ascii	"\027\006"
+	.text
+	.section	.gnu.lto_blackboxGpsGFields.134.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\005\003\265\020"
+	.string	"T\031N\003"
+	.string	""
+	.string	"\253"
+	.string	"\005\001\006\035\001\001\005\001\006\030\001\002\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\310\334\n}\276?\202\210\2000{y\277\001w\275\001u\274\001s\273\001q\273\001o\273\025\001\r\001\230\344\005}\303\304\001w\302\f"
+	.string	"\330\337\005}\310\311\001w\307\013\177\005\001':\206\bm\230\337\005k\315\316\001w\314\001u\273\274\n\005\001'C\330\336\005k\321\322\t\005\001'L\206\bi\230\336\005g\325\326'V\206\be\330\335\005c\330\331\007\005\001'i\206\ba\230\335\005_\334\335\006\005\001't\206\b]\330\334\005[\340\341\274\273\006\025\001\005\202\001\334\005_\345\346\344\004\330\327\005_\351\352\003\005\001'\215\001\230\327\005}\355\356\231\001\206\bY\326\005W\361\362\035\001\026\246\001\206\bU\230\326\005S\366\367\365\364\360\001Q3\370\0014\363\001\360\001\357\001\354\001\353\001\350\001\347\001\343\001\342\001\337\001\336\001\333\001\332\0015\327\001\324\001\323\001\320\001\317\001\313\001\312\001\306\001\305\001\301\001\300\001"
+	.string	"\013GPS_velned"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\bepvh"
+	.string	"\thdop"
+	.string	"\022ground_course"
+	.string	"\nspeed"
+	.string	"\raltitudcoordnumSat"
+	.string	"\ffixType"
+	.string	"\005time"
+	.string	"D\250QP\242\234H\324Vi\230\003@#\221\222:\021\240(\345\2301\236\310(Qq\257\260\303\032\230\355\201R \231s\311\260\234\035\361R\262V:\363_\316\257!u\202\205\275\025\326\227\032~\251IUt\271b\206\021>\233\212\237\3739\342\372]\205\376\350\371\227"
+	.ascii	"t\003\267\t\f\2268\214c \301\022*\3024dAE\034\340{l\341\341H"
+	.ascii	"{\323m=g\220\004\007\271\325\277\243\317<k\254("
+	.text
+	.section	.gnu.lto_blackboxGpsHFields.135.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375 \302\235\004"
+	.string	"\204\007\177"
+	.string	""
+	.string	""
+	.string	"7"
+	.string	"\005\001\006\035\001\001\005\001\006\030'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\370\334\n}\276?\202\210\200({y\277\001w\275\001u\274\001s\273\001q\273"
+	.string	"\230\347\005}\302\303\001w\301\020o3\304\0014\300\001"
+	.string	"\tGPS_home"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/blackbox.c"
+	.string	"\n"
+	.string	"\303*PB\b`\223\252\f\005\222\301\n\257\243\354\002\373R\306\033"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_blackboxSlowFields.136.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\321\002\275\021"
+	.string	"v\035qI\320\026m:\024\tP\266Z\207\274@\352\n\346P=\325PO\325\343\f\362\025\fr?\036\260\340\336\230\026\302\270\301\366\304D\204\307Zk\277\335<\322/\032\207P%\246J\007r\001k}\310b\001\300\320\005W#tt\217M;^"
+	.string	"b"
+	.string	"["
+	.string	"\250\355F\371\0348n\013\235t\200\214\3624f\334\236\301\256\342\242\374\013\234\333\263\263F3g\266\267\210\264B\305\327Cg\250\231/\333\233\300[b\033\036\313\227\261^\242\374\t\233\016\f^\037<\274\230\270Q\321\23124b\366z\231\007\361vi\246h{\273\236`\364\376\025\214\336\224\207R\321NF\236\344=g\362&\377q\360(\rf\336\003\345\311M\373\234\317\331|\234L\350\237\223f\036g\211\022T\003\301,h\346Ilo"
+	.ascii	"H\216\\h\240\023\203f^\304\366\016@d\247H\206\226\242A3\037\242"
+	.ascii	"e1!A\276\016\202\271\266\367H\026\363q\326\016\3424\363no\001"
+	.ascii	"\262\330\016\035\266\205`\236f\006-\224\254\020h:K\326\fZ\361"
+	.ascii	"\013a\274\232\017\320\016\274e\243dbV(\347\322\nS5\\\305\251"
+	.ascii	"\022x\353W\342\306\\rY@C\321\216%2\f\307\022\211\332\221E\326"
+	.ascii	"\321\212\237\255\020\2165\305B\217\342)\316\342-\016\3431^\343"
+	.ascii	"6\236\363\340<\336\343?\016\344C\256s\236\0074{\025\233l\027"
+	.ascii	"\312\250Xh\366*6Y\262\222\231Dm\256+\tVU3\276UU\200v\226\303"
+	.ascii	"\265\234\245\200+\350\335Sk4@\273\213+M\306\026\004\353\n\206"
+	.ascii	"\\y\027\233Z#\002\232Yd%O+\022W\033\241\\\255P\313\201\265\263"
+	.ascii	"\342\027c\203E\221u\032m\031\212\001: `\223\002i\036\206\342"
+	.ascii	"\005\371\0217\223\243,P`~\230\0311\357M\256W[3lL\346\030)u\020"
+	.ascii	"\375etv\374\255\321v\276q\f[\223A\215\264\375\b\332{\2079i\027"
+	.ascii	"\242\336\201\032\231&\3422\204\260a;I\330v?\0265\203\253s\302"
+	.ascii	"P\311\b\242\023\206\226L\020\320\3116\272'\303[v/*\243\231\b"
+	.ascii	"Vc\035d]\206\036j\021"
+	.text
+	.section	.gnu.lto_blackboxGetSnapshotsDropped.159.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\375\006"
+	.string	"B\31504`O\322\001pH\bG\017\343Cp\215FCr\2635\266\007"
+	.string	"\304E\320H\263\333.\376\024oJ#@\376a`\022@\305\236\303\034\334\310\3723\310&R\246\024\2560\025P\343Pe\0364/\242!\003\361*k\342a\n\f%\030\254G\001\241\365&m\037\255\202R\251K=\366O\256E?d\213M\036\273\3637\322]\252"
+	.string	"\310\306\225\233\247\317\246\213\255uR=\354G\253 \333\351\324"
+	.string	"\226Pv\216m7c{\331\025\247\"b\233cO>\311K8\216\013\027Wv0\022\202\201\322\262\253=\352\004\322]\364\001\351N?\036\237\321\277\311\025<\035)X\326y\002$\354\256\023\3134n\275m\003\333\b\266?\001\t"
+	.ascii	"`\251'\023\332\364\201\341\r\001\272\206\367F\270,\004\031\356"
+	.ascii	"\212\251\235d"
+	.text
+	.section	.gnu.lto_blackboxMayEditConfig.160.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\006"
+	.string	"\025\007"
+	.string	"\222\21515`m\322\001"
+	.string	"\375\203\224\320\204\300\272\2736JY\323\362\354\316\216\346m\001\335\032:\326i\021\365KP\021\221jrh\t\024z\202\271\217\302\326s\226\020\"eJ\001\276.\025/\323pa\0342\016\202\001\363\340.L\302]\006\374\"\02607\361\036\346,\270\237VE\252\004\036\375\370\327TW\325\203@>\031\355\213\274\244\361I\246\330\344\265S\376\246:u\025\350\270\360d\264\245\261\251b\303N\352\206\375iUd;\255\231\376\004\200B\332\216\021wCqeO(\023\017\333\034\333\362\001\002\307\331!G(\340\243\004\"I\331\205NG\317\236\231\377\220+\214d\224h[\347iI\330]\247\266Y\334z\333\005\266\rl\217\002\t"
+	.ascii	"`\251'\023z\365\201_`\002t\rO\031\361\226\020$\3349S;\237"
+	.text
+	.section	.gnu.lto_testBlackboxConditionUncached.162.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`(\013]4"
+	.string	"\352Y\274\023E`\034R:7\241'\016\274R/k.o\260\250`l0n\007\025`Xb-\357\363\323IR{\320\021\342\240f\371\032\263\374e@\363\310\307\177\3662\016\212\320-3\324\360\325\340{\373_\355\333>!dK\231\002)\001\016\001.\001i\037\270\366\177\357\373n\277\247\366\327\333W\323~\252\366o\332\357\333g\006,\202\370\350q\305Yim\353#\212\327\272\251h\302\376\363\177\033\177\360\267\261#B\367\317d\214\305\006\227\321H\213-\225\022\246\231\266=[p&\037\253HL\264\262\232\362qe\365\377\033<\260q\326\350\206\224\235\223\030\233e\027@m{\326t\2330\313"
+	.string	"\212\210\220\307!c\2218\024\022\006\201?_oU\323\333\354Y\212\0010\3343PQ\317=\363\020u\3639g\207\204cw\344\240\374\202#\273\033\nc#\020\357i\245\330\305\304TI\013N\020\"9J\346x\212UW\017\267R\244)VZ-\024&\364\222\022|`D\n\360\251\343\307<"
+	.ascii	"\211E\355\270~\204\261\217\247\260\270\227\"\315\261\302J\221"
+	.ascii	"\332\266]S\"\037`\314\341UU\252Tw\306O\360j\331jS\354\316.e3"
+	.ascii	"\356\240\324\252#\273\343\372\021\306\027\312\215\257'N\274\262"
+	.ascii	"\220\0341R\204\nx\245\f[S\256\253\034\314e\005F\354\036\205\266"
+	.ascii	"m\337\314\253\037|#\376\331\317\177\r\377\317M\234|\263sK\215"
+	.ascii	"n_\247\233vY\226);z\276}y\2317\325\321\013\373G\221\242\231\311"
+	.ascii	"\367\251\251\274Rg\2647\2669\334\205\327+n\200\352\244z\320\201"
+	.ascii	"+\034\\\356\334\031\017\200\273\2703t\254\310\016\337\341\267"
+	.ascii	"#\321\026\033\262\2619g:Cqmg7\243\0338g\266\342\027\033\262\261"
+	.ascii	"6g7\303*k\316kB`i\316j\302-3\3473A,2\3472\300g\2160g1?n\266b"
+	.ascii	"\200\242x\341/\214v:\037\373n\334\254:\262\261\266\271\345\314"
+	.ascii	"\345t\\f\216i\254\254r\226\377t\274\206\247\205\244m\245X\353"
+	.ascii	"?]3\333\266m\333\004\254\032\335\264\355\352\274\263\031\003"
+	.ascii	"\275\\i\336\351i[\320\177\246\344\033\215F\301\364u\376|\243"
+	.ascii	"\321(\230\337%\377\373N\3573\275\277\364\276\322\373\311\367"
+	.ascii	"\021\274\237\364\376\201\367\r\274\217\364\376\321\373\002\336"
+	.ascii	"\017\300e\314F\277>\362\327?\276?t\373F_\277\350\353\023{\375"
+	.ascii	"a\332\027J\373\302\264\037\f_g\245\260b\315LVle\025x\217\274"
+	.ascii	"\260\246\320\344\216\274\3416Q\356\352\206\316\370\024\330HT"
+	.ascii	"\300=\\b$\362&\025\257\323\211\027\032\342]\362\263T\326_\034"
+	.ascii	"\373\354\035,\025Vc\253\264\016\366\n\177\201\353\034\315d\261"
+	.ascii	"\2345\253\320\314\254\260\262\372\273\254f\304\301\205k\310\256"
+	.ascii	"\276\333y\004\272\330\372\372\260\341$t\217P[@\320\246\206\223"
+	.ascii	"P6!R2\r\032NB\315\202\251\022\364\231\306I\250\024 \201\366\361"
+	.ascii	"\205\365\307\220\241\231\271t\237\232TP\"c8\t\005\342\366\273"
+	.ascii	"\316\367\252\200\273\267\304\307\253\343?\336\243\325w\235<\340"
+	.ascii	"L\310\\\357:\377po\003\343=\365\033\234 \017\234\007.\220\213"
+	.ascii	"\020\214\247\253w\373-\256lj\275= \035Lb'\312z\235\177Z\325+"
+	.ascii	"\024h\013\224\252\003\375\347\300~\236x\255\353\277\f\356\343"
+	.ascii	"\241@W\333RE\370\300|@\370\332\226\n\302\236\031!\006\300}\261"
+	.ascii	"z\216\261\262\252^^\363*#F\243Q<\234\\\215nzU2UZC\375\213\030"
+	.ascii	"\321\314\274\321:\234|\373\243\022\373\207:\321\314d\332\003"
+	.ascii	"&7\321\300\004\t'\t\016\"0!YD\241\200\201\302\004\213(\250\337"
+	.ascii	"\241\230fD\225H\001EBE\211&\026(H\254h\202r\361\242\211\251\300"
+	.ascii	"\243Z\234p\321\004#*\312ES\360l\212\357\222\023\250j\003+\np"
+	.ascii	"\027xa\313#\022p\223\252\330\312 \221.\262\352M\231\243\201\313"
+	.ascii	"uO2\313\264\241\003\267\306\023\355K\232\261\227\334\344e\r\254"
+	.ascii	"\230tW5~\204\b\356\252fH0y\3274L\200J\027Yu\246\354\267t\271"
+	.ascii	"\255\312,\317wt\221UfZ)\323\355\246\030\3352\355:]6c\037\236"
+	.ascii	"\030\234/i\315\314\256CWy\326\302\247\220\002 \262\032o\200\255"
+	.ascii	"n\262D\212\260G\216\254\254\032/\001\257>r\234\224\333ST\274"
+	.ascii	"\304+\340\252l\3131eVg!)\336\tq[m\204M\342k\254.\302*q\262M\330"
+	.ascii	"&+\253\304\233dD\223k\203\343S \272N\257ux\221\324\224\372g\241"
+	.string	"\260a\315\314\341}j#\207\223ri\220\375\203\205\256\201\333]\226h\372\212\205W(\210\360\036\305U\211\303I\271\247\333\361:\177a\r\336\003\227\227jE\276\260\002o\360\362\022K\331>\332\352\3029\200\341\250aP\243 CR\"\"I\222R\2061\320\"\021\"\2629\021\360(d\330\2304\005\005i\003\271`\017R\024\265\"y\206\251\347\t\261\212$~Ic'\364\364J\242\035\314\372.1I\334\313{\205@\323\330\207\316})`\347,f\266\325q\021\224\f\376+\344V\300\226M\264\204ITj\221\034!s\307\331G\3553\272n\003\356\005\034I\337\017J\363x-H\332\266Z\2304\367\223y\236\300\321l\227\323\351\317yR\"=\340\310\247n/\203v\241\334b\225\270\357\202\266\"\231\216e\261)U\314\314\341\300\337X\252\250\013\333\325U&\207\360\\\346\373\230\313F\371\341l\276\263\2316\210Rs\300\220"
+	.string	"8z\315\363i\347<\\X'S^\306\317\342\004[\351\357\347\266\212M\256\353\032\372\313\035\024\006,!"
+	.string	"\024\004\235\366\226\234\220\026k\221\030\031e\331\323\3357\343Gl\326f\314\243\207u\035*\177h;\023\333L\261%lw\341_\303hN\364_@\204\262V\022\016\315\207\311HA\257\235\226\002\262\020\\|&!\004\277Ym\264\033\333\213\273\245 \340\2624\017"
+	.ascii	"\341\322\336m\212\362`\210>\365d\325-\016\035B\355\351\221\204"
+	.ascii	"\202+\265/$\026\255\347d\b\217\017\222\0200\357p\246\006\215"
+	.ascii	"\241\330\004\200\342/\223\374g\320M\261:^9\326\357`#\032_\026"
+	.ascii	"`\224\030WN~\273\036\301\241\265\354\262\310\206\3141\365q\331"
+	.ascii	"q\371\377z\363\244\217\327\217\372i\3613\031J\005"
+	.text
+	.section	.gnu.lto_blackboxBuildConditionCache.163.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\030\002=\022"
+	.string	"\226\341vG\340\360&\035\002\277v\220\345\253\002\306+\030*\252\236M\034nPH\003\3009\334\366\271\212\025/\016YS\317\315\255\2573\331K_\377\207\034? \303\f\353 \351\320\023{\326(\241x\267\026v\254\273R\303\356\275\245L)a"
+	.string	"^"
+	.string	"b"
+	.ascii	"\360\"\362\361*\307\354o@\315\224\235\020\341\324\222x\3149["
+	.ascii	"\013\302RcO\311\bWc\376\321!\220Q\223\255\223=\005\365\250\004"
+	.ascii	"\207"
+	.string	"\220\256\006\035\260X\242q\357z\323\321\250\004\031\342y\3349\f\351j \311\234S\325\321t\357=\002\025E\331:\236k*e\316i\265u:\367\307m\333\330\216`+J\217\005\204t\3144\312%\237\007\031Ss\266'\323\r\262/\022\243+\362\336\354\325q\267\204\352\b\325\020\252w\325\252\352\207\254\232p\272\027\335\2303'\nj2E\030$\216\373\355\313\3300\361Q\370\236U2\237\311S\\E\354\270\231O\235y\233\020Q\016\2169\275\003\217f}<\222\\\200|\fq]\334\226\003\356n\334\3276(\3015\020\242\203\356\356k=\344\"\270n\\\262\201\242\321(\177\306g\342;t\210n0\203\374\302\220\234h\372d\020\225k\267\274\266\201\017me~\213ohk\334>\245\335\240\031y\334\277\3433\323\234\357\035\236\370)\371z\376\"\375\025Gz\361G\030&Fo{\364cdfQ\300\242\222\200\301\311\002V"
+	.ascii	"\026\227\227\013\332\305\302\360Z\241\340R\251\260\322r\231\240"
+	.ascii	"\322\322r\301`Z\254\021\277,H\200\265.\274^\260\226\312\233\337"
+	.ascii	"\333\321\257\3413b\232-Mj\203\214b\213\253\005 B\237t\2717\004"
+	.ascii	"\0368\321\364\t\302\213\237\2519K\247\3144w8\347\234r\265\307"
+	.ascii	"\235\3443R\356jo\363a\304\373z4\006, P\002QH\225\007\344}\300"
+	.ascii	"\324\213\007\376\276c@\006\202\247\n\330B\364=-\021\343]+[\241"
+	.ascii	"h\205\\A\002\202\n\367z\261Z\327\266\004\202\207\302\316\316"
+	.ascii	" \353\262\316\3320\243\244\r\035\005\225b\335;k\301N\016\025"
+	.ascii	"\2618[Y\307\346\321\213\253\001\260\250L+_\023\235c T\221\304"
+	.ascii	"\267hZB\207M\373&\301<\001"
+	.text
+	.section	.gnu.lto_blackboxSetState.165.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`K\005%\032"
+	.string	"\006*\231L\220TR:\026\032\232\025\001=\271\370)\331\370<\004\024\2335\256\257\352\306\310\n\003\341\223p\222\343|\343\024\331\375\242\277A\373\374\247+\002\250oL "
+	.string	"\002\006@\""
+	.string	"\030\330\372s\037R|\323^\201\300\030Wy\236\264\275\311\336I\006\200"
+	.string	"\177"
+	.string	"\204"
+	.string	"\357\376\261\327\215\322\375a\311\345\365\306\376\323\241z/\366t-g#\257\253\234\217\013\372\206\376\032\270\n\376=/"
+	.ascii	"\377v\257;I\340'\373Z\210.\200\242\2309g\234e\361\336k(\r\337"
+	.ascii	"\323\326^\377@\021\f\030\364\275\366\205v\321z\340\252\353RT"
+	.ascii	":o<*Fd*3\022\022\335\016\001\205\370\001q\022\374\341\232pHu"
+	.ascii	"#!\"Z\245I\3109w\005\006\205\357\223w\367Rw\277t\337\b\001\313"
+	.ascii	"#\314#\276z\326T"
+	.string	"\302\341\224\335\321\347\201\342u\325\307:\361\221T\325\267B\255\222\250~\3438N\332\2132\321\230$\325\267a\235\256h\364k\324\367\340\337\246\334}\031\335\235Ds\366=\305\177,\024\363i)\027\345\004\277\330\236y\2506\351*\265D\232)s]\322}\364U\273\242\373g\266\303\356\027\177\\k\237\266\266\265\265k\255\375\024\336V\220\210\340\233\306r\016j2\311\310\233\365\242\273\003)\nl\342\366\356\n7\322ZE\210\260\034\021!O\266\033KKL\335\226l\"\357\231\355\266p!\273\001}\341b\030~\203\3303\2402@\355\316\220\263\037Q\364\263\276%a;\334\255;\330N\345(\347\354\240\017\344_\032\372H\277MSSc\246\340\375\037\357\262\341\341\340\340\337\225\243$Q\267%\227\310\023\200T\022\241\353\340\376\326\271t\372H\335\201\247\036\370\333\347\301\277,dH|j\263?\225,\013\373\214\343=\323`&\307"
+	.string	"B\313\203[\312n'\267\023\303\263\273A[w\363\300\223\251\321\3456\310\340nhr68]\216\016\356\266\322<\016\273\034\334\016\217\227\203C9\346\333a\243)\027\322\307\376\032\333>\223\237\365\274\300\300\340_\225!'l\251\026\326\361\266\324h\233\315\246Y-\205:\225\2301O\247\254\333R&\224h\355\362@\345\371\002\270Zk\017D\342W\233\335/\273r\002\205\230\030\374[-\202\026C1t\334\226\302\240)\245I\0259n\013\200\200\250\201`h\024*\031\005\005)((i\306"
+	.ascii	"\003\021\241\352\006\021\360,\205L\315\210\026\224K\333\001x"
+	.ascii	"\254\203\260\237W\261qC\352'\203\363\336\030\313=EMY\367\346"
+	.ascii	"\373\270'\232k\301\375\303\300\275\220\212zW\270.1\007\234J\251"
+	.ascii	"\220kE\354b\016\363\220_\376\267\201\351k@V7\333zYM\275\223\325"
+	.ascii	"n\365q\264\256+u\036{\2021u\241\342\204\274Y\374\n\276\304\250"
+	.ascii	"I\346\2405F\243\273\254i\266&\201\302\315P\257w\n@\272\240d&"
+	.ascii	"\325\204m~\024(\262\226\256X\373.\326a>_!~\337\2568\214\300\362"
+	.ascii	"\203H\213V\217\223\260\234\037\203Q3\274\272v\b\376\017d\214"
+	.ascii	"t\372\376\006ysf\257\216\242X\277m\306\263\303<\034\255OD\353"
+	.ascii	"h\337\025\0254`2T\003"
+	.text
+	.section	.gnu.lto_writeIntraframe.166.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`L%]{"
+	.string	":\275\020*J N[\031\016?"
+	.string	"0\002~U+E\326\327\352\275\315o;wm\341%\252\311\002J\235L4\335\313\304\306X\373\204\240\335;A\316CG \270"
+	.ascii	" \2005xo\377#Q)\023d\244\305\224\025\256\3525B\b\331do)\223\f"
+	.ascii	"\242\002<\002\250\002\27372\306g\225FR\030\241+q\225F\230x\t"
+	.ascii	"\301\310z\270J#Y}\326\234\205\253\264*D\327\272\002\340\020\327"
+	.ascii	"\366\bWi\345\002\\\240S\215\236UZ\341\365\301\245q\312\345Y\245"
+	.ascii	"\225\2309=5k\202\253\264j\013\024\341\354M\355\202#\240\337\376"
+	.ascii	"\317h\f\230\325X\214\305ce\326\267x\210o\\\316u]+8\336\261#\025"
+	.ascii	"v\006\261\316\236TX\2339r\244\302\004\343\300\221\n3\314s#\025"
+	.ascii	"\346\007\257\215\024\2240n_\277\326\207\260g\213\240\363n\215"
+	.ascii	"\024\024:\2674h\332K\260\354\214\231\366\022\274s2\273\312-\362"
+	.ascii	"0\373\272\366\032t\023\353\262\256\253\362)\335\030\"R\342\374"
+	.ascii	"\214\340\305@\371tE>\206\b*\267z\035\315\2759\237\236\356\003"
+	.ascii	"\027S$%\372\227\317\255\322*\004\271\263\320<\030+t\005\223["
+	.ascii	"\277\202\346\342\020\345x\034\237\256\334\321\312\204\030\357"
+	.ascii	"r/\315\307\201\200\204Dn\365R\355\350\325uiz\272P\307\247H\347"
+	.ascii	"`|\212\236\310\370\264\271;X\224\265\036a\261EPK\f\342\272\256"
+	.ascii	"\313V\301\251\231\272[\t\305\266\t!!\241\244]\245\362\bEQ\240"
+	.ascii	"\355\243r_c\262\371'\247&(\246\245\245R\212(\024'T\230(A\"\t"
+	.ascii	"Ij\304\221\b\243\020 >\024y\350\300a\003\221\206!\241\fA\030"
+	.ascii	"\200\224I\344Q5\246hss?w\022bxG\376$\207O\034v\322{\223\336\241"
+	.ascii	"\346$\276a&8_\202\363%\235\3034\254\224\367\024y\217\362C\243"
+	.ascii	"\n\355\030\005\232\237@s\025\250\020"
+	.string	"_\327\037\032e\206M\234y\t\302\243p\201X\310\276\316\234\004\332u\362\310.CL\2059\327S\307Ij\215)_d\216\364+2\227\322\363$\276\2562(\322\272\256\200<\002U\263\224X9_\327\027\024\206\242\363\356y\274\360Q\334E\344y*EOM\227D\262\257\270\033uy\210.p\f\202\313?py\343\"\267{p\273\302\035\254\234\203\225*\274A\355DjTXC\332\207\322\320X\350\354\031\316\242p\220\3301\240@}l(\234\257\013\n\272\302\311\231\276\013>a\240)_aW\2525\004\177\274\363\246\246\207\354+\354I1\024\030\231D\366\345\344\307\363u9\371\334\223\262t\201\261\212\n\255\353\032\344\245\205F1\227\027\026\033\223X\232<er\024er\2561\f\362\312B9(\261\262\245\364B\302}<g\n\0233\207\247\214W\223\263Zc]\327\345-\257\257\357\212\357\242>v\027\203\335\244\254}"
+	.ascii	"\377\263\3015|\353\337_B\022\302\275DB\265\357w$c\253}A\255?"
+	.ascii	"D8\332\330\037\n\223\210a\361\342\276\356\351\204\357g\212N5"
+	.ascii	"\275M3\216\347h\033YU\223\324\2047^\222Vu\241]M8V\202\376I\342"
+	.ascii	"\247w\3576\277\f\240\034\313\032A\310\326\256\r\346\272q|z\\"
+	.ascii	"\327\265;\365\263\325\244\017\357\001\034\302\024\273X\326b\256"
+	.ascii	"\341\200:S\2632>\345F\306!\202\340\367\356\216\036\313X\214d"
+	.ascii	"j\257\266\n,\260\200\361\351\033\tFe\270\201\227\314\027\317"
+	.ascii	"\270\313@\003\374\255EB\322GV)\017!\037\220>\230s0"
+	.string	"v\305|\234\276h5\303o]W\030{?\377\343\300^\355\351B\360\203\277\365\303\370\024H\213@\273\273\342\305\3451~\234\211\317\225\371\354\312aq\233\355\036\306\231\242s\273l\227\313\233\333\026-m+\260e\301\262v\305J\0255*ih\357\373\376\354\203\337O\371\363\373\262\223\335\360\373\261\213]\361\373\260\177\251\274\357z\334\367J\266\262\260R^\346\003\277ER^!J\336 \007\363\005r\305\357\324\021\277>n\370\355\361=_\036\177~w\334\371\325\361\301o\002\017\374\346x\337\027\007\363\"\240\362\036\220\3445@\345\275\241\362\026\220\344\265\241\362\022\220\344\035@\345\255\221\344\025@\345\245\241\362\316P\362\312Py\003P\362\002\240\362\306P\362\302Py_$y]\250\274-T^\026I\336\025*\257\224\312\253\"\311\033\245\362.\223\274PA\274O)\257\223\312\333\244\3622\251\274KI^%\f\274)\200xQ"
+	.string	"\361\236"
+	.ascii	"\3425\221\362\226P\362\222Py\223T^$ \336\021*\357Q\222WD\312"
+	.ascii	"k\244\344\r\241\344\005\241\344\375\220\362\026\251\274\036T"
+	.ascii	"\336\016*/\207$\357\006$/\021\222W\203\312;d\344\0252\362f0\362"
+	.ascii	"\006\031y1\250\274@F^\245\312\2334\362\"U\336\343\221WUy\215"
+	.ascii	"F\336\324\310\213\032y;\345\345\224\367\207;\302\233\263\023"
+	.ascii	"f\313`\343\221[\225,\366Y\367\322\273+W\374\021\177\303\177\317"
+	.ascii	"\377\374\235\377\340\037\370\367\375q?\230+\003\036\312\034\251"
+	.ascii	"\203'\n%/t\t(\346\234h. L\301\336b&\236\350@\317Dk\001a\346\351"
+	.ascii	"$\314D\023\206q@\224 \321%\3644\026s\221D\263@\303\373\240\305"
+	.ascii	"\256\255\253\255\257\245\327\2664h4\3301][W\342\263(\211\220"
+	.ascii	"\373$E\361\260\202\232=$\266\376\n\211lwk\200\324@\351\200\304"
+	.ascii	",\344\302%R#\343\f\227p\310\302\006\313*\204\245\237\345\211"
+	.ascii	"\005\257\215\222\215\241\327\206\021+\006\2010\017Y\220\2318"
+	.ascii	"\242\215\202\204\207Dk-D\031\273\322_\003\274\222\347&\331\002"
+	.ascii	"a"
+	.string	"\241\206#\021}\324\347\303}M.\021\275D\213#\2243d\345\r\024\271W\351[\261S%\016\234\2407\204o\204@\260Q\2206j;\255?W\213\213Oa\f\321AzY\013\fD\177\350\020\375\301\316\017\317a.\202\350\207\371\213\3438\254\307\\<\322\304jb\031\237~\350\237\371\003#d\223AM\357\311X\242\363\212J_-\217\312\0349\030\364\204\254P\344\241\213\372\251Csh\017]\204\227dm\006\3576\265\232\"\360\267:\264\321\311\030V\037\331\r\315\001\212\3314\271^\334Am\350\027\177wkO'JC\002\243!\022b\002\ff/\327\340\325\\\2424\243\001\023.\323<AC\033\355\266\232(=\027\203\206\2340\335\220\241P\230'<'\264'\203\034\024\376\222a\250\356\251\007C\233-\022\005e\221N\323\222M\317\321\\9\016s\364\003W\317\360\316\031P\221~`\216.\322O\"\206\326=\337\004\005"
+	.ascii	"\007\310\\n|L3\n\2775Sx\341\027\324E\202[M\342\364\226\241\362"
+	.ascii	"\027\250\\@\360\250\227<\fZ\244p\033\006\274\344\323\3500Y\217"
+	.ascii	"G\353\247eA\253\2637D\347HJ\3175H 3\266\002\304EIE\005NSV\271"
+	.ascii	"-q\262\211\306*4\331\200\374\226\311F\306iA\256(\243\302R\220"
+	.ascii	"m\224\263\325\344\252MC\031\305.\3076[vr!\035\001\337G\240[\322"
+	.ascii	"\225\350D\327\365JFf\013\031c\336\261#t\"\306\363\035i\356?{"
+	.ascii	"\262\361\251m\266*\234\364g\335\200\334t\034\315\365t\034m\203"
+	.ascii	"\016\031\216\256q\305|^G\312\013r\306\276#9\035G\377\254\337"
+	.ascii	"~\317\0238]\342\343\225&\226e\006rX\223-h\233m\374\244\305\261"
+	.ascii	"\221wW~\317'/\366\362\260\241S\306cu\325\034 \022V\334\275\337"
+	.ascii	"\217\347/\201\316K.\321\231\325\307\352k\201a\361"
+	.string	"\"Xs\313\263\032\005\032\330UW\177\253\257\266\323\337\325\251]\222\026\334\203\007\241\262`\210\005\023\004\241\222"
+	.ascii	"9$\b\005UU\034\330\310\260\023HM\360#*\006\013\030P\033\206\004"
+	.ascii	"\341\200\312F\025\325\020*\r\222+\001\224\007T\021` \301\217"
+	.ascii	"\f\"X"
+	.string	"\006\261\340\207\006K\t\252\204,\241F,\325\006\024T-\207PQU-\225rW\307[Kt^5\326\376\314/\306m:\275\307\374\302d\2019\267g\316\031\237\036\371\355\301\3538-G\217\025\327 \320\375\306\252\303Y^\213\331z\266`ul<\004\332\351\357\356\203.\007\030\320\007\210\351;\003\024\261<5=\254\033\020\252\351SS|\246\372\212Na}\305\251~\230\242\223\033z\235\206\256\321\334\270\321H>O\232\240\226.\326\r\270l\272\017\037\211>\372\210Lb}D\037}1E\257\002lt\001s\332L\223\213\306\031\231.c\243i\240%~\250Nq\311\3222\305\307\272\001\243\232\336\243\307a\217\276\241\322X\337\260G\177,\221\200\001\232\200\276\335^\323\231\3511\003\264\214\277C>)\242N\234\254\033PE\323y\360(\344\321\337\203\202\254\277\207G\237LO\r\001\272\006_\3175\271f\234\3315\030f\242"
+	.string	"=\003\255\360Cu\207\204'Tt\331\252pJ\274\254\033\220D\323w\354 \334\321\177\232(\353?w\364\313\016\337\320\270\323_\232l@i:\356\306\222F#K<\t\211\344\315\220\3213\3264\234\2146\001"
+	.string	"\320\001\260i7"
+	.ascii	"\356b\300\350\030x\335\306\\\204AD\315\013\027\375\242\237\334"
+	.ascii	"t\226&\227\213~B\363B\"\r\351_\235\246I5]\207\220\016\364PG\337"
+	.ascii	"\331s\366\270yK\372\352;u\364\277\324\034Fi1\244\214E\267\350"
+	.ascii	"\013&\021[\321,\230}]\245\311%\343M\2531\343\254h\031\177wz>"
+	.ascii	"\344w\310\006f\017\205#Hm\266"
+	.string	"\277\221\t^\334\244\272\214\013\335\333\336[\237K\243\275\221\251C\322\035B\031\001(\342S\272\001\215\270VI'\3206\364\362$\320\037\\\217\246\364\007\023\350Oq\0362\221R\321\313\226\352\333%Y\213j\025fM\256\267)c\272p\273\250~\033\250^2\375\232\254\311\345\"\205%T\273\370\273\253;<\241\351\334dy\211h\263\017\346Q:d\022\367\324W\322\367\243\365g\212w\231t\230u\370[O]\204\310\227SS;1\365R7\265\321\017S\237P\251\227\234:\254\311\325\202i\247\2370]\200R\352\026\177w~\214\222\370\370\3053\246Xq\002\005x\272\t\363/\205aa\b\2672[\266\364\335z\311\2263f\002\203\006\250\242\220-\320J\206HFD\222$)\fk\322\f\b1\016:)\235\007\022\300\3628\214\303\034DJ\021\222\031\231I9u\322\001\330UR;U\001o\037\310UWjK\271\332l\361"
+	.string	"\366n\274-,]\224!\267[\3264U\377F\231\3250\207zH\317`\365\030\002\264{\365N\263\333\217M\1772\342o\rv\233\030\354u\337U}5w\271J\340c\355:\356!)\":3\272I\f\200\224\345"
+	.ascii	"\344\220t\212\352\360\367p.+\334\302\246\346\236\322}x\244\206"
+	.ascii	"\324\357u\277\261=+\024+\274\213\304\002HY\340ta\267\001\252"
+	.ascii	"\310\317\366)"
+	.string	"\002E\017\rt6=\217`\216c`O\025-i\350\324\241\311J\312\034\250\360e\016T#596\210\035?\370D!\321\324q\030\235\370i\207\251\247\222\306\035\355\214\3248\221;\365\024\203\316s\241\263I\366l\225\003)\302\307\263\200Ucq>\275x\021Y\356\311]W\220\324O\0040\214J\336\272^Y\330\rt\274\347i\001O%u%w\241B\314[\354\354GU\021\246\313\344\365\300\227\252\363}\351\033\251\006\335\310g\364\362\342(\312!\360\213\364m\217|;|\257\013\241~\237F?\203e\021\371\212\304\027\031:+*\"h\274\323B\355\b\241\177\270\312\313\366\335E\204\301\250{\244\206\245\004\225\247\362\013\025\303\022\035,\336\376)h\3474\327\317\377\320=\203\"+\275fP\2406\333\r\235\002\002y\213\322z7\203\005\033\022\241\\Y1*X\300\350\2041\235\266\f*7\337Ui\367\201-9\272\332<"
+	.ascii	"\177$\354p\316\246.V\201\372v\327\357%lTy\277\035\026\305|\210"
+	.ascii	"\331\231\324\225\036\250\356\001\220\320\nu\321r~\225\207\327"
+	.ascii	"I/)\214X|O"
+	.string	"\302D\2617`d\335\023\353>*,\300DhBy\300\035\317\210U)\272@\020m9\314\361\021\331\247/\245W%lS\367\303\217\314\302\023v\\}\327\266M\017\331\fY\371\265O\f\357\005\026s\326`u3K\255`\275\234qb`\356\333\340%\033\221\323 \362L&\205&\206,\274!\031\030\374\336\350\353\202\f\371\316\200\261R\274\316\225\002\031\266N\243\334\2112\313\331x\016\304({0\263\304\300A\030\343\302\030o\2577uE>\003\207\0019\366K\342b\320's\206+\336\005\235\342\036q\260F\216F\354=\332\276T>\357B\3654\373\257\3023\3121\337\277\b\312\020,'v\326\2646#RX\246.\307\n\213\200R\035\223%\356\021\330\257\013\021M\022\316\364\252B\262}\036\216\375)\233r\021\361\300\030\030\t\301\360\220d\2141\264\334X\007B\006>1~\234\222{9\234\324\271D\234\341\355#\211\357"
+	.ascii	"\032\342\252\t\036\265"
+	.string	")\037#/\264\33250\354\350\006\242\261\237}\241W\213\221D\356\366wc5/nQ\034\260\331'\350\231\2143\375bBM\254(\004\267q\200\020\227W=\034A.\305\026\367\302\363H\273\3001\330\334\265<^\316\336\226\364\036\027\003j\202\274\261\305\351\315\b3\302d0\302\266=\223Q\312c\322\371R\2418\220D\324\320\017\332\231%\304\364\\\3513\365\0014\b\315\007*\202\3178\305\030\f\n\275\324\037\251d+\3479\344\245\350\025?a5!\204\252-\b/D\016\270\263\006E\323\037RG1\035\207\204\307\272,\220(\202\207\203\260E\221v\361\274'\252\303\207\322\2076\307K\\\314\315\254w\260\367\376\373LRog!0\213\211\031\2544\315LJ\277^=\233\203\324\013\305s\001\033}\370\243\335E\2459\250\320<\031ZF\237o\2525\363&\367\304\343\210\320\006\343\275\202\253\244n.\256K\3203n\322\306"
+	.string	"\001a\321@\314j\277h\316\2267\270,\210i\373\360\331)\265!\307\337w\270"
+	.ascii	"0\350\252\200a\352\262\363\322\272\3118\314\341\371\347!eNN."
+	.ascii	"4twbG\221\224O\177d[\370G\312\250&\241\223\004\035$RG3\311@c"
+	.ascii	"'\313\213%\345$\320\025?\350\211\030\304\200\017k\030\217{\324"
+	.ascii	"\225\b.\360\034\035\262)\214yG\257-\360\276Z\325H\323:\242\275"
+	.ascii	"\003\2075\312\353R\267\256^\235\337=`\272\335\205v\0021\271f"
+	.ascii	"9\027\337\343\225A\322\246\020\333i\220\032\342\230\032\022e"
+	.ascii	"\321`\003TO\323\340\324ak\342\326\024!\337!qxO\226\330\300\233"
+	.ascii	"\306\226^\233\203_\203J\234)-\325\355\001\032\315_\223\ri\256"
+	.ascii	"\004\254\316\3764h\361\363\\\316\334\343\231\264\3759\2033>\246"
+	.ascii	"\361\006\346\373\215\007\\\301/\341*\323n\202=eD\304\013\204"
+	.ascii	"\235\331\273\340dN\313\216\227\250s\b"
+	.text
+	.section	.gnu.lto_blackboxWriteArrayUsingAveragePredictor16.167.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\205\004}\035"
+	.string	"\266\266\274H\260TN:tD\003)\254\360\305\025\326\r\2559\024\225\306\f\212gHC\203t\034\272\2033K\307+\305\317h\365\212F\305x\223\004^\376mNy\333\211\255\374\241pS\343\244\316\017\340\304\241\271\343\321\334\314\332M\244L)\254"
+	.string	"\226"
+	.string	"\250"
+	.string	"C\033\032\266\206(\3658\221\220\020\324q\005\204\304\347?\016d\351A\224ff\331\374\t-\301\035fs\nu.}\301vi\241\315\207%\264\33083\237\250fX\260]\372^\370\\\355\373xp\351Y\026\363m\316\251\263\"sN\004\336\261]\346\274\206v9>"
+	.string	"\355\322Kv\225\033\250\311\304 Hc\204\020-sN\335\302p\255X,\026?\n\357Q\227.\307\325%_\353#\325\024\260( \323\345X\2032Q#\006\b5\362\020\315\302\336u\225\002:\351xC\305\367]\227TR\306\242\200*\256\265\2369\2475\n\210\342\246\335I\366X\"ceS\317l!\223\256\013\373<1\210f\336*\033\347_\367\315\205\377"
+	.string	"\251\266y\326_s\256;w5\315\32535\265\214\252c\256\206\271\372\245\246\306\251\032\300\325\267\232\332\246\352\032MM\243\251\345\250\036G\365J\265\216\352\023\220\301\262\002>J\2269M\024\267L2\031f\343_?\327\325\276\217\212\217\357\345\203\031\347\253\362\025\342\023\305|\211\252`\320l\316\311+\363\361\267\374.\343.}O|l.\213\215s\030!\330\343j\316Id\273\374\205\234\310\265\214\363e\005\317Qr\230\275Y\365\372\361x\331\333\302\354\310\345\307\002\267/\033p\343\002X\211\305\266\267\375\311\214\206lV\276\322^j\205\315\356\326\366`\277\375p\320V\327f\255?\026z3\241\311\245\355\177XNZtn\345\216N\016v\232!\361l\227H\022(\340Z\347\347\352\372\230c\312"
+	.ascii	"1\313\207 K\336\204\211\336b\264\313\361J\322\020\004O\202d\367"
+	.ascii	"\201\f+\337\362\211P\252\360\341\037\264h\3223\327\254\256R\031"
+	.ascii	"\321\245I\213\007~\004\204m\316\311\343\033y"
+	.string	"\030\007\337\352\322D<}\324\245\317\243]~\035@\tk\322\242\r\020\003=\036\322n(H\250gt\033z\257\347a7*X\360A\250g$\221\212<\360v\322A\013\202~\0224`\300\263# D\217\207t4$\241h\002\222\320\021\006\f\024z\275\237\234w;I< \016\273\237\016@\272\242\241\037\"\335\256w\244\333)`\236\221PO\207\304\343\365t8\341\374VY\353'q\226\202\254i\235\344\272\360m\305\342\354FQ\235\347Vj\300\346\026B\223'%\216M\345\266\247I\317>\3169\347\210\263\347z\316\201\347\026g/`H\314\022\2434k\013e\320G9\347i\231|\2633K\263\367\372]\311\354\f\220\3147fG'?\034NCb\261\354f\377\025W\250A0\245\030S\206P\005\"\301L\230M\213\305\260\002\221\261\252\016\020pF4m5R\221\005$\022l)\b}\002N\323q)\245A$ \336"
+	.string	"\240"
+	.string	"\036\177\rI\025\336\246\273x\350\241\344X\270R\t\203\340\340\017\334\034\200\324\311\207"
+	.string	"^\202\016\332\0200\224xh\271M\336, ]h\254l\366\216\3167I\324\"FE\210\221Q\306\217"
+	.ascii	"\232\316p1$\004\t\232\251I\001h\030\331\267ZJ\204\210\261\253"
+	.ascii	"$9\346G\370m\273a\311\225\036v\0037\363x%\251Ro\337\346\207&"
+	.ascii	"\210w\007\305\252\342?Z\277\210\320\026\303\210\277\0231\361"
+	.ascii	"f\355\304\202\023\034\272\2644W\003\006"
+	.text
+	.section	.gnu.lto_blackboxWriteArrayUsingAveragePredictor32.168.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\212\004\315\035"
+	.string	"vw\277H\240VN: -\263\004\3508\3409\001B\353\343=90\202N\0137\252\373\204N~\341U\n\203F\221\377\237\017eG\371>\326\256e#)\254\021\257\300l)\220\022\276k\334\300\253\221P\007\224\267bb\315\022B\244L)\257"
+	.string	"\231"
+	.string	"\253"
+	.string	"\270\037\231\226\327\006*F\224x\200#$\\}Y\375d\3519\221\027Y:\226\322\3144\233G\261\345\n\fm\316a\316I_\260\235\364\320\366K2\264\33083\235\250jX\260\235\374a\365\\\355\007\371\325\322\205X\314\2679\247\210I\346\234\b\254c;\211\363\232\362\344\370"
+	.ascii	"\345I/\331XtO\223\211\301\025\027T\326"
+	.string	"\2269\347ne\270V,\026\213\037\207\367\250K'\307\325%\177\353#\325Y1J\310tr\254=\235\270\021#|\032w\322\320\302\336u\225\022\002u\314\241\342\373\256\223Tg`QB\025\327\032\317\234\323\032%Lq\2277\222=\232\bZ\264\001\"\013\263\251D{\310\244\033\303\376\316\21444o\225}\363\257[\367\341?\200T\333\\\310_s\256;w5\315\3253\252\226\251\251cjj\230\232\372\345j\234\252\001\324\324\267\253m\252\256\225\352\262T\223\243z\034\325K\252uT\237\200\214\217+\302_\2312\347\211\"\227YF\206\341\370\327\317u\265\237$\325\343{\371`\306%\225\370\372}\246\230'Qu5\206\326\263\235L\232=>\022\277\313\270\223IL=6\227\305\306\251\025\341\312\211\325\234s\310v\362\317\372\221o9^P]\364&+a6fug\301\037/{[\230-\263\202.p\373\262\245\030\007\334\270"
+	.string	"V\227e\333\333\256\226\227\025\375l6|\245\275\324\n\233\335\255\355\301~\013\362(W\327f\255A\027\343=V\222[\356\203:\200Ztn\311%\245\034\3544ZD\037\273G\232<\t\3279?W\327\307\036S\006\210;@`=9\331\230\336b\345\311\361\005\222\021\004o\302d\367\001\215\026G\222$B\251\302\265\376"
+	.string	"F\223\022]\263\272z\006\325\245I\213\007\276$\204m\316\271\343+yX\007\337\306I\017\365\364Q'\375^y\362\353\240JXS\276\336\021O\b(\310Wt\023\272\317\367\2017*X"
+	.string	"\"\310WD\036\021}\350\361H\003-"
+	.string	"\362I\320\200\301\216\216\200\237\257wd$$\201h\302Q\220Q\206\f\024|>\237\234y:H\275\237\016<\037\017?;\"!\237\241\035\317g\264\323)\340^Q\220ow\324\353\371v\270\341\374Vy\353\037A\034R\326\264@rc\370\266bov\255h\316s+5`s\013\201\314I\323\242L\345\226\247I\211\037\347\234s\274\331s\035xno\366\002\264\210;`\224fm\rB\372(\3438-\223u;\2634{\257\240\025\020\303\314WfG(A\036@-\"\0203\335\376\35381\253[\rV\250A4e\234b\306\020\0053\201H\230i\213\305\260\002\2211c\007\020`U\265m5R\221\005$\t\266\024T?\251\261I\362\231\322H\222b\337"
+	.string	"\020C\037Q\035N\335\201\007v\030\026\242\222F\331\323\340[\360\211a\377\366"
+	.ascii	"\205 \373\343\203\341#\352\356]v\030\017En3\232e\337e\211\365"
+	.ascii	"\231A\242\317W\211\275\021\234\310\333\b\252\314\300x\024\247"
+	.ascii	"`1H\324^cJ*\036\233\001`0\362\0229\"\326*9\307\374\232\376v\323"
+	.ascii	"\260\344J_!]\373\021\255\264\224\252\257\224>\213#\026\016\""
+	.ascii	"\213\313\377}rDm\3030\362\357J\214\222\354O,<\301\345\220\026"
+	.ascii	"\361l\300"
+	.text
+	.section	.gnu.lto_writeInterframe.169.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`:7e\265"
+	.string	"\232\022\271<I\020\020\207\355\214\001\353\246*\215\035\230\362cA3{X+3\211\340`\250\351\231.\210\223\0205\275\033\377\270\306;\212S\211\033\220\201\362\003?u\366\354\231c\356\334:\002\337F3 %AX\22073\340\0337\330\226)\245\024\262\003x\003\312\003\316J\255s\022\323\031\251u>b:\033\265\316.Z\347\242\326\271\305\322\231\305\322y\305\322Y\305\3229\305\322\031\305\322\371\304\322\331\304\322\231\250u\036j\235K\264\316$\226\316#\226\316\"Z\347\020\255\263P\353\034\264t\006\261t\376\320:\003\265\316\036Z\347\016>\316\034Z\347\rK\347\237\245\263\206\245s\206\2453\206\245ss\351\314l\235}z\234\227=\316\355;\367\3648\363\3648+{\234\331w\376\036g\177\347v\263\2429P\027\300\304\025~\034\272W\312$\344\373F\311\027"
+	.ascii	"\257j\247j\207\266KuOvGv?v;v3v'v\313u{\351\276\353\306\353\f"
+	.ascii	"\314\035U\305\212\231QV\340\300\242\314\214*\323\022\365d\212"
+	.ascii	"\231QXU\332 \375\311\314()3\325\266C\177\231\t\225XG}\003\327"
+	.ascii	"\350'\311L(8\211{\\\020\363 \231\t\265\307\276w\007\354Ii\203"
+	.ascii	"\273\303L\250.\211\215{VU\032\231\t\345\306\350\244:\347\207"
+	.ascii	"\325.\322\341\2563\204F\r\024X\016V\204*Kl\234\253\322R\3329"
+	.ascii	"\375B\222,1F-s\22203\017\r\227\306\376\256\204Kc\207\203\202"
+	.ascii	"K\3253.X\227\252h\264\274\001\\\252\372\375\371-U\003\033\353"
+	.ascii	"\304]\021\331\254Y\252\306iL\203\346\263\354\252g\314|\226\035"
+	.ascii	"b\35713\231I\347q\227\371\254<41\270\367}\231\255\324#\263\204"
+	.ascii	"h\212\356\305\3529\233s\007\327\210B_\016\245\267\036\223&\263"
+	.ascii	"\204\245{\261J|\331\202\b\327\370\276"
+	.string	"tHT=\206\t3\263\225@=\327_\272\256\303\264\030f2y\203\027\205\003j\265@\234a\333\222\266\225L\016[h;\267\357\242~^\353\333X\204q\207\"\264\255d\272\226I#\230\023\234\264\305\315A|_:\037m+\241\246\350\272\213\333^\232\264u\346\244\210\357;\275\240m\245\277DP\323\034\r\327qn\313q_\277Yo[\005\356\211!\276\357k\324JNj[I\324@<\255d\273\003O+]\3469AT\257T\214\270kU]\343\373\276J\277\246\204dT\304\342\377Ct\240\301\262l\223\277Y\272f\036\246\333K0^(%1!\035\3050r!\243\250\305\f\026+T\244@q\302\004\321P\t\022#D\204\020j\n\002\361\001\310C\007\016\033hh\370\301\320d\372,\333\036\036%\373\356r\367\3408\3016G\252\227\n\033\006\313D\325\b\326\326i!\333\274S\025x\365\027\204Vn\\\t\260\223"
+	.ascii	"\233\3110\352\347H\177}\364\3271\016\247\330\270Q\233v\321\246"
+	.ascii	"e\310\361\247\032/Z\323-\326\364\2149\354\0132\316B\257W\274"
+	.ascii	"\255\202\372\006n\213Y\226^\253\030\323)\306\3449\n1}B\f\236"
+	.ascii	"\233\b\323Da\356|h\256K\314\3119\211\270\036\021\007\347\"\330"
+	.ascii	"\2377\366\305\026\017\301\245\205\372\311\245\233$\333\204u\372"
+	.ascii	"\366\202\007ii\020Z\002\340\037\2564\220uz\205%\022c\305=T\201"
+	.ascii	"L\301;\250\320\034 \273\202=)\211fY*\364\006\266;cNC-\253\261"
+	.ascii	"5xc\377T\033\003\333\034\304\342\325\326i\030\313D\315\033\354"
+	.ascii	"\306/o\252e\2015\263\007Gc\267\201s~\211fY`\355S\365\362\245"
+	.ascii	"\t\263,j\267m\235R[L\233XaJ\305{\330\237\367}3`U\261/\374\n\013"
+	.ascii	"\352<>n\\\255\334j\226u\201\270g'\003\026\025\013$\345\212\224"
+	.ascii	"\2115\345\337\212\355b\f\r4\016\036\026W{\017\216\367}\331\245"
+	.ascii	"XY\315\00243+\307\314,0/\275\005nX\377U\315\264\036\241\207\357"
+	.ascii	"?nB\306\367\3340\033\354\216y\031\031\325\016o\343\312\367$\224"
+	.ascii	"\374c\301\266)\026\266\007O\273y$_\n\247\374\016s\323\351V\354"
+	.ascii	"\216b\267X\306\021\021\316\267\233\357**\320<\037\323\203\273"
+	.ascii	"\n\273e\356\231\267\324=\203\363+\330\250<\t\277\005\2779\374"
+	.ascii	"Q7\341+\307D!\027\273\253s\366\254o\235\356(Q:o\034\351p\370"
+	.ascii	"\246\323D\033\236\303\267\234\016T~\303\013-\336I\266\261:\026"
+	.ascii	"j^\342\263Q\r\226\0053\3115H^b\315e\233\212\323\360?u`~\274\250"
+	.ascii	"\340]4\274\215a\370\fo\\2h\261\342Y0|\320\237\224K2\314\352H"
+	.ascii	"\235\242\352\346b\241\222\244\252p\244f~\363;\257\277\270Y\200"
+	.ascii	"\b\267\270oL\262\252\227bv\2676\311\346+\373\244\\~\245\210\224"
+	.ascii	"\331\215s+\356\\+!\231/\324'\345\342rN\031r\237g\326\201\300"
+	.ascii	"\362}\036\251J\262}\236_\276\210\305\250X\nG\332\357E6W\363\352"
+	.ascii	"\232\267\262\347\373\205+\237\362\375y\276'2\332\006\355\036"
+	.ascii	"<\354+?\350"
+	.string	"/\272\002\364\f\212\375Ns-#\373o4l|\n\270X\030\n;\332*Q<\255\364/\200M\356\351\223_Q\255\327\317\270\3629\247!\234\3134\367\3610?\020\201\267\224\211\246^\212[<&Z_\303o0\335b\272\321\354\376\3368\">#\r_)'*\006\365IV\374\256\222\234\300\271xl\331\371\256cc\013\\\253G\373\276\357\fv,\317\312`\003\037>\"\177\350*\327/\264O\013s\326\327\037\033,\312e\313\n\235\026\217\177]\276\357\220\\JT\001\325(\335\245\305\343\032k\323}\343\365\022\262\247?\036\371\223\250\032\204\357\373\322\270\362\200\273J+\331\t\210\267\024\bO+\233\356I\260\361=}\222\335\356\257\315Q\361\365Gf:\250\177\032s\363 \026j\031~4\3462\2621\2610\260//j\027\327\326\024\327\302\362\251G\361'.u+\217\372Td\323\271\355(\036\032^\t\007\005\003\255p"
+	.string	"\335\260\351qn/}\327\334]\032\257\271\351\254xUsW\235\252\271\327\034\332\334j.\325\334i=\331\334h\035\331\334gfedcba-\327\334`\375\330\334_\355\330\334^\315\330\334\324Nln*]\\\030\234{k\212V\026\326TJ\024(O\256\244N\254\252\242TS\320\326\271\237L\347\226z[g\267uv\266\316MZg\024\230\316'\2743"
+	.string	"Z\347(\2463\324;3i\235M`:/yg%\255s\222\326\031I\353\\B\353|\204\351\374\364\316FZ\347\"Lg\"\357LB\353<\002\323y\310;\213\320:\207\320:\203\320:\013i\235\203\264\316@\232\316?Zg\247\246\363\007\255\263\007\255s\007Mg\037\2553\007M\347\rZg\rZ\347\f\232\316\030\264\316=\232\316\027\264\316\026\264\316\0250\235y\264\316\0240\235'h\235%\300\340\034A\353\fA\353\374@\323\331\201\326\271\201\2463\003\255\363\216\326y\201\326Y\201\3269\201\326\031\201\326\371\200\326YG\353l"
+	.ascii	"\3239G\353\214\203\351|\243u\266\321:\327`:\027\320:\023\300"
+	.ascii	"t\036\240u\026\240u\246\321tnj\235g4\235e\264\3161Zg&\246\363"
+	.ascii	"R\353\f\203\351\374\242\rD\237V\335SS\245W\242\257\317,\211\262"
+	.ascii	"\260\2760\262\237\2604h8\364\371\340\205\2219*\226\r\355\220"
+	.ascii	"[\340\025\370\035\037\324w%\373\276\272\260\300\367\0316:\017"
+	.ascii	"G\201o:s+\361i\324+#z\360\231\025A\006\246\206"
+	.string	"\212H\004\306fMS\315\331\030\031\211\004\350\020\370\003>\201\017\03238\366=\350\207\300\267\236s\361\331\270a\222\007|\323U.\314\331\326\210\020-\366\314\006\215}\265\241N\035\021\237_\177~\3146gZc\"\204:\360\201\244]W\232\214\256Z\262{M\332%'\324\326g\266\251\303\276\305\316$\305\334\03792o\020\013Y\210\300\357\310\263\357\3000f\213:\274"
+	.string	")\373\fx\034\257\343\203\"\255b\337\326g\027\243b9\336\200>\027\332n\3168\035\321\344\370vs\345\273\3618\264<\237\013\355:\306\337s:\326\270\361]w\345{J\366\206\253\031\34375oP\213P\323\243q\232t\313\r\210\006|f?\204\375\225\227\033\274\256\251\327\033@\0377t\302\202l|\0135\236\200\267\361B\202\3216(\340\267\034\340\263}Q\261\002\276\306w\236\013-\340\373o\200'\340\361\361\\\350"
+	.ascii	"m@|\032\253\220n\211\001\035u\023Ok\216\007\243n\260\277\242"
+	.ascii	"\302\241\353\227\372\254`\025\025\250\013\326\fp\326X\301\276"
+	.ascii	"\345>\b\360\354\"\215\237\361\002\274P\335\321\026Y"
+	.string	"\323\323\370\256\203l\372N\303&'\343g\274\262\256J\322\031\371_x\310\370\006s\2253\303D\315#\004\352\n\304\333\342z\357z:\256AA\f\201M\364\334\223k&\262g\\\026\017\034<\312\177\341\006\243\356\257/\300\257\357\307\016Q\276\037\277\336\243\214\305\270cz\030\037\343y\376\226\236\211\213\013m2\325-n\025\030\302\245o2/\036\306\335gq\241J\204\316\311\037\300\213W\272\272qx\204,2\033\223r\331\330\314\250\033>\215\005\033\r>}f\177\332\312\267\327_eu{\335\361\372v\354f\337\351\267\243\327\373\364j\206eU\372\376\342\206i\360?\251b\322\037\275\322\363\324E\333\220>\311\315\205\266]\233[u\003\351\333\316\350\217\360\376\212\013M\252R\275\025\267j\205\321'\261\361\2051\323r\323\360i\354K\243\356;\335R\244XQ0\030u[\371+\356\037\027E\337\342]\244P\364}\306\311W["
+	.ascii	"\266Y\361,\314\312X\274r\361\307\256^l\305\232\276\024\257\202"
+	.ascii	"J\227\212\337\202\362SR\274\220\0341\275\341n\322\f\206O\343"
+	.ascii	"\245\027\263\331"
+	.string	"\2742\005\037\243+*#cW\357 \226i2R\277\331|G\305X\307\243\270\023\217\342\333\221\004\001P\236\270s\r\246z\345b\241\370\240\272w\222\367V\356\\\003\272R\276\312\305:s\342EDJ\271\236\204\223o\337U[tsL\013\310\236\215\315\306m\231d\201\350M\274\224\326\277&$\265<\222\350\205\352&\261\370\370V\234\307\267\235\362\276ug\312\225pC\234&zN\272-\207J<\211\037\262Sb\313\353\220\230\244Nn\211\370\021s\344\2140\354\362B\021nV\b\241\017\372\020\337c\242m\3208\220B\337d\256T\027t\303$\203^\211mr\305\343\207\007\001\202\t\320\r\210W.\372}y\233\017\037\264(\345z:ZM\b\266a\265\237\346d\272\275\374\217\302~b\307H\346\210\310\276o\267\340q\254o/j\034\353\320\360\247\227\360taUr\321\332\363i\334\303F\351Z\377\205nt\325M\345u"
+	.string	"\232\275T\036\307\323\037\373\251y\203]x\022\233\350\250\265\276\237Pr\215+\207\034\310\303wx\240o9\3216\350\231,B\322\323\020\017N\fi\250\036\022\304\310\023\220\245\022#B\220 Y\242C\203\222$N\0164\225 qR\302CH\021'$ \370$qRBDH\020\036\016\262\024\304\351\205"
+	.string	"1h$yPbd\311\223\216 D\204\fI\200\210\223\221\247!J\216<q` IPO?H"
+	.ascii	"\342D\344\207\222\221!NE\224\200 I\242\2244\304OG\204 QR\362"
+	.ascii	"\364\204D\211I\367\354Gc\006\336\350\034\021\237\017\345&\354"
+	.ascii	"\373\232\335h/\335\210^|2\013\017\263\221\254\2443\013w\025v"
+	.ascii	"nq\276\275\361\264\262\004a\235,]\377x\247\221\261\013\213\225"
+	.ascii	"\353\027\243>T\331:uRE\305D\256?\272\362\025\255\271Y\227\234"
+	.ascii	"\234\277\030>\263s\316\331e\215\352\301OQ\016\214v\326\361\364"
+	.ascii	"\326\377\370r\235\362;_\330Cg]\373\276S3\230-d\r\235v"
+	.string	"\3160N1N1[?\342*\367\\\343\232\2425E+\016d\326w\013W\271\347\364\033k\f+\350B%{\372HlkX/\222|\352\277\220\311\250\273Z\265\252R\232z\257\252\276O9J\201\362-\305\352\2065 \034w.\3127\340\225\357\n\013\350\206\351\261n\334\271A(~m\236X=&1\035y\364\2770\206Q\367\332Z\224\n)\372N\265\366\036M\354\253\226^\265\223o\351\273\030\023\345\002\265r\362$\372\332J\215\013u2i\024w\364d\325;\031\266\2763\321\357H\2528\325\275\306\035\355W\235\372\216\243G\006\372\215\246\237ml\236\013\275\261\307\212i\"\331R\177\343\312\307\206a\357\336(\235\243\030.\334\352\277P\206Q\267\232\332\024\324\310\352\035\252\366n\265\306u\276\t\357\262+t\223w~Q]\224\013\n\037\365M~\204`T\354\204G\241\316\205z\035!\030\351\216\206<\341\275\356\352\245\013"
+	.string	"\276\355\\\241>j\316\205v\240\334tG\243!\204\372\016\204{c\362\335\307\266\344MX\201\335\342BmT\315\260Z\270\226\274\r\266\001\260\240d\252\215\013\031-\\\372_8\303\250;-\355)U$}\227J{\227\356%A\362#|\0221h\t\217\344\213\376\242\\\216|\221/\341G,>\375\0217\027\352vmf;:\262\372\364n\307\306\307^\261b\344\233\221\310\027Q\301\205\266`5\205\352\216NC\344[\220\r\211\255\256\221\360\3357\344G\020"
+	.string	"\233\346Bm\364\261hNG\347\225\0351\206\274\215+\037k\306\226\211\360Jl\376\354\ra\324\314\264\230\361h\334\303f\205?\371/Ta\324\215\206\346/\332\367d\027\026O\276'\321\336\237\250m\t\001\204\027\362!\210\271a}&\314\235\313\253\202\3007"
+	.string	"\366\313\rkr\246a\275\3349%!\337\244\366\366+&\375U\323\022\004\310;}\220\037\017\244\353\307\007\357\264\206\335\372@"
+	.string	"\036t\360\034\274\007>\276\203,\037\337`6x\016\332\260\323\rV\320 \203\357\361\032`\360\031@\341\201\301\005\337\343\217\275\342qA\253\265YP\301S\360\026<\022\217\257\300\312\205\362\220\233\340)"
+	.ascii	"d\243.t\202Gb\223{\342\271\275Q\361\343Va\324\266\254)>\215\313"
+	.ascii	"\364\334\246d\357e\354K\266Wf\251\3476\225\340\033\3210\202\227"
+	.ascii	"\340\375\213\240\235d\004\316\354t\301)\350-\215\340e\3209\266"
+	.ascii	"A_\212\035o\f\321Q\361E\321\200\267e\3424\361\306\3128*\2360"
+	.ascii	"\254\322#\352\303gv\310\354\257|\214\017o\214N\354}\314\216\330"
+	.ascii	"\0313 \370\232\3509Fw\327\346\305g\214\254Q\261\0018\247\241"
+	.ascii	"SN\321\031\2356\373\316+\341|\341\354\317\314\004\004p\017|\003"
+	.ascii	"\017\301\013\325\035\226}\037:\360\017|\027:\300\3007\220\370"
+	.ascii	"\204\f4\361\302\332\034\025\003\204p\250Sqf\001YR3e\246DDF\222"
+	.ascii	"$\303\032\203\030 \024\005Er\244\347\332\r\023\200N\007\023\321"
+	.ascii	"h G9\253L04\023\230\242\202\244\224\016\210\200D\367\320\240"
+	.ascii	"\222H!D\027\303.\202\2304jR\240\312\361\342bK\3607\242\251\374"
+	.ascii	"= \220\231X\027W\307*\322\340Qj\0079<\266Q>]"
+	.string	"\323\304\300\t\363o\361\370\243\242\327Y\t\275j\325I\t\321\274\363\345\222\006\357m\031\272R\3516\335\220`2\321F3\270\001E\270\341\035Q\362\227\212\324E\331\332\200(\344C>\322(9\244\211hbF\227\344\335\f\026+d\271\242j.%\250\007F\356\215\346.\341|B\304a\265\237'\277\301\365\026C\304,.\3322\034\307\005y\002\226_g\350KC\n\211#\303\030\204P\306Y\306\203\265\267!Z\374\022\037\330$G\353\322\334\365;\013\f\363$\275?vhi\264>R\032\363kr\336=h`V|Q\322\211x\277d\312~`On\020<!sc\023?k$\360\225\341F\260\230D\226\023\224Y\013G\203~h\034\022\200\304\365\230?\217\315\037\274\\\331\253%\274\344\205\350W{\007\354l\367NB\251\316j&\020x\256\337\2400\261eF\2717"
+	.string	"\302\032\356\001\217\352\334S\251\221}\202\370\310\023\216\\:\226\262\006\331\274X?`\310\360\233J^\342\273+\022s\335\266\346U\005\311\032\024.\321\225\320\227#.\205^\345q\304\275\262\335\375L\275)5\366W\377\356\023\222C\263>M\2748z\276\317f\t+O1\324\362\273A\274p\030\377\312\316n\263c\223\2155\377\226\265\346\322\364\007(o?E\325$\205\272\352F\\\r:\220>J1\003\351=I\3300"
+	.string	"/\177B+\365\332\366K\267\216a\371\312\237\306\036h\371\262O4B\312\214J\352g\340S\316\220LqB\341\"UU\332\177\027\235\226\274;'\217z`\251\301g\ta8\340\270LX\375X\007\2059%)_\310J\347\2004\020\310\270\032Y\354,,N\244M\267p\306\253\247\235A\013v\355S\357\273\217\245\364\361{\200\225ny\326\260(\231\216\310\206\3743_2\310\303P)\363z@M\243H \303\315\305\330\270\224\350v\023\200\r\356\345^\177\0314\3701uXl\021P\360\034\215Y_\205\323\306\026\033\256\366\013\313\266\347\315s\323\017Qb\f\232\202}9\336\353h%\023\207\226\354*\226\240-\002\001\005\302\250\021\274\307\003\212B\350"
+	.string	"\207\275\241\245\301\355"
+	.string	"S\241\331"
+	.string	"F\3165\3372=P\227Q\242\036Z\005ah\017Y\321\337\237\031,zH\352\261\362*\335\030W)Er\016,M\360\225\3642\364#\311>\256\3674\216iD\307\0251GX\363\002\336=o\315#U\256\214\267\244\036\001\235f\330\301\211\002Q\\\376_U\034\347N\"\013\006\247\r4\323\023\341,I\325q\242\362\364\305d\363\216\t\203\034I\250~\3321\b\336\216o1\377h\333\006\360v\222\025O\216j\312J$\023J\254\273\202\177K\225@\250B\336\241\244\031"
+	.string	"P@\247a\036\245~\252,\265\r\"-\020\207\365\373\0352\272\202!\307q\352\305\213\37384\311"
+	.ascii	"\235\364\334\006\032h\327kj}H\246\335}o\304\2008\303\230\262"
+	.ascii	"3\304\356\2570\254\252\246\326\2412\2072\374\255\307#\344\027"
+	.ascii	"*C\2401@\246\275\035\b\3220i}\352h\230P\251\2010&\304\020\270"
+	.ascii	"\303\215;\\\351\364\022\376\253\303x\243\026\340\351\n\001-\301"
+	.ascii	"\"\224\326|\320\23696Q\316X\027\362N\260\375\322\004\033d0h0"
+	.ascii	"\013\222\231\307\2454\313\207\005?\262f\216}tSP/v%\336\337y\212"
+	.ascii	"\310D\3270\306"
+	.string	"]\210\310\353\016\212\260\022j\300n\035\237\265O\337\216\221#\337\376\253[\001B\022\030\316\312\270\021\335\034\200;\016=\201\302\036\277\226'\021\345Y\306\240n2\273j:\372\2265A,By1\365-\356\254\202d\024b)\332\262M\245v\034\355\343\305\"\366l\221\232\305\324\250\360\3350W\375P\340\232\352\300\211uF\020\335d\361\261\035\034'\355\303\343\305\242\367\232\222\262\260\247\2118\230\205h\251-y:kr_\306OF=\225\007\315\306\244\247\265s\377\373\001\265\314\221\344\017\343T\244_r\217\365\300\026Oh\203\200\255\307'\3320\323\332(}\030=\003\345\027\217\257\265\242\210\366b*\026O\272\362\037~\250!\220\327\360\033\222\333\231\036i\210>\313;\021jr\310f\227\025\312P&`\001\027\306[\321A\037@\031S4\022\220X\036\004p5\f\004|-\316)\n\231\200B\263\032a\226i\354\3669AT"
+	.string	"\250\355\34646\244\"\024\243{!\206\274n\024\243\272\3506\307\257q\030e\345\024\027_&\255\353\332\225\302\352wk7\267\337V\333\325\245\365}\227\304\020\302\006\217\273\343\262g\362F\205\362\004\001L.\350;\233\352\221?)';'x\224m\361\304^\200\236\305}r\211\007cJ(\366\210\032\337R\356{\273\247\302y\220F\251\215\200:Vi\356D\272t\"5\366?U:\211(On\355\222H\202\317[\253\373\210\362\360\212\177i]\350\0033\321\353\341\213\367\022\025?\272\210\334\336\251\033\305\353{\323\262\2738\020\0074s\347\020j\210\264\363\302(\370Pt\377\201\325\241\017D\262H\305X\364\031\2359-Zqy\200\024\357\361\227\261\216\264\347\352\306\214\223\201\225\001\246N \242\334t=+\212\205-\202\345\003\201\021m\277]\256\261"
+	.string	"\210@\234\036\321\317\311&^\205\220\207d\377\317\352\241m\232,\274\264j\253\031\001 q\020\203C\373\223i\213\035=\"\225g\361ix\\L\345\214\224\22482'\002\033\253"
+	.string	"k[\347\253\021z}\023Q\245%\230\3424\277J\271j\032N\262\202)[\3012\216J\265\021\263]\333d\355\242\241\247\212\332=\016\266\025}\013g?\254^\235p\320.\302;\263\026y\023\026\352e8\232#\241\304\313\227\026Z\b"
+	.ascii	"\334\222B\201\331k~\301o\t\373\340n\001\177\370\334\237\273\263"
+	.ascii	"u\0050'\006\354\037\213s\001\242\351\002\236n\351\323\214\250"
+	.ascii	"\274\301\340\260n\320\031$\037\020\252\353CZ\334v*QG\352`s\307"
+	.ascii	"\356&I\007\035q\231\273\222\243\274\004:%UY\322\217\265\244N"
+	.ascii	"w\211\320U{W\204\360\265\004\252J\242[\310\254\233^\2149\334"
+	.ascii	"\247\274Z\225\035\210\203\242\374\317\"\021o\177\270\253\034"
+	.ascii	"a\360XhQBi\242\025\367/\236\b\263\304X\375\264\023\n\304U\032"
+	.ascii	"O\371AE|RT\212r\333\345q\3056[4\033\222\317\222$j\364-\340\255"
+	.ascii	"'\244\324-p\343o\322\005\253\021\"\250Z2a\320)\317\031&\373h"
+	.ascii	"\231j\212\234\317.\334\256\021\351\226\r\247\243\343\370`\325"
+	.ascii	"x\200\247!\300t\356\351\344\354\340\365\204r\033\246\\\3233\231"
+	.ascii	"B\244?LGc\220\356z!\214\257\n\200\221At\032gVr47\t/\312\210&"
+	.ascii	"\366V\261Q\300g\204\270I\003\023\016Y.KZ\203\177^\306-\177\001"
+	.ascii	"\251\374\367\225\253=\251\240\277\336I\350\002"
+	.text
+	.section	.gnu.lto_writeSlowFrame.170.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`R\004\255\027"
+	.string	"\306\350\220J\240\326Q:\326n_\261\023\322\362\333Q5\347\334=\004\207w\rp\356 \365\352\001\326\365y\316\344W\223\366\350\277qx\ta'\301\361\247\220_\003\263\343i\364\013\354\023s~\2511\305\n\n\340us\261\377\355\377d\023)e\ns"
+	.string	"o"
+	.string	"\205"
+	.string	"|\030\311/'\177\222|\262\371\315|f\376\302\3540\212Q\t\244U\321\243V\243/*\3658\2018-q\367\337-\236\026bJ\301\326\330(\272D!\262N\221TY1j51\263\363\272\330\316\0377@\271\263\266\270r\347\351\337D"
+	.string	"Q\375\325Pa\025Iu\325Zw\035\\\272L\277[\\\031\360\350\267\fsPk=\003\217\220\366\275\377\r\374\277\371\311!\001\233c\212\213\334x\373\317\240\341\347\255T/Vk]\360\275\2618v\276M;\277\201\207\027\270\363\313S\356\334\226\021\207\370\353\033\274\232\361\251\366U\345\357\343\343\005\276"
+	.string	"\211\376}\203B\216\260\216(%)[\225\247\374\306\0377\323\277d\255\265\276\227~\346\343H\376\r\306w!\371-0>\013\363WJ\276\215\371\265\222Oc\376\214\344\313H~l\006\265\016\321\031\253\204B\351\260vb\235\322\240QD\303\024+\266^\351\034-n\022$\266\244\032\255k\235{\260G\bFhM#\034\242\230\311z\326\271\b{\205CD\3264\303\023\003x\215[\274yq\001\374%L\220\t~\305\332\212w\302:\326\245\027\205\255\n\002\363*s\263\313.\253*\354\217 \037\263_\2042\301)d\377\247\331\"\216\r\253\326j\263^\300\255n\262\267\250\312oay\\\330\321\375\"\354b\f\001\327I\240\303C\300\240\306F\007"
+	.string	"h'\250\207\007\242|O'\302\227\303\241\307\353\311\331u\340\341\371\354z?@;\035\201\373<\354\374\354>\370|?;\232\261.Y{\351\262!\327q\250G\\\210\254\225E\003-\033\374u\\s\255X\340\326>Y(\275o\323i\013\312D\231\312\235\270\206\021&\315\254\224\272\266n.}\013\256\023\372\244\345\3221\304\031n\351\237\276\2400X\272\305i\231\320\247%,\035\003u\200s\273\306\315\2422b\001Y\250!`%\2313#\"\005))I3\006\320\002\031\031\033=\020(f\210lJ\325\001\226\221\340:'\021 \004\366!\tH\214x\020\214\016\353\246\324\323\2457y<N\222\004\031Mf\214C\242\363\bM`D\020\307K\205\266|\203\021<\240\242gg\246t\312G_u\213\004\273\306\354\330\231\347v\334\315\206\\k\005\354\006\366\031\t\200\234\315\305\241\244c\265\367\205\261\261\306\025\213\273@"
+	.string	"\310'C1\271]\031\020\343RZn9\tL\357\215\213\3736\340Pk\013\210\340\307\030q\321\231\252\032"
+	.ascii	"\371\335\352o\213\365\037\315\337\271\037\350\322\"\344?"
+	.text
+	.section	.gnu.lto_loadSlowState.171.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\252\007\335("
+	.string	"\nI\254\017E\200\334M:\337\026\233\230\266p\2115\362\232\346\351\2303\271\024@\007\007\210Di\223\334\372\252T\224`k\303\035q#\300\021N\217(R@\333\330,\f\240\222\312\334J\354&\026\\\243\004\017\354\356\326\b!r\247\024\344"
+	.string	"\320"
+	.string	"\361"
+	.string	"\336\221\232.\3655\034-\r\330\216\036\037\226\251\025,\256OuC\236i\362\342O\314\022F\360\271\370_\334\313\032\276\313\275\230/Z\315\207\203X\203\271\"ZZ\025\241;\351\033\377-\356e\035\211"
+	.string	"a\202y\242\226\357G\254`eY\023;W\364\324Jlp\322\034\234\345#\302\251\375+\307b>\313\215\017\325\232\244\315L\255D'?\351N\232x\243\362\244\356D\345I\233v\035$\256\372\223\240\226\346U\324Sk\205Z%\336\217\304{\244\346w\272\\I\216KM?\207!\201P\355\367\035\002\262\036b\327A\341!\206\200\215\207\020\232\013{\331\013z\215\276-\247;\202]\224\034\205j\255AA\256\361\001\375\nn\321\361\311\217\357\277\234\001\023<]\340\210\t\3768\315a\250\265\232\236\301\0367\357\266\265\330\036a\347\276\002\376p4 \350\356.\031\257?H\324\016!\202\376\244\2335\266\265?7\t\305\2766\211\2331\241\253\265R\360\313\230SJ"
+	.string	"\265\ro\234ncN\306\204?\364\t\024\024\305\036-\2710\b\033\323\372i\346\224\024\376\220\306\021\342\247=\f\013\177x.TVLf\265\002\177\236\364W\224'\231\366_C\2004\316T\314\23218\267J\371\330\304\037\3352\373\257\265Vo\022{J\352\304;\n\210\232\351Y\376\005/\336\276\036\365R\217Z\211G\235\264\243>\240\2436\240\243.\220\243&\260\324HK}TR\017Xj\243\245.*\251\211\226Z\300R\017\225\324BK\035`\251\203Jj"
+	.string	"K\r\264\324\275\222\232\267\324\273\245\326\225\324\271\222\272\244\324$\245\036I\032m&P_\230)F\177\036\330\031c8\366\347\207\021\256\331\255\265\376\326\r\376\342/\214\001\277|\224B\326$Dc\200\310\353\354[\021\003\373\240\226\002G>\307DR<\335\236\312L%\364g\201=\020,\004\226\274\315\024\006\025\207q\247\333\022\330\037\255\321\"m\025\327\031\034\240\001{\264%\235\263\001V\212V\300\032\255\022\327\331\032\217h\213\266lBTeh\003\254\200]*\236\251\321\t\355\320\222oO\204\250\004-\320\006\330%\256\2632%\200\r\332\362M\024"
+	.ascii	"Rz\273[\240\255*\236\201\031y\333\333RM\no7\2160\212n\313\335"
+	.ascii	"\255R\3310\316\353\307\326\255V\346V\267\271bW"
+	.string	"\237-\032G%\267\027:q\243\200\332\246\025\023\013\375Y\256\326\021rmS\313\327\214d2\220\373\260\"\343\332SO\243\265oN\267$jo\350@\177\216{\203\310\256\003W\217\361b\005\215\024*\256\\P\325\340Y\005\004\025T\017,H\250\360T\224\205\345b\306h\253'\033XU-\254\250\\TA\301\270\242z\001e%c\006\324\323\222\261b\254\220\001E\003\013K\006T\217X\377\272I<\2749\201\263\003\334\255\335\226\3559\255Of\272-\313s)1\251\245-)?\\\357\343d\266\324\204\026\306\226\253a\344&X\t\227d\346\324\206\007\005Y\245|nb\255\265\324*\243\266\252K\023Z\220\255\356\211QT)\207\371E\177F\255\317\177\27322;mS\307\361\230`\016\224\226\252\235A\200b\326\354\300\271\325-\347\235km\344\2269\307f\247v\345\320\006\367\355\227m;\335\267Srp\320=kd\276\305"
+	.ascii	"\244|>\326Z\3538\265/\336\007\244|\354\340\276\235\332w\031\331"
+	.ascii	"8B4lI\233\345n&\230Q\005\333\f\376\216\351\343d\320\201MZ\352"
+	.ascii	"\247+\200\242\25018\346\220\222dfDDD\223$i\f\360\002\021\241"
+	.ascii	"\3426\021`\301T3CRP)t\004\317\003fi\300c\225\202\021\230\367"
+	.ascii	"t\037U\027\300T\373\371\310\340\234\341\222\b\326\013y\n\003"
+	.ascii	"\232\331\023~\340\226x\177l\350\3109\007\353jC\271\274\233\237"
+	.ascii	"\232\357\r\315\007\232\020\204\230!K~w1\002>z\354\004\331Q \312"
+	.ascii	"F\312\340\357~\204(\252\275%\177\017Zu@\017\255\034\\\212\324"
+	.ascii	"\365\013\242\235(\271\206]\343\361\225=\200\226Do\005\0237\316"
+	.ascii	"\212z\231\213O-\246\3756\2354\305&\016\177C\223,]\323\271\203"
+	.ascii	"\334K\230\371\316t\320\202\376.\366\"\001\375\316t\320\202~g"
+	.ascii	":hA\277\263\224\366\226|\314\261\2613\204\213V\347\362q\331U"
+	.ascii	"\212\004S\264\311\031p2\007\003\262[FA\264\216b\240\251\t)\034"
+	.ascii	"b\270\340^!\304\021k\317\206\204\b\"A\307*g/\364M!V\266f\370"
+	.ascii	"\272f\253\351n4p\215E\343\227\374\317\007\004\016\"9\365\204"
+	.ascii	"\037\340\r\2219Z\276#\033\336\262JB\253\301u8x\257\016R\001"
+	.text
+	.section	.gnu.lto_writeSlowFrameIfNeeded.172.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\017\004\305\033"
+	.string	"\246\260\255H\260XUc\304tJ\375\b #\030X\016B!Pfo\306\221\005,\377\027)\260\300\345\013\264\277\256\007b\215rn\224e1=\365voKN\344\214\262\177\340c/\2401a\215\021G\2066*I56n\262\367\2262\245\232"
+	.string	"\220"
+	.string	"\233"
+	.ascii	"\376\361}f\361D\261\261{4\231\332\357\026\225:\033D\336\314I"
+	.ascii	"o\340YbS\353y\264\003\257\362\343\021\271\367\347\3004\346I\333"
+	.ascii	"\2060\341\307\264\003\267\232\224\007C\033CB,\367\376Z\326\305"
+	.ascii	"i_\251\314TI\216\266\322\374T\r\206[o\230\342j_\345\256r2\312"
+	.ascii	"\371\256@\206\321\212j\246\024$\035\255x\371\202\033\032e\202"
+	.ascii	"B\225|\322\221\212\217/\270\033\013\027T\355\030S\004#}\301\335"
+	.ascii	"\306\006\304 V\356{%\302\001\325\232\252\271\367\272\246\270"
+	.ascii	"\243\233u\3331l\343\330\226IBK@=\320jU\366u|G\t_\3119;\365\351"
+	.ascii	"I\177\307>\007\024\025\266Z|\035\336\212\226,\2554\255\201\033"
+	.ascii	"S\236\240\202\252\026\327\364\312\223,Sn\215\262\177\265"
+	.string	"ju\366m\261X,\332\266\260a\316\373\315\367n\262V\217c\265\035\253\353X\375\0013U\200O\301!\317:\371\335\242\342\226\253\204\024\262;\360\357\275\332\347\311b\343\377\374\240Y<Z~\3438~\016\364\371\025\272**C\037\304{\215n\314\223\177\362\230\362$\202\023(O\336\001\027\016<\021\007\323kl5\212F\022\017\276\322\202\027\367\336#G\342A\b\3424\360\342^\333\007\242\334\241\354f8]\207\214b\214\322\352<\363\321\316\200P0\025\301}\244\274\360D\206\256W}:Z\013HBK\302\007O3\335\345\202\027\300c\227Bx\030[\224\330\023M\272<\221\001\352\177\017r\232\367\332\236\372M\007\342\343+\2354\210\363,O\332\"F\324\247\226\t\2625\237\307\016\005\203\035\316\351\247\225\357=\002\222\255F\331Rr5\026c\202\342K\224\326V(`\022{k\355\0031\035\227\216\206\036T\246\241'\206\003"
+	.string	"&\333AC\344\260\f\203"
+	.string	"s=\250 \201\002M\201\230\3169\343\360:a\3509\213e\350Ae2\327"
+	.string	"\277hL\2407\"^.\331M\013\347t\215h\275f9-\232\004FI\304f-\035\024\235\265X\277\373\361\252\316t\217\346\205\207\201\261\025\220l\026\310\fvC\234\356x\357\275\253\230js\350"
+	.string	"dk^q\271X\246\334\247\">#*\253sM]x\330\2607\3244\236\351\244%\262M\332\033`M\"m\255\361\3436\231\302\224\325\371\276\352\021E\364\031\357M\nV\250\201\034\245\224\203djF&I\030m\212\r`\2421\351\252\003\021\260=T3\223\266n\211\211/\004\365\240\231\353\003B"
+	.ascii	"\277\206\2338\022\326\267\366\bMQ\234\230B&0i]\257\022a\001Y"
+	.ascii	"H\\^\345\235\001\251\"\310 \200\247\275\244\261\022\364\206D"
+	.ascii	"\352]\321\210>Z\300\216\034,\346])k\033m\222<\241\205\303\220"
+	.ascii	"\362\034&\025\016z\246\370V\235\032\262\364\216zi\222<\235\026"
+	.ascii	"\343\304\331\312\303\274xe\013\205<] \245\376\304\346\205\234"
+	.ascii	"\235\210 \321hM\002\007\310\2115oT\251(\347>E\332\257\024\244"
+	.ascii	"\317\\59(z\316\346\336\025\022\301F5\245H\316,\275\032\213\325"
+	.ascii	"f\376\001"
+	.text
+	.section	.gnu.lto_blackboxValidateConfig.173.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\333\003=\027"
+	.string	"\226\247\215K\240\324U:i\270\024o~}1n\274\204\257S'{3\261%\2174\323R\333\374z`\222\361s\350\377\254\265m\275o\005\260q\277\340k\223Zx\n\257\303k1\344\2309\032=Vy\226\325\220\211pI\223m\215\020\262\211\224I\006y"
+	.string	"l"
+	.string	"x"
+	.ascii	"\265\326\004\247\013;"
+	.string	"O_G)O\311\007(O\337\332\332n\020\025]\265\271,E\361\030!\251\265\306\032\305k_\235fI\311\346\332\336|!}H?v<\333W\346\213\211\336\317O\240\317\317\223\217\b6\313\001>\341\322\216\027\342\224D\351Q\261;\341\355\220,R6\214\220\271\026O\307}\302\303\221\257Z\353\211\316\034x:f\363\245\326\272\274\343\365\276\254\357n\211\335\215\260\333\306C\247\213\223\303\337\235\356s\232\2001x\343\343\"\370\025\237*S\355\016q\334\276\335\223\265\201v/\374\272H^\023\346-i\336V\363\262\230w\305\274g\363\232\315[2/m^\262y\233y\231y\257\222\222\242C\357\301#\265\366\034\223T'\232\364\273\360\337\275NQ\313\236\305~\270-\035b\313[<X\273P\303k\257~\303\320\322Q*\036\\}\341_7\246\332\023\356&{\227f\002\177\347\352\227\256m\373&\373<U\334\335=\203\247jx"
+	.string	"G\277#\013\211\246\017e\373d\274\006\rX\221\177V\306\230\255\004\325Z\221\026"
+	.string	"!\362\243\337\220V\352q\"\212\266o\271\337\235T\204\"\026s<u\362F\347f\0375\207\361\202\033\202\020\327ZmM+\3371Dc\216\247v\327\346.hg\255\271\006\373\242\023/\354\003;\3232#c\360\300\305\001L\200\316l\246W\006\226\201\026S##\243\020\023\2530\223\331\304dnpb\260\003K\263@s\023\303@\243\335\304Z\303\333\033h\005dr\2725n\325\276\205)\241`\236\024"
+	.ascii	"\225\316\002\245I\247HxQ\306\303\244\r\030\211~!\340\b\263\244"
+	.ascii	"\233t\264\272\204\325\255\246Q\253f1\345X\2018\033\307l%H\351"
+	.ascii	";!f\237\256.\333l\272cg\005\216\217K\273\2741;\223h\257\b\005"
+	.ascii	"\201\001U\250aL\007\231\"\032\005\005%)(m1\260\002\241\021\264"
+	.ascii	"\r\021@\261CN\331\222\267\003\243\210 \301\311\f\007\372\r\263"
+	.ascii	"\030\345\336\206\216\027\335\271%m,%~P\241s\022\256Cn\330U\235"
+	.ascii	"\034\276N#F\351kOW\241\006\214n\347\353_w\023\234c\374y\363e"
+	.ascii	"\007\271\013n\374I\216\033\373\022\032-\20008mw``\2215\315\215"
+	.ascii	"\026l\0333\r\304\341N\300K\243\373\237\001J7\223.\273\316B\364"
+	.ascii	"9\263U\313X\006\273ZGN\023\021\371\264Wa\250_\231\213B\345$n"
+	.ascii	"\030_Q\205\274\024#\024\226zd\245\264clq\377\003"
+	.text
+	.section	.gnu.lto_blackboxStart.175.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\026\002\325\022"
+	.string	"\206\341zI\300\020)\035h\243h\007\263\235g\245\230\205\322)7 \255\bE?A\034\005@\275$X\341O\226\207\230\367\274\302Z\375\372-\325\202G\230A\274R\330\246\353\222mg\033\273>8\036\213\033k_\271\202,\0367D\b\3312\245d"
+	.string	"_"
+	.string	"c"
+	.string	"\276\321\314f=\274_D\263Y\246\331Q/s+\340\205\t\233\244\251\335\035\247\207\323.\206\340T\232\017B\326.\256v\036\236"
+	.string	"\325\270\3118A\356\034\004K|:\370Xd\005\260\005\303\311F\204\254\321\t\216\340\200\300\211\2207\220@OE\216\023]/\220\026T=Pv\327\212#un\217\333^\261\335\300\326\007\001?\273\274\351\374\261\017\356\356z\372\330\240Z\247\372\037\037\032\302\271\321\371\022\323.N\225\216u\n\233\202|\243\357f/\362\221N\200h\260\036\332\246\275\224\265j\312%\237\264T\026xHA\204\002\325\037\371$^b\366R\006\226K\222\334F\270(\232\332-\r<\264k\365\260\365\021\361!x"
+	.string	"\342\303R\253\277%\317\354\250Uns\266gM\036~w\020\336\257\347\353\325t\207[\004\255`\002\347\217iD\rQ\233\245E\217\323\231\240\347:\241\017\265c/z\234[\267Y\263\211\216\303sT\275\024\3632\3613e7\243F\251\354'\235'\363\201\0343\243\307\315\210\017?I\2404\330\264\312'\372?\3502<\255\006^9Yy\035`\200`\201+"
+	.ascii	"L\346%\343\200\006\346\262\262\212kB,\245E\345\005!etayE\030"
+	.ascii	"U`bFW\211c\022`0\243L,\0063\262J\333Ql\363&\302^\3648\317YkR"
+	.ascii	"\342\251\205\363G\027\342\351\350=\033\2123\215@\361\330\264"
+	.ascii	"\312\003l\260\b\341\355X\237\324w\177.*\306\323\"\3757<\034B"
+	.ascii	"\276\033Go\331\364\207AiC\216/- P\0021\212\335\035\030\373\203"
+	.ascii	"\252'\016\210aL\302\032\035\310N{`\026\fj'(4\200\354\340<0ya"
+	.ascii	"\330\300\007,@\334\363]\272\007\353:\001\260D\211rw\324nP6\352"
+	.ascii	"v}\336\330\244Ih\354F\244\257\306@\342\006\013\032\307\232>0"
+	.ascii	"@\013\231\336hp\274\272!\001\b01\277\030\271\035@G\016\342\021"
+	.ascii	"O2\372\352g"
+	.text
+	.section	.gnu.lto_blackboxFinish.176.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`l\001U\016"
+	.string	"\006Y[E"
+	.string	"\2576\035\277\356#wf\177\225\347\002\347K\331\363\355\351\321\317\212\227>\351\374_m\332\tF\305\251\342\007ON\237\320\003T\270+\364\314:\267v\351\323\377sU\025\242"
+	.string	"T\027-\023\024\265\277\376\336d\313\224\002B"
+	.string	"G"
+	.string	"I"
+	.string	"$&\330\276\375\027\316\366\230\263\305\243Z\026\200\252eA\fkw3\031\341\334\347%\225\363\357r\016\030v\237\032\277:a\312\245\367a\032\244\224\204N\250@\352\246cw\255`\210rc\267=\300\366\307>\212\335W\276\251b\275X\330\321\n\330\370\364\205}\f\317\260\371%'0\321\203\237\276\t\366y\311Q\021\351h\225\2510j\325\254\262\260Q\236J\b\366\3458\216-K\026\373\352c\374\224r\322"
+	.string	"\345&F\354\236\214-v5\003j\223\224\350Aox\262\363C\230V\244x\314o\252Yu\352\342\244\024iF\302\370\",~fJx\276a\036\376\341 ,~N\250p:\037\255\352\002\205\035\301\234\303;XT\025\245\225\007\337\276a\237\n\332G\331\0261v\003\006q \320>D@\036\004>\262\002!\036#\031(D\222q\004\260f"
+	.ascii	"$\224\035\320\264P\346A\211~\255dq\371\031\234\034\254D\322\363"
+	.ascii	"7\334\035\327\356\356\004)\221\032\2562'\232\026\215\246H\251"
+	.ascii	"\322\225\241~\b\366\361\"\230=\242}&\326&' p\202!\312\352\240"
+	.ascii	"\353\t\205FW\300J\036\013T?\0024\035Z\214]\330\b\202+\256^\013"
+	.ascii	"\335\302\266\302\344\013\324\2533\031P\210\035@\215`\004yWc="
+	.ascii	"a9\f\277\347\0247\030$\350r\213d\001\222U\t\fEX\200\344\037p"
+	.ascii	"\222.\250\235)\343|\325\231u\031&\003"
+	.text
+	.section	.gnu.lto_writeGPSHomeFrame.177.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`N\001\335\013"
+	.string	"\006\224JB \253j8\300R\220\270\264\205\023$i\327\r[3\302\322[\023\234\3731\026]\003\001`\355\2655E\3339e\017\317\214\333\376\305\347\274*- \300\364"
+	.string	"\3502\236+\340\2335\001|\333\210mo)S\n6"
+	.string	"3"
+	.string	"9"
+	.string	"\027l\273.\267\017K\353&\020\260}\215Q6\207\n\226\r7,\310Z`\035v\327\323"
+	.string	"G=Q\376\021<#\252\302'\204\307\356:E\325\352\326\333\316\260\335\261_\013\230w\327\214\202T\336\374\261"
+	.ascii	"\227\216\3353\214\215\222\222\027\215\261\242\2419\343\013\206"
+	.ascii	"M\017\366+L\005`\237[e\331OsO\353\323\371\3645\024\266\r\253"
+	.ascii	"\007\366\307e \023\032\034\374A\310\347\3730\3574\203XK\345\255"
+	.ascii	"ALu\323:\220\241\303\030\244\001\211\274\332\242\221M\372\002"
+	.ascii	"0bw9|\327_%\376\200w6\235\362\342;\377\024\376<' h\364}D@\336"
+	.ascii	"\210\350C\362\276\222\311\363\\\030$\t\225<\023\020,y\232\327"
+	.ascii	"\236[eeF\027-\245*\346:\237U\240 !\002\247\233\026gL\240j[\343"
+	.ascii	"\020@\013\001\273\333\021# \320\002\031\222\363\240\352\r\204"
+	.ascii	"\266\227\300\313\336a\207q8X\305\355\025\260\367\2701\230\314"
+	.ascii	"\227\361\325k\030\r\030\2260\260k\351\002\033\013\026\003I\270"
+	.ascii	"\343\262\221c\023\201<*Ch\361LU\r\340\215x\214Z\313\352\257!"
+	.ascii	"\200\322-\332\363\004"
+	.text
+	.section	.gnu.lto_writeGPSFrame.178.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\337\007\375$"
+	.string	"\266?\340B`\250M:\353R\201g\006\317\350\333\227\232\022hM\016\261\b\006\020\253\242n\007\221\274h\355"
+	.string	"\277\333F$>\362\310\355o\316\370e\347\355\355\271\177\032C)\367\245\245\315p!\021\3326i\204\220-S\n\302"
+	.string	"\270"
+	.string	"\324"
+	.ascii	"\271\334\3324\327%\271&\311u-\327K\256o\0055\026\b\354y\350\244"
+	.ascii	"\251\220\270F\351\236rm\213O\346ip\374\350\243\261\312\342\210"
+	.ascii	"\207\376\214\r_\3271-\346\250\344Q\323\340e\0169\025\352^\315"
+	.ascii	"/s38~\306\006yL\213\006\314\234\275\205Q\364\322\037\316\227"
+	.ascii	">\362dp\330\274\227\347\3314\202T\370\332\017s1\350\307\350\370"
+	.ascii	"R\232\212\265y\223\246\307\237\251\316\227>\336\311|y\236\311"
+	.ascii	"|i\324\036\324\333\221r=\270\343\366\245\246(MS`\035;z\262."
+	.string	"\352\337x\035\261\310u\262\310+\311\340\r\016\242\244b\027\351$D\013\361\306\257\217\342p7w!MS/\261\bv\227\267\275\301v\t\373\264\n'c\364\366\246\032\205\351\240\2460\003\250k\031\331W\373\215\377\0176\306\262Eo\233\246\351\025\230U\325A\375W\330p\343\354\267\271\033\024>\026_\005\367\304\240\371\262\252JY\t\023n\234\237\346'\033\004\207-E\363\007\3612\264g\221\241\247\3330\257v\237p\341|3DH\3534\267\034\323f\201\265'\332\327U\271\274\300\214\016[\272p\366q\270\225\212}2\255b6\271v@\256\253>\346\367\235\353\250s] \267&@\256\007\354\326=r\r\265[?\221k\247\335\272\211\\3\351\326\002\310\365\222n\035\340\\+\235\353\244s\215t\256\001\234k\336\271\336\235k\335\271>\311uJ\224\334'\251*\325\237\027\332\220\312\023!:\224\024\206\004\240\362*R!Bo"
+	.ascii	"\306>HP \336\221\006\273\2536z\005\315\242\253g\335\325\237W"
+	.ascii	"\331\320SwC\323,H\260\321-oC\271D \363\363?\250\027\024\fj\206"
+	.ascii	"\232\231/u\325\202\333\032z\366>h\232T\233Q1\347\203\032\021"
+	.ascii	"\264\275d;\253T\221\234Ys\365\367\365H\210\341z2\3441\217\006"
+	.ascii	"\306\326\333\222\007\305\326\360;\033\352\334\016\007w\360\260"
+	.ascii	"'z0"
+	.string	"_\2265\301\002\264\"\331[\262\332\037@\324\372J\326\273\361*\033\212\370\034\024\020|97F\234Xf\230/k\275\232\333\030\341\306\375\036g\306\231\246\251\004\037\316\327H\370X^\332\304\211\023\346\313\255?ce\315W_\377\365h\215\031\\YZX2\260Tdi\005uVa\245\342\252j\302\003\tTM1D\254x\201\025BF\326\212\255\255\031A$\007\251jh\245h\021\274r\221\002\230\205u\365\002\030\334\212\001\244:`-\030+\266\2002\264\264\266\200\274\243\360dZ\305\254C3\356\021\326\241\243~K6Vel\305\246H\211\022S\240.\0244-\352k\237\240\\\224\234\b\"\026\022\236-\0234mj\227\240F\2516%\005\352T\032\201\036\033\226A\251\315\317\"\251x\210\205\326H\206\"\004\316(\354\357?.\030\n\344LS\341\2116*d\213hq\212l\207\030%\202\032\331Q\271|\264/\003zu"
+	.string	"\222\375\341\243\327\005\352\251B%Y\036_OeNM\325i\311v\241Mv\330\344\204I@ez\262i\234\200\232\200\311R\200\272\204Fy#t\312\t\027\240&\b\200\227\250AHD\221BD4\n\n\n\n\222\2441\340\002\021\031#7\021"
+	.string	"\251r\n!\nf%\355\035:;\n\ni\262\311-\351\335X\370@4\252A\032`v"
+	.string	"\031\277\315\327\372[\016%\247"
+	.string	"\274!\t\216\310\257\301\276\377\246\212)\271.J\372\227\274\211\357>P[\217\261] \0358M\312\303\223x\301e\370\240d\323\321\0071M\274]<\3114\341\355\3529\340\357\240C\350C\275e}8\351\277_3\253 \354o\\\n\201`\254N\245\003\231p\266@^4\020f\004\216\026\375\362\212d\302$\244\002\306\223\306\362\312\035\305B\n,\350!\302\262\026\340\020\251\304\253og\027)ZN\340\013A\217\312\336W\217\331\260\273&\261\321\246\312hc\220\311p\225\324\036\347\241\036B=\353ZvqD\231D\322\211\231\372G\256\304\355&\f\026\016%\201\237\315\241\310\021\2463\373%z"
+	.ascii	"xd\241O4\373\002\027h\217\025\242\310\207E`R\003%\201?&\340\231"
+	.ascii	"\337\247\277\354i\236\204\2464G\r"
+	.text
+	.section	.gnu.lto_loadMainState.179.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\321#uz"
+	.string	"z\306\230+I \022c\215\001\362n\375)p\232ef\344\263\325\022\365\034~x\321\230F\357\026\377\215X\272\342\233\032\374s\177\223\322'\020\222\2705[\222lt\263\253\273\273\273\243\t?+q\320\271\026Ba\021\"\030\354\261\245\224R\246\224R\211\002u\002\304\002\3162V\347\247\3259\206\352l"
+	.string	"\353\\\300\352L\200\352\f\203uvZ\235\233Tg&\326\371\305\352\274\244:\017\300:\273X\235\005H\235\225R\347\026\2523\013\326y\305\352\034\200\352\f"
+	.ascii	"\353\254buNR\235\221X\347\024\2533\n\325\371\210u>\261:\233P"
+	.ascii	"\235K\260\316F\2533\t\325\271\210u&Z\235\207Rg\241\324yD\321"
+	.ascii	"9Hu\006*:\377\260\316>\253s\317\352\314\243:\033w\234wV\347b"
+	.ascii	"\321\231e\235\327\325YU\235S\325\031U\235_u\366\324\271;\357"
+	.ascii	"\310L\b\262\026,|\337#\211t\336\037R<f\347u\337u\333u\327u\317"
+	.ascii	"u\313u\223\351\206k\226\271\265\344\240a\243V\341\2345xl\324"
+	.ascii	"j\343\324\341\f\033\265\324\254\301\231a\243\326\\\026.tl\324"
+	.ascii	"ZC\337\034\032\350\203b\203\026\025(\356\034\270\313\260Q\313"
+	.ascii	"\212\034\353\025\301\307\246\305v\252\366[\307\261Q\313\b\024"
+	.ascii	"3\334\n@\357\337\333da\370\334z\260\235j9\201j1=\306m2-\364K"
+	.ascii	"\366\366\020:}`\336\274\357\273\324)O\261\235&\241Z\\P\356\346"
+	.ascii	"\202\021\320\3535\306\211\024\333i\0209P\355\314\035\246\331"
+	.ascii	"\334n\";\350}i\b<\363\276nL\334\304v\312nM\244v\312\266\220\332"
+	.ascii	"\251\313<\204\321\327\273\025\203\017K\330[\021\357\373:}\225"
+	.ascii	"\3777\002\002\002\"b\346\341\031\301\262\354\017\212\242&\370"
+	.ascii	"\033ukVW\267K\030\221(\"\032\022\032\021\004\364\343\323c\302"
+	.ascii	"X\344aW5E\337]\356\365\006ZeH_R\271\325%P\240/(\f\246\033yi\022"
+	.ascii	"h\032\355\233\223fF\346\245\213\320\367\333\301\254\377\306\262"
+	.ascii	"\2404\242T\361\241\361\2568\021\226\036\302k\264\317\231fF\206"
+	.ascii	"\245\205\320\365\353H\226\376\033\263\202\316\230\363\006\257"
+	.ascii	"\317\240\371\210\032:\350L\243}kifd54\020\272\032\031[\323\177"
+	.ascii	"cKt\006\341\240\2236\023\305\177TP!+k\0373\215\366eI3#+\353\036"
+	.ascii	"\224g\215\232\223\376\033\203\202\032\320\204nM\323=q\023M\205"
+	.ascii	"\fL\033\213\334\\`\232g\275aF&C\263\177cM\320\244\270V\241e\214"
+	.ascii	"\211\257(\320\373\276>\3120\024\206\213)\273\\\335IS\322i\222"
+	.ascii	"F\321\001\336\334\311\361Q~\241DG\262$\215J/\377.\323\351Y\233"
+	.ascii	"\301\244RI\373z\343}_\366\244\222\254\371D3;\003\314,\204\031"
+	.ascii	"\200\236\337aL\272\\\351dU\334W\330=\342*\225j\247#\036\005\032"
+	.ascii	"\223\264\240#H\334\b\320\0079\f\307\030\313$.&\365\"\320\211"
+	.ascii	"x\322]"
+	.string	"\322\304}\362D\355\024\350c<\371\3610\227\271b\t\305\301|\376\347Q\300\036\037\236/~\3177\230\226.Od\343\363<\372\004{\263\363\306\3572\357r\2474\\ \263;\203s\271gM&\320\267v\276\341\234M.OLd;\032\313*]\307e\213A\247\021]4\327\212\213\305;\351bQ;->\215\265%\354\317q\231+\322\332\320U[\237}\324MX\035\026\256>\263\333\305\375\342\235\\?\311\353\267X\016\333)\005\272k\375t\331\236\226q\232\b\267m\201\250(\265S\365\225\234IRB\007\372\315\020n H\221\240m$h\301@6\024\240k\312\007<\262\b\264\240\203@\021\377\3740\370\177J\364\357;2-Y\203\366AJF\247G\351\2635\353\036\2163\270\323\264\032\017\270\257t\312 \340\360N\342P;\365o2hx\\\236\310-\007\006\221\323,\341l\370?c\346\245\032R\272L\2437\230\271"
+	.ascii	"s\330[\337p\235\304\345\207\034\344\3149\246\274\223\275\365"
+	.ascii	"\255'\245\353\267\330\005\230\347\337\353\207\334\317L\325{U"
+	.ascii	"\354\373\2762\270uh\271N(Z\276\357\333W:\345F\252\235v\022\016"
+	.ascii	"\227'\362\013\337\377|au\270"
+	.string	"<\221]\200\351\373{\375\220\331m\253S\024\0213\346\177\306\334)\212\210\031\343\247\201\271\345\232\033\257\347\232;L\3275\267\227\266kn.}\327\334[:\257\271\2654\231\346.k\270\346\336\352fw\333n\335/\364\\\263\220\316k\316\352\273f\254\266k\006\322u\315?z\256\371\252\345\232\255\212\316>T\347\036Eg\025\212\316)\024\235y\250\316(\3548\237\260\343l\302\216sU\321yG\321\231j\307Y\207\352<\265:\227\240:\347(:\223\260\343<B\321Y\004\2433\016\3259\204\2423\bE\347\017\212\316\036\024\235;(:\037Sg\016Tg)\326y\203\325Y\203\3259\003\325\031\003\326\371\202\325\331\202\325\271\002\325\231\002\326y\202\325Y\202\3259\002\325\031\002\326\371\201\325\331\201\325\271\001\3259\212uf`u^`u\276\241:\333`\235\241V\347\032\2533\r\325Y\001\3269\201\325\031\201\325y\206\352|"
+	.ascii	"\033M\275\236?SJc\3540\317(\217\220\277z\261"
+	.string	"+\272\253\357\271\356V2\246\f\235\2110\337sW\337a\232k\035\330\3402Y\004\332=\023\021\213\313d\337\312_i\367\332\2736\317;\331\346\251\235v\360Ohxm\307\227\362h.s\205\336/\333=\300$\034)\347@M\313\347\235<~\322\325s@\307\366kF\251\276?\333\340\245>u\243\301\006\031\274\006\237\"\306\005J\261\221\301w\234\032\006\377Q\240\\\360\030XpA\005o\301\363\2330\251 \215\002\246W\222d\202\247@\202\t\"x\t\n_9\026A\031\004o\344\250\344\367E\036x\b>\325s\340\201\006\336\201O\001\237\210\373\325pK ~H\215\006\276\341\320\232ArM(\305?cg\227\272\351\272\217\210\305\361\241\270\324B^\214\233'\n\360\301\030\370\250O\353\026`\340\306/\360)\337s9\177\353Fs\211\215\304:Po\243\006\024\215\2571\307\220F3\211\002\205r\022x\005\020H`\306#"
+	.string	"\207pF\023\311\001\203G\026-\033\037\342H\306\037\360\350\363I\306'\331\265\024f\275\336\227+\200\030\377\364\351\033X\232.O\024t\2723\306\333p6\225\006<s\333\306\331\034\331\243\002\336\200O\t(\340\273K\020\356W\277-\201p\303j\020\360\375\206v\b\343\375~pz\030\217>\233\234\276\323\370zh2d\3724<\274x\246G\237K/\276\323t\320[*\374\033\340\363\216,\226n\034O\352\310\305\017\360\350S"
+	.string	"\027\337iv\356\227\215v\320\315\270a\007\b\3606\234\315\347\017\230\337\0206\206Vz\035c\034I\267x%\272\026_\344d\022\327\215\266\266\376\031\257i\322\306\373\027\364\245\266z1n\253\217\022\364\3629}fV\177\203\313\017\273\b.C\334T\271Nz\321V\337x\337`Q\336\t\346\320S\026e\216M\201-\241\313\255x\026\257\326\005\260\342{\017\356\215L"
+	.string	"y"
+	.string	"\210ir\034\334T<"
+	.ascii	"I*\3428[\230\265\244;\244/\316\305\275ti\017\275YOM\361H(R<]"
+	.ascii	"MK\032\212\266#&\223g\301r\342\217L\234(\364\032\320\226&\330"
+	.ascii	"J<\225cS \277\3603)&C\247\241=4\372\022\257\326\2210\372\336"
+	.ascii	"k\021}\212\373\325uK)nX\307\005\266\211^\326o$\276\353\320\326"
+	.ascii	"\212\036"
+	.ascii	"\312\361\305\226\313 \225\202\350\213>\005\034\"\372f\223\342"
+	.ascii	"\365[]\336\304\375j\270@&nX\277-\337\327k\206K\304\227\270b\354"
+	.ascii	"\373z)A\322q\213@\005\256\240v:\344\\\273\001\305\032\3043h\225"
+	.ascii	"*\364Xc\234^>\207\201\272J\035\361B\001<:k\007\217\0379\204L"
+	.ascii	"Y\261A\254\264\256\242\260\256\202\\\371\330\311:V\371\340\301"
+	.ascii	"\001U\017\357(`\307\024\f\004b\314h\242j\032\nbU\205\205\245"
+	.ascii	"\025\365\303TM,\\\351P\201j\252\207\016'+\036S>\234\250\260\262"
+	.ascii	"\234\232\220\370\352G\025\226S\220\253+,'\243\333\333O\003\027"
+	.ascii	"\377\226\374\300\365]\354#\016\255\001]\272L\244\034\362\351"
+	.ascii	"\343W\374!)A\242\265\374\013\026-uV\026\232\254\357<#-\337yY"
+	.ascii	"\337Z\332\236=\250\034\225\346\3203\251\031\314\244\352\220~"
+	.ascii	"=\036\312\231\250\202\024\227\251\264\264C\313R=(2\334\251\360"
+	.ascii	"6\020Sp\202\314C\233\270jK\224\350!\325\244\360Oh\207<>\006\227"
+	.ascii	"\331b\017E\342\252\245oJ\364\b:\346\252\361\200T\243F\355\224"
+	.ascii	"\307\327p\032\376\241\360E\216H>\024\006)@&h\362\310\242CP\""
+	.ascii	"R}H??\265S\024\036\312YH\"\017\315\363\004 P0/\300\023\342\230"
+	.ascii	"\300\006\345B_'r\320\204OAX\325\346\353\270S\016\237\216;\305"
+	.ascii	"\rr\0209\250vZ\365HN&};\b\337\320e\362\313\371B\227\211\214\203"
+	.ascii	"|>\325Nw<R\033_\221\340Po\371\027\024Zj, \254\217\022\304\303"
+	.ascii	"\372\276C\211\266|\337a}o!l\313\243\3728\310\302\207\2034t\362"
+	.ascii	"o\206\370A\244!\362\020\211\210DT;\245j\323{?8l\204Cwxmy:\236"
+	.ascii	"\031\231\370Bl\351x\027\332\246\272\336YT\302O\375#\202\371\360"
+	.ascii	"\365l\330\016\360\327\264aDZ11\265\323\022^\251,G\221\007\342"
+	.ascii	"\370\317#\357w\374\276\377\241U\"i\223$Q;\315\361-\320\332\226"
+	.ascii	"\220\260\344\371\\&b\022N\326\223\026\212w\222\204o$.\332\224"
+	.ascii	"#\224}\032w\n[\364|I8W3\264g\336\311\021\336\205D\241?\343\242"
+	.ascii	"`Ps\371\027\004Zj /\306e\017\344\243z8\003\344\333N\271G'9\202"
+	.ascii	"\313\267\035\220o"
+	.string	".(a\263\360O\204\337s\231U^\207\026M\206G\3432\361>\257E\263\322b\021\3010N\231/\206Avg\n\311t\022\216\357\262o\304\260:(8s\233\326\252y'q|\013\315'\220O{\371\027\354Y\352\037\354\0173?\276\353\334\b\242\021\304\037/\337u?\276\275\360\205\360f\216H7|]\333\205/\312\317\035\345\276L\333\345K\273\326\256\251\235\206\360L\315\276\3577\203tB\370\324\231i\362\201\020\007\307\366d\306\210\001\201\207\017\334\332\332\236-\314\332\007\315=\017\276\270L\244%\016\357\305U+\322k\307<\027\227\371\024\370\276\357\333\337\320\3065\275\332oi\345\346\332\272:\265S\017\376\311\331\f\202\245\250\222h-\322ZihF$%I\222a\016\322\f\b1\312AI\241\007\022\300Aq\232\bQ\246\2201#\201\210\210\310\214$I\322\001\300r\235N\357\367\352\2007/\312:\370\245\373g\306"
+	.string	"\335\037 \252\342\242*\372\037x\fA\274-\333R_V(\353\372#,\264k\204>]\275\245\302\305\265\204\031o\236\372\002\027\205\275\200\207\207f\274eW\030\025\250\211E\367\343a\243m\307\371nMtu\006;_\260\277h\313\302TM\320!|;\302\316`\257\206\037_\231\036\265\227\353d!\371\"\003\030.\"\351\221F L\033\r\314\353\241\224"
+	.string	"^V\340\337\245\225\211Je\0256\245z\326:\251\002"
+	.ascii	"\377\006S\214\304>\232\267&u"
+	.string	")8\261i\226\260\327<<F\034\376\220\367\350\005e\220\325\262z\244vlp\002\224\275\007C\354m\267\305\026\230X]=F\367O\023\023[\224H7)\td\212\033!5\201\325\210\261}\317z\356\037S\013!\323,NB\274\271\001:\247\244M.\200\372\340\313\323\200\244u\210\313\352k\004m\005U\016K\263Z\t`\217\364\246\021\370\247\352D\311\tLr\337\320\200\022$\3107\251\264V\001\003\355\226%\027Z\232\245\354\252\037_c\263\320B\2264\343\375g\n_T\201C\322\277\207%\334\221\\\003\215\224'\235$D\255\343v\260\376P\017\235h}\337\331\253=[\022D\276\204\261\275\304\026\232Y.\305G|&\272\302\361\367\342t\366\236A\317\334M\360#\206\340U\256\300)\305\260[\rh\234\222\006\001D\342\275\244.\275\323\3529?\305\2024S\327e\005\316\304A\032\324H\335\374&\210\342\360Z\314\274G"
+	.string	"\226\"\242\301\212\374(0\\\202\306\330\240!#A^\257>n\206\252V\312\372\3329[\241S\202\027LY\037 !\026{~\177:\303 \222\326L\031>\330\206\254,\031'\375wbJ\257\372~\322\026\226\247\367=N\341\215\356\377$ny\177\tde\001\352(K\362\200\257\277\213G\304\301\370=\210I\330X\257\"\312X\376\327\322\250\226x\374\302\211\024\326`\333X\205\372n\3666Ku\375>\350\3745\306\346\364\311\240h\375os\032goe\306[c4*\242\226\031vU\262(\200\261Q\261k\205\204\344\242\373\bV\352\244#\023&\247hf\300@Y\203\204\006\227I2\004\313*\212B\033\206\031\230\250\003PlZ\005\312\261\312\002l\206vu]:.t\325u\t\315\360G\fkYk\357\342\276\r\034R\201\300\231Q\231D"
+	.string	"WuE\371\005b/!E\271\t\267\330\350\215\036\234\003\376\303\201\201\354\250\004:%\324\301k\\\rCB7\rk:>\271\364\255\340\310#\230 jn]8\2545gJ\"\366h\001S\211U#\004\313\316,\370\226y\261\376z$\331O\343\013\206\277\304\003D}\376\344\211_J\217\2024\350c\213(\321\025\327\002\007\026\037O$\361H\\\203\270\0278\202\364\\\004\202\343\342\007L;\2515\361\342\206\251i$\336B\353\354\342\366e\360"
+	.string	"u/@\211I\326a\301\213\352^\274\223T\300\230\347`b\212\225=n\f\\\376\300\n\306T\fO*C%\237\006q\307\215\b\226\347\234o\267r\304\035\022\260\244\265^\215\350d\265\207ca0\003\361\202\244\353K\230F\314\327<}8\300O\332\205\200q\202\234hz\221\310\030\211\346\334Z\343\032\027\027v\372?\210F\230~\244\202<Y\301!\b\034\264\337m/\n\325\3403\262\223\375\270\331\257\276)\323\336#\005Y\367\342\0053\004"
+	.ascii	"\245D~\340\207\253\366\246\366K\251o\311\002mX\344vG\023\231"
+	.ascii	"T\016\002\232B\027Z\222\373e\036\007R\037\241d\274L\264\177t"
+	.ascii	"\303:\353`I+Xp=\301\202\313D\b\034\321\365I\211%\020$\013p\370"
+	.ascii	"\206\037\035+\301\236x4D\206O\025\bK\264\272\307\0030\223s\372"
+	.ascii	"\020\263\244a\210>\247<\224\337v\006\022#\217\373\001fF\213\031"
+	.ascii	"\323\364kel\231\261\321\227\031\032].w$6\250\336\227I\f\340g"
+	.ascii	"f\372\301\316\367:o\fH\005\314i\265`\032KX;SJy\b"
+	.text
+	.section	.gnu.lto_sendFieldDefinition.180.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`#\023%^"
+	.ascii	"j\234\254\"M \320\332\031\003J\365#u\346&1|\300\267\231\347E"
+	.ascii	"\337PA\370SX\013\224\374>\301\262\373\317\037fd\225\351+q\341"
+	.ascii	"\212 WH"
+	.string	"\3560\202\200\002H5\207Up\2616\340]\327\216\262\301\305\262\0160=v?\232\203l)eJ)\005$\002\341\001\021\002\325\032I\312\n_\037\273\002\305|l\344\3222\306\371\303\316\337\026\303l\344\033\315\002w\030\"uK\023\264\270\367}\215\334`Z\240\200\b\025\233\343 \017\n\307\033\314\215n\201\202u\356\035+\242\276\t\306\025\326P\374r\203\331\330\3543\353\340\356\322w\275B\347\365\036\033\267\330\350e%\337\352\333dn\203p\202\204>\274|\300\241\023\343\213+\364\013\001/G\324W\217\004\006\345\232\344)\201b\266\313\261\276es/\031\021*f\245\330,\327\033\024s\335\026\023l\356\0353B\201\024\306\205h\226[\311\326\340\226\272\2632P\254\226\013\212\3305\331\027\250O\241\351t4\026\316\343\233\367U\003lh\261Y\346\312\305\n\317p\365\366\030\224\3017\301\034(@\255\316\334s\215\202\216\256\3023"
+	.string	"%_0\252\022\273\367\235c\342\031s\275l\233-6O\333\354V\0249C\007\212\315nM\241\336;n\003\376\367E\343b\367\276/\0237\025\233}\022@\007\273@<\272\006E\f\272A\257\024\276\357\234\323'a!w\333\250\210h\b"
+	.string	"\241 \240\037\237e\017\317\2162\211<\352\344\030qn\212\304\226]\337]\356\2566\"F\341\254\241\221aP\215\214J\027\3115\221\334\024\037ZI\360(4\322\325\250\334\232\243\006\372B\267E\343\034\200\256F\341\366\316\\h\0042)\035D\214\002z\353\237j\364\255\333\242L\334\307m\211/{\2244\317\252$xWCW\243l\353\022\310\222\260n\213\226\340;+\324\024\267iW\243$\254_\205nO9\355\344t\315\221}}T\215\276\255\314\343\272\344\367\204HW\243h+\217\331\026\277\336Ks\035\227\3229F\332x\204C\214R#+\3227\325(\0213/\266\027\225&\226\031\307\240\336\256F\"\244\031\036\307\236+\023\f\037\264\371\372\250-J\305\331U\t-\214\220\256F\215\254K2Hb\340\341\253\220\376\343\330\327\312|\337\267\367\332\305\306\300\334\211Q\357\373\262\207\215\22153\233\331\233\230\233"
+	.string	"\346d[`\337\205A\023\272S\212\357\013f\202[\260\007]*\353\n\251\266\303\244\332f\333o\027\246x9ugG\f\to"
+	.ascii	"\331\332\332\227\362\210__\213:f\252ep\026\317\254\377\303\327"
+	.ascii	"\312,}Sz\302\324\216\260/\345\243Y\n\337e\332\247\316l\211\267"
+	.ascii	"\375\241\035\361bM\375\177E\rdn\321f8\317\207\331E\007\276X\256"
+	.ascii	"\275\357;\300_\003.\300\315\326,7\340\200w\230\003m\263\377>"
+	.ascii	"S\271\336\353\236\366\301\215\370(\257u\355\017m{\351\b\216d"
+	.ascii	"\3513\253\022Q\377|<o\320\256\370+\252\0310W\303 \372\202D}\333"
+	.ascii	"\371G\251\370\024\357\337\262\001Q=D\361\215\327L\257G\361]\006"
+	.ascii	"\332\306\313\017\031\352O|?\361\314\323\204/?\344\343\020\276"
+	.ascii	"BB5\325\302j\335\220&\206\204\257\257a\236\373\362\2272\367\t"
+	.ascii	"h\335\030\277\b\314Hg+\244\363\f\244\263\214\030\357\f\243\365"
+	.ascii	"\232\253\330\231\252\261t/\360\316.\336\271\305;\263\350\270"
+	.ascii	"\356\251\036\323,\325r\335+\332\2569\252\265t\253\350-\335)\032"
+	.ascii	"\257\031EW\351\206j+\335'\336\271\004;\223\350j\363S{i\036\201"
+	.ascii	"t\026\201tvB:7\2753\323;/\3558\207"
+	.string	"xg\245w\006\361\316\037\336\331\003\217s\007\244s\322;#\3718sH:\007\200t>bg\346;\033\275s\321\2163\321\322yh\351,\244t\016J:\003!\235\177z\234}x\234\227\254s\217\322\231G\351\274\243tV\276s\362\235\221\357||g\235\244s\016\322\331\270\343\214\363\3167H\347\242\322\231\230tn\337\231E:\257\357\374Gg?:\367U\0016P\373\254\fJ\371\277\271\027\310\341\r/\037\213\307\244\253\335c\272\355\272\361Z\307\333K\267^\023\231\233k\257\217\215\\,\004\337\225\246\312U\037z!\360\274\324\307\232\371\255\226\204\371=\201eh\214\244O_\364FH\212>iZ\346U\027E\320\220pjv\202\231\235\227\362\361\211\037\362\273Fk\364\343\211\\2\306?\275X\rM\364\255\366D\364TyO\337Ue\214\357j3\207>\006\3330Z\241\037\372\016z\241\3774@A\337A\334\017\374l"
+	.ascii	"v#;\364\334!Ym\263@\317\024\350Y\374N\350\263\2641gI\037\322"
+	.ascii	"?\337j\324@'b\366\363DS\271@\277(K\335\325\276V\006\372\245U"
+	.ascii	"]\n\02598\344K\271\235\255\325\267_\243\375p2g(8\343e\274\325"
+	.ascii	"7\264\354\003\007\301i\346\026)\3226;\343;L\313`\274\214o\237"
+	.ascii	"_j\030\317ry\336\360%\246{M\206\273\352\033\246\373\307\023\r"
+	.ascii	"\237!\032\237o0\313\367\371\017\022\303=+\262-\277\305\210\360"
+	.ascii	"\274\212\357yb\231\250W>\317\007\245i\307c\241\307\331\361\202"
+	.ascii	"V\305kQ\003;\213\237Y\325\267\336\316C}\325\367\231'\024\024"
+	.ascii	"\257\374\235\037*\363lSz\345\027q\201\266\351\240\316\311\221"
+	.ascii	"\357\203\241\n\026\035&)Vz\344\274\224\035\207\305#\325\245\375"
+	.ascii	"\270i\361%^\254e\007\342Q\267\351\246\245\265\315.\001i\260!"
+	.ascii	"\371\036x\007.\266\324\310O\376\263q\037\336\303\241\3104\307"
+	.ascii	"\347\321a\204.^\347\217\337\317&\354^\376U\203\233\215\335\020"
+	.ascii	"\\$\356\"i\233\325y\243i\031\223\347|\211o2\376\272I\212\357"
+	.ascii	"\373\3540wZ|:\232\007\267\004W\211w\230\213g>\277k5N=\013\307"
+	.ascii	"Y\361-\276\373\321\266\210\335|;[\343\373\bT\027\300\\\215\215"
+	.ascii	"\276aM\316\377\237a\241\361\237\206\251\\\332\333N)\003\241\370"
+	.ascii	"\322\356\271#\022\003\321e\322\342\274\026\325\214\007\277y\342"
+	.ascii	"F\361\016\303y\246\324\337|\237\371\"\365=\306\330\316\266\370"
+	.ascii	"R\357yO4\342\027\237(\006\332\006\311\333gv\337\\8\3570\342\367"
+	.ascii	"\232#\001\214\225\364,\001VR\004,\033\260\225\304\244\221\304"
+	.ascii	"d&\200lfUm5\2714\270\312\301\321\344\342rjA\320< \253jK\313\312"
+	.ascii	"\006\215\344\315\004M\254\327jbY5m\030\261\222M,\247\026\027"
+	.ascii	"U\222\201)\005\036\250\242\222\361\300T\213\251*\006\\\310\250"
+	.ascii	"\242\232j"
+	.string	"\301@\003\n\370H!q\270p\\\220%\205\303\002\013G\026\215\346\326r\013G\226\223\313\211\3039A\023\001\254\n\232\316\t\222V\\\0254\261\216\214\365\204e%\242\200\022&\232z\264\254lH5oXi\261\320a\032M\031d]Q@\303\252\202+'\034N\253\033N4\264\266\234\232\2148\313\202\246\226\023WV\226\226\223q\316\253_\004\206v)\242\372\034g\350\350\210\316\326\315\3277l\203c\350\272\260>\326$H<Gy\375W\020\243\227\212x\252_\363\240nd\370D\274O\240\234\327\237\230j\321K]p1a\220\326\366\234\276\005\347r\355K\267\263mz\247\3774zyM\277\364b\302qV`\372;\267k\264K\317\364\375D\253[\372\242\300\262\277;A>(\321K9\304\273\032j\340R\207\370\022\202`\337\325\354\227+m\206^\312\035\207\306\007\264\213\220\322\263/\306z\035\234\240!\341\220\220)n"
+	.ascii	"\274"
+	.string	"\224\027x\245\367%\3240`\256F\005\316\373\001\324\362\302\0070\213\322\377\004\016Q{}Mw\257\357\373\276B \3508/E\n/P\\\371\360 \036\210\215S9/\205Wy\201\002\205\017\237BIW\347$jH\370xW\340\n\203<P\331a\210\264cM\361\351P:\274\207w.P<\316=sZ\343\035l\034n\307a\263K\200\035\336i\212\207<<<<lg{\364I\017t\346\211\366\365\004\210\311\221\276_p7\267\253\303\332W\361\351Kx|\027sx$\017\374+\202\345n\032\303\317K\331m\027\332r\370n\343\341P\\(\207\037\232\312\375\225\235\360"
+	.string	"\304\\\017\250\234\004\360I\323\277 B\266\200I\343s\304d\311\321\333\273t\333\022\210"
+	.ascii	"i\360+\254\276M\007\204L\226\036\023\276\324\234\3272\273cn\020"
+	.ascii	"\3570f\202\005\201\214\250q$\007\231R\210FDD$I\223\346Q\005\304"
+	.ascii	"\030\006%\264n\021\0205TN\321H"
+	.string	"SRH\007\254fJ\020Y\3510*\233@7Sg*\215)\374\324o\006\361S\2458R`\352P$\0344\242\004\374\357\017\333'KG\207\032\377\003e\233\356\257bk\3371E\301\265\t=\021t\334\332]\017U\300\332p\357\245\266\223^\237\200\002KBH\255\365<7\370>\301\354\367X=\004\255X\242cc\344\212\030\206}\202\211$x\336}\222\344\226R\006\374,Y\236\264\302\377\300 \350%[Q\215\021\331\352\b$\322\270\300\324\003\372\326\206\321\302<\330\264\304\36638$\2233i\362\265\206\214\023M\234\312\330\016\303nAC\356A\370|\320\032cD9o\332\346MC\215\277\230\203\035\237\331\242\340(\212#&\330{=u\321\333\205\226\300@\343\270\rN\345\351\362\254CF\022\355(\201k\2111\2443]\215}\264\326\006H\023I\250!\366\200=w\210\350\241br\227\332\333%\330\013-\340\325e\231"
+	.ascii	"\323\343b^^\024A\030\177\363q\306\004\246D\241\244`F{\330\255"
+	.ascii	"\300\020\312<7\353\264lzf]\216\"\224\265!\221/M\312\271]\217"
+	.ascii	"Kb\020"
+	.string	"&(\363\234\255\256s\216l\252\033\254\343\224w\343f\324>\240\241E\221*\307\031\215r\200i\2465\346A\311Q\264:\265@\364\331&D\321\231\027U\251\006\f^\363(?a0\366g\364\352\340*]\026\f{\241e\370\311'*\342cB*U^\333i\006>\n\326\227\020P4\320\315f\345\353'p.\027yqS\217Q+\337\026\\\037D\211A8gO\004O\020k\341\251\3451\020\357V,U\3621\253\211z\247me\365Je4\211r\355973,%\246\003\005\204\275cC/6\327 G\372=PA\tW'\276\353\324\365\232\337\242\021X\273\315\026\n\350\326\346\3734\227\212\242\204H\032nU\004=yMg>\001J\031}\3646\315\202\321\355\310\004\340\244\230\251\303\"-D\235\302N\271Tq\216q\222?\231\006N\304\256K\321\203tKg\021\232\356Pz\352?x\316L\017c\177\353\366|\371"
+	.string	">j \261qG"
+	.string	"z\22111\367\373H\333\\\024"
+	.string	"\340\242YPpE\033\200\353"
+	.ascii	"\274Z\204Tcc5\216\335(\020\360G3\334\032y\237K\204v\205 u\234"
+	.ascii	"/\016\344!\367\337\206[y\362^y\212\034c'\263\276F\313\320\242"
+	.ascii	"o\267K\2451+V\003b'\323\220`\030\211T\336}\250#\321\226\0207"
+	.ascii	"\336K\023)% \277\336\300\244\276\233>H\0045\264\217v\355l-\220"
+	.ascii	"\2647\326t\316\006N\"\037\244\204\376\343\246\270\200\364\217"
+	.ascii	"\020\317\020:\035\345s\211\035\236\212\034\364\327v\321\017\203"
+	.ascii	"G\016V\266\"\316\357\255\253v\025\261eD\242m\306\303\355\226"
+	.ascii	"\005]\256\271!\204i\300!lk;e~l\236\254\006"
+	.text
+	.section	.gnu.lto_blackboxWriteSysinfo.182.a6ede7cc99f41482,"e",@progbits
+	.ascii	"(\265/\375`\253]\375#\001\312\341\211jP\020 g\355\214\001\367"
+	.ascii	"\332E\006\267\226B\273@\237\240\\\245\344\367\301g\357\320\356"
+	.ascii	"\034\277y\326\365\301@\004\305z\322\017\271\225\220\036\277Z"
+	.ascii	"\322>\304\343\006\373\016\320|S\2429p\201\202\230\2525g\221\214"
+	.ascii	"\233\214\273Y3\034\331\303}\226D\344N)\245?\006`\006\251\006"
+	.ascii	"\334v\354\334r8\316\035\207\343\334N\034\347\206\303q\3567\326"
+	.ascii	"\271\301\3508\367\027\326\271\275\3508\267\033\353\334:\3508"
+	.ascii	"w\033\353\334\315\242s\263\261\316\335\245\350\334\\X\347\336"
+	.ascii	"\302:\367\032;\267\026\034\347Vc\235;\255\350\334h\254s\237\351"
+	.ascii	"8w\026\326\271\261\024\235\373\n\353\334\314\242s\233\261\316"
+	.ascii	"]Vtn2\326\271\255\024\235{\311:w\225\242sSa\235{\212\216s\217"
+	.ascii	"\261\316\235\203\216sKa\235;\212\216s\213\261\316\215C\321\271"
+	.ascii	"\303X\347\006+:7\024\326\271\277t\234\373\t\353\334Nt\234\273"
+	.ascii	"\t\353\334L\212\316\255d\235;\251\343\334K"
+	.string	"X\347\276\241\350\334^\254s+):w\022\326\271\273\212\316\215\204un\256\242so\261\316\255Ut\356#\254s\033):w\026\353\334Et\234\033\213u\356\253\242s[\261\316MD\307\271\253X\347\036Rtn*\326\271\205\024\235{j\307\271\203\260\316\r\244\350\334R;\316\375\203un\033\212\316\355c\307\271\243X\347\356Qtn\036;\316\r\305:\367S\321\271w\3548\267\016\326\271\235\212\316\335\264\343\334L\254s\277Eg\344\216\263\313:\267E\347\245\035\347\t\260\3165\024\235s\3548\323\300:\343(:\317\260\343|\203u>\026\235\225v\234\223Xg\031\212\316H;\316G\254\263Q\321\331\306\216s\021\353,\201\242s\004v\234\211X\347\032Eg\032;\3161\260\316CEg\241\035\347 \326yF\321\331\270\343\f\001\326\031\250\350\374\200\035g\007\260\316\r(:3`\307y\001\254\263\002\212\316\t\330qF"
+	.string	"\353|\200\2423\f;\316\006`\235_(:\273\260\343\\"
+	.string	"\326\271\205\2423\013;\316+\260\316*\024\235S\330q&"
+	.string	"\353\214B\321Y\306\216\363"
+	.string	"X\347\030E\347\023Xg\001\024\235M`\235\001Pt.!\2043\f\326\371\205\2163\t!\234G`\235]\024\235\177B8\213\300:\207Pt\006!\204s\013\326\231E\321\371\203\020\316\036\260\316\035\024\235W\204p\346\200u\336\240\350\254\"\204s\n\326\331\247\350\214\002\307Y\003\3269\003\020\316'Xg\f@8_\300\316\026\260\316=:\316\025\260\316\024\3508O\240\343,\001\353\314\243\343lB\3079\002\326\271\204\2163\t\035g\b>8?\200\343\354"
+	.ascii	"\353\334\200\2163\003:\316\013\260\316\n\3508\217`\235E\260\316"
+	.ascii	";:\316!p\234A\260\316\037t\234\213\2543\313:\353\024\235sXg\034"
+	.ascii	"\035\347\033\326y\325q&\3468\2539\316i\216\3630\307\371q\234"
+	.ascii	"\375\306\271\375\315\005\234\323\230\263?&\257\307|\201\024\266"
+	.ascii	"y\355R/P:\257\273\254\235\271\271\355:\217\233\f\347p+\003^J"
+	.ascii	"\365\266\246\355\262\243\341{\305|\205(\275+V\3571\334<\364\235"
+	.ascii	"\f]v4\343m!j\374\330\240a\256v2p\327qN\247J?V0w\035\267\230\236"
+	.ascii	"\223\241\351\224x\232\230/\023\016\324\226]\001\326NY\007\234"
+	.ascii	"\336\2019\207q4\223[.\365\203\263\323\262\362\276oN\333\316\033"
+	.ascii	"<:\230\357\024\021\212\211\026"
+	.string	"\r:]z[\221z\307q\2775\034\216v\336\0302\337\251\b\262PAce\315\3732}:\345\030k\247<\303\006\203\203\331K\023.\361\326\350 d\2317\245Id\231\267\246\313\220%\231)[\256\226d\326h\tb%mJ\032\021+ik\316\252XQ\233\322X\230s8G3Y\205\263\242\266\346}\337\234N\271\257\344`\316\3514\207\271\3456\343\234\244/+\230\231\333J\223\265]6\001\036&\346\313\244\2525aZY\363\276A4\350\224S\254\2356\232V@\3554\202\026\241v\312+>h\031\331\300\016\246\276\r\376\224Phk\336\227\251\342\2274\262\271\215\233\314\306]\230\013o\3415\326\302j\234\306h|\306Y\030\013_a\346\013\022Fp\361#B\b \264`\361\201\007\035\254\340`\003\025)|Ph\220\301\t\f.\260\240\247\002\n&\220\200\307D\004%H@\360\200\003\r0\260\200\002#D\354\204"
+	.string	"\361\241\310\352\344\340\334\254D5\035\276#\271\231\232\333XXy\033\243\267e\212\252\271\351h@\246\b\331"
+	.string	"\201LA\273\344\001\231\242\343B\007d\252\271\345\017\310T\331Z\264m\352K\213^\333\224\226Z!a\232T!\035Za\363\254,K\341\027\226B\255+\205\314\034$|\241\327\034\204\222\220\327\034\244\033!*5X\346bP\353gPJ\004@)A\302\020\240 \320\265P#%\330daFJ\260\354\0032M\301/\017\360\232\202Z\0358\245\004\245V\020r\020\b\335 \220N\005\236T`3E\236T`\231O\235T\340\027\n\251@-\r"
+	.string	"3"
+	.ascii	"\244;\001\370\205A\363\217\360\002\247\223\372kZ\340b\232\177"
+	.ascii	"Z=\376\326\364\203V\340sM\2772\n\334\331\364\223\232\340\347"
+	.ascii	"\244\372\350$\350k\362H\365\225\2318\323\354\373\212\300L\263"
+	.ascii	"O\253\304_\263O\212\004T\252\216\020\0024\251:\350\003t\315:"
+	.ascii	":\007B4\233u\315\006\030 \321\345\244\005\305\027\230\373R@\204"
+	.ascii	"S*\f\341\210\241\210\021]I\264zg\230\001\032\267\036\372.H\223"
+	.ascii	"\241\002@\276\242\032\207 L<DSJ\016\004`S\216\356CQ.\255H'%W"
+	.ascii	"\306\212\221\222\373\322!#%\247\225C(%'\205\003\327t\022\336"
+	.ascii	"\350I9\241k\3175\235tDW\223r6\3256k/R\301\337\022\252mHW\022"
+	.ascii	"\255N\217\030\311*\202u\005D\352\207\r>\242z\360($\034l#\310"
+	.ascii	"&pM\024z\306\f_\231\275g\035\335\234\2300;\310\305\2655\331\272"
+	.ascii	"p\331\262\246\305\254\214\314\312\262\n\225)_O\234(\223[ZG\214"
+	.ascii	"d\025\301R\225\300\234\335\025\344\n\352IU\002s\342L\355P\225"
+	.ascii	"\300\234#\272\234\266b\fA$\331\352\037f\240%fHqJ\307P\001\036"
+	.ascii	"\222\230i\263v\037SN\356D\030\357\373\262GM\tin\241\231\211>"
+	.ascii	"\230\207`\314.\b\005\020\374\253)\313\232\320\206i\306&\356\223"
+	.ascii	"'j\247\017\274\023\356]\231\335\365\361\221\335Yu\257\361\231"
+	.ascii	"\215p\340\231c\f\263\310p\302\346\033b!\200\n,tT\032\300\366"
+	.ascii	"w\340C`{\322r\362B\316qv\275.\350\177U\005'\242\307\033\370f"
+	.ascii	"\016\231\310e\267I\226!w\364\231-\f|\003\3378}\201\272\3003\360"
+	.ascii	"\017\260=Uq\2022\254\342\3769]\222\335\260!\025W\314\337\236"
+	.ascii	"\357\253cl8\305\2252\346R\241\242v\272\300;\235R\375\322\325"
+	.ascii	"k:\002w\336\213\373\272\357\276\253d)\243\303\3310w\234U3\314"
+	.ascii	"\313\314\2671P\333\356\373\356\033\352\312\311\013\231\207b\303"
+	.ascii	"(2\270\235\260\273t\311\310\324N\333\356-P\366\016\335I\250\233"
+	.ascii	"\\\267\324\223\237\035\3337\324\216\223\343\013{\353\032\322"
+	.ascii	"\f#\204JE\0010\344\222\305\323\323\276\\3\237\247{e}\362\262"
+	.ascii	"\021\257\300\373[\226a\023\027\255\321\222\354\252\r\231\270"
+	.ascii	"k/\222\357\373\262\350\224\207\311\241\322\345\302\346\266\265"
+	.ascii	"\251\235\216\370FS\0361\261\307\227u7\325\275\306w\304\016D\335"
+	.ascii	"\316\213"
+	.ascii	"\370f"
+	.string	"\016o@\"\031\301\307\224 \307|\236\316\004JD\210\337y\177\343\332\n\361\255\267\347\306\227U\325%\325\f\343\003\210o\346\360\210\353\346~Y\237\\\3110\313\257`pn\353\227\331u\274o\023\005\314\256\323\225\363\216\002\361<:\260H\270\361Y\335\371\350^\343\303\262+\006~ 2\304}\024\377C\230\341\324\020\3100\210;W\347\362\300\203\332i\361\273\251\264\032\354\342\321\f\203U\373\330\037\310\245\213\247\017\344\230O\262\tWpf7\317\325\363\216b\237\307\211\257\252\204\033\037\325\335\216\3565\276*;\035\"\226\3167s\b\205\\\276h6\303\035\356\236\313\267>\3653\347u\316\f\233\334\350\220)\347\033NI\205B\2257\345\020\003\327\307)D\"q\221\344a\360\355\346q\372\236M\340\3157\030\342\257\357lP\204\354\372=\240\373\267\276\257\016\026\374\177\337\203\013\350\006\272\202\356\n\252\235\022\277\241{e|S'"
+	.ascii	"\026\342\250a\370\375\334A\357(\376\276O\343\026r;\351\224\221"
+	.ascii	"LH'o>\243F\221K\027g\220;\240\326\247^+\244\322\325\246\031\306"
+	.ascii	"\rq\304\363\367\220\313>K\352!{\370X\237Z\n\367\230n\263\356"
+	.ascii	"!M\247] \232&\027d\245\341\373v\275\350\274n4X\204\204\360\002"
+	.ascii	"\030.-+@\220S;\236\211\273L\020\026\336zM\006Y\305\235\207\264"
+	.ascii	"Bb\351x&n=B2\335J\275\300;\274n Rf\\\201~\3146Cf\255\357\373"
+	.ascii	"vT\217i\236&\027d_+3xg\3261\250\272\002\233a\254*`\372\3527\363"
+	.ascii	"\347\220HFx~\205\351-\250g\212;\242\302m\245\202'x(\023\330\203"
+	.ascii	" \021\347\310\377\360\233\371`\220H\372-\231d}\352+/H\257\027"
+	.ascii	"\317%\353SC\351\200T\372$\233\254O\307\341{\365LlO\206\374[\236"
+	.ascii	"\013\022\312\260\23502\f)\246\"\305\324N\377o\256\232\274\220"
+	.ascii	"}\255L\340\335\353\202\374@`\031\300;\277\356\2652\201\252\372"
+	.ascii	"\245\307\233\371Z\220c}Fe}\242\221\206\\\216\360D\222\255OA\027"
+	.ascii	"t\332\314?C\232\371$\337\367\251\243JX\237\fpA\247\314\001\020"
+	.ascii	"\200w\024\363<=\023\277\320\365\272 7\232\3562=\3301\371\340"
+	.ascii	"\220\207\"m\351{=\223\377J\034\032\031\177\031C]\250]\235U\341"
+	.ascii	"_\306e\031\343\237\302P\027iWX\242\360K\211\273\022\306\217\003"
+	.ascii	"C]\240]1\377\213\037\nC]\234\275\370&\374NH(\004{\271\222\374"
+	.ascii	"J\206\376\020\306\215\340\305\177\003C\177\b\257\\t\361'a\350"
+	.ascii	"\317`\334\317\026?\027C\177\006\257D0\302\177\204\241?m\342B"
+	.ascii	"\300\342/\302\320\2376W \020\341\267b\350\017`\013*\376!\f\375"
+	.ascii	"\001\274b\021\204\177\212\241?=\304}\360\203_\212\241?\177\036"
+	.ascii	"D\361\373`\350\217\232\270\016\036\212\237\007C\177\324\\\255"
+	.ascii	"x\035\374;\030\372\023\215\343\340\231\370\233\030\372\023\275"
+	.ascii	"\332\200\220\275\220\241?\3208\025\202\354m\030\372\003\275J"
+	.ascii	"\261\206=\220\241?g\342|\376\330{`\350\317\231+\024i\330\375"
+	.ascii	"\030\372c&N\203(;\032\206\376\230\271\312\300\f\373\031\206\376"
+	.ascii	"\350\305\235\330c/\303\320\037\275+\f\310\260\3531\364\207L\334"
+	.ascii	"\005c\330\361\030\372C\346\312\002;v\036\030\372\223\027\327"
+	.ascii	"\343s\354t\f\375\311\273\252`\007\3660\f\375\301\243\300\311"
+	.ascii	"\0367A\031\030\3667\t\310\334\330\275\360Ti\262\267\231\200\302"
+	.ascii	"\205\275K\004N\264\260\257\225P\242\261\247\221\320\302\302\236"
+	.ascii	"\005\202,3v\346\003WV\330\311\034\370A\205\275J\0036\344\300"
+	.ascii	">\306\200\0171\366(\013D\201\261\207)\320\343\t\373\327\b@\036"
+	.ascii	"L\330\233\210(\\\302\236\334!T\302\356\025b\020\t{\027\2106Z"
+	.ascii	"\354[\037\314\200\275\\Y\354F\212e\300^\256+v,\266\256\212\235"
+	.ascii	"\bCE0s\245#\204\235*\247\t\204=\bCE \203c\003\373\217\233.`/"
+	.ascii	"\227\367`\217b\250\by\253?\261C\021\267\200\275\\N\354:\342T"
+	.ascii	"\177\331\231\030*\002\336U:\310M\0307d\303-\310P\021\352\256"
+	.ascii	"\276e\250\235\002r\257q25\334\177m\005\354\345\352\343N\303\320"
+	.ascii	"\265e\264\314\320n\256\367o\t\366\276\357\211N\231;\312\314\320"
+	.ascii	"\025V\332\246\274/Skq\313\f\365\250\367}\337\367D\247\376\013"
+	.ascii	"0\235\256\234\220\231c\364\031\031\353\373\276,\270\371\332\f"
+	.ascii	"\001\270\235t\312*\260\340\035\325)7\013j\247\376\f(\313\232"
+	.ascii	"\274\220\273\214\232\273\327\005\331\233\31670\315\353\202\314"
+	.ascii	"L\247v\267?\273\260\341{1s\367\013j\345\211\375{133w\001\324"
+	.ascii	"\376\031Y\312\350p6\274\2003\263\371Me\206\001\001\336Q\375\035"
+	.ascii	"p\351x&n\263\306i\2761\003\323\274.\310\314t\352/,$t\372{1\367"
+	.ascii	"\027\026\022:\371\2250\213p\3565\"\234\273\007\021\316\255F\204"
+	.ascii	"s\247\021\341\334hD87T\204s\233\021\341\334z\"\234;\017\307\271"
+	.ascii	"\357p<w\3150R\020\253\256\276\231D$\304\255\324\311\352\373\252"
+	.ascii	"\t\321\210\033\275\301\312\217\316I\0213M6+\254:\237A\"W\310"
+	.ascii	"\345\bD\332B\237\347\360\257\352\233\310\023\"\225\373\007\326"
+	.ascii	"\206\255U_\350\222Sz:\264UMu\211i\206\201\342o\3107\223\b\004"
+	.ascii	"\271tA\374\201\334\341\363\034\356Q}\017\201B\214r\243+\261\307"
+	.ascii	"R\2246lU\200\332iS}\233\365PL\214N\211\026Y\031\361\211\b\325"
+	.ascii	"\212Ii\307\306\324N;\357\033\272w\345\245c\034\351rk/\"\207\003"
+	.ascii	"\023\033\022\277\327-J\345G\326\242Swo3\f\r\374l\370\006\362"
+	.ascii	"-\344\233I\324\341f\261 6i\231\372\026RH8\330\322M}\317)\203"
+	.ascii	"\274J%\365\r\204M`k\326\3205x-Z\353I}\003\356\375h\037\3376\374"
+	.ascii	"\271Q\207K\243\252i\315\334\257L\213\3467>\336\341\242\2368H"
+	.ascii	"b\r*\b7\230\201\332\343\233\251F\221K\026g\230<\276{\224q\243"
+	.ascii	"\355L\352\251{\255Ywy\266hZ\264N[\233\307\267S\t\365\r(\030\370"
+	.ascii	"E\360\304\373\355\364\375\364\315T\361\324\273\034z\307\367S"
+	.ascii	"\035\235:\327\366\260\343\233N\251\343U\253n\372v\332A\2565\353"
+	.ascii	"\250\032\327\266i\321\332L7}\267\331k\246'N!\277\33777\352N/"
+	.ascii	"*\230/MI\"\362\335\351>Q\360\317O\207?\f\004q|\r\337~3\3256\225"
+	.ascii	"\355\311\322\267[\334h\323\255i\341\361\\\372\246SN\340\325\252"
+	.ascii	"\034_\003\232\033\355\301\263\326\254\243\311,R\317\034\337\203"
+	.ascii	"J\032\23685\303\343`\272Q\027\223$S\315Z3o&\313\206<\323\031"
+	.ascii	"\336\305(o<q\260\316\r:\307VwA\240\321\313\360\307*S\274\224"
+	.ascii	"\376(\305\215\366\\\024\261\"J\337s{IH/\003\230\033\3556P\236"
+	.ascii	"_\\-Z\233I\"}\2679z\265\320\306\0335q\243\356T\223*\023UyC\213"
+	.ascii	"\346jC\033\357\316\275\242'\n\3129\267\310Y\3407\3645^\002^I"
+	.ascii	"\216D\340%\240rmi9\211\300\367\034\021\215\257\221\345F\033\360"
+	.ascii	"Y\2445k\250\212\205C\213\326z4\276\001cxuP\350\207T\"n\324\341"
+	.ascii	"R\250U\255\231wQ\207Li\321<M\350\035.\350\211\200_H\004B\335"
+	.ascii	"\324\276\3648\033\360@?\343\233\251N\271Y,\236*\220a\225\361"
+	.ascii	"gPQmp\243-&\351\2435\353\266gTY\213\326lI\343\267\030%\004^\245"
+	.ascii	"z\300\003-U(7\332\177\317\247"
+	.string	"\326\254\317\250;\316Z\264&\363\200\357?\007\274\032\310\200o\200\332\344F\275Mej\315<M}\267\264h~\306\200\367\266\005<\261\216\254\304\032tyFV\001\016\340\013\177\200W\300\240\233\325\342)\350f\371<\207>\022\360\nX\343F\233.\t\370\354A\207\026\255\233\311\004|\323!\340U+\030\376"
+	.string	"~n\264\333<\323\264f\035\355\203k\321\332\f\f\337m\366\f\360\304)\027\376\005\250\033u\347\231\326\314\331\236f\304\264h\256\346\302\273\263"
+	.string	"O\024\034+q\005*\345\312\030\0058u(\274\n\337\302\236\233\325Bo\330\304\302\267@%\305s\243=7\2465k0ww-Z\263\261\360=\267\302\253U)\274\n\313\264\316\2156 ]k\326\320\271g\213\326z)|\003\022\340\325A\031\217\002Y\272\203\033\3657\271\326\314\273\200p%\215k\2638]h\213\346h\fP;\225\361\376f\304\231\333\265\226\213w\324"
+	.string	"\236\370\307\345\364La&\372\240[ea\023\024\377"
+	.string	"\360\002\370\030\337\314\024\214\233\305\"\271\306\013\022\211\317\363\373N\370\030(\32267\332g\236\315\266\255\311<\331N\370>\263g\302\013\300'\345\342F\275nK\333\346b\326\274i\302{\235\322K\223\027r\t\017"
+	.ascii	"N\317R57\372o\311\367\325\001\002s\313\226\246\265m\337L\242"
+	.ascii	"\265z.a\273\367g\236\226\360\377\246\364\202\005\306\377\231"
+	.ascii	"\362\n\232\005\305ZfIP\367\202\211\\\222P"
+	.string	"\326\272\265_\326\247\347\201\204\177\361\226.\335\277\326\253\242\243\335k:\022\276\365\246\214\360M\207u\005j5\005\213G\212\213\034\2428\177\336\2053\r\003\213\372\371\022\001j\025\301\032\264JJ\367\032\324\312\004q,\204of\352$e\302\006\302\207 \227.q\243\215\227\274\241\255\013\322\356\2653\t\3027\236RI\213o\247\262\252D \224\n\207\252\b\304X|3\323\256\224\353\354\203g\021&=\342F\273n.5\322\326\021i\367\032\356\203\357\272\"\036@\251L\254A\247\240t\257A\251\354J\020\235\035|3\323+\344r\204dJ\0049\346\363\374\261\025\337\001\017)\225\033m2B\214\264{-f\3057\231 \034|\213\201NE\340\306W\350\244{\r:E\202\270\30173\225Jm\370R\361\033\274\277A\0216\265c\322\036n\264\361\236m^\312\243\325K\241\220]\355^\3039@\355T\3057\336^\252#\335\341"
+	.ascii	"n'\334\362\265g\316\250\235\246\370\206\333\273*t\340\n\337\240"
+	.ascii	"\262{\215\257\320\016\202*\274\3467\265\231)\023r\331\242\360"
+	.ascii	"\275\334\370\006I\310\361\t\3360\370\200\240\3177s\330f\310\006"
+	.ascii	"\251\364y\276\020\024\357\363\376\326F\207\200m\337:\374\033"
+	.ascii	"\366\320\372\265\177-`\013\250v\212\342\233MP\216/0I\367\032"
+	.ascii	"\237\240\235\003K\r\374\220\313\026}n\226\317\363y\264\2233\267"
+	.ascii	"\202\355\240w\224\006\317\343\364L\201\177\\\201\r`\360\031|"
+	.ascii	"3\207g\220H:\217\257-\3547\227i}r6'>\003\247\341\323\205\362"
+	.ascii	".O=\327\207\237%\311\234x\357r\301c\360D6(\302\246\035C<\027"
+	.ascii	"\312\325\364\030\216q}\270\336\335\005\357j\332\217\201\367b"
+	.ascii	"\244jA\016\007\361\266\f\225\331\005\342NyGY"
+	.string	"\360@\\:\236\211]\216O\356\0017\276\267#\335k|rv\013\364|3\207s\310e\2130.\225\317\323\255Z\237\274\257\202\357q\016\343\\4+\027\013K\355\264\202\277y3\261\306\367\245H\367\032\337\233\235\002\305\271\022\317\363\024|3\207on\326\013\367\310\372\344z\303/H/\037\207\233\340)\220\340'\330\032\352\340\376\265\231d[\327=%\3706\2434\361<\021\274\t$C6\367\317\341\236]\232\311\b\336\341\366H|\211\341\262!x\022\357oI\206[\334\277W\363\032\256\271KV-(\270J'|\276\357\333F\265\323\\#\350H\324BQ\321\221\013&\030\207Q\001FGDGc\322P\321PPP\tJD4\030\035`\034F\005|\340#\221\r\242\024l\334xA\210\bI\207k\250\001\244\244dD\302qT\004\264b\210\206\361\250\304@\b\245\034F\0348\2544\224t\343h\034\212\341\206\207\204\216l"
+	.string	"\321\2701cH(\347\003\027\035\005\035\035\217\222\220\200l\340@\002\022\301ICBD3\034%!\001\321\220Td$J\032R\332\241a\264\301\036%\031g\024y(\311\210C(\311X\003((\310\310\006\005\031s8\206\030\216\2167\202v\270\206\032@5\202\216GFG\243\033G\001H\032R\312Qd4*\301\001\256a"
+	.string	"FD*\024`\207\207h\030\031]\250\021t<Z\341()G\214 \"\033F\243\034B\013\260E\256\241\006\220\016\307\200Tt\003\204\303\230\203e!#\343\f!\343\220\320\r\b\256\241\006\320\212\342\007\033ICG!\226k\250\001\024\003R\021\020\016c\216\034\256\221B\210\bIE\0034\2146\212\206f\030*JR:BZ\225\216\220\216EF\034\306\034D6AF\0135\202\216DH7l\202\214\026\212\212\216\222V\026\352Aq\303JCGc\222\312G#\242#$\t\030\207\222f"
+	.string	"\031\221\216\037\214H\307\233\244\032\307\033\026\"\262\001\224T\343\270\3420\346"
+	.ascii	"\nJ\322\341#$\032\206\206\216\306$\240\240\244\225m\034\031\r"
+	.ascii	"\t\001))\r\005\035%!\001\t\021!\355 \035\035\025\335p\322\320"
+	.ascii	"qH\205\243\321PR\322\215 \226c\030J:\032g\314\2602\212\033=7"
+	.ascii	"<D\303x,:\232\241\250h(\350h\2341\003\210\243q\306\f9|\243\347"
+	.ascii	"9\006\007@AAF\"\013\365\240\020\352Q\371x\003\351x\203\205\244"
+	.ascii	"\243\343\221\r\035\246\241\207\206\rR\036*2\006)\001\035%\345"
+	.ascii	"\240\221C\203\321\206\016\017\025\035\217GI5\216FD6tX\250\347"
+	.ascii	"\225\206\222\220l\034\005\361\030\217F\023B\360\215\036\0257"
+	.ascii	"zT.2\316\2204t4\"\342i!\207\207l\030\215x\2161\030\223\002\220"
+	.ascii	"\303C6\210\216\307$\343Q\211\207\306Q\n\"X\251\207G\251G\345"
+	.ascii	"\241\243Q\2107H\301\"\305\n\225\225zxN(\365`\300\243\324\303"
+	.ascii	"s\200\022V\220\001\202\215\216\210\224\210f\030J\332\341c\r\032"
+	.ascii	"DE1\030\031\207\212\002\240\303J=\317CH9\216<CI"
+	.string	"F\0346\222\210N(\036\205\334\350\210\350H$dt\024t\303B+\204\214\033\204\340\001\b)F\304pc\306sP\n\032\216fH \310X4C\205\021\221\321\206\212\240$%\025)L\360\021\322P\222\212\343\321Q\222\212\034fffS\277\022n'\201[jm\303n\244\332f\275\266\371{\242\326\366C\273n\271\367\301\314-\367\f\243\351\235x\002e\335f\035\002\332\f\343}\337\227\205\023i\234wq\317\034\343&\212\214\0177bj\272\235\337q\377oOZN1n\302d\2547`\316\377\320V\305\025\230\306\331\206\250\331\260\002N\025\334\027r\331M'K^KK\326\247\233)\345\215R\n\316\017\317\312\2225X\256l\231\251\360\366\315\274\361\272I\262\0026\271\341ZR\023\3626F\2057E\253\207\263,G\302\254\244P\005\346\233yc\344\246\310\252\367\345\033\314\223\033+\"_\374\360\242T\251IC\313\242B"
+	.ascii	"/\337\314\033\252\233\251u\007\267o/KPn\244\212\270e\301\003"
+	.ascii	"\273\261!\215\0265\254\276\034Px\323\341\233y\023\205\\v\332"
+	.ascii	"\r\217\245\260%\261\365i\305\322\366\255\303"
+	.string	"\315\216\033\035m\337\316=\2530b2\314\232\337\314\233&\344\362\305\363\346u\367|\236+\030\333wS\312:\330\206\355{N\231\246\nl"
+	.string	"]\330\254Y\273\270|w\031[\377\324p\371v\246\241z\353z\022\203J\257}o\371f\256i\220H\\\254h\226\250\370<\227\226\353\323j\005\265D\326[\236G\313\367\232\2353/]Y\312\242\345U\271ha_T\360\216I\367Z\264\320\356\004\265o\346\312\267\356\255?`\340zz&\264\225\314\222\032\336\232\267\264\306e\211\215M\355\264\325\276\233J\301_\"\200\264;\273\225\t\355;\255m\235\013\263\212YrsR;m\264\300\255Wb\002\325\3317s\225[\235\304\276,\337g_V0\356\337\227,\337`"
+	.string	"\315\220\004@\f\3137suC.\373lmC\366\360y\022\347\256|cYz[\273\270\321\225\313\225o\270?-"
+	.ascii	"4s]C.\373Lm\213\3317\323\271\236aY\263,\311\205Y\232\2333\373"
+	.ascii	"\006\243\364\333\312*\201\252\214Yf\205\354\273\254n]RY\253,"
+	.ascii	"\3610f)/O\355\264\311\276\301(\373\376\n\206\225o\346:\206\\"
+	.ascii	"\222\220\224B|\262\374\266\242\267\342\340F\301\326\260\245="
+	.ascii	"\276\2453\313\357\267\275\272\345W\275\330\252\362\315\\\277"
+	.ascii	"V'\304-*\337U\242\253\322\215&\251|;\347\304^\b\tD\253)\337\314"
+	.ascii	"\365\206U\t\221j\354{\312R\337\212\304\375[\267V\256%\277\245"
+	.ascii	"\277%\300%@\265\323\036\373\206S\206\221\273\0032\002\031\212"
+	.ascii	"\356\034\276\231\353\021$\222>[\263\210/\224\224\357\034\226"
+	.ascii	"\002\327\253\325J\3127\234\023+0\372v\3676\270\350\216\362\315"
+	.ascii	"\\\253\220HHX\251\324>(\261\357(K\202k\020\367o\005\"\366\r\346"
+	.ascii	"K\217\037\034\276\231\353\217\325\307\016a\3378,\r\256<\334\350"
+	.ascii	"\n\025\346\026\370$\302\034\3307s\335\201\\\266\332suZ*l\231"
+	.ascii	"\326'\225\t\345\033\314i}\335h!\224o1{f\357\024\302\327\240\240"
+	.ascii	"\252|\362\375\265\203\270\006\360\311\267\223\214\354_\020\302"
+	.ascii	"\234|3\211\177D?\225H\223o'PD4\356_\264\311\367\333rn\260\205"
+	.ascii	"\033\223o&\361\fr\331iI\"_\333\303\307\372\224\026*\277\231\374"
+	.ascii	" >\365\224\337N"
+	.string	"%\02526,\302\222yc\372\226|'\201\020\355\334\277\272%\337\315\2611\300\017\262n\230\013s\347\365}\303\0241\316\351\365\335&eK\215\007TJ\276\231\3047\342\227\364-\311\267\022*\242\016mI\276\233J\261\023\002\373:\230\353b\343\302\005\311wW\025QK\032Q\255\265\302j\263\262\220|w\t\203\256\340:\303\222\222m}s\035!\232\225m}\277mU\361q\020\250e\005\271lA\254\222\212\035\371\326\332\"\216I!\346\320\"I\322zy\251\235\366\221\357\266#R\272\236\315060\"\206\\\276H\022\303\322\256\254o#K\210_nT+K\212\023]\024'h\266\254y^3\f\025\304\251\"\337L\"\023\344\222\204$1\2114\363y\246TX\337E\224D\257.\2541t`I\240]\270`\205u\005\206\275\250\363`\206\201\204\256\306\224C##\"\222&IsS\033 \bF\2014\254)\354\001\023"
+	.ascii	"\303Lh\263"
+	.string	"\2210\013\264\234\203\222\311Q\031\035\215\026Q\305(\nXG\325\277\354\340\303kgd\033\302\2023p\327\n\033\322\023\344\262\2451\005b\234E\374\377\021\347\210A\251\220L\t\240!\001z\215V-\324\031\201]\212\003\203n\rn\277\375\333:2\035\0059\350\223\304\265\341\346\031\215\210?\005f\345-\247\b\273\r\321\355\"\007\004z\277\340}\320\020\275\300\322\276\233kh@\2615\237\305\230\236t)7\321\2534^\004\207h\330\335\027\324\271\2428\035G\343\240\351\0327\0342?\242;\275\241 \256\003}\370\205\331\354\033\247\361\314\2323>\201\325}R\355\024\201R\332\247\321S\366\342\277\242\324\177A\027D\224\364\363G4k\277}\344j\365\240\025\"\224J\351\265HejNF\305y\373\356\221k\246\207\313\313\264\2323\315U\344\020\004t\202\355\305\001\336\254\003\267S\034\376\340\367\246\342\267{j\277JYa\355\244"
+	.string	"\276fxanz1\325hya\312s\177r\302\3313\026\202\220\303\251\233F\326\021D\235<\235\270\373\216\207\256\363\202\316I\222._\246\\\306\";\214"
+	.string	">\302\325\230\316\265\025\240\264\207A&P\377\305\324\235<Z$\231\210t\367\345yxjQ\255\\`\220>\2604\360?8\315OE\177\233*\2127\256\350\250"
+	.string	"\3750\013\022\200`y3a\366\377\331"
+	.string	"D\311q^H^\266?i\004G\t5\223\324\272Ou]=\007\324u\376XP8\223\027z\214\246\2201;\273\234\341\237P\327\375s:\220\301\007[p\217L\342\342\216\252\240 \236A\275\312\263G\212\275\370<\215p\216"
+	.string	"\001#.\223\364\272D7\313\262\366D.\177i\211&\210\335\341\375\f\nIE\214\274\217q\0217\357\325\004\330\032\205\300\227>'DG\303\344\343\220L\261\274\005\256(\275xV\253\"\t\250hYh\243\027\232k@e\334}[\321\360U M`\031p\026\034\204X\221s\3504\177\371\310%R;L\326\213\345\363=\356\"\222\315\350\372l&\344\036h\261tcSk\031\362\246\242:\255l\215K\317\235\366\311\325e\274i\345\237\240%0]}E\270G7\257-2\376B\005*i\256\n'\2750%\224P\177\311\n\251\314\361\203`]\232\t\304\202\254t\223$#\300 `\005{\302\005\303cq\271\326\251\262dJ\261"
+	.ascii	"\210\325R"
+	.string	"|\313\027\345i\350\020%\370$\351\365\313\005\377\"\230\270J\312\265[A\242Q\377\005\226_\376\316\336\\\037\006Yp\212\341\330\027sjS4\r\304\253\324\261\033\030\236\002\302z\004\204\254{\367\322U\241\023\024\240V~\265\227\344Qsa'\300\1778\3377\201 F\036K\327+c\233\251\223`(3Z\323\363\370\031\020\236\2667h_+\354\362\245R%D\363\344\272#V%\314\272\302\321Cy\307.!j\253\234\212\327\031@\351\373o.\312\2313jC$Kd[\020\376\262H\343G\256\235\221_\232T\341l\363v\362\352v\233\264\007\265\315^\223=.a;\240Yj\235i\376\317\330\273\346\337\253\243\274\271\252\256uw\354\2229\204\263\266\305\330\362\351u]\345\254~\375w\013\354\n\b\320\242\361\377/lkyY\256\002\274\3468vss\257h\2710\022/\250\f\327Vg 1wg\3760t\265\3103"
+	.string	"\250\230\t\346My\233\035\266O\315\230\357\340\377\254\317\264\036\213\325\005z1q\353QA\220\353\3071\220\344\314y"
+	.ascii	"^\r3\f\300\332p1*\035\267\251h\242\352\271\0026\006$+\211\n:"
+	.ascii	"\336\252\265\006\rN\353\013\353^\223\001\353k\331\205\301\tL"
+	.ascii	":l\312\224\316\t\210q\025\027sc\3772\213\376\323\260\024\310"
+	.ascii	"\211=\337C\232P\307\331\262\370\231*\363`\f\261\236\327+\276"
+	.ascii	"6\201\351\230t\367\303\313e&-*f\033* ;\331\341\310y;\365\024"
+	.ascii	"\304\004O\021f5\276\341\314\357\305}v\003v\224\03405[\372\024"
+	.ascii	"?R\002\336\222\037Uc\200\222\371\266\016#\373e\001\340\237jk"
+	.ascii	"T\270\314_\b\363~y\343\031b\203\355oU\223\021|\251\0165\036\234"
+	.ascii	"\315?r\317Y\321\037(\215\013\271\355az\016\245\200\273s\243\237"
+	.ascii	"\036\323/"
+	.ascii	"\322-\347]\227\211\320\027\240\310\261]}[h\277\210\323\201j\r"
+	.ascii	"\322\354\\!\242x\025\271\220g\263\006\276\021$\210\2744{\331"
+	.ascii	"\210\260\3524\267\266\006\335\354\230\347\f\240\267r5\204#\367"
+	.ascii	"\262\233W\216G\352b\254\257:S2\271bt\271\332\001\022\361;\216"
+	.ascii	"\223K\337\335\251o\340.\241"
+	.string	"m\327A\314\32143W\240z^\320#\231uwCn\305c\261\346Z\355/\236\200BA\355\306\241\201\241d\354\361sw\032*\r\332\247)\025\245\345\321\022\027Fe\351\254\336t\366\346\265\222\037Bg\256\031\256\025\264T\0250~\262\312\2029}\020\331\354\001\032\246e\242I\0226\t\262Evp\017.\r\026\232\273\016\215\350/\354\201D\\\305\203\303K\300\302\b\320\245\203\003;d2\367\2705={,\254z\357\247BF\354\344|f]\0364\275l\277\373(T\003\312x\316\227\327/\207am\276\017\023\007\311n\252\264\003\236\376\257\337e\013q~\252e\264\024\201yH\216\226)\377\210\325\t\271\227\320\352\321\357D\3204\237u8Gw\236\252\276 _V\264[TC\337\202\230ti\213^\314\031\305g\213\232[s\271NH\201I\315\002\31138\by\224n\330;~N`\323Kx\245{TzG\214\242"
+	.ascii	"\203,@\236\224\030\217\363\013|n\255\t\231Asf"
+	.string	"\210\350\202\251<\2534AS\031\362\260\244\3406\022\rFJ%u)C\324S\362\224\305k\342W\\\377e\257\025\371;\221\341\371P\017\373a6C\"\007\252\207\254\206',3[{\343+e\3148\246\261{\206B\253\277X\274\330\322'\022\021\033\374h\371\361\345\226i\002\254S\347cLpm3\n\246c\366\366\200\342\265V\312n \3452p<\020\031\036\270\312a\305\216\314\324r\203dS\302\241 t~\211z\366\300\305\315\017#\316k\036\007OV\270Q$L@C\361\037\006\204n\r\005\371nCd\r$\241x\320\270DN\317\317\270\366\215\301AX\031\363^d\270*A\265 \004qr\251\324\262,,\367!\027,\227\255\342\244\372(-0\244\271?\212G\367\370\245\244%\206\021\341\022\035\362j1\252\250\266\366\001\311&\024\374\017\331\241\250Te\001\335\300\232\251D/\230\254\202\020\320\225\305=\211\006w"
+	.ascii	"\340"
+	.string	"\363\031\0062j\006\347\036\244g\304r}\2122\0076\033\224\363veTH\013\032\322\214\255\242M\340@\351\213\243\334\330\020sYx\301K+L&X\371K\370\214\027f\005\223\237\230\205@\226\300'\037\317\264F\222\357\236$\224\027\263\375Cp\021r\205\033\262\242\330\225^2I\032s\303V\236l\006\371\220\025\323aV\346\364\3550\224\230\250\326\227\246\357\232U]\263\304\305N\003p\262\203}\350;K\314\342\352\370\202q\323\310\2307#\216\273\005'\324b\367h\332\312\305\234\353\001T\\\325[\272\313$=-\324\024\305\216\235\301Y\222`\247;\206\340\235\004y\ru(\372\337\035b\025\200\276\267o\342$q\362\002Ke\253\374f!\332%\\\351\364\013\355\031\".\024\275\373\351G\233\031-;'\266\316\223\255\260\272\205x\326\350_P\303\350\346>N\313\302}\202\337\t\335+\211\2572'\242\356\030\271\257z\344"
+	.ascii	"f\001H\367\277\371\220:X\222\370\243\334[\365|\346k3\240B\024"
+	.ascii	"#\310\035\177\tx\345u\326\336\007\032\357\251j\005\240\250\254"
+	.ascii	"\275\017l\243\033\274z\304\201'\034E\302\225\373\332\342\001"
+	.ascii	"\253\274\312\332\373@\343=U\255\312\300\313\357\204\375i\244"
+	.ascii	"\230\213\267\025\227\023_\265\231R\210\025R\364\357\310\202\350"
+	.ascii	"E}\200\361\326\262\220\272h\017h\3345VD/\352\003\214\267\226"
+	.ascii	"\205\324E{@\343\256\261"
+	.string	"\"zQ\037\3100\333\265}\326\371\021\255\220\r\264\037\246\376#\363Z\352^H\355dG\211z\267k\246\304\227\001\215\2325\022`\301\337\023\314\310\246PM\247\\O\036\356\347@\002`\231\354g\331\276#\023\322J%~W\024\357\273G5qt6+O\304\323X:\350\247Iw%\200\210\t\020\365Ki\304\"\022'\207x\222\013.\274R^\2423\227\301\312\f\305\202\003\246\262Lk/D:\226J\2561\235\212\315v9]\035n\342x~F~\243S\032]\250\335\352U\205\265\242\033]\250\342\365r\n$\323<{\031!\230\025P\311\371e\007\310\211J\336\344\021\234\255\264\332\301\263\200h\002\375\331%\366\211n\222\023\244\032\311S\203\216\246\217\206\005\302\364\311]\310\231!\002\326&o\020$>IS\220*\303\205o\223\tum8\346\2620\304\002\364\302\253c\006fw\305\024\376b\244B\252\362$\355\210\203\240"
+	.ascii	"!\201\310p\005@HJ5\264A\253@\224W\016H\201F`\007\337\340j\005"
+	.ascii	"\317\240j\355\231\263\004\226\332\3019GM\277\345ltf\007}\237"
+	.ascii	"\221\205\327\243\367\"{5\375\226\263\325\271\3659\272>|\037\323"
+	.ascii	"W\331\267\231\233\236m\317\303\353\321\373\221=\223\352\345\260"
+	.ascii	"[\351\357\177\221\216\210\213"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.183.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\b\001-\r"
+	.string	"\326Y\\C"
+	.string	"\223\223\016\270\251\210/\020$"
+	.string	"zC\3462\2719h\336\277p)\027k9d\327\301\314\334\3243C\026\036Z\303\002;\226\306gf\221\376\277{5\213\217)\243\261\235B\223\330Y%\256l\021D\366\3362\245H"
+	.string	"I"
+	.string	"G"
+	.string	"\276\254K\0057P]\306\027\250.\315\331:\356\271,I\n\346\003\312\307\356b\020\305\271G\250\234\317\351H\217\026\313a<0S\002%\240+\305\00505,\376]W:\223j\210\311\356ZO]\210[\336\266\004\333\024\354\213\002\177\365\230_F\265B\365-\00464\".\343\306.\210y\2635\322\306\n\333\267\037\203\263E\354\355\245\243\372\317\367\016\203\273\f\007\022\002k\372V&X\227\366\254\255\245s\375\013\277\305]p\217\351`"
+	.string	"\273&h\324\330\365\032\004\220t\232\227\033\027\370\222J\241\347\303a\322\037\0360\347\354\361\222\352P\341=\220(\351\264\217\372L\006_\205QR\364\247K?\245\272<\f\220c\204\212N\377\373S\360H\331\254\002\261=\222\302\026\373qw\327\360\204}\231\331(\003E\203\036\2002\007\021:\020\256\221\221(\244!$\375\2716h\036\013\237\354\202\007\023U\310N\260\317\206\202]\t\254a\bm\330H\3236L\304\333\233\250\300\222udYR3v\254\267\f\256A\016\347\2343r\264\202\022\332'\232\376d\031\023"
+	.string	"57\002K=\231\001\247\016\363,\254\024A\363Y[\201\301D5"
+	.ascii	"\002`\304r\036&\004\3462\016T\003\301\t>\325\2128\311M\335Gc"
+	.ascii	"P{"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogArmingBeep.184.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`V\001\205\016"
+	.string	"\346\332aE\340\224(\035\220\302\032D,qt\006s \225\355\374\370a\340\223\207\263\270\243P\007\316\224\202\327\214\"\3605Y\356\227\354T\261\b\004n\374\006c\214iY\2661D\304\235=8\247Uf\215\004h\262a\311\2262\245L"
+	.string	"K"
+	.string	"O"
+	.string	"\242"
+	.string	"\327B?\371\\\213'\360\271v\220Sv\021\0032\373\245\310>\314\274\216\354\356\246+\236z\324L\371o\275\004\\}\217#\2561\364\0036c\262\212\211(\254\023H\336z\322\254T\231"
+	.string	"\"\354\256\023\\\325\334\332mO\260M\301\276\214\340\265\001\n\225~N\020s\001dSf\207_\252\215\375\270\312\2623\255\231\316L_\300\201 ;D\334\207\221]\020\263$\013\323z\264\270\353\267\357\321\214|\032~h\220\347at\234\327H\335\365\362\255\331\20372\023;\273!\024\\s^a\311\203\016\311\3507\303-\017\273\023\026\273\353@_ \317c1\256\023\203\241\232#\276@\036\325\223x\370\001:\261\027\357I1\323\241j\343\324+)\207HL\366\330\3179\216\316\2771\206\223\346\237>\327R\021\f)\001\2233kik\340\220\017Va\240\302-x\2202\022\025\340P\234\004\224\213)\203\251\304%\321\206\216\304R\342,\2206\227\025\256e+y\247M\204\342\356\202\311\333P]\347m\240p\037WYn\375\035b80\030U\305\227\270\253\002\302]\377\316\215\234\331$o\343\241\351<\204\200~\205\217\003\033"
+	.ascii	"9\267\002K=\231\320\002\306\330\242\213\377\337\233\312z\364"
+	.ascii	"[\013\300\022\224~M\230\345X\222#\346\020,f\005\227\2738\302"
+	.ascii	"\3055X\324y1\321\3303\024\327\304K\232\330\302*\364\313\025\342"
+	.ascii	"\322M\325\316\024MA\001"
+	.text
+	.section	.gnu.lto_blackboxCheckAndLogFlightMode.185.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\326\001E\021"
+	.string	"6\240sJ\320\322(\035`A\361\216\301\333\231\261\332\035=\340\253\200\023\n^\253\260\207\350\362aa\237Zd\333j.\002\374\267B#Q41h\310\024\3176~\313\025\236*'\235\365\305p\230\357Mp2d\307\221\2556m\203\020\262wJ\001]"
+	.string	"Y"
+	.string	"a"
+	.string	"\266\275mE\021\n\334.\210\220{N\215\356\331\374\351\2737:\201\357\336K\226\331A\005Xv&Rt\302\003\216\217\335\005\253\211\313\336U*\363AFv\3673'\225\265\331;\021\257]\002\234\214S@m\245;\271\244(?s\332RS\241\024ddwM\313\232\355\366n[\202\355\t6u\020\307!G\273\264\227\376\315_\224\3702\367<\222\236O~\367\354\023\r\364\345+\003\022\035\352\314\b\316\0329\226\026\331\346\214V\030\373\335\326\027\273\243\376*5\245\324/\241\202x\204\270\r\032\273.\271\037\373\343\365\250x\315o\237\024R\3714\276\351\0229\244:\213\267\220\275&\345\0337\241\257\366\274D\023"
+	.string	"\240\333\316yP|\231\333\214$\030\263K\013\277{_}\313\b\032\315\371:'\016Zm\326M\327)fw\033\274\034\362s\036\303\345\313\320\212\002\272\321h\316?o\334\374"
+	.string	"\235\323\3471D8\236Za\034\362\327\325\315\216\025J\344"
+	.string	"\264\273}\276\323\\G\3149\f\327K\024i\002&Y@\022*x \242J\231\302X\030!f\322\332\320\"\231\225\3420\256DV\210a\005\232\274\302\022\220\005;\001S\006<fh\301\300\3308\302\300\222\271\357\266\276x\346\377p\366\370\241U\225.\245\333-\001\3415?\316\005\315\331Dos\223\302wt\224\250W\370l\013\027\350K\037`\2513\377\034\232\201rS4)# `\002!t\305\007\351\255@\325\223\206\026<\206v.\372mo|\366\350\257u\215\321\fpV\\X\307\240\245=\210\306"
+	.ascii	" \203\321X?\237U\377V\337\236\020J\021\257)\274N\"\241\221\020"
+	.ascii	"\007\236$\003G\303\221[bL<%\261\227!\364\303\025d\271L)\304\036"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.188.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\f\001\035\f"
+	.string	"FUNC\020\215*\035\300lrU\363\305\275pZL\006;\370\321h;\200\204|\326[J\232{\022\027r\333\033YR\002\320\257\3771\006v#\\#"
+	.string	""
+	.string	"\254P\200\021\200\367\033 \306\202\261\230\020\275\021B6\2212\245<"
+	.string	"6"
+	.string	";"
+	.string	"\001f\350\021\343P\242Pb\316\351\255\202\203\327VA\377\253S\3041\274\326\231\276\032\007J\203\211b$i\025\035\022\200\370\352:`\034\251r\037sN\2538\036\270\345m\203\330\356\260_ 3o\300.x\230\032\263Y\241\256\312\27667e_\335]\315\251Z\252z\257\326\253o\311\220\021@\360\r\2569\r\314N\314\227\264\340\300\366\355?"
+	.string	"\355\212A[\304EK9\311\345vC\224d\031\344\272\276mW\266>\341+\371|\266\313]\f\f\272\022.\222\370A\333W\367\002P#\235\331\207\360\b \237\201OBz\361\322\017m\227_\213\005'\221\006\326\\"
+	.string	"|\031\216\006#\222\361F6\230\216\247\361|\274\213\206?\222\020\217g\362}\036\257\302\232\327\346\246(\260\021/\321\2164\213\332\033\216^\364n\370\006\"\352\265\253\352\226\333L\353\003IM\270B\247\013\036"
+	.string	"`\2517\023\232\222\006\316zma\355\005\264}\267\t\217Y\347\300\030410$\002c\031\206Q\341\032\260\0022"
+	.string	"\244\006@"
+	.ascii	"\303\300\031\274K\005A\0200\245\330\251Tv\273&\252\035\302\026"
+	.ascii	"\2279f\22340\265\007"
+	.text
+	.section	.gnu.lto_blackboxQueueIteration.190.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\230\t\0255"
+	.string	"\372Y\340\023CP\344Q:\227h\374\270\006e\351\310A\271\0063\373B\207\022]\030l*\335\213\b\276\035{cy~\036\276~d#\242[\240B0D@\n\220r\210J\302\352\210\2641\034A\306*\366-\211%\204\354\235d$\001\025\0013\001d\372l$\226l\355\327\b}^\314\234\334M\t\304L{\023\322\271\332\335\263\351\247\271\232\341\327\bQfN:M\261c&\355\355i\007\327\247>\364M*\232a\367\315t\367\032\307\311t\204\245\234\267\247\37528\272{O\357\305\\\355k\335\023~\215\351\312\241h\016\331\"y\025aB\373\246\216gc\326q6\267T\261>\025\216]u3w"
+	.ascii	"\310\316\374d\237\2710\206rf:x\332#z\013\356\352\267\373i\007"
+	.ascii	"\323~\311\343K9K\271\323&g&UW\255O\233y\001\352\323\365M\352"
+	.ascii	"\323n\273\t=}e\037\022\346~\034\327\336r\316?<\345\355\221\216"
+	.ascii	"z<v\335\251)\212o\333\347%}\034\351\300\021\017\264,=\324\200"
+	.ascii	"\024'pw\2025A}u\364\034\257\005\214\311\345e\315\235\035\202"
+	.ascii	"\0226vv\211\222\273\336\t\246\324\0026vw\273\fP\302\226\\=\032"
+	.ascii	"oz"
+	.string	"\344\250/\347\334Kz]\2146 \263#\226\224\374B\005\354\2112\350k\277A\222\305{w\031r\316}\221\311\260w\322\273\333\331\335[\335\354\205\031\210\351\023\326#e\246$fyZ\037\245:\341'\374\271\243X\361L\234\223\226\363U\004\013*\245\252\030/\352\272K\251)V\361\217\312b\235\025'Z\244\370w~+H2=\030\2275\212/v\241\366\364\272q\375\340\030\243\370F\272\342\234\323\021\242H\221B}\212\361\225\031\276\370G\272>\234\307Y\301\242E\013\365\351q\201\2518&N\370c\356#\276\355o\272\372g\r\304\272Gb\251O\235p\322SI\274u\375\265\337,\356\2103_\271nf\361\342\262\356\343\272\272\272\272\306R\272y\267\255x\267\177\274\333U\274\333T\274\333\017\330\333\016\330\333\r\326\333S\354m\006\354m)\366\366\202\365\266\202/\377\2507\337P\004\236\234\232>\346\315\304\273\275\204t\033"
+	.string	"{[\351\350vR\3576\022\357\366\021\357v\217\275\315co\263\354\355\225\275\275[o\253\353\355\224\275\215\262\2671{\373\256\267\017\301\300\226AF\036\210-\347\"u\215\262\236\264\355\312\233\377\230>\232\267\031>\370\b\377(F\327\303Rn\274F\205\316b^\034\213\023,\235\211K\344\314G+\204\007\255\207\256LX\211\355\r!\225"
+	.string	"n\302A\322w\251?\004E\2670jxv\357R\253\360\017\237\n?\300U\370F,\305Em\030\016T\230U6\023]\221\006\337\317z\003\007\016\352\323\007\030\203\231\262i\006\256\314\231\3040r\343\223\257\\\236\246[H\f\036@<:\316\214\017\035\211\350Bu\207W|#\031!\241\207\024;\234\340)\307\302\227\344\223\215R\255\360\327\276\322\251\t\272\357R\231\260\025\356\373\206J\234\2416+.k\007x\001\356\241v\347l\376\265_\214\355\215!8C\r0\003\354"
+	.string	"\357\356\030\333\246p\203\017\027\364\234\302g\363\\*]\250Ja\006Xu[\200/\226\302x\215\221L\001^\320 \376'\304\232\263\027\205~\237\373\021\321?+QB}\252"
+	.string	"S=\227\3046\277\031\2431gf\373\211\024\371\002\006\227\350\342\263y\211'{\342\3028\363w\004\376(\225\t\023"
+	.string	"\343\314WqY_'\254\304\346\206\016}\302Iln\254`'\314\204\203\364W\250Gc\3529\202Y6>\004k"
+	.string	"\271:l\365\2060\2004^\244Y\300`\f\364\206V\214\341\026\320\306p\355\254\bY@+\013\022*T\005\030\236\b\326\220a\342\206\215 \027\027\016,\244\306\252\312\241\345b\006\026\220\206\213\237\r\031\300\032?,\256\341\257\312@km\005\271~7\264\264\270~=&\361h\316@\304E4\347\234\221\226\360\023\f\007\211\250\311\350"
+	.string	"\360\022F\347\216\312bP\205\302"
+	.ascii	"0\n\307HV\034s\346.\265\211\002*\212\2304\225\335%]\027\226~"
+	.ascii	"\336\224(\007<\225rI\224\246\\$\302\013K?^\216\210\3350ak\226"
+	.ascii	"B\tC=\225rb\316|\243p\022\356n\253\264W\356\221\355\373\302>"
+	.ascii	"\272o\021\030\267\315r\211\264[r,\373Px:\244\345rD\313<oA\256"
+	.ascii	"\220\035\352\323$|$\022\242\234\021\247\327\317\274\217H\346"
+	.ascii	"\002\331\001\025\b\331\335Y\367G\313E\311\210[#\262\264\234s"
+	.ascii	"\205\247}\215\367\330vi\277\264h-Z\013\246w\254O\302\246\252"
+	.ascii	"0\323\336r\316V\303'D$\274[s\244#\326A\3417o\021\n\013x*\233"
+	.ascii	"s\316\374-m\371\354\210\221\363\b\367\333\256\017\365Qj/\200"
+	.ascii	"\326\250\2014\005\025Rh\206D$\005)H\322\001\220\002\221\241*"
+	.ascii	"\363\021pEsD\022Ce8\332t\024|$n\272?Z\216\201\016Z\232\264\366"
+	.ascii	"\312\003k\317\365\2503\017<~|\360\360\0370R\3732\231Y\t\370\023"
+	.ascii	"\375g\240\034\\\223\006\337=\020\375\001\327\374\032\354\343"
+	.ascii	"\353\252\370o0\317P\347\224\313\263\257\242\211\264\347\023\365"
+	.ascii	"vW\236\200\2239\342\237\233\377\223\\\271\003)\311\307]N\321"
+	.ascii	"9\337\330\003\330O\220t \023f\256\236\004\335K\333\215>qv$Dx"
+	.ascii	"0N{\345\251\214\216+\212=\205B>\"ak\370\345\276\372\024!ukv\023"
+	.ascii	"\262\007\203\017\261\332\341\302\265\033-\b\236\b\346\\]\332"
+	.ascii	"d\334g\310`\235+\304\366@\366\300\002Q\353\031\311\005\305\322"
+	.ascii	"OJ\255\263\347\215\352\304\303\005\210\274\b\034\033\230\317"
+	.ascii	"\336\b\217\323\350$\022a\016\035=d\0078\214\220]\302\021{\216"
+	.ascii	"\216\274F\005y1\325\267\321 \302\255\327\252\027\035\034\"\270"
+	.ascii	"\037\270K/\004\320\251\207M\274\352\344\227\263O\351\"\025.\f"
+	.ascii	"\233\345\005fCn_v\377\247\317?0\332d\251N\032%s\262\203\tI\227"
+	.ascii	"1\245\246\3137\370\270\335rB\017^\217\353z\241\32593u\236KLY"
+	.ascii	"\246\212?\271\b\262\020\247$\240\255\221\316\001\035\241\200"
+	.ascii	"\250z\r\343\235\213\232\033\306\032T\227\006\217\237L\030\376"
+	.ascii	"\366J\210\2433\312\243(\245=\225P\377\203Q\366\275\323A\023\242"
+	.ascii	"\277eN\007Y5;\227\326\251\3251\314\246lk\355\021\276\313\357"
+	.ascii	"]Y\254Q\003"
+	.text
+	.section	.gnu.lto_blackboxLogSnapshot.191.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`i\013=7"
+	.ascii	"\272[\020\024A`\350M\007\023AQQ\240\244\253jT\"M\031\350\302"
+	.ascii	"\365\213e\327@h\004<H\337\f-fk}\006^\222r\\\310\310%2D\334\311"
+	.ascii	"\036\370\205\n\216R\326\274\234\211g\300\254\033m\262\367N)\245"
+	.ascii	"1\001\027\0012\001\355\240\3273\262\035e-g\347^\262U\321\215"
+	.ascii	"C\323\2545\230\356\212s\305o\374\353\222s\325^\372\213m01\220"
+	.ascii	".\363\266\220\270E\315\271{\215Q\2152\006\265\321\276H\275\224"
+	.ascii	"\266\233\214n\3436.\277X\271\367\376\032\345\346\"\203\371\327"
+	.ascii	"\250\377\230\273\314\\\2653\267\226\336b\233\215F'\335\253&w"
+	.ascii	"\346\336\266\004\254@m\224\333\232)mT\355\245\264Q\266\314\200"
+	.ascii	"\002\214\335\257\252Eq\210_\020\335{\247^I\333f\022.)%!\005\201"
+	.ascii	"GF?_O\345\245\350\371n\271O%\212\326\342\361\253\231\204N\226"
+	.ascii	"\230(-i\342I.\326\245\2404\036N\032I\031d\032\321\200'\224\234"
+	.ascii	"8b3\215g\347\223\032Z]K1&\375\350\204b\032\235\234PE\334\350"
+	.ascii	"\307\213@ \215\007\221\366\021H\343!\244{R\214B\\=\021\234\315"
+	.ascii	"\351\321Lc\220\223\351\016\222?\355\326\004\244\030\315\234\307"
+	.ascii	"4\016!z\372\243Q\340\261\306\tu\357\035\363\263G\377\211`\016"
+	.ascii	"\215!\340Q\354d\"{R\354e;\216c\230;/\302\275\227\275x\344\321"
+	.ascii	"\334\324\314\275\203\23190\373h\004\031\n\025\351\316G\277\211"
+	.ascii	"w\032z\316\326\224\034\251\344\371SM61vpxC\277m\005\373\264]"
+	.ascii	"\233\267N\022c\247\206\331\311Dsp\357\224Z}/[ev\361#\346\211"
+	.ascii	"\330\333)\375\267zv\242YX\207n\343\341_\330d[2\257\333\261?3"
+	.ascii	"K\365\232\027M\311{/\026w\232V\363\201\031D\210\020_\372\314"
+	.ascii	"\013\247d\221YD\303\215h\264@\037\377gS\374q\300.\013\263\237"
+	.ascii	"\233L\227\331\342n\302YZ\336E\255\264\321\227+\3221\233\3501"
+	.ascii	"[\352\275\327\212[L\004\024j\023\032i\243\375\006\232l`\276\262"
+	.ascii	"\303\311i\253\243\273n\307\334\026\346\217d\356_\327u\021\277"
+	.ascii	"\032s\352\214\225:_\245\316V=\347\006\247s\325\351L\345sf\340"
+	.ascii	"s\216j\266\356'\236\263\200\3239@\317\031@\317\271\251\347\314"
+	.ascii	"\324s\026\246\316K\251\263\022\3179\351tFJ\235\203=g`\317\371"
+	.ascii	"\250\347l\324s\376\251\316\276\324\271w:\253\2473/uNy\316\350"
+	.ascii	"\351|\246\316\217:\373\351\0348\254\016\035i\243F_\245L\003\346"
+	.ascii	"+\231\177\331\243\332\253_[\346\303\002\001\2226\372\373\246"
+	.ascii	"\346\335\241\365\350\221\334\\\251\357It\361C\345\315l\207\330"
+	.ascii	"\"\336E\337S\0319p\347f5B\013\016\232CD'\325bX\216\234!\211\253"
+	.ascii	"\243\373=\222\275"
+	.string	"\027\325\355\326\276\271)e\210p\252T7x\034\314\t\224Xe\330\177q\337\231!\360\006\317l\235\3305\357b\0168AF\352\346\304\376k\315\367\310\265(D\350z\257\306UOE(\212V\325\267\031\245\031\203\247\232\322t\202\030<\204&\023B\223\303\220\372\310\266U\322\250w\272.M7\266T\032\220\255\242\336+f\305\375\247\345\354\025f\233\305n\261[\322F\243~\200[w\222\317\220\336Q\343\n\224\272Ab\356|\270\2331\262'\274\253\276\262K\325\246]\236z\202\353\032w{+\345\275\372<65\316\302\366\360~JYh]\327;\364\221o\272w\266S\232~\017O\332\313n\245\335 \346\031\343\2747\rB\203\351\236s\363\225\237\274\303\364\333\204n\003l\n)s\005\013\336E\206\032\373/:\3503_\350\267&V\274ha\302+\345\022\fJd-pP\205\245@\350\202\353D\213\256,\026-T\326R"
+	.string	"\203\213D\n\255,\025$\246X\240\310Z1\245\345\325bJ\301\023su\231\360\232r\301\305\3455\365k\003\353\363\276\032\367V\2648\260\017;\357\275\227I@\200\027\260\366$@s\005\"<\024\245\215\020\3007}'ib\217\017\230Xb\325\022"
+	.ascii	"\377 i\217OJl\231S\222\246\237\261\314S\307\017\250n\311\322"
+	.ascii	"#\231\351\205\377\200\324\354\261\367`1\017\345\034\211%6\235"
+	.ascii	"4\246\357=F\354\261\311$y\030\310\321lY\203I\236\t\277\311(\177"
+	.ascii	"kt\224J\217\344\245W\372~2\024\344D<\fY\032\016\362 \036T\007"
+	.ascii	"\342f\303B\303C\303\272a]\332\250\322;)\235\313zlBc\263'I\202"
+	.ascii	"'=\363p\321pE\372\244o9\357\261\225 \351eH\237@yw\367\245\250"
+	.ascii	"\031\267$\b\022\226!\265\235\322\340c9Y\360\275\226u\256\260"
+	.ascii	"\324\222"
+	.string	"I\231\340#\031\370G\377Rt\330c\323\311a\211\275\006\007\360\233N\230\337\260q\324`\201.\021\340#\331\350\177\357\3455\354\261\212\355\230\217Y\242\201>\036\346b\366F\200\356\250\221,\005\025s\210DDJ\n\222$\215\001\220\002\021\2312\352\006\021\3208\351\024\"\232I\232\326h@\002_h\314[D\354\300\250 \240\205\200\207~\"\240\370\201\222\030<\336\024|QC9k\211\357\224\310\221w}\206\266\003*9\325\025\363\236\272\265\034\276a\\\230\376\347\313\27189N\342\265\243=5\323ot\022M5\254i(\335\301\223\025\265\257\224\357\315{A\240`\274 #\245G\245\320I\026>q\373\223\370\325\266@\307\200GP\327h\322:\243)\245AE\214\205\337\344@*\326'&\321M\204\362\277l\362\230\206w\301\366(\321\344P\225X\0266,{\313\346\353qg\273\303s\225\365?\336\371N\241\342\253\250\215"
+	.ascii	"\311\036\024S\336\007'@o\231\021s1\331\331\221'\fD\366\304\257"
+	.ascii	"\223\274jx\216\030X\233\363\324\330\272I\032j1d\377H\372Q\303"
+	.ascii	"\037\260v1G|G\037\006\0033G\255\367\300\271\322;\241\345\327"
+	.ascii	"2\255\375n\244E\367\211\317j\276\366\325\217j\230\b\372/[\351"
+	.ascii	")\033\004\247T\3423\b\274\305\016\224\343\200I\250C\302\215|"
+	.ascii	"_^\351\230\215\371\002hb\261\034\314\371\366\220f\213\216\215"
+	.ascii	"\243\032\316\331wS\025\325o\267F\037\244\244\323\207(\026N=1"
+	.ascii	"6\301B\370\021\350\276\247RRz\022*F\024P\3153\002j>\303\232\315"
+	.ascii	"O$!\310%\366\f\037e{\002;)a\005\\\245=5\241\252+*\324l\321\364"
+	.ascii	"a\376\nH}1\363\021cf\002X\203k\020\376w\377\177@\177\2225kz#"
+	.ascii	"\fzg\321\006\331YH\263Q\t)\353O\033<s\376bM\263\210}\306\030"
+	.ascii	"\330\036\n&mJX\231\375T\352\327p^ \221\037p(\225>\356U\177\236"
+	.ascii	"\222S5"
+	.text
+	.section	.gnu.lto_blackboxLogQueuedSnapshots.192.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\336\001\375\020"
+	.string	"\306^oG\320\362&\035/\300\370\025\365\033D\340\327\321\251\215u\346\250n\374J0+4c\241\r/\215\245\343\177Ck\266\265\201\200\003~y\027iK\212Cx\301\321\036\362\215\241.y\220\255j\311\220\003U6:\215\354-eJ\001Z"
+	.string	"V"
+	.string	"["
+	.string	"3?\263\bI\312\232\202G\247"
+	.ascii	"<\036e\227\275\003\201L\276Lf\r\233 \037R\312nC\030\252\353\021"
+	.ascii	"\256\272\374\221\246\036\336\367z\204'\331\215\210\001\237\f"
+	.ascii	"\252\224\220\210>\273r\370b\nI\340|?\373\203#\246#\357\303\271"
+	.ascii	"\236\032H)\255\336\327\341\336n;\3056\004[G\0029)t\372@/ 4g\333"
+	.ascii	"b\206\354['\230>7\244.\331\265\227\356\216}\025\217\022\222W"
+	.ascii	"\307>\355\346\242z\213\352\030\325\020\252w\325\252\352\013\b"
+	.ascii	"Y\032\362p&\033R\336\314\037\322(\022\2158\355\267\377R\242\304"
+	.ascii	"\377\361\201\214z1QBr\342:m\303e\215\fI5 b\223\206\001\265'P"
+	.ascii	"\210\355\313\2371\b\250\256\315R\321{\026\241\331\227}\0263\001"
+	.ascii	"px\2665<\250\302\t\217\224R\245\342+V\374\236G\263\270\270l\217"
+	.ascii	"\272w\341}\200\351\334M\206M\023Lh\236\340\366\264\213\300^;"
+	.ascii	"\212\226\310{|!F\357=\3721\333#\267\007r\004N!IY-``\242J\201"
+	.ascii	"\264\254\254d\240Y\251\f-\024\026\326\252\005\245\263\260\262"
+	.ascii	"r\351X01]*\304\255\027\025\230N\246\325\202\351P5\371\325\341"
+	.ascii	"f\221\021lcqw\274m\\\007:hT\tF\204\355E\\nv\020\241\351\003\245"
+	.ascii	"\224\022\356\316\016m\222\307\343t\t\333.\334Xd\223s\f\033\267"
+	.ascii	"\2730) p\002\031U\265\003$\373\200\353I\002wc\325\f\035\225\f"
+	.ascii	"c\267v\b\346\020>a\326\315\345\003\243\024\260\230\226`\023\b"
+	.ascii	"\2441yji\336\211oa]\n\373L\023\335\374\265\312\274\222\001\377"
+	.ascii	"\350-vk@\020c\243\360\364*i\221Ssf5\206_\023\235c\b&%\205\003"
+	.ascii	"\0201]\347\t"
+	.text
+	.section	.gnu.lto_blackboxUpdate.193.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\250\003\245\031"
+	.string	"\006\255\237H\300XQc@\234\250|\231\214f\302f\371\263<\003gm\317\371\003,T\2361\372\277O\247\267\302\005\300 \233\244\255\026\035&\320\335lb\252\301\206m\035\202\200\214\020\021\205\245\264\240B_Q\024\020F\333m\367\336R\246\024\210"
+	.string	"\204"
+	.string	"\206"
+	.ascii	"7\362\211>\204\366\242\025\037p/P\221\322\275'\004\313\210\007"
+	.ascii	"}>&<(\236@x\3204\233\3673\350\036H\275\360\034=\335{]V\307iW"
+	.ascii	"\211\251\020\374l\245\371\rH.d9^\225\232\301\260\203T\"\352\231"
+	.ascii	"=>\027\023\244R3\271+(b\"\nb\366\314x\310*yZT\020\246\344\371"
+	.ascii	"Z\367\336\033\275\272(Y\324\257\372\334\336V\245-\214\301\241"
+	.ascii	"B7c\370\330\232\232\271\367\272\222e\317\275\272\355\034\266"
+	.ascii	"=\330\326F_\354'\271\022\035\237\207O\334\324\2237\341\301[\325"
+	.ascii	"\214ZM\335 \215\332\335\ne\237\266jq\330\267i\232\366l\201\354"
+	.ascii	"\027\375*\260\332\202\325\365\253>\314\002!&2\236^\271\027F\352"
+	.ascii	"\345\352\300\245\036>\221\347v~\372H\026\220$=\321~D\247u;o\371"
+	.ascii	"\\\252{pP\005\220\013\266\376\310/r#;?\242\363\235\2674`\023"
+	.ascii	"\302D\364t\320\032\304\203\255\357Dvl\326\301\373'\315f\331&"
+	.ascii	"j\\x\r\346\211A7\306\375y\356+$(\247\236\223\003\024\207\206"
+	.ascii	"\237rk\255\017\001u\300_\241\r\213\325\223\326\036\313\317\315"
+	.ascii	"\2167\212C\205@\213\3039a\2653#Vn\265\213}\364RrF\320\320\204"
+	.ascii	"\007\253\205\251r%f\220+\275\232?\276UUY\273FVO\372\263\243\337"
+	.ascii	"\344O\277\350\306\032u\034\212\223b\237\370K\253\261\2441t\177"
+	.ascii	"\222|'\346\211\252\353\374\347\246\351\220}&\266y\031P\246{\307"
+	.ascii	"\337\250\344\275\255[\r1\234"
+	.string	"\027\316\006\0241\033\321\"$\210xE\2500\201\202L\201\233\016\261\032\032\01686\261\331,\007\026\3000\231\024\262\020$`\257\022!\\64\257\032\027lv\343\222A`\231\211\330\314\205#\223\315\\\254\263\366\357Z \322l\322\325\254\315_r\317\2145\352SU3\312\256@\265=|\260\331\021\312\356G\257\246\020]\255B\211 Z7;:\245\232b\252\324`p\005\335\001@\212\272\275,\271?\210\327\264C:\206-COZn\322\177\364V\315\350\177\261$C\251\227\345V(*\366\216\003R\250\221$\304\230a\310\f\311HD\322\2449p\002)bf\036\020`\212&I\2069\272\355\200\330$\375\327N\003e\300\224W\034[S}\340d\254\001U\316\247\321\354*1n\230\271\251^t\327\025\214\254\f6\335c\r^\337!~\260\315~\037\005\333C\311A\3256\234Mt\262x\355\240\207pg\307\251G\177\302"
+	.string	"\347"
+	.string	"\345\330\343\210]\3026s\306\313\250\343\306w'xB\310#U\222\340l\204K\203R\005\202\312B\001\215\201\002\360\365M"
+	.ascii	":y\257\004\355\215\341\211\303\375~\030\325\220)=\037\247S{\370"
+	.ascii	"*\376 \354\373\232x\035\207\002@`'\374\001"
+	.text
+	.section	.gnu.lto_blackboxProcess.194.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`w\033\375a"
+	.ascii	"\372\225<!P0"
+	.string	"R\322\351\366\365\220}\343xJ&\314\231\230UPT\005\315\005t\b\307\033\263\367\364\020\"\377\"w\275\n\367\1777\"\037\354fN\226\257!\204\366\210\212\"\240\214 \b\002\321Q\362\235\377\341\220\316HE)\322\256\314*\252\252\272\t\331\335RJ)\374\001\334\001\t\002\316D\241\3630\350,T\235\203\252\363\252:\253\2533\020\350\374\252\263\003\235;\003\017\262\245#\007T?\365p\257\216\251\227\013U\333\212\264\224n\3466a\311\210\357\030\306\004&#f\226\302p}w\334\306\201\267\314\213\336{7\020\332\351\260\201\231\227>\272(\026\234\221u\t\215J\341\334\362+:'g\301YY_\034\334\277\245yqk\3737\265\256\265'\377\246\326\247\226\246B9\211\242\235\375\333\223\276.\273\321On\262\207z\003\253\002\273\367\302\264\312\314m/\261Q\\z\336e\237=\r\320\352\n]F\357\315\204\033\207\036\273\321Kl"
+	.string	"\237w\271\203L\"\007\326\327*W l\265\b\354\033n0\303\264J\204a\236\321g\324\316\334`\255\244\3550\026\032\304\275@\304\326\356}\022\300'\204\255\362\263s\326V\205}\263\266\312-\263^?\235\267g\371\345\304\244\357\336[\364Y\317\006>\233\211\336\266\210\241\242P\020\320\217O\210\036\236\035\235\034\234\033\033\020543210\304!\2210\270\252\300\367\226\333\321\322\306v@[\032[D\031Z\017\241\235y\021\255\201\314090\251\220YP\230\230\003m)\225\370OP\205XG\240U%\007&\365Q\013a\226\304{\274\234gm\247\210\353\270\345\020q\234\270\033!n3\007\"\250\202\256{Y\243\345t\232\255;\345\017\237\261k\242090/\031\037\036\003|\034\312\240\030)\351\322\352-\245\224\303"
+	.string	"Y(\034}\247\244\0026`\264\302\245\357\246\234\030T\201\265\243G\017\373\330\243\211\212\367\336\336R6q\341\320\2262\312\203CW;\314z\355;\245Y\223\253`_]4\f\tR\345D\\2\255+\227\224Z_)\315\210@\250~`\211(\333\0173\313%`\216\016\032\222-\326\376\264D\272\007U\334{\331\223\313\035\315"
+	.string	"4\363\3170\363\b\314<Z\002\335\026Ya>\306\243\\\252-\322\036i\271Z\256\265U\2307\301\224\033\341\304gn\221\264^\303'\276c\251\371\341\257jN_\372\256m\362\230P\200\234\305\230C\327\360\233\334-\364\032\262D\364@\332\257U\370}5\2067\344\374l\206[\231[\261\025\336I\341\273\260r\023~\223\203\257\276\322\230\016<\245\217\326\365\203\257\362\361\003\276<\032\301\314\302\225-"
+	.string	"\250r\357E\321*{\016\327!\001\367\220Vy\002\n(X[]\177\004^\330\2163\273\300\300;\251\262E\273\004\223\013\032\304\361\316\322\31474X\312c\372\250\321\"\327\302Jc\005\276\322X\236\2153w\340\201w\022\370)\254\246\032K\333H=\373\242F\377;@*\215\007\325\235\330[\200\271\202\364%g\032\266\215\265Ub\025\277\354F!\225\031X\327\037\367\227 \fI\272p\373\255=\326\300\272\270p\367\2510Lm\341\346\003~\311\302\255\345\333\312\270\2343r\255\364\270\367XO\350m\203i\350\002\024\254\253\2570\263\036\360\rH\025\325\275\306\256\362\344\025"
+	.string	"x\247\374K\336\377\260\004\223\307\035\220\306\231c y'\271\210|#7\032sy\327\316.Q\264\377&\253\035\300\352\017c\254n\311\2730\315t:\375\353"
+	.string	"\326~\377n\252B\372\224\271\2474\025\033\334C8\204$\357d\322\332j?\n\274\250\243O\331\257\276\334y\033\2175\251\226\353~\314O\244\177\223\271\177:\235\356\361\003a\026:; t^\221\242\2454\023\255\316\"V\347!\325\271\250:\013\251\316A\2533\320\320\371gu\366Y\235C\254\316=\2533\317\352\274\263:\353\254\3169\2533\216\352|Ct\266Q\235A\020\235kTg\032\325yFu\226\031:\307\f\235a\206\001\315NW\227\262|}\r8\177`\371\2668\037\233\005\310\372\300\362\255,\337\332\352"
+	.string	"\315f:_?p\031\261\371\213\316\351\3151\013\307re.\017oN\356\257\033Jtn\n\005\301\205\007\272)t\314\302w\270s%\335tP;\272(\\\272s\350\342Q\254\033\252\355\310\263\216\371\006\263\236\320y\225\327\352\n\320j\3235\221\214KTZ\223\223\007\201\367\355\243\225\231\225\262~\336\311\034,\0364\337\364d\343\254\360~\372\234\\\213\3544\002\034J\313\264R\305\275\261S\243\263%]\334\032\335\255E\222\250r\357\022\n\023\336\3262u\324\331\222\276V\331\244\375t'\355\023\2153\315\325zIM3\226\025\255}\022\262\233\371Y\353\204\243}zZ;{\241\325\341\235\304\371\340\333\355\201\265\364\241[\254\211m?\240\322\350\f\367\024\037\263\021BR\016\036U"
+	.string	"{p3\326\246N\364\322o`8\035\247\035\263\360g\213\034\247\030"
+	.ascii	"\316-f{R}\264\266\035\330Q\216\363K\250\312\226\0302\251\021"
+	.ascii	"\251\026\273n\247^\335\235\016\3359\310\370\214H}\330\322]\347"
+	.ascii	"\003\n\277\371~\272W\033\003\003<\204M\"\220h\265\237\216\244"
+	.ascii	"\225*r\336\333\324\311vJ\330\304\001\211\326G\373\243\351\215"
+	.ascii	"\314\316\3455\034\315\3202\231k\2537?\214\362<f\026\237b\305"
+	.ascii	"\213\214\220\266\371\336\032\303\343\300\217\030\261\371\021"
+	.ascii	"4\020\001\361'\360\302\304\332\006\215i\027\363\315\346Z\363"
+	.ascii	"~7\366\201\007i\233\302{\227\024`w\272V\233\005l\265Z!\253\220"
+	.ascii	"\265\325\232"
+	.string	"7\302k;b5i\276\231<\227&kJ\230or\002I\206)>\030\204h\200&\372'\250&\372\007\362\226\274\213z\344\212\210U\034\335\257\245_M`\304\231g\036\365\025\347U\367\321*\3633\037D\245%\342?\216\204U2\337W\264\302R|K\351\342\321\375\330D\023}\212\367\251\363\311c\302\305<U'\265\264\001\f\302\210g\022^\240\240\204TCFR\261\005LR#\325xQ\303E\nH2\204\f\202\001 \274(`\001\004\0248\201C\003\003\244\022\222.\250!\003II\351\204\0302\034\343\204\n3`\214\020\343\005\t0\212d$\275(\241(\206\022\215\242\023B<\303\004$\245\242\0323f(\025\301<\217\r\274\017\204\211A\270\240\307G27\223\026\001WF\326L\\hc\213\272\225E\245Q\277\367\032\207D<\2142\021\177\200\225\267\261u]\347\320\216\025\005\205\3228\321\267v\2540([\333\330"
+	.ascii	"\355\213:\351\316\303\372k\322\216\226\345\005\025\203J\243G"
+	.ascii	"+\315*\200\367\336[|'\277\026C\366w\321\316\314\272x\314\362"
+	.ascii	"r\346\027\023wl\022\032\372\231$C\037\344\362\240or\361\203\376"
+	.ascii	"\365\332\254\217V\241/\376\017\223G;\352\270?k\321pU\314\276"
+	.ascii	"\343\202\276\247V\31076\020\320\006\376\363\314\254\032\373\304"
+	.ascii	";\t\364\305\2457\262\317\377|;}9\216\375\022\032,\033\353\306"
+	.ascii	"\272\255\255\372\374\214\264\251Kd\315A\177\276\231\025G\003"
+	.ascii	"\207\004\347G%\327\347\233\374O$\016|\030\260\201\326\025\357"
+	.ascii	"\300\267\023\324'\371/\026\n;\307F\361(k\253+\236\204V\224\237"
+	.ascii	"\225Z\232#\273\233|=\273\324\232H\346\247\224FC\204\370\276\252"
+	.ascii	"\013\361.\254\220YHzzX\273\236\254\251\251\227\222\347\233\374"
+	.ascii	"5\034Y\333\372#\321\265'~\273\235 \201~\221\265&"
+	.ascii	"\222I\241;<\356\3272CX*B\264X*Y\357d\245\354\300R\241\342\306"
+	.ascii	"#\365\202D\347\217\3516\203\033\263x\253\037n\334\022y\037O\345"
+	.ascii	"\326\306f\003\324-g\347\245\242\bx\036,\336J%\303C\305\261=<"
+	.ascii	"\f-\222\204\211\337\301\342u\324Y\334r\346s\260{\377\302?\261"
+	.ascii	"{\217\343\223\254\025,\354\336^\331\316\234\324\006+\234.\317"
+	.ascii	"\264|d\034\263\370\343\033\343\246_\342\340:\002>#}]\272\337"
+	.ascii	"r\264q\305\365\244\361\300u\243\023\202\025\250\342X1KZ\250\024"
+	.ascii	"\215\210(H\222$\215\001\202\013\020\212\"YRkx\003\022 35J\203"
+	.ascii	"\3229\205D\002\221\t%\210\222$I\n\007Zc\005\f\320\034\013\247"
+	.ascii	"l_\027^\221\247\\\352\210\t:\025u\301\343D\303\332\220$?i\\\370"
+	.ascii	"\230\2402\266K.\303\256\005\324\344z\244c\273\247\340\001\020"
+	.ascii	"g1t\300\224\246\024h\031N*\354\331j\324:@\035\364\027\341\305"
+	.ascii	"\265\245\236\255HO\247GFGkn\321q\206'?\323\rK\335%z\306\001\217"
+	.ascii	"\274H\373\021\273\370]\031\236\326\374c1\237\236F\321vN\350W"
+	.ascii	"\006}\336\3563\005\236\2039a\016"
+	.string	"\334\353v7'\311\350\365\021\320a\024\266\376Z:\340}\352\2630\337\"\244%\363++J\254F\355\031\320o\274\311\022\245\330\211\206B%w1I\021\376\261P?\211lv\247\356\232\301\206\013r\263\321U\306\262K\2363\270\252~\026\021q\316V\210\273\221\326\023\267\234\220\237\221R\016\230\334\331\265\371y[\323Hr\335\354\300\214\261u\332\241\222F\252\337\\[\"tO\331\200x\270m\037\3026d\343\005\032&,\326[\004\037\021@\236G\3747b\3069\022\001\330\366V\226\231)%O\360\242Ep\261\277[-\254\320\023u\242\263[\306\t\b\007r\227\037\351\037\232T\234\232/q\033|\313n\007V$\024\037q\303\020hc\324\241\207\240I\353\001\023n\367\346\301\215\362F\034\215\222\r\2532\025\322\022M\354\024\210\315\263.H\016\034E\242%\255\246ao\260\007\241\344E\3101\356\254\2477\302Ar\256;X"
+	.string	"\222}\255\344\021\330\307\360\271\242^\027)U"
+	.string	"\272\210\364Q\246@y\233j\016l1\352 O\\D\2725\234\234vK\235 8Z^R\241vZ\347\275\362e!L\025e\265\334\002\260\210\017"
+	.string	"\025\222\207\342\n\246X\252\362\356\232oj\243\221\025\343\034=\203\275\314\223\351l\331*V(\364\316\242\034\\b\002\211L\344\247Y\224H\310\353\b\327I\362\347b\272O\305>\345\372\331d\264Uu&\002\224\351'r\237)\002\233#\t(L\024FxoG\242I\r\007;j\031G-Mi\202\251o\326U\273x\3639\336\326_\234\270\224p\2116rJr!\002\035\030aZ\301\302K\236#\226\022\310\007\274"
+	.string	"\3279\270\324- \310\032\266\252\256\314\315\311\241$\212\331\346\013\353m"
+	.ascii	"D5M}!\206V\bX\215IXp\355vz\263\375\0043W\326\001\370J5Q\034\261"
+	.ascii	"\220\021 \n\005S\271J\024\343\354\314S%\371\004\342k\023\273"
+	.ascii	"o\356\001GN\027>\316\350c^\350\337\006\002\226\232\027\257\376"
+	.ascii	"\017 \310\221y\t\273\303b\214\314pd\310\317\257\362\t\017\354"
+	.ascii	"\272}c'\023\2014\330\005_\260\307\236?/\032\023\240\373O\307"
+	.ascii	"4\fk\303\001d\0166\373)zN\231\247\275\020\233\256W\330\207\272"
+	.ascii	"=\003f\372Pa\017\312\206\3011\0268F\375\023\275\224\306^`H/\246"
+	.ascii	"\334+R\003GQ\331\334\346\214\007\340 i\r\031F=\242\346\254zM"
+	.ascii	"x\030U!,z\016F9Z\300\233\273\372\\a^\230\216\372hX\021\247\334"
+	.ascii	"*I\327N\335#C\207\002T\274C\343\235\232\177\277\236d\227\322"
+	.ascii	"\264\273\321\204/\331hAp\271)\b\366\277\341\020,\244z\344\361"
+	.ascii	":\024\230\215\021i\332}#\004\326\007Y\022\370\\i\326q\301\276"
+	.ascii	"\3008\343\322\225C\363\275\354\023\271g\007\376\340V\267\020"
+	.ascii	"\326\262\304\036<T\035V\n\003\371\266\234|\333\003\364&\027}"
+	.ascii	"\361d\355`a\"{ww,\2265&\024){\207\025\017\367\276\243\2361\262"
+	.ascii	"\310\237\202\004\300\372cY7\270\252\340n\231\321\224.\316{Jg"
+	.ascii	"\242\r"
+	.text
+	.section	.gnu.lto_blackboxInit.196.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\205\005\255 "
+	.string	"\366x\307H\220\232Q:' ,?%\253\371\256Q\220\364;\032\250Q5t\002\365&Q\007Z\2275\177\277"
+	.string	"\257\362\276m\003\206\215\362\326\005@p\013\002\201@ \3163\251D\255k\200V\3555\355!\251\225\031\374_\362\311&r'\031\255"
+	.string	"\253"
+	.string	"\262"
+	.string	"=\224\276\230\364'H%\261\201\004zK\262\244\332t\023'\274\356\206\363u\357$i\327\366\312\247Z\333\016K\317\245\336D\351S\213\365~\352\277\350\nJ}uw\204\327\305\235\257\267\0170_\313\0130_Wi\327\353Da\027\bF5\031\333tw\216\203\\\3515\33293k\311Ti?\3639\236\351q\035\201K\257)\240\315|~<\345\370Y\336\222N8\024\030q\272Ag6n61\321j<\355\007\f\276\234\371X\235\352`S\344:\002\203g"
+	.string	"@_y\353\356S\235\302"
+	.string	"\366(\235\371t\367\322\037\360\351k\373\356\036\331\335\017\273u\027;|\252/\360a%)\226\361Q7k\243\267\356\017\231\373+\242\035\375o\207/\370\360\361\322\376\352\037\016\231\004H\016\223pA\030vI6\025\333%\366(C\355\276l\006\262;\243\273\363\251\257\216I7\247\322\305\251tm\225n\315\244K\253t\317JwV\3225K\272\265\322-K\272\\\351\322\222\356\r4@\022\243\306\207c\272g\224\275id\2652\344S\377\356\367\307_\2658q3d\311:\266\330\265YE\3419j9\227\234\316-\301\250\257\033wm\233t\342\036\n\317QKIw\333^\213O\220n>b\003/e\030\341\325\205\222G~"
+	.string	"\021\"\204\371\312\214@L\207?\365\033\345\273\351\376b\231:\374)LKz\264l\317\224\337D\266+\342Z#\316n\237\205=\227w!\261\027\362\272:  \363\365\214#3\005a\030\226\254:\035j!yT\354_\274\232%\313\be\213Z\332\370\013\323P!K\206\252\362\375\225cA\332\013Y\241\022\364\277\022\346\353"
+	.ascii	"2;x\264l\035\244\301J\342T\215u\030\230\325/\364\332JF\371eT"
+	.ascii	"\261!\022\246\246\217d\276\3527\036\325\037\303\n\0262\f\254"
+	.ascii	"\251\030\225\335\244]\257S\330N\355\243\037\274\336\352\265*"
+	.ascii	"\261\257\260\257%:F\273{\2117\205\031BG\272#\017+\204\212\316"
+	.ascii	"\r"
+	.string	"\342\t\322Q\270P\241\007\267C\264+\022\n\"\301BGD[ \034\213\335\317\020\220\356\304O\256\310\204\216(\007d\244\"\207K\260;\024BF\271\243\335\316(g#\362^6\003\251E\025A\362\270W\313\341\257\322\370\003\303\341\034\033K8\016\227]Loj|\263q\335b\"\202\200\322x\027\203\006\363\277\032\337N\246\341>\343\223\017La\352a\362\214\013t5\221\361\2401T\231\233\031\332\300\201\203\371\312@\270&*x2\324\336>\3024\371\247\2705F\214\031E#\331\263\312a:0\020v7\327\177`:\\\271\242i\"\343\035\207c&C\255\016\227\374S\364\302\\z8\230/\001s\250q(&\225A\f\021\211\004II\013\323\001p\002\231\241\263n\021\340%SS3j\255\355iw\300\220\306\200\314\"\257\247~\210\250R\354\360\032D\347\311]\022\344\031\311\341#\227\272j8\355\262\316\374\324\347\277c"
+	.string	"\367\363\230\267\352\277\360r\364oH5k@}\300\202e\002\224+\3427O,\224b*H\203B\362\316e\310\301\265\211\232}(r\220,\234\325\3474\362IC\265\217\300\0077^\275G\307\364\226E\244\304Y\020&\376-"
+	.string	"J\302\233\272b\232\204C\200\301\217\352\351\255\224\263\332\257A\202\242\035;\342\203'o$\017\351{*(\203:\302\223\037\b\300b\364\016\034\306\262\360p\346\037%\353\352j\272\001<N\274+n\264\007"
+	.ascii	"L\350\206\324\312{\fp\271\222p\215$\235o\364t\305O\200\370\215"
+	.ascii	"\317'\362\305M\203\211r\367\3057\333\310oa\370\003"
+	.text
+	.section	.gnu.lto_blackboxAdvanceIterationTimers.part.0.318.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"]\t"
+	.string	"v\020<70\221\322\001"
+	.string	"\257y\371\343\020u\215\002\361\\S\303!Q\3125]\254\232^\224k?\366\3344\274\031\030\367\310\\\n\n\302dZh\225\006sPAh\207'\233H\231R+"
+	.string	")"
+	.string	"-"
+	.string	"kB\200\275`\244\330\354n<\324\220{\327\314<\377\3379)\225\351*\240\332x\016<\003X\330]\007p\334\360\266\023l\037\330/\b\253+;\323\231\351k\371)x\354f\304n\026\004\262\224\330\377J\366\346\177\236\275\035\336\304v\311v\275%\262\032\366l\027\201E\372\213\017T\306\214\"\272vF:\\\374\221\346\237\2745\362ILA\312\247\016}\222v\330\221\2519e\314_y\265\304l\302RY\326\354Y\346<\025\035\310\201\373<\200bD\303\007\"r!Q\364\030\270\223`\b\305\211\256\013\305\355\331\352\312\234\327\f\314IQ\252,\333\251*)\232\217\264k\006\030"
+	.string	"`\251w4F\311\n\214\007~0\304 `J\257\275\302)\260\003\215)\205\037H!\247Z\001\357\001\024.\033S\214\2159\r\004\246;\r"
+	.ascii	"\327^L9-\247_[\306"
+	.text
+	.section	.gnu.lto_blackboxStart.part.0.396.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`B\004\345\033"
+	.string	"6\356\246G\220\034U: \0361\034\036\265\201\375X\017\031[<\360%2\236"
+	.string	"\304?CcsH@0\232t\n\237\302\352\367^\266\013\217\220\005\3762\312U\300\225@@\232\330V\273\004\003\363\266\227 7\005\343\031\354\332\233\354\235d\211"
+	.string	"\216"
+	.string	"\227"
+	.string	"\037\332X2\204Y\367\241\026\341\204\333\030Q.\230\364\304\276\225_1\372\320f\n\263.An\212\230*T9\013\177n\273\265\272e\035\301\2755o\340.\031u_\b\343\301\016\001\205$\244J\316\371J0j\037x\353\346\351\003q7\317\355\251t\367\rG\343\356\250\013{Y\201S\221\306\220*\347\354\272\255G\216_\251\211\373\364\324\035\275\276x\272\233\262\222&\213.\307i\201\233"
+	.string	"6\344\234{\245\343m\337\335\032\272\333C\267\311$}_\213\0301\342\336F\350)q_\336\3640$b\364g\227\276\320\355\1779\230\022\254\373\332D,vo\033\364\224K\264\252}~J\307\036z\340M\346N\370\203g\232\365\364r\306\375\354o9\027Y\337w\333)f\364\347\354\252`A\1776kF=\352\003\037\300\270cZ&3\245C\253\221\256\346\315\\\221\272W\264M"
+	.ascii	"\264\353\245M-\355+0\311\354\006\b\311\371FU\235\314\263^\226"
+	.ascii	"\030\263T\360AQ"
+	.string	"-\275h\364`\037K\b(d\367-E`U\315\231\3749\202\221\320\237\265\336x\271$8\313\244\233\277I2\005t\241\200\224\0041@6\2212\363~\231\267y-\201%@*/\374\2214\211s\033\306\035g\226R>Or\320\332_sd\r'\341\037\376\335[\253&\002%p\f\345vc)\230\n\375I\353\201<\031\277;\307L\351\364\003\332\215\2258P\343\020\246e\262\366\321\374\b\324!(\350\336\322\2473\211\243U\275\200v{\370P\205x\271z\324>?\247\327\355\227\371\323\013\004\fvo\03549}\214P\215\242\002\212\030\205\f\0260\264\016\310\212bE0\233\254\305\252\207Z/h'T\f\305V\234p\265\230\305X\270\206\210j\256\226\203\246\271\220\021\271\212h4\"\027Ow\323\233\271\"\365\006\\\315u\237\370\037o\t\007W\253\021\252\367\355\374\216m\007\346\301\343\336\"`\003D\302\233&\032\323Q"
+	.string	"Q\016\216e\262v\347\324|\340\037\205\200T\276\030\025\247\370\367\242\236\216X~\033\304)&K\251\333\356\211g\341\234\230U\316\016\326C\331\364\350+?E\013\342 x\310\017\221\372\032?\236$\325\232|\005k\250Q$K*\244T\311\210$IA\212\305p\002\231\271#7\022"
+	.ascii	"W.g5\323\376\237\001hT\236\241\210I\034,\356\261\3155n\247\312"
+	.ascii	"\3514\321-\205\246\350@\340\245\225bq!5N}vb\341\252\220,\302"
+	.ascii	"\223\277W \024\206\003\\M\023\331\355b\2179\026\235B\302HJ\234"
+	.ascii	"\362\313\306\227\354\035\231\027\3142\323\026\200\200@\361\207"
+	.ascii	"\206\347\371\320\236\200\276E\006>\001'\261\364\3162\022\034"
+	.ascii	"|\344\341\030\\p9>\236\352\230\026\341\375\364 \234c\203\336"
+	.ascii	"\343\320r\327b\213\201\313\f\f\350!7\325\306\303\232\331j\200"
+	.ascii	"\t\030\362\302_0\333\032$=\t\346@L\252f\306\305\333t\030\356"
+	.ascii	"I\266\255F\217\033aI\206\027\201\276\003\223\376~\277dG\2552"
+	.ascii	"\233k\n\300\323\224\334\365K\257\020\250"
+	.text
+	.section	.gnu.lto_blackboxLogEvent.part.0.397.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`t\bm%"
+	.string	"v~\333G\200\234Q:_\027\322rHk\024\223oV4\177kL\302\246\022\260\272\232h\32188\300\n\344\210\177\240@TX\220\037-\036de\033\316w\237`5\030\003!\242\322O<\320\260\227}F\006[\355'\261\204\220-e\n\300"
+	.string	"\262"
+	.string	"\320"
+	.ascii	"\347\237\307\250\376\333yL\375o\247:\336\342W\222m\026;K\341"
+	.ascii	")*SaQ\004t\257\246\300\360\241l\376\210Rq\330Ty\274\304-aWR7"
+	.ascii	"\037\317`\034E\345\260\251\247\367\006\301Rv\357\221\001\233"
+	.ascii	"GB\331\3241\200\223\315\222\207N6\177\206\362\237j\353\352\017"
+	.ascii	"\207\217^\267\b\371$K\f\317\275\267\307\246\035\302*\337l)Z;"
+	.ascii	"\315\3226N=\267\026q\310\267)\027\266=i\211D~\241\005jg\216\230"
+	.ascii	"U\352\356\2757\"V\233,\314\276J\036c4\r\362\213\234 \305\035"
+	.ascii	"lu\344\270\302\321\302F\264:\323\"\027\031\007\331\332Qk!\306"
+	.ascii	"\325&\334{\317U<\370>\374\037\315\377\247\037\025\020`\300\234"
+	.ascii	"\303\344\276\300\351r\366\342\303\305(&\3115^\236\226\363\226"
+	.ascii	"\303A\357\035\262\217\363\324Yv\331x\221X\222\334{yX\316>~\276"
+	.ascii	"\202\036/\217M\266\345\305\321i\347U\207\265m\255\3451N\263\322"
+	.ascii	"\252\222<u\262m\373\316\302a\325\311\363Z#\327\027\343w9\177"
+	.ascii	"'\022\315Z\327]\331\341y\214\231\310J\343\314m=m\273nq\\^\313"
+	.ascii	"\365\337\372Dg\177\350\354\013\331\372Ag\037\310\354\377\230"
+	.ascii	"\375\034\332\367I\3738\263\177C\3736\264\237\326\372\350\331"
+	.ascii	"\257\235\375\363\354\233,\306\\\232}[\366\233\217\314\274k0"
+	.string	"\003f\367\316H\356\271Fs\013\222?\335\302\247\200\315\217\227\234\217\315u\025\223R\017}F>V\351\214K\355@\343\354\257BQ\301\3240N{\226\034\232o\347\205+\273Y\233\275Y~\223\225v\231\351L\255\315\026\241a\371\260\352\344\177\n\214dR\302\3433J\255\322\331\032f\031\001Y\221\353Lq\242V8\245\315U\347\371_\201\353\244\330Y`:>\"\324\356\316\300\2700o\205b:\251]`9qj+\223\023\003\277\321\300n6\234K\314\230\267*)m\327\232$@\233\366\347\320\341\367\300g\037p?\bf\023b\307\346\336\273\264F\305\357l\204\3153\213\223M\323\246Q\310\326\037\\\306\274\362(3l\264[>Y\221\253\212\265]\277\232\263\2254hf\316g\216\312\344\021s\036C\300,\347\001\023H\200\nF\375\234\204\272\023\302_T\t\340\221\216D\360I7\"\250\003BU \360\223\372\001\313\003\035"
+	.ascii	"\177\r\"$A@\"\222\202rR\341d\276\tiEP\204\211\246\337\223\210"
+	.ascii	"\036T\211\337\211^\2230\252\207d\364 \n'aO*\030\024\366n\377"
+	.ascii	"\233'TY\253\363\025f\233L&\2217\333egk\001'!4\221\345*}C%\016"
+	.ascii	"\360\272\027\213\265T\032(V\006\005\252\r\365\306\003c\013;\374"
+	.ascii	"\203\376\325\035j\217f-\"\313\253\321\312\016\321\3220o\325c"
+	.ascii	"\3033\364\243\213@\232\250\n\331\r\331\364N\031\346\255u\322"
+	.ascii	"9BAV\310\362\025\265\253e\250C\226\274b\250GvAv\211H"
+	.string	"\034 \"\255\245\026\351\027\352\021 2_\230\267\212A\217\372\347KU\262\244\261\324&\001\200\250\250aP\344\034\"\031\021\021Q\220$I:\340\002\021\032Z7\021\300,\007!\243!)l\262\337\001u`'e\036\232\320&kIy\370GR\034\np\322\006~g\030\265\223\241\375\221\2603\362\366\356\350a\221\023@R! \325\3151\302\354\376 \273\314\002hd\240\247\214\203\341\376\345\f\324\006\335\360A\247\355\230P\367\330\032W>V\334\214c\347\"\354R\005\274k\243%\303\273\330T\r\363`v\345\266\333<7;\314p\365\216\363[6\370\365\251\307\016\342\302@j8H\261\020\242\237\252:\302\003\207w!&5\2539\302_4\364r\363:\247\350\265\200\363\362\031\233\017.WH\237\213D*\367\001Q\371m\215\324`B\237\177k\353i\350 \325\b}\241\024\243\337\324G\344\253\243\"x\022\346|\326\272\353\206"
+	.string	"\336\336\305\026\267\r\3225 w9\227\302\234\222e\3277\177\327L\327\036\244\020\303@k5\036E\006q\306\347\234\374Qb&\204\020+g \363[\203\343\036"
+	.ascii	"\260\374\272\346p2T\212+\205\255\311G\236\361\315W\370\333\211"
+	.ascii	"\f\220:\344\211\025\252\221`\202\323\027\030'\323D\032"
+	.text
+	.section	.gnu.lto_blackboxFinish.part.0.399.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\350\001U\021"
+	.string	"\006\336mI\340\262(\035\210\251\257d\372\352D\255E\022\342\274\266\020\030\306X\342\215\224E\035\023\267\243\023\233\274EK\3728\325\276\366\266{\277\005\222\035\223m-\022\306y\345\030s\020Jb \334]\020-\016!1n\371k\262\311\336)\005P"
+	.string	"Z"
+	.string	"\\"
+	.string	"\257\337\007\200\257\376\r\353\276\255e\217|\233\313\036\275\376\205\355\226\213]\266\356dm\017\364\250}(\207v7|\245)\356:\235\237\313\267}\316"
+	.string	"\211\375\360\314^\247/?M\b\335~xf/\237\002\376\215\230\354\256E$\356z\333\022lO\260'\205K\362JB\323\363y\315\"\223\306\230~\377\226\302\330\337\364\3019S\342cWD\217\310\322*\016\025\376\315K\326a\3709t\204\216\206\302fw[\307Y\225<\220;{\311\203T\360\332\201\305\003:\177\363\311\307`\035g\365\221;3\020s\261\303fh\227\\\360j\223\350\265t\022\030\271\021\267\003d\313\321\227>\335\006\252@\351\013\257\221B\252\355\256\203\236\323P\361e^\2752\316\313F\360\225\026\221\005\301f\317#\323/[4\314\313N\377B\213\321\227\003\350\360p\273\240\227\177M\367#\2679\177\b\035\241\025\273!\243\257\300\337^\202\325\270|\006\r/\267\223'CD\013F)A\021\031Dh"
+	.string	"\301D"
+	.string	"\245\022U\0256\240XD>\2318\214'*'\021\303I\310\222\"\256\204\247TKhB\3401\003*\025\252\3061\025\216l\317\177Ka\f\240\246\204\017\214\306\354\337~\333\017\242\247\305\356\204\300rL\231M(\215\331\271\217\373\215\225/c\013\242\b\276\222\202\234H"
+	.ascii	"\244#0 `\002)i\210\036\250\375\317POM\212\221BB3\227`D\361 \013"
+	.ascii	"$lFf!\241\026/`\203\315\006\225-\215F#\211[L\034\362}\0178\211"
+	.ascii	"\031\2658\016R\3106\3449\344\022\215]<\0239\026\352\006\346\261"
+	.ascii	"7\f\233 \372a~\270\020\024BT\274\367B\265<VR\371q\330`J\226\026"
+	.ascii	"\312\312\333n\001\254\2750)\267\377\2040\006"
+	.text
+	.section	.gnu.lto_blackboxUpdate.part.0.402.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\025\004}\033"
+	.string	"\206n\247H\260\230Qc\250\226\206\245\262\230=qY\200\007P\320\375\b1\202\3103\002\277\b\002i\270\250\274\331\274\367\2606h\333^\376\023\212O\277\254\345\335\303sC\037\212m-cg,\030\212\236\255A\002\005\b\334d\313-eJ\001\211"
+	.string	"\217"
+	.string	"\225"
+	.string	"n\031w$,\022\234WFO\205\216\f\224\376\364\217\334(w$,N\340^!\243\246{\317\b\267~\221\267>?3\336\22270\336\332/b\033\327s\316\376\362\023x\023\f\257\200\220\204\367^\330m\345\361\334G+V\312\312\3714\345\230\322\324}d\335l z\301T\2326nii\326\270(B\220\202\"f&\310G\3312y\264\0160]\210\256{\357\217Na\230;J\013\234\305\272\271\367\232\274q\223\267]\263\215c\213\032\002\342\255B\366\317\337\222\324\"I]Y\324t\244\276"
+	.string	"\032\254\261ro\320\360\352\372\254\323\017'\333P\300\331\346\322\235\300 \336YcC\241\307\266\237\300 \026\320S\020v{\373>\323\233z\214\202J\316\324c\267\226\234\\\b\"\025\221\272\0369ex%u&>O\342/\271\020|\202\273\322\315\305;\257y\245!\224\021\341\275g\315m\213\242\f\"}\320Gz\222\317\225n\342yM\004;\"S\214\b=\220\267.\361J|\252\177\204\263[\376Q\316\001\325A\200$+_\325\324\227~\340\227\247\250\353\344\033\302"
+	.ascii	"\021R\001\370m|\223\273~\216\376\030N\246\257j\352\311\347\343"
+	.ascii	"\373\322\001$Y\365\252\244\034\345H\021P\214\215\264Z\021\372"
+	.ascii	"\355\240\312\302\305\247\362*1\277\207e3\372r6\336\322\332\200"
+	.ascii	"\b\307\017\035\372M?\321\230!\035\212\364\204T\365\364\336\253"
+	.ascii	"\253u\310\266m|\255%\351\302\243d\034\200\022x\316h\243\320\241"
+	.ascii	"/_1\370xU\3473\371\315\210\272\324*\n\r\t\274\275[\232\341\020"
+	.ascii	"JG\313\320:\344\312\n3\236\030\317\207\333l\207\364\t\233\023"
+	.ascii	"1\t\026&Tx\035\260\205\230\351\344\200\340\331\231\325j=2\001"
+	.ascii	"\226\275V\320L\240\220\305R\230\200\355\344\304t`\262\232\r\366"
+	.ascii	"b`\232\212Y\r\306C\243\325`\255\213\267\n\225\277'\250\237\272"
+	.ascii	"\363BK\337\350h\231\261\016\375\204(\2406\207\016\273 \026\001"
+	.ascii	"\265\325\376\020\202\276\264\253\313/\207X\267\274\234\032\277"
+	.ascii	"`\254U\254V\n\020\215\035\035\232\376l4\271\324\317\225\373Y"
+	.ascii	"\256\345&\002\007g\274\235\341\242\343\001\030)\264\246\250 "
+	.ascii	"\230!\207:\226\021$J\224\030okb\250\2214\347\210BHND&HRPh\003"
+	.ascii	"\200\002\021*+;\021\3401tE\205a7\332\320\004Bb\020Y\221\200\212"
+	.ascii	"\255\035W@\275\b'$\022\353\332\020\346^W\234k\244\334\315\213"
+	.ascii	"\213\230\374\006\231,2e\251\232\"\337\266\214\351\304\034\030"
+	.ascii	"\301$2\221\034\266\305\354l\004\334f\225b##0nk\227}\207\260*"
+	.ascii	"\320F\377\270ciJ\033\251o>\030XS\347\242\036\n8\261\266k\350"
+	.ascii	"q\360\3629\032\272Q-<X\364@\273\371\374 2N\214\333\237\212\231"
+	.ascii	"\025\224U\225*\240;\033\\s\037\257\246\013\326l\323l\275&\216"
+	.ascii	"\361\267\2778\321\224\214\320V\202\036Y\027\007\263\223\347\377"
+	.ascii	"\254}\315\353\350T\325\232\346\236O\245L\257\200\276\005\247"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`T\037eX"
+	.ascii	"\312\212`\035S\200\f\352B\007\377?\243\354\027m\272\321\2263"
+	.ascii	"\350\367q\317\310\215\034\256\r\242\373\277\335Z\020\006\306"
+	.ascii	"\232\321\375\310F\356,\207\240{#V\216\216r\003m_u\273\201\273"
+	.ascii	"\317!\270;\f\323\351\035\206[UVn\351\377)\314!\361\300DT\307"
+	.ascii	"?\241\366\244L2\303\001\267\001\303\001\273\030\270F|\2213\215"
+	.ascii	"]\273\355v\260\263\301\207\n8\314\330\266\333n\004\033D \301"
+	.ascii	"\006\023|\230`\347\001\016\031\354e\020.:\317MF<\345\017\367"
+	.ascii	"\341\340#n \274\347\026/\"\306C\334"
+	.string	"\312\030F<\220(\036H\026\036\212gb~\021\377\203\327\330E|U\213x\036\314\">J(\036jE\374RP<\r\346\375H\001\305\317\370\211\035\244\"\266\nN\021\033\005\357\334\004\212\227\270\361\211\027\335\204L\304>\301\\\"\276\007\223\210L\305>\274\243\207u\214`&\021\274$Y\204\020\374\304\343\034\314\303P\274\343\033m\214\304\306M\027\260\323\032\333P\343\231\306Fh\334\273\261-y\226\370',L\343\354RC\217\021\240_\211\337\301V\256\"\205\277\250r\"z\263\017Qy\214)\007\272\225=\005\n\377\271\235\020O\305R\270\305\220Y\220\261P\024^1\306AB\006\022\343\2370VQ9\005\030\243\b\362\t(\\\342\213I<\341\036/\036a\002\213p\302\262\t\363\272\230\207\353mL\316\266\344k[W\273i=\355v\203\002\370s%\361N\274bNCY/!\376\006\267=I\274\022\222\013\335\034\270\013"
+	.string	"\262\342}\032\234\310\217\304\377\270\201s\031\211o\302\340-n$\234\tV\274\216\"gA\344+nW\361G<\344O\254\342\f\013\211G\nr\031\t$\241M9\215O\342\021N\002x\030@~\342\307\265nU\017\242\212\267\301\375\343>\216\"\327\004(\352=\342\215x\352%H\035\t\004\347q%\335\326\326v\365\250\370\336%\220C\255\332mw[v<\336\017\217\335\270k\344\347"
+	.string	"\354v\273\335\237\342q\360\356f` \272\003\351\372\246\236g\241ot\027jhf\0167e\344\232\205\206\251/\262\315\202\205n\221\237\273F\323\n\314\3204\203UI)\352T\227\244o\376IhS\262\216\214\270\327V\323\344\033\370E\304c6L\313\365\311\250\260^\354AY5\251\350\247\236j\223\374o\376(R\020\025\304.\327\034\310\017\223\227\353\035\352\241z\220\026\320/\221_\024)\034\244\316\304@o\352\215<\216\bZ\217\034=\002_eN\273\226k\030\3712]\350yr\335R[\344\266\345\372\275\231\334\n\263\250h,\333\314"
+	.ascii	"\215\223o\253%\"\200v-\246qt\257\202\346\220U\013\240\037|K\231"
+	.ascii	"(\\qK\353\352\025\356\234\304\3153n\031Zc$\026\356\227y\230\032"
+	.ascii	"aL.3\013w\013E\343\376|\016\220\017\3354n\027z\003\212\234"
+	.string	"\b\255\225m\260\310Q\301\310.\240D~\361\0259\306\223\3100\274\"\3130!r\221\223\370%M\342\203t\305g\341\212?c\022\177eI\374\325V\374\020\255x!J\"+\225\020\031G\222\310GH\"'eE\366\035\211\3743\022\231\210\204\3103\260\"\327(\022\217\205H\344\241\253x\264!\221wV\221C\b\211\267\n\022\331\207F61B\274\0310\276\n\220\370\024~\304[\251\212\207B\025O\305G|\260G<\330T|\225\212\017\343\021/\026\025/\204\212\037{\212\217\"B<\331\216\370\241S\274\224\246\370\023t\304\243\300\024_\266\024?%G\274\t8\342\233(\305{\375\342\273|\361_7\342\235$\305o!\305c\035\305\223`#\336\310\214?b\024\237\325\213O\362\335\317.\277\222Y<\320\016\265\003\345P9\320\243\265j\n\246\016\325\231\273\265j\fR7kd\256W\221\326\252q3i\255:F\276L"
+	.string	"\240\020\035yo\255z\201\242\265\352\033\365\376)_=3Ko\\A\330<\250 \350w\b\222\033R.\204\325\304\312i,\355\035\3367Hb\253\306\314R\226\252\242\232\342@\177\0313\236\310h\361\361\242\305g,m\234,Z\3321\364\002\214)5\275\306\322\246"
+	.string	"\370;%\331)\345h\350\227\315\027u(\247O&\211r\372Uu\323r\372K\362\213\345\311g\3520r|\363\310hF\032\202\364\200\202\220\037\350\316\364 ;\324\313\214\200\342\263\241\352P\f\363F^\2505\3646bkY\270\031#\277]IB\230\036#\247?e\344t\223\315\023\340\304\354\204\013\341t\013e\025\225\232K\262\215*\032=;\raQ\271B\315j\231\034N\026\002\301\202t\323p\232\203\274\030\340\024\0178"
+	.ascii	"N\263\224d\201\323\247\252O\262\005N\377W\251O\036I\306\032\347"
+	.ascii	"\337\303\342G\325\007\364\003\311\201\334\251;\323\303\304@v"
+	.ascii	"\240\307\tc\002\322\251\3370\246\037\247\232\032\204\3235\223"
+	.ascii	"f\346*\256\362\3404n\336\005N\313\310]\303\351\027\336\fN\343"
+	.ascii	"zg0\256\252.\233\f\3752\277\"C\273\004\337)\302\330\300t\031"
+	.ascii	"\272\005\370\245B\304\023C\227\241kh\246M\347\246M\343db*L}\220"
+	.ascii	"M\267\314S\233\326\261\351\r4\204\2561P\251\353\013\363\275\333"
+	.ascii	"\355x.B\3274u\204\256id\217\256q\324G\3272\225\204\256ed\t]\307"
+	.ascii	"L\023\272\2069\241\353\027\024\272~\241)t\355RU\350\332E\376"
+	.ascii	"?\001[3\317PgKE\007\325|\205-\336\2107M\321\007\300CI\336\211"
+	.ascii	"\252I\311\035Oc9\246\323\017h\265\303\276Q\360\003\340\207^\335"
+	.ascii	"\263\035\366\006\036\335!\327\241\332{;l\231\336\227\nOW\324"
+	.ascii	"\214|Q]\265\035\016`\306\304'\200\035\0360\204%v\021vH\344O;"
+	.ascii	"\354\030\256%k\230\336\257a\311V\313\247\365{\216%\353\367\276"
+	.ascii	"\226\214\265|ZJ\373\204W7\312}Z\276\255\035\333(\335B\317\264"
+	.ascii	"c\335\302\023\356Xw\350\235\2003\035[\033,\254\260u\202\177\224"
+	.ascii	"/\337\020\r}\357\331\n[\307\303\001^\340\211\001\303V\3305\274"
+	.ascii	"\334\n\233\006x^\"B\305R\206\025\366K\360\310\326\025\266\013"
+	.ascii	"\260\256\330\212\025k\027\336\326\r;Z\215\266!\013\204a\351P"
+	.ascii	"KZ\257\255\375\022\374&)\022\203g\273\352\227\026\254\337[\260"
+	.ascii	"\226 G\357\253\304GT\222\206\375\352\230 \327~u\213\\\265}\322"
+	.ascii	"\n\034\350\3622a\244\f\0207\257\264^\235\353\315\254W\001WAs"
+	.ascii	"\327\326\253k.H\335\266M\034\353\3257\3643\326\2531\360f\326"
+	.ascii	"\253\027\270A\024l\331\256~\361m\327\177\333\325.\275?G\211\242"
+	.ascii	"\257e\262\\]\241\312,\223dUlVU*)5\351\3234r\252\263\211.\311"
+	.ascii	"\337D\242\025\214j\205\236d\233h\364J\255\"\313\346\220\n\253"
+	.ascii	"\230\fN**U\241\244\323\\\242\277\332>\331Gmi\363\212\331pH&\024"
+	.ascii	"\003\243\301YE\251*\225\224\252P\363\211:\315&\272T\177\365'"
+	.ascii	"\221(\037M#Z\271'\331*\233L\233h\364l^\241\265\212\334,edbA*"
+	.ascii	"\251\247\246\272D\353\1776|{\026k\202_\250\302\210t\"+\235\""
+	.ascii	"\031\221$I\322\030\242\f\be%d\270y\022`\302P\013\262(\260\004"
+	.ascii	"\"\201\214\210\210\314\003\224=\007\024\224\023\232\263:\024"
+	.ascii	"\006\340\206G\363\001Z\250f\013\330\305\270\241Q`\317\270\f\324"
+	.ascii	"\003\bZ\374\325n\202\217w\3704V\005}\300\177\3462~\2024p{\217"
+	.ascii	"\306\365\002M\024\231h\034\034\005\265\336"
+	.string	"\023\323{c\243\335\355\246\027|_0\241/\301\247\275\374\025]6\267\005b\034\017\370\303\253\375x\225\361"
+	.string	"^\200\016\266G\227\201TP\023x\b\214\230\221y*\203IZ\253\246\341\241\212I\201\037\352\213\302|\036H\200o\035o\005\326\177\325\367\303a\336\250\357\277\315\266\3722E\231\002\362)\364\037\320\241\\o\033!\202\261\324;\033\215\321\002U^M\370x\357\225' ?+|\213\365\345 \r\020+\001\370x\357}\271\316\363\234\277\327\235\212LM*\013\213@\241\034\212>!\250&W\216\\\227\265\261\266Q2\263\337\231\317\025\004\336{]\227;\025V\267o7\217\200a.\033`"
+	.string	"\t\013;%\317\n\200\027C\205\231?9d\312\220)S\013\004\225_\363\034~\207\252\2576\330?\217\3342"
+	.string	"\247w\203N\206\201/\330q>\030\310V\367\253\317\351 \r$\201G\334\361\207\025\2708\300N7\255\300\3239\210hy\f\025\020~\177\006\334\215\217+3\262\3504\316\323$G\322u\321o\336\204\221q\216\250\261\370\200$\274\2333\372 \352l\020\262\347^\033\320!\276\213\366\033\004\377\337\302\212\246i\231\031\314W\204\322D\211\265\002\310Ld\312Q\360\236\007\253\231\3410@\025\017\237'D\331"
+	.string	"\007\033M\234?\204\365\222<\263\030\270\224\344z+\340\342hS\324R\024#\307\305\013\3678\004\254\022\024\227Q8\335\355e\276{\226w(\221\024\337}\377-\b\234P\205;\313\227\334\002\236?(}\275G\t\320\307\234\372\225\251\206M\255\212>\321\343\365\345&<\0058\372\025\002\353\274\276\3639\007\332\346\227E\265\303\005\277o\311~\003\333\212NG\"zW\207\300_\200\303M\252\362Hq\022\303\022\210\210g!o\030'K\024\3535\bt\301$\024\334\364\353\253\b\304\304\337\321\346\250e\266\335\013O!4\032(/\265f\205\234h\027!7}"
+	.string	"o\222\311zA2k:\313\300\365\205\216\374\250Y\231\244E\321\024-\205\"\331\233"
+	.ascii	"\316 \026\260\347TO\t\371v\226\363\354z\"\243x[\366g(\343'\263"
+	.ascii	"\221<\\m\344eu\323\037\257\030\336\314E\3623\266\222W[\311~<"
+	.ascii	"=\360\264\225\302\247[H}\255*\372\343v\371\203Q\017\037N\265"
+	.ascii	"\001\013\300Vp\253;\212\025\t\217C\t\267&\341\272\347\004\005"
+	.ascii	"\251k{\344\006n\2020\035\211\276Hh\273> \351\2543\211\337\306"
+	.ascii	"Q\355\256U|\354@+U\202\223m\331\373y\237F\r\225\324\344P\364"
+	.ascii	"\262\264\347\335\336\377P\214\332\327\326P\203\r\ty\334\215\375"
+	.ascii	"V\302@\276\342\"-\003\251\342\005\367\377\003\370\227\367\311"
+	.ascii	"\277\177\363\311\327#\323/BCS\003\324\206;\3712h'\226\335r\323"
+	.ascii	"{ \330\343\273\204P\204\250B\320\3579\275\256\327sz]\257\347"
+	.ascii	"\365\272\236;;\306\231 \346\261\260{\361\202\337G/)G\214\235"
+	.ascii	"\210\271\323zx[!FJ\177\222\205@\230\265UM\246\003Q\330N\342\006"
+	.ascii	"Q\324\376\2647\264\\\037\321\264\035>q\213\313V)\350\341\276"
+	.ascii	"\025\003\034F\3109\315\235>\266G\371\214\255"
+	.text
+	.section	.gnu.lto_.refs.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375`\226\006\375#"
+	.string	":W\350\016G\220\234M\032\003\320*\200\204Y\215\177\243]D\207\02200@k\"\021\270\313\222\030\243\002*b\013"
+	.string	""
+	.string	"\211\241\"a\201\327\210D"
+	.string	"X\027\324Z\003t\024\3035\340*\006\331$\212\037\2665\310\220\266d\233Z#d\313\024\315"
+	.string	"\336"
+	.string	"\342"
+	.string	"\263\363c\347\272\361\030\37047"
+	.string	"\372Q\252\314\177\252\334\2272?\252\334y\346C\231\364\006\346?\231\217\300\374\002\346'\231\177d>Q\371\247\371f\371C\346\007\231o3\177$?\f\037\n\272\247\334G\334\327r\027q\037\342\036\304-$\233Z\241\3554\013\213\334\351\025\371\253F\312\021\0379f\204\277(\352\004\375q\302\337*\374\004\341\027\205\037\336\200lW\333N\263\355\241\355\251\355\037\320\347\233F\276\214|J\336\363\2554\356Gu?k{\256\366e\335ou\267\325\275\247\356\265\3564q\217\321vV\357\t\367Z\3704\\\331\367R\261\337\355C\355'"
+	.string	"\337"
+	.string	"\370\003\276\251\354\242\335u\373"
+	.ascii	"v\307\355\007\355\376\263\373lwp\237\356\213\037\326\bWj\373"
+	.ascii	"[ZS\355g]\365_ME\237\252W\333y\265\207\352\355\017z\257\340\251"
+	.ascii	"\177Z\352\231z\373R\357\215\366\237\332.F}\310\373\330\356im"
+	.ascii	"(\241i\r\bO[<x\252\302\301\323\023\r~\3630\370\275\263\340w\216"
+	.ascii	"\202_8O\277m\022\374\2069\375\212i\372\365\202\340w\313\201_"
+	.ascii	"+\003\277J\230~\215\020\tR\340w\307\322\217\005|\002\340#\021"
+	.ascii	"x\235\322\347\224\036\227\364\267\001\377\203\364=\002\276\036"
+	.ascii	"\035@\367\347\205\266\177\\\266t\221\373\227\305\312\376\327"
+	.ascii	"d\b\020\0378l\320 \3773\201\307\316\225\023\252\260\255\360\241"
+	.ascii	"\302/\311\277\221o#\277\332^\264}\314H\367\355\334\177N\272x"
+	.ascii	"\322A\242\377n\027\305n\"\332\021\334\276\300\371I\347#\235t"
+	.ascii	"\243\363u\347\017\235\017t>y~=?\373\030\264\213\275}V\333eO\355"
+	.ascii	" -i\005\362\312\373\331n\227\355\036\274j\247WM!\266,j\007\243"
+	.ascii	"\236\356v\3027\210\246\356\240\231\372\240\230/\\V\340\023p\211"
+	.ascii	"\021\220\307\\\036\314q\326\2036`\200*\336\362\037\236\265\374"
+	.ascii	"G\347\256\377\332\2349\313\177a\274\272\264\254\2400A\"\244\207"
+	.ascii	"\216\261\374wC\306W\376[q\347\215\031\nf\256\337.\\T\244\230"
+	.ascii	"\034\001\362\326\257\216\244_\0322\276\337\024r\266\362\273I"
+	.ascii	"\363\375e\276\224\376\256\247\254\365\020\366\237\366\235\366"
+	.ascii	"\231\316\242\343\256\362Bc\275\317WON\345eu\t\2757F\375}\341"
+	.ascii	"\242\356"
+	.string	"\313\242\212\373\232\020\351\324}9c\302\f\266\325\357%\356{\021\177\254\372Wm\2657\325\375@}&q_\022_\300Q\375\241\245\274P}\240z\004\363\265,\265\037\377\206\036\207.%\361\355\304\333\225x\273\237\373CA\343\216\230\275]RI\212\320~\177\364\250\355\313\243\366kcF]\026\267\241o\212q\337\022x\352\316\231\r}8l\302\352\222y\r\3750`\276\264\214\265n\224\303\350O\215;\257\356PuW\300{\247\246\372\006V\363L\365\223\352\216T\337H\334\211\304\277\325\247\215\377\215\213h\232\355u\210\017\304\376\343\363\324\367\204\337S\177\210=\327\226V\371ga\225\346\363\312\337\341\036B\371\017p\237\304{\244\375\243\375\034\321.\273\255\007\237EZ\356e\203=\035\214Ns\264C\354\360\373k\016t\303\3563\256\006:\035\317\260\323\336\030v\\m\007\032w\262\366\341\356\013\340\343\270\323\352Z\240/\215\373"
+	.string	"\332^4\330N\224{\335_\273\031\265\227\273]\310\266Wt\250!`d\b\221\212H \022H$4\322\264\003\260\242D#\315\003\021\300j\311\264grnfdb|\350\204\362\270\213\370\227\020I\266Vo\024\034\353`\231-\036\245d\323\3618\320\317\247x\360\201\374\034s\004\257\331\324\206"
+	.ascii	"2\264\212\013L<\365\365b7\020\215\203\205R(\201\272\352\301\f"
+	.ascii	"\227h\021\362\203\340\322\006\004\323K\036k6\177\032S\275\026"
+	.ascii	"V).\205\310x'\020\233r$\350]%\210\343\020\264\030$0t*\216\023"
+	.ascii	"e@\316C\261\323\027#h\323\030\266\373\214\335|\357B\365\334e"
+	.ascii	"\335\035s\201\254g\375~+G\227[\371\242oS\257\272\375\233\215"
+	.ascii	"B6\315\305P}\367Ae\024\277\007"
+	.text
+	.section	.gnu.lto_.decls.a6ede7cc99f41482,"e",@progbits
+	.string	"(\265/\375\240\013\001\001"
+	.string	"\245\034\004\376\200\206\365\026T\020(e%5\006\372\331\360\311m\246\217\232\317C\373\371\035<\024dF\353\004\352\305\305\341\213\232p\210\350\301gp=,}\23214\221!b%rj\024"
+	.string	"&\367'\331\320J\t"
+	.string	"$HX2\034k\240!\016GP\004\303T\350F\266f\211\334{\313-e\n\263\023)\027\335\0274T>5\252\366"
+	.string	"\027QS#=DeC\0065\325C\264\221~\241\206-=\240\313\3214\212\bH\f\250\036\242a\264\201b==D\027\3453\"Q\364\035\222"
+	.string	"S\225\323V;C*\246\304\002\255\312\341\034\366\004\234\201}\260m\037\227)5`h\313\222\231\021\232\326\252\234\266\230\266\204Pc\001aUN[\332\206\276\241uh(\375\244sh\034X\252\235\376\034F\3138v\222\304T\345\264\245\2354\215\\\325"
+	.ascii	"\037UN[\300\2507I\016\243~\020m?\030\335\017*\331\017\026\331"
+	.ascii	"\017N\355\007s\354\007\225\366\203H\233\004\234\303j\244\234"
+	.ascii	"T\027\003L\326\007\362\355\003\323\354\003\307l\355BH\303\212"
+	.ascii	"\357L\326\007j\331\007\276\355\003\251\354\003\243\354\003\243"
+	.ascii	"\373\300\254}\240\325>\260\310>0\310\336\333\"\3632\315\372@"
+	.ascii	"\035\373\270l\f\2212;\240N\304\0249c\265\205L\217\251\212F\235"
+	.ascii	"\352\230\202\251h\3240#\254a5m\341\251i\324<UO\275S\327\250j"
+	.ascii	"\260TE\243\2329\326\202\371\236\325\273&S\246F\375\237\336\376"
+	.ascii	"\217\314\376\017\314\376\217n\377\247e\377\207e\377\267\266\377"
+	.ascii	"3\333\277j\247\202Q\301\324-\351\322\266$\353\207 \247jI3S\273"
+	.ascii	"\250pe\316\240\252\027\225\213\372\005K\325.\352\226\253s*\235"
+	.ascii	"\332E\315\242j!\032E\337&\274Fj\216ok\003[\003\314\213\221\255"
+	.ascii	"\261\024\316a%\300\031\330\377\264\366\177G\366\257\306]\325"
+	.ascii	"\222\245(\bZ9\261\221\311\032\004\017W\343\252\370X\223\365\177"
+	.ascii	"T\373\277\247\375\253on[\214\270\325\310\372\277\212E\275\242"
+	.ascii	"\266a\251\352\246Z\241\222\205\215\352\315M\255\222\235`\271"
+	.ascii	"\262\227\210I\204\256\260*'|\026\304H\232\255\277\325\354o3\373"
+	.ascii	"{\314\376\006\263\177uJ\005\355\222\265\036A\3245\025\215\335"
+	.ascii	"R\266\005\246\242\251eX\r\t\252\242\251fGS\025M\035S\237\020"
+	.ascii	"\207\242\357\220\007\037A\242\266\244\250jj\032\226\252h*\224"
+	.ascii	"\253gj\024\035\026G\024\252\261\255\215G\320\375M\265\277\243"
+	.ascii	"\366\257:\271\372\344\317YT)&\333\300\373\032\3511J\220 e\255"
+	.ascii	"\222y\270\352D\030#\306U\232\254q\037\316\300~\343\330\306W\025"
+	.ascii	"\323@\256\244t\2059\261J\262R\023m\002<\013\263\345#k\265\311"
+	.ascii	"\227\360\001G|w`_?1\271)@\262\376\325/\325K\335R\273\023\223"
+	.ascii	"u\227\016\246\353\273\253\221\365w\321\306\313+\303&\267\261"
+	.ascii	"3\243je4\371\016-\017o\315\030\250J\245B\251GT\033\252\022\265"
+	.ascii	"J\255\241\006Q\233\324\035\252\020\365\206\372\244B\325\"j\224"
+	.ascii	"\252CE\242\376P\235\324,u\210\312C\365\241n\251\\\352\022UJ\005"
+	.ascii	"\2422Q\255\324$*\226\332C\315\241\342P\211\250S\352\225j\004"
+	.ascii	"KU-5\351\252\222\272t\035}_\2435P\266\206\264@\301\330\3451|"
+	.ascii	"/Q\026\350\214\374\204h$\205\312\025((\233\334\227\235\034\251"
+	.ascii	"\233b\201;\362\002\313IV\\\036T\032hQ2\2256\245\\\026%\237YY"
+	.ascii	"\305\310O\332\274\312\354M\363\224*U\323\367\215JI;\242\307w"
+	.ascii	"$\f4gQ\265r\\\336\322\306Ke\362\202\312\310O\210Fif\316\344\263"
+	.ascii	"5zyO\214Z\244j\251/T\030pd\246"
+	.string	"G\364\246R\326\212L\3377\212E\325\312n\331\t\321\310\370\032Y\315\200byC\202z}u\251FG\371\211\032\266\264\302\221\267)\237\225\264\0369JE:\202eN\325\312]r\035\221\310\370\276G\330@3\0256%\"\320\334D\325\312a\371\t\321\310\370\276VL\240\271L\325\312h\371L\215\252\255`\205\004\312\237\245\250ZY\355%\032*AMt\216/o\303\006\235\rB+.$6.\350\267y\233\202(\316as\036\227\375V\313~\313\266\337\236\355\267a\373-t\277\005\262U\030\277j\244\272\310O\326$ca\206\262~\373\264\325\027\347\260\037\340\f\354\243\355\321>\273\267?\255\333g\265l\374\252\355\263O6^\332\332g\2576\226R\363|\227\204\245\336\267\214X\203l\013*\353\234\306\303\263\232\023\212\374\340\312Z\025\262\317\366\330\030\372\264\317*m\034\025\363<\306I~\365\356\222\262\316a<<\213\311"
+	.ascii	"\215m-\353\026ic\265/\231.sQ\263,\205q\221u\366\342\341\371\313"
+	.ascii	"\232\343\315G\221\254\2038\003{\266h\343(\316aup\006\026O\345"
+	.ascii	"\236\267\274\b\345t$\353\254\305\303s\23352\312\262.\262\331"
+	.ascii	"\371\315\333_\313\354\257_v\226\212\333_\257\354\257S\366W\263"
+	.ascii	"\3755\2723\024g`?\3059\354W&\373+\326\376Zd\347(\316\300~\225"
+	.ascii	"\332_\235\366\331\237\3150XN\302mS\225\260)Y\177E\332,\316\300"
+	.ascii	"f5\261\347'\177\216\3425\331I\226\022\252\361\275p\312:K\363"
+	.ascii	"\030\226\236-\223\021\2712D$\353\257C\233\305\373\276/>\033\333"
+	.ascii	"\236\215\305g\036\236\305T5+/\370\262\276N\263\2058\003\233\345"
+	.ascii	"p\006\366\032\314\276n\333y\232\273\270\244\f\361`\312:se&?,"
+	.ascii	"=\230\340\310\372\032\312\0264s\311A\244\306\022%_X\2544\311"
+	.ascii	"\372\270\354H\206\252a"
+	.string	"K\033\356\252j\372\276\257VN\202\245Y\211\222\234\225\207\362\256\240\246\3030E\340\266X}\r\266\255\316FB\323\213\217\322\\\r\201f$y\350\002\244\367\235\252bo,\315\361\345]e,,\315\320\353\n\202qb\\y\254\276\256\261\257\221\3665\214\375g#Um\227\025\252\262\254sU\316Dr\221\347\252<\344 \214p\241Q\256\322\357K\204\361\006D\2147X\331\216\020IY}=\264\377,D\303p\215\227\242\255\254\377\034d\257\207\026\225\254\217\371@\030!Sa6\230L\215B\333'TV6\362\223\216,\225\201\344\251\314#\367\310>\362\017,\315TY\307sT\336q\255G\205\333\300\220\"\231\276o\324C\246\312/r\r,W6\202\216\310t\315\336\323\324\260\245\t^\3201\231\206\360c=\252L\224]\024\025\301zT\270/\017\251aK\373\211\364\310\364}\243\0336\374\314D\321H\215:\2778\207\325"
+	.ascii	"g`\257\206\331O\031F\306\0015}\312JXM\215\252\355\030\322\034"
+	.ascii	"\031*\347\300\322\374\244\203\241a=\212\260\372Fv\302g|Xy\222"
+	.ascii	"\365\325\267\033*\225\375?7e\246\274\204\245\271\306u\331\357"
+	.ascii	"\341\271F\206\221\221\324\260\245-\205j\3104FN\"\022\031_\243"
+	.ascii	"\242\036\320\367}s\215\254\224\223\210D\321w\tH\305C\207[\336"
+	.ascii	"\373\276:\0336l\330b8\324\244l}\325jg\031y\006\226V\220i\274"
+	.ascii	"E|fH\021S\326W\205l\021\274/\256\200\305}}\270\002\366\252\324"
+	.ascii	"\316GQ\360\240\262\276\272\264\257\312\330W\213\262Q\033$\f\255"
+	.ascii	"K\326\317\323\235\213\362\334\326\220\337\237Q\264\370\363\202"
+	.ascii	"fGY\326\317X\366s\224\375\034\266\237\255\366\325p\016\373\334"
+	.ascii	"\264\2158\003{9\234\223\207\267J\335\270\210\262\306j\360\035"
+	.ascii	"\226b\274k1\251w\354}\243C\225\310)KZ\326\307\032\330b___\037"
+	.ascii	"\326"
+	.string	"\300\3768\r\232\340]\333\016\272\254\317D\215\336\367\325\t\242\321\320\332\222\365\363\321\236\3428\\F\215BW(b2}\337\367?6\203\245x\212\263\034G7\350\350\0319\242\322h\375c\271\3432?~\303p\230\314\006\336\327\350}_\nX\264/H}Y\217\321\321i2\274\\d\375<\264?\002]\021(sF\240\\0\031q\310\370\026\321Um\251\303_0\031q(\372*\265TG\224\240y`p\030,\006\333a)\256\303]\216\275\340\262\343\350\373\216\275\357\273a\303\206\r:C\033z.f"
+	.string	"\365q\227\255\343\3661\334>v\333\307m[\007\347\260X\213\207c\271\f\354\322S\264\310n\035\355qe\r\304\031\330\343*\373\030\312\316r8\207="
+	.string	"\316\300\376\330\r\203b\324\211\306\217\254\177\214\345\370\212\260\207\227\257\037Y\037C\211\302\365c*\330\n\256\202\3330\033\226\342+x\312s\364}\313\336\367=v\362\004\223a\271\247\023\270\274B\370=\034_\301kX\r\313\rq\200\027\223i\231\031&#\252\357\313\243\013\372\276Q\017?\b#\340+\270\t&\273\240\350}y\354(N\215\211\301&\357}\243\033t6l\330\260\201\315Q\203lH\250\217i\354c\243\215\321\260\024,\355"
+	.string	"\247\035\237a(_\211\242o\364}\243\305\\\204\215\2314\353\177`\037w\300\252}}\270\003\366A;\343\f\254\021\347\260On\rp\016{\023[\003\316aq\024\207a)\006x\354 \214puH\354\365z\337hq\330\206I\233\275\254\017\201-\3349\026;\005S\357\b'\356c\fX\334\2071`\237\367\0078\207\355\302^\035\250G3\244\336\262\367\215\336l#*g^Y?\212s\330\2153\260\320\237\t\037;\007?\b\264\022 \002y\007-\334\374\304\035K\245\177/\375\277\021\377\372\364\257=\376U\307\312\343_Y\254E\373\350'\342_\211\376uh\035\301\277\356\370W\027\253\214\177\215\372W\032\253\217\225jF\013\006P\362\200\227\360\023o\260k\353"
+	.ascii	"VM\253\026\375\277\005\260FO\373\307\266\b~+\374{\356\034\374"
+	.ascii	"B\374\355\t;?\261\305\317\252iI v\340\377\201\370w\325\377\373"
+	.ascii	"\360+\372\312\317\242\370\245p\f~\342\225\177?\375\033j\363\370"
+	.ascii	"\177\n\370\330\216\372\333\tt6p\370\240\025\376\352\234\272\205"
+	.ascii	"\025\361\200\237\003v\006T\267\277\375\3715@\205\263H\377\217"
+	.ascii	"\001R{\352\337F~\242\203\024\3773\360\023\321~V\3056\262\211"
+	.ascii	"v\323\377["
+	.string	"\300\3372\340\307\036\264.\374?\023Z\tP}l;\265\307\337\t|\277@\305\322c\2267\310\001`\241?\023\260\025V\214\r\322\344\247\200\237E\343U\202\320\237\217\253\212\217\341\237\203[\300\213\305\377#\341W\261\374\001?\221\354W\331~\265\nk\366\333\371U+?\356j\377\033\341\277\330\232\237\b?\213\267\245?\020~\354u\016~\037\374?\016\352\226|<\207\177\250\245%\201E\363?m\277\251\347\240M\300\377\341Od\376\016\260\306\370\267\004+\213\337\301J\343o/\360?\347'.\371y\260.\375\370[\352\342\377aP\343o+@\314j\037\260f\225@\254\361\3776h\027\277\026\301\257o\374Z\306\3773@\3765\233\r\240X\223?\r\377\212B\353_\263\377\232\302\3172\377\026\204\377\327\301\277^\320~\360\3778\370\327\337\317\306\360\267\034\376_\001~\335\346\327|?\233\374\021\340\327h\277\336\362\353\270\3777"
+	.string	"-\367\353\271_\257\351\267_\273\375\372\354\327l\277\236\362\263>?\001\374\032\311\257\213\264\032\376\337\006\277F\372u\b~]\364k\032\277~j98\230\377a\376\333\351\023\376\237\006Z\205_\207\370\365\207_\257\360k\027\376_"
+	.string	"~\275\200_\233\360k\t\374\277\f~}\342o\t\220\231\377\307\332\023\377\356\371\177\030`\343\217\213?\213l\217l(:\347\327\023\374\232\202_k\370\177\027\374\032\001\177+"
+	.string	"\254\363\343\001\374?"
+	.string	"\370\374,\370\365\376Y\236_\005\277\362\323a\376;\350\377Q\360o\347\377\233\340\337\317\377\227\363\257\314\326\202\237\315\300O\202\177g@\003\377/\203\236\322/h\016\373\303\017\347\307{?b;\001\231\237\210\200\377\267\325\351\377kU3\377\217\375w\013\277U%\363\253h\260\007\373\001\033\002\377O\377[\205\177\207\370\367\n\377O\3757\005\376]\201\377\227\1776\003\177[\374a\017\247`\275\332\037\324\267\377\035\264\031\276\203\352\334O\264\303\203\370\211"
+	.string	"`\307\260aX0\354\027\326\013\006\222O\260s\354\026V\016\333\300a*\332\356@5\373Y\f\374\256.\177\326\002\273o\033\340\337\033\376\335\246\225\003\243\252\300^Y\300\2576@=\341W?\374*\003~\226\002\233\315\217\227\250\t\330\035\376\375\301\277\371T\020\324\020\324\016j\005\277\232\363\253\026\250\027\374\352\007*\005?\013\303\277\365~\325\303\277\367~u\204\\\367\263'\366\232,\304\352\317E\376\234\344g]\330yXj\227\360o\005\374\033\357\317\313?W\340gK\354;),\032\033\005\206\237=\333\rP\363_p\201\023\352\316\277\247`\257\357\370\2077~L\367\343.\032\030\340\317\004\370\263"
+	.ascii	"4\374yC\333\217\255l\220\003\300\301\237\177\377\312d\247\301"
+	.ascii	"\377\t\\\367c\257|\374\002\376!\362\307"
+	.string	"^~\034\367\257h6\232\037[\271\262\3563'\236\341\037V\340o[\370[\021\377\372\243\035\361o3?\253b\033!\241\343oO\370\333\234m\004\227\320\232@\\q*-\325\236\376O\373\005+\204e~V\3056\362\3572\022\374;\347\337c~v\311\277zm1?\3535$K :\301?\034\372\333\266+;L\226m\327ni\345\376\226\356\337`\260\na\312\374\255\231\272]\327\342\375y\2055\377v\322\262\331_\376L\002\177{\331]\366\234\3169h\273\264z\377;p\341\r\370\207\035\370Y\257\254B\016\361\343\241*\005? \213\370\363\210\f\201|\"\263\360\347\025r\013\231D\216@\226\200\013\034\234\300!\376\301?\024\332\025lQ\267\2609\266\334\277/\330\031\374x\270\361\277\363\277\265l\002\374\371\2058,\345\307\317'v\026\266\311\212\375w\377\241\213\013\374\304\211\377p\204\341-\360\037G\205\237x\361\037."
+	.string	"O\375\270\306\217\223\374\230\310\217\233~\f\344\307L?\216\372q\220\037\333\3701\325\2177\200o`\375X\371c!?\336\361c\251\037\343\370q\325\217u\374\330\nC\375\370\310\377\264\375\366\267f\333m\311\337R\371\333*\377\306\362c&\030\311\217\263~|\365c\036?~\361\343\247\037k\375\270\307\217\177\374x\353o\243\177\033\366\357\266!\330\307\217\241\177+\345o\323\376}\345\307NEZ'\333\312\217\317\372\330lQ\277@\225r\235\365\352\377\211w\260\253\354)?\376C\022M\330\303\217?\370\361\b\255\327\337~\375[\355\307!`\021~v\t\253\200\243\354\214_\260f\035"
+	.ascii	"\3770\347gA\260\323~\374-=\261b=\370\017\177\377\307Z\"\0266"
+	.ascii	"\222\277\035\362\267D\266\224\237}\361\315\277\321~\254\301\277"
+	.ascii	"\243\214\340\337g\177\213\344o\217\264\320\177C\371_\367\337"
+	.ascii	"\356W\267\374\273\354\377\364\337f\255\222\277\325\372\367\223"
+	.ascii	"\277\315\331N\376\226k\223\235\203\277\r\362\377\256\203\377"
+	.ascii	"\027\260!\030\341\027\356\375k\326\036\373q\t\177;\201\263?\321"
+	.ascii	"jK\377\366\005\375\023\213\374\354\004b;lG\377\335\344\337^\377"
+	.ascii	"\232\245\353_"
+	.string	"\305\270^\301/\354@\374Y\343\317\n\177\366\346g\207?\233#\344\371Y\003l&\377*\307n\360\263\003\370\331"
+	.ascii	"\374,\001~V\203\237\325p\235_\370\302\317\212\370\367\326^\262"
+	.ascii	"\265\266\222\177]K\362\257l)\374\254\003~\366\204\237E\341g\031"
+	.ascii	"\360\263\037~\266\001;\353\031\374\302\032\177[\3747\326\276"
+	.ascii	"\372W0\377\206\376k\225\177[\375\353\225\377\277\237\270\301"
+	.ascii	"\337\376\374\307?\221\312\377)\377\331\376S\371\177\345\177\225"
+	.ascii	"\277]\361\237\375\211f\376\326\306\337B\375m\216\277\305\361"
+	.ascii	"\2677\376\366\351o\243~\266\305\337\366\3707\222\277-\372\333"
+	.ascii	"\032\177\333\364\267,\376}\344\177\361/\232\360c\264\037;\371"
+	.ascii	"Y\025\177+\375\267\221\037\247\375O\373\331\026~\366\307\277"
+	.ascii	"\213\374\347\340\377\211\377c?;\365\237\370\017U\370w\325\277"
+	.ascii	"\247\376"
+	.string	"-\365o\036\377\216\3727\324\277\237\376\355\364o\033\377n\372\367\322\277\221\376\355\342\337E\377\036\301\277\237\377\016\372\367\317\277{\376\215\342\337\033\370\267\006\376]\201\177G\340\337\020\370\367\n\377v\300\277\025\360\357\017\376}\200\177o\370w\007\377.\300\2773\370\367\005\377\266\340\3379\377\316\177\333\346o\327\374-\336\337\252\371[4\177k\346o\313\374\355\230\277\r\363\267`\376\226\356o\267\374m\334\337\272\375m\333\337V\371\333\264\277\205\362\267O\376V\372\267a\177\373\365\267]\177\273\365\267Z\177\013\375[$\177[\365\267?\376\266\307\337\356\370[\026\177\033\303\337&\3776\305\337J\340oI\374m\317\337\242\370\333\013\374m\005\376v\304\337\232\360\267\023\370\333\027\376\326\205\277m\341o\037\360\267\016\370[\006\374\355\t\177\233\200\277%\341oE\370[\020\376\366\203\277\345\360\267\007\370\333\r\177\253\341o9\370[\002\374\255"
+	.ascii	"\376V\203\277\315\340o/\370[\013\376V\347o'\370\333\f\177k\374"
+	.ascii	"\333\341\337\252\177\213\177\226\357g\365~\026\357g\325\374,"
+	.ascii	"\232\2375\363\263e~v\314\317\206\371Y0?\373\345g\275\374,\227"
+	.ascii	"\237\235\373\331-?+\367\263Z~6\313\317\302\375\254\333\317\266"
+	.ascii	"\375\354\225\237\265\362\263l?[\345g\247\374\254\332\317J\371"
+	.ascii	"Y\264\237\215\362\263g?\013\345g\305~6\372\263^?\313\365\263"
+	.ascii	"[?{\365\263G~\326\310\317V\375\354\220\237\r\362\263?~v\352g"
+	.ascii	"y\374l\324\317B\375\354\215\237m\372\331\245\237M\372\331\031"
+	.ascii	"?\033\343g_\374\254\321\317\022\375\354\373\263#\370\331\020"
+	.ascii	"\374l\213\237]\361\253m\377J\365\263\315\237\355\300\277\212"
+	.ascii	"\371Y\346\317\002\375l\f?\233\374Y\237\237u\177\355\343\327="
+	.ascii	"\376\237\371\365\211_#\340g\221?\213\342g\217?\313\363\263\031"
+	.ascii	"\370U4?\356\360c\021~\034\342\307\033\370Y\f\374\254\005~\354"
+	.ascii	"\363c\345\317R\340\307B?\013\303\257\216\360\263'~\326\205\377"
+	.ascii	"-\374l\211?\303\360g\t\374+\223\177E\363\347\365\307]\377\323"
+	.ascii	"~\266\205\037\017\177\254\302\217\301~\226\205\237]\300\317\256"
+	.ascii	"\360\263\"~\366\001?;\342g9\374\354\007?\333\341g\005\360\253"
+	.ascii	"[~V\303\317\032\340g=\370\331\r?;\301\317\352\374,\005?\273\376"
+	.ascii	"l\376\327\345\277\342\375k\232\177\235\376k\231\177\035\363\257"
+	.ascii	"v\377\n\346_\277\374\253\227\177\235\373W\271\177\315\362\257"
+	.ascii	"m\377z\345_\331\376\265\312\277\256\375\253\211\177\225\362\257"
+	.ascii	"g\377\n\345_\235\374\253\330\2776\371\327\257?\203\370W\257?"
+	.ascii	"k\360\257\\?~\300\377\261\037\377\377\005\377\252\365\177\371"
+	.ascii	"\347\016?6\300\237\217\377O\374k\326\277b\375\253\325\277\022"
+	.ascii	"\371\327!\377*\344_\203\374+\220\177\375\361\257\314\177\345"
+	.ascii	"\300\277\272\377\032\201\177\335\340_\205\377\252\376\232\356"
+	.ascii	"\327Y\277\236\372\265\324\257_\3705\f\277\346\360\353\016\277"
+	.ascii	".\376\352\335\257\252\371\3254\277:\367\253r\277\n\367\253X~"
+	.ascii	"U\312\257\242\375j\224_\r\372U\025~\025\304\257&\340Ww\376l\367"
+	.ascii	"\347\255??\377\223\370\363\004\376\374\302\237O\374\331\304\237"
+	.ascii	"]\370\363\007\177\366\340\307`~\374\345\307n?^\373\261\327\217"
+	.ascii	"\325~\034\366\343\350\217\233\374\370\353\307\n\370q\002~\274"
+	.ascii	"\363\337\304\217=\3701\007?.\300\177\274\377"
+	.string	"h\376c\371\337\366\337\353\307=\377\337\376#\240\257\257\257\357\337`\003\177\207\245\037\032\f\254\216\245%\017N\202\214\235\200\254\235\007\267\216\245\301\255 \227\b\251\267\206\00663UNy\357\373\344\301\317\213\006\023\233\254\203L\256dQC\312\372\tX\263\237\2003;\310&\372\304C+\250\004\350TT\364f\375\004\320m\"\332\026+X\234\274]\245e\035\304\n^%q\212\272\313\372\t8\333\177\020\032\264\352\003\262\345#h\344A\253?x$\210\0047A\262e-k\235\2063\260\301\"\036\0364\002\205\324g#\353K\221\006\253T\320\322\021\206\310\3374\026\233\221\217!\303\275i\037\232\220\030\331\307\026:\276 \301&\033VO\\d\375\007\201\004\177X\361Q\244F\326TD'W\216\322d\375\004hm\245\240\215/hP*\330#\310#\270#8\205\245A\037\301\033F>\202N\301(5li\247u1\233\006}"
+	.string	"\315"
+	.ascii	"\327\220\360b\351G\305EY\320\007P/\370B\r[\202\001H\223\351\373"
+	.ascii	"\276A\037A\030\301$5l\351\327\004\004l\272a\303\006 \217\246"
+	.ascii	"6_\204ZGf\"\325\027&\353' *\007\226\006\241\2028\202P\301\247"
+	.ascii	"<\004\214Kj2\335\3324\360\330\270i\375\0044\355\357\344\355\357"
+	.ascii	"\224\331\337q\253\001\004\272\245\224\365w\242\373\177\220\t"
+	.ascii	"K\203M\301\245&\225F\fhKE\306\204\246\365w\202\354\357\354\330"
+	.ascii	"4~Cvo"
+	.string	"M\262\376\316\320~\bzFR0F\020\211\007\220\207\214\340\f,\r\306\b\036\261;\274\270}a\365G\300\333\037\341m\177\004\265\035d\315\314Y)\311\372#\030\331\307e{@vL\203C\300\276\247]\200\364\276m:\200^IM\246y!\260\001j%5\231\346\005\213\202F\3017H\204\245\301!`\233\021\202C@> Qa\312\244\021\001\352\217\300c_\004\275}\021\276\354\213\220e_\204*\373\"\204\355<\235\233\"\030a\262\276\bS[\r\360L\036\002R\005\005\252\001\246\321sV\222\232L\267\356\200xX\nT\003D\303\306]\231zY\375\020\354\366C8\333\017\001l?\004\350\376\201\3232Ai\276\354\304\034X\346\007\216\001\222\321\320\r\214\201\002\253\312\032Oq\016\233\001\316\300j1\017\007\212!2\031\332\201$\353\037\030\006\314\2175\255\270\254\037\002\020\f\360K\036\"!.\211\313J\236\035\226\002\301"
+	.string	"\353\206TRHP\264~\bE\373 \240\361\"\267\303\344\225\361`\343\341\226\243M\007\226+Qq\300.@-\300-@:\340\034\220\013\226\002\345\200o\007\302\001\263\030\311\001\255"
+	.string	"\345Z0\300*\027\024\275/\021\024\013\226\244u\227\367\276\257\236R\205K\316\250\361\026\316a)\300\031\330\203\020e\037\004\255}\020\236\366A\240\261\017B\321\276\0075\373\036\326\366\017\244r`\225\037\270\006\234\242\241D9--/Yc=\017\007R\001J\231v)e\215\217p\016{\003T\003\242\341,b{`UyW`\300\200]@3`\023\240\030\360\t0\n0\r\030\005z\001\235"
+	.string	"\307\200d\3002\240\024`\030\360\f\310\005\224\002\241"
+	.ascii	"\277\260\024\210\006dBd\315\364}\243\036\262\264\240\001\265"
+	.ascii	"\200K\210C\306\327\210\n.\n\b\033\250"
+	.string	"\035\337\020\275\351\2211P\2530P\254\207D\214\222,S!{S\254:'E\312\004\341\243\352\333z\203\032!\003D\003\376"
+	.string	"\242\001\223x%\025\321\333bm\020IRw"
+	.string	"}\017X\373\036\200\354?\2539p\311\030\231*\321#Y\337C\217}\0174\366?\330\333\377`\272\377\201\334\376\007V\366?"
+	.string	"\333\377\300\310\376\007K\373\037\024\355w\330\333\357\200f\277\303\334~\007,\373\035\324\366;\214\355w\330\332\357\020d\277C\323~\207\027\373\007N\001u\200\211Y\222$k\247<(\326cj\003]\312IXn\210\003\270\372t"
+	.string	"k\350;\276\251\215=\240\016`\0230\007\020\n\330\003(\005\214\002\362"
+	.string	"\356"
+	.string	">\001}`)P\007\020G\231\322\021\364}_\240\016`RN\242B\002\352"
+	.string	"\336X\247\202JS]I\362\3367\252\331\334\200\321E\002}\016w\373\034\274\354s\200\333\347\220\266\317\341\311>\007\257}\016?\3669\330\330\347P\264\217\2004\373\007\322"
+	.string	"\316\370}\221R2\003D\002\312"
+	.string	"\306\300R\340\f\340Q\216\276\357\330\013,\320\367\215\002g"
+	.string	"a`\2626\340\f\240\213\366\214\212\352\251U\272\2226\265\365\0210\267\217\200*\373\bh\262\217\200\037\373\007\032\001\207\352\350x\204e}\354\304\013p\350\267F\211\017X\364k\363\333\003\276?6\277> \021\226\002\207~zw?5jT\255\005:\250i\336\023\264\354K\024p\350\207\207\365\200C\277.\300\241_\335O\r\226\033\362\2765\016\220u\245\007\226m8i\362\003G\037\001I\373\b0\332?"
+	.string	"\336\376\001\304\354\037\200\313NS\001\213\244\213\036[\326?\200\224\315\3447\305rCt\23344?3X\372;\363\003\363;C\\\337\227H\n4\330\343\007\023\022\253\313\344aQ;\313\372\007Hb\006\205\002\035\363#\363\013\203\245?1?\273\237\030\326+'\215\260Dc\016n\275\233\2561\263\365=\320\333\367\200\313\276\007p\373\036\244\355{"
+	.string	"\266\357\201\221\375\377\270\374\342\330\246G\242xmA=\210UM\271\270\312\314\240\230t\255\375\262\374\334~i?-\277-?\266\037\335o\312\017\356\207\366{\373I\371\315\375\252\374\242\374\254\374\250\374\324~m\277+?\271\037\026,\375\305\375\316\264\300\246N\300\220D\215@\243\226|M\177q?(9\236DM\235\224\351\360@\326\003\312\327\265FJ\344\347\204\307\364\313JI\023h\234\356\262c\272\345\025\367\013+2m\202\365\213\373\215a2\021\224\f\335\361\345\251H`\220y\362\201\276\007=\366=\260\261\277\001\315\376\006\273\375\r[\3667\264\355ox\262\277!\311\376\206!\373\033\240\3667\034\355\033\300\314\276\001\332\366\r \266o"
+	.string	"\350\276\001\240\366\r@\264\257\001\314\276\006*\373\032\240\354k\b\333\327"
+	.string	"\335\3270\265\377_\222\037\026\321\006\333[\026dk\372\203\376\220\374\262~G~W?\253\237\021,\375a\375\212@\031\202d\352\365\303\372\375\030\201\310\0210 L\240B\254\240?\254_\025&k\2431\005\265\365\276\321\025\351\315\256\310\250\337\301\231\375\016\300\354w"
+	.ascii	"\267\337\001\224\375\016\266\366;\230\332\357 i\237\0035\373"
+	.ascii	"\377QM\255Ol=\226\264ZdF\262|\374\244\354\264\226\252\374\244"
+	.ascii	"~=\306d\350\020\313\372\307CMRd\212Y\326\347\240n\353;\273\035"
+	.ascii	"\206j\017\272\245K\0166tIxnD\364\335\224\316\016\217\357\b\264"
+	.ascii	"\214\230"
+	.string	"\351['m\303\206\313\214\251\276#CF\357\315\305\020\250^\026\036S9(\250\036\034\220\036^^bL\331<4Y\246\357\033\315Qj\334\246`\330L3\033-]t@\317hQ\337.2\246xmF\262^\334\216\351\373\276\372N\314\232\2746(\233\227\006\016\212\367{7\026LV\305f\256\213\322\b\277w\343\355;5\n]\201\016\313\364\367\364;\372\025\375\240~5~K\277\246\037\214\237\214\037\323/\352G\364\323\361\273\361C\372)m6?\247\337\214\337\216\337\213\335\367\263\361\303\361\313\261\333\374b\374\222~F?\032\277\241\237\013,\375\275{\315\267\336\336\373\275{L^\236\362\263yf\352\240\277w\177\301j-\031\222\0224\357}\243\300$\031O\321\024\3649X\333@#8\003{\016\306\3669\300\332\347\240j\023g\350\325X\313\372\034L\355sPc\237\203\027\373\005\270\333/@\335~\001\262\354\027\200l\277"
+	.string	"G\366\013`c\237"
+	.string	"jv\230\261\032r`rd}\002h\331'"
+	.string	"\225}\002\214\355\023\240\310>\001\226\366\007\220f\177"
+	.string	"k\373\003\210\356\017\340\310\376"
+	.string	"\242\366\007\200\264/"
+	.string	"6\373\002\230\356\013\300\312\276"
+	.string	"\302\366\005p\265/"
+	.string	"\250}\001\034\355o`\346\212\225-\243\314\225\027V\330\24489\022\225u\025V\217\r\321\216\254\277A\226\375\020\326v\223mF\\\337\367G\030(\327\356Z\003\335i[mO\331T\260t\257m({m_m\255\276\275\266\3176\032\226{Z"
+	.ascii	"\235\214\351*c\n\030\031@\275\321v\224\030P)X\272\321~\020F\360"
+	.ascii	"\312mv=\202h\375\r\240\354o@\266\277\301\025\331v\262\237\354"
+	.ascii	"\261]\206\245\333,K\343\304"
+	.string	"N\230R7-\013\003\003\005\333f;Z\305nj\246\005:\314\022\306\b\023\241\376\006U\373\033P\355opc\177\203\027\373\032\260\351*\323\225\327\265\225\220\201~m\260\355\205\245\273\353\314\376\bI\330@=l\255\215\265\263\210\352\373\022\265\201n\255\255\004\223\235)@\336\214 \\y[\233\311^\202\245[\353o\343\260\223\343\314\243\314\214\323\326\327\200l_\003\256\234\006o\301dM\253\034N\262\276\006I\36658\262\377\r\335VS\0333\366\262\376\267\325F\022%\2077\225\365\221h\221\311\226\226\242\254\257AT\221\r\325\244j\023\331F\260t\027\331:v\221\035\265\205\320e\201\356\"\331\306\316\201\345\206\214\240\2232\305J\234\272\244\266>^\263cK\321\301\r\331@v\220\375\003K\267\220\353\350\373F\231r\203\372\310C[\310\246\312CX\240*\231\323\327\036P_\003\247}\r\222\3665p\261{\374\264\274\320\022"
+	.string	"4\233G"
+	.string	"\310\354\007\240\313~"
+	.string	"\252\354\007@\312\376\277ql\247\375\264o`\351\316\221\241\3248\003cB\2036Ew\216m\003\253I\241\350p#!\317\310\030P?"
+	.string	"\322\375"
+	.string	"t\355\007 k?"
+	.string	"B\366>*\223C/\353c(\373E\002\345\343\322+\362\202\276\357\273\217\3325_\323v\257+\017l\272\207\216\354\030{\306\246\261e\354\244\375b\303\330.\266\322F\302\322}\264\211\276\213\266\3215\330>j\333lM\275\3300\331Gm\037\tJ\320\350m\345\274\2534\032\023h,\207s\330\013p\006\366\031\264\331\317\340\314~\006_\3663p\333\317\300l?\203\255\375\f\204\354g\260\264\237A\321>\006j\3661\360\262\377\026OE\343\004\016\307\235N\030\276,qj\322d\265)\022\313\032M4J^\217*0\262>\006Q\366\261\027\227\266\316E\216\254v\332\212i\311"
+	.ascii	"\2112\323\236i\313`i;m\355\216\365\3320Q\336\367\235\266`Z\270"
+	.ascii	"\013\212\216^\242)\002\254Mu6\3541]E0\266n\311\374 \214\340\305"
+	.ascii	"\366\236y\313\332\203\207\267cp\223\275\260+Y\037\203\262\215"
+	.ascii	"1@\262\217\001\221\335vi\275`\251N\373e\256()*\353c0\265G\360"
+	.ascii	"b\035\366}X\207=\0065\366\337\322\265s1\276\322\244e\035\025"
+	.ascii	"*"
+	.ascii	")\025\221\332\"\367[b\243N\213\226\267rp\302!\f4\"\243"
+	.string	"\254\3338\017o\265\3241\255\335\310zm\263\300\325Aw\300\301\265o]6\202\030\211z\275\357[\374\255\355)\271\321\272\265X\212\220\302\240Y\267\005)\303cK\326\307\340\335m\225UO\365\"\241\351\375q\271\352\233zU\32130\031\t/^\026i\262\220\246^UZ\265<\304^\275s|[VZ\266\366\n\226\266U\332\265\267SZ*? B\272\312\266\326yq\016\253\2768\003\373\013\306\354_@\267\3776-\2375w\264\345I\311[4\033\256\257\032hW\234\246|e\255\357\332',\236\b/1\355\023V\257\025\242g\227\333\352\246y\355\023v\rK\204\345\312\364\2240\323\366\311\372\242\r\273\240\350H\253iq\322\216\265dm\224\326\254=k\241\264eX\332>i\305\236\331\264\3223\030\252\2257M\303\336\215\231\252\357\023\026\r\032/6\362\210\226\252\340\350\375\342\034\366\027t\355h0\013\023\326T\326\277"
+	.string	"\312\266\265L\356\232\264M\332\257\326\253\355j\271\260\264\005k\211\fi\241`\320\366\252\205^Pt$\242\355k\332\202\265X-X\326\034\330\257\007\216\266%\241^\322ni\001\277\202\274Yk\226\\\353\206\224\225\267\254[- \222\223(>\262n\223\264E\212Y7\362hd\335fi&bxQY_\315\245\374\377\355++HZY\037"
+	.string	"h\366\0010\246\265b\307@\021\313\313\372"
+	.string	"\210k\221\264G0\326\213-u\255\221\267G\302\360\240C\332\"\302.z^hm\221\266*\277=y\202\243\255j\211\254k\236\212\332d}"
+	.string	"P\331\007@\332n\203\024\245\321B\313\372"
+	.string	"X\262\331\275v\206\336\032\252\026\b\226\266?\256\333\037-\215v\n\313\225\351<\275iq\210lF\rV\267>\326\322"
+	.string	" \265\333\036\255R\273c\314T\252\345\201\245m\217\367h\223\2024\244XK[B2\243(\024VG\001\371\212\320\\e}"
+	.string	"<\355\207PC\207ZS\f:,\323\033gS\303\226\266\023*\267\251\027S\227Z\233\243uj\237Z\250V\007\226\2668Z\0338\332\245\247a\271\262\327\305\330\001\272j,\321\313\333\320\362\230kS\023\352[\260f\337\0023\373\026\330\355[@\267o\001\334\276\005l\373\026H\331\267\340k\337\002&\255\f.gY\304\262\276\005>\366\377\366Ek\324\"\265G-\214\326\005\226\2661\256=\2641X6E\031tXKy^m\330\273,}\354\235\024k)\257-*\302Z\312[\365Z\242\242\214\2546\006\313\247\341\f\r\326R\336\373Fu6l\bR\024\275A\324\257`\332\016\005\311\244\251"
+	.ascii	"K\373V\200\266_At\277\202\254\375\n\204\354W \265_\301\322~\005"
+	.ascii	"0\366u\324\260jz\200<\251\222\365u\304\354\353\270\355\353\240"
+	.ascii	"\355\353\214\355\23753\206\006t),k\366Iv\022\006\352\225\335"
+	.ascii	"@p\201a\307\254/X\273\013\212\2164X\335\224\025\303\226a\311"
+	.ascii	"`);\206\r3F\217e'D\243\350\313\324\036\241\242z\312{\337\267"
+	.ascii	"\f\322\027\021P_g\307\006\363s\222\021\315\221\365uj\354\207"
+	.ascii	"@\245\f\n\205\235B\034\272y\337\037fP60v\013\373\205\255c\347"
+	.ascii	"X/,\027\226\216\225\303R\266\013{v\266\2145\273\016\237\025\254"
+	.ascii	"\366\005e\273\260W\274\246U\330)\027\024\035\211\260\322dj\304"
+	.ascii	"\266\261Z.(:\022\221\006\312\364}\243l\027\254>\254\274\367\215"
+	.ascii	"\006\355\250\244\270p4\033\007DRb\264%\353"
+	.string	"SP\205\315\302\302\rw\324\340\363b\337\316\302\375\\$\251\341\310\232uc\321~F\270\302\320\262f\261\250Z\330\004!\312\372j\324\260\377\277!\030\364\213\225\254O\001\224}\n\302\366)\330\332\247\300j\237\202!\373\024\364`\3272\224*\253\271\254O\001\023\253\306\246%Q\263\266\2255\233\226\321\214\021B\206E\003\3365\rY\303\242\261Qp\230-\\\362\330(\354\031~BDT\224\365)\200\261O\301\273\325(\316aI\300\031\330O\200f\377\254\223\\\307\306\b\272\206\354\254\024\n\024\215\224\254\231\260M\220\240M\307X1,e\245\254\224\rk2\325P\362\250\334X\375\t\312\354c(]g`l\224\375\302R\266\3113WN\"\256\357+\025\205m\302z\021\231\272\203\313\333\320\004\003\262\267\365'X\333\237\340l\177\202'\373\023D\367\317n\345;\025OO`Y\263ZaQ;\372\262V\"\327\207\244-\353O"
+	.string	"d?\204\177-\263Nu\260T?\224\240Dh@\311X\261B\330!I\254\217)V\352-\002\205\204M\302B\331,\366\212\305\302R\326\212\255:[\2045\302Z\261GX)5l\t\002E\242\246\0330\334\027\232\035D\375\t\240\366\206(\316a\327!}\3739{\233\035\362\263@\330 \254T\273\207E\006\222\254\237\203\267\205r8\207\305Q\312lu\tg`\237S\267U5\234\201e{\264b\244\2564\311\3729m[\215\036\0326O,\024\353\304\356`u\260<\330\034\254\r\366\006[\203\305\201\245l\324\277\216Y\311\204\220\206\017jd\246\017\352u\267\206m\ns4e\243X&\"c\246\357\033=\323f\312F\255y,\221\032\266\364"
+	.string	"\"e\246Ql\324\n&o\312F\261E\354\022\226+{\337\032\006\3301g\027\245eh\221\203\323\321\317!\333\317i\262Y\245\365\254\314\020\036Y?\247j?\004\030X\274\\\274\2551\202{\3614\031Hn,\022{\204uL\261cc\2603X\032\254\f6\tKY\244\007\251\300\325\230\"\324\317!\332\227\240o_\002\276}\t\326\354Kp\267/\301t\263C\305\267\017\306]\326\227\200\313>\366\342\373\202\256\361\202\262\357\332\267\262\301\322\265\315\272\267\266Y\365\276`y\201\346\375\350\246HU[_\002\262}\t\230\354K\220\265/\001t_\202\035\373\0224\355K"
+	.string	"c?\003\337~\0064\373\031\274\354gx\333\317\220\266\237\241lk)\234\201\325R8\207\375\030\316\300j\2710v-S\035\0302+\230\265\016KW\273\265\313W/\353\227\"\273|%?\301re\232\313n\272\332\255/V.hM]I\332-QI\272X\275F3\260\317\360c\323\205i\342\"K\326\317\240c{h[\335\246\262l\344\025\311\255o\371\f\313\r\321\\Q\326-k\226U\313\n\267\316\255qX\272\312\255j_\271\326.\271\365kE\303`\246\262l\344\345Xy"
+	.ascii	"\2774e\331X\345V/\"XY6\362\344\326\264\365J\023\361\tV\226\215"
+	.ascii	"<U*\304\211\025\242~\006&,Xl\306\202d}\034\276}\034<\266\325"
+	.ascii	"J\225\240\0240p8slU\200S\352\316|\241\362\265\212\n\325\242\206"
+	.ascii	"7\345\377O\030\007\225\341c\312\327\346\220\314\320\326V\265"
+	.ascii	"\341Y\226<\274\254\217\203e\037\247\312~\b+\332z\226\253\276"
+	.ascii	"\242\254R\260tE\273.C\373j\206\345\3124\226\331t\303\336b\205"
+	.ascii	"\367\305\352\343\224\355\325l\215\256SX\256\fD^\031\224\265\f"
+	.ascii	"KW3\2635l}\022|r&\313F\336\373\276\033*\330\360\213\0226t\306"
+	.ascii	"\352\325\211\246ae\304L\326\307\311\261\377\257cX\272\222]\257"
+	.ascii	"d\253\330*\305re\257\001\232\254\364\266Z,e\266\344i-\375W\260"
+	.ascii	"\265\211v\373\251\201iR\222\365o\366\366o\354\366o\346v\226\302"
+	.ascii	"9,\001\260\354\337@\331\272le\262^\351\235Q\223\221\265Q\221"
+	.ascii	"v\303re"
+	.ascii	"Z\213\3154\312\305\036\364}\243j\321J\004\302\253M\324z\265\032"
+	.ascii	"i7\242Q\364\035b\313\204\351\201\345\251E\353\225\316[_5l\t\002"
+	.ascii	"EGS}\267^i<$\265h\275Z\207\314\350\201\345e\255IV\254Uk\335Z"
+	.ascii	"\225\254KV(\226\256W\353\221\257HV\253\353D\337\327h\275Z_\254"
+	.ascii	"F\260\334S\364\035j\323|\350\201\345m\020\23692\205\tG\263Q\234"
+	.ascii	"\303\276\016g`\1773\266\213l\27319\270\254\177\323\265\243\326"
+	.ascii	" +\f\254\267\006Y\217\250\252\246k\220\025\211\3104G\255A\326"
+	.ascii	"\036\353\224\032\266\264\317\212\214LW!k\325Jd\035\262R\255@"
+	.ascii	"\326\037X\272\006Ye\324X\237Hx\261\364K\222\366\310\261\362 "
+	.ascii	"\341\305\322/\006\035\217\351\032d\215\2616QiPBT\345\246\312"
+	.ascii	"(\003\303g\324\253\017\272;=\244\254\177\363b\257RF6\373_y\354"
+	.ascii	"\bQfGZ\326Q@3\032M\302\262\276\321\314\326\261B\005\355b\274"
+	.ascii	"d\262\276\261\313\2761\316i\305qc\037\351\022U\305\314\351\006"
+	.ascii	"]\331[g\343\353\215\223a\355\206\254\350\211\255LJ|NkVY\337x"
+	.ascii	"d\037K\327\245U\t-\tR\224\244\257JU\302\367\002\241\036\\\234"
+	.ascii	"\215\254\257f\245\361\377G\364\002\226F%\353\177\245\261\316"
+	.ascii	" \322\230{\247\260t\235\261\312\210\276:\277\273:6]Y\337\370"
+	.ascii	"c\337\270c\337\350\264oT\3327\276\373E\276\375\242\335~qn\277"
+	.ascii	"\330\266_<\333/\206\255\257\356\303KZC\227\265n\2433\314rF#M"
+	.ascii	"\326/b\355\3432\275\247\021\177\357\333FfO\257y\032\321(\372"
+	.ascii	"\032a\307\254\351\201\345\261\321|X\252\367\266\221R\215%V\277"
+	.ascii	"(c\277\bc\237\330f\237\270f_NM\032\325h\207\0211\272\214\026"
+	.ascii	"\243\315h"
+	.string	"2z\252\321\3503z\f\226\3524\032\314\265\235\016s\035/y\210\370{\337\2516\320/y\b\313\225\275\332j\355\216o+\215\216\323s\027\024\035\275D>H\270b\352\202\311Z+3k\322h,\332M\r[\nA'cJ\307\305\303\320\035\337V\032]\307Z\205\335\3514\372Mgi\"\300\225\217;\276\274\367}\3275_a~\340\350\034\3059\254\006\234\201=\361\312>\361l\237\350\265O<\262O\334\261O\214\261_\207sX\255E\313a\351\337\364\226G\213D0dd\262\262>qh\037\377\215\035\001\376\033\373\341tk\270\342\0255=\324\262\376\220\313\376p\312\326nO\313Y\213\031\036yY\177h\266\177\335v\005_\321\271\370\312\372\377\263\223,\265$\004\312\305\211\2251\304\"+=2\266\374$\223\305 \302QE\237\2651\201\261\312\372\327T\246\020\271$\331ae\275\246CD\002\023\205\221\365\207J\366C"
+	.ascii	"\313CimS//+\267\257<\304T\302\336\022\346\343\312Uj\024\332:"
+	.ascii	"\261\202\233b\235i&\331\211:\006\335O\254\2628\321O4\2316\323"
+	.ascii	"Pt\024\215\246\313t\232\226\242\325\260T\237\351&:L\213i\351"
+	.ascii	"q\364=2Z\362{\330\302jqP-\254\206\347\236^\242\241\022\366\246"
+	.ascii	"g\272+Wa\271\247w\310L\001\366\240\327YI\304@5\226>\323c9\211"
+	.ascii	"\310d|\215\224\310@\267\234i%\371\214\310\024}\2070\233w\303"
+	.ascii	"\006u\215n\217KG\177\bd\343:\234\303b\240\243\377\017\230\005"
+	.ascii	"/\0074\353\017y\354\017c\354\013\365\366\205e\366\205[\366\205"
+	.ascii	"j\373B\256}a\221}\241\323~\036\316a/,\332\017\266\331\017\226"
+	.ascii	"\331/\3039\354\333\364\025\364(z\203\215\254\242\210e\255\221"
+	.ascii	"h\253"
+	.string	"k\250>\362j\250\bR\357K\244\241E\276\367%*b\274\001\306\033h.*+(\254~\320n\377\332\210\0362\346\207\022\214\254\217\275\206f\264y\232\276o4J\2779\t\b\215\251\376\241\251t\225\006\242\211\350\"\332\207\356\241\247\264\224\026\242\203`\251\036\242\243\256wh\036^z\210>\3221\324\260\245\rE\312F\017\3213\264\023\226{Z\351\366\246Q}JS=D\r\332\b\327\302Q\231\241-\315m\0373k7VY3b)\226\365\260@\313\020\r\212\211\024\333\215Xnl\003a\004\343\214$\266\251\273\254\215WN|\3122e\232\365\215V\200Y@\306\226d}\004\210911\031\251\030\247P\340m\373\274\031\321\214h\306\264\025W]\256\244\334\230\206\227$M\025\334\222=\031^\262>\005\320v\362\213\321\314hf<\223\240\215\325\033\302\326\306\b\345\30636\2457\273\257\254\337\302yY}\211\313\372\024"
+	.string	"\333?T\304\304\214Ot\244\206\320\234\300d-HT\214%`\300\214\322\033\2378!\342\"\310[\326F\262\031H\314( e\034\353\333\311\250\327\275\214Q\035\251\2414\b`3g\027\225\247\243I4jl\0225\244\356\255\211\021l\217\315\033E\311\030!Zj\306/\266\nI\326\325\036\335N\022\301\2721\t\226\221\253\255\242C$\303\236\323\236\225\274\367\350I\003V\343\022\002E\311\215\\72\001a\204\303\201\231}\305\310\372\306%\306\255\377W\344C[\002&\353O\240\310\276Q+\353*G[\326\317\023\030\322\2010\213\223$R\236\246D\n\023(Y\033\263~Sx"
+	.ascii	"\231\312\372-\024/:\240Y\177\002>v\262\006\022$Fh\016b\225\244"
+	.ascii	"\"z@\033\3210N\214V7B\351\220\214i\312\372j4\304prW\224\365'"
+	.ascii	"\240\264\231LF#F#P:\334\362\206KRY_Y\037\006\275\235\204a$b$"
+	.ascii	"b\254\002rD\207\033F\302%n\315X\225\224\365\205\347$\353\303"
+	.ascii	"@f\377\354\031\205\030\205\024\267@\021\237X\276%Qu^6\007\332"
+	.ascii	"\244\244\214@\260\330\253t\001\272%z[vSH?n\004\342\20445\225"
+	.ascii	"\265\221J\r\363R\247\344*k\343\224\0326\244*J+k\243\017\030\332"
+	.ascii	"6\007\236\030y"
+	.string	"\030y\030\211\300\244PQ\263%\353\303\020\2669pe\2142F\025\323\232@u\204a\251\313\3720Tm\016\350\300\201\303\bU\201\323\257\313\252\306S\216\033\241d\350\220\262\226\265\361)\017\261u\355h\203\301\306V\276\031\335\030\303\310x\243x\204\337\367\351-2zyD\261LNe\364\362\336\243'\rA&vZU\224n\274q\243\r\020F8[\224:\350\220\254\2155\216\211\240qr\224\365\215L\306\246\377\367\273\022\023\245M\326\177A\3156.!\340\377/\357\320\363\301\227\2651\351e\204nky:\2626\322x\231a\224\260!\306\031qTtEY\033eL\201a\366\226\365_ \263\215G7\"\201\261\275\240\313\372/x\331\306\0277\302H\222\233\313\372/l\331\277\321\305\377\023\2321\342T\225\365_\200\333\177\201ms \317\370\032_#\221\216\236\023\225\336\3462k\262f\034\272\221\210L\230,j\246\274"
+	.ascii	"\266\225i\332K{\025\333\020\001\3629\205Y*&\375p+jSd\003\027"
+	.ascii	"\007\027\227u\221/\002XZo\326\177aiO)]\263\206\350t&\251\210"
+	.ascii	"\336\326\032%4\332\262\376\t\276\255\\\202\207\027L\223TD/\257"
+	.ascii	"\345\223B\203\f\335V\026Q\243\246H\021\310\224\231\032\225\255"
+	.ascii	"\354\201\006\215\221a\021\222\214+\\[Y\303\214\231#j\231\223"
+	.ascii	"\".B\266\022F\2312H\210\360m\361h\3321\354\215\031c\005\325\013"
+	.ascii	"R\306\226\365O\024\355\030\312\204\tS\004\263\005=\262D\364\212"
+	.ascii	"\3311\320u\351R\004\243#5\204F\2033N`I\2125\312tq"
+	.string	"\003SGd\303g\304\303K\361\213\260\310\213KY\3267\221\345\305\304\216\035\303\025:\272\342\026l\214\026u\251\202Za\352s\312\372&\\\354\030\316\344\344\212[X2\035:\334\266\336\024,l\013V+\022\366\302G\326w\241\313\216A\t\034\\1\356\002>'\255\2465yg\216\262\274\030\227\006\345\253\257\255\310\216\241\207\233\033\346r\262\212;r\211:e}\027r\354\030\220\254X)\266\345x9Y\305\375\240L\275sW^l+\222\271BTF\025\373\231\351\242eH\326\227"
+	.string	"\227\rTcm\255X\245\013\n\214^)\215\241\362b\225\375$./+\353\342\024UL_y[{\237l \256(Q\212i:i\234\250\212/\360l`\221\362b\032\031\341[\321\323P\326E45\354w\207\225\246\215\004\214l \030ffE(_Y\305\246,g\346\240\260)\261\373\272\312\372\022\300\261\201\324\310\310\212O\202\234\250\364\204}g\\\256\234\274\370D\3235\361RW\242o\003\rI\245B<,\366*\205\300\024$\252-\343B\310\230\254_\302\313\006\"\322\244I1\f\213\275J:g\234\250\364J"
+	.ascii	"\222\006M\364\3050\f\345}2\342\004L\022\0370\262~\t!\033\350"
+	.ascii	"\213zF=S\374\322\240\3474\245\205\350}\331}\261w\27759\244\330"
+	.ascii	"d\275,\343\342*v\351H\r\231!\300\227To\213]\262\303J[\027&\003"
+	.ascii	"\303\264\365\325f/"
+	.string	"\275\266\266\210N:RCj\200p6\346\242\212sthya\366\262\b\326\261\212ZX,\203\"J\320\266\237\264\211\250\207\226\022\r\267\204\256\250\244\230d\357\251\314\326\231\250\306\201FL\252\230\205\263\2009\242\"\204n/o@\241A'\245\275\273\255\367}\322\240r!y\351\361\266\201\372\214\030)\"\341K\342\2622\324\322\224\306t\344E$C5dr`C\377\177l\234\022\237\036\225\r\204&H\220b\325U\243\227\007\017\"TR\221\365\211\224*MY\027\253~\020F(\022a\253rV$\353\342\220V\bYS4\353G\300IQ\310#\260\265\227Uv\376\027}\024}\024\177`\261WI\202\265\254%\032\202Pq[\360\250^\374\301V\364\202\232u\311\2728\025\201$\373\005\276\235\027{\024{\b\321t\214\257\2214O\355]z\362\3407ew7\315\372\021\220\3320(\351\2758\244W\334\341\241\350%\342:"
+	.ascii	"\023\250\007T^\254e\035\225\243\2401\263"
+	.string	"%\353G\240\306>\366\"*\032\201\231\272(\026\325M\217\2121\260\334\020\007he)\276(\026i\201\336(\352(B\025\237\212N\305\034XZ\304Q\224\241S\304Q\204\341\0257}\337h\021\007\313T\254\201\345\236\214\257\221\2241\323\367}cL\311\355 j\242\217\271\240\350H\004X\230i\261\251h\003K\2135\312\2125\2123\212L%\264\335\300\363\252`\303\360\f\227:\035\254\376\213LK\304(Q!h\262.*=\341xs\221\365[\230\333\177\221\006\226\026\223\266\232\255\265\2751W\252\250\264\354\2670\245\210\264\273Lw\304e\375\026\242\354\267P\266\337\202t\277\205\256\375\026\264\366_4*\026\215\271\245\211\313\372/\026a\262,3\212\262~\013X\233\330\246\370\026\231\240\r\271\310\372\304\276\377\277\026\252\264\234e\255\331\344!9\254\240\311\372D\276\342R\335[%\353\023\367\376\377|\230\224\260\262\016F\331/Z"
+	.string	"\322\301\272u\344\314J\326o\201\306\206\341\306\230\023\361\306\020\3634<\021Qi\300D-\312\203V\214\034\231\253\254\243em\212\264y\2215\021\rQ\r\361\356\377\021\251$\315\340\312\372-\270\330'\246\0312wDI\326\031\237\215%\2329\361\314\377\013\216=\361a\227\365[x\367\211e\210\323\377\207\203l\301\265\311\372$\362\366\211d\370\232\352\302\262\016N\331/H\330u\020\003\217+\031Y\237\304\331f\232\205y\230\027\207\rZ\354\361\344\245/\353\223"
+	.string	"\33304\251\303Rb\035\021L\323\001\232\274\355\333\006\344\262\202<e}\022V\2339\306\213\227\341U~\337\367\205\266X\230\272\246\357\323\223\006\341\031\220\027O\262>\211\036;\210\b\027.B\274=\022F;HJ\314B\314B\234+\276I\315\361m\021\267\2348\367\353\032\252\212B\224[k*\353A\224#jA\303\004\265\324\266\271\204\261\"\205\030\327\256\265U\204\004\321\222\365Y\230\356\016xy{\023\342\341\023\366\210@\247\354\346\213\345X\336+5\026\222\354\020"
+	.string	"\271\362+D\247\337\373\252a\227\254E\324$\315\310\372,\360\330!\270\252\362*D\266\343\245\027\212U\"\247s\004\001;\2235[\036R\355\226\310Ye}\026\210\324\210S\324\206WALk\304)k\303\253b_\024\330\305\312\307\213\254\017\0014\373\020\310\022\205(%\312\024\032Q\n\021M\210\267\207\224<=iX\323\254\3413\223\365! e\037\002[bD(bD\263&\224\224\bEJ4+\342X\312xqTm\312N4k\211\240\241\202\313\232\370$\270\0048#\215\013\034\321\311\027%&W\210N\210dG\262\304 QU\260\207D\2319\021\307\2027*\320ct\370h\222\365! d\037\002J\033\331\264#,\302\304h\224I.o\247\320\002F\004S\262\364\2005.\242\027\227\n\"]D/b\227\020\017\277Kw\301\034\357\223\006\226\307\031\273\272\254\377"
+	.ascii	"\351\376\003\220\354ki\t\361\330\367\305Q)\245\245\367iIC\007"
+	.ascii	"\264\226\020\267\210K\204x7\022uM\037\240\264?\002\314\276)\333"
+	.ascii	"91I\022\341\031\021RD54H\223\304e\205x\246\353\312P\326\037Q"
+	.ascii	"e3\200\313\316\211XX\302\351\317\350%*\002\264\221TDo\025{2\206"
+	.ascii	"\315\330&\301\266s\"\024*$#B\352\255\241\301\225XW\022\252% "
+	.ascii	"XY\177"
+	.string	"\204\325\016q\266s\"\022$B1Y\354e\"\236Q\t\202\231\233\242$\353\217x\332 \200\354\234h\204hDh'B\352\255A\202\022&=\260\274&#!4\262\276\b6[\002KvN\254\"V\t\353DH\275M\"0\361q\307\227g\304#\213Q\326\027\021fs0\3359q\310\261\2248D\350e5z\211\272X\275<\325d\315\r*;\204';'\006\t\362\223\322\021{\233\202deJPv\356H\030\"L6\001\216vN\374\361c[\361`\364\3768c\261f\004\341\n\3628b\263%\353\213\350\261!\200f\347\304\251\251m\245#\3666\341\024\211\321\341\266F\301\321\305)\353\213@\332\b\340\3339Q\352XJ\224\022\312\211\220z\233H`RCo+\317\356\310\215\273\273m\324\261s\"\017\036Q\206P\314\366\232\210\331F!;'FE\245\t\361^\2741s\333\250\264s\"\024\2240\016\337\030\301y"
+	.string	"\264C+\362f\375\025\326\266\261h\347\304'\342\2230N=\222\"\242\322\300gc\317-\357}\341<\370\355"
+	.ascii	"R\364\224\365W\250\332M\351\215\033D'\266%\242\323U\026\325\214"
+	.ascii	"\254\277\302\215\375\274\261\223\2530\261\351\007a\004b\022\261"
+	.ascii	"F\256r@\321\373\362\030B\304\241\266\202\214\375\020}\033\006"
+	.ascii	"-;\230\t&*a)Q\211\270\364;z\337\032\032\232D\347\370\362\204"
+	.ascii	"qp3l\274e\375\020^\2663\007\321\005\321\005\221\006\021\307K"
+	.ascii	"\234q\"\215\240\2133exdM\224Q\0017#\270\254\21114\264\b\306\212"
+	.ascii	"\030h\326D\244\227\231\243\021\205-k\342\321\313\220\t;s"
+	.ascii	"\2225\021\306\331\244K\354\330dM|\321\322y\211\262ck\351\202"
+	.ascii	"TY\270d\311\372!\246\354\036\247\235\023\213\210E8\240!\242;"
+	.ascii	"\005\321\316\207m\260t\330\2068\224\247\336\237\230\254\031\323"
+	.ascii	"wi\311\003\342\320?\354#\276-\226,u\306\206\233\222\254qT'D\221"
+	.ascii	"\235\002j\347C>\276\241\236\316\tYI\320wi\213\007\017\341\264"
+	.ascii	"S$\355|\270f\315P\217}[p\311\2421}\227\266x W\024\266\351\242"
+	.ascii	"\363\221\365C\f\355\024X;\037\342\341\345!\035}\231\330\254w"
+	.ascii	"\216o\253n\367 \331\371P\215\232\257*\273'\306\316\207h\320\344"
+	.ascii	"!\021 \256\270\240_\273gj\347C3f\260\332\372\276RDX\034Q\025"
+	.ascii	"\210\354 2e\312\f\257\212k\257\nM\333\2044;\037\216\031\216\311"
+	.ascii	"I:t\331\227=\262\254\257\302\3206\301m\347\3030a\362\023\021"
+	.ascii	"9\212Q\312\246\314\225\331&|\355|\bf\b\346\t:\027\367\364f}\020"
+	.ascii	"p\373\204!;\317Qr\224\036\320\241\331\216hV\326&@w>\3642\364"
+	.ascii	"\222\3174\354\327\350J\t:\206E\344K\326\007\001e\233\360e\347"
+	.ascii	"C.C.\371\t\316"
+	.string	"\321O\352\n\312)\213MW\326\007\201\265O\320\261\363\254\246\306#\307AQQ\312\372\204\244\235\347\2655\254\246a\277\321\253\035P6/\356LF\326'\f\355<W\311U\260\032\360\b\017\375\270\212\232\276o\233\007\030\315E\035\214\254M\240\332\371P\213\226\234\224\305\336%\226i\316.jK\256G\r#Y\037\304\324\026\201j\3479..o\311b\357\020\260\212\215\271\250\240\2310U\\Y\277\220e\347C\270c\351\020N\230E=\222z\2334\270*\362b#\314\230\032\\\262>\210w\257\360c\347C7,\035\272\t\337t\304\336\241v\f\035\325S\036\223\2242\243\254\377aosx\332y\356\222\273\344\272,\366\016\231\200Fok\353}\237<\020\362\021i\231\311\232(\335y\266\313vy\214\b\251\267I\2038\245>\315%\005N,\353\003\250\355<\2279\226\3462B,Y\354\035*\2365\335\301\315\265A\272\313\272"
+	.string	"av\236\321d4\371n5z\177\fa\247\320\230\202\"~\225\031\261\313\232\205%;\037V9\226\016\253\b\331\324#)\004L\351J\262\225c\357\214\223\254\377\001o\177\260\261\363\341\224c\351p\212\220\n\tWaz`$\312\352\230\262\376\0074\273\205\271\235\017\325\216\245C5\341\232z$\3652\235p\265\345\216\317\203\027<\260d\375\017dv\b{;Wc\304p\003\222Q\025\371\312:\2042;We\310\370j\245\304!\235e\035\002\335\316\325\0313\364\225\377\214^\242!jmi\304\004\311Z\004\030;W\221T$}E\213\275C"
+	.ascii	"\350\222\366\344\201zW\024\347\224\3653\314\330\330\020J\220"
+	.ascii	"Mm\216o\313\354C(\303#b\222X\311zH"
+	.string	"6,\373\377;j\221\032)\033>\221\342\222\301\243kH\231\351\320\211\232\224\335t4\331\372 \267W\260\211\211\t\361\262,}P\333*\326\300\300\206\321( ^\223\017\243Q\250\364X\222\253b4Q\341\221\365?0\331=Sv>\364\362\222\372\300c\257\370\342\342\022\342}\275s|[\037\224\366\212\243\254g\r\267\366\373\276C\321W\t\210\345\235\343\333Z\362\341\026\261M\b\032/Y_\315P\353\377O\215\002e\315\220\241\326P\311\231\026!Ok:\312\210\031/Y'\321Mt\330\3776Q\221\321\222\365?\fm\025EVV\303\253\257\2459>\350\207WOjf~d}5z\356\377\017\357\355\250\361f\375\024\320l\022\210v\256\312a\251*\247_h\261w(h6e\267\2634\315\205\311Z\205\016#F\202L\266\354\236\270\235\017\253\244\303*\254\246\301\001WX\240Tv\217\223\235\017\207\f\311\261\224B\327\366"
+	.ascii	"\233 A\204x,\233\024\212l\242\220\235\017\177\034K\207?\204i"
+	.ascii	"x\t\277o\2324i\372\276O\036\f\275\354\226\\d\375\024pl\021\344"
+	.ascii	"II\r\247\360\322\373\276O\357\320\231\017\224\370\b\022\345\343"
+	.ascii	"\303\251\256)Q\034Y_\r&\373\377[\251\356\304\244e\375\024\220"
+	.ascii	"\266\007t\360\340\301\246\206\202\226\235\202\312\316\207Q\307"
+	.ascii	"\322a\224\332D\002\357K\364\305fMQH\333-\230\3408\216!\324\215"
+	.ascii	"o\213%\307\207PP\210`\331\313z\370\324\276\305Q\3658\333\215"
+	.ascii	"\265\256,"
+	.string	"Y\037\005 \033\371bgX\003\017o\334\b&\371\275\357\024\022\226)\212\002\216}\034L\302\246\b\262\363aS\023&S\337\227\307\020\366j\252\267\221gv>\\\032.e%\352\321KD\305\336\200\276\036\334\001\323M\324\261\363aRRv\"B\212\250I\203\253\265 Q&\204Y\275\355\036\256\235\017g\314\310U*\016\351\006\301\221\243\241\214\243a\214\033\211\324@\207H\037\306\020~)\215AKbW5\r\223\365\035\200\265\221mv>|1|\221\207~\357;E\204\275!\027\365\340\016\320\261A074\032\032\t\361v\260f\242\r\350\333\304\264\235\017\211~\020F\300\322!\021&\323\221\032:\243\301T\251\017J\263)\343\205H\326o\300\333\366`\307\316\365\227\376\312C?\243w\212\bpKi\357.\357}\333< \036I\243\364\2255\004\276\354\\\330\327'\234\323b\357PQ\nF\207\033\360\310KX\230\254\337"
+	.ascii	"\251\r\002\276\275=!\233(\266\353\025\362]\310f5\373q\346(\353"
+	.ascii	"\253\tf\205qq\341\226\365\033@\264_P\263s\241p\215\020\315\303"
+	.ascii	"\373\376\200\322\200\311\223\007j\024+&WY\237\001b\266\212%;"
+	.ascii	"\3024B5\027\336]x'\304\273\361}_6js|y\357\323\222\206\377j.\304"
+	.ascii	"[\347\222 \201\222\365\031\300\266\377\343\347\237}\211\226\336"
+	.ascii	"\367mZ\243\257Z\221\220\375\361\361z\254\341\037b\025\013\340"
+	.ascii	"\277~\003\260l\340}{\3404\254\333\024\2164\032\274\377\277\337"
+	.ascii	"\327\305\033\235Z\312CGcSL7GQ)\246#8\"\246\233\243\261)\246#"
+	.ascii	"##\246\240\243\261\350\320\221\321\273\204\337\261w\351}\337"
+	.ascii	"%\r\216^\"\246wlj\311\370\216M-\275\321\027\007>z"
+	.string	"\211\206\216\214^\246\035}\337\367\210\210\t#\275RLGcSK7GcDLGcDL\3067\372.\275\321\037K \210\230d\214\021-\341\243\350\024\323;6\365\336\264\351\"\352\361%\r\025\037\026s\324\267c\350\310\350M\262`\313HjI\356(*\205\325\336w\250\354\305\273\204\243\357;\365\276QR\033\250\031!\031R+\222Kj\237\214\206r\320(\242\222\372E\213^\271\243$R?/\336\267\356\245!\302\020\036\212\276\357\013\343-\032\302\357\373\"\272\364\276ER\033xz\337\367\225\302\\`,\275\303\327\210hF\021\225\224\360E\221\024\2147\211\017\374\276\357\313t4F%\345a\315\311\030\364-\212\016\341\243\031R/\364\255\233Z\332cC\321\367\350}_\214f\210'\245K^\326Q\t\236\226$e-4\243Y#Y][Y\237\001R[XFF\233\264\251\254\317\200\033[8fl\310\031\267\254\317"
+	.ascii	"\027[\030&\267]\242\f\201\311\372\013@\263\205`b\264A\313\312"
+	.ascii	"\372\013\310\262\205_\206V\330\324@e\375\005\250ma\027#b\310"
+	.ascii	"\320\262\376\002\276\364\350\224\360\262\216F\325x\230\331\310"
+	.ascii	"Z\270E\013X\0251Y\177\001B\266P\013\031,giY\177\0019v\364\351"
+	.ascii	"\b\r,k!\034\234\032V\326"
+	.string	"_"
+	.string	"\323\026\272q\tr\345(\353/ \306\026\266\001\323\316\236\230\262\376\ti\366\217\245O\023Z\t\203\276\357k\024\332\245A+\313\372'\220\331\302*\321\031RoY\377\204\272-\2342G\026&\225\365O\230\333B5\0359\251\030bY\377\204\267-\224\002\005\rU^\326?\201l\013\243d\275\225\203\211K\326?!\311\231Y\373N1\n\313\332\002@\260\260T\210%4\303Y\232"
+	.ascii	"\220\274\262 \327\027\2664\025\214\234\234\262\376\205Z\027>"
+	.ascii	"\371\205Y\302$B'B*OC\304dM\006\324\222\232i"
+	.string	"\313\372'\334\360j[\022\307\307\365\266\225\305+-\206\033\224\207\026(\226\227\220\t\034\230P*\f\023~\t\305\204M\204c\302(\226\n\275\204]\354\215%[\216p\364M\270\3337a\314\276\t]\366M\200\3337\241\312\026*\361p\241\326\333\213<\265\254\237\2073\260_\363\342\034\266hB\330\225\225j\206$d+k\013x9\202\245\302#B+\2643e\240\256\262\026\"\021\332\020J\021\221q\204J\3267\001\211\221\252\266\314\207\2222Y[\200\f\nK\205P\302*\234%\013\204)B\204\275\242D\212\221\030[\224i\326\302!\277P\2070J(D(\225\006\207c+\353 \304(&']Y\337\004$0$3\036g\320\367\215\366\200\322\343\253\2070\206\220J8%\374!\224\022\002\021\372\300Ra\017\341\016\235\265\310\231\243:\242\276\002\372\366\025\340\266\211/\316a\261\002\236\354_\230C\210\003\f\313\032\244\254/"
+	.ascii	"c\0073\301B\030X*\204!\304\201\2634\2013\270\351\273d\303\003"
+	.ascii	"\247\240\035\031#$\302/fV;\262\026\336\3703\030\341\221\320\206"
+	.ascii	"P*L\213S4\353\032o\333\244\367\305$\353+@\310\021\244-\250PI"
+	.ascii	"\310$\244!l\022&a\251pI(c\006\023\341R\013\246\205\003bd\232"
+	.ascii	"%\\\022\306`\233\316\361\345\032R\332\254\204\372\n\220\332W"
+	.ascii	"\300\273_\002\336~\te\366\360\3059\354K\200\333H\036;\302\","
+	.ascii	"t\201\245B\027y\b\347\305H?\256\224\246\357\222\232\007/!\272"
+	.ascii	"\217\363\020\213b\315\316\203k\244\3015B\242\237\321\373\343"
+	.ascii	"\b\313$5\307\267\252\201\023\253\313Z8\204\213\370\300a&\353"
+	.ascii	"\227\220\265\373\202{\3016\027 \275\357\0170\254\226R\325\231"
+	.ascii	"<\341\213\245\301\276\240\336\006\035 \030\222\227\020\255\203"
+	.ascii	"m\202l\326'hkR\262\016\362\005\305\352\324\276d\375\022`\354"
+	.ascii	"\227@\264O\202\232}\022\344\202xRPR\242\254OB[\360\256\307n\347"
+	.ascii	"\3013\307\322\340\231`\232.V\0074\210f\354\213\315+\353\223@"
+	.ascii	"\266O\002W\373\326C\315\223\230\2547\260\262\363`\031,\r\226"
+	.ascii	"\t\216Q\215^\"+\266J\222\326\035\206\221\366e%\353\223\020d\377"
+	.ascii	"A2c\322h\251c\222uP\314\016.\250+Y\237\004\034;\030\246\214\310"
+	.ascii	"\346\210\f-`\036\264\353\"\345\314\220\254\263\231\207\007\301"
+	.ascii	"\344\257 GUr\017\326]C7\360\276Qz\330\3201\327\345\301/\177\020"
+	.ascii	"-\350%\030\246\205\217I\326\030\212s\330 \027\017\017v)\356@"
+	.ascii	"2\364\224u\316"
+	.string	"\334\203t\1770,O\231\241\343\251L\326\301\271lU\366\366\246\345\301-\177\320-(\327CL\354)k\274\204sX\340\232\207\007\26501!\203\362\366`\334\037\204\013f\271\361N\275\310\032?\341\0346\003\316\300\006\335<<\370\3663\323\013r%k\034\234\201\rb\371\263\027\215\005\302\f\"B\256<\330\366\007\251\350\254\252\0335\264d\215\273<<x\245H\227\246\006I\320\312\221\321T\222*\017\262\235\355\263J3#\353 \025\017\017V\t\032\331\200\202$\353\237\332\203S\376\340\232\246\363@\037\033\274\254\2078\003\233\243\036\036T\213\2632m\"\345\301\264k\350\006\252lH\301\313:\210\346\341A)\303!F\264\322\262\236 \030\005\272\201(\254\037@\312\036<\373\203fA(\3029\242\252\252\254q\031\316a+\300\031\330L\347\341\3012!\225&\261+c\017>\371\203dA'\354\230/nJY\343<\234\303\006"
+	.string	"g`\201c<<8\026d\023\345\f\221\330\203\322?k\321K\336\260\320\355e\035\f\363\360\240\330\356\353\243B$kb\260\311\203Q\r\335\200\224,dA\262\306^<<\330D\377\270S\302\312:\b\246\241@x\330\365\310\272\347n\347A\257_\213i)\226\006\275\364\024\t\274/\221W.\320\261\031b\204\220O2\305\207\237gr\002\256\363\205\345\021\311\201\223\205\026\312e\004\234#|\230,\364(\205\230?&\232+"
+	.string	"s\236\313\244\272z@\211\344Y&\237\312\244\020\n\036\236\341\2173\271t\225A\256\013>L\026\226I\0377\005\025\\d\223\031\302u2\225\037\224J!gR\202\245\033\024\001\025`\030q\342\003\n<*\200\210"
+	.string	"\t\236\017.\360\230\030\301D\362 St@>]\236\036\342\222\351<\272."
+	.string	"5\217\316$\210\247\353S\fr]\024\035\230If\023\231$\341\002%O\270>\0248\223\032<]'\220\013\304\202x\272+ \237M\242\362\210d\262\360<\0025\231!2<\227#\230'\236G&2C\360\351L\262\340Lfhq\234\300\323\3651\272\313$\013)\226\256\262\371t\262%\\\3441\310\204\212\246\353t]"
+	.string	"\241\001"
+	.string	"\224G\244\363\231D\321Ah\351\203"
+	.string	"\026B\313\244\022\001\"\354\360\354\220\300\242\003\322\rrj\260L\321~\340\220S<\227\311\246\222uW`\321\274YqtA\002\327\007\205\247\353\023lA\b\341\271\034\201B\310\304p\307\203\t\021R\200\301\004\t<$|\310i>\235\035\334\036!%r\231\354\320t\nu\230@\251\024Z.\231\313\366\311\343z \351dW0\233?O\346\262Mqt\225\332m\n\005\351  $\220\013\304\202\020\202\211\020x@\3609\236\370\341\340\362\024}\226I\347\b\026\315\fn\023\005\026M\035f\263\305\nE\024t>\340\244 \201\211\022+\020{\226\311\024\256\317\362\350\302\004\377\341\340D&\237N\346\322\347\230\354\341\231\240\304\n\021O\327'\247\304\323\365\241\300D"
+	.ascii	"\\\236\236er\305\363\b\224|:Ux\272>9/\220\030\361t}n\376\303"
+	.ascii	"\341\271A\nO\327\007g\307\203\253\354\031\361t}$p._\370q\n)C"
+	.ascii	"\374\207\203\3172\251!\005\030\236K!\022O\327g\350d\252h\272"
+	.ascii	"&\232.\213$\tg\022\247m[\227\307\304\b\023&\\x\272>\303\036\244"
+	.ascii	"\217\332\"\210\371\341\371\037\016AB\314\246\017O\323}\272\035"
+	.ascii	"\220K\241\020\301e\212\354\344\361\t\022>y\226>A\353\322'Hu="
+	.ascii	"\220tj\247\323m\366\364\034\333\026AL\244n>\203\324\013[4\237"
+	.ascii	"\316\244\217\353\002O\217\333\366\270N!\355l\177|\036{x|\202"
+	.ascii	"\206<\356\363\250\f\002rO<]\247\353\202OP\006\317\344r\204\320"
+	.ascii	"\331\343\303d\301\207\311\002\006>L\026z\226(\304\200t\177>`"
+	.ascii	"\360L\366\250\320\342H\"\347\351\256\340>\217=A/\020\177\234"
+	.ascii	"\311e2\204\221\202 \327M\301g\231\004j\242\360t\036Yx.]\247\333"
+	.ascii	",\301\301\360\331<>M|\300\341\331<\006qp6]\240\344\t\344\362"
+	.ascii	"\250\242\007\205\002HP\224`\002\013n(\250\340C\005)\340\270\317"
+	.ascii	"#\b\027(y\342\267d&\235I\025\256\013\317\344\n\317&\363\307i"
+	.ascii	"t6]\025.\320\261\005 3\3052\351la\342\367\001\207\036\327]"
+	.ascii	"\006\235.\320\261\205\236\245\353\274\361Y&]P&\217'\216\256\210"
+	.ascii	"\0367(\210\331\004\341\324\0311\242\204\220+$\001\023\306\233"
+	.ascii	"\036\267\231t\272 T\034\2278-\236I$S\350y\243<\n=\221(<\235\356"
+	.ascii	"\363\310\202\212\343\222\202\017*\216\313\342\17788;\254\314"
+	.ascii	"\346\021\205\3669\002\251H\344Qe6[\370\350\246\333\343\366\270"
+	.ascii	"n\013)FL`\301\n\246\322\004\261\347\310T\016] \246\b\023%"
+	.string	"V\270y\036Q\250\030\002\035\233)\216\315\347r\204\373L6W\024\207;\036\fP\004!\204&\263\204\n\024|\226I\347\013-\216\315&\n\006p\237\307\347\320g\231\354Y\272%.H\002\261\370=]\237\036\241\024D8]\240c3D\213%\n=\256\217\017\223\005\n\236\256\t\243\373\203<~H\n\245\360\037\016>B(\334\236\016=\312\244\020\n\267\207I\342\307\343\002%\237K\241f\007d\n\013z\334\037\344\021\271|\341\351t\237\030Lpd\262\351.]\237}\021v\020\260C\002\213\366$(\340\003\005|\300\236\004\005x\360\240\200\035\017\373;\036\324\347\363\371\274y>\237\317\347\223\247}:\233\256RH\205\234\365\371|\032\237\031\214\030\321\226\330%Z\3472y$\201#\002\371S\036\t\260\2023h\205\247\333\303D.]\326U\006\001%\003\320\343.}\222&\234\311\375D&{\334fP\353\\\301T\232`\001"
+	.string	"\317\377pp\"\233\035\220)\236<J\025Z\034\233\315\3433\211\342\306\371L\242\320N\236\030\234G\240g2\005\026L\024\302\030\234G\022n\017\223\004\262)\201\313\3233\202\005\023E\373t\006\371"
+	.string	"Mdx\266h2\237\316\244\210\025L\2453\370d\211=K\346\207\020\024<\335\036\346\207&\263\331t\177N\236\027H\214h2\233M\025\204\200\222[H\202\247\223\247\202 \327M\001\271l\341\334O\247\363\250\3749y"
+	.string	""
+	.string	"|\036\231\312\020+\334\345\320\3113\200\245P\210#\216\317Q\031\342yd*S\374V\270\313\375\\\272@O\247\020\007zPX&q\236\377\341\340L\341\366\360\234\030:yx\236KW\205\n>L\0262X2\223\317#S)t\201\204\234\256\013>\313\244\217\017S9\374\017\207\016\310\013R\024\235n\b\267\370\037\016>\311\024\024"
+	.string	"\271Og\013'1\207\205\333\263L\362\360`\340\3660\201x\200<H\020\222\277\030\220L%\262\351\366,_\020\nB\016\233O\347S\231|\016\340?\034X4;\260hf`\321\0046\205AG dsm\272=I\025\314f\020\017\213\246\362\230l\272\316\033\026\2562H\bD\n\345\361\007\030T\354I\"yR4y\222AN\036\026M\nn\230O\241#O\3172\211\202\347yt\362"
+	.string	"\t5\2371\270AN"
+	.string	" y\204\313$\213#\211\244\323\331l\225G\025M\367\271\034\201\\\2660\341\024B\3414.\223@;\006\244\373\203dq\004\332\313$\322u\n\361\2608\002\361\260h\006[ \227\256P\007\334f\bd\363\306\355I6\233\256\212\b\0049\20128y\222Ng3Xt{x|\216@E\237#\320\317\347\b$d6]\013\370\034\201Z\237#\020\320\005J\372\034\201(P*\231\315\2421\211tA\2548\266 \336\370,\223\313c\262\307\005\342q\235B\022\270\310\345\261\351*\231O\036\036f\363\210\302\202\034$\362\370s\233\307\025=\315\343\217\007~\220\310#\220\331t-\200D\036\333\347\223'\205\333S\301\1778"
+	.ascii	"@\210\307\t\224l\236p\202\310Y&\217+ \221\307\326\003?B$\362"
+	.ascii	"x\303l\266\360\021\002U0I0\233-|4@.[\230P\356\024AJ\036\017\374"
+	.ascii	"\030\335\240\026\317g\n\246\023\307u\n\3610\237A\017\374\f\177"
+	.ascii	"\220O\346\362\306\003?\0238\235\307\240\025L%\017\b\256\317\361"
+	.ascii	"\251\343\372,\217.H\340\306\003\"\226I\022\0244]g\013\345q\211"
+	.ascii	"\202\316\017\362\311l\201"
+	.string	"\331l\261\0022\tt\\\266\350\311\351\300\212\355t\272\313\240\346\361\307\311c\354q\225(\216K\025\226G \3451\206\341\17788y\220\315\013\220M\234\275\342\330B\350d\006=\225\307\233\236\345\021E\317\321\355\341\341\351I\002\345\270A-N\370,\223\312\236\345QD\206\023n\017\023\250\231<\352<ALp\263\"\005\022\210'\206\345\021E\353\006\265x\022=\360\303#t\203Z<\213\036\370\341\001!E\220r\350\201\037\236\024AJ\236\025\307\026\300g\022(\251\344\351Q2\177x(x.]d\323-\361\\&\231%\202\204z\226\311\tP\260\342X\001\235\037\3443YB\251d\272\260d&\235I\026\307\f\226I%r\231\344q\225>\313#\017\213#PNp\305\261\002&z\222A\304\025\314\346\317\t\235\036\327\rr6\223(\270\310\245\333tS\270.X\260L\036WXq\254@\217\373<.\223=M&\363\003"
+	.string	"\234\314\0221 \223O\023\313\b4\335\347\b\0014\223=<M\367\231d*\215 ZP@\351\302\240\342\270\304q\203Z<\215H\036\034\026G\245\333L\006\233\314'\362\030B\350*\225(<Q`q$Q\001\263\331b\205\247\223\311L\241G\202e\362\270B\261\311Da\202\024)\230O\241\017-\236I\025\307\246O\362\271<\336<\223@I\026\200\204\234=\311\022>=\"\234\314\022+B\2508.'x:]\267\351\343\202p\225>K\024\200\216\037T\004\245\300A:\223@\332}\036]\310@BO\222\004\262\311\202\030Qb\331\242\207\215\341\3506Q\360\034\203\206N\022B\307\023>\313\344\004z\\\026\311\024\304\235Dq|:\201\377\341\020\204\354\200$"
+	.string	"\262\331\222\300\fb\241\302\212c\005\220M\240\323}\036\233\253\362(\264<\002\261\317uE\253<\"\223\317d\023\271]\236gr\371\302\207\347\021\305\3153\271\024\322-\236I\3441\350\210\334N\036W\231L\301l\2260:\225J\027\271\002Y\034\227I\022J\245\213l}\226\311e\3638\001\245\322E\262H\002u\030\2628\002\005\221\313$\020\320}\036]\020*\231H\346\223\331,\001\264\242\004\022\005'\t\027(yB\351\"]\020\306\b\270\312\236\021\312\3433\351\223\354\231\300U\366\214\020\272\312#\322\304\220Y\202\370l6\217\252\223g\311L\341\202\350Q\272\311\020\025\270@\307\245f]\240c\013\304\247\223\347\311\374q\006\035\227&\236\311\237\223\207}\376\207\203\0069\353J|2\237\311 \340\323\365Q\237<\315\243\362\2104\361\344y\376\207\203\363\347y\004Z\362"
+	.string	"\251N\036\025n\317\323\331\222 a\242G\311\344\001bM\254p\227<@,\353\n)\2170\364"
+	.ascii	"\t!\221G\243\362\250B}\3628)\370\017\007\244\006=J\346\217\323"
+	.ascii	"m\376\234P\341\202\350y:\213.\317\004N\022A'\t\327\003I\023+"
+	.ascii	"\230=\313\344\n\241\333\024R&\217!V0\225\312\2430\350dQ$]\017"
+	.ascii	"\024S\004)\267\363\205\347\322\005r\233B\316\243K\342\311\343"
+	.ascii	"$A\242\305\322uo\230M\327\002B\267)\264\235<\354\363?\034\232"
+	.ascii	"\356\323\005b6\217(\f\360\201\331<\242\220\300}\036\225BH\345"
+	.ascii	"\021\371{\n\355\026G\245\333\303\023$\264\237\317 !\236\035\024"
+	.ascii	"\001f\363\210b\310l\036Q\374\202\204x\236\256\017\3536\205\234"
+	.ascii	"N\267Y\202\331<\242\020\25686\325\377p\020\002J*\225\314\246"
+	.ascii	"\376A>\223A\353\212c\013\325\351\n)\217*"
+	.string	"\330\347\017\317\212\024@'\217\023\304\210\022\0268\231A\252\322U\241:\333\247\362\310\263\"\005\373\344)\366\270\313\344\261\371t.\231H\036&\316\323u\272\315\365\311\003tl\036K4]\245\222\331|.\231\037z\222A\022\374\207\203OR\305q9\200\020!bPK\304\220G\304\220A\304\220O\304\220\201\216\315c\320\372\374\017\207\023=9\204\207gPp\375\340B\346i\272Oe2\005\017P\323}\366\340x@D\212 \026\200\232\356\211\036`\223\371\004>\205\202\226I\236\247\363\250\004*\217M\037\367\271Ln\345q\311L>\233\314 f3H\350\252H>\217*\222M\267\007\330\323<\256h2C\364\270n\212\240\212\343\222gE\n\326\311\343s\004Z\237+\216.\374|\216$\264\317\221\204\317\021h\367\034\335\246V\301u\n\005\377\303\301y\f\002b\"\237<!<\217$\202R\354\377ph2\237HW\005"
+	.string	"\200\360\223\351\202\362\270l\272O\026\256\261\247yd\246\260d\266>G\240\355s\004\":y\220\310\343\372\374\017\007f\263\205\217\253\"\331\354)\200\313\263\364I*\217<\304\245OR\211\002\022y\334O'\217\213L\006U\270 \234B(\236\311\345\210e\210gr\231d\233\317\022\310\245P\210\236\243\353\002\022\211\202\004N\036\025.\b$\362\270\227!z\216n\223]\301\003\017\022ydW\034]\370"
+	.ascii	"\002\005\326u\276\300<!\004\224$\252p{\324\023H\344\361&E\333"
+	.ascii	"\001\023.\212$\fH\344\361\367\\\n1?\004%\225\037\220\310\243"
+	.ascii	"\260\307\r\nJ*?8\223\277'\017\017\022y$\376\207C\323U\272H\344"
+	.ascii	"\221\305\021H]&\201T\247\013\3446\237,\334\275\002\213#\220\376"
+	.ascii	"\017\007f\263\205\217\005N\036f\263\205\017\333\343z \251<&\237"
+	.ascii	"\311e2\370$\272@\311g\020\223\311\002\021\210\271tA8\235.\222"
+	.ascii	"\331,\321\223\f*\272*\222O$\n8O\036\347\013\333\304\323yT\032"
+	.ascii	"\237<@\311g\320\371\202\013\224<q|*]\020\2562\b\350\350\274I"
+	.ascii	"\261\237\314\346\021E\261\307\215\001y\fb\235+\230J\023=L\022"
+	.ascii	"E\367y|:\201\256\363\370S\302Mqt*\223\307\024\303\036WE\322E"
+	.ascii	"\272.(\217K\237\244\t\026McORy\204\301\251t\227\313\343\317\207"
+	.ascii	"\020,\2329N\241\347\361i\342\347\251<\272\"V\374\020]\344\362"
+	.ascii	"\330\343\006\001\215h\241\f\n\0222!\301\363\230\002\f=\356\007"
+	.ascii	"\237\243\023\247g\231\\\241\335\246\320\323=!\004\224$6\217?"
+	.ascii	"H\355\3449>\217 \226\314\344SH\3114\341\f\362\2719>\217 V\270"
+	.ascii	"-8\217?\300\347\321E\361l\036]\021\316 \037\241\n-(]\030\200"
+	.ascii	" \224.\f?\237#\t\025J\250\260]\240\344\211\236\244\362\250\342"
+	.ascii	"\347\3649*S\254.O\bg\220\217\320\rjq\202E2E\313>\177\224J\365"
+	.ascii	"\370<\202\3609\002\265 ThA\351\252`\203\256\263)\304\374\320"
+	.ascii	"\263\024b6}\204?A\256\252\"\310U\203\230"
+	.string	"=?\372\t\374\017\007\027(\371\354\260d\002\0011\221\0258\223Je\022\210u\362\270@\311\023\356\363\330\303\023l\036\335\026\372\347\271d\002\255-\216=\252\263)\304\374Y\235\356Sh\231\004j\235=K&\322u\266\316\240\025p\\ \346\017\217\211\022+\354\236&\223\211\3441Qb\205\337\363h\002Hh\311c\242\304\n\300\377pp\006\371t`&%p\"\231,8\203|\206\317\243R]2\225\352SyT\377\303\201\231\344\021\200\223\247\351\246H!\224\202\373L6'\220\343t\237-R\350q\177\234B\312\024\302\237\247\317\322U\262\307\347\261G?U\034\227@'\3172y$\221\301\005J>u\211\021 ~\317e\222\031\364tM\360\200\030Q\302\231dq4\226p&Y\240\340d\226@\002\001A\214(!t&Y\240\240ta@\002\025\205.\362\230\242)d\002\t\204\363T\242\260\"\005q?\205\202\236B\021"
+	.string	"1\242\204\223YbE\n\342\361y\004\201l\262=\313#\020\020\363\003\262\371\373"
+	.string	"\002\005f\263\205O\373\001\004\nH\344\221u{\204\236\311\347\363\270}\204P\270=k\223\371d\002\255L\025M\327\271>\217(Th\327\347\330t\203\200\216\373\251D\201\331<\246\320\366\270n\220\211f\362\270?\200@\301\347\b\304&\235\316\246Vq\\n\247\317Q\031B\305q\271E\300PB\005\025\307%\353d\226Pq\\\262J\027\006\345\321uA\305q\t|A\205\026\220H\024T\034\227?\245\013C\353d\226\020\2528.\201>\313d\317\321\025\361t}\232\307\023*\216K\243\373<>M\2440l\272=G\367'x$\013\267g9\242G\351&S"
+	.string	"]\240\344\211g\363\370t\376\204\260\222\311L\201gu6\335\247K\"\307\345)\266\377\341\320\242\351>\237G\024\035\234N\f\\\345\021\351\\\333\247\353L\221\202\311\272<M\246s\351\232(\272A-\236\372\271t\233M!d\353\362\300\360<\242\300q\221M!\246\t\327\347\370T2U\f\237< \204\340L\n5\221\302\246\273\202\031\304\343*{\222\300e\322\247y\004\342i\341\323t\227.\317\317\263y\363\374\361I\272+x\226\314\344\363\350\\\272A@L$\217\253|>\231\315\237\347\005\317\347\1778\364$\203:<\177|\222\312\024:!Bd'\017\t=\311 \266\004\036\201A\340\236d\220\352\344\211ayL\241'\031\364\373O"
+	.ascii	"\316\fr\233\035\236Lf\263C\320\311\343\223L\261d~0\002\t-\367"
+	.ascii	"\223g\307\303s\231\024\332@\314\245\333\303\343>\217M\240\213"
+	.ascii	"L\252p{\330%3\371D\272O\027DO\363\370\241\307}6]\025\313d\316"
+	.ascii	"\223\207\204\3472)\324\276\007\204\236\343\007%\210@\002\007"
+	.ascii	"\t^B\t\0374x\241\205\0256\222\003\013&\212\030\220G%\212\016"
+	.ascii	"\313\344\021\250\003\262\351\354\300!\203%3\351t\272\315  &2"
+	.ascii	"\370\016|\235\341D9#:u-\255\331?\016\224\233%\241\332\2153.\263"
+	.ascii	"\033\244\037O{fe\306>\242\\\223>\"Y\253\200:\301y\342D\210w\343"
+	.ascii	"\216\340\r9\r\300\355h\f(\2333c7UO5^\320\262fn\021\303\221\212"
+	.ascii	"\021\2356\016\025%\373\307\t#\322\370\241\321\301e\025%\202\001"
+	.ascii	"\003\206'\243\3110\306\032>!T`7EC3\\wF\276\210sk\034\0238(\257"
+	.ascii	"\341\225\332\326\203\310\256k\030-\2763v\030q\001\327\b\345`"
+	.ascii	"\230A\311:\0049\266p\230\340l\021\235D\f\261L\240\032\260\261"
+	.ascii	"\177\234%C(?\344\272\004\301\321\"\016\325\330\361\306E\311P"
+	.ascii	"\017j%6&k\234\254\214\203\205\223\3448Y\217\342d\005\200\257"
+	.ascii	"\210\361\006E\250\2636,Vw\300\f\212s\005-\"9^\212*2Y\342\333"
+	.ascii	"\035\250B\202c\205\244\330u\343\220b\023)/\373\3079\222\304N"
+	.ascii	"\251\333\221\303\210\r\342\226&Qi\212\004\237@\315\260\302V\025"
+	.ascii	"LS\241\302\\IB\344\214\216\021\205\006\216!\323\366F\333\016"
+	.ascii	"*!d\2048\240`\360\005\021\212I2\304\351\b\210\320\016\272w\265"
+	.ascii	"\344G\360LKI\365\370B%\254\333\033\312\3431%\364B5\246LW\326"
+	.ascii	"\355\334\006\316\272\222\314\310Z\270&i:\315\232\210u\006\311"
+	.ascii	"\036\017\"\033\022\0172{Y\347\241\214&%QYG\265\210\260\262pt"
+	.ascii	"\030\353\362\227\027\331\213\003%\224\323\302\224&G\320\214\223"
+	.ascii	"\255M"
+	.ascii	"\312\223q\272'Ff\f\016\016\225/c!I\242\003\307\311\230\306\013"
+	.ascii	"\216\t\330\ra\034\321\313\224\017\315F\\\016*U|d\335\234.\341"
+	.ascii	"\324\300Y\302i\272\221\210\007\261\211\024\016\323q\232\202e"
+	.ascii	"\316\200\245U\345\2259\211\222\3653\200\266E@\205\023\003G\t"
+	.ascii	"'\006N\222\231\r]\312\224\2408I84\264\300\204\265\301\241\201"
+	.ascii	"3\243\356F\022\222\037\217\021"
+	.string	"c\276\256\340\310\330kT\267#mh\262~\006\304\366\217\203\024\004[\022\366\343En\347Z\030Y\366nd\255\213\334jD\2750\246\345\251\031sq\246\363\370\300~\030=\311R\3260\351\025\031\261\260jJM\234\020\021\227\210`\220\200\230\301\031\022fi\305D\327\254\301y\205okSE\230\372\214Ud\232\352\234\264\021b\331\220\027\204\r\264\207\021\033\\\262\276\331\313@\243-/X\326\300\274\255-d\364\204l\355\016=9\2645T\266\230W\221\267<.\266\r\036\215;<\341\032\021\215\226\222\330\2351\372Cb\003*\213\232 W\213F\251M^\232`\232<'\266\226\006\215~\361\343\212\002\323\345\f\321\254mK\313R6S\374\201\253\210\270\230*\363\233)\006\033\211\230$m\262\336E\036~SF\313)\307\02127\346~\020!\0313\334\3120\242\334\330\304\024\333\246Me1\302\304m2<\256\270\330m\341"
+	.ascii	"\306\f50`\204G\356\254\220\325\265\331\242T\244\225\365U\243"
+	.ascii	"\250\324X\224\".(/B\"::%\244\254o\350\324\021\364\365\365\365"
+	.ascii	"\361\275/\321\r]\276\351r\303\3457t/\266u[GD\254\376o\346\214"
+	.ascii	"P\255\231\2322c[\206PC\256\364\2203\022\025\317xUMi1\002Y\315"
+	.ascii	"\266\270X\223\365\b\230\262\334\304\335d!\262\375\226\226\320"
+	.ascii	"h\220\265\026$*\310\376o\340\260\032\016\027{goP\212TH\276\322"
+	.ascii	"\334\212U\2003\326<I\203\245\030\246\342]\231\362\242\255\230"
+	.ascii	"\006\204*\212j\273R|\242\307\304\254ace8\225\347\326\005)k\020"
+	.ascii	"\220\335T\271a{\025!\233\343%\"4r\031X\3327S\342\276x\251\313"
+	.ascii	"\372\031\230\261\377\233\265\342\227\372\226\246d\311\215\232"
+	.ascii	"\220\315z\006\n\353\312MZ\261*I\222\266\270\254\243!\364\355"
+	.ascii	"i\311:Z\206{\314xC\023E8w\246\325uVDR'\005dF\2761\263\202c\355"
+	.ascii	"(\3531\321\261\367}uT&\244\027veZP\334\350ld},\275yBtJ\341\314"
+	.ascii	"\f N\212]H\242S\\\220%\031\202i\251b6\226\207\266\031\0319\031"
+	.ascii	"R`\225\341\334\217)]\304\276\024\271\200\374\200\021v\023%n\341"
+	.ascii	"`+\003\373M\364\017r\271i\342\204\214\210K\326x\b\316a\3259\017"
+	.ascii	"\277\001kc%\211\310W\034\313t\204\013\027/\251\220j\t\f\220\256"
+	.ascii	"\272\242\227 `q\\[4\031\331\325\022\023\272W.\310\334\315V0\212"
+	.ascii	"\223\213\260\034K\260\b\303\224j$\321\232\022\fB\006\345\206"
+	.ascii	"\022+C5vT0\222\204\341a\272\352\222\025\r~q\002g\206e\247\325"
+	.ascii	"p\311R\343\212-\350b\t\316\0054\330\026vt\007\345\306J\210v$"
+	.ascii	"\207\021.$\304<\237(\235\227\233#B<\263\034C\250n\214\b\323\336"
+	.ascii	"\200t\201\372\315\217\337\f\371qS\245\341\336\267\350\203hQ\335"
+	.ascii	"{\024\245a\370$/\217\315\r\221\337T\351&\251\261\367FH\373\245"
+	.ascii	"\313\233X\3267AV\0355\302$\001\362\377\204C\340\342\316d\375"
+	.ascii	"\f\274\330\307@\336\376Q35\305$LGyK"
+	.string	"K\222\3651\340\266\177\300HI\231\t\022\265\305*%9\343\"\335?P<x\f\243X\354U*a(H\324V\320H\215\275)$\373\007\032\025\265\344J\230\325uu&\353c\340\306\376\261\001\005\265\026$*\217x\304\211\322\226\254\217\201\241\375st\363t\363Dt\222\200\211\217 \372iI\226\032Y\377\002b6\320\226\033\247\033'!\336\022\037A\242r\333\0322D\262\376\005\3326\363\353\306\306\215\215\004\204\005\211\332*\246i\343v%\353_\200l'\327\232\232\342\224\252\316\020\351\202\304\220\221\365/\220\265\223mnd\334\310\270Y\322\221\032:\263\001\026\016\2564?\262122n\226n\224\250 \321\361\226u\322\224F]W\326\277\200\214\033\03273\204,\245\231f}\013\360\355[@\314\346@\214\033\03070n\220*hR\261\246\244\341\2739\372\rR\366\032\343B\003\313^\226q\341\202\310\246#5d\306"
+	.ascii	"iph5\345!55\341e}\013\020\331\313\275\233\241\233\241\233\"\035"
+	.ascii	"\251!5m\032\245\2523j\021\2474\272\033\242\337\024\025\213\224"
+	.ascii	"\030\311\333\032\323%\307\321f\356\270\2731\357\316\330\247z"
+	.ascii	"\301\321\367Ij\310L\t{\3010\031a[\366n\354\273\261\r\b#|\314"
+	.ascii	"\336\322\362B\224\265\221\r\237Q\357"
+	.string	"cr\22213\314dm\\s6\341\323\227<!F<\013\fm\037\031g~\306\230\006\213\275J&\\a5m\251.\352\336\320\320\334\230\306\003\256\246\261\n\234\331)\302\330\331\031\247K\266`5\261\031\3319)s\3434\311\225$\246\254\215d\202UZ\314VR\2221\377\177/(i\233b\034c\024\243f\315\306\336\033\214zS\273\n\243\232\321=v\340h\213\333>d^\274\030\353\260\330\253\204\001\034H\226\266\304\326\220\260\214_n\254{\301U\326\346\0250\262}\230p\341Bd\003&I\322\272\313s\001\325\022&\353W@j\373\0341\316\031\347\210NY\304\354\242\266\226\250\201Q\313\372\025\230\261}|\030\345\214rE(Y\260\354\242\362\304\340\336\262\254O\201\275\375\343\365\366f\214\323q\313!\003++\313\215qs]iv\344\222\265\250$\005\017\225Fi\204I\020\305A\224\005\021e\210\252h\032\005#\025"
+	.string	"0P@\036\017\311\224ms\017\024"
+	.string	"\f_\270\202\202V\246\fJ\022*\205\314\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\002\002\200\225\320\t\373"
+	.string	"J`\212%\312bbeY\026\212S\376^X]\355\003c\205_<%\240\320snr!\220\325\255E'x\032\336;\207\214\022C\304\334\207\214\355\024\323\374\210G}zGs\264\340\340\333\243\252x\243 *\377\255\361q\006\362'\300\fm\345~V\227\354c\3156\340B\204\241\260c\233\344q\370{\250N\264\335\221X\313\2440\003\374@\026\006\236\\n\036Qk{\376\"}\250\315\352\314\241\322\036\027e@y\031\037F\356\021\312\350\017\315\b};\242\362\347G\032Y)\b\250\2504\365M\2204\317\227\2027.\260\352\375OO\376l\230\036\365\037\311\356\277\343\234"
+	.string	"\177"
+	.ascii	"\214\256\035\016J[\350\202-\270\241\255\016\344\345@\177\342"
+	.ascii	"\273Z*\371\215\3049*|\350QUF\253A\001ah\204\312\353\307\006K"
+	.ascii	"\264\327\022(\272\373j\207\001\302\216\025\327\\B\254x\365\243"
+	.ascii	"\262\215\017%\277\230\361\033\t\223\310\020\336\324!\246\256"
+	.ascii	"\220\234\223^\b\367\247\364\220\251*N\324\320\252\250\314b\026"
+	.ascii	"\377\004\303@S\020hV3))I\b\263F\031\037\307\203\fc\242\002\337"
+	.ascii	"(\354\203\313\214U7`Xz\246\305\333h[N \202\253'\300h\255\201"
+	.ascii	"\317J\366uL\361\007\363z\305\2411OXH&2\301U-z\357\316\"\301*"
+	.ascii	"\350f7\t\005\267\022\340\301\bv+`/\345E\207\024\325\273\354\030"
+	.ascii	"&u\006Im8\003-\335)M$G@\250\203\362\025\203TIR\f\356\37306\232"
+	.ascii	"\36022\210\273"
+	.string	"Y\013B\367\031\004\307\311T\033\232)p]\366h|\313{\003\213,"
+	.string	"\233\211d\b\202q\205c\365\253Hr\304\326\250\350\270\237y\323\344\337\253\221\002\207{\213\271.S\204\225\035X\316s\t\306\223\275GGO~\250\370I\247\003\246C\205\037\263t|\022_\3563A\316\274.\220T#c\212\352\242j\322D Q~\020\027\006\272jU\307\210b\306`P\375\375dG\033\205\344L\234\274\t\001F\276\276>\252\337\365\301\335l\301A\016\256\3718\007\rR?\365\253\005\271`\270\202\t\031}\233\016#N6\277 |ZkE]<\267~\366\2424\232\270\022\231gN\313\317\313L\370\024\0226N\251A}\026\215\3174\3748\212\203?$a\255b\243"
+	.string	"B\2608|\207\247\302\242\bg7}\321\311\016F\034\017\023\310\264 \312\347\206\355\002hM\224\260|\017\370\205V\035\311*\274\\\360\303X\006v\251R\331\037\007\225D\332\331\221\313\272c\331\021\357AR\035*UNf\016,=\373\236\007\b\216\206-\375)\035\213z}|\267\257se\301\022H\346-\005x=\376\250\227\250\f>\276V\356i\373\215K<.z(?n\243Hu]\331\232\372"
+	.ascii	"\030\036\251\275\232!\304\2575\346@\236y\030tQ\027\367\217t\177"
+	.ascii	"=u\226\247L\225\265l.\025\275\321\253\023X6C\330\b\356\271g\341"
+	.ascii	"1\303\032\332\226\370\316\031B\350\227\321\306Q\234\350\023\005"
+	.ascii	"\030]'\303\2329\031P\356%\235\241\r\267I\2505>\205\033-\244\255"
+	.ascii	"I\2035G3\257r\204o\377\305\226~Z\306\245e\354\260V)\235\3250"
+	.ascii	"\026\251$\377\004qA\033\324L\274J\316\0202\360\261!R\250^\232"
+	.ascii	"L\235\263\002\335_\226\276\307+\376\001\315p2\207\266u\321V5"
+	.ascii	"\n\020\307tVh\235\034\234\032\207\241\353k)?Z\t\272/c\211-S-"
+	.ascii	"\260\211\224\263\370\346\270\331\215\344\016*\324\322\330r;\220"
+	.ascii	"\337\212\221g$\327\260\243\270\374lVb\337\226#\243\217-\027\363"
+	.ascii	"\324\300\224\331\236\345\f\250k\362\241H\360\237\346\352m\336"
+	.ascii	"\216\021\215)Si'S%\212\344\211\217\334\002\242.\277<\205\243"
+	.ascii	"\317Y\311Fb#;\214\177\203\373\233\237|\204\2054t\222N\362U\257"
+	.ascii	"\360l\362\356K\357\351\210\005\233#\263~~\2439Fy\300"
+	.string	"\004b\234\370\366\013\313#dQ\205\201\372\n\304\331O\013A\267\351\246P\223S\210C\316\320\334?;\251\365)\234\004C\007\235\031I\302\324\363r\2117\032\332\226\253f\b\f\344\360\212\335\366(\332\373\311\244\255\303)\247S&#\202'\372Cwz\326\262`J\f\247OI\331\305#\037\330-\275\\\250\252\211\233<>\n\343\222c\252\b\253C=\256\261\002%\312X\225A\032d\311\bb\335\211o\361@ \214\001\201{K_\255\216\222\303\266\033\202\315\266\214\222Z\336o\364\326-\344\025\bPbJW\036\363Vn\020\344\343\366\330\356\353\265\260\"Z\342\321j\237O\236\320\276\335\211\177\212\276N6\256\332\2430\253\321P\205\252l\353\232Iz\237\314\324\223ws#9\333\325<\252\241\201m\241\027o\377\367*\3437\206\336\374\217V\324j\345\341C\371\033\302\350qCI\007\256\363\355\252\022\017%\013\205%\201\241\356"
+	.ascii	"b\177T*\332\304\330M\322\251eC\006\f\370\341\323\037\205^\256"
+	.ascii	"\0046E\305]8\251I\337M\3304\272p\357j\244\004\325B\350\315\337"
+	.ascii	"(\243\255\334\255\214\026$\241\343#\267\220\213\332\r\305\201"
+	.ascii	"\034\177\035\223C\013\241\177Zj\345\031\362}\316\0228\0260R\013"
+	.string	"(2]GM\205\370\200\231\032u\325[\374*\fZnv\331\205f\315\246\026\n\3408\031\343R\235\361Os(\300\325\327\242\2007'T\342%p\365,/\360\201\005\360%{\374\374\3534\232<c\377\2673\003\211\271?\260a'\030\270\026\372\333t`\266\370\n\fy\367\303\261;uu \216%\344\307\263\036\264S\240\253'\206ym\275\362\204\030\317\002<\003\265\354vPN\227\013\200\220\222\261\017\335\372\33756\b\020u4\231\341\272|e#\350\315\320+\204\213\354E^{\371\230f\317[\243ZA\302\034\t\370:6\277\006\263\372\331D\224\333\240\207\210r\023\242\352\f\270_\203).\314\373s\021\372\346\373\bQ`Fv\337ADf\371\353\026\351\017rQ9CU7\210\007[\361\363C\324\323\326\364\0220\201\212o\231,\337}\n\255\274\320\016\234O\224$\363l\200\302Vd\016Q\313\004\345\366V@\376"
+	.ascii	"4Dl\3321Q\026\241E\334\311\347\263\365/\026\005\3546\300\037"
+	.ascii	"\373\225\"|\b\230\336\343\307\022\360\306n_s3D\351A\324_d3\277"
+	.ascii	"j\337\340\326\2058\326\337\026\344Ck!Z\034\255\006\2238\022\024"
+	.ascii	"\241&\037\243Wj\303\325\377,\243\032\230\\|Hi\365\340k\3413\003"
+	.ascii	"\254\301Vy'\243D\356q:7M\035\360\213=*F\310&N\021_*\216;\031"
+	.ascii	"\210\377\366l?iy(\001\260\271\2164\205\210\223\260p9"
+	.string	"\247\275\214\357\347\007py\035\254V\304\277\271\205\211^C\237`C6m\252\017\307\317'\025Jg\0017\020y\377[\302z!x\232\343{\021\233\356\253\351\246[0$'\024L\016z~[F\211\253\257\277` -\303%\261\207\240\035H\331L\334\335g\024\363\021\205E\216\251!\326Z\241\200\241\213\234C\016\341\253)\267\306\362-\352\0358\361\362\0209\227Z\343\202\271t\240\013\204P\321fNQ1\221J\241-\337\304\024\260\032\303\373\335\t\210\365\340\345\336\346K\246m\324\332~m\rUrx\033<\232\265\005p\341>\353\250\0318\037\325x\032\211E\004\344a\\\235\327Z\001\"\030\246y\004\004\003Q=\341\bZ;\323\242\323\rP\331\307E)\3441'\357'\337b9\flq\351=:{\313\216\b\214\212U_\230\224\236b\005g?\317\225\352N_f\363az\024\302\370RH\3530@\0304Vp\341\321"
+	.ascii	"FV\312(\274\277\f c\201>\033\320\344\004\300d\345\007`\r\337"
+	.ascii	"\023@\365s.aD\367\232\356\256\212\371\200l\340\3418]+\310Cf\256"
+	.ascii	"\275K \253X\212u\220\021 \226\203T\263S\216\266\2262-\fs\243"
+	.ascii	"\266\364\305\036\344\323,\237\273\242\227\230\205\330u\217\225"
+	.ascii	"\367\253I\224.X\017:W\243\023j\2119\274\325\371G\264\212W8\272"
+	.ascii	"\n\3050\314.X\233\311\177\226\315\344\275\317\2614\331\300A\n"
+	.ascii	"\205\026\2163\201\374\210b\230\207X\205W\321\314U_q-\225|\274"
+	.ascii	"\270\323\025V\005:(\344;\247\355n/\027\022\262\356\270\357\357"
+	.ascii	"x\004gu\301\200\037|\301\264R\317\334*\204P\244\352gX\375\007"
+	.ascii	"\002\003\307\3716i\323`\331\\\021\227\341\375\304\222\232SiB"
+	.ascii	"\327\322X\347\257\302\3208,\205\366/zh\214\003z\330.X\"\035\272"
+	.ascii	"14l\313\032qe\242L7\222)\336\215\226I\370\016\032g\205!\2347"
+	.ascii	"x\320u\375V\272@g\"\020h\315\242\234\242\260>\356\232\033\250"
+	.ascii	"]\006H/Z\354I\313y<s\333\271~\253\247\265\357\336\273\237U\351"
+	.ascii	"\026\352)\210\344\333\3568M;R`[\266/(\203\334u\0309\204\304\250"
+	.ascii	"\314\253\210N\315w;<\215\326R\013\341\351\352\022\325\230=\210"
+	.ascii	"'V\252\373\236B\037hs=\352*4\016\341\224\272*\037\266~\3449\253"
+	.ascii	"\326\351\331\373\334f\006\001\273\326\020"
+	.ascii	"e\353\234G\001\"\020\332\027\0371-DTw\036l\217\323\277\2309("
+	.ascii	"\341\252P\275[\312%\005i\215\336\237|k\321D\227hBF\343\221\t"
+	.ascii	"\n/\261\t\363>\340\022\245\264\260\361+\353\367\004\261\260\256"
+	.ascii	"\306\013\330\374\026\271<\365\017\202\\+\230\007_\252\341\304"
+	.ascii	"R\301\315Y\265\017\025\226\213Y\204:+^)\264#\267\242\2710\227"
+	.ascii	"\335&Y\300\221KJ\374-\016B\343I5\272\3344\330\266\364\3212g\t"
+	.ascii	"\321\336\230\220q\021\300\361\230]\204\030[Z\305:\376T=\307U"
+	.ascii	"\347\202\213\362\316\253\250\027\332\233\2507j\363q\230\214\306"
+	.ascii	"WSs\347\217\227khm9\262\375\210\366\370~\001{\033\330\236\230"
+	.ascii	"\250\213\021N\301J\346\032?B\351\251\032\013U\t\\\0027\007\244"
+	.ascii	"\321\263\230\222\331\022\332\205eC\230o\360\365Y\n$\225\257z"
+	.ascii	"B\342\305:\256\340-\200\262\307\331\253#\226\315\372\022\243"
+	.ascii	"b\262\005\243b12m*\210\206\177\215\376X+G\375s\232x\366\177\256"
+	.ascii	"\262E\023\316\365\321\266\313\023\f\n7\332K\024\220C\251\276"
+	.string	"?QF\201\0230L\275\006t\377\362\3223\203\304\262\231\313\002\344\005vq\262\222\365}96z\340\021hK\302\235\301\211b\004r\264\022\033\350\023s\264\026\021+\316`V\314\362rPzy.\325\017\236\355\213Syl\200\303\260\fF\326\330\252\372b,\247\323\302i a\233\216\231\275o\005+\242%\f\335\340\377\b#\253\027\363\301\376\\\245B\314&\302uv,\244#\226y\020\36309SJ&\264mI\227\312\352$\300\274:\260\246i\034\305\313k\263\354\251\230a\243\344.|\202T\007\341\340u0-N\303r\323\213\334\\\360\302,\311 z\245\303::\377\r\215@%N&w\264\211\021V\367$\301\3121\365?i\347\344Uu\371P,\256\250\222W\353\360\200^\362B\237e\330I\361\342N\254u5\003|\267\355\347I\272\344\352\353\315!\001\027p\256\340\276\270\270Z:9\312_\304\304[$\316\314"
+	.string	"#)\022u-\214~KX\255B_\347P|\265n\373\327\272X"
+	.string	"`\001\265m\0137\002\004\304\320\371/\232\251Y\0020\365u]a\032\233\031(\273gv\3502\254rA\201\225\260/l`\b\352k\n\300P\354\034\")\007`w\f,\225\267\200\202\003<\036m\021k\"\212\223\036-\031o\345,\251\200\375\350r\3233\341\342b\032\365\\\310\266\203\371\304\001\270\357\2525\260\034g\237\032\242\242s\226\277E\235*\024[\b\210\2150\314%Z\003g\224\002\321Y#\211\b\326\277"
+	.string	"\360D\260\215\3071@E\307\265\206R^s\224\224*\346\206r\377\375>\025\272$\202iXi\201\002\261j0\235\272\330#_\001G\367p\303\370&\276VH?;\020\374\264IF\033\"\252%\334\311P5\216+\271\212:^.Qq\242*j\276\254\223\301\253\346%\3571HQ\241\210\236\20037"
+	.string	"\325\007\031\315t\230N\211\266\226U1>\3578;U\362O\365\231\263~\310\3527\305\242\221\230\251ufeE\326\206\025\315N\265%\341\t\031(\333qp\265\227\314\250`4}\221\264r\271\306\035\215\204\355T\317\t}\037\021o\036\266\373\353*\341\250\363\240\260\205Y\374\\O\3129\334R\243\363\2401F\007\357d\320\247\325\223 \370\320Z"
+	.string	"\251{\370n;\036\335\217"
+	.ascii	"v\201\323\215m"
+	.string	"%\017\223\316z\233\007\350\374U\272W\001\177*\275\235\002\004\277\034\341\265WDV\330\002N'\036@X\223\306\n\264\013\"gTS\200\235\271\370\241\323\364Q\322#\346\177b\036\036\335T\\Q+\252I\210\324\333\323\003\rd\256S\312k&\215\033\266\344\230\b\007\302\001\302\204|\350*\374\277.>U=\223\024\306\351w\303m\016\222\376\232\364\241w\034\022\223#\246\033\232\321\323D_H\331(\325\335y\bF\244\347q\206\r\303?\300\3345\345\362@Y\037_\340\3630\266\204\202\037\222p\031\330\230Z.}W\354\200G8si;y@\ti6\213\223g\2642\"\277\250\355\263t\335\315lr^w\376\375\211\245\037\216\310\276\326\370>\340A_@M\021\t\236\220\252\327Y\323\250\3242\306=\211Y\250\363\225\304\332?\254\373\256\304\224@\347\363\303\022\207\351\202\350*h\334\251V\213x8-\271\030\332\006\375\325"
+	.ascii	"$\304D\215\224\334#\272\271\305\340r\r`z>x\210\226\331\267\326"
+	.ascii	" o\327\305,\341\203\202\376X\200=\020z4\250\302N\274\221/_\212"
+	.ascii	"~\273\267*\203)\345\245bzB3\022XWy\210\245-\005+\007EN"
+	.string	"\037[\266\334\257\224\275e\223\342\335\331&\233\211M\324I\216\017\013\224\004\345eNK~\370\3557`y!\257\347\211 \341\212Y\322\227\004w\264@\020\327\265;\363'\234y\2719va\344*\245 \310\206\263S\371\016r\303\222\261\231\222\"{\213G\254e4\201\244\027\255\272\364X\252\366Z-.\004\030\211e\365\307&\373\3167XB\305\006\215\220\030\307\t\3444\314\347|\373\200\337'\003\021\304JTp\033AF\231\226)\307\005\336\370\362\261U\346\331\237u\255\217\242n\310\"xWor\030\266y\355e\353\212\257\365j\205\365A\244\260\f\177`\200\031z\340<=m\r\022T\257_\016\241-+\270\317\2474\263_\242\354m\241\340\254\271\327Sl3\036\fwHcJ\016\364\365W\273\022\341x\253\300\260\016.\205peU\326\027\200\305Rj\340<\270P\314\213\312\234\035\305\0206\204\202.;\232\025\221\204["
+	.string	"\250\355 \203\206\034-\321\306]\f\370*\216v\235\035Z\307\223\221\314p\004/\312D\207\314\223\263\240S\"[\246,/\263_^$5\242\220\301S(q\252\3402\22444^\200\342\210\212c"
+	.string	"\356\356\326=\002\002\331h61q\3628|\022\001**\220\021\365hTCs\312M\035\370\252\221l\246M\324\235I?\273\244\213\277 i=]\316`\322\216\352\356f[U,w\241x\255\220\036)^\313\272\367\t\220\342&\224)mj\032\351\375u2<"
+	.ascii	"\353\005\307\2401\2609/&\022\231B\024\306\2466*\223\0071\022"
+	.ascii	"\024\260'\353\332\357\215\017\006\n*#\270D\304\177d)\255\317"
+	.ascii	"\240\\\350,\b?6M\004AT\206\357r\320\334E\207\3242,\261!\2520"
+	.ascii	"\317\243YTV\253\340\217Wv=?\244\r\251\354\314p@1H\257\033YW\262"
+	.ascii	"0\214\031\264\303\265\355.\352\342\266\210\257N\242\202\263\n"
+	.ascii	"Mg>\315\0053P\272\37099NJ\202\355\307\313\033s\372yB\035\270"
+	.ascii	"\325\314\016\241h\032\217\334\362\230 \313\351>\265\323\\\013"
+	.ascii	"\240V\002\033\r\260f4\n\224\275\251q8\251\274 q\204\317\323\277"
+	.ascii	"\307L\254\213\233\035\016a\027\221\022Nc|bAr|\271\247\b\211\216"
+	.ascii	"D;\231\363w\232v\360=P\n\251\360\244\264rW=\273\337\252\300L"
+	.ascii	"\323\306\212\037\376}>\247\342\245\3108\352\356u\030]\270_}A"
+	.ascii	"\313/Z\274T\233\177\006\252yJ\307\215\257\212\347 \225\243\020"
+	.ascii	"\007t)\3739\362\344\354\351\275d\325I\307\210o\301\325\263\036"
+	.ascii	"'7\306Zq\205\225\255\374\266]\314R_\231\221J\263,\270\271\224"
+	.ascii	"b\203\227\017\2127\007\341\021\f\265\013\250\306AaK\340S\270"
+	.ascii	"@\214,\232\217\b(YW\210\273\013[\376!\233\225\217\f\370\352\224"
+	.ascii	"\177~:\224\332\371X_\2658"
+	.string	"\256\265LU6W@v\211\2358\212\223\313\031\311s\354\216"
+	.string	"\006\366\343\207\207\367\340\224\201\367\247`\330N\272\232\276t\357\245\307\177\214(\n\001f\020%:\244u\005\272D\351\235\353PW\b\204\246;\246\335\302\276\240H^\354\216\251R\024\230\203d\002\321!\271\276n;A\3276)\250\300\206\236\205\231\235DE\037&\231;\321\330\026\244\024\315\274F\206\227\310\333\030\3503\230\366\013\3372(\037\376\007\021\375\242\232uH\325\232F\356-\004\315\037W\237\271\317\254s\006=%\253%\2201w \332\240\256 \246\305\225\027*\365tt\317\f-\r\330\317\270r\246=dH\372\bV\340;"
+	.ascii	"t\203<\350K\235_\305\bu\254\270h&\004\270E\230\243\344W>\221"
+	.ascii	"\031\023\246\n\f\252\273\233\024\323\035@\b\3403\334\251?G\005"
+	.ascii	"\232\201\374b\006\215@\270\256\241{T\247\276\317\\\032`_`\243"
+	.ascii	"\211\347\305\271\326\343k\210\210\3413\355\321\333\365QH\331"
+	.ascii	"\033\230\273\202\317"
+	.string	"\300\003\031\326\030m\332\037\276\210>\271LV\365JU\277\021W\\\271\t\336|y\316\302H(T}2\324\272\267\247\006E\302!xX\f\206\222!\334\324\324>\034d\324=\266\275\255\316\264/\214\037\350P\307\031\271L]MQ\013a1\250p]\202f|s\027f\366\254\303\323\324\375\242\305o\220\321\342\317~u\203\345\224g\245\017\335F>\033\\\201\341\016y\246<\206\246|\035\340\373\307\246\242\033$\364\226GZ xH\367\\\255{\3010S\220VK\r\335\276r\252@\230}\234\005\311\301\017\317O\221\020)\325d-\254o\212\344t\036\037\317\301` \303\261\255\211b\313\232\231\242\006\270\307\21599}\234\217I\243Uw%\216\360^l\001vq\231\301=\353\272\371\333\026\211\227)\364\033&\210\337Z;\371y\020\374\233\020\316\262\261\003\224p~A\027\341\020\226L U\226\214P\332({\264\024)\370u"
+	.ascii	"<\323\030^\240\002}\333\024\035e2\350\236(S\221c\344\013"
+	.string	"U\023\030X\030\277}\236A\240Ve\021\266\351Wk\232\177$ 8\007\264\234\274\350\267\262r\215\207@\305\2722 \234B\336\276\213A\310\224\353\317\255]l\330\370\030(#\2144,\230\216\363\255z\311\334\262\034\361B\240>;6&\343.\243%\212\334\223E\"2\034\251\"\006f\317p\306\371N\3132\352\020\226O\005U\370@\2149\035V\242~\341\b\373\271\277g\205\207&2\rw\027\322\227z\335]\323W\316p2\366\273\216\264\275_\265\177H\302\310\375\0164\344?\313\212\357\003C\2172\263\271\201\245\345\314\302\021\020\r\216\270\030\033\377W/\001{,B\023\241\375R:TI\026r\306\030\206:2\307>\320\343\311\200\003\310\017,\226,\333$\0336\324\302\216e\321a\235\204\370\324\224\333%4\266A\362\371\177\301\334\356\033@\271\327\001#\202\267\306R\352\371v@\352\017\267\213[\221D\314!b\340Ku"
+	.string	"\303\236*|\024d\367\021\321\353"
+	.ascii	"\270ID\314\003?\363\215S\314\304\371\024\307+O+R\264\275\326"
+	.ascii	"\254\314\344\251\311\256\216s\305-\262\377\032\326\350\324'\323"
+	.ascii	"\242\225\272a\032\001\336^\3460&\217\025\261$W\335\005!\2727"
+	.ascii	"\230WC\377\327h\252\213&\256\333S\007\231 :\214U\022\371\260"
+	.ascii	"+\347v\257\373`\f\343\343\326\007Mu\267\275a\310\261\367\366"
+	.ascii	"\177\261S\207\372\241\2329\340@M\006\200$\002R\033\215|\004\021"
+	.ascii	"\346\205g\226\007\336\202\312\267\274\326\002\377\354<\007\206"
+	.ascii	"\023\220rH\305\302\372\365\375\355\300\346F\231\347\020\221\025"
+	.ascii	"\272\353\025)\360\255S\340]\326\301\206t\227De=\214\021\315["
+	.ascii	"\346Z\f\3320\206\306e\367\301\037R>\244\361Ze(\177\007\325W\230"
+	.ascii	"\213$E\376N\024\377\205$\353<}\306\265\035=\024\351\337\b<\241"
+	.ascii	"\032\263\331\006\342\206\230\033\346\367\031\034\370\321mN\262"
+	.ascii	"I1\354\331\342\205Xx\317q\002\305\377\2715\236\f\020\277\351"
+	.ascii	"Z;\375\270\306\027f\243\323&<\030\347zj\t\216k\032>\242\252\212"
+	.ascii	"\241\310\337\177L4/\003\234\027\004\005k\t\325\264=\224\241u"
+	.ascii	"\035\3245\003\313\214aZ\177\303\261j\347\005\322D{\203\347\246"
+	.ascii	"\273D=\272\202Lx\274\212\306\212\026\257S\363&\360\235\344C\272"
+	.ascii	"\331\261i=\217S\226'>im\264woH\216\017\334\177\276\264`\213\343"
+	.ascii	"\037s~\225\331\\\314\220\033&\025+\225\270\232\301_\367\333\356"
+	.ascii	"\232\316\217\\\033\177\206G\245\007U<\214\r\033D\033\026\351"
+	.ascii	"$\207\r$o\366\357\005e\235\367\025\333\2161\031H\np\355\363\367"
+	.ascii	"\354\210_\314\2209\360\230d\020\347\017\255\2223\334\2450\240"
+	.string	"o\231T\317S\006\207\363\307\r,\270\037\260\r\210/\364\350Vb \016:_(]\371\223G\222c\301\244\303\337\237\1775q\013D\371!8\261r\027\367\001\201\311\016\377\224\206d\\\237\021\374\212?\307\237\363:$Qo\253\274\245\261s'\033\302)\215\251JX%\226\036\307\317\371\331\260\f\370\321]\032od@q\023=\261\353\241\253\267\234.\226\320\343\233C\1772'\214\t\364-/l\370\013\026\0055\271\226\234(\022\221\033zm\201\355z\345\330\322\036\354\346\t\025Hr\374oN\255\026r\355\205\206$i\216\t\237\272Jg\f\357\177{\007\204\202\257Z\251\312\241\205\2649\247\020\207\211i\372\315\246\262*\303X(pw\347\350\236l_C\261\327-\3033c\205\235\373|\222\207\031L\317\311{\275\001\301y\334\013\313OeQ\302\022>\323\245\334\213M\340|L\305\240\273H\200\365\020P\247\325^\332\363\320U"
+	.ascii	"q\222\007\231\244$m\024\325\354\023\341\323y-\002\207\200\273"
+	.ascii	"\374\255Y\315\317F\f1\270\247\022'\313\255\334\217\036\354@\322"
+	.ascii	"\326\302E2\tPT\002\032\223\330\022*\332i\264\210\021\275l\204"
+	.ascii	"\215\351\206\334\201\362j\325\024\344\356r\323\367\216d\262\204"
+	.ascii	"<\352tBq\207\210\3010\330\251\004>1\322\373\362\206\274\274\255"
+	.ascii	"\271\250\3063\030\275"
+	.string	"\364\"#\262\302f\364\247f\2231\302\034\366;\030aY\376x\032Q\264y\374\266\355\237\037\026\262}\262\246e\r\272Pz\212\340\222-I\254*\261a\361\303n\204e\t\033\013\346t\212N\240\363\364R\373\317Aj\377\333\377\315\301?\216\303\346\001\355\256A5\207\004\246L\253!\216\234\327\026\221@8\\\320\311\225\273y}\331u\322/\025`kF\230_\311\355B\362h\343:\226\225{\b\025X\375\024\356\216h\025/\266\320\273\244o\271\252\220\031@\032\220\303\036H9\277\031\f\214\212\006\232\271\013W\314\016Hs\273\013\037!9P5\363\260\313\352\277\345G\253\206\232\213\031\356o\032\200\221\325\013\035\017<\001\244\2771^8\270\007\336\304\003\003\235ai\361\377uO\272\033\355uF\f\023VqLg\245f@\227\257=\024\330\n\253\\0<{\326\261\244\351g\322\027e\270d\344\020\036\304]H\320\332\020\331\300"
+	.ascii	"A\360_\261\037i\303x\252\331BF\344%\260\370\303\236R\211\266"
+	.ascii	"\234n\031+\360H\354\276\266\016Q\267\0308=\350\r\375<\352\327"
+	.ascii	"PH\311\244\366\256\f\214\033&v\372\352&\270\005\340b\363\256"
+	.ascii	"\375Z\316Q0x\017\005^p\026\306\370\b\356\212\017:` \226\262\357"
+	.ascii	"!6\324\007xX\240\345\0023\361\303K,\335\274\345p_\177p\247\035"
+	.ascii	"\022\213W\bO\200J"
+	.string	"\311:\311+\366wg\325\202[\036@\323\322\346 \233\305(c\035\016\356\020\033\245\345(\315\201\221\017\324\306\373)\0277k\330\200\207\244\n\270S\002\023|!\371s]Muz\362\300\326\314\267\023\212Az\341\275\t\347\266\277\275\025\207"
+	.ascii	"\202L\356\340\250qH\205%\320\356|K^\265\271\323\221r\262RdD|"
+	.ascii	"\005\r\376.\224\024\232;\270#j(\0301\264\201\311\320\202\200"
+	.ascii	"\305lcBI\316\271P"
+	.string	"\334\320N\252\305\236\202\246$\305\025\227\335\274\373\217\330\027\022\200K\222\345\223;\037\324\266\311b\025\344U\326\201*?\271\210;R\313&R\024tT\034\370\253\324\320\201\305\230\2626\275\266\270t\260\330p$\217\305\201\263\222#\372{8\001\246\232\232\251Z\346\320\370\r\363\323\031\013@DAd|\224\263\302:\213K\330\360\222\2049\004@\242F]\263\033\005\360\365G\316'\341u)G\3712\235\2654\3353K\263SJ\335\021\2742\374\372\325B\205\205\337\006*\204\376\216\036\013\230~\242\232\345\372yO<\006T\317V\273F\332\235?+G}\232Q5xbQXL^\251\251\025;\361el(V\204\025i'\314\341c\261o\322\307$\306\302L\314\267\026\357\022\215\237BB\202\335\205^\f\315C\327w\317B\375\334roGE\254\303\020)\240\330\001f)\016eq\325c\352\2045\326\377j\333p`,\301Z"
+	.string	"L\217\334\266P.\266\3703A&\f\217"
+	.string	""
+	.ascii	"\216\311\263x_\261<\320\321\b\210e\333\355\223iS;la\332o\022"
+	.ascii	"\347\343\373\211 B)y\314Hj\rT\371+\200\276\212j/\300H\232~\302"
+	.ascii	".#\365\3101F\"\264\375\230}\342\370e\247\320O?\207\345'\241="
+	.ascii	"\205\260\211\342R\274\205b\367\007\233\261\207J|@\274\267\020"
+	.ascii	"\261\007Vir\230\266`k\263y\321/\266OJ\212\357\016\260\367\375"
+	.ascii	"\003\236v4\016\347\031\037\304\b\274\022\254s\373\023\251eB\265"
+	.ascii	"\203\322\273$\375\234Mce\370\n[\257p\207\004A\346q\210\235\305"
+	.ascii	"_\024\177\373\332\241\005H\273\251^\260\246=\312\310\302n1\227"
+	.ascii	"~8Qw\277!"
+	.string	"1\266\214Svt\232\362\361;\025\rc\240\210\236D\335O\212*2\263?\326\306N\245\244q] \211%\232\205\304vP\264\217}\0365\332\354\366^\220I\304D(m\003Fx(t\221\352\201M\237+\210[\342F\354/\311\021\327+\264x\205\352J\362(l\001\371\366\221\324\017\355\nu\273*\207\335\t\361\330H\210\262\357\377B\324\267\245&^\231\212_\274\n1\245\032\330\001\202\370~P\233\260\373J\324\n7^N\345G\332\341[\301\r'f\214P\260\321z\275\r\207\321\306\327\004\275\0316%\376$\b\362\374J\215\346O\374\360\333\376\352\025\005|\363f\230\230\327\017\025\230\033}]\214\251\0339F0\217oS\323\220&\321\211\330R|\023\272\231\021\233\037\261A\220\274\334R#E\032\353M\fo\036\020w\247%\255\346\255\253\316,\031\266\227\216\200\341\270\026\271}C\036\341\240G@\336\032\354}o\036\265"
+	.string	"\221\245)J"
+	.ascii	"\306\364\212\244_\372\022\022\200\323\3546\221\2164Q%\256sH%"
+	.ascii	"\321\235\b\3215\374\316\352\313/\273\275\315iS\004\202\261\333"
+	.ascii	"\234\3467'\021\3710\261G"
+	.string	"3\347\243\250~\371{S\266\037\311\035X\362\347y\342S\254\275Jx0\023\tL\324N\342\301|\313,_\310u\030\035\n\363\361\325m\005\210\347l\246\361\315+2_x\275\312\227\034\310\336\344\b\357\345\324q+\222\260\340\212+&\273\006_\212\004\260MU\235\316\0241\2378[\250q\030\313\316\005\332\302&&\275Z\033\315\037Q\353p{twl\256\020\211aTa=\030\256\275\001P\365\356i\240\373\016\234\212\366\227\350\2070\236/'\006\006\017\264\205V\266\025#x\020\016\364j\027uV\3665u#3\3711\256\216\270\266^Y\223\322D\346\006\021\342\324\251\350\005\270i\034\"\323\305\371\252(P{\002o\332\3710\213h\371Y\360$\364\253\352(\210\006:\225\207\236\222Rd\354\365)\303G\251,\375\0366\212W\023\321}\377\271\232\020\340M\337\274-\315%J\242N{(\004\302\360i*\303\252,\003\312g"
+	.ascii	"\f\277\013\336o\001\256\226`\024k\326c4\034\273t\fF\244\250\301"
+	.ascii	"\336\004\257\202\204\234\375J\t\321\357\030IN\255lI\315\202\257"
+	.ascii	"\216s\276\322\306@\263\265\273-\262\026\203\323\345;F;\2178\355"
+	.ascii	"\235\370\310<\210\237Y\217\304\263/d\216/\326\240>\027+\347F"
+	.ascii	"\037\034\226\221\023\207\234\303\037h4="
+	.string	"CaQH\336lC\2342<\344\276\251[k\307_\212\325\f\310\375a\270S\bNKP9!\231\326\360\030\354\016\227\307\244\237\240\224#\375\366\017\006\303\261\353\306V1>\362q\270\301\366\313\367\206\261hl\036Op\234\0259&,\300\031=6\260O\234\345\251x1\266\001\223\377mI\b(\017\335 \002\2747\322\301\376\373\334\354\360\224n\t\304_wK\341\262UB\370\341Pi\322\211\327jNm\343I\037\002\214\376\210_\341\364eQ\211\212j\004t\344\312\252t\023ZV\360~\261\352G\266\350j\324\215\3207b)F\304p\221\302'\222?\254*T\036\230\324z?r\2073\313@q\341\337\275\300\\\020\262\351\205\304\303\016\026>\354\rC\331\243\272\322-\215\320\326\035\273:,\20073\273]\312\f\377\371w\020\204#\346o\315d1\344\313J\351\030\277\367:\300[\375\204E1Xz\022\210\\|m\303"
+	.string	"C)\026\036\317\303\t\022\312\331\024<\220\345\034\035\231\237$^\344C\341\363\021\\\311\331:M\nzbJO\034\212q[s\006|\270\243y\367\027%\317\272-\374G\031\024z\354j\003\246\345\371\241\026\032K\206\314\330\244\214\267KM\3243P\3304\177N+\024v\220\320\333\031\361&\272\245\237\345\231\031^\020\366\242\262\244\307\344\317\206 \361\273Qx\3172\202a`\220\270\220\261\365\252u8\rF=u\244a\373\275\300\375c\020\232\217\024\210CO\340q\253\034\271HF G\360n9:!\211\365F"
+	.string	"u\013\354{\352|\245\343\027\n\275\273\225#r\204P\327\345lXQ\005\330\033WI,\236 Q\322\231\275"
+	.string	"4!7U\"\2767*\362\001\332\304\346\307A\345\277\020Kgd\030\216\2247\346\036\034\f\204\251\350\330\"\274\307\374"
+	.string	"\220\240\022\231\321o\0059\200K\320:a\355\313\274;1\023\211+lV\370\324N\244\201\234\345\344Ed\031\304\367I2\301<\263a\013\330\220\213\263\215\372\204\320\2272\212(\337p\3215\002S\"\007\225\0229x\023\253'$\2260\023<d\362[\313\211\241\023\024t\035\016Up\374\332\200\320\227\0078o\f\177\346?_\002\246-\003Y\323?\324?O\305W\235v\306\2026XbP\212\320\272\362 \277\315\220Z\030W\270A\324\330\343q/\027\232\331\257\3663\357D\177/\310\201\315\336\301VB/\213HQ\034\211\r\245\366O"
+	.string	"\0172\377\3626R\317i\005\2441\033\323e\344\247*\007\017p\355\350\333\031{\303\313`ye\261p\255\347\001T\227\007\342,\271_\232\360@\332r\221y\002|\2218\232\227\341\032\001\"\306\211Md\200G\226\007\016\205|\035\2778\241"
+	.ascii	"B\301\247\204XS\262%\202%\b\361\316\264\025\020\360|\230\260"
+	.ascii	"k\377\300\\P"
+	.string	"k\335>\201\236\201\212\311\327\034\262\314\323G\221\330j\313\314\212g\200\253bA\t(\234\322\271o\233\264v\204\367/\t\367!~\332\016\262\n\177\354\021\2431\206\034\210h\213\320)\321\205:.#\242\3641\211/,\033\350\007g\030`|U\303\256\274\177\262\363\\\374\246\237X\232\331e\036\337\216P\3409\243\232\235\024\255\343G\275C\250\002L\260d\346\234\031p\025\371\022\"\260\247\013\365:Q_>\355\203\211\263\025\351\300\027\357\374\313\310\355D\255%\232+\3445\257?~8\367`~\255\341\3305\032s\247\221\344\037\224\b\325\343\346\260\003\235q\200H3\226`|\370\331\266\006\nf\245\301+mYb\344\367fNH\371\262\316\344\275r\370\331\244X\332}\242\016\0234\r\3564X:)\312\361\020j}\366\227\t\207\026\332\220%\177\215\265\272\3164-V\025~=\210"
+	.string	""
+	.ascii	"\357\024\016\177\354\013yW\203n,\273b1\375g\315Q\244\214\273"
+	.ascii	"\243`\373+\242\fJi\034#\267@)\232\261\230\375\r\r\214\243\210"
+	.ascii	"\215\232\005\376\031\221\346\227\227\344\350\301\033\363U\371"
+	.ascii	"\362\326\224v\220\261\020!\375\325=\363\031\020)l\317U\260N\361"
+	.ascii	"\306gy\001\227\236\341\006\203l\334`v\332%Xs\020\374z\332w\202"
+	.ascii	"\020\257^\351\034R\035\302,\250\311G\323\276\273\2153\231\274"
+	.ascii	"i4\357{\325\2430{[\217\374A\254\336$\202\177/]\325\371\327y:"
+	.ascii	"J\336!iy\007\345\222V\355:\206\375\300\036\332x,\2317A\371C\372"
+	.ascii	"\336\235}\216\321\237!\214'&\275\203\214m/\326\313)wBv\222\271"
+	.ascii	"z\004\r\237\232:Mc\375\302a\\Q\324\276#\370\006\233\360\033U"
+	.ascii	"\350\200\337\016\263\276~\275\274<\2633\215\035\344\366[U]\264"
+	.ascii	"\034l}\r\330\256\365\3667ih\225\t\307@\334n\222\355.\366\036"
+	.ascii	"\341\237\370\373_N\373K\360\275\227\213\027B\027\247\343\313"
+	.ascii	"\255?\335\275\271 \036\240\351\032S\337\035\277&/\356\230G\331"
+	.ascii	"a4\230C\026\217\220\320O\3171:x.\261\321\275=\257\311a\302\341"
+	.ascii	"=E\236n\233\005\3103t\036\207\247\370\233\354\032\352\244\r\266"
+	.ascii	"\255\342"
+	.string	"\177\271\\\034R\375U9\277'\313&\341#\030\254\375\303\307K\340\313\301\237\221=\376p\377\"\233+\001N\251\306,k\373d\021s\253f\357\264\033\316,\367\367\b?sO\226\203{=\342%\360\275\322\266\214\357_t\355$0\273\317\262\302\273\347\353\243\364M\306wX\375\320v=\245\313sFj\253\304\205\\y\276e,\333\334a\343\357\257\261-+|\215\020\375Q;\3659$g\001\027<s\224\203\364)\335\315\345\326mY\201\370\241\002\2771\356KA{^P\177*a\374_\3748\022E%\345f\026+\"\360!$\007\372~$\3366\n\232\377\270\337\237\375}\343\276\001\341\034\205N2\273\272\254\f\243\351\367O\252\016\217\306\261;\3752\216\to\341\376xIqH:\272\3275d\352\267\330\256!\242\357\263\235M}\301\325\376G\003\361\251\326\231\251a\3327\362\372;\217\013\363\2612\275\264}\362%j5"
+	.string	"\"\346\\u\3173\367\237z\214]H\307\237\333\017#\315\210S]\363:\006\035\340\tO\246\230\334\271\027\345((\016\345P\2477\342\322\351+\351\376\252\231Xu\n\027I\372\223k\245\275y\373\203\020\374y\3423\327\353\257\3473\037w\027\275\336%\016\343}\226\035\322\3649_?\367*\361\211\352\341;\030\017V\264D%\035\024\036\216\345\332\360\345\364\304\ro\225\177?#=!\206\005@O\"\373pk8\2554\317c\230?\031\332\302\n\331\307\246Od\275\232\363\213p\2714\363!\\.#\236\034\200;H\032\230\343\3772\202\367\036\216\363\340\371\216\314\353"
+	.string	"\237\243\3501r\236@\345\032\365\2471\375,\323H\270\277\001D\277\230Z\201\343\2771w\0331O\200\310e\224;"
+	.string	"\352\231\025\376\026\021K.f\016\213\327O\307\2231\177a\332\247d\331\023Z\365\371\334\313G\303\036\032\360\206\250{\byd\366N!\366\217\200\303~P\354p6\f\317\177\341\\\233\233\334;\270u\3638\030G\313\303\236\333\337\236\362z\214\303\361zi\356`\200=\246\304\360\226\337\307\352\237\364/\336\261\003*\3302\224\030\355\321\364\377\334\372\263S<U[z\231\373\267`\340\b|ow\371\347\271v\37243\270\017\3067\210t\237\360\034\303M\352\315\276\023\256\273N\371\3550]\024\370\230\220?\335\323\271\333k\245\031_8\312\364\312\240\005\254\207\001\361\246\036v\304\317\034\370\311\262K\241\032\325|\213yG.\177~dg\3477,\266\336\271v\264\315\355\366\276\301s>\374\362\205-x\231\270\0351\333k\354\270\013\377!~J\f>\274yq\341\214\262&\310\354\007\212\001\252\375\340\263\2366\323Iw\234"
+	.string	"\327\256\235\361N\337\224\217\371\367C>\237f\377\344\347\377\262{\210\346\200Y\363qt\212\230\201\006j]\225?\200~>\223x\326\341\222\310\273\265\363o\241-2{Ec\206}\202B\361xz\302\310;\334\327\027\205\021FG\325=\302\020>\264\230#\034\206\200~\341\300\177\002\370t\200\315[\340\230\263\322\3277\360\t\021x\241\303\334\f\216?\350\363\257}t^\374\r\335\315\007\302\272\200:a-W\260w\346\326}\351\336>\210\354\3320\345\325&?\276"
+	.string	"Jk&\037\234\002\207\034\322\251an\016\0050\222Ds\242]\203=\27701N\220\t\243\277\331\314\246\333\233A"
+	.ascii	"\364.\245\031\034w>V\372\007\276\213\254 z\006\310\257\221p\263"
+	.ascii	"\003\336o\351Z\263o\f)\216;z||\273\201\357\245\342I/\237\"n,"
+	.ascii	"\261\037\305\357\302\372G}X,\003\346h\211\0137\371z5\224\305"
+	.ascii	"_\032p|g\342\361\002\034\216\304\340\223\214/\006\375\252s\320"
+	.ascii	"\304\206\265?\b\344\331\331-\375<p'K\270\303\245TN\\?\271\232"
+	.ascii	"\342v=\373\234\370\357\232\274<\222\033\2547\366\366\303\232"
+	.ascii	"\023\351i\\\177~\330\310[\335}\013l\017oK\f~\321K\346\007\321"
+	.ascii	"\307Z\353}\252\207\025N\027\321-\336]qfz\342\373\314\377i7Y\251"
+	.ascii	"\3658\216\245T]\313\333\243\026\321\250\323*\324O\360\271I6\357"
+	.ascii	"07\317LE\364\034\210#\212\377"
+	.text
+	.section	.gnu.lto_.symtab.a6ede7cc99f41482,"e",@progbits
+	.string	"blackboxConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\006"
+	.string	""
+	.string	"blackboxGetSnapshotsDropped"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\007"
+	.string	""
+	.string	"blackboxMayEditConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\007"
+	.string	""
+	.string	"blackboxStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\007"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\007"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\007"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\007"
+	.string	""
+	.string	"blackboxProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\007"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\007"
+	.string	""
+	.string	"pgResetTemplate_blackboxConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\007"
+	.string	""
+	.string	"blackboxConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\007"
+	.string	""
+	.string	"blackboxConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\007"
+	.string	""
+	.string	"batteryMetersConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\006"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\006"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\006"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\006"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\006"
+	.string	""
+	.string	"GPS_home"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\006"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\005"
+	.string	""
+	.string	"rcModeActivationMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\006"
+	.string	""
+	.string	"axisPID_Setpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\006"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\006"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\006"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\006"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\006"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\006"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\006"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\006"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\006"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\006"
+	.string	""
+	.string	"motor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\006"
+	.string	""
+	.string	"baro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\006"
+	.string	""
+	.string	"pitot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\006"
+	.string	""
+	.string	"servo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\006"
+	.string	""
+	.string	"navCurrentState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\006"
+	.string	""
+	.string	"navFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\006"
+	.string	""
+	.string	"navEPH"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\006"
+	.string	""
+	.string	"navEPV"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\006"
+	.string	""
+	.string	"navLatestActualPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\006"
+	.string	""
+	.string	"navActualVelocity"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\006"
+	.string	""
+	.string	"navAccNEU"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\006"
+	.string	""
+	.string	"navDesiredVelocity"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\006"
+	.string	""
+	.string	"navTargetPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\006"
+	.string	""
+	.string	"navActualSurface"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\006"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\007"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\007"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\007"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\007"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\005"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \007"
+	.string	""
+	.string	"currentBatteryProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\007"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\007"
+	.string	""
+	.string	"pidProfile_ProfileCurrent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\007"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\007"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\007"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\007"
+	.string	""
+	.string	"barometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\007"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\007"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\007"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\007"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\007"
+	.string	""
+	.string	"getRSSISource"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\007"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\007"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\007"
+	.string	""
+	.string	"pidBank"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\007"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\007"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\007"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\007"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\007"
+	.string	""
+	.string	"blackboxWriteBufferFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\007"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\007"
+	.string	""
+	.string	"getThrottleIdleValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\007"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\007"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\007"
+	.string	""
+	.string	"getBaroTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\007"
+	.string	""
+	.string	"getIMUTemperature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\007"
+	.string	""
+	.string	"getEstimatedWindSpeed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\007"
+	.string	""
+	.string	"getBatterySagCompensatedVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\007"
+	.string	""
+	.string	"getPowerSupplyImpedance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\007"
+	.string	""
+	.string	"getHwPitotmeterStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\007"
+	.string	""
+	.string	"getHwRangefinderStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\007"
+	.string	""
+	.string	"getHwGPSStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\007"
+	.string	""
+	.string	"getHwBarometerStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\007"
+	.string	""
+	.string	"getHwCompassStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\007"
+	.string	""
+	.string	"getHwAccelerometerStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\007"
+	.string	""
+	.string	"getHwGyroStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\007"
+	.string	""
+	.string	"rxAreFlightChannelsValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\007"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\007"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\007"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\b"
+	.string	""
+	.string	"blackboxCompressFrame"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\b"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\b"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\b"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\b"
+	.string	""
+	.string	"getRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\b"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\b"
+	.string	""
+	.string	"getBatteryRawVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\b"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\b"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\b"
+	.string	""
+	.string	"getNavigationPIDControllers"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\b"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\b"
+	.string	""
+	.string	"blackboxPrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\b"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\b"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\b"
+	.string	""
+	.string	"getWaypointCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\b"
+	.string	""
+	.string	"isWaypointListValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\b"
+	.string	""
+	.string	"getLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\b"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\b"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\b"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\b"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\b"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\b"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\b"
+	.string	""
+	.string	"getDisarmReason"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\b"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\b"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\b"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\b"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\b"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\b"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\b"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\b"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\b"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a6ede7cc99f41482,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
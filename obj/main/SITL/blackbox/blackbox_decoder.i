@@ -0,0 +1,5874 @@
+# 0 "./src/main/blackbox/blackbox_decoder.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define DEBUG 1
+# 0 "<command-line>"
+#define SIMULATOR_BUILD 1
+# 0 "<command-line>"
+#define FLASH_SIZE 2048
+# 0 "<command-line>"
+#define USE_STDPERIPH_DRIVER 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "inav"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "60f400f"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "./src/main/blackbox/blackbox_decoder.c"
+# 25 "./src/main/blackbox/blackbox_decoder.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 26 "./src/main/blackbox/blackbox_decoder.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 27 "./src/main/blackbox/blackbox_decoder.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 25 "/usr/include/stdlib.h" 3 4
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+#define __need_size_t 
+#define __need_wchar_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+#define _STDLIB_H 1
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 3 4
+#define WNOHANG 1
+#define WUNTRACED 2
+
+
+
+#define WSTOPPED 2
+#define WEXITED 4
+#define WCONTINUED 8
+#define WNOWAIT 0x01000000
+
+
+#define __WNOTHREAD 0x20000000
+
+#define __WALL 0x40000000
+#define __WCLONE 0x80000000
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 3 4
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+
+
+#define __WTERMSIG(status) ((status) & 0x7f)
+
+
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+
+
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+
+
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+
+
+
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+
+
+
+
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+
+
+
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+
+
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define __W_CONTINUED 0xffff
+#define __WCOREFLAG 0x80
+# 42 "/usr/include/stdlib.h" 2 3 4
+
+
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define WTERMSIG(status) __WTERMSIG (status)
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define WIFEXITED(status) __WIFEXITED (status)
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+#define __ldiv_t_defined 1
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+#define __lldiv_t_defined 1
+
+
+
+
+#define RAND_MAX 2147483647
+
+
+
+
+#define EXIT_FAILURE 1
+#define EXIT_SUCCESS 0
+
+
+
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define _SYS_TYPES_H 1
+
+
+
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+#define __u_char_defined 
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+#define __ino_t_defined 
+
+
+
+
+
+
+
+typedef __dev_t dev_t;
+#define __dev_t_defined 
+
+
+
+typedef __gid_t gid_t;
+#define __gid_t_defined 
+
+
+
+typedef __mode_t mode_t;
+#define __mode_t_defined 
+
+
+
+typedef __nlink_t nlink_t;
+#define __nlink_t_defined 
+
+
+
+typedef __uid_t uid_t;
+#define __uid_t_defined 
+
+
+
+
+typedef __off_t off_t;
+
+
+
+#define __off_t_defined 
+
+
+
+
+
+
+
+typedef __pid_t pid_t;
+#define __pid_t_defined 
+
+
+
+
+typedef __id_t id_t;
+#define __id_t_defined 
+
+
+
+typedef __ssize_t ssize_t;
+#define __ssize_t_defined 
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+#define __daddr_t_defined 
+
+
+
+
+typedef __key_t key_t;
+#define __key_t_defined 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+#define __clock_t_defined 1
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+#define __clockid_t_defined 1
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+
+#define __time_t_defined 1
+
+
+
+
+
+
+
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+#define __timer_t_defined 1
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 143 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+
+
+
+
+
+
+#define __BIT_TYPES_DEFINED__ 1
+
+
+
+
+# 1 "/usr/include/endian.h" 1 3 4
+# 19 "/usr/include/endian.h" 3 4
+#define _ENDIAN_H 1
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define _BITS_ENDIAN_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define __LITTLE_ENDIAN 1234
+#define __BIG_ENDIAN 4321
+#define __PDP_ENDIAN 3412
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+
+#define _BITS_ENDIANNESS_H 1
+
+
+
+
+
+
+#define __BYTE_ORDER __LITTLE_ENDIAN
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+
+
+
+
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+
+
+
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+# 25 "/usr/include/endian.h" 2 3 4
+
+
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define BIG_ENDIAN __BIG_ENDIAN
+#define PDP_ENDIAN __PDP_ENDIAN
+#define BYTE_ORDER __BYTE_ORDER
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+#define _BITS_BYTESWAP_H 1
+
+
+
+
+
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+
+
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+#define _BITS_UINTN_IDENTITY_H 1
+
+
+
+
+
+
+
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+
+
+#define htobe16(x) __bswap_16 (x)
+#define htole16(x) __uint16_identity (x)
+#define be16toh(x) __bswap_16 (x)
+#define le16toh(x) __uint16_identity (x)
+
+#define htobe32(x) __bswap_32 (x)
+#define htole32(x) __uint32_identity (x)
+#define be32toh(x) __bswap_32 (x)
+#define le32toh(x) __uint32_identity (x)
+
+#define htobe64(x) __bswap_64 (x)
+#define htole64(x) __uint64_identity (x)
+#define be64toh(x) __bswap_64 (x)
+#define le64toh(x) __uint64_identity (x)
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+#define _SYS_SELECT_H 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/select.h" 3 4
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+
+
+
+
+
+
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+#define __sigset_t_defined 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+#define ____sigset_t_defined 
+
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+#define __timeval_defined 1
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+#define _STRUCT_TIMESPEC 1
+
+
+
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+#define __suseconds_t_defined 
+
+
+
+
+typedef long int __fd_mask;
+
+
+#undef __NFDBITS
+
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+
+
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+#define __FDS_BITS(set) ((set)->__fds_bits)
+
+  } fd_set;
+
+
+#define FD_SETSIZE __FD_SETSIZE
+
+
+
+typedef __fd_mask fd_mask;
+
+
+#define NFDBITS __NFDBITS
+
+
+
+
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+
+
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+#define __blksize_t_defined 
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+#define __blkcnt_t_defined 
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+#define __fsblkcnt_t_defined 
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+#define __fsfilcnt_t_defined 
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+#define _BITS_PTHREADTYPES_COMMON_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+#define _THREAD_SHARED_TYPES_H 1
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define _BITS_PTHREADTYPES_ARCH_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+
+
+
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+# 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __SIZEOF_PTHREAD_COND_T 48
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+
+#define __LOCK_ALIGNMENT 
+#define __ONCE_ALIGNMENT 
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+
+
+
+
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+#define _THREAD_MUTEX_INTERNAL_H 1
+
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+
+
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+#define _RWLOCK_INTERNAL_H 
+
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+
+
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+
+#define __ONCE_FLAG_INIT { 0 }
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+#define __have_pthread_attr_t 1
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 19 "/usr/include/alloca.h" 3 4
+#define _ALLOCA_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+#undef alloca
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+#define alloca(size) __builtin_alloca (size)
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 611 "/usr/include/stdlib.h" 3 4
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 630 "/usr/include/stdlib.h" 3 4
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+# 649 "/usr/include/stdlib.h" 3 4
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+#define __COMPAR_FN_T 
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 28 "./src/main/blackbox/blackbox_decoder.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 29 "./src/main/blackbox/blackbox_decoder.c" 2
+
+# 1 "./src/main/blackbox/blackbox_decoder.h" 1
+# 25 "./src/main/blackbox/blackbox_decoder.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 29 "./src/main/blackbox/blackbox_decoder.h" 2
+
+
+# 1 "./src/main/blackbox/blackbox_fielddefs.h" 1
+# 18 "./src/main/blackbox/blackbox_fielddefs.h"
+       
+
+
+
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 63 "./src/main/platform.h"
+# 1 "./src/main/target/common.h" 1
+# 18 "./src/main/target/common.h"
+       
+
+
+
+
+#define DYNAMIC_HEAP_SIZE 2048
+
+
+#define I2C1_OVERCLOCK false
+#define I2C2_OVERCLOCK false
+#define USE_I2C_PULLUP 
+
+#define USE_RX_PPM 
+#define USE_SERIAL_RX 
+#define USE_SERIALRX_SPEKTRUM 
+#define USE_SERIALRX_SBUS 
+#define USE_SERIALRX_IBUS 
+#define USE_SERIALRX_FPORT 
+
+#define COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)
+# 56 "./src/main/target/common.h"
+#define USE_ADC_AVERAGING 
+#define USE_64BIT_TIME 
+#define USE_BLACKBOX 
+#define USE_GPS 
+#define USE_GPS_PROTO_UBLOX 
+#define USE_NAV 
+#define USE_TELEMETRY 
+#define USE_TELEMETRY_LTM 
+#define USE_TELEMETRY_FRSKY 
+
+
+
+
+#define SCHEDULER_DELAY_LIMIT 100
+
+
+
+#define USE_MR_BRAKING_MODE 
+#define USE_PITOT 
+#define USE_PITOT_ADC 
+#define USE_PITOT_VIRTUAL 
+
+#define USE_DYNAMIC_FILTERS 
+#define USE_GYRO_KALMAN 
+#define USE_EXTENDED_CMS_MENUS 
+#define USE_UAV_INTERCONNECT 
+#define USE_RX_UIB 
+#define USE_HOTT_TEXTMODE 
+
+
+#define USE_GPS_PROTO_NAZA 
+
+
+#define USE_RANGEFINDER 
+#define USE_RANGEFINDER_MSP 
+#define USE_RANGEFINDER_BENEWAKE 
+#define USE_RANGEFINDER_VL53L0X 
+#define USE_RANGEFINDER_HCSR04_I2C 
+
+
+#define USE_OPFLOW 
+#define USE_OPFLOW_CXOF 
+#define USE_OPFLOW_MSP 
+
+#define USE_PITOT 
+#define USE_PITOT_MS4525 
+
+#define USE_1WIRE 
+#define USE_1WIRE_DS2482 
+
+#define USE_TEMPERATURE_SENSOR 
+#define USE_TEMPERATURE_LM75 
+#define USE_TEMPERATURE_DS18B20 
+
+#define USE_MSP_DISPLAYPORT 
+#define USE_DASHBOARD 
+#define DASHBOARD_ARMED_BITMAP 
+#define USE_OLED_UG2864 
+
+#define USE_PWM_DRIVER_PCA9685 
+
+#define USE_TELEMETRY_SIM 
+#define USE_FRSKYOSD 
+#define USE_DJI_HD_OSD 
+
+#define NAV_NON_VOLATILE_WAYPOINT_CLI 
+
+#define NAV_AUTO_MAG_DECLINATION_PRECISE 
+
+#define USE_D_BOOST 
+#define USE_ANTIGRAVITY 
+
+
+
+
+
+
+#define NAV_FIXED_WING_LANDING 
+#define USE_AUTOTUNE_FIXED_WING 
+#define USE_LOG 
+#define USE_STATS 
+#define USE_CMS 
+#define CMS_MENU_OSD 
+#define USE_GPS_PROTO_NMEA 
+#define USE_GPS_PROTO_MTK 
+#define NAV_GPS_GLITCH_DETECTION 
+#define NAV_NON_VOLATILE_WAYPOINT_STORAGE 
+#define USE_TELEMETRY_HOTT 
+#define USE_TELEMETRY_IBUS 
+#define USE_TELEMETRY_MAVLINK 
+#define USE_TELEMETRY_SMARTPORT 
+#define USE_TELEMETRY_CRSF 
+#define USE_MSP_OVER_TELEMETRY 
+
+#define USE_RX_MSP 
+
+#define USE_SERIALRX_SUMD 
+#define USE_SERIALRX_SUMH 
+#define USE_SERIALRX_XBUS 
+#define USE_SERIALRX_JETIEXBUS 
+#define USE_SERIALRX_CRSF 
+#define USE_PWM_SERVO_DRIVER 
+#define USE_SERIAL_PASSTHROUGH 
+#define NAV_MAX_WAYPOINTS 60
+#define USE_RCDEVICE 
+
+
+#define USE_VTX_CONTROL 
+#define USE_VTX_SMARTAUDIO 
+#define USE_VTX_TRAMP 
+#define USE_VTX_FFPV 
+
+
+#define USE_LOGIC_CONDITIONS 
+#define USE_GLOBAL_FUNCTIONS 
+#define USE_CLI_BATCH 
+
+
+
+#define RTC_AUTOMATIC_DST 
+
+#define USE_WIND_ESTIMATOR 
+# 64 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 25 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 29 "./src/main/target/SITL/target.h" 2
+
+
+
+
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+#define USBD_PRODUCT_STRING "SITL"
+
+#define USE_IMU_FAKE 
+#define USE_FAKE_BARO 
+#define USE_FAKE_MAG 
+#define USE_FAKE_GPS 
+
+#define USE_MAG 
+#define USE_BARO 
+
+#define USE_UART1 
+#define USE_UART2 
+#define USE_UART3 
+#define USE_UART4 
+#define USE_UART5 
+#define USE_UART6 
+#define USE_UART7 
+#define USE_UART8 
+#define SERIAL_PORT_COUNT 8
+
+#define DEFAULT_RX_TYPE RX_TYPE_MSP
+#define DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)
+
+#define MAX_PWM_OUTPUT_PORTS 16
+
+#define TARGET_IO_PORTA 0xffff
+#define TARGET_IO_PORTB 0xffff
+#define TARGET_IO_PORTC 0xffff
+
+
+#undef USE_DYNAMIC_FILTERS
+#undef USE_USB_MSC
+#undef USE_SERVO_SBUS
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+#undef USE_PWM_DRIVER_PCA9685
+#undef USE_PWM_SERVO_DRIVER
+#undef USE_RANGEFINDER
+#undef USE_RANGEFINDER_VL53L0X
+#undef USE_RANGEFINDER_HCSR04_I2C
+#undef USE_PITOT_MS4525
+#undef USE_PITOT_ADC
+#undef USE_1WIRE
+#undef USE_1WIRE_DS2482
+#undef USE_TEMPERATURE_SENSOR
+#undef USE_TEMPERATURE_LM75
+#undef USE_TEMPERATURE_DS18B20
+#undef USE_ADC
+#undef USE_VCP
+#undef USE_RX_PPM
+#undef USE_SERIALRX_SPEKTRUM
+#undef USE_RCDEVICE
+#undef USE_SERIAL_PASSTHROUGH
+#undef USE_ITCM_RAM
+
+#define SKIP_CLI_RESOURCES 
+
+
+#define USE_GYRO_STAGE_PROBE 
+
+
+#define U_ID_0 0
+#define U_ID_1 1
+#define U_ID_2 2
+
+
+
+# 101 "./src/main/target/SITL/target.h"
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct { void *test; } GPIO_TypeDef;
+typedef struct { void *test; } TIM_TypeDef;
+typedef struct { void *test; } SPI_TypeDef;
+typedef struct { void *test; } I2C_TypeDef;
+typedef struct { void *test; } USART_TypeDef;
+typedef struct { void *test; } DMA_Stream_TypeDef;
+typedef struct { void *test; } DMA_Channel_TypeDef;
+typedef uint32_t DMA_TypeDef;
+
+#define USART1 ((USART_TypeDef *)0x0001)
+#define USART2 ((USART_TypeDef *)0x0002)
+#define USART3 ((USART_TypeDef *)0x0003)
+#define UART4 ((USART_TypeDef *)0x0004)
+#define UART5 ((USART_TypeDef *)0x0005)
+#define USART6 ((USART_TypeDef *)0x0006)
+#define UART7 ((USART_TypeDef *)0x0007)
+#define UART8 ((USART_TypeDef *)0x0008)
+
+#define __NVIC_PRIO_BITS 4
+static inline void __set_BASEPRI(uint32_t basePri) { (void)basePri; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri) { (void)basePri; }
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __NOP(void) {}
+#define __NOINLINE __attribute__((noinline))
+
+extern uint32_t SystemCoreClock;
+
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+# 65 "./src/main/platform.h" 2
+# 1 "./src/main/target/sanity_check.h" 1
+# 25 "./src/main/target/sanity_check.h"
+       
+# 66 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 20 "./src/main/target/common_post.h"
+       
+
+
+
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+# 46 "./src/main/target/common_post.h"
+#define FAST_CODE 
+#define NOINLINE 
+# 61 "./src/main/target/common_post.h"
+#undef USE_DYNAMIC_FILTERS
+
+
+
+
+#define FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize("-Os")))
+#define FUNCTION_COMPILE_NORMAL __attribute__((optimize("-O2")))
+#define FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize("-Ofast")))
+#define FILE_COMPILE_FOR_SIZE _Pragma("GCC optimize(\"Os\")")
+#define FILE_COMPILE_NORMAL _Pragma("GCC optimize(\"O2\")")
+#define FILE_COMPILE_FOR_SPEED _Pragma("GCC optimize(\"Ofast\")")
+# 67 "./src/main/platform.h" 2
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+# 24 "./src/main/common/time.h" 2
+
+# 1 "./src/main/config/parameter_group.h" 1
+# 18 "./src/main/config/parameter_group.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+# 29 "./src/main/build/build_config.h"
+#define STATIC_UNIT_TESTED static
+#define STATIC_INLINE_UNIT_TESTED static inline
+#define INLINE_UNIT_TESTED inline
+#define UNIT_TESTED 
+
+
+
+
+
+#define REQUIRE_CC_ARM_PRINTF_SUPPORT 
+#define REQUIRE_PRINTF_LONG_SUPPORT 
+
+
+
+
+
+#define FASTRAM __attribute__ ((section(".fastram_bss"), aligned(4)))
+
+
+
+
+
+#define EXTENDED_FASTRAM 
+
+
+#define STATIC_FASTRAM static FASTRAM
+#define STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM
+# 24 "./src/main/config/parameter_group.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000,
+    PGR_SIZE_PROFILE_FLAG = 0x8000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgIsSystem(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == 0;}
+static inline uint16_t pgIsProfile(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == PGR_SIZE_PROFILE_FLAG;}
+
+#define PG_PACKED __attribute__((packed))
+# 75 "./src/main/config/parameter_group.h"
+extern const pgRegistry_t __pg_registry_start[] __asm("__start_pg_registry");
+extern const pgRegistry_t __pg_registry_end[] __asm("__stop_pg_registry");
+#define PG_REGISTER_ATTRIBUTES __attribute__ ((section("pg_registry"), used, aligned(4)))
+
+extern const uint8_t __pg_resetdata_start[] __asm("__start_pg_resetdata");
+extern const uint8_t __pg_resetdata_end[] __asm("__stop_pg_resetdata");
+#define PG_RESETDATA_ATTRIBUTES __attribute__ ((section("pg_resetdata"), used, aligned(2)))
+# 92 "./src/main/config/parameter_group.h"
+#define PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)
+
+
+#define PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)
+
+
+#define PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else
+# 107 "./src/main/config/parameter_group.h"
+#define PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)
+
+
+
+
+
+
+
+#define PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy
+# 124 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _SystemArray[_size]; extern _type _name ## _CopyArray[_size]; static inline const _type* _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy
+# 134 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy
+# 143 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name ## _System; _type _name ## _Copy; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }
+# 158 "./src/main/config/parameter_group.h"
+#define PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })
+
+
+
+
+#define PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+#define PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) _type _name ## _SystemArray[_size]; _type _name ## _CopyArray[_size]; extern const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }
+# 187 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+# 208 "./src/main/config/parameter_group.h"
+#define _PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;
+
+
+
+
+#define PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STATIC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; STATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_COUNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }
+# 228 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+
+
+#define PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }
+
+
+
+
+
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, int profileIndex, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size, uint8_t profileIndex);
+void pgResetAll(int profileCount);
+void pgResetCurrent(const pgRegistry_t *reg);
+
+# 257 "./src/main/config/parameter_group.h" 3 4
+_Bool 
+# 257 "./src/main/config/parameter_group.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg, int profileIndex);
+void pgActivateProfile(int profileIndex);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+typedef uint64_t timeUs_t;
+#define TIMEUS_MAX UINT64_MAX
+
+
+
+
+
+
+#define MILLISECS_PER_SEC 1000
+#define USECS_PER_SEC (1000 * 1000)
+
+#define HZ2US(hz) (1000000 / (hz))
+#define US2S(us) ((us) * 1e-6f)
+#define US2MS(us) ((us) * 1e-3f)
+#define MS2US(ms) ((ms) * 1000)
+#define MS2S(ms) ((ms) * 1e-3f)
+#define HZ2S(hz) US2S(HZ2US(hz))
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+typedef enum {
+    TZ_AUTO_DST_OFF,
+    TZ_AUTO_DST_EU,
+    TZ_AUTO_DST_USA,
+} tz_automatic_dst_e;
+
+typedef struct timeConfig_s {
+    int16_t tz_offset;
+    uint8_t tz_automatic_dst;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+#define FORMATTED_DATE_TIME_BUFSIZE 30
+
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *localDateTime, const dateTime_t *utcDateTime);
+
+
+
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 104 "./src/main/common/time.h" 3 4
+_Bool 
+# 104 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 105 "./src/main/common/time.h" 3 4
+_Bool 
+# 105 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 107 "./src/main/common/time.h" 3 4
+_Bool 
+# 107 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 108 "./src/main/common/time.h" 3 4
+_Bool 
+# 108 "./src/main/common/time.h"
+    rtcGetDateTimeLocal(dateTime_t *dt);
+
+# 109 "./src/main/common/time.h" 3 4
+_Bool 
+# 109 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 24 "./src/main/blackbox/blackbox_fielddefs.h" 2
+
+typedef enum FlightLogFieldCondition {
+    FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
+    FLIGHT_LOG_FIELD_CONDITION_SERVOS,
+
+    FLIGHT_LOG_FIELD_CONDITION_MAG,
+    FLIGHT_LOG_FIELD_CONDITION_BARO,
+    FLIGHT_LOG_FIELD_CONDITION_PITOT,
+    FLIGHT_LOG_FIELD_CONDITION_VBAT,
+    FLIGHT_LOG_FIELD_CONDITION_AMPERAGE,
+    FLIGHT_LOG_FIELD_CONDITION_SURFACE,
+    FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_MC_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_RSSI,
+
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2,
+
+    FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME,
+
+    FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+
+    FLIGHT_LOG_FIELD_CONDITION_NEVER,
+
+    FLIGHT_LOG_FIELD_CONDITION_FIRST = FLIGHT_LOG_FIELD_CONDITION_ALWAYS,
+    FLIGHT_LOG_FIELD_CONDITION_LAST = FLIGHT_LOG_FIELD_CONDITION_NEVER
+} FlightLogFieldCondition;
+
+typedef enum FlightLogFieldPredictor {
+
+    FLIGHT_LOG_FIELD_PREDICTOR_0 = 0,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS = 1,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE = 2,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2 = 3,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE = 4,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0 = 5,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_INC = 6,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD = 7,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_1500 = 8,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_VBATREF = 9,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10
+
+} FlightLogFieldPredictor;
+
+typedef enum FlightLogFieldEncoding {
+    FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB = 0,
+    FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB = 1,
+    FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT = 3,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB = 6,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32 = 7,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 = 8,
+    FLIGHT_LOG_FIELD_ENCODING_NULL = 9
+} FlightLogFieldEncoding;
+
+typedef enum FlightLogFieldSign {
+    FLIGHT_LOG_FIELD_UNSIGNED = 0,
+    FLIGHT_LOG_FIELD_SIGNED = 1
+} FlightLogFieldSign;
+
+typedef enum FlightLogCompression {
+    FLIGHT_LOG_COMPRESSION_NONE = 0,
+    FLIGHT_LOG_COMPRESSION_HUFFMAN = 1
+} FlightLogCompression;
+
+
+#define FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_IMU_FAILURE = 40,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct flightLogEvent_syncBeep_s {
+    uint32_t time;
+} flightLogEvent_syncBeep_t;
+
+typedef struct flightLogEvent_flightMode_s {
+    uint32_t flags;
+    uint32_t lastFlags;
+} flightLogEvent_flightMode_t;
+
+typedef struct flightLogEvent_inflightAdjustment_s {
+    uint8_t adjustmentFunction;
+    
+# 140 "./src/main/blackbox/blackbox_fielddefs.h" 3 4
+   _Bool 
+# 140 "./src/main/blackbox/blackbox_fielddefs.h"
+        floatFlag;
+    int32_t newValue;
+    float newFloatValue;
+} flightLogEvent_inflightAdjustment_t;
+
+typedef struct flightLogEvent_loggingResume_s {
+    uint32_t logIteration;
+    timeUs_t currentTimeUs;
+} flightLogEvent_loggingResume_t;
+
+typedef struct flightLogEvent_IMUError_s {
+    uint32_t errorCode;
+} flightLogEvent_IMUError_t;
+
+#define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
+
+typedef union flightLogEventData_u {
+    flightLogEvent_syncBeep_t syncBeep;
+    flightLogEvent_flightMode_t flightMode;
+    flightLogEvent_inflightAdjustment_t inflightAdjustment;
+    flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_IMUError_t imuError;
+} flightLogEventData_t;
+
+typedef struct flightLogEvent_s {
+    FlightLogEvent event;
+    flightLogEventData_t data;
+} flightLogEvent_t;
+# 32 "./src/main/blackbox/blackbox_decoder.h" 2
+# 1 "./src/main/blackbox/blackbox_huffman.h" 1
+# 25 "./src/main/blackbox/blackbox_huffman.h"
+       
+# 35 "./src/main/blackbox/blackbox_huffman.h"
+#define BLACKBOX_HUFFMAN_MAX_CODE_LENGTH 16
+
+typedef struct blackboxHuffmanCode_s {
+    uint8_t length;
+    uint16_t code;
+} blackboxHuffmanCode_t;
+
+typedef struct blackboxHuffmanDecoder_s {
+    uint16_t firstCode[16 + 1];
+    uint16_t firstIndex[16 + 1];
+    uint16_t count[16 + 1];
+    uint8_t symbols[256];
+} blackboxHuffmanDecoder_t;
+
+extern const blackboxHuffmanCode_t blackboxHuffmanTable[256];
+
+
+int blackboxHuffmanEncode(uint8_t *out, int outSize, const uint8_t *in, int inLength);
+
+void blackboxHuffmanDecoderInit(blackboxHuffmanDecoder_t *decoder);
+
+int blackboxHuffmanDecode(const blackboxHuffmanDecoder_t *decoder, uint8_t *out, int outLength, const uint8_t *in, int inSize);
+# 33 "./src/main/blackbox/blackbox_decoder.h" 2
+# 43 "./src/main/blackbox/blackbox_decoder.h"
+#define BLACKBOX_DECODER_MAX_FIELDS 128
+#define BLACKBOX_DECODER_MAX_HEADERS 160
+#define BLACKBOX_DECODER_HEADER_TEXT_SIZE 12288
+#define BLACKBOX_DECODER_FRAME_SIZE 256
+#define BLACKBOX_DECODER_SYNC_FRAMES 8
+
+typedef enum {
+    BLACKBOX_DECODER_DEF_MAIN = 0,
+    BLACKBOX_DECODER_DEF_SLOW,
+    BLACKBOX_DECODER_DEF_GPS,
+    BLACKBOX_DECODER_DEF_HOME,
+    BLACKBOX_DECODER_DEF_COUNT
+} blackboxDecoderDef_e;
+
+typedef struct blackboxDecoderFieldDefs_s {
+    int count;
+    const char *name[128];
+    uint8_t isSigned[128];
+    uint8_t predictor[128];
+    uint8_t encoding[128];
+    uint8_t deltaPredictor[128];
+    uint8_t deltaEncoding[128];
+} blackboxDecoderFieldDefs_t;
+
+typedef struct blackboxDecoderHeader_s {
+    const char *name;
+    const char *value;
+} blackboxDecoderHeader_t;
+
+typedef struct blackboxDecodedFrame_s {
+    char type;
+    int fieldCount;
+    const int32_t *values;
+    uint32_t skippedFrames;
+    flightLogEvent_t event;
+    size_t offset;
+} blackboxDecodedFrame_t;
+
+typedef struct blackboxDecoderStats_s {
+    uint32_t intraFrames;
+    uint32_t interFrames;
+    uint32_t compressedFrames;
+    uint32_t slowFrames;
+    uint32_t gpsFrames;
+    uint32_t homeFrames;
+    uint32_t eventFrames;
+    uint32_t corruptFrames;
+    uint32_t skippedBytes;
+} blackboxDecoderStats_t;
+
+typedef struct blackboxDecoder_s {
+    const uint8_t *data;
+    const uint8_t *end;
+    const uint8_t *pos;
+
+    int headerCount;
+    blackboxDecoderHeader_t headers[160];
+    char headerText[12288];
+    size_t headerTextUsed;
+
+    blackboxDecoderFieldDefs_t defs[BLACKBOX_DECODER_DEF_COUNT];
+
+    uint32_t frameIntervalI;
+    uint32_t frameIntervalPNum;
+    uint32_t frameIntervalPDenom;
+    int32_t minthrottle;
+    int32_t vbatref;
+    uint8_t compression;
+
+    blackboxHuffmanDecoder_t huffman;
+    uint8_t frameBuffer[256];
+
+    int motor0Index;
+    int mainIterationIndex;
+    int mainTimeIndex;
+
+    
+# 119 "./src/main/blackbox/blackbox_decoder.h" 3 4
+   _Bool 
+# 119 "./src/main/blackbox/blackbox_decoder.h"
+        mainStreamValid;
+    
+# 120 "./src/main/blackbox/blackbox_decoder.h" 3 4
+   _Bool 
+# 120 "./src/main/blackbox/blackbox_decoder.h"
+        logEnded;
+    uint32_t lastMainIteration;
+    int32_t lastMainTime;
+    int32_t mainPrevious[128];
+    int32_t mainPrevious2[128];
+    int32_t frameValues[128];
+    int32_t homeValues[128];
+    int32_t slowValues[128];
+    int32_t gpsValues[128];
+
+    blackboxDecoderStats_t stats;
+} blackboxDecoder_t;
+
+
+int blackboxDecoderFindLogs(const uint8_t *data, size_t size, size_t *logOffsets, int maxLogs);
+
+
+
+# 137 "./src/main/blackbox/blackbox_decoder.h" 3 4
+_Bool 
+# 137 "./src/main/blackbox/blackbox_decoder.h"
+    blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t size);
+
+const char *blackboxDecoderGetHeader(const blackboxDecoder_t *decoder, const char *name);
+int32_t blackboxDecoderGetHeaderInt(const blackboxDecoder_t *decoder, const char *name, int32_t defaultValue);
+int blackboxDecoderFieldIndex(const blackboxDecoder_t *decoder, blackboxDecoderDef_e def, const char *name);
+
+
+
+# 144 "./src/main/blackbox/blackbox_decoder.h" 3 4
+_Bool 
+# 144 "./src/main/blackbox/blackbox_decoder.h"
+    blackboxDecoderNext(blackboxDecoder_t *decoder, blackboxDecodedFrame_t *frame);
+# 155 "./src/main/blackbox/blackbox_decoder.h"
+void blackboxDecoderInitSegment(blackboxDecoder_t *segment, const blackboxDecoder_t *decoder, size_t start, size_t end);
+
+
+
+size_t blackboxDecoderFindIntraframe(const blackboxDecoder_t *decoder, blackboxDecoder_t *scratch, size_t offset, size_t end);
+# 31 "./src/main/blackbox/blackbox_decoder.c" 2
+
+#define LOG_START_MARKER "H Product:Blackbox flight data recorder by Nicholas Sherlock\n"
+#define LOG_END_MESSAGE "End of log"
+#define LOG_END_MAX_LENGTH 64
+
+typedef struct decoderStream_s {
+    const uint8_t *pos;
+    const uint8_t *end;
+    
+# 39 "./src/main/blackbox/blackbox_decoder.c" 3 4
+   _Bool 
+# 39 "./src/main/blackbox/blackbox_decoder.c"
+        overrun;
+} decoderStream_t;
+
+static uint8_t streamReadByte(decoderStream_t *stream)
+{
+    if (stream->pos >= stream->end) {
+        stream->overrun = 
+# 45 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                         1
+# 45 "./src/main/blackbox/blackbox_decoder.c"
+                             ;
+        return 0;
+    }
+    return *stream->pos++;
+}
+
+static uint32_t streamReadUnsignedVB(decoderStream_t *stream)
+{
+    uint32_t result = 0;
+
+
+    for (int shift = 0; shift < 35; shift += 7) {
+        const uint8_t c = streamReadByte(stream);
+        result |= (uint32_t)(c & 0x7F) << shift;
+        if (!(c & 0x80)) {
+            return result;
+        }
+    }
+
+
+    stream->overrun = 
+# 65 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                     1
+# 65 "./src/main/blackbox/blackbox_decoder.c"
+                         ;
+    return 0;
+}
+
+static int32_t zigzagDecode(uint32_t value)
+{
+    return (int32_t)((value >> 1) ^ -(int32_t)(value & 1));
+}
+
+static int32_t streamReadSignedVB(decoderStream_t *stream)
+{
+    return zigzagDecode(streamReadUnsignedVB(stream));
+}
+
+static int32_t signExtend(uint32_t value, int bits)
+{
+    const uint32_t signBit = 1U << (bits - 1);
+    value &= (signBit << 1) - 1;
+    return (int32_t)((value ^ signBit) - signBit);
+}
+
+
+
+
+static void streamReadTag2_3S32(decoderStream_t *stream, int32_t *values)
+{
+    const uint8_t leadByte = streamReadByte(stream);
+    uint8_t b;
+
+    switch (leadByte >> 6) {
+    case 0:
+        values[0] = signExtend(leadByte >> 4, 2);
+        values[1] = signExtend(leadByte >> 2, 2);
+        values[2] = signExtend(leadByte, 2);
+        break;
+    case 1:
+        values[0] = signExtend(leadByte, 4);
+        b = streamReadByte(stream);
+        values[1] = signExtend(b >> 4, 4);
+        values[2] = signExtend(b, 4);
+        break;
+    case 2:
+        values[0] = signExtend(leadByte, 6);
+        values[1] = signExtend(streamReadByte(stream), 6);
+        values[2] = signExtend(streamReadByte(stream), 6);
+        break;
+    case 3:
+        {
+            uint8_t selector = leadByte;
+            for (int x = 0; x < 3; x++, selector >>= 2) {
+                const int byteCount = (selector & 0x03) + 1;
+                uint32_t value = 0;
+                for (int i = 0; i < byteCount; i++) {
+                    value |= (uint32_t)streamReadByte(stream) << (i * 8);
+                }
+                values[x] = signExtend(value, byteCount * 8);
+            }
+        }
+        break;
+    }
+}
+
+
+
+
+static void streamReadTag8_4S16(decoderStream_t *stream, int32_t *values)
+{
+    uint8_t selector = streamReadByte(stream);
+    
+# 133 "./src/main/blackbox/blackbox_decoder.c" 3 4
+   _Bool 
+# 133 "./src/main/blackbox/blackbox_decoder.c"
+        haveNibble = 
+# 133 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                     0
+# 133 "./src/main/blackbox/blackbox_decoder.c"
+                          ;
+    uint8_t buffer = 0;
+
+    for (int x = 0; x < 4; x++, selector >>= 2) {
+        uint8_t b1, b2;
+
+        switch (selector & 0x03) {
+        case 0:
+            values[x] = 0;
+            break;
+        case 1:
+            if (!haveNibble) {
+                buffer = streamReadByte(stream);
+                values[x] = signExtend(buffer >> 4, 4);
+                haveNibble = 
+# 147 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                            1
+# 147 "./src/main/blackbox/blackbox_decoder.c"
+                                ;
+            } else {
+                values[x] = signExtend(buffer, 4);
+                haveNibble = 
+# 150 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                            0
+# 150 "./src/main/blackbox/blackbox_decoder.c"
+                                 ;
+            }
+            break;
+        case 2:
+            if (!haveNibble) {
+                values[x] = (int8_t)streamReadByte(stream);
+            } else {
+                b1 = streamReadByte(stream);
+                values[x] = (int8_t)((buffer << 4) | (b1 >> 4));
+                buffer = b1;
+            }
+            break;
+        case 3:
+            if (!haveNibble) {
+                b1 = streamReadByte(stream);
+                b2 = streamReadByte(stream);
+                values[x] = (int16_t)((b1 << 8) | b2);
+            } else {
+                b1 = streamReadByte(stream);
+                b2 = streamReadByte(stream);
+                values[x] = (int16_t)(((buffer & 0x0F) << 12) | (b1 << 4) | (b2 >> 4));
+                buffer = b2;
+            }
+            break;
+        }
+    }
+}
+
+
+
+
+static void streamReadTag8_8SVB(decoderStream_t *stream, int32_t *values, int valueCount)
+{
+    if (valueCount == 1) {
+        values[0] = streamReadSignedVB(stream);
+        return;
+    }
+
+    uint8_t header = streamReadByte(stream);
+    for (int i = 0; i < valueCount; i++, header >>= 1) {
+        values[i] = (header & 0x01) ? streamReadSignedVB(stream) : 0;
+    }
+}
+
+static 
+# 194 "./src/main/blackbox/blackbox_decoder.c" 3 4
+      _Bool 
+# 194 "./src/main/blackbox/blackbox_decoder.c"
+           isFrameMarker(uint8_t c)
+{
+    return c == 'I' || c == 'P' || c == 'E' || c == 'S' || c == 'G' || c == 'H' || c == 'C';
+}
+
+static const uint8_t *findLogStart(const uint8_t *data, const uint8_t *end)
+{
+    const size_t markerLength = strlen("H Product:Blackbox flight data recorder by Nicholas Sherlock\n");
+
+    for (const uint8_t *p = data; p + markerLength <= end; p++) {
+        p = memchr(p, 'H', end - p);
+        if (!p || p + markerLength > end) {
+            break;
+        }
+        if (memcmp(p, "H Product:Blackbox flight data recorder by Nicholas Sherlock\n", markerLength) == 0) {
+            return p;
+        }
+    }
+
+    return 
+# 213 "./src/main/blackbox/blackbox_decoder.c" 3 4
+          ((void *)0)
+# 213 "./src/main/blackbox/blackbox_decoder.c"
+              ;
+}
+
+int blackboxDecoderFindLogs(const uint8_t *data, size_t size, size_t *logOffsets, int maxLogs)
+{
+    const uint8_t *end = data + size;
+    int logCount = 0;
+
+    for (const uint8_t *p = findLogStart(data, end); p && logCount < maxLogs; p = findLogStart(p + 1, end)) {
+        logOffsets[logCount++] = p - data;
+    }
+
+    return logCount;
+}
+
+static char *storeHeaderText(blackboxDecoder_t *decoder, const char *text, size_t length)
+{
+    if (decoder->headerTextUsed + length + 1 > sizeof(decoder->headerText)) {
+        return 
+# 231 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              ((void *)0)
+# 231 "./src/main/blackbox/blackbox_decoder.c"
+                  ;
+    }
+
+    char *stored = &decoder->headerText[decoder->headerTextUsed];
+    memcpy(stored, text, length);
+    stored[length] = '\0';
+    decoder->headerTextUsed += length + 1;
+
+    return stored;
+}
+
+static int frameCharToDef(char frameChar)
+{
+    switch (frameChar) {
+    case 'I':
+    case 'P':
+        return BLACKBOX_DECODER_DEF_MAIN;
+    case 'S':
+        return BLACKBOX_DECODER_DEF_SLOW;
+    case 'G':
+        return BLACKBOX_DECODER_DEF_GPS;
+    case 'H':
+        return BLACKBOX_DECODER_DEF_HOME;
+    default:
+        return -1;
+    }
+}
+
+
+
+
+static void parseFieldDefinition(blackboxDecoder_t *decoder, char frameChar, const char *property, char *values)
+{
+    const int defIndex = frameCharToDef(frameChar);
+    if (defIndex < 0) {
+        return;
+    }
+
+    blackboxDecoderFieldDefs_t *defs = &decoder->defs[defIndex];
+    const 
+# 270 "./src/main/blackbox/blackbox_decoder.c" 3 4
+         _Bool 
+# 270 "./src/main/blackbox/blackbox_decoder.c"
+              isName = strcmp(property, "name") == 0;
+    uint8_t *target = 
+# 271 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                     ((void *)0)
+# 271 "./src/main/blackbox/blackbox_decoder.c"
+                         ;
+
+    if (frameChar == 'P') {
+        if (strcmp(property, "predictor") == 0) {
+            target = defs->deltaPredictor;
+        } else if (strcmp(property, "encoding") == 0) {
+            target = defs->deltaEncoding;
+        }
+    } else if (strcmp(property, "signed") == 0) {
+        target = defs->isSigned;
+    } else if (strcmp(property, "predictor") == 0) {
+        target = defs->predictor;
+    } else if (strcmp(property, "encoding") == 0) {
+        target = defs->encoding;
+    }
+
+    if (!isName && !target) {
+        return;
+    }
+
+    int count = 0;
+    for (char *value = values; value && count < 128; count++) {
+        char *next = strchr(value, ',');
+        if (next) {
+            *next++ = '\0';
+        }
+        if (isName) {
+            defs->name[count] = value;
+        } else {
+            target[count] = atoi(value);
+        }
+        value = next;
+    }
+
+    if (isName) {
+        defs->count = count;
+    }
+}
+
+static void parseHeaderLine(blackboxDecoder_t *decoder, const char *line, size_t length)
+{
+    char *text = storeHeaderText(decoder, line, length);
+    if (!text) {
+        return;
+    }
+
+    char *value = strchr(text, ':');
+    if (!value) {
+        return;
+    }
+    *value++ = '\0';
+
+    if (strncmp(text, "Field ", 6) == 0 && strlen(text) > 8) {
+        parseFieldDefinition(decoder, text[6], text + 8, value);
+        return;
+    }
+
+    if (decoder->headerCount < 160) {
+        decoder->headers[decoder->headerCount].name = text;
+        decoder->headers[decoder->headerCount].value = value;
+        decoder->headerCount++;
+    }
+}
+
+const char *blackboxDecoderGetHeader(const blackboxDecoder_t *decoder, const char *name)
+{
+    for (int i = 0; i < decoder->headerCount; i++) {
+        if (strcmp(decoder->headers[i].name, name) == 0) {
+            return decoder->headers[i].value;
+        }
+    }
+    return 
+# 342 "./src/main/blackbox/blackbox_decoder.c" 3 4
+          ((void *)0)
+# 342 "./src/main/blackbox/blackbox_decoder.c"
+              ;
+}
+
+int32_t blackboxDecoderGetHeaderInt(const blackboxDecoder_t *decoder, const char *name, int32_t defaultValue)
+{
+    const char *value = blackboxDecoderGetHeader(decoder, name);
+    return value ? (int32_t)strtol(value, 
+# 348 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                         ((void *)0)
+# 348 "./src/main/blackbox/blackbox_decoder.c"
+                                             , 0) : defaultValue;
+}
+
+int blackboxDecoderFieldIndex(const blackboxDecoder_t *decoder, blackboxDecoderDef_e def, const char *name)
+{
+    const blackboxDecoderFieldDefs_t *defs = &decoder->defs[def];
+
+    for (int i = 0; i < defs->count; i++) {
+        if (strcmp(defs->name[i], name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+
+# 363 "./src/main/blackbox/blackbox_decoder.c" 3 4
+_Bool 
+# 363 "./src/main/blackbox/blackbox_decoder.c"
+    blackboxDecoderInit(blackboxDecoder_t *decoder, const uint8_t *data, size_t size)
+{
+    memset(decoder, 0, sizeof(*decoder));
+
+    decoder->data = data;
+    decoder->end = data + size;
+
+    const uint8_t *start = findLogStart(data, decoder->end);
+    if (!start) {
+        return 
+# 372 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 372 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+
+    const uint8_t *nextLog = findLogStart(start + 1, decoder->end);
+    if (nextLog) {
+        decoder->end = nextLog;
+    }
+
+    const uint8_t *p = start;
+    while (p + 1 < decoder->end && p[0] == 'H' && p[1] == ' ') {
+        const uint8_t *lineEnd = memchr(p, '\n', decoder->end - p);
+        if (!lineEnd) {
+            return 
+# 385 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                  0
+# 385 "./src/main/blackbox/blackbox_decoder.c"
+                       ;
+        }
+        parseHeaderLine(decoder, (const char *)p + 2, lineEnd - p - 2);
+        p = lineEnd + 1;
+    }
+    decoder->pos = p;
+
+    const blackboxDecoderFieldDefs_t *mainDefs = &decoder->defs[BLACKBOX_DECODER_DEF_MAIN];
+    if (mainDefs->count == 0) {
+        return 
+# 394 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 394 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+    decoder->frameIntervalI = blackboxDecoderGetHeaderInt(decoder, "I interval", 32);
+    if (decoder->frameIntervalI < 1) {
+        decoder->frameIntervalI = 1;
+    }
+
+    decoder->frameIntervalPNum = 1;
+    decoder->frameIntervalPDenom = 1;
+    const char *pInterval = blackboxDecoderGetHeader(decoder, "P interval");
+    if (pInterval) {
+        const char *slash = strchr(pInterval, '/');
+        decoder->frameIntervalPNum = atoi(pInterval);
+        decoder->frameIntervalPDenom = slash ? atoi(slash + 1) : 1;
+        if (decoder->frameIntervalPNum < 1 || decoder->frameIntervalPDenom < 1) {
+            decoder->frameIntervalPNum = 1;
+            decoder->frameIntervalPDenom = 1;
+        }
+    }
+
+    decoder->minthrottle = blackboxDecoderGetHeaderInt(decoder, "minthrottle", 1150);
+    decoder->vbatref = blackboxDecoderGetHeaderInt(decoder, "vbatref", 0);
+
+    decoder->compression = blackboxDecoderGetHeaderInt(decoder, "Data compression", FLIGHT_LOG_COMPRESSION_NONE);
+    if (decoder->compression == FLIGHT_LOG_COMPRESSION_HUFFMAN) {
+        blackboxHuffmanDecoderInit(&decoder->huffman);
+    } else if (decoder->compression != FLIGHT_LOG_COMPRESSION_NONE) {
+        return 
+# 422 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 422 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+    decoder->motor0Index = blackboxDecoderFieldIndex(decoder, BLACKBOX_DECODER_DEF_MAIN, "motor[0]");
+    decoder->mainIterationIndex = blackboxDecoderFieldIndex(decoder, BLACKBOX_DECODER_DEF_MAIN, "loopIteration");
+    decoder->mainTimeIndex = blackboxDecoderFieldIndex(decoder, BLACKBOX_DECODER_DEF_MAIN, "time");
+
+    return 
+# 429 "./src/main/blackbox/blackbox_decoder.c" 3 4
+          1
+# 429 "./src/main/blackbox/blackbox_decoder.c"
+              ;
+}
+
+
+
+
+static 
+# 435 "./src/main/blackbox/blackbox_decoder.c" 3 4
+      _Bool 
+# 435 "./src/main/blackbox/blackbox_decoder.c"
+           shouldHaveMainFrame(const blackboxDecoder_t *decoder, uint32_t iteration)
+{
+    const uint32_t pFrameIndex = iteration % decoder->frameIntervalI;
+    return (pFrameIndex + decoder->frameIntervalPNum - 1) % decoder->frameIntervalPDenom < decoder->frameIntervalPNum;
+}
+
+static uint32_t countSkippedFrames(const blackboxDecoder_t *decoder)
+{
+    uint32_t count = 0;
+
+    for (uint32_t iteration = decoder->lastMainIteration + 1; !shouldHaveMainFrame(decoder, iteration) && count < decoder->frameIntervalI; iteration++) {
+        count++;
+    }
+
+    return count;
+}
+
+static void readFieldValues(decoderStream_t *stream, const uint8_t *encoding, int fieldCount, int32_t *values)
+{
+    int32_t group[8];
+
+    for (int i = 0; i < fieldCount && !stream->overrun;) {
+        int groupCount;
+
+        switch (encoding[i]) {
+        case FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB:
+            values[i++] = streamReadSignedVB(stream);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB:
+            values[i++] = streamReadUnsignedVB(stream);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT:
+            values[i++] = -signExtend(streamReadUnsignedVB(stream), 14);
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_NULL:
+            values[i++] = 0;
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32:
+            streamReadTag2_3S32(stream, group);
+            for (int j = 0; j < 3 && i < fieldCount; j++) {
+                values[i++] = group[j];
+            }
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16:
+            streamReadTag8_4S16(stream, group);
+            for (int j = 0; j < 4 && i < fieldCount; j++) {
+                values[i++] = group[j];
+            }
+            break;
+        case FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB:
+
+            groupCount = 1;
+            while (groupCount < 8 && i + groupCount < fieldCount && encoding[i + groupCount] == FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB) {
+                groupCount++;
+            }
+            streamReadTag8_8SVB(stream, group, groupCount);
+            for (int j = 0; j < groupCount; j++) {
+                values[i++] = group[j];
+            }
+            break;
+        default:
+
+            stream->overrun = 
+# 497 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                             1
+# 497 "./src/main/blackbox/blackbox_decoder.c"
+                                 ;
+            break;
+        }
+    }
+}
+
+static void applyPredictors(blackboxDecoder_t *decoder, blackboxDecoderDef_e def, const uint8_t *predictor,
+        int32_t *values, const int32_t *previous, const int32_t *previous2, uint32_t skippedFrames)
+{
+    const blackboxDecoderFieldDefs_t *defs = &decoder->defs[def];
+    int homeCoordIndex = 0;
+
+    for (int i = 0; i < defs->count; i++) {
+        uint32_t prediction = 0;
+
+        switch (predictor[i]) {
+        case FLIGHT_LOG_FIELD_PREDICTOR_0:
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS:
+            prediction = previous ? previous[i] : 0;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE:
+            prediction = previous ? 2 * (uint32_t)previous[i] - (uint32_t)previous2[i] : 0;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2:
+            if (previous) {
+                if (defs->isSigned[i]) {
+                    prediction = ((int64_t)previous[i] + previous2[i]) / 2;
+                } else {
+                    prediction = ((uint64_t)(uint32_t)previous[i] + (uint32_t)previous2[i]) / 2;
+                }
+            }
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE:
+            prediction = decoder->minthrottle;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0:
+            if (decoder->motor0Index >= 0 && decoder->motor0Index < i) {
+                prediction = values[decoder->motor0Index];
+            }
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_INC:
+            prediction = previous ? (uint32_t)previous[i] + skippedFrames + 1 : 0;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD:
+
+            if (homeCoordIndex < 2) {
+                prediction = decoder->homeValues[homeCoordIndex++];
+            }
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_1500:
+            prediction = 1500;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_VBATREF:
+            prediction = decoder->vbatref;
+            break;
+        case FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME:
+            prediction = decoder->lastMainTime;
+            break;
+        }
+
+        values[i] = (int32_t)((uint32_t)values[i] + prediction);
+    }
+}
+
+static 
+# 562 "./src/main/blackbox/blackbox_decoder.c" 3 4
+      _Bool 
+# 562 "./src/main/blackbox/blackbox_decoder.c"
+           decodeEvent(decoderStream_t *stream, flightLogEvent_t *event)
+{
+    event->event = streamReadByte(stream);
+
+    switch (event->event) {
+    case FLIGHT_LOG_EVENT_SYNC_BEEP:
+        event->data.syncBeep.time = streamReadUnsignedVB(stream);
+        break;
+    case FLIGHT_LOG_EVENT_FLIGHTMODE:
+        event->data.flightMode.flags = streamReadUnsignedVB(stream);
+        event->data.flightMode.lastFlags = streamReadUnsignedVB(stream);
+        break;
+    case FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT:
+        {
+            const uint8_t function = streamReadByte(stream);
+            event->data.inflightAdjustment.adjustmentFunction = function & ~128;
+            event->data.inflightAdjustment.floatFlag = function & 128;
+            if (event->data.inflightAdjustment.floatFlag) {
+                uint32_t bits = 0;
+                for (int i = 0; i < 4; i++) {
+                    bits |= (uint32_t)streamReadByte(stream) << (i * 8);
+                }
+                memcpy(&event->data.inflightAdjustment.newFloatValue, &bits, sizeof(bits));
+            } else {
+                event->data.inflightAdjustment.newValue = streamReadSignedVB(stream);
+            }
+        }
+        break;
+    case FLIGHT_LOG_EVENT_LOGGING_RESUME:
+        event->data.loggingResume.logIteration = streamReadUnsignedVB(stream);
+        event->data.loggingResume.currentTimeUs = streamReadUnsignedVB(stream);
+        break;
+    case FLIGHT_LOG_EVENT_IMU_FAILURE:
+        event->data.imuError.errorCode = streamReadUnsignedVB(stream);
+        break;
+    case FLIGHT_LOG_EVENT_LOG_END:
+        {
+
+            const size_t available = stream->end - stream->pos;
+            const uint8_t *terminator = memchr(stream->pos, '\0', available < 64 ? available : 64);
+            if (!terminator || available < strlen("End of log") || memcmp(stream->pos, "End of log", strlen("End of log")) != 0) {
+                return 
+# 603 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                      0
+# 603 "./src/main/blackbox/blackbox_decoder.c"
+                           ;
+            }
+            stream->pos = terminator + 1;
+        }
+        break;
+    default:
+        return 
+# 609 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 609 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+    return !stream->overrun;
+}
+
+
+
+
+
+static decoderStream_t decompressFrame(blackboxDecoder_t *decoder, decoderStream_t *stream)
+{
+    decoderStream_t payload = { .pos = decoder->frameBuffer, .end = decoder->frameBuffer, .overrun = 
+# 621 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                                                                                    1 
+# 621 "./src/main/blackbox/blackbox_decoder.c"
+                                                                                                         };
+
+    const uint32_t payloadLength = streamReadUnsignedVB(stream);
+    if (stream->overrun || decoder->compression != FLIGHT_LOG_COMPRESSION_HUFFMAN || payloadLength > sizeof(decoder->frameBuffer)) {
+        return payload;
+    }
+
+    const int consumed = blackboxHuffmanDecode(&decoder->huffman, decoder->frameBuffer, payloadLength, stream->pos, stream->end - stream->pos);
+    if (consumed < 0) {
+        return payload;
+    }
+
+    stream->pos += consumed;
+    payload.end = decoder->frameBuffer + payloadLength;
+    payload.overrun = 
+# 635 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                     0
+# 635 "./src/main/blackbox/blackbox_decoder.c"
+                          ;
+
+    return payload;
+}
+
+static void startResync(blackboxDecoder_t *decoder, const uint8_t *frameStart)
+{
+    decoder->stats.corruptFrames++;
+    decoder->mainStreamValid = 
+# 643 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                              0
+# 643 "./src/main/blackbox/blackbox_decoder.c"
+                                   ;
+    decoder->pos = frameStart + 1;
+}
+
+
+# 647 "./src/main/blackbox/blackbox_decoder.c" 3 4
+_Bool 
+# 647 "./src/main/blackbox/blackbox_decoder.c"
+    blackboxDecoderNext(blackboxDecoder_t *decoder, blackboxDecodedFrame_t *frame)
+{
+    blackboxDecoderFieldDefs_t *mainDefs = &decoder->defs[BLACKBOX_DECODER_DEF_MAIN];
+
+    while (!decoder->logEnded && decoder->pos < decoder->end) {
+        const uint8_t *frameStart = decoder->pos;
+        char frameType = *frameStart;
+
+
+        if (!decoder->mainStreamValid && frameType != 'I' && frameType != 'E') {
+            decoder->pos++;
+            decoder->stats.skippedBytes++;
+            continue;
+        }
+
+        decoderStream_t stream = { .pos = frameStart + 1, .end = decoder->end, .overrun = 
+# 662 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                                                                         0 
+# 662 "./src/main/blackbox/blackbox_decoder.c"
+                                                                                               };
+        uint32_t skippedFrames = 0;
+        int32_t *values = 
+# 664 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                         ((void *)0)
+# 664 "./src/main/blackbox/blackbox_decoder.c"
+                             ;
+        int fieldCount = 0;
+        
+# 666 "./src/main/blackbox/blackbox_decoder.c" 3 4
+       _Bool 
+# 666 "./src/main/blackbox/blackbox_decoder.c"
+            valid = 
+# 666 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                    1
+# 666 "./src/main/blackbox/blackbox_decoder.c"
+                        ;
+
+        memset(frame, 0, sizeof(*frame));
+
+        switch (frameType) {
+        case 'I':
+            fieldCount = mainDefs->count;
+            values = decoder->frameValues;
+            readFieldValues(&stream, mainDefs->encoding, fieldCount, values);
+            applyPredictors(decoder, BLACKBOX_DECODER_DEF_MAIN, mainDefs->predictor, values, 
+# 675 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                                                                            ((void *)0)
+# 675 "./src/main/blackbox/blackbox_decoder.c"
+                                                                                                , 
+# 675 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                                                                                  ((void *)0)
+# 675 "./src/main/blackbox/blackbox_decoder.c"
+                                                                                                      , 0);
+            break;
+        case 'P':
+            fieldCount = mainDefs->count;
+            values = decoder->frameValues;
+            skippedFrames = countSkippedFrames(decoder);
+            readFieldValues(&stream, mainDefs->deltaEncoding, fieldCount, values);
+            applyPredictors(decoder, BLACKBOX_DECODER_DEF_MAIN, mainDefs->deltaPredictor, values,
+                decoder->mainPrevious, decoder->mainPrevious2, skippedFrames);
+            break;
+        case 'C':
+            {
+                decoderStream_t payload = decompressFrame(decoder, &stream);
+
+                fieldCount = mainDefs->count;
+                values = decoder->frameValues;
+                skippedFrames = countSkippedFrames(decoder);
+                readFieldValues(&payload, mainDefs->deltaEncoding, fieldCount, values);
+                applyPredictors(decoder, BLACKBOX_DECODER_DEF_MAIN, mainDefs->deltaPredictor, values,
+                    decoder->mainPrevious, decoder->mainPrevious2, skippedFrames);
+                valid = !payload.overrun && payload.pos == payload.end;
+            }
+            break;
+        case 'S':
+        case 'G':
+        case 'H':
+            {
+                const blackboxDecoderDef_e def = frameCharToDef(frameType);
+                const blackboxDecoderFieldDefs_t *defs = &decoder->defs[def];
+                int32_t *previous = frameType == 'S' ? decoder->slowValues : frameType == 'G' ? decoder->gpsValues : decoder->homeValues;
+
+                fieldCount = defs->count;
+                values = decoder->frameValues;
+                valid = fieldCount > 0;
+                readFieldValues(&stream, defs->encoding, fieldCount, values);
+                applyPredictors(decoder, def, defs->predictor, values, previous, previous, 0);
+            }
+            break;
+        case 'E':
+            valid = decodeEvent(&stream, &frame->event);
+            break;
+        default:
+            valid = 
+# 717 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                   0
+# 717 "./src/main/blackbox/blackbox_decoder.c"
+                        ;
+            break;
+        }
+
+
+        if (!valid || stream.overrun || (stream.pos < decoder->end && !isFrameMarker(*stream.pos) && !(frameType == 'E' && frame->event.event == FLIGHT_LOG_EVENT_LOG_END))) {
+            startResync(decoder, frameStart);
+            continue;
+        }
+
+        decoder->pos = stream.pos;
+
+        if (frameType == 'C') {
+            decoder->stats.compressedFrames++;
+            frameType = 'P';
+        }
+
+        frame->type = frameType;
+        frame->values = values;
+        frame->fieldCount = fieldCount;
+        frame->skippedFrames = skippedFrames;
+        frame->offset = frameStart - decoder->data;
+
+        switch (frameType) {
+        case 'I':
+        case 'P':
+            memcpy(decoder->mainPrevious2, frameType == 'I' ? values : decoder->mainPrevious, sizeof(int32_t) * fieldCount);
+            memcpy(decoder->mainPrevious, values, sizeof(int32_t) * fieldCount);
+            if (decoder->mainIterationIndex >= 0) {
+                decoder->lastMainIteration = values[decoder->mainIterationIndex];
+            }
+            if (decoder->mainTimeIndex >= 0) {
+                decoder->lastMainTime = values[decoder->mainTimeIndex];
+            }
+            decoder->mainStreamValid = 
+# 751 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                      1
+# 751 "./src/main/blackbox/blackbox_decoder.c"
+                                          ;
+            if (frameType == 'I') {
+                decoder->stats.intraFrames++;
+            } else {
+                decoder->stats.interFrames++;
+            }
+            break;
+        case 'S':
+            memcpy(decoder->slowValues, values, sizeof(int32_t) * fieldCount);
+            decoder->stats.slowFrames++;
+            break;
+        case 'G':
+            memcpy(decoder->gpsValues, values, sizeof(int32_t) * fieldCount);
+            decoder->stats.gpsFrames++;
+            break;
+        case 'H':
+            memcpy(decoder->homeValues, values, sizeof(int32_t) * fieldCount);
+            decoder->stats.homeFrames++;
+            break;
+        case 'E':
+            if (frame->event.event == FLIGHT_LOG_EVENT_LOG_END) {
+                decoder->logEnded = 
+# 772 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                                   1
+# 772 "./src/main/blackbox/blackbox_decoder.c"
+                                       ;
+            }
+            decoder->stats.eventFrames++;
+            break;
+        }
+
+        return 
+# 778 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              1
+# 778 "./src/main/blackbox/blackbox_decoder.c"
+                  ;
+    }
+
+    return 
+# 781 "./src/main/blackbox/blackbox_decoder.c" 3 4
+          0
+# 781 "./src/main/blackbox/blackbox_decoder.c"
+               ;
+}
+
+void blackboxDecoderInitSegment(blackboxDecoder_t *segment, const blackboxDecoder_t *decoder, size_t start, size_t end)
+{
+
+    memcpy(segment, decoder, sizeof(*segment));
+
+    segment->pos = decoder->data + start;
+    segment->end = decoder->data + end;
+
+    segment->mainStreamValid = 
+# 792 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                              0
+# 792 "./src/main/blackbox/blackbox_decoder.c"
+                                   ;
+    segment->logEnded = 
+# 793 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                       0
+# 793 "./src/main/blackbox/blackbox_decoder.c"
+                            ;
+    segment->lastMainIteration = 0;
+    segment->lastMainTime = 0;
+    memset(segment->homeValues, 0, sizeof(segment->homeValues));
+    memset(segment->slowValues, 0, sizeof(segment->slowValues));
+    memset(segment->gpsValues, 0, sizeof(segment->gpsValues));
+    memset(&segment->stats, 0, sizeof(segment->stats));
+}
+
+
+
+
+
+static 
+# 806 "./src/main/blackbox/blackbox_decoder.c" 3 4
+      _Bool 
+# 806 "./src/main/blackbox/blackbox_decoder.c"
+           isIntraframeStart(blackboxDecoder_t *scratch, const blackboxDecoder_t *decoder, size_t offset, size_t end)
+{
+    blackboxDecodedFrame_t frame;
+
+    blackboxDecoderInitSegment(scratch, decoder, offset, end);
+
+    if (!blackboxDecoderNext(scratch, &frame) || frame.type != 'I' || frame.offset != offset || scratch->stats.corruptFrames) {
+        return 
+# 813 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 813 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+    if (decoder->mainIterationIndex >= 0 && (uint32_t)frame.values[decoder->mainIterationIndex] % decoder->frameIntervalI != 0) {
+        return 
+# 817 "./src/main/blackbox/blackbox_decoder.c" 3 4
+              0
+# 817 "./src/main/blackbox/blackbox_decoder.c"
+                   ;
+    }
+
+    for (int i = 0; i < 8 && blackboxDecoderNext(scratch, &frame); i++) {
+        if (scratch->stats.corruptFrames) {
+            return 
+# 822 "./src/main/blackbox/blackbox_decoder.c" 3 4
+                  0
+# 822 "./src/main/blackbox/blackbox_decoder.c"
+                       ;
+        }
+    }
+
+    return scratch->stats.corruptFrames == 0;
+}
+
+size_t blackboxDecoderFindIntraframe(const blackboxDecoder_t *decoder, blackboxDecoder_t *scratch, size_t offset, size_t end)
+{
+    const uint8_t *limit = decoder->data + end;
+
+    for (const uint8_t *p = decoder->data + offset; p < limit; p++) {
+        p = memchr(p, 'I', limit - p);
+        if (!p) {
+            break;
+        }
+        if (isIntraframeStart(scratch, decoder, p - decoder->data, end)) {
+            return p - decoder->data;
+        }
+    }
+
+    return 0;
+}
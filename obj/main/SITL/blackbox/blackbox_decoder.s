@@ -0,0 +1,12401 @@
+	.file	"blackbox_decoder.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 7 "./src/main/blackbox/blackbox_huffman.h"
+	.file 8 "./src/main/blackbox/blackbox_decoder.h"
+	.file 9 "./src/main/blackbox/blackbox_decoder.c"
+	.file 10 "/usr/include/string.h"
+	.file 11 "/usr/include/stdlib.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_decoder.c.97096232
+	.weak	blackbox_decoder.c.97096232
+blackbox_decoder.c.97096232:
+	.long	0x13a7
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x21
+	.long	.LASF1405
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1143
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1144
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1145
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1146
+	.uleb128 0x4
+	.long	.LASF1148
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1147
+	.uleb128 0x4
+	.long	.LASF1149
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1150
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1151
+	.uleb128 0x4
+	.long	.LASF1152
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1153
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xe
+	.long	0x88
+	.uleb128 0x4
+	.long	.LASF1154
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.long	.LASF1155
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x19
+	.long	0xac
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1156
+	.uleb128 0x4
+	.long	.LASF1157
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x23
+	.byte	0x8
+	.uleb128 0xa
+	.long	0xc6
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1158
+	.uleb128 0xe
+	.long	0xc6
+	.uleb128 0x4
+	.long	.LASF1159
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1160
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4
+	.long	.LASF1161
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0xe
+	.long	0xea
+	.uleb128 0x4
+	.long	.LASF1162
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x13
+	.long	0xa0
+	.uleb128 0x4
+	.long	.LASF1163
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xe
+	.long	0x107
+	.uleb128 0x4
+	.long	.LASF1164
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1165
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0xe
+	.long	0x124
+	.uleb128 0x4
+	.long	.LASF1166
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb3
+	.uleb128 0x4
+	.long	.LASF1167
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xe
+	.long	0x141
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1168
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1169
+	.uleb128 0xa
+	.long	0xea
+	.uleb128 0xa
+	.long	0x16a
+	.uleb128 0x24
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0x1f
+	.long	0x16b
+	.uleb128 0xa
+	.long	0x107
+	.uleb128 0x4
+	.long	.LASF1170
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0x135
+	.uleb128 0x1b
+	.long	.LASF1182
+	.long	0x30
+	.byte	0x3d
+	.long	0x1d7
+	.uleb128 0x5
+	.long	.LASF1171
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1172
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1173
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1174
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1175
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1177
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF1178
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF1179
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1180
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF1181
+	.byte	0xa
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1183
+	.long	0x30
+	.byte	0x61
+	.long	0x210
+	.uleb128 0x5
+	.long	.LASF1184
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1185
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1187
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF1188
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF1189
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1190
+	.byte	0x9
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1191
+	.long	0x30
+	.byte	0x70
+	.long	0x22b
+	.uleb128 0x5
+	.long	.LASF1192
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1193
+	.byte	0x1
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1194
+	.long	0x30
+	.byte	0x78
+	.long	0x25e
+	.uleb128 0x5
+	.long	.LASF1195
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1196
+	.byte	0xd
+	.uleb128 0x5
+	.long	.LASF1197
+	.byte	0xe
+	.uleb128 0x5
+	.long	.LASF1198
+	.byte	0x1e
+	.uleb128 0x5
+	.long	.LASF1199
+	.byte	0x28
+	.uleb128 0x5
+	.long	.LASF1200
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1194
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x3
+	.long	0x22b
+	.uleb128 0x10
+	.long	.LASF1202
+	.byte	0x4
+	.byte	0x6
+	.byte	0x81
+	.long	0x284
+	.uleb128 0x3
+	.long	.LASF1204
+	.byte	0x6
+	.byte	0x82
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1201
+	.byte	0x6
+	.byte	0x83
+	.byte	0x3
+	.long	0x26a
+	.uleb128 0x10
+	.long	.LASF1203
+	.byte	0x8
+	.byte	0x6
+	.byte	0x85
+	.long	0x2b7
+	.uleb128 0x3
+	.long	.LASF1205
+	.byte	0x6
+	.byte	0x86
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1206
+	.byte	0x6
+	.byte	0x87
+	.byte	0xe
+	.long	0x124
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1207
+	.byte	0x6
+	.byte	0x88
+	.byte	0x3
+	.long	0x290
+	.uleb128 0x10
+	.long	.LASF1208
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8a
+	.long	0x304
+	.uleb128 0x3
+	.long	.LASF1209
+	.byte	0x6
+	.byte	0x8b
+	.byte	0xd
+	.long	0x107
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1210
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x9
+	.long	0x304
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1211
+	.byte	0x6
+	.byte	0x8d
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1212
+	.byte	0x6
+	.byte	0x8e
+	.byte	0xb
+	.long	0x310
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1213
+	.uleb128 0xe
+	.long	0x304
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1214
+	.uleb128 0x4
+	.long	.LASF1215
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x3
+	.long	0x2c3
+	.uleb128 0x10
+	.long	.LASF1216
+	.byte	0x10
+	.byte	0x6
+	.byte	0x91
+	.long	0x34a
+	.uleb128 0x3
+	.long	.LASF1217
+	.byte	0x6
+	.byte	0x92
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1218
+	.byte	0x6
+	.byte	0x93
+	.byte	0xe
+	.long	0x17a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x323
+	.uleb128 0x10
+	.long	.LASF1220
+	.byte	0x4
+	.byte	0x6
+	.byte	0x96
+	.long	0x370
+	.uleb128 0x3
+	.long	.LASF1221
+	.byte	0x6
+	.byte	0x97
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1222
+	.byte	0x6
+	.byte	0x98
+	.byte	0x3
+	.long	0x356
+	.uleb128 0x25
+	.long	.LASF1406
+	.byte	0x10
+	.byte	0x6
+	.byte	0x9c
+	.byte	0xf
+	.long	0x3c1
+	.uleb128 0x16
+	.long	.LASF1223
+	.byte	0x9d
+	.byte	0x1f
+	.long	0x284
+	.uleb128 0x16
+	.long	.LASF1224
+	.byte	0x9e
+	.byte	0x21
+	.long	0x2b7
+	.uleb128 0x16
+	.long	.LASF1225
+	.byte	0x9f
+	.byte	0x29
+	.long	0x317
+	.uleb128 0x16
+	.long	.LASF1226
+	.byte	0xa0
+	.byte	0x24
+	.long	0x34a
+	.uleb128 0x16
+	.long	.LASF1227
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x370
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1228
+	.byte	0x6
+	.byte	0xa2
+	.byte	0x3
+	.long	0x37c
+	.uleb128 0x10
+	.long	.LASF1229
+	.byte	0x18
+	.byte	0x6
+	.byte	0xa4
+	.long	0x3f4
+	.uleb128 0x3
+	.long	.LASF1230
+	.byte	0x6
+	.byte	0xa5
+	.byte	0x14
+	.long	0x25e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1231
+	.byte	0x6
+	.byte	0xa6
+	.byte	0x1a
+	.long	0x3c1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1232
+	.byte	0x6
+	.byte	0xa7
+	.byte	0x3
+	.long	0x3cd
+	.uleb128 0x1d
+	.long	.LASF1233
+	.value	0x166
+	.byte	0x7
+	.byte	0x2a
+	.long	0x442
+	.uleb128 0x3
+	.long	.LASF1234
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.long	0x442
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1235
+	.byte	0x7
+	.byte	0x2c
+	.byte	0xe
+	.long	0x442
+	.byte	0x22
+	.uleb128 0x3
+	.long	.LASF1236
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0x442
+	.byte	0x44
+	.uleb128 0x3
+	.long	.LASF1237
+	.byte	0x7
+	.byte	0x2e
+	.byte	0xd
+	.long	0x452
+	.byte	0x66
+	.byte	0
+	.uleb128 0x11
+	.long	0x118
+	.long	0x452
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0x107
+	.long	0x462
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1238
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3
+	.long	0x400
+	.uleb128 0xe
+	.long	0x462
+	.uleb128 0x26
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x8
+	.byte	0x31
+	.byte	0xe
+	.long	0x4a0
+	.uleb128 0x5
+	.long	.LASF1239
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1240
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1241
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1242
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1243
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1244
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x473
+	.uleb128 0xe
+	.long	0x4a0
+	.uleb128 0x1d
+	.long	.LASF1245
+	.value	0x688
+	.byte	0x8
+	.byte	0x39
+	.long	0x51a
+	.uleb128 0x3
+	.long	.LASF1236
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1246
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x11
+	.long	0x51a
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1247
+	.byte	0x3c
+	.byte	0xd
+	.long	0x52a
+	.value	0x408
+	.uleb128 0x6
+	.long	.LASF1248
+	.byte	0x3d
+	.byte	0xd
+	.long	0x52a
+	.value	0x488
+	.uleb128 0x6
+	.long	.LASF1249
+	.byte	0x3e
+	.byte	0xd
+	.long	0x52a
+	.value	0x508
+	.uleb128 0x6
+	.long	.LASF1250
+	.byte	0x3f
+	.byte	0xd
+	.long	0x52a
+	.value	0x588
+	.uleb128 0x6
+	.long	.LASF1251
+	.byte	0x40
+	.byte	0xd
+	.long	0x52a
+	.value	0x608
+	.byte	0
+	.uleb128 0x11
+	.long	0x16b
+	.long	0x52a
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x11
+	.long	0x107
+	.long	0x53a
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1252
+	.byte	0x8
+	.byte	0x41
+	.byte	0x3
+	.long	0x4b1
+	.uleb128 0xe
+	.long	0x53a
+	.uleb128 0x10
+	.long	.LASF1253
+	.byte	0x10
+	.byte	0x8
+	.byte	0x43
+	.long	0x572
+	.uleb128 0x3
+	.long	.LASF1246
+	.byte	0x8
+	.byte	0x44
+	.byte	0x11
+	.long	0x16b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1254
+	.byte	0x8
+	.byte	0x45
+	.byte	0x11
+	.long	0x16b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1255
+	.byte	0x8
+	.byte	0x46
+	.byte	0x3
+	.long	0x54b
+	.uleb128 0x10
+	.long	.LASF1256
+	.byte	0x38
+	.byte	0x8
+	.byte	0x48
+	.long	0x5d9
+	.uleb128 0x3
+	.long	.LASF1257
+	.byte	0x8
+	.byte	0x49
+	.byte	0xa
+	.long	0xc6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1258
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x9
+	.long	0x88
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1259
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x14
+	.long	0x5d9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1260
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xe
+	.long	0x124
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1230
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x16
+	.long	0x3f4
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1261
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xc
+	.long	0x141
+	.byte	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	0xf6
+	.uleb128 0x4
+	.long	.LASF1262
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x3
+	.long	0x57e
+	.uleb128 0x10
+	.long	.LASF1263
+	.byte	0x24
+	.byte	0x8
+	.byte	0x51
+	.long	0x66c
+	.uleb128 0x3
+	.long	.LASF1264
+	.byte	0x8
+	.byte	0x52
+	.byte	0xe
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1265
+	.byte	0x8
+	.byte	0x53
+	.byte	0xe
+	.long	0x124
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1266
+	.byte	0x8
+	.byte	0x54
+	.byte	0xe
+	.long	0x124
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1267
+	.byte	0x8
+	.byte	0x55
+	.byte	0xe
+	.long	0x124
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1268
+	.byte	0x8
+	.byte	0x56
+	.byte	0xe
+	.long	0x124
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1269
+	.byte	0x8
+	.byte	0x57
+	.byte	0xe
+	.long	0x124
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1270
+	.byte	0x8
+	.byte	0x58
+	.byte	0xe
+	.long	0x124
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1271
+	.byte	0x8
+	.byte	0x59
+	.byte	0xe
+	.long	0x124
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1272
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xe
+	.long	0x124
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1273
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x3
+	.long	0x5ea
+	.uleb128 0x1d
+	.long	.LASF1274
+	.value	0x6300
+	.byte	0x8
+	.byte	0x5d
+	.long	0x80a
+	.uleb128 0x3
+	.long	.LASF1231
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x14
+	.long	0x80a
+	.byte	0
+	.uleb128 0x1c
+	.string	"end"
+	.byte	0x8
+	.byte	0x5f
+	.long	0x80a
+	.byte	0x8
+	.uleb128 0x1c
+	.string	"pos"
+	.byte	0x8
+	.byte	0x60
+	.long	0x80a
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1275
+	.byte	0x8
+	.byte	0x62
+	.byte	0x9
+	.long	0x88
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1276
+	.byte	0x8
+	.byte	0x63
+	.byte	0x1d
+	.long	0x80f
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF1277
+	.byte	0x64
+	.byte	0xa
+	.long	0x81f
+	.value	0xa20
+	.uleb128 0x6
+	.long	.LASF1278
+	.byte	0x65
+	.byte	0xc
+	.long	0x141
+	.value	0x3a20
+	.uleb128 0x6
+	.long	.LASF1279
+	.byte	0x67
+	.byte	0x20
+	.long	0x830
+	.value	0x3a28
+	.uleb128 0x6
+	.long	.LASF1280
+	.byte	0x69
+	.byte	0xe
+	.long	0x124
+	.value	0x5448
+	.uleb128 0x6
+	.long	.LASF1281
+	.byte	0x6a
+	.byte	0xe
+	.long	0x124
+	.value	0x544c
+	.uleb128 0x6
+	.long	.LASF1282
+	.byte	0x6b
+	.byte	0xe
+	.long	0x124
+	.value	0x5450
+	.uleb128 0x6
+	.long	.LASF1283
+	.byte	0x6c
+	.byte	0xd
+	.long	0xea
+	.value	0x5454
+	.uleb128 0x6
+	.long	.LASF1284
+	.byte	0x6d
+	.byte	0xd
+	.long	0xea
+	.value	0x5458
+	.uleb128 0x6
+	.long	.LASF1285
+	.byte	0x6e
+	.byte	0xd
+	.long	0x107
+	.value	0x545c
+	.uleb128 0x6
+	.long	.LASF1286
+	.byte	0x70
+	.byte	0x1e
+	.long	0x462
+	.value	0x545e
+	.uleb128 0x6
+	.long	.LASF1287
+	.byte	0x71
+	.byte	0xd
+	.long	0x452
+	.value	0x55c4
+	.uleb128 0x6
+	.long	.LASF1288
+	.byte	0x73
+	.byte	0x9
+	.long	0x88
+	.value	0x56c4
+	.uleb128 0x6
+	.long	.LASF1289
+	.byte	0x74
+	.byte	0x9
+	.long	0x88
+	.value	0x56c8
+	.uleb128 0x6
+	.long	.LASF1290
+	.byte	0x75
+	.byte	0x9
+	.long	0x88
+	.value	0x56cc
+	.uleb128 0x6
+	.long	.LASF1291
+	.byte	0x77
+	.byte	0x9
+	.long	0x304
+	.value	0x56d0
+	.uleb128 0x6
+	.long	.LASF1292
+	.byte	0x78
+	.byte	0x9
+	.long	0x304
+	.value	0x56d1
+	.uleb128 0x6
+	.long	.LASF1293
+	.byte	0x79
+	.byte	0xe
+	.long	0x124
+	.value	0x56d4
+	.uleb128 0x6
+	.long	.LASF1294
+	.byte	0x7a
+	.byte	0xd
+	.long	0xea
+	.value	0x56d8
+	.uleb128 0x6
+	.long	.LASF1295
+	.byte	0x7b
+	.byte	0xd
+	.long	0x840
+	.value	0x56dc
+	.uleb128 0x6
+	.long	.LASF1296
+	.byte	0x7c
+	.byte	0xd
+	.long	0x840
+	.value	0x58dc
+	.uleb128 0x6
+	.long	.LASF1297
+	.byte	0x7d
+	.byte	0xd
+	.long	0x840
+	.value	0x5adc
+	.uleb128 0x6
+	.long	.LASF1298
+	.byte	0x7e
+	.byte	0xd
+	.long	0x840
+	.value	0x5cdc
+	.uleb128 0x6
+	.long	.LASF1299
+	.byte	0x7f
+	.byte	0xd
+	.long	0x840
+	.value	0x5edc
+	.uleb128 0x6
+	.long	.LASF1300
+	.byte	0x80
+	.byte	0xd
+	.long	0x840
+	.value	0x60dc
+	.uleb128 0x6
+	.long	.LASF1301
+	.byte	0x82
+	.byte	0x1c
+	.long	0x66c
+	.value	0x62dc
+	.byte	0
+	.uleb128 0xa
+	.long	0x113
+	.uleb128 0x11
+	.long	0x572
+	.long	0x81f
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x9f
+	.byte	0
+	.uleb128 0x11
+	.long	0xc6
+	.long	0x830
+	.uleb128 0x27
+	.long	0x37
+	.value	0x2fff
+	.byte	0
+	.uleb128 0x11
+	.long	0x53a
+	.long	0x840
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x11
+	.long	0xea
+	.long	0x850
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1302
+	.byte	0x8
+	.byte	0x83
+	.byte	0x3
+	.long	0x678
+	.uleb128 0xe
+	.long	0x850
+	.uleb128 0x10
+	.long	.LASF1303
+	.byte	0x18
+	.byte	0x9
+	.byte	0x24
+	.long	0x893
+	.uleb128 0x1c
+	.string	"pos"
+	.byte	0x9
+	.byte	0x25
+	.long	0x80a
+	.byte	0
+	.uleb128 0x1c
+	.string	"end"
+	.byte	0x9
+	.byte	0x26
+	.long	0x80a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1304
+	.byte	0x9
+	.byte	0x27
+	.byte	0x9
+	.long	0x304
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1305
+	.byte	0x9
+	.byte	0x28
+	.byte	0x3
+	.long	0x861
+	.uleb128 0x12
+	.long	.LASF1306
+	.byte	0x7
+	.byte	0x38
+	.byte	0x5
+	.long	0x88
+	.long	0x8c9
+	.uleb128 0x7
+	.long	0x8c9
+	.uleb128 0x7
+	.long	0x175
+	.uleb128 0x7
+	.long	0x88
+	.uleb128 0x7
+	.long	0x80a
+	.uleb128 0x7
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.long	0x46e
+	.uleb128 0x12
+	.long	.LASF1307
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xe
+	.long	0xbf
+	.long	0x8ee
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x7
+	.long	0x165
+	.uleb128 0x7
+	.long	0x141
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1308
+	.byte	0xa
+	.value	0x197
+	.byte	0xf
+	.long	0x141
+	.long	0x905
+	.uleb128 0x7
+	.long	0x16b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1309
+	.byte	0xa
+	.byte	0x9f
+	.byte	0xc
+	.long	0x88
+	.long	0x925
+	.uleb128 0x7
+	.long	0x16b
+	.uleb128 0x7
+	.long	0x16b
+	.uleb128 0x7
+	.long	0x141
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1316
+	.byte	0x7
+	.byte	0x36
+	.byte	0x6
+	.long	0x937
+	.uleb128 0x7
+	.long	0x937
+	.byte	0
+	.uleb128 0xa
+	.long	0x462
+	.uleb128 0x12
+	.long	.LASF1310
+	.byte	0xa
+	.byte	0xf6
+	.byte	0xe
+	.long	0xc1
+	.long	0x957
+	.uleb128 0x7
+	.long	0x16b
+	.uleb128 0x7
+	.long	0x88
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1311
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xe
+	.long	0xbf
+	.long	0x977
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x7
+	.long	0x88
+	.uleb128 0x7
+	.long	0x141
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1312
+	.byte	0xb
+	.byte	0xb1
+	.byte	0x11
+	.long	0xac
+	.long	0x997
+	.uleb128 0x7
+	.long	0x170
+	.uleb128 0x7
+	.long	0x99c
+	.uleb128 0x7
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.long	0xc1
+	.uleb128 0x1f
+	.long	0x997
+	.uleb128 0x12
+	.long	.LASF1313
+	.byte	0xa
+	.byte	0x9c
+	.byte	0xc
+	.long	0x88
+	.long	0x9bc
+	.uleb128 0x7
+	.long	0x16b
+	.uleb128 0x7
+	.long	0x16b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1314
+	.byte	0xa
+	.byte	0x40
+	.byte	0xc
+	.long	0x88
+	.long	0x9dc
+	.uleb128 0x7
+	.long	0x165
+	.uleb128 0x7
+	.long	0x165
+	.uleb128 0x7
+	.long	0x141
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1315
+	.byte	0xa
+	.byte	0x6b
+	.byte	0xe
+	.long	0xbf
+	.long	0x9fc
+	.uleb128 0x7
+	.long	0x165
+	.uleb128 0x7
+	.long	0x88
+	.uleb128 0x7
+	.long	0x141
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1317
+	.value	0x33d
+	.byte	0x8
+	.long	0x141
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x33d
+	.byte	0x3f
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1319
+	.byte	0x9
+	.value	0x33d
+	.byte	0x5b
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1261
+	.byte	0x9
+	.value	0x33d
+	.byte	0x6b
+	.long	0x141
+	.uleb128 0x17
+	.string	"end"
+	.value	0x33d
+	.byte	0x7a
+	.long	0x141
+	.uleb128 0x2
+	.long	.LASF1320
+	.value	0x33f
+	.byte	0x14
+	.long	0x80a
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"p"
+	.value	0x341
+	.byte	0x19
+	.long	0x80a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x85c
+	.uleb128 0xa
+	.long	0x850
+	.uleb128 0x18
+	.long	.LASF1332
+	.value	0x326
+	.byte	0xc
+	.long	0x304
+	.long	0xabe
+	.uleb128 0x1
+	.long	.LASF1319
+	.byte	0x9
+	.value	0x326
+	.byte	0x31
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x326
+	.byte	0x53
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1261
+	.byte	0x9
+	.value	0x326
+	.byte	0x63
+	.long	0x141
+	.uleb128 0x17
+	.string	"end"
+	.value	0x326
+	.byte	0x72
+	.long	0x141
+	.uleb128 0x2
+	.long	.LASF1321
+	.value	0x328
+	.byte	0x1c
+	.long	0x5de
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x334
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1402
+	.byte	0x9
+	.value	0x310
+	.byte	0x6
+	.long	0xaff
+	.uleb128 0x1
+	.long	.LASF1322
+	.byte	0x9
+	.value	0x310
+	.byte	0x34
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x310
+	.byte	0x56
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0x9
+	.value	0x310
+	.byte	0x66
+	.long	0x141
+	.uleb128 0x17
+	.string	"end"
+	.value	0x310
+	.byte	0x74
+	.long	0x141
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1324
+	.value	0x287
+	.byte	0x5
+	.long	0x304
+	.long	0xbc4
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x287
+	.byte	0x2c
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0x9
+	.value	0x287
+	.byte	0x4d
+	.long	0xbc4
+	.uleb128 0x2
+	.long	.LASF1325
+	.value	0x289
+	.byte	0x21
+	.long	0xbc9
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1326
+	.value	0x28c
+	.byte	0x18
+	.long	0x80a
+	.uleb128 0x2
+	.long	.LASF1327
+	.value	0x28d
+	.byte	0xe
+	.long	0xc6
+	.uleb128 0x2
+	.long	.LASF1328
+	.value	0x296
+	.byte	0x19
+	.long	0x893
+	.uleb128 0x2
+	.long	.LASF1260
+	.value	0x297
+	.byte	0x12
+	.long	0x124
+	.uleb128 0x2
+	.long	.LASF1259
+	.value	0x298
+	.byte	0x12
+	.long	0x160
+	.uleb128 0x2
+	.long	.LASF1258
+	.value	0x299
+	.byte	0xd
+	.long	0x88
+	.uleb128 0x2
+	.long	.LASF1329
+	.value	0x29a
+	.byte	0xd
+	.long	0x304
+	.uleb128 0x19
+	.long	0xb9c
+	.uleb128 0x2
+	.long	.LASF1330
+	.value	0x2af
+	.byte	0x21
+	.long	0x893
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"def"
+	.value	0x2be
+	.byte	0x2c
+	.long	0x4ac
+	.uleb128 0x2
+	.long	.LASF1279
+	.value	0x2bf
+	.byte	0x33
+	.long	0xbce
+	.uleb128 0x2
+	.long	.LASF1331
+	.value	0x2c0
+	.byte	0x1a
+	.long	0x160
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x5de
+	.uleb128 0xa
+	.long	0x53a
+	.uleb128 0xa
+	.long	0x546
+	.uleb128 0x1a
+	.long	.LASF1341
+	.value	0x280
+	.long	0xbf9
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x280
+	.byte	0x2c
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1326
+	.byte	0x9
+	.value	0x280
+	.byte	0x44
+	.long	0x80a
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1333
+	.value	0x26b
+	.byte	0x18
+	.long	0x893
+	.long	0xc48
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x26b
+	.byte	0x3b
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1328
+	.byte	0x9
+	.value	0x26b
+	.byte	0x55
+	.long	0xc48
+	.uleb128 0x2
+	.long	.LASF1330
+	.value	0x26d
+	.byte	0x15
+	.long	0x893
+	.uleb128 0x2
+	.long	.LASF1334
+	.value	0x26f
+	.byte	0x14
+	.long	0x130
+	.uleb128 0x2
+	.long	.LASF1335
+	.value	0x274
+	.byte	0xf
+	.long	0x8f
+	.byte	0
+	.uleb128 0xa
+	.long	0x893
+	.uleb128 0x18
+	.long	.LASF1336
+	.value	0x232
+	.byte	0xc
+	.long	0x304
+	.long	0xcbe
+	.uleb128 0x1
+	.long	.LASF1328
+	.byte	0x9
+	.value	0x232
+	.byte	0x29
+	.long	0xc48
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x9
+	.value	0x232
+	.byte	0x43
+	.long	0xcbe
+	.uleb128 0x19
+	.long	0xca3
+	.uleb128 0x2
+	.long	.LASF1337
+	.value	0x240
+	.byte	0x1b
+	.long	0x113
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1338
+	.value	0x244
+	.byte	0x1a
+	.long	0x124
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x245
+	.byte	0x1a
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1339
+	.value	0x258
+	.byte	0x1a
+	.long	0x14d
+	.uleb128 0x2
+	.long	.LASF1340
+	.value	0x259
+	.byte	0x1c
+	.long	0x80a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x3f4
+	.uleb128 0x1a
+	.long	.LASF1342
+	.value	0x1f7
+	.long	0xd5b
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x1f7
+	.byte	0x30
+	.long	0xa5d
+	.uleb128 0x17
+	.string	"def"
+	.value	0x1f7
+	.byte	0x4e
+	.long	0x4a0
+	.uleb128 0x1
+	.long	.LASF1248
+	.byte	0x9
+	.value	0x1f7
+	.byte	0x62
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x9
+	.value	0x1f8
+	.byte	0x12
+	.long	0x160
+	.uleb128 0x1
+	.long	.LASF1331
+	.byte	0x9
+	.value	0x1f8
+	.byte	0x29
+	.long	0x5d9
+	.uleb128 0x1
+	.long	.LASF1343
+	.byte	0x9
+	.value	0x1f8
+	.byte	0x42
+	.long	0x5d9
+	.uleb128 0x1
+	.long	.LASF1260
+	.byte	0x9
+	.value	0x1f8
+	.byte	0x56
+	.long	0x124
+	.uleb128 0x2
+	.long	.LASF1279
+	.value	0x1fa
+	.byte	0x27
+	.long	0xbce
+	.uleb128 0x2
+	.long	.LASF1344
+	.value	0x1fb
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x1fd
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1345
+	.value	0x1fe
+	.byte	0x12
+	.long	0x124
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1346
+	.value	0x1c4
+	.long	0xded
+	.uleb128 0x1
+	.long	.LASF1328
+	.byte	0x9
+	.value	0x1c4
+	.byte	0x2e
+	.long	0xc48
+	.uleb128 0x1
+	.long	.LASF1249
+	.byte	0x9
+	.value	0x1c4
+	.byte	0x45
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0x9
+	.value	0x1c4
+	.byte	0x53
+	.long	0x88
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x9
+	.value	0x1c4
+	.byte	0x68
+	.long	0x160
+	.uleb128 0x2
+	.long	.LASF1347
+	.value	0x1c6
+	.byte	0xd
+	.long	0xded
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x1c8
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1348
+	.value	0x1c9
+	.byte	0xd
+	.long	0x88
+	.uleb128 0x19
+	.long	0xdce
+	.uleb128 0xd
+	.string	"j"
+	.value	0x1da
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.uleb128 0x19
+	.long	0xdde
+	.uleb128 0xd
+	.string	"j"
+	.value	0x1e0
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"j"
+	.value	0x1eb
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xea
+	.long	0xdfd
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1349
+	.value	0x1b9
+	.byte	0x11
+	.long	0x124
+	.long	0xe35
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x1b9
+	.byte	0x3d
+	.long	0xa58
+	.uleb128 0x2
+	.long	.LASF1236
+	.value	0x1bb
+	.byte	0xe
+	.long	0x124
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1350
+	.value	0x1bd
+	.byte	0x13
+	.long	0x124
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1351
+	.value	0x1b3
+	.byte	0xc
+	.long	0x304
+	.long	0xe6c
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x1b3
+	.byte	0x39
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0x9
+	.value	0x1b3
+	.byte	0x4b
+	.long	0x124
+	.uleb128 0x2
+	.long	.LASF1352
+	.value	0x1b5
+	.byte	0x14
+	.long	0x130
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1353
+	.value	0x16b
+	.byte	0x5
+	.long	0x304
+	.long	0xefe
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x16b
+	.byte	0x2c
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x9
+	.value	0x16b
+	.byte	0x44
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF1354
+	.byte	0x9
+	.value	0x16b
+	.byte	0x51
+	.long	0x141
+	.uleb128 0x2
+	.long	.LASF1323
+	.value	0x172
+	.byte	0x14
+	.long	0x80a
+	.uleb128 0x2
+	.long	.LASF1355
+	.value	0x178
+	.byte	0x14
+	.long	0x80a
+	.uleb128 0xd
+	.string	"p"
+	.value	0x17d
+	.byte	0x14
+	.long	0x80a
+	.uleb128 0x2
+	.long	.LASF1325
+	.value	0x188
+	.byte	0x27
+	.long	0xbce
+	.uleb128 0x2
+	.long	.LASF1356
+	.value	0x194
+	.byte	0x11
+	.long	0x16b
+	.uleb128 0x19
+	.long	0xeef
+	.uleb128 0x2
+	.long	.LASF1357
+	.value	0x17f
+	.byte	0x18
+	.long	0x80a
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1358
+	.value	0x196
+	.byte	0x15
+	.long	0x16b
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1359
+	.value	0x15f
+	.byte	0x5
+	.long	0x88
+	.long	0xf4d
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x15f
+	.byte	0x38
+	.long	0xa58
+	.uleb128 0x17
+	.string	"def"
+	.value	0x15f
+	.byte	0x56
+	.long	0x4a0
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0x9
+	.value	0x15f
+	.byte	0x67
+	.long	0x16b
+	.uleb128 0x2
+	.long	.LASF1279
+	.value	0x161
+	.byte	0x27
+	.long	0xbce
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x163
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1360
+	.value	0x159
+	.byte	0x9
+	.long	0xea
+	.long	0xf91
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x159
+	.byte	0x3e
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0x9
+	.value	0x159
+	.byte	0x53
+	.long	0x16b
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0x9
+	.value	0x159
+	.byte	0x61
+	.long	0xea
+	.uleb128 0x2
+	.long	.LASF1254
+	.value	0x15b
+	.byte	0x11
+	.long	0x16b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1362
+	.value	0x14f
+	.byte	0xd
+	.long	0x16b
+	.long	0xfc8
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x14f
+	.byte	0x3f
+	.long	0xa58
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0x9
+	.value	0x14f
+	.byte	0x54
+	.long	0x16b
+	.uleb128 0x8
+	.uleb128 0xd
+	.string	"i"
+	.value	0x151
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1363
+	.value	0x136
+	.long	0x1013
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x136
+	.byte	0x30
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x9
+	.value	0x136
+	.byte	0x45
+	.long	0x16b
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x9
+	.value	0x136
+	.byte	0x52
+	.long	0x141
+	.uleb128 0x2
+	.long	.LASF1366
+	.value	0x138
+	.byte	0xb
+	.long	0xc1
+	.uleb128 0x2
+	.long	.LASF1254
+	.value	0x13d
+	.byte	0xb
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1367
+	.value	0x106
+	.long	0x10ab
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x9
+	.value	0x106
+	.byte	0x35
+	.long	0xa5d
+	.uleb128 0x1
+	.long	.LASF1368
+	.byte	0x9
+	.value	0x106
+	.byte	0x43
+	.long	0xc6
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x9
+	.value	0x106
+	.byte	0x5a
+	.long	0x16b
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x9
+	.value	0x106
+	.byte	0x6a
+	.long	0xc1
+	.uleb128 0x2
+	.long	.LASF1370
+	.value	0x108
+	.byte	0xf
+	.long	0x8f
+	.uleb128 0x2
+	.long	.LASF1279
+	.value	0x10d
+	.byte	0x21
+	.long	0xbc9
+	.uleb128 0x2
+	.long	.LASF1371
+	.value	0x10e
+	.byte	0xf
+	.long	0x30b
+	.uleb128 0x2
+	.long	.LASF1372
+	.value	0x10f
+	.byte	0xe
+	.long	0x175
+	.uleb128 0x2
+	.long	.LASF1236
+	.value	0x123
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1254
+	.value	0x124
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x8
+	.uleb128 0x2
+	.long	.LASF1373
+	.value	0x125
+	.byte	0xf
+	.long	0xc1
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1374
+	.byte	0xf2
+	.byte	0xc
+	.long	0x88
+	.long	0x10c6
+	.uleb128 0x9
+	.long	.LASF1368
+	.byte	0xf2
+	.byte	0x20
+	.long	0xc6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1375
+	.byte	0xe4
+	.byte	0xe
+	.long	0xc1
+	.long	0x1102
+	.uleb128 0x9
+	.long	.LASF1318
+	.byte	0xe4
+	.byte	0x31
+	.long	0xa5d
+	.uleb128 0x9
+	.long	.LASF1366
+	.byte	0xe4
+	.byte	0x46
+	.long	0x16b
+	.uleb128 0x9
+	.long	.LASF1365
+	.byte	0xe4
+	.byte	0x53
+	.long	0x141
+	.uleb128 0xb
+	.long	.LASF1376
+	.byte	0xea
+	.byte	0xb
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1377
+	.byte	0x9
+	.byte	0xd8
+	.byte	0x5
+	.long	0x88
+	.long	0x1160
+	.uleb128 0x9
+	.long	.LASF1231
+	.byte	0xd8
+	.byte	0x2c
+	.long	0x80a
+	.uleb128 0x9
+	.long	.LASF1354
+	.byte	0xd8
+	.byte	0x39
+	.long	0x141
+	.uleb128 0x9
+	.long	.LASF1378
+	.byte	0xd8
+	.byte	0x47
+	.long	0x1160
+	.uleb128 0x9
+	.long	.LASF1379
+	.byte	0xd8
+	.byte	0x57
+	.long	0x88
+	.uleb128 0xf
+	.string	"end"
+	.byte	0xda
+	.byte	0x14
+	.long	0x80a
+	.uleb128 0xb
+	.long	.LASF1380
+	.byte	0xdb
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"p"
+	.byte	0xdd
+	.byte	0x19
+	.long	0x80a
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x141
+	.uleb128 0x13
+	.long	.LASF1381
+	.byte	0xc7
+	.byte	0x17
+	.long	0x80a
+	.long	0x11a1
+	.uleb128 0x9
+	.long	.LASF1231
+	.byte	0xc7
+	.byte	0x33
+	.long	0x80a
+	.uleb128 0x20
+	.string	"end"
+	.byte	0xc7
+	.byte	0x48
+	.long	0x80a
+	.uleb128 0xb
+	.long	.LASF1382
+	.byte	0xc9
+	.byte	0x12
+	.long	0x14d
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"p"
+	.byte	0xcb
+	.byte	0x19
+	.long	0x80a
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1383
+	.byte	0xc2
+	.byte	0xc
+	.long	0x304
+	.long	0x11ba
+	.uleb128 0x20
+	.string	"c"
+	.byte	0xc2
+	.byte	0x22
+	.long	0x107
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1384
+	.byte	0xb5
+	.long	0x11fc
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0xb5
+	.byte	0x32
+	.long	0xc48
+	.uleb128 0x9
+	.long	.LASF1259
+	.byte	0xb5
+	.byte	0x43
+	.long	0x160
+	.uleb128 0x9
+	.long	.LASF1385
+	.byte	0xb5
+	.byte	0x4f
+	.long	0x88
+	.uleb128 0xb
+	.long	.LASF1386
+	.byte	0xbc
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"i"
+	.byte	0xbd
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1387
+	.byte	0x82
+	.long	0x125f
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0x82
+	.byte	0x32
+	.long	0xc48
+	.uleb128 0x9
+	.long	.LASF1259
+	.byte	0x82
+	.byte	0x43
+	.long	0x160
+	.uleb128 0xb
+	.long	.LASF1388
+	.byte	0x84
+	.byte	0xd
+	.long	0x107
+	.uleb128 0xb
+	.long	.LASF1389
+	.byte	0x85
+	.byte	0x9
+	.long	0x304
+	.uleb128 0xb
+	.long	.LASF1390
+	.byte	0x86
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"x"
+	.byte	0x88
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"b1"
+	.byte	0x89
+	.byte	0x11
+	.long	0x107
+	.uleb128 0xf
+	.string	"b2"
+	.byte	0x89
+	.byte	0x15
+	.long	0x107
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1391
+	.byte	0x59
+	.long	0x12cf
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0x59
+	.byte	0x32
+	.long	0xc48
+	.uleb128 0x9
+	.long	.LASF1259
+	.byte	0x59
+	.byte	0x43
+	.long	0x160
+	.uleb128 0xb
+	.long	.LASF1392
+	.byte	0x5b
+	.byte	0x13
+	.long	0x113
+	.uleb128 0xf
+	.string	"b"
+	.byte	0x5c
+	.byte	0xd
+	.long	0x107
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF1388
+	.byte	0x71
+	.byte	0x15
+	.long	0x107
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"x"
+	.byte	0x72
+	.byte	0x16
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF1393
+	.byte	0x73
+	.byte	0x1b
+	.long	0x8f
+	.uleb128 0xb
+	.long	.LASF1254
+	.byte	0x74
+	.byte	0x1a
+	.long	0x124
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"i"
+	.byte	0x75
+	.byte	0x1a
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1394
+	.byte	0x4f
+	.byte	0x10
+	.long	0xea
+	.long	0x1300
+	.uleb128 0x9
+	.long	.LASF1254
+	.byte	0x4f
+	.byte	0x24
+	.long	0x124
+	.uleb128 0x9
+	.long	.LASF1338
+	.byte	0x4f
+	.byte	0x2f
+	.long	0x88
+	.uleb128 0xb
+	.long	.LASF1395
+	.byte	0x51
+	.byte	0x14
+	.long	0x130
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1396
+	.byte	0x4a
+	.byte	0x10
+	.long	0xea
+	.long	0x131b
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0x4a
+	.byte	0x34
+	.long	0xc48
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1397
+	.byte	0x45
+	.byte	0x10
+	.long	0xea
+	.long	0x1336
+	.uleb128 0x9
+	.long	.LASF1254
+	.byte	0x45
+	.byte	0x26
+	.long	0x124
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1398
+	.byte	0x33
+	.byte	0x11
+	.long	0x124
+	.long	0x1374
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0x33
+	.byte	0x37
+	.long	0xc48
+	.uleb128 0xb
+	.long	.LASF1399
+	.byte	0x35
+	.byte	0xe
+	.long	0x124
+	.uleb128 0x8
+	.uleb128 0xb
+	.long	.LASF1400
+	.byte	0x38
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"c"
+	.byte	0x39
+	.byte	0x17
+	.long	0x113
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1401
+	.byte	0x2a
+	.byte	0x10
+	.long	0x107
+	.long	0x138f
+	.uleb128 0x9
+	.long	.LASF1328
+	.byte	0x2a
+	.byte	0x30
+	.long	0xc48
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1403
+	.byte	0xb
+	.value	0x16a
+	.byte	0x2a
+	.long	0x88
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0xb
+	.value	0x16a
+	.byte	0x3c
+	.long	0x16b
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF740
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF776
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF819
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.file 37 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF823
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF853
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF879
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF881
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF905
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF907
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.file 60 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3c
+	.file 61 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 62 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 63 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.file 66 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1142
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF860
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF878
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1017
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1098
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1121
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1131
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_decoder.h.43.b132717c788ee074fd5e7849cca3a894,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1139
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1407
+	.long	.LASF1408
+	.long	.LASF1409
+	.long	.LASF1410
+	.long	.LASF1411
+	.long	.LASF1412
+	.long	.LASF1413
+	.long	.LASF1414
+	.long	.LASF1415
+	.long	.LASF1416
+	.long	.LASF1417
+	.long	.LASF1418
+	.long	.LASF1419
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x43
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1420
+	.byte	0x9
+	.long	.LASF1421
+	.byte	0x9
+	.long	.LASF1422
+	.byte	0x9
+	.long	.LASF1423
+	.byte	0xd
+	.long	.LASF1424
+	.byte	0x3
+	.long	.LASF1425
+	.byte	0x1
+	.long	.LASF1426
+	.byte	0x1
+	.long	.LASF1427
+	.byte	0x1
+	.long	.LASF1428
+	.byte	0x1
+	.long	.LASF1429
+	.byte	0xc
+	.long	.LASF1430
+	.byte	0xc
+	.long	.LASF1431
+	.byte	0xc
+	.long	.LASF1432
+	.byte	0xd
+	.long	.LASF1433
+	.byte	0xd
+	.long	.LASF1433
+	.byte	0xc
+	.long	.LASF1434
+	.byte	0x9
+	.long	.LASF1435
+	.byte	0xc
+	.long	.LASF1436
+	.byte	0xc
+	.long	.LASF1437
+	.byte	0x9
+	.long	.LASF1438
+	.byte	0x9
+	.long	.LASF1439
+	.byte	0xb
+	.long	.LASF1440
+	.byte	0x9
+	.long	.LASF1441
+	.byte	0xa
+	.long	.LASF1442
+	.byte	0xa
+	.long	.LASF1443
+	.byte	0x9
+	.long	.LASF1444
+	.byte	0x9
+	.long	.LASF1445
+	.byte	0x9
+	.long	.LASF1446
+	.byte	0x9
+	.long	.LASF1447
+	.byte	0x9
+	.long	.LASF1448
+	.byte	0x9
+	.long	.LASF1449
+	.byte	0x9
+	.long	.LASF1420
+	.byte	0xb
+	.long	.LASF1450
+	.byte	0x8
+	.long	.LASF1451
+	.byte	0x8
+	.long	.LASF1452
+	.byte	0x8
+	.long	.LASF1453
+	.byte	0x8
+	.long	.LASF1454
+	.byte	0xc
+	.long	.LASF1454
+	.byte	0x9
+	.long	.LASF1455
+	.byte	0x9
+	.long	.LASF1456
+	.byte	0x9
+	.long	.LASF1457
+	.byte	0x9
+	.long	.LASF1458
+	.byte	0xb
+	.long	.LASF1458
+	.byte	0x9
+	.long	.LASF1459
+	.byte	0x8
+	.long	.LASF1460
+	.byte	0x8
+	.long	.LASF1461
+	.byte	0x8
+	.long	.LASF1462
+	.byte	0x8
+	.long	.LASF1463
+	.byte	0x9
+	.long	.LASF1464
+	.byte	0x9
+	.long	.LASF1465
+	.byte	0x9
+	.long	.LASF1466
+	.byte	0x9
+	.long	.LASF1467
+	.byte	0x9
+	.long	.LASF1468
+	.byte	0x9
+	.long	.LASF1469
+	.byte	0xc
+	.long	.LASF1470
+	.byte	0x9
+	.long	.LASF1471
+	.byte	0x9
+	.long	.LASF1472
+	.byte	0x8
+	.long	.LASF1473
+	.byte	0x8
+	.long	.LASF1474
+	.byte	0xc
+	.long	.LASF1475
+	.byte	0x7
+	.long	.LASF1476
+	.byte	0x6
+	.long	.LASF1477
+	.byte	0x5
+	.long	.LASF1478
+	.byte	0x6
+	.long	.LASF1479
+	.byte	0x6
+	.long	.LASF1480
+	.byte	0x4
+	.long	.LASF1481
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1304:
+	.string	"overrun"
+.LASF1358:
+	.string	"slash"
+.LASF892:
+	.string	"__ONCE_ALIGNMENT "
+.LASF967:
+	.string	"USE_1WIRE_DS2482 "
+.LASF878:
+	.string	"__fsfilcnt_t_defined "
+.LASF962:
+	.string	"USE_OPFLOW "
+.LASF1159:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1296:
+	.string	"mainPrevious2"
+.LASF1182:
+	.string	"FlightLogFieldPredictor"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1167:
+	.string	"size_t"
+.LASF1178:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD"
+.LASF1233:
+	.string	"blackboxHuffmanDecoder_s"
+.LASF806:
+	.string	"__ino_t_defined "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1238:
+	.string	"blackboxHuffmanDecoder_t"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1396:
+	.string	"streamReadSignedVB"
+.LASF844:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF791:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1005:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1026:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF975:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1294:
+	.string	"lastMainTime"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF939:
+	.string	"USE_GPS "
+.LASF1346:
+	.string	"readFieldValues"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1212:
+	.string	"newFloatValue"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1389:
+	.string	"haveNibble"
+.LASF847:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF819:
+	.string	"__clockid_t_defined 1"
+.LASF1120:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1161:
+	.string	"int32_t"
+.LASF1266:
+	.string	"compressedFrames"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1224:
+	.string	"flightMode"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1067:
+	.string	"U_ID_0 0"
+.LASF833:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1383:
+	.string	"isFrameMarker"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1265:
+	.string	"interFrames"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1160:
+	.string	"int16_t"
+.LASF768:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF1386:
+	.string	"header"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1077:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF924:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF743:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF935:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1078:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1032:
+	.string	"USE_UART7 "
+.LASF1041:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1203:
+	.string	"flightLogEvent_flightMode_s"
+.LASF1207:
+	.string	"flightLogEvent_flightMode_t"
+.LASF1126:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1043:
+	.string	"USE_SERVO_SBUS"
+.LASF942:
+	.string	"USE_TELEMETRY "
+.LASF752:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF928:
+	.string	"USE_I2C_PULLUP "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF944:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1096:
+	.string	"EXTENDED_FASTRAM "
+.LASF1355:
+	.string	"nextLog"
+.LASF866:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1295:
+	.string	"mainPrevious"
+.LASF854:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1276:
+	.string	"headers"
+.LASF476:
+	.string	"__P(args) args"
+.LASF822:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1097:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1263:
+	.string	"blackboxDecoderStats_s"
+.LASF1301:
+	.string	"stats"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF816:
+	.string	"__daddr_t_defined "
+.LASF1300:
+	.string	"gpsValues"
+.LASF1000:
+	.string	"USE_SERIALRX_SUMD "
+.LASF857:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF736:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1370:
+	.string	"defIndex"
+.LASF793:
+	.string	"__f64x(x) x ##f64x"
+.LASF1257:
+	.string	"type"
+.LASF869:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF918:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF778:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF1256:
+	.string	"blackboxDecodedFrame_s"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1065:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF927:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1239:
+	.string	"BLACKBOX_DECODER_DEF_MAIN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF820:
+	.string	"__time_t_defined 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1196:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF829:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1039:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF966:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF908:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF898:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1223:
+	.string	"syncBeep"
+.LASF1267:
+	.string	"slowFrames"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1088:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF737:
+	.string	"NULL"
+.LASF1138:
+	.string	"BLACKBOX_DECODER_FRAME_SIZE 256"
+.LASF1068:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1083:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1061:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF880:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1047:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1399:
+	.string	"result"
+.LASF876:
+	.string	"__blkcnt_t_defined "
+.LASF938:
+	.string	"USE_BLACKBOX "
+.LASF1403:
+	.string	"atoi"
+.LASF1194:
+	.string	"FlightLogEvent"
+.LASF1251:
+	.string	"deltaEncoding"
+.LASF767:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF773:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF999:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF933:
+	.string	"USE_SERIALRX_IBUS "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1101:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1405:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1404:
+	.string	"__nptr"
+.LASF1156:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1237:
+	.string	"symbols"
+.LASF858:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1066:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF863:
+	.string	"__suseconds_t_defined "
+.LASF917:
+	.string	"_PTRDIFF_T_ "
+.LASF700:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1374:
+	.string	"frameCharToDef"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1247:
+	.string	"isSigned"
+.LASF1186:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1348:
+	.string	"groupCount"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF827:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1359:
+	.string	"blackboxDecoderFieldIndex"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1400:
+	.string	"shift"
+.LASF1144:
+	.string	"short unsigned int"
+.LASF1135:
+	.string	"BLACKBOX_DECODER_MAX_FIELDS 128"
+.LASF1287:
+	.string	"frameBuffer"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF755:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1044:
+	.string	"USE_DASHBOARD"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1347:
+	.string	"group"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1282:
+	.string	"frameIntervalPDenom"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1098:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1084:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1324:
+	.string	"blackboxDecoderNext"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF789:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF864:
+	.string	"__NFDBITS"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1270:
+	.string	"eventFrames"
+.LASF977:
+	.string	"USE_FRSKYOSD "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1284:
+	.string	"vbatref"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF802:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF893:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1107:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1147:
+	.string	"signed char"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF1163:
+	.string	"uint8_t"
+.LASF836:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF997:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1195:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1258:
+	.string	"fieldCount"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1015:
+	.string	"USE_CLI_BATCH "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1100:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1189:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16"
+.LASF971:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1225:
+	.string	"inflightAdjustment"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1040:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF805:
+	.string	"__u_char_defined "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1054:
+	.string	"USE_1WIRE_DS2482"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF823:
+	.string	"_ENDIAN_H 1"
+.LASF1143:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1183:
+	.string	"FlightLogFieldEncoding"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1402:
+	.string	"blackboxDecoderInitSegment"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF834:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF865:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1272:
+	.string	"skippedBytes"
+.LASF1085:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF907:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF943:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1081:
+	.string	"NOINLINE "
+.LASF1095:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1074:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF824:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF867:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1028:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF952:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF843:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF813:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"USE_VCP"
+.LASF873:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1213:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1369:
+	.string	"property"
+.LASF1368:
+	.string	"frameChar"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1254:
+	.string	"value"
+.LASF931:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1116:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF899:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1158:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF775:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF698:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1086:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1229:
+	.string	"flightLogEvent_s"
+.LASF1232:
+	.string	"flightLogEvent_t"
+.LASF969:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1341:
+	.string	"startResync"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF930:
+	.string	"USE_SERIAL_RX "
+.LASF1357:
+	.string	"lineEnd"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1137:
+	.string	"BLACKBOX_DECODER_HEADER_TEXT_SIZE 12288"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1152:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1128:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1343:
+	.string	"previous2"
+.LASF1235:
+	.string	"firstIndex"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1022:
+	.string	"USE_FAKE_MAG "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF799:
+	.string	"__lldiv_t_defined 1"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1226:
+	.string	"loggingResume"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF895:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1132:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1205:
+	.string	"flags"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1333:
+	.string	"decompressFrame"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF926:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF795:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF794:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF371:
+	.string	"__linux 1"
+.LASF1102:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF760:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1080:
+	.string	"FAST_CODE "
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1313:
+	.string	"strcmp"
+.LASF986:
+	.string	"USE_STATS "
+.LASF1382:
+	.string	"markerLength"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1004:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF841:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1356:
+	.string	"pInterval"
+.LASF1328:
+	.string	"stream"
+.LASF1316:
+	.string	"blackboxHuffmanDecoderInit"
+.LASF845:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1366:
+	.string	"text"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1142:
+	.string	"LOG_END_MAX_LENGTH 64"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1279:
+	.string	"defs"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1216:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF1219:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1253:
+	.string	"blackboxDecoderHeader_s"
+.LASF1255:
+	.string	"blackboxDecoderHeader_t"
+.LASF1274:
+	.string	"blackboxDecoder_s"
+.LASF1302:
+	.string	"blackboxDecoder_t"
+.LASF862:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF932:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF697:
+	.string	"__need_size_t "
+.LASF766:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1320:
+	.string	"limit"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1012:
+	.string	"USE_VTX_FFPV "
+.LASF818:
+	.string	"__clock_t_defined 1"
+.LASF1303:
+	.string	"decoderStream_s"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1037:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1048:
+	.string	"USE_RANGEFINDER"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF717:
+	.string	"__size_t "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1149:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1249:
+	.string	"encoding"
+.LASF1390:
+	.string	"buffer"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF800:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1112:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF984:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1200:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF998:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF811:
+	.string	"__uid_t_defined "
+.LASF1331:
+	.string	"previous"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1148:
+	.string	"__int8_t"
+.LASF738:
+	.string	"NULL ((void *)0)"
+.LASF1114:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1042:
+	.string	"USE_USB_MSC"
+.LASF1069:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1268:
+	.string	"gpsFrames"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1033:
+	.string	"USE_UART8 "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1337:
+	.string	"function"
+.LASF1325:
+	.string	"mainDefs"
+.LASF1299:
+	.string	"slowValues"
+.LASF1393:
+	.string	"byteCount"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1234:
+	.string	"firstCode"
+.LASF1228:
+	.string	"flightLogEventData_t"
+.LASF1406:
+	.string	"flightLogEventData_u"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF987:
+	.string	"USE_CMS "
+.LASF810:
+	.string	"__nlink_t_defined "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF777:
+	.string	"__HAVE_FLOAT16 0"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1385:
+	.string	"valueCount"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF870:
+	.string	"NFDBITS __NFDBITS"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF979:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF874:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1013:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF742:
+	.string	"WUNTRACED 2"
+.LASF1211:
+	.string	"newValue"
+.LASF1297:
+	.string	"frameValues"
+.LASF1157:
+	.string	"__uint64_t"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF996:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1288:
+	.string	"motor0Index"
+.LASF1146:
+	.string	"long unsigned int"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF947:
+	.string	"USE_PITOT "
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1019:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1154:
+	.string	"__uint32_t"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1180:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_VBATREF"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1372:
+	.string	"target"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1322:
+	.string	"segment"
+.LASF1281:
+	.string	"frameIntervalPNum"
+.LASF1218:
+	.string	"currentTimeUs"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1364:
+	.string	"line"
+.LASF1361:
+	.string	"defaultValue"
+.LASF950:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1335:
+	.string	"consumed"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF744:
+	.string	"WEXITED 4"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1003:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1339:
+	.string	"available"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1173:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF804:
+	.string	"_SYS_TYPES_H 1"
+.LASF1020:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1121:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF849:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1330:
+	.string	"payload"
+.LASF856:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1034:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF919:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1187:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB"
+.LASF796:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1092:
+	.string	"UNIT_TESTED "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1010:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF914:
+	.string	"_T_PTRDIFF_ "
+.LASF1023:
+	.string	"USE_FAKE_GPS "
+.LASF1108:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1375:
+	.string	"storeHeaderText"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF940:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1317:
+	.string	"blackboxDecoderFindIntraframe"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1217:
+	.string	"logIteration"
+.LASF945:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF853:
+	.string	"_SYS_SELECT_H 1"
+.LASF722:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1119:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF828:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF900:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1318:
+	.string	"decoder"
+.LASF1011:
+	.string	"USE_VTX_TRAMP "
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1103:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1352:
+	.string	"pFrameIndex"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF817:
+	.string	"__key_t_defined "
+.LASF1168:
+	.string	"long long int"
+.LASF909:
+	.string	"_STRINGS_H 1"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF821:
+	.string	"__timer_t_defined 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF719:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1395:
+	.string	"signBit"
+.LASF1174:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1401:
+	.string	"streamReadByte"
+.LASF837:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF788:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1113:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1091:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1104:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1002:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1262:
+	.string	"blackboxDecodedFrame_t"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1110:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1398:
+	.string	"streamReadUnsignedVB"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1062:
+	.string	"USE_RCDEVICE"
+.LASF832:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF1321:
+	.string	"frame"
+.LASF466:
+	.string	"__PMT"
+.LASF964:
+	.string	"USE_OPFLOW_MSP "
+.LASF990:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF965:
+	.string	"USE_PITOT_MS4525 "
+.LASF848:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF868:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF774:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1350:
+	.string	"iteration"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF901:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF1198:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF1087:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1298:
+	.string	"homeValues"
+.LASF912:
+	.string	"_ANSI_STDDEF_H "
+.LASF850:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1236:
+	.string	"count"
+.LASF1230:
+	.string	"event"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1280:
+	.string	"frameIntervalI"
+.LASF1131:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF905:
+	.string	"__COMPAR_FN_T "
+.LASF1242:
+	.string	"BLACKBOX_DECODER_DEF_HOME"
+.LASF770:
+	.string	"__HAVE_FLOAT128 1"
+.LASF851:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF757:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1376:
+	.string	"stored"
+.LASF1145:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF976:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1290:
+	.string	"mainTimeIndex"
+.LASF1052:
+	.string	"USE_PITOT_ADC"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1016:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1197:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF733:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1139:
+	.string	"BLACKBOX_DECODER_SYNC_FRAMES 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1345:
+	.string	"prediction"
+.LASF993:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1240:
+	.string	"BLACKBOX_DECODER_DEF_SLOW"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF825:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF903:
+	.string	"alloca"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1338:
+	.string	"bits"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1190:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_NULL"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1269:
+	.string	"homeFrames"
+.LASF1377:
+	.string	"blackboxDecoderFindLogs"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1193:
+	.string	"FLIGHT_LOG_COMPRESSION_HUFFMAN"
+.LASF951:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1123:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF852:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF396:
+	.string	"false 0"
+.LASF814:
+	.string	"__id_t_defined "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1344:
+	.string	"homeCoordIndex"
+.LASF1206:
+	.string	"lastFlags"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF913:
+	.string	"_PTRDIFF_T "
+.LASF395:
+	.string	"true 1"
+.LASF921:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1261:
+	.string	"offset"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1179:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_1500"
+.LASF1227:
+	.string	"imuError"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF751:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF934:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1315:
+	.string	"memchr"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1397:
+	.string	"zigzagDecode"
+.LASF750:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF959:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1007:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF764:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF982:
+	.string	"USE_ANTIGRAVITY "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF721:
+	.string	"_WCHAR_T "
+.LASF1275:
+	.string	"headerCount"
+.LASF781:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1021:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF920:
+	.string	"_GCC_PTRDIFF_T "
+.LASF941:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF859:
+	.string	"____sigset_t_defined "
+.LASF1024:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF780:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1273:
+	.string	"blackboxDecoderStats_t"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF729:
+	.string	"_WCHAR_T_H "
+.LASF1373:
+	.string	"next"
+.LASF983:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF839:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF902:
+	.string	"_ALLOCA_H 1"
+.LASF925:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1309:
+	.string	"strncmp"
+.LASF1176:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0"
+.LASF1036:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1363:
+	.string	"parseHeaderLine"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1099:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF953:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1049:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF1323:
+	.string	"start"
+.LASF1221:
+	.string	"errorCode"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1351:
+	.string	"shouldHaveMainFrame"
+.LASF1285:
+	.string	"compression"
+.LASF855:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF1381:
+	.string	"findLogStart"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1129:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1006:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1175:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF762:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1260:
+	.string	"skippedFrames"
+.LASF906:
+	.string	"_STRING_H 1"
+.LASF724:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1241:
+	.string	"BLACKBOX_DECODER_DEF_GPS"
+.LASF732:
+	.string	"_GCC_WCHAR_T "
+.LASF915:
+	.string	"_T_PTRDIFF "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1134:
+	.string	"BLACKBOX_HUFFMAN_MAX_CODE_LENGTH 16"
+.LASF745:
+	.string	"WCONTINUED 8"
+.LASF1289:
+	.string	"mainIterationIndex"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF989:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1354:
+	.string	"size"
+.LASF954:
+	.string	"USE_RX_UIB "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1169:
+	.string	"long long unsigned int"
+.LASF1106:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF383:
+	.string	"SITL 1"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF761:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1133:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1365:
+	.string	"length"
+.LASF1164:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF916:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1118:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF981:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1018:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1367:
+	.string	"parseFieldDefinition"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1292:
+	.string	"logEnded"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF756:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF807:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1124:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1185:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF826:
+	.string	"__BIG_ENDIAN 4321"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1030:
+	.string	"USE_UART5 "
+.LASF1115:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF973:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF897:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1209:
+	.string	"adjustmentFunction"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1079:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1244:
+	.string	"blackboxDecoderDef_e"
+.LASF872:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF728:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF955:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1029:
+	.string	"USE_UART4 "
+.LASF972:
+	.string	"USE_DASHBOARD "
+.LASF980:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1387:
+	.string	"streamReadTag8_4S16"
+.LASF748:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1305:
+	.string	"decoderStream_t"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF739:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1311:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1340:
+	.string	"terminator"
+.LASF1140:
+	.string	"LOG_START_MARKER \"H Product:Blackbox flight data recorder by Nicholas Sherlock\\n\""
+.LASF1271:
+	.string	"corruptFrames"
+.LASF723:
+	.string	"_T_WCHAR "
+.LASF740:
+	.string	"_STDLIB_H 1"
+.LASF1025:
+	.string	"USE_BARO "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1191:
+	.string	"FlightLogCompression"
+.LASF749:
+	.string	"__WCLONE 0x80000000"
+.LASF1150:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1371:
+	.string	"isName"
+.LASF963:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1332:
+	.string	"isIntraframeStart"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1172:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS"
+.LASF936:
+	.string	"USE_ADC_AVERAGING "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1327:
+	.string	"frameType"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1053:
+	.string	"USE_1WIRE"
+.LASF1378:
+	.string	"logOffsets"
+.LASF840:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF726:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1250:
+	.string	"deltaPredictor"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF769:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1171:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_0"
+.LASF812:
+	.string	"__off_t_defined "
+.LASF957:
+	.string	"USE_RANGEFINDER "
+.LASF1204:
+	.string	"time"
+.LASF1319:
+	.string	"scratch"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1064:
+	.string	"USE_ITCM_RAM"
+.LASF1210:
+	.string	"floatFlag"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1009:
+	.string	"USE_VTX_CONTROL "
+.LASF1259:
+	.string	"values"
+.LASF727:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF891:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1380:
+	.string	"logCount"
+.LASF1090:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF772:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1314:
+	.string	"memcmp"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1111:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF861:
+	.string	"__timeval_defined 1"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1310:
+	.string	"strchr"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1031:
+	.string	"USE_UART6 "
+.LASF779:
+	.string	"__HAVE_FLOAT64 1"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF725:
+	.string	"_WCHAR_T_ "
+.LASF910:
+	.string	"_STDDEF_H "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF835:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1181:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1264:
+	.string	"intraFrames"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF949:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF776:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1342:
+	.string	"applyPredictors"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1360:
+	.string	"blackboxDecoderGetHeaderInt"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1056:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF790:
+	.string	"__f32(x) x ##f32"
+.LASF1046:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1058:
+	.string	"USE_ADC"
+.LASF759:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1246:
+	.string	"name"
+.LASF1105:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1055:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1245:
+	.string	"blackboxDecoderFieldDefs_s"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1252:
+	.string	"blackboxDecoderFieldDefs_t"
+.LASF815:
+	.string	"__ssize_t_defined "
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF746:
+	.string	"WNOWAIT 0x01000000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1278:
+	.string	"headerTextUsed"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1312:
+	.string	"strtol"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1130:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1151:
+	.string	"short int"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1277:
+	.string	"headerText"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1362:
+	.string	"blackboxDecoderGetHeader"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1166:
+	.string	"uint64_t"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1326:
+	.string	"frameStart"
+.LASF937:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1051:
+	.string	"USE_PITOT_MS4525"
+.LASF846:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF875:
+	.string	"__blksize_t_defined "
+.LASF960:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1286:
+	.string	"huffman"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF958:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1093:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1199:
+	.string	"FLIGHT_LOG_EVENT_IMU_FAILURE"
+.LASF1122:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1306:
+	.string	"blackboxHuffmanDecode"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF923:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1293:
+	.string	"lastMainIteration"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1094:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1349:
+	.string	"countSkippedFrames"
+.LASF974:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1060:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1076:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF720:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1379:
+	.string	"maxLogs"
+.LASF961:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF741:
+	.string	"WNOHANG 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1243:
+	.string	"BLACKBOX_DECODER_DEF_COUNT"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1082:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF734:
+	.string	"__DEFINED_wchar_t "
+.LASF803:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF792:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF994:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1334:
+	.string	"payloadLength"
+.LASF1329:
+	.string	"valid"
+.LASF970:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF763:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF896:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1308:
+	.string	"strlen"
+.LASF1155:
+	.string	"__int64_t"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF842:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1283:
+	.string	"minthrottle"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF838:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF948:
+	.string	"USE_PITOT_ADC "
+.LASF730:
+	.string	"___int_wchar_t_h "
+.LASF1307:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1177:
+	.string	"FLIGHT_LOG_FIELD_PREDICTOR_INC"
+.LASF1057:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF988:
+	.string	"CMS_MENU_OSD "
+.LASF798:
+	.string	"__ldiv_t_defined 1"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1027:
+	.string	"USE_UART2 "
+.LASF1392:
+	.string	"leadByte"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF956:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1109:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF735:
+	.string	"_BSD_WCHAR_T_"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1248:
+	.string	"predictor"
+.LASF1165:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF754:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF831:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF758:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF731:
+	.string	"__INT_WCHAR_T_H "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1192:
+	.string	"FLIGHT_LOG_COMPRESSION_NONE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1038:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"__mode_t_defined "
+.LASF1045:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1220:
+	.string	"flightLogEvent_IMUError_s"
+.LASF1222:
+	.string	"flightLogEvent_IMUError_t"
+.LASF995:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF946:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1170:
+	.string	"timeUs_t"
+.LASF1214:
+	.string	"float"
+.LASF1014:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF992:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF747:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1336:
+	.string	"decodeEvent"
+.LASF1035:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF753:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF894:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1001:
+	.string	"USE_SERIALRX_SUMH "
+.LASF922:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF808:
+	.string	"__gid_t_defined "
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF985:
+	.string	"USE_LOG "
+.LASF1391:
+	.string	"streamReadTag2_3S32"
+.LASF929:
+	.string	"USE_RX_PPM "
+.LASF1153:
+	.string	"__int32_t"
+.LASF1162:
+	.string	"int64_t"
+.LASF1388:
+	.string	"selector"
+.LASF801:
+	.string	"EXIT_FAILURE 1"
+.LASF1127:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF797:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1117:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF911:
+	.string	"_STDDEF_H_ "
+.LASF1202:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF1201:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1008:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1073:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1208:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF1215:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF879:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1089:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF830:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1184:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1384:
+	.string	"streamReadTag8_8SVB"
+.LASF1231:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1291:
+	.string	"mainStreamValid"
+.LASF871:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1017:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF904:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1353:
+	.string	"blackboxDecoderInit"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1063:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1188:
+	.string	"FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1141:
+	.string	"LOG_END_MESSAGE \"End of log\""
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1136:
+	.string	"BLACKBOX_DECODER_MAX_HEADERS 160"
+.LASF991:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1394:
+	.string	"signExtend"
+.LASF1125:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1050:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF968:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF877:
+	.string	"__fsblkcnt_t_defined "
+.LASF978:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1460:
+	.string	"__sigset_t.h"
+.LASF1467:
+	.string	"struct_mutex.h"
+.LASF1479:
+	.string	"common_post.h"
+.LASF1440:
+	.string	"long-double.h"
+.LASF1473:
+	.string	"__locale_t.h"
+.LASF1475:
+	.string	"platform.h"
+.LASF1477:
+	.string	"target.h"
+.LASF1464:
+	.string	"thread-shared-types.h"
+.LASF1434:
+	.string	"libc-header-start.h"
+.LASF1432:
+	.string	"stdbool.h"
+.LASF1412:
+	.string	"src/main/target"
+.LASF1426:
+	.string	"blackbox_huffman.h"
+.LASF1428:
+	.string	"blackbox_decoder.c"
+.LASF1409:
+	.string	"src/main/common"
+.LASF1421:
+	.string	"stdint-intn.h"
+.LASF1427:
+	.string	"blackbox_decoder.h"
+.LASF1419:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1441:
+	.string	"stubs.h"
+.LASF1472:
+	.string	"locale_t.h"
+.LASF1407:
+	.string	"src/main/blackbox"
+.LASF1411:
+	.string	"src/main/target/SITL"
+.LASF1466:
+	.string	"atomic_wide_counter.h"
+.LASF1438:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1415:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_decoder.c"
+.LASF1430:
+	.string	"stdlib.h"
+.LASF1474:
+	.string	"strings.h"
+.LASF1436:
+	.string	"features-time64.h"
+.LASF1465:
+	.string	"pthreadtypes-arch.h"
+.LASF1420:
+	.string	"types.h"
+.LASF1454:
+	.string	"endian.h"
+.LASF1448:
+	.string	"floatn.h"
+.LASF1450:
+	.string	"clock_t.h"
+.LASF1418:
+	.string	"/usr/include"
+.LASF1462:
+	.string	"struct_timespec.h"
+.LASF1452:
+	.string	"time_t.h"
+.LASF1408:
+	.string	"src/main/build"
+.LASF1459:
+	.string	"sigset_t.h"
+.LASF1449:
+	.string	"floatn-common.h"
+.LASF1476:
+	.string	"common.h"
+.LASF1443:
+	.string	"typesizes.h"
+.LASF1463:
+	.string	"pthreadtypes.h"
+.LASF1446:
+	.string	"waitflags.h"
+.LASF1451:
+	.string	"clockid_t.h"
+.LASF1435:
+	.string	"features.h"
+.LASF1444:
+	.string	"time64.h"
+.LASF1422:
+	.string	"stdint-uintn.h"
+.LASF1456:
+	.string	"byteswap.h"
+.LASF1445:
+	.string	"wchar.h"
+.LASF1453:
+	.string	"timer_t.h"
+.LASF1469:
+	.string	"alloca.h"
+.LASF1410:
+	.string	"src/main/config"
+.LASF1447:
+	.string	"waitstatus.h"
+.LASF1413:
+	.string	"src/main"
+.LASF1424:
+	.string	"time.h"
+.LASF1417:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1470:
+	.string	"stdlib-bsearch.h"
+.LASF1414:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1468:
+	.string	"struct_rwlock.h"
+.LASF1429:
+	.string	"string.h"
+.LASF1478:
+	.string	"sanity_check.h"
+.LASF1439:
+	.string	"cdefs.h"
+.LASF1458:
+	.string	"select.h"
+.LASF1433:
+	.string	"stdint.h"
+.LASF1481:
+	.string	"build_config.h"
+.LASF1423:
+	.string	"stddef.h"
+.LASF1442:
+	.string	"stubs-64.h"
+.LASF1425:
+	.string	"blackbox_fielddefs.h"
+.LASF1437:
+	.string	"wordsize.h"
+.LASF1457:
+	.string	"uintn-identity.h"
+.LASF1416:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1461:
+	.string	"struct_timeval.h"
+.LASF1480:
+	.string	"parameter_group.h"
+.LASF1455:
+	.string	"endianness.h"
+.LASF1431:
+	.string	"stdc-predef.h"
+.LASF1471:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`G\004\315\020"
+	.string	"\346\224NC m\2355\003\224\217\270'\270(\274S6d\223\001L\023^\264\275\261F\310{0\265(\314\327\276\252\032*\177Sk"
+	.string	"A \252.\001$\344~4\221\231\025\370\353\365\354\373\333\337\376-\261[\264v\323\226\001B"
+	.string	";"
+	.string	"="
+	.string	"\037\032\200P\333\366\266]/l\253$rU\272\366\346)\b\300a\003\235^\b\b\013"
+	.string	"\264\256\246B\253\n\024\017:RQ\256\310(\035\224\244\022\245x\326V\312\323\301\262\263\261\347\334&&J\ts\234\032G\017\004t\350\356\341=|\263'V\007\203\205\232\022\274\fp\2301\203\203\177\177_\256[\372A\301\202\344b\357\355u[\3466\350\307\303\004\nvb\252\026\212U\261\333{\265\333J\306\001WM\275k\333\353\\\203\353@\360\204\b\355\024K\204\222\004\b3?D4\034"
+	.string	"\351\365\314\024c0\242\\}\2337\257]\030\215\260.\342\242(>\277k02\004\256\022\036\357^3\\\327\"\323\013\225\224H\033r\222\2343\275\222\207\223\177\207\364tb@\001\361^\351\363\016{-\310\340@\363Z8\326\3079\217\177s\234\273\027\360\272\370\203h\004NL\"27n\250A\252\240\002\t*\314\244\240\320j`\0023F\305\016\022"
+	.ascii	"u)\310s\006\032\t\244\"\251E\345$\205a\016'\2106d\001\314\022"
+	.ascii	"P\250\242&F?\242\302\022\306\2700\311\3259\260W\377\234\375;"
+	.ascii	"\304\324\246\026\360\344\260I\031\311\023\356\332$yF\016\362"
+	.ascii	"\274_j\013_\303\002\217\366\326{\274\231\265\260\177\267M\356"
+	.ascii	"$b\344neR\034\2074\320e\234\241\374\227\332\250,\306\223\370"
+	.ascii	"0\317\004\307r\033\274\343\251`\233\335\220\272%\005\345j\217"
+	.ascii	"\037\303\363Z\354\217\357_\203\217C\021\327\242\366I\017j\231"
+	.ascii	"-\203\312\253\031\036\304\037\315\213]\202J\036\231\327&\017"
+	.ascii	"W\204}\271\023\253\314\202?\020\236\266\276\035+\360\003\307"
+	.ascii	"\t\003v\235\372)\021\356%C\333\\N:\362\026\235\bG8\325\351\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\271\002\225\t"
+	.string	"\222J\036#\200\265I\007\340P\030\231\3031dB\031\240(\212\242(:\n\315\360\361\361#!bckD\255m\271\223\f$\231@V^w\330\327L\366:\343[\254\230f\223'\240\"\224-\355A\331\031\316\331~\215\324\n\212\264I\346\231\337\227\240\334s\007\352\240\215<q\221<\301Re\222I\361KM\326\372\216\006\004\002\276\037"
+	.ascii	"\2105\354N\212\364\254\233-$\343|\023\027\277\263a\243e\250\221"
+	.ascii	"\325;II!\255\001\260\202\241!*\017\022\200\224-L\304\212\310"
+	.ascii	"\"[\373\317\030\030\3149\260\2131\232\035\342\311\242\r\\\341"
+	.ascii	"\255\210\253\217\233)\221\324\215\305>\034&n\221Z\340\245\316"
+	.ascii	"H+\246\305\246\247\300\177z\221F\276\326\241]\264!{\241P$\016"
+	.ascii	"\027\002\200<\265\340\206\324\336\315\310'2\032@sh\026 \233]"
+	.ascii	"\005\211\243\301-28\327\246\262\t\237\255\r\246r\240R\321/\372"
+	.ascii	"\226\022\007\203\345\265h\204\235\352Q\203\246oq@\006\364\355"
+	.ascii	"\315\323]\370\357\311)\007\234\371\210^\233a\364\207HN\305\021"
+	.ascii	"\314\302&\305H\273N\213\325\035E\307\251\017\317\201\024"
+	.text
+	.section	.gnu.lto_.inline.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`t\013m-"
+	.string	"\212@\320\rJ\240\024R:\260\247.\322\237\263\264[v\224\006\035\r{\277\017\232\3565\033Nm\250\306\004%]\037<N\275\357\316B\216\027\265\016\350\265\326;\316S\030g4q\242\320&H\220\343D\234X\227\317\rG\375\253\375\332%\177o)S\273"
+	.string	"\314"
+	.string	"\311"
+	.string	"g\341\313k\265\246\210s\364\377\335\356*\005*$\353\313\006\337\336\362\364\023U\216$2o\333\267\025n\201\365\366\3467\266w\013l\016\\cF\372\266\275\267\315\241H&\033\316\370;\f\367^\241\233\3234\007\365\277\200i\032\250kg\036z\024\342\002\243y\355f\263y\306\373y\332\206\210)\"\333p\022\246B\311\231\247\277N\275\275\255\007\366\212\2642.\372\256\357\037\007\251W\263\211\306C+S\222\361\013\333o~z\332\374>\363\264T\321\t\257\223\275\357+2\3259\377`\337{\257\335i\246{\357\355\334oa{"
+	.ascii	";\263\302\375C\312T\204L\362\372\347!\0253\336\350\202\371e\236"
+	.ascii	"\033\006\024\te,\210\205aK!5\341\370\330o\367\025}E]\355?\220"
+	.ascii	"6\233M*\347\317C\251\250\234t\311\364\307\310\216<\b\234\245"
+	.ascii	"\332\327_\347t\207\036S\252\204\264\351\bI\023\234\357\036\354"
+	.ascii	"\263\035$\232\273\333\013\333\310l\201\244\211RORr\177O/\265"
+	.ascii	"P\232\230`\373\317\322\\\233\371?\377\234,\035T\351\271\247\227"
+	.ascii	"X\241m8\330\255\204(\334\227\020\205\376\334R\377\007\351\025"
+	.ascii	"\321\326\321\212\021{\020qT\363\331\207\306HR\252\372\223\236"
+	.ascii	"\255\327\333\355X\034=\rQ\342\371\373\264\206!\310\0350\267\337"
+	.ascii	"\222w\211\324\242\237\271=a\242\237i\366icX\322\214\227\237\367"
+	.ascii	"A\252u\357\2451\320\374\203\013h\353'\307\205\344\221qN\003\r"
+	.ascii	"t[Bx\310\274w u\242R\332\252\345\264\322,,\005\337~\035\0326"
+	.ascii	"\224D\313\236H\266i\240\377\226"
+	.string	"\\Rf\234\323\246\203v\350\nbR\231\202\003\250K\254\346\327\355\027v\326\221\247\245\004'B\324\030bp\335\314\177\312~\356\365\277f!_F\030\366\327i%aD>,\256\3736\343\245?\320|\232\024R\026yy\213}K}\277\326_\227E9\001i\233C\357\326\224+\373\272{\335\375(\025\226\210\027\271\327\336+\260\257nH\3218\207-\344\304\n\351\301{\327\241\247\006\373\277\206\217\\\323A\234\001\353\254i \346*\346\235\267\351\b6\235\241\237c\336Y\323?\\\301P\234%\271\3628\366\025\371\327\325\224PJ[\304\231_\030g\313\264\314[&\200\023\346@`s\220\032\231i^\326\013\n\nY\314I\177z^\363\305\\|0\302\273L\f\2541&.\t$\r\rB\277\3112I\325\340\301\200\267,\357\275\270vq\357\355=\346\272'\224o\373\331\3056\017\373\310\n\363\350\340\357\241,\314F|5\221"
+	.string	"\016\215D\t\035\234\326@"
+	.ascii	"\373\212-Q\364|\376\371!\226W\202\024@\202(\272\222C\317\224"
+	.ascii	"\210\217(\"\033\035f\247\215\314)\256*l1\346\224\322\314H\271"
+	.ascii	"CG"
+	.string	"\351R\026\330\226\313\003\364;\210\231\345\320\375\345\226\254V\250\245,\031\026\310q\331\265\253g-z\004U\210\252 \271\334\345\276\"\313\017`\237\335\313!\206\366\320\251\251d\224\001\337\325v\366\327FM_]\267\333%N\001\201\005\250Q1B\006M\315\210$I\n\351\321\004\204)\245\240\244>\022\200U5\347\2503fdDd\024\224\224\224UJ\007\"hK\204\303\225\227u\325\376\002\332gtS\302\\\220St\031\016a\327f\236B\354\324\013\224\332H\335\260\275\230\377D\036\211\250D\275N\221[\001\233\220=J\016P\276\323\303:4\031\324\276\037\2420D\251\332\361p\260\036\366\305\244E\210\320{i\023mnu\310\204\342\013\341&\213Y\346\320n\214\272\202,\2743h\301f\036C\306\026C\213\260\345\030\266M\235\355\023\375\037\336>\005\276\201\264t-\270\201\245\025c\264\262\313\353h\357\341\236\005\3255m6"
+	.string	"\233'#\361Ml\316\342\0014\022\242c\221c\3235](\211\tBn\241V)sC"
+	.string	"\b\226\033\353\232\361\274\313\303\250\211\246\303\362\266\270\224mKP\262\364\250\224\215\310\326\256)\334\314\245\002K\0248@\236\256y\016\255\231\237\203$\031O\331\224\335\225\226\213\030Z^\261\b\241h\211K\373o\367P^\264iZ\030L\200\005\025\203z\030\022fX\313Ej\203f\356\276o\236[z\341\n>W\367\320\342\361[\203\231ZTtb2\237\213\215\261%\331\213|gT\003\nv\256\004\021\262m\342\353\333%\361\02118\314w\006n\004N\304\t\r/\340\202\352\314\227\365\313d\372\212Q\026\253\253|s:\331Rx\255\244@\360\2434#B\211\027\023\216\005i\204\361\204hc\255 \324o\335\006\215\357&\342\224[=H$\207?\237@\377{])\035\225\316\225\2126\3532\206\311\255\304(\316e!bKy\356\001\027\201ef\2304\177\330\373\336"
+	.string	"\f-\351\340\222\2655T\001E:\017\271\007\241\256\316\220\270\217\243\036Xe\252t(\236\255\351n\235\255\345\220\315\242N\273\227Q^\002\2324\013\204\n\017\020/S\030\003\027\342\377\352 "
+	.ascii	"\006\367n\226\211\261\364\205p\352G6\322\033\242\241C\231\264"
+	.ascii	"\374\233\0309\271\322\242\202\032I\303M\006\323\246\323l\305"
+	.ascii	"\261\f\036\344 \340g0\303\346u\022\354"
+	.text
+	.section	.gnu.lto_.jmpfuncs.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\021\022\025'"
+	.string	"F,\226G\340\026'\035,\231\2158\323k\037\330\231d\226KO\2103\312!\007\270`\013&\006\002|m_g$\221@o\323rj{\262F;\341\023\207Q\250\3021X\377C\035\346\254f6j\354\016J\373?\221\336\335\177o\231ds"
+	.string	"\201"
+	.string	"\210"
+	.ascii	"\b\356\235h<|&\022\273\314\263\354\322\250\343\203\222\\\311"
+	.ascii	"\370\307"
+	.string	"\217\346\233\233\337\033\264_\267F\035_\222T\366\225\241\004\241\276s\353\2535\337\330\177P\355\347\370q|\326\263\017\235y\177\364\373\013\364\277@\373\254Cg\337\227\276\362\261\t\242\315\362\247\007R\370\245\257\203\377r\312\331\367}G\1777\363\355\311\303\237<\347\363\235\375\377}\345\317.\354\303\334R\023=\357\361\256?\365'E\035OCE\035\037cE\035\177\242$\373%X\324q\304\220\207\370\016\332\016\004\364\326\2276\323\004pA[A\337\233Z8\246O\233\265\277Y&\277\364u\351K\352+\001\334\2132\357\313\330\213\264\250Y\317\223\232\275\2576\242l2MJmI\276\222\3722\"\356;\177'\351Z_\006+/\352\350\301\250#'\243\216\033f\324\321BI\366\23533\223}Z\277;\264Y\372\3064\r\026\307\303\211\373 \230\302\323\007\224\0053l\024\032\360\215\374\007\002\244j\217\342\302\362\316J\352\313\357("
+	.ascii	"{\013\371\222Oq\21200;\260J\272F\300\306\206B\021k\022%+\332"
+	.ascii	"LD]I\210\257\n\212\"V\276\177\035\311\253\r\332;\260:\022\235"
+	.ascii	"\247^\024\364\027\027\364\317\223\037\273f\"k\002\253\364G~\036"
+	.ascii	":W\305\004\254R\235\363\320\321\204\300*50\200\331\207\350C|"
+	.ascii	"\326\023\213\375H\272mA\256\243$ih&}\0254\3768\020`\027\262\274"
+	.ascii	"-\203\306\335\027\206\026T\205,o\245\3029\035\030r8 \252\313"
+	.ascii	"\325\201\255\225=E`\341\0165\034@\033\332U\210Y\326\0139\260"
+	.ascii	"\013+\264\254\375D\334\255\2740\2057\324\327y\023@\334\2558V"
+	.ascii	"\n\243:V\312s\201\030\264\341\311Cu`+\343\024\313C\331\023\253"
+	.ascii	"\013q\312~[\216\335P,\t\032g\036N\366\003;\225\206\315\305}V"
+	.ascii	"u\3620l\"p6\260C\201\366\324\201\033\027r\250-T\245\274/g{\005"
+	.ascii	"\201!\250AM\347FF\222\244T\2439\301\004\2048\311\240t\353\001"
+	.ascii	"\022\340\0219\004D)\n\"IF*\243\220\221\221\221@D"
+	.string	"\002\021IJbh\f<\245\276\242\347\370y\245_E\204\240<\234\240Fv\032\nW\003\n$\253\002\272\001\r\002\022\314\337\200\232T\321\325\224\346\233\244\344\231$9\344\212|\306S\225\330o\372u-\270\325UH \275\311\253\257J\323\316\200\027\370\312\324\255\033\254\342|.\363\225\331\312\305\201h\016\256d\320\356\277,\241C@\177&\217P(\353$\233\036\205X\350\334\233\252Z0\020\326qR\241w\232\023\306\201\202\336Up\3272\313\340Am\320&)n-\346\001\226\037\261\254&\270\365\r\376\020sP\251\314\222\331\357\356\276Tu1\346\312\365:4l\324&\273(h\321\034\241.\357\n\271\321\323#\226%\354rqzc;P~\204\002\215v\025\301\336s\213\231\031\242\320\244[\001u\n\255T+\214?#\2623\030\220<8m\304\271o\240\376\271\0038O\373 \375\245]\340\315\223\376\241Mc\223\375\327\210"
+	.string	"\017\017\334\2201\342\320\337\355\322\"\013\303\356\002\301\345h\244\333i\034"
+	.string	"\335\240J\352\311:B\211\316\342\232\3552\257\314l\253Q\220%\254'\022%3H\261\304\013\360w0]\323\202\334(\207\033\370\322,\2033s\222\224!\224\337\311\242\244\313\331j\004\204#=\3249\313\346\257\225\264T\262\240\017S\3079\321\255\261\347|\027\302?\372\201q\230!G\344\366g\212\030\2569xYp\2068\022sC\252\037v\203q#\307x\262|\337\260\323}"
+	.string	"\240\030Gb\200\f\r\225k3\250>\224\301\311j\035\331\275V\213\240\251\315\316\222\354\274^\302Z\310\251 \210\001\326\235$5M\367e\324-\024\263S\263\340#uw\337hY\370\231\030\347Gzl\007\236s\204n\343\036\304\250t@\311LIam!Cd?\234\372s\b\327\032\243\215\243\035g\3754r\033\341;\204b\026q\272@H\\\252\210/H\220R\024\360\223B-`F-\220\214\263 \270\016\313q\021G\324a\342n%\310\243\255\306\216\311\211@\317\001\274 w\005}`"
+	.ascii	"\\;\331\026\273\366\001\320\231\234|\327`\257\n\3764\246\344"
+	.ascii	"\203xB\255\360\276\226&\360\250\177\353\210\233(:\363\3734R\251"
+	.ascii	"=>\377\265j\232\307\004\376R\222\001\340\003"
+	.text
+	.section	.gnu.lto_.pureconst.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375 ME\002"
+	.string	"\322\004\021\035\220G\215\001\260\317\bO\317\236mff\274\252*\355\375\377'[\303\265f$\215Y\"\003&\226\206\201\013<\340"
+	.string	"Ye\243d\223K\0369\344\217;\336x`|qEDb\001q\375p\303V\370\255\273#\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\232\004}\027"
+	.string	"\346btF\020\257&\035\b\002\230r\234\327IU. \331\007\024\017<\333\250\256\257\327\356\327\321\016Z{\024\272=X\376\357\253\312y"
+	.string	"4\210_tA\352\217M4\273\300(k\254\372\206\215#8\004\321\020H$\233\020\262\245L\001U"
+	.string	"e"
+	.string	"a"
+	.string	"/\331_\267\366$\253'\331\357\305q\033\207\2418\231\3555\352\036Cq\233%\327c\255f^\317\254\255\272\353\367!\253\037\331k*\206\302N[\264\342\177\325\213\354b\247mwI\314\356~\f\252\377\347\347\343f\231\366\365z\006\273o\260\372\353?\322\177<\301\177]\b\253\337\""
+	.string	"Q8[N\234p\276\222\307MjA\212\007\027.9]\"\006\004\347+\255\214 \201\375[\032\004\246\351\314\337T\267\354\223?\257\032\017a\231\365\017v\357`\343\3457Z\255\223\262\3200\037f\300N\221\371/\247\354\315\370\037\2315Uw`\2335Rx\2235\233.\264\361\245Y\276\314\0263\2237]\262\032\0331\236g\255\207v\277\257"
+	.ascii	"K\325-\242{B\227\264\265\357yV\257\207\364\217\234(\244i\231"
+	.ascii	"\327\214\0012\234\257\203J\243$X!z\210B\032\225p\2226\230\376"
+	.ascii	"3\353D\260\332\365\347F\330\235\326\334\016e\t\233\004\223\362"
+	.ascii	"\026\224\237\004%hm\232e\232\215wm\325\217\276\034\034\246_\276"
+	.ascii	"tg\365\241\007\231\240|\256\203> \023\224\017\363u\320\t\350"
+	.ascii	"\004ED^Q\224\376\203\3745!\252\375\3102o\204\230\236xk@\207\202"
+	.ascii	"\027\275\022\203%\247I\024nR\263A\260\230"
+	.string	"\371.\027\023a\267\n\223\266\3326m\325\335yZ\r\254\036;Y\037\226\252c\001\022\214\f*\r+8\310<vg\231\231\371\252\237\031\233e\227\260e\332\252\343\200\204\250Q1C\206ffd$)H:@\002b\310\330\235\007\022`\0066cJ\322<\352Y\330\317\233|\232\231\303\030\032I\024;\307\2426\311{\246O\337\313\273N\215\037\373\201PL|X\207X\205\267&\276\322^\374\201\r\371\341\352\025\213\376\225?\306\2527cS\270#\361\210\225\005\007\204)\263\316\276\030\221\006\227gaXD\230\346H\177\260\035\022\266\334.%\372}E\224\310M5:\205:CE\330m\033\206b\277\3312\214\336\336\271\f\311\212\313\301\322\377\337\271\300\322t\202\022D\355\017}\247\322\017\t\023\fhR!\032 ;\263\025! \270+\223\346\326E\033\266\315\237!\357z\003\204\212\304\023`g\217\b\224i54S\305%\020"
+	.ascii	"\240?\357\201\376\336\316\316\037`\241\245\245)\241\346\"\267"
+	.ascii	"\020\205L\037\201\031Bm\f]\030\216\240\r\243\223\004\006\005"
+	.ascii	"\321h\360\0131M=_\306wt\215\200N\321T\f\036T\352\034z\221n\346"
+	.ascii	"\255\341\270 \034NG\275\f\370=\252\002\200\f"
+	.text
+	.section	.gnu.lto_.lto.f7e8eac462a63035,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_streamReadUnsignedVB.26.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`I\005u#"
+	.string	"Z@$\016H\200\332Q:\311Lh,\024\350L'\322\323\243r\374\265\352\217\220\204\310\345\\\2030\371P\334\263\266\006\277\003\205\202\251\321\364\024\376%.\333U\026\333#a\213\312y>R\342tu\230b\214<$\320\253\366I#\204\310\235d\317"
+	.string	"\304"
+	.string	"\317"
+	.ascii	"L\305\377\342\234\020Y\357\312*\364>\251\200DSsor\350)gX\205"
+	.ascii	"\226=k\231\317\344M\250\236\234z\317\2756\322\220\335\233\\\300"
+	.ascii	"F\353S"
+	.string	"N\256\367:\222\212\253\320d\016\243\2053\304e\332\275I^\320\201\324\247\350\177\324\247\215\203\323\243\311\363\315V=\207\273\25565E\333V\361K<\367u\024\t\027\031\362\211Cqeacw\252\200\201>\3301D\310\233C{;pc\353\305W\fr\326tm\305\270\r\235\260\004\211\216;Up\241\255lb9\030\321\252\315l\246\351\025\234,c\213\243\250\202\031]X\350\030\257P 15\316.v[4Z\331~\363\026K\022\371\354\332zqk;\272\367\262\3152n\235\001\234\231\2670s\0233\252\026'\232\207~f\363h\221.\2405\316W\251W\276GCh\325\370_O}\220=\331\\\253\306\234\034\332>2\237\317\314\274\214p\333`\266Y\336\331,\377\254\226}V\313=\253e\236\035\035\335\223\177\316f\371\306\226\3253\317\351\225gT\265\334\251e\233Z\376\200.\022\233\001\310\334\253\265&\347\206I\251"
+	.ascii	"9\363W\236\277\274\030s\216\245\036\205\037&\001\231v\357\315"
+	.ascii	"=\225r44q\321e\213,\310\264\004\303\236\265\227\"\365\344T\233"
+	.ascii	"\270h\330\025\031r\301S!2=\376\023>\230Y\257\350\001\325\241"
+	.ascii	"\214@/\327\204/O\246\365\251\020\227\036\337\t\277)\324\205\311"
+	.ascii	"eA\267{\273\322\202\334{\225\276\224b\316==\0076\024)\304\236"
+	.ascii	"TD\203\362}\352\256\213|(\265;\270\353\356\243\021\347\b\341"
+	.ascii	"\350\372J\264m\353\332.\211,\322~\333N\227Xrn\375>\330}\274\020"
+	.ascii	"\347\360\332\013\250\273\2765[\"\327\360\215"
+	.string	"s\327\207\362\203\375\206\326&\214P\355#s\3210\202\337\203\017T\237\376\364\307\024a\370\264\026 \320\263\33048O\373t/\261\210\f\355\032\003M\261/\242\3708KU\036a\236l\316\244^\214\177\277\302\264cF\300\314\315\317\353F\342\030\031h\037\271\247yz\351\013\214\225\215\343t+=m@\007{8\025\340z\3575\342Oiz\342\367\230R\237\362\364N\031&B\273\306\027\373\205$\316\033\366\244\"\215g\233\\_\312\203\300\276\216i\343\354\035UV\004\276Gupj\202J\243>\210\200\372\005U.rPd\024\201\001\204\bD\004\236\224~\301((\225}D\301\037\007\240\357\307a\003\t\340\222\007\237\322\207%\036\b'\245'\236/\b\305#J\300\300\020\277 /\n\b\f\362rI\341\333\006\3220\2138\206\373\030J\026\2078f\333i\265\213\315G\302\036\036\311\355\204\320\300r\346\337\235L:\263{o"
+	.string	"37\302\257\343\230+\270\254\307Y\032\256\217\234S\262\352\364\233G\032Ka\207\236v\361`O\322\372\261\352\372_G\n\373b?v\024\001\0053V6\316Z\327\265j\234\362\221\320\252\035\275\367\336\233N\237i;\227\251i\353\364\261f\274y\034\332\032\273\302\205\223(k\037\031\247\365C\325\365N\027\371\315S\200\227\030\023[\0379e\2501\034F*\345\21014$\022\bIS\035`\002\2219u=\020X\210D$)\2441=$@}Y\215*\367\370\331.\023\b\031e\f\006|\t\204\335\232L\b\266h\b\355^CS{\034/dT\303\033\250'\277\341\215\021d\371Po@"
+	.string	"\001\237^5G\224\220\324\305mV\r\225\236\001!8\0028\f&7\334\334\343C/6\220\020\320+\355\320\367F\247\f\271\270 m\243\224\260i\201\351"
+	.ascii	"\\\004\207\0034i\215\311b\211\0209\255Z)qp\023\372\002\324\343"
+	.ascii	"\233\341\031\275\231q\017\255~\205`k\265\0258\257\257\262(\302"
+	.ascii	"Ip\210\375g\241^\321\013\274,\021\234w\270\013KYW \037\307\023"
+	.ascii	"\215\234\035YR\257\220\t\033RWEl\354\375{*\254\317B\017\263\337"
+	.ascii	"y\310@\263\370W\016T"
+	.text
+	.section	.gnu.lto_streamReadSignedVB.28.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`R\001\345\016"
+	.string	"\226\234eE"
+	.string	"\221(\035\300\007\361\363\201\337\347\t\304\241i\230\225\207\221\323\355\273\245`\203\251\023\377|\004\021\316\365\255\277T\375\234V\216\236X3\255\247\273K\277kc\357\335\002\200\370h\3769)\212\256Gb\244\355M\244L)N"
+	.string	"R"
+	.string	"M"
+	.ascii	"\252\366W\234\205\351\341\205\177\314\331\222\003\306\234!\002"
+	.ascii	"\207p\217\0169\333"
+	.string	"~\212\2530\371\264\205%\\\235\212\205%\3431\347\3748\027 \037\267\003\220\217K\342\247\353\311?\354\333\313\003\216\226\013u\3250\230sZ[.\r\367\336v\307\366\210}X2\252\343\303\177\243\372\236DAc\300\2149Uj=\346K\214q\302\217\235Vz\013\177\266\260\027\2579\247\367(\273\013\211C\255p.T,1s\206\006\036;&D6\275\254t\027\322W8\031\261\f1\217v\300=\372\261\222\355=\3366\331\236\335Q\021\t\253\331\323\036`\007k&u\222\374\312\265\262:\034\330\205Y\315\250\264\346\323\336\315@\324\230\375\033V\037l|/;'\2452\336\350\256\rN\320\267\276\237\020\030\026eO\304T\031;T\351\216\260\277\315m\261\245\272\223\352\215TsR\255\211\352\"\n&\240\n\321 \n@B>\t\026|<\004N@\242Q\n\212t\3103\022\225\200!Q\311\210\005\220\004B\bdB\362Ex"
+	.string	":\371B#\224\317S\300\240\004\321\350K\001\301\321\347\205\251\333\335rR\253\372ao\360zYn\273\217\033,\016q7k\325,\267\033\314JGJk\226\001\032"
+	.string	"}\372"
+	.string	"\226\"2C\203\021C\013\256\260a\364pD)#Z\331\202\317\031A\305\214\t\241\307\261^\316\330(\373\\\303\313b\005\004\032\232\030\261"
+	.ascii	"\013\227>f|\341\246Ze\0334a\244\244\230\256I\006"
+	.text
+	.section	.gnu.lto_streamReadTag2_3S32.30.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\361\036\265q"
+	.string	"\232\265\234'K \226\322\031\016\303\3076\264\367\177\270)\324\263\301\017\367tP\312\253OOV\256G\310\211\030\317 .]\022\350\214\306\314"
+	.ascii	"\300\257\226\3203\264:\313\317xoX\270m\320\322O{.\265N\026\367"
+	.ascii	"\217\303\231\240\355\350Mv7)\223\fy\002*\002z\002?\266<\033\232"
+	.ascii	"\226\217\313_\\\345\006\260\025\336\344Y\242\213\2077j}\2724"
+	.ascii	"-\303\260L\205\254iw\331k\333\324\344\352\244Ti\332\027\302\330"
+	.ascii	"XD\031\237,\224\247\260\224\037\036\267(\313E&\362\226\311\366"
+	.ascii	"f\206\327e-\275\357\231lz\356\004\355\363\360\036\310d\323\363"
+	.ascii	"\304\036\320\237;a\262\3651\343go\307\304\353L\266=w\302\255"
+	.ascii	"\242u\253\354l\314\\\237\357\311\302g/\267\347q&\033\334\235"
+	.ascii	"\236\375\333\362yL6\272;\245\022@-\272\273\265x\004r\331\331"
+	.ascii	"\273\325y\022&\033\235\231\025n\245\255_"
+	.string	"\307\323\331M\327\310\034\240\026\235\0319\2765K\332\n\366\300\330\020h\356b\020\233\316\227c\344i\240\264\224\325\347&\312\032\232\2736#\273\351\341\354\343l\272YV_\263\177s6\223m.\315Z\3714\241\3745#\266\355GtN\236\325\311\336M\326\333T%\313\316\n\270\323\364\343\273iS\365#\032\207\330%\201\233{\365\"\254\322\233\005\374i\332=\233}\362CX\235\210$\250\326\021-\202hC\021\364\246\320Gt\265\253\331\024\306\236\020K\330\34493\205\336,\240\253\251F\003Y\017\242\t\272\216\371%\313\320\324\255k\232\214\233\033\2650\3764q\332\223\244\242uK\315X\002z\023\006\237\246\363\356\321\034-\353i\240\034\200u\225Anm]\323\022\330\033\350\315M\273\321y\023}\212\363\346f\355\322=\255\206\365Wv\306\245\346n]W\032M\203\317\207\264}_\332wEg=\200\025IHGF*R\240"
+	.string	"\240\210(8\244\246B@\364w*\231\276\346\254=\177\351\251\355a\363\245\365"
+	.string	"|E\313\243\017>\005\250\334\300+\316\236\344S\341\312\210}y4\343\263\241\245\r\034\217\201a\244\237\323\f`b~d\224\303U\340\300\3100\234b\354=\312\346\374x\001\023s\024u"
+	.string	"\024}p\307\217\0270\033NT\203\262\013\007\207\220W\271\320\331\302)\227!\204\034\210\363\0034\243\324\211\035\375\362\250\345s\177A\346\230\205\177?'5\367\221\331B\007\r\236\0270\037~\362\331\225\356\3458\306%\364U<\213^x9\236\361\231\275&\331\365e\345\276%1\304=l\276\254\274}\b \355\204\005\277\266|Fx\312\372\360\224\263\361\213\310\374sZ\327u\271\353\013\354\313\342\273\\\300\356Z\331m!#\177\213\363f\2331+\331z"
+	.ascii	"\343\260\273t\350\272j\035\271\334\265\022\177\030\263\256\353"
+	.ascii	"\0017\337)Y\024\326\333\363\333v2\365\233\235(\352\235y\313\025"
+	.ascii	"o\311\324\027\342\302!s\375j\016\2743\033\203W74\373\013\337"
+	.ascii	"\260\301\222}\230\375\324y\363E\377\315(\006\243k\2302z\227\335"
+	.ascii	"\002_\3210\272\325\024w \362\336\032\261m\035/0D\337\tF\211g"
+	.ascii	"\367\0079y\312>\361\227 Dq,\342\376P\235\231\301\003\240*\335"
+	.ascii	"_6F\257h)5%\2668\320\t\\\026\243]\330\260P\034\303\024\272\256"
+	.ascii	"\353\215e\262\021\242\366a\240\2347W4\021\2374C\336[\236\362"
+	.ascii	"\037g\313U\312{\030\311\360\232P\321\314u\341\220\005-\257\001"
+	.ascii	"\264\\Y\320n\032\221\373\313\356/E\b/W\266e\330My\263R^\254\224"
+	.ascii	"\027J\312\353B\312\373$\345u\222\3626Iy\231\244\274KR^%)o\222"
+	.ascii	"\224\267\b\312;D\345\235Ry\2458\354\033\245\362\242\240\362B"
+	.ascii	"1\226\257\020\224\367\204\224\327\204\2247H\220\267\204\247 "
+	.ascii	"/\t(/\020\225w\004\225\367G\312\353#\345\025!\310\033B\220\027"
+	.ascii	"\004\224\367\003\225\327\003\225\267\203\224\227\203\224w\203"
+	.ascii	" \257\006A\336\036(o\006*/\006*\357\005(\257\005*o\005*/\005"
+	.ascii	")/\217\224wG\220w\202 \257\023\312\253C\345\225@\345mBy#Py!P"
+	.ascii	"y\037@ys\250\274\016\250\2748P\336\033*o\003*/\003(\257\r\225"
+	.ascii	"\267\206\312\273@\312\313\224\362\"\020\344\215\221\362\032\020"
+	.ascii	"\344\205\221\362\022\220\362\276\020\272Py\005Hy[\260P\n\362"
+	.ascii	"\256x\332\237\304"
+	.string	"`_\244\224\367(\3455z\232_\005\213}\211\370\370\r\262\327w\210\215_\225y\323!^\241!^ \312\213\242\274?\225\367Dy\315\224\327\227\362v\312\313)\357\277\376\002\341Q\232\263\256T\366\362V\245\tG\fc9\207\235\305\316\3073\330\331\353l\374o\367H\336\262\314%\325\002d&\255i\307\200\020\333\266\2710\224\261,g\341\260e+|%L\327C\251\304\235\013\317|`\247\016\022g\036\364\007x\336A{\200@w\320wS\336\200F\340N\026\231*\364nw\356\243\rp\373\355\270%QG\016\022\327A&G\210\354LZ\320\216\b!t\034\b\035\302\020\235}b8\025\004:\013\305z@\2403G\316\031\0208kn\314Fh \312/\235?z\004\002\372G?\216\360-\316\026M\300\021\024T=\216\216\026B8q\330\300\374kn\314t8C\226\002w\364\347P6;\2176\226\211\340\211?M\350"
+	.string	"AG\360@C\320\244\037\350\003b\322M\356\260\274\252\320\003bs\036\315\344\t@N\374\301\272{\023:\350\270\037&\350\272H\320:\334\274\251%8\352\246\276]\233\373\372\b\007\021\277\037\273:&.\034\312\371\351\224,%\340\205\006\211f\177\354\022J\366E"
+	.string	"\022J4\n\b\207<\332\327\205G?\210/\201\3769S\na\351\355\230\240\217p\352\t\216\324\330\340\001\362\f\377\334>1\234\324\r\332\033\352\3241ZJ\315\355s\013\305kS\250\323\347\336\347K\\\310\305\002>{\340\306*h\013\356\276tR\320\025,i\n\372r\350[\234Jz\311\022X`U\227#z\213\223\251\225\240|.\027g\346\337s!z\270\007\031\313\341\234\324\242\374\251I,6z9\211Fa\"\017\255\324h\033\013t\215\254^\240\271\210\325Y\\X\303*\224\213L\215\025\245\310[L\314\232\201\207j\322\312\215^V\363\361\2527\250J\003}\203\321\316@7"
+	.string	"\245\031h\326r\241\241\360\020\253X\205\262\026\017\357v!\013\361\314ye\255\275\353]\007\331p\r\223\245\243\270A\327\341\303\231\272\253\344\350\345\037:"
+	.ascii	"B\024\267\256\353\223\363&\273u\331\355\005\355\357~%\371\245"
+	.ascii	"t\240s\364\337\270\364\210\366\366\366\364\276t\342h\007\332"
+	.ascii	"TSD>i\034\375\274\247\230\343\322#s'\375\244\227\271\256\020"
+	.ascii	"\347,\327AX]U\317\273\317\214l\330Nz\271\313nM\333r\351\274\240"
+	.ascii	"?\221\r\363.\264&\316r\r\364\207\025\177\310s\274\013\207k\234"
+	.ascii	",\241\305\337\371\270yNM~\205\361aV\207W\247\305\203\316\376"
+	.ascii	"\262\303\327I\213\007\355?\300\227\0245J\375e\1770x\371^4O\271"
+	.ascii	"o\355\016\227\021\275or2\265\221\207\345\036\226\356L\320i\356"
+	.ascii	"\"\263\\\206\353\210Y\036\023D~\305B\222#<\250\256\232H\001\231"
+	.ascii	"\034\311\221\253)\252\"TV\250\325\025\021)\237yEd\007\013)\020"
+	.ascii	"\261\372Q]5\3311$\212\252\b*u+\252$E\242\224\234[\303F\215\033"
+	.ascii	"9\024\300\221c\006\013#QTH\256\254\316\235\232\201\204j\310\221"
+	.ascii	")\252"
+	.string	"!PL\216H\2550\025UD\212\006\013D\242\214\320\230BbEcF\214=\322\002\025\022\032WG\216 \241\221\246\r\3372\354\005\202\224\303&\356\311\264\312\322\324\255i\353\001Ws\247"
+	.string	"\372\313\002\353$)\265)\247$\343Cmd*Ok@\313!\211E\363\013\007\356\200\206Tbj5\201\0175\017\271-\016\344\333\363\2426\033\207\232\275x\320W\370\220\202\375\304\242\331x\341Pm\026}\266\025\365\224\232\275\206Z\251}sT~\032\222mCT"
+	.ascii	"\202\324X\254\204\035\231\3643\325C\246\306D\265\220\226\352"
+	.ascii	"\236\213B\241\237:\252\357\306\225\205\270\367\252\023\252Q@"
+	.ascii	"2]HC5\013i\306rB\377K\247\220\346\267b\336\214\243}B\233mEd\026"
+	.ascii	"\276\2026[yj\016\023\352\244N\373\305\035|\337$N`\013\365\213"
+	.ascii	"d\206\032\330<h=R\243\335sE2\017K\372\341\244\376\262CbG\302"
+	.ascii	"~\034\332\035\0242N\324"
+	.string	"F\036;\260\017\032\335\221\213\216C{\203\202\357\036l#R\0235\017;a\320\326\360\354\202\275NC\026t\037\222Q\220f\244\n6\273\tm\334\0256\213\021\265\260_D2\220Lb\351\242\371(@\007\333E\267\033W\330\257\317\026\240\177\203\212y\304m;\211\372\327IsE2&\364\331\355\004\227\336\226\363\330\205\224hJ\274\272\341\321\233 %\264\036\t]\002{\201Y\367\214\030\271O\234g\214\341\255\214\n\022\030\271P\034\210\004$\227-\027\036%\335\226\255\245\r\234\016)d\234\305\236\204l8v\237\233\2275\211\345Zu\362\361IT$\221@j\006\273px\263\221\272\335\212\310\"m6W\371\221\033.\275~\223S\355\"U\016\224\001m\f\236\035\\\031-k(\2126\350+\211\330\354\034\240e\240g\211\347\f\006\235\301\005\215A\222\276\240\377f\324I\340|T\241\177\343\240\215\364\274\345Y\352\301sg\r"
+	.ascii	"\271\r4h\273\036\255A\221r\237\270\316\0020kxvDC\"\364\351\250"
+	.ascii	"lv\037m\354\241\\\250\202E\250\322 )\220\262\01623#\"A\222$I"
+	.ascii	"\007r\013\020\206\"a\034\265\324\003\022\2403)I\003!B\210DdD"
+	.ascii	"$)H\212J\013\225\016\355`\204\2733!X\213\241o\334\023\267\"?"
+	.ascii	"}ncI\024L\323>!\003\374}\261\263\265 J\r\020\032\032\321\332"
+	.ascii	"\227\321R\354h\253Yh\341-P\006\375\252\\\027\337/\021\366B\217"
+	.ascii	"\252_o\310!g\365\002\325\217\301\022\221\366U\234 Q\177K\255"
+	.ascii	"\252~\345w\324\200\353sR\203[n\rk\351B\374.8v\"\316L\365\356"
+	.ascii	"\351\253\243\"\035\226\2120\264E\036O=\036\272G\224\242R\342"
+	.ascii	"\2439I(e\033\211\005<.\234\212\372\375\026\3554\231\377\222\024"
+	.ascii	"w4\361<\377\207\366N\306r<<\"\312\217\322\213FHP\004\b\027b/"
+	.ascii	"\334h_!\177L\325[\222"
+	.string	"\245$\310\351\217\034\224t\250\244OO\017\022\353\243T\376\372\363 \261\257|\356\364\023\275B\030\342>\201\177\032\031\364\315\357\262\272\274?\3464\247\367^\bOH3\233\351D\321\304\341T6\001\330\233l\306\260Y\3502P\352*?!h.\372u\3064\222.\002\324\033\234Q\227\332\b\350*=\"\364\337z\262\240Pe\244{\353\254$\231j\355\336\0010\242\300JY\215\006\331\322\203\362\264/f\322\f\212\205\256\222 \372g\"zO^\245\216\017\340\370[\317\037]\204\312\00563+\310\024D\036\302_\204z\r4R\016\313@H)\330\222\344 0\254b\240\266\330\030\311\234\354c\356+\021\335a\276\023\357+\351\312\fD\245L\231BP\200\224\023\267\365\320\374\2067__\n2m[\254\f\031I\331{\207\377m\304\225\370\230\331\004\3423\304%`Z19\276\200\271\206e\274\027O\222V\r\001\275N(h"
+	.ascii	"B\264\360\021\005E\240h\232)h\217\221\260\227\352HJ.LQ\3177\362"
+	.ascii	"\257\3432\220\323\324\020\334J\361\377O\272rf%spY\202\304\303"
+	.ascii	"\204\317e&u\227\b\3327N/\r\362!\316\230\3123(\271\276\002\035"
+	.ascii	"\344\2108\305\260Qe\333\004\334&w\036\022+v\031Cs.P\347\b\t\364"
+	.ascii	"\016JZ\300\354H/\312\343AF\222\332\214\373\226\335\234\316\257"
+	.ascii	"T\326T\265\221\276O\222\364\261\213\277\221\001\001\223Z\016"
+	.ascii	"\372\267\370\006\242\271\031\007HJ\r\036B\027\346\336T\211\201"
+	.ascii	"\350\276\260\027\210 a\266\272\241\320\250\316\016\215?\324\364"
+	.ascii	"\226Aa\363\321\003\302\237Mv\211\2108\371\021\007\0335pN8\203"
+	.ascii	"\363\241x\203\031\362&<\323\270-\276\325\334B\226\372\302i[W"
+	.ascii	"\223\251\330\335\314t\252\372G,\336\3649\005Z\2124<\0327akI\f"
+	.ascii	"\320A\001\0024\277\221\013\213\376\236\204\340\366Z S\357\310"
+	.ascii	";`\034\002S_\342\325\256x\255\020\bB\250\231\0044\342\260\317"
+	.ascii	"I\371\r\202e4\036\323\210>\222\256"
+	.string	"\036!\334P B\216\021\260'H\253\230\027\262\242\217\244P%AC\210N\251r\023\264vT\\\327\264\275dBD=\270C\335\320\272\213\177&\342\305%Al[\266\023$\311\313\351\326\377V\273n\016\324O\212\376\035:\305[\364a\313\177\207\376\202\214^\2119R>\023\330J\t;\266\272J;\315\2554\210\310Mt\f\326\216\006fa\025\343%\207[[9\354\332-\016\032M\213KMG\244\201\306\227\315\361{\025\037\274\206\24458x#;@\210s|w\374\205\344W}\372\023\217\323\324\tT\035O\005V\365\rx\202i\364\003\223\0172\003j?@\320\357\220M\037\204\241\335:\030#e\357\337\246\376\240\032.\226\003TG\270\330\201,\343\\\bG\333J\020\002\243\032\021.\217\032\261\232\276o\266\350)\024\354cd?m\307\001x\314\002D?l\\D\315\366l\235+\302S\016t\230\013lJ\340y\026"
+	.string	"6[\004\254\213P\256\220\335\215\276]\304\260\202&\033!\261\\W\022(\320z.\231x\327D!G\001\260E\003\225`\003\250\310~\274E\263\273=\257\265o\364\253\214\215K[\2248\224"
+	.ascii	"\257\003\313E\036C\373\020"
+	.text
+	.section	.gnu.lto_streamReadTag8_4S16.31.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\260\033Mj"
+	.string	"j\254\334%J \320Z\351\201\231\242\261\264\b\254\005\260;Q\"W\206\212\303\023q\227\260\345\316\344bq\026\3717\215\302\nT\237\317\022\350qN"
+	.string	"\305\304q:\256\f"
+	.string	"\006\332\374\361\002\036\351\331\003@Ye\232\034)\372M\310&{\357\224R\nb\002\024\002Q\002-\227\t\231\241\025\257\226`\231\253+\2731\\%\275\327$\262_7Y\300\027.\034\333*\242\0321\326\254\311\206q\266%6\225\271b\275\021\325\210u\223\355Cs\222(\001\233F\b\267\fM\213W\314-\203\220FC\246"
+	.ascii	"\0231u\214i\354!\f-\226\24414#\265d1\352\202T\034\026\3022Rq"
+	.ascii	"U\004\311H\305\231\t\004\344\036#\025W8W\307\024\346\212{\005"
+	.ascii	"n\026\372O\214\237\021\346\337;'\005j\266B\237\021\366VA\346"
+	.ascii	"9\345\022!\330r\305|LvW\254B\357\2255\224\375\230i\317\373\026"
+	.ascii	"\200\224\347}\200m\225\231\266\317\332z\314-\023i1\334y\310\263"
+	.ascii	"\273,\367\336\226\033/\275\026</\234U\024\250\023\332U{\343\021"
+	.ascii	"i\273#\037\301MSP\203\3261\266\312\215\002\021\346\266Ue{i0\035"
+	.ascii	"\206[\246&w\205d\034|)B\025\345\220\207\225+\252\022e\335\305"
+	.ascii	"\b\323\354y'\260\212\222X\307x\3573\252U\346b\246\267+\177:0"
+	.ascii	"\304s\323\274\270\321`[eZ\273jg\356\272\336R\326vG\272\347^("
+	.ascii	"h\240\367>Cp\025\333*?\033hm\225m\237\265U.cF\354g\224\213t\266"
+	.ascii	"\261\201a\274\367N=\007\234v\372l~\362\262\206zr\362\320\304"
+	.ascii	"\264\244\224\304D\352pd\304\241\210hH(\b\350\307gC\017\317\316"
+	.ascii	"R'\247U&Y\344\252\246\357e\334a\332\341\026\315\032*\3159s\205"
+	.ascii	"IG\233\201)\t9\2753\315\267\346OH\254\r\340\306\264\223\207&"
+	.ascii	"\025\232)\005A=_R\312\353$\274@\024\234\271\327H\035\216\354"
+	.ascii	"\332hK\264\3169\024\231\320D%\020j\361!1Y\\(\b\b\204\376\371"
+	.ascii	"\300\320\003\367\331\320\363\242\314\232'p\0354\217\224\303("
+	.ascii	"\2763%eF\233N|\211\304\202\343\322:I9'\016\327\264\252Z\223V"
+	.ascii	"v\264y\201\233N\262\322d\342I+M\fRf\264)\347,\022\353\257\323"
+	.ascii	"\022\244$\3265>\201\333k\344\334\312\363\244i\201\362\215m\345"
+	.ascii	"Iz\322\244\222\256\255\327Kwa\332\336\224\264\332gc:}\242\202"
+	.ascii	"\006\003\336\233\222\376\364\303\234\240\222\345\233Z\n\344\202"
+	.ascii	"\006iZ\257\335\355\r\315\035\211u\357eo{\203k\376\320\314\276"
+	.ascii	"\310\314q\314DE\001@\335\2468\242W\274\001\377`\326\260\240\251"
+	.ascii	"\037\\/x\205O\324w\262\177T7_\263\214}I\324\250^\325\032\351"
+	.ascii	"L\302\266\247\272Z\357\274\233\277\257u\207\351\002\234H\330"
+	.ascii	"\366T\356\"\253\277\233\322\r\361\271\215\254H$I\324\027\337"
+	.ascii	"\357\306\235\256S\n\033\025\273\310\332z\254\345hEv\016\215\016"
+	.ascii	"\027\277L\210*\035j\001\341\337\311,~\305wy!L\363\032j\270\031"
+	.ascii	"\213G\222\302[\375\350\305\336{\253\270\035\313\356\rn\017\216"
+	.ascii	"\254\255\256\370\235\030\354\316\374\221[\257eh\211v^\263p\243"
+	.ascii	"kd#\3007^3\317\374\r\377\360=\033\025\257\277a~\242\371;\317"
+	.ascii	"\\\221\203\362Can\235\217\264\316d\255\363\330\322Y\310\3229"
+	.ascii	"H\353,\326:\003Y:\377X:\207\265\316>Z\347\036Kg\260\2453\217"
+	.ascii	"\326yG\353\254c\351\374\265t\316\321:{\265\316]Kg\256\2453\216"
+	.ascii	"\326\371F\353\274\300\322yk\351l#\351\\c\307\231\306\216\263"
+	.ascii	"V\353<\243uN`\351,c\351\034#\351\fc\307\031\201\035\347\003Z"
+	.ascii	"\347\027Kg\003\\\264X:\263X:\257\350gwV\353\254\242u\036\240"
+	.ascii	"u\306j\273n\001RX\2418a\242*\351\\\302\235\001P:"
+	.string	"\223P:S\3518\217\320q\026\321:O\3518K\3518\207H:\203H:G\3518\177H:C%\235\237\222\316N\356\354A\351\334\244tf\322q^\322qV\322qNJ:3\223\316HI\347\016\356|\244t6R:s\310q.\312q&j\235\207r\234\205\222\316AIg\240\244\363\217;\373(\2357(\235{r\234y\272K\363\216;/\225\316:J\347\034wV*\235\223Jg\266uF6\264yugU\351\234*\235\277\2774{\3375wK\260u\031\327<\021\336;\301#\234[\250\256@\245\241\335]\272\277t\337u\312\334o\270\3414v\rWK\242p\323\r\rVK\240\314\325\335\265f\222\315\331\226\230\246\331p/r\337^?\364\275\346\030\364B@\037\364\275\006\307\352\201^m\303\346x\026\307\353\333\357\205d\026@h\220]\027\327k\301\361\\@\206\254\345$\374\3400\344-\027\001\207\241\231\027"
+	.string	"}z\026\370>\344q\265\276\361\243"
+	.ascii	"\317\377l\370\254\367\351\371\r=7\236\347_\r\233\343\031%\026"
+	.ascii	"\300*\033\356\026\330\372\020l\374V\317!k9\025\036\033\207\274"
+	.ascii	"\345\037\3308\204\341\214\233\2356o\235\003\260\331\230\270|"
+	.ascii	"\347`\215.6k\020\2414\276\206o\320ZOC\305k}/\272\263\007x\025"
+	.ascii	"m \200#\306\366b\247$\354\264\221\325\352\007p(\335l\026\025"
+	.ascii	"\327\364\r\2723\300\262\266\247\016\207\215\250\363Y\277\314"
+	.ascii	"y\235\034(~\320F\305\253\363NF\"I\322&\360\355\246Sh\031\266"
+	.ascii	"=\245\253\365\214wc\3664#t\2000\236]\256\207\f\241\037lS\344"
+	.ascii	"~\323\310\270\350G\207\300\303\3706\334y||d\354\247\365\200G"
+	.ascii	"\340U0ksX\177\3007\234\366Q\303\366\321\212|\254\270;\300\350"
+	.ascii	"5Awv\347\307\366\323\332oZ\213\356\314[y\327WC'\351\256$6\262"
+	.ascii	"\271\031t76\363\354I7c'?\353\225^A\263\237d\337\343\2609\236"
+	.ascii	"\001\006yZ\203\301O,\335\333R`\241\b\277u\306#\377\325\2549\376"
+	.ascii	"\340\371Eg|w\341n\323\375\327\311C\277fc\342Y\316_\0022\336I"
+	.ascii	"\214\227\001\304\227dX\245\331zZ\267\033\326r\fz\2604\371S\276"
+	.ascii	"\223c<\213\357\3622\330nx\313/\360bc\270\241\241\r^_4\271\326"
+	.ascii	"'\276\237xA\263\304\343K\3229x\\\n\365\330%\336\226\250f\227"
+	.ascii	"\033\"\003\350\360\336\353\300\332\252\320\341\342\331g\275\372"
+	.ascii	"\275\206%m&\263\376\247\337kVR\374\277\017\2629.\361Lp\t\032"
+	.ascii	"\306\2231\321\314\343\260\036\362\235\274\204=\356\361\252\300"
+	.ascii	"\261S\340\354\213;EL]\226\t\330\233\335Gk\253N\252\\:fG\302\314"
+	.ascii	"\210\354\275f=\307\336v\325\232T\271\367B\265z\344\373\257\235"
+	.ascii	"N\315\035\371\333\310Z\365G\236\235\315\0024\177d\345\b\321\277"
+	.ascii	"f\315\3645_N\357L\b\253\267A\2008\203\333\003n\257\265\r\335"
+	.ascii	"\230\030\360\036\201WdC\300\272Ru\b\230\n ;\300\310\220#\272"
+	.ascii	"\234\252\313\033\3501\261!^_a_d\354WXW\027\230\213/\006\270x"
+	.ascii	"(\307\276t\350 \322\265\222}\021\t\343b`e*\022TU(D\230@!e\364"
+	.ascii	"\203\353kl\b\331\312^Rc_9\304\274\276r\334h@\254\313\207\027"
+	.ascii	"WX\327\024\0200\256\037S^cdSRN,\026\344klj\210\230\330\330T\373"
+	.ascii	"<\353\207\302\034\246\t\030\274\215\211g\217\306P\357tj\301\251"
+	.ascii	"\305s\272~\n\024\317\351\316[\275\033;\231\360?\361n\315\327"
+	.ascii	"Q\0358\271xN\323\376\252\024\237\205&"
+	.string	"\315kH\326\365\335F\305\252\357\273\023V\337]R|CS\276'cw\247\367\336\373\364N\2561\202\007\261_\252qa\333\013\362\372\271\234\031\317H\253g$\253G\361n\354!\r\362\264D?\273\034OkF\236xN\221|\255M\270\370\276k\346Y\325\273x\325o\315\261\3057\264\231 :\305\267\230C\343\353v\202\027\202\211\357/\355\376\206Q0V\224K%eL\035\343}^\250\376k,3\217\343W\234\232\200|\0132\271Z\213\211\345\221P\"n\304\227 \361Y\017"
+	.string	"\325\223\240\022\361R?b\352E|\213\375T\210\377\360R >\304#\343D=\b\262\217\372!5P\377\341\221qr\236\036\352\351\221`D\020\373\356k\241\351a\003 ?~L\330\377h\022d-\377\023dR\032\373\016Lr\265&\013\023\344-g!L\220L\013W\310\276\375"
+	.string	"\311\334\245\2711!\317\027\344\205(\005\262\226\357%\005\t\344-O!H\340\030@2\227\371\316n9\2753V\220\216t|G\215\\\255w8\225YYz\247\246\317z\017L\337\304\244\364I\277\264\343\225\276\231\237\364\317~+\3223}<\322\253\203y\030\354\370\356+\204v\030A\307\327\213\311\361_GQ\326\362\273\002\246@\033\025\215\212z|\023\022\271Z\373x\267\034Q\336\362/9\242.\024^\340c0\360\311\001\204\036`\177\002\217\007+\"d-\347B\304\203\220\267|\013\017\3022\203yrCy\025(\351@:!\240\256o\303\037Wk//!t\217\035\b(\372\016F\237\365G\034\336\210\003\321\013}\3217\233\222\241'\n\202\024\250\222`%O\342\214)\222\021\221\240I\2224\006\222\013\020\b\003Y\036c\346\001\022"
+	.string	"$9\007#\025#4#3A\222\024\264>\215\001]\313\320zK!\030&Q\036\314C2\350C2\3726\322\353\333a\037\220\354\343\254\265\314eR\345\2034uP*\034\270GCE-\307\034Z\360\246F\341\370Y\312\223~\263\366\t\374\212L\327\376(\267\347\345D\303s4,\002\355s\026\272Y\210L\376\340\264\004\360\346\225kf%\225\212.H\tz\230<\374\006\324\207\257\242\330\360X55;=h\361_kD\227\016i\306\226\322\035\342\2672[\237\005!3\234eV\032v\345\260\003\223\223\225Q\302\323\324\275\016\205\257\330\321!\025\342\333(Q\335\260w\342\234\336dvKR\235\tKm5D\t\264\200<\250D!d\252\234\005\316\t=:\017\214M\264\307=(L"
+	.string	"\332\213AU\017\331\232?\036\204\314P\226\031i\302\335\320\240\034\243\035\211\177d\3222@o\016\2533:\233EPu0H\226\242m\b\025\031\"H\242ja\357\316\261\336$vN\241\330\b\370B\247O\375\210\361\bUi\315p8<\030g\264\357\211\t\252\311\202>0c\234\335)\231\231\316\335,B"
+	.string	"\240dJ\325\320\006+H\17721\260R\250\026t\021 \241\306\360\367\346\220v\362\260\007k\213\244jDL\2521!Hjc~\267\006"
+	.string	"1\337\310\256\\\006\314A\347\242\335\334\243\"\330~\200$5\303\333\233\303\232I\330lIe\212\322\302\375\250r\363\225~\271\226'\005^=\324\207d\262(\327\264\321\302J41\230c;IO<\345\262C.F4\246\203>\232\325\305"
+	.string	"z\bu\362\211\352\251\371\202Z\234D\322[8\201\362F\245C\322@\022e&\233\215d=3_\303G\221\252\2434\237\350\0353\300\247\303\231\301\251HX\243\232\274\227\037F\004s\302\261\200\361!\232\320\221g\365i\341rm\224\211)\0053A\371\266\351\307~\b\346\364E\231AAKD\2204\"~\"{\ra\005s#\364\234\321\230q,'\211\016~*\255>:\330\220\r\210\177\030D\300\242n\202H\007\215Av+\201g<\230]\312x\240\340\346\333\372\356\222Lsy\004R(\322\271uc\001\354N\257\275%/K\334\017\246+d"
+	.ascii	"gU\b\2348~\232@\323\257\006\203\033\241\f\241\013\003\363\212"
+	.ascii	"-\341%\327d\2733\352\370\214D\200<\214\3666\204,\006\332\330"
+	.ascii	"\306BD\324\343\347\236L!R\245\370\016\307\016\236\003\266\323"
+	.ascii	"\315D\350\203\315M\253\033\211W\211[Z\366~M\177\256=\200U\330"
+	.ascii	"bb^W\225\301!\027\\$\362I\023\352\347\362m\236\032-\200\320\323"
+	.ascii	"\366\351\302*\254.\376\206`zX\345\022\200)b\375MP=B\373\321\372"
+	.ascii	"\350\350\345\204\330\236J\333v\333\342#r# bw\007ZuD[G\364\244"
+	.ascii	"C\270\247\340\311;\tH\037\272\217G\243\317\345\023\tDbX\254\334"
+	.ascii	"s\234B\201+\t\035\006\264h\304\007\247\r\354\355\345\253WU.\361"
+	.ascii	"\245I^\264\033'\311\216\263H4\246\024\026\006\234\340\215=\374"
+	.ascii	"4\304@\bmA\001!Xa[Y\t\356IV\017\261b\315\003J\\\005w\341\343"
+	.ascii	"@\032\343\016\350\310\240\306\032\202\244\271|\034\024\r\200"
+	.ascii	"5\tC\304\023J\340\305\301\231\205\277\235\261\244\223\362\206"
+	.ascii	"\005\312\026\366\222\001S(\311\325\357\245Wp\247\330\026#0\235"
+	.ascii	"8O\2433\262\201Mu\313\007}\241\223\035L\260*d#\017\235\303 \365"
+	.ascii	">c\307\302\310\200L\267\263?\325\035\n\362\027\310\2235k\003"
+	.text
+	.section	.gnu.lto_streamReadTag8_8SVB.32.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\207\005=%"
+	.string	"\252D\024\017G\200\234Q:\263)\340hfe\251\210-\215\317K\315\232\262\201\355LB\261f\351\252@:\312\211\352\214\3370\220\366\216\233\230)}\352\242\tW\235q\256\233\234HGP_a`\030\2225'\252\333\3146B\b!r'\031\336"
+	.string	"\324"
+	.string	"\343"
+	.string	"\367^#\346\251?\023\230\271\343\316\026k\340\002\\a\326:B\375\231\353\262\273e\376\325\2674\035\313\306\205\356U\"'\314\275E#\266\240\376\344\342o\350O\365\003\320\237\334\304\\\347\305&7%\322\201\322\"\273\367\352\232\t\247\313\345ry\263x\256\331\246\003\325h35EO\263m\023\377\306\201\314\324\211\207\325\305\244\210\230\030\312\220c\250lM\301\222\251!\247!\231\252\372\314|\200\024\263\347bRU\346\215\207U\324\217W`EJ\210U\357\365\334\2261j\b\344\351\201C\2166\230\022|\3035\004\362\323|PD\215\017"
+	.string	"C(\363\306&\311\234{9Y\023%&\357 \231\"\36261\200\271G"
+	.string	"C\241\231ZYV\271\361v\035\006\255M9\334{\331F\r\247\316Agf;\314\274\304|\342\002B[\3067>\304\032dr\354Z%s1h\233\310\374\rf\214\b\341V\302\254Z&R-\033H-\027H-\023H-\343nC/\376\002\332\262\320\261~\333\273\374Amy\246\246\3262\212Z>Q\313\346\277\316\375\255\263m\313O"
+	.ascii	"@\212\315\021\237{y,\373\334\260s\314\224\177\375[9\344\216\217"
+	.ascii	"\\\313\335\3311\177q\031\365\206\224j\324\362\203\274\367*\251"
+	.ascii	"\367b\2561\323\275\360\273N\261?X\356\2755>\227y\251\212wJ\203"
+	.ascii	"\025\234+2\006\301\335\355\271\230\216e\243q\\\023\214S\230+"
+	.ascii	"\262{\213F?\371_\230\230k?\355\215\\\313\271\331M\250\320\364"
+	.ascii	"\255\031\352\245\222\032\211}\220\367\026\213~r\013\316\241\331"
+	.ascii	"5\227g5\275\013\2271\003\\a\022#a\002Yr\232\250\331BQ\035\257"
+	.ascii	"\266\001\013k\243\031\247\241\332D\006\003A\202c\240?\r\364\335"
+	.ascii	"\254U\005zM\214\333\243\306$\034\327\005\272\265\236\256\004"
+	.ascii	"O)79\266\340G\036\262\264\211l\317\242\377x\017Z~\240\216i\321"
+	.ascii	"\273W\332Z\347\344\317@S\035;R\003m{e\213\242P\302\222c7\201"
+	.string	"\336\213K\374\214\t\033\234\003p\362\364\264\f\350\341Dv\022h\\#e\201\tm\031\357f\b4\221\023Nz\231\030\352\275\327\002\237\314\211\036?\212\r\364'\256mq\260\356u\021Y\272\376a=\222\304c\353s=\001\320*\331v%14)C\232@]x\304\336\3741#R\330\340D\341\327@\177\3325Qc@\273\344\232\26553\013\027\366Qo\022G\204}\203\201\272\356\210\245VJ\234t\023\031\302\203\032)+N+\376\353\241\340\365T\240K/\230|\035hJ=\246\026<\031(O\2400\301B\206\b\0272\034\035p\301\353\375\226\224PN:\372\365P\370\222z(L\320\360!\261H\342\265@\322\275X\301s\241K\372)\351\216\030\260\017F\357\247[\362\371~\272Z\021x\016\300\016\0025\321\201\034\332P\267\332\353\2177\252\242\335\232M\324v\332kP\253\335A\215\320\226=H\227R,\265V\311js"
+	.ascii	"Z\345o\374\203\254\3110\240U\332\337\274Md\tO\324\242\333+\260"
+	.ascii	":3\241\236\365\312|\353o\245}k\024\314\323\237\241\376\027\204"
+	.ascii	"\253=\324\246\236\247\"\020V\345\354w\213Cu\266\200F\373OW\314"
+	.ascii	"s\032\324\354\263\377d%h\227\254\266\331\367\003\365\007h\227"
+	.ascii	"&M\250o\344\0072e\217\217\031\002\224\250\177\374s<\tc\250A\034"
+	.ascii	"\344\034C\b!3\"\022\210\214\020\347`\002\22114\036\020`G2TPH"
+	.ascii	"c\244b\357!\033\324S\344\256{\032\213}~)\212\213<a\006z7,\215"
+	.ascii	"i\031\340\035F9\352\0050\216w\310\315\373\002\3516G}\226\t\251"
+	.ascii	"\266\0313a\3461\323\001\342\214\341\325P\207\261\002\342\303"
+	.ascii	"\315FlK\272\222\251PJ\223\346}\254\230\207\360\313\001\246\357"
+	.ascii	"*)R\365\225K\303\317\225\347\013Z\342q\242t\r\016LT\312\320\331"
+	.ascii	"\275jg\323{\227\245\2247d\031\236fERR{\025\262\313U1\211Q\213"
+	.ascii	"\034\203\f\365\241\355\312a\354\026F\016Z\310l_P\221\037\337"
+	.ascii	"@\002\241r\221a~\321\313f\3458\376_\020[\005\324\230\f\250G\337"
+	.ascii	"\006\"\376\002_)\027\t)-\327\261\346\222\247\323*"
+	.text
+	.section	.gnu.lto_isFrameMarker.33.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`L\001\325\f"
+	.string	"\226\227R@ Q\224\016\274\"\r\315!\333\302j\341q\370\220\031\321dlT\300\342+#\202VY\001\203\326\352\267T\304"
+	.string	"\b%\241\225M\310"
+	.string	"@Yb\367\265\036\fQ\013g\004\030\005\200\371\215\354-eJ\001@"
+	.string	"<"
+	.string	"?"
+	.string	"-Bv?\004\306L\036m\373\262"
+	.string	"\344\320?\020%I\347u 8v?L?<t\250\031\362\277\272\003\026\211\032\236It\030\340\naew5S\262\331]\247g\332p\307\333n`\373\201\375\020\001Q\257\277\321\261H\3312\245\303f\016\373\023\245\246\354\303\335]\253\007\333\351\353\252?j\032:\255\351O"
+	.string	"\234hdd\354\226Z:vFd\211\260\r\262)\366\200\021\031\315\2538\353.*\243l\371\237\007\324\324\211?w\370\317\335\025\251]\300\370^\342+T\244"
+	.string	"9w}\370(>\316]\2177a[\344G\331\026Io\013<F\365\246\313\021\247^U\323F\307!$Uc\230\305\271+\276(\270`4\t\030h,\002\262;\263l\037\217\226}<\0202h\035\t\031gB\007\253\020\201C\001\313\266\013\230\205\2005\013\237\r\303\240i\033F\371\3660\r<\365\300\241j\260}ie\244$C\275\364\253\347\351E7\022! \200\002!\264y)\257\300\257\007\022\320\207\275\246 \211 \340]\203IB\271\204s0\017\261\333\301\027\224-1.\303l\223\325\227$\r%\352\200Y\23304dC\260woDJ<b3D\235"
+	.ascii	"\314f\265m\323Bs\347\226\026\223\001"
+	.text
+	.section	.gnu.lto_findLogStart.34.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\211\003\205\032"
+	.string	"\206\361\257I\260XQ:@a\220|1\317\007I\204\201\361\332\360\223\372\345\221\255\254\361\017\275F\026\277\013\2629\334(\352)\007\263\215U\252\3665\261F<\301]\373\ni\027N\360\272\3505\341\f\352\3710\307\032\243\331F\b!D\312$\003\237"
+	.string	"\222"
+	.string	"\226"
+	.string	"\270\247\2461\265\362\030\\\\\017\b\202<[\201"
+	.ascii	"\365\250\307\324\241\274\210`\212g\371El\027P\253S\230'\265\362"
+	.ascii	"\032\254Ny\361CN\004\305\332\n\360p\344X_V \371\314\324\312s"
+	.ascii	"-\357\004\306\213\345\007\214\027\373\306\226l\273\252$G1l\266"
+	.ascii	"\355\211\256\202Rj\372\357\234\264d\304\345\001\0339\246\223"
+	.ascii	",\244\034R\272\\\323G$\326\322\215\305\024a\330##\013\213\233"
+	.ascii	"\245\243\360]j\2109\017\245&\356\377\276@H\025\"gt9\2463\351"
+	.ascii	"Sk]\306-\345\276\253\357\356\216\335\315\261\333\t\002\375(\244"
+	.ascii	"5E\034\334\261W\375\016}7 F\034\\\023(\244\245\312t\241\321\253"
+	.ascii	"\352\373N\373=\374\241c`\020\n\247\2157r\0163\2128\315\276\367"
+	.ascii	"\025\260\007T\3454\273<\"\356\335\356uR\324,\333N\2736\346y\377"
+	.ascii	"\352E~U\271\274\344}\337qyE\2217\\\336\016y\271y\177C\202\213"
+	.ascii	"\031\251\235\247ZW\004\325T.b\224\035\367\375\273\307i\301\263"
+	.ascii	"?\262\377-\013\307\205\317\246\342\006\fYy\361\273(\366\275e"
+	.ascii	"\341\340xv\215\234x\275)\251\002K>\266\330a\324\177\027\255\350"
+	.ascii	"\306\366)\3424\017k\255\265\264yp\263m\3727\037=\300 \234\004"
+	.ascii	"M\320\006\331\273\245\375D\263\313N\332\275\001J1\3174\2312\366"
+	.ascii	"n\031<\274\341?\375O\007\236e\255\267\343\200\312\333L\301E\263"
+	.ascii	"we3"
+	.string	">.l\236\031&\020\n\225)&j\304\336\255\272\373\272\336\026\n\0370\232\335\315Q7\037F\034\274\227\030\270\036a\357\366\266\321\354\264\007\346\210\321\254\t\034\002e\266T\314\275H\276S\306\261w\321\021|\234\331\255[\023\355\233\003\273\232\301P\241\364\f\332\320\242\275\204\320 \230,C\313\304O+=c)\n;\323V\253\026\004$\023\002\321\2520\241\006#\021CS\r\255\013=\"\036T\003\032:1\244\347,}\2050cCg/\204\b\020tv\034H\330\3111\360\252\275b\341\302r\3223\206\302\316\330\207\022\350\317\f\366\022\372q\r\311^!\\\260\224\346\312Q\260\250\2103u\325P4u\261x\365\355\264\\^\3119\354\335\302\027\035ON\372J\376\337\313)2\300\261lr\311^\237\2426\302\242\352\335\002\270B\3324\371\202U=v\222\330\315\243\247\345\001= P\002A\250\270\003\322\300cUV\262="
+	.ascii	"\025\311\036\255\367M\217\t\017\331\2508\304r;\360\321 \375\006"
+	.ascii	"\346;\032\346x\220\001\037\\\361\265:\006\2121\356\366eN\313"
+	.ascii	"\030\b\375\321\0230\f\016\327\240\271h\255\267\212\t\267-vXc"
+	.ascii	"\207k\367AAca\013\215\236b\274xc\323\025Z!\270>0\353 6\b\347"
+	.ascii	"!\366\021\331\001\267\325D\241!\377\323\362-K\300\r\024\027\027"
+	.ascii	"2\016z\345\331\300\004W6\005RS8\306\016\357K\300d"
+	.text
+	.section	.gnu.lto_blackboxDecoderFindLogs.35.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\261\003\375\032"
+	.string	"V\263\262I\260\326M:\f\034a\034/\020\n\263\355:0\222\304\001|\337\300'\242qF\346\233\nn\335\346\366\334}\320oN\303\2530\305\342\324f4\365\317\351\322\377\307<\330\222s\313Le\366\177\224\007\312lF\2725B\b\331r\247\024\235"
+	.string	"\222"
+	.string	"\235"
+	.string	"\363U\356\242\001\352\021\213\030Bj\255\b\254\341\t\267>\202f\002\324\243\036K\026R\340&\017\241*\025\312\2136\023\270O\373S\337\321{p\350\265Z[\024\021Rk\020\201\035\224\027\035,/\365\034=\273\213\006\237\200w\212\372QQ\251\265\336h\0363^\244\177\031/\256\223\311\341p8<\r\336t\366.\322\235=\037\3534*\207V\022\220\350\"%\221\226`\270"
+	.ascii	"\221(\004+_[\027~*\001\215&\235\301\364\275\360\006\244\236$"
+	.ascii	"\001\231>\311\b"
+	.string	"\265V\317$\240\211{\274m\020\266G\330+#u\206\331A\242\271.\354Cx\262\362\345ma\313\334\307\037\003\363\362\252_@\355W7\355<~\227\007\377\226g\335\263[\3352r:FN\227\3444\371\351q\234\026w\232\216\323;NOq\37234\246$8\255Z\227\206W*\022q+\306\263~\253\377\352k\337\306\205\363\203\370B\317l]Y$\234t\f\225\027o\367| \307\362\3146\205\263\257\206^}%bJ?\034_\265\006\203\200\340l+w\225D%\312*'\251\257Zk\315E\373\224\266\0328\032?.\2439\024\241\254\250s\206y\346\bE3\354\264\326Z\251\314(\2634\n>\333q\007\030\361A\031q\211\353o}\020\212a\362\302\017\032/R\252\244(_q\251\327n\314\322\275\017\252\274\211\214sw\247\021\037\r\331\316\375/K\321\034\032fou\340\262\205\331\365\362\251h\331\331~\251\227\357\006"
+	.ascii	"!\226\335\037C\220\200\353\332>\3534\262I\333\226\265yv\363I"
+	.ascii	"\265\025jBZ\"_xjcE\r\253a\3204\205`\264\375\325i\212f\230]\266"
+	.ascii	"ei;\275|PFs\350)\234\242$>\317\351\321-P\217\207\235\004\235"
+	.ascii	"\335N\311\323\331M\b\221\343!y@:^\206\f\024tv;2\235\210\r<\352"
+	.ascii	"\005\f\0268\270I\360\340\306\206@\016(\227C\215c\363\243\313"
+	.ascii	"\331\341\350r.\204\330a\340\200\223\333\301p\353\331\220\343"
+	.ascii	"\271\341\374\360n6\005\274\363\321\375\334\200v\273\237\333,"
+	.ascii	"XO\251l_^\366\246\251h\215|\254\313\264N\210\353\302\rp\254\314"
+	.ascii	"^\n\330\221Y\333\331*]\370\330\027\230\223\205\331c\275\\\002"
+	.ascii	"65k.[%w\030c+\241\311\321\264\342r\311\215-I\365C!`e[\356\214"
+	.ascii	"\327/\312\037\032gK\3568%C\25014\344\020r\204\0304\201\fIPIg"
+	.ascii	"\f\220\002\231\272\271\r\020\200G\332\302\260\031Y\322@3\342"
+	.ascii	"\001N\276\334/z\236\025o)\226ybzV\221\0204\007\260\302`XN\005"
+	.ascii	"qc\233\343\211\bY\370\tk)\357\026+\221\0301\003\212\t\255\250"
+	.ascii	"o\017\245\236\220\n5\260_\316\240\3507\256\250\016\026\205f\352"
+	.ascii	"C\017\323\333\216\211\266\230\342M\244\201\030(\370\003\234T"
+	.ascii	"\310VC\3424\262\302_\301\026$9\310\230\001\210\2223\261\016\377"
+	.ascii	"=:\254\247\001"
+	.text
+	.section	.gnu.lto_storeHeaderText.36.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\235\002\315\024"
+	.string	"&f\207I\3200'\0350\207\020\337\260\342\215\373\030\370R\322\371\206r\225)\353\351\323\354\214\3469\371idBA\350A\254\355\307\375\330w\364\336\303\232*{\370\352a\240\003\036\332:\036\027\247`\217\\\313\177g\245*\2425\262\211\224)\005s"
+	.string	"i"
+	.string	"t"
+	.string	"\265piG\202\202UmG\f$\001f\017\323\006\t\260\313\222\251\232\352\225p.`N\"\032Qs\216\013L\203]\332\366\217\216\224c\036\311\370\013z9=\375"
+	.string	"w\3149\316<\236\200x\t{\210x\271E\347=\\\345\371:\017\035$u\365|\036\276\241\211\r_\b\231\217'\f\351\200\003\353\300+\220\257G\365\2652\347\264\366|A\267\274\355\007\266il\255\n/q\351\343\210\227_\021#\245\035\355\362\201\217\260e\265\2455\225\313\036utG\330\017\347\022\331\037\177\331\233\356\330\227~\220+\375\037V\303\244\372%\325\242TK\253C\251^\251V\251\376\200\003CB\"\212\2406k\234\034\272zL+\351\302\304\233~;\307\007\372\243DG\315n\342\205\023\3048\203hIQH\n.\375RR#2\242/uA&6\303\347\211\227#\277\034;\261\r\367T>'"
+	.string	"\244P\220\225ml\355\227\030}\317\b|V\307\032Dq\025\3337=eh\347-x#\277\236\355\f\207\2221\371\321\374\twi\340\027\333S\365>\210p\r)\226\f\rRk5\277\023w[\230\252z\224\207\377\235\250\273+\247@\366\253\033B\371\b\361h\227m\013_\261\243\371N06\2609g.\267\034Ng#\302\350^jn3\242\356\346\246\013\215\322"
+	.ascii	"\205\246\302 E\345\244\300\313\266\223\334\315\005g\273\271L"
+	.ascii	"\270\301\265\310\330XfZf51,43[\316fv\222\300\270\n\267\334L\207"
+	.ascii	"\303\345f\037\343|8\227\310\257\237\030?\301\215\355\201\207"
+	.ascii	"\220\025t\n\352\243\016[ \333\260\365\312\316\362\204\032T\361"
+	.ascii	"Z\030;\331{Z,.\356k/W\334\275\361B\256\314HI\203GW33 p\"\"t\367"
+	.ascii	"\177/\2149\201\325\013+4\025\fO\271\275#\264\241\"\030i\201\\"
+	.ascii	".\336\256\3677\236\022\346\244\330.C\251I\r\335y\007@C8\tW!`"
+	.ascii	"@g\034\211\310k<\312\321\333E\270Q\220\327\303\355\r\263\361"
+	.ascii	"\022\277\306\240h\031\240\225\326\020\307\313\242\325nb\204T"
+	.ascii	"D\177\203G\245$ \264\350K*\334e\2140\f.\\\230q\304?\033\331\345"
+	.ascii	"\320\\f\017"
+	.text
+	.section	.gnu.lto_parseFieldDefinition.38.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\026\017\345J"
+	.ascii	"*}\364\033?@\244N\007\357*P-\347\200\003\241\nNW+\335\013\001"
+	.ascii	"M\346\001\027\023JH\336\016Z6l\f\033|\336DA\356\200\035\n+\f"
+	.ascii	"~\353gNw\343\373<\300\363euQ$v\333{'\231R\257\001\223\001\266"
+	.ascii	"\001u|\\\274us\227v\215\352\222\365\330\3354V\204\030N-sP"
+	.string	"\254F\365\\\377bt\037\275\305\236\306\325\370\032o\343~}\\V\373\300^\036k\357\231\303\267k\3169m\016\233\246\267\2451\374b\b\210\236\254n>\032o\256R<s(wu3BY\335{bl~\243\3466\fi\fQ\313^o\243\314\262\314\370\231\247\243i\300e\017jf\303\342\213\363e\312\333&c\227e\262Z2d\202a\\\262X16\234\222r\2171]\230P\262\036wcEx:\265\314\223\362\231\035\264\276\234sU\253x\275]\312e9\356\366/\256\367t0:\\\231s\035\237\276\234\251U-\341\365\266\251\316\344z\373\372\222\353m?\273\3738\325.\027\357\322\242e\f\345\234\257\336I{v\226\352\335\204\237.\300)@\023\023\200%%e\322\023R\362\by4\032\275E\267e\037?\333\215l<\\@\236;\345q\301\001\330\242\017\265)n]\243\302R8t\255\272\240\035nj\3226\305\231"
+	.string	"H\361%\226Im\212\324\255kQX\251\253\037!'\204\202\225\236\270\222]\202\343\303\343\326\265',\025\036,G\234\360\016'\271\331\024\177\352\202\224\234\223\303GE-d\\\022|,j\031\221\034\301FQ\357\034\273\274\262\366\206\213E\255%ms\356&\331\242P\334\262Rr\203D\334\272\006\3072\325a\262\347\310\346\003\263\354\325\232\032*I\266\036l\222\037<?\367\363\250+ky\370\217lg\3542\347\354\326\265<\214\213Z9\347\306R\2666\357\001\336\355t\272\333\332}\364!%&\330\345\234)\230p?'\336\234\263\204>\036P4\214:Ar_\242\350p\275M\321\315\227\256\rA`\241\003\037B\207\253^"
+	.string	"\237"
+	.string	":a\177\332\016\346V=\327\230A\\\305b\315\030QW\275\367\371\322\f#r\367s\217k\263R\370l\342z\032\260)\264\033\372\241\n\326\243x\333,Z\270.m\341z[\365^5\303\211x:Fw\037,\315\r\274u\254\250\003]\305@\371\2376\322\241\\\252\177\302\036\370P{\236C\271SO\365\215\241rg8\261\235~\352=\272\310\f'\266\277qc\233@k\006tOS\003\264\343\364\356\306[\313\f#j\367\363\023C2\"\240\214\021uS\317\360O\273\335\363\324\351\001\247\277\256\373qW%qS%qOI-P\340d\334\021\034\210Z\032("
+	.ascii	"\345b\334\t8\030\367\001H\270\237\234\352\356\344\203\336K\036"
+	.ascii	"\350\255\344h\274\225\276\347\235\204\304\215\204\304\235D\342"
+	.ascii	">J\342F\272\270\217G\270\215H\334FH\334/\022w\361q\273\217\273"
+	.ascii	"}\334\354\343\376\307\215\037\267_1\250\"\227\344N\355\363P\263"
+	.ascii	"Zb\242\\\330V\251\370\240{\240;\032\367=g\273\275=\216[\277|"
+	.ascii	"N{\235\fM\256r_\n\351\330\260\200\346\312 I\026\213\275\360\313"
+	.ascii	"\351\330p\242\3466\003h\202j\256\030Z\202$\253]N;a\222A2\317"
+	.ascii	"\3205\243\350\341\232k\\ZV\013F\251\005\222\221\340+t{\343|u"
+	.ascii	"\037\375M\367\261cx\265\035\260\030n\343\351\023\257,i\330d("
+	.ascii	"h\301\003W\360\013\036\003B\361\316\376\346\254\030L\"B\206\312"
+	.ascii	"\2376\231\253\340\235\310\2778\005\357\203\276"
+	.string	"\244\302T\336\200\256\322w?\357\236P\260K\025<\013'\364\367\016\\\037\"\240?\003\307\007[\322O\333\237\276\256\213N\310\335J\0210\356\201w%nl\222\005\336\255\024\231\363F\275\2735A\032x#\020.\3216\306\345\027\323\314E\333\034\241\265\277p\215\236k\214\236\367\213o\364xM\364\215\220'\375\373\370N\264:\345\376\305\3675Q7g8\321XM\264&\275\357\331!\025\240\223\202\3476XM\257rq\005\020\223\356\357@\342\026:2\360F\005\273m\260\232\032\032)b`\220TN\016\262\375\035xH\033\350\270,\261\366\324c\262\202\3256XM\013\323\204,\037\227AV\377\020 \242\267\305\310\376\016\264'\226,/\324\345\260_\"\331F\207\202\335\241>FQ?\266\340\350\006\013S<\f\305>\242\344\024\351\264\260y\377}\n>{\346=\275\274P\367\373O\001\240-\260x\340}\317S\3205\316O\275"
+	.ascii	"v\3170\236\270\301\3024\312\"E'\022y@\321\036\245\351z{\340\361"
+	.ascii	"\035\251\0213\234\330\311*\234$\225O\234;\345\370\235\2078tx"
+	.ascii	"\241n\006\377\005:d\025\020\212\207`\227\366\247\335\347e\256"
+	.ascii	"\323s\2159d*\262\206\b(\213\271\276\347\031\302X3U\016\0327\234"
+	.ascii	"\3175\020\300^u"
+	.string	"A\037\336\234\241.\005\361B\235\312\300[\002\337\035b\004v\251\1771#V\361\361<\032W\365\254y\217;\033_V\375O3\201\241\264\316\257\001\355\305\f{\361%V\354\027a_^\315\2560\246Q;\233c]_^L\347\fc3\301\266\302\332\206a\305\365%\303kL\354\212\351E&\243+\354\353\312)Fv\325\344\034\233\021\326\242\205;v\203\031\306\2667\230^a\037\\0\275^1\027L/\226\t\266%B\354\313\035c\276pn\215\271cad\315\256V\214I&c\253\206\213c\314\311\234\321t\316x\235[080\301\266\234.\214\032\013\002\226\204\n\016&T\260\"P\354.+'\323\253\331\305\364jq\243\311\025\243kK\006\327U\330\327\026\330U\227S\354\312\212A7g0\235Wc\315\246\363\352H5\363\257\3232\373\263\356\303!\031\361j\026(\240\241\3340^\003B9\261\303r\245\351\360\315\375"
+	.string	"\2718\261M\312\207\342\372\373\273\006\370\251\"$}\230\226\276\225>!x\245GsA?\362\201c\303$\365\356\007\346i\312\225X\211#=\007=\311?z\244g\007E\337\316\022\225\237\374VQ\264\013\256s\245?z\266L\324M\033\267D\211\003\235m\222zG\343\312\227z\207\312\t\272\353\375\301\005\272\006:\344\237\036f\372\351\267\027\202\361\204c2\224\002zz\344\277\361\223\376\370\016\305S\276\3611\241;\241\033\rBBE\274bac\3733\316\255\317\271\247\022\354\322\247/A\007\265\272\021\234\274:\356R\334\262\030\271\023(cD\255\364^\230\374\313\263f7B\205\020\021"
+	.ascii	"\275\002C\261\021\300\260\373\311\004?yN\0334\271\263;|3\313"
+	.ascii	"b\305V\234\244%Z\272\203[\244\\\360\236\0077'\t\327\371\322\243"
+	.ascii	"\271\007\371\303\262\364>\250\364\323\262\2015\250a,\006\025"
+	.ascii	"C\210fFDAR\220$\035a\005\004\031\30703\017\021p\255S\252\204"
+	.ascii	"hR\231\016\007K\210\336\377\262\304\bD\247\330\216e(\023e\342"
+	.ascii	"\034\325\0205E\210\273,=r\341\351\202\361\305\241u\234\223\224"
+	.ascii	"\321\316(3\202Wi\034\321b,RPMEKk\f&\334xP\377\242\236c\3103\301"
+	.ascii	"=p8\2521?\227g\037\212\312\203\377O\352\376(?\203\020\302\347"
+	.ascii	"0O\312\230\300Z\326A\337\253\237_5\2166\260\257m\210d>\225\315"
+	.ascii	"#\305R\267h\270\343\336\f`(\005\302\276\373d\366B\204\217\033"
+	.ascii	"\337\032%Sq\265\363\020ww\363\255Y\251\303]\311\307$T0\024\314"
+	.ascii	"\262\264\244i\035\031\306"
+	.ascii	"\311\362j\037\251e=\302\231%4\n\323\027\035\245\331\350\fKU\333"
+	.ascii	"\277>\212\020\252\223\352[\001t\031\003\347vJh\264\004\203\305"
+	.ascii	"W\013:\022N\351\257\322\230\326\032R\363\277P\340\367\203\264"
+	.ascii	"\344@*\336,\177]\2270\005\177\225\200G\323\262\3161-\222,}a\267"
+	.ascii	"\367\326/\324\326\320L\364[\375u\301\204\013\r'\266\030\035\f"
+	.ascii	"=\272\022\235\255o\270\352\270\325&\323\023\211\226D\257\200"
+	.ascii	"\030\351s\255W\037\217\233\210\t\304["
+	.string	"W\022\253L\340\n\t\314\213-\240c\002\366\270y\225\013@H\200n\020\3518\311zS5L\242\350.\327\325\340\311xO50\217Y\227 \223.G!E.\016%\241\177>\262)'\007\233N\320\251\241\322\322\334\226\330\334 S\301pc@\367\022\266|\b\006_\253vd\360_4\352\304\204\201!\020\240\361PX\203\243|\205\306(\252\317bv2>\340\336\201\034k\272\013\2565\204\276\3145\t[J\233\213\202\216@\r\006^\314{(dq\b\242\262\327*\313\366\224\025\216B\2341\3049\02122\214pN<\313k\t\\\314 \372\372\353n\220\240\266d\273\027\2417\306\266\334\320\236\306\363\030\267\"\003DmA\200\377\022\bh\3655\340\360z\232\224V@^\235\261y\355\200\360\353lEm\227\205\212\264\317\021\241\3557\334^\304](1\225\f\232\366\023\251\263R]\2135\027U7W\274jip<\203"
+	.ascii	"Y\311\320\335D\033\326\221i+(\354C\250"
+	.text
+	.section	.gnu.lto_parseHeaderLine.39.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`j\004\245\035"
+	.string	"\266t\274I\220\330Q:$C\370\nh\265\002T\345I\334s\003[\227\366\340Fg\216\227\327dN\241\002\247\231\213l\227\377\273W\260\255^\330\312fK\237\f \261`=\346\b\202\255\244\3555\023\200\206\300$\317v\301\177\020B6\221;\311\252"
+	.string	"\235"
+	.string	"\244"
+	.string	"\310\005\267,\304;a?m%\211H\n\256\237\212\224a\340v\205U6L\244\267;Y?\257\314\237r*J\247\232\361"
+	.ascii	"\367\n\371\342r/\262\001\373\244\267\214|\201\3636\375\200\363"
+	.ascii	"\226\225\230\305\216\224\272\350\224\030\361\312\330\2757\327"
+	.ascii	"C\256t\234\024=\255\331U\211?3\002\217\203 \365jz\272\222&\247"
+	.ascii	"\212\236El\240\001\202\343\351\247\331\3034\266#\207\214H\206"
+	.ascii	"f\034V[3\022M\334\275\227fd\252\246\260\315\bNhh\251\031\227"
+	.ascii	"L\032\026\233%\277:\002%MO\265\242\026\356\275\\\213F\034\347"
+	.ascii	"\331\231\371\0073'1\233\031\002$\242\230\032\3105\253,\b\222"
+	.ascii	"\244\231\356#\037\351\254\265\256\nLX\311\270f\251\251\365\255"
+	.ascii	"\216\013\3262\236\325\234\246\365\254\231\211|\365\305Z\217\210"
+	.ascii	"\0326\220\177\365Y\026\032\257[\313\230\221\300\332G\346\367"
+	.ascii	"r\271\\r\013a\276=y\266\335\352\\\273\225?\347\310\237v\252\177"
+	.ascii	"f+\243\266\362i+[\264\262iV\356\263r\265\225\257\243\023\245"
+	.ascii	"\013\304\362\336\033\3136\227\313v9\362\344o\365+\277b\332\016"
+	.ascii	"\231\025\222y\235nW\2105\206\204(\275\305\r\177\230\223H\277"
+	.ascii	"\303&\234!\230\2333\367\006e\250\016\224\201z\353n\033BD}\221"
+	.ascii	"q\304\006\262\331\266\257\205\370\206\257\2453J\317#\235\267"
+	.ascii	"f[e\r\250`]\362\245\274\326\335gX\216\227\247\004][@\316\364"
+	.ascii	"Ig\355Z\246j\253@%Q\242\276X\373P\242\204\r\374\213p\211m\261"
+	.ascii	"}\344\005\277\200z>\351<\226s9\221\336;|\021E:\374)\270\005\332"
+	.ascii	"\325\027\337=::nt\362\263\2440\252_FlRk\202u\311\267\007\267"
+	.ascii	"\365\255\257\0342Y\252K\256^r\324/U\224<\314>b\335\346\306\326"
+	.ascii	"O\002\250\025\316Zg\255\231\205\206\352\213\266\016\214\013\352"
+	.ascii	"\361\2066\240G1xG&\357E\017\b\206Uq$T\304\353\235\274\242\241"
+	.ascii	"\236\311\020z \370Pp \201\002\317\001\224w<?^\220o\307\013B\021"
+	.ascii	"\303\247c\261\003\352\351rEC@D\271\335\317E\216G\001\373Z\360"
+	.ascii	"~\271#\237\357\227\243!\357\315k!\330K\346\275\367\342\240M\206"
+	.ascii	"\265^L\303\340g\243\335a\303\036KOn\315|\341^]\\\022\246\232"
+	.ascii	"`\370\226\214\334\027\363\357J\r\007\276\356\275\0238\\L\207"
+	.ascii	"[\002R>`N\301%\207:\262\244\222\366\321\307\331\272*%\263\207"
+	.ascii	"\207a-\037>\230\025\037\322[\376\214\363\366l\002ST\301$L\306"
+	.ascii	"\274\tW\250Q \247\224B\210\231\231\221\221YZ\2306\200\002\241"
+	.ascii	"\2413\017\021 U\251\306&\3114\007O*\354*\340\353\302\224'Y\206"
+	.ascii	"\331\334\204\366\224\016h\034\035\230u\216\331\363\205\230\251"
+	.ascii	"\244\266\2122\f\223V2\025=(\277\026\247\313,\271P\370\360\233"
+	.ascii	"\032\016\313\223\324\316\013lmU\200\245z\244\247\265\022\234"
+	.ascii	"\240\342\322\275\252\370\324\305}{+=O'\325\f\325\007\207k\034"
+	.ascii	"D\3405\320\333\250\323\221F\244\314\322\217\b\205e\177\262\233"
+	.ascii	"\3523r\024\375M\224\221s\201\025\347g(\"\330\211Q\343&\267\350"
+	.ascii	"&l\236\215\362P\200\020\375\021\275\035\362K\025i\370\346\322"
+	.ascii	"\367.S$>\017z42D\n]\r"
+	.text
+	.section	.gnu.lto_blackboxDecoderGetHeader.40.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\321\002\275\025"
+	.string	"\366\346\212J\300\020)\035\260\301-\frU\307\366P9L\265)\272=y\230\2309\373A\321\346\277\320^ht\205\316b\275\266~/,'\0219\276\373\325\347\341\177S\024E\247\006\355}K\3716\372\310\016>\204\305CU+\322\b!r\247\024u"
+	.string	"o"
+	.string	"y"
+	.ascii	"\364@\230\013\250\365Wd\252\365\\`\231yr\350D1\316\205\234=7"
+	.ascii	"\255\237\0214\302\034\265\2361\237'P\2364?\240<\271&\374\235"
+	.ascii	"\217\347]\322\334[%9.\315\371\272\267@|45>\031Z\246\3009\251"
+	.ascii	"\003c\252\347\023\361q\214P\264\302\007\30473\256\021Q\352\345"
+	.ascii	"\343\321\375\360\024\352)X\003\311\207s\332B\251\265\232\366"
+	.ascii	"|7\267y\3336\266i6}\n\256('\252J\263\354SG\227\307\276\214*\306"
+	.ascii	"\t\357\3176\365\313\365\363\3678\3607KS\223\027\336\343R\357"
+	.ascii	"R\377\343BX9nP \326\032\242\270\243\316 \233P\\\370\333\207\r"
+	.ascii	"\315|#\177\350\027\214h\026|\213\230\013\re\352lLb\222\017V\255"
+	.ascii	"\225\344\244/\230'E\306\3331\366\313\206\005\315|\346B\002T^"
+	.ascii	"\020\250\202y\022FbF\003\343\272\366 tdh\321\037\376*p\234\350"
+	.ascii	"Q\316\357\0059\356\270\345\326\330\316\204\373\222\322\013$J"
+	.ascii	"\252\200R\016\216\221..h\305\243:\374A=\366k\257\260\320\367"
+	.ascii	"\350B\330\231Y\235\355\226'\335F\252lw8\222\206\004=\265\362"
+	.ascii	"\036\234\264_~\304\301\254\225's\341\342\341@\025\320I\037fG"
+	.ascii	"\254\200;Z\364G\024\324\322\2702BZ\223\374\302K\330\331\r?\n"
+	.ascii	"\2258\213\007+\267\265\320\\F\23340\221\2350ppRb\240\345Z\t\316"
+	.ascii	"\246r\253\331T,|\270\245\260\324h\030Rb.+\264\226X\r\367\022"
+	.ascii	"+\031\361-\203\r\027\333p\273\341b\257\263~\177\023\256\202\210"
+	.ascii	"K\245\237+?\274\253H\b8\276\226$\327(\273\225\371i-\217\001\364"
+	.ascii	"H\327\256\rJ\362q\367\300\240\f\233\366\246\232i\356\"\360\231"
+	.ascii	"\032\027eG\263>\326Zk\351\332\013/\262\243YV\360; P\002Q\310"
+	.ascii	"\214\017o/\234\234\300\352A\rLw#\356\214\035h\206g\277\220\026"
+	.ascii	"\024\264\205\314\232\276\013,&\356I\240\033\\\273?\021<\266\320"
+	.ascii	"\023\242(\351yv\275m\r\276\006\353\032\206\247\343t+6q\200\327"
+	.ascii	"\007\b\353\337\357\331\266\021\267\207:\203Z\354\224)\030\021"
+	.ascii	"\262\213\327\013\265sAl3\203UE\323\330l9\021`\337\377\302\305"
+	.ascii	"\306\371\315\260\007\033\201N\b0\033Yc{\263\330\240o\351\340"
+	.ascii	"G\034\204\343\325\0322"
+	.text
+	.section	.gnu.lto_blackboxDecoderGetHeaderInt.41.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\177\001\005\020"
+	.string	"\266^oG\340\322&\035\243L\261;^3k\365\375\313\356\201\177]\035\326\227\264\376\305\326\032$(\207\371\363~\\g\264v\225`g\312\236~(I]\360\244\2061\206\344\364\255\233\325=\016\204P'\001\211\234e\306,!dK\231RW"
+	.string	"]"
+	.string	"T"
+	.string	"\267\335\220\304'\245s\016K\266\375\235\363\304X\026\303\023`\207\243\202C\013\243\335M\241\036\322\235\213'\320\235S\023\227=j\312\374\007\315\310Q\003g\217&0\3045\"\030\252\221B"
+	.string	"H\213\nD\220xq\240g\r8\223\351A\330]g\r\004qs\267\035\3016\314>O?\347t\306\364O\327\271\031\355H\211\261\353\341\207\217\265\301\301@q\333o\307\370@>%\240\251l\033\314\227\346\003\200\032\316\216\216\335p\344\234]%\021\036*\347\177d\021di%\\\334v\227\304\024\210T\332\003S"
+	.string	"di>8)\245s\"4T\231\366W\234E\314C\r\037\260k\223\024\367Y:Om\327+_\273z\267\243\034\032\235=A\241\0162\024\246\363\324\300\215\242!\"Z\366p\006\035\t\255\336v\224L\"\331\313N9\265]b\371\232\247.#6\350\314!:9GE\233Hv8K\275\261\037Wml\247M\377\371K\267\335\336{\376\356a_\254\265\302\300}\261\326J\302K+\266\252\360\255\004\370\\\253\226h\223\006&'(\f\036\240\224\034\360\314*\201}+/\326\2672!\303K\205\205\265j\251\244Z,\254\\)\026\314%U\262\300\257\013\037,\365\362z\301R\247p\037Wm\234Y\322T\223\246\326(JFgb\324\0335\251\003\037\034@I2\371\303\247\034\t\031"
+	.string	"?\275p\311\t\254zl\204&\274\241V\026\212\302\324xW\361 j\212"
+	.string	"^\326\005\265X\355\232\310<\033\373`\303d\006\3357\302\243\206\004\300:Pb\205\032\002N"
+	.ascii	"R\r\306\224S\343RP"
+	.text
+	.section	.gnu.lto_blackboxDecoderFieldIndex.42.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`p\003M\031"
+	.string	"V\356\242G\260XQ:@\337\tTD(\2022=\352\240y\231\320\017x}\007`\357\350/'>K\204\222\336P,-N\371\366\265ie&h\347)\367\205?\245?*\345\234+\263E_\260A\201\301\323\234f\266\344\223\275\345N)\212"
+	.string	"\211"
+	.string	"\225"
+	.ascii	"\362K(fN\325\351\b\202A<u\271\220]\332W\272\022\334\307\024\017"
+	.ascii	"Pk/jJ\255c\003\307\304S\217\"\222'\341\354\2479\362\340\375\207"
+	.ascii	"\222\025M\242j\2550\235\017\bO\347\005\204\247\213\344\327\317"
+	.ascii	"\361\016%\356\252\220\316\2258\177\350*\034\336\212\003/Y\360"
+	.ascii	"\210d8d\306\351\205-hv<\243\317Y!\311\221\0368\274\242\271K\276"
+	.ascii	"`\213\247\223{\340\027l\351\262\343\315\270T\361\324Z-w\274\030"
+	.ascii	"\267x\333-l\177\260\367'\t\260xIrp\034G9)\345\373\316\n\312\200"
+	.ascii	"\252R\312\036\207\344\356\260\037\203\322\342\303\333\263[\254"
+	.ascii	"3\371W_\372U\037\377\220J\323\377\356I\245\227J\313\225\376\r"
+	.ascii	"\001\"_2\370j}1\325\246z\241NB\376\373\355\273F"
+	.string	"\231\377\304\007\272\345Z\"\263\177~\022\207`\210\276\246\2464\265V\037\361\3646\316\367\271\345*\"\263\235\b\275\252\200\261\222q\346\227\246\326q\347\3244\273\220d\313\344D\201\234\252c\222\262\241\206L\0066zW\350\334\271\255ea\343\004k\030\210bc\315\224{c*\243\223l\234#W\373\265{f\362;\271\024\216\212v\310\266K\334J\r\201\355\341O>\252\2421G\252P\261\001\020\023&\312\3516\302\007\"\024\236~\021\364p\312\311)\337\004i,\2303K\300\365\316\377\273\205\243\034\360\323H\016\0314\202\252M\277\223\353<\371\024!\005dj\325}g[\304\245\200\220\361\250U'\341\347Qlb\255\272\030\224\333\b\003\005\351\335H\002r\352\247\bO\203,$\036\305\b>\017\352P\243\315\332O\017\320\354P\243\255\037@x\020\233\340 \302\204\327\001\225g\257[\215f\233\325h\033L\3308\200\230\365\204\340"
+	.string	"\003\362\351\371\201\315nA\260\227\002\333D\324n0\0226\333\r\326\262\355\261~{\276\357\242\032$.\302\327=[K\351\232'\267D?T\273\303+6\224\265kF\356|\356^\211\211\213\215\341Z4\250\236\304De\301\262\353*\243\224\223S]\346\362\344\244\324g\255\265\206\254\375\357:\f>\227\265Wq\203HN\035)h$\177\001B\250a$b\220\203\3048\024P 2$-\270\006@\002\202\f\262=\021\220\321\"\263\\c\r\037%\036 \323\323\365\350\360"
+	.string	"~\335\227\232\264'b\232\243A\351/\320\326`\200 \357\211SN\023\272\226uU1\364\"\016W!\206\310\263\037\233F\204\305\343\"\206\377\f6\311\213A\217>\263\325\362\265X\023\336\031\001\275\212\306s1\307\216(\332w"
+	.ascii	"\024\301lV\315-^7\"\261XF\001q7\242\266\205\302\212L\230\311"
+	.ascii	"\260\267\320\264\\YJ\220\212\306\2522x1\n{:M\240\002"
+	.text
+	.section	.gnu.lto_blackboxDecoderInit.43.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\270\020\315R"
+	.ascii	"*\212\360\036O0\224\322\031\016\322F\357\213\256h\031D\277\372"
+	.ascii	")\240\027\211\231\324\360\007\275d\201w\2443\230\320V+T\002\021"
+	.ascii	"\013\344\354\035\370M\024'\377\006\223I\205x\003&\307B\220\370"
+	.ascii	"\321\317{\335\030\016\240\3058\216\233\017\265\230\211\t\302"
+	.ascii	"\266{o)\223\f\350\001\253\001\327\001\\\216\356>\016N\2033\264"
+	.ascii	"!.f\267\2679\356\266/\342\306\331\034\030\332\272\256\275\275"
+	.ascii	"\222\b\253\031X>VS\213\\\021I_L'_\231\343DX\025\251\255]\001"
+	.ascii	"l\275i\211\243$D\2110l\300X\221\220\206M2\035\"\307n\357\347"
+	.ascii	"\221\034\323\276\313\336\313\366\216\226mTd\340\240\301\361\221"
+	.ascii	"\376\354\335\035{+\027\342Y\276\345l\333;B\302\245\2001^\320"
+	.ascii	"\242\334\330D\313\225\271z\365\254=\266\300\331\341\205)X\256"
+	.ascii	"D \203\306\005+W\252\016F\247&\374\302\264"
+	.string	"[\305\312\\\275\324\326.\017\322\314\241-\360s\203\351\221\020&3\210\026\312PH\177\036\375`j\265\253\242\236\265\307\032\220\022\322\237FN01\357\036\355?\3548\025\035\367Y\327$q^\326UMia\244?W\355B\350\317\364@\350O\027\r\354X\365jdA\276\004N\313\n\234uU\003\366\r\273\303\352S\024\021\r\t\005\001\375\370\364\240\370\361\370z\274\235T\007=\315fu\317\343)`\254Q\203f'\326%\345E\246\002QL\2412H\324\020E\371\220\371\"\013\316\327\227\311&\246/\216\326\021:\260\020\223\0071\001Z\222\003\377\350\314\020\353\302\341>\313$\016f\3112\3561\217\214\030s\3660\027`\231db\016\360ud\013\031\243\020\3532\362\3372i\304DZ\327\365fI0\3461\003Hb\304\356\313\244\r&\022\334\234V\217\013\213}=.-\356\231%k`\3362\371\305v\001\314\222ExG"
+	.string	"%]D\236\232L`q3|\231\3642_\006\211\232{\321a\"G\205\3744\201\210pA\342\307u4Y \361\244H\026\2337Jy\233,\274\262\310\375\270z\230@gx@r\266\363\026\027\026\263\316\214u]\227\221\\]_\025\337\275\333\356\177v\177V\002;}A\323\201P\243\336\351\037\241\350t\332g+~\343P\264u\272H\356\b\206\265\324h\360\313\016vm\262\304\271\273!]\352\241\357\215k\251\337\246\202\317\346}\335P\243\336\245\261\001\037\271\324f\237m\272i\3151\352^\233\255\363\304\221\207{\371\201(\357\232\2107\\\234\320\351\261eS\251\357$m\314\251\324\030\364\326\242@4ADe^>e\335\322"
+	.string	":7og\217\2319\260\237\326\322\270\001\366\2654\260\221\226\256\324\335]'\224\266\302\310Z\343\314\036{\004msAz\257P\245~Z\243\353\301q\226\225J\245>\227#\031Y\316\022\361\373\003\020\370H\245\276\n\313j\036\313J\267\367n\b7\202\335\220m\024h\004\372\335lG(X|\267\254\374\202@\357\216\3602W\351~N5+\341G\226\203\016\364\247\020\335\227\221\357\226\210\312\322\207\177e\375\302\241\013\374\200\336\255\341\304G.\322\261y\354\331\016\302\024/vmV\226\263\253\206\305=\266\373\355r\304I\020\333IvS^\032\030\244\274M?^\246\203\371\312x\225o\214\027o\373.]\313\027x._\245\007\361+p\265\037\201S\371\017\370\361\256X\336#\243\036/"
+	.ascii	"=^\025=\336\024<\274E<^\242\036\357P\217W\250\307\033\344\343"
+	.ascii	"\005:y\177|\274>>\336\236\036/\212\036\357\217\307\313\303\343"
+	.ascii	"\3655o\257yy'\357\316\016o\232\362\352\244\274\350\016\357\231"
+	.ascii	"\362\232\315\333\307\362\345\346=\0070\340\200}-\211\3533jk\220"
+	.ascii	";'\326\271s\210&\007\363\267\375U~,\277\226?L\303\177z/\246I"
+	.ascii	"L\021?}\245\214\376i\324\312O2\353\017\237\036[\346\272\214\366"
+	.ascii	"\211\255\245Y\242\207\004\231fh\264\317\376\355\017s\236\024"
+	.ascii	"76vl \340\247\371^"
+	.string	"\r\202\306\350}\234\312\245\312\300G\322\350\016\302\216q\337QJ\201\373\231\f9\243\241\316\315\233\357\215\214\214>\230#5\300\300\030CT\"|\244\2140?\2207\2711lb==\266Vh\f\270\030\375*\327\021\346\202\337\205\223jY\004h\324lP\215\360\2211ZGX\326\233\230#\f\203\001\312\345\372\343\273*\022\336\372\221\275q[\242\200B}@\025\200\346\315[\332\222\227eF\367\203B{\336~\350\031\343,\250^\203l\203\242{\372Zs\214|\267,\030\351]\330\250\226\245\353z<R]\222\036\017%\351\247\312Dm\302G\242h5\f\214\227 \244\0310<=\243^\236Q\257\271c\324\334[\352\023\364\327ON>G}\222\256k\017\030\373'T3\365,}C\366*\364\347\257\203\350\250\030\337\236,\337\304\177\345H].GMKB\203\334]\026\217\243\366\360*d\353\272>\240J\271\235:\345\347\276"
+	.string	"e\016\fM\375a\325\2644\254\213"
+	.ascii	"1shp\326ue\340F\302\214oN\226\334\273\022\234\211\237P\231\227"
+	.ascii	"\361\313\\\002[O\216\276\036C\372\004(O\267\230\233\377\n\375"
+	.ascii	"\311\323\250\231->\302\006"
+	.string	"$\224\036\226O\200\372\232\225\254\321\035\t\013&\360\365\331\236\200\333\035\326\231-E\214|\367%\352\312\210\361z\314\2025@\264\332\322\027\275&\212A\033\365V\257y\335bkqJ\244\275>\242\243\262t\243\346\365\353zG\322\346\354\332\030\365\f\343\315u]\327\235\027H\306/\365\213\276\234\n\257#N;\033\304\021E<\211N\303 \261\211J(\224\372\355\t\f\2240\024\022\2058vvJ\030UU\025\034R\341\020B!9\021\235(\360\331\024\202C\242\323\023\013\351\006\245\210D\341\360\006q*\n\207\217\203\336F!5\365\366F\213\247()\033\304*`\320\206\225\024\324T\024pXe\005\034\032\022\251\246j\324@oT9IU\2356\246*\bNEI\351\020\207N\304\252S\005a\006D\027\202S:T\257J!HA*\345\304\3020H\234j\242\332\t\276\020Ue:\021\235l\230\353\342\205\013\030\0200\340"
+	.string	"\004-\214t\026\252\3050hC\b\025\264Q\303\005\341\323\nPNRO\300\251('\034@\250a\025\260E\322\n\251\202C Q(\034\002{j\306w\222E\327\310\t\321V\364\253\350\331~A\022j\204h\353\275\212\036\035\365\31606V\212\036\203\233\002"
+	.string	"\030\276\322f\252\024\335\224\351\221a"
+	.ascii	"\240w\364\240B\f\003a\262\245\025\341\344\322\343\347$\375\344"
+	.ascii	"(W\321\037r\226\202\f\243\255\333\006>\024\2150\223\036\377&"
+	.ascii	"\251x\006=\200\256\230\004\037\231\242\257\204\340\222vm~_\276"
+	.ascii	"\230\025mq-\315\257\206\032z\214S\262\0205q\221\022\305%z4\217"
+	.ascii	"]\206\022\364\025\335\360\223b]\213\242>R\210\017\216\210\351"
+	.ascii	"\003\007\344P\321\016%\202\033B\324\004\357P\264\373P\023u\273"
+	.ascii	"i\315\321\241(\247\370Dz\374r\250\257h\020\352\335\342\035/\341"
+	.ascii	"\272\005\376.\\\246\362\300J\217\027#\3249\302\216p\\AY\254D"
+	.ascii	"\325rC\266I\347 Q\177l\245\307s\t\352+\336\333\235P\230R\023"
+	.ascii	"`C,\310\336\374\336\352\322\243\235]P\217\355\2126\341\354L\023"
+	.ascii	"%_\200z\370\307}G\2241\3700\365\212\336:\036\250\207kt_P@=TF"
+	.ascii	"\305\315\212.\002\025\224d\37645S\027YQ\366\216(\327\201H\250"
+	.ascii	"A(G"
+	.string	"\025C\n\211\210\210\210$I\222\016A\005\204\030f\035T\017\021\360(UP\021IR\220\202dg\f\315\007\374\254\230\230N\335\263\254_v\326\234\355 \225o\026A\r]\264\304PZ\027_\257\361@\375\020Np\336#8q\006\177\f\344;\200p\241c\"\202\260\213g86\237\210\374*\366\244@\345\253t\325\350\342`sB\273\213;%\036A\032\004YN\205\236.\231\311s6\204i-\315\303&Ym\013]a\"g\207*\253p\311\024\017\306g\332\262\203\373\177;\234\260\004\020/x4\026\0072"
+	.ascii	"\354 \307\223x\3752\266\342\311\354\242\3155\267W\2200\016\211"
+	.ascii	"]\302\377\253]\267\300\345\351\023fA\235\202:6\331\361\t\263"
+	.ascii	"\343\347\301\361\216\217\032\006b\247\336Y\223k\020G&\266\220"
+	.ascii	"\235\265\326\327.(>\226\245\255 \374\253\321p((\235\271\007A"
+	.ascii	">\204\223\\\2246DR\232\303\351c\337\017?oos\"\214\304/?\344R"
+	.ascii	"\025X\267\261\376\f\373NG\266\272\032\200\224\343Sh\321\227\206"
+	.ascii	"\335|<\352w\272^%>\272\002\327\2548\264\362X\366\276|G26\343"
+	.ascii	"\331\227-\030\240h!3\336s\311g\220^\201RP1\017\201\004\"KL\243"
+	.ascii	"\336\356~\017=\356\020\277\001\037\357\\\314\302-\225\305\320"
+	.ascii	"\244\363\331w\362\340\200v\003\326O\231\254\334Y\213\377>\326"
+	.ascii	"@O\241\343\001"
+	.string	"\341\013\237q\344\2074\200\271\212\351.\370\020\362\216Z\314Y\016}\264\353\375\315\210\212\217\375\n\331F\366\nh\327k\005\3147\222\r\323t\032U\226R\376\306\023:E}\255X\273\341\246\316a\365#Z\263uq\231\371urw\377\212\355c\264T\334\t\226m\247\235g\275\253\246\217d\227\253X\206Fs\350\377\355\005<\020G\0210\330\272=\345\245\n\334Rj\353A\213,\260\271:(\021\351\021\313/\343\351\360\025\f\347\354Z\372?z\030\034\257QR'\305\234}=\322\235M/l\213\b>\271Q\026\307\006>\215N\355\312:\217J3\276\265N\230\375!\344<\250Mtgs]\2379P\003\343\0310*\353dY\330\020\017\200\260^@\346\234lGM\030\241)\022$A\331nL~\301\340\326\250D\177@8\177\200P\017\242\322\365t\264a\213\350,\272`6\236!\\\001\271\263\305!7C\254}2\036\025"
+	.string	"6\275l\t9\222vz\270\003\317\233{\345\242\200"
+	.ascii	"\237Ka\370'\270\"\b\362\007"
+	.text
+	.section	.gnu.lto_countSkippedFrames.45.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`n\004\355\034"
+	.string	"\206\263\263J\260\226Q:\226\001\264\327\351\232\233\201\325\361$\3074\243\007\233_\030\034\363%\340\234\242\231ms_\3072TZ\326[\\Fa\351d\300\310\352a\373\302\273\323\222r-\347\333q\207\266\3707\215~\f\007\177\224\337H#{\313\235d\235"
+	.string	"\230"
+	.string	"\235"
+	.ascii	"\377\201s#\020I&\240h\344\355\231u\370>.a+f\357\341H\021>\344"
+	.ascii	"Q\220H\345\336\023\301-[ a&f\2242\277\350=t~\346\374uo\320\224"
+	.ascii	"\322\275g\002\226\221\267|\222\327\361\035:\214\253\247\f\036"
+	.ascii	"\213H\212\204Q\324\275g\214\300\005\214\267\365\001\306\333\216"
+	.ascii	"\301\225\342>\332\332\024\307\367\275\346\210\022\362\360D|,"
+	.ascii	"y:jk\367\216\230\\\274]}\300#\307\320\201\247=\274\021\264\336"
+	.ascii	"\370y\037\370\003S\246\360\360~NU\021\356\275Lyx)\316\2523s\b"
+	.ascii	"f\366\300\\o\001D\246C+O\227\022\231O\035m!\346\313\236\2063"
+	.ascii	"\270\203\230-\345\227\245\374b)\273X\312.K\271\345\302s\253d"
+	.ascii	"Y\312+\362\347\257\372\357\\\373\2753\265\224\017`\300O\023\223"
+	.ascii	"\351^\024E,\227\211]\262q\341\377\373{o\346\363\217.\344+q\311"
+	.ascii	"8G\342\003y\220\005\273,Q\367\3362\2704c\372\340\017\007\340"
+	.ascii	"\276\004\024\250\244\273\363Y\361\020I\301\214f\224>\t\347g\316"
+	.ascii	"\350\263\002\"\222\222\340\026\006c\306\367\301\007\306\370\341"
+	.ascii	"\220\240\246h~\204S\336\302\234f\314\001?\\\212\305b\361\270"
+	.ascii	"\321\325.=Vi\351V\273\272\203; \232#i\351\002CE\271a\323S\253"
+	.ascii	"/\\u\355V\323'\273%\235\220\3153\361\252eQ\224\316\032\016\237"
+	.ascii	"n\220\377\004\013&'7\250\352'M\270\361\242)%r\355\b9J|\275\367"
+	.ascii	"\336Z\366\177\265\313>52$\262\372\275\"\357f\365\253\264\206"
+	.ascii	"S\265\201-\202\2164\223\375\337\t\274\311\246M; \035-2\363\206"
+	.ascii	"\023\001A\336\273#\343\017\261\341@\326\310\031o\337\006\206"
+	.ascii	"\212r\264\310\007\276\342xq\211\307\215\357\035\202\213\034\r"
+	.ascii	"5\346\314\r\355f\273\231Y}\260\311\324P\260\321\320n\022l\312"
+	.ascii	"\233\232\016f\3152\203\006\fd1\n\034\304\300\300T\\\203\271\331"
+	.ascii	"d\314\232M\346\302\007\023C\206\032"
+	.string	"M\003\206X\315\f\215&V\273q\210\301\030`\323\306v\213\335\230\346-V\2369\032\357\346Z\273)\355\030\027\271\326\361}g-QAcl!^u+\331\241W\232O\335\333\211\224\036\222m!\256\220\204\310i\t%\273v\317\201\267NP|'\245\234\212\350\205\274\273\347\325-\355z\3625\355\320+\314\027\006\177\340_>X\020\231\274\264K\277Z\325\264[\312p%/\375\\\250a,\343\234R\b\t\215\210\210\302$\325\001`\002!sv\033\020`V3I\222a\f\357\024\254\261A\240\177\024\260\366\244#:4\206\244C2\312\276m\361{\253\371\\\200,\311\216\300/\221\t\3203X\224\350\2665\276-\205\235P'Cb\032\225\022\006\220#\317\264\333z\307We\277\025[\263\020\210>\212\220\0300\203\232\"\001T\2047Y:\235)\262G\367\315\271\262\0230\245\267\210\254q\226K\210\036E\225\300\255\371\025H"
+	.string	"\312\002p\305\371"
+	.ascii	"\r\275\307\263\320^\337\017\225\330\275\221^8\344\377\216b\247"
+	.ascii	"\2164\364\301\212\314\321R\213h\375\257eE\376\034g<\240\352\211"
+	.ascii	"\202\247\220\327\034\344\024\273A\316\227\227\321\3362;\313P"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_readFieldValues.46.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\323\021\315S"
+	.ascii	"\252\213\300\036O0\222\322\031\016\367/\027\n\374\023\302>\252"
+	.ascii	"\353J\3127\376,\362\277\006\356V\361\253\004\235o\030\310_"
+	.string	"\361G|F/\266{w\355Q4+^\001##\347\371>\033:K\\Ct=\356\266\031\306\247\265\230e\246\252\232\266^\322K\332\336R&\031\343\001\253\001\332\001\250\233\016R-\362\342L,\223)\337M\007\251Sm\345\372\021$yT\362\266\314\222\3730{1gl\333\226Zm\245Z\310\220\330\021Y\222\334w\331\2031\266\220\334]\3336&=5*\307!\317\201\003\365\250\2116\311\335\177\341\340^\200\024]\251\255\\:\274\266P\311[W5\021\322\243\347\271\254j\364J~\313o\250:\016T\251\325V\002d&\330\255\353\326\361\350R\245Gy-2\226\220<\263x\260\303\217\364\250qM\266\225_\251\272\r\333v\352\254W+<Y[\327\365h\237\322\243E'\021\233$\253\211 \244\263^])\301\201\364(\021]\362\274{*\257R\365\264\021\276\263\256,,\327\326U\355h\rH\217\256\332\177\200G\323\367"
+	.ascii	"\217V\355\246\271\032\2235HF\002\026\226\274u]\221\335B\232\372"
+	.ascii	"\004\2039\335\303\363\247\332\267\270A\300\252\017\t\005\001"
+	.ascii	"\375\370\364\360\354\350\344\340\024\211\352P\230\006\201\350"
+	.ascii	"I\324\\\265\347\362\022~j\262\270\254>t\206\3035\204\205\316"
+	.ascii	"\266\242\305\355"
+	.string	"\315-\264\223\251\212\224&\007#\205\203\224]d\007b\2775*h?g\220H\221(K{va>\367\204}\240\274'\3304w\344\233\231X\027\224\363|\361\316\311O\314\334%\305\030)\362\263\255&\254s\246N\316%&\234\003v\234\223H\367\202\027\001H\272\320\275\231\204\213JN\f6\035\271\305L\254K\311\325S\247\271\025\345L\"q\266\205\204\207\301\246%]^\027\306\0359\305L\254\313\353)Y\020\212\0310\247\211\031\032l\022\363\004\310\276\356\304\272\242\374d\260\023a\251p\004\230\212mMQ\022\031r]\001S\022b[.\244}0W\241\247FEO\254\213\354\034lZ\327u9\213\253\353k\374.K\260\273Ivs\272\004k\276MV\334\267\377\022\223=5Do\366}B\027\312\3260\275\375^\232\026\304\336MP\n\233}\233M\023\244;\002\344,\273\375];A\263Os\260\2625\354\314\376\207\213"
+	.string	"\036MR\266\256k\212\327\355n\232t]\255\376\265\234\265\026a\226\255ak\n \f+\022\366\333=]\bO)\224\275\b\300\243\335\327\362z\267h\356+a\030\302\177\213\324\357\366\202\345'\204\377v\204\f\315U\314O\302\362\205f[\321\242\003_\3571\031&\204\371\366`~\306 6\242\254\371s\027\247\267fe\276]\265!\334c\273/\340\315\2246\333,\3546\357\016\"\257\016\"o\216\273}q\334\260Q\203\306\f\0311\234`\274x\226\237\311\305\325\376\026O\373Y\334\206\177\351d\276J\227\373\2568\363\233\204D:2:~\355\253\242\310\233\242yQ\234\274\003\250\274'T^\023C^\001\2307"
+	.ascii	"!o\211\346%Q\344-*\362\002P\344\035\321\274\"N\336\020*\257Q"
+	.ascii	"\345%*\362\016\025y\205\212\274A\315\013t\362\376\250\274>*o"
+	.ascii	"\317\311\313\243\362\3564\257\316\311\233\243\362\342\234\355"
+	.ascii	"[$\362\022\233W=y\207*\257\220\310\2336o\360\344\005\252\274"
+	.ascii	"\350\220\267\231\227\205\274w\340}kyw\037\250Y\327\"\177o\326"
+	.ascii	"84\f\331\335~2\277\334\317\374\331\376\265\037\207\007wo\\\316"
+	.ascii	"\255jd\276}i\256jd\323Y\257\310\266\224\031\323\222\033\267\252"
+	.ascii	"\361\n\363\001\2765\025>f\017\267\352Vq\360\266\375\016\177\013"
+	.ascii	"jiS\253V3\311\346\367\300\303\266\245\031I\037e\364\276\210/"
+	.ascii	"zO\025\251\215Z\213\267^\004@\217\350\"\243\006\340\350+zD\323"
+	.ascii	"hE_\216\221t\241\033+\302\350\313\255h\030L.\0212\222\21006S"
+	.ascii	"\207 j\243Q\023\2750\352\027\314\023b \3125\231\\\013\3745\327"
+	.ascii	"\274\367\251"
+	.string	"=\266\305=a\214>\232\233(\351\361I\255\365\270\013\313\270I\023:\365\236)R\037[k\027\n8\324Ng\256xo\205:\250\207\372\204\303:\262\324\307\026j\024\013\226\224\244\016\352\356\303\2322\204\377\320\024\304\230\3716\251\233\2040\337\345V\370\241\3120F\237\231\3241\372\312\257\003\226x@\r\360\bB\363u.<\226\200\372D\2230>\315\324?=\355\323\334\247<;vO\337\351\330N\335^|\226n\372L\366\354\276\b\231\207 \356g\233\330\022o\210\337v.6\214\352\262n0\300\317\332\"\"l\360N\\\336\245\314\343\227\255\034\bQ\327f\247\231\232g\307\205\0138\276\023\227oA\036t&\330\321:\335p\31258\315\324985j\354\307\364 \274\303+\323\263\323\321;\372e\260\374r\376\376r\264\216F\261(\277\224\307\3219\272\321`\031q\303\361\367w\024@b\343\350\303a\035\341,m\353Q"
+	.string	"?\346;\302\204\300}\230\205\355\355\302\260\027\354\364\330\340|\333\200\357\201\330w#6\bnjN\\\266\001\331\324\013x\374\324\245\255v\303a\371\t\233\251\207\367\373[h\303\306O\216\035\374\254\024g\t\006\210\023\2275\2408\313*\315`/[M\361\370\251\363\300K\326\232\035f\321\273\022\364\340g\005\333\203\260\253\266Z\264\231\032x~\337\200o\264\031Nyv\243\277\366\"\243#\365\215f4\312/\234%\rf~1\217@J\234\025\367\235=\026\027\034H\220(\nNt\030\365 Q\b\374\260 \nHp\003*\251)\013P PT\031\364\350"
+	.string	"\030\344\007\225\224\223\217\f\240\242*\030Z\360#\312\207\324\323\017\250t\225\bP2\200E\322\001,\220Bh\320\003j*\b\020\340>!MA\371\220z\202\362!\301\007R\024`\360\324#\003\n\220?\242zh\200|\232\002\202D\032`\2456\200\232B\006\221\222\232B\252jB\336,,\332\267\246g'\244\207,\325\271\256b/\216\303\317\345;vV\370/o\250\3076E\363\331\2253bi\212F6I\3531sJ\336\204z,\2003|\374\236@*\032\251\265\220\332i\314\025\357}\311\227\331\332\337y6p\261\t\302\223\001X\243/\346(\036]\320E\357\360\330[4\352\3659\352=\177\220\372xJ\324F\253dJ\260r8o\264\212\326\332\277\017\210\252/Lo\315\241\200\2730\030\f\312\200\345\257*\022\234~\352F"
+	.ascii	"\036\035Q\327\206\311\346\003\263\206\237\036[\365L\017\215>"
+	.ascii	"\032_\032\317\361J\255\365\271\013\313\360}\351\231\321{\362"
+	.ascii	" \365Qk)u\261\235\226W\274w\376\035)\365\311\234>4\372d\224\232"
+	.ascii	"\006\022l\006\024Ue^(N4S\017`\242O\034\265\211\031\375\265\243"
+	.ascii	"\236\321\355e\016\255\265\270\021\341\352\321A\366\356 {\317"
+	.ascii	"\0346\362bk\221\231\233\201\213\235\200\002Jf\fv<\300?\001\005"
+	.ascii	"h\242\223+f\256x\257J\312S*@\211n\321\001\364\020\032%\f$\272"
+	.ascii	"D\023a\3417<8i\356\364\330.5\211\346(W\306 \033\251I\364\313"
+	.ascii	"\336\374]\271\244+O\247\307\366h\370L\300\221\321\227\323KC\244"
+	.ascii	"\205\334\301\002\006\326D\366\331\266\211\2374\247\250\220#\243"
+	.ascii	"\317\206l\031\335p(0\315\316\006\255\206'8D\030}4=\023\324\343"
+	.ascii	"W\264\326\233\027\006\201\207\250a@\004\031SC2\"\005I\n\222a"
+	.ascii	"\f\241"
+	.string	"\005\004!\247\240\253\016\02105c\020\315hA\222b5P\005\264\332(\255\366\247\t\244\177\321\356b\255? \343\246n\324\275!\246\304\277\313\003\201\275\b/\303\232\3343}\273\312Vv\242J%ND\350\203\007\245"
+	.string	"%nS\212\226\354a\260\266\033\213N\325\357\250Y\032Vn\375\351\237\305\336\325\207\346\"\341O\332P\360\236M\rS\311\006\371v\036\204W\360#D\235>\341LZ\312\265\270\036A=|\241\331\315_ho\021\003\217q^\2204\312E\"\371\202*\313.\205\f2~\332\305b\377\340\201\267P4\250\305\370\023\213\222\372OZ\035\344\346J\264\213\202\016\226/\361\021\277\214w \202\306\035\354E]w2\216xT\205\035\037$\206K\023d@\0244&\0264\tJN\316\004\220\342\311\\\303\332s\312\t\244*`4\261*\004\215\277jW\203\372\031\361x\301\031\2249\220\005\231\253@E\342\344(\276\310\007\211n\324\2565\355pb\017"
+	.string	"N\265\242k\233\332\372n\357\335\250\002\206\f\343\313p6\276\324u\013Q\007v\021|\345\201l\263\204\312*\336\367\332\226\220\354ao\004\240E\202\034\"Nf\340\275D\340L\305\322\007k\224\250\300$j\205\241L\262\347+\226\030\304p\207\304Z\264\261s\376\033\032\204v\332z\373\251S\230\302TWjXj\034\312\036\t\031m\364\022d\005 H"
+	.string	"\333\350\360\260Y\204\bz\004I\250\302[\243#\030'\f\370\250oY\263\253\362g\023\376\265\224}/\253\207\202\345\341\315\331Y\344"
+	.ascii	"\b\243\342\351w.\337\022\020\027W\341\227p\336OV\256\2370\350"
+	.ascii	"U\021\336W\n\352\254\255\345|\346\344\300\303\21307\350P\234"
+	.ascii	"W\353\342\244\205\342\273\222J\"\317\270\242\211\374\033\273"
+	.ascii	"]\016\361te3\235\023\245S\341_\352\317\226\177BZ\257\357\277"
+	.ascii	"n\310Yc\"E9VFE\226J/\023\266\2608:\022\320\260=kq\024K\215\245"
+	.ascii	"}\341)\230J~\351d+\216\311\b%\364@`%..\243\363\253\"\366\037"
+	.ascii	"w|0\350\344\230\323\375\264\324N\313\304\207\213\032\0323\232"
+	.ascii	"F\212\204B\261\356%;\321_\302\266\255\212\037\214\004\0067\203"
+	.ascii	"\006C\241\307P\356\300\225*A\360T\336\214n\034\267}\257\033w"
+	.ascii	"\212\005/\221a\342'\310\262\266=O\227\3413<\220=\034$\3220A\341"
+	.ascii	"\365\273\257&\006:\375\263vT0\301\315U\322\020\326r\217\306t"
+	.ascii	"\r]\302\306\316t\225\037 T\030\002\017\272\235;x\302\306\342"
+	.ascii	"\272\220:\264\253\356\271\300!\340\2748\345\017"
+	.text
+	.section	.gnu.lto_applyPredictors.47.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\206\021\025Q"
+	.string	"\352\207\364\035P0R\312I\007W\257\231\271\237}\021\344C\277<&\026\005\326H\266"
+	.string	"\025\325s\025.\023\263\233\\D\275\001_\243\251\177\277\356N\275\230>&\250\013`\fA\fQ-D\242\304\343\334;\013\021\030\036\241\247Q\0351\333\375\255\221m\322\b!R&\031\315\001\243\001\330\001\313KyO\223\327\364\361\226=\336n^Fy\277\300\023\231\"\252\306\324zB\262\212\312\306T\023;\232\337\314\237\366\336\375P\020\303\375\231=\333\246Cb\320P\205\031s\207\305l\270W\333\257mzs\250\0073@\214A\202\2417\3771/\263\351P\330p\227\214\006\257Ec\017\005&\352\350j5\363\3422\334M\3333\250\225\021\005#fGWkM\272\271\337\332!*\303S\f\325\226?\21124\3038\311\372"
+	.ascii	"\2759d54\321\234\244!\323\004\212a\t\246\203\323\330\313\032"
+	.ascii	"\363\206.\n\211a\377\360AP\247b}\t3\001zSH\315\220\315\336C\325"
+	.ascii	"}\b\241\324\251X.tA\200\336,*\205\322\206\347\335\357p/U/\023"
+	.ascii	"\341;\265\276 G\246V\263\032\273\204\336\\\263\377\2347\321\367"
+	.ascii	"\2347\267jw\356fa\225'\306\004\224\2637\265V\245\306\262\257"
+	.ascii	"\274d2\231|i\366\rr\325\205\202A@?>=<;:98\300_\352\353\241\274"
+	.ascii	"\323,\233\253\366e^\272\020\005\210\254-\253\013\225\274\021"
+	.ascii	"N\330\362\2431\207\222\251\216N\355kO8\b\203\224.\017R\003\204"
+	.ascii	"c\210\261\237rL\2101\237\0362\243\f\314\263cDf\314\302:9bW\030"
+	.ascii	"\247\034\352jK\001\251\b\027\2268\231\261\213\201\274\002\330"
+	.ascii	"\216B1\246\245\211\237Q\352+\213\216F*e\021"
+	.string	"\231\261\005\356\221\031\271\030\345\245[P\370\374\222\"v\263\354\341\022s\304\217F\261\222\306\0215\264p\266\263\326\326\b\\\316\240%\2060+U\246\024}[X\3772n9M97\023\326\350\313(\226\366\327n\212!\233\370\222\322\345\314+\240\326\272\234\265%\345;\364].\332\335\261\335\234,\001U\354\221\2754*\366uh\020R\354\247\340yyb\017\305\251\003\335\276\ts\0067\373\2712\206$\366J4\027\022{9\216b\304>n\347\320Z\255\336\365\263\360\252cZ4T\257:\343\307}\027\032V\215\325\254\3168\271\324*|\267{6 8\200\356?8ov_\253\2056\240\271_\344\362\204\223\353\243\337}\006\312\335\025'\367h\307\255S\235Gs\006\330~\023\326 \033\b\266\021\266z\223\006\360\272Z{i\303W\265K\3221\305\261\016\361\223y\321\325\356\366\024C.\253\276\355\201aX\255\225\t\202\253\221"
+	.string	"\255\265.\021Qu5\3012\341A\256k\207Z\353\265\210\260d\237P/)/\322\260\331\341\306\257x]\261\335\362\232(\216\225\355v\315\254\270\301v\317\024V\247\266\375\302\356\315|\225$9y\235~\274\t 9\3620\277\221\"D\016\346G\340\307;\344b\376\003\216\3667\t\t\002\344?\374\006\334\207\237\200\227\375\303\243\371\376\270\231\257\217\247}\205O\373\366Hy\231R^\036?\336\245\037\257"
+	.string	")\357\216\222W\207\2177G\312\213#\345\275\221\362*\375xm\374xk\244\2744L\336$\037o"
+	.string	")\357\214\222W\206\2177\206\217\027F\312\213\224\362\036\371x_\370x\001\360\361\032\375x\213R^\027&o\013\037/\213\037/Q\312\273\302\344\035\362\361\n\001y\203@\336  /P\312\373c\362\372"
+	.string	"y{R^\036\223w\307\307\253\323\343\315\371\361\342\244\274@\223\367\367\343M\177\274\276\224\267g\362\242>\016-$\213\2558\355\220\333\035\302U\210\300\220S\352\035m\324\202\364\323\202t\020nK\347\316\312\252\207\306\205n\311(\354x\032\3542N\033=\244\205\220\305\256\003\272F\333h^\327\350\322MU\030\215"
+	.string	"\272\251\223\002\350\023\271\363\273\233\302\211(t\210\314h\"\335qS\252\2668up\336\234\021\243\021h\0310:F\227qE2\244\206\321f\034\224\2735\277*U\222\310\361\321H\315s_\332\260\270\356\301.9\254\341 \2551\302+\354\031\244&\312\342\306\204\032`\232\"G]\244\373\214Sp:\352\2436eW\234d[\342\314\357\310\213>B\343"
+	.string	"\364\213^\341\246xg\324,\032\200\256\2426\352\273\350\242\016\002qa\244[p!j\026]\272\255h\2426\335\024Y!\324M=$\324<\244\227\024I\037\315\213\202\215\244\3133(wW\333v\006u\260\205\316\212:"
+	.string	"uO\0075\357\254\330\365\323@\375\006~\214\264O\007\335\212\\x\272\247K\267\bxt\272\251wt\372\214+\222=\221;\346\200\303\303\334\226\317\2013\247OF\002\233\340"
+	.string	"\222\\\255XL\273\n\260\326\002SS\204xS+\326\322M\316\342\022$"
+	.string	"\"\201\354\302$\\\213\006\347\315\234Fj\243v\205v\304\241\367/\033\332\324\200\342t\332\t\364\212\263\"\r\300\306\351`\005@#\375\353\241\270\3138}\235v\211,\222\365\332\327&\223\036\257\233\032\345\253\277y\315s\3435\030[\275\251\201\307+G\374hG+\347\331N}\n\261|\265\001\003g\331Mm\226_5\347\273l\323M\221\354\t'O\224l\3732\033l\235\234M\3350|I\002\213\353\366rG\256c\205;\005+\260\261b\344\214\033t@S6Xr\271\372\322\004L\244\242|Q\247\252\200\bUz@\204bB\004jJJ*\b1\003)\013p\250\210\031,\231:"
+	.ascii	"\212\330\244I\324\005T\300\034=*'RQ\034\020\247\232\240TD'\030"
+	.ascii	",\341\340\234\222\332\340)\n\2128\325\244W\001\021\2527\207\216"
+	.ascii	"\034K=n\360\350a\203\210\267O6\246\210PROD\250\t<\220\242\340"
+	.ascii	"\202\247%\030P\240\304$jI\006JOSTJ6b\254T\023\342\224\322\006"
+	.ascii	"RRSJ\251Y\245{\231\237\004\2702l\256\372\t\235P\203m\257.HI\177"
+	.ascii	"\355(\025\3117N\272\217\326\3322\250G\277\314\321\270d\031']"
+	.ascii	"\330ZL\375\262/oX\\\307\003\207\031\300c\273\303\002\003S\267"
+	.ascii	"hSv\305\302\032;\241\231\262\326Z\203\r\2668\177{\371\267\177"
+	.ascii	"\f\030\026\312v\206\360\374\355-\212*\334\345\020\001\376\355"
+	.ascii	"GE\024\346\322#\350\337~rI\361\003\244\211\212\\i>\334\365\026"
+	.ascii	"B\372m\305\255;^\002\375,\3119\035\025\312~E\372\250\210B\232"
+	.ascii	"\017I\263\351\324;\300l"
+	.string	"\245\235\177;Q\221\312\026\240$}\266\367\262$\347\372o\377\321Z\213#\354\335\021\366\362\b{s\204\275@ao*\354E\205\275?>\302\376\241\310\025\245'H/O\330\253#\354\375\t{}\302^S\330{\n{\201\204\275e\013\273Gk\355*\351\233\361\321J\372\305\256\265\037\313\032;\036\235\303nYN,5\217f7?Z\200^\352\323\255\330\265\243\005\350FNq\332\221\243\021h\0359\332D\356\240\301y\351\301l\267?\272\200\"~F\362\fA8$\301\321I\272\317\202\360\227\023\216>jc\303]\r@pc@n4\220&\366\272q\305\316\312\017\225\264M\003\257+98\2567?\032\034\013>B\224\002\201p\250a@\305\024cfdDD\222\024$i\r\221\005\004!\347\\Y\007\021\020\255SP\225\bIA\322b^zT\350\316\237\246\340\214\b\364(\220\313\374\306\022X\223\206\222\304\222_\235\254"
+	.ascii	"\355&\323\203\225<"
+	.string	"\323\351\254\316\f`\344\245V\t[\215\201A\350\245\026\b\217\001l9\367\310FmOz\237\237a\344\343I\024K\252\302%#}%\037R\354\375?o\243\002\200v\033\313\036\246\333J\371\312\327caQ\267\213\342E\nQg|\336\030E\357e\250'\260\371\303\307\201\2002\317C\334{x\231\311\031u\325b\003\274\267\335\365\274\271Rh&\250`LQw\277s\bG\343\245\353\240\026\336AE>\fAa"
+	.ascii	"!;\252\232\224G\213\300\307\310\020\026\273\205x\275\277\364"
+	.ascii	"|HJ6}\332\257\246\315\266\274L\017_[j\320\370\201(\276\224N\362"
+	.ascii	"\326\321\252\331\226\354z\353\255U\350\276;A\f\246=\226T\355"
+	.ascii	"\326"
+	.string	"\331ef\236\242\354\022#\247\273\256\313\363\3501\2644\0246O\033\226\020{\224\335\005\230!\214\301\322\307Z~\001z\255\003\027r_{\037\215m?\233\344\r]\277X\036\353S1\240\203Zo\232\200\313N\250\262\315\366z\016\227\2024V\204\350+\0379&\304\262or[\216\375\016\351\266a;\365\334\270\340\030\026\027d>0\270\263!\255\210S\224)(\211D\276\210\313SG3x\225R\360\223e\240\034D` 6\002\315`\210R\350g\377e*\020\322\305\324\202L\001p\023\023\314!9T\224\231v-\263\323\232nRD\244\257\353\235SF\335\321\207\267\254\n\272\267\017nY\025to\037\334\262*\350\336>\270eU\320\275\375\341W+q\374\001\250\312\\'\027^\347\211\317\323\202\217\226\230\260\230\226U\231\246\"\253=\366\277\241\031\004\211\rJ\001\356rn`\203A4\221\t\305\035\224\230\322\036\023\b\027U"
+	.string	"P\005hU\001\325\311\004J\360\273S\221\032\366\273\323\206\301\\\356@\0314> \366b<,\035\024\313\275\235bS\231\370\260N\346\240\342\235u\270\341\037\002\215}\321\rj@\360\327R\026`\001{\246\325\002.5\245'\352\201\330\341\360\306G\376"
+	.string	"\017\b\022\032\377\021\346A\334\316\213\273\200\304\321\f\342\240h\305Zh@\264VL"
+	.string	"uY\006R]\022\266\007\016\312<\221:\262\205{\273\353v\344\251!I\216A"
+	.string	"\f.\035"
+	.ascii	"m\022S\233\347\371\347\231\236\373\362_*Ago:h*"
+	.text
+	.section	.gnu.lto_decodeEvent.48.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\245\021-R"
+	.ascii	"z\207\b\036R0T\312I\007JH\324-o\235i\301\352\236\247\212_\301"
+	.ascii	"O\315Qa;\360\261\211\r\360U\016\376C\276\264\353\004\262R\373"
+	.ascii	"\347\207\205\257\363j\336\351:\021,<0\351\003\032"
+	.string	"\007\310pmg\263g2>P\037\317 R\327\177(J{\263\226\020\"e\222\001\323\001\246\001\313\001T\340jM\366\220b\206\007\026\234\330\330\t;\266\265}\231{mu)*\"\334\213\331\22312f\327\314j&CL\210\224Z\353\323\356g\021\020\341\252\025\005\021.\230\207\361\3614\251\327\254\372 ob.8\355~&\231\027B\321\274\354{\370\221\255-?\325\255\376\n\016\311&(G\270g\301:\302\233\241\360Z\254,\030!\006\004nE\330\275L\205\363\260\347\342\201V\034*\265\326\336\267\230U+Y\263t\304!id+~\022@\0242\177\213\n\277\322\243\201T\363KU\032\331\234\237{-*\354\366~\232\273>v{\273A6\302N\262\020\374\251?\264X}\260\373\031L#d\336=\331w\360\361+=\016T+\230\231\264Z\223\b\354\003\273\237\233<\020\375\271\273\020\372\223\001\007|l\032\254\242r\243"
+	.string	"\222\215\221\313\234Z\223J\315d\315\233\311\357\017\247/\n\022\r\001K\b\005\001\375\374|z|F=\036\336N\207\236fs\272\247z\221\216x\244m\354\301\001\272\346\220\215\021E\031\262\001\315\030\003\033xR\202\313\214l)\024\004d\372\224b\\w\273rb6\260\205\246<\231#\374#\300\fYM\376\363\301@\215\033%Y2\274\307\213\r\t\373>lr#\023H\304\206\343\335\256h0\r\200S\213\363\263*\334c\361\346\206\347\254\202\353:\357nW\\h\027\340\206\253-\336-`\007\251{\226\323XB\304\214l\251$\213\312Q(O\2145\\\311\225\026\017V\021\345e\201\235\255"
+	.ascii	"J\256\306tg\227u9b\025\271\251\"\nq\b/XE\336\246\001^h`\360\301"
+	.ascii	"\372a\002\201Xb\304\313\316VXDf\335\213Z\353\362\021+\353{\364"
+	.ascii	"]\016\332\335\253\335\237\234_q\3737\333&8\247\325\203\304\036"
+	.ascii	"n\333\354\316\001\372\363U=d\016Y\001?bw\333\034\314\227\327"
+	.ascii	"\221Z\251\356\325\206\217\265\200\237\334f\325\342;\253bM\032"
+	.ascii	"7\356\335\r^\004\007lR*\035\3644\251\265\262\200\376\344\265"
+	.ascii	"c\334\213\346\276\361\316\220\347\376,\277\221\"\222\344\022"
+	.ascii	"nxv\330[ZDa\377d\317\003\375\351\242/\204\025W\004\255\344\001"
+	.ascii	"\3741n\201\267\350\b\272\271\024q \362\334\002\325XM\016\210"
+	.ascii	"$&ZC\3332\356)\372\262\265\3615\351\357\r\351\rN\223\025\267"
+	.ascii	"\333p\364j\353\016[a\267h\034Z~\370\301I\200p \204\035\200\223"
+	.ascii	"\275\361\037x\354j\255\017\354\325\244UB\330?\351\201\376l\321"
+	.ascii	"?\"\256\fyn_v\016\306\334*\227W`\365\265|s\242\277\345IC\246"
+	.ascii	"\263\317r\2362$\311e\\e:\273I\"w\330\356\315\332`\273>\336\t"
+	.ascii	"|\2745t\2744t\2743|\2742|\2741t\274\022\350xa\370x_\370x]\350"
+	.ascii	"x#\320\361\nu\274-\226z\274,\236\366Cp3\337\024?\363E\361\344"
+	.ascii	"?\300\257\374'\226\027\200\217\371\"\035-\257\321\362\026\351"
+	.ascii	"x\203=\274D\313;\264\274\300\345-\341\303+\364\343\r\322\361"
+	.ascii	"\002\365x\177|x\177=^\237\036oO\017\257\257\307\333\353\341\345"
+	.ascii	"\351\361\362\226w\347\343\325\365x\321\036\357\331\3435\237\366"
+	.ascii	"m\036^\346\361^\203\022"
+	.string	"\270\210\f\301\372\220\037j%2W\247\266\235b\242\334\314\177\346\037\363\247\335\334}\321\022\037\216f{E`g\240\336\304\002mu2\247\201T\376z}\265\037I\021\t\306h/\205\036\265U\214\2602d\3322\356\210\231\316\"\365\213!\323\371\345\210d\252~|j\364\331z\270~\202\245\376\230\003\216\324K\375\242\327i\246\354\352\365\323\236\304\242\217\272\327\275f\204\201\247y\315\242ur\305:\273\357\032\212\324<\035\024\242x\303\004\315\353>b\355L\340\206?85h4\223\031M\203J\n\325\023\037\266\265\301a\313\203\030\271c\317\f\266\275\301Kf\260\225Y{\322\220\314o\244\f\331\266\214\3332\214\243\203\257\303\366_\240\246\tc\324`<1\372hg5\306.<\256\227\321V\233\242\273\276\022-l~p\0221\354\220\374\225\312\340\205\312}\007\372\336\365\317\316Z_\214T\210<\327\313\306;\303\":1\356\312"
+	.ascii	"\201\034\230+\235\202\264\005\324\3319\306\315=\003TF\353\272"
+	.ascii	"h\315\250E|S\276 \243o\366\244\341\275\374g?\223\"\262\366Z\250"
+	.ascii	"\023"
+	.string	"C\202.\002\243%P`\211\2208\236 ~\264\265\301/\004\2210R\206\007\243\205\215CK\032\264\275\301X<v0\320z\360\362\244\341\331\201\336\224Xn\276/vt\3201&2$\305\"\344\\C\373c\313\263wS+|\224\n \335\201\203\244X\200\310\235}\244\0349W\261F\256M\367\306\354]\030\\%e\342mc\360\217\031CMj0\221\202\237?3\215\021\237\350]\013.\340\037\315~\327\327\217\246\332\233\255q\343\326\346pK8*\266\263gY`fh\207\255N\310\020\323E\277\354f\232\032c\230\336g\200\276h\253;\373\271\317A\241\263\257\243B\214\2069\373\245\td\022R\352\227\334>\216\317\277\252\230\227\224\032[\002\224\216$\022\240\222Fx\232\321k\322\201\203I\207\023S\nL\274(\250)\246'\247\035QMS<N\227\232r\302a>A9M\345xB\201\204\335\324SS\nM\3472\320"
+	.string	"\003\017,)"
+	.string	"\301R\002H;\230\232\242\246\244\320\315\221@T\323\bP9\232F\ba\005(\034&\344`\322\201C\351\311\211i\207R\216()\245\004\bX\250\023\232\242\224\246\240\240\242\224z\311\341\033l\031\310I>\304Ivpbh\3060A\243>\232\363\310\304\254t\tsr\222\003"
+	.string	"@s\023\367F\314\315\315-\213\212\332\250\0210r\rm0\230\264\250\201D\\\341\262\261d\0139S\203\023\0042S\316\005\033\r\370\326_Rt\260M\271\"\016\304\262)i\313\270"
+	.ascii	"\332tY\021u\330\2568Q\373fp\301<O\211\350\323\360YZ\265\253\265"
+	.ascii	"\370cj\334\025_E\300\317 \251\025\377H\324\350\326\207:\214\223"
+	.ascii	"|\b\330%z\b\006\036\260\3175c\225!\236\242K4\1771\212\221K\321"
+	.ascii	"7\263\304B\275\342@DR,\3761E_\354\253\330T\273\311C\241(Z\250"
+	.ascii	"\217\344\212p\210oP\364\317\0045\212;@-\354\240F\327\212:\020"
+	.ascii	"\367\006k\331\001\265\320\311\0254n\354\\\205\362\f\320\314\317"
+	.ascii	"\013\234E\312\304[\021N\2461`9\177\3729\260%q\025\312\2656*\266"
+	.ascii	"Sb\314o\213\311\322.+U\276\370\364\317\247\317\246\326\203\204"
+	.ascii	"\247H\241h\"\003\353\220&\311\001\345\322\323_Sbq\253p\232(w"
+	.ascii	"h\023\362-\341\033\3220%d:\305\204\024\242/\307\270\003\370\204"
+	.ascii	"\223\264\006\376\321\327\227\263S\342\200U\266\f2\177\216\272"
+	.ascii	"\273\227\241\244TR(\373'?O\243\240?yZj\0172S\"\201:l{\\\277\245"
+	.ascii	"F\221e\214V\034)\201^\250a0\305\240R\206fDD$I\2224\006Q\005\304"
+	.ascii	" %\241\263\033\022\240\244=H!Bjfd$)L%[\007\035\275\036|\342\233"
+	.ascii	"6\264u\356\310\315\326\206\b\357\244\2017\037$\360\367"
+	.ascii	"\374\360\202Y\264@4S\312\202\023T\026\307\023\243|\260\326\243"
+	.ascii	"\311(L\277\t\341u\262\007\202\003y:\325\013\333\024578\341\306"
+	.ascii	".\3058\0224\b\363\355\324\200\341\245\230\222\323bE\322\303\246"
+	.ascii	"\230W1A-;\276T(E\275i\202\031\371\227\n\312@\316\2005\223\251"
+	.ascii	"\037\303\265C\336R\313\023[\032\326i\322{\306\215+m\324\375\222"
+	.ascii	"JW\340\3739\270\316\320Q]j\375\276\247\366-\217[s\265\222\356"
+	.ascii	"\227\233\3369\237\311r\311\366\273\212V\325\231\364\256\020\207"
+	.ascii	"v\034\322`\335\001\274\241\203\354\2621\352\222\213\226\022\f"
+	.ascii	"\302\371\377\246\221\223\337\037\213Y%z\003I\032,D\372\241\323"
+	.ascii	"\f\252\002\035T\t-o@\306'\300\230A\204\"\330\242\227\\\22133"
+	.ascii	"x\r\250%\006#\2454\201>\306c]H\r\030\367\016)\367h\t\350\375"
+	.ascii	"\237\374\0075z\301\253U\370\023=GB\371\354\035\262\372<\350\177"
+	.ascii	"\324\234o\336\322\265s\320\203T\260\223\362n\360\177s\020I\020"
+	.ascii	"5\016\177\030\275\232\005\241{\371\205\016P\326\bK\311\250$\375"
+	.ascii	"\b(;T\020H\340\310\227\240.}\230\360!\312?\357\363L&\346\372"
+	.ascii	"\233d\230c\231;\3442\376\243\330c\321q\320\030F\211\241\001\005"
+	.ascii	"Up%\244i\254\003\003!\344\206$\003)"
+	.string	"\236\266Bzr`\214\251\326\\c5o\013[\275\327g\364\202\333\371~\201\216\245R}\273B\355f\227.Ln\021\365\226\005o+ZY\342H\350c\026P\201\256\367E\351\2461\373\024`@\0258\214\361\225Jx\304\324\\\t\356C4b\251<~\335d\016r_\323\204\022\265\020\206\207\311\024\250\013\264dP\031q`\230JI\243\003wN\216\314y\n\275\177]\224(\256v{?\007\265\263\352\023S\017\322\262\322\300\006\016O\340v\324G\241M\366\352\306\311\223\214\354T\312\361\222nP\213\001\216\207\217\013'\365\t\017H\274R\371\t\272HY\326\r-\250\036V\324\202\213\2335F;\177*1=6F\225R\214\200zOw@dj\356\004x&\2143\202n\347\203\300\2204a'\211\313\222\213\006H\007uM\227\230\007\273\353u1\222\322\315\355`\356\002\035`\245e'`\224,\376c%\026\3621\335\243M"
+	.string	"\215dh\"Z\023\257T\225\"\"@\260\242Y,\371\354\337\bw(\235's"
+	.ascii	"s\362H\0235"
+	.text
+	.section	.gnu.lto_decompressFrame.49.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`Y\006}$"
+	.string	"6?\340H\200\232U:{\273o\256g\206O~\352!\345\251p\325\007\357\303\220A\207^Z3\276\331.\320\277\332\021\273)\025i\261\277\235\360e?^E\331\217&\372\362\252\333W1\343\377\343:\256\356G\030\332t3\261\204\020\271\223\f\315"
+	.string	"\277"
+	.string	"\314"
+	.ascii	")\262\204\240\234\353\351K\026\273\242\362\"gex\214\321Z\360"
+	.ascii	"\224\213\326\247;T\207C\250\2378\351xnq\213\b\321\372T\007C\310"
+	.ascii	"Z\3467\271\223\247+]<\300\275WdX\356U6\340\336\372\224Wf\346"
+	.ascii	"g]\353\211\241\372\205\324\265\261K\002f\344\222s\357\345]\371"
+	.ascii	"\036\365\251\356\003\324\247\r\344P\247\25535E\333B\361\207\247"
+	.ascii	"\315\210=\234Z\317\025\302\032$3\224W\243i\344a5\222(\017\033"
+	.ascii	"%]6\244\321\2525\"\017\246\326\363\007U\216\247h\201\253\036"
+	.ascii	"O\034r\n\335\201\2151\2428d\021\335\335{mH)\333\250\002\036_"
+	.ascii	"n\340\220D\264\207\214\225\2327oc \245\254\235Y\270\367\262="
+	.ascii	"\"\251\316\2653\363\017f\266bV\327d\374\356\362\nZ\233TVQ\325"
+	.ascii	"\270R\312\005\374\341J\342\315 \367\236\022UE\375\312\022\203"
+	.ascii	" Gf\023\267\342[\357\275\275*%~<\347\275\367C\236\362]\250O\337"
+	.ascii	")\327\021G\224\255\303o\276\266\314\302\362ts-\031\263rh\033"
+	.ascii	"\213\371\350\355+\346/\317>g\236s\177\362\013\270\362\347\241"
+	.ascii	"Y\306\335,\337h\226wn\226m4\313\265\035\3134\233\345\325fyV\263"
+	.ascii	"\254\322,\2474\313\350j\271g\226\255j\371\006\216\346\320\230"
+	.ascii	"\201\374\016\261{i\324\231s\235\251\227\221/\177\346-\363\023"
+	.ascii	"?\312\245\274\3116\235\225\320\247@\2417\251\274C\233\325\016"
+	.ascii	"\247\223\021f\323/\325=\214#I\304\264\271W\031\025\202\320Z\345"
+	.ascii	":\342\310\365\332W{\326\375e,K\033m\265\177\252L-!\222\270\232"
+	.ascii	"\264-\2254A\264O\247\013{5u\f\325\306\002\373\251|\313\235!\370"
+	.ascii	"L\210h\315$\310\275\234\220$S,K\330\265d\334D\224\230\271ic\261"
+	.ascii	"\275oRs}+\262\025\246h\307\354\203\214\265\301\2026\026\377\034"
+	.ascii	"\324\356\237\331\3600\016\335\bn\273\340\220\361\321\274B\265"
+	.ascii	"]\264\225\246h\307\230\331\303\305\254\340\207\031\001\265:\251"
+	.ascii	"Om\003@\323\344G\254+,\327g^g\0054\363\007\020\366\307\\?GU\261"
+	.ascii	"\207l\227Ym\236n\356\207\324.\314A\022\236\356e\210wHe\025\215"
+	.ascii	"\034\353\226s\t\301\037\322t\342\037\237\362\\\204\252\345K\006"
+	.ascii	"\321.\312\006\275\0075#$\340\2220\351\200mv\202\351\b\t\330\301"
+	.ascii	"\310'T\341\344K\272\031\001\203MKH\302\337\032\364\001\225\230"
+	.ascii	"\226T\016\202\020\324\243\340`\002\005 \0023\376\001)\001\215"
+	.ascii	"\204?\240\221\211\026\302\242\024?\237\212\"\036\022\n_\220\367"
+	.ascii	"SZ\342\001%`a\022P\211\307$\024*\361l\312\373\276b\255\263\205"
+	.ascii	"\250&2\337\313\327\255\327-m\254\f\207\023\222\264K'\037R\357"
+	.ascii	"\345D?bqp\375\257\203\250\272\365\033w\353\224\313X\006g\247"
+	.ascii	"\237\267\037\335\330\272\326;\375)%D[\207}\332\326\266\212\261"
+	.ascii	",*N\255oo*8\275\272V8`z\302\244\034\231\261P}\272h\353\313\217"
+	.ascii	"\030\230O\177\271\263\263N\233\326\314\0270\330\037}\032\247"
+	.ascii	"\345&{\310|6G\0212|\215\206{\250Q8\004\231B\210(\030\2210\013"
+	.ascii	"\322B:p\"Bu\263\r\022\340\2459j\255\231\231\242V\226\375;P\256"
+	.ascii	"\352\220\207\204\037\377\2330\212\t\006e\032A\311\247\263\207"
+	.ascii	"EI\326\212E\357[\206\371\341Dd\215\201\377\027\241\271{:\016"
+	.ascii	".\214\263&\353\317q\004\2509\207\372!eX\":\371\021 *\2024z\\"
+	.ascii	"\273o\350\377\b[\336\341\362P\275\320\1776\200es\227\276\216"
+	.ascii	"$\262\303V\355\221\314dc>Ra\253[\264\001\033\020%\"4\263\031"
+	.ascii	"\322\037\037\311\330\207\273scM\227\021R\357\036\031\371\211"
+	.ascii	"8\237\361dJ]\240\204B\350 \207\376/\036[,\t\270\313\2007\274"
+	.ascii	"\222h\355\223\344\365\317\214\234\332\233\203!\t<\212\3639\253"
+	.ascii	"B\345)\357\rE\035\214k\3006\273\311x\277q\207E\260\325h{\204"
+	.ascii	"\f\301l\212\344=i\224\260:\323\307\322\217|B.\3329\024\016\203"
+	.ascii	"=\265T\"<\307\200\227\261=f\020M\355\362D\017\250\324"
+	.text
+	.section	.gnu.lto_blackboxDecoderNext.51.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\016*5\255"
+	.ascii	"Z\0035:K DiZc\333\356H_\374\017\300\007T\243\234K\303\310\333"
+	.ascii	"h\353s\021\277\257\317EL\330\310\245\366%\374WA\236\370\371\b"
+	.ascii	"\231\035=\364>p\301@\357~\021$\t\317\321\3033\212\3064\002\201"
+	.ascii	"\355>5\2466\334\276!\267L)\245\205\003_\003\231\003\254\241\202"
+	.ascii	"\363R\243iV::'\035\235\221\330\371\310\202s\006\"g\fD\316FG\347"
+	.ascii	"\013Gg&;/\207\234\213\224\316\026\224\316DC\316\312!\347!\245"
+	.ascii	"sR\351\\a\310\0319\344La\310Y\250\347\232\203\216\316\307\244"
+	.ascii	"\363\204\244\263\361\350\fttv\331\271\310\316-;?;{\005\347n\264"
+	.ascii	"#\272,: P\301\376\316\365m\222X\302\273Wd\323\245\355t\313\351"
+	.ascii	"\206\353F\323-\327=\327\315\246\273M\033\231\233\241\272\217"
+	.ascii	"\033\017\005\017\356\n\377\374\204h\030\343\204\364\376\343\024"
+	.ascii	"+\240\332OH_\337&-\265\252yK\300M\241\323|}\207I\305\016\006"
+	.ascii	"\375z\275\035\025\244\"\2329\253\023\304\t\0325\261\215\232\255"
+	.ascii	"\352S[\"\030\306\330Ef\324\211\3678\210\331D\216\262lK!Z\353"
+	.ascii	"1\007\261U\277\341\026\241\363~\215\036\232X\365}\337 8x\234"
+	.ascii	"\216\336p\334D\375\222\027\313\003\016x]6-d\306qro<\253\266&"
+	.ascii	"\271p}"
+	.string	"\275\230Y\323k\265\260\213K\252\0237\b\334q\035B\247i\272\256k\273\276[\212q\023\325\265G\235\"\350\201\2316B\372}\276\005(\244R\021|\337\027\312\234\232^\243\244\331\020\271B\226e\021\254\026\276\257Tj\354b_/\21007\325\276X\032\324.^\260\354\310U\265/\330\365\365:\272i\271&\031tjl\237Q\322h\330\256}\261o[\246\005[]{\337W\312\330\305\245v\211\350\324p\316\245\253\353\333\004\250L\213\232j!\001\372\315\2129\250\213\317\254\204\333\215\203\226gN\314f4H\276\331\267\275\254P\243\b\276\357\225\251\213\354\303\270\234\342\364\327#\027\222\257\226\033\225\036\306..\2338\2713w\265\333\224\2645I\017\275\257\225<5\357{-\301,\214]\344k\027\271]46\221\333\305\024+\224\260\263\257\323&\026\250M\240o\205\357{mz,\334\344\316Fq\242\311D\t\022L#D\204"
+	.ascii	"\361\301C\007\016\0334,)%!\035e\300`t\201\271,\262@\244\034J"
+	.ascii	"V@R\020\n:N0\002\271\305\366\335\311}\325(\374\202\272\262\374"
+	.ascii	"\204\237[\2377]\361\222\323&\374\272\004\266\260\312F\"\257\231"
+	.ascii	"\362\340\370\b\027\007\020q\370%D\031l\225\r\304\007\275\366"
+	.ascii	"\320\216\230k\213\322x\007\271\346\320b\220k=\314)\313\023\202"
+	.ascii	"o@\323\032Z\fhZ\017g|\t\333JY)\366\256\214'\321Y\361\336\210"
+	.ascii	"\240\347\"\265\365Q[\3253\374\230\275*\033\006\243v\t\316\036"
+	.ascii	"\264\263R\266V\311J\025\303\013iY\351\2323\333\0163\305Mg\245"
+	.ascii	"dZ\247\020\350d\3514i\027_f\245\\\322\244c\274(M\272\245\263"
+	.ascii	"\3221n\241\2000\"50\345P\362,M:\365\nd^Y\032\331\216\020\313"
+	.ascii	"\353\240\263\322*m\321\234\262<}\2475\244I\305\234BK5\024\322"
+	.ascii	"@\3465\245\203Z\022v\300H\351\2544\254%\212\"g\247\323\244S\374"
+	.ascii	"\230&\rk\227\366ZCV*\305'\254\310\373b\274k\016h{U62/\264\006"
+	.ascii	"\002;vA\251hi2i\024\367h\227\305\2165\220I\321\\\267\bU\213\036"
+	.ascii	"2\2578]Dv=\267\274m\213\232p\211\006u=\333\021\202k\372\364]"
+	.ascii	";\007]Z\376\355\3266\350\234\275\251\032\222y\311i\007\212\361"
+	.ascii	"\276/{\264\313\2539E3\377\225\231\351\230?T\005\311\377\267\350"
+	.ascii	"\027\226W{\030\267\234L\205g\322\331\"'\314\324K=R\r\352b\220"
+	.ascii	"`\250\276\347z\351\205s9\231xG\251>\311\230\326_}\231\002\223"
+	.ascii	"6UE\312\213\024\225(\335X<a{F\027\357Z8\330\302}\253\235Ks;\273"
+	.ascii	"\\#O\341\271\235N\334\247'N(@a^)Z\242x\026\no\224&\372\025\365"
+	.ascii	"\225\302\215\274\325\013}\277\351:'\225*N\017^\214A\377\212\331"
+	.ascii	"\257\004\300X\346fN3\243\320\027\t\237\030\371\226k\013\306\260"
+	.ascii	"\274\254\007s\352\304\342d\316\263\244>#\357|\321/'V\337hzJ\213"
+	.ascii	"\217\261\235\321\2534\305\324\3600\3453m\r\334.Z\375\321\231"
+	.ascii	"\025\013O\227\177\265{'X(x\345\2070\316\260a\001\261S\001\253"
+	.ascii	"k$W\n{\230\032\264\276\352\032\024v\2603[\257\245\260\272\346"
+	.ascii	"\304;\360'\f\210\341\360M\034V\312\336\365\246\026\205\t;\007"
+	.ascii	"\fhtk$\267\213\335c/U\317\313;\366\212p.f\006\354<A\261)\357"
+	.ascii	"{\325b\f\350\321WD\373\2029\"\023\240\204\254\bo\321\f\307e\352"
+	.ascii	"!]\234_\274\243\274\364\374\253k;\335\206\353Wc\350\345y7ezq"
+	.ascii	"\327Un\3135\017==\345\366\\\363\020\202\263\023dv\202\351:'\263"
+	.ascii	"0\362\221\200zT\353\272(f\361i\216\357\022>\303d\351\035\256"
+	.ascii	"\271\371r\2230\3112E\354}\262\273\t\357W\376vO\271\306\237\360"
+	.ascii	"\305\267\247\030;\331\372p\n\251\217\235d\272\004g\233\361\221"
+	.ascii	"\374\254Xv@\317\354,\323\177\242\226\323\216\016\242h\034\017"
+	.ascii	"\364\237\346\031&\253\357\257\316\363"
+	.string	"\224\221\201R|\263>]\374\031\355\377\027\037H\017\n\366\326\276\321\033\264M\326\231\026\342\002\371\177\227\017\332&\313\023\333\261\034tik\235\256?\225\333\237\226\377af\031M\3504\372/\375\254k\200|\267\351\245\007\362M\bE\344\336\323\2143\303\310\035\345v\261\377\355\270\244`y\"7\366\217L\026\307\267\233\236\032\303\272\353!\354\037[\366\375\362\272\320\236C\374\251e\337<\335fz\t\204\326\243A\207\276(3\223h\301\032\bL\337\367m\241@\007\3360\276\357\313\002\260)\246\001\246\360A\233:bU\264$\017\260\006\3061/\016x{'\332\311\030\226\223\300\355\326G\270:\251\341\340\353$0_\263\374\315\260n\177\300\370\2550O\223\316\215\005\351\334W.8\367\027W/ih?\265\372u6]g%\256\263\001\\\347$H\332N\363\021#VTSR}\355\036\002\344\350\214A\005g\250\266v?\2613"
+	.string	".8[\340:W\200t\246\240\341\232'\340\321r\315;t\3448:Kpt\306\301\316\021$\235!H:?P\344\354@\322\271\201\2443\003J\347\033L\347\005\230\316\n$\235m$\235k(\235i0\235g0\235\023H:\313H:\307P:\303`:;1\235\021H:\037\220t~\221t6 \351\354\002\351\334\302u.\200\351\314\202\351\274\002\351\254\"\351L"
+	.string	"\3229\205\353\214\202\351|\202\351\334\204t6\241t.\241t&\301tfb:\217`:\213X:\2078:\203H:\177H:{\3506\315\035\212\2349\260\363\006\244\007Y8\034\300\021z1\024<~\231'\213r\273\350 \334\232k\353\261\214\037s\"\225\246|B\374A\231\276\030\025\304n,\337\323o\323<\305\262\270\271\346\303\246\212\372\364\330I\346\2458\333\220\323\306\362E~V\275\356\351\337\223\274\266\261\346-\334\003\347\351\033\357n\202\207"
+	.ascii	"\206\206\r\206\304n\332\271\034\0369\246Y\367P\232v.7\375r\020"
+	.ascii	"8\274\313\235\031\271.o.\213Qa\003y$\027\267\214\316\032\274"
+	.ascii	"\013\033^(\315\355o\207k\300"
+	.string	"k\302\361\216n\370\245\245\327\360Fo4f,=\006B.)X\310\204\2151\337\214\223\036\351}\214[\236\226\377\321{\257\244\207qfEz\025g\255\026*il\226G\337in\177G\017\264Fo*\326\346\235\210u\363S\364f\\\004\267'\216\333}\372\013n\017\027\242\326z8e\277\023\252\324@(\235\220\321\241\275b\f4\016\310\241=\001\223\221\017\225\rJG\304tE\331\024{\352\211\t\365\363W\314A\343\214R\337{T,\224\016\310\352y<\327\240tD\376\264\241G\214\322\371S\236z\\\204\032\372+\350\240q\306\251o/\3243P: #\277\343\271\334%\362\255\tJ\337\262\002\247g\025\342C}\003\2453R}O\251]\240t@\276\325:\236k\202\336"
+	.string	"\216p\314pP\307\367\334\216o9\036\337h&\360(\227\0055-\034\236aN\223\216\326/mm@\301\222\357\271\232w>\332$k\372\251\230\036q\273\230\341}\004@j\223\006\004\263G\2244\300#\200f(\311\367\235\036\232{\352\341"
+	.string	"\251\344+"
+	.ascii	"\374\222\255\340+x\347c\370#\017\215\362\317&\236v\023\026\267"
+	.ascii	"\366[\257\205\341]\275!S\234\337|\243\357>\035\377Z`|_\255\304"
+	.ascii	"&\236\256\206\301\025v\021\361\320\350\213\204a\331\367m~\277"
+	.ascii	"\325\254(N\022\3768\2414\013\233#t\007aok\357\253\305\302O\237"
+	.ascii	"\033n\007R\022\013\235\260\321\202\270]l\002>\251\340;\333VF"
+	.ascii	"\345\236\036\355g\032\350\203\210I>\211\257\230\341\215\035\341"
+	.ascii	"\220`\217\256\323\247\307\003\235gy\246\006h\221d[m\311\270\n"
+	.ascii	"i.\342\017\234/\025<O\217\003\232{\034\017\f%\337\321\257\242"
+	.ascii	"9=5\310:\241A\307\002vy\235\356:}\336\247\301\212\346\006~\247"
+	.ascii	"F\313\271\235\033=\344\301]\tb\325\273\304#\337vz\t\353\312\037"
+	.ascii	"\371\"\337_\367\235n\352S\316\236\241 \026s3\214\323a;n\301>"
+	.ascii	"\307\263M\302\266\351'\3324\274\362\315\006\213\355\241\236\375"
+	.ascii	")\226E\207\227}\361\264Q\360p\314p\317_s\f\254;\207^\3151(\274"
+	.ascii	"\031{\020S\367^\367\226\247\036\342\221DS\360\\\334\207g\017"
+	.ascii	"\221\366}\311`\b\232\341\372\206\243\340\233\353\375\020\212"
+	.ascii	"\210\345\211\256\320\233\265,\264\376\226\004\275\025\276\360"
+	.ascii	"L\277\275\250\013\337o~\326\275(\346\2638k\245:y\037\034\227"
+	.ascii	"\357\177n{\316"
+	.string	"\345w\360\263\306\351%O\364\026\276\241_t\304{S\364\030\224q\ttcg\341\237\257\216\r\321c\240\303\305\217\b\r\375~\276\362{N\357\351\230K\243|W\017oI/\371vr\007\235B\323\003\351L\207>\250]\366y$\016\304\363\223\316\254\216\305S\227\200\367\234\247gn\0366\023\275\243jd[\177\305\275\327J,\2362\033\220\231\020\265\226\245\372\n\237\374\251\037z\337\322f\256\374\203\241\377Q\266\345\256L\226[\003T>\200\314\370\001\365\364U?\240\236\332*+\"A\214@QI\031\237|\020\311\340\210\017)\240\"T>\212\3508BI\035\3311A\210\017(\252\"Un\225\215'()\251 QU\024\252\240\2542\360a\304-2\304\212\310\214\247\f\240\202\3748>\005\311\300\207\221b\325\017(\032F(!>\250~\0249\005\001)X\2708Q\200\013\023G@|\201\t*\250'\"\027@=\t\240"
+	.string	"D\006\020u\201\217\f\006\3204$\210\017!M\027PU5\231"
+	.string	"\301D\244\240\250\232\212\020!B\325\024t\305\352\267\302~\302\255\215y\330\250\304\3215u\237\022\330\244\304\321\225ph\003"
+	.string	""
+	.ascii	"\3171\260>\213\t\n\t\036\3077b\033&\301\037pV\246\215\022\205"
+	.ascii	"\343I\370=\2378R\330\234\210\340\033\321\r\2123\202_\236\021"
+	.ascii	"\025\376\2515\375\032;4\2616A3\236\250V\335\3523\301\246\233"
+	.ascii	"b[\004\315`\007\251l\335~\270V\242J\026\202w\322z=\360\020|{"
+	.ascii	"X\326J\333&\017"
+	.string	"\304u\355\221h\232\265L\234G}|\006\2430=X;\320r5\355\222\372\332(\323\201O\362\263\016B!\323\215\035|2b\320I\003\277\244\2052\360\r|K\210\245\335j\265\030\240\222.\360H\376F{\025\330\2767\024\370\005\024H,s(\202\004\033\217xX\343m|;\302\331\223\360\247F\341\214G\3624\374\350\371>4\022\370\031\t\370i#\f\261G\306\363\231B\332\263\214\3612\276%\324\362z\246\220\004c<\222\237\240\323#y\030#\3640~\036\030\b\274\023\002r\336\364\366@\034\360\177~/\376\200-\177\307\316\213\273\017\006|\235)%:G.\336\200/\352u\3719SJ{G.^\311\317Z\347y\254\\\036\374\220p\207\257\341 \264\231e|\034\347\224O\231\016-\276|^S\255=\214\016J[\260x$_\300\212g\361\305\303g\232\212_\361n \031\016o\306*\300<\036\333\251\bd\333@"
+	.string	"\365\357\246\216\212|\321\301\024O"
+	.string	"\3249\245\251\226\342\233K\312\211G\362(\276\237a>\256\233\376\304\273|&\276\351\201\370\224\330@j\366m\013\255X\rm\022\222G\302\031\"*\365\327[\360\\Lm\342\233\314M\216\226\377a\3736lg\"\r\311\227X\323\303\250\246\004\023\3612"
+	.ascii	"gz\013\236D[\263\3143M\017\343\326\3139\317H\374\353E\277\226"
+	.ascii	"\336\fM\217\226\233\376\031\272\257\242\233\233\237\222\237\316"
+	.ascii	"1\342\231\276\237iJ?\"\260\312\233\351\306\006\206\355\031\275"
+	.ascii	"\\\361Iz3\256\252\221\201\322\035=Zs\233\241\303\347x\256\207"
+	.ascii	"c\377\263\nV\327\336\261\337\302\200\031\356\200\361\273q\027"
+	.ascii	"V\373\376\003l\021\321\312\016\250\366\347\253\334\206X5\325"
+	.ascii	"\265\037c\234\276\322\367\232#\212\210\017~\255\351v\030\035"
+	.ascii	"|\021\337PD\020\357"
+	.string	"~\210o\371\236b\262<\361\355\305\200x\023~\326'Aq\037fJ\351\314\211\322\231Oc;\244\300.$!\274\027g\02731G\232\347\"\244\302\322\017\3540\233\343\273\r\322\233\251i!n\267i\001\370\311~x-\237\305\303\177\370\"_\223\356\247\217\305\003\022\316\317\330P\224\317\333\321\022\310\273Q\0276y\326\305a\002\371\016<\236\215x<3y\274\322\216g\243\035\317\314\035\217\344\271x\251\343\331H\307s\313\324\361A8\336\215p|\035j\030\224\216\211\343\335\347\362%\322\273\021\322\253x\022ra\"=\006\317\305n-\304\355\360T{0x+\026\246\204\321A,@9)\306\270\3302\0341\371\313\033\362&\203\236\250\022!9L\262R\251\221\021\021I\222$\255\001\322\n\020\206Bi\032\247Tz\022\200\2445IK\246hd$I\222l\255\001K\241\350Q\177\241jdh!v\363\241\232\371\";\370\311"
+	.ascii	"\271#X\260@\305\340\326Q\312\271R\004!\371\312\333KrF\246?\246"
+	.ascii	"p}\300\203b\fy\272s\315\375;\266\\\226@\273\250m\3021\237\375"
+	.ascii	"\326\312\335#\204\351\t1\301z\345/\225C\036\247\204\242b\342"
+	.ascii	"=\351\253\320\217\013\001\224 K\254\365t\364\002\270E\030G\207"
+	.ascii	"\254\366YQ\002t\244\305\243>\222\205x\206\211\372\253xJ4\207"
+	.ascii	"rMi\312\343\211.\222\322\t\360p\234\235D\354tAZ?\272\200o\337"
+	.ascii	"+V\235\375\324\372\374O\003S\374\007\345\233M\"\316\246\352:"
+	.ascii	"\234\365\367\224\f)\344\374Nm\237\277i0\345\177\260\276\331G"
+	.ascii	"\bYpq\242\352\301\220Q\002Pg\001\n\027;\333xq\2037\377\250\356"
+	.ascii	"\356\343;"
+	.string	"g\353\002\354A\325z\262\277\306\211\270\020\324Q\275\306zV\215SdVBv\204\362>!\021n\034\233\342\021\201R\"\236P\277\3541i\363F\316\264\255Q\262\262}\2401|\247 1\326\021\030:V\033\330\343\371\326x\005\355\031G\321I\241A~\357gzy\t\325\354\257\344V\253\300\272\342\3271\17720\367= *7\233l\026&\245\324\227\266.\372\214\303\026\246\273\220\252\2705\217\270\213\237\277\216\002y\300\373yM\026h"
+	.string	"4\250%E\330\231\016\340a \234\016M\361\323\304\211\221\\G\354\377\366\023\255>\361!\304\030\222\216\244\036\306\324\352\200H\377\023\232\013\374\214\025\253\236\203\357lfK \201q\205\213"
+	.string	"\3213\322\235;\220\240^\215\242\021Z\f\213\222}/\2437\230\006\202\335\f\276t\323\212?v\177\360\335\205\374M$\216e%\037D\017Y*K\b\036\307\373y\270\375(*A\2712\236*\244\214\342mt\375\214\340\340\02005\201\224\017\243!\366D(\210{\315\315gz\317\002/Ou\037-z\332\005\262\235<\330\305\271\345\335\332\322"
+	.string	"o\303\347w\326\316\266~F\214\357\326er\230\320\021\253\b\027\217\004\212Va\f\2571`9\301\264=\362\034\013`\361\360B\336KYr\237\230\214\026\253\2535\023\341$\240f:(~'&\3724\356\022I\304\377\177\r\035\245\306\206\013>\240!\"\242\251iY\320i\335\357j\335\007\343\331\324W\216"
+	.string	"\265\375\025\005\026\210\233\211 :\024,\276\237\031\361\021A\003m\272_\354\251T\343#(\237:\224g\2706\004Zc\341\234\364\314\257\276\356#\216ct\342\005B\374\270\037$\267\354\211\214\f"
+	.string	"\300\327\202\256\234\355\nW<\325\367\315\345q\306(\3455\210\2440g\025\2161\2310C\331-\221\215\350\224\275\331\005\005n\346\372Y\035\215\306\216\3226q"
+	.string	"\341\n+Jqj\326\003\343\212x\t\372\030\031\377%\270\253?\315c\013Lg\317\215\360\2447"
+	.string	"\250\374\242D\352\003\201\205\3775\005\2565\353P\333\250\r-\315\274}\204f\364Ajn\213\205p\211;A\263\007\205\311\330}`\211<\236\207\374I*=\347$BV\2146\255\013#\2567{B\016Fb%\343\330\224\201\b<\354\300\316J\033\245\2574^~\316zO\203^"
+	.string	"u4\357\035\331:\372\276H\267t4Qv&#2m\215\271X\314%\306\244J\304\222\355W\374\245\346\243\365\243\177\007\307\037Mi\362\005\310?\320\035\207]VcJ\311Q\275^\260\021q\330\236\323\276C\b\225\032n\350\275\204W\220/Bv5J\f\354\306.\351\351\263\213\275\232\032r\252\r\352\350\r\276/\277J\004\237\220\267\022\2671)\302\3316\331,q\314\005\277\225\224\312\263\005`\252gT\t\032a\3131\206\211\225$\252\275y\252\314[\263\332\035G\331\0043H\345D\212mw8\303S\222a\263nd<\372\373\021\260\330\342\366<\244lX4}\267\200\234\262<v\262\247\225\242\367\275\361\232\013\274Xd"
+	.string	"ky\244n\215\233\331\274=\204\340B`\034\364\345\271\200v\003r qg?/\327\201MQeP\244\211`uU\022|\231\024\020\326c\245\006\031\004\367\365\222\276\026)\035tq\314\017R:\004K&\005\030\027\277\363\006u\331O\3578\214\317\307TZ6\036_\236\305ySE\b\311d\324\177\032\230A\3773\203\300p\251[\314\3541\342\ne\347\221`O;L\202)\363.\241\331\2151\226\3728\2521I\372\305!\326X\325}\265\246\272\323`U)#UF;\371\222\310\241\314\360\3363rn\223\201\344\264\214F\201]R,\3615\313\016\333\363\266\017\215\263\207\357\205\005\222\262\017\262:Pk\007\250\322\362\2069\r\022\nC\242\220=\266"
+	.string	"\242\340\334w\003]f\334\026q\370e\273T\005\023\262\246\260\256K\223\330\036:7\006\\*\310\223F\340\215\267\246\220\221\372\326\340\277\201\237.\372\004\242\260^\363\351\3142\224\301\023P]H\022\304\236\007_\001\272\357\254\304X\320\3536)\002AD\030r\241\263_)\022\334\240\263x\332\033j\302~\262\336m!\314\343\357\020=X<\254\016Rg \2262\2120:\377\313\242\0319\255X\333\355\307\243Cv\344\022S\237\354\2512\225\274E\212\246b\333\024\031\220I;\370\241\037\021y/E\255l&\031\365\334\314n\213\352Q\375R\254HI\330W\372\277\313\373\362\307\215L\2737\365\273=\254\332\277A\270\031\021N%\325\003\027\223\034\227U\270K\211\003\240\242\320\177\373"
+	.string	"l,\\\341\356\302- G\244\324\246\234\247|\027\215]\362*'\036\244\315{K\021\320r\020Xx\242\333\by\373F\264\023j\327EEzU,\232\223\226\225\2450\016\354\267\374Q\353h\215jP\006\036\245p~\004d\316?\305\r\020Q[\224\263\216hN\202`\236MH\314\204.\207kD\320\313z\267Po\313\330\200\3234l\304m?,\376\312^\326I/\2617,\311\256\226 v^_Z\256\323\374\203\250t0{"
+	.string	"y\251q\241\204k\263\322\305\2342\311L\021\344C\221[\355\"\213\020\013;^\020\2536\250*\032\241\322\271\230\261W\023\207\210E(f\255S^\002\036\265\354y\262`\245\006\203\032IL"
+	.string	"0\245\3432\260#\231\377fQp\377\211\2229\371P\203\323c?\027\345\355M\\\272mZ\347IK\364\253\211\3111\331;\212\211\252\372\202\23495]\242"
+	.string	"L\206\236}\363\007\376\265\bY\373\001\\\373\244\025\\\262\006~\031\335\rax\325\364\224\367\020\221\007%\024X\374 \362\250]k^\267\343\320\200\253\252\017$\265\323\322c \005\225Bv\\\367=\251W\016\230"
+	.ascii	"r\b"
+	.text
+	.section	.gnu.lto_blackboxDecoderInitSegment.52.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`m\003\325\024"
+	.string	"V$\202I\260\324Q:\330\200T\321b\344w(r\265F6[D\2052\306\306\337\035V[\267;\333|\250\372\377\002\374o\005\032{\3731\007\n<\355\3023Z\346\250\317Q\237\001\237\323|F\342D\231Q\024\357\370\225\225|\262\311\226)\005j"
+	.string	"d"
+	.string	"o"
+	.ascii	";5\237Z\330>\212\255\022T\302\322\251\232\221I\"r\320|\314(\360"
+	.ascii	"g\005\300\n\315`Q3~\252\330\230\271\332\217q\031\272#\001=\300"
+	.ascii	"\356\021\226\216]\340\002\313\306O\003\257\"~\216\027 ~Zg\027"
+	.ascii	"9\360\267+0~#\226\222\354nL\252\270\356\252\363\277\364W\317"
+	.ascii	"\267\273\272\036\354\256\265\347+q\313\333F`\233\307\226O\001"
+	.ascii	"B2\277\006\207\235q\305\247\377#~^\266\\!\361t\3137 T/=\215\275"
+	.ascii	"\243\304\023\371\222\266\315\203\276\347\003Crge2\341B+\270\272"
+	.ascii	"\304\006\356T\246\260\037\356\356Z\036\331W\372aO\372S\016\374"
+	.ascii	"O\216\364\277D\265k\252\305\251\236S\035\206j\031\2525T\177\005"
+	.ascii	"WDD\302\367&\247]\242-&\001Crg?\310\207\236m\341Q\027>C\251R"
+	.ascii	"\275\023Z/\2671\374G\206\026\253,\036\022*\032\321\326\360\036"
+	.ascii	"4.?#\255\340\237n\327\234\007\001\253,eBQt\033\321\336\360\035"
+	.ascii	"6\006~Y<#R"
+	.string	"\332\263;\301\344\245T\020\224Ri\323\216\003\304\270\2732\377\006O\r\366\003\022?\025\252\027L\221\227*C\250\241\027A\272e;\347M:\343n8>5\231\273\315r\270\351rL\203\030\231\f\003\00720\005r>\265\236\234\032\316e\032\314\255\206c\243\325plB\330nvh3\236\233\230\217\316\254'F\273\341b0\tl\353P\273\305r6\333-\206\002\334\207+\217\306#\276)\236\f2\213\272\270\256p\260\037\204[E\030\360s\311W5\021\253$\234\210\310\344B\376\3629d\302\247\246\022\026\r_\036J\233B\005}\317(F\001B\250Q@'\035\2321\t\222%\2055\034\320\002\221\251\252\007\021\220L\311\f\032\031E\022\035\363\030\356\305\004\\\376\321\333!u\255\207\247b+\021\266\265\350\374\005\0379\271\272\353\036EJI\265$\025Q\336\264\023\243\0022#\264\241\007\266\b\234\300\347\206V.r\350\267\027"
+	.string	"h\340K\025\004\2168l\334K\334!-\fj&\216\r.\0070a"
+	.ascii	"\350\"\367\205\343\177fI\375\247\202\272\274\024\246\002\254"
+	.ascii	"\277\307A\304N\177\t\201\360+ \374b\310T"
+	.text
+	.section	.gnu.lto_isIntraframeStart.53.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`j\006\225'"
+	.string	"\232G\270\017Fp\\N:S-w'\337Bi],yk\242\025\364\351w\351p}\023\202\320\306eV\227\351\361\206vF{\255\324b\205?\027\3055!\342,\2033wID\260\324^\f\240\226\211\353X[\333F\b!D\312$\003\355"
+	.string	"\324"
+	.string	"\346"
+	.string	"?\256\300\265Ho\nq$\225Vhp!\336%\365\321\206\220O\2652cb\"\275\031$'\211y\367T^%\352e7\376Sk\2227/\265\036\033,Rzs\217\027\2367\323\003\2357\217\"D\255\224\320\325\324\334\003\262\264,,vj=\032\365\222M_\036\277?\226zO\020\370\363\365x)z\232e\263\324~\352=G\276\307\206\214n\356H\027\221\007\305\270\2000\260Dup\265y\222\313\253\2340\027\007\344iC\370W\244\244K\310}e\0050=v<\311\025\244d&osO\353\225\n\204\274e\304b\236\220\247\345"
+	.ascii	"\2573<\236\344\362Q\036(\022\343\372\301\350\251\210\374\f\032"
+	.ascii	"\263\314\2532h\264*\207\265V\237\021\213\273T\340u\206\207\317"
+	.ascii	"XU\n\325 ys\344Y\207\021\213\031\275Pk]\3262v}}\276\373\243\335"
+	.ascii	"\235\261kF\t?\374-G\236H\265\226\210|\255w\204\"WR\200<\324\004"
+	.ascii	"z@\013\350]\025,\370Z;\314\352\251}\032K\236\005\251w\344T\256"
+	.ascii	"\333=Nq\177\355\276\254\235dwy\213\206\277\362\017\335\312O\340"
+	.ascii	"\307\177\300\313~\001\313\033\004\224\362\002X\336\237\224\327"
+	.ascii	"'\345\355Iy\203)/\220\307\373\353\361\372P\336\036\312\313\353"
+	.ascii	"\361\242<\3363\3455Q\336\362\344\355\243}yy_`(\217\331\232+d"
+	.ascii	"j\355\346Xw\334\341\251m\346\232\223\243\375Z\316\273\027>I\332"
+	.ascii	"o\331\247\255O(\306\345]\242\216\266a\206V\307jD\315\322\332"
+	.ascii	"\250\330\251\265B\2457\207\345w\243\366\310\365\t\277\222vw\237"
+	.ascii	"\345gQ\3272\303\247&+O\216l\214\\\255\\\013nn\214\364fO\020\006"
+	.ascii	"_\373\004gO3\234\031\\\260\201\335\323ChXkU\030\316&C\260\017"
+	.ascii	"'\254\354\327\3006\341<\271BC\272wq\336\374\365\267\200\364\032"
+	.ascii	"m_\037k\254\374\2329y\335k!6,\261*\276\333\263y-\200-\313nw\303"
+	.ascii	"\221.R\264\217\374\313\302\206r\332\246\360x\013\276%\272\340"
+	.ascii	"\334[{\006\310 c\251\207\363l&\2634\034\316\346!\255\325\ni\177"
+	.ascii	"\246\003\210\324"
+	.string	"\306y\363\354\240\260\345\263!\022\332\342\240\240\375\36563\206\306\356T:\315\006\322\2058\031\245\307\271\355\212\370\230\021b>\220\370\033\260&7\3677\316\233f?\356\255\027L\025)`&\201.\373'V\342H\032e?-\214\017F'\347\245D\376\351\354f\273]\023G>\245\265V\244n\toeT|w\376BG\215\221\226:\337LfpVL\267\001,\336\004c\251\230\302D\021\243\251\241\232\236R\244p:\321=\202p\204D\341\201\004\n\016\206V\020\241\226\212\304't\211\016\212M(\234\210M(N\324pbrA\\z\301d\024\203\305\022\f#b\361\311\310\001\202u\222\321T4\202rr*\032\371\216\365e\355$\313l\310\350\262\324\202E)\0362\2663\265\363k\017\n\352\275@\325U;\243\254\365\210\205k\371\345\254\360]O\177\001\350\2426\321\262\326\252\370.\216\022\021\030\034\241\033\200&\"R\304"
+	.ascii	"\027#U\301\257\375\247\037G\355\247\243\212\\\365T'\243hM\001"
+	.ascii	"\373\353I\031\337\260\267L\271\201z+\375\2069\201:CY\347\b\320"
+	.ascii	"^\240\342\272\377\267c;\313\361\033\016\251\270n\031\034\250"
+	.ascii	"\207},/!\2679d\222\225\353x\215\007\0232\276\376*s\237.\272)"
+	.ascii	"\021\271\t\340\323DoO\373q\234\r\361\3622]J\264z\035|\250a\034"
+	.ascii	"\303\020s\212\031!\231\221\240m!\035\200\002\0212+\036\020Xg"
+	.ascii	"3\312\260\031S\343\371\027\t\304\304\372oa\222\035\333\023}1"
+	.ascii	"\274C1hB3\350V\230P=\2135\204\215\247\202$\234\301\216\236:\372"
+	.ascii	"\330\022\013\344\224\216D\277\260,\266\013\204\320\234NC9\343"
+	.ascii	"q\361\355`1\302\3301R\256\261\tpB\210\304\030C*\277f&1U\032\350"
+	.ascii	"\330\323\241\277&.\372\231o\300\200\326\210\tZ9D\347\274z\371"
+	.ascii	"&\303^\\\377\331\016\337\271\027\314\277C\007Fa\bKM\246\013w"
+	.ascii	"\225\232y\bL\245\316\\f\326T\324\247\370Y'\372\365\030ap\276"
+	.ascii	"a\030\tmP Q\306\032\"\342\200\374\230\350*?f\333\373*O\0360\034"
+	.ascii	"h\272\217\236\215'>\333\253\317\200\020j\277j\302c`\371\377\365"
+	.ascii	"\374\302@p\325\032\261\277\271\365\304\250\\q\037-\302:\232="
+	.ascii	"\270\031@=\326\365,\364\004V\003"
+	.text
+	.section	.gnu.lto_blackboxDecoderFindIntraframe.54.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`\033\004\205\033"
+	.string	"&3\263I\240ZQ:\334\003\343\023Lz\25540y\350[\253\216\177\372\222\344\235<\245"
+	.string	"'N\240\215\341\256\275@\303\337\206\332~\257O\347Wh\345\265\340ux\r\253j\260\207.\2025G\023\256\343\032\372\227\021\365 \204l\"e\222\001\243"
+	.string	"\220"
+	.string	"\241"
+	.string	"D\212aj\r\"8]\"\030\020$g2\324\240\355\021\235\225\232\013Z\007C\310Z\025\211jJ\202y\n;Ac>P\304]\265>\025\235\324\032L\260>\346\351\247^d\304\352\272\004\211\335\f\036\"jzI\314\324\032\234m\3601\362\324\274\016y\3326\266d\335\315\222\244c\263not\363*\005\323\211g%\337\021\227Q\277\223C\246\226\3048\251`:\345\235>\022<\216\020\240\264X\312\361!\215\254\003K\314\177\244`\342>\361\224\006\225&I\276\337\271\374\251\265.'\371T|m\276\273/v\327\303n\027\003>\373%\023n\346\216\323\275\b\362\364]"
+	.string	"\013\270\343\342\276\352\2771\246xU\031\315n\320\210\033j\367>\277*9\266\237v\227wG\366\340\037 \006\373\221_\347\302\357\353H~\327\201\177kyqN\312{3\362\332\224\274&\311[R^r\344\245$\357Hy\373\303/\217\274\027\220\323\345\204\357M\312\324\272TLS\265\320'=>\374\205\347\335\303\224\320\366V{\342\236\260%\303-S&r\346\351wG\354\253\366\204\031\241\355\n?\264\352U\275\317G;}\233\346\276i&#\305\246\t`y\311\212\341\372!C\006\355@\232\215\243\372\322bW\227\335\352"
+	.string	"\275\013T\343'\231\315\323k\243%\273\244\035k\262I,<!Oh\323p"
+	.ascii	"w0\2544\t\263\306\017d\254qTXH|\346w\025\003\300c\357\360\033"
+	.ascii	"\205<{\367\202\020?)\326<\2746\332\356\261\017\246\267\346\354"
+	.ascii	"Ww\217QxB\254\262X4\230\031>\314\364\302\372C\235~\303\272\231"
+	.ascii	"\360\244\216\210\037\2038\035\310Z\361\352\013\317\263c4\353"
+	.ascii	"\352\367\253\231\013O\352\210\213\273\253\341L\206\314Z\221\002"
+	.ascii	"\034\236\023\032\022\332@\203\210l\235\263\025Y\260p#1\324r@"
+	.ascii	"\270ZQ\271\f\0320\360y\240\300\301\203\236\001\345\326zp\266"
+	.ascii	"\240[\315\026D\001\304\255\202\206\032\320\206\n3\"!\240\241"
+	.ascii	"Y\rW4\3531\2607\0166\334,w\273\341f\347\356n\260\276\237\226"
+	.ascii	"\313O9\212\036\020`\357u\344\211\377\257\027\265\206\3564\016"
+	.ascii	"N\357\317\256\217\314\206\332\005M\244\254\313&\206\365\331J"
+	.ascii	"\257>;\302\025\342i\026\247\263\177v\214\346c\255\265\226\262"
+	.ascii	"\005\217\265\254\317\223\222Ye\255\340\241\227\032S\310\206\332"
+	.ascii	"\234\252(\036c\254\271\225vo:J\250!,\005\021S\306($\022\211\320"
+	.ascii	"\204\n5\006\260\002\0311\353\006\021`\265D\244\\\353\277?0Y\315"
+	.ascii	"\362\032\304\237H~n\366\032\031|\315tH\312!\337\241\035\372\200"
+	.ascii	"\332\037\f\302\355\214\fq\357\274\225\265<\230\265\373\242K<"
+	.ascii	"\3529\273bo\3141\007R\")\323\336\2112\"I\223S\251\003\310P\320"
+	.ascii	"\315O\325\264R\304\2114\003\324\257\242d\364\016 :\241\272P\236"
+	.ascii	"\r\324\033\006\220\003\235\247o\r\207\376\373Y\003\263\200\242"
+	.ascii	"\377X\241x>\256\267\002O*?hJ\357\013\253l\250\265\230\274\225"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_CSWTCH.37.93.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375 \221M\003"
+	.string	"\324\004\204"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\f\013\n\t\b\007\006\005\004\003\002\001\005\001\006\325"
+	.string	""
+	.string	"?\202\210\200\350\001}\310\001\307\001\306\001.\305\001,\304\001/\303\001/\302\001/\301\001/\300\001/\277\001/\276\001,\275\001/\274\001/\273\001-"
+	.string	"\r"
+	.string	"0\263@; \f\234\200v@\0308\001\355\2000p\002\332M\021e"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.symbol_nodes.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`1\006\235\034"
+	.string	"6o\260C`*q\016u\363\200\031v\3632E\r\342C:\b\231adO\233\273g\257\226x\032\024\345^\332\277m\323J\266\226\255eC\252.\2016\n\367h3Uq\207\375\357\027\376w[5\312l\265E\237v\222\001\250"
+	.string	"\233"
+	.string	"\231"
+	.string	"\237\201\306_\230\361\025z\205Zs\366\311\370\246\206b\247*\3063\301x\n/~\002\2334aQ\\\274\204\2545\365\345m\361\fX\374\202\025\257@\305' Y\250\253C)\376\207\342#\220~<\036\217'\036\201\2117@\346\234{\210U\"\347A\002\3445\344\"\361\007F<\004\246$+\036\021\277\324\244%LN\210\177@\301\321\325\027\210w\300\024wU}\370\006O_"
+	.ascii	"\310\205E\212\207'\220\377\204\221\022\307\351}\255\004n\245"
+	.string	":|/\266\256\353\312\341w\262\225e\241\312\344\3749kAu\036\024\310\214\030\340\347\310\234s\331 O\316\214\341\235ns\273IKX!\336\3514c\243X\204\254\360NG\335\346\t\357\\\361N7\341\316t\252\350\024y\247\377\260!P5I4\300\364#n\316\364\"/\221!\255\220\266\225\242\3244j\323i1\215\315YN\\6\331ts\330^\347\353\215\243\0013\227\271\355\210\026yM\345f\336T\207b\245\013a\275\364\340K\226^k\3178\227n\276\206\272t\364\355\226\362\002\366\244c\336l\227]\334-\035s\247\334\036|\f;^\203\216\317hr\374\006\034\017\274\361\031\313\306[\250\021\336\303\330\246\0368\355.u\036I\251\367\336N\211~\346\324R\257\275\355Ya\307\"\232:\352\346R/\343Y\352\262v\226\372\323/u\231k#\243b&vt\265\244\2327\334\336G\320\333\206\227\344g;\023\340\262\231"
+	.string	"G\341\316r\334T\021\026\240y\3074G\331^\362\322\323\236\250\233p7\027>\205\264|(\311\205&\217\025\002\250\267\261\235\312\n\006\264C\335\251="
+	.string	"\3522\270\311?^K\266z\001\374\307Pw\272\017n_\303\225$jwz\316m\224x\245\213w\372\315\330\273\371d\333\273\246\250\001\303)y9l'4e\305(\247\3446\266;\036C\024\2528\357V\305y\360\206s\232\213\302\306s\370\273\371S\357\346d\030\267\013L\026\215`\260\"c\003\260\022~\365To1mw\321\f\225,H\2527\027\326\214\273\310\016a\203\304@b\0371M\365\0361\2177\370\312T\357\261"
+	.string	"T\327\265\r\314*\303\226\252\337\334&\037\221\251#\365S\275[\366[$o\243[[`l\251\037\201;\246\244\212\270\224\272\221\330\b[\244\rbl\244=\353\022]\352?\\]\032f\250a\024\313:h\214\242\004\205\245Qk\300\002!\"Z\035\021\200 \210\2543\"\022\t]\220\002\017\231\212c(\240^W\312j\312\2746\357e\t8\357\367\224?4\353\274$;\006\002\n\214-=\310\301wmU\342\265ci\336Y+\217\360J=\261b1X\304\374\371\\(\237*\027r\227F\202\210\001\244\251\351/\205\272\204\026\001\207\204\243\204\324\023\200F)\314\311d\246\025kE(\361\3228\0315U\360R_\377X"
+	.ascii	"F\364\373\333\207\303\243{\334\323f\323\244a\343'/8\333\3273"
+	.ascii	"\004\347\236\244\030\b\033\322\367D\262\337\374\266\214\254P"
+	.ascii	"P\260\ft\200\005\341pM*0\003\375L\200\346G\345\005\006\335\262"
+	.ascii	"\205\271\332~\0317\240\235\266\340\037"
+	.text
+	.section	.gnu.lto_.refs.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375 \022\221"
+	.string	""
+	.string	"\016"
+	.string	""
+	.string	""
+	.string	"\001\013"
+	.string	"\f\t"
+	.string	"\001\025"
+	.string	"\f\362"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.f7e8eac462a63035,"e",@progbits
+	.string	"(\265/\375`QT\025U\001\25266zV NA\225t\375\376\372\317\f\225\350?\020Q\254\315!\022fe\224\016\221(\030!w\260\035M&\317\356O"
+	.string	"`\007\020\353ro\315G[qZ\300\231\364\306X\373j\353\373]\006\005$IRJ\352\277\204P\016\322\323&\345\260(\346 \227R\253VB6\331[\356\024k\006\217\007\314\007\350\357\r\364\327\t\315\201\275l\331\352{\033\210\276\237\376\216\242\321P7f\316BsX9\347\217\360\357H5T\265\333q\305\344Z\351\357\245\251V6\262\3329]\260:\275\234\363\377\246j\033\215\243o\324\264\247\272\306\273E#\275\323\327\271\277\223S\355\242\241n\204\322\034\024\001:\251\272\276\020f[\224\322m\346\336\276\241\267\\\350\255\017\364\326\006\312A\315\301\r\3657S7\365\214\272!\313\356\250o\303\350\0305\375\240e\274\235\372\351\246P\232\323\234S\234\3561f\315\254\357\206\252\203\273\346\340['\364\365\003l\003\003\353\007\270\022\331y\277\230q\323\013[\352{\333\204v\262\352`\003\324\034\3744\007\213Pu\360\355\021\n"
+	.ascii	"\254\252\203\273\312\016\275.\022\352\2416*\201\226 V5d\033\300"
+	.ascii	"/@1}\233\305\316\273\250\346\350(\313K\337\332\200\350\206\356"
+	.ascii	"\301\005}?A\337G\320\372#\2559\370M\206\276\275\320\312W\373"
+	.ascii	"j\n\242\372\24582U\272\320P\353\373\276B_A`\034\020\370M\003"
+	.ascii	"}'\321\367\020Z\177|Ak\326\035Z\203\324\241\365\013.\tZ\205\300"
+	.ascii	"\325\034\\\361\376J\245V\251t\255\f\300M\242bd\252o\275\262\363"
+	.ascii	"z\227\203\223NiV\3139\343\320\330\370\261\204\244\357\003\327"
+	.ascii	"P\016r\325\3017\327\034\\\311\340j\016ne\325\301\036\324\034"
+	.ascii	"\\\211\300\325\034|\273\252\203\377\372\004\204\215_\225!\257"
+	.ascii	":\272\276R\272\372\322\2672\251Mj\372eu\362*W\347.C\224\346"
+	.string	"\263\2343N\345\021\027\304\243/\007U\007\337\232\203_\311\320\025\344\234s\375\022\237\201\201\201\201\365\3138\2673l\t\225\332\222\245L\226\036\331\216\276J>\310\344\375\361M\365}\315B?BZ5\273\t\342\220\363\2156\254\234\323W\261\177\007\256\242U\263j\347\224\346&\017\270\035i\215\360W\"\277\210\021\025\256\032\251n\032\f\345,\365\224\023\205-ML_\316\351\377z\244\"\251IjZ\341\252\332\353Z-\362\017i\316D9\347\020!B|\250NYF\200\350\255n]\333\352\333\253[e\273\210\021\257!\312b9\247\325\355\346,Tk\0077\265v`.\177\b\231\341{\025\240'\2425\255:\370C\315\301\347A\037\002\364\035@7\32433\f\370Df\326\367\257f\177\r\253b\265\314\"\221\224Y-\347\224\203=\022\342\345\255o\025R\207\324t\203Jv\021#n\203\312R\261\234S\234\232\245\245\036\312\276\317"
+	.string	"Z#\342?"
+	.ascii	"\246\362\2107\372\272\001\256\201u\003\374\264\352`\264\346\340"
+	.ascii	"\277MS\002\177G\261L@P\301\3608\374\346\362\257SAj\225\325\375"
+	.ascii	"2h%\177w`\343\376\226\263K^\202\203\267\245Q\371p\321V\003\252"
+	.ascii	"Z\331\345\313\256\346\276\376\312\342\257.\376Z\303_\215\376"
+	.ascii	"*\364\327\241\277\026\375\225\252\372\250U\235\301_E\320\003"
+	.ascii	"\370[\203\277\t\360\367\006\177E\376\265\305_\3054\220U\322/"
+	.ascii	"l\222\277?\374\025\320\"\371;D\215\361W\031me\217\274\370+\214"
+	.ascii	">Z\270\277\215\032\204}\353\026X\267\277\226\250I\030\340\216"
+	.ascii	"\376\332\364\327\244z\343?\231\035\252b\266\355\267l\277\205"
+	.ascii	"z\tk\344\257^U\005?[\244\203%\3617{\374\266\003Dl\331o\317\376"
+	.ascii	"\266\251<\376zv(\221\206\250`W\302SEP\363\376\372\345\257{\177"
+	.ascii	"U\373+\332_\327\376\352\345\257F\376\032g\307j\222\277.\377\332"
+	.ascii	"\345\257M\376\372\344\257v\177\345\362\327(\177\255\362W\276"
+	.ascii	"\277\336\3755\314_\375\252\230\303\035\004U\314\272\300\257\006"
+	.ascii	"\302\250\300o.\200\252>\375\277\373\353\214\260\223=\004\325"
+	.ascii	"\253r\201\275\203\337\344\360\037\256\205\026\254\347\257[\366"
+	.ascii	"\353m \250@\376\323\225\271\340\372U\037\177\265\262^\365\352"
+	.ascii	"~\027\313_u\324\252\337\002\2513\376Fk\020V\353\267#\310\372"
+	.ascii	"+\215\277&\340\2576\260\252\324o\257j\016k\365w\006F\324\250"
+	.ascii	"\277\356\370\353\324\337\351o\177\374M\202\365Q\273>Vk4\017\333"
+	.ascii	"\243*\377"
+	.string	"\neST\361\370\377\3015\220\301B[\007~\023\252C4\fv\307_\273\254\216\261\352\005\"\315\\R\241\301l\216\312\002Y\315o\016u\b\253\200\037{\303\342(\321a\033~S\005\177\035\376\365\347\257*\376\212\343\257)\370\353RCY\252\337R`\352\267\027\260\321TVy\020\234\347\3407e\370+\f\266\303\337#j\374u\003\177m\341\267\033H\375\265\304_c\370\353\013\277\245Q5\360\333(\013\365\327\f\374\325\204\337\316\260\n\370\355\323\337)8\375\225\003\177U\372k\007\376\372\325\346\337R\017A\007+\343\267H\177\207\260\310\363%\300>\3427M\370\255QPu\372\253\211\277\3668\b*\013}\3437\277\351\302\337H6\377o\273);\315o\002\375-\346\2671\370;\004\013\203\337\236\366\005%B\360[\027\274\314\034\300\377\022=\274\377\245\373O&\002\333\202\377\032<\347\277K\262\017>\374\017\300A\320F\367"
+	.string	"\374w\355\377\330\3779\020\374\377\240C\224`\301\337\036T\274<"
+	.ascii	"\376K\344o\017\330\025\377K\330\343\b>\363\3370\270\037\371\217"
+	.ascii	"\244\314\022\377\177\360\237\354\267@\375\201\343\374\027\310"
+	.ascii	"o\205\277%\301o=\360\333\027~[\201\337\226\360\333\020\277%\300"
+	.ascii	"os~\213\376\375\3677\336\337R\376\236\373{\371w\333\337i\177"
+	.ascii	"\223\375\035\3667\327\337W\177W\375}\343o\251\277\243\376\206"
+	.ascii	"\361w\322\337\310\277]\360\367\212\277\207\177\237\340o\237\277"
+	.ascii	"M\360\367\b\376\376\300\337\034\374\r\303_\375\376:\366W\300"
+	.ascii	"\277~\375\265\353\257A\376j\365_\311\377\266\2773\360\367\013"
+	.ascii	"\177_\340o\027\376V\341\377\334\337)\374]\201\277#\360\267\t"
+	.ascii	"\177\217\370+\013\177\223\360w\b\377\375\376\016\361W\021\374"
+	.ascii	"\327\340\257*\374\r\342\257\370\177\211\277\021\360\267\007\177"
+	.ascii	"\037\340o\003\374\335\301\3377\177\333\374]\3637\315\3373\177"
+	.ascii	"\313\374\215\376}\376\215\377\256\177\377\257\201\177\025\362"
+	.ascii	"W\260\277z\375\225\353\257[\377c\370\353\325\377\272\377t\377"
+	.ascii	"\313\376/\371\277\374o\366\337\304\177\271\377\002\b\f\f\f\374"
+	.ascii	"m\242\376\031\f\374\022\350@Zc\277d\277\315\272)\0257.;\372\222"
+	.ascii	"\030\262\363;\326Br \253\372\342\232\203\257\220\377f]1\034x"
+	.ascii	"\345\005\251\357\341\252\016\276^;\277aD/\212Xu\375\202\375\327"
+	.ascii	"\353~5Z\025\f\027O\372^\255\352`\231\232\203k\330\316o\027\216"
+	.ascii	"\224\267/V\\H(\264\251,Z\277A\376\013\344n\211@\342\241\243\357"
+	.ascii	"\231T\035L\223\265\363\253\205\275\220b\300\372\316\374\370\305"
+	.ascii	"\372\257\325\275j\264\022\234?\244 \301\364\265zU\007O\240\346"
+	.ascii	"\340\353c\347\367\207=\202\"\364\245\257\004j\016\276U7uV\252"
+	.ascii	"\\Q\336\0355-\346\216\242\372\376\246\005zu\334\n\305\240{3+"
+	.ascii	"K\241\370\260\361\244o\352\301\251K\351\206\271dn\312\214\312"
+	.ascii	"v\241I[\2000\246l\230\301\360R\327Wi\343\347B\310E\337\333xA"
+	.ascii	"\233l\027\324\b\027\352\276h4\233b\235hfO;.f\\\250\313\024\245"
+	.ascii	"w"
+	.ascii	"g\334\247\033uk\\\032W\252\246\027\352\302\370\215qe\334\344"
+	.ascii	"\205\272NRz\027\312\216\331\300&\022@\340l\220\310\356\306\334"
+	.ascii	"\334\333hAmZu0\211\232\203o\263\004\275\315\021\3646h\350m\306"
+	.ascii	"\320\333d\241\"\334%\272\332e\266\fS\262i\217eU\322\0068i\214"
+	.ascii	"\244\033Hj\365\n\026\215\271\026\227\273ZK\"\033Gm$\205\016i"
+	.ascii	"\250\2068Sm\017\214\216\276\257\351E\252\300\005\205\345\032"
+	.ascii	"\335\242\273Lv\207~\213\376KtY|i\323\326U\265\325\327*\253\016"
+	.ascii	"&\241\346`\333\266\363;T\267DoL\250\321\220)\207Jt\305V\026T"
+	.ascii	"\303\345\n\310\221\233m`\2157>\247\276\200]C\233\020T\337\333"
+	.ascii	"(\305\330\277\232\3321\226l\214\035\263\251%K\242FX\214i/6\f"
+	.ascii	"\211\242$\006\210\270\351\345\234?\204\b\201\271t\020a\202\257"
+	.ascii	"_\0067hqH/}o\323\002\235b\361\204`\201\261_\254\027\333\305\366"
+	.ascii	"\325\324\362Y,D|6\213\345b\311\222\350\033\2255\313g\313,\033"
+	.ascii	"\211\242\244L\022\026j\226\317\272Y'\226,\311\001\034cz|V\316"
+	.ascii	"J\261dI\231&\034C2\b\021\"D\210\031\251&@+5w\257\277\224\201"
+	.ascii	"X\372\276foKM\255\236\325\242g\363j\230\033\24243\311\260g\365"
+	.ascii	"\302\013M\342\033\343\344\336\327XA_\323\206\276\346\f}\315\325"
+	.ascii	"\335\007\034\034X^K}_\003\003\375o"
+	.string	"\255\324\324^\261Tn\232\257\330*GX9\247\037B\234TD\230\332\356}M\022=\r\030\3644Z\320(Axrc}Os\004\375\bsJX;Ol\335\221=;\013\245\246\366\211\245S\243Q\305\211\025|O\223\206\236\246\007z\032\034\350if\240M\366\242\\\005\351\373\0310\350\353\334\033\016\032zK\233\344o\325N-\263 c@\022(V/\372F8\322F$$\311\262z\321\027g\231X%vIM\355\322\"\271m\253v\277i\316D;K\013\207#J/\347\024\313\2267\0363\3673W\320\317\234\241\237\311B?\243\003\375\214\024\372\231\026hM\315\301F8\f\031a\351{\231,j\326\fG\225U\263Dl\232\fYV/\274\354\232-RS\253f\317>\340\272\270\251\214\257E\273#\222\007\244\357e\276\320\313\364@/\203\204\036\rD\217\356\241G\355P\2321\251\223T\337\243N\320\337\016\261B\300"
+	.ascii	"\223\360\365\265B\254\330-S\332\314\304\030\032\312}\217\032"
+	.ascii	"A\177\033\006\206\235d\3248\312\335g\0257\343\313\013]C\342\362"
+	.ascii	";\301\3342\215.\256\021\256\254a\245gxE\236|\t\262u3t\025\206"
+	.ascii	"H\337\337j\335n\375\035e\201T\272\2669\f\030\245\276\235\253"
+	.ascii	"\016\266Y;\267Z\004h[\036\351{\326\034{\205%JRH_k\225\242jz5"
+	.ascii	"\276\372\036\375B_\347\300\3240$\306\222yp}WM\232\216DQR\306"
+	.ascii	"h\250M,0\213^\220mj\242F\336\351\331\375p2\246\002j\321\253\232"
+	.ascii	"\213\262Mm\245\271h0\204\314\331\005\t_Xyp}#\374U\267j\347\224"
+	.ascii	"\203\366<\020\242\227\007\327\327\245~\251t$\214)\363\340\372"
+	.ascii	"|X5\351\243\336\321F6\305:\323\250\352\364rN\321\252\331XMS\323"
+	.ascii	"\343Q\351\250\350j\260M\235\324:l\n\227\001\263+zG=\344\364r"
+	.ascii	"NmS{\251f$\212\2222-\206\206\350\215\311Y\210\311\003!Xyp}Z\362"
+	.ascii	"\354\362\340\372r\316u\266\251\241\364\224j\347\2243\023\210"
+	.ascii	"\2574\017\256\017K\026\252\300)Vp \367\270T\274\033\242\r9S\375"
+	.ascii	"au\361R\361,Y\222\005*1#D\214\260MULu\263)\326\211F\325\247W"
+	.ascii	"\241\3346u\237U\262d\311\f\2608\262.\254\f\353dgX&\033\303\302"
+	.ascii	"\2607\354\017\373\302\342\260;l\017\013e\253\254\224\235\262"
+	.ascii	"5\254\016K\303\362\260Tv\311\372\260O6\207MZ\245\265a\243jj\233"
+	.ascii	"\372\313\033L\363m\261MU\257\342U;\265\234\231H\030\203\313\203"
+	.ascii	"\353k\352._Z\262$\212FUD\357\3126\265V3!Q\224\334\300\320\233"
+	.ascii	"^\3169\204\315\013/!F\023\270I\225\307\326T\213\276G\247P\"~"
+	.ascii	"_\035e\205\300\260rN+\0211W\200>\260\372\317\n+\347\324\346\252"
+	.ascii	"J$\214\227ma\221l\221=\262H;dk\260D\326\250\246\226\205\rz\215"
+	.ascii	"R\245\374\006\32607D\0332\021U\217jgY\364\230\032\306\222%\321"
+	.ascii	"4\263\037!\210FNg\036\356Q\030\350O@\364'\027\364g\025\364\347"
+	.ascii	"\022\375Y\004\375\231\242?\203\240?y\240?\241\320\2370\320\032"
+	.ascii	",\264s\b=\006D\217\271\334\275\271\374M\245\253\364\236\fT\225"
+	.ascii	"\230R_\275\017\247\222e\033\\\337c'\350\253X\226V\253vN\0332"
+	.ascii	"\221Y\022Voi-5\355\274\306{%\322X\330:\257\313Z\215DQR\346\210"
+	.ascii	"\nI/\3474\304\207\02022\202\214I\341{\254\004\255X\f\355+;\357"
+	.ascii	"\273\022O[_}k\215-\264*s\325\301\036z\312\337O\332\256\321f\376"
+	.ascii	"r,1\322\267\243\354\274\245\024\211\342\205\324\367O\002k\016"
+	.ascii	">\346\201\342l\227k\016\366\240\2549\270\235\264\\M/\327sOqn"
+	.ascii	"\220\030\255\311\365=\236B_/\207cP/\207\217]\240\177o\275\231"
+	.ascii	"\374\215\325Y\035\207Ct%\216I\337%\027\212S\f\274\2767\373\320"
+	.ascii	"01@,!C\032l\314\316[\227\365\232\006C\310\213DL\220\266\006\263"
+	.ascii	")\026\013TH\275~k\027_V;\265\024\264\302\350y}5\330\215\315Y"
+	.ascii	"(\020\013I\303\365\262\225\264['\351#5\355\267.\3626\322l\377"
+	.ascii	" \366\367\330[\247\rv\023\224\346\240\363*\315\203\353\363k\202"
+	.ascii	"s\262\341\336,C\177%\255:\330\006\251\003]\373{\254\311Z\255"
+	.ascii	"\246V=1)i\265N\303\t{\221\303G\306\2219\"&\b\214\276}\326D\336"
+	.ascii	"hm\226\033\215\004e\316B\215\206\363\227\263\020N\255\035\324"
+	.ascii	"\332\301\005\243\272*\202\357\315)\364&\r\364i\256:\370\346\013"
+	.ascii	"\024=Be\314 t&suW\r\323\024%J}\177\271\2404\271\346`4W\035\\"
+	.ascii	"s\315\3015\271\346\340\006\262\363\336\212@\217\033`}\255\026"
+	.ascii	"\324N\345\252\203IP\326\034|/\312:\364\227\r\255;\256\027\372"
+	.ascii	"\353#\027o\001\321\302\272\226NB\022\204F_|\365C\006\211\024"
+	.ascii	"\216\251\276?\213T\201\302\352\373\034(4\307\006V\036Sa%\256"
+	.ascii	"\262Z\342\212\234unR^\030\307q\3251\217s\355\356(K_\274\003\353"
+	.ascii	"\3009\360\215V\243\341A$\211\023\236\262\361\002\355 \206a\034"
+	.ascii	";a\030X\312f\031\203w\236\211\361\3624\343X\352\230\206\210\021"
+	.ascii	"\027y\352\230bdH_\034\005\365\324j\230J\031\035\233\f\034#'\t"
+	.ascii	"\355\300'\342?>:F\372k\212\217\260\213\017\312 .\036\320\315"
+	.ascii	"\350\232\303i\262\343\n/y\354\342\270I\304\210\317\311(\303\344"
+	.ascii	"-\231\224\360\322\333P\f\0303Wf\030\361\365\305I\027\255&\253"
+	.ascii	"\310I\037n!\323dt\005\267G\305\002n\013\2323\007x\034\004\210"
+	.ascii	"\221\026\n\2110\260^\2129a\242c\344\261\221\210\021\327\362t"
+	.ascii	"%J\250/.\372\215\023\035\022\275\276\307,f\200\3408\353\352\373"
+	.ascii	"\006\224\305`b\352\213\207n~\214\221\372\321\027\013}Y\343d\245"
+	.ascii	"O\007\316f\340\0254GL\304\1773\313M.Y\314?\033\005\315AivR\006"
+	.ascii	"\355\211\220u\304\205\244/#\235@\320|\341q"
+	.ascii	")\371r\363\357\246\030\021#\276d\273\202\265\243\257\031\346"
+	.ascii	"\225G\0274d\337\233}\246\337/#\223\225\205\r\260\357;\254\241"
+	.ascii	"&_\003h\204\261\361\327\367&\230\035Q~\004\351\333\365Klz\371"
+	.ascii	"\226\032'G\372\240\372\232]\276\305\206\215l\207\251wsoY$\245"
+	.ascii	"\357;\220\241f\336\315-\277L\315\241d\027\245\357"
+	.string	";\210\241\277\251\345\227\251\331\363\021\243\252\357;t\241\357\200\205\346\374Q\241b\342q\3605\246\326aA\022uw\023\257\351.\224\026-O}\315+\267\013V\313pv}M+fQW\031Y\301\3655\2534\241\036\242\324\325\231R\276\334\242\334\224\202\243$\213\307Z_\023\212\335\223\016\031\325\031\022\027g\316}\370\332q\244\325w\277\2444!\"ws.\213\213$Q\372\232N\314\242,ubt}\315&\267\013\026\223\306\267\324\327d\322th\016\032[\2428PAu\002\337\336\314\345\210\245#-/(r@\372\224\334\\\266\331\r\260\034}\315$f\021\r\236\026\017#Hn\300\325XCb\036Q\252\261u\245\304B~oXp\027\206[\240\337\213\276\347p\004\325 \213\271f\256\231mX\344\216\264\274d\364\240\370|\260\335l3\265\320\342\360\372\232F\272\317o\007T_\263H5\273\301\032Z\376\340 \004\335"
+	.string	"\320\314\314Lk\241\307\230\251\2043B\273\231\026\344\245\354E_\223\310\355\202\305*K\217\276\346\331\345QC\226\265G\305\201\n%@\233\020!&\031\356\361\205\303,a\334\2457\311L\244\020\255\263\276\346\330\355B\206\345i\252\2579\244\325,RW\023\215J\207\357\266l\030\365=\007#\264"
+	.string	"L^^fX\013g\217\032\326\0072\251\007v3\254\325j\356\204\360\374\372\232_\267\013\r\322S\322\226Z\227\230\026U\372~C\036j"
+	.string	"!3\313\3142\271\252\016/'\0205Cfg8\202\334\344\372\337\016\255\027}\315\255\24071`\372\232@\232\016gJ\016\256+}M\255\273\204#%\346\017l\t\032"
+	.string	"?\037>\314\253.\034"
+	.ascii	"\221\263\272yU\227XIH\274\372\232?\314\"@\027fQ\033\320\320\002"
+	.ascii	"\250\345\310aV\345\361\270Y\205\267\266\350%\3655w\350\340B;"
+	.ascii	"@S*\315\033ilT7o\\$:$\316\n\225\276\346\224Y\204\203\004\247"
+	.ascii	"\366\324\327\264\321jKBy{}\377\245\351\352\250\244\f\365\375"
+	.ascii	"\206\034\350\353W5\245jjJ\335\"\031dU\262\320\221E/'\213\026"
+	.ascii	"\360\rQ(\007.L\031\246\f3\212\207\322\221V\237\031u\243\007d"
+	.ascii	"\314Q_s\206Yd\022}\351\310}\315\247F\273\303\321\203\257\257"
+	.ascii	"\351\324j2\376\234\002/\262\246O\r\215\255\3577\030\241\037\332"
+	.ascii	"\314%s\311\204\021\264'B\026\336\213\2330\270\330\340\261\244"
+	.ascii	"\257\351\342\306%aR\3232\233\314*\266\027Gf\223\311D\003CJ\316"
+	.ascii	"\013\340\215\223\276#Tf\322\222\031\371\362\262\022\203\032\200"
+	.ascii	"\212yd\036\231"
+	.string	"I4V\226L\244\233If\266E\220r\257\257\331\242\246J\024\336\262\232\321P\321M\241\313C30\003\0044\221[\266\034iy\231F7\2218Z\234\310\005\351k\022\231Ew\200aB\314\"\223\205u\022\007E\316\374a\024\026\325\327\034\272<\342\330\370\206\372\232B=SmN}\315\240Z'\201#\251\032\372\232\331v\331\"xw1\372\336@\3335\004\314\026&a\376\313\340\272\245\2770}\217S\207\n@\216\217\357\376]!\351\211\371\375\253V\344\320b\364\275a\200\312\374\244\372^\277j\206\306\230\021\365\324\367\366\321t\341\241\275pC\0070FO\357~\251j?\374\274\374~\251Fnea\272\240:d(Y\353\302\245\312\213\013\335\236\265Jg\364\320\316\374\366\372\013\016R\251\350\256\357q\302\320\003\330\310\222\345\346\235FG/\264\374\346U\267\345\023\027T\337\177i\243\3772&\025\230,o}\217\363\003="
+	.string	"X\225*\027\317)[*Z\216\264\274\356~\361l\210\004\255a\365\275WN\250\255&6\372^+2`\264\274"
+	.string	"~ya\034\t\243\353{\234'\364"
+	.ascii	"\177S\246\334(\033\362\020\225#,\034\026\250\007O\236<\271Q:"
+	.ascii	"\347\234\261\3164\252/=(\277Q\236\327\202\013\013\230\276\327"
+	.ascii	"\256\004\030I\216\324:\233!XV\226\354\241\t\310rr\227nfh\306"
+	.ascii	"\334/\035\335%\253\232\341wS\207&\200"
+	.string	"K\304Er\223\374*\271\222\333\004\3159\007\245yi\003X\216\264\372\262S\022\304\177\231\3746\371E\214\250aj\262\0064\310&I:\372\376\313\215\373/3\343b\357\016\031w\227HA\361B\242\304&\371\232\346\372\336eUKs\316A\212jt\351\373\2335\364\257\357\037\347&3\315pC5\370\257\257\346+\210\337\246\332j\200\377\367\022H!\347!+v9\347\352\005;\231\222\341\245\357\177\016\362\377w\316A\312$\007d\3169\247SL\034\220gSI$\321\224\214\212<\233bB\236M\0055rN\210)\231\247\202\320\254d\312D9\243H\241\234\317\224L\034\220D\231\ty\226\2234\351T\316\351T\020\232\n%s\316B\025\231N)\221DSL\034\220DSL\371l\212\251\"\317r2\023\345d\007d\316L\371lj\257\"\363T\022y\246d\342\220\211\374\230\324\320\005\211\213\332\226\276=\221!\211\262\222"
+	.ascii	"\274\210\224I;d\252\254p9\007\251\025\345dMs\236\3129J\331\001"
+	.ascii	"\034\221U\020\334\220\235\322\351D\224\346\234s\320S\322\020"
+	.ascii	"\225R&\035\312v\310-e\212\242\234\257\344$\022\202jP\232s6\312"
+	.ascii	"CA5\347\2424\231\363\220\262\004N9\347\254\254S\214\222\331&"
+	.ascii	"\023\t!\rQ)k\212\206\224Fy\313F\3159g&\344\031\225r\347\b\332"
+	.ascii	"\031V\036J\203*\022I\231\261\362\225\251$z\026\224"
+	.string	"fd\316\271v\261\341s\243\322\227\3228!\333\206\274\375\3025Z\t\242\264n\340\350{\201\354\374\276\231Or6z\\7\2651?Z<\351{\333\376k\344\262\335\330qqU\351[\221U\007sP\373-\362\337\265\256\241\221\240\234\266\364\275\2519\370\246\355\374\252]\251\311\311\365\265\25198y%L\314R\3315\273gntDr\364\005Qu\260Ysp\225\333\371-\2737\300,\005&\2064\030\203\0338\026{\216F\232\241\260\347\205\340\f=-\370\374\254 \2460\346\004\207\302\237\241\220g\305\020\305\214\220x\354\271'\202)\020K\024{R\240\3403\f\036W\240\302\020\205\3208\203\242\207\005(\204,\250\t\036i8\341\346\0304\002\005\201\260\216\n \023\303\342\321x\016\203?4\250P\001d\242x4\232@\370\343C<\026\217F\\L\361\024 \240\030\n\213Gc\bA\237\025?&\206\302\020\212\306\025!"
+	.ascii	"\340\347g\305pH\034\236* \026S\034\211\303\363DO\360\347\006"
+	.ascii	"\213+T\\\025@&\200\202@\330g(\\a\203\236\342q\350\202Q\310\341"
+	.ascii	"8\f\002\241\b\306p\024\016]\020\300q\005A\f\034\205C\027r28\016"
+	.ascii	"]\030\3001\310\202q\205\340Px\001\234\026\202E\342\321\210\343"
+	.ascii	"\200\021@h\001\205\022\035\210\001\005\231!Qx\024\016\205Ac\261"
+	.ascii	"G\205\007\232c\261\347\030\003\n\342\005|\206\302\0235F\032~"
+	.ascii	"T\250\350\3011\372\364\004\21381t(\006QP\354yAhs\002\007b Q\302"
+	.ascii	"N\f$\360\220\0201B\f#\360\210@\321S\"\347\004\016t8\201\003\306"
+	.ascii	"\241\f>"
+	.string	"=\301\r\030=\334\204\260\030\034\006Q\240'\241\204\006\224@b\005\347I<@\204\007\210\200O\342\001;;\017(a\007}\t;\3668\024\332 \317\211`\nE\017\307c\320x\342\004\021\033y"
+	.string	"\020TA\303q\306\210m\216>D\024\212\304b1(c\344\221\341\005\027\212\304bQ\205\025@Bt\005O\317\261'\005\017\307 \220\360x\215<\031\250\b\006O01\244\301\210\036\215=?2F\236\001\030Q\364\374\2340\203>\304\027f\216\307\036\342\317\n*\b\016m\214<\007\030\022\205G\023\303\025+\364t@\321\363\263\302\261\207\370sB&8D\217\303 \320\321\270\342\004>\026\030\n;\034\237\002\004\343\211\240\217\317OPxB\001G\236#j\224!\b$,q\034\006\213\305\025&l\214<\004@A\374\251\t\002\2550\0067\200b(D\201\202\370cc\3449\261\301<\016\2033\250\200\202x\201c\n\024\302\237\025n\216\307#\r'\370\004U\250\020\242\300Xc\3441\036{\2161"
+	.string	"\240\247X\f\036\207B\032\237\340\006\243\n\0242\303\340\fA\032c\020\250\247\270\302Q\305\212b\221h\302\306x\3549\032M#\017\207\236c\217\317=\016W\020Q\2409\006W\374\364\314`\032yZ\b\200\361\2349\362\004Y 4b\237\240Q\206\343\n\202%\212A\237\236`\212\233\343S\250`c\3441\236\b\246\340\363\023\024\256 \200bO\n\0237\b\3243\274>\301!\na\fF\241\n\031\024C\241\017\321\3040\210\026\211G\023B\237`\021\206\236\343O\320\347\306x\"\350s]\270\001Z\201\001\016@\304a0\005\030~zf(\006\217C\027r\202?\307#\261\230\3428\024\002\321\234\b\026\217=&\230\341\034\022\205Fc\260\250\002\210h\202\346\370\024 \030\177\210&"
+	.ascii	"\242\301x\032yRh\341C\320\207\210\202\314\321X\024\236\2309\362"
+	.ascii	"\224\260s\034\256 \2320\207=@'N\254Hq\026\203'N\2548A\204\"\361"
+	.ascii	"H\004\242\351\260\202\240\317\320\205 \220\260\204\217\360\247"
+	.ascii	"\207\003Ca\017\020\216O\320g\250\002\n\342\017\272\002\035\022"
+	.ascii	"\205\307\236b\360\350\002\207 \220\260\304P\330\363\302\321\330"
+	.ascii	"\363SS#\302\270\202(\234!X\204a(\354\001\262\351)\236\240\t\002"
+	.ascii	"\021S\250\200\370c\2341\006W\374\364p\300\250\002\205\314\221"
+	.ascii	"G\304\b\307\241\360<\376\203\023U\004\213!\034\211\304b\b4"
+	.string	"?D\342\t<\346pE\261\030\234\201x\032y\200z\202\305c\f8F\242\n\3533\f\332#\017\211\343P\270\342\274\210\021D\224`\202\b\0160\001\004\rn\202\t(p \003\006X@M\200P\f\372\020M\004}xV@4\001\nL\364\374\230 \204\241\260\007(\004\023Ec\b $\340\377\331\304\224\202\323\325\305/\215\211\271\304\031\333\302\222\027g\316\235fTilK\254\222)$#\356\3112\217\256\212^\021%&\f-a\246\306\364M\321nd\205Ar\245$du\345\310\227\332\204OI\006\234\211\274\311r\021\367\344\355\376!\205\2460q;\305\312\224p\177m\025\217\216\254H\226\276)\004\276\270\020\353\033\200$i\247\221\247\235EjN\346\034\004\271\366\263\210\225\241\"O}O5\263\310\362!\221\221\347\301\f\375O4&F\222\256\372\356\004\245J\234;\257\242\272\276\247Y\237e\347\331O\263\3644+"
+	.string	"\316\f#L\2640\031\262\313\216\r\255\257%J\225(\333\020\330\214\276\247\020\033\203\300\300\300\300\277\234\205N!}\216\235C~\n9\316y\305\013)\204o-3m\354\371u\205\341\375"
+	.ascii	"\021S\003X\0248$\260\032\372j\020$\310\371\025\344\364j!\t\313"
+	.ascii	"\331\365\323K\255\211\221\275\276'\327\355\242\304o\331\302\303"
+	.ascii	"\025\372\237[\267HM\266\313\021\005H\332\0201\244!-\\g\245\364"
+	.ascii	"e\311\313j\263\211r\003\t\025\254\353\306\303\224E\345\n\016"
+	.ascii	"\215\301\202\354\311\352\006\251![r\261\365\303$\363A\225\305"
+	.ascii	"N\037fU\025\266|\366\300w7vc\201<\316\252\326\241\027\305\326"
+	.ascii	"\367\036q:\232\322\326\327z\371\370\262J\236:\3140\260&\271\276"
+	.ascii	"'\216\036\322\372sK\331\224\226\2227\314\250\372E\331\227F\225"
+	.ascii	"b\270\2451\264)\334&\243\374k\352\262a\336\210\002\223\313\241"
+	.ascii	"tq\2125\211\2119k`\251\363\006[\321\223S\352\222}\231B\347\342"
+	.ascii	"\244\001F\206\004S$\252\301\210DM\245PW\b\213\344\034\213\031"
+	.ascii	"Dh\254\240"
+	.string	"\315\255\235O\270\352\314\212\307S\337\017\226\224N\247\323\205\322)\303&\231\314_\024\020V\3255ga\004\245|\347\213\2372~\306\0201\342K\260'D[\372\376\204q2\375l\372ejr\320\020\322\322\367\036n\240g\322\346\313\036\327T\337s\311C\r\264\203\036\347\321\231t\036\235Hh\020\336\331\342'\322\362\354\355J\025Z\336\334\022\252\276\367\220DS\261\234\323\033\314\345\303\350\310i\364\023\031\303\006T\337\223\305Y\324\205U\344\356Z\362\200dA2\244\3579t\022\341\354\300ZK\362-\327\303\351\333\352\303\023\302\\Jabr\234Af\022\315\323[^\332\231/\326\214R\362-\b\007\232\177Qn\ba@\034\264\347\265\3277UC\242\r\355\370\243C\305\316\264t\351\213\2007>,\006\363\3410h\220\224\032X~\307a\374\234\376Z\364\305}5\f\232\306@\202\342\201\005\372c0\267\311\231\022\033~}\023"
+	.ascii	"\305\005\177\301\\\260\227\232\223R\222\216\264\274p\227c/\313"
+	.ascii	"\260\026}9}(\326\303[\360\336\261\336S\254\207\363\207Sk\007"
+	.ascii	"\r\204\315\005 \276\t\360\202\261\340<\214\005kA\203`p\202\263"
+	.ascii	"\034ki#\034\244\220$\260;\264C\234\335q\024;|g\253\2749\241!"
+	.ascii	"kA\006\205\312\361\335\361\025\324\213\253\212\225*S\256\245"
+	.ascii	"\267\264 \355\365\305R\240DA;\340p\342\004\327\325\r\351P\226"
+	.ascii	"<=\033\244\027\231\022\335q]\336\365\"\343\013\236\213\233\022"
+	.ascii	"cNn\206\355K\017H\216\032$\021\332\2304\224C\215\267\277a&\037"
+	.ascii	"\224\026\257O\252\256/g'\0204XN\302\356p\3341\023\037E\220\374"
+	.ascii	"\372\342$x\211\f\245\\\017\274\004/\347h\264\300\222#\275I+\263"
+	.ascii	"\"XI\327P\213\"5\325\027#\271G[hWr}\361\221/\307<q\001\366\305"
+	.ascii	"p\325\314&0L\340Y\026\332\201E\3311\2212\334f\277\204\261)\303"
+	.ascii	"\022\344L\355\270\355\230M\304\210/i\3548\n\353\213\215\024Y"
+	.ascii	"Kk\265\231\2654\255\247\276\030\355\314\214\007\312!\017{\035"
+	.ascii	"\207a/\234Z.\022X\206\261i\233\361\245\024;N\217\307D\214h:\033"
+	.ascii	"\245\345\024\230\276x\210\0200\3745\205rp\363ql\345\003sY)59"
+	.ascii	"\250,/\235F\300\270\220\334\264\3302\205#\353\230\3538\210\210"
+	.ascii	"\021\3272\314\201\206\326\001\205\375\250\323a\243b\\4La\034"
+	.ascii	"\n\2252D43\233\244\003\003\026@0@8\036\027\f\307\325;\023\200"
+	.ascii	"\205\313\253D\201&\345\230c\206JDD$IR#\355\006\200\267Q\355\213"
+	.ascii	".&\254)\032\2631\202\344My?\376_!\"*^-\006~\003{\221&\0057\224"
+	.ascii	"L\353\022\235h\330:\253; \344=\\\321\377)N\222\"T\376%\236\355"
+	.ascii	"\206\234P\256697\350\311\372\237G61\354\210\ns\220Gj\231\030"
+	.ascii	"S\320Kd\365\035\266\342E\024\365\337\302\243F\243\217\270\223"
+	.ascii	"X\022\213\266\376\276\023]\245\217i\230"
+	.string	"\324\325\260\n\374\001abg\230K\nj\366\203"
+	.string	"1\254\312P\253\337\352p\335\306B\263\361\211$\f\351\177\262\037\342\377o\005-v\306\375+\272\264 1\2137\327\202\200\245ROD\253\216\327\013\336)\262\tTAR\310\017\265\230&\2665G"
+	.string	"`\023\317'\324\2014&Z\353\301\322i\230m\021\377\314{\"\227/\246\2544Y\310\221\377\356\370\017\337\270I;\320\364\016\260r{\026}\022P\340\353\021m\034d\376\330\202\205\033D\023\037\032neu\214\202Aj\344\213\213J%\032=\230\317!\301\\\323\321\355\032v\365B\001\223\303\255\204\220\007p\352!\275\305\354\327\316\330Di\274"
+	.ascii	"\274g<\274\017\017U\fU\330\324\230\372\360\207\301R\0374\306"
+	.ascii	"\344s\223\342\275\224\021\334\24029X\354?\373J\003\303\262\312"
+	.ascii	"\363{\025\365\305\203\240\377\376y\346\021\312\351\277cy\261"
+	.ascii	"K>1S\303\026\357\210\306\365\347x\246q\365\257G)E$\352\232\366"
+	.ascii	"\267\363\202\340\206:\302\211y\214\261A\312\303\002\270Z(\217"
+	.ascii	"B\243\227\006\006S\226\302RW\222A:N\262In\026\347\344&\346\341"
+	.ascii	"wZ\254\311\331c_\223\376}\372\341\221\025;\201>Tf\3400=\\\267"
+	.ascii	"\264\367\352\347L/R{z\267u\376\t\335\376\223R%\312=i\327\254"
+	.ascii	"E\304\246JCH\237\365\217\364\333\034~4U\260Ok\333\254\245\247"
+	.ascii	"\365\221\265)\354PFC\030\036P\203\254@d\371\251\300\243\362\333"
+	.ascii	"3\306\266g\376\364\204^\207\202\2505I\322\230\347{\f\367\346"
+	.ascii	"\247\020\341\304N\002?\217w\005\367\242\262\251+\341\343\221"
+	.ascii	"#\255\251\225\224\003\027\032\304\021\201\r/?b\255~\222\360\006"
+	.ascii	"\236HZa\312m\310\201-\270<\310u\337\371;\205\024?\373\352\263"
+	.ascii	"\327 %\373\253Aoo\222\037\2305\025H5[\"\216\315\254:\0017r\221"
+	.ascii	"wAPN\311_ij\335*_*\343\205\252\253\304\222\310n\340\020\374z"
+	.ascii	"Re{\240cIz\375\261\272\372j\002\330k\257\357#\016]\005\037\363"
+	.ascii	"\203\"\251\362\371\315l\323/&u\263v\307\256\331U\374\261\243"
+	.ascii	"\334\347\206\200u\316%\323\247a\204\204\303\374GS\362\362\267"
+	.ascii	"\215\307\224\b\202/F\013\260}\302\021\233\237p\206\230\247\t"
+	.ascii	"$\312Jk\272\225\227\264$\367\237\234\244\354$\255\270\276\033"
+	.ascii	"\260\273\214P\"\210k\331E\267W\031m?/\314\221\352''L#\234\353"
+	.ascii	"{\211\374\267\007\337"
+	.string	"x\0374\220\365\340\232u\307\007\242\347\241EF\036\333\005\315\241\371mv\216\271\334R\244C7\034\314\302n\222b\246{\007xl+f\005&\315\314\200\342jA\033cZ\210\303yt\214qe\303\204\210\260*L-G\230PO5\372\024\023f\342n\331e?\356\266p6\357\022\213X\354~\271\235&\364*\003\\&@$\022\2354\215qX^h\320H\036V\350\n\rUd`\030-\303e\307z\265\344\220\314m\216-\2154\177-O\333\016\320\252\245Wm\373\335\00227\217F\250\034\030\203/e\021\274,\323\2064\2573\200\030z\364\2521^\326\352\247s9\221\020\003\"\277?\305\030\242\304s\324>\216+0@)|\332>\316\357\352\256\223wO\302\300MT\202<\205\374z\333\234\334\360b\237oC2\337\270qg\211\024F\250\336\211n\346\377\220$\350Y\306x\210\373B%\261\330z e\020\375_\332"
+	.ascii	"K\377\001\237\270\203\212SR\030\212\307\253\3770p\316\210\253"
+	.ascii	"V \372\273Q\250C/W\306Y\350\013\371\013|&&\330\346d@~y\323\201"
+	.ascii	"\022\302\377\315-\016\373\215\240\f8$\233hE\361\244;\251P~"
+	.string	"\340;\253\337\264C\\\371\233\347\312V\307~\262\t\356C\332\004La\024 \217\ra\306\263\304\214\366\376\022\342\251\307\t\0233!\301\240\037f\257\342\373\200\352u\341\001S\006\006F\250\fJ\367\256;\265\327~\350R^]\360\261\265\002^\245\235\267\201\256@\001\0247\306\353\021\207u\267N\2764?\205;\267\322\217@\314$\204\200\031\355\027p\310\277\240e\317\023\325\321\340r\022&Y\301(\200\240Lq\346\264\354x\215o?\216\265\303:P:f\f\214\270.\260\337\236g\b\264\271d\305H\377\200\242\231@\221\201[8&\237\273\355\222\307\033S\200\352\277\262c\271\375%\377\214Y\216\245\360h\370\330\204\223\006\025\351K\363v\020\340\303\273\201\277\004\026\247\031\266\206\375\355\250\251\343\003\361\207\0018\006\237\305\003\2139\0208\t\357\013%\353\310\220\325\376\230\327\023\0278\333\257_\314\337\207\002\270\f'F#J\370\245"
+	.string	"\032w9:\210\342.\245\220\343\264|\341K\302\371\215\200\376\306\306\037\232(\031\023\376`l+\361\235\032Nh\022\334\022\363\266\300\3502\322C\022\222I\031\323@\230)^y-\371\004o\\\303\320\351\300\267\036n\275\326B\201-\246\203\312\351\246\224\265\001\3555\026\rQ]\020\371\325\245\241;;.x\203i2\273\226\243L\376OOGM#p\024b\232d95\002\361(ym\275p=v\372\004\200\240\020\205\304\245\215\211\220^\243\343\353"
+	.ascii	"\033\007\0166\002\266\001\017\351\262\320\214\226\211 \275m\360"
+	.ascii	"\3412.h6Ekd'\241\361\336\375\277\372m\222\372\256c\201f\220\351"
+	.ascii	"\324z\374d{\366\353\366\nG\323>\313\023\233`\\\224\2050\227\001"
+	.ascii	"~4/\273\177w\375H\366k\035\340f\361\013\030P\253F\223\253\212"
+	.ascii	"\200\003\307\236\3174b\360\335\246J\027I.v\034\254\342%h\031"
+	.ascii	"^\362\031L\003e\b\306\314\262\214\346\367\240\241\225O\230H\030"
+	.ascii	"\236f\250\037D\275\265E6\022\007\021\233Q\250\007\224h\356\217"
+	.ascii	"g\"L\346K\274\342&\363<\325J\200\302>i\277\365\023O\354\277\366"
+	.ascii	"h\t\013\233\016\314\304\3534M\034E\027u&\274\272\374t\035\203"
+	.ascii	"\363\360L\020\370\237\026\351\r\277\350\235\332W\226\320.\t\217"
+	.ascii	"@p\370R\3222\230\005Fy\031ZW\243\\>:\263\211\237!\302\200\242"
+	.ascii	"\200\3177\213\237\023\236\303\332+\367\b\357\277\317~\234\371"
+	.ascii	"\354\274?\373/!\tP3\206\254\340\022ia\360\202yxr]\202\256\267"
+	.ascii	"l\022\255NQ\344\275p\203\307ot\267\311\265\320\271B\322c\177"
+	.ascii	"\001"
+	.string	"\317\203\316\302\\X\303\020j\353\347\244\007\376\020v\"\270\221\256\n\242\331n\t\002\234\321VI\246\227\337tPi\036\320Jy\210\021\2140\203\354+\222\220VD\237;\261\245\b\243\034X\203\302=6\275\251M\203=zC\006\020R\364%?f\363\302\241\005\201\034\377\221nKx\203\001#\360\206\354\253\204sL\233[T\2027f\230\230\360@F\226\372\355w\361\2547Jx\256\203L<[6q\f\025\013Q\034\r\331\"\3363\230h\036P[\031M\005QH6_\360\352\341\275\216{\224q\304-kB\226\341\253\351\336\025\n ~\337\007\242\235\232(B \221\357\307S\254\020\031\362h\230h\t|\340\016W\004\207H&\315\022 c^\\LRa\013Y0oR\203\224\267.\336\325\026\2256\372\003\324\263k8\303\247\033\t\370\017\300\272\317\323\355]\023\304\211]\030\314X\013u\373B\r\rI\007\177\327\031\361"
+	.string	"\026t\270\3013\262Ap\356@V\301\233KU"
+	.ascii	"\364\344\303\324%\\\375\207\307\353\303\267\331\021I\304\240"
+	.ascii	"@\001\236\300\341\b#k\304\326P\376\352\021z\256\272\262\340\226"
+	.ascii	"\211>n\366v\303\364\rL\353C\320}\016\226"
+	.ascii	"\200\f\230Hc\362 H-\242S\236\027\277\357'(\336\013\270\206\023"
+	.ascii	"\317l\017cy\202\367\301R\354\242\030\3254y+P\004!\210\273_\376"
+	.ascii	"`\006\rnu\354*rt\333\2236<\345\342\243\260\027!\241\366\342\b"
+	.ascii	"\030z\222q\242\206#\231\020\3117J\314\247fV\013\017v\273\244"
+	.ascii	"?\371\310\354\374=\374\306\242\037HzR\244\301\230q&L(\365\337"
+	.ascii	"\350\256\033\210}\323\211\355\367\017\251\316\026\376\307\023"
+	.ascii	"+\037\342\247\344\321\263\214\023t\260\212\325\255m\236\007\204"
+	.ascii	"=\"\037\270~\020h \016\030\032\020\025\355\204\004]\020\263f"
+	.ascii	"\3352\n\241.\027\361\030\200\2573\334\227\356\257\225\004OH\312"
+	.ascii	"(\316\374C\343\022\017(( \251\221\037a<\314[\362\006%B,b\320"
+	.ascii	"y\331EZ\347\376\241/\314\212\335X\177n\345\035\260B\221\265\344"
+	.ascii	"d\261\204\273\243\245.\271 4\n\035\247y\006+<?iz\3557$\201U0"
+	.ascii	"\322B\f\004\371 eJR@\354\262\274\235\036\030\312#'\356\024\255"
+	.ascii	"\036\276\226\003\261\305|\301U\b\245\202#62\001p{\360\260\246"
+	.ascii	"\371_\217Nu9\204\303\356\264\275\320\231\327\371\323\334\263"
+	.ascii	"1\322\335P]\205\350\352h\213\031S\t;\207\257\337\307L\022\207"
+	.ascii	"4\356P6q|N\272%\316\332\243\303\330,\026\350\335\305\342cL\037"
+	.ascii	"\377\277\036|\341i\003\245\307\211\371\314\370[\365\3635\353"
+	.ascii	"\230{\222\360\326{\306f;\b\31181\241\007\204\210k\361jZu\223"
+	.ascii	"\250\274)@\317j\371\324QL\213\365\321\201\037\275\334;\277-&"
+	.ascii	"\303\005?\262\332=\257\247\036nm\266YI\307X\312(\307\306\226"
+	.ascii	"\236#^\311\244\237\335\203\\\016\325p\016\224<\024\363\204||"
+	.ascii	"\274+Jft\355!\337K\214m\243S\023\315\260\207au\300-\013\235\236"
+	.ascii	"<0\273\226\322'HoG\362\301\324=\241\241U\220]&\031\223\344{\246"
+	.ascii	"~\3712\322\312\0047X\262\221\235L\342\212\333\035\243\375\200"
+	.ascii	"4_\210;\253\274[\207\013,\236&\332-\353h\3206\374\275\002\350"
+	.ascii	"\200\243_\302\230\234\336\340\363\341\211\350\022)\267c2\"\232"
+	.ascii	"\017\200{Nw\t%\247\217\365r\257gS\237\225od\354\013\231\315\206"
+	.ascii	"\234\374\241\350-wKN<\334%\266\032\323\277Gr\257\260=\345\337"
+	.ascii	"\357i\345\267\177r7A`\215t\367\252\261\316\345?\270D\307\231"
+	.ascii	"\331\023\2145C[\366k(\270*G\026\370\3379\265\203\346\245\212"
+	.ascii	"U\321\2759\335\324\276\310\277\347\032\334,\357\306\361\f5\035"
+	.ascii	"\347\367\017\257\276\213\035L\333\020\370[\302\307\230_\330\372"
+	.ascii	"\205)\023\304\177\241\315\316{\220\317\005>T#n~\241W\366\tw\037"
+	.ascii	"\370\032z\013q\343\336\375\220\207\233z\001\034$\345\254\177"
+	.ascii	"\244\377Q$\250\253Ek`\356\354>\315\013\013\351\343\366\036m\375"
+	.ascii	"4\230\020\177\365\326\rU7\247d\274\024\227\226\3463s\272\376"
+	.ascii	"\305\323\013\271\233/<'\316\370\350\371\354\227m\373R\\\316\354"
+	.ascii	"o\335\261&\243e\313\226~s\350j\331s\254o\352\037\033\365m\237"
+	.ascii	"\247!}&.\306\270\016b\310\260\017\004\336o\037\313\300C\371C"
+	.ascii	"\303\236\002\262\370\272K,u\034\351\356\006\360+\306\317\306"
+	.ascii	"\370\301\305\260ag\252\257\233\343\f\215}\217ss\032_]\2601c$"
+	.ascii	"\334\007\301\303\373\307\262\377\327\355?`\207\007\305\034\201"
+	.ascii	"f\\q{\\3\20255\326;\361\371-Y1\332\324\201\270\016(@t\005"
+	.text
+	.section	.gnu.lto_.symtab.f7e8eac462a63035,"e",@progbits
+	.string	"blackboxDecoderFindLogs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"blackboxDecoderGetHeader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"blackboxDecoderGetHeaderInt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"blackboxDecoderFieldIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"blackboxDecoderInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\002"
+	.string	""
+	.string	"blackboxDecoderNext"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\002"
+	.string	""
+	.string	"blackboxDecoderInitSegment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"blackboxDecoderFindIntraframe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"strtol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"blackboxHuffmanDecode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"blackboxHuffmanDecoderInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.f7e8eac462a63035,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
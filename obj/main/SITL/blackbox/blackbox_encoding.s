@@ -0,0 +1,9244 @@
+	.file	"blackbox_encoding.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 4 "<built-in>"
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 6 "./src/main/blackbox/blackbox_io.h"
+	.file 7 "./src/main/blackbox/blackbox_huffman.h"
+	.file 8 "./src/main/common/encoding.h"
+	.file 9 "./src/main/blackbox/blackbox_encoding.h"
+	.file 10 "./src/main/common/printf.h"
+	.file 11 "./src/main/blackbox/blackbox_encoding.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_encoding.c.223516c3
+	.weak	blackbox_encoding.c.223516c3
+blackbox_encoding.c.223516c3:
+	.long	0x612
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1a
+	.long	.LASF1190
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1107
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x10
+	.long	0x29
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1108
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1109
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1110
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1111
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1112
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1113
+	.uleb128 0x1
+	.long	.LASF1114
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x43
+	.uleb128 0x1
+	.long	.LASF1115
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x77
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1116
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x4a
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1120
+	.uleb128 0x10
+	.long	0xa4
+	.uleb128 0x1
+	.long	.LASF1121
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1123
+	.uleb128 0x8
+	.long	0xbc
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1b
+	.long	0xe0
+	.uleb128 0x1d
+	.long	.LASF1191
+	.long	0xe9
+	.uleb128 0x15
+	.long	0xf9
+	.long	0xf9
+	.uleb128 0x16
+	.long	0x22
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1192
+	.byte	0x18
+	.byte	0x4
+	.byte	0
+	.long	0x12e
+	.uleb128 0x11
+	.long	.LASF1125
+	.long	0x51
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1126
+	.long	0x51
+	.byte	0x4
+	.uleb128 0x11
+	.long	.LASF1127
+	.long	0xa2
+	.byte	0x8
+	.uleb128 0x11
+	.long	.LASF1128
+	.long	0xa2
+	.byte	0x10
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x3
+	.byte	0x63
+	.byte	0x18
+	.long	0xd4
+	.uleb128 0x8
+	.long	0xab
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x5
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x10
+	.long	0x13f
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x5
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x10
+	.long	0x15c
+	.uleb128 0x15
+	.long	0x13f
+	.long	0x17d
+	.uleb128 0x16
+	.long	0x22
+	.byte	0xff
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1193
+	.value	0x108
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x10
+	.long	0x1b0
+	.uleb128 0x14
+	.long	.LASF1133
+	.byte	0x40
+	.byte	0xe
+	.long	0x15c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1134
+	.byte	0x41
+	.byte	0xe
+	.long	0x150
+	.byte	0x4
+	.uleb128 0x14
+	.long	.LASF1135
+	.byte	0x42
+	.byte	0xd
+	.long	0x16d
+	.byte	0x6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x6
+	.byte	0x43
+	.byte	0x3
+	.long	0x17d
+	.uleb128 0x17
+	.long	.LASF1137
+	.byte	0x45
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x17
+	.long	.LASF1138
+	.byte	0x46
+	.byte	0x1e
+	.long	0x1b0
+	.uleb128 0xd
+	.long	.LASF1139
+	.byte	0x7
+	.byte	0x34
+	.byte	0x5
+	.long	0x29
+	.long	0x1f7
+	.uleb128 0x2
+	.long	0x1f7
+	.uleb128 0x2
+	.long	0x29
+	.uleb128 0x2
+	.long	0x1fc
+	.uleb128 0x2
+	.long	0x29
+	.byte	0
+	.uleb128 0x8
+	.long	0x13f
+	.uleb128 0x8
+	.long	0x14b
+	.uleb128 0xd
+	.long	.LASF1140
+	.byte	0x8
+	.byte	0x16
+	.byte	0xa
+	.long	0x15c
+	.long	0x217
+	.uleb128 0x2
+	.long	0x217
+	.byte	0
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1141
+	.uleb128 0xd
+	.long	.LASF1142
+	.byte	0x8
+	.byte	0x17
+	.byte	0xa
+	.long	0x15c
+	.long	0x234
+	.uleb128 0x2
+	.long	0xbc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1143
+	.byte	0x9
+	.byte	0x16
+	.byte	0x5
+	.long	0x29
+	.long	0x24a
+	.uleb128 0x2
+	.long	0x13a
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1194
+	.byte	0x6
+	.byte	0x49
+	.byte	0x6
+	.uleb128 0xd
+	.long	.LASF1144
+	.byte	0xa
+	.byte	0x76
+	.byte	0x5
+	.long	0x29
+	.long	0x277
+	.uleb128 0x2
+	.long	0xa2
+	.uleb128 0x2
+	.long	0x277
+	.uleb128 0x2
+	.long	0x13a
+	.uleb128 0x2
+	.long	0x28c
+	.byte	0
+	.uleb128 0x8
+	.long	0x27c
+	.uleb128 0x21
+	.long	0x28c
+	.uleb128 0x2
+	.long	0xa2
+	.uleb128 0x2
+	.long	0xa4
+	.byte	0
+	.uleb128 0x8
+	.long	0xf9
+	.uleb128 0x12
+	.long	.LASF1153
+	.value	0x185
+	.long	0x309
+	.uleb128 0xa
+	.long	.LASF1145
+	.value	0x185
+	.byte	0x25
+	.long	0x15c
+	.uleb128 0xa
+	.long	.LASF1146
+	.value	0x185
+	.byte	0x39
+	.long	0x13f
+	.uleb128 0x6
+	.long	.LASF1147
+	.value	0x187
+	.byte	0x14
+	.long	0x16d
+	.uleb128 0x6
+	.long	.LASF1148
+	.value	0x189
+	.byte	0x14
+	.long	0x168
+	.uleb128 0x6
+	.long	.LASF1149
+	.value	0x18e
+	.byte	0x14
+	.long	0x1fc
+	.uleb128 0x6
+	.long	.LASF1150
+	.value	0x18f
+	.byte	0xf
+	.long	0x30
+	.uleb128 0x6
+	.long	.LASF1151
+	.value	0x192
+	.byte	0xf
+	.long	0x30
+	.uleb128 0x6
+	.long	.LASF1152
+	.value	0x193
+	.byte	0xf
+	.long	0x30
+	.uleb128 0xb
+	.uleb128 0xe
+	.string	"i"
+	.value	0x19b
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1154
+	.value	0x17b
+	.long	0x321
+	.uleb128 0xa
+	.long	.LASF1155
+	.value	0x17b
+	.byte	0x1f
+	.long	0x217
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1156
+	.value	0x172
+	.long	0x339
+	.uleb128 0xa
+	.long	.LASF1155
+	.value	0x172
+	.byte	0x1f
+	.long	0xbc
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1157
+	.value	0x151
+	.long	0x385
+	.uleb128 0xa
+	.long	.LASF1158
+	.value	0x151
+	.byte	0x26
+	.long	0xcf
+	.uleb128 0xa
+	.long	.LASF1159
+	.value	0x151
+	.byte	0x32
+	.long	0x29
+	.uleb128 0x6
+	.long	.LASF1160
+	.value	0x153
+	.byte	0xd
+	.long	0x13f
+	.uleb128 0x13
+	.long	0x378
+	.uleb128 0xe
+	.string	"i"
+	.value	0x15e
+	.byte	0x16
+	.long	0x29
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xe
+	.string	"i"
+	.value	0x168
+	.byte	0x16
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1161
+	.byte	0xfd
+	.long	0x404
+	.uleb128 0x5
+	.long	.LASF1158
+	.byte	0xb
+	.byte	0xfd
+	.byte	0x26
+	.long	0xcf
+	.uleb128 0x22
+	.byte	0x7
+	.byte	0x4
+	.long	0x51
+	.byte	0xb
+	.value	0x101
+	.byte	0xa
+	.long	0x3c3
+	.uleb128 0x3
+	.long	.LASF1162
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1163
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1164
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1165
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1166
+	.value	0x108
+	.byte	0xd
+	.long	0x13f
+	.uleb128 0x6
+	.long	.LASF1167
+	.value	0x11a
+	.byte	0x9
+	.long	0x29
+	.uleb128 0x6
+	.long	.LASF1168
+	.value	0x11b
+	.byte	0xd
+	.long	0x13f
+	.uleb128 0x13
+	.long	0x3f7
+	.uleb128 0xe
+	.string	"x"
+	.value	0x10a
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xe
+	.string	"x"
+	.value	0x11c
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1169
+	.byte	0x81
+	.long	0x4ab
+	.uleb128 0x5
+	.long	.LASF1158
+	.byte	0xb
+	.byte	0x81
+	.byte	0x26
+	.long	0xcf
+	.uleb128 0xf
+	.long	.LASF1170
+	.byte	0x83
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x18
+	.long	0x51
+	.byte	0x86
+	.long	0x448
+	.uleb128 0x3
+	.long	.LASF1171
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1172
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1173
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1174
+	.byte	0x3
+	.byte	0
+	.uleb128 0x18
+	.long	0x51
+	.byte	0x8d
+	.long	0x46b
+	.uleb128 0x3
+	.long	.LASF1175
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1176
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1177
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1178
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1166
+	.byte	0x94
+	.byte	0x9
+	.long	0x29
+	.uleb128 0xf
+	.long	.LASF1179
+	.byte	0x94
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.long	0x490
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xa1
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.uleb128 0x13
+	.long	0x49f
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xce
+	.byte	0x12
+	.long	0x29
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x9
+	.string	"x"
+	.byte	0xe0
+	.byte	0x12
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1180
+	.byte	0x78
+	.long	0x4c2
+	.uleb128 0x5
+	.long	.LASF1155
+	.byte	0xb
+	.byte	0x78
+	.byte	0x1f
+	.long	0xb0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1181
+	.byte	0x71
+	.long	0x4f0
+	.uleb128 0x5
+	.long	.LASF1182
+	.byte	0xb
+	.byte	0x71
+	.byte	0x2c
+	.long	0x4f0
+	.uleb128 0x5
+	.long	.LASF1183
+	.byte	0xb
+	.byte	0x71
+	.byte	0x37
+	.long	0x29
+	.uleb128 0xb
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x73
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xb0
+	.uleb128 0x7
+	.long	.LASF1184
+	.byte	0x6a
+	.long	0x523
+	.uleb128 0x5
+	.long	.LASF1182
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x2a
+	.long	0xcf
+	.uleb128 0x5
+	.long	.LASF1183
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x35
+	.long	0x29
+	.uleb128 0xb
+	.uleb128 0x9
+	.string	"i"
+	.byte	0x6c
+	.byte	0xe
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1185
+	.byte	0x64
+	.long	0x53a
+	.uleb128 0x5
+	.long	.LASF1155
+	.byte	0xb
+	.byte	0x64
+	.byte	0x24
+	.long	0xbc
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1186
+	.byte	0x57
+	.long	0x551
+	.uleb128 0x5
+	.long	.LASF1155
+	.byte	0xb
+	.byte	0x57
+	.byte	0x27
+	.long	0x15c
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0x40
+	.long	0x589
+	.uleb128 0x5
+	.long	.LASF1188
+	.byte	0xb
+	.byte	0x40
+	.byte	0x2b
+	.long	0x13a
+	.uleb128 0xc
+	.string	"fmt"
+	.byte	0x40
+	.byte	0x3d
+	.long	0x13a
+	.uleb128 0x19
+	.uleb128 0x9
+	.string	"va"
+	.byte	0x42
+	.byte	0xd
+	.long	0x12e
+	.uleb128 0xf
+	.long	.LASF1189
+	.byte	0x4b
+	.byte	0xf
+	.long	0x30
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1195
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x5
+	.long	0x29
+	.long	0x5bb
+	.uleb128 0xc
+	.string	"fmt"
+	.byte	0x2f
+	.byte	0x20
+	.long	0x13a
+	.uleb128 0x19
+	.uleb128 0x9
+	.string	"va"
+	.byte	0x31
+	.byte	0xd
+	.long	0x12e
+	.uleb128 0xf
+	.long	.LASF1189
+	.byte	0x35
+	.byte	0xf
+	.long	0x30
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1196
+	.byte	0xb
+	.byte	0x28
+	.byte	0xc
+	.long	0x29
+	.long	0x5e1
+	.uleb128 0xc
+	.string	"fmt"
+	.byte	0x28
+	.byte	0x28
+	.long	0x13a
+	.uleb128 0xc
+	.string	"va"
+	.byte	0x28
+	.byte	0x35
+	.long	0x28c
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1197
+	.byte	0xb
+	.byte	0x22
+	.byte	0xd
+	.long	0x600
+	.uleb128 0xc
+	.string	"p"
+	.byte	0x22
+	.byte	0x19
+	.long	0xa2
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x22
+	.byte	0x21
+	.long	0xa4
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1198
+	.byte	0x6
+	.byte	0x52
+	.byte	0x14
+	.uleb128 0x5
+	.long	.LASF1155
+	.byte	0x6
+	.byte	0x52
+	.byte	0x2a
+	.long	0x13f
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF539
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF605
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF641
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF669
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF670
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF745
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF747
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF562
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF749
+	.file 35 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF750
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF767
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF780
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF785
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF788
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF806
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF807
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF808
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF827
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF828
+	.byte	0x4
+	.byte	0x4
+	.file 52 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF832
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 55 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF848
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF849
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 59 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.file 60 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 61 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3d
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3e
+	.file 63 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1011
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 65 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.file 67 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1106
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF459
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF518
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF762
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF801
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF846
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF943
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1088
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.48.d431a1cf6653bca7fad963f04c7375d6,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1199
+	.long	.LASF1200
+	.long	.LASF1201
+	.long	.LASF1202
+	.long	.LASF1203
+	.long	.LASF1204
+	.long	.LASF1205
+	.long	.LASF1206
+	.long	.LASF1207
+	.long	.LASF1208
+	.long	.LASF1209
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x44
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1210
+	.byte	0x7
+	.long	.LASF1211
+	.byte	0x7
+	.long	.LASF1212
+	.byte	0xb
+	.long	.LASF1213
+	.byte	0
+	.long	.LASF1214
+	.byte	0x7
+	.long	.LASF1215
+	.byte	0x1
+	.long	.LASF1216
+	.byte	0x1
+	.long	.LASF1217
+	.byte	0x2
+	.long	.LASF1218
+	.byte	0x1
+	.long	.LASF1219
+	.byte	0x2
+	.long	.LASF1220
+	.byte	0x1
+	.long	.LASF1221
+	.byte	0xa
+	.long	.LASF1222
+	.byte	0xa
+	.long	.LASF1223
+	.byte	0x7
+	.long	.LASF1224
+	.byte	0xa
+	.long	.LASF1225
+	.byte	0xa
+	.long	.LASF1226
+	.byte	0x7
+	.long	.LASF1227
+	.byte	0x7
+	.long	.LASF1228
+	.byte	0x9
+	.long	.LASF1229
+	.byte	0x7
+	.long	.LASF1230
+	.byte	0x8
+	.long	.LASF1231
+	.byte	0x8
+	.long	.LASF1232
+	.byte	0xb
+	.long	.LASF1233
+	.byte	0x7
+	.long	.LASF1234
+	.byte	0x7
+	.long	.LASF1235
+	.byte	0x7
+	.long	.LASF1236
+	.byte	0x7
+	.long	.LASF1210
+	.byte	0x9
+	.long	.LASF1237
+	.byte	0x7
+	.long	.LASF1238
+	.byte	0x7
+	.long	.LASF1239
+	.byte	0x6
+	.long	.LASF1240
+	.byte	0x6
+	.long	.LASF1241
+	.byte	0x6
+	.long	.LASF1242
+	.byte	0x6
+	.long	.LASF1243
+	.byte	0xa
+	.long	.LASF1243
+	.byte	0x7
+	.long	.LASF1244
+	.byte	0x7
+	.long	.LASF1245
+	.byte	0x7
+	.long	.LASF1246
+	.byte	0x7
+	.long	.LASF1247
+	.byte	0x9
+	.long	.LASF1247
+	.byte	0x7
+	.long	.LASF1248
+	.byte	0x6
+	.long	.LASF1249
+	.byte	0x6
+	.long	.LASF1250
+	.byte	0x6
+	.long	.LASF1251
+	.byte	0x6
+	.long	.LASF1252
+	.byte	0x7
+	.long	.LASF1253
+	.byte	0x7
+	.long	.LASF1254
+	.byte	0x7
+	.long	.LASF1255
+	.byte	0x7
+	.long	.LASF1256
+	.byte	0x7
+	.long	.LASF1257
+	.byte	0x7
+	.long	.LASF1258
+	.byte	0xa
+	.long	.LASF1259
+	.byte	0x7
+	.long	.LASF1260
+	.byte	0x7
+	.long	.LASF1261
+	.byte	0xa
+	.long	.LASF1262
+	.byte	0x6
+	.long	.LASF1263
+	.byte	0x6
+	.long	.LASF1264
+	.byte	0xa
+	.long	.LASF1265
+	.byte	0x5
+	.long	.LASF1266
+	.byte	0x4
+	.long	.LASF1267
+	.byte	0x3
+	.long	.LASF1268
+	.byte	0xb
+	.long	.LASF1268
+	.byte	0xa
+	.long	.LASF1269
+	.byte	0x7
+	.long	.LASF1270
+	.byte	0x4
+	.long	.LASF1271
+	.byte	0x4
+	.long	.LASF1272
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF736:
+	.string	"__nlink_t_defined "
+.LASF956:
+	.string	"INT32_MAX (2147483647)"
+.LASF819:
+	.string	"__ONCE_ALIGNMENT "
+.LASF893:
+	.string	"USE_1WIRE_DS2482 "
+.LASF805:
+	.string	"__fsfilcnt_t_defined "
+.LASF888:
+	.string	"USE_OPFLOW "
+.LASF446:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF636:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF644:
+	.string	"__HAVE_FLOAT64 1"
+.LASF860:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF649:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF656:
+	.string	"__f64(x) x ##f64"
+.LASF1156:
+	.string	"blackboxWriteU32"
+.LASF931:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF865:
+	.string	"USE_GPS "
+.LASF546:
+	.string	"__stub_sigreturn "
+.LASF410:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF508:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF774:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF745:
+	.string	"__clockid_t_defined 1"
+.LASF1165:
+	.string	"FIELD_16BIT"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF718:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1002:
+	.string	"INT16_C(c) c"
+.LASF1122:
+	.string	"int32_t"
+.LASF1186:
+	.string	"blackboxWriteUnsignedVB"
+.LASF854:
+	.string	"USE_I2C_PULLUP "
+.LASF454:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF783:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1076:
+	.string	"U_ID_0 0"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF493:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1121:
+	.string	"int16_t"
+.LASF873:
+	.string	"USE_PITOT "
+.LASF1160:
+	.string	"header"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1026:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF608:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF861:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1087:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1041:
+	.string	"USE_UART7 "
+.LASF1050:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF932:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF868:
+	.string	"USE_TELEMETRY "
+.LASF1083:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF617:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF971:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF497:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF705:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF793:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF730:
+	.string	"__STD_TYPE"
+.LASF781:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF786:
+	.string	"____sigset_t_defined "
+.LASF470:
+	.string	"__P(args) args"
+.LASF1197:
+	.string	"_putc"
+.LASF749:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF704:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1143:
+	.string	"blackboxPrint"
+.LASF914:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF698:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1138:
+	.string	"blackboxWriteBuffer"
+.LASF742:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF926:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1153:
+	.string	"blackboxCompressFrame"
+.LASF1009:
+	.string	"INTMAX_C(c) c ## L"
+.LASF601:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1171:
+	.string	"BITS_2"
+.LASF1172:
+	.string	"BITS_4"
+.LASF658:
+	.string	"__f64x(x) x ##f64x"
+.LASF1173:
+	.string	"BITS_6"
+.LASF796:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF635:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1020:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF643:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF416:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1072:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF582:
+	.string	"__size_t "
+.LASF950:
+	.string	"INT8_MIN (-128)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF682:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF458:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF981:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF853:
+	.string	"I2C2_OVERCLOCK false"
+.LASF752:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF485:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1196:
+	.string	"blackboxPrintfv"
+.LASF959:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF980:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF760:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1048:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF892:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF413:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF849:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF825:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF400:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF602:
+	.string	"NULL"
+.LASF1077:
+	.string	"U_ID_1 1"
+.LASF480:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF906:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF712:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1070:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF997:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF542:
+	.string	"__stub_fchflags "
+.LASF1056:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF803:
+	.string	"__blkcnt_t_defined "
+.LASF607:
+	.string	"WUNTRACED 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF707:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF632:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF424:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF404:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF409:
+	.string	"__USE_XOPEN2K8"
+.LASF925:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF507:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF859:
+	.string	"USE_SERIALRX_IBUS "
+.LASF724:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF420:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF810:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF456:
+	.string	"__GLIBC__ 2"
+.LASF846:
+	.string	"__va_list__ "
+.LASF1190:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1108:
+	.string	"long int"
+.LASF448:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF765:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF785:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF442:
+	.string	"__USE_XOPEN2K8 1"
+.LASF713:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1142:
+	.string	"zigzagEncode"
+.LASF565:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF727:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF754:
+	.string	"__PDP_ENDIAN 3412"
+.LASF606:
+	.string	"WNOHANG 1"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF881:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1111:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF504:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF472:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF620:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1053:
+	.string	"USE_DASHBOARD"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1096:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1198:
+	.string	"blackboxWrite"
+.LASF994:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1093:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF654:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF393:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF688:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1105:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF486:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF667:
+	.string	"EXIT_SUCCESS 0"
+.LASF692:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF820:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF463:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF418:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1101:
+	.string	"false 0"
+.LASF662:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1154:
+	.string	"blackboxWriteFloat"
+.LASF1130:
+	.string	"uint8_t"
+.LASF763:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF672:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF474:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF923:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF687:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF521:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1104:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF941:
+	.string	"USE_CLI_BATCH "
+.LASF464:
+	.string	"__LEAF , __leaf__"
+.LASF897:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF703:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1049:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF731:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1063:
+	.string	"USE_1WIRE_DS2482"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF430:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF471:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF645:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF972:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1035:
+	.string	"USE_UART1 "
+.LASF1152:
+	.string	"compressedLength"
+.LASF670:
+	.string	"_BITS_TYPES_H 1"
+.LASF792:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF869:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1090:
+	.string	"NOINLINE "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF751:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF794:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1037:
+	.string	"USE_UART3 "
+.LASF1184:
+	.string	"blackboxWriteSignedVBArray"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF878:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1057:
+	.string	"USE_RANGEFINDER"
+.LASF739:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF693:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF951:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1068:
+	.string	"USE_VCP"
+.LASF800:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1124:
+	.string	"__gnuc_va_list"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF515:
+	.string	"__restrict_arr __restrict"
+.LASF540:
+	.string	"__stub___compat_bdflush "
+.LASF975:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1155:
+	.string	"value"
+.LASF857:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF613:
+	.string	"__WALL 0x40000000"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF417:
+	.string	"__USE_GNU"
+.LASF452:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF967:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF826:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1120:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF965:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF640:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF563:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1095:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1174:
+	.string	"BITS_32"
+.LASF545:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF562:
+	.string	"__need_size_t "
+.LASF895:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF675:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF527:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1195:
+	.string	"blackboxPrintf"
+.LASF512:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF432:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF626:
+	.string	"__WCOREFLAG 0x80"
+.LASF1011:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1117:
+	.string	"__uint16_t"
+.LASF407:
+	.string	"__USE_XOPEN2K"
+.LASF729:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF612:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF408:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1044:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF664:
+	.string	"__lldiv_t_defined 1"
+.LASF510:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF439:
+	.string	"__USE_POSIX199309 1"
+.LASF978:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1079:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF716:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF966:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1175:
+	.string	"BYTES_1"
+.LASF680:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF864:
+	.string	"USE_BLACKBOX "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1007:
+	.string	"UINT32_C(c) c ## U"
+.LASF631:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF986:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF402:
+	.string	"__USE_POSIX199309"
+.LASF957:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1126:
+	.string	"fp_offset"
+.LASF852:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF660:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF659:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF625:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1089:
+	.string	"FAST_CODE "
+.LASF732:
+	.string	"__ino_t_defined "
+.LASF976:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF912:
+	.string	"USE_STATS "
+.LASF903:
+	.string	"USE_FRSKYOSD "
+.LASF457:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF406:
+	.string	"__USE_UNIX98"
+.LASF930:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF423:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF795:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF728:
+	.string	"_BITS_TIME64_H 1"
+.LASF691:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF676:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1133:
+	.string	"flushedBytes"
+.LASF882:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF721:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF844:
+	.string	"_VA_LIST_DEFINED "
+.LASF856:
+	.string	"USE_SERIAL_RX "
+.LASF789:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF514:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF858:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1182:
+	.string	"array"
+.LASF1181:
+	.string	"blackboxWriteSigned16VBArray"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF479:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF723:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF938:
+	.string	"USE_VTX_FFPV "
+.LASF744:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF836:
+	.string	"__GNUC_VA_LIST "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1099:
+	.string	"bool _Bool"
+.LASF502:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1114:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1170:
+	.string	"NUM_FIELDS"
+.LASF591:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1168:
+	.string	"buffer"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF665:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF983:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1161:
+	.string	"blackboxWriteTag8_4S16"
+.LASF910:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF492:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF984:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF702:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF772:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF603:
+	.string	"NULL ((void *)0)"
+.LASF1051:
+	.string	"USE_USB_MSC"
+.LASF1078:
+	.string	"U_ID_2 2"
+.LASF1163:
+	.string	"FIELD_4BIT"
+.LASF1139:
+	.string	"blackboxHuffmanEncode"
+.LASF604:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1146:
+	.string	"compressedFrameType"
+.LASF1042:
+	.string	"USE_UART8 "
+.LASF650:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF964:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF443:
+	.string	"_ATFILE_SOURCE"
+.LASF681:
+	.string	"__SLONG32_TYPE int"
+.LASF999:
+	.string	"WINT_MIN (0u)"
+.LASF770:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF648:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF913:
+	.string	"USE_CMS "
+.LASF396:
+	.string	"__USE_ISOC11"
+.LASF447:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF791:
+	.string	"__NFDBITS"
+.LASF947:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1159:
+	.string	"valueCount"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF928:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1164:
+	.string	"FIELD_8BIT"
+.LASF797:
+	.string	"NFDBITS __NFDBITS"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF905:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF939:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF633:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF1148:
+	.string	"frameOffset"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF684:
+	.string	"__U64_TYPE unsigned long int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF990:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1167:
+	.string	"nibbleIndex"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1107:
+	.string	"long unsigned int"
+.LASF958:
+	.string	"UINT8_MAX (255)"
+.LASF813:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF433:
+	.string	"_POSIX_SOURCE"
+.LASF1028:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1119:
+	.string	"__uint32_t"
+.LASF431:
+	.string	"__USE_ISOC95 1"
+.LASF531:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF778:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1084:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF484:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF870:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF790:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF466:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF564:
+	.string	"__need_NULL "
+.LASF395:
+	.string	"_FEATURES_H 1"
+.LASF428:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF609:
+	.string	"WEXITED 4"
+.LASF1012:
+	.string	"_STDDEF_H "
+.LASF522:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF809:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF929:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF496:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF708:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1058:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1029:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF686:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF885:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF776:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1149:
+	.string	"payload"
+.LASF1043:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1021:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF945:
+	.string	"_BITS_WCHAR_H 1"
+.LASF661:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF759:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF503:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF936:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1016:
+	.string	"_T_PTRDIFF_ "
+.LASF1032:
+	.string	"USE_FAKE_GPS "
+.LASF415:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1046:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF748:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1019:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1162:
+	.string	"FIELD_ZERO"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF866:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF722:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF871:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF630:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF780:
+	.string	"_SYS_SELECT_H 1"
+.LASF587:
+	.string	"_T_WCHAR_ "
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF524:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1080:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF401:
+	.string	"__USE_POSIX2"
+.LASF960:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF827:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF583:
+	.string	"__need_size_t"
+.LASF937:
+	.string	"USE_VTX_TRAMP "
+.LASF1060:
+	.string	"USE_PITOT_MS4525"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF743:
+	.string	"__key_t_defined "
+.LASF1109:
+	.string	"long long int"
+.LASF1129:
+	.string	"va_list"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF584:
+	.string	"__wchar_t__ "
+.LASF533:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF538:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF599:
+	.string	"__DEFINED_wchar_t "
+.LASF944:
+	.string	"_STDINT_H 1"
+.LASF764:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF653:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF973:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1179:
+	.string	"selector2"
+.LASF989:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1100:
+	.string	"true 1"
+.LASF519:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF589:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF469:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF500:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF518:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1071:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1193:
+	.string	"blackboxWriteBuffer_s"
+.LASF460:
+	.string	"__PMT"
+.LASF845:
+	.string	"_VA_LIST_T_H "
+.LASF1191:
+	.string	"__builtin_va_list"
+.LASF891:
+	.string	"USE_PITOT_MS4525 "
+.LASF822:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF775:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF639:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1125:
+	.string	"gp_offset"
+.LASF619:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF977:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF444:
+	.string	"_ATFILE_SOURCE 1"
+.LASF677:
+	.string	"__SQUAD_TYPE long int"
+.LASF671:
+	.string	"__S16_TYPE short int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF974:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1000:
+	.string	"WINT_MAX (4294967295u)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF668:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF535:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1014:
+	.string	"_ANSI_STDDEF_H "
+.LASF777:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1183:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1180:
+	.string	"blackboxWriteS16"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF530:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF714:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1054:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF622:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1112:
+	.string	"unsigned int"
+.LASF946:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF902:
+	.string	"USE_TELEMETRY_SIM "
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF461:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1061:
+	.string	"USE_PITOT_ADC"
+.LASF1059:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF942:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF414:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF411:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1098:
+	.string	"_STDBOOL_H "
+.LASF598:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF441:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF715:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF674:
+	.string	"__U32_TYPE unsigned int"
+.LASF919:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1017:
+	.string	"_T_PTRDIFF "
+.LASF1169:
+	.string	"blackboxWriteTag2_3S32"
+.LASF491:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1015:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1144:
+	.string	"tfp_format"
+.LASF495:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF830:
+	.string	"alloca"
+.LASF517:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF543:
+	.string	"__stub_gtty "
+.LASF585:
+	.string	"__WCHAR_T__ "
+.LASF969:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF711:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF962:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1074:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF921:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF597:
+	.string	"_GCC_WCHAR_T "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF877:
+	.string	"USE_GYRO_KALMAN "
+.LASF506:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1127:
+	.string	"overflow_arg_area"
+.LASF779:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF828:
+	.string	"__have_pthread_attr_t 1"
+.LASF740:
+	.string	"__id_t_defined "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF784:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1001:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1023:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF421:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF726:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF455:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF690:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1157:
+	.string	"blackboxWriteTag8_8SVB"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF697:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF616:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF467:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF523:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF615:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF473:
+	.string	"__STRING(x) #x"
+.LASF1094:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1110:
+	.string	"unsigned char"
+.LASF520:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF629:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF908:
+	.string	"USE_ANTIGRAVITY "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF916:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF586:
+	.string	"_WCHAR_T "
+.LASF1185:
+	.string	"blackboxWriteSignedVB"
+.LASF646:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1030:
+	.string	"USE_FAKE_BARO "
+.LASF848:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1022:
+	.string	"_GCC_PTRDIFF_T "
+.LASF867:
+	.string	"USE_NAV "
+.LASF544:
+	.string	"__stub_revoke "
+.LASF901:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1033:
+	.string	"USE_MAG "
+.LASF1006:
+	.string	"UINT16_C(c) c"
+.LASF812:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF468:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF529:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF594:
+	.string	"_WCHAR_T_H "
+.LASF1189:
+	.string	"written"
+.LASF920:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF909:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1194:
+	.string	"blackboxWriteBufferFlush"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF483:
+	.string	"__flexarr []"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1031:
+	.string	"USE_FAKE_MAG "
+.LASF488:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1045:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF699:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF879:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1013:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF922:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF750:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF782:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF398:
+	.string	"__USE_ISOC95"
+.LASF992:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF397:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1187:
+	.string	"blackboxPrintfHeaderLine"
+.LASF995:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF405:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF627:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF767:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF475:
+	.string	"__BEGIN_DECLS "
+.LASF833:
+	.string	"_STDARG_H "
+.LASF766:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF979:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1075:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1097:
+	.string	"BLACKBOX_HUFFMAN_MAX_CODE_LENGTH 16"
+.LASF610:
+	.string	"WCONTINUED 8"
+.LASF440:
+	.string	"__USE_POSIX199506 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF787:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF949:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF706:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF915:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1055:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF880:
+	.string	"USE_RX_UIB "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1123:
+	.string	"long long unsigned int"
+.LASF948:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1136:
+	.string	"blackboxWriteBuffer_t"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF651:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1128:
+	.string	"reg_save_area"
+.LASF399:
+	.string	"__USE_ISOCXX11"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1134:
+	.string	"length"
+.LASF1131:
+	.string	"uint16_t"
+.LASF534:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1018:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF907:
+	.string	"USE_D_BOOST "
+.LASF970:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1106:
+	.string	"__TFP_PRINTF__ "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1027:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF747:
+	.string	"__timer_t_defined 1"
+.LASF436:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF621:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF733:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF499:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF403:
+	.string	"__USE_POSIX199506"
+.LASF753:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1003:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1008:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1039:
+	.string	"USE_UART5 "
+.LASF899:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF824:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF840:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF605:
+	.string	"_STDLIB_H 1"
+.LASF445:
+	.string	"__WORDSIZE 64"
+.LASF1088:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF799:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF593:
+	.string	"_WCHAR_T_DEFINED "
+.LASF834:
+	.string	"_ANSI_STDARG_H_ "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF547:
+	.string	"__stub_stty "
+.LASF898:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF481:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1086:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF683:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF768:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF478:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF590:
+	.string	"_WCHAR_T_ "
+.LASF832:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF808:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF890:
+	.string	"USE_OPFLOW_MSP "
+.LASF588:
+	.string	"_T_WCHAR "
+.LASF1034:
+	.string	"USE_BARO "
+.LASF673:
+	.string	"__S32_TYPE int"
+.LASF841:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF614:
+	.string	"__WCLONE 0x80000000"
+.LASF1115:
+	.string	"__int16_t"
+.LASF596:
+	.string	"__INT_WCHAR_T_H "
+.LASF700:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF889:
+	.string	"USE_OPFLOW_CXOF "
+.LASF998:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF847:
+	.string	"_STRING_H 1"
+.LASF933:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF807:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF862:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1004:
+	.string	"INT64_C(c) c ## L"
+.LASF801:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF450:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF634:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1010:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF738:
+	.string	"__off_t_defined "
+.LASF883:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1151:
+	.string	"lengthBytes"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1073:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF935:
+	.string	"USE_VTX_CONTROL "
+.LASF1158:
+	.string	"values"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF952:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF818:
+	.string	"__LOCK_ALIGNMENT "
+.LASF887:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF637:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF541:
+	.string	"__stub_chflags "
+.LASF788:
+	.string	"__timeval_defined 1"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF717:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1040:
+	.string	"USE_UART6 "
+.LASF737:
+	.string	"__uid_t_defined "
+.LASF762:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1092:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF710:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF875:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF528:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF641:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF511:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1065:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF655:
+	.string	"__f32(x) x ##f32"
+.LASF501:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1067:
+	.string	"USE_ADC"
+.LASF624:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1188:
+	.string	"name"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1064:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF996:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF982:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF741:
+	.string	"__ssize_t_defined "
+.LASF476:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF611:
+	.string	"WNOWAIT 0x01000000"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF449:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF953:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1116:
+	.string	"short int"
+.LASF459:
+	.string	"_SYS_CDEFS_H 1"
+.LASF839:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF755:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF426:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1145:
+	.string	"frameStart"
+.LASF863:
+	.string	"USE_64BIT_TIME "
+.LASF954:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF773:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF489:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF802:
+	.string	"__blksize_t_defined "
+.LASF886:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF884:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF526:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF678:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF647:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1025:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF537:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF669:
+	.string	"_SYS_TYPES_H 1"
+.LASF487:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF900:
+	.string	"USE_OLED_UG2864 "
+.LASF695:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1069:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1085:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF490:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF679:
+	.string	"__SWORD_TYPE long int"
+.LASF494:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF498:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1192:
+	.string	"__va_list_tag"
+.LASF437:
+	.string	"__USE_POSIX 1"
+.LASF991:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF988:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1091:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF536:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF657:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF843:
+	.string	"_VA_LIST "
+.LASF924:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1150:
+	.string	"payloadLength"
+.LASF1113:
+	.string	"signed char"
+.LASF896:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF628:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF1140:
+	.string	"castFloatBytesToInt"
+.LASF823:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF746:
+	.string	"__time_t_defined 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF961:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF769:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF838:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF505:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF509:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1005:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF874:
+	.string	"USE_PITOT_ADC "
+.LASF595:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF761:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1103:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1066:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF525:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF709:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF513:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF642:
+	.string	"__HAVE_FLOAT16 0"
+.LASF663:
+	.string	"__ldiv_t_defined 1"
+.LASF427:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1036:
+	.string	"USE_UART2 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF600:
+	.string	"_BSD_WCHAR_T_"
+.LASF837:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF968:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF756:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1132:
+	.string	"uint32_t"
+.LASF1047:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF689:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF963:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF482:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF477:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF758:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF434:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF438:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF701:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF623:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF532:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF955:
+	.string	"INT16_MAX (32767)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1062:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1176:
+	.string	"BYTES_2"
+.LASF1177:
+	.string	"BYTES_3"
+.LASF1178:
+	.string	"BYTES_4"
+.LASF735:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF694:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1052:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1081:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF872:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF462:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF685:
+	.string	"__STD_TYPE typedef"
+.LASF1141:
+	.string	"float"
+.LASF940:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF829:
+	.string	"_ALLOCA_H 1"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF918:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF451:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1102:
+	.string	"__bool_true_false_are_defined 1"
+.LASF720:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF835:
+	.string	"__need___va_list"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF618:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF821:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF927:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1024:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF734:
+	.string	"__gid_t_defined "
+.LASF987:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF911:
+	.string	"USE_LOG "
+.LASF855:
+	.string	"USE_RX_PPM "
+.LASF1118:
+	.string	"__int32_t"
+.LASF539:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1166:
+	.string	"selector"
+.LASF666:
+	.string	"EXIT_FAILURE 1"
+.LASF465:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1137:
+	.string	"blackboxHeaderBudget"
+.LASF696:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1038:
+	.string	"USE_UART4 "
+.LASF419:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF934:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF412:
+	.string	"__USE_LARGEFILE64"
+.LASF638:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1082:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF806:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF757:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF592:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1147:
+	.string	"compressed"
+.LASF1135:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF850:
+	.string	"_STRINGS_H 1"
+.LASF798:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF548:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF943:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF831:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF985:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF725:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF993:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF811:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF842:
+	.string	"_VA_LIST_ "
+.LASF435:
+	.string	"_POSIX_C_SOURCE"
+.LASF876:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF719:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF851:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF917:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF516:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF894:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF804:
+	.string	"__fsblkcnt_t_defined "
+.LASF904:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1249:
+	.string	"__sigset_t.h"
+.LASF1256:
+	.string	"struct_mutex.h"
+.LASF1271:
+	.string	"common_post.h"
+.LASF1229:
+	.string	"long-double.h"
+.LASF1263:
+	.string	"__locale_t.h"
+.LASF1265:
+	.string	"platform.h"
+.LASF1267:
+	.string	"target.h"
+.LASF1253:
+	.string	"thread-shared-types.h"
+.LASF1223:
+	.string	"libc-header-start.h"
+.LASF1217:
+	.string	"encoding.h"
+.LASF1207:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1216:
+	.string	"blackbox_huffman.h"
+.LASF1243:
+	.string	"endian.h"
+.LASF1200:
+	.string	"src/main/common"
+.LASF1211:
+	.string	"stdint-intn.h"
+.LASF1206:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1209:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1213:
+	.string	"<built-in>"
+.LASF1262:
+	.string	"locale_t.h"
+.LASF1199:
+	.string	"src/main/blackbox"
+.LASF1201:
+	.string	"src/main/target/SITL"
+.LASF1255:
+	.string	"atomic_wide_counter.h"
+.LASF1227:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1212:
+	.string	"stdarg.h"
+.LASF1205:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1222:
+	.string	"stdlib.h"
+.LASF1264:
+	.string	"strings.h"
+.LASF1225:
+	.string	"features-time64.h"
+.LASF1210:
+	.string	"types.h"
+.LASF1236:
+	.string	"floatn-common.h"
+.LASF1235:
+	.string	"floatn.h"
+.LASF1239:
+	.string	"clock_t.h"
+.LASF1208:
+	.string	"/usr/include"
+.LASF1219:
+	.string	"printf.h"
+.LASF1241:
+	.string	"time_t.h"
+.LASF1248:
+	.string	"sigset_t.h"
+.LASF1224:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_encoding.c"
+.LASF1237:
+	.string	"typesizes.h"
+.LASF1252:
+	.string	"pthreadtypes.h"
+.LASF1233:
+	.string	"waitflags.h"
+.LASF1240:
+	.string	"clockid_t.h"
+.LASF1251:
+	.string	"struct_timespec.h"
+.LASF1272:
+	.string	"stdbool.h"
+.LASF1238:
+	.string	"time64.h"
+.LASF1214:
+	.string	"stdint-uintn.h"
+.LASF1245:
+	.string	"byteswap.h"
+.LASF1202:
+	.string	"src/main/target"
+.LASF1242:
+	.string	"timer_t.h"
+.LASF1220:
+	.string	"blackbox_encoding.c"
+.LASF1258:
+	.string	"alloca.h"
+.LASF1254:
+	.string	"pthreadtypes-arch.h"
+.LASF1218:
+	.string	"blackbox_encoding.h"
+.LASF1234:
+	.string	"waitstatus.h"
+.LASF1203:
+	.string	"src/main"
+.LASF1228:
+	.string	"cdefs.h"
+.LASF1269:
+	.string	"wchar.h"
+.LASF1266:
+	.string	"common.h"
+.LASF1259:
+	.string	"stdlib-bsearch.h"
+.LASF1230:
+	.string	"stubs.h"
+.LASF1215:
+	.string	"blackbox_io.h"
+.LASF1257:
+	.string	"struct_rwlock.h"
+.LASF1261:
+	.string	"string.h"
+.LASF1270:
+	.string	"sanity_check.h"
+.LASF1204:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1247:
+	.string	"select.h"
+.LASF1268:
+	.string	"stdint.h"
+.LASF1232:
+	.string	"stddef.h"
+.LASF1231:
+	.string	"stubs-64.h"
+.LASF1226:
+	.string	"wordsize.h"
+.LASF1246:
+	.string	"uintn-identity.h"
+.LASF1250:
+	.string	"struct_timeval.h"
+.LASF1244:
+	.string	"endianness.h"
+.LASF1221:
+	.string	"stdc-predef.h"
+.LASF1260:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`F"
+	.string	"u\005"
+	.string	"\024\t:\001"
+	.string	"\021"
+	.string	"\206\202\240\354\b\b\002"
+	.string	"\002\001\002\002\001\002\346\363\210\306\r"
+	.string	"\003\261\212\377\276\007\002\002\003\002\003\004\254\367\307\344\013\006\002\004\003\002\003\006\271\261\202\262\r"
+	.string	"\007\330\262\250\236\005"
+	.string	"\b\357\200\233\236\n\004\002\005\t\300\264\270\255\013\002\n\362\216\232\367\006\002\002\006\002\006\013\375\332\335\323\f"
+	.string	"\f\364\347\215\006*\r\325\316\226\334\003\026\016\255\216\224\352\004\017\234\302\270\366\017"
+	.string	"\020\227\251\300\225\t"
+	.string	"\021\264\252\235z\b\002\007\b\022\240\342\234\212\n"
+	.string	"\n"
+	.string	"<\366Z\313\256\022\025L\313\034\0028\365C\346\332\002<\314\345\274+\264"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.ipa_sra.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\005\004"
+	.ascii	"r\304\013\022\240)\035\377\343\252\252*\334l\371\326\312\267"
+	.ascii	"\355.2\245\252\256J\237 \177\320\362v\262f\366\216\361\027O<"
+	.ascii	"\274y\202\007\300Z\352\266{\\\t& \320\202!#z\\\241b^X\356\004"
+	.ascii	"\263/\255\254`N\210\273\3054\fh\313W\006D\004\344\225\275\263"
+	.ascii	"\013\230!g\215\306\341w\t\006\323j\221\234pw\f\217\026\313-\240"
+	.ascii	"\025\tJ\311\310<7N\276\335\025\272\220 \003\327\016\324\260\026"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`s\004]\020"
+	.string	"\366\025M@\020\217&\351"
+	.string	"z\237[\322b\212:\316\032\237Q\005\207 \252\003w\216\322aN\365\306\311\360\001\203\334\234\001<R4{\200\306&"
+	.string	"("
+	.string	"\005"
+	.string	"@fB\202\nP\242\376\361\331\321\032\255%{\313\0240"
+	.string	"@"
+	.string	"@"
+	.string	"_\265\357\353\357hz\377 \211\314d\035x\325\372S\247 3M\376\256\355\205\314\314|\033\275OD\363$\227\231\351\271/\t&\013\r$\366\2363\237\033-\b#\210D\300\260SA)\361\201z\363\272\327!Wr\031$`(\201`I\306\214\007\036O\375`[\243\324]5\320A \211\\\246\222k*PNPk~d\n\335Kfzt\254^\206\r/\240\324\035hf\301J\f\2113\200\033\302\021+1+Z\341\036mH\001s\2139\267\230\231)\235o}\006\256\205\302(\006\216\\\264\260\260\222\t\214\223\232X\233\020:@\021\242CUf\217\327K\005_\265\253\366\005\3012\341$"
+	.string	"'t.)\315\003\310\034\350\031A\006\342\270\263\246\252\335\313\363\f\t|k*\200/\032\207\006}}\274BN\304\300\302\313\372c\221\245i\202\376\200R\207\240\001\\\250AMDH\304H\22323\034p\"2df\033\022@\365DDI\204\020C\001\205\024\220\024\244<\212\n\362\356\0014\323\276\b\341\316\224\370\026\2238\362n\234Fy\335\243\365,]W|\270c\262\241\357\216Rc\021\305\233\245\346"
+	.ascii	"\374`\301\312\2431,\220\335\353\013XG\322\211\214\377\"\001\227"
+	.ascii	"@ui\2769\006\226\304\023\002\375,\325>\332/C\262\b\240T\212\251"
+	.ascii	"\230K^_\034\002\n\205\221\006\245\304N\342\376\"0\200O&\213d"
+	.ascii	"\206~h\036 Ik\207\247\332\021\360\261i\357\234\317\252\373+e"
+	.ascii	"\206\227\241m\372\330\2359\\\303\276}\234v\264\370\344jR\367"
+	.ascii	"\304)\350\255\266\321\211!\335\376[\357m\203\204\022]\374\254"
+	.ascii	"\033\265\023\315\210#lT\261\303\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`R\004u\f"
+	.string	"\242\317.-`\211\222\016\022\b"
+	.string	"\f\001\333\327!Hu"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"w]e\200\rY"
+	.string	"\2170p\005\201pcP\200]\330@\377\021\372\037\344\223&\223\f\244uqw\023\232i2\250@!\006\2446\251\001\220\001\225 \254\003u\r\211fOS\352\210\004\344\342p\277|:\037\316\003g\210\357(\036\374\036\216\3576\323\364\212h\r\232\243\246\250I_\006m\351\356\356\306\342\247yS\026\247\334\223Ez<\225\212\305\262\251\033\236\341(\232\021\253R\217\276\212|\340\252\027^a\322\224\215Y\217\331H\n\221\t\004\227ag\326gV\247\246R\357C\374V\035\256:\223\215j\221\362\361-!5\350)\241\242 [\2501Q\346\210HR\250\f\333\001p\"!+\263\r\022`D=\001\006\243H2T\"I\312((I\031\245\362\326oA\237\262\275\310\006\317\332F#D\f\n\261\326O\3334}\216\335\235\331R\365\322\345\235\232/\271\204\017ib;\"`\363\036nj\212\227\234\306\202\216\024\272u\246\357\007\343"
+	.string	"\003"
+	.ascii	"E\241\035\236\201\332\032H'!\006\217G\370\002\001\013\234\350"
+	.ascii	"*\3074^\220\207]\")\312\023\263\037\364\366\223J\022\273\233"
+	.ascii	"\3409~\205\316z\330\377\270v,\213\035\252tu.\323\226\0072\030"
+	.ascii	"\230\005@C#\n\277\211\346y\271\355\242R\013\344\021)\006K`\n"
+	.ascii	"\306\rxOa31\303\276\026v\224\226\026\336e\207eB\371\320\214\256"
+	.ascii	"\006\333\222\\\036"
+	.text
+	.section	.gnu.lto_.pureconst.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\230\004\002\230\004\003\230\004\004\230\004\006\270\004\007"
+	.ascii	"\230\004\b\231\004\t\231\004\n\231\004\013\230\004\f\231\004"
+	.ascii	"\r\231\004\016\231\004\017\230\004\020\230\004\021\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`'"
+	.string	"\025\004"
+	.string	"\202\204\017\032\220E\351\377\377\177\371n#7\273\273\373j\226\006\320\376\357\376\362\033k\277\224)7(r\206g\224\326x\202\274x\037g\250\377\024X-&\372\001\250J\3419\270\355O6\345\254|9=Y\034"
+	.string	"\006\213 j\200\020\342\360\020{\313\360\004\2726\201\035\f\310z\006\313\241\033\204>#L\030\f\333\r\006\n\241\243\304\341p\253\332\245E\306\024\bla\2663\267b\033\310\rG\261\345\"\260m"
+	.ascii	"p"
+	.text
+	.section	.gnu.lto_.lto.73cc96284c52cbd4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxWrite.18.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`g\001M\016"
+	.string	"6\332_F\360\260(\035\362;\023\241\017\\-3\fy\177\030\273\215\3457\017ty\211\377\\eB\222S\031\257\b\243)\210\f\201\250\025;\323\203Md>C\236Au\f\212\307\340c\240\311\325H\337@\256`[\333'[\312\224\002I"
+	.string	"F"
+	.string	"N"
+	.string	"\272\333\222\242f7,\340\016\3205\267\354\027\017av\3738\274b:\273\313\351\206\267\0365[\376g\036\002a\256\307\f\327X\232\240\303\262\001[\211\242\235W\213\317<-\300\276\314O\202\335u\2020\f\267v\333\013l3\260\037\006\232MP\362\3405\037\305s\355\312\021C\243\2223\247\f\005\213\315\031v\350J}\261\037W]\354\313\374\241LGM\253\246S\323\337<0V"
+	.string	"\260\331\2750\243\2617\332\t\017\266\277\331\242\n\0062m\322G\3532)\016$\020\304\260h\324O\354UCu\304\312\003G\304A\031\377\312\223\252\372\211Qh\371r&\213\245z\344\330\304-m\021\222<\350\001\237\272,\222\251\260\213\032\032\r\252/\271_y\256\247\0209+\271c\333;\210\025hwA\374\017\017K\374\016\017.u \035\037%\022i\324\215BT)\007^\247B\t@\231\214\230N4?\030y\251\006\022\274\223Hg\0329q\252\224\211\204\353X%\334\210\200=\b(\026\027\301\363X\334\026\356\343\252\213\202\0307*\3729\244\266On\"\205\003gw\017\330\250\227\b\t"
+	.string	"s-\034"
+	.ascii	"8\313\007K\275\231\320\306\024\330\365\237\023\033C`\261\253"
+	.ascii	"\322\271A\366\322\300-\023\b\020\027\253\f4\303*\020\002\333"
+	.ascii	"\275\203$p\257\017\222I*\354\025\025\215\231\271\3215\274/\023"
+	.ascii	"\n\230\032\"\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto__putc.19.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\225\t"
+	.string	"\346RD< \345*\035\007,\234#@\356`\330"
+	.string	"C\231Da'F*\251jD\260\342B\201Zf\021[\207\026\271T\013\341\217\350\030\201\200\024N\261\353\231\230\016\214\327YC\203\002ZI\2232\2451"
+	.string	"3"
+	.string	"/"
+	.string	"\234\343?\233s\235\023l\3169\264g\036K\266\301\005\306\"`w=%y\370\f\375\257\334\023\223\271\236\034\207\335u\306d\036\267\3366\202m\b\333"
+	.string	"\002\333q#\2605\356\305\304\366;\273\013P\322\264E\244\360Q\303\272+\322B\333]\220\037:\347:[\351i\037\345)\341Ul\373\300\356\354\204\266\033Af\350<\251v\013#\037\363\001\207\272|M\325\353a\005^y\363A>\0371\233\003\354\350J\035\261\257\331\335\265\316\354\307_5\235\232\3647\036\231\002\230\r\337=\372\026\024H#\221(d\260\272\277\320\204*%\001~*TD\006x\242\370L\025'O\2252Yx\037\253\345\205\022\f\256P,\357\002\004Y^\027\367:3\027R{\351\2069\031\013"
+	.ascii	":S\005K\021\231\320 <\016\\\310]\350\253\\\004\256\001M\026\346"
+	.ascii	"\214;\274h'\031"
+	.text
+	.section	.gnu.lto_blackboxPrintf.21.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`I\002\345\022"
+	.string	"6\"zI\320\360(\035\220\261\234\200\201\365R$\264\342iG~\260\007\031\301\034\027\260Sd\021!\310\016;T!J\322\370eD\320\037+\257\224\271\225m2\373\022s5\336\265i\307>\342\317\271l\220\335.\242\241MY\223J6\331;\245`"
+	.string	"`"
+	.string	"e"
+	.ascii	"aO\352?\035\274\275\255g\202\007\022\r\365j\013`H\"\365i\377"
+	.ascii	"\305a\304^\302|\300\356\316M\267[20\004\360\325%h\333wqZ\314"
+	.ascii	".\2420\343\245\270A\003\264\333]\361t\003\337\253\367\002\337"
+	.ascii	"+=\361\330g\314\277\355!6\242\031N\314\347G\311\356z\316pD\334"
+	.ascii	"\364\266\025\330V\261\247\212\257\375\366\375\240\353\354\320"
+	.ascii	"\260\337|\334\211(\316'\207\266\273a\256\346b\224\252\363\271"
+	.ascii	"\017\325\\\206\212N\303\006\360j\024\360U\310\333\021e\202\242"
+	.ascii	"\035\3525\304\245>/\004{\tCk\326\303\315\224\264\335\253\037"
+	.ascii	"\004\263\303\327\3331_\306m\016C\236\324\214\003\305^{)\221\251"
+	.ascii	"\331\020\243\333\215\n|\375\201\3645\306\025\270+\373L\274\257"
+	.ascii	"Ka\315\317>\032A\207F\367\n,\216\210>\341\303.)\211(\236\243"
+	.ascii	"\364B?\311t\001&\352\277\335\266\002\002bw?\263I\r\3633\237f"
+	.ascii	"h\214o\323\342+n\226\222v2\331\245\314\244<\366\275\335]\323"
+	.ascii	"\035\373\233\376^\376\024\004\211\261\343\b\211\346(7DS\017\031"
+	.ascii	"\216j\243'\343\212\245\345\224\342R\201\252\r\263\265z\275X."
+	.ascii	"\330\207I\306\007\r\034\220\214\214\210 x\255`\240\036ERZ,\024"
+	.ascii	"rl\255L8\220'\031F\225\312\211\330b\251V\304\321\325\"\212,0"
+	.ascii	"\311\262r\211/\222t\211a)\273-\2432~\361vKH\320\3613\233\374"
+	.ascii	"\236\033\002\363\202\211\007\233\335R\322G\377\223\373I6\231"
+	.ascii	"~\333=%\035\001\263*\371\344\320h2 p\2422\227\035\331i\201QO"
+	.ascii	"\f8\303<\024\355a\321S\024\370q\300\226hK\030W\344\264\201\360"
+	.ascii	"\251@\025\206#p\334\351\207ztZ\357\220UG\330a\247\206\033\232"
+	.ascii	"\274]$\342\307\217d\3540\037\202\f;#\356`\0026\237!\262\274n"
+	.ascii	"\257je\304\017Y\260\177\t\256Q\200\350\342R\203:\254\352:\251"
+	.ascii	"\242\220\002&\036d'z\244\225\216`\310"
+	.text
+	.section	.gnu.lto_blackboxPrintfHeaderLine.22.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\\\003\225\027"
+	.string	"6\352\225I\3000\2511\374\t'\326Y\bsk\334]t\262\373<\020\255\343\317!\225_uB\001\004\334\370\371\213\3141R-e\267,\024H$z\332\336\354\317\354NjC3=\030{\242\310\240\363L\201\030\3557\375\327-\331{K\231R}"
+	.string	"x"
+	.string	"\206"
+	.ascii	"[1.\003\370\343My\211\351\r\252\020\221#^b7/\"\363\262\035\351"
+	.ascii	"I\300+}\240\351\244\027\210A\211)#\311M\267\304n\322J\331U\352"
+	.ascii	"u!vSFe{\265o<\f\340\217p.\340\336!*\344\275i\211\027\304n:}\310"
+	.ascii	"y3v\002\347M\003\355\035"
+	.string	"O\211\356\223|z\226\270\356\2755\253\342\300W\240\177\246\177\f\201\202\257\260\225{\257\353\020\210\304mo\333\200m\032\333\032\003\366\313k\207\354\263z\366\364G\177\364\303\316j{V\327\263\372\003\002\020\025\203P\200\260W\351\025\361\325CXe&[\374\370\333\367\235\236\264Q\377\336\344C=*\345\007\253h\274\367\242\310\243\215\r\233Y\217<\215\243\r\224\224?\303\376\270i]\354\346\323J\216\317-\237\210$7Q'\333\353\237~Oq\254\317-\235vR#\327\275i\311M\337\351g\2437\377\2453\031\225\005\302\372\3453i%\0031\312\352\322\022\251\022&\350L\331+\375L/\267\204Bj\313\017V\321\210\332\327\250`!v\257\360\303\332\375$\206\f\365\303\231M\021\352\261A?y\n/\254\242\376 \304\355\332\252\021\035\211\332?\235&4*\232U\222\277\351L\267\002?C\033\227\333\261A\317\214\210]Z*E"
+	.ascii	"\025fm]L\020\315\304G\365\361\226:m\036M\375\3204\035\033\364"
+	.ascii	"I\264\002q!\324\245u+\017;\315\2516E\270\334L\r\r\246w\213\335"
+	.ascii	":\324]\316\347\323\365~0\237\314\2135\nN\001\202\004("
+	.string	"''&#9\231\333\2564\316\004f\247\333\300\303\355r\032<\360\\bp7\016.\265\235\356&S\303\365jj&\007\314\233\311\365j>\036\257WCS\341\313k\207\354@\252Jhs|S\336{\242\301\217\177\026R\375\262\2659>\324\252\366\326Z+\305ST\362\231\255\266\324\301S\314\251_\366o\034\007\004\237\205#\260\324\017Y\316\233\267#+\210\001E\250a4\213\004L\240\224\031\021\211Hil8\240\002!2\253\003\021`9fC\224B\245\003Zu@\202D\244\226,c[P\327\375\017\277\020 r\262\214\276cr\254\215c\316\002[\351AZa\201\3258\2325\034\034\343\001\007\215\356\241\264cG^\033\234='x\245\311\353]\332ZI\230\345\331\277\264~\371h\360+\261\0076\034\t\333\247\335\276\217w\247\341\234\031\246\252\334\316\004\372p\026\201v\250\\\233\272O\002,\355C\334O\212P\245\032\211"
+	.ascii	"QSpg1\347?"
+	.text
+	.section	.gnu.lto_blackboxWriteUnsignedVB.23.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\216\001\025\017"
+	.string	"\266\234dD"
+	.string	"\257(\035\355:w!P\255)Fu\034\303\237\207v\177x\245\250\361\277+\"\r\317\224\234`\252~\2533 \036_\364\327\342\261\365\301\356\322\257K\3133\257\363\b%\360\037w\376\203k\346\307 do)S\nO"
+	.string	"M"
+	.string	"M"
+	.string	"\002\264G\370"
+	.string	"\332\243M\366\212\303Z\366!\\V\"lv\267S\r\206iz\204\232&?W>\226wz\204\233Je\203\206\247\202\0362\232\230\277\236)^*!\207\326\365\257\303\016+2,\257\365\334>v\327\311\362,\334\332m\207\330n`\377%\316X\215\212M\0276\354\224\312b\337\243EFc\315`w`\232\303\335\365ow\335Q\323P\323\232\351\314\3645\264Y\212\0010\273*\337\213\235\2111.\266\317\331"
+	.string	"^\024<\355\1778\b\323]&\316\330\305P\302\304.\254\200\023`<z\036\0325\305\337M\264\250\013P\234\244\314\177\375\027Pj\242?Ppw\027rz\327=\250\373\204\026\225\323\337\240\3144\233-Um\222\222<\313\236\023=9U\365#\276\337\320\256\251_\265R\3719\3525oV3T~\346\304Z(\214\214\312\323\356\b!0p\240\203\203\343\263!*\031\001Q\210\016}\036\214DBH\241\221\310A\005\022\b\204\020h\004\244\033\211\200\"t\241\022I\367!`\222\004Q\251\233@\"\225:\016\266\2070j\207\3017\203\322\224\267\204\034\205\372\3273V\263\216r\324\311b\221\261\233\250,\030/<\220PN\rs\013\037"
+	.string	"}\246"
+	.ascii	"\226\":\243\301\t\227\265\372\213\001\265\214\240\027\363\217"
+	.ascii	"\255Cjn0**\\\334\257N\364\264\003\262\324\241\315\316MW\027\276"
+	.ascii	"\005\321\3769\234\316*9#i\271\312b\357-V[\253\321\301\275\270"
+	.ascii	"\245J\3252P/\233\204\371\004"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVB.24.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\325\b"
+	.string	"\366\320>80\221\322\001\200\300\312\"\225a\310\226u\266_\360\020Y\247\267%\271\031\303\0135T\240\\\253\026em\335\310\3665\f8\001z\370\307\255a\310\004\232\031\277\332\357\376R\246\024+"
+	.string	"/"
+	.string	"+"
+	.string	"\017"
+	.string	"\035\332\263q^C\331\303\330Bbtv7\352\311\275\247\347\377\345\243O\026{\206\032v\327\371\311Fn\275\355\002\333\017\266g\002\277f\372\240\320\212\315@\316\256H\017\317\336`\215\212\355\223l\200\024\206\247\375\226\273x\247ux\264[b\243\331\335\003/\210\016K\027"
+	.string	"\035~\0023;\260\334<\364\303\242\274\332\026\260\374g\230\252\266\006G\376\273\226@4\346\224!\271\331\334\261k\261T\023\373\237\335]\353\314>-Fq\n\b\t\250\323\311D\260\302h\2452\2409\223\204\213\025\321q\256\025\304F\247\232\340R-Ut\261R\024\221{\301\242\311\300]\305\352\025/\272\356\025I\265\375g5\n"
+	.string	"}\246"
+	.ascii	"\226\"2\361\232/\032\\\334j\336\\\227\241\255\325hp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_blackboxWriteSignedVBArray.25.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\357\001\275\021"
+	.string	"\306\"xG\340\320(\035r!\300l\344\214\255\216\272F\340V\357\337\242z?\344\035F\271\362J\324\375\214\035\203\036d\304\257\347\366\036\325T\225\241\243\257\305\302\f3\314\2172t\353\247A\rB\302L9z\r8\214\315\356-eJ\001b"
+	.string	"_"
+	.string	"b"
+	.string	"@\273\265\0213\350\036]\373\200\322cw\001\245G\277l\034\257\365\354mC5\267\034\273\213\322\0176}\337\367\035\326n\230\257G\250\371\362m'\220\363\311h\260Gh\232\261\t\001\2006\003O\220\216\202\216{\316h1\tG\334\\\217\373\201\234\0322\332\315\323\204\262\273N\031M\303]\272m\013\266S\354\364\002\357~\273c\246\341\323\252\351\324\364?L>2@\212vm>\035k\024\203D\374\366\333\367\330\220\362[\3708{\036\034R\366\315B\035,C\227\263\021\035\355\256\310\243U\335\343=\333c\226\312\332Y\274\376c!\237vun"
+	.ascii	"\355\356\210\035t\217!\360\364\245\236\366S\\\305\353>0\017\260"
+	.ascii	"\2733\024\352\351i:\0240%T\233\305%/s\210\214\302\354\273x\271"
+	.ascii	"\320\201\360aJ\1771\303I=\251\352iJ\300;F\351\232z\032\0221\371"
+	.ascii	"9\352\025\322\250\331\021\313\317\0379\024\2529\03034\265\310"
+	.ascii	"\177{\312C,\223|\334\241\t\235\314\235\230\261\231d\327`\251"
+	.ascii	"<\366Oz\220\216\254;\266w\237\377\364\237\007+oa\271\264V\321"
+	.ascii	"&\253\005\t\024\230\224\224\220\200`P\271\\\252\350\025I\004"
+	.ascii	"\326\n\204\326\212\245\362\340\245\225\"a\245\232\220\202b\255"
+	.ascii	"\250(\240V.\026\024\211\001\267*\250\270P-\255\226\013\345\325"
+	.ascii	"\366\272\343\333\336\345V\030\3054&*\217O8\352\251\332H\221G"
+	.ascii	"\235\331v\247Q\033\020\311$R\221NT\224X&\035\356\356BO\177{\b"
+	.ascii	"\202\307# `\002)\226\363])\200\025\021Fs/\257-\322\376r=\017"
+	.ascii	"\363\030\326\332tV\034\357\362\260=\"\353f\2647\314\\]\330\022"
+	.ascii	"\306=\217\353\357}m\341\264aXs!\365\220C\374\230\332\2113a\343"
+	.ascii	"&\370\"\245\273\227e\221\027\206\212\361^\"\235\253?\001"
+	.text
+	.section	.gnu.lto_blackboxWriteSigned16VBArray.26.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\376\001\025\022"
+	.string	"V#zG\340\322&\035\242\226pF\037HT\313\212\300h>\f]\263\321\017\030.[\034\027F\252\254\337\272|}h\242\031\3476\215\342V\022\315\225V\001\004\031f(M\005\266y\247\003\001\310C\324\001\371\265h\020ido)S\ne"
+	.string	"a"
+	.string	"c"
+	.string	"\333c$\264K#1\004\357\321\264\023\350\036\275\017\350\036\375\262u\234\366\263\257\335\260\261\365\330]\224\202\260)\227\313\345\016i7\314\327#\324|\371\265#\330\341!\233\301\036\241\211\006GD\200\031\rDQJ\032\372\355y3\223IH\"\347\372\333\027\354\034\311f9OS\312\356:e3\017ww\333\033l\253\330Y A\377w\333\335e:\3024|Z5\235\232>"
+	.ascii	"\223\321\214\003E\27389\037\213\024\207F\334\366\333\377j\244"
+	.ascii	"\374\025\376\315!\237\215\224m3\221\007\353\340\341j9\222vw\344"
+	.ascii	"\321*\357\361!\366\367\"\225\264\253x=\310D\376vyv\b\355.\211"
+	.ascii	"%x\217\"\360k\221z\332G\361\024\257\003\305\\\300\006z\322\327"
+	.ascii	"\354$\3602\252\255\241%/\263\310\214\302\f5\352]\370,`^\274\020"
+	.ascii	"~\214\376F'\246 \252\372\032\023y\307\350\256\251\257)!\2239"
+	.ascii	"wz\2056l~\3042\347\023\016\206*\256\210f\246\036\371mO}\210\345"
+	.ascii	"\222\177;<\301\223\270\"\032\233K6\r\226\352c\037\345G)\311\332"
+	.ascii	"c\237\016\364\203<,wa\275\264V\321'\253\007\r\034\234\230\230"
+	.ascii	"\224\030\340\240r\271T\321\253\222\n,\026\n\255\025ke\002LK\305"
+	.ascii	"\302JuA\005\305bQa@\255\\-\250\022\005neXq\241\\Z-\027*\204\266"
+	.ascii	"\327\036\277v\017'\003)\2462Q}\374\351\350I\025G\216\274\323"
+	.ascii	"\033\333\376\264\323\bF3\251t\304\323iJ,\227\016ww\341Io\273"
+	.ascii	"\b\203w\001$ `\002)vd\007])\200\025\021Fs/\257\262\310\200\224"
+	.ascii	"Cr\230\327p\031\246\261\222q\027\r\366\036\255\373R\327\f\305"
+	.ascii	"\262\031#\0343\r3\376h~\273o+\\-\3546W]\027q\305\017^;\027\323"
+	.ascii	"ct\202\257\255,\342\262,\362\302P=\336\217H\347\022O"
+	.text
+	.section	.gnu.lto_blackboxWriteS16.27.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\244"
+	.string	"\035\n"
+	.string	"\226\023G? \307*\035\bOQ\206\021\270\366\024\002:1\200W\200+\0246b\200\001"
+	.string	"^\033T\311\355G[O\271j@\303h+\341\023\020\242\204\032\373\302\330\340\177\202\305a\200hXC\204l\"eJ\0012"
+	.string	"3"
+	.string	"3"
+	.string	"\024\231\307\203'p\217y\004\356\321\241m\3401\225\375\313l\0053\333]OS\036>C\377\260kX-\324\263\263\330]'\253er\353m;\330\306\260\257\020\352\262\377\372\271LGMo[Z3\235\232\276A7#\300"
+	.string	"`\267\244\266`eQ\300\212\355ol\rKE\246\375\226\273\204\177\2118\356\236\300\002\354.\204\003q\323\250\272e\356\001\034\247\252'\241\251\262\346\016A\227\251\266\351\224g\271aDQ\276&\247\327\257h\251\2549c\016\024\330T`\307P\251(\366\267\335]\007\366|\023\021\022\236N\207\263\020:\215> \321\037g\203$\322"
+	.string	"?R(#\004\004q|\237\021\310#\211>\035\336W2y\234\007\203\036\241\222\367\001\202%o\023\333\253\313\027\td)U\271\313\016"
+	.string	"}\246"
+	.ascii	"\226\"2\241!\3368\\0\201t\360\234 <K*q\001\"\332elk5\032\334"
+	.ascii	"\345E;\311"
+	.text
+	.section	.gnu.lto_blackboxWriteTag2_3S32.28.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\353\024\315Y"
+	.string	"\352\224\334\037N \224\312I\007=d\314\2509\354\026"
+	.string	"\341Yyp\357\260a\203-J={>\212T\274\314\355=\340\330\201\r\326H\3771\277"
+	.ascii	"\247+\317)\352\357i\345A\325\246\237$5^\304\276\347X\007\b\305"
+	.ascii	"B\177J5\226\367\036M\032!$I)\003\355\001\267\001\352\001kt\366"
+	.ascii	"\236"
+	.string	"8{\213\316^\242\367\022\317\336\241\263W\350\354\rz\357\360\275\302\2637x\366\2328{\201\336\013|\357\217\331\3733{Sn\343\365\231\275\250\331{\276\327\344\336wow/3\226%\2742.J\260\013\301VG\350\303\247\342\235;\204a9f4\314p\314m\314n\374CA\315\002\177]\206\365\313K\034Z2\315\002\177%\374\240\241\316\217\013\3072\016\313q\013\374\031\341\266\256\370\305V\303l\234\305\245-a\225\362y>\303o\013L\213p\333\272\342\257V\263-9$I\371L\363\340`6\276a\213\333\266.\345J\246tS\316\352\324Z\231\370\334!)\237E3\305\202\203{\227\323Xm\213\327\2628\250V\025\326\344P+\233\323\326H\371\\6&B\371Ly\b\345swk\227\016\263}\251\374V\345\370\266D\255\025\352^\224\210\366l\262\361\376\314-N\241\224\204\204\342\310\350D\021\021qH(h(\f\232"
+	.string	"\002.\375\374R\037z\232\357\255\345\025f\340\300\302\2708\305\232\2320\255\244\306IE \335\241h\003\303Q\017/j\354\230\211\245\261Q\r4\240\303d\031tXk\265\301<\241\206;\215-\215\006315.2\207`L\030eM\344\213ZA\354\005&\016\t\271\320B\007\371\242\314\304\316x\310\202\230\344\227\026\242`\026\323\260\n1\311\263\016\372\250\2308\365`"
+	.ascii	"\362E\275\361\016\345\021v\314\304\326\030\370\002/\2319\201"
+	.ascii	"\013\233%M@\201\202\030C\266*\314\222k\347\2179$3a42\314\253"
+	.ascii	"\177*V\020\333\302\251\317,\346%\265\034\033m-|\006\303\214f"
+	.ascii	"\261\326\n\f\233\322\246iC\255\f\013\301\260/\363mp>\260\230"
+	.ascii	"$Y\237\343\370\305Y\\\232\0363\261-\334\276\250Z\3536X\230\030"
+	.ascii	"o\221w\273\356\356\223]\241#\002\354\005IB^\220G\311\315\200"
+	.ascii	"\327\305n\254\2044\203\327\325z\2356\261\324{\274\337\214y\202"
+	.ascii	"rj\353\346\20715\337\225{\306B\177g0\375\273yg,#\"m@\233\267"
+	.ascii	"\016\225\272\004\3579c\036!\222\f\223)\363E\357\0242\026\232"
+	.ascii	"\246\351\037\307X\3465\246\211\250\243C\036\363\312"
+	.string	"\315\301X(z(g\340|\365\236-2\026z\036=\033\313~\376s\216\313e:\021<H\317\226\263\316H\262~\325\1776\306`\362\276A\371}6\212\361\352>k\344\374\276;.\273\272\317\002\311e\311{\255\225\353\313t\203\343\330$cf\227\324s\207IF\227\25665\374p\311#\352\200\246\347Nm\275]6\256\276r\227\271\204\021\300P\331\253\260{\305\n\022\254\312{\231\nsq\335\322\312\222\022\345\275O\336\353\344\275M\314^&K\314\336\016\336\253\204\327\230\253\336\233\344\275T,\307;\305hx\2170\034\257\221\"D\206\ba7^)v\343\r\362^\r\336\233\301{1x/\220\367\376x\357\005\334kA\367V\320\275\024\274\327\307{'x\257\004\357\215\340\275\020\274\267\307{\037\340^\007\272\227G\367\356xo\003\357e\340\275:\270w\201\356U\240{\243\336\233\203{qt\357\215\356\265\361\336\004\336\213"
+	.string	"\332{\300\331k\300\331[\303\354\245a\366\3160{\0130{e\2747\006\367\022\320\2750\272\027\352\275O\357uzo\023\332\313t\366\2768{]\234\275-\336;\300{\005@{\0038{\0018{Y\234\275+\336\253\342\354-\276w\351\275)\336\253t\366&\235\275Hg/\212\367\036\275\0033~\326\031\313\274\260\370\220\327\004\207L\007\341\225Xh\001g\2633w_\275\007\013\225\361\002b\\\306M\272-.1`\274\352\004\360\034C\035\306\221C\275\367\216\313\2565<d\235\333\210<\353\275g\344\223\206S$\360\324\321s\307.\215L\n\301`\362\212\022\374t\276\"\347i\311V\3141]\270\217\323\331\312\267\217Z\234n\362ibz\323\2133\235\267*_\241.\376\"\007_\241-\356b\200\267\030@\357\216[N\217\211<\002\004p\001"
+	.string	"x"
+	.string	",^<"
+	.ascii	"c^F\360\212\263P\361\025G\345\250Xz\361\347[\036\247\370\322"
+	.ascii	"\315\2728)\376$\220d]H(%]i\331\370\nEz\322M!_\241(\216tt\024"
+	.ascii	"G\217\216\276\341y\303-g\007\b\b\247\215\276\333\304\252\031"
+	.ascii	"l\213_\347\332\0237:\317\035\227E\037\372\211#\355\035\307\316"
+	.ascii	"W(\321\213\210'\272R\234\343\262KNJ\274\322\233\320\203\037\272"
+	.ascii	"\321\335q\214\257\320\240\013\r\037\304lX\370\341\221\346\342"
+	.ascii	"h\241\231\302\037\315A\222\231x\360\346\036\330\035\030|\205"
+	.ascii	"\002\335\304\371\250\005x\240\363q\331\365s\340}s\214|\274\264"
+	.ascii	"\320~\216\316!\311\356\362\252\035\277\301\343\352=\340\225@"
+	.ascii	"0\367\3362+\r\221&\303\222\371\223z\031\2735wb!G\342\355\323"
+	.ascii	"\322\271[\233\006\253\025\316r\035\237\037\326i\t\264\332\305"
+	.ascii	"\3156-\235\264V\256m\260:e\016Z\255\325E\233\345\262\364KMV\266"
+	.ascii	"\352\202O!/\032{\271\374\306?rvB\316n\310\237+\367GD\272\344"
+	.ascii	"\034\307<\336\320\0309r\3154\310\317\216t\315\304RG:\261\221"
+	.ascii	"\353 \342\253\367d\221\223:\273q\267\036\034\233\265\326\372"
+	.ascii	"\273\362'\347\315\322\327\343k\242Rg#\336\254\235\022<\310\221"
+	.ascii	"\273K\316p\\lb#_r\016\"p\032\003\212\025\bH\250\230P}\360[\031"
+	.ascii	"Hh\0200CF\214\030OJ\037P]1\231\n\001]$OUN\224p`\205\304\t\225"
+	.ascii	"\021\021\2546X\202d\212\311\006PN\224L5\201B\002\345\003\250"
+	.ascii	"\247\026k\365\204\n\n\024\bVVP\240\200l\225\257\302\372\260\203"
+	.ascii	"\327u\257e\037\222)ZH\212\362\263\205\"&\236:\222\3250\024X\222"
+	.ascii	"\224\257Y\344{\221)%\314\212\234\333\246\316rJR\212\\\312}o\306"
+	.ascii	"e\224\263\334\324\243<\215\020\206\246N\357uR\017M\230\274\311"
+	.ascii	"}K\243\016\316\344\350R\203w\260\354\322\200\215\222\f\256d\013"
+	.ascii	"c\360\f0\330!\t\220'\371q n~\344@u\301\251\334\\P\301\253n\001"
+	.ascii	"\005\257\200\0023H\016\322\251!\325@\305\307\231\312p\202\373"
+	.ascii	"\230\240\314\223\b\376\244\305\030\202G@\007\002\031\234<p't"
+	.ascii	"\036\340\361\252;\260\343<v\220\251\302A\2721(\320\300\0328\203"
+	.ascii	"\245\f\274\201\237s\306%\0037\313\252\3508W\321\332\243C\201"
+	.ascii	"W}\201\250+\020u\302\221\203t&\034\t\265 y\310qFv\345\270\361"
+	.ascii	"\252\343\260\361\033S\267q\223.K^Oa\341\230\221\225}\202\003"
+	.ascii	"\266\\gGe\235\216sm\\b=zIS\247\326\004~\366r\235\270\310\023"
+	.ascii	"\370\367\030\013\035\ty'\210\210\334w\244\034\003\351\242\206"
+	.ascii	"M53a\022\201\003\216\200\001? \212\257\320\0327\340|\034\363"
+	.ascii	"\275\306M\266\262F\257\350\312\005\356!\246\341\337\027<t\226"
+	.ascii	"\230\r\037!\0169\277\361\357\f\317\332\022\023\0239\303B\344"
+	.ascii	"\334v\344\214f\243\270z\217\225P\332\261#\272r\261\214CZ\277"
+	.ascii	"\nBh\353W8\f\215H\002L0\353C\320<\361\2213\327\331X\306a\326"
+	.ascii	"\250\ry\024Q\313\211\263"
+	.string	"\256eg\350\312\254o\335\001\263\340\300F\350\312\365\365\241aV\032?\343\274\t\272\262\236\333\262\316\365\277;\216\021\327\330\025\205\271\302\302\360\312}\237\031\347\2653w5\201\265\250q4&\025CC#\"R\220$Isq\005\004!\346\030\263\036\021 \251c\220\315h\222\222\244\003\213\315\344='p\362\223\261)\301\320\334"
+	.ascii	"\226H\232`\007U\206\033~\004\242\272\221\370\262\033j\263E&\321"
+	.ascii	"\252y\314\3466\303\322\265\204Z\274[\324\311\251\304\226b\322"
+	.ascii	"RC}\343|Q\331\322F\373-s\200\b\224\321)\215\313\242\362\300\274"
+	.ascii	"\236e\307l\005\373\201a`\307\f"
+	.string	"\025N\264\300\331\201@\245\001\b\013\256\r\230\224\220\b\232\247E(s\240\357\275\300Q\247\370\005\256\230\213\260\355\214d\326\226b\033\036.<[\370\251\320\3504\003}\214(X\033t\230D\375\314\330\204\373U\313\001\201\b\\\033\310tX\251\221\344\311\264\204\322\371\022\273\222$\305\020\017\\\322\207(I\217\262*\352P\202\370\376`F-\226\f#\021\273\022\036*\244M\247\022aB\252\227\311\030\236!\316}\313\271\307\222\037l\224\255\037k\377\234c]j\226\367\"\323\266$,\320\365\377\330\231\3458w\002f\211\002_~rB\221\273Boo3\336M\373\332\316]\2663\267\221C7\026\220\031g\001a\252\235\bE#\021\026H\231-\240\"\337 \243\201\273!\026V\335\357\360Z\234\004\226r:0\311\331\031\2768PA7\r\301m`\316\205\257\274\3763\\kG\355\343\303\220\304\212\275X\222\351Qd\204\004$\324"
+	.string	"\335KQ\307\023\327\270\020\002\364\310\247~G\252s!\313\363`CI>\004\264\225<\360\325\312_\021\346\035x\240\022\367]\t["
+	.string	"a"
+	.string	"\b\223?\306\376\221\304"
+	.string	"v\316\231%;\305\256"
+	.string	"F%\006\316?8Q@\243H\007.\020!B\024}>\377A\332\235g-i\260\352\020\237\006\320\334dO\036\206=\205\b\354\024\200\271L\343\340\202vG[4\001S\332\201\272A\034i\212P\023\013sf\217\253\211\201V\324\274T\377%\212\205\245(\252\321#><\204\034\356\240\346\213B\237"
+	.string	"\320\013\267y\261\205\214}g\330{/Y8\260\210\250\372\320\253\n\205\366\2119?\314\331\331gU\231\215\002\b\226\275\354\241\rv{_\342\340\315\276\331F\266\004\314\360t\313Oj\034B\037\210&F5\005\233Yh\241\272u\323\313\025\031\b(B\211\374s\341\232\307\340\350\252\036\265\375l\256\307\034\200\322\no\267\\"
+	.ascii	"8\3041\177\324\202\212\214\324\210\003\002\361\333\220\354\222"
+	.ascii	"\333}\215~Q\233\213m\020F\374\350,\310\216\200\202:\254\322J"
+	.ascii	"za\312\330\013\373\330\346y\2126\035\r\346\271\332\273\022h\027"
+	.ascii	"\277DC9}O\377\f][\357ul_3\251\353{q\201\235P\2238\345s\026\037"
+	.ascii	"|\032\342[\226\nc~\236w\\\\GP\311\365z\325L\017\2270H\274\003"
+	.ascii	"\246\210\276\365\370\027\262\373y\036\201> |\227<\305y7\016\313"
+	.ascii	"\366\337'\371\004\217\265\266\364\222s\205\361\245i\003\373\304"
+	.ascii	"\t\022Q\347^\317\251\242se-\016A2\331Rt\215|>\021\031\257\035"
+	.ascii	"p\214w\377y\205\327\226\337\206\270\027\3172V\027\f\367\277:"
+	.ascii	"\357\017"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_4S16.29.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`h\017\035F"
+	.string	"\032vh\031@P\246J:\377\323$\016\306\235Z\373a\327!\351\212\b\006\325\330ZCH\375\306q#&@\273\232\247\321\032\025\026\302\032M\225"
+	.ascii	"\240uTf\017Q\252X!\017"
+	.string	"]\332\3666\312ZB\b\331r'\031\207\001a\001\207\001\247\345\363Z\276\267\334m\331\266\345\247\210\322\262',\321\272\n\211\344h\325s\372ay\233\237\357g\376j~\275\247\211\232<L\025!\335\214\253\233\2241x\251\0370\376\032>\033\036\246\201\370\366\370\352l\250?\355\317<\357{<L\323\350\315\251\251?\3237G\3634lW\303\200j\333R\325\223\022f\320\272\256I\365'\362\246v\300\274\036\260\235\211C]\361\322=)b\006\255+3\353'\227PS!`\267\314\037s2l/\223\343M\353\352\304\r\234uenq\004\365'3\017\205\376T\177D\1772\2631\013:3\312\372\275Gpy\212\326u\355j(S|\177\231g\245f{\025\025\200)\251(\250\247\243S\223\221\251\270D\034*%\251)z\336\266l\374\275\027\240\363\346\307\220\266W\2119\325\375\342\241(\311\005\227b.\221\021\\\237\357\205\261"
+	.ascii	"\300$\261S_.\025\005u\305\212}::Q\231b\233,\226\033\243\234\t"
+	.ascii	"\313\213\027J\310\225\037\027\\2\271\013\006\305A\364\346\255"
+	.ascii	"\264,\227\330%)JP\343\262\nj\\b\271\304\346\261\306di\"\367\345"
+	.ascii	"\303K$\334Rw\301%\222\373E\327$<\233\333\270!;\254R*\366D\256"
+	.ascii	"\356IVjz\221\202\31398\213\246bM\344\350~\276\r\207\360\260\267"
+	.ascii	"8\304\355\"\265,\351l\237\315O)u\204\232\310\325\335\246b\353"
+	.ascii	"\272\262\3751D\356\034\340\314V\211\231o0/\321\t\235l{\b\256"
+	.ascii	"H\321/N\363\354;f:\r\024\355_I\023\250\236\006z6\332\177[\322"
+	.ascii	"g_@8HOrf\336$\3342w\325\320\333ki\376\270YF\314\217cCM\255\302"
+	.ascii	"\317\321\217\253\263m\326\335\177\343r\317v\320\267\355\277i"
+	.ascii	"\021\353\267\r\204\203\244C\f\212\276\336\221:~\205\2025\212"
+	.ascii	"\266\200o\216v\330HL\364\363\322tM\302,\315[\027\316\346\267"
+	.ascii	"K\223.\307\201^\357\025\354t\330F\354\204g\375\210\b\256\266"
+	.ascii	"\0213\263\315\366\035\363\231p\013\035\034n'\314\327\2622-\211"
+	.ascii	"v\206\342\204\t\022\327\362\b\021\327r\b\020/\363\233\241\226"
+	.ascii	"?\240\226=\\\313\035P\313\033P\313\032\336\346\\F\226a\f\303"
+	.ascii	"\371\316ba`\027\256e\013\250\345\n\3272\205ky\302\265,\341Z\216"
+	.ascii	"\200Z\206\220Z~\220Zvp-\177]\313^\267\334\240-3h\313]\3272\327"
+	.ascii	"\265\274u-k\335rV[^\320\226\261P\313W\327\262\2023\317\t\256"
+	.ascii	"\346\214\340z\347\003\327\262\001\324r\201\324\262Uj\031y-\023"
+	.ascii	"\270\226\007\334\262\200\266\034\240-W]\313T\267\f\240-O\265"
+	.ascii	"e\251k9\n\265\f\225Z~J-\037\257e\247[nj\313\306\266\314\204Z"
+	.ascii	".^\313K\267Ll\313\303\266\254t-\253\247\345\364\264\214\006\307"
+	.ascii	"\241\355p\377\354\334\272\215\001Q\252\356\300\201j\252\315\032"
+	.ascii	"\200TOI\365-\024\343\004F\317\211\177^\232\372\356\3571\307w"
+	.ascii	"\307\210\343\210\027\005\325Qm\373<4YC=\035\202+\362\324\036"
+	.ascii	"\232-\323c\240\307~\352\303\3159\365\261\321\300\022N\3066\353"
+	.ascii	"&\24662\365\371\210\211\325 \336\222I\013\207\335\323\037\022"
+	.ascii	"\021}\346\221\367Wh\261Et\347\2759Z\352b\337\301\024K\3036k\342"
+	.ascii	"\337\\\251\207e\255\3247"
+	.string	"\357\217NM\337\2371\305\276\343\254\217\365\233\244\371S\3743\202\347G9=m\366Qs\211\017\277N\341\036>\035;y\370sX\220\272\256ml\177\254>\370\360V\273\025+\220\277D\215\262.W\346\212\365SC\277yk\307\303B\342>\0164\25454[\270\271\0356\322\201\3705\022\314B\274J`}\240\343\270Ms\221\340\332W\301\316/Q\326\227\241\241U\233\231\205\013\373\037\214t\3536>\320j\377{W\362#4\354;N\001%\245\365\331\\]D\344\212\335\272X\307\361M\272\320\337\273z\210H\020\373\276\203q\006@n\226\321\021?0k\033\361\375\256\353\272*\365\035\337\210\236z\3267\362$E\353\033y;\223}0D\0045\212\276\320q\314i}\276#\271.\326ig\"\327\345\002\213\351\260\215\254\226\244\263>\243\243\242Y4\300/\272&a\332w\374H\247\201\246_\323\276\203oKv\374\241\311_"
+	.ascii	"\212\"6\276\2466#\251l\241\224\241\332P\246\275\320\240l\201"
+	.ascii	"\206\266\342\305pM\231\"\005\r4\224\277\222\020\032<"
+	.string	"\370\362\362\342\022 CI\243\305Y\r\224\223\\*^\254HSK\276P\236\260\241\206\306\"y\326\002\255\353\305\2123\027]\3115\031]\\W\254\006C\271\3265CMm\255k\310\\\337N8\304\026=:zG\225\205\004m\341@\346<\335)TH5E\326\t\246\306\032A\3071\202F\233\243\004@\337qZG\312\204\272\350\210\233a\326\313\2442\034)3|\337\311\2440\f\036\2712\314\372X\326\024\251\023\315wx\240\303\312\232\213\302\372zcd}fY\277\315\024\235^QD+yr\004\321|\215d{\262\004\211\"A\326\031:\356\315\237ts\212Z\347{\034K:\204$\2101\353\0345\326|\211c\215\341DX\237\350\023\360\r\222\211~\233#\265^\326&\272\013\337\2260\361[\204\241\257&C\213\335\371\355#)\022\025\232\004\205\256\220\204B\337\274\250e\210\t\035\242\360\022zB\237}\022\372\026:\212"
+	.string	"\241#|h\262\206\360\240?8\350\007_\355\240\323@\242W\177%\361b\320f\335\240\253\031t)\212Rr\265\222\253oa\241\021\200\276\325#T\255\336\352\263\217-\212\326\2026\353,\254^\200E\b*P\360\304?;O >\370\253\006\241\240\257\024\364\315\213\253\223c\240@\033\330\320d]\300\2527\334\317\221m\325\207\233#\320\310N\0074\201F\007\337 \221\r\b\320f-\240\252\003T5\232w\204\023\201G\250QD%\225S2\"\"R\220$Is\201\005\004\031\007\025\232\007\021 \255cL\025I\013J\222\016>s\002}?\251e\223\201\211\336\003"
+	.string	"\276,\314TPL(\362\0164[jP\322\205\324%\236\331\347\235\376\034f\b\002\216~UK\016\237\254\037~H\377\225fm\215>J\013\367\304\023\316\026d\312\337U\264v\324\2153hT\3768U\r\377\263%{\250"
+	.string	"\022\231\017\301F\332?0qj\235\251\305\214,e+#&K\"#\262\307\"\222\230\364\216\002\250O\215\f\024F\260\035\303B\314Wz\342{\032Gz\230\3341\025\213x\325$\232y\204(D.J6,\b\216\363}\254\363\341bA\322\212\n\177%\035\007k\\i\304\236\036U\210\306\310\337\\OO\373\357\021\020\204\207*\033k\006\311\205|\200\260\206\005\313\300\256\200\017\332\255\320\370(\330\231\304G\223\243\366\236S,\023\216\007\201\277\"\004Q\261\212o!\030\216\343\365\3701\310\n\202\270&t5\032.\223$d\235\303\0035\323\ry\022\245 \366\336\022\032\277\bW#\307\221C/\\\225\220X\317\365\306\177\372\037\0054\326\0236\215:\352\300\301\177N\034\t(\214\005:Q\205\340\207\245%&\263\203R%QZZi\026P8\2242\205\t\034\017L>j?"
+	.ascii	"\342"
+	.string	"\351\311\320\250g\314 \273\f\035\242\316\210\347\"\276C\255\256\241"
+	.string	"\213\350\313V\363o\032kJ\210\337b\271rA\336\207cCwt\305\306\263\204\201\345\375\322`\3145m3Y[\336y\325\246\240O\f\242\237e\2165\325\276\003\335\264\303Z(M\t\205\302\270\346\232D\025qY\303Pv:\354\332_\333\316O\0338lV\355C\363q\272`\270\274t\377\"\243e\225\275J\361\363\027\237\225\346\214x\372\205\373d%\026\254bR\020zfc\005h?\030\370\362<\n68\250s\263H\352"
+	.ascii	"\226\314\334M\3614\3400Z9\002\245\361!\365\036;{\324\347O\360"
+	.ascii	"\035\255\342\332\233T\232\206c\366o\250f;\fE\233\013\346\006"
+	.ascii	"z\347=\330\342\212\017\t\305\222\314\333\204$\350\201\006\261"
+	.ascii	"\215L4QAb&\201\241S\013\256\354\251\371\005\311\275g\330\002"
+	.ascii	"\bF\030\260\007\201P\324-R\346\323\223\321\344\321\177"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.30.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\276\001M\021"
+	.string	"V\340uH\340\362$\035\2401\200\002\206\263\3335\"\362\312\212.C\26168@\020\324\021\207\251#\303\352E\273\207=Q7d\024\311\217:\344\355\361\366\246Z\2720\303\034-t0Psd!\003\\K\266H8n\221\264\275\367\336)\005^"
+	.string	"_"
+	.string	"b"
+	.string	"\002\352\351\366"
+	.string	"\365\324\237\255\343\341\317>\311D\016mjw9\351\363}\362{\245S\306\317?\355 :\240\354u\3439e\201<\2373\005gJ\304\b\2103E\250rl\334D9\013\214p\002q\244G\016\340\206y \252D\216\323\036w@\233\030W\016v\327Q\007\374p\257n\033\306vg\277\026F!\265\007\322\221\2316\231\207-)I\206\324\356\306\266\323\373F_Huj\331\247\031E\345{\221\206mU\254\216\200\200\244v\303\222S\267\270.\265b<\221\037\336\305\367!3\031d\227\004\216\245\3355\261\204\355\224d\326\242\326\343\205|\026o\361=\210\346"
+	.string	"v{\224\226vC\0233\330N\035>Rf\037\206\207a;\341\323\324\323\313\357\204\250\211U\036\251\355\030\231\241X1\023|J\217\350\206H\355\311H\351\307G\312Y\311\247\\!\242q\023\251<`F\2545\325\330\350\303\016eQ\316\354\233G\023\317\223e\217\375\240\277~\350\2371\372\033\201\240\250\bM\273\035\252~,\024\215\221\302\366\353T\353/\036.\367`,.\030\205*\023\233\351\036\260\234\362Z\240@%\005\005\345\304@\fl\346\305u\241\372u\322\022sa\351^1\330\204\f\335J\205\227\353e\205\213\271\270`\270\227\027\303\235 pg\001\346q2]\347q!\341^\366\030\202\020T\215\264\251rf\233\025\247\254\322\206\351\250\2245\370\241\222\242\253xi\307\314\304\353\230\344&\037"
+	.ascii	"H\t\336\317\304\300Rof\300;Cv\f\305\354\355\nj\203\210\246\243"
+	.ascii	"!-\342\n\301\250\362@\356\243\354p\272\006\305j\177E\370t\031"
+	.ascii	"\310\022\0235\\TH\345\224\235Y\346&\005{\320n\241\222\"\334\221"
+	.ascii	"\235&\017\214YW-\\cs\017"
+	.text
+	.section	.gnu.lto_blackboxWriteU32.31.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`+\001E\f"
+	.string	"v\326P@\020Q\225\016\340\023\364Z\304\007eJ\016\2574Zk"
+	.string	"\200\224O\314"
+	.string	"\"\222\300f\255mX'\336C\201\321\366\337L\235N"
+	.string	""
+	.string	"H&\177\001MP:\265[\345m\324\275\304\346[\033\367&R\246\024;"
+	.string	"8"
+	.string	"@"
+	.string	"\223\335\026\354\304\356j\\@r\2309H<\334\376\021\017\375\3312\036\363\260/\021CE\242\306\356r\332\341\337\363\363\017\373d\305:=9\016\354\256s\305\312p\353m\217\330N`\277\025\034\354o\273\273V\227\235\351K\246-\231\256\374\365\307LCMo\232\326Lg\246\337\201\231\361B\201\213]\f\265\033;\203(@\330>\305\216\037\f<\355\207\270\210\357/\223\003QU7\023*\032\252\305e\304S/\036\311\302\022\340j\221\334\262\030\365\252\262\0134\314\212\230\025\265K\024\362+\037\366\334`AO~\355\246\030\265\242N\225\206T\326\234)T\300\330\264a\307N\251\001\356t\004\004\f\350p8\033\021PI\344\231"
+	.string	"\335m\032\214B\f\274n\004ZP\301\3738\350<\242\0177\ny\036p\035)\002\267\001`\017\002\210\304I\360<\022G\211\355\325e\0044f(M9&\314l\nU\023\242\272\351\003\033"
+	.string	"}\246"
+	.ascii	"\226\"2\241\r\320qx\230=+!0A\177\206\341\030\336\202G\202  \273"
+	.ascii	"_%\005\205\201!`\037\310\030p\021B\002\032;\004\270>T\201#\252"
+	.ascii	"\013\211\3138\326j4\270\313\213v\222\001"
+	.text
+	.section	.gnu.lto_blackboxWriteFloat.32.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"%\t"
+	.string	"\026RA70\261\206\003\033"
+	.string	"\215\216\244\017~\321*b\337\264\030\254\276O\016\200\316\037\333\357\023,u\277qH\261\332\377\203k(0\222\265\275g<\234\206\035\310\231\331\275\267\224)\005."
+	.string	"0"
+	.string	"/"
+	.string	"\002\336;\356\001\336;\213\266\314g#{\224\232\353dfw?\025\271\370\024\375\313\316\031_\254\347\206aw\235\343\313\343\326\333.\260\355`\333%0\373\261\237\323tf\372\233\001\333\313(f\267\343f[Z\267Bb\373\035\333\373Xx\332/\271\211\370\230S\314\331m\221\251\354\356\307\n"
+	.string	"\357<\0174\264\226n\230\223\251vX\221\037\355\271\246~\\5\255\274\331KN\355UF~\274>\200p(\313\311R\203\331\254\3313Vj\210}nw\327\032\026\201\t\007\b\242P\bD`Z\241H\030\235APD\352\004\021\202)\323H#,I\200$T\351K\235H\023\037\250\262\370@\006\016)L\252\357\"\fU_g\266\347Van\b\n"
+	.string	"}\246"
+	.ascii	"\226\"2\361\274/Z\\\334\004\025t\270\214\375\255F\203\273\274"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_blackboxCompressFrame.33.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`4\006U&"
+	.string	"zE\024\017Fp\236Q:\317A\330>\315\352\204L\213\355\266\b\270\255\272\242L\271\331\023\331#\202\245\0161\313\027\213\335!\207WzhH\361\022\321\204BE\231\332^Y\301\027\034\235'\313\340_`\375R\177\265O\032!D\356$\003\336"
+	.string	"\314"
+	.string	"\334"
+	.ascii	"kz\246\253\3102\216\027\246_T\200\033\345d\211\326\245\316\202"
+	.ascii	"\314]\230\326\247\252\325\353\016\223\263{\257\203\247|\\\237"
+	.ascii	"2\247\314`[\346\t\025\234\336\314\301}\257\025 \026\353\323\224"
+	.ascii	"H\360\226\371Y\256\305\351[\232\330v/\226S\354\336&\004\276\260"
+	.ascii	">\375\235\247>E\277S\237\262\0233\2367\231\367N\035I\256?\367"
+	.ascii	"^`'a{\2176\317\253u\272m\255\251)\332\326\211\377t\033Z\223\332"
+	.ascii	"\361\344o\252\204\240\030\320\316\306.vK\265L\3325\001\022\036"
+	.ascii	"A^\273\330S'X\362`\361\br\025]\220L{\242[N\241\276?Oc\351\217"
+	.ascii	"\243\272e\024\372\273\367\342\226R\266\321\006Vf>tK(\224\347"
+	.ascii	"\306\210\235;\237 J\225\020kk\034\356\275l\225K\036\347\333\231"
+	.ascii	"9\0133OaN\255\004m\345LiA\331'3\017O\246i\275\367Z\340\217}\f"
+	.ascii	"\221\337\344)\277@\262W\"\251O\337\347R\262\005i\237\354\213"
+	.ascii	"r\347QX\275\2716\020s\363\311v\026\363"
+	.string	"\337\303\311\225:\334G\230\211\336\374}\357r\356\255\226\007\274\353\314\373\327y\350`\347\335\267\374\002\332\262\356a\347\\[\026\272Y\306\265\345\233\315\262\255-\257m\271\266ZVW\313\351j\031]-\267\315\262]-\037\201O\220\033\030~\356\335\361\024t\333\244cP\036\366w\371\273\376\257\037\3545\2532?\025\024\344\213\341\2131.\035\024\306dN,gR\326\247\377\326\271\356\3650w2.m\202-\t\321J\002\026\374\227\203q\372W\215\337\251*\033\225\016\253\263{\233E\232\001\235\305\026}\360\246B\366\244\355\231L\3255\0253\251\275>\3322C\323\353\037W\004,\257\207z\355\213y\034\243\f\314{\221W\362\337\034\216\n\032FFj\t\023\366\312^\377\222\375\304E\257\365\332\250\256y]k\037\231\031]\337\3137\240ig\331\bbF\314\320>\302\3173\251\274\356*[k\312\310x\375.\265y\375A\3114"
+	.string	"\317\347\363\371&5m\265\013p\r\350\356\264\357<\0012\001\375\036\320l\247\264\240\270\f\365\277~\342\ny5'\0200\225\314l\343f9.\314\271\367bH\3614**0\237\226\r\265\225\243\004\3627\251\273F\273'g\312\nJ\013\273\271\362\262\322\235\305\273\356>\332R\023e\321\330v\367\223i\310\0257#,c\033\002\035[Fe\327\007\373\017\331\002z\027H?\022\227\\\270\030\201\253\t\2132p\b\225rK\304#\216\240\f\034\214\343\213$b\210"
+	.string	"D%\034$<\264 .-\021\215J3\212\303\035S\030Z\220P\201\302\204\tE\007\216F\341\321\2108Chtq\343a\321\213$\244\026\305a\022q\305\215\342Q\214\241P\306\0210\tI8\00384.\001\213\030pQ\211h\004\036\213E#\020\327\274\357#\314\034\220\re\353,\306}\325\210\272\353\250\016\236k\252^\347\272\203Y\224Ec\203\225k\016H\033\350\350\275\367\256D\375\260\377\036<\327D\375\242!~\204p-\324w\2668\236\034\353\035\\+\2403&T\006\250\333\313\214\324\262\346\340\017\273\206+\261\243T\260\372\034\260j3\177"
+	.ascii	"\301\307go\315,b\204\275\222\177Q\375\304\276\276\355\2615\035"
+	.ascii	"\241\001\346\234+\365\354\332\326(W2\r\231\007\003\023\355L\r"
+	.ascii	"y\250A,\251\224R\006\215\210\310\004##\006\315\030\200\002\231"
+	.ascii	"!;\036\021`M\247\310\266Z3\363]a\237\265\255\365\250\317\025"
+	.ascii	"vqgPM \212t\27460z3ii`\224\326\303d\220x\212\315\317\255\022"
+	.ascii	"u\005\034\275\233\354\273\307 !\320\025\365\020{\005\210W\225"
+	.ascii	">\263\341G\276B\273\302\257\004\326bg\313\201m\330\304\332U?"
+	.ascii	".E\0332\341\200\247Adpr\362\371RV\353\346\247\3554\313\025\200"
+	.ascii	"\347\277\356\255\236x\237\272fr\r\034\322\306\361'\230\354s\t"
+	.ascii	"\303\216\371\235\354\223\233\321\005\251\033L\2455\240\321\346"
+	.ascii	"\214\232\263\272a\352\315j\0036\234\247\345\215G\247`\2170\202"
+	.ascii	"\220\210\201\337z6\373+|L\207#)\351`\024=\327\253: \020\245\037"
+	.ascii	"\357\\;Q\214\241\254\205\273\200j\364&\016\020\211D\223\346\330"
+	.ascii	"\344E\334\350\305\321\016E<\220S7\373Fu\234\027\202\215\256|"
+	.ascii	"\364\274\247\006"
+	.text
+	.section	.gnu.lto_blackboxWriteTag8_8SVB.part.0.47.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\351\005=#"
+	.string	"\306\277\331I\240\326Q:$&\337;M1\326\016\323\320\361\311\243V0\206\n\356\350\365\013\\\033\330P(G\313\034E\333\232\177\254\370\312=\234\3308Vg\207\327\341u\300\247u\370\220\225S\312\351\2049Y4\254o\377\227|B\210\334)\005\304"
+	.string	"\275"
+	.string	"\276"
+	.string	"\224~\350\367\270\017\337\177\024}\246V+/#\265\016\025\274\364\203\363\245\207\327\231/\317\327\230/\355\363\260m\004\364\331W>\204Q\337\025\203I\213K\255\225\367r_\230\236\035\217\307\343\311\341m[\337o\266\032\355\234\231%\271\024\347\363\271n\240\311\261)x\364\333\243"
+	.ascii	"W\204\275@\026\020\005\265\271\200R\361Z\201*\250\251\323H\004"
+	.ascii	"d`Z\036\0058E\352\236\256\232\236\005LA\317\260\337$\301\252"
+	.ascii	"\202R\361\0319Sz\272\312\005\231H\bed\305\177\235:\005\223\250"
+	.ascii	"Y\303\222zI\233\202&N\346\202J\344\256\326j\013\376\350\376\353"
+	.ascii	"\344\216%[\232\202R\2474\307\315\"\324Z}$\026w\356\366el\367"
+	.ascii	"\354\322B\216Y\352\034\356v\"u\215R\323>\374\317\222zVR\233%"
+	.ascii	"y\342\275\367\272\351\265\376\017\320=\370R\353\323\361K\245"
+	.ascii	"*\2134N\374\275\376\342\327\276_\f\003\343\242\363\"X\027\260"
+	.ascii	"\335O\246\376d$\251Qk\365z\227\377e\233\215\274\373\231Tt\356"
+	.ascii	"u\242_\304\212\216\375\"D\214\344<\002\236]]>\310j\255A\347K"
+	.ascii	"\352\023\215|.\333l\364-\"\357\216\206\365\tx\242\317\366\322"
+	.ascii	"d\242c\177\210s\032\370\276Et\326\032\263-\0312\310j\035\336"
+	.ascii	"\274\264\206\323F\344\260\006\201\246\021\235\245\327\362\201"
+	.ascii	"<\210\357B\214\304\264Z\253\306\214\324Z)\234/w\244\321\177\024"
+	.ascii	"\t\030V(\240)D'G\276\336\271\222\002\263\224zq\271\367\"k\255"
+	.ascii	"\325\\\241\217E\307\025i\333C\311\021f\311\325\255\223}+\367"
+	.ascii	"\266?\01610\272\215\200T\332\b\230\344\332v\2470E\0010\232\270"
+	.ascii	"\224*@"
+	.string	"\206\220+\364\207\314\332>+\310\330\217\226\331O\0024\344\317\360\213\314\227\265\275\323\324l\317\245\355\227n\220\367\022\323\334\331~)\253\\s\267\tS\030$c\trO\374\017\230\273\344\256\326\322\027\033\261\343~\267\214J\301]\241m\272\303\371\227.\315\262\324\"\211\036\215\244\252\202\361\211\314\023/\201\n\211zqNlK\224J\275\320\025zq\020`\224\221y\255l\235\315R\327Pj\232\222z\246\244\226y\361\001?\027\362\311\300\343\263\301\004\021\024\242\267S3\203\036\007\013\0320\310\311\301!0\344\023\002\210G\204\351\036\034\rA?\031z=A>\027F\3640p\350\341\001\302\300\013\372\341\351\300\353\021\032\342\341\034p\317\203\217\020\017D\257'\304\263}\255N\343\217'H\233t[\241mc5\233-\307f7\217\361\3568\371\321\262c\314\276h\263\331\027\277K\360\230\265\331/\265\340\235\300\252\371Fk\326\376\341"
+	.string	"\300\210C\212\206\226(\332\n\225\274fB\315\314\236Ks\261\313\354L\314\312<\312h\343$\315]\334M\005\252\260"
+	.string	"5h4\267v\357\003}\223w\277=2ns{\2460H\\?\t#\213\331\n\215\333Q\336\366_\247\351\310q\205\322-\327\311d\251\333s\235\206\225\303\007}{\250a8\344\220BD\312\310\310H\032mu\200\002\231\262\252\016\021\220\275ST\332B\215\2155H\310\363\366\007|\250Y\006\257M\002G\205\033i\266>\275f4j\320\257\r\367"
+	.string	"\246\"\035\220\325y\"2-\213\203\222=\035\216\312I\303\200\315\200\263\275\023\360|\275K\235\246\301\371\033\224\345\307\007LA\207\227L(d\200\357\312i\206\325\356\016-\306\317u7y\232\220_4t\317\326\355\367\217-\311\256\347L\233\t|\n\254!0%\3231\322\3501[\211\276\304\005\347h\263\366\020\002\313V\370\030\302\307\001\277\177#O4\355\247\220]\217\\V\330\270\276\343EGGm\205\305\276O\266y\177@\220\205\222T#\006\201\346\322\242\224\277\202.\343%\017\300\265\257\337\021yz\237\314\203\2759\367fn\327"
+	.ascii	"$\372\253$\250\305\317\257\\\325\t\325\024w\003\247MGt\264\342"
+	.ascii	"\325\220p\bRS\230\207\375"
+	.text
+	.section	.gnu.lto_.symbol_nodes.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\377\003\355\021"
+	.string	"FZdH"
+	.string	"\257(\035\210m\252\335\277\216G\365\324\202\260U\2226\341\3617e\005\236j\260o\007!\316\340\263\376\344\035\373\241!\220\263\b\205\025\372\377\377\\\325\216C\030\222(\212B\333G\201\377\345[\213\177e\007\210,\267%\211H\031T"
+	.string	"O"
+	.string	"O"
+	.string	"\"[\3630C#\351\3256\343\t\02068\030\351\220\231\253AZ\255bu\252\025\316\031#\023i\227m\266j\324l"
+	.string	"\206\031/B\032\004I\371\250\372\264M\221B\252M\033\rG\324$\002(\223\317\356\312pNQ\266\333\273%D\346\3020\f\301\376\330v\227\243\021\227\314\303\235\351k\271w9\245_\302L\277\201\323\317t\2673\214\267\207\026\202\206\264wi\226"
+	.string	"\275\322\322*,\215\262\322#"
+	.string	"\272D\245I8\024\303]V\215\224>\341\3572\203\021\245\226\017K\250\221\255@i\327I\267L\232\2652vdN\224t\037\306X\275\241\035&\237l\036d\330\216\263\206\232"
+	.ascii	"\301\201\tS\013\214\254\312+\025 n\266\343\2222\307e\365.i\267"
+	.ascii	"\361\017\n:8\231elb\304t\240\277d\367\027Tw\257\256<W\276\316"
+	.ascii	"N\203\b+\377M\216\234\022w\017f\342.O\\\013\322\321IU\216N\232"
+	.ascii	"\243\177<\274(htpT#\017\321_R\242{S\362\370Z\217K\n\372.'\177"
+	.ascii	"\025jb\335w\216Q.\231\200\321\342\002e\013\275@\201\200\031\022"
+	.ascii	"\265\r\035f\262+\005\007qC\007\353\206\316.*\213\3313\326\352"
+	.ascii	"HE\314Z\250A,\316J(2J\322B\232\003\360\002\261!j\003\021P\024"
+	.ascii	"\315IP\202\251 e\024t\363r\024[rU@\335;_c{5\344\335\377\355\344"
+	.ascii	"JV\262\b#\255o}\221\376\203\311)h\031\300\311`\363R*QJZ\027\366"
+	.ascii	"S\254\350\327\300B\030r_\352\026\036Q\022O\234\233\350\234\034"
+	.ascii	"{_\201\336{=^WW\304c\330\022u\332z*k\235\025]\244\215 w\220\275"
+	.ascii	"\241\337\371\217\374\332\247S\3452\016\242\027\214\024\364\302"
+	.ascii	"\t3\026\314\b\325\017\221\222\233\330\031\020\350WR-\260\031"
+	.ascii	"_j\330\274\333\211\344\033\tP\025"
+	.text
+	.section	.gnu.lto_.refs.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375 E\255\001"
+	.string	"\002\004\013\020\200k:3\303\205?\245l\243\216hm\313\224\002\212$=\336\"\315\341\325\"@\303,a\024m\245<[\255\360\2367X\267\0265\t\001"
+	.ascii	"O\202*\003"
+	.text
+	.section	.gnu.lto_.decls.73cc96284c52cbd4,"e",@progbits
+	.string	"(\265/\375`\016\032eu"
+	.ascii	"*\275\330)P0R\312I\007\353bv^\"\253~\356\356\3372\376f\376\277"
+	.ascii	"\256E\344\303\305\345[e}\274\na\307\2472K\327\2645\355\343\373"
+	.ascii	"\353TC\342dm\232\b 3\363\273\216G\025\221\021P\031s\352:Q=\001"
+	.ascii	"\220\225UW\335\377?&\223A\210\224)\032\002\211\002\245\002g&"
+	.ascii	"|\307OX.\007j\347&\221Rc("
+	.string	"\370\216\203`\272T\311\222eSS\002\336\333\236\321~\241;V\302oi;v\357W\034\003iX\246\004\241\367\336)L\205\361\230\215\357x\210s\035\333]m\037x\340\001\237U\253\311\327\223UwZ%'Y\236c!\230\r\210\245\234\2430\223\323$\333\373\244\341\363\302C[\253\277\201=\003\255:\321h4\312@\353\213\254\312=+Ca8f\373\341\270s\023vr\031\250\366\266\355c\214\233Z\253'\262\347\2375\215F\371g\275\013\354\016\367\254\013\360\333\317I\270e\267\027\356M\336{\tP\267\020\001\"\325*?y\t\263\215\340\266\237\220\340\3511\355\236\335\333\352\340\024\002QH\330\352O`o\210\316k'@\357J\360\031\366Q\036\261r\232\320Y\255g]6\333\253s35\025$\260U\2166\273sY\200\265/\367\254&X\200\365g$?\233\361\331O\252\244\341\274m\367\266<l2\n\223\263V\337\262"
+	.ascii	"+\313=\253\003\307\371"
+	.string	"\233\005\r8~~\372\024\004\370\306\317MmO\340o\233\n\370\305\326k\376>f\371\314\3371~\376i\266\001\221\320\366\233\277\237\262\260\215\237\261n\363\267\f>J>]H0U@\341\347\021\313\237\225\256N\363\267\006?m\001\023\255Z\350g\021\252~^\341\177!\215\237\207?SM\261\324\317\312\237u\370\031\207\367\374\375\363\363\r\337\360\037\201%\366\3471\377\357\376\273\375\274\302\206\377x1\3767\220\363\367\001?\327\360s\361g\030~>\372\271\305\317,\374<\302\317\031\374,\363\363\005?W\3603\320\317*~&\3729\305\317&~\206\340g\007~f\340\347\004~6\340g\237\237{~\326\371\031\347\177\334\3174?\317\374\017\341\277\224\377\321\377\205\377\277\374_\372\337\366\237\313\377\022\376\013\376\317\362\237\210\377\200\377\273\374\367\373\317\342\377\336\377\274\377T\376\237\3757\361\337\356?O4\032\215\376\352\375U\r~"
+	.string	"&\b6Un\317\036\260\336Ys\353\225\235\037\022(\316\231\030\026\274&\233\262\021\275\257\316l}\325S\274\344{\241\250Y\001\336\333\204"
+	.ascii	"\347\314o)\243\325\247I\366\346RQu\0257oj\245\007U\216\262\246"
+	.ascii	"\361\256\2221\223k\265\006\331\226\362Q\337\274|A\363X\0312\242"
+	.ascii	"\367\261\243z\006\277\361\305Z~Pu\005x\227K\b\336s\254\f\263"
+	.ascii	"\241\032\252e\260\223\252&\220\016\230\216\037\372:\371\226A"
+	.ascii	"C\205\343I\\\253\215d\272t\316\214\007:7\231\257A-P\222\260o"
+	.ascii	"!\354\337\267\220\371\374\203k\325\246\n\021\203\3410gB6&\344"
+	.ascii	"B\266\275W*\336\260\204@os\t\304\205\347rs\021\300\211\246q\351"
+	.ascii	"\322*\213\371\226\232\277\0367\314Z\275 \0176\227;!\276Z}#\331"
+	.ascii	"\277\377\365B-\357\275X2\355\205C\336\234ep8US\005\372\356\355"
+	.ascii	"!,p\255\363\322\n\374\002\367\202{GP&\275\226<\312'\324\221\207"
+	.ascii	"\252\365b*\237^L\236\333\246i\335"
+	.string	"\247\216{\225I\347\261\241n{\231;7\351\305d/\024\240\262\275K\236\333B-\371z-\225mPG\036\345\323\353\250|:\231<\312\326\213y\223\367\310&\323\356M:\231<e\255\327U>\241\230;\312\247\363\310\025\006f\327\263\227\374RE\231\274V\006\224%\235\313<e\353d\270{\217mQw\311\355\275^\367\346p\222\200K\0029\302!\363\254f\232\311\366\310[U\310/'M\213\274yJ2gR\324\275}\267*\305\221\217\355\275w\306E\036\371\336\250vy/\322\371B\323\311Wf,/\316MB\321@~9o\242\220\316\031\227\254\213\231\312\347\227S(n\3559v\221\355\221\307n\237\327\222}\036\333\253\364\202\363\345\311\036\024\372\305l\007\037~\264g4q\204Dj\264\312\201,x\036d/\203)\234\367B\361\240\216\230{\241t\230I0\223P\217|\211\275\255\352y\210\"\336T#yM\326\210"
+	.string	"\302\001\303\207,\003\354\242\356\b\362\304\254U\326\302[\230\255"
+	.string	"\346RD\030\222\031\307\346p/\027\260r4\312\005\374\371\265\230\225\230`\253\214\205\373\230\355s\234\205\207\224#\0177\266\206\231\317\361\355\311\bB\007\221\3501\033\357\375l\205\257\034\357\306Y\363$\313\206\217V\331\207{V!\241\263\036'!T\"\245\312\b\235\326F\225\216V\177\316\343\273\265J[\031Z\253\001Z\232\313\323\344\345\0022\226\026'%d\313\233\013G\035i+\234\221cU\256\276\276\366[\227"
+	.ascii	"\022\322AU`a\342%\313\333\217\351l\262\316~\214\231\001cU\262"
+	.ascii	"+W\232\317\307\231\356\345}\021SFC\220\275 {o\276\271/d\201="
+	.ascii	"\030\252c\204\220\212\017\020\357\235\207\327z2h\251\2155\274"
+	.ascii	"\272*o\275\034\277\"\216\310V\305\320tPi\265\251\254SXU\216H"
+	.ascii	"\356\227\353;N\273W\001 \311\033\304\202\256Z\220RcB\274\357"
+	.ascii	"\336vl\313*\315!\272.*\210Y\327\021\266\2454\035\033\225E\254"
+	.ascii	"l%\373\241\211\262\265%:F\370\003H\253=\367-I\264$A\364\215\202"
+	.ascii	"7U\245\325\216\302P6\311\305\207\266\362`\227\274\335\2264\234"
+	.ascii	"\f\222{\221&Zd\337U6\201f\006\003\301\366\032\312\033\316FYd"
+	.ascii	"\315H?Y\022g7\370\244\235\334T\221Qh\325\352\235\364[7i\257\217"
+	.ascii	"\r\340U\224\311\344\247\261\201\323\0018\244\311~\235b\233\355"
+	.ascii	"\335&\307\265\303\253\325\257Pk?\315\314\033\037\216\2611\354"
+	.ascii	"e\264\260\352[\247=\255\325|\234\251\225\255\333\004\232\351"
+	.ascii	"\"\003lK\253\255\246G\006$\n\273J\241\241uK\330\202H\020\200"
+	.ascii	"I\336m\237=\257T\035\n\023y\002\304[\313\256]gg\355\365\3477"
+	.ascii	"V3\330j\355 \306\316\3108\362#]\306\367b\031\203%\244L\360\007"
+	.ascii	"\033\230&\313&\213\024\351\262=)\033\302\260V\212\221w\231\372"
+	.ascii	"7EP\356\017\007m\f\213\020\255^\346\310\322\370\020\"\244\311"
+	.ascii	"\240c9\203L,8\206\274\311t\272\300\201i\341.9c\201?\216\200,"
+	.ascii	"M\332\017?\364X\2261\0339\347\220)\261\367\030\313\206\007\035"
+	.ascii	"\322j\003a@U\212]\334\215\302\322\b\022\371\270\217k\245N\346"
+	.ascii	"\b\306H\020e\354u4\017\035\035\266\336\313\255\363j\271\002\261"
+	.ascii	"\243y\354\3500\276\313?\036XB\312\224k`c\300\336a7v\310\346\261"
+	.ascii	"\325\366\201\377h\006\205\004\026~N\255\021g6\245\325\253]\354"
+	.ascii	"U$[\363\325\316v\266\327\316EZi2\206\263\265f\304\207\256\267"
+	.ascii	"\027\277\335\346\017\277,d]3\266\2605Gr\344h.\366^1\0163\365"
+	.ascii	"\327\203\2077\227j%\t_\037\335\212w%&\314\034\233\236\021\275"
+	.ascii	"o\260\365\r\366S\323.\263\006YE\225\003J\201\022\261\277\226"
+	.ascii	"\255\211\253Q\243\233\354m\325\2247=\006\375\252\264\336M.\254"
+	.ascii	"\236Y \017\255\266\215\233/7'K0\326F\212\311\354,\276J?*\001"
+	.ascii	"-\b\255 \344\202\314\fG:3\306\242R\372\244\240\244\237\342\360"
+	.ascii	"\305\321\321S\007E\017\230J0:\r\215z"
+	.string	"\2364\202\250\001\322\320\006$%\033n\236\32444:\001\360\244 \030%\212L/^0\031\035\340\344D42\032\256-\b\255\200\302\005\031\343\360E\023\323Q\021\214#c\315\002J-\206E38\305p\332A\032\032\213\214NJKE8405%\031\231\2123GC\342\222\352\242H,\032\316PTT2.)=\265(*\332\331\3008dZ\332"
+	.string	"\200\023(L\330\031\022b\221b\200\023(X\240(:1$\2643$\204@\214aS\023\006\006\f`\"\310\3304\204\021\264\342\004\026DEDH\303\022F\260Xq\202\013b\021I\311\251h\002\001F\"\222\213\247\025\001\020\213J 4\021]\f\211\035\370\034\031\213JM#\344\364\340\030k\210/\206M\033d`\"\310\005\321\311\211\330\004\343\005\223\321\315\201\214\214O0\212dn\244\324D,\022\221\330\247\030\212`\210\250\206\231\023\2510\241\302\304z\"\025BB*\206\204\330\017\t\245M\303$#u\346IALJ\f\234\t\006\261\251\204\221\211\251\251\204\215SQ\023\361\350\350i\005\321\250\324\204\202"
+	.string	"\306\242\023(\234\210\306\030+\\\020\223\234\236\226\216n\214ECBl\222\021\251H\\Z\215ED\306\242\322\323\314Q\030\r\tI\200\342\304\211\240\021\237`\202\f\0260!\004\016X\243 \244\242\222\013&\243\"\261\250\006\246\0261\030\r\227Z\224(*\r_\2240jr*\021\36434\016]\2509\240dlz\320V\003h\032\261\272\321\\\032\311\331\222\255\260\232\033\310\034t\255\246Z)\2346\322\346S\255\247\3076\325\322a&\321C\232d\025\256j\232\225\352 \346^\2504\253\323\032\351\016O\263\2563\323W\246\204Z\261\274\322/R\344\242\230\\\352S\013\2301K\277\233)6\352\260\256\370t"
+	.ascii	"\241\202O+8\326\n\327\220+Uw\253V\240\017+)\215\364\332@\235"
+	.ascii	"`\271)\225^W\026\241[:u\274\302 D\272Z\2651K\217\251TzL\225\354"
+	.ascii	"\221\210.E>U>\235\221>\247\276XEu]\020\036<\224\264\232&S\031"
+	.ascii	"3j^]S\330\366'g\b%\230\263\024\212\035c;j\263\325C\335\2260\266"
+	.ascii	"\307\264\317\034<,\254\0161U9\320\272=)B5\325m+\354\253\303\364"
+	.ascii	"\224\335\216\275\033\255\246r\200\200\r\345\037\332(\024\232"
+	.ascii	"\002\222\277\033_\336\320\025Ep(i\265\005{\220lM\314n\320\315"
+	.ascii	"\312\024\032\310V;\360sc\266\212\024\266\332D\264\027\234h\230"
+	.ascii	"\350\323K\021\351\024\222@(7WW>\234|\254z\324\022\202&\250R\271"
+	.ascii	"0\210\023!R\246HDd$I\222\016\242\n\020\204Cq\"\351\316\003\022"
+	.ascii	"@U1S)\307\f\325$\251Qc\2175\303\n\306B\n\224w\326\360\237)\321"
+	.ascii	"U\362\213\022e\217O"
+	.string	"K1\203^\217\"\260\301$_\313\030X\303\203\274\255w?\227\247\267f\013a\267C\261\203j!\362\263'\217v_{\t\200@/\254:B\001j#\033L\002\341\2357\3301\324z\003A\315\367>\200:#&\344<\256\304Bb\0304\300\204^\002\217#u\240\246#B\315\217\374\232\202\250I3\024\036!}\006\027\240\354\013Sw\277o\256A\2604\025\351\354\241\361\363\344($\332\005\257P\211\336!u[\225-\226(\037\nZ\b\2404A\260\306\022\237\324vJ\207\255\337p\356\320\307 \013\266SBKe\f\032\277\215\331I\r\034\336\357\216\037\234\367\r\356\333\r\267\027\360\307;\2479+\273\215\316UN\352\300\363\346z\312\211\022\324\227Z\004\345s\264%\320H\\\274^\377:L!\227\036g\033K\003f,Q\207\233q\250\242'\360\340\t\236\257<\360%7\247\n\2642\032e\345\331*\354\271\355\262\321\242"
+	.string	"\201H"
+	.string	"\333\336\301\3058n!\3610.\272\224i\312zj\274\301\357\257p\256\032|\027w_\337\271\342v\317D>\346\214\002\003\232\037O\262\301\335\312\267\027\326S\365\3322\327\350\204T\324\324\355\244'ue\275B[\032\b\310"
+	.ascii	"\204\002\330S\341 Fr\230\001\354B\301Z\242 @\337V\253w\270\310"
+	.ascii	"\024P4\326u\274W\205\252\236V\206\327\017Bo|\252\"a\341f\313"
+	.ascii	"\343%\003c\307M\355\233\231\031\203E\254\325e\237\201*\272B\251"
+	.ascii	"\3675\310\032T\304\303Z\373l^y\234/\3227\373\326+\222\fR\025"
+	.ascii	"\004\367\036\350\036\245\274\371\332\273\265\315P(\201\276\326"
+	.ascii	"k\221\274.\277\317\306\020\261i>\346Nt\353\004\337Y\270\366\311"
+	.ascii	"y:\253\221G\315\025\227\265\214\267\005)v]\037N\365H\311\334"
+	.ascii	"\343g\036"
+	.string	"|z\033\021k\207$\312\224o\203BH\030$\247\037\013&{\027\246[q\364\222\313q\205\316v^\3045=\357\363\227\327\373\276\374Lv`\252\234+\023\022f\2512\023\234m8I\215\0308\240\3438&\254\220\356\333\271T\311\212\260\376dGBP;?\204\024\234\270\267\002h\345\203\220\265^\033\026\007\3070\017E\0043\232\333\350\";\347\f\203\006!\3446\344\377\303\260\177/<\362\210\035\007\242\"K\276\344&\216\303\312\226\341\317\340\356\271\300\252\001\033\330\275 \201\206D\241J\274\214y\004f\304\273\270\230\223p\247\275sV\035Vt\344@\250\231c\005\306Bl\330\021]eHh\031\337e\334\005\215\177\341\224i\275\321g.\371\f\350F\273z\2275\216\365\026\004Ah\035|\231\274\351\336\364\024\023\202\227\207\216\347d\356W \006=\222\237\363\357/\324\267Z\033z\234\20528y=5\002\277\353\351\342\227"
+	.string	"\212G\220\013$\225k\n\304?\004\r\200k\344\357\357H@Iv'\306\306{j\311\372\243"
+	.ascii	"7R\347\321\231_\271>\nEwZ\352\357\034:0:\240\371&\331\024\004"
+	.ascii	"[\321\327\305\261\334\200\223\326\312\372\225\235\275\375\353"
+	.ascii	"v\202\274$\312=\206\263\005l\036W'\312\375A\267\366\333C\006"
+	.ascii	"6\342\337E\317\211\374%\307\217s\233R\230\307G\235\364\243\366"
+	.ascii	"\003\350]\334G|\253^\272\264}\222\373\r\365\207t\333\022\237"
+	.ascii	"\353\252\265\207\025Z\344U\013\266\300\177\241\361\246\266p\247"
+	.ascii	"\366\027_\276\347\334\277\177F>\"\246\325\342\265\277|\366\364"
+	.ascii	"\216`\271@\371\373\361\005\206\313\267\377|\335l\364\271\377"
+	.ascii	"\374\210\230\b\274\352\265\342+\312\264\223AX#\330\023\236\245"
+	.ascii	"\274;v\370y\177\356\366\217\354\274\243\237\273\203\337\327V"
+	.ascii	"\370\327\325\300\273\035\246\362*\376\330\332J4\323\327\221\004"
+	.ascii	"\357j\234*\215=\274g\371'e\217\254\327\004~\311}z\307C\371g<"
+	.ascii	"\3756\0279\374\3725\255"
+	.text
+	.section	.gnu.lto_.symtab.73cc96284c52cbd4,"e",@progbits
+	.string	"blackboxPrintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"blackboxPrintfHeaderLine"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"blackboxWriteUnsignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"blackboxWriteSignedVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"blackboxWriteSignedVBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\001"
+	.string	""
+	.string	"blackboxWriteSigned16VBArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"blackboxWriteS16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"blackboxWriteTag2_3S32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"blackboxWriteTag8_4S16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"blackboxWriteTag8_8SVB"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"blackboxWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"blackboxWriteFloat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"blackboxCompressFrame"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"blackboxWriteBufferFlush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"zigzagEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"castFloatBytesToInt"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"blackboxHuffmanEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.73cc96284c52cbd4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5515 @@
+	.file	"blackbox_huffman.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/blackbox/blackbox_huffman.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/blackbox/blackbox_huffman.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_huffman.c.74d062cb
+	.weak	blackbox_huffman.c.74d062cb
+blackbox_huffman.c.74d062cb:
+	.long	0x34f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF769
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF726
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF727
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF728
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF729
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF730
+	.uleb128 0x3
+	.long	.LASF732
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF731
+	.uleb128 0x3
+	.long	.LASF733
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF734
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF735
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF736
+	.uleb128 0x3
+	.long	.LASF737
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x87
+	.uleb128 0x3
+	.long	.LASF738
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x3
+	.long	.LASF739
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x3
+	.long	.LASF740
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x14
+	.long	.LASF744
+	.byte	0x4
+	.byte	0x4
+	.byte	0x25
+	.byte	0x10
+	.long	0xe2
+	.uleb128 0x4
+	.long	.LASF741
+	.byte	0x26
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF742
+	.byte	0x27
+	.byte	0xe
+	.long	0x98
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF743
+	.byte	0x4
+	.byte	0x28
+	.byte	0x3
+	.long	0xbc
+	.uleb128 0x9
+	.long	0xe2
+	.uleb128 0x15
+	.long	.LASF745
+	.value	0x166
+	.byte	0x4
+	.byte	0x2a
+	.byte	0x10
+	.long	0x132
+	.uleb128 0x4
+	.long	.LASF746
+	.byte	0x2b
+	.byte	0xe
+	.long	0x132
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF747
+	.byte	0x2c
+	.byte	0xe
+	.long	0x132
+	.byte	0x22
+	.uleb128 0x4
+	.long	.LASF748
+	.byte	0x2d
+	.byte	0xe
+	.long	0x132
+	.byte	0x44
+	.uleb128 0x4
+	.long	.LASF749
+	.byte	0x2e
+	.byte	0xd
+	.long	0x142
+	.byte	0x66
+	.byte	0
+	.uleb128 0xb
+	.long	0x98
+	.long	0x142
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0xb
+	.long	0x87
+	.long	0x152
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF750
+	.byte	0x4
+	.byte	0x2f
+	.byte	0x3
+	.long	0xf3
+	.uleb128 0x9
+	.long	0x152
+	.uleb128 0xb
+	.long	0xee
+	.long	0x173
+	.uleb128 0xc
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x9
+	.long	0x163
+	.uleb128 0x16
+	.long	.LASF770
+	.byte	0x4
+	.byte	0x31
+	.byte	0x24
+	.long	0x173
+	.uleb128 0x17
+	.long	0x178
+	.byte	0x6
+	.byte	0x27
+	.byte	0x1d
+	.uleb128 0xd
+	.long	.LASF751
+	.byte	0x2b
+	.long	0x7e
+	.long	0x1aa
+	.uleb128 0x5
+	.long	0x7e
+	.uleb128 0x5
+	.long	0x1aa
+	.uleb128 0x5
+	.long	0xb0
+	.byte	0
+	.uleb128 0x6
+	.long	0x1af
+	.uleb128 0x18
+	.uleb128 0xd
+	.long	.LASF752
+	.byte	0x3d
+	.long	0x7e
+	.long	0x1ce
+	.uleb128 0x5
+	.long	0x7e
+	.uleb128 0x5
+	.long	0x64
+	.uleb128 0x5
+	.long	0xb0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF763
+	.byte	0xa4
+	.long	0x64
+	.long	0x258
+	.uleb128 0x7
+	.long	.LASF753
+	.byte	0xa4
+	.byte	0x3b
+	.long	0x258
+	.uleb128 0xa
+	.string	"out"
+	.byte	0xa4
+	.byte	0x4d
+	.long	0x25d
+	.uleb128 0x7
+	.long	.LASF754
+	.byte	0xa4
+	.byte	0x56
+	.long	0x64
+	.uleb128 0xa
+	.string	"in"
+	.byte	0xa4
+	.byte	0x70
+	.long	0x262
+	.uleb128 0x7
+	.long	.LASF755
+	.byte	0xa4
+	.byte	0x78
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF756
+	.byte	0xa6
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF757
+	.byte	0xa7
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"i"
+	.byte	0xa9
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF742
+	.byte	0xaa
+	.byte	0x12
+	.long	0x98
+	.uleb128 0x1
+	.long	.LASF758
+	.byte	0xab
+	.byte	0xd
+	.long	0x267
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF741
+	.byte	0xad
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x15e
+	.uleb128 0x6
+	.long	0x87
+	.uleb128 0x6
+	.long	0x93
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF759
+	.uleb128 0x19
+	.long	.LASF771
+	.byte	0x6
+	.byte	0x8a
+	.byte	0x6
+	.long	0x2d6
+	.uleb128 0x7
+	.long	.LASF753
+	.byte	0x8a
+	.byte	0x3b
+	.long	0x2d6
+	.uleb128 0x1
+	.long	.LASF742
+	.byte	0x93
+	.byte	0xe
+	.long	0x98
+	.uleb128 0x1
+	.long	.LASF760
+	.byte	0x94
+	.byte	0xe
+	.long	0x98
+	.uleb128 0x1
+	.long	.LASF761
+	.byte	0x9d
+	.byte	0xe
+	.long	0x132
+	.uleb128 0x10
+	.long	0x2b7
+	.uleb128 0x1
+	.long	.LASF762
+	.byte	0x8e
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	0x2c8
+	.uleb128 0x1
+	.long	.LASF741
+	.byte	0x95
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF762
+	.byte	0x9f
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x152
+	.uleb128 0xe
+	.long	.LASF764
+	.byte	0x6a
+	.long	0x64
+	.long	0x34d
+	.uleb128 0xa
+	.string	"out"
+	.byte	0x6a
+	.byte	0x24
+	.long	0x25d
+	.uleb128 0x7
+	.long	.LASF765
+	.byte	0x6a
+	.byte	0x2d
+	.long	0x64
+	.uleb128 0xa
+	.string	"in"
+	.byte	0x6a
+	.byte	0x45
+	.long	0x262
+	.uleb128 0x7
+	.long	.LASF766
+	.byte	0x6a
+	.byte	0x4d
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF767
+	.byte	0x6c
+	.byte	0xe
+	.long	0xa4
+	.uleb128 0x1
+	.long	.LASF768
+	.byte	0x6d
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF754
+	.byte	0x6e
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0xf
+	.string	"i"
+	.byte	0x70
+	.long	0x64
+	.uleb128 0x8
+	.uleb128 0x1
+	.long	.LASF742
+	.byte	0x71
+	.byte	0x26
+	.long	0x34d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xee
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF725
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF772
+	.long	.LASF773
+	.long	.LASF774
+	.long	.LASF775
+	.long	.LASF776
+	.long	.LASF777
+	.long	.LASF778
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF779
+	.byte	0x3
+	.long	.LASF780
+	.byte	0x3
+	.long	.LASF781
+	.byte	0x7
+	.long	.LASF782
+	.byte	0x1
+	.long	.LASF783
+	.byte	0x6
+	.long	.LASF784
+	.byte	0x1
+	.long	.LASF785
+	.byte	0x6
+	.long	.LASF786
+	.byte	0x7
+	.long	.LASF787
+	.byte	0x7
+	.long	.LASF787
+	.byte	0x6
+	.long	.LASF788
+	.byte	0x3
+	.long	.LASF789
+	.byte	0x6
+	.long	.LASF790
+	.byte	0x6
+	.long	.LASF791
+	.byte	0x3
+	.long	.LASF792
+	.byte	0x3
+	.long	.LASF793
+	.byte	0x5
+	.long	.LASF794
+	.byte	0x3
+	.long	.LASF795
+	.byte	0x4
+	.long	.LASF796
+	.byte	0x4
+	.long	.LASF797
+	.byte	0x3
+	.long	.LASF798
+	.byte	0x3
+	.long	.LASF799
+	.byte	0x3
+	.long	.LASF800
+	.byte	0x3
+	.long	.LASF801
+	.byte	0x2
+	.long	.LASF802
+	.byte	0x2
+	.long	.LASF803
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF744:
+	.string	"blackboxHuffmanCode_s"
+.LASF743:
+	.string	"blackboxHuffmanCode_t"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF740:
+	.string	"size_t"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF754:
+	.string	"outLength"
+.LASF750:
+	.string	"blackboxHuffmanDecoder_t"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF758:
+	.string	"found"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF768:
+	.string	"bitCount"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF755:
+	.string	"inSize"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF719:
+	.string	"NULL"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF769:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF735:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF749:
+	.string	"symbols"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF700:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF757:
+	.string	"bitPos"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF766:
+	.string	"inLength"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF730:
+	.string	"signed char"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF737:
+	.string	"uint8_t"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF759:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF733:
+	.string	"__uint16_t"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF745:
+	.string	"blackboxHuffmanDecoder_s"
+.LASF747:
+	.string	"firstIndex"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF771:
+	.string	"blackboxHuffmanDecoderInit"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF725:
+	.string	"BLACKBOX_HUFFMAN_MAX_CODE_LENGTH 16"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF732:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF764:
+	.string	"blackboxHuffmanEncode"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF760:
+	.string	"index"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF734:
+	.string	"__uint32_t"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF753:
+	.string	"decoder"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF466:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF748:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF728:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF512:
+	.string	"__wur "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF726:
+	.string	"unsigned char"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF736:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF727:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF756:
+	.string	"inPos"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF741:
+	.string	"length"
+.LASF738:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF729:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF717:
+	.string	"__size_t "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF752:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF765:
+	.string	"outSize"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF742:
+	.string	"code"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF770:
+	.string	"blackboxHuffmanTable"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF731:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF767:
+	.string	"bitBuffer"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF763:
+	.string	"blackboxHuffmanDecode"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF751:
+	.string	"memcpy"
+.LASF762:
+	.string	"symbol"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF746:
+	.string	"firstCode"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF739:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF761:
+	.string	"next"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF788:
+	.string	"libc-header-start.h"
+.LASF796:
+	.string	"stubs-64.h"
+.LASF777:
+	.string	"/usr/include"
+.LASF800:
+	.string	"stdint-intn.h"
+.LASF774:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF803:
+	.string	"strings.h"
+.LASF775:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF783:
+	.string	"string.h"
+.LASF792:
+	.string	"timesize.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_huffman.c"
+.LASF776:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF799:
+	.string	"wchar.h"
+.LASF789:
+	.string	"features.h"
+.LASF798:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF801:
+	.string	"locale_t.h"
+.LASF778:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF781:
+	.string	"stddef.h"
+.LASF780:
+	.string	"stdint-uintn.h"
+.LASF773:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF797:
+	.string	"typesizes.h"
+.LASF790:
+	.string	"features-time64.h"
+.LASF795:
+	.string	"stubs.h"
+.LASF772:
+	.string	"src/main/blackbox"
+.LASF784:
+	.string	"blackbox_huffman.c"
+.LASF793:
+	.string	"cdefs.h"
+.LASF782:
+	.string	"blackbox_huffman.h"
+.LASF786:
+	.string	"stdbool.h"
+.LASF791:
+	.string	"wordsize.h"
+.LASF802:
+	.string	"__locale_t.h"
+.LASF794:
+	.string	"long-double.h"
+.LASF785:
+	.string	"stdc-predef.h"
+.LASF787:
+	.string	"stdint.h"
+.LASF779:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \201\255\002"
+	.string	"B\004\020\033\300\2471\233S\fw\275\305\034v\225\007\277\377\377\377\005'\"m\313-\245L[\006\367\317F\266\n\203#A\t\356\373\032\337\365]\3539N\254\350h\315\3714eR\352\373\016"
+	.string	"\003a\226\313+\002\007"
+	.string	"{\rW\270\274s"
+	.string	"w\223\201\003rN\301"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 C\355"
+	.string	""
+	.string	"x7"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\002\001\001\003\005"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"E%\345\342\322\f\006\350d\003X"
+	.text
+	.section	.gnu.lto_.inline.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \300U\004"
+	.string	"\022\b\034&\200K\322\001\034Tc\022\316\207\027\250\206Z$\261\266\203\032K\334\365v\233\271\030\027)hV\204\366\367j\256m\271S;0\263\f\026x\t-\314\322Q\364>\t9\033Lf\270E\344\306\177\360\374Q5\217\253\022\374\324V5I\242?\324\373\276\251\224\313\204:\024\372\214\374\271{\033\315L\b\364Q-*\033\242\367\003z\330/\352Ee#<^\t\t"
+	.ascii	"\240\257=\244\3434v\261\026\314\372\267*^0\303\2502\356\006\332"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \263U\003"
+	.string	"R\206\022\033\260%\351\314A\346p\212\340\025\215r%\032\006\3030J)t\2425\273\033!2\245\026\023\260L\030\247L\321\003\317\255C\036\307\036h\033\276\360\266\334\240\250\021z\204\266\202\235\304O\262\022\255\314\317X\2712V[\275\374\037\215\204\013"
+	.string	"\024\303\032gD\247\341\232\rO%\206LB\230\262\322*.\253\356\272\236\033n"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\002\232\004\003\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \307\355\003"
+	.string	"B\306\024\036\240'\351\340\377\377]g\002\204#\360R\025\3422\001\230\200:\236\302\376\277{\362\t\331R\246\257\003Q\346\245\326\201\250\303Y\330\274\t\355\203~=\23030\330\210"
+	.string	"\200\315DJ\363\222\244v\3246IE1\347\250\\P\266\374O3\355\264\323(\337\205\177\021\020"
+	.ascii	"\r#\370\n\370\2103'\\\370\312\222\253\b\302\270\306`\377\253"
+	.ascii	"C\300\364\232\275({G\255h\321\227n\324\001\300\001"
+	.text
+	.section	.gnu.lto_.lto.3c0dd67fb357c269,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxHuffmanTable.0.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375`\356\036uE"
+	.string	"\252\203\314\034B\200\2208\351_\257\324\327+\365\365J}\275\"\322\352\315\266z\263\255\316o3\273k\030t\f\303t\237\3030\335\3470L\3679\f\325}^m\237K\265}\356X\333\347\261\267\334\303\336\322\225R\222)\311\035\004\002\277\001\222\001$\265K\001\036(.DN\316cnn\203\216\016\243\256\256\302\316\256%\356\356\032\361\360\024\363\362\016\365\364\b\367\366\002\371\370\374\372\372\366\374\374\360\376\376\352"
+	.string	"\001\345\002\003\337\004\005\331\006\007\323\b\t\315\n\013\307\f\r\301\016\017\273\020\021\265\022\023\257\024\025\251\026\027\243\030\031\217\0064\222\215L\020\020I\021\021F\022\022C\023\023@\024\024=\025\025:\026\0267\027\0274\030\0301\031\031.\032\032+\033\033(\034\034%\035\035#\036\036 \037\037\035  \032!!\027\"\"\024##4\202\204\204\261,\023KJ\fML\006ON"
+	.ascii	"QP\372RR\364TT\356VV\350XX\342ZZ\334\\\\\326^^\320``\312bb\304"
+	.ascii	"dd\276ff\270hh\262jj\254ll\246nn\240pp\234rr\226tt\220vv\212"
+	.ascii	"xx\204zz~||x~~r\200"
+	.string	"\200l\202\202f\204\204`\206\206Z\210\210T\212\212N\214\214\312\243#\021$\244\217\244$\016%\245\214\245%\013&\246\211\246&\206prZ<\036\021\237\236\n\241\240\004\243\242\376\244\244\370\246\246\362\250\250\354\252\252\346\254\254\340\256\256\332\260\260\324\262\262\316\264\264\310\266\266\302\270\270\274\272\272\266\274\274\260\276\276\252\300\300\244\302\302\236\304\304\232\306\306\224\310\310\216\312\312\210\314\314\202\316\316|\320\320v\322\322p\324\324j\326\326d\330\330^\332\332X\334\334R\336\336L\340\340H\342\342B\344\344<\346\3466\350\3500\352\352*\354\354V\342\356\256\021\017O1/\357PO\217po/\220\217\317\257\257o\317\317\017\357\357\257\016\020P.0\360MP\220mp0\215\220\320\254\260p\314\320\020\354\360\260\013\021Q+1\361JQ\221jq1\252\316\343\001\214\214Nu\036\0078\240qvh\234\r\370\354\251T\347\022\0169 "
+	.string	"\201!Q\303\354\237\017q\263\203\317&'IZ\360\026\r\004\325\307A\240}\352\343$\340;\365q\024\370\233\3728=\037:\324x\020\200\314\007\002\274\2000"
+	.string	"K\b\004\240\324O\361\371P@\t\232\001#i\007\200\250!\320\261\226\200\006\233\002\027m\013P\2701\360\021o\r0\326\271\344@\242\325\003\206W\020\fbE"
+	.string	"\230%A\237\326\004z[\024\334q=\320uU\020\347e\201\333\327\005k`\030\240\205eP&\246\201\330\006^\325\277"
+	.ascii	"\230\017\034l\365t\200\345\323\241\352\307\003)\240\017\236\202"
+	.ascii	"@h\022\nAiH\204#\242\021\210\212H\b2*\301\347\310\204\035\244"
+	.ascii	"\023p\222P\250QJAfI\205\027\246\025X\232XHqj\301\344\350\002"
+	.ascii	"\311\323\013!P0xD\305\260\301R2\\T\307\b`>\314@\301A\203Gt\324"
+	.ascii	"\320\214\265\313\367 \217\235X\273\374\017\362\251\rk\227\017"
+	.ascii	"BB\365`\355\362C\310\250\006\254]\276\b)\325}\265\313\037!\247"
+	.ascii	"Z\257v\371$$U\337\325.\277$\253\232\256v\371%\244U\307\325.\337"
+	.ascii	"\204\274j\267\332\345\237\220X\275V\273|\0242\253\321j\227\237"
+	.ascii	"BjuY\355\362U\310\255\026\253]\376\n\311\325_\265\313g!\273\232"
+	.ascii	"\253v\371-\244Wg\325.\337\205\374j\253\332\345\277\220`=U\273"
+	.ascii	"|\0302\254\241j\227\037C\212\265S\355\362e\310\261^\252]\376"
+	.ascii	"\fI\326H\265\313\247!\313\272\250v\3715\244Y\013\325.\337\206"
+	.ascii	"<\353\237\332\345\337\220h\315S\273|\0342\255sj\227\237C\252"
+	.ascii	"\265M\355\362u\310\265\236\251]\376\016\311\3260\265\313\347"
+	.ascii	"!\333\272\245v\371=\244[\253\324.\337\207|\353\223\332\345\377"
+	.ascii	"\220p\035\264\212ZQ,\232E\267(\027\365\242_4\214\212Q2ZF\317"
+	.ascii	"(\032U\243k\264\215\272Q8\032G\347(\035\265\243w4\217\352Q>\332"
+	.ascii	"G\377( \025\244\203\264\220\032RD\232H\027)cCtDO4E[\364Eg\264"
+	.ascii	"FstG\1774H\213\364H\227\264I\243tJ\2574K\273\364K\307\264L\323"
+	.ascii	"tM\3374N\353\364N\367\264O\003uP\0175Q\033\365Q'\265R3uS\037"
+	.ascii	"\373\251\243Z\252\251\272\252\257\032\253\265z\253\273\332\253"
+	.ascii	"\301:\254\307\232\254\315\372\254\323Z\255\331\272\255\337\032"
+	.ascii	"\256\345z\256\353\332\256\361:\257\367\232\257\375\372\257\003"
+	.ascii	"[\260\t\273\260\017\033\261\025{\261\033\035\302%|\302+\334\302"
+	.ascii	"3\\\3039\274\303?\034\304E|\304K/\361\023Gq\025_\361\026wq\030"
+	.ascii	"\217\361\031\247q\033\277\361\034\327q\036\357\361\037\007r!"
+	.ascii	"\037\362\"7r$O\362%gr'?:\224G\371\224S\271\225_y\226k9\227w9"
+	.ascii	"\230\207\371\230\223\271\231\237y\232\2539\233\267\371\233\303"
+	.ascii	"\271\234\317y\235\3339\236\347\371\236\363\271\237\377y\240\013"
+	.ascii	":\241\027\372\241#\272\242/z\343C\274\304O|\305[<\306g\374\306"
+	.ascii	"s\274\307\177|\310\213<\311\227o\362'\257\362+\337\362.\017\363"
+	.ascii	"1?\3634o\263\302\347\274\316\363|\317\377<\320\013\375\320\033"
+	.ascii	"\375\321'\275\3227\251\360O)\334`\303\361\235\352\037\227\\\252"
+	.ascii	"\3174\037\026\251~\2213Q\375\242\207\0163\344d\232M\363iBM\251"
+	.ascii	"95\253\246\325\304\232YskrM\257\3715\303\246\330$\233e\363l\242"
+	.ascii	"M\265\2716\333\246\333\204\233qsn\322M\273y7\363\246\336\344"
+	.ascii	"\233}\363o\002N\30198\013\247\341D\234\211sq2.\304F\354\304R"
+	.ascii	"\254\305^l\306j,\307v\354\307\202\254\310\216l\271%{\262(\253"
+	.ascii	"\262+\333\262.\013\2631;\2634k\2637\233\263:\313\263=\373\263"
+	.ascii	"@+\264C[\264F\213\264I\273\264L\353\264\307\205\332\250\235Z"
+	.ascii	"\252\265\332\253\315Z\255\345\332\256\375Z\260\025\333\261-["
+	.ascii	"\263E\333\264][\266u"
+	.string	"\333\267\215[\271\245\333\272\275[\274\325\333\275\355[\277\005\334\300\035\\\3025\334\303M\\\305e\334F\216`\t\246\340\n\276`\f\326\340\r\356`\017\006\341\020\036a\022.a\023F\341\024^a\026v\341\027\216a\031\246\341\032\276a\034\326\341\035\356a\037\006\342 \036b\"6\342#Nb%f\342&>\362\023G\261\024Sq\025_1\026k\361\026w\261\027\203q\030\2171\031\233\361\031\247\261\032\263q\033\2771\034\313\361\034\327\261\035\343q\036\3571\037\373\361\037\007\262 \023r!\0372\"+\362\"7R\b*A'h\005\265\240\0304\203nP\016\352A?h\b\025\241$\264\244&\364\204\246P\025\312B[\350\013\205\2412t\206\326P\033\212Cs\350\016\345\241>\364\207\006Q!JD\213\350\021E\242Jt\2116Q'\372D\241\250\024\235\n\203\t\25028;\355\354wrO\222$I\007\022`\200\361\211"
+	.ascii	"\022\001\361\003#0\271v\253\222\303\251\026\017\272\235U\270"
+	.ascii	"\273w!$\276p\327\016{\340\201\004\240\346\344\372j\377[Ywm\271"
+	.ascii	"\003\372\245^Z\301\245{\006\273\312@\237/U\346D\004\306\300\251"
+	.ascii	"p\247\340XuE\200\007C\016\234\t\213\013\262\3119\211\026\013"
+	.ascii	"\026\253xE\237\270f\025N\257\020\364\357\325\254#a1A68'\341b"
+	.ascii	"An8O\302\342\202lrNT\301\275y\330\t"
+	.ascii	"\t\372\227u\313iMy\305\370\025I\257$\351\225\222^)\351-%\275"
+	.ascii	"R\322+%{\245\244WJz\245I\257\224\364JIO)\351\225\222^)\351-%"
+	.ascii	"\275R\322+%{\245\244WJz\245I\257\224\364JIo)\351\225\222^)\351"
+	.ascii	"-%\275R\322+%{\245\244WJz\245I\257\224\364JIo)\351\225\322&e"
+	.ascii	"D\210\202\340 \007\204\303B\342\305\375\245hy\351~UX\276\310"
+	.ascii	"\246\374\027g\207\212\345\215\373Ka\363\342\375\322\230\310_"
+	.ascii	"\362\367\276p\277)l^\274_\032\2267\356/\205\315\213\367\213\302"
+	.ascii	"\362\305\375\245py\301z\367\213\373K\341\362\322\375\242\260"
+	.ascii	"|q\177)Z^\271_\025\226/\356/\025\313\013\367\0339X^*\2267\356"
+	.ascii	"7\205\315\213\367K\303\332\370\023\260P\300-\344\354\013V\311"
+	.ascii	"\007Z\242ML\265\001"
+	.text
+	.section	.gnu.lto_blackboxHuffmanEncode.1.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375`_\b\2350"
+	.ascii	"\232U\220\022G`\\N:}b\364\340AX\306't#\335\347\033\212\255E}"
+	.ascii	"\331\007O\372\\\245\216jr\227Mi8\375\243\274\f\330\005\330.\354"
+	.ascii	"\370\304\327\244\r\337\317\002\317\277*m\246@\232\262)\202\330"
+	.ascii	"\3326\"\215\020\"w\222\001\031\001\001\001\030\001M\267\2734"
+	.ascii	"m\313\204\361\303\311O\242$\236\022\344\372T-\302\304\374\306"
+	.ascii	"\3175\006\327J\205,/M\333\266\306\247<\265\2524\250\360\023\325"
+	.ascii	"i\223daN\177L-\245\305\217N\233t\263\021\202\r\323\275o\343'"
+	.ascii	"\263m;\206G\327\266-\022wX\237\246d\230~\231\277v\266\2533_|"
+	.string	"\247m\313\340\350\332\226\211\304K\353Sf\256O{\224+\346'\312<\353:\031\027\255)~m\333*\021]\200\372\024=\217\372\264\2070\003\031\370\367\367\367w\224yf\373\352\304\2410\310\256@5E\373^\361\273b\2348\346\025\366!Z\241\310\030\276\357q\371@9\200\355\020\242E\261\273\257\357q\205\241E_\310\314<\356\004\230p\365\270A\036tY\227% \304\013\354\353\367\270v\334\356w\331\225\274\300\340\022\035W\217\025\366\024\235\240\206F$\247K\211v[S\213\260K\306E\355\216\256\211\265\331\352\322\361>\335S2>5c^`\277@\013m\333\362\335\352\362:\347\234\371Ef\276\301\f4\022hi\242,xX7\332\347gq1\265\036\341\267\350/y\264\202\276}e\223\254\373\307B\375\3769\243\025\007\353\376\361\355\376\032M\273\245\275.Ez\216\356\250\223\261\266\356M\315\350\3406\323\276B=\334)"
+	.ascii	"\301\272o\370q\0176\241\354\265\367\r33\306m3\346\017\215\tr"
+	.ascii	"\206\273\2149\t\351\310ht)\277\202\004g\376\007\212\336\366\033"
+	.ascii	"8\225\277\300\275<\364\271\263PP\021\350\307\007xy\300/\013P"
+	.ascii	"/\367\360\254\227\003\334\313;\300\313:\277\f@\275\234\363\267"
+	.ascii	"3q\275<\274\363,<\3349\270^f\331\313\353z\031x/\253\300\313\351"
+	.ascii	"\275\214\002/w_\276\352\345/\b*\3712\244\327\2668\376\340\264"
+	.ascii	"^\322+I>\367\277\375\316\037\356(\363\3255&~\035\337\216\205"
+	.ascii	"*\033\023\363\025\344[%\027\233\303\215\314\226\023&\276\034"
+	.ascii	"\237\216\205O\325's|\237\261>=\363\025\277\312\255<\216\205\352"
+	.ascii	"\027\334\212\237\023\352\243\376\205h\325]\241/5\264\265\315"
+	.ascii	"X>\26655\251\031\355\240.\366\362hlHT\244\376\231\232\\\033\373"
+	.ascii	"\247\227\030\362\222\327\215\217\237{\337p\261-`\241m\333\266"
+	.ascii	"@\235\346\363\211\360\320s\366B}\372\2555\303\326\351\356\323"
+	.ascii	"\212\223\323"
+	.string	"\007\032@\337)\312&\305\316I\352\277\035\275\330I\335O\245\030R\033\365\260\323\2472N\033$\026\347\247\372\323H}\373r\232}U\302\312\262\250m\366\"]^\222\264\315\ft\261?\346\246\227\274n8\247\251\327`\312\264\275\241\303&\236\261\357\004j\265\215}\237J\261\254-F}\270\023\261\rl\243\276xZ_k\263\037.\006\0041\f\230\265!\250\355\323\300F\247(\341\244\255r\210\177\231b\325\364\371\265mr\311K\023\203 l\374\362\256\207T\237\246\215\200\314\332\260\251e\257\325\362_9\021\226\337!\021\234\265m\362[\314\254\342]\232z\013G\231X\224\266MF\330r.O\350\217<e(\022\352\267\236\362IH1\362I\264-P#\216O\250\324\253\240\242\242\220\027\254\244\234X+*\344\021\203\225\224\323j\205<\262%\254HPAe\240\222Z\251\244.\224\013)\rV\310#\220\235\236\032,-\030\361"
+	.ascii	"B\222\220\025\362\330\374\224D\325t\"*\nY\"\004\213\243\323\324"
+	.ascii	"S\223\t'%*\251\246\023JOU)\224\222\020\360\021\005T\225\222\325"
+	.ascii	"\361X\245$d\266\3572\026\255NnX\324\214\006\211}\273\263^\330"
+	.ascii	"n\244I\037\032\352\333Y\314h\210\0036x\310\t\320\003\272\237"
+	.ascii	"=}\240\005\364\305\020\273\247\250\377F\354\242\235\016v\200"
+	.ascii	"F\373xz\335\351T\214RI\226\023\f\215X\326\220\330U\257\341\314"
+	.ascii	"\3614yL!\033\324\304^2\013\324<\254O\007{\311<\355\344\346\354"
+	.ascii	"\332\221\365&\330f\314:\327\243>\335W?\265\033\327x\241\004h"
+	.ascii	"\332\230k|\320*\f\223\226w\215\007\352\345\021\265\265\325\250"
+	.ascii	"\037\367\325/M\356\036\313}zY\240\205\032\303]\362\272A\365\306"
+	.ascii	"|\356\235A\375\267\271Kp\243g\306\002\213\235\240\227\214\002"
+	.ascii	"\177Z\330K\346\243\016\200\260\250Q,\345\230R\310\020M \"\322"
+	.ascii	"$-\034\220\002\2211#z\020H\247\206&)\2441\352\013\312\232<\340"
+	.ascii	"y\252\002\017\034\251\330\230\325'\202\210\335\247\257\227\362"
+	.ascii	"\b%\354\022Sp\n\331\\\225\217\226\305\240\344VhIs\301*=\220H"
+	.ascii	":\t1N\244\341\363{\002*\332\324*s\231F\232\033A\360\026\373?"
+	.ascii	"\352\262\220\360\327\252\317Fa\307l.\257\340g\203a{U\310\003"
+	.ascii	"\301\205\030p\303\370\210\214\261\212\301\252\033>\344qnd\r\273"
+	.ascii	"64Z\0367\335C\220\343\375\003\326H.jx_X\"b5\304C/\365\314\205"
+	.ascii	"\021*\321o\300m\327\035X{\"]\267?\302\321\352\227E\213\205\216"
+	.ascii	"ss\300\033\202\231\372\362E\225\300\372\326\314\376U\306\356"
+	.ascii	"\376\034\320\325\200Uc0\354\252D\037\3017$\247$\326\367G\276"
+	.ascii	"<\212/I{\020\274]\021\203L\016w\336\234%\001\226y\032A\342\333"
+	.ascii	">7\321%t\350\037\315\261k\364\373\224AnJ\0347\034\270\317\262"
+	.ascii	"\006\340\234\013\2720\256ML\276\f\345r\224\244\243\3422t\243"
+	.ascii	"\2511\326\254\013\205\311\227G\235\241\257<j\342\331\311\033"
+	.ascii	"\"\200\333y\335\b\023\236\2031\027s\225\227H\240{\330\f\346\033"
+	.ascii	"<\270\204\370$?$\236*\261\317n\301\031\202\341\344ujXW\233R\370"
+	.ascii	"\023\204\246g\250"
+	.text
+	.section	.gnu.lto_blackboxHuffmanDecoderInit.2.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375`\322\007\235)"
+	.string	"\032H\260\017Fp\\N:\207\332&>\027\0023h\250\221\337YD\025\344\264\240\354y\234\005jn\224n\307\314\002\251\235l{\346\324\327\"v\017K\024{\027\212\371\377?\330P9J\322\330=n\321\311\262BO\266I#\233\310\235d\345"
+	.string	"\326"
+	.string	"\351"
+	.ascii	"\251\3351\306\244\005zk\253\266<\314\351bH\341\323\357F\355\360"
+	.ascii	"\202r\257\222\005z\373\253\366\b\206+\237\305\351`8\320\213\326"
+	.ascii	"!\354\n\234{\253\206n\371\004z[\253\206\346\034\206W\346[\371"
+	.ascii	"\025\247\177\3458\360^-:\264{\225\017\270\b\275e\345\007\234"
+	.ascii	"\267\350\003\234\267\314N\314n\256\344\272\01732\025V\347\336"
+	.ascii	"K\354%=f\376\235\\\357M\345\3314\235\356\353\241\274\323\246"
+	.ascii	"fW'>\331\207^lI+\035\367\031Q{\220\224*\"\265\027\244\004H\221"
+	.ascii	"\243jG\200%J\026\220\"\347\231\355\366%\313\307j\312\264\200"
+	.ascii	"\265\204\314\323v\324\323\027\345\352\026\275zj\206\220s\373"
+	.ascii	"[\325\0213\203\223$\222\237\275RYAU3\212\220\367\317\336\240"
+	.ascii	"\213N\322J\310+O\303\275\227k\322\n\310\231\347\314\3671s\023"
+	.ascii	"3\217C\377b4\357u\313.\222\316'o\371I\347\355\273\250\353\353"
+	.ascii	"\251\3361O\031\226\35698iv\232\207.$y\252t\374\263\233S\262\254"
+	.ascii	"\370jMs\026s\016\235@3+\035\353\223,\224j\035\\\313\252\274\335"
+	.ascii	"J\307\254\324Q{\353\207\023\036\334Z\314B\303 \341O\360_?\201"
+	.ascii	"/\317\300\243\235\177\027;\003\370\330\331\347f\347\036\2632"
+	.ascii	"\217\255\234\236\225}g\345\236\255\214\232\225y\274\312\347Y"
+	.ascii	"\331\236\225\315\263r\333\312\325\254|\004\251\0207\006e\356"
+	.ascii	"\375qWw\315\330\345\223/\177\264\337\354\007\373\305\376\261"
+	.ascii	"\237\314\267cj\234Z23,\226J\032\247\326\nZ\023&%\030\370e\374"
+	.ascii	"3N-\223.\367\342t3^\023F\375n\324\026\026\224{/\f\364Vh\366\265"
+	.ascii	"\234\313\3118\007\320TO\273\311ve\205}\262\243u\326\276R>\362"
+	.ascii	"\364i*\340/\315\247\326J\307\277>\032\263\365 Cs\016\373h\277"
+	.ascii	"\036\212\t\352\213]\370d;\250\177G\n\013JNh[\330\227k\203\004"
+	.ascii	"b\023\264\r\004\267\234\003 \016y\200\253\304\341\340\342\374"
+	.ascii	"\250\270\032\344\217\211\247I\320E\244\314\333O\177\354\302/"
+	.ascii	"8}\372\247/'U\007\225\366\373(k\343\264\271#"
+	.string	"m\266\267\370ikq\032\327B\335qu\350=M\305kgOo\210\213\252s6HVOkx\252t7\357\275\327\024\352\233]\350\340=-\324'&\257\230\375\346\366\244\234#\317n\263yh\244\260\240\352\335\215\223A\026Xs\357\255\300|\342m8\320{o\321\030\021)\004py\345\350\002p\313w\355O\3311\257x\030\243\242\"fF:\230\"\021\327\275Q\025\330\002/j\270X2\3068c\034\217\224\2204N\263\311\210\264\224dk4\031\227L>*F(\202\200$\201\002Q\220\311\210t,\032\221x\\$Z2Rj\321\302\306\213\025M\307#\030E\243\030G\304\245$#%b\221\211\006\221H\001\037e\030\231\2105\216G&b\252\274o-\3660\304\314SC1\016\363\336\254\f\007\373\311\016\204\003V\357|h\260;\2167t`S\2359P\r\330_\366\202\375%\260\203w</n\347!\370\341w@"
+	.string	"\233\247\r\334\231\262\353u\332\006\332\246\354\032\210\253\314{\355k\003mK\327\202D{\r\324\305k\324\216\321\2055(^\2478a\r\035^_\200\353b\205.\325j\331]\201:<\373e\3272\303\207k\004\2114\t_\316\f4\031\007=\273\315\222W\276\272\267Kv_\031\035\257\2678\215\263\303nZ#\223:\370\017\255csb\203\3145\261\364o\002\200\247\250A@\345\030cfdD\202\004I\232f\f\240\002\231)\242z\021@9dlf$\005\005\245,c\242"
+	.string	"\250\337\324A\373e\306|\005\340\305\236\201\262\255\021\030\250\204d\203\201\032\310\347[\034"
+	.string	"Y\322\213)\002(\314\263\"\265b\365\216m\036Y\004\034\350z(~\013?=\324\371E\325b\322\n4/\336\254\24580\035\260l4\n\032\204q\r\335\345\332\354J\365\327\020R\302\351v\312\t\310Y\251\274\3145\267v\266\001E\354\216\025\200P\b\022\263F\252T\003p\306"
+	.ascii	"\2034x\334\3549fZL\017\023\323\034\005\206\207{\320in\262\025"
+	.ascii	"]\355{\312F\275\0229\221Ft\241\205_\3475_\024L\376\\\306\026"
+	.ascii	"%\037\234~@L\307\013\323yO\tE\2470~\234\245\203&\222\214u\212"
+	.ascii	"#eC\200:\007\302gp\237\307\215C\270\253\236\232K\222\260\235"
+	.ascii	"\364\214\264\342\232$\212!\027\356\246\232\255\320\017\223f\271"
+	.ascii	"\340_\034X`\313\321\220\244\006\200\365\370\305 \277X\240\215"
+	.ascii	"\210\002\301\202\361ut\221\271u<\025\200\266\"\300\265\300\322"
+	.ascii	"\327\345EA\334\263\032\344}7p\237\365\226\222#\327\221\363'\201"
+	.ascii	"NB\377"
+	.text
+	.section	.gnu.lto_blackboxHuffmanDecode.3.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375`\210\nm<"
+	.string	"*j\034\027DP^R\007\373]\033\n\227\254k\371\307\b\231x,\200\211\\|a\323;\003<L\327=\267\210\322\036(9\230"
+	.string	"Fx\254\021"
+	.string	"[\321\006\003\214ic<\372>Z\211\325\200\343\301\221\032\243\3046\331{'\231R`\001G\001a\001@X\224PQ^n\355J~M\263\215\007L\314\240\355\345<m\232)\333\305\264W{\350-\213\204\372%\r\316\363\353\255w{\265\257y[\017\3311\266\276&\235\306\354\224\2129k\361z\313\002Qv\253\365\365\375\212\276^\244T:9\347%o{\353e\237`\366N\354Q\262^V\330-\363\224\217\275K_Ycv\022iR\315975\b7J\274\305\305"
+	.string	"cvr\001\342\341\365\366\317(\035w{\026\327\342\345\323\027~\314\271H_5\347iSK\275\336\366\364\365+\216\346\325}e\247fb.e{\246\355\345\234\237\222.\344z\313:\220\353\355\0371\032\205\r\374\373\373\373sv\352M|/7\376\024\217D\237\2410\370\002\335\226}\354\325\376\345F/\0333\363\037V\210\216H\034\257\213\232\261\b\310\316\340\360\266 \270\330\303\217uQ\262*\022L\004\342>P\242?\336\034\327\020s\342!\373tf\312\274.\352\203\245\";\202\006\f\013\215\214\214\365\360`\006'f|\370\353uQ\036FP\242;0P\207\273E\261'\233\3149\207\341\326\233f\316\262\020\312\344\260Q\024\203\301b%wx\036\347\030*\346\304\357UG\300\004\f\032_\331\030\020\307\300\252\234sc\031bc\336"
+	.string	"\274\333\261\272\373Fw\320\031\016\355\301>\203o\337\303\244 \237}V\017\377?\233\306\344\376\370=L\017\030\376k\003\357\377\327\247_\023\377uq\355ZW\025RgM\353\016\324\344\007\021\366\245\275\340\221\357e\\\356\2348O{\234\277v\344\236.\017\013\336\367\022\204\252\263S\312r\024\240\367\325u5\274\026\244ni\201\220&\356ko\363\rpj\370\3622\356\353\236~\341\227v\273\320\335\027\226\376\"\335T\276\305\375\201\003\237\2727\230\222\212r/\356\f\034\214\373\002\250\307\255 \201wq\177jbZz\334\007\034\316[\311\255\336I\356\346m\300\251\336HGF\311\"\242\002Hg\363\036\n\342&\200q\017xq\013x\334\001\036\267\220\020w\320\343\006z\334"
+	.string	"\036\367Q\210\333(\304\375#\304]\024\342&\272\232\267\017\020\367\020\210[\b\304\035|\334\357\343\006\006q\273,\356\366\305\315\002q\377\343\306\217\333! \251\220\375\220\266\275\233i\266\361\247'\253i\255N\034\316\335\352\356\346NuWsgs\267\333Y0\312v3\355q=d\303\300M\217\230\330\241Q\3119\323x\242l\037\323N\306\337\240(\313\370\325\313\335\266\222\315i\216n`R\215\361zk\304\036\356og|t\232\270\317\331\234s\026:x\207Sz\007Q\320+X\313\020\276=\301\227\266\331\\\023`\3247)=\323C\033X\364>\017m\0268\364\t\036:$\335{R\201\304\017zh\267\027Is\306\227\347]\256[\035\204\036\201o\227s\201C"
+	.string	"3\027i2\36228\234eS\007\177\343\301\200\035\201oBb\025\360\017~"
+	.ascii	"\322\013x\334F\350\201>\300\023\320\013;\013z\241G^\001\374\361"
+	.ascii	"\201\336\303\310\232\036\300\017\330\363\3643\376\361\375\351"
+	.ascii	"\3274\342vV\021\314>\270\233(\343G@bm\3261\372\361\271y_"
+	.string	"\332\256fN\214\2136\227\245\225\372\242\207z\234\007\251\314\241q\247\276\331\026\371C\017\375\371\342\031'\316\323\306\312\251 \234\215\263\375\274S\211\037\365\305\307mag`\370\317\013\212\327YI\331\345\354l\320}\345tXo\316N)5^5H4\231\275p\275%\276\324\235\265\211\377\274\306\032\336\020\306}]\364UM\340\324;\033\223#\177\352\261^\320\232\\]\226S!$h\r\316\355\242U\360\334\244\324\273\232\223'_\352\361\23602\260\267\250w7O\016?\352\361U\370\377C\034\356*\334\340\013\337\237;\336\017>\260-\371\300\177\277\325\013\363s\037\370\336>\307\265|\227\264\257p\275u?%\270Hda\235pY\021Y]\314\021\355\322\267\230\030\262\226\355\026\023\003\3272\204\213\325b\251!k\351f-q\t.\022YX\026\270\272\230A\256.\346w\210+(\251\004\"\030L9!\265\260D0\257\260D"
+	.ascii	"\373\312)\313\n\305\210\021]%@\260`\2060qeu\"\304S\326\322\n"
+	.ascii	"\305\323\225\326\326\223\323\201f\246\300\322z\342b2\265\236"
+	.ascii	"\206\323\234\305\331\"T\206'\215'\365G\301{\234_\200\221\346"
+	.ascii	"Ie\235\374\300\201\357\252\346\203e16\223C\275\202\240S\351\266"
+	.ascii	"\374\020\217~\211H\364PK\217\313\360\252\215\255\264\351Q\364"
+	.ascii	"\236\242\t\203q\374\"\035\214\363\241z\257\372\273'G\206\227"
+	.ascii	"\034\311\210\205\273\203]\316\217|\n\274\267\371\313\006n\016"
+	.ascii	"^r\242\247Gz\ti\312\210\216\336\325\220\272\252\271\354\200\023"
+	.ascii	"\204H\365NEz*\257F\371\362\232\234\334\321\371\274\371\004\251"
+	.ascii	"\334\223*t<\3678\257\320&\317\223\372\372\034OJ~\277>o\364\320"
+	.ascii	"\026\"\277\3317\301\027\350r\223^\213\013\2334t\370\362\n\274"
+	.ascii	"\263\031\275\253%\275[\237f\\\3013|i\023\223\004\035\274\007"
+	.ascii	"\267#\223+%\275y~\tF\275\2779\205\264\270'\365\330\276\345\032"
+	.ascii	"(\372>\036}\362\241\035\034\372f\217D\217|\350Q\351%\274q\342"
+	.ascii	"<B)rU\276<d\362]\315M\351\253\332\255\001\200\342\250A,\006\235"
+	.ascii	"\202fDDDD\232\244\2051`\002\031*\243\352\020XW\263I\322\0348"
+	.ascii	"\035(\377\331\301x:\326\357\234y\354\001\035gIcZ\330\315\307"
+	.ascii	"c6\222\004\362IE\345\353\375\"\344Dl\336)\205\231Z\334\373\302"
+	.ascii	"\345\237u$R\032|$\202\2508\2304\220W\202Z>\2056!\340\004\201"
+	.ascii	",\267\244\267\240\364\375\026\002\316\214\204\021:\374fI\330"
+	.ascii	"\221n\215\f\254\f\272\034aG-\355\353\270\006i7\020\366\265aN"
+	.ascii	"\2467y\301-\344L\004\266\335p\257\275\200DI\003u\211mT\027\201"
+	.ascii	"\372\363\245>\201\335\f\340\030+V\2256\032\225k\306\f\037\351"
+	.ascii	"B\203\030Z2\035h\323_\360\346\253\263\232\004\025\024\276\373"
+	.ascii	"\361\007!`\302\003\f\033\t\314\375\363\333\001(\037\036\362\260"
+	.ascii	"\261|a%Jij\355\311\023\0271\240\230\226\020\363\"5=\016\240\332"
+	.ascii	"\016\2201=\373T\233\313la$\251)\236\017\f\013:\0049=\310\330"
+	.ascii	"\315t\200\206D\301Hmx\211A\337\"\203\252m\331\316p!\366\256H"
+	.ascii	"\302\347a\374\313\274\324O\245\017u\342N6\227\334'\333f]\342"
+	.ascii	"\246\271\372\333\242\260\257\342\362\322k\370O7+\0130!\345A\377"
+	.ascii	"\360 %\276\250\242\003\245&\240\020B\241W`<}\314\004EbM\320\231"
+	.ascii	"%mTf:\377\216\262\242,\020\341RC8T\325R\0332\216vf\375\272\354"
+	.ascii	"m\013\313|\376\233\262`N\256\345E$HEq\213i/\266\301\017\303:"
+	.ascii	"\377Q\030\026\241\220?\301q+s\316\224\276\266f\323\013}'\036"
+	.ascii	"\016\214;\227\327\035k\361\366> 6\020\303\340q2\311\036o\267"
+	.ascii	"\177Q\374\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \235=\003"
+	.string	"\364\004\231"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001\177\016\355\241\346\035\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\017\301\204\001\002\177\020\210\256\217\005\002\003\177\021\275\201\351\025\001\005\177\022\377\037"
+	.string	""
+	.string	"\200\220\200\001\004\177\023\003\002\005D\003\002\004\210\256\217\005\001\344\027"
+	.string	"\b"
+	.ascii	"f\020\206O\221\n3\375)\030.{Zu\021\364\326\260\324\023"
+	.text
+	.section	.gnu.lto_.refs.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375 \031\311"
+	.string	""
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\022"
+	.string	""
+	.string	"\001\025"
+	.string	"\002\002"
+	.string	"\001\007"
+	.string	""
+	.string	"\0014"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3c0dd67fb357c269,"e",@progbits
+	.string	"(\265/\375`i\016\305I"
+	.ascii	"*\201\030\034TP\020\346\244\003\376\313_:\357\376\206\030\377"
+	.ascii	"\3314f\237\271\277\277h\310 w\037C\f\360\350\334g\004\347\225"
+	.ascii	"fU\345.\243v\2674\273\364W5\307D|\205\335\355\335n\220\273\240"
+	.ascii	"EE\367\361`\351r\300\367\017\017;\302\001G\376\245\312\335z2"
+	.ascii	"\371m\245L\001s\001\256\001\264\001\253\203\320w\207\035\223"
+	.ascii	"hL\033\247\206\006\r s\\w\271;9\224\300I\245j`=Q\302R\336\236"
+	.ascii	"\204\\"
+	.string	"\377m\303!&\313\310\031\034W'iO\215\021K\214\230q\375\0169\277\311]\333%\253\266qY\024|\251)\027\370\205\376!\025\273\266d\253\204\204\260\333\252jGL\215F\ft\335)\3336\331t\327\266\354k\266g\347\264;\331\335'N\364,\033\226\023\320\254\213\266L6\375\331\264o\222M\036&\230v\312Zufc\\\277\302\371\3751w\313\345\376\230\377\235&\226\307\254$\234m\363\305\353K\027\256\037\341\344\3351s\226\307\374w\354\337#\373\265b;\364\351\330e\335\251\316\216\006\22295\256\213do\330\264\304\206}H\305w@\261\364\253;\305\251\211\212\322:r\375\007g\315\320\027\354\002 [\305\371\374\2260w\271%\314\247\313c\236\273c\356\007\353\301v\260\034\234\347g\025s\377\207\3707\003\n\376\027\361\237\210\377Zv\305\004!\004q\003~\366\371O&\301\177\260\377a\377\021\370\377\363\237\304\177"
+	.string	"6\002\266\371\367\374\337\344\377\332\177'\377\353\317;\377:\360/\212\177\013\3707\347_\231\177\315\377u\377\273\374O\373O\367?\204\377^\376s\371\177\304\177\270\377o\377\237\374o\373\217\303\177\261\377\001\374w\373\017\263\\.\227\377R\375L\300O\203\025E\235N\305\246:\211\325\215\016\217@\016v\332\305\234\036\"\213g\007\225h\332D\235N\203\304m$\021-\013\002u\320$\022\210&\217E\0354E\026{\330\300s(\326=<\026u\212\244\310F\223\301b\016\232<\002wt\365\200\013@.\311\215\":l\250\002\212\f\217\30484=\356Z7\260\254\251\211\233v#\273\251\216>k\303-\340\2320\016*\3068L\201{\243\206\360\352(\223\n;\016\355:\0365u\003\3215\030"
+	.string	".0\355n\031-\004nwSJ\354\026\036K0\036w\212\fb\333\3640\370$\274:\3264\t\2172\272+\307\026\321\344\325Q\250\tY\222\253\205)p\271\032\b$\361L\002\323F\273{\267\330\030\221\366\003\035\2474kVf6\352\274\320\354\230\362%%\275\351\361\005V\245K\225\0334\"\022,.GT\033\224Th\\\351z\314\271,]\350\na%\312\225\255\262qY\365\313M\031\367o\017s;\304j\3318c5\002\247\354n\"v\313\032\261El\272s\213\345\233e\225\347\364{\366\357\224\271\245\262Un`\272\203o\\'zN\3000\241:\246\315h\371\327\207\225\262JJ\250W\204l\315\340z\356S"
+	.string	".9*\347\367\355\374\262\235&\266\312\277?\254\334\252\345"
+	.string	"\211\243\301u\201\020\372\0061\223\246<\022\3055g\321N&.\217y@\332\313cr\307\355\216\231byx\3709\207N\226|\301\275="
+	.ascii	"V\267\204\353\367\355_(\353\266Q\366\330=\354\356\001`\314lx"
+	.ascii	")ru\3223\003u\365\245\305\365i\367\356\230\001]W\236\206\340"
+	.ascii	"\312A\336Vc\244B\307\003H\035\236\273'\246:\037\251xk'\245\246"
+	.ascii	"\201b\035\005\201\033\017F\350\0325\002\3358eA\352\340q\336:"
+	.ascii	"\377\030R\361+\275\035dd\\\331\307\267\307\0262\224\006\326\002"
+	.ascii	"b\005\355\313\017'\367P\200\253\270\344\360\2225\223\345\303"
+	.ascii	"\017!\\y\337f\362\216_\341\032lB\252\270\262\216gA\013\313\242"
+	.ascii	"\302\332\301]I\021r\345\034\214\334\364n|\365\0336\031fnp\347"
+	.ascii	"[\330\273\231lu\236\341\227\221a\263\322\201|r\376\\\365\313"
+	.ascii	"\304\234\311\341\340jr~wv\356\322^x\201e\320\201V\341\2243\302"
+	.ascii	"n\234eh\333\3718{:\202+K\261\221f\352\350\246e\234\342(UNB\320"
+	.ascii	"\245\225\2705v\306\225c\260\001C\327Y\2618\335\211\211k\214 "
+	.ascii	"\211\fJ*3<UE\235\211X\352\334T\226.\206\212 \207)R\f\3055f\320"
+	.ascii	"\274\224A\350j\320"
+	.string	"!Y\035\327\247\305\002S\346\203\025\362\306\271\033\016\255\3272\2322\3123d\320\312EM\331D\252\004v8l8\371\300\001g\t\205\211\024\327\357\206'\214\333\320.\271\317\300\224\201\334t\246\035\265WP\244\350\350\332h\004b\037EX!\302.\234\233\336V\323M\242\202!8\302\270\362p\237\324.\262\032\334\270\262\360mg\335\215!_\270rp\307l\226\\\226I\256'B\246\306\320\344\310\033\331\371\363ov\220\330\335/\300\244\275&\254\371\302|\201~\233\335\355\001\275\233\353\346\3215gBAN\315q\375o\242\377\237\202n\020\320!\222\250\203&\203@\035\247\024YD\223\310I>_\005E0\277\242\241\005~\274\245\037\2410\241\207\244\364[\n\342\275`J2\352!\005)-1\005\t\220\224\304\324\353\371z1\277\"\036\013HKf\n>\245\243\237\257\027\003\243\005/\251\256\200\202Q\f^\f\363\207\324\343\240"
+	.ascii	"^\222\213\026!\004p\243\036\006FHJ\274\036\317\204\363\f\020"
+	.ascii	")@\264B\205\230\257`\221\202E\n\363+X\b\t\261 \022:O$\264\373"
+	.ascii	"-%\371\\\304Xa)f\251H\211wA\217\214\n\274\027=\016~KJH0f~=&\237"
+	.ascii	"\021\314\357G?\367\241\300S\n\372\371|JA4\277\"\"\241\223\367"
+	.ascii	"\302gT\227\212x/|\026l\300s\3643\241\307K2\177E+~=$\246\230\273"
+	.ascii	"0\032\"J\361\202\201\006P\220\270\003\016X`B\004\01748\215P\364"
+	.ascii	"Z\304\200\001\203\351\250H\005\237\213\023\214Z$\271\b\352!\265"
+	.ascii	"\210\021d\244\264\024\204\002\201\213\311LY1\262q\375\262Z\222"
+	.ascii	"[<\2702\332.\227^\320p\320\344\261;\310i\314\344\214\366\336"
+	.ascii	"\365\331\365\301)\341\351\352\311\254|\306l\306K\316g\\V3L\371"
+	.ascii	"\254v\007w}nv}`\332~\004\307\314\372j\203\354\254\344\374\003"
+	.ascii	"G\213T\016\034\\9\311I\210p\235\005\221\376\n\226 V\330n\340"
+	.ascii	"\312b<\206\223\305e\346\344Y\256$\342\320u\321U\t\333\212\201"
+	.ascii	":\322e\007\247\354\025\007\266\354\001\3063x\334\220#\nW>\302"
+	.ascii	"_\233\0021\022\231a\332I\031\271-UeN\347\027\310\304Y s\307\305"
+	.ascii	"u\266\201\213\275p\214\335O\275\033\266U\035\027M\230SX\017B"
+	.ascii	"\316^\347\"g\221!rA\256L\344\306\370\306\246\034\302ZAt$\211"
+	.ascii	"p\275\002bR\305\"W\356\n\201\f\250\2214f\0204FfFDD$M\222\016"
+	.ascii	"!\005\204 G\261\263\016\022\340F-\216\020$#4\223\024T\n\303\236"
+	.ascii	"\001\225\340i\227\273\357\267\330JMi\260~\205\357\215*\213d\""
+	.ascii	"\235\b:\021\350\341,h\016\256\304\266\355\333\034FzH\276\201"
+	.ascii	"QD\234\317\347\250\217\267\224\262\202\341vQgd\243\206\021\320"
+	.ascii	"\317\216\246\301\225T\205\352*\b(\3461\204\033\016\250d\221\022"
+	.ascii	"l\2624\243\374\362\334\243\274\246\003\300\377\207D\220\265<"
+	.ascii	"?\337\311Sgi\353t\342Q\027\241h\254\262>s\3509\321\360\033&\n"
+	.ascii	"\340`\242\235SC\345\215\207Q\3614&R\335\312\256\n\200\340\260"
+	.ascii	"\237D4V"
+	.string	"8t\"\320Q\2727R^\221\362I\223-\n\306\365M-\017\364\250F}\325\2762\233\274+\t\031\376\002I\017\354Y\314\034\204\263\303\365:\354Y\035\243\321&\267\004\320Hf\206\355XH\354(\2016\234\3621\027\220^\244\350\225a\355\227\245\200\324\370d\321\340NKF\030\240\320n\316\255\330\202\3231\\\013\350\343 \"\036Y\335\333\277\024$Qa\217\253n3\277\006\210\002ia\362\335\317\275\202\242j\0043\360\024Qc\22742\302r\250\037"
+	.string	"T\024\313K\320\244Q\3202\370\262+\232\306\020\316F\365\2507\203\212X0\240\256\031\337_\022L0\022\311\244\373\364\342\031\021\3642&\005\357:\001Gh\237\031\207L\2447\2012\006"
+	.ascii	"G\371\217\030T\243K\274$G\330\240+Ta8\356\350\001~/a&\351\240"
+	.ascii	"w\370>\240\330\320\0233\340D\330\340\223\240-\226\300 \377\n"
+	.ascii	"\274\352\246dy\224[0\2652B\242\353 .\b\330\317\262\211\356c\320"
+	.ascii	"j\037\b\307\245\0260\311\343\264@\362^0\277\226\375\263\215O"
+	.ascii	"2\2608BZ\261\334\331\356\217\270\212_\353x\300\030\373\303\351"
+	.ascii	"i@\327\211^\241\3734a\244\005\373P\334l\276\225;\253/\330K\351"
+	.ascii	"^\031#\325\022\333\177\320\255\2147\b,\306\267\313\240\f\227"
+	.ascii	"\306!\200Vk\006\377?p=\274\214\355\001\206\331\317T\001"
+	.text
+	.section	.gnu.lto_.symtab.3c0dd67fb357c269,"e",@progbits
+	.string	"blackboxHuffmanEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"blackboxHuffmanTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"blackboxHuffmanDecoderInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"blackboxHuffmanDecode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3c0dd67fb357c269,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10371 @@
+# 0 "./src/main/blackbox/blackbox_io.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define DEBUG 1
+# 0 "<command-line>"
+#define SIMULATOR_BUILD 1
+# 0 "<command-line>"
+#define FLASH_SIZE 2048
+# 0 "<command-line>"
+#define USE_STDPERIPH_DRIVER 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "inav"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "60f400f"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "./src/main/blackbox/blackbox_io.c"
+# 18 "./src/main/blackbox/blackbox_io.c"
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 25 "/usr/include/stdlib.h" 3 4
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+#define __need_size_t 
+#define __need_wchar_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+#define _STDLIB_H 1
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 3 4
+#define WNOHANG 1
+#define WUNTRACED 2
+
+
+
+#define WSTOPPED 2
+#define WEXITED 4
+#define WCONTINUED 8
+#define WNOWAIT 0x01000000
+
+
+#define __WNOTHREAD 0x20000000
+
+#define __WALL 0x40000000
+#define __WCLONE 0x80000000
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 3 4
+#define __WEXITSTATUS(status) (((status) & 0xff00) >> 8)
+
+
+#define __WTERMSIG(status) ((status) & 0x7f)
+
+
+#define __WSTOPSIG(status) __WEXITSTATUS(status)
+
+
+#define __WIFEXITED(status) (__WTERMSIG(status) == 0)
+
+
+#define __WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)
+
+
+
+#define __WIFSTOPPED(status) (((status) & 0xff) == 0x7f)
+
+
+
+
+#define __WIFCONTINUED(status) ((status) == __W_CONTINUED)
+
+
+
+#define __WCOREDUMP(status) ((status) & __WCOREFLAG)
+
+
+#define __W_EXITCODE(ret,sig) ((ret) << 8 | (sig))
+#define __W_STOPCODE(sig) ((sig) << 8 | 0x7f)
+#define __W_CONTINUED 0xffff
+#define __WCOREFLAG 0x80
+# 42 "/usr/include/stdlib.h" 2 3 4
+
+
+#define WEXITSTATUS(status) __WEXITSTATUS (status)
+#define WTERMSIG(status) __WTERMSIG (status)
+#define WSTOPSIG(status) __WSTOPSIG (status)
+#define WIFEXITED(status) __WIFEXITED (status)
+#define WIFSIGNALED(status) __WIFSIGNALED (status)
+#define WIFSTOPPED(status) __WIFSTOPPED (status)
+
+#define WIFCONTINUED(status) __WIFCONTINUED (status)
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 57 "/usr/include/stdlib.h" 2 3 4
+
+
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+#define __ldiv_t_defined 1
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+#define __lldiv_t_defined 1
+
+
+
+
+#define RAND_MAX 2147483647
+
+
+
+
+#define EXIT_FAILURE 1
+#define EXIT_SUCCESS 0
+
+
+
+#define MB_CUR_MAX (__ctype_get_mb_cur_max ())
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define _SYS_TYPES_H 1
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 30 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+#define __u_char_defined 
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+
+
+
+#define __ino_t_defined 
+
+
+
+
+
+
+
+typedef __dev_t dev_t;
+#define __dev_t_defined 
+
+
+
+typedef __gid_t gid_t;
+#define __gid_t_defined 
+
+
+
+typedef __mode_t mode_t;
+#define __mode_t_defined 
+
+
+
+typedef __nlink_t nlink_t;
+#define __nlink_t_defined 
+
+
+
+typedef __uid_t uid_t;
+#define __uid_t_defined 
+
+
+
+
+typedef __off_t off_t;
+
+
+
+#define __off_t_defined 
+
+
+
+
+
+
+
+typedef __pid_t pid_t;
+#define __pid_t_defined 
+
+
+
+
+typedef __id_t id_t;
+#define __id_t_defined 
+
+
+
+typedef __ssize_t ssize_t;
+#define __ssize_t_defined 
+
+
+
+
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+#define __daddr_t_defined 
+
+
+
+
+typedef __key_t key_t;
+#define __key_t_defined 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+#define __clock_t_defined 1
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+#define __clockid_t_defined 1
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+
+#define __time_t_defined 1
+
+
+
+
+
+
+
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+#define __timer_t_defined 1
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 143 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+
+
+
+
+
+
+#define __BIT_TYPES_DEFINED__ 1
+
+
+
+
+# 1 "/usr/include/endian.h" 1 3 4
+# 19 "/usr/include/endian.h" 3 4
+#define _ENDIAN_H 1
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define _BITS_ENDIAN_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define __LITTLE_ENDIAN 1234
+#define __BIG_ENDIAN 4321
+#define __PDP_ENDIAN 3412
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+
+#define _BITS_ENDIANNESS_H 1
+
+
+
+
+
+
+#define __BYTE_ORDER __LITTLE_ENDIAN
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+
+
+
+
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+
+
+
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+# 25 "/usr/include/endian.h" 2 3 4
+
+
+#define LITTLE_ENDIAN __LITTLE_ENDIAN
+#define BIG_ENDIAN __BIG_ENDIAN
+#define PDP_ENDIAN __PDP_ENDIAN
+#define BYTE_ORDER __BYTE_ORDER
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+#define _BITS_BYTESWAP_H 1
+
+
+
+
+
+#define __bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))
+
+
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+
+
+#define __bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56) | (((x) & 0x00ff000000000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+#define _BITS_UINTN_IDENTITY_H 1
+
+
+
+
+
+
+
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+
+
+#define htobe16(x) __bswap_16 (x)
+#define htole16(x) __uint16_identity (x)
+#define be16toh(x) __bswap_16 (x)
+#define le16toh(x) __uint16_identity (x)
+
+#define htobe32(x) __bswap_32 (x)
+#define htole32(x) __uint32_identity (x)
+#define be32toh(x) __bswap_32 (x)
+#define le32toh(x) __uint32_identity (x)
+
+#define htobe64(x) __bswap_64 (x)
+#define htole64(x) __uint64_identity (x)
+#define be64toh(x) __bswap_64 (x)
+#define le64toh(x) __uint64_identity (x)
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+#define _SYS_SELECT_H 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/select.h" 3 4
+#define __FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)
+
+
+
+
+
+
+#define __FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))
+
+#define __FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))
+
+#define __FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+#define __sigset_t_defined 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+#define ____sigset_t_defined 
+
+#define _SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+#define __timeval_defined 1
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+
+
+#define _STRUCT_TIMESPEC 1
+
+
+
+
+
+
+
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+#define __suseconds_t_defined 
+
+
+
+
+typedef long int __fd_mask;
+
+
+#undef __NFDBITS
+
+#define __NFDBITS (8 * (int) sizeof (__fd_mask))
+#define __FD_ELT(d) ((d) / __NFDBITS)
+#define __FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))
+
+
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+#define __FDS_BITS(set) ((set)->__fds_bits)
+
+  } fd_set;
+
+
+#define FD_SETSIZE __FD_SETSIZE
+
+
+
+typedef __fd_mask fd_mask;
+
+
+#define NFDBITS __NFDBITS
+
+
+
+
+#define FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)
+#define FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)
+#define FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)
+#define FD_ZERO(fdsetp) __FD_ZERO (fdsetp)
+
+
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+#define __blksize_t_defined 
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+#define __blkcnt_t_defined 
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+#define __fsblkcnt_t_defined 
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+#define __fsfilcnt_t_defined 
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+#define _BITS_PTHREADTYPES_COMMON_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+#define _THREAD_SHARED_TYPES_H 1
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define _BITS_PTHREADTYPES_ARCH_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+
+
+
+#define __SIZEOF_PTHREAD_MUTEX_T 40
+#define __SIZEOF_PTHREAD_ATTR_T 56
+#define __SIZEOF_PTHREAD_RWLOCK_T 56
+#define __SIZEOF_PTHREAD_BARRIER_T 32
+# 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+#define __SIZEOF_PTHREAD_MUTEXATTR_T 4
+#define __SIZEOF_PTHREAD_COND_T 48
+#define __SIZEOF_PTHREAD_CONDATTR_T 4
+#define __SIZEOF_PTHREAD_RWLOCKATTR_T 8
+#define __SIZEOF_PTHREAD_BARRIERATTR_T 4
+
+#define __LOCK_ALIGNMENT 
+#define __ONCE_ALIGNMENT 
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+#define _BITS_ATOMIC_WIDE_COUNTER_H 
+
+
+
+
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+#define _THREAD_MUTEX_INTERNAL_H 1
+
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+#define __PTHREAD_MUTEX_HAVE_PREV 1
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+
+
+#define __PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+#define _RWLOCK_INTERNAL_H 
+
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+#define __PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+
+
+#define __PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+
+#define __ONCE_FLAG_INIT { 0 }
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+#define __have_pthread_attr_t 1
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 19 "/usr/include/alloca.h" 3 4
+#define _ALLOCA_H 1
+
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+#undef alloca
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+#define alloca(size) __builtin_alloca (size)
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 611 "/usr/include/stdlib.h" 3 4
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 630 "/usr/include/stdlib.h" 3 4
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+# 649 "/usr/include/stdlib.h" 3 4
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+#define __COMPAR_FN_T 
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 19 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+#define _STDARG_H 
+#define _ANSI_STDARG_H_ 
+
+#undef __need___va_list
+
+
+
+
+#define __GNUC_VA_LIST 
+typedef __builtin_va_list __gnuc_va_list;
+
+
+
+
+
+
+#define va_start(v,l) __builtin_va_start(v,l)
+#define va_end(v) __builtin_va_end(v)
+#define va_arg(v,l) __builtin_va_arg(v,l)
+
+
+#define va_copy(d,s) __builtin_va_copy(d,s)
+
+#define __va_copy(d,s) __builtin_va_copy(d,s)
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+
+
+
+
+
+#define _VA_LIST_ 
+
+
+#define _VA_LIST 
+
+
+#define _VA_LIST_DEFINED 
+
+
+#define _VA_LIST_T_H 
+
+
+#define __va_list__ 
+# 20 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 21 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 63 "./src/main/platform.h"
+# 1 "./src/main/target/common.h" 1
+# 18 "./src/main/target/common.h"
+       
+
+
+
+
+#define DYNAMIC_HEAP_SIZE 2048
+
+
+#define I2C1_OVERCLOCK false
+#define I2C2_OVERCLOCK false
+#define USE_I2C_PULLUP 
+
+#define USE_RX_PPM 
+#define USE_SERIAL_RX 
+#define USE_SERIALRX_SPEKTRUM 
+#define USE_SERIALRX_SBUS 
+#define USE_SERIALRX_IBUS 
+#define USE_SERIALRX_FPORT 
+
+#define COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)
+# 56 "./src/main/target/common.h"
+#define USE_ADC_AVERAGING 
+#define USE_64BIT_TIME 
+#define USE_BLACKBOX 
+#define USE_GPS 
+#define USE_GPS_PROTO_UBLOX 
+#define USE_NAV 
+#define USE_TELEMETRY 
+#define USE_TELEMETRY_LTM 
+#define USE_TELEMETRY_FRSKY 
+
+
+
+
+#define SCHEDULER_DELAY_LIMIT 100
+
+
+
+#define USE_MR_BRAKING_MODE 
+#define USE_PITOT 
+#define USE_PITOT_ADC 
+#define USE_PITOT_VIRTUAL 
+
+#define USE_DYNAMIC_FILTERS 
+#define USE_GYRO_KALMAN 
+#define USE_EXTENDED_CMS_MENUS 
+#define USE_UAV_INTERCONNECT 
+#define USE_RX_UIB 
+#define USE_HOTT_TEXTMODE 
+
+
+#define USE_GPS_PROTO_NAZA 
+
+
+#define USE_RANGEFINDER 
+#define USE_RANGEFINDER_MSP 
+#define USE_RANGEFINDER_BENEWAKE 
+#define USE_RANGEFINDER_VL53L0X 
+#define USE_RANGEFINDER_HCSR04_I2C 
+
+
+#define USE_OPFLOW 
+#define USE_OPFLOW_CXOF 
+#define USE_OPFLOW_MSP 
+
+#define USE_PITOT 
+#define USE_PITOT_MS4525 
+
+#define USE_1WIRE 
+#define USE_1WIRE_DS2482 
+
+#define USE_TEMPERATURE_SENSOR 
+#define USE_TEMPERATURE_LM75 
+#define USE_TEMPERATURE_DS18B20 
+
+#define USE_MSP_DISPLAYPORT 
+#define USE_DASHBOARD 
+#define DASHBOARD_ARMED_BITMAP 
+#define USE_OLED_UG2864 
+
+#define USE_PWM_DRIVER_PCA9685 
+
+#define USE_TELEMETRY_SIM 
+#define USE_FRSKYOSD 
+#define USE_DJI_HD_OSD 
+
+#define NAV_NON_VOLATILE_WAYPOINT_CLI 
+
+#define NAV_AUTO_MAG_DECLINATION_PRECISE 
+
+#define USE_D_BOOST 
+#define USE_ANTIGRAVITY 
+
+
+
+
+
+
+#define NAV_FIXED_WING_LANDING 
+#define USE_AUTOTUNE_FIXED_WING 
+#define USE_LOG 
+#define USE_STATS 
+#define USE_CMS 
+#define CMS_MENU_OSD 
+#define USE_GPS_PROTO_NMEA 
+#define USE_GPS_PROTO_MTK 
+#define NAV_GPS_GLITCH_DETECTION 
+#define NAV_NON_VOLATILE_WAYPOINT_STORAGE 
+#define USE_TELEMETRY_HOTT 
+#define USE_TELEMETRY_IBUS 
+#define USE_TELEMETRY_MAVLINK 
+#define USE_TELEMETRY_SMARTPORT 
+#define USE_TELEMETRY_CRSF 
+#define USE_MSP_OVER_TELEMETRY 
+
+#define USE_RX_MSP 
+
+#define USE_SERIALRX_SUMD 
+#define USE_SERIALRX_SUMH 
+#define USE_SERIALRX_XBUS 
+#define USE_SERIALRX_JETIEXBUS 
+#define USE_SERIALRX_CRSF 
+#define USE_PWM_SERVO_DRIVER 
+#define USE_SERIAL_PASSTHROUGH 
+#define NAV_MAX_WAYPOINTS 60
+#define USE_RCDEVICE 
+
+
+#define USE_VTX_CONTROL 
+#define USE_VTX_SMARTAUDIO 
+#define USE_VTX_TRAMP 
+#define USE_VTX_FFPV 
+
+
+#define USE_LOGIC_CONDITIONS 
+#define USE_GLOBAL_FUNCTIONS 
+#define USE_CLI_BATCH 
+
+
+
+#define RTC_AUTOMATIC_DST 
+
+#define USE_WIND_ESTIMATOR 
+# 64 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 25 "./src/main/target/SITL/target.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 28 "./src/main/target/SITL/target.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 29 "./src/main/target/SITL/target.h" 2
+
+
+
+
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+#define USBD_PRODUCT_STRING "SITL"
+
+#define USE_IMU_FAKE 
+#define USE_FAKE_BARO 
+#define USE_FAKE_MAG 
+#define USE_FAKE_GPS 
+
+#define USE_MAG 
+#define USE_BARO 
+
+#define USE_UART1 
+#define USE_UART2 
+#define USE_UART3 
+#define USE_UART4 
+#define USE_UART5 
+#define USE_UART6 
+#define USE_UART7 
+#define USE_UART8 
+#define SERIAL_PORT_COUNT 8
+
+#define DEFAULT_RX_TYPE RX_TYPE_MSP
+#define DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)
+
+#define MAX_PWM_OUTPUT_PORTS 16
+
+#define TARGET_IO_PORTA 0xffff
+#define TARGET_IO_PORTB 0xffff
+#define TARGET_IO_PORTC 0xffff
+
+
+#undef USE_DYNAMIC_FILTERS
+#undef USE_USB_MSC
+#undef USE_SERVO_SBUS
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+#undef USE_PWM_DRIVER_PCA9685
+#undef USE_PWM_SERVO_DRIVER
+#undef USE_RANGEFINDER
+#undef USE_RANGEFINDER_VL53L0X
+#undef USE_RANGEFINDER_HCSR04_I2C
+#undef USE_PITOT_MS4525
+#undef USE_PITOT_ADC
+#undef USE_1WIRE
+#undef USE_1WIRE_DS2482
+#undef USE_TEMPERATURE_SENSOR
+#undef USE_TEMPERATURE_LM75
+#undef USE_TEMPERATURE_DS18B20
+#undef USE_ADC
+#undef USE_VCP
+#undef USE_RX_PPM
+#undef USE_SERIALRX_SPEKTRUM
+#undef USE_RCDEVICE
+#undef USE_SERIAL_PASSTHROUGH
+#undef USE_ITCM_RAM
+
+#define SKIP_CLI_RESOURCES 
+
+
+#define USE_GYRO_STAGE_PROBE 
+
+
+#define U_ID_0 0
+#define U_ID_1 1
+#define U_ID_2 2
+
+
+
+# 101 "./src/main/target/SITL/target.h"
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct { void *test; } GPIO_TypeDef;
+typedef struct { void *test; } TIM_TypeDef;
+typedef struct { void *test; } SPI_TypeDef;
+typedef struct { void *test; } I2C_TypeDef;
+typedef struct { void *test; } USART_TypeDef;
+typedef struct { void *test; } DMA_Stream_TypeDef;
+typedef struct { void *test; } DMA_Channel_TypeDef;
+typedef uint32_t DMA_TypeDef;
+
+#define USART1 ((USART_TypeDef *)0x0001)
+#define USART2 ((USART_TypeDef *)0x0002)
+#define USART3 ((USART_TypeDef *)0x0003)
+#define UART4 ((USART_TypeDef *)0x0004)
+#define UART5 ((USART_TypeDef *)0x0005)
+#define USART6 ((USART_TypeDef *)0x0006)
+#define UART7 ((USART_TypeDef *)0x0007)
+#define UART8 ((USART_TypeDef *)0x0008)
+
+#define __NVIC_PRIO_BITS 4
+static inline void __set_BASEPRI(uint32_t basePri) { (void)basePri; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri) { (void)basePri; }
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __NOP(void) {}
+#define __NOINLINE __attribute__((noinline))
+
+extern uint32_t SystemCoreClock;
+
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+# 65 "./src/main/platform.h" 2
+# 1 "./src/main/target/sanity_check.h" 1
+# 25 "./src/main/target/sanity_check.h"
+       
+# 66 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 20 "./src/main/target/common_post.h"
+       
+
+
+
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+# 46 "./src/main/target/common_post.h"
+#define FAST_CODE 
+#define NOINLINE 
+# 61 "./src/main/target/common_post.h"
+#undef USE_DYNAMIC_FILTERS
+
+
+
+
+#define FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize("-Os")))
+#define FUNCTION_COMPILE_NORMAL __attribute__((optimize("-O2")))
+#define FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize("-Ofast")))
+#define FILE_COMPILE_FOR_SIZE _Pragma("GCC optimize(\"Os\")")
+#define FILE_COMPILE_NORMAL _Pragma("GCC optimize(\"O2\")")
+#define FILE_COMPILE_FOR_SPEED _Pragma("GCC optimize(\"Ofast\")")
+# 67 "./src/main/platform.h" 2
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+# 23 "./src/main/blackbox/blackbox_io.c" 2
+
+
+
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 18 "./src/main/blackbox/blackbox.h"
+       
+
+# 1 "./src/main/blackbox/blackbox_fielddefs.h" 1
+# 18 "./src/main/blackbox/blackbox_fielddefs.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 22 "./src/main/blackbox/blackbox_fielddefs.h" 2
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/config/parameter_group.h" 1
+# 18 "./src/main/config/parameter_group.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+# 29 "./src/main/build/build_config.h"
+#define STATIC_UNIT_TESTED static
+#define STATIC_INLINE_UNIT_TESTED static inline
+#define INLINE_UNIT_TESTED inline
+#define UNIT_TESTED 
+
+
+
+
+
+#define REQUIRE_CC_ARM_PRINTF_SUPPORT 
+#define REQUIRE_PRINTF_LONG_SUPPORT 
+
+
+
+
+
+#define FASTRAM __attribute__ ((section(".fastram_bss"), aligned(4)))
+
+
+
+
+
+#define EXTENDED_FASTRAM 
+
+
+#define STATIC_FASTRAM static FASTRAM
+#define STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM
+# 24 "./src/main/config/parameter_group.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000,
+    PGR_SIZE_PROFILE_FLAG = 0x8000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgIsSystem(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == 0;}
+static inline uint16_t pgIsProfile(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == PGR_SIZE_PROFILE_FLAG;}
+
+#define PG_PACKED __attribute__((packed))
+# 75 "./src/main/config/parameter_group.h"
+extern const pgRegistry_t __pg_registry_start[] __asm("__start_pg_registry");
+extern const pgRegistry_t __pg_registry_end[] __asm("__stop_pg_registry");
+#define PG_REGISTER_ATTRIBUTES __attribute__ ((section("pg_registry"), used, aligned(4)))
+
+extern const uint8_t __pg_resetdata_start[] __asm("__start_pg_resetdata");
+extern const uint8_t __pg_resetdata_end[] __asm("__stop_pg_resetdata");
+#define PG_RESETDATA_ATTRIBUTES __attribute__ ((section("pg_resetdata"), used, aligned(2)))
+# 92 "./src/main/config/parameter_group.h"
+#define PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)
+
+
+#define PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)
+
+
+#define PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else
+# 107 "./src/main/config/parameter_group.h"
+#define PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)
+
+
+
+
+
+
+
+#define PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy
+# 124 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _SystemArray[_size]; extern _type _name ## _CopyArray[_size]; static inline const _type* _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy
+# 134 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy
+# 143 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name ## _System; _type _name ## _Copy; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }
+# 158 "./src/main/config/parameter_group.h"
+#define PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })
+
+
+
+
+#define PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+#define PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) _type _name ## _SystemArray[_size]; _type _name ## _CopyArray[_size]; extern const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }
+# 187 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+# 208 "./src/main/config/parameter_group.h"
+#define _PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;
+
+
+
+
+#define PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STATIC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; STATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_COUNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }
+# 228 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+
+
+#define PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }
+
+
+
+
+
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, int profileIndex, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size, uint8_t profileIndex);
+void pgResetAll(int profileCount);
+void pgResetCurrent(const pgRegistry_t *reg);
+
+# 257 "./src/main/config/parameter_group.h" 3 4
+_Bool 
+# 257 "./src/main/config/parameter_group.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg, int profileIndex);
+void pgActivateProfile(int profileIndex);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+typedef uint64_t timeUs_t;
+#define TIMEUS_MAX UINT64_MAX
+
+
+
+
+
+
+#define MILLISECS_PER_SEC 1000
+#define USECS_PER_SEC (1000 * 1000)
+
+#define HZ2US(hz) (1000000 / (hz))
+#define US2S(us) ((us) * 1e-6f)
+#define US2MS(us) ((us) * 1e-3f)
+#define MS2US(ms) ((ms) * 1000)
+#define MS2S(ms) ((ms) * 1e-3f)
+#define HZ2S(hz) US2S(HZ2US(hz))
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+typedef enum {
+    TZ_AUTO_DST_OFF,
+    TZ_AUTO_DST_EU,
+    TZ_AUTO_DST_USA,
+} tz_automatic_dst_e;
+
+typedef struct timeConfig_s {
+    int16_t tz_offset;
+    uint8_t tz_automatic_dst;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+#define FORMATTED_DATE_TIME_BUFSIZE 30
+
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *localDateTime, const dateTime_t *utcDateTime);
+
+
+
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 104 "./src/main/common/time.h" 3 4
+_Bool 
+# 104 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 105 "./src/main/common/time.h" 3 4
+_Bool 
+# 105 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 107 "./src/main/common/time.h" 3 4
+_Bool 
+# 107 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 108 "./src/main/common/time.h" 3 4
+_Bool 
+# 108 "./src/main/common/time.h"
+    rtcGetDateTimeLocal(dateTime_t *dt);
+
+# 109 "./src/main/common/time.h" 3 4
+_Bool 
+# 109 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 24 "./src/main/blackbox/blackbox_fielddefs.h" 2
+
+typedef enum FlightLogFieldCondition {
+    FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
+    FLIGHT_LOG_FIELD_CONDITION_SERVOS,
+
+    FLIGHT_LOG_FIELD_CONDITION_MAG,
+    FLIGHT_LOG_FIELD_CONDITION_BARO,
+    FLIGHT_LOG_FIELD_CONDITION_PITOT,
+    FLIGHT_LOG_FIELD_CONDITION_VBAT,
+    FLIGHT_LOG_FIELD_CONDITION_AMPERAGE,
+    FLIGHT_LOG_FIELD_CONDITION_SURFACE,
+    FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_MC_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_RSSI,
+
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2,
+
+    FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME,
+
+    FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+
+    FLIGHT_LOG_FIELD_CONDITION_NEVER,
+
+    FLIGHT_LOG_FIELD_CONDITION_FIRST = FLIGHT_LOG_FIELD_CONDITION_ALWAYS,
+    FLIGHT_LOG_FIELD_CONDITION_LAST = FLIGHT_LOG_FIELD_CONDITION_NEVER
+} FlightLogFieldCondition;
+
+typedef enum FlightLogFieldPredictor {
+
+    FLIGHT_LOG_FIELD_PREDICTOR_0 = 0,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS = 1,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE = 2,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2 = 3,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE = 4,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0 = 5,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_INC = 6,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD = 7,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_1500 = 8,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_VBATREF = 9,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10
+
+} FlightLogFieldPredictor;
+
+typedef enum FlightLogFieldEncoding {
+    FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB = 0,
+    FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB = 1,
+    FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT = 3,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB = 6,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32 = 7,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 = 8,
+    FLIGHT_LOG_FIELD_ENCODING_NULL = 9
+} FlightLogFieldEncoding;
+
+typedef enum FlightLogFieldSign {
+    FLIGHT_LOG_FIELD_UNSIGNED = 0,
+    FLIGHT_LOG_FIELD_SIGNED = 1
+} FlightLogFieldSign;
+
+typedef enum FlightLogCompression {
+    FLIGHT_LOG_COMPRESSION_NONE = 0,
+    FLIGHT_LOG_COMPRESSION_HUFFMAN = 1
+} FlightLogCompression;
+
+
+#define FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_IMU_FAILURE = 40,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct flightLogEvent_syncBeep_s {
+    uint32_t time;
+} flightLogEvent_syncBeep_t;
+
+typedef struct flightLogEvent_flightMode_s {
+    uint32_t flags;
+    uint32_t lastFlags;
+} flightLogEvent_flightMode_t;
+
+typedef struct flightLogEvent_inflightAdjustment_s {
+    uint8_t adjustmentFunction;
+    
+# 140 "./src/main/blackbox/blackbox_fielddefs.h" 3 4
+   _Bool 
+# 140 "./src/main/blackbox/blackbox_fielddefs.h"
+        floatFlag;
+    int32_t newValue;
+    float newFloatValue;
+} flightLogEvent_inflightAdjustment_t;
+
+typedef struct flightLogEvent_loggingResume_s {
+    uint32_t logIteration;
+    timeUs_t currentTimeUs;
+} flightLogEvent_loggingResume_t;
+
+typedef struct flightLogEvent_IMUError_s {
+    uint32_t errorCode;
+} flightLogEvent_IMUError_t;
+
+#define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
+
+typedef union flightLogEventData_u {
+    flightLogEvent_syncBeep_t syncBeep;
+    flightLogEvent_flightMode_t flightMode;
+    flightLogEvent_inflightAdjustment_t inflightAdjustment;
+    flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_IMUError_t imuError;
+} flightLogEventData_t;
+
+typedef struct flightLogEvent_s {
+    FlightLogEvent event;
+    flightLogEventData_t data;
+} flightLogEvent_t;
+# 21 "./src/main/blackbox/blackbox.h" 2
+
+
+
+typedef struct blackboxConfig_s {
+    uint16_t rate_num;
+    uint16_t rate_denom;
+    uint8_t device;
+    uint8_t invertedCardDetection;
+    uint8_t compression;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxProcess(timeUs_t currentTimeUs);
+void blackboxStart(void);
+void blackboxFinish(void);
+
+# 41 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 41 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+uint32_t blackboxGetSnapshotsDropped(void);
+# 27 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/blackbox/blackbox_io.h" 1
+# 18 "./src/main/blackbox/blackbox_io.h"
+       
+
+
+
+
+
+
+typedef enum BlackboxDevice {
+    BLACKBOX_DEVICE_SERIAL = 0,
+# 35 "./src/main/blackbox/blackbox_io.h"
+    BLACKBOX_DEVICE_END
+} BlackboxDevice;
+
+typedef enum {
+    BLACKBOX_RESERVE_SUCCESS,
+    BLACKBOX_RESERVE_TEMPORARY_FAILURE,
+    BLACKBOX_RESERVE_PERMANENT_FAILURE
+} blackboxBufferReserveStatus_e;
+
+
+
+
+
+#define BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256
+
+
+
+
+
+#define BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64
+
+
+
+
+
+
+#define BLACKBOX_WRITE_BUFFER_SIZE 256
+
+typedef struct blackboxWriteBuffer_s {
+    uint32_t flushedBytes;
+    uint16_t length;
+    uint8_t data[256];
+} blackboxWriteBuffer_t;
+
+extern int32_t blackboxHeaderBudget;
+extern blackboxWriteBuffer_t blackboxWriteBuffer;
+
+void blackboxOpen(void);
+void blackboxWriteBufferFlush(void);
+void blackboxWriteBuf(const uint8_t *data, int count);
+
+
+static inline uint32_t blackboxWriteBufferPosition(void)
+{
+    return blackboxWriteBuffer.flushedBytes + blackboxWriteBuffer.length;
+}
+
+static inline void blackboxWrite(uint8_t value)
+{
+    if (blackboxWriteBuffer.length == 256) {
+        blackboxWriteBufferFlush();
+    }
+    blackboxWriteBuffer.data[blackboxWriteBuffer.length++] = value;
+}
+
+void blackboxDeviceFlush(void);
+
+# 91 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 91 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceFlushForce(void);
+
+# 92 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 92 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceOpen(void);
+void blackboxDeviceClose(void);
+
+
+# 95 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 95 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceBeginLog(void);
+
+# 96 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 96 "./src/main/blackbox/blackbox_io.h"
+    blackboxDeviceEndLog(
+# 96 "./src/main/blackbox/blackbox_io.h" 3 4
+                         _Bool 
+# 96 "./src/main/blackbox/blackbox_io.h"
+                              retainLog);
+
+
+# 98 "./src/main/blackbox/blackbox_io.h" 3 4
+_Bool 
+# 98 "./src/main/blackbox/blackbox_io.h"
+    isBlackboxDeviceFull(void);
+
+void blackboxReplenishHeaderBudget(void);
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes);
+# 28 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/common/axis.h" 1
+# 18 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+#define XYZ_AXIS_COUNT 3
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+#define FLIGHT_DYNAMICS_INDEX_COUNT 3
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH,
+} angle_index_t;
+
+#define ANGLE_INDEX_COUNT 2
+# 30 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/common/encoding.h" 1
+# 18 "./src/main/common/encoding.h"
+       
+
+
+
+uint32_t castFloatBytesToInt(float f);
+uint32_t zigzagEncode(int32_t value);
+# 31 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/common/maths.h" 1
+# 18 "./src/main/common/maths.h"
+       
+
+
+
+
+
+#define sq(x) ((x)*(x))
+
+
+
+#define FAST_MATH 
+
+
+
+#define M_PIf 3.14159265358979323846f
+#define M_LN2f 0.69314718055994530942f
+#define M_Ef 2.71828182845904523536f
+
+#define RAD (M_PIf / 180.0f)
+
+#define DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)
+#define CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)
+
+#define CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)
+#define DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)
+
+#define DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)
+#define DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)
+
+#define DEGREES_PER_DEKADEGREE 10
+#define DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)
+#define DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)
+
+#define DEGREES_TO_RADIANS(angle) ((angle) * RAD)
+#define RADIANS_TO_DEGREES(angle) ((angle) / RAD)
+#define DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)
+#define RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)
+
+#define RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)
+#define CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)
+
+#define CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))
+#define CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))
+#define CENTIMETERS_TO_METERS(cm) (cm / 100)
+
+#define METERS_TO_CENTIMETERS(m) (m * 100)
+
+
+#define _CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))
+
+
+
+
+
+#define _CHOOSE_VAR2(prefix,unique) prefix ##unique
+#define _CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)
+#define _CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )
+
+
+
+
+
+#define MIN(a,b) _CHOOSE(<, a, b)
+#define MAX(a,b) _CHOOSE(>, a, b)
+
+#define _ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))
+
+
+
+
+#define _ABS_I(x,var) _ABS_II(x, var)
+#define ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+typedef struct filterWithBufferSample_s {
+    float value;
+    uint32_t timestamp;
+} filterWithBufferSample_t;
+
+typedef struct filterWithBufferState_s {
+    uint16_t filter_size;
+    uint16_t sample_index;
+    filterWithBufferSample_t * samples;
+} filterWithBufferState_t;
+
+typedef struct {
+    float XtY[4];
+    float XtX[4][4];
+} sensorCalibrationState_t;
+
+void sensorCalibrationResetState(sensorCalibrationState_t * state);
+void sensorCalibrationPushSampleForOffsetCalculation(sensorCalibrationState_t * state, int32_t sample[3]);
+void sensorCalibrationPushSampleForScaleCalculation(sensorCalibrationState_t * state, int axis, int32_t sample[3], int target);
+
+# 128 "./src/main/common/maths.h" 3 4
+_Bool 
+# 128 "./src/main/common/maths.h"
+    sensorCalibrationSolveForOffset(sensorCalibrationState_t * state, float result[3]);
+
+# 129 "./src/main/common/maths.h" 3 4
+_Bool 
+# 129 "./src/main/common/maths.h"
+    sensorCalibrationSolveForScale(sensorCalibrationState_t * state, float result[3]);
+
+int gcd(int num, int denom);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadbandf(float value, float deadband);
+
+int constrain(int amt, int low, int high);
+float constrainf(float amt, float low, float high);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+float scaleRangef(float x, float srcMin, float srcMax, float destMin, float destMax);
+
+int32_t wrap_18000(int32_t angle);
+int32_t wrap_36000(int32_t angle);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+int16_t quickMedianFilter3_16(int16_t * v);
+int16_t quickMedianFilter5_16(int16_t * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+#define tan_approx(x) (sin_approx(x) / cos_approx(x))
+#define asin_approx(x) (M_PIf / 2 - acos_approx(x))
+# 174 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+float bellCurve(const float x, const float curveWidth);
+# 32 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/common/printf.h" 1
+# 106 "./src/main/common/printf.h"
+#define __TFP_PRINTF__ 
+
+
+
+void init_printf(void *putp, void (*putf) (void *, char));
+
+int tfp_printf(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+int tfp_sprintf(char *s, const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+int tfp_snprintf(char *s, int size, const char *fmt, ...) __attribute__ ((format (printf, 3, 4)));
+int tfp_vsprintf(char *s, const char *fmt, va_list va) __attribute__ ((format (printf, 2, 0)));
+int tfp_vsnprintf(char *s, int size, const char *fmt, va_list va) __attribute__ ((format (printf, 3, 0)));
+
+int tfp_format(void *putp, void (*putf) (void *, char), const char *fmt, va_list va);
+int tfp_nformat(void *putp, int n, void (*putf) (void *, char), const char *fmt, va_list va);
+
+void printfSupportInit(void);
+struct serialPort_s;
+void setPrintfSerialPort(struct serialPort_s *serialPort);
+# 33 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/common/typeconversion.h" 1
+# 17 "./src/main/common/typeconversion.h"
+       
+
+#define FTOA_BUFFER_SIZE 13
+
+void uli2a(unsigned long int num, unsigned int base, int uc, char *bf);
+void li2a(long num, char *bf);
+void ui2a(unsigned int num, unsigned int base, int uc, char *bf);
+void i2a(int num, char *bf);
+int a2d(char ch);
+char a2i(char ch, const char **src, int base, int *nump);
+char *ftoa(float x, char *floatString);
+float fastA2F(const char *p);
+unsigned long int fastA2UL(const char *p);
+int fastA2I(const char *s);
+
+
+char *itoa(int i, char *a, int r);
+# 34 "./src/main/blackbox/blackbox_io.c" 2
+
+
+# 1 "./src/main/config/parameter_group_ids.h" 1
+# 19 "./src/main/config/parameter_group_ids.h"
+#define PG_CF_START 1
+#define PG_FAILSAFE_CONFIG 1
+#define PG_BOARD_ALIGNMENT 2
+
+#define PG_MOTOR_MIXER 4
+#define PG_BLACKBOX_CONFIG 5
+#define PG_MOTOR_CONFIG 6
+
+
+
+#define PG_GYRO_CONFIG 10
+#define PG_BATTERY_PROFILES 11
+#define PG_CONTROL_RATE_PROFILES 12
+#define PG_SERIAL_CONFIG 13
+#define PG_PID_PROFILE 14
+
+#define PG_ARMING_CONFIG 16
+
+#define PG_SYSTEM_CONFIG 18
+#define PG_FEATURE_CONFIG 19
+#define PG_MIXER_CONFIG 20
+#define PG_SERVO_MIXER 21
+#define PG_IMU_CONFIG 22
+
+#define PG_RX_CONFIG 24
+#define PG_RC_CONTROLS_CONFIG 25
+#define PG_REVERSIBLE_MOTORS_CONFIG 26
+#define PG_LED_STRIP_CONFIG 27
+
+
+#define PG_GPS_CONFIG 30
+#define PG_TELEMETRY_CONFIG 31
+
+
+
+#define PG_ACCELEROMETER_CONFIG 35
+
+
+#define PG_ADJUSTMENT_RANGE_CONFIG 37
+#define PG_BAROMETER_CONFIG 38
+
+#define PG_COMPASS_CONFIG 40
+#define PG_MODE_ACTIVATION_PROFILE 41
+
+#define PG_SERVO_PARAMS 42
+
+#define PG_RX_CHANNEL_RANGE_CONFIG 44
+#define PG_BATTERY_METERS_CONFIG 45
+
+
+
+
+
+
+
+#define PG_SERVO_CONFIG 52
+
+#define PG_VTX_CONFIG 54
+#define PG_ELERES_CONFIG 55
+#define PG_TEMP_SENSOR_CONFIG 56
+#define PG_CF_END 56
+
+
+
+
+
+
+#define PG_VTX_SETTINGS_CONFIG 259
+
+
+#define PG_INAV_START 1000
+#define PG_PITOTMETER_CONFIG 1000
+#define PG_POSITION_ESTIMATION_CONFIG 1001
+#define PG_NAV_CONFIG 1002
+#define PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003
+#define PG_OSD_CONFIG 1004
+#define PG_BEEPER_CONFIG 1005
+#define PG_RANGEFINDER_CONFIG 1006
+#define PG_WAYPOINT_MISSION_STORAGE 1007
+#define PG_PID_AUTOTUNE_CONFIG 1008
+#define PG_STATS_CONFIG 1009
+#define PG_ADC_CHANNEL_CONFIG 1010
+#define PG_TIME_CONFIG 1011
+#define PG_OPFLOW_CONFIG 1012
+#define PG_DISPLAY_CONFIG 1013
+#define PG_LIGHTS_CONFIG 1014
+#define PG_PINIOBOX_CONFIG 1015
+#define PG_LOGIC_CONDITIONS 1016
+#define PG_LOG_CONFIG 1017
+#define PG_RCDEVICE_CONFIG 1018
+#define PG_GENERAL_SETTINGS 1019
+#define PG_GLOBAL_FUNCTIONS 1020
+#define PG_ESC_SENSOR_CONFIG 1021
+#define PG_RPM_FILTER_CONFIG 1022
+#define PG_GLOBAL_VARIABLE_CONFIG 1023
+#define PG_INAV_END 1023
+
+
+
+
+
+
+
+#define PG_RESERVED_FOR_TESTING_1 4095
+#define PG_RESERVED_FOR_TESTING_2 4094
+#define PG_RESERVED_FOR_TESTING_3 4093
+
+#define PG_ID_INVALID 0
+#define PG_ID_FIRST PG_CF_START
+#define PG_ID_LAST PG_INAV_END
+# 37 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/io/asyncfatfs/asyncfatfs.h" 1
+# 18 "./src/main/io/asyncfatfs/asyncfatfs.h"
+       
+
+
+
+
+# 1 "./src/main/io/asyncfatfs/fat_standard.h" 1
+# 18 "./src/main/io/asyncfatfs/fat_standard.h"
+       
+
+
+
+
+#define MBR_PARTITION_TYPE_FAT16 0x06
+#define MBR_PARTITION_TYPE_FAT32 0x0B
+#define MBR_PARTITION_TYPE_FAT32_LBA 0x0C
+#define MBR_PARTITION_TYPE_FAT16_LBA 0x0E
+
+
+#define FAT_VOLUME_ID_SIGNATURE_1 0x55
+#define FAT_VOLUME_ID_SIGNATURE_2 0xAA
+
+#define FAT_DIRECTORY_ENTRY_SIZE 32
+#define FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2
+
+#define FAT_MAXIMUM_FILESIZE 0xFFFFFFFF
+
+#define FAT12_MAX_CLUSTERS 4084
+#define FAT16_MAX_CLUSTERS 65524
+
+#define FAT_FILE_ATTRIBUTE_READ_ONLY 0x01
+#define FAT_FILE_ATTRIBUTE_HIDDEN 0x02
+#define FAT_FILE_ATTRIBUTE_SYSTEM 0x04
+#define FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08
+#define FAT_FILE_ATTRIBUTE_DIRECTORY 0x10
+#define FAT_FILE_ATTRIBUTE_ARCHIVE 0x20
+
+#define FAT_FILENAME_LENGTH 11
+#define FAT_DELETED_FILE_MARKER 0xE5
+
+#define FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))
+#define FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))
+
+typedef enum {
+    FAT_FILESYSTEM_TYPE_INVALID,
+    FAT_FILESYSTEM_TYPE_FAT12,
+    FAT_FILESYSTEM_TYPE_FAT16,
+    FAT_FILESYSTEM_TYPE_FAT32,
+} fatFilesystemType_e;
+
+typedef struct mbrPartitionEntry_t {
+    uint8_t bootFlag;
+    uint8_t chsBegin[3];
+    uint8_t type;
+    uint8_t chsEnd[3];
+    uint32_t lbaBegin;
+    uint32_t numSectors;
+} __attribute__((packed)) mbrPartitionEntry_t;
+
+typedef struct fat16Descriptor_t {
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat16Descriptor_t;
+
+typedef struct fat32Descriptor_t {
+    uint32_t FATSize32;
+    uint16_t extFlags;
+    uint16_t fsVer;
+    uint32_t rootCluster;
+    uint16_t fsInfo;
+    uint16_t backupBootSector;
+    uint8_t reserved[12];
+    uint8_t driveNumber;
+    uint8_t reserved1;
+    uint8_t bootSignature;
+    uint32_t volumeID;
+    char volumeLabel[11];
+    char fileSystemType[8];
+} __attribute__((packed)) fat32Descriptor_t;
+
+typedef struct fatVolumeID_t {
+    uint8_t jmpBoot[3];
+    char oemName[8];
+    uint16_t bytesPerSector;
+    uint8_t sectorsPerCluster;
+    uint16_t reservedSectorCount;
+    uint8_t numFATs;
+    uint16_t rootEntryCount;
+    uint16_t totalSectors16;
+    uint8_t media;
+    uint16_t FATSize16;
+    uint16_t sectorsPerTrack;
+    uint16_t numHeads;
+    uint32_t hiddenSectors;
+    uint32_t totalSectors32;
+    union {
+        fat16Descriptor_t fat16;
+        fat32Descriptor_t fat32;
+    } fatDescriptor;
+} __attribute__((packed)) fatVolumeID_t;
+
+typedef struct fatDirectoryEntry_t {
+    char filename[11];
+    uint8_t attrib;
+    uint8_t ntReserved;
+    uint8_t creationTimeTenths;
+    uint16_t creationTime;
+    uint16_t creationDate;
+    uint16_t lastAccessDate;
+    uint16_t firstClusterHigh;
+    uint16_t lastWriteTime;
+    uint16_t lastWriteDate;
+    uint16_t firstClusterLow;
+    uint32_t fileSize;
+} __attribute__((packed)) fatDirectoryEntry_t;
+
+uint32_t fat32_decodeClusterNumber(uint32_t clusterNumber);
+
+
+# 132 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 132 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat32_isEndOfChainMarker(uint32_t clusterNumber);
+
+# 133 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 133 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat16_isEndOfChainMarker(uint16_t clusterNumber);
+
+
+# 135 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 135 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isFreeSpace(uint32_t clusterNumber);
+
+
+# 137 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 137 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryTerminator(fatDirectoryEntry_t *entry);
+
+# 138 "./src/main/io/asyncfatfs/fat_standard.h" 3 4
+_Bool 
+# 138 "./src/main/io/asyncfatfs/fat_standard.h"
+    fat_isDirectoryEntryEmpty(fatDirectoryEntry_t *entry);
+
+void fat_convertFilenameToFATStyle(const char *filename, uint8_t *fatFilename);
+# 24 "./src/main/io/asyncfatfs/asyncfatfs.h" 2
+
+typedef struct afatfsFile_t *afatfsFilePtr_t;
+
+typedef enum {
+    AFATFS_FILESYSTEM_STATE_UNKNOWN,
+    AFATFS_FILESYSTEM_STATE_FATAL,
+    AFATFS_FILESYSTEM_STATE_INITIALIZATION,
+    AFATFS_FILESYSTEM_STATE_READY,
+} afatfsFilesystemState_e;
+
+typedef enum {
+    AFATFS_OPERATION_IN_PROGRESS,
+    AFATFS_OPERATION_SUCCESS,
+    AFATFS_OPERATION_FAILURE,
+} afatfsOperationStatus_e;
+
+typedef enum {
+    AFATFS_ERROR_NONE = 0,
+    AFATFS_ERROR_GENERIC = 1,
+    AFATFS_ERROR_BAD_MBR = 2,
+    AFATFS_ERROR_BAD_FILESYSTEM_HEADER = 3
+} afatfsError_e;
+
+typedef struct afatfsDirEntryPointer_t {
+    uint32_t sectorNumberPhysical;
+    int16_t entryIndex;
+} afatfsDirEntryPointer_t;
+
+typedef afatfsDirEntryPointer_t afatfsFinder_t;
+
+typedef enum {
+    AFATFS_SEEK_SET,
+    AFATFS_SEEK_CUR,
+    AFATFS_SEEK_END,
+} afatfsSeek_e;
+
+
+
+
+
+typedef struct afatfsCacheStats_t {
+    uint32_t lookups;
+    uint32_t reads;
+    uint32_t fills;
+    uint32_t full;
+} afatfsCacheStats_t;
+
+typedef void (*afatfsFileCallback_t)(afatfsFilePtr_t file);
+typedef void (*afatfsCallback_t)(void);
+
+
+# 74 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 74 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fopen(const char *filename, const char *mode, afatfsFileCallback_t complete);
+
+# 75 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 75 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftruncate(afatfsFilePtr_t file, afatfsFileCallback_t callback);
+
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 76 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_fclose(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+# 77 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 77 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_funlink(afatfsFilePtr_t file, afatfsCallback_t callback);
+
+
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 79 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_feof(afatfsFilePtr_t file);
+void afatfs_fputc(afatfsFilePtr_t file, uint8_t c);
+uint32_t afatfs_fwrite(afatfsFilePtr_t file, const uint8_t *buffer, uint32_t len);
+uint32_t afatfs_fread(afatfsFilePtr_t file, uint8_t *buffer, uint32_t len);
+afatfsOperationStatus_e afatfs_fseek(afatfsFilePtr_t file, int32_t offset, afatfsSeek_e whence);
+
+# 84 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 84 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_ftell(afatfsFilePtr_t file, uint32_t *position);
+
+
+# 86 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 86 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_mkdir(const char *filename, afatfsFileCallback_t complete);
+
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 87 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_chdir(afatfsFilePtr_t dirHandle);
+
+void afatfs_findFirst(afatfsFilePtr_t directory, afatfsFinder_t *finder);
+afatfsOperationStatus_e afatfs_findNext(afatfsFilePtr_t directory, afatfsFinder_t *finder, fatDirectoryEntry_t **dirEntry);
+void afatfs_findLast(afatfsFilePtr_t directory);
+
+
+# 93 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 93 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_flush(void);
+void afatfs_init(void);
+
+# 95 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 95 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_destroy(
+# 95 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+                   _Bool 
+# 95 "./src/main/io/asyncfatfs/asyncfatfs.h"
+                        dirty);
+void afatfs_poll(void);
+
+uint32_t afatfs_getFreeBufferSpace(void);
+uint32_t afatfs_getContiguousFreeSpace(void);
+
+# 100 "./src/main/io/asyncfatfs/asyncfatfs.h" 3 4
+_Bool 
+# 100 "./src/main/io/asyncfatfs/asyncfatfs.h"
+    afatfs_isFull(void);
+
+afatfsFilesystemState_e afatfs_getFilesystemState(void);
+afatfsError_e afatfs_getLastError(void);
+const afatfsCacheStats_t *afatfs_getCacheStats(void);
+# 39 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/io/flashfs.h" 1
+# 18 "./src/main/io/flashfs.h"
+       
+
+
+
+# 1 "./src/main/drivers/flash.h" 1
+# 21 "./src/main/drivers/flash.h"
+       
+
+
+
+
+
+
+
+typedef uint16_t flashSector_t;
+
+typedef struct flashGeometry_s {
+    flashSector_t sectors;
+    uint16_t pageSize;
+    uint32_t sectorSize;
+    uint32_t totalSize;
+    uint16_t pagesPerSector;
+} flashGeometry_t;
+
+
+# 39 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 39 "./src/main/drivers/flash.h"
+    flashInit(void);
+
+
+# 41 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 41 "./src/main/drivers/flash.h"
+    flashIsReady(void);
+
+# 42 "./src/main/drivers/flash.h" 3 4
+_Bool 
+# 42 "./src/main/drivers/flash.h"
+    flashWaitForReady(uint32_t timeoutMillis);
+void flashEraseSector(uint32_t address);
+void flashEraseCompletely(void);
+
+
+
+
+
+uint32_t flashPageProgram(uint32_t address, const uint8_t *data, int length);
+int flashReadBytes(uint32_t address, uint8_t *buffer, int length);
+void flashFlush(void);
+const flashGeometry_t *flashGetGeometry(void);
+
+
+
+
+
+typedef struct flashPartition_s {
+    uint8_t type;
+    flashSector_t startSector;
+    flashSector_t endSector;
+} flashPartition_t;
+
+#define FLASH_PARTITION_SECTOR_COUNT(partition) (partition->endSector + 1 - partition->startSector)
+
+
+
+typedef enum {
+    FLASH_PARTITION_TYPE_UNKNOWN = 0,
+    FLASH_PARTITION_TYPE_PARTITION_TABLE,
+    FLASH_PARTITION_TYPE_FLASHFS,
+    FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT,
+    FLASH_PARTITION_TYPE_FIRMWARE,
+    FLASH_PARTITION_TYPE_CONFIG,
+    FLASH_PARTITION_TYPE_FULL_BACKUP,
+    FLASH_PARTITION_TYPE_FIRMWARE_UPDATE_META,
+    FLASH_PARTITION_TYPE_UPDATE_FIRMWARE,
+    FLASH_MAX_PARTITIONS
+} flashPartitionType_e;
+
+typedef struct flashPartitionTable_s {
+    flashPartition_t partitions[FLASH_MAX_PARTITIONS];
+} flashPartitionTable_t;
+
+void flashPartitionSet(uint8_t index, uint32_t startSector, uint32_t endSector);
+flashPartition_t *flashPartitionFindByType(flashPartitionType_e type);
+const flashPartition_t *flashPartitionFindByIndex(uint8_t index);
+const char *flashPartitionGetTypeName(flashPartitionType_e type);
+int flashPartitionCount(void);
+uint32_t flashPartitionSize(flashPartition_t *partition);
+void flashPartitionErase(flashPartition_t *partition);
+# 23 "./src/main/io/flashfs.h" 2
+
+#define FLASHFS_WRITE_BUFFER_SIZE 128
+#define FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)
+
+
+#define FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64
+
+void flashfsEraseCompletely(void);
+void flashfsEraseRange(uint32_t start, uint32_t end);
+
+uint32_t flashfsGetSize(void);
+uint32_t flashfsGetOffset(void);
+uint32_t flashfsGetWriteBufferFreeSpace(void);
+uint32_t flashfsGetWriteBufferSize(void);
+int flashfsIdentifyStartOfFreeSpace(void);
+
+void flashfsSeekAbs(uint32_t offset);
+void flashfsSeekRel(int32_t offset);
+
+void flashfsWriteByte(uint8_t byte);
+void flashfsWrite(const uint8_t *data, unsigned int len, 
+# 43 "./src/main/io/flashfs.h" 3 4
+                                                        _Bool 
+# 43 "./src/main/io/flashfs.h"
+                                                             sync);
+
+int flashfsReadAbs(uint32_t offset, uint8_t *data, unsigned int len);
+
+
+# 47 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 47 "./src/main/io/flashfs.h"
+    flashfsFlushAsync(void);
+void flashfsFlushSync(void);
+
+void flashfsInit(void);
+
+
+# 52 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 52 "./src/main/io/flashfs.h"
+    flashfsIsReady(void);
+
+# 53 "./src/main/io/flashfs.h" 3 4
+_Bool 
+# 53 "./src/main/io/flashfs.h"
+    flashfsIsEOF(void);
+# 40 "./src/main/blackbox/blackbox_io.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 18 "./src/main/io/serial.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 18 "./src/main/drivers/serial.h"
+       
+# 1 "./src/main/drivers/io.h" 1
+# 18 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 18 "./src/main/drivers/resource.h"
+       
+
+#define RESOURCE_INDEX(x) (x + 1)
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMIO,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_SOFTSERIAL,
+    OWNER_ADC,
+    OWNER_SERIAL,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_RANGEFINDER,
+    OWNER_SYSTEM,
+    OWNER_SPI,
+    OWNER_I2C,
+    OWNER_SDCARD,
+    OWNER_FLASH,
+    OWNER_USB,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_BARO,
+    OWNER_MPU,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_LED,
+    OWNER_RX,
+    OWNER_TX,
+    OWNER_RX_SPI,
+    OWNER_VTX,
+    OWNER_SPI_PREINIT,
+    OWNER_COMPASS,
+    OWNER_TEMPERATURE,
+    OWNER_1WIRE,
+    OWNER_AIRSPEED,
+    OWNER_OLED_DISPLAY,
+    OWNER_PINIO,
+    OWNER_IRLOCK,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+
+
+
+typedef enum {
+    RESOURCE_NONE = 0,
+    RESOURCE_INPUT, RESOURCE_OUTPUT, RESOURCE_IO,
+    RESOURCE_TIMER,
+    RESOURCE_UART_TX, RESOURCE_UART_RX, RESOURCE_UART_TXRX,
+    RESOURCE_EXTI,
+    RESOURCE_I2C_SCL, RESOURCE_I2C_SDA,
+    RESOURCE_SPI_SCK, RESOURCE_SPI_MOSI, RESOURCE_SPI_MISO, RESOURCE_SPI_CS,
+    RESOURCE_ADC_CH1, RESOURCE_ADC_CH2, RESOURCE_ADC_CH3, RESOURCE_ADC_CH4,
+    RESOURCE_RX_CE,
+    RESOURCE_TOTAL_COUNT
+} resourceType_e;
+
+extern const char * const resourceNames[RESOURCE_TOTAL_COUNT];
+# 26 "./src/main/drivers/io.h" 2
+
+# 1 "./src/main/drivers/io_types.h" 1
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+
+
+#define IOTAG_NONE ((ioTag_t)0)
+
+
+#define IO_NONE ((IO_t)0)
+# 28 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 28 "./src/main/drivers/io.h" 2
+
+
+
+
+
+
+#define IO_TAG(pinid) DEFIO_TAG(pinid)
+# 73 "./src/main/drivers/io.h"
+#define IOCFG_OUT_PP 0
+#define IOCFG_OUT_OD 0
+#define IOCFG_AF_PP 0
+#define IOCFG_AF_OD 0
+#define IOCFG_IPD 0
+#define IOCFG_IPU 0
+#define IOCFG_IN_FLOATING 0
+
+
+
+
+
+
+# 1 "./src/main/drivers/io_def.h" 1
+       
+
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 21 "./src/main/common/utils.h" 2
+
+
+#define ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))
+#define ARRAYEND(x) (&(x)[ARRAYLEN(x)])
+
+#define CONST_CAST(type,value) ((type)(value))
+
+#define CONCAT_HELPER(x,y) x ## y
+#define CONCAT(x,y) CONCAT_HELPER(x, y)
+
+#define CONCAT3_HELPER(x,y,z) x ## y ## z
+#define CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)
+
+#define CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w
+#define CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+
+#define EXPAND_I(x) x
+#define EXPAND(x) EXPAND_I(x)
+
+
+
+
+
+#define PP_CALL(macro,...) macro(__VA_ARGS__)
+
+
+#define UNUSED(x) (void)(x)
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+
+#define BIT(x) (1 << (x))
+
+#define STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))
+
+
+
+
+
+#define BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)
+#define BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))
+
+
+
+
+
+
+
+#define LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))
+#define LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))
+#define LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))
+#define LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))
+# 86 "./src/main/common/utils.h"
+#define container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))
+
+
+
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return a-b; }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return a-b; }
+# 100 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+
+
+
+
+
+
+#define FALLTHROUGH __attribute__ ((fallthrough))
+
+
+
+
+#define UNREACHABLE() __builtin_unreachable()
+
+#define ALIGNED(x) __attribute__ ((aligned(x)))
+#define ALWAYS_INLINE inline __attribute__ ((always_inline))
+# 4 "./src/main/drivers/io_def.h" 2
+
+
+
+#define DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)
+#define DEFIO_TAG__NONE 0
+#define DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)
+#define DEFIO_TAG_E__NONE 0
+
+
+
+
+
+#define DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)
+#define DEFIO_REC__NONE NULL
+
+#define DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)
+
+
+
+#define DEFIO_REC_INDEXED(idx) (ioRecs + (idx))
+
+
+#define DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))
+#define DEFIO_TAG_ISEMPTY(tag) (!(tag))
+#define DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)
+#define DEFIO_TAG_PIN(tag) ((tag) & 0x0f)
+
+
+
+
+# 1 "./src/main/drivers/io_def_generated.h" 1
+       
+
+
+
+
+
+
+
+#define DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA
+#define DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_A_OFFSET (0)
+
+
+#define DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB
+#define DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)
+
+
+#define DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC
+#define DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_D_USED_MASK 0
+#define DEFIO_PORT_D_USED_COUNT 0
+
+#define DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_E_USED_MASK 0
+#define DEFIO_PORT_E_USED_COUNT 0
+
+#define DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_F_USED_MASK 0
+#define DEFIO_PORT_F_USED_COUNT 0
+
+#define DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_G_USED_MASK 0
+#define DEFIO_PORT_G_USED_COUNT 0
+
+#define DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)
+
+
+
+
+#define DEFIO_GPIOID__A 0
+#define DEFIO_GPIOID__B 1
+#define DEFIO_GPIOID__C 2
+#define DEFIO_GPIOID__D 3
+#define DEFIO_GPIOID__E 4
+#define DEFIO_GPIOID__F 5
+#define DEFIO_GPIOID__G 6
+
+
+
+
+
+#define DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+# 522 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET
+
+
+
+#define DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)
+# 1121 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_PORT_USED_COUNT 3
+#define DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK
+#define DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET
+# 35 "./src/main/drivers/io_def.h" 2
+# 87 "./src/main/drivers/io.h" 2
+
+
+# 88 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 88 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 89 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 89 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, resourceType_e resource, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+resourceType_e IOGetResources(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 20 "./src/main/drivers/serial.h" 2
+
+typedef struct {
+    ioTag_t rxPin;
+    ioTag_t txPin;
+} serialPortPins_t;
+
+typedef enum portMode_t {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_t;
+
+typedef enum portOptions_t {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 49 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_t;
+
+
+typedef struct serialBufChunk_s {
+    const uint8_t *data;
+    int count;
+} serialBufChunk_t;
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+typedef void (*serialReceiveFrameCallbackPtr)(const uint8_t *data, int count, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    uint8_t identifier;
+    portMode_t mode;
+    portOptions_t options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    serialReceiveFrameCallbackPtr rxFrameCallback;
+
+
+    uint32_t rxIrqCount;
+} serialPort_t;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 102 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 102 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_t mode);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    
+# 108 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 108 "./src/main/drivers/serial.h"
+        (*isConnected)(const serialPort_t *instance);
+
+    
+# 110 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 110 "./src/main/drivers/serial.h"
+        (*isIdle)(serialPort_t *instance);
+
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+
+
+    void (*writeBufChunks)(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+void serialSetReceiveFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr rxFrameCallback);
+void serialWriteBufChunks(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_t mode);
+
+# 129 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+# 132 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 132 "./src/main/drivers/serial.h"
+    serialIsConnected(const serialPort_t *instance);
+
+# 133 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/serial.h"
+    serialIsIdle(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 25 "./src/main/io/serial.h" 2
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 8),
+    FUNCTION_TELEMETRY_IBUS = (1 << 9),
+    FUNCTION_RCDEVICE = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_VTX_TRAMP = (1 << 12),
+    FUNCTION_UAV_INTERCONNECT = (1 << 13),
+    FUNCTION_OPTICAL_FLOW = (1 << 14),
+    FUNCTION_LOG = (1 << 15),
+    FUNCTION_RANGEFINDER = (1 << 16),
+    FUNCTION_VTX_FFPV = (1 << 17),
+    FUNCTION_ESCSERIAL = (1 << 18),
+    FUNCTION_TELEMETRY_SIM = (1 << 19),
+    FUNCTION_FRSKY_OSD = (1 << 20),
+    FUNCTION_DJI_HD_OSD = (1 << 21),
+    FUNCTION_SERVO_SERIAL = (1 << 22),
+} serialPortFunction_e;
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_1200,
+    BAUD_2400,
+    BAUD_4800,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_460800,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_USART4,
+    SERIAL_PORT_USART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2,
+    SERIAL_PORT_IDENTIFIER_MAX = SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+
+
+
+
+typedef struct serialPortUsage_s {
+    serialPortIdentifier_e identifier;
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+serialPort_t *findNextSharedSerialPort(uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint32_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t peripheral_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 136 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 136 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 139 "./src/main/io/serial.h" 3 4
+_Bool 
+# 139 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 140 "./src/main/io/serial.h" 3 4
+_Bool 
+# 140 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 142 "./src/main/io/serial.h" 3 4
+_Bool 
+# 142 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 147 "./src/main/io/serial.h" 3 4
+_Bool 
+# 147 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr callback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_t mode,
+    portOptions_t options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 41 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/msp/msp_serial.h" 1
+# 18 "./src/main/msp/msp_serial.h"
+       
+
+# 1 "./src/main/drivers/time.h" 1
+# 18 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 21 "./src/main/msp/msp_serial.h" 2
+
+# 1 "./src/main/msp/msp.h" 1
+# 18 "./src/main/msp/msp.h"
+       
+
+# 1 "./src/main/common/streambuf.h" 1
+# 18 "./src/main/common/streambuf.h"
+       
+
+
+
+
+
+
+
+typedef struct sbuf_s {
+    uint8_t *ptr;
+    uint8_t *end;
+} sbuf_t;
+
+sbuf_t *sbufInit(sbuf_t *sbuf, uint8_t *ptr, uint8_t *end);
+
+void sbufWriteU8(sbuf_t *dst, uint8_t val);
+void sbufWriteU16(sbuf_t *dst, uint16_t val);
+void sbufWriteU32(sbuf_t *dst, uint32_t val);
+void sbufFill(sbuf_t *dst, uint8_t data, int len);
+void sbufWriteData(sbuf_t *dst, const void *data, int len);
+
+# 38 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 38 "./src/main/common/streambuf.h"
+    sbufWriteDataSafe(sbuf_t *dst, const void *data, int len);
+void sbufWriteString(sbuf_t *dst, const char *string);
+void sbufWriteStringWithZeroTerminator(sbuf_t *dst, const char *string);
+void sbufWriteU16BigEndian(sbuf_t *dst, uint16_t val);
+void sbufWriteU32BigEndian(sbuf_t *dst, uint32_t val);
+
+uint8_t sbufReadU8(sbuf_t *src);
+uint16_t sbufReadU16(sbuf_t *src);
+uint32_t sbufReadU32(sbuf_t *src);
+void sbufReadData(const sbuf_t *dst, void *data, int len);
+
+
+# 49 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 49 "./src/main/common/streambuf.h"
+    sbufReadU8Safe(uint8_t *dst, sbuf_t *src);
+
+# 50 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 50 "./src/main/common/streambuf.h"
+    sbufReadU16Safe(uint16_t *dst, sbuf_t *src);
+
+# 51 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 51 "./src/main/common/streambuf.h"
+    sbufReadU32Safe(uint32_t *dst, sbuf_t *src);
+
+# 52 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 52 "./src/main/common/streambuf.h"
+    sbufReadI8Safe(int8_t *dst, sbuf_t *src);
+
+# 53 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 53 "./src/main/common/streambuf.h"
+    sbufReadI16Safe(int16_t *dst, sbuf_t *src);
+
+# 54 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 54 "./src/main/common/streambuf.h"
+    sbufReadI32Safe(int32_t *dst, sbuf_t *src);
+
+# 55 "./src/main/common/streambuf.h" 3 4
+_Bool 
+# 55 "./src/main/common/streambuf.h"
+    sbufReadDataSafe(const sbuf_t *src, void *data, int len);
+
+int sbufBytesRemaining(const sbuf_t *buf);
+uint8_t* sbufPtr(sbuf_t *buf);
+const uint8_t* sbufConstPtr(const sbuf_t *buf);
+void sbufAdvance(sbuf_t *buf, int size);
+
+void sbufSwitchToReader(sbuf_t *buf, uint8_t * base);
+# 21 "./src/main/msp/msp.h" 2
+
+#define MSP_V2_FRAME_ID 255
+
+typedef enum {
+    MSP_V1 = 0,
+    MSP_V2_OVER_V1 = 1,
+    MSP_V2_NATIVE = 2,
+    MSP_VERSION_COUNT
+} mspVersion_e;
+
+#define MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }
+
+
+typedef enum {
+    MSP_RESULT_ACK = 1,
+    MSP_RESULT_ERROR = -1,
+    MSP_RESULT_NO_REPLY = 0
+} mspResult_e;
+
+typedef struct mspPacket_s {
+    sbuf_t buf;
+    int16_t cmd;
+    uint8_t flags;
+    int16_t result;
+} mspPacket_t;
+
+typedef enum {
+    MSP_FLAG_DONT_REPLY = (1 << 0),
+} mspFlags_e;
+
+struct serialPort_s;
+typedef void (*mspPostProcessFnPtr)(struct serialPort_s *port);
+typedef mspResult_e (*mspProcessCommandFnPtr)(mspPacket_t *cmd, mspPacket_t *reply, mspPostProcessFnPtr *mspPostProcessFn);
+typedef 
+# 54 "./src/main/msp/msp.h" 3 4
+       _Bool 
+# 54 "./src/main/msp/msp.h"
+            (*mspStreamFillFnPtr)(sbuf_t *dst);
+# 23 "./src/main/msp/msp_serial.h" 2
+
+
+#define MAX_MSP_PORT_COUNT 3
+
+typedef enum {
+    MSP_IDLE,
+    MSP_HEADER_START,
+    MSP_HEADER_M,
+    MSP_HEADER_X,
+
+    MSP_HEADER_V1,
+    MSP_PAYLOAD_V1,
+    MSP_CHECKSUM_V1,
+
+    MSP_HEADER_V2_OVER_V1,
+    MSP_PAYLOAD_V2_OVER_V1,
+    MSP_CHECKSUM_V2_OVER_V1,
+
+    MSP_HEADER_V2_NATIVE,
+    MSP_PAYLOAD_V2_NATIVE,
+    MSP_CHECKSUM_V2_NATIVE,
+
+    MSP_COMMAND_RECEIVED
+} mspState_e;
+
+typedef enum {
+    MSP_EVALUATE_NON_MSP_DATA,
+    MSP_SKIP_NON_MSP_DATA
+} mspEvaluateNonMspData_e;
+
+typedef enum {
+    MSP_PENDING_NONE,
+    MSP_PENDING_BOOTLOADER,
+    MSP_PENDING_CLI
+} mspPendingSystemRequest_e;
+
+#define MSP_PORT_INBUF_SIZE 192
+
+
+
+
+
+#define MSP_PORT_OUTBUF_SIZE 512
+
+
+#define MSP_STREAM_MAX_FRAMES_PER_CALL 4
+#define MSP_STREAM_MIN_FRAME_SIZE 64
+
+typedef struct __attribute__((packed)) {
+    uint8_t size;
+    uint8_t cmd;
+} mspHeaderV1_t;
+
+typedef struct __attribute__((packed)) {
+    uint16_t size;
+} mspHeaderJUMBO_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t flags;
+    uint16_t cmd;
+    uint16_t size;
+} mspHeaderV2_t;
+
+#define MSP_MAX_HEADER_SIZE 9
+
+struct serialPort_s;
+typedef struct mspPort_s {
+    struct serialPort_s *port;
+    timeMs_t lastActivityMs;
+    mspPendingSystemRequest_e pendingRequest;
+    mspState_e c_state;
+    uint8_t inBuf[192];
+    uint_fast16_t offset;
+    uint_fast16_t dataSize;
+    mspVersion_e mspVersion;
+    uint8_t cmdFlags;
+    uint16_t cmdMSP;
+    uint8_t checksum1;
+    uint8_t checksum2;
+} mspPort_t;
+
+
+void mspSerialInit(void);
+void resetMspPort(mspPort_t *mspPortToReset, serialPort_t *serialPort);
+void mspSerialProcess(mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn);
+void mspSerialProcessOnePort(mspPort_t * const mspPort, mspEvaluateNonMspData_e evaluateNonMspData, mspProcessCommandFnPtr mspProcessCommandFn);
+void mspSerialAllocatePorts(void);
+void mspSerialReleasePortIfAllocated(struct serialPort_s *serialPort);
+int mspSerialPushPort(uint16_t cmd, const uint8_t *data, int datalen, mspPort_t *mspPort, mspVersion_e version);
+int mspSerialPush(uint8_t cmd, const uint8_t *data, int datalen);
+uint32_t mspSerialTxBytesFree(void);
+mspPort_t * mspSerialPortFind(const struct serialPort_s *serialPort);
+void mspSerialStartStream(struct serialPort_s *serialPort, uint16_t cmd, mspStreamFillFnPtr fillFn);
+void mspSerialStopStream(void);
+
+# 117 "./src/main/msp/msp_serial.h" 3 4
+_Bool 
+# 117 "./src/main/msp/msp_serial.h"
+    mspSerialIsStreaming(void);
+# 43 "./src/main/blackbox/blackbox_io.c" 2
+
+# 1 "./src/main/sensors/gyro.h" 1
+# 18 "./src/main/sensors/gyro.h"
+       
+
+
+
+# 1 "./src/main/common/vector.h" 1
+# 18 "./src/main/common/vector.h"
+       
+
+
+# 1 "/usr/include/math.h" 1 3 4
+# 24 "/usr/include/math.h" 3 4
+#define _MATH_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 3 4
+#define _BITS_LIBM_SIMD_DECL_STUBS_H 1
+
+#define __DECL_SIMD_cos 
+#define __DECL_SIMD_cosf 
+#define __DECL_SIMD_cosl 
+#define __DECL_SIMD_cosf16 
+#define __DECL_SIMD_cosf32 
+#define __DECL_SIMD_cosf64 
+#define __DECL_SIMD_cosf128 
+#define __DECL_SIMD_cosf32x 
+#define __DECL_SIMD_cosf64x 
+#define __DECL_SIMD_cosf128x 
+
+#define __DECL_SIMD_sin 
+#define __DECL_SIMD_sinf 
+#define __DECL_SIMD_sinl 
+#define __DECL_SIMD_sinf16 
+#define __DECL_SIMD_sinf32 
+#define __DECL_SIMD_sinf64 
+#define __DECL_SIMD_sinf128 
+#define __DECL_SIMD_sinf32x 
+#define __DECL_SIMD_sinf64x 
+#define __DECL_SIMD_sinf128x 
+
+#define __DECL_SIMD_sincos 
+#define __DECL_SIMD_sincosf 
+#define __DECL_SIMD_sincosl 
+#define __DECL_SIMD_sincosf16 
+#define __DECL_SIMD_sincosf32 
+#define __DECL_SIMD_sincosf64 
+#define __DECL_SIMD_sincosf128 
+#define __DECL_SIMD_sincosf32x 
+#define __DECL_SIMD_sincosf64x 
+#define __DECL_SIMD_sincosf128x 
+
+#define __DECL_SIMD_log 
+#define __DECL_SIMD_logf 
+#define __DECL_SIMD_logl 
+#define __DECL_SIMD_logf16 
+#define __DECL_SIMD_logf32 
+#define __DECL_SIMD_logf64 
+#define __DECL_SIMD_logf128 
+#define __DECL_SIMD_logf32x 
+#define __DECL_SIMD_logf64x 
+#define __DECL_SIMD_logf128x 
+
+#define __DECL_SIMD_exp 
+#define __DECL_SIMD_expf 
+#define __DECL_SIMD_expl 
+#define __DECL_SIMD_expf16 
+#define __DECL_SIMD_expf32 
+#define __DECL_SIMD_expf64 
+#define __DECL_SIMD_expf128 
+#define __DECL_SIMD_expf32x 
+#define __DECL_SIMD_expf64x 
+#define __DECL_SIMD_expf128x 
+
+#define __DECL_SIMD_pow 
+#define __DECL_SIMD_powf 
+#define __DECL_SIMD_powl 
+#define __DECL_SIMD_powf16 
+#define __DECL_SIMD_powf32 
+#define __DECL_SIMD_powf64 
+#define __DECL_SIMD_powf128 
+#define __DECL_SIMD_powf32x 
+#define __DECL_SIMD_powf64x 
+#define __DECL_SIMD_powf128x 
+
+#define __DECL_SIMD_acos 
+#define __DECL_SIMD_acosf 
+#define __DECL_SIMD_acosl 
+#define __DECL_SIMD_acosf16 
+#define __DECL_SIMD_acosf32 
+#define __DECL_SIMD_acosf64 
+#define __DECL_SIMD_acosf128 
+#define __DECL_SIMD_acosf32x 
+#define __DECL_SIMD_acosf64x 
+#define __DECL_SIMD_acosf128x 
+
+#define __DECL_SIMD_atan 
+#define __DECL_SIMD_atanf 
+#define __DECL_SIMD_atanl 
+#define __DECL_SIMD_atanf16 
+#define __DECL_SIMD_atanf32 
+#define __DECL_SIMD_atanf64 
+#define __DECL_SIMD_atanf128 
+#define __DECL_SIMD_atanf32x 
+#define __DECL_SIMD_atanf64x 
+#define __DECL_SIMD_atanf128x 
+
+#define __DECL_SIMD_asin 
+#define __DECL_SIMD_asinf 
+#define __DECL_SIMD_asinl 
+#define __DECL_SIMD_asinf16 
+#define __DECL_SIMD_asinf32 
+#define __DECL_SIMD_asinf64 
+#define __DECL_SIMD_asinf128 
+#define __DECL_SIMD_asinf32x 
+#define __DECL_SIMD_asinf64x 
+#define __DECL_SIMD_asinf128x 
+
+#define __DECL_SIMD_hypot 
+#define __DECL_SIMD_hypotf 
+#define __DECL_SIMD_hypotl 
+#define __DECL_SIMD_hypotf16 
+#define __DECL_SIMD_hypotf32 
+#define __DECL_SIMD_hypotf64 
+#define __DECL_SIMD_hypotf128 
+#define __DECL_SIMD_hypotf32x 
+#define __DECL_SIMD_hypotf64x 
+#define __DECL_SIMD_hypotf128x 
+
+#define __DECL_SIMD_exp2 
+#define __DECL_SIMD_exp2f 
+#define __DECL_SIMD_exp2l 
+#define __DECL_SIMD_exp2f16 
+#define __DECL_SIMD_exp2f32 
+#define __DECL_SIMD_exp2f64 
+#define __DECL_SIMD_exp2f128 
+#define __DECL_SIMD_exp2f32x 
+#define __DECL_SIMD_exp2f64x 
+#define __DECL_SIMD_exp2f128x 
+
+#define __DECL_SIMD_exp10 
+#define __DECL_SIMD_exp10f 
+#define __DECL_SIMD_exp10l 
+#define __DECL_SIMD_exp10f16 
+#define __DECL_SIMD_exp10f32 
+#define __DECL_SIMD_exp10f64 
+#define __DECL_SIMD_exp10f128 
+#define __DECL_SIMD_exp10f32x 
+#define __DECL_SIMD_exp10f64x 
+#define __DECL_SIMD_exp10f128x 
+
+#define __DECL_SIMD_cosh 
+#define __DECL_SIMD_coshf 
+#define __DECL_SIMD_coshl 
+#define __DECL_SIMD_coshf16 
+#define __DECL_SIMD_coshf32 
+#define __DECL_SIMD_coshf64 
+#define __DECL_SIMD_coshf128 
+#define __DECL_SIMD_coshf32x 
+#define __DECL_SIMD_coshf64x 
+#define __DECL_SIMD_coshf128x 
+
+#define __DECL_SIMD_expm1 
+#define __DECL_SIMD_expm1f 
+#define __DECL_SIMD_expm1l 
+#define __DECL_SIMD_expm1f16 
+#define __DECL_SIMD_expm1f32 
+#define __DECL_SIMD_expm1f64 
+#define __DECL_SIMD_expm1f128 
+#define __DECL_SIMD_expm1f32x 
+#define __DECL_SIMD_expm1f64x 
+#define __DECL_SIMD_expm1f128x 
+
+#define __DECL_SIMD_sinh 
+#define __DECL_SIMD_sinhf 
+#define __DECL_SIMD_sinhl 
+#define __DECL_SIMD_sinhf16 
+#define __DECL_SIMD_sinhf32 
+#define __DECL_SIMD_sinhf64 
+#define __DECL_SIMD_sinhf128 
+#define __DECL_SIMD_sinhf32x 
+#define __DECL_SIMD_sinhf64x 
+#define __DECL_SIMD_sinhf128x 
+
+#define __DECL_SIMD_cbrt 
+#define __DECL_SIMD_cbrtf 
+#define __DECL_SIMD_cbrtl 
+#define __DECL_SIMD_cbrtf16 
+#define __DECL_SIMD_cbrtf32 
+#define __DECL_SIMD_cbrtf64 
+#define __DECL_SIMD_cbrtf128 
+#define __DECL_SIMD_cbrtf32x 
+#define __DECL_SIMD_cbrtf64x 
+#define __DECL_SIMD_cbrtf128x 
+
+#define __DECL_SIMD_atan2 
+#define __DECL_SIMD_atan2f 
+#define __DECL_SIMD_atan2l 
+#define __DECL_SIMD_atan2f16 
+#define __DECL_SIMD_atan2f32 
+#define __DECL_SIMD_atan2f64 
+#define __DECL_SIMD_atan2f128 
+#define __DECL_SIMD_atan2f32x 
+#define __DECL_SIMD_atan2f64x 
+#define __DECL_SIMD_atan2f128x 
+
+#define __DECL_SIMD_log10 
+#define __DECL_SIMD_log10f 
+#define __DECL_SIMD_log10l 
+#define __DECL_SIMD_log10f16 
+#define __DECL_SIMD_log10f32 
+#define __DECL_SIMD_log10f64 
+#define __DECL_SIMD_log10f128 
+#define __DECL_SIMD_log10f32x 
+#define __DECL_SIMD_log10f64x 
+#define __DECL_SIMD_log10f128x 
+
+#define __DECL_SIMD_log2 
+#define __DECL_SIMD_log2f 
+#define __DECL_SIMD_log2l 
+#define __DECL_SIMD_log2f16 
+#define __DECL_SIMD_log2f32 
+#define __DECL_SIMD_log2f64 
+#define __DECL_SIMD_log2f128 
+#define __DECL_SIMD_log2f32x 
+#define __DECL_SIMD_log2f64x 
+#define __DECL_SIMD_log2f128x 
+
+#define __DECL_SIMD_log1p 
+#define __DECL_SIMD_log1pf 
+#define __DECL_SIMD_log1pl 
+#define __DECL_SIMD_log1pf16 
+#define __DECL_SIMD_log1pf32 
+#define __DECL_SIMD_log1pf64 
+#define __DECL_SIMD_log1pf128 
+#define __DECL_SIMD_log1pf32x 
+#define __DECL_SIMD_log1pf64x 
+#define __DECL_SIMD_log1pf128x 
+
+#define __DECL_SIMD_atanh 
+#define __DECL_SIMD_atanhf 
+#define __DECL_SIMD_atanhl 
+#define __DECL_SIMD_atanhf16 
+#define __DECL_SIMD_atanhf32 
+#define __DECL_SIMD_atanhf64 
+#define __DECL_SIMD_atanhf128 
+#define __DECL_SIMD_atanhf32x 
+#define __DECL_SIMD_atanhf64x 
+#define __DECL_SIMD_atanhf128x 
+
+#define __DECL_SIMD_acosh 
+#define __DECL_SIMD_acoshf 
+#define __DECL_SIMD_acoshl 
+#define __DECL_SIMD_acoshf16 
+#define __DECL_SIMD_acoshf32 
+#define __DECL_SIMD_acoshf64 
+#define __DECL_SIMD_acoshf128 
+#define __DECL_SIMD_acoshf32x 
+#define __DECL_SIMD_acoshf64x 
+#define __DECL_SIMD_acoshf128x 
+
+#define __DECL_SIMD_erf 
+#define __DECL_SIMD_erff 
+#define __DECL_SIMD_erfl 
+#define __DECL_SIMD_erff16 
+#define __DECL_SIMD_erff32 
+#define __DECL_SIMD_erff64 
+#define __DECL_SIMD_erff128 
+#define __DECL_SIMD_erff32x 
+#define __DECL_SIMD_erff64x 
+#define __DECL_SIMD_erff128x 
+
+#define __DECL_SIMD_tanh 
+#define __DECL_SIMD_tanhf 
+#define __DECL_SIMD_tanhl 
+#define __DECL_SIMD_tanhf16 
+#define __DECL_SIMD_tanhf32 
+#define __DECL_SIMD_tanhf64 
+#define __DECL_SIMD_tanhf128 
+#define __DECL_SIMD_tanhf32x 
+#define __DECL_SIMD_tanhf64x 
+#define __DECL_SIMD_tanhf128x 
+
+#define __DECL_SIMD_asinh 
+#define __DECL_SIMD_asinhf 
+#define __DECL_SIMD_asinhl 
+#define __DECL_SIMD_asinhf16 
+#define __DECL_SIMD_asinhf32 
+#define __DECL_SIMD_asinhf64 
+#define __DECL_SIMD_asinhf128 
+#define __DECL_SIMD_asinhf32x 
+#define __DECL_SIMD_asinhf64x 
+#define __DECL_SIMD_asinhf128x 
+
+#define __DECL_SIMD_erfc 
+#define __DECL_SIMD_erfcf 
+#define __DECL_SIMD_erfcl 
+#define __DECL_SIMD_erfcf16 
+#define __DECL_SIMD_erfcf32 
+#define __DECL_SIMD_erfcf64 
+#define __DECL_SIMD_erfcf128 
+#define __DECL_SIMD_erfcf32x 
+#define __DECL_SIMD_erfcf64x 
+#define __DECL_SIMD_erfcf128x 
+
+#define __DECL_SIMD_tan 
+#define __DECL_SIMD_tanf 
+#define __DECL_SIMD_tanl 
+#define __DECL_SIMD_tanf16 
+#define __DECL_SIMD_tanf32 
+#define __DECL_SIMD_tanf64 
+#define __DECL_SIMD_tanf128 
+#define __DECL_SIMD_tanf32x 
+#define __DECL_SIMD_tanf64x 
+#define __DECL_SIMD_tanf128x 
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+#define HUGE_VAL (__builtin_huge_val ())
+# 59 "/usr/include/math.h" 3 4
+#define HUGE_VALF (__builtin_huge_valf ())
+#define HUGE_VALL (__builtin_huge_vall ())
+# 91 "/usr/include/math.h" 3 4
+#define INFINITY (__builtin_inff ())
+
+
+
+
+
+
+#define NAN (__builtin_nanf (""))
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 3 4
+#define __GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 3 4
+#define __FP_LOGB0_IS_MIN 1
+#define __FP_LOGBNAN_IS_MIN 1
+# 205 "/usr/include/math.h" 2 3 4
+
+
+#define FP_ILOGB0 (-2147483647 - 1)
+
+
+
+
+#define FP_ILOGBNAN (-2147483647 - 1)
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+# 276 "/usr/include/math.h" 3 4
+#define __SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)
+
+#define __MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)
+
+
+
+#define __MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)
+
+
+
+#define __MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)
+
+#define __MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)
+
+
+#define __MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)
+
+#define __MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)
+
+
+#define __MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW
+
+#define __MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)
+
+
+
+#define __MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)
+
+
+#define __MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)
+
+
+#define _Mdouble_ double
+#define __MATH_PRECNAME(name,r) __CONCAT(name,r)
+#define __MATH_DECLARING_DOUBLE 1
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+
+
+
+
+#define _Mdouble_ float
+#define __MATH_PRECNAME(name,r) name ##f ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 393 "/usr/include/math.h" 3 4
+#define _Mdouble_ long double
+#define __MATH_PRECNAME(name,r) name ##l ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+#define __MATH_DECLARE_LDOUBLE 1
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 442 "/usr/include/math.h" 3 4
+#define _Mdouble_ _Float32
+#define __MATH_PRECNAME(name,r) name ##f32 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64
+#define __MATH_PRECNAME(name,r) name ##f64 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float128
+#define __MATH_PRECNAME(name,r) name ##f128 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float32x
+#define __MATH_PRECNAME(name,r) name ##f32x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64x
+#define __MATH_PRECNAME(name,r) name ##f64x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 543 "/usr/include/math.h" 3 4
+#undef __MATHDECL_1_IMPL
+#undef __MATHDECL_1
+#undef __MATHDECL_ALIAS
+#undef __MATHDECL
+#undef __MATHCALL
+
+
+#define __MATHCALL_NARROW_ARGS_1 (_Marg_ __x)
+#define __MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)
+#define __MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)
+#define __MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW
+
+#define __MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)
+
+
+#define __MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)
+# 845 "/usr/include/math.h" 3 4
+#undef __MATHCALL_NARROW_ARGS_1
+#undef __MATHCALL_NARROW_ARGS_2
+#undef __MATHCALL_NARROW_ARGS_3
+#undef __MATHCALL_NARROW_NORMAL
+#undef __MATHCALL_NARROW_REDIR
+#undef __MATHCALL_NARROW
+
+
+
+extern int signgam;
+# 884 "/usr/include/math.h" 3 4
+#define __MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,
+
+
+
+
+
+#define __MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,
+
+
+
+
+
+
+#define __MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+#define FP_NAN 0
+      0,
+    FP_INFINITE =
+#define FP_INFINITE 1
+      1,
+    FP_ZERO =
+#define FP_ZERO 2
+      2,
+    FP_SUBNORMAL =
+#define FP_SUBNORMAL 3
+      3,
+    FP_NORMAL =
+#define FP_NORMAL 4
+      4
+  };
+# 967 "/usr/include/math.h" 3 4
+#define fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)
+
+
+
+
+
+
+
+#define signbit(x) __builtin_signbit (x)
+# 994 "/usr/include/math.h" 3 4
+#define isfinite(x) __builtin_isfinite (x)
+
+
+
+
+
+
+
+#define isnormal(x) __builtin_isnormal (x)
+# 1011 "/usr/include/math.h" 3 4
+#define isnan(x) __builtin_isnan (x)
+# 1029 "/usr/include/math.h" 3 4
+#define isinf(x) __builtin_isinf_sign (x)
+
+
+
+
+
+#define MATH_ERRNO 1
+#define MATH_ERREXCEPT 2
+# 1048 "/usr/include/math.h" 3 4
+#define math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)
+# 1146 "/usr/include/math.h" 3 4
+#define M_E 2.7182818284590452354
+#define M_LOG2E 1.4426950408889634074
+#define M_LOG10E 0.43429448190325182765
+#define M_LN2 0.69314718055994530942
+#define M_LN10 2.30258509299404568402
+#define M_PI 3.14159265358979323846
+#define M_PI_2 1.57079632679489661923
+#define M_PI_4 0.78539816339744830962
+#define M_1_PI 0.31830988618379067154
+#define M_2_PI 0.63661977236758134308
+#define M_2_SQRTPI 1.12837916709551257390
+#define M_SQRT2 1.41421356237309504880
+#define M_SQRT1_2 0.70710678118654752440
+# 1305 "/usr/include/math.h" 3 4
+#define isgreater(x,y) __builtin_isgreater(x, y)
+#define isgreaterequal(x,y) __builtin_isgreaterequal(x, y)
+#define isless(x,y) __builtin_isless(x, y)
+#define islessequal(x,y) __builtin_islessequal(x, y)
+#define islessgreater(x,y) __builtin_islessgreater(x, y)
+#define isunordered(x,y) __builtin_isunordered(x, y)
+# 1471 "/usr/include/math.h" 3 4
+
+# 22 "./src/main/common/vector.h" 2
+
+
+
+
+# 25 "./src/main/common/vector.h"
+typedef union {
+    float v[3];
+    struct {
+       float x,y,z;
+    };
+} fpVector3_t;
+
+typedef struct {
+    float m[3][3];
+} fpMat3_t;
+
+typedef struct {
+    fpVector3_t axis;
+    float angle;
+} fpAxisAngle_t;
+
+void rotationMatrixFromAngles(fpMat3_t * rmat, const fp_angles_t * angles);
+void rotationMatrixFromAxisAngle(fpMat3_t * rmat, const fpAxisAngle_t * a);
+
+static inline void vectorZero(fpVector3_t * v)
+{
+    v->x = 0.0f;
+    v->y = 0.0f;
+    v->z = 0.0f;
+}
+
+static inline fpVector3_t * rotationMatrixRotateVector(fpVector3_t * result, const fpVector3_t * a, const fpMat3_t * rmat)
+{
+    fpVector3_t r;
+
+    r.x = rmat->m[0][0] * a->x + rmat->m[1][0] * a->y + rmat->m[2][0] * a->z;
+    r.y = rmat->m[0][1] * a->x + rmat->m[1][1] * a->y + rmat->m[2][1] * a->z;
+    r.z = rmat->m[0][2] * a->x + rmat->m[1][2] * a->y + rmat->m[2][2] * a->z;
+
+    *result = r;
+    return result;
+}
+
+static inline float vectorNormSquared(const fpVector3_t * v)
+{
+    return ((v->x)*(v->x)) + ((v->y)*(v->y)) + ((v->z)*(v->z));
+}
+
+static inline fpVector3_t * vectorNormalize(fpVector3_t * result, const fpVector3_t * v)
+{
+    float length = sqrtf(vectorNormSquared(v));
+    if (length != 0) {
+        result->x = v->x / length;
+        result->y = v->y / length;
+        result->z = v->z / length;
+    }
+    else {
+        result->x = 0;
+        result->y = 0;
+        result->z = 0;
+    }
+    return result;
+}
+
+static inline fpVector3_t * vectorCrossProduct(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->y * b->z - a->z * b->y;
+    ab.y = a->z * b->x - a->x * b->z;
+    ab.z = a->x * b->y - a->y * b->x;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorAdd(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x + b->x;
+    ab.y = a->y + b->y;
+    ab.z = a->z + b->z;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorScale(fpVector3_t * result, const fpVector3_t * a, const float b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x * b;
+    ab.y = a->y * b;
+    ab.z = a->z * b;
+
+    *result = ab;
+    return result;
+}
+# 23 "./src/main/sensors/gyro.h" 2
+
+
+# 1 "./src/main/drivers/sensor.h" 1
+# 18 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/bus.h" 1
+# 25 "./src/main/drivers/bus.h"
+       
+
+
+
+
+
+
+
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 18 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+
+
+#define I2C_TIMEOUT (10000)
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+       
+
+typedef uint8_t rccPeriphTag_t;
+# 29 "./src/main/drivers/bus_i2c.h" 2
+
+typedef enum {
+    I2C_SPEED_100KHZ = 2,
+    I2C_SPEED_200KHZ = 3,
+    I2C_SPEED_400KHZ = 0,
+    I2C_SPEED_800KHZ = 1,
+} I2CSpeed;
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_EMULATED = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+
+
+
+    I2CDEV_COUNT
+} I2CDevice;
+
+typedef struct i2cDevice_s {
+    I2C_TypeDef *dev;
+    ioTag_t scl;
+    ioTag_t sda;
+    rccPeriphTag_t rcc;
+    I2CSpeed speed;
+
+
+
+
+
+} i2cDevice_t;
+
+void i2cSetSpeed(uint8_t speed);
+void i2cInit(I2CDevice device);
+
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, const uint8_t *data, 
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                                     _Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+                                                                                                          allowRawAccess);
+
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data, 
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                         _Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+                                                                              allowRawAccess);
+
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf, 
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                     _Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+                                                                                          allowRawAccess);
+
+uint16_t i2cGetErrorCounter(void);
+# 34 "./src/main/drivers/bus.h" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 18 "./src/main/drivers/bus_spi.h"
+       
+
+
+
+# 1 "./src/main/drivers/dma.h" 1
+# 18 "./src/main/drivers/dma.h"
+       
+
+
+
+struct dmaChannelDescriptor_s;
+
+typedef uint16_t dmaTag_t;
+typedef struct dmaChannelDescriptor_s * DMA_t;
+
+
+
+
+
+#define DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )
+#define DMA_NONE (0)
+
+#define DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )
+#define DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )
+#define DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )
+
+typedef void (*dmaCallbackHandlerFuncPtr)(DMA_t channelDescriptor);
+
+typedef struct dmaChannelDescriptor_s {
+    dmaTag_t tag;
+    DMA_TypeDef* dma;
+
+
+
+    DMA_Channel_TypeDef* ref;
+
+    dmaCallbackHandlerFuncPtr irqHandlerCallback;
+    uint32_t flagsShift;
+    IRQn_Type irqNumber;
+    uint32_t userParam;
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} dmaChannelDescriptor_t;
+# 87 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }
+# 97 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }
+
+
+
+
+#define DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)
+#define DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))
+
+#define DMA_IT_TCIF ((uint32_t)0x00000002)
+#define DMA_IT_HTIF ((uint32_t)0x00000004)
+#define DMA_IT_TEIF ((uint32_t)0x00000008)
+
+DMA_t dmaGetByRef(const DMA_Channel_TypeDef * ref);
+
+
+
+DMA_t dmaGetByTag(dmaTag_t tag);
+uint32_t dmaGetChannelByTag(dmaTag_t tag);
+resourceOwner_e dmaGetOwner(DMA_t dma);
+void dmaInit(DMA_t dma, resourceOwner_e owner, uint8_t resourceIndex);
+void dmaEnableClock(DMA_t dma);
+void dmaSetHandler(DMA_t dma, dmaCallbackHandlerFuncPtr callback, uint32_t priority, uint32_t userParam);
+void dmaCleanInterrupts(DMA_t dma);
+# 23 "./src/main/drivers/bus_spi.h" 2
+# 41 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATON = 0,
+    SPI_CLOCK_SLOW = 1,
+    SPI_CLOCK_STANDARD = 2,
+    SPI_CLOCK_FAST = 3,
+    SPI_CLOCK_ULTRAFAST = 4
+} SPIClockSpeed_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4
+} SPIDevice;
+
+
+
+
+
+
+#define SPIDEV_COUNT 4
+
+
+typedef struct SPIDevice_s {
+    SPI_TypeDef *dev;
+    ioTag_t nss;
+    ioTag_t sck;
+    ioTag_t mosi;
+    ioTag_t miso;
+    rccPeriphTag_t rcc;
+    uint8_t af;
+    const uint16_t * divisorMap;
+    volatile uint16_t errorCount;
+    
+# 75 "./src/main/drivers/bus_spi.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/bus_spi.h"
+        initDone;
+} spiDevice_t;
+
+
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+    spiInitDevice(SPIDevice device, 
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+                                    _Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+                                         leadingEdge);
+
+# 79 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 79 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+void spiSetSpeed(SPI_TypeDef *instance, SPIClockSpeed_e speed);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t in);
+
+# 82 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 82 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, uint8_t *rxData, const uint8_t *txData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef * spiInstanceByDevice(SPIDevice device);
+# 35 "./src/main/drivers/bus.h" 2
+
+
+#define BUS_SPI1 SPIDEV_1
+#define BUS_SPI2 SPIDEV_2
+#define BUS_SPI3 SPIDEV_3
+#define BUS_SPI4 SPIDEV_4
+
+#define BUS_I2C1 I2CDEV_1
+#define BUS_I2C2 I2CDEV_2
+#define BUS_I2C3 I2CDEV_3
+#define BUS_I2C4 I2CDEV_4
+#define BUS_I2C_EMULATED I2CINVALID
+
+#define BUS_SCRATCHPAD_MEMORY_SIZE (20)
+
+typedef enum {
+    BUS_SPEED_INITIALIZATION = 0,
+    BUS_SPEED_SLOW = 1,
+    BUS_SPEED_STANDARD = 2,
+    BUS_SPEED_FAST = 3,
+    BUS_SPEED_ULTRAFAST = 4
+} busSpeed_e;
+
+typedef enum {
+    BUSTYPE_ANY = 0,
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C = 1,
+    BUSTYPE_SPI = 2,
+    BUSTYPE_SDIO = 3,
+} busType_e;
+
+typedef enum {
+    BUSINDEX_1 = 0,
+    BUSINDEX_2 = 1,
+    BUSINDEX_3 = 2,
+    BUSINDEX_4 = 3
+} busIndex_e;
+
+
+
+typedef enum {
+    DEVHW_NONE = 0,
+
+
+    DEVHW_BMA280,
+    DEVHW_ADXL345,
+    DEVHW_MMA8452,
+    DEVHW_LSM303DLHC,
+
+
+    DEVHW_L3GD20,
+    DEVHW_L3G4200,
+
+
+    DEVHW_MPU3050,
+    DEVHW_MPU6000,
+    DEVHW_MPU6050,
+    DEVHW_MPU6500,
+    DEVHW_BMI160,
+    DEVHW_ICM20689,
+
+
+    DEVHW_MPU9250,
+
+
+    DEVHW_BMP085,
+    DEVHW_BMP280,
+    DEVHW_MS5611,
+    DEVHW_MS5607,
+    DEVHW_LPS25H,
+    DEVHW_SPL06,
+    DEVHW_BMP388,
+    DEVHW_DPS310,
+
+
+    DEVHW_HMC5883,
+    DEVHW_AK8963,
+    DEVHW_AK8975,
+    DEVHW_IST8310_0,
+    DEVHW_IST8310_1,
+    DEVHW_IST8308,
+    DEVHW_QMC5883,
+    DEVHW_MAG3110,
+    DEVHW_LIS3MDL,
+
+
+    DEVHW_LM75_0,
+    DEVHW_LM75_1,
+    DEVHW_LM75_2,
+    DEVHW_LM75_3,
+    DEVHW_LM75_4,
+    DEVHW_LM75_5,
+    DEVHW_LM75_6,
+    DEVHW_LM75_7,
+
+
+    DEVHW_DS2482,
+
+
+    DEVHW_MAX7456,
+
+
+    DEVHW_SRF10,
+    DEVHW_HCSR04_I2C,
+    DEVHW_VL53L0X,
+
+
+    DEVHW_MS4525,
+    DEVHW_PCA9685,
+    DEVHW_M25P16,
+    DEVHW_UG2864,
+    DEVHW_SDCARD,
+    DEVHW_IRLOCK,
+} devHardwareType_e;
+
+typedef enum {
+    DEVFLAGS_NONE = 0,
+    DEVFLAGS_USE_RAW_REGISTERS = (1 << 0),
+
+
+    DEVFLAGS_USE_MANUAL_DEVICE_SELECT = (1 << 1),
+    DEVFLAGS_SPI_MODE_0 = (1 << 2),
+} deviceFlags_e;
+
+typedef struct busDeviceDescriptor_s {
+    void * devicePtr;
+    busType_e busType;
+    devHardwareType_e devHwType;
+    uint8_t flags;
+    uint8_t tag;
+    uint8_t param;
+    union {
+# 179 "./src/main/drivers/bus.h"
+    } busdev;
+    ioTag_t irqPin;
+} busDeviceDescriptor_t;
+
+typedef struct busDevice_s {
+    const busDeviceDescriptor_t * descriptorPtr;
+    busType_e busType;
+    uint32_t flags;
+    uint32_t param;
+    union {
+# 201 "./src/main/drivers/bus.h"
+    } busdev;
+    IO_t irqPin;
+    uint32_t * scratchpad;
+
+
+} busDevice_t;
+
+
+
+
+
+
+extern const busDeviceDescriptor_t __busdev_registry_start[];
+extern const busDeviceDescriptor_t __busdev_registry_end[];
+#define BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(".busdev_registry"), used, aligned(4)))
+
+
+#define BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 237 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 256 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)
+
+
+
+
+typedef struct busTransferDescriptor_s {
+    uint8_t * rxBuf;
+    const uint8_t * txBuf;
+    uint32_t length;
+} busTransferDescriptor_t;
+
+
+
+# 277 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 277 "./src/main/drivers/bus.h"
+    i2cBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 278 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 278 "./src/main/drivers/bus.h"
+    i2cBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 279 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 279 "./src/main/drivers/bus.h"
+    i2cBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 280 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 280 "./src/main/drivers/bus.h"
+    i2cBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+
+
+# 282 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 282 "./src/main/drivers/bus.h"
+    spiBusInitHost(const busDevice_t * dev);
+
+# 283 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 283 "./src/main/drivers/bus.h"
+    spiBusIsBusy(const busDevice_t * dev);
+void spiBusSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+# 285 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 285 "./src/main/drivers/bus.h"
+    spiBusTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 286 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 286 "./src/main/drivers/bus.h"
+    spiBusTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * dsc, int count);
+
+# 287 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 287 "./src/main/drivers/bus.h"
+    spiBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 288 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 288 "./src/main/drivers/bus.h"
+    spiBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 289 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 289 "./src/main/drivers/bus.h"
+    spiBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 290 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 290 "./src/main/drivers/bus.h"
+    spiBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+void spiBusSelectDevice(const busDevice_t * dev);
+void spiBusDeselectDevice(const busDevice_t * dev);
+
+
+
+void busInit(void);
+
+
+busDevice_t * busDeviceInit(busType_e bus, devHardwareType_e hw, uint8_t tag, resourceOwner_e owner);
+busDevice_t * busDeviceOpen(busType_e bus, devHardwareType_e hw, uint8_t tag);
+void busDeviceDeInit(busDevice_t * dev);
+
+uint32_t busDeviceReadScratchpad(const busDevice_t * dev);
+void busDeviceWriteScratchpad(busDevice_t * dev, uint32_t value);
+void * busDeviceGetScratchpadMemory(const busDevice_t * dev);
+
+void busSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+
+void busSelectDevice(const busDevice_t * dev);
+void busDeselectDevice(const busDevice_t * dev);
+
+
+# 313 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 313 "./src/main/drivers/bus.h"
+    busWriteBuf(const busDevice_t * busdev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 314 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 314 "./src/main/drivers/bus.h"
+    busReadBuf(const busDevice_t * busdev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 315 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 315 "./src/main/drivers/bus.h"
+    busRead(const busDevice_t * busdev, uint8_t reg, uint8_t * data);
+
+# 316 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 316 "./src/main/drivers/bus.h"
+    busWrite(const busDevice_t * busdev, uint8_t reg, uint8_t data);
+
+
+# 318 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 318 "./src/main/drivers/bus.h"
+    busTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 319 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 319 "./src/main/drivers/bus.h"
+    busTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * buffers, int count);
+
+
+# 321 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 321 "./src/main/drivers/bus.h"
+    busIsBusy(const busDevice_t * dev);
+# 25 "./src/main/drivers/sensor.h" 2
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInitFuncPtr)(void);
+typedef 
+# 39 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 39 "./src/main/drivers/sensor.h"
+            (*sensorReadFuncPtr)(int16_t *data);
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 43 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 43 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 46 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 46 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroUpdateFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+typedef 
+# 49 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 49 "./src/main/drivers/sensor.h"
+            (*sensorGyroInterruptStatusFuncPtr)(struct gyroDev_s *gyro);
+struct magDev_s;
+typedef 
+# 51 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 51 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *mag);
+typedef 
+# 52 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 52 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *mag);
+struct temperatureDev_s;
+typedef 
+# 54 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 54 "./src/main/drivers/sensor.h"
+            (*sensorTempReadFuncPtr)(struct temperatureDev_s *tempDev, int16_t *temperature);
+struct opflowDev_s;
+typedef 
+# 56 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 56 "./src/main/drivers/sensor.h"
+            (*sensorOpflowInitFuncPtr)(struct opflowDev_s *mag);
+typedef 
+# 57 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 57 "./src/main/drivers/sensor.h"
+            (*sensorOpflowUpdateFuncPtr)(struct opflowDev_s *mag);
+# 26 "./src/main/sensors/gyro.h" 2
+
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_AUTODETECT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_BMI160,
+    GYRO_ICM20689,
+    GYRO_FAKE
+} gyroSensor_e;
+
+typedef enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW
+} dynamicFilterRange_e;
+
+typedef enum {
+    DYN_NOTCH_ANALYSER_FFT = 0,
+    DYN_NOTCH_ANALYSER_SDFT
+} dynamicFilterAnalyser_e;
+
+#define DYN_NOTCH_RANGE_HZ_HIGH 2000
+#define DYN_NOTCH_RANGE_HZ_MEDIUM 1333
+#define DYN_NOTCH_RANGE_HZ_LOW 1000
+
+#define GYRO_PID_PROCESS_DENOM_MAX 8
+
+typedef struct gyro_s {
+    
+# 60 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 60 "./src/main/sensors/gyro.h"
+        initialized;
+    uint32_t targetLooptime;
+    uint32_t sampleLooptime;
+    uint8_t pidProcessDenom;
+    
+# 64 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 64 "./src/main/sensors/gyro.h"
+        sampleBufferActive;
+    timeUs_t lastSampleTimeUs;
+    timeDelta_t sampleDeltaTimeUs;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+typedef struct gyroConfig_s {
+    sensor_align_e gyro_align;
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyroSync;
+    uint16_t looptime;
+    uint8_t pidProcessDenom;
+    uint8_t gyro_lpf;
+    uint8_t gyro_soft_lpf_hz;
+    uint8_t gyro_soft_lpf_type;
+    uint8_t gyro_to_use;
+    uint16_t gyro_notch_hz;
+    uint16_t gyro_notch_cutoff;
+    uint16_t gyro_stage2_lowpass_hz;
+    uint8_t gyro_stage2_lowpass_type;
+    uint8_t dynamicGyroNotchRange;
+    uint16_t dynamicGyroNotchQ;
+    uint16_t dynamicGyroNotchMinHz;
+    uint8_t dynamicGyroNotchEnabled;
+    uint8_t dynamicGyroNotchAnalyser;
+    uint8_t dynamicGyroNotchCount;
+    uint16_t kalman_q;
+    uint16_t kalman_w;
+    uint16_t kalman_sharpness;
+    uint8_t kalmanEnabled;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+typedef enum {
+    GYRO_STAGE_RAW = 0,
+    GYRO_STAGE_RPM_FILTER,
+    GYRO_STAGE_LPF2,
+    GYRO_STAGE_LPF,
+    GYRO_STAGE_NOTCH,
+    GYRO_STAGE_DYN_NOTCH,
+    GYRO_STAGE_KALMAN,
+    GYRO_STAGE_COUNT
+} gyroFilterStage_e;
+
+
+
+void gyroStageProbe(gyroFilterStage_e stage, int axis, float value);
+#define GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)
+#define GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)
+
+
+
+
+
+
+# 121 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 121 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+void gyroGetMeasuredRotationRate(fpVector3_t *imuMeasuredRotationBF);
+void gyroUpdate(void);
+void gyroStartCalibration(void);
+
+# 125 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 125 "./src/main/sensors/gyro.h"
+    gyroIsCalibrationComplete(void);
+
+# 126 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 126 "./src/main/sensors/gyro.h"
+    gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 129 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/gyro.h"
+    gyroSyncCheckUpdate(void);
+void gyroSyncDisable(void);
+uint32_t gyroGetSampleBufferOverflowCount(void);
+# 45 "./src/main/blackbox/blackbox_io.c" 2
+
+#define BLACKBOX_SERIAL_PORT_MODE MODE_TX
+
+
+static uint8_t blackboxMaxHeaderBytesPerIteration;
+
+
+int32_t blackboxHeaderBudget;
+
+blackboxWriteBuffer_t blackboxWriteBuffer;
+
+static serialPort_t *blackboxPort = 
+# 56 "./src/main/blackbox/blackbox_io.c" 3 4
+                                               ((void *)0)
+# 56 "./src/main/blackbox/blackbox_io.c"
+                                                   ;
+
+static portSharing_e blackboxPortSharing;
+# 82 "./src/main/blackbox/blackbox_io.c"
+void blackboxOpen(void)
+{
+    serialPort_t *sharedBlackboxAndMspPort = findSharedSerialPort(FUNCTION_BLACKBOX, FUNCTION_MSP);
+    if (sharedBlackboxAndMspPort) {
+        mspSerialReleasePortIfAllocated(sharedBlackboxAndMspPort);
+    }
+}
+
+
+static void blackboxDeviceWrite(const uint8_t *data, int count)
+{
+    switch (blackboxConfig()->device) {
+# 104 "./src/main/blackbox/blackbox_io.c"
+    case BLACKBOX_DEVICE_SERIAL:
+    default:
+
+
+
+
+        if (blackboxPort->txBufferSize) {
+            count = ( __extension__ ({ __typeof__(count) _left0 = (count); __typeof__((int) serialTxBytesFree(blackboxPort)) _right1 = ((int) serialTxBytesFree(blackboxPort)); _left0 < _right1 ? _left0 : _right1; }));
+        }
+        serialWriteBuf(blackboxPort, data, count);
+        break;
+    }
+}
+
+
+
+
+void blackboxWriteBufferFlush(void)
+{
+    if (blackboxWriteBuffer.length) {
+        blackboxDeviceWrite(blackboxWriteBuffer.data, blackboxWriteBuffer.length);
+        blackboxWriteBuffer.flushedBytes += blackboxWriteBuffer.length;
+        blackboxWriteBuffer.length = 0;
+    }
+}
+
+void blackboxWriteBuf(const uint8_t *data, int count)
+{
+    while (count > 0) {
+        if (blackboxWriteBuffer.length == 256) {
+            blackboxWriteBufferFlush();
+        }
+
+        const int chunk = ( __extension__ ({ __typeof__(count) _left2 = (count); __typeof__(256 - blackboxWriteBuffer.length) _right3 = (256 - blackboxWriteBuffer.length); _left2 < _right3 ? _left2 : _right3; }));
+        memcpy(&blackboxWriteBuffer.data[blackboxWriteBuffer.length], data, chunk);
+        blackboxWriteBuffer.length += chunk;
+        data += chunk;
+        count -= chunk;
+    }
+}
+
+
+int blackboxPrint(const char *s)
+{
+    const int length = strlen(s);
+
+    blackboxWriteBuf((const uint8_t *) s, length);
+
+    return length;
+}
+
+
+
+
+
+
+void blackboxDeviceFlush(void)
+{
+    blackboxWriteBufferFlush();
+
+    switch (blackboxConfig()->device) {
+# 175 "./src/main/blackbox/blackbox_io.c"
+    default:
+        ;
+    }
+}
+
+
+
+
+
+
+
+# 185 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 185 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceFlushForce(void)
+{
+    blackboxWriteBufferFlush();
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+        return isSerialTransmitBufferEmpty(blackboxPort);
+# 207 "./src/main/blackbox/blackbox_io.c"
+    default:
+        return 
+# 208 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 208 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+
+
+
+
+# 216 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 216 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceOpen(void)
+{
+    blackboxWriteBuffer.length = 0;
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        {
+            serialPortConfig_t *portConfig = findSerialPortConfig(FUNCTION_BLACKBOX);
+            baudRate_e baudRateIndex;
+            portOptions_t portOptions = SERIAL_PARITY_NO | SERIAL_NOT_INVERTED;
+
+            if (!portConfig) {
+                return 
+# 228 "./src/main/blackbox/blackbox_io.c" 3 4
+                      0
+# 228 "./src/main/blackbox/blackbox_io.c"
+                           ;
+            }
+
+            blackboxPortSharing = determinePortSharing(portConfig, FUNCTION_BLACKBOX);
+            baudRateIndex = portConfig->peripheral_baudrateIndex;
+
+            if (baudRates[baudRateIndex] == 230400) {
+
+
+
+
+                portOptions |= SERIAL_STOPBITS_2;
+            } else {
+                portOptions |= SERIAL_STOPBITS_1;
+            }
+
+            blackboxPort = openSerialPort(portConfig->identifier, FUNCTION_BLACKBOX, 
+# 244 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                                    ((void *)0)
+# 244 "./src/main/blackbox/blackbox_io.c"
+                                                                                        , 
+# 244 "./src/main/blackbox/blackbox_io.c" 3 4
+                                                                                          ((void *)0)
+# 244 "./src/main/blackbox/blackbox_io.c"
+                                                                                              , baudRates[baudRateIndex],
+                MODE_TX, portOptions);
+# 257 "./src/main/blackbox/blackbox_io.c"
+            blackboxMaxHeaderBytesPerIteration = constrain((gyro.targetLooptime * 3) / 500, 1, 64);
+
+            return blackboxPort != 
+# 259 "./src/main/blackbox/blackbox_io.c" 3 4
+                                  ((void *)0)
+# 259 "./src/main/blackbox/blackbox_io.c"
+                                      ;
+        }
+        break;
+# 284 "./src/main/blackbox/blackbox_io.c"
+    default:
+        return 
+# 285 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 285 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+
+
+
+
+void blackboxDeviceClose(void)
+{
+    blackboxWriteBuffer.length = 0;
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+        closeSerialPort(blackboxPort);
+        blackboxPort = 
+# 302 "./src/main/blackbox/blackbox_io.c" 3 4
+                      ((void *)0)
+# 302 "./src/main/blackbox/blackbox_io.c"
+                          ;
+
+
+
+
+
+        if (blackboxPortSharing == PORTSHARING_SHARED) {
+            mspSerialAllocatePorts();
+        }
+        break;
+    default:
+        ;
+    }
+}
+# 453 "./src/main/blackbox/blackbox_io.c"
+
+# 453 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 453 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceBeginLog(void)
+{
+    switch (blackboxConfig()->device) {
+
+
+
+
+    default:
+        return 
+# 461 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 461 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+
+}
+# 473 "./src/main/blackbox/blackbox_io.c"
+
+# 473 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 473 "./src/main/blackbox/blackbox_io.c"
+    blackboxDeviceEndLog(
+# 473 "./src/main/blackbox/blackbox_io.c" 3 4
+                         _Bool 
+# 473 "./src/main/blackbox/blackbox_io.c"
+                              retainLog)
+{
+
+    (void) retainLog;
+
+
+    blackboxWriteBufferFlush();
+
+    switch (blackboxConfig()->device) {
+# 496 "./src/main/blackbox/blackbox_io.c"
+    default:
+        return 
+# 497 "./src/main/blackbox/blackbox_io.c" 3 4
+              1
+# 497 "./src/main/blackbox/blackbox_io.c"
+                  ;
+    }
+}
+
+
+# 501 "./src/main/blackbox/blackbox_io.c" 3 4
+_Bool 
+# 501 "./src/main/blackbox/blackbox_io.c"
+    isBlackboxDeviceFull(void)
+{
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        return 
+# 505 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 505 "./src/main/blackbox/blackbox_io.c"
+                   ;
+# 517 "./src/main/blackbox/blackbox_io.c"
+    default:
+        return 
+# 518 "./src/main/blackbox/blackbox_io.c" 3 4
+              0
+# 518 "./src/main/blackbox/blackbox_io.c"
+                   ;
+    }
+}
+
+
+
+
+
+void blackboxReplenishHeaderBudget(void)
+{
+    int32_t freeSpace;
+
+    blackboxWriteBufferFlush();
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+        freeSpace = serialTxBytesFree(blackboxPort);
+        break;
+# 546 "./src/main/blackbox/blackbox_io.c"
+    default:
+        freeSpace = 0;
+    }
+
+    blackboxHeaderBudget = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(freeSpace) _left4 = (freeSpace); __typeof__(blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration) _right5 = (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration); _left4 < _right5 ? _left4 : _right5; }))) _left6 = (( __extension__ ({ __typeof__(freeSpace) _left4 = (freeSpace); __typeof__(blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration) _right5 = (blackboxHeaderBudget + blackboxMaxHeaderBytesPerIteration); _left4 < _right5 ? _left4 : _right5; }))); __typeof__(256) _right7 = (256); _left6 < _right7 ? _left6 : _right7; }));
+}
+# 571 "./src/main/blackbox/blackbox_io.c"
+blackboxBufferReserveStatus_e blackboxDeviceReserveBufferSpace(int32_t bytes)
+{
+    if (bytes <= blackboxHeaderBudget) {
+        return BLACKBOX_RESERVE_SUCCESS;
+    }
+
+
+    switch (blackboxConfig()->device) {
+    case BLACKBOX_DEVICE_SERIAL:
+
+
+
+
+        if (blackboxPort->txBufferSize && bytes > (int32_t) blackboxPort->txBufferSize - 1) {
+            return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+        }
+
+        return BLACKBOX_RESERVE_TEMPORARY_FAILURE;
+# 614 "./src/main/blackbox/blackbox_io.c"
+    default:
+        return BLACKBOX_RESERVE_PERMANENT_FAILURE;
+    }
+}
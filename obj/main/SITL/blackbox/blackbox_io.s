@@ -0,0 +1,16689 @@
+	.file	"blackbox_io.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/blackbox/blackbox.h"
+	.file 7 "./src/main/blackbox/blackbox_io.h"
+	.file 8 "./src/main/drivers/flash.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/drivers/serial.h"
+	.file 11 "./src/main/io/serial.h"
+	.file 12 "./src/main/sensors/gyro.h"
+	.file 13 "./src/main/blackbox/blackbox_io.c"
+	.file 14 "./src/main/common/maths.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/msp/msp_serial.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	blackbox_io.c.954d5019
+	.weak	blackbox_io.c.954d5019
+blackbox_io.c.954d5019:
+	.long	0xe18
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF2417
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.long	.LASF2129
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2122
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x35
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2123
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2124
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2125
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2126
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2127
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2128
+	.uleb128 0x4
+	.long	.LASF2130
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2131
+	.uleb128 0x4
+	.long	.LASF2132
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x56
+	.uleb128 0x4
+	.long	.LASF2133
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x35
+	.uleb128 0x4
+	.long	.LASF2134
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0x4
+	.long	.LASF2135
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2136
+	.uleb128 0x8
+	.long	0xb0
+	.uleb128 0x4
+	.long	.LASF2137
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x8a
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2138
+	.uleb128 0x5
+	.long	0xd4
+	.uleb128 0x22
+	.uleb128 0x5
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF2139
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x8
+	.long	0xda
+	.uleb128 0x23
+	.long	0xda
+	.uleb128 0x4
+	.long	.LASF2140
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x4
+	.long	.LASF2141
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x8
+	.long	0xfc
+	.uleb128 0x4
+	.long	.LASF2142
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF2143
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x11
+	.long	0xbc
+	.uleb128 0x4
+	.long	.LASF2144
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0x10d
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2145
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2146
+	.uleb128 0xe
+	.long	.LASF2159
+	.byte	0x8
+	.byte	0x6
+	.byte	0x18
+	.byte	0x10
+	.long	0x18e
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x6
+	.byte	0x19
+	.byte	0xe
+	.long	0xf0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0x6
+	.byte	0x1a
+	.byte	0xe
+	.long	0xf0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0x6
+	.byte	0x1b
+	.byte	0xd
+	.long	0xda
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xd
+	.long	0xda
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xd
+	.long	0xda
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2152
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x13f
+	.uleb128 0x8
+	.long	0x18e
+	.uleb128 0x10
+	.long	.LASF2165
+	.byte	0x6
+	.byte	0x20
+	.byte	0x19
+	.long	0x18e
+	.uleb128 0x14
+	.long	.LASF2237
+	.long	0x5d
+	.byte	0x7
+	.byte	0x19
+	.long	0x1c7
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x1
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0x7
+	.byte	0x26
+	.long	0x1e6
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2158
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1c7
+	.uleb128 0x24
+	.long	.LASF2160
+	.value	0x108
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x10
+	.long	0x228
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0x7
+	.byte	0x40
+	.byte	0xe
+	.long	0xfc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0x7
+	.byte	0x41
+	.byte	0xe
+	.long	0xf0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0x7
+	.byte	0x42
+	.byte	0xd
+	.long	0x228
+	.byte	0x6
+	.byte	0
+	.uleb128 0x15
+	.long	0xda
+	.long	0x238
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0xff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2164
+	.byte	0x7
+	.byte	0x43
+	.byte	0x3
+	.long	0x1f2
+	.uleb128 0x10
+	.long	.LASF2166
+	.byte	0x7
+	.byte	0x45
+	.byte	0x10
+	.long	0xbc
+	.uleb128 0x10
+	.long	.LASF2167
+	.byte	0x7
+	.byte	0x46
+	.byte	0x1e
+	.long	0x238
+	.uleb128 0x15
+	.long	0x138
+	.long	0x26c
+	.uleb128 0x17
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0x8
+	.byte	0x45
+	.long	0x2b5
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x9
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0x9
+	.byte	0x16
+	.long	0x3a6
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0x9
+	.byte	0x43
+	.long	0x431
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x14
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2238
+	.long	0x5d
+	.byte	0xa
+	.byte	0x1a
+	.long	0x453
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2238
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x3
+	.long	0x431
+	.uleb128 0x14
+	.long	.LASF2242
+	.long	0x5d
+	.byte	0xa
+	.byte	0x20
+	.long	0x4b1
+	.uleb128 0x1
+	.long	.LASF2243
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2244
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2245
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2246
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2247
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2248
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2249
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2242
+	.byte	0xa
+	.byte	0x34
+	.byte	0x3
+	.long	0x45f
+	.uleb128 0xe
+	.long	.LASF2254
+	.byte	0x10
+	.byte	0xa
+	.byte	0x37
+	.byte	0x10
+	.long	0x4e5
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0xa
+	.byte	0x38
+	.byte	0x14
+	.long	0x4e5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0xa
+	.byte	0x39
+	.byte	0x9
+	.long	0x35
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xe6
+	.uleb128 0x4
+	.long	.LASF2256
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x3
+	.long	0x4bd
+	.uleb128 0x8
+	.long	0x4ea
+	.uleb128 0x4
+	.long	.LASF2257
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x10
+	.long	0x507
+	.uleb128 0x5
+	.long	0x50c
+	.uleb128 0xa
+	.long	0x51c
+	.uleb128 0x3
+	.long	0xf0
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2258
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x10
+	.long	0x528
+	.uleb128 0x5
+	.long	0x52d
+	.uleb128 0xa
+	.long	0x542
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2259
+	.byte	0x60
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x10
+	.long	0x62d
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0xa
+	.byte	0x41
+	.byte	0x24
+	.long	0x6e9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0xa
+	.byte	0x43
+	.byte	0xd
+	.long	0xda
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0xa
+	.byte	0x44
+	.byte	0x10
+	.long	0x453
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0xa
+	.byte	0x45
+	.byte	0x13
+	.long	0x4b1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0xa
+	.byte	0x47
+	.byte	0xe
+	.long	0xfc
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2265
+	.byte	0xa
+	.byte	0x49
+	.byte	0xe
+	.long	0xfc
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2266
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfc
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0xa
+	.byte	0x4b
+	.byte	0x17
+	.long	0x6ee
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0xa
+	.byte	0x4c
+	.byte	0x17
+	.long	0x6ee
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xe
+	.long	0xfc
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0xfc
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xfc
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xfc
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2273
+	.byte	0xa
+	.byte	0x52
+	.byte	0x1e
+	.long	0x4fb
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0xa
+	.byte	0x53
+	.byte	0xb
+	.long	0xae
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2275
+	.byte	0xa
+	.byte	0x55
+	.byte	0x23
+	.long	0x51c
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2276
+	.byte	0xa
+	.byte	0x58
+	.byte	0xe
+	.long	0xfc
+	.byte	0x58
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2277
+	.byte	0x68
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x8
+	.long	0x6e4
+	.uleb128 0x2
+	.long	.LASF2278
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xc
+	.long	0x719
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2279
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x10
+	.long	0x732
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0xa
+	.byte	0x5f
+	.byte	0x10
+	.long	0x732
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0xa
+	.byte	0x61
+	.byte	0xf
+	.long	0x746
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0xa
+	.byte	0x64
+	.byte	0xc
+	.long	0x75b
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0xa
+	.byte	0x66
+	.byte	0xb
+	.long	0x76f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0xa
+	.byte	0x68
+	.byte	0xc
+	.long	0x784
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2285
+	.byte	0xa
+	.byte	0x6a
+	.byte	0xc
+	.long	0x79e
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2286
+	.byte	0xa
+	.byte	0x6c
+	.byte	0xb
+	.long	0x76f
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2287
+	.byte	0xa
+	.byte	0x6e
+	.byte	0xb
+	.long	0x7b2
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0xa
+	.byte	0x71
+	.byte	0xc
+	.long	0x7c2
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0xa
+	.byte	0x72
+	.byte	0xc
+	.long	0x7c2
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0xa
+	.byte	0x75
+	.byte	0xc
+	.long	0x7e1
+	.byte	0x60
+	.byte	0
+	.uleb128 0x8
+	.long	0x62d
+	.uleb128 0x5
+	.long	0x6e4
+	.uleb128 0x5
+	.long	0xeb
+	.uleb128 0x4
+	.long	.LASF2291
+	.byte	0xa
+	.byte	0x59
+	.byte	0x3
+	.long	0x542
+	.uleb128 0x8
+	.long	0x6f3
+	.uleb128 0xa
+	.long	0x714
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0xda
+	.byte	0
+	.uleb128 0x5
+	.long	0x6f3
+	.uleb128 0x5
+	.long	0x704
+	.uleb128 0x11
+	.long	0xfc
+	.long	0x72d
+	.uleb128 0x3
+	.long	0x72d
+	.byte	0
+	.uleb128 0x5
+	.long	0x6ff
+	.uleb128 0x5
+	.long	0x71e
+	.uleb128 0x11
+	.long	0xda
+	.long	0x746
+	.uleb128 0x3
+	.long	0x714
+	.byte	0
+	.uleb128 0x5
+	.long	0x737
+	.uleb128 0xa
+	.long	0x75b
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0xfc
+	.byte	0
+	.uleb128 0x5
+	.long	0x74b
+	.uleb128 0x11
+	.long	0x131
+	.long	0x76f
+	.uleb128 0x3
+	.long	0x72d
+	.byte	0
+	.uleb128 0x5
+	.long	0x760
+	.uleb128 0xa
+	.long	0x784
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0x453
+	.byte	0
+	.uleb128 0x5
+	.long	0x774
+	.uleb128 0xa
+	.long	0x79e
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0xcf
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x789
+	.uleb128 0x11
+	.long	0x131
+	.long	0x7b2
+	.uleb128 0x3
+	.long	0x714
+	.byte	0
+	.uleb128 0x5
+	.long	0x7a3
+	.uleb128 0xa
+	.long	0x7c2
+	.uleb128 0x3
+	.long	0x714
+	.byte	0
+	.uleb128 0x5
+	.long	0x7b7
+	.uleb128 0xa
+	.long	0x7dc
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0x7dc
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0x5
+	.long	0x4f6
+	.uleb128 0x5
+	.long	0x7c7
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0xb
+	.byte	0x1a
+	.long	0x805
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2295
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x3
+	.long	0x7e6
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0xb
+	.byte	0x20
+	.long	0x8cb
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF2305
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF2306
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF2307
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF2308
+	.value	0x800
+	.uleb128 0xb
+	.long	.LASF2309
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF2310
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF2311
+	.value	0x4000
+	.uleb128 0xb
+	.long	.LASF2312
+	.value	0x8000
+	.uleb128 0xd
+	.long	.LASF2313
+	.long	0x10000
+	.uleb128 0xd
+	.long	.LASF2314
+	.long	0x20000
+	.uleb128 0xd
+	.long	.LASF2315
+	.long	0x40000
+	.uleb128 0xd
+	.long	.LASF2316
+	.long	0x80000
+	.uleb128 0xd
+	.long	.LASF2317
+	.long	0x100000
+	.uleb128 0xd
+	.long	.LASF2318
+	.long	0x200000
+	.uleb128 0xd
+	.long	.LASF2319
+	.long	0x400000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2320
+	.byte	0xb
+	.byte	0x39
+	.byte	0x3
+	.long	0x811
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x5d
+	.byte	0xb
+	.byte	0x3b
+	.long	0x94a
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2338
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x3
+	.long	0x8d7
+	.uleb128 0x15
+	.long	0x108
+	.long	0x961
+	.uleb128 0x25
+	.byte	0
+	.uleb128 0x8
+	.long	0x956
+	.uleb128 0x10
+	.long	.LASF2339
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x17
+	.long	0x961
+	.uleb128 0x9
+	.byte	0x5
+	.long	0x35
+	.byte	0xb
+	.byte	0x52
+	.long	0x9cd
+	.uleb128 0x26
+	.long	.LASF2340
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2353
+	.byte	0xb
+	.byte	0x60
+	.byte	0x3
+	.long	0x972
+	.uleb128 0xe
+	.long	.LASF2354
+	.byte	0xc
+	.byte	0xb
+	.byte	0x73
+	.byte	0x10
+	.long	0xa35
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0xb
+	.byte	0x74
+	.byte	0xe
+	.long	0xfc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0xb
+	.byte	0x75
+	.byte	0x1c
+	.long	0x9cd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0xb
+	.byte	0x76
+	.byte	0xd
+	.long	0xda
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0xb
+	.byte	0x77
+	.byte	0xd
+	.long	0xda
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0xb
+	.byte	0x78
+	.byte	0xd
+	.long	0xda
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0xb
+	.byte	0x79
+	.byte	0xd
+	.long	0xda
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2360
+	.byte	0xb
+	.byte	0x7a
+	.byte	0x3
+	.long	0x9d9
+	.uleb128 0x8
+	.long	0xa35
+	.uleb128 0x5
+	.long	0x542
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2361
+	.uleb128 0xe
+	.long	.LASF2362
+	.byte	0x28
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x10
+	.long	0xac8
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x131
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2364
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0xfc
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2365
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xe
+	.long	0xfc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2366
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xd
+	.long	0xda
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x131
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2368
+	.byte	0xc
+	.byte	0x41
+	.byte	0xe
+	.long	0x125
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2369
+	.byte	0xc
+	.byte	0x42
+	.byte	0x11
+	.long	0x119
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2370
+	.byte	0xc
+	.byte	0x43
+	.byte	0xb
+	.long	0x25c
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2371
+	.byte	0xc
+	.byte	0x44
+	.byte	0x3
+	.long	0xa52
+	.uleb128 0x10
+	.long	.LASF2372
+	.byte	0xc
+	.byte	0x46
+	.byte	0xf
+	.long	0xac8
+	.uleb128 0x7
+	.long	.LASF2373
+	.byte	0x31
+	.byte	0x10
+	.long	0xda
+	.uleb128 0x18
+	.long	0x244
+	.byte	0x34
+	.byte	0x9
+	.uleb128 0x18
+	.long	0x250
+	.byte	0x36
+	.byte	0x17
+	.uleb128 0x7
+	.long	.LASF2374
+	.byte	0x38
+	.byte	0x16
+	.long	0x714
+	.uleb128 0x7
+	.long	.LASF2375
+	.byte	0x3a
+	.byte	0x16
+	.long	0x805
+	.uleb128 0x27
+	.long	.LASF2393
+	.byte	0x10
+	.byte	0x6d
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2382
+	.byte	0xb
+	.byte	0xa3
+	.long	0xb28
+	.uleb128 0x3
+	.long	0x714
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2376
+	.byte	0xe
+	.byte	0x87
+	.byte	0x5
+	.long	0x35
+	.long	0xb48
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2377
+	.byte	0xb
+	.byte	0x9a
+	.byte	0xf
+	.long	0x714
+	.long	0xb7c
+	.uleb128 0x3
+	.long	0x9cd
+	.uleb128 0x3
+	.long	0x8cb
+	.uleb128 0x3
+	.long	0x4fb
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x3
+	.long	0xfc
+	.uleb128 0x3
+	.long	0x453
+	.uleb128 0x3
+	.long	0x4b1
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2378
+	.byte	0xb
+	.byte	0x92
+	.byte	0xf
+	.long	0x805
+	.long	0xb97
+	.uleb128 0x3
+	.long	0xb97
+	.uleb128 0x3
+	.long	0x8cb
+	.byte	0
+	.uleb128 0x5
+	.long	0xa41
+	.uleb128 0xc
+	.long	.LASF2379
+	.byte	0xb
+	.byte	0x8f
+	.byte	0x15
+	.long	0xbb2
+	.long	0xbb2
+	.uleb128 0x3
+	.long	0x8cb
+	.byte	0
+	.uleb128 0x5
+	.long	0xa35
+	.uleb128 0xc
+	.long	.LASF2283
+	.byte	0xa
+	.byte	0x81
+	.byte	0x5
+	.long	0x131
+	.long	0xbcd
+	.uleb128 0x3
+	.long	0x72d
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2380
+	.byte	0xf
+	.value	0x197
+	.byte	0xf
+	.long	0x22
+	.long	0xbe4
+	.uleb128 0x3
+	.long	0xd5
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2381
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xe
+	.long	0xae
+	.long	0xc04
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x3
+	.long	0xcf
+	.uleb128 0x3
+	.long	0x22
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2383
+	.byte	0xa
+	.byte	0x7b
+	.long	0xc1f
+	.uleb128 0x3
+	.long	0x714
+	.uleb128 0x3
+	.long	0x4e5
+	.uleb128 0x3
+	.long	0x35
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2384
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xa
+	.long	0xfc
+	.long	0xc35
+	.uleb128 0x3
+	.long	0x72d
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2385
+	.byte	0x10
+	.byte	0x6e
+	.long	0xc46
+	.uleb128 0x3
+	.long	0xa46
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2386
+	.byte	0xb
+	.byte	0x6d
+	.byte	0xf
+	.long	0x714
+	.long	0xc61
+	.uleb128 0x3
+	.long	0xfc
+	.uleb128 0x3
+	.long	0x8cb
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2387
+	.value	0x23b
+	.byte	0x1f
+	.long	0x1e6
+	.long	0xc7e
+	.uleb128 0x1a
+	.long	.LASF2396
+	.value	0x23b
+	.byte	0x48
+	.long	0xbc
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2407
+	.byte	0xd
+	.value	0x20e
+	.byte	0x6
+	.long	0xcc9
+	.uleb128 0x2a
+	.long	.LASF2388
+	.byte	0xd
+	.value	0x210
+	.byte	0xd
+	.long	0xbc
+	.uleb128 0xf
+	.uleb128 0x12
+	.long	.LASF2389
+	.value	0x130
+	.long	0x35
+	.uleb128 0x12
+	.long	.LASF2390
+	.value	0x241
+	.long	0x35
+	.uleb128 0xf
+	.uleb128 0x12
+	.long	.LASF2391
+	.value	0x163
+	.long	0xbc
+	.uleb128 0x12
+	.long	.LASF2392
+	.value	0x1bf
+	.long	0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2394
+	.value	0x1f5
+	.long	0x131
+	.uleb128 0x19
+	.long	.LASF2395
+	.value	0x1d9
+	.byte	0x5
+	.long	0x131
+	.long	0xcf1
+	.uleb128 0x1a
+	.long	.LASF2397
+	.value	0x1d9
+	.byte	0x1f
+	.long	0x131
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2398
+	.value	0x1c5
+	.long	0x131
+	.uleb128 0x2b
+	.long	.LASF2404
+	.byte	0xd
+	.value	0x126
+	.byte	0x6
+	.uleb128 0x1c
+	.long	.LASF2399
+	.byte	0xd8
+	.long	0x131
+	.long	0xd37
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2400
+	.byte	0xdf
+	.byte	0x21
+	.long	0xbb2
+	.uleb128 0x7
+	.long	.LASF2401
+	.byte	0xe0
+	.byte	0x18
+	.long	0x94a
+	.uleb128 0x7
+	.long	.LASF2402
+	.byte	0xe1
+	.byte	0x1b
+	.long	0x4b1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2403
+	.byte	0xd
+	.byte	0xb9
+	.byte	0x5
+	.long	0x131
+	.uleb128 0x1d
+	.long	.LASF2405
+	.byte	0xa0
+	.uleb128 0x1c
+	.long	.LASF2406
+	.byte	0x92
+	.long	0x35
+	.long	0xd6d
+	.uleb128 0x2d
+	.string	"s"
+	.byte	0xd
+	.byte	0x92
+	.byte	0x1f
+	.long	0xd5
+	.uleb128 0x7
+	.long	.LASF2162
+	.byte	0x94
+	.byte	0xf
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2408
+	.byte	0x82
+	.long	0xdb3
+	.uleb128 0x13
+	.long	.LASF2163
+	.byte	0x82
+	.byte	0x26
+	.long	0x4e5
+	.uleb128 0x13
+	.long	.LASF2255
+	.byte	0x82
+	.byte	0x30
+	.long	0x35
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2409
+	.byte	0x89
+	.byte	0x13
+	.long	0x3c
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2410
+	.byte	0x89
+	.byte	0x40
+	.long	0x35
+	.uleb128 0x7
+	.long	.LASF2411
+	.byte	0x89
+	.byte	0x7f
+	.long	0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2412
+	.byte	0x79
+	.uleb128 0x2e
+	.long	.LASF2418
+	.byte	0xd
+	.byte	0x5b
+	.byte	0xd
+	.long	0xdf4
+	.uleb128 0x13
+	.long	.LASF2163
+	.byte	0x5b
+	.byte	0x30
+	.long	0x4e5
+	.uleb128 0x13
+	.long	.LASF2255
+	.byte	0x5b
+	.byte	0x3a
+	.long	0x35
+	.uleb128 0xf
+	.uleb128 0x7
+	.long	.LASF2413
+	.byte	0x6f
+	.byte	0x3a
+	.long	0x35
+	.uleb128 0x7
+	.long	.LASF2414
+	.byte	0x6f
+	.byte	0x7e
+	.long	0x35
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2415
+	.byte	0x52
+	.long	0xe0a
+	.uleb128 0x7
+	.long	.LASF2416
+	.byte	0x54
+	.byte	0x13
+	.long	0x714
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2419
+	.byte	0x6
+	.byte	0x20
+	.byte	0x83
+	.long	0xe16
+	.uleb128 0x5
+	.long	0x19a
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 550
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF539
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF605
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF641
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF669
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF670
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF745
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF747
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF562
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF749
+	.file 39 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF750
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF767
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF780
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF785
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF788
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF806
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF807
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF808
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF827
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF828
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF832
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF848
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF849
+	.byte	0x4
+	.byte	0x4
+	.file 62 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.file 64 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 65 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x41
+	.file 66 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x42
+	.file 67 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF948
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1011
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 69 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.file 71 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x47
+	.file 72 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.file 73 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x49
+	.file 74 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 75 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 76 "./src/main/common/encoding.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 77 "./src/main/common/printf.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1190
+	.byte	0x4
+	.file 78 "./src/main/common/typeconversion.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1191
+	.byte	0x4
+	.file 79 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 80 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x50
+	.file 81 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.file 82 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x52
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1282
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.file 83 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x53
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1286
+	.byte	0x4
+	.file 84 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 85 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x55
+	.file 86 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x56
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 87 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x10
+	.file 88 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x58
+	.byte	0x4
+	.file 89 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x59
+	.file 90 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xc
+	.file 91 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5b
+	.file 92 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x5d
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1990
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x62
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.file 100 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x64
+	.file 101 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x65
+	.file 102 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x66
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2084
+	.file 103 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x4
+	.file 104 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x68
+	.file 105 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2097
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2121
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF459
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF518
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF762
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF801
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF846
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF943
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1088
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1090
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1147
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.48.d431a1cf6653bca7fad963f04c7375d6,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1281
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.24.874ef25b511654a8375b5076597044fa,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1285
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1296
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1324
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1704
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1994
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF2010
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF2011
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF2012
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF2013
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF2031
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF2032
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF2033
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF2034
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2041
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF2042
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF2043
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF2044
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF2045
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF2046
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF2083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2120
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2420
+	.long	.LASF2421
+	.long	.LASF2422
+	.long	.LASF2423
+	.long	.LASF2424
+	.long	.LASF2425
+	.long	.LASF2426
+	.long	.LASF2427
+	.long	.LASF2428
+	.long	.LASF2429
+	.long	.LASF2430
+	.long	.LASF2431
+	.long	.LASF2432
+	.long	.LASF2433
+	.long	.LASF2434
+	.long	.LASF2435
+	.long	.LASF2436
+	.long	.LASF2437
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x6a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2438
+	.byte	0x12
+	.long	.LASF2439
+	.byte	0xe
+	.long	.LASF2440
+	.byte	0xe
+	.long	.LASF2441
+	.byte	0xe
+	.long	.LASF2442
+	.byte	0x3
+	.long	.LASF2443
+	.byte	0x1
+	.long	.LASF2444
+	.byte	0x1
+	.long	.LASF2445
+	.byte	0x5
+	.long	.LASF2446
+	.byte	0x5
+	.long	.LASF2447
+	.byte	0x5
+	.long	.LASF2447
+	.byte	0x7
+	.long	.LASF2448
+	.byte	0x9
+	.long	.LASF2449
+	.byte	0x1
+	.long	.LASF2450
+	.byte	0x3
+	.long	.LASF2451
+	.byte	0x11
+	.long	.LASF2452
+	.byte	0x8
+	.long	.LASF2453
+	.byte	0x11
+	.long	.LASF2454
+	.byte	0x11
+	.long	.LASF2455
+	.byte	0xe
+	.long	.LASF2456
+	.byte	0x11
+	.long	.LASF2457
+	.byte	0x11
+	.long	.LASF2458
+	.byte	0xe
+	.long	.LASF2459
+	.byte	0xe
+	.long	.LASF2460
+	.byte	0x10
+	.long	.LASF2461
+	.byte	0xe
+	.long	.LASF2462
+	.byte	0xf
+	.long	.LASF2463
+	.byte	0xf
+	.long	.LASF2464
+	.byte	0xe
+	.long	.LASF2465
+	.byte	0xe
+	.long	.LASF2466
+	.byte	0xe
+	.long	.LASF2467
+	.byte	0xe
+	.long	.LASF2439
+	.byte	0x10
+	.long	.LASF2468
+	.byte	0xe
+	.long	.LASF2469
+	.byte	0xe
+	.long	.LASF2470
+	.byte	0xd
+	.long	.LASF2471
+	.byte	0xd
+	.long	.LASF2472
+	.byte	0xd
+	.long	.LASF2473
+	.byte	0xd
+	.long	.LASF2474
+	.byte	0x11
+	.long	.LASF2474
+	.byte	0xe
+	.long	.LASF2475
+	.byte	0xe
+	.long	.LASF2476
+	.byte	0xe
+	.long	.LASF2477
+	.byte	0xe
+	.long	.LASF2478
+	.byte	0x10
+	.long	.LASF2478
+	.byte	0xe
+	.long	.LASF2479
+	.byte	0xd
+	.long	.LASF2480
+	.byte	0xd
+	.long	.LASF2481
+	.byte	0xd
+	.long	.LASF2482
+	.byte	0xd
+	.long	.LASF2483
+	.byte	0xe
+	.long	.LASF2484
+	.byte	0xe
+	.long	.LASF2485
+	.byte	0xe
+	.long	.LASF2486
+	.byte	0xe
+	.long	.LASF2487
+	.byte	0xe
+	.long	.LASF2488
+	.byte	0xe
+	.long	.LASF2489
+	.byte	0x11
+	.long	.LASF2490
+	.byte	0xe
+	.long	.LASF2491
+	.byte	0xe
+	.long	.LASF2492
+	.byte	0x12
+	.long	.LASF2493
+	.byte	0xd
+	.long	.LASF2494
+	.byte	0xd
+	.long	.LASF2495
+	.byte	0x11
+	.long	.LASF2496
+	.byte	0xc
+	.long	.LASF2497
+	.byte	0xb
+	.long	.LASF2498
+	.byte	0xa
+	.long	.LASF2499
+	.byte	0x12
+	.long	.LASF2499
+	.byte	0x11
+	.long	.LASF2500
+	.byte	0xe
+	.long	.LASF2501
+	.byte	0xb
+	.long	.LASF2502
+	.byte	0xb
+	.long	.LASF2503
+	.byte	0x1
+	.long	.LASF2504
+	.byte	0x12
+	.long	.LASF2505
+	.byte	0x4
+	.long	.LASF2506
+	.byte	0x2
+	.long	.LASF2507
+	.byte	0x3
+	.long	.LASF2508
+	.byte	0x3
+	.long	.LASF2509
+	.byte	0x3
+	.long	.LASF2510
+	.byte	0x3
+	.long	.LASF2511
+	.byte	0x4
+	.long	.LASF2512
+	.byte	0x6
+	.long	.LASF2513
+	.byte	0x6
+	.long	.LASF2514
+	.byte	0x7
+	.long	.LASF2515
+	.byte	0x5
+	.long	.LASF2516
+	.byte	0x5
+	.long	.LASF2517
+	.byte	0x5
+	.long	.LASF2518
+	.byte	0x3
+	.long	.LASF2519
+	.byte	0x5
+	.long	.LASF2442
+	.byte	0x5
+	.long	.LASF2520
+	.byte	0x8
+	.long	.LASF2521
+	.byte	0x3
+	.long	.LASF2522
+	.byte	0x3
+	.long	.LASF2523
+	.byte	0x11
+	.long	.LASF2524
+	.byte	0xe
+	.long	.LASF2525
+	.byte	0xe
+	.long	.LASF2526
+	.byte	0xe
+	.long	.LASF2527
+	.byte	0xe
+	.long	.LASF2528
+	.byte	0xe
+	.long	.LASF2529
+	.byte	0xe
+	.long	.LASF2530
+	.byte	0xe
+	.long	.LASF2531
+	.byte	0x5
+	.long	.LASF2532
+	.byte	0x5
+	.long	.LASF2533
+	.byte	0x5
+	.long	.LASF2534
+	.byte	0x5
+	.long	.LASF2535
+	.byte	0x5
+	.long	.LASF2536
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1863:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1696:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF906:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF663:
+	.string	"__ldiv_t_defined 1"
+.LASF2358:
+	.string	"peripheral_baudrateIndex"
+.LASF1720:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1056:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1746:
+	.string	"__DECL_SIMD_logf "
+.LASF879:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1951:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1526:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1628:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1749:
+	.string	"__DECL_SIMD_logf32 "
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1034:
+	.string	"USE_BARO "
+.LASF909:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1358:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1864:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF593:
+	.string	"_WCHAR_T_DEFINED "
+.LASF929:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF461:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF891:
+	.string	"USE_PITOT_MS4525 "
+.LASF1397:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1452:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1156:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2099:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF2039:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF488:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1041:
+	.string	"USE_UART7 "
+.LASF1719:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2323:
+	.string	"BAUD_2400"
+.LASF393:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1783:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF684:
+	.string	"__U64_TYPE unsigned long int"
+.LASF677:
+	.string	"__SQUAD_TYPE long int"
+.LASF1840:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF1470:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2284:
+	.string	"setMode"
+.LASF449:
+	.string	"__USE_MISC 1"
+.LASF752:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1892:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF930:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1599:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1211:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1236:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF861:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF739:
+	.string	"__pid_t_defined "
+.LASF751:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1814:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1113:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1859:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1338:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF512:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF633:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1960:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF910:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2130:
+	.string	"__uint8_t"
+.LASF945:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2260:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1600:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2145:
+	.string	"_Bool"
+.LASF1881:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1714:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1042:
+	.string	"USE_UART8 "
+.LASF2002:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1545:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2161:
+	.string	"flushedBytes"
+.LASF1078:
+	.string	"U_ID_2 2"
+.LASF1704:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1289:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2386:
+	.string	"findSharedSerialPort"
+.LASF1277:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF1923:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1765:
+	.string	"__DECL_SIMD_pow "
+.LASF465:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1851:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1903:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF505:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1451:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1287:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1487:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1293:
+	.string	"IOCFG_AF_OD 0"
+.LASF452:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2237:
+	.string	"BlackboxDevice"
+.LASF2272:
+	.string	"txBufferTail"
+.LASF2243:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1051:
+	.string	"USE_USB_MSC"
+.LASF1339:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF416:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1820:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2019:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1321:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1623:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1478:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1095:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF657:
+	.string	"__f32x(x) x ##f32x"
+.LASF1588:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2299:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1852:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF611:
+	.string	"WNOWAIT 0x01000000"
+.LASF585:
+	.string	"__WCHAR_T__ "
+.LASF2407:
+	.string	"blackboxReplenishHeaderBudget"
+.LASF1692:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1897:
+	.string	"__DECL_SIMD_log2l "
+.LASF856:
+	.string	"USE_SERIAL_RX "
+.LASF2022:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1926:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1731:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF913:
+	.string	"USE_CMS "
+.LASF1097:
+	.string	"_STDBOOL_H "
+.LASF1531:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1664:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1857:
+	.string	"__DECL_SIMD_sinhl "
+.LASF912:
+	.string	"USE_STATS "
+.LASF1639:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1610:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2202:
+	.string	"OWNER_LED"
+.LASF1060:
+	.string	"USE_PITOT_MS4525"
+.LASF486:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2317:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2060:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2140:
+	.string	"uint16_t"
+.LASF2227:
+	.string	"RESOURCE_SPI_SCK"
+.LASF763:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF1165:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF727:
+	.string	"__FD_SETSIZE 1024"
+.LASF685:
+	.string	"__STD_TYPE typedef"
+.LASF1209:
+	.string	"PG_RX_CONFIG 24"
+.LASF2338:
+	.string	"baudRate_e"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1140:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2168:
+	.string	"FLASH_PARTITION_TYPE_UNKNOWN"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1706:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF1963:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF941:
+	.string	"USE_CLI_BATCH "
+.LASF2105:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1125:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2162:
+	.string	"length"
+.LASF2058:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1356:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1767:
+	.string	"__DECL_SIMD_powl "
+.LASF1429:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1084:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2153:
+	.string	"BLACKBOX_DEVICE_SERIAL"
+.LASF2036:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF762:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1016:
+	.string	"_T_PTRDIFF_ "
+.LASF851:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF978:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1762:
+	.string	"__DECL_SIMD_expf32x "
+.LASF674:
+	.string	"__U32_TYPE unsigned int"
+.LASF1727:
+	.string	"__DECL_SIMD_sinl "
+.LASF1366:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1574:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1045:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1729:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2121:
+	.string	"BLACKBOX_SERIAL_PORT_MODE MODE_TX"
+.LASF2155:
+	.string	"BLACKBOX_RESERVE_SUCCESS"
+.LASF1980:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1759:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1777:
+	.string	"__DECL_SIMD_acosl "
+.LASF2093:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1184:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1966:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1779:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1465:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF844:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF736:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2416:
+	.string	"sharedBlackboxAndMspPort"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF584:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1748:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1351:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF405:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1005:
+	.string	"UINT8_C(c) c"
+.LASF1955:
+	.string	"__DECL_SIMD_asinh "
+.LASF1381:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF524:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF694:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF658:
+	.string	"__f64x(x) x ##f64x"
+.LASF2151:
+	.string	"compression"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1590:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1804:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1663:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2216:
+	.string	"RESOURCE_NONE"
+.LASF1556:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1747:
+	.string	"__DECL_SIMD_logl "
+.LASF1691:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF723:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1160:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1795:
+	.string	"__DECL_SIMD_asin "
+.LASF901:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1984:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1268:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1913:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1793:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1312:
+	.string	"BIT(x) (1 << (x))"
+.LASF2196:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2269:
+	.string	"rxBufferHead"
+.LASF982:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1367:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1518:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1199:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF780:
+	.string	"_SYS_SELECT_H 1"
+.LASF2137:
+	.string	"int32_t"
+.LASF636:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2355:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2225:
+	.string	"RESOURCE_I2C_SCL"
+.LASF792:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1155:
+	.string	"FAST_MATH "
+.LASF2056:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2288:
+	.string	"beginWrite"
+.LASF1939:
+	.string	"__DECL_SIMD_erff32 "
+.LASF849:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1677:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"___int_wchar_t_h "
+.LASF2207:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1613:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"__USE_ISOC11"
+.LASF1330:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2217:
+	.string	"RESOURCE_INPUT"
+.LASF1434:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2278:
+	.string	"serialWrite"
+.LASF1630:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1050:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF765:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF895:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1206:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF846:
+	.string	"__va_list__ "
+.LASF1150:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF1069:
+	.string	"USE_RX_PPM"
+.LASF507:
+	.string	"__always_inline"
+.LASF2226:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2274:
+	.string	"rxCallbackData"
+.LASF1947:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2239:
+	.string	"MODE_RX"
+.LASF1854:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1853:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1407:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF952:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2313:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1218:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2011:
+	.string	"__MATH_PRECNAME"
+.LASF1890:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2150:
+	.string	"invertedCardDetection"
+.LASF946:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF936:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1089:
+	.string	"FAST_CODE "
+.LASF902:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1818:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1437:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1822:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1063:
+	.string	"USE_1WIRE_DS2482"
+.LASF1514:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2370:
+	.string	"gyroADCf"
+.LASF2336:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1948:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF974:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1509:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1870:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2405:
+	.string	"blackboxDeviceFlush"
+.LASF704:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1998:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF897:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF767:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF490:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1430:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1650:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF1032:
+	.string	"USE_FAKE_GPS "
+.LASF2004:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1183:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF776:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1732:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1927:
+	.string	"__DECL_SIMD_acoshl "
+.LASF784:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2123:
+	.string	"long int"
+.LASF480:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2294:
+	.string	"PORTSHARING_SHARED"
+.LASF1775:
+	.string	"__DECL_SIMD_acos "
+.LASF898:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1713:
+	.string	"_MATH_H 1"
+.LASF1593:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1264:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF541:
+	.string	"__stub_chflags "
+.LASF2032:
+	.string	"__MATHDECL_1"
+.LASF2016:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2195:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1703:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF622:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2215:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1001:
+	.string	"INT8_C(c) c"
+.LASF1127:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1606:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF545:
+	.string	"__stub_setlogin "
+.LASF1656:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2240:
+	.string	"MODE_TX"
+.LASF646:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2040:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1292:
+	.string	"IOCFG_AF_PP 0"
+.LASF2169:
+	.string	"FLASH_PARTITION_TYPE_PARTITION_TABLE"
+.LASF1879:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF547:
+	.string	"__stub_stty "
+.LASF1307:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1129:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1908:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2143:
+	.string	"timeDelta_t"
+.LASF1803:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2079:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1815:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1003:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF923:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1833:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1537:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2409:
+	.string	"chunk"
+.LASF1575:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2041:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF862:
+	.string	"USE_ADC_AVERAGING "
+.LASF2006:
+	.string	"_Mdouble_ double"
+.LASF1712:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF619:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF673:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1382:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1576:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1962:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2138:
+	.string	"long long unsigned int"
+.LASF2322:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF519:
+	.string	"__attribute_copy__"
+.LASF1894:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2380:
+	.string	"strlen"
+.LASF1616:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1680:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF933:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF951:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1116:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2282:
+	.string	"serialSetBaudRate"
+.LASF2183:
+	.string	"OWNER_SERVO"
+.LASF1062:
+	.string	"USE_1WIRE"
+.LASF1180:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1138:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF2097:
+	.string	"SPIDEV_COUNT 4"
+.LASF1872:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF500:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1646:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1074:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF586:
+	.string	"_WCHAR_T "
+.LASF1880:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1189:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1916:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2352:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF2214:
+	.string	"OWNER_IRLOCK"
+.LASF1442:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1245:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1774:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1972:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF755:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1120:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1877:
+	.string	"__DECL_SIMD_atan2l "
+.LASF830:
+	.string	"alloca"
+.LASF668:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1398:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1807:
+	.string	"__DECL_SIMD_hypotl "
+.LASF788:
+	.string	"__timeval_defined 1"
+.LASF1022:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1119:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1365:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF983:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1505:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1000:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1591:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2324:
+	.string	"BAUD_4800"
+.LASF2132:
+	.string	"__uint16_t"
+.LASF661:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2265:
+	.string	"rxBufferSize"
+.LASF2182:
+	.string	"OWNER_MOTOR"
+.LASF1841:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1449:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1080:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2304:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF1333:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF437:
+	.string	"__USE_POSIX 1"
+.LASF400:
+	.string	"__USE_POSIX"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF596:
+	.string	"__INT_WCHAR_T_H "
+.LASF2098:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF734:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1482:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2418:
+	.string	"blackboxDeviceWrite"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1983:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2174:
+	.string	"FLASH_PARTITION_TYPE_FULL_BACKUP"
+.LASF1788:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1728:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2381:
+	.string	"memcpy"
+.LASF531:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF430:
+	.string	"__USE_ISOC99 1"
+.LASF781:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF433:
+	.string	"_POSIX_SOURCE"
+.LASF582:
+	.string	"__size_t "
+.LASF2271:
+	.string	"txBufferHead"
+.LASF981:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2330:
+	.string	"BAUD_230400"
+.LASF798:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2262:
+	.string	"mode"
+.LASF775:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1368:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1659:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF482:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1279:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF632:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1950:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1247:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1771:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1812:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2394:
+	.string	"isBlackboxDeviceFull"
+.LASF517:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1108:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2334:
+	.string	"BAUD_1000000"
+.LASF2089:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2179:
+	.string	"OWNER_PWMIO"
+.LASF1151:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1829:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2031:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF900:
+	.string	"USE_OLED_UG2864 "
+.LASF2076:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1485:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF917:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF940:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1301:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1524:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2045:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2205:
+	.string	"OWNER_RX_SPI"
+.LASF2337:
+	.string	"BAUD_2470000"
+.LASF965:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1179:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2311:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF2300:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF2125:
+	.string	"unsigned char"
+.LASF948:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF975:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1170:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF532:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1821:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1256:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1288:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1117:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1511:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1023:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1168:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF735:
+	.string	"__mode_t_defined "
+.LASF1619:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF867:
+	.string	"USE_NAV "
+.LASF2363:
+	.string	"initialized"
+.LASF2184:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1565:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF688:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1203:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1090:
+	.string	"NOINLINE "
+.LASF1711:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF2146:
+	.string	"float"
+.LASF2261:
+	.string	"identifier"
+.LASF2413:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1198:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF398:
+	.string	"__USE_ISOC95"
+.LASF2391:
+	.string	"_left4"
+.LASF1364:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2389:
+	.string	"_left6"
+.LASF397:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1088:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1512:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"INT16_C(c) c"
+.LASF1454:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2285:
+	.string	"writeBuf"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1347:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF1937:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2309:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1291:
+	.string	"IOCFG_OUT_OD 0"
+.LASF600:
+	.string	"_BSD_WCHAR_T_"
+.LASF748:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1798:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1015:
+	.string	"_PTRDIFF_T "
+.LASF528:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF760:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF407:
+	.string	"__USE_XOPEN2K"
+.LASF1406:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF403:
+	.string	"__USE_POSIX199506"
+.LASF1103:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2382:
+	.string	"closeSerialPort"
+.LASF2289:
+	.string	"endWrite"
+.LASF2296:
+	.string	"FUNCTION_NONE"
+.LASF2073:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF468:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF878:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1238:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF737:
+	.string	"__uid_t_defined "
+.LASF1819:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1152:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1615:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF427:
+	.string	"_DEFAULT_SOURCE"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2112:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1579:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF865:
+	.string	"USE_GPS "
+.LASF1230:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1672:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1969:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1137:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF506:
+	.string	"__wur "
+.LASF1875:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1641:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1609:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF860:
+	.string	"USE_SERIALRX_FPORT "
+.LASF621:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1612:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1472:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1359:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1280:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF2210:
+	.string	"OWNER_1WIRE"
+.LASF1075:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1499:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF744:
+	.string	"__clock_t_defined 1"
+.LASF1229:
+	.string	"PG_INAV_START 1000"
+.LASF428:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF592:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1477:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1192:
+	.string	"PG_CF_START 1"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF928:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2326:
+	.string	"BAUD_19200"
+.LASF2189:
+	.string	"OWNER_RANGEFINDER"
+.LASF1810:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1662:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF476:
+	.string	"__END_DECLS "
+.LASF463:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF791:
+	.string	"__NFDBITS"
+.LASF466:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF949:
+	.string	"__intptr_t_defined "
+.LASF2106:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF957:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF968:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF522:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1836:
+	.string	"__DECL_SIMD_coshf "
+.LASF1845:
+	.string	"__DECL_SIMD_expm1 "
+.LASF624:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF2335:
+	.string	"BAUD_1500000"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF479:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1529:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1934:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF841:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1909:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1547:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF678:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2176:
+	.string	"FLASH_PARTITION_TYPE_UPDATE_FIRMWARE"
+.LASF2384:
+	.string	"serialTxBytesFree"
+.LASF2108:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1361:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1737:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1968:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF410:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1255:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2290:
+	.string	"writeBufChunks"
+.LASF747:
+	.string	"__timer_t_defined 1"
+.LASF2028:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1961:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1073:
+	.string	"USE_ITCM_RAM"
+.LASF1413:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF985:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1861:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF647:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF594:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1802:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF786:
+	.string	"____sigset_t_defined "
+.LASF2281:
+	.string	"serialRead"
+.LASF750:
+	.string	"_ENDIAN_H 1"
+.LASF1682:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF530:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1611:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"_ANSI_STDARG_H_ "
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1217:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF924:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1724:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2230:
+	.string	"RESOURCE_SPI_CS"
+.LASF1007:
+	.string	"UINT32_C(c) c ## U"
+.LASF1887:
+	.string	"__DECL_SIMD_log10l "
+.LASF2273:
+	.string	"rxCallback"
+.LASF1100:
+	.string	"false 0"
+.LASF1912:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1066:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1283:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF961:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1061:
+	.string	"USE_PITOT_ADC"
+.LASF2357:
+	.string	"gps_baudrateIndex"
+.LASF1764:
+	.string	"__DECL_SIMD_expf128x "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF842:
+	.string	"_VA_LIST_ "
+.LASF947:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF904:
+	.string	"USE_DJI_HD_OSD "
+.LASF1175:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1416:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2267:
+	.string	"rxBuffer"
+.LASF2410:
+	.string	"_left2"
+.LASF629:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF649:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1004:
+	.string	"INT64_C(c) c ## L"
+.LASF2266:
+	.string	"txBufferSize"
+.LASF2375:
+	.string	"blackboxPortSharing"
+.LASF2247:
+	.string	"SERIAL_PARITY_NO"
+.LASF2062:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF419:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF832:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF886:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF2158:
+	.string	"blackboxBufferReserveStatus_e"
+.LASF728:
+	.string	"_BITS_TIME64_H 1"
+.LASF819:
+	.string	"__ONCE_ALIGNMENT "
+.LASF980:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1874:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2000:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF708:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF492:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1112:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1651:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1796:
+	.string	"__DECL_SIMD_asinf "
+.LASF615:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF890:
+	.string	"USE_OPFLOW_MSP "
+.LASF412:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF749:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2229:
+	.string	"RESOURCE_SPI_MISO"
+.LASF508:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF672:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2199:
+	.string	"OWNER_MPU"
+.LASF772:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF503:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1323:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2038:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1667:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2009:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2395:
+	.string	"blackboxDeviceEndLog"
+.LASF1237:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF493:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1443:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1763:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1332:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1502:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1920:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2209:
+	.string	"OWNER_TEMPERATURE"
+.LASF1716:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF423:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1101:
+	.string	"__bool_true_false_are_defined 1"
+.LASF644:
+	.string	"__HAVE_FLOAT64 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF2412:
+	.string	"blackboxWriteBufferFlush"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF2075:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1371:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2253:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF2200:
+	.string	"OWNER_INVERTER"
+.LASF2072:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2129:
+	.string	"size_t"
+.LASF870:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF761:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2242:
+	.string	"portOptions_t"
+.LASF2029:
+	.string	"_Mdouble_ _Float64x"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1665:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF710:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1741:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2139:
+	.string	"uint8_t"
+.LASF1946:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1410:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2104:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF542:
+	.string	"__stub_fchflags "
+.LASF880:
+	.string	"USE_RX_UIB "
+.LASF1468:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF676:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2023:
+	.string	"_Mdouble_ _Float64"
+.LASF1163:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF820:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1309:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2157:
+	.string	"BLACKBOX_RESERVE_PERMANENT_FAILURE"
+.LASF1273:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF404:
+	.string	"__USE_XOPEN"
+.LASF1223:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1811:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF2091:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF426:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1768:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1973:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1935:
+	.string	"__DECL_SIMD_erf "
+.LASF1847:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1536:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1688:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1067:
+	.string	"USE_ADC"
+.LASF733:
+	.string	"__dev_t_defined "
+.LASF446:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF535:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF597:
+	.string	"_GCC_WCHAR_T "
+.LASF520:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1766:
+	.string	"__DECL_SIMD_powf "
+.LASF2219:
+	.string	"RESOURCE_IO"
+.LASF1583:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF626:
+	.string	"__WCOREFLAG 0x80"
+.LASF997:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF960:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1087:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF527:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1782:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1631:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF2052:
+	.string	"FP_INFINITE 1"
+.LASF837:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF1835:
+	.string	"__DECL_SIMD_cosh "
+.LASF2044:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1725:
+	.string	"__DECL_SIMD_sin "
+.LASF885:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1014:
+	.string	"_ANSI_STDDEF_H "
+.LASF821:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1409:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1542:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2367:
+	.string	"sampleBufferActive"
+.LASF745:
+	.string	"__clockid_t_defined 1"
+.LASF2342:
+	.string	"SERIAL_PORT_USART2"
+.LASF1738:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1428:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF640:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1052:
+	.string	"USE_SERVO_SBUS"
+.LASF526:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF715:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1068:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF876:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2301:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1331:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF583:
+	.string	"__need_size_t"
+.LASF2181:
+	.string	"OWNER_PPMINPUT"
+.LASF1275:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF2320:
+	.string	"serialPortFunction_e"
+.LASF2055:
+	.string	"FP_NORMAL 4"
+.LASF1025:
+	.string	"__need_ptrdiff_t"
+.LASF764:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1799:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1987:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF911:
+	.string	"USE_LOG "
+.LASF1102:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2013:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2026:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1433:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1012:
+	.string	"_STDDEF_H "
+.LASF1621:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1922:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1031:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF995:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1322:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1362:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1721:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1618:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1532:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1990:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1011:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1461:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2109:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1261:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF1010:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1204:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1739:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1753:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1191:
+	.string	"FTOA_BUFFER_SIZE 13"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2015:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF472:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1930:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2318:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF1134:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1473:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1124:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1377:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF543:
+	.string	"__stub_gtty "
+.LASF875:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1871:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF722:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF783:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1400:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1751:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1235:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF2111:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1959:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF641:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1446:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1252:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF753:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF874:
+	.string	"USE_PITOT_ADC "
+.LASF1424:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF962:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1346:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF724:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2018:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1614:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1221:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1560:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1755:
+	.string	"__DECL_SIMD_exp "
+.LASF1595:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2417:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1008:
+	.string	"UINT64_C(c) c ## UL"
+.LASF639:
+	.string	"__f128(x) x ##f128"
+.LASF1928:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF804:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF963:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2167:
+	.string	"blackboxWriteBuffer"
+.LASF2221:
+	.string	"RESOURCE_UART_TX"
+.LASF1640:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF759:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF836:
+	.string	"__GNUC_VA_LIST "
+.LASF1380:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2325:
+	.string	"BAUD_9600"
+.LASF2135:
+	.string	"__uint64_t"
+.LASF1655:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF805:
+	.string	"__fsfilcnt_t_defined "
+.LASF2012:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1182:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF606:
+	.string	"WNOHANG 1"
+.LASF2043:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1506:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2364:
+	.string	"targetLooptime"
+.LASF1997:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2208:
+	.string	"OWNER_COMPASS"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1979:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1335:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1976:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1582:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF454:
+	.string	"__GNU_LIBRARY__"
+.LASF605:
+	.string	"_STDLIB_H 1"
+.LASF970:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1643:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1941:
+	.string	"__DECL_SIMD_erff128 "
+.LASF2308:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1188:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1634:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1520:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2302:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1760:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1085:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1070:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF908:
+	.string	"USE_ANTIGRAVITY "
+.LASF1717:
+	.string	"__DECL_SIMD_cosl "
+.LASF2222:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1030:
+	.string	"USE_FAKE_BARO "
+.LASF1383:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF487:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1295:
+	.string	"IOCFG_IPU 0"
+.LASF2014:
+	.string	"_Mdouble_ float"
+.LASF1265:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF1133:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF608:
+	.string	"WSTOPPED 2"
+.LASF602:
+	.string	"NULL"
+.LASF1147:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1259:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF2156:
+	.string	"BLACKBOX_RESERVE_TEMPORARY_FAILURE"
+.LASF802:
+	.string	"__blksize_t_defined "
+.LASF2008:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF828:
+	.string	"__have_pthread_attr_t 1"
+.LASF2415:
+	.string	"blackboxOpen"
+.LASF609:
+	.string	"WEXITED 4"
+.LASF2190:
+	.string	"OWNER_SYSTEM"
+.LASF931:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF701:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1122:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1548:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF460:
+	.string	"__PMT"
+.LASF1345:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1304:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF598:
+	.string	"_WCHAR_T_DECLARED "
+.LASF889:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2235:
+	.string	"RESOURCE_RX_CE"
+.LASF2192:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2392:
+	.string	"_right5"
+.LASF818:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2359:
+	.string	"telemetry_baudrateIndex"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1297:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2021:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2400:
+	.string	"portConfig"
+.LASF1244:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2119:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF618:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1679:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2331:
+	.string	"BAUD_250000"
+.LASF2068:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2297:
+	.string	"FUNCTION_MSP"
+.LASF2178:
+	.string	"OWNER_FREE"
+.LASF1896:
+	.string	"__DECL_SIMD_log2f "
+.LASF795:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1009:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1126:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2050:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1497:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2054:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF637:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1921:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF937:
+	.string	"USE_VTX_TRAMP "
+.LASF738:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF513:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF771:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF588:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1638:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"WCONTINUED 8"
+.LASF1303:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1481:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF675:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF872:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1106:
+	.string	"UNIT_TESTED "
+.LASF1197:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF989:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF456:
+	.string	"__GLIBC__ 2"
+.LASF1563:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF976:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1794:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF956:
+	.string	"INT32_MAX (2147483647)"
+.LASF590:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1262:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF813:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1893:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1490:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1135:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1082:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1839:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF470:
+	.string	"__P(args) args"
+.LASF1225:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF653:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1193:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1141:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF988:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1914:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF966:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1121:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1658:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF700:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2142:
+	.string	"uint64_t"
+.LASF2046:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1363:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1722:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1989:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1964:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1341:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF840:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1652:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2254:
+	.string	"serialBufChunk_s"
+.LASF2256:
+	.string	"serialBufChunk_t"
+.LASF1911:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF418:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF857:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1234:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1425:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF790:
+	.string	"__suseconds_t_defined "
+.LASF711:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF954:
+	.string	"INT8_MAX (127)"
+.LASF807:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF799:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1907:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1789:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF467:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF409:
+	.string	"__USE_XOPEN2K8"
+.LASF996:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2198:
+	.string	"OWNER_BARO"
+.LASF1625:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF782:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF712:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF604:
+	.string	"__need_NULL"
+.LASF1026:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1373:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF414:
+	.string	"__USE_MISC"
+.LASF2027:
+	.string	"_Mdouble_ _Float32x"
+.LASF447:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF411:
+	.string	"__USE_LARGEFILE"
+.LASF1624:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1856:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1232:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1801:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1354:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1769:
+	.string	"__DECL_SIMD_powf32 "
+.LASF477:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2107:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1900:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2241:
+	.string	"MODE_RXTX"
+.LASF2293:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF451:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF439:
+	.string	"__USE_POSIX199309 1"
+.LASF1463:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2154:
+	.string	"BLACKBOX_DEVICE_END"
+.LASF2033:
+	.string	"__MATHDECL_ALIAS"
+.LASF1210:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1889:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1415:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF883:
+	.string	"USE_RANGEFINDER "
+.LASF1178:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF972:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1808:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2401:
+	.string	"baudRateIndex"
+.LASF1439:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1709:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF1298:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1282:
+	.string	"FLASH_PARTITION_SECTOR_COUNT(partition) (partition->endSector + 1 - partition->startSector)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1388:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2193:
+	.string	"OWNER_SDCARD"
+.LASF2372:
+	.string	"gyro"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2368:
+	.string	"lastSampleTimeUs"
+.LASF484:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF847:
+	.string	"_STRING_H 1"
+.LASF638:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1977:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1683:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF697:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2063:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2065:
+	.string	"M_E 2.7182818284590452354"
+.LASF2034:
+	.string	"__MATHDECL"
+.LASF1931:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2069:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1091:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2126:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1491:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2128:
+	.string	"signed char"
+.LASF654:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1733:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1146:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF2070:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1849:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF565:
+	.string	"__size_t__ "
+.LASF441:
+	.string	"__USE_XOPEN2K 1"
+.LASF2049:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF616:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1394:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1158:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1566:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF496:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2414:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2411:
+	.string	"_right3"
+.LASF746:
+	.string	"__time_t_defined 1"
+.LASF774:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF766:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2390:
+	.string	"_right7"
+.LASF2244:
+	.string	"SERIAL_INVERTED"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1933:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1154:
+	.string	"sq(x) ((x)*(x))"
+.LASF1554:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF990:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF540:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF2255:
+	.string	"count"
+.LASF884:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF2385:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1589:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF827:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF395:
+	.string	"_FEATURES_H 1"
+.LASF656:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF514:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1607:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF498:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1053:
+	.string	"USE_DASHBOARD"
+.LASF938:
+	.string	"USE_VTX_FFPV "
+.LASF2085:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF2080:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2103:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF806:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1503:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1604:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF614:
+	.string	"__WCLONE 0x80000000"
+.LASF1944:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1357:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2057:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1296:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2286:
+	.string	"isConnected"
+.LASF1742:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF539:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF801:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF630:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF698:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2350:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2351:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF2402:
+	.string	"portOptions"
+.LASF1586:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2071:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF725:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2090:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1081:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF534:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2263:
+	.string	"options"
+.LASF1267:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2303:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF690:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1115:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2186:
+	.string	"OWNER_SERIAL"
+.LASF1958:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1093:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF448:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF2377:
+	.string	"openSerialPort"
+.LASF2064:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF854:
+	.string	"USE_I2C_PULLUP "
+.LASF464:
+	.string	"__LEAF , __leaf__"
+.LASF2213:
+	.string	"OWNER_PINIO"
+.LASF1790:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF894:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1598:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1431:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1202:
+	.string	"PG_PID_PROFILE 14"
+.LASF1647:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1873:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF868:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1028:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2083:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2315:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF2166:
+	.string	"blackboxHeaderBudget"
+.LASF1224:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1139:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1349:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1988:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1231:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1386:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF529:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2206:
+	.string	"OWNER_VTX"
+.LASF977:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2025:
+	.string	"_Mdouble_ _Float128"
+.LASF859:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1423:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1329:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1266:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF1744:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF743:
+	.string	"__key_t_defined "
+.LASF1254:
+	.string	"PG_INAV_END 1023"
+.LASF2172:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE"
+.LASF1745:
+	.string	"__DECL_SIMD_log "
+.LASF655:
+	.string	"__f32(x) x ##f32"
+.LASF2276:
+	.string	"rxIrqCount"
+.LASF1938:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1493:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1214:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF692:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2053:
+	.string	"FP_ZERO 2"
+.LASF769:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF691:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1550:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF758:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2250:
+	.string	"SERIAL_BIDIR"
+.LASF1735:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1758:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1848:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1945:
+	.string	"__DECL_SIMD_tanh "
+.LASF1064:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1355:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF533:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2349:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2316:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF1553:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__ptr_t void *"
+.LASF1130:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2220:
+	.string	"RESOURCE_TIMER"
+.LASF681:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2341:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2343:
+	.string	"SERIAL_PORT_USART3"
+.LASF2344:
+	.string	"SERIAL_PORT_USART4"
+.LASF2345:
+	.string	"SERIAL_PORT_USART5"
+.LASF2346:
+	.string	"SERIAL_PORT_USART6"
+.LASF2347:
+	.string	"SERIAL_PORT_USART7"
+.LASF2348:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2279:
+	.string	"serialTotalRxWaiting"
+.LASF2100:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1336:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF915:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF399:
+	.string	"__USE_ISOCXX11"
+.LASF1629:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"blackboxConfig"
+.LASF1144:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1458:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1207:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2114:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1019:
+	.string	"_PTRDIFF_T_ "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1898:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1242:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF425:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2092:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF919:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF950:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF958:
+	.string	"UINT8_MAX (255)"
+.LASF1476:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2187:
+	.string	"OWNER_PINDEBUG"
+.LASF1403:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1071:
+	.string	"USE_RCDEVICE"
+.LASF1670:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF811:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF471:
+	.string	"__PMT(args) args"
+.LASF1707:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF2404:
+	.string	"blackboxDeviceClose"
+.LASF383:
+	.string	"SITL 1"
+.LASF459:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2327:
+	.string	"BAUD_38400"
+.LASF1311:
+	.string	"UNUSED(x) (void)(x)"
+.LASF967:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2312:
+	.string	"FUNCTION_LOG"
+.LASF1018:
+	.string	"__PTRDIFF_T "
+.LASF2177:
+	.string	"FLASH_MAX_PARTITIONS"
+.LASF789:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1142:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF667:
+	.string	"EXIT_SUCCESS 0"
+.LASF1862:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1272:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2001:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2087:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1535:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1569:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2236:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1299:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF944:
+	.string	"_STDINT_H 1"
+.LASF1865:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2120:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF1308:
+	.string	"EXPAND_I(x) x"
+.LASF1479:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF918:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1570:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF843:
+	.string	"_VA_LIST "
+.LASF1780:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1436:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2007:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2141:
+	.string	"uint32_t"
+.LASF2258:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF719:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF669:
+	.string	"_SYS_TYPES_H 1"
+.LASF1797:
+	.string	"__DECL_SIMD_asinl "
+.LASF2160:
+	.string	"blackboxWriteBuffer_s"
+.LASF2270:
+	.string	"rxBufferTail"
+.LASF659:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2074:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1544:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2175:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE_UPDATE_META"
+.LASF1785:
+	.string	"__DECL_SIMD_atan "
+.LASF1895:
+	.string	"__DECL_SIMD_log2 "
+.LASF1401:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1058:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1187:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1143:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF702:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2149:
+	.string	"device"
+.LASF718:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1543:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2218:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2383:
+	.string	"serialWriteBuf"
+.LASF1883:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1653:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF660:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF793:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1924:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2283:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF438:
+	.string	"__USE_POSIX2 1"
+.LASF599:
+	.string	"__DEFINED_wchar_t "
+.LASF1035:
+	.string	"USE_UART1 "
+.LASF483:
+	.string	"__flexarr []"
+.LASF662:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF424:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF489:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF670:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2116:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF971:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF943:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF2406:
+	.string	"blackboxPrint"
+.LASF1107:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF485:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF787:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1132:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF587:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1837:
+	.string	"__DECL_SIMD_coshl "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF914:
+	.string	"CMS_MENU_OSD "
+.LASF1419:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF964:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF435:
+	.string	"_POSIX_C_SOURCE"
+.LASF1734:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1094:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF665:
+	.string	"RAND_MAX 2147483647"
+.LASF1494:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2188:
+	.string	"OWNER_TIMER"
+.LASF1114:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1602:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1632:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF869:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1578:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF863:
+	.string	"USE_64BIT_TIME "
+.LASF2010:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1637:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF979:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1567:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2136:
+	.string	"char"
+.LASF812:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1823:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1891:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1475:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF693:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF546:
+	.string	"__stub_sigreturn "
+.LASF1953:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF648:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1412:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1169:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1559:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2339:
+	.string	"baudRates"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1167:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1888:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1705:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF671:
+	.string	"__S16_TYPE short int"
+.LASF1805:
+	.string	"__DECL_SIMD_hypot "
+.LASF1992:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF607:
+	.string	"WUNTRACED 2"
+.LASF838:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF777:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF502:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF921:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1379:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1633:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1784:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1850:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1111:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1257:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2340:
+	.string	"SERIAL_PORT_NONE"
+.LASF2117:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF1194:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF450:
+	.string	"__USE_ATFILE 1"
+.LASF1177:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF925:
+	.string	"USE_RX_MSP "
+.LASF1538:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1300:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1185:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1099:
+	.string	"true 1"
+.LASF1249:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF2173:
+	.string	"FLASH_PARTITION_TYPE_CONFIG"
+.LASF509:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1240:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF887:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1776:
+	.string	"__DECL_SIMD_acosf "
+.LASF705:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1695:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF893:
+	.string	"USE_1WIRE_DS2482 "
+.LASF873:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF730:
+	.string	"__STD_TYPE"
+.LASF1173:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF716:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF973:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF682:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF643:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1918:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1546:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF564:
+	.string	"__need_NULL "
+.LASF2393:
+	.string	"mspSerialAllocatePorts"
+.LASF696:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2212:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1153:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1996:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2319:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF888:
+	.string	"USE_OPFLOW "
+.LASF1216:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1971:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1029:
+	.string	"USE_IMU_FAKE "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF810:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF603:
+	.string	"NULL ((void *)0)"
+.LASF562:
+	.string	"__need_size_t "
+.LASF1956:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1932:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF778:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1306:
+	.string	"STR_HELPER(x) #x"
+.LASF826:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1838:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2024:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1899:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1708:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1220:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF858:
+	.string	"USE_SERIALRX_SBUS "
+.LASF953:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1440:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF495:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1104:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF536:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1601:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2314:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF998:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF785:
+	.string	"__sigset_t_defined 1"
+.LASF1136:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1826:
+	.string	"__DECL_SIMD_exp10f "
+.LASF525:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1910:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1418:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF510:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1539:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2061:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2224:
+	.string	"RESOURCE_EXTI"
+.LASF601:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF987:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1327:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1017:
+	.string	"_T_PTRDIFF "
+.LASF462:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF442:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1982:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF839:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2101:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF866:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1391:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF835:
+	.string	"__need___va_list"
+.LASF371:
+	.string	"__linux 1"
+.LASF1917:
+	.string	"__DECL_SIMD_atanhl "
+.LASF2048:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1645:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1902:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1581:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF458:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2081:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1527:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF955:
+	.string	"INT16_MAX (32767)"
+.LASF2051:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF538:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF651:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF920:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF740:
+	.string	"__id_t_defined "
+.LASF1248:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1882:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2374:
+	.string	"blackboxPort"
+.LASF1270:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF1460:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1148:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF2067:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF824:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF623:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2292:
+	.string	"PORTSHARING_UNUSED"
+.LASF2354:
+	.string	"serialPortConfig_s"
+.LASF2360:
+	.string	"serialPortConfig_t"
+.LASF1164:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1676:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF444:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1999:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1622:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF823:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1342:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1698:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF742:
+	.string	"__daddr_t_defined "
+.LASF511:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2246:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1970:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2047:
+	.string	"__MATHCALL_NARROW"
+.LASF1320:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF613:
+	.string	"__WALL 0x40000000"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF478:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2094:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF756:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF770:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1260:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF2088:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1404:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF421:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1846:
+	.string	"__DECL_SIMD_expm1f "
+.LASF680:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1752:
+	.string	"__DECL_SIMD_logf32x "
+.LASF809:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1318:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF413:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2102:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF625:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1878:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2388:
+	.string	"freeSpace"
+.LASF871:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1986:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1940:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2365:
+	.string	"sampleLooptime"
+.LASF2078:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1549:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"double"
+.LASF2118:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1057:
+	.string	"USE_RANGEFINDER"
+.LASF1448:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1957:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1778:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF773:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1314:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1985:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF703:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF754:
+	.string	"__PDP_ENDIAN 3412"
+.LASF2005:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1353:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2165:
+	.string	"blackboxConfig_System"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1981:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1340:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1317:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1376:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF757:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1626:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2310:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF1195:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF713:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1952:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF432:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF591:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1457:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2399:
+	.string	"blackboxDeviceOpen"
+.LASF853:
+	.string	"I2C2_OVERCLOCK false"
+.LASF664:
+	.string	"__lldiv_t_defined 1"
+.LASF2203:
+	.string	"OWNER_RX"
+.LASF969:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1389:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1086:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF497:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1694:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1644:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2133:
+	.string	"__int32_t"
+.LASF1993:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1496:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2249:
+	.string	"SERIAL_UNIDIR"
+.LASF2134:
+	.string	"__uint32_t"
+.LASF1786:
+	.string	"__DECL_SIMD_atanf "
+.LASF2095:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF417:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2170:
+	.string	"FLASH_PARTITION_TYPE_FLASHFS"
+.LASF620:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF401:
+	.string	"__USE_POSIX2"
+.LASF2163:
+	.string	"data"
+.LASF1605:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"__TFP_PRINTF__ "
+.LASF2084:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1860:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1208:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1929:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1281:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1065:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1027:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1395:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2333:
+	.string	"BAUD_921600"
+.LASF2197:
+	.string	"OWNER_OSD"
+.LASF2287:
+	.string	"isIdle"
+.LASF916:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2194:
+	.string	"OWNER_FLASH"
+.LASF2264:
+	.string	"baudRate"
+.LASF1685:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1213:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2408:
+	.string	"blackboxWriteBuf"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2353:
+	.string	"serialPortIdentifier_e"
+.LASF679:
+	.string	"__SWORD_TYPE long int"
+.LASF563:
+	.string	"__need_wchar_t "
+.LASF1671:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1584:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF984:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1530:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF855:
+	.string	"USE_RX_PPM "
+.LASF899:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF803:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2356:
+	.string	"msp_baudrateIndex"
+.LASF612:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF2268:
+	.string	"txBuffer"
+.LASF935:
+	.string	"USE_VTX_CONTROL "
+.LASF1310:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1772:
+	.string	"__DECL_SIMD_powf32x "
+.LASF581:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1596:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF959:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2366:
+	.string	"pidProcessDenom"
+.LASF721:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1013:
+	.string	"_STDDEF_H_ "
+.LASF1334:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF729:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1352:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1701:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1370:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF686:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1455:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1571:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2035:
+	.string	"__MATHCALL"
+.LASF1686:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1046:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF2204:
+	.string	"OWNER_TX"
+.LASF1006:
+	.string	"UINT16_C(c) c"
+.LASF1212:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF515:
+	.string	"__restrict_arr __restrict"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF829:
+	.string	"_ALLOCA_H 1"
+.LASF1033:
+	.string	"USE_MAG "
+.LASF2211:
+	.string	"OWNER_AIRSPEED"
+.LASF1241:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1488:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF992:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2082:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1942:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1915:
+	.string	"__DECL_SIMD_atanh "
+.LASF2378:
+	.string	"determinePortSharing"
+.LASF2396:
+	.string	"bytes"
+.LASF1995:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1994:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF402:
+	.string	"__USE_POSIX199309"
+.LASF994:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1827:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1253:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1965:
+	.string	"__DECL_SIMD_erfc "
+.LASF1904:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1145:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1374:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1276:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1020:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF589:
+	.string	"__WCHAR_T "
+.LASF2329:
+	.string	"BAUD_115200"
+.LASF1562:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF731:
+	.string	"__u_char_defined "
+.LASF2277:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1844:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1500:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1806:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF434:
+	.string	"_POSIX_SOURCE 1"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1740:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF794:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2245:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2298:
+	.string	"FUNCTION_GPS"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2238:
+	.string	"portMode_t"
+.LASF650:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF2144:
+	.string	"timeUs_t"
+.LASF1077:
+	.string	"U_ID_1 1"
+.LASF1943:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1076:
+	.string	"U_ID_0 0"
+.LASF732:
+	.string	"__ino_t_defined "
+.LASF1884:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF726:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1770:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2305:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1736:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1325:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1572:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF635:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1649:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"portSharing_e"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1792:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF852:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2398:
+	.string	"blackboxDeviceBeginLog"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF475:
+	.string	"__BEGIN_DECLS "
+.LASF1816:
+	.string	"__DECL_SIMD_exp2f "
+.LASF939:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1243:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1587:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1319:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1205:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1269:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF642:
+	.string	"__HAVE_FLOAT16 0"
+.LASF882:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF634:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2257:
+	.string	"serialReceiveCallbackPtr"
+.LASF1668:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1726:
+	.string	"__DECL_SIMD_sinf "
+.LASF907:
+	.string	"USE_D_BOOST "
+.LASF440:
+	.string	"__USE_POSIX199506 1"
+.LASF877:
+	.string	"USE_GYRO_KALMAN "
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1079:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2020:
+	.string	"_Mdouble_ _Float32"
+.LASF544:
+	.string	"__stub_revoke "
+.LASF714:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF516:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1196:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1627:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"USE_OLED_UG2864"
+.LASF1109:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1906:
+	.string	"__DECL_SIMD_log1pf "
+.LASF942:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1092:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1047:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2231:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2232:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2233:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2234:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1843:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF926:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1337:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1533:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1756:
+	.string	"__DECL_SIMD_expf "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2251:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1954:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1825:
+	.string	"__DECL_SIMD_exp10 "
+.LASF645:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF445:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF720:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF850:
+	.string	"_STRINGS_H 1"
+.LASF1813:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF845:
+	.string	"_VA_LIST_T_H "
+.LASF741:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1730:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF443:
+	.string	"_ATFILE_SOURCE"
+.LASF932:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF892:
+	.string	"USE_1WIRE "
+.LASF1791:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1315:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1396:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2096:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF537:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1978:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF800:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1385:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2259:
+	.string	"serialPort_s"
+.LASF2291:
+	.string	"serialPort_t"
+.LASF2180:
+	.string	"OWNER_PWMINPUT"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1469:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1830:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2321:
+	.string	"BAUD_AUTO"
+.LASF1285:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF2280:
+	.string	"serialTotalTxFree"
+.LASF1773:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1723:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1305:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF491:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1105:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1048:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1149:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF1787:
+	.string	"__DECL_SIMD_atanl "
+.LASF2252:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1858:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF808:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1710:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF1162:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF831:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1186:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2086:
+	.string	"DMA_NONE (0)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF991:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1098:
+	.string	"bool _Bool"
+.LASF1021:
+	.string	"___int_ptrdiff_t_h "
+.LASF1271:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1885:
+	.string	"__DECL_SIMD_log10 "
+.LASF1369:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1831:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF518:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF717:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1886:
+	.string	"__DECL_SIMD_log10f "
+.LASF1824:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2307:
+	.string	"FUNCTION_RCDEVICE"
+.LASF2362:
+	.string	"gyro_s"
+.LASF2371:
+	.string	"gyro_t"
+.LASF1324:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1392:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1715:
+	.string	"__DECL_SIMD_cos "
+.LASF864:
+	.string	"USE_BLACKBOX "
+.LASF1689:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1551:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1157:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1343:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF768:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF2379:
+	.string	"findSerialPortConfig"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1866:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1673:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1427:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF455:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF797:
+	.string	"NFDBITS __NFDBITS"
+.LASF2124:
+	.string	"long long int"
+.LASF2042:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF707:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF999:
+	.string	"WINT_MIN (0u)"
+.LASF1286:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1290:
+	.string	"IOCFG_OUT_PP 0"
+.LASF2147:
+	.string	"rate_num"
+.LASF1949:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF666:
+	.string	"EXIT_FAILURE 1"
+.LASF896:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF627:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1049:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1172:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1072:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1233:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1263:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF1594:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2164:
+	.string	"blackboxWriteBuffer_t"
+.LASF2030:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF1181:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1350:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2115:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF1348:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF905:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF822:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2228:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2191:
+	.string	"OWNER_SPI"
+.LASF617:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1161:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1226:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1557:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1466:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2275:
+	.string	"rxFrameCallback"
+.LASF903:
+	.string	"USE_FRSKYOSD "
+.LASF2248:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1422:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1227:
+	.string	"PG_CF_END 56"
+.LASF1936:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1083:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2387:
+	.string	"blackboxDeviceReserveBufferSpace"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF415:
+	.string	"__USE_ATFILE"
+.LASF1284:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2077:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1828:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1568:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2306:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1043:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2110:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF825:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF521:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1718:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF927:
+	.string	"USE_SERIALRX_SUMH "
+.LASF628:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF501:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2122:
+	.string	"long unsigned int"
+.LASF1326:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2201:
+	.string	"OWNER_LED_STRIP"
+.LASF1585:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF986:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1036:
+	.string	"USE_UART2 "
+.LASF420:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF993:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1258:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1118:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF709:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2059:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1246:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1702:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1577:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF848:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1274:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF706:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1991:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2171:
+	.string	"FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1201:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2369:
+	.string	"sampleDeltaTimeUs"
+.LASF1219:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1176:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF699:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1817:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1754:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1834:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1757:
+	.string	"__DECL_SIMD_expl "
+.LASF1037:
+	.string	"USE_UART3 "
+.LASF1166:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2003:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1573:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1925:
+	.string	"__DECL_SIMD_acosh "
+.LASF1096:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1868:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1251:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1743:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1344:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1302:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF1123:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1278:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF934:
+	.string	"USE_RCDEVICE "
+.LASF1174:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF695:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2332:
+	.string	"BAUD_460800"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1842:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF481:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF473:
+	.string	"__STRING(x) #x"
+.LASF1059:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1316:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1159:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2328:
+	.string	"BAUD_57600"
+.LASF1228:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1975:
+	.string	"__DECL_SIMD_tan "
+.LASF2127:
+	.string	"unsigned int"
+.LASF406:
+	.string	"__USE_UNIX98"
+.LASF1038:
+	.string	"USE_UART4 "
+.LASF1809:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF779:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1239:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1974:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2159:
+	.string	"blackboxConfig_s"
+.LASF2152:
+	.string	"blackboxConfig_t"
+.LASF1697:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1608:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1328:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF494:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1597:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF504:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1876:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1044:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1635:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1421:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2017:
+	.string	"_Mdouble_ long double"
+.LASF922:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2373:
+	.string	"blackboxMaxHeaderBytesPerIteration"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF687:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF457:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF2397:
+	.string	"retainLog"
+.LASF2148:
+	.string	"rate_denom"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1131:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2185:
+	.string	"OWNER_ADC"
+.LASF2131:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF881:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2403:
+	.string	"blackboxDeviceFlushForce"
+.LASF1761:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1869:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1657:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1464:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1674:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1039:
+	.string	"USE_UART5 "
+.LASF1620:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2037:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1200:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF683:
+	.string	"__S64_TYPE long int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF796:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2223:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1967:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2113:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF1055:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1110:
+	.string	"EXTENDED_FASTRAM "
+.LASF1905:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1832:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF523:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF833:
+	.string	"_STDARG_H "
+.LASF2376:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1661:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1128:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF631:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1541:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF431:
+	.string	"__USE_ISOC95 1"
+.LASF1855:
+	.string	"__DECL_SIMD_sinh "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1750:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1528:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"IOCFG_IPD 0"
+.LASF1445:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF548:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1040:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1867:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1467:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2510:
+	.string	"typeconversion.h"
+.LASF2484:
+	.string	"thread-shared-types.h"
+.LASF2434:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2525:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2436:
+	.string	"/usr/include"
+.LASF2529:
+	.string	"mathcalls-helper-functions.h"
+.LASF2467:
+	.string	"floatn-common.h"
+.LASF2499:
+	.string	"stdint.h"
+.LASF2421:
+	.string	"src/main/build"
+.LASF2433:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2504:
+	.string	"stdbool.h"
+.LASF2445:
+	.string	"flash.h"
+.LASF2442:
+	.string	"time.h"
+.LASF2478:
+	.string	"select.h"
+.LASF2532:
+	.string	"bus.h"
+.LASF2429:
+	.string	"src/main/target/SITL"
+.LASF2530:
+	.string	"mathcalls.h"
+.LASF2483:
+	.string	"pthreadtypes.h"
+.LASF2502:
+	.string	"common_post.h"
+.LASF2511:
+	.string	"parameter_group_ids.h"
+.LASF2432:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2455:
+	.string	"libc-header-start.h"
+.LASF2473:
+	.string	"timer_t.h"
+.LASF2496:
+	.string	"platform.h"
+.LASF2437:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2509:
+	.string	"printf.h"
+.LASF2443:
+	.string	"blackbox.h"
+.LASF2446:
+	.string	"resource.h"
+.LASF2512:
+	.string	"asyncfatfs.h"
+.LASF2471:
+	.string	"clockid_t.h"
+.LASF2425:
+	.string	"src/main/io/asyncfatfs"
+.LASF2453:
+	.string	"stdc-predef.h"
+.LASF2522:
+	.string	"vector.h"
+.LASF2523:
+	.string	"math.h"
+.LASF2474:
+	.string	"endian.h"
+.LASF2427:
+	.string	"src/main/msp"
+.LASF2456:
+	.string	"features.h"
+.LASF2431:
+	.string	"src/main"
+.LASF2426:
+	.string	"src/main/io"
+.LASF2469:
+	.string	"time64.h"
+.LASF2458:
+	.string	"wordsize.h"
+.LASF2423:
+	.string	"src/main/config"
+.LASF2521:
+	.string	"streambuf.h"
+.LASF2457:
+	.string	"features-time64.h"
+.LASF2495:
+	.string	"strings.h"
+.LASF2488:
+	.string	"struct_rwlock.h"
+.LASF2476:
+	.string	"byteswap.h"
+.LASF2462:
+	.string	"stubs.h"
+.LASF2448:
+	.string	"gyro.h"
+.LASF2464:
+	.string	"waitflags.h"
+.LASF2498:
+	.string	"target.h"
+.LASF2517:
+	.string	"io_def.h"
+.LASF2535:
+	.string	"bus_spi.h"
+.LASF2450:
+	.string	"maths.h"
+.LASF2465:
+	.string	"waitstatus.h"
+.LASF2508:
+	.string	"encoding.h"
+.LASF2452:
+	.string	"msp_serial.h"
+.LASF2500:
+	.string	"wchar.h"
+.LASF2459:
+	.string	"timesize.h"
+.LASF2422:
+	.string	"src/main/common"
+.LASF2435:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2534:
+	.string	"rcc_types.h"
+.LASF2472:
+	.string	"time_t.h"
+.LASF2438:
+	.string	"stddef.h"
+.LASF2528:
+	.string	"fp-fast.h"
+.LASF2514:
+	.string	"flashfs.h"
+.LASF2466:
+	.string	"floatn.h"
+.LASF2526:
+	.string	"flt-eval-method.h"
+.LASF2533:
+	.string	"bus_i2c.h"
+.LASF2497:
+	.string	"common.h"
+.LASF2463:
+	.string	"stubs-64.h"
+.LASF2515:
+	.string	"io.h"
+.LASF2505:
+	.string	"parameter_group.h"
+.LASF2449:
+	.string	"blackbox_io.c"
+.LASF2519:
+	.string	"io_def_generated.h"
+.LASF2444:
+	.string	"blackbox_io.h"
+.LASF2477:
+	.string	"uintn-identity.h"
+.LASF2513:
+	.string	"fat_standard.h"
+.LASF2524:
+	.string	"math-vector.h"
+.LASF2475:
+	.string	"endianness.h"
+.LASF2441:
+	.string	"stdint-uintn.h"
+.LASF2470:
+	.string	"clock_t.h"
+.LASF2527:
+	.string	"fp-logb.h"
+.LASF2461:
+	.string	"long-double.h"
+.LASF2460:
+	.string	"cdefs.h"
+.LASF2492:
+	.string	"stdarg.h"
+.LASF2518:
+	.string	"utils.h"
+.LASF2468:
+	.string	"typesizes.h"
+.LASF2420:
+	.string	"src/main/blackbox"
+.LASF2520:
+	.string	"msp.h"
+.LASF2531:
+	.string	"sensor.h"
+.LASF2501:
+	.string	"sanity_check.h"
+.LASF2493:
+	.string	"locale_t.h"
+.LASF2430:
+	.string	"src/main/target"
+.LASF2507:
+	.string	"axis.h"
+.LASF2486:
+	.string	"atomic_wide_counter.h"
+.LASF2424:
+	.string	"src/main/drivers"
+.LASF2479:
+	.string	"sigset_t.h"
+.LASF2447:
+	.string	"serial.h"
+.LASF2491:
+	.string	"stdlib-float.h"
+.LASF2454:
+	.string	"stdlib.h"
+.LASF2482:
+	.string	"struct_timespec.h"
+.LASF2506:
+	.string	"build_config.h"
+.LASF2481:
+	.string	"struct_timeval.h"
+.LASF0:
+	.string	"./src/main/blackbox/blackbox_io.c"
+.LASF2428:
+	.string	"src/main/sensors"
+.LASF2440:
+	.string	"stdint-intn.h"
+.LASF2489:
+	.string	"alloca.h"
+.LASF2536:
+	.string	"dma.h"
+.LASF2494:
+	.string	"__locale_t.h"
+.LASF2439:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2487:
+	.string	"struct_mutex.h"
+.LASF2490:
+	.string	"stdlib-bsearch.h"
+.LASF2451:
+	.string	"string.h"
+.LASF2503:
+	.string	"blackbox_fielddefs.h"
+.LASF2485:
+	.string	"pthreadtypes-arch.h"
+.LASF2516:
+	.string	"io_types.h"
+.LASF2480:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\235\007"
+	.string	"\204\013.\001"
+	.string	"\026"
+	.string	"\230\260\234\345\001\006\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\352\263\360\321\b\002\310\245\246\353\001\003\362\232\217\360\n\003\002\003\004\240\342\234\212\n\005\327\250\367\272\016\004\006\361\304\232\254\b"
+	.string	"\007\217\316\213\235\b\n\002\004\002\005\002\001\002\005\b\t\201\257\375\302\013\b\004\n\371\370\260\260\005"
+	.string	"\013\351\271\373\301\017"
+	.string	"\f\211\377\330\244\f\002\002\006\002\007\016\332\217\306\336\006\024\002\006\002\b\002\001\002\t\002\n\002\b\013\002\006\002\021\022\274\272\233\355\001\004\006\002\007\023\304\260\210\260\005"
+	.string	"\024\217\337\270\330\007"
+	.string	"\025\355\247\210\324\f"
+	.string	"\026\254\257\375\372\f\n\f\027\030\320\326\345B\004\002\006\002\007"
+	.string	"\030"
+	.string	"3Q\b\276\227\017\023\021\3065\027\036\312\0344CC\356\311.\021X\346\300\030\3104\200\243\354W,\200\271<\317\264j\257\025o\200@\273\013\340\250)4/Y\261\253"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \300\255\003"
+	.string	"R\305\017\030\240'\351\377\377\240\376\377\377\177k\360\366\377\223\r\372\226\020\261\255\311\235R\226\372[qb\"v\037\246\2410\007{\004e\343I\327\210\310\003\227!\n\330\307\256\234U\324H\357U\"\262$\270\b\026"
+	.string	"\020\343\2133C0\325\261\354\361\364\266\020\"\250\300.7@K\233\002\250"
+	.string	"BH\320i\300+\303*6^\f\027e8g}7\341%\206\234\341o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`W\002e\013"
+	.string	"\202O76@\255\322\030\332c\221\305\222\247\371\204w\\\257\264\240\205\372~r\231\036\273\275\274d)\350\025\337\002\2139^\226\3070\3600\376j\242\253\246!BH\004\322\210\224;\005\2138^&\225\007\352\250Da\342-"
+	.string	"\346\211\025\302\3201\265b\260\315\001\236\316G\007\330\335\275\\\346|\374B\313\317\3312\025\220\246d\224P\bT\264"
+	.ascii	"\221*8\243\332\211$\361\332\366@\275S\330]\321Op\177\344b\214"
+	.ascii	"\230\fAQ#\r\"\003\t\372\241Bmx\336\376\302\317\n\217\022\fM\202"
+	.ascii	"t\260\\\231-\237\354\304\341e\321\255\201t\273\362\317\305.W"
+	.ascii	"\273\313\205ru\021\241\321\255\007\231\037A%\331]\313\371\027"
+	.ascii	"\306\337\323\277P\177L\366\237\347'ww\265\007\245\353!E\362\362"
+	.ascii	"cHG\255\030L\363\233\325 > \200\002\0211\302\007\326\002\342"
+	.ascii	"+\245\365\353P\302\020H\001DF\037\203\211&\217A\020\0237\b\241"
+	.ascii	"\030\007\220\245+N-8!4\307&\342\013P\016\\\374@\224\364=^\246"
+	.ascii	"\025\352s\261hvy\232\205z\006V\340\330\224\017\201\03704\201"
+	.ascii	"2+\201\001+\003\030\231\330\347\032\277<%c\030\2154Q\\+\202?"
+	.ascii	"_-\254\222e~\255\"\304;\304e\332\303\332j\370|x\321\036\350\f"
+	.ascii	"\263\270\276=h\001\277x\333u\233m\224\242\270\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\214\001\305\b"
+	.string	"\"N()\200K2\034s\021\265M| \021\246!\205m\b\235\020\306o\263m\373\220\244\326\353\221\337\242\317\375R\006nCw\334D\246\024\252\336\202\024U\220a\372\t\212\240\036\200<\264+\311+io\033\"\315\311rx\212\021\241\032}\236Y\036\342\350\030ixK\326ZkC\240\016\254B\210\262\355\005\314\330p\246\261\"\211\371\217\367x\253\311/\300\220dy3k\251/\351/i{1\364$\211\t\n\037\030\244\022\275\"M\235\235-\322P\232L1\017 \343\246Z\205T\r=\216\23655S\005\273\371i\340\2340 0\002b\240\233\363Y\022\027\0042\340\353 A\212X\2732\0361\220\323y\334"
+	.string	"\035\227\320qo\033_\001D^\314\030\027S\214\017\356\375X\374\230\305\307\207iA\2741sz8\\\332q\264\024\f\243\202"
+	.ascii	"\"\333\200:[)`\220\343(\013\366\005\357\206\027\323\"\034\366"
+	.ascii	"2\350\314\265\200f\n\034\327\363e\332!\007r\311\306\0066\\\b"
+	.ascii	"Z\200&\216+\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\231\004\002\230\004\003\230\004\005\205\004\006\230\004\007"
+	.ascii	"\230\004\t\270\004\n\230\004\013\230\004\f\230\004\016\231\004"
+	.ascii	"\022\230\004\023\200\004\024\230\004\025\200\004\026\230\004"
+	.ascii	"\030\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`a"
+	.string	"\215\005"
+	.ascii	"\362\306\026\037\220\273r\177\377\361\314w\346c\367\365\221\255"
+	.ascii	"\263\277+V\bt\253\355.\002\265q\177\373\313\224\002N\024\013"
+	.ascii	"\342XQ\325\304\242\036g\311\\\225\346Z\001m\241\204n\204\207"
+	.ascii	"i\376X\343\330\005\tc\256Ad\201z\344\215M\3066\360\\v\226\266"
+	.ascii	"\022\340y\264]\314\267\335&\244A\227\004& p\002B\245<p3\324\022"
+	.ascii	"xkb_5\333Pb\215\301\364\265a\262wn\243I\002\256\234\n\205\003"
+	.ascii	"\223\341\317F\267\027$\032)\3016\021z\300\336\"\032\2250\221"
+	.ascii	"\003\346\016\r\f@C\327M\216\203\203\034\217z!GX\264\376\362\262"
+	.ascii	"\\\320j\330\204\003"
+	.text
+	.section	.gnu.lto_.lto.5b8afa7aa992accd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_blackboxOpen.47.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\005\f"
+	.string	"\366USC\020S\224\016\203\355\004\222\021\240@\200FP\006\025G\334\304\242\271\220\233\207\362)2\230k\224\357f\033\301\356\366\372\021\032\355s\357\377,\002\302\306\035\032\340l\177\320\005y~\223\257\002\355\355\243M\366\226)\005>"
+	.string	">"
+	.string	">"
+	.string	"v\217\207.\366%/D\320\370\261\273Xlq\3562*\347\237\365\213\367u\227(\036%\202\224\0342\002|+\251I\261\242\306Y\327\021\237JU\244\301\356Z\275\357\304}\335v\004\333\231\375\004\001rw\327q\304>x\3139Uv\030\320\261[bH\220=\271l\3048\370\333?\313\230\003B$|\306I\270\203\250o\b\023\027/\005\206\312n\250\340\2279\226_\016?`\376\262\\\300\374e.\232\006\275\347\314*v\006\320\302\241\037\n\t\223\210\2322~Jx\254\024\210\265uC\306\203\317\244t\305S\377\r\363{\016\323\366\360A\357\311x\022\025 bgm\231\240\254\256\330a\247\221\205\375\366p\026tB\f:\236\r\201\323\246Q(\231&\204H\016\036\204D[f\301T\300\240\2156\252\320A\373\\"
+	.string	"e\030>\030i\224e\300@\233\t\333h\254\225D\033v\322\264\r\303\204{\271q\004\202\217\223TT\311\213\312h\007\022"
+	.ascii	"K\035\017gV`\2517\023\272\204\002\017x\313\307{-\325\030hYa@"
+	.ascii	"\3024\005P\tH\327\224 \334NT\266\210\313<U\223S4\265\007"
+	.text
+	.section	.gnu.lto_blackboxDeviceWrite.48.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`P\002\035\024"
+	.string	"\026'\210I\320\360(\035\002\202\020\304\3101*n\360F\235\277\210\256w\177C\364\017\352\201\204F<\203\252\261\036}W\243\365\337f\021\314+A\216Q=\362c\253x\210\271EsRS`\340\022!\247\303Pm\203\t\037\255\261\331\275\345N)q"
+	.string	"m"
+	.string	"u"
+	.string	"\267\373\234dV\255;P\301Z\253\210\027\204\247\257\351\002\306.\355\013\235\304\355C\025\016\240\326\236\031\301Z{\".\tO\335{\210\3524|"
+	.ascii	"\325\251o\266\215\367~\352\212'\310\006\370Tk\205m\207\337>W"
+	.ascii	"\336\374\377\316\332\361h>1|\347\201&\0269>x\272\031\202\343"
+	.ascii	"a\367\337\345\r/'\345\n\245\326j\271\343]\270\351m+\260\255b"
+	.ascii	"\313\f\001\002D\004u\334\2502\312\356\345\344\372\330\237\265"
+	.ascii	"\326\352\355\261?\364{Hi\361\300\273u\337\037\336w\323\225\236"
+	.ascii	"Sz\247\264\\\351\177\200\200\340\240\201Gh\231z\025gJ\252*\321"
+	.ascii	"\243\017\007\376\366]0b\276\t\377\304\215,\272b\304\354\"'\275"
+	.ascii	"\032\204\247.\246\230\rt\322K\327\253\274\225\324\206'!\004\247"
+	.ascii	"f\020\236^\264]\301\230\354\275D:\270p\305=\221Q\203#'\247,\""
+	.ascii	"\265\366\300\277v[[\300\311f\207\207\374\332\264\026\371\335"
+	.ascii	"n\213"
+	.string	"HG\2674V\215\b\367E\277\223\016NF\371F\247!v>\212\210\226\376\003\325\024\334\365\261?\252\344\326~5t\022\312\366\313W\214a\2555\346\253\240 !\004\232Q\235\312e\r\371(\236b\306\007r\214\214\374\356\324\227Q\235~\t\320\310\301\311)\257\004)\005$6\007,.)\252\022\033\204\007\264Z\312\312\006#3\316\250OJHLV\022\230\234\214\f\220\331d+\323\263\221\221\2262aTi\231\311\\T`04\331\013lV\213\201\215\030\360\030\201\245\006\263\215c\r&\366p\237u{X@A;V\\O\031.\335\033\277P\302m\316\253\026 \222\256\307\316\265g,\362;\277j\226\346h.+\347\277\337B\021\322\022\335\373n\024\334\024\367\367\351\"' P\002A&]=\367\223\300\251\267\300\320$\n\254\032\261\206\025\\\3771\332\233\207\311(\343\001-\336\227Y\241\335\"v\301\210(\332\025\033\343"
+	.ascii	"oM\242\003\316\312\271\237\177\353\200\354\025.\337\360z\024"
+	.ascii	"N\322\033F\222\224#\244\362!K\177\3608'\317T\0334\301'\244\b"
+	.ascii	"\227gMN\321\372\036"
+	.text
+	.section	.gnu.lto_blackboxWriteBufferFlush.49.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\200\001\275\r"
+	.string	"\346WVC\020q\224\016\343!@w\300\002\364\005X\243$r\332\005Mi\216D\270\354c\2011\020@T\001+\007\350\177oE`Qbn\373\326\320\260\377\377\357\204\025\b\204\017\247\312\360\t\205\027wn\033\331[\312\224\002B"
+	.string	">"
+	.string	"C"
+	.string	"\031\237l\027\377\274\375J\305\243d\306\356b\272\341\247C\315\223\177\361\354\356E\016\200\353P\207\031\256\360@\312I\214M\327\001\005|x\340.\362\264\320\2512/\236\335ur\035\206;\336\366\002\333\b\354\267\004\033~\207GK\340\310s\217>\307\365x\345p\030Ie\313\311\222\301b\223\305\376P\251!\366\341*\210\255\351K\323\361i\250i\315t>}M\200\013+\006\250\330\375h\321X\224\210\342\203\355\007POb\177>\"\303\260\224e\223\251\007\361\022\021f7u\316np\222Q\002\357qeR)\317\231"
+	.ascii	"\005E\371\232z\217\032\032\226\312\275\225\024\023\365v]A\253"
+	.ascii	"\026\035\271b[\273\210\r\263\273\n\374\020\037\t\016u\264\321"
+	.ascii	"g\202\006\"\2052\007 \354\301(+a!\323\006\326)`\r\202\310\204"
+	.ascii	"E\3204\023\226\371\366p\025\304\f:\224\224\252\240\206|?\331"
+	.ascii	"L\fx0Z.=\221q<\023\347^DU\2754\246\250\240A\225-C\215%6\022\001"
+	.ascii	"& \220\002\231!4\017\240\325\033\032z@b\bm(~\334\341\242aY\213"
+	.ascii	"\267\261\251t\240\330\330Xu\021\337\033\214\214L\266\242:\200"
+	.ascii	"D`\013\266&\263\n\232\260\001\326\021\013\307l\032Y\323[\204"
+	.ascii	"oc\025\277;d\035\005\255C\006\304\007\343O\204\n\206}3\004\301"
+	.ascii	"\\\246\024b\017"
+	.text
+	.section	.gnu.lto_blackboxWriteBuf.50.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`@\004\255\034"
+	.string	"\226u\271H\240\326Q:$\256\332\022\360;\\{\257(\247\314\206&f\177\02489&\216\214\\\\IcJ\370\330\270\242\257\231\004\245\270\003\206L\206N\277\300\247\340)\3702\336!j\242\362k8~C\245o\367\206\375\222O6\221;\245\241"
+	.string	"\233"
+	.string	"\244"
+	.ascii	"\fN\235\241<=\315\306\341\345\346\360J\214.e-\313j\305\321\005"
+	.ascii	"\253\326\352\300\030"
+	.string	"\312\323\333X`L\356\323\376\221#1\2720\305kj}\272\302\252u\350\300\020\312S\017o#O\313\013 Omd\177\3710XO\365S\242\002\253\265\342V\207\311i\364\030I\307\235F\376\214*\376\200G\217\215\261$\027<j@\245q'\354+\312\247z\223\234\375`:\225\361q\324I\002\253Q\003&\2154aJ[^\365\271\004D\232\373\251\217D\202\\~@\246\317X\205Z\253\347\017\b\343.o\333g;\310\036/\004\324;\022\363\277S\237\004y\372M\020%\344\315\242_\365\257 \322X&[I\300\365$6i\251\223\214=<\232\013e\177'\030\366\345}\262ols\332\346Vw\315\245\376\332\205?\200K\335\263\013o\3318]\216\323\261q\232$\247)\235\036\347\364\216\323s\234>\201\2310\313\002,\265\272(\226\251]4J\217[\375\366q\232r>\023\277\311\235\230\2063\203\250\302\007\312\312Z7\244"
+	.string	"\025)G\021kCy\212\303\"\347/\361\253L;\305i\221\263\251P\224G/J\242W\323W\2555D\006\314qeK\327\326\300A\307\311\267G\366\253\224\030\020\374\331>q*\035\032t\251\265\356\234\332<\237\322\243 x\272EwR\375\230lv\244!\016\321b\263\247\372\253>n9\361fk\263;f|ahFj\366V\277\355\316zk\2215{\300\214\317Go\026=w\367Jgx\263(%k\356\364\362Bj\315\366\304\223@'\336$\343;9E\202\203\206\030$\006\255M\033\b\304\374\317\267\336\036\271F\264a+6\200<\215\013\345Y\257#\277DS^\220f\230m\241C\321\225\265\326\234\377\344W\"\374\035\017\021\212>"
+	.string	"\205\340!u\212\202@\b\021\361\304tC&\202~h\321\220\211\335\0175\005\b\017&x\2200\201B\016\201\236\242\036\017\243\177rvB<'v>\272\237\236\020>\270!\241\036\021\270\037\242\022\270\034\004\336\215"
+	.string	"\"\302\025\355vD8\332\260~\237Jb\222.\336\366b\013\3452Y\\\364\246\266\263]z\325K\260\254+j[\217\023\300\312v\211\301gk\201\353S\277\214_\223lV\340\215\265\326J\336\354\245~\343\315\366fo\306\347\303\210m/\374\315\266\027\343\023\322+Rn\026\235\201`\327\177`bKn\271\367\335\350\305v\364\342\322\225W\3105\020%\234\005P\250A4\307\020b\312\004\"\024\210\004#4\315\030\220\002\021\262\353\006\020hJ\332\244pg\366\201\237\321\202\033\r,\303}uu\326/\272O\b`\241\367\206\177\264k3\311\353\3061q-\200k\006\030\n\006\024?\360\221\314(\21012\300c\260\214y\216\372\247\bhGj\225l\261S$\326\243\253X\307\340\265\204\035\376\320r~Fc\033s\315$dC\273hc\005\225\246\033Y\001\332\235o\201S\334\330n"
+	.ascii	"\255\324n\322eoJH\340\013*(6\270\355\234\0202*\334\365)\334`"
+	.ascii	"\t|\363\017\214\007A\363\216~\241\232\335\310T{\032"
+	.text
+	.section	.gnu.lto_blackboxPrint.51.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"5\013"
+	.string	"\346\324MB\020o\225\016\217\r\017D`\304\013\f\217Dc\236\224\350e\200\367\264i\033@\224\003\220\233\254\021\304+1\3367\307\225\3150\177U\272W]!\016\356\267!\013e\"IQ\254\224\"\360\277\022M\310\226;\2458"
+	.string	">"
+	.string	"6"
+	.string	"\266\317\341\035>{\304\024-\244\316\272\200\372\300bw;\3139\266k\363\033\3335\255\360\357\362\363\357\372\334\200\341\025\246\300K\f"
+	.string	"\273k\031\246(\334z\333\037\266\005\330\027\t+` 'v%\314Z,\nM\204\206\217\277\375\371.S*\260\314\307\006\0348\201{\251\310\020\333\335\220k\016\300UHd.\355{x\353\273\350\340\032\273\253V\210]q\304\030\356\232E\316\001\266D01\365\343-')\363u\352]\240^\234\344\314\233T\265\025,\220\017\257#\025\004\005-A\224H\261Rf\213\240T\226\375\271\272\262?\336\363\342\257*\375m\022\006L\005D\237\320\346\r\206DC\240D\263\271t\224n\317\305\003\r`\340u\016x8\241N'\002q\020t\036R\251\273x\330K\360!u&\317#u\024qoO\335\250N\372\300\223X\206\234\352\215\344\303\021"
+	.ascii	"4\317\001K=\231\001aX\036\202\372\274,\2251h\214\250\022\333"
+	.ascii	"5\021K\013\255\262 A\241n\242\n\002N<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlush.52.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \362}\006"
+	.string	"\202K,4PO\222\016"
+	.string	"\321\031q\035\331[\251dRm\207[\214Y\275\324\321y\333\254f\255\316@\244w\210\321\324\250\361u\325HF\321G\0136\252\021\312\251F\233\354\024S\323\3334\\<\r\004\225\211\320\270\211MF\302QU\205\233\f~\024\017\225\263x\257rR\326\301\004-\234\210:y\355\220R\311C%\333cd4\304.\270\2223\001\312\307\245\245\355\345\263\253\345\307#@\333\236\240O\206\317\210\005\241\244\335\210\201\251(\300D\344Gi\353W0\013)\206H4B\243\266.A\320\302f\2158\202\003\230\207\203M@\241\355\r\363p\340\211\377\301\237\360w\004\n"
+	.ascii	"`\2517\023\360\2003X|\221P3\336\031F]\006y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.53.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"%\013"
+	.string	"fUNC0\251(\035\240y?\316R\3466\363\367\f\316\242\223\035e6\353)\035\271\211\350\373\f\200\344\034a/\371\004{"
+	.string	"\205\276\032\204\351\211\272\337\0171`1\030ZA\361/\301\354c\003\2448\201\216O\266\2242\005;"
+	.string	":"
+	.string	"<"
+	.string	"\377\366\r\016\322;\035\305\223\246`-\n^\335\343d\001\332\251\344\355\256\016\241\2472BYJ\234\b\200[\370\311\f\227\203\013\020\241i\267a\323\335_0\004\240\327\364\277\307\177\215_g;\373\026\223\240\355\257\302\262\n\336\342c\357\252R\220\b\006`\026z1\374\343\267\234\372U6\243\376\357\345\367\274\373\315\244\004xU\230\020\272O3Y\263\264\007\005\376\353\257\007H\001\314\314\336\177\322O!#\366Kwcl2\226\267\031T\214\271\032\360)0\313\023\tZ\246\215\375\007\351\030\312t\233:\256+E\300]\007\250\366\223\321*\250\332u\204Qm\271\242\265*\005\367h\270O\310\n\327\001y8$\235Y\362\341\204\246G4\232\232\213s&\"\242\211\302q\242\271\215%e\324U\245\037\023\304\005\f\366\332a\316\314\222]\376K\376\246\304\237|\330\177\344\263\n\006\017"
+	.string	"`\325{B\300z:\376d\366\326\252\027\243V"
+	.ascii	"\201p\204\330\213\t\250\317\340\\\303\353\207(\343.\267\264\367"
+	.ascii	"\026\246\036"
+	.text
+	.section	.gnu.lto_blackboxDeviceOpen.54.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`*\005\205#"
+	.string	"\252Bx\016Ep\250M:\023zk*\231\001\224\211%\255V\022\027\323\003\307"
+	.string	"\342(\332\003d\324k\273\356\377ul\333\312(\037\300\235\262H\240CQs\221\241(\276"
+	.string	"P\240\001\362\003C\307\210N\bL\307&mo\"w\222\001\324"
+	.string	"\307"
+	.string	"\320"
+	.ascii	"\200\364d8\336\233\3656\350\316\241h\242\274\370\217\375do\346"
+	.ascii	"\033\371\320\300\347\3027\336\313\313Xg\364\343\313\301P\235"
+	.ascii	"\f\307\357\225Vn\353\253\310T\236\262\2614:2\246#(&Eyj\304D\303"
+	.ascii	"\273\\\214\352\305\251\362\247U"
+	.string	"\236\251\215a\273\327\370\340\224'\224\247I\347\325S\362\003\352\351\231\251\230uL\301\002\025\333\033\301\262\376\205%H\006\350^c\257\277n_\342*%{Z\376\357\345\313N\267\304\260\341\342\226d\253\3538\256W\322\201\2217?v\303+\222GG\t\236\340\244\007v\235$!t\215\201\263\033\356 \007\250YQ\362\262O\254\241\325l\222\227\005E\250\033V\221\016\330\316\370\331\r\255\346\304m\270\367\362\024\016\267\316\2713s\0263?1S\005\001/\036\207W\321\326\3568\344\365\311\236\004\234\202\370\300\374}\211\312|\"\305\274\220\327\357\342e\325?~\331\337\343\354-O\tv\265\356\275\rv\201\346\374&\241\203\005b3\323G\365]\340\313\232\325\f\304\314*~\\Q\336k\245\3047\373\031\213\026.\\4\322\232\330<sK;Se^:\031\246\004`\367^%\276\230\217i\342;9e\031N\363\302S\276S=]"
+	.string	"\306\0078\337\370[\216\342\217\227[\333\235\202\230\215U\263\211\314'\357\275\227{\t3O>\372\330\371\300\311\316<\236\034\340\305sQn\362\216N&\032\232\f`h\262\0167y\b79\207\233\\\346&\343\312\311\0257\231\322\311d\235\334t\362\221\316\305\026C-\2676\\\363\325^\347\311*\261\304I\254\247\215&l\2030\213z\336\206U\332\275\363m\223\3724\257\315l\237\330(\363B\\\223wH\377\244<\315RA\002S\252S\033)L\f8\337\216m\322n\277x\336"
+	.ascii	"\304\251\371\213\237\362\"pL\223fv\201\304\332D\336\361\270\267"
+	.ascii	"U*\355'\341\021\227c\253\\\340\303y\034{\205\264Y\354\226j\267"
+	.ascii	"\324S\332Gah\252\244\335\376\330\223\310>\320\r'X\210\331v\271"
+	.ascii	"\033[,\327\240\340P\336{\311f\260&\266;J\351\346\263y\233\016"
+	.ascii	"|'\354\341\303\0073a\033\202\3714\3475s\b\021\363\302\356sy\355"
+	.ascii	"\350\037K\271\2611\0374(>h\023\337XL\316\344!\233\310\307Qy\375"
+	.ascii	"$\273#\327T\r2\234b@\371:\f\345h\202\001\005\242Ij\311\004\214"
+	.ascii	"\033K/\210\030\303\004\t\026`T\260\200!\202\001\033P>'\251\032"
+	.ascii	"$\244\242|5t\314\024\301\347\344\"\207\357\305\f\246%\032/zP"
+	.ascii	"NKO=\246(\033\275\b\n\330W\243)\252'\345\363E\365t\314\314F\340"
+	.ascii	"{\t\013\b\303\n"
+	.string	"\036qG\375\262\207P+\023\346H\362m\r\020\240y\003\260\253\312&2U\220z5/\372\222\023<\322\371\251Z\324XOu\327G\375\240\232>\273^\260\326\205\206\213\250\371m\337c\213Yv8\024\266\001h\242\256d\301BJ\223\215g\264\n\341: \226k^\b\240\223\256\372\307C\255\353\212\026,\004\344\223\353\2416\352s\245\245j\276q\337\022\251e\347\332\310\354jJ\225\220\343\261D\354\374\216-\302G,\022$}0kb7\002Z\250Q\034\347\220C\216!\221HD\0244M:P\002!s\350z\020X\310\266I\007U\003h\017y\314\325;\275\035\231\346o\t\341\320\310]\202\204\001^\303\356#\220\327i\2718\032`\302o\\\360\235\216Q\205LJM\251\027\202\206\260\245\361\300\031\210\365d:\312{\363!\350\325\243TZ\247\2167\262Q\345\227V\320A\016C|\346\227n:X\271\250\3255ye\020"
+	.string	"\276\027\217\263i\337B\371\350\260\306\0057\033\350\304\245[\2020\242\254q\004\244-Z\307\215\301Anl\200\216^x@"
+	.ascii	"]6P\022^\311p'{o\"\306\336\204\354\337\370/<\255*/\344\251\262"
+	.ascii	"\t9\336',$\2645\320AK\261\2145\311\204i&\177\034\326w5"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.55.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\275\013"
+	.string	"F\025PC\020O&\035\200\240lC\f\025*\210\030h\245\203\260A3=I\257"
+	.string	"y~\00488\207\226\177#\264w\006\002T\276\214E\205\021pQ"
+	.string	"\244\001t5^\203\272\371j\206\241#C\204\030\0355!d\313\224\002<"
+	.string	"9"
+	.string	">"
+	.string	"\241\235\342\254rO\242\004\204\021\263\335\375\246\205\207\347\246\206\376;\\c$\305s\035\237\\\005\205a\234\220&\016\200\354\204\013\nyR\315\030\260\273\326\221\224pw\267-\300v"
+	.string	"\373\006\002\376\205w~@\322\217\357|\222\367n\244lQ\322\233+\023\026\306\212\325\232\3152\351\254`\237\333\251\262\257\276\367\224\206\231\n\002\267]\324-\306\276:\024\031l\337\276\207\320\2368\222r#\354\256\205\203\303KT\333K\232\314\3044\210\367\351\321\212\235\224f\273s\021\036\311\356\t\343\207x\353\003\202@\336\273\317\220\330J]\033`\037y\266\350 F\037\345\356b\374\017_5\b\336\\\300\316\001\007\240\306\263\311$\320|\n:\231\317\267\t\211\276\213\210\301\005\234\320\307"
+	.string	"\004C\337\204U:\267S\345\002/^\245i\362\206\213\005l\265Fa-O\355L&\252\215\243\250\315A\240\037=\247\030\024"
+	.ascii	"`\2517\023\232\213b\230q\240\266\"/\232e\263\266\257l\242\002"
+	.ascii	"\251\207\305\345e\202\003\003w\225g+#\313U\203.\344\346\203}"
+	.ascii	"\342\322\305l\347-\3142"
+	.text
+	.section	.gnu.lto_blackboxDeviceBeginLog.56.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \343m\006"
+	.string	"\004\013\200"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\343\316\367#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\215\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367x\361\370\200\365\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\373\002\200\362\371\360\361\025\342\273\336\f"
+	.string	"\203\003\202\260\371\370\003\006\177\001"
+	.string	"\244\003\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\325SC\300P\207pBT\226@]\023\363\"0\023\"\207;\367j\347\023"
+	.text
+	.section	.gnu.lto_blackboxDeviceEndLog.57.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\245\b"
+	.string	"\202\217;:0\221\322\001\017\t\302\250\277P\006LO\005:\2359gNr\2134T?\227{h\255\3350\325\322\271\217\202I\212\004%BF\021\320\035\310\372\t\034\216\277\266\234\231Q\244\355-S\017\201\036\266\213\210-\244\025`T\212\321\307\221<p\340\235V?\213\217*\312\3508\r\021\035}\334\006\355\300\016\252-\274rx %\325\n\322\317=\261\247'\353l\001\2468\272N3\274\22732\302\022V\231\374=@$\243\256\020N\323\021t`\bbw\204\265\274\371o('\311\317\236\236\254\177r\216K\244\ti\351N\355\340\364K\306\322\372_\372?\377\201\214\204\224\374\262\006\\#\276\\\272\257\303A\002\234\375?\304V\272\345k\222\342\326\211\210\212\330}\351,a\313\322\2369\205\031b613+*\023\313\200\211\356\276D\251V\374\311\377\033\376W\374G\t\r"
+	.ascii	"y\236\005V\275\222\205\366Y\fl\210\245\022X\316\013,\226\272"
+	.ascii	"&\246G`4\304\024\236\267_\355$\003"
+	.text
+	.section	.gnu.lto_isBlackboxDeviceFull.58.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \324\355\005"
+	.string	"\024\ny"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\n\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\355\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367~\361\370\200\223\006\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\373\002\200\362\371\360\375U\001\273\001"
+	.string	"\203\003\202@"
+	.string	"\006\177\001\202\300\013/root/repo"
+	.string	"\"./src/main/blackbox_io.c"
+	.string	"\n"
+	.ascii	"`\251'3 \030\246\032\266\021Bs\r\317\212\030D\210\034\356\334"
+	.ascii	"m\213\023"
+	.text
+	.section	.gnu.lto_blackboxReplenishHeaderBudget.59.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`b\003u\031"
+	.string	"V\356\245H\260VU:T\252i\302\364I\207ig\215c\302M\271\034\264>o\214\266\342\221\306\025\003}QY\212)9~\257|\245\367Y\220c\r\326\032\033F\201wG}\243A\235\033[\327\373\0172=\303l]OZK\b\221;\245\221"
+	.string	"\207"
+	.string	"\225"
+	.ascii	"G^\335t\001!\255\364\002"
+	.string	"\n\250\300\034[\232hP\335t\r\r\261\322\016\212Z\205\200\026\330P\001\025$LLu\3637z\345J\241\363 \027\302{\361\347\265E\375\211/FDP\265V\0077\215\243\272\371\272\201\363f\371\002\347M\363l.?\022U\004F3\202Haj\255\260\305q\336\313\245<\237\022\235z/o|\371\2038\005\351td\370\342[\032X\301C\270\032\376\312\006PN\300\264\206@JS;\265VS\341\260\305m\3366\005\333>\366\312\bJp~\321M\203\350\241\027\336\364{\316\233_\005OE\037=c\032\025\025\265E\214\240\027\372\365\333\236iQ\232h\022F\025\323\245\322(\373\370\243{\303~Yw\3106\251kL\352\326\2237\r\353\305;eR\237&\265I\251\313\222z\227\232R\352\017@\340\204\314rdDc\235\216u\305\0312\225\311|\322\343\311\277xj\337\325C\307G\362\213\334\210W.\037I?:\220|"
+	.ascii	"\222\334q\206\246\272\351\"\352\370G\237\310\0034\233+cb\306"
+	.ascii	"\257\312\255\374T\210\305\316\233\347\002 \226k\356\203f|)\237"
+	.ascii	"b\001C\206\f\233\302\362D\264\361\"\224t\233\0305|F~\001\310"
+	.ascii	"\321M\243\320\215\017\220\004b\022\323%\345\035_\211\205\265"
+	.ascii	"/\376\345\243Q\336e-]\n\232!@\351\332\033d\364\302\335\027p{"
+	.ascii	"\366\237\034J\t\277\310\263Z\355\274I\367\300\023\361IMKM\225"
+	.ascii	"F\251\210*\213Z+\003\232\025\246\036-s\2421PM6\301\371=\200|"
+	.ascii	"\002\3221\266m_\322AU+0\202\237\344\001\020v7\033\217\354\314"
+	.ascii	"\211\260\273\331xd\247\204\235\207\0168\235,\345\t8\017r8@\310"
+	.ascii	"\231pcc\253\315|b6\233\356\006\300\265\233\034NF\"G\003Q\233"
+	.ascii	"\361\320`!p\263\036XM7\002v\263\3009\037\233\016\266\313\345"
+	.ascii	"t\260\325\321\367\262\356\220q\220\004\213P\007\177\221\021\217"
+	.ascii	" \223emjS\250\262\320`\362\355\3175\273t\343\037\224\343\312"
+	.ascii	"[[\263\033\244\345\246$To\245\363C~sQ\203\322\332#\377\243\307"
+	.ascii	"\234\324\360\245\266\265\253\002\311\304\227_\020\315>\371\327"
+	.ascii	"\271\346\006A\2501$\307\214r\006!4\"\"3\222&mp\002!\302\242\007"
+	.ascii	"\020p7%\205:\211\007\312\224L0\323\034\036\330\321ck\306R@\036"
+	.ascii	"\253\302\337\362\262\230\351\005Zt\266\363v5\340\177\351\321"
+	.ascii	"c\266y\215FD#_\020\222\021\312\206\251a\375\210\353pv\341\314"
+	.ascii	"\215\357&\024\b/\240r\254\241\257\r/\2416a\322:-%\024|i|\257"
+	.ascii	"\305\300^\356\321\202\240\327\271\236<\306\306\206([}i\346\325"
+	.ascii	"\003']\0303P;Q\224\2124\322m\016\025\371\365\007"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.60.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`Q\001-\017"
+	.string	"\266\035kG\340\262(\035\250R\241`\0164\265V"
+	.string	"\330\275\016\370\271d\003\004\260fy\202\246\032X\300\004\204\301\373\305\267\377\357\363\274\303*d\266\t\253\253\214qCsF\306\315\310$\032\357{L\324\372\253\304\353\243\177\220\275\245L)X"
+	.string	"R"
+	.string	"Y"
+	.string	"g\321\262+\302\f\006\002B\212\036\035r\206\346\314y\007N\352.\343\005t\227k\342\256\313\270\352\362C\300\327%\3511\216\300\370\271\215@Y,\335F\304\260\302\2003\335\250`\206F\f"
+	.string	"0\026I>\266\033\307]_\300\231*\310\311\234\323J\003?\334\335mO\260-\301\276-20\r}\334Cthvv\344\230\332\303\316\305tk\354o\030\206\241\267\204\375\233\277\223\352h\365F\265\256\372 )*j0\340k@s\326B\037\263G\362\240\260\237k\331#\233"
+	.string	"\216\007\252\307\375\246%\006\2302\233\314\316\234s\201ID\227\266\375\025\001/\273e\013\211NL\017s\316\021\013\"z^\372\3433x\206\200\342\013t\272%\234 \247\\G%\232S\346\300\177\361\034\025\337\346\322+\337\327]\352\032\b\272I\360\023\302\206\312\320\341Cb\267\306\335~O85d\312\303~\213\273h\361m\254\201\245\247]\372\254\356\362+\022\0246!aPR\241A\211\211i"
+	.string	"+\305\302\341$\2152}*\n\033\276\223\n\n\345\302\311\303\240BY\361P+\226gB\340/Cj\345\261|\337\312\033\345`\2171n\311\3456\263zWw\334\037\343B#\244\276\253\333}\261\275\353\023\330\306\342\234sJ\021\355\326F\245\364\264\270q\003\025"
+	.ascii	"8\317\007\253\036\027\002f\035\366\214\025\004\034\304U\263\216"
+	.ascii	"\022\013\007V\260\005\026\241B\303\340\362\210\225\231\370\263"
+	.ascii	".\263 \272 ,\225]\342\347\230\226{GmU\024"
+	.text
+	.section	.gnu.lto_blackboxDeviceFlushForce.part.0.80.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\003\001\035\f"
+	.string	"\246\326P>\020Q\225\016W-\221\302\342\004 \r_\341\347\300\205\004\224\274\207\\!@\371\016]\254\373\262A\267\034J'\036\212\2507\356N"
+	.string	"\236\001"
+	.string	"\266"
+	.string	"\305\350(NG\370r?\273?\177\023)S\n="
+	.string	"D"
+	.string	"="
+	.string	"\217W\341\212\305K\331v\305\"\362\350a\013u\026\016\016.f\273!\367\250%>\272\2466\362\363\244\"]\017^\301\007\373l\304T \236\223k"
+	.string	".\273\353H\210;\336\266\003\333\017\354s\002\351C\026\234\0200b\027\365\241cID\231\253\205g\320\345\353\260A\213\271b\254\230\255)l\020\376\0252\310@\330\372"
+	.string	"!\305K\346\360\005 \217\221\017\200\374\016\235\205U\266c\266\273\333}\320\2637\037\024\331[J\262\377\34202\370(|\341\223?=\372\037%`BD)?\034`\206\252\306f\016\230m\317\026\3317\"\255M\355.\203\307\203\227\310\360\240AJ\217T\226U\273\266\272\262\235V\2473\006\236@9`\r\245\333D\320\320e(h0\234\fWa\203\351p\032\317\207\243$pgA\202\207\303\320u\036n\273\266\272\362\301O2U\325\203mU_J\372\251\262lK\362jw\272\374)\025\201)\030"
+	.ascii	"F1\003V\275\237\305\b\270\241\221\017*\213\026u\016\341\325X"
+	.ascii	"#\370\002\006\344\201\021\256\030\027M\370\317\270yna\260)\020"
+	.ascii	"=\375x\353p\256\252\211\227:\355Kj\212\232\367_[\306"
+	.text
+	.section	.gnu.lto_blackboxDeviceClose.part.0.83.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\274\001\205\017"
+	.string	"\346\032cF\340\262(\035H\333B\327\0210:\223a6\235U\217\020)p\326<\006\344\350\274\271b?d\324bK\024\376X_C\360T1\310\264\225\372\007\3030{\303\f\234a\375P\247\035\020\203\324\241\246R%\177\221\275\245L)J"
+	.string	"O"
+	.string	"P"
+	.string	"\016=^\306\366\252\203Y\266\216\177\263}\214\033\027\027\267\335\355\036\265\304Y\207\232\221\345\237\366\020X\254u\230\260\330\207+\\\320r\023!\022{AQ\217\313\215\323\236\033b\256\314\221G"
+	.ascii	"&\273k\020\210\233\273m\006\266\033\3309\0220vL'L\0374\362\021"
+	.ascii	"@b\227\303\017\220\225\305\332\211\025+\253\230\2704\264@\033"
+	.ascii	"\233\235\231\333\276>\005\337kV\254R\340\233yp\220\242\246v\333"
+	.ascii	"\375\272G\177/\341\036A'\341\036o\337+\247\261\326\310\241bw"
+	.ascii	"C\367i+;\344\323X\016\2779E@\241\270\307\324\004:/\247\021\037"
+	.ascii	"\017\017?\205\223A`\346\203d&@^m\024/\017\363\201\227\266\354"
+	.ascii	"\2778\214\024\337\204/\250\362\260G_\245!/,\371c\221M&g\323\247"
+	.ascii	"\205\355\325\b4z,\t\201\202g\247\225ARc\254\361p5\226@2`\023"
+	.ascii	"\311CA\310\340\235L0\225(\234t\025P%\224\316\224Ru$\004\366,"
+	.ascii	"\234R\035\006\317Ku!\270\n\343\007?pX\324e\221\255GM&K\333\016"
+	.ascii	"\0348 \355\222\311\245-\213\330l\344\350\215\203\006\215L5\306"
+	.ascii	"\371\023\227\232b\241\363\312\036\3733\002* p\202\031\273\272"
+	.ascii	"\030\346\230\001\2577\370\2077\304\306\214\305\023\007\307\034"
+	.ascii	"a?\243{\361\036K!\3648\202\206\2201[\f\222\007\305\264\301\210"
+	.ascii	"\326\235\360\3206\334M?\276\257j\265Z\2578\276)\233\005=&\344"
+	.ascii	"\371\b\037c\351c\374Bd\335\022\314m\224\013\232.\333\013\004"
+	.ascii	"\345\315\334C\343q\357zc"
+	.text
+	.section	.gnu.lto_blackboxDeviceReserveBufferSpace.part.0.88.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\027\002u\022"
+	.string	"\246\342zH\300\324M:\224 t\261\245\366_\354`\216\220\332\326\225\206\322~B,2\246\260%\200\365\340\024\314\004\200\037_\365)\237\353X\235\247p\367\326\222}\022\004\221l\262\032\n\021V\376],!\262\321\314*\313\264F\366\226;\245f"
+	.string	"h"
+	.string	"a"
+	.string	"\323\276\213\233q2\334\201@\266\375\026W\2621\316\202\016\216\210\nIV<MU\273!\354\023\345\006\276O\371\002\337\247\2528\356Sj\374p~\354\001o>/\024=1\371\230\001\216\270\224\020BH\351\002\024I\241\303\005\346\242\n"
+	.ascii	"u$\312\356\276\367\350\003\346\304H\340\037\253ew\335\032\272"
+	.ascii	"Y\267\035\263\035cG\n\001\321\363\341/[\321\312\212\216_\364"
+	.ascii	"Y\222'eb\264\373sudML\034+b\334<#\227(\334\005\231\364\370\311"
+	.ascii	"\241T\265\271\260A\323a\320x\346$\334\005\001\030r\332Yr\330"
+	.ascii	"\272}\323\234\311\023\212\232X\354\256\353~\357f\273\374\236"
+	.ascii	"\215\355\362-\\\020\350\204\310\212\306\207\177Q#\007l\016\005"
+	.ascii	"\221\215\335u\360\351\224\326\003\252\372A\361$\321\307\335\275"
+	.ascii	"Q\325\331\236}QkL"
+	.string	"Ar\321\210m\331k\314Z\273+\301\217\002\241\301G\262}\237QK\226|\032\177\262\371H~\201\211\357\371\364a4\001\020\"\234x\345;Q%Mm\264\222a\373f\033{Hk\267@\273\313\340\363\275\177GE\202\307MD\022Ug\375.W\217\354\222\336\360R`\226\224\007*\031\"\250\260\274\020\330f25\261i\331\213\366\202\341\003-\006#s\341\020\203\305\274\270t\200\311j6\330k\201i\036f5\230\f\215V\203\271l\307\313\325#\037\330\341\031\311x\334\027\3657.\264\303\213\212?\356\233\352c{\252[p4\307:]BN\253'\374\037T<\375\nT\t!RuRU\343\024\323\216\030( p\002\231cu\016\304\214\207{\376\031\352\325S,\340\013\343\216\021\006\347#o'\341\313\301\t\212o\247p\242\301\r\004Ce,\377\240\265,\210w\234<\030\341\020#\035\212\262#D\377B\266\332\301\265\213"
+	.ascii	"\207{o{\025\343#{\203\311v\306y\221xv;\034X\177\2656\231\033"
+	.ascii	"x\002\306\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`X\003U\016"
+	.string	"\226\224O@"
+	.string	"O'\035\204w\267R7d\206\006\317\352\261\341&\177\314\314\337\217\373T&!'}q$\241\305\322\377\177qU\277\364\205LCz\375\365\327_\177\331\360\327\0376h\344\346\022w\246f[\271e\n;"
+	.string	"<"
+	.string	"@"
+	.string	"\265\215\237\203\036\315\337&\035\332\240ES$?0h\320\202\276\013\315\207f\372+*U\0243`\372\273\311\377\216\266\213\207\376\007\253(\222\036\376\376S\220\353\250\265VK\207\346\177\307\204}\024\255\376\tV?\267j\330V\262\376\024U\337\266\\\226e\231\352\026\212CO\3152\365\252\324*R\247\346\250Q\242\r\r\275\004\005]\367\351\023\005\317o\264\323\246\311\351\322\3344)\025\017\336\336N\f\274\013/\024\200,\243\200\b\230\301\336\336\267\003\261!\001\363\036\230,\031\013\234\301\334nm\343\2673p\226\320\027!\353\217\210\320'\021\353\233\200\320\017\361\240\217+a\355*_\375r\005\007\305]\030*f\370(\201\001\\A"
+	.ascii	"\007\340I\356\0222\200\036&\344\310\270\227\301\202\303,\023"
+	.ascii	"28jB^\336\324\340\330C\302\213\203D,\021\226\320\226u-,\314*"
+	.ascii	"\217\241\241\003\355\001\341\305=B\250\221\220\341\330L\222\202"
+	.ascii	"\202f;\260\002!+\333\021\220\214\244\2211\"\021\231\212\256\264"
+	.ascii	"\003o2J\360\351\207f]\323P\036O\003r\233\360\032\007\020\221"
+	.ascii	"\t|\027\363\tQO\223\3244YzUw@HD\374\356\353\357\307/F\357>\355"
+	.ascii	"'\264k\355\327\205\214\213\b\300f\304\330\201\263C*\207\377J"
+	.ascii	"\303m\325\244\223o\306\225~\037%\324\366+\230T\024\334\\-\034"
+	.ascii	"\t\013q]\264\\\007\335\263\202\223}(\370\032\365\210\272\n"
+	.text
+	.section	.gnu.lto_.refs.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375 \253\235\003"
+	.string	"2I\030\035\200EI\00730\00330\0033#`\030l\020\373\300\177\"\333h=\245%\204\220-S\177\324\333\255\260\033\307\357\036\261>\361\217:q\n6"
+	.string	"\377\261\270\203\360\f\362\033\3742\334\312\244\0335\302\027\345\327?\324\026\364KO\347\244\034)O\375\366Qm\353\001tx\315#\262\024\343\006~\341\333\037\020\005"
+	.ascii	"\026E\203[b\307\214\236\022X\203\262\004"
+	.text
+	.section	.gnu.lto_.decls.5b8afa7aa992accd,"e",@progbits
+	.string	"(\265/\375`\222.M\312"
+	.ascii	"\3727\225EV JQ9\351\355\037\270=8,\266\n\264\302P\345\364pV\313"
+	.ascii	"\377e\246n\260\371I\3677\307\321\370T}\\"
+	.string	"W\245\275/\320NB\261\352\232\321\203_\034\021\0178\336\367\255uL\321\024\206\363\372\216yM]\311\nah X\004\027\271\204\355\312\334h\265~o\271S\304\003-\004l\004\201xE`:\032\252\2073\2675T\347\bD\363j\366\305!\267\206e\253\357m\027~\255\302e\207\032[\245\322D\206\3057\206\027u\344\212\324V\025\272z\227c\204!\033=\255\266\306\370\232\262\350\325-Kv<\366j\027\035{}\365\317\216\306\006'\032\251\006VA\013\335\232Y\362\\21X\013k\024%\251\255}\017\311.\253\213\300\304\240\365\t\n\244&\315\223\235\326\013X\352\335\0222\037I\315l\245\266\321N\375\3245ZF\033uS\337h\246n6\215>\352\031\275T\243\215\324\371\275l\242\357@s6\3129\277V\371M\274\221\352\227\nh\22341\223\242\031|9C_\217\3745K#\325\274\272\005\005R3\033)\351\303"
+	.ascii	")n\207\027`\316"
+	.string	"P\021;\"D\334#.\254;\001\334w!\036\346\312ax\272\366+$<K\242\247\005zA\200Em\310\230*\006\232w\206H\354\254\344\254\340\267\034\306!,B8\250\206o\027\332\263/L\005\323\003/,\251\f\277\307pM\021\261+\205}\253\227\352w\243N\234\234%/Tu}\337\\\370}\205\337N\374\256\201\337H\030\303\030\374\327-Zd\266\206D\367\350tn\b\303\354~\374\341\n\260\340W9\374\352\004W+\265\256FCT\273W$u\3544F\320\\F\203\347\305\307Y\031~\r1\324\251!\206\257_\270\004]\3450\245\316\311\335#77\253\250)r\303:\261l&\345UNG\353\211\025\252\276\265\255F)|2\007\327\267\272\325\267\032\305\240\302\275B\251q\227!\202fhg\215A#\353\213\241r\030\366\r\374\212\301\320\026\026V\f\206\257J\370\035\300\207\326\b\206\325INX\025YX\337g"
+	.ascii	"\277FkZ\223\031\301\250 P&\257M\316\345&\347#9\347\t\354"
+	.string	"R\013\021\263\276\265\254\242\025\200\b\004f}\353\221zf\2313\234\371,gh\006\253$\366\247\326\267*\251f5JA]\362\rN\334.\243\320#9Cun\232\232\262\234}\217\002~a\245`X\311\016W\275\230\234\370\365\375\227\357\375\247\261\211\303zV\351{\303\363_\002\242|\342\032\360\033WP9\f\357\032\264r\030\342\032\301\020\313\003=z5\2571@U\302_\257\364\005\332\002\177S\300\346\267\t\370\253VK\240b\271\220\201^\361\235\337>\245Z\f\177\313\243\177[\203j\202\353\374\226\001\275\023\201\277r\240!\320\027\230\360\327\025\177e\300_\223\3745\332\017\370\253\004\332\001\177\213h\300\337%Jh1\002\210&\341\277\027\017~\373\201\277\372\350\021\376j\200\377KZ\204O\220\363[\236\337\337r\2405\244H\376\035B\203\360?p\252\017\360\013\364\007\347\360[\025\376\232\001\216\277Q\264\001\376J\200\356`"
+	.string	"\317\360\333\027\177\235\322'\376j\2459\370\353\206\016\030\034\303oI\374\225\257\013\360\327/\275\301k~\353\363\267\211\2773\370;"
+	.string	"\177\177\370;\202\277\361_\301\374\265\357\257z\177\325\362W\274\277\326\375U\310_\335\376\312\366W\265\277:\371+\332_\237\177]\362W%\177%\373\353\330_\305\376\032\365\327\260\277\026\371\253\327_\273\376\312\365\327!\177\005\362W\252\277J\375u\307_s\374\265\371\327\026\177e\372\037\367W\242\277\316\370k\207\277\002\375\017\363\177\356\257J\1775\372\253\210\277\026\3755"
+	.ascii	"\177"
+	.string	"\375\300\177\273\277z\340\177\213\377g\377Y\374\265\205\277V\340\257\024\370+\n\177\005\341\257#\376\252\301_'\370\253\004\177\365\360\327\017\177\335\371\257\342\377\224\377\032\n\013\013\013\177\231\255\0377\340\267\200\031\370\265\241\206\022\024\341\261O\266\306\255\215\337\332\2609\352\027\027T3\304oq\334\346\300\261a4\205I_{\243\242\341\024\n\026\226\301\335\033laT\372\236&\b\376\377:\314O2\320\274Vt3\374\353\253\314k\210\037\247\332zA\266\377E\364\344L\004\007\3667\224\233\312\361WA~\316Kg3\003\023Z6\325d\032M\345\250\314\262)'f\331\324\262\231sDN\315<\265\304\331\351\204\231D9\2279\263\223\rt*g\350\324\022C\211\232\231\t\235rf`\032M9UfYnf\243\334\324\300\314\331)\227M\365Uf\236j2\313\234N\031\262\021\034S\022\026\222\247j\305\307\204\355\007\323(3\201"
+	.string	"3r6\351\230Pg]\313yy\206\224\233S9\367pZ\260f$d\271VD\3074\003e\004]V\0354\212\236N\032hQ\246c\022q\002!\345\234%\323\340`Y\2272r\321\262\346\214\004m\346\\\344\324"
+	.string	"\224\263\336\311hf\234lD4\243\350\351\274A*r\312\310D~T'f\331\323i\202\315\254l+\027A\227u+g\231j\342\262%43\275\340\204yr\005\3206o\350\234J\321Al\231\300t8\335i\341ag\f\357\256\330\264\314-Y\2450\033@\\\240a\033\364\272\321\327\312\260\314\333$\213\224m\022\007\316\234\211l\222\216\230\234\211tj\265\240V\013\256\221\347\020&\303{\034\207\177{T\005\355\250\314(\352\313\301\217\347v\371\032\265K[D\0024/m\366\254<\243"
+	.string	"\346&T\006V\217\3063H_K\304\304\313\023\260\357q\024>V\352B0K_\342\276`B1\365*ny\325\3673{\203\202F>\\\320\353\373\245\375:L\3775\230\016l\300\366R\243-\330]\336|\335\247W\357rhr\236\"\334\332\253ww\310\032\341\033\230`\323\365\335\004E\314L\364\003\005Ws\313\020>\3027\300*-\330r=g\2234U\330-]\3013\221\t\337\300\004\233K\347\r\207@\t\337"
+	.string	"\005\233J\277P\351\3162\321\223"
+	.ascii	"\270\234\204o\2002\201b[\2504\334\0161\323\004\177f\f\177f\013"
+	.ascii	"\177\346\007\376\214\023\356\274\356,\255\345\235\327Xn\214r"
+	.ascii	"\347\335\234\211j\265 \247V\013d\340\264\210\310\206\3673K\370"
+	.ascii	"C@\374,V\272\256F?\245\355\236\223\247\204KW\027\374\017\324"
+	.ascii	"O\031~X\345p]E'\356\213\324Z\033\376\020\212\337sWkg\277\320"
+	.ascii	"\027\005\330\267B1\361\236b\327\240 \211\371\222\3626\203s\332"
+	.ascii	"\353\213\362\216\353'E\300\342~\327\316\346\360\312\232\021\225"
+	.ascii	"\206\322pc\374\276 \365}c\362\230\361\324\367C*\274\326m\375"
+	.ascii	"\244\2354[\253\325h\2735\223w\223Z\345w\f\nX\003\373L\255h\217"
+	.ascii	"\017IZ \237[\243\351\361u\222(\206\\d\327\305\255\311\362\262"
+	.ascii	"\217\0031:?\260\035\021\"\352\334\237\031[\316\275\314\037\276"
+	.ascii	"\221\261\202/\363\326Kj\331\222\253\301\276\227\021\303]\326"
+	.ascii	"Jj\264\3152\216M\325\332\031Q\337\0303\207\033^&\013_F\007\376"
+	.ascii	"\231L\306_\213\"\026v#\205'F\025G\304\310W\033i\260>\322Ej\264"
+	.ascii	"\303:\004oh\316g\315\005\202*X\351\240@0r$\254\275j\224Jg\245"
+	.ascii	"\200#E\272\252`\216\3159*l+\254\267\252`\323L\2205,\315\235\241"
+	.ascii	"\216\032J\2267\367W\r\377\232\341\3370\374K\004\377F\341\020"
+	.ascii	"\367i\b\005:P\0344\250\2044"
+	.string	"\226\22530$c\215\325U5J\016\021\206lT\224\264\205\325@\230\035\365\233h\254\376\321T9Kh^\316<\225\244\220"
+	.string	"\346\234\263Z\253]\250\321\306\352 o\253\276\372\205\016s\244=\313\360\305"
+	.ascii	"eJ\301\267i\370V\t~S\375-\325\316*\250\001\017w\317KHR\337\236"
+	.ascii	"2\361~F0lBA\263\316\215\222\022\327_\337Zh\241\030C\3165\202"
+	.ascii	"a\211\267\017\f\260\221[\223#=x\220\311\031!j\036\267D8\250\250"
+	.ascii	"\355\b\201\023\315D\202=\246\023\fE\270\303\331\345qy\334g\234"
+	.ascii	"\323\017\f\002L5\346\356\324\357\363j\331p2\322\367\376\3503"
+	.ascii	"\2356\246W\337\353\264\271H\332[a\337+U\251\360\b+\374\353{\243"
+	.ascii	"\276\207\023\025\2632\330\367\372\250wHlk7\372\336\036\025\020"
+	.ascii	"\001yM0\365\317&\254N0\313\037\356`uo\334\033W\307\006\266>B"
+	.ascii	"\277\032\273'\277\272\013\365\253\003\016I\357\257\256\357\315"
+	.ascii	"q\270A\264\261\273\276\027\307\341f\246TyJ\351\250a\017Nx\224"
+	.ascii	"~\231\256\322\255a\3750\224s\331\307\003\027\210\343dG\021g\323"
+	.ascii	"o\215\337\247\rNXB&\270)0}\257S\016\024\225"
+	.string	"6\276\346=\352\252*\323 \212\303\311\351\322\270\035D\002\207d\327\367\316\270\r\004\302DW\267\324\347\002\016,&\370:d\330\303\035\340\255\030\300\313\264v7y\031\315M3M\212\f\202\001f&T\210\234\245.SUw\371\313\374\225\261\301\211\357\031\201\230\231\365\275H\277GW^\314\230F\367\210K/\215\220\n\337\"\r|\b\376\020\323\367\227\310\252N\313\253o\327\303\ro\376^\323h\363*|\227\264$V=\bm\225\247]Q_;\246M\006\332\024\037\330\n\336\016\266EUM\335\b\374if\230\340\361\320i\342\353$\341\0353/^,\230\035\347\262\017\204\260\265\373\234\021\344\351\313-\030+g\243\224e\005\325\327\376\325;\274\026}!);\261b\346\344\017\357xq\341b\373*\006h\221]\225\255\234\245\336\022\025\337m\337\315;J\252\321\005O\313 \235\355b\243\034\t\312\225\275\341\016Mzz\366y"
+	.string	"6/U\300\306\006\355\242\234\270C\216,Y\254\226\035)[~`\226\r\253P0\357V\013\227\032 <\226Gh\350\300\2009\353\373\234&\366\360uwg\361\252\222v\314\001\332dy\242\304\352\312-\036\316\032\016\254'\177xG\252J\025[W\242f\031fd\202|C*\317\244&Vn\353\352\335M\225\235\013O\272\033\3502s\241{\201\306Oo\213QN\021\217\255 ux\307\210\007\356pv\256FsS%\033\3341\027\002\277\031\035\tb\247\334\316\341"
+	.string	"\tl\363\321\327\306Y\271\232\246/x]rVJ\024\246)Y8\362\216&oRl\224\3167QU;\260\364\265Pp\3340\207-<\267nn=f\250\225\344&\313\223\260\n\t\336!dc\263O0\303\032V\322\226h\371s\342\017hjju\f\3333\n\030\216\036\024&8K\370\303[\223&\326I\r\243\243e\245\316\213M\273u\322inR_\235w\243\364\344\026\005\006\177\350CC\343\320\307\326#\004N\343\332z{\001s\240\343\271]R\243vI\025\254\320\334TC\303\351\346\b\346\360\306s\253\3445j\225X'\313tf'\020\270\350\b\3372@\212\222\362\2055\340\361\334&Ib\311Hp\346'\020\272\370\374\300"
+	.string	"s\356\221\001\006r\224'f\243\325\fJ\366\326\027Z\266\001\352\213I\013\2038\032\033\263Q\033\302,\033\311\355\214\310\016l\245xn\305\304lSG\363S\316U\206\312\340\346\211\341\200\353\373\033#\f\202,,\314>\225\234\361] W\344\342\3700\b\264\257/[\204\247\n\213\317\006)K\f\027\260\333\"\207\253a\210\374a\331%\235\257\301%\274:\fb\317\353^6\007\3169_Q\332\302\321\203\372B\304\206%\350\352\352J\200\3233\n\230U\223r\372"
+	.ascii	"\303\022\374q\235\313>q\336\361\372a\023gD\006%\313\312\016\261"
+	.ascii	"\262B\006\260c\205\347\312\016\271\262B^\233D9\027\345\03456"
+	.ascii	"\224\342\302Jo\201c\026\353V\210\325\272WG@\246\364\265.\314"
+	.ascii	"\314\020\202\226\373\336\206\206\315\3521\303<\""
+	.string	"?d\350\341\327\224\341\016F<\267@j\324\002\2614.4;\331\250\375\250\331\372a\251~\330\347\0071S\226j\312>?\350\2602\303$\226\224\345)SGD\b\223\276\257\351\201_\263\304\357\321\303F\rs\256PgS\023\304\227\017+\345\303F\341e\316\033^p\202\nq\353\270\340\270\362\3456\252\363h\270\272\2363\262\340\323\234a\016\201<\026\252\332\035Q\273\243\241v\240\371\311Fm\t\315\3404a\001/\212.\214\307\0249iO\215\322X\264\251\261(\204L\225\351\317\006c:t\3149\320\210$\220\222(D\302x\024\022:\372\030\213D\2442i<\372\320\244H\030C\327\230\006!\225\311\341\201F(\223$\322\037\030A>\306\"\td\022\006\211\016AA0\214\306\243qF\331\223\266PL\0169pD\002)\217\306\031\027\3044\350\2620\344#\224\n\r\177\322\037c\321\305\206\037\027%$\211iPz\002"
+	.string	"z\206\222B\311TI\3649\006\005-`()\324\201\205\217\016\013\312!\241\021\224E\241\244\221\210l\301\"Y\224 M\221*b\264\310\220\243L_\374\300"
+	.string	"J\026\215i\320PzBP\020\f\025!$\213?\306\0216\2748>\300X|\221\206\320\201\210L\225% \323\025\3104\006\321\204\013n\222F\203P\252L\262\300Bi,\"W\340\354\030\323\241\b\364$a(\211J\026\024T@\034b\261\0022M\246'`\260\"\202\3441(\005\210\235\022#\224H\342\320\210\324\007yT\241\002"
+	.string	"7\"\334\247\210L\215\351\013|\016:\320\240\003\0241f\216\342\203\022\037\224\030\036\305\007&L|\320\201\t\374\016LX\2452\355ya,\"\211@,\220D \237{\037e\004i\217\212\r3\007\032A\"\211<&\215i\022D\262g\370\223\266P\f\"\026\225Ec\321F\231\276@\022\2259\251\320\361\0019\"$\223\251\317\021\271\342\2478\244\023t<\206\320#\223\256PT\372,@\203\262'\211\002f\241L\022\2030({\204\212J\233$\n\251P\261\005Q\031\224\212\220\006\r\t\021\223\031\\\244\020a\001G$\013/\260R\303\261\350\201\005\2442\025J\203R\245\007\r*$\211&\030a\270\270I{J\3500\224\024J\016\275\310\020#\3751\226\320\023DD\246@CEd:\264s\240\021"
+	.ascii	"H\366\274(\2720\036S`\020\202a\304BGc\372\323\223*\211\310\232"
+	.ascii	"\324\247\270B\3723\364I\225\251\b?Hb\212\237T\211LW0\0269\030"
+	.ascii	"\217\305d2E\016\t\035}l\016tA\262'U\026\221\024\340\220L\225"
+	.ascii	",\204\360\223\002%a\004\271\270\001R\2760\246AC\242\222\370s"
+	.ascii	"\225\007\032A\"\211LW(\"\177&\370q(E\222P\036\217H\0226J#\214"
+	.ascii	"c\212\r K\210\201\254I\366\334L@\211<\256\300\220\006\245@l\261"
+	.ascii	"\302\020\231\026]\024\225\306\364\247X\243\354I\177\216&\324"
+	.ascii	"\244?G\241\253\354\211\200\022y\034\302I\032\217E\345\320q&U"
+	.ascii	"\022O\370\201AL\001\247-\024Y`%F\336\374\020S\022\224=\033\024"
+	.ascii	" \250Hl\201L]\270\200\021B\f\345\rR\271bG\331\323\201\t\\CT"
+	.string	"\022E\210\201\314A*W\244+\024S\237\364\204 b\021\231&)P\366\240P\032\2130f\356\201\211\022'~88\341\301\b\017\367\300\203\024\025\240"
+	.ascii	"\001\006`\237\021\307bO\214c\n*\370\020\203R a,\022\205H\370"
+	.ascii	" \223$FX\240\202\0171\205\240 b\212T\210\210T\021\003\2513\247"
+	.ascii	"\245\246\212\313\334\326\024\274@8\033\201rR^@\355\360\372B\317"
+	.ascii	"\b\263\b\221\372N\240t\335n\224\353v\343j\263\351wA\036\224\215"
+	.ascii	"\0207\356Bi\363\221\205@\271p+\260\034\001Z\246\232\243\302\301"
+	.ascii	"\036\367\255C\360\024\246Wu\244\315\n\tt\022d\3531=\204i\310"
+	.ascii	"\2275\035\366\252\360\315\213\232S\216\227\0204E\237\334gmv\361"
+	.ascii	"\3159\261d7QWGxi\226\006\006{k\2665\271Y\370\212\314H\031\223"
+	.ascii	"_\256%\200c:\372\3363\233\275,\266*"
+	.string	"\256\273\304\314F\205\3407\243JISk\351p\301H\331\255\261\3264f\026\375%\363\303\361\203G\337\013\275I\276\266\230\344}\217K\227^\033\222\276\027\311\035\263\332Bs\353r\276& \021@-b\2279\303\0246\b\344\210}\242\351\260z^#9U\260\340e\321\302\377-\322T\367\213.\315\f,G\315\226\244\266\267\373e\213\246T]\331\021\002;w\226v#\214W]\r\324\030!T\372\022\3513!j\315\313\355\002#gU\266\245\257\207\036W\353j]\256&UR|8X7\204\310\020\362\313u\267\302,\261\341m\r\271siKW\252\b\245t\201\302\035\304\334\252[u\263Pp\372\201\201%\340\353N\t\326o\026\r\274\304\252\b\226\276\027\310\275\222\351\342\253R\273W\327\212N\016\307\324\333\20739\247\033$\203\360\250B\301@\212\003\031B\206FFD\222&\205\016\202\n\020\006\203Y\034\b\252\035\022"
+	.ascii	"4A\316\202\320\221\231\021\021IAR\222\322\306\001\201\371\016"
+	.ascii	",v\320\316\251\354\324\204\327\206W\275\261\253\024@\216\331"
+	.ascii	"\352z6\344\306\257!$\261<\273P\314P\t/_Ic\211\377\250\342\316"
+	.ascii	"\310\260\020@\263\234\213\253G\005\375J\354\031x\r\247P\300\207"
+	.ascii	"\227\356\331\002g\3216Q?0v\232R\217D4cq\001\326>R\335J\314%\260"
+	.ascii	"\212\324\0205\341-4\3641\377\207\313\"\375\316\212\335C\274#"
+	.string	"gq\330j\271\361\004\304\372\251\331\371\276\f\r\"\230Vj\301!\315\303|\274+\376u\276\030|{\366b;\252\325\273C\021S\237\032\371\206\312I-\203\361+\250\336+\223\332\017\276\316 \b\263&~\017\260\347\322l:\004\211\3524\362\341{\357b\371E\231+1\271O\225\324\316\345\227-\316\203\240\261]\342\225\273\251\337>\264\004]UD8\214\016\r\270\303\351\336\372\212e\223\321\\\340s\016c\001\264\247\273\241\206C\337\2261C\336\334\322\345h\217=\341d=\2048\340M\360e\004B\270V\325\f\370\317?\226\260\204\005\247\364\260]\202\351@2\312\234]\306\375\032\340\025un\213\331\314\336D\003\256ixq\272;\311z\201\241D\277\001t\305\3727)s\244\347\242\251w\034rG\016\351\363\240q\312b\353\315\362\207\3213\005\225\246\002\340\251h0\023\231h\210\356\320}\220\235\\\312\326\215/\214\274\274#"
+	.string	"\330]\346IR\254k\241\2414\3574\3432\355GY4D\254\004\301\016\004\212\332\235<\300\354\2026\021\026j\353a\307\245S\213\256\337\003\255\006D_W\026\001\341Q\254|\301}q\232\005\254:\366\264|\252\343\375\223\220\262\352;_\331\237\357\211\312\233\017\036cg\235!yW\006\356\310 \021}^\315\254KJ\020&\302\035\216\2558A\227\177p\256\217\021\352\f"
+	.ascii	"N5X\244\351K\374*\017\234\030\0355s\006\024\322SR/Aq\037{\204"
+	.ascii	"\267\275U/V\267\264\344\333\037\331O\235\310\316g\265\240\223"
+	.ascii	"2\322Wq\347\\\3546\216\307\245\016\021yG\006fy\314\217Zm\361"
+	.ascii	"\007\352\250\214\"\273\333\tK:F\367\221\234^\030nr9H\211\261"
+	.ascii	"B^M@("
+	.string	"\035\363\252\200\257[k\001\277Y\314}M6\031\r\324\3140\354\305Y\236\b\217\031\314\241HV\266$HtM\207\273\325\303[\234\271\307\263\0354\231\353\231\236\322\265\253\257\361\013\366\241H\222\363\242x\224\320,\267\355:\b,\220\200x\253\245B\004+!\313\226\250BxoD\006\250\353b\200\016\373\202\307F'U\031\346\r\021\343\354\326\246\334eYh\222\316\374\r\331iH!;I \311`\247\341\034\323\355\244H\254\345T\201\210j?\237\001\037\020\371\034\020\231K\317$\340\230\026\272\276\301\0316%\337^p\311\273\236\354\211F.\353\334{\361r2\362\031\272_\336^PGjOP\264\362_\332\034\021*\331\004&\230\307\313\371q2\370\242\027\244\003*K3\226\321\371\232\304*o\b\302\246\270X\006\271\315\t\245\2518\230\023\026\315\244qK\200p{@CuH\207\265B\273\327T\244K\336I\026\206lw"
+	.string	"\234\351$O,\234\264\374\253W\370k *fp\207\376T\201|\260\320\227\266Z\306:\323\225\372\332\007Of^8K\001\221\"\356\216\253\\I+|\304K;BQz&P\235\023\032\254\013a\210\362+\366"
+	.string	"\t\216\016\tw\271\363\305\204\302M\224\254\244D\364\t\250\354\234\204o\227\33586g\020\317\204\337\271\376\234frM\377\212\363Z\236H\356\314\352^\255)\347\036x\301&\235\324\310?\254\356^@\252c\377\356\3745L\024d\004\276-p\r\275\257\t\320\333\037\334F\353e\f]kt^<%O'\324\003\n\375{o\221\032"
+	.string	"G>\b\347\220G\313\005\226\254\310@\323\\\341_\032h\b\032\035+\202W$H\216\242p\006\232x\350;\214\305\016\210\206CS\236\331t\233\375\302\377dF\343\036L"
+	.string	"(M\266;\033t\206[\211)\311S\315l\030\r\254\nA9Z@DWp\202\371\334q\237\367\356:\232@(\007fJ\2157\0373\326\261\244\004\305@\301\360$\202\330\006\026\035\b\2138P\366\255\311\324)\245U\233&\201\367\245\255\273ax\177\267`\225\2426\314\327\270d\330\240\311D\031\351\211\0358\t]\350\f\370\237\300\330h\025l\373\234>\023`F\342\240Y&l\367}\004\330\027Upv\361NO\256g\326\255\037\335`\202\255\232\252\201(\324\370\364\255\350\327\242\013=;\257e\275\362\364\336"
+	.string	"\3057uJ\320/t\340\t\273\370\374\r3\266\265sJ2\023*\221,\225\035\351a\201F\025\334\261\n\237\232\354\004A:\322?\201b\316\265E\367\037]\202\375\316\"\267\"B\035\267;\207"
+	.ascii	"6\356\252\321Z\003?l:\242\210\337\301\333\0202&\037\243#\260"
+	.ascii	"\314\322\340C\225t\357\321\365h\226F\317eVW\177\242:\365\270"
+	.ascii	"\205W\211.E\247\374\003\373*Z\241\027\344\344\344\252A>\207>"
+	.ascii	"\240\210M!a\223\027\355\022J\\\024\371u\304\035\230\266@E\265"
+	.ascii	"z`\252\305\2140\210\310\223YLW\236\002n\337}&s\240\255E3\265"
+	.ascii	"\032\036\253k\205\360I;\307@!\017\036\225\253i\264y\253\200\225"
+	.ascii	"\030\320\322fQZ\263\242\037\037`\371&\335i\240%\237\210\257\304"
+	.ascii	"\304\\\371\363'\255}\247\307\236\215@`?\"\375\223+\222E\331\004"
+	.ascii	"uCI0\323H\252\346os\007\274M\373\334H\257[a\377\366\252\217G"
+	.ascii	"p\326f\001Z\355\203&r\247"
+	.string	"\362\272u"
+	.string	"\364\332)\334\017g`\324\274(\344T>CN\237\327\260D3\325\004\311p\272^'_\354\017N\037\326\270\377\325\244X0\003\340\230-\237\246\331\024\340y\320\340\t\324\256\367\033\233N\347\330\253\001p\205\">\220\211D\313\336\310\031ab\335\256\203,\255\203s|\321H\230\234\020\370X\335\202\240A\002\356\341)\032\366%\322\0177h"
+	.ascii	".\223c\334\036\232m\020\360vE\262$\037\f\231\033\210\306>\006"
+	.ascii	"=$]\211h:K\344\260\232\326\236\350}\262*\351\2673\340\02379\200"
+	.ascii	"\215\374\226(\254\353\037\345\202\230\357\332\033\022vX\016\312"
+	.ascii	"F\202v\t\224\356q\211`\036J&M\301-N]Y:\364\324\204\307\036,\361"
+	.ascii	"\305q\034\320!J\307\342I\214\370\302\207>\304\357\351(\326\274"
+	.ascii	"L7n/K\337\376\273\314A\371\004\221\247\250\371\326\246\370\246"
+	.ascii	"\211\271f\353p\342#\264\230\210rw\273\243\323\034\303\333\020"
+	.ascii	"\240\341L\221\245\235=\036\003\274[\307\303O\005\270[}\324\316"
+	.ascii	"\370\274\r\254\300\235\226\256.\324\257q\335\365\002~\200\317"
+	.ascii	"\216\235\275\225\353i\t\203\274?\2777\207\231\001g\366\370L\001"
+	.ascii	"#\313\025\275\213>\007\177u\366%\273c\f\017=/sr\203a\027}\337"
+	.ascii	"1\336\333d;R\275\354}\315\264\253\312\036\3016n\364\003\256\260"
+	.ascii	"Z\350'\242\347\314\034\312=\300\332\345{\301h\016\361\365BfF"
+	.ascii	"\226yN>\344\337@\236\020\266\261\261\307\272/\345?\r\243NS\007"
+	.ascii	"\256\341\255\377\256{3\302\bPg^\371l\037\320\350\352j\226\033"
+	.ascii	"\206\227\333\037J\345t\335\243\375m\344\234\350\320\356\261\026"
+	.ascii	"G\356\232\203\354\321t*\347\205\335\031\303\030\314\231\270\r"
+	.ascii	"m\244\226\237\037Z\362\233\3039o?zX\036\236C\177\001+\264\002"
+	.text
+	.section	.gnu.lto_.symtab.5b8afa7aa992accd,"e",@progbits
+	.string	"blackboxOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"blackboxWriteBufferFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"blackboxWriteBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\001"
+	.string	""
+	.string	"blackboxWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"blackboxPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"blackboxDeviceFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"blackboxDeviceFlushForce"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"blackboxDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"blackboxDeviceClose"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"blackboxDeviceBeginLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"blackboxDeviceEndLog"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"isBlackboxDeviceFull"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"blackboxReplenishHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"blackboxHeaderBudget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"blackboxDeviceReserveBufferSpace"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"blackboxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"closeSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5b8afa7aa992accd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
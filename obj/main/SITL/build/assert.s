@@ -0,0 +1,5315 @@
+	.file	"assert.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	assert.c.579b02d5
+	.weak	assert.c.579b02d5
+assert.c.579b02d5:
+	.long	0x5e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF923
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF915
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF916
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF917
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF918
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF919
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF920
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF921
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF922
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/build/assert.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4
+	.file 5 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 7 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 8 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x8
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 11 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 21 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.file 22 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 23 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x17
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 25 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x19
+	.byte	0x4
+	.file 26 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xa
+	.long	.LASF1
+	.long	.LASF924
+	.long	.LASF925
+	.long	.LASF926
+	.long	.LASF927
+	.long	.LASF928
+	.long	.LASF929
+	.long	.LASF930
+	.long	.LASF931
+	.long	.LASF932
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF933
+	.byte	0x1
+	.long	.LASF934
+	.byte	0x8
+	.long	.LASF935
+	.byte	0x9
+	.long	.LASF936
+	.byte	0x9
+	.long	.LASF936
+	.byte	0x8
+	.long	.LASF937
+	.byte	0x5
+	.long	.LASF938
+	.byte	0x8
+	.long	.LASF939
+	.byte	0x8
+	.long	.LASF940
+	.byte	0x5
+	.long	.LASF941
+	.byte	0x5
+	.long	.LASF942
+	.byte	0x7
+	.long	.LASF943
+	.byte	0x5
+	.long	.LASF944
+	.byte	0x6
+	.long	.LASF945
+	.byte	0x6
+	.long	.LASF946
+	.byte	0x5
+	.long	.LASF947
+	.byte	0x5
+	.long	.LASF948
+	.byte	0x5
+	.long	.LASF949
+	.byte	0x5
+	.long	.LASF950
+	.byte	0x5
+	.long	.LASF951
+	.byte	0x5
+	.long	.LASF952
+	.byte	0x4
+	.long	.LASF953
+	.byte	0x3
+	.long	.LASF954
+	.byte	0x2
+	.long	.LASF955
+	.byte	0x9
+	.long	.LASF956
+	.byte	0x3
+	.long	.LASF957
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF711:
+	.string	"USE_GPS "
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF886:
+	.string	"USE_VCP"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF358:
+	.string	"__k8 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF513:
+	.string	"__always_inline"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF923:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF804:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF919:
+	.string	"signed char"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF915:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF908:
+	.string	"NOINLINE "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF841:
+	.string	"NULL"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF758:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF822:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF759:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF917:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF921:
+	.string	"long int"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF713:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF851:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF922:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF853:
+	.string	"USE_UART1 "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF916:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF918:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF821:
+	.string	"__size_t "
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF843:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF820:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF885:
+	.string	"USE_ADC"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF920:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF852:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF757:
+	.string	"USE_LOG "
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF943:
+	.string	"long-double.h"
+.LASF945:
+	.string	"stubs-64.h"
+.LASF931:
+	.string	"/usr/include"
+.LASF950:
+	.string	"stdint-intn.h"
+.LASF937:
+	.string	"libc-header-start.h"
+.LASF926:
+	.string	"src/main/target"
+.LASF952:
+	.string	"platform.h"
+.LASF941:
+	.string	"timesize.h"
+.LASF944:
+	.string	"stubs.h"
+.LASF951:
+	.string	"stdint-uintn.h"
+.LASF930:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF949:
+	.string	"wchar.h"
+.LASF925:
+	.string	"src/main/target/SITL"
+.LASF938:
+	.string	"features.h"
+.LASF948:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF953:
+	.string	"common.h"
+.LASF956:
+	.string	"sanity_check.h"
+.LASF928:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF933:
+	.string	"assert.c"
+.LASF947:
+	.string	"typesizes.h"
+.LASF955:
+	.string	"stddef.h"
+.LASF929:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF939:
+	.string	"features-time64.h"
+.LASF957:
+	.string	"common_post.h"
+.LASF954:
+	.string	"target.h"
+.LASF942:
+	.string	"cdefs.h"
+.LASF936:
+	.string	"stdint.h"
+.LASF924:
+	.string	"src/main/build"
+.LASF927:
+	.string	"src/main"
+.LASF935:
+	.string	"stdbool.h"
+.LASF940:
+	.string	"wordsize.h"
+.LASF0:
+	.string	"./src/main/build/assert.c"
+.LASF934:
+	.string	"stdc-predef.h"
+.LASF932:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF946:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.7009e60e53bd9582,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7009e60e53bd9582,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.7009e60e53bd9582,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.7009e60e53bd9582,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,2554 @@
+	.file	"version.c"
+	.file 1 "./src/main/build/version.h"
+	.file 2 "./src/main/build/version.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	version.c.82cb4ed5
+	.weak	version.c.82cb4ed5
+version.c.82cb4ed5:
+	.long	0x86
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x4
+	.long	.LASF409
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.long	.LASF404
+	.byte	0x1d
+	.long	0x32
+	.uleb128 0x5
+	.byte	0x8
+	.long	0x3e
+	.uleb128 0x3
+	.long	0x2c
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF410
+	.uleb128 0x3
+	.long	0x37
+	.uleb128 0x1
+	.long	.LASF405
+	.byte	0x1e
+	.long	0x32
+	.uleb128 0x1
+	.long	.LASF406
+	.byte	0x21
+	.long	0x32
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0x24
+	.long	0x32
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0x27
+	.long	0x32
+	.uleb128 0x2
+	.long	0x43
+	.byte	0x14
+	.uleb128 0x2
+	.long	0x22
+	.byte	0x15
+	.uleb128 0x2
+	.long	0x4d
+	.byte	0x16
+	.uleb128 0x2
+	.long	0x57
+	.byte	0x17
+	.uleb128 0x2
+	.long	0x61
+	.byte	0x18
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 26
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 3 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF403
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x3
+	.long	.LASF1
+	.long	.LASF411
+	.long	.LASF412
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4
+	.long	.LASF0
+	.byte	0
+	.long	.LASF413
+	.byte	0x1
+	.long	.LASF414
+	.byte	0x1
+	.long	.LASF415
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF402:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF408:
+	.string	"buildTime"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF383:
+	.string	"SITL 1"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF407:
+	.string	"buildDate"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF399:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF397:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF376:
+	.string	"unix 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF398:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF409:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF410:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF23:
+	.string	"_LP64 1"
+.LASF400:
+	.string	"MW_VERSION 231"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF406:
+	.string	"shortGitRevision"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF393:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF395:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF403:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF374:
+	.string	"__unix 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF404:
+	.string	"compilerVersion"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF358:
+	.string	"__k8 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF405:
+	.string	"targetName"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF401:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF396:
+	.string	"STR_HELPER(x) #x"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF394:
+	.string	"FC_VERSION_MINOR 6"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF411:
+	.string	"src/main/build"
+.LASF415:
+	.string	"stdc-predef.h"
+.LASF413:
+	.string	"version.h"
+.LASF0:
+	.string	"./src/main/build/version.c"
+.LASF414:
+	.string	"version.c"
+.LASF412:
+	.string	"/usr/include"
+	.text
+	.section	.gnu.lto_.profile.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 ,M\001"
+	.string	"$\002 "
+	.string	"\005"
+	.string	"\327\325\242\350\003\001\205\307\277\326\t\002\342\222\377\346\013\003\312\234\327\344\r\004\353\221\235\221\r"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.e1596d21a066f292,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_compilerVersion.1.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 S\231\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\232\334\350\342\t}\273\001"
+	.string	""
+	.string	"\00712.2.0"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_shortGitRevision.2.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 T\241\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\233\336\360\362\t}\273\001"
+	.string	""
+	.string	"\b80b64cf"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildDate.3.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 X\301\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"6"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\237\366\370\202\t}\273\001"
+	.string	""
+	.string	"\fOct 18 2026"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_buildTime.4.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\206\b\177\212\001\206\200\200\374\234\360\300\203\t}\273\001"
+	.string	""
+	.string	"\t05:03:51"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/build/version.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 35\001"
+	.string	"\320/"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	"\301\204\001\003\001\002\002\001\003"
+	.string	"\004\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	" c\2201HL\253x\001"
+	.text
+	.section	.gnu.lto_.refs.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e1596d21a066f292,"e",@progbits
+	.string	"(\265/\375`\237\003\255\027"
+	.string	"\346)\231I\240\222Rc\bt,)dU\270\217\312\346\031\213\2406Kw\274\371\037\222\220\0160\243\326\323-\204\357\225\242\230\372i\311F\363\352xm\236\237\302\021h\370\300!\214\347\241#\253P\026>$\315\206'\366\021_\373[\031eJ\001q"
+	.string	"\210"
+	.string	"\210"
+	.ascii	"MPF\335\355\353\207\211\243j\277u\025\376\361F\243\2508\244G"
+	.ascii	"\305\305\272\367\376\230\302t\257\317\217: \367\372\350\376\222"
+	.ascii	"\277\304\242\b1\245<\255[\320\334\211\257\345\235\215\253\342"
+	.ascii	"\034j\343y'\372\335\351\212\332V\263\235\243\203\355\246m4\""
+	.ascii	"\333L\333eG\266\227\325\276\222m1\333\\\266\225\266\223\266\221"
+	.ascii	"\266\307l\333\326\326\326\326l\313\330\206\262C~\002\377\372"
+	.ascii	"Q\346\336\f\367\336\001\271.2\026M\325&8\357\264}w\276\313\347"
+	.ascii	"\277\330\235CI\306\233\264\305\036\036\250\252\265\337\235:\\"
+	.ascii	"\\Q\"M\367\212\250\326\027B-(\225R\326\352\350\345\243Z_@1$\223"
+	.ascii	"G\236\344\336\342\024\211\221\242\261\214\252Z\353\240\3779\271"
+	.ascii	"\325"
+	.string	"\177\225\342WG\372\356-B\215\364\210!\253|\334\241\245\202S\231\366\344c\304%\005\271\320\252\326>\013\373X\317\372\212\220 !\246\233\274\327H\242\2732\n\366\317\216&\262DU\254q\336\2313\363\3716lJc\037\236\252\305\3715\230\022\210J4\253\365\231\311\221 Q\034\230\325\236\206\317/3\340\"\306\027\331\322\362@#+\252\326_\332\247\361\261f\327\216\021\325\256\234w\002\220\341\363g\324\254\246 \247j\317\357N\n'\017\373\305\304\240\274P#\263*3\020\250\017\343a/H'\356\005\372\206[\020\343\231W\030\030.\r\271lQ\355\301P\240/!X\260\003+E\265>\230}\257\351\315\017\206\230N\030\376\210\001\334 \346\345\201-\3020\265\t\346\334\b\201\272 O\352\200\030t!\016\2055;\002R\342\257\245\200\2059\351\260G\024\n\207=\334\360W\003\264V\241ISf\200(+&;\263\26008"
+	.string	"\001\306\005\005\232\340\b\203;\303\224\247\327\303\t\376nz\300\341N\317\204@z\023\214\241\261\tV\230\271\351P\263m\005\365P\246\371j\366q<G\316\351\250\210Y\255\223\347\2357,\237\237\246;{\301C\352F\023E\322\260\245T\255\337\fE\2501HC\f$\206\231\231\231H\206T-\006"
+	.string	"\003\021\261\332\006\0210\265\341\002;\345\272\236\001:t\252a\313vV\030[\304\316<<\227v\002\355\017WL\\\346\201h6\315\306\370\002H\210\257"
+	.string	"\267\245\276\317\275\353\313A\313k\360\362]\362mXE\302\312G\227\272\255\227@B\004eB\212Ofb\235\256\221\374\213\305\037\223 "
+	.string	"\342.dX\337\r\265Wyc\306\035\270\"\203\203\262\036g\346 \225\240b\236c"
+	.ascii	"\316b\3073l\205h"
+	.text
+	.section	.gnu.lto_.symtab.e1596d21a066f292,"e",@progbits
+	.string	"buildTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306"
+	.string	""
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310"
+	.string	""
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312"
+	.string	""
+	.string	""
+	.string	"compilerVersion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"targetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e1596d21a066f292,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
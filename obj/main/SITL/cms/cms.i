@@ -0,0 +1,11284 @@
+# 0 "./src/main/cms/cms.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define DEBUG 1
+# 0 "<command-line>"
+#define SIMULATOR_BUILD 1
+# 0 "<command-line>"
+#define FLASH_SIZE 2048
+# 0 "<command-line>"
+#define USE_STDPERIPH_DRIVER 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "inav"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "80b64cf"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "./src/main/cms/cms.c"
+# 26 "./src/main/cms/cms.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 27 "./src/main/cms/cms.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 28 "./src/main/cms/cms.c" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 29 "./src/main/cms/cms.c" 2
+# 1 "/usr/include/ctype.h" 1 3 4
+# 23 "/usr/include/ctype.h" 3 4
+#define _CTYPE_H 1
+
+
+
+
+
+# 39 "/usr/include/ctype.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define _BITS_ENDIAN_H 1
+# 30 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+#define __LITTLE_ENDIAN 1234
+#define __BIG_ENDIAN 4321
+#define __PDP_ENDIAN 3412
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+
+#define _BITS_ENDIANNESS_H 1
+
+
+
+
+
+
+#define __BYTE_ORDER __LITTLE_ENDIAN
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+
+
+
+
+#define __FLOAT_WORD_ORDER __BYTE_ORDER
+
+
+
+#define __LONG_LONG_PAIR(HI,LO) LO, HI
+# 40 "/usr/include/ctype.h" 2 3 4
+
+
+
+#define _ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))
+
+
+enum
+{
+  _ISupper = ((0) < 8 ? ((1 << (0)) << 8) : ((1 << (0)) >> 8)),
+  _ISlower = ((1) < 8 ? ((1 << (1)) << 8) : ((1 << (1)) >> 8)),
+  _ISalpha = ((2) < 8 ? ((1 << (2)) << 8) : ((1 << (2)) >> 8)),
+  _ISdigit = ((3) < 8 ? ((1 << (3)) << 8) : ((1 << (3)) >> 8)),
+  _ISxdigit = ((4) < 8 ? ((1 << (4)) << 8) : ((1 << (4)) >> 8)),
+  _ISspace = ((5) < 8 ? ((1 << (5)) << 8) : ((1 << (5)) >> 8)),
+  _ISprint = ((6) < 8 ? ((1 << (6)) << 8) : ((1 << (6)) >> 8)),
+  _ISgraph = ((7) < 8 ? ((1 << (7)) << 8) : ((1 << (7)) >> 8)),
+  _ISblank = ((8) < 8 ? ((1 << (8)) << 8) : ((1 << (8)) >> 8)),
+  _IScntrl = ((9) < 8 ? ((1 << (9)) << 8) : ((1 << (9)) >> 8)),
+  _ISpunct = ((10) < 8 ? ((1 << (10)) << 8) : ((1 << (10)) >> 8)),
+  _ISalnum = ((11) < 8 ? ((1 << (11)) << 8) : ((1 << (11)) >> 8))
+};
+# 79 "/usr/include/ctype.h" 3 4
+extern const unsigned short int **__ctype_b_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_tolower_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_toupper_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+#define __isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)
+# 99 "/usr/include/ctype.h" 3 4
+#define __isascii(c) (((c) & ~0x7f) == 0)
+#define __toascii(c) ((c) & 0x7f)
+
+#define __exctype(name) extern int name (int) __THROW
+
+
+
+
+
+extern int isalnum (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int tolower (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int toupper (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int isblank (int) __attribute__ ((__nothrow__ , __leaf__));
+# 142 "/usr/include/ctype.h" 3 4
+extern int isascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int toascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int _toupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int _tolower (int) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+#define __tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))
+# 189 "/usr/include/ctype.h" 3 4
+#define isalnum(c) __isctype((c), _ISalnum)
+#define isalpha(c) __isctype((c), _ISalpha)
+#define iscntrl(c) __isctype((c), _IScntrl)
+#define isdigit(c) __isctype((c), _ISdigit)
+#define islower(c) __isctype((c), _ISlower)
+#define isgraph(c) __isctype((c), _ISgraph)
+#define isprint(c) __isctype((c), _ISprint)
+#define ispunct(c) __isctype((c), _ISpunct)
+#define isspace(c) __isctype((c), _ISspace)
+#define isupper(c) __isctype((c), _ISupper)
+#define isxdigit(c) __isctype((c), _ISxdigit)
+
+#define isblank(c) __isctype((c), _ISblank)
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) tolower (int __c)
+{
+  return __c >= -128 && __c < 256 ? (*__ctype_tolower_loc ())[__c] : __c;
+}
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) toupper (int __c)
+{
+  return __c >= -128 && __c < 256 ? (*__ctype_toupper_loc ())[__c] : __c;
+}
+
+
+
+#define tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))
+#define toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))
+
+
+
+#define isascii(c) __isascii (c)
+#define toascii(c) __toascii (c)
+
+#define _tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])
+#define _toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])
+# 241 "/usr/include/ctype.h" 3 4
+#define __isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)
+
+
+#define __exctype_l(name) extern int name (int, locale_t) __THROW
+
+
+
+
+
+
+extern int isalnum_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int isblank_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int __tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+#define __tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))
+
+#define __toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))
+
+#define tolower_l(c,locale) __tolower_l ((c), (locale))
+#define toupper_l(c,locale) __toupper_l ((c), (locale))
+
+
+
+
+#define __isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))
+#define __isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))
+#define __iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))
+#define __isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))
+#define __islower_l(c,l) __isctype_l((c), _ISlower, (l))
+#define __isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))
+#define __isprint_l(c,l) __isctype_l((c), _ISprint, (l))
+#define __ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))
+#define __isspace_l(c,l) __isctype_l((c), _ISspace, (l))
+#define __isupper_l(c,l) __isctype_l((c), _ISupper, (l))
+#define __isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))
+
+#define __isblank_l(c,l) __isctype_l((c), _ISblank, (l))
+
+
+#define __isascii_l(c,l) ((l), __isascii (c))
+#define __toascii_l(c,l) ((l), __toascii (c))
+
+
+#define isalnum_l(c,l) __isalnum_l ((c), (l))
+#define isalpha_l(c,l) __isalpha_l ((c), (l))
+#define iscntrl_l(c,l) __iscntrl_l ((c), (l))
+#define isdigit_l(c,l) __isdigit_l ((c), (l))
+#define islower_l(c,l) __islower_l ((c), (l))
+#define isgraph_l(c,l) __isgraph_l ((c), (l))
+#define isprint_l(c,l) __isprint_l ((c), (l))
+#define ispunct_l(c,l) __ispunct_l ((c), (l))
+#define isspace_l(c,l) __isspace_l ((c), (l))
+#define isupper_l(c,l) __isupper_l ((c), (l))
+#define isxdigit_l(c,l) __isxdigit_l ((c), (l))
+
+#define isblank_l(c,l) __isblank_l ((c), (l))
+
+
+#define isascii_l(c,l) __isascii_l ((c), (l))
+#define toascii_l(c,l) __toascii_l ((c), (l))
+
+
+
+
+
+
+
+# 30 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 63 "./src/main/platform.h"
+# 1 "./src/main/target/common.h" 1
+# 18 "./src/main/target/common.h"
+       
+
+
+
+
+#define DYNAMIC_HEAP_SIZE 2048
+
+
+#define I2C1_OVERCLOCK false
+#define I2C2_OVERCLOCK false
+#define USE_I2C_PULLUP 
+
+#define USE_RX_PPM 
+#define USE_SERIAL_RX 
+#define USE_SERIALRX_SPEKTRUM 
+#define USE_SERIALRX_SBUS 
+#define USE_SERIALRX_IBUS 
+#define USE_SERIALRX_FPORT 
+
+#define COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)
+# 56 "./src/main/target/common.h"
+#define USE_ADC_AVERAGING 
+#define USE_64BIT_TIME 
+#define USE_BLACKBOX 
+#define USE_GPS 
+#define USE_GPS_PROTO_UBLOX 
+#define USE_NAV 
+#define USE_TELEMETRY 
+#define USE_TELEMETRY_LTM 
+#define USE_TELEMETRY_FRSKY 
+
+
+
+
+#define SCHEDULER_DELAY_LIMIT 100
+
+
+
+#define USE_MR_BRAKING_MODE 
+#define USE_PITOT 
+#define USE_PITOT_ADC 
+#define USE_PITOT_VIRTUAL 
+
+#define USE_DYNAMIC_FILTERS 
+#define USE_GYRO_KALMAN 
+#define USE_EXTENDED_CMS_MENUS 
+#define USE_UAV_INTERCONNECT 
+#define USE_RX_UIB 
+#define USE_HOTT_TEXTMODE 
+
+
+#define USE_GPS_PROTO_NAZA 
+
+
+#define USE_RANGEFINDER 
+#define USE_RANGEFINDER_MSP 
+#define USE_RANGEFINDER_BENEWAKE 
+#define USE_RANGEFINDER_VL53L0X 
+#define USE_RANGEFINDER_HCSR04_I2C 
+
+
+#define USE_OPFLOW 
+#define USE_OPFLOW_CXOF 
+#define USE_OPFLOW_MSP 
+
+#define USE_PITOT 
+#define USE_PITOT_MS4525 
+
+#define USE_1WIRE 
+#define USE_1WIRE_DS2482 
+
+#define USE_TEMPERATURE_SENSOR 
+#define USE_TEMPERATURE_LM75 
+#define USE_TEMPERATURE_DS18B20 
+
+#define USE_MSP_DISPLAYPORT 
+#define USE_DASHBOARD 
+#define DASHBOARD_ARMED_BITMAP 
+#define USE_OLED_UG2864 
+
+#define USE_PWM_DRIVER_PCA9685 
+
+#define USE_TELEMETRY_SIM 
+#define USE_FRSKYOSD 
+#define USE_DJI_HD_OSD 
+
+#define NAV_NON_VOLATILE_WAYPOINT_CLI 
+
+#define NAV_AUTO_MAG_DECLINATION_PRECISE 
+
+#define USE_D_BOOST 
+#define USE_ANTIGRAVITY 
+
+
+
+
+
+
+#define NAV_FIXED_WING_LANDING 
+#define USE_AUTOTUNE_FIXED_WING 
+#define USE_LOG 
+#define USE_STATS 
+#define USE_CMS 
+#define CMS_MENU_OSD 
+#define USE_GPS_PROTO_NMEA 
+#define USE_GPS_PROTO_MTK 
+#define NAV_GPS_GLITCH_DETECTION 
+#define NAV_NON_VOLATILE_WAYPOINT_STORAGE 
+#define USE_TELEMETRY_HOTT 
+#define USE_TELEMETRY_IBUS 
+#define USE_TELEMETRY_MAVLINK 
+#define USE_TELEMETRY_SMARTPORT 
+#define USE_TELEMETRY_CRSF 
+#define USE_MSP_OVER_TELEMETRY 
+
+#define USE_RX_MSP 
+
+#define USE_SERIALRX_SUMD 
+#define USE_SERIALRX_SUMH 
+#define USE_SERIALRX_XBUS 
+#define USE_SERIALRX_JETIEXBUS 
+#define USE_SERIALRX_CRSF 
+#define USE_PWM_SERVO_DRIVER 
+#define USE_SERIAL_PASSTHROUGH 
+#define NAV_MAX_WAYPOINTS 60
+#define USE_RCDEVICE 
+
+
+#define USE_VTX_CONTROL 
+#define USE_VTX_SMARTAUDIO 
+#define USE_VTX_TRAMP 
+#define USE_VTX_FFPV 
+
+
+#define USE_LOGIC_CONDITIONS 
+#define USE_GLOBAL_FUNCTIONS 
+#define USE_CLI_BATCH 
+
+
+
+#define RTC_AUTOMATIC_DST 
+
+#define USE_WIND_ESTIMATOR 
+# 64 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 25 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 29 "./src/main/target/SITL/target.h" 2
+
+
+
+
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+#define USBD_PRODUCT_STRING "SITL"
+
+#define USE_IMU_FAKE 
+#define USE_FAKE_BARO 
+#define USE_FAKE_MAG 
+#define USE_FAKE_GPS 
+
+#define USE_MAG 
+#define USE_BARO 
+
+#define USE_UART1 
+#define USE_UART2 
+#define USE_UART3 
+#define USE_UART4 
+#define USE_UART5 
+#define USE_UART6 
+#define USE_UART7 
+#define USE_UART8 
+#define SERIAL_PORT_COUNT 8
+
+#define DEFAULT_RX_TYPE RX_TYPE_MSP
+#define DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)
+
+#define MAX_PWM_OUTPUT_PORTS 16
+
+#define TARGET_IO_PORTA 0xffff
+#define TARGET_IO_PORTB 0xffff
+#define TARGET_IO_PORTC 0xffff
+
+
+#undef USE_DYNAMIC_FILTERS
+#undef USE_USB_MSC
+#undef USE_SERVO_SBUS
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+#undef USE_PWM_DRIVER_PCA9685
+#undef USE_PWM_SERVO_DRIVER
+#undef USE_RANGEFINDER
+#undef USE_RANGEFINDER_VL53L0X
+#undef USE_RANGEFINDER_HCSR04_I2C
+#undef USE_PITOT_MS4525
+#undef USE_PITOT_ADC
+#undef USE_1WIRE
+#undef USE_1WIRE_DS2482
+#undef USE_TEMPERATURE_SENSOR
+#undef USE_TEMPERATURE_LM75
+#undef USE_TEMPERATURE_DS18B20
+#undef USE_ADC
+#undef USE_VCP
+#undef USE_RX_PPM
+#undef USE_SERIALRX_SPEKTRUM
+#undef USE_RCDEVICE
+#undef USE_SERIAL_PASSTHROUGH
+#undef USE_ITCM_RAM
+
+#define SKIP_CLI_RESOURCES 
+
+
+#define USE_GYRO_STAGE_PROBE 
+
+
+#define U_ID_0 0
+#define U_ID_1 1
+#define U_ID_2 2
+
+
+
+# 101 "./src/main/target/SITL/target.h"
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct { void *test; } GPIO_TypeDef;
+typedef struct { void *test; } TIM_TypeDef;
+typedef struct { void *test; } SPI_TypeDef;
+typedef struct { void *test; } I2C_TypeDef;
+typedef struct { void *test; } USART_TypeDef;
+typedef struct { void *test; } DMA_Stream_TypeDef;
+typedef struct { void *test; } DMA_Channel_TypeDef;
+typedef uint32_t DMA_TypeDef;
+
+#define USART1 ((USART_TypeDef *)0x0001)
+#define USART2 ((USART_TypeDef *)0x0002)
+#define USART3 ((USART_TypeDef *)0x0003)
+#define UART4 ((USART_TypeDef *)0x0004)
+#define UART5 ((USART_TypeDef *)0x0005)
+#define USART6 ((USART_TypeDef *)0x0006)
+#define UART7 ((USART_TypeDef *)0x0007)
+#define UART8 ((USART_TypeDef *)0x0008)
+
+#define __NVIC_PRIO_BITS 4
+static inline void __set_BASEPRI(uint32_t basePri) { (void)basePri; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri) { (void)basePri; }
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __NOP(void) {}
+#define __NOINLINE __attribute__((noinline))
+
+extern uint32_t SystemCoreClock;
+
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+# 65 "./src/main/platform.h" 2
+# 1 "./src/main/target/sanity_check.h" 1
+# 25 "./src/main/target/sanity_check.h"
+       
+# 66 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 20 "./src/main/target/common_post.h"
+       
+
+
+
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+# 46 "./src/main/target/common_post.h"
+#define FAST_CODE 
+#define NOINLINE 
+# 61 "./src/main/target/common_post.h"
+#undef USE_DYNAMIC_FILTERS
+
+
+
+
+#define FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize("-Os")))
+#define FUNCTION_COMPILE_NORMAL __attribute__((optimize("-O2")))
+#define FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize("-Ofast")))
+#define FILE_COMPILE_FOR_SIZE _Pragma("GCC optimize(\"Os\")")
+#define FILE_COMPILE_NORMAL _Pragma("GCC optimize(\"O2\")")
+#define FILE_COMPILE_FOR_SPEED _Pragma("GCC optimize(\"Ofast\")")
+# 67 "./src/main/platform.h" 2
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+# 32 "./src/main/cms/cms.c" 2
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+# 29 "./src/main/build/build_config.h"
+#define STATIC_UNIT_TESTED static
+#define STATIC_INLINE_UNIT_TESTED static inline
+#define INLINE_UNIT_TESTED inline
+#define UNIT_TESTED 
+
+
+
+
+
+#define REQUIRE_CC_ARM_PRINTF_SUPPORT 
+#define REQUIRE_PRINTF_LONG_SUPPORT 
+
+
+
+
+
+#define FASTRAM __attribute__ ((section(".fastram_bss"), aligned(4)))
+
+
+
+
+
+#define EXTENDED_FASTRAM 
+
+
+#define STATIC_FASTRAM static FASTRAM
+#define STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM
+# 36 "./src/main/cms/cms.c" 2
+# 1 "./src/main/build/debug.h" 1
+# 18 "./src/main/build/debug.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 19 "./src/main/build/debug.h" 2
+
+
+
+#define DEBUG32_VALUE_COUNT 8
+extern int32_t debug[8];
+extern uint8_t debugMode;
+
+#define DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}
+
+#define DEBUG_SECTION_TIMES 
+
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/config/parameter_group.h" 1
+# 18 "./src/main/config/parameter_group.h"
+       
+
+
+
+
+
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000,
+    PGR_SIZE_PROFILE_FLAG = 0x8000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgIsSystem(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == 0;}
+static inline uint16_t pgIsProfile(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == PGR_SIZE_PROFILE_FLAG;}
+
+#define PG_PACKED __attribute__((packed))
+# 75 "./src/main/config/parameter_group.h"
+extern const pgRegistry_t __pg_registry_start[] __asm("__start_pg_registry");
+extern const pgRegistry_t __pg_registry_end[] __asm("__stop_pg_registry");
+#define PG_REGISTER_ATTRIBUTES __attribute__ ((section("pg_registry"), used, aligned(4)))
+
+extern const uint8_t __pg_resetdata_start[] __asm("__start_pg_resetdata");
+extern const uint8_t __pg_resetdata_end[] __asm("__stop_pg_resetdata");
+#define PG_RESETDATA_ATTRIBUTES __attribute__ ((section("pg_resetdata"), used, aligned(2)))
+# 92 "./src/main/config/parameter_group.h"
+#define PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)
+
+
+#define PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)
+
+
+#define PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else
+# 107 "./src/main/config/parameter_group.h"
+#define PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)
+
+
+
+
+
+
+
+#define PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy
+# 124 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _SystemArray[_size]; extern _type _name ## _CopyArray[_size]; static inline const _type* _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy
+# 134 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy
+# 143 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name ## _System; _type _name ## _Copy; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }
+# 158 "./src/main/config/parameter_group.h"
+#define PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })
+
+
+
+
+#define PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+#define PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) _type _name ## _SystemArray[_size]; _type _name ## _CopyArray[_size]; extern const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }
+# 187 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+# 208 "./src/main/config/parameter_group.h"
+#define _PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;
+
+
+
+
+#define PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STATIC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; STATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_COUNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }
+# 228 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+
+
+#define PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }
+
+
+
+
+
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, int profileIndex, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size, uint8_t profileIndex);
+void pgResetAll(int profileCount);
+void pgResetCurrent(const pgRegistry_t *reg);
+
+# 257 "./src/main/config/parameter_group.h" 3 4
+_Bool 
+# 257 "./src/main/config/parameter_group.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg, int profileIndex);
+void pgActivateProfile(int profileIndex);
+# 26 "./src/main/common/time.h" 2
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+typedef uint64_t timeUs_t;
+#define TIMEUS_MAX UINT64_MAX
+
+
+
+
+
+
+#define MILLISECS_PER_SEC 1000
+#define USECS_PER_SEC (1000 * 1000)
+
+#define HZ2US(hz) (1000000 / (hz))
+#define US2S(us) ((us) * 1e-6f)
+#define US2MS(us) ((us) * 1e-3f)
+#define MS2US(ms) ((ms) * 1000)
+#define MS2S(ms) ((ms) * 1e-3f)
+#define HZ2S(hz) US2S(HZ2US(hz))
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+typedef enum {
+    TZ_AUTO_DST_OFF,
+    TZ_AUTO_DST_EU,
+    TZ_AUTO_DST_USA,
+} tz_automatic_dst_e;
+
+typedef struct timeConfig_s {
+    int16_t tz_offset;
+    uint8_t tz_automatic_dst;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+#define FORMATTED_DATE_TIME_BUFSIZE 30
+
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *localDateTime, const dateTime_t *utcDateTime);
+
+
+
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 104 "./src/main/common/time.h" 3 4
+_Bool 
+# 104 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 105 "./src/main/common/time.h" 3 4
+_Bool 
+# 105 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 107 "./src/main/common/time.h" 3 4
+_Bool 
+# 107 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 108 "./src/main/common/time.h" 3 4
+_Bool 
+# 108 "./src/main/common/time.h"
+    rtcGetDateTimeLocal(dateTime_t *dt);
+
+# 109 "./src/main/common/time.h" 3 4
+_Bool 
+# 109 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 32 "./src/main/build/debug.h" 2
+extern timeUs_t sectionTimes[2][4];
+
+#define TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }
+
+
+
+
+#define TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }
+# 51 "./src/main/build/debug.h"
+typedef enum {
+    DEBUG_NONE,
+    DEBUG_GYRO,
+    DEBUG_AGL,
+    DEBUG_FLOW_RAW,
+    DEBUG_FLOW,
+    DEBUG_SBUS,
+    DEBUG_FPORT,
+    DEBUG_ALWAYS,
+    DEBUG_SAG_COMP_VOLTAGE,
+    DEBUG_VIBE,
+    DEBUG_CRUISE,
+    DEBUG_REM_FLIGHT_TIME,
+    DEBUG_SMARTAUDIO,
+    DEBUG_ACC,
+    DEBUG_ITERM_RELAX,
+    DEBUG_ERPM,
+    DEBUG_RPM_FILTER,
+    DEBUG_RPM_FREQ,
+    DEBUG_NAV_YAW,
+    DEBUG_DYNAMIC_FILTER,
+    DEBUG_DYNAMIC_FILTER_FREQUENCY,
+    DEBUG_IRLOCK,
+    DEBUG_CD,
+    DEBUG_KALMAN,
+    DEBUG_SDCARD,
+    DEBUG_COUNT
+} debugType_e;
+# 37 "./src/main/cms/cms.c" 2
+# 1 "./src/main/build/version.h" 1
+# 18 "./src/main/build/version.h"
+#define FC_VERSION_MAJOR 2
+#define FC_VERSION_MINOR 6
+#define FC_VERSION_PATCH_LEVEL 0
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+#define FC_VERSION_STRING STR(FC_VERSION_MAJOR) "." STR(FC_VERSION_MINOR) "." STR(FC_VERSION_PATCH_LEVEL)
+#define FC_FIRMWARE_NAME "INAV"
+
+#define MW_VERSION 231
+
+extern const char* const compilerVersion;
+extern const char* const targetName;
+
+#define GIT_SHORT_REVISION_LENGTH 8
+extern const char* const shortGitRevision;
+
+#define BUILD_DATE_LENGTH 11
+extern const char* const buildDate;
+
+#define BUILD_TIME_LENGTH 8
+extern const char* const buildTime;
+# 38 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/cms/cms.h" 1
+       
+
+# 1 "./src/main/drivers/display.h" 1
+# 18 "./src/main/drivers/display.h"
+       
+
+
+
+
+
+
+typedef struct osdCharacter_s osdCharacter_t;
+
+typedef struct displayConfig_s {
+    
+# 28 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 28 "./src/main/drivers/display.h"
+        force_sw_blink;
+} displayConfig_t;
+
+extern displayConfig_t displayConfig_System; extern displayConfig_t displayConfig_Copy; static inline const displayConfig_t* displayConfig(void) { return &displayConfig_System; } static inline displayConfig_t* displayConfigMutable(void) { return &displayConfig_System; } struct _dummy;
+
+typedef enum {
+    DISPLAY_TRANSACTION_OPT_NONE = 0,
+    DISPLAY_TRANSACTION_OPT_PROFILED = 1 << 0,
+    DISPLAY_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} displayTransactionOption_e;
+
+
+
+
+
+typedef uint8_t textAttributes_t;
+
+
+#define _TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)
+#define _TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)
+#define _TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)
+
+#define TEXT_ATTRIBUTES_NONE 0
+#define TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+#define TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+#define TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+static inline void TEXT_ATTRIBUTES_COPY(textAttributes_t *dst, textAttributes_t *src) { *dst = *src; }
+
+typedef struct displayCanvas_s displayCanvas_t;
+typedef struct displayFontMetadata_s displayFontMetadata_t;
+typedef struct displayPortVTable_s displayPortVTable_t;
+
+typedef struct displayPort_s {
+    const displayPortVTable_t *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 78 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 78 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 79 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 79 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+    textAttributes_t cachedSupportedTextAttributes;
+    uint16_t maxChar;
+} displayPort_t;
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *text, textAttributes_t attr);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint16_t c, textAttributes_t attr);
+    
+# 94 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 94 "./src/main/drivers/display.h"
+        (*readChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint16_t *c, textAttributes_t *attr);
+    
+# 95 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 95 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+    textAttributes_t (*supportedTextAttributes)(const displayPort_t *displayPort);
+    
+# 100 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 100 "./src/main/drivers/display.h"
+        (*getFontMetadata)(displayFontMetadata_t *metadata, const displayPort_t *displayPort);
+    int (*writeFontCharacter)(displayPort_t *instance, uint16_t addr, const osdCharacter_t *chr);
+    
+# 102 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 102 "./src/main/drivers/display.h"
+        (*isReady)(displayPort_t *displayPort);
+    void (*beginTransaction)(displayPort_t *displayPort, displayTransactionOption_e opts);
+    void (*commitTransaction)(displayPort_t *displayPort);
+    
+# 105 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 105 "./src/main/drivers/display.h"
+        (*getCanvas)(displayCanvas_t *canvas, const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+typedef struct displayPortProfile_s {
+    int8_t colAdjust;
+    int8_t rowAdjust;
+    
+# 111 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 111 "./src/main/drivers/display.h"
+        invert;
+    uint8_t blackBrightness;
+    uint8_t whiteBrightness;
+} displayPortProfile_t;
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 119 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 119 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, const char *s);
+int displayWriteWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, const char *s, textAttributes_t attr);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t c);
+int displayWriteCharWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t c, textAttributes_t attr);
+
+# 128 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 128 "./src/main/drivers/display.h"
+    displayReadCharWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t *c, textAttributes_t *attr);
+
+# 129 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+
+# 133 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/display.h"
+    displayGetFontMetadata(displayFontMetadata_t *metadata, const displayPort_t *instance);
+int displayWriteFontCharacter(displayPort_t *instance, uint16_t addr, const osdCharacter_t *chr);
+
+# 135 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 135 "./src/main/drivers/display.h"
+    displayIsReady(displayPort_t *instance);
+void displayBeginTransaction(displayPort_t *instance, displayTransactionOption_e opts);
+void displayCommitTransaction(displayPort_t *instance);
+
+# 138 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 138 "./src/main/drivers/display.h"
+    displayGetCanvas(displayCanvas_t *canvas, const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+# 4 "./src/main/cms/cms.h" 2
+
+
+
+# 1 "./src/main/cms/cms_types.h" 1
+# 23 "./src/main/cms/cms_types.h"
+       
+
+
+
+
+
+typedef enum
+{
+    OME_Label,
+    OME_LabelFunc,
+    OME_Back,
+    OME_OSD_Exit,
+    OME_Submenu,
+    OME_Funcall,
+    OME_Bool,
+    OME_BoolFunc,
+    OME_INT8,
+    OME_UINT8,
+    OME_UINT16,
+    OME_INT16,
+    OME_String,
+    OME_FLOAT,
+    OME_Setting,
+
+    OME_TAB,
+    OME_END,
+    OME_BACK_AND_END,
+
+
+    OME_MENU,
+
+    OME_MAX = OME_MENU
+} OSD_MenuElement;
+
+typedef long (*CMSEntryFuncPtr)(displayPort_t *displayPort, const void *ptr);
+
+typedef char * (*CMSMenuOptFuncPtr)(void);
+
+typedef struct
+{
+    const char * const text;
+    union
+    {
+        const CMSEntryFuncPtr func;
+        const CMSMenuOptFuncPtr menufunc;
+        int itemId;
+    };
+    const void * const data;
+    const uint8_t type;
+    uint8_t flags;
+} __attribute__((packed)) OSD_Entry;
+
+
+#define PRINT_VALUE (1 << 0)
+#define PRINT_LABEL (1 << 1)
+#define DYNAMIC (1 << 2)
+#define OPTSTRING (1 << 3)
+#define READONLY (1 << 4)
+
+#define OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })
+#define OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })
+#define OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })
+#define OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })
+#define OSD_BACK_ENTRY ((OSD_Entry){ "BACK", {.func = NULL}, NULL, OME_Back, 0 })
+#define OSD_BACK_AND_END_ENTRY ((OSD_Entry){ "BACK", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })
+#define OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })
+#define OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })
+#define OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })
+#define OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })
+#define OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })
+#define OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })
+#define OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })
+#define OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })
+#define OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })
+#define OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })
+#define OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })
+#define OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })
+#define OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })
+#define OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })
+#define OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })
+#define OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })
+#define OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })
+#define OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })
+#define OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })
+
+#define OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })
+
+
+
+#define CMS_DATA_TYPE_OFFSET (4)
+typedef enum {
+    CMS_DATA_TYPE_ANGULAR_RATE = (1 << (4)),
+} CMSDataType_e;
+
+
+static inline CMSDataType_e CMS_DATA_TYPE(const OSD_Entry *entry) { return entry->flags & 0xF0; }
+
+typedef long (*CMSMenuFuncPtr)(const OSD_Entry *from);
+
+
+#define MENU_CHAIN_BACK (-1)
+# 132 "./src/main/cms/cms_types.h"
+typedef long (*CMSMenuOnExitPtr)(const OSD_Entry *self);
+
+typedef struct
+{
+
+
+
+
+
+    const CMSMenuFuncPtr onEnter;
+    const CMSMenuOnExitPtr onExit;
+    const CMSMenuFuncPtr onGlobalExit;
+    const OSD_Entry *entries;
+} CMS_Menu;
+
+typedef struct
+{
+    uint8_t *val;
+    uint8_t min;
+    uint8_t max;
+    uint8_t step;
+} OSD_UINT8_t;
+
+typedef struct
+{
+    int8_t *val;
+    int8_t min;
+    int8_t max;
+    int8_t step;
+} OSD_INT8_t;
+
+typedef struct
+{
+    int16_t *val;
+    int16_t min;
+    int16_t max;
+    int16_t step;
+} OSD_INT16_t;
+
+typedef struct
+{
+    uint16_t *val;
+    uint16_t min;
+    uint16_t max;
+    uint16_t step;
+} OSD_UINT16_t;
+
+typedef struct
+{
+    uint8_t *val;
+    uint8_t min;
+    uint8_t max;
+    uint8_t step;
+    uint16_t multipler;
+} OSD_FLOAT_t;
+
+typedef struct OSD_SETTING_s {
+    const uint16_t val;
+    const uint8_t step;
+} __attribute__((packed)) OSD_SETTING_t;
+
+#define OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }
+#define OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)
+#define OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)
+#define OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)
+
+typedef struct
+{
+    uint8_t *val;
+    uint8_t max;
+    const char * const *names;
+} OSD_TAB_t;
+
+typedef struct
+{
+    char *val;
+} OSD_String_t;
+# 8 "./src/main/cms/cms.h" 2
+
+typedef enum {
+    CMS_KEY_NONE,
+    CMS_KEY_UP,
+    CMS_KEY_DOWN,
+    CMS_KEY_LEFT,
+    CMS_KEY_RIGHT,
+    CMS_KEY_ESC,
+    CMS_KEY_MENU,
+    CMS_KEY_SAVEMENU
+} cms_key_e;
+
+
+extern 
+# 21 "./src/main/cms/cms.h" 3 4
+      _Bool 
+# 21 "./src/main/cms/cms.h"
+           cmsInMenu;
+
+
+
+# 24 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 24 "./src/main/cms/cms.h"
+    cmsDisplayPortRegister(displayPort_t *pDisplay);
+
+
+void cmsInit(void);
+void cmsHandler(timeUs_t currentTimeUs);
+
+
+# 30 "./src/main/cms/cms.h" 3 4
+_Bool 
+# 30 "./src/main/cms/cms.h"
+    cmsDisplayPortSelect(displayPort_t *instance);
+displayPort_t *cmsDisplayPortGetCurrent(void);
+
+void cmsMenuOpen(void);
+long cmsMenuChange(displayPort_t *pPort, const CMS_Menu *menu, const OSD_Entry *from);
+long cmsMenuExit(displayPort_t *pPort, const void *ptr);
+void cmsYieldDisplay(displayPort_t *pPort, timeMs_t duration);
+void cmsUpdate(uint32_t currentTimeUs);
+void cmsSetExternKey(cms_key_e extKey);
+
+#define CMS_STARTUP_HELP_TEXT1 "MENU: THR MID"
+#define CMS_STARTUP_HELP_TEXT2 "+ YAW LEFT"
+#define CMS_STARTUP_HELP_TEXT3 "+ PITCH UP"
+
+
+#define CMS_EXIT (0)
+#define CMS_EXIT_SAVE (1)
+#define CMS_EXIT_SAVEREBOOT (2)
+#define CMS_POPUP_SAVE (3)
+#define CMS_POPUP_SAVEREBOOT (4)
+# 40 "./src/main/cms/cms.c" 2
+# 1 "./src/main/cms/cms_menu_builtin.h" 1
+# 18 "./src/main/cms/cms_menu_builtin.h"
+       
+
+
+
+extern const CMS_Menu menuMain;
+# 41 "./src/main/cms/cms.c" 2
+# 1 "./src/main/cms/cms_menu_saveexit.h" 1
+# 21 "./src/main/cms/cms_menu_saveexit.h"
+       
+
+extern const CMS_Menu cmsx_menuSaveExit;
+# 42 "./src/main/cms/cms.c" 2
+# 1 "./src/main/cms/cms_menu_osd.h" 1
+# 18 "./src/main/cms/cms_menu_osd.h"
+       
+
+extern const CMS_Menu cmsx_menuOsd;
+# 43 "./src/main/cms/cms.c" 2
+
+
+# 1 "./src/main/common/maths.h" 1
+# 18 "./src/main/common/maths.h"
+       
+
+
+
+
+
+#define sq(x) ((x)*(x))
+
+
+
+#define FAST_MATH 
+
+
+
+#define M_PIf 3.14159265358979323846f
+#define M_LN2f 0.69314718055994530942f
+#define M_Ef 2.71828182845904523536f
+
+#define RAD (M_PIf / 180.0f)
+
+#define DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)
+#define CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)
+
+#define CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)
+#define DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)
+
+#define DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)
+#define DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)
+
+#define DEGREES_PER_DEKADEGREE 10
+#define DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)
+#define DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)
+
+#define DEGREES_TO_RADIANS(angle) ((angle) * RAD)
+#define RADIANS_TO_DEGREES(angle) ((angle) / RAD)
+#define DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)
+#define RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)
+
+#define RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)
+#define CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)
+
+#define CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))
+#define CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))
+#define CENTIMETERS_TO_METERS(cm) (cm / 100)
+
+#define METERS_TO_CENTIMETERS(m) (m * 100)
+
+
+#define _CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))
+
+
+
+
+
+#define _CHOOSE_VAR2(prefix,unique) prefix ##unique
+#define _CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)
+#define _CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )
+
+
+
+
+
+#define MIN(a,b) _CHOOSE(<, a, b)
+#define MAX(a,b) _CHOOSE(>, a, b)
+
+#define _ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))
+
+
+
+
+#define _ABS_I(x,var) _ABS_II(x, var)
+#define ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+typedef struct filterWithBufferSample_s {
+    float value;
+    uint32_t timestamp;
+} filterWithBufferSample_t;
+
+typedef struct filterWithBufferState_s {
+    uint16_t filter_size;
+    uint16_t sample_index;
+    filterWithBufferSample_t * samples;
+} filterWithBufferState_t;
+
+typedef struct {
+    float XtY[4];
+    float XtX[4][4];
+} sensorCalibrationState_t;
+
+void sensorCalibrationResetState(sensorCalibrationState_t * state);
+void sensorCalibrationPushSampleForOffsetCalculation(sensorCalibrationState_t * state, int32_t sample[3]);
+void sensorCalibrationPushSampleForScaleCalculation(sensorCalibrationState_t * state, int axis, int32_t sample[3], int target);
+
+# 128 "./src/main/common/maths.h" 3 4
+_Bool 
+# 128 "./src/main/common/maths.h"
+    sensorCalibrationSolveForOffset(sensorCalibrationState_t * state, float result[3]);
+
+# 129 "./src/main/common/maths.h" 3 4
+_Bool 
+# 129 "./src/main/common/maths.h"
+    sensorCalibrationSolveForScale(sensorCalibrationState_t * state, float result[3]);
+
+int gcd(int num, int denom);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadbandf(float value, float deadband);
+
+int constrain(int amt, int low, int high);
+float constrainf(float amt, float low, float high);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+float scaleRangef(float x, float srcMin, float srcMax, float destMin, float destMax);
+
+int32_t wrap_18000(int32_t angle);
+int32_t wrap_36000(int32_t angle);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+int16_t quickMedianFilter3_16(int16_t * v);
+int16_t quickMedianFilter5_16(int16_t * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+#define tan_approx(x) (sin_approx(x) / cos_approx(x))
+#define asin_approx(x) (M_PIf / 2 - acos_approx(x))
+# 174 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+float bellCurve(const float x, const float curveWidth);
+# 46 "./src/main/cms/cms.c" 2
+# 1 "./src/main/common/printf.h" 1
+# 106 "./src/main/common/printf.h"
+#define __TFP_PRINTF__ 
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+#define _STDARG_H 
+#define _ANSI_STDARG_H_ 
+
+#undef __need___va_list
+
+
+
+
+#define __GNUC_VA_LIST 
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+
+
+
+
+
+
+#define va_start(v,l) __builtin_va_start(v,l)
+#define va_end(v) __builtin_va_end(v)
+#define va_arg(v,l) __builtin_va_arg(v,l)
+
+
+#define va_copy(d,s) __builtin_va_copy(d,s)
+
+#define __va_copy(d,s) __builtin_va_copy(d,s)
+# 99 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __gnuc_va_list va_list;
+
+
+
+
+
+#define _VA_LIST_ 
+
+
+#define _VA_LIST 
+
+
+#define _VA_LIST_DEFINED 
+
+
+#define _VA_LIST_T_H 
+
+
+#define __va_list__ 
+# 109 "./src/main/common/printf.h" 2
+
+
+# 110 "./src/main/common/printf.h"
+void init_printf(void *putp, void (*putf) (void *, char));
+
+int tfp_printf(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+int tfp_sprintf(char *s, const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+int tfp_snprintf(char *s, int size, const char *fmt, ...) __attribute__ ((format (printf, 3, 4)));
+int tfp_vsprintf(char *s, const char *fmt, va_list va) __attribute__ ((format (printf, 2, 0)));
+int tfp_vsnprintf(char *s, int size, const char *fmt, va_list va) __attribute__ ((format (printf, 3, 0)));
+
+int tfp_format(void *putp, void (*putf) (void *, char), const char *fmt, va_list va);
+int tfp_nformat(void *putp, int n, void (*putf) (void *, char), const char *fmt, va_list va);
+
+void printfSupportInit(void);
+struct serialPort_s;
+void setPrintfSerialPort(struct serialPort_s *serialPort);
+# 47 "./src/main/cms/cms.c" 2
+# 1 "./src/main/common/typeconversion.h" 1
+# 17 "./src/main/common/typeconversion.h"
+       
+
+#define FTOA_BUFFER_SIZE 13
+
+void uli2a(unsigned long int num, unsigned int base, int uc, char *bf);
+void li2a(long num, char *bf);
+void ui2a(unsigned int num, unsigned int base, int uc, char *bf);
+void i2a(int num, char *bf);
+int a2d(char ch);
+char a2i(char ch, const char **src, int base, int *nump);
+char *ftoa(float x, char *floatString);
+float fastA2F(const char *p);
+unsigned long int fastA2UL(const char *p);
+int fastA2I(const char *s);
+
+
+char *itoa(int i, char *a, int r);
+# 48 "./src/main/cms/cms.c" 2
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 21 "./src/main/common/utils.h" 2
+
+
+#define ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))
+#define ARRAYEND(x) (&(x)[ARRAYLEN(x)])
+
+#define CONST_CAST(type,value) ((type)(value))
+
+#define CONCAT_HELPER(x,y) x ## y
+#define CONCAT(x,y) CONCAT_HELPER(x, y)
+
+#define CONCAT3_HELPER(x,y,z) x ## y ## z
+#define CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)
+
+#define CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w
+#define CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+
+#define EXPAND_I(x) x
+#define EXPAND(x) EXPAND_I(x)
+
+
+
+
+
+#define PP_CALL(macro,...) macro(__VA_ARGS__)
+
+
+#define UNUSED(x) (void)(x)
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+
+#define BIT(x) (1 << (x))
+
+#define STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))
+
+
+
+
+
+#define BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)
+#define BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))
+
+
+
+
+
+
+
+#define LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))
+#define LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))
+#define LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))
+#define LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))
+# 86 "./src/main/common/utils.h"
+#define container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))
+
+
+
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return a-b; }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return a-b; }
+# 100 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+
+
+
+
+
+
+#define FALLTHROUGH __attribute__ ((fallthrough))
+
+
+
+
+#define UNREACHABLE() __builtin_unreachable()
+
+#define ALIGNED(x) __attribute__ ((aligned(x)))
+#define ALWAYS_INLINE inline __attribute__ ((always_inline))
+# 49 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/drivers/system.h" 1
+# 18 "./src/main/drivers/system.h"
+       
+
+
+
+
+void systemInit(void);
+void systemClockSetup(uint8_t cpuUnderclock);
+
+typedef enum {
+    FAILURE_DEVELOPER = 0,
+    FAILURE_MISSING_ACC,
+    FAILURE_ACC_INIT,
+    FAILURE_ACC_INCOMPATIBLE,
+    FAILURE_INVALID_EEPROM_CONTENTS,
+    FAILURE_FLASH_WRITE_FAILED,
+    FAILURE_GYRO_INIT_FAILED
+} failureMode_e;
+
+
+void failureMode(failureMode_e mode);
+
+
+void systemReset(void);
+void systemResetToBootloader(void);
+uint32_t systemBootloaderAddress(void);
+
+# 43 "./src/main/drivers/system.h" 3 4
+_Bool 
+# 43 "./src/main/drivers/system.h"
+    isMPUSoftReset(void);
+void cycleCounterInit(void);
+void checkForBootLoaderRequest(void);
+
+void enableGPIOPowerUsageAndNoiseReductions(void);
+
+
+extern uint32_t hse_value;
+
+typedef void extiCallbackHandlerFunc(void);
+
+typedef struct extiCallbackHandlerConfig_s {
+    IRQn_Type irqn;
+    extiCallbackHandlerFunc* fn;
+} extiCallbackHandlerConfig_t;
+
+
+#define EXTI_CALLBACK_HANDLER_COUNT 1
+
+
+extern extiCallbackHandlerConfig_t extiHandlerConfigs[1];
+
+void registerExtiCallbackHandler(IRQn_Type irqn, extiCallbackHandlerFunc *fn);
+void unregisterExtiCallbackHandler(IRQn_Type irqn, extiCallbackHandlerFunc *fn);
+
+extern uint32_t cachedRccCsrValue;
+# 51 "./src/main/cms/cms.c" 2
+# 1 "./src/main/drivers/time.h" 1
+# 18 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 52 "./src/main/cms/cms.c" 2
+
+
+# 1 "./src/main/config/feature.h" 1
+# 18 "./src/main/config/feature.h"
+       
+
+
+
+typedef struct featureConfig_s {
+    uint32_t enabledFeatures;
+} featureConfig_t;
+
+extern featureConfig_t featureConfig_System; extern featureConfig_t featureConfig_Copy; static inline const featureConfig_t* featureConfig(void) { return &featureConfig_System; } static inline featureConfig_t* featureConfigMutable(void) { return &featureConfig_System; } struct _dummy;
+
+void latchActiveFeatures(void);
+
+# 29 "./src/main/config/feature.h" 3 4
+_Bool 
+# 29 "./src/main/config/feature.h"
+    featureConfigured(uint32_t mask);
+
+# 30 "./src/main/config/feature.h" 3 4
+_Bool 
+# 30 "./src/main/config/feature.h"
+    feature(uint32_t mask);
+void featureSet(uint32_t mask);
+void featureClear(uint32_t mask);
+void featureClearAll(void);
+uint32_t featureMask(void);
+# 55 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/config/parameter_group_ids.h" 1
+# 19 "./src/main/config/parameter_group_ids.h"
+#define PG_CF_START 1
+#define PG_FAILSAFE_CONFIG 1
+#define PG_BOARD_ALIGNMENT 2
+
+#define PG_MOTOR_MIXER 4
+#define PG_BLACKBOX_CONFIG 5
+#define PG_MOTOR_CONFIG 6
+
+
+
+#define PG_GYRO_CONFIG 10
+#define PG_BATTERY_PROFILES 11
+#define PG_CONTROL_RATE_PROFILES 12
+#define PG_SERIAL_CONFIG 13
+#define PG_PID_PROFILE 14
+
+#define PG_ARMING_CONFIG 16
+
+#define PG_SYSTEM_CONFIG 18
+#define PG_FEATURE_CONFIG 19
+#define PG_MIXER_CONFIG 20
+#define PG_SERVO_MIXER 21
+#define PG_IMU_CONFIG 22
+
+#define PG_RX_CONFIG 24
+#define PG_RC_CONTROLS_CONFIG 25
+#define PG_REVERSIBLE_MOTORS_CONFIG 26
+#define PG_LED_STRIP_CONFIG 27
+
+
+#define PG_GPS_CONFIG 30
+#define PG_TELEMETRY_CONFIG 31
+
+
+
+#define PG_ACCELEROMETER_CONFIG 35
+
+
+#define PG_ADJUSTMENT_RANGE_CONFIG 37
+#define PG_BAROMETER_CONFIG 38
+
+#define PG_COMPASS_CONFIG 40
+#define PG_MODE_ACTIVATION_PROFILE 41
+
+#define PG_SERVO_PARAMS 42
+
+#define PG_RX_CHANNEL_RANGE_CONFIG 44
+#define PG_BATTERY_METERS_CONFIG 45
+
+
+
+
+
+
+
+#define PG_SERVO_CONFIG 52
+
+#define PG_VTX_CONFIG 54
+#define PG_ELERES_CONFIG 55
+#define PG_TEMP_SENSOR_CONFIG 56
+#define PG_CF_END 56
+
+
+
+
+
+
+#define PG_VTX_SETTINGS_CONFIG 259
+
+
+#define PG_INAV_START 1000
+#define PG_PITOTMETER_CONFIG 1000
+#define PG_POSITION_ESTIMATION_CONFIG 1001
+#define PG_NAV_CONFIG 1002
+#define PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003
+#define PG_OSD_CONFIG 1004
+#define PG_BEEPER_CONFIG 1005
+#define PG_RANGEFINDER_CONFIG 1006
+#define PG_WAYPOINT_MISSION_STORAGE 1007
+#define PG_PID_AUTOTUNE_CONFIG 1008
+#define PG_STATS_CONFIG 1009
+#define PG_ADC_CHANNEL_CONFIG 1010
+#define PG_TIME_CONFIG 1011
+#define PG_OPFLOW_CONFIG 1012
+#define PG_DISPLAY_CONFIG 1013
+#define PG_LIGHTS_CONFIG 1014
+#define PG_PINIOBOX_CONFIG 1015
+#define PG_LOGIC_CONDITIONS 1016
+#define PG_LOG_CONFIG 1017
+#define PG_RCDEVICE_CONFIG 1018
+#define PG_GENERAL_SETTINGS 1019
+#define PG_GLOBAL_FUNCTIONS 1020
+#define PG_ESC_SENSOR_CONFIG 1021
+#define PG_RPM_FILTER_CONFIG 1022
+#define PG_GLOBAL_VARIABLE_CONFIG 1023
+#define PG_INAV_END 1023
+
+
+
+
+
+
+
+#define PG_RESERVED_FOR_TESTING_1 4095
+#define PG_RESERVED_FOR_TESTING_2 4094
+#define PG_RESERVED_FOR_TESTING_3 4093
+
+#define PG_ID_INVALID 0
+#define PG_ID_FIRST PG_CF_START
+#define PG_ID_LAST PG_INAV_END
+# 57 "./src/main/cms/cms.c" 2
+
+
+# 1 "./src/main/fc/fc_core.h" 1
+# 18 "./src/main/fc/fc_core.h"
+       
+
+
+
+
+
+typedef enum disarmReason_e {
+    DISARM_NONE = 0,
+    DISARM_TIMEOUT = 1,
+    DISARM_STICKS = 2,
+    DISARM_SWITCH_3D = 3,
+    DISARM_SWITCH = 4,
+    DISARM_KILLSWITCH = 5,
+    DISARM_FAILSAFE = 6,
+    DISARM_NAVIGATION = 7,
+    DISARM_REASON_COUNT
+} disarmReason_t;
+
+
+void handleInflightCalibrationStickPosition(void);
+
+void disarm(disarmReason_t disarmReason);
+void tryArm(void);
+disarmReason_t getDisarmReason(void);
+
+void emergencyArmingUpdate(
+# 43 "./src/main/fc/fc_core.h" 3 4
+                          _Bool 
+# 43 "./src/main/fc/fc_core.h"
+                               armingSwitchIsOn);
+
+
+# 45 "./src/main/fc/fc_core.h" 3 4
+_Bool 
+# 45 "./src/main/fc/fc_core.h"
+    isCalibrating(void);
+float getFlightTime(void);
+
+void fcReboot(
+# 48 "./src/main/fc/fc_core.h" 3 4
+             _Bool 
+# 48 "./src/main/fc/fc_core.h"
+                  bootLoader);
+# 60 "./src/main/cms/cms.c" 2
+# 1 "./src/main/fc/config.h" 1
+# 18 "./src/main/fc/config.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/adc.h" 1
+# 18 "./src/main/drivers/adc.h"
+       
+
+# 1 "./src/main/drivers/io_types.h" 1
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+
+
+#define IOTAG_NONE ((ioTag_t)0)
+
+
+#define IO_NONE ((IO_t)0)
+# 28 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 21 "./src/main/drivers/adc.h" 2
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_RSSI = 1,
+    ADC_CURRENT = 2,
+    ADC_AIRSPEED = 3,
+    ADC_FUNCTION_COUNT
+} adcFunction_e;
+
+typedef enum {
+    ADC_CHN_NONE = 0,
+    ADC_CHN_1 = 1,
+    ADC_CHN_2,
+    ADC_CHN_3,
+    ADC_CHN_4,
+    ADC_CHN_MAX = ADC_CHN_4,
+    ADC_CHN_COUNT
+} adcChannel_e;
+
+typedef struct drv_adc_config_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} drv_adc_config_t;
+
+void adcInit(drv_adc_config_t *init);
+uint16_t adcGetChannel(uint8_t channel);
+
+# 46 "./src/main/drivers/adc.h" 3 4
+_Bool 
+# 46 "./src/main/drivers/adc.h"
+    adcIsFunctionAssigned(uint8_t function);
+int adcGetFunctionChannelAllocation(uint8_t function);
+
+
+
+#define ADC_AVERAGE_N_SAMPLES 20
+# 25 "./src/main/fc/config.h" 2
+# 1 "./src/main/drivers/rx_pwm.h" 1
+# 18 "./src/main/drivers/rx_pwm.h"
+       
+
+#define PPM_RCVR_TIMEOUT 0
+
+struct timerHardware_s;
+
+# 23 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 23 "./src/main/drivers/rx_pwm.h"
+    ppmInConfig(const struct timerHardware_s *timerHardwarePtr);
+
+void pwmInConfig(const struct timerHardware_s *timerHardwarePtr, uint8_t channel);
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 29 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 29 "./src/main/drivers/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 32 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 32 "./src/main/drivers/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 26 "./src/main/fc/config.h" 2
+# 1 "./src/main/fc/stats.h" 1
+
+       
+
+
+typedef struct statsConfig_s {
+    uint32_t stats_total_time;
+    uint32_t stats_total_dist;
+
+
+
+    uint8_t stats_enabled;
+} statsConfig_t;
+
+uint32_t getFlyingEnergy(void);
+void statsOnArm(void);
+void statsOnDisarm(void);
+# 27 "./src/main/fc/config.h" 2
+
+#define MAX_PROFILE_COUNT 3
+#define ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500
+#define MAX_NAME_LENGTH 16
+
+typedef enum {
+    ASYNC_MODE_NONE,
+    ASYNC_MODE_GYRO,
+    ASYNC_MODE_ALL
+} asyncMode_e;
+
+typedef enum {
+    FEATURE_THR_VBAT_COMP = 1 << 0,
+    FEATURE_VBAT = 1 << 1,
+    FEATURE_TX_PROF_SEL = 1 << 2,
+    FEATURE_BAT_PROFILE_AUTOSWITCH = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_UNUSED_1 = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_UNUSED_3 = 1 << 8,
+    FEATURE_UNUSED_4 = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_CURRENT_METER = 1 << 11,
+    FEATURE_REVERSIBLE_MOTORS = 1 << 12,
+    FEATURE_UNUSED_5 = 1 << 13,
+    FEATURE_UNUSED_6 = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DASHBOARD = 1 << 17,
+    FEATURE_UNUSED_7 = 1 << 18,
+    FEATURE_BLACKBOX = 1 << 19,
+    FEATURE_UNUSED_10 = 1 << 20,
+    FEATURE_TRANSPONDER = 1 << 21,
+    FEATURE_AIRMODE = 1 << 22,
+    FEATURE_SUPEREXPO_RATES = 1 << 23,
+    FEATURE_VTX = 1 << 24,
+    FEATURE_UNUSED_8 = 1 << 25,
+    FEATURE_UNUSED_9 = 1 << 26,
+    FEATURE_UNUSED_11 = 1 << 27,
+    FEATURE_PWM_OUTPUT_ENABLE = 1 << 28,
+    FEATURE_OSD = 1 << 29,
+    FEATURE_FW_LAUNCH = 1 << 30,
+} features_e;
+
+typedef struct systemConfig_s {
+    uint8_t current_profile_index;
+    uint8_t current_battery_profile_index;
+    uint8_t debug_mode;
+    uint8_t i2c_speed;
+    uint8_t cpuUnderclock;
+    uint8_t throttle_tilt_compensation_strength;
+    char name[16 + 1];
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint32_t preferred_beeper_off_flags;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+
+typedef struct adcChannelConfig_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} adcChannelConfig_t;
+
+extern adcChannelConfig_t adcChannelConfig_System; extern adcChannelConfig_t adcChannelConfig_Copy; static inline const adcChannelConfig_t* adcChannelConfig(void) { return &adcChannelConfig_System; } static inline adcChannelConfig_t* adcChannelConfigMutable(void) { return &adcChannelConfig_System; } struct _dummy;
+
+
+
+extern statsConfig_t statsConfig_System; extern statsConfig_t statsConfig_Copy; static inline const statsConfig_t* statsConfig(void) { return &statsConfig_System; } static inline statsConfig_t* statsConfigMutable(void) { return &statsConfig_System; } struct _dummy;
+
+
+void beeperOffSet(uint32_t mask);
+void beeperOffSetAll(uint8_t beeperCount);
+void beeperOffClear(uint32_t mask);
+void beeperOffClearAll(void);
+uint32_t getBeeperOffMask(void);
+void setBeeperOffMask(uint32_t mask);
+uint32_t getPreferredBeeperOffMask(void);
+void setPreferredBeeperOffMask(uint32_t mask);
+
+void copyCurrentProfileToProfileSlot(uint8_t profileSlotIndex);
+
+void initEEPROM(void);
+void resetEEPROM(void);
+void readEEPROM(void);
+void writeEEPROM(void);
+void ensureEEPROMContainsValidData(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixConfig(void);
+void validateAndFixTargetConfig(void);
+
+uint8_t getConfigProfile(void);
+
+# 124 "./src/main/fc/config.h" 3 4
+_Bool 
+# 124 "./src/main/fc/config.h"
+    setConfigProfile(uint8_t profileIndex);
+void setConfigProfileAndWriteEEPROM(uint8_t profileIndex);
+
+uint8_t getConfigBatteryProfile(void);
+
+# 128 "./src/main/fc/config.h" 3 4
+_Bool 
+# 128 "./src/main/fc/config.h"
+    setConfigBatteryProfile(uint8_t profileIndex);
+void setConfigBatteryProfileAndWriteEEPROM(uint8_t profileIndex);
+
+
+# 131 "./src/main/fc/config.h" 3 4
+_Bool 
+# 131 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+void applyAndSaveBoardAlignmentDelta(int16_t roll, int16_t pitch);
+
+void createDefaultConfig(void);
+void resetConfigs(void);
+void targetConfiguration(void);
+
+uint32_t getLooptime(void);
+uint32_t getGyroLooptime(void);
+# 61 "./src/main/cms/cms.c" 2
+# 1 "./src/main/fc/rc_controls.h" 1
+# 18 "./src/main/fc/rc_controls.h"
+       
+
+
+
+#define AIRMODE_THROTTLE_THRESHOLD 1300
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8,
+    AUX9,
+    AUX10,
+    AUX11,
+    AUX12
+} rc_alias_e;
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+typedef enum {
+    THROTTLE_STATUS_TYPE_RC = 0,
+    THROTTLE_STATUS_TYPE_COMMAND
+} throttleStatusType_e;
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    STICK_CENTER = 0,
+    THROTTLE_THRESHOLD
+} airmodeAndAntiWindupHandlingType_e;
+
+typedef enum {
+    ROL_LO = (1 << (2 * ROLL)),
+    ROL_CE = (3 << (2 * ROLL)),
+    ROL_HI = (2 << (2 * ROLL)),
+
+    PIT_LO = (1 << (2 * PITCH)),
+    PIT_CE = (3 << (2 * PITCH)),
+    PIT_HI = (2 << (2 * PITCH)),
+
+    YAW_LO = (1 << (2 * YAW)),
+    YAW_CE = (3 << (2 * YAW)),
+    YAW_HI = (2 << (2 * YAW)),
+
+    THR_LO = (1 << (2 * THROTTLE)),
+    THR_CE = (3 << (2 * THROTTLE)),
+    THR_HI = (2 << (2 * THROTTLE))
+} stickPositions_e;
+
+extern int16_t rcCommand[4];
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t pos_hold_deadband;
+    uint8_t alt_hold_deadband;
+    uint16_t mid_throttle_deadband;
+    uint8_t airmodeHandlingType;
+    uint16_t airmodeThrottleThreshold;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t fixed_wing_auto_arm;
+    uint8_t disarm_kill_switch;
+    uint16_t switchDisarmDelayMs;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+stickPositions_e getRcStickPositions(void);
+
+# 104 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 104 "./src/main/fc/rc_controls.h"
+    checkStickPosition(stickPositions_e stickPos);
+
+
+# 106 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 106 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+
+# 107 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 107 "./src/main/fc/rc_controls.h"
+    areSticksDeflectedMoreThanPosHoldDeadband(void);
+throttleStatus_e calculateThrottleStatus(throttleStatusType_e type);
+rollPitchStatus_e calculateRollPitchCenterStatus(void);
+void processRcStickPositions(throttleStatus_e throttleStatus);
+
+int32_t getRcStickDeflection(int32_t axis);
+# 62 "./src/main/cms/cms.c" 2
+# 1 "./src/main/fc/runtime_config.h" 1
+# 18 "./src/main/fc/runtime_config.h"
+       
+
+
+typedef enum {
+    ARMED = (1 << 2),
+    WAS_EVER_ARMED = (1 << 3),
+
+    ARMING_DISABLED_FAILSAFE_SYSTEM = (1 << 7),
+
+    ARMING_DISABLED_NOT_LEVEL = (1 << 8),
+    ARMING_DISABLED_SENSORS_CALIBRATING = (1 << 9),
+    ARMING_DISABLED_SYSTEM_OVERLOADED = (1 << 10),
+    ARMING_DISABLED_NAVIGATION_UNSAFE = (1 << 11),
+    ARMING_DISABLED_COMPASS_NOT_CALIBRATED = (1 << 12),
+    ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED = (1 << 13),
+    ARMING_DISABLED_ARM_SWITCH = (1 << 14),
+    ARMING_DISABLED_HARDWARE_FAILURE = (1 << 15),
+    ARMING_DISABLED_BOXFAILSAFE = (1 << 16),
+    ARMING_DISABLED_BOXKILLSWITCH = (1 << 17),
+    ARMING_DISABLED_RC_LINK = (1 << 18),
+    ARMING_DISABLED_THROTTLE = (1 << 19),
+    ARMING_DISABLED_CLI = (1 << 20),
+    ARMING_DISABLED_CMS_MENU = (1 << 21),
+    ARMING_DISABLED_OSD_MENU = (1 << 22),
+    ARMING_DISABLED_ROLLPITCH_NOT_CENTERED = (1 << 23),
+    ARMING_DISABLED_SERVO_AUTOTRIM = (1 << 24),
+    ARMING_DISABLED_OOM = (1 << 25),
+    ARMING_DISABLED_INVALID_SETTING = (1 << 26),
+    ARMING_DISABLED_PWM_OUTPUT_ERROR = (1 << 27),
+
+    ARMING_DISABLED_ALL_FLAGS = (ARMING_DISABLED_FAILSAFE_SYSTEM | ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_SENSORS_CALIBRATING |
+                                                       ARMING_DISABLED_SYSTEM_OVERLOADED | ARMING_DISABLED_NAVIGATION_UNSAFE |
+                                                       ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED |
+                                                       ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE | ARMING_DISABLED_BOXFAILSAFE |
+                                                       ARMING_DISABLED_BOXKILLSWITCH | ARMING_DISABLED_RC_LINK | ARMING_DISABLED_THROTTLE | ARMING_DISABLED_CLI |
+                                                       ARMING_DISABLED_CMS_MENU | ARMING_DISABLED_OSD_MENU | ARMING_DISABLED_ROLLPITCH_NOT_CENTERED |
+                                                       ARMING_DISABLED_SERVO_AUTOTRIM | ARMING_DISABLED_OOM | ARMING_DISABLED_INVALID_SETTING |
+                                                       ARMING_DISABLED_PWM_OUTPUT_ERROR),
+} armingFlag_e;
+
+
+
+
+
+
+#define ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)
+
+
+
+
+
+
+
+extern uint32_t armingFlags;
+
+extern const char *armingDisableFlagNames[];
+
+#define isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))
+#define DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))
+#define ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))
+#define ARMING_FLAG(mask) (armingFlags & (mask))
+
+
+
+armingFlag_e isArmingDisabledReason(void);
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    HEADING_MODE = (1 << 2),
+    NAV_ALTHOLD_MODE= (1 << 3),
+    NAV_RTH_MODE = (1 << 4),
+    NAV_POSHOLD_MODE= (1 << 5),
+    HEADFREE_MODE = (1 << 6),
+    NAV_LAUNCH_MODE = (1 << 7),
+    MANUAL_MODE = (1 << 8),
+    FAILSAFE_MODE = (1 << 9),
+    AUTO_TUNE = (1 << 10),
+    NAV_WP_MODE = (1 << 11),
+    NAV_CRUISE_MODE = (1 << 12),
+    FLAPERON = (1 << 13),
+    TURN_ASSISTANT = (1 << 14),
+} flightModeFlags_e;
+
+extern uint32_t flightModeFlags;
+
+#define DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)
+#define ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)
+#define FLIGHT_MODE(mask) (flightModeFlags & (mask))
+
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING_LEGACY = (1 << 4),
+    ANTI_WINDUP = (1 << 5),
+    FLAPERON_AVAILABLE = (1 << 6),
+    NAV_MOTOR_STOP_OR_IDLE = (1 << 7),
+    COMPASS_CALIBRATED = (1 << 8),
+    ACCELEROMETER_CALIBRATED = (1 << 9),
+    PWM_DRIVER_AVAILABLE = (1 << 10),
+    NAV_CRUISE_BRAKING = (1 << 11),
+    NAV_CRUISE_BRAKING_BOOST = (1 << 12),
+    NAV_CRUISE_BRAKING_LOCKED = (1 << 13),
+    NAV_EXTRA_ARMING_SAFETY_BYPASSED = (1 << 14),
+    AIRMODE_ACTIVE = (1 << 15),
+    ESC_SENSOR_ENABLED = (1 << 16),
+    AIRPLANE = (1 << 17),
+    MULTIROTOR = (1 << 18),
+    ROVER = (1 << 19),
+    BOAT = (1 << 20),
+    ALTITUDE_CONTROL = (1 << 21),
+    MOVE_FORWARD_ONLY = (1 << 22),
+    SET_REVERSIBLE_MOTORS_FORWARD = (1 << 23),
+    FW_HEADING_USE_YAW = (1 << 24),
+} stateFlags_t;
+
+#define DISABLE_STATE(mask) (stateFlags &= ~(mask))
+#define ENABLE_STATE(mask) (stateFlags |= (mask))
+#define STATE(mask) (stateFlags & (mask))
+
+extern uint32_t stateFlags;
+
+typedef enum {
+    FLM_MANUAL,
+    FLM_ACRO,
+    FLM_ACRO_AIR,
+    FLM_ANGLE,
+    FLM_HORIZON,
+    FLM_ALTITUDE_HOLD,
+    FLM_POSITION_HOLD,
+    FLM_RTH,
+    FLM_MISSION,
+    FLM_CRUISE,
+    FLM_LAUNCH,
+    FLM_FAILSAFE,
+    FLM_COUNT
+} flightModeForTelemetry_e;
+
+flightModeForTelemetry_e getFlightModeForTelemetry(void);
+
+uint32_t enableFlightMode(flightModeFlags_e mask);
+uint32_t disableFlightMode(flightModeFlags_e mask);
+
+
+# 163 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 163 "./src/main/fc/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+# 63 "./src/main/cms/cms.c" 2
+# 1 "./src/main/fc/settings.h" 1
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 5 "./src/main/fc/settings.h" 2
+
+
+
+
+# 1 "./obj/main/SITL/settings_generated.h" 1
+
+
+
+       
+#define SETTING_MAX_NAME_LENGTH 37
+#define SETTING_MAX_WORD_LENGTH 37
+#define SETTING_ENCODED_NAME_MAX_BYTES 5
+#define SETTINGS_WORDS_BITS_PER_CHAR 5
+#define SETTINGS_TABLE_COUNT 379
+typedef uint8_t setting_offset_t;
+#define SETTINGS_PGN_COUNT 36
+typedef int16_t setting_min_t;
+typedef uint32_t setting_max_t;
+#define SETTING_MIN_MAX_INDEX_BYTES 2
+enum {
+ TABLE_ACC_HARDWARE,
+ TABLE_AIRMODEHANDLINGTYPE,
+ TABLE_ALIGNMENT,
+ TABLE_AUX_OPERATOR,
+ TABLE_BARO_HARDWARE,
+ TABLE_BAT_CAPACITY_UNIT,
+ TABLE_BAT_VOLTAGE_SOURCE,
+ TABLE_BLACKBOX_COMPRESSION,
+ TABLE_BLACKBOX_DEVICE,
+ TABLE_CURRENT_SENSOR,
+ TABLE_DEBUG_MODES,
+ TABLE_DIRECTION,
+ TABLE_FAILSAFE_PROCEDURE,
+ TABLE_FILTER_TYPE,
+ TABLE_FRSKY_UNIT,
+ TABLE_GPS_DYN_MODEL,
+ TABLE_GPS_PROVIDER,
+ TABLE_GPS_SBAS_MODE,
+ TABLE_GYRO_LPF,
+ TABLE_ITERM_RELAX,
+ TABLE_ITERM_RELAX_TYPE,
+ TABLE_LOG_LEVEL,
+ TABLE_LTM_RATES,
+ TABLE_MAG_HARDWARE,
+ TABLE_MOTOR_PWM_PROTOCOL,
+ TABLE_NAV_EXTRA_ARMING_SAFETY,
+ TABLE_NAV_RTH_ALLOW_LANDING,
+ TABLE_NAV_RTH_ALT_MODE,
+ TABLE_NAV_USER_CONTROL_MODE,
+ TABLE_OFF_ON,
+ TABLE_OPFLOW_HARDWARE,
+ TABLE_PIDTYPETABLE,
+ TABLE_PITOT_HARDWARE,
+ TABLE_PLATFORM_TYPE,
+ TABLE_RECEIVER_TYPE,
+ TABLE_RESET_TYPE,
+ TABLE_RSSI_SOURCE,
+ TABLE_SERIAL_RX,
+ TABLE_SERVO_PROTOCOL,
+ TABLE_SMARTPORT_FUEL_UNIT,
+ TABLE_TZ_AUTOMATIC_DST,
+ TABLE_VOLTAGE_SENSOR,
+ TABLE_VTX_LOW_POWER_DISARM,
+ LOOKUP_TABLE_COUNT,
+};
+extern const char * const table_acc_hardware[];
+extern const char * const table_airmodeHandlingType[];
+extern const char * const table_alignment[];
+extern const char * const table_aux_operator[];
+extern const char * const table_baro_hardware[];
+extern const char * const table_bat_capacity_unit[];
+extern const char * const table_bat_voltage_source[];
+extern const char * const table_blackbox_compression[];
+extern const char * const table_blackbox_device[];
+extern const char * const table_current_sensor[];
+extern const char * const table_debug_modes[];
+extern const char * const table_direction[];
+extern const char * const table_failsafe_procedure[];
+extern const char * const table_filter_type[];
+extern const char * const table_frsky_unit[];
+extern const char * const table_gps_dyn_model[];
+extern const char * const table_gps_provider[];
+extern const char * const table_gps_sbas_mode[];
+extern const char * const table_gyro_lpf[];
+extern const char * const table_iterm_relax[];
+extern const char * const table_iterm_relax_type[];
+extern const char * const table_log_level[];
+extern const char * const table_ltm_rates[];
+extern const char * const table_mag_hardware[];
+extern const char * const table_motor_pwm_protocol[];
+extern const char * const table_nav_extra_arming_safety[];
+extern const char * const table_nav_rth_allow_landing[];
+extern const char * const table_nav_rth_alt_mode[];
+extern const char * const table_nav_user_control_mode[];
+extern const char * const table_off_on[];
+extern const char * const table_opflow_hardware[];
+extern const char * const table_pidTypeTable[];
+extern const char * const table_pitot_hardware[];
+extern const char * const table_platform_type[];
+extern const char * const table_receiver_type[];
+extern const char * const table_reset_type[];
+extern const char * const table_rssi_source[];
+extern const char * const table_serial_rx[];
+extern const char * const table_servo_protocol[];
+extern const char * const table_smartport_fuel_unit[];
+extern const char * const table_tz_automatic_dst[];
+extern const char * const table_voltage_sensor[];
+extern const char * const table_vtx_low_power_disarm[];
+#define SETTING_LOOPTIME 0
+#define SETTING_LOOPTIME_MIN 0
+#define SETTING_LOOPTIME_MAX 9000
+#define SETTING_GYRO_SYNC 1
+#define SETTING_GYRO_SYNC_MIN 0
+#define SETTING_GYRO_SYNC_MAX 0
+#define SETTING_PID_PROCESS_DENOM 2
+#define SETTING_PID_PROCESS_DENOM_MIN 1
+#define SETTING_PID_PROCESS_DENOM_MAX 8
+#define SETTING_ALIGN_GYRO 3
+#define SETTING_ALIGN_GYRO_MIN 0
+#define SETTING_ALIGN_GYRO_MAX 0
+#define SETTING_GYRO_HARDWARE_LPF 4
+#define SETTING_GYRO_HARDWARE_LPF_MIN 0
+#define SETTING_GYRO_HARDWARE_LPF_MAX 0
+#define SETTING_GYRO_LPF_HZ 5
+#define SETTING_GYRO_LPF_HZ_MIN 0
+#define SETTING_GYRO_LPF_HZ_MAX 200
+#define SETTING_GYRO_LPF_TYPE 6
+#define SETTING_GYRO_LPF_TYPE_MIN 0
+#define SETTING_GYRO_LPF_TYPE_MAX 0
+#define SETTING_MORON_THRESHOLD 7
+#define SETTING_MORON_THRESHOLD_MIN 0
+#define SETTING_MORON_THRESHOLD_MAX 128
+#define SETTING_GYRO_NOTCH_HZ 8
+#define SETTING_GYRO_NOTCH_HZ_MIN 0
+#define SETTING_GYRO_NOTCH_HZ_MAX 500
+#define SETTING_GYRO_NOTCH_CUTOFF 9
+#define SETTING_GYRO_NOTCH_CUTOFF_MIN 1
+#define SETTING_GYRO_NOTCH_CUTOFF_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ 10
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE 11
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0
+#define SETTING_GYRO_KALMAN_ENABLED 12
+#define SETTING_GYRO_KALMAN_ENABLED_MIN 0
+#define SETTING_GYRO_KALMAN_ENABLED_MAX 0
+#define SETTING_GYRO_KALMAN_Q 13
+#define SETTING_GYRO_KALMAN_Q_MIN 1
+#define SETTING_GYRO_KALMAN_Q_MAX 16000
+#define SETTING_GYRO_KALMAN_W 14
+#define SETTING_GYRO_KALMAN_W_MIN 1
+#define SETTING_GYRO_KALMAN_W_MAX 40
+#define SETTING_GYRO_KALMAN_SHARPNESS 15
+#define SETTING_GYRO_KALMAN_SHARPNESS_MIN 1
+#define SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000
+#define SETTING_ACC_NOTCH_HZ 16
+#define SETTING_ACC_NOTCH_HZ_MIN 0
+#define SETTING_ACC_NOTCH_HZ_MAX 255
+#define SETTING_ACC_NOTCH_CUTOFF 17
+#define SETTING_ACC_NOTCH_CUTOFF_MIN 1
+#define SETTING_ACC_NOTCH_CUTOFF_MAX 255
+#define SETTING_ALIGN_ACC 18
+#define SETTING_ALIGN_ACC_MIN 0
+#define SETTING_ALIGN_ACC_MAX 0
+#define SETTING_ACC_HARDWARE 19
+#define SETTING_ACC_HARDWARE_MIN 0
+#define SETTING_ACC_HARDWARE_MAX 0
+#define SETTING_ACC_LPF_HZ 20
+#define SETTING_ACC_LPF_HZ_MIN 0
+#define SETTING_ACC_LPF_HZ_MAX 200
+#define SETTING_ACC_LPF_TYPE 21
+#define SETTING_ACC_LPF_TYPE_MIN 0
+#define SETTING_ACC_LPF_TYPE_MAX 0
+#define SETTING_ACCZERO_X 22
+#define SETTING_ACCZERO_X_MIN -32768
+#define SETTING_ACCZERO_X_MAX 32767
+#define SETTING_ACCZERO_Y 23
+#define SETTING_ACCZERO_Y_MIN -32768
+#define SETTING_ACCZERO_Y_MAX 32767
+#define SETTING_ACCZERO_Z 24
+#define SETTING_ACCZERO_Z_MIN -32768
+#define SETTING_ACCZERO_Z_MAX 32767
+#define SETTING_ACCGAIN_X 25
+#define SETTING_ACCGAIN_X_MIN 1
+#define SETTING_ACCGAIN_X_MAX 8192
+#define SETTING_ACCGAIN_Y 26
+#define SETTING_ACCGAIN_Y_MIN 1
+#define SETTING_ACCGAIN_Y_MAX 8192
+#define SETTING_ACCGAIN_Z 27
+#define SETTING_ACCGAIN_Z_MIN 1
+#define SETTING_ACCGAIN_Z_MAX 8192
+#define SETTING_OPFLOW_HARDWARE 28
+#define SETTING_OPFLOW_HARDWARE_MIN 0
+#define SETTING_OPFLOW_HARDWARE_MAX 0
+#define SETTING_OPFLOW_SCALE 29
+#define SETTING_OPFLOW_SCALE_MIN 0
+#define SETTING_OPFLOW_SCALE_MAX 10000
+#define SETTING_ALIGN_OPFLOW 30
+#define SETTING_ALIGN_OPFLOW_MIN 0
+#define SETTING_ALIGN_OPFLOW_MAX 0
+#define SETTING_ALIGN_MAG 31
+#define SETTING_ALIGN_MAG_MIN 0
+#define SETTING_ALIGN_MAG_MAX 0
+#define SETTING_MAG_HARDWARE 32
+#define SETTING_MAG_HARDWARE_MIN 0
+#define SETTING_MAG_HARDWARE_MAX 0
+#define SETTING_MAG_DECLINATION 33
+#define SETTING_MAG_DECLINATION_MIN -18000
+#define SETTING_MAG_DECLINATION_MAX 18000
+#define SETTING_MAGZERO_X 34
+#define SETTING_MAGZERO_X_MIN -32768
+#define SETTING_MAGZERO_X_MAX 32767
+#define SETTING_MAGZERO_Y 35
+#define SETTING_MAGZERO_Y_MIN -32768
+#define SETTING_MAGZERO_Y_MAX 32767
+#define SETTING_MAGZERO_Z 36
+#define SETTING_MAGZERO_Z_MIN -32768
+#define SETTING_MAGZERO_Z_MAX 32767
+#define SETTING_MAG_CALIBRATION_TIME 37
+#define SETTING_MAG_CALIBRATION_TIME_MIN 30
+#define SETTING_MAG_CALIBRATION_TIME_MAX 120
+#define SETTING_ALIGN_MAG_ROLL 38
+#define SETTING_ALIGN_MAG_ROLL_MIN -1800
+#define SETTING_ALIGN_MAG_ROLL_MAX 3600
+#define SETTING_ALIGN_MAG_PITCH 39
+#define SETTING_ALIGN_MAG_PITCH_MIN -1800
+#define SETTING_ALIGN_MAG_PITCH_MAX 3600
+#define SETTING_ALIGN_MAG_YAW 40
+#define SETTING_ALIGN_MAG_YAW_MIN -1800
+#define SETTING_ALIGN_MAG_YAW_MAX 3600
+#define SETTING_BARO_HARDWARE 41
+#define SETTING_BARO_HARDWARE_MIN 0
+#define SETTING_BARO_HARDWARE_MAX 0
+#define SETTING_BARO_MEDIAN_FILTER 42
+#define SETTING_BARO_MEDIAN_FILTER_MIN 0
+#define SETTING_BARO_MEDIAN_FILTER_MAX 0
+#define SETTING_BARO_CAL_TOLERANCE 43
+#define SETTING_BARO_CAL_TOLERANCE_MIN 0
+#define SETTING_BARO_CAL_TOLERANCE_MAX 1000
+#define SETTING_PITOT_HARDWARE 44
+#define SETTING_PITOT_HARDWARE_MIN 0
+#define SETTING_PITOT_HARDWARE_MAX 0
+#define SETTING_PITOT_LPF_MILLI_HZ 45
+#define SETTING_PITOT_LPF_MILLI_HZ_MIN 0
+#define SETTING_PITOT_LPF_MILLI_HZ_MAX 10000
+#define SETTING_PITOT_SCALE 46
+#define SETTING_PITOT_SCALE_MIN 0
+#define SETTING_PITOT_SCALE_MAX 100
+#define SETTING_RECEIVER_TYPE 47
+#define SETTING_RECEIVER_TYPE_MIN 0
+#define SETTING_RECEIVER_TYPE_MAX 0
+#define SETTING_MIN_CHECK 48
+#define SETTING_MIN_CHECK_MIN 1000
+#define SETTING_MIN_CHECK_MAX 2000
+#define SETTING_MAX_CHECK 49
+#define SETTING_MAX_CHECK_MIN 1000
+#define SETTING_MAX_CHECK_MAX 2000
+#define SETTING_RSSI_SOURCE 50
+#define SETTING_RSSI_SOURCE_MIN 0
+#define SETTING_RSSI_SOURCE_MAX 0
+#define SETTING_RSSI_CHANNEL 51
+#define SETTING_RSSI_CHANNEL_MIN 0
+#define SETTING_RSSI_CHANNEL_MAX 18
+#define SETTING_RSSI_MIN 52
+#define SETTING_RSSI_MIN_MIN 0
+#define SETTING_RSSI_MIN_MAX 100
+#define SETTING_RSSI_MAX 53
+#define SETTING_RSSI_MAX_MIN 0
+#define SETTING_RSSI_MAX_MAX 100
+#define SETTING_SBUS_SYNC_INTERVAL 54
+#define SETTING_SBUS_SYNC_INTERVAL_MIN 500
+#define SETTING_SBUS_SYNC_INTERVAL_MAX 10000
+#define SETTING_RC_FILTER_FREQUENCY 55
+#define SETTING_RC_FILTER_FREQUENCY_MIN 0
+#define SETTING_RC_FILTER_FREQUENCY_MAX 100
+#define SETTING_SERIALRX_PROVIDER 56
+#define SETTING_SERIALRX_PROVIDER_MIN 0
+#define SETTING_SERIALRX_PROVIDER_MAX 0
+#define SETTING_SERIALRX_INVERTED 57
+#define SETTING_SERIALRX_INVERTED_MIN 0
+#define SETTING_SERIALRX_INVERTED_MAX 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT 58
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8
+#define SETTING_RX_MIN_USEC 59
+#define SETTING_RX_MIN_USEC_MIN 750
+#define SETTING_RX_MIN_USEC_MAX 2250
+#define SETTING_RX_MAX_USEC 60
+#define SETTING_RX_MAX_USEC_MIN 750
+#define SETTING_RX_MAX_USEC_MAX 2250
+#define SETTING_SERIALRX_HALFDUPLEX 61
+#define SETTING_SERIALRX_HALFDUPLEX_MIN 0
+#define SETTING_SERIALRX_HALFDUPLEX_MAX 0
+#define SETTING_BLACKBOX_RATE_NUM 62
+#define SETTING_BLACKBOX_RATE_NUM_MIN 1
+#define SETTING_BLACKBOX_RATE_NUM_MAX 65535
+#define SETTING_BLACKBOX_RATE_DENOM 63
+#define SETTING_BLACKBOX_RATE_DENOM_MIN 1
+#define SETTING_BLACKBOX_RATE_DENOM_MAX 65535
+#define SETTING_BLACKBOX_DEVICE 64
+#define SETTING_BLACKBOX_DEVICE_MIN 0
+#define SETTING_BLACKBOX_DEVICE_MAX 0
+#define SETTING_BLACKBOX_COMPRESSION 65
+#define SETTING_BLACKBOX_COMPRESSION_MIN 0
+#define SETTING_BLACKBOX_COMPRESSION_MAX 0
+#define SETTING_MAX_THROTTLE 66
+#define SETTING_MAX_THROTTLE_MIN 1000
+#define SETTING_MAX_THROTTLE_MAX 2000
+#define SETTING_MIN_COMMAND 67
+#define SETTING_MIN_COMMAND_MIN 0
+#define SETTING_MIN_COMMAND_MAX 2000
+#define SETTING_MOTOR_PWM_RATE 68
+#define SETTING_MOTOR_PWM_RATE_MIN 50
+#define SETTING_MOTOR_PWM_RATE_MAX 32000
+#define SETTING_MOTOR_ACCEL_TIME 69
+#define SETTING_MOTOR_ACCEL_TIME_MIN 0
+#define SETTING_MOTOR_ACCEL_TIME_MAX 1000
+#define SETTING_MOTOR_DECEL_TIME 70
+#define SETTING_MOTOR_DECEL_TIME_MIN 0
+#define SETTING_MOTOR_DECEL_TIME_MAX 1000
+#define SETTING_MOTOR_PWM_PROTOCOL 71
+#define SETTING_MOTOR_PWM_PROTOCOL_MIN 0
+#define SETTING_MOTOR_PWM_PROTOCOL_MAX 0
+#define SETTING_THROTTLE_SCALE 72
+#define SETTING_THROTTLE_SCALE_MIN 0
+#define SETTING_THROTTLE_SCALE_MAX 1
+#define SETTING_THROTTLE_IDLE 73
+#define SETTING_THROTTLE_IDLE_MIN 4
+#define SETTING_THROTTLE_IDLE_MAX 30
+#define SETTING_MOTOR_POLES 74
+#define SETTING_MOTOR_POLES_MIN 4
+#define SETTING_MOTOR_POLES_MAX 255
+#define SETTING_FAILSAFE_DELAY 75
+#define SETTING_FAILSAFE_DELAY_MIN 0
+#define SETTING_FAILSAFE_DELAY_MAX 200
+#define SETTING_FAILSAFE_RECOVERY_DELAY 76
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200
+#define SETTING_FAILSAFE_OFF_DELAY 77
+#define SETTING_FAILSAFE_OFF_DELAY_MIN 0
+#define SETTING_FAILSAFE_OFF_DELAY_MAX 200
+#define SETTING_FAILSAFE_THROTTLE 78
+#define SETTING_FAILSAFE_THROTTLE_MIN 1000
+#define SETTING_FAILSAFE_THROTTLE_MAX 2000
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300
+#define SETTING_FAILSAFE_PROCEDURE 80
+#define SETTING_FAILSAFE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD 81
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE 82
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE 83
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_YAW_RATE 84
+#define SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000
+#define SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000
+#define SETTING_FAILSAFE_MIN_DISTANCE 85
+#define SETTING_FAILSAFE_MIN_DISTANCE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_MISSION 87
+#define SETTING_FAILSAFE_MISSION_MIN 0
+#define SETTING_FAILSAFE_MISSION_MAX 0
+#define SETTING_ALIGN_BOARD_ROLL 88
+#define SETTING_ALIGN_BOARD_ROLL_MIN -1800
+#define SETTING_ALIGN_BOARD_ROLL_MAX 3600
+#define SETTING_ALIGN_BOARD_PITCH 89
+#define SETTING_ALIGN_BOARD_PITCH_MIN -1800
+#define SETTING_ALIGN_BOARD_PITCH_MAX 3600
+#define SETTING_ALIGN_BOARD_YAW 90
+#define SETTING_ALIGN_BOARD_YAW_MIN -1800
+#define SETTING_ALIGN_BOARD_YAW_MAX 3600
+#define SETTING_VBAT_METER_TYPE 91
+#define SETTING_VBAT_METER_TYPE_MIN 0
+#define SETTING_VBAT_METER_TYPE_MAX 0
+#define SETTING_CURRENT_METER_SCALE 92
+#define SETTING_CURRENT_METER_SCALE_MIN -10000
+#define SETTING_CURRENT_METER_SCALE_MAX 10000
+#define SETTING_CURRENT_METER_OFFSET 93
+#define SETTING_CURRENT_METER_OFFSET_MIN -32768
+#define SETTING_CURRENT_METER_OFFSET_MAX 32767
+#define SETTING_CURRENT_METER_TYPE 94
+#define SETTING_CURRENT_METER_TYPE_MIN 0
+#define SETTING_CURRENT_METER_TYPE_MAX 0
+#define SETTING_BAT_VOLTAGE_SRC 95
+#define SETTING_BAT_VOLTAGE_SRC_MIN 0
+#define SETTING_BAT_VOLTAGE_SRC_MAX 0
+#define SETTING_CRUISE_POWER 96
+#define SETTING_CRUISE_POWER_MIN 0
+#define SETTING_CRUISE_POWER_MAX 4294967295
+#define SETTING_IDLE_POWER 97
+#define SETTING_IDLE_POWER_MIN 0
+#define SETTING_IDLE_POWER_MAX 65535
+#define SETTING_RTH_ENERGY_MARGIN 98
+#define SETTING_RTH_ENERGY_MARGIN_MIN 0
+#define SETTING_RTH_ENERGY_MARGIN_MAX 100
+#define SETTING_THR_COMP_WEIGHT 99
+#define SETTING_THR_COMP_WEIGHT_MIN 0
+#define SETTING_THR_COMP_WEIGHT_MAX 2
+#define SETTING_BATTERY_CAPACITY 100
+#define SETTING_BATTERY_CAPACITY_MIN 0
+#define SETTING_BATTERY_CAPACITY_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_WARNING 101
+#define SETTING_BATTERY_CAPACITY_WARNING_MIN 0
+#define SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_CRITICAL 102
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_UNIT 103
+#define SETTING_BATTERY_CAPACITY_UNIT_MIN 0
+#define SETTING_BATTERY_CAPACITY_UNIT_MAX 0
+#define SETTING_MOTOR_DIRECTION_INVERTED 104
+#define SETTING_MOTOR_DIRECTION_INVERTED_MIN 0
+#define SETTING_MOTOR_DIRECTION_INVERTED_MAX 0
+#define SETTING_PLATFORM_TYPE 105
+#define SETTING_PLATFORM_TYPE_MIN 0
+#define SETTING_PLATFORM_TYPE_MAX 0
+#define SETTING_HAS_FLAPS 106
+#define SETTING_HAS_FLAPS_MIN 0
+#define SETTING_HAS_FLAPS_MAX 0
+#define SETTING_MODEL_PREVIEW_TYPE 107
+#define SETTING_MODEL_PREVIEW_TYPE_MIN -1
+#define SETTING_MODEL_PREVIEW_TYPE_MAX 32767
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450
+#define SETTING_3D_DEADBAND_LOW 109
+#define SETTING_3D_DEADBAND_LOW_MIN 1000
+#define SETTING_3D_DEADBAND_LOW_MAX 2000
+#define SETTING_3D_DEADBAND_HIGH 110
+#define SETTING_3D_DEADBAND_HIGH_MIN 1000
+#define SETTING_3D_DEADBAND_HIGH_MAX 2000
+#define SETTING_3D_NEUTRAL 111
+#define SETTING_3D_NEUTRAL_MIN 1000
+#define SETTING_3D_NEUTRAL_MAX 2000
+#define SETTING_SERVO_PROTOCOL 112
+#define SETTING_SERVO_PROTOCOL_MIN 0
+#define SETTING_SERVO_PROTOCOL_MAX 0
+#define SETTING_SERVO_CENTER_PULSE 113
+#define SETTING_SERVO_CENTER_PULSE_MIN 1000
+#define SETTING_SERVO_CENTER_PULSE_MAX 2000
+#define SETTING_SERVO_PWM_RATE 114
+#define SETTING_SERVO_PWM_RATE_MIN 50
+#define SETTING_SERVO_PWM_RATE_MAX 498
+#define SETTING_SERVO_LPF_HZ 115
+#define SETTING_SERVO_LPF_HZ_MIN 0
+#define SETTING_SERVO_LPF_HZ_MAX 400
+#define SETTING_FLAPERON_THROW_OFFSET 116
+#define SETTING_FLAPERON_THROW_OFFSET_MIN 50
+#define SETTING_FLAPERON_THROW_OFFSET_MAX 450
+#define SETTING_TRI_UNARMED_SERVO 117
+#define SETTING_TRI_UNARMED_SERVO_MIN 0
+#define SETTING_TRI_UNARMED_SERVO_MAX 0
+#define SETTING_THR_MID 118
+#define SETTING_THR_MID_MIN 0
+#define SETTING_THR_MID_MAX 100
+#define SETTING_THR_EXPO 119
+#define SETTING_THR_EXPO_MIN 0
+#define SETTING_THR_EXPO_MAX 100
+#define SETTING_TPA_RATE 120
+#define SETTING_TPA_RATE_MIN 0
+#define SETTING_TPA_RATE_MAX 100
+#define SETTING_TPA_BREAKPOINT 121
+#define SETTING_TPA_BREAKPOINT_MIN 1000
+#define SETTING_TPA_BREAKPOINT_MAX 2000
+#define SETTING_FW_TPA_TIME_CONSTANT 122
+#define SETTING_FW_TPA_TIME_CONSTANT_MIN 0
+#define SETTING_FW_TPA_TIME_CONSTANT_MAX 5000
+#define SETTING_RC_EXPO 123
+#define SETTING_RC_EXPO_MIN 0
+#define SETTING_RC_EXPO_MAX 100
+#define SETTING_RC_YAW_EXPO 124
+#define SETTING_RC_YAW_EXPO_MIN 0
+#define SETTING_RC_YAW_EXPO_MAX 100
+#define SETTING_ROLL_RATE 125
+#define SETTING_ROLL_RATE_MIN 6
+#define SETTING_ROLL_RATE_MAX 180
+#define SETTING_PITCH_RATE 126
+#define SETTING_PITCH_RATE_MIN 6
+#define SETTING_PITCH_RATE_MAX 180
+#define SETTING_YAW_RATE 127
+#define SETTING_YAW_RATE_MIN 2
+#define SETTING_YAW_RATE_MAX 180
+#define SETTING_MANUAL_RC_EXPO 128
+#define SETTING_MANUAL_RC_EXPO_MIN 0
+#define SETTING_MANUAL_RC_EXPO_MAX 100
+#define SETTING_MANUAL_RC_YAW_EXPO 129
+#define SETTING_MANUAL_RC_YAW_EXPO_MIN 0
+#define SETTING_MANUAL_RC_YAW_EXPO_MAX 100
+#define SETTING_MANUAL_ROLL_RATE 130
+#define SETTING_MANUAL_ROLL_RATE_MIN 0
+#define SETTING_MANUAL_ROLL_RATE_MAX 100
+#define SETTING_MANUAL_PITCH_RATE 131
+#define SETTING_MANUAL_PITCH_RATE_MIN 0
+#define SETTING_MANUAL_PITCH_RATE_MAX 100
+#define SETTING_MANUAL_YAW_RATE 132
+#define SETTING_MANUAL_YAW_RATE_MIN 0
+#define SETTING_MANUAL_YAW_RATE_MAX 100
+#define SETTING_FPV_MIX_DEGREES 133
+#define SETTING_FPV_MIX_DEGREES_MIN 0
+#define SETTING_FPV_MIX_DEGREES_MAX 50
+#define SETTING_REBOOT_CHARACTER 134
+#define SETTING_REBOOT_CHARACTER_MIN 48
+#define SETTING_REBOOT_CHARACTER_MAX 126
+#define SETTING_IMU_DCM_KP 135
+#define SETTING_IMU_DCM_KP_MIN 0
+#define SETTING_IMU_DCM_KP_MAX 65535
+#define SETTING_IMU_DCM_KI 136
+#define SETTING_IMU_DCM_KI_MIN 0
+#define SETTING_IMU_DCM_KI_MAX 65535
+#define SETTING_IMU_DCM_KP_MAG 137
+#define SETTING_IMU_DCM_KP_MAG_MIN 0
+#define SETTING_IMU_DCM_KP_MAG_MAX 65535
+#define SETTING_IMU_DCM_KI_MAG 138
+#define SETTING_IMU_DCM_KI_MAG_MIN 0
+#define SETTING_IMU_DCM_KI_MAG_MAX 65535
+#define SETTING_SMALL_ANGLE 139
+#define SETTING_SMALL_ANGLE_MIN 0
+#define SETTING_SMALL_ANGLE_MAX 180
+#define SETTING_IMU_ACC_IGNORE_RATE 140
+#define SETTING_IMU_ACC_IGNORE_RATE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_RATE_MAX 20
+#define SETTING_IMU_ACC_IGNORE_SLOPE 141
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5
+#define SETTING_FIXED_WING_AUTO_ARM 142
+#define SETTING_FIXED_WING_AUTO_ARM_MIN 0
+#define SETTING_FIXED_WING_AUTO_ARM_MAX 0
+#define SETTING_DISARM_KILL_SWITCH 143
+#define SETTING_DISARM_KILL_SWITCH_MIN 0
+#define SETTING_DISARM_KILL_SWITCH_MAX 0
+#define SETTING_SWITCH_DISARM_DELAY 144
+#define SETTING_SWITCH_DISARM_DELAY_MIN 0
+#define SETTING_SWITCH_DISARM_DELAY_MAX 1000
+#define SETTING_APPLIED_DEFAULTS 145
+#define SETTING_APPLIED_DEFAULTS_MIN 0
+#define SETTING_APPLIED_DEFAULTS_MAX 3
+#define SETTING_GPS_PROVIDER 146
+#define SETTING_GPS_PROVIDER_MIN 0
+#define SETTING_GPS_PROVIDER_MAX 0
+#define SETTING_GPS_SBAS_MODE 147
+#define SETTING_GPS_SBAS_MODE_MIN 0
+#define SETTING_GPS_SBAS_MODE_MAX 0
+#define SETTING_GPS_DYN_MODEL 148
+#define SETTING_GPS_DYN_MODEL_MIN 0
+#define SETTING_GPS_DYN_MODEL_MAX 0
+#define SETTING_GPS_AUTO_CONFIG 149
+#define SETTING_GPS_AUTO_CONFIG_MIN 0
+#define SETTING_GPS_AUTO_CONFIG_MAX 0
+#define SETTING_GPS_AUTO_BAUD 150
+#define SETTING_GPS_AUTO_BAUD_MIN 0
+#define SETTING_GPS_AUTO_BAUD_MAX 0
+#define SETTING_GPS_UBLOX_USE_GALILEO 151
+#define SETTING_GPS_UBLOX_USE_GALILEO_MIN 0
+#define SETTING_GPS_UBLOX_USE_GALILEO_MAX 0
+#define SETTING_GPS_MIN_SATS 152
+#define SETTING_GPS_MIN_SATS_MIN 5
+#define SETTING_GPS_MIN_SATS_MAX 10
+#define SETTING_DEADBAND 153
+#define SETTING_DEADBAND_MIN 0
+#define SETTING_DEADBAND_MAX 32
+#define SETTING_YAW_DEADBAND 154
+#define SETTING_YAW_DEADBAND_MIN 0
+#define SETTING_YAW_DEADBAND_MAX 100
+#define SETTING_POS_HOLD_DEADBAND 155
+#define SETTING_POS_HOLD_DEADBAND_MIN 2
+#define SETTING_POS_HOLD_DEADBAND_MAX 250
+#define SETTING_ALT_HOLD_DEADBAND 156
+#define SETTING_ALT_HOLD_DEADBAND_MIN 10
+#define SETTING_ALT_HOLD_DEADBAND_MAX 250
+#define SETTING_3D_DEADBAND_THROTTLE 157
+#define SETTING_3D_DEADBAND_THROTTLE_MIN 0
+#define SETTING_3D_DEADBAND_THROTTLE_MAX 200
+#define SETTING_MC_AIRMODE_TYPE 158
+#define SETTING_MC_AIRMODE_TYPE_MIN 0
+#define SETTING_MC_AIRMODE_TYPE_MAX 0
+#define SETTING_MC_AIRMODE_THRESHOLD 159
+#define SETTING_MC_AIRMODE_THRESHOLD_MIN 1000
+#define SETTING_MC_AIRMODE_THRESHOLD_MAX 2000
+#define SETTING_MC_P_PITCH 160
+#define SETTING_MC_P_PITCH_MIN 0
+#define SETTING_MC_P_PITCH_MAX 200
+#define SETTING_MC_I_PITCH 161
+#define SETTING_MC_I_PITCH_MIN 0
+#define SETTING_MC_I_PITCH_MAX 200
+#define SETTING_MC_D_PITCH 162
+#define SETTING_MC_D_PITCH_MIN 0
+#define SETTING_MC_D_PITCH_MAX 200
+#define SETTING_MC_CD_PITCH 163
+#define SETTING_MC_CD_PITCH_MIN 0
+#define SETTING_MC_CD_PITCH_MAX 200
+#define SETTING_MC_P_ROLL 164
+#define SETTING_MC_P_ROLL_MIN 0
+#define SETTING_MC_P_ROLL_MAX 200
+#define SETTING_MC_I_ROLL 165
+#define SETTING_MC_I_ROLL_MIN 0
+#define SETTING_MC_I_ROLL_MAX 200
+#define SETTING_MC_D_ROLL 166
+#define SETTING_MC_D_ROLL_MIN 0
+#define SETTING_MC_D_ROLL_MAX 200
+#define SETTING_MC_CD_ROLL 167
+#define SETTING_MC_CD_ROLL_MIN 0
+#define SETTING_MC_CD_ROLL_MAX 200
+#define SETTING_MC_P_YAW 168
+#define SETTING_MC_P_YAW_MIN 0
+#define SETTING_MC_P_YAW_MAX 200
+#define SETTING_MC_I_YAW 169
+#define SETTING_MC_I_YAW_MIN 0
+#define SETTING_MC_I_YAW_MAX 200
+#define SETTING_MC_D_YAW 170
+#define SETTING_MC_D_YAW_MIN 0
+#define SETTING_MC_D_YAW_MAX 200
+#define SETTING_MC_CD_YAW 171
+#define SETTING_MC_CD_YAW_MIN 0
+#define SETTING_MC_CD_YAW_MAX 200
+#define SETTING_MC_P_LEVEL 172
+#define SETTING_MC_P_LEVEL_MIN 0
+#define SETTING_MC_P_LEVEL_MAX 200
+#define SETTING_MC_I_LEVEL 173
+#define SETTING_MC_I_LEVEL_MIN 0
+#define SETTING_MC_I_LEVEL_MAX 200
+#define SETTING_MC_D_LEVEL 174
+#define SETTING_MC_D_LEVEL_MIN 0
+#define SETTING_MC_D_LEVEL_MAX 200
+#define SETTING_FW_P_PITCH 175
+#define SETTING_FW_P_PITCH_MIN 0
+#define SETTING_FW_P_PITCH_MAX 200
+#define SETTING_FW_I_PITCH 176
+#define SETTING_FW_I_PITCH_MIN 0
+#define SETTING_FW_I_PITCH_MAX 200
+#define SETTING_FW_FF_PITCH 177
+#define SETTING_FW_FF_PITCH_MIN 0
+#define SETTING_FW_FF_PITCH_MAX 200
+#define SETTING_FW_P_ROLL 178
+#define SETTING_FW_P_ROLL_MIN 0
+#define SETTING_FW_P_ROLL_MAX 200
+#define SETTING_FW_I_ROLL 179
+#define SETTING_FW_I_ROLL_MIN 0
+#define SETTING_FW_I_ROLL_MAX 200
+#define SETTING_FW_FF_ROLL 180
+#define SETTING_FW_FF_ROLL_MIN 0
+#define SETTING_FW_FF_ROLL_MAX 200
+#define SETTING_FW_P_YAW 181
+#define SETTING_FW_P_YAW_MIN 0
+#define SETTING_FW_P_YAW_MAX 200
+#define SETTING_FW_I_YAW 182
+#define SETTING_FW_I_YAW_MIN 0
+#define SETTING_FW_I_YAW_MAX 200
+#define SETTING_FW_FF_YAW 183
+#define SETTING_FW_FF_YAW_MIN 0
+#define SETTING_FW_FF_YAW_MAX 200
+#define SETTING_FW_P_LEVEL 184
+#define SETTING_FW_P_LEVEL_MIN 0
+#define SETTING_FW_P_LEVEL_MAX 200
+#define SETTING_FW_I_LEVEL 185
+#define SETTING_FW_I_LEVEL_MIN 0
+#define SETTING_FW_I_LEVEL_MAX 200
+#define SETTING_FW_D_LEVEL 186
+#define SETTING_FW_D_LEVEL_MIN 0
+#define SETTING_FW_D_LEVEL_MAX 200
+#define SETTING_MAX_ANGLE_INCLINATION_RLL 187
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900
+#define SETTING_MAX_ANGLE_INCLINATION_PIT 188
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900
+#define SETTING_DTERM_LPF_HZ 189
+#define SETTING_DTERM_LPF_HZ_MIN 0
+#define SETTING_DTERM_LPF_HZ_MAX 500
+#define SETTING_DTERM_LPF_TYPE 190
+#define SETTING_DTERM_LPF_TYPE_MIN 0
+#define SETTING_DTERM_LPF_TYPE_MAX 0
+#define SETTING_DTERM_LPF2_HZ 191
+#define SETTING_DTERM_LPF2_HZ_MIN 0
+#define SETTING_DTERM_LPF2_HZ_MAX 500
+#define SETTING_DTERM_LPF2_TYPE 192
+#define SETTING_DTERM_LPF2_TYPE_MIN 0
+#define SETTING_DTERM_LPF2_TYPE_MAX 0
+#define SETTING_YAW_LPF_HZ 193
+#define SETTING_YAW_LPF_HZ_MIN 0
+#define SETTING_YAW_LPF_HZ_MAX 200
+#define SETTING_FW_ITERM_THROW_LIMIT 194
+#define SETTING_FW_ITERM_THROW_LIMIT_MIN 0
+#define SETTING_FW_ITERM_THROW_LIMIT_MAX 500
+#define SETTING_FW_LOITER_DIRECTION 195
+#define SETTING_FW_LOITER_DIRECTION_MIN 0
+#define SETTING_FW_LOITER_DIRECTION_MAX 0
+#define SETTING_FW_REFERENCE_AIRSPEED 196
+#define SETTING_FW_REFERENCE_AIRSPEED_MIN 1
+#define SETTING_FW_REFERENCE_AIRSPEED_MAX 5000
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN 197
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION 198
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1
+#define SETTING_PIDSUM_LIMIT 199
+#define SETTING_PIDSUM_LIMIT_MIN 100
+#define SETTING_PIDSUM_LIMIT_MAX 1000
+#define SETTING_PIDSUM_LIMIT_YAW 200
+#define SETTING_PIDSUM_LIMIT_YAW_MIN 100
+#define SETTING_PIDSUM_LIMIT_YAW_MAX 1000
+#define SETTING_ITERM_WINDUP 201
+#define SETTING_ITERM_WINDUP_MIN 0
+#define SETTING_ITERM_WINDUP_MAX 90
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000
+#define SETTING_RATE_ACCEL_LIMIT_YAW 203
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000
+#define SETTING_HEADING_HOLD_RATE_LIMIT 204
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250
+#define SETTING_NAV_MC_POS_Z_P 205
+#define SETTING_NAV_MC_POS_Z_P_MIN 0
+#define SETTING_NAV_MC_POS_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_P 206
+#define SETTING_NAV_MC_VEL_Z_P_MIN 0
+#define SETTING_NAV_MC_VEL_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_I 207
+#define SETTING_NAV_MC_VEL_Z_I_MIN 0
+#define SETTING_NAV_MC_VEL_Z_I_MAX 255
+#define SETTING_NAV_MC_VEL_Z_D 208
+#define SETTING_NAV_MC_VEL_Z_D_MIN 0
+#define SETTING_NAV_MC_VEL_Z_D_MAX 255
+#define SETTING_NAV_MC_POS_XY_P 209
+#define SETTING_NAV_MC_POS_XY_P_MIN 0
+#define SETTING_NAV_MC_POS_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_P 210
+#define SETTING_NAV_MC_VEL_XY_P_MIN 0
+#define SETTING_NAV_MC_VEL_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_I 211
+#define SETTING_NAV_MC_VEL_XY_I_MIN 0
+#define SETTING_NAV_MC_VEL_XY_I_MAX 255
+#define SETTING_NAV_MC_VEL_XY_D 212
+#define SETTING_NAV_MC_VEL_XY_D_MIN 0
+#define SETTING_NAV_MC_VEL_XY_D_MAX 255
+#define SETTING_NAV_MC_VEL_XY_FF 213
+#define SETTING_NAV_MC_VEL_XY_FF_MIN 0
+#define SETTING_NAV_MC_VEL_XY_FF_MAX 255
+#define SETTING_NAV_MC_HEADING_P 214
+#define SETTING_NAV_MC_HEADING_P_MIN 0
+#define SETTING_NAV_MC_HEADING_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100
+#define SETTING_NAV_FW_POS_Z_P 216
+#define SETTING_NAV_FW_POS_Z_P_MIN 0
+#define SETTING_NAV_FW_POS_Z_P_MAX 255
+#define SETTING_NAV_FW_POS_Z_I 217
+#define SETTING_NAV_FW_POS_Z_I_MIN 0
+#define SETTING_NAV_FW_POS_Z_I_MAX 255
+#define SETTING_NAV_FW_POS_Z_D 218
+#define SETTING_NAV_FW_POS_Z_D_MIN 0
+#define SETTING_NAV_FW_POS_Z_D_MAX 255
+#define SETTING_NAV_FW_POS_XY_P 219
+#define SETTING_NAV_FW_POS_XY_P_MIN 0
+#define SETTING_NAV_FW_POS_XY_P_MAX 255
+#define SETTING_NAV_FW_POS_XY_I 220
+#define SETTING_NAV_FW_POS_XY_I_MIN 0
+#define SETTING_NAV_FW_POS_XY_I_MAX 255
+#define SETTING_NAV_FW_POS_XY_D 221
+#define SETTING_NAV_FW_POS_XY_D_MIN 0
+#define SETTING_NAV_FW_POS_XY_D_MAX 255
+#define SETTING_NAV_FW_HEADING_P 222
+#define SETTING_NAV_FW_HEADING_P_MIN 0
+#define SETTING_NAV_FW_HEADING_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_P 223
+#define SETTING_NAV_FW_POS_HDG_P_MIN 0
+#define SETTING_NAV_FW_POS_HDG_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_I 224
+#define SETTING_NAV_FW_POS_HDG_I_MIN 0
+#define SETTING_NAV_FW_POS_HDG_I_MAX 255
+#define SETTING_NAV_FW_POS_HDG_D 225
+#define SETTING_NAV_FW_POS_HDG_D_MIN 0
+#define SETTING_NAV_FW_POS_HDG_D_MAX 255
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000
+#define SETTING_MC_ITERM_RELAX_TYPE 227
+#define SETTING_MC_ITERM_RELAX_TYPE_MIN 0
+#define SETTING_MC_ITERM_RELAX_TYPE_MAX 0
+#define SETTING_MC_ITERM_RELAX 228
+#define SETTING_MC_ITERM_RELAX_MIN 0
+#define SETTING_MC_ITERM_RELAX_MAX 0
+#define SETTING_MC_ITERM_RELAX_CUTOFF 229
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100
+#define SETTING_D_BOOST_FACTOR 230
+#define SETTING_D_BOOST_FACTOR_MIN 1
+#define SETTING_D_BOOST_FACTOR_MAX 3
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION 231
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250
+#define SETTING_ANTIGRAVITY_GAIN 233
+#define SETTING_ANTIGRAVITY_GAIN_MIN 1
+#define SETTING_ANTIGRAVITY_GAIN_MAX 20
+#define SETTING_ANTIGRAVITY_ACCELERATOR 234
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30
+#define SETTING_PID_TYPE 236
+#define SETTING_PID_TYPE_MIN 0
+#define SETTING_PID_TYPE_MAX 0
+#define SETTING_MC_CD_LPF_HZ 237
+#define SETTING_MC_CD_LPF_HZ_MIN 0
+#define SETTING_MC_CD_LPF_HZ_MAX 200
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_THRESHOLD 240
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC 242
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000
+#define SETTING_INAV_AUTO_MAG_DECL 243
+#define SETTING_INAV_AUTO_MAG_DECL_MIN 0
+#define SETTING_INAV_AUTO_MAG_DECL_MAX 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE 244
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255
+#define SETTING_INAV_USE_GPS_VELNED 245
+#define SETTING_INAV_USE_GPS_VELNED_MIN 0
+#define SETTING_INAV_USE_GPS_VELNED_MAX 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING 246
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0
+#define SETTING_INAV_RESET_ALTITUDE 247
+#define SETTING_INAV_RESET_ALTITUDE_MIN 0
+#define SETTING_INAV_RESET_ALTITUDE_MAX 0
+#define SETTING_INAV_RESET_HOME 248
+#define SETTING_INAV_RESET_HOME_MIN 0
+#define SETTING_INAV_RESET_HOME_MAX 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE 249
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000
+#define SETTING_INAV_W_Z_SURFACE_P 250
+#define SETTING_INAV_W_Z_SURFACE_P_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_P_MAX 100
+#define SETTING_INAV_W_Z_SURFACE_V 251
+#define SETTING_INAV_W_Z_SURFACE_V_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_V_MAX 100
+#define SETTING_INAV_W_XY_FLOW_P 252
+#define SETTING_INAV_W_XY_FLOW_P_MIN 0
+#define SETTING_INAV_W_XY_FLOW_P_MAX 100
+#define SETTING_INAV_W_XY_FLOW_V 253
+#define SETTING_INAV_W_XY_FLOW_V_MIN 0
+#define SETTING_INAV_W_XY_FLOW_V_MAX 100
+#define SETTING_INAV_W_Z_BARO_P 254
+#define SETTING_INAV_W_Z_BARO_P_MIN 0
+#define SETTING_INAV_W_Z_BARO_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_P 255
+#define SETTING_INAV_W_Z_GPS_P_MIN 0
+#define SETTING_INAV_W_Z_GPS_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_V 256
+#define SETTING_INAV_W_Z_GPS_V_MIN 0
+#define SETTING_INAV_W_Z_GPS_V_MAX 10
+#define SETTING_INAV_W_XY_GPS_P 257
+#define SETTING_INAV_W_XY_GPS_P_MIN 0
+#define SETTING_INAV_W_XY_GPS_P_MAX 10
+#define SETTING_INAV_W_XY_GPS_V 258
+#define SETTING_INAV_W_XY_GPS_V_MIN 0
+#define SETTING_INAV_W_XY_GPS_V_MAX 10
+#define SETTING_INAV_W_Z_RES_V 259
+#define SETTING_INAV_W_Z_RES_V_MIN 0
+#define SETTING_INAV_W_Z_RES_V_MAX 10
+#define SETTING_INAV_W_XY_RES_V 260
+#define SETTING_INAV_W_XY_RES_V_MIN 0
+#define SETTING_INAV_W_XY_RES_V_MAX 10
+#define SETTING_INAV_W_XYZ_ACC_P 261
+#define SETTING_INAV_W_XYZ_ACC_P_MIN 0
+#define SETTING_INAV_W_XYZ_ACC_P_MAX 1
+#define SETTING_INAV_W_ACC_BIAS 262
+#define SETTING_INAV_W_ACC_BIAS_MIN 0
+#define SETTING_INAV_W_ACC_BIAS_MAX 1
+#define SETTING_INAV_MAX_EPH_EPV 263
+#define SETTING_INAV_MAX_EPH_EPV_MIN 0
+#define SETTING_INAV_MAX_EPH_EPV_MAX 9999
+#define SETTING_INAV_BARO_EPV 264
+#define SETTING_INAV_BARO_EPV_MIN 0
+#define SETTING_INAV_BARO_EPV_MAX 9999
+#define SETTING_NAV_DISARM_ON_LANDING 265
+#define SETTING_NAV_DISARM_ON_LANDING_MIN 0
+#define SETTING_NAV_DISARM_ON_LANDING_MAX 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY 267
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0
+#define SETTING_NAV_USER_CONTROL_MODE 268
+#define SETTING_NAV_USER_CONTROL_MODE_MIN 0
+#define SETTING_NAV_USER_CONTROL_MODE_MAX 0
+#define SETTING_NAV_POSITION_TIMEOUT 269
+#define SETTING_NAV_POSITION_TIMEOUT_MIN 0
+#define SETTING_NAV_POSITION_TIMEOUT_MAX 10
+#define SETTING_NAV_WP_RADIUS 270
+#define SETTING_NAV_WP_RADIUS_MIN 10
+#define SETTING_NAV_WP_RADIUS_MAX 10000
+#define SETTING_NAV_WP_SAFE_DISTANCE 271
+#define SETTING_NAV_WP_SAFE_DISTANCE_MIN 0
+#define SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000
+#define SETTING_NAV_AUTO_SPEED 272
+#define SETTING_NAV_AUTO_SPEED_MIN 10
+#define SETTING_NAV_AUTO_SPEED_MAX 2000
+#define SETTING_NAV_AUTO_CLIMB_RATE 273
+#define SETTING_NAV_AUTO_CLIMB_RATE_MIN 10
+#define SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_MANUAL_SPEED 274
+#define SETTING_NAV_MANUAL_SPEED_MIN 10
+#define SETTING_NAV_MANUAL_SPEED_MAX 2000
+#define SETTING_NAV_MANUAL_CLIMB_RATE 275
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_LANDING_SPEED 276
+#define SETTING_NAV_LANDING_SPEED_MIN 100
+#define SETTING_NAV_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT 277
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT 278
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000
+#define SETTING_NAV_EMERG_LANDING_SPEED 279
+#define SETTING_NAV_EMERG_LANDING_SPEED_MIN 100
+#define SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_MIN_RTH_DISTANCE 280
+#define SETTING_NAV_MIN_RTH_DISTANCE_MIN 0
+#define SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP 281
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0
+#define SETTING_NAV_RTH_CLIMB_FIRST 282
+#define SETTING_NAV_RTH_CLIMB_FIRST_MIN 0
+#define SETTING_NAV_RTH_CLIMB_FIRST_MAX 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0
+#define SETTING_NAV_RTH_TAIL_FIRST 284
+#define SETTING_NAV_RTH_TAIL_FIRST_MIN 0
+#define SETTING_NAV_RTH_TAIL_FIRST_MAX 0
+#define SETTING_NAV_RTH_ALLOW_LANDING 285
+#define SETTING_NAV_RTH_ALLOW_LANDING_MIN 0
+#define SETTING_NAV_RTH_ALLOW_LANDING_MAX 0
+#define SETTING_NAV_RTH_ALT_MODE 286
+#define SETTING_NAV_RTH_ALT_MODE_MIN 0
+#define SETTING_NAV_RTH_ALT_MODE_MAX 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD 287
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000
+#define SETTING_NAV_RTH_ALTITUDE 289
+#define SETTING_NAV_RTH_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_ALTITUDE 290
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359
+#define SETTING_NAV_MC_BANK_ANGLE 293
+#define SETTING_NAV_MC_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BANK_ANGLE_MAX 45
+#define SETTING_NAV_MC_HOVER_THR 294
+#define SETTING_NAV_MC_HOVER_THR_MIN 1000
+#define SETTING_NAV_MC_HOVER_THR_MAX 2000
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY 295
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_TIMEOUT 298
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE 303
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60
+#define SETTING_NAV_MC_POS_DECELERATION_TIME 304
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255
+#define SETTING_NAV_MC_POS_EXPO 305
+#define SETTING_NAV_MC_POS_EXPO_MIN 0
+#define SETTING_NAV_MC_POS_EXPO_MAX 255
+#define SETTING_NAV_FW_CRUISE_THR 306
+#define SETTING_NAV_FW_CRUISE_THR_MIN 1000
+#define SETTING_NAV_FW_CRUISE_THR_MAX 2000
+#define SETTING_NAV_FW_MIN_THR 307
+#define SETTING_NAV_FW_MIN_THR_MIN 1000
+#define SETTING_NAV_FW_MIN_THR_MAX 2000
+#define SETTING_NAV_FW_MAX_THR 308
+#define SETTING_NAV_FW_MAX_THR_MIN 1000
+#define SETTING_NAV_FW_MAX_THR_MAX 2000
+#define SETTING_NAV_FW_BANK_ANGLE 309
+#define SETTING_NAV_FW_BANK_ANGLE_MIN 5
+#define SETTING_NAV_FW_BANK_ANGLE_MAX 80
+#define SETTING_NAV_FW_CLIMB_ANGLE 310
+#define SETTING_NAV_FW_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_CLIMB_ANGLE_MAX 80
+#define SETTING_NAV_FW_DIVE_ANGLE 311
+#define SETTING_NAV_FW_DIVE_ANGLE_MIN 5
+#define SETTING_NAV_FW_DIVE_ANGLE_MAX 80
+#define SETTING_NAV_FW_PITCH2THR 312
+#define SETTING_NAV_FW_PITCH2THR_MIN 0
+#define SETTING_NAV_FW_PITCH2THR_MAX 100
+#define SETTING_NAV_FW_LOITER_RADIUS 313
+#define SETTING_NAV_FW_LOITER_RADIUS_MIN 0
+#define SETTING_NAV_FW_LOITER_RADIUS_MAX 10000
+#define SETTING_NAV_FW_CRUISE_SPEED 314
+#define SETTING_NAV_FW_CRUISE_SPEED_MIN 0
+#define SETTING_NAV_FW_CRUISE_SPEED_MAX 65535
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS 315
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE 316
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20
+#define SETTING_NAV_FW_LAUNCH_VELOCITY 317
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000
+#define SETTING_NAV_FW_LAUNCH_ACCEL 318
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME 320
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_THR 321
+#define SETTING_NAV_FW_LAUNCH_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR 322
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME 325
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT 326
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45
+#define SETTING_NAV_FW_CRUISE_YAW_RATE 329
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL 331
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0
+#define SETTING_NAV_FW_YAW_DEADBAND 332
+#define SETTING_NAV_FW_YAW_DEADBAND_MIN 0
+#define SETTING_NAV_FW_YAW_DEADBAND_MAX 90
+#define SETTING_TELEMETRY_SWITCH 333
+#define SETTING_TELEMETRY_SWITCH_MIN 0
+#define SETTING_TELEMETRY_SWITCH_MAX 0
+#define SETTING_TELEMETRY_INVERTED 334
+#define SETTING_TELEMETRY_INVERTED_MIN 0
+#define SETTING_TELEMETRY_INVERTED_MAX 0
+#define SETTING_FRSKY_DEFAULT_LATITUDE 335
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90
+#define SETTING_FRSKY_DEFAULT_LONGITUDE 336
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180
+#define SETTING_FRSKY_COORDINATES_FORMAT 337
+#define SETTING_FRSKY_COORDINATES_FORMAT_MIN 0
+#define SETTING_FRSKY_COORDINATES_FORMAT_MAX 1
+#define SETTING_FRSKY_UNIT 338
+#define SETTING_FRSKY_UNIT_MIN 0
+#define SETTING_FRSKY_UNIT_MAX 0
+#define SETTING_FRSKY_VFAS_PRECISION 339
+#define SETTING_FRSKY_VFAS_PRECISION_MIN 0
+#define SETTING_FRSKY_VFAS_PRECISION_MAX 1
+#define SETTING_FRSKY_PITCH_ROLL 340
+#define SETTING_FRSKY_PITCH_ROLL_MIN 0
+#define SETTING_FRSKY_PITCH_ROLL_MAX 0
+#define SETTING_REPORT_CELL_VOLTAGE 341
+#define SETTING_REPORT_CELL_VOLTAGE_MIN 0
+#define SETTING_REPORT_CELL_VOLTAGE_MAX 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL 342
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120
+#define SETTING_TELEMETRY_HALFDUPLEX 343
+#define SETTING_TELEMETRY_HALFDUPLEX_MIN 0
+#define SETTING_TELEMETRY_HALFDUPLEX_MAX 0
+#define SETTING_SMARTPORT_FUEL_UNIT 344
+#define SETTING_SMARTPORT_FUEL_UNIT_MIN 0
+#define SETTING_SMARTPORT_FUEL_UNIT_MAX 0
+#define SETTING_IBUS_TELEMETRY_TYPE 345
+#define SETTING_IBUS_TELEMETRY_TYPE_MIN 0
+#define SETTING_IBUS_TELEMETRY_TYPE_MAX 255
+#define SETTING_LTM_UPDATE_RATE 346
+#define SETTING_LTM_UPDATE_RATE_MIN 0
+#define SETTING_LTM_UPDATE_RATE_MAX 0
+#define SETTING_SIM_GROUND_STATION_NUMBER 347
+#define SETTING_SIM_GROUND_STATION_NUMBER_MIN 0
+#define SETTING_SIM_GROUND_STATION_NUMBER_MAX 16
+#define SETTING_SIM_PIN 348
+#define SETTING_SIM_PIN_MIN 0
+#define SETTING_SIM_PIN_MAX 8
+#define SETTING_SIM_TRANSMIT_INTERVAL 349
+#define SETTING_SIM_TRANSMIT_INTERVAL_MIN 10
+#define SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535
+#define SETTING_SIM_TRANSMIT_FLAGS 350
+#define SETTING_SIM_TRANSMIT_FLAGS_MIN 0
+#define SETTING_SIM_TRANSMIT_FLAGS_MAX 5
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH 351
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535
+#define SETTING_ACC_EVENT_THRESHOLD_LOW 352
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X 353
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535
+#define SETTING_SIM_LOW_ALTITUDE 354
+#define SETTING_SIM_LOW_ALTITUDE_MIN -32768
+#define SETTING_SIM_LOW_ALTITUDE_MAX 32767
+#define SETTING_MAVLINK_EXT_STATUS_RATE 355
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255
+#define SETTING_MAVLINK_RC_CHAN_RATE 356
+#define SETTING_MAVLINK_RC_CHAN_RATE_MIN 0
+#define SETTING_MAVLINK_RC_CHAN_RATE_MAX 255
+#define SETTING_MAVLINK_POS_RATE 357
+#define SETTING_MAVLINK_POS_RATE_MIN 0
+#define SETTING_MAVLINK_POS_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA1_RATE 358
+#define SETTING_MAVLINK_EXTRA1_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA1_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA2_RATE 359
+#define SETTING_MAVLINK_EXTRA2_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA2_RATE_MAX 255
+#define SETTING_DEBUG_MODE 360
+#define SETTING_DEBUG_MODE_MIN 0
+#define SETTING_DEBUG_MODE_MAX 0
+#define SETTING_THROTTLE_TILT_COMP_STR 361
+#define SETTING_THROTTLE_TILT_COMP_STR_MIN 0
+#define SETTING_THROTTLE_TILT_COMP_STR_MAX 100
+#define SETTING_NAME 362
+#define SETTING_NAME_MIN 0
+#define SETTING_NAME_MAX 16
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR 363
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0
+#define SETTING_STATS 364
+#define SETTING_STATS_MIN 0
+#define SETTING_STATS_MAX 0
+#define SETTING_STATS_TOTAL_TIME 365
+#define SETTING_STATS_TOTAL_TIME_MIN 0
+#define SETTING_STATS_TOTAL_TIME_MAX 2147483647
+#define SETTING_STATS_TOTAL_DIST 366
+#define SETTING_STATS_TOTAL_DIST_MIN 0
+#define SETTING_STATS_TOTAL_DIST_MAX 2147483647
+#define SETTING_TZ_OFFSET 367
+#define SETTING_TZ_OFFSET_MIN -1440
+#define SETTING_TZ_OFFSET_MAX 1440
+#define SETTING_TZ_AUTOMATIC_DST 368
+#define SETTING_TZ_AUTOMATIC_DST_MIN 0
+#define SETTING_TZ_AUTOMATIC_DST_MAX 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK 369
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0
+#define SETTING_VTX_HALFDUPLEX 370
+#define SETTING_VTX_HALFDUPLEX_MIN 0
+#define SETTING_VTX_HALFDUPLEX_MAX 0
+#define SETTING_VTX_BAND 371
+#define SETTING_VTX_BAND_MIN 0
+#define SETTING_VTX_BAND_MAX 5
+#define SETTING_VTX_CHANNEL 372
+#define SETTING_VTX_CHANNEL_MIN 1
+#define SETTING_VTX_CHANNEL_MAX 8
+#define SETTING_VTX_POWER 373
+#define SETTING_VTX_POWER_MIN 1
+#define SETTING_VTX_POWER_MAX 5
+#define SETTING_VTX_LOW_POWER_DISARM 374
+#define SETTING_VTX_LOW_POWER_DISARM_MIN 0
+#define SETTING_VTX_LOW_POWER_DISARM_MAX 0
+#define SETTING_VTX_PIT_MODE_CHAN 375
+#define SETTING_VTX_PIT_MODE_CHAN_MIN 1
+#define SETTING_VTX_PIT_MODE_CHAN_MAX 8
+#define SETTING_VTX_MAX_POWER_OVERRIDE 376
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000
+#define SETTING_LOG_LEVEL 377
+#define SETTING_LOG_LEVEL_MIN 0
+#define SETTING_LOG_LEVEL_MAX 0
+#define SETTING_LOG_TOPICS 378
+#define SETTING_LOG_TOPICS_MIN 0
+#define SETTING_LOG_TOPICS_MAX 4294967295
+# 10 "./src/main/fc/settings.h" 2
+
+typedef struct lookupTableEntry_s {
+    const char * const *values;
+    const uint8_t valueCount;
+} lookupTableEntry_t;
+
+#define SETTING_TYPE_OFFSET 0
+#define SETTING_SECTION_OFFSET 4
+#define SETTING_MODE_OFFSET 6
+
+typedef enum {
+
+    VAR_UINT8 = (0 << 0),
+    VAR_INT8 = (1 << 0),
+    VAR_UINT16 = (2 << 0),
+    VAR_INT16 = (3 << 0),
+    VAR_UINT32 = (4 << 0),
+    VAR_FLOAT = (5 << 0),
+    VAR_STRING = (6 << 0)
+} setting_type_e;
+
+typedef enum {
+
+    MASTER_VALUE = (0 << 4),
+    PROFILE_VALUE = (1 << 4),
+    CONTROL_RATE_VALUE = (2 << 4),
+    BATTERY_CONFIG_VALUE = (3 << 4),
+} setting_section_e;
+
+typedef enum {
+
+    MODE_DIRECT = (0 << 6),
+    MODE_LOOKUP = (1 << 6),
+} setting_mode_e;
+
+#define SETTING_TYPE_MASK (0x0F)
+#define SETTING_SECTION_MASK (0x30)
+#define SETTING_MODE_MASK (0xC0)
+
+typedef struct settingMinMaxConfig_s {
+    const uint8_t indexes[2];
+} settingMinMaxConfig_t;
+
+typedef struct settingLookupTableConfig_s {
+    const uint8_t tableIndex;
+} settingLookupTableConfig_t;
+
+typedef union {
+    settingLookupTableConfig_t lookup;
+    settingMinMaxConfig_t minmax;
+} settingConfig_t;
+
+typedef struct {
+    const uint8_t encoded_name[5];
+    const uint8_t type;
+    const settingConfig_t config;
+    const setting_offset_t offset;
+
+} __attribute__((packed)) setting_t;
+
+static inline setting_type_e SETTING_TYPE(const setting_t *s) { return s->type & (0x0F); }
+static inline setting_section_e SETTING_SECTION(const setting_t *s) { return s->type & (0x30); }
+static inline setting_mode_e SETTING_MODE(const setting_t *s) { return s->type & (0xC0); }
+
+void settingGetName(const setting_t *val, char *buf);
+
+# 75 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 75 "./src/main/fc/settings.h"
+    settingNameContains(const setting_t *val, char *buf, const char *cmdline);
+
+# 76 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 76 "./src/main/fc/settings.h"
+    settingNameIsExactMatch(const setting_t *val, char *buf, const char *cmdline, uint8_t var_name_length);
+
+
+const setting_t *settingFind(const char *name);
+
+
+const setting_t *settingFindIgnoringCase(const char *name, size_t length, char *buf);
+
+
+const setting_t *settingGet(unsigned index);
+
+unsigned settingGetIndex(const setting_t *val);
+
+
+
+
+# 91 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 91 "./src/main/fc/settings.h"
+    settingsValidate(unsigned *invalidIndex);
+
+size_t settingGetValueSize(const setting_t *val);
+pgn_t settingGetPgn(const setting_t *val);
+
+
+void * settingGetValuePointer(const setting_t *val);
+
+
+
+
+const void * settingGetCopyValuePointer(const setting_t *val);
+
+
+
+setting_min_t settingGetMin(const setting_t *val);
+
+
+
+setting_max_t settingGetMax(const setting_t *val);
+
+
+const lookupTableEntry_t * settingLookupTable(const setting_t *val);
+
+
+
+const char * settingLookupValueName(const setting_t *val, unsigned v);
+
+
+size_t settingGetValueNameMaxSize(const setting_t *val);
+
+
+const char * settingGetString(const setting_t *val);
+
+
+
+void settingSetString(const setting_t *val, const char *s, size_t size);
+
+
+setting_max_t settingGetStringMaxLength(const setting_t *val);
+
+
+
+
+# 134 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 134 "./src/main/fc/settings.h"
+    settingsGetParameterGroupIndexes(pgn_t pg, uint16_t *start, uint16_t *end);
+# 64 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/flight/mixer.h" 1
+# 18 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+
+#define MAX_SUPPORTED_MOTORS 12
+
+
+#define YAW_JUMP_PREVENTION_LIMIT_LOW 80
+#define YAW_JUMP_PREVENTION_LIMIT_HIGH 500
+
+#define FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450
+
+
+#define DSHOT_DISARM_COMMAND 0
+#define DSHOT_MIN_THROTTLE 48
+#define DSHOT_MAX_THROTTLE 2047
+#define DSHOT_3D_DEADBAND_LOW 1047
+#define DSHOT_3D_DEADBAND_HIGH 1048
+
+typedef enum {
+    PLATFORM_MULTIROTOR = 0,
+    PLATFORM_AIRPLANE = 1,
+    PLATFORM_HELICOPTER = 2,
+    PLATFORM_TRICOPTER = 3,
+    PLATFORM_ROVER = 4,
+    PLATFORM_BOAT = 5,
+    PLATFORM_OTHER = 6
+} flyingPlatformType_e;
+
+typedef struct motorAxisCorrectionLimits_s {
+    int16_t min;
+    int16_t max;
+} motorAxisCorrectionLimits_t;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t primaryMotorMixer_SystemArray[12]; extern motorMixer_t primaryMotorMixer_CopyArray[12]; static inline const motorMixer_t* primaryMotorMixer(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t* primaryMotorMixerMutable(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* primaryMotorMixer_array(void))[12] { return &primaryMotorMixer_SystemArray; } struct _dummy;
+
+typedef struct mixerConfig_s {
+    int8_t motorDirectionInverted;
+    uint8_t platformType;
+    
+# 68 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 68 "./src/main/flight/mixer.h"
+        hasFlaps;
+    int16_t appliedMixerPreset;
+    uint16_t fwMinThrottleDownPitchAngle;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct reversibleMotorsConfig_s {
+    uint16_t deadband_low;
+    uint16_t deadband_high;
+    uint16_t neutral;
+} reversibleMotorsConfig_t;
+
+extern reversibleMotorsConfig_t reversibleMotorsConfig_System; extern reversibleMotorsConfig_t reversibleMotorsConfig_Copy; static inline const reversibleMotorsConfig_t* reversibleMotorsConfig(void) { return &reversibleMotorsConfig_System; } static inline reversibleMotorsConfig_t* reversibleMotorsConfigMutable(void) { return &reversibleMotorsConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint16_t motorAccelTimeMs;
+    uint16_t motorDecelTimeMs;
+    uint16_t digitalIdleOffsetValue;
+    float throttleIdle;
+    float throttleScale;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+typedef enum {
+    MOTOR_STOPPED_USER,
+    MOTOR_STOPPED_AUTO,
+    MOTOR_RUNNING
+} motorStatus_e;
+
+typedef enum {
+    MOTOR_DIRECTION_FORWARD,
+    MOTOR_DIRECTION_BACKWARD,
+    MOTOR_DIRECTION_DEADBAND
+} reversibleMotorsThrottleState_e;
+
+extern int16_t motor[12];
+extern int16_t motor_disarmed[12];
+extern int mixerThrottleCommand;
+
+int getThrottleIdleValue(void);
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 118 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 118 "./src/main/flight/mixer.h"
+    mixerIsOutputSaturated(void);
+motorStatus_e getMotorStatus(void);
+
+void writeAllMotors(int16_t mc);
+void mixerInit(void);
+void mixerUpdateStateFlags(void);
+void mixerResetDisarmedMotors(void);
+void mixTable(const float dT);
+void writeMotors(void);
+void processServoAutotrim(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+void loadPrimaryMotorMixer(void);
+# 66 "./src/main/cms/cms.c" 2
+# 1 "./src/main/flight/servos.h" 1
+# 18 "./src/main/flight/servos.h"
+       
+
+
+# 1 "./src/main/common/logic_condition.h" 1
+# 24 "./src/main/common/logic_condition.h"
+       
+
+
+
+
+#define MAX_LOGIC_CONDITIONS 16
+
+typedef enum {
+    LOGIC_CONDITION_TRUE = 0,
+    LOGIC_CONDITION_EQUAL,
+    LOGIC_CONDITION_GREATER_THAN,
+    LOGIC_CONDITION_LOWER_THAN,
+    LOGIC_CONDITION_LOW,
+    LOGIC_CONDITION_MID,
+    LOGIC_CONDITION_HIGH,
+    LOGIC_CONDITION_AND,
+    LOGIC_CONDITION_OR,
+    LOGIC_CONDITION_XOR,
+    LOGIC_CONDITION_NAND,
+    LOGIC_CONDITION_NOR,
+    LOGIC_CONDITION_NOT,
+    LOGIC_CONDITION_STICKY,
+    LOGIC_CONDITION_ADD,
+    LOGIC_CONDITION_SUB,
+    LOGIC_CONDITION_MUL,
+    LOGIC_CONDITION_DIV,
+    LOGIC_CONDITION_GVAR_SET,
+    LOGIC_CONDITION_GVAR_INC,
+    LOGIC_CONDITION_GVAR_DEC,
+    LOGIC_CONDITION_LAST
+} logicOperation_e;
+
+typedef enum logicOperandType_s {
+    LOGIC_CONDITION_OPERAND_TYPE_VALUE = 0,
+    LOGIC_CONDITION_OPERAND_TYPE_RC_CHANNEL,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT_MODE,
+    LOGIC_CONDITION_OPERAND_TYPE_LC,
+    LOGIC_CONDITION_OPERAND_TYPE_GVAR,
+    LOGIC_CONDITION_OPERAND_TYPE_LAST
+} logicOperandType_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_ARM_TIMER = 0,
+    LOGIC_CONDITION_OPERAND_FLIGHT_HOME_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TRIP_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_RSSI,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VBAT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CELL_VOLTAGE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CURRENT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MAH_DRAWN,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GPS_SATS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GROUD_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_3D_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_AIR_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ALTITUDE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VERTICAL_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TROTTLE_POS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ARMED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_AUTOLAUNCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ALTITUDE_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_POSITION_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_EMERGENCY_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_WP,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_YAW,
+} logicFlightOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_MANUAL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_POSHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_CRUISE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ALTHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ANGLE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_HORIZON,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_AIR,
+} logicFlightModeOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_FLAG_LATCH = 1 << 0,
+} logicConditionFlags_e;
+
+typedef struct logicOperand_s {
+    logicOperandType_e type;
+    int32_t value;
+} logicOperand_t;
+
+typedef struct logicCondition_s {
+    uint8_t enabled;
+    int8_t activatorId;
+    logicOperation_e operation;
+    logicOperand_t operandA;
+    logicOperand_t operandB;
+    uint8_t flags;
+} logicCondition_t;
+
+extern logicCondition_t logicConditions_SystemArray[16]; extern logicCondition_t logicConditions_CopyArray[16]; static inline const logicCondition_t* logicConditions(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t* logicConditionsMutable(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t (* logicConditions_array(void))[16] { return &logicConditions_SystemArray; } struct _dummy;
+
+typedef struct logicConditionState_s {
+    int value;
+    uint8_t flags;
+} logicConditionState_t;
+
+void logicConditionProcess(uint8_t i);
+
+int logicConditionGetOperandValue(logicOperandType_e type, int operand);
+
+int logicConditionGetValue(int8_t conditionId);
+void logicConditionUpdateTask(timeUs_t currentTimeUs);
+void logicConditionReset(void);
+# 22 "./src/main/flight/servos.h" 2
+
+#define MAX_SUPPORTED_SERVOS 16
+
+
+typedef enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH = 1,
+    INPUT_STABILIZED_YAW = 2,
+    INPUT_STABILIZED_THROTTLE = 3,
+    INPUT_RC_ROLL = 4,
+    INPUT_RC_PITCH = 5,
+    INPUT_RC_YAW = 6,
+    INPUT_RC_THROTTLE = 7,
+    INPUT_RC_CH5 = 8,
+    INPUT_RC_CH6 = 9,
+    INPUT_RC_CH7 = 10,
+    INPUT_RC_CH8 = 11,
+    INPUT_GIMBAL_PITCH = 12,
+    INPUT_GIMBAL_ROLL = 13,
+    INPUT_FEATURE_FLAPS = 14,
+    INPUT_RC_CH9 = 15,
+    INPUT_RC_CH10 = 16,
+    INPUT_RC_CH11 = 17,
+    INPUT_RC_CH12 = 18,
+    INPUT_RC_CH13 = 19,
+    INPUT_RC_CH14 = 20,
+    INPUT_RC_CH15 = 21,
+    INPUT_RC_CH16 = 22,
+    INPUT_STABILIZED_ROLL_PLUS = 23,
+    INPUT_STABILIZED_ROLL_MINUS = 24,
+    INPUT_STABILIZED_PITCH_PLUS = 25,
+    INPUT_STABILIZED_PITCH_MINUS = 26,
+    INPUT_STABILIZED_YAW_PLUS = 27,
+    INPUT_STABILIZED_YAW_MINUS = 28,
+    INPUT_MAX = 29,
+    INPUT_GVAR_0 = 30,
+    INPUT_GVAR_1 = 31,
+    INPUT_GVAR_2 = 32,
+    INPUT_GVAR_3 = 33,
+
+    INPUT_SOURCE_COUNT
+} inputSource_e;
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_ELEVATOR = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+} servoIndex_e;
+
+#define SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR
+#define SERVO_PLANE_INDEX_MAX SERVO_RUDDER
+
+#define SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT
+#define SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT
+
+#define SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1
+#define SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4
+
+#define SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1
+#define SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2
+
+#define FLAPERON_THROW_DEFAULT 200
+#define FLAPERON_THROW_MIN 50
+#define FLAPERON_THROW_MAX 450
+
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int16_t rate;
+    uint8_t speed;
+
+    int8_t conditionId;
+
+} servoMixer_t;
+
+#define MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)
+#define MAX_SERVO_SPEED UINT8_MAX
+#define SERVO_OUTPUT_MAX 2500
+#define SERVO_OUTPUT_MIN 500
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 16)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 16)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 16)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+typedef struct servoParam_s {
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[16]; extern servoParam_t servoParams_CopyArray[16]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[16] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    int16_t servo_lowpass_freq;
+    uint16_t flaperon_throw_offset;
+    uint8_t servo_protocol;
+    uint8_t tri_unarmed_servo;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoMetadata_s {
+    float scaleMax;
+    float scaleMin;
+} servoMetadata_t;
+
+extern int16_t servo[16];
+
+
+# 148 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 148 "./src/main/flight/servos.h"
+    isServoOutputEnabled(void);
+void setServoOutputEnabled(
+# 149 "./src/main/flight/servos.h" 3 4
+                          _Bool 
+# 149 "./src/main/flight/servos.h"
+                               flag);
+
+# 150 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 150 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void loadCustomServoMixer(void);
+void servoMixer(float dT);
+void servoComputeScalingFactors(uint8_t servoIndex);
+void servosInit(void);
+int getServoCount(void);
+# 67 "./src/main/cms/cms.c" 2
+
+
+# 1 "./src/main/io/osd.h" 1
+# 18 "./src/main/io/osd.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/osd.h" 1
+# 21 "./src/main/drivers/osd.h"
+       
+
+
+
+
+
+#define OSD_CHAR_WIDTH 12
+#define OSD_CHAR_HEIGHT 18
+#define OSD_CHAR_BITS_PER_PIXEL 2
+#define OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)
+
+
+#define OSD_CHAR_BYTES 64
+
+#define OSD_CHARACTER_COLOR_BLACK 0
+#define OSD_CHARACTER_COLOR_TRANSPARENT 1
+#define OSD_CHARACTER_COLOR_WHITE 2
+
+
+
+typedef struct displayCanvas_s displayCanvas_t;
+
+
+
+typedef enum {
+    VIDEO_SYSTEM_AUTO = 0,
+    VIDEO_SYSTEM_PAL,
+    VIDEO_SYSTEM_NTSC
+} videoSystem_e;
+
+typedef enum {
+    OSD_DRIVER_NONE = 0,
+    OSD_DRIVER_MAX7456 = 1,
+} osdDriver_e;
+
+
+
+
+
+typedef struct osdCharacter_s {
+    uint8_t data[64];
+} osdCharacter_t;
+
+#define OSD_CHARACTER_GRID_MAX_WIDTH 30
+#define OSD_CHARACTER_GRID_MAX_HEIGHT 16
+#define OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)
+
+extern uint16_t osdCharacterGridBuffer[(30 * 16)] __attribute__ ((aligned(4)));
+
+
+void osdCharacterGridBufferClear(void);
+void osdGridBufferClearGridRect(int x, int y, int w, int h);
+void osdGridBufferClearPixelRect(displayCanvas_t *canvas, int x, int y, int w, int h);
+uint16_t *osdCharacterGridBufferGetEntryPtr(unsigned x, unsigned y);
+# 25 "./src/main/io/osd.h" 2
+
+
+#define OSD_ALTERNATE_LAYOUT_COUNT 3
+
+#define OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)
+
+#define OSD_VISIBLE_FLAG 0x0800
+#define OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)
+#define OSD_POS(x,y) ((x) | ((y) << 5))
+#define OSD_X(x) ((x) & 0x001F)
+#define OSD_Y(x) (((x) >> 5) & 0x001F)
+#define OSD_POS_MAX 0x3FF
+#define OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)
+
+#define OSD_HOMING_LIM_H1 6
+#define OSD_HOMING_LIM_H2 16
+#define OSD_HOMING_LIM_H3 38
+#define OSD_HOMING_LIM_V1 5
+#define OSD_HOMING_LIM_V2 10
+#define OSD_HOMING_LIM_V3 15
+
+typedef enum {
+    OSD_RSSI_VALUE,
+    OSD_MAIN_BATT_VOLTAGE,
+    OSD_CROSSHAIRS,
+    OSD_ARTIFICIAL_HORIZON,
+    OSD_HORIZON_SIDEBARS,
+    OSD_ONTIME,
+    OSD_FLYTIME,
+    OSD_FLYMODE,
+    OSD_CRAFT_NAME,
+    OSD_THROTTLE_POS,
+    OSD_VTX_CHANNEL,
+    OSD_CURRENT_DRAW,
+    OSD_MAH_DRAWN,
+    OSD_GPS_SPEED,
+    OSD_GPS_SATS,
+    OSD_ALTITUDE,
+    OSD_ROLL_PIDS,
+    OSD_PITCH_PIDS,
+    OSD_YAW_PIDS,
+    OSD_POWER,
+    OSD_GPS_LON,
+    OSD_GPS_LAT,
+    OSD_HOME_DIR,
+    OSD_HOME_DIST,
+    OSD_HEADING,
+    OSD_VARIO,
+    OSD_VARIO_NUM,
+    OSD_AIR_SPEED,
+    OSD_ONTIME_FLYTIME,
+    OSD_RTC_TIME,
+    OSD_MESSAGES,
+    OSD_GPS_HDOP,
+    OSD_MAIN_BATT_CELL_VOLTAGE,
+    OSD_THROTTLE_POS_AUTO_THR,
+    OSD_HEADING_GRAPH,
+    OSD_EFFICIENCY_MAH_PER_KM,
+    OSD_WH_DRAWN,
+    OSD_BATTERY_REMAINING_CAPACITY,
+    OSD_BATTERY_REMAINING_PERCENT,
+    OSD_EFFICIENCY_WH_PER_KM,
+    OSD_TRIP_DIST,
+    OSD_ATTITUDE_PITCH,
+    OSD_ATTITUDE_ROLL,
+    OSD_MAP_NORTH,
+    OSD_MAP_TAKEOFF,
+    OSD_RADAR,
+    OSD_WIND_SPEED_HORIZONTAL,
+    OSD_WIND_SPEED_VERTICAL,
+    OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH,
+    OSD_REMAINING_DISTANCE_BEFORE_RTH,
+    OSD_HOME_HEADING_ERROR,
+    OSD_CRUISE_HEADING_ERROR,
+    OSD_CRUISE_HEADING_ADJUSTMENT,
+    OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE,
+    OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE,
+    OSD_POWER_SUPPLY_IMPEDANCE,
+    OSD_LEVEL_PIDS,
+    OSD_POS_XY_PIDS,
+    OSD_POS_Z_PIDS,
+    OSD_VEL_XY_PIDS,
+    OSD_VEL_Z_PIDS,
+    OSD_HEADING_P,
+    OSD_BOARD_ALIGN_ROLL,
+    OSD_BOARD_ALIGN_PITCH,
+    OSD_RC_EXPO,
+    OSD_RC_YAW_EXPO,
+    OSD_THROTTLE_EXPO,
+    OSD_PITCH_RATE,
+    OSD_ROLL_RATE,
+    OSD_YAW_RATE,
+    OSD_MANUAL_RC_EXPO,
+    OSD_MANUAL_RC_YAW_EXPO,
+    OSD_MANUAL_PITCH_RATE,
+    OSD_MANUAL_ROLL_RATE,
+    OSD_MANUAL_YAW_RATE,
+    OSD_NAV_FW_CRUISE_THR,
+    OSD_NAV_FW_PITCH2THR,
+    OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE,
+    OSD_DEBUG,
+    OSD_FW_ALT_PID_OUTPUTS,
+    OSD_FW_POS_PID_OUTPUTS,
+    OSD_MC_VEL_X_PID_OUTPUTS,
+    OSD_MC_VEL_Y_PID_OUTPUTS,
+    OSD_MC_VEL_Z_PID_OUTPUTS,
+    OSD_MC_POS_XYZ_P_OUTPUTS,
+    OSD_3D_SPEED,
+    OSD_IMU_TEMPERATURE,
+    OSD_BARO_TEMPERATURE,
+    OSD_TEMP_SENSOR_0_TEMPERATURE,
+    OSD_TEMP_SENSOR_1_TEMPERATURE,
+    OSD_TEMP_SENSOR_2_TEMPERATURE,
+    OSD_TEMP_SENSOR_3_TEMPERATURE,
+    OSD_TEMP_SENSOR_4_TEMPERATURE,
+    OSD_TEMP_SENSOR_5_TEMPERATURE,
+    OSD_TEMP_SENSOR_6_TEMPERATURE,
+    OSD_TEMP_SENSOR_7_TEMPERATURE,
+    OSD_ALTITUDE_MSL,
+    OSD_PLUS_CODE,
+    OSD_MAP_SCALE,
+    OSD_MAP_REFERENCE,
+    OSD_GFORCE,
+    OSD_GFORCE_X,
+    OSD_GFORCE_Y,
+    OSD_GFORCE_Z,
+    OSD_RC_SOURCE,
+    OSD_VTX_POWER,
+    OSD_ESC_RPM,
+    OSD_ESC_TEMPERATURE,
+    OSD_ITEM_COUNT
+} osd_items_e;
+
+typedef enum {
+    OSD_UNIT_IMPERIAL,
+    OSD_UNIT_METRIC,
+    OSD_UNIT_UK,
+} osd_unit_e;
+
+typedef enum {
+    OSD_STATS_ENERGY_UNIT_MAH,
+    OSD_STATS_ENERGY_UNIT_WH,
+} osd_stats_energy_unit_e;
+
+typedef enum {
+    OSD_CROSSHAIRS_STYLE_DEFAULT,
+    OSD_CROSSHAIRS_STYLE_AIRCRAFT,
+    OSD_CROSSHAIRS_STYLE_TYPE3,
+    OSD_CROSSHAIRS_STYLE_TYPE4,
+    OSD_CROSSHAIRS_STYLE_TYPE5,
+    OSD_CROSSHAIRS_STYLE_TYPE6,
+    OSD_CROSSHAIRS_STYLE_TYPE7,
+} osd_crosshairs_style_e;
+
+typedef enum {
+    OSD_SIDEBAR_SCROLL_NONE,
+    OSD_SIDEBAR_SCROLL_ALTITUDE,
+    OSD_SIDEBAR_SCROLL_GROUND_SPEED,
+    OSD_SIDEBAR_SCROLL_HOME_DISTANCE,
+} osd_sidebar_scroll_e;
+
+typedef enum {
+    OSD_ALIGN_LEFT,
+    OSD_ALIGN_RIGHT
+} osd_alignment_e;
+
+typedef enum {
+    OSD_AHI_STYLE_DEFAULT,
+    OSD_AHI_STYLE_LINE,
+} osd_ahi_style_e;
+
+typedef struct osdConfig_s {
+
+    uint16_t item_pos[(3 + 1)][OSD_ITEM_COUNT];
+
+
+    uint8_t rssi_alarm;
+    uint16_t time_alarm;
+    uint16_t alt_alarm;
+    uint16_t dist_alarm;
+    uint16_t neg_alt_alarm;
+    uint8_t current_alarm;
+    int16_t imu_temp_alarm_min;
+    int16_t imu_temp_alarm_max;
+    int16_t esc_temp_alarm_min;
+    int16_t esc_temp_alarm_max;
+    float gforce_alarm;
+    float gforce_axis_alarm_min;
+    float gforce_axis_alarm_max;
+
+    int16_t baro_temp_alarm_min;
+    int16_t baro_temp_alarm_max;
+
+
+
+
+
+    videoSystem_e video_system;
+    uint8_t row_shiftdown;
+
+
+    uint8_t main_voltage_decimals;
+    uint8_t ahi_reverse_roll;
+    uint8_t ahi_max_pitch;
+    uint8_t crosshairs_style;
+    int8_t horizon_offset;
+    int8_t camera_uptilt;
+    uint8_t camera_fov_h;
+    uint8_t camera_fov_v;
+    uint8_t hud_margin_h;
+    uint8_t hud_margin_v;
+    
+# 236 "./src/main/io/osd.h" 3 4
+   _Bool 
+# 236 "./src/main/io/osd.h"
+        hud_homing;
+    
+# 237 "./src/main/io/osd.h" 3 4
+   _Bool 
+# 237 "./src/main/io/osd.h"
+        hud_homepoint;
+    uint8_t hud_radar_disp;
+    uint16_t hud_radar_range_min;
+    uint16_t hud_radar_range_max;
+    uint16_t hud_radar_nearest;
+    uint8_t hud_wp_disp;
+
+    uint8_t left_sidebar_scroll;
+    uint8_t right_sidebar_scroll;
+    uint8_t sidebar_scroll_arrows;
+
+    uint8_t units;
+    uint8_t stats_energy_unit;
+
+    
+# 251 "./src/main/io/osd.h" 3 4
+   _Bool 
+# 251 "./src/main/io/osd.h"
+           estimations_wind_compensation;
+    uint8_t coordinate_digits;
+
+    
+# 254 "./src/main/io/osd.h" 3 4
+   _Bool 
+# 254 "./src/main/io/osd.h"
+        osd_failsafe_switch_layout;
+    uint8_t plus_code_digits;
+    uint8_t osd_ahi_style;
+} osdConfig_t;
+
+extern osdConfig_t osdConfig_System; extern osdConfig_t osdConfig_Copy; static inline const osdConfig_t* osdConfig(void) { return &osdConfig_System; } static inline osdConfig_t* osdConfigMutable(void) { return &osdConfig_System; } struct _dummy;
+
+typedef struct displayPort_s displayPort_t;
+typedef struct displayCanvas_s displayCanvas_t;
+
+void osdInit(displayPort_t *osdDisplayPort);
+void osdUpdate(timeUs_t currentTimeUs);
+void osdStartFullRedraw(void);
+
+
+
+
+
+void osdOverrideLayout(int layout, timeMs_t duration);
+
+
+int osdGetActiveLayout(
+# 275 "./src/main/io/osd.h" 3 4
+                      _Bool 
+# 275 "./src/main/io/osd.h"
+                           *overridden);
+
+# 276 "./src/main/io/osd.h" 3 4
+_Bool 
+# 276 "./src/main/io/osd.h"
+    osdItemIsFixed(osd_items_e item);
+
+displayPort_t *osdGetDisplayPort(void);
+displayCanvas_t *osdGetDisplayPortCanvas(void);
+
+int16_t osdGetHeading(void);
+int32_t osdGetAltitude(void);
+
+void osdCrosshairPosition(uint8_t *x, uint8_t *y);
+
+# 285 "./src/main/io/osd.h" 3 4
+_Bool 
+# 285 "./src/main/io/osd.h"
+    osdFormatCentiNumber(char *buff, int32_t centivalue, uint32_t scale, int maxDecimals, int maxScaledDecimals, int length);
+void osdFormatAltitudeSymbol(char *buff, int32_t alt);
+void osdFormatVelocityStr(char* buff, int32_t vel, 
+# 287 "./src/main/io/osd.h" 3 4
+                                                  _Bool 
+# 287 "./src/main/io/osd.h"
+                                                       _3D);
+
+int osdGetHeadingAngle(int angle);
+# 70 "./src/main/cms/cms.c" 2
+# 1 "./src/main/io/rcdevice_cam.h" 1
+# 18 "./src/main/io/rcdevice_cam.h"
+       
+
+
+
+# 1 "/usr/include/stdio.h" 1 3 4
+# 24 "/usr/include/stdio.h" 3 4
+#define _STDIO_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 34 "/usr/include/stdio.h" 2 3 4
+
+#define __need___va_list 
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+#define _____fpos_t_defined 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+
+#define ____mbstate_t_defined 1
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+
+#define _____fpos64_t_defined 1
+
+
+
+
+
+
+
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+#define ____FILE_defined 1
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+#define __FILE_defined 1
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+#define __struct_FILE_defined 1
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+
+
+#define __getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)
+
+
+
+#define __putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))
+
+
+
+
+#define _IO_EOF_SEEN 0x0010
+#define __feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)
+
+#define _IO_ERR_SEEN 0x0020
+#define __ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)
+
+#define _IO_USER_LOCK 0x8000
+# 44 "/usr/include/stdio.h" 2 3 4
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+
+
+
+#define __off_t_defined 
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+#define __ssize_t_defined 
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 93 "/usr/include/stdio.h" 3 4
+#define _IOFBF 0
+#define _IOLBF 1
+#define _IONBF 2
+
+
+
+#define BUFSIZ 8192
+
+
+
+
+#define EOF (-1)
+
+
+
+
+#define SEEK_SET 0
+#define SEEK_CUR 1
+#define SEEK_END 2
+# 120 "/usr/include/stdio.h" 3 4
+#define P_tmpdir "/tmp"
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 3 4
+#define _BITS_STDIO_LIM_H 1
+
+
+
+
+
+#define L_tmpnam 20
+#define TMP_MAX 238328
+#define FILENAME_MAX 4096
+
+
+#define L_ctermid 9
+
+
+
+
+
+#undef FOPEN_MAX
+#define FOPEN_MAX 16
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+#define stdin stdin
+#define stdout stdout
+#define stderr stderr
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+
+#undef __attr_dealloc_fclose
+#define __attr_dealloc_fclose __attr_dealloc (fclose, 1)
+
+
+
+
+
+
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 605 "/usr/include/stdio.h" 3 4
+extern char *gets (char *__s) __attribute__ ((__deprecated__));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define _BITS_STDIO_H 1
+# 29 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define __STDIO_INLINE __extern_inline
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 147 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin_constant_p (size) && __builtin_constant_p (n) && (size_t) (size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > 0; --__cnt) { int __c = getc_unlocked (__stream); if (__c == EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) (n) - __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))
+# 171 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#define fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builtin_constant_p (size) && __builtin_constant_p (n) && (size_t) (size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ const char *__ptr = (const char *) (ptr); FILE *__stream = (stream); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stream) == EOF) break; ((size_t) (size) * (size_t) (n) - __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))
+# 193 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+#undef __STDIO_INLINE
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 23 "./src/main/io/rcdevice_cam.h" 2
+
+
+
+# 1 "./src/main/io/rcdevice.h" 1
+# 18 "./src/main/io/rcdevice.h"
+       
+
+# 1 "./src/main/drivers/serial.h" 1
+# 18 "./src/main/drivers/serial.h"
+       
+# 1 "./src/main/drivers/io.h" 1
+# 18 "./src/main/drivers/io.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 18 "./src/main/drivers/resource.h"
+       
+
+#define RESOURCE_INDEX(x) (x + 1)
+
+
+# 22 "./src/main/drivers/resource.h"
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMIO,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_SOFTSERIAL,
+    OWNER_ADC,
+    OWNER_SERIAL,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_RANGEFINDER,
+    OWNER_SYSTEM,
+    OWNER_SPI,
+    OWNER_I2C,
+    OWNER_SDCARD,
+    OWNER_FLASH,
+    OWNER_USB,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_BARO,
+    OWNER_MPU,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_LED,
+    OWNER_RX,
+    OWNER_TX,
+    OWNER_RX_SPI,
+    OWNER_VTX,
+    OWNER_SPI_PREINIT,
+    OWNER_COMPASS,
+    OWNER_TEMPERATURE,
+    OWNER_1WIRE,
+    OWNER_AIRSPEED,
+    OWNER_OLED_DISPLAY,
+    OWNER_PINIO,
+    OWNER_IRLOCK,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+
+
+
+typedef enum {
+    RESOURCE_NONE = 0,
+    RESOURCE_INPUT, RESOURCE_OUTPUT, RESOURCE_IO,
+    RESOURCE_TIMER,
+    RESOURCE_UART_TX, RESOURCE_UART_RX, RESOURCE_UART_TXRX,
+    RESOURCE_EXTI,
+    RESOURCE_I2C_SCL, RESOURCE_I2C_SDA,
+    RESOURCE_SPI_SCK, RESOURCE_SPI_MOSI, RESOURCE_SPI_MISO, RESOURCE_SPI_CS,
+    RESOURCE_ADC_CH1, RESOURCE_ADC_CH2, RESOURCE_ADC_CH3, RESOURCE_ADC_CH4,
+    RESOURCE_RX_CE,
+    RESOURCE_TOTAL_COUNT
+} resourceType_e;
+
+extern const char * const resourceNames[RESOURCE_TOTAL_COUNT];
+# 26 "./src/main/drivers/io.h" 2
+# 34 "./src/main/drivers/io.h"
+#define IO_TAG(pinid) DEFIO_TAG(pinid)
+# 73 "./src/main/drivers/io.h"
+#define IOCFG_OUT_PP 0
+#define IOCFG_OUT_OD 0
+#define IOCFG_AF_PP 0
+#define IOCFG_AF_OD 0
+#define IOCFG_IPD 0
+#define IOCFG_IPU 0
+#define IOCFG_IN_FLOATING 0
+
+
+
+
+
+
+# 1 "./src/main/drivers/io_def.h" 1
+       
+
+
+
+
+
+#define DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)
+#define DEFIO_TAG__NONE 0
+#define DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)
+#define DEFIO_TAG_E__NONE 0
+
+
+
+
+
+#define DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)
+#define DEFIO_REC__NONE NULL
+
+#define DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)
+
+
+
+#define DEFIO_REC_INDEXED(idx) (ioRecs + (idx))
+
+
+#define DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))
+#define DEFIO_TAG_ISEMPTY(tag) (!(tag))
+#define DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)
+#define DEFIO_TAG_PIN(tag) ((tag) & 0x0f)
+
+
+
+
+# 1 "./src/main/drivers/io_def_generated.h" 1
+       
+
+
+
+
+
+
+
+#define DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA
+#define DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_A_OFFSET (0)
+
+
+#define DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB
+#define DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)
+
+
+#define DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC
+#define DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_D_USED_MASK 0
+#define DEFIO_PORT_D_USED_COUNT 0
+
+#define DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_E_USED_MASK 0
+#define DEFIO_PORT_E_USED_COUNT 0
+
+#define DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_F_USED_MASK 0
+#define DEFIO_PORT_F_USED_COUNT 0
+
+#define DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_G_USED_MASK 0
+#define DEFIO_PORT_G_USED_COUNT 0
+
+#define DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)
+
+
+
+
+#define DEFIO_GPIOID__A 0
+#define DEFIO_GPIOID__B 1
+#define DEFIO_GPIOID__C 2
+#define DEFIO_GPIOID__D 3
+#define DEFIO_GPIOID__E 4
+#define DEFIO_GPIOID__F 5
+#define DEFIO_GPIOID__G 6
+
+
+
+
+
+#define DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+# 522 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET
+
+
+
+#define DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)
+# 1121 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_PORT_USED_COUNT 3
+#define DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK
+#define DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET
+# 35 "./src/main/drivers/io_def.h" 2
+# 87 "./src/main/drivers/io.h" 2
+
+
+# 88 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 88 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 89 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 89 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, resourceType_e resource, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+resourceType_e IOGetResources(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 20 "./src/main/drivers/serial.h" 2
+
+typedef struct {
+    ioTag_t rxPin;
+    ioTag_t txPin;
+} serialPortPins_t;
+
+typedef enum portMode_t {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_t;
+
+typedef enum portOptions_t {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 49 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_t;
+
+
+typedef struct serialBufChunk_s {
+    const uint8_t *data;
+    int count;
+} serialBufChunk_t;
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+typedef void (*serialReceiveFrameCallbackPtr)(const uint8_t *data, int count, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    uint8_t identifier;
+    portMode_t mode;
+    portOptions_t options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    serialReceiveFrameCallbackPtr rxFrameCallback;
+
+
+    uint32_t rxIrqCount;
+} serialPort_t;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 102 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 102 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_t mode);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    
+# 108 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 108 "./src/main/drivers/serial.h"
+        (*isConnected)(const serialPort_t *instance);
+
+    
+# 110 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 110 "./src/main/drivers/serial.h"
+        (*isIdle)(serialPort_t *instance);
+
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+
+
+    void (*writeBufChunks)(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+void serialSetReceiveFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr rxFrameCallback);
+void serialWriteBufChunks(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_t mode);
+
+# 129 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+# 132 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 132 "./src/main/drivers/serial.h"
+    serialIsConnected(const serialPort_t *instance);
+
+# 133 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/serial.h"
+    serialIsIdle(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 21 "./src/main/io/rcdevice.h" 2
+
+
+
+
+#define RCDEVICE_PROTOCOL_HEADER 0xCC
+
+#define RCDEVICE_PROTOCOL_MAX_PACKET_SIZE 64
+#define RCDEVICE_PROTOCOL_MAX_DATA_SIZE 20
+
+
+#define RCDEVICE_PROTOCOL_COMMAND_GET_DEVICE_INFO 0x00
+
+#define RCDEVICE_PROTOCOL_COMMAND_CAMERA_CONTROL 0x01
+
+#define RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_PRESS 0x02
+#define RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_RELEASE 0x03
+#define RCDEVICE_PROTOCOL_COMMAND_5KEY_CONNECTION 0x04
+
+
+#define RCSPLIT_PACKET_HEADER 0x55
+#define RCSPLIT_PACKET_CMD_CTRL 0x01
+#define RCSPLIT_PACKET_TAIL 0xaa
+
+
+typedef enum {
+    RCDEVICE_PROTOCOL_FEATURE_SIMULATE_POWER_BUTTON = (1 << 0),
+    RCDEVICE_PROTOCOL_FEATURE_SIMULATE_WIFI_BUTTON = (1 << 1),
+    RCDEVICE_PROTOCOL_FEATURE_CHANGE_MODE = (1 << 2),
+    RCDEVICE_PROTOCOL_FEATURE_SIMULATE_5_KEY_OSD_CABLE = (1 << 3),
+    RCDEVICE_PROTOCOL_FEATURE_START_RECORDING = (1 << 6),
+    RCDEVICE_PROTOCOL_FEATURE_STOP_RECORDING = (1 << 7),
+    RCDEVICE_PROTOCOL_FEATURE_CMS_MENU = (1 << 8),
+} rcdevice_features_e;
+
+
+typedef enum {
+    RCDEVICE_PROTOCOL_CAM_CTRL_SIMULATE_WIFI_BTN = 0x00,
+    RCDEVICE_PROTOCOL_CAM_CTRL_SIMULATE_POWER_BTN = 0x01,
+    RCDEVICE_PROTOCOL_CAM_CTRL_CHANGE_MODE = 0x02,
+    RCDEVICE_PROTOCOL_CAM_CTRL_START_RECORDING = 0x03,
+    RCDEVICE_PROTOCOL_CAM_CTRL_STOP_RECORDING = 0x04,
+    RCDEVICE_PROTOCOL_CAM_CTRL_UNKNOWN_CAMERA_OPERATION = 0xFF
+} rcdevice_camera_control_opeation_e;
+
+
+typedef enum {
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_NONE = 0x00,
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_SET = 0x01,
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_LEFT = 0x02,
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_RIGHT = 0x03,
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_UP = 0x04,
+    RCDEVICE_PROTOCOL_5KEY_SIMULATION_DOWN = 0x05
+} rcdevice_5key_simulation_operation_e;
+
+
+typedef enum {
+    RCDEVICE_PROTOCOL_5KEY_CONNECTION_OPEN = 0x01,
+    RCDEVICE_PROTOCOL_5KEY_CONNECTION_CLOSE = 0x02
+} RCDEVICE_5key_connection_event_e;
+
+typedef enum {
+    RCDEVICE_CAM_KEY_NONE,
+    RCDEVICE_CAM_KEY_ENTER,
+    RCDEVICE_CAM_KEY_LEFT,
+    RCDEVICE_CAM_KEY_UP,
+    RCDEVICE_CAM_KEY_RIGHT,
+    RCDEVICE_CAM_KEY_DOWN,
+    RCDEVICE_CAM_KEY_CONNECTION_CLOSE,
+    RCDEVICE_CAM_KEY_CONNECTION_OPEN,
+    RCDEVICE_CAM_KEY_RELEASE,
+} rcdeviceCamSimulationKeyEvent_e;
+
+typedef enum {
+    RCDEVICE_PROTOCOL_RCSPLIT_VERSION = 0x00,
+
+
+    RCDEVICE_PROTOCOL_VERSION_1_0 = 0x01,
+    RCDEVICE_PROTOCOL_UNKNOWN
+} rcdevice_protocol_version_e;
+
+
+
+typedef struct runcamDeviceInfo_s {
+    rcdevice_protocol_version_e protocolVersion;
+    uint16_t features;
+} runcamDeviceInfo_t;
+
+typedef struct runcamDevice_s {
+    serialPort_t *serialPort;
+    uint8_t buffer[64];
+    runcamDeviceInfo_t info;
+    
+# 112 "./src/main/io/rcdevice.h" 3 4
+   _Bool 
+# 112 "./src/main/io/rcdevice.h"
+        isReady;
+} runcamDevice_t;
+
+#define MAX_WAITING_RESPONSES 2
+
+typedef enum {
+    RCDEVICE_RESP_SUCCESS = 0,
+    RCDEVICE_RESP_INCORRECT_CRC = 1,
+    RCDEVICE_RESP_TIMEOUT = 2
+} rcdeviceResponseStatus_e;
+
+typedef struct rcdeviceResponseParsingContext_s rcdeviceResponseParsingContext_t;
+typedef void(*rcdeviceResponseCallback)(rcdeviceResponseParsingContext_t* context);
+
+typedef struct rcdeviceResponseParsingContext_s {
+    uint8_t command;
+    uint8_t expectedRespLen;
+    uint8_t recvRespLen;
+    uint8_t *recvBuf;
+    timeMs_t timeout;
+    timeMs_t timeoutTimestamp;
+    rcdeviceResponseCallback parserFunc;
+    runcamDevice_t *device;
+    uint8_t paramData[20];
+    uint8_t paramDataLen;
+    uint8_t protocolVersion;
+    int maxRetryTimes;
+    void *userInfo;
+    rcdeviceResponseStatus_e result;
+} rcdeviceResponseParsingContext_t;
+
+typedef struct {
+    uint8_t headPos;
+    uint8_t tailPos;
+    uint8_t itemCount;
+    rcdeviceResponseParsingContext_t buffer[2];
+    rcdeviceResponseCallback parseFunc;
+} rcdeviceWaitingResponseQueue;
+
+void runcamDeviceInit(runcamDevice_t *device);
+void rcdeviceReceive(timeUs_t currentTimeUs);
+
+
+
+# 155 "./src/main/io/rcdevice.h" 3 4
+_Bool 
+# 155 "./src/main/io/rcdevice.h"
+    runcamDeviceSimulateCameraButton(runcamDevice_t *device, uint8_t operation);
+
+
+void runcamDeviceOpen5KeyOSDCableConnection(runcamDevice_t *device, rcdeviceResponseCallback callback);
+void runcamDeviceClose5KeyOSDCableConnection(runcamDevice_t *device, rcdeviceResponseCallback callback);
+void runcamDeviceSimulate5KeyOSDCableButtonPress(runcamDevice_t *device, uint8_t operation, rcdeviceResponseCallback callback);
+void runcamDeviceSimulate5KeyOSDCableButtonRelease(runcamDevice_t *device, rcdeviceResponseCallback callback);
+# 27 "./src/main/io/rcdevice_cam.h" 2
+# 1 "./src/main/fc/rc_modes.h" 1
+# 18 "./src/main/fc/rc_modes.h"
+       
+
+
+
+# 1 "./src/main/common/bitarray.h" 1
+# 18 "./src/main/common/bitarray.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "./src/main/common/bitarray.h" 2
+
+
+
+
+
+
+
+typedef uint32_t bitarrayElement_t;
+
+#define BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]
+
+
+# 33 "./src/main/common/bitarray.h" 3 4
+_Bool 
+# 33 "./src/main/common/bitarray.h"
+    bitArrayGet(const bitarrayElement_t *array, unsigned bit);
+void bitArraySet(bitarrayElement_t *array, unsigned bit);
+void bitArrayClr(bitarrayElement_t *array, unsigned bit);
+
+void bitArraySetAll(bitarrayElement_t *array, size_t size);
+void bitArrayClrAll(bitarrayElement_t *array, size_t size);
+
+#define BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))
+#define BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))
+
+
+
+
+
+int bitArrayFindFirstSet(const bitarrayElement_t *array, unsigned start_bit, size_t size);
+
+#define BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))
+# 23 "./src/main/fc/rc_modes.h" 2
+
+
+
+#define BOXID_NONE 255
+
+typedef enum {
+    BOXARM = 0,
+    BOXANGLE = 1,
+    BOXHORIZON = 2,
+    BOXNAVALTHOLD = 3,
+    BOXHEADINGHOLD = 4,
+    BOXHEADFREE = 5,
+    BOXHEADADJ = 6,
+    BOXCAMSTAB = 7,
+    BOXNAVRTH = 8,
+    BOXNAVPOSHOLD = 9,
+    BOXMANUAL = 10,
+    BOXBEEPERON = 11,
+    BOXLEDLOW = 12,
+    BOXLIGHTS = 13,
+    BOXNAVLAUNCH = 14,
+    BOXOSD = 15,
+    BOXTELEMETRY = 16,
+    BOXBLACKBOX = 17,
+    BOXFAILSAFE = 18,
+    BOXNAVWP = 19,
+    BOXAIRMODE = 20,
+    BOXHOMERESET = 21,
+    BOXGCSNAV = 22,
+    BOXKILLSWITCH = 23,
+    BOXSURFACE = 24,
+    BOXFLAPERON = 25,
+    BOXTURNASSIST = 26,
+    BOXAUTOTRIM = 27,
+    BOXAUTOTUNE = 28,
+    BOXCAMERA1 = 29,
+    BOXCAMERA2 = 30,
+    BOXCAMERA3 = 31,
+    BOXOSDALT1 = 32,
+    BOXOSDALT2 = 33,
+    BOXOSDALT3 = 34,
+    BOXNAVCRUISE = 35,
+    BOXBRAKING = 36,
+    BOXUSER1 = 37,
+    BOXUSER2 = 38,
+    BOXFPVANGLEMIX = 39,
+    BOXLOITERDIRCHN = 40,
+    BOXMSPRCOVERRIDE = 41,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+
+typedef struct boxBitmask_s { bitarrayElement_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+
+#define MAX_MODE_ACTIVATION_CONDITION_COUNT 20
+
+#define CHANNEL_RANGE_MIN 900
+#define CHANNEL_RANGE_MAX 2100
+
+#define CHANNEL_RANGE_STEP_WIDTH 25
+
+#define MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)
+#define CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define MIN_MODE_RANGE_STEP 0
+#define MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)
+
+
+
+
+
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+} modeActivationCondition_t;
+
+typedef enum {
+    MODE_OPERATOR_OR,
+    MODE_OPERATOR_AND
+} modeActivationOperator_e;
+
+typedef struct modeActivationOperatorConfig_s {
+    modeActivationOperator_e modeActivationOperator;
+} modeActivationOperatorConfig_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+extern modeActivationOperatorConfig_t modeActivationOperatorConfig_System; extern modeActivationOperatorConfig_t modeActivationOperatorConfig_Copy; static inline const modeActivationOperatorConfig_t* modeActivationOperatorConfig(void) { return &modeActivationOperatorConfig_System; } static inline modeActivationOperatorConfig_t* modeActivationOperatorConfigMutable(void) { return &modeActivationOperatorConfig_System; } struct _dummy;
+
+
+# 119 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 119 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 122 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 122 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+void processAirmode(void);
+
+# 125 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 125 "./src/main/fc/rc_modes.h"
+    isUsingNavigationModes(void);
+
+# 126 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 126 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+
+void updateActivatedModes(void);
+void updateUsedModeActivationConditionFlags(void);
+void configureModeActivationCondition(int macIndex, boxId_e modeId, uint8_t auxChannelIndex, uint16_t startPwm, uint16_t endPwm);
+# 28 "./src/main/io/rcdevice_cam.h" 2
+
+#define FIVE_KEY_CABLE_JOYSTICK_MIN 1080
+#define FIVE_KEY_CABLE_JOYSTICK_MAX 1920
+#define FIVE_KEY_CABLE_JOYSTICK_MID_START 1350
+#define FIVE_KEY_CABLE_JOYSTICK_MID_END 1650
+
+typedef struct rcdeviceSwitchState_s {
+    
+# 35 "./src/main/io/rcdevice_cam.h" 3 4
+   _Bool 
+# 35 "./src/main/io/rcdevice_cam.h"
+        isActivated;
+} rcdeviceSwitchState_t;
+
+extern runcamDevice_t *camDevice;
+extern 
+# 39 "./src/main/io/rcdevice_cam.h" 3 4
+      _Bool 
+# 39 "./src/main/io/rcdevice_cam.h"
+           rcdeviceInMenu;
+
+void rcdeviceInit(void);
+void rcdeviceUpdate(timeUs_t currentTimeUs);
+
+
+# 44 "./src/main/io/rcdevice_cam.h" 3 4
+_Bool 
+# 44 "./src/main/io/rcdevice_cam.h"
+    rcdeviceIsEnabled(void);
+
+void rcdeviceSend5KeyOSDCableSimualtionEvent(rcdeviceCamSimulationKeyEvent_e key);
+# 71 "./src/main/cms/cms.c" 2
+
+# 1 "./src/main/rx/rx.h" 1
+# 18 "./src/main/rx/rx.h"
+       
+
+
+
+
+
+
+
+#define STICK_CHANNEL_COUNT 4
+
+#define PWM_RANGE_MIN 1000
+#define PWM_RANGE_MAX 2000
+#define PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))
+
+#define PWM_PULSE_MIN 750
+#define PWM_PULSE_MAX 2250
+
+#define MIDRC_MIN 1200
+#define MIDRC_MAX 1700
+
+#define RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)
+#define CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)
+#define MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)
+
+#define DEFAULT_SERVO_MIN 1000
+#define DEFAULT_SERVO_MIDDLE 1500
+#define DEFAULT_SERVO_MAX 2000
+
+#define DELAY_50_HZ (1000000 / 50)
+#define DELAY_10_HZ (1000000 / 10)
+#define DELAY_5_HZ (1000000 / 5)
+
+#define RSSI_MAX_VALUE 1023
+
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3),
+} rxFrameState_e;
+
+typedef enum {
+    RX_TYPE_NONE = 0,
+    RX_TYPE_PPM = 1,
+    RX_TYPE_SERIAL = 2,
+    RX_TYPE_MSP = 3,
+    RX_TYPE_SPI = 4,
+    RX_TYPE_UIB = 5
+} rxReceiverType_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_FPORT = 10,
+    SERIALRX_SBUS_FAST = 11,
+} rxSerialReceiverType_e;
+
+#define MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16
+#define MAX_SUPPORTED_RC_CHANNEL_COUNT 18
+
+#define NON_AUX_CHANNEL_COUNT 4
+#define MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)
+
+extern const char rcChannelLetters[];
+
+#define MAX_MAPPABLE_RX_INPUTS 4
+
+#define MAX_INVALID_RX_PULSE_TIME 300
+
+#define RSSI_VISIBLE_VALUE_MIN 0
+#define RSSI_VISIBLE_VALUE_MAX 100
+#define RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxConfig_s {
+    uint8_t receiverType;
+    uint8_t rcmap[4];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    uint8_t rx_spi_protocol;
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssiMin;
+    uint8_t rssiMax;
+    uint16_t sbusSyncInterval;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t rcFilterFrequency;
+    uint16_t mspOverrideChannels;
+    uint8_t rssi_source;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+
+#define REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))
+
+typedef struct rxRuntimeConfig_s rxRuntimeConfig_t;
+typedef uint16_t (*rcReadRawDataFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(rxRuntimeConfig_t *rxRuntimeConfig);
+typedef 
+# 137 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 137 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+typedef uint16_t (*rcGetLinkQualityPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+
+typedef struct rxLinkQualityTracker_s {
+    timeMs_t lastUpdatedMs;
+    uint32_t lqAccumulator;
+    uint32_t lqCount;
+    uint32_t lqValue;
+} rxLinkQualityTracker_e;
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    timeUs_t rxRefreshRate;
+    timeUs_t rxSignalTimeout;
+    
+# 151 "./src/main/rx/rx.h" 3 4
+   _Bool 
+# 151 "./src/main/rx/rx.h"
+        requireFiltering;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    rxLinkQualityTracker_e * lqTracker;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef struct rcChannel_s {
+    int16_t raw;
+    int16_t data;
+    timeMs_t expiresAt;
+} rcChannel_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_AUTO,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+} rssiSource_e;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void lqTrackerReset(rxLinkQualityTracker_e * lqTracker);
+void lqTrackerAccumulate(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+void lqTrackerSet(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+uint16_t lqTrackerGet(rxLinkQualityTracker_e * lqTracker);
+
+void rxInit(void);
+void rxUpdateRSSISource(void);
+
+# 184 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 184 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime);
+
+# 185 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 185 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 186 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 186 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 187 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 187 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+# 188 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 188 "./src/main/rx/rx.h"
+    isRxPulseValid(uint16_t pulseDuration);
+
+uint8_t calculateChannelRemapping(const uint8_t *channelMap, uint8_t channelMapEntryCount, uint8_t channelToRemap);
+void parseRcChannels(const char *input);
+
+void setRSSIFromMSP(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+
+uint16_t getRSSI(void);
+rssiSource_e getRSSISource(void);
+
+void resetAllRxChannelRangeConfigurations(void);
+
+void suspendRxSignal(void);
+void resumeRxSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+
+
+
+
+
+int16_t rxGetChannelValue(unsigned channelNumber);
+
+
+
+int16_t rxGetRawChannelValue(unsigned channelNumber);
+# 73 "./src/main/cms/cms.c" 2
+
+
+
+
+#define CMS_MAX_DEVICE 4
+
+
+
+
+static uint8_t entry_flags[32];
+
+#define IS_PRINTVALUE(p,row) (entry_flags[row] & PRINT_VALUE)
+#define SET_PRINTVALUE(p,row) { entry_flags[row] |= PRINT_VALUE; }
+#define CLR_PRINTVALUE(p,row) { entry_flags[row] &= ~PRINT_VALUE; }
+
+#define IS_PRINTLABEL(p,row) (entry_flags[row] & PRINT_LABEL)
+#define SET_PRINTLABEL(p,row) { entry_flags[row] |= PRINT_LABEL; }
+#define CLR_PRINTLABEL(p,row) { entry_flags[row] &= ~PRINT_LABEL; }
+
+#define IS_DYNAMIC(p) ((p)->flags & DYNAMIC)
+#define IS_READONLY(p) ((p)->flags & READONLY)
+
+#define SETTING_INVALID_VALUE_NAME "INVALID"
+
+static displayPort_t *pCurrentDisplay;
+
+static displayPort_t *cmsDisplayPorts[4];
+static int cmsDeviceCount;
+static int cmsCurrentDevice = -1;
+static timeMs_t cmsYieldUntil = 0;
+
+
+# 104 "./src/main/cms/cms.c" 3 4
+_Bool 
+# 104 "./src/main/cms/cms.c"
+    cmsDisplayPortRegister(displayPort_t *pDisplay)
+{
+    if (cmsDeviceCount == 4)
+        return 
+# 107 "./src/main/cms/cms.c" 3 4
+              0
+# 107 "./src/main/cms/cms.c"
+                   ;
+
+    cmsDisplayPorts[cmsDeviceCount++] = pDisplay;
+
+    return 
+# 111 "./src/main/cms/cms.c" 3 4
+          1
+# 111 "./src/main/cms/cms.c"
+              ;
+}
+
+static displayPort_t *cmsDisplayPortSelectCurrent(void)
+{
+    if (cmsDeviceCount == 0)
+        return 
+# 117 "./src/main/cms/cms.c" 3 4
+              ((void *)0)
+# 117 "./src/main/cms/cms.c"
+                  ;
+
+    if (cmsCurrentDevice < 0)
+        cmsCurrentDevice = 0;
+
+    return cmsDisplayPorts[cmsCurrentDevice];
+}
+
+static displayPort_t *cmsDisplayPortSelectNext(void)
+{
+    if (cmsDeviceCount == 0)
+        return 
+# 128 "./src/main/cms/cms.c" 3 4
+              ((void *)0)
+# 128 "./src/main/cms/cms.c"
+                  ;
+
+    cmsCurrentDevice = (cmsCurrentDevice + 1) % cmsDeviceCount;
+
+    return cmsDisplayPorts[cmsCurrentDevice];
+}
+
+
+# 135 "./src/main/cms/cms.c" 3 4
+_Bool 
+# 135 "./src/main/cms/cms.c"
+    cmsDisplayPortSelect(displayPort_t *instance)
+{
+    if (cmsDeviceCount == 0) {
+        return 
+# 138 "./src/main/cms/cms.c" 3 4
+              0
+# 138 "./src/main/cms/cms.c"
+                   ;
+    }
+    for (int i = 0; i < cmsDeviceCount; i++) {
+        if (cmsDisplayPortSelectNext() == instance) {
+            return 
+# 142 "./src/main/cms/cms.c" 3 4
+                  1
+# 142 "./src/main/cms/cms.c"
+                      ;
+        }
+    }
+    return 
+# 145 "./src/main/cms/cms.c" 3 4
+          0
+# 145 "./src/main/cms/cms.c"
+               ;
+}
+
+displayPort_t *cmsDisplayPortGetCurrent(void)
+{
+    return pCurrentDisplay;
+}
+
+#define CMS_UPDATE_INTERVAL_US 50000
+#define CMS_POLL_INTERVAL_US 100000
+# 172 "./src/main/cms/cms.c"
+#define NORMAL_SCREEN_MIN_COLS 18
+static 
+# 173 "./src/main/cms/cms.c" 3 4
+      _Bool 
+# 173 "./src/main/cms/cms.c"
+           smallScreen;
+static uint8_t leftMenuColumn;
+static uint8_t rightMenuColumn;
+static uint8_t maxMenuItems;
+static uint8_t linesPerMenuItem;
+static cms_key_e externKey = CMS_KEY_NONE;
+
+
+# 180 "./src/main/cms/cms.c" 3 4
+_Bool 
+# 180 "./src/main/cms/cms.c"
+    cmsInMenu = 
+# 180 "./src/main/cms/cms.c" 3 4
+                0
+# 180 "./src/main/cms/cms.c"
+                     ;
+
+typedef struct cmsCtx_s {
+    const CMS_Menu *menu;
+    uint8_t page;
+    int8_t cursorRow;
+} cmsCtx_t;
+
+static cmsCtx_t menuStack[10];
+static uint8_t menuStackIdx = 0;
+
+static int8_t pageCount;
+static const OSD_Entry *pageTop;
+static uint8_t pageMaxRow;
+
+static cmsCtx_t currentCtx;
+# 226 "./src/main/cms/cms.c"
+#define cmsPageDebug() 
+
+
+static void cmsUpdateMaxRow(displayPort_t *instance)
+{
+    (void)(instance);
+    pageMaxRow = 0;
+
+    for (const OSD_Entry *ptr = pageTop; ptr->type != OME_END; ptr++) {
+        pageMaxRow++;
+        if (ptr->type == OME_BACK_AND_END) {
+            break;
+        }
+    }
+
+    if (pageMaxRow > maxMenuItems) {
+        pageMaxRow = maxMenuItems;
+    }
+
+    pageMaxRow--;
+}
+
+static uint8_t cmsCursorAbsolute(displayPort_t *instance)
+{
+    (void)(instance);
+    return currentCtx.cursorRow + currentCtx.page * maxMenuItems;
+}
+
+static void cmsPageSelect(displayPort_t *instance, int8_t newpage)
+{
+    currentCtx.page = (newpage + pageCount) % pageCount;
+    pageTop = &currentCtx.menu->entries[currentCtx.page * maxMenuItems];
+    cmsUpdateMaxRow(instance);
+    displayClearScreen(instance);
+}
+
+static void cmsPageNext(displayPort_t *instance)
+{
+    cmsPageSelect(instance, currentCtx.page + 1);
+}
+
+static void cmsPagePrev(displayPort_t *instance)
+{
+    cmsPageSelect(instance, currentCtx.page - 1);
+}
+
+static 
+# 272 "./src/main/cms/cms.c" 3 4
+      _Bool 
+# 272 "./src/main/cms/cms.c"
+           cmsElementIsLabel(OSD_MenuElement element)
+{
+    return element == OME_Label || element == OME_LabelFunc;
+}
+
+static void cmsFormatFloat(int32_t value, char *floatString)
+{
+    uint8_t k;
+
+
+    itoa(100000 + value, floatString, 10);
+
+
+
+    floatString[0] = floatString[1];
+    floatString[1] = floatString[2];
+    floatString[2] = '.';
+
+
+
+
+    for (k = 5; k > 3; k--)
+        if (floatString[k] == '0' || floatString[k] == '.')
+            floatString[k] = 0;
+        else
+            break;
+
+
+    if (floatString[0] == '0')
+        floatString[0] = ' ';
+}
+
+
+static void cmsPadLeftToSize(char *buf, int size)
+{
+    int i, j;
+    int len = strlen(buf);
+
+    for (i = size - 1, j = size - len; i - j >= 0; i--) {
+        buf[i] = buf[i - j];
+    }
+
+    for (; i >= 0; i--) {
+        buf[i] = ' ';
+    }
+
+    buf[size] = 0;
+}
+
+static void cmsPadToSize(char *buf, int size)
+{
+
+    buf[size] = 0x00,
+
+    cmsPadLeftToSize(buf, size);
+}
+
+static int cmsDrawMenuItemValue(displayPort_t *pDisplay, char *buff, uint8_t row, uint8_t maxSize)
+{
+    int colpos;
+    int cnt;
+
+    cmsPadToSize(buff, maxSize);
+    colpos = rightMenuColumn - maxSize;
+    cnt = displayWrite(pDisplay, colpos, row, buff);
+    return cnt;
+}
+
+static int cmsDrawMenuEntry(displayPort_t *pDisplay, const OSD_Entry *p, uint8_t row, uint8_t screenRow)
+{
+#define CMS_DRAW_BUFFER_LEN 12
+#define CMS_NUM_FIELD_LEN 5
+#define CMS_CURSOR_BLINK_DELAY_MS 500
+
+    char buff[12 + 1];
+    int cnt = 0;
+
+    if (smallScreen) {
+        row++;
+    }
+
+    switch (p->type) {
+    case OME_String:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            strncpy(buff, p->data, 12);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 12);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_Submenu:
+    case OME_Funcall:
+        if ((entry_flags[screenRow] & (1 << 0))) {
+            buff[0] = 0x0;
+            if ((p->type == OME_Submenu) && p->func && (p->flags & (1 << 3))) {
+
+
+                char *str = p->menufunc();
+                strncpy(buff, str, 12);
+            }
+            strncat(buff, ">", 12);
+
+            row = smallScreen ? row - 1 : row;
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, strlen(buff));
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_Bool:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            if (*((uint8_t *)(p->data))) {
+                strcpy(buff, "YES");
+            } else {
+                strcpy(buff, "NO");
+            }
+
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_BoolFunc:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            
+# 395 "./src/main/cms/cms.c" 3 4
+           _Bool 
+# 395 "./src/main/cms/cms.c"
+                (*func)(
+# 395 "./src/main/cms/cms.c" 3 4
+                        _Bool 
+# 395 "./src/main/cms/cms.c"
+                             *arg) = p->data;
+            if (func(
+# 396 "./src/main/cms/cms.c" 3 4
+                    ((void *)0)
+# 396 "./src/main/cms/cms.c"
+                        )) {
+                strcpy(buff, "YES");
+            } else {
+                strcpy(buff, "NO");
+            }
+
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 3);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_TAB:
+        if ((entry_flags[screenRow] & (1 << 0))) {
+            const OSD_TAB_t *ptr = p->data;
+            char * str = (char *)ptr->names[*ptr->val];
+            strncpy(buff, str, 12);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 12);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_UINT8:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            const uint8_t *val;
+            if (((p)->flags & (1 << 4))) {
+                val = p->data;
+            } else {
+                const OSD_UINT8_t *ptr = p->data;
+                val = ptr->val;
+            }
+            itoa(*val, buff, 10);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 5);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_INT8:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            const int8_t *val;
+            if (((p)->flags & (1 << 4))) {
+                val = p->data;
+            } else {
+                const OSD_INT8_t *ptr = p->data;
+                val = ptr->val;
+            }
+            itoa(*val, buff, 10);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 5);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_UINT16:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            const uint16_t *val;
+            if (((p)->flags & (1 << 4))) {
+                val = p->data;
+            } else {
+                const OSD_UINT16_t *ptr = p->data;
+                val = ptr->val;
+            }
+            itoa(*val, buff, 10);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 5);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_INT16:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            const int16_t *val;
+            if (((p)->flags & (1 << 4))) {
+                val = p->data;
+            } else {
+                const OSD_INT16_t *ptr = p->data;
+                val = ptr->val;
+            }
+            itoa(*val, buff, 10);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 5);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_FLOAT:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            const OSD_FLOAT_t *ptr = p->data;
+            cmsFormatFloat(*ptr->val * ptr->multipler, buff);
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, 5);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_Setting:
+        if ((entry_flags[screenRow] & (1 << 0)) && p->data) {
+            uint8_t maxSize = 5;
+            buff[0] = '\0';
+            const OSD_SETTING_t *ptr = p->data;
+            const setting_t *var = settingGet(ptr->val);
+            int32_t value = 0;
+            const void *valuePointer = settingGetValuePointer(var);
+            switch (SETTING_TYPE(var)) {
+                case VAR_UINT8:
+                    value = *(uint8_t *)valuePointer;
+                    break;
+                case VAR_INT8:
+                    value = *(int8_t *)valuePointer;
+                    break;
+                case VAR_UINT16:
+                    value = *(uint16_t *)valuePointer;
+                    break;
+                case VAR_INT16:
+                    value = *(int16_t *)valuePointer;
+                    break;
+                case VAR_UINT32:
+                    value = *(uint32_t *)valuePointer;
+                    break;
+                case VAR_FLOAT:
+
+
+
+                    ftoa(*(float *)valuePointer, buff);
+                    break;
+                case VAR_STRING:
+                    strncpy(buff, valuePointer, sizeof(buff));
+                    break;
+            }
+            if (buff[0] == '\0') {
+                const char *suffix = 
+# 521 "./src/main/cms/cms.c" 3 4
+                                    ((void *)0)
+# 521 "./src/main/cms/cms.c"
+                                        ;
+                switch (CMS_DATA_TYPE(p)) {
+                    case CMS_DATA_TYPE_ANGULAR_RATE:
+
+                        value *= 10;
+                        suffix = " DPS";
+                        break;
+                }
+                switch (SETTING_MODE(var)) {
+                    case MODE_DIRECT:
+                        if (SETTING_TYPE(var) == VAR_UINT32) {
+                            tfp_sprintf(buff, "%u", (unsigned)value);
+                        } else {
+                            tfp_sprintf(buff, "%d", (int)value);
+                        }
+                        break;
+                    case MODE_LOOKUP:
+                        {
+                            const char *str = settingLookupValueName(var, value);
+                            strncpy(buff, str ? str : "INVALID", sizeof(buff) - 1);
+                            maxSize = ( __extension__ ({ __typeof__(settingGetValueNameMaxSize(var)) _left0 = (settingGetValueNameMaxSize(var)); __typeof__(strlen("INVALID")) _right1 = (strlen("INVALID")); _left0 > _right1 ? _left0 : _right1; }));
+                        }
+                        break;
+                }
+                if (suffix) {
+                    strcat(buff, suffix);
+                }
+            }
+            cnt = cmsDrawMenuItemValue(pDisplay, buff, row, maxSize);
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_Label:
+    case OME_LabelFunc:
+        if ((entry_flags[screenRow] & (1 << 0))) {
+
+            const char *text = p->data;
+            if (p->type == OME_LabelFunc) {
+
+                
+# 561 "./src/main/cms/cms.c" 3 4
+               _Bool 
+# 561 "./src/main/cms/cms.c"
+                    (*label_func)(char *buf, unsigned size) = p->data;
+                if (label_func(buff, sizeof(buff))) {
+                    text = buff;
+                } else {
+                    text = 
+# 565 "./src/main/cms/cms.c" 3 4
+                          ((void *)0)
+# 565 "./src/main/cms/cms.c"
+                              ;
+                }
+            }
+            if (text) {
+                cnt = displayWrite(pDisplay,
+                        leftMenuColumn + 1 + (uint8_t) strlen(p->text), row, text);
+            }
+            { entry_flags[screenRow] &= ~(1 << 0); };
+        }
+        break;
+
+    case OME_OSD_Exit:
+    case OME_END:
+    case OME_Back:
+    case OME_BACK_AND_END:
+        break;
+
+    case OME_MENU:
+
+    default:
+
+
+
+
+        break;
+    }
+
+    return cnt;
+}
+
+static void cmsDrawMenu(displayPort_t *pDisplay, uint32_t currentTimeUs)
+{
+    if (!pageTop)
+        return;
+
+    uint8_t i;
+    const OSD_Entry *p;
+    uint8_t top = smallScreen ? 1 : (pDisplay->rows - pageMaxRow) / 2;
+
+
+
+    
+# 606 "./src/main/cms/cms.c" 3 4
+   _Bool 
+# 606 "./src/main/cms/cms.c"
+        drawPolled = 
+# 606 "./src/main/cms/cms.c" 3 4
+                     0
+# 606 "./src/main/cms/cms.c"
+                          ;
+    static uint32_t lastPolledUs = 0;
+
+    if (currentTimeUs > lastPolledUs + 100000) {
+        drawPolled = 
+# 610 "./src/main/cms/cms.c" 3 4
+                    1
+# 610 "./src/main/cms/cms.c"
+                        ;
+        lastPolledUs = currentTimeUs;
+    }
+
+    uint32_t room = displayTxBytesFree(pDisplay);
+
+    if (pDisplay->cleared) {
+
+        memset(entry_flags, (1 << 1) | (1 << 0), sizeof(entry_flags));
+        pDisplay->cleared = 
+# 619 "./src/main/cms/cms.c" 3 4
+                           0
+# 619 "./src/main/cms/cms.c"
+                                ;
+    } else if (drawPolled) {
+        for (p = pageTop, i = 0; p <= pageTop + pageMaxRow; p++, i++) {
+            if (((p)->flags & (1 << 2)))
+                { entry_flags[i] |= (1 << 0); };
+        }
+    }
+
+
+
+    while (cmsElementIsLabel((pageTop + currentCtx.cursorRow)->type))
+        currentCtx.cursorRow++;
+
+    ;
+
+    if (pDisplay->cursorRow >= 0 && currentCtx.cursorRow != pDisplay->cursorRow) {
+        room -= displayWrite(pDisplay, leftMenuColumn, top + pDisplay->cursorRow * linesPerMenuItem, " ");
+    }
+
+    if (room < 30)
+        return;
+
+    if (pDisplay->cursorRow != currentCtx.cursorRow) {
+        room -= displayWrite(pDisplay, leftMenuColumn, top + currentCtx.cursorRow * linesPerMenuItem, ">");
+        pDisplay->cursorRow = currentCtx.cursorRow;
+    }
+
+    if (room < 30)
+        return;
+
+
+    for (i = 0, p = pageTop; i < maxMenuItems && p->type != OME_END; i++, p++) {
+        if ((entry_flags[i] & (1 << 1))) {
+            uint8_t coloff = leftMenuColumn;
+            coloff += cmsElementIsLabel(p->type) ? 0 : 1;
+            room -= displayWrite(pDisplay, coloff, top + i * linesPerMenuItem, p->text);
+            { entry_flags[i] &= ~(1 << 1); };
+            if (room < 30) {
+                return;
+            }
+        }
+        if (p->type == OME_BACK_AND_END) {
+            break;
+        }
+    }
+
+
+
+
+    for (i = 0, p = pageTop; i < maxMenuItems && p->type != OME_END; i++, p++) {
+        if ((entry_flags[i] & (1 << 0))) {
+            room -= cmsDrawMenuEntry(pDisplay, p, top + i * linesPerMenuItem, i);
+            if (room < 30) {
+                return;
+            }
+        }
+        if (p->type == OME_BACK_AND_END) {
+            break;
+        }
+    }
+}
+
+static void cmsMenuCountPage(displayPort_t *pDisplay)
+{
+    (void)(pDisplay);
+    const OSD_Entry *p;
+    for (p = currentCtx.menu->entries; p->type != OME_END; p++) {
+        if (p->type == OME_BACK_AND_END) {
+            p++;
+            break;
+        }
+    }
+    pageCount = (p - currentCtx.menu->entries - 1) / maxMenuItems + 1;
+}
+
+static long cmsMenuBack(displayPort_t *pDisplay);
+
+long cmsMenuChange(displayPort_t *pDisplay, const CMS_Menu *pMenu, const OSD_Entry *from)
+{
+    if (!pMenu) {
+        return 0;
+    }
+# 714 "./src/main/cms/cms.c"
+    if (pMenu != currentCtx.menu) {
+
+
+        menuStack[menuStackIdx++] = currentCtx;
+
+        currentCtx.menu = pMenu;
+        currentCtx.cursorRow = 0;
+
+        if (pMenu->onEnter && (pMenu->onEnter(from) == (-1))) {
+            return cmsMenuBack(pDisplay);
+        }
+
+        cmsMenuCountPage(pDisplay);
+        cmsPageSelect(pDisplay, 0);
+    } else {
+
+
+
+        int8_t cursorAbs = currentCtx.cursorRow;
+        currentCtx.cursorRow = cursorAbs % maxMenuItems;
+        cmsMenuCountPage(pDisplay);
+        cmsPageSelect(pDisplay, cursorAbs / maxMenuItems);
+    }
+
+    ;
+
+    return 0;
+}
+
+static long cmsMenuBack(displayPort_t *pDisplay)
+{
+
+
+    if (currentCtx.menu->onExit && currentCtx.menu->onExit(pageTop + currentCtx.cursorRow) < 0) {
+        return -1;
+    }
+
+    if (!menuStackIdx) {
+        return 0;
+    }
+
+    currentCtx = menuStack[--menuStackIdx];
+
+    cmsMenuCountPage(pDisplay);
+    cmsPageSelect(pDisplay, currentCtx.page);
+
+    ;
+
+    return 0;
+}
+
+void cmsMenuOpen(void)
+{
+    if (!cmsInMenu) {
+
+        setServoOutputEnabled(
+# 769 "./src/main/cms/cms.c" 3 4
+                             0
+# 769 "./src/main/cms/cms.c"
+                                  );
+        pCurrentDisplay = cmsDisplayPortSelectCurrent();
+        if (!pCurrentDisplay)
+            return;
+        cmsInMenu = 
+# 773 "./src/main/cms/cms.c" 3 4
+                   1
+# 773 "./src/main/cms/cms.c"
+                       ;
+        currentCtx = (cmsCtx_t){ &menuMain, 0, 0 };
+        (armingFlags |= (ARMING_DISABLED_CMS_MENU));
+    } else {
+
+        displayPort_t *pNextDisplay = cmsDisplayPortSelectNext();
+        if (pNextDisplay != pCurrentDisplay) {
+
+
+            currentCtx.cursorRow = cmsCursorAbsolute(pCurrentDisplay);
+            displayRelease(pCurrentDisplay);
+            pCurrentDisplay = pNextDisplay;
+        } else {
+            return;
+        }
+    }
+    displayGrab(pCurrentDisplay);
+
+    if (pCurrentDisplay->cols < 18) {
+        smallScreen = 
+# 792 "./src/main/cms/cms.c" 3 4
+                     1
+# 792 "./src/main/cms/cms.c"
+                         ;
+        linesPerMenuItem = 2;
+        leftMenuColumn = 0;
+        rightMenuColumn = pCurrentDisplay->cols;
+        maxMenuItems = (pCurrentDisplay->rows) / linesPerMenuItem;
+    } else {
+        smallScreen = 
+# 798 "./src/main/cms/cms.c" 3 4
+                     0
+# 798 "./src/main/cms/cms.c"
+                          ;
+        linesPerMenuItem = 1;
+        leftMenuColumn = 2;
+        rightMenuColumn = pCurrentDisplay->cols - 2;
+        maxMenuItems = pCurrentDisplay->rows - 2;
+    }
+
+    if (pCurrentDisplay->useFullscreen) {
+        leftMenuColumn = 0;
+        rightMenuColumn = pCurrentDisplay->cols;
+        maxMenuItems = pCurrentDisplay->rows;
+    }
+
+    cmsMenuChange(pCurrentDisplay, currentCtx.menu, 
+# 811 "./src/main/cms/cms.c" 3 4
+                                                   ((void *)0)
+# 811 "./src/main/cms/cms.c"
+                                                       );
+}
+
+static void cmsTraverseGlobalExit(const CMS_Menu *pMenu)
+{
+    for (const OSD_Entry *p = pMenu->entries; p->type != OME_END; p++) {
+        if (p->type == OME_Submenu) {
+            cmsTraverseGlobalExit(p->data);
+        }
+        if (p->type == OME_BACK_AND_END) {
+            break;
+        }
+    }
+
+    if (pMenu->onGlobalExit) {
+        pMenu->onGlobalExit(
+# 826 "./src/main/cms/cms.c" 3 4
+                           ((void *)0)
+# 826 "./src/main/cms/cms.c"
+                               );
+    }
+}
+
+long cmsMenuExit(displayPort_t *pDisplay, const void *ptr)
+{
+    int exitType = (int)ptr;
+    switch (exitType) {
+    case (1):
+    case (2):
+    case (3):
+    case (4):
+
+        cmsTraverseGlobalExit(&menuMain);
+
+        if (currentCtx.menu->onExit)
+            currentCtx.menu->onExit((OSD_Entry *)
+# 842 "./src/main/cms/cms.c" 3 4
+                                                ((void *)0)
+# 842 "./src/main/cms/cms.c"
+                                                    );
+
+        if ((exitType == (3)) || (exitType == (4))) {
+
+            for (int i = menuStackIdx - 1; i >= 0; i--) {
+                if (menuStack[i].menu->onExit) {
+                    menuStack[i].menu->onExit((OSD_Entry *) 
+# 848 "./src/main/cms/cms.c" 3 4
+                                                           ((void *)0)
+# 848 "./src/main/cms/cms.c"
+                                                               );
+                }
+            }
+        }
+
+        saveConfigAndNotify();
+        break;
+
+    case (0):
+        break;
+    }
+
+    cmsInMenu = 
+# 860 "./src/main/cms/cms.c" 3 4
+               0
+# 860 "./src/main/cms/cms.c"
+                    ;
+
+    displayRelease(pDisplay);
+    currentCtx.menu = 
+# 863 "./src/main/cms/cms.c" 3 4
+                     ((void *)0)
+# 863 "./src/main/cms/cms.c"
+                         ;
+
+    setServoOutputEnabled(
+# 865 "./src/main/cms/cms.c" 3 4
+                         1
+# 865 "./src/main/cms/cms.c"
+                             );
+
+    if ((exitType == (2)) || (exitType == (4))) {
+        displayClearScreen(pDisplay);
+        displayWrite(pDisplay, 5, 3, "REBOOTING...");
+
+        displayResync(pDisplay);
+
+        fcReboot(
+# 873 "./src/main/cms/cms.c" 3 4
+                0
+# 873 "./src/main/cms/cms.c"
+                     );
+    }
+
+    (armingFlags &= ~(ARMING_DISABLED_CMS_MENU));
+
+    return 0;
+}
+
+void cmsYieldDisplay(displayPort_t *pPort, timeMs_t duration)
+{
+
+
+
+    if (cmsYieldUntil == 0) {
+        displayRelease(pPort);
+    }
+    cmsYieldUntil = millis() + duration;
+}
+
+
+
+#define IS_HI(X) (rxGetChannelValue(X) > 1750)
+#define IS_LO(X) (rxGetChannelValue(X) < 1250)
+#define IS_MID(X) (rxGetChannelValue(X) > 1250 && rxGetChannelValue(X) < 1750)
+
+#define BUTTON_TIME 250
+#define BUTTON_PAUSE 500
+
+static uint16_t cmsHandleKey(displayPort_t *pDisplay, uint8_t key)
+{
+    uint16_t res = 250;
+    const OSD_Entry *p;
+
+    if (!currentCtx.menu)
+        return res;
+
+    if (key == CMS_KEY_MENU) {
+        cmsMenuOpen();
+        return 500;
+    }
+
+    if (key == CMS_KEY_ESC) {
+        cmsMenuBack(pDisplay);
+        return 500;
+    }
+
+    if (key == CMS_KEY_SAVEMENU) {
+        cmsMenuChange(pDisplay, &cmsx_menuSaveExit, 
+# 920 "./src/main/cms/cms.c" 3 4
+                                                   ((void *)0)
+# 920 "./src/main/cms/cms.c"
+                                                       );
+        return 500;
+    }
+
+    if (key == CMS_KEY_DOWN) {
+        if (currentCtx.cursorRow < pageMaxRow) {
+            currentCtx.cursorRow++;
+        } else {
+            cmsPageNext(pDisplay);
+            currentCtx.cursorRow = 0;
+        }
+    }
+
+    if (key == CMS_KEY_UP) {
+        currentCtx.cursorRow--;
+
+
+        if (cmsElementIsLabel((pageTop + currentCtx.cursorRow)->type) && currentCtx.cursorRow > 0)
+            currentCtx.cursorRow--;
+
+        if (currentCtx.cursorRow == -1 || cmsElementIsLabel((pageTop + currentCtx.cursorRow)->type)) {
+
+            cmsPagePrev(pDisplay);
+            currentCtx.cursorRow = pageMaxRow;
+        }
+    }
+
+    if (key == CMS_KEY_DOWN || key == CMS_KEY_UP)
+        return res;
+
+    p = pageTop + currentCtx.cursorRow;
+
+    switch (p->type) {
+        case OME_Submenu:
+            if (key == CMS_KEY_RIGHT) {
+                cmsMenuChange(pDisplay, p->data, p);
+                res = 500;
+            }
+            break;
+
+        case OME_Funcall:
+            if (p->func && key == CMS_KEY_RIGHT) {
+                long retval = p->func(pDisplay, p->data);
+                if (retval == (-1))
+                    cmsMenuBack(pDisplay);
+                res = 500;
+            }
+            break;
+
+        case OME_OSD_Exit:
+            if (p->func && key == CMS_KEY_RIGHT) {
+                p->func(pDisplay, p->data);
+                res = 500;
+            }
+            break;
+
+        case OME_Back:
+        case OME_BACK_AND_END:
+            cmsMenuBack(pDisplay);
+            res = 500;
+            break;
+
+        case OME_Bool:
+            if (p->data) {
+                uint8_t *val = (uint8_t *)p->data;
+                if (key == CMS_KEY_RIGHT)
+                    *val = 1;
+                else
+                    *val = 0;
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_BoolFunc:
+            if (p->data) {
+                
+# 998 "./src/main/cms/cms.c" 3 4
+               _Bool 
+# 998 "./src/main/cms/cms.c"
+                    (*func)(
+# 998 "./src/main/cms/cms.c" 3 4
+                            _Bool 
+# 998 "./src/main/cms/cms.c"
+                                 *arg) = p->data;
+                
+# 999 "./src/main/cms/cms.c" 3 4
+               _Bool 
+# 999 "./src/main/cms/cms.c"
+                    val = key == CMS_KEY_RIGHT;
+                func(&val);
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+            }
+            break;
+
+        case OME_UINT8:
+        case OME_FLOAT:
+            if (((p)->flags & (1 << 4))) {
+                break;
+            }
+            if (p->data) {
+                const OSD_UINT8_t *ptr = p->data;
+                if (key == CMS_KEY_RIGHT) {
+                    if (*ptr->val < ptr->max)
+                        *ptr->val += ptr->step;
+                } else {
+                    if (*ptr->val > ptr->min)
+                        *ptr->val -= ptr->step;
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_TAB:
+            if (p->type == OME_TAB) {
+                const OSD_TAB_t *ptr = p->data;
+
+                if (key == CMS_KEY_RIGHT) {
+                    if (*ptr->val < ptr->max)
+                        *ptr->val += 1;
+                } else {
+                    if (*ptr->val > 0)
+                        *ptr->val -= 1;
+                }
+                if (p->func) {
+                    p->func(pDisplay, p->data);
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+            }
+            break;
+
+        case OME_INT8:
+            if (((p)->flags & (1 << 4))) {
+                break;
+            }
+            if (p->data) {
+                const OSD_INT8_t *ptr = p->data;
+                if (key == CMS_KEY_RIGHT) {
+                    if (*ptr->val < ptr->max)
+                        *ptr->val += ptr->step;
+                } else {
+                    if (*ptr->val > ptr->min)
+                        *ptr->val -= ptr->step;
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_UINT16:
+            if (((p)->flags & (1 << 4))) {
+                break;
+            }
+            if (p->data) {
+                const OSD_UINT16_t *ptr = p->data;
+                if (key == CMS_KEY_RIGHT) {
+                    if (*ptr->val < ptr->max)
+                        *ptr->val += ptr->step;
+                } else {
+                    if (*ptr->val > ptr->min)
+                        *ptr->val -= ptr->step;
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_INT16:
+            if (((p)->flags & (1 << 4))) {
+                break;
+            }
+            if (p->data) {
+                const OSD_INT16_t *ptr = p->data;
+                if (key == CMS_KEY_RIGHT) {
+                    if (*ptr->val < ptr->max)
+                        *ptr->val += ptr->step;
+                } else {
+                    if (*ptr->val > ptr->min)
+                        *ptr->val -= ptr->step;
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_Setting:
+            if (p->data) {
+                const OSD_SETTING_t *ptr = p->data;
+                const setting_t *var = settingGet(ptr->val);
+                setting_min_t min = settingGetMin(var);
+                setting_max_t max = settingGetMax(var);
+                float step = ptr->step ?: 1;
+                if (key != CMS_KEY_RIGHT) {
+                    step = -step;
+                }
+                const void *valuePointer = settingGetValuePointer(var);
+                switch (SETTING_TYPE(var)) {
+                    case VAR_UINT8:
+                        {
+                            uint8_t val = *(uint8_t *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left2 = (val + step); __typeof__((uint8_t)min) _right3 = ((uint8_t)min); _left2 > _right3 ? _left2 : _right3; }))) _left4 = (( __extension__ ({ __typeof__(val + step) _left2 = (val + step); __typeof__((uint8_t)min) _right3 = ((uint8_t)min); _left2 > _right3 ? _left2 : _right3; }))); __typeof__((uint8_t)max) _right5 = ((uint8_t)max); _left4 < _right5 ? _left4 : _right5; }));
+                            *(uint8_t *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_INT8:
+                        {
+                            int8_t val = *(int8_t *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left6 = (val + step); __typeof__((int8_t)min) _right7 = ((int8_t)min); _left6 > _right7 ? _left6 : _right7; }))) _left8 = (( __extension__ ({ __typeof__(val + step) _left6 = (val + step); __typeof__((int8_t)min) _right7 = ((int8_t)min); _left6 > _right7 ? _left6 : _right7; }))); __typeof__((int8_t)max) _right9 = ((int8_t)max); _left8 < _right9 ? _left8 : _right9; }));
+                            *(int8_t *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_UINT16:
+                        {
+                            uint16_t val = *(uint16_t *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left10 = (val + step); __typeof__((uint16_t)min) _right11 = ((uint16_t)min); _left10 > _right11 ? _left10 : _right11; }))) _left12 = (( __extension__ ({ __typeof__(val + step) _left10 = (val + step); __typeof__((uint16_t)min) _right11 = ((uint16_t)min); _left10 > _right11 ? _left10 : _right11; }))); __typeof__((uint16_t)max) _right13 = ((uint16_t)max); _left12 < _right13 ? _left12 : _right13; }));
+                            *(uint16_t *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_INT16:
+                        {
+                            int16_t val = *(int16_t *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left14 = (val + step); __typeof__((int16_t)min) _right15 = ((int16_t)min); _left14 > _right15 ? _left14 : _right15; }))) _left16 = (( __extension__ ({ __typeof__(val + step) _left14 = (val + step); __typeof__((int16_t)min) _right15 = ((int16_t)min); _left14 > _right15 ? _left14 : _right15; }))); __typeof__((int16_t)max) _right17 = ((int16_t)max); _left16 < _right17 ? _left16 : _right17; }));
+                            *(int16_t *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_UINT32:
+                        {
+                            uint32_t val = *(uint32_t *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left18 = (val + step); __typeof__((uint32_t)min) _right19 = ((uint32_t)min); _left18 > _right19 ? _left18 : _right19; }))) _left20 = (( __extension__ ({ __typeof__(val + step) _left18 = (val + step); __typeof__((uint32_t)min) _right19 = ((uint32_t)min); _left18 > _right19 ? _left18 : _right19; }))); __typeof__((uint32_t)max) _right21 = ((uint32_t)max); _left20 < _right21 ? _left20 : _right21; }));
+                            *(uint32_t *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_FLOAT:
+                        {
+                            float val = *(float *)valuePointer;
+                            val = ( __extension__ ({ __typeof__(( __extension__ ({ __typeof__(val + step) _left22 = (val + step); __typeof__((float)min) _right23 = ((float)min); _left22 > _right23 ? _left22 : _right23; }))) _left24 = (( __extension__ ({ __typeof__(val + step) _left22 = (val + step); __typeof__((float)min) _right23 = ((float)min); _left22 > _right23 ? _left22 : _right23; }))); __typeof__((float)max) _right25 = ((float)max); _left24 < _right25 ? _left24 : _right25; }));
+                            *(float *)valuePointer = val;
+                            break;
+                        }
+                    case VAR_STRING:
+                        break;
+                }
+                { entry_flags[currentCtx.cursorRow] |= (1 << 0); };
+                if (p->func) {
+                    p->func(pDisplay, p);
+                }
+            }
+            break;
+
+        case OME_String:
+            break;
+
+        case OME_Label:
+        case OME_LabelFunc:
+        case OME_END:
+            break;
+
+        case OME_MENU:
+
+            break;
+    }
+    return res;
+}
+
+void cmsSetExternKey(cms_key_e extKey)
+{
+    if (externKey == CMS_KEY_NONE)
+        externKey = extKey;
+}
+
+uint16_t cmsHandleKeyWithRepeat(displayPort_t *pDisplay, uint8_t key,
+int repeatCount)
+{
+    uint16_t ret = 0;
+
+    for (int i = 0; i < repeatCount; i++) {
+        ret = cmsHandleKey(pDisplay, key);
+    }
+
+    return ret;
+}
+
+static uint16_t cmsScanKeys(timeMs_t currentTimeMs, timeMs_t lastCalledMs, int16_t rcDelayMs)
+{
+    static int holdCount = 1;
+    static int repeatCount = 1;
+    static int repeatBase = 0;
+
+
+
+
+
+    uint8_t key = CMS_KEY_NONE;
+
+    if (externKey != CMS_KEY_NONE) {
+        rcDelayMs = cmsHandleKey(pCurrentDisplay, externKey);
+        externKey = CMS_KEY_NONE;
+    } else {
+        if ((rxGetChannelValue(THROTTLE) > 1250 && rxGetChannelValue(THROTTLE) < 1750) && (rxGetChannelValue(YAW) < 1250) && (rxGetChannelValue(PITCH) > 1750) && !(armingFlags & (ARMED))) {
+            key = CMS_KEY_MENU;
+        } else if ((rxGetChannelValue(PITCH) > 1750)) {
+            key = CMS_KEY_UP;
+        } else if ((rxGetChannelValue(PITCH) < 1250)) {
+            key = CMS_KEY_DOWN;
+        } else if ((rxGetChannelValue(ROLL) < 1250)) {
+            key = CMS_KEY_LEFT;
+        } else if ((rxGetChannelValue(ROLL) > 1750)) {
+            key = CMS_KEY_RIGHT;
+        } else if ((rxGetChannelValue(YAW) < 1250)) {
+            key = CMS_KEY_ESC;
+        } else if ((rxGetChannelValue(YAW) > 1750)) {
+            key = CMS_KEY_SAVEMENU;
+        }
+
+        if (key == CMS_KEY_NONE) {
+
+            holdCount = 1;
+            repeatCount = 1;
+            repeatBase = 0;
+        } else {
+
+            ++holdCount;
+        }
+
+        if (rcDelayMs > 0) {
+            rcDelayMs -= (currentTimeMs - lastCalledMs);
+        } else if (key) {
+            rcDelayMs = cmsHandleKeyWithRepeat(pCurrentDisplay, key,
+            repeatCount);
+# 1259 "./src/main/cms/cms.c"
+            if (((key == CMS_KEY_LEFT) || (key == CMS_KEY_RIGHT)) && (holdCount > 20)) {
+
+
+
+                rcDelayMs /= (holdCount - 20);
+
+
+
+                if (rcDelayMs <= 50) {
+
+
+
+                    if (repeatBase == 0)
+                    repeatBase = holdCount;
+
+                    if (holdCount < 100) {
+                        repeatCount = repeatCount
+                        + (holdCount - repeatBase) / 5;
+
+                        if (repeatCount > 5) {
+                            repeatCount = 5;
+                        }
+                    } else {
+                        repeatCount = repeatCount + holdCount - repeatBase;
+
+                        if (repeatCount > 50) {
+                            repeatCount = 50;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return rcDelayMs;
+}
+
+void cmsUpdate(uint32_t currentTimeUs)
+{
+
+
+
+
+
+
+    static int16_t rcDelayMs = 250;
+
+    static timeMs_t lastCalledMs = 0;
+    static uint32_t lastCmsHeartBeatMs = 0;
+
+    const timeMs_t currentTimeMs = currentTimeUs / 1000;
+
+    if (!cmsInMenu) {
+
+        if ((rxGetChannelValue(THROTTLE) > 1250 && rxGetChannelValue(THROTTLE) < 1750) && (rxGetChannelValue(YAW) < 1250) && (rxGetChannelValue(PITCH) > 1750) && !(armingFlags & (ARMED))) {
+            cmsMenuOpen();
+            rcDelayMs = 500;
+        }
+    } else {
+
+
+        if (cmsYieldUntil > 0 && currentTimeMs > cmsYieldUntil) {
+            cmsYieldUntil = 0;
+            displayGrab(pCurrentDisplay);
+            displayClearScreen(pCurrentDisplay);
+        }
+
+
+        if (cmsYieldUntil == 0) {
+
+
+            rcDelayMs = cmsScanKeys(currentTimeMs, lastCalledMs, rcDelayMs);
+
+            if (cmsYieldUntil == 0) {
+                cmsDrawMenu(pCurrentDisplay, currentTimeUs);
+            }
+        }
+
+        if (currentTimeMs > lastCmsHeartBeatMs + 500) {
+
+
+            displayHeartbeat(pCurrentDisplay);
+            lastCmsHeartBeatMs = currentTimeMs;
+        }
+    }
+
+
+
+
+    lastCalledMs = millis();
+}
+
+void cmsHandler(timeUs_t currentTimeUs)
+{
+    if (cmsDeviceCount < 0)
+        return;
+
+    static timeUs_t lastCalledUs = 0;
+
+    if (currentTimeUs >= lastCalledUs + 50000) {
+        lastCalledUs = currentTimeUs;
+        cmsUpdate(currentTimeUs);
+    }
+}
+
+void cmsInit(void)
+{
+    cmsDeviceCount = 0;
+    cmsCurrentDevice = -1;
+}
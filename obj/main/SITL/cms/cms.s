@@ -0,0 +1,24711 @@
+	.file	"cms.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/display.h"
+	.file 7 "./src/main/drivers/osd.h"
+	.file 8 "./src/main/cms/cms_types.h"
+	.file 9 "./src/main/cms/cms.h"
+	.file 10 "./src/main/cms/cms_menu_builtin.h"
+	.file 11 "./src/main/cms/cms_menu_saveexit.h"
+	.file 12 "./src/main/drivers/adc.h"
+	.file 13 "./src/main/fc/runtime_config.h"
+	.file 14 "./obj/main/SITL/settings_generated.h"
+	.file 15 "./src/main/fc/settings.h"
+	.file 16 "./src/main/io/osd.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/fc/rc_modes.h"
+	.file 19 "./src/main/cms/cms.c"
+	.file 20 "/usr/include/string.h"
+	.file 21 "./src/main/common/printf.h"
+	.file 22 "./src/main/common/typeconversion.h"
+	.file 23 "./src/main/rx/rx.h"
+	.file 24 "./src/main/fc/fc_core.h"
+	.file 25 "./src/main/flight/servos.h"
+	.file 26 "./src/main/fc/config.h"
+	.file 27 "./src/main/fc/rc_controls.h"
+	.file 28 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms.c.195d33a9
+	.weak	cms.c.195d33a9
+cms.c.195d33a9:
+	.long	0x1fac
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2b
+	.long	.LASF3577
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3016
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3017
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3018
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3019
+	.uleb128 0x4
+	.long	.LASF3021
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3020
+	.uleb128 0x4
+	.long	.LASF3022
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF3023
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3024
+	.uleb128 0x4
+	.long	.LASF3025
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF3026
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF3027
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3028
+	.uleb128 0x4
+	.long	.LASF3029
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xb5
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3030
+	.uleb128 0xa
+	.long	0xb5
+	.uleb128 0x4
+	.long	.LASF3031
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0xa
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF3032
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0xa
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF3033
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF3034
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xa
+	.long	0xef
+	.uleb128 0x4
+	.long	.LASF3035
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xa
+	.long	0x100
+	.uleb128 0x4
+	.long	.LASF3036
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x4
+	.long	.LASF3037
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF3038
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0xa
+	.long	0x135
+	.uleb128 0x5
+	.long	0xef
+	.uleb128 0x4
+	.long	.LASF3039
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0x111
+	.uleb128 0xa
+	.long	0x144
+	.uleb128 0x4
+	.long	.LASF3040
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0x11d
+	.uleb128 0x4
+	.long	.LASF3041
+	.byte	0x6
+	.byte	0x19
+	.byte	0x1f
+	.long	0x172
+	.uleb128 0xa
+	.long	0x161
+	.uleb128 0x18
+	.long	.LASF3053
+	.byte	0x40
+	.byte	0x7
+	.byte	0x3c
+	.long	0x18c
+	.uleb128 0x3
+	.long	.LASF3055
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xd
+	.long	0xcce
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3042
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x1b2
+	.uleb128 0x1
+	.long	.LASF3043
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3044
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3045
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3046
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3
+	.long	0x193
+	.uleb128 0x4
+	.long	.LASF3047
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x11
+	.long	0xef
+	.uleb128 0x4
+	.long	.LASF3048
+	.byte	0x6
+	.byte	0x41
+	.byte	0x20
+	.long	0x1d6
+	.uleb128 0x23
+	.long	.LASF3050
+	.uleb128 0x4
+	.long	.LASF3049
+	.byte	0x6
+	.byte	0x42
+	.byte	0x26
+	.long	0x1e7
+	.uleb128 0x23
+	.long	.LASF3051
+	.uleb128 0x4
+	.long	.LASF3052
+	.byte	0x6
+	.byte	0x43
+	.byte	0x24
+	.long	0x1fd
+	.uleb128 0xa
+	.long	0x1ec
+	.uleb128 0x18
+	.long	.LASF3054
+	.byte	0x98
+	.byte	0x6
+	.byte	0x56
+	.long	0x301
+	.uleb128 0x3
+	.long	.LASF3056
+	.byte	0x6
+	.byte	0x57
+	.byte	0xb
+	.long	0x3d4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3057
+	.byte	0x6
+	.byte	0x58
+	.byte	0xb
+	.long	0x3d4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3058
+	.byte	0x6
+	.byte	0x59
+	.byte	0xb
+	.long	0x3d4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF3059
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xb
+	.long	0x3d4
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF3060
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xb
+	.long	0x3ed
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF3061
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xb
+	.long	0x415
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF3062
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xb
+	.long	0x43d
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF3063
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xb
+	.long	0x46f
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF3064
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xb
+	.long	0x483
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF3065
+	.byte	0x6
+	.byte	0x60
+	.byte	0xb
+	.long	0x3d4
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF3066
+	.byte	0x6
+	.byte	0x61
+	.byte	0xc
+	.long	0x493
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF3067
+	.byte	0x6
+	.byte	0x62
+	.byte	0x10
+	.long	0x4a7
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF3068
+	.byte	0x6
+	.byte	0x63
+	.byte	0x18
+	.long	0x4bb
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF3069
+	.byte	0x6
+	.byte	0x64
+	.byte	0xb
+	.long	0x4d9
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF3070
+	.byte	0x6
+	.byte	0x65
+	.byte	0xb
+	.long	0x4fc
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF3071
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x510
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF3072
+	.byte	0x6
+	.byte	0x67
+	.byte	0xc
+	.long	0x525
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF3073
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x493
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF3074
+	.byte	0x6
+	.byte	0x69
+	.byte	0xb
+	.long	0x543
+	.byte	0x90
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3075
+	.byte	0x20
+	.byte	0x6
+	.byte	0x45
+	.long	0x3aa
+	.uleb128 0x3
+	.long	.LASF3076
+	.byte	0x6
+	.byte	0x46
+	.byte	0x20
+	.long	0x3aa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3077
+	.byte	0x6
+	.byte	0x47
+	.byte	0xb
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3078
+	.byte	0x6
+	.byte	0x48
+	.byte	0xd
+	.long	0xef
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF3079
+	.byte	0x6
+	.byte	0x49
+	.byte	0xd
+	.long	0xef
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF3080
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xd
+	.long	0xef
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF3081
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xd
+	.long	0xef
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF3082
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x9
+	.long	0x18c
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF3083
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x9
+	.long	0x18c
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF3084
+	.byte	0x6
+	.byte	0x50
+	.byte	0xc
+	.long	0xc1
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF3085
+	.byte	0x6
+	.byte	0x51
+	.byte	0xc
+	.long	0xc1
+	.byte	0x17
+	.uleb128 0x3
+	.long	.LASF3086
+	.byte	0x6
+	.byte	0x52
+	.byte	0x16
+	.long	0x1be
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF3087
+	.byte	0x6
+	.byte	0x53
+	.byte	0xe
+	.long	0x100
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x5
+	.long	0x1f8
+	.uleb128 0x4
+	.long	.LASF3088
+	.byte	0x6
+	.byte	0x54
+	.byte	0x3
+	.long	0x301
+	.uleb128 0xa
+	.long	0x3af
+	.uleb128 0xf
+	.long	0x88
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x5
+	.long	0x3af
+	.uleb128 0x5
+	.long	0x3c0
+	.uleb128 0xf
+	.long	0x88
+	.long	0x3e8
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x3bb
+	.uleb128 0x5
+	.long	0x3d9
+	.uleb128 0xf
+	.long	0x88
+	.long	0x415
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0x135
+	.uleb128 0x2
+	.long	0x1be
+	.byte	0
+	.uleb128 0x5
+	.long	0x3f2
+	.uleb128 0xf
+	.long	0x88
+	.long	0x43d
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0x1be
+	.byte	0
+	.uleb128 0x5
+	.long	0x41a
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x465
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0x465
+	.uleb128 0x2
+	.long	0x46a
+	.byte	0
+	.uleb128 0x5
+	.long	0x100
+	.uleb128 0x5
+	.long	0x1be
+	.uleb128 0x5
+	.long	0x442
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x483
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x474
+	.uleb128 0x24
+	.long	0x493
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x5
+	.long	0x488
+	.uleb128 0xf
+	.long	0x111
+	.long	0x4a7
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x498
+	.uleb128 0xf
+	.long	0x1be
+	.long	0x4bb
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x4ac
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x4d4
+	.uleb128 0x2
+	.long	0x4d4
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x1db
+	.uleb128 0x5
+	.long	0x4c0
+	.uleb128 0xf
+	.long	0x88
+	.long	0x4f7
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0x4f7
+	.byte	0
+	.uleb128 0x5
+	.long	0x16d
+	.uleb128 0x5
+	.long	0x4de
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x510
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x5
+	.long	0x501
+	.uleb128 0x24
+	.long	0x525
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x1b2
+	.byte	0
+	.uleb128 0x5
+	.long	0x515
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x53e
+	.uleb128 0x2
+	.long	0x53e
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x5
+	.long	0x1ca
+	.uleb128 0x5
+	.long	0x52a
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x1
+	.long	0x5cd
+	.uleb128 0x1
+	.long	.LASF3089
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3090
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3091
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3093
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3094
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3095
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3096
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3097
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3098
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3099
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3100
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3101
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3102
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3103
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3104
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3105
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3106
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3107
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3108
+	.byte	0x12
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3109
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x548
+	.uleb128 0x4
+	.long	.LASF3110
+	.byte	0x8
+	.byte	0x39
+	.byte	0x10
+	.long	0x5ea
+	.uleb128 0xa
+	.long	0x5d9
+	.uleb128 0x5
+	.long	0x5ef
+	.uleb128 0xf
+	.long	0x9b
+	.long	0x603
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x603
+	.byte	0
+	.uleb128 0x5
+	.long	0x60d
+	.uleb128 0xa
+	.long	0x603
+	.uleb128 0x2e
+	.uleb128 0x4
+	.long	.LASF3111
+	.byte	0x8
+	.byte	0x3b
+	.byte	0x12
+	.long	0x61f
+	.uleb128 0xa
+	.long	0x60e
+	.uleb128 0x5
+	.long	0x624
+	.uleb128 0x2f
+	.long	0xb0
+	.uleb128 0x25
+	.byte	0x8
+	.byte	0x8
+	.byte	0x40
+	.byte	0x5
+	.long	0x657
+	.uleb128 0x1e
+	.long	.LASF3112
+	.byte	0x8
+	.byte	0x42
+	.byte	0x1f
+	.long	0x5e5
+	.uleb128 0x1e
+	.long	.LASF3113
+	.byte	0x8
+	.byte	0x43
+	.byte	0x21
+	.long	0x61a
+	.uleb128 0x1e
+	.long	.LASF3114
+	.byte	0x8
+	.byte	0x44
+	.byte	0xd
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.byte	0x1a
+	.byte	0x8
+	.byte	0x3d
+	.long	0x69a
+	.uleb128 0x3
+	.long	.LASF3115
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x18
+	.long	0x13a
+	.byte	0
+	.uleb128 0x30
+	.long	0x629
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3055
+	.byte	0x8
+	.byte	0x46
+	.byte	0x18
+	.long	0x608
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF3116
+	.byte	0x8
+	.byte	0x47
+	.byte	0x13
+	.long	0xfb
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF3117
+	.byte	0x8
+	.byte	0x48
+	.byte	0xd
+	.long	0xef
+	.byte	0x19
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3118
+	.byte	0x8
+	.byte	0x49
+	.byte	0x1b
+	.long	0x657
+	.uleb128 0xa
+	.long	0x69a
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x8
+	.byte	0x71
+	.byte	0xe
+	.long	0x6be
+	.uleb128 0x1
+	.long	.LASF3119
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3120
+	.byte	0x8
+	.byte	0x73
+	.byte	0x3
+	.long	0x6ab
+	.uleb128 0x4
+	.long	.LASF3121
+	.byte	0x8
+	.byte	0x78
+	.byte	0x10
+	.long	0x6db
+	.uleb128 0xa
+	.long	0x6ca
+	.uleb128 0x5
+	.long	0x6e0
+	.uleb128 0xf
+	.long	0x9b
+	.long	0x6ef
+	.uleb128 0x2
+	.long	0x6ef
+	.byte	0
+	.uleb128 0x5
+	.long	0x6a6
+	.uleb128 0x4
+	.long	.LASF3122
+	.byte	0x8
+	.byte	0x84
+	.byte	0x10
+	.long	0x6db
+	.uleb128 0xa
+	.long	0x6f4
+	.uleb128 0x14
+	.byte	0x20
+	.byte	0x8
+	.byte	0x86
+	.long	0x742
+	.uleb128 0x3
+	.long	.LASF3123
+	.byte	0x8
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x6d6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3124
+	.byte	0x8
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x700
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3125
+	.byte	0x8
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x6d6
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF3126
+	.byte	0x8
+	.byte	0x90
+	.byte	0x16
+	.long	0x6ef
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3127
+	.byte	0x8
+	.byte	0x91
+	.byte	0x3
+	.long	0x705
+	.uleb128 0xa
+	.long	0x742
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x8
+	.byte	0x93
+	.long	0x78d
+	.uleb128 0xc
+	.string	"val"
+	.byte	0x95
+	.byte	0xe
+	.long	0x13f
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0x96
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0x97
+	.byte	0xd
+	.long	0xef
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0x98
+	.byte	0xd
+	.long	0xef
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3129
+	.byte	0x8
+	.byte	0x99
+	.byte	0x3
+	.long	0x753
+	.uleb128 0xa
+	.long	0x78d
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x8
+	.byte	0x9b
+	.long	0x7d8
+	.uleb128 0xc
+	.string	"val"
+	.byte	0x9d
+	.byte	0xd
+	.long	0x7d8
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0x9e
+	.byte	0xc
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0x9f
+	.byte	0xc
+	.long	0xc1
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0xa0
+	.byte	0xc
+	.long	0xc1
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF3130
+	.byte	0x8
+	.byte	0xa1
+	.byte	0x3
+	.long	0x79e
+	.uleb128 0xa
+	.long	0x7dd
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x8
+	.byte	0xa3
+	.long	0x828
+	.uleb128 0xc
+	.string	"val"
+	.byte	0xa5
+	.byte	0xe
+	.long	0x828
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0xa6
+	.byte	0xd
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0xa7
+	.byte	0xd
+	.long	0xd2
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0xa8
+	.byte	0xd
+	.long	0xd2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF3131
+	.byte	0x8
+	.byte	0xa9
+	.byte	0x3
+	.long	0x7ee
+	.uleb128 0xa
+	.long	0x82d
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x8
+	.byte	0xab
+	.long	0x878
+	.uleb128 0xc
+	.string	"val"
+	.byte	0xad
+	.byte	0xf
+	.long	0x465
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0xae
+	.byte	0xe
+	.long	0x100
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0xaf
+	.byte	0xe
+	.long	0x100
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0xb0
+	.byte	0xe
+	.long	0x100
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3132
+	.byte	0x8
+	.byte	0xb1
+	.byte	0x3
+	.long	0x83e
+	.uleb128 0xa
+	.long	0x878
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x8
+	.byte	0xb3
+	.long	0x8d0
+	.uleb128 0xc
+	.string	"val"
+	.byte	0xb5
+	.byte	0xe
+	.long	0x13f
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0xb6
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0xb7
+	.byte	0xd
+	.long	0xef
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0xb8
+	.byte	0xd
+	.long	0xef
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF3133
+	.byte	0x8
+	.byte	0xb9
+	.byte	0xe
+	.long	0x100
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3134
+	.byte	0x8
+	.byte	0xba
+	.byte	0x3
+	.long	0x889
+	.uleb128 0xa
+	.long	0x8d0
+	.uleb128 0x18
+	.long	.LASF3135
+	.byte	0x3
+	.byte	0x8
+	.byte	0xbc
+	.long	0x907
+	.uleb128 0xc
+	.string	"val"
+	.byte	0xbd
+	.byte	0x14
+	.long	0x10c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3128
+	.byte	0x8
+	.byte	0xbe
+	.byte	0x13
+	.long	0xfb
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3136
+	.byte	0x8
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x8e1
+	.uleb128 0xa
+	.long	0x907
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0x8
+	.byte	0xc6
+	.long	0x946
+	.uleb128 0xc
+	.string	"val"
+	.byte	0xc8
+	.byte	0xe
+	.long	0x13f
+	.byte	0
+	.uleb128 0xc
+	.string	"max"
+	.byte	0xc9
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3137
+	.byte	0x8
+	.byte	0xca
+	.byte	0x19
+	.long	0x946
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	0x13a
+	.uleb128 0x4
+	.long	.LASF3138
+	.byte	0x8
+	.byte	0xcb
+	.byte	0x3
+	.long	0x918
+	.uleb128 0xa
+	.long	0x94b
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x9
+	.byte	0x9
+	.byte	0xe
+	.long	0x999
+	.uleb128 0x1
+	.long	.LASF3139
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3140
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3141
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3142
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3143
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3144
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3145
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3147
+	.byte	0x9
+	.byte	0x12
+	.byte	0x3
+	.long	0x95c
+	.uleb128 0x20
+	.long	.LASF3148
+	.byte	0x9
+	.byte	0x15
+	.byte	0xc
+	.long	0x18c
+	.uleb128 0x20
+	.long	.LASF3149
+	.byte	0xa
+	.byte	0x16
+	.byte	0x17
+	.long	0x74e
+	.uleb128 0x20
+	.long	.LASF3150
+	.byte	0xb
+	.byte	0x17
+	.byte	0x17
+	.long	0x74e
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3151
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xc
+	.byte	0x16
+	.byte	0xe
+	.long	0x9fb
+	.uleb128 0x1
+	.long	.LASF3152
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3153
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3154
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3155
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3156
+	.byte	0x4
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF3578
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x1b
+	.byte	0x18
+	.byte	0xe
+	.long	0xa6e
+	.uleb128 0x1
+	.long	.LASF3157
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3158
+	.byte	0x1
+	.uleb128 0x32
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3159
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3160
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3161
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3162
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3163
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3164
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3165
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3166
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3167
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3168
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3169
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3170
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3171
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xd
+	.byte	0x15
+	.byte	0xe
+	.long	0xb3a
+	.uleb128 0x1
+	.long	.LASF3172
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3173
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3174
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF3175
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF3176
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF3177
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF3178
+	.value	0x800
+	.uleb128 0x15
+	.long	.LASF3179
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF3180
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF3181
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF3182
+	.value	0x8000
+	.uleb128 0x11
+	.long	.LASF3183
+	.long	0x10000
+	.uleb128 0x11
+	.long	.LASF3184
+	.long	0x20000
+	.uleb128 0x11
+	.long	.LASF3185
+	.long	0x40000
+	.uleb128 0x11
+	.long	.LASF3186
+	.long	0x80000
+	.uleb128 0x11
+	.long	.LASF3187
+	.long	0x100000
+	.uleb128 0x11
+	.long	.LASF3188
+	.long	0x200000
+	.uleb128 0x11
+	.long	.LASF3189
+	.long	0x400000
+	.uleb128 0x11
+	.long	.LASF3190
+	.long	0x800000
+	.uleb128 0x11
+	.long	.LASF3191
+	.long	0x1000000
+	.uleb128 0x11
+	.long	.LASF3192
+	.long	0x2000000
+	.uleb128 0x11
+	.long	.LASF3193
+	.long	0x4000000
+	.uleb128 0x11
+	.long	.LASF3194
+	.long	0x8000000
+	.uleb128 0x11
+	.long	.LASF3195
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3196
+	.byte	0xd
+	.byte	0x47
+	.byte	0x11
+	.long	0x111
+	.uleb128 0x4
+	.long	.LASF3197
+	.byte	0xe
+	.byte	0xa
+	.byte	0x11
+	.long	0xef
+	.uleb128 0xa
+	.long	0xb46
+	.uleb128 0x4
+	.long	.LASF3198
+	.byte	0xe
+	.byte	0xc
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF3199
+	.byte	0xe
+	.byte	0xd
+	.byte	0x12
+	.long	0x111
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.byte	0xe
+	.long	0xba6
+	.uleb128 0x1
+	.long	.LASF3200
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3201
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3202
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3203
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3204
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3205
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3206
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3207
+	.byte	0xf
+	.byte	0x1d
+	.byte	0x3
+	.long	0xb6f
+	.uleb128 0x12
+	.long	0x30
+	.byte	0xf
+	.byte	0x27
+	.byte	0xe
+	.long	0xbcb
+	.uleb128 0x1
+	.long	.LASF3208
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3209
+	.byte	0x40
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3210
+	.byte	0xf
+	.byte	0x2b
+	.byte	0x3
+	.long	0xbb2
+	.uleb128 0x18
+	.long	.LASF3211
+	.byte	0x2
+	.byte	0xf
+	.byte	0x31
+	.long	0xbf1
+	.uleb128 0x3
+	.long	.LASF3212
+	.byte	0xf
+	.byte	0x32
+	.byte	0x13
+	.long	0xc01
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xfb
+	.long	0xc01
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	0xbf1
+	.uleb128 0x4
+	.long	.LASF3213
+	.byte	0xf
+	.byte	0x33
+	.byte	0x3
+	.long	0xbd7
+	.uleb128 0x18
+	.long	.LASF3214
+	.byte	0x1
+	.byte	0xf
+	.byte	0x35
+	.long	0xc2c
+	.uleb128 0x3
+	.long	.LASF3215
+	.byte	0xf
+	.byte	0x36
+	.byte	0x13
+	.long	0xfb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3216
+	.byte	0xf
+	.byte	0x37
+	.byte	0x3
+	.long	0xc12
+	.uleb128 0x25
+	.byte	0x2
+	.byte	0xf
+	.byte	0x39
+	.byte	0x9
+	.long	0xc5a
+	.uleb128 0x1e
+	.long	.LASF3217
+	.byte	0xf
+	.byte	0x3a
+	.byte	0x20
+	.long	0xc2c
+	.uleb128 0x1e
+	.long	.LASF3218
+	.byte	0xf
+	.byte	0x3b
+	.byte	0x1b
+	.long	0xc06
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3219
+	.byte	0xf
+	.byte	0x3c
+	.byte	0x3
+	.long	0xc38
+	.uleb128 0xa
+	.long	0xc5a
+	.uleb128 0x14
+	.byte	0x9
+	.byte	0xf
+	.byte	0x3e
+	.long	0xca8
+	.uleb128 0x3
+	.long	.LASF3220
+	.byte	0xf
+	.byte	0x3f
+	.byte	0x13
+	.long	0xcb8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3116
+	.byte	0xf
+	.byte	0x40
+	.byte	0x13
+	.long	0xfb
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF3221
+	.byte	0xf
+	.byte	0x41
+	.byte	0x1b
+	.long	0xc66
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF3222
+	.byte	0xf
+	.byte	0x42
+	.byte	0x1c
+	.long	0xb52
+	.byte	0x8
+	.byte	0
+	.uleb128 0x19
+	.long	0xfb
+	.long	0xcb8
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	0xca8
+	.uleb128 0x4
+	.long	.LASF3223
+	.byte	0xf
+	.byte	0x44
+	.byte	0x1b
+	.long	0xc6b
+	.uleb128 0xa
+	.long	0xcbd
+	.uleb128 0x19
+	.long	0xef
+	.long	0xcde
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x10
+	.byte	0x2e
+	.byte	0xe
+	.long	0xf79
+	.uleb128 0x1
+	.long	.LASF3224
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3225
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3226
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3227
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3228
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3229
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3230
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3231
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3232
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3233
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3234
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3235
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3236
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3237
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3238
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3239
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3240
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3241
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3242
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3243
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3244
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3245
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3246
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3247
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3248
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3249
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3250
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3251
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3252
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3253
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3254
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3255
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3256
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3257
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3258
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3259
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3260
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3261
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3262
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3263
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3264
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3265
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3266
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF3267
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF3268
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF3269
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF3270
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF3271
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF3272
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF3273
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3274
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3275
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF3276
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF3277
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF3278
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF3279
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF3280
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF3281
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF3282
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF3283
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3284
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3285
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3286
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3287
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3288
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3289
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3290
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3291
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3292
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3293
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3294
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3295
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3296
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF3297
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF3298
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF3299
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF3300
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF3301
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF3302
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF3303
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3304
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3305
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3306
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF3307
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF3308
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF3309
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF3310
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF3311
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF3312
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF3313
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF3314
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF3315
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF3316
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF3317
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF3318
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF3319
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF3320
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF3321
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF3322
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF3323
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF3324
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF3325
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF3326
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF3327
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF3328
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF3329
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF3330
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF3331
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF3332
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x11
+	.byte	0x16
+	.byte	0xe
+	.long	0x106a
+	.uleb128 0x1
+	.long	.LASF3333
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3334
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3335
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3336
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3337
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3338
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3339
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3340
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3341
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3342
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3343
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3344
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3345
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3346
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3347
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3348
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3349
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3350
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3351
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3352
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3353
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3354
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3355
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3356
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3357
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3358
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3359
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3360
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3361
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3362
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3363
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3364
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3365
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3366
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3367
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3368
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3369
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3370
+	.byte	0x25
+	.byte	0
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x11
+	.byte	0x43
+	.byte	0xe
+	.long	0x10f5
+	.uleb128 0x1
+	.long	.LASF3371
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3372
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3373
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3374
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3375
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3376
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3377
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3378
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3379
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3380
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3381
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3382
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3383
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3384
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3385
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3386
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3387
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3388
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3389
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3390
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3391
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x12
+	.long	0x30
+	.byte	0x12
+	.byte	0x1c
+	.byte	0xe
+	.long	0x1209
+	.uleb128 0x1
+	.long	.LASF3392
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3393
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3394
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3395
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3396
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3397
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3398
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3399
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3400
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3401
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3402
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3403
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3404
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3405
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3406
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3407
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3408
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3409
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3410
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3411
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3412
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3413
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3414
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3415
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3416
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3417
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3418
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3419
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3420
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3421
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3422
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3423
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3424
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3425
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3426
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3427
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3428
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3429
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3430
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3431
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3432
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3433
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3434
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x19
+	.long	0xef
+	.long	0x1219
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x1f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3435
+	.byte	0x52
+	.byte	0x10
+	.long	0x1209
+	.uleb128 0xd
+	.long	.LASF3436
+	.byte	0x61
+	.byte	0x17
+	.long	0x3cf
+	.uleb128 0x19
+	.long	0x3cf
+	.long	0x123f
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3437
+	.byte	0x63
+	.byte	0x17
+	.long	0x122f
+	.uleb128 0xd
+	.long	.LASF3438
+	.byte	0x64
+	.byte	0xc
+	.long	0x88
+	.uleb128 0xd
+	.long	.LASF3439
+	.byte	0x65
+	.byte	0xc
+	.long	0x88
+	.uleb128 0xd
+	.long	.LASF3440
+	.byte	0x66
+	.byte	0x11
+	.long	0x144
+	.uleb128 0xd
+	.long	.LASF3441
+	.byte	0xad
+	.byte	0xc
+	.long	0x18c
+	.uleb128 0xd
+	.long	.LASF3442
+	.byte	0xae
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3443
+	.byte	0xaf
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3444
+	.byte	0xb0
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3445
+	.byte	0xb1
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3446
+	.byte	0xb2
+	.byte	0x12
+	.long	0x999
+	.uleb128 0x33
+	.long	0x9a5
+	.byte	0x13
+	.byte	0xb4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF3447
+	.byte	0x10
+	.byte	0x13
+	.byte	0xb6
+	.long	0x12e9
+	.uleb128 0x3
+	.long	.LASF3448
+	.byte	0x13
+	.byte	0xb7
+	.byte	0x15
+	.long	0x12e9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3449
+	.byte	0x13
+	.byte	0xb8
+	.byte	0xd
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF3084
+	.byte	0x13
+	.byte	0xb9
+	.byte	0xc
+	.long	0xc1
+	.byte	0x9
+	.byte	0
+	.uleb128 0x5
+	.long	0x74e
+	.uleb128 0x4
+	.long	.LASF3450
+	.byte	0x13
+	.byte	0xba
+	.byte	0x3
+	.long	0x12b5
+	.uleb128 0x19
+	.long	0x12ee
+	.long	0x130a
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF3451
+	.byte	0xbc
+	.byte	0x11
+	.long	0x12fa
+	.uleb128 0xd
+	.long	.LASF3452
+	.byte	0xbd
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3453
+	.byte	0xbf
+	.byte	0xf
+	.long	0xc1
+	.uleb128 0xd
+	.long	.LASF3454
+	.byte	0xc0
+	.byte	0x19
+	.long	0x6ef
+	.uleb128 0xd
+	.long	.LASF3455
+	.byte	0xc1
+	.byte	0x10
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF3456
+	.byte	0xc3
+	.byte	0x11
+	.long	0x12ee
+	.uleb128 0x10
+	.long	.LASF3457
+	.byte	0x14
+	.byte	0x95
+	.byte	0xe
+	.long	0xb0
+	.long	0x1367
+	.uleb128 0x2
+	.long	0xb0
+	.uleb128 0x2
+	.long	0x135
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3458
+	.byte	0xf
+	.byte	0x78
+	.byte	0x8
+	.long	0x129
+	.long	0x137d
+	.uleb128 0x2
+	.long	0x137d
+	.byte	0
+	.uleb128 0x5
+	.long	0xcc9
+	.uleb128 0x10
+	.long	.LASF3459
+	.byte	0xf
+	.byte	0x75
+	.byte	0xe
+	.long	0x135
+	.long	0x139d
+	.uleb128 0x2
+	.long	0x137d
+	.uleb128 0x2
+	.long	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3460
+	.byte	0x15
+	.byte	0x71
+	.byte	0x5
+	.long	0x88
+	.long	0x13b9
+	.uleb128 0x2
+	.long	0xb0
+	.uleb128 0x2
+	.long	0x135
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3461
+	.byte	0x16
+	.byte	0x1b
+	.byte	0x7
+	.long	0xb0
+	.long	0x13d4
+	.uleb128 0x2
+	.long	0x9c9
+	.uleb128 0x2
+	.long	0xb0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3462
+	.byte	0x16
+	.byte	0x21
+	.byte	0x7
+	.long	0xb0
+	.long	0x13f4
+	.uleb128 0x2
+	.long	0x88
+	.uleb128 0x2
+	.long	0xb0
+	.uleb128 0x2
+	.long	0x88
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF3463
+	.byte	0x14
+	.value	0x197
+	.byte	0xf
+	.long	0x129
+	.long	0x140b
+	.uleb128 0x2
+	.long	0x135
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3464
+	.byte	0x14
+	.byte	0x90
+	.byte	0xe
+	.long	0xb0
+	.long	0x142b
+	.uleb128 0x2
+	.long	0xb0
+	.uleb128 0x2
+	.long	0x135
+	.uleb128 0x2
+	.long	0x129
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3465
+	.byte	0x14
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0x144b
+	.uleb128 0x2
+	.long	0xae
+	.uleb128 0x2
+	.long	0x88
+	.uleb128 0x2
+	.long	0x129
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3466
+	.byte	0x6
+	.byte	0x84
+	.byte	0xa
+	.long	0x100
+	.long	0x1461
+	.uleb128 0x2
+	.long	0x3e8
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3472
+	.byte	0x6
+	.byte	0x82
+	.long	0x1472
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3467
+	.byte	0x17
+	.byte	0xd2
+	.byte	0x9
+	.long	0xd2
+	.long	0x1488
+	.uleb128 0x2
+	.long	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3468
+	.byte	0xf
+	.byte	0x61
+	.byte	0x8
+	.long	0xae
+	.long	0x149e
+	.uleb128 0x2
+	.long	0x137d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3469
+	.byte	0xf
+	.byte	0x6e
+	.byte	0xf
+	.long	0xb63
+	.long	0x14b4
+	.uleb128 0x2
+	.long	0x137d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3470
+	.byte	0xf
+	.byte	0x6a
+	.byte	0xf
+	.long	0xb57
+	.long	0x14ca
+	.uleb128 0x2
+	.long	0x137d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3471
+	.byte	0xf
+	.byte	0x55
+	.byte	0x12
+	.long	0x137d
+	.long	0x14e0
+	.uleb128 0x2
+	.long	0x30
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF3579
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0xa
+	.long	0x144
+	.uleb128 0x1b
+	.long	.LASF3473
+	.byte	0x18
+	.byte	0x30
+	.long	0x14fd
+	.uleb128 0x2
+	.long	0x18c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3474
+	.byte	0x6
+	.byte	0x83
+	.long	0x150e
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3475
+	.byte	0x6
+	.byte	0x7c
+	.byte	0x5
+	.long	0x88
+	.long	0x1533
+	.uleb128 0x2
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0xef
+	.uleb128 0x2
+	.long	0x135
+	.byte	0
+	.uleb128 0x37
+	.long	.LASF3567
+	.byte	0x1a
+	.byte	0x77
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF3476
+	.byte	0x6
+	.byte	0x74
+	.long	0x154c
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3477
+	.byte	0x6
+	.byte	0x75
+	.long	0x155d
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3478
+	.byte	0x19
+	.byte	0x95
+	.long	0x156e
+	.uleb128 0x2
+	.long	0x18c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3479
+	.byte	0x6
+	.byte	0x78
+	.long	0x157f
+	.uleb128 0x2
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF3580
+	.byte	0x13
+	.value	0x553
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF3481
+	.value	0x546
+	.long	0x15ac
+	.uleb128 0x8
+	.long	.LASF3483
+	.value	0x546
+	.byte	0x1a
+	.long	0x155
+	.uleb128 0x7
+	.long	.LASF3480
+	.value	0x54b
+	.byte	0x15
+	.long	0x155
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF3482
+	.value	0x50f
+	.long	0x15f4
+	.uleb128 0x8
+	.long	.LASF3483
+	.value	0x50f
+	.byte	0x19
+	.long	0x111
+	.uleb128 0x7
+	.long	.LASF3484
+	.value	0x517
+	.byte	0x14
+	.long	0xd2
+	.uleb128 0x7
+	.long	.LASF3485
+	.value	0x519
+	.byte	0x15
+	.long	0x144
+	.uleb128 0x7
+	.long	.LASF3486
+	.value	0x51a
+	.byte	0x15
+	.long	0x111
+	.uleb128 0x7
+	.long	.LASF3487
+	.value	0x51c
+	.byte	0x14
+	.long	0x150
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3495
+	.value	0x4b1
+	.byte	0x11
+	.long	0x100
+	.long	0x1659
+	.uleb128 0x8
+	.long	.LASF3487
+	.value	0x4b1
+	.byte	0x26
+	.long	0x144
+	.uleb128 0x8
+	.long	.LASF3485
+	.value	0x4b1
+	.byte	0x3e
+	.long	0x144
+	.uleb128 0x8
+	.long	.LASF3484
+	.value	0x4b1
+	.byte	0x54
+	.long	0xd2
+	.uleb128 0x7
+	.long	.LASF3488
+	.value	0x4b3
+	.byte	0x10
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF3489
+	.value	0x4b4
+	.byte	0x10
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF3490
+	.value	0x4b5
+	.byte	0x10
+	.long	0x88
+	.uleb128 0x6
+	.string	"key"
+	.value	0x4bb
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3491
+	.value	0x4a5
+	.byte	0xa
+	.long	0x100
+	.long	0x16a6
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x4a5
+	.byte	0x30
+	.long	0x3cf
+	.uleb128 0x16
+	.string	"key"
+	.value	0x4a5
+	.byte	0x42
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3489
+	.value	0x4a6
+	.byte	0x5
+	.long	0x88
+	.uleb128 0x6
+	.string	"ret"
+	.value	0x4a8
+	.byte	0xe
+	.long	0x100
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"i"
+	.value	0x4aa
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF3493
+	.value	0x49f
+	.long	0x16be
+	.uleb128 0x8
+	.long	.LASF3494
+	.value	0x49f
+	.byte	0x20
+	.long	0x999
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3496
+	.value	0x385
+	.byte	0x11
+	.long	0x100
+	.long	0x1995
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x385
+	.byte	0x2d
+	.long	0x3cf
+	.uleb128 0x16
+	.string	"key"
+	.value	0x385
+	.byte	0x3f
+	.long	0xef
+	.uleb128 0x6
+	.string	"res"
+	.value	0x387
+	.byte	0xe
+	.long	0x100
+	.uleb128 0x6
+	.string	"p"
+	.value	0x388
+	.byte	0x16
+	.long	0x6ef
+	.uleb128 0xb
+	.long	0x170e
+	.uleb128 0x7
+	.long	.LASF3497
+	.value	0x3c2
+	.byte	0x16
+	.long	0x9b
+	.byte	0
+	.uleb128 0xb
+	.long	0x1720
+	.uleb128 0x6
+	.string	"val"
+	.value	0x3d8
+	.byte	0x1a
+	.long	0x13f
+	.byte	0
+	.uleb128 0xb
+	.long	0x173e
+	.uleb128 0x7
+	.long	.LASF3112
+	.value	0x3e6
+	.byte	0x17
+	.long	0x19a9
+	.uleb128 0x6
+	.string	"val"
+	.value	0x3e7
+	.byte	0x15
+	.long	0x18c
+	.byte	0
+	.uleb128 0xb
+	.long	0x1750
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x3f3
+	.byte	0x24
+	.long	0x19ae
+	.byte	0
+	.uleb128 0xb
+	.long	0x1762
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x404
+	.byte	0x22
+	.long	0x19b3
+	.byte	0
+	.uleb128 0xb
+	.long	0x1774
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x419
+	.byte	0x23
+	.long	0x19b8
+	.byte	0
+	.uleb128 0xb
+	.long	0x1786
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x42d
+	.byte	0x25
+	.long	0x19bd
+	.byte	0
+	.uleb128 0xb
+	.long	0x1798
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x441
+	.byte	0x24
+	.long	0x19c2
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x452
+	.byte	0x26
+	.long	0x19c7
+	.uleb128 0x6
+	.string	"var"
+	.value	0x453
+	.byte	0x22
+	.long	0x137d
+	.uleb128 0x6
+	.string	"min"
+	.value	0x454
+	.byte	0x1f
+	.long	0xb57
+	.uleb128 0x6
+	.string	"max"
+	.value	0x455
+	.byte	0x1f
+	.long	0xb63
+	.uleb128 0x7
+	.long	.LASF3128
+	.value	0x456
+	.byte	0x17
+	.long	0x9c9
+	.uleb128 0x7
+	.long	.LASF3498
+	.value	0x45a
+	.byte	0x1d
+	.long	0x603
+	.uleb128 0xb
+	.long	0x182a
+	.uleb128 0x6
+	.string	"val"
+	.value	0x45e
+	.byte	0x25
+	.long	0xef
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3499
+	.value	0x45f
+	.byte	0xdf
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3500
+	.value	0x45f
+	.value	0x1a1
+	.long	0x22
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3501
+	.value	0x45f
+	.value	0x113
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3502
+	.value	0x45f
+	.value	0x143
+	.long	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1873
+	.uleb128 0x6
+	.string	"val"
+	.value	0x465
+	.byte	0x24
+	.long	0xc1
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3503
+	.value	0x466
+	.byte	0xdd
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3504
+	.value	0x466
+	.value	0x19c
+	.long	0x4a
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3505
+	.value	0x466
+	.value	0x111
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3506
+	.value	0x466
+	.value	0x140
+	.long	0x4a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x18bc
+	.uleb128 0x6
+	.string	"val"
+	.value	0x46c
+	.byte	0x26
+	.long	0x100
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3507
+	.value	0x46d
+	.byte	0xe7
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3508
+	.value	0x46d
+	.value	0x1b3
+	.long	0x29
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3509
+	.value	0x46d
+	.value	0x11c
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3510
+	.value	0x46d
+	.value	0x14e
+	.long	0x29
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1905
+	.uleb128 0x6
+	.string	"val"
+	.value	0x473
+	.byte	0x25
+	.long	0xd2
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3511
+	.value	0x474
+	.byte	0xe5
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3512
+	.value	0x474
+	.value	0x1ae
+	.long	0x69
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3513
+	.value	0x474
+	.value	0x11a
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3514
+	.value	0x474
+	.value	0x14b
+	.long	0x69
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x194e
+	.uleb128 0x6
+	.string	"val"
+	.value	0x47a
+	.byte	0x26
+	.long	0x111
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3515
+	.value	0x47b
+	.byte	0xe7
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3516
+	.value	0x47b
+	.value	0x1b3
+	.long	0x30
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3517
+	.value	0x47b
+	.value	0x11c
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3518
+	.value	0x47b
+	.value	0x14e
+	.long	0x30
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"val"
+	.value	0x481
+	.byte	0x23
+	.long	0x9c9
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3519
+	.value	0x482
+	.byte	0xe1
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3520
+	.value	0x482
+	.value	0x1a4
+	.long	0x9c9
+	.uleb128 0x9
+	.uleb128 0xe
+	.long	.LASF3521
+	.value	0x482
+	.value	0x116
+	.long	0x9c9
+	.uleb128 0xe
+	.long	.LASF3522
+	.value	0x482
+	.value	0x145
+	.long	0x9c9
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x19a4
+	.uleb128 0x2
+	.long	0x19a4
+	.byte	0
+	.uleb128 0x5
+	.long	0x18c
+	.uleb128 0x5
+	.long	0x1995
+	.uleb128 0x5
+	.long	0x799
+	.uleb128 0x5
+	.long	0x957
+	.uleb128 0x5
+	.long	0x7e9
+	.uleb128 0x5
+	.long	0x884
+	.uleb128 0x5
+	.long	0x839
+	.uleb128 0x5
+	.long	0x913
+	.uleb128 0x1f
+	.long	.LASF3523
+	.value	0x371
+	.long	0x19f0
+	.uleb128 0x8
+	.long	.LASF3524
+	.value	0x371
+	.byte	0x25
+	.long	0x3cf
+	.uleb128 0x8
+	.long	.LASF3525
+	.value	0x371
+	.byte	0x35
+	.long	0x144
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3526
+	.value	0x33e
+	.byte	0x6
+	.long	0x9b
+	.long	0x1a31
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x33e
+	.byte	0x21
+	.long	0x3cf
+	.uleb128 0x16
+	.string	"ptr"
+	.value	0x33e
+	.byte	0x37
+	.long	0x603
+	.uleb128 0x7
+	.long	.LASF3527
+	.value	0x340
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"i"
+	.value	0x34e
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3535
+	.value	0x32e
+	.long	0x1a55
+	.uleb128 0x8
+	.long	.LASF3528
+	.value	0x32e
+	.byte	0x33
+	.long	0x12e9
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"p"
+	.value	0x330
+	.byte	0x1b
+	.long	0x6ef
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF3529
+	.value	0x2fd
+	.long	0x1a6f
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3530
+	.value	0x30a
+	.byte	0x18
+	.long	0x3cf
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3531
+	.value	0x2e7
+	.byte	0xd
+	.long	0x9b
+	.long	0x1a8c
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x2e7
+	.byte	0x28
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3532
+	.value	0x2b8
+	.byte	0x6
+	.long	0x9b
+	.long	0x1acf
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x2b8
+	.byte	0x23
+	.long	0x3cf
+	.uleb128 0x8
+	.long	.LASF3528
+	.value	0x2b8
+	.byte	0x3d
+	.long	0x12e9
+	.uleb128 0x8
+	.long	.LASF3533
+	.value	0x2b8
+	.byte	0x55
+	.long	0x6ef
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3534
+	.value	0x2dc
+	.byte	0x10
+	.long	0xc1
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3536
+	.value	0x2a9
+	.long	0x1af1
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x2a9
+	.byte	0x2d
+	.long	0x3cf
+	.uleb128 0x6
+	.string	"p"
+	.value	0x2ac
+	.byte	0x16
+	.long	0x6ef
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3537
+	.value	0x253
+	.long	0x1b67
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x253
+	.byte	0x28
+	.long	0x3cf
+	.uleb128 0x8
+	.long	.LASF3483
+	.value	0x253
+	.byte	0x3b
+	.long	0x111
+	.uleb128 0x6
+	.string	"i"
+	.value	0x258
+	.byte	0xd
+	.long	0xef
+	.uleb128 0x6
+	.string	"p"
+	.value	0x259
+	.byte	0x16
+	.long	0x6ef
+	.uleb128 0x6
+	.string	"top"
+	.value	0x25a
+	.byte	0xd
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF3538
+	.value	0x25e
+	.byte	0x9
+	.long	0x18c
+	.uleb128 0x7
+	.long	.LASF3539
+	.value	0x25f
+	.byte	0x15
+	.long	0x111
+	.uleb128 0x7
+	.long	.LASF3540
+	.value	0x266
+	.byte	0xe
+	.long	0x111
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3541
+	.value	0x28c
+	.byte	0x15
+	.long	0xef
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3542
+	.value	0x154
+	.byte	0xc
+	.long	0x88
+	.long	0x1d26
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x154
+	.byte	0x2c
+	.long	0x3cf
+	.uleb128 0x16
+	.string	"p"
+	.value	0x154
+	.byte	0x47
+	.long	0x6ef
+	.uleb128 0x16
+	.string	"row"
+	.value	0x154
+	.byte	0x52
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3543
+	.value	0x154
+	.byte	0x5f
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF3544
+	.value	0x15a
+	.byte	0xa
+	.long	0x1d26
+	.uleb128 0x6
+	.string	"cnt"
+	.value	0x15b
+	.byte	0x9
+	.long	0x88
+	.uleb128 0xb
+	.long	0x1bcf
+	.uleb128 0x6
+	.string	"str"
+	.value	0x171
+	.byte	0x17
+	.long	0xb0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1be1
+	.uleb128 0x7
+	.long	.LASF3112
+	.value	0x18b
+	.byte	0x13
+	.long	0x19a9
+	.byte	0
+	.uleb128 0xb
+	.long	0x1bff
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x199
+	.byte	0x1e
+	.long	0x19b3
+	.uleb128 0x6
+	.string	"str"
+	.value	0x19a
+	.byte	0x14
+	.long	0xb0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c1f
+	.uleb128 0x6
+	.string	"val"
+	.value	0x1a3
+	.byte	0x1c
+	.long	0x10f5
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1a7
+	.byte	0x24
+	.long	0x19ae
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c3f
+	.uleb128 0x6
+	.string	"val"
+	.value	0x1b2
+	.byte	0x1b
+	.long	0x1d36
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1b6
+	.byte	0x23
+	.long	0x19b8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c5f
+	.uleb128 0x6
+	.string	"val"
+	.value	0x1c1
+	.byte	0x1d
+	.long	0x1d3b
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1c5
+	.byte	0x25
+	.long	0x19bd
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c7f
+	.uleb128 0x6
+	.string	"val"
+	.value	0x1d0
+	.byte	0x1c
+	.long	0x1d40
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1d4
+	.byte	0x24
+	.long	0x19c2
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	0x1c91
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1df
+	.byte	0x20
+	.long	0x1d45
+	.byte	0
+	.uleb128 0xb
+	.long	0x1d09
+	.uleb128 0x7
+	.long	.LASF3545
+	.value	0x1e8
+	.byte	0x15
+	.long	0xef
+	.uleb128 0x6
+	.string	"ptr"
+	.value	0x1ea
+	.byte	0x22
+	.long	0x19c7
+	.uleb128 0x6
+	.string	"var"
+	.value	0x1eb
+	.byte	0x1e
+	.long	0x137d
+	.uleb128 0x7
+	.long	.LASF3546
+	.value	0x1ec
+	.byte	0x15
+	.long	0xe3
+	.uleb128 0x7
+	.long	.LASF3498
+	.value	0x1ed
+	.byte	0x19
+	.long	0x603
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3547
+	.value	0x209
+	.byte	0x1d
+	.long	0x135
+	.uleb128 0x9
+	.uleb128 0x6
+	.string	"str"
+	.value	0x21b
+	.byte	0x29
+	.long	0x135
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3548
+	.value	0x21d
+	.byte	0x66
+	.long	0x129
+	.uleb128 0x7
+	.long	.LASF3549
+	.value	0x21d
+	.byte	0xb0
+	.long	0x129
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3115
+	.value	0x22e
+	.byte	0x19
+	.long	0x135
+	.uleb128 0x9
+	.uleb128 0x7
+	.long	.LASF3550
+	.value	0x231
+	.byte	0x17
+	.long	0x1d5e
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0xb5
+	.long	0x1d36
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x5
+	.long	0x10c
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x5
+	.long	0x8dc
+	.uleb128 0xf
+	.long	0x18c
+	.long	0x1d5e
+	.uleb128 0x2
+	.long	0xb0
+	.uleb128 0x2
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	0x1d4a
+	.uleb128 0x1d
+	.long	.LASF3551
+	.value	0x149
+	.byte	0xc
+	.long	0x88
+	.long	0x1dbc
+	.uleb128 0x8
+	.long	.LASF3492
+	.value	0x149
+	.byte	0x30
+	.long	0x3cf
+	.uleb128 0x8
+	.long	.LASF3544
+	.value	0x149
+	.byte	0x40
+	.long	0xb0
+	.uleb128 0x16
+	.string	"row"
+	.value	0x149
+	.byte	0x4e
+	.long	0xef
+	.uleb128 0x8
+	.long	.LASF3545
+	.value	0x149
+	.byte	0x5b
+	.long	0xef
+	.uleb128 0x7
+	.long	.LASF3552
+	.value	0x14b
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x6
+	.string	"cnt"
+	.value	0x14c
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3553
+	.value	0x141
+	.long	0x1de0
+	.uleb128 0x16
+	.string	"buf"
+	.value	0x141
+	.byte	0x20
+	.long	0xb0
+	.uleb128 0x8
+	.long	.LASF3554
+	.value	0x141
+	.byte	0x29
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3555
+	.value	0x131
+	.long	0x1e24
+	.uleb128 0x16
+	.string	"buf"
+	.value	0x131
+	.byte	0x24
+	.long	0xb0
+	.uleb128 0x8
+	.long	.LASF3554
+	.value	0x131
+	.byte	0x2d
+	.long	0x88
+	.uleb128 0x6
+	.string	"i"
+	.value	0x133
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x6
+	.string	"j"
+	.value	0x133
+	.byte	0xc
+	.long	0x88
+	.uleb128 0x6
+	.string	"len"
+	.value	0x134
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3556
+	.value	0x115
+	.long	0x1e52
+	.uleb128 0x8
+	.long	.LASF3546
+	.value	0x115
+	.byte	0x24
+	.long	0xe3
+	.uleb128 0x8
+	.long	.LASF3557
+	.value	0x115
+	.byte	0x31
+	.long	0xb0
+	.uleb128 0x6
+	.string	"k"
+	.value	0x117
+	.byte	0xd
+	.long	0xef
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF3558
+	.value	0x110
+	.byte	0xc
+	.long	0x18c
+	.long	0x1e6f
+	.uleb128 0x8
+	.long	.LASF3559
+	.value	0x110
+	.byte	0x2e
+	.long	0x5cd
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3560
+	.value	0x10b
+	.long	0x1e87
+	.uleb128 0x8
+	.long	.LASF3561
+	.value	0x10b
+	.byte	0x28
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF3562
+	.value	0x106
+	.long	0x1e9f
+	.uleb128 0x8
+	.long	.LASF3561
+	.value	0x106
+	.byte	0x28
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3563
+	.byte	0xfe
+	.long	0x1ec2
+	.uleb128 0x1c
+	.long	.LASF3561
+	.byte	0x13
+	.byte	0xfe
+	.byte	0x2a
+	.long	0x3cf
+	.uleb128 0x1c
+	.long	.LASF3564
+	.byte	0x13
+	.byte	0xfe
+	.byte	0x3b
+	.long	0xc1
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3565
+	.byte	0x13
+	.byte	0xf8
+	.byte	0x10
+	.long	0xef
+	.long	0x1edf
+	.uleb128 0x1c
+	.long	.LASF3561
+	.byte	0x13
+	.byte	0xf8
+	.byte	0x31
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF3566
+	.byte	0xe5
+	.long	0x1f03
+	.uleb128 0x1c
+	.long	.LASF3561
+	.byte	0x13
+	.byte	0xe5
+	.byte	0x2c
+	.long	0x3cf
+	.uleb128 0x9
+	.uleb128 0x27
+	.string	"ptr"
+	.byte	0xea
+	.byte	0x1b
+	.long	0x6ef
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.long	.LASF3568
+	.byte	0x13
+	.byte	0x94
+	.byte	0x10
+	.long	0x3cf
+	.uleb128 0x28
+	.long	.LASF3569
+	.byte	0x87
+	.long	0x18c
+	.long	0x1f35
+	.uleb128 0x1c
+	.long	.LASF3561
+	.byte	0x13
+	.byte	0x87
+	.byte	0x29
+	.long	0x3cf
+	.uleb128 0x9
+	.uleb128 0x27
+	.string	"i"
+	.byte	0x8c
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF3570
+	.byte	0x7d
+	.long	0x3cf
+	.uleb128 0x29
+	.long	.LASF3571
+	.byte	0x72
+	.long	0x3cf
+	.uleb128 0x28
+	.long	.LASF3572
+	.byte	0x68
+	.long	0x18c
+	.long	0x1f64
+	.uleb128 0x1c
+	.long	.LASF3492
+	.byte	0x13
+	.byte	0x68
+	.byte	0x2b
+	.long	0x3cf
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3573
+	.byte	0xf
+	.byte	0x48
+	.byte	0x1e
+	.long	0xbcb
+	.long	0x1f7d
+	.uleb128 0x2a
+	.string	"s"
+	.byte	0x48
+	.long	0x137d
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3574
+	.byte	0xf
+	.byte	0x46
+	.byte	0x1e
+	.long	0xba6
+	.long	0x1f96
+	.uleb128 0x2a
+	.string	"s"
+	.byte	0x46
+	.long	0x137d
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF3575
+	.byte	0x8
+	.byte	0x76
+	.byte	0x1d
+	.long	0x6be
+	.uleb128 0x1c
+	.long	.LASF3576
+	.byte	0x8
+	.byte	0x76
+	.byte	0x3c
+	.long	0x6ef
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 60
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 29 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.file 32 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 34 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 35 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 51 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.file 52 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 53 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 54 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x36
+	.byte	0x4
+	.file 55 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 56 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 57 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.file 58 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 59 "./src/main/build/version.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x4
+	.file 60 "./src/main/cms/cms_menu_osd.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1142
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1157
+	.byte	0x4
+	.file 63 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 64 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1184
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x1c
+	.byte	0x4
+	.file 65 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x41
+	.byte	0x4
+	.file 66 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xc
+	.file 67 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1256
+	.byte	0x4
+	.file 68 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1257
+	.byte	0x4
+	.file 69 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1261
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 70 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x19
+	.file 71 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2432
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 72 "./src/main/io/rcdevice_cam.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x48
+	.file 73 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2476
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2477
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x4
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2479
+	.byte	0x4
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2480
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2481
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x1ae
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2520
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.file 84 "./src/main/io/rcdevice.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x55
+	.file 86 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x56
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2547
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.file 87 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 88 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.file 89 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x59
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2994
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2995
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2996
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2997
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2998
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2999
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF3000
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF3001
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF3002
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF3003
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF3004
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF3005
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF3006
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF3007
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF3008
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF3009
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF3010
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF3011
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF3012
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF3013
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF3014
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF3015
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1047
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1144
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1156
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1183
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1255
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1272
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF2416
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2431
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.cef84115c5f2700d3af586ea6b7bb2c4,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2474
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2489
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.67.277a58c7a93f2b211d77d6e251af7efe,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2505
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2510
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2512
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2545
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF2546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2760
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF2779
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2780
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2781
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF2782
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2783
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF2785
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2786
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF2788
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2789
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2790
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF2791
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2792
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2795
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2796
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2797
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2801
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2802
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2803
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2804
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2805
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2816
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2845
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2846
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2861
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2868
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2873
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2874
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2876
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2882
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2885
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2886
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2890
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2893
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2900
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2914
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2915
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2918
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2919
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2920
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2923
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2924
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2925
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2926
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2927
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2928
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2929
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2930
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2931
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2932
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2933
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2934
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2935
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice.h.25.ab71b74eff9152b05356e04bd1f208bf,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2936
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2937
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2938
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2940
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2941
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2942
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2943
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2944
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2945
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2946
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2947
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2948
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2949
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2950
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2952
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2953
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2954
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2955
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2956
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2957
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2958
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2959
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2960
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice_cam.h.29.f99909877ac3f04c1606d791179d7a71,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2962
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2963
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2964
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2966
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2967
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2968
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2969
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2970
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2971
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2972
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2973
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2974
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2975
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2977
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2979
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2981
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2982
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2983
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2984
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2985
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2986
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2987
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2988
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2989
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2990
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2991
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2992
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2993
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF3581
+	.long	.LASF3582
+	.long	.LASF3583
+	.long	.LASF3584
+	.long	.LASF3585
+	.long	.LASF3586
+	.long	.LASF3587
+	.long	.LASF3588
+	.long	.LASF3589
+	.long	.LASF3590
+	.long	.LASF3591
+	.long	.LASF3592
+	.long	.LASF3593
+	.long	.LASF3594
+	.long	.LASF3595
+	.long	.LASF3596
+	.long	.LASF3597
+	.long	.LASF3598
+	.long	.LASF3599
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5a
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3600
+	.byte	0xf
+	.long	.LASF3601
+	.byte	0xf
+	.long	.LASF3602
+	.byte	0xf
+	.long	.LASF3603
+	.byte	0x13
+	.long	.LASF3604
+	.byte	0x4
+	.long	.LASF3605
+	.byte	0x6
+	.long	.LASF3606
+	.byte	0x6
+	.long	.LASF3607
+	.byte	0x3
+	.long	.LASF3608
+	.byte	0x3
+	.long	.LASF3609
+	.byte	0x3
+	.long	.LASF3610
+	.byte	0x3
+	.long	.LASF3611
+	.byte	0x6
+	.long	.LASF3612
+	.byte	0x7
+	.long	.LASF3613
+	.byte	0x1
+	.long	.LASF3614
+	.byte	0x7
+	.long	.LASF3606
+	.byte	0x9
+	.long	.LASF3615
+	.byte	0x6
+	.long	.LASF3616
+	.byte	0x7
+	.long	.LASF3617
+	.byte	0x3
+	.long	.LASF3618
+	.byte	0x12
+	.long	.LASF3619
+	.byte	0x4
+	.long	.LASF3620
+	.byte	0x4
+	.long	.LASF3621
+	.byte	0xa
+	.long	.LASF3622
+	.byte	0x7
+	.long	.LASF3623
+	.byte	0x8
+	.long	.LASF3624
+	.byte	0x7
+	.long	.LASF3625
+	.byte	0x7
+	.long	.LASF3604
+	.byte	0x6
+	.long	.LASF3626
+	.byte	0x12
+	.long	.LASF3627
+	.byte	0x13
+	.long	.LASF3628
+	.byte	0x13
+	.long	.LASF3628
+	.byte	0x12
+	.long	.LASF3629
+	.byte	0xf
+	.long	.LASF3630
+	.byte	0x12
+	.long	.LASF3631
+	.byte	0x12
+	.long	.LASF3632
+	.byte	0xf
+	.long	.LASF3633
+	.byte	0xf
+	.long	.LASF3634
+	.byte	0x11
+	.long	.LASF3635
+	.byte	0xf
+	.long	.LASF3636
+	.byte	0x10
+	.long	.LASF3637
+	.byte	0x10
+	.long	.LASF3638
+	.byte	0xf
+	.long	.LASF3639
+	.byte	0xf
+	.long	.LASF3640
+	.byte	0xf
+	.long	.LASF3641
+	.byte	0xe
+	.long	.LASF3642
+	.byte	0xe
+	.long	.LASF3643
+	.byte	0x12
+	.long	.LASF3644
+	.byte	0x12
+	.long	.LASF3645
+	.byte	0xf
+	.long	.LASF3646
+	.byte	0xf
+	.long	.LASF3647
+	.byte	0xd
+	.long	.LASF3648
+	.byte	0xc
+	.long	.LASF3649
+	.byte	0xb
+	.long	.LASF3650
+	.byte	0xc
+	.long	.LASF3651
+	.byte	0xc
+	.long	.LASF3652
+	.byte	0x2
+	.long	.LASF3653
+	.byte	0x2
+	.long	.LASF3654
+	.byte	0x5
+	.long	.LASF3655
+	.byte	0x2
+	.long	.LASF3656
+	.byte	0x3
+	.long	.LASF3657
+	.byte	0x4
+	.long	.LASF3658
+	.byte	0x13
+	.long	.LASF3659
+	.byte	0x4
+	.long	.LASF3660
+	.byte	0x6
+	.long	.LASF3661
+	.byte	0x5
+	.long	.LASF3662
+	.byte	0x5
+	.long	.LASF3663
+	.byte	0x6
+	.long	.LASF3664
+	.byte	0x6
+	.long	.LASF3665
+	.byte	0x7
+	.long	.LASF3666
+	.byte	0x8
+	.long	.LASF3667
+	.byte	0x4
+	.long	.LASF3668
+	.byte	0x9
+	.long	.LASF3669
+	.byte	0x12
+	.long	.LASF3670
+	.byte	0xe
+	.long	.LASF3671
+	.byte	0xe
+	.long	.LASF3672
+	.byte	0xe
+	.long	.LASF3673
+	.byte	0xe
+	.long	.LASF3674
+	.byte	0xe
+	.long	.LASF3675
+	.byte	0xe
+	.long	.LASF3676
+	.byte	0xf
+	.long	.LASF3677
+	.byte	0xf
+	.long	.LASF3678
+	.byte	0xf
+	.long	.LASF3669
+	.byte	0xf
+	.long	.LASF3679
+	.byte	0x9
+	.long	.LASF3680
+	.byte	0x6
+	.long	.LASF3681
+	.byte	0x6
+	.long	.LASF3682
+	.byte	0x6
+	.long	.LASF3683
+	.byte	0x6
+	.long	.LASF3684
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2344:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF3471:
+	.string	"settingGet"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1954:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF2703:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1801:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF2886:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2594:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF3210:
+	.string	"setting_mode_e"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF3457:
+	.string	"strcat"
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF2933:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF2067:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF2837:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1879:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF1221:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF2764:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2615:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2251:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF725:
+	.string	"_CTYPE_H 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1601:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF3518:
+	.string	"_right19"
+.LASF383:
+	.string	"SITL 1"
+.LASF2289:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF3019:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2447:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF1086:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF2155:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1399:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF3243:
+	.string	"OSD_POWER"
+.LASF1665:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1947:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF2799:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF3563:
+	.string	"cmsPageSelect"
+.LASF2443:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1764:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2260:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF3562:
+	.string	"cmsPageNext"
+.LASF1690:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF2845:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF3365:
+	.string	"OWNER_1WIRE"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF3057:
+	.string	"release"
+.LASF1540:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF3454:
+	.string	"pageTop"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF727:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1328:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF1664:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF1490:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF3458:
+	.string	"settingGetValueNameMaxSize"
+.LASF2135:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF3366:
+	.string	"OWNER_AIRSPEED"
+.LASF2782:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1946:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF2319:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF3325:
+	.string	"OSD_GFORCE_X"
+.LASF3326:
+	.string	"OSD_GFORCE_Y"
+.LASF3327:
+	.string	"OSD_GFORCE_Z"
+.LASF2305:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF1760:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF745:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1958:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF3174:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1148:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF2352:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF3233:
+	.string	"OSD_THROTTLE_POS"
+.LASF1940:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF3465:
+	.string	"memset"
+.LASF2381:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF3495:
+	.string	"cmsScanKeys"
+.LASF2939:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_GET_DEVICE_INFO 0x00"
+.LASF1135:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF2080:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF2205:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF3007:
+	.string	"cmsPageDebug() "
+.LASF1703:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF3227:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF3109:
+	.string	"OSD_MenuElement"
+.LASF1779:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF2841:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2619:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF2689:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1550:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF2168:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF1004:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1283:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF1478:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF1815:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1925:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF2833:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2213:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF1411:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF1101:
+	.string	"CMS_EXIT (0)"
+.LASF3374:
+	.string	"RESOURCE_IO"
+.LASF2148:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF2792:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1461:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF3071:
+	.string	"isReady"
+.LASF3133:
+	.string	"multipler"
+.LASF2988:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF1866:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF3218:
+	.string	"minmax"
+.LASF2185:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF2200:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF2825:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2984:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF3524:
+	.string	"pPort"
+.LASF1030:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1374:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF1482:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF1498:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF2283:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF2912:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF3482:
+	.string	"cmsUpdate"
+.LASF3333:
+	.string	"OWNER_FREE"
+.LASF1178:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1744:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF2836:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1660:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF764:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1335:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF2463:
+	.string	"OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)"
+.LASF2726:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1854:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF3405:
+	.string	"BOXLIGHTS"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF3032:
+	.string	"int16_t"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1910:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF1291:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF1408:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF777:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1855:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF2903:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1389:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF1666:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF1631:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF1439:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1952:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF2556:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2047:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF1355:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF1111:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1209:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1677:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF1837:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF2357:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF3097:
+	.string	"OME_INT8"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1657:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF1849:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF1356:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF3130:
+	.string	"OSD_INT8_t"
+.LASF1390:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF2371:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1066:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF2333:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF3124:
+	.string	"onExit"
+.LASF2102:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF2293:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF2738:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1394:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF3396:
+	.string	"BOXHEADINGHOLD"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1165:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF2489:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1982:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF1435:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF1099:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF2079:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF1484:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF1710:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF2353:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF1686:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF1830:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF988:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF3201:
+	.string	"VAR_INT8"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2910:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF3568:
+	.string	"cmsDisplayPortGetCurrent"
+.LASF1769:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF2368:
+	.string	"SETTING_NAME_MAX 16"
+.LASF1474:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF2608:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1385:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF2194:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF2137:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2512:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF1545:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF1699:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF3036:
+	.string	"uint32_t"
+.LASF2558:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2945:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF2664:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3221:
+	.string	"config"
+.LASF2462:
+	.string	"OSD_VISIBLE_FLAG 0x0800"
+.LASF2684:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1900:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2671:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF755:
+	.string	"toascii(c) __toascii (c)"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2747:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1843:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF790:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF2145:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF1277:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF1184:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2955:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF2231:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF1054:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1579:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF3106:
+	.string	"OME_BACK_AND_END"
+.LASF1228:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF1120:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2944:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF3010:
+	.string	"CMS_CURSOR_BLINK_DELAY_MS 500"
+.LASF2367:
+	.string	"SETTING_NAME_MIN 0"
+.LASF3005:
+	.string	"CMS_POLL_INTERVAL_US 100000"
+.LASF2504:
+	.string	"FILENAME_MAX 4096"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2734:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2828:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1899:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF2602:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF747:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF2068:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF3155:
+	.string	"ADC_AIRSPEED"
+.LASF3490:
+	.string	"repeatBase"
+.LASF2713:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3529:
+	.string	"cmsMenuOpen"
+.LASF2441:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF2254:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF3308:
+	.string	"OSD_MC_POS_XYZ_P_OUTPUTS"
+.LASF2966:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1224:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF3264:
+	.string	"OSD_TRIP_DIST"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF782:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF3542:
+	.string	"cmsDrawMenuEntry"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF2355:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2534:
+	.string	"__f32(x) x ##f32"
+.LASF3448:
+	.string	"menu"
+.LASF2727:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2411:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF1627:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF2061:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF2858:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1975:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF2382:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF3145:
+	.string	"CMS_KEY_MENU"
+.LASF2390:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF2662:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2107:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF1462:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF3486:
+	.string	"lastCmsHeartBeatMs"
+.LASF1171:
+	.string	"BIT(x) (1 << (x))"
+.LASF2631:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1765:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF1822:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF3086:
+	.string	"cachedSupportedTextAttributes"
+.LASF3375:
+	.string	"RESOURCE_TIMER"
+.LASF3060:
+	.string	"screenSize"
+.LASF2820:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1589:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF2187:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF2373:
+	.string	"SETTING_STATS_MIN 0"
+.LASF2842:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF3229:
+	.string	"OSD_ONTIME"
+.LASF3009:
+	.string	"CMS_NUM_FIELD_LEN 5"
+.LASF1522:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF2612:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF3240:
+	.string	"OSD_ROLL_PIDS"
+.LASF2487:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF1096:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF2763:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF2778:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF3299:
+	.string	"OSD_NAV_FW_CRUISE_THR"
+.LASF1481:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF2919:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1475:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF2413:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF3398:
+	.string	"BOXHEADADJ"
+.LASF1937:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF1308:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF1988:
+	.string	"SETTING_PID_TYPE 236"
+.LASF3147:
+	.string	"cms_key_e"
+.LASF3489:
+	.string	"repeatCount"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1318:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1771:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1691:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF1776:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF3224:
+	.string	"OSD_RSSI_VALUE"
+.LASF3121:
+	.string	"CMSMenuFuncPtr"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1373:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF2682:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2151:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF3446:
+	.string	"externKey"
+.LASF2856:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1858:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF1905:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF2498:
+	.string	"SEEK_CUR 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF3090:
+	.string	"OME_LabelFunc"
+.LASF1196:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1261:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF2265:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF2829:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF3203:
+	.string	"VAR_INT16"
+.LASF1340:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF2301:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF512:
+	.string	"__wur "
+.LASF1615:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF2288:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF1272:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1561:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF1852:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF1576:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2507:
+	.string	"FOPEN_MAX 16"
+.LASF1491:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF1233:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF2141:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF2379:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF1688:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1422:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF743:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1820:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF3347:
+	.string	"OWNER_I2C"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF2243:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF1926:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF734:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF2931:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2234:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1332:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3554:
+	.string	"size"
+.LASF1501:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF2813:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2195:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF3247:
+	.string	"OSD_HOME_DIST"
+.LASF3579:
+	.string	"millis"
+.LASF1222:
+	.string	"PG_INAV_START 1000"
+.LASF1404:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2153:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF2880:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF3114:
+	.string	"itemId"
+.LASF1170:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1302:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF2844:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1502:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF1363:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF3476:
+	.string	"displayGrab"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2639:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF2257:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1740:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF3543:
+	.string	"screenRow"
+.LASF2004:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2495:
+	.string	"BUFSIZ 8192"
+.LASF1974:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF2960:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF773:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1949:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF3402:
+	.string	"BOXMANUAL"
+.LASF1085:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2548:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1396:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1625:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF2545:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF2163:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF3192:
+	.string	"ARMING_DISABLED_OOM"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2926:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1562:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF3421:
+	.string	"BOXCAMERA1"
+.LASF553:
+	.string	"__stub_stty "
+.LASF3423:
+	.string	"BOXCAMERA3"
+.LASF3576:
+	.string	"entry"
+.LASF1868:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF2065:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF2432:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF2240:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF3437:
+	.string	"cmsDisplayPorts"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF2030:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF3038:
+	.string	"size_t"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF779:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1507:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF3144:
+	.string	"CMS_KEY_ESC"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2577:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF3075:
+	.string	"displayPort_s"
+.LASF3088:
+	.string	"displayPort_t"
+.LASF2991:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF2481:
+	.string	"__FILE_defined 1"
+.LASF959:
+	.string	"USE_VCP"
+.LASF2627:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2699:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF3559:
+	.string	"element"
+.LASF1426:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF2249:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF1793:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF1354:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF1000:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF3555:
+	.string	"cmsPadLeftToSize"
+.LASF1407:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF1368:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF721:
+	.string	"__need_NULL"
+.LASF2690:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1656:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF1661:
+	.string	"SETTING_YAW_RATE 127"
+.LASF1705:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2133:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF2872:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF3385:
+	.string	"RESOURCE_SPI_CS"
+.LASF2493:
+	.string	"_IOLBF 1"
+.LASF1667:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF1698:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1953:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF2121:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF1343:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF1208:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF2929:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2247:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1202:
+	.string	"PG_RX_CONFIG 24"
+.LASF1063:
+	.string	"DYNAMIC (1 << 2)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1528:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF2349:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF2618:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF3380:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2850:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1835:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF1386:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF2576:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1521:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF2768:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2208:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2686:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2559:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF2526:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2049:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF2783:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF2969:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF2569:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF1349:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF2238:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF1729:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3102:
+	.string	"OME_FLOAT"
+.LASF2818:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF3096:
+	.string	"OME_BoolFunc"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1271:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2380:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF3371:
+	.string	"RESOURCE_NONE"
+.LASF1350:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1103:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1921:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF3485:
+	.string	"lastCalledMs"
+.LASF2660:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2370:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF3428:
+	.string	"BOXBRAKING"
+.LASF3342:
+	.string	"OWNER_PINDEBUG"
+.LASF3552:
+	.string	"colpos"
+.LASF1130:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF3249:
+	.string	"OSD_VARIO"
+.LASF2530:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF3401:
+	.string	"BOXNAVPOSHOLD"
+.LASF2881:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2486:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF2538:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2497:
+	.string	"SEEK_SET 0"
+.LASF1831:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF3336:
+	.string	"OWNER_PPMINPUT"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF995:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1931:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF3131:
+	.string	"OSD_INT16_t"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1141:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1558:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF3231:
+	.string	"OSD_FLYMODE"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1200:
+	.string	"PG_SERVO_MIXER 21"
+.LASF780:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF2122:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF1811:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF2156:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF2227:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF2989:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF2078:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF2702:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2616:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF3316:
+	.string	"OSD_TEMP_SENSOR_4_TEMPERATURE"
+.LASF2893:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1454:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF2885:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2425:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF2276:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF1316:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF740:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF3087:
+	.string	"maxChar"
+.LASF2614:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2824:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF2814:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2116:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF3063:
+	.string	"readChar"
+.LASF1395:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF3311:
+	.string	"OSD_BARO_TEMPERATURE"
+.LASF2060:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF2177:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2540:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2610:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2866:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2081:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF2217:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF1406:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF1897:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF2718:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2927:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2846:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF3261:
+	.string	"OSD_BATTERY_REMAINING_CAPACITY"
+.LASF1400:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF1104:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3223:
+	.string	"setting_t"
+.LASF1906:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF1587:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF1706:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF2342:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1323:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF2806:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF3054:
+	.string	"displayPortVTable_s"
+.LASF3052:
+	.string	"displayPortVTable_t"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2551:
+	.string	"IOCFG_AF_PP 0"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF1106:
+	.string	"sq(x) ((x)*(x))"
+.LASF1073:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1082:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2464:
+	.string	"OSD_POS(x,y) ((x) | ((y) << 5))"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1994:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF3464:
+	.string	"strncpy"
+.LASF3077:
+	.string	"device"
+.LASF2579:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2125:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF731:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1495:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF2036:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2696:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3022:
+	.string	"__uint8_t"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2656:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF2917:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF753:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF2557:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF2323:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF3216:
+	.string	"settingLookupTableConfig_t"
+.LASF719:
+	.string	"NULL"
+.LASF2754:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF3416:
+	.string	"BOXSURFACE"
+.LASF3257:
+	.string	"OSD_THROTTLE_POS_AUTO_THR"
+.LASF1313:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2685:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3194:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2178:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF2114:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2076:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF3287:
+	.string	"OSD_BOARD_ALIGN_PITCH"
+.LASF1749:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF376:
+	.string	"unix 1"
+.LASF2585:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF924:
+	.string	"USE_MAG "
+.LASF1873:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1722:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF1241:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF3080:
+	.string	"posX"
+.LASF3081:
+	.string	"posY"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1458:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF2698:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1916:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF1307:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF3242:
+	.string	"OSD_YAW_PIDS"
+.LASF791:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF2983:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1092:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1020:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2591:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1999:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF1563:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2891:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF3493:
+	.string	"cmsSetExternKey"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2993:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF2040:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF1523:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF1800:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF1640:
+	.string	"SETTING_TPA_RATE 120"
+.LASF2661:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2604:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF3483:
+	.string	"currentTimeUs"
+.LASF1050:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF3344:
+	.string	"OWNER_RANGEFINDER"
+.LASF1639:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF2861:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF2147:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF3143:
+	.string	"CMS_KEY_RIGHT"
+.LASF1848:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF2448:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF3202:
+	.string	"VAR_UINT16"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF3267:
+	.string	"OSD_MAP_NORTH"
+.LASF1536:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF1555:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF2801:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1770:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2623:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF3501:
+	.string	"_left2"
+.LASF1444:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1068:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1903:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2083:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF2210:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF2020:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF1799:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF3348:
+	.string	"OWNER_SDCARD"
+.LASF1080:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF1817:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF1353:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1932:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF3394:
+	.string	"BOXHORIZON"
+.LASF1914:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+.LASF3356:
+	.string	"OWNER_LED_STRIP"
+.LASF2492:
+	.string	"_IOFBF 0"
+.LASF1966:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2830:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2180:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF2552:
+	.string	"IOCFG_AF_OD 0"
+.LASF3297:
+	.string	"OSD_MANUAL_ROLL_RATE"
+.LASF1284:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF1701:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF3497:
+	.string	"retval"
+.LASF1273:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF2732:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2461:
+	.string	"OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)"
+.LASF3480:
+	.string	"lastCalledUs"
+.LASF1276:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF3236:
+	.string	"OSD_MAH_DRAWN"
+.LASF3431:
+	.string	"BOXFPVANGLEMIX"
+.LASF3050:
+	.string	"displayCanvas_s"
+.LASF3048:
+	.string	"displayCanvas_t"
+.LASF1810:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF2743:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2834:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1745:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF3204:
+	.string	"VAR_UINT32"
+.LASF1930:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF1219:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF3056:
+	.string	"grab"
+.LASF3474:
+	.string	"displayResync"
+.LASF1806:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF1743:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF1874:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF2311:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF2360:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF3451:
+	.string	"menuStack"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF2985:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2508:
+	.string	"stdin stdin"
+.LASF1581:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF2424:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2198:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2574:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1239:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF3129:
+	.string	"OSD_UINT8_t"
+.LASF3190:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF1437:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF3040:
+	.string	"timeUs_t"
+.LASF1791:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2069:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF2728:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1888:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF3172:
+	.string	"ARMED"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1780:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF3407:
+	.string	"BOXOSD"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2934:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF3547:
+	.string	"suffix"
+.LASF2638:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1716:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2750:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1814:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF2911:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF2328:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF3352:
+	.string	"OWNER_OSD"
+.LASF1089:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF729:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1612:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1928:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF2640:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF3319:
+	.string	"OSD_TEMP_SENSOR_7_TEMPERATURE"
+.LASF2315:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF1509:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF1312:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF1026:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1052:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1234:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF3015:
+	.string	"BUTTON_PAUSE 500"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1177:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2485:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF1483:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF1543:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF1694:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF1767:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF3276:
+	.string	"OSD_CRUISE_HEADING_ADJUSTMENT"
+.LASF2932:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF3270:
+	.string	"OSD_WIND_SPEED_HORIZONTAL"
+.LASF2771:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1379:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF2077:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF3069:
+	.string	"getFontMetadata"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2109:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1175:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF3011:
+	.string	"IS_HI(X) (rxGetChannelValue(X) > 1750)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1736:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF1093:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2128:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF3169:
+	.string	"AUX10"
+.LASF3170:
+	.string	"AUX11"
+.LASF3171:
+	.string	"AUX12"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF2865:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF3443:
+	.string	"rightMenuColumn"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2857:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF2042:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF2589:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2899:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2672:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1614:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF1220:
+	.string	"PG_CF_END 56"
+.LASF3463:
+	.string	"strlen"
+.LASF2694:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF3345:
+	.string	"OWNER_SYSTEM"
+.LASF1125:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF3000:
+	.string	"CLR_PRINTLABEL(p,row) { entry_flags[row] &= ~PRINT_LABEL; }"
+.LASF3112:
+	.string	"func"
+.LASF2027:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2637:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1909:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF3447:
+	.string	"cmsCtx_s"
+.LASF1613:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2277:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF2898:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF3208:
+	.string	"MODE_DIRECT"
+.LASF2179:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF2013:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2307:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF2075:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF3002:
+	.string	"IS_READONLY(p) ((p)->flags & READONLY)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1882:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2915:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF3298:
+	.string	"OSD_MANUAL_YAW_RATE"
+.LASF1225:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1586:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF1262:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2332:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF1488:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF2184:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF1598:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF3138:
+	.string	"OSD_TAB_t"
+.LASF1249:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF3309:
+	.string	"OSD_3D_SPEED"
+.LASF2298:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF3012:
+	.string	"IS_LO(X) (rxGetChannelValue(X) < 1250)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1133:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2471:
+	.string	"OSD_HOMING_LIM_H3 38"
+.LASF757:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF1876:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF2902:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2603:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2324:
+	.string	"SETTING_SIM_PIN 348"
+.LASF1670:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF2805:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF2941:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_PRESS 0x02"
+.LASF1179:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1210:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2887:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF3235:
+	.string	"OSD_CURRENT_DRAW"
+.LASF3300:
+	.string	"OSD_NAV_FW_PITCH2THR"
+.LASF2335:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF3338:
+	.string	"OWNER_SERVO"
+.LASF2398:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF3135:
+	.string	"OSD_SETTING_s"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF3136:
+	.string	"OSD_SETTING_t"
+.LASF3578:
+	.string	"rc_alias"
+.LASF2565:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1402:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1604:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1650:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1176:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2001:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF2162:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF2524:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2246:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2797:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1955:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF2645:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1017:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2002:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2439:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF3411:
+	.string	"BOXNAVWP"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2015:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1539:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2028:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF3280:
+	.string	"OSD_LEVEL_PIDS"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2688:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1467:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF1934:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF2668:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2154:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF2021:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF3051:
+	.string	"displayFontMetadata_s"
+.LASF3049:
+	.string	"displayFontMetadata_t"
+.LASF2057:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF2256:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF3146:
+	.string	"CMS_KEY_SAVEMENU"
+.LASF2304:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF3364:
+	.string	"OWNER_TEMPERATURE"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF3399:
+	.string	"BOXCAMSTAB"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2350:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1027:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF3422:
+	.string	"BOXCAMERA2"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF3526:
+	.string	"cmsMenuExit"
+.LASF2914:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1653:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1232:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2973:
+	.string	"MIDRC_MAX 1700"
+.LASF3014:
+	.string	"BUTTON_TIME 250"
+.LASF1621:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF1533:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF1087:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF3246:
+	.string	"OSD_HOME_DIR"
+.LASF1201:
+	.string	"PG_IMU_CONFIG 22"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF2710:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2084:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF1057:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1315:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF1560:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF2216:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF2622:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1648:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF2816:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1950:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF3053:
+	.string	"osdCharacter_s"
+.LASF3041:
+	.string	"osdCharacter_t"
+.LASF2849:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1420:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF3046:
+	.string	"displayTransactionOption_e"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF3263:
+	.string	"OSD_EFFICIENCY_WH_PER_KM"
+.LASF3378:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1566:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF2263:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF1881:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2950:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF3414:
+	.string	"BOXGCSNAV"
+.LASF1832:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF2351:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF2976:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF3025:
+	.string	"__uint16_t"
+.LASF768:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1102:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF3317:
+	.string	"OSD_TEMP_SENSOR_5_TEMPERATURE"
+.LASF2877:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2438:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1929:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF1895:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF371:
+	.string	"__linux 1"
+.LASF3570:
+	.string	"cmsDisplayPortSelectNext"
+.LASF2224:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF3154:
+	.string	"ADC_CURRENT"
+.LASF1503:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF2405:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF1497:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF3176:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF3419:
+	.string	"BOXAUTOTRIM"
+.LASF1217:
+	.string	"PG_VTX_CONFIG 54"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2491:
+	.string	"__ssize_t_defined "
+.LASF2346:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF1659:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF2209:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF3393:
+	.string	"BOXANGLE"
+.LASF1143:
+	.string	"_STDARG_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2517:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF3567:
+	.string	"saveConfigAndNotify"
+.LASF2341:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF2244:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF2098:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1064:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1290:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF3387:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2012:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF3388:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2182:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF3064:
+	.string	"isTransferInProgress"
+.LASF754:
+	.string	"isascii(c) __isascii (c)"
+.LASF1511:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF3037:
+	.string	"uint64_t"
+.LASF854:
+	.string	"USE_CMS "
+.LASF1825:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2560:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF2099:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF2598:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1319:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF2417:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF3215:
+	.string	"tableIndex"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF2308:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF2287:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF1351:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF2928:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1938:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF3103:
+	.string	"OME_Setting"
+.LASF2900:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2316:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF3573:
+	.string	"SETTING_MODE"
+.LASF772:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF3093:
+	.string	"OME_Submenu"
+.LASF2094:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF758:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1570:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF2403:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF2572:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF3424:
+	.string	"BOXOSDALT1"
+.LASF3425:
+	.string	"BOXOSDALT2"
+.LASF1956:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF1531:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF2008:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF1469:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF3255:
+	.string	"OSD_GPS_HDOP"
+.LASF2188:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF3076:
+	.string	"vTable"
+.LASF718:
+	.string	"__need_size_t"
+.LASF2648:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1076:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF3509:
+	.string	"_left10"
+.LASF3507:
+	.string	"_left12"
+.LASF1129:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF3513:
+	.string	"_left14"
+.LASF3511:
+	.string	"_left16"
+.LASF1766:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF3517:
+	.string	"_left18"
+.LASF3219:
+	.string	"settingConfig_t"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1443:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1847:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF1186:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1078:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2136:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF3084:
+	.string	"cursorRow"
+.LASF2908:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF3095:
+	.string	"OME_Bool"
+.LASF1024:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1139:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF3042:
+	.string	"_Bool"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2181:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1850:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF1935:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF2884:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF3440:
+	.string	"cmsYieldUntil"
+.LASF3477:
+	.string	"displayRelease"
+.LASF2294:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF2429:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF3515:
+	.string	"_left20"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF3521:
+	.string	"_left22"
+.LASF3519:
+	.string	"_left24"
+.LASF1936:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF2337:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF3207:
+	.string	"setting_type_e"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF1578:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2444:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF2460:
+	.string	"OSD_ALTERNATE_LAYOUT_COUNT 3"
+.LASF2593:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1990:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF1011:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1230:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2440:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF3278:
+	.string	"OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1382:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2843:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF3329:
+	.string	"OSD_VTX_POWER"
+.LASF1023:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF3315:
+	.string	"OSD_TEMP_SENSOR_3_TEMPERATURE"
+.LASF1362:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF2285:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF3074:
+	.string	"getCanvas"
+.LASF2174:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF3434:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2329:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF2550:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1841:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF1541:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF1944:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF2278:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF1037:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF3305:
+	.string	"OSD_MC_VEL_X_PID_OUTPUTS"
+.LASF1172:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1813:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF762:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF787:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF2568:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF2563:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2957:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2971:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2848:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF2101:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF1151:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2000:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF1783:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF1608:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF3376:
+	.string	"RESOURCE_UART_TX"
+.LASF2913:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1544:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF2140:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF2118:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF2855:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF3537:
+	.string	"cmsDrawMenu"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1719:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF3253:
+	.string	"OSD_RTC_TIME"
+.LASF3441:
+	.string	"smallScreen"
+.LASF2274:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF3200:
+	.string	"VAR_UINT8"
+.LASF1833:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2306:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF396:
+	.string	"false 0"
+.LASF783:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2041:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF1154:
+	.string	"_VA_LIST_DEFINED "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1532:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF3181:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1687:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF3062:
+	.string	"writeChar"
+.LASF2144:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF1450:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF2281:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1856:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF2937:
+	.string	"RCDEVICE_PROTOCOL_MAX_PACKET_SIZE 64"
+.LASF3258:
+	.string	"OSD_HEADING_GRAPH"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2761:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF3575:
+	.string	"CMS_DATA_TYPE"
+.LASF1981:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF2453:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1403:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2840:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1182:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1145:
+	.string	"__need___va_list"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2058:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF3061:
+	.string	"writeString"
+.LASF3556:
+	.string	"cmsFormatFloat"
+.LASF1828:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2131:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF1242:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF3528:
+	.string	"pMenu"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1857:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF2132:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF2796:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF1796:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF2339:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2810:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2667:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF746:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1623:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF2362:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1851:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF1487:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF2468:
+	.string	"OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)"
+.LASF2573:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1977:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF2395:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF2873:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF2657:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF1465:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF2901:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1877:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF3245:
+	.string	"OSD_GPS_LAT"
+.LASF2412:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1245:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1505:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF2566:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF3293:
+	.string	"OSD_YAW_RATE"
+.LASF2052:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF2086:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2749:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF2982:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1864:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1428:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2543:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF2531:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF3498:
+	.string	"valuePointer"
+.LASF2327:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF3111:
+	.string	"CMSMenuOptFuncPtr"
+.LASF3409:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF3101:
+	.string	"OME_String"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF3222:
+	.string	"offset"
+.LASF2348:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3140:
+	.string	"CMS_KEY_UP"
+.LASF3185:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF2158:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF1453:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF2952:
+	.string	"BOXID_NONE 255"
+.LASF3368:
+	.string	"OWNER_PINIO"
+.LASF2784:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1968:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF749:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1204:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF2402:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1415:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF2776:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2410:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF1773:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2204:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF1534:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF3384:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1107:
+	.string	"FAST_MATH "
+.LASF3358:
+	.string	"OWNER_RX"
+.LASF3302:
+	.string	"OSD_DEBUG"
+.LASF3073:
+	.string	"commitTransaction"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2652:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3577:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF3478:
+	.string	"setServoOutputEnabled"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF1637:
+	.string	"SETTING_THR_EXPO 119"
+.LASF2503:
+	.string	"TMP_MAX 238328"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2953:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1337:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF1250:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1732:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF1424:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF3274:
+	.string	"OSD_HOME_HEADING_ERROR"
+.LASF3021:
+	.string	"__int8_t"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF3341:
+	.string	"OWNER_SERIAL"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF3415:
+	.string	"BOXKILLSWITCH"
+.LASF2611:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1682:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF2800:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2354:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2064:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF2541:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF1758:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF1091:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2546:
+	.string	"__STDIO_INLINE"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2451:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2999:
+	.string	"SET_PRINTLABEL(p,row) { entry_flags[row] |= PRINT_LABEL; }"
+.LASF2515:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2567:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1821:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF1214:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2090:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF1008:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2396:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF3390:
+	.string	"RESOURCE_RX_CE"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF2435:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF2998:
+	.string	"IS_PRINTLABEL(p,row) (entry_flags[row] & PRINT_LABEL)"
+.LASF2827:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1571:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF2986:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1492:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF2653:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1741:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF1836:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1704:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF3199:
+	.string	"setting_max_t"
+.LASF2513:
+	.string	"_BITS_FLOATN_H "
+.LASF2892:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1446:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF2949:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF2366:
+	.string	"SETTING_NAME 362"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF1984:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2129:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF3117:
+	.string	"flags"
+.LASF1372:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF1606:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF1138:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2386:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF2878:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF3039:
+	.string	"timeMs_t"
+.LASF3418:
+	.string	"BOXTURNASSIST"
+.LASF3560:
+	.string	"cmsPagePrev"
+.LASF2888:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2987:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1157:
+	.string	"FTOA_BUFFER_SIZE 13"
+.LASF2269:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF2587:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2625:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1345:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF3453:
+	.string	"pageCount"
+.LASF1845:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF1047:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF1236:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1197:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1884:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF1728:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2781:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1147:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2564:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF2765:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF3343:
+	.string	"OWNER_TIMER"
+.LASF1675:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF2554:
+	.string	"IOCFG_IPU 0"
+.LASF2225:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF1123:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1161:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2780:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1211:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1754:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF1553:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF3449:
+	.string	"page"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1237:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF2773:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2159:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF3442:
+	.string	"leftMenuColumn"
+.LASF2613:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1865:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF1289:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF1060:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2665:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF730:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2510:
+	.string	"stderr stderr"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF3217:
+	.string	"lookup"
+.LASF1257:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF3105:
+	.string	"OME_END"
+.LASF2149:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF2907:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2241:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF1979:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF2779:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF1346:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2514:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2974:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF3303:
+	.string	"OSD_FW_ALT_PID_OUTPUTS"
+.LASF1436:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF1144:
+	.string	"_ANSI_STDARG_H_ "
+.LASF1033:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1652:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF2226:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF2300:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF1432:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF3410:
+	.string	"BOXFAILSAFE"
+.LASF1126:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF2717:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1292:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF3318:
+	.string	"OSD_TEMP_SENSOR_6_TEMPERATURE"
+.LASF2017:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF3241:
+	.string	"OSD_PITCH_PIDS"
+.LASF1229:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF3017:
+	.string	"short unsigned int"
+.LASF3248:
+	.string	"OSD_HEADING"
+.LASF2484:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1117:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF2643:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1778:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF1384:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF789:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF1965:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2712:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1622:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF1370:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF1235:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2812:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1122:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF3459:
+	.string	"settingLookupValueName"
+.LASF1961:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF1333:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF1907:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF3023:
+	.string	"__int16_t"
+.LASF3132:
+	.string	"OSD_UINT16_t"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF763:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF2202:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF1267:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1246:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF1094:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF2071:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1477:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF2023:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2924:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1472:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2494:
+	.string	"_IONBF 2"
+.LASF2847:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2839:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF3134:
+	.string	"OSD_FLOAT_t"
+.LASF2150:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2853:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1266:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF3004:
+	.string	"CMS_UPDATE_INTERVAL_US 50000"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1869:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF1425:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1628:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF993:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF3211:
+	.string	"settingMinMaxConfig_s"
+.LASF3213:
+	.string	"settingMinMaxConfig_t"
+.LASF1672:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF1298:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF2936:
+	.string	"RCDEVICE_PROTOCOL_HEADER 0xCC"
+.LASF3339:
+	.string	"OWNER_SOFTSERIAL"
+.LASF3259:
+	.string	"OSD_EFFICIENCY_MAH_PER_KM"
+.LASF1378:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF2760:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF2387:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF2752:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1651:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF1742:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF1872:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF3367:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF2056:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF2186:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF2482:
+	.string	"__struct_FILE_defined 1"
+.LASF2766:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF3532:
+	.string	"cmsMenuChange"
+.LASF2678:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF2601:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1861:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF1580:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF1459:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF1638:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3186:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1049:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2772:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2532:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF1725:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1254:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1460:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF1377:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF2321:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1414:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF1300:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1212:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF3484:
+	.string	"rcDelayMs"
+.LASF1043:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1471:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF1678:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF3426:
+	.string	"BOXOSDALT3"
+.LASF1554:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF2736:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1518:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1192:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF2769:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"USE_BARO "
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2669:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2758:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1602:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF2189:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF3275:
+	.string	"OSD_CRUISE_HEADING_ERROR"
+.LASF3151:
+	.string	"float"
+.LASF2389:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF2823:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2082:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF2798:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2019:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF2674:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF997:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1062:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF3016:
+	.string	"unsigned char"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2279:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3467:
+	.string	"rxGetChannelValue"
+.LASF2407:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF3306:
+	.string	"OSD_MC_VEL_Y_PID_OUTPUTS"
+.LASF1361:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1015:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2737:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2600:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2831:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2980:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1183:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1632:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1029:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2034:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF2266:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF1901:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF2655:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF3435:
+	.string	"entry_flags"
+.LASF1524:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF2628:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF3373:
+	.string	"RESOURCE_OUTPUT"
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF3531:
+	.string	"cmsMenuBack"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF3290:
+	.string	"OSD_THROTTLE_EXPO"
+.LASF2691:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2310:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF3296:
+	.string	"OSD_MANUAL_PITCH_RATE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF3432:
+	.string	"BOXLOITERDIRCHN"
+.LASF1746:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF2874:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF766:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF2166:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF698:
+	.string	"__need_size_t "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2909:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2270:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF373:
+	.string	"linux 1"
+.LASF2215:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1893:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF853:
+	.string	"USE_STATS "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2742:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2996:
+	.string	"SET_PRINTVALUE(p,row) { entry_flags[row] |= PRINT_VALUE; }"
+.LASF1022:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2414:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF1963:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF2273:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF3321:
+	.string	"OSD_PLUS_CODE"
+.LASF1634:
+	.string	"SETTING_THR_MID 118"
+.LASF2815:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF1240:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1917:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF2670:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3362:
+	.string	"OWNER_SPI_PREINIT"
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2478:
+	.string	"____mbstate_t_defined 1"
+.LASF3549:
+	.string	"_right1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF3502:
+	.string	"_right3"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF3500:
+	.string	"_right5"
+.LASF3099:
+	.string	"OME_UINT16"
+.LASF3504:
+	.string	"_right9"
+.LASF1146:
+	.string	"__GNUC_VA_LIST "
+.LASF2199:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2446:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2383:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF2219:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1070:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF1069:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2309:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF1886:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF3272:
+	.string	"OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2544:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF2979:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2032:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF1542:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF2427:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1418:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF2762:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF3572:
+	.string	"cmsDisplayPortRegister"
+.LASF2143:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF2745:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF775:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF1616:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1002:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF3220:
+	.string	"encoded_name"
+.LASF3323:
+	.string	"OSD_MAP_REFERENCE"
+.LASF1365:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF2753:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2946:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF1140:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2522:
+	.string	"__HAVE_FLOAT32 1"
+.LASF3116:
+	.string	"type"
+.LASF3320:
+	.string	"OSD_ALTITUDE_MSL"
+.LASF2596:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2005:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF3043:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1077:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF2707:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2995:
+	.string	"IS_PRINTVALUE(p,row) (entry_flags[row] & PRINT_VALUE)"
+.LASF2093:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2863:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1753:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1150:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1310:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1162:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2571:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF3187:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1548:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF3085:
+	.string	"grabCount"
+.LASF3496:
+	.string	"cmsHandleKey"
+.LASF2003:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF2787:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1863:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF2314:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF1105:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF1309:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF2889:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2890:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2789:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2470:
+	.string	"OSD_HOMING_LIM_H2 16"
+.LASF2864:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1655:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF2331:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF2978:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF2419:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF3288:
+	.string	"OSD_RC_EXPO"
+.LASF3541:
+	.string	"coloff"
+.LASF2811:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF1819:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2343:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF1391:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF1383:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF1149:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF3355:
+	.string	"OWNER_INVERTER"
+.LASF2607:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2721:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1538:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF2529:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF3331:
+	.string	"OSD_ESC_TEMPERATURE"
+.LASF2264:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF992:
+	.string	"UNIT_TESTED "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2501:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1181:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF3456:
+	.string	"currentCtx"
+.LASF1227:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF2930:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1341:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF3268:
+	.string	"OSD_MAP_TAKEOFF"
+.LASF2586:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2595:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1357:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF3279:
+	.string	"OSD_POWER_SUPPLY_IMPEDANCE"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1466:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF1517:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF3059:
+	.string	"drawScreen"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF3535:
+	.string	"cmsTraverseGlobalExit"
+.LASF2206:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF3545:
+	.string	"maxSize"
+.LASF2751:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2062:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2733:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2570:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1499:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF760:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF1163:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF2963:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MAX 1920"
+.LASF1624:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF1193:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF3354:
+	.string	"OWNER_MPU"
+.LASF3027:
+	.string	"__uint32_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF3281:
+	.string	"OSD_POS_XY_PIDS"
+.LASF1896:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF2838:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF3546:
+	.string	"value"
+.LASF1038:
+	.string	"FC_VERSION_MINOR 6"
+.LASF1180:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1010:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1279:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1494:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF737:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF3153:
+	.string	"ADC_RSSI"
+.LASF3392:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2680:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2197:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1445:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1012:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF3439:
+	.string	"cmsCurrentDevice"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF3494:
+	.string	"extKey"
+.LASF1451:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF2518:
+	.string	"__f128(x) x ##f128"
+.LASF2416:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF3256:
+	.string	"OSD_MAIN_BATT_CELL_VOLTAGE"
+.LASF2433:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1812:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF2826:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2193:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF3214:
+	.string	"settingLookupTableConfig_s"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1700:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF2330:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF2312:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2221:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF2756:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1032:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1878:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2626:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF3183:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1717:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1314:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF3284:
+	.string	"OSD_VEL_Z_PIDS"
+.LASF1207:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1306:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF2214:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF3335:
+	.string	"OWNER_PWMINPUT"
+.LASF3141:
+	.string	"CMS_KEY_DOWN"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF2964:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_START 1350"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1051:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF3475:
+	.string	"displayWrite"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2521:
+	.string	"__HAVE_FLOAT16 0"
+.LASF3510:
+	.string	"_right11"
+.LASF3508:
+	.string	"_right13"
+.LASF3514:
+	.string	"_right15"
+.LASF3512:
+	.string	"_right17"
+.LASF1995:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF3444:
+	.string	"maxMenuItems"
+.LASF3150:
+	.string	"cmsx_menuSaveExit"
+.LASF1619:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF1109:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF2123:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF2261:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF2007:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF3122:
+	.string	"CMSMenuOnExitPtr"
+.LASF3159:
+	.string	"THROTTLE"
+.LASF3175:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2095:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF3544:
+	.string	"buff"
+.LASF2236:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF3250:
+	.string	"OSD_VARIO_NUM"
+.LASF3491:
+	.string	"cmsHandleKeyWithRepeat"
+.LASF2272:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF1506:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1727:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF3337:
+	.string	"OWNER_MOTOR"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1751:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF2113:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF3413:
+	.string	"BOXHOMERESET"
+.LASF2948:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF1610:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF3516:
+	.string	"_right21"
+.LASF3522:
+	.string	"_right23"
+.LASF3520:
+	.string	"_right25"
+.LASF2580:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1680:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF1585:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF1263:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF3066:
+	.string	"resync"
+.LASF1275:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF1597:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF778:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF2422:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF2994:
+	.string	"CMS_MAX_DEVICE 4"
+.LASF2714:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3382:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1134:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF700:
+	.string	"__size_t__ "
+.LASF3092:
+	.string	"OME_OSD_Exit"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2161:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF2127:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF2509:
+	.string	"stdout stdout"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF750:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1325:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF2739:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2819:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2173:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF1223:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1927:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF1572:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2029:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1976:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF1397:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF3548:
+	.string	"_left0"
+.LASF1860:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF1908:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF3047:
+	.string	"textAttributes_t"
+.LASF2709:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2292:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF3251:
+	.string	"OSD_AIR_SPEED"
+.LASF2562:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1153:
+	.string	"_VA_LIST "
+.LASF1416:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF2578:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF3539:
+	.string	"lastPolledUs"
+.LASF1514:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF2455:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF3523:
+	.string	"cmsYieldDisplay"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2428:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF2222:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF2196:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF2897:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF3527:
+	.string	"exitType"
+.LASF748:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF771:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF3540:
+	.string	"room"
+.LASF1933:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF3148:
+	.string	"cmsInMenu"
+.LASF1629:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF2033:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1440:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF3205:
+	.string	"VAR_FLOAT"
+.LASF2250:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF3254:
+	.string	"OSD_MESSAGES"
+.LASF2430:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1381:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2943:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_CONNECTION 0x04"
+.LASF1885:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1044:
+	.string	"MW_VERSION 231"
+.LASF3571:
+	.string	"cmsDisplayPortSelectCurrent"
+.LASF1774:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF1739:
+	.string	"SETTING_DEADBAND 153"
+.LASF2089:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF2160:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF1009:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF3196:
+	.string	"armingFlags"
+.LASF2654:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1568:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF3260:
+	.string	"OSD_WH_DRAWN"
+.LASF788:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF3304:
+	.string	"OSD_FW_POS_PID_OUTPUTS"
+.LASF1838:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF2392:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF784:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF3234:
+	.string	"OSD_VTX_CHANNEL"
+.LASF2533:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2666:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1268:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1797:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF1588:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF1989:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF786:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1529:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF489:
+	.string	"__flexarr []"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2426:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF1789:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF2539:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF3324:
+	.string	"OSD_GFORCE"
+.LASF2561:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3433:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF2404:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF1455:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3351:
+	.string	"OWNER_BEEPER"
+.LASF1892:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2862:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1293:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1647:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1042:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF1584:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2746:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF1097:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF2697:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1582:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF2722:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1058:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF3291:
+	.string	"OSD_PITCH_RATE"
+.LASF2458:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF1525:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF2275:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1891:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF2302:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF3533:
+	.string	"from"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1480:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF2091:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF2139:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF1095:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2119:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2046:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF1714:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF3452:
+	.string	"menuStackIdx"
+.LASF1367:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2466:
+	.string	"OSD_Y(x) (((x) >> 5) & 0x001F)"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1253:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF2968:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1985:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF3115:
+	.string	"text"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF2767:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2719:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF3312:
+	.string	"OSD_TEMP_SENSOR_0_TEMPERATURE"
+.LASF2852:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF2465:
+	.string	"OSD_X(x) ((x) & 0x001F)"
+.LASF3238:
+	.string	"OSD_GPS_SATS"
+.LASF1449:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF2280:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF1322:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF1607:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2104:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF2212:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF958:
+	.string	"USE_ADC"
+.LASF1713:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF1430:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF2965:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_END 1650"
+.LASF2377:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2802:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2650:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2103:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF2176:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF2673:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1842:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF2336:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1960:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2105:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF1294:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF2695:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2735:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1718:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF1633:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF1526:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF1645:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF3006:
+	.string	"NORMAL_SCREEN_MIN_COLS 18"
+.LASF2882:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2925:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2549:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1737:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF3252:
+	.string	"OSD_ONTIME_FLYTIME"
+.LASF1798:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF2693:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2361:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF2977:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1155:
+	.string	"_VA_LIST_T_H "
+.LASF2692:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF3273:
+	.string	"OSD_REMAINING_DISTANCE_BEFORE_RTH"
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2394:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2296:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF2421:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF1464:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF1635:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF2152:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2445:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF3193:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF2073:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF2171:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF2164:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2920:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2870:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2085:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF1708:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2401:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF738:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1079:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1735:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF2755:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3024:
+	.string	"short int"
+.LASF2744:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF733:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1689:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF736:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF358:
+	.string	"__k8 1"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2059:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF2940:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_CAMERA_CONTROL 0x01"
+.LASF3091:
+	.string	"OME_Back"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF2731:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1295:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF1452:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF1189:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2496:
+	.string	"EOF (-1)"
+.LASF2700:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1169:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF3100:
+	.string	"OME_INT16"
+.LASF3369:
+	.string	"OWNER_IRLOCK"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1591:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF3395:
+	.string	"BOXNAVALTHOLD"
+.LASF2364:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF3104:
+	.string	"OME_TAB"
+.LASF2454:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1756:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF1747:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF1693:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF1158:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF3078:
+	.string	"rows"
+.LASF1535:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF1113:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2258:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF3301:
+	.string	"OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1061:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF2807:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2044:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF1380:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF2947:
+	.string	"MAX_WAITING_RESPONSES 2"
+.LASF1191:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2055:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF1127:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1007:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1021:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1412:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF2035:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF2070:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF3001:
+	.string	"IS_DYNAMIC(p) ((p)->flags & DYNAMIC)"
+.LASF2644:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1559:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF476:
+	.string	"__P(args) args"
+.LASF3379:
+	.string	"RESOURCE_EXTI"
+.LASF2803:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2535:
+	.string	"__f64(x) x ##f64"
+.LASF1199:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF3283:
+	.string	"OSD_VEL_XY_PIDS"
+.LASF2220:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF2475:
+	.string	"_STDIO_H 1"
+.LASF808:
+	.string	"USE_NAV "
+.LASF3487:
+	.string	"currentTimeMs"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1270:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF3349:
+	.string	"OWNER_FLASH"
+.LASF1939:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1001:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1804:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF3479:
+	.string	"displayClearScreen"
+.LASF1983:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF2248:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF2634:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF769:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF3307:
+	.string	"OSD_MC_VEL_Z_PID_OUTPUTS"
+.LASF1902:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF1530:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF1826:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1636:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF2142:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF2951:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2014:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1552:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF3139:
+	.string	"CMS_KEY_NONE"
+.LASF2871:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2108:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF1190:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF3198:
+	.string	"setting_min_t"
+.LASF3295:
+	.string	"OSD_MANUAL_RC_YAW_EXPO"
+.LASF1883:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF1479:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF1781:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF1802:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF2326:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF3188:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF2334:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF2537:
+	.string	"__f64x(x) x ##f64x"
+.LASF2981:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF2575:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1137:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1371:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF3226:
+	.string	"OSD_CROSSHAIRS"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF2385:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF1674:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF1034:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF3408:
+	.string	"BOXTELEMETRY"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF2791:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2876:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1065:
+	.string	"READONLY (1 << 4)"
+.LASF3403:
+	.string	"BOXBEEPERON"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1160:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF3065:
+	.string	"heartbeat"
+.LASF2473:
+	.string	"OSD_HOMING_LIM_V2 10"
+.LASF3525:
+	.string	"duration"
+.LASF2992:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF1853:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF1997:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1344:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF3028:
+	.string	"long int"
+.LASF1862:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF3286:
+	.string	"OSD_BOARD_ALIGN_ROLL"
+.LASF2527:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF761:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF1827:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1721:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF1074:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF739:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2358:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF3370:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF3026:
+	.string	"__int32_t"
+.LASF2922:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2299:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF1567:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF2624:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF2340:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1112:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2253:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF3400:
+	.string	"BOXNAVRTH"
+.LASF3460:
+	.string	"tfp_sprintf"
+.LASF1376:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF1226:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1059:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF3412:
+	.string	"BOXAIRMODE"
+.LASF2011:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF2050:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1669:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1280:
+	.string	"SETTING_LOOPTIME 0"
+.LASF2520:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3142:
+	.string	"CMS_KEY_LEFT"
+.LASF2087:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF2365:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF2777:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF3289:
+	.string	"OSD_RC_YAW_EXPO"
+.LASF1053:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2397:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF1834:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF735:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1573:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF3285:
+	.string	"OSD_HEADING_P"
+.LASF3538:
+	.string	"drawPolled"
+.LASF2096:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF1663:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF3262:
+	.string	"OSD_BATTERY_REMAINING_PERCENT"
+.LASF2286:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF1685:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF1375:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF1213:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1463:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF1431:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF2905:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2499:
+	.string	"SEEK_END 2"
+.LASF2016:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1516:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF2375:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1456:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1486:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF2242:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF2502:
+	.string	"L_tmpnam 20"
+.LASF3438:
+	.string	"cmsDeviceCount"
+.LASF765:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF2112:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF3119:
+	.string	"CMS_DATA_TYPE_ANGULAR_RATE"
+.LASF1569:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1611:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF2054:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF1551:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF2066:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1823:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF2599:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1712:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2268:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF395:
+	.string	"true 1"
+.LASF3470:
+	.string	"settingGetMin"
+.LASF3406:
+	.string	"BOXNAVLAUNCH"
+.LASF2706:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2687:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1577:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF2026:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1871:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF3461:
+	.string	"ftoa"
+.LASF2597:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2523:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2203:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF1476:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF2022:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF2043:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2708:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF3574:
+	.string	"SETTING_TYPE"
+.LASF1972:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF1231:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF2110:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF3506:
+	.string	"_right7"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF3386:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2111:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF2037:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1342:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1326:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF3569:
+	.string	"cmsDisplayPortSelect"
+.LASF2620:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF1671:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF2835:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF2223:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF2436:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1547:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF2505:
+	.string	"L_ctermid 9"
+.LASF2318:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF1116:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1996:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3330:
+	.string	"OSD_ESC_RPM"
+.LASF1840:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF1088:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF2363:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF1839:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3083:
+	.string	"cleared"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2506:
+	.string	"FOPEN_MAX"
+.LASF2201:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2683:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2793:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1818:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1081:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2959:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1218:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF2741:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF2088:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF2658:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3557:
+	.string	"floatString"
+.LASF3332:
+	.string	"OSD_ITEM_COUNT"
+.LASF1259:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1646:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF2967:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2975:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1256:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1894:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2126:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF2588:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2074:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF1496:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF2474:
+	.string	"OSD_HOMING_LIM_V3 15"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF3346:
+	.string	"OWNER_SPI"
+.LASF3173:
+	.string	"WAS_EVER_ARMED"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1090:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF699:
+	.string	"__need_NULL "
+.LASF3436:
+	.string	"pCurrentDisplay"
+.LASF1413:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF3137:
+	.string	"names"
+.LASF2480:
+	.string	"____FILE_defined 1"
+.LASF1269:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1185:
+	.string	"PG_CF_START 1"
+.LASF3473:
+	.string	"fcReboot"
+.LASF3481:
+	.string	"cmsHandler"
+.LASF3462:
+	.string	"itoa"
+.LASF2320:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF2788:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2704:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF3177:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2972:
+	.string	"MIDRC_MIN 1200"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2388:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF1195:
+	.string	"PG_PID_PROFILE 14"
+.LASF1206:
+	.string	"PG_GPS_CONFIG 30"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF3195:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1676:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF2138:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2525:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2516:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1329:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF3070:
+	.string	"writeFontCharacter"
+.LASF1156:
+	.string	"__va_list__ "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2795:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2106:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF3313:
+	.string	"OSD_TEMP_SENSOR_1_TEMPERATURE"
+.LASF1255:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF2794:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF3225:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1238:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1114:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF3372:
+	.string	"RESOURCE_INPUT"
+.LASF767:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1593:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2418:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1287:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF1281:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF1620:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF1809:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2642:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2092:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF1668:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF3391:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF1006:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1867:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1870:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2259:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF2252:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF1358:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF2954:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF2770:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2822:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2918:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1485:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2284:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1334:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1962:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1556:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF1889:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF2906:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2649:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1336:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF1788:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF2817:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2072:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF3045:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF1654:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF3157:
+	.string	"ROLL"
+.LASF1724:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF2406:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF1398:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF1991:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2437:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2456:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF1617:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF3126:
+	.string	"entries"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1748:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF1388:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF2356:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF1898:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF2821:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2146:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF852:
+	.string	"USE_LOG "
+.LASF2584:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF3020:
+	.string	"signed char"
+.LASF394:
+	.string	"bool _Bool"
+.LASF3008:
+	.string	"CMS_DRAW_BUFFER_LEN 12"
+.LASF2233:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF1945:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF1167:
+	.string	"EXPAND_I(x) x"
+.LASF3553:
+	.string	"cmsPadToSize"
+.LASF3044:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF2124:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF3492:
+	.string	"pDisplay"
+.LASF1019:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2051:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1448:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF3034:
+	.string	"uint8_t"
+.LASF3359:
+	.string	"OWNER_TX"
+.LASF3266:
+	.string	"OSD_ATTITUDE_ROLL"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1696:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF1711:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2100:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF2452:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF3244:
+	.string	"OSD_GPS_LON"
+.LASF1695:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF3239:
+	.string	"OSD_ALTITUDE"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2232:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF1410:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF1108:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF374:
+	.string	"__unix 1"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF3580:
+	.string	"cmsInit"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF3455:
+	.string	"pageMaxRow"
+.LASF1401:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF999:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF3488:
+	.string	"holdCount"
+.LASF2904:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1697:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF2962:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MIN 1080"
+.LASF1808:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF3469:
+	.string	"settingGetMax"
+.LASF2063:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1327:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF3058:
+	.string	"clearScreen"
+.LASF3079:
+	.string	"cols"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1121:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF3013:
+	.string	"IS_MID(X) (rxGetChannelValue(X) > 1250 && rxGetChannelValue(X) < 1750)"
+.LASF2313:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3536:
+	.string	"cmsMenuCountPage"
+.LASF1188:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF2632:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1599:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF2536:
+	.string	"__f32x(x) x ##f32x"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF3029:
+	.string	"__uint64_t"
+.LASF1056:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2590:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1537:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1324:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF2896:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2239:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF1473:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF1441:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF1777:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF3031:
+	.string	"int8_t"
+.LASF3269:
+	.string	"OSD_RADAR"
+.LASF1304:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2729:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2175:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF1644:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF989:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2809:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2923:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2053:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF1470:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1071:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF2393:
+	.string	"SETTING_VTX_BAND 371"
+.LASF1305:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF2715:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1733:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF1795:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1369:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF2609:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2725:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF3404:
+	.string	"BOXLEDLOW"
+.LASF3445:
+	.string	"linesPerMenuItem"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1168:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2659:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2374:
+	.string	"SETTING_STATS_MAX 0"
+.LASF2583:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1421:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF1626:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF2488:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF3035:
+	.string	"uint16_t"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1331:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF3294:
+	.string	"OSD_MANUAL_RC_EXPO"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1942:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF3125:
+	.string	"onGlobalExit"
+.LASF1427:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF1039:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF1075:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF1005:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF2031:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1658:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1762:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1890:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1174:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2048:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF3127:
+	.string	"CMS_Menu"
+.LASF3178:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1303:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF1595:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF1986:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF2211:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF3108:
+	.string	"OME_MAX"
+.LASF2757:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2547:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF3271:
+	.string	"OSD_WIND_SPEED_VERTICAL"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF2218:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF1119:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2785:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1128:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1321:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF1031:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF3228:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1433:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF1364:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF1360:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF2635:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2651:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1036:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2290:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1750:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF1035:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF1993:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF2245:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF3282:
+	.string	"OSD_POS_Z_PIDS"
+.LASF996:
+	.string	"EXTENDED_FASTRAM "
+.LASF806:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2479:
+	.string	"_____fpos64_t_defined 1"
+.LASF1784:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2879:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF3466:
+	.string	"displayTxBytesFree"
+.LASF2409:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF1642:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF744:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1816:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF1912:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF3067:
+	.string	"txBytesFree"
+.LASF2282:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF2970:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1575:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF2581:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2120:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1846:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1247:
+	.string	"PG_INAV_END 1023"
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF2469:
+	.string	"OSD_HOMING_LIM_H1 6"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2183:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF1951:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1330:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF1152:
+	.string	"_VA_LIST_ "
+.LASF1824:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF2605:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2711:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1844:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF3120:
+	.string	"CMSDataType_e"
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1405:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF3123:
+	.string	"onEnter"
+.LASF2716:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2511:
+	.string	"__attr_dealloc_fclose"
+.LASF2476:
+	.string	"__need___va_list "
+.LASF702:
+	.string	"_SIZE_T "
+.LASF1500:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF3072:
+	.string	"beginTransaction"
+.LASF1596:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF1025:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2875:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF3551:
+	.string	"cmsDrawMenuItemValue"
+.LASF1768:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF3564:
+	.string	"newpage"
+.LASF3212:
+	.string	"indexes"
+.LASF1709:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF1520:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF2519:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1959:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF2647:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2916:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1110:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1282:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF2431:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2228:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF2542:
+	.string	"_BITS_STDIO_H 1"
+.LASF3118:
+	.string	"OSD_Entry"
+.LASF1786:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF1546:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF1244:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1264:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF3265:
+	.string	"OSD_ATTITUDE_PITCH"
+.LASF1515:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2730:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1565:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1028:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF3189:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF3113:
+	.string	"menufunc"
+.LASF1187:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF2434:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF1998:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF1583:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF741:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1142:
+	.string	"__TFP_PRINTF__ "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2018:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1969:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1684:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF2235:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF2449:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF1875:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF1265:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF3550:
+	.string	"label_func"
+.LASF2621:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1251:
+	.string	"PG_ID_INVALID 0"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2894:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2630:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2868:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1132:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF3381:
+	.string	"RESOURCE_I2C_SDA"
+.LASF1159:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF3420:
+	.string	"BOXAUTOTUNE"
+.LASF1920:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF2262:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF2467:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1352:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF1100:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1489:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF3003:
+	.string	"SETTING_INVALID_VALUE_NAME \"INVALID\""
+.LASF3237:
+	.string	"OSD_GPS_SPEED"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF3030:
+	.string	"char"
+.LASF2134:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF3197:
+	.string	"setting_offset_t"
+.LASF1205:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2790:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3340:
+	.string	"OWNER_ADC"
+.LASF2483:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1338:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF3472:
+	.string	"displayHeartbeat"
+.LASF1041:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2442:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF1603:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF3232:
+	.string	"OSD_CRAFT_NAME"
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF2391:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF1040:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2786:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1904:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF3094:
+	.string	"OME_Funcall"
+.LASF1320:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1286:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF3561:
+	.string	"instance"
+.LASF3082:
+	.string	"useFullscreen"
+.LASF3450:
+	.string	"cmsCtx_t"
+.LASF1423:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF3397:
+	.string	"BOXHEADFREE"
+.LASF2192:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2006:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1807:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF3089:
+	.string	"OME_Label"
+.LASF2938:
+	.string	"RCDEVICE_PROTOCOL_MAX_DATA_SIZE 20"
+.LASF2322:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1609:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF1594:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF1311:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1258:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2681:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1681:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF1493:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1083:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF1775:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1987:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF3383:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF785:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1018:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF3363:
+	.string	"OWNER_COMPASS"
+.LASF2860:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF1013:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1003:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF2420:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1964:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1679:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF2384:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF2553:
+	.string	"IOCFG_IPD 0"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1978:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF2641:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF3149:
+	.string	"menuMain"
+.LASF3158:
+	.string	"PITCH"
+.LASF1508:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF981:
+	.string	"NOINLINE "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF3530:
+	.string	"pNextDisplay"
+.LASF3206:
+	.string	"VAR_STRING"
+.LASF2675:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2895:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1549:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF1016:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1643:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1772:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF2990:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF3314:
+	.string	"OSD_TEMP_SENSOR_2_TEMPERATURE"
+.LASF2378:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF726:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF2592:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2921:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2997:
+	.string	"CLR_PRINTVALUE(p,row) { entry_flags[row] &= ~PRINT_VALUE; }"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF2804:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF2045:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1301:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF3182:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2677:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF2230:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF2359:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF3334:
+	.string	"OWNER_PWMIO"
+.LASF742:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF2450:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF2338:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF2345:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1046:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF1434:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF2157:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF2701:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1992:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF2472:
+	.string	"OSD_HOMING_LIM_V1 5"
+.LASF466:
+	.string	"__PMT"
+.LASF3184:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF2207:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2808:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF3427:
+	.string	"BOXNAVCRUISE"
+.LASF1164:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1673:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF2038:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF3055:
+	.string	"data"
+.LASF1763:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF3389:
+	.string	"RESOURCE_ADC_CH4"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3534:
+	.string	"cursorAbs"
+.LASF3468:
+	.string	"settingGetValuePointer"
+.LASF3357:
+	.string	"OWNER_LED"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF3098:
+	.string	"OME_UINT8"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1296:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1299:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF1510:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF2582:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1429:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF2676:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3377:
+	.string	"RESOURCE_UART_RX"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1098:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF3361:
+	.string	"OWNER_VTX"
+.LASF2832:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2295:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF1288:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3180:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF2009:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF2255:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF994:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1715:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1387:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1731:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF2400:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF1707:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF1911:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF2646:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1734:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1782:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF1759:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF3566:
+	.string	"cmsUpdateMaxRow"
+.LASF1941:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF998:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF1683:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF1274:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1948:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF2867:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2347:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF1792:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1519:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF1641:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF1067:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF1216:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF2748:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2130:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF2740:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF752:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF2883:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1166:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1115:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF3277:
+	.string	"OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE"
+.LASF1590:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF1829:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF1755:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF2663:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF2636:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2477:
+	.string	"_____fpos_t_defined 1"
+.LASF1564:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF756:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF2191:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF2039:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF1919:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF2935:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF3429:
+	.string	"BOXUSER1"
+.LASF3430:
+	.string	"BOXUSER2"
+.LASF3152:
+	.string	"ADC_BATTERY"
+.LASF770:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF1730:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1198:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2115:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF1045:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1173:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2190:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF1692:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF2267:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF759:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF2724:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2369:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1136:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1512:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF3160:
+	.string	"AUX1"
+.LASF3161:
+	.string	"AUX2"
+.LASF3162:
+	.string	"AUX3"
+.LASF3163:
+	.string	"AUX4"
+.LASF3164:
+	.string	"AUX5"
+.LASF3165:
+	.string	"AUX6"
+.LASF3166:
+	.string	"AUX7"
+.LASF3167:
+	.string	"AUX8"
+.LASF3168:
+	.string	"AUX9"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2317:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF1618:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF2459:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF3417:
+	.string	"BOXFLAPERON"
+.LASF751:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF1527:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1859:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF2024:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF2958:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1504:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF3156:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF2705:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2942:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_RELEASE 0x03"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF1973:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF1252:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1967:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF2606:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF3107:
+	.string	"OME_MENU"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1417:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF1442:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF2325:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1215:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF2775:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF2617:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1285:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1805:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF1248:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2490:
+	.string	"__off_t_defined "
+.LASF1918:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1513:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF3360:
+	.string	"OWNER_RX_SPI"
+.LASF1887:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1605:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF3110:
+	.string	"CMSEntryFuncPtr"
+.LASF2399:
+	.string	"SETTING_VTX_POWER 373"
+.LASF1630:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF3350:
+	.string	"OWNER_USB"
+.LASF1790:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF1278:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF1957:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF3353:
+	.string	"OWNER_BARO"
+.LASF1923:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF1557:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1393:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF1419:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF1118:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1468:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF717:
+	.string	"__size_t "
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1738:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF1438:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF732:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF3310:
+	.string	"OSD_IMU_TEMPERATURE"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1574:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF1649:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1794:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF3292:
+	.string	"OSD_ROLL_RATE"
+.LASF3328:
+	.string	"OSD_RC_SOURCE"
+.LASF1072:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2097:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF1761:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF3209:
+	.string	"MODE_LOOKUP"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF991:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2010:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF2723:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1924:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF1662:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF2679:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF728:
+	.string	"__BIG_ENDIAN 4321"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2961:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2303:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF2423:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1359:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF1913:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF1757:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF3499:
+	.string	"_left4"
+.LASF3505:
+	.string	"_left6"
+.LASF1297:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF3503:
+	.string	"_left8"
+.LASF2633:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF3033:
+	.string	"int32_t"
+.LASF1055:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1922:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF3558:
+	.string	"cmsElementIsLabel"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF2759:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1084:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF3179:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF1124:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF2165:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF2169:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF2774:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF3322:
+	.string	"OSD_MAP_SCALE"
+.LASF3128:
+	.string	"step"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1803:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF2956:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1131:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2415:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1880:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF3068:
+	.string	"supportedTextAttributes"
+.LASF1203:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2854:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF2528:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2237:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1702:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF1752:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF2229:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2720:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2172:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF774:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2170:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF1726:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2500:
+	.string	"P_tmpdir \"/tmp\""
+.LASF3230:
+	.string	"OSD_FLYTIME"
+.LASF1260:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2408:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2167:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2457:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF1243:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1447:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF1347:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1014:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2117:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF2297:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF3018:
+	.string	"unsigned int"
+.LASF2869:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2025:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1787:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF3191:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2629:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2859:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF2851:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2555:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2271:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF1194:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF3565:
+	.string	"cmsCursorAbsolute"
+.LASF1971:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF2372:
+	.string	"SETTING_STATS 364"
+.LASF1915:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1366:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3664:
+	.string	"rx_pwm.h"
+.LASF3678:
+	.string	"floatn-common.h"
+.LASF3598:
+	.string	"/usr/include"
+.LASF3646:
+	.string	"endianness.h"
+.LASF3620:
+	.string	"typeconversion.h"
+.LASF3610:
+	.string	"cms_menu_saveexit.h"
+.LASF3628:
+	.string	"stdint.h"
+.LASF3594:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3582:
+	.string	"src/main/build"
+.LASF3595:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3668:
+	.string	"rcdevice_cam.h"
+.LASF3670:
+	.string	"__fpos_t.h"
+.LASF3604:
+	.string	"time.h"
+.LASF3632:
+	.string	"wordsize.h"
+.LASF3591:
+	.string	"src/main/target/SITL"
+.LASF3622:
+	.string	"fc_core.h"
+.LASF3651:
+	.string	"common_post.h"
+.LASF3655:
+	.string	"version.h"
+.LASF3629:
+	.string	"libc-header-start.h"
+.LASF3603:
+	.string	"stddef.h"
+.LASF3647:
+	.string	"platform.h"
+.LASF3599:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3671:
+	.string	"__mbstate_t.h"
+.LASF3609:
+	.string	"cms_menu_builtin.h"
+.LASF3615:
+	.string	"resource.h"
+.LASF3614:
+	.string	"settings.h"
+.LASF3623:
+	.string	"servos.h"
+.LASF3588:
+	.string	"src/main/flight"
+.LASF3676:
+	.string	"stdio_lim.h"
+.LASF3653:
+	.string	"debug.h"
+.LASF3626:
+	.string	"stdc-predef.h"
+.LASF3645:
+	.string	"endian.h"
+.LASF3630:
+	.string	"features.h"
+.LASF3659:
+	.string	"utils.h"
+.LASF3674:
+	.string	"FILE.h"
+.LASF3589:
+	.string	"src/main/io"
+.LASF3639:
+	.string	"time64.h"
+.LASF3644:
+	.string	"ctype.h"
+.LASF3617:
+	.string	"cms.c"
+.LASF3608:
+	.string	"cms.h"
+.LASF3643:
+	.string	"strings.h"
+.LASF3661:
+	.string	"feature.h"
+.LASF3612:
+	.string	"runtime_config.h"
+.LASF3624:
+	.string	"config.h"
+.LASF3636:
+	.string	"stubs.h"
+.LASF0:
+	.string	"./src/main/cms/cms.c"
+.LASF3618:
+	.string	"string.h"
+.LASF3649:
+	.string	"target.h"
+.LASF3682:
+	.string	"io_def.h"
+.LASF3606:
+	.string	"osd.h"
+.LASF3613:
+	.string	"settings_generated.h"
+.LASF3581:
+	.string	"obj/main/SITL"
+.LASF3657:
+	.string	"maths.h"
+.LASF3662:
+	.string	"parameter_group_ids.h"
+.LASF3640:
+	.string	"wchar.h"
+.LASF3633:
+	.string	"timesize.h"
+.LASF3584:
+	.string	"src/main/common"
+.LASF3621:
+	.string	"rx.h"
+.LASF3597:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3583:
+	.string	"src/main/cms"
+.LASF3665:
+	.string	"stats.h"
+.LASF3667:
+	.string	"logic_condition.h"
+.LASF3607:
+	.string	"cms_types.h"
+.LASF3587:
+	.string	"src/main/fc"
+.LASF3677:
+	.string	"floatn.h"
+.LASF3605:
+	.string	"display.h"
+.LASF3637:
+	.string	"stubs-64.h"
+.LASF3681:
+	.string	"io.h"
+.LASF3654:
+	.string	"parameter_group.h"
+.LASF3672:
+	.string	"__fpos64_t.h"
+.LASF3631:
+	.string	"features-time64.h"
+.LASF3683:
+	.string	"io_def_generated.h"
+.LASF3666:
+	.string	"mixer.h"
+.LASF3641:
+	.string	"locale_t.h"
+.LASF3616:
+	.string	"rc_modes.h"
+.LASF3602:
+	.string	"stdint-uintn.h"
+.LASF3669:
+	.string	"stdio.h"
+.LASF3675:
+	.string	"struct_FILE.h"
+.LASF3611:
+	.string	"adc.h"
+.LASF3635:
+	.string	"long-double.h"
+.LASF3625:
+	.string	"rc_controls.h"
+.LASF3634:
+	.string	"cdefs.h"
+.LASF3658:
+	.string	"stdarg.h"
+.LASF3590:
+	.string	"src/main/rx"
+.LASF3638:
+	.string	"typesizes.h"
+.LASF3585:
+	.string	"src/main/config"
+.LASF3648:
+	.string	"common.h"
+.LASF3650:
+	.string	"sanity_check.h"
+.LASF3619:
+	.string	"printf.h"
+.LASF3592:
+	.string	"src/main/target"
+.LASF3684:
+	.string	"bitarray.h"
+.LASF3586:
+	.string	"src/main/drivers"
+.LASF3660:
+	.string	"system.h"
+.LASF3627:
+	.string	"stdbool.h"
+.LASF3680:
+	.string	"serial.h"
+.LASF3656:
+	.string	"cms_menu_osd.h"
+.LASF3673:
+	.string	"__FILE.h"
+.LASF3652:
+	.string	"build_config.h"
+.LASF3601:
+	.string	"stdint-intn.h"
+.LASF3679:
+	.string	"rcdevice.h"
+.LASF3642:
+	.string	"__locale_t.h"
+.LASF3600:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3593:
+	.string	"src/main"
+.LASF3663:
+	.string	"io_types.h"
+.LASF3596:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375 \036\335"
+	.string	""
+	.string	"\250\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\f"
+	.string	"\016"
+	.string	"\025"
+	.string	""
+	.string	""
+	.string	" "
+	.string	"%"
+	.string	","
+	.string	""
+	.string	"\001"
+	.ascii	"\n\020\006"
+	.text
+	.section	.gnu.lto_.icf.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\033\007e\032"
+	.string	"\266\\lH\340\260:k\372\207\255\316\013a,\233\244\037\007\204\263\346\312\351t\373\204\365\206\316\223\253 \\cV%\326\033\216f\230\207\f3\3140\207\031\324\030\213\311m\370~\327\377\353:\336\367|\325\367U\277\227FOKK\233Hv\013W"
+	.string	"R"
+	.string	"X"
+	.ascii	":+Jn\226\203Fd\313\316OF%\277\243\253\212\215\256DZ\016Z<\317"
+	.ascii	"\013sB\207\004\005\235\346fy8\371\370y\207\236\027.fI\216\342"
+	.ascii	"7<\374~'\22187\030h\304rd\204.&\274&\n\r\213\213O\006\023V\254"
+	.ascii	"\200\017~>[;\017%\037\221O\271\006\317\006\031D\366\035\3001"
+	.ascii	"\3301\330\245\327\257]\267X\263^\375\241Zuj\017\324\250O\227"
+	.ascii	"\026M\233H\227&\3351z\264\212\242C\247\353\252\256\016r\270\027"
+	.ascii	"Nzf\224F\240.g\303\216\324q\277\341:\003\203\303"
+	.string	"d\224^\252\026H\360lD\241\362\307\303\013\307R\233\367~\232\004\315I\331\371\311`\344\343M\275wpD\215\261\2623y\221\217(*A\216\n,\256\0268\370m\217\227\203\025\246(,B4X=8\252\276\b) >T)\361^\323\\\274\267U\366\206`\204\021\243r\303\003u2\205\016\205\310l\333\256]\2336\355Y\037T\302\202\226\335\201\3349\262\346\305\201\006\003\"\271s\377\314N\n_\001\002\003P\02485>\001\354,n\034L\205P#\303I\200O(\203\306\207\227\\{\033\246\017nl\310\2648v6\004w&|<\354\210>\246%\nlx\267\020\033\250\307\353Q\250\321\332\333o\251\213\210\026*f\342\"\327\270U\200\326\250\001*\261\0211IRH\007P\202A\250\210\346\003\021\340@\205\250\032\251 Ii6\326G\244Gq\210;5I\ba\240\2514\304\3668\325\224\246 \227\267\200T6\345"
+	.ascii	"Vf\251\221L\003\275\322\251\020!\236\222a\325V\302t\260\323T"
+	.ascii	"\312\262\324\302\036\220\213&n\206\321\0216 \365\007\363\347"
+	.ascii	"\365\215\317\177 \333\353\351\317\226\007\206\357g\345\237\316"
+	.ascii	"s^\271W\346!<\311/\372\216c\232\b\013\005/\377\360\354\3349\256"
+	.ascii	"\340+\345\020\232\234\201\323\221\033q(\303on[\013\245?\256\307"
+	.ascii	"WxO~\354\325\364\276\311\342\030\207b\363\365\026GW\226\204\025"
+	.ascii	"<k.\2554%\022 GHM\027L\013I\017U\023\331u\2700\203\005\340\334"
+	.ascii	"\025\"=\n\032\312\275.\234\026MBu\322\306q\026\020\300c\373\207"
+	.ascii	"K\320 \224\237\314\270\247H\024\t\264\340\216>\264\362tn\207"
+	.ascii	"\274\316\031\367\266\335\276};\247\257\025c\036\371\340_\343"
+	.ascii	"\346_\201\016\216I\345\224\t\027\334;\305\364x\004K\377e\207"
+	.ascii	"x\306j*\311d4\237f\0248\007\240\342\001<\220Q\027g\310\003\225"
+	.ascii	"\341P\357\f\217\305\031}\235\351\274A\354|\264\030\373\322?\360"
+	.ascii	"\377\234\354\326fv\257?*\030\317\275\323{\302\310.\261\334;\036"
+	.ascii	"B\352vy3\330\322\365\362\315\262\346\244\270\250?U\321HI4\224"
+	.ascii	"*\257\016\013;\320\330\262\306\317l\230\255\316\224\256\344\372"
+	.ascii	"\250\021r\214\376\260u\024Y\342\177\351\335US\033b\351\236"
+	.text
+	.section	.gnu.lto_.ipa_sra.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`O\0045\n"
+	.string	"bI\031\033PU\322\001\0203333\211\344\303\304\177\270\027j^\034}\206\031\240\021)\223\f{\232\ff\333G\264|\245\246\324\023JV\253\253\330#?H\347\331G\347\330\032\235\261)\332\353[\267\345\230\240\362\302\023w\304\344\306\267\236\232\016\243ac\t\211\363\034\374;m\007\240\304\210/\250\001+\354\247K\335\026{6\001v\250\021F+\206\354q\220\002\231*\023=\022\340$5\305\243\316 G$\220\251$e\224\331\372\033\200\bQ\217\250[9h\177\214\340\257\261Y\367"
+	.ascii	">\331pv\200\034\002\001\023:z\247fYJ\031\211^d\362\333+\222\345"
+	.ascii	"\372@$\003\024B\325;mR\233\007\265\021\310K\310\342I\220# \037"
+	.ascii	"\203\266K\344\205\331\317\311\327+\016qB\235\025\275M\t?dR?\231"
+	.ascii	"\340\220\360\245&\004h\n\234\372\231\2738f\220\006\336\213\261"
+	.ascii	"Un\354g\003\223\307\007\302\006/\021\201\205\3745\b\247\237\265"
+	.ascii	"To\354\3705\205=`9\004\316\313\241\331\223q\373\030\303u\007"
+	.ascii	"\354\251\361K\3040L\214\013\r\370E\0258\315O\300J-\213\003\225"
+	.ascii	"\220\300\225\254\242\303zl\310.\257w\333?\347\034\017\225\004"
+	.ascii	"=\0054"
+	.text
+	.section	.gnu.lto_.inline.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`?\025\325D"
+	.string	"\nT\310\021B`\246J:+\2131\221\350KjR.\231\300E\017\360a\315O:\276\025K\031r\344\333\303\370tf\222\025N\021\325\274@\023_\250\t?\343\212|:\371V\234\237\260m\030\022\326J\373I#mo)S\007\001"
+	.string	"\001\f\001\225\263pRS\361S\255\262CSU\021\271\365\\\325\243Tj*\243\"qXD4d\n\313\251\240\224\255\301R\314\013\312\244\256\301\n^\241ZG\031!\253*\2078\340\257\366\330N\375\266'\327G\374c\32436\272\265\006\033\366$\255tQp\001F\345\221\2656Rs\255Y\367\336\363G\366\307\216\252kpx\264a`\377\023\23354s\237e\364Mk\323+p"
+	.string	""
+	.string	"\202_J\016\253\025\0302:x\020\372X\272\004\312\202\276\270\224,\352\030\035w\3575\320\377343\237\241\032\357\336\033\340\304\377\264_J\362\317Emo\337M\274v/\226\360\207\3526<\304\304\016\330\363Z\375\205\3463\327 \276;\005>\034\003\033\003D\231\200\215\001\006\370P\216\362\217j\2740\263.\bQ\275\027f\326E\340\301\2527\006\016\221\243\030\375U\266\007nx\333od\337{o\371?\265\226\332\227\236\200\376\371\251\307\250}\351\021\377\004'\220!\247\216,s"
+	.ascii	"\t\371D\373\273\022\3027y\340=I\0136j\336\313\2426Y#C\207\177"
+	.ascii	"\242'\f\373\023E/\312\304\245\374\211\376D\233\232\255/\310\036"
+	.ascii	"\202\247\251}\303\203Ff\3704}\312\314\034\244\r\\ \321\371\246"
+	.ascii	"\347\356\356\356\356\356\356\356\356\276ok\255\265\326Zk\255"
+	.ascii	"\265\326Z{oM\3234M\3234M\3234M\3234\315{\363|a\177\302\2703\323"
+	.ascii	"\276\265\"\224\005&|\237|[T,=\356\352\360\317\363<\317\363\274"
+	.ascii	"?Q\024E_T\277*>\264\312\243(\212\242(z\217\246)S'\311C\323\247"
+	.ascii	"\370\364\246\351M\3234\275O\321\027\226E\307\t\212\363\206\355"
+	.ascii	"\275\306\n\207\n\016\261\250\264j\351)q\013\246|\257\013,\214"
+	.ascii	"^\030}\276\327\330Z\264\364\274\230w\252H\356\275H\357\263\315"
+	.ascii	"{\357\2155000\320\253\205\207\026\303\001\303\335Q~\350\2512"
+	.ascii	"\234\304'/(y\215\237\324Hf1\001\314\201O\352\023|N\303H-\325"
+	.ascii	"h\204r\3018F*\271\312\253D\352)&z\231\025\362\253t\374\200\317"
+	.ascii	"\\\203\374\255\331\362\244\003\rW\335\331\336\340\344\233\246"
+	.ascii	"y\336<\217m\244\017M\220\275y\254P\364`\rac\323\225]\271\361"
+	.ascii	"\315\233O\235W\245\317\233\203\247G\332\033\367^\253_\030\342"
+	.ascii	"f3\237a\020\307*A4\025\034\233M"
+	.string	"\3055J\263\247\270\334[\0333\205\302Qd\265gp\254\262\212\0259)Q\225\f\211\030\223\342\0278\325\255%a\256\024st\221\025!\272\202\020]&\362\354\317F%S%\203\302\206\207\253\223\271\274\261\242\177Fg\305\315\311\341@\026iF\267%\275|\260\330\017\374\354\037\225GQ\224\217\246\314mm\267\311?O~\232\376\225{)\231\336\026\374\316\341\245\216U\371\276M\r\304\013\0243\b^\247v\347\217\220q\370@\322g\307|\357ua\323\276a|S\254Nk\246\246iMk\336\232\306\032\305H\333W\361\001\017^\251\t}q\2426g\347l\316\360I7\361T\327\220\376\244\\\332\345RQ\302\r\237\230\222\277\375\302\227\222\\\226\326\266\247\354\336\372\223\366Ft\013\310j:\265\335\275W\370\n_J^\"\272\255#u\303S\340\323\332\037\305\340S\237\271\3651\023p{\3366\325\277=9>\345\355\355\261\345"
+	.ascii	"\315\t3\177\376\351\352t\302A\244\324\f\310F\037\321'Ft\025\211"
+	.ascii	"\256\252\257|\003\260Tj)\256uWwa<|B\237\207\346>4\307Dk\3032"
+	.ascii	"\335\032;m\353\210\234v\352\255+\261<)~\276\311\266\022\274\263"
+	.ascii	"\213\242L\233E4\263a\021-\325UV\245\210\246\321\3013TE+k\202"
+	.ascii	"v\277Gh>\0231\232vE/Sm\022X\310mEz\215]F\316.-\005_c%ccGD\302"
+	.ascii	"y\235j\032\255\274\273\032g/\262\306\201\203\263\203\241\357"
+	.ascii	"\261\257\200q\3319B\326Al\206\374\025o\242\214\036[\314\225\037"
+	.ascii	"\231\366\303\2275g\217xVk\270\306\262\032\246\021\202)\250\242"
+	.ascii	"j\251R\310\230\220\214$)\2441r\n\020\220fQ\026\225\026\037\022"
+	.ascii	"\300#=\313\262\3201$4#IA\245~\264\033\030CC\230\325\305\304E"
+	.ascii	"\360 \362\013\365\b\231dQ\326\244\320\210\215OI\215\331\213h"
+	.ascii	"M\356\034\240\227\3654\245\252\371J&\324\223\307\177\304\335"
+	.ascii	"\252`T\273\027}?\r7*vhB\001#\266n:!!x\267\311\357Qu\354\325\365"
+	.ascii	"\214\367\235L\334[\321uz\234\270\007\311\332\301\262\034\363"
+	.ascii	"\343\374iG\353\345\325\360\302w\340\013\330\213\\qC\303T\235"
+	.ascii	"\254\226\b1\314\226\2272\355q\317\203\350I\020\2017\037!\227"
+	.ascii	"\202\016\233\23789%t\264\343\rL!R\332\313\310$\255\371)\241\202"
+	.ascii	"q\227\277\331\327\032\327\344\2443\315l9\352Zg\257\022\200p\273"
+	.ascii	"O\341\366\331W\340+\341\231?\303\277\262\356\212\001\316:\315"
+	.ascii	"Ir\234\260Hn\223(\334\353?W\374\026>k\377\007y\200\307\246t\003"
+	.ascii	"IjTp\236w\324\354t'\257\374\261\2255\351\325\364\234[s\351o\351"
+	.ascii	"\324\217\330^Mi\251\340!S\336\037\325\313\233+\215<|\333\331"
+	.ascii	"\264w)z\370?&\032\315hk\225\177\253\211\020\305"
+	.string	"+\033\335\003S?\357\235W\267o\323\233&\322g\334\006\355\324\034Y\275\306K*!\261\345\363\016|j\242\273s\312\253\361\fW\201I\376(;\222\261S\r^\316\254a\246\335\337\013\243A!\205\fY\200\024\223\033\261\236\023\336\326\272s\333\313\275_\315\310\322r\315v\353\306\221/\240\f\361\217\302C\250\376a\215\220\215\267\320Y\315\352\211\251$\334\007\306\240\200\215j\327\310\375\342\305|\220\300\252\266Ux\204A7\200\234\330\353\276\322j\217I\202-{~[8E3[\177\004\215\225\262\231\270\366!\277\035\236\321\342\020\205\373`\3544\004\332[\206L\230\024\374\245\204\347T\356w\017\323\311\021\301\037\263\203T\035\246\025M\312\205D)\272\376\332t\r\013\374g\224#\336\023\326\376\204*u\227\272\322!x\027\n\245[\320\255\331\305\310\211\007jF\216\216\366\216\244\b\244t@v\030w&4\267\277\241\264\307\371\323"
+	.ascii	"\206d\034\207v\025X\rL\322-\177*\305\f\241\240Ou\221\004\221"
+	.ascii	"\3101p\n!\276\252a\n\222\"\025(\236M8\276\030\307\363N\327\362"
+	.ascii	"\342/\373C*\2041\005C`\226d\307:\342\2625\304-$B\"{\344\222/"
+	.ascii	"c\357\017\205\323_\235z\260\320\215\367\017:M6\345\271\334\370"
+	.ascii	"\262T\221\"\"j\277\312n\202 \342\376\240(/\253Dx/g\302IU\314"
+	.ascii	"FHq\006\001\035e\341\372QH\030\f\241\364\027\036|\222\f\323:"
+	.ascii	"\210\346\301\304\007\007\252W>\204\004\222_J\033\213\276mz\002"
+	.ascii	"\f\004C\020\340\013\241);\374\"\202\222\311}\0329W[\302\251\031"
+	.ascii	"@%\345\203\203:\\\2067\263\373,\331\205W\260@\365\212\203\r\305"
+	.ascii	"\210\214on\361-\263\017\243\300\322\t\326\253GV\024\213&\221"
+	.ascii	"'WXf?\235\254Y:\216p\256p\371U\327,\021\375\313\243\0075\247"
+	.ascii	"R&$p\300\211j\331)\375\0329v\222\020EHL\366\313\032"
+	.string	"\366\037\343\004\347\220o\"=\026\030\243,\242\301\352\340Y\304\br\265D\257\025\032\321F7\335qh\365\370(r\220#\313\\\016\031\n\004\377\273YV\210@\370\262\202\204\316\\\210\037#\267\343>\003.57\031*AG?6\002.C\370`\206J\2320S\001\205\262\3518M\273R!\356\032\002\254:\2350\"5/\230\020\372\305\200Z\033:\274\032\320\f\207\034\b\372x\276\250\2030\007\0200\354\200\334z\361a\\\263\023\003('\033\361\214nM\033\200Rq\323W(|\035#\316:\374\344b\334*\230K\224\235\3231\034l\225'm\301*\021@\211"
+	.ascii	"\006\211\254=\327\265\262\323&\re\242\352\277O F\034\323\271"
+	.ascii	"\325\026Q\314B\330X\327\261\223al\343\211\232\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\241\020\375\037"
+	.string	"\306!iA\020\221\223\016p\016Y\241\207\001DS<\364\327\357\362"
+	.string	""
+	.string	"`\005`>\024P\265\266\327\023\231U\313.T\270nd\200/\352\ru\370[\3335\033`\333[\341i\3205\027jQ\365\203XI\366N)\005J"
+	.string	"Z"
+	.string	"V"
+	.string	"\317M\201!\276\375\354\332L\347gk\364\034=/\273\306\266\335\307\310\363zv\354{`\331\264\313\376\333\035n\272\246;\203g\366w\330\277|B\320\266d\030\374\333\274K\325.\345\366\326\333l\316F\366\326\256Z\327\226@?\255G)\255m\200Z\0231\311\300\027\r\302\331\336s\b\337t:!\toj\324h\330TU\b\353\020\336\355=\377\272Z\245M3,\224A\255\363\336s\034\216\253\002/\302N9\375\202\366\013\336\315Wov\016H98\234n\363\336{1'\224\314\314\235(3\343\344\200+\016\257g\203"
+	.string	"\016\316\331\001\235\341\225p\273\3072&\302\033:\215\036a\323\370\036\001\370\224>\370@K\374\020\337\325mU\"\333\rk\r\324\223=\233]"
+	.string	"\303.\234\345\rA\\c\017\326\036\274S\236\331\200\246J\334\322\261\fa\t\333\204\337\037\206\205\372\3508\024\366\t[\316\305\260PW\025\211D+$\226\n..\017T&\\\305^\223\227\202\212\005W\027R+\314\247\025\303\247\265%q"
+	.string	"a\364\354\274\2436xp\b_\330D\003[\\\312\202\221\347\310D\001)\001\212EbZ\336\336\314\277\013\013%"
+	.string	"\324,\022\227\325\317\265\360\037B\2630\013\207\2604+\374\377\337\330\203\336\370\004\345y\002\312\201\017\250\241\311\232\022I\n\222d:\301\004\2040(\241\204v\022\240\021A\210\003Q\212\304(\006\225!\206\b\211\214\004\022H \022D\322$\351N\fH\243\274\312\022\304d\210V\3233\004\205w\226\330\024i\342e\354\367\306k\307\033\016\217\214s\331\333IJ\340\355&\234?#e\025\230\253e\223\f\241\301A4\316\247\210\024\266m\3224,\207a\372\216n\252h\021\307\231\f\006\302\304-8\0059]\322\337"
+	.ascii	"\245\200,\333.H>\254\345\326\037\225\363\344\304\332S\215?\004"
+	.ascii	"\240M\256\376w\333\273\300\364\312\033\225\177\357j\363\313w"
+	.ascii	"0\207k\241\bw\234\300\360\300OA)\317d\247_\367F\037\273\304\300"
+	.ascii	"\322\357\f4\206Z\033r]h\344\324Z1\305]\315\251=\004x\201\\r\003"
+	.ascii	"X\234$+\350\251\242t:\305\214\037C\374\326\006\374\352\b(\201"
+	.ascii	"e\247Q(\031yF\203\205\252\277\3424\350\025R&\032:\255S\244\342"
+	.ascii	"\213\0013\271L\321v\266\361'\021\315C@'\301\363\334>MM\325$\266"
+	.ascii	"\027\267(\222*\353\253\262Q\276\273\030\303\254\205\342\265\347"
+	.ascii	"S\211X\3503"
+	.string	"\007L)\350\375\ra'\212\231\247\321\005\221\272\006\247X\020\365 \267\002\245\004\002\214d+X\3620\026\304\256A?\327\204\024\020\274\342O\317e\276\362\277\240\035\0066\024\024\241\0044\331\206\026\246J|\262O\377H:\257\321\n'\016\006\362\301g{\b\003XdO\266\207\210\b\373\235P/\3047\320\375~\370\355\3245&Oe\332\371\324\342n\350\337a\002uAH\200\2264\003\230&\337A\235<\007\245\327P'\355&\346\376\032.\350C\270\346y\032\301\241\021\265\335\216\250\267Lf\307K\177RQ\207\227\027\016\306\325g\235,\240/\3544\246)A\251\226q\322X\002\326\333?;z\305\325\364\2053^\266T\333?\035\370\341\370 \336\266\274\tl\361P\2262t\200\304s\020b2\355\200\026lK\207\357U}\230 (\220\373\234\177h\362\001&\006)\366x\330\223\303\327Cw\027\252\302\026pK\340\214\274\003"
+	.string	"\240\307MW"
+	.string	"\365\364\024\031\224\304\2730C\324\223\320,\033"
+	.ascii	"vo\372\256R\205aT\2557+\321\177\003;\003"
+	.text
+	.section	.gnu.lto_.pureconst.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375 Ve\002"
+	.string	"b\005\022\034\220\325\320\001\377\307\270\313\21433\2733E@\372\347\360\005\222\277Z\231z\246\342\236\0357p\0017\273\330\275\256u\253\221\272\323)\215\321\b=x\256s\233s\031\22539\221\363\030\215\261\270\021\267\341&\334\3571w'\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\317\001\235\n"
+	.ascii	"r\21701`\213\n\035\305\254\013\326\206 um\223 Hz\230!=\025\204"
+	.ascii	"\332Ydb\335J*P!5\332\261C\337\254\031"
+	.string	"5^\322$\311\355\0301\322\210\224)_\256\213\347\252p|\256\352J\366\231\240\376\342-6\345\233\212Ly\206\272\252\322\223e\212\211QJ<@y\326\311)\347t\332\272SS\256\351\354\224wZ\211\246\210/\304[\345\303O\207\033X:\320(\244\221&\247\221@\243\033\351\300\234F\272\202\321\335$r\"\027\272\273gUzc\211\302\024\ny\002\021,\023\221A\017\250r\2523k\177\200 \344><\3268L\337\336\270]\355\031\030\005\002\372\234_R\222\237\323*\367tb\345X;\303\013_\220A\250a-s\306(TPXP\270\006@\002\244X\035=\021\240\031C\314\031Q\246\3757K\226\247\332\306\355\344`\362_\254x3\310-\034\256\212\205\274\325\322XJ;!\246\034\310\b\363\222{\207\027\255g\257\316\334\235\037\204\032E{\021[\002\235\220\022\301g\224\332\214\277\363X\\\030a\235\341\212\016\031*\026z"
+	.ascii	"\033\225\371\333!\310\354eL\003\346H}\213\336t\321.\317\356S"
+	.ascii	"M\310/\004\277\210s/4\374\323\013\344\246\321\025\007\265\213"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.lto.319048d4f81a6607,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cmsDisplayPortRegister.88.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\030\001\265\r"
+	.string	"\266\232`F\360\262&\035\240\202\274A}\005]\242R\223`\027\220\335cIi\233\350\225\375\035\326\222j\274l\363&9\326\032\321B\250\217\236J/ \266&Q\360\260\n\243\267Z\346|Tpl\3570K5y\265Y\262\267\224)\005L"
+	.string	"H"
+	.string	"N"
+	.ascii	"\337I\264\307\321\th\217\266m\202\262r\367\317f\346(t\200\320"
+	.ascii	"\031\332\3756M\361\356P\263\363_\016\225E\020\331\217\035\217"
+	.ascii	"\346\nMv<\033\001<\026\004\340\002H\213"
+	.string	"\277\2362^L\246Hew\235-o\304\035o{\202m\007\366C\004\376\353\024pN\b\021\332$b\177/\2515\366\341\356\256\325e?\347\0279\255\232NM\177\344\301\016\005!\210\355\316\314\212l\217\210c\205\355\225M\262!\344(\311\264\377\3420V\317q\371\200]\327\017\317\356W\342\004\243G\007\006lv\267\201\017;\r\r\376\315\243\271\226\026\355Q\001P\211T\235\267\204\026\374\232\nw|0\301\312\231\013\340\360(\315\r\021A\2525\206\267\217v\2550\003(&\207\330\217q\031\366\361o\314\301=\371\326\243\357\036\355\361z@\005\t\230\234\005N1\235\234X@IaP\022\320\301\204!\305\255DH\215|*q,\247-\303\212\211e;\251\270\255DbT\352\202j\333\200B\2516\322\267W\2275\031\017XL\377N\373\353\022d?\260X\372\235\246*c[\325*0\312\202\t{\371\020\251m\017\257\341\022\022"
+	.string	"3\345\277\307\350\231\320Puh\245\255\340\243I3[\256\016n~.\302\312\246\020\227\013\006\242"
+	.ascii	"1\300\261X.\004*c\354\241\252\234\242K\355\001"
+	.text
+	.section	.gnu.lto_cmsDisplayPortSelectCurrent.89.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`]\001-\016"
+	.string	"\306\331^E\360\262&\035 A\202AA\tbN\342I%\234\333\276*\236\370r\207\r\263Q\257\221u\223X\222\326\277\210\276\265\223J\036\217\206\366y5\210,\276\201\305\\F\357\364z\037\006S]\3605J\022j\264\367\2262\245L"
+	.string	"G"
+	.string	"O"
+	.string	"!\017 \0377\346\334e\204\253\234o\272\274w\330#\204\fT\347\341\261\303!DPC\004\216P\247\001\022"
+	.string	"\241\303\001\353Tt\241\202\236\0174\241.\005b-+\025\367\256,\335\006U\220\2229\247\025\325\271\334 \267-\301\366\001\3736\001\332\362\275;\360> \035S}\330\237I7e\037\316\205\261\255\276\254\206\252^U\253\252/\302\300\304\217\217\201\031s\266\264~L\032\021\247\204m\024\033\363Q<\005\212\271\001\237\214\013\306\342Ya\3613\347\227\371\373\210|\f'\362\361\332\013\347\244-\267\330\025\355\274\250\212\307*n\312F$\263\003\200\312gu\022'l\360@]\223\032\235\025\027tE\002\274\236\2151\335"
+	.string	"\332M%\370\327\244fGE\203\354\323\374s\f\177\306\031\234\243G=\372\316\221\217\337\002#^N\001\326H\266\221\226m#-\233\020\341\301(\323J[F2b\022\005\b\245\314\002\211T\312\260o\036\316\205q\210\025\264r\023\257\275\367\006\254\034\252\033\3659\t\227\3056\\\227\2346En\312\030\016\203\013\231s.\360]\374E\005\177\346\321\333I\034"
+	.ascii	"B\204.\366\206'\262KZ\2555\254\361\004\353\305J\264U\226\334"
+	.ascii	"q\223\207\003\260n\0202\206\300\bx\005h\005\204\301\020D\344"
+	.ascii	"\261\304\030N,\357\205i\320\205\234C\263\3421\226\001\327 P\035"
+	.ascii	"HhY\\M\231\001"
+	.text
+	.section	.gnu.lto_cmsDisplayPortSelectNext.90.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\013\001\335\f"
+	.string	"\006XWC\020q\224\0160pd\205\345C\020 \001x\364+.\020\326\030\263#"
+	.string	"D\033sg;\207\242\231\0073\376n\377\317\314\270l\021{\217U\322"
+	.string	"h\006YB\215*\005b"
+	.string	"5\237I\226\274\234\326\223\275\245L)C"
+	.string	"A"
+	.string	"G"
+	.string	"\341\207J\253\261rj\2212g\2709|&\273\264\\@v\271\255{\217\253\236/z\004}\330\370@\017\337\310\340D\304\013\003\222\242\226\"Iq\327\025\005\226T\001l\346\234\326\017T\335\362\266\035\330F`\377C\331\345\267@\t\020#\215\371\256Gx\235\250\240L\345a\207\"]\226\3758we[}\261Z\252:\252zU\255\252~"
+	.string	"\b1Rp\034\3201g*\326c\322\2200\023\266C\266\346\2378\212\220=\002\001 \227\356>\237\354\362\262\006L`\n#\004I\\\0269>\224\335\215+WL0\005\327\335\275i\004Ic*4\350.\030 \203\304\266D7TvY\t\376\235\260\302\244\244;\354\277\036z\206\017\342\r\036\321\177\227\276G\002\3464\035\207\333:\016\267Y\250 \201\263q\236n\323d\334\271@\301\263e\350t<\233\026\316\357\312\230\222\016'\221\275\354]\177P\302!DD}/\223\213\262-\327\233\321\222\342\262l\320_x\2269g\003\337\305C0\370\001\027"
+	.ascii	"C\b\330S\307\203\233\035\201\035&K\371\205\345\2251\004\026\313"
+	.ascii	"\332N`Z\302\\\024\b\201q\211\310c\2111\234X\336\017\323\240\013"
+	.ascii	"9\214\314\240\036\214\030\327\212T\352\320\264j\017"
+	.text
+	.section	.gnu.lto_cmsDisplayPortSelect.91.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\"\002\005\023"
+	.string	"&%\201I\300\322Q:B\r6\257"
+	.string	"3\374\t\330M\216\314\033N\26548d\234\002\2169"
+	.string	"I\333\004?\023\372\207ZS\324\364z\373\215\257+s\213\353\376\033Y\024\034\211\311%\204\250m{\002\2667\333p\021b\237R\322\b\331R\246\024n"
+	.string	"e"
+	.string	"m"
+	.string	"\240\307\253\302\203\342\007\204\007\025\230\304,\373\250S\363\\\315LP\323\234#kG\370\364\373\375~\227\343\035\252\354\247\020\224+\252\314\217\371)\304F;OF\303\0237\007%J\017\n]\210M\203\\\240^\213\363fT\022\370\2127\027\345\201\033\214\016_\262\301\221\252\031\"t\374\347Jc\243\251\236R\346\234\326\232\215\303\rr\3338\333-[\027\004\271 /\316N\335\347GY\r~w\313U\257\252u\325\007\240\322\271}\310\341\254\215q\326\374|L%\320\250\304w\277\375\226n\345\217>\317\250\326\316\312\266\257\342@\261\357\234$\"3N\033\212N\211\247i\3169r\320\017\304\203\"\362v\314F\331\255\234\225\252}\236\367\304\356\223\341\002\346\304\271(\232s\\\331\200\370\227\233\332o\270\321\364\347U-\305\322T\237\256\310\301\261"
+	.ascii	"7\207Z\335\327Im\330\005}M\327\001\b\332\306\370\274\2135\216"
+	.ascii	"\212\226F\016\240!\271\271701s\264\233\363\317`\351\305\216\270"
+	.ascii	"8\217\374KawCF{\330\027z\317I>\tc0\222\276v\3207\322\026\320"
+	.ascii	"\341\314\364\347\377|\302\221\r\217\035S}\366\030\243\233\263"
+	.ascii	"o\243\037\001,\367\211JII\005\223\223\004$\001V\\.*00\027\026"
+	.ascii	"\321.\022X\213\213\345\302\242\322\302r\275`,\022\225_,\254\274"
+	.ascii	"X0///\026j\234_\234\004\246[\217H\376\262\360?\217\300\344\241"
+	.ascii	"G\264\276,\004\301u\312liB\247\315\031\265\003\246vq\210#\227"
+	.ascii	"Kc\333rw!\304\030\332\005\2212B\310M\231\251\357r\3169\303\324"
+	.ascii	"~w\221\231\372\214 % `\0022t\351\001c\371o\214*\241a\307\341"
+	.ascii	"\022\030\345\273!Iq\210\333\264L5\006sw\\\273\330\315j\256\362"
+	.ascii	"\272\270\27634\315\004\036d6\312\325\354\230\221\246\266\202"
+	.ascii	"?\300\214Fx\254\260\367\336^\027u\002\256\007\334rM\347\232\335"
+	.ascii	"Z\256\303\267,\307\026\256\310\220\367"
+	.text
+	.section	.gnu.lto_cmsDisplayPortGetCurrent.92.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\002M/3pM\322\001\2004PG\007\022$\264\225!3-\234\274\332\002\334\032\300\251\2615\273\355\037\r=\301\255\327\377\377\253\013'\341\307\316z\314\240\277\221M\244L)~\030\254z\016\253\236cXH\250\334\2730\207\271\330jP\270\234\203e]\216\212{\375\244\022p\024\302~\310#\364A~\310\344\2637?#\275\245\006hPp2d\312bS\305\216\233\324\013\373\321\352\307v:u\"198\331\235\b\255lI\033\341\260\255\261)\337\343\037\032\303\201\230\341\231\"@\022\")\273\3219\376\"\275\001\\@zS\214\303'\364\017\362\250c\003%\353l\236\026\204\335uf\035\317\255\267m`\273\300vE\b"
+	.ascii	"2\001\0038\003Z\034\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_cmsUpdateMaxRow.106.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`4\003\315\026"
+	.string	"\226\347\215J\300\020)\035p\306\345\300\360\245\344\017D?D\"\236>\220\277QY?[%\327\212@#\330\200d\260R\235\034\333\342s\361\035\336W\337\211J%\213 \b:+\332\366\234u\256\324\347P\310_|\212\256_\310\356\t!\204\310\235Rx"
+	.string	"p"
+	.string	"{"
+	.string	"\265\366L\251\250U\0303\202\363\244\205\037)O\236\027)O\232g\333\270\360\247\232>(j\224v\324Zg\353c\222\362~\232%9.\345\371f\355\200\321\325\017(\363\323"
+	.ascii	"\017\216\316\315\252\033\235\221\344\250\206\226.\240\357\303"
+	.ascii	"S\033\340\f%\205r>\216)E \200\\@\232q\207$\236Z@\037\335\017"
+	.ascii	"\237\240\350\351\007\31495k\265V\323\037\020\347\376\270\355"
+	.ascii	"\035\3335{\031\004\244\017S\236\f\360\203\243G\263\374\342@\211"
+	.ascii	"\027\252*\345a\013e\350\006\355\237TIa\360\366\3300\327\221\356"
+	.ascii	"s\251\315\245.\227\232\\\352q\251w\251\351R_\3445\005#\345\252"
+	.ascii	"\326\nY=*\025\311\264\341H\277}Z\216\230/\364\207n\321t\304l"
+	.string	"\244\230W\337\315\007\205\031Q7j\025*8i\332y\362-\233V\214\235\332\027\361\"\336\215&<$g\2554'>\023.\302\031\024S\236\334\225\025\215H\026<\347\326z\224\307\307Zk%a\003.R\236\013\333\373<\314(\021\207\350\222\205\036\250q\203\016\371\255\334\325%\025i(\226A\210!\2526\305\317\352\273\362K\367\276\235\031\232\345\023\337\021\020\342\207\215Qchb\355\332#\235\244W\342K19\027\227\362\244k\013\024u>\3748\3043\364]\351\217\270\322\316\017\262\004\030\372\337\003\272\227\2265\212\212\211\311\203\005(%\262\327\212\r\247\362\262\303\261\234\266\311v7\333\f\307\242r\233\331t\273\231l\304\271\226\025\335\354%\227\323\315Z\302\372\355i\320\202\252\26736_d}W\226kN\225\373*R\242\324\271\301(*\343g\265\302\004\20448\231\0334\271\343:HrAC\261\240 \220\373\3414\256"
+	.string	" \235\243\003 6e(7\350\022\242\021\266&\021u\355\2716\260\355\220D\303fy\323-J\250A@$\021B\206HDDd\246)f\f\220\002\2319\253\007\021\200Q44\205\256\035C\355\217\223T\233\341.\366 \373\222\325\226\242\206\325\024\216Z\303N\253"
+	.string	"\202\325.\003\223\200\323IQTL\\\n\315\"\032Xp\272 Z{\217^;\032\366h\024r\216\235dG#l\006\260\225\020\230\005\204\2564\240\221\237\005\325\306\255z \315\211\230\314\277\261\217\243J\3119o\276\b_F\035j\277\254\027\256\004j\375\300\364\355j\320\240"
+	.ascii	"\034\255\316\301\201w11\351M\272f \242\344;\t\375\003"
+	.text
+	.section	.gnu.lto_cmsPageSelect.108.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`.\002\345\022"
+	.string	"\006%~H\320\322(\035I"
+	.string	"-\025\016\3621F\266\241\256\3150Z\232\001\222Q\3771Y\274E}\2619\364{\033\036p\006zo\n<\277\246-\267\311\003r>\345)\255DU\002\320\306\310\207\246\337-\240n\006\033\215\020n+eJ\001d"
+	.string	"^"
+	.string	"l"
+	.string	"[\024w&l\377d\303\244Hi\332\nZd\327\341Xw{\222\206v7e\230\360\021\006(\365\264\277\342,d\317u8\200]\037\034C\273\272\224\021\204\217\326\035\345{\f\037\340{\264\314\366q]\211\005\177x5\241\037\273\253\322\237\313\2362\377A7\331xr\236`\203\335u\332x>\334z\333\007l;\260SEw\201\343\343\254\341\225\267=\372\257\3571\325t+\321kI\250\306\323\311\236s\307\303c3\311\326\345\244\222\260_\332\335\265\372\330\232Ny\356?\271\356/\001\323\2500M\022\246G4-\242\351SL\207h\332\004\246\303/\r\306\364\247\351\250\351\222\246\265\224NM\177\200\311m\007\203\336\256\207\036\220,\037g\n2y\233\314\367\030\242\013\214n)j\322\007]\200\216\367n\242/j\212:k\267Y\205\327\260\020\356\356\270\3704j.\204\270\230\0260\312\031\303g\304B\031\240\022"
+	.ascii	"\312\201\370\324^=\006\013\325cw]\374\027\207\321\362q\217\236"
+	.ascii	"q\271\276\307\333\220\242~\232G5\236NI\243\306#\332n\226=\253"
+	.ascii	"\236\3263S\325\327x~\213\255\231U\r\207\026\f\364\313\212\205"
+	.ascii	"%C\313K\202\025T\213\005[\335\304`\256\320\254\225\330\213\245"
+	.ascii	"\202\271V/\025\313&\246ZA1MM\313FuCCc\243:\351\366\245U\037O"
+	.ascii	"\030Q\244\243\263\007&\"T\362Dm\b\021\3626\033\330\321\034\347"
+	.ascii	".\004J}\242\337\330 !&\346\310\206D\242\241\242\364Ah(T\356\034"
+	.ascii	"\337\210\222h\024\022\321\221\223\232TDO;\021\242'\033\337\005"
+	.ascii	") p\202\0313\363#\362\277\030\302x\373\216Fa\235\331\272\r\263"
+	.ascii	"\335~%\222\207\346)\026b\243m\b\227\365\215\261\245S\030\364"
+	.ascii	"\337\277\320\216h\217\314\246Vu\365X&\"\332\215\214\021\t\255"
+	.ascii	"\366\336\n\251 \303\262\226'\366\375\257#\224\257\023:7\312\002"
+	.ascii	"b<\006\341\032#\030\214\347@\227\027-%\003"
+	.text
+	.section	.gnu.lto_cmsFormatFloat.112.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`w\003%\031"
+	.string	"&\256\240G\300VQ:P\n+\316f\304\202\210\334\311\024\306t\366\350>\227C\023\307\205\3525\rS\352\021\331nZ\267\277\305\377o09\346+\b\373\177\325u\363\006\260:\230'\032\351\377\325\331t\364\2015\372\326\b\331\233H\231R\217"
+	.string	"\202"
+	.string	"\211"
+	.ascii	"J\264\023Aa\325\234DNK\346\234\f\254 |\254\371\214|\374^@>\232"
+	.ascii	"fk\271.7\301\243\0346\336\2279'loX\377\351\356\250\264\207\240"
+	.ascii	"\214\337*\315O\200\304\313\r\347\363\020\001\221\213\030\007"
+	.ascii	"\277\027"
+	.string	"\215'/^\245E\214o\206\212\215,,\234M\3457\203\203\307\216\027\024\022%\347]\203p?\032w\300\370\367\355\022\223\023\0018\240\017G\t\310\021\013\227B\367\274\277\234\266\334p0\256\340\2049\247\365\206sq\253n\233\310\266\005{k\001:e\002Q\372$\245\312T)[\347\243kd\377J?\206\242x\213lWT\267\276\364\313\234\310\037\340\273{\025\325*P\035\202j\020TKUG\251\376\242z\243Z?\365\r\024\030B\345\202\2279YL\211\231S\342S\322w\277\375\363\314\302az\331\366\203\b\264\357z\302\251\003d:J\3422\247n\301\243+\030G\310Ku/B\373\322\211\017\230\263\350\312\2229u\f,!|\264.\304Iz]\355\017y$d\2702#XRh\030\203+7\334\333^\234\311[\013\356\033|&[+\367\203b{\372q\342\231\205\255}\220\320\2672\033\367@>V\373\355\362lc"
+	.ascii	"\364f(\024R\0260\353\370\036\371\335o\206j=\0316\237I?\211+\027"
+	.ascii	"\325\303\355\372MIt\365ij}\247\f\263V\016\311\277u\361\2332\314"
+	.ascii	"|\244\377\204|\324U+AB51+]\335PRf\277\366NL\177s\r\320\372X\256"
+	.ascii	"\030:\n\031`\277\007\242\361\023 \356A\304\007\031\017\006\236"
+	.ascii	"\234X\210\016,\337\344@\200\260!\302\215\003\033\031\016\263"
+	.ascii	"\0209&\242ulJ\354\350\300D|\310\331\201\351\310J\300lf\034\033"
+	.ascii	"\301A\006\343\211\305d0\226n~\213\214AiJm\177\302\232\317\244"
+	.ascii	"+G\223\213\022b\353z@Q\001\256\221\337\344\252\325`\344J\250"
+	.ascii	"\352\005\221kdP\350s\3556\351\237\276\332\240\245p\336?'D;\241"
+	.ascii	"\246R\377\346\2343\272\366\273\327\324T\312\237z\217\\\255\213"
+	.ascii	"\246'\3433I\223;\220\213\022\320\253\241KG\244\330\370\036K\250"
+	.ascii	"A,'\215BF\031\231`\"\031\322\264\305\220\002\221\262\262\003"
+	.ascii	"\020`\215\322\314\001`\220\307(E\267w@`\225n\025\264\307\332"
+	.ascii	"z\351\370\244\231.\275\220Qc\026\254$FB\373i\002\330;\r\316\216"
+	.ascii	"z\335\376fMd\036L\255\230{2L\224\324\327\017\370\265Z$h1\274"
+	.ascii	",\233BZyR\216aPSV\033\377\343\035\001\023\b\260\314\343hc\350"
+	.ascii	"\241\027\257]\275\344\241\351+\006of\325\336t\376\373cS\203\200"
+	.ascii	"D\364{\275\017s\243\006!\260\001\037g\262\243\330}\211*E\354"
+	.ascii	"\235N\323"
+	.text
+	.section	.gnu.lto_cmsPadLeftToSize.113.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\352\003\335\031"
+	.string	"\326/\242F\260\230M:\021r\344\026\207\307\025\303\200\023R\222_\211\316\322\333K\004K\036\232\330\246\n\307\257\267\274\233Na!VNU3Y~\320y\322~J\031\036\2614)H\260\310\007F2\033:\250\215m\204\020B\222L)\220"
+	.string	"\207"
+	.string	"\213"
+	.string	"1\322P\362\024cDP\232\320\036\255s"
+	.ascii	"E\306\331\272\207}\360\370\310\204a1\0229=\305\210CP\002\241"
+	.ascii	"\275\342<\373\354\205\216}\366x\332)\306\031E\320\306\223\237"
+	.ascii	"$,1\306\332k\200\271\\.\0076\214\035\316\355\316\343\020\374"
+	.ascii	"X\335\223\247\316\"9 \241\036\207/n\t\266v\f\371\013\207\314"
+	.ascii	"\352@\024+px\212\005\214\216\306\252\312\210\233\234AB>\331\355"
+	.ascii	"p\341\273\311\006\210\\\001\022r\341\004%\304\030\233@B-\334"
+	.ascii	"\226\333\036\265\255\320>I1\263\264\270\236|Qk\032#\253\252\236"
+	.ascii	"\250\215\201\261\222;\223\031\210\0353\222\373\342#\033\3662"
+	.ascii	"\223\353r\326\245\313\266\234eu\3310\263\240\227\375\234\365"
+	.ascii	"\272l\347\354\273l>\353\001\261\253&\026\244b\\\221\323\022\231"
+	.ascii	"xFr\030\311V\262\231\374\326N\362\222\233\352\362\300G\246ej"
+	.ascii	"\024\r\306\023\005\025JK)\240L\b\355=\030\222i\221\032\025\366"
+	.ascii	"\260\b\225lD\251\2121\036\260W\bupE&q\376\301c \215*+\263\273"
+	.ascii	"\016\336s\223=\0374\\\227`\313,\356b\214\261\213q=\346f\360\275"
+	.ascii	"v\032\261\003\300(\223\200\250\324N$v\302\033\265\211\317\336"
+	.ascii	"\367\224\022\024\243;\354\336}\343\341\363\356\246\372\271\262"
+	.ascii	"\035\366?\245\334x\200\317?\311\005\265\344_\222B!\364\316n%"
+	.ascii	"\323l\261\317\376\250\233\016\331\3154\343\330e7"
+	.string	"\325M\206O\346\232PJ^n$\323l\231\245\376\313=\344\347\312\226\271\206\t{+B'\r\344G\230q\342=\215\035I(\251\2517\356`\0206\036nS\342F\247k\003\f\n\024hX\320 \301L\200\r;\031\336\232\031\235\01755\0207\030>\324jrtj3\263\342\204\260\311\251\215\300\301\311\251\271\340\242O\324\0139&\266\373\264\034v\\\001\234Ti\035v\227\330[w\322\317\225mK\370\242\002H>\230\267c\271\376z\235B\367\002a^\207\271o2\004@Y\231\242y\347\253\235<\310\214\252\204\207\235u\277\036\336TW\362{Q\315:Q_H\036\363\013I\331]\017j\333\003\006\237VA\226\234H\253\006U\25010\344\030c\206!\231`\202\314\024\026Z\f\220\002!2\272\r\021\3009D\270\320\260\0336\333\243$\252\022\023Q\315o\0247\236\177R\202\357E\030\262\275\036\300\be\231[\375rb"
+	.ascii	"#\205\353\003\254\317\361\037\224\016H\034\275M!\247\375,\001"
+	.ascii	"w\312sz\350\320\252\025\252\311\366\220i\373r\335\211\310\276"
+	.ascii	"\222wr\344\323DG\210\240\021x\2165W\370#\220\233\265\232\337"
+	.ascii	"\373\210f\265\345FzPk\025E\301\026\222\013\036\035\232\t\223"
+	.ascii	"\2506\264\037\013\r\276\256\032\347\004h\304\374\225\200\005"
+	.ascii	"i\037\233\364\271\313\310\205\325U\232@\346\253\256\023.*"
+	.text
+	.section	.gnu.lto_cmsDrawMenuItemValue.115.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375` \003\265\030"
+	.string	"\366\256\242H\260\230M:\201\262|\344\017\205HA\013\352\341L\3212\310[\210\346A<\026\222K\340a0\203:R\035\267\261\356m\323\b!\234<#\233\230\320\231\220\377\243\275~\335$\265}\236v\371\277\311\033{\334\250\021B\b\2212\245\217"
+	.string	"\211"
+	.string	"\213"
+	.ascii	"3|`\350\001;\223y\343\017\321\270\224D\243j\316\231\340\240-"
+	.ascii	"\21441\226\202T\030\017\322\f\301>\265\0318\260\335\b\317_&\320"
+	.ascii	"\024\033\023\256`J\304\207\300\313\f*\242\002\302x\360A\025\330"
+	.ascii	"\325\276\220\017\261\275Dq\2309\221\2508\231\263\204\331\300"
+	.ascii	"x\320\345h\333\017r\235\315\346}\245\216\"q\310\bw\344\312\234"
+	.ascii	"3\366\372\200\360\340w\001\341\301\315q\333\325\346\277\351\237"
+	.ascii	"\222\324.W\364s\025%\3149\255\271\242\027\367\3366\002\3332{"
+	.ascii	"Y\004.g\272]/\377\226\033\371Y\237z<\221_\374\322"
+	.string	"\017\206\352\357So\250\326O}\230\230()\034\236\314\351\342*\313\234\002\237z\234\351\267\3573y\224\335r\355K|'\207\322\260S\232s\266\236\234\220L(\330\247\177\252\335\311\274\023\215\275\244\331a<\270k\342\363)D\304\302\r\031U\315Y&8H\203\004\246\372]\355M|B\"\326\213\241\025U\007\315\341Ljv\353\340m\233\237\344Mn\321\334Pb\336+\350e\006%\005\021xd\261\241\023\362\314\346\215GE\007\244\256\350\024\274nR\207\302c\003B\237\003\021\036\324-\260C\206\020\252\351\357\376\246o\320M\265\364+\256\037\025\"G\237\263\366jL\245\330\037\373d\350\367jH\237\207\357\023\036\f@\305\212\313\212\013`/\364\003H\257\f\256\313\376\310\243\336\3223\242\202\372[\364`L\371\376I\334\357\376\272)\026\203\373=\316\352\246W\216\321\305(i\017\b\325T,v\t\244\213\303\3767\027\311V5"
+	.string	"Q\0356=8\264\357\246V\2634RG\0049\013I\214\230\255M\017N\006\023\262\034\261\004\271\26377\265\232\3173\262\006\r>8\230Y \023\200G&B\207\206CAg\364L\206\2263\213\215\300\221\345\304f;\264\230\314"
+	.ascii	"\223:6;1\022$\271\023k\225\267\177s\221\\;st[ k\017\312\265g"
+	.ascii	":\214\212\273;n\313\332\036d\372\234k\337t=\302\355\217\277\035"
+	.ascii	"\327\212\263\272\351~{!\037\254\335}\024\234\225\366\234\250"
+	.ascii	"\346\211G1o\234s^\270\222\317\034\335\226\364\230\027; `\002"
+	.ascii	"!S\265\033c\344\377\304\220\343=\210\346`L\213{U\324H\027\331"
+	.ascii	"P\202\33784\364\226o\354\n&\273\214%j\262\241\330d\313\325\303"
+	.ascii	"\257\003*\031&\200\375\204\330^\224\354`\263f_g\322,Y\234\246"
+	.ascii	"\034\236\2327\"\243\023d\317\220!\346\323q\030N\fgE\210F\356"
+	.ascii	"\025|\211d\353\242\033Ydn\210\374\312\300`\334(Y\261mU\353*\036"
+	.ascii	"\232\213\200\215\373o4s\037F\013\257p\376w\237\250\025\223\360"
+	.ascii	"\310"
+	.text
+	.section	.gnu.lto_cmsDrawMenuEntry.116.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\024A\365\354"
+	.string	"Z\223\361UH\020\020\346\255\f\007\177\377\376\243k\317\003\025"
+	.string	"\312\361\357\374\f\311n\240\327\326\244\373\371\250\354\216"
+	.string	"$\214\3266\004\277\036\b\246Iv3"
+	.ascii	"\006\242\033\275U\210\213\266\311\315\256,\255\263P\204\007\263"
+	.ascii	"\250\302\206\023D\366\2262\311n\005\333\004x\005\274G\023\274"
+	.ascii	"0L\360\276Py]\234\340m\301\304\313B\345]\201\362\252PyS\250\274"
+	.ascii	"(P\336\023$x\231\226xM\250\274%P\336%\225WUyI\240\274\006\250"
+	.ascii	"\274#\226x\013PyE\240\274!T^\020*\257\022\312\373\001\345\365"
+	.ascii	"\240\362v0\301\313\201\004\357\006\225WC\t\336\f*/\006\2247I"
+	.ascii	"\345\275\240\362Z@y\215K\274H*o\021\345MU\336Vy\231\004\357y"
+	.ascii	"\353pe\300\302\240Q\323("
+	.string	"\260\255Z\317\025\326B\351\234\031w\235\271\316Y\347\253\037\361\367\373\031\375\200\277\340\217\3507\364\347\375\203~@\177\240\177\356\227\373\335\376>\377\260\373\034\\\232\226\265,o\331\244\034]\270K\202\244\275,\2679\205M\343\323\034W\234%\307\222\271\016\241\351\375\335\031\237>\251\320\264\314\\\306b\255Mz\362\313\n\202\256^8\254Uw\342\374\320\031\237>\0312\226 \274b\t[=t\tCS{3>}j6\355\237\313\313BrY\016\241\311\341+\273I;\344\317e%\022\027\036>\266b+U\304\232\230\331j\b[\251\262\210\271Vf|\272\\5d7\211\247v\223\226\310\237\313RH\\y\312\360\272C\260I\211y%\342\345i\256iO\270O\244C\254\200\303\352\\\317%\210\346u\261\025\210\354&\375\321n\322\0329\341\336\260i\255\020l\316\272\256I/tT\004\307]!\036XMJ\374B#wT\244"
+	.string	"\2665\213\t\252\254\345Y\341\272\2625=\335[\031\237>q-\372\337\003\337\350\203\233\364\364\211K\323\256 \224q=Cz3\023\2044>}\022\303@\356\356i\r`\021-9\274\022\214O\237N`\244\301\233\031\241)\306\247Om~\313(\313,\317\003\343\323\275\nF\366\251h\223\236\252\002q\220E\213\316_\323\036\205=\337&\341"
+	.ascii	"<\242\225\246\231\350\020\022-2?M\373\275\375\241M\302\361'\211"
+	.ascii	"\0263,:N<J\264\314\256\316\232\366\315}\241M\302\201\346A\026"
+	.ascii	"\277E8\304\350\225a\222\345\247\b\307V\323\036oOh\223pp\005\002"
+	.ascii	"A\013\226\334\337\363n\223\236\342\250\032\024\002\326\333_\022"
+	.ascii	"Cu\267\333$\247D\201\236h\301\3059b|\352\024\030\200\024\374"
+	.ascii	"8\311\321m\222\023\240\271\003\240\253\027\2665K\006}\202\346"
+	.ascii	"\024n`|\352\244\326\264\217\333\373\331$';M\273rR\276ZmY`\246"
+	.ascii	"\320\367\267\256l\307\247\233\201\361i\206\335\344~\317\3416"
+	.ascii	"\311i\254\211\317\337\222\357C\305\270\236\375x;\341o]\267\216"
+	.ascii	"O\267\002\276\fNhMw\333:\243\324\226\261\r\215\234\277u]\217"
+	.ascii	"O7\210\361\351\256\223W\033\035\007\214O\235\260\232P\336E\300"
+	.ascii	"F\362x\240\316a\245\332;\303\303\370\324\211\252\211\355T)\200"
+	.ascii	"\303ZuGK\207\361\351\rGM\347\335\257\235N\362lQ\357\260\256e"
+	.ascii	"\b\371YW\266\246Ua|\272l\306\335\335\313\371\234\344n\035\312"
+	.ascii	"F\306\205\304L\243\314S\270\256\353\f\246\203(>E\377\241\370"
+	.ascii	"\264\315<\371\r\264u\013h\351vn\377\254\237\225\333\270\205\333"
+	.ascii	">\373\266|v\317\272\255\236m\333<\213g\357\254\235\255\263l<"
+	.ascii	"v\350X@\201\034O8\234n\330H\240\006\0024\016\230!\243)\306\021"
+	.ascii	"\306\013\027-X\254P\221\002\305\t&\023%\226T\022\006\214(@D\b"
+	.ascii	"\020J\037<t\340\260AC\006\fI\027,\030\221\212)\332\234\334#\365"
+	.ascii	"H\363\002D\205\002\037.\251o\240:5_@j\276th\346\320\244\341\375"
+	.ascii	"\303[\316p\2262^?d\274r\033\027\346\013\307\201\f\330\267O\230"
+	.ascii	"\020bT_\274o?\272\020v\211\221\001\363\345\363\345\273\307\213"
+	.ascii	"\227_x\335\364`\371\266\251bTZ\211G\271\210Qe\361\346\001\363"
+	.ascii	"\305\343EI\214\n\253\b\342L\035\232E\273\304\250\260\364"
+	.string	"\336A\352\361A\005\232\030\346\327N\b1\252\345\242a\304\250\230\274u\022\217\206\021\243\002\013!Fu\305\313\226\305\203\006\023M,K\341w\004\322\3614a\001B\005\020\333r\f^\002\263>\245\\\227\030\231+\177Jq\3458\236\211\210+\034>*\032\267\f\213\306\255B\243\023#\276\261\210m$p6[*p\215\024\030\001\032}?\200/Q\037\317h\262\f=n\212A\350G<'!\206q\307/\006\261\213\026rg\021\247'\307+\340XE\037N\201\202\317O\354\271\373\t6[|\230\311\215M\320\341\022K(\214\277?\204 \264\326,\325X%!\347\006\310\371\210\023\350~\202\315V\034. \215E\230q\b%12k\016B\315\225\324\374C\0324\354A\025\243Zs\206;\2241\207\r\027\313\"\346\032\356\334\022\003\306\031N\210e\371:\0066[a8\t\375\340\325'Q\214Dm\276\234\315\026\030\276\200\302"
+	.string	"#\324u\347\326\027\n\302\020\031\025\316f\353\013[8\301f\313\213\215h\227\030\2315GB\227\366\364\336\240\b3\346-\211K\311EU\214j\215\025\247~\212.pY\311\023\264\366\266\206\314\313\032%1*1E\224P\313\240\213m\315\311\200v\2755pU\241L\353\272\036\356\314\344\242bF\352\261\256\353\362\222+\313\267\310w\213\204\273\307\260\233\243\030Wj\020\215\016\026:R\002$\364\320\037\b\261\372C\207\366\320\347\320\035\200\260\221\021\022\220\277\344\320?\f\253jb\241\033\236\207*^\252\337\250o\005FeA\0053h\032\330\353\033\372&\374mh\023}^\362~0\177\361\212\217c?\344\340\022\337\272Z}\211td\264\272\242\026O\377\327\273HC\344!\177\271\n\204Y\265\324\236Q\377\257\357g\345\206\212\237\313"
+	.string	"#\237I)\376\362\214\232\251\n\356\317\262\033\224\301\006\263\334\357\327\377\243*\331\325\371\365\345v\360f\350\373u\2250\252\226\332\373\371\273\354\350\030\315\243)\f\214\225\224"
+	.ascii	"\263kh\306\262\302\210\222f4\264\016F\355\004\253\222\256\212"
+	.ascii	"\031\232\025)\331\231\274\332$\223\r%\261\236f\350\031e\305A"
+	.ascii	"R].\240O\232)v_\354N_\025?Z\rvjO\242\025w7\306\341\222hJ|\353"
+	.ascii	"\272\342\b\301'(\307\002[ah\266\372\200\tA\031\3610$\305)s\266"
+	.ascii	"{c\274\320\203\240\226\310\004}\031\230x\250\242\205\276\320"
+	.ascii	"\350`\035 \013\275T67\305\317\335`\367\265\247\357\366\"8\030"
+	.ascii	"\303\267\256h\264Av:\275\233\344Jj\341/\277\247\231\224-\265"
+	.ascii	"\227jcs\236\006;06\030\303\203\024\221\372q\207K\232\205\340"
+	.ascii	"[\327\365\313\335d\227\244\027\177\271LV-\265\032\354\274.\334"
+	.ascii	"q>B\352\261\335'\277\212H\335&\200\341\267\344\027R\337\350["
+	.ascii	"\233\342\347\227\215\352\037\004\3059\213=\266b\377W\037\356"
+	.ascii	"\306@\036\363b\377\253\227\225^\250\370\271\273;\205\367@\031"
+	.ascii	"\327u\305\261\254\207\335\222b69&I\206\277L\222)>-\266\205\271"
+	.ascii	"0\235v\303)\023\247\370\271\030\354\272\360\tg\273-\205\244\030"
+	.ascii	"\261\005\332W\236\264\307\366p\207\200\271\246\224\353\177\351"
+	.ascii	"E\371^}\251f\356\3562\236\345<\033\314\316\326\260:\313v4\304"
+	.ascii	"\235\255-\323\311p\3107'M\316\362\034"
+	.string	"\f\204\374\314I[\327\264\3458IZ`go\226\023p\341y\306f\271\215\205=f\313g\306Els\322\322,\253A\302\362:+[>S\\^\256\314\025\316\306\330\0046\203\246F\n\326\2741,\306dv\221\361_*>\275\225\306\3623'm\r[_<\335e1\273\273\350}\n\201\205YW\251\203mrw\021/\327u]\327\027O\273\357f\005\343\304\335M\216\361W\322\214q]\253n,\207\211rK\226\245y\272\257R|\332\275\241lm\212\237{\270_\260\323r\251>\236o\217)\364_\372x\3164\305\207\373C\025\357\325\377\322Gd\005F\305\317\305\020\b\321\371\347\363\231B\367\330.\220\342\273"
+	.ascii	"w\024U\361\243]\356\302^\200\354\323l\022MR\r\177\371t\237TS"
+	.ascii	"|\372\306\320\347e\212\237\313\201\016\217\277\333k\204M\361"
+	.ascii	"\341\206 t\256|\270 \340\204\031\006\256|\270\313F\305=\266\373"
+	.ascii	"~>\237v\333evU^\326Ry"
+	.string	"9K\345e,\346\3722\026\225\227\231*//U^\276Ry\371\212\312\313Vw\373r\325\001}Y\352\201\276\274&\252\274_A\345\375!w}o\310\\\337\027\022\252\274\027l\3367Ry\037\350\202\367\177&x\317\350r\337\373\365\035\372\334\367\315\274;Aut~\342\336\366\344\251s\266\377tT\336\3139a\004\357\343\250\274O\343\254\357\341\250\274w\243\362\276\r_}\317F\345\375\231\312{\2635*\357\323\2409SFfF\345}\231\373}OF\345\375\230\003~\037\246\362\376\353m\377\303\334\316\1770_\216\347\277\227\312\373.\"x\237\325\274\307:\342\367X\230g\364\375\362\352\202\337_9\242\357\2257\364\275\325\363\276\267\362A\337WQ\335\355\373\251\343\371^J\345\375\252\362&Q^\244\312\033\245\362\"@\345\255\242\362\226`\202\027J\004/\t(\357\b$xEPy\251\240\274ST^)*o\024\224\367"
+	.string	"(/\224\025\274OV\360:i\301\333\204\005/\b+x\r\240\202\227I\n\336\017P\360z\240\362.Y\301\253$\005o\007K\274IT^\002\240\274GT\336\001\250\274\034\240\274\002@y\215\240\274\033\244\340\325"
+	.string	"\345\r\200\312[\344\004o\006K\274\030\250\274\027\240\274DT^\013T\336\nP^\nP\336!*x\205\250\274A\226x'Py%@y\001\240\362\002Qy#@y!@y\177\244\340}@\345\365\261\304\353\200\312\333"
+	.string	"\312\313\200\312\333C\345\345\201\362\356@yu\240\340]@\345U`\2117\207\312\373\204\362\342Py\235T\336\033(\257\r\2247\001\225\267\206\312\213\300\022/\r\225\367"
+	.ascii	"\224w\206\312+C\345mByc0\005f\bE\245!\255(\213O\r`\030w\245\246"
+	.ascii	"#\035\203dL\372dwQi\310+f\361)\223FoWj\002.\320,\373\240_&(*"
+	.ascii	"\r\211\245U|\372A\236\333\225\232x\n\f:\343A\377"
+	.string	"Lw^\240\2504$\227QK\361\251\007vmWj\326\345\b\321\244C\323g\264\244\217\246;/*mI\267_\210\346\037\024\317?\370#k'\233c\366\204\332\371\366\220b\304\375\333\360M\026\016\272\3453\017[\321\260\374Y6!Qn\331\314a\237E\341\272p\317\242|\330O\317\262\230\226\"4\3172\031VZ\227f\315\277uE\357\374\254Gp\342\356\013\377\301[xsX\310\360o\212\017\227\361\374r\372g\213\334\202\326A\331\242\326\220]\266H\361\351\345\364\373\364=\372\017-b\206\277\030\2530]\206\032\025\236I\215L\337O\n?\254w\221`\220_\374\345\311\364\32144\3450\272\2218\316\260> \024V\322\273\3101H2a\035\264\222F\021)\023\307\3209H59\3104\244\031\f\212O;h\033ekp\222\364\003\377-\032\232o\364\336l\223\036\252x\301\033\031\374\263\232hNI\340$\271\321\205"
+	.string	"\375.l\350\0337\0048\322\024\303\326\374\2621\200f\203\306A\017\240\321A\2635\0344\267\344\021@?\205<\002hj\001\201\237\302\002Fz\027\211\006\251\306JK\355\006\035\2006\322\367\323\2407\350+\023\315P2\244\232\006\335T\244\003\200\234\203*\322\215\b\r\035C\342\225A\002B\2661rP|\232A\253(\323\320\344\302\240\337\367s)\372\263\364\236\t`\200\212aP\343\202fAh\230\230\013\210 \252\035\"\320c{\276\247\203\201\016\370[\377\315\340\232\031\023\364\225\315\334\265\240\277\302T\320\0264:\370\305\253\202Fq\024\364Q\210\243"
+	.string	"\020\205!Bz\b\252%\352\017\371\006I\361\251\220DMe\037\021\215\267>\"8(\0272\016\272\205L\204\224s\344\ro\202>\n\277\027\337\240\003\322\364\023\005\351\247A\263\202\314%\3723c\002\024\313\0042\306H\320\037\243\b]\242W\022"
+	.string	"\200\016\034=\265\246\036\333\037z\n\230\350x?\3757\200k0\034\350[5s\027H+Q\253\b\032H\243\203h\025J\025\201\336\033:\b\372{t\020\350\265\331\373\361@\377@\214\nD\252))>}"
+	.ascii	"\315\252o(\206\237\276!:}\210\254\363\bY\210\274\223\304\217"
+	.ascii	"\336\227\003\375\275\037\314\241\277K\017\314\261M\337\351\243"
+	.ascii	"\337\246\320G\211.\347\237\245\247\005\206\003\204\016\2740k"
+	.ascii	"\240o\206\\\241\005\0335\300\200\036\227\233\247\213\036\333"
+	.ascii	"\027z\232G\310\342w\3757yq+r\364\2554s\267G\003\376\361\350\036"
+	.ascii	"\215\016.\362\343\341(\257\353\276\243\337\314\3331\330s\177"
+	.ascii	"S\307\002\255\003\205(Ad\036&\305\247\013\3505\262\322\317kq"
+	.ascii	"\327\317\323\323\210\220{\016%\227\3107\017\356\2329\372\315"
+	.ascii	"\277K\241<\026\202}\275\346s\005\372\202N\005\002\351\325\255"
+	.ascii	"\310Q(\207\212\300\247~`V\353\345=\341\240[\363'E\217\355\t="
+	.ascii	"\305\263:\361\272\376\233AzL4\372U\315\334uj\274\273\033\355"
+	.ascii	"\324\350\240 \273\033xq.(\375\326\025m\364\361\004\331\320\200"
+	.ascii	"\007G\003\276\360\255+\036/\201\336E\312!\377\324\350\004\372"
+	.ascii	"~rQ\204I3!\024\237\326h\256c~\231\342\347\233\252\376\240o\217"
+	.ascii	")\024u\375A7\262H\272\206C\342u\237d\030d\335\022\031\b\305\247"
+	.ascii	"\257\353\020}kJxh4\372x\277"
+	.string	"W\030\241\277\013O\314\211\264\376\335-p\370R\021\201~\232\225\336\2234\203@\207 \341\345\356\317\302\353\302DC\017\r\023ws@\337MX\347\301s\300\f\274-hxZJ\364\330\356\312h;u\232ZF\243\203t\326\232\016\271\212\347\036\243/\210\253b\334\031\262T_\320\235#\251>\240k\320iI2\244\235\f2d\263\370\224\245\232\021\301h\026}\354\033\277x\305\027\r\243SDVl\250\370\271.\372\305\366T\362\f\312E\247~\314/\203\332\r\022\257E'\320\2676\205\314k6\310f\243UID\032zR|\312\242Y\364\255\r\256\375@\217\n\233\342C\263\344\027\013>^\333D\331\232\335\237u\327\b\303\023\356m\211\265V4k\365r2\001\255\246\323\254Pq\007x\347\207\373\205\273\246\232\242\317t\031\212N\321\350\240\031\023P\330\035:\321\007t\350D\035\t\254\037P\213\001\242\3434\340\312\017\250\301"
+	.ascii	"}\214\316\217a\340\b&!\314\\\276o6S\023\241B\307f\030\330\354"
+	.ascii	"\317\231\3507\033\304\035Dz\022\351n\004\244K3\f,\300\304\027"
+	.ascii	"\023\"\016K\364\017}\264\227\356Rb\351\356\r\232\363]\233\020"
+	.ascii	"jo\351.\022\255"
+	.ascii	"Z\320Y\232\213\304\035\230\276\246\033\320g@s\2362\361\316\013"
+	.ascii	"DcA\"B\301h\365\300;-J?\030m%\262\317\004Y\nF\253\373\265x\372"
+	.ascii	"8\262g1\020\314\236\017=\266\207*\216\350\213\365\224\020\250"
+	.ascii	"}R\255\370tD3\034\363\013b\206Cp\262x\350\363\002z-\240\303W"
+	.ascii	"\020\321_\301\002ND\024\021\342\220\354lg\310\241\307\2263\\"
+	.ascii	"\252?\246\266H\303\033\365\261\232\271\013\242\017\037\005\353"
+	.ascii	"\003\310\004\fd \004\210q;X\321KeE/\021\n|0\245;DH/\221\0074"
+	.ascii	"@w\007'qBe\311\221&J\n\200\244\311\205)$(\231\202\0360e\211\222"
+	.ascii	"&G\2124\246|\340\001\223(G\220\366\003\031R\224@\201\232r\204"
+	.ascii	"\004T\224)N\224\244$0Y\262\204\212\224\342~ C\212\007N\230L\231"
+	.ascii	"\242D\312\214$KFH\271\222\022\230\020!\001I\bHQ\220\210\320i"
+	.ascii	"\024%S\2340yB\201\022*M\220\210\200\241\t\022\021:\312\024(\235"
+	.ascii	"\304\t\225%h\224)Rz\311\022*\005@\2478I\322#<\261\300\211\022"
+	.ascii	"%Q\222H\2610\302\223(\r\345\373\204\244F\215\016l<\321\220\261"
+	.ascii	"\001\nI\023(R\230\370\200b\334$2\244\204\220d\206\224\020\222"
+	.ascii	"\314p\302\004I\b3\222D\2212C\006\210}\002EI\224\031S\236<\211"
+	.ascii	"2#iw\227m\352]fY\304\361l\342xVq<\2778\236e\034\3175\216\347"
+	.ascii	"\033\3073z<\0179\236\323\343\331x<s8\236C\034\317\352\361\\\342"
+	.ascii	"xNq<\2738\236\233\216g\004\216g\033\307\027\217\277\336\233\036"
+	.ascii	")\365\264x^/\212\301\247\372po\302\242\324\003\342}}\347gx)\365"
+	.ascii	"\3048]\037\356G8\245\036\244\357\351'z\352\310\212\306\343\372"
+	.ascii	"wO\361\022\200\342\202\372\212\236\032rI\340y\372vO\355\332\226"
+	.ascii	"\270\252O\367\2463J=$~\250?x\024\rN\251G\310\353\364\325\250"
+	.ascii	"%n8a\027\321\310Q\312u8\376T\247\352\247\260\251\246Z*\350\272"
+	.ascii	"\212\361x\237\377\317\016?\311\022\375\241\352\2731\330\267\007"
+	.ascii	"\272\256\353\232A\217-g\271\2059h\206J\271\013\236\330\207\373"
+	.ascii	"\0174r\224rD\216\377\324\332e)Y\262\2776:h\302XR\253M\f\233a"
+	.ascii	"\340T\337\355\214A\217-oy\2133\025\354\341\222fHu\364\244\001"
+	.ascii	"\233s\bMO)g\301\013\233\2614s\367\211}7.\314Xz\204FvT]\224]b"
+	.ascii	"T#;iOK\356\313"
+	.string	"\021\320Q\375*]B#\240o\005F\225\216\201\332\247\331\250AI\265*-\243\314\013T\227\320\351 \t\r\325\007\334\215\302K\301\220v$tq\313\013b\2345\251\036\241\031Q\231\350\301m\257\2213\016\325\335\005=\206$\346\355\212H\217m!g\371\263\332\304\254\206\201\333c\312\002\021\2708\303]\024\231\313\r[\2046\022f\245\245\226\335\366\352\234\315]g\232\272a\213\340-\377\361\345\245\260\202\237o\217\316\013\233\271.%\365R\361\302V\373\326\262\274\003\337\236\032\005\234E\2459\213K\332%\345Be\312\335\366\342\204\265\201\t3\374\033\322c\273\350\004\277\322If\202\224r=\320\264\377\252\231\273R\272+\325\022\245\245\260\245\\\351V\224\027\356}\325\201\322\007\350\023\3269\300\257\032J\007\276=0W}A![|,]\202\314P\324\036\337\336\026\347\312\207\314W\366\027d\202\036[^\376\202\03345\245\034"
+	.ascii	"~B\177\360\022\230\tR\312\371@\323\376+g\263\227\305\271^\351"
+	.ascii	"\013\226%^\202\036[\244; \233^E!r\342C\301h\305U-\236\362\362"
+	.ascii	"\007k\353\022\027\301\331\364\263\232\271\317\023\372\202q\372"
+	.ascii	"'4/\257\344\227*\1778\3758\255\003\316\212\220\212\237\253\201"
+	.ascii	"\016\322\203\024\031\313\223\376\\\250\023[\3414g\235i**\205"
+	.ascii	"(?8\215\364\207\265\236\0166\237\363\020CV3\223\005\n\200\036"
+	.ascii	"\343;h\205\200t\231M\364\263i\007\370\234\206N6\315W\277\302"
+	.ascii	"O:\n0\252\021\177y6\315d\345I\247\210\312\304\345?\3609\035\r"
+	.ascii	"\236\371\234\215\nIEpf\377\231J\361\332|\316<\347\372\256\260"
+	.ascii	"9\b\254\260\223\376\023ED\"\232\301\267\3023\006_\224\243(C"
+	.string	"f;i>\347 \347\3661S\341\207\tgf?\360\016j\b\326\266\345\214\257\232\231a\375\301\315i\327\350/\344\207\316\003\200u\302\022}\364\330ZX6`a\f\236B\2609\027D\363R\3121\200&\372\2614\363\211\277\2306-z\r|M/\312\300\227}f3\t\027u\304\026\347\f\025\\&\263\2136\360R\227\026\310\313F9q\227\327-[l_*\362U\363r\212\021_\361\324\031\257g2:\347\230}Fg,}\304\023=\244\312\240}\271\003=\266K\007U!\352pE\024\242\321\352\204-\236\036\261\335\234jkz\356_\366\327t#\266\233S\216\221l\335Z\327\365\005\3639\341 \322\312\323@\2175\237\363\225\356>\253?\361\017\323\246%\314\360\357\357K\305\227i\276\262I+(\337\313\364\001\365\255]\371\0170b\312\037L\017!.\210\215\3004[)\265iy\005\305#\276J\342=\2709\333\244c"
+	.string	"\325\030\350\261\375\263M\307\315\364\237\\\0268Y\0371\221\002/\353#& \307\317\364\375\020\263\236\216\246\377\3460\016\307\361_6S\357M\232t\210\276\271\301\033\235g\313>#\245\231\336\337\312\266\2768#\366\370\312@\246OX\202\371\234`\346\316nN/\036\314\347\354\342\\\371\2046@\220BR-\252\027\225\266r\033W|\nB\237\371\205\317\271\305\317\225\232\210;\016\315\030\240\037\204\215\250\023\221\205\271l\242H\241b\206FDd\244M\322\030s\030T(\030M\344ho\355\001\023@\303\314\252\001\222X\220\242\310\031H\204\204\264 \312p\244W"
+	.string	"JHQ\357\004-"
+	.string	"\311\205\f\235\216Rq^\030\316M\335\"h\367\302'\252\245;\302\226K\314\276As\257\233e\272\013\351*UT\270n*^\\\364\266\037z\020\227\031Go\235\363in\346g5z\036\352Hw.\002\331>g\027\313\031>\266\355\307\355DP\241\221\227Jo\204HK\245@z>l\215\245\0278B.\336\224\017S\036u\357\320\276\325\031V\353"
+	.string	"\375\213\b\373\362\305\360\001\204\230E*\"=\2427\300\\\333H"
+	.string	"^\200\326\251\337F\300'2\272\364~\335V\036\3126\266@\210gT[\027\342\324\335[\026\374\001\260\033\341\237o\033q_\341\354\031\317\276\226\267\277\002\265F\177\367V\341\376N\205;w\034\334B\227`\222\2704B\2355\376\217\347\200J\373\331\"\234\266\212&xA\275\354\030+\315K\202o0\211\354\373\245\214 [\300\313\224a\252\036\300\321R\002M\365A\304\034\264.\313\323b\026\036w\235\2501\340\231\222J\251\314\020\324[T\330\223h\"\250\241\254{\243\322p\354{\271\364(\371Qi@\271\252\204\264\234wV\213\271\253\214\250\344\003%\002~B\243Zr\221\211e\216\255=\214\003\006P\317\362\317+.\312\"\231\225H\236C\366\200\301\223\266;j\364Z\211q8\243\365\025\345&\005\327\247\310\246\351\311*\372U\"K\2061?o\306KV\336JZVr\351\312\315\"\004"
+	.ascii	"\350\224\257\246T|\254U$\3122\312q\211\212\345<\220=\200/\353"
+	.ascii	"\342\3358\344\312s,2\206\304\317\375\267$c\203*7\303I\036\024"
+	.ascii	"\024\275\202G\234"
+	.string	"Iz~\235\324\036AK\021\0272v<\025\221\266\005\211%\2755\273\261V\0354r1\034@_{>@K\345'\266\261\\\020\312\\\f\314"
+	.ascii	"\035\336H\206\254\032\021=:\237j\372\204*\366\323^ \323\3648"
+	.ascii	"\230\263_\264\236\261\371\364\003\361\321\221\202/t(\373JNi&"
+	.ascii	"^\232\332c\223S3pL\311L\233D\305\314\367T\373\305R\212\tH\346"
+	.ascii	"\362y\023iC\276\2423\325fAT\201\331"
+	.string	"\256\371\202\305\235\f\332\341j\211\255\340T\357\374\273\265\254\360\337\2346\365\366n?Q\362\323\2279\3525\260\337\345{\026s\025\035k\314S\230a-\371\301\377\305O\274y\f\256\254\373O0\220\367\030'\365\024];\242\035\301\027q\262\025QnI\207@\375\304o\311\300`\223qB\210\367\241\235F\337\024C\2312\032\270\327D\007UD_z\355\r+I\361\246r\202t\3053\024\252\267vj\313U\222\303\363@\2504\317\256\204/\232\273\377\224\261\311\257\367\032\235C\203\316]Ry\265\247bH%\nMj\374\310KA\\\004j\025\213\003y\365\327\341$\032\331J\233O\333\355Le%\203\n\307\352\f\352\363-9sg\300\005\343\004l\251\272\226\271\225\326\334\276=\200~\313\254\255\026\373\236Fj\243&\241\277D\022jZN\204\037\205\013\264\366\002\177\373\r)\033\204\026\232\204\305\367}o\2568\273;\257=\330"
+	.string	"W\370E\203\343I\312\310\235\322:\336n\231p\302\253\247.j\350}\025}\245\226\305\tDt\017r\203\346d\031\357\375n\314\361\364\212\277\306\213m~'\336^\fN\323\340_\375\003\250\210\321i\255\325\t\013\034\340f:V\360\256\370\3415jSz\313\006\241V\316\211\232b\241\260\225\032\025K\016\207\326\222c\237\203hX'\356\016[\320\256& d\225\t\373\261\3026&\025\253\3650\036!\352\334x\340f\332U\361\3439\345\255l-\373+R\023\363\225\005\370 i\365t\211\365X\260H\353\006+\200\0032A"
+	.ascii	"K\301\226\224x\214\262\001q\301\305\246Zn&I\365Cz=_\3108.\322"
+	.ascii	"o&\003q\006\276\f\2610\013\341\276\200\206\275G\"Y\250Z\335\027"
+	.ascii	"\3701-\277P\211I\3561&sV\327;\007~\366\035\233\225\241\213\206"
+	.ascii	"\273c\377\304\203A\007\007\214\035\213}w|\244y/~'\326\276>\031"
+	.ascii	"\207\374\020M\336a\263\306\321\250\220\276EHn\215p\350\213\330"
+	.ascii	"\332k<\030\247u\bB\323\2405V[\212\377\037\234\261\036\236\267"
+	.ascii	"e\327\211\333\200r|\334\344\037Y\322\260\b\245ni\276\"r\023Z"
+	.ascii	"N\261Y\251\026_\237z\0342\371zG\035u\030g\245m\213\257rs\365"
+	.ascii	"\221\025T\247:\307\037\241J\204\303\360\224\201tz\021\031@\301"
+	.ascii	" \215\226Z\t\320GS\200\333\370-\214\211\\\321\264\346\3242\016"
+	.ascii	"\244y=q\2274\352!\231\374X\270\363\200|\272\243R&\266\224\251"
+	.ascii	"\223l\361\037Q\241\313\270l'\223\344\274/y\377\004\257\243.s"
+	.ascii	"\246\001\254E*\207%R\013\257\270\312\270\347\033.\250!o\274}"
+	.ascii	"\\\331\225\215\353\343d\243w\317\026\373\2365\361z\327\312\211"
+	.ascii	"]\314\332\200T\201t\306\006\212<\004w\335\343ybKv\357\221\357"
+	.ascii	"\263\331%\265\220\034\303\236\376\004Y\3722\371-\364\300\342"
+	.ascii	"}\003\337\220\304\331\253|i"
+	.string	"9\2421:[\364N\251PVi/\304\nB\337Z`n\272\025m\230p\201K\210\313\372\"\236\030\337kO5\364\0015E\034\327f?U=\300\364\236'\345\257\221\0242\003(>\354\n/hY\376\034a1\2670\375\334\355\333\237w\317k\177G\362\325:>\213\256\3551;\274A\226\215\245\344\"\317\317{\3667\026\037~\007.\370\356j\270\013\273\030&^\303\362\221\373\306\211\333 \025\246\275.\031\231^C\277\006T\353\311\257\216\275\235\277\332\254\003}\320\330\236\204/\r\311\250\237!\250\275\230\357Yf\367\016Z\n2E\304\233\353\334\221FTT==\212 F]\243\255\307\211x\030;)\266\177\251\013\202i\\\026jFc\336Nd\234ss\005\347B\272\323~\216\335\234\322-\317E\220k.\276\377\037h\362\332\236\346\242\017t\217>A\367\253\342\271\225\353w\006\233\022)g\241\263\345\016\345\232\332sO"
+	.string	"\327u\024\220H\315E\243wIUd\332h\267\332\313\322\311l\027\355\235\bS\333\226\243\264\251\205\2652\n\222\332\240J.\353\263\341\213\021NKB\344\204yi\200w\313\303\315N\205\2060\341\222-\345Q\213Y\f\345\343\311\367\353Q\221\003\205\245\363\360\342\265\261\323\350\220\226\245\325r\b\263\306\236<\237\216\\\200O\262\374\226\021\375q\201:yf\274\272X\275|\b\254=J\365\220\236q\371\377\3774\254\001\301\013\001\f\034]gpI\312\024\275\027\275\021\\\375\006H\377\246}\316"
+	.string	"X\016z\te\005\260_\317U\035gb\251\237\254\317\"&\307\256\266\b\353<\207\265\270"
+	.string	"WI\301\200\232\367\267?S\316\252\242@\254\234$M\367\250\224M[$\301\003\355\253\266\241\207B\321\332t\255\t}\232\240 \256\304)1\320\235kj\371 \025\267\237\272\036Vr2\237\231 E\310\337\225\035\357\262\343\342$\261#\365\3317\357W0\177\315XO\270\347C=\243\"\002,\266\377\232\032\356\266\304f\004R\357\254x\f\2261\2718\300\274 \264\355L\335#e\371\343sP\203?{\357\260m\t\272\207-\246\254\216\266\023"
+	.ascii	"\330\267\2052\241@\206\t\241\355\246\343\304\356\317\307\310"
+	.ascii	"\225\213Ns\351\230,\275\023Pfad\001`*\030\305l`\025A\270\263"
+	.ascii	"\007\335g\245\232\321 \363Y\271*\342\316C\370\246\37137W\373"
+	.ascii	"\314\227\032abJ9\024\374\305\326m\331?\306A\234\345y/]\226\017"
+	.ascii	"\244~\276\221\3159\327\315\214\03207\371\340m:\311\224(?gz\224"
+	.ascii	"\205b3\265A\326G\007"
+	.text
+	.section	.gnu.lto_cmsDrawMenu.117.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`A\030\345o"
+	.ascii	"z\266P(H Nc\215\001\225\3149X0Krw\303\026\376\271\200\230\344"
+	.ascii	"qw _Qr\371\005\001Kw@{\206}\315\326\216\260y *sv\241s6\200\016"
+	.ascii	"\350\034\272E\226j\216p\251\336\310\027\234P\2226\331RJ)SJ)k"
+	.ascii	"\002F\002~\002\032Z\347'\2453\263uvZ\2353\3648/{\234\233\224"
+	.ascii	"\316L\253\363\222\322Y\311\3079\311\307\031iu>\352q6\352q.j\235"
+	.ascii	"\211\224\316C\255\263P\353\034\344:\003\265\316>\357\334\303"
+	.ascii	"\343\254L:\363$\235\223\256\263\353:\267\2563\333:\257\256\263"
+	.ascii	"\332:\377;\373\352\334\375\266\244\bhB\240^\005\257\370\367B"
+	.ascii	"\211\214\341%aM\323\245\021\273\003\233\365\026\354&\354.l\226"
+	.ascii	"\271\257\022\247\270\017\271\317\260\362*\004\3042\245\335\035"
+	.ascii	"\tB\334^\2735h3\275As\320\206\254\274\212RX\326\357\363e`\216"
+	.ascii	"\036\2308@\346\246\230\t\311\202\336\351\333p`\364\302\304A@"
+	.ascii	"\313`YkW\345L\227\227\251"
+	.string	"\021V\315\026\\\302D\373{\241\260vU\266\334^\257\n\247\230\003\315\230j\177/\\\013h%N\037\235\367\375\373\320+\313\340+\266)\377\3532\315\316\300\214\223\357[\007\231\302\355\225\251Z\3050\325\316\334}=\246\331~LZ\350}\263$\236y\337\277)\206r{\345\2776b{u\233\210\355\225\233\314,$\255\275h$\364\266@5\240\363\276/\325O\300Q\234\201\205\030hm\266\024\207(\250\r\032\236\230N\031\226MLKJIHGFEDCBA@?>=J\236\244\333\262\253\372\336\344Fk\251\r\234\003\342\241G\0316T\341\006\0164p@\350OV}\027\324\305\03163\357M\214;M\337\006U\25496Q\310x\006\277^\252Xc\324\036\364&\025\253\231\316\364\323\364\255/\357\215\317\227\212\366 \220S\027\347\327Ja\222\3004\022\230.~\244z\340\242\032\225`\267\202\221\005]\2442\327\220"
+	.string	"u\312\202\345\261\363\336*p\"ui\216M\224\236\276Y\240F\225`\267B\347\275m\361!\n\264\270\220\004qw\035\244\266kP\270\224\250\023'\215\025\007j\263$\210\303\322?Ouqs\3553\227\367v\305{\206\350\265\221S\027\207\245\225\3237*U\234\247\235w\235l\263\352\342\250\264\253z\210\203\346\205\236\276A\240\032A\341\322&\347\355\224f\241m\330\036\205{\372*\245\325\03785\225\371\276\257\022n\315_%\201\001\233\341\017\\\232\252\334"
+	.string	"\006\2756\354\247\2747D\3676\353}_\3666\270\270\346\016\315\374=\314\\\306l\224\027-h\025iy_g\267q\303i\026\232d\230Whi\261.`x\2671\363\371h\334#\310G\367\3308DX\247\317})7\236\036!\024\221m\024z\210\236\037\024q\355\304\316\321\363A"
+	.string	"9F3.\351\371\242E\277\016\212\027\210}\0076S\371b\337\216\320;Kn\344\231g\324\360nS~\027\235\332\243\265\026\305+\323\034\237\345l_\252\210tg\305\351\221x\275\204m\301\356A\327#\030\206\356\261\221})\273\272\300'\321\023\003E\374\3562\366\307G\303\236\347\203"
+	.string	"\262a\335\350\332\214M>\317\367s.\255\204\236\232\215\331\260\301\366\232|\251;9\005\342\246\257\340\2278\235\330-\330\377\366\210\347tH\366\347\2277\217\215?\276\007\233\351tHuu\177\201o8\320;\336\254\206m\337\375\2446O1\354\253\337~?\361\322<\222\327g\273M\273)\303\301\345\335\306\305\366\272\376\325\242\334\277\372\r\275\303\274\243\327\224]q\213pFA\017\367}\337\256\200\t\333\353?\325\235\237\323#\275)\312\0300\352\022\326_\213\361\203\006aI\327\001\007\260\275\372\377\020\231C\244q\332!\0059\323\022Z\352\304\371&c\373\203"
+	.string	".\252y\035\346N\323\035\220qW\300\b"
+	.ascii	"\361n\353\225\033\b\333k\177\317\242\234\323#\271\r\373\305\336"
+	.ascii	"\031:\215\257C2\377\245\371K\231\233\003KhR\206?\013\363\023"
+	.ascii	"7'\321&l\r\3555"
+	.string	"\327\271\325\234\215\330\334h\375\236\271\316L\314\\\347\006\224\220\215\211u\006\335a\255\363\221\326\031\254u\376R\235\027h\277n#\252\363\217.\037=x\354\320\321\201\315\\-\330\234\003\307\215&l\266\261\325\205\3155\272\260\231F\353<\243u6\240u\226\221t.\300u\216\321:\023\320:\303h\235_\264\316.\\\347\026\255\263V\353\314\242u^\321:g\265\316*\222\316X\256s\n\327\031E\353|\242u\036\240u6\361\343\\\242u\026\340\235\257Zg+\327\231\204\322\271*\351<\302u\026\321:\007\340:S\265\316!Z\347\251\326\031D\353\374A\351\354A\351\f@\322\271\203\353,\325:sp\235\243Zg\250\326yC\353\034\217\327\354\362p\270XP\365 \026\375\246\234\215x\256?c\362#\266\220I\365J\365\"\230\004\360\"\264\004\020\342\251\246>\004\210\377\360S\022\200\360\360\037\030\245HQ\003\210\364R\366\360"
+	.string	"|\220,v\036~\352.\002"
+	.ascii	"\\\020\315\233\2249t\216^\312U\207P3Cb_\005\t5Sd\366\f\350\035"
+	.ascii	"B\021\211\304\236\353\243\3136c\271>\b\240\035\256\357@#\263"
+	.ascii	"\027{\263o\307'^\003\337\301\312\373\320\347\232S\334\367}v["
+	.ascii	"\223\212\373\024\223\3525\352\245\336H\225\346\025\357\266\006"
+	.ascii	"\236\t}4\346\360RU\260p\370\244\034\324G\275\033B\357\374\370"
+	.ascii	"\r\017\245\341\237~\203SiF\300\245\341\223r\314\177\372\026\005"
+	.ascii	"\030\202\260\274\213E/e\346\017}2\002D\025\372\351J\026\017\210"
+	.ascii	"^\312V\202c\334\b1\375\320G\233]X\346\007\261\363\007\232]\230"
+	.ascii	"\n\314Q\2243\364R;\355\364Zm\334\201\303\254\246\364\313 z\231"
+	.ascii	"\353{2\263\035\004\211(\246S\037\334\035\230\300\343\232w\352"
+	.ascii	"\337\013\327}\204\177}tze#n\257&\350\234\016\271\305\337X8\275"
+	.ascii	"\212;\277\345/}\006W\353\246_\276j\347\231\327\364\244\331\305"
+	.ascii	"ucz\253E\217.\275\324\242\034\t\212k\246\352\373\276\257\220"
+	.ascii	"\32237"
+	.string	"-\360&\315.Fo\034\352l\315\013\232z\315\275\346\036\233\364J^,\322'}3=\322?\034\350\2356o\006\2045\270\240\2272\020\343\017\331\257m\312\261\267\361Q\021b~\224|+\202\262\035\233\306Gm\374\321{\036\340\bF?\366G\337O/iEo\364\375\314#\372\"O#z\252\225J\035\rwH\266\361M\350[20\223\b\244\344\273\260\231\316\023\232\306+\231#[j\"\326\306\223}\353\370\364\222\364\247\3107ES\367:d\377\274\364\375-s\322\022\331m\215\275d\203^\350U5\320(i\036\231@\307P\0022\350\223ih<\320\277c\242\"\231i\341\235\t#\370,\331\257o\303N\326\251\275d}\376\353\331\241ri\036\371\245ah\206q\337W\355\212[\315\031\233&\237\317\037-\372\275Q\034\323r\035\230\031\323\363\3222\266\013\333\214n\354\233p\316\330\027\335\311\361M[x!P\276\224\317"
+	.string	"\031\177\236|\177\217\215Qn^/<\311\2276.)z\363\276\357\362\315\234A\305/O\316l^\303Nu\037v\214\345\314\364$G\274\300\274\276\274Z\"D\302\276\302\204\260E\032I#\tK\362C\274\276\276\302\266\312\200\210\r\341\001\013\013\023S\307\270\274\300\212\344Hr\304KL\214L\210\017\233"
+	.ascii	"RU5\304\312\204\210\020@"
+	.string	"K\200|!\031+\322\002\211\313BB\214\201\t\241:R\004\b\030\225\020\2611\252\020F\034\206\304K\214*IX\230\030\225\362\317\331Y\316O\223:\354\031l\022g\264\013T\370`\340"
+	.ascii	"\345\343Ye\366\370.\250~\362\253\030f7y\034P\355\366O\310l\307"
+	.ascii	"\336\332z\003D0`\013GW\327i\342\306J\324\023\034\337O\334\266"
+	.ascii	"\276\335\224\006\031\037Mp\\\203\005\312\020\004\0264\264\223"
+	.ascii	"g\365\251\353}|t\203\226\221\230(C\205)>\232\221\313\007\205"
+	.ascii	"\033\234D:)\340\273\276\235D\277\200\023\336\342c<\216h\323-"
+	.ascii	"J\300\307\200\361\004<k\3479\227\366\342a\250y\361)\354\034>"
+	.ascii	"\255\270\321p\304\305\0379{\301;H\343b\353[@\256P\306\213\334"
+	.ascii	"S\006\036\317N<\236\325\246\035\337\243\233\234i\362\330\343"
+	.ascii	"(\212\323\016\363\245\034\244\305h\250\365{\213\357\226\345\217"
+	.ascii	"\315i\271\343YU\322\361<>ZE\270l\266_\305(\365\3737>*\242\316"
+	.ascii	"\262\241\377\204J\355\3305>Z\343Y\274\337\001t\243\346u8\200"
+	.ascii	"\302\342\241\356\310\324\270\361M\310\243\243\270 \347\226\201"
+	.ascii	"\355\233\320\321\372\3067\333+\241\360\364\002\255\361\r\375"
+	.ascii	"$;T\006\031\367\274c\340\0029\270|iKyv\300\002S\257=\253K<~\307"
+	.ascii	"G\205\272\031\206]\361b\203\3150+\036\350N"
+	.string	"h\2201\204\035i\177{xM/\345^\373\256C\303W\227\365\202eK\327\240\214U\361Y\377\216\031\224\271^F\305/\357\3228\3510\222\231\276kX\317\343{\355]\315\023/M\355\261J<\212O\321j)N<\212w8\003\374\211o5x\316\245\231\370\001\374L<\326\235\234\023\316\373\232\016\210P\342\333\203\3051N\001\276\235W/\300;\nZ\177\365\254#\264\217=L3\235gt\232\322U\216\007s\020\240s\276a\344\233\276h\337\210`\032\355\217\026\345\316\264\320\033\3060\037\354\245\240\002\323K\037\033\314m\364^\262V\017\366\200\357\271\027\253O\246\251\361$\376\r\277\370Z\234\303\027\226^\372\346\365\373F\213r\216&\350\030\367\222\002\255\004*\275\024\312\023\r\027\244\263g\365\210\353u|\224\261\264\016\306+:\222\252\002\201\377\250q0\006\225S\206DDD\222\024$i\ra\005\304\030\345\030\204\267\001\022"
+	.string	"eAG\255SU\222$I\373g\203\340\377\350\002cQ\206\324\r\021\370}\024\325J\226\022}q\241q\f\272)\234M^\216\2643\016\245\022{\b\327d\224\343\020\310\006\220\346\367\336G\352\225K\241q)\322\265\310\001S\334\252?fZ1\037$\244\367h\030<%\322I\354h\267\004"
+	.string	"\304\314\363hq\312MT\313UT\242\207\307\362\256\300\350\024\243Jn\202\3063\366\234\201\201\236\204\330k%\365\261\243\234Oz\222\216\312'pmH\344\016\343\376]\302\260W\205Ro\r\236;Q\\&\357\022%\303\363\2715$\237\365Y\344\221\204\216\361B)6v\371IF;\341\273\252\372\302c8\033y[\230\"6\2069\353\343\255\3306*\303\236%@\256\027f\356>D\324B\024\362XQUjp^g\323\360m(1\205\2077\20649n#\361\3751\255\234!\240R\331\260\206s\t\300\230\316\200b\211ov9A\315B\333\220)px\375\006\243\327_B\316\276\357yS\232c\221\335s\331\320\312>N\374E\023Md\341\340u\305\3463\"\343\357\224~F"
+	.string	"\317\231giD\013D\244\364\210\313\035\243\037\326\370\203\221\300\224\305\267'\360k\376\337\005\346{$\222y\035\372\r\204\261\367%\252f\240\306\215\240\234\302qsm\020\232\210 \216\3323\373\2741\225S\3036{6,:2i\027\211B\366\333\b\341l\303\342\267!\024)\373\\\367\230\267\210\335:c+\354\265YB\001Z\223\034\270\026F\221L7\022\203S\nZ\231\360\333\354\f\203\344\315~>\027BC\021\003ae\260\364r]\362\261\200\222\310\201\244\256\260\030\352\022\b\230c\201\250\227w\336\347:\317\3414\346~\001 X\020\353\305\307\267\022\277\3618\373\306\375a\216\243%\316"
+	.string	"\327\271Y\215\037\342,\334gG\225\f\317'\035\350\023\367\2533\301Z\241H\226\020\3178\354yd\026\2727BD\255\267r\345f\224\306\\\205\007\370\261\201\016\2116\237g\252xK\253\314\237\260Y\202\022\205`{\346\240\272\234\243\324\220\353]n\375I@\"\344\207q)\270J<\214/\335\314y\265\343d\355<T\363\261\2456\212x\031\303I\343%\210i&FP{\277E\\\235h8~g\032`\n\267\206\371\277\251\236oI\0070\342Z+d\352R\262s\355\245d:\326\f\220\025\027\024\0058U\321O.\3328I\316\016D,[\275L~\330\201$ 4\341\364\2250\333\n\034j\f\273\013\251T3'i*\331\312G\354\001c\315q\003\314 \374\244\013\255\267\220j\034\216\207\245J!\006\271\253\0067\330\021\323\345S=2W\253\030\207@?!\366\224\257)sb\244$\033n\301\341\310\\"
+	.ascii	"\3656\331\216\223Y\337\304\365\2553K\036 \332E\026q\321\322\240"
+	.ascii	"\005\235\213\321-/\221\375\271\342\016\231\270\227\226j\352B"
+	.ascii	"\231\025\263l\362\265,wT\0265\230Z\200\337\264b|a\317\201?I\223"
+	.ascii	"\305\033;\267\020\266\336`\2406\201\024k=,\320\233A\337\310\265"
+	.ascii	"+\266\225>L\004\231<W\341v\024\231\362\343\3037\032\247+2\236"
+	.ascii	"\013\261=Q\016\252\322\236\262\347\354\016\326\345\233\1777\277"
+	.ascii	"3\326\3040\377\2173@\357\032\227F\006\262\016\2751f\032\370i"
+	.ascii	"\33642q\235u\3235\252\275\203\037:\253\3109\322\231y\322NI)\321"
+	.ascii	"#WT\361\360\236T\273\255\\\355\213\250\312\361\252\307\243\341"
+	.ascii	"A\3637\211n'\213\002\210\324\211 \333+ic \\\341\202\"+\303\036"
+	.ascii	"5\264|\316#\2534\215\222j\033\0037\331\353]:5"
+	.text
+	.section	.gnu.lto_cmsMenuCountPage.118.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`5\003\215\030"
+	.string	"\266,\235H\300VQ:U\216\204\242--1\347\n\206\300Y\305It\020O\002\223\357\004\351\300X\252)!\022\"?\326\266\360\262\220\326<FL\370S!*\004E\321\026\263\362\243\263M,\365w\3161i\373\350\243\b\021\2627\221;\245\207"
+	.string	"~"
+	.string	"\220"
+	.ascii	"P\\j\365)\3704\004\353@\301\271\264\357\343J\271\377\030\361"
+	.ascii	"W\255ER\222\324\352\3031\002\361\323\276\007\240\237\342m\350"
+	.ascii	"\247s\266\226\001$j\220\203\034OxC\300\324Zc\013\303T\346\036"
+	.ascii	"\322\t\256\314\371\007j\\\351\215A\017[#\357K\227D\243\220\244"
+	.ascii	"7P|\206/j4\365\306\024\007\301\007JIG\255\221\004\270A\232\236"
+	.ascii	"V\343\220\334/}\276\240\261\2457\242\270\f%\324Z-{\343\211[\274"
+	.ascii	"\355\235\355\b\366\362\004\364\323\265-\273\347C\200\304Z\253"
+	.ascii	"\314g\272\020\037\037\351\323?5\371\336\247_\243\237_\002G?t"
+	.ascii	"\262\312><|\222\022\374vDU9e\373\202\344\032\331"
+	.string	"\227EE\221\341-\262a/W\213\025J\323P\351\025\225\236\231\3222SZ\004\245\303)M\247\364\234\322 (\275\367\335r\245\017\200\325\243\304x\032O\265\232\250\022S\247\314%6\356\373\355\177\311+\035+8\266/\204\253F\325\217I9\002\340\312*;\035\217\361{\212j\315\b\327\3105P\346k\327I\272\226\265D\256u\301\224\305\326\360#3#\0346\210!\350\347\356\002,J\\\260V\202NN\035\254\265V\372\272\323Y\373\332/]\200\324\257\207,\262\242\310\311\004\227\265r\211\254\004f@'\247|s\033*\027\266\377\262\303!$\253|\251\037\220\033$+\274\200k\344\327gt\367\306\204eH\206\361\211\374\224\226\312/\210\323\332\265\323Bg\332\211\360\210\265\016\311\374&\021\035\nH!\001\005\266{g\326\240\001\007\235\035\00695@3\0176\\\317\004\233hZ\016\356\207\026\373\3203\373\211\321n\270XN"
+	.string	"\327l<\267\030\210Z\355\026[\371\352\214\203\224\2655\273(T l[K$\376\236L\321\255\220i\326o\362'\n\025,X\030\323\353\262Z\232\037Ggv\265\337\261\220\331\231\035 \205G%.]\231\375\216G\270\342\236G\365%gr\301G2\206\f\362\275\f\3643\\\331\221\212\334\\\272s\314\216\305\315\rE\301\235\373\035\224k[\033G\2501$\247\020R\210)2\"$3\013\f-\006p\002\231If\033\020\230\250i\003c\364{a~Q\240\\\360\212A\262\\`\250\245\217\261\213X\336\353\177"
+	.ascii	"W\001jc\217\3762>\374\243\243R\276U\243\001\213\253\234\351\261"
+	.ascii	"\264\342uZf\260#K)\031\316\234\322\001~\214|P8Y\274\260\357\""
+	.ascii	"3Y\302\212\266-%AA+\b\370\360\377l\330\035\322J\003\252C\271"
+	.ascii	"*&\013\310\326:\257\202\004\013\224\n\323BJ/)\177A\035\003y\273"
+	.ascii	"\227\255\215\006\206\037\202o\252\206\n"
+	.text
+	.section	.gnu.lto_cmsMenuChange.119.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`1\005\225 "
+	.string	"\266z\315G\200ZN:\313\024\373\227\332\316\323\307\004\215=6\\\315w\344\321[\276wG\361T\224 t\272\304\32011B\277bo8\214\345\017\261\034\0365\270\006\303\221@\362j\336T\342\363\325\262\036@\243m\2334B\210\334)\005\270"
+	.string	"\252"
+	.string	"\276"
+	.string	"Sb_\220,xi\r\347\313\333B{g\377\206\364\226\214\005\217\247R\031{X\370\352\321\"T\234\t\347\313_\215\336\351\307Z\274\247\326\256'Rj-\366|\340|i\333\027;\022\241\275\205W\374\272\342\205\261\r\315\330j\255>\027\377c\276<\037\300|\2719.\274.w\342\314\222\\*\364\243\256\303zNG\304\372\371\037Ev\240\271q\245u\034\031\001\255F\301\005y\003\262#\016\251\231\265#V\321\222\334a\251\205y\332\f\032\344\2032D-\027\224\274\224\326\227|@\344\005\332\016\221\212\3345i#\344\306S\030\304)Jq\024j\255\246V\304\253{w\333:l\023\331\245\202or'H>\217\227N:Ao\365\322?a\276\374\022"
+	.ascii	"\033\223\242o\246gi\026\307\217\262#\271^\337.n\266\254,\224"
+	.ascii	"\351\263F\306#\025}\343\033\257;\363\302\345f\255\3226\273\030"
+	.ascii	"E\327\313>Y\267\313>\251\205N\366\007}\354\347\335\354\006z\361"
+	.ascii	"\3679\251{Lj\036\223z\307\244\326)\251sr\324;\223ZgR\347J\352"
+	.ascii	"\323\244\306\235\324&\216\2724\251\311\222zKjJ\251\217@@\030"
+	.ascii	"#\230\26207+\246Xe\274\301\251_J*>n\366\333\377\025{~\231\177"
+	.ascii	"\346\335OI\317\266\033\374\2047{*\020U\2542t\001]\b`\310@o\345"
+	.ascii	"\002T\033\305\305\310\026\227\326)\200\362\326\336\300\201\336"
+	.ascii	"JhC\370c\324\260\030\250J\353\201\023\336[Ls\277f<\362h\320\272"
+	.ascii	"\\sO\344\242\332\250\323-6;\330\314w0\313\r\022\375K\207\263"
+	.ascii	"V*\b>\223\017\036\312\375\001\033\273\362d\332 \316\345iK\320"
+	.ascii	"\227\232)>\253\005\352gL\026\244\001\307\032I\322\260"
+	.string	"\330+~\005\351\347\253\326\032\301\257r+!D\214\030a\276Dp\314Zr?t\333\235r\253\265\2230\351\356\276\312\306\024}\263\217v($|\036.\002\002\315\227t\203\216Yg\242&\226F\265tI-)\327\313>\37352\222\261\217\376\004\352\254\265BpNF\025\202LNA\025\300\234\022S\320\004\251b\351\210CSi\tE\016\034\224\370I`0\004\200E\021\212&\247\244\013M\247\201CNJ@\337RR\221\222\017\030t\362\r\375\230\251\351(\350K\301\304\024\364\355l\273XO\326\355\3620\nNho|\216+\254m\030e\335\2630l\367\254)H\355\224\216gw\226g\217f\265\246\263\270\335\331W\035\311Y\23539\333;f-\271\305\331\255\231\2472\272\335\355\256\031\272\345\026\267\272}\025\225)\372\346ssd\204b\300ssY@\213\333\362\312\320\255\rhov\".)\332\3461O\t\276\304"
+	.string	"\255\017\330\330\331O567\211Av#g\200.\2700I\005\027\033\345\245f\250q(\007\221C\344\220H\020iRP(t\200\002\221\251\252\333\021p\271\222\252(\311\260\031c\360<`\016\271\223*\320h\003\276\036\032\274?9\206\2652\345B\2001\\"
+	.string	"\332\230\217;\304a\253\032y\016\242\234J\340\200\025\330,\324\251\244\322!\027=\266\246"
+	.string	"\341(\244\250\337\236Pv\342"
+	.ascii	"\304o\256\227|bL\334\2014\260\033\335&/\217\n\247#\273B\333N"
+	.ascii	"<\341F\262\363\241\b/T\234\270F\313\017\022\225\230\336\n=I\334"
+	.ascii	"H\264\361\254S\342\265b\315r,\306\300'\201Sj\373\334\250\270"
+	.ascii	"\371\264S6\tP\275\313\332+\t%\262\337\3443\217\356\004\003\331"
+	.ascii	"L\203\223\301\005U\005\345\307O\024\020\013$D\345\362F\245i\f"
+	.ascii	"\343\027\006\037'\370\252\266i\323uE\356\365\007"
+	.text
+	.section	.gnu.lto_cmsMenuBack.120.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`4\003e\030"
+	.string	"\246,\235F\240\032U:\224L\213Z\231\253<\262\212 \322\374\334\226{7\341\347\023g\366\240<c\327\221:\326\200\372\366\277\036L;\r\362\330\277\342h\270=\336\216\310\031\352\343\367\230I\307\202T\354\003\353\032\033!{\023)e\n\212"
+	.string	"z"
+	.string	"\216"
+	.ascii	"\251_B\351\263\274=\034\013\240V\336\030/\265\376|\276\200\334"
+	.ascii	"\371\377\013e\243\314~a\347"
+	.string	" \252\031\221\360\244K.\311M\255\325\365\337\266\350Nr{\350\316N\262\263\035\351\024\233g_\332\216\353[\0176\237\030\335\356\307R\022\310N\021\001\257\310\233\325\016'&\b.\345R;\"\026\305\fU\212\220.4mI\355r\334bO\221\226\246\325\356&>hB\022\262\276e\035;\033\363\250\241\326z\326\355z\354\311\375_\343?\206\277e\001\233t\003F\036\331\240;\271\013\030\375+\026h\203\254\265R\370NY*-\276G;\037\344\202W\267\363\353\202\356\334n9\365j\\~}\273J\236\236\230\251\034\347\377\321\270\217\374\333eY\226o\336\277\275]\001#\237\007\305gM\376\212\344\253P\374\035\222\237\"\371:#\037%\362I\312\037)\237N\376\024\371b\363\231\371K@5T\263[)Wj\345Q\312\251KSi\311\377\331\037a8I\307\246Lu3\341\210\330\304\254\233!\2223\264\217\020\231@T\247S"
+	.string	"\235\366\313*\001\211\030\301\253\033Aw\352\364\216S\020\007O\276\236\303d\307\020\361B\212jF\002\024\266\230\354s\243:\301\255i\037[l\262E&\234\023\002\373 \245=\366"
+	.string	"&\\\023\033\227\237M{sC\022\273\245\204\226\331\013f\261l\226\031\337\243\2338q\202\356\024\233\201Q\220\032\227\313MHE^\372/\312\235\002\230\346\306p\376\243X+/\262\326\033\205\007\267\360\212\020A\305\004\013\020~X4^/\204\206\2028\b\221\207\375\f\301\200\271b\004\275`\270`\262!\327O\3531\241\0252\227\214XL\346J\375\3526\357t\016nn\227\365\201\213\303\245g<\255\343?O_C\255m\027k\255u\214\265\211\255Q\300\254\236I\231\371\210\232\366U\263\332'7T\365j\303.\001\225Qu\003\247^Lx\200\005\364\337\301\003\257\356\016\236\202,V\330\302"
+	.ascii	"\232Zk\205/\231\r~8\210\020!\350\3161\001\214\224v\272\231r\303"
+	.ascii	"T\007B\250q \310 bf&\250\021\005\305Rmp\002\231\231;\017\020"
+	.ascii	"xHS\313\030c\360\313\211\265\232-D\022\346\260\307v\200 !\347"
+	.ascii	"V\032LL@\345\317\205\346^\r\2004\033c\341U\263\206\302_\336\255"
+	.ascii	"\235\227\344jE~(\317\025\2330\373Q\002\300\227@U\340\206\344"
+	.ascii	"\272\336,\314\374'9\315\031\351\355\212\200\020\034 \204\267"
+	.ascii	"\261\321?!6\220\305\242 \202\220\212\032\241z<\t\254\305K\342"
+	.ascii	"B7e\206\315o\032\352\023A'/t\304\320\245bc#\244k\376"
+	.text
+	.section	.gnu.lto_cmsMenuOpen.121.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`^\t=-"
+	.string	"\032JH\020Ep\\N:\033\303\341\221tNJ\303\"0^\357[\260\314IE\262F\003\225\213\025\022.V\221p\307\343\002\323\315z\376\002JE\2614K6\0310\033hk\233\017P?\361\361\327`\307\315\267\2655\273\t\2212\311\354"
+	.string	"\334"
+	.string	"\366"
+	.ascii	"K\236\366\357~\177\3666\031_\333_\371\245\265\261\3532;\312f"
+	.ascii	"\345khq\027\336\214\230\317&\343V\246\206\3124\353ohJ\bG\027"
+	.ascii	"\203\357\250\0048\243\253IXct\264+\213O\233:\323-e\232\365ct"
+	.ascii	"\353bf\227\246J\007GW\201\357\350*/\240\036\365=@=\272?\223\261"
+	.ascii	"\033<\272{\263\335 \007\267\270;\347\312\260tH\266\347\212\315"
+	.ascii	".M\323\242>\362\342}\204A\340\317\327\253\350\331\\\334S\335"
+	.ascii	"\207\353\302 \017\006\001\302\300\004\277\036\322\220\254\037"
+	.ascii	"\367-\261|lq\017\230\324z=\003\300\221B\344K,\256\363\301\226"
+	.ascii	"\033\232\253\235m$\217\214\366\220\220I\255\237\247\004)4\266"
+	.ascii	"\374$\255\316\240\333\235'7{\002'X\\\334\301\344\214\023A\232"
+	.ascii	"\246/;\343H\032\231{Hi\232.#\223Y\337\237\357\356\232\335\355"
+	.ascii	"\260\373k\020n\220=\204mI\270;\346/U\277\b\210\243\253\342< "
+	.ascii	"\367Bf\b\224s\252rC\255\311\035\013Sk\231r\236\345\336sy\227"
+	.ascii	"\251\023(P\324\243\275\005\311\004\342]\245%>\222\033\306\227"
+	.ascii	"\261\251\266\227\374\262\023\262\203\3572\255\340#\027\201US"
+	.ascii	"\355\315\036\204\205\251c\311i\232R\365J\325w\212\2658V\214g"
+	.ascii	"\367n\317\"\265\037\333\026N|\244S=\372\026\312mUq\336\276\354"
+	.ascii	"\300+ysw\314\224\363\354*\215\334`\273?\323.\262[y+T^\n\225\367"
+	.ascii	"\250\362.\250\274C(o\201\247}\207=\336\240\312\013\240y\201*"
+	.ascii	"\357O\345\365\251\274\302\312\033\254\274\300\312\373c^\037\363"
+	.ascii	"\366P\336\312\274\350\311{\236\274\315\274\334\274\267 4\307"
+	.ascii	"\310\306\n\031^\303Q\2469\362\364\244p\350[]E\305M\254\327`z"
+	.ascii	"\016\310mAuQ\300h\357\026\247\024\313\320\226\265\357<\020\210"
+	.ascii	"\263;\303 \231\025\272\256\332o\344J\007\334\335\034\205\036"
+	.ascii	"\352\n}n9v\035\365\202\246\320?:\251\273\035b\261J\021\255\210"
+	.ascii	"V\217\036\365\004\271\255\017o\022\231\013\232H\356\254@\017"
+	.ascii	"\365\257\360\336\266\035>\347\301\227\246)\235\002M@\354\314"
+	.ascii	"N\333\201\\\352\226\351\225\377\276\362\322\273&\332g\373}|U"
+	.ascii	"\3051\2530Y\032\241\253\r\266\303F\033j-\216\034\264\r\220\r"
+	.ascii	"\373iGP\305y0\f\373^_F\265(\350\331q\216df\250\335g\377j\207"
+	.ascii	"\361\315\341d\330\217\355\006\016\314\241\036\355& \266\345\265"
+	.ascii	"\374\260\356v8\033\017K\237\201\272\373\341j\210i\006\204\321"
+	.ascii	"\355\317<\r\205\245\351\361\310}\231\233\tq\212x\252Ou\304\311"
+	.ascii	"<\355\321^\314\307\220\330\217\035\335\022&L\324\243\034KJMI"
+	.ascii	"/\242\232\230|k!)B\004\025\023,\030\021\001I%\261p\021\305\244"
+	.ascii	"\341E\214%\020.\204\253D\024\325B\251\250\211)\251E\221\022T"
+	.ascii	"T\021\221\200ur\261\004U\364\302\311\t\252(\250\254:RU\033}\214"
+	.ascii	"x_\364\252A\355\023R$r\334\021\254\344\311\307cA\375#\023\002"
+	.ascii	"@\022\006\240\031\3105\233\030\361\272\361\"BaM\256`\203\001"
+	.ascii	"\201\361\020)\240\026\022;k\320\004\002\374\351\257*\\\307?\356"
+	.ascii	"\323?\215\326\035\273\272|\232\201\\\223\2070\310\361\204]\233"
+	.ascii	":j\334G3\371\036sZv\354\371\005"
+	.string	";\353\301\201\035l\256;\342\0319\357\bc\001\373\201\330\331\335\362\3278\304\356\330H\"Twb\335\3271\r\242\222\"\232\2010:-\254;\346\301|\357\306G\251%\003\352\244q\025\001\343k\260\r:\261\376:\305\032\032+\306\323\204\215\304\267\246\342\223_\377\230\312\327BbizQ\212ex\275\376=\214i&\200\325\250q8)\231\231\231\031\221\222\244 Ic\300\002\021!\242\333\021p-\224\210\244\0056\262\034o\351\277c\231qc>l\302\026\250\336\263\221rO8\364\261iT0\202\261\216\245\373\206\264\257'\035\227\320@\262\350!\207\263\003\355\242^\256\273hb\2452o\020\030\036\354&\204\325v\n\002W\315\r\217\t\226G|)\335&I|\324au~\232\337z\264AI\025\246V\035U]\265*\005~\326\267F\r\373\206p\353\353\311\327:\363\353\250\306\353p\227T\311R\334\260\300y\367\350\272\354"
+	.string	"\002Tv\276\261\032\2137\276[K\200\265\261L\263O~\350e\261\302@\177v$\357T\016\371`\276\300\017u-#\306\223o3\240\364\036\\1\250d^\241mA\244\003\364;CRf\201\tH\031\247\315\376\302\375\323\240\260saF#\331\002\345\225u\253\324\366b\262\205\2079\371$n\022\025\332\021$\236)\204G_ny"
+	.string	"\266\322I\365\262\nT4\024\202\037"
+	.ascii	"h\312\352\204\022\265\326\bn\200T\351R\225\242\350\302\t\334"
+	.ascii	"\224rR\252\341\202\024\223\300\262H\252\032\024\334\220XV\335"
+	.ascii	"M\335)I\362\251j^\220DE\204q\367)h\337y{=~N\255\265\357q\n\341"
+	.ascii	"\373\374\250\232\223I/\230\222J\306\003\276f\341\253\272\260"
+	.ascii	"\252$\225\247\005\250\374>\\\367r\320\251\204\323az\275\016 "
+	.ascii	"\203{\b15c~\250)8\313\216 ?\321+\245?\021\177\373\350\037"
+	.text
+	.section	.gnu.lto_cmsTraverseGlobalExit.122.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\031\003\335\026"
+	.string	"&\251\223I\300RRc\"\334M\315\267\211n8\357\344J\371\270\347\201\2643+}3\216\351b\216\246\330\2430\267\021T#[\365m\201\200\177{\230C\350\273(\212\242\302Tf\250Z\034\301\353e\302\b\246\207\034\f\201\264vK)eJ\001\203"
+	.string	"s"
+	.string	"\201"
+	.string	"<R\200\227g\023!\303\347\204\326\275\267F5\3705w\037\021\201\275H[\351\334\371S\037\2004\204\367\221\225%\241\243\213\324\023\243+\0337\006\217\252\001\033\037\216>e4a\306`\321\211\237@\245o\276<\020\235\254\n\266\262X\314\312\236\372\002\006q8\361+P\301\242i\207^\353\013P\013iV\002\253l\313\247F\254\374Mz\342iH>|7\254J\242\317\227\314\275\327\363\247\024\272c\267]\264\035c\323X\266\2207i\223}c\205"
+	.string	"re\312d\317d\227\372c\037\336\326N\327:M\353\364\244\323/\321i\005a(\237\242\353\336\240.!\227\206e\321\341\303\337\276\255\212\346\013}\242c6\0244{\270Sr\215\367\345\016\0218\262\356\025\026\270\365\002\330\355c\266\215\004\355\323>\211\227\330]\212\347&\3672\351Pq\257\360\200\t\300n-<\ny\013\373\ty\353\235\035\357\001\341\233]N\241q\\1\351P\361B\024i\362\0339m\232_\335&%\201ag\363\324\336\331\314\3778F\351Gy\266#\034\305M\225\316\004\330\016y{\312\362\204\343\350\302\030#\t\212\251\322&\327\337HJsT9~s\313\257:\2660\322\342\013`I-\243\037\336\202R\317\270\237\240"
+	.string	"\273\367\227\3007!A\307\342\264\341\326\347!oeT@\016\251\336\354\362\211\257QK\263\230t\203\364\270\223+97\f\315\313\013\004\0040.-$\025pl\032\344X\327\264\350n55\234\033\232[\255&\247\253\265\240\030\227c\223\253\351\340p\271ZLxO\231\314 \2030HV\217\372F"
+	.string	"\314\027\357J\255\362\243\274\037\266\325pDP\304\237!+}@\205\345\340-f\352\324\357t<\032S\300h\223]\254\310\031}\215\2302j)P\t\225\242\302RA\251\355\311\316\260T\2467\271^\357\275\3675S\351M.\007\370\ti\351\214\006> \260\202\231\251\352\001 \202\336b\214\204\326\232,,0\275e\237\330\037j\031+\\%\356\204\201\251\263\r 7\214\302`\215\003L\210h\204\367\"N\344\204\227r\230-\323\254\326\027\272;\\a\2259\315\361+'\021"
+	.string	"\355\206J`p\220\214]\002\323\346\354\302k\016\002\3502\021\002\tf\n\371;"
+	.ascii	"\253\033x)|\246YP\\Q\206\003,\341\357N\327v\003\002\342{\334"
+	.ascii	":\335#\270\203s>\256s\245\305\004\237^\367ue2"
+	.text
+	.section	.gnu.lto_cmsMenuExit.123.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`W\007\225+"
+	.string	"\312L\314\020Ep\234J:7\"C\221\205\231\204\004Jh\264\261Y]\243\243x\023\t\265\366\231\326\337\2263G0\324\352\351\233[\344\360K\256\204\273D:\253\2572z\371\007\362Sx\353\324\216\342\310\373\265\265F\032!D\312$\003\373"
+	.string	"\344"
+	.string	"\367"
+	.string	"\217[\341\322\027\022\225\277\245\207[0\257^\3659\324\254\345\270\253\265.\270\271\025\320\233D\345\003\234K<\220\230\270r\344L@o.U\244\363\335n\034@\255eV\270\324JDZ\004\350\315\257\235-\335\245\033@<\363\032\240\3267\214\313\253\265*-\361@\347M\364\001\316\233}d\203/\211\337 \247\367\351\341\021\006\201\350\3574\313\346t_J\021\223s\325\346JW\325}\306\3363v4.1\346\211\273\006\2622A.,\1778\266\230<\202\336\335\334\345\206\034\274\021\257\260\003\017\024\361\002;z#\027\030\032\327\027\377~dd\356\330\354\024\361\n\373Y&@C\366\346r?`\344\002R\n\215\321\371\310b\363\307\3132"
+	.ascii	"\030\0266>]8J\006l\322\302\036w\336\321\205\305]\002m1\321\022"
+	.ascii	"v]\225\n\356\272 o\344\n\302\374\243Pk]\326\352\362\372\376|"
+	.ascii	"\367C\273{b\367\f\023[\232\312+\271\271NT\347\265n\356\251\\"
+	.ascii	"<\361\265\226\b\253\253\366rH!\306\312{\033\007=\253\\\265\326"
+	.ascii	"\243\031>\352\252\230\357:\230\330mu\233m\177\352<\35273X\254"
+	.ascii	"\267?\311d2\371\251\323\250\217\372\034\273\342\344\276\215z"
+	.ascii	"\331\b\331\303\030\324\207;\221\025\357\355;\250\237\005\250"
+	.ascii	"\337\274f\330g\305\311\345\342\223j\007\257\362\336.\261\212"
+	.ascii	"\333l\367=\204\210\221\265\355\262\335\223\367\350\3445\272\333"
+	.ascii	"o`H\350p\337\240\023\177\240\027\277>A\336\236 /"
+	.string	"\017\220W\b\344\r\002y\201&/Z\362\376P\336\363\307k\236\274\245\311\333%/7\357\025\020\220\363\226\006N-\331m\210u+y\247\326\231sM^\374\341\316\273_*C\332W\331\313\255p\311\254\270`\210\260\210\265K\370F\346\216-\257\003z\363\273\351\0063\350\214D\274[\341\302UW\355\343~\036E(\\\272\204m\266=e\200Cm\332\235B\355\323;v\367\202\035\026\353\231m>M\301\212\367^\326Zkp\310\247\207\372\347\021\331\306\300\217\371\242|Dva\267;\310#z1G\373hj\242\320.2R!8\356\2628\032\024\006\316j\255\021\316\274.\303n\340\300\341\274\371k\004nX\0169\305\330E18\272~B\375b\322\317\026j\246c\366\331\037\366\235\356f<\354\225,\b&\246\363\246\331En\276\254\344^\202)Ry\257-\302\231^\234\263\315>u\226-\305Wv\363e\361\024\323\210\246"
+	.ascii	"\336\2178\267\373\210\204\262u=\370\246\224&\316n\2517\273\335"
+	.ascii	"\022\017c\002\255\025\013\302^\213\215\246\356\002H\334\2548"
+	.ascii	"\371/\025\302~\356^Pl\n\025\254\342\274\311-\300\215\333\f\264"
+	.ascii	"\037~\225s\241Bk\315\272\326^\313\003\233\224\224\264!\004\007"
+	.ascii	"\022LL\0262\210\350y\272ST\r\0222\236h8\241R2\242z%\254p\340"
+	.ascii	"\240\305\003\t\r\222~j\254x\0215\365\204!\n\335\246\244)\250"
+	.ascii	"&%\030O+\240\224\232\244\246\224\222\2006F\224\223\224\222\214"
+	.ascii	"\0301\244\224\204\304\372.[\272S\302\020\253\276Z\243:m\306\236"
+	.ascii	"\356\273\026\336O_\nv\362tO\177\370u\245\367\275\024\fH*&v"
+	.string	"\336\344i $_kD;D\037#^ $M\303B#\"$\t\231\232\025\235\245G\320\254\017E7\221n\"I\223\f\273j\251\302\226\244ju\300\214\\=v\0276\213\267`\003[\330mf\350\243\f\266\0317\234\343/\2303\250\201\315f\206sWjN\362\360\214\230\301w\323'i\232\032\227\035\274\232\345q\250~\216p\202\216s\372\022\260\201\336M\243\244j\\\214Rw\250s\177\274\033\250t-m\343k\245m\347\315\237\343\234_\024b\036\336\311\306\310\261\345Ub=:\363\271\361\004\200\225\250A,\006\031sfhF\2440)h\326p\002\221\251\252\363\020P\252\246I\2065\363\234\257\244\374*\320\216\343\235\030\325\"\322\214\347yS\345\233\020M\207Z\270h\321wB\204S\240\037\355\022&\211q\266YA0\213\227\013<\213S^\277P\335T\350\033\314!\370\361\206hhJ\022\205\320C\263#\033\237\352"
+	.string	"\022\032.\240\t\376!\225\243\267\323\354\007\333\206\264\307,51\017*\231h\r\240\267\315{J%\332\225\024^I\202\257\013}?\274\022\241:\334\225\315x\267\234\267\t\276\353\217S\264\320\373\230z\365\263\360\373)%N8\333\240\356\251\275H\022\301\021\031\331^\271#\362\217\353\332\220w\317\345@q)\373\264\312\026\363\353%_\366>\271#\325k\213\262\205\rK"
+	.ascii	"\377\3478}\244\020\210N\206\211b\327\3152)O\323\366I\035\212"
+	.ascii	"\032dq\222\335\3167\2150\376\370P\277\327\217\366\320\224CG\210"
+	.ascii	"\275\362R\311\221\024\027R\376\277\312'\004\031\312\336\004\361"
+	.ascii	"\363\321\324\326U\250\b\221\225\254\321\230l\200\343\257\371"
+	.ascii	"\232\203\312\356\205\035\303\275.\315\353\214T\210\"\213\213"
+	.ascii	"3\3607U"
+	.text
+	.section	.gnu.lto_cmsYieldDisplay.124.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375` \001e\r"
+	.string	"\246\031\\D"
+	.string	"\2216\035\363Y,\372(@\331\333'\252\276\237i\r?V\035\252}Lw B\t\313\r\253j\376\321K\035\b@\263\256M^\007\372#\001\024\020\314\307SC.\211\037\344\324\317\225\217\031Z\210\321&R\246\024G"
+	.string	"G"
+	.string	"G"
+	.ascii	"\016\277\271\036\261\017\270\036\355\3312\036\256l\001\021)\013"
+	.ascii	".6vwS\017\367niz\376Q\317>\260t\013\303\325\342"
+	.string	"\314\254\250\321\001\236\254M\n\210\357\250'\nh\312\004\260`w\235\037x\341\216\267\335\3006\003\373(\001\366[\376\354,\377\245i\325tj\372ZG\216\024\340[\300\354\246\254p\254Ld\021\302\3665\333\003\203\223\341Kxo!9\333\345\020C\001\366\350ay`8O\373#N\302;\013\205\013\330UQ\361\262\033\036\260\001\3541Z\362\207\212\206\205\345\245\366\004Q\376\263\307IK\376\t\225\213\257\324\314\274\250I\327\025\002*u\312\032\373.7A\362?\270\304$\377=\372&\327\343\225@*\303I\256\374\241\212y\261y\303\016K\251\035\354[\273\273V\225#\234\310\350\323\225\204`\006\371x<!\t@\020t\002\214:\316\001I4\250#\n\201\266\021\221Oh\003u\242\255\2631G\022\241\333F\034\327mZ\270W\321\310\234\250\311\252(2\346\233\221i\252\252\322T\320`\312\225\265\264%\204\362_\352\203\r\246\027"
+	.string	"0\005\275\213!34\030\301Z"
+	.ascii	".\304Ap\025\306D\021\263^\016\362fJ0\250J\"\256\355!@v\rh\206"
+	.ascii	"1@\370N\215\202c|\252iq\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_cmsHandleKey.125.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\326N\025\032\001z\330\331eJ\020\020\207\255\f\007k\001\025\303qB\230\bs\265\201\206>\322f\245\377\251)y\030\336\205"
+	.string	"*\273\233\006r\007)\007\276\375\003\354$7P\336\356"
+	.ascii	"P\\\256_\tL8\334\037\310M\270\030{\036*\210\261\177&ydo)\223"
+	.ascii	"\f\206\006\242\005\245\006\274\306dEmK\362*S\230\027\026AO`\253"
+	.ascii	"\0071gy\214\354\225\274\312\024\205\266@W\231\250\366\006@\325"
+	.ascii	"\226\267\b]W\271;H\313[\226\313\230\313\002-\r\232\221\341*\206"
+	.ascii	"dC\\n\326ue(wH\313\315e-<\306F\354\216\243\342\204\r\205I\314"
+	.ascii	"\323\003]\327\2651yu\351-\313\022\f:\330\362\362@\227\274\220"
+	.ascii	"\226\271\226\261\360\327\002-}y=y\373s\326\225\200\321S\320\n"
+	.ascii	"U\345\225'yu\t\ni\271\312\262\026o-E]i\023\230\274\272t\305V"
+	.ascii	"\022\br\002[\203\304\234\345\375A\327U.\216\037*\211{Omy~\320"
+	.ascii	"u\225\323CZ\226\262|\305Y\013\364b\006\254\262\274@+\022N\334"
+	.ascii	"\254\353\252&y\365\205\033\3222\325\362\013\034\345\305\033\024"
+	.ascii	"\2703\311\253/\352\270\212\004\030h\036\033\350\272\256o\311"
+	.ascii	"\253/\314\370\311\013/;\322\362\356\240/^@Zf.G\361\324\002\275"
+	.ascii	"\200\"\365\204\013\230\344\325\027[\fe\302\310)he\346\251r\203"
+	.ascii	"\226\274\252T\210\264\177\\^\371\311\017;m\033#\250\240\265j"
+	.ascii	"\252\214\233u]\307\222W\225\242Q\023A\353\234\365\2000Z\362\312"
+	.ascii	"x%\257*\321A\332#\356\035\355(\371*\265\272\300\226\027\367<"
+	.ascii	"#\217#\356\0275`\335\351QL\004!\002(H \370\212<\236\b\302\tf"
+	.ascii	"\024*\255\247\344U%\255<\347\363>\367s\303\037^\361\240-\317"
+	.ascii	"LI\354\017\by\\\226\311\253Jj\205\"\244+\331\215\274\263\264"
+	.ascii	"u]]\200\203\222\360\025k\375\223\306<\264\026\222W\225\354\364"
+	.ascii	"|O\223\023n\233\257X+\323y\313\353\302B\362\252Q\252\244\207"
+	.ascii	"g\371\374\311#s\302\223\207\222\324\235\005R\252\352\221\226"
+	.ascii	"\367\344\217\340\002%)\372`\303\373s\006.P\322\235\037gxc\334"
+	.ascii	"\320Y\240$\275\024\260\310\360^\200&\305\001.P\322\234\034  "
+	.ascii	"\230\217p\f\220\274\232\004\026\347~\013\224$\326\267\002P`#"
+	.ascii	"tEH^MRC\332\335\023b\344$\267J\001\nkL|K\\W7\013\\M\212\002g"
+	.ascii	"\201\222\262\366\210\f\226i\363 y\025\251\021i_\267\327[\240"
+	.ascii	"$'\031\326\257\f\025t]\327\005\256.\007\3116\177\303\002^\343"
+	.ascii	"\035\202\271\261\201\345\206\205:\350\333\260\260\013\364\273"
+	.ascii	"]\240=\362\272\375\232\306;L\364z[\327\025\350j\322,IW-\271\025"
+	.ascii	"\213C\330\340\340[\342\003\213H\314Ws\344i\226\220\220[\261\236"
+	.ascii	"f\007\347-q]\345\220\256n\005\311\253{\273#\273@W=\3546\331\243"
+	.ascii	"9\335\002!\331Az\fM_\251\326\257\211pR\002P\210\264{&I\320\352"
+	.ascii	"\\\177\325\006\247\005]W\271\005\256\256\004\311\253\273Hq\220"
+	.ascii	"R\336e\222\321\344f\224l\257\253W\324F\362*\022\033$\346\335"
+	.ascii	"\307\275L\223\313-\271\207u\325\362\347f]\345\220VE\362\352\312"
+	.ascii	"%ww\357\366\267&\333\304\"\352\351I\005\034\224)4\211\353*\247"
+	.ascii	"\024t\021\310\253|\020\310\253\275\345M\337\306e\334\305U\334"
+	.ascii	"\304E\334\3035\334?\353g\013\267\317B\227\317\022\356\236\325"
+	.ascii	"\263y\026\317>wp\357\254\235\025\334:\033\270\316\245\263s\026"
+	.ascii	"p\345\354\337\372m\337\306Y\276\205\263{;\303\352\255\f\233\267"
+	.ascii	"o\026o\335l\233e\263w\273f\325l\232\265\333\272\245\333\030\026"
+	.ascii	"\315\236\331\2715\2630\254\\\004\020\330x\300\201\006\030\250"
+	.ascii	"Ac\206\214\0300\230\226^(%!\271X\240\205\002,\0228Z\241\002\201"
+	.ascii	"\024(\214N\024\231(A\244\034\"!4BD\b\020\037<\004\035\320\301"
+	.ascii	"\200\002\2008lHj@\252is\323\336\351\333\310x\310\310\2738\346"
+	.ascii	"8\360bPT\374&&\306)\362\"\362\371\036\022\316\361\3415D;\216"
+	.ascii	"23\374\321\363\365\223gM\017o!\236o\237\247\030<\274\320,\307"
+	.ascii	"\001g\207\017\340\227P\316\030 \357\236\277\257\036?.\177\274"
+	.ascii	"y\250\034\207\333!\2368\337'\337V\034\336A8\337;m\276\340\360"
+	.ascii	"\332\341'\307\341&%x\367\255\263&\312\035o\240\232\257"
+	.string	"3M\226\032^:\216\007\021#\317n\252\315\224f\330\342wN\335\027\260\314S\035\257\234\270\357\037\034O\305\361\372\355\031\354cc\367\206\334\200\245\305.D\223\271\250a\373\334\276qJ4\231n#\232L2\274|!\232ac\276p\306\264\361\356\245&\002\345\200\371\3419\312\0253M\321\225E\315\351\274\360\316\240\207\306+C\336\035.\274o\316\276xge\274n\314\310x\333\334\371\342e\343u\267\246\213WM\232\013n\361\332q}\353\270F4\231Z\274tWF4\231Rxc\020\034\321dF\341E\003e\317\354\\\025\257\231\205!\360i\225&\363\t\257\\:\245\031F\365\bJ4\231TQ\206\240D\223\351\344\221m\004:\362\003\215\016p\270\312z\003\213g\300i\265\250\3105h$\322\341\3033\022/#q\017\307 \244\243\207a0\341\341\245\027\200G\261f5\310J\317'=S\2435+9\214\004\370\307."
+	.ascii	"\375x\001\247U_j\264\256k\013\005\370\230E\326\023\200\323\206"
+	.ascii	"\217\330|\005\233\253\270[\303\b\034\3169\312\232\225\032NA\367"
+	.ascii	"\n\302\026\357P]U9\n\243:>Q\206\213LH\351\035\305\232\025\034"
+	.ascii	"\227\350p\305|c\242\024\304\2255v\\\330\371\262\345\306\312*"
+	.ascii	"\037\352p\305\034\303$\272`\t\321d\276\020\207\021N\0322mqvo"
+	.ascii	"Z\345A\246\207Y|\313TWL\003\204R%+5^\356\264\362\222\006\361"
+	.ascii	"a\303\033\321\345\"\272\240q\210\024FTb\327\235Vgi\001\213Su"
+	.ascii	"\320\030\004\227\177Xa\306\036\322\025t\302\364\334i\305%Uz\371"
+	.ascii	"M\371\232U\031\007u!\343\003P4\261\276\336\341M\254\257\033\220"
+	.ascii	"\212\220\322\205\352N+\257\264\005\024\357\360kVX\270\200\264"
+	.ascii	"\205\227\337\224;\255\276R\021t\302\364|\315\252\213\201\212"
+	.ascii	"\374\346\002\323\\U9\007\2565\253-\336\320x\002\251\256\252<"
+	.ascii	"y\247\325\025\024kVZ\254\001\311\201W\233\271;i\256\252\\Mk\334"
+	.ascii	"\255m:\\M\245\032\326\242jQ\234\006\2055\276\323\030a\234\334"
+	.ascii	"u\270\202J\201\354\020\277\234\356\\u\305d\326pc]\327e\252+\254"
+	.ascii	"o\223\357r\240`\367@v' \n\034]\345\267\017y@\007\265\212Fj\215"
+	.ascii	"\311\3215\240\017h\244`\037.L\022\32545\205\274\332\241]\224"
+	.ascii	"i}1\200\317\016\021\204\005\264\001\321_\200\004\352\00264P\367"
+	.ascii	"\236<x6\264\bF,Ag\344:\240\305v \355\354\020\032\024\\A\366\347"
+	.ascii	"\211\243\273\004\313y7?\335\037\205\216oU\204>1\343:\300\\\326"
+	.ascii	"\277\353\375\233\246\252&(Q\355\264\307k.k\244\251\307\274>\036"
+	.ascii	"\373\375s\372y\255\356\221\362bn\223\024v*I\322\231\323\t<\343"
+	.ascii	"\336\234\303\0335'\336\325\2539\211~\356\372nn4\310xe\024\003"
+	.ascii	"\332\332!\331\200;\204\006\345\234\252\360\211\243\253\241\223"
+	.ascii	"\377\005Hdk\350Ky1\221\235\336M=\016.:\232\241Zd3\240\273\215"
+	.ascii	"\314\371A\361\342\246\255r\034\356S\262?\333\246+\"D\220W\323"
+	.ascii	"^Q\246\365\304"
+	.string	"\321\345\356\376\324\343\023G\263\030\316\216=n\241\347\353\026\031\327\211\267\205\255"
+	.ascii	"VlB\311\002\005\244a\317*Q\006\357\223 _\307y9\222\353*u\252"
+	.ascii	"\3454\374\246\311Jz%\007\362TW\271\232\260H\365Ya\b\007\216\203"
+	.ascii	"\006\300\272'E\271\rp^\360\357z\267)KS\030\324^\013\250\224\251"
+	.ascii	"\244\312bQ\217\013\3758\241\323\360\277k\217\037\026\322\205"
+	.ascii	"8$\336m\332\322T\306\247Z#f;\355\353\026\341^\300\275e\251-\266"
+	.ascii	"\310+A~\315\351~\262E7gX\332\2318i\213m\223]B\246Z\327u]\025"
+	.ascii	"\330\033N\354\270?\007b\205\361\351\026\333\315\201|\2330\367"
+	.ascii	"\204\342\305\335m\342\302u9\222\353\272\316X\216\201\351\232"
+	.ascii	"\320\366gW\267\311K\223\032\237\352\352\276I\ry\365=\242,\356"
+	.ascii	"\211\243\353\002\033\213E5\347\312\214\373\3057!\037\303m\200"
+	.ascii	"=1\343\236\356\034\350\360\240\212\205+3\356\3121\271\305v\337"
+	.ascii	"\321h\224\317\266\226]%/\253)y\331\213\222\227\273\244\274\214"
+	.ascii	"6\304\313gD\274\314E\311\313f)/\227}\316\227\263\\\206/w\275"
+	.ascii	"\357\313X\217\f\365\275#K}\337\370\306\357\031\025\271\352\373"
+	.ascii	"D\266\372\036\221\261\276?d'\337\033\372\341\256\357\013\331"
+	.ascii	"\353\373><\345{(!\207}\277\207\315\276\327\303`\337\347y2\333"
+	.ascii	"\367\203\034\346\373;|"
+	.string	"\366\275\035v\373\276\016\313}\037\310f\276wr\333\367t\224\274\237s<\337\003\376\035\361\336\357\320\357\373^\370=\337\377|\277\3673\337\353\021\361>o\210\367x\227\373\177w3\377\327\224\340}\232#\336\303\035\361\376\355\210\367nG\274's\304\3731G\274o;\342\275\230#\336\2079\342=\230#\336\263\035\361\376\313\021\357\327\216x\257\266\274O;\341\367^N\360\276\213\222\367hJ\336\237\245\274\3472\304{\263#\336\227\035\361\236\354\210\367[\216x?v\304{\261#\336k9\342}X\312\373\346\021\357\263\244\274\007;\342\375W\312{\257#\336c9\342}\327\021\357\271\216x\277\225\362\376\312\021\357\265R\336[9\342}\225\224\367TR\336OQ\362>\253\004\357\261R\360\376\252\210\367V'x/E\311\373(J\336CIy\377\202\n\336W\255\340=\325\n\336?Q\301{'+x?\245\202\367R*x\037\205"
+	.string	"\357\241T\360\236\271\202\367O+x\357\244\202\367\353\n\336&\025\274K\025\274M\020\340eR\304\273D\311\353\302\t^%J\336\004(y\021\220\362\266\220\2027I\n^$)x\217\244\3405\202\202\227\205\024\274ER\360\022I\301;$\005\257\020\024\274A\212xWP\362\036\340\004/\020%\257\nJ\336\024R^\024\206x\177\020\361\236@\304\353c\210\327\004\"\336\036C\274\006\030\342\345a\304[\302\020/\tD\274#\020\361\2120\304\033\002\021/\bC\274\037\f\361z`\304[\200\"\336\035J^\002(yu(y;Hy\0070\304\313A\021o\216\023\274\033(y5P\362f\220\344\305@\311\213C\311{\201\222\327\202$o\005'x)P\362\n@\311;A\312\033"
+	.string	"%/"
+	.ascii	"\224\274\022(yo(y#H\362B\240\344\265\241\344}@\311\353\200\222"
+	.ascii	"\267\201$/\003E\2745\224\2744\224\2743\224\2742R\336\030C\274"
+	.ascii	"06\3602\025\361.\235\340}\241\344UR\362&\245\274HE\274.\212x"
+	.ascii	"\0278\301\333\242\210W\201\023\274,\212x\023P\362\036\231\340"
+	.ascii	"]a\202W\305\020/\002*o\n%/\212!^#%\357\t%o\221\222\267\204\312"
+	.ascii	"Kd\202Wi\202wh\210\227\304\020\257\020\021\357\b%\257\b%o\b%"
+	.ascii	"\357\007\225\327\203\t\336 \023\274\007\250\274\035\206x\r \342"
+	.ascii	"-\200\210\027\250\004/\207!\336\rC\274I\"^\rD\274\310\224WU\362"
+	.ascii	"\246)o\017\3612\t\336\363\227\026r\346\002\317\300E\351;r\253"
+	.ascii	"\224h\343:G}\343\205\345\316f\316n\347\2663\3339\314\371\354"
+	.ascii	"lv\016;\203\235\273\316^\347)g\2533\326\271"
+	.string	"\352\354\344\fu\226\372\033\177<?\341\017\375\013\377?\377\234\237\357\357\373e\370\317\274h\367L\206H\313e\226a\340\271\005b:4\363\244K\234\344U\030L\271*(x\311\253L}H\313d\226\3378\316\017n\312\316n\320m\333\004=\201\255.\302\244\351\311\261\031\323f\317y\246\367\204)\ri\371\3132\030\026\263@Lja\332\342\330X\030A\005\255P\\\330K\362*S\025\244\345.\313i\001Q\212K4\2501,\035\234\331\177\3523\235\272\251\377\364\265\357$\226\036~m\322M\375\251\307\261+\003Xv\223-\351\237e\331\262p)\245c\f\362j\023.)t\211\306g\351d\351\245\007\362*\2231+\034\214QY\322\267\363_\271\363\017vcY9\226\354Y2v\265A\b\027:D\036\027\030\331\0245P\002\230\201\222\347\240\222\277\004\264\035A\004t\002\260\322@'\002Z\350\303 I\027\2226\322I\322"
+	.string	"\221\204\355\3418\322F\344\250\245\177G\272\232\214\304Y\272\261\020\246wA\221&\322B\272\310\227t\217H\273x\306\205\341Y0\244\205\200I\365\226b\206\344-\307\232\340\220W\205\214I\361\226nn\226dK8\037\310\253A\302\312T\020\006\267B\277\316\317%\370\017van\024\254\300f\205\2601\002\020q\200\026\261\346"
+	.string	"a_\324\302\324\346L"
+	.string	"\344\031f%"
+	.string	"@\322\330\001\261\013\243\242B\323\305\220B\253\260\226\236\231K\001\005\276\260,"
+	.string	"\3740sB\377\360\321=\372\2044\023\332\207\234\t<\272GT\002\0034\0179e\3228\003\230\331\301\303miW\202\343\r\022z\204&A\204\006\241G\b\241E\350O=\302\220\266-\321\204\320.\236q\0364\b\212\021|\320\036\314\245a\226h>H\331\226ov\354\233\312 \257z@\227\256-\355\324\2262,\325\374@^-@\027=\021!0\334\321w\376V\002\377\301\256\351\307\306\216\324\313\022qG\213(\353\363@\213\355\026\265\237\023\240\213"
+	.ascii	"S\264&'\002\364\210\347\263\331\307\345\247\273\007\273&\337"
+	.ascii	"\034'vt@GsI\315:h\035K\277\224,\335\322\001\007=\200T,\325\302"
+	.ascii	"\001_\023\317\2712c\00396\350\025\001,\252\235\2329\332E\031"
+	.ascii	"\234\223\201\rR\260\364k\203\026*\263k\272\325\320`\260\255\236"
+	.ascii	"Ak \306\251\206\271\212\322\340{\006}\347`\006\\\030p\320\023"
+	.ascii	"\026\235\321\203\267\240q\3305\325XP\r\227\214\013\332\202\273"
+	.ascii	"T\253\311\351\202%\324\2026)\225t\312\222\267%^\n\310\253\025"
+	.ascii	"t\3213\356\331\374R\325T\t\023\303\256\211%K\177\316O\005\354"
+	.ascii	"\211\031\rS\254%\242\213A\316\322+\350\374\203]\363\212s\365"
+	.ascii	"\360lZy\373\336\200AA\2241e\236\2551Q\220Z\245R(\210*:Wf\024"
+	.ascii	"@CI_\230\240\005\260LL\251\322'\023\004 \212\270\004\200'\t:"
+	.ascii	"\202\006@Z*%\201\237\027*\312\275\270\321\021\310\311K\241n<"
+	.ascii	"E\300\227:-\373 hA?\253\222\215.1\370@7\3206:\375\323\353\307"
+	.ascii	"\007\332\3053\256\353\242\177\216Y\207I-\266\016t\003}\347^7"
+	.ascii	"699\320.\312\342\232^P\222l\240\373\256j\353\211\243|\255\270"
+	.ascii	"\354\353\304\246(\313\277=\020\344U\006\272\350\031\027\355\373"
+	.ascii	"\342\026=HQ\276\032}9\377\025\300\177\250\213\3569\3259[z\\\324"
+	.ascii	"8\254\241\227\344\372\333Z\300\004\222\325\372t\337"
+	.string	"\020t\023H\032\315j\275<\245\305\344(`\02769\321\350\021\3172]\334Z\bI\327\265\031\301\371~\250\031\216\316h>\2042zF\225\326\223G\006\214\216\321m\370\034\204\321.\236q\321/9\370\177\217\263\f\244Z\306\352\272\250\032S\237\357\274\207\251O\314\t\322\275artCL)&*\026b\365\373\226\232\261ZhN\220\356\321\357\025(\016&\026*0\303\227\004\227\210KQ.\262\350\025\0268\370z/z\215\242\242I)8u\022x\321_\013t\276h!G\244\225\346\312\214\253\324s\224\234 \003\344\305'\265R#\367LMart\265\364\237\222\032\333}\355\267\024\\\336Y>\227O\344\325\244\336\360\346\t\251\333p\352\021\316#\343Q\213)A.\0235\250\021\214\256h\261\3458McJF\f\232 \3733\370h\250\302\217\323E\177\357I\300\340\374C\335c\037\004\020\221.\364\\"
+	.ascii	"\212\375u\217\177)\006\037\371\234+3\352\230\301\2712\243\336"
+	.ascii	"\025<\024h\276ls\256\013\264\350\325\001\026\365f\201>z\024c"
+	.ascii	"t\302\356-\334\264i\001\246\353\247\273\207\272\307/E-\266\313"
+	.ascii	"\203\217W\004\313\376L\254\037\222\273\372k\\\367h\205\273\372"
+	.ascii	"2\340`\005\372w\275,\232\273\272\t,J\315\022Q\201\226Q\246\367"
+	.ascii	"\017u\217T\376\264\341+\321b\3330\374k\372v\346\236@r`\340\020"
+	.ascii	"-\371 Y\364\233sx\240xqO\327-\371\354\262O\323-\375\\e\321\""
+	.ascii	"\312\342\236\036\263\232\177\335\343\225\262\377\210\260$\321"
+	.ascii	"y\275N\240u\200I\265\223a\317-\021\023h\244\262\270:F\304.\223"
+	.ascii	"\2437\224\2769\367\034d4\354\257/)\234\343\304\216Ab\310\200"
+	.ascii	"!!\267\204w\324\342\325\345\341&\220p\333qK\310\002\215\326\001"
+	.ascii	"d\266\335:\344\221\265-\341\t>Z\006\334\004\022\314v\030 \274"
+	.ascii	"\306\265\355/\034\360\340x\331N\333\360\227v\266\215\226\214"
+	.ascii	"R\251\346\274\265\225m\233iX3\266\275\005\331%l[\213Z\306I\332"
+	.ascii	"\n\006\266\235%\205SL[W,\333^\r\266\226\271\222\326[\333\\K\230"
+	.ascii	"\\W\247{\361M \257\242\270\261\326)C\006]\301V\005\256\356\262"
+	.ascii	"\232\335%\374\275\216\372l+\031?\266\025&2\034\365\001eq}\364"
+	.ascii	"\372gVt\212\276^\333P\321+\232\357\020h\025\375\246\262#\331"
+	.ascii	"S\020\350\242g\\c\245\350\020O\255\247\277\353\271A\334\022\032"
+	.ascii	"<\2126a\356/\212\242\233\005\343^\324\b\243\226\322QN\264Q\277"
+	.ascii	"p\242W\224i\305\251\351\233\203v\307g\315h\314\245\371L\317\331"
+	.ascii	"\254\231\313\3356I\351'\355\204\315\356\316\341\215\333\232\253"
+	.ascii	"Yij\340btEE\021\301\213/\321\354\354(\n\226\212@j\207"
+	.string	"P1\reA\211\276\034ewh\"\366\363\241V6\tC\022=\324J\275\263\321S\204\n\321\364\035H\022m\244\235z%\3018\006\204\320\343\016!\307\021-\3648\242\323;)/&G\301\b\021N!~\270s\003\272\200\27099P\274\370\225c\236E[Z\226\007\023\310\017md\356\217\023\353BX*6\336a\235K\355.'\".\035\215\240\344\326\253\007\234H\0220'\356\365|\317\222\221\021\227\216\251\334z\365\2674ro\354L^u`w\031e\303&\247\344\272B\315X\326\033\241\211\231\\\327\365gW?t\004A\335\241=\364\245\330\230\001H\206\374\020\362#\310\017\rL0b0\311`\252\261\304\300\322\013\246%\246\0302f\320x\261\304\264\244\001\306Rr\006\215\032\f0\301\210\201\004\205\037Ax e Q!\005 FxhX\025\222\216\2440\004\b\022$?\216(\371@a\350\310\215\364h\241\207"
+	.string	"\021\322\t\350!\244\213\374@r$5\362\003\311\020 D8\370\221$H\217\026\n0\202\244H\373\030\222\004\2054H\217\026:H\217\026\220\3740\202\374\341cH\017$G\206"
+	.string	"I\036\371a\244\213\\\311\217\025z\031\350\001\003\306\t2\030XJ:@I\217 E\216"
+	.ascii	"\231\240Hr}$\035\021\342C\351\210\020\037JC\200\364\020\242\344"
+	.ascii	"\303\310\021\245$\021K\244\310\017#JH\210\0201\242\004\264\273"
+	.ascii	"+\367\364\326\262\032\362\016\221\215\346\247\373\00608\256\251"
+	.ascii	"6\315g\376\264\24757s\3671\234\2311]\327ue\322\305\f\2315\006"
+	.ascii	"\270\244\313\231\271.fh\r\203\334Y\037\215L\215\203;\353\ro\314"
+	.ascii	"\372\\T\267\035*\0313\263/W\376\303\337p!\001\257\323\034w\241"
+	.ascii	"?*\274.\b\370[\037\316Lk\206\231\025'\\s\333y\314\325\244\222"
+	.ascii	"\026C&\240\265,\267\360\300\346\271\253e\310$\271\263\377\326"
+	.ascii	"Uu\372om\003\017\021c\235f\267:\035DP\n\352\366\326\fw\216{\216"
+	.ascii	",\004\264\030\267\320Z6\260\357l%\302\021\216\201\315r\201\375"
+	.ascii	"\301\036)(\\\323\331l\346FO\367\322w6\016C)/\346\334sD\343\314"
+	.ascii	"\250\320in\373\255\210a\"\267m\\\f.\033:\235\376\2159\210\247"
+	.ascii	"Y\226X4\311\221\2275\257]\210\220\252L\234\221\223\351\273-*"
+	.ascii	">\233\317\334\372\317f4$GX8Y"
+	.string	"\263\230\"\277\323'C\246_V\326.8JA\237\330\313\211\366\374\220iV;\257=\307\227\021\026\356\364\311:\306`\237\254K\320\223\202\0166\263\r\336i\016\263\245\177\2471\020\224\362b\332\351oi\r\376\244\240b\326\020\3554\237\251lL\344\006\220D\326$\212\274z;\235\032\242\031\206\365)2\344c\315c\027\272C\005\307F\310\333\372c\374\372\b\233\301\306\364\t\233\263\020\031\022\344b\315\\\256\342\221Y\341z\372mm\375\261\206\200\314\236\376X\273pW\364eOs\330\236\026b\330\327\326,v\036{\016.!A\364\364\305:\206X\223`(\005\305\322\\\231\354#\304\200\320\323\323l\246\245\257\2471\320\223\362b\346\351ki\r\356\244\240\\\336\201\2251\276<\315`?W!\0239\035H\203y:\335\223e/K\336\n@\036\326\274u!B*79*<L_L\034\r8?\315S\304\364\3754S9"
+	.ascii	"\220\326\262\234\302\2634\177]\305[D\341}\372a\272*L?\254!(\234"
+	.ascii	"\223\323\354\207\245\3517\233\267\316\213\216S\217\321\247)*"
+	.ascii	"\303\305\244.\001\266r\242=?a\232\257\234\267\236\343K\205\024"
+	.ascii	"\372\364\263t\f\260~\226\302>X\227\240'\004\246\260\271\253\260"
+	.ascii	"A0\344\353\323\354\365\325\357\323\030\bz\365\277\240}\257\326"
+	.ascii	"\340o\352\361\353\035pm\271A\233\247\374X\362\230\3105%A;5\244"
+	.ascii	"2\346\013\f\n'\034Ks\224\013\265I3\206\320\307\331\372`\322f"
+	.ascii	"<\277\024\233\235\200\351+6?\371qBkY6\341]\315YW\341\310\364"
+	.ascii	"\370a\237\255\253\330\372X\372\201\30799\211},MD\220\250\257"
+	.ascii	"\231\330\\u\243\247\304^Ap\352\361\n[3\224s\224o\300\350\303"
+	.ascii	"\204\303~W+uA\354w\365\bh\244\240~\020\233\255\020\373\0034j"
+	.ascii	"\207\315X\\\375\303\306q'\345\3054\354s5\006\216R\320\254\347"
+	.ascii	"0\214\262\005\213a\263\223\377J\312\306Dn\007\022\231a\247\202"
+	.ascii	"U[O\016\342\271\205K\305\362\037\376\303s\213\225\036-\266\314"
+	.ascii	"\343[\315O\027\232!\215\230\307\022\276\326\377\322U\273\337"
+	.ascii	"\202U4H\243L\353\271\345\312\371\330o\274\321\227\376c\337\361"
+	.ascii	"!\356\244\344<q4i\200\026C\362h-\313$\\\253y\352*\334\342\bo"
+	.ascii	"\354\257u\325Z\177\253m\204\231\223"
+	.ascii	"s\245\277\305\241\177\245\371\351\234\250G\002\362}\315\201\b"
+	.ascii	"\221\311\244\316D\362\321\023e)\325\326\232\235\316O\337 \n\366"
+	.ascii	"\304\214i\t-\306n\270`\221\320Z\032\373Z\255\0247\347g\245\257"
+	.ascii	"\345\330\267\322#\b\216`tl\206\272\321\223c\177\360\007\002L"
+	.ascii	"\263\261Y\352FO\215\215\203J\277J\237Jgp7\3658\365\034\212\315"
+	.ascii	"\247\253\177\315\347X\324\311\330o\\\216\303DN\t\322 c\247{\252"
+	.ascii	"\266\034\017\3429\346\250r\235\237c\212\007\233!l\204\026[\023"
+	.ascii	"Tb\242\204\360\277\026J\003\206\020\204\253\365\275t\325\330"
+	.ascii	"\266\226\250\226\355,\211\315m\257'\3306W\034\257e\306<5j\327"
+	.ascii	"\266\241\023[\336\033t]\325\255 7k\231"
+	.string	"\233UnU\340*{i\022\374\270{\305\377\360\357J#&\255\341\316]\232\275\354\322I\325R\2550q\263d.\b\310\253\334\245\277\346\031\307x\n\262\232\377\222\352\232\242\346G\021\021\260\217\247\311\324\362\t\237\352\200\3751`P\355d\350\245O\370\275\361\304\214+\302\337_\267\236Ta\037;dZ!\264\330\262\007\333\346\353.C\255\353\023\002Bi\300\020~p\277\276ZW\001\252\365\tS\020\246\364\375\232\035\245\240Y\375)\235\336\245kh\214\03749!\237\325\217\253R\261\232\234\262Z\305__\037\252D\312\362\252\257\217\257_\330\002\177\257w\227T\226V\370T\347\353s\201\331\215\3619\277\327\377s\204\217\325\273K\256%\026>\325\367\372\252\217\325*\232\251\307/\025\312R\214\372B\0239\313,\036 \257\376\252i\3549\255\372\206?\226\303\177\260\033\323s&\353\364\031zp+\225j\211h\2257\306n\f\257"
+	.ascii	"\227\362\034\023\263\343RT'\352\224\22410\217\322Q*\324\241\364"
+	.ascii	"\2434\261\243>\251N\207\362\027\306\276\020\240\252\251\372U"
+	.ascii	"\375\251\307'TiN\372O\036\235<\252?\325\237z\034\373\322\321"
+	.ascii	"b{\251~T\337\031\2266.\313\244\232\034\352\b\205\347\250CA\305"
+	.ascii	"\271l\252\246\031C#\"3\243I\2224\0063\031 \b\003\323@\025\025"
+	.ascii	"\321\003\023\200\004\f\2532\232&G5CB\"\243I\n\035\212s\337\332"
+	.ascii	"E\343\226\256\005T\017\211W\306k\006\337;\207\312$<\027\245|"
+	.ascii	"\343\205\314?\235\222\007\375\223\\=5\250\275VE{u\213\017|\211"
+	.ascii	"_:_ \003Z\277\260\217\332x\031q2\210(F\177\343\306 \365\323d"
+	.ascii	"\211]&\177/\353A\2324\254\353\206iq!\225#\300\343"
+	.string	"I\311\355V\332?\222do\211\234\351\217\263\263\252\226i\247B1\201\232\314\357\255'\027\333\004u%!\2575\"Jg\360\322\243t&\247\021\017\341&\213]4\233zTT\026\361,\255\265\2156\004T\350\220\321fg\355X\260\311>\343\323\337MN\236~\321,\345\357E\254\331\324\255\304\211\203{}\222\220\355\201 \306QR\315\0317yPS\226K\237\251Y6\364\260\261\302<N\005\020\200\376\310i\270\351\320MN\275Z\364\\\376[J\330@\017\270\313\272\177\254\256\376\020\320\362\250p\3046\rL<\026\304\212\225\202\277\024\236\366\006*V\031\311i$oM\266\366\337\250n\262T`\\\360\033\261\204\302\200E\036\242FvQ\223d\377\364L{D\252\027\347A\033i\324\343Jq\32657M\257\307\\z\013Y\005\345j\210\262P|D\230\2267\351w:\346\007\277.\331\266xl\373\021\276J\374\337\232]("
+	.string	"7\262`X\214\221}\235\n\241\035\220S{"
+	.string	"\r\210\225]\335\327I\226\025L\225<\2128\375\222\220%\371\b\243\307\240\320q\013\033<\321\006&~\350\257T\200\024\376\350\210,\374%\211\356\013!\310\t\006x\264\201T\357Y/\267|\231\024\342\204vW\265\333I\027\205\231\270!\233\333\222\301\006\305A\312p\202\221\340\253\226v\265\r\006\221\344\276\260F\323.\336\b\271D\310\031QOK\245\f\030\324\240\360\226\022m\003\304/g\244y\273\272t\221\276\202Z\b\256\217e{\264\332\360\013\205k\217\361\364=M\005\316f\030\275tvGx\f\223Av\007\345\271\016l\\C\002V\323\331\377\203(\366\370\\\240'\364\262\321\207\202Q\361\250\213\341<\246\330\003\274\365\033q\350\356d~\245\351s\035a"
+	.string	";\363\355\357,w\266\254\007\342\333\211\336X\274\242n\346\327\353\354"
+	.string	"\202u\216k\375\026\020\250M\262\\H\363^\362\177{\017=\254ixy\327\356\002\342\305\344.\245S\034\353\226\251Ks\352\201g\327\223[\262\267\214\320\300\376\377\343)uK\347<4\223\251\377\306.\t7\355\005\3113\200\022\232\336\221\261\202\016E\230\2715~0\256Y4"
+	.string	"\206\272\253\356_\001\023\310\332\ts\241\346d\f\177\003e\231e\376\225\340\265o\360'\r5\367"
+	.string	"\366I~Y\201\205\221\255\035^\037\304\310\327yKhk\230\202\376$1\034&'RH.\226\3305\330`\373\002\327\260\034\302\312V\246\214\023\254\037\320xC\310\230\215\252\023\353\370fx*^\003vAVG\303\255\324\377\341n\333l\3731\242\334\345AD\277;\374\223\367\327\217\311O\352\251\375CP\226B\311p<\013"
+	.string	"\270\357\336xl\231\020\241~\332=\231\242\325(a\275\244fxi(-\260u\310\340\266\005\327\260\234\004\225W\255\322\013\312\"\314\312_\247\235\020!ss\352\202\016\3726\217\342\013\300&\312S\203q\007\362\n\013\214o*0\001\3102S]\352\377f1\341\3409P\b\357/\377gQ\252\314\020\201\036]c\337\005\3405\2661\373\376:>\257\246\324\303i\241id_\217s\\\373\024eoD,\244\r\264\2615\255\334\200\3738)<\211\344\036>\212\317\232Tx\242\360\301\374T\370<\266\232^\206\333\3530\035\325\243\350`\001Z\233\231\372\242\367\311\270X\335$P=\362\316\344p\317\371\334\203$\257\342\331\307>\355K\021:B\350a=\nE\303|LU\351\370\377$\253'\214#\024\215^o\t\021\2100\227\257\356\016\026,\177\201[\304\330U\036zt"
+	.string	"(\250n"
+	.ascii	"\247\017\023\257:G\370%;8Zo\344{\366\365~P\364\270\307\243*a"
+	.ascii	"\255JH\227z5\214\002\002\2163\224\337\006\246[oOp.\232\301\346"
+	.ascii	"\362\3075\365\340g\310m1e\225n[do\211R\247\274\236\331\266\243"
+	.ascii	"@\266H\223\220\020\030\327"
+	.string	"\355U4\225O\313:\2675\272\005:\020\344G\026\352v\346`%\366\321!S\354}k3\275\304J_\2003fs\315\267\037\013\300C\204<\246/Rk\b\360\022|.8jn\322\017\300\246\367\271x\004\276\375\035z\034N\020\367U\372|\365h\002\352\033\306\323\240\231KxK\243\366\303t\216C8!s\265_\320\002b\352\342\204/\312^Ke\242\203\024\"x\003U\335\\25\n\244\340\266(\007\222qt\221V\275\302\"#\2009\tM:\016l\247\313\001\020|\210k\206\326g\261\272w\321\250b\220\335\333zBB\3110\372\006\370;\030^\334\213\267y\336a\005N\350\026\204\224V\013X\t<\234r\320\032s\351\021\312\277\225\322B\272\266\025\032\316\244h-\036s\347\305\003\020\360\317\356\004\230e\021r\256\004s\246W\254N\250\323\245\307\330\204UA]\343\325\205|\225\301\3103\301\271*\020\270\240D="
+	.ascii	"\362\240\013C[\322z \255\346W\234\251\227\242\311\362(P\275\\"
+	.ascii	"\254\323Op\324\032@=S4\003\260"
+	.string	"\347\216\326\247\365\002\230\377\023\367\351\251\374\355\266\001\226\345\327\250\t\245\241\304\254b\242\277\"&\003D\350@X\273\344\265\207\236\331\326\252\241\362(G\324\017\026b\242!A\232\013o7\202n\247\232dh\304\223Plb\232\265\232\017\013\243\305\022\321?&\355\357`\203\251\022{\334\343&\307EZ\n\002\317\367\227\b\327\315Rg2\032\325\3372\367?\221\030\277ll0\237}\345\373\226\314 \244f_\247\\\200B\006\303\375\235c)_\200p\270\262\217\375\316\301\"\361 C\030\\\237\246\277n\272\247\033\035\323\221\233*\\\235@\216\213\356o\375\220|/\007\264x\367rR\032OCt\261\356\2554\2631\270\350\356\263\033b\3220\\\201lv\n\033\224\255jf\352\251C\f1\216\217BG\305\002\224$\242\317\005\244\265n\317<z\366\t\346g}\265@\253\342A\244\234a\347\333\346"
+	.string	"\330\245I\311z\361\017\311\244Q\007\274)\257\230B\353\330\352\201\316\213\232\236cI\020l\221\337\3325{\2213;\344W\0248\375\353L\354\221a\177\363J \227\312\303\306\242q\245\005"
+	.string	"\305\235<.F\245$\200\n\224\356]R\331\234c\231\304\260\nV\344\261\025\347\346\252\3323\033O=z\373ci\331\b\353\205\247\236\270\320[\016\201@\353\214\212\244\276\230\327\363W&\346 *x\362\340`\317\345\266R.\326\237)\bOJ\346\020\232\253\236\003\006\375Qp*QK\225P\007\262\27398\003\217%\260'x+\034\376\374\r"
+	.string	"\207\222\036\272(BBck\361/m\021\235\227\t\027\305\031/\353\033\256\266\350\317=7\327\212\2473\177\030\255\253\345\301V)\374\020\376\232\233\374S\005\252\207\307\207\336\247znD\303\030\200\246\350^\260\030\311\336N\226\206\212\033\240\315\272\220\302\214\312f\006\201f\177\366\004\024\006*Y\216\215\022\033x\2669-\357\352`\251\270\226\221Uh\253\334\t\026\025\236\236\006g.\301"
+	.string	"\002\223\255z^S\363w\366Z\032"
+	.ascii	"\2509ay\310{\210\227h\262\276\203\236\300f\235[\037\364\273&"
+	.ascii	"\251@\231\240Q\031\355\257\272\260\241\254\316\225\032~2\265"
+	.ascii	"\251?\314h\376\262\377\362n"
+	.string	"*\032\251\311\272\351F\344\234\232mZ\340:\310!\025V\315\363V\247>\005\005\252\303G~\366\021\032\241'\374\271\n\331U5\033\317\325KB<^\332/K\376\315bK\372\271\220\365\3131\314g\007\037\243\201\303\027e\220\005)\f@\203\354*\250o^$\023\"\321\267\212\372\274\274Ee\212\256\376\362l\022\001\346\b\2418\311\376\to\364\212\363\223\2747\276z\207\315\007\016\352'L\300\367A7\t;\312'\023\032\001\321\025s\037.#\234\276t\346:\3124g\377\206\370\333\232\256\344\230\367W\302]\274\223/\317\344\307\237\227\277\002\277\007\252\335h\245\354&\033\002\217a\243\320+\3133\264\213{\375\204\230\376{'\007b\255\202&\001\370\342\240*\025\212s\331\241\003\346\336\330\341\300\304\376A\227+\300j\027:\344\366d\t\237c\336\231\223\352\374\241\222=\302\334\251\344\315a4O\324\3445\210\022\205\277E\233\324"
+	.ascii	"\306\242!\360\237\033\034c\316\020\005Nm8g\211^yi\022\001[f\275"
+	.ascii	"\203\027\300c\310\002\001\213q\370\260\336\315U\212\244==\fq"
+	.ascii	"7\271m\253\1777\216\221\35315\2651Oz\2352C\n-\326\023\364A\375"
+	.ascii	"\343%H\271\006\223,\237*\267\366\360\300\303\347\262r\216\244"
+	.ascii	"\227U\225@[\207\325\261\225\020E\276{z\304\006*\326b\330\360"
+	.ascii	"N\350P4\244x\264\027\023H.\322\302 \033\262\347'm\372\310\264"
+	.ascii	"\265\343\035\020\242<\231y\353\n]Or\371\f\035\tA\317\216}\337"
+	.ascii	"\366\331\213\360F@\203;\034\332F\243\322\215\240\203rD\211\f"
+	.ascii	"\224\\\372\214\313L\320\270w\0213A\272"
+	.text
+	.section	.gnu.lto_cmsSetExternKey.126.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"\235\n"
+	.string	"\206\023H> \345*\035"
+	.string	"\234G\200\035'\200\001\202 C\031\315\310`\365\324\344,"
+	.string	"-\020m\226\001\361\335\266\206\255\204\233\267\263A\244\003\020\214\213\t=\3511\021%@\201\01608\340\352F\366\336;\2454"
+	.string	"5"
+	.string	"3"
+	.string	"#\311\036\310\3340p\002v\027\234#\017O\247\f}\215h\023\023[\247\034\237\004\"\214vv\367\267\313\f\361%\245F\264\273\2261Qv\327\333~\260\355`\037!R\372\336w\002@\366Z\313\256\306\256\300\346jL\211\355sl\217\311\302\245}\224\247\204\267\261\274\331\rq\201\331\035=N\030x\355\374\363^\351\r\274W\207v\200\007\255i\226\367\031\301\242\203\311\001\366U\276\302\362k\266X\311\307^\375\225\367\372\371\351>\\rg\005\332\306\314J\002\366\330\222S\304>\335\335\365\234\331\267\3754\016\215@ \211\206\020\303\247`U\202P]\224<\223>)\023\t\244\230\030\231@\022*\005~>\237*J(Pu:\241@\316\270\247;g\336\320<r\256\371\242t\342>\035\310_h\035rw\003\023"
+	.ascii	"1\305\277\2131\023/\210\3025\030v\307\313\252\352\006\253\020"
+	.ascii	"\202\207\022,\201\252$\342\232\033\002\274\313(\326j4p\227\200"
+	.ascii	"\001\213*\267]E\017"
+	.text
+	.section	.gnu.lto_cmsHandleKeyWithRepeat.127.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`e\002\325\024"
+	.string	"\206'\212J\300\360*\035\372\210\372m\344\360\027\235Pd\371o\311\366'f\310\035\"\262\206\2477M\3218\374\276\034\365\315\225\353\350\376\225\366X\327\254\336L\362\262\b\n\373M)b\272\252\375.*;\t\"\021\224\224+}Ti\021\331r'\031u"
+	.string	"v"
+	.string	"n"
+	.string	"@\037\021\273\031\341\002\272sb\240\3506\311% >\\S<\210\207\210\255L\304F\233\211\374\214h\204\224\272\315\324\307AL\017\351\007\230\036\262\206=\235\347y\276\232\337Je\017+S\331\236\367\004\266\235\032en\366\260\236l8\236"
+	.string	"9[E\t\002\217\356;\275\345j\264\366\330\234\357{\250\263\203T\346lNO+\335\275\264\314\325|M\337]\b\273\313`\227\342\002t\017"
+	.string	"\344gF\315;\234\335\270\363F\273\b\217<\274\367\357NwO^ o\364\242\221\304\340\353\355\257\366\256\345\267\342Cw/\020\037~_\024\033I\n\344\356y\337\311\336e\277\225~*\200\335\346\310\303U \2223\242\275\211\013\305>\264\277[\020S\374N"
+	.ascii	"\273\233\\\004\342\303\220JB\203\254\364%\366\300I\354A3\377"
+	.ascii	"\350\032\214RE|H\"\203\244\364$\366\001\274B\243K\257\335\335"
+	.ascii	"\025\305\357\221\234\031\305\237\220\241F\317\2556t>c\310\211"
+	.ascii	"\236;x\367%C_\216\034b\343\331\212|>\016\232\0344z\356y\272\037"
+	.ascii	"f\"$[\216w\344\357\335\367\352\203\323>\227\231\276\273\312\r"
+	.ascii	"\215.m\001]\317\213\246K\273\346\214\262\316\356Q6\004\201\313"
+	.ascii	"9\273\250\361\346\337\361\240_<}\3507\275\367\345\357\276\264"
+	.ascii	"\006/\207\255\\\f\213\221a\261\300T\253\326\3125\316\254\034"
+	.ascii	"\360\246\250LL\032\234\244\030(\361\230Q=h\275^ZZ\342\272\224"
+	.ascii	"\274`\\R1/*\230\224\213\353\225*\001YVk\345J\301X,Wj4\373\265"
+	.ascii	"R>\361\215Snh\\[\016:\021!\353lG\220Q\354Q&\361\320\2213\337"
+	.ascii	"\356\373qEI@<\362y?\256L\252@ot\312\267\335]\0233\263\260\220"
+	.ascii	"@\203-p(\323\245\345/ `\002!\223\222\033c\344\3771LE\363\023"
+	.ascii	"<\322L\240\314\324\265\206\036\310\301\016\207\r6\f!\246\215"
+	.ascii	"\230\246\225\362F\016qo\364\275\\F\343K\\A\264exiag.n\3644\365"
+	.ascii	"j\230\t0\177b\203\324\006n\257\253\374\222\3540\226\3634\255"
+	.ascii	"/00\341\336\345\324\230G\360m\207\220\260E\3033\371f\205\305"
+	.ascii	":\036\020\"\246\313<\001"
+	.text
+	.section	.gnu.lto_cmsScanKeys.128.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\341\020\265O"
+	.ascii	"\232\202\300\034S@\020\322I\007\367\213\321#\226\334\030\210"
+	.ascii	"\222,\315\320\271\310\017\020)\255\35232'\027/JL\244\214r\245"
+	.ascii	"\314\207\033km\331\220Y\234\253\320\032\255\023\332\335\033\260"
+	.ascii	"\317\242\003\003U\036\257\217\354\347i-_\204\263\310\033o\263"
+	.ascii	"E\307]\323\327\255\021B\244L2\274\001\207\001\273\001,\214O\253"
+	.ascii	"\242\240\016?\020\333\275z\224\fd*\263\336k\205e\263\250y\324"
+	.ascii	"\343K\331?9\024\343\243dPA\275\b@\226N\350\216\256\323\231oE"
+	.ascii	"\217\243\263=\207\275\223\023\234\030\257\303.\317\332D\201%"
+	.ascii	"\225!\265\326&\337\321}\016F\340\321\025 \034\355~\315x5\034"
+	.ascii	"\257\310\372\312e9e\002\337\321\357^\355\231,\260H\207\243#\026"
+	.ascii	"WO\253"
+	.string	"z\315\252\033dY\332\321\325z\006\300\321\255\341+B\341\350\344/\261b\231\212\245\203\fJ\255u\305\306\350\272\001/\001\337\321\"\254#\346\335'\271\222\253\237q\260\277Z\303\330\240\324z\266bM\370\216\026\317\327\360#W\213ch\307\361hb\331\324\302\201K\255gF2'\246G\3715\351\321fa{yyyy?\317\2767\214\343BAE\240\037\237\036\236\035\235\034\234\033\242M\r\315\214\314P\030\214\001\302\374|\275\024=\233q\354{Ig\02126\035B\254y\345\270P\220\0215.\0329\220\022\376i\222\204}\220\274\007\311\021\346\371q\355;Fj`\035\0328\247\b\343\234\275\035\\\3123\273\312\316\002\274\320Iy\234\013|\023\204\207\362\304^R\334\321\244\013P\216t\t\343\241\274\315\032\031\327\320\234;`q#\234\3315v\236\260\242\002\021g\362 \263\256\026x&HF\310\207?\204`\301\024bP"
+	.string	"\372\2009\263\353\204\237\030\373n\326\365\305=-NO\"\272(Z\210\\J$\320+\213\321\263\310\354\352\001\364\332\301g/)\214\307\332[\350\205u\026k\255gr\336\362\322\301\334K\252\265.#\275x|K|\227\305vW\203]\241\f\001\375\241t\027\306\022\037\2116\002@\260:\307^M)\302\331I+\277B\274\222\345\230\007\243\277\344\305#\333\355\3310\232\345\264\360r\230\273{w\006\r>\362\354\342\216\316\261\373\037\016D\006\02001\365\317\250\271\317\3444Eh\341\035\363n#}\033\365\262\326\227\016\316\333\253\215\3351\337[#}W\2006\004\026{\331\375\334\253\324\330\223\255\004\023\360\221\023\244G\337\304\346\327\221\363V\305\230\035\363U\351\323~"
+	.ascii	"\220\243\026*\037\233\302\3445\271!]\352*\333\355\236\351\340"
+	.ascii	"N\356\276\267W\330ez\3327\002\0323\016\367\225\021\343o_\007"
+	.ascii	"\226w\t\306\213\237\375\f\374\206\337E\213\244"
+	.string	"/\371\221\200\274F_\362%:yU\234\274C'o\212\223\027\305\311{\342\3445q\362\2268y\205N\336\240\223\267x\362\002\235\274?'\257\317\311\333#\303\313\323\343\3359yuN\336\234!/\316\220\367f\310K\034\362\332\fykN^\232\223w&\310+\023\344\035\006y\205A\336`\2207&\310\013\024\362\302\by\177A^_\220\267\027\344M\203\274h\f\357\331\343\355\223\227\201\274\257q3#\\!\360\270\322\255V\256\274/\265\n*\245\354o?\334\237v\030\376\261\217\323\335\357\331\016\267\217[\340^\375mOe\257\214o\262\337\341\313O\231\032\233+rUy\324{\260\"\207\033\017\273|\227\257m\311FWk\205\362\265Y%qt\362\333\366(/\036e\364\214\263\313\030\021f\214\376\333\213G\326\351\235\336\277\305h$ ;:\307\f\314\332bl=@ \036.\356'\2210\025cD\230\025G\372\267#"
+	.string	"\344H\345\0272\366\302\224\317D\031\363\341CN\337\355\314v\313\324o\373&\355\364\245p\t;\375\373bj\235\021r\272\247\371uG"
+	.string	"\222\"b6W\3321\353^\361B\367\244\346\005N\277\270ib\343 \365M_\013\317\246k\232\330\317\032\302@\333\364]tM\363\235\026\336O\311\205YM\330\301UFs\312D\320\302\265\271$\303\313\235\251\267\254R\244-3\235\\\030,A\300p\026\260\203\304\234iA\024\211 \204\275W\2450X\202\370\322W\2456kX\330~\177U\032Ao\355\3224\362\310\272\242\3174M?\013\254\203\231\3765\225X\316\252\310 \003@\326\005bpXQ=oE_\316\301\307]Jm\333\266\245Gq\256dyS\351\306\3443j\312\035\230U\356IG\244\037M\2062G\310\324\260xJ\274\204\303\276\362\210\017g\340<1\254\240\360\313\2050\374<H\243\213\t\366\225\373\2414\370\203G\211\021Z@\272\307\310\305\370\330\035Z"
+	.string	"\273\203\351$\022\007\366\225u\007\266\004l\203\322\204/6t\301\372)\2450}\023\206\326<\257\224\376\032\246\277O\342Z\224\026p\341\"=\372k\316r\246_@\320\342\013\362p\253\324\327C#\320z\270\257{y\035\344\342\243\210\336\317\312\255\322^\007\231\374\241\264\327i\027&\002\213\033!\355\344\006\227\267J\323\356 hr\037\342i\377\355\265\326\212vr\177\314[\245hO\241\365\300\303\001T\030TI)Q5=\335x\232\002Z5A\3350\332P\340\206\317\306\251\236\246\332\352\351\2026.Y5A=)\3404\3653.Y\360\004\005\325\244Del\202\212Y\003\232\006\030\300\002\026\006\b\020\300\320\270\364\024e\343\001*\f\236\246\246\252\234\202\353\024\2001\312\311\b\003\033MQFNSF\243"
+	.ascii	"\210+u\343i\312\210JJj\312\bxv|\257\260?\342\226D\353\tN"
+	.string	"R\237\b\2679\255';-\032\330\022DNR\357Y\203\3248k[\330h^\364\311\226xZO\032F\023-u\361\330:\226\250\227\372@\\\210\031\rD}\n\201\305`\346#\b\354*\314z0\315\242\212@\326\ru\212V1d\250\221\232_(\272\247S(Q4\213\246\031\t\305N\222\025]\311\322,\313#\363:\001\250\223\033\344'\372uhw\314\023\335BMR\311\034\262\316D\227\350\023}\261(\023\335\323D\205\272D\247@d\031\t\352\236\026J\006\365Q\030\303\243\341\253\325\312\266\374\370pf\022>=\035v\342\200\254\303\302S\302b\350)\366\231hM \305F!\344\253Y6\207\016Yr\205\247\223;\235\\\240\276\231\033\263\005P\267\370i\237\006\352\226\3132\002\365\323\250\223\244\366\351\226\323\302c\2652%0V<\200\242\323\311\265\371.\323\236\216Q\242\365\340C\252\333\232'\336 \302\217\234\033\032\355"
+	.string	"o\235\247\037\206&w\367\252\224\251y\032\305A\270f7\244K]\222\003\235\364\006\347\326&\345g\362\0325\345]\025$8\235\334\237\027\342\214\036\"\341\2246"
+	.string	"\\Fo=\356\347Z\203KB\214\321\\H\270\020l\330\204\323\350-\031\235\323Jsa4\372o2\372pr[Q\210\334\314\350\303\005\201x\250\201<\345\0303C\"\"\"I\n\2224\006q\005\004\031\347(;\017\021@\261cN\221\244I\22650\211\276tZ]\0163M\370\251I\263\366c\336\210\330\211V\226\225k\212W\317\345\241\341\342Jpp\\\005\t\206G\026f\315\333\031\200\355\031a\351\232\341a\362\272\331\324\030Y\023*\343\302:\264o\3364\025e\316\240\262YA\004\273\025\377\205Y\256\035\243\270\266\177\004\243z\323\321\032\005Y\367\267,Ev)"
+	.ascii	"\f(\263t\234\037aA\277\341\204"
+	.string	"]\256\347!/Y<\342\004N\266'y\3354\324\001\205{("
+	.ascii	"Md\322\322"
+	.string	"\366HY_O\220\253\227!v/\311\022,\322Q\300\f\250\215]`\223\340\217B\215x\214\350\346N\261\235\303V\353\361\3434\nu\037\2729\266\332O\033\374\2377:f\223:z#I\3308b\262\200\213\b\351L\372\034m\311\024\336\224\311\357\225\001\372u\333F\021\260d\210L\f\321<\213\337l$\3755\323\317Q\264\\\254\267\"\214\353;\350\320$$\030\262;\033\215\\\370\266N\324\274]\224O\357\362\016\311\347\244\f\024\331d]'\022\242\321\337U\n\216$?Z!\277\350\314\r\240\277\374\252\250\300~?\0369\241Q\203\271-\036\024\314\2157)\375\275\315\027\324WV\005\227{\273\007Mb\024<os ;\210\2651s\006\242\345\201\234B\211J|\263\0210\301\261\374tN\247\327a\017\336q>\343\352\333v\237\337y9\303\334\035\021\342V\273\\\340\033\217|fGT\204\213\370\017\344L\0246\242_\322"
+	.string	"@\200\233\257}\177\353\016\360\306[\224[`\351\365\034\320ps|=\256}\301\363\331t\332gp\274A\001O\2331.a\273U\301\323\027M\371K\355\221\323\034\005u\305{0\355\335Z\017\260\023\252\205\357\224\362s\202\346P\331(\365\321"
+	.string	"\217[\013H\177\267\266\227\315\227\316k\226Nr\203,\234\n\240\276;\214\301\320'$\211\316[\216\027\227\253\211\\\235\264\345\275Y\354l\357\005\035/q\005\231\372\275\246\202B\233\263\274K\245\005>\267T\350 \370\305\335\200\360\344\226\363G\201\311\342<\331 \036\343\207eR\272\321=\347\360\032\350a\fw\351\242\324\n \2112(\236d\350\\[5A\336F\304\252Lr\321\320\347A\221~y\356\347\237Y\322\232\033\350\354\274\251y\2161(\027\207H\271p&H\210\311\007_Ee\302\002\344\0136D\246{T\334\231\302\300"
+	.ascii	"\237\335\262I`\244\337\205\353\304ub\367roB%\002\343z\376\276"
+	.ascii	"\347{\312\215YJ\302\224,\335lI\367\007"
+	.text
+	.section	.gnu.lto_cmsUpdate.129.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\374\006\025%"
+	.string	"\n@\374\rF\200\236Q\007C\335\214=~5,.\326\233\3122\2526\340\004\351\347c\221 \330\342!\333\206\034\210v\024E\020\007\306t\202/\313\n\221A\267\013\005\177\264\206\207%\361\344n\352n\237\226VZ#{o\271wJ)\005\311"
+	.string	"\272"
+	.string	"\315"
+	.string	"\250\237\376~2w3a\232Q\232\006\314\313\025}\261n\263"
+	.ascii	"\022\206\344\315\275K\243F\331\202\332(\263\021\221\006\355\314"
+	.ascii	"\215\244\223\b[I\220\327{\273\212X\271w\271\200\r\250\215\022"
+	.ascii	"\365\3166z\366\217m\224\205\314mz\351u\003\204qU=)\273\367\366"
+	.ascii	"^G\013[\227\303\335l5\332lUS\213\236\357B\356\264\302Z4\016["
+	.ascii	"\227\373\362r\034W\337\270\266\334\306U\303kZM\323\242\3413\261"
+	.ascii	"+-&M y\225\345+\201.\254\257V;yu\364\224\350\336K3V\271\245r"
+	.ascii	"t\312O\261"
+	.string	"\253/\232\221\350\177*xs\205N'\257f\234;+\037\305f\322\356\302(\345\236V\270\367\262\027\215X\315>\315\334\031\2309\211\331.\005\226\231\251\311\273\350O\301\006\361\207\334R\224\306\366\272\363\306\312?\222\033h\373C0\327\020\375\016s;\351'@n\036\3544\302\273\330(\367\b\333h\177m\354\030\345M.J\352\021\372^6Q\224\343\341TM\007m\320\013\275\243\2412\"\345M\356d\031Y'\343\024%\307\210]\307\303\274\034\372#\231\373\233\315f\223\037\007s/\233\205ZIw\220\352\314[\235w\2523\220\352\374\263:\373\250\316\272\3249Gs\306\251\316\267\231\263-u\256\251\316\264\325y\266:\257\252\263\252:\247\252\263M\235\321\324\371L\235?uv\353\334\013xfZ`\365\024(\367Z5\363\\2(\226\037\275\354\277\036\203\f\371\372\314\0270p\233\3513O\0326l\260\215\256\277\036\225c\272\314"
+	.string	"0\tTn\025\332#\205^\375\336\303\004C\364;\275\243\t\024/3$\253\376/L\213A\342\220\224d\033U\177"
+	.ascii	"\227w\231\262\002\262>Y\373,wX\177\361\251PR\262\215\002PC\326"
+	.ascii	"J\030<g\366\360\301\273\310DRc\312\027wK\212\032\264\351\363"
+	.ascii	"\272\230cg\007\255\375\364\273\352\310\235\245\265\004A,-\331"
+	.ascii	"F\355;\331\371D*\306\324\306\245}\026}\\\033\246\230F?m\276e"
+	.ascii	"\221u\303\256e\332g\317\267\211y'\260\347[;\356\243\214\241D"
+	.ascii	"\037\311\266-\355\263\377\237\203\031\246\243\364\177\207u\004"
+	.ascii	"2n\224\347#y\025k\237\365\3771\305\344\374;A@\016\023\230\034"
+	.ascii	"8\020\001a\002\203#\034\320\203\323\023\211\016'J8\375~(\232"
+	.ascii	"l\334t\004|j\352\225 \301\364\324k\372\001{G;\2062\341\364\353"
+	.ascii	"\235\200\202\372\365h\313\333\347}\034Cf\220\211z)\346=w\030"
+	.ascii	"\037\372\226b\034\005\316,\354!\374\341]\344=\b\033ECd\234\367"
+	.ascii	"\336\253{\344\036\003_e;0\fD<\273_\353\324\310\001\375/h\177"
+	.ascii	"\036\350\233j\253,\210b\351\347\037|\301\001\303!\360\240\367"
+	.ascii	"\021\"$25\307\347W\227\242\f;\320\343\313\275\351\276\273\344"
+	.ascii	"\350~h\254K\356\341\370T(\271\236b\034\334\347\n\270\355o/tD"
+	.ascii	"\230\304\273\210{\"\252\037\266AJ\221t\373"
+	.string	"\365X{\333w\325\0366\265\0270v\314\302p\262\206Z\266G\322\376\267\206\226\2446\344\263g\026.I3\013\200\231\250a,(\035Bc#\243 \005%)\244\003\320\002\021\241\261n\020@\210\210&Mc\341\314\204\242\351i^\204\2647\3718!\331\257m\361\353QU'}\214\324P\240A$\324\023\264.\344?\027\246\032z]\264\336!\201\307\202IZ\254\274\351\035\321\240gN$\221\375\276ki&Y$#\223\177\374D\256\030\242\250\300\314-\327\r\317\377\330i!\215},\317\301zL~\354\022\276\024\213b\025O\213\f\314\222u\022\"\255\n\356BpYX\027\013\373\250\366c\214\320a0\206\363\334\331F\204k\257\267\301\032zp1\332\364\234\020r\\ \005\300\226\304\352 e\364=\333\024\267\035\223D\353\263+}ci\344\260\371\027\3668G\353\306\022\020\212\213\270\201\364\266\026\263\241\\ g).-"
+	.string	"\335\277E'\244\243~\316\t,\022 \374\332\311\035\264o\345\214x\251`\241I\244\263Z0\005A\311b\214\201\250\263\206B\250*"
+	.ascii	"\020\341\254\017\305\345\304\210\030\0306T\035F x\372\270\307"
+	.ascii	"3\013\342\017"
+	.text
+	.section	.gnu.lto_cmsHandler.130.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\024\001\225\r"
+	.string	"\026\232^E\360\262&\035"
+	.string	"m\340\226\357\003-\340w\371\325\005U\201\362\310\245\013\t\323d\305\bq\"\202\307\305\253M[D\f\377\021f\255\021\250\211"
+	.string	"<\355\026\207C"
+	.string	"\232\026.7>>\371\3530\007\033\2030\262\267\224)\005N"
+	.string	"D"
+	.string	"K"
+	.string	"\235\235\343\237\210M cC\006\234\036\273\233i\210w\217P\263\363\005x\246G\314\303!t\260C\207\007\210\327\002A/#R\037\017\225\n3\016-h@\274\023,\240\303\204\316YO\r^K&"
+	.string	"\222\335u\246<\230\373\272\355\022\333\023\354s\001>\334\335\265\306\330\267\371#L+L\247\246\217!\300\241\2029\214\326\356K\253gkD\0274\231\366\277\316\376\330!\035\"<\317\362Q<Ew\233\322\r\354\306\324\344\354~\017\274"
+	.string	"{\364w\320\365\210\375\300\365\350. N\331\262\317\3428%_e\f\034w=\2462\270\261\252i\260:\221<\250\030<\2522\016\371\365\344f\006*}\330W\361\025~\341\253\274\342\235|\352\321\367\316\365xU0\363\201%[>\353\237Y\221\260\261\371\303\376L\2512\016\0361\021\021\251 a\004B\210"
+	.string	"GA4B)QI\021m\333\2126\300Z\210\033iY\n\212\311(\3236.\013\201L\262 \3322\025\022i\313>\337\236\204EO1@F\265I\027\362)C5\271g\205*\001\243\252\236\334\320P\227\234\227\256T\325\007\025"
+	.ascii	"pJx\027Xfh0\3026\001\256\006R\332^\177h\025\b\b\271\003\303\272"
+	.ascii	"(2\227b\260\025w8\241\270\343\002,\227\201\247\0138\356\334W"
+	.ascii	"M\215\212\2513"
+	.text
+	.section	.gnu.lto_cmsInit.131.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\016"
+	.string	"\305\006"
+	.string	"\362\213,0`-P\007"
+	.string	"\365>\340>\023\"W+\340[\260A\342\027$\020\330\205J\257\225q0|\340Ac\"\br\203\200\362\020V>\203\250\333Z\333;\245\246\020\025\321IEt2,$D\223N\324\204\004,5(L\323A\222\246\351\324\375\262rk:\021\360\222\021\206\352\303@\310\301\375\215s\370\303\2770\204\275x\354\214o\017\340\314\303\241\\1\264A\367\215lT\261\253\025%\205\375e\345f/O\211\211v\020\222\335\211peA\306\003\303\366\035W\366\311+\267\004\237\205DG\312\356NY\361\352\261\362\237\361\006\313\254\307"
+	.string	"\204\335u\3042\355\226/\260\255\021\016"
+	.string	"3\241\201\037\270b\356@;\200\331QY"
+	.ascii	"];u\213k\242[\b\370e\bp\351\306lm\327i\001"
+	.text
+	.section	.gnu.lto_cmsHandler.part.0.176.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"\375\n"
+	.string	"\346\324J@0\211*\035\204G\003\022\252\220\212\023v\361\177\242J\276'\2233\333\367m\275\005j\035\376N\254\305\330\200f\311\304\374N\304\220\207F\006\253\264\035\264-\307\215\354\341\016\313\202\036D\221H6\221;\2455"
+	.string	":"
+	.string	"7"
+	.string	"\237\335#\270O\373\013l\233V\026\355\t\037\013\254%\302HjFaw\275O%p\361*7\321?]\033JX\227\020\337\0306\273\353.\300=o\033c{\303\276F\347$\202\n\006\273$5\013;`BH`\373\366e&{\342\313D{b\323c%\313\270"
+	.string	"V\026,\f)?\372\2607\020\037+\235\262\333R\360`w\274\3704E\367\351\361\025.\236\020\321\223\257R\237\272@{\305\256\276\203\317J\376\001\217H\362\252O\237\304}J\030\020\200\2225_v\n\355\005\223\260\262\202T\227u\373\266\273km\331*-?\376\001\326p2\031\217\f\r\346\362\020vt>\036\016\021\250\003\202\243\317\301\337%\374|\036\310\303\371x\037\030z\227\212C\037\035\320\023\205B\2407\271\266\274Ai\210U\325e\273\223Rm\220P^\025\024"
+	.string	"pJx\017D\232\260p\216\303\357\366\016\343\230\272\261\247Z\001\357\001\024\3462X\202e<K\236\317\260m\246\3544"
+	.ascii	"\\{\300\215\026\321\357*c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`\224\013\0350"
+	.string	"\nT\250\022DP\244N\007\335N\b \370\256\344u\327\276\320\327\333i\f4\265K\231\035\021\342\344\206D\377\372~\217TC\023\033\244\254a\241"
+	.string	"!\001"
+	.string	""
+	.string	"$~\360\244S"
+	.string	"\217\016\007y(Y\033^\020\300\002i;\355\224\002\025\001\025\001\025\001E\262\027!\222\275\351-\263\355>\232\312\376\372\220\354OR\331\3354\312\311\220\255\353^\2519Tv*\351\353K\236\\\211\273\216%t\247\354N\251\267\271\2439\367\037!\215&H\356\301/\260\260+@r\367I\177\370V\223k\371\360,a\217\206Fydo18\025\337\216\334~R\035.%\354\356\023\031<J\330m9:\017Gn>7r\003\332\3502\302\032\271\3314\335\237'\\h\344^\223\272\3145\246\334v\351\214~#\224\341\\\302\206\337L\265\305\310\355\007\243\357\204\027\232\356E\267A\343\"\367\036\317\202\366u\327\"w_\312\242\335\bW\344\326\223F\030\023\354S\221\033O\212\216\227\032\216\360\243\321h\024E\356\300\023\271\353\244\275g\0050\214\211\334\202i\211\326#\321sF\344\376\023\321x!:\016\210\226\363"
+	.ascii	"\272\246\354C\356\275\324Cn5i\2076\303\241\317\b\277\333\337"
+	.ascii	"-\033\272N\330\335\303\326u\231j\335\271[\216\351j\333\266\255"
+	.ascii	"\206\334i\322\356&2\003xsl\275e\375G{\335\257\276\350\376\f\366"
+	.ascii	"\016cV\247\333\326O\373(\255\237\n\306\356cX\314\332"
+	.string	"m\3754/~[?\205\302\rC\321\334\002\353\247e\251\230 \340^\2345O\203)\254\357e\315\343\372.\006;1*\006\214\322\372?\232Mp\023\023\324\213qZ\222\343\372Lo\f\330\207y\266\340R\270\307\365\227\336\t\353'x\271\254o\004\373\220\235\034\264\273\254o\364z\nE\320UZ\337\b=\256AoPA\245\365\375\245P\340\205\342\244\343\003p\t\034_\305\004\002?\254\363T\357,k\316\250\032\335\212\306\027j\272\007\376\t\313\0032\276\361\225P|!7a\361\215O\357\270\2665&Q\0356\275\331tUq\022\211\357$;\223fv$`\331\211|e7\322$\373\021\257\354W]\331\253\270\262'\331\312\016\245\225}HV\366)&\331\273\226d\367R\222\375\013+;\330Uv\246Uv\253$\331\235U\331\2370\263\207Qeo\202$\273\330\221\354cF\262;\tfo\030\366\177\212S\f\373\017\005\366"
+	.ascii	"\361\032\277\206\331w1\327\007\244\255=\215\354g\2507\034\262"
+	.ascii	"6F\366\233\\\177\262\273:$\373L\2567\340\202BRd\237\310ud\027"
+	.ascii	")m\221e\375\354\262 \331\017r]A\037\225\224\221\375!\324\031"
+	.ascii	"d\301b\225d\237\251\211L>Q\354\357\256\301\2215\\\362\r\300\356"
+	.ascii	"T\240a{:.\371Bnj\362\035\232|wz\332\266\255S\203I~\220\237\247"
+	.ascii	"]\177P\002\221*\221[D\376\220\2337\234\021\267&\020\362\215n"
+	.ascii	"E\344\033]O\325\272\276\264\200\220\311("
+	.string	"\250\024#\362\275\351\237G\307-NE\360\036\007\352-\027\305u\267\026\275\233\305\336g\236zt\222\212^\b\354G\254\272\267\244\242\307\001\373\200&\355\234\244\242\037\212\375\030'\210\245\275\024\375\361\355/E\377|u>L\343\264dUy<W\365\300sU\037\020NZ\377\377^'\252=\251\231\260\376\3535\037\032{*\207\254\257\302\372\177\345\265\260\376\2579\225\326\377\264\327==lz\017\242\275g\016 \2747\227\016~\351]\376\321\333\325e\226o\324tV\212\232\266h\371DMo<ZN\\H\313\037rJXF\020\323\3125\334\362\205\240\356\255\027\\r\371AN\037Ni\201\305~<\303:\003\340t\bx|g\261\334\362\207\256\277\0274PU,\203\367\330U\272\005>&\3307\327q\013\376\210\345\251\226\301?9J5\350\351\215g\345\207M\251.\275c\224\177\004\367\234\362\217\336$\345'\200\231\022\224\177"
+	.string	"\214\362\211b-\035\247|\003\316\252&\243\364\251){TD\345\230\\\326\021\026\351\211`\357?lU\261\247\321\261\327\300\353@S]\372\206\234n\304vG\352\b{\227)\363\362# v\037l\343\363\032\235^\f\334\262\323rH\n\274\330\\\t9\335\203\342\226Cz"
+	.string	"Mw\026\351\211}\374|h\025\346\206U_\f\213\357\231^\301\212\372\345\361s\365)J\025V\365\265:\027\332\362\264cU?\253\363"
+	.string	"Qv1\253\272\023?!u\376{\306\244a\325Os\276\261\377\001\200\263\250A\020\005\022\245\032\031\tD\244)H\322\030\260\002\271\241ms\021\240,*\225\231@D\"\221@f\244\007\226\373\200 \344\240R\206 lZFt\365i\0013\23086\\B\t\366\267\235\321\374<\024\343D\375t\202\263?o~\2168\325*\365_\276\225^\372\232\376^M\032\027\307\276P\024 tlYPnq\363'\013\037F\006\007W\275[*\305n\034I\354M\341\0276K\265n\303\301\300\243-Z\254\027\300\001\262\021\377z2\232<\007\264\314)\244W\357\315>d\2763\233\003\363\245g\272\001\fQfQ\017Xs\217"
+	.ascii	"\235\243\207\027\235*\0167\243\331\254\200\257X \250\326\n\227"
+	.ascii	"\235$\240\245\nSl\376~dy\177\037\317\367\375>\236\357\373}<\337"
+	.ascii	"\367\373x\276\357\367\341\013\346\221@\023\226\210\201\325\031"
+	.ascii	"4\365E\376\321XM\255\354\264il\214:\333\033\b\325\357\266/P\373"
+	.ascii	"\376\213E \341\030\n\3438\212\265\037v\270V\351/\370\3423\\\222"
+	.ascii	"\241\217\313<\364\213k\304\342\263\316J~\200O\277aZ\375t\207"
+	.ascii	"\232\221\226\253(\203\300\214\347\355A!\243\350\247\236a\334"
+	.ascii	"^N\177\030\363\224\373\240\204\253\325y\004\354\224M[\250\213"
+	.ascii	"\025\020\374{f.(\324"
+	.text
+	.section	.gnu.lto_.refs.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`l\003\255\025"
+	.string	"\0064\222G\340\262(\303\001\320f\370fs$AW\231\231Y\213<\267\240$\033\017C\030\336dtO\034\316\334\024\2061\306r\2141\306\030c\214\315\242\242"
+	.string	"\340\243*\372_\214\334|\211\335\032\273\253\252\350\243\350w#\244\265d\313\024|"
+	.string	"\177"
+	.string	"\202"
+	.ascii	"Q\307\007\217 \027+R`\360\351\331\231_\b\263W\007\210\217\036"
+	.ascii	"5d\304\0201\177\020"
+	.string	"\263\3773\177@\352\303\371\255\331U\346\223\314\027\2456\201}BM\322\247|\324\351Q\262\217\230z\311\364\235|\221\367Q\226x]\344{)\377\223\235#]\022\355\"u\326\367!\371\210\033\354zJ\367\253\256\253\276\237\335\223\272>\352\276\363\236\353*\032-\271Ph\022\3672\376\027\273(~\354\213>t \235$\374\223\254\310+.\"{\210\253\177`\217\256\001\200\307\276\017eo}\317\222o\222\275$;I>\351\324G\246\356\231Z\244#\270J/\365\224\270\307\365\256eq\327F\210\037\016\3367\303\367\2450ag\365\315Q}qn\274?H\217 \035R\265\372K\310\237\204'\373\035\272\237\231]f>\213\367\260\031g\241\364\024\312{\251\217\336'*s<\202n\250\236;1\237\0331;\007\324c\201'\006\341\217\304z\b\370^lX\352\320\216\331C9\346\207p\310\347\030,`\241\202\247\202\315\354Q\301\374\210"
+	.string	"\306\213\013>=\362+!\002\215\031\336\017C\366_t\177\212\037\017\262\323x\177\223\375E~\213\374\227\354\254\356Q\344\233\b\210\213\344\001\302o!\377\025(L"
+	.ascii	"}\375\017\250\276\007U\237\303\252\257!\325\r|\275\006\325iT"
+	.ascii	"\375\266\3521\251n\003\277\006\376\n\330c\262\277\276w\311o\311"
+	.ascii	"?\001\277$\f\037\212=\2663\361N\346\026\2172\215\351kx\351\005"
+	.ascii	"`z\r\3707\230\207\001\337V\373\026\227\276\362\3623\227\207\325"
+	.ascii	">\004\037\254\365U\355O\\:*\374\317\265mdQ\254\307\330-\361Q"
+	.ascii	"\255\307\332,\361;\204\375\r\341\333dgqu\326\351\247\351K\257"
+	.ascii	"\270\362\335\007\016rh\337\00687\263^\233\3317\001\355\007B\353"
+	.ascii	"\377\240\311\376\021\340\0174{\002\262^#\373\033\255\307\314"
+	.ascii	"\372\213\254\257\002H\250!\230\023\tI$%\201\204QP`\322\001\360"
+	.ascii	"\242\272I\036\020\370\354\031\005&i\260\257\372\213\353X\030"
+	.ascii	"\302\233\350\227\005,\006\ns\274\305\206\204\244\350\004\311"
+	.ascii	"\272_V\325\366\222 \025\267\227\351.f\324S\215+\303\263Y*\220"
+	.ascii	"|0q\212\263\001\223\365a\366H\364\026\333\b\334G\370&\231\002"
+	.ascii	"K\n\237\301\225\221K\221)N\001"
+	.text
+	.section	.gnu.lto_.decls.319048d4f81a6607,"e",@progbits
+	.string	"(\265/\375`e[}\205\001\312\213\356\215S\0200E\345\244\003\356\315\263\"\367\272\373y\321\2774\307\263\354\177t\373\341\235\203?\206\3033\307\361\034\210\353\023\267\337e\342W8V\321\261R>\250\215\020\007\357@f\2363H\357\330\361\367\2551~+\367\212*\340\253\364\277%J\024\371h\t!do\271S~\007\316\b\031\t\370\211\215\033=\036\374kD\265m\226\003z\201\220?\250\023\007\307\352\253\361/\227\032\244*\311\026e+\210\030\025W\021fP\313_\223\034\215\177\201\250\377{\331@\372\207M\353\254S\261\321TZ6\2329\243u\r\333\245\263\332\351oW\212RU\323zj\346\234;\253s4\226\225\253b\346\251\037:\247\253\253\276\234\321,"
+	.string	"\001\002\004\372&\005\204J\305=\332\007\017\346\233\027\2327=x\\:\261\266!}\365\346q1A\2468)Q\215[G[\375\017\362\360\331iY\261\252\342\0222\267\343\317\207\213\235\023U\343\336a\355R\032TxK\032\377\315\363\376\007O+_7\354\232\215c\247\213M\356\257\361{\214:%\205\265\326\272\2344\376\377\346-\365\2230\321J\236,\200\036\252\035c\372\032\337\246\2652*\205\023\036j\032\367\215\206zG\365SG\201\260\314Y\251\243~\344\344\254\364cm\001\254-"
+	.string	"\206\242\205\244\n\212\337`\324w\233\372^S\361\363\336d\242`aQ}\215\337hL\236\250(\"\313\306\3572\365T,\007\364\357%\f~\230:n\004Q\352\244\236\2512H\2704\356\244[@\236%"
+	.string	"T\276)7b\215m\340\210w\336\200*\253\230\231J\316\371g\001D\202@i|\355\034\300\256\263Sc\327\370\267\200rx\346L\321#k\374\007\005\213mM\343w\022\365vL\212U\3339\033b\"\316j\214\314\361\232\350\242\276\200I\325\264x\224\370G\344Y9kF\204&epj\t\252\311\024c\341\264\256\246\272\364\221\331<\213\306\342]f\233J\343\214H\233\026\353v\231_\351\024\255\037\315\234\231\267X\262X6\237\244\fy\211\256\353\213\312\232eK\227\274\362m\027/\326\315'\211\231\243P-\254\251.}93\377[7\326\317\352\331=\333\3066-\034\373\306\306\261ll\237\345\263i6\317\332\335\236\261w\357\300\314\231)\347\374\022$L\330<;\306\302]\346W^\242\323\342\201\351m\313\217\276\234\231 :\200\2706\222\354\230\272"
+	.string	"\3334V\215M\343\300\256\271-\263\314\237J\314\314\314\231\371\323D"
+	.string	"\327\316\032\337\316Qo9@o`\240\345"
+	.ascii	"\275\345S;[\016h\006v\003z{\247\376\326\314o\305\354\230\255"
+	.ascii	"\273\311\247e\246\2223S\203O\030#X;\032\3231\32554t>\032\337"
+	.ascii	"\272\251\377m\232\235\263e\230\271C\317\034&s=\032\3372\325\333"
+	.ascii	"0\365V\211zkD\275\355Ro\265\3240=s\302\346\3745\276\345\241\336"
+	.ascii	"\352P;X\016\350mR\315\300r@\255[[.\366\355\326\315n9\t\023\347"
+	.ascii	"a\262n8g%k\013\340cm\001\3167#Jg(\276UR\017\002\365\203\345\200"
+	.ascii	"\336H\375\240\212\265b\323:\330+\371\307\316-A\365h\374!\265"
+	.ascii	"\004\331v@\037h;\240\027RE\260\034Pkf\317l\032\006v\312I\230"
+	.ascii	"\370M2\313c93\177\3248\033[P\032\037\005\225'\350\026\355\001"
+	.ascii	"\310\312&\236\201z\213\001j\003-\006\350[\315`9\240m7\240\031"
+	.ascii	"\354\006\364m\226\003z\246\345\200\252v\003\372\267\222\013w"
+	.ascii	"\301"
+	.string	"\244mv\322\370\375O\034\177K\271a\376\013\346o\001\244\327\371\317\031\375\342~\371\033\352z\271/\334v5\323=p\271]~\273\367\020\377\tc\003o\034\332,\034+\244\243\b\360\237\004\370;y\335\220\374_s\n].\277\205\3637\207\237\377\311\342\267m\254\224\377\256\260\345\277\027\320b\207\374\226\310o\217`\375\366\352\267>\224\277\275\361[)\013\202\337\"Y\245\3376\375v\351\366\020a\207\027\264\370[\004\032\272\004W\355\266\375\357\340!\003W\311\336\257\\\013\374\227\002I\250j\234\313e\373\257\225\337\226\250\361\244\377\334\360\337u\355R\351g\375\347\371\317\024B\"+]\002\265\022,L\334)\226\004\r\3109\b\377I\302\211\337\226\320&\376;\205\204\3427\374\230\370\267\b~[\342\246\375\317\353\025\336wO\270*\376\373\202\335\263mz\303\005w\002hv\310\345\236\235\304\177Z\313\302\b(~\333\200\337\252\320"
+	.string	"\t\f(\301\b\267\f(\350F\371\355\b\277=A\205\025\376\215\342al\221%\341W\344\374"
+	.string	"?\376\373\177%L\321\001\240\201\b"
+	.string	"a\016\374\315\201K\206\200&s\275\377:\371\357\330\177\301\254\210\033\324\344\377\336\177Q0\371m\033\274\377\177J\376g\340\036Z\364\013a\354\336\027\360\343,\026\001\377}\372\357\3275\362\337\"\377%\362w\337\355\372oP\310\177)\340\372\357\326\177\203\374\327\002\255\337\356\t\371\232_\271\373-\336\1771\310\372o\001\200\374\366\354\267i\177W\340.\177\033\366\333'\277\035\373\255\222\337\032\371\357\217\337~\3756\353\267=\376\213\365\333\345os\374\026\352\277>~k\231~\233\374\355\006\277E\372o\217\337\306 \202\377\036\377\313\343^\375\315sC\374\327\352\357\236\252\377\226\330\361\333\f\277\025\361\333\001"
+	.string	"\375W\307\337)\334\034\377\245\372\357\371_\250\337z`_X\030g\267@D\341?\007\377;\374\367\360\037"
+	.string	"F6"
+	.string	"\367\306\255q\225\330\334\020\374\226l\211\226\016\247\213$\372\216\037\223\375M\346~\340?\332\337+4\004\256\321-R\001\003\371\373\313%\376\326\347\031\260?\017\376\030\307\337f\376\266\373/\321\004\277\365\t3\347;?F\262\301}\241=H\361[?\026\277e\301\266p=\3607\211g \002\007"
+	.string	"\t8\006\033\342\264 \364\207\013\340r\336\363\343\025\177\307\320G\370\307j\376\266\340\016\235\313\031\003\244\030\300\345\230\370\355\255}\213\376\300\177.\377\325\037\323\3757\306\177_\374w\370_\341\177\205\376\313\201\377b\340\277,\376\273\342\277*\376{\302\177S\374\227\001\377\005\341\277\036\374\327"
+	.ascii	"\377\035\300\177/\370/\207\377\352\374\367\374;\316\337{\177"
+	.ascii	"\333\375-\3677\230\277\255\374\275\366\267\331\337j\177\237\375"
+	.ascii	"M\3667\224\277\237\374\275\344o$\177{\375\275\365w\326\337>\376"
+	.ascii	"\346\361w\325\3379\376\236\372;\352\357\032\1773\375\255\364"
+	.ascii	"w\376{\004\177\307\360\367\321\337\307\277?\3607\361\357\027"
+	.ascii	"\376\206\361\267\013\177\267\360w\007\376\266\300\337+\374\255"
+	.ascii	"\302\337*\376F\361\267\003\376f\300\337$\374\035\302\337$\376"
+	.ascii	"\376\340o\240\277=\370\033\304\337\037\376\366\360\267\001\376"
+	.ascii	"\316\340\357\001\374-\200\277/\370m\013\277%\361[\025\277\375"
+	.ascii	"\337\034\376\336\360[\242\377\\\376\326\360\367\317\337=\177"
+	.ascii	"\363\374\275\363w\360\357\364\267{\3775\360\267\375\373\277\025"
+	.ascii	"\362\333\022~K\302o5\370-\006\277\r\300o\323\377\305\377\002"
+	.ascii	"\370\355\234\377a\376\267\370\177\345\267\347o\375~\033\347\267"
+	.ascii	"}\277\345\373\355\233\377r~\353\346\377\212\337\266\371m\327"
+	.ascii	"ow\374\326\306o\331\374v\312o\243\374\226\354\267K~\233\344\267"
+	.ascii	"^\277\325\372-\220\337V\375V\307o\251~\373\364[\247\337\326\370"
+	.ascii	"m\t~K\202\337\216\340\267\037\370m\321o\213\277%\376\026\306"
+	.ascii	"o\207\277\375\371\255\013\277\315\300o1\360\333\013\3746\002"
+	.ascii	"\277\265\300o%\360\333\022\277\005\341\267\375[\373\037\360"
+	.ascii	"?\213\377A\376\303\375\027@```\340\377\323\366\357\274\360\233"
+	.ascii	"pA\314\020\017\332\251%\220\t\022\004sU\345$=\020\342\264\315"
+	.ascii	"\371\365\035o\035s\261\351-tdc\215\377\306ZM\371\321\325\370"
+	.ascii	"\301.jP\223\254,\006\264\005\311T\r\312\202\216\227\313N\232"
+	.ascii	"@)\001:+"
+	.string	"\315\240\021U\203\267  \213\261\260\376\2063d&-\266\257\036\252\006U\202\216{\3304\334\343o\020\310JR\037\2041s\210\007o\250AeAx\007\256:\266:\266\302Wj\3169\211\231\243JX\316\371\201\345*\345\007|\325V;k|8Ik|UO\375o\337?\232\247Nfn[\342A\177{{\336~\370{\354\265\006\370\217s\356\200(g%,\313\234\263u\203\206\311\332\341&\203\374\377\235s\322R\251!\231s\316\314,)\rI\264,e\222)k\207M\242eI%\321\262\222:)FIJ\231\263\222\324\274\224\312L9\253I\245\234\321\226R\032\222LY*\211\226\225;\314\254\234\231YI*SI\231sV\262If\3262\311\224%\245!\311\224%\225\321\262\244l\022-+3SVN\220\314Y*\243e\351\331d\316R&\321\226R\0322\023\227\256\032\\{S\366\212Ye\211\224$S\206\272"
+	.ascii	"\214i\251\224K2\227\266-\347$*MYi\2319g\345\334cY\2006\246#I"
+	.ascii	"mKrPi\025S\222\325\215%\255e\220\271\224\345\222L\2261\232r\276"
+	.ascii	"\3137@H\262I\314\2343\215\274\224dsnb*s^Z\266P\225s\316K[GC\231"
+	.ascii	"{2\223\322\323\222\326\222\247iiI#3\001bs\316Y*\211\246\265\034"
+	.ascii	"\241e\n\332W^b&\331\344\3232\177\345\273,\245\212\226d\333\364"
+	.ascii	"\300\301b\246\017\347@\337\224\232i\314\324\rI\202\216q\340\350"
+	.ascii	"*7\271\334\240L\326\034\260\037/>\304j4\276\252C\335@\026t,%"
+	.ascii	"\325U:\230\345\244\0353\315@\267\276\234{\204H\261\334\224\\"
+	.ascii	"\215\237\312\251\032X\005\035G\245\341\250>\023L\346<\225A\223"
+	.ascii	"\345\234__V*C<uS1T\024\nD\212\2217|#\252\205\234\321\260t\ri"
+	.ascii	"\332\330Bc\r\256\361S6\365\3075\216\235~\033h\277t\024\336\302"
+	.ascii	"J\363\243\261-\033q\\\343\266ui\222\323\030\317\300M6\355p\230"
+	.ascii	"\306\231?>h\322\330,i\374\024M\275=\034Z\002{8\024+\335\022\004"
+	.ascii	"\006\006\006\312\311Y\t+5f\302K\307J\377I\357\300\222J(\316."
+	.ascii	"\266\324\334\032?\025S\257\234\013h\323\376v\347xyI\362j\374"
+	.ascii	"t\211\212\224s\316\366oh\3727\224\211\231\234\001F\361;\334\033"
+	.ascii	"\023\2208}\347Y\030(J\267\357\330l\331s\225t\304e\201cA\372D"
+	.ascii	"\313\017.\276\017\271'\216\335\022\330}\263e\357\276|\210q\323"
+	.ascii	"f\215\215\234\215\306\267y\365l"
+	.string	"\332\207\273\367 \0233\243\345\314\374\t\332\265\361A\245\361\323!\352\355\007\364'000\320~@\377\233\307\206\206\334\222\232\306\027\017#a\262\302k\374t\251\336bQs\251\3341\227\371\245B\321\325h\246\271k.\232{g\323\256\232\337\272\026\323Lc\327\314=s\231_i\226%\247\266\177\304U\3233\272)\371u\325\\\271Kg\345\252p\227\300f\316L5\224\004i\322\301\327ngI\226|\243\361\323(\365iR\355\246`\324\226'W\267\314\357\334\177\311\3306\013g\247\274d!i\3345F\374\226\301A\370\242\2244>\372\247\236v\003z\343\230\026\004\235Hm)\242\006\356\266]0V\256\252\001|\177bn\030\233v\341\016w\327n\026+WU\202\322\317\002\020\235\226cl\017\305_|\246n0%i|\364\255\313\335r\337|n\316\3134_93\375\277^l\332\355r\2650\233\354\t\212\027\334M$"
+	.string	"\\K\302\345\327\355\026\256\205\f"
+	.string	"\ra\224?\032\223\030\361\313\005\005s\003\022\247\361Q6\365\350\023\365\350\227\212\305\352\311\362J\343\2439\324{\345Z\351&\035<\271<\276>6\233v\257\334*'a\342\226\t\242C\372\265\003\213\030\214\1776\325\237o\352O,\352O5\365\277jSt(\261\202\243q\032\272U\265\305I\343\237a\352K\234\265\233\253u\321\276T\0333"
+	.ascii	"\257\331E\263i\367\3542\257\024\033h\277X\346?\342\236]%3s\232"
+	.ascii	"\327H^\0211\024\237D\324\377\226q\2402q\2612v\243\\29\247.\254"
+	.ascii	"\306w\3542\245\262\215\306?\177\250\267dW\351^\205\335&q\276"
+	.ascii	"\240\\\261\373\344:\271`6\355\206\205\341\205\345\205\261Q\227"
+	.ascii	"\304\330\375\361\340\2379\324\3772Yb\337\266\310l\344\037\037"
+	.ascii	"?\272(8\255$\tU\334\032!\215\357\027f\266\341pj\374\263\206j"
+	.ascii	"\244\333\334\256\255,\315\234\263\221vs\275\322\330\212\\$\227"
+	.ascii	"\310=b\323\256\021\245\333\365\305\310M\272][X\322\247\2728T"
+	.ascii	":C\256\027\0334.Z\274n\327V\022,b\215\357\326\345\262i\026\\"
+	.ascii	"!{]KR\215\177&\251$\310\331Z\200\332\300@k\001\372\337 Z_Ql]"
+	.ascii	"\232\271\323\206\265Fu\263.\020\300\036k\3144\276K\035\034kV"
+	.ascii	"\332\032\037\273Qo\307\222,\236\217R\206\3144c\314W\267!\323"
+	.ascii	"\314\231\331\243\335\334*3q<.\326\375q}\330\264\333\343#n\217"
+	.ascii	"\253\224v\327\314\231\2316iR\312\323\301\227\273VU\335\224F\210"
+	.ascii	"\216*\274\0353\376\254\354\320a\351\272\264\331\321\030/\205"
+	.ascii	"\301\321#\307\245\352\333c\222\245\361\305\341\301\213\233\234"
+	.ascii	"\306\307hTe\267\261le_I\226mF\224f\316\031\352N]\251\033e\323"
+	.ascii	"\256R\331n\356\323\026Y\363*\257\022\225f\316\031\004\210\016"
+	.ascii	" @\370<\221\t\023F\347\306}\332Ic\306F\335\223eC\225\224\351"
+	.ascii	"\303qm49\221\271\311\322\370\277N\267\306^\232\272\261\3067\311"
+	.ascii	"\f\316\231\001\303\245\361q\234zK\246\264\005vi\\\246\273tg\330"
+	.ascii	"\264\333\364+\267)\315H\267A\362u\233n\222\2053s\344+gf\272\344"
+	.ascii	"\311\031/:\370\370\213z\354\2462u\322t\021\201\023\330\315\023"
+	.ascii	"-\214\2331s\032\360\212/\311\326\270\345\360\324h2\203\325\370"
+	.ascii	"\270\212\352\327m\204X5\273\257\377:\216Mk\277\277\3374\237\233"
+	.ascii	"n\322P\253j\346\314\364k8\255'\344\352\352\252\003\b\020<aX\316"
+	.ascii	"\370"
+	.string	"T|\214\246Z\246\345\200v\260\033\320c\246z<\246\376\275\247\247S%.\227\3515\227\217]S\016[\323\3025]\334\323R^\326\317\016\033Vpl\360v\270\322\252\344H\363\306\373[M\257\351(\020\004\002\302i\374;\313\001\355A3\342\235fL\227fYc\236\2733\301\270\26166\215\373\f\\\013=W\206D\t\322\270\315\214x\333\365|\021\322lL\200:\267T\254\213\026\025\272\2713\260\213\317G\334{\356\3571M\246\313\2347t\034\231\222\353\260\001\016\245'\215\217\227\250:\331r@\355\322n@[\314\210w\334\016\023U\225#\215\203pc\314%\035d\302\344\371\020\341\203\263\005\246C\217\0329qc\276xQ\245\320\354U\351\267\356\322n6\255\275\364\226\333(\315\345\312X\263Y\270\255\276f\316\314\021^l\026\3136#N3\347\354\245\261\264\026\001,%\263R\026\bq\3159\277\276\234\231\035@\200"
+	.ascii	"\341\343$\207\362\212\212m\266\034\320c*\365o-mr\352\276\360"
+	.ascii	"\365\032\252\006\310\267\225\345\026*\311\f\270\306\307Q\352"
+	.ascii	"\261"
+	.string	"\223\372\367\025+XI\030\233<+U\326\264i\302\244q\2571\231\350\324\334"
+	.string	"6>NR\315:\212\bM\312 T\232\217\277\2474Z\2475\025\233\326j\217r\326a\"4)\2036\322\272\312Z\212\bM\312`\324\f\254\246Z;\351(>i?@t"
+	.string	"\001\002\004\217\336\0228/\035\374\033G\375\325c\212]5exZ\032\377\312\251\277`\324\261&\023\3039\236\2545i\374[eLL\275\202\245\312\026(o1t\251)p\252\361\337t\330\377 :\345f#J\030X\352\345\tG]+\241\342\303K\214\323\223wW\362\224\232\222\244K\343_2\365\357&Lt\310\336\330\3400Y\362t\346\006V\343VB\205)\347\334\201\347\rOL\311\222\257.\322F\032I\037\261i\235\344\335\325^=\344\226\231\223\315D\244\352\235e\347\252Th\335h\346\234\265\232\313\347"
+	.ascii	"9\007\t\374\312\031-I\323\350\344E\373\nB-A\331\261N\3223\272"
+	.ascii	"\3512\277\322*tQ\315\234\321:\004ry|}>rq\222C\332\216rA\267\244"
+	.ascii	"YA\356\2744\252E\347\fo\315W\343o\220S\267\250 \342\254XA\331"
+	.ascii	"\254Y\216ba\213\230\230\223\312U\336\030\364\312Q6\25759\324"
+	.ascii	"\270\3618Mq\301j\374\rK\025\304\225\265\177\rs\331\f\314%:\274"
+	.ascii	"/\23738\257-)\025\204\230\232\032\346\262gk\354\231, ^\215\277"
+	.ascii	"a\206\372\301\212\024)h\032\232\3664\325Eg\351\fp\013E;\232\226"
+	.ascii	"\201\013\007]\343\277A\317|\312<)\341\201\236\241fi\031(F\376"
+	.ascii	"\322&^Xp\032\177\202=\365\003\221 'G\301\234\240e\327\216''\231"
+	.ascii	"\345\2504K\230\035)6\244\224A\305\216\226\035\215B\302\304\361"
+	.ascii	"T0'vJ\215Q2t\f\205r\274f\202\367\244\327\030\r\373\033O\325\231"
+	.ascii	">!\350\0235\352\321\257$(\223\273\247l\034U\312\224(9\312\344"
+	.ascii	"\350\022\022&\016\267aH\017\274\t\302\250(\022\364\310\321 G"
+	.ascii	"\271\204\240E.]\316K\0370\227\356r\262\352\003\016\203\346\206"
+	.ascii	"i\310\321\"G\211\2200\361+K\314\031\215\337kqo\310\032\243^\307"
+	.ascii	"\253\213r\305l\214v=\317\247n\t\237\226\303E\241R$H\343O\260"
+	.ascii	"\246\242[fj\007U\226K4\253\3032i\357C\223\266<\276\276\237\264"
+	.ascii	"1]L@\216f\235p\360\240\354\300L\360D\355 \211\366@{\240XaJ|%"
+	.ascii	"NM\f\352\343(\326\361~\326L\321M\231`\251r\020\206\356@w\240"
+	.ascii	"Wg\224\fQ^4'yRP\253\243Wb\2504\0056F\253\236\345\007Hs\352j\002"
+	.ascii	"\036*\007>\236\236\320\034\326,GQ@6\205dN\037F#\305\213\013\352"
+	.ascii	"h\216\243T$L\374MMr\243s\323\370\350\024\212\343"
+	.string	"\017\366P\211\302b\243\3615\364\251\250\022\225\322\201V7\247\3615\350\251h\324\211\247\364\344\205\326\370@\200]Wp4Fo\264\022\314F\2256\215\337[cH\316\2141\243r\240\204\322@i\240N\326,G\225\320\226\307\007\266\243G\245\271\207\3268\352\324[\250\235\\\217\272\306hR\004S|\3745\376\233\017NS\370\226\260\250\037l\374\375\004\374Cg\\>'8\\\232Sh>:\343(\323OY\230\033\251\306\350\022\252\204&\235\201\255,\363C\213\251\3619\247\267n\224\022\033=\374t\307h\321-5>\345LQ=\234q\343\346\214\323a\231\244\227AY\316\343\353I\223\273\270\372~\306\371I\230\300O>c\202\250I5\376\233\023\316\337\323\233\267\023\316\311w\303*\210\337\305\273u>J\310\274\260\235o~\3534\020Q=\\\271\373\231\346\356\334\273j\254\boa\362\2144\305\326\374\334\373\251\207\321,\375"
+	.ascii	"k|6o\275\332LI6\376\231\027L\262\346\312\234\306'\033\004\370"
+	.ascii	"\360\003\"\247\361O\274\2569#M\032\267\375\033z\252ie0\347({"
+	.ascii	"h\202[\260\266\262\032?\255b\307\343\253\3615\004Q9p\233\233"
+	.ascii	";\355\320L\rQZ0\003\316\335i\346\247\035\bdP\2104>\353\376\246"
+	.ascii	"5\325\343\253\361I\367\247\202\200\202\373\341N9k\226\243\254"
+	.ascii	"\226\234\252\017;iv\214\251!\363S\356'*\371\244\3619f\207\215"
+	.ascii	"K\013T\3433\316\302\251\205\001\003\322\370\024c\341v\304\250"
+	.ascii	"\326\236<\003\033\225\0037l?\271\260\235`\356\236\232\223\230"
+	.ascii	"\271j\231\244W\302\233\037\327\230\276\234\254\372\320\303v\025"
+	.ascii	"\266t\373\t\346\347\027\022&\360\023\324[\026_\343\323\313}\252"
+	.ascii	"\342\2664\033\377|;\273\374A\235%[hO\032?C\026\365\bP\315tHI"
+	.ascii	"m\375\017\376<\371\263a\327\370\324\362s\313\037\334\211\362"
+	.ascii	"\326D\327\370\031\324\324"
+	.string	"3\313\317\266?h\271\240\344\346\032?\203\231\372\237X\376 \217^\021\035C\032?\003\231\372\fNT\020l\202\376\237Vn\005suX^\272\276\251.`9W}H\347\314\200i6~\006-\025D\340\332\327\316\3349\023i\246\251\241\306\243\3613\360PC\374\b:\321\3549\345<;\325p2C\236\313V\212\t\034\217\fP\352\177\002\325[\234D_Vv\232\2419[\3462J\231\253\224\037B$\231\347\031\3634\353\274\314\371+\375\002\007\325\f.\025\321\303\223\362\323\254\253\332\364\202$\377|\340\310\215\377\343F\375\317\234\032\002.\b\337\331s\214\354\266\301\231\n\n0P\276\262\250\377\201\242\206\310\022v29\241\340$\233\247\262\255\301\004LX\363\307\210\372\037,5\304Y\320\311\304\236NN&\347\223\333e\263S\266I_`\2204\177\250\324\377$U\353go\027\032\242\310\231\344Lr.\331\301\321\264H\234"
+	.string	"\365N%?\227\260\241+\263\273\233\243z"
+	.string	"\206\310\371E\344D\222\001S\316M\031\351\356\215\255\031\334\302\027\245\343\310O$:W\177jD\032\237F\356\334\237\233\250\306g\021\013\247\223\345GnrFE"
+	.ascii	"\227\020!\247\227\216\227\346\234_\337I\243k\352F\327O\257\274"
+	.ascii	"\251f\016\035\377\203\r$S\2215\276\217\027U\003\271\240S\313"
+	.ascii	"\236[[8I\20309\2375\365\026'\241%\256\374\370qf\221)\033H\323"
+	.ascii	"\233\\\343\377\004\3623\353\022\241\303\223\323\370\\\266\225"
+	.ascii	"\316\016&mn8)\214\024\251\272\306\367\tSK4O\037\247\217\346a"
+	.ascii	"\371\322\037r\250\023\026${\215\357cD\365\200\031\024\302\236"
+	.ascii	"W<\360\262\324\373\344P=`\262\243\352o8SA\361\266\346\313\247"
+	.ascii	"\206\372\236?\325\203\256 \017\354Iu*\317\034\177\353\322\211"
+	.ascii	"\353\321S\337cF\335 +\350T\332sj\n\353\200@V\232\372\020\267"
+	.ascii	"\354\201So\261\0164\204\033\0336\316(\2358%\324\317\250\264+"
+	.ascii	"&\254\306\347\r\234\304T\027DH\343\363\t'\225\321\363\261\326"
+	.ascii	"\365\345\246HR\026\025\001Q\316\246\263\351\254\221ji\233\363"
+	.ascii	"\003;\223?kX\274#s\332\224i|\322h\253\364\013\2228N=fj\005P\202"
+	.ascii	"~2\235L\267\r\004\226JS\032$\321SC\325\227\363\227\020=P\220"
+	.ascii	"\314xj\374\036\035\352\006F\202\254\233=\225N%\n\342\276\204"
+	.ascii	"\260abS\256\032\277\347I\005\341-0\360\314\201ms~`9\230d\224"
+	.ascii	"6\355\314sL\216Ti\374\236\254\232x\212\023\007\003\362\241dz"
+	.ascii	"\356\326h,\221s\f(\346\fS\337]c\374\327V>}\200I)\215\261_kY\256"
+	.ascii	"Qc\205gO\325 H\3201\0348\026\360&\263R\326\002\302\346\324\240"
+	.ascii	"\245"
+	.ascii	"7o\360Up/\2037\346)$\n\007[\343\363\254\251AQm\332`=\n4\253>"
+	.ascii	"\3407J\246\2104>\017\0235h-/\017\353Q \226\347\374\372rU\325"
+	.ascii	"\007{C\356\354\256\361\217\233\307z\326\215\310\024>%<>\324\r"
+	.ascii	"v\004\035\343\341)y\236\324\020\230A\370\316\3424\370\016\253"
+	.ascii	"\271m\032P#\347,#\350\223@\365;M\365\366\266AM\350\325\325\341"
+	.ascii	"3M\276\346\374\372\354\216\317\2609\277\334\245\265i\214\315"
+	.ascii	"\360\371\240\362q\333\214\211\222\343\327\370;u\252\006|A\307"
+	.ascii	"ss\026\356\203\264\312\2141\3157U\0035A\307rr\326\3152s\224\006"
+	.ascii	"\332\346\374\300\326\324\020\316\200\001\203\307\024\211;\036"
+	.ascii	"\303\343C\013MWc,&\2652\307C\331\030\303u\230\017\016\251\344"
+	.ascii	"\223\3068\f\230\272\200 nn\330K\216\2669\277\276.\307^\330\274"
+	.ascii	"\350[\262\2431~\273\201q\340\256\260(\373\250L\271\322\370;^"
+	.ascii	"\352\006IA\307[\266\3005w\254\324\021\350\254X\301m\235s\316"
+	.ascii	"_\251\232\r\253f\256R~\300m\177\033\322\305\fk\214\261\264\225"
+	.ascii	"=\233\363jk\214\331Z\271Sf\b\022\036\215\361\025\0355yp[,\234"
+	.ascii	"\026\337\232,\215\277\303\244\222 7e\n^3\341C9\347\327G\345x"
+	.ascii	"\rK\361R;\322\030\253\265\362\177P\315\342\344\013\360\355\177"
+	.ascii	"\020\347\320\"\026\327\370:mT\017NA\307h6\r\243\365\334\004\312"
+	.ascii	"\bl\311\321A\243z\310\021\204\231\026\233\231\221i\323\021\243"
+	.ascii	"\336Z8\024\204<22\\\206\306i\316\371\201E9.\023c\327\264]=\321"
+	.ascii	"iSK\370\001\006\206\305J "
+	.string	"\207\241\034\213\261\341\201\002\247%Jc\034&\307I\017\245\306\177c\331\376\007{\230^6\2004\276\216\231\nB\022&L\260\223\224\207\\\223c'\350\025\230[\237\226\377A\2379p\201\\\032_\247\210\352a\031t\254D\211e\373 U3\023\330\314R=H\t:\376\262i\370\253\313\234\311\254\244D\003\275/\235\035\252\211,G\216`\256g\3109/\345\214\345\003\205S\3524\251\033<\005\035\027)\022\227\343\250\036\210\004\035\017I\303C\232\t\252\fB\tI6\365T\017N\202\216\273\322p\227\205\353\220\223\3662\320S\006H\244\025\005\030V\243\n+\f\241\n\310#\242\242\243\013&\030\213\216\032\210V\027\204\0238\2528\022\207\032\220\305\225\270\022\245@\301\"\205\237\026B\244\020\005\213\025'zLha\002\n!\026+N\364\254B\253\213\"\"\212\024V\b\255F2\220>)T\300@\013\036\036\244pu!\303c"
+	.string	"\255\304!\344\005\307!\"\242!\"\n"
+	.string	"\031/\206\220E(\270(\232"
+	.ascii	"\203\360\270aX\224q\\WX\215EC\241\341\013\021\303\027\035\220"
+	.ascii	"EE.\254+\f_\250\217\001\204d\024\201d\334@\264\026\213\302"
+	.string	"\030'\220\353\tHF\rH\241\342\020Q\2508\264\002\271\236\200\024B\022\022\205\220\204+z\036\003\350X\004\203q=\212@\306\2001D\364\302\305J\344\202\260\230\002yd\204<J\241\b\006\343\312\002\271\0369\254G\341J\264\256\340\343\202\320x\302\316\272\032\037p\\\2212\034\200\324b=\022W\"*$\224A\206\321\220\270\022Q\035\343\212,\016\025\251 ,B\276\300\217\001\364\002}\201,\016\031\215\216BF/\220;\025\3100\032\026\215\310c\272\202`\210\005\222p\305J\024\242\200\\O@\n\207F\344\021}\f\240b\321\320\321\270\302P,\032\256F2\220\"\212EDb\221\260\b9\204W\344\220\321\002\305!#\362(buqD4,\016\2110\036\217DT@DtT,\026\025\323\030\212\2141\220E\305\364\205p%\302\253\361\310\b\027W\"#\362\210\032\205+\321\211\t\220C\351\221\205\017\200\216,\350|"
+	.string	"\2044\n\215\200\214\032&0\001t\\\201\024\256\016@\032\205+\004\216D\nB"
+	.string	":\256\020\236\b&"
+	.string	"\350\270B\206\220hE14\356\004W\210\201\034\262@\005)\220+\213#q\370C4\204,\262\340\202h\035\302\300\020R\n\035\022@\353Q\350"
+	.string	"\236\235\022@H\341j\264\032{\202 "
+	.string	"\271 *\212\261#c\225@\321\270\"\221\326\340Q\306*\201\242p\310\342H\034\356\310X%\260\022\271(\n!p$\016y\036\003Hh%\016!\213GF\021\303\027\0048\302\020\022="
+	.string	"Fq\210h\024\356\034\025\327\025E\025G\3420X\\\215RXa\024\2051z\214~\326\023(0\256\310\343\020\214u\205\n\214\253\n\307\2658D\224\201g\004\320\221\005\027+\021Q\221\n\310\243\220\310g\347\305J\344\303\202\210HH<\356\b\213\210\036\200\024\022\215E\0178\022\207>E\342\021\0212\006\214!\343\317zD$\254@\fB#\212#qH\301\n\202!\026E-\220/\326\t\270\310\020Dr\241\342\205\241\020\311\363\302P\350\200\235\025\206P\205#q\330\263\036\215+\fBc\213#q\310\001\206\320(\210\204<1\324Ya\bU8*\256+\216\304a\206#qE\2528*\256+\220\204D\036\243\242\026)\f\241\221N\fE+ \tW\254H\241\013#\026\216\304\341\017\022iE\241\303\361\347H\034f@q$\016}\220\305\325h<:\201\034\256D+\013\024G\3420"
+	.string	"\037\016\031\327\342\nC=\b!  \004\021\220\322\2130\302\007#|\200^\204\021F\214\030!\204\021\352C\030qW!\031\353\013BG\3420\370\030@\305!$\321\320\221\013\006(\016\tW<\006\020r\bi]a\020\036\205\216\212+\361"
+	.string	"\310!\244\024+\fB\026G\305\225(\204t$\0165\b\3110\"\213\353\016Rh\005\301\320\021E\n\035Y8\256X\211CH\025)D\242\004\211\022\310 RH(\003r=\276xQ\204\256DaQ\310\305\352\242hX\\y\220?\310\343\212\264\272(\016\245H\302\025\305\241\025\034\220\204\304\342\020\021E>\006\320Q\304\360\205\005H\253\213\242\212\225\310\005!R\347(tb\0020\212CH\344z\274\300\350\350\205\242\"\"\024\306\320\213b\321\020E\036\205N@AE\213\026)X\b\241`\221B\017R\250\205\t)L\340\001\306\225\310h\bItD\f\"\205B\030\221\"\205B\030\321\002\005\025,\360\b\241`\221\202\016RH\204\026(\250`A\b\005\213\024v\214V\344\021\027\207\210\027)\344"
+	.ascii	"\023Z\254Da\361$\022\302p\221\204\304\213\374\020\210\303Q\b"
+	.ascii	"\ty\342H\034\252G"
+	.string	"\305\225\210W\030B#|T\\W\b\261XqB=\256CFdqM\215+\262\230\242X\224\032\221*d@\016!\245(\026\241>\310!\244\024DB\027\212\210N(\026\361\b\241`\221B\360\bCH\364\342t\261\2760\024\032\241H\244\025\211\037\003\350\270\032\311@\n\005@\206\021YL\301b\305\211\237a\361\350\0056\"U\030\026\217\036\2004J\341\250\270\256`\261\342\204\006\2430\306\020\017\213G/\216\212+Qu\241\202\270\"\207P!R\350\002\257F2\220\030\371\030@\"\216\306\025\206!\243\013\f^d\264\032E \213\212\214\"v\220B!\214@\026\207\216T\2430\306\t$!1=\n\365 \217B\025@\032\213T\220!$2:\016\271\330\260\022\271 l\001\003\272\016\207`X]\240\307\030\212\214\370HT4\304\0278\026\031\341\243\024\003\307\"#\\\\W\343\360HDt\364\200\365x\324CTT\344"
+	.ascii	"\241\323\305j\024"
+	.string	"\256D\3034\206\242\025\214EG\343\3210\210\024\022\001Y\034B\221\305\243\242\023.\b\2150\202H!d\206+@X\242\204\013\023\n\030\001\364s\005(\340D\006,\240p\202:\004:\022\207\"\216\304\241\210\342\220\220(bh<\212"
+	.ascii	"\242\340\270\"\217\\\0302\"\221& \221\326\026.V\244\261\310\310"
+	.ascii	"\350\210\205\2135\306P8\304\340\177*f\tF[\023\0070\2053\273_"
+	.ascii	"~(\245I\303$\235\2045y\003\203\317\\0\270\0343\276\234QT\366"
+	.ascii	"\260\370\232\211VE\tZV\227\270\340\217\"Tuog\215\271+947\254"
+	.ascii	"#\225b\346\255\213\013\312\205\007N\356\f\314\026\024L\2314Z"
+	.ascii	"7\032\247Y\322\266\247Z\236j\351T\313\r\fD\311\352\324P\\\002"
+	.ascii	"\215\224-\305\222\262a."
+	.string	"\025\r\324\227\234\272\200<+\351\225\324\n\346\352\274\364\342\321\254\300M\375\323*\250\035\\\226&O\326p\322ER\306/\211\312\231\361\232U\227\226\232\0234\b\r\277\253)\200AlVr\322P\266.\262\003\357G\343\022\314\244\244h\251\224\364,\230\225\201y\316\317\354\351\031\\\327y\261=\251\300L\375S\246\230E\203\006\354\251\254\354Z\245q\253\2122\206J\226\020\274\306\013\330\002%%K\241\244c6+\365F\344\310T\037\376T\354\351\230\024\267\265\26107tQK\215_\301\227\372$\005\333Q\266\343n\371\304I\231\217\\Y\240W\0234-\337\301\031\3238]\322\251\222\224\311\323%g\246K\b \347\307\332\002\374\\Y\371\242\004\375z\232\344\247\236\232e-?i\234\"\031c\226F\225J\361l9\ts\344\310\271\027g\213\031\"F\322\"BRI\314\020yZ\204\212\017\240\021\033d\032\247CF<%2"
+	.string	"\2667-\215\323\324\353\214\343t\346\204\246\313\251\347\312\220)\177Br\020\311rB\205+\335:3E\314Z\272\025\305\203%.\215+\r\202^\345\364-\211oF\252\205b\345\036;\251 G\322,4+\367\021\034Ts\200`/\231'\377I\231\363\352b\342$`\366\244\230\267jHX\023S'\231\005\306\t\023\0353DL\\\332\303\351\211\224 M)\017|\343\n\310\226\323\025\206R\343r\366eU$\003?h\364\250B\231\304u\321h\314\244\222s\266"
+	.ascii	"\215\003F\005D\007n\273s\3131xTOs\034e\"a\242\225:\177ntu\215"
+	.ascii	"\323\251\024\207\326\0259\271\250\226\033;\322\3258U\246RS\262"
+	.ascii	"j\2645V\336]\321\200\023\205\3168\335\226~I\250\364F\317Y\030"
+	.ascii	" ]\351\323\323\033<\224\224f4Nm\264Ri\2264\206\001:R\246\324"
+	.ascii	")eJk\250H\372\321bsu\325\227\316xZ#\t\305\253\016M\343\224\206"
+	.ascii	"\016\0274Q\2144~\005SiS\005LjP\035`\272\004\230*\251H\312\271"
+	.ascii	"\352k\316S\2454\351\\#g\017*0\315\347\217#t\177o\002\357\324"
+	.ascii	" @>T\016\037\372\027T\266\021!\211\\\036\337Q8G\377P\277\274"
+	.ascii	"'\177[\032\243q\324\031b\320\2404>\0070*\312\341\212\372\243"
+	.ascii	"oP7^WZZ\3206G\335x"
+	.string	"\251\351rVg\204\351\304\267w\312\305\321\325\325\351\341\265\036E\354\260\032\2230\026\204\346\241M4\017\257\331\254L\302\241L\375Q6`\320\266\250\262)x\247\235U:\362\366\264\006s\351\fy\323\005\250\246\313\264\335\235a\245\301W_L;\272\306\037\312\334\335\2459\215Pc\211\327\370\034\216\250\035\310\2311\203\332\251mI\323\245O\210\037Y\232\306\250\035N\212c\265\004l|\016O*\210%ttg\336;\363\005L\354\314\215,\215O\201\234\332\001 Z\006-c\306\306T\027\260\373\306\253\013`\343S\260E\355`\r\0312(\033\233\022\335\236\327\216\"?\032\237\202/\365\303\036\034\034\032\327a\231\244\247\301\233\254\271>\035*\246\232)b\216\306\335.Kw\004o\212\002'\265\003&oo(\2300_Z\256\352\230h\227\243`\320/\201[?P/<k\226>\322\344\260Q;\300\312\222\005\345\322a\231\244\267"
+	.string	"\261\206\241\250\243\261sjT8\214a \352\024CD4\232$i\f3\026@ 8<\032\224\213\346\305\364\023\200\205\213\213e-\021t\21213#\"\222$\005I\233\001\217\242\302\300\247\212\305s\332E\302\207\r&\363J\255\370_\t\356\030\004\304Ka~\n\315=\255"
+	.string	"a\254\301\344\013AZ\315Q\024\217\024\300\257,IB\020"
+	.ascii	"\007S]\356\023g\tK<\304\227\236\217\212\351\324\262'A\253\327"
+	.ascii	"\245\254c\342-\004e/\322\247t\207qU\\]5j\022\250q\337fOO\246"
+	.ascii	"*\027\223\320:\3366\227\354\033\233\231\251\025I\027\234,M\257"
+	.ascii	"w\222\301\023`\020K\256x%i\310\257\277\372.\004\b\361\002v\022"
+	.ascii	"\2328\021\261\203\375=\263U\247~\273@\311\240\202\024g\261Z\304"
+	.ascii	"4"
+	.string	"\203\021\346\351\001O\355\3513\312\035\370\360\350\272o>\242\237\274\332\020\2403\340\3376\227otLQ\354\016\177\214\227\037\274B\2214\226\022\030\202i\022\304\336\231z\267\t\325\373\201N\270\241\341#\3141aT\211<\3758\002\001z\334\233\376\017``{1p\342@\005G\214\236p\222\001'\372 \323\221\317?\204\311\272\r\313\006\315\023^\335\302\215\242!!\232IFP8\257\272\276\236\003\003(\313H5\254W\371\025=\227]_G\223(\354BZ\033\236\021\244\3521.5\300\376\245\032\303\"\203\276\031\374b\237\305!\203\313\317\207;,\354\277\206\272\303Bsr\205\330\306\2609\306\370I\205\326/\224\367vnA\220FK\263Z/\t \303\216\031\244)\254\004\354\322\375p\207]U\261\242\001\313\221\013\320\017\t\302\027\202\224\0071\316lR\024\326\216\210\006A\205\235\331`\306i\016\232\350\232\013\320\325\317\230\202"
+	.string	"\236l\242:\300\\\004\235\013\206<\333\004<\306\353\214Yl\212]x\236\025\261"
+	.string	"\302\"\220\005u^\272\\aQ`\262\023\227\342\243\027\246L2W!3Mr\017\260tbt\021\372K\215R\332\370l\330\354\261Z%\307rK\370\032\313a\275\340\203T2\376\204\r\255K\246\325X\360u\323\376\354\262\344p9\006\205\234"
+	.ascii	"\277\313\024oP\253b\324\331\350\221q\372o\214\027\262\001\203"
+	.ascii	"\003\224zL\217o\224\352\364\177\205\342\215A\255\220\013\226"
+	.ascii	"\212\324\2148\350\332\357cY\240\242\214\207\205\341\271pjo\260"
+	.ascii	"L\254c\347g\310w[o\2272q\253\243:+\363\240\244\256\304~\222A"
+	.ascii	"r\337$1x\024.\025'\343V\22653:\334<\254\220so\371\263\330r\177"
+	.ascii	"\352\021\276?\030\002\250\317B~#h\227\036\247\312\3015\330\231"
+	.ascii	"\034\230\245y\t\256(\202\237\253\247\216\026\365)4 \266\362\256"
+	.ascii	"l\234\233Z\213\211k\264\001)\201 \244\032V\021wP\342aIR\034,"
+	.ascii	"q\024'\313A=j\036+S\b\367\334s\204\362\030;\230!\\\376\037\347"
+	.ascii	"6\252\035\330\023\260\320\211\006\361\202W 5wG\267o\241q\037"
+	.ascii	"\267`a\274\346gR@z/\344\027\371\315\"\340'=\225\363\255\264\315"
+	.ascii	"\246\216&#\274\206\312\t\244\317\222g\031\341\025Z\351B\244]"
+	.ascii	"\032\006\212)\331\025\262\036Zy\004\361\262<|0\200\343h\f\344"
+	.ascii	"\024Q\273\374p\304\337\334\f\276\\\230\225\266n\241\365\226\311"
+	.ascii	"\3559(e\374\340\375\244\243=K5J\242\334\320c\276%<\327\351\346"
+	.ascii	"{\013\033N\217\002\353"
+	.string	"q,)\333p\\\f\353\217\334\361\340B\304\334\267\037S\204\373\0201\215z\364/?D\303\325r{\231\243<w\262\3626\031\204\374\213\3713\3127@\246E\251f\341\237\311nAai\240f\264b%\357;\021\340\004\251\342\226/\371c&T\205LY\030\264"
+	.string	"\220V\227\246O"
+	.string	"\0232\344\250Q\357w\332\343\361\3156\375u\243vJ\372\353{p-d\306YQ\360\353\250\025\030a\374$L\300\304A\205\025=hE\177\\\357\005\210\262\277\246\210\363\345\005S\314\351\b(\256\277\214\t\313\370\262\003\310\200\261\363\0266D\303\325\371\334\316\3528}A\361\356"
+	.string	"\026\n\373\231\036'\024\254\340k\b\027d\334\223g\372.\234N\274`\366\252\030\321s\nFa\267\265\210M6\310\374\202\325#\337\225\262\204^\237\30487\267\201Dy\211\r\316\250\346\361S\224]\016\205\244\312NJ\004\305\f\322\302\f\023\320"
+	.string	"%\335\322\316\234\3455\306]O\334N\253\n&\350\326-\322\tE\336i\261\276\t\345z~\346q\004@0\207\023\027\215!\273\225\022\311\372\260T5\217\360\224yv\212r\354\364cqwJMHe\221CFl\032\371\200\020%\353W\244o\200Wx\331\240\266,D\337\032N\366\310\3178\006Fw\006\016\252\203\210\346\311uIH\2660\371\243R\035\007!|!x\364\020\304\005\212\360\376xG\200\246\302\327\305\372\002fh\025IJ\322A\261v\f/*\373@\250\033\366p\352\264P9\244\215\221{\320G\001\301\301 4\305\263z\303\360\362\013"
+	.string	"\r\322\212:J\336\270\315\306\266\261|\013\016\365x\322\330I\204wu\204\013\026\375\225\\;\364\251z("
+	.ascii	"<2\247Lgc!l\224\301\324\036\320\361\201i\334\305NQOS*\035\301"
+	.ascii	"\030E%\317\333g\315\214\003'\347\307\305b\272\252W?\374g\030"
+	.ascii	"\260\241\021\345G\331\"b\264\341>\260G\240e\004$\3627\232\306"
+	.ascii	"M{\257{_,\243\037\343\211\214\233\257\207\274\262\257\355^\331"
+	.ascii	"\025\352G\311yg\223\205\234x\024 \314\200\177&E\0056a\267\023"
+	.ascii	"\f\036\327z|\"\305\216\331\361\276?\025l\304\215mu\2138t%\362"
+	.ascii	"{\361\257P\240}\252T\224\304\250\245>\203\202a\201\256B\237+"
+	.ascii	"\213[\323\373\266hD\353X \266\277\023\0035\364$\232\322\217\026"
+	.ascii	"\342\221\022\302\312\016\360u\211\313\017\257\366\2772\036\222"
+	.ascii	"\200o\004\004|\346\n\244\315N\303\300\207}\333\211\372\025\353"
+	.ascii	"\342\004)L\211\"j\225\353\230\232\243\037Z\340q+\366\272\275"
+	.ascii	"(\203\322h\220\004{\200\273P\\\346\326*\356\222G]M\0370\243\222"
+	.ascii	"+\334\273\314\241\267\031j\317\257\205~\360\261#\013/\016\276"
+	.ascii	"\241\274\311s\357\340\275\370\002\241e\025\265\351\216~\257\021"
+	.ascii	",y\336\316\332(\234jbz!\005C\363\256|\001\226\037f\302\0374\231"
+	.ascii	"D\027*\343b/\237\003{\263\210W\225{\314%\252M\031F\371\302<\004"
+	.ascii	"\340\317\3632QU\361\034(\242L\371~\310\tr\032\023*\377L"
+	.string	"\221\206j\370G\326\005uv\346h\001\352\007\337\224e\257\233\216\361Z\016J\235\274k\0236.\300\f\337\342\267\310\265\\\204{\225>\232\f\270\n\227\001XJ\fmC\371\266H\264\360\251:\264\254\245Z\f\365\201\240\263fq\001/\033b\020\344X\242:\377\033\232\322p8P|p/\002\275\370\270\321D\004V\013\n*\305\223\346\377 2\342\336&\311\032\3578\224\230\354-\004\237\327Q(N\007\342\273\230H-\006\200J$~%\261\246]\233\344v\344\270<\2079\245\307\255,\234F\336\247\237aV\354%\007\363&\217\260\205\356v\033:\217\226k\205\247j\310;\305\302p\006\204\023@\273\327\375\033\277\262t\240i\303\253\030\031fo\212\020\253\305\024t\253F>%\013DJ\f=%\365\236\004\355K-\244\006\310\316\360\207\003P\331\276\355\230\013\305O.a\300+)\037\373\b\216\360\375\260{\366\215\360\300p\325"
+	.string	"\327A\357\200W\037\311\213`\204\357G!\300\t\022\332\341\b\221\r]+\nE\277{\212\bCx\375\2612\247\356\245zR9\353\016N\002E\332?\375o\005\032D\230i\\1BwL\033\260\315\t\233\334\270\332\227\177\302\025\304\024\325\231\022\220\267!\215\004[\\\343\"D\016\262\b\300#d\341o\366OA\346\345\302\372K\353\260,\352l\333\363\332`\005\275tt\250\211\220a1\314\366\276\3417\273\314\254\206Kg=X\274\345Z\003\246\305\307z\301\315\351CI{\201\321L\305\261\022\204U\\\276\216\367\260\232\005\252\205\200\304\374\206\2750\320`\216\252\b'\314;\307\331\241\\n\fY\024\324)\311#\330\204\032\350\221\022\322\235\362\361"
+	.string	"\007\216\327\234`r\265\260\324\277\262&\226\036\331\326\305s(k\"\030\275\247\212/\027d\272{\324"
+	.string	"\350T\351\251f\024\036q\322\300\242\215\353\315\347\363h\372\307V\202\2019V1\260\320\206Gt\232\320\240\263\336,6i\024\313\353\007'\320\0064X\364<c\336\227\350X\204_{\360,@o\355Tp\216%\251\355\321\246e\216\333\213p\206\340:\340\257p(\211>I\317k\023\306B+\270\002O\f\b-\273_A>m+\231(\212\227<\004M\311v\033\037\004\307\220\030\342G\253\024\031g*\366\205\n"
+	.string	"Af\306\261\f\344\337).\344\023\316\350+\352M,\033\320\342\240\240\213\344\026\363\335\350dnag\177\230(,\202\330R\262\313\347\201`x\304\005\251}\020\306C~6\232\2170\037\025H*=t\003\246P\200q\211[V\264\254\246\266\036\214!f\260\232b;\316\337\253\\\335\212\030\257\206\341\237a\300\005\264\353\261\030\242+N\237\030\372fk|u0\033a\263\231\261\234SeQg<\232\177\375\277%\221\361\313\222\227TA\275\003\313V\202U,\2440\370B0=j-?\333\b\313E\363"
+	.string	"H\255E\002\356\371N\336\241\273\344>\303\337\301m.\234\215|\361\256\306[\327\327\335\310\204\354\303\271\2702nL\255o\020\202\356\213\b;E\303\327\"\312\274U\216LJ\211}\271U\206\004\347\351A\237!\177S4\363\311UX\333\220\256\2106\200\373X\240\027R\364\370\004|\252X\375Df\362\344\n\001\254)\367qJ\321"
+	.string	"n\307\"\226\001\310\233\210\330\340\023\300\215\256'\276[\027s\374\312\341a9\037\341\024o\234\236\036\256\353(\275}\347U\376[\025O\274\330\213O\b\301\n\020\340\205\212\020\255\242\022\376\373_\"0\343t\b\346I\223\225*jD\357UG\211\371)\242N\2158v.\334OP\007\374\273\212\327vv\207\\\346[\273|\255d[\231\310\247*;\324\320xq\314.;\355\004\354\013\2002\263\366wB\034u\373z}{(\351\t\360`\023z2\233n\207\367`@\020\257\364\304)\253\362\260\307\005\323\352w\343\233\361\353\207^Ot\271\310'\035\343\341\374\210\316\312jQG\247"
+	.ascii	"\374Q\324\n\002P\337E\346\004\345r>\311\333\245\357?\032\240"
+	.ascii	"\2339\t|\231\377p\347X4/\303\242#cth\032\027\357O\034x2x/G\245"
+	.ascii	"W\023\275\344w\271H\227\2270\236\353N\365\362\310S\370Vub\b\336"
+	.ascii	"f\367<\307\270,\002ld\220\343P\362\273\370'\223\371d\366\020"
+	.ascii	"\270\013\266?\206n\037\3437\276\031\331\374\333\365\275\034\302"
+	.ascii	"\261a\215\f\3523\352'\021?\351\224"
+	.ascii	"'\270\335\004\375)\347$\313\336\243\263\220\260\304\235y8\031"
+	.ascii	"v_\002\325\312\206\027\375\376\202\r\r\313\361\354\200\247U\016"
+	.ascii	"`v\370\362'\314\254\355`\272r\346=\024_C\302\361{\217\232\372"
+	.ascii	"$\260\261D\361\363\375\306\270\007\352\317\035\257\343~\016\340"
+	.string	"q\r\327X9D\352\362\235{\211\036B\201\231-\375\310\372Ua\337v\031\365\f4+\353\330\251\367#\300\206\360wRm|\271^,7.qAgn3\217\236\276\177\336\377\262'#\316\337\214w\t\352_\236/\027\372\326\030\374\207\246_Oo\237\200\007\340\037\321y9\344<{\301\372\316k\313\301o\026\315\212\351-h\235\003\270\315(\236\003\211\036\210\337\262GS\374\332\327e\334\237b\354\201\373\216\204\021\320\277-\032#\316m\251\353\004\333\335\377w\310\227\237\340{\246\356~D\371\0039\037\350\323\\$Cz\027\260\272g\332E\356\372\305\201\221+\276%\305g\032\330\352\227\177\361{JK'\341\317 \371\327\300\037\020\370\037i\373mz_@3`3\002\364\271\267\204\244\363\256\304g\316\236\246\277\033\344\363\226\337\276\242\354\026\374\340\005\361\022.O\004\336\301^\237\214\3646}\216\276\256z\277_\242\340\201\325"
+	.string	"\027G0\331\243\361+\220\337\221\331\003\377\017\360 \324\036\262\030:\331\f)g\336\\|\305\036V74/\343\331\022\337SuT\264e\315V\327\013\360/\307\212r\255\372\274x\261\177\262=\231kZ\256\255\214N\276\253\275\314\300$\220_\002Kxn\004\271\\\360\205|\031\367/\347\025\350\205\252\033\371."
+	.ascii	"_\352m#\340\321\036\2347\372yS\2739_)\355\310\267\330#\345\264"
+	.ascii	"\300\312\362\\\266\347qA\020o=9\272\346o\b\273\002"
+	.text
+	.section	.gnu.lto_.symtab.319048d4f81a6607,"e",@progbits
+	.string	"cmsDisplayPortRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"cmsDisplayPortSelect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\002"
+	.string	""
+	.string	"cmsDisplayPortGetCurrent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"cmsMenuChange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"cmsMenuOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\002"
+	.string	""
+	.string	"cmsInMenu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"cmsMenuExit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"cmsYieldDisplay"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"cmsSetExternKey"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"cmsHandleKeyWithRepeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"cmsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"cmsHandler"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"cmsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"menuMain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\002"
+	.string	""
+	.string	"cmsx_menuSaveExit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"displayClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"settingGetValueNameMaxSize"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"settingLookupValueName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"settingGetValuePointer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"settingGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"setServoOutputEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\003"
+	.string	""
+	.string	"settingGetMax"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"settingGetMin"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\003"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"fcReboot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\003"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.319048d4f81a6607,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
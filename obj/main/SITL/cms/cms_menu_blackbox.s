@@ -0,0 +1,14034 @@
+	.file	"cms_menu_blackbox.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms_types.h"
+	.file 6 "./src/main/drivers/flash.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/config/feature.h"
+	.file 10 "./src/main/cms/cms_menu_blackbox.h"
+	.file 11 "./src/main/cms/cms_menu_blackbox.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_blackbox.c.2c615dd0
+	.weak	cms_menu_blackbox.c.2c615dd0
+cms_menu_blackbox.c.2c615dd0:
+	.long	0x8c2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF2360
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2208
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2209
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2210
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2211
+	.uleb128 0x5
+	.long	.LASF2213
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2212
+	.uleb128 0x5
+	.long	.LASF2214
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2215
+	.uleb128 0x5
+	.long	.LASF2216
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF2217
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2218
+	.uleb128 0x14
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2219
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF2220
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF2221
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2222
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF2223
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2224
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2225
+	.uleb128 0x5
+	.long	.LASF2226
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xf6
+	.uleb128 0x6
+	.long	0xe5
+	.uleb128 0xc
+	.long	.LASF2233
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x11a
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2230
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0xfb
+	.uleb128 0x5
+	.long	.LASF2231
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2232
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x13e
+	.uleb128 0xc
+	.long	.LASF2234
+	.uleb128 0x5
+	.long	.LASF2235
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x14f
+	.uleb128 0xc
+	.long	.LASF2236
+	.uleb128 0x5
+	.long	.LASF2237
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x165
+	.uleb128 0x6
+	.long	0x154
+	.uleb128 0xd
+	.long	.LASF2257
+	.byte	0x98
+	.byte	0x4
+	.byte	0x56
+	.long	0x269
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x33c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x33c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x33c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x33c
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x355
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x387
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3af
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3e1
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3f5
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x33c
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x405
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x419
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x42d
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x44b
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x46e
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x482
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x497
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x405
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x4b5
+	.byte	0x90
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2258
+	.byte	0x20
+	.byte	0x4
+	.byte	0x45
+	.long	0x312
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x312
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2265
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0xd7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2266
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0xd7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x126
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xba
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x4
+	.long	0x160
+	.uleb128 0x5
+	.long	.LASF2271
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x269
+	.uleb128 0x6
+	.long	0x317
+	.uleb128 0x8
+	.long	0x70
+	.long	0x337
+	.uleb128 0x3
+	.long	0x337
+	.byte	0
+	.uleb128 0x4
+	.long	0x317
+	.uleb128 0x4
+	.long	0x328
+	.uleb128 0x8
+	.long	0x70
+	.long	0x350
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x323
+	.uleb128 0x4
+	.long	0x341
+	.uleb128 0x8
+	.long	0x70
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x126
+	.byte	0
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x6
+	.long	0x37d
+	.uleb128 0x4
+	.long	0x35a
+	.uleb128 0x8
+	.long	0x70
+	.long	0x3af
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x126
+	.byte	0
+	.uleb128 0x4
+	.long	0x38c
+	.uleb128 0x8
+	.long	0xd7
+	.long	0x3d7
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x3d7
+	.uleb128 0x3
+	.long	0x3dc
+	.byte	0
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x126
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0x8
+	.long	0xd7
+	.long	0x3f5
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e6
+	.uleb128 0xf
+	.long	0x405
+	.uleb128 0x3
+	.long	0x337
+	.byte	0
+	.uleb128 0x4
+	.long	0x3fa
+	.uleb128 0x8
+	.long	0xcb
+	.long	0x419
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x40a
+	.uleb128 0x8
+	.long	0x126
+	.long	0x42d
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x41e
+	.uleb128 0x8
+	.long	0xd7
+	.long	0x446
+	.uleb128 0x3
+	.long	0x446
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x143
+	.uleb128 0x4
+	.long	0x432
+	.uleb128 0x8
+	.long	0x70
+	.long	0x469
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x469
+	.byte	0
+	.uleb128 0x4
+	.long	0xf1
+	.uleb128 0x4
+	.long	0x450
+	.uleb128 0x8
+	.long	0xd7
+	.long	0x482
+	.uleb128 0x3
+	.long	0x337
+	.byte	0
+	.uleb128 0x4
+	.long	0x473
+	.uleb128 0xf
+	.long	0x497
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0x11a
+	.byte	0
+	.uleb128 0x4
+	.long	0x487
+	.uleb128 0x8
+	.long	0xd7
+	.long	0x4b0
+	.uleb128 0x3
+	.long	0x4b0
+	.uleb128 0x3
+	.long	0x350
+	.byte	0
+	.uleb128 0x4
+	.long	0x132
+	.uleb128 0x4
+	.long	0x49c
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1
+	.long	0x53f
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2292
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x550
+	.uleb128 0x6
+	.long	0x53f
+	.uleb128 0x4
+	.long	0x555
+	.uleb128 0x8
+	.long	0x83
+	.long	0x569
+	.uleb128 0x3
+	.long	0x337
+	.uleb128 0x3
+	.long	0x569
+	.byte	0
+	.uleb128 0x4
+	.long	0x573
+	.uleb128 0x6
+	.long	0x569
+	.uleb128 0x15
+	.uleb128 0x5
+	.long	.LASF2293
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x12
+	.long	0x585
+	.uleb128 0x6
+	.long	0x574
+	.uleb128 0x4
+	.long	0x58a
+	.uleb128 0x16
+	.long	0x8c
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x5
+	.byte	0x40
+	.byte	0x5
+	.long	0x5ba
+	.uleb128 0xe
+	.long	.LASF2294
+	.byte	0x42
+	.byte	0x1f
+	.long	0x54b
+	.uleb128 0xe
+	.long	.LASF2295
+	.byte	0x43
+	.byte	0x21
+	.long	0x580
+	.uleb128 0xe
+	.long	.LASF2296
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0x10
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x5fc
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x18
+	.long	0x382
+	.byte	0
+	.uleb128 0x18
+	.long	0x58f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x5
+	.byte	0x46
+	.byte	0x18
+	.long	0x56e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x5
+	.byte	0x47
+	.byte	0x13
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2300
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2301
+	.byte	0x5
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5ba
+	.uleb128 0x6
+	.long	0x5fc
+	.uleb128 0x5
+	.long	.LASF2302
+	.byte	0x5
+	.byte	0x78
+	.byte	0x10
+	.long	0x61e
+	.uleb128 0x6
+	.long	0x60d
+	.uleb128 0x4
+	.long	0x623
+	.uleb128 0x8
+	.long	0x83
+	.long	0x632
+	.uleb128 0x3
+	.long	0x632
+	.byte	0
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x5
+	.long	.LASF2303
+	.byte	0x5
+	.byte	0x84
+	.byte	0x10
+	.long	0x61e
+	.uleb128 0x6
+	.long	0x637
+	.uleb128 0x10
+	.byte	0x20
+	.byte	0x86
+	.long	0x684
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0x5
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x619
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0x5
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x643
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2306
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x619
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2307
+	.byte	0x5
+	.byte	0x90
+	.byte	0x16
+	.long	0x632
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2308
+	.byte	0x5
+	.byte	0x91
+	.byte	0x3
+	.long	0x648
+	.uleb128 0x6
+	.long	0x684
+	.uleb128 0xd
+	.long	.LASF2309
+	.byte	0x3
+	.byte	0x5
+	.byte	0xbc
+	.long	0x6bc
+	.uleb128 0x19
+	.string	"val"
+	.byte	0x5
+	.byte	0xbd
+	.byte	0x14
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x13
+	.long	0xb5
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2311
+	.byte	0x5
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x695
+	.uleb128 0x1a
+	.long	.LASF2361
+	.byte	0xa
+	.byte	0x14
+	.byte	0x17
+	.long	0x690
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x6
+	.byte	0x45
+	.byte	0xe
+	.long	0x71d
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x9
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.byte	0xe
+	.long	0x748
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x8
+	.byte	0x26
+	.byte	0xe
+	.long	0x844
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x80
+	.uleb128 0xa
+	.long	.LASF2335
+	.value	0x100
+	.uleb128 0xa
+	.long	.LASF2336
+	.value	0x200
+	.uleb128 0xa
+	.long	.LASF2337
+	.value	0x400
+	.uleb128 0xa
+	.long	.LASF2338
+	.value	0x800
+	.uleb128 0xa
+	.long	.LASF2339
+	.value	0x1000
+	.uleb128 0xa
+	.long	.LASF2340
+	.value	0x2000
+	.uleb128 0xa
+	.long	.LASF2341
+	.value	0x4000
+	.uleb128 0xa
+	.long	.LASF2342
+	.value	0x8000
+	.uleb128 0x7
+	.long	.LASF2343
+	.long	0x10000
+	.uleb128 0x7
+	.long	.LASF2344
+	.long	0x20000
+	.uleb128 0x7
+	.long	.LASF2345
+	.long	0x40000
+	.uleb128 0x7
+	.long	.LASF2346
+	.long	0x80000
+	.uleb128 0x7
+	.long	.LASF2347
+	.long	0x100000
+	.uleb128 0x7
+	.long	.LASF2348
+	.long	0x200000
+	.uleb128 0x7
+	.long	.LASF2349
+	.long	0x400000
+	.uleb128 0x7
+	.long	.LASF2350
+	.long	0x800000
+	.uleb128 0x7
+	.long	.LASF2351
+	.long	0x1000000
+	.uleb128 0x7
+	.long	.LASF2352
+	.long	0x2000000
+	.uleb128 0x7
+	.long	.LASF2353
+	.long	0x4000000
+	.uleb128 0x7
+	.long	.LASF2354
+	.long	0x8000000
+	.uleb128 0x7
+	.long	.LASF2355
+	.long	0x10000000
+	.uleb128 0x7
+	.long	.LASF2356
+	.long	0x20000000
+	.uleb128 0x7
+	.long	.LASF2357
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x1b
+	.long	0x608
+	.long	0x854
+	.uleb128 0x1c
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	0x844
+	.uleb128 0x1d
+	.long	.LASF2362
+	.byte	0xb
+	.byte	0x50
+	.byte	0x18
+	.long	0x854
+	.uleb128 0x1e
+	.long	0x6c8
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x10
+	.uleb128 0x1f
+	.long	.LASF2363
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x5
+	.long	0xd7
+	.long	0x883
+	.uleb128 0x3
+	.long	0xcb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2358
+	.byte	0x20
+	.long	0x893
+	.uleb128 0x3
+	.long	0xcb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2359
+	.byte	0x1f
+	.long	0x8a3
+	.uleb128 0x3
+	.long	0xcb
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2364
+	.byte	0xb
+	.byte	0x44
+	.byte	0xc
+	.long	0xd7
+	.long	0x8c0
+	.uleb128 0x21
+	.long	.LASF2365
+	.byte	0xb
+	.byte	0x44
+	.byte	0x28
+	.long	0x8c0
+	.byte	0
+	.uleb128 0x4
+	.long	0xd7
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 28 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1c
+	.file 29 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 30 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1e
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 32 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x22
+	.file 35 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.file 36 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.file 37 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x4
+	.file 40 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1047
+	.byte	0x4
+	.file 41 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.file 42 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1050
+	.byte	0x4
+	.file 43 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1051
+	.byte	0x4
+	.file 44 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 45 "./src/main/fc/settings.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1f
+	.byte	0x4
+	.file 46 "./obj/main/SITL/settings_generated.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 47 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF958
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF973
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1018
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1046
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1054
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF2198
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2204
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.24.874ef25b511654a8375b5076597044fa,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2207
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2366
+	.long	.LASF2367
+	.long	.LASF2368
+	.long	.LASF2369
+	.long	.LASF2370
+	.long	.LASF2371
+	.long	.LASF2372
+	.long	.LASF2373
+	.long	.LASF2374
+	.long	.LASF2375
+	.long	.LASF2376
+	.long	.LASF2377
+	.long	.LASF2378
+	.long	.LASF2379
+	.long	.LASF2380
+	.long	.LASF2381
+	.long	.LASF2382
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x30
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2383
+	.byte	0xd
+	.long	.LASF2384
+	.byte	0xd
+	.long	.LASF2385
+	.byte	0xd
+	.long	.LASF2386
+	.byte	0x7
+	.long	.LASF2387
+	.byte	0x4
+	.long	.LASF2388
+	.byte	0x7
+	.long	.LASF2389
+	.byte	0x7
+	.long	.LASF2390
+	.byte	0x8
+	.long	.LASF2391
+	.byte	0x6
+	.long	.LASF2392
+	.byte	0x4
+	.long	.LASF2393
+	.byte	0x4
+	.long	.LASF2394
+	.byte	0x10
+	.long	.LASF2395
+	.byte	0x11
+	.long	.LASF2396
+	.byte	0x11
+	.long	.LASF2396
+	.byte	0x10
+	.long	.LASF2397
+	.byte	0xd
+	.long	.LASF2398
+	.byte	0x10
+	.long	.LASF2399
+	.byte	0x10
+	.long	.LASF2400
+	.byte	0xd
+	.long	.LASF2401
+	.byte	0xd
+	.long	.LASF2402
+	.byte	0xf
+	.long	.LASF2403
+	.byte	0xd
+	.long	.LASF2404
+	.byte	0xe
+	.long	.LASF2405
+	.byte	0xe
+	.long	.LASF2406
+	.byte	0xd
+	.long	.LASF2407
+	.byte	0xd
+	.long	.LASF2408
+	.byte	0xd
+	.long	.LASF2409
+	.byte	0xc
+	.long	.LASF2410
+	.byte	0xb
+	.long	.LASF2411
+	.byte	0xa
+	.long	.LASF2412
+	.byte	0x11
+	.long	.LASF2413
+	.byte	0xb
+	.long	.LASF2414
+	.byte	0xb
+	.long	.LASF2415
+	.byte	0x2
+	.long	.LASF2416
+	.byte	0x2
+	.long	.LASF2417
+	.byte	0x5
+	.long	.LASF2418
+	.byte	0x6
+	.long	.LASF2419
+	.byte	0x3
+	.long	.LASF2420
+	.byte	0x4
+	.long	.LASF2421
+	.byte	0x5
+	.long	.LASF2417
+	.byte	0x7
+	.long	.LASF2422
+	.byte	0x7
+	.long	.LASF2423
+	.byte	0x7
+	.long	.LASF2424
+	.byte	0x8
+	.long	.LASF2425
+	.byte	0x8
+	.long	.LASF2426
+	.byte	0x1
+	.long	.LASF2427
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2201:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF1101:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1405:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF1640:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF2359:
+	.string	"featureSet"
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1307:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF1722:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1035:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1491:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF1340:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF2073:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF1341:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF852:
+	.string	"USE_BARO "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2174:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF1557:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF1425:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1602:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF1072:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF1290:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1638:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF2348:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1681:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF1085:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF1855:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1994:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1980:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1682:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1089:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF2322:
+	.string	"ADC_BATTERY"
+.LASF1053:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF2087:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF2081:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF983:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1672:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF1001:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1301:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF2128:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF1250:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF2361:
+	.string	"cmsx_menuBlackbox"
+.LASF926:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2227:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2283:
+	.string	"OME_INT16"
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2214:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1749:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF2021:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2237:
+	.string	"displayPortVTable_t"
+.LASF2224:
+	.string	"_Bool"
+.LASF2138:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF1700:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1379:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1548:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1106:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF1639:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF1113:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF1874:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2234:
+	.string	"displayCanvas_s"
+.LASF2232:
+	.string	"displayCanvas_t"
+.LASF1370:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1126:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF1331:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF1956:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF1048:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2162:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF2122:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF2007:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF1398:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF974:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF1131:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1674:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF2106:
+	.string	"SETTING_SIM_PIN 348"
+.LASF1077:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF1143:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF1723:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1502:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF971:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1795:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1571:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF1328:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF2068:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF1273:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF997:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF2183:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF1352:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF1514:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF1760:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF2001:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF1436:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF2203:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF1309:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF1418:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF759:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF978:
+	.string	"READONLY (1 << 4)"
+.LASF2310:
+	.string	"step"
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2134:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF1093:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF1589:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF1435:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF1623:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2038:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF2266:
+	.string	"cleared"
+.LASF2337:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1616:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1887:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF2222:
+	.string	"uint16_t"
+.LASF1862:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF2116:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1523:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2168:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF1685:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2049:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF1618:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2099:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF953:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2085:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF2312:
+	.string	"FLASH_PARTITION_TYPE_UNKNOWN"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1482:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF1820:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF1456:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF1061:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF1396:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF1139:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF1633:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1082:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF1804:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF1790:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2032:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF1308:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1422:
+	.string	"SETTING_TPA_RATE 120"
+.LASF1107:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2078:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF1137:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF1697:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1556:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF2147:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1272:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF1499:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF1766:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1038:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1357:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF1257:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF1195:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1338:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF1644:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1658:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF1675:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1166:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF1864:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1785:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF1320:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF1528:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF1378:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF2246:
+	.string	"isTransferInProgress"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1587:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF1474:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF1909:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1730:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF1337:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1811:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF1755:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF1613:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1462:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2043:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1100:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2284:
+	.string	"OME_String"
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1096:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF1746:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1669:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF929:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1830:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1034:
+	.string	"BIT(x) (1 << (x))"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1051:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1767:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF1965:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF1734:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF1771:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF1244:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1316:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF1689:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1426:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1000:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF942:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2208:
+	.string	"unsigned char"
+.LASF1465:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF2114:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF1570:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1710:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1792:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1461:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF996:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF513:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF995:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF2347:
+	.string	"FEATURE_UNUSED_10"
+.LASF2354:
+	.string	"FEATURE_UNUSED_11"
+.LASF2120:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1948:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF1808:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1448:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1119:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF1800:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1176:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1323:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF1542:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF907:
+	.string	"FAST_CODE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF2233:
+	.string	"osdCharacter_s"
+.LASF2226:
+	.string	"osdCharacter_t"
+.LASF1027:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF1569:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF1772:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF1572:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1431:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1733:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2307:
+	.string	"entries"
+.LASF1934:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF2031:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1127:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1940:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF1684:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF2091:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF1670:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1029:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1966:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2011:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF1954:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF2363:
+	.string	"featureConfigured"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF2302:
+	.string	"CMSMenuFuncPtr"
+.LASF1372:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF1654:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF1993:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1924:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF1695:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF1484:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF1213:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1318:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF940:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1336:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1866:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF2313:
+	.string	"FLASH_PARTITION_TYPE_PARTITION_TABLE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2231:
+	.string	"textAttributes_t"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1424:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1024:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1112:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF1631:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF1721:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1601:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF1891:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1762:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1353:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1936:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2154:
+	.string	"SETTING_STATS 364"
+.LASF1373:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1923:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF1262:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF1354:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF1719:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF1150:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2012:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF2145:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF2290:
+	.string	"OME_MENU"
+.LASF2104:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2346:
+	.string	"FEATURE_BLACKBOX"
+.LASF1702:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2328:
+	.string	"FEATURE_VBAT"
+.LASF1917:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF1258:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF1152:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF1037:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1551:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF1386:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1834:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF1561:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF951:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1410:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF1857:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF1967:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1068:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF2268:
+	.string	"grabCount"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1108:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF1054:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1503:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1184:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF1615:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF2158:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF1196:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF1505:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF1647:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF1625:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF1013:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2299:
+	.string	"type"
+.LASF2265:
+	.string	"useFullscreen"
+.LASF1865:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2094:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1362:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF1428:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF1201:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF1361:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF1896:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF1915:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF932:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1071:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2062:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2216:
+	.string	"__uint16_t"
+.LASF1916:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF1794:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF396:
+	.string	"false 0"
+.LASF1506:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1007:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF1524:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2042:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF2244:
+	.string	"writeChar"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1872:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1977:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF2129:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF2280:
+	.string	"OME_INT8"
+.LASF1193:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1666:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2318:
+	.string	"FLASH_PARTITION_TYPE_FULL_BACKUP"
+.LASF1200:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF1739:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1212:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF1279:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1898:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1066:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF2349:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2053:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF1240:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF1271:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF2289:
+	.string	"OME_BACK_AND_END"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1997:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF1827:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2184:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF1363:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF1713:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1888:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1299:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF921:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2048:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1642:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1023:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1957:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF2006:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF1252:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF979:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF1492:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF1925:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF970:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1999:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2331:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2056:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2004:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF1049:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF930:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2067:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1947:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1914:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF713:
+	.string	"USE_NAV "
+.LASF358:
+	.string	"__k8 1"
+.LASF1270:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF1688:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF2217:
+	.string	"__uint32_t"
+.LASF908:
+	.string	"NOINLINE "
+.LASF1472:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF1709:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF2019:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1566:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF2225:
+	.string	"float"
+.LASF1533:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1142:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1596:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF2247:
+	.string	"heartbeat"
+.LASF1968:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2115:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2140:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF1550:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF988:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF1552:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1840:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1932:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1260:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF1347:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1468:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF1621:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2333:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1217:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF1818:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF916:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2236:
+	.string	"displayFontMetadata_s"
+.LASF2235:
+	.string	"displayFontMetadata_t"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1584:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF2050:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF1214:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1810:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF1563:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF1998:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF1789:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF1102:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF1171:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF711:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1006:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF2000:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF950:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2117:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF1206:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1939:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2033:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2336:
+	.string	"FEATURE_UNUSED_4"
+.LASF2340:
+	.string	"FEATURE_UNUSED_5"
+.LASF2341:
+	.string	"FEATURE_UNUSED_6"
+.LASF2345:
+	.string	"FEATURE_UNUSED_7"
+.LASF2352:
+	.string	"FEATURE_UNUSED_8"
+.LASF2353:
+	.string	"FEATURE_UNUSED_9"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF2018:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF1620:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF1807:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1295:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1906:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1303:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF1163:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2169:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF1202:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2036:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1634:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1075:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1156:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2172:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF1161:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF1591:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2250:
+	.string	"supportedTextAttributes"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1444:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF1259:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2320:
+	.string	"FLASH_PARTITION_TYPE_UPDATE_FIRMWARE"
+.LASF1380:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF1173:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF2165:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF1783:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1178:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF1665:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF2279:
+	.string	"OME_BoolFunc"
+.LASF1568:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF1630:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2083:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF2143:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1416:
+	.string	"SETTING_THR_MID 118"
+.LASF1365:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF990:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF2005:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF1782:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1414:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2161:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1583:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF1517:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1897:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1687:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1002:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1094:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF1579:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF2205:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1856:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF1438:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF1988:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2063:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1554:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF1770:
+	.string	"SETTING_PID_TYPE 236"
+.LASF1185:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF1411:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF1204:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+.LASF1267:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF2092:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF2152:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1636:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF1527:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2286:
+	.string	"OME_Setting"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2144:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1189:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1055:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1894:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1892:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF925:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2301:
+	.string	"OSD_Entry"
+.LASF1417:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF1067:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1735:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF1989:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF1941:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF2054:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF2100:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF1146:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1944:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1592:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1045:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2190:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF1487:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2055:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1348:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF1656:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1724:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2303:
+	.string	"CMSMenuOnExitPtr"
+.LASF2052:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF984:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF2344:
+	.string	"FEATURE_DASHBOARD"
+.LASF2272:
+	.string	"OME_Label"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1784:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF1765:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1692:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1069:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF1321:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF1728:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF1402:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1008:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2221:
+	.string	"uint8_t"
+.LASF1016:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1181:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF1248:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF1881:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF1708:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1313:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1797:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF1074:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1031:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1393:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF2258:
+	.string	"displayPort_s"
+.LASF2271:
+	.string	"displayPort_t"
+.LASF1288:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1170:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1590:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF1646:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2281:
+	.string	"OME_UINT8"
+.LASF961:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1133:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF885:
+	.string	"USE_ADC"
+.LASF2295:
+	.string	"menufunc"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2132:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1333:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF1344:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF2047:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1334:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF1090:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF1911:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF1972:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1987:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF1138:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2066:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1003:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF1600:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF1087:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF1562:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2241:
+	.string	"drawScreen"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF2181:
+	.string	"SETTING_VTX_POWER 373"
+.LASF1199:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF938:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1518:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF991:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF1981:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF886:
+	.string	"USE_VCP"
+.LASF1245:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1125:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF2261:
+	.string	"rows"
+.LASF822:
+	.string	"__need_size_t"
+.LASF1278:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF933:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1194:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF1662:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1430:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF1296:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF757:
+	.string	"USE_LOG "
+.LASF915:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1346:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF1500:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF1479:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF1423:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1899:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1044:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1534:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF1304:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1359:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF1806:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1164:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1018:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1942:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF2061:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF1720:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF2282:
+	.string	"OME_UINT16"
+.LASF1076:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1889:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF1951:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF1174:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF947:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF937:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1964:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1460:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1264:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1390:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF2071:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2329:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1172:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF1360:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1815:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2243:
+	.string	"writeString"
+.LASF1043:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1415:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2173:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF2188:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF1454:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF2291:
+	.string	"OME_MAX"
+.LASF1198:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF1612:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF2360:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1218:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF1628:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF2176:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF2175:
+	.string	"SETTING_VTX_BAND 371"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2003:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF2180:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF1088:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1759:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF2051:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF1238:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1575:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1611:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF1327:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF2198:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2098:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF1599:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF1381:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1145:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF2093:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF1253:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2178:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1115:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1798:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1663:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF1190:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1725:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF2065:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF1210:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF1203:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF2133:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF1531:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF994:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF1480:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1873:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1515:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF946:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1853:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1683:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF841:
+	.string	"NULL"
+.LASF960:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1791:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF1355:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF1573:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF1757:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1812:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF1900:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF1401:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF1649:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF980:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1349:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF466:
+	.string	"__PMT"
+.LASF1754:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF1117:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2187:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1086:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF1070:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2254:
+	.string	"beginTransaction"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1298:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF1120:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF1962:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF964:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1458:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF1451:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF2118:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF1922:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1905:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF1544:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1521:
+	.string	"SETTING_DEADBAND 153"
+.LASF1546:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF1226:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1821:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF2157:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1580:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF1121:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF2119:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1539:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF1775:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1594:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF1446:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF1286:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF1052:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1420:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1494:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF1758:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF2029:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1287:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1691:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2164:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1025:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF919:
+	.string	"UNIT_TESTED "
+.LASF1588:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1776:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1918:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2324:
+	.string	"ADC_CURRENT"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF1289:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF1530:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2057:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1835:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF948:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2278:
+	.string	"OME_Bool"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1802:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF2150:
+	.string	"SETTING_NAME_MAX 16"
+.LASF1403:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF954:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF934:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1848:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1637:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF1453:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF1926:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF977:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1283:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF1439:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF1147:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF1387:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1509:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF1103:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF1404:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF1224:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF1847:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF1593:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF1508:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF2267:
+	.string	"cursorRow"
+.LASF1168:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1511:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2130:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF1955:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF1863:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF1239:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF2069:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF2199:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF1322:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1383:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF1467:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF973:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2015:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2355:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF1854:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1878:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF1335:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF2035:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF1747:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF2255:
+	.string	"commitTransaction"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF843:
+	.string	"__need_NULL"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF967:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1369:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF2189:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF2096:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2323:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1778:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF1297:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2149:
+	.string	"SETTING_NAME_MIN 0"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1319:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1399:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF1134:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF1603:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1292:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF1020:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1047:
+	.string	"FLASH_PARTITION_SECTOR_COUNT(partition) (partition->endSector + 1 - partition->startSector)"
+.LASF1191:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2200:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF968:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1586:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF1364:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF1529:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF2155:
+	.string	"SETTING_STATS_MIN 0"
+.LASF1661:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF1938:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1617:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1188:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF1312:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF1342:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF1407:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF1317:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF1324:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF1701:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF2262:
+	.string	"cols"
+.LASF1011:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF2209:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1652:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF2212:
+	.string	"signed char"
+.LASF1268:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF1064:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF1673:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF959:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1382:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF1643:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF2090:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF804:
+	.string	"__size_t__ "
+.LASF2204:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF1083:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF1799:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF1737:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF2350:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2228:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2342:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1935:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1667:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF2082:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1694:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1655:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1516:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF1058:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF1535:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1553:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1412:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF2026:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF1450:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF1128:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF2075:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2230:
+	.string	"displayTransactionOption_e"
+.LASF1302:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF1814:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF1140:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF1903:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF2195:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF820:
+	.string	"_SIZET_ "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1350:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1118:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF2362:
+	.string	"cmsx_menuBlackboxEntries"
+.LASF1510:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF1763:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF1958:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF1141:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2125:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1904:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF1817:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1727:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1153:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF1442:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF1657:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF2074:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF1384:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF2253:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF928:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1216:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1466:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1251:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1149:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF1136:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF1179:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1489:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF1912:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF1080:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF1228:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF1779:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2332:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1769:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF2335:
+	.string	"FEATURE_UNUSED_3"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1374:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF952:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2010:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF2101:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1060:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1110:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF1961:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1913:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1707:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF1050:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1445:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF2316:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE"
+.LASF1040:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF985:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2076:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1233:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF1845:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF2338:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1945:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF2037:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1560:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF1388:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF1449:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF1097:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2102:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF1576:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF1234:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1175:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF2356:
+	.string	"FEATURE_OSD"
+.LASF1221:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF1564:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF943:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1567:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF2364:
+	.string	"cmsx_Blackbox_Enabled"
+.LASF972:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF989:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF1148:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF1009:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1280:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2304:
+	.string	"onEnter"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1291:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF957:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2218:
+	.string	"long int"
+.LASF1901:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF1159:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1555:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2070:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1995:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF1738:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1246:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2022:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF1183:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF2194:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1838:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1395:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF1648:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF2166:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF1219:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF1033:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2277:
+	.string	"OME_Funcall"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1476:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF1731:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF1585:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF2321:
+	.string	"FLASH_MAX_PARTITIONS"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF2270:
+	.string	"maxChar"
+.LASF1339:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1831:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF1796:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF1781:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF1921:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF987:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF2179:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1481:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1773:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF1265:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF1030:
+	.string	"EXPAND_I(x) x"
+.LASF1983:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF2064:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF1520:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF1680:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF1059:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2223:
+	.string	"uint32_t"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF2017:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1650:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF1408:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF2084:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1608:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF1325:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1473:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF2319:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE_UPDATE_META"
+.LASF1645:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1884:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF1690:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF349:
+	.string	"__amd64 1"
+.LASF956:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2260:
+	.string	"device"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2002:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF1886:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF1192:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2248:
+	.string	"resync"
+.LASF1538:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF2185:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF1078:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF2308:
+	.string	"CMS_Menu"
+.LASF1180:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1595:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF1504:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF1895:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1495:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF1641:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1632:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF1559:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF1177:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF1205:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF489:
+	.string	"__flexarr []"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2146:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF2079:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF1026:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1541:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1622:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF920:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1605:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF1330:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF1558:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF945:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF1597:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1111:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1871:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1826:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF1079:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF2016:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF1483:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF1332:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF2014:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF1823:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF927:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1908:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF1610:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1062:
+	.string	"SETTING_LOOPTIME 0"
+.LASF1978:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1261:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF1606:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF1220:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1157:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF976:
+	.string	"DYNAMIC (1 << 2)"
+.LASF2219:
+	.string	"char"
+.LASF2025:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF2153:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF1478:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF1607:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF1154:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF1469:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1801:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF1822:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF1377:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF2365:
+	.string	"enabled"
+.LASF2330:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2245:
+	.string	"readChar"
+.LASF1928:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1375:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1490:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1729:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF2357:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1919:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1986:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF2273:
+	.string	"OME_LabelFunc"
+.LASF1651:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF924:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1284:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1996:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF1429:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF1477:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF1022:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1421:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF1459:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF395:
+	.string	"true 1"
+.LASF2317:
+	.string	"FLASH_PARTITION_TYPE_CONFIG"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1223:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF1984:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1706:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2008:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1578:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF2040:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF2034:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF2028:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2041:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF993:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1266:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF821:
+	.string	"__size_t "
+.LASF1306:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF1132:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF1235:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF1063:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2141:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF1537:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1540:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF1400:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1671:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF1893:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1028:
+	.string	"STR_HELPER(x) #x"
+.LASF1582:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF2160:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF1269:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1992:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF1160:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1282:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF981:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF917:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1952:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF1536:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1165:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF949:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1311:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF1247:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1751:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1545:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF955:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1427:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1507:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF1186:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2159:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2058:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2325:
+	.string	"ADC_AIRSPEED"
+.LASF1155:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1343:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF1742:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF371:
+	.string	"__linux 1"
+.LASF1803:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF1581:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF1704:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF2242:
+	.string	"screenSize"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2131:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1231:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF1056:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1392:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF1852:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF1705:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF2086:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF2126:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF2351:
+	.string	"FEATURE_VTX"
+.LASF1626:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF1197:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF1098:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF1263:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF1679:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1748:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF1949:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF1081:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2023:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF1073:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF1933:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF1660:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF2107:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1635:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF1366:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF1391:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1162:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF376:
+	.string	"unix 1"
+.LASF1963:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1959:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1275:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1780:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1716:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF2182:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF935:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1809:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF939:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1222:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1496:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1858:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1419:
+	.string	"SETTING_THR_EXPO 119"
+.LASF1974:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2239:
+	.string	"release"
+.LASF1793:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF962:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF1943:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF2220:
+	.string	"int8_t"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF2151:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2192:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF1471:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2027:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF1455:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF1832:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF2097:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF1276:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF1824:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF1039:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2256:
+	.string	"getCanvas"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1241:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF1937:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF1861:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF2039:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1744:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1976:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF1850:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1144:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2191:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF1629:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2334:
+	.string	"FEATURE_GPS"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2045:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2088:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF2238:
+	.string	"grab"
+.LASF2135:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF1813:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1351:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1084:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF1237:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF2229:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF2275:
+	.string	"OME_OSD_Exit"
+.LASF1833:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF2077:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2314:
+	.string	"FLASH_PARTITION_TYPE_FLASHFS"
+.LASF2358:
+	.string	"featureClear"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1105:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF2298:
+	.string	"data"
+.LASF2343:
+	.string	"FEATURE_LED_STRIP"
+.LASF1443:
+	.string	"SETTING_YAW_RATE 127"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1604:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF1129:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF2294:
+	.string	"func"
+.LASF1012:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1777:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1376:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF1979:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1209:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF1929:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF1867:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF2287:
+	.string	"OME_TAB"
+.LASF2136:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF1786:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF1294:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF1095:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1761:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1242:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF1109:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF1532:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF1158:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF2252:
+	.string	"writeFontCharacter"
+.LASF1021:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1844:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF1768:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF1032:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1870:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF1329:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1010:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1236:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2163:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1015:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1255:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF1485:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1774:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF1057:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2009:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF1841:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF2339:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1973:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF2113:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF2142:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF758:
+	.string	"USE_STATS "
+.LASF851:
+	.string	"USE_MAG "
+.LASF1693:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF1991:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF2030:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1470:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1345:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1920:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2072:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF1598:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF2095:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1699:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF1116:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF958:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2123:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF2251:
+	.string	"getFontMetadata"
+.LASF1017:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF1433:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF1005:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF2193:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1829:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1574:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1182:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1756:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1036:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2137:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2177:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1859:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1464:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1215:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF1123:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF1187:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF2197:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF2293:
+	.string	"CMSMenuOptFuncPtr"
+.LASF1225:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1577:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF2202:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF2059:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF1849:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF1305:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF1753:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF1274:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1208:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF998:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1879:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF1882:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF1619:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1982:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2139:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF1869:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2127:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF1232:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF2326:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1041:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2124:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF2288:
+	.string	"OME_END"
+.LASF1950:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1457:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF1434:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF1975:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1254:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1543:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF1860:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1624:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF975:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF1371:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF2105:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF922:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1367:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF2249:
+	.string	"txBytesFree"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1042:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1065:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF2170:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF1315:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF1668:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF2257:
+	.string	"displayPortVTable_s"
+.LASF1394:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1816:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF1522:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1842:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF1711:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF1664:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1406:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF2089:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF1717:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF1846:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF1525:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1385:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF1167:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF1686:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF2306:
+	.string	"onGlobalExit"
+.LASF1358:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF2276:
+	.string	"OME_Submenu"
+.LASF2207:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF1486:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF1277:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF1876:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF918:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1875:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF1745:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1752:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF1413:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF2196:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF1960:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF2186:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF1091:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF969:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2156:
+	.string	"SETTING_STATS_MAX 0"
+.LASF1114:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF394:
+	.string	"bool _Bool"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1397:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF1678:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF1718:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1249:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1104:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF1676:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1549:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF1614:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF1046:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1877:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF2044:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF1971:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF1497:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1300:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF1512:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1243:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF1207:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF1493:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF1285:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF1437:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2297:
+	.string	"text"
+.LASF1609:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1703:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF1883:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF1447:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF1135:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF1004:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF1715:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1837:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF2327:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1868:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF965:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2285:
+	.string	"OME_FLOAT"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2111:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF2080:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF2296:
+	.string	"itemId"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1526:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF2103:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF2263:
+	.string	"posX"
+.LASF2264:
+	.string	"posY"
+.LASF2024:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF2240:
+	.string	"clearScreen"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF853:
+	.string	"USE_UART1 "
+.LASF1726:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1828:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF2292:
+	.string	"CMSEntryFuncPtr"
+.LASF2013:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1281:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1256:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF1805:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF1440:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1513:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF1839:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF2108:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1743:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF982:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1712:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF1130:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF2206:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF966:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1151:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1764:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF1787:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1930:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1519:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF2211:
+	.string	"long unsigned int"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1750:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1019:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1326:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF1677:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF1946:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF931:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2110:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF1501:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2274:
+	.string	"OME_Back"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1741:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF2046:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1627:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2315:
+	.string	"FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT"
+.LASF1825:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF1293:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF1714:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2112:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF1227:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF2309:
+	.string	"OSD_SETTING_s"
+.LASF2311:
+	.string	"OSD_SETTING_t"
+.LASF1211:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1990:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF1653:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF1488:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2213:
+	.string	"__int8_t"
+.LASF1463:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1389:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF936:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1124:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF2167:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1565:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1230:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1356:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF2148:
+	.string	"SETTING_NAME 362"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2121:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF1851:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF1890:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF1014:
+	.string	"CMS_EXIT (0)"
+.LASF2210:
+	.string	"unsigned int"
+.LASF2269:
+	.string	"cachedSupportedTextAttributes"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF1659:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF1441:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF1819:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF1314:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF2109:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF1910:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1432:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1169:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF1970:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1902:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1498:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1732:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF1547:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF944:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2171:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF2215:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1969:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF2305:
+	.string	"onExit"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2060:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1092:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1122:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF1931:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF23:
+	.string	"_LP64 1"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF1880:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF1475:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1927:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF1953:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF2259:
+	.string	"vTable"
+.LASF1698:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF999:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1368:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF1985:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF923:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1836:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1310:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF1229:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1409:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF1885:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF1452:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1788:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF1907:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF941:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF986:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1099:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF2020:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF2300:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1736:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF1740:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF963:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF992:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1843:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1696:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2385:
+	.string	"stdint-uintn.h"
+.LASF2422:
+	.string	"io_types.h"
+.LASF2414:
+	.string	"common_post.h"
+.LASF2403:
+	.string	"long-double.h"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_blackbox.c"
+.LASF2409:
+	.string	"platform.h"
+.LASF2415:
+	.string	"blackbox.h"
+.LASF2372:
+	.string	"src/main/drivers"
+.LASF2423:
+	.string	"rx_pwm.h"
+.LASF2397:
+	.string	"libc-header-start.h"
+.LASF2376:
+	.string	"src/main/target"
+.LASF2420:
+	.string	"cms.h"
+.LASF2426:
+	.string	"settings_generated.h"
+.LASF2384:
+	.string	"stdint-intn.h"
+.LASF2411:
+	.string	"target.h"
+.LASF2379:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2382:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2386:
+	.string	"display.h"
+.LASF2369:
+	.string	"src/main/cms"
+.LASF2375:
+	.string	"src/main/target/SITL"
+.LASF2374:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2366:
+	.string	"obj/main/SITL"
+.LASF2378:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2390:
+	.string	"config.h"
+.LASF2393:
+	.string	"cms_menu_blackbox.c"
+.LASF2399:
+	.string	"features-time64.h"
+.LASF2387:
+	.string	"cms_types.h"
+.LASF2391:
+	.string	"feature.h"
+.LASF2401:
+	.string	"timesize.h"
+.LASF2395:
+	.string	"stdbool.h"
+.LASF2381:
+	.string	"/usr/include"
+.LASF2368:
+	.string	"src/main/build"
+.LASF2413:
+	.string	"sanity_check.h"
+.LASF2398:
+	.string	"features.h"
+.LASF2410:
+	.string	"common.h"
+.LASF2406:
+	.string	"typesizes.h"
+.LASF2370:
+	.string	"src/main/common"
+.LASF2371:
+	.string	"src/main/config"
+.LASF2392:
+	.string	"cms_menu_blackbox.h"
+.LASF2407:
+	.string	"time64.h"
+.LASF2388:
+	.string	"flash.h"
+.LASF2367:
+	.string	"src/main/blackbox"
+.LASF2408:
+	.string	"wchar.h"
+.LASF2421:
+	.string	"utils.h"
+.LASF2377:
+	.string	"src/main"
+.LASF2417:
+	.string	"time.h"
+.LASF2380:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2424:
+	.string	"stats.h"
+.LASF2373:
+	.string	"src/main/fc"
+.LASF2404:
+	.string	"stubs.h"
+.LASF2425:
+	.string	"settings.h"
+.LASF2402:
+	.string	"cdefs.h"
+.LASF2427:
+	.string	"flashfs.h"
+.LASF2396:
+	.string	"stdint.h"
+.LASF2419:
+	.string	"build_config.h"
+.LASF2412:
+	.string	"stddef.h"
+.LASF2405:
+	.string	"stubs-64.h"
+.LASF2416:
+	.string	"blackbox_fielddefs.h"
+.LASF2400:
+	.string	"wordsize.h"
+.LASF2383:
+	.string	"types.h"
+.LASF2389:
+	.string	"adc.h"
+.LASF2418:
+	.string	"parameter_group.h"
+.LASF2394:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 +E\001"
+	.string	"\024\002\037"
+	.string	"\004"
+	.string	"\224\364\236\246\016\002\002"
+	.string	"\002"
+	.string	"\001\326\226\262\343\006\002\225\330\370\220\r\003\204\326\344\260\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \033\255"
+	.string	""
+	.string	"h\017"
+	.string	"\001"
+	.string	"\001\003"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001"
+	.string	"\002"
+	.string	"/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \240\245\003"
+	.string	"\362F\026\037\220)\351\177|\371\365d\304C\332\252\377b\037\200\266\376\231\t2\3439\257\246\266G\310\336R\246?7\305\006\017\350\007\312\226\315P\222;\007\272\266\\+\364q \023N\330\356=\364\356.\375\342\356\032\217\312KF\310&\376\232\212\3042d\244\313\214&\242\232\307i\004\317\037\001\t"
+	.ascii	"-\342K\004\346\b\301q\231\306\363\206O\303[l\001\312\262\r`\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 Ne\001"
+	.string	"\024\002B"
+	.string	"\001"
+	.string	"\001\001\003\177\002"
+	.string	"\002\002\006{\001\200\200 "
+	.string	"\001\300\004\300\004\001"
+	.string	""
+	.string	"\002\002\001\272\001"
+	.string	"\003"
+	.ascii	"5\033Y\tl\003X"
+	.text
+	.section	.gnu.lto_.pureconst.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 (\005\001"
+	.string	"\300\034"
+	.string	"\001"
+	.string	"\001\374\005"
+	.string	""
+	.string	""
+	.string	"\001\002\001"
+	.string	"\001"
+	.string	""
+	.string	"\b\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\273\3417\200\005"
+	.text
+	.section	.gnu.lto_.lto.43a1e0290997fffa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cmsx_Blackbox_Enabled.35.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375`=\001\245\r"
+	.string	"\366X\\D"
+	.string	"\221(\035p\024X\307\370th\005C\237\256\276c\221\325R>\251\273\245\225\032\020\340\214\313\360l\365G\026D\n(\006\371\262il\271\321\357.\375wM\375].\322\262\t\002ui\204[\003\371\233\020)S\nG"
+	.string	"F"
+	.string	"H"
+	.string	",l\354\206\233\202\370\367\230a\232\237\177\227c&V0*\360\364\230\362L\003\246\034\343\200\027\260\316\356n\300T*\346\261zyq@\f\230\201\027K\345.\317\023\020\225\231i\260\273N\025\310\341\316\334\366\003\333\016\354{\001vZ{\313\257N\277#\266b\f\200\331E\211\311\26102\027#l\233\354\215\035\200\305 \323~\353(Lo)Q\r\311\022\266^\354\206\007\374\321\2369\274\200\370L\273G|f\333\237\017\223\277\207!P2\250\r\031\002Y\314\316\356G\242]\301B^\345NJO\346\270H\234\265z\231\201}\361\352\371)H>M\304\3655NTL2\306"
+	.string	"\\\036\362\305Z\265P\227D\325\220\n\032\251\274\341tu\220\261\211\303\016O\251,\366\261\335]\353\212\003F \022}$P\300}<\004D\243\220\020\2504\312\230\363\220t\241\b\034($\0042R\032\221@DH\334V\202"
+	.string	"\"m\234'\262y\n\270\2230\3626\n]\347m\233p\217\255\256h\3321Q\2245\244.\257\322t\301\207t\235\210_q{B,\021\031"
+	.ascii	"\002\225\343]`\231x\250\217\3060!:5\222i\340pF\212\245\\q\n\306"
+	.ascii	"\247\222\241\006\201A\201\240<\257\003WMP\240*i\\P\b\r\\\003"
+	.ascii	"V\316\304\001zi\020\312Uu\257\327\226="
+	.text
+	.section	.gnu.lto___compound_literal.2.38.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001??\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuBlackboxEntries.40.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\215\t"
+	.string	"\204\017?\001"
+	.string	""
+	.string	"\\"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\320\233\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\003\016\202\200\200\270\326aig8\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\002\007\370\325q_]D\206\b[Y\316us\317\001q\315\001o\314\001m\313M\206\bW\234\254\250\rU\322us\323\001q\321\273 S3\324\0014\320\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"#./src/main/cms_menu_blackbox.c"
+	.string	"\013RATE DENOM"
+	.string	"\bENABLED"
+	.string	"\017-- BLACKBOX --"
+	.string	"\030"
+	.ascii	"\262\013\310*\002\342n\355\226\205)\0052\352\032\016\300H\240"
+	.ascii	"`\260\021\320\025$\003M\200NS(\0322b\205\346\253\306r\241\211"
+	.ascii	"\215\372\234\262\004LQR\206\036@\021"
+	.text
+	.section	.gnu.lto_cmsx_menuBlackbox.41.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 e)\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"#./src/main/cms/cms_menu_blackbox.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \255u\003"
+	.string	"\202\005\025\"\260'\215\001\f\340\306[\213"
+	.string	"\315!JI\371\323\366\201\031\206a63\006\361+8!D\312-\267L\001\347B_&\360\263e\266@<$\3711JX\264`\377Y\265\337L\0245X\006\360\032(\260\203\003\r\360\317M)\302x}\2102\264\273{\n8\377\212\t"
+	.ascii	"\03634\227A\201z\360\t\236+\301p\371\201\311 F\031\224'"
+	.text
+	.section	.gnu.lto_.refs.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375 \017y"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	""
+	.string	"\001\001\002\002\002\002\002"
+	.string	"\002\003"
+	.text
+	.section	.gnu.lto_.decls.43a1e0290997fffa,"e",@progbits
+	.string	"(\265/\375`\210\017UQ"
+	.ascii	"\232\216H\037R@RJ\032\016\256\205\263\306.\211Q}\n'\006\267\207"
+	.ascii	"\371\234 \366X\232\273\331X\310\247<\232\260\332\337\017\361"
+	.ascii	"\376\220\262\022\023\300\376\f\204\365\222\210/\355\222\251;"
+	.ascii	"\206\335_\372w^\244hT\367\276S\364\210\373\325\267\253H\\\022"
+	.ascii	"\037govl\"e\n\241\001\323\001\360\001\275L\"\277\212\304\035"
+	.ascii	"\262\271$\"\233J\251\035r]J\365\261\211\352\321\253\373\250\224"
+	.ascii	"\3329Y\227\215l\026\245z\220M%\361\t\r\223\313\356K\263\t\022"
+	.ascii	"\344\261\241\bprT&\321\220\253r\305\272\211_K\235\334\265{\331"
+	.ascii	"\r\203\322\204\330\261\006\242\230\021\r\312\246\352\270\022"
+	.ascii	"\267\205'#Sy\263\032\033\r\251D\211c\251\233\255\237\206\210"
+	.ascii	"K\\\273\273G\033\211\333\275\264&\273\215J\023\252\224\033\246"
+	.ascii	"G\262u\372Xt22\225\272%\243\262G+\221a\245\220M\246\2227&\245"
+	.ascii	"\231\325\306\225\270Y\315\266L\252M\342\332\310\356\336\"t\314"
+	.ascii	"\204\251\3011\272^\233\303:\203V\312w\312~\375\346\270v\263{"
+	.ascii	"\345\271Y+\302\352\213\321\022\373\223\242 \250\272\241o\363"
+	.ascii	"\001\200i\026W\325oP\312\263A\351\277Q\376\325\332\255\355\312"
+	.ascii	"!\235\224\375\325\275\356l\264\2640\277\030\335.^\256]\277]\213"
+	.ascii	"\303U\260\270\356\330[\335\353v\241\335\305]\023;\273&j\310\216"
+	.ascii	"\024sH\321\263\372u\177Ru}\322\377k\377\303\374W\373\317\366"
+	.ascii	"\037\210\377g[\302\177\365\337-\3772\360/\t\377\216\360\257\b"
+	.ascii	"\377\206\260\037\374\273\300\2774\376\365\200\203\177K\374k\300"
+	.ascii	"\277$\376E\340\337\003\376M\340_\031\377n\360o\317\277>\377\352"
+	.ascii	"\374\027\340\347\031\377\256\370\227\305\277\021\374\317\375"
+	.ascii	"\234\302\277\023`P\001\214\234\177\255\376\275\340_\013\376\245"
+	.ascii	"\340_\027\3776\360\277\355\177\330\377\257\377\\\377\327\377"
+	.ascii	"8\377\315\376\327<\237\317\347\277\352\317F\277\216M\373\\4\275"
+	.ascii	"\365\034R>y\320t\027yvM\354\232@\2410m\240\222\242\317=\251\317"
+	.ascii	"\035\325s\234\372\177\314\357\226:y\022\005\007\247.\231}['\211"
+	.ascii	"-\223#z\255[\272\250(\032\224n\352\227D\272\317%\221\236\333"
+	.ascii	"\324\177\355O\272n\274\357\020>i\262jm\036\nh\020\002\205\321"
+	.ascii	"\334\372\244\351\331\326'=cQ{\324\206\366\311\256\330:Wl\333"
+	.ascii	"6X\233\210c\304\241\211\n\256\2230<\200\363\002\223\257!\214"
+	.ascii	".\020\353q'm\n\23180\365+\322\366\013\224\323\312\207U\333\265"
+	.ascii	"\375a\235\313\366\357\330b9\320\332}\354\356\357V\230-kr^\271"
+	.ascii	"u\257\337\255\237\207\266`\\,%o\242x\004q\353n>\013\333\356\260"
+	.ascii	"_\026\255j\355\251\035g\f>\240\300u7\205\200\204\204\204tC\334"
+	.ascii	"`\206\205\203\236\207\250g\253\036rm]b\306\030=;\251g\036\313"
+	.ascii	"\303\212\376h\002\266\244\214\352\345L\265\022F\005\213\331\367"
+	.ascii	"\354g\251q\3519U\226N\355\320\304U\326e\213\223\2170\214.\227"
+	.ascii	"/+\2543\246 \324-_-k#\201j\244\244 \321\262d\377\r\216\0273-"
+	.ascii	"d\251\251_.j\317\372\244\334\373\223\226X)\352\2169\264T\266"
+	.ascii	"\312\327\212s\255l\330\246hcZ\024\005\212jL^\340\272*\031\364"
+	.ascii	"\357\225o\330\257\202\305v\351\272\r\330\301j\323\222\003\243"
+	.ascii	"\177\373M\315\221\225\251\f\243\337V\371O\273\230\354\356\251"
+	.ascii	"\232\265\305\214\272o\3157\350\327\331\334\321n\236\255n(4d\322"
+	.ascii	"\262%\0202\214\376/\321\026t\323@\036\227\311\035\262Y$\356\232"
+	.ascii	"\326\245\024\262\271\224\332"
+	.string	"\365\352\005\244\233B\272\221G%\221\213\275\266TO\037\227Rj\027\335\220k'w\275\026\223\033F..^\301Z7\246\204\251\330u^/\004\232\326\265\306\206E\355\0213\004\345?\024\336Z\257\216\332\031\304\322\312\340\272\253\202r\222AD\331\242u\336\322ys\242q\201\361\020\205\346\b\246\372}\262|\365\257\223\257\330\211\005\304\365\212\310c4\322$\035R\205\205\311\017\365+x\t\033\341\254\\3Km\342\021\247\204\231\254\223\2270\022N\262n\214\305E~\336\022\276a\315\354\020\327\216\302QK\223;2\306\210V\212\036M\252hQ\345#\\\303:\035`\033\3164p\221\327\024\327u\315\021\013\002Fe\204\372u \315=\237\353@\372\334\233\312\353\223\366\354O\n\224CS{\272\210Y\347\212a\";\306+\252\007\206\344\030\255\304\300|\351\310\304h%a\364,\344_!v\f3M\350\026@\255:\002fe\271"
+	.ascii	"\335\020\343\226E\030\225\201\2558\b+9\206u\362\362\253\205["
+	.ascii	"`\027\210\340\027\030\206)\314\2523\325\202\251\222\301|\342"
+	.ascii	"\037\\\265\243@\267\220g\026/\027n\215\3105\263n\240\214P\313"
+	.ascii	"-b\315\344\326,\033*iQ@B\250\223\020d\206\320\241\255\223\346"
+	.ascii	"I\2323e\352\212\355OJ\300\372\244,T!\257p\001aA\213\212\210\221"
+	.ascii	"\233\2613K~\220\361\024\373`\251u2\325\327\236\341\343\024\263"
+	.ascii	"\211\251\366\210\223\345\242$\325)L'\267\025?\217\251\230\007"
+	.ascii	"'y\322\230\006\020\022\022J\311\244d\240RQ(\216zZ\311\260~p2"
+	.ascii	"\024?\345\322\264\304\212\260\323\371\351\346\350%J\024\243\274"
+	.ascii	"\304M\2722k\314*\334\304\304Cd\0060@\030]a'\313\032\023U\023"
+	.ascii	"\365Gr\217\333\364\240\022s\003\226\372\267\217\251\222\365\264"
+	.ascii	"&\204\2159WW\320\3160\372\334\224Zd\"\312\004\273b\362v&r\353"
+	.ascii	"P\001\341\001\316\311\375\214\301\344\2056F7n\323<\303_\r\034"
+	.ascii	"\241\357w\244;\216\023(\f(\372\t\225N0\272\001\f\302\370\t\225"
+	.ascii	"\206\276\337\215\335\020\3517LB\223z\032t #\204\020b\324\320"
+	.ascii	"\031\366Z\360\216|*\344T\2348\362\t\177C\243\243^\021P)\210\224"
+	.ascii	"#H\324\353\001\220t\202\357\350F\315P\307o\270\243\306\f\030"
+	.ascii	"<\303\244\336P\030\244\261\303w\204\224dT\244\203\016\221vB\037"
+	.ascii	"\016\"\224\b\250tC-\222\221\34374J}C_\021:\354\271\260A\223~"
+	.ascii	"F@\275\0323`\250\307q\"\351\207\264cX@\322\317H8\004\376l\204"
+	.ascii	"\277!0\0060h#\034\322\360\240\007\030L\205C\032D@\245\f\224\200"
+	.ascii	"\277\0315f\300\330\331!\034\002c\3640\250\341\301M\321\017\005"
+	.ascii	"\"\037R:4\322\021\343\310g#x\244\0010\250\333]\201\007\221~B"
+	.ascii	"\024\303`P\210\"\247\350wd\303\007\214\321\273\240\247#)\007"
+	.ascii	"\321\317\211\214\204?\340\357\004\365C- h\341B\207\315]\274H"
+	.ascii	"\361\"Ez\027/x\274\027-x\352[\360r\303\236\212\025C\240\221\222"
+	.ascii	"\372\024EE,x-\210T\234 q\t$\200QB\204\0164P\211N\350\b\332@\201"
+	.ascii	"\310wd\243\247\004\374\345\350%\345 B\0014\362\345@A$LBq\"\201"
+	.ascii	"\243`\360\202^\215\027\"m5\244);3c&\177`\263\237\273p\231Y\227"
+	.ascii	"4\270\375Iy\266\360\316\\\324\3473\013\026\243;Z\310zRH\324\030"
+	.ascii	"=\223}\355\304\035i\372\302(g\341\235w8\340\n\331\030\2436X6"
+	.ascii	"l\261\\`\216\215\211\351\242D\371P\302\350Y\354\3470\326A\205"
+	.ascii	"\023\326\f\214\236\313\376\2449Vx\347+\251\023\344\031(\214\342"
+	.ascii	"Tq\302B\222*>\250\200\345\370 \345\f\214\3213\330\317S\370k\237"
+	.ascii	"\2720/N\"\214\006\355OZ\263>\351N\341\235\245\240B\312D%qn\261"
+	.ascii	")\20785\327f\020F\3041\272\363\341\345"
+	.string	"\305\353s\307\016\322\225\265f@\274A}Qw\001\201\"\250\2010\206\034422##R\230$\351\021\005\204 \n%<\017\021\220\245\203H\210$I\n\373\263\006`O\262?\217e\324\301\302\367\250\021\316\260\226\251\n\241\022\240\032,\301\360\243\024\301M\"=x\331\220{wco\360a\372b\0339\374\b\25627Pg5\2213\232\223\"g\007\213>\252Q\025\034\373\303v:!\331\0302:B\303\215)C\001\f\343cq\007f\201e\331\257\030O\213z\330\347\214\347\334H5?9\"\230+h\234\003\017~I\n\352n}9\205\361\376\244\353*\b%!\263vE\342\356\207hr\335\372z\177\335\203C\343\025,6\234r1\355B\227\225\224\\`*\001\313W\223\272\033\222\2174\036f\033v\236"
+	.string	"\217\231x1\305\317E'\361\217}b\344Y\007&\240\201\255c|\224\0309\206\327\202\217\200k\013\352\360U\211\265*\305T\227PY\331\234\206\265Z/$\277\"\231F\204\217P\004O\r\322\005\221e\273\371\210\302\332\362Kv\263 xsF\240\b\202\272\312\033\216\370YhK\354\001X\037zqA\351\367g\375\314>\3215E\031`9\356\245oBY\020\366\320\2572\332B,\225\332W\036Y&\215\230s,\373z6\fOkW=H\343\327\333A\226\016S\273\n\350\254C<\b3@X\252"
+	.string	"l\026D\327\n\260@\017\343\354H\0372\231\375\020H\346\022\\\327\027\372\374\220>\313wI\377\303\231 \3121\300\225\367\331\3671g\377)M\3632\t[\222\001\305sa}\\G\327\2200Um\b\031A(\207lAm1\232\347)K\357\242\234\274\245u\331\256\320\347\204\f\232\tUx\232\016\016\205\306t\272\003\003\332\032\001w.8\342xI\336\300\312d\223\245Z\031.P\215"
+	.string	"\356-6\335\177\351N\272Z\375\303\030\031\262\256\226\206~\020T\362\2404*B(m\255i\037+K\007x\304\306\320\025\013\337\013\341\325\254i\022\030\201\016#K\023"
+	.ascii	"\017\356\r\b#\264:1r\302EG\334\227\227\312~\2632\r\316\374w\236"
+	.ascii	"\320x\356]\225w\022\334\200\237\327\354\254|\032\322\231\307"
+	.ascii	"7\023\253=\3421\376\363\017\260\037+\016\2227\036U"
+	.text
+	.section	.gnu.lto_.symtab.43a1e0290997fffa,"e",@progbits
+	.string	"cmsx_menuBlackbox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353"
+	.string	""
+	.string	""
+	.string	"featureConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.43a1e0290997fffa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
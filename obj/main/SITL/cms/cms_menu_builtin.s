@@ -0,0 +1,10009 @@
+	.file	"cms_menu_builtin.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms_types.h"
+	.file 6 "./src/main/build/version.h"
+	.file 7 "./src/main/cms/cms_menu_builtin.h"
+	.file 8 "./src/main/cms/cms_menu_imu.h"
+	.file 9 "./src/main/cms/cms_menu_blackbox.h"
+	.file 10 "./src/main/cms/cms_menu_mixer_servo.h"
+	.file 11 "./src/main/cms/cms_menu_navigation.h"
+	.file 12 "./src/main/cms/cms_menu_vtx.h"
+	.file 13 "./src/main/cms/cms_menu_battery.h"
+	.file 14 "./src/main/cms/cms_menu_misc.h"
+	.file 15 "./src/main/cms/cms_menu_builtin.c"
+	.file 16 "./src/main/cms/cms.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_builtin.c.9d6db578
+	.weak	cms_menu_builtin.c.9d6db578
+cms_menu_builtin.c.9d6db578:
+	.long	0x7cd
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF1481
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1365
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1366
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1367
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1368
+	.uleb128 0x5
+	.long	.LASF1370
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1369
+	.uleb128 0x5
+	.long	.LASF1371
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1372
+	.uleb128 0x5
+	.long	.LASF1373
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1374
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1375
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1376
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1377
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1378
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1379
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1380
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x6
+	.long	0xd2
+	.uleb128 0x9
+	.long	.LASF1465
+	.byte	0x6
+	.byte	0x21
+	.byte	0x1a
+	.long	0xd7
+	.uleb128 0x5
+	.long	.LASF1381
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xf9
+	.uleb128 0x6
+	.long	0xe8
+	.uleb128 0xd
+	.long	.LASF1389
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1382
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x124
+	.uleb128 0x4
+	.long	.LASF1383
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1384
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1385
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1386
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0x105
+	.uleb128 0x5
+	.long	.LASF1387
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1388
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x148
+	.uleb128 0xd
+	.long	.LASF1390
+	.uleb128 0x5
+	.long	.LASF1391
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x159
+	.uleb128 0xd
+	.long	.LASF1392
+	.uleb128 0x5
+	.long	.LASF1393
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x16f
+	.uleb128 0x6
+	.long	0x15e
+	.uleb128 0x10
+	.long	.LASF1413
+	.byte	0x98
+	.byte	0x56
+	.long	0x272
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x344
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x344
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x344
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x344
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1398
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x35d
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1399
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x385
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3ad
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3df
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3f3
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x344
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x403
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1405
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x417
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1406
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x42b
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1407
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x449
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x46c
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x480
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x495
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1411
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x403
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF1412
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x4b3
+	.byte	0x90
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1414
+	.byte	0x20
+	.byte	0x45
+	.long	0x31a
+	.uleb128 0x1
+	.long	.LASF1415
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x31a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1416
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1417
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1418
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1419
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1420
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1421
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0xfe
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1422
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0xfe
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1423
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1424
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1425
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x130
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1426
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xba
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x16a
+	.uleb128 0x5
+	.long	.LASF1427
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x272
+	.uleb128 0x6
+	.long	0x31f
+	.uleb128 0x7
+	.long	0x70
+	.long	0x33f
+	.uleb128 0x2
+	.long	0x33f
+	.byte	0
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0x3
+	.long	0x330
+	.uleb128 0x7
+	.long	0x70
+	.long	0x358
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x32b
+	.uleb128 0x3
+	.long	0x349
+	.uleb128 0x7
+	.long	0x70
+	.long	0x385
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xd2
+	.uleb128 0x2
+	.long	0x130
+	.byte	0
+	.uleb128 0x3
+	.long	0x362
+	.uleb128 0x7
+	.long	0x70
+	.long	0x3ad
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x130
+	.byte	0
+	.uleb128 0x3
+	.long	0x38a
+	.uleb128 0x7
+	.long	0xfe
+	.long	0x3d5
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0x3d5
+	.uleb128 0x2
+	.long	0x3da
+	.byte	0
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x130
+	.uleb128 0x3
+	.long	0x3b2
+	.uleb128 0x7
+	.long	0xfe
+	.long	0x3f3
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x3e4
+	.uleb128 0x11
+	.long	0x403
+	.uleb128 0x2
+	.long	0x33f
+	.byte	0
+	.uleb128 0x3
+	.long	0x3f8
+	.uleb128 0x7
+	.long	0xc6
+	.long	0x417
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x408
+	.uleb128 0x7
+	.long	0x130
+	.long	0x42b
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x41c
+	.uleb128 0x7
+	.long	0xfe
+	.long	0x444
+	.uleb128 0x2
+	.long	0x444
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x14d
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x7
+	.long	0x70
+	.long	0x467
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x467
+	.byte	0
+	.uleb128 0x3
+	.long	0xf4
+	.uleb128 0x3
+	.long	0x44e
+	.uleb128 0x7
+	.long	0xfe
+	.long	0x480
+	.uleb128 0x2
+	.long	0x33f
+	.byte	0
+	.uleb128 0x3
+	.long	0x471
+	.uleb128 0x11
+	.long	0x495
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	0x485
+	.uleb128 0x7
+	.long	0xfe
+	.long	0x4ae
+	.uleb128 0x2
+	.long	0x4ae
+	.uleb128 0x2
+	.long	0x358
+	.byte	0
+	.uleb128 0x3
+	.long	0x13c
+	.uleb128 0x3
+	.long	0x49a
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1
+	.long	0x53d
+	.uleb128 0x4
+	.long	.LASF1428
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1429
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1430
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1431
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1432
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1434
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1435
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF1436
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1437
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF1438
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF1439
+	.byte	0xb
+	.uleb128 0x4
+	.long	.LASF1440
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1441
+	.byte	0xd
+	.uleb128 0x4
+	.long	.LASF1442
+	.byte	0xe
+	.uleb128 0x4
+	.long	.LASF1443
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF1444
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1445
+	.byte	0x11
+	.uleb128 0x4
+	.long	.LASF1446
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF1447
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1448
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x54e
+	.uleb128 0x6
+	.long	0x53d
+	.uleb128 0x3
+	.long	0x553
+	.uleb128 0x7
+	.long	0x83
+	.long	0x567
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0x567
+	.byte	0
+	.uleb128 0x3
+	.long	0x571
+	.uleb128 0x6
+	.long	0x567
+	.uleb128 0x16
+	.uleb128 0x5
+	.long	.LASF1449
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x12
+	.long	0x583
+	.uleb128 0x6
+	.long	0x572
+	.uleb128 0x3
+	.long	0x588
+	.uleb128 0x17
+	.long	0x8c
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x5
+	.byte	0x40
+	.byte	0x5
+	.long	0x5b8
+	.uleb128 0xe
+	.long	.LASF1450
+	.byte	0x42
+	.byte	0x1f
+	.long	0x549
+	.uleb128 0xe
+	.long	.LASF1451
+	.byte	0x43
+	.byte	0x21
+	.long	0x57e
+	.uleb128 0xe
+	.long	.LASF1452
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0x12
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x5fa
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x18
+	.long	0xd7
+	.byte	0
+	.uleb128 0x19
+	.long	0x58d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x5
+	.byte	0x46
+	.byte	0x18
+	.long	0x56c
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x5
+	.byte	0x47
+	.byte	0x13
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1457
+	.byte	0x5
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5b8
+	.uleb128 0x6
+	.long	0x5fa
+	.uleb128 0x5
+	.long	.LASF1458
+	.byte	0x5
+	.byte	0x78
+	.byte	0x10
+	.long	0x61c
+	.uleb128 0x6
+	.long	0x60b
+	.uleb128 0x3
+	.long	0x621
+	.uleb128 0x7
+	.long	0x83
+	.long	0x630
+	.uleb128 0x2
+	.long	0x630
+	.byte	0
+	.uleb128 0x3
+	.long	0x606
+	.uleb128 0x5
+	.long	.LASF1459
+	.byte	0x5
+	.byte	0x84
+	.byte	0x10
+	.long	0x61c
+	.uleb128 0x6
+	.long	0x635
+	.uleb128 0x12
+	.byte	0x20
+	.byte	0x86
+	.long	0x682
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x5
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x617
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x5
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x641
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x617
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x5
+	.byte	0x90
+	.byte	0x16
+	.long	0x630
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1464
+	.byte	0x5
+	.byte	0x91
+	.byte	0x3
+	.long	0x646
+	.uleb128 0x6
+	.long	0x682
+	.uleb128 0x9
+	.long	.LASF1466
+	.byte	0x7
+	.byte	0x16
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1467
+	.byte	0x8
+	.byte	0x14
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1468
+	.byte	0x9
+	.byte	0x14
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1469
+	.byte	0xa
+	.byte	0x16
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1470
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1471
+	.byte	0xc
+	.byte	0x14
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0x9
+	.long	.LASF1472
+	.byte	0xd
+	.byte	0x14
+	.byte	0x11
+	.long	0x682
+	.uleb128 0x9
+	.long	.LASF1473
+	.byte	0xe
+	.byte	0x14
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0xb
+	.long	0x91
+	.long	0x703
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1474
+	.byte	0x37
+	.byte	0xd
+	.long	0x6f3
+	.uleb128 0xb
+	.long	0x91
+	.long	0x71e
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1475
+	.byte	0x38
+	.byte	0xd
+	.long	0x70e
+	.uleb128 0xb
+	.long	0x606
+	.long	0x739
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	0x729
+	.uleb128 0xa
+	.long	.LASF1476
+	.byte	0x4c
+	.byte	0x18
+	.long	0x739
+	.uleb128 0xa
+	.long	.LASF1477
+	.byte	0x56
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0xa
+	.long	.LASF1478
+	.byte	0x63
+	.byte	0x18
+	.long	0x739
+	.uleb128 0xa
+	.long	.LASF1479
+	.byte	0x75
+	.byte	0x17
+	.long	0x68e
+	.uleb128 0xb
+	.long	0x606
+	.long	0x77a
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0x76a
+	.uleb128 0xa
+	.long	.LASF1480
+	.byte	0x82
+	.byte	0x18
+	.long	0x77a
+	.uleb128 0x1a
+	.long	0x693
+	.byte	0xf
+	.byte	0x98
+	.byte	0x10
+	.uleb128 0x1b
+	.long	.LASF1482
+	.byte	0x10
+	.byte	0x23
+	.byte	0x6
+	.long	0x83
+	.long	0x7ad
+	.uleb128 0x2
+	.long	0x33f
+	.uleb128 0x2
+	.long	0x567
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1483
+	.byte	0xf
+	.byte	0x3c
+	.byte	0xd
+	.long	0x83
+	.uleb128 0x1d
+	.long	.LASF1484
+	.byte	0xf
+	.byte	0x3c
+	.byte	0x2c
+	.long	0x630
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0xf
+	.byte	0x40
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 33 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 37 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 41 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.file 42 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 43 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 44 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 46 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 47 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2f
+	.file 48 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x30
+	.file 49 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x31
+	.file 50 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xc
+	.byte	0x4
+	.file 51 "./src/main/cms/cms_menu_osd.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 "./src/main/cms/cms_menu_ledstrip.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0xe
+	.byte	0x4
+	.file 53 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 54 "./src/main/msp/msp_protocol_v2_common.h"
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "./src/main/msp/msp_protocol_v2_sensor.h"
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 56 "./src/main/msp/msp_protocol_v2_inav.h"
+	.byte	0x3
+	.uleb128 0x14b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1126
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.60.df1a5c043e2e4ca2e25f4ac4c907ab71,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_common.h.18.b86f8d7f853153e98d87360103e37a68,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_sensor.h.18.18fe88d41ea597d5df13b783c778426d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_inav.h.21.d7220ba697f30312e07cad49a55b0841,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1364
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1485
+	.long	.LASF1486
+	.long	.LASF1487
+	.long	.LASF1488
+	.long	.LASF1489
+	.long	.LASF1490
+	.long	.LASF1491
+	.long	.LASF1492
+	.long	.LASF1493
+	.long	.LASF1494
+	.long	.LASF1495
+	.long	.LASF1496
+	.long	.LASF1497
+	.long	.LASF1498
+	.long	.LASF1499
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1500
+	.byte	0xb
+	.long	.LASF1501
+	.byte	0xb
+	.long	.LASF1502
+	.byte	0xb
+	.long	.LASF1503
+	.byte	0x5
+	.long	.LASF1504
+	.byte	0x2
+	.long	.LASF1505
+	.byte	0x1
+	.long	.LASF1506
+	.byte	0x2
+	.long	.LASF1507
+	.byte	0x2
+	.long	.LASF1508
+	.byte	0x2
+	.long	.LASF1509
+	.byte	0x2
+	.long	.LASF1510
+	.byte	0x2
+	.long	.LASF1511
+	.byte	0x2
+	.long	.LASF1512
+	.byte	0x2
+	.long	.LASF1513
+	.byte	0x2
+	.long	.LASF1514
+	.byte	0x2
+	.long	.LASF1515
+	.byte	0x2
+	.long	.LASF1516
+	.byte	0xe
+	.long	.LASF1517
+	.byte	0xf
+	.long	.LASF1518
+	.byte	0xf
+	.long	.LASF1518
+	.byte	0xe
+	.long	.LASF1519
+	.byte	0xb
+	.long	.LASF1520
+	.byte	0xe
+	.long	.LASF1521
+	.byte	0xe
+	.long	.LASF1522
+	.byte	0xb
+	.long	.LASF1523
+	.byte	0xb
+	.long	.LASF1524
+	.byte	0xd
+	.long	.LASF1525
+	.byte	0xb
+	.long	.LASF1526
+	.byte	0xc
+	.long	.LASF1527
+	.byte	0xc
+	.long	.LASF1528
+	.byte	0xb
+	.long	.LASF1529
+	.byte	0xb
+	.long	.LASF1530
+	.byte	0xb
+	.long	.LASF1531
+	.byte	0xe
+	.long	.LASF1532
+	.byte	0xf
+	.long	.LASF1533
+	.byte	0xa
+	.long	.LASF1534
+	.byte	0xa
+	.long	.LASF1535
+	.byte	0xe
+	.long	.LASF1536
+	.byte	0xe
+	.long	.LASF1537
+	.byte	0xb
+	.long	.LASF1538
+	.byte	0xb
+	.long	.LASF1539
+	.byte	0x9
+	.long	.LASF1540
+	.byte	0x8
+	.long	.LASF1541
+	.byte	0x7
+	.long	.LASF1542
+	.byte	0x8
+	.long	.LASF1543
+	.byte	0x8
+	.long	.LASF1544
+	.byte	0x3
+	.long	.LASF1545
+	.byte	0x5
+	.long	.LASF1545
+	.byte	0x3
+	.long	.LASF1546
+	.byte	0x4
+	.long	.LASF1547
+	.byte	0x1
+	.long	.LASF1548
+	.byte	0x2
+	.long	.LASF1549
+	.byte	0x2
+	.long	.LASF1550
+	.byte	0x6
+	.long	.LASF1551
+	.byte	0x6
+	.long	.LASF1552
+	.byte	0x6
+	.long	.LASF1553
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1177:
+	.string	"MSP_SET_FEATURE 37"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF745:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1041:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1263:
+	.string	"MSP_NAV_STATUS 121"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1357:
+	.string	"MSP2_INAV_SET_GLOBAL_FUNCTIONS 0x2025"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1390:
+	.string	"displayCanvas_s"
+.LASF1388:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1295:
+	.string	"MSP_STATUS_EX 150"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1037:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1006:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1154:
+	.string	"MSP_FC_VERSION 3"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1414:
+	.string	"displayPort_s"
+.LASF1427:
+	.string	"displayPort_t"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF806:
+	.string	"USE_GPS "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1317:
+	.string	"MSP2_COMMON_SET_RADAR_POS 0x100B"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1308:
+	.string	"MSP2_COMMON_SET_TZ 0x1002"
+.LASF760:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1222:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1250:
+	.string	"MSP_ATTITUDE 108"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1057:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF785:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1038:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1245:
+	.string	"MSP_SERVO 103"
+.LASF1206:
+	.string	"MSP_SET_BF_CONFIG 67"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1242:
+	.string	"MSP_IDENT 100"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1418:
+	.string	"cols"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF759:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1146:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1430:
+	.string	"OME_Back"
+.LASF1091:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF761:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF1227:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1195:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF791:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1325:
+	.string	"MSP2_INAV_OPTICAL_FLOW 0x2001"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1251:
+	.string	"MSP_ALTITUDE 109"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1054:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1063:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1128:
+	.string	"API_VERSION_MAJOR 2"
+.LASF1387:
+	.string	"textAttributes_t"
+.LASF1078:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1255:
+	.string	"MSP_ACTIVEBOXES 113"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1055:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1431:
+	.string	"OME_OSD_Exit"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1211:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF779:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1019:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1421:
+	.string	"useFullscreen"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1185:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1460:
+	.string	"onEnter"
+.LASF1135:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF1208:
+	.string	"MSP_BF_BUILD_INFO 69"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF994:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1448:
+	.string	"CMSEntryFuncPtr"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF959:
+	.string	"USE_VCP"
+.LASF1455:
+	.string	"type"
+.LASF1079:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF772:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1170:
+	.string	"MSP_RTH_AND_LAND_CONFIG 21"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1169:
+	.string	"MSP_WP_GETINFO 20"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1324:
+	.string	"MSP2_INAV_STATUS 0x2000"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1241:
+	.string	"MSP_TX_INFO 187"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF727:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF773:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1015:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1099:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF1103:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1160:
+	.string	"MSP_SET_NAME 11"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1205:
+	.string	"MSP_BF_CONFIG 66"
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF736:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1095:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1239:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1104:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1092:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1445:
+	.string	"OME_BACK_AND_END"
+.LASF1234:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF1392:
+	.string	"displayFontMetadata_s"
+.LASF1391:
+	.string	"displayFontMetadata_t"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF753:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1230:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1186:
+	.string	"MSP_LED_COLORS 46"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF750:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1389:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF757:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1264:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF1481:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1375:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF776:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1364:
+	.string	"MSP2_INAV_DATAFLASH_STREAM 0x2033"
+.LASF990:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF700:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1194:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF777:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1482:
+	.string	"cmsMenuExit"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1141:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF729:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1312:
+	.string	"MSP2_COMMON_SET_MOTOR_MIXER 0x1006"
+.LASF1358:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS_STATUS 0x2026"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1155:
+	.string	"MSP_BOARD_INFO 4"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF1261:
+	.string	"MSP_BOXIDS 119"
+.LASF1086:
+	.string	"READONLY (1 << 4)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF786:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1399:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1053:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1254:
+	.string	"MSP_PID 112"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1276:
+	.string	"MSP_SET_MISC 207"
+.LASF1437:
+	.string	"OME_UINT8"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1259:
+	.string	"MSP_PIDNAMES 117"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1326:
+	.string	"MSP2_INAV_ANALOG 0x2002"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1036:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1156:
+	.string	"MSP_BUILD_INFO 5"
+.LASF1432:
+	.string	"OME_Submenu"
+.LASF1133:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1281:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1107:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1044:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1223:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF1369:
+	.string	"signed char"
+.LASF1035:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1378:
+	.string	"uint8_t"
+.LASF1114:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1088:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1328:
+	.string	"MSP2_INAV_SET_MISC 0x2004"
+.LASF769:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1023:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1210:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1266:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF1090:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1278:
+	.string	"MSP_SET_WP 209"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF746:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1365:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1142:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF1436:
+	.string	"OME_INT8"
+.LASF1164:
+	.string	"MSP_SET_CALIBRATION_DATA 15"
+.LASF754:
+	.string	"isascii(c) __isascii (c)"
+.LASF1119:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF734:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF1403:
+	.string	"heartbeat"
+.LASF1184:
+	.string	"MSP_RX_CONFIG 44"
+.LASF1353:
+	.string	"MSP2_INAV_SET_SERVO_MIXER 0x2021"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1024:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF981:
+	.string	"NOINLINE "
+.LASF1327:
+	.string	"MSP2_INAV_MISC 0x2003"
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1073:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1435:
+	.string	"OME_BoolFunc"
+.LASF1335:
+	.string	"MSP2_INAV_MC_BRAKING 0x200B"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF1477:
+	.string	"menuInfo"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1412:
+	.string	"getCanvas"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1382:
+	.string	"_Bool"
+.LASF1446:
+	.string	"OME_MENU"
+.LASF1484:
+	.string	"from"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1449:
+	.string	"CMSMenuOptFuncPtr"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF1093:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF1434:
+	.string	"OME_Bool"
+.LASF1097:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1152:
+	.string	"MSP_API_VERSION 1"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1070:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1442:
+	.string	"OME_Setting"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1299:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF1476:
+	.string	"menuInfoEntries"
+.LASF1341:
+	.string	"MSP2_INAV_OSD_ALARMS 0x2014"
+.LASF1352:
+	.string	"MSP2_INAV_SERVO_MIXER 0x2020"
+.LASF1151:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1343:
+	.string	"MSP2_INAV_OSD_PREFERENCES 0x2016"
+.LASF698:
+	.string	"__need_size_t "
+.LASF1424:
+	.string	"grabCount"
+.LASF1303:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1258:
+	.string	"MSP_BOXNAMES 116"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1373:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1065:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF755:
+	.string	"toascii(c) __toascii (c)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1108:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1444:
+	.string	"OME_END"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1394:
+	.string	"grab"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1229:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1168:
+	.string	"MSP_WP_MISSION_SAVE 19"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1101:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF1417:
+	.string	"rows"
+.LASF1020:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF780:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF758:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1456:
+	.string	"flags"
+.LASF1270:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1115:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF1085:
+	.string	"OPTSTRING (1 << 3)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1385:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF771:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1257:
+	.string	"MSP_MOTOR_PINS 115"
+.LASF1039:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1143:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF1280:
+	.string	"MSP_SET_HEAD 211"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1117:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF1428:
+	.string	"OME_Label"
+.LASF853:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF741:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1383:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF1040:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1162:
+	.string	"MSP_SET_NAV_POSHOLD 13"
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1056:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1453:
+	.string	"text"
+.LASF1294:
+	.string	"MSP_V2_FRAME 255"
+.LASF1256:
+	.string	"MSP_MISC 114"
+.LASF1124:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1149:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1459:
+	.string	"CMSMenuOnExitPtr"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF790:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF1426:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1096:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF991:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1371:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1289:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1249:
+	.string	"MSP_COMP_GPS 107"
+.LASF1288:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF1361:
+	.string	"MSP2_PID 0x2030"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1102:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1438:
+	.string	"OME_UINT16"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1032:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1005:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1345:
+	.string	"MSP2_INAV_SELECT_BATTERY_PROFILE 0x2018"
+.LASF1016:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1279:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF1080:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF996:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1161:
+	.string	"MSP_NAV_POSHOLD 12"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF1003:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF1244:
+	.string	"MSP_RAW_IMU 102"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1116:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF1187:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1061:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF1121:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1132:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1089:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1083:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF1472:
+	.string	"cmsx_menuBattery"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF854:
+	.string	"USE_CMS "
+.LASF1209:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1150:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1433:
+	.string	"OME_Funcall"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1302:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF1304:
+	.string	"MSP_SET_PASSTHROUGH 245"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1474:
+	.string	"infoGitRev"
+.LASF1158:
+	.string	"MSP_SET_INAV_PID 7"
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1046:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1260:
+	.string	"MSP_WP 118"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF789:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1285:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF1384:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF737:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1148:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1042:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF988:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF1011:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1033:
+	.string	"EXTENDED_FASTRAM "
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1192:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF1362:
+	.string	"MSP2_SET_PID 0x2031"
+.LASF1202:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1354:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS 0x2022"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1228:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF995:
+	.string	"MW_VERSION 231"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF726:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1315:
+	.string	"MSP2_COMMON_SERIAL_CONFIG 0x1009"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1318:
+	.string	"MSP2_COMMON_SET_RADAR_ITD 0x100C"
+.LASF764:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1452:
+	.string	"itemId"
+.LASF1021:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF999:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF787:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF1106:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF748:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1329:
+	.string	"MSP2_INAV_BATTERY_CONFIG 0x2005"
+.LASF1029:
+	.string	"UNIT_TESTED "
+.LASF1111:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1045:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1077:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1129:
+	.string	"API_VERSION_MINOR 4"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF763:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1166:
+	.string	"MSP_SET_POSITION_ESTIMATION_CONFIG 17"
+.LASF730:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1051:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1267:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1004:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1447:
+	.string	"OME_MAX"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1381:
+	.string	"osdCharacter_t"
+.LASF1374:
+	.string	"__uint32_t"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF1204:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF1248:
+	.string	"MSP_RAW_GPS 106"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1069:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1191:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1113:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1175:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1110:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF775:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1458:
+	.string	"CMSMenuFuncPtr"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1050:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1340:
+	.string	"MSP2_INAV_OSD_SET_LAYOUT_ITEM 0x2013"
+.LASF1319:
+	.string	"MSP2_COMMON_SETTINGS 0x100D"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1120:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1246:
+	.string	"MSP_MOTOR 104"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1240:
+	.string	"MSP_SET_TX_INFO 186"
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1181:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1321:
+	.string	"MSP2_IS_SENSOR_MESSAGE(x) ((x) >= 0x1F00 && (x) <= 0x1FFF)"
+.LASF1473:
+	.string	"cmsx_menuMisc"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1410:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1193:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF466:
+	.string	"__PMT"
+.LASF1344:
+	.string	"MSP2_INAV_OSD_SET_PREFERENCES 0x2017"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1347:
+	.string	"MSP2_BLACKBOX_CONFIG 0x201A"
+.LASF1363:
+	.string	"MSP2_INAV_OPFLOW_CALIBRATION 0x2032"
+.LASF1323:
+	.string	"MSP2_SENSOR_OPTIC_FLOW 0x1F02"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF1188:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1480:
+	.string	"menuMainEntries"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1298:
+	.string	"MSP_GPSSVINFO 164"
+.LASF1356:
+	.string	"MSP2_INAV_GLOBAL_FUNCTIONS 0x2024"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1157:
+	.string	"MSP_INAV_PID 6"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1060:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1296:
+	.string	"MSP_SENSOR_STATUS 151"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1331:
+	.string	"MSP2_INAV_RATE_PROFILE 0x2007"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1105:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1360:
+	.string	"MSP2_INAV_TASK_TIMING 0x2028"
+.LASF1478:
+	.string	"menuFeaturesEntries"
+.LASF1068:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF1138:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1336:
+	.string	"MSP2_INAV_SET_MC_BRAKING 0x200C"
+.LASF735:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1402:
+	.string	"isTransferInProgress"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1423:
+	.string	"cursorRow"
+.LASF997:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1367:
+	.string	"unsigned int"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1047:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1131:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF1398:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1233:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF1451:
+	.string	"menufunc"
+.LASF1313:
+	.string	"MSP2_COMMON_SETTING_INFO 0x1007"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1071:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1238:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1013:
+	.string	"BIT(x) (1 << (x))"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1215:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1395:
+	.string	"release"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1231:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF1469:
+	.string	"cmsx_menuMixerServo"
+.LASF747:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1153:
+	.string	"MSP_FC_VARIANT 2"
+.LASF1199:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1125:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF395:
+	.string	"true 1"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1409:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1293:
+	.string	"MSP_DEBUG 254"
+.LASF1333:
+	.string	"MSP2_INAV_AIR_SPEED 0x2009"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1396:
+	.string	"clearScreen"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1197:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1034:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1441:
+	.string	"OME_FLOAT"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF998:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF1253:
+	.string	"MSP_RC_TUNING 111"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF1300:
+	.string	"MSP_ACC_TRIM 240"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1081:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF1220:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF1316:
+	.string	"MSP2_COMMON_SET_SERIAL_CONFIG 0x100A"
+.LASF1130:
+	.string	"API_VERSION_LENGTH 2"
+.LASF1196:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1180:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1439:
+	.string	"OME_INT16"
+.LASF1214:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF808:
+	.string	"USE_NAV "
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF924:
+	.string	"USE_MAG "
+.LASF1376:
+	.string	"char"
+.LASF1275:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1301:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1084:
+	.string	"DYNAMIC (1 << 2)"
+.LASF1334:
+	.string	"MSP2_INAV_OUTPUT_MAPPING 0x200A"
+.LASF1174:
+	.string	"MSP_MODE_RANGES 34"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1049:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF742:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF1144:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF1217:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1290:
+	.string	"MSP_RESERVE_1 251"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1219:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1179:
+	.string	"MSP_SET_BOARD_ALIGNMENT 39"
+.LASF1167:
+	.string	"MSP_WP_MISSION_LOAD 18"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1411:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1366:
+	.string	"short unsigned int"
+.LASF1172:
+	.string	"MSP_FW_CONFIG 23"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1001:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1216:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1025:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1066:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1200:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1377:
+	.string	"int8_t"
+.LASF1306:
+	.string	"MSP_SET_RTC 247"
+.LASF992:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1268:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1171:
+	.string	"MSP_SET_RTH_AND_LAND_CONFIG 22"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1236:
+	.string	"MSP_SET_SPECIAL_PARAMETERS 99"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1000:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF989:
+	.string	"FC_VERSION_MINOR 6"
+.LASF788:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1370:
+	.string	"__int8_t"
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1401:
+	.string	"readChar"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1291:
+	.string	"MSP_RESERVE_2 252"
+.LASF1416:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1163:
+	.string	"MSP_CALIBRATION_DATA 14"
+.LASF383:
+	.string	"SITL 1"
+.LASF1018:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1277:
+	.string	"MSP_RESET_CONF 208"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1400:
+	.string	"writeChar"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1379:
+	.string	"uint16_t"
+.LASF751:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF782:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1368:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1225:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF993:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1243:
+	.string	"MSP_STATUS 101"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1355:
+	.string	"MSP2_INAV_SET_LOGIC_CONDITIONS 0x2023"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF728:
+	.string	"__BIG_ENDIAN 4321"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1052:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1265:
+	.string	"MSP_3D 124"
+.LASF1218:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF774:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF732:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1274:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1464:
+	.string	"CMS_Menu"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1359:
+	.string	"MSP2_INAV_GVAR_STATUS 0x2027"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1406:
+	.string	"supportedTextAttributes"
+.LASF1286:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF762:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1062:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1262:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF1287:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF1338:
+	.string	"MSP2_INAV_SET_MIXER 0x2011"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF1058:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1307:
+	.string	"MSP2_COMMON_TZ 0x1001"
+.LASF1466:
+	.string	"menuMain"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF766:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1074:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1140:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF778:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1123:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1468:
+	.string	"cmsx_menuBlackbox"
+.LASF1087:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF1134:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF1007:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1465:
+	.string	"shortGitRevision"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1176:
+	.string	"MSP_FEATURE 36"
+.LASF1139:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF1027:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1207:
+	.string	"MSP_REBOOT 68"
+.LASF1213:
+	.string	"MSP_SET_LOOP_TIME 74"
+.LASF1010:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1235:
+	.string	"MSP_SPECIAL_PARAMETERS 98"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1311:
+	.string	"MSP2_COMMON_MOTOR_MIXER 0x1005"
+.LASF1048:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1127:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF1320:
+	.string	"MSP2_COMMON_SET_SETTINGS 0x100E"
+.LASF1252:
+	.string	"MSP_ANALOG 110"
+.LASF1118:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF756:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1475:
+	.string	"infoTargetName"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1272:
+	.string	"MSP_SET_BOX 203"
+.LASF770:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1483:
+	.string	"cmsx_InfoInit"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1212:
+	.string	"MSP_LOOP_TIME 73"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF743:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1322:
+	.string	"MSP2_SENSOR_RANGEFINDER 0x1F01"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF958:
+	.string	"USE_ADC"
+.LASF1109:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF767:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1457:
+	.string	"OSD_Entry"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1232:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1471:
+	.string	"cmsx_menuVtxControl"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1305:
+	.string	"MSP_RTC 246"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF784:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1337:
+	.string	"MSP2_INAV_MIXER 0x2010"
+.LASF768:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1332:
+	.string	"MSP2_INAV_SET_RATE_PROFILE 0x2008"
+.LASF1002:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1067:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1372:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1112:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1450:
+	.string	"func"
+.LASF740:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1419:
+	.string	"posX"
+.LASF1420:
+	.string	"posY"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1183:
+	.string	"MSP_SET_MIXER 43"
+.LASF1224:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF1271:
+	.string	"MSP_SET_PID 202"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF1422:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1461:
+	.string	"onExit"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1030:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1397:
+	.string	"drawScreen"
+.LASF1297:
+	.string	"MSP_UID 160"
+.LASF1059:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF765:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1221:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1076:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1031:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF752:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1425:
+	.string	"cachedSupportedTextAttributes"
+.LASF1467:
+	.string	"cmsx_menuImu"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1407:
+	.string	"getFontMetadata"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1350:
+	.string	"MSP2_INAV_SET_TEMP_SENSOR_CONFIG 0x201D"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1429:
+	.string	"OME_LabelFunc"
+.LASF1284:
+	.string	"MSP_SET_3D 217"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1012:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1028:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF396:
+	.string	"false 0"
+.LASF925:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1189:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF744:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1190:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF1008:
+	.string	"EXPAND_I(x) x"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1339:
+	.string	"MSP2_INAV_OSD_LAYOUTS 0x2012"
+.LASF1413:
+	.string	"displayPortVTable_s"
+.LASF1393:
+	.string	"displayPortVTable_t"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF1159:
+	.string	"MSP_NAME 10"
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF1017:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF783:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1310:
+	.string	"MSP2_COMMON_SET_SETTING 0x1004"
+.LASF1292:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1443:
+	.string	"OME_TAB"
+.LASF1282:
+	.string	"MSP_SET_MOTOR 214"
+.LASF1349:
+	.string	"MSP2_INAV_TEMP_SENSOR_CONFIG 0x201C"
+.LASF1346:
+	.string	"MSP2_INAV_DEBUG 0x2019"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF1145:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1283:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1408:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1098:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1269:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF731:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1380:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1201:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF733:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF725:
+	.string	"_CTYPE_H 1"
+.LASF1342:
+	.string	"MSP2_INAV_OSD_SET_ALARMS 0x2015"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1247:
+	.string	"MSP_RC 105"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1440:
+	.string	"OME_String"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF1094:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF781:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1405:
+	.string	"txBytesFree"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1178:
+	.string	"MSP_BOARD_ALIGNMENT 38"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1462:
+	.string	"onGlobalExit"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF739:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1330:
+	.string	"MSP2_INAV_SET_BATTERY_CONFIG 0x2006"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1136:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF1463:
+	.string	"entries"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1348:
+	.string	"MSP2_SET_BLACKBOX_CONFIG 0x201B"
+.LASF1470:
+	.string	"cmsx_menuNavigation"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1137:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF1072:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF852:
+	.string	"USE_LOG "
+.LASF738:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1100:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF1122:
+	.string	"CMS_EXIT (0)"
+.LASF1165:
+	.string	"MSP_POSITION_ESTIMATION_CONFIG 16"
+.LASF1064:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1022:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1009:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF1237:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1479:
+	.string	"menuFeatures"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1415:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1147:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1043:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1226:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1203:
+	.string	"MSP_RX_MAP 64"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1309:
+	.string	"MSP2_COMMON_SETTING 0x1003"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1026:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1386:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1404:
+	.string	"resync"
+.LASF1454:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1314:
+	.string	"MSP2_COMMON_PG_LIST 0x1008"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1198:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1014:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1082:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1273:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1173:
+	.string	"MSP_SET_FW_CONFIG 24"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1351:
+	.string	"MSP2_INAV_TEMPERATURES 0x201E"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF749:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1182:
+	.string	"MSP_MIXER 42"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1075:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1126:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1525:
+	.string	"long-double.h"
+.LASF1534:
+	.string	"__locale_t.h"
+.LASF1539:
+	.string	"platform.h"
+.LASF1531:
+	.string	"string.h"
+.LASF1541:
+	.string	"target.h"
+.LASF1519:
+	.string	"libc-header-start.h"
+.LASF1517:
+	.string	"stdbool.h"
+.LASF1497:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1515:
+	.string	"cms.h"
+.LASF1506:
+	.string	"cms_menu_builtin.h"
+.LASF1501:
+	.string	"stdint-intn.h"
+.LASF1496:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1499:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1503:
+	.string	"display.h"
+.LASF1511:
+	.string	"cms_menu_vtx.h"
+.LASF1486:
+	.string	"src/main/cms"
+.LASF1491:
+	.string	"src/main/target/SITL"
+.LASF1523:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1495:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1537:
+	.string	"endian.h"
+.LASF1535:
+	.string	"strings.h"
+.LASF1521:
+	.string	"features-time64.h"
+.LASF1504:
+	.string	"cms_types.h"
+.LASF1500:
+	.string	"types.h"
+.LASF1551:
+	.string	"msp_protocol_v2_common.h"
+.LASF1489:
+	.string	"src/main/drivers"
+.LASF1498:
+	.string	"/usr/include"
+.LASF1485:
+	.string	"src/main/build"
+.LASF1529:
+	.string	"time64.h"
+.LASF1509:
+	.string	"cms_menu_mixer_servo.h"
+.LASF1540:
+	.string	"common.h"
+.LASF1528:
+	.string	"typesizes.h"
+.LASF1548:
+	.string	"cms_menu_osd.h"
+.LASF1487:
+	.string	"src/main/common"
+.LASF1488:
+	.string	"src/main/config"
+.LASF1508:
+	.string	"cms_menu_blackbox.h"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_builtin.c"
+.LASF1512:
+	.string	"cms_menu_battery.h"
+.LASF1502:
+	.string	"stdint-uintn.h"
+.LASF1492:
+	.string	"src/main/target"
+.LASF1544:
+	.string	"utils.h"
+.LASF1513:
+	.string	"cms_menu_misc.h"
+.LASF1520:
+	.string	"features.h"
+.LASF1507:
+	.string	"cms_menu_imu.h"
+.LASF1553:
+	.string	"msp_protocol_v2_inav.h"
+.LASF1493:
+	.string	"src/main"
+.LASF1549:
+	.string	"cms_menu_ledstrip.h"
+.LASF1545:
+	.string	"time.h"
+.LASF1530:
+	.string	"wchar.h"
+.LASF1514:
+	.string	"cms_menu_builtin.c"
+.LASF1510:
+	.string	"cms_menu_navigation.h"
+.LASF1552:
+	.string	"msp_protocol_v2_sensor.h"
+.LASF1526:
+	.string	"stubs.h"
+.LASF1494:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1490:
+	.string	"src/main/msp"
+.LASF1542:
+	.string	"sanity_check.h"
+.LASF1524:
+	.string	"cdefs.h"
+.LASF1533:
+	.string	"locale_t.h"
+.LASF1518:
+	.string	"stdint.h"
+.LASF1547:
+	.string	"build_config.h"
+.LASF1532:
+	.string	"stddef.h"
+.LASF1527:
+	.string	"stubs-64.h"
+.LASF1550:
+	.string	"msp_protocol.h"
+.LASF1536:
+	.string	"ctype.h"
+.LASF1522:
+	.string	"wordsize.h"
+.LASF1505:
+	.string	"version.h"
+.LASF1543:
+	.string	"common_post.h"
+.LASF1546:
+	.string	"parameter_group.h"
+.LASF1538:
+	.string	"endianness.h"
+.LASF1516:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 Ye\002"
+	.string	"\024\004M"
+	.string	"\t"
+	.string	"\272\343\240\335\004\n\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\240\342\234\212\n\003\326\226\262\343\006\004\244\221\260\352\r\006\b\332\374\233\255\r\013\350\300\246\230\b\020\337\225\241\267\013\021\316\310\252\353\016"
+	.string	"\003"
+	.ascii	"^D\260+w\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 2}\001"
+	.string	"\204\002&"
+	.string	"\001"
+	.string	""
+	.string	"\022\227\246\205\204\003i\001"
+	.string	""
+	.string	"\002\036\227\246\205\374\002i"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \031\255"
+	.string	""
+	.string	"x\r"
+	.string	"\001"
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.lto.d5d2f9ec028fbb30,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cmsx_InfoInit.24.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375`\375\002%\026"
+	.string	"\226g\213J\260\022R:\n\007W\324\303p\364H0h\337\316#\225&;\037\241\034\346u\326\302\026*\207\3572R]\323U\323\363\036\255\374n?\343`\335\221\037l\375A\177\n}(B\300yUz\326\341\201\321\034\001\350'do\"wJ\001u"
+	.string	"t"
+	.string	"r"
+	.ascii	"\265\372\016\030\301\370y\025O\272\331P\002|$~\030`\361(\365"
+	.ascii	"\250\265\276\354\273\t\375\034_B?w\204\307\207\276[\224\267\217"
+	.ascii	"\"\235\341\312\233\017\033b\322\361r>\206\242\317\356\306\247"
+	.ascii	"vB!\314\252\212\350\300\313\036\236\216\024\221\202N\201>\001"
+	.ascii	"\360\200\036\212\3600\204)\265\326\020\336\216\334\003_@\210"
+	.ascii	"I\307\013\272\024]"
+	.string	"j\255\226:\336\317\335\272\355!\333\020\354\r\003\034v\311\307G\323Z\345\377\275A\021\356\207\356L\200LUye\373r\344\366\354\303\254r&\274F\266\353\277\273\025J\217SZ\234\322tJ\317P:\224\322\273\322RJ\237$\201\210\223\252Z5daU\251\351T\342\277\337\276\371@\207\214(\261\370\316\342\366\237\237\306\234\335\030\f\221AG\255U\345\323\017\306\317\224\360%t$\005\313\345W\\8I\255FP1\0024tj\3520\267\267\266k\316\204sB\345\2778\214\t\376\321\247c4\222&J\267C\334\361R\342R \"\301\240\333XJ\242\n\267\347y\033\245K\003F\355\310\037\376\207\333\350\\\272\317y\bw\356TjaA6\326Z\177\344\317\366=Dr\277\273\317\241\320\221Yn\255\334\363\004\361\225\036\234\205?r\205\032\275\356\323\257\321\317/\n\016!\234\314r\200`\261\033\266@\001\214\f\213L\313\312"
+	.ascii	"\331\214&!t\314\212M\354\246&f\203y\261\331\314\310^j\262\230"
+	.ascii	"\227M,\202\354\025C\253\275V\bxFa\206\366\272\231\315h\257\020"
+	.ascii	"_\275\241hK\021nu,\203'\246|\034*\3433pF\236L\250x\340d\226e"
+	.ascii	"\020i\334\236E\027\324\265KC\252\274\265=\343\375D[\353 \007"
+	.ascii	"\360a\r\020\255u\301\311\253\207\265\326*\272\366\277\247\030"
+	.ascii	"xk](\271\r2@\25014\345\230S\242B\301H0\"\243\3151\200\002!2\""
+	.ascii	"\017\020X\210d(Isx\325?0x\3167D1G\326:gM\205c\300$\311\327\036"
+	.ascii	"\324\b\0068\353pa\372\252\352\324\314\327e\276\357\200\202\236"
+	.ascii	"N\023\304\bP\200\24167\346\357\347@\3202\f2\241\377\202\320\240"
+	.ascii	"a\347\227\\\002.\255\320:\242F%0\275]\331p^\206\213\300\023\247"
+	.ascii	"dIo_\200\352\260\035\320H\205\205\350\201\237p\256\023Hmp\317"
+	.ascii	"]\355\311{?y\3122\013\035C\377"
+	.text
+	.section	.gnu.lto_menuInfoEntries.31.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375`_\001\255\f"
+	.string	"d\024\345\001"
+	.string	""
+	.string	"n"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\330\232\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\005\f\202\200\200\370\324qwi7\206\bg\254\254\024e\307\310\001q\306\001o\305\001m\304\004\270\324qca?\315\316\001q\314\001o\313\003\005\001'G\206\b_\206\200\200\370\317A]\321N\254\254\024]\324(us\325\001q\323\001o\322\002\005\001'U\270\317Aw\330[\254\254\024w\333(us\334\001q\332\001o\331a\206\b[\234\254\364\fY\337(us\340\001q\336\001o\275\001m\2730W3\341\0014\335\001\327\001\326\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms_menu_builtin.c"
+	.string	"\007TARGET"
+	.string	"\007GITREV"
+	.string	"\0062.6.0"
+	.string	"\006FWVER"
+	.string	"\005INAV"
+	.string	"\005FWID"
+	.string	"\r--- INFO ---"
+	.ascii	"! \260\002\0311\335\001\272\001\331#\310+\374\rR\222\321\236"
+	.ascii	"\034T\025$\242\303\215UC\217D\266\367\211\367\210\216\334,\217"
+	.ascii	"\330?\342T\001\227\033\343\226Y\3755dAAS\243\317\210\345\346"
+	.ascii	"\273\261\034\232\330\310\347\320%`E\tC\017\252\b"
+	.text
+	.section	.gnu.lto_menuInfo.32.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 r\221\003"
+	.string	"6"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\337\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\234\236\354\r{y"
+	.string	"?\202\210\200 wu\275\001s\274\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms/cms_menu_builtin.c"
+	.text
+	.section	.gnu.lto_menuFeaturesEntries.39.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375`T\001\235\013"
+	.string	"\344\022\325\001"
+	.string	""
+	.string	"s"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\320\236\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\005\004\270\356qig7\206\be\254\254\024c\307\310\001q\306\001o\305\001m\304\370\354qia<\206\b_]\315\316\001q\314\001o\313\003\347qi[H\206\bYW\323\324\001q\322\001o\321\002\270\347qiUX\206\bSQ\331\332\001q\330\001o\327b\206\bO\234\254\264\016M\335\336\001q\334\2730K3\337\0014\333\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms_menu_builtin.c"
+	.string	"\004VTX"
+	.string	"\013NAVIGATION"
+	.string	"\017MIXER & SERVOS"
+	.string	"\tBLACKBOX"
+	.string	"\021--- FEATURES ---"
+	.ascii	"! 0\003\031Q\343\272\007d\021\212\233&\227d4E\031\255\341`1\r"
+	.ascii	"\336\210\2562\206\357\006oD'\304\305M\2037\202\256M\022^\320"
+	.ascii	"\304\350g\304j\327\253d\271ob\203\237\303\226\200\021%\206\036"
+	.ascii	"L\021"
+	.text
+	.section	.gnu.lto_menuFeatures.40.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 d!\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\376\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms/cms_menu_builtin.c"
+	.text
+	.section	.gnu.lto_menuMainEntries.48.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375`B\002\205\017"
+	.string	"$\030\266\002"
+	.string	""
+	.string	"\200"
+	.string	"\005\001\006\035\001\020\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001\006y(wu\300\001s\277\001q\275\001o\274\001m\273\035\001\003\005\001\212\001\202\200\200\374\342\203\324\202\007\177k\303\001\005\001'1\206\bi\206\200\200\350\002g\305eu\306\001s\304\302\025\001\007\002\202\200\200\370\317\342\3127\206\bca\314\315\001s\313\001q\311\006\004\206\200\200\370\316r_]\276D\254\236\024g\323wu\324\001s\322\001q\321\001o\320\005\206\200\200\270\316r_[J\206\bYW\331\332\001s\330\001q\327\004\315rUSV\206\bQO\337\340\001s\336\001q\335\003\307r_M_\206\bKI\345\346\001s\344\001q\343\002\307r_Gi\353\354\001s\352\001q\351'u\234\236\260\024W\357\360\001s\356\273\310\001E3\361\0014\355\001\350\001\347\001\342\001\341\001\334\001\333\001\326\001\325\001\317\001\316\001\310\001\307\0015\301\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms_menu_builtin.c"
+	.string	"\005EXIT"
+	.string	"\fSAVE+REBOOT"
+	.string	"\005MISC"
+	.string	"\013FC+FW INFO"
+	.string	"\bBATTERY"
+	.string	"\tFEATURES"
+	.string	"\013PID TUNING"
+	.string	"\013-- MAIN --"
+	.ascii	"6 \020\003\021\241\252\003\300\020\221G\204\270Pr\311\256\246"
+	.ascii	"`\310\215@\232\240X\343\310lO\004\3037\203m\004Ma\006\254\233"
+	.ascii	"\033\006c#\r\232\316\rZ\0277\f\326F\2324wX\366B'\345]\201\275"
+	.ascii	"\243\3131f\332\212\3340X\021\202K\375\025]\270\nc\344M+\017\324"
+	.ascii	"\224\332#\320\r\300\260 y\372\234`\340/\314\361\206\002\007"
+	.text
+	.section	.gnu.lto_menuMain.49.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 d!\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\344\202\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\"./src/main/cms/cms_menu_builtin.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 \272M\004"
+	.string	"\004\006\266"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\030\177\005\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\0056\006`\026\007\300\204\001"
+	.string	""
+	.string	"\003\0051\b\301"
+	.string	"\0050\t\300\003\0052\n(\0133\f \r4\016\0015\177\017\377\037"
+	.string	""
+	.string	"\200\320\200\002'\0207\0218\0229\023:\024\037\025\027\026\300\204\001"
+	.string	""
+	.string	"\003"
+	.string	"\021"
+	.ascii	"sH\f\032V\t.\302a\32008vb\225\032\304\305\245\006\026\203\304"
+	.ascii	"3\033\006\016\027%\004\204f\211$\005\345\t"
+	.text
+	.section	.gnu.lto_.refs.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375 E\255\001"
+	.string	"RD\f\021pks\374\377\277\001\212\307\207M\315\253\333&)\0034\376\273\230xX8\325\315\317i+\032\035|6\333\300e\352R\"\227\307\345]Z\311\"\231\004"
+	.text
+	.section	.gnu.lto_.decls.d5d2f9ec028fbb30,"e",@progbits
+	.string	"(\265/\375`\202\025\355e"
+	.string	"\n\254\330%S0\022JJ\007\352\207\314PR\315\205\354\224M{\036 \252J]?/`F\253\3248?\350M\3160\252SevM\016\337\013sG\264\372Q\322\376iS\026\031\202Ce\241mdG\331u]\037\304\347\332L\306J\016_U\254c\332\255`\020\b\311\2272\005\376\001K\002U\002H\202\260\352\033\207qk\323\256|\260zs\353\265u\235a1\230\263\333\325r\232^\276\234Ze\036\270\315g\367VE\326\306\246\004\0066!\255\366"
+	.ascii	"\304\362\346#\210\013\354\277\306_\332\373\203\323#\310\230\032"
+	.ascii	"\234\354\353^\346\206,\013\310\233\022w\341\262\244l\r\257\325"
+	.ascii	"\237\300\356\300E\255\022[\262\325*s\371\207*\270\212\357^\003"
+	.ascii	"~A\204\360P\304\236\310\212\340\340\252\276\314\347V\256\033"
+	.ascii	"\234\356Z}\b,_\3413\236\036\300h-\217\317\311\211\t\264\325s"
+	.ascii	"\300\236\017X9\217\017X?\203\005\301>V\310n\276\234vc\255\236"
+	.ascii	"\305x\214[\022\356m\336{\005\360aIE}i\365a\034\\s\330g\345.\341"
+	.ascii	"9\314g}N\2657\214\247\355J]\223V\317S\256\322\276\330zAL\253"
+	.ascii	"\276\341\231\312\003\210^\025\307a\277\332\235)gY\224)`\f\227"
+	.ascii	"UD\255\301~\356b/\376\3529\231\2407\354\336\266\207\247+\210"
+	.ascii	"\222\030Z\236\0344\274'R\255r\024\226rn\031\207\017U\274\307"
+	.ascii	"\004\273^\367^n\037\200\336\233\304-\317\232{\223x\230G0\217"
+	.ascii	"P\241T\3150\266\252o\366-\007W\226}V\026X\374\234\300\n?\253"
+	.ascii	"\200\304(\374\274\343\277\232\020\177\303\020b\377\236\241\374"
+	.ascii	"9y\374\331\250\350g\0346~&\216P\300\337'\374,\300\317\301\237"
+	.ascii	"\003\370y\200\237\013\340\237\b\377s\376\376\340g\b~\016\341"
+	.ascii	"g\020~\366\340\347\016\270\306\317\033<\315\1774\377\351\376"
+	.ascii	"\333\375\257\373Y\304\3172~~\361\037\356\277\230\377n\377\203"
+	.ascii	"\177\363\370?\326f\3603\006\377\245\374\007\340\377\327\357\357"
+	.ascii	"\234\237/\370\231\202\237'\370Y\202\237#\370\271\305\317B?\247"
+	.ascii	"\3709\350g\006~\006\372y\201\237K\374L\342g\003~f\177^\177V\377"
+	.ascii	"\343\375'\373?\375?\345?\330\177\001\376w\371\317\346\345\345"
+	.ascii	"\345\375\255\343\357\205\375 Z\004\034\\E\260\317\372\336\022"
+	.ascii	"\013T\032\276\235\323v2\331O"
+	.string	"{\231-\312Dm\335\335\347\363\304\033\217e\265\341{i\332K,\375\001\273PK1\027\332\334\335\253vB'\256\214\3115cyd\0302\033ns\316;\347u\223mC\254\211\332\342\272SO\023\177+\275\233\253\322R\036T\253\257\353\244\025*\313\217(\235\324L\034\035\230\242\300\260\232\260\"Wj>Z\235\366=\227\271y\232\322\240\245\325w\021\366\357\177\275I\317{/\324M{\317\224|\347\233\263\211\377\307\275\253\267W\"\353^\2539\272u\207\250\020:\021\367\377'\270\227\206\263\031}\3668\245I\314\236\037m\364\311)\215>\365\334\026L\310\225Z\335\353lB\231\235t\333\373\004\3426\243O\354M\232s\266\367\331s\333\244\347\225\336\3137\372t\206%1{\234\322(\323)\205>\3658\333\350\323m^&\333\004\273\267\t}\352\341j\243\327)Mz\002\341\224B\231G\346\256\200\370\264i\3461\235\315\333D"
+	.string	"W\023\372\\s\266P>\273\227\031\266t\237\321{\251\240#\316\232M\230gJkM8S\315\226\311C\200(UAsZ\245\273\346t\002-Z\272\027\356\002y\200\311\314\366\336\333\343*1\371\336\245\366y\257\022\224\204)(\203\351\361\274\277\333LbR\252\202\372\226\224\240=\256\023$\374\344\224VA\205hSi\326Uj\231\234u\341\242OV\312l\257\023\315/\215\231\333\335\032\274\037S\030 FZe5aM_\332\230.-2wL\307u\234\206\355xZ\206\347\330\214\263\311cg\030M\225\252\251\271{\333\263\327Y\216\331\246bT\001\031\303R \211{\255\362\262\034\370\201\261p\226\2364+\247I\251\211\275~.\373\201\3158\207^\233\2053\326\346\364\003\2442\221\2413\343S\357\257\315\rm\360\340X>\343\340J"
+	.string	"\231?G\307K\232!Y=\260g\2658\026\303>\360\224\345~\332{\303\266\260\232\320\3223\007\252\352\307\334\275\3224\326\302r\254\303\323z_O\266J\025\323\334\275\367\016\374B9\366\302pBK\317\333\254b&\201)\322\037\\\356\356\225\016"
+	.ascii	"\004\004\264\246=\005o.;<h\231\223\322\252\217}th-uqU=\264\374"
+	.ascii	"}\245\323\270u6\243NZM\301\301,\215\245\016\214\227\250V\337"
+	.ascii	"X\376F\353\034\334\314\316,iU\210\203+\016\373\254}E\370>k\034"
+	.ascii	"\2248\261Z]\337f=\335\t3U\023+c)\360mnMY\253M\326=\326V\336d"
+	.ascii	"o\333&C`\r\217\340!B\266EkU\201F\206=\345\016\233vXO\371\016"
+	.ascii	"\007\n\333Sv\t\307\311\002\f\234\361\222\322\352{\372\367\223"
+	.ascii	"\246b\346\205\212\222VM\244\t\337R\325\312\316I\253U`\02400*"
+	.ascii	"\034+\366we\370n[5Dz\\wl\212\031\3667e\370\216\022e\2013\273"
+	.ascii	"-.\266\252\253\203\241\325\2576\260?\033\206o/\257\2653g\\7v"
+	.ascii	"Qf\327\032\366\307d\370\206\002\245\251v\334Z2swOxa\210LY`\026"
+	.ascii	"\255ik5\227\022\031\343A\251\272\330\264\372\266\341\357\032"
+	.ascii	"\332I#\3111\313b\345\256\325~\"|o\365\340\236\320\244Z\275a\237"
+	.ascii	"5g\215\352F\213\345\201\032f\375\317b7\006\273N,\226\025wg\342"
+	.ascii	"w\213\240i\241\325\337<\331_\230\341\273I\223\246\3529\241%\332"
+	.ascii	"0g\\>\2515itl,P,\206\030v\332\232Dm\335qa\177]\206\357\253\253"
+	.ascii	"\306\322I\322\266\251\335\335;ubgK\0332YW\313\f\032\226V\257"
+	.ascii	"&a\201_`\200\241\251r\234\227\304\230\250-.u\212\375\035\031"
+	.ascii	"\276\223$i\252\037\260\313\034!\206#g\356\356\245:\261\262\301"
+	.ascii	"\311\365\220c\201yF\246m\244\253\200<|\0049\301x\354\323G\\]"
+	.ascii	"G"
+	.string	"\377>\322\320F\2622\351\232\242\374\3440\331D\261Z\005\236qp\34585\226\307\307\220o\340\366\301\323\366\321T\027\264\227\251\303\203\213\352\004\216\025)\254\267V\373\205\266\tl\253B\307\006\013\033\244\237MT\212\314\375=\325.\264\220&\302\323\036\362\367\217f\362\222\352\244\037T\226<u\224\023\017#s=\244\201\364\223\327\246\332\013\005\244r\244\351\t\364\003\004\004\3443SC\227+\035\365=2\366\275)P=1R\306\240i\261\3571i\247V\225\262A\354\t\025\333\324d\255\230\215\345\320\352{Nl\337E#\242\006\313\"\216$\221\003\3403\340 F\215\033\236\345\216\0209\220\311\345\021\351\002i\351\301\261\304\021i\\\022q\030w\0205P\016\031)\200\334\221,\326H\026\221l\f\221@B\3320\201\210\230\203\202\036\237\027\005\005\225FD;/\n\"R\032\215\020 R\032e\374^\024\224B\262\270\\\022)"
+	.ascii	"\241,&\217\226\304\242\005\276\027\005\035\031\031C\034\031\305"
+	.ascii	"\360)\213F\236\241\0322\\\260\312\2421\271<\026q\222\305\345"
+	.ascii	"\361\305\021\211\223\\\322\230\001\342\210\\\201K#\322\213\034"
+	.ascii	"D\033\310\0340\216H\337\321H\224\201,\341h\324yQP\262\270\003"
+	.ascii	"\305\215#\322\2504\356(n\2604\302X&\221EJ\020O`i<\306@\226p\214"
+	.ascii	"1\204\2444\"\372\235\310\230,\036\2138\330?\260\242\201\025B"
+	.ascii	"H8\027j\221\242E\212\365B-\204\302\026+\204\354W\b{C\025\324"
+	.ascii	"\230\221\243\304A\314Q\302\315\215\242\tDD\035\353\022\251\270"
+	.ascii	"T_\024\244,\340H\035\305$\212%\022\231D\261\223Bry|QC\206\013"
+	.ascii	"\236\245rh\231D\322H\201\230C\207\322x\343\247&\2274\210\216"
+	.ascii	"G\026,u\3148:\026e\324\220\341\242\207\350xT\002{#\206Qqi\\\211"
+	.ascii	"K\342\ru9$\264<\032\217p\212:RX\252\027\202@\205\215\033+n\260"
+	.ascii	"\b2\340,X\270\020\321\201\0060X\242\240\243q\231\303xdc\350\350"
+	.ascii	"X4\032R\032\021\2418\032\211F(\210\222J\024A#\222\304\"\"\225"
+	.ascii	"MU\232YV\334\032\274\241'\032\032/\214\215\f?\276\264\332h\302"
+	.ascii	"\267\232\020eih?`\375\232z\220\241\354.\215\013<\276\206\264"
+	.ascii	"\372N\363\367\226\266\373QiY\255qp\3557\341\273\356fH\027$L\350"
+	.ascii	"\320\260Y\345\340\326\352\033\315\337f\372\fpmk\353\255Uvrp\355"
+	.ascii	")\023\276\347t\314\346\272\234\312\220\251z\372\220\244\3257"
+	.ascii	"\231\277\345zL\027.mx\255\376\216\203+O\234\360-\206\315\313"
+	.ascii	"\303r\325*\320\0078\337\227S\224\223V\337p\177\277u\230!\323"
+	.ascii	"\325\026\016\256;`\204o\267\225\313\211\007\245U\23566\036\""
+	.ascii	"H\2224\233t\t\326\\\253\275&|\367\020\001\023+(\255\366\276P"
+	.ascii	"\365\344\320<q"
+	.string	"\302\003\027PL\007%<\274\250)\2412&\325\352[\355\357\035\272\213\nyl\322\264z8\016\256\277-\302\201\230\250\221(\206\220D\206fFD$I\222t\001\005\204 \353\254\264\016\022\200\005-\221A\350\310\210HIRZ\030\3667B\204\306Y9\205_\321\034ht\251\246\346%\234\247>s\323\006n\210\035\354\315\021\331\330\227\315\376\352{]\256\240\343\325\217\333V\340g\211Nt`\324'\007+\330\301\211u\3305\356O!o}zt\270q7i\254\236\205\331d\230\005\035\321\356L+\375\311r\031\033\302o\317\233\323\234&\n\210v\355\311A[r\005u'\373\240\256\345\005\221:\\F\214\257vb\004\032To\364]\201\276\032\250\262S\r\341-XQ\206\205\233\371\023V\272\246\227\031\267\357\004SY\025,T\243q\fO*\tl\251\002.\034\227\025\323l\034\005Ap\341\225\b\200\342qI\325l\320\210"
+	.ascii	"\006\205\322\345\246\207\272\257\365\030\333\310\b&\252i\301"
+	.ascii	"\311\276\002Qez\323\2366\270\230[5l\263\350\245U\330!\004\242"
+	.ascii	"\304P:\"\322F\201w\374cp\274zg\034\f'R\202\361\321\216\020\265"
+	.ascii	"\336\215\360\263\3409\3727(WX\367\372\215\306'\350+<\306\333"
+	.ascii	"\006\203S>;=ND\347\202CJ`uk`\177\350)kHO\222\303-\007\253A\256"
+	.ascii	"\303.M\216`\353\371\207\2611M\024\013\236\312\340\245\3101\300"
+	.string	"\227\2455A\320\026\270\307E\333\340\267\214\344\205\335E\225X%Y\225\341\351\t\254\rl\331\030E\344\227\236\331\202TN\001BJ\340\211\251ow\223\\\322\332=E\030\376\276\034\337\006Gr\203\237b;\210\243\022.\035\234\254\236EEm\223L:\"\032u\246\327(\006\001\034\253y\342y\212\357`\001\341\216^\275\256k\361.\227+5\221\254up\200\216\277\t\"|\377k\306D\n\240\241\217\273\224\026\016\006\022\374C\273 \300\325\261\344f>\177J\233y\313uS\035\312\240\033\r\225\213\202\325\276\220\371K\t0\2376\270\247\026\2371}Oo\310\0058\300\357>\220\275\fB\361\f\301\207\013\027\373)\201\260]\223}\n\323JQ\035\310He\016D5_\027\310\220\021\201#\3060#\240\243\231d\201\225\211\276\016\3368\373\337\343\351\021z\254 \266!7\341\3217\243\f\243\177\020l}\244\252\273\017\276\320\211\327"
+	.string	"\375\242f$e0\272\r\342/\335\327\002\211\220\254\320\220\nF\201\0331\202d\212\314+:\352.\027\243\257\232\254\226\353\302/\313N\346\373\225\217JF\262>\032\206)\"\2012\244Y\315\r&\210\345g\371\320\037\242\374N\311\367\013\026\265s\331N\327\234z\353F\b+\212\241\005\312\337\367\023Os\203\327\302\324\224u\246N~\337\214\350K\377G\340\226\312\3464;\254q\027KI\301\033\325\361?J\236\207\221Z\267\351)\r\005\275\005H\304\332\254\327-"
+	.ascii	"]3\236P\276\"|\340\311\327\260\377\223\357g\255\214\267S\323"
+	.ascii	"\0250s\356Q|\266\214F\036\3166a#}^\354\212#\326\227\370\216\267"
+	.ascii	"Cp\205\357\006\337\005\336\265X\254\375\356\266^i\351\031\030"
+	.ascii	"[\335d:\203\326\272\006m\202\320O\376\260\n"
+	.text
+	.section	.gnu.lto_.symtab.d5d2f9ec028fbb30,"e",@progbits
+	.string	"menuMain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\001"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"cmsx_menuImu"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\001"
+	.string	""
+	.string	"cmsx_menuBattery"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"cmsx_menuMisc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"cmsMenuExit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\001"
+	.string	""
+	.string	"cmsx_menuBlackbox"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\001"
+	.string	""
+	.string	"cmsx_menuMixerServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"cmsx_menuNavigation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"cmsx_menuVtxControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d5d2f9ec028fbb30,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19752 @@
+	.file	"cms_menu_imu.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms_types.h"
+	.file 6 "./src/main/flight/pid.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/cms/cms_menu_imu.c"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/navigation/navigation.h"
+	.file 12 "./src/main/cms/cms_menu_imu.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_imu.c.0ba9f89e
+	.weak	cms_menu_imu.c.0ba9f89e
+cms_menu_imu.c.0ba9f89e:
+	.long	0xd74
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF3001
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2754
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2755
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2756
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2757
+	.uleb128 0x5
+	.long	.LASF2759
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2758
+	.uleb128 0x5
+	.long	.LASF2760
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2761
+	.uleb128 0x5
+	.long	.LASF2762
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF2763
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2764
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2765
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF2766
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF2767
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2768
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF2769
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x6
+	.long	0xd7
+	.uleb128 0x4
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2770
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xf7
+	.uleb128 0x6
+	.long	0xe6
+	.uleb128 0x12
+	.long	.LASF2778
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2771
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x122
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2775
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0x103
+	.uleb128 0x5
+	.long	.LASF2776
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2777
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x146
+	.uleb128 0x12
+	.long	.LASF2779
+	.uleb128 0x5
+	.long	.LASF2780
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x157
+	.uleb128 0x12
+	.long	.LASF2781
+	.uleb128 0x5
+	.long	.LASF2782
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x16d
+	.uleb128 0x6
+	.long	0x15c
+	.uleb128 0x11
+	.long	.LASF2802
+	.byte	0x98
+	.byte	0x4
+	.byte	0x56
+	.long	0x271
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x344
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x344
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x344
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2786
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x344
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2787
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x35d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2788
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x385
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2789
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3ad
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2790
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3df
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2791
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3f3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2792
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x344
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2793
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x403
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2794
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x417
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2795
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x42b
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF2796
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x449
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2797
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x46c
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2798
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x480
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF2799
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x495
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF2800
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x403
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF2801
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x4b3
+	.byte	0x90
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2803
+	.byte	0x20
+	.byte	0x4
+	.byte	0x45
+	.long	0x31a
+	.uleb128 0x2
+	.long	.LASF2804
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x31a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2805
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2806
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2807
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2808
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2809
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2810
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0xfc
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2811
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0xfc
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2812
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2813
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2814
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x12e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2815
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xba
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x4
+	.long	0x168
+	.uleb128 0x5
+	.long	.LASF2816
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x271
+	.uleb128 0x6
+	.long	0x31f
+	.uleb128 0x8
+	.long	0x70
+	.long	0x33f
+	.uleb128 0x3
+	.long	0x33f
+	.byte	0
+	.uleb128 0x4
+	.long	0x31f
+	.uleb128 0x4
+	.long	0x330
+	.uleb128 0x8
+	.long	0x70
+	.long	0x358
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x32b
+	.uleb128 0x4
+	.long	0x349
+	.uleb128 0x8
+	.long	0x70
+	.long	0x385
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xd7
+	.uleb128 0x3
+	.long	0x12e
+	.byte	0
+	.uleb128 0x4
+	.long	0x362
+	.uleb128 0x8
+	.long	0x70
+	.long	0x3ad
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x12e
+	.byte	0
+	.uleb128 0x4
+	.long	0x38a
+	.uleb128 0x8
+	.long	0xfc
+	.long	0x3d5
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x3d5
+	.uleb128 0x3
+	.long	0x3da
+	.byte	0
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x12e
+	.uleb128 0x4
+	.long	0x3b2
+	.uleb128 0x8
+	.long	0xfc
+	.long	0x3f3
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e4
+	.uleb128 0x17
+	.long	0x403
+	.uleb128 0x3
+	.long	0x33f
+	.byte	0
+	.uleb128 0x4
+	.long	0x3f8
+	.uleb128 0x8
+	.long	0xcb
+	.long	0x417
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x408
+	.uleb128 0x8
+	.long	0x12e
+	.long	0x42b
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x41c
+	.uleb128 0x8
+	.long	0xfc
+	.long	0x444
+	.uleb128 0x3
+	.long	0x444
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x14b
+	.uleb128 0x4
+	.long	0x430
+	.uleb128 0x8
+	.long	0x70
+	.long	0x467
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x467
+	.byte	0
+	.uleb128 0x4
+	.long	0xf2
+	.uleb128 0x4
+	.long	0x44e
+	.uleb128 0x8
+	.long	0xfc
+	.long	0x480
+	.uleb128 0x3
+	.long	0x33f
+	.byte	0
+	.uleb128 0x4
+	.long	0x471
+	.uleb128 0x17
+	.long	0x495
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0x122
+	.byte	0
+	.uleb128 0x4
+	.long	0x485
+	.uleb128 0x8
+	.long	0xfc
+	.long	0x4ae
+	.uleb128 0x3
+	.long	0x4ae
+	.uleb128 0x3
+	.long	0x358
+	.byte	0
+	.uleb128 0x4
+	.long	0x13a
+	.uleb128 0x4
+	.long	0x49a
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1
+	.long	0x53d
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2837
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x54e
+	.uleb128 0x6
+	.long	0x53d
+	.uleb128 0x4
+	.long	0x553
+	.uleb128 0x8
+	.long	0x83
+	.long	0x567
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0x567
+	.byte	0
+	.uleb128 0x4
+	.long	0x571
+	.uleb128 0x6
+	.long	0x567
+	.uleb128 0x1c
+	.uleb128 0x5
+	.long	.LASF2838
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x12
+	.long	0x583
+	.uleb128 0x6
+	.long	0x572
+	.uleb128 0x4
+	.long	0x588
+	.uleb128 0x1d
+	.long	0x8c
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x5
+	.byte	0x40
+	.byte	0x5
+	.long	0x5b8
+	.uleb128 0x13
+	.long	.LASF2839
+	.byte	0x42
+	.byte	0x1f
+	.long	0x549
+	.uleb128 0x13
+	.long	.LASF2840
+	.byte	0x43
+	.byte	0x21
+	.long	0x57e
+	.uleb128 0x13
+	.long	.LASF2841
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x5fa
+	.uleb128 0x2
+	.long	.LASF2842
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x18
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1f
+	.long	0x58d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2843
+	.byte	0x5
+	.byte	0x46
+	.byte	0x18
+	.long	0x56c
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2844
+	.byte	0x5
+	.byte	0x47
+	.byte	0x13
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2845
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2846
+	.byte	0x5
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5b8
+	.uleb128 0x6
+	.long	0x5fa
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x5
+	.byte	0x71
+	.byte	0xe
+	.long	0x61e
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2848
+	.byte	0x5
+	.byte	0x78
+	.byte	0x10
+	.long	0x62f
+	.uleb128 0x6
+	.long	0x61e
+	.uleb128 0x4
+	.long	0x634
+	.uleb128 0x8
+	.long	0x83
+	.long	0x643
+	.uleb128 0x3
+	.long	0x643
+	.byte	0
+	.uleb128 0x4
+	.long	0x606
+	.uleb128 0x5
+	.long	.LASF2849
+	.byte	0x5
+	.byte	0x84
+	.byte	0x10
+	.long	0x62f
+	.uleb128 0x6
+	.long	0x648
+	.uleb128 0x14
+	.byte	0x20
+	.byte	0x86
+	.long	0x695
+	.uleb128 0x2
+	.long	.LASF2850
+	.byte	0x5
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x62a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2851
+	.byte	0x5
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x654
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2852
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x62a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2853
+	.byte	0x5
+	.byte	0x90
+	.byte	0x16
+	.long	0x643
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2854
+	.byte	0x5
+	.byte	0x91
+	.byte	0x3
+	.long	0x659
+	.uleb128 0x6
+	.long	0x695
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x93
+	.long	0x6e2
+	.uleb128 0xc
+	.string	"val"
+	.byte	0x5
+	.byte	0x95
+	.byte	0xe
+	.long	0xe1
+	.byte	0
+	.uleb128 0xc
+	.string	"min"
+	.byte	0x5
+	.byte	0x96
+	.byte	0xd
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0xc
+	.string	"max"
+	.byte	0x5
+	.byte	0x97
+	.byte	0xd
+	.long	0xa9
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x5
+	.byte	0x98
+	.byte	0xd
+	.long	0xa9
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2856
+	.byte	0x5
+	.byte	0x99
+	.byte	0x3
+	.long	0x6a6
+	.uleb128 0x11
+	.long	.LASF2857
+	.byte	0x3
+	.byte	0x5
+	.byte	0xbc
+	.long	0x715
+	.uleb128 0xc
+	.string	"val"
+	.byte	0x5
+	.byte	0xbd
+	.byte	0x14
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2855
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x13
+	.long	0xb5
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2858
+	.byte	0x5
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x6ee
+	.uleb128 0x20
+	.long	.LASF3002
+	.byte	0xc
+	.byte	0x14
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x6
+	.byte	0x39
+	.byte	0xe
+	.long	0x782
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2863
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2865
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2866
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2867
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0xb
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2871
+	.byte	0x4
+	.byte	0x6
+	.byte	0x51
+	.long	0x7bc
+	.uleb128 0xc
+	.string	"P"
+	.byte	0x6
+	.byte	0x52
+	.byte	0xd
+	.long	0xa9
+	.byte	0
+	.uleb128 0xc
+	.string	"I"
+	.byte	0x6
+	.byte	0x53
+	.byte	0xd
+	.long	0xa9
+	.byte	0x1
+	.uleb128 0xc
+	.string	"D"
+	.byte	0x6
+	.byte	0x54
+	.byte	0xd
+	.long	0xa9
+	.byte	0x2
+	.uleb128 0xc
+	.string	"FF"
+	.byte	0x6
+	.byte	0x55
+	.byte	0xd
+	.long	0xa9
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2872
+	.byte	0x6
+	.byte	0x56
+	.byte	0x3
+	.long	0x782
+	.uleb128 0x6
+	.long	0x7bc
+	.uleb128 0x11
+	.long	.LASF2873
+	.byte	0x2c
+	.byte	0x6
+	.byte	0x58
+	.long	0x7e7
+	.uleb128 0xc
+	.string	"pid"
+	.byte	0x6
+	.byte	0x59
+	.byte	0xc
+	.long	0x7e7
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0x7bc
+	.long	0x7f7
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2874
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x3
+	.long	0x7cd
+	.uleb128 0x6
+	.long	0x7f7
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2875
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.byte	0xe
+	.long	0x83a
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x4
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF3003
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.byte	0xe
+	.long	0x8ad
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0x1
+	.uleb128 0x22
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2895
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2896
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.byte	0xe
+	.long	0x9a5
+	.uleb128 0x1
+	.long	.LASF2897
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2898
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2899
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2900
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2901
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2903
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2904
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2905
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2906
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2907
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2908
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2909
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2910
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2911
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2912
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2913
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2914
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2915
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2916
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2917
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2918
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2919
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2920
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2921
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2922
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2923
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2924
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2925
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2926
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2927
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2928
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2929
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2930
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2931
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2932
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2933
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2934
+	.byte	0x25
+	.byte	0
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x8
+	.byte	0x43
+	.byte	0xe
+	.long	0xa30
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2937
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2939
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2940
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2941
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2942
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2943
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2944
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2945
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2946
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2947
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2948
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2949
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2950
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2951
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2952
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2953
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2954
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2955
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2956
+	.byte	0x3e
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2957
+	.byte	0x3f
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2958
+	.byte	0x40
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2959
+	.byte	0x41
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2960
+	.byte	0x42
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2961
+	.byte	0x43
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2962
+	.byte	0x44
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2963
+	.byte	0x45
+	.byte	0xf
+	.long	0x7bc
+	.uleb128 0x7
+	.long	.LASF2964
+	.byte	0x47
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0x7
+	.long	.LASF2965
+	.byte	0x48
+	.byte	0x10
+	.long	0xa9
+	.uleb128 0xd
+	.long	0x91
+	.long	0xaae
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2966
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9e
+	.uleb128 0xd
+	.long	0x606
+	.long	0xac9
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xd
+	.byte	0
+	.uleb128 0x6
+	.long	0xab9
+	.uleb128 0x7
+	.long	.LASF2967
+	.byte	0x8c
+	.byte	0x18
+	.long	0xac9
+	.uleb128 0x7
+	.long	.LASF2968
+	.byte	0xa2
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xd
+	.long	0x606
+	.long	0xaf4
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xae4
+	.uleb128 0x7
+	.long	.LASF2969
+	.byte	0xc5
+	.byte	0x18
+	.long	0xaf4
+	.uleb128 0x7
+	.long	.LASF2970
+	.byte	0xd6
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xd
+	.long	0x606
+	.long	0xb1f
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	0xb0f
+	.uleb128 0x7
+	.long	.LASF2971
+	.byte	0xf7
+	.byte	0x18
+	.long	0xb1f
+	.uleb128 0xa
+	.long	.LASF2972
+	.value	0x105
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xa
+	.long	.LASF2973
+	.value	0x113
+	.byte	0x18
+	.long	0xb1f
+	.uleb128 0xa
+	.long	.LASF2974
+	.value	0x121
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xd
+	.long	0x606
+	.long	0xb63
+	.uleb128 0xe
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	0xb53
+	.uleb128 0xa
+	.long	.LASF2975
+	.value	0x12f
+	.byte	0x18
+	.long	0xb63
+	.uleb128 0xa
+	.long	.LASF2976
+	.value	0x148
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xd
+	.long	0x606
+	.long	0xb90
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	0xb80
+	.uleb128 0xa
+	.long	.LASF2977
+	.value	0x191
+	.byte	0x18
+	.long	0xb90
+	.uleb128 0xa
+	.long	.LASF2978
+	.value	0x19d
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xd
+	.long	0x606
+	.long	0xbbd
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	0xbad
+	.uleb128 0xa
+	.long	.LASF2979
+	.value	0x1a8
+	.byte	0x18
+	.long	0xbbd
+	.uleb128 0xa
+	.long	.LASF2980
+	.value	0x1b2
+	.byte	0x17
+	.long	0x6a1
+	.uleb128 0xa
+	.long	.LASF2981
+	.value	0x1bd
+	.byte	0x18
+	.long	0xb63
+	.uleb128 0x23
+	.long	0x721
+	.byte	0x9
+	.value	0x1d9
+	.byte	0x10
+	.uleb128 0x15
+	.long	.LASF2982
+	.byte	0xa
+	.byte	0x7b
+	.byte	0x9
+	.long	0xa9
+	.uleb128 0x24
+	.long	.LASF3004
+	.byte	0xa
+	.byte	0x7c
+	.byte	0x5
+	.long	0xfc
+	.long	0xc11
+	.uleb128 0x3
+	.long	0xa9
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2985
+	.byte	0x6
+	.byte	0xb2
+	.byte	0x6
+	.uleb128 0x15
+	.long	.LASF2983
+	.byte	0x6
+	.byte	0xa3
+	.byte	0x13
+	.long	0xc25
+	.uleb128 0x4
+	.long	0x803
+	.uleb128 0x15
+	.long	.LASF2984
+	.byte	0x6
+	.byte	0xa4
+	.byte	0xd
+	.long	0xc36
+	.uleb128 0x4
+	.long	0x7f7
+	.uleb128 0x26
+	.long	.LASF2986
+	.byte	0xb
+	.value	0x187
+	.byte	0x6
+	.uleb128 0xf
+	.long	.LASF2987
+	.byte	0xeb
+	.long	0x83
+	.long	0xc5e
+	.uleb128 0xb
+	.long	.LASF2989
+	.byte	0xeb
+	.byte	0x38
+	.long	0x643
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2988
+	.byte	0xe1
+	.long	0x83
+	.long	0xc78
+	.uleb128 0xb
+	.long	.LASF2990
+	.byte	0xe1
+	.byte	0x39
+	.long	0x643
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2991
+	.byte	0xb8
+	.long	0x83
+	.long	0xc92
+	.uleb128 0xb
+	.long	.LASF2989
+	.byte	0xb8
+	.byte	0x38
+	.long	0x643
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2992
+	.byte	0xad
+	.long	0x83
+	.long	0xcac
+	.uleb128 0xb
+	.long	.LASF2990
+	.byte	0xad
+	.byte	0x39
+	.long	0x643
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2993
+	.byte	0x7f
+	.long	0x83
+	.long	0xcc6
+	.uleb128 0xb
+	.long	.LASF2989
+	.byte	0x7f
+	.byte	0x30
+	.long	0x643
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2994
+	.byte	0x75
+	.long	0x83
+	.long	0xce0
+	.uleb128 0xb
+	.long	.LASF2990
+	.byte	0x75
+	.byte	0x2e
+	.long	0x643
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF3005
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xd
+	.long	0x83
+	.uleb128 0xf
+	.long	.LASF2995
+	.byte	0x60
+	.long	0x83
+	.long	0xd11
+	.uleb128 0xb
+	.long	.LASF2996
+	.byte	0x60
+	.byte	0x36
+	.long	0x33f
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x60
+	.byte	0x4f
+	.long	0x567
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2997
+	.byte	0x55
+	.long	0x83
+	.long	0xd2b
+	.uleb128 0xb
+	.long	.LASF2990
+	.byte	0x55
+	.byte	0x33
+	.long	0x643
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2999
+	.byte	0x50
+	.long	0xd4c
+	.uleb128 0x16
+	.string	"src"
+	.byte	0x50
+	.byte	0x36
+	.long	0xd4c
+	.uleb128 0xb
+	.long	.LASF2998
+	.byte	0x50
+	.byte	0x3f
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x7c8
+	.uleb128 0x18
+	.long	.LASF3000
+	.byte	0x4b
+	.long	0xd72
+	.uleb128 0x16
+	.string	"dst"
+	.byte	0x4b
+	.byte	0x29
+	.long	0xd72
+	.uleb128 0xb
+	.long	.LASF2998
+	.byte	0x4b
+	.byte	0x32
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x7bc
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 30 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 35 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x23
+	.file 36 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 37 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 38 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x26
+	.byte	0x4
+	.file 39 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 41 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.file 42 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.file 43 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 44 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x4
+	.file 45 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.file 46 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.file 47 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1090
+	.byte	0x4
+	.file 48 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1091
+	.byte	0x4
+	.file 49 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 50 "./src/main/fc/controlrate_profile.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1103
+	.byte	0x4
+	.file 51 "./src/main/fc/settings.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1f
+	.byte	0x4
+	.file 52 "./obj/main/SITL/settings_generated.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xb
+	.file 53 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 55 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.file 56 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x39
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2569
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2596
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x42
+	.byte	0x4
+	.file 67 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 68 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 69 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x45
+	.file 70 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x47
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2709
+	.byte	0x4
+	.file 72 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2710
+	.file 73 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2723
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2753
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1042
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1053
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF2247
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2289
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2598
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2600
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2628
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2628
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2628
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF2628
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF2616
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF2617
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF2618
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF2619
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF2637
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF2638
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF2639
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF2640
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2647
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF2648
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF2649
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF2650
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF2651
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF2652
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF2689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2708
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2722
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2746
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x15
+	.long	.LASF1
+	.long	.LASF3006
+	.long	.LASF3007
+	.long	.LASF3008
+	.long	.LASF3009
+	.long	.LASF3010
+	.long	.LASF3011
+	.long	.LASF3012
+	.long	.LASF3013
+	.long	.LASF3014
+	.long	.LASF3015
+	.long	.LASF3016
+	.long	.LASF3017
+	.long	.LASF3018
+	.long	.LASF3019
+	.long	.LASF3020
+	.long	.LASF3021
+	.long	.LASF3022
+	.long	.LASF3023
+	.long	.LASF3024
+	.long	.LASF3025
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3026
+	.byte	0x10
+	.long	.LASF3027
+	.byte	0x10
+	.long	.LASF3028
+	.byte	0x10
+	.long	.LASF3029
+	.byte	0x6
+	.long	.LASF3030
+	.byte	0x3
+	.long	.LASF3031
+	.byte	0x8
+	.long	.LASF3032
+	.byte	0x6
+	.long	.LASF3033
+	.byte	0x6
+	.long	.LASF3034
+	.byte	0x3
+	.long	.LASF3035
+	.byte	0x7
+	.long	.LASF3036
+	.byte	0xa
+	.long	.LASF3037
+	.byte	0x3
+	.long	.LASF3038
+	.byte	0x7
+	.long	.LASF3039
+	.byte	0x13
+	.long	.LASF3040
+	.byte	0x14
+	.long	.LASF3041
+	.byte	0x14
+	.long	.LASF3041
+	.byte	0x13
+	.long	.LASF3042
+	.byte	0x10
+	.long	.LASF3043
+	.byte	0x13
+	.long	.LASF3044
+	.byte	0x13
+	.long	.LASF3045
+	.byte	0x10
+	.long	.LASF3046
+	.byte	0x10
+	.long	.LASF3047
+	.byte	0x12
+	.long	.LASF3048
+	.byte	0x10
+	.long	.LASF3049
+	.byte	0x11
+	.long	.LASF3050
+	.byte	0x11
+	.long	.LASF3051
+	.byte	0x10
+	.long	.LASF3052
+	.byte	0x10
+	.long	.LASF3053
+	.byte	0x10
+	.long	.LASF3054
+	.byte	0x13
+	.long	.LASF3055
+	.byte	0x14
+	.long	.LASF3056
+	.byte	0xf
+	.long	.LASF3057
+	.byte	0xf
+	.long	.LASF3058
+	.byte	0x13
+	.long	.LASF3059
+	.byte	0xe
+	.long	.LASF3060
+	.byte	0xd
+	.long	.LASF3061
+	.byte	0xc
+	.long	.LASF3062
+	.byte	0xd
+	.long	.LASF3063
+	.byte	0xd
+	.long	.LASF3064
+	.byte	0x4
+	.long	.LASF3065
+	.byte	0x3
+	.long	.LASF3066
+	.byte	0x5
+	.long	.LASF3067
+	.byte	0x2
+	.long	.LASF3068
+	.byte	0x4
+	.long	.LASF3069
+	.byte	0x4
+	.long	.LASF3070
+	.byte	0x7
+	.long	.LASF3071
+	.byte	0x6
+	.long	.LASF3072
+	.byte	0x6
+	.long	.LASF3073
+	.byte	0x7
+	.long	.LASF3074
+	.byte	0x7
+	.long	.LASF3075
+	.byte	0x7
+	.long	.LASF3076
+	.byte	0x1
+	.long	.LASF3077
+	.byte	0x4
+	.long	.LASF3078
+	.byte	0x4
+	.long	.LASF3079
+	.byte	0x4
+	.long	.LASF3080
+	.byte	0x13
+	.long	.LASF3081
+	.byte	0x10
+	.long	.LASF3082
+	.byte	0x10
+	.long	.LASF3083
+	.byte	0x10
+	.long	.LASF3084
+	.byte	0x10
+	.long	.LASF3085
+	.byte	0x10
+	.long	.LASF3086
+	.byte	0x10
+	.long	.LASF3087
+	.byte	0x10
+	.long	.LASF3088
+	.byte	0x10
+	.long	.LASF3089
+	.byte	0x10
+	.long	.LASF3090
+	.byte	0x5
+	.long	.LASF3091
+	.byte	0x8
+	.long	.LASF3092
+	.byte	0x9
+	.long	.LASF3093
+	.byte	0xb
+	.long	.LASF3094
+	.byte	0x6
+	.long	.LASF3095
+	.byte	0x6
+	.long	.LASF3096
+	.byte	0x6
+	.long	.LASF3097
+	.byte	0x6
+	.long	.LASF3098
+	.byte	0x6
+	.long	.LASF3099
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2250:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF1150:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2533:
+	.string	"__DECL_SIMD_asinhf "
+.LASF2670:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1454:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF1689:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF1790:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF2297:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2323:
+	.string	"__DECL_SIMD_logf "
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1771:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF938:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1540:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF1120:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF2334:
+	.string	"__DECL_SIMD_expl "
+.LASF1999:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF1266:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF858:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1699:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF2868:
+	.string	"PID_VEL_Z"
+.LASF2223:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF2883:
+	.string	"THROTTLE"
+.LASF1606:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF1474:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF1103:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1651:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF1121:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF1339:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1687:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF2663:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1019:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF1730:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF1134:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF1237:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2043:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF2296:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2029:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1099:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1420:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1138:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF2876:
+	.string	"ADC_BATTERY"
+.LASF1093:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF2136:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF2130:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1015:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1721:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF2661:
+	.string	"FP_NORMAL 4"
+.LASF1213:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF2154:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF2333:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1350:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF2772:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF2177:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF1299:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF1694:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF960:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2436:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF2552:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2828:
+	.string	"OME_INT16"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2760:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2864:
+	.string	"PID_VEL_XY"
+.LASF1798:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF1065:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF2804:
+	.string	"vTable"
+.LASF2255:
+	.string	"FAST_MATH "
+.LASF2802:
+	.string	"displayPortVTable_s"
+.LASF2782:
+	.string	"displayPortVTable_t"
+.LASF2771:
+	.string	"_Bool"
+.LASF2187:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF1749:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1428:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2561:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1328:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF2972:
+	.string	"cmsx_menuPidGpsnav"
+.LASF1597:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2467:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2601:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1155:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF1688:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF2342:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1923:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF2779:
+	.string	"displayCanvas_s"
+.LASF2777:
+	.string	"displayCanvas_t"
+.LASF2220:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF1419:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1380:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF2005:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF1088:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2211:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF2867:
+	.string	"PID_HEADING"
+.LASF2171:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF2056:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF1978:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF1447:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF1006:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF1180:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1723:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF2155:
+	.string	"SETTING_SIM_PIN 348"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF1192:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2397:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2625:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1551:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF993:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1844:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1821:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF2705:
+	.string	"HDOP_SCALE (100)"
+.LASF1059:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1377:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF2117:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF2426:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1029:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF2269:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1087:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1401:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF1563:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF2653:
+	.string	"__MATHCALL_NARROW"
+.LASF2383:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1620:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF1361:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF1485:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF2252:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF1358:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF1467:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF787:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF2278:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1000:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF2283:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF2357:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2579:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1010:
+	.string	"READONLY (1 << 4)"
+.LASF2484:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2855:
+	.string	"step"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2183:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF1142:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF1638:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF1484:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF2531:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1672:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2537:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1665:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2768:
+	.string	"uint16_t"
+.LASF2946:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1842:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1572:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF373:
+	.string	"linux 1"
+.LASF2265:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF2853:
+	.string	"entries"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2217:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF1841:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF2602:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1667:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF1331:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2134:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1531:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF1869:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF1421:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF1505:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF2225:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF972:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1445:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF1188:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1682:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1131:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF1866:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1656:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF1839:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2081:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF1357:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF2339:
+	.string	"__DECL_SIMD_expf32x "
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1471:
+	.string	"SETTING_TPA_RATE 120"
+.LASF1156:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2306:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2127:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF1186:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF1746:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1605:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF1389:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF2196:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2428:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2157:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF1274:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1072:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF2719:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF2284:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2543:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1321:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF1548:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF1815:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF2285:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF2980:
+	.string	"cmsx_menuGyro"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF941:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2380:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2414:
+	.string	"__DECL_SIMD_coshl "
+.LASF1406:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF1306:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF1244:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF2832:
+	.string	"OME_TAB"
+.LASF1387:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF1693:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF2325:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1707:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF1724:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1215:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF2563:
+	.string	"__HAVE_FLOAT128 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1834:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1577:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF2241:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF2791:
+	.string	"isTransferInProgress"
+.LASF2270:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2312:
+	.string	"__DECL_SIMD_sincos "
+.LASF2381:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1523:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF1958:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1779:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF2935:
+	.string	"RESOURCE_NONE"
+.LASF2861:
+	.string	"PID_YAW"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1860:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF2520:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2450:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1662:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1511:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2092:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1149:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2416:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2205:
+	.string	"SETTING_STATS_MAX 0"
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1145:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF2341:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1795:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF1718:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1879:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF937:
+	.string	"BIT(x) (1 << (x))"
+.LASF2915:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2865:
+	.string	"PID_SURFACE"
+.LASF1231:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1816:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF2014:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF1783:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF2542:
+	.string	"__DECL_SIMD_erfc "
+.LASF1820:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF1293:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF2681:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2616:
+	.string	"_Mdouble_"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1365:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF2564:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1738:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2944:
+	.string	"RESOURCE_I2C_SCL"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF1126:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF2662:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2516:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2098:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2721:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF2926:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1032:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF2936:
+	.string	"RESOURCE_INPUT"
+.LASF1514:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF1091:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2536:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2163:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF1619:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF1119:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2699:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1759:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1075:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1334:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF1028:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF513:
+	.string	"__always_inline"
+.LASF2945:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2741:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF2517:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2101:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF1027:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF2524:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1804:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF2245:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF2169:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1997:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF2430:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1926:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF1497:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1168:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF1849:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1225:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2304:
+	.string	"__DECL_SIMD_sinl "
+.LASF1440:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1372:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF2617:
+	.string	"__MATH_PRECNAME"
+.LASF1591:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2021:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF2664:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF2778:
+	.string	"osdCharacter_s"
+.LASF2770:
+	.string	"osdCharacter_t"
+.LASF2515:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1201:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF2399:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1294:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF1618:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF1101:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF1621:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2710:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF1480:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1782:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1983:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF2080:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF2813:
+	.string	"grabCount"
+.LASF2604:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1550:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1733:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF2969:
+	.string	"cmsx_menuPidAltMagEntries"
+.LASF1384:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1913:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF2697:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF2113:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF2504:
+	.string	"__DECL_SIMD_acoshl "
+.LASF931:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2015:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1871:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF2352:
+	.string	"__DECL_SIMD_acos "
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2343:
+	.string	"__DECL_SIMD_powf "
+.LASF2060:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF2003:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF1957:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF2161:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1519:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF2535:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1757:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF1703:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF2599:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2914:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1744:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF2968:
+	.string	"cmsx_menuPid"
+.LASF1533:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF396:
+	.string	"false 0"
+.LASF2934:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1297:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF1493:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF974:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1385:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF2392:
+	.string	"__DECL_SIMD_exp2 "
+.LASF2271:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1915:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF2742:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF962:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2456:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2691:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2451:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2600:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF976:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2776:
+	.string	"textAttributes_t"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2120:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF1396:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF1057:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1473:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1161:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF2410:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF2960:
+	.string	"cmsx_pidVelZ"
+.LASF1770:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1650:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF1940:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1811:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF1814:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF2647:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF1889:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1402:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2203:
+	.string	"SETTING_STATS 364"
+.LASF1422:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1972:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF1311:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF1403:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF1768:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF1199:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2061:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF2194:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF2835:
+	.string	"OME_MENU"
+.LASF2153:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1751:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF963:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2288:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1966:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF2974:
+	.string	"cmsx_menuManualRateProfile"
+.LASF2902:
+	.string	"OWNER_SERVO"
+.LASF2747:
+	.string	"PIDFF_MIN 0"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1600:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF1435:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1883:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF1610:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF2280:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF998:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF2723:
+	.string	"SPIDEV_COUNT 4"
+.LASF1459:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF1906:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF2016:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF2649:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1117:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF2391:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2417:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2139:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF2289:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1935:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF1094:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1132:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF1552:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1233:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF2207:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF2933:
+	.string	"OWNER_IRLOCK"
+.LASF1581:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF1554:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF1696:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF1674:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF2811:
+	.string	"cleared"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1245:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF2844:
+	.string	"type"
+.LASF2810:
+	.string	"useFullscreen"
+.LASF1914:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF2087:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF1176:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF2143:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1411:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF1477:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF2746:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF1250:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF1148:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF1945:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF1964:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF966:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF2566:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2107:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2172:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF3000:
+	.string	"cmsx_ReadPidToArray"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1136:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF1074:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF2762:
+	.string	"__uint16_t"
+.LASF2589:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1965:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF1843:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF2513:
+	.string	"__DECL_SIMD_erff "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2901:
+	.string	"OWNER_MOTOR"
+.LASF2418:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1555:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1039:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF1573:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2091:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF2789:
+	.string	"writeChar"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1921:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF2956:
+	.string	"cmsx_pidRoll"
+.LASF2026:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF2178:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF2463:
+	.string	"__DECL_SIMD_log10f "
+.LASF2825:
+	.string	"OME_INT8"
+.LASF1242:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF2361:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1715:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF2388:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2560:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1085:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1249:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF2365:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1788:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1261:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF1301:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1947:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2276:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1115:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2102:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF2419:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1289:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF2660:
+	.string	"FP_SUBNORMAL 3"
+.LASF2709:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1320:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF2834:
+	.string	"OME_BACK_AND_END"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1876:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2233:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1762:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2348:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2389:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1937:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF2458:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1348:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2715:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF2097:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2898:
+	.string	"OWNER_PWMIO"
+.LASF1051:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2406:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2637:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2921:
+	.string	"OWNER_LED"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF2682:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1017:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2619:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF925:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2006:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF2048:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF2055:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF2924:
+	.string	"OWNER_RX_SPI"
+.LASF2975:
+	.string	"cmsx_menuRateProfileEntries"
+.LASF2240:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1541:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF1974:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF2754:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2638:
+	.string	"__MATHDECL_1"
+.LASF1904:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF1081:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2961:
+	.string	"cmsx_pidHead"
+.LASF2105:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2053:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF2398:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2729:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1089:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2116:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2268:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1996:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF2473:
+	.string	"__DECL_SIMD_log2f "
+.LASF2987:
+	.string	"cmsx_menuPidGpsnav_onExit"
+.LASF2650:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF741:
+	.string	"USE_NAV "
+.LASF2903:
+	.string	"OWNER_SOFTSERIAL"
+.LASF2086:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF358:
+	.string	"__k8 1"
+.LASF1319:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF1086:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1521:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF1758:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF2068:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1510:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF2875:
+	.string	"float"
+.LASF1582:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1191:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2983:
+	.string	"pidBank"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1645:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF2792:
+	.string	"heartbeat"
+.LASF2017:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2164:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF2618:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2640:
+	.string	"__MATHDECL"
+.LASF2706:
+	.string	"NAV_BLACKBOX "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1227:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF2189:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF1599:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF1020:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF2514:
+	.string	"__DECL_SIMD_erfl "
+.LASF1601:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1737:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF2492:
+	.string	"__DECL_SIMD_atanh "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1981:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1309:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1496:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF1670:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1867:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1175:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF2781:
+	.string	"displayFontMetadata_s"
+.LASF2780:
+	.string	"displayFontMetadata_t"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF2099:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF2396:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1263:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF1052:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1678:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1859:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF1612:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF2047:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF374:
+	.string	"__unix 1"
+.LASF1151:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF1129:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF739:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1038:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF2065:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF2925:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF2452:
+	.string	"__DECL_SIMD_atan2 "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2166:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF2970:
+	.string	"cmsx_menuPidAltMag"
+.LASF1255:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1988:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF2884:
+	.string	"AUX1"
+.LASF2885:
+	.string	"AUX2"
+.LASF2886:
+	.string	"AUX3"
+.LASF2887:
+	.string	"AUX4"
+.LASF2888:
+	.string	"AUX5"
+.LASF2889:
+	.string	"AUX6"
+.LASF2890:
+	.string	"AUX7"
+.LASF2891:
+	.string	"AUX8"
+.LASF2892:
+	.string	"AUX9"
+.LASF1731:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF2929:
+	.string	"OWNER_1WIRE"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF2624:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2188:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF2067:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF1669:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF1856:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1344:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2375:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1955:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2082:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF1352:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF1212:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2908:
+	.string	"OWNER_RANGEFINDER"
+.LASF2218:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF2360:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2387:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1251:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2085:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF2732:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1683:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF2422:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1205:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2221:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF1210:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF1640:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2795:
+	.string	"supportedTextAttributes"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2847:
+	.string	"CMS_DATA_TYPE_ANGULAR_RATE"
+.LASF1308:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1429:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF1222:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF2204:
+	.string	"SETTING_STATS_MIN 0"
+.LASF1832:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF2545:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1714:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF2656:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2824:
+	.string	"OME_BoolFunc"
+.LASF2634:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2538:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF1780:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF2829:
+	.string	"OME_String"
+.LASF2132:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF2192:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF2846:
+	.string	"OSD_Entry"
+.LASF1465:
+	.string	"SETTING_THR_MID 118"
+.LASF1414:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF1022:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF2054:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF1831:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF2611:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1463:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2210:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2441:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF2259:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2379:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2654:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1632:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF1566:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1615:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF1946:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1736:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2262:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2301:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2949:
+	.string	"RESOURCE_SPI_CS"
+.LASF1034:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1143:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF1628:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF2489:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1061:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2290:
+	.string	"_MATH_H 1"
+.LASF1487:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF2037:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2112:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1603:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF1819:
+	.string	"SETTING_PID_TYPE 236"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1234:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF1460:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF2990:
+	.string	"from"
+.LASF1698:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF2275:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF2487:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1316:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF2141:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF2577:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2201:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1685:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF1576:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2605:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2831:
+	.string	"OME_Setting"
+.LASF2668:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2193:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1238:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1066:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF1636:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF1262:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF2427:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1941:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF2985:
+	.string	"schedulePidGainsUpdate"
+.LASF959:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1466:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF1116:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1784:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF2038:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF1990:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF2103:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF2149:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF1195:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF2666:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2948:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1993:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2918:
+	.string	"OWNER_MPU"
+.LASF1317:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF2993:
+	.string	"cmsx_PidWriteback"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF948:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2550:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF699:
+	.string	"__need_NULL "
+.LASF2239:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF1536:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF2615:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2628:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2046:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1100:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF2340:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2104:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF2878:
+	.string	"ADC_CURRENT"
+.LASF2928:
+	.string	"OWNER_TEMPERATURE"
+.LASF1705:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF2963:
+	.string	"cmsx_pidVelXY"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1773:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2849:
+	.string	"CMSMenuOnExitPtr"
+.LASF2096:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF1016:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF2437:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1427:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF2817:
+	.string	"OME_Label"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1833:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF2992:
+	.string	"cmsx_menuPidAltMag_onEnter"
+.LASF1542:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF2971:
+	.string	"cmsx_menuPidGpsnavEntries"
+.LASF2586:
+	.string	"__f64x(x) x ##f64x"
+.LASF2919:
+	.string	"OWNER_INVERTER"
+.LASF1410:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF1741:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1118:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF1370:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF2957:
+	.string	"cmsx_pidPitch"
+.LASF2569:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1777:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF1451:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1040:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2767:
+	.string	"uint8_t"
+.LASF1153:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF2190:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF1048:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1230:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1079:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF1903:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1362:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2629:
+	.string	"_Mdouble_ _Float64"
+.LASF1846:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF2752:
+	.string	"RPY_PIDFF_ENTRY(label,ptr) PIDFF_ENTRY(label, ptr, RPY_PIDFF_MAX)"
+.LASF1123:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF2370:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF933:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2959:
+	.string	"cmsx_pidPosZ"
+.LASF1054:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2803:
+	.string	"displayPort_s"
+.LASF2816:
+	.string	"displayPort_t"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1219:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF2725:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1639:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF2717:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2313:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1083:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1502:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF2826:
+	.string	"OME_UINT8"
+.LASF2882:
+	.string	"PITCH"
+.LASF983:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1182:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF891:
+	.string	"USE_ADC"
+.LASF2840:
+	.string	"menufunc"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2181:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1382:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF2860:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2050:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF2541:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2938:
+	.string	"RESOURCE_IO"
+.LASF1139:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF1960:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF1740:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2036:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF1187:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF3005:
+	.string	"cmsx_PidRead"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2115:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1035:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF1649:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF376:
+	.string	"unix 1"
+.LASF2658:
+	.string	"FP_INFINITE 1"
+.LASF2648:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF2412:
+	.string	"__DECL_SIMD_cosh "
+.LASF2293:
+	.string	"__DECL_SIMD_cosf "
+.LASF2314:
+	.string	"__DECL_SIMD_sincosl "
+.LASF2302:
+	.string	"__DECL_SIMD_sin "
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1534:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF1611:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2786:
+	.string	"drawScreen"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF2315:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1248:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2728:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1567:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF2588:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1023:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF2030:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF2997:
+	.string	"cmsx_menuImu_onEnter"
+.LASF892:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1475:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF1174:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF2581:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2806:
+	.string	"rows"
+.LASF1097:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1327:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF2900:
+	.string	"OWNER_PPMINPUT"
+.LASF1243:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF1769:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF1891:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF2345:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1446:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF1838:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF2376:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2593:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1144:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1395:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF1549:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF2632:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2041:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF1528:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF1472:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF2499:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1948:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1936:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF947:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1583:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF1353:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1408:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF1855:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1033:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF2528:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2140:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2539:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1050:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF2511:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2842:
+	.string	"text"
+.LASF1991:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF2110:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF2827:
+	.string	"OME_UINT16"
+.LASF1125:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF2735:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2621:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2507:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1938:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF2000:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF1084:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1223:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1919:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF971:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2013:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF2448:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2869:
+	.string	"PID_POS_HEADING"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1439:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF967:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2328:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1207:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF1221:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF1409:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2866:
+	.string	"PID_LEVEL"
+.LASF1864:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2788:
+	.string	"writeString"
+.LASF1963:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF946:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF2696:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1464:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2572:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2237:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF1503:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF2659:
+	.string	"FP_ZERO 2"
+.LASF2836:
+	.string	"OME_MAX"
+.LASF1247:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF1661:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF2332:
+	.string	"__DECL_SIMD_exp "
+.LASF1273:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF3001:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1267:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF1677:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF1025:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF2505:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF2623:
+	.string	"_Mdouble_ long double"
+.LASF2224:
+	.string	"SETTING_VTX_BAND 371"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2052:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF2229:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1808:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF2100:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF1287:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1624:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2546:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1660:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF2282:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1376:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF2247:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF2486:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF2457:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2603:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2927:
+	.string	"OWNER_COMPASS"
+.LASF1648:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF1430:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1194:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF2142:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF2556:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1302:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2227:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1164:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1847:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1712:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF1239:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF2657:
+	.string	"FP_NAN 0"
+.LASF2446:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1774:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF1011:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF1930:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF2114:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF1259:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF1252:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF2630:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2182:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF1580:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF1337:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1026:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF2337:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1529:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF1303:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF994:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1922:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF1641:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF2941:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2353:
+	.string	"__DECL_SIMD_acosf "
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2996:
+	.string	"displayPort"
+.LASF2373:
+	.string	"__DECL_SIMD_asinf "
+.LASF2606:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF980:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1902:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1732:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF719:
+	.string	"NULL"
+.LASF1488:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF2736:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2454:
+	.string	"__DECL_SIMD_atan2l "
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1840:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF2614:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1404:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF1622:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF1806:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF2909:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1861:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF1949:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF1450:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1398:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF2679:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF466:
+	.string	"__PMT"
+.LASF1803:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF928:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1166:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2994:
+	.string	"cmsx_PidOnEnter"
+.LASF2954:
+	.string	"RESOURCE_RX_CE"
+.LASF2911:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2236:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2372:
+	.string	"__DECL_SIMD_asin "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF921:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2610:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2799:
+	.string	"beginTransaction"
+.LASF2744:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2665:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1347:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF1169:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF2011:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF986:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1507:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF2674:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1500:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF2549:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2167:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF1971:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1954:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF1593:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1570:
+	.string	"SETTING_DEADBAND 153"
+.LASF2707:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1595:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF1275:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF2635:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1870:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF2206:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1170:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF1835:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF2168:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1588:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF1824:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF1943:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1643:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF2748:
+	.string	"PIDFF_STEP 1"
+.LASF2527:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1495:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF1335:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF977:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1469:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1543:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF1807:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF2078:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1336:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF2940:
+	.string	"RESOURCE_UART_TX"
+.LASF2213:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF927:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF1711:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF2232:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1637:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF1442:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2319:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1825:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF2982:
+	.string	"getConfigProfile"
+.LASF1967:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2374:
+	.string	"__DECL_SIMD_asinl "
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF2716:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1338:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF1579:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2106:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1884:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF982:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1931:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF2585:
+	.string	"__f32x(x) x ##f32x"
+.LASF2823:
+	.string	"OME_Bool"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1851:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF2608:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2199:
+	.string	"SETTING_NAME_MAX 16"
+.LASF1452:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF2174:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1001:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2491:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF968:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1897:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF961:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1092:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1517:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF2631:
+	.string	"_Mdouble_ _Float128"
+.LASF1975:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF1009:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1332:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF1342:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF1196:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF1436:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1558:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF1152:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF1453:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1896:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF1642:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF2024:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF2512:
+	.string	"__DECL_SIMD_erf "
+.LASF2812:
+	.string	"cursorRow"
+.LASF1217:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2553:
+	.string	"__DECL_SIMD_tanf "
+.LASF1045:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1560:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF2766:
+	.string	"int8_t"
+.LASF2179:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF2004:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF1912:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF1288:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF2118:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1371:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF2967:
+	.string	"cmsx_menuPidEntries"
+.LASF1379:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1432:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF1516:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF2402:
+	.string	"__DECL_SIMD_exp10 "
+.LASF995:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1322:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF2064:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF1110:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1927:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2917:
+	.string	"OWNER_BARO"
+.LASF2084:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF1796:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF2800:
+	.string	"commitTransaction"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2981:
+	.string	"cmsx_menuImuEntries"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2652:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1418:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF2238:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF2633:
+	.string	"_Mdouble_ _Float32x"
+.LASF2145:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2877:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2433:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1827:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF1346:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2198:
+	.string	"SETTING_NAME_MIN 0"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1874:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF2346:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2733:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2477:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1368:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF2362:
+	.string	"__DECL_SIMD_atan "
+.LASF2694:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1829:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF2745:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2639:
+	.string	"__MATHDECL_ALIAS"
+.LASF1985:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1448:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2158:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF1058:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF1183:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF2257:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1652:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF2385:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1341:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF922:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2739:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF1240:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2249:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF990:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2912:
+	.string	"OWNER_SDCARD"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF2685:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1413:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF1002:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1578:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1634:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF1710:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF1987:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1666:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF785:
+	.string	"USE_LOG "
+.LASF2298:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1391:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF1179:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF2363:
+	.string	"__DECL_SIMD_atanf "
+.LASF1456:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF1366:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF1373:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF1750:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF2807:
+	.string	"cols"
+.LASF2508:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2675:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1043:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2755:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1701:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF2758:
+	.string	"signed char"
+.LASF2582:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1007:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1184:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1722:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1431:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF2676:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1355:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF1692:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF2063:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF2893:
+	.string	"AUX10"
+.LASF2894:
+	.string	"AUX11"
+.LASF2895:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF2253:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF2655:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1848:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF2431:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1786:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF2258:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2324:
+	.string	"__DECL_SIMD_logl "
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2773:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1356:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF2724:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1253:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF1984:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1716:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF2254:
+	.string	"sq(x) ((x)*(x))"
+.LASF2131:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF2478:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2852:
+	.string	"onGlobalExit"
+.LASF3002:
+	.string	"cmsx_menuImu"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1743:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1704:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1565:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF1107:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF1584:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF2584:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1602:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1461:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF2075:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF2711:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1499:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF2686:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1177:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF2124:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2775:
+	.string	"displayTransactionOption_e"
+.LASF1351:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF1863:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF2521:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1556:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF1189:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF1952:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF2474:
+	.string	"__DECL_SIMD_log2l "
+.LASF2498:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2244:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF1512:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1680:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF1399:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF2966:
+	.string	"profileIndexString"
+.LASF1167:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF1509:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF1559:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF1812:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF2007:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2678:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2525:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF2568:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF2384:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1190:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2214:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1953:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF2439:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1776:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF2783:
+	.string	"grab"
+.LASF1202:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1491:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF1706:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF2123:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2798:
+	.string	"isReady"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1265:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF2905:
+	.string	"OWNER_SERIAL"
+.LASF1515:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1300:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF1271:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF1198:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF1185:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF1228:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF2526:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2916:
+	.string	"OWNER_OSD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1538:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF1961:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF2932:
+	.string	"OWNER_PINIO"
+.LASF2074:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF2367:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1277:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF1828:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF2991:
+	.string	"cmsx_menuPidAltMag_onExit"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1818:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF2018:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1071:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2677:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2557:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF999:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2059:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF1062:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2594:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF2150:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1109:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF2488:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1159:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF2010:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1962:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1756:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF2421:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1090:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1494:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF1113:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF1585:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF2322:
+	.string	"__DECL_SIMD_log "
+.LASF2965:
+	.string	"profileIndex"
+.LASF2977:
+	.string	"cmsx_menuFilterPerProfileEntries"
+.LASF2839:
+	.string	"func"
+.LASF2125:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF964:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1282:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF1894:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF2480:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1845:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF2445:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1012:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF1719:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1609:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF1437:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF1498:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF1146:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2335:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2425:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2522:
+	.string	"__DECL_SIMD_tanh "
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2386:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2151:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF1625:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF1283:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1224:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF2291:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1270:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF1613:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF965:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2939:
+	.string	"RESOURCE_TIMER"
+.LASF1942:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1021:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF1197:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF1041:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1728:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1284:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF2366:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2999:
+	.string	"cmsx_WritebackPidFromArray"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2672:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2726:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF2850:
+	.string	"onEnter"
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1340:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF1004:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2764:
+	.string	"long int"
+.LASF1950:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF2547:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2326:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1208:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF1564:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF2740:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1905:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1604:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2119:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF2349:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2044:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF1787:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF2311:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1014:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1295:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1968:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF2906:
+	.string	"OWNER_PINDEBUG"
+.LASF2071:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF1232:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF2243:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1887:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF2260:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2612:
+	.string	"_Mdouble_ double"
+.LASF2695:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1444:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF1697:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF1060:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF2698:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2215:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF1172:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF2395:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF935:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2822:
+	.string	"OME_Funcall"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1525:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF1899:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF2727:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF2862:
+	.string	"PID_POS_Z"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF2077:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2815:
+	.string	"maxChar"
+.LASF1388:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF2607:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1449:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF2693:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2442:
+	.string	"__DECL_SIMD_cbrt "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1880:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF2587:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1830:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF1970:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF2955:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF2228:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1530:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF923:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1281:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF1822:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF2472:
+	.string	"__DECL_SIMD_log2 "
+.LASF1314:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF932:
+	.string	"EXPAND_I(x) x"
+.LASF2424:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2651:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2032:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF1443:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1695:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1569:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF1729:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF2613:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1108:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2769:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF2066:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2567:
+	.string	"__f128(x) x ##f128"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF1102:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1457:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF2690:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2133:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF1657:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF1374:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1522:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF2718:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF2440:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1857:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1933:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF1739:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2287:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF914:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2805:
+	.string	"device"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2051:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF2937:
+	.string	"RESOURCE_OUTPUT"
+.LASF1241:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1598:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF1587:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF2354:
+	.string	"__DECL_SIMD_acosl "
+.LASF2460:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2234:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF1127:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF2854:
+	.string	"CMS_Menu"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1644:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF1553:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF1944:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF2642:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1633:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF1544:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF1616:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF2248:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF989:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1681:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1608:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF1226:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF2730:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF1254:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2590:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2195:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF2128:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF2757:
+	.string	"long unsigned int"
+.LASF1590:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1671:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2738:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1654:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1607:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF1646:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1160:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1920:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF2358:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2485:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF997:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1875:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF1128:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF2643:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1383:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF1532:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF1381:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF2907:
+	.string	"OWNER_TIMER"
+.LASF1872:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF988:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2364:
+	.string	"__DECL_SIMD_atanl "
+.LASF2575:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1659:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1111:
+	.string	"SETTING_LOOPTIME 0"
+.LASF2027:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF1046:
+	.string	"CMS_EXIT (0)"
+.LASF1310:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1124:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF1269:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2700:
+	.string	"LAT 0"
+.LASF1206:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF2503:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1008:
+	.string	"DYNAMIC (1 << 2)"
+.LASF2765:
+	.string	"char"
+.LASF2645:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2750:
+	.string	"OTHER_PIDDF_MAX 255"
+.LASF2202:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF1417:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF1527:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF2995:
+	.string	"cmsx_profileIndexOnChange"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1203:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF1518:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1679:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1850:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF2578:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1077:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1426:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF2576:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2790:
+	.string	"readChar"
+.LASF1977:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2267:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2465:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1424:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1539:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF1304:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF2382:
+	.string	"__DECL_SIMD_hypot "
+.LASF1778:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF2598:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1056:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2256:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2338:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF2035:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF2469:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF2818:
+	.string	"OME_LabelFunc"
+.LASF1700:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF958:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF3004:
+	.string	"setConfigProfile"
+.LASF1333:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2045:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF2336:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1478:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF1526:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF924:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1470:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF1508:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF395:
+	.string	"true 1"
+.LASF2299:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1272:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF2033:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF1280:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1755:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF2308:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2057:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF1313:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1627:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF2089:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF2083:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF2273:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2294:
+	.string	"__DECL_SIMD_cosl "
+.LASF2090:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2197:
+	.string	"SETTING_NAME 362"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1315:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF2881:
+	.string	"ROLL"
+.LASF2495:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1181:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF1629:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF2931:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1053:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1112:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF2620:
+	.string	"_Mdouble_ float"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2434:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1369:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF2859:
+	.string	"PID_ROLL"
+.LASF2548:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF2377:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1586:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2570:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2848:
+	.string	"CMSMenuFuncPtr"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2501:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1589:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF2209:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF2580:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1973:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1720:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2509:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF930:
+	.string	"STR_HELPER(x) #x"
+.LASF2415:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1631:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF2989:
+	.string	"self"
+.LASF1318:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1594:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF1209:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2596:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1013:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2001:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1214:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2534:
+	.string	"__DECL_SIMD_asinhl "
+.LASF996:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1360:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF1296:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF2403:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1800:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1063:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1367:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF2667:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2943:
+	.string	"RESOURCE_EXTI"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2737:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1476:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF2400:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2330:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1235:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2208:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF1617:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF2530:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1204:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF2355:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1392:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF2641:
+	.string	"__MATHCALL"
+.LASF1791:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF371:
+	.string	"__linux 1"
+.LASF1852:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF1630:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF1753:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF1162:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF2787:
+	.string	"screenSize"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2180:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF2687:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2378:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1326:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1378:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF2429:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF1105:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1441:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF1901:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF1390:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF2673:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1754:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF1393:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF2571:
+	.string	"__HAVE_FLOAT32 1"
+.LASF2135:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF2712:
+	.string	"DMA_NONE (0)"
+.LASF2175:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF1675:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF1246:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2321:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1147:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF1433:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF1312:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF2863:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1797:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF1998:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF1130:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2072:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF1122:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF1982:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF1064:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2646:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2156:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1684:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF1415:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF1003:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2720:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1323:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF1211:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF2714:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF2012:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2008:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF2490:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1324:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1165:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1765:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF2231:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF2235:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF2070:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF969:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF2329:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1858:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF943:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2976:
+	.string	"cmsx_menuRateProfile"
+.LASF1545:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1135:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF1907:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF2671:
+	.string	"M_E 2.7182818284590452354"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1468:
+	.string	"SETTING_THR_EXPO 119"
+.LASF2023:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2784:
+	.string	"release"
+.LASF1137:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF2684:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1307:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF984:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF1992:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF1713:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2896:
+	.string	"double"
+.LASF2371:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF2200:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2122:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF1104:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF1520:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF939:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2591:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2076:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF2669:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1504:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF1881:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF2146:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF2475:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1873:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF2692:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF942:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2801:
+	.string	"getCanvas"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2574:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1290:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF1986:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF1069:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF2088:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2749:
+	.string	"RPY_PIDFF_MAX 200"
+.LASF2979:
+	.string	"cmsx_menuGyroEntries"
+.LASF1793:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF2573:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2529:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2025:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1193:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF3003:
+	.string	"rc_alias"
+.LASF1098:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2713:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF2251:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF2922:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1279:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2137:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF1067:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1708:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF2165:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF1423:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1400:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1133:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF1286:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF2295:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2310:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2763:
+	.string	"__uint32_t"
+.LASF2820:
+	.string	"OME_OSD_Exit"
+.LASF1882:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF2126:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2540:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1154:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF2843:
+	.string	"data"
+.LASF1492:
+	.string	"SETTING_YAW_RATE 127"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1653:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF1178:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF1044:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF2470:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1826:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF2554:
+	.string	"__DECL_SIMD_tanl "
+.LASF2401:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1425:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF2028:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1258:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF2913:
+	.string	"OWNER_FLASH"
+.LASF1916:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF1734:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2185:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1635:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF1343:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2627:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1810:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1291:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF1158:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF2532:
+	.string	"__DECL_SIMD_asinh "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2797:
+	.string	"writeFontCharacter"
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF992:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1893:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF1817:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF934:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1325:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1042:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1285:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2212:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1047:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF987:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1655:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1268:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF1809:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF1853:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF1823:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF1106:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF1080:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2058:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF2466:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1890:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2923:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2022:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF2162:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF2191:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF2558:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF786:
+	.string	"USE_STATS "
+.LASF857:
+	.string	"USE_MAG "
+.LASF2930:
+	.string	"OWNER_AIRSPEED"
+.LASF1742:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF2040:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF2079:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2688:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1673:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1394:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF2519:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1969:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2121:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF2305:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1647:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF1805:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF2964:
+	.string	"tmpProfileIndex"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF2144:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1748:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF2481:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1005:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF2461:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1709:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF2583:
+	.string	"__f32(x) x ##f32"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF2689:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2796:
+	.string	"getFontMetadata"
+.LASF1049:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF1482:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF2042:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF1037:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF2559:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2242:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1878:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF2734:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1911:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1623:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF2494:
+	.string	"__DECL_SIMD_atanhl "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2317:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1934:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF2368:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2978:
+	.string	"cmsx_menuFilterPerProfile"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2523:
+	.string	"__DECL_SIMD_tanhf "
+.LASF945:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1910:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2186:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2226:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1018:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1908:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF2184:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2435:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1513:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1557:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF1264:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2347:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1236:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF2246:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF2838:
+	.string	"CMSMenuOptFuncPtr"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1626:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF1994:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF2108:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF1898:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF1354:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF2704:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2879:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1257:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF2471:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1030:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF2444:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1928:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF2998:
+	.string	"pidIndex"
+.LASF1668:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF2031:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2701:
+	.string	"LON 1"
+.LASF1918:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1691:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF2176:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF2393:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF2309:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2880:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF944:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF2062:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF2173:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF2833:
+	.string	"OME_END"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF975:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF2562:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1078:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1506:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF1483:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF705:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF2510:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1592:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF1909:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF2626:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF956:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF2483:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1073:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1416:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF2950:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2951:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2952:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2953:
+	.string	"RESOURCE_ADC_CH4"
+.LASF2420:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1114:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF2219:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF2897:
+	.string	"OWNER_FREE"
+.LASF1717:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF2230:
+	.string	"SETTING_VTX_POWER 373"
+.LASF1345:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF1865:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF1571:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF2476:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF2390:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2753:
+	.string	"OTHER_PIDFF_ENTRY(label,ptr) PIDFF_ENTRY(label, ptr, OTHER_PIDDF_MAX)"
+.LASF1760:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF2222:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2279:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2307:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF940:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2722:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2555:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1455:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF2138:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF1766:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF1895:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF1574:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF2899:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1434:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF1216:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF1735:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF2500:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1407:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF2407:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2821:
+	.string	"OME_Submenu"
+.LASF1535:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF1068:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF2350:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2300:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF929:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1925:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF2493:
+	.string	"__DECL_SIMD_atanhf "
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF2438:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1924:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1801:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF2111:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF1462:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF2404:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2009:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF1412:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF1140:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF991:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1157:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1163:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF394:
+	.string	"bool _Bool"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF1397:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF1727:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF1767:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2462:
+	.string	"__DECL_SIMD_log10 "
+.LASF1298:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF2408:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2958:
+	.string	"cmsx_pidYaw"
+.LASF1725:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2518:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1664:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF2468:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1663:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF1096:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF2303:
+	.string	"__DECL_SIMD_sinf "
+.LASF949:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF2459:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2292:
+	.string	"__DECL_SIMD_cos "
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF2093:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF2020:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF1546:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF1349:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF1561:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1292:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF1256:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2443:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF2344:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2751:
+	.string	"PIDFF_ENTRY(label,ptr,max) OSD_UINT8_ENTRY(label, (&(const OSD_UINT8_t){ ptr, PIDFF_MIN, max, PIDFF_STEP }))"
+.LASF1486:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1658:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1752:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF1932:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2986:
+	.string	"navigationUsePIDs"
+.LASF1036:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF1764:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1886:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF2592:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF2731:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1917:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2830:
+	.string	"OME_FLOAT"
+.LASF2318:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2272:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2160:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF2129:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF1686:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF2264:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2841:
+	.string	"itemId"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1575:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF2636:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2793:
+	.string	"resync"
+.LASF2152:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF2281:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2808:
+	.string	"posX"
+.LASF2809:
+	.string	"posY"
+.LASF2351:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2073:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF2785:
+	.string	"clearScreen"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2423:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2947:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2910:
+	.string	"OWNER_SPI"
+.LASF1775:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1877:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF2479:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2261:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2837:
+	.string	"CMSEntryFuncPtr"
+.LASF1082:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1479:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1330:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1305:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF1772:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF1854:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF1489:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1562:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF1888:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1792:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1989:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF1761:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2359:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF2794:
+	.string	"txBytesFree"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2683:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2405:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1386:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1200:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1813:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF1836:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1979:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2703:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1568:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2920:
+	.string	"OWNER_LED_STRIP"
+.LASF1799:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1375:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF1726:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF1995:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2702:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1690:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF2464:
+	.string	"__DECL_SIMD_log10l "
+.LASF2159:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF2870:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2819:
+	.string	"OME_Back"
+.LASF2263:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF2973:
+	.string	"cmsx_menuManualRateProfileEntries"
+.LASF1363:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF1802:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF2095:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2988:
+	.string	"cmsx_menuPidGpsnav_onEnter"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2743:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF1676:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2597:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2984:
+	.string	"pidBankMutable"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1763:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2644:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1276:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF2413:
+	.string	"__DECL_SIMD_coshf "
+.LASF2857:
+	.string	"OSD_SETTING_s"
+.LASF2858:
+	.string	"OSD_SETTING_t"
+.LASF1260:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2039:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF1702:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF1537:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF2331:
+	.string	"__DECL_SIMD_logf128x "
+.LASF2411:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF861:
+	.string	"USE_UART3 "
+.LASF2266:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2609:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF2148:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2502:
+	.string	"__DECL_SIMD_acosh "
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2759:
+	.string	"__int8_t"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF2320:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2447:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1438:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF926:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF970:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1173:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF2216:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF2286:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2497:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1076:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF2274:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2147:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2708:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1614:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1229:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF2680:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1405:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF2873:
+	.string	"pidBank_s"
+.LASF2874:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2449:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2170:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF1900:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF2506:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1939:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF2496:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2756:
+	.string	"unsigned int"
+.LASF2814:
+	.string	"cachedSupportedTextAttributes"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF2962:
+	.string	"cmsx_pidPosXY"
+.LASF1490:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF1868:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF2049:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF2551:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1329:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF2432:
+	.string	"__DECL_SIMD_sinh "
+.LASF1055:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF1959:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1481:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF2565:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1218:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF2369:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2019:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF2453:
+	.string	"__DECL_SIMD_atan2f "
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1794:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF2774:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1951:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1547:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1781:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF1596:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2394:
+	.string	"__DECL_SIMD_exp2l "
+.LASF978:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2904:
+	.string	"OWNER_ADC"
+.LASF2761:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2094:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF2851:
+	.string	"onExit"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2455:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2109:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2856:
+	.string	"OSD_UINT8_t"
+.LASF2277:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1862:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1141:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1171:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF1980:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF23:
+	.string	"_LP64 1"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1929:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF2316:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1524:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1976:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF2002:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF1747:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2942:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1031:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1220:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF2544:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2034:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF957:
+	.string	"EXTENDED_FASTRAM "
+.LASF2482:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1885:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF2409:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1095:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1359:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF1278:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1458:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF2356:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1501:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1837:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF1956:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF2871:
+	.string	"pid8_s"
+.LASF2872:
+	.string	"pid8_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1364:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF2069:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF2845:
+	.string	"flags"
+.LASF2622:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2595:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2327:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1785:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF1070:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1789:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF985:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF1024:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1892:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1745:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3090:
+	.string	"feature.h"
+.LASF3071:
+	.string	"io_types.h"
+.LASF3088:
+	.string	"mathcalls-helper-functions.h"
+.LASF3080:
+	.string	"math.h"
+.LASF3048:
+	.string	"long-double.h"
+.LASF3029:
+	.string	"display.h"
+.LASF3006:
+	.string	"obj/main/SITL"
+.LASF3089:
+	.string	"mathcalls.h"
+.LASF3011:
+	.string	"src/main/drivers"
+.LASF3069:
+	.string	"axis.h"
+.LASF3072:
+	.string	"rx_pwm.h"
+.LASF3042:
+	.string	"libc-header-start.h"
+.LASF3023:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3015:
+	.string	"src/main/navigation"
+.LASF3074:
+	.string	"controlrate_profile.h"
+.LASF3027:
+	.string	"stdint-intn.h"
+.LASF3038:
+	.string	"rc_controls.h"
+.LASF3068:
+	.string	"time.h"
+.LASF3022:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF3025:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3049:
+	.string	"stubs.h"
+.LASF3057:
+	.string	"__locale_t.h"
+.LASF3008:
+	.string	"src/main/cms"
+.LASF3017:
+	.string	"src/main/target/SITL"
+.LASF3061:
+	.string	"target.h"
+.LASF3014:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF3031:
+	.string	"pid.h"
+.LASF3021:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_imu.c"
+.LASF3035:
+	.string	"config.h"
+.LASF3096:
+	.string	"bus_i2c.h"
+.LASF3058:
+	.string	"strings.h"
+.LASF3044:
+	.string	"features-time64.h"
+.LASF3030:
+	.string	"cms_types.h"
+.LASF3026:
+	.string	"types.h"
+.LASF3081:
+	.string	"math-vector.h"
+.LASF3084:
+	.string	"floatn-common.h"
+.LASF3065:
+	.string	"cms.h"
+.LASF3046:
+	.string	"timesize.h"
+.LASF3040:
+	.string	"stdbool.h"
+.LASF3024:
+	.string	"/usr/include"
+.LASF3082:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3007:
+	.string	"src/main/build"
+.LASF3062:
+	.string	"sanity_check.h"
+.LASF3097:
+	.string	"rcc_types.h"
+.LASF3043:
+	.string	"features.h"
+.LASF3013:
+	.string	"src/main/flight"
+.LASF3051:
+	.string	"typesizes.h"
+.LASF3009:
+	.string	"src/main/common"
+.LASF3076:
+	.string	"settings_generated.h"
+.LASF3010:
+	.string	"src/main/config"
+.LASF3036:
+	.string	"navigation.h"
+.LASF3052:
+	.string	"time64.h"
+.LASF3028:
+	.string	"stdint-uintn.h"
+.LASF3018:
+	.string	"src/main/target"
+.LASF3064:
+	.string	"utils.h"
+.LASF3034:
+	.string	"cms_menu_imu.c"
+.LASF3098:
+	.string	"bus_spi.h"
+.LASF3019:
+	.string	"src/main"
+.LASF3037:
+	.string	"cms_menu_imu.h"
+.LASF3016:
+	.string	"src/main/sensors"
+.LASF3085:
+	.string	"flt-eval-method.h"
+.LASF3033:
+	.string	"resource.h"
+.LASF3047:
+	.string	"cdefs.h"
+.LASF3073:
+	.string	"stats.h"
+.LASF3087:
+	.string	"fp-fast.h"
+.LASF3094:
+	.string	"sensor.h"
+.LASF3053:
+	.string	"wchar.h"
+.LASF3083:
+	.string	"floatn.h"
+.LASF3070:
+	.string	"runtime_config.h"
+.LASF3092:
+	.string	"gps.h"
+.LASF3012:
+	.string	"src/main/fc"
+.LASF3060:
+	.string	"common.h"
+.LASF3075:
+	.string	"settings.h"
+.LASF3078:
+	.string	"maths.h"
+.LASF3086:
+	.string	"fp-logb.h"
+.LASF3054:
+	.string	"string.h"
+.LASF3091:
+	.string	"failsafe.h"
+.LASF3020:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3056:
+	.string	"locale_t.h"
+.LASF3093:
+	.string	"gyro.h"
+.LASF3041:
+	.string	"stdint.h"
+.LASF3067:
+	.string	"build_config.h"
+.LASF3055:
+	.string	"stddef.h"
+.LASF3050:
+	.string	"stubs-64.h"
+.LASF3079:
+	.string	"vector.h"
+.LASF3045:
+	.string	"wordsize.h"
+.LASF3095:
+	.string	"bus.h"
+.LASF3099:
+	.string	"dma.h"
+.LASF3063:
+	.string	"common_post.h"
+.LASF3032:
+	.string	"adc.h"
+.LASF3066:
+	.string	"parameter_group.h"
+.LASF3059:
+	.string	"platform.h"
+.LASF3039:
+	.string	"stdc-predef.h"
+.LASF3077:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\242\001\275\r"
+	.string	"4\026\226\002"
+	.string	"R"
+	.string	"\207\264\337\211\013\b\002"
+	.ascii	"\001\240\342\234\212\n\002\003\264\222\354\273\r\f\004\005\006"
+	.ascii	"\007\244\364\267\351\f\b\332\324\320\356\002\t\263\245\275\203"
+	.ascii	"\f\n\013\f\r\204\206\311\304\013\004\002\001\002\001\002\002"
+	.ascii	"\002\003\016\017\201\355\342\204\003\020\255\212\354\365\n\021"
+	.ascii	"\347\231\367\253\004\006\022\023\257\342\311\362\b\024\332\374"
+	.ascii	"\233\255"
+	.string	"\r\025\226\214\365\330\002\026\223\343\343\277\002\027\251\222\236\271\004\030\031\032\326\226\262\343\006\033\034\035\036\037\243\323\260\370\013 \312\227\327\263\b!\300\352\305\302\n\"\333\202\241\254\013#\260\246\272\203\006$\255\215\301\211\003%\361\301\254\262\001&\246\333\273\277\b'\252\326\301\234\005(\351\364\304\205\004)\255\353\255\024*\354\301\244\243\003+\254\356\273\275\016,\322\345\354\307\f-\222\267\275\305\r.\334\327\362\315\017/\376\342\363\207\0010\243\274\304\325\0011\255\350\207\241\0012\373\245\234\370\f3\364\310\255\264\0014\247\304\266\303\0165\361\265\272\335\n6\327\311\213\324\0167\266\333\315\313\0168\212\275\326\203\0069\261\262\343\327\005:;<\313\212\336\274\006=\376\217\314\334\007>?@ABCDE\374\242\321\226\rF\360\315\243\321\006G\302\210\255\272\002H\306\240\225\333\rI\271\270\360\366\005JKLMNOPQ\271\270\360\366\005"
+	.ascii	"* \360\002\261\352\001D\336i\254\210;6\366*\331\311v\022VN\266"
+	.ascii	"\203\260\353=\215\211\236 N\222v\257\260\340\266\215\225\n\230"
+	.ascii	"\037\374\225@\t\272[\363h\023\314\355\265\2730R\227\020^\312"
+	.ascii	"\242\245\\fA.=\206\264R\016\210\263ImM$\322\314\020"
+	.text
+	.section	.gnu.lto_.ipa_sra.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 y=\002"
+	.string	"\244\002m"
+	.string	"\t"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\001\003"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"\t"
+	.string	""
+	.string	""
+	.string	"\r\020"
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\001\023"
+	.string	""
+	.string	"\013"
+	.ascii	"\220\034\013F9-\260\220;\025\215\233\227\270l\"3\033\230|mZ\264"
+	.ascii	"\001,"
+	.text
+	.section	.gnu.lto_.inline.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\331"
+	.string	"U\004"
+	.string	"\362\305\023\036\240'\351?#W`p\\.\034\324\b\373?\300"
+	.string	""
+	.string	"8\363\377\371\267\326Z\313yK\222\002:\220\220H\321\026?\243\340\201\020C=\376D\300\262\306\037P9T\3647&\345\224\342\177\254fLR\235\203\020-\354_\231&\304\030\277\243\213\311\021\030"
+	.ascii	"\241\026M\232\020w\313\317\305\002\264\214\202\225\034\261\006"
+	.ascii	"\003\310\300\t`\235\262:\007\260\230\212\003\300\360\033\\\250"
+	.ascii	"C8\200\001@\007\026\313JD\260-\305:,mh\300\r"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 pU\002"
+	.string	"D\003d"
+	.string	"\t"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\007\b"
+	.string	"\t"
+	.string	"\r\020"
+	.string	"\021\002\005"
+	.string	"\002\006\002"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\377\001"
+	.string	"\023\001\001"
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"\b"
+	.ascii	"/bv\226\233\231\fg\035\013\021.\004\267\224\264\001,"
+	.text
+	.section	.gnu.lto_.pureconst.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\232\004\003\232\004\007\232\004\b\232\004\t\232\004\r\230\004"
+	.ascii	"\020\232\004\021\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 g\225\001"
+	.string	"\360["
+	.string	"\b"
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\003\007\b\r\020\021\002\002\023"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"F\b\342\245\f\330\0076\003[\300\276\\\366\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.9f8d43a98feacdb7,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cmsx_menuImu_onEnter.74.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"M\f"
+	.string	"\306\226RB\020q\224\016\003hHSm\263\215\226\244\035.>\330'R$\b\3668\335\017\0178\211\005\350\257G\r=*:\322I\262)\377d\262%\002\240"
+	.string	"\020\363\223\fek\327\323\3367\022\217nm\223-eJ\001>"
+	.string	"?"
+	.string	">"
+	.string	"\326X^\331\366?\034\004g\227`\274\r!\025\f\034>J\340\330]\313\336\005\304W\226\007\210\257T\303\271'\347_\304\241\207\n6:\220\323\263\222`w\235\035H\310\255\267]\300\266\002\373\021\002\013DPzr4\311\317E\214M\024\333;\245f\260\017WGl\230\206\232\326Lg\246\337\021S`dNv)\244R\366E\265\242\203m\316\276\330\231\013\b\236\017!\341"
+	.string	"vGh\250\330\3654\001'ye,\024j\241\n\365\0379\016\034B\274\252\302\024'\371\211\262\306?\212\327T(c\202\005T\246\234\337\215\253?\342$F>\2113\255\362\265\370*Yt&\036\231r%\355\222)\337]\003\306:\034P\347\303\300\300\006\223i\033\b\372\332\2302\221\307D\3022O)\273,\222\350\223Y\327V\2626\004\2545\3006\313\201\246m\326\305\333\227\304\216\210\207\242\234\037\nT\333\232\243x0`\306\356r|\023?q9\031"
+	.ascii	"pJx\307X\346j\200\2027\003\030\333|V\b\327#\317e-\323\303l\020"
+	.ascii	"\020\320\201c\240\t\020\327\252\201\203\t\271:%\236\366V\232"
+	.ascii	"w!\277\306\354\351\301\372\3603\217\251\235d"
+	.text
+	.section	.gnu.lto_cmsx_profileIndexOnChange.75.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`5\001\315\r"
+	.string	"\226Y\\D\360\2226\035\"\351\262?\203,\350\256#\374\032\255X>\216N\357'\f\016\340\210\336(x-$P\233Q%o\366\215Fp\362`4N\255\321\221M\310Kdb\355m\225\031\233\314l\241\215\350o\275\211\224)\005G"
+	.string	"H"
+	.string	"H"
+	.string	"\025\016`7\206\007\215\335\360\343\317\346\321\266\237\342*Lv\215'\024\341r}x\301\342\342\307\356b\016/\300z\334<\200\365\250!nz\232\374\263x\205\342\205\006l9=\257\004\273\353\004[\\n\275\355\021\333\f\354\223\b\231\362\305\341\322\220\250\f:6\203\330\341)\025\204\375jw\327\032c[\351\030\323U\225VM\247\246/r\235\310a\200f\027CJ\310\342\2105J\3306\331\034\273\200\205,C\367\360tve\006f\301\346\221"
+	.string	"\220\354\371\025\001\225\332\376\\Fi\300\216\335-\361a<F\310\227y4\004\216\273\241Z\351Y\206\220|\202uU\255f$\352EQ\021\322\006\350\343\251w\3265\365\027:\250d\312\376\314[t\276\214=\224<\370\350\243X\217\327\221\021\033R\002\037I\244\016e%\0172\255\001\t\310C\372<\005\0244\t\242\021\347\200\343\rT\3528\223\322I\2503\031u\033v\302i\035\266}#\ft\300\236(\364a$\317\3730N\270\257\2612\017)\252\342\313D'\243\332\332\226\007\215`EON\2150\001\034"
+	.string	"\375\224\361\216\261\314\325"
+	.ascii	"\005a\r\260\254\206\034\0256\302\001\264\233\025\302\341\310"
+	.ascii	"\373Y\313\2020\033\004du\f\027\346@0p\005SCd\252\200*\207W\232"
+	.ascii	"?\027B\215\261h\250r\204\0327\374Lcj'\031"
+	.text
+	.section	.gnu.lto_cmsx_PidRead.76.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\201\003\005\024"
+	.string	"\346\241yH\320\360(\035\330\310\225\216\036\002!\214\346\310\305%\032\252K\031\021-f5\230)\024K\002\242k\333vg5\343\253\365\305T\360\027\326,\250\3450\221U\304/\004t\352!"
+	.string	"<\320\002\365E\254\016\026V\324\204\220M\266L)_"
+	.string	"c"
+	.string	"a"
+	.string	"\266\r\227\031\235\307\347"
+	.string	"\244\020\325\343\310>\212\237mC\303\f\207\031\273\343\307\247?\302O\277\204\314F}J{f\243|\233\223\230\331\272\2161\004\f8\243s\321i\332]\225\307\013\370>\303\007\370>%\210\317\2563\3777\367j:\034\325^X\256\240\202\335\265\326^`ny\333\006l7\260e\215\366\330\242\362\203}o\245\007{\252AO\375M\365\364\324\336TKO\255"
+	.string	"\300\024I\004v\273\031\236h\254\213I$b(\350B#L5?=\367\031\33159Ua\334\027\333wd\277\371&\236\033\331\325\354.j\026\262\330\302\334\302\b\221z\234\237\363\023\262\353\330\350\266\220E\3162\b?S\036\316G\361k!7\245\305\3757W\031P\372G_qr\213\211\337\305\354\3226b\374#\330\211O\343\267\276OP~\\\330@\323's\250\277\343z\351k\237t \323\"Y\374\235s\340l\2246\367c\300\215X\362\370q\277\275H\fwi\257\371DG\021\301\247\371tL\324\327\304\357\3638O\321\324\311\232\273QZu\n\023X&(\013LZ)\241Y\"\t \210\224<@"
+	.string	"\322\241\0223\221^\201\254\270Z$+(,\027I\314\265R\241\264J\\\252\025,\246\002)\340W\n\013\246Ry\275`*\324H\273\356\023\221\241\311\026\203EA@R\306J<S\f\n\241\034\322!!\275\215\276\007\275XZ\001\r\365\360\314$\226\370\235\212\026\022\274\371\343\375\370\034\370{tH,Q\317\363TP\250ape\220\231\031\031\211R\220\244m \003\221\031\233\003\022@\325)\3149\212(\314\226Y\317\372g\217\221\376\230Q\224\340#i\315\324\342u\024\025\342b\310p\307\367\274\024\203\273\nf\217s\352\025~#m\206c\247"
+	.ascii	"\334N/\342\340\023@;]\226\366\013@f\026\2255\332\030\333\241"
+	.ascii	"\\M\366\001\242\310\033\375\251R\220}\205\327\322\037\223\371"
+	.ascii	"\031\330rl\266\220^\b\233\201\006\024]`|\331\037\001_\373\224"
+	.ascii	"6\216\224\356O\025;\244\206\203\301x\216S\271\276)\307\322"
+	.text
+	.section	.gnu.lto_cmsx_PidOnEnter.77.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\272"
+	.string	"U\013"
+	.string	"\226\025N? O]8\003[\223\274\222\322OY\323\205\360#3\213\001 \013\256\032\025\n\340\353\374\301\321\333\005g|\256\204\355-\254^\001\200\001\rv\n\241Lfr\302\346q\024E\235\300\261\335\275\245L):"
+	.string	"<"
+	.string	";"
+	.string	"\231m_\3037\2046k2^8m\024Z\224T\256\335\345<\276C{\0269\207\366L-<|\206\376;\034\313 A\205h\022=\267\001\273\353\024M\247[o\033\200m\002\366\005\004/o\255\\\231H\261\031\303\036E\251\025\354c\253(\033K\253\2463\323\3376\030((/v\037\274d\354\211L\004\006\333\241-\261?F\004x\236C\203o\354\242J\204\330\035+\256D\036+\027\252\266+_-\360X\261\273\030_u\020\007\374\3243w\236GBl\245\252\2764\343r\006\3325\365\016\"\220\362e\337\303?$\360S\016\201y\361\231\017j\317\256!, \2142\356d0\236\314\246\300\3052\351\274\317\203\231c\001\273\217\006\004u:M\250\343p\240\317\246\3438_\210\263P\354!\350|\234\002\317\3738\311\270gi\231\t#%ysi\244m\340\223\027\rBR\2213\022"
+	.ascii	"pJx\307x\346j\200\0024\003\\\323\020\035\t\361\370f\256)\270"
+	.ascii	"\306\206\213\231\220\312\340J\363.\344\263\230==X\037~\3461\265"
+	.ascii	"\223\f"
+	.text
+	.section	.gnu.lto_cmsx_PidWriteback.78.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\324\003\025\026"
+	.string	"\266\244\204J\320\360(\035\320\310Q\360\207]\363?\244;\260\274\\$\245b\203\\\210\274\221E?F\335\214\030Pp\344\317\013E\340\211\221\327\325\1779\252\251\335\177 \236\346\211\200@\247\035\344\301f\300\036 \366\251\213\264\351[\311'\204\354\235Rg"
+	.string	"o"
+	.string	"o"
+	.ascii	"#\225\276\227\273\217\013\311S\201\350\351<}t\311]\344l\326\307"
+	.ascii	"j\353l\226M@\305\310\351[d\270\200\335\034\034\300\3353\304!"
+	.ascii	"\345G\333\376\212\263\320\331J\037\247\316L\ng\030\363\003\265"
+	.ascii	"\273.\237\037@~,\357A~\254#\256;\325\371\357\271\310C\342h'\363"
+	.ascii	"r\232r\260\273\246;\231\231\273\3366\002\333\023l\261$K\243\354"
+	.ascii	"\023\206V\021\366\305\25596I]\216\324)\222\232\034\251G\222Z"
+	.ascii	"\034\251k\200\325\t\246\004@\273\036\206;vi\f\226\b\002\217d"
+	.ascii	"\342\2032\"z\221\211\217\307-\r\347\312\360\376\313\375\364_"
+	.ascii	"\\\310\204\245+_x%\320\236#\"}\220\377s_\356@\026\236W\326p\332"
+	.ascii	"\b\345\307\226\330\363q\371n\340\251bp\206O\273'\310\307\002"
+	.ascii	"(\002\243Q\221\202\237\210\306\f\230\215~\250\246i\203\376\236"
+	.ascii	"C\240Y*\253\237\244\022\363w$\bS\324\370I\227\021;k6\225i\312"
+	.ascii	"j\b\007\033\223\016\r\200\372\277\331\005\372]\2526\270\201\251"
+	.ascii	"/\376\357+\237\260i\205\376\016>$'\220?\350\254\233\237\217a"
+	.ascii	";\240"
+	.string	"\263k~\347\303\270\220\346\357|t\315F\277\263\221\037\337{\313\244Q^\321\320\337\207\246-\262\223\224\007'3\2252v\303U\313H\030\240\220\300,,\020\371@\301 \303\211\216\211\260\320f/\226\024\031\355\205\243\305\\)3\030\315\025\273\341\\\"\006\\S\221\335\\+\265\332\315\305:\315+\221$7f\205\361\312\204\007\265)T\240\337\271\265\n\001<\262\021\253\257\243\245\314\361\022\2035\210Do!y\340\r\033\257#\033\242\241\232%\262\372N+\"\023\314\2462}<\273&i\024Y\250qtEd\252Dd\222\222$Ic\320\002\221\031\263\r\022`\306\241\207(\203\006\225\322\036\373gP\204>\315\251\255\326&\267*en\200\307\236~e\036\206\bj\\\034\262Q\177q\263U\323v9\274h\"\314Z\362\251\243\222\252\253\245_\356\347@v\003\f.\247\367j/Sk\357Z\270~\205B\203\200\340\261\325\262\352"
+	.ascii	"#\240d\210\274\244WYA\355A\220\202\335\366\2558\275\232\264\207"
+	.ascii	"\036\317d/\200\226\362\276u\\b\255!\002T10x\013}!\025g\210\217"
+	.ascii	"\363vb~\215\243\031\203*\3119\355i\320\253?\274P\231\374\342"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto___compound_literal.1.80.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\324\262\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.3.82.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\324\262\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.5.84.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\325\262\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.7.86.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\325\262\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.9.88.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\326\302\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.11.90.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\327\302\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.13.92.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\327\302\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.15.94.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\334\302\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.17.96.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\335\242\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.19.98.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\335\242\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.21.100.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\203\336\242\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.23.102.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\310"
+	.string	"\005\0016\200\200\200\374\342\303\336\242\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cmsx_menuPidEntries.105.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\024\004\355\021"
+	.string	"\004\033\\\004"
+	.string	""
+	.string	"\254"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.ascii	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212"
+	.ascii	"\001\206\200\200\374\230\330\370\253\nw\300(us\301\001q\277\001"
+	.ascii	"o\275\001m\274\001k\273\001\005\001\006\025\001\r\t\202\200\200"
+	.ascii	"\370\336\202\003ig3\206\b"
+	.string	"e\254\254\024c\307\310\001q\306\001o\305\001m\304\f\270a=\206\b_]\315\316\001q\314\001o\313\013\370\335\202\003i[F\323\324\001q\322\001o\321\n\270YO\331\332\001q\330\001o\327\t\334\202\003iWX\337\340\001q\336\001o\335\370\327\202\003iUb\344\345\001q\343\001o\342\007\270Sk\352\353\001q\351\001o\350\006\370\326\202\003iQt\360\361\001q\357\001o\356\005\325\202\003iO}\366\367\001q\365\001o\364\006\025\001\004M\207\001\374\375\001q\373\001o\372\003\324\202\003iK\220\202\002\203\002q\201\002o\200\002\002\270I\231\210\211\002q\207\002o\206\317rGE\242\001\206\bCA\215\002\216\002q\214\002o\213\002m\273\360\001\277\1773\217\0024\212\002\205\002\204\002\377\001\376\001\371\001\370\001\363\001\362\001\355\001\354\001\347\001\346\0015\341\001\334\001\333\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\tYAW   FF"
+	.string	"\bDIP"
+	.string	"\tPITCHDIP"
+	.string	"\tROLLDIP"
+	.string	"\n-- PID --"
+	.ascii	"Y\250QxC\220R9\255oa\0160\003!\211\322\006\020(\202L\211\030"
+	.ascii	"\005\0360\322\326\022\032#&\251[C@I\305j\272#\377\266G\035\020"
+	.ascii	"\001\244\234c\346f\364\335\345\360\t\352\211\201g\247c|T\230"
+	.ascii	"/\234\332\212_\325\371B\225F\265j\n\f\341\t\374\335\334\024\214"
+	.ascii	"`\016\360.0\032\022J\301-\\^\300\211!\321o\212\233\204h\304M"
+	.ascii	"'\264\241\2418\336\227I\251q0\327\357\033E\347\020\251MT\306"
+	.ascii	"\rP\326\004U\327\003"
+	.text
+	.section	.gnu.lto_cmsx_menuPid.106.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 }\245\003"
+	.string	"d\006E"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\212\001\206\200\200\374\342\203\355\202\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\340\226\037{y\370\347\202\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto_cmsx_menuPidAltMag_onEnter.107.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\305\003\205\025"
+	.string	"\266c\202J\300RN:\200\213F\2640\231\212\230\307\346\361\256\3679\350\374\305 \203r;\006B^\223\303\017Q\261\341uG+\235Zp4\207\365\001\355LK\003hJ.T\004A\250\271\300\357\212Q|\211\024\0227\3639L\032\331d\357\224\002c"
+	.string	"n"
+	.string	"i"
+	.ascii	"?\344H"
+	.string	"\271\274\253\b\001\243\307\352\325\022\336\342f\217\257\324\306\331\243m\240W\362y\026\034>`\367\346\312\267[\276\374\022_m\373<\357\301\331P#e\016\257\205\023E\023d\265\2730\227/\020\276\212'\020\276\322\022\307}\342\374\373\034\3349\321C\267\223\371lA\330]O\335\216w\323\333V`\273\202\r>\bKo\354p\272U\247\303p\272\326i0\234\246uz\n\030\241l\274\200\354\202\310\n\2625\352\017\305\317\367\245\223*\253\244\243#\235T\355\270\346\353\241&\204\006'\312\307\213n/}\027':\241\032q\256\016\345\3566G\t8?\344\007]\350\366\027n\002\313\335\235i'\210\257.\020\350\207\004\327\246\\\236\003\023S\013^\017<\225\320y\240\333\003\263\327\242\376\323\241f\245\013)rCb\304n.\304\306\217a\233\371:\001~!|m\321\327\007\021\271\231\345q\372E\030h\363\272\220R\350\315P\031\277\350"
+	.ascii	"\204x\244\226\350\"\325\212\024W?^\377\320\313;\221\342n\356"
+	.ascii	":\237\351M5_\347\325.\344\274\216\f_\017tWnby\374M#\037\251\235"
+	.ascii	"Xv93)\216}0\032f),\021RVZD\230\227\024\352\231I\003\025\223\230"
+	.ascii	"\005\006$#\264\232M\005\264\214$\206\266\202\022\3032\243\241"
+	.ascii	"\274\320d0\226\225\030\r&\263\275\300H\020\270\3262\263\301`"
+	.ascii	"j5\033l,s\207\nMz9:\343Q\206O\211\362\210\221\":;6\270\350o\376"
+	.ascii	"\226D\337\224\216\230\222\323\221Q\305!#ErndHP\223\300$\244\220"
+	.ascii	"\273)\374\021\215\0312r\336\210Ij\207~\237\007Y\250q|EHFFHII"
+	.ascii	"A\222t\360\002\221\031\253\003\022 \365%\3229x\f\n\231\366\377"
+	.ascii	"\016\360\204\276\354\263o\243\222\007\237\213\222\320\254e\256"
+	.ascii	"bF\317\346\032\216\327\n:\nS\004\024\207\326\240\020\370\034"
+	.ascii	"\023\025\321y\223I|\003\024\204\273\367\207Y\255g)\350G\003\350"
+	.ascii	"\217\3610\016L\\\245x\003\310\016\257\226\352n\373e\223N!\002"
+	.ascii	"\320?bC\226\303^\362\266v\025\223Aw-\2125\032\310\212u]\021\207"
+	.ascii	"B\202\024jQ\344\314&\360\375i\362Mh\241\f\307W|\267\245\203:"
+	.ascii	"\323\360\200\312$\200T"
+	.text
+	.section	.gnu.lto_cmsx_menuPidAltMag_onExit.108.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\371\003}\026"
+	.string	"\306e\210J\260\020V:\343k\300\317\033\024WS(\2234\300\213\333\217\321Fq\273\230;J[\006\373\220G\350_\256t\376j\366\005V2u\255\303UU\325\023}Pm\234\342\277\303\211\276\327`\243p\006d_\006k&\347,\"\204\354\235Rh"
+	.string	"q"
+	.string	"t"
+	.string	"=#\225\036h\367\237\026\020s\201/\326\230>\347I?\370\210\235\315:Ym\236\315\262\t\300\214\234>\304\205\013\330\3059\205\273\246\313\256\325I\333\376\207\373\360\354\"\210\251\003T\345\2341A\347\356\276l~@yr\365\217\362d\365p\336)\317\277\210\217\301 \n\337\317\345T\325`wM}?\340]o\373\200\355\b\366x\013\346\013\2559\366\307\335]W\034\273\244^\221\324\252\222\272$\251\311\222z$\251k"
+	.ascii	"\217\016,^J\273\033\246nl\0239\344\031\n\277d2\025L::\222\211"
+	.ascii	"\324i\231/\214\fGL\316\371\364\242\335M\237\304\211L\244\202"
+	.ascii	"\273\313\342\2650\230\373[sd\244\037\362\203.\264{\t\023Gs\177"
+	.ascii	"\227Z\b\253\223\255\021\350\247e\\\032s\201\013x\020\234,\020"
+	.ascii	"+b8z#\033N;t&\363|ZU\277x\223\371;\035\244\006\035\033\0204~"
+	.ascii	"\212\253\220\2316\\\311\314\223\215\317noV]\031jzt\312\035\324"
+	.ascii	"/\242U\240\367\251*\203\233\227\352\342\027\035\200\020\321i"
+	.ascii	"\211\276\202\352\331\0323\\\377\320Y77\177\002\027\242\263\333"
+	.ascii	"\273\3177qb\315\3379i\033\216\336\207+O\036\350\255\036\2152"
+	.ascii	"\353\244F4\234\226F\331\001,\263\223\024\007'\264\333J\226\323"
+	.ascii	"U\317H\024\240\220\304($\020\001A\2610\323\215\226\211\254\324"
+	.ascii	"h\260\225\224Y\r\246\253\311^)\264X\355%\313\351^\"\006l\273"
+	.ascii	"\315r/\025\233-\367b\231\275\027K\222\233^}\261\007\207\017j"
+	.ascii	"K\230@\357s\313CF\250\3244V_\006K+\006\fW2s\216\303:\\Z\ta\274"
+	.ascii	"\200)\33582\022\226\325w\241\022\322\"\206+\231\201*\223\310"
+	.ascii	"$$\216\233X\376\210)Z\250a|D\204JD\206\222\024\024$\031\016\360"
+	.ascii	"\002\021!\253\003\022`uA\3209G\027\024\224\032\366\377\016\020"
+	.ascii	">\275\230\206\335B$1X\242Yx\211-\304\210\335\211\324\233 \237"
+	.ascii	"\r\"P\\\253\261\306P\341\005\236\310\313G\226\317F\004!\206S"
+	.ascii	"(\016~\341\221\314\261\211!\334^\017\022!L\266\216\216y\271\256"
+	.ascii	"Y1\223cJ\223\370\027!\001\225A/\245\273\353\313\225\320Y\217"
+	.ascii	"7P\\\320\373rk\255\"\031\352\354\242\266\321\230\254n\335\342"
+	.ascii	"G\211\334\001Q\245\317dA\370\360\\#\032\021\207\217*\326[\337"
+	.ascii	"\240\207\375\341a\225\251\007\377"
+	.text
+	.section	.gnu.lto___compound_literal.27.110.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\314\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.29.112.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\315\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.31.114.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\315\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.33.116.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\316\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.35.118.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\317\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.37.120.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\317\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.39.122.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\324\263\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cmsx_menuPidAltMagEntries.125.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`J\002-\r"
+	.string	"4\024\314\002"
+	.string	""
+	.string	"r"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\330\272\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\t\202\200\200\370\324\203\003ig3\206\be\254\254\024c\306\307\001q\305\001o\304\001m\303\025\001\007\317\203\003ia:\314\315\001q\313\001o\312\006\270_A\322\323\001q\321\001o\320\005\370\316\203\003i]H\330\331\001q\327\001o\326\004\315\203\003i[O\336\337\001q\335\001o\334\003\270YV\344\345\001q\343\001o\342\002\370\314\203\003iW]\352\353\001q\351\001o\350\307sUSd\206\bQO\357\360\001q\356\001o\355\001m\273\310\001M3\361\0014\354\001\347\001\346\001\341\001\340\001\333\001\332\001\325\001\324\001\317\001\316\001\311\001\310\0015\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\006MAG P"
+	.string	"\006VEL DIP"
+	.string	"\006ALTIP"
+	.string	"\016-- ALT&MAG --"
+	.string	"7 \200\203&\255\006#,"
+	.ascii	"\nU\343&4\3038\"\030\211\020P\203a#\t\262\223\202\001\0263\256"
+	.ascii	"\314:\224\tn\214\223YK{\031\303\327`e\321\025\301\3702\230,\364"
+	.ascii	"\312.\267\306\311L\213\275\031\343\313`\262\3205\031\236\221"
+	.ascii	"c\364d$\332}\261\355\266H[\233~\017Z\027L\224\034zXE"
+	.text
+	.section	.gnu.lto_cmsx_menuPidAltMag.126.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 }\245\003"
+	.string	"d\006E"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\212\001\206\200\200\374\342\203\337\203\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\360\235\037{y\370\335\203\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto_cmsx_menuPidGpsnav_onEnter.127.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\274\002\205\023"
+	.string	"&axH\3200'\035\220S\006\020^\nFR\347\352q\236\003\273\026\304\244\374u\302\r\225\265\004}Xtfu\260^\355\225k\221\r\337\324\306G\206\252^\343-\370\205\t\214\200\243\265\033\200\213_\363U\"\n\263\306\223A6\331;\245Z"
+	.string	"h"
+	.string	"`"
+	.string	"@U\247~p\0242\233u*\355\231\315\262]2F.\177\"\303\003\354\346X5\355\326\020\207|\247\266\375\237\003\315l)W\025q\343\320\301\315\020U\355.\350z\002\336\351w\001\336\351\324\371\354r\346?\350\235\217\t\243\232-\346\222\243\301\356Z\326l\267{\336\266\001\333\022\354\231 \2364\245\322\235'=\251\264\364h\365\300`\340b\267\303\r\033;E\235F0)}\251$\206\217i\276\033h:ftp3\216${\365S\034WB\305\232\201h\250k[\252\221N\376\310'z\221\354F~\352\352\332\316b!|\247 \335\220\320\330mM\335\333\002\240\243\003\247\005\242F\246\374\220\354B\243\253\356\355=\037\240\002K\353\250\361[X\b\375\035"
+	.ascii	"\247\340\235\322\031\302\301\206&o\230%}\244\n\242|\255\233\021"
+	.ascii	"pdf\214\217t\217\242\237\334\342\376\325 \301cE\243\273\237\274"
+	.ascii	"\037\275\336i\374vi\257\371M_\001\363wN\3352\312\327F\357\364"
+	.ascii	"C\007\241\311+\267l\244\n\017\271\225Wv\225\2213\204\375ng\216"
+	.ascii	"\035\027B\224\025\007(*,\337\213\013\312tH\242 \205\344d\002"
+	.ascii	"\002\021\227\b\213\245t~\211\300\210*&0+\241h\342\"\276\300\025"
+	.ascii	"\225\023\021|\305\\@\221\017\303X\302\030\370\002\203\305@V\245"
+	.ascii	"]\312#\301\241M\031\267x\224\222f\3565~\370La\0300\231$\323\022"
+	.ascii	"U\222\212z\215\362I7\271\375\203.q\350\364\241\376\"\254-\343"
+	.ascii	"G\t\0207\033E\250\241Tf\214\031!\251I\223\024&-\034\300\002\021"
+	.ascii	"\242\363\021\220=\223f8\205a3P\334\177\367\221\177M\2236>\321"
+	.ascii	"\360\336_V\322\002\boA\004\3127\263\354\236p\321\355\020\340"
+	.ascii	"\005$C\326\204.\360v\334\365\200\304\256\317\t\030:\252\3033"
+	.ascii	"\200\016\317O_\2223*n\342\261TH\377\3479\267h%\220\001\300\026"
+	.ascii	"\250\306]\231\255\256\021b\200er\337D5\237&\251\373\0349,Z\025"
+	.ascii	"\343\226*\034{\027\005\240\303K\325\224,*"
+	.text
+	.section	.gnu.lto_cmsx_menuPidGpsnav_onExit.128.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\346\002m\024"
+	.string	"\326\342}I\320\016)\035\212c\032k\344\335F\243\243\314\204C~\b\371\331c;\353T\234\226pm\007\241\376\037Z\331\001-L\nM\324\327\336\315\3034/%\017\322\016\036\225\376\341A\036h\272\315\360\327P/OP\036\216\325d\223\275S\n^"
+	.string	"k"
+	.string	"i"
+	.string	"u{\377\301\324\234\340\251+\274\004\316\036O\245\235\263G{\205\324q\371\235\r'\260+\023<\332\255-\267R\247\266}\234\347\344\354\337\252\322\3646f\226Z|\202\273\353r=\002\3614u\003\342\351\234y\3562\347\237\304\303\233\235\246\035o\345rc\302\356Z\356x\275{\3366\003\333\027\354\031\022\225EN\021\366\303\2352\266(-Ri*J\207Tz\216*\027/$4\355\202\250\021\265L\024i\204\021\321\213@\236n\354\362\355\340\002\240ef\311\351B\270W\337\304\203@`\2149\026\207\272\274\255\035\241<\220\357\363\037\334O8)\254\313;\215\265\220:e\205=<*\341\276\324\355A\320Qjp\232\300\246c\312\367\340\316\243\262\noq\002\363k\006\320\01741:/\376\212\263\200UZ\355#&*&gW\027\023O\305\331\362"
+	.string	"\243\2235,@\372B\262\f\362;:#\370X\346\212/\364"
+	.ascii	"?I\300\rz\352\311fe\304\b\357$\361@\037}\257G\252-\240\331\325"
+	.ascii	"}\347\037=\305\314\25795\255&\277\253\211\247\3579K'\241\254"
+	.ascii	"\332\221(p\200+\241\354)\261\221\022\n#2\223\024\314v\233\216"
+	.ascii	"y< \361xap\300\261\"\321\020\273\205\206q\240\314d\"(%\261\231"
+	.ascii	"\310m\006s\225\310^3\027\314vsq(0\315$fs\235\320h6\327Xu\377"
+	.ascii	"\211\036>\335d\261J\251\200\264CD\344wf\251T\020\r\315\330p\372"
+	.ascii	"\300\224\003L\257\332G\b_h4\215\212(\321o\351U\223\037:\002."
+	.ascii	"\320\241\234\202N\342tG\250qXe\fR\202\221\2524Ia\222k\240\002"
+	.ascii	"\221)\264\r\021\240As3\323Ba\031\003\220\352\377\367!8\201\226"
+	.ascii	"\030~\327\"\033'\334\305\221\244\027\250\330\330\347I/%\002\365"
+	.ascii	"\351\215\300=1\340\225_\211\006\255\272\247\361&\324\344\366"
+	.ascii	"1\030\310\342\274\352\375tRG/\374\t\246\364\265\271\031\330\266"
+	.ascii	"\231\245J\332\217N\251UT\212l\230]xj@\2201u_T\\\205\311\2743"
+	.ascii	"\352\2069\035\206\217\346\026k\233\r+\325\035+\026\025G\207\247"
+	.ascii	"\313\324\364?"
+	.text
+	.section	.gnu.lto___compound_literal.43.130.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\375\303\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.45.132.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\376\303\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.47.134.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\377\303\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.49.136.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\303\377\303\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto___compound_literal.51.138.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 {\245\003"
+	.string	"d\006C"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\304\304\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cmsx_menuPidGpsnavEntries.141.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\250\001m\013"
+	.string	"\244\0214\002"
+	.string	""
+	.string	"h"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\320\310\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\t\202\200\200\270\304\204\003ig3\206\be\254\254\024c\307\310\001q\306\001o\305\001m\304\005\370\377\203\003ia;\315\316\001q\314\001o\313\004\270_C\323\324\001q\322\001o\321\003\376\203\003i]K\331\332\001q\330\001o\327\002\370\375\203\003i[S\337\340\001q\336\001o\335\374sYW[\206\bUS\344\345\001q\343\001o\342\001m\2738Q3\346\0014\341\001\334\001\333\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\007POSR DIP   P"
+	.string	"\r-- GPSNAV --"
+	.ascii	"+ `\203\2465\006\223\262\235;v\321\255?\273\374\273\254>b\201"
+	.ascii	"\311\\vJ\031@\261\306\311L\207\231\300\215q2\323\037!pc\234\314"
+	.ascii	"\264\330\2231|\rF\026\357\345\3147\005Q\215NF\256\356\273f7G"
+	.ascii	"\255m\354=z]@Qr\350\241\024\001"
+	.text
+	.section	.gnu.lto_cmsx_menuPidGpsnav.142.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 }\245\003"
+	.string	"d\006E"
+	.string	""
+	.string	""
+	.string	","
+	.string	"\005\001\212\001\206\200\200\374\342\303\316\204\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\354\244\037{y\270\315\204\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto___compound_literal.55.144.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\202\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.56.145.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\203\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.57.146.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\204\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.58.147.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\200\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.59.148.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\201\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuManualRateProfileEntries.150.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\320\001\335\f"
+	.string	"\304\0230\002"
+	.string	""
+	.string	"\224"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\360\313\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\016\202\200\200\270\336dig3\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\005\370\335di_D\206\b][\315\316\001q\314\001o\313\004\334diYR\206\bWU\323\324\001q\322\001o\321\003\270\334diSa\331\332\001q\330\001o\327\002\327diQr\206\bOM\337\340\001q\336\001o\335\326tKI\202\001\206\bGE\344us\345\001q\343\001o\342\001m\2738C3\346\0014\341\001\334\001\333\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\020MANU RC YAW EXP"
+	.string	"\rEXPO"
+	.string	"\016RATEPITCH\017ROLL\022-- A --"
+	.ascii	"/ 0\003\221b\035\263\021\307\201\314!\335K\034:>\351e \324\212"
+	.ascii	"\244\337\371~\001\377\206\225Xc\304\246A\247\222\003\024\303"
+	.ascii	"`\033\321)q\271e\343\302d\266\277\231\340\206\3016\242S\342r"
+	.ascii	"\303`\033Q\327ffS\350\244<d\331j\363}c96\261\261\237\323% \212"
+	.ascii	"\222C\017\256\b"
+	.text
+	.section	.gnu.lto_cmsx_menuManualRateProfile.151.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 `\001\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\354\204\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto___compound_literal.62.153.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\375"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.63.154.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\376"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.64.155.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\377"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.65.156.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\373"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.66.157.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\374"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.67.158.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\366"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.68.159.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\367"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.69.160.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\370"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.70.161.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\n\005\001\006'\001\371"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuRateProfileEntries.163.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\024\003U\021"
+	.string	"\204\032j\003"
+	.string	""
+	.string	"\236"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.ascii	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212"
+	.ascii	"\001\206\200\200\374\230\330\350\330\n"
+	.string	"w\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\n\016\202\200\200\370\305eig3\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\t\270\305ei_>\206\b][\315\316\001q\314\001o\313\304eiYJ\206\bWU\322\323\001q\321\001o\320\006\025\001\007\377diST\206\bQO\330\331\001q\327\001o\326\006\370\376diM]\336\337\001q\335\001o\334\006\025\001\005\376diKi\344\345\001q\343\001o\342\004\020\270\375diIr\353\354\001q\352\001o\351\350\003\374diG|\361\362\001q\360\001o\357\002\270\374diE\210\001\367\370\001q\366\001o\365\370\364tCA\223\001\374us\375\001q\373\001o\372\001m\273\330\001\277\1773\376\0014\371\001\364\001\363\001\356\001\355\001\347\001\346\001\341\001\340\001\333\001\332\001\325\001\324\0015\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\nTPA BRKPT"
+	.string	"\013THRPID ATT"
+	.string	"\tTHR EXPO"
+	.string	"\bMID"
+	.string	"\013RC YAW"
+	.string	"\bRCO"
+	.string	"\tRATE"
+	.string	"\013PITCH\nROLL\013-- --"
+	.string	"E\250aLF,4\250\264\265\n\303\0300\003!\211\333\020(\204hHJ\201\007\234\310\304\366\232\251\024\334"
+	.string	"H\005\352\016\250\317\036\0252\001\244\213\004r\002"
+	.ascii	"\236E\306\016\207q%\2250a\302\206\261\270\374F\022\365\227\241"
+	.ascii	"\212\211\310\226\376R0T\271@\200\020&B\005\002K\227PakcK\204"
+	.ascii	"\250\260U8b>\016\332\322\032=\376L!gh\241u\343\334\034Rj\023"
+	.ascii	":\003\016t4i\257\227\001"
+	.text
+	.section	.gnu.lto_cmsx_menuRateProfile.164.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 `\001\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\324\205\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto___compound_literal.73.166.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\275\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.74.167.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\005?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.75.168.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\310\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.76.169.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\301\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuFilterPerProfileEntries.171.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`]\001\225\013"
+	.string	"\204\022\341\001"
+	.string	""
+	.string	"p"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\320\353\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\005\016\202\200\200\270\334fig3\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\004\370\327fi_<\206\b][\315\316\001q\314\001o\313\003\270\327fiYI\206\bWU\323\324\001q\322\001o\321\002\370\326fiST\331\332\001q\330\001o\327\325vQO_\206\bMK\336us\337\001q\335\001o\334\001m\2730I3\340\0014\333\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\bYAW LPF"
+	.string	"\fSUM LIM"
+	.string	"\nGYRO S\nDTERM\021-- FILTER PP  --"
+	.ascii	"$ 0\003\241\255\016\006\245\330\210\212#\204\356c[\307\nTi\266"
+	.ascii	"\354:m\r\260X\343d\246?\231\300M\2037\242\253\214\341\273\301"
+	.ascii	"\033A\327ff+tR\336\263lu\363\205\261\\7\261\301\347\324\022\240"
+	.ascii	"\242d\350\241\027\001"
+	.text
+	.section	.gnu.lto_cmsx_menuFilterPerProfile.172.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 `\001\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\346\206\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto___compound_literal.79.174.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\001?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.80.175.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\004?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuGyroEntries.177.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\250"
+	.string	"\035\t"
+	.string	"\204\016E\001"
+	.string	""
+	.string	"W"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\370\355\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\003\016\202\200\200\370\356fig3\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\002\270\356fi_=\206\b][\315\316\001q\314\001o\313\355vYWH\206\bUS\322us\323\001q\321\001o\320\001m\273 Q3\324\0014\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\tGYRO LPF"
+	.string	"\nSYNC"
+	.string	"\017-- GLB --"
+	.string	"\031"
+	.string	"1\345l\271&\273A\306\262"
+	.string	"l\002\005\203\215@\247#\f"
+	.string	"\212\001\006\203\215@\327&d\006\205N\241<\310\262\025\232\257\032\313\205&6\352s\312\0220EI\031z"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_cmsx_menuGyro.178.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 `\001\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\375\206\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto___compound_literal.83.180.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\001\005\001\006\035\001\003\005\001\212\001\202\200\200\374\342\203\305\267\027\001\177}"
+	.string	"?\202\210\200 {y\275\001w\273\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto___compound_literal.89.186.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\001\005\001\006\035\001\003\005\001\212\001\202\200\200\374\342\303\314\307\027\001\177}"
+	.string	"?\202\210\200 {y\275\001w\273\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto_cmsx_menuImuEntries.192.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\036\003M\022"
+	.string	"\024\034x\003"
+	.string	""
+	.string	"\232"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\360\372\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\n\004\270\317wig3\206\be\254\254\024c\307\310\001q\306\001o\305\001m\304\t\370\315wia=\206\b_]\315\316\001q\314\001o\313\270\315wi[H\254\254\024w\322\323\001q\321\001o\320\007\t\202\200\200\370\314\3471YW"
+	.string	"\202\200\200\350,\177U\330N\350\002]\332\333\001q\331\001o\327\001m\326\006\307wiSY\206\bQO\340\341\001q\337\001o\336\005\306wiMb\206\bKI\346\347\001q\345\001o\344\006\025\306wiGn\354\355\001q\353\001o\352\003\370\305wiEz\206\bCA\362\363\001q\361\001o\360\002\202\200\200\270\305\3271Y\277\177\250\367\177\350\002c\371\372\001q\370\001o\366\211\001\206\b\275\177\234\254\3747\273\177\375\376\001q\374\273\330\001\271\1773\377\0014\373\001\365\001\364\001\357\001\356\001\351\001\350\001\343\001\342\001\335\001\334\001\325\001\324\0015\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_imu.c"
+	.string	"\tGYRO GLB"
+	.string	"\nMANU RATE"
+	.string	"\005\n PROF"
+	.string	"\bFILT PP"
+	.string	"\013PID GPSNAVALTMAG"
+	.string	"\004PID"
+	.string	"\t\021-- TUNING --"
+	.ascii	"E\250QL&\260\016e\252\244\234\2445\020\003\031\031\352\006\020"
+	.ascii	"8Df\246l\322\001P\310\311\004\250\256\357Ms\241\370\324g\260"
+	.ascii	"8^\365\275\024\375&\370\304\322^\233E\202\222\264\211\201\325"
+	.ascii	" \350^_\323A\363\366n\020\rj\242e\345\261lp\262\233\3136(\020"
+	.ascii	"Y\352r\273\017\211\264\206\273\273\226\256\241p\325l\221\"r\330"
+	.ascii	"\"\007\364\024\026\b\363\206\235\3354\376\276\245\311\245\331"
+	.ascii	"\234j\272\341\317\271\006\025\036o\274\376\004"
+	.text
+	.section	.gnu.lto_cmsx_menuImu.193.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375 nq\003"
+	.string	"6"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\344\207\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\234\236\370={y"
+	.string	"?\202\210\200 wu\275\001s\274\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_imu.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`~\004\005\020"
+	.string	"6\232cA\240\356&\035\200\271\342*\024\3434\307\317\327\374\3328\374H\210U\230s{s\223\354\333\277<\216\245M\324\256\323\344x9\336a-z\253\350O8\350Q\265G\016\256D[\013\354\030Y\333&h\357\224\002K"
+	.string	"Z"
+	.string	"W"
+	.string	"\006\326od\201\265\215\200\231\006XI\300:\216\214\035\301\214\272WQ\027\262q\255\341\310"
+	.string	"\353>\362[\347ZF\352"
+	.ascii	"\270\3062\315[\373\221+\217\335\264?\243\251\234\324\331FQ\020"
+	.ascii	"lZc\257m\013OD)\245\251=\225\266;%\001PL<,q*$\356e\304\273\210"
+	.ascii	"8\227\020\337\002\342Z><\213\207c\351\360+\034ne\303\277h\370"
+	.ascii	"\230\f\027\203\341a.\034\214\205\223\251\3603\024nf\302\321H"
+	.ascii	"x\232\b\257\002\341\342\203\267q\3602\r\376D\346C\f\314g"
+	.string	"\301\325(8\255s-\301k\b\326n\344\001/\005\266m\341e\271!{\244\013\261\236 \256@\234\347\207\361\370\360\235\036\266\303\303uv\230\216\016?\345\260\023\016\337n\270\311\206\367\324p!\032&4\303\203dXP\f\007\202a@/\374\307\205\r\265x\023\026g\262\342KT|vt\320\350N\212>%\305\245\240x\224\023\017N2'6SO\257\t\023\345\270\346W=\361\025\347\232(p\325\232\337\350\315>\256\346\367\252\232\236\370\352\224\2320\3616\347W=\361\2709Y\365\346\351\211\257\306y\"\3313\035\331/\031\331+\025\331\2179\"\373\244\333\2264\244\016o\2501\b\207{l\1776\003\220\203&i\f\021 \004\030\356\004\227\226\224\333\006\002\234,\361\315p\211C3\2768 \\\\1(C\340c\243Q\222\267\3021\003\322\255\251\353\253\370\201\\e\346\224\007\003\tIP`\220\220\b\006\006j\375\244Rt"
+	.ascii	"A\004\2067\251>\230\273J\211\214\002\370\251{\306\301\033\372"
+	.ascii	"\325\243\001\016\t\210%\321\344\006\266\n"
+	.text
+	.section	.gnu.lto_.refs.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`\253"
+	.string	"%\n"
+	.string	"\266\032P8\020\223\222\341\377\377\377\377\003"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\377\377\37773\340\037\214xDT\021\021\020D\277|\003~\344\033im\223F\366n\244\021Bv\2222<"
+	.string	"B"
+	.string	"B"
+	.string	"\3650\266WJV\tU\3540^\024i9rj\3440J\257d\0257\363\242J\313\225S\253\206\361#\225\236\250\324@\235\030=\227\23263/\211\264\"r\202\310\030\255\311\251\344dO\004\023x\300o\223H\300\001~\227\260\222I\212\362\247'_\255\036\251\311\"M\231g\016a/\263\247A\030[\314y\363\007\253\366(\311\237\257G\356,r\310 \177\354q\347\016\327\261g"
+	.string	"\323\2752S\225\220\025W(tL\241aJ\026s\305T1SL\024\307\f\363\373ez\227~K\237\245}\245]\245.\267\314\362\312*\277S$\nOX\302\021\206\360\033Ez\260\203\033\314\340\005+8\301\b>\360\373\244\031\270@\2446Q\352\022\245&Q\352\021u\213\250;D\335 \352\376\320\266\207\266;\264\315\241\355\re\216\211c\336\2306f\215Ic\316\2302f\214\tc\276\230.~k\330Hgh4\206F_h\264\205B\001"
+	.text
+	.section	.gnu.lto_.decls.9f8d43a98feacdb7,"e",@progbits
+	.string	"(\265/\375`QA\335\346"
+	.string	"\312\202\025TW JQ9\3517\360\307\327\305\235\374% \202_.Q\365\353E\317\372\2337\261\037\377}\263\342\205\f53\352\357@\326\335\206\353$#\332F\253\030\371\327\230W\200`Q\262\361\2765\353\330\266\357\377\367W\\g\326\242\246mKj\323v\311\277\335\247F\214\330M\244L\001g\004\022\005f\005A @\200"
+	.string	"\001\302N\311\240\346L\216\275:zK\364\334\264=\313\251\334\306@)\005\374\223\0025\304\261\331j\266=oQe\320JVib'\203\331\025\230\220\313\003ts\223\004\253\2051L\206\305\260\223\313\004\255\367\252\271\300/\020E)\2016\274\244\236\367:\3378\013\227a-\177C\237(U)^S\317{\357G\374Ce8\216\303\020E)/R\312\031\002\240\275\221Z\202w\257s\002\020 @\244o\313\025\256T\373\205\301\324\255o?\304\264=\353\370R\207\322\231\265\001\341\030\316u\177\001\210\214{R\325\226a`\272\377\300\234\273/^S\350\346\300|\314e\265\365\262\203\345\013\215\253\266g*\365?;Y\216\273\2547\350'\343\312\314\221\266\347\253~\315\355\376\003}S\2325\276\264=\b\030\016'\254\212\234\233\266\037\252g's\331b\275\326\302\306\332\376_#\242\004\247\345\334"
+	.ascii	"\350\\e\301\200\327\366\033Po\202\352\201\201R\313?\351\177\273"
+	.ascii	"?\327\224lI\025^\333\263P\231\005ncg\005\354\266\236\335\273"
+	.ascii	"\362\344TU\005a\266}\b\352\271\202\224\367\270\202\364(\324\036"
+	.ascii	"\376I\257\306@\351\317S\330Z\311\223\257\250\266\314\366\263"
+	.ascii	"\032\257\361\272\201{\221\367\336\016\266\007\327\030\036m\203"
+	.ascii	"\030(E\371'\345(Cg)?\251Rk\275j\367^\036\264-K\324\233\266\315"
+	.ascii	"?\351\331\311i\036\214\345 \3236"
+	.string	"G\350\f\345?]\267\304\177\352\317h\025\334\325\207g\275Q\343\253\355\317O~6\3433^\321\344\024\363\252\335\344\352\303H\"T\320\332r\023vr^\231\311E\2248zD\273g\367^^I0\357u\342\225\347\315\275N<\314\037\230?\3302/\"l\251}\253_\031(U\371'-v\230\357g\032\235\344o$\\\314\256/\006\013\353#\006\370\321\016)~?Z\242\215\264\370\271\371\274\306:\002\201\007\272\210\007?;\377n\376MDJ\013\371;\310\363\032\013\225\312\221eU\325a*~\246\341\366\266\205\341\332\307\337`?w\361\202\362\200\342\304L\311\021\"A|x\211Q\177\264\002^\177w\265\0163v\317\373{\353o\255\306\032\300\217b\001C\327\005\356\347\261\237\311~.\373\217\376\250\026\r\372j\203\237\303\374m\365\267\rf\343\246\251\376\256\361\363^\320\217\222\371`\017\205\233\020P6 \240i@@\355B"
+	.string	"\341\207C"
+	.string	"\241\0041\021z\352\001\177\373\376\226\372\233\206\232\323#\343\357\250\2777P\360[\035\026\nXq\200\025\037VTP4A\021P\221O\006E\"\354(\272\336{\376.\362\263\b~\006\301\317!\370y\004?\037\177>*B\375\327\360\243'\376\006\300\337\310\277\237Z"
+	.string	"\004@"
+	.ascii	"\b\241\343\337W\004\177\207\340\003\377g\370\177\367\237\315"
+	.ascii	"\3776\377\361~N\376\255\302\3371\376\207\371O\346\177\335\377"
+	.ascii	"\017\277=1\024\006\203\0320\241E\005\214Tt\220\342\003\017Pl"
+	.ascii	"\360s\326\317W?[\375\214\365\363\026{\360\263\006\016\374\355"
+	.ascii	"\003\3766\221\002\004\2322`$\376\315\364_\357\033\376~\373\031"
+	.ascii	"\003=\374\316\337R\372Es\340\342\347\024\215\364\367Qg\340o\f"
+	.ascii	"\374\234\001%\177\247X!<\213\373\374\275\345\377\332\331\276"
+	.ascii	"f\371w\b\025\370\357\344\357\021\376\007\340\277\336y\376\366"
+	.ascii	"\362\267\212\277A\370\373\203\277;\370;\002\177g\3607\211\277"
+	.ascii	"E\374\035\342o\241\277\027\3607\210\277-\370\033\001\177\033"
+	.ascii	"\340o\002\374\355\341o\001\374\035\200\2777\374-\301\337=\177"
+	.ascii	"\357\374\235\363\267\206\277\325\277\323\237\367~\316\373\331"
+	.ascii	"\315\317m~f\363\363\232\237\323\374|\346g\273\237\315\374L\346"
+	.ascii	"g1?{\371\271\313\317q?\303\375\274\345g-?\277\375\214\345g\267"
+	.ascii	"\237Y\370\271\312\317S~^\373Y\312\317i?3\371\331\354\347\"?\003"
+	.ascii	"\3719\354g\260\237\277~\356\372\231\3713\327\317:~\306\361\263"
+	.ascii	"\324\317N?3\375\254\364s\322\317\034\370\371\305\317\302\237"
+	.ascii	"\217~\016\376l\364\263\006~\316\300\317\027\370\271\204\237Y"
+	.ascii	"\374\274\342\347\242\237E\3709\204\237A\370Y\203\377J?\217\370"
+	.ascii	"\257\367\237\355\277\363\377\223\377\353\177\243\377p\377)\260"
+	.ascii	"\267\267\267\367\363$\375\0328\360[\320\201\377\315\240\316\320"
+	.ascii	"wDQJ U\332\216\277\365\372M\347\241\227\235\275w7]F\024\245\004"
+	.ascii	"J\245\205\261\3516DQJ`\025\024\327\263\367:M\337\261\234\326"
+	.ascii	"zm\354\244\361\220z\342"
+	.string	"\335\353\004\021\004\002\004\210\2343G\340~h\260\377\241Q\377\033\203\207\222qb\306\255\355\177[\324\377\256\364\032\213\245d-I\333\377\240\250gg\2539S\251Xa\273\322\366\2771\365\277\037*\005\313\347S\354\371\273R\201\254\204\3362\310\240\365\274\312\365\202\377d\250\023\224)S\206\353\324\314\250\023\b\0313f\257\t\247\002\r\021\352/\334a\234\035\206\331B\240\360\332z\252\251\314\246F\245\316\004\250Z:\232\334h\013\224\024z\3279\273\216\357B\374\330\236\252\236W\331v\301S$\352\004Q\350\350\372\254\357\275\267\371\223\342e\346\231~\251\033\242\b\275\275xIj\251\033\314\204\336]\2724\333\321{\273\366\232)\ruCS\350\035\027\327lA\0354\321{\346\251\023\310q\341\322p\016X\033\256L\024\324\220\266\367=\325\tl\270\340B\237\251\367\336\343z\2532\3206wF\366\246\006\301\220%K\033\245\257L\335"
+	.string	"F\350\335B\013Rb\352\206\027\204\336W\256\320\3601\325\rnB\357\2666\345\334\031\236\317J\r\302\263b\245\313\265m\324\ryBo*T\232\215{.\322\253F\323\222Q7\240\021z7qv\223f\013\272NK\r\212\254sgxW\251\274`-\310\262 u\006\325\3666\006\365%\326 M'B\232\367\256\037\361\204\357\2004\207\234\r\205\357J\264}\031#Kk)\255\326Q\330\331\316Fs\336{u\256f\200\232\322`o\325\324\333'\352\255\023\365\226\211zk\246\336\212\251AN\241N\322co%W\322gZ\367x\206\204\233\346\334\031\336\325RZ\360\267\331\373,}\212\332\263\321\366k\272\354?0\265\321\202T\223\262%?-SV1p\236\332\216\037/\320 ;\243I\372\226Q\212di{T\215\372\237\337\177z\235\224\367^\033\276\365\266=\345\244?\237}g\013~\035F\231"
+	.ascii	"\377\355\275\207@\231{\233\b\271\367\262\232\224KW\226\032\017"
+	.ascii	"\367\377%poQ\022\331u\357\275J\237\244\263k\231t:\035}\244\326"
+	.ascii	"\256e\322\331\265\364\271+Z\326u~]\237\273:\335$\222yl\247\273"
+	.ascii	"\336eO\322\331u\274\310\256\245z\235\236\311\365*}\356\352\244"
+	.ascii	"\274\316{\371v)\223jNG\237\244\263\353\230t2\227>\311\265ky\221"
+	.ascii	"\367\250\"\321\356E2\227>dk\327M:\235\226=I'\363\310D\b\221\263"
+	.ascii	"\016oii\316$\221\227\212\0022$S)\227\\\231\334v\357Q-\352*y\275"
+	.ascii	"\267\353^\035\314\017m\310!\307\266'9\252\237\026\362\270U\343"
+	.ascii	"\311\213\t\\\237\256\\\022\t\363E\324\275an\r\022G>\256\367"
+	.ascii	"^\031\367\351\310\367F\255\312{\237\230\033\320\272\367^&\307"
+	.ascii	" Cyu.\322i\352\311\213\231\023\365\304\224q\221\254\300\367\336"
+	.ascii	"\273L:\275\230CnQ\234\315\373\264\03699\305\274\315\033\246K"
+	.ascii	"\251:\217\353M\336{9\215\016\033+uxm\377Fr$G/\312\031&m\275\224"
+	.ascii	"qU)\323\366|\346\324H\034(@J\334\330\322\272\031\242(%0\212\256"
+	.ascii	"\212\327\256r\264\217\336j\256'\252#\026\337\375\274p\264\217"
+	.ascii	"^\241{\240k\233*\003J\220\032T\275\214\342\305\243\245\246\232"
+	.ascii	"\306\316\261\347>\321\2055\033*\252i\374\236~\344\270\202\227"
+	.ascii	"\305\252\227;\307\365V\245^\\9\256\340\335\273\376o!m\244\177"
+	.ascii	"4\220\016\322aM\244\305\272H\203u\263\207\260\263}p\2277\217"
+	.ascii	"f\"\333Gg\361\335\316Q\002\267*\307\025\255{W\020A P\251\"Y6"
+	.ascii	"(\260\335\325^\354L@\177\235\243\364\361>\247\365\256\367\256"
+	.ascii	"<\035$o\rJ\333\243a\3529\001)\272\267\307\tH\2172\325\276\f\224"
+	.ascii	"z\340\237\364o\256\336\261\303E\214+\253\255\216U]\023C\267\243"
+	.ascii	"\355\321)\265s4\016\035=$sx\352\373\214\372\036\243\276\353\324"
+	.ascii	"\267\234\372\206S\337Y\324\267\232\332\313ne\333x/\273\352\""
+	.ascii	"J<\007y\317\356]{i\357ub\376\260\303\374\301\367&\346\004%\265"
+	.ascii	"o4\365]\246Z\300@\351\273\251\206`\240\264et\222\235A=\203\207"
+	.ascii	"\347\236\250t\264}\377PGp9(\375\036\007\245o\036*\021\003\245"
+	.ascii	"\375\244\306I\365(k\373\246R\317O\265\207\201\322\267\355\351"
+	.ascii	"\351L\201\251\301\325\226\363\324\220\367\336\240\23473fF\276"
+	.ascii	"\270a6\214\3073p\033v\362\2333\032N\303j\316\353M\"\357\275g"
+	.ascii	"*k\370\016]\233?)^Z\317{\327\363\331\271"
+	.string	"\f\317i\245\360\252a\206\237;\005\270\367k\257\311U\3360\026n\001u6\201TOT|\366s\2257l\205\257\240k\363\307FW\365\274\327\031u\007\"\327\353\274w\345\371\205!K:\245\366\2671\320\335\271\260\203\256\355\031N\225\032c^\332Z/\266\213\225c9\255{\227!\224(\357\177;\307N\353\305\226\235W\020AvjK\207\032k\345~\033gah\266\264\n\230\031{m\277\201\212\332r\f\224.\300\276\300\366\305\306\343\330\226\0027\333\202\205\263-X.|\225G\354\226[.\215,3\345\324\326\276Y\027\376\003u\246\326\226Z\254\013V\013\222\037vW\326\266l g\264\315\322h\266\016IUX\333\257\371\333\177\240\305r3\213k\373\rd\352o\261\260\305}y\262]\251\2023d\275\002\325\326\266\265e\301\272\335\266}\265m\003x\303\303\374\201\007\307\024\027\214\244\266\203\035\025*\266J\020\363x\306"
+	.string	"N\214\3145\3419\023\345\305\251\n\337\341\210Y\2221i\373\r>\324\016n\324\324,\333\006'hsMv\254`\271\375\260k\267l\275|\333\032\313\321\366k\370\316\353\256\f\013m\377\243\247\006-\243D\t\212c~\031\373\371"
+	.ascii	"\343t\323\366?`\324\240\255'\177b\235!\370\312`\253\233\362\004"
+	.ascii	"B\261\341\304\303\t\305\276\240\204\216\f\0244\353F\313\216\314"
+	.ascii	"f\245Ac\266\375O\0275\b\310\222%\326I\020\363x\206\304\226\365"
+	.ascii	"\313\230\205C\262\020\305\211m\262\023\204\bY\221&\226I\032f"
+	.ascii	"\357-\331\366\354\002\321l\231A\256\355\177\336\254\231-k1I,"
+	.ascii	">\332\376g\212\372\23735\310L\350\277\035\263cV\t\243\335\252"
+	.ascii	"\t\334\320\224=\361\356\325\262\200\367\366\362\234\264\265J"
+	.ascii	"d\360\315!\031\302\326\366?QH\220\264=\215\030Y\2714\233M\347"
+	.ascii	"\220!\314!B\204X\340j\001\001\322\342)\201SXX\0139\2372``-\332"
+	.ascii	"|\264|}\265h\372\240uu\265`\372\2101\231-\224>Z\\\\o\327\347"
+	.ascii	"I\005\262r\303ioX\035\036\260\254\277\037I&\253\305q\233\343"
+	.ascii	"\267YV\013\247\311j\005\206\266vk\350\026\007\02158\270\266:"
+	.ascii	"\374\223r\220c\240\264\313\360O\372\036\273\253\253&\345\026"
+	.ascii	"\0336\236P\224J\271\0361Ke\251\212m=Yv\312N\025\233=GK\303\322"
+	.ascii	"(2y\310\330\244M\246Q\362\274\251@m\204x\t\333\243\323\036m\224"
+	.ascii	"\2073m\252\222\306\2305\026y\013\365['\373\224\036\325P5i\313"
+	.ascii	"fC\267H\036:\026\326\fi\273\323\306@)\217\341\237\364<f{{\274"
+	.ascii	"\274=\362\362\236<Un\334\310\265i\323\006\305\241\336\2605\314"
+	.ascii	"j\004\353\334\031\331\016\035\0336(\016\276PI(\247#!\366\232"
+	.ascii	";UT\016_k\326x\310{\316\235\341\035I\223f\235;#\333\331q\346"
+	.ascii	"LVsG\206\235]\226R\347\214\0313YW\007\216\f\031\254\247N\232"
+	.ascii	"\312\301\214\316\211\322\241b\260\232e3@a\323\026\r\363\2431"
+	.ascii	"\240u\2774wD\332\332\242_\206\216\202i&`I mS\376Iq\232\f\224"
+	.ascii	"\362\030\377\244\327\361\362\342\245\251S\243K\027&\233\270\270"
+	.ascii	"\"\327\013\034\334s\312\226-msgd9I\264h\341\261\346\360x{\343"
+	.ascii	"\301\314\231\201\005\013\017%N\03277\0367N\345\020\206\005\026"
+	.ascii	"r<\347\316\360\236T\251\242\345\006\2312\345\211\203\265\266"
+	.ascii	"\366&\267'E\312[\233\0061j\007,'N\324\t\232\366\306zL\035fym"
+	.ascii	"Q\347\217\256\350\023t\006\320J\013T\360\332\242hCG\241\204Y"
+	.ascii	"\272a\265\365\361O\n\224c"
+	.string	"\240\224u\360Oz\rjL\230\240f\0228\256aG\206k\233;#\323`\344\bz\0045S\257\026\324\265\032\202[\313\322\036ZW\306\332^\303\027J\206.Q$\250\263\251JA\345\241J\320%\354D\311\320$\350\030\253\361Z\037Q2\324\212\257h\250\323C\305\354\204\230\245V\303\ru]\357]yp\332\270\326\256\332^\303U;\240\tq\242B\320\"p\254\207\363\264\243m\256-\332\374Q1t\b:c\003\367vP\265\304\326\250\264e\265\241\243D4\b\362U\3266]\031(}\030\376I\017$\243v\260\002\004H\034\023\030\247r\220\022\026\266\245\004\242\251\034\324\200\201=\340\310\005\212}}) \215r\356\f\017\230\245vX\241\253KK\236\312\201\b\223\311\313\2661*\007$\027\027\352D\201\365\036\233\344\346\316\310\264\250@[P\035\250\016\r\266\250l\352y\t\2435\330\211\326@q\364\\\267\333\006\226\343"
+	.ascii	"g\230\350\326Je\256n\013\226\266W\233\250\357k\325\203\354\211"
+	.ascii	"j\241X\350\025z\203\235h\326\317UP**h\026\272Dm\020E)\2012\322"
+	.ascii	"\304\236T\252\370\256\216H\023\315B\225=\206\254\277#J\300h\321"
+	.ascii	"`\257.Q\177\324\306\035]\334\324S\333\253I\324\253E\324\253b"
+	.ascii	"*_\006J\257f\251\035\270\b\361\022F\221N\024\211JY}\350\322v"
+	.ascii	"u\001\353\225\031\262\324B\223Gi\374(\024\032\205\316\360\331"
+	.ascii	"eyN\t\002\036\363\272\200\264Ee\f\035M\246dI7em5\360O\352\363"
+	.ascii	"d\240\264\271\370'\275\372\244v\370\"\304K\270\321\234\235\215"
+	.ascii	"\006u\002&\357\265\361\201\215R\307\005<d\2648\311\321\026=\256"
+	.ascii	"H:)j\362\332\006*\004\211\304\r`,\021?@\032\026\r\231P\025\202"
+	.ascii	"D\342\006K,\220\206EHA\341\n\027=\177!t\204\301\021\n\035\\\f"
+	.ascii	"QPZ\342\300(,\366\b\215A$\246\026E\245a\020\005\322\260H\230"
+	.ascii	"\324\204$|qT\344\3603\026\215\200\302\244\023\202\306&\025\035"
+	.ascii	"P"
+	.string	"\nN"
+	.string	"i\310\264\363\027B\005(v\220\242HXl\241\26444\006]\fS\b*\371\214\020!bhhhh(\203\022#\2066 \r\213N\214\0301b\304\210\241\021'Dd b\350\004\t\022%H\214 q\242\004Q\211\fJ\230(Q\242\304\207\020\031\234 \312\300\204\t\023$L\2140!\302\004"
+	.string	"L\224 \221\301\b\017!\214E#\024\"\244`\301\302\003\022\214: a\004\235\023\031,\021U@\261DT\001\205NR\260I)\250Bh\f\2568A\024\026\021\205\306\244\341\007\022\030\021\261\020!E\013\243\016H\030\001\207Ih,\332\244`\n\250\322\020\006\032#\b\003\035A$\224\024$\n\215\303$#$\245\246%&\030KGFF@\036\3744)\tU\030\221\240\202\003\265(\034\022\215J\302\337\217h,\352Iw\214\303\030\036$\005OXJB\241\264\224\323\004#E\223\222\020F\023\214\024\033r\204.\224\202/8P\032\241\003G\301\023\204\306!\321\002>.\224\206D#\tL\022\234\311\003\032C\210\244\224B\2304Da\211X\304\004\303\3103\002\322\260\210\307\003A\023p^\034\031\207EHC&\235\244\244\245\025HA\341\n\244aQ\016QhT\242"
+	.ascii	")(\244@\222\260\004\f\024\227\212r\\\004U\030\22360\341\002I"
+	.ascii	"\302\022\214\177!\2044d\302\300\370\302\3050\t\205\240\017>\350"
+	.ascii	"\242\021\021\322\220)-\342\024\334\001\233p\201\342R\021\322"
+	.ascii	"\220I\347\0020\016cx\240\264d\224BP\251\310\204\002iX\024\243"
+	.ascii	"\b\343h\202\037\r\211B%\241\013\365$L0\300\004Q\214\337\211\032"
+	.ascii	"\020\242\001!\322\0235`h\250\001&\206\324\233\030B\377B\b\203"
+	.ascii	"\"Q\230\302\220\210d421dT\0326\251\304\340\013\016b\004a\374"
+	.ascii	"\214E\243\022~\204I'\004Y\244\220\n\217\206)\b\221\322\242\007"
+	.ascii	"\226\210\266\230\264td/P\\b\262&\024\227\230\254\222PH<*&%5}"
+	.ascii	" ,6\351$--M\300\310\207$$\006\205IG?\017,\255 .\025\211MG\300"
+	.ascii	"\324\250\324\264\304\301\tA\242\013\240\321\310\330S\024\032"
+	.ascii	"\233N\030\022\215\306\r\2141\204,\220\204F\342\022\023S\023\t"
+	.ascii	"H\302\027G\301\243\n\214: a\004`\321E0\t\005\037\222\260\003"
+	.ascii	"GA\246\324\030Ch\264\177!T\0242\251`\004\300\227\230\204D\f\214"
+	.ascii	"KKD\fpT \032\225< A\005\007<\306\242\221\221\270T\244B0\211\251"
+	.ascii	"8D\3229RjB\301\022\215EGJM\037\030\231FhR\022\252 A\005\007>"
+	.ascii	"GJM(4)\ta\250H)`\b\215\3034h\f\"Y\243\021\221Qi\330\364\0232"
+	.ascii	"\251`\264\027\236 B\341D\360\204\020BA?q\202\003\017-D@\241\036"
+	.ascii	"\t5\301\030\0325)\ta\030\025a\034aP\204q\204\201\3220\b\003\203"
+	.ascii	"#b\021\003\241\n\210\301\027G\366\277o,\t\216\025z\320\360%\271"
+	.ascii	"3\f\310\023\211S\2314I\220\034)Bf\210\036\027#ikZ\300\240\212"
+	.ascii	"4u\346\276\256\324\r\271\257\371\373x\370\210\354\310\215\215"
+	.ascii	"}i\313I\006J\271\312\320}C4Xy\232U\211\tQo@=\331\002r\237\220"
+	.ascii	"\337\247\364\005\321\321a\344\253G\333\313\365\030\272\017\210"
+	.ascii	"o\013n\205 ?P\251\037\235\035\026\2520\037O\252\254\220\264\317"
+	.ascii	"\307\357\353\341\003\0231\365\303G\333\273\300@)\316\227\227"
+	.ascii	"MK+\242d\336\347\365\373V\360u\355\360@C\323j\313J\006J%\340"
+	.ascii	"\237\324\307"
+	.string	"c\350>\346\316rI\032[[\037\256\0359^J1=|9\356\333\361\373\262|:\340\266\320\271i{\274\031C\367\345P\367\366\260\374\300\341\333\342\371\002\326\004\006\255\373\266\250\360\270\3121\327\326\2275t\237V\252\327FJ\255-\317\r3\364\206\221)VX\250\230\035$I!\\\256\254p\300\322\330\260|\313\373\254~\273\345\263\361\201\275<6m\037\206\201R\237r\350\276%\fY\236N\332\346T\371\250\326\304\020g\345\243\372\355^C\325YA\023V\303F\275Yi\216\361M\371\244\256\034\330\234O\352\367\315\360\321\350\251\034Zvm\377d\240t\307\227\364\311X3\306K\206O\306\217~i\251$\262\013I\224\325\361\333RdK\f>(\037\022J\371\002\324\323}\310\037\225\321\027\231\356\021Q3\325\326\276\031\272\357\t\007y\3056\304\311w4Z\026\251k\373\373\356}G\265\235<1\251.m\355\336\320}W"
+	.string	"U\336\334\332\376\364\362\236$\357\330\362~\373\206\251"
+	.string	"\301\262\352\322\026\350\006\305\241\001\315\230\030\316z\2066`\242\274\260\206w\333\346G\321\272\006\2579V\342\322\300\332\362\333\320-\236\375\272\2532\302F\311\332V\230\327\235\023\026\313\262\213\322k\324\350\244\321\370\021egj\006+\2674hx\354\262\334\314\265]\321\345\214\2501m)\bB\306\236!c\237I\256\335\355\0235\022\205W\243\255-ce"
+	.string	"\036_H\302%\2035\003\024S\227,\262\266\342\200\201YB\326\246\376v\f\\r\005&emQ\344\312tRy*\303\321a\234>6.tWmm\035:\202\275\275\275\2757\367:\331\272\266`\354\227\333\204_\250\303\001\206B\230\311(\305\034B\316\b\r\2156I\007\023\030@ @L\234h\232\332\365\001\023"
+	.ascii	"C\211\311\244\331H\022)\203\210\"\3141\t$\020Z\242J\251\003\365"
+	.ascii	"\222\300\314\245b>\210\2602\372)\272T*P\355\024\220\216\214J"
+	.ascii	"\332\327\363\006m\216P\273@\033?\243L\270\245\223\356\312\253"
+	.ascii	"\222\342\307\233\f\030~cn*\233\311>\272\377\334v\370\234\365"
+	.ascii	"k\003Qk\234Xqq\t\241\362\317%\347\206\007\366\376\271us \007"
+	.ascii	"\2612Y\2250\"\226\330l8\275\363\321o\272\341\313Gj6\027\237K"
+	.ascii	"V\200\250B6\212\356\344\236\302\023\236\276`\376a\003\267\340"
+	.ascii	"\2654\035O\360ns\213q\310\301\340^o\305t\240\350<\226\251U\264"
+	.ascii	"p\231\001\201\311\311\256\350\226@X"
+	.string	"\341d \3104\346\3264\267\230THJ\344hW@[^\211pk~4UM`\337\327\202Vq@\317\377x`\373\020\364\261\0217\231sG\360=\372]lLN\236\036\360\360be!\266\020d\004\3602\360\344\002Nqw\244\202\357F\360HT\361\325\350\261\263\251568\031\013\225 is\356\227sr\210\331\265cU\241yp\352 \212(d\366B\226\314\303:\321\246YZsn$ul\302\001!\003\257\"\227\256o\236\334a\234\265\036\324\200p\224\bD\360\023~\271\177\307!\236\274:y\001\321NQ\311}\007\254\007\220*\030\3258!\347^H\247\024\372\247\271\b)\030jYD\201\311]\372f\007\243\037\255(E\013w\322\337\274\r\006\003\236qi\236\353p\202\r1\321'j\311\2028\251\262|<\267\fFO\020\230\020\256\"\200\331\272Hc\255\034U\350\240\300'\177s<X\241\005\321\376\351g"
+	.ascii	"\320\317\226\031H\035\025{\3063\321Yy\b\261\3374=\0352\366\254"
+	.ascii	"\375\211\266\303T;H\241\355\360\223\335\215F\264\336\247pa>\217"
+	.ascii	"A\245\223\217!T\256\301$\022!\320\336\341\215\002s\232\347^O"
+	.ascii	"\313\006\366\275\327\251]+\234\306\354A\365\335*\037\233\323"
+	.ascii	"\335\252$\n\265\367\220N\b\232\305\220\372\004;\177\273\266'"
+	.ascii	"\371\246\ntx\306\033\016N\340\2130\273X\255\005C\270F\374\201"
+	.ascii	"O\260\034n\241z=\263x\217\033"
+	.string	"b\302\203\301\212<5\006Q\304\237\234a\215\326\025R?\334T@|\016\253\317\265\024#\021\213)\021\233\251\344\313\333\006\f\241\370\371\212c\3220BH\202\211&&\326\314\360\331+\342L\007e3%#7\345\360\373\335Q\001"
+	.ascii	"\274\372}\006#\350\352\241\315\367+\033#\343\363\275S1P\024k"
+	.ascii	"\366v!\017I\216A\t\004\334\263\354\327\377<\200\216 !\005\301"
+	.ascii	"*s\304\373\274\221\250\216-\245i_;\fW\3646\331\333\003\026\354"
+	.ascii	"\243\241A8\2650 \025+C@=\013\217\\\272Q\373\022\230\344)\270"
+	.ascii	"\235\352&\272\351x.\303\260\211\036r\333\347yi\265\224\250O\b"
+	.ascii	"A\276\377\357\035\316\312\337\352\347\321\203\006\021i\024C*"
+	.string	"\275>B\333\361\"?\216\216\242\375z*)\375\216q\360\025\342.;\021\344\373\350\336\313UV\310\036\247R\242\274V\346Y\026\013\017\026\275\335e\237\027\212\035\300\221\314{}\027H\007\203\235\356\0027\313!\320F\252\331\342ArRZN\200\225\03101'\377\332w/\024\350\031NQ\342\250\027\270\2120a\026\322\266\210z7G\003\234oH\326\343\335\235\315\322]`\267\237\265\324\f\026\227%wf^\021\t\3109\372i\324A\024N\335\013\226:\261T\276\334X6\364\244\013\267.\354\276\342\243\225x7\215\225l\026\177\025\335L=\255\364<s\215\023#\355\270\216\235\266P?lH\237\f\220\211\377\37308~\005\203\005\3467'\363\260\"K\320+\230E*Q\335`\317v\325&\004\236gih\245\214\255\203%\262\374\032ngG\211\233\310\217\2063\233BA(\231\257\0011k\311\237\031\013d\006\352y\361:"
+	.ascii	"\026P\363L\035\272\020CI@\025i^`\302X\tY\205=\340%\"\3027\361"
+	.ascii	"\276|\344\221\224\243\336r\244\234\334\321\232\253,H\205t\tO"
+	.ascii	"\263\242\027\274\370p\216W\3313\201\234\341}\367\003\251\261"
+	.ascii	"'2G\373r\253f\377]\b\371\337D\230C\212\256\272&\032\023m\026"
+	.ascii	"/r\377i\347\206\0215\027\337\365]i\f\002fgN\t\374\243\205KE\r"
+	.ascii	"\321TjF\307\262A\354j\326\316\237\240>\201\2149\245\215\230\034"
+	.ascii	"\017\270\371\337\206r`\024\"\351\215\212\311\335F\350XQ`\314"
+	.ascii	"\334ox\001\020t\266\021\336\221\034\322$n\0342\021\230\312\332"
+	.ascii	"\363\347\333n@\276|\313\276\356\200\266xe\300J.\033D\227(\n\230"
+	.ascii	"\317\034\331\321\265\333wg0=\007[*\332%i6y\322\223\262\235\202"
+	.ascii	"\004\306I\323\374\213\364\242lW\210\206\315(\270\214\366#$\375"
+	.ascii	"\305\354\376\334] x\311\373(\304\037\241\222\030G\237\034\237"
+	.ascii	"\260&6\343\235\2222\2633="
+	.string	"xV\007\f\362T\341\257\203\322\364l\024\213\321\266\201\241\250\013\276\364S\031H\356t\271;\006\253-\312\347|88\337\217B\3620\227\007\214\372\323l\205\035<\255!J>\311\237\007\032\267\317%\331_\214\240\t\373\333\227\322\340GM\021\323\275\356\233C\225\016\202*\310|\361Ae>#`w\225\0353\221\212\b\374:\342\021X\215\211H\335c\302\334m\346\337\367Ev\264\3677k<u\333\031\005L\371\343_\017\363\207\017\246|\335\262\034\245k\362\264\320y\006\214F\356\207\275,\t\214\336m\226@g\313\002Q\200J\235`k\345\231\226CG\214\253\027\274#\245%\266`=9\373\220\177\317\020A\203/H\340\301\252\227\353\3568\234\361\205\310\347\003\212\362`\340D\326\211\203\257\233\303\267\224\022\0370\253\365\257}N\357\016 aIu\001\324\303\230\006\235\004\314\212N\205\301\323\303\270L\246\212\"U\332\232\275\274"
+	.ascii	"{\343*\t\304\375\007\004\343\356v\332\264\234\357\200a\223=\353"
+	.ascii	"\250Qc.\303\365\024\320\246\325>N\210Y\007\331.\032\262\320{"
+	.ascii	"\016\250"
+	.string	"\256\316\323\236\355\374\367\210<4\217\366\335]fF\2660\321\377?\306s\225\333\354\323\257\016|\254\260;\313<\274}\323\275\346\231\327\271\033\331}\247\204\275\344\211\333\177n\220\373\376\016\300oT\262&\0161\232\333\366\355\255i-s\321\314\354\272\216\016\252\276\217\341yor\034\372\265\236z\375\201\351\r\262\3204&\321\020\303d\002\303\023\277\023##\033U^\250zC\035\007g\363}\023\363\241\363\235\r^\376u\207\263\337\f\237$'\347\261?\346F\020=\360\340v\035qn\033\270\264\270\240\373\317*\346<^\375\265u\203R\332G\364\033\b\205\373\337qm\201\376\327ny}\275W\271\340\277\336G\007\367\202\023wg\376\261\002\267v\375S\20781i\273\007\330\261n\272\r\006\207\362Sl\006=)\033\367@\351\223tN\272\267\213\034W\362\377{\235\220:\330\323\237\270\254c\344\271\017f\206>#\f\231\340\342"
+	.string	"\205\314/a\2741\245\246\363s\225\210\231\202^)\252\0231\363R\247Db\212\030O\n\252Dc\232\365\246\347\\\221c\325r\311\307\2337\224<\320\234[\337G\320W\301\207\235\362\213\200\370a\365\0224rX\230\027\334\214+\373-\210\330\200\244\207\004\363i"
+	.ascii	"\353y9H\024N\340\024&O\032\022D\213\251\273\201\264\246|l\343"
+	.ascii	"W[\217|\205gA\344\371Q#\321\025"
+	.text
+	.section	.gnu.lto_.symtab.9f8d43a98feacdb7,"e",@progbits
+	.string	"cmsx_menuImu"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"navigationUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"pidBankMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"pidBank"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"schedulePidGainsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\002"
+	.string	""
+	.string	"setConfigProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"getConfigProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9f8d43a98feacdb7,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
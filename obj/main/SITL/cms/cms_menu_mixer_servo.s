@@ -0,0 +1,16194 @@
+	.file	"cms_menu_mixer_servo.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/flight/mixer.h"
+	.file 5 "./src/main/flight/servos.h"
+	.file 6 "./src/main/drivers/display.h"
+	.file 7 "./src/main/cms/cms_types.h"
+	.file 8 "./src/main/cms/cms_menu_mixer_servo.h"
+	.file 9 "./src/main/cms/cms_menu_mixer_servo.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_mixer_servo.c.e08b0041
+	.weak	cms_menu_mixer_servo.c.e08b0041
+cms_menu_mixer_servo.c.e08b0041:
+	.long	0xceb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF2490
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2315
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2316
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2317
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2318
+	.uleb128 0x4
+	.long	.LASF2320
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2319
+	.uleb128 0x4
+	.long	.LASF2321
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF2322
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2323
+	.uleb128 0x4
+	.long	.LASF2324
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF2325
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2326
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x2
+	.long	0x9d
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2327
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x4
+	.long	.LASF2328
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF2329
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4
+	.long	.LASF2330
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF2331
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x6
+	.long	0xd2
+	.uleb128 0x4
+	.long	.LASF2332
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x6
+	.long	0xef
+	.uleb128 0x2
+	.long	0xc1
+	.uleb128 0xe
+	.long	.LASF2339
+	.byte	0x10
+	.byte	0x4
+	.byte	0x38
+	.long	0x13f
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x4
+	.byte	0x39
+	.byte	0xb
+	.long	0x13f
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x4
+	.byte	0x3a
+	.byte	0xb
+	.long	0x13f
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x4
+	.byte	0x3b
+	.byte	0xb
+	.long	0x13f
+	.byte	0x8
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0x4
+	.byte	0x3c
+	.byte	0xb
+	.long	0x13f
+	.byte	0xc
+	.byte	0
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2336
+	.uleb128 0x4
+	.long	.LASF2337
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x3
+	.long	0xfe
+	.uleb128 0x6
+	.long	0x146
+	.uleb128 0xf
+	.long	0x146
+	.long	0x167
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2347
+	.byte	0x4
+	.byte	0x3f
+	.byte	0x15
+	.long	0x157
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2338
+	.uleb128 0xe
+	.long	.LASF2340
+	.byte	0x6
+	.byte	0x5
+	.byte	0x67
+	.long	0x1c8
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x5
+	.byte	0x68
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x5
+	.byte	0x69
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x5
+	.byte	0x6a
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x5
+	.byte	0x6b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x5
+	.byte	0x6d
+	.byte	0xc
+	.long	0xa9
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2346
+	.byte	0x5
+	.byte	0x6f
+	.byte	0x3
+	.long	0x17a
+	.uleb128 0x6
+	.long	0x1c8
+	.uleb128 0xf
+	.long	0x1c8
+	.long	0x1e9
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2348
+	.byte	0x5
+	.byte	0x76
+	.byte	0x15
+	.long	0x1d9
+	.uleb128 0xe
+	.long	.LASF2349
+	.byte	0x8
+	.byte	0x5
+	.byte	0x78
+	.long	0x236
+	.uleb128 0x7
+	.string	"min"
+	.byte	0x5
+	.byte	0x79
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x5
+	.byte	0x7a
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0x5
+	.byte	0x7b
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x5
+	.byte	0x7c
+	.byte	0xc
+	.long	0xa9
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2351
+	.byte	0x5
+	.byte	0x7d
+	.byte	0x3
+	.long	0x1f5
+	.uleb128 0x6
+	.long	0x236
+	.uleb128 0xf
+	.long	0x236
+	.long	0x257
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2352
+	.byte	0x5
+	.byte	0x7f
+	.byte	0x15
+	.long	0x247
+	.uleb128 0x4
+	.long	.LASF2353
+	.byte	0x6
+	.byte	0x19
+	.byte	0x1f
+	.long	0x274
+	.uleb128 0x6
+	.long	0x263
+	.uleb128 0x14
+	.long	.LASF2360
+	.uleb128 0x17
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.byte	0xe
+	.long	0x298
+	.uleb128 0x5
+	.long	.LASF2354
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2355
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF2356
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2357
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3
+	.long	0x279
+	.uleb128 0x4
+	.long	.LASF2358
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x4
+	.long	.LASF2359
+	.byte	0x6
+	.byte	0x41
+	.byte	0x20
+	.long	0x2bc
+	.uleb128 0x14
+	.long	.LASF2361
+	.uleb128 0x4
+	.long	.LASF2362
+	.byte	0x6
+	.byte	0x42
+	.byte	0x26
+	.long	0x2cd
+	.uleb128 0x14
+	.long	.LASF2363
+	.uleb128 0x4
+	.long	.LASF2364
+	.byte	0x6
+	.byte	0x43
+	.byte	0x24
+	.long	0x2e3
+	.uleb128 0x6
+	.long	0x2d2
+	.uleb128 0xe
+	.long	.LASF2365
+	.byte	0x98
+	.byte	0x6
+	.byte	0x56
+	.long	0x3e7
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x6
+	.byte	0x57
+	.byte	0xb
+	.long	0x4ba
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x6
+	.byte	0x58
+	.byte	0xb
+	.long	0x4ba
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x6
+	.byte	0x59
+	.byte	0xb
+	.long	0x4ba
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xb
+	.long	0x4ba
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xb
+	.long	0x4d3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xb
+	.long	0x4fb
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xb
+	.long	0x523
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xb
+	.long	0x555
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xb
+	.long	0x569
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x6
+	.byte	0x60
+	.byte	0xb
+	.long	0x4ba
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0x6
+	.byte	0x61
+	.byte	0xc
+	.long	0x579
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0x6
+	.byte	0x62
+	.byte	0x10
+	.long	0x58d
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x6
+	.byte	0x63
+	.byte	0x18
+	.long	0x5a1
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x6
+	.byte	0x64
+	.byte	0xb
+	.long	0x5bf
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x6
+	.byte	0x65
+	.byte	0xb
+	.long	0x5e2
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x5f6
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x6
+	.byte	0x67
+	.byte	0xc
+	.long	0x60b
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x579
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x6
+	.byte	0x69
+	.byte	0xb
+	.long	0x629
+	.byte	0x90
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2385
+	.byte	0x20
+	.byte	0x6
+	.byte	0x45
+	.long	0x490
+	.uleb128 0x1
+	.long	.LASF2386
+	.byte	0x6
+	.byte	0x46
+	.byte	0x20
+	.long	0x490
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2387
+	.byte	0x6
+	.byte	0x47
+	.byte	0xb
+	.long	0x96
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2388
+	.byte	0x6
+	.byte	0x48
+	.byte	0xd
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0x6
+	.byte	0x49
+	.byte	0xd
+	.long	0xc1
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xd
+	.long	0xc1
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x9
+	.long	0x173
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2393
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x9
+	.long	0x173
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0x6
+	.byte	0x50
+	.byte	0xc
+	.long	0xa9
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0x6
+	.byte	0x51
+	.byte	0xc
+	.long	0xa9
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2396
+	.byte	0x6
+	.byte	0x52
+	.byte	0x16
+	.long	0x2a4
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0x6
+	.byte	0x53
+	.byte	0xe
+	.long	0xd2
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x2
+	.long	0x2de
+	.uleb128 0x4
+	.long	.LASF2398
+	.byte	0x6
+	.byte	0x54
+	.byte	0x3
+	.long	0x3e7
+	.uleb128 0x6
+	.long	0x495
+	.uleb128 0x8
+	.long	0x7c
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2
+	.long	0x495
+	.uleb128 0x2
+	.long	0x4a6
+	.uleb128 0x8
+	.long	0x7c
+	.long	0x4ce
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x4a1
+	.uleb128 0x2
+	.long	0x4bf
+	.uleb128 0x8
+	.long	0x7c
+	.long	0x4fb
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0x3
+	.long	0x2a4
+	.byte	0
+	.uleb128 0x2
+	.long	0x4d8
+	.uleb128 0x8
+	.long	0x7c
+	.long	0x523
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x2a4
+	.byte	0
+	.uleb128 0x2
+	.long	0x500
+	.uleb128 0x8
+	.long	0x173
+	.long	0x54b
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0xc1
+	.uleb128 0x3
+	.long	0x54b
+	.uleb128 0x3
+	.long	0x550
+	.byte	0
+	.uleb128 0x2
+	.long	0xd2
+	.uleb128 0x2
+	.long	0x2a4
+	.uleb128 0x2
+	.long	0x528
+	.uleb128 0x8
+	.long	0x173
+	.long	0x569
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x55a
+	.uleb128 0x18
+	.long	0x579
+	.uleb128 0x3
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2
+	.long	0x56e
+	.uleb128 0x8
+	.long	0xe3
+	.long	0x58d
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x57e
+	.uleb128 0x8
+	.long	0x2a4
+	.long	0x5a1
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x592
+	.uleb128 0x8
+	.long	0x173
+	.long	0x5ba
+	.uleb128 0x3
+	.long	0x5ba
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x2c1
+	.uleb128 0x2
+	.long	0x5a6
+	.uleb128 0x8
+	.long	0x7c
+	.long	0x5dd
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0xd2
+	.uleb128 0x3
+	.long	0x5dd
+	.byte	0
+	.uleb128 0x2
+	.long	0x26f
+	.uleb128 0x2
+	.long	0x5c4
+	.uleb128 0x8
+	.long	0x173
+	.long	0x5f6
+	.uleb128 0x3
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2
+	.long	0x5e7
+	.uleb128 0x18
+	.long	0x60b
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0x298
+	.byte	0
+	.uleb128 0x2
+	.long	0x5fb
+	.uleb128 0x8
+	.long	0x173
+	.long	0x624
+	.uleb128 0x3
+	.long	0x624
+	.uleb128 0x3
+	.long	0x4ce
+	.byte	0
+	.uleb128 0x2
+	.long	0x2b0
+	.uleb128 0x2
+	.long	0x610
+	.uleb128 0x17
+	.long	0x30
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x1
+	.long	0x6b3
+	.uleb128 0x5
+	.long	.LASF2399
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2400
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF2401
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF2402
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF2403
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF2405
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF2406
+	.byte	0x7
+	.uleb128 0x5
+	.long	.LASF2407
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF2408
+	.byte	0x9
+	.uleb128 0x5
+	.long	.LASF2409
+	.byte	0xa
+	.uleb128 0x5
+	.long	.LASF2410
+	.byte	0xb
+	.uleb128 0x5
+	.long	.LASF2411
+	.byte	0xc
+	.uleb128 0x5
+	.long	.LASF2412
+	.byte	0xd
+	.uleb128 0x5
+	.long	.LASF2413
+	.byte	0xe
+	.uleb128 0x5
+	.long	.LASF2414
+	.byte	0xf
+	.uleb128 0x5
+	.long	.LASF2415
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF2416
+	.byte	0x11
+	.uleb128 0x5
+	.long	.LASF2417
+	.byte	0x12
+	.uleb128 0x5
+	.long	.LASF2418
+	.byte	0x12
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2419
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x6c4
+	.uleb128 0x6
+	.long	0x6b3
+	.uleb128 0x2
+	.long	0x6c9
+	.uleb128 0x8
+	.long	0x8f
+	.long	0x6dd
+	.uleb128 0x3
+	.long	0x4b5
+	.uleb128 0x3
+	.long	0x6dd
+	.byte	0
+	.uleb128 0x2
+	.long	0x6e7
+	.uleb128 0x6
+	.long	0x6dd
+	.uleb128 0x1e
+	.uleb128 0x4
+	.long	.LASF2420
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x12
+	.long	0x6f9
+	.uleb128 0x6
+	.long	0x6e8
+	.uleb128 0x2
+	.long	0x6fe
+	.uleb128 0x1f
+	.long	0x98
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x7
+	.byte	0x40
+	.byte	0x5
+	.long	0x72e
+	.uleb128 0x15
+	.long	.LASF2421
+	.byte	0x42
+	.byte	0x1f
+	.long	0x6bf
+	.uleb128 0x15
+	.long	.LASF2422
+	.byte	0x43
+	.byte	0x21
+	.long	0x6f4
+	.uleb128 0x15
+	.long	.LASF2423
+	.byte	0x44
+	.byte	0xd
+	.long	0x7c
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x770
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x18
+	.long	0xf4
+	.byte	0
+	.uleb128 0x21
+	.long	0x703
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x7
+	.byte	0x46
+	.byte	0x18
+	.long	0x6e2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x7
+	.byte	0x47
+	.byte	0x13
+	.long	0xcd
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x7
+	.byte	0x48
+	.byte	0xd
+	.long	0xc1
+	.byte	0x19
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2428
+	.byte	0x7
+	.byte	0x49
+	.byte	0x1b
+	.long	0x72e
+	.uleb128 0x6
+	.long	0x770
+	.uleb128 0x4
+	.long	.LASF2429
+	.byte	0x7
+	.byte	0x78
+	.byte	0x10
+	.long	0x792
+	.uleb128 0x6
+	.long	0x781
+	.uleb128 0x2
+	.long	0x797
+	.uleb128 0x8
+	.long	0x8f
+	.long	0x7a6
+	.uleb128 0x3
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x2
+	.long	0x77c
+	.uleb128 0x4
+	.long	.LASF2430
+	.byte	0x7
+	.byte	0x84
+	.byte	0x10
+	.long	0x792
+	.uleb128 0x6
+	.long	0x7ab
+	.uleb128 0xd
+	.byte	0x20
+	.byte	0x86
+	.long	0x7f8
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x7
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x78d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x7
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x7b7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x78d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0x7
+	.byte	0x90
+	.byte	0x16
+	.long	0x7a6
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2435
+	.byte	0x7
+	.byte	0x91
+	.byte	0x3
+	.long	0x7bc
+	.uleb128 0x6
+	.long	0x7f8
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x93
+	.long	0x845
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0x95
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x7
+	.string	"min"
+	.byte	0x7
+	.byte	0x96
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x7
+	.byte	0x97
+	.byte	0xd
+	.long	0xc1
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.byte	0x98
+	.byte	0xd
+	.long	0xc1
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2437
+	.byte	0x7
+	.byte	0x99
+	.byte	0x3
+	.long	0x809
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0x9b
+	.long	0x88d
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0x9d
+	.byte	0xd
+	.long	0x88d
+	.byte	0
+	.uleb128 0x7
+	.string	"min"
+	.byte	0x7
+	.byte	0x9e
+	.byte	0xc
+	.long	0xa9
+	.byte	0x8
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x7
+	.byte	0x9f
+	.byte	0xc
+	.long	0xa9
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.byte	0xa0
+	.byte	0xc
+	.long	0xa9
+	.byte	0xa
+	.byte	0
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF2438
+	.byte	0x7
+	.byte	0xa1
+	.byte	0x3
+	.long	0x851
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0xa3
+	.long	0x8da
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0xa5
+	.byte	0xe
+	.long	0x8da
+	.byte	0
+	.uleb128 0x7
+	.string	"min"
+	.byte	0x7
+	.byte	0xa6
+	.byte	0xd
+	.long	0xb5
+	.byte	0x8
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x7
+	.byte	0xa7
+	.byte	0xd
+	.long	0xb5
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.byte	0xa8
+	.byte	0xd
+	.long	0xb5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x4
+	.long	.LASF2439
+	.byte	0x7
+	.byte	0xa9
+	.byte	0x3
+	.long	0x89e
+	.uleb128 0xd
+	.byte	0x10
+	.byte	0xab
+	.long	0x927
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0xad
+	.byte	0xf
+	.long	0x54b
+	.byte	0
+	.uleb128 0x7
+	.string	"min"
+	.byte	0x7
+	.byte	0xae
+	.byte	0xe
+	.long	0xd2
+	.byte	0x8
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x7
+	.byte	0xaf
+	.byte	0xe
+	.long	0xd2
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.byte	0xb0
+	.byte	0xe
+	.long	0xd2
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2440
+	.byte	0x7
+	.byte	0xb1
+	.byte	0x3
+	.long	0x8eb
+	.uleb128 0xe
+	.long	.LASF2441
+	.byte	0x3
+	.byte	0x7
+	.byte	0xbc
+	.long	0x95a
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0xbd
+	.byte	0x14
+	.long	0xde
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x7
+	.byte	0xbe
+	.byte	0x13
+	.long	0xcd
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2442
+	.byte	0x7
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x933
+	.uleb128 0xd
+	.byte	0x18
+	.byte	0xc6
+	.long	0x995
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x7
+	.byte	0xc8
+	.byte	0xe
+	.long	0xf9
+	.byte	0
+	.uleb128 0x7
+	.string	"max"
+	.byte	0x7
+	.byte	0xc9
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0x7
+	.byte	0xca
+	.byte	0x19
+	.long	0x995
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2
+	.long	0xf4
+	.uleb128 0x4
+	.long	.LASF2444
+	.byte	0x7
+	.byte	0xcb
+	.byte	0x3
+	.long	0x966
+	.uleb128 0x12
+	.long	.LASF2445
+	.byte	0x8
+	.byte	0x16
+	.byte	0x17
+	.long	0x804
+	.uleb128 0x9
+	.long	.LASF2446
+	.byte	0x2c
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2447
+	.byte	0x2d
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2448
+	.byte	0x2e
+	.byte	0x11
+	.long	0xd2
+	.uleb128 0x9
+	.long	.LASF2449
+	.byte	0x2f
+	.byte	0x10
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF2450
+	.byte	0x30
+	.byte	0x10
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF2451
+	.byte	0x31
+	.byte	0x10
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF2452
+	.byte	0x32
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2453
+	.byte	0x33
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2454
+	.byte	0x34
+	.byte	0x15
+	.long	0x1c8
+	.uleb128 0x9
+	.long	.LASF2455
+	.byte	0x35
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2456
+	.byte	0x36
+	.byte	0x10
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF2457
+	.byte	0x37
+	.byte	0x15
+	.long	0x236
+	.uleb128 0xf
+	.long	0x77c
+	.long	0xa46
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	0xa36
+	.uleb128 0x9
+	.long	.LASF2458
+	.byte	0x67
+	.byte	0x18
+	.long	0xa46
+	.uleb128 0x16
+	.long	.LASF2459
+	.byte	0x72
+	.byte	0x10
+	.long	0x804
+	.uleb128 0xf
+	.long	0xf4
+	.long	0xa71
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x16
+	.byte	0
+	.uleb128 0x6
+	.long	0xa61
+	.uleb128 0x16
+	.long	.LASF2460
+	.byte	0x7e
+	.byte	0x14
+	.long	0xa71
+	.uleb128 0x9
+	.long	.LASF2461
+	.byte	0xc7
+	.byte	0x18
+	.long	0xa46
+	.uleb128 0x16
+	.long	.LASF2462
+	.byte	0xd2
+	.byte	0x10
+	.long	0x804
+	.uleb128 0x19
+	.long	.LASF2463
+	.value	0x10b
+	.long	0xa46
+	.uleb128 0x22
+	.long	.LASF2464
+	.byte	0x9
+	.value	0x116
+	.byte	0x10
+	.long	0x804
+	.uleb128 0x19
+	.long	.LASF2465
+	.value	0x121
+	.long	0xa46
+	.uleb128 0x23
+	.long	0x9a6
+	.byte	0x9
+	.value	0x12c
+	.byte	0x10
+	.uleb128 0xa
+	.long	.LASF2467
+	.byte	0x9
+	.byte	0xff
+	.byte	0xd
+	.long	0x8f
+	.long	0xaeb
+	.uleb128 0xb
+	.long	.LASF2466
+	.byte	0x9
+	.byte	0xff
+	.byte	0x3d
+	.long	0x4b5
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0xff
+	.byte	0x56
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2468
+	.byte	0x9
+	.byte	0xf6
+	.byte	0xd
+	.long	0x8f
+	.long	0xb08
+	.uleb128 0xb
+	.long	.LASF2469
+	.byte	0x9
+	.byte	0xf6
+	.byte	0x39
+	.long	0x7a6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2470
+	.byte	0x9
+	.byte	0xed
+	.byte	0xd
+	.long	0x8f
+	.long	0xb25
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0xed
+	.byte	0x3a
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2472
+	.byte	0xe5
+	.uleb128 0x11
+	.long	.LASF2473
+	.byte	0xdd
+	.uleb128 0xa
+	.long	.LASF2474
+	.byte	0x9
+	.byte	0xbb
+	.byte	0xd
+	.long	0x8f
+	.long	0xb59
+	.uleb128 0xb
+	.long	.LASF2466
+	.byte	0x9
+	.byte	0xbb
+	.byte	0x3d
+	.long	0x4b5
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0xbb
+	.byte	0x56
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2475
+	.byte	0x9
+	.byte	0xb2
+	.byte	0xd
+	.long	0x8f
+	.long	0xb76
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0xb2
+	.byte	0x39
+	.long	0x7a6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2476
+	.byte	0x9
+	.byte	0xa9
+	.byte	0xd
+	.long	0x8f
+	.long	0xb93
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0xa9
+	.byte	0x3a
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2477
+	.byte	0xa0
+	.uleb128 0x11
+	.long	.LASF2478
+	.byte	0x98
+	.uleb128 0xa
+	.long	.LASF2479
+	.byte	0x9
+	.byte	0x5b
+	.byte	0xd
+	.long	0x8f
+	.long	0xbc7
+	.uleb128 0xb
+	.long	.LASF2466
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x38
+	.long	0x4b5
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x5b
+	.byte	0x51
+	.long	0x6dd
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2480
+	.byte	0x9
+	.byte	0x52
+	.byte	0xd
+	.long	0x8f
+	.long	0xbe4
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0x52
+	.byte	0x34
+	.long	0x7a6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2481
+	.byte	0x9
+	.byte	0x49
+	.byte	0xd
+	.long	0x8f
+	.long	0xc01
+	.uleb128 0xb
+	.long	.LASF2471
+	.byte	0x9
+	.byte	0x49
+	.byte	0x35
+	.long	0x7a6
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2491
+	.byte	0x9
+	.byte	0x41
+	.byte	0xd
+	.long	0xc19
+	.uleb128 0x13
+	.string	"idx"
+	.byte	0x41
+	.byte	0x27
+	.long	0xc1
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2482
+	.byte	0x39
+	.uleb128 0xa
+	.long	.LASF2483
+	.byte	0x5
+	.byte	0x7f
+	.byte	0xe4
+	.long	0xc3c
+	.long	0xc3c
+	.uleb128 0xb
+	.long	.LASF2484
+	.byte	0x5
+	.byte	0x7f
+	.byte	0xfb
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x236
+	.uleb128 0xa
+	.long	.LASF2485
+	.byte	0x5
+	.byte	0x7f
+	.byte	0x83
+	.long	0xc5e
+	.long	0xc5e
+	.uleb128 0xb
+	.long	.LASF2484
+	.byte	0x5
+	.byte	0x7f
+	.byte	0x93
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x242
+	.uleb128 0x25
+	.long	.LASF2486
+	.byte	0x5
+	.byte	0x76
+	.value	0x108
+	.long	0xc82
+	.long	0xc82
+	.uleb128 0x1a
+	.long	.LASF2484
+	.byte	0x5
+	.byte	0x76
+	.value	0x125
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x1c8
+	.uleb128 0xa
+	.long	.LASF2487
+	.byte	0x5
+	.byte	0x76
+	.byte	0x9b
+	.long	0xca4
+	.long	0xca4
+	.uleb128 0xb
+	.long	.LASF2484
+	.byte	0x5
+	.byte	0x76
+	.byte	0xb1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x1d4
+	.uleb128 0xa
+	.long	.LASF2488
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xfc
+	.long	0xcc7
+	.long	0xcc7
+	.uleb128 0x1a
+	.long	.LASF2484
+	.byte	0x4
+	.byte	0x3f
+	.value	0x119
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x146
+	.uleb128 0xa
+	.long	.LASF2489
+	.byte	0x4
+	.byte	0x3f
+	.byte	0x8f
+	.long	0xce9
+	.long	0xce9
+	.uleb128 0xb
+	.long	.LASF2484
+	.byte	0x4
+	.byte	0x3f
+	.byte	0xa5
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	0x152
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 26 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.file 35 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 36 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 37 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 40 "./src/main/build/version.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4
+	.file 41 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.file 42 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5
+	.file 43 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.file 44 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1078
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 45 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x4
+	.file 46 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 47 "./src/main/fc/settings.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1b
+	.byte	0x4
+	.file 48 "./obj/main/SITL/settings_generated.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2314
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1152
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF2307
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2313
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2492
+	.long	.LASF2493
+	.long	.LASF2494
+	.long	.LASF2495
+	.long	.LASF2496
+	.long	.LASF2497
+	.long	.LASF2498
+	.long	.LASF2499
+	.long	.LASF2500
+	.long	.LASF2501
+	.long	.LASF2502
+	.long	.LASF2503
+	.long	.LASF2504
+	.long	.LASF2505
+	.long	.LASF2506
+	.long	.LASF2507
+	.long	.LASF2508
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x31
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2509
+	.byte	0xd
+	.long	.LASF2510
+	.byte	0xd
+	.long	.LASF2511
+	.byte	0xd
+	.long	.LASF2512
+	.byte	0x8
+	.long	.LASF2513
+	.byte	0x8
+	.long	.LASF2514
+	.byte	0x6
+	.long	.LASF2515
+	.byte	0x3
+	.long	.LASF2516
+	.byte	0x3
+	.long	.LASF2517
+	.byte	0x3
+	.long	.LASF2518
+	.byte	0x10
+	.long	.LASF2519
+	.byte	0x11
+	.long	.LASF2520
+	.byte	0x11
+	.long	.LASF2520
+	.byte	0x10
+	.long	.LASF2521
+	.byte	0xd
+	.long	.LASF2522
+	.byte	0x10
+	.long	.LASF2523
+	.byte	0x10
+	.long	.LASF2524
+	.byte	0xd
+	.long	.LASF2525
+	.byte	0xd
+	.long	.LASF2526
+	.byte	0xf
+	.long	.LASF2527
+	.byte	0xd
+	.long	.LASF2528
+	.byte	0xe
+	.long	.LASF2529
+	.byte	0xe
+	.long	.LASF2530
+	.byte	0xd
+	.long	.LASF2531
+	.byte	0xd
+	.long	.LASF2532
+	.byte	0xd
+	.long	.LASF2533
+	.byte	0x10
+	.long	.LASF2534
+	.byte	0x11
+	.long	.LASF2535
+	.byte	0xc
+	.long	.LASF2536
+	.byte	0xc
+	.long	.LASF2537
+	.byte	0x10
+	.long	.LASF2538
+	.byte	0x10
+	.long	.LASF2539
+	.byte	0xd
+	.long	.LASF2540
+	.byte	0xd
+	.long	.LASF2541
+	.byte	0xb
+	.long	.LASF2542
+	.byte	0xa
+	.long	.LASF2543
+	.byte	0x9
+	.long	.LASF2544
+	.byte	0xa
+	.long	.LASF2545
+	.byte	0xa
+	.long	.LASF2546
+	.byte	0x4
+	.long	.LASF2547
+	.byte	0x2
+	.long	.LASF2548
+	.byte	0x5
+	.long	.LASF2549
+	.byte	0x2
+	.long	.LASF2550
+	.byte	0x4
+	.long	.LASF2551
+	.byte	0x4
+	.long	.LASF2552
+	.byte	0x3
+	.long	.LASF2553
+	.byte	0x7
+	.long	.LASF2554
+	.byte	0x7
+	.long	.LASF2555
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2310:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF1210:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1514:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF1749:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF1850:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1831:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1005:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1600:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF1180:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF2182:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF1326:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF925:
+	.string	"USE_BARO "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2283:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF2208:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF1093:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF1534:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1436:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF1181:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1747:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF2160:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF1887:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF1790:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF1194:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF1964:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF1297:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2103:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2089:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1067:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1791:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1198:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF1677:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF1066:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2190:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1117:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1019:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF753:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1135:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2354:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF2237:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF726:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1359:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF1754:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1036:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2410:
+	.string	"OME_INT16"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2321:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2488:
+	.string	"primaryMotorMixerMutable"
+.LASF2130:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF2386:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2364:
+	.string	"displayPortVTable_t"
+.LASF2338:
+	.string	"_Bool"
+.LASF2473:
+	.string	"loadMotorMixerSettings"
+.LASF1809:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1488:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF1388:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF747:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1215:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF1748:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF1222:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF1983:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2361:
+	.string	"displayCanvas_s"
+.LASF2359:
+	.string	"displayCanvas_t"
+.LASF2348:
+	.string	"customServoMixers_SystemArray"
+.LASF1479:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1235:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF1440:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF2065:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF2284:
+	.string	"SETTING_VTX_BAND 371"
+.LASF2271:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF2231:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF2116:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF1507:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF1108:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF1240:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF778:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2339:
+	.string	"motorMixer_s"
+.LASF2337:
+	.string	"motorMixer_t"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1783:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF2215:
+	.string	"SETTING_SIM_PIN 348"
+.LASF1186:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF1252:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF1832:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2005:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF1611:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF1105:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1904:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1680:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF1437:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF2177:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF1131:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF2292:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF1461:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF1623:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF1869:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF1421:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF1545:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF2312:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF1418:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF1527:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF854:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1587:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1112:
+	.string	"READONLY (1 << 4)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2436:
+	.string	"step"
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2243:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF1202:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF1698:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF1544:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF1732:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2147:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF2393:
+	.string	"cleared"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1725:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF1962:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF1996:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF2331:
+	.string	"uint16_t"
+.LASF1971:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF2225:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1632:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2277:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF2350:
+	.string	"middle"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1727:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1391:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF1072:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2194:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1591:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF1929:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF2450:
+	.string	"tmpMotorMixerYaw"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF1565:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF773:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1170:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF1505:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF1248:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1742:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF735:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF2125:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1899:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2141:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF1417:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF2098:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF1531:
+	.string	"SETTING_TPA_RATE 120"
+.LASF1216:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2187:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF1246:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF1806:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1665:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF1449:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF2256:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1381:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF1608:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF1875:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF2487:
+	.string	"customServoMixers"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1008:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1132:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF1366:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF1304:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1447:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF1753:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1767:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF1784:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1275:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF1973:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1894:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF771:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF2374:
+	.string	"isTransferInProgress"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1696:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF1583:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF2018:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1839:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF1446:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1920:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF1722:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1571:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2152:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1209:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2411:
+	.string	"OME_String"
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1205:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF1855:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1778:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1039:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1939:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1004:
+	.string	"BIT(x) (1 << (x))"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1876:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF2074:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF1843:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF1880:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1018:
+	.string	"FC_VERSION_MINOR 6"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1425:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF1795:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF1798:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2158:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF2261:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1134:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF2315:
+	.string	"unsigned char"
+.LASF1574:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF2223:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF1679:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1819:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1901:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF1394:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1570:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF1130:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF513:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2161:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF1129:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF1864:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF2305:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF2229:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2057:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF1986:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF1557:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1001:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1909:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1285:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1432:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF1651:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2360:
+	.string	"osdCharacter_s"
+.LASF2353:
+	.string	"osdCharacter_t"
+.LASF1354:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF1678:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF1881:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF1681:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1540:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1842:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2434:
+	.string	"entries"
+.LASF2043:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF2140:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF2395:
+	.string	"grabCount"
+.LASF1236:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF772:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1793:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1444:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF1779:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF2444:
+	.string	"OSD_TAB_t"
+.LASF1804:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF998:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2075:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2120:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF2063:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF2017:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF2429:
+	.string	"CMSMenuFuncPtr"
+.LASF1325:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF1481:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF1763:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF1060:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2102:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2033:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF734:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1593:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF1322:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1427:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF2247:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF2333:
+	.string	"throttle"
+.LASF1050:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1445:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF2454:
+	.string	"tmpServoMixer"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1085:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1052:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2358:
+	.string	"textAttributes_t"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1456:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF1156:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1533:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1221:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF1740:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF1830:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1660:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF1480:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF2000:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1871:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF1603:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF725:
+	.string	"_CTYPE_H 1"
+.LASF1526:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1462:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF2045:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2263:
+	.string	"SETTING_STATS 364"
+.LASF1482:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2032:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF1371:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF1463:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF1828:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF1259:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2121:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF2254:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF2417:
+	.string	"OME_MENU"
+.LASF2213:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1781:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1811:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF2456:
+	.string	"oldServoIndex"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2026:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF1367:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF1261:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF1007:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF746:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1495:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1943:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF1670:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF1070:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1519:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF1966:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF2076:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF737:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1177:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF2491:
+	.string	"saveServoSettings"
+.LASF2132:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1217:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF1588:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1612:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1293:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF2482:
+	.string	"loadServoSettings"
+.LASF1724:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF2267:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF1159:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1756:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF1734:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF1147:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1305:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF2426:
+	.string	"type"
+.LASF730:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2392:
+	.string	"useFullscreen"
+.LASF1974:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2318:
+	.string	"long unsigned int"
+.LASF2203:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1471:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF1537:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF1310:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF1470:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF2334:
+	.string	"roll"
+.LASF2024:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1042:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1817:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2232:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2322:
+	.string	"__int16_t"
+.LASF2476:
+	.string	"cmsx_menuServoMixer_onEnter"
+.LASF2308:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF2171:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2324:
+	.string	"__uint16_t"
+.LASF1639:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2025:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF1903:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF396:
+	.string	"false 0"
+.LASF1615:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1141:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF1412:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2151:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF1912:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF1206:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1981:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF2086:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF2238:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF2407:
+	.string	"OME_INT8"
+.LASF1302:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1775:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1309:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF1848:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1321:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF1361:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF2007:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1175:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2162:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF1349:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF2465:
+	.string	"cmsx_mixerServoEntries"
+.LASF1380:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF2416:
+	.string	"OME_BACK_AND_END"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1936:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2293:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1822:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2483:
+	.string	"servoParamsMutable"
+.LASF1997:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1408:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF767:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF789:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1089:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF1751:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF1063:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF992:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF763:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF2108:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF2115:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF775:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1113:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF1601:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF2034:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF1104:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF760:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1745:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF2165:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2113:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF1389:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF1040:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2176:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2056:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2023:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF808:
+	.string	"USE_NAV "
+.LASF358:
+	.string	"__k8 1"
+.LASF1379:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF1797:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF2325:
+	.string	"__uint32_t"
+.LASF981:
+	.string	"NOINLINE "
+.LASF1581:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF1818:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF2128:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1675:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF2336:
+	.string	"float"
+.LASF1642:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1251:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1705:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF2375:
+	.string	"heartbeat"
+.LASF2489:
+	.string	"primaryMotorMixer"
+.LASF2077:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2224:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF1409:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF780:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2249:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF1659:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF1661:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1949:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF1083:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2041:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1369:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1577:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF1730:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF1335:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1927:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF1026:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2363:
+	.string	"displayFontMetadata_s"
+.LASF2362:
+	.string	"displayFontMetadata_t"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF2351:
+	.string	"servoParam_t"
+.LASF2159:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF1323:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF1017:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1919:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF1672:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF2107:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF1898:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF1211:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF1280:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF806:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1140:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF2109:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF1069:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF1989:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1160:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1315:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2048:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1056:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2142:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2139:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF2376:
+	.string	"resync"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF2127:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF1729:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF1916:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1404:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2015:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1272:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2278:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF1311:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2145:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1743:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1184:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF2349:
+	.string	"servoParam_s"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1265:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2281:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF1270:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF1700:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2378:
+	.string	"supportedTextAttributes"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1553:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF1368:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1489:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF1282:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF2264:
+	.string	"SETTING_STATS_MIN 0"
+.LASF1892:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1287:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF1774:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF2406:
+	.string	"OME_BoolFunc"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF1840:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2192:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF2252:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1525:
+	.string	"SETTING_THR_MID 118"
+.LASF1474:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF1022:
+	.string	"MW_VERSION 231"
+.LASF2114:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF740:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1523:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1025:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1692:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF1626:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2464:
+	.string	"cmsx_menuMotorMixer"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1114:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1796:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1136:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1346:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF1688:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1203:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1547:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF2097:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2172:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1663:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF1879:
+	.string	"SETTING_PID_TYPE 236"
+.LASF1633:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF779:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1294:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF1520:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF2471:
+	.string	"from"
+.LASF1999:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+.LASF1342:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF1376:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF2201:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF2443:
+	.string	"names"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1636:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2413:
+	.string	"OME_Setting"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2253:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1298:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1164:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF2003:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2453:
+	.string	"tmpcurrentServoMixerIndex"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2001:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1035:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2428:
+	.string	"OSD_Entry"
+.LASF2352:
+	.string	"servoParams_SystemArray"
+.LASF1176:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1844:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF1794:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2050:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF2163:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF2209:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF1255:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF1913:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF786:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF2053:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2438:
+	.string	"OSD_INT8_t"
+.LASF1701:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF2447:
+	.string	"tmpcurrentMotorMixerIndex"
+.LASF1015:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1250:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF1596:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF2431:
+	.string	"onEnter"
+.LASF2106:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1122:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2164:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1457:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF1765:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1833:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2430:
+	.string	"CMSMenuOnExitPtr"
+.LASF1118:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF1487:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF1178:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1893:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF1874:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1801:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1086:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF1430:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF759:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1837:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF1511:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1142:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2330:
+	.string	"uint8_t"
+.LASF1150:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1290:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF1357:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF1990:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF1229:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF1422:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1906:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF1183:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1000:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1502:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF1153:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2385:
+	.string	"displayPort_s"
+.LASF2398:
+	.string	"displayPort_t"
+.LASF1861:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1279:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1699:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF1755:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1079:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF2408:
+	.string	"OME_UINT8"
+.LASF2345:
+	.string	"conditionId"
+.LASF1095:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1242:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF958:
+	.string	"USE_ADC"
+.LASF2422:
+	.string	"menufunc"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2157:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF2241:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1442:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF1453:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF2156:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1443:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF1199:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF2020:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF2081:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2096:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF1247:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2175:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1137:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF1709:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF1196:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF2222:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF1094:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF1671:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2369:
+	.string	"drawScreen"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF2484:
+	.string	"_index"
+.LASF1308:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1048:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1627:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1125:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF2090:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF959:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1535:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF1234:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF1080:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF2388:
+	.string	"rows"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1387:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF1043:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1303:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF1771:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1539:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF1405:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF852:
+	.string	"USE_LOG "
+.LASF1003:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1455:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF1609:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF2101:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF1532:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2008:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1014:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1643:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF1413:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1468:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF1915:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1273:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF2458:
+	.string	"cmsx_menuServoEntries"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF736:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF1152:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF2051:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF2170:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF1829:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF2409:
+	.string	"OME_UINT16"
+.LASF1185:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF770:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2468:
+	.string	"cmsx_menuMotorMixer_onExit"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1998:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF2060:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF1283:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF1057:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1979:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF1047:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2073:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1499:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF1657:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1281:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF769:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1924:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2371:
+	.string	"writeString"
+.LASF728:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1013:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1524:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2462:
+	.string	"cmsx_menuServoMixer"
+.LASF2297:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF1563:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF2418:
+	.string	"OME_MAX"
+.LASF1307:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF1721:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF2490:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1327:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF1737:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF2285:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2112:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF2289:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1868:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF1838:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF1347:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1684:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF1087:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF1720:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF1065:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2307:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2207:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF1708:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF1490:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1254:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF2202:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF1362:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF765:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF2287:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1224:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1907:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1772:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF1299:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1061:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1834:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF2174:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF1319:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF1312:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF2242:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF1640:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF1397:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1128:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF1589:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1982:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF2466:
+	.string	"displayPort"
+.LASF2449:
+	.string	"tmpMotorMixerRoll"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2301:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1792:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF719:
+	.string	"NULL"
+.LASF1548:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF783:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1900:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF1464:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF1466:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF2335:
+	.string	"pitch"
+.LASF782:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1921:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF2009:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF1510:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF1758:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF1045:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1458:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF466:
+	.string	"__PMT"
+.LASF1863:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF1226:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2296:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1195:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF1179:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2382:
+	.string	"beginTransaction"
+.LASF1938:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1407:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF2071:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF1098:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1567:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF1560:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF2227:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF2031:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2014:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF1653:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1630:
+	.string	"SETTING_DEADBAND 153"
+.LASF1655:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1930:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF2266:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1163:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1230:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF2228:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1648:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF1884:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1703:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF1555:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF1395:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1377:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF756:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1529:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF2455:
+	.string	"currentServoIndex"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF762:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF2347:
+	.string	"primaryMotorMixer_SystemArray"
+.LASF1867:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF2138:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1396:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1800:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1691:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF994:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1029:
+	.string	"UNIT_TESTED "
+.LASF1697:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1891:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1885:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1666:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF1398:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF749:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF2166:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1944:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF788:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1058:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2405:
+	.string	"OME_Bool"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1911:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF2259:
+	.string	"SETTING_NAME_MAX 16"
+.LASF1512:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1073:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1044:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF744:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1957:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1746:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF1562:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF2035:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF1111:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1392:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF1402:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF1256:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF1496:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF781:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1618:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF1212:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF1513:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF1333:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF1956:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF1702:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF2298:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF2394:
+	.string	"cursorRow"
+.LASF1277:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1620:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF2328:
+	.string	"int8_t"
+.LASF2239:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF2064:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF1972:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF1348:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF2178:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1431:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1439:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1492:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF743:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1107:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1382:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF2124:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF1963:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1987:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2144:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF1856:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF2383:
+	.string	"commitTransaction"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF748:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF1101:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1478:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF2205:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2006:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF1406:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2258:
+	.string	"SETTING_NAME_MIN 0"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1428:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF757:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1508:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1866:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF1157:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2200:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF1243:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1401:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF2196:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF989:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1300:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2309:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF1102:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1695:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF1473:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF2066:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF1638:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1694:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF1770:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF2047:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1726:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1399:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1451:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF2250:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF1516:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF1426:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF1433:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF1020:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF2389:
+	.string	"cols"
+.LASF1145:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF2316:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1761:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF2319:
+	.string	"signed char"
+.LASF1109:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF1173:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF1782:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF1124:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF1491:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF1415:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF1752:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF2199:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF700:
+	.string	"__size_t__ "
+.LASF2313:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF1192:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF1908:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF1846:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2355:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1416:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF1313:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF2044:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1776:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF2191:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2433:
+	.string	"onGlobalExit"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1803:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1031:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1764:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1625:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF1167:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF1644:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1662:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1521:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF2135:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF1559:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF1237:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF2184:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2357:
+	.string	"displayTransactionOption_e"
+.LASF1411:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF1923:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF1616:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF1249:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF2012:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF761:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF2304:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF993:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1459:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1227:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF1569:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF1619:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF1872:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF2067:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF1339:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2234:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF2168:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF2274:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2013:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF1926:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1836:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1262:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF1551:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF1766:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF2183:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2381:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1038:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1091:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1575:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF2270:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1360:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF1331:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF1258:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF1712:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF1288:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1598:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF2342:
+	.string	"inputSource"
+.LASF1189:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1337:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF1888:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF1021:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1878:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF2078:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2470:
+	.string	"cmsx_menuMotorMixer_onEnter"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1071:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2119:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF1161:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2210:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1169:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1219:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF2070:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2022:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1816:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF1554:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF1645:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF1010:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1119:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2185:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF754:
+	.string	"isascii(c) __isascii (c)"
+.LASF1954:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF1905:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF2439:
+	.string	"OSD_INT16_t"
+.LASF2146:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF787:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1669:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF1497:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF1558:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF2214:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2457:
+	.string	"tmpServoParam"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2211:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF1685:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF1343:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1284:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF1330:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF1673:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF1053:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1059:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2002:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF1106:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1123:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF1257:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF1143:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1637:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1933:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1172:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1400:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF1076:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2326:
+	.string	"long int"
+.LASF2010:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF1023:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF1268:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF1624:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF1965:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1664:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2179:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1852:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF1847:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1355:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2131:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF1292:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF2303:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1947:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF1757:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1034:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2275:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF1328:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF1002:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2404:
+	.string	"OME_Funcall"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1585:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF2021:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF1090:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF2137:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF1081:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1951:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF2397:
+	.string	"maxChar"
+.LASF1448:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF2251:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1154:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1890:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF2030:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF1121:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF2288:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1590:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2155:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF1882:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF1374:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF999:
+	.string	"EXPAND_I(x) x"
+.LASF2092:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF2173:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF1629:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF1789:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF1168:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2332:
+	.string	"uint32_t"
+.LASF2474:
+	.string	"cmsx_menuServoMixerIndexOnChange"
+.LASF2126:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1759:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF1517:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF2193:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1717:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF1434:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1582:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF1917:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1993:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF1799:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF1088:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF1075:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2387:
+	.string	"device"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2111:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF1995:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF1301:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1658:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF1647:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF2180:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF1187:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF2435:
+	.string	"CMS_Menu"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1704:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF1613:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF2004:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF1710:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2478:
+	.string	"loadServoMixerSettings"
+.LASF1676:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF1750:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1741:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF1668:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF1286:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF1314:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF489:
+	.string	"__flexarr []"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2255:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF2188:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF995:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1650:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1731:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF1030:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1714:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF2440:
+	.string	"OSD_UINT16_t"
+.LASF1055:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF1706:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1220:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1980:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF752:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1935:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF1188:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF1592:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF1441:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF2123:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF1932:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF1037:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1100:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1719:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF784:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1171:
+	.string	"SETTING_LOOPTIME 0"
+.LASF2087:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1370:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF1715:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF1329:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF751:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2448:
+	.string	"tmpMotorMixerThrottle"
+.LASF1266:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF1110:
+	.string	"DYNAMIC (1 << 2)"
+.LASF2226:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF2327:
+	.string	"char"
+.LASF2134:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF2262:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF2340:
+	.string	"servoMixer_s"
+.LASF2346:
+	.string	"servoMixer_t"
+.LASF1716:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF1263:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF1578:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1739:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1910:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF1931:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF1486:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF2373:
+	.string	"readChar"
+.LASF2037:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2467:
+	.string	"cmsx_menuMotorMixerIndexOnChange"
+.LASF1484:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1599:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF764:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1155:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2314:
+	.string	"SERVO_MIXER_INPUT_CMS_NAMES_COUNT 23"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF2372:
+	.string	"writeChar"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF2095:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF2400:
+	.string	"OME_LabelFunc"
+.LASF1760:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF1245:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF1393:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2105:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF1538:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF1586:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF991:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1530:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF1568:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF395:
+	.string	"true 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1332:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF2093:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1815:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF1435:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1667:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2072:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF1975:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF2117:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF1373:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1687:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF2149:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF2143:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1127:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1375:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF1241:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF1689:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF1344:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF1504:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1429:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF2028:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF1940:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF1646:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1649:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF2269:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF1509:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1780:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF997:
+	.string	"STR_HELPER(x) #x"
+.LASF1410:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF2469:
+	.string	"self"
+.LASF1378:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1654:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF1269:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1115:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1027:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2061:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1274:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1068:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1420:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF1356:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1860:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1162:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1595:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF1074:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1536:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1469:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF1295:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2268:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF2480:
+	.string	"cmsx_menuServo_onExit"
+.LASF2167:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2273:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF1264:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF2475:
+	.string	"cmsx_menuServoMixer_onExit"
+.LASF2110:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF1452:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF1851:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF2189:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF371:
+	.string	"__linux 1"
+.LASF738:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1690:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF1813:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF2370:
+	.string	"screenSize"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2240:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1340:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1386:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1438:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF1501:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF1961:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF1450:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF1814:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF2195:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF2235:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF739:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1306:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF1207:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF1493:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF1372:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF768:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1788:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1857:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF2058:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF1190:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2104:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF1182:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF2042:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF1769:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF2216:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1744:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF1475:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF1500:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF731:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1271:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF376:
+	.string	"unix 1"
+.LASF2481:
+	.string	"cmsx_menuServo_onEnter"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2068:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1384:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1889:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1825:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF2291:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1576:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF1918:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF1049:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1614:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1605:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1967:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1528:
+	.string	"SETTING_THR_EXPO 119"
+.LASF2083:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2367:
+	.string	"release"
+.LASF1197:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF1902:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF745:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF2052:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF2094:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF2260:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF790:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1580:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF2217:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF1064:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2136:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF1564:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF729:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1941:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF2206:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1082:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1009:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2384:
+	.string	"getCanvas"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF732:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1350:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF2046:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF1970:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF2148:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1853:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2085:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF1959:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1253:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2300:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF1738:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2311:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2344:
+	.string	"speed"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2154:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2197:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF2366:
+	.string	"grab"
+.LASF2244:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF1483:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF1922:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1460:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1193:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF2150:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF2356:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF2402:
+	.string	"OME_OSD_Exit"
+.LASF1942:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF2186:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2451:
+	.string	"tmpMotorMixerPitch"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1214:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF2425:
+	.string	"data"
+.LASF1552:
+	.string	"SETTING_YAW_RATE 127"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1713:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF1238:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF2421:
+	.string	"func"
+.LASF1146:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1886:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF1485:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF2088:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1318:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF2038:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF1976:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF2414:
+	.string	"OME_TAB"
+.LASF2245:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF1895:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF1403:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF1204:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1870:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1351:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF1218:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF1641:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF1267:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF2380:
+	.string	"writeFontCharacter"
+.LASF990:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1953:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF733:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1877:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF777:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF1385:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1144:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1345:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2272:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1149:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2479:
+	.string	"cmsx_menuServoIndexOnChange"
+.LASF1364:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF2485:
+	.string	"servoParams"
+.LASF1594:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1883:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF1166:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2118:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF1950:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2082:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF2341:
+	.string	"targetChannel"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF853:
+	.string	"USE_STATS "
+.LASF924:
+	.string	"USE_MAG "
+.LASF1802:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF2100:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1579:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1454:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2029:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2181:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF1707:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF1865:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF776:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF2204:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1808:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF1225:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF1077:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF2379:
+	.string	"getFontMetadata"
+.LASF1151:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF1542:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF2302:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF742:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1683:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1291:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF774:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1006:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2246:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2286:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF2461:
+	.string	"cmsx_menuServoMixerEntries"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1968:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1573:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1617:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF1324:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF1232:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF1296:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF2306:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF2420:
+	.string	"CMSMenuOptFuncPtr"
+.LASF1334:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1686:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF2054:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF2459:
+	.string	"cmsx_menuServo"
+.LASF1958:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF1414:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF1862:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF1383:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1317:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2452:
+	.string	"currentServoMixerIndex"
+.LASF1988:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF1991:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF1728:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF2091:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2248:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF1978:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2329:
+	.string	"int16_t"
+.LASF2236:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF1341:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1011:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1062:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF2233:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF2415:
+	.string	"OME_END"
+.LASF2059:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF741:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1566:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF1543:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF2084:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF2446:
+	.string	"currentMotorMixerIndex"
+.LASF1363:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1652:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF755:
+	.string	"toascii(c) __toascii (c)"
+.LASF1604:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1733:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1191:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF2027:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF1032:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1476:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF2377:
+	.string	"txBytesFree"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1012:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2399:
+	.string	"OME_Label"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1174:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF2279:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF1139:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1777:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF2365:
+	.string	"displayPortVTable_s"
+.LASF1503:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1925:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF1631:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1820:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF2282:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF1773:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1515:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF2198:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF1826:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF1955:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF1634:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1494:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF1276:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF1693:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF1467:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF2403:
+	.string	"OME_Submenu"
+.LASF1096:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF996:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1985:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1028:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1984:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF1854:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2472:
+	.string	"saveMotorMixerSettings"
+.LASF1522:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF2294:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF2069:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF1472:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF1200:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1103:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2265:
+	.string	"SETTING_STATS_MAX 0"
+.LASF1223:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF394:
+	.string	"bool _Bool"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1506:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF1787:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF1827:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1358:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2299:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF1213:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF758:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1682:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF1723:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF1016:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF2153:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF2080:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF1606:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF727:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1621:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1352:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF1316:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF1602:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF2445:
+	.string	"cmsx_menuMixerServo"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1546:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2424:
+	.string	"text"
+.LASF1718:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1812:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF1992:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF1556:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF1244:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF1138:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF1824:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1946:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF1810:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF1977:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF1099:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2412:
+	.string	"OME_FLOAT"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2220:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF1353:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF750:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF2423:
+	.string	"itemId"
+.LASF1165:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1635:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF2212:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF1969:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF2390:
+	.string	"posX"
+.LASF2391:
+	.string	"posY"
+.LASF766:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF2133:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF2368:
+	.string	"clearScreen"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1024:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF1835:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1937:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF2419:
+	.string	"CMSEntryFuncPtr"
+.LASF2122:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF785:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1390:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1365:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF1914:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF1549:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1622:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF1948:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1423:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF1116:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF2049:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF1821:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF1239:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1785:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1260:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1873:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF1896:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2039:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1628:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1158:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1859:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF791:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF988:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF2460:
+	.string	"servoMixerInputCmsNames"
+.LASF1786:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF2055:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1041:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2219:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF1610:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2401:
+	.string	"OME_Back"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1078:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1858:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1736:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2463:
+	.string	"cmsx_motorMixerEntries"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1934:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1823:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2221:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF1336:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF2290:
+	.string	"SETTING_VTX_POWER 373"
+.LASF2441:
+	.string	"OSD_SETTING_s"
+.LASF2442:
+	.string	"OSD_SETTING_t"
+.LASF1320:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2099:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF1762:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF1597:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2320:
+	.string	"__int8_t"
+.LASF1572:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2295:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1498:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1046:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1233:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF2276:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF1228:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1084:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1674:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1289:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1465:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF2257:
+	.string	"SETTING_NAME 362"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2230:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF1960:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF1148:
+	.string	"CMS_EXIT (0)"
+.LASF2317:
+	.string	"unsigned int"
+.LASF2396:
+	.string	"cachedSupportedTextAttributes"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF1768:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF1550:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF1928:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF1092:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2486:
+	.string	"customServoMixersMutable"
+.LASF2218:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF2019:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1541:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1278:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF2079:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF2477:
+	.string	"saveServoMixerSettings"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2011:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1607:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1841:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF1656:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1054:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2280:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF2323:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2432:
+	.string	"onExit"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2169:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2437:
+	.string	"OSD_UINT8_t"
+.LASF2343:
+	.string	"rate"
+.LASF1201:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1231:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF2040:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF23:
+	.string	"_LP64 1"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF1735:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF1711:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF1584:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2036:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF2062:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF1807:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1133:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1477:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1033:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1945:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1419:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF1338:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1518:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF1994:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF1561:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1897:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF2016:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1051:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1424:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF1120:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1208:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF2129:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF2427:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1845:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF1849:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF1097:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF1126:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1952:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1805:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2527:
+	.string	"long-double.h"
+.LASF2536:
+	.string	"__locale_t.h"
+.LASF2492:
+	.string	"obj/main/SITL"
+.LASF2513:
+	.string	"servos.h"
+.LASF2497:
+	.string	"src/main/drivers"
+.LASF2521:
+	.string	"libc-header-start.h"
+.LASF2506:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2554:
+	.string	"settings.h"
+.LASF2539:
+	.string	"endian.h"
+.LASF2495:
+	.string	"src/main/common"
+.LASF2510:
+	.string	"stdint-intn.h"
+.LASF2543:
+	.string	"target.h"
+.LASF2505:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2508:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2514:
+	.string	"display.h"
+.LASF2494:
+	.string	"src/main/cms"
+.LASF2500:
+	.string	"src/main/target/SITL"
+.LASF2525:
+	.string	"timesize.h"
+.LASF2512:
+	.string	"mixer.h"
+.LASF2526:
+	.string	"cdefs.h"
+.LASF2504:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2537:
+	.string	"strings.h"
+.LASF2523:
+	.string	"features-time64.h"
+.LASF2515:
+	.string	"cms_types.h"
+.LASF2509:
+	.string	"types.h"
+.LASF2552:
+	.string	"cms.h"
+.LASF2528:
+	.string	"stubs.h"
+.LASF2519:
+	.string	"stdbool.h"
+.LASF2507:
+	.string	"/usr/include"
+.LASF2517:
+	.string	"cms_menu_mixer_servo.c"
+.LASF2493:
+	.string	"src/main/build"
+.LASF2544:
+	.string	"sanity_check.h"
+.LASF2516:
+	.string	"cms_menu_mixer_servo.h"
+.LASF2499:
+	.string	"src/main/flight"
+.LASF2530:
+	.string	"typesizes.h"
+.LASF2535:
+	.string	"locale_t.h"
+.LASF2555:
+	.string	"settings_generated.h"
+.LASF2496:
+	.string	"src/main/config"
+.LASF2531:
+	.string	"time64.h"
+.LASF2511:
+	.string	"stdint-uintn.h"
+.LASF2501:
+	.string	"src/main/target"
+.LASF2546:
+	.string	"utils.h"
+.LASF2522:
+	.string	"features.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2502:
+	.string	"src/main"
+.LASF2551:
+	.string	"time.h"
+.LASF2532:
+	.string	"wchar.h"
+.LASF2553:
+	.string	"runtime_config.h"
+.LASF2498:
+	.string	"src/main/fc"
+.LASF2542:
+	.string	"common.h"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_mixer_servo.c"
+.LASF2550:
+	.string	"logic_condition.h"
+.LASF2533:
+	.string	"string.h"
+.LASF2503:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2520:
+	.string	"stdint.h"
+.LASF2549:
+	.string	"build_config.h"
+.LASF2534:
+	.string	"stddef.h"
+.LASF2529:
+	.string	"stubs-64.h"
+.LASF2541:
+	.string	"platform.h"
+.LASF2538:
+	.string	"ctype.h"
+.LASF2524:
+	.string	"wordsize.h"
+.LASF2547:
+	.string	"version.h"
+.LASF2545:
+	.string	"common_post.h"
+.LASF2548:
+	.string	"parameter_group.h"
+.LASF2540:
+	.string	"endianness.h"
+.LASF2518:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`N\001\275\013"
+	.string	"d\021B\002"
+	.string	"5"
+	.string	"\242\334\257\204\006\022\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\004\002\003\001\352\263\360\321\b\003\240\342\234\212\n\004\206\322\265\241\017\020\005\002\005\004\005\335\247\230\205\f"
+	.string	"\006\345\375\310\324\002\002\007\245\250\204\377\001\006\b\t\275\212\233\234\017\006\002\007\002"
+	.string	"\002\007\n\f\r\235\364\265\237\b\002\b"
+	.string	"\016\017\020\354\322\322\222\007\004\021\242\302\263\302\013\022\261\372\222\310\007\t\002\t\002\n\002\n\023\025\026\027\030\031\366\376\202\234\n\022\013\002\013\032\033\034\035\036\326\226\262\343\006\037\231\265\344\207\f \347\307\213\320\002!\357\275\302\216\f\"\251\222\236\271\004#$%\206\243\223\223\016&\215\311\314\230\r'\310\376\305\350\006(\271\376\354\344\f)*+\235\304\270\263\f,\260\363\332\265\003-\353\243\223\354\t.\261\372\331\242\002/\327\200\321\234\0170\252\361\365\0361\344\340\235\352\0052\260\227\301\232\0073\351\360\374\366\0044\271\272\375\216\0045\216\325\323\340\0066\262\210\247\252\0167\363\235\325\315\f"
+	.string	"/ \320\002\301@<D\344\006\2328\304\275N3\311$\226I\303\255(\034\360Tm\001\202\330wqc\216\"\277Ch\371\265\201\205\331\2148!$\246\214\203\034\354\221\001\006\214"
+	.ascii	"\270\261\264@+\225\221\306\250\"\313\330v\202(`F\246\266\177"
+	.ascii	"/(\330\303@\005}\270\034\324\006)\241\231\317\n7\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \207u\002"
+	.string	"T\003{"
+	.string	"\017"
+	.string	""
+	.string	"\001\004\001\001\005\001"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\001\006\007\002"
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	"\001"
+	.string	"\001\t"
+	.string	"\001\r"
+	.string	"\001\016\017\001\003"
+	.string	"\001\020\022"
+	.string	"\001\031"
+	.string	"\001\032\033\034"
+	.string	"\n"
+	.ascii	"@\nx\027\274F)!\200aA\375\002\013\263\274\227\271\n\f\260"
+	.text
+	.section	.gnu.lto_.inline.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\211\001%\006"
+	.string	"\302\b\034%\200\305\205\016\363\006\260X\fdD\246\253\255\004\031\272\273\364-\227As\200\371\3378\016i\006|\242\021\"[\356\0247\030\222u\027\3532\213\212\230\266\016\376U\fh\2538qE\020\342\360L\307\267\352Y\360\343*\020Br\207`\377\244-\345ys\340\27792`\3577\320\266\215:K[\350fNl[\347\251\253\264\225\370F\035@\333\350\241)\t! @BBP\272\001<E\242\t\235\222A\f\310!w\376\022\004B\214\335"
+	.string	"\244H\016\247\3004!Q\r\235\023\2221#b\245A3"
+	.ascii	"\030\361\301i\224.\322\212[\304x1\242\036\034\243o\256:\272\303"
+	.ascii	"'\200\b\314\257\353\n\2263\006\327\342\025`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \225\265\002"
+	.string	"\022D\016\032\260'\035\f\303\200\226$\221p\030\206a\325n\264i\333t\264tk\233H\231\002+\t\362\307\033\027\267\241\267\037\276\216*\314\206\225f%~\203\255O\002D\227C\326\1773\001\n"
+	.string	"FqY\311\327g\346\251\f[I'T\273{J-\247XV\006\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 2\221\001"
+	.string	"."
+	.string	""
+	.string	""
+	.string	"\017"
+	.ascii	"\231\004\004\232\004\005\230\004\006\230\004\007\230\004\t\231"
+	.ascii	"\004\r\232\004\016\230\004\017\230\004\020\230\004\022\231\004"
+	.ascii	"\031\232\004\032\230\004\033\230\004\034\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \346m\003"
+	.string	"\"\004\016\031\2605\303\001\fnI\222$I\222\244Et\357\336\335va+\332\306dJ\001.J\262\266\013Q[5O\333\264%\3441\212\203P\337\206\315\026\320\326"
+	.string	"\016\324\321\326\217\201\027"
+	.ascii	"\300\b\330\007\226\201}Q \341\253P\301\020`\007\216\201\225\""
+	.ascii	"\354\253I\"f\035\004\266\004z/\347@\213\313\272V\275\261\363"
+	.ascii	"\r1\277\266,\001\003,"
+	.text
+	.section	.gnu.lto_.lto.bf5ad7e0e7509230,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_loadServoSettings.57.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\266\003\235\024"
+	.string	"\306a~I\300\324Qc\022-\310\277\3417,U\f\314)\022\354\311B\2315{\222s\277\260u\263@9\030\205\030B\273\020\001\231W\312v5\255\345\006\013DD\033"
+	.string	"\344\177K\365'|\374k\027\354\212\240o4\270u\255J\266\224R\246\024b"
+	.string	"b"
+	.string	"o"
+	.string	"\022d\370\252\214s\234\177\004S\204b\273v\233nuA\325\204Sp[\340)\303\234'\375\242\347pnd\251J^\236\223)\026\276\336\202[;"
+	.string	"p\253\362\326\007\200\267\025\3055\333\310\311\237\373\342\323\321\365\356\275!\205\361\332g\315?\321\003\334xL|\262\"\334{=o<(nz\333\bl\337\3305%'e\213{\364\247\b2\262:b5\351\311\253\330f\351\323I\257\323\304\237q\0323?\310#\306\371\333\255?\202\267\247\007\200T\330\346\225[Kxw\2266\2313\351\013\373\365R\037\333N\203u\332\326\351Z\247\351\234\236t\372\002R\224\020\240\272w\347\352ww\026J\210\351\305hH\347\222\353%\271\344\206\002K<vX%\034:\245\217=\255\222W\251\216\034\223\211\206S\301\300\262JiJ\252\322\007D\220&\b\221IH\037{l\263t\313\307\2434jC\353\347\336\313\342?\035J\344\360zI\335\2208\346N0VT\221\025\270{O\260\034\311.\361\033\242\375\355\374~\270{oK\215\333\220\361\203n\035\003!\003o)\205"
+	.string	"\224#\177\242S\330\211\341\253\nf\320`e\245C\313\212\350R\361\214k\fkfdb!>\030\270\021=\320\304^\240a\256\031\t\2328\276h\342ML\366\262\241\021e\257Q\006\013ib1\262\020F\033CW\002\317D\210\264\260f6\243\205(\244\355\365R\037\333\253\235\215\346\030\244C*\b\241:\013\017r\201\225\324k\002\362\003\2440@KN;\246\245\333\364\264\230\360,\365\261\303\360\0360\260L\022M\2501P\210$\021\032\232QPP\3346"
+	.string	"\003\2219\325\030\022\200\306,\020\031\304D\314\202e\026\326\337\001~w\301\r\242\346?\243\342\357\004i\"\254\360z\226\036\375\"\335\005\275c\025e\375\202\252\274\201\016\355O\341\222,\342)r\313\005TE\007:\221\315\202\217\t~!\004\212\213\305\365\305\305\341@\007_\033\265\216\377C\260P\346{\272\027v\262\250b\r\372\251kT(\303\310\230TM\370\260\2469\232\033k\241"
+	.ascii	"\030\324\374E*\331\021\037(\016\275'e.P\236\n"
+	.text
+	.section	.gnu.lto_saveServoSettings.58.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\270\003\215\024"
+	.string	"\366\341~I\320\362\2501\003\031ON\207%\t\201\243^\334I\306Al\020\375\004\211\241\2364kIj\223\354\020\200`\211v\332\013\215qP\370\255\311 bG\240\336@\r\036\2025\307\036\037q\266\020\347\210\"\244/\330\324\355\260rK\231Rb"
+	.string	"f"
+	.string	"m"
+	.string	",\224\036\311oq\223\346Gv\202pu\"\032\360\030\356tLn-\241u\373:\201\223\260nE\227]\342\201\205R{AJ\356>\016\256\367\36205\335k\2328\245u\353\234\035\344\246\212;\322\203\263\373U\335{\307\232\342\271\323\234\377\242\003\340\345\330\234\2168\270\367\232\362rt\356z\333\007l\327\330\242\200\037~\206\274\036\351/\035\2652\253\276~w\245\243C\323s\204\360R+\333\274\241\365\307\276x\253\217}\337\317\262\324V\244\026E\352*RSJ\375"
+	.ascii	",\036\251\222\247{A\f\213\334(;ChI\006$\002\312\316\252\237\354"
+	.ascii	"$j\331\204h\001{p\250Ls#?I\366s"
+	.string	"\331\316\275:\2307\207\001\211\240/\301m\211P8\304\263\tx\356\bk\275Q\306zC\347\223\r'\332k\320\250\025\345\207\222\371S\372Kw\226\020\322*\243\214\365\202x|W\262k\336d\023\013\034\r\223\226|\367\336\225[&\362\245&\002\341\t\261\205\307([\367^\025\377\305a\330\374\240[g\300\321\363n}\034\353\226V\025 #\037\351/z\204\025CD\250\006\354\240H:\311\324\356*\206\201\341F\031\230\227\332\205\n\006fH\227\230\332\214e\005(''\024VNH\330k\306\245VM\203\3316\334H\334\354F\316\324\312\231\206\030\262\234\341J\332\030Sk)G\332\r7\302\020\330\206\201\274\21526\333mt\231\272\213\267\372\370\301\211(]\275\261\255S\263X\217\310\205\217\036P\023.\234I\331\232\002\024\214Z\n\232\020\212uG\031\353\261\b\352\200jy\216K\250!\\\210 \022\031\022\221\214\024\266\016"
+	.ascii	"\003\2211\326\030\022 \2664\013\032f\204V\212lia\375\036\n\004"
+	.ascii	"\222\365\315\351\375\376Y\027\317\021$:\222\0210\334\025\202"
+	.ascii	"\302V\353gx\217(Z\027\360\027\030\245\365\336@\177M\257<\036"
+	.ascii	"Q\271`\275 \361\343\0348ln\321\0256\303A5y\020\026>\013F\366"
+	.ascii	"J\371\361\264\004`S;s1\244\261\002\240\211\032z}\023\225\305"
+	.ascii	"c\240Zu4\247>\314\005\246\354wd|\312\036\005\231\301\230(d\315"
+	.ascii	"\002\345\377"
+	.text
+	.section	.gnu.lto_cmsx_menuServo_onEnter.59.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"u\b"
+	.string	"\262O:9Po\322\001\200\3326\352\311|\331\255\\\2561h\327\b\212)\264W\257\016\324\"A<\013\373\313H\376\027\366\214\033\230\231\226)\022D2)\037[A\240\332b\333&do\231\002?@\3000\b\005\214^\236\272\331\210\352\332\265UX\312e\226Z\200jF\021\2425\343\2526C\240\207:5\313\315\353\363M\202\3329\261mvvnsJ.thD\321\345\251\202\377\005\006\344\357\036Q\364.K\240\312\310K\303\231\377z0~\374\\u4\375Q\242\\\nX\2729jh\272\305Z\021\371\337\375\235\177 \206\201!\2372\030\240\333\004\203\352\276\006O\340\260\365\377l\302'\335\237\"\270!\244\215Gi#E\246\273\347/\013H\2668\034 \331\212 \3341\354\316\214\302\025I\251\346\033y\f7\r\335}\370\215H\374\310\377?\377\035\376\337\r"
+	.ascii	"\002\245\343]\340\231\241\301\210\023\001\274ph\316\266V\204"
+	.ascii	"w\r\257\260hz\b>\374\314cj'\031"
+	.text
+	.section	.gnu.lto_cmsx_menuServo_onExit.60.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\345\t"
+	.string	"\266\022E< \005)\035\207\254\b1@\037*g\204p,B\210~\023\022Y\336\013m\366\002\326\205m(\215\325<0\222\006&.\037\260\202"
+	.string	"\205\026qx#\020]\301OFa\353\377$v\313\224\0022"
+	.string	"2"
+	.string	"1"
+	.string	"\264\202RD\006\372\030\201\265\360\354n\347\362\003\334\267\320\005\270o3\344\343u\364\257\362\217I\307\013\031s]A\016\273k%c\262{\336v\311\366\203\355\235\377\354\234\331S\255\252\376\306\351\330\030\320\354n\324"
+	.string	"l\315\026Sb{\264G6\201L\303\365)\030\017\330\235\341\300\354\226\007V\b}\263\355\237\034e\264\003\\\216Hu\332 \205\2364Ic\272\374\251\363\260"
+	.string	"\376\312YD\237\304\254\226\236\374\346\267\270o\237\"\216\227\326\314\321\324e\346f\265\307.]:A\354FH8\235\"\026N\236\211\364\201\241\304\307)\023h\021z\"*\364.T\037\212\265\362>\224\370\245\272\225\n\342\353R\241\330\231J\006'\274\260\253"
+	.string	"\301\260\033\225{\032\307\340\361\232\031\016\016"
+	.ascii	"\002\245\343]\340\231\241\301\210\036\001$v\210\"\364\210P\213"
+	.ascii	"\254\210\351\232\270\304\"\353!\314\341gFS;\237"
+	.text
+	.section	.gnu.lto_cmsx_menuServoIndexOnChange.61.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\b\001m\f"
+	.string	"v\226RA q[8\003T'\004W\211\251D\021\314z\240\301\016\2327\364}\202B\343\270\317\301\235\377\177\355\030\2516Z4\272\001\006\rm\001"
+	.string	"]0v.#\332\033\"\314DtK\032C\037\022\021iR\246\024;"
+	.string	"?"
+	.string	"?"
+	.string	"\t\256S\266\375\323I\200\266\211f\004a\262:\234BP\240\354.\346\361\230\352\324u\002\325)\375p\360\t\3727q\313\210\r'\242H\370\264\030\354\256S\0241\335z\333\034\333\232\375\216\366\030\246z\260oY\035\2615\255\226tj\372\227\245\001F\201\223\335\n+*\373\202rAb\033\264/v\346\364\311\32134\002\026\244$\204\350:\225!\371<_\202\302\007\354\216\240\264\330\035\r8\312\342\"\215\025\231*F\306\205"
+	.string	"i?\330>4\264e\002\220\2516\327\345Eo@4\3645\365!5\374\222\237\350\360E\370+\345\305S~\251:u\335\300\340\221+\266,T*\231\"%\306fJ\036i\244>\200\300\343\021)\360h\235\r\311\353\032L\bA\030}\233\203\213\263N\027\301\323>\220\247I\3308P\211C\343@\037\227a\034[\210\3032\357\303:\034w#\315\303H]\347a\227qoR-\340\340\241\037N\025\0314\032"
+	.ascii	"9J\337\273\0303C\203\221\251\005x\233\363^5\302\312\334\300\035"
+	.ascii	" \201{\255\030\264\205\2719\257\354\264B\201eD\250 *\327V\332"
+	.ascii	"ta\234\315\214h\214\355C\225#\324\270\341g\032S;\311"
+	.text
+	.section	.gnu.lto___compound_literal.1.63.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 uu\003"
+	.string	"\024\0065"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\035\001\001\017"
+	.string	"\005\001\212\001\202\200\200\374\342\203\355\321\027\001\177}"
+	.string	"?\202\210\200 {y\276\001w\275\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\300.\002\034Ki\020\003p"
+	.text
+	.section	.gnu.lto___compound_literal.3.65.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"\004\007D"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\304\023\364\003\005\0016\200\200\200\374\342\303\355\341\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\316.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.5.67.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"\004\007D"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\304\023\364\003\005\0016\200\200\200\374\342\203\356\341\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\316.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.7.69.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \204\365\003"
+	.string	"\004\007D"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\304\023\364\003\005\0016\200\200\200\374\342\303\356\341\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\316.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.9.71.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \204\355\003"
+	.string	"\364\006D"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\030\001\001\375\203\177\005\0016\200\200\200\374\342\203\357\321\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\350\037y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.string	"\316.\004\314a)\027\016"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_cmsx_menuServoEntries.74.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\266\001\355\f"
+	.string	"\264\023F\002"
+	.string	""
+	.string	"d"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\370\235\020\001w\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\004\b\202\200\200\270\357\261\003ig;\254\254`w\310\311\001q\307\001o\306\001m\305\001k\304\005\013\370\356\261\003ecA\206\ba_\317\320\001q\316\001o\315\001m\314\004]F\325\326\001q\324\001o\323\003\370\355\261\003e[K\333\334\001q\332\001o\331\002\t\355\3611YW"
+	.string	"\250,\177U\341P\206\bS\250\fQ\343\344\001q\342\001o\340\001m\337W\206\bO\234\254\344\016M\347\350\001q\346\2738K3\351\0014\345\001\336\001\335\001\330\001\327\001\322\001\321\001\313\001\312\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\005RATE"
+	.string	"\004MAX"
+	.string	"\004MIND"
+	.string	"\006SERVO"
+	.string	"\r-- S --"
+	.ascii	". \020\003\031\241\322\001=\371\303\211\347C@\036\221\270\325"
+	.ascii	"\274d3e\031a\207\203\316\f\3645d\222\355=J\233D\315\365)]\320"
+	.ascii	"\213\341\333`d\261\227\354\342\30682C\213\203,|\222\273 \006"
+	.ascii	"\333\210zQ\3636\326\370k\215~c^\264\364M\322\356\016\242\341"
+	.ascii	"(}|\\\250[b\350\241\027\001"
+	.text
+	.section	.gnu.lto_cmsx_menuServo.75.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006E"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\206\200\200\374\342\203\375\201\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\340\217\037{y\370\367\201\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto_servoMixerInputCmsNames.76.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\020\003\225\022"
+	.string	"\326\037xJ\260XQ:\200\217\213\013:6\222\00493\225\375\323\367\325\016\340\"\276=\235\021\377\242\3300\364\317\301\334\233\255\323b\035|\242}\240\0367\263\206M\372\251\214\n;s\360@i\200\354>W\270\377\247\263\030\020\372O\255N\224i\007`"
+	.string	"_"
+	.string	"a"
+	.string	"\347\030\243\240-J5\204\350G\364Y"
+	.ascii	"\016s\203;\016!z\020}\036@tn0=\373L\300\306\271G;\240>\027\370"
+	.ascii	"\235{\224\226}6\300;\027i\327\323\347\0032\316EJu\372,\363\342"
+	.ascii	"t\021\221\304\342\325g"
+	.string	"\004\227A\235\353[\234\233\202\311\311D\026\235\016}\210s\207\020\335>\327\273j\335`\265\345\245K\242\317.M>\333\243\205\350\242}\006\300Tn\257B\210^K\237\331Im}\026B\364M}F1\261\255\357\026\242_\352\363K\022\240\375\345B\364J}\304\334_j\324\347\024\021s\201\273\241>\253\202\230\013L\205\372\274\372a.\321\212>\303\3608\227(=\212>\007H2\267\250D\00774\254\t/\230\310\022\311U\275\213\013\035\306c|\306i\274w\337\207^\3437\016|\321\203\317q\035?:\322w<}\217\3738\220+]\310\207\274\310\215\034\211\353J\276\344Ko\362'\207\362(\227r\247Oy\225?\375\212\315\263\324\314\366I\367\301\303\203z,\346\267\254\212\266r.ow\242\317K%u\034c\344*\205\363\222\361\304\210d(\222\251J\341\325\303\022\311\227\na\224\311b$L\306\022I\230\352\272a\320"
+	.string	"&\312rvVu\034c$\013G'G\202\252\362\354\274\306\b\250\352@U\025\320,\250\261q\321fn\031pen\206+7\324l\263\240\237\3226\313\331h\255\237\232\217\255E\303\345Z3\t\352\355B\211ka\270\335p\255U\rA\2501,\001\202\266\222py\2440\314\001"
+	.ascii	"\003\031\"\326\001\020\030C4\n\347\001\177\300\033P\360\374\006"
+	.ascii	"H\265-\316\321 tx\302\242\257,pn\245\275:YX\036\232\025\020\245"
+	.ascii	"\216\223\272\022;F\376\221+vmQ\377\201w\266\237\376\ft\337\320"
+	.ascii	"\275\257\327\203\270\343\013\254\375\333\357\276\250/\027L\305"
+	.ascii	"\241V\273;n\227\021\2766\025\276\352\004\037"
+	.text
+	.section	.gnu.lto_loadServoMixerSettings.77.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\320\003\205\025"
+	.string	"\326\343\204K\260\020V:~r\027{\234\372DbKG\312k\345]\212\357\216\221G\262#\261\262\322\241\377\007I\302.\033\324\211_-\266=\222\255W\371\207\034R\252ixv\354\250_Is\345i\351]\216\266]v\254o\030\251m\204\020\271\223\fj"
+	.string	"i"
+	.string	"s"
+	.string	" ZB6\300\250]yp\357\343\322I\002v\367kww0\227\264}\fN\244\301\220\227\002DD\250\365\351\236\347=+W\261Hd\332\276\327\221\214\324\021\301\313]\320z\t;\310\003\230/\311\327\356vo<\275i\226\r\360Ex\354\356\223M|\367\272\333\177\347\256\236\217\345\225\325\240\273\267\366|1_\376\356\022\330]\225]\362@4\355\363\377\240x\232\244rT~z\030\257V\355\271\362_x\354W\234\be\237\2639]}\357\345^g\276<\027x\032\301\253=\266\022\3550v\255\332M[*\333\354\236\354\356^\256\331\345\272&Y\267\344\272$\327\345Z\267r\335\003\370\260b\n1\352\206\351a\325K\345\021\n!\226\216\322Q\310\242Q\002\002\271b\222\216-\226%_\370\024\344r*\246\302\240\353\250\214$\313\210\301W\024^D\231\304\017*\b\006\022\311'\376\324\024S"
+	.ascii	"\375\374!fxDSF\346\027( 7\335-\262w\361\243\222\031I}\217\204"
+	.ascii	"\330\303\261\264\033\241\\\342\347$\023\354v\021\371\317n\207"
+	.ascii	"\027\225\260\206`\200V\301\356\036aqbm\237\363r1\330n\346K\346"
+	.ascii	"\027\341\364\244\377\316?r\2123TQ\257\251\233@\201LVaD\206\306"
+	.ascii	"`k\022\313\235)&%\265\f\027\006\250\240\026Nj3si\261\333\006"
+	.ascii	"\034\232\233\341P\225\232m\246;Am\263\234\215v\236\324Hl'\r\227"
+	.ascii	";c\006\366\246\001\305\235)\267\033\356|\245\274\223\3155\353"
+	.ascii	"\340j\211\307-k\262\023\212\r\342\203\327@\371\303O\307\020\215"
+	.ascii	"&\223?\304\031B\025[\b\r\317\241\312X2\023\204%\241\204+M`\017"
+	.ascii	"\277\250a\322\214L\250!L\310\2203B3#AAJ\342\034\360\002\2219"
+	.ascii	"\331\030\022`\266$\021\n\020\022b\031,,\255\377\016~bJ\222\023"
+	.ascii	"G\351K\224\203-$9\202:K:X\217\363GFvj\021n\202(\374\225K\312"
+	.ascii	"5z\234?2\366U\254\351\311\311\261\220\224\314\264\247\021\221"
+	.ascii	"\227]^\213\314S\363\315\254\315\t\372<\007\331\034\202TM\330"
+	.ascii	"\212\237B\247\354\234\177\304\366\322\b\266\366,\003 m\350W\321"
+	.ascii	"Qi :\302C\265\342\325\037\361\202MG\304\274LL\226\237a \353\027"
+	.ascii	"\202\363\007"
+	.text
+	.section	.gnu.lto_saveServoMixerSettings.78.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\265\003u\024"
+	.string	"\346!~J\300\322Q:\002\3009\336\330\357\030\233\211\030\343\037&\003\361 !h\034@p\344%B\031\350\003T!\317\200\377I\r>\201\357h\327\037\006C\317}(R\340\004\252 \b\"\260\306^i\336\034\177\301\243\223\002\334YK\b\331;\245a"
+	.string	"b"
+	.string	"o"
+	.string	".\357\371>/`\316\356\262l\337Z\033\316\3255\340\235=\003\027G|D\240\364\247\277s\036\227\367x)<W'\"b&*\210\340\242\027\254.\266.\340\"\343\305\220\345\233\275\343\247\315\252j\212b\204\202\273K\326\023\277\235\336\374\353<$\247{9U9\330]\323\234\256\303]o\233\200\355\026;\f\020\264\376|\013G\245\374J\353c\200\370*\276\202\346\363lc\241\317]\364Y\306\213\257! p4\210\251\221\207\337R)\373\204\241\265\306~\270\273\353JcW\3521\244\026+uX\251+\245\246\225\372"
+	.ascii	"X38\016\264\330\225\t2\265>Q\t\005\321\313)(\364r\312\001z\001"
+	.ascii	"\203\253\027\016+\242\232\"(\007\260\031b\375\221\216\240S(("
+	.ascii	"\304/\254L4s\307\013\222\021\243\206\311\227^\204\365K?8@?o\341"
+	.ascii	"\214>\374jU\242\231;\233\231\336\177l\rw\221\302\342\311\344"
+	.ascii	"L\365v\267\344bR\254<\031y\312\361\260\354H\264\325\3562\360"
+	.ascii	"Y\374(\305\347]\2649\233\215\027k=\214\033\236\363\3279\004\246"
+	.ascii	"\022?\240DzL\254\317O\343\333i\212\352\021N\240\200\204\204B"
+	.ascii	"\tI\351j\031\305e#WPNd\027,\fh)+\250\310`\243c\256Y\206Zi\203"
+	.ascii	"\325\312\026\231\tcQ)M\230\315\214\221*2\023\223\214\325l\244"
+	.ascii	"\253\200g\030\312\032\2712\233\325H\326\211{\270\225\306\017"
+	.ascii	"H\370p\025\306c\315A3w)\212\234\200O\022\336D\373\215\365H7C"
+	.ascii	"IDC#~b\365\301\314\035\316\320\r\033*\340\204\323\bL\250!Xh "
+	.ascii	"##C\222\231\2400\352\020\003\0211\272\006\022\340\2258\316\""
+	.ascii	"c\204X\006\013K\353\277\003~j\245\366\023\231\364\020\024\317"
+	.ascii	"\022\244\032\270\001S5\352\031\024\237\251\272d\214E\024\001"
+	.ascii	"\353\200\347\263\254hz\372\375\353\377i\221D v\200qN\016F\r\257"
+	.ascii	"\b\217\357\b\241X\365\360-L\006F\352\350\202\260i_Y\355\310C"
+	.ascii	"D\337\212z\255\207\177H\022\fU\364U\026\006\2026@\263]\247C}"
+	.ascii	"EAd\376\255\3609\332O\020\340\372\213\227\377\003"
+	.text
+	.section	.gnu.lto_cmsx_menuServoMixer_onEnter.79.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"u\b"
+	.string	"\262O:9@o\323\001"
+	.string	"\301\216\356-77$\r\200\365\320\332\257\216\00715g@\333f\254!\0075\306\025\022-\324V\375\330U\004>\271-\243\335\252\206\240\214\311\374`\337\215\354-S'(\310\262\206\203\254b\034\256\263\016\3257\254\223\260\325\323l\235\370pZ\004\250r\232\307m\024\364a\340\350f=\212u\336=TK!\272\316\322y\233Q\027\302\306\205\f}\232\252\370STD\016\317\tI\360S$\236\200\264t\204\371/\030e\351\347\252%\351\227\363\304\342I\351\326H\305\364\212\205\362\361\377\373\347/\200\221\300\221M\026\274\351&\275\234\272\257\347\006\032\266\376\237G\230\344\373Q\003\267c\224)\251d\230\270t7\375\345\200\213-\r\003\\lI\016\3768~g.\341*\304#\025\212@\216\031\205\356~\fE#\276\344\377\235\377\013\377o\r"
+	.ascii	"\002\245\343]\340\231\241\301\210\023\001\274ph\316\266V\204"
+	.ascii	"w\r\257\260hz\b>\374\314cj'\031"
+	.text
+	.section	.gnu.lto_cmsx_menuServoMixer_onExit.80.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"u\b"
+	.string	"\262O:9@o\323\001\2004\204\251\363)\027\203g\0248\364\257\205\303,2~g@\277Zm\310A\215q\205D\013\265U?v\025\201On\313h\246a\001\221`\032\r\354\273\221\275e\n/0\3000\007\004\254^\236\215\263\017\324\265\213\233\260\265\313l\245"
+	.string	"m\231D\250nY\267i4\004j\330\250f;z}\316ATK#8\316\322y\233C+a\003C\212>_\250\370WXD\006\357\021\311\3573\214%(,\035g\376\373Ei\372\231jY\372\345\204Y\271R\2725jhZ\245:9\375\367\376\371\013\264(p\344\220\013\356t\227dL\272/\301\0178\\\375?\1770\210\367\207\003\267\203\2641\271d\214\304t7\375\345"
+	.string	"\213+\016\003X\\I\016\3668zg\026a\312\343D\002\216>\216\233\205\356~\004G$\276\344\377\237\377\f\377o\r"
+	.ascii	"\002\245\343]\340\231\241\301\210\023\001\274ph\316\266V\204"
+	.ascii	"w\r\257\260hz\b>\374\314cj'\031"
+	.text
+	.section	.gnu.lto_cmsx_menuServoMixerIndexOnChange.81.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\025\f"
+	.string	"\346\225Q@"
+	.string	"Q5\035`\324\372\210K*\273\be\2301Vg\300=\002;z\276\360\2046-28AaC\036~G$\021\024\031*\036B\231{\373?\311\326/1\240|\345{\3425]\341\r,\211[\246\024:"
+	.string	"?"
+	.string	"?"
+	.string	"\277l\373%nB\264;($\210SD\325\302\300acw7\223\037\200\375\222\\"
+	.string	"\366k~\270x\025\375\263\016Y\255<F\323\350\032Y\260\273\326\321t\272\347m[ls\366\033\00469\322\251\262\017\331\231\262\247Z\247\372\021\215C\214\315c7C\371\2610\256\027$l\213vfOXd\2244\r\n\200\265\200b\004G\362k\302\312\\\177\242\302\003\354\246n\270\330%\t\370\200$\250N[l\230*\036\314\031c\215\227\367\260O\235\277\320\241\244\245\375\024\347\360|\021\376@\372\361\227\017\302~}*\b\201\"ii\355\204\251-\222\240\037])\315\2215\r\331\207\256h\311Xm\005`\3503]\300"
+	.string	"\006\303A\200\341.\225\020\3701\240\260\201\360\t;\007\231;\227/\002\310\205\032\220\233\320y\032\221\207\3634\241\327\331<\335\306\333:`\270],\376>\034\270\205\276\017\3342r\337\201%\360@\232%k\001\027"
+	.ascii	"9J\337\273\0303C\203\021\237\005\260\232\213P.\033{\3440\007"
+	.ascii	"\202\201+\230\032\"S\005\234\363\226J\303+\302\273\206/\263p"
+	.ascii	"\032\023\320P\345\b5n\370\231\306\324N2"
+	.text
+	.section	.gnu.lto___compound_literal.13.83.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 oy\003"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\001\005\001\006\035\001 \005\001\212\001\202\200\200\374\342\203\315\343\031\001\177}"
+	.string	"?\202\210\200 {y\275\001w\273\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms/cms_menu_mixer_servo.c"
+	.text
+	.section	.gnu.lto___compound_literal.15.85.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \202\335\003"
+	.string	"\344\006B"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\035\001\001\020"
+	.string	"\005\0016\200\200\200\374\342\303\315\363\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\350$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\315.\002\034Ki\020\003p"
+	.text
+	.section	.gnu.lto___compound_literal.17.87.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \200\001\004"
+	.string	"@"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\316\263\021\001\177}"
+	.string	"\005\001\006\035\001\026\005\0016\200\200\200\350.{yw"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\350\037u\275\001"
+	.string	"?\202\210\200\030sq\276\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms/cms_menu_mixer_servo.c"
+	.text
+	.section	.gnu.lto___compound_literal.19.89.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \203\355\003"
+	.string	"\364\006C"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\350\007"
+	.string	"\005\0016\200\200\200\374\342\303\316\343\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\315.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.21.91.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \203\345\003"
+	.string	"\344\006C"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\035\001\001\377"
+	.string	"\005\0016\200\200\200\374\342\203\317\343\013\177}{"
+	.string	""
+	.string	"\005\001\212\001\202\200\200\250$y\276\001"
+	.string	"?\202\210\200 wu\277\001s\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.string	"\315.\204\312\260\224\013\007"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_cmsx_menuServoMixerEntries.94.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\307\001\215\r"
+	.string	"\344\024F\002"
+	.string	""
+	.string	"u"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\370\271\020\001w\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\004\t\202\200\200\270\317\263\003ig;\206\be\254\254`c\310\311\001q\307\001o\306\001m\305\001k\304\005\013\370\316\263\003a_B\206\b][\317\320\001q\316\001o\315\001m\314\004\017\270\316\263\003YWJ\326\327\001q\325\001o\324\001m\323\003\315\263\003iUQ\334\335\001q\333\001o\332\002\315\2035iS"
+	.string	"\250.\177Q\341X\206\bO\250\fM\343\344\001q\342\001o\340c\206\bK\234\254\344\034I\347\350\001q\346\2738G3\351\0014\345\001\337\001\336\001\331\001\330\001\322\001\321\001\313\001\312\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\006SPEED"
+	.string	"\007WEIGHT"
+	.string	"\006INPUT"
+	.string	"\006SERVO"
+	.string	"\n MIX"
+	.string	"\022-- ER --"
+	.string	". "
+	.ascii	"\003\031\241\332\001\341uD\360\240\237\006\271\205\354V\263\221"
+	.ascii	"-\026\273\204\035\206\316\006\324L6\222N\\\367HB\022v\265\263"
+	.ascii	"\357\205\343\006\343\234e\006\375}\022\241\340\033W*3\035N\331"
+	.ascii	"n\215\032|#\357E\315\333X\342\2571\272\031\361\276\317\267Sc"
+	.ascii	";\b\201SD\002C\200\337\022C\017\263\b"
+	.text
+	.section	.gnu.lto_cmsx_menuServoMixer.95.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006E"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\206\200\200\374\342\203\335\203\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\340\235\037{y\370\327\203\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto_loadMotorMixerSettings.96.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`_\004u\027"
+	.string	"\226'\222K\240RR:\372tP!y\016\217\310\274I\305\223eGW7\021\353I1\341h\354\345$X@\225\327\231=\256\255\033\033|\360\252^_\344)oa\0309\274\237O\341<\001\317\366m\326(>\3619\206\301\345\265~#\204\020)e\n{"
+	.string	"p"
+	.string	"\201"
+	.string	"\247\324\n\247\224\3105\244LQl\211-\245>[C\263\234\236\231\023\322\350\3538[\364MJ\247\260j\377\2056\235d5\256\020u\025\031\330\323\244\206\013\363&\277F{\204\263H\2472\223\325\370R\265\024;\260\347\025\314\366\264\255\200\r\200\356i\326.\374sl2\250\246H#\036\245X\255\025\327\310\025.\013\277K\264\264\2421g9mPk=\027\215!\366\275\377Q\376o\370\315\026\001\333#\354k\371UC:Q\223\226\206\324\001\266\003\214{\223k\033\362\330\267\271\227'\310\367\305\302\360}\205\376\243\341-\356\371\245A\367\334&\340Ub\310eg\2502\255\312c\177\222\310\235\342_\2636\320\217\362IL\376\210\311\027A\3715\223\037b\362i(\177f\362S\223\217\236\374\323\344\233&\277\231\317\315\337\022"
+	.string	"#l0\b\253\025D\031Y\315\n\275J/\246\256e\217\222im|f\375\235\2614X$\264\264\244=k\006\202v\332&.[\245\353\342\361\207I\006\025\332\253T\332Z\326%\245\r\376\f\243\214Zg\177\245v\352e\002\fL\221\207\331g\267\325\316\3250j\177\274D\247\326!J\267\331'O;,\210\317m\224\256?\230 ;\026\325\252\263`\225~\016\013\265[\271AFVTkU\211\261O\274\257\320\236\217\351]@\367\354^'\025G\311G\220 %\205\202J\n\357f\273\314\rW#\023\323\303`\341\344\206Wa\246\227C\277\273\3754"
+	.string	"y\301\034\220w\323\363\345lfx\276\\\320\267\303\315\364t>\334\016\030\304\335\n\374\227\201\007\304\325\374~@\\-9\\\022Y\303&\236\304\313\301H\2234\373\020\351\221\036"
+	.string	"\344\301\342\320u\207c\220\013\256-\221^\246\246\254\345\217S\323\322\210\250i\261@h\341-\206t\255[I\353\2206\261\212\260X\272\366p\004j\272\262\242\005V\2501H\305\220S\346f\244\270\250\315\0300\003\221)\325\001\022\300%!\321!c\004\206\013*MZl?\007\035U+\211#j\351\373#\n\223\325\232\002\b\366\017!#G\006\376\366\210*\360\031\021\030\004\211\362\244a\332\266\224h\\\0028fK\252Iw\264Z\204\223d\020\211\343\276\233H\251\311A\330\321\255\276\331\346\226\327nC\233p\002SF\030\364\277\215J\317\033]Gl\265A\2252%`\372\r\335\352\372a\350\304\252\201\320@\033h\361\364^\274"
+	.ascii	"\307cD6\343\371\367\273T\376Z\006\016\277p\262?"
+	.text
+	.section	.gnu.lto_saveMotorMixerSettings.97.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`g\004\375\026"
+	.string	"\226\346\214K\240RR:\362^\\\004\266Q\3541_\f*\223\201\251\337\033\2011\201\t\300\226~N\356x\225\316F(\362\237\215\033\213\325\355\260\202\216\337\337\313\3745\027\217\2670\236B\247%\356\252[\210\325{\312Iu$}m\373\204l)e\nv"
+	.string	"i"
+	.string	"}"
+	.ascii	"O!\232pYFF\034\326\226\022\016\313(\206\343\023k\"r\322\372\315"
+	.ascii	"\026\277H\270\252\331\377`M\347\254D\005E\253\"\201-MN\2640\357"
+	.ascii	"\371E\261)nV\305\221\364\254\304\375\371\341\332*\260\345\021"
+	.ascii	"\304\266\254m\311\222\230[\322\331\203?\216=?T\030\221\023\217"
+	.ascii	"q\253\326zk\242\r.\007\277{\264\262!\021g\031\306\240\326z\036"
+	.ascii	"\0227\354{\377\243\374\327\360S\244.\326\351\245\027"
+	.string	"\023\323|\005\304\335\275;Z\333\334\313\363\343\313b[\370\276E\377\315\360\016\267\374\316\230[n\257\r\020@B\376:\0379LU\356\372\317\034n\017\377\322\332C?\345\323(\177\304\344\213P~\b\345\317L>\b\345\313(?f\362a\224o2\277,\371\224\362\233\371\334\374-\241\225\220Z\320\243\326\236/\257\232,\003 \275\310\021\262\376q[#\271\004E\003v#\326\262>I\352\252JI;\023\202u\f\2713XZr9sKX\257\f\021Sf\377\0216\306\217\276\240bP\202M\372k\366IBN\311\313\253XkUy\2610t\337\242-\357\262\343\231[\0060\016u\034\327\307\001\350\324*D\3516[\200q\007*\347\334=Z\b\\Z\\Z$?\035\026ie_=;r\354({\317\255\t\271\353\264\3137p %e\202J\n\317V;\214\355V\003\363\322\263P\341\304\206GA\246\2473\277\263\3752"
+	.ascii	"y4: \317\246\347\323a\220\341\371t4\276\335M\246\347\342\273"
+	.ascii	"\355\20047\333\200\377.\360\200\267\232\337\017x\233\235\302"
+	.ascii	"\245\265\207\276b\")\354\234\323\372o\260WV+\254\252\242F\232"
+	.ascii	"\326&<\230\204\232\230Dz\204\312\201H\357\221DH\377+;E\305$\225"
+	.ascii	"\314\232uH\237 \227|\214K =\213by\220\013Z\2501T\247 \231\242"
+	.ascii	"\021\221\202\244\244i\f \003\221\251\325\030\022\240\006)\017"
+	.ascii	"\022B\220@Q%%\305\366s}\330\265\275#\216\324__\230-&\3618\365"
+	.ascii	".8\220Yt%\305\250\363\271IZ0\271 \301 h\235@=q\027\260\265\257"
+	.ascii	"l\232\373\2740\232\365\313\370vv\rP\224\231\375Z\273\332\375"
+	.ascii	"^%\346\n\220\b\200\220\020\237\214}v\033p\277\317\003\030vP\331"
+	.ascii	"#\204\037\252y\377\250`\311\261\035\271W\332r\022]\312\036\004"
+	.ascii	"\325\211j1\310T\003\034\254SA\250\006dx\232H\2447\346\361\345"
+	.ascii	"\2763\034\250\205\206\375\001"
+	.text
+	.section	.gnu.lto_cmsx_menuMotorMixer_onEnter.98.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"}\b"
+	.string	"\262\217:9@o\323\001"
+	.string	"e\2438C\271\304?F\235\357SD\352g\210\331\225s\200\013~m\310A\215q\205D \324V\375\330U\004{\376\337H3\r\013\210\204uan\326\215\354-S78\3204\210\004\215f\236\332\331\210\352\\\326UX\352m\226Z\200\352F\021\242u\363*7C\240\207:9\353\315\354\363N\202\3329\321uvvn\263\312\245\340\241!E\307P\252\370_`D\016\357\021I\360X*\232\240^:\316\374\027\214\362\343\347\252e\351\227X\212\013\003L7G\rM\267X\251\220\377\337\337\371\007:\0268\362)\203\001\272K2'\335\267\340\b\034\266\376\237G\230\344\373U\b.\bicZ\331(\211\351\356\371\313\002\027[\034\016\270\330\222&\3768~gFq%rb\tG \307MCw?\206#\022_\362\377\317\177\207\3777\r"
+	.ascii	"\002\245\343]\340\231\241\301\210\023\001\274ph\316\266V\204"
+	.ascii	"w\r\257\260hz\b>\374\314cj'\031"
+	.text
+	.section	.gnu.lto_cmsx_menuMotorMixer_onExit.99.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`L"
+	.string	"}\b"
+	.string	"\262\217:9@o\323\001"
+	.string	"\326X\327#\363\025~\241\357\315\302\273\211\2779f\375s\200\013~m\310A\215q\205\344vt\031m\370\030\336\364\220\024\214f\032\026\220\333x\377d\335\204\354-S'(\3306\207\203\255j\234\007\210\nV\357\264\217\302V\220\263\265\302\343q\023\237\352q\240\327\321\217\247\301\243\235\005\251\326\371\027Q-\225\370>K5\267\331t!pdL\320\263S%\177\213\013\311\3439\240)>s\221%-*-Q\377\025\345\354\370\271\3529\372g\006\223\242\220\352\336H\3054\212u\362\361?\3745\377\006\225\300\222G0\030\240{\364b\322}\007n\220a\353\3779\204E\302\337$p=D\030\211E\203\344\324\335\364\2277\027[\031\016\270\330\232$\016Y\206g.q\005RZ\031C\"Kl\241\273/\307\220\210?\371\177\347?\303\377\033\r"
+	.ascii	"\002\245\343]\340\231\241\301\210\023\001\274ph\316\266V\204"
+	.ascii	"w\r\257\260hz\b>\374\314cj'\031"
+	.text
+	.section	.gnu.lto_cmsx_menuMotorMixerIndexOnChange.100.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\035\f"
+	.string	"F\026R@"
+	.string	"Q5\035\274`\r\372{kE\361\202r\224=\360\211,\342\264\026\3234((\001\250\270\260!\017\277#\222\b\212\f\025\017\241\314\275\275+\302\2373=\240|\345{\2726\023\nD\030lh\313\224\002:"
+	.string	"@"
+	.string	"?"
+	.string	"\222c\266\375\023G!\332\257\n\371\001\025Y\225\026X8vw3yJvLr"
+	.string	"\331\261\271\272x\025\375\2538\304\204\213\326x\"]#\bv\327:\236P\367\274\355\213m\316\376\202\232\303&I:=\330\207\354T\331S\255S\375\210VbF\202\326\356\205R\307\312\300\\#l\213\366\304\246\304\320(i\033\025\217\245\260BDGr\214\002Cs}\212\t\377\330U\355x\261K\0060\201&k$:um\230-\032\314\032\343\215\227\367\262O\235\257\300\301\244\245}\026gy~\b\177!\375x\314\017e\307>\017\200H\225\264\264\246!S{\004A?\332b\232$k)-\203\2720\320\330\240\b4-`@&\323)\220\3410\026\021\370)\220\300q"
+	.string	"\n;\006\023{0\337\003\220\0137 \027\241\3636\243\017\347mB\317\263}:\216\267y\300p\303\\\374\2018p\023}\037\270M\310=d\247\312~e\006:\224f\026"
+	.ascii	"9J\337\273\0303\361\270(\262\365]\204r\331\330#\2079\020\f\\"
+	.ascii	"\301\324\020\231*\340\234\267T\032^\021\3365|\231\205\323\230"
+	.ascii	"\200\206*G\250q\303\3174\246v\222\001"
+	.text
+	.section	.gnu.lto___compound_literal.25.102.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 oy\003"
+	.string	"/"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001\001\005\001\006\035\001\f\005\001\212\001\202\200\200\374\342\203\317\264\031\001\177}"
+	.string	"?\202\210\200 {y\275\001w\273\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms/cms_menu_mixer_servo.c"
+	.text
+	.section	.gnu.lto___compound_literal.27.104.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 u}\003"
+	.string	"\024\0065"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006'\001\001\350\007"
+	.string	"\005\001\212\001\202\200\200\374\342\303\317\264\t\177}"
+	.string	"?\202\210\200 {y\276\001w\275\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\277\013\250r8\245\025\f\024\001"
+	.text
+	.section	.gnu.lto___compound_literal.29.106.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 v\205\003"
+	.string	"$\0066"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\320\017\260p\005\001\212\001\202\200\200\374\342\203\324\244\t\177}"
+	.string	"?\202\210\200 {y\276\001w\275\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\300.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.31.108.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 v\205\003"
+	.string	"$\0066"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\320\017\260p\005\001\212\001\202\200\200\374\342\303\324\244\t\177}"
+	.string	"?\202\210\200 {y\276\001w\275\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\300.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto___compound_literal.33.110.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 v\205\003"
+	.string	"$\0066"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\006\031\001\001\320\017\260p\005\001\212\001\202\200\200\374\342\203\325\244\t\177}"
+	.string	"?\202\210\200 {y\276\001w\275\001u\274\001s\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\300.\242\312\341\224V0P\004"
+	.text
+	.section	.gnu.lto_cmsx_motorMixerEntries.113.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\302\001\265\r"
+	.string	"D\025F\002"
+	.string	""
+	.string	"p"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\330\312\022\001w\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\004\013\202\200\200\270\325\304\003ig;\206\be\254\254dc\310\311\001q\307\001o\306\001m\305\001k\304\005\370\324\304\003ia@\206\b_]\316\317\001q\315\001o\314\004\270[G\254\254dw\324\325\001q\323\001o\322\003\n\317\304\003YWM\206\bUS\333\334\001q\332\001o\331\001m\330\002\t\270\317\3243QO"
+	.string	"\350,\177M\341W\350\f]\343\344\001q\342\001o\340\001m\337^\206\bK\234\254\364$I\347\350\001q\346\2738G3\351\0014\345\001\336\001\335\001\327\001\326\001\321\001\320\001\313\001\312\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004YAW"
+	.string	"\006PITCH"
+	.string	"\005ROLL"
+	.string	"\tTHROTTLE"
+	.string	"\006MOTOR"
+	.string	"\022--  MIXER --"
+	.ascii	"- \360\002\031\241\352\001[(\320W@\036\301q\253s\311\326\224"
+	.ascii	"d\204-\034tf X\r\361\357\215eG\331Y\224\315y\224\306\350\316"
+	.ascii	"`6\222\256\037\022\203\273\204\270\311\324(\375\306\266`O\306"
+	.ascii	"\362\315\340\033a/g\276>\276\326\350g\304\213>\317n\215\355B"
+	.ascii	"\b\034&\022\030\002\356\226\030z\270E"
+	.text
+	.section	.gnu.lto_cmsx_menuMotorMixer.114.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006E"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\206\200\200\374\342\203\337\204\005\177}"
+	.string	"\005\001\006{\001\202\200\200\274\236\360\245\037{y\370\335\204\005{w"
+	.string	"?\202\210\200 us\276\001q\275\001o\274\001m\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\004"
+	.ascii	"\265\013P&\2419/\033@\021"
+	.text
+	.section	.gnu.lto___compound_literal.37.116.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\351"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.38.117.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\352"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_mixerServoEntries.122.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\304\001=\r"
+	.string	"\304\024/\002"
+	.string	""
+	.string	"\211"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\310\315\022\001w\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\006\004\270\354\264\003ig;\206\be\254\254dc\307\310\001q\306\001o\305\001m\304\005\370\347\264\003iaC\206\b_]\315\316\001q\314\001o\313\004\270[P\323\324\001q\322\001o\321\003\016\202\200\200\370\346\244\003YW]\206\bUS\332Qs\333\001q\331\001o\330\001m\327\002\202\200\200\270Oh\206\bMK\340\341\001q\337\001o\336r\206\bI\234\254\254&G\344\345\001q\343\2738E3\346\0014\342\001\335\001\334\001\326\001\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms_menu_mixer_servo.c"
+	.string	"\007SERVOS"
+	.string	"\f MIXER"
+	.string	"\fMOTOR\nHAS FLAPS"
+	.string	"\tPLATFORM"
+	.string	"\027-- AND S --"
+	.ascii	"-  \003\231\241:\037B#t\214\300\371[m\347\177!\337\360u}S\220"
+	.ascii	"\266\246TF\3019X\214\3017B_\247Q{\225\244`\033\331g\354\324["
+	.ascii	"\226o\203\225e\037\313d\202\033\006\333\b{9\362]A\024\243\227"
+	.ascii	"\021\314za\344\335\2655\034\375\217\257\013,J\016=\300\""
+	.text
+	.section	.gnu.lto_cmsx_menuMixerServo.123.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375 hA\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\366\204\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/cms/cms_menu_mixer_servo.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\234\002\375\013"
+	.string	"d\021\230\003"
+	.string	""
+	.string	""
+	.string	"\0029\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\0056\026\300\204\001"
+	.string	""
+	.string	"\003\005\374"
+	.string	"\027`8\030\002:\177\031\002;\177\032\270\320<\177\033=\177\034\0057\035\002\315"
+	.string	"\177\0363\037\375"
+	.string	" 5!\316"
+	.string	"\177\"\002\317"
+	.string	"\177#\320"
+	.string	"\177$\321"
+	.string	"\177%\0054&\340"
+	.string	"\177'-(\376"
+	.string	")/*\0050+\0052,1-\002\341"
+	.string	"\177.\002\342"
+	.string	"\177/\343"
+	.string	"\1770\344"
+	.string	"\1771.2\005\373"
+	.string	"3\301"
+	.string	"\005\372"
+	.string	"4\300\003\005\364"
+	.string	"5\365"
+	.string	"6\362"
+	.string	"7\301"
+	.string	"\005\337"
+	.string	"8\313"
+	.string	"9\361"
+	.string	":\300\003\005\346"
+	.string	";\350"
+	.string	"<\352"
+	.string	"=\354"
+	.string	">\356"
+	.string	"?\336"
+	.string	"@\323"
+	.string	"A\325"
+	.string	"B\327"
+	.string	"C\331"
+	.string	"D\333"
+	.string	"E\314"
+	.string	"F\301"
+	.string	"\005\312"
+	.string	"G\300\003\005?H\301"
+	.string	"I\303"
+	.string	"J\305"
+	.string	"K\307"
+	.string	"L\003\005"
+	.string	"b\003\006\004\242\001\003\007\302\001\003\007"
+	.string	"\202\006\003\016\tb\003\017\r\020\r\202\001\003\020\t\006\003\032\022b\003\033\031\034\031\034\022"
+	.ascii	"G\250Q\004\024L\362\372\237\001P\023m\362\021p\f\006\243\241"
+	.ascii	"\310\362\325\001N\372Z&`'p&8L\\\r\275\376\256V\213t\256\301\322"
+	.ascii	"\302\255\324\241\352R~)\\\035uZ\013\220\262y\230\354S-\341\\"
+	.ascii	"2\024$m\371\306\226\372<\216\304\253\005<\"\034T\210\277\244"
+	.ascii	"\310\262\325\025\222\003\311i\207\345.\007B\211\215U"
+	.text
+	.section	.gnu.lto_.refs.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\355\b"
+	.string	"\006\031D*@\3056\303\001\3030\f\3030\f\3030\fQ\210q\003|\202h#\354\rl\342\212e\335h[}\327\216\335\177\313m\355\2262\005/"
+	.string	"3"
+	.string	"="
+	.string	"\216\257\366}\314\330m\361\007\277\261\024g8E=T\376\250o\312!\352W\371\200\272\261\236\024\227\372\221\342P\337Q\274\3513\305W\277|\366,\020/E\274\340\375\203x\344}{\370z_\311"
+	.string	"\330\353\301\231\310N\237\032\227\334G\215C\356\235\306\033\367\254\361\345\b\330\223\343R\373\310q\250\275\343x\323\236\005\245T\201\241(SG\023\224C\233BZQ\n\025\320\202\"\250\204V\212\320\001=\250\201\303\240\023_\022\316HS\372\345\361\203\311O\217G\321?\217C\240w\217;$\337\347"
+	.ascii	"l\313\204W^\253fP\025\203\252\027T\265 [\301\214b\364\242\026"
+	.ascii	"\255\350@)\030\327\t\272J\220@]#\352\n\301H\0378Q\211F\024\242"
+	.ascii	"\017u\352\300L\332\300\250\f\204\272\300\247\027J\265\260\241"
+	.ascii	"\f]\350\245\226\003\020\005\223\004\242\240$\005f"
+	.text
+	.section	.gnu.lto_.decls.bf5ad7e0e7509230,"e",@progbits
+	.string	"(\265/\375`\020<\245\351"
+	.ascii	"\nd\355MS \fQ\272\320\0016T\335E~\334\250\235\035/\356=\016\275"
+	.ascii	"t\260Kq\374\027\016#9dQ\017\034\360kqQ\243k\364\rm\0273u\026"
+	.ascii	"\235\230\245&1\271\220\036Y"
+	.string	"/\272s\022\033\275ZD,\030N\327tX.\273\210\354\305\027\250*\266\321\332\336R\246\n\004\306\004\375\004h\006yM\337~\342f\0379\3159\220\325\2742\357ur\0040M\237\340\341xn\356\265\242\206\310\357\307G\372\310\177\207\343A2\257\216\021\002\261\320\332N\006\026*\234\372\036\263|\371g\210\241\271\354[i\337S\366\035e\353\335\031\276\234\345\232\036\177\227\247GT\325\232\256y\335\003\314\223\231\275g\225\032ZU\272\3521\221\266L\220/4\200\366|$\013\335\223\261\200\261{\222\3412<\206\303\260\030nr\036{9\177a#H$y\354d\356\254\013\343\361\0341\\(<+g\3672/\"\217\2710^\330\225\347\275\314\016:\030\362e\311\332\322\251\347<;\344,\366\034g\317m\226\357X\0137=\360\026f\317\316\032!k\002\213\330\263\207!\017\262\207\3419\210\345\200\177\354\352\206K16 ]\251"
+	.string	"\365(\007\225i\350\200v\306\250\261\3032\027\345f\n\353\313\213+\035l\202\304}\215Y9W\261\307\260%|]\2510\201\372+OJZ\327s\016{6\022\202\b\216\302N\330I\231g6K\240\324<\221\274\245\341#I\330\215\347\t\303EB\005\236\335{\345X\nO\3418nr\024n\362f\336\373\020\177\3209\n3a7\312t^$T\\\003\300\340\244\264"
+	.string	"\357\275\035t\320\001P\007\002\310\033r\304\251\374\204\241p\023\210\341\036\202\210\323c\222Kd\013T\325\214\256?\201]\301\035d\240\341Q\330\037\331\023\355\211,+a6nv\340%g&#\271\360\211y\231\367\336\0366C\006u\325\365+X\035\241s\3339l\271\"~cUp/w\030\362\340 w\030\276-\006\376\0316\373\f1\340\237!\b\376\0312\021\0174I\265\274n\36723\3640a\270\020\353z&\377\f-\373\f\355O\277x\374\275C\250s4\016\001\374\324\354\311\317Y~\326\3623\336\177\372\323\267 qM\306C\355~|\350\341\241\303\317\201?\257\371y\360g\301\277YX\204\356\025I[{!MH\223X\220%A\233"
+	.string	"hp\203\222\340k.\330\203i~\346\277kp\216\376\322\340\177\n4\350\210.\013\344b\374\r\343*\003\r<\374\325"
+	.string	"dH\210\031\361w"
+	.string	"\376\036\300\337\036\376\376"
+	.string	"FYQH"
+	.string	"\330\001\300\270\256\363S\007py)\200\252\213\2040V\367\371i\210\377d\304\200\t\3633\316\377\254nQ\225\374\206\237v\370;\001\177\037\377\276\177\243\340\357\023\374\255\342\357\024\177\243\370\333\351\357\246\277\213]\202\277\231\376F\372\237\341\257!\370\231\311\317n?\277\375\354\344g(\314\023W~\246\362\267\013\177\217\340o\026D\020\202\277A\360\201\025~\026\361s\320\317!\374,\302\317!~\366\300\337\035\3709\203\2377\370\371\303\177"
+	.string	"\374\225\350o\005\374\355\200\277\033\360\367\002\376\206\300\337&\300EI)\201s\370\367\315\337\302\277\355\3379\177\327\233\277\036\375\334\367\263\231\237\367~\346\373\371\317\346\257D\251\367\3744\303\317(h\023&\216\363\323\235\237\221\272\304\205?\275i\r<\360?\334\377)\177c\340\277\224\377\316(\177_\200Q\264\0058<"
+	.ascii	"\377M\374=\342@\177\323\375\035\201\277\205\376\036\341o\021"
+	.ascii	"\376\016\341o\020\177\177\360\267\006\177g\3607\001\376\336\360"
+	.ascii	"\267\206\277-\370\033\303\337<\177\353\374\335?\003\376\\\346"
+	.ascii	"\347\274\237\305\374\f\346g/?s\371\271\312\317p?\027\371y\355"
+	.ascii	"g!?\007\3719\355\347\037?\367\370\331\354\347\035?\227\375<\366"
+	.ascii	"\263\330\317`?\177\375\354\365s\327\317\\?\307\370Y\353\347\252"
+	.ascii	"\237\251~\226\3729\371\363\212\237\221?\247\340g\025?"
+	.string	"\277\3603\323\317I?\017\377/\371y\205\377f\224~>\361s\t\377\267\374l\363\263\360\347\372\237\357\377\336\377\347\377\272\377s\377\257\374\267\362\277\312\177\"\377I\374\247\373\337\301\340\340\340\340\217s\377\033\r\376\003| \3543\324a\262\317\3606{\326\347LU\025\3431\363Z\341\270X\352\371\001\316Y\016\\TTM\206\253\\=?@%V\303\222JQ\2512\317\253dzp\2334\313\341+\231\354\032k\\\226\303\022\272\202\256\310a\003e9p\031\034\244H{\357\345:\243P\247\310!\324\212\301\027\364i\370b\312\224\021\372D\217U\250\260\270\264\232\233\027\216:\251\256\364\276y$\205W\315\036T\362,\32010\260\005\273\305\263\325\274\005\327\2420\373\030/\314/\017\256\353\207sVC\231\320\033M\263\321p\035M\336\372\344\251\347\247v\225J\017>tbk\025\241\267\231f\233\351\277Nr\2179a\203RD"
+	.string	"\357\335\362\240\236\251\215\231\352\372\376\373\233\257\317p\035/9\364\340\340Bb\351\332}Ao?\237\241r\213y\335\206k\320L\271u\355a\237\241\275w\210f5h\tu\031\356g\263\237\214\007\264"
+	.string	"'\231\347U:=\370\020\314\236\031o\b\304%\324bz\314;\357yM\3062\257\225\215\231R\317\017\360n)9 SF\270\005\215\007\2230\366\357\177x_\b\231\327\t\245\303\034\374;L\231"
+	.ascii	"\377\353\275F\367\036\355\356\316\f\347\300b\234\301\340\376"
+	.ascii	"\367\270TfH2\331\300\224I$X\fN\262\201]%\331\300\216\235\254"
+	.ascii	"{\272R^\260\243\275\313+\233|\272\227my\257r\230`\3672\301\216"
+	.ascii	"\226\371\244\274I&"
+	.string	"\3302C\022\tv\305I\266\253\274\310\253\264 y\357\325e\003\333\343\344\005S&\331\226W\031.2\310V\262L\224+\026\302l\356!I\"o\325\005j\310\245\362.\311\\\262\363\336\243\333\212\253d\346\275`\367\316X~p\"y\034\235PwU6[H\346\221\271\\@\205-o\230P\367.\211\266<\261\342^0\327\205\bG>\262\270PG\276w\005Sy/\324\222\205\255%sa\241\274;\027\371D\005\025\266\324Y\001\265dq\321j\360U\222-l\031\024\327d;\273P\314#\237]0`J\313vd\336\344\275\227\371v\376\240t\001\f\003FgMs\257HW\257\235!4\236\344\021!\322F\314\b\245\211h\302\365\344dV\340Y\265\333[W]Ci)PUOF\302\204\361D\370\261\0343\003\260\327\272\256\251\364\034e:-\013%eX\222t[3\354\313\b\022v\222\2355\223\235 \322\224cf"
+	.ascii	".\3516\276\333\272\307\275\f~\334\215\231\001x/SK\177i,\235\245"
+	.ascii	"\357\332\256\271\364\226\366\322t\335\245\361\270\331u\335\365"
+	.ascii	"\236\322r\007\nQ\327N\030\217\357\266\3709f\306\326\275L:\325"
+	.ascii	"#\306\213\013jWi+\334\334\240\257t\231\340\233\022/{\336`H\007"
+	.ascii	"\007y\203\341\205Z\2661`\037)Qx\346v\320\210\3215\216i\337\302"
+	.ascii	"\340yu\275\360\350l\270\2355h[f\220\261\257^\354k\026\373:g_"
+	.ascii	"\345\354\253\323\2766\261@\265\210\355\266n\266n\276\333Z\211"
+	.ascii	"\016\262\333\352\275O\314\037x\230?\b\345v<)\031\326\327 \366"
+	.ascii	"\325\314\276\332\260\257]V\210\177\206]\304\332M\331\030\322"
+	.ascii	"\365U\312\236\346\331;\371g\210\020\252/.htm57\244\216\034\231"
+	.ascii	"5\037[\200\264\217\376\321i\215\306"
+	.string	"M\036m\326gId\267\350\261E\344M\306[\266F\204\271\300\321:x\np\257\330\340Y\220\246j\027\224\355\354\246\n\252\212\211t\220\226\352)&xV@\035T\2522g\366t\352i\235e'\377\f/`\237\341\r\216\335\037\327\231\234\315\261\225|b\244,\307Z\326\230\216\233\270\3004-g\217\365\215\266\301\315&;\220Uo\t\255P\336\274\b\233z\336\313\366\020d]u9\212Di\227\204Q=\311\232\253\305\370n\213y_\364\340IuY\001\274\227\255\203\334U\215,[\301:\254\006S\016G\0301\260\032\024o\315\231\243\227\357\032\257\273A\332!\261\352\3322\372K\307\317KX\223/\032c7\266\304\350\352\305#\305\213T\026\f\373\317\350\256\263\310\"\363#i\337w=a\2233\027^\272\236Bu\214\034\262'w\201{\026\206V\330\033\031\220\276\267Vg\351\334"
+	.string	"\354d\305\300\002\330\354,,\024\200t\215\351\332W\375\342\215\325\312\306\022ay\357Sc\365\250\271\367\251\207\371\003\363\207:$\314\214\311\260\276\363\354\033\317\276\353\354\177\275?\231jB\254"
+	.ascii	"\2530u\254\254\312\226Q\354\335\370g\310\342\306\013\231,\026"
+	.ascii	"\227\312\361-A\263b\003\213\224\322\204HG5\262\2425\351\003\322"
+	.ascii	"\265\241\230Nl\242Hy\272\350\372n\263\017\201&\200f\320\340\256"
+	.ascii	"T+_\232u\325\312_\2530\226\306\322\201b\3276\326U\310>C\366\013"
+	.ascii	"z\245R\305\374\254|\310\265 \340\\\227\026S\310\3247.\262\260"
+	.ascii	"\256@_P\252\224\n\245F\2719:q\302\275F\211\343\262\26115q\325"
+	.ascii	"YF\356\351\217\212m\361\366u\245f+\324\034\326\214\256<i\360"
+	.ascii	"\254\376\232\364\037O\237\221%\201]\201\220T\266\312\204\255"
+	.ascii	"\276\261Ry/\001\360\266\2628\370k\333\353[u\243b\324\326\300"
+	.ascii	"\252[]r\374\272\002HE\207\223\n\\mr\223!ffQ\227\253Zqkv:\352"
+	.ascii	"\220:\244&\371!\264vW\221hPe\212\232\032\366\335\342\255\313"
+	.ascii	"\021#\314\204\235QF\210Tf=R\213p\263\032qb\204\322\3255\033E"
+	.ascii	"\236\275V\215\320,\354\214r\343\241\31227W\327\330\351C\013 "
+	.ascii	"V\327g\240RSs\376\001\001R\251\024\300\304\260\005\r\255R\255"
+	.ascii	"ax\342\303G\027\002\3260\250Y\rM\316\316\204<1\200Y\r~Bd\334"
+	.ascii	"\254d\225\007\210#v\311E\331C\207\316\211+@\352\216\277\342\250"
+	.ascii	"9\272LgG.\020\207T\327Z\026\364\252\203L\007\020\270\256\033"
+	.ascii	"\330g\230\303T\303 56F\001\233\356z\316\210\211U*'\226\255s\263"
+	.ascii	"nU\260\213%\002_\255\241\323bE\027\032Sl\375\342\033\\^uYip\263"
+	.ascii	"~\375\225\253\312@.\331\252_\265\253\316\270!CG\b\024%~v\206"
+	.ascii	"\016/O5O\272\276\007\212e\240\0365\0300(\340\217\005\360\235"
+	.ascii	"\201\325\254\232\005\202o\331Ce\177\216\365E}\201\301\336S\317"
+	.ascii	"\017pO\251\\\322UUU*{\311\230dX\254\245\344i\253\310\212\254"
+	.ascii	"T\037\264n\235\252L'\226\224\020\373^{c7\033p\317{oMR\272\032"
+	.ascii	"\325\366\244\262\250RuEm\301\315\232\354\243Y\330\315\312\031"
+	.ascii	"\221\232d&\354f\003J\227\025\033*.h\262j"
+	.string	"\024\273U\033=\240\254\205\245IS\237\370F%\243\236\320\f\200\365\254G\034\254\267&N\030\366L\204I\317Ea9[\343\267\266,\202\224\216\006v\261SC\007\353\245k\270I\005\005i\226\236\343yb^\245M\033\030\233\264\025Oz\201=\027#*\260I\327\363\334\347\271I\237\024\020\303\215\273\316\261\031\006\300\272\243\177@7[\272\\\221r\306\276\327\250\r5?\312G\315\3203\334\244}\007\352\243tt\217E\333\216g\267xc<\036\263\263>f\302x<6x0m~\004\371R\005g\017\017\317\216\n\n\213\375\211Q\246\f\326\316\022\253\201J^\036\003n\324\300\374\231Q\263?Tb\304P\270\n0\357\321i\251\347\247\226\243\205\006\224\234\230\375\001\003\003F\353\256\257\f\312x\353\372\035\245\027/\224\313\003\216L\262#s9\365\374\324t\322\330\263\020\346&\275B\271\330\273\025u\263>p1\361\2066\266\242"
+	.ascii	"\311\263\017A\265P:ZG\331\316\354T\224\340\035\335\302M\252\205"
+	.ascii	"\332Q,t\256\335\030\311\037D\265\320,=\305s\354\262\206\356\320"
+	.ascii	"\323\2616\254\327\371bu\256Xf\216\223\306[\226\234\245G\354\217"
+	.ascii	"Y\0347i\034\255\202\365\201K\231\345A\013\271\031\222F\311_\327"
+	.ascii	"S*?\215B\245P9\026l\370\374\314\234@7GA\260\034]\371K\320\351"
+	.ascii	"\224.2\226\314\3215\347\f\210\016\231\375\031\"\304B\230\036"
+	.ascii	"97\351\021\nw\223\274\367\305\207.\246\236\037\340U\316\360\300"
+	.ascii	"f\312\321\213\255+\205\202\267\344\214`\327\353|\331%TIU\233"
+	.ascii	"W\023\372F\231\320'\334\244N\356F\237\246\332\310\330h\323*\212"
+	.ascii	"\306\223:\241L\252\204\247\355Kg\357\007\035\016\234z\235\030"
+	.ascii	"\366:V"
+	.string	"mt\314\0212qk\354s\376h\022f\325\n\362\226\006\306\"A:\201\302$J\327\347\320\331\347,\261>E\212\024q\346\354\260?J\326\326\272\306`\016\225\375\031#DH\231=\273!\031$\bE~\261;\223\263\033l\244\245\241\3011b}\260\b\235\376\370\001\346\fg\207\365\351\321\203\335.\274w\031\346L\206\365\221\"tjf\306n\034<\300\231\345\211\223\264>nB\247;\232tG\3175\363*q\312\356\314\330\376\"tJFF\313j\222{\374\300 \026\032\017\324\032\036V]O\313\232E\367\322\017\213\223\256\024G\320i\016!\027]\215\262\25697S\254\217\217\261\261)\346M\021\273\241LL\354\317y3f}\006\205\350\222)\030\330\231\236\037\340\r\225\345\r=\276\276\272F\340\030\273\341\212\227\227\030\247\335\340\327\325E\221]\256\234\241Y\016X\\\\W\254\227\325 %t\032\343\334\2441\230\217\203\233"
+	.string	"\246\265\2624\214\320\251\262I\225T\253\314P\n\334\222j\375\364\212\276`>*&\215b\005\235f\355X\271\361\354:\200D\244\026\210\214N$\200\214DKH#\020\002e0:\221\260 \007\247\004\022D\204\320\220BS\322\t#8\004\205PBP\004 `\202\230D\244$$ADP\210\240\020!\202B\344\224\240CB\bB&R\030\261\201\034\021!\360\b\031\231\210\306\246\3324D\201\024F\2300\201B\211\035$\"\024\224\204\020\037 \021\025\211\306#\244!#%\247%\246\244\245\242\241\241\237&\342\321P\t\022'\330&\342Q\321\250D\264\261)\032U\310"
+	.string	"\006\245\245!\017\022Q\013KH\024PZ\322\361y\201h\005\f*X\200\204\264\244\201\f&\230\222\214?*\212DIGE&\022LI\306\016\030\030\217R\\\260\241D\322\222\261\311\251\310\303\206\rFHK;D\027\2242"
+	.string	""
+	.string	"\343Q\212\237\"\321\250\204\202\322\322P\212\246\244\242\rD\024DM\031J0%\031wT\020\025\213\020H\"\032\233T\224\030j\342\220\202h\2444\302\250D,\026\235\2122\\\203&\027\224\216\214Fb\211\022FDKH\031^tT$*\021]\260\027a\204\004\214 \224\302\346B&\2000\001\304\360B&\004\005\2310B\220\375\bA\364'>"
+	.ascii	"\241\251HDqT4\362`\213D'NHA\224dcl\032\342\200\017\021\251\005"
+	.ascii	"\"\023(\206\304\242#\024D\243a\323\013K\305\332\204"
+	.ascii	"\264TT=\260B\323\022SU\"\022\213EMHHN\023"
+	.string	" 69\355 --E`HhD,\022\021\221\212l^X\322@q\251\251\350TtcTrZ:\241\005\242\242\0137\306!#\206&\242\321\251\205\243\242\321\b\001c\n\242\t#\242\261\270\304\304\344T\302\210x\242\210\250\310\303\220\004Jd\340\246\311\005\"\244\021\b\215\210$(\"b\032\032S\020\215UE\321\250\204B\t\022'\364\030\233\206\214\305%\025T\020!15\035\031\355\324\242Q\205\"%\247\t\030\2312\340\244D$Q\202\304\t\031\212D'\212j\221\222\323\b\254\321\210$\242\361hHd$2\252D&\025\306j\274\340\005\"\025\264\270d\\J\322!\"\031\215K\305\023F\213\204\264T\254'\212\214GLB\243\321\b\245\245#\343\221\221\322RQ\016\t$\242\222\022\321\211\023\214D\027\212D\306\035bQ\321i\251\204\321\211I\351\310\311\306\210Hdj\022\032\177\342\203&\020\214'\\8B\032\001"
+	.string	"\276\304D,\202`\\Z*\202\220c\034\0222*\035\r\211F\242bm\032J\"*\022\251\240\243t\224DS\020%Q\343\320\bAF\245#\233\007\211"
+	.ascii	"\002D\013B \210\037`\360\022J8\001\203\r\244@\001[\364\301\022"
+	.ascii	"\212\"\261i\250HLq\2244\344\244DL\032jJ*\002A\351\210(\t\204"
+	.ascii	"\242b\023\b\037\030\200\210ddt\22444\023\362\2201\246\n\232\220"
+	.ascii	"\307/\324!\334!\314\221\005\345\257+\253\361\317\220C\031\027"
+	.ascii	"\030>\232`\345\240p4\217/\r\r\307S\217\340\214\274.];\340\b\023"
+	.ascii	"\222\205\to|Q#v\341\215\261\272#H\030\2761\241\215\037uz\364"
+	.ascii	"(6EWe/\254\361\232d\211\004\203\216\2303O\334\272\336\202\344"
+	.ascii	"\222\226\341Py)3\244k\007'\\\302/.!\215\233\343\275Fd\\H\303"
+	.ascii	"k\210\367\364\222\362\232A\243\2541\263\327\325PC423R\2728\r"
+	.ascii	"V\030\034e\374\266\2041\332\332z(\273^\030\343\027j\ta\360|%"
+	.ascii	"I\262\325\225\225\3743\264\200}\206B\254\240\013\263x\256\204"
+	.ascii	"\2641\351\232A\370\242\202\331\310\360K>\021^U\0366{\201\203"
+	.ascii	"F\272\002\341\t\247\204J\341\224\320*\314\226\223\352B\253*\024"
+	.ascii	"bH\256*\241\013\036\2000\206\350\265T\032`\232\235\024\325\312"
+	.ascii	"\031\304\021\227\244k\007\026B(a\013!\2240\231\001\362\336\025"
+	.ascii	"W\005\017\2742O!\362\302\244\220\205\016\025+ofB\026\302\025"
+	.ascii	"j\274\244\324\364n\306\306\276\\a\024{\251P\254.\216&\366\027"
+	.ascii	">\t\217\367nlK\327\013\217\177\035\024\336\246\352\332\322\353"
+	.ascii	"\372'\377\fy\272\004\275\2561s\243\243\023T3t\325\243K\327W5"
+	.ascii	"n<\202;\246\262t\255}A\257\201\002x\"\027\227\006\215\020I\322"
+	.ascii	"\217I\327W4\177\325\353\0269\264\260\262t\345\265\240W\300\036"
+	.ascii	"<\270>\036\177\325\257\217\213\035V\365\373k_\037\351\002\305"
+	.ascii	"\fYW\2333\225\017F\024\022\256\316\361\312\367W<\356k,\026f\370"
+	.ascii	"\020\263af/JYW\367\376*\246\327\006\315\316Pu\255zA\257\317\034"
+	.ascii	"d\026\023\036]o\312T2H\254\260\320\272\276\222\371)\216\232\027"
+	.ascii	"\002\025\216\033]o\205\177\206UL\320\353\230\241Z2pHW\2340\264"
+	.ascii	"\n\017ZR\307\034\230/cmL\352\227\277v\251^L0(\b\206\177\206;"
+	.ascii	"\3543\254xA\257\\r\260Py\036\351\252S\267h\351\023\023\306\242"
+	.ascii	"\353\253\026\3440\211\004C\353Z\253\004\275\336Q0WqZY( \216\031"
+	.ascii	"1\\\210`\261\353\221Q\303F\265\303b\341^6(d9\236]\351\\\320k"
+	.ascii	"\335\002\312\304\206\320Q\355d\331\345\335\230Kr\023\204\366"
+	.ascii	"\25033\024z\242+1\246\024Bj\206d\264I:\223\025@ PX(\227-\273"
+	.ascii	"\236\017\023@\020\3503\232\034'BE\212\324\fIR\222\302\260g\213"
+	.ascii	"\366\022\256u\357\271\336\336\215\327afu_e/\255\257\025\240\342"
+	.ascii	"\023\305\271"
+	.string	"\377\302\270\377_\341!\312\344\250\\jQXq\001\310\370\367\276EW\037%(\243\240\342\377\307\030\rI\342\262\377o9\213t\215\n\220\244/\202\230\004\200\236\351D\264\005\024\331\021o\344\\jp\200\226\201c\366\023\317\013\216QD\365\240R\2016\230\361\027\261\311\022\357%\375\342`\310\3747\302\241\036y\225\322x\270K]\353\257\244/pI^\337\3103\311\273\346?\336\341\240\004I\222\235\021\225\300\272\024`I0\371g\2525\213\033T\231\005\335p\017\240M2\207G\342\212F\213f\320\362E\004\022\264\335W\006\017mw\313\215 \321\303o\004d\b\214\1770mu\354\030\022\233\213u\276k\354$\033\332\250\360\030\357\220|\376\2736i\256T\364>\024\256\230\033\301\315\227\211\353\035T\342\3750\035g|\006\375(\256\033\"\271\3408\267\353\214)\273X-\270E\207\305]@\232\321\205\251\024B<\257+\037Rr"
+	.ascii	"\375\3720\034D\376\271T\232\314\223x\200{\340\263\237\034\360"
+	.ascii	"\216S\301\300F\0300\374D\r\032N\030\023\r\207\003\302\024\275"
+	.ascii	"p"
+	.string	"\033t#\207E#\244w\234\373\304\003\267\351\357X\260\020\204#Lj\260\251\237\333\351\202\366Y\234sH\261\262@7(a\211\230\306P\320\243\251\037\266\340\230\210\204D\274\327\225%\220\2369\223\210&\274\025\201J\035\352\234\274p\375\251<\324\247\267\264m-\316\326^2\252\274\374\350\205\216[#\234afZa?&\202\342\302\246\r\342m\327\305'\217Sp\355\372\301X\212[\301\245\213\346\334\353\211\"\225\341H*q\332\331\254\0370r\\L\206\004\335@\f\n\330\007\034\361t\373\310s\003\366\2231\273+\257-\315q\364\361\f\3644\323\016\f\374\315:\206\252o\237Pz\306I\310\b\013\234\251\237\253j\342\345\247\253\342\362\351*\226\2609\357#\374+o\275@\202TU\022[\336v#\3627\364\345\241\326\272N\036I\300j\316e\247t\035\350\315\252\013\322\210\f\335\251\340\324w\331\340\255g\201\233K\352\374\220"
+	.string	"\035G\210\226n\217^\036p\200\212\207\362\036\236\343w,a\022\315T\\\260\225\263\301\242F\3252\035\370He.\\\232\376=~:h\217\345\250\255[\244'9\037-\337R\201\016\376\201\252\322[\033\235#(M\235\027\272\266\310\232\331\356\253\375\314X\354=>\241pr\255\357\242\262\023\035g\374\356W\020\243^\245V\332"
+	.string	"\211sA\224\314\030B\032D\025I\005\253\004\301!\271\273\223\213\3403`\357ni\236\214\033\257\257\367\216\264\272\357\273@.\374\261\300\274\344\230\325\332\305\356\313\245\013\005\211\240\250/GJ>\361\373\"\211\344\367\357\324,\036\241}O1\024.n \313\352\272/o\203\214\274H\325N\n\n\315\220\f\355\307m\357\265\364\353\220\373P\001\266\371\213L\266\312\t9FJ9A\206\225d+\346u5\311\315;\371\351\2507G\020H\215h \307W\363\2153\"\357\213~\344\226\216\203\314"
+	.ascii	"\325V\204\017\274\r\345}\315u\264\354v*\247Z\303p\324m\222\303"
+	.ascii	"\002\316\374\276\264\326\223\271\n<\306\235T2\370r\242\311\035"
+	.ascii	"Ns\327\0375\306M\032Nl\256\250\317\220y\027\210\312)\0366ZQ\340"
+	.ascii	"@\023EW\356L\240\363g7\026\023\352|\316*\251\224\370\362\367"
+	.ascii	"i\333\223i\306\273\227R\310\001\340\235\177\241\310\220\370Z"
+	.ascii	"`N\316x\206\341\335Pe\025\3023"
+	.string	"\020\212K\202 \"\021"
+	.ascii	"\322\002\206a\224~\327\350j\344\342y#[#\356\f\fW\255\267i\221"
+	.ascii	"\242\223f\231\255\3013\374\315\026\304\246\2637r\004\271v\237"
+	.ascii	"tb9!\352\323\343\373\001\273&\255\332\321u\260\035\034\242h\272"
+	.ascii	"\376\201\351\315~\335\374ei\273q\035D\245o\320\253\312\215\247"
+	.ascii	"E\244\362,\213b\266\006\323\312\300X\344\211\333E\360|\201\372"
+	.ascii	"z\215\276.\302?Y\314i\340\230\273\375\034gCM\"\345.m\243d\265"
+	.ascii	"\336\365\372\016,\335\335\013r\314\376\366\354\266\256\342j\334"
+	.ascii	"\266v\004\323|m\221\273/\346\307\373#T\177\264+\342G\342\364"
+	.ascii	"\377\240V\005\347q\261\021jD\243\271\017\377\356+\273\340&\217"
+	.ascii	"?\023,\227DR\243yR\363M\261>\001\200\035;\303\321\360*\322\335"
+	.ascii	"\013\276\2240i\ru\347\277\321\360%\334\006\005\273\236\342o`"
+	.ascii	".\356@;\202P\003\f\375\204\210;\324S\365\030\240\t\016^\225b"
+	.ascii	"\224"
+	.string	"\177\355\3132olJ\312\341\034\336o q\344\226<\224\272Z\335\366\357\234]@\255,\303\322{@G\365t\223*\241o/\244\274t\201\023\224\b\370!\210{]\336\243ZcU\016\223\256\247M\202\232\212H$\003\036\034\365\264r%?\213\025\001s\342v\346U\273b\333\204\256\277H\2269\362\331\352v\352\330\371i\226\347\035ig\214T\241\375`t9\340\224\352\255%aS@?C\257\211\240N\371\343\216\023\317\024\221\245B\247m\351\267\rHd\372s\340\363\205\362\b\327i\320X\340\212\204\253\003\027\362:\204\372F\276E\272\231\037\264\026\353\001\264:*\203r\377\003\307\031$\227a\341\222D\240\373x\222/d\252\230b\022O\244\264\"\247\310R\205p\367\t\224\034\221\230\263\263\277\353\365\024$\177\022:\236.\002l\352W>|\362\"\202E${\004\bBI\322\312\376\271\235\016\307\213\255V\265\334\322\370\032"
+	.string	"\261\323\230\345\237_\231\271\030\004\r\205O\214\234\345\233\207i\007\331\246\273\203\264\3054SJ@\025\021\270U\020,f\257\352CY\212\314\200\366\342\303\242\023\242H\202\242\017\307\267\2127\262\032\353c\001(\332Sx\b\3200\330c'\366\270Q\275Es\275\365=\341\225\356|\2030\220\3466\266\361~\353\370\346\242\371\207\020\260F\366\301p(\247\017\220\352\f\272\277|\205\320s\224\257\261\335K\345u\321\310\245s_\234s\203\202\255\262aO\362)@\016\264<\335\211m\263\360\222\272\303\272\b\341w\006\235v\251\232\264\007=\032\3362\365\272\004\311D7\376\236;\243\360{jT\231\263q\324\t$2\273\303{67\273\201)\232R|/S\364\036\026\241h/2\333\2757\272o\017R\250\344Ug\321\244\2771\352\022\256\325\t\222\007\201"
+	.ascii	"\240\n0\211\366\313\026l\305R\337~\270\262\004/\035>+\213`\256"
+	.ascii	"\252k\240\215\206J\262Y\316t6spV\024\375\313\f\273\024n\037\n"
+	.ascii	"\331L\233\302\252\305\244\376i\320\233\224\345\323f\310\027\030"
+	.ascii	"K\336\007\002\t\344\2657\273\016\021\017`\"\027|\247\270\267"
+	.ascii	"\276\213Z\317\207m\262\230\254\236\365w\270>\324\337\300tEn\364"
+	.ascii	"\274\325\353jCR\347\257\020\214\260?m\223G1\305 G\311\377R\345"
+	.ascii	"&4\034w\212\003\333\266\311\317@4s\323\3469\022\263\250k\214"
+	.ascii	"\247\225/\251\342\256G\310j\246\026\330\305\374\354&\344\214"
+	.ascii	"V\023\335\304\252\367\346k\270y\224i\021\3435/|\026[&P\273\321"
+	.ascii	"{\233\002\003\bh\033\215\233Tb\346\305???\354\313\006\003\327"
+	.ascii	"|\207J\364\r\346\225\352\330\346\220\210N\212\263\255'\324Y\202"
+	.ascii	"\235\0353\253\037s\020\3328\b\231\312K\205_\031\306\355\311\002"
+	.ascii	"@v\361\001k\017\276\003\250\241)7([6\377\203\241<\220*\365$\241"
+	.ascii	"\232\342i\312\320}\326\240\352\265\271M$\374\215\241\n\301\213"
+	.ascii	"\006\035B\017\232\374ZL\305C\227{y\256\036\013\013\207\333\365"
+	.ascii	"\024\303\241L\r\330\351L\332\275\207\302H\276\030\230|\273\250"
+	.ascii	"w\013~y'\223\244\233\260\374\371Wg*\337;\364\336u0\023\263c`"
+	.ascii	"y\205\270\227\355\036\355\343\006\027_\305\b\377\252KK\210z\237"
+	.ascii	"E\350<\261\343;\376y\3636>\370\261\333\216C\261\255^\222q\235"
+	.ascii	"5\214#\223\001>\330Np\314\362\036\030b\r\363\327\001\361a;\314"
+	.ascii	"`\232\311\300\366\361\254\251N\260wU\264O]>S\357\323\335\310"
+	.ascii	"u\367F\217I\233l\373\376\237\214{Q\375Ks>\314\231\365\333\301"
+	.ascii	"K\002W\242x\315*\275W\373\226\240\fz\317\362Q\311o\326\315x'"
+	.ascii	"\223\262X\2737\370{J\275\371{\306\004\343\235\272\026\375q\\"
+	.ascii	"\267\004?\272\371\271 7&}\271b\253\334\362:>\027\373\036\271"
+	.ascii	"\243\351r\271\236\0209\330\327\035l\263\177l\345>\374l+\324\275"
+	.ascii	"\204\217\302\253t\360\305$\362\302\225K*\035\"\036\346\365\332"
+	.ascii	"\256\034\252U\030\200\321c\216\2409_\355c\354\200os\006u\334"
+	.ascii	"\367|\302)j\234\205pz\330\300\226\351\332\327WQ\2721\256S~\233"
+	.ascii	"\272\205C~5N\224\267X\213R\177\312\270\223\177\246ce\213F\217"
+	.ascii	"m\363\023\266\234'\021\372\307\210\327\202?)gt\357\005\323\330"
+	.ascii	"\260\247\253\021\373\314\365i\366N\367\301\203M\263\354Q\245"
+	.ascii	"'\364\264\267G\204\323\336\216\245\343\252<b\257\217\270\361"
+	.ascii	"\275`\373\330v\r\006\343U0\243+\332#?D9\217\b;u#I\254\231\335"
+	.ascii	"+\362\220\344\313\364R;\220\362c\322\037\256e_\203\273\262e*"
+	.ascii	"M7"
+	.text
+	.section	.gnu.lto_.symtab.bf5ad7e0e7509230,"e",@progbits
+	.string	"cmsx_menuMixerServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"cmsx_menuMotorMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"cmsx_menuServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"cmsx_menuServo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"servoMixerInputCmsNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"primaryMotorMixer_SystemArray"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bf5ad7e0e7509230,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
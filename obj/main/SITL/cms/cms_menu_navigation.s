@@ -0,0 +1,17917 @@
+	.file	"cms_menu_navigation.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms_types.h"
+	.file 6 "./src/main/cms/cms_menu_navigation.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_navigation.c.a4e3a34e
+	.weak	cms_menu_navigation.c.a4e3a34e
+cms_menu_navigation.c.a4e3a34e:
+	.long	0x787
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF2894
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2780
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2781
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2782
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2783
+	.uleb128 0x5
+	.long	.LASF2785
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2784
+	.uleb128 0x5
+	.long	.LASF2786
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2787
+	.uleb128 0x5
+	.long	.LASF2788
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF2789
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2790
+	.uleb128 0x14
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2791
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF2792
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF2793
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2794
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x6
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF2795
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2796
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2797
+	.uleb128 0x3
+	.long	0xef
+	.uleb128 0x6
+	.long	0xe5
+	.uleb128 0x15
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x6
+	.long	0xf0
+	.uleb128 0x5
+	.long	.LASF2798
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0x10b
+	.uleb128 0x6
+	.long	0xfa
+	.uleb128 0xc
+	.long	.LASF2806
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2799
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x136
+	.uleb128 0x4
+	.long	.LASF2800
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2801
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2802
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2803
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0x117
+	.uleb128 0x5
+	.long	.LASF2804
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF2805
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x15a
+	.uleb128 0xc
+	.long	.LASF2807
+	.uleb128 0x5
+	.long	.LASF2808
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x16b
+	.uleb128 0xc
+	.long	.LASF2809
+	.uleb128 0x5
+	.long	.LASF2810
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x181
+	.uleb128 0x6
+	.long	0x170
+	.uleb128 0xd
+	.long	.LASF2830
+	.byte	0x98
+	.byte	0x4
+	.byte	0x56
+	.long	0x285
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x358
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x358
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x358
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x358
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x371
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x399
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3c1
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3f3
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x407
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x358
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x417
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x42b
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x43f
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x45d
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x480
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x494
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x4a9
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x417
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x4c7
+	.byte	0x90
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2831
+	.byte	0x20
+	.byte	0x4
+	.byte	0x45
+	.long	0x32e
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x32e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0x110
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0x110
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x142
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xba
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x17c
+	.uleb128 0x5
+	.long	.LASF2844
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x285
+	.uleb128 0x6
+	.long	0x333
+	.uleb128 0x7
+	.long	0x70
+	.long	0x353
+	.uleb128 0x2
+	.long	0x353
+	.byte	0
+	.uleb128 0x3
+	.long	0x333
+	.uleb128 0x3
+	.long	0x344
+	.uleb128 0x7
+	.long	0x70
+	.long	0x36c
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x33f
+	.uleb128 0x3
+	.long	0x35d
+	.uleb128 0x7
+	.long	0x70
+	.long	0x399
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xf0
+	.uleb128 0x2
+	.long	0x142
+	.byte	0
+	.uleb128 0x3
+	.long	0x376
+	.uleb128 0x7
+	.long	0x70
+	.long	0x3c1
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x142
+	.byte	0
+	.uleb128 0x3
+	.long	0x39e
+	.uleb128 0x7
+	.long	0x110
+	.long	0x3e9
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0x3e9
+	.uleb128 0x2
+	.long	0x3ee
+	.byte	0
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x142
+	.uleb128 0x3
+	.long	0x3c6
+	.uleb128 0x7
+	.long	0x110
+	.long	0x407
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x3f8
+	.uleb128 0x10
+	.long	0x417
+	.uleb128 0x2
+	.long	0x353
+	.byte	0
+	.uleb128 0x3
+	.long	0x40c
+	.uleb128 0x7
+	.long	0xcb
+	.long	0x42b
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x41c
+	.uleb128 0x7
+	.long	0x142
+	.long	0x43f
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x430
+	.uleb128 0x7
+	.long	0x110
+	.long	0x458
+	.uleb128 0x2
+	.long	0x458
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x15f
+	.uleb128 0x3
+	.long	0x444
+	.uleb128 0x7
+	.long	0x70
+	.long	0x47b
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x47b
+	.byte	0
+	.uleb128 0x3
+	.long	0x106
+	.uleb128 0x3
+	.long	0x462
+	.uleb128 0x7
+	.long	0x110
+	.long	0x494
+	.uleb128 0x2
+	.long	0x353
+	.byte	0
+	.uleb128 0x3
+	.long	0x485
+	.uleb128 0x10
+	.long	0x4a9
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0x136
+	.byte	0
+	.uleb128 0x3
+	.long	0x499
+	.uleb128 0x7
+	.long	0x110
+	.long	0x4c2
+	.uleb128 0x2
+	.long	0x4c2
+	.uleb128 0x2
+	.long	0x36c
+	.byte	0
+	.uleb128 0x3
+	.long	0x14e
+	.uleb128 0x3
+	.long	0x4ae
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1
+	.long	0x551
+	.uleb128 0x4
+	.long	.LASF2845
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2846
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2847
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2848
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF2849
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2851
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF2852
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF2853
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2854
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF2855
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF2856
+	.byte	0xb
+	.uleb128 0x4
+	.long	.LASF2857
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF2858
+	.byte	0xd
+	.uleb128 0x4
+	.long	.LASF2859
+	.byte	0xe
+	.uleb128 0x4
+	.long	.LASF2860
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF2861
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF2862
+	.byte	0x11
+	.uleb128 0x4
+	.long	.LASF2863
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF2864
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2865
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x562
+	.uleb128 0x6
+	.long	0x551
+	.uleb128 0x3
+	.long	0x567
+	.uleb128 0x7
+	.long	0x83
+	.long	0x57b
+	.uleb128 0x2
+	.long	0x353
+	.uleb128 0x2
+	.long	0xe5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2866
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x12
+	.long	0x58c
+	.uleb128 0x6
+	.long	0x57b
+	.uleb128 0x3
+	.long	0x591
+	.uleb128 0x16
+	.long	0x8c
+	.uleb128 0x17
+	.byte	0x8
+	.byte	0x5
+	.byte	0x40
+	.byte	0x5
+	.long	0x5c1
+	.uleb128 0xe
+	.long	.LASF2867
+	.byte	0x42
+	.byte	0x1f
+	.long	0x55d
+	.uleb128 0xe
+	.long	.LASF2868
+	.byte	0x43
+	.byte	0x21
+	.long	0x587
+	.uleb128 0xe
+	.long	.LASF2869
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0x11
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x603
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x18
+	.long	0xf5
+	.byte	0
+	.uleb128 0x18
+	.long	0x596
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x5
+	.byte	0x46
+	.byte	0x18
+	.long	0xea
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x5
+	.byte	0x47
+	.byte	0x13
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2874
+	.byte	0x5
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5c1
+	.uleb128 0x6
+	.long	0x603
+	.uleb128 0x5
+	.long	.LASF2875
+	.byte	0x5
+	.byte	0x78
+	.byte	0x10
+	.long	0x625
+	.uleb128 0x6
+	.long	0x614
+	.uleb128 0x3
+	.long	0x62a
+	.uleb128 0x7
+	.long	0x83
+	.long	0x639
+	.uleb128 0x2
+	.long	0x639
+	.byte	0
+	.uleb128 0x3
+	.long	0x60f
+	.uleb128 0x5
+	.long	.LASF2876
+	.byte	0x5
+	.byte	0x84
+	.byte	0x10
+	.long	0x625
+	.uleb128 0x6
+	.long	0x63e
+	.uleb128 0x11
+	.byte	0x20
+	.byte	0x86
+	.long	0x68b
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0x5
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x620
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x5
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x64a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x620
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x5
+	.byte	0x90
+	.byte	0x16
+	.long	0x639
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2881
+	.byte	0x5
+	.byte	0x91
+	.byte	0x3
+	.long	0x64f
+	.uleb128 0x6
+	.long	0x68b
+	.uleb128 0xd
+	.long	.LASF2882
+	.byte	0x3
+	.byte	0x5
+	.byte	0xbc
+	.long	0x6c3
+	.uleb128 0x19
+	.string	"val"
+	.byte	0x5
+	.byte	0xbd
+	.byte	0x14
+	.long	0xc6
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x5
+	.byte	0xbe
+	.byte	0x13
+	.long	0xb5
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2884
+	.byte	0x5
+	.byte	0xbf
+	.byte	0x1b
+	.long	0x69c
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2885
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2886
+	.uleb128 0xa
+	.long	0x60f
+	.long	0x6ed
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.long	0x6dd
+	.uleb128 0x9
+	.long	.LASF2887
+	.byte	0x2a
+	.byte	0x18
+	.long	0x6ed
+	.uleb128 0x9
+	.long	.LASF2888
+	.byte	0x3a
+	.byte	0x17
+	.long	0x697
+	.uleb128 0xa
+	.long	0x60f
+	.long	0x718
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	0x708
+	.uleb128 0x9
+	.long	.LASF2889
+	.byte	0x45
+	.byte	0x19
+	.long	0x718
+	.uleb128 0x9
+	.long	.LASF2890
+	.byte	0x58
+	.byte	0x17
+	.long	0x697
+	.uleb128 0xa
+	.long	0x60f
+	.long	0x743
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x6
+	.long	0x733
+	.uleb128 0x9
+	.long	.LASF2891
+	.byte	0x63
+	.byte	0x18
+	.long	0x743
+	.uleb128 0x9
+	.long	.LASF2892
+	.byte	0x74
+	.byte	0x17
+	.long	0x697
+	.uleb128 0xa
+	.long	0x60f
+	.long	0x76e
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	0x75e
+	.uleb128 0x9
+	.long	.LASF2893
+	.byte	0x7f
+	.byte	0x18
+	.long	0x76e
+	.uleb128 0x1a
+	.long	.LASF2895
+	.byte	0x6
+	.byte	0x8a
+	.byte	0x10
+	.long	0x697
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.file 9 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0xa
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF784
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 26 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1a
+	.byte	0x4
+	.file 27 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF913
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF949
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF991
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF992
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF993
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF994
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF910
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF995
+	.file 38 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF996
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1013
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1026
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1031
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1035
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1052
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1053
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1054
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1066
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1073
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1074
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1078
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x38
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1080
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1081
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.file 63 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 64 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x40
+	.file 65 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 66 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 67 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 68 "./src/main/fc/settings.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x19
+	.byte	0x4
+	.file 69 "./obj/main/SITL/settings_generated.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 70 "./src/main/navigation/navigation.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x46
+	.file 71 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 72 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x48
+	.byte	0x4
+	.file 73 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 74 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4a
+	.file 75 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x4c
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2667
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x51
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.file 83 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 85 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF941
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF970
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF990
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1000
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1004
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1008
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1047
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1051
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1069
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1072
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1098
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1121
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1134
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1200
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF2344
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2350
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2353
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2389
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2661
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2699
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2699
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2699
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF2699
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF2687
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF2688
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF2689
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF2690
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF2708
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF2709
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF2710
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF2711
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2718
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF2719
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF2720
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF2721
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF2722
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF2723
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF2760
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2776
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2779
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2896
+	.long	.LASF2897
+	.long	.LASF2898
+	.long	.LASF2899
+	.long	.LASF2900
+	.long	.LASF2901
+	.long	.LASF2902
+	.long	.LASF2903
+	.long	.LASF2904
+	.long	.LASF2905
+	.long	.LASF2906
+	.long	.LASF2907
+	.long	.LASF2908
+	.long	.LASF2909
+	.long	.LASF2910
+	.long	.LASF2911
+	.long	.LASF2912
+	.long	.LASF2913
+	.long	.LASF2914
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x56
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2915
+	.byte	0xf
+	.long	.LASF2916
+	.byte	0xf
+	.long	.LASF2917
+	.byte	0xf
+	.long	.LASF2918
+	.byte	0x6
+	.long	.LASF2919
+	.byte	0x3
+	.long	.LASF2920
+	.byte	0x3
+	.long	.LASF2921
+	.byte	0x12
+	.long	.LASF2922
+	.byte	0xd
+	.long	.LASF2923
+	.byte	0xc
+	.long	.LASF2924
+	.byte	0xb
+	.long	.LASF2925
+	.byte	0x13
+	.long	.LASF2925
+	.byte	0x12
+	.long	.LASF2926
+	.byte	0xf
+	.long	.LASF2927
+	.byte	0x12
+	.long	.LASF2928
+	.byte	0x12
+	.long	.LASF2929
+	.byte	0xf
+	.long	.LASF2930
+	.byte	0xf
+	.long	.LASF2931
+	.byte	0x11
+	.long	.LASF2932
+	.byte	0xf
+	.long	.LASF2933
+	.byte	0x10
+	.long	.LASF2934
+	.byte	0x10
+	.long	.LASF2935
+	.byte	0xf
+	.long	.LASF2936
+	.byte	0xf
+	.long	.LASF2937
+	.byte	0xf
+	.long	.LASF2938
+	.byte	0x13
+	.long	.LASF2939
+	.byte	0xc
+	.long	.LASF2940
+	.byte	0xc
+	.long	.LASF2941
+	.byte	0x12
+	.long	.LASF2942
+	.byte	0xf
+	.long	.LASF2943
+	.byte	0xf
+	.long	.LASF2944
+	.byte	0xf
+	.long	.LASF2945
+	.byte	0xf
+	.long	.LASF2915
+	.byte	0x11
+	.long	.LASF2946
+	.byte	0xe
+	.long	.LASF2947
+	.byte	0xe
+	.long	.LASF2948
+	.byte	0xe
+	.long	.LASF2949
+	.byte	0xe
+	.long	.LASF2950
+	.byte	0x12
+	.long	.LASF2950
+	.byte	0xf
+	.long	.LASF2951
+	.byte	0xf
+	.long	.LASF2952
+	.byte	0xf
+	.long	.LASF2953
+	.byte	0xf
+	.long	.LASF2954
+	.byte	0x11
+	.long	.LASF2954
+	.byte	0xf
+	.long	.LASF2955
+	.byte	0xe
+	.long	.LASF2956
+	.byte	0xe
+	.long	.LASF2957
+	.byte	0xe
+	.long	.LASF2958
+	.byte	0xe
+	.long	.LASF2959
+	.byte	0xf
+	.long	.LASF2960
+	.byte	0xf
+	.long	.LASF2961
+	.byte	0xf
+	.long	.LASF2962
+	.byte	0xf
+	.long	.LASF2963
+	.byte	0xf
+	.long	.LASF2964
+	.byte	0xf
+	.long	.LASF2965
+	.byte	0x12
+	.long	.LASF2966
+	.byte	0xf
+	.long	.LASF2967
+	.byte	0xf
+	.long	.LASF2968
+	.byte	0x12
+	.long	.LASF2969
+	.byte	0xe
+	.long	.LASF2970
+	.byte	0xe
+	.long	.LASF2971
+	.byte	0x12
+	.long	.LASF2972
+	.byte	0x3
+	.long	.LASF2973
+	.byte	0x13
+	.long	.LASF2974
+	.byte	0x5
+	.long	.LASF2975
+	.byte	0x2
+	.long	.LASF2976
+	.byte	0x4
+	.long	.LASF2977
+	.byte	0x7
+	.long	.LASF2978
+	.byte	0x7
+	.long	.LASF2979
+	.byte	0x1
+	.long	.LASF2980
+	.byte	0xa
+	.long	.LASF2981
+	.byte	0x4
+	.long	.LASF2982
+	.byte	0x4
+	.long	.LASF2983
+	.byte	0x4
+	.long	.LASF2984
+	.byte	0x4
+	.long	.LASF2985
+	.byte	0x12
+	.long	.LASF2986
+	.byte	0xf
+	.long	.LASF2987
+	.byte	0xf
+	.long	.LASF2988
+	.byte	0xf
+	.long	.LASF2989
+	.byte	0xf
+	.long	.LASF2990
+	.byte	0xf
+	.long	.LASF2991
+	.byte	0xf
+	.long	.LASF2992
+	.byte	0xf
+	.long	.LASF2993
+	.byte	0x5
+	.long	.LASF2994
+	.byte	0x8
+	.long	.LASF2995
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2347:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF1247:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF448:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2633:
+	.string	"__DECL_SIMD_asinhf "
+.LASF971:
+	.string	"__ldiv_t_defined 1"
+.LASF2890:
+	.string	"cmsx_menuRTH"
+.LASF1887:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF2397:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF869:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2423:
+	.string	"__DECL_SIMD_logf "
+.LASF421:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1868:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2656:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1217:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF2219:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF1061:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1363:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF847:
+	.string	"USE_BARO "
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1642:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF451:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2140:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF2245:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF1703:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF1571:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF827:
+	.string	"_WCHAR_T_DEFINED "
+.LASF471:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1473:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF1218:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1784:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF433:
+	.string	"USE_PITOT_MS4525 "
+.LASF988:
+	.string	"__ssize_t_defined "
+.LASF1924:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF1827:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF1231:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF2001:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF854:
+	.string	"USE_UART7 "
+.LASF2396:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1308:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF2126:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF487:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2460:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1828:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF1235:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF2233:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF2227:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF543:
+	.string	"__USE_MISC 1"
+.LASF1154:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF472:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1818:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF1637:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF2596:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1172:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF2433:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF403:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF986:
+	.string	"__pid_t_defined "
+.LASF2274:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF997:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1396:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF1791:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1099:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2536:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2800:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2856:
+	.string	"OME_INT16"
+.LASF452:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2786:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1895:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF2167:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF2832:
+	.string	"vTable"
+.LASF2355:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2810:
+	.string	"displayPortVTable_t"
+.LASF2799:
+	.string	"_Bool"
+.LASF1531:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF1846:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1525:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF855:
+	.string	"USE_UART8 "
+.LASF2661:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1425:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF891:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1694:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2567:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2672:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1252:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF1785:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF2442:
+	.string	"__DECL_SIMD_pow "
+.LASF1259:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF2020:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2807:
+	.string	"displayCanvas_s"
+.LASF2805:
+	.string	"displayCanvas_t"
+.LASF2528:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1516:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF910:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1272:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF1477:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF2102:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF2321:
+	.string	"SETTING_VTX_BAND 371"
+.LASF2308:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF2774:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2268:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF2153:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF2628:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1544:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF1145:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF1277:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1820:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF2252:
+	.string	"SETTING_SIM_PIN 348"
+.LASF1223:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF1289:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF864:
+	.string	"USE_USB_MSC"
+.LASF1869:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF510:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2497:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2696:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1648:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF1132:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1941:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF908:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2776:
+	.string	"HDOP_SCALE (100)"
+.LASF1717:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF1474:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF919:
+	.string	"WNOWAIT 0x01000000"
+.LASF819:
+	.string	"__WCHAR_T__ "
+.LASF1168:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF913:
+	.string	"_STDLIB_H 1"
+.LASF2329:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF1498:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF1660:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF398:
+	.string	"USE_SERIAL_RX "
+.LASF2741:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2483:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1906:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF1458:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF1582:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF2349:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF1455:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF1564:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF455:
+	.string	"USE_CMS "
+.LASF1083:
+	.string	"_STDBOOL_H "
+.LASF2378:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF901:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF2534:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2457:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1149:
+	.string	"READONLY (1 << 4)"
+.LASF2584:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2883:
+	.string	"step"
+.LASF873:
+	.string	"USE_PITOT_MS4525"
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2280:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF1239:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF1735:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF1581:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF2631:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1769:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2184:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF2839:
+	.string	"cleared"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1762:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF481:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2033:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF2794:
+	.string	"uint16_t"
+.LASF2008:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF1009:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1669:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF373:
+	.string	"linux 1"
+.LASF2365:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF2314:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF1831:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2673:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1764:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1428:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF1139:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2231:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1628:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF1966:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF887:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF483:
+	.string	"USE_CLI_BATCH "
+.LASF1527:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF2322:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF1207:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF1542:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF1285:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF2390:
+	.string	"_MATH_H 1"
+.LASF1779:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF897:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1228:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF1950:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF1936:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF2713:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2887:
+	.string	"cmsx_menuNavSettingsEntries"
+.LASF2742:
+	.string	"M_E 2.7182818284590452354"
+.LASF984:
+	.string	"__uid_t_defined "
+.LASF393:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2178:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF1454:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF1568:
+	.string	"SETTING_TPA_RATE 120"
+.LASF1253:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF858:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2406:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2224:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF1283:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF1843:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1702:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF1486:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF2293:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2436:
+	.string	"__DECL_SIMD_expf32 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1766:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF2384:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2643:
+	.string	"__DECL_SIMD_erfcf "
+.LASF508:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1418:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF1645:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF1912:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF2385:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF859:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF983:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF818:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2514:
+	.string	"__DECL_SIMD_coshl "
+.LASF1503:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF1403:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF1341:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF499:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1484:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF1790:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF2425:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1804:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF1821:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1312:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF2010:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1931:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1453:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF1674:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF2819:
+	.string	"isTransferInProgress"
+.LASF966:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2637:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1733:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF2481:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1620:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF2055:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1876:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF1483:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1957:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF2669:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1759:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1608:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2189:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1246:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2892:
+	.string	"cmsx_menuFixedWing"
+.LASF2857:
+	.string	"OME_String"
+.LASF443:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1242:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF2441:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1892:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1815:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2470:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1102:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1976:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF871:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2398:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1913:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF2111:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF1880:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF2642:
+	.string	"__DECL_SIMD_erfc "
+.LASF1917:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF1390:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF2752:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1026:
+	.string	"_SYS_SELECT_H 1"
+.LASF1462:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF944:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1835:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1038:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF842:
+	.string	"USE_IMU_FAKE "
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2616:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2195:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF1081:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1034:
+	.string	"__timeval_defined 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1386:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF490:
+	.string	"__USE_ISOC11"
+.LASF1171:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF2780:
+	.string	"unsigned char"
+.LASF1611:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF2636:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2260:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF1716:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF863:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1011:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1856:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF437:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1938:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF1431:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1607:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF882:
+	.string	"USE_RX_PPM"
+.LASF1167:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF601:
+	.string	"__always_inline"
+.LASF2498:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF950:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2198:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF1166:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF1901:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF2342:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF2266:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF2744:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2094:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF2530:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2023:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF1594:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1265:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF1946:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1322:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2404:
+	.string	"__DECL_SIMD_sinl "
+.LASF1537:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1469:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF2688:
+	.string	"__MATH_PRECNAME"
+.LASF1688:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF902:
+	.string	"FAST_CODE "
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF1449:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF2806:
+	.string	"osdCharacter_s"
+.LASF2798:
+	.string	"osdCharacter_t"
+.LASF1909:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF2720:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF2499:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1391:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF876:
+	.string	"USE_1WIRE_DS2482"
+.LASF1715:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF1918:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF1718:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1577:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1879:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF2886:
+	.string	"double"
+.LASF2880:
+	.string	"entries"
+.LASF2080:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF2177:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF2841:
+	.string	"grabCount"
+.LASF2675:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF439:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1013:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF2086:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF803:
+	.string	"_T_SIZE_ "
+.LASF1773:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF845:
+	.string	"USE_FAKE_GPS "
+.LASF1481:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF1816:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF2383:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1022:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF2492:
+	.string	"__DECL_SIMD_exp2 "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2597:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF2604:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1030:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2112:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2641:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2452:
+	.string	"__DECL_SIMD_acos "
+.LASF440:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2443:
+	.string	"__DECL_SIMD_powf "
+.LASF2157:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF2100:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF2054:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF2875:
+	.string	"CMSMenuFuncPtr"
+.LASF2635:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1518:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF1800:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF2670:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2139:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2070:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF1841:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF1630:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF1086:
+	.string	"false 0"
+.LASF2613:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1464:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF2284:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF1113:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF814:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1482:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF954:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF789:
+	.string	"_T_PTRDIFF_ "
+.LASF2012:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF2556:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2762:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF2817:
+	.string	"writeChar"
+.LASF2551:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2804:
+	.string	"textAttributes_t"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1493:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF1193:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1570:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF465:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1258:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF2510:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1777:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF1867:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1747:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF1517:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF2037:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1908:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF2718:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF404:
+	.string	"USE_ADC_AVERAGING "
+.LASF2683:
+	.string	"_Mdouble_ double"
+.LASF927:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1499:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF2082:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2300:
+	.string	"SETTING_STATS 364"
+.LASF1519:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2261:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF2069:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF946:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1500:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF1865:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF1296:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2158:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF2291:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF2863:
+	.string	"OME_MENU"
+.LASF2250:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF2733:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF475:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1848:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF430:
+	.string	"USE_OPFLOW "
+.LASF2388:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2063:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF1404:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF1298:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF812:
+	.string	"__DEFINED_size_t "
+.LASF1697:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF1532:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1980:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF1707:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF2380:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1137:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1556:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF2003:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF2113:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF2751:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1214:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF2491:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2517:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1254:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF820:
+	.string	"_WCHAR_T "
+.LASF2389:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1625:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1649:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF1330:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF2304:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF1196:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1793:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF1771:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF1184:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1342:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF2872:
+	.string	"type"
+.LASF1001:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2838:
+	.string	"useFullscreen"
+.LASF2011:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1273:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF2783:
+	.string	"long unsigned int"
+.LASF2240:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF1076:
+	.string	"alloca"
+.LASF1508:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF1574:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF976:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1347:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF1507:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF2042:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF2061:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF795:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1105:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1854:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF2269:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1475:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2788:
+	.string	"__uint16_t"
+.LASF969:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2062:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF1940:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF1059:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2518:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1652:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1178:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF893:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2188:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF1243:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF531:
+	.string	"__USE_POSIX 1"
+.LASF2018:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF494:
+	.string	"__USE_POSIX"
+.LASF2123:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF830:
+	.string	"__INT_WCHAR_T_H "
+.LASF2275:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF981:
+	.string	"__gid_t_defined "
+.LASF2853:
+	.string	"OME_INT8"
+.LASF1339:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF2461:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1812:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF2488:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2660:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1346:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF2465:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1885:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1358:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF1027:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF527:
+	.string	"_POSIX_SOURCE"
+.LASF1303:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2376:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1212:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF1044:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2199:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF2519:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1021:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF2731:
+	.string	"FP_SUBNORMAL 3"
+.LASF1417:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF2862:
+	.string	"OME_BACK_AND_END"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF940:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1973:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2330:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF2352:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1859:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2448:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2489:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2034:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1445:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF1094:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2194:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF965:
+	.string	"__f32x(x) x ##f32x"
+.LASF2506:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2708:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1788:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF442:
+	.string	"USE_OLED_UG2864 "
+.LASF2537:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2364:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2690:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF459:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF482:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2103:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF2152:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF2353:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1398:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1150:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF1638:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF2071:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF1131:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2709:
+	.string	"__MATHDECL_1"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2145:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1782:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF2202:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF2150:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF2666:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1103:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2213:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF796:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2368:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2093:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF2573:
+	.string	"__DECL_SIMD_log2f "
+.LASF982:
+	.string	"__mode_t_defined "
+.LASF2721:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2060:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF409:
+	.string	"USE_NAV "
+.LASF2484:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1416:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF1834:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF2789:
+	.string	"__uint32_t"
+.LASF903:
+	.string	"NOINLINE "
+.LASF1618:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF1855:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF2165:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1712:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF2885:
+	.string	"float"
+.LASF1679:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1288:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF492:
+	.string	"__USE_ISOC95"
+.LASF491:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1742:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF2820:
+	.string	"heartbeat"
+.LASF2114:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF829:
+	.string	"___int_wchar_t_h "
+.LASF1446:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF2689:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2711:
+	.string	"__MATHDECL"
+.LASF2777:
+	.string	"NAV_BLACKBOX "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2286:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF1696:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF1159:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF2614:
+	.string	"__DECL_SIMD_erfl "
+.LASF1698:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1986:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF2592:
+	.string	"__DECL_SIMD_atanh "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2078:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1406:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF2725:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1614:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF788:
+	.string	"_PTRDIFF_T "
+.LASF1767:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF1412:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1006:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF501:
+	.string	"__USE_XOPEN2K"
+.LASF497:
+	.string	"__USE_POSIX199506"
+.LASF1964:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF1089:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2809:
+	.string	"displayFontMetadata_s"
+.LASF2808:
+	.string	"displayFontMetadata_t"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF420:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1730:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF2196:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF2496:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2438:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2803:
+	.string	"displayTransactionOption_e"
+.LASF1360:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF2228:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF411:
+	.string	"USE_TELEMETRY_LTM "
+.LASF2456:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1024:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1956:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF1709:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF1414:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF1935:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF1248:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF1317:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF407:
+	.string	"USE_GPS "
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1177:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF2162:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF1136:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF600:
+	.string	"__wur "
+.LASF1830:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2263:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF1352:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2085:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF402:
+	.string	"USE_SERIALRX_FPORT "
+.LASF929:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF2739:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2179:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2176:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF2472:
+	.string	"__DECL_SIMD_asin "
+.LASF2821:
+	.string	"resync"
+.LASF888:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF2695:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2164:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF991:
+	.string	"__clock_t_defined 1"
+.LASF1953:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF522:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF826:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1441:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF2215:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2475:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2052:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2564:
+	.string	"__DECL_SIMD_log10l "
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1309:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2315:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF2487:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1348:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2182:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF1037:
+	.string	"__NFDBITS"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF1780:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1221:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2513:
+	.string	"__DECL_SIMD_coshf "
+.LASF2522:
+	.string	"__DECL_SIMD_expm1 "
+.LASF932:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1302:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF2318:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF1307:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF1737:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2823:
+	.string	"supportedTextAttributes"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1590:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF1405:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1526:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF1319:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF2301:
+	.string	"SETTING_STATS_MIN 0"
+.LASF1929:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF2645:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF504:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1324:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF1811:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF2727:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2852:
+	.string	"OME_BoolFunc"
+.LASF2705:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF886:
+	.string	"USE_ITCM_RAM"
+.LASF1877:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2229:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF2289:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1562:
+	.string	"SETTING_THR_MID 118"
+.LASF1511:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF1161:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF955:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1928:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF2682:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF542:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1560:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2307:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF980:
+	.string	"__dev_t_defined "
+.LASF2479:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1032:
+	.string	"____sigset_t_defined "
+.LASF1729:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF1176:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF840:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF996:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1151:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2753:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1833:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2362:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1240:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF2401:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1173:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF1383:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF1725:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF2589:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF511:
+	.string	"__USE_GNU"
+.LASF879:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1197:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1584:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF874:
+	.string	"USE_PITOT_ADC"
+.LASF2134:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2209:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1700:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF1916:
+	.string	"SETTING_PID_TYPE 236"
+.LASF1670:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF1331:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF1557:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF2036:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF446:
+	.string	"USE_DJI_HD_OSD "
+.LASF2375:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF2587:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1413:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF2238:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF957:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2298:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF2392:
+	.string	"__DECL_SIMD_cos "
+.LASF1673:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2676:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2859:
+	.string	"OME_Setting"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF513:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1335:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF428:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1201:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF1065:
+	.string	"__ONCE_ALIGNMENT "
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1359:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF2527:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1098:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2874:
+	.string	"OSD_Entry"
+.LASF1563:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF1213:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1881:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF2135:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF2087:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF2200:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF923:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2246:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF1292:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF432:
+	.string	"USE_OPFLOW_MSP "
+.LASF506:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF995:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2737:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF2090:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1018:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1738:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2715:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1740:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF1287:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF1633:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF2877:
+	.string	"onEnter"
+.LASF2699:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2143:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2440:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2201:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1494:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF1802:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF2893:
+	.string	"cmsx_menuNavigationEntries"
+.LASF1870:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2876:
+	.string	"CMSMenuOnExitPtr"
+.LASF2412:
+	.string	"__DECL_SIMD_sincos "
+.LASF1155:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF952:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1524:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF1215:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF813:
+	.string	"___int_size_t_h "
+.LASF2895:
+	.string	"cmsx_menuNavigation"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1930:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF1911:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF1639:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF808:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2381:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2248:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF1838:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF412:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1007:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1467:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF1874:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF1548:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1179:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2793:
+	.string	"uint8_t"
+.LASF2623:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1187:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1327:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF422:
+	.string	"USE_RX_UIB "
+.LASF1394:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF2027:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1459:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2700:
+	.string	"_Mdouble_ _Float64"
+.LASF1943:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF1907:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF1220:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF1066:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1539:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF1190:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2831:
+	.string	"displayPort_s"
+.LASF2844:
+	.string	"displayPort_t"
+.LASF498:
+	.string	"__USE_XOPEN"
+.LASF1316:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1736:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF521:
+	.string	"_DEFAULT_SOURCE"
+.LASF1792:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF520:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF2445:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2650:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2854:
+	.string	"OME_UINT8"
+.LASF2454:
+	.string	"__DECL_SIMD_acosl "
+.LASF1122:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1279:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF880:
+	.string	"USE_ADC"
+.LASF2868:
+	.string	"menufunc"
+.LASF540:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2278:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1479:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF1490:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF831:
+	.string	"_GCC_WCHAR_T "
+.LASF2193:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF535:
+	.string	"__USE_XOPEN2K 1"
+.LASF2041:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF1480:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF1236:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF2057:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF2118:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1551:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF934:
+	.string	"__WCOREFLAG 0x80"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2133:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF1284:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF900:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2212:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1174:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF1746:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF1233:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF2259:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF2719:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF2512:
+	.string	"__DECL_SIMD_cosh "
+.LASF2393:
+	.string	"__DECL_SIMD_cosf "
+.LASF2414:
+	.string	"__DECL_SIMD_sincosl "
+.LASF2402:
+	.string	"__DECL_SIMD_sin "
+.LASF427:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF787:
+	.string	"_ANSI_STDDEF_H "
+.LASF1067:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1708:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2814:
+	.string	"drawScreen"
+.LASF524:
+	.string	"__USE_ISOC99 1"
+.LASF834:
+	.string	"_BSD_WCHAR_T_"
+.LASF2327:
+	.string	"SETTING_VTX_POWER 373"
+.LASF2415:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1345:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1111:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF948:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF865:
+	.string	"USE_SERVO_SBUS"
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF806:
+	.string	"_SIZE_T_ "
+.LASF1162:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF2127:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF881:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1572:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF1271:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF2834:
+	.string	"rows"
+.LASF817:
+	.string	"__need_size_t"
+.LASF1424:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF1106:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1340:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF1866:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF2732:
+	.string	"FP_NORMAL 4"
+.LASF798:
+	.string	"__need_ptrdiff_t"
+.LASF1010:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1808:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF1583:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF2476:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2664:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1576:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF1442:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF453:
+	.string	"USE_LOG "
+.LASF1088:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1492:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF1646:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF2703:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2138:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF785:
+	.string	"_STDDEF_H "
+.LASF1569:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF2599:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF844:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF2045:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1680:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF1450:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1505:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF1952:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1310:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF959:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2237:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF784:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2639:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1189:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF2611:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF500:
+	.string	"__USE_UNIX98"
+.LASF2088:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF2207:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF2617:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2855:
+	.string	"OME_UINT16"
+.LASF1222:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF2504:
+	.string	"__DECL_SIMD_exp10l "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2692:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2607:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1678:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF2035:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF2097:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF1320:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF1120:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF937:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF2016:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF1110:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2686:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2110:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF417:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF2548:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1410:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF1029:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1536:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF2217:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2428:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2585:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1318:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF1506:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF949:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2525:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1961:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2816:
+	.string	"writeString"
+.LASF999:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF416:
+	.string	"USE_PITOT_ADC "
+.LASF2767:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1561:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2319:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1600:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF2730:
+	.string	"FP_ZERO 2"
+.LASF2864:
+	.string	"OME_MAX"
+.LASF1344:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF1758:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF2432:
+	.string	"__DECL_SIMD_exp "
+.LASF2894:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1364:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF1774:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF947:
+	.string	"__f128(x) x ##f128"
+.LASF2605:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1050:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2149:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF2754:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2326:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF517:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1005:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1905:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF2197:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF1384:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1721:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF2467:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2646:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1757:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF1051:
+	.string	"__fsfilcnt_t_defined "
+.LASF2382:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF914:
+	.string	"WNOHANG 1"
+.LASF2344:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF2586:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF2557:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF438:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2889:
+	.string	"cmsx_menuRTHEntries"
+.LASF1745:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF1060:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1291:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF2239:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF1399:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF2324:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1261:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF530:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF1944:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1809:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF1336:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF544:
+	.string	"__USE_ATFILE 1"
+.LASF2728:
+	.string	"FP_NAN 0"
+.LASF2546:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1871:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF2618:
+	.string	"__DECL_SIMD_erff128 "
+.LASF2211:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF1356:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF1349:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF2701:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2279:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF1677:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF1434:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1165:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF2437:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1626:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF2552:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF2019:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF2394:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF843:
+	.string	"USE_FAKE_BARO "
+.LASF2453:
+	.string	"__DECL_SIMD_acosf "
+.LASF525:
+	.string	"__USE_ISOC95 1"
+.LASF1661:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF2473:
+	.string	"__DECL_SIMD_asinf "
+.LASF2677:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1119:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1999:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF916:
+	.string	"WSTOPPED 2"
+.LASF1829:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF836:
+	.string	"NULL"
+.LASF1585:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF2554:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2480:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1048:
+	.string	"__blksize_t_defined "
+.LASF1937:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF2685:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1501:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF1074:
+	.string	"__have_pthread_attr_t 1"
+.LASF1903:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF917:
+	.string	"WEXITED 4"
+.LASF2724:
+	.string	"__MATHCALL_NARROW"
+.LASF473:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1958:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF2046:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF1547:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF1795:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF1108:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF860:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1495:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF2750:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF554:
+	.string	"__PMT"
+.LASF1900:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF1263:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF832:
+	.string	"_WCHAR_T_DECLARED "
+.LASF431:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2333:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF418:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1064:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1232:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF1216:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF2681:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2827:
+	.string	"beginTransaction"
+.LASF2716:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1444:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF1266:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF2108:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF1125:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1604:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF2745:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1597:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF2649:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2264:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF1041:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2051:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF1690:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1667:
+	.string	"SETTING_DEADBAND 153"
+.LASF1692:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF1372:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF2706:
+	.string	"_Mdouble_ _Float64x"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1786:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF2303:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1200:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1267:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF1112:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1685:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF1921:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF2040:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF945:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2627:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1432:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1116:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF479:
+	.string	"USE_VTX_TRAMP "
+.LASF985:
+	.string	"__off_t_defined "
+.LASF1566:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1640:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF1904:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF2175:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1433:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF1017:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1837:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1728:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF918:
+	.string	"WCONTINUED 8"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF414:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1092:
+	.string	"UNIT_TESTED "
+.LASF1734:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF875:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2419:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1922:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2064:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF824:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1435:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF1676:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2203:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1981:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF1121:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF895:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2516:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF2851:
+	.string	"OME_Bool"
+.LASF564:
+	.string	"__P(args) args"
+.LASF1948:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF2679:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF961:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1549:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1140:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2591:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1107:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF802:
+	.string	"_SYS_SIZE_T_H "
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1994:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1783:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF1599:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF2702:
+	.string	"_Mdouble_ _Float128"
+.LASF2072:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF1148:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1429:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF1439:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF1293:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF1533:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1655:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF1249:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF1550:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF1370:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF1993:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF1739:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF2387:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1063:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF2840:
+	.string	"cursorRow"
+.LASF1314:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF512:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2653:
+	.string	"__DECL_SIMD_tanf "
+.LASF1657:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF2792:
+	.string	"int8_t"
+.LASF2276:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF2101:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF2235:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF2009:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF1385:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF1036:
+	.string	"__suseconds_t_defined "
+.LASF2345:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF1468:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1476:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF1053:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF2674:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1045:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1134:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1419:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF406:
+	.string	"USE_BLACKBOX "
+.LASF2161:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF2000:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF503:
+	.string	"__USE_XOPEN2K8"
+.LASF2024:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2511:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2181:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF1893:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF2828:
+	.string	"commitTransaction"
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF838:
+	.string	"__need_NULL"
+.LASF839:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1128:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2723:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1515:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF2335:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF2704:
+	.string	"_Mdouble_ _Float32x"
+.LASF2242:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF2351:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF541:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF878:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF505:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2717:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF2533:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2043:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF1443:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2295:
+	.string	"SETTING_NAME_MIN 0"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF2446:
+	.string	"__DECL_SIMD_powf32 "
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2577:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1465:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF2462:
+	.string	"__DECL_SIMD_atan "
+.LASF2765:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF533:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2710:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1545:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1194:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF425:
+	.string	"USE_RANGEFINDER "
+.LASF1280:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF2357:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2485:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF1438:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF1337:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2346:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF1129:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1732:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF2756:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1510:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF1141:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1675:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF1079:
+	.string	"_STRING_H 1"
+.LASF1731:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF1807:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF2084:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1763:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1334:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF1436:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF2740:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1488:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF2287:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF2463:
+	.string	"__DECL_SIMD_atanf "
+.LASF1553:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF1463:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF1353:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF1847:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF2835:
+	.string	"cols"
+.LASF2608:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF2746:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1182:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF904:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2781:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1798:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF2784:
+	.string	"signed char"
+.LASF962:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1146:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF2370:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1210:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF1819:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF460:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1528:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF1452:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF1789:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF2236:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF2526:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF799:
+	.string	"__size_t__ "
+.LASF2350:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF1229:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF2726:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF924:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1945:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF2531:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1883:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF2358:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2424:
+	.string	"__DECL_SIMD_logl "
+.LASF828:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2801:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF993:
+	.string	"__time_t_defined 1"
+.LASF1020:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1012:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1350:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF2081:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1813:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF2354:
+	.string	"sq(x) ((x)*(x))"
+.LASF2151:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF2578:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2879:
+	.string	"onGlobalExit"
+.LASF426:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1840:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF2144:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF1801:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1662:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF1204:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF1681:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF1073:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF489:
+	.string	"_FEATURES_H 1"
+.LASF964:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1699:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF807:
+	.string	"_BSD_SIZE_T_ "
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1558:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF2172:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF866:
+	.string	"USE_DASHBOARD"
+.LASF480:
+	.string	"USE_VTX_FFPV "
+.LASF1596:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF2757:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1274:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF2221:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1052:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1448:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF1960:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF922:
+	.string	"__WCLONE 0x80000000"
+.LASF2621:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1286:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF2049:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF2574:
+	.string	"__DECL_SIMD_log2l "
+.LASF2598:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2341:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF810:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1496:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1047:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1264:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF1606:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF1656:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF938:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF2104:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2749:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF953:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF450:
+	.string	"USE_ANTIGRAVITY "
+.LASF1376:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2271:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF2311:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF894:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF2050:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF2539:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1963:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1873:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF1664:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1299:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF1588:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF1803:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF2220:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF478:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2826:
+	.string	"isReady"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2334:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF1101:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1362:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1612:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF906:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1368:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF1295:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF1749:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF1325:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF2626:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF396:
+	.string	"USE_I2C_PULLUP "
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF1635:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF2058:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF1226:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF436:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1374:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF1925:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF2550:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1915:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF2115:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF841:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1520:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2748:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2657:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1138:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2156:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF2888:
+	.string	"cmsx_menuNavSettings"
+.LASF1198:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2665:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF2247:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1206:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF2588:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1256:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF2107:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF401:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2059:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1853:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF2521:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF990:
+	.string	"__key_t_defined "
+.LASF1591:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF1682:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF2422:
+	.string	"__DECL_SIMD_log "
+.LASF963:
+	.string	"__f32(x) x ##f32"
+.LASF1156:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2222:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1379:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF1991:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF2580:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1942:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF1015:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF2091:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF2183:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1706:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF1004:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1595:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF2251:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2435:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2622:
+	.string	"__DECL_SIMD_tanh "
+.LASF877:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2486:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1592:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF1722:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF1380:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF1321:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF2391:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1367:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF1710:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF1104:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1713:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF2039:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF1133:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1160:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF1294:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF1180:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF2593:
+	.string	"__DECL_SIMD_atanhf "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1825:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF2466:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF526:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2743:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1209:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF457:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF493:
+	.string	"__USE_ISOCXX11"
+.LASF1437:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF1143:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2790:
+	.string	"long int"
+.LASF2047:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF2647:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2426:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1305:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF2002:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1701:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2216:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF2449:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2141:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF1884:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF2411:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF519:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1392:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF461:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF2065:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2168:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF2405:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF884:
+	.string	"USE_RCDEVICE"
+.LASF1329:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF2340:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1984:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF2360:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2766:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1057:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1794:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF2769:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2312:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF2495:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF792:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF1365:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF2413:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2697:
+	.string	"_Mdouble_ _Float32"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2850:
+	.string	"OME_Funcall"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1622:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF994:
+	.string	"__timer_t_defined 1"
+.LASF1457:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF791:
+	.string	"__PTRDIFF_T "
+.LASF2174:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF1035:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF975:
+	.string	"EXIT_SUCCESS 0"
+.LASF1988:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF2417:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2843:
+	.string	"maxChar"
+.LASF1485:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF2678:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2764:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2542:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1191:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1977:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF1927:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF2067:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF1158:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF2325:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1627:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1378:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF1919:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF2572:
+	.string	"__DECL_SIMD_log2 "
+.LASF1411:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF2524:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2722:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2129:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF2210:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF1666:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF1826:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF2684:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1205:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2795:
+	.string	"uint32_t"
+.LASF805:
+	.string	"__SIZE_T "
+.LASF2163:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1796:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF2474:
+	.string	"__DECL_SIMD_asinl "
+.LASF1554:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF889:
+	.string	"U_ID_0 0"
+.LASF2230:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF967:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1471:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1619:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF2540:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1954:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF2030:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF1836:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF2668:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1142:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2833:
+	.string	"device"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2148:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF2032:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF1338:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1695:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF1684:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF2560:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2331:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF1224:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF2881:
+	.string	"CMS_Menu"
+.LASF804:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1741:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF1650:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF968:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1039:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1641:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF1787:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF532:
+	.string	"__USE_POSIX2 1"
+.LASF1778:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF833:
+	.string	"__DEFINED_wchar_t "
+.LASF1705:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF1323:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1351:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF577:
+	.string	"__flexarr []"
+.LASF970:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF518:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1078:
+	.string	"__COMPAR_FN_T "
+.LASF2292:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF2225:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1687:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF485:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF2747:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1093:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1602:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1751:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF1033:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1704:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF1118:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF821:
+	.string	"_T_WCHAR_ "
+.LASF1743:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1257:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF2017:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF456:
+	.string	"CMS_MENU_OSD "
+.LASF1534:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF1754:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF529:
+	.string	"_POSIX_C_SOURCE"
+.LASF1972:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF1225:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF2768:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2714:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF973:
+	.string	"RAND_MAX 2147483647"
+.LASF1629:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF1478:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF2160:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF1969:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF1100:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1127:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2464:
+	.string	"__DECL_SIMD_atanl "
+.LASF2044:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF1756:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1719:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF1208:
+	.string	"SETTING_LOOPTIME 0"
+.LASF2124:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2296:
+	.string	"SETTING_NAME_MAX 16"
+.LASF1407:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF415:
+	.string	"USE_PITOT "
+.LASF1752:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF1366:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF405:
+	.string	"USE_64BIT_TIME "
+.LASF2687:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF477:
+	.string	"USE_VTX_CONTROL "
+.LASF2603:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1147:
+	.string	"DYNAMIC (1 << 2)"
+.LASF2791:
+	.string	"char"
+.LASF1058:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2299:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF1624:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF1753:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF1300:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF1615:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1776:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1947:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF1968:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF1523:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF956:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2369:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF2320:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF2818:
+	.string	"readChar"
+.LASF2074:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2367:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2565:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2735:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1521:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1636:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF2482:
+	.string	"__DECL_SIMD_hypot "
+.LASF2371:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF2290:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF2615:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1192:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF915:
+	.string	"WUNTRACED 2"
+.LASF2356:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1023:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1115:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF463:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF2132:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF2569:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF2846:
+	.string	"OME_LabelFunc"
+.LASF1797:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF1097:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1430:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2142:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF1575:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF1623:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF467:
+	.string	"USE_RX_MSP "
+.LASF1567:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF1605:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF1085:
+	.string	"true 1"
+.LASF2399:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1369:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF2130:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF429:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1852:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"_SIZE_T_DEFINED "
+.LASF2408:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2154:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF2439:
+	.string	"__DECL_SIMD_expf32x "
+.LASF435:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1724:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF2186:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF2180:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF2373:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1164:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF1087:
+	.string	"__bool_true_false_are_defined 1"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF951:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2595:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF816:
+	.string	"__size_t "
+.LASF912:
+	.string	"__need_NULL "
+.LASF1278:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF1726:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF2541:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1381:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF1541:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF2691:
+	.string	"_Mdouble_ float"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1466:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF2648:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF2477:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2502:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1683:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF837:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2601:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1686:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF1546:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1817:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2609:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1072:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2515:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1447:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF2306:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF1415:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2576:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF2652:
+	.string	"__DECL_SIMD_tan "
+.LASF1529:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF1691:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF1306:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF400:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2667:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1152:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1090:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2098:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1311:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1031:
+	.string	"__sigset_t_defined 1"
+.LASF1135:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1393:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF2503:
+	.string	"__DECL_SIMD_exp10f "
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1897:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1199:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2738:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF835:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1573:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF2558:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF790:
+	.string	"_T_PTRDIFF "
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1653:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF2430:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1332:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2305:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF1714:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF2204:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2310:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF1301:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF2455:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF408:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF2099:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF2147:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF1489:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF2712:
+	.string	"__MATHCALL"
+.LASF1888:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF2214:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF371:
+	.string	"__linux 1"
+.LASF1949:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF1727:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF1850:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF2410:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2815:
+	.string	"screenSize"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2277:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF2265:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF2478:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1377:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF462:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF987:
+	.string	"__id_t_defined "
+.LASF2529:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF419:
+	.string	"USE_GYRO_KALMAN "
+.LASF1202:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1538:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF1998:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF1487:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF941:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF1851:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF1070:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF931:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2232:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF2272:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF1772:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF1343:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF2421:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1244:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF1530:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF1409:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF1069:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1894:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF2095:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF1227:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF989:
+	.string	"__daddr_t_defined "
+.LASF1397:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF2169:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF1219:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF2079:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF1806:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF2253:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1781:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF1512:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF921:
+	.string	"__WALL 0x40000000"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1002:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1016:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF376:
+	.string	"unix 1"
+.LASF2758:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2109:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2105:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF2590:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1421:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2630:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1926:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1862:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF2328:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1613:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF2429:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1955:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF1055:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1651:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF507:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2459:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF933:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2004:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF413:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1565:
+	.string	"SETTING_THR_EXPO 119"
+.LASF2120:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2812:
+	.string	"release"
+.LASF1234:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF2755:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1939:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF1123:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF2089:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF977:
+	.string	"_SYS_TYPES_H 1"
+.LASF2471:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF870:
+	.string	"USE_RANGEFINDER"
+.LASF2297:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2338:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF1019:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1617:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF2254:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2173:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF1601:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF1000:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1978:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF2243:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF2575:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1970:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF2763:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1875:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF2829:
+	.string	"getCanvas"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1003:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1387:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF2083:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF2007:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF2185:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2171:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF538:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1890:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF2629:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2122:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF1996:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1290:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF825:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2500:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF2337:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF1775:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF2363:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF395:
+	.string	"I2C2_OVERCLOCK false"
+.LASF972:
+	.string	"__lldiv_t_defined 1"
+.LASF2579:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF899:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2191:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2234:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF2811:
+	.string	"grab"
+.LASF2281:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF1062:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1497:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1230:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF2187:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF2395:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2802:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF2848:
+	.string	"OME_OSD_Exit"
+.LASF1979:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF2223:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF488:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2640:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF928:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF495:
+	.string	"__USE_POSIX2"
+.LASF1251:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF2871:
+	.string	"data"
+.LASF1589:
+	.string	"SETTING_YAW_RATE 127"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1750:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF1896:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF1275:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF2867:
+	.string	"func"
+.LASF1183:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF2570:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1923:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF2654:
+	.string	"__DECL_SIMD_tanl "
+.LASF2501:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1522:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF2125:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF2418:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF458:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1355:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF2075:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF2013:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF2860:
+	.string	"OME_TAB"
+.LASF2282:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF1932:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF1440:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF1241:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF2698:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF2761:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1408:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF502:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1388:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF1255:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF2632:
+	.string	"__DECL_SIMD_asinh "
+.LASF1304:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF2825:
+	.string	"writeFontCharacter"
+.LASF397:
+	.string	"USE_RX_PPM "
+.LASF441:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1049:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1990:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF920:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1914:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF822:
+	.string	"_T_WCHAR "
+.LASF1422:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF815:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1181:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1382:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF930:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2309:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF1282:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF1186:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF786:
+	.string	"_STDDEF_H_ "
+.LASF2612:
+	.string	"__DECL_SIMD_erf "
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1401:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF1631:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1920:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF1203:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF2155:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF2566:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1987:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF2634:
+	.string	"__DECL_SIMD_asinhl "
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF2119:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF1056:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2288:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF2658:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF454:
+	.string	"USE_STATS "
+.LASF846:
+	.string	"USE_MAG "
+.LASF1839:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF2137:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2759:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1616:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1491:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF2619:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2066:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2218:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF1008:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1744:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF1902:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF2671:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF496:
+	.string	"__USE_POSIX199309"
+.LASF2241:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1845:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF1262:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF2581:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1144:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2244:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF793:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF823:
+	.string	"__WCHAR_T "
+.LASF2760:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2824:
+	.string	"getFontMetadata"
+.LASF1188:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF1579:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF978:
+	.string	"__u_char_defined "
+.LASF2659:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2339:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1975:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF1967:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1720:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF2594:
+	.string	"__DECL_SIMD_atanhl "
+.LASF926:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1328:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF1040:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF794:
+	.string	"___int_ptrdiff_t_h "
+.LASF911:
+	.string	"__need_wchar_t "
+.LASF2468:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2663:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF958:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF523:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2283:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2323:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF890:
+	.string	"U_ID_1 1"
+.LASF2620:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2797:
+	.string	"long long unsigned int"
+.LASF979:
+	.string	"__ino_t_defined "
+.LASF2005:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF2561:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2535:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1610:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1654:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF1361:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF1269:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF2447:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1333:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF2343:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF2866:
+	.string	"CMSMenuOptFuncPtr"
+.LASF1371:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1723:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF2348:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF2205:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF1995:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF1451:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF943:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2778:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1420:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1354:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF2571:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1169:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF2025:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF2028:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF1765:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF394:
+	.string	"I2C1_OVERCLOCK false"
+.LASF2128:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2772:
+	.string	"LON 1"
+.LASF2285:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF1663:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2273:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF2493:
+	.string	"__DECL_SIMD_exp2f "
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF2409:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2038:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF486:
+	.string	"_STDINT_H 1"
+.LASF2159:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF2270:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF2861:
+	.string	"OME_END"
+.LASF2662:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF2096:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF424:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF942:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1603:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF1580:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF2121:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF449:
+	.string	"USE_D_BOOST "
+.LASF1768:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF1400:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF534:
+	.string	"__USE_POSIX199506 1"
+.LASF2610:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1689:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF2006:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF892:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF867:
+	.string	"USE_OLED_UG2864"
+.LASF1095:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF2583:
+	.string	"__DECL_SIMD_log1pf "
+.LASF2770:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF484:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF905:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1513:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF2822:
+	.string	"txBytesFree"
+.LASF2068:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF536:
+	.string	"__USE_XOPEN2K8 1"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2520:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2845:
+	.string	"OME_Label"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1211:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF2316:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1814:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF2830:
+	.string	"displayPortVTable_s"
+.LASF1540:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1962:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF1668:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF539:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1082:
+	.string	"_STRINGS_H 1"
+.LASF2490:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1857:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2379:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2407:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF537:
+	.string	"_ATFILE_SOURCE"
+.LASF474:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF434:
+	.string	"USE_1WIRE "
+.LASF1810:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2655:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1552:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF1046:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1770:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF1863:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF2545:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1992:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF1671:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF960:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1313:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF1832:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF2600:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1504:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF2507:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2849:
+	.string	"OME_Submenu"
+.LASF1632:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF2450:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2400:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1423:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF2022:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1091:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF861:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF2538:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF528:
+	.string	"_POSIX_SOURCE 1"
+.LASF2021:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF1470:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF1891:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF1054:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1898:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF2208:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF1559:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF2374:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1077:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF2106:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF1509:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF1237:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1130:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2302:
+	.string	"SETTING_STATS_MAX 0"
+.LASF1260:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF1084:
+	.string	"bool _Bool"
+.LASF907:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1543:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF1824:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF1864:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2562:
+	.string	"__DECL_SIMD_log10 "
+.LASF1395:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF2508:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2336:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF1250:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF1822:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2563:
+	.string	"__DECL_SIMD_log10f "
+.LASF1761:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF2568:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1760:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF2403:
+	.string	"__DECL_SIMD_sinf "
+.LASF2262:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF2559:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2190:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF2117:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF1643:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF998:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1658:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1389:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF1014:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2543:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF410:
+	.string	"USE_TELEMETRY "
+.LASF2444:
+	.string	"__DECL_SIMD_powl "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1043:
+	.string	"NFDBITS __NFDBITS"
+.LASF2796:
+	.string	"long long int"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2870:
+	.string	"text"
+.LASF1755:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1849:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF2029:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF1593:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF1281:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF1175:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF1861:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1983:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF974:
+	.string	"EXIT_FAILURE 1"
+.LASF1028:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF2014:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF1126:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2858:
+	.string	"OME_FLOAT"
+.LASF935:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF862:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2372:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF885:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2257:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF2226:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF2015:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2869:
+	.string	"itemId"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1672:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF2734:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF2707:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF992:
+	.string	"__clockid_t_defined 1"
+.LASF2249:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF2836:
+	.string	"posX"
+.LASF2837:
+	.string	"posY"
+.LASF2451:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2170:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF2813:
+	.string	"clearScreen"
+.LASF1075:
+	.string	"_ALLOCA_H 1"
+.LASF447:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1068:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2775:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF848:
+	.string	"USE_UART1 "
+.LASF1872:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF925:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1974:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF2361:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2865:
+	.string	"CMSEntryFuncPtr"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1427:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1402:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF445:
+	.string	"USE_FRSKYOSD "
+.LASF1951:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1586:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1659:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF1985:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1889:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF1153:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1858:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF896:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF509:
+	.string	"__USE_ATFILE"
+.LASF1276:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2532:
+	.string	"__DECL_SIMD_sinh "
+.LASF1933:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF2505:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1297:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF856:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1910:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF1071:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2076:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF936:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1665:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF399:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1195:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF849:
+	.string	"USE_UART2 "
+.LASF2625:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF514:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1472:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF1823:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF2092:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2773:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2256:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF1647:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2847:
+	.string	"OME_Back"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2736:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1460:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF1899:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF2192:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1080:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2891:
+	.string	"cmsx_menuFixedWingEntries"
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2523:
+	.string	"__DECL_SIMD_expm1f "
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1971:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1860:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2258:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF1373:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF2882:
+	.string	"OSD_SETTING_s"
+.LASF2884:
+	.string	"OSD_SETTING_t"
+.LASF1357:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2136:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF1799:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF1634:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF2431:
+	.string	"__DECL_SIMD_logf128x "
+.LASF2779:
+	.string	"RADAR_MAX_POIS 5"
+.LASF2434:
+	.string	"__DECL_SIMD_expl "
+.LASF850:
+	.string	"USE_UART3 "
+.LASF2366:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2680:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2602:
+	.string	"__DECL_SIMD_acosh "
+.LASF909:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2785:
+	.string	"__int8_t"
+.LASF1609:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF2420:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2547:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2332:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1535:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF800:
+	.string	"__SIZE_T__ "
+.LASF1109:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1270:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF2313:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF476:
+	.string	"USE_RCDEVICE "
+.LASF2386:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF811:
+	.string	"_SIZE_T_DECLARED "
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1711:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1326:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF872:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1502:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF2359:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2294:
+	.string	"SETTING_NAME 362"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2549:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2729:
+	.string	"FP_INFINITE 1"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2267:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF1997:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF2606:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1185:
+	.string	"CMS_EXIT (0)"
+.LASF2782:
+	.string	"unsigned int"
+.LASF2842:
+	.string	"cachedSupportedTextAttributes"
+.LASF851:
+	.string	"USE_UART4 "
+.LASF1805:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF1025:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1587:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF1965:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF2146:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF2651:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2771:
+	.string	"LAT 0"
+.LASF1426:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF2458:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2255:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF2056:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1578:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1315:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF2469:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2116:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF2553:
+	.string	"__DECL_SIMD_atan2f "
+.LASF857:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF2624:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2694:
+	.string	"_Mdouble_ long double"
+.LASF464:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2048:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1644:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1878:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF1693:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2494:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1117:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2317:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF2787:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2878:
+	.string	"onExit"
+.LASF423:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF466:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2555:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2206:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2377:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1959:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1238:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1268:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF2077:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF23:
+	.string	"_LP64 1"
+.LASF852:
+	.string	"USE_UART5 "
+.LASF2026:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF1748:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF2416:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1621:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF801:
+	.string	"_SIZE_T "
+.LASF1042:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1844:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF444:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1170:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1514:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF2644:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2131:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF868:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1096:
+	.string	"EXTENDED_FASTRAM "
+.LASF2582:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1982:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF2509:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1456:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF1375:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF898:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1555:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF2031:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF1598:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1934:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF2053:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF797:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1114:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF939:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1461:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF1157:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1245:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF2166:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF2873:
+	.string	"flags"
+.LASF2693:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2427:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1882:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF2638:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1886:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF1124:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF2073:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF1163:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1989:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF853:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2544:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1842:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2960:
+	.string	"thread-shared-types.h"
+.LASF2911:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2987:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2913:
+	.string	"/usr/include"
+.LASF2991:
+	.string	"mathcalls-helper-functions.h"
+.LASF2954:
+	.string	"select.h"
+.LASF2945:
+	.string	"floatn-common.h"
+.LASF2925:
+	.string	"stdint.h"
+.LASF2897:
+	.string	"src/main/build"
+.LASF2910:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2973:
+	.string	"stdbool.h"
+.LASF2976:
+	.string	"time.h"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_navigation.c"
+.LASF2942:
+	.string	"waitflags.h"
+.LASF2980:
+	.string	"navigation.h"
+.LASF2906:
+	.string	"src/main/target/SITL"
+.LASF2959:
+	.string	"pthreadtypes.h"
+.LASF2940:
+	.string	"common_post.h"
+.LASF2909:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2926:
+	.string	"libc-header-start.h"
+.LASF2949:
+	.string	"timer_t.h"
+.LASF2994:
+	.string	"failsafe.h"
+.LASF2938:
+	.string	"stddef.h"
+.LASF2922:
+	.string	"platform.h"
+.LASF2914:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2978:
+	.string	"settings.h"
+.LASF2903:
+	.string	"src/main/flight"
+.LASF2947:
+	.string	"clockid_t.h"
+.LASF2975:
+	.string	"build_config.h"
+.LASF2921:
+	.string	"stdc-predef.h"
+.LASF2984:
+	.string	"vector.h"
+.LASF2985:
+	.string	"math.h"
+.LASF2950:
+	.string	"endian.h"
+.LASF2982:
+	.string	"filter.h"
+.LASF2927:
+	.string	"features.h"
+.LASF2908:
+	.string	"src/main"
+.LASF2904:
+	.string	"src/main/io"
+.LASF2986:
+	.string	"math-vector.h"
+.LASF2929:
+	.string	"wordsize.h"
+.LASF2900:
+	.string	"src/main/config"
+.LASF2972:
+	.string	"cms.h"
+.LASF2971:
+	.string	"strings.h"
+.LASF2993:
+	.string	"feature.h"
+.LASF2964:
+	.string	"struct_rwlock.h"
+.LASF2952:
+	.string	"byteswap.h"
+.LASF2933:
+	.string	"stubs.h"
+.LASF2936:
+	.string	"time64.h"
+.LASF2968:
+	.string	"string.h"
+.LASF2924:
+	.string	"target.h"
+.LASF2934:
+	.string	"stubs-64.h"
+.LASF2979:
+	.string	"settings_generated.h"
+.LASF2983:
+	.string	"maths.h"
+.LASF2896:
+	.string	"obj/main/SITL"
+.LASF2943:
+	.string	"waitstatus.h"
+.LASF2902:
+	.string	"src/main/fc"
+.LASF2937:
+	.string	"wchar.h"
+.LASF2930:
+	.string	"timesize.h"
+.LASF2899:
+	.string	"src/main/common"
+.LASF2912:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2995:
+	.string	"gps.h"
+.LASF2948:
+	.string	"time_t.h"
+.LASF2919:
+	.string	"cms_types.h"
+.LASF2990:
+	.string	"fp-fast.h"
+.LASF2944:
+	.string	"floatn.h"
+.LASF2918:
+	.string	"display.h"
+.LASF2962:
+	.string	"atomic_wide_counter.h"
+.LASF2974:
+	.string	"parameter_group.h"
+.LASF2928:
+	.string	"features-time64.h"
+.LASF2953:
+	.string	"uintn-identity.h"
+.LASF2989:
+	.string	"fp-logb.h"
+.LASF2951:
+	.string	"endianness.h"
+.LASF2917:
+	.string	"stdint-uintn.h"
+.LASF2920:
+	.string	"cms_menu_navigation.c"
+.LASF2946:
+	.string	"clock_t.h"
+.LASF2905:
+	.string	"src/main/navigation"
+.LASF2932:
+	.string	"long-double.h"
+.LASF2931:
+	.string	"cdefs.h"
+.LASF2988:
+	.string	"flt-eval-method.h"
+.LASF2992:
+	.string	"mathcalls.h"
+.LASF2935:
+	.string	"typesizes.h"
+.LASF2923:
+	.string	"common.h"
+.LASF2939:
+	.string	"sanity_check.h"
+.LASF2969:
+	.string	"locale_t.h"
+.LASF2907:
+	.string	"src/main/target"
+.LASF2981:
+	.string	"axis.h"
+.LASF2901:
+	.string	"src/main/drivers"
+.LASF2955:
+	.string	"sigset_t.h"
+.LASF2967:
+	.string	"stdlib-float.h"
+.LASF2977:
+	.string	"runtime_config.h"
+.LASF2941:
+	.string	"stdlib.h"
+.LASF2898:
+	.string	"src/main/cms"
+.LASF2958:
+	.string	"struct_timespec.h"
+.LASF2957:
+	.string	"struct_timeval.h"
+.LASF2916:
+	.string	"stdint-intn.h"
+.LASF2965:
+	.string	"alloca.h"
+.LASF2970:
+	.string	"__locale_t.h"
+.LASF2915:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2963:
+	.string	"struct_mutex.h"
+.LASF2966:
+	.string	"stdlib-bsearch.h"
+.LASF2961:
+	.string	"pthreadtypes-arch.h"
+.LASF2956:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \344\305\006"
+	.string	"\264\f\330"
+	.string	"$"
+	.string	"\326\226\262\343\006\001\261\263\220\234\016\002\003\004\005\325\214\204\264\001\006\207\272\357\362\r\007\356\233\274\240\007\b\215\200\232\312\t\t\326\257\245\272\002\n\265\221\246\205\005\013\372\356\316\240\017\f\200\203\347\307\004\r\257\243\203\362\003\016\343\247\251\233\013\017\214\313\310\253\013\020\327\356\206\212\001\021\362\320\255\235\r\022\362\273\215\253\004\023\337\333\237\302\007\024\332\274\351\230\017\025\241\215\347\254\005\026\250\361\263\306\017\027\314\356\313\377\013\030\361\250\266,\031\277\234\371\256\f\032\355\260\225\275\f\033\366\365\267\236\b\034\227\201\210\021\035\351\327\225\306\017\036\234\200\236\236\f\037\337\323\323\224\003 \310\250\211\214\004!\271\272\342\226\002\"\365\344\260\317\005#\266\205\263\243\006"
+	.string	"\004"
+	.ascii	"@$\345\256\227\246`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.4061be95c6cf1fa3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto___compound_literal.1.50.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\214\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.2.51.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\220\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.3.52.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\222\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.4.53.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\221\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.5.54.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\223\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.6.55.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\245\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.7.56.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\212\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.8.57.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\246\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuNavSettingsEntries.59.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`\360\002E\022"
+	.string	"\344\034\016\003"
+	.string	""
+	.string	"\326"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.ascii	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212"
+	.ascii	"\001"
+	.string	"\206\200\200\374\230\330\370Vw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\t\016\202\200\200\370\266\006ig:\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\270\266\006i_H\206\b][\314\315\001q\313\001o\312\006\025\001\007\265\006iYX\206\bWU\322\323\001q\321\001o\320\006\025\001\006\265\006iSk\330\331\001q\327\001o\326\005\370\264\006iQ~\206\bOM\336\337\001q\335\001o\334\004\270\264\006iK\222\001\206\bIG\344\345\001q\343\001o\342\003\370\257\006iE\244\001\206\bCA\352\353\001q\351\001o\350\002\270\257\006i\277\177\263\001\360\361\001q\357\001o\356\301\001\206\b\275\177\234\254\360\002\273\177\364us\365\001q\363\273\320\001\271\1773\366\0014\362\001\355\001\354\001\347\001\346\001\341\001\340\001\333\001\332\001\325\001\324\001\317\001\316\0015\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms_menu_navigation.c"
+	.string	"\rMC HOVER THR"
+	.string	"\017MID FOR AH"
+	.string	"\022MC MAX BANK ANGLE"
+	.string	"\022AH CLIMB RATE"
+	.string	"\023NAV\021CRUISE SPEED"
+	.string	"\016\rCONTROL MODE"
+	.string	"\025-- BASIC SETTINGS --"
+	.string	"<  \003\231!.\006\262\001\244\244\036\334\033\036l\2542c\271\254F\226o\301[\270]Ii\305\2536\323\315\n\022\016\026[\343\036H\031\033\330kv\271i\260M\353*c\370\236\301\316M\357*c\370f\360\215\350*c|\331`MYh'\027\204\024\323`\033\241N\"\tYL\203od\255\307\026\022\247i\321\312H\365\315\026\306n\337\204\005?\247\226"
+	.ascii	"\026%\207\036`\021"
+	.text
+	.section	.gnu.lto_cmsx_menuNavSettings.60.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\305\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms/cms_menu_navigation.c"
+	.text
+	.section	.gnu.lto___compound_literal.11.62.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\236\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.12.63.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\241\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.13.64.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\232\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.14.65.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\234\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.15.66.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\235\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.16.67.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\224\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.17.68.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\225\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.18.69.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\226\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.19.70.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\230\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.20.71.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\237\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.21.72.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\227\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuRTHEntries.74.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`\013\004E\025"
+	.string	"\206\"\205I\240\234Mc\034\251x0\272\334\036\272\222\316(\332< 4\233\307M\336a\\\234&M\276\017n\264+\324j\255,i\225\310a\253\013\037\n\3735M\360\231\254m7\026\256\247v\021\004\363\035\326\343i\342z\213\244w4v\222\001s"
+	.string	"o"
+	.string	"r"
+	.string	"'\242_Ud\202P\335\030*\340[\365\263\t\222\037\245?%e\341B\335\267!|\255\226nv\350\316#\037J\337G\357\366\310\355()\021\325\375\240\b_\253\237\317\207D"
+	.string	"\347<\256\207g\312\360&\335\235\362\237\364q\364\216\026\334\340`\203\"\353\312\204\031\237o\277\304\303\016u\203\n\036\336\206\207\017\325\227\204\004\341\244Z\256\207:G\340zH\267(\255q\0057\n$\223_F\377\214\2313\206\214\272\1775\003_)"
+	.ascii	"`\362\303\350\217\021s(\032\370"
+	.string	"J\375j\266\344k\351w\341r2\235Nu\277\306\371\204\357T\230\225oE\037\313\025QV\367Y\214\370N\271\240\344G\321\237\"\345'~\360\245\np\036\327\222|&\372N\232\220Au\177\327\360\245\372\035\311\277\322O\202\344&\241n\036\016\337\252%\001Crw7t\264#\322\r\365t9\330\016_\035,\307\353\301z\022\320\254\201\210\0073\312\231\007\273\241A21\026\322\347\270\216\3778\220S]\310\255n\344J\034\374\311\261N\345U\236\345Z\356\345_\376\373\326\321<\r(\242\001\230\304\340T\361,&\335\23528B\203$zG\373\\\201\323\244\224\242E\335\327\002}\031\004\241\301\020 \322\351\342E\335\307\202\201\003\364\365\262@fi_/\033:\316n5;\200\2324\261\216\345\315g\214\331X\215\244\311t\250\211+I\037K#E\363\206\226\243\351#\026\240f9R\310\241\246h\200\232\242\025\272\321p\366"
+	.string	"\035e6\321\304\2213k#k:\0247\226@\2465\313[L\264@f\231Cg\343\030\001g\177l\344\314&\322\354O9\326\306\035\232\353\331elt\213\360\206O\250Q,g\25069aaY\311r \003\221\251\352\020(c\206\206\216A\036\364\277_\256A\203z7\352\370Bi\335\3230\\\035edk\024u\254P\257\217\342\021"
+	.ascii	"\363S}P\361\215\265\237\213TD\033(\004d\350\2146\322\247)\254"
+	.ascii	"9\377\360KDr\210$\017\344\311hW3\237\322^\277\306\237hoi\302"
+	.ascii	"\336Z\204|\224\3546\343\257{\213 q\235K\004\211\323\275\0265"
+	.ascii	"\220d\237H\363oq\272;!GN7\303\217C\206:\f]!\223\001"
+	.text
+	.section	.gnu.lto_cmsx_menuRTH.75.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\344\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms/cms_menu_navigation.c"
+	.text
+	.section	.gnu.lto___compound_literal.24.77.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\262\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.25.78.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\263\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.26.79.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\264\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.27.80.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\265\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.28.81.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\266\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.29.82.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\267\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.30.83.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\270\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.31.84.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\271\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto___compound_literal.32.85.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006'\001\273\002?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_cmsx_menuFixedWingEntries.87.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`J\003\255\022"
+	.string	"\244\035^\003"
+	.string	""
+	.string	"\340"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.ascii	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212"
+	.ascii	"\001\206\200\200\374\230\330\310\236\nw"
+	.string	"\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\n\016\202\200\200\370\357aig:\206\be\254\254\024c\307as\310\001q\306\001o\305\001m\304\t\270\357ai_N\206\b][\315\316\001q\314\001o\313\370\356aiY]\322\323\001q\321\001o\320\007\356aiWq\206\bUS\330\331\001q\327\001o\326\006\025\001\006\355aiQ\201\001\206\bOM\336\337\001q\335\001o\334\005\270\355aiK\222\001\344\345\001q\343\001o\342\004\354aiI\242\001\206\bGE\352\353\001q\351\001o\350\003\354aiC\260\360\361\001q\357\001o\356\002\370\347aiA\276\366\367\001q\365\001o\364\317\001\206\b\277\177\234\254\264\016\275\177\372us\373\001q\371\273\330\001\273\1773\374\0014\370\001\363\001\362\001\355\001\354\001\347\001\346\001\341\001\340\001\333\001\332\001\325\001\324\0015\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms_menu_navigation.c"
+	.string	"\023CONTROL SMOOTHNESS"
+	.string	"\016LOITER RADIUS"
+	.string	"\023PITCH TO THTIO"
+	.string	"\017MAX DIVE ANGLE"
+	.string	"\020CLIMB\017BANK\rTHROTTLE"
+	.string	"\rMIN\020CRUISE\021-- FIXED WING --"
+	.ascii	"B\250AT&\220R\245\242\224\221\302\034 \003\021\032\347\020(C"
+	.ascii	"hh\212\202\0364\200B\324m\006@ig\016\233\004\254P\317\007\305"
+	.ascii	"\203\003w\313a\243\244C\333\027n\024\305\372\313\330\234\016"
+	.ascii	"\253\363Lp\005\024\246(#p\335L@J\204QuDC\271t\354p\260\255a\320"
+	.ascii	"9\222I\370\310.q\300\274\233\211s\233\220\333bY\270ZG\016\207"
+	.ascii	"\332\304\036\277\205\301\031jT.\003"
+	.text
+	.section	.gnu.lto_cmsx_menuFixedWing.88.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\376\201\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms/cms_menu_navigation.c"
+	.text
+	.section	.gnu.lto_cmsx_menuNavigationEntries.94.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`\377"
+	.string	"\245\n"
+	.string	"$\021\207\001"
+	.string	""
+	.string	"l"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\370\250\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\004\004\370\306rig:\206\be\254\254\024c\307\310\001q\306\001o\305\001m\304\003\270\306riaF\206\b_]\315\316\001q\314\001o\313\002\370\305ri[K\206\bYW\323\324\001q\322\001o\321[\206\bU\234\254\244\024S\327\330\001q\326\273(Q3\331\0014\325\001\320\001\317\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms_menu_navigation.c"
+	.string	"\013FIXED WING"
+	.string	"\004RTH"
+	.string	"\017BASIC SETTINGS"
+	.string	"\021-- NAVIGATION --"
+	.string	"\034"
+	.string	"\266\013\310*\002\342~\354%Oc\nd\024\2628"
+	.string	"\305"
+	.ascii	"\203\301F@W\2201\30070\030l\004\2726!3(}\nFCF\254\320\365j\262"
+	.ascii	"\\hb\243>\247,\001S\224\224\241\007P\004"
+	.text
+	.section	.gnu.lto_cmsx_menuNavigation.95.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 g9\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\325\202\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/cms/cms_menu_navigation.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"}\005"
+	.string	"$\007^\001"
+	.string	""
+	.string	""
+	.string	"\005\337"
+	.string	""
+	.string	"\301\204\336"
+	.string	"\001\300\003\005<\002\313"
+	.string	"\003\330"
+	.string	"\004\327"
+	.string	"\005\315"
+	.string	"\006\316"
+	.string	"\007\317"
+	.string	"\b\320"
+	.string	"\t\321"
+	.string	"\n\322"
+	.string	"\013\323"
+	.string	"\f\324"
+	.string	"\r\325"
+	.string	"\016\312"
+	.string	"\017>\020?\021\300"
+	.string	"\022\301"
+	.string	"\023\302"
+	.string	"\024\303"
+	.string	"\025\304"
+	.string	"\026\305"
+	.string	"\027\306"
+	.string	"\030\307"
+	.string	"\031\310"
+	.string	"\032;\0332\0343\0354\0365\0376 7!8\"9#\300\204\001"
+	.string	""
+	.string	"\003"
+	.ascii	"# \240\223\313\001\031g<\343\2143^\306l\031s2\316#\217y\344\221"
+	.ascii	"\307<\362@\036%\017\376\214\t\031\313#\217<\346\221G\036\363"
+	.ascii	"\310#\217y\344\241<J\036\234d#m\277\027"
+	.text
+	.section	.gnu.lto_.refs.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375 [M\002"
+	.string	"\262E\021\0270uZ\003\300\300\300\300\300t\325*\"\"\216&*\032l\357\235\244\f\206yiYI9)\031\0315\220\217\216\215\214\213\212\211\210\207\206\320SH8\370\024t6\003\001\227\263\252\203\246\213>5\375\322\2653\263L"
+	.text
+	.section	.gnu.lto_.decls.4061be95c6cf1fa3,"e",@progbits
+	.string	"(\265/\375`x\034\245e"
+	.string	"\272\241`#Q0P\322I\007o[;\tgd\346`~\334\357w\267t\362\202\365\363\270\313Ok\025\r\274\217=\374\355\245\273\211NA\330\252_|4\016\275\215\366\341\207\353Z\306n\270\207\204"
+	.string	"+*\331\375\251\226\241\017\240J\245\372\340\022\b\202;\021\310\331[\312\024\315\001)\0021\002U\370J\211'*!\323I\253o]\335.\364s\333\035Ca*%\236\250\326&\270 \037\370\242\320\371\001\256\253\033\320\017\020\020\320\216\032$xc9\367lD=\217Y\261f\234h\2564\325s\025Oy^,%rI\372\236\227T)t\252\024*sX\346\316t\177\220\210\347\355\254+\223u]\017H\231\236\242V}\317\346\302\324*\206('r??\341'\307Y()\2565n]\237\034p\356\244v\200\351\313pq@\306\362r\364}\r\365\034\345\374\366\025\352\347\246*\212\221,}\177v\373\2059\\\376`8\353\373\024\324\307PU\366I\001x21\335A\361?\201\275U\304\005P{eb\272"
+	.string	"\373\244o\225\237D\347\317N\230\374\374\035\001\233\211\237=X\200\201\n\017\177\257`F\335`z\241\205\025\224GKD\374\334\342\347\265\237\325\322~Nr\344g#\306\"?\023!\373y,\202\277\267\350\340\2408\331\224 1+\023\342\365\337\356\177\335\377\030\376\337\375\327\362\237.\354\277\372w\361g\243\237\301~\376\332\372Y\313\307\317Y=~\346a\365s\225\324\317Q\035~~\372\331i\351g"
+	.string	"~\336\371\231\347\347\236\237\207?\007\360\263\322\317\353\317\377\331\376\027l\274\300??\250\2311|?\007\375<\364\363\210\377\366o\275\237]\370\271\205\237m\374\274\302\3174~V\376\234\302\317G?\317\370\031\3713\321\317\307\237\215?\213\360s\b?\203\360\363\007?{\360\363\213\2379\370y\203\237U\374\234\342\347\023?c\360\263\005?W\360\363\004?\233\370\231\304\317\r\374|\300\317\005\374\374\363\263"
+	.string	"\377\267\374o\340?\336\177\007\242\321h\364\277a\362\337!\277\317\0037\207}R\016}LL[\313\332\251\303\272\037?\316<Q\207bYY\274E\b\265zPc\242\251%Qy\004\273\331\315\021l\260\\\352\320/\217\235\234\327<\206L\321+\b\260\2047\332\226\306\342v\354\320\260\035\351\373\276\372\231\013w\351\035$\254\353"
+	.string	"9]8\370\2260\334\217PI0\bY\337\252\326\321SM\325Lv\266\325\371\255qt\216/\035\325Rp^\315w\023\3575Wx\351h\247\206\032zX\327\257\350Y[\361\030&c\335\316\204SLSm\305{,\306>\317p\346\370\230?@W*\315\0325;w\345\031\\\033\f\314R\331\n\023\323\002\330'mBMq\322\267\237\330\256\302\206\b\257\004&\301\302R\377\367R3\265\022;\273)\316\f\257\261\362\212\322\3432\335\3043\334\316\266Q\251p^R}\353\272\026\337M\314\246W\366\322|\256V=|9\246\262\b"
+	.string	"\002\002J\355\252\272\256\324;\310QA\235\247\335X\231\276\267N\203\202\226\217\315\n\331\rgAa\023\2276f_\256\201\003wj\020\343E\027hCO\230\220\275\036}\333\f\353\304\344\270\372\003\344\277\257+\316\215+4H\312\250gs\350\r\335\231\0161`\330OGl\212\227@,4\250\271^rbigsV\303}<W=\272"
+	.ascii	"\366\355\203\246H\363a\246/\243\3414g(\237a\350\020\327\272."
+	.ascii	"1\264\347\206u]\352af\200\231\201\273\304\313l.\275\357)\352"
+	.ascii	"\333M}7Q\027`b\372\037\372\367\245jkL@5\225\371\030\f;\021\340"
+	.ascii	"0V\351\311\223\311\272>{v\230\314\262>S\317\b\244\034e\004\322"
+	.ascii	"w\231\3728\275\342\331\213OJ\325|\256=\367\253\006\346\221\276"
+	.ascii	"\227}R\225\212\211)/Q\251\303A\024\274\306\314\306Nf\343-\032"
+	.ascii	"<W\245\034\247,&\032\340J\365\003\002\234\262<%\256\276\254\345"
+	.ascii	"\3314\344\203[#\370E\275\020\026\2462\365\006$\013\307\300v,"
+	.ascii	"\003;\371\216\233\374\347\271\256M\353\272\236\237u,\027\365"
+	.ascii	"&\326\267\256\317\363\363/\006\227\241\230\230r[\361\026\206"
+	.ascii	"\034*}lL\333\264=\322*\"`l\217\337bY\036\214\265\006y\352\313"
+	.ascii	"M&\246>T\305\333+\241\234\raw;\254\325\333\233\021\252\276\267"
+	.ascii	"V\277\245\262U\303\255'O\232}9\200\251\342-sX\265\3666\327\227"
+	.ascii	"\203\016\251\035/\2522`}o\245~\233\303F\341i\341\013\354{@&\246"
+	.ascii	"=\354\223Z\250\342-\0165\032\255\033\353;\274\361\024\3666\207"
+	.ascii	"e\237~\333d\235X\210\n\376\365=\031&\246<\226I\311jy\034\241"
+	.ascii	"\333a\227\254\222\316\230(yrV\351\357\250]\031\272C\205\313["
+	.ascii	"X\337\007\230\230\336\260O*(\210\246\031\030xF\310\324\246\215"
+	.ascii	"\2314\177\1773ha\303\246\214\233\237\037\03135j\\,\351\251YP"
+	.ascii	"h\215.\252\223\312C\303\030v\366\230F\203\264\205\211\006\210"
+	.ascii	"E\302\272\016\240\336\005\202\365\231\277\311t\231{\003\222\""
+	.ascii	"Z}{\206\342\333L\323\325\\\221\276B\256&\2342a\302\224\325\361"
+	.ascii	"\361\2215\371\362e\fG\210\236\236\030N\025\027.[i \036\236V\032"
+	.ascii	"F\213\026 i\225\273\273\037\351\232\235\235\217\324\253\256."
+	.ascii	"+\325q\345\n\f7\177\352\020\b\n9v\266\\W\361\322\221"
+	.string	"JI\323D\253\357\233\312\337sM\207\263\206k\213\251oK)\276\247\350t\311\322\347\354\273\303>)\221\n\313\r\037\034\234\336\224\267\267.J\240@\341\322\325\326\226w\023\345t\342\261i\322d\213\036\033\233\026\271\265\265V\242\256M'\0172\\$\352\303~vvX+\271@\351)\246\324\303T%-\005kbI\003S/\324h]\326f\326\355L\215r\022\354$\354l\264>k#-\244\305z\354/\242\365\021\0263Tz\256\314\2340\203SY\226\bt\b[z\177\271\324k\245\366\220&\302\316\017]\344M\326c\277Yz>\237:V\264\344\256\372\376\342P\317\037R\033\215\362\207\364\327Imb\372\303\304\324B\325a\234\026;[\253\277\350\230h\200Xg\212T5\373\276\275\232\353\006\232\245\217\256ow\025\337AR5\250\300%\035%H\214\0201$\024\324\301\200\242\004A&J\220\030!bH(\250X\324"
+	.string	"F\007AE\t\204L\224 1B\304\022\t\271T^\245QE\213\0250`\244x\301\2634\216(\252FG\025\354P\020\b\243c\022rYdd\214\221\244q\2044\343\210\310h$*\221E\004\310H\026}\020\003Y\243(\203"
+	.string	"4\200\321\301\216RF\262h\271D\276\350\240\224q42\341fY\003\271\264\361\202\305\211\236\245\322\270L:ra\343h\204\244,\212\301s\227H\034\222\216'\020]\242$\r\023\324\030+f \227E\351qy\214q\227\306\022\313d\021\r\234\253D\026\025p\007\214/X\234P\177\002\b%\022\311\306\322\200\037!!\223B,\217\216\222B\350(\221EI\313$\022'\t\271L\246H\036\341$-]l"
+	.ascii	"@\362(MZ\272 J\322\310\200F\022\311\342\005\213\023C\033I\313"
+	.ascii	"d\n#\212\027\033\bc Q :\"\245\313\242\032)\214\216%\034\031\251"
+	.ascii	"H\036\355\0349$t\024B\016\035A(p\023&N,\340A\013\025*\021\210"
+	.ascii	"\244Q9\203(D\262\3508#\004Q\2222\004\210\006\222GE\313\243\214"
+	.ascii	"\"\025\216-h"
+	.ascii	"$\2213\2145\2243\210|\332\232\007\324\257y\367tfu\201Y\247\233"
+	.ascii	"\220\212\030Y_\337\026R\274uBA\331\327\222&\274\305\236\361K"
+	.ascii	"\202\306\344\013\207\017Z7\305\326U\204j{YnK\326\234\250\362"
+	.ascii	"\234\354\332\337]V\215\241Q\2635R}o\205\211J\322\214UFlZ\234"
+	.ascii	" \221(\275\276\026\255x\233$\201)vW\372\342 9\322\306\334\201"
+	.ascii	"f\217\374\366\314\032\t\222\032\023\322\367201\3251+\322#&\314"
+	.ascii	"I\227\276\267E,\021)\302\255+\037{}y\315Q\274\0352\330&*\256"
+	.ascii	"\214\214L\026\332\232\276\267d\277\355\262c\303-`wS}\231\013"
+	.ascii	"\253x+F"
+	.string	"\207'h&\244\321\334\244aZ\203$\fl\250\326\303.\256\357-\330o\275\354\027O\224\267%0}Y\214\211)\261\253x\033D\035\31425\326\267\003\327\326\352%l\257\357\355\326o\241\254VK\371hB\373\276\257\251x\013\244\315\342\360\360~\370\340\331\373\302\022\246\357\255\217\337N\331,/iib:\2021\250\002\2119\304\2641\314\314\b\211H\223$\215\001\342\013\020\002\n'!\326\326\003\022`\303<S\322 #\"\"$8\225TJ\373\034\004\336_\275\274\231\027\350\245;b\334\230\f\224Pp\324W\004\n\022\001\201h\251\350\301\350\273P$9\324=\325\304{\225u\023\\\307p\210\f\314\316$ \367\034\261\003d\233\027a\336\302\341-\223?\032\016*\254\217h\366\r\266\206\256=\204\250<e=A\205ED\253]\311\243j=\376\216 C\022\323\344,\251\n\327\n\3036\364\212,\230}\034\007>\351\223"
+	.string	"\006\234\f\322\b\315\244x`\231\031?\263i\300\370\330\322\333X\356[\206M\200\310/\225<\005\204\035z\310\211\355\241=\273\236\347\217\340\341\234\35707"
+	.string	"\232\366\247\2216\277\302&\206\240'\273\320\036K\254\b\302w$i\2763\321\223\013aS\005\316\223\223\030\276\231h\260\244\223i\212\247\274\246\031\204\002\324rR\376\031\226\f\f\224*\363sX\031\304\216\207\217\333"
+	.string	"PaU{\303\r\243z\311!\316_\346\245\364\315\nl\375\331g\271\230hy\002en|\261\273\206m\305i\007\234\337\"\262N\371\322\0343f\322$@\371\bcx\344v\034\264|b\366\370\375\277\332\335\030\340\032\343r\303\256\021\306>\364\215\023hD\031\026&\327\346\024\377.\035h\021.\\/\336\310:o"
+	.ascii	"\022\022\307O\330\321\3015\023\202\307\3721a\275\344\212\266"
+	.ascii	"\f\214\273\265)\364Wy\331Oa\241\232\262I\366\233Q\212[\203\375"
+	.ascii	"}\232\356\213\277y\003$\316\273Q\215=\244t\234\021m\355\220\336"
+	.ascii	"\37548\0035\324\235\323\313\"hh\330#L\276\225\313\306\371t;a"
+	.ascii	"\266\202\202J\242\007C7\321lk\371\352\300o\031\330\324(E\270"
+	.ascii	"{\243\212\206\267\271\3554!\223\226:\bC\307{t\344\004\304s\331"
+	.ascii	"\234\013\363/\276\305\310\304S\231T\226@\225\020\247m\b\251:"
+	.ascii	"ov\262\nr>\017\314H8YP$2\340\257x\026\303\345\004\323\203\335"
+	.ascii	"S\242f(\242C\3613$A\372\364\274\200L<\001\n\335.!\243e\302d\360"
+	.ascii	"#&M8w\363\221\224T\377\226\323\345\376\373iK\247\331h\030a\005"
+	.ascii	"5!4\304\224\260\350fe[Ll3\265\314=\f\327o\205k\006\307~\364\366"
+	.ascii	"\334\304em\236(\364\221]\260-8/\027\220\177\177+D\332\366\021"
+	.ascii	"Y\320t_x\227\324#\221\315\022\232\317i\304\264j\217\254\017&"
+	.ascii	"\004\364R\274\313}\365\265\310+\214\234,G4\305\326\350\324\027"
+	.ascii	"\366\025\367\337(\274\221\351pa$\002\212\232Q\257S\261'G\300"
+	.ascii	"\026b\230 \005\027U\336\201\337\254\035\377\212&\323\370\204"
+	.ascii	"\213)\313\376\023.\2702\367\025\271$\250\230a;\271\212\322\315"
+	.ascii	"^p\3611T4\330\204u\363X1(\361\037\264\200\321\276\324\244w\334"
+	.ascii	"\003J\033\025\003:=\246\221\266\r\230\321P^\334\212(\351&\261"
+	.ascii	"\210\013\177\006\001\245\305\t\354\262\216(e\364L\223\203\214"
+	.ascii	"\307%\026EA\237h\272\244\317\357H1e\351\276DN\226-\214\030\365"
+	.ascii	"\304\264\025>Z\353\375\255\f9\020\262T\3208\277\332X\314\323"
+	.ascii	"k\256P\227qL\023\3262\346\254\265\261\013\372\263\330\277\355"
+	.ascii	"\354.\207E\206\030\330\371\036\370\371\2712\02665\251-\247\310"
+	.ascii	"\333\263Z2\020[\341l\030h\013n\230\271=2\370FS\013\3472=b\337"
+	.ascii	"\254y\007\271E\030w\342&\262\203C\0326>\353\222O\314O\007+|\352"
+	.ascii	"\022\273\362G]n\345h\311\332KOO\347\232\352R\221;X]Q\337(z\002"
+	.ascii	"O\003\002d~[\364k}GO\237\330\361\ne=xvM+"
+	.text
+	.section	.gnu.lto_.symtab.4061be95c6cf1fa3,"e",@progbits
+	.string	"cmsx_menuNavigation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4061be95c6cf1fa3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8053 @@
+	.file	"cms_menu_saveexit.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms_types.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/cms/cms_menu_saveexit.h"
+	.file 8 "./src/main/cms/cms_menu_saveexit.c"
+	.file 9 "./src/main/cms/cms.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_saveexit.c.3e5a0ddc
+	.weak	cms_menu_saveexit.c.3e5a0ddc
+cms_menu_saveexit.c.3e5a0ddc:
+	.long	0x6fb
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF1202
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1097
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1098
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1099
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1100
+	.uleb128 0x5
+	.long	.LASF1102
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1101
+	.uleb128 0x5
+	.long	.LASF1103
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1104
+	.uleb128 0x5
+	.long	.LASF1105
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1106
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1107
+	.uleb128 0x11
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1108
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1109
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1110
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1111
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1112
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x6
+	.long	0xd2
+	.uleb128 0x5
+	.long	.LASF1113
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xed
+	.uleb128 0x6
+	.long	0xdc
+	.uleb128 0x9
+	.long	.LASF1121
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1114
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x118
+	.uleb128 0x4
+	.long	.LASF1115
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1116
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1117
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1118
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0xf9
+	.uleb128 0x5
+	.long	.LASF1119
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1120
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x13c
+	.uleb128 0x9
+	.long	.LASF1122
+	.uleb128 0x5
+	.long	.LASF1123
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x14d
+	.uleb128 0x9
+	.long	.LASF1124
+	.uleb128 0x5
+	.long	.LASF1125
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x163
+	.uleb128 0x6
+	.long	0x152
+	.uleb128 0xc
+	.long	.LASF1145
+	.byte	0x98
+	.byte	0x56
+	.long	0x266
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x338
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x338
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x338
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x338
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x351
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x379
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3a1
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1133
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3d3
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3e7
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x338
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x3f7
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x40b
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x41f
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x43d
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x460
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x474
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x489
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x3f7
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x4a7
+	.byte	0x90
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1146
+	.byte	0x20
+	.byte	0x45
+	.long	0x30e
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x30e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1149
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0xf2
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1154
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0xf2
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x124
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xba
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x15e
+	.uleb128 0x5
+	.long	.LASF1159
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x266
+	.uleb128 0x6
+	.long	0x313
+	.uleb128 0x7
+	.long	0x70
+	.long	0x333
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x3
+	.long	0x313
+	.uleb128 0x3
+	.long	0x324
+	.uleb128 0x7
+	.long	0x70
+	.long	0x34c
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0x3
+	.long	0x33d
+	.uleb128 0x7
+	.long	0x70
+	.long	0x379
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xd2
+	.uleb128 0x2
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	0x356
+	.uleb128 0x7
+	.long	0x70
+	.long	0x3a1
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x124
+	.byte	0
+	.uleb128 0x3
+	.long	0x37e
+	.uleb128 0x7
+	.long	0xf2
+	.long	0x3c9
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0x3c9
+	.uleb128 0x2
+	.long	0x3ce
+	.byte	0
+	.uleb128 0x3
+	.long	0xba
+	.uleb128 0x3
+	.long	0x124
+	.uleb128 0x3
+	.long	0x3a6
+	.uleb128 0x7
+	.long	0xf2
+	.long	0x3e7
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x3d8
+	.uleb128 0xd
+	.long	0x3f7
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x3
+	.long	0x3ec
+	.uleb128 0x7
+	.long	0xc6
+	.long	0x40b
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x3fc
+	.uleb128 0x7
+	.long	0x124
+	.long	0x41f
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x410
+	.uleb128 0x7
+	.long	0xf2
+	.long	0x438
+	.uleb128 0x2
+	.long	0x438
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x141
+	.uleb128 0x3
+	.long	0x424
+	.uleb128 0x7
+	.long	0x70
+	.long	0x45b
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0xba
+	.uleb128 0x2
+	.long	0x45b
+	.byte	0
+	.uleb128 0x3
+	.long	0xe8
+	.uleb128 0x3
+	.long	0x442
+	.uleb128 0x7
+	.long	0xf2
+	.long	0x474
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x3
+	.long	0x465
+	.uleb128 0xd
+	.long	0x489
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0x118
+	.byte	0
+	.uleb128 0x3
+	.long	0x479
+	.uleb128 0x7
+	.long	0xf2
+	.long	0x4a2
+	.uleb128 0x2
+	.long	0x4a2
+	.uleb128 0x2
+	.long	0x34c
+	.byte	0
+	.uleb128 0x3
+	.long	0x130
+	.uleb128 0x3
+	.long	0x48e
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x1
+	.long	0x531
+	.uleb128 0x4
+	.long	.LASF1160
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1161
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1162
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1163
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1164
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1166
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1167
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF1168
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1169
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF1170
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF1171
+	.byte	0xb
+	.uleb128 0x4
+	.long	.LASF1172
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1173
+	.byte	0xd
+	.uleb128 0x4
+	.long	.LASF1174
+	.byte	0xe
+	.uleb128 0x4
+	.long	.LASF1175
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF1176
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1177
+	.byte	0x11
+	.uleb128 0x4
+	.long	.LASF1178
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF1179
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1180
+	.byte	0x5
+	.byte	0x39
+	.byte	0x10
+	.long	0x542
+	.uleb128 0x6
+	.long	0x531
+	.uleb128 0x3
+	.long	0x547
+	.uleb128 0x7
+	.long	0x83
+	.long	0x55b
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0x55b
+	.byte	0
+	.uleb128 0x3
+	.long	0x565
+	.uleb128 0x6
+	.long	0x55b
+	.uleb128 0x12
+	.uleb128 0x5
+	.long	.LASF1181
+	.byte	0x5
+	.byte	0x3b
+	.byte	0x12
+	.long	0x577
+	.uleb128 0x6
+	.long	0x566
+	.uleb128 0x3
+	.long	0x57c
+	.uleb128 0x13
+	.long	0x8c
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0x5
+	.byte	0x40
+	.byte	0x5
+	.long	0x5ac
+	.uleb128 0xb
+	.long	.LASF1182
+	.byte	0x42
+	.byte	0x1f
+	.long	0x53d
+	.uleb128 0xb
+	.long	.LASF1183
+	.byte	0x43
+	.byte	0x21
+	.long	0x572
+	.uleb128 0xb
+	.long	.LASF1184
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0xe
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x5ee
+	.uleb128 0x1
+	.long	.LASF1185
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x18
+	.long	0xd7
+	.byte	0
+	.uleb128 0x15
+	.long	0x581
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1186
+	.byte	0x5
+	.byte	0x46
+	.byte	0x18
+	.long	0x560
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x5
+	.byte	0x47
+	.byte	0x13
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1189
+	.byte	0x5
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5ac
+	.uleb128 0x6
+	.long	0x5ee
+	.uleb128 0x5
+	.long	.LASF1190
+	.byte	0x5
+	.byte	0x78
+	.byte	0x10
+	.long	0x610
+	.uleb128 0x6
+	.long	0x5ff
+	.uleb128 0x3
+	.long	0x615
+	.uleb128 0x7
+	.long	0x83
+	.long	0x624
+	.uleb128 0x2
+	.long	0x624
+	.byte	0
+	.uleb128 0x3
+	.long	0x5fa
+	.uleb128 0x5
+	.long	.LASF1191
+	.byte	0x5
+	.byte	0x84
+	.byte	0x10
+	.long	0x610
+	.uleb128 0x6
+	.long	0x629
+	.uleb128 0xe
+	.byte	0x20
+	.byte	0x86
+	.long	0x676
+	.uleb128 0x1
+	.long	.LASF1192
+	.byte	0x5
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x60b
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1193
+	.byte	0x5
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x635
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x5
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x60b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1195
+	.byte	0x5
+	.byte	0x90
+	.byte	0x16
+	.long	0x624
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1196
+	.byte	0x5
+	.byte	0x91
+	.byte	0x3
+	.long	0x63a
+	.uleb128 0x6
+	.long	0x676
+	.uleb128 0x16
+	.long	.LASF1203
+	.byte	0x7
+	.byte	0x17
+	.byte	0x17
+	.long	0x682
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.byte	0xe
+	.long	0x6be
+	.uleb128 0x4
+	.long	.LASF1197
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1198
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1199
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1200
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1201
+	.byte	0x4
+	.byte	0
+	.uleb128 0x17
+	.long	0x5fa
+	.long	0x6ce
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	0x6be
+	.uleb128 0x19
+	.long	.LASF1204
+	.byte	0x8
+	.byte	0x24
+	.byte	0x18
+	.long	0x6ce
+	.uleb128 0x1a
+	.long	0x687
+	.byte	0x8
+	.byte	0x2f
+	.byte	0x10
+	.uleb128 0x1b
+	.long	.LASF1205
+	.byte	0x9
+	.byte	0x23
+	.byte	0x6
+	.long	0x83
+	.uleb128 0x2
+	.long	0x333
+	.uleb128 0x2
+	.long	0x55b
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 26 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 34 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.file 35 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 36 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 37 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.file 39 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.file 40 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 41 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x4
+	.file 42 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 44 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1092
+	.byte	0x4
+	.file 45 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1093
+	.byte	0x4
+	.file 46 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1021
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1206
+	.long	.LASF1207
+	.long	.LASF1208
+	.long	.LASF1209
+	.long	.LASF1210
+	.long	.LASF1211
+	.long	.LASF1212
+	.long	.LASF1213
+	.long	.LASF1214
+	.long	.LASF1215
+	.long	.LASF1216
+	.long	.LASF1217
+	.long	.LASF1218
+	.long	.LASF1219
+	.long	.LASF1220
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1221
+	.byte	0xb
+	.long	.LASF1222
+	.byte	0xb
+	.long	.LASF1223
+	.byte	0xb
+	.long	.LASF1224
+	.byte	0x5
+	.long	.LASF1225
+	.byte	0x2
+	.long	.LASF1226
+	.byte	0x5
+	.long	.LASF1227
+	.byte	0x2
+	.long	.LASF1228
+	.byte	0x2
+	.long	.LASF1229
+	.byte	0x2
+	.long	.LASF1230
+	.byte	0xe
+	.long	.LASF1231
+	.byte	0xf
+	.long	.LASF1232
+	.byte	0xf
+	.long	.LASF1232
+	.byte	0xe
+	.long	.LASF1233
+	.byte	0xb
+	.long	.LASF1234
+	.byte	0xe
+	.long	.LASF1235
+	.byte	0xe
+	.long	.LASF1236
+	.byte	0xb
+	.long	.LASF1237
+	.byte	0xb
+	.long	.LASF1238
+	.byte	0xd
+	.long	.LASF1239
+	.byte	0xb
+	.long	.LASF1240
+	.byte	0xc
+	.long	.LASF1241
+	.byte	0xc
+	.long	.LASF1242
+	.byte	0xb
+	.long	.LASF1243
+	.byte	0xb
+	.long	.LASF1244
+	.byte	0xb
+	.long	.LASF1245
+	.byte	0xe
+	.long	.LASF1246
+	.byte	0xf
+	.long	.LASF1247
+	.byte	0xa
+	.long	.LASF1248
+	.byte	0xa
+	.long	.LASF1249
+	.byte	0xe
+	.long	.LASF1250
+	.byte	0xe
+	.long	.LASF1251
+	.byte	0xb
+	.long	.LASF1252
+	.byte	0xb
+	.long	.LASF1253
+	.byte	0x9
+	.long	.LASF1254
+	.byte	0x8
+	.long	.LASF1255
+	.byte	0x7
+	.long	.LASF1256
+	.byte	0x8
+	.long	.LASF1257
+	.byte	0x8
+	.long	.LASF1258
+	.byte	0x4
+	.long	.LASF1259
+	.byte	0x1
+	.long	.LASF1260
+	.byte	0x3
+	.long	.LASF1261
+	.byte	0x4
+	.long	.LASF1262
+	.byte	0x6
+	.long	.LASF1263
+	.byte	0x5
+	.long	.LASF1264
+	.byte	0x5
+	.long	.LASF1265
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF745:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF1122:
+	.string	"displayCanvas_s"
+.LASF1120:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1146:
+	.string	"displayPort_s"
+.LASF1159:
+	.string	"displayPort_t"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF806:
+	.string	"USE_GPS "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF760:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1020:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF785:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1001:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1150:
+	.string	"cols"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF759:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1162:
+	.string	"OME_Back"
+.LASF1054:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF761:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF791:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1017:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1039:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1119:
+	.string	"textAttributes_t"
+.LASF1031:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF996:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1163:
+	.string	"OME_OSD_Exit"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF779:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF997:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1153:
+	.string	"useFullscreen"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1192:
+	.string	"onEnter"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1180:
+	.string	"CMSEntryFuncPtr"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF959:
+	.string	"USE_VCP"
+.LASF1187:
+	.string	"type"
+.LASF1032:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF772:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF727:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF773:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1062:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF1066:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF736:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1058:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1067:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF981:
+	.string	"NOINLINE "
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1177:
+	.string	"OME_BACK_AND_END"
+.LASF1124:
+	.string	"displayFontMetadata_s"
+.LASF1123:
+	.string	"displayFontMetadata_t"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF753:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF750:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1121:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF757:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1202:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1107:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF776:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1003:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF777:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1205:
+	.string	"cmsMenuExit"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF729:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF786:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1131:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1016:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1169:
+	.string	"OME_UINT8"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1079:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF999:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1164:
+	.string	"OME_Submenu"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1070:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1007:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1198:
+	.string	"ADC_RSSI"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1101:
+	.string	"signed char"
+.LASF998:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1110:
+	.string	"uint8_t"
+.LASF1077:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1051:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF769:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1060:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF746:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1097:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1055:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF754:
+	.string	"isascii(c) __isascii (c)"
+.LASF1082:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF734:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF1135:
+	.string	"heartbeat"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1168:
+	.string	"OME_INT8"
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1026:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1167:
+	.string	"OME_BoolFunc"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1144:
+	.string	"getCanvas"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1114:
+	.string	"_Bool"
+.LASF1178:
+	.string	"OME_MENU"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1181:
+	.string	"CMSMenuOptFuncPtr"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF1056:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF1166:
+	.string	"OME_Bool"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1023:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1174:
+	.string	"OME_Setting"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF1156:
+	.string	"grabCount"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1105:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1041:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF755:
+	.string	"toascii(c) __toascii (c)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1071:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1176:
+	.string	"OME_END"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1126:
+	.string	"grab"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF700:
+	.string	"__size_t__ "
+.LASF1149:
+	.string	"rows"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF780:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF758:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1188:
+	.string	"flags"
+.LASF1064:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1078:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF1048:
+	.string	"OPTSTRING (1 << 3)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1117:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF771:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1002:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1080:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF1125:
+	.string	"displayPortVTable_t"
+.LASF1160:
+	.string	"OME_Label"
+.LASF853:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF741:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1115:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1019:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1185:
+	.string	"text"
+.LASF1087:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1191:
+	.string	"CMSMenuOnExitPtr"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF790:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF1158:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1059:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1103:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1200:
+	.string	"ADC_AIRSPEED"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1065:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1170:
+	.string	"OME_UINT16"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF995:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1000:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1033:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1102:
+	.string	"__int8_t"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF1014:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1037:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF1084:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1052:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1046:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF854:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1165:
+	.string	"OME_Funcall"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1009:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF789:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1116:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF737:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1005:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF1203:
+	.string	"cmsx_menuSaveExit"
+.LASF1057:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1132:
+	.string	"writeChar"
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF726:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF764:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1184:
+	.string	"itemId"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF787:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1053:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1069:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF748:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF992:
+	.string	"UNIT_TESTED "
+.LASF1074:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1008:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1030:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF770:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1095:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF763:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF730:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1004:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1179:
+	.string	"OME_MAX"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1113:
+	.string	"osdCharacter_t"
+.LASF1106:
+	.string	"__uint32_t"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1018:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1201:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1204:
+	.string	"cmsx_menuSaveExitEntries"
+.LASF1073:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF775:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1190:
+	.string	"CMSMenuFuncPtr"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1013:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1083:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1142:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF1093:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1068:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1044:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF735:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1134:
+	.string	"isTransferInProgress"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1155:
+	.string	"cursorRow"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1099:
+	.string	"unsigned int"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1010:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1130:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1183:
+	.string	"menufunc"
+.LASF1094:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1024:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1022:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1127:
+	.string	"release"
+.LASF1036:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF747:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1088:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF395:
+	.string	"true 1"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1091:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1128:
+	.string	"clearScreen"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1173:
+	.string	"OME_FLOAT"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1034:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1171:
+	.string	"OME_INT16"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF808:
+	.string	"USE_NAV "
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF924:
+	.string	"USE_MAG "
+.LASF1108:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1047:
+	.string	"DYNAMIC (1 << 2)"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1012:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF742:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1143:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1098:
+	.string	"short unsigned int"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1042:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1109:
+	.string	"int8_t"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1076:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1090:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF788:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1133:
+	.string	"readChar"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1148:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1111:
+	.string	"uint16_t"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF782:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF990:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1100:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1049:
+	.string	"READONLY (1 << 4)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF728:
+	.string	"__BIG_ENDIAN 4321"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF1015:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF774:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF732:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1196:
+	.string	"CMS_Menu"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1138:
+	.string	"supportedTextAttributes"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF762:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1038:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF1021:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF766:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1027:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF778:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1086:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1050:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1141:
+	.string	"isReady"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1011:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF1081:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF756:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1197:
+	.string	"ADC_BATTERY"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF743:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF958:
+	.string	"USE_ADC"
+.LASF1072:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF767:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1189:
+	.string	"OSD_Entry"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF784:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF768:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1043:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1104:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1075:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1182:
+	.string	"func"
+.LASF740:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1151:
+	.string	"posX"
+.LASF1152:
+	.string	"posY"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF1154:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1193:
+	.string	"onExit"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF993:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1129:
+	.string	"drawScreen"
+.LASF1096:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1035:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF765:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1092:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1029:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF994:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF752:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1157:
+	.string	"cachedSupportedTextAttributes"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1139:
+	.string	"getFontMetadata"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1161:
+	.string	"OME_LabelFunc"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF988:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF991:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF925:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF744:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1145:
+	.string	"displayPortVTable_s"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF783:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1175:
+	.string	"OME_TAB"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF1140:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1061:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF731:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1112:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF733:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF725:
+	.string	"_CTYPE_H 1"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1172:
+	.string	"OME_String"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF781:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1137:
+	.string	"txBytesFree"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1194:
+	.string	"onGlobalExit"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF739:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1195:
+	.string	"entries"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF1025:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1199:
+	.string	"ADC_CURRENT"
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF852:
+	.string	"USE_LOG "
+.LASF738:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1063:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF1085:
+	.string	"CMS_EXIT (0)"
+.LASF1040:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1147:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1006:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF989:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1118:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1136:
+	.string	"resync"
+.LASF1186:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1045:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF751:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF749:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1028:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1089:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1263:
+	.string	"io_types.h"
+.LASF1239:
+	.string	"long-double.h"
+.LASF1248:
+	.string	"__locale_t.h"
+.LASF1253:
+	.string	"platform.h"
+.LASF1210:
+	.string	"src/main/drivers"
+.LASF1264:
+	.string	"rx_pwm.h"
+.LASF1233:
+	.string	"libc-header-start.h"
+.LASF1218:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1229:
+	.string	"cms.h"
+.LASF1208:
+	.string	"src/main/common"
+.LASF1222:
+	.string	"stdint-intn.h"
+.LASF1255:
+	.string	"target.h"
+.LASF1260:
+	.string	"time.h"
+.LASF1217:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1220:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1224:
+	.string	"display.h"
+.LASF1207:
+	.string	"src/main/cms"
+.LASF1212:
+	.string	"src/main/target/SITL"
+.LASF1237:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1265:
+	.string	"stats.h"
+.LASF1216:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1262:
+	.string	"config.h"
+.LASF1251:
+	.string	"endian.h"
+.LASF1249:
+	.string	"strings.h"
+.LASF1235:
+	.string	"features-time64.h"
+.LASF1225:
+	.string	"cms_types.h"
+.LASF1221:
+	.string	"types.h"
+.LASF1231:
+	.string	"stdbool.h"
+.LASF1219:
+	.string	"/usr/include"
+.LASF1206:
+	.string	"src/main/build"
+.LASF1256:
+	.string	"sanity_check.h"
+.LASF1234:
+	.string	"features.h"
+.LASF1254:
+	.string	"common.h"
+.LASF1242:
+	.string	"typesizes.h"
+.LASF1247:
+	.string	"locale_t.h"
+.LASF1209:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_saveexit.c"
+.LASF1243:
+	.string	"time64.h"
+.LASF1223:
+	.string	"stdint-uintn.h"
+.LASF1213:
+	.string	"src/main/target"
+.LASF1261:
+	.string	"feature.h"
+.LASF1228:
+	.string	"cms_menu_saveexit.c"
+.LASF1214:
+	.string	"src/main"
+.LASF1227:
+	.string	"cms_menu_saveexit.h"
+.LASF1244:
+	.string	"wchar.h"
+.LASF1211:
+	.string	"src/main/fc"
+.LASF1240:
+	.string	"stubs.h"
+.LASF1215:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1245:
+	.string	"string.h"
+.LASF1238:
+	.string	"cdefs.h"
+.LASF1232:
+	.string	"stdint.h"
+.LASF1259:
+	.string	"build_config.h"
+.LASF1246:
+	.string	"stddef.h"
+.LASF1241:
+	.string	"stubs-64.h"
+.LASF1250:
+	.string	"ctype.h"
+.LASF1236:
+	.string	"wordsize.h"
+.LASF1257:
+	.string	"common_post.h"
+.LASF1226:
+	.string	"adc.h"
+.LASF1258:
+	.string	"parameter_group.h"
+.LASF1252:
+	.string	"endianness.h"
+.LASF1230:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\002"
+	.string	"\231\311\225\323\004\001\234\305\300\226\003"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.b9e625e52d85e1c4,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cmsx_menuSaveExitEntries.32.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375`;\001e\013"
+	.string	"\344\020\311\001"
+	.string	""
+	.string	"f"
+	.string	"\005\001\006\035\001\020\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001\006y(wu\300\001s\277\001q\275\001o\274\001m\273\025\001\005\002'\002\206\bk\005\001\212\001\206\200\200\374\230\330\330Ui\305gu\306\001s\304\303\004\003\004\202\200\200\270\255>\177e\313\001\005\001'8\206\bc\206\200\200\350\002a\315\001(gu\316\001s\314\001q\312\001o\311\003\370\254<\322E\206\b_]\324\325\001s\323\001q\321\002\254/\330P\350\002i\332\333\001s\331V\206\b[\234\254\270\002Y\336wu\337\001s\335\2730W3\340\0014\334\001\327\001\326\001\320\001\317\001\310\001\307\001\302\001\301\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"#./src/main/cms_menu_saveexit.c"
+	.string	"\fSAVE+REBOOT"
+	.string	"\nEXIT"
+	.string	"\005\020-- / --"
+	.ascii	", \340\002\031\262u\bq\020$ye8\355\364-\344\033\326\245([)\227"
+	.ascii	"\321\n\016\235\340F\215p\034\251.\034\226\2317\016B\340\006\203"
+	.ascii	"\027\tn>\230oz\016<\227_rQ{ ^\356\264,q\344{\212\331\205\021"
+	.ascii	"\024\273\347ej\204\362\033@\330\205\216>\n\006pa\032o\bp"
+	.text
+	.section	.gnu.lto_cmsx_menuSaveExit.33.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 U\251\002"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\266(\177}"
+	.string	"?\202\210\200\b{y\273\001"
+	.string	"\013/root/repo"
+	.string	"#./src/main/cms/cms_menu_saveexit.c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 3m\001"
+	.string	"\004\002/"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005!"
+	.string	"\301\204\001 \001\300\003\001\"\177\002\377\037\001\220\316\200\320\200\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"I\005\202\313\002l\320*^"
+	.text
+	.section	.gnu.lto_.refs.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\002\001\003\001\002\002\002\002\002\002"
+	.text
+	.section	.gnu.lto_.decls.b9e625e52d85e1c4,"e",@progbits
+	.string	"(\265/\375`\341\t\3253"
+	.string	"*X\210\023F`\232R\007b\002\373\353/\326'\244\367\177\327\354\347\246\227`\177SM\354\362t[\304\302\244T\271*a\350\371\002\217\342,\232\341\275\203W\224D\205\310\316\025\274\205\341\177\016 D\300H\337<\360\003\350nS\332\224R\n\001%\001.\001wn\304\351.<Qe'\267\031\r\364\256rw~9\263\035w\216\307\2430\f\017)d"
+	.ascii	"p{Y\333NU\002\354\242\326W\367\270\335\252m\217:\222\027c\375"
+	.ascii	"\200\353\361\270U\264sr\355\034]\334\222\270v\271\356\t\026\032"
+	.ascii	"O\230\363\220\2343\002\226\305\323\325\352q\227\351 k\325$\232"
+	.ascii	"\006\327\355E\374\3657 \224\324W~\313\371\325\271\271\223\272"
+	.ascii	"\272\362\330\335\336\274\310\360\242\036\267\263U\363#\355mo"
+	.ascii	"\206\332\261\251:\242\303\311\263u\007\001L9\263u\366\270Q\264"
+	.ascii	"-\242m\275\310\006x\335\310\n3\264\247\365\001\275l\241\005\264"
+	.ascii	"\237\335\310&\360\"\333\337v\267]wCq\237\356\306\335\336\243"
+	.ascii	"\333\007t{O\267G\350\366\007\335\356\240\333\031t\373\002c\267"
+	.ascii	"\363t;\202n\327\351\366a\267\347t{\200n'v{\261\333o\272\335\273"
+	.ascii	"\035w\267\265\273\215\335\357\323\355\005\272\235@wG\351n)\335"
+	.ascii	"\r\274^\257\327\356\226\352\366\037\335\355T\330\317\270\032"
+	.ascii	"\241\031>\252\234\232?\242X\r\275\254\307ir\230\360EM\373\332"
+	.ascii	"n4\356\327\371\246\305\264\217G^\333e\032\214\215\334\331\013"
+	.ascii	"\276(N\006g\fI\225\277\2671b0\025n\314G\227i\027\343a\206\323"
+	.ascii	",*~\217\303T\203|puy\354_\034L{\325\373\274Z\341+\347\025^%\252"
+	.ascii	"\311y\005\321]\201\273\002,\204\232#\216\305\375F\332~!m?\217"
+	.ascii	"6\201\033Y\354E\266\273\301tWY A\244~f\255\357\371\025W\343q"
+	.ascii	",\300\246\"\357\220\234_\242P*-\373z\334/\326\266\363\260~u\036"
+	.ascii	"\266\037\254\355\267\274\237\366*E\226J\353\315D\240\226\252"
+	.ascii	":\254\3076^d\203U\334\310z\027T;\314\313\340A\334\321\\\315\321"
+	.ascii	"<J\20777\r\345I\265\3742U\027\004\334E\310\032\337c\207\362:"
+	.ascii	"\345\354\271\221Y#\245m\nK\234n\252\315\313\2117q;\177\342j~"
+	.ascii	"\327\355C\234H\357\2749;\345\234\333_&\016\027m\033\253\346\374"
+	.ascii	"\266\277\335?I\274\356\302\023UP\n\215Q\315\231\255)t\373Z/\343"
+	.ascii	"\247\377\313fK\nX\331c\234\030^8Y\216\340\301=\356\367\352\366"
+	.ascii	"\274\357\362\252\220nJ\233\330c\007[~\372\271p\230\031\351\216"
+	.ascii	"\307\303,\031\266\372\267\334\272\363\005\364\"\3075\365\313"
+	.ascii	"Y\313\3010{\215q\001\243\0352\301s5\307\373\254\244\271)\004"
+	.ascii	"\030_]hk\336\204v}h;\036\367cu\373\024\247\362\323\0219\023\b"
+	.ascii	"\3225\231\363s\267\235`\323\232\0316\036[\375\324K\277\352\251"
+	.ascii	"\\\355\257\332\333>\352\243V^\352_\270Q\265\372\241\256\247\345"
+	.ascii	"\201\372\342\237\336E\016\203\234\303\256g\177"
+	.string	"\345Y\\\013\220\355,8\305b\352\257\\\317\371\200\357\331M\334\236t\347\210\245\276\220\t#\304yh\rb\375\243j]\211\033Y\003^d\265\240\220\244=\324\267@\233\212\335\b\326\375\365\300z\334\300\350\263x\247_\341j\017}\363\342e\254\250\321-\316\345\241\336\245\355\200kT\255\033U\252\232s\376\351\207\272\231o\362*Zo\266\"\356EE\255\005\216\307#kW\0056m\361\365\263\365\265#\333\362w\265\002\367\320\224\330X\323n\r:MY\223~}\242\307\370DJ\342<M \217J\330\270KJ\227\211H\b\210\350>\213\\gs\210\ty\224\364\\\032\r\261\233\244\343D\236H\342$S\251Dk\344\001I\351.Y\244\2134\302n\321\005\227\271T\272\301O\345r\247\031\024\021\t\001\265}\242\347\251Lbr\017t3I\351\364q\233M\247\017\316S\271t\272L\345\215S\3512\203\230\315\033\247;\004\""
+	.string	"\263\311:\335\241$Si\203\022S)D$\004\224\303\344t\231AE\032\210@\004\215\224(\222\310$\366\bI\242y\304\201\331\024v\322\310H\002\322\202\222B\017Oc\300"
+	.string	"\224 \304\007\016m\262\307].)\225)\220\317\242'R\322\207\271D\"\371$\235O\237\236\005\356r)H\231\002I\244\304T\"\025-=\221\222:gY9\007\356N\f\232\303\214O,\215\312\343~\263\307\341\325\0219\317\311\230r\351=\366/\373\351\277\301Z\321D\337\036\023m\220A\251\360\240\217\373\311\272\277\306\217\261\327\034d\244\0367"
+	.string	"\032?\375b8N\3238\263\307\301\260\247\302\200\256m=\356\247v?\330\317\030v\355\b\243\361\270\205^d\003\200\301\250q8f\0243H\311L \"\242i\222\016\200\002\021\261\"\352\006\021p\245sh\212$I\323\376\006\301\255\211h\365\216R\0024\267`\274\374\037\244u{n^\343\211\3646Qs\202R\234>\021QaLb\207k\210xr~;%\250\332\305\t\252\036\313 \007\257\355)-\332\274p\241mA\222\257\261c"
+	.string	"\321Z\020g\351\325u{~3\216\247a\251\233\024-M\257\324=c\2650\017\246'\327$\247d2\035.0\246\003\335\351\371\306\270\206ME\250v\320\177)\213#ZI\0047,T,\211\310#\243\036\212\313\033\367s\013\213\246\312\214\016A\370\036M\244&\266\005I>\307\023\222\257\376\241\036\255\301\277\003\331 \357\377\343\275\2548e\315\221H\263\316bD\235\037"
+	.string	"-\373\235\357W\r\026\r\332\007O\230j+\325cQ\374\361\246\370\264\367\220\0013\333\265\344\242u|\3063B13\230pM\261IjK\324JH\315\206\360@\374\332\021A\335\246A\314\223\224p\3762\342\020\345\253<\250\255\036f\264(\355@\201\370\245\333T\b-V\003w[\n\030\265\244\340Z0\214r\362!(\"\241)')Ky\241\245\207w\031\2056G\350Jf'\376\237\250\242\025\224&\036\356\203\304bv\0010\342\266\001i\217$\375\006\241L+U\270#\264\030\207\212\227]w}/O\323\003\2068\226\215!\"\205\260\327\354\322\320\006\235\n"
+	.ascii	"!b\337\363\215*\206\2632\026O\001"
+	.text
+	.section	.gnu.lto_.symtab.b9e625e52d85e1c4,"e",@progbits
+	.string	"cmsx_menuSaveExit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"cmsMenuExit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b9e625e52d85e1c4,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
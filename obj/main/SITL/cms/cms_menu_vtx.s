@@ -0,0 +1,10462 @@
+	.file	"cms_menu_vtx.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/drivers/display.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/cms/cms_types.h"
+	.file 8 "./src/main/drivers/vtx_common.h"
+	.file 9 "./src/main/drivers/adc.h"
+	.file 10 "./src/main/cms/cms_menu_vtx.h"
+	.file 11 "./src/main/io/vtx_string.h"
+	.file 12 "./src/main/io/vtx.h"
+	.file 13 "./src/main/cms/cms_menu_vtx.c"
+	.file 14 "./src/main/common/printf.h"
+	.file 15 "/usr/include/string.h"
+	.file 16 "./src/main/fc/config.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	cms_menu_vtx.c.52eca0c0
+	.weak	cms_menu_vtx.c.52eca0c0
+cms_menu_vtx.c.52eca0c0:
+	.long	0xe8a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1373
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1170
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1171
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1172
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1173
+	.uleb128 0x5
+	.long	.LASF1175
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1174
+	.uleb128 0x5
+	.long	.LASF1176
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1177
+	.uleb128 0x5
+	.long	.LASF1178
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1179
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1180
+	.uleb128 0x5
+	.long	.LASF1181
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x9d
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1182
+	.uleb128 0x6
+	.long	0x9d
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x6
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1183
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1184
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x6
+	.long	0xbf
+	.uleb128 0x5
+	.long	.LASF1185
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1187
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x5
+	.long	.LASF1188
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	0xbf
+	.uleb128 0x5
+	.long	.LASF1189
+	.byte	0x5
+	.byte	0x19
+	.byte	0x1f
+	.long	0x116
+	.uleb128 0x6
+	.long	0x105
+	.uleb128 0x12
+	.long	.LASF1197
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1190
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.byte	0xe
+	.long	0x141
+	.uleb128 0x4
+	.long	.LASF1191
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1192
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1193
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1194
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3
+	.long	0x122
+	.uleb128 0x5
+	.long	.LASF1195
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x11
+	.long	0xbf
+	.uleb128 0x5
+	.long	.LASF1196
+	.byte	0x5
+	.byte	0x41
+	.byte	0x20
+	.long	0x165
+	.uleb128 0x12
+	.long	.LASF1198
+	.uleb128 0x5
+	.long	.LASF1199
+	.byte	0x5
+	.byte	0x42
+	.byte	0x26
+	.long	0x176
+	.uleb128 0x12
+	.long	.LASF1200
+	.uleb128 0x5
+	.long	.LASF1201
+	.byte	0x5
+	.byte	0x43
+	.byte	0x24
+	.long	0x18c
+	.uleb128 0x6
+	.long	0x17b
+	.uleb128 0xb
+	.long	.LASF1221
+	.byte	0x98
+	.byte	0x5
+	.byte	0x56
+	.long	0x290
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0x5
+	.byte	0x57
+	.byte	0xb
+	.long	0x363
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0x5
+	.byte	0x58
+	.byte	0xb
+	.long	0x363
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0x5
+	.byte	0x59
+	.byte	0xb
+	.long	0x363
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x5
+	.byte	0x5a
+	.byte	0xb
+	.long	0x363
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1206
+	.byte	0x5
+	.byte	0x5b
+	.byte	0xb
+	.long	0x37c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1207
+	.byte	0x5
+	.byte	0x5c
+	.byte	0xb
+	.long	0x3a4
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1208
+	.byte	0x5
+	.byte	0x5d
+	.byte	0xb
+	.long	0x3cc
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0x5
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3fe
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xb
+	.long	0x412
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0x5
+	.byte	0x60
+	.byte	0xb
+	.long	0x363
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x5
+	.byte	0x61
+	.byte	0xc
+	.long	0x422
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x5
+	.byte	0x62
+	.byte	0x10
+	.long	0x436
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0x5
+	.byte	0x63
+	.byte	0x18
+	.long	0x44a
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0x5
+	.byte	0x64
+	.byte	0xb
+	.long	0x468
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0x5
+	.byte	0x65
+	.byte	0xb
+	.long	0x48b
+	.byte	0x70
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x5
+	.byte	0x66
+	.byte	0xb
+	.long	0x49f
+	.byte	0x78
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x5
+	.byte	0x67
+	.byte	0xc
+	.long	0x4b4
+	.byte	0x80
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x5
+	.byte	0x68
+	.byte	0xc
+	.long	0x422
+	.byte	0x88
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0x5
+	.byte	0x69
+	.byte	0xb
+	.long	0x4d2
+	.byte	0x90
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1222
+	.byte	0x20
+	.byte	0x5
+	.byte	0x45
+	.long	0x339
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x5
+	.byte	0x46
+	.byte	0x20
+	.long	0x339
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x5
+	.byte	0x47
+	.byte	0xb
+	.long	0x96
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0x5
+	.byte	0x48
+	.byte	0xd
+	.long	0xbf
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1226
+	.byte	0x5
+	.byte	0x49
+	.byte	0xd
+	.long	0xbf
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1227
+	.byte	0x5
+	.byte	0x4a
+	.byte	0xd
+	.long	0xbf
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0x5
+	.byte	0x4b
+	.byte	0xd
+	.long	0xbf
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0x5
+	.byte	0x4e
+	.byte	0x9
+	.long	0x11b
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x5
+	.byte	0x4f
+	.byte	0x9
+	.long	0x11b
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x5
+	.byte	0x50
+	.byte	0xc
+	.long	0xb3
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1232
+	.byte	0x5
+	.byte	0x51
+	.byte	0xc
+	.long	0xb3
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1233
+	.byte	0x5
+	.byte	0x52
+	.byte	0x16
+	.long	0x14d
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1234
+	.byte	0x5
+	.byte	0x53
+	.byte	0xe
+	.long	0xd0
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x187
+	.uleb128 0x5
+	.long	.LASF1235
+	.byte	0x5
+	.byte	0x54
+	.byte	0x3
+	.long	0x290
+	.uleb128 0x6
+	.long	0x33e
+	.uleb128 0x7
+	.long	0x70
+	.long	0x35e
+	.uleb128 0x2
+	.long	0x35e
+	.byte	0
+	.uleb128 0x3
+	.long	0x33e
+	.uleb128 0x3
+	.long	0x34f
+	.uleb128 0x7
+	.long	0x70
+	.long	0x377
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x34a
+	.uleb128 0x3
+	.long	0x368
+	.uleb128 0x7
+	.long	0x70
+	.long	0x3a4
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x2
+	.long	0x14d
+	.byte	0
+	.uleb128 0x3
+	.long	0x381
+	.uleb128 0x7
+	.long	0x70
+	.long	0x3cc
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xd0
+	.uleb128 0x2
+	.long	0x14d
+	.byte	0
+	.uleb128 0x3
+	.long	0x3a9
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x3f4
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0x3f4
+	.uleb128 0x2
+	.long	0x3f9
+	.byte	0
+	.uleb128 0x3
+	.long	0xd0
+	.uleb128 0x3
+	.long	0x14d
+	.uleb128 0x3
+	.long	0x3d1
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x412
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x403
+	.uleb128 0xe
+	.long	0x422
+	.uleb128 0x2
+	.long	0x35e
+	.byte	0
+	.uleb128 0x3
+	.long	0x417
+	.uleb128 0x7
+	.long	0xdc
+	.long	0x436
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x427
+	.uleb128 0x7
+	.long	0x14d
+	.long	0x44a
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x43b
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x463
+	.uleb128 0x2
+	.long	0x463
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x16a
+	.uleb128 0x3
+	.long	0x44f
+	.uleb128 0x7
+	.long	0x70
+	.long	0x486
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0xd0
+	.uleb128 0x2
+	.long	0x486
+	.byte	0
+	.uleb128 0x3
+	.long	0x111
+	.uleb128 0x3
+	.long	0x46d
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x49f
+	.uleb128 0x2
+	.long	0x35e
+	.byte	0
+	.uleb128 0x3
+	.long	0x490
+	.uleb128 0xe
+	.long	0x4b4
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0x141
+	.byte	0
+	.uleb128 0x3
+	.long	0x4a4
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x4cd
+	.uleb128 0x2
+	.long	0x377
+	.byte	0
+	.uleb128 0x3
+	.long	0x159
+	.uleb128 0x3
+	.long	0x4b9
+	.uleb128 0x5
+	.long	.LASF1236
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0xe8
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x1
+	.long	0x568
+	.uleb128 0x4
+	.long	.LASF1237
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1238
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1239
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1240
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1241
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1243
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF1244
+	.byte	0x7
+	.uleb128 0x4
+	.long	.LASF1245
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1246
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF1247
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF1248
+	.byte	0xb
+	.uleb128 0x4
+	.long	.LASF1249
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1250
+	.byte	0xd
+	.uleb128 0x4
+	.long	.LASF1251
+	.byte	0xe
+	.uleb128 0x4
+	.long	.LASF1252
+	.byte	0xf
+	.uleb128 0x4
+	.long	.LASF1253
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1254
+	.byte	0x11
+	.uleb128 0x4
+	.long	.LASF1255
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF1256
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1257
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x579
+	.uleb128 0x6
+	.long	0x568
+	.uleb128 0x3
+	.long	0x57e
+	.uleb128 0x7
+	.long	0x83
+	.long	0x592
+	.uleb128 0x2
+	.long	0x35e
+	.uleb128 0x2
+	.long	0x592
+	.byte	0
+	.uleb128 0x3
+	.long	0x59c
+	.uleb128 0x6
+	.long	0x592
+	.uleb128 0x1c
+	.uleb128 0x5
+	.long	.LASF1258
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x12
+	.long	0x5ae
+	.uleb128 0x6
+	.long	0x59d
+	.uleb128 0x3
+	.long	0x5b3
+	.uleb128 0x1d
+	.long	0x98
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x7
+	.byte	0x40
+	.byte	0x5
+	.long	0x5e3
+	.uleb128 0x13
+	.long	.LASF1259
+	.byte	0x42
+	.byte	0x1f
+	.long	0x574
+	.uleb128 0x13
+	.long	.LASF1260
+	.byte	0x43
+	.byte	0x21
+	.long	0x5a9
+	.uleb128 0x13
+	.long	.LASF1261
+	.byte	0x44
+	.byte	0xd
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.byte	0x1a
+	.byte	0x3d
+	.long	0x625
+	.uleb128 0x1
+	.long	.LASF1262
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x18
+	.long	0xae
+	.byte	0
+	.uleb128 0x1f
+	.long	0x5b8
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1263
+	.byte	0x7
+	.byte	0x46
+	.byte	0x18
+	.long	0x597
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1264
+	.byte	0x7
+	.byte	0x47
+	.byte	0x13
+	.long	0xcb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1265
+	.byte	0x7
+	.byte	0x48
+	.byte	0xd
+	.long	0xbf
+	.byte	0x19
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1266
+	.byte	0x7
+	.byte	0x49
+	.byte	0x1b
+	.long	0x5e3
+	.uleb128 0x6
+	.long	0x625
+	.uleb128 0x5
+	.long	.LASF1267
+	.byte	0x7
+	.byte	0x78
+	.byte	0x10
+	.long	0x647
+	.uleb128 0x6
+	.long	0x636
+	.uleb128 0x3
+	.long	0x64c
+	.uleb128 0x7
+	.long	0x83
+	.long	0x65b
+	.uleb128 0x2
+	.long	0x65b
+	.byte	0
+	.uleb128 0x3
+	.long	0x631
+	.uleb128 0x5
+	.long	.LASF1268
+	.byte	0x7
+	.byte	0x84
+	.byte	0x10
+	.long	0x647
+	.uleb128 0x6
+	.long	0x660
+	.uleb128 0x14
+	.byte	0x20
+	.byte	0x86
+	.long	0x6ad
+	.uleb128 0x1
+	.long	.LASF1269
+	.byte	0x7
+	.byte	0x8d
+	.byte	0x1a
+	.long	0x642
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1270
+	.byte	0x7
+	.byte	0x8e
+	.byte	0x1c
+	.long	0x66c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1271
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x1a
+	.long	0x642
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1272
+	.byte	0x7
+	.byte	0x90
+	.byte	0x16
+	.long	0x65b
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1273
+	.byte	0x7
+	.byte	0x91
+	.byte	0x3
+	.long	0x671
+	.uleb128 0x6
+	.long	0x6ad
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0xc6
+	.long	0x6eb
+	.uleb128 0x17
+	.string	"val"
+	.byte	0xc8
+	.byte	0xe
+	.long	0x100
+	.byte	0
+	.uleb128 0x17
+	.string	"max"
+	.byte	0xc9
+	.byte	0xd
+	.long	0xbf
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1274
+	.byte	0x7
+	.byte	0xca
+	.byte	0x19
+	.long	0x6eb
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1275
+	.byte	0x7
+	.byte	0xcb
+	.byte	0x3
+	.long	0x6be
+	.uleb128 0x6
+	.long	0x6f0
+	.uleb128 0xf
+	.long	.LASF1323
+	.byte	0xa
+	.byte	0x14
+	.byte	0x17
+	.long	0x6b9
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x8
+	.byte	0x37
+	.byte	0xe
+	.long	0x73e
+	.uleb128 0x4
+	.long	.LASF1276
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1277
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1278
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1279
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1281
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1282
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x3
+	.long	0x70d
+	.uleb128 0xb
+	.long	.LASF1283
+	.byte	0x20
+	.byte	0x8
+	.byte	0x43
+	.long	0x7a5
+	.uleb128 0x1
+	.long	.LASF1284
+	.byte	0x8
+	.byte	0x44
+	.byte	0xd
+	.long	0xbf
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1285
+	.byte	0x8
+	.byte	0x45
+	.byte	0xd
+	.long	0xbf
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1286
+	.byte	0x8
+	.byte	0x46
+	.byte	0xd
+	.long	0xbf
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1287
+	.byte	0x8
+	.byte	0x47
+	.byte	0xc
+	.long	0x7a5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1288
+	.byte	0x8
+	.byte	0x48
+	.byte	0xc
+	.long	0x7a5
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1289
+	.byte	0x8
+	.byte	0x49
+	.byte	0xc
+	.long	0x7a5
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF1290
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x3
+	.long	0x74a
+	.uleb128 0xb
+	.long	.LASF1291
+	.byte	0x30
+	.byte	0x8
+	.byte	0x4c
+	.long	0x838
+	.uleb128 0x1
+	.long	.LASF1292
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1293
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x9
+	.long	0x70
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1294
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x9
+	.long	0x70
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1295
+	.byte	0x8
+	.byte	0x50
+	.byte	0x9
+	.long	0x70
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0x8
+	.byte	0x51
+	.byte	0x9
+	.long	0x70
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0x8
+	.byte	0x52
+	.byte	0xa
+	.long	0x9d
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1298
+	.byte	0x8
+	.byte	0x53
+	.byte	0x12
+	.long	0xa9
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1299
+	.byte	0x8
+	.byte	0x54
+	.byte	0x12
+	.long	0xa9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1300
+	.byte	0x8
+	.byte	0x55
+	.byte	0xa
+	.long	0x9d
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1301
+	.byte	0x8
+	.byte	0x56
+	.byte	0x3
+	.long	0x7b6
+	.uleb128 0xb
+	.long	.LASF1302
+	.byte	0x30
+	.byte	0x8
+	.byte	0x58
+	.long	0x89f
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x8
+	.byte	0x59
+	.byte	0x26
+	.long	0x952
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1303
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x7aa
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1292
+	.byte	0x8
+	.byte	0x5d
+	.byte	0xd
+	.long	0xbf
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1293
+	.byte	0x8
+	.byte	0x5e
+	.byte	0xd
+	.long	0xbf
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1295
+	.byte	0x8
+	.byte	0x5f
+	.byte	0xd
+	.long	0xbf
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1304
+	.byte	0x8
+	.byte	0x60
+	.byte	0xd
+	.long	0xbf
+	.byte	0x2b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1305
+	.byte	0x60
+	.byte	0x8
+	.byte	0x67
+	.long	0x948
+	.uleb128 0x1
+	.long	.LASF1306
+	.byte	0x8
+	.byte	0x68
+	.byte	0xc
+	.long	0x97d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1307
+	.byte	0x8
+	.byte	0x69
+	.byte	0x14
+	.long	0x996
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xb
+	.long	0x9aa
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1308
+	.byte	0x8
+	.byte	0x6c
+	.byte	0xc
+	.long	0x9c4
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1309
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xc
+	.long	0x9d9
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1310
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xc
+	.long	0x9d9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1311
+	.byte	0x8
+	.byte	0x70
+	.byte	0xb
+	.long	0x9f7
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1312
+	.byte	0x8
+	.byte	0x71
+	.byte	0xb
+	.long	0xa10
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1313
+	.byte	0x8
+	.byte	0x72
+	.byte	0xb
+	.long	0xa10
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1314
+	.byte	0x8
+	.byte	0x73
+	.byte	0xb
+	.long	0xa29
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1315
+	.byte	0x8
+	.byte	0x75
+	.byte	0xb
+	.long	0xa47
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0x8
+	.byte	0x76
+	.byte	0xb
+	.long	0xa65
+	.byte	0x58
+	.byte	0
+	.uleb128 0x6
+	.long	0x89f
+	.uleb128 0x3
+	.long	0x948
+	.uleb128 0x6
+	.long	0x94d
+	.uleb128 0x5
+	.long	.LASF1317
+	.byte	0x8
+	.byte	0x61
+	.byte	0x3
+	.long	0x844
+	.uleb128 0x6
+	.long	0x957
+	.uleb128 0xe
+	.long	0x978
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0x4d7
+	.byte	0
+	.uleb128 0x3
+	.long	0x957
+	.uleb128 0x3
+	.long	0x968
+	.uleb128 0x7
+	.long	0x73e
+	.long	0x991
+	.uleb128 0x2
+	.long	0x991
+	.byte	0
+	.uleb128 0x3
+	.long	0x963
+	.uleb128 0x3
+	.long	0x982
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x9aa
+	.uleb128 0x2
+	.long	0x991
+	.byte	0
+	.uleb128 0x3
+	.long	0x99b
+	.uleb128 0xe
+	.long	0x9c4
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x3
+	.long	0x9af
+	.uleb128 0xe
+	.long	0x9d9
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x3
+	.long	0x9c9
+	.uleb128 0x7
+	.long	0x11b
+	.long	0x9f7
+	.uleb128 0x2
+	.long	0x991
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0x3
+	.long	0x9de
+	.uleb128 0x7
+	.long	0x11b
+	.long	0xa10
+	.uleb128 0x2
+	.long	0x991
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0x3
+	.long	0x9fc
+	.uleb128 0x7
+	.long	0x11b
+	.long	0xa29
+	.uleb128 0x2
+	.long	0x991
+	.uleb128 0x2
+	.long	0x3f4
+	.byte	0
+	.uleb128 0x3
+	.long	0xa15
+	.uleb128 0x7
+	.long	0x11b
+	.long	0xa47
+	.uleb128 0x2
+	.long	0x991
+	.uleb128 0x2
+	.long	0x100
+	.uleb128 0x2
+	.long	0x3f4
+	.byte	0
+	.uleb128 0x3
+	.long	0xa2e
+	.uleb128 0x7
+	.long	0x11b
+	.long	0xa60
+	.uleb128 0x2
+	.long	0x991
+	.uleb128 0x2
+	.long	0xa60
+	.byte	0
+	.uleb128 0x3
+	.long	0x838
+	.uleb128 0x3
+	.long	0xa4c
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x9
+	.byte	0x16
+	.byte	0xe
+	.long	0xa95
+	.uleb128 0x4
+	.long	.LASF1318
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1319
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1320
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1321
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1322
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0xae
+	.long	0xaa0
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0xa95
+	.uleb128 0xf
+	.long	.LASF1324
+	.byte	0xb
+	.byte	0x6
+	.byte	0x1b
+	.long	0xaa0
+	.uleb128 0xf
+	.long	.LASF1325
+	.byte	0xb
+	.byte	0x7
+	.byte	0x1b
+	.long	0xaa0
+	.uleb128 0xf
+	.long	.LASF1326
+	.byte	0xb
+	.byte	0x8
+	.byte	0x1b
+	.long	0xaa0
+	.uleb128 0xb
+	.long	.LASF1327
+	.byte	0xa
+	.byte	0xc
+	.byte	0x25
+	.long	0xb24
+	.uleb128 0x1
+	.long	.LASF1292
+	.byte	0xc
+	.byte	0x26
+	.byte	0xd
+	.long	0xbf
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1293
+	.byte	0xc
+	.byte	0x27
+	.byte	0xd
+	.long	0xbf
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1328
+	.byte	0xc
+	.byte	0x28
+	.byte	0xd
+	.long	0xbf
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1329
+	.byte	0xc
+	.byte	0x29
+	.byte	0xe
+	.long	0xd0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1330
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xd
+	.long	0xbf
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1331
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.long	0xd0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1332
+	.byte	0xc
+	.byte	0x2c
+	.byte	0x3
+	.long	0xac9
+	.uleb128 0x6
+	.long	0xb24
+	.uleb128 0xf
+	.long	.LASF1333
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x1c
+	.long	0xb24
+	.uleb128 0x8
+	.long	.LASF1334
+	.byte	0x2d
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x8
+	.long	.LASF1335
+	.byte	0x2e
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x8
+	.long	.LASF1336
+	.byte	0x2f
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x8
+	.long	.LASF1337
+	.byte	0x30
+	.byte	0x10
+	.long	0xbf
+	.uleb128 0x11
+	.long	0xae
+	.long	0xb7d
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0xb6d
+	.uleb128 0x8
+	.long	.LASF1338
+	.byte	0x32
+	.byte	0x1b
+	.long	0xb7d
+	.uleb128 0x8
+	.long	.LASF1339
+	.byte	0x37
+	.byte	0x12
+	.long	0x6f0
+	.uleb128 0x8
+	.long	.LASF1340
+	.byte	0x38
+	.byte	0x12
+	.long	0x6f0
+	.uleb128 0x8
+	.long	.LASF1341
+	.byte	0x39
+	.byte	0x12
+	.long	0x6f0
+	.uleb128 0x8
+	.long	.LASF1342
+	.byte	0x3a
+	.byte	0x18
+	.long	0x6fc
+	.uleb128 0x11
+	.long	0x631
+	.long	0xbc9
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0xbb9
+	.uleb128 0x8
+	.long	.LASF1343
+	.byte	0xd9
+	.byte	0x18
+	.long	0xbc9
+	.uleb128 0x8
+	.long	.LASF1344
+	.byte	0xe1
+	.byte	0x17
+	.long	0x6b9
+	.uleb128 0x11
+	.long	0x631
+	.long	0xbf4
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0xbe4
+	.uleb128 0x8
+	.long	.LASF1345
+	.byte	0xec
+	.byte	0x18
+	.long	0xbf4
+	.uleb128 0x21
+	.long	0x701
+	.byte	0xd
+	.byte	0xf9
+	.byte	0x10
+	.uleb128 0xd
+	.long	.LASF1346
+	.byte	0x8
+	.byte	0x8b
+	.byte	0x5
+	.long	0x11b
+	.long	0xc27
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0x100
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1347
+	.byte	0x8
+	.byte	0x8d
+	.byte	0x5
+	.long	0x11b
+	.long	0xc42
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xc42
+	.byte	0
+	.uleb128 0x3
+	.long	0x7aa
+	.uleb128 0xd
+	.long	.LASF1348
+	.byte	0xe
+	.byte	0x71
+	.byte	0x5
+	.long	0x70
+	.long	0xc63
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0xa9
+	.uleb128 0x22
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1349
+	.byte	0x8
+	.byte	0x85
+	.byte	0x5
+	.long	0x11b
+	.long	0xc79
+	.uleb128 0x2
+	.long	0x978
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1350
+	.byte	0x8
+	.byte	0x8f
+	.byte	0x5
+	.long	0x11b
+	.long	0xc94
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xa60
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1351
+	.byte	0xf
+	.byte	0x8d
+	.byte	0xe
+	.long	0x98
+	.long	0xcaf
+	.uleb128 0x2
+	.long	0x98
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1352
+	.byte	0xf
+	.value	0x197
+	.byte	0xf
+	.long	0xf4
+	.long	0xcc6
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1374
+	.byte	0x10
+	.byte	0x77
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1353
+	.byte	0x88
+	.long	0xce3
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1354
+	.byte	0x87
+	.long	0xcf8
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1355
+	.byte	0x86
+	.long	0xd12
+	.uleb128 0x2
+	.long	0x978
+	.uleb128 0x2
+	.long	0xbf
+	.uleb128 0x2
+	.long	0xbf
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1375
+	.byte	0x8
+	.byte	0x80
+	.byte	0xe
+	.long	0x978
+	.uleb128 0xc
+	.long	.LASF1360
+	.byte	0xae
+	.byte	0xc
+	.long	0x11b
+	.long	0xd66
+	.uleb128 0x26
+	.string	"buf"
+	.byte	0xd
+	.byte	0xae
+	.byte	0x2b
+	.long	0x98
+	.uleb128 0x9
+	.long	.LASF1356
+	.byte	0xae
+	.byte	0x39
+	.long	0x30
+	.uleb128 0x8
+	.long	.LASF1357
+	.byte	0xb0
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x8
+	.long	.LASF1358
+	.byte	0xba
+	.byte	0x13
+	.long	0x978
+	.uleb128 0x8
+	.long	.LASF1359
+	.byte	0xbb
+	.byte	0x18
+	.long	0x838
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1361
+	.byte	0x9c
+	.byte	0xd
+	.long	0x83
+	.long	0xd8c
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0x9c
+	.byte	0x2d
+	.long	0x35e
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x9c
+	.byte	0x40
+	.long	0x592
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1364
+	.byte	0x95
+	.byte	0xd
+	.long	0x83
+	.long	0xda7
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x95
+	.byte	0x2e
+	.long	0x65b
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1376
+	.byte	0xd
+	.byte	0x6c
+	.byte	0xd
+	.long	0xdd7
+	.uleb128 0x8
+	.long	.LASF1358
+	.byte	0x6e
+	.byte	0x13
+	.long	0x978
+	.uleb128 0x8
+	.long	.LASF1365
+	.byte	0x6f
+	.byte	0x1b
+	.long	0x7aa
+	.uleb128 0x28
+	.uleb128 0x8
+	.long	.LASF1366
+	.byte	0x8c
+	.byte	0x11
+	.long	0xbf
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1367
+	.byte	0x61
+	.byte	0xd
+	.long	0x83
+	.long	0xdfd
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0x61
+	.byte	0x30
+	.long	0x35e
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x61
+	.byte	0x43
+	.long	0x592
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1368
+	.byte	0x56
+	.byte	0xd
+	.long	0x83
+	.long	0xe23
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0x56
+	.byte	0x2f
+	.long	0x35e
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x56
+	.byte	0x42
+	.long	0x592
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1369
+	.byte	0x4b
+	.byte	0xd
+	.long	0x83
+	.long	0xe49
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0x4b
+	.byte	0x2f
+	.long	0x35e
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x4b
+	.byte	0x42
+	.long	0x592
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1370
+	.byte	0x3c
+	.byte	0xd
+	.long	0x83
+	.long	0xe6f
+	.uleb128 0x9
+	.long	.LASF1362
+	.byte	0x3c
+	.byte	0x32
+	.long	0x35e
+	.uleb128 0x9
+	.long	.LASF1363
+	.byte	0x3c
+	.byte	0x45
+	.long	0x592
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1371
+	.byte	0xf3
+	.long	0xe79
+	.uleb128 0x3
+	.long	0xb24
+	.uleb128 0x18
+	.long	.LASF1372
+	.byte	0x92
+	.long	0xe88
+	.uleb128 0x3
+	.long	0xb30
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 46
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF447
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF520
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF538
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF547
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF447
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF607
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF640
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF641
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x22
+	.file 35 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF701
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF702
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF765
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.file 40 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 41 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/build/version.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF999
+	.file 45 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 47 "./src/main/cms/cms.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x5
+	.file 48 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x30
+	.file 49 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 50 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1165
+	.byte	0x4
+	.file 51 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1166
+	.byte	0x4
+	.file 52 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF430
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF446
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF458
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF517
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF613
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF680
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF685
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF687
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF689
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF691
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF693
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF695
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF700
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF764
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1040
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1162
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1164
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1169
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1377
+	.long	.LASF1378
+	.long	.LASF1379
+	.long	.LASF1380
+	.long	.LASF1381
+	.long	.LASF1382
+	.long	.LASF1383
+	.long	.LASF1384
+	.long	.LASF1385
+	.long	.LASF1386
+	.long	.LASF1387
+	.long	.LASF1388
+	.long	.LASF1389
+	.long	.LASF1390
+	.long	.LASF1391
+	.long	.LASF1392
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x35
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1393
+	.byte	0xc
+	.long	.LASF1394
+	.byte	0xc
+	.long	.LASF1395
+	.byte	0xc
+	.long	.LASF1396
+	.byte	0x10
+	.long	.LASF1397
+	.byte	0x5
+	.long	.LASF1398
+	.byte	0x3
+	.long	.LASF1399
+	.byte	0x2
+	.long	.LASF1400
+	.byte	0x5
+	.long	.LASF1401
+	.byte	0x5
+	.long	.LASF1402
+	.byte	0x2
+	.long	.LASF1403
+	.byte	0x7
+	.long	.LASF1404
+	.byte	0x7
+	.long	.LASF1405
+	.byte	0x2
+	.long	.LASF1406
+	.byte	0x3
+	.long	.LASF1407
+	.byte	0xf
+	.long	.LASF1408
+	.byte	0x6
+	.long	.LASF1409
+	.byte	0xf
+	.long	.LASF1410
+	.byte	0xf
+	.long	.LASF1411
+	.byte	0xf
+	.long	.LASF1412
+	.byte	0xf
+	.long	.LASF1413
+	.byte	0xc
+	.long	.LASF1414
+	.byte	0xc
+	.long	.LASF1415
+	.byte	0xe
+	.long	.LASF1416
+	.byte	0xc
+	.long	.LASF1417
+	.byte	0xd
+	.long	.LASF1418
+	.byte	0xd
+	.long	.LASF1419
+	.byte	0xc
+	.long	.LASF1420
+	.byte	0xc
+	.long	.LASF1421
+	.byte	0xc
+	.long	.LASF1422
+	.byte	0xc
+	.long	.LASF1423
+	.byte	0xb
+	.long	.LASF1424
+	.byte	0xb
+	.long	.LASF1425
+	.byte	0x10
+	.long	.LASF1426
+	.byte	0x10
+	.long	.LASF1426
+	.byte	0xf
+	.long	.LASF1427
+	.byte	0xc
+	.long	.LASF1428
+	.byte	0xc
+	.long	.LASF1429
+	.byte	0xf
+	.long	.LASF1430
+	.byte	0xa
+	.long	.LASF1431
+	.byte	0x9
+	.long	.LASF1432
+	.byte	0x8
+	.long	.LASF1433
+	.byte	0x9
+	.long	.LASF1434
+	.byte	0x9
+	.long	.LASF1435
+	.byte	0x1
+	.long	.LASF1436
+	.byte	0x10
+	.long	.LASF1437
+	.byte	0x3
+	.long	.LASF1438
+	.byte	0x2
+	.long	.LASF1439
+	.byte	0x4
+	.long	.LASF1440
+	.byte	0x1
+	.long	.LASF1441
+	.byte	0x5
+	.long	.LASF1442
+	.byte	0x5
+	.long	.LASF1443
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1143:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF710:
+	.string	"INT32_MAX (2147483647)"
+.LASF627:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1056:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF562:
+	.string	"__STD_TYPE typedef"
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF1198:
+	.string	"displayCanvas_s"
+.LASF1196:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1284:
+	.string	"bandCount"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1188:
+	.string	"size_t"
+.LASF1350:
+	.string	"vtxCommonGetOsdInfo"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1021:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1372:
+	.string	"vtxSettingsConfig"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1278:
+	.string	"VTXDEV_SMARTAUDIO"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1222:
+	.string	"displayPort_s"
+.LASF1235:
+	.string	"displayPort_t"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF806:
+	.string	"USE_GPS "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF409:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1289:
+	.string	"powerNames"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF507:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF644:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1002:
+	.string	"__need___va_list"
+.LASF421:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1072:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF482:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF595:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF669:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1157:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF756:
+	.string	"INT16_C(c) c"
+.LASF374:
+	.string	"__unix 1"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF453:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1066:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1226:
+	.string	"cols"
+.LASF1062:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF643:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1275:
+	.string	"OSD_TAB_t"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1239:
+	.string	"OME_Back"
+.LASF1106:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF645:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF814:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF675:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1069:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1091:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1195:
+	.string	"textAttributes_t"
+.LASF1083:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1149:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF1044:
+	.string	"UNIT_TESTED "
+.LASF1299:
+	.string	"channelName"
+.LASF496:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1048:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF607:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1240:
+	.string	"OME_OSD_Exit"
+.LASF735:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1160:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF469:
+	.string	"__P(args) args"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF663:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF770:
+	.string	"__SIZE_T__ "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1034:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1229:
+	.string	"useFullscreen"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF575:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF399:
+	.string	"__USE_POSIX"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1269:
+	.string	"onEnter"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1347:
+	.string	"vtxCommonGetDeviceCapability"
+.LASF994:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1257:
+	.string	"CMSEntryFuncPtr"
+.LASF959:
+	.string	"USE_VCP"
+.LASF1264:
+	.string	"type"
+.LASF1084:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF739:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF656:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1146:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF760:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF704:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF631:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF559:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF457:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF567:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF609:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF657:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF484:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF774:
+	.string	"_T_SIZE "
+.LASF1281:
+	.string	"VTXDEV_UNKNOWN"
+.LASF1030:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1114:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF1118:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF1368:
+	.string	"cms_Vtx_configChan"
+.LASF713:
+	.string	"UINT16_MAX (65535)"
+.LASF1356:
+	.string	"bufsize"
+.LASF734:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1004:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF726:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF730:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1316:
+	.string	"getOsdInfo"
+.LASF618:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF412:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF641:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF1077:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1353:
+	.string	"vtxCommonSetPitMode"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1217:
+	.string	"isReady"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF479:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1254:
+	.string	"OME_BACK_AND_END"
+.LASF1200:
+	.string	"displayFontMetadata_s"
+.LASF1199:
+	.string	"displayFontMetadata_t"
+.LASF751:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF541:
+	.string	"__stub_fchflags "
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF584:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF635:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF647:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1376:
+	.string	"cms_Vtx_initSettings"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF423:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF403:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF408:
+	.string	"__USE_XOPEN2K8"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__always_inline"
+.LASF772:
+	.string	"_SYS_SIZE_T_H "
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF632:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1197:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF419:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF706:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1053:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF455:
+	.string	"__GLIBC__ 2"
+.LASF1013:
+	.string	"__va_list__ "
+.LASF1373:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1180:
+	.string	"long int"
+.LASF447:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF696:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF424:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF441:
+	.string	"__USE_XOPEN2K8 1"
+.LASF590:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF660:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF990:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF769:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1279:
+	.string	"VTXDEV_TRAMP"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1315:
+	.string	"getPower"
+.LASF661:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF604:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1360:
+	.string	"cms_Vtx_drawStatusString"
+.LASF611:
+	.string	"__PDP_ENDIAN 3412"
+.LASF589:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1109:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF741:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1171:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF503:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF504:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF487:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF471:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF853:
+	.string	"USE_STATS "
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF670:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1207:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1068:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF465:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF492:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF748:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF523:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1246:
+	.string	"OME_UINT8"
+.LASF1305:
+	.string	"vtxVTable_s"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF682:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1131:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF1051:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1241:
+	.string	"OME_Submenu"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF485:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1314:
+	.string	"getFrequency"
+.LASF586:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1122:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF452:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF462:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1059:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1319:
+	.string	"ADC_RSSI"
+.LASF466:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1342:
+	.string	"cms_Vtx_EntPitMode"
+.LASF1174:
+	.string	"signed char"
+.LASF1050:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1184:
+	.string	"uint8_t"
+.LASF580:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF549:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF473:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1336:
+	.string	"vtxPower"
+.LASF620:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF564:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF520:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF653:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1112:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF463:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF1310:
+	.string	"setPitMode"
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1309:
+	.string	"setPowerByIndex"
+.LASF1311:
+	.string	"getBandAndChannel"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1105:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF582:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1287:
+	.string	"bandNames"
+.LASF628:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1170:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF429:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF470:
+	.string	"__PMT(args) args"
+.LASF1107:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1245:
+	.string	"OME_INT8"
+.LASF636:
+	.string	"isascii(c) __isascii (c)"
+.LASF1134:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF616:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF995:
+	.string	"MW_VERSION 231"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF1211:
+	.string	"heartbeat"
+.LASF1312:
+	.string	"getPowerIndex"
+.LASF547:
+	.string	"_BITS_TYPES_H 1"
+.LASF1039:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF640:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF981:
+	.string	"NOINLINE "
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1078:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1244:
+	.string	"OME_BoolFunc"
+.LASF1295:
+	.string	"powerIndex"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1220:
+	.string	"getCanvas"
+.LASF1127:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF705:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1065:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1190:
+	.string	"_Bool"
+.LASF1255:
+	.string	"OME_MENU"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF514:
+	.string	"__restrict_arr __restrict"
+.LASF1258:
+	.string	"CMSMenuOptFuncPtr"
+.LASF778:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF788:
+	.string	"NULL"
+.LASF1108:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF1243:
+	.string	"OME_Bool"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF591:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1334:
+	.string	"vtxBand"
+.LASF416:
+	.string	"__USE_GNU"
+.LASF451:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF721:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1288:
+	.string	"channelNames"
+.LASF493:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF719:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1251:
+	.string	"OME_Setting"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF687:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF767:
+	.string	"__need_size_t "
+.LASF1232:
+	.string	"grabCount"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF552:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF526:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1330:
+	.string	"lowPowerDisarm"
+.LASF445:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF511:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF431:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF765:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1178:
+	.string	"__uint16_t"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF406:
+	.string	"__USE_XOPEN2K"
+.LASF761:
+	.string	"UINT32_C(c) c ## U"
+.LASF1093:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF606:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF637:
+	.string	"toascii(c) __toascii (c)"
+.LASF407:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1123:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1253:
+	.string	"OME_END"
+.LASF1144:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1202:
+	.string	"grab"
+.LASF509:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF692:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF771:
+	.string	"_SIZE_T "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1116:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF1225:
+	.string	"rows"
+.LASF1035:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF732:
+	.string	"INT_FAST8_MAX (127)"
+.LASF720:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF642:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1265:
+	.string	"flags"
+.LASF1012:
+	.string	"_VA_LIST_T_H "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1130:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF712:
+	.string	"UINT8_MAX (255)"
+.LASF1100:
+	.string	"OPTSTRING (1 << 3)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1193:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF740:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF401:
+	.string	"__USE_POSIX199309"
+.LASF711:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF655:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1054:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1103:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF750:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1132:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF1237:
+	.string	"OME_Label"
+.LASF1282:
+	.string	"vtxDevType_e"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF456:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF405:
+	.string	"__USE_UNIX98"
+.LASF623:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1191:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF1055:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF430:
+	.string	"__USE_ISOC95 1"
+.LASF1304:
+	.string	"pitMode"
+.LASF1262:
+	.string	"text"
+.LASF605:
+	.string	"_BITS_TIME64_H 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF568:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1276:
+	.string	"VTXDEV_UNSUPPORTED"
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1268:
+	.string	"CMSMenuOnExitPtr"
+.LASF553:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF787:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1365:
+	.string	"vtxDeviceCapability"
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF598:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF674:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF393:
+	.string	"_CTYPE_H 1"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1357:
+	.string	"defaultString"
+.LASF728:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1110:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF544:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF600:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF1234:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF695:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF677:
+	.string	"bool _Bool"
+.LASF1111:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF991:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1176:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1321:
+	.string	"ADC_AIRSPEED"
+.LASF601:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF737:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF688:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1117:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF491:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1247:
+	.string	"OME_UINT16"
+.LASF1047:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1020:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1031:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF738:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF579:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1085:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF996:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF731:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF548:
+	.string	"__S16_TYPE short int"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF689:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF789:
+	.string	"NULL ((void *)0)"
+.LASF1018:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF1326:
+	.string	"vtx58DefaultPowerNames"
+.LASF501:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF512:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1307:
+	.string	"getDeviceType"
+.LASF439:
+	.string	"__USE_POSIX199506 1"
+.LASF1089:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF1129:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF442:
+	.string	"_ATFILE_SOURCE"
+.LASF558:
+	.string	"__SLONG32_TYPE int"
+.LASF753:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1104:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1098:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF683:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF854:
+	.string	"USE_CMS "
+.LASF395:
+	.string	"__USE_ISOC11"
+.LASF446:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF498:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF700:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF702:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1286:
+	.string	"powerCount"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1181:
+	.string	"__uint64_t"
+.LASF1331:
+	.string	"maxPowerOverride"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF744:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF673:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF581:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1192:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF1355:
+	.string	"vtxCommonSetBandAndChannel"
+.LASF749:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF464:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF619:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF432:
+	.string	"_POSIX_SOURCE"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1363:
+	.string	"self"
+.LASF1351:
+	.string	"strcpy"
+.LASF530:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF543:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1057:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF773:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF988:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF1293:
+	.string	"channel"
+.LASF1026:
+	.string	"UNUSED(x) (void)(x)"
+.LASF483:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1208:
+	.string	"writeChar"
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1165:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF709:
+	.string	"INT16_MAX (32767)"
+.LASF1358:
+	.string	"vtxDevice"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1274:
+	.string	"names"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1291:
+	.string	"vtxDeviceOsdInfo_s"
+.LASF1301:
+	.string	"vtxDeviceOsdInfo_t"
+.LASF768:
+	.string	"__need_NULL "
+.LASF394:
+	.string	"_FEATURES_H 1"
+.LASF427:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF608:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF521:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF410:
+	.string	"__USE_LARGEFILE"
+.LASF639:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF495:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF648:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1261:
+	.string	"itemId"
+.LASF1036:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1306:
+	.string	"process"
+.LASF563:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1345:
+	.string	"cms_menuVtxEntries"
+.LASF1014:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF671:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF1000:
+	.string	"_STDARG_H "
+.LASF1121:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF630:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF698:
+	.string	"_BITS_WCHAR_H 1"
+.LASF599:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1126:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF502:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1060:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF414:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1308:
+	.string	"setBandAndChannel"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF701:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF654:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1168:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1341:
+	.string	"cms_Vtx_EntPower"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF612:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1292:
+	.string	"band"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1340:
+	.string	"cms_Vtx_EntChan"
+.LASF1329:
+	.string	"pitModeChan"
+.LASF400:
+	.string	"__USE_POSIX2"
+.LASF1019:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1071:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1298:
+	.string	"bandName"
+.LASF1256:
+	.string	"OME_MAX"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1332:
+	.string	"vtxSettingsConfig_t"
+.LASF1179:
+	.string	"__uint32_t"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF776:
+	.string	"_SIZE_T_ "
+.LASF1074:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1370:
+	.string	"cms_Vtx_configPitMode"
+.LASF1161:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1125:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF1119:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF537:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1150:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1267:
+	.string	"CMSMenuFuncPtr"
+.LASF1155:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1158:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1135:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF743:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1374:
+	.string	"saveConfigAndNotify"
+.LASF518:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF1343:
+	.string	"cms_menuCommenceEntries"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF775:
+	.string	"__SIZE_T "
+.LASF1075:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF468:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1218:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF517:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF459:
+	.string	"__PMT"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1297:
+	.string	"bandLetter"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1166:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF585:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF443:
+	.string	"_ATFILE_SOURCE 1"
+.LASF554:
+	.string	"__SQUAD_TYPE long int"
+.LASF1294:
+	.string	"frequency"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF1337:
+	.string	"vtxPitMode"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF417:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF534:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF676:
+	.string	"_STDBOOL_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1120:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1096:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF529:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1362:
+	.string	"pDisp"
+.LASF617:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1210:
+	.string	"isTransferInProgress"
+.LASF478:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1231:
+	.string	"cursorRow"
+.LASF997:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1172:
+	.string	"unsigned int"
+.LASF699:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1206:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF460:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1260:
+	.string	"menufunc"
+.LASF1011:
+	.string	"_VA_LIST_DEFINED "
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF413:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF497:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1076:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF440:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF592:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF551:
+	.string	"__U32_TYPE unsigned int"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF490:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1028:
+	.string	"BIT(x) (1 << (x))"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF742:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF494:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF516:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF542:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF664:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF588:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF716:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF565:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF505:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1070:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1088:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1290:
+	.string	"vtxDeviceCapability_t"
+.LASF1348:
+	.string	"tfp_sprintf"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF755:
+	.string	"INT8_C(c) c"
+.LASF1140:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF678:
+	.string	"true 1"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF557:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF603:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF454:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1338:
+	.string	"vtxCmsPitModeNames"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1136:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF1164:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF574:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1369:
+	.string	"cms_Vtx_configBand"
+.LASF1204:
+	.string	"clearScreen"
+.LASF522:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1354:
+	.string	"vtxCommonSetPowerByIndex"
+.LASF472:
+	.string	"__STRING(x) #x"
+.LASF629:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF1049:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1250:
+	.string	"OME_FLOAT"
+.LASF519:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1317:
+	.string	"vtxDevice_t"
+.LASF998:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1086:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF783:
+	.string	"___int_size_t_h "
+.LASF1003:
+	.string	"__GNUC_VA_LIST "
+.LASF438:
+	.string	"__USE_POSIX199309 1"
+.LASF1041:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1248:
+	.string	"OME_INT16"
+.LASF1325:
+	.string	"vtx58ChannelNames"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF808:
+	.string	"USE_NAV "
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF924:
+	.string	"USE_MAG "
+.LASF1182:
+	.string	"char"
+.LASF467:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF528:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1154:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF613:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1153:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF1328:
+	.string	"power"
+.LASF1099:
+	.string	"DYNAMIC (1 << 2)"
+.LASF1167:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1148:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF718:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1064:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF624:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF576:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1082:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1219:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1280:
+	.string	"VTXDEV_FFPV"
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1016:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF397:
+	.string	"__USE_ISOC95"
+.LASF1040:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF746:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF396:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1094:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF404:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1183:
+	.string	"int8_t"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF474:
+	.string	"__BEGIN_DECLS "
+.LASF1038:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF1302:
+	.string	"vtxDevice_s"
+.LASF1142:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF727:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1015:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1128:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1163:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF989:
+	.string	"FC_VERSION_MINOR 6"
+.LASF672:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1175:
+	.string	"__int8_t"
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1209:
+	.string	"readChar"
+.LASF703:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF583:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1224:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1008:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1346:
+	.string	"vtxCommonGetPitMode"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF1033:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1023:
+	.string	"EXPAND_I(x) x"
+.LASF398:
+	.string	"__USE_ISOCXX11"
+.LASF779:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1185:
+	.string	"uint16_t"
+.LASF561:
+	.string	"__U64_TYPE unsigned long int"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF666:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF724:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF999:
+	.string	"__TFP_PRINTF__ "
+.LASF1366:
+	.string	"onoff"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF435:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1313:
+	.string	"getPitMode"
+.LASF993:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1101:
+	.string	"READONLY (1 << 4)"
+.LASF420:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF402:
+	.string	"__USE_POSIX199506"
+.LASF610:
+	.string	"__BIG_ENDIAN 4321"
+.LASF757:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF762:
+	.string	"UINT64_C(c) c ## UL"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF1067:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1007:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF1375:
+	.string	"vtxCommonDevice"
+.LASF444:
+	.string	"__WORDSIZE 64"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF786:
+	.string	"__size_t "
+.LASF658:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF614:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1273:
+	.string	"CMS_Menu"
+.LASF546:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF782:
+	.string	"__DEFINED_size_t "
+.LASF736:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1151:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF1214:
+	.string	"supportedTextAttributes"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF480:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF560:
+	.string	"__S64_TYPE long int"
+.LASF533:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF646:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF777:
+	.string	"_BSD_SIZE_T_ "
+.LASF477:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF790:
+	.string	"__need_NULL"
+.LASF764:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1090:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF1073:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF925:
+	.string	"USE_BARO "
+.LASF550:
+	.string	"__S32_TYPE int"
+.LASF1147:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF714:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF650:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1079:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF545:
+	.string	"__stub_sigreturn "
+.LASF577:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF752:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF685:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF766:
+	.string	"_STRING_H 1"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1242:
+	.string	"OME_Funcall"
+.LASF662:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1335:
+	.string	"vtxChan"
+.LASF758:
+	.string	"INT64_C(c) c ## L"
+.LASF1138:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF449:
+	.string	"__USE_ATFILE 1"
+.LASF1349:
+	.string	"vtxCommonDeviceIsReady"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1102:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF693:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF1022:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1042:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1145:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF1025:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1367:
+	.string	"cms_Vtx_configPower"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF540:
+	.string	"__stub_chflags "
+.LASF1063:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF785:
+	.string	"_SIZET_ "
+.LASF594:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF694:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1087:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1364:
+	.string	"cms_Vtx_onEnter"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF1133:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF638:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF532:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1318:
+	.string	"ADC_BATTERY"
+.LASF587:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF992:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF527:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF510:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF415:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF625:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF500:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF958:
+	.string	"USE_ADC"
+.LASF1124:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF651:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1266:
+	.string	"OSD_Entry"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1323:
+	.string	"cmsx_menuVtxControl"
+.LASF475:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF668:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF681:
+	.string	"_STDINT_H 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF652:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1017:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1095:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1177:
+	.string	"short int"
+.LASF458:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1006:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1187:
+	.string	"uint64_t"
+.LASF425:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF513:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1259:
+	.string	"func"
+.LASF622:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1227:
+	.string	"posX"
+.LASF1228:
+	.string	"posY"
+.LASF708:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF488:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF686:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF1230:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1270:
+	.string	"onExit"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1045:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1327:
+	.string	"vtxSettingsConfig_s"
+.LASF1205:
+	.string	"drawScreen"
+.LASF1169:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1189:
+	.string	"osdCharacter_t"
+.LASF555:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF691:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF649:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1001:
+	.string	"_ANSI_STDARG_H_ "
+.LASF536:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF593:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF486:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1081:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1046:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF572:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1283:
+	.string	"vtxDeviceCapability_s"
+.LASF489:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF556:
+	.string	"__SWORD_TYPE long int"
+.LASF634:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1233:
+	.string	"cachedSupportedTextAttributes"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF569:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF436:
+	.string	"__USE_POSIX 1"
+.LASF1215:
+	.string	"getFontMetadata"
+.LASF745:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF659:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF535:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1238:
+	.string	"OME_LabelFunc"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1027:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1010:
+	.string	"_VA_LIST "
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1043:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF679:
+	.string	"false 0"
+.LASF1361:
+	.string	"cms_Vtx_Commence"
+.LASF1344:
+	.string	"cms_menuCommence"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF754:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1352:
+	.string	"strlen"
+.LASF626:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1156:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF1221:
+	.string	"displayPortVTable_s"
+.LASF1201:
+	.string	"displayPortVTable_t"
+.LASF508:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF759:
+	.string	"UINT8_C(c) c"
+.LASF1162:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF1005:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF1032:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF667:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF524:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF781:
+	.string	"_SIZE_T_DECLARED "
+.LASF1322:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF707:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1252:
+	.string	"OME_TAB"
+.LASF1300:
+	.string	"powerIndexLetter"
+.LASF1139:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF426:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF1216:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1113:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1061:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF539:
+	.string	"__stub___compat_bdflush "
+.LASF722:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1303:
+	.string	"capability"
+.LASF1296:
+	.string	"powerMilliwatt"
+.LASF1186:
+	.string	"uint32_t"
+.LASF428:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF566:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF717:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF729:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF476:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF615:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF433:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF437:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF578:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF531:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1203:
+	.string	"release"
+.LASF723:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF690:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1249:
+	.string	"OME_String"
+.LASF1333:
+	.string	"vtxSettingsConfig_System"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF570:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF571:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF665:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF461:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1324:
+	.string	"vtx58BandNames"
+.LASF1236:
+	.string	"timeUs_t"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF499:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF733:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1213:
+	.string	"txBytesFree"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1052:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF450:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1271:
+	.string	"onGlobalExit"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF697:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF621:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF448:
+	.string	"__USE_MISC 1"
+.LASF680:
+	.string	"__bool_true_false_are_defined 1"
+.LASF597:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1272:
+	.string	"entries"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF376:
+	.string	"unix 1"
+.LASF1320:
+	.string	"ADC_CURRENT"
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF525:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1371:
+	.string	"vtxSettingsConfigMutable"
+.LASF852:
+	.string	"USE_LOG "
+.LASF1285:
+	.string	"channelCount"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF481:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1115:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF538:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF1137:
+	.string	"CMS_EXIT (0)"
+.LASF1092:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1037:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF573:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1277:
+	.string	"VTXDEV_RTC6705"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF418:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1024:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF411:
+	.string	"__USE_LARGEFILE64"
+.LASF1223:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1058:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1359:
+	.string	"osdInfo"
+.LASF1194:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1212:
+	.string	"resync"
+.LASF1263:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF791:
+	.string	"_STRINGS_H 1"
+.LASF780:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF684:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1029:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1097:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF602:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF725:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF747:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF633:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF1009:
+	.string	"_VA_LIST_ "
+.LASF434:
+	.string	"_POSIX_C_SOURCE"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF596:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1159:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF1339:
+	.string	"cms_Vtx_EntBand"
+.LASF763:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1173:
+	.string	"long unsigned int"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF784:
+	.string	"_GCC_SIZE_T "
+.LASF515:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1152:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1080:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1141:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1441:
+	.string	"io_types.h"
+.LASF1416:
+	.string	"long-double.h"
+.LASF1424:
+	.string	"__locale_t.h"
+.LASF1430:
+	.string	"platform.h"
+.LASF1432:
+	.string	"target.h"
+.LASF1442:
+	.string	"rx_pwm.h"
+.LASF1427:
+	.string	"libc-header-start.h"
+.LASF1403:
+	.string	"vtx_string.h"
+.LASF1390:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1383:
+	.string	"src/main/io"
+.LASF1421:
+	.string	"endian.h"
+.LASF1379:
+	.string	"src/main/common"
+.LASF1394:
+	.string	"stdint-intn.h"
+.LASF1405:
+	.string	"cms_menu_vtx.c"
+.LASF1389:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1392:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1397:
+	.string	"display.h"
+.LASF1402:
+	.string	"cms_menu_vtx.h"
+.LASF1378:
+	.string	"src/main/cms"
+.LASF1384:
+	.string	"src/main/target/SITL"
+.LASF1414:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1415:
+	.string	"cdefs.h"
+.LASF1388:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1408:
+	.string	"config.h"
+.LASF1429:
+	.string	"strings.h"
+.LASF1412:
+	.string	"features-time64.h"
+.LASF1399:
+	.string	"cms_types.h"
+.LASF1393:
+	.string	"types.h"
+.LASF1438:
+	.string	"cms.h"
+.LASF1381:
+	.string	"src/main/drivers"
+.LASF1391:
+	.string	"/usr/include"
+.LASF1377:
+	.string	"src/main/build"
+.LASF1433:
+	.string	"sanity_check.h"
+.LASF1426:
+	.string	"stdint.h"
+.LASF1411:
+	.string	"features.h"
+.LASF1431:
+	.string	"common.h"
+.LASF1419:
+	.string	"typesizes.h"
+.LASF1406:
+	.string	"printf.h"
+.LASF1380:
+	.string	"src/main/config"
+.LASF1425:
+	.string	"stdbool.h"
+.LASF1420:
+	.string	"time64.h"
+.LASF1395:
+	.string	"stdint-uintn.h"
+.LASF1385:
+	.string	"src/main/target"
+.LASF1437:
+	.string	"utils.h"
+.LASF1436:
+	.string	"stdarg.h"
+.LASF1386:
+	.string	"src/main"
+.LASF1398:
+	.string	"time.h"
+.LASF1422:
+	.string	"endianness.h"
+.LASF1428:
+	.string	"wchar.h"
+.LASF1443:
+	.string	"stats.h"
+.LASF1400:
+	.string	"vtx_common.h"
+.LASF1417:
+	.string	"stubs.h"
+.LASF1407:
+	.string	"string.h"
+.LASF1387:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1423:
+	.string	"locale_t.h"
+.LASF1404:
+	.string	"vtx.h"
+.LASF1440:
+	.string	"build_config.h"
+.LASF1396:
+	.string	"stddef.h"
+.LASF1418:
+	.string	"stubs-64.h"
+.LASF1410:
+	.string	"ctype.h"
+.LASF1413:
+	.string	"wordsize.h"
+.LASF1435:
+	.string	"version.h"
+.LASF1382:
+	.string	"src/main/fc"
+.LASF1434:
+	.string	"common_post.h"
+.LASF1401:
+	.string	"adc.h"
+.LASF1439:
+	.string	"parameter_group.h"
+.LASF0:
+	.string	"./src/main/cms/cms_menu_vtx.c"
+.LASF1409:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\245\006"
+	.string	"\024\nw\001"
+	.string	"\026"
+	.string	"\233\374\316\303\n\004\002"
+	.string	"\001\352\263\360\321\b\002\003\004\005\006\376\365\310\200\n\006\007\b\274\212\347\324\013\024\001\001\n\222\204\203\254\001:\002"
+	.string	"\002\002\002"
+	.string	"\002\003\002\004\002\002\002\005\002\003\003"
+	.string	"\002\002\002\013\242\343\334\246\b\f\206\325\376\272\f\r\021\335\247\230\205\f"
+	.string	"\022\260\221\361\330\006\024\002\006\002\007\002\006\002\006\002\b\002\007\002\t\002\t\n\002\007\007\002\007\023\326\270\237\376\016"
+	.string	"\024\332\374\233\255\r\025\204\235\357\263\004\026\356\301\307\255\007\027\326\226\262\343\006\030\313\320\335\246\003\031\245\375\256\343\001"
+	.string	"\027"
+	.string	"\240f\027@p\316K\273\3408\350\341\205\002V\020,\225\335"
+	.ascii	"i\360n\246\313\240[ 3\302\035\260\001\220\201\353\200d@\0208"
+	.ascii	"\245\311aT\200!"
+	.text
+	.section	.gnu.lto_.ipa_sra.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 \312%\003"
+	.string	"\304\003\276"
+	.string	"\t"
+	.string	"\002"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\005\003\002\004\006"
+	.string	"\001"
+	.string	""
+	.string	"\b"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\021\001\003"
+	.string	"\001\022"
+	.string	"\003\003\001"
+	.string	""
+	.string	"\001\002\001\002\001\023"
+	.string	"\003\001\001\200\004"
+	.string	""
+	.string	"\n"
+	.string	"\020"
+	.ascii	"} \b\b\006\262\355\224,\346\345\035k\274\223\360PA\254\n*3\263"
+	.ascii	"\035\201H\355\007\266\200}\271\354\277\001,"
+	.text
+	.section	.gnu.lto_.inline.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`k\001\275\b"
+	.string	"2\f+1`M\222\016*H\f\2400@\324\250A\021=,R\024\021\210\205\3209\022b\367\370\266\251s[\222Z8C I\024\210\026\241f\233m\232\"{\357\024\317\332\275\242)\334\344\375t\t\320\005!\016\277\n5D6B\242\t\222\265s\335\220\035\013\216G\302 \351\240X>\223\031\237\024\n\004\b\357\273\220\250\230P\300\fD\264\335<\376U\271\026\270Y\273[\203 \236\016\217\005\207\374|\224p0\007\022\300\222\256*\300\277\007<ikp\364\177\301Y\233\265)'M\232\264\r\030Z8R\330\266\320S\311\3216\302\277\f\216\264\255\274ed\b- \220\002\021\261\353\001\212\021\345\273`9m\233=g\020u[\226\203\0206\324\t\031\356h\235&\031\006G\250\007\002X"
+	.string	"\256"
+	.ascii	"\246p\b:*\343\320\366\301^\f@\031\361\367\024\306\253AXB\200"
+	.ascii	"\306\f\177\321\261\b\240a8\363\002\r`9\300\322\013?\005\211\314"
+	.ascii	"\314\303\364V\203\314b\230\201\024)N\311\205C\274b\016\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\360\001E\b"
+	.string	"\322\314(,\200)I\0073\260\f1\320\344\300\223\004M\300\325\335\204\243\303\303gGD\232\313n\026\226j\244\f\337\020Z\364?\262\304\356\266\311N2]k-\225u&\013\f\r\312\241\226.\235P\230`\327Rk1\275\200cy\017\374E\034RC\250<\244\246*7\230\007\016\210\324\f\236\033\304\262#R\203P\020:\222\r&\303\\\215<\211\324\246\240\226]\206\231\307\320\027\024B\3203\036\343\273\024xl'\337\311\273\354\n\220\355\033_\274\305M}IvI\336\337\262\303\247\343s\213\211\307\\\005\256\375\353\243\t\355U\004, \200\242IX\017/\306H0\b\231\341\013I&4\350@\344H\024\340\204\214(\271\200+\327\316(\203u\"\325\003T6\247\225\220!\2406\312\355\260\320d\030\237"
+	.string	"\274.+\252O@i\216\305R\374oB\033D\216\353\354P\013"
+	.ascii	"Y\"\032\002<\241.Zj.\\\bP\201\265\272o6k\354?\200\""
+	.text
+	.section	.gnu.lto_.pureconst.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\002\230\004\004\230\004\006\230\004\b\230\004\n\230"
+	.ascii	"\004\021\230\004\022\232\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 \222\325\002"
+	.string	"\224\003~"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\t"
+	.string	"\002\002\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\004\006\b"
+	.string	"\001\002\025\001"
+	.string	""
+	.string	""
+	.string	"\n\021\001\002\022"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\b\030"
+	.string	"0\023\002"
+	.string	"\374\007"
+	.string	"\0071cO313"
+	.string	"\016"
+	.string	"F\221\324\t`!\006\027`fL\314"
+	.string	"8\240\004{ \0370\f\030y)\340\022\322"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.a8a1ee2eba52e30c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxCmsPitModeNames.36.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 \234]\004"
+	.string	"\244\007U"
+	.string	""
+	.string	""
+	.string	";"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\266\001}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'2\370\265\005}\276'7\b}\300\001"
+	.string	"?\202\210\200\030{3\301\0014\277\001\275\001\274\001"
+	.string	"\004ON "
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_vtx.c"
+	.string	"\004OFF"
+	.string	"\004---"
+	.string	"\005"
+	.ascii	"\266\013\020\347b\237V\007\250\375\006P\004"
+	.text
+	.section	.gnu.lto_cms_Vtx_EntBand.37.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 hA\003"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\267}\177}"
+	.string	"\005\001\006\035\001\005\005\001\212\001\202\200\200\250'{y"
+	.string	"?\202\210\200\030wu\275\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_Vtx_EntChan.38.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 hA\003"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\274}\177}"
+	.string	"\005\001\006\035\001\b\005\001\212\001\202\200\200\250'{y"
+	.string	"?\202\210\200\030wu\275\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_Vtx_EntPower.39.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 hA\003"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\274m\177}"
+	.string	"\005\001\006\035\001\005\005\001\212\001\202\200\200\350'{y"
+	.string	"?\202\210\200\030wu\275\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_Vtx_EntPitMode.40.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 hA\003"
+	.string	"0"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\203\275\177\177}"
+	.string	"\005\001\006\035\001\002\005\001\212\001\202\200\200\350/{y"
+	.string	"?\202\210\200\030wu\275\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_Vtx_configPitMode.41.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`]\001-\016"
+	.string	"&\332]D\020\221\223\016\370_\tU\203JC$\020\314'`F\362\366\320\345\316\256p\351\333\355\306zL\253\366\223nb\036fh\r\360\256\004\212\020\201\312H\\\221\207\371\025\364\252#\207\331J\250?\366\277\241\275\267\224)\005H"
+	.string	"H"
+	.string	"J"
+	.string	"\266\217\3421'\233\306\323\301\264\024\330\250X\340\330]\314\335C\342!\347\004\342\241\206\370\351O\363\344{\230\274\023\036fV,\356o\303\025"
+	.string	"+\365>\273{\025O\f,T\246\207\311\356:W\254\326\ro\233\201m\007\366M\004\233:\354\216K}\261\377V]\354\230\2060\375^Z5\235\232~'\324\241@\315\256\206\227\315\312\2000H\330>\331\035{\204F(;\327x\004l\312\225\241\001\347p$F\350\371\024\026>`\327\305\306\213\335\216\304$\234C\007\372A)g\325\247W\335\274\305SU\257\212A\345\313.R?ZR\346\303\323\227oqF\004\346\006\210\f\207\334]N\275\305\353\003W\215T\346\260\357\372\212\315\037\341\221J~u\350\253\304\303\253\210\210\026\226|9\266~\023\262cF\020$h\246\347\222\254\004%\323\016 "
+	.string	"yH&\321\002\022t\006\252\260B\341dB\212\266\235\230\266\fK\021\241lXV2a \003\036\221\264\022\2662\032\225\260N\267\247\211\t@\260(\312\261D\200|\n\325\316\264\374\312\237\013\312\031$mQ\204\374\n\006\036"
+	.ascii	"sJx\307x\346j\2002\261\006l\266!}\215\224J\205\202\340^\305\304"
+	.ascii	"\2525\022FFV<\260\336 x$\301\016\250\262\"n\007&\n\270\246\322"
+	.ascii	"\272\013\271\300f\245gl\037\252\034\241\306\031?\263Aj\310\242"
+	.ascii	"\312mW\321\003"
+	.text
+	.section	.gnu.lto_cms_Vtx_configBand.42.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\035\f"
+	.string	"f\225PA\020Q\225\016pF\242\004k\360pm\007\374\002}\017\305\254}\351\270x\005S\203\030\005\027l\b7\213^\352\032TEO\026R\306\002\200!D\005\224+~\301\022\021$\275\262\372\341o\373{\223-S\n9"
+	.string	"A"
+	.string	":"
+	.string	"6vWsx\002\363r\362\001\3632~\270\367,\252\347K8\031\211\r!\037\210z\226\341\021"
+	.string	"\270\312\016\354\356O\\/\200*U\tgw\255\037\310\272\345m3\260\375\300\276\203\323\005\214\0022v1\214\344\330\027r\205\b\333\236M\261/%6\032\232\206%\300\256`_\203\311\345e\304\346z\023\025.`\267\025\362\261\033b\214\231\\\332\366_\367\360l\020K\b\202%\361\300\301B\2125:b,twQ\321\335|\204"
+	.string	"\023Y\351\r\373\260\243\350\374\0206\235\364\337\245\177\232\227\217\025\021\r)\035\361\374\230\036\032{\305X\305a\207(\215.\373\331\306\226\035\325\227\001\021$p]f\315\246\361l\034\202\004\031\313\250\373,\030Io\031\n\245\t\035S\210\003u:\320\246\205>\036\220\266\221:-c\300\242\021G\322J\"\021I\243\204{\220\251\240C*\252\254\261\026Yt\275\233**3\002\031"
+	.ascii	"sJx\307x\346j\200\2023\003Lk\275\302\310\310\212\007\326\033"
+	.ascii	"\004\217$\330\001UW\304m\035\242\250\\[i\323\205q\251\031\366"
+	.ascii	"\031\333\207*G\250q\307\317l\220\032\262\250r\333U\364"
+	.text
+	.section	.gnu.lto_cms_Vtx_configChan.43.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\035\f"
+	.string	"f\225P?"
+	.string	"S\225\016\377\377\355\205\360\370\245\360Ow\370\t\200\317\tt\333\031\244{_\f\321\3475\320\032\f\013\265{\217ks\211\fQ\325\377\327\253\276\357\210\313\370?\333\371"
+	.string	"&\370a\321\336d\313\224\002:"
+	.string	"B"
+	.string	":"
+	.string	";vWs\370\002\363Rr\002\3632\206\270\367,\252\347G6\231\t\017:>\360\364l\303c"
+	.string	"P\225!\330\335\253\270b"
+	.string	"S\252\221\315\356Z?pu\313\333n`\033\202\375\007\0013\210\f\003\261]\r\261\037\033C\276(a\333\263'\266\205\203FC\327\250\bX\225\353s \271\264d\320\\\237\302\302\007\354\262`\270\330\r/\276H.m\373'\216\302\263a\225P\304*\002\202\304\005\026\0018"
+	.string	"\274x\350\356\236\242\273\371\030\301\025\242\322\036\366]_\321\371#\\2\351\277K\3374/\037)!\035P\032\363\3141o\350\313\306\214U\037vx\322\330\262\237md\331Q}\031\022&p]\346\314\226\351l\\\002\005\230\212\250\3630\020Io\230\n$\n\234\022\210\373p\272\317\246\201<\235\217\266\215:\rs\300!\0217\322H\241\320H\233\204{\330\\\360\001\025S\326\027\220,\266\336\315\026\024\032\001\031"
+	.ascii	"sJx\307x\346j\200\2023\003Lk\275\302\310\310\212\007\326\033"
+	.ascii	"\004\217$\330\001UW\304m\035\242\250\\[i\323\205q\251\031\366"
+	.ascii	"\031\333\207*G\250q\307\317l\220\032\262\250r\333U\364"
+	.text
+	.section	.gnu.lto_cms_Vtx_configPower.44.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\364"
+	.string	"\r\f"
+	.string	"\246UP> 1T:p\004\374b\204\032\210ar\032P9p\360V\360\361\356x\304b\006\251;\355\332\206\322\240\315\034\3034\n\t#\200\204x\030\220\203\250|6IhFG\320\227&\"d\223-S\n:"
+	.string	"B"
+	.string	":"
+	.string	"+t\354.g\361\022\355\023r\002\332\247\374p\360\231T\320\3372Y\211\r-Ra\351\031\206\313"
+	.string	"!*;\260\273OqU\205'\325-\263\273\326T\270\272\347m3\260\375\300\276\203\237\033\t\031\005`\354^\370\350\2611\346\013\021\266A;bSp`T\364\215\211\200E\301T\r \237\024\032\230\353QT\370\200\335V\r\027\273b\305\025\310\247m\337\304O\200vl\"\276V\233\007\026\026\002"
+	.string	"F\016\272\273%)]\266?\355\022\002\314\006Jw\330\207]\305\347\207\360\210\244O}\372$\355\363R\002\202e\322\017o\0326\226\216\031f\254\362\260\305\222J\227\375le\313\226\352\021$x_\346Kw\331t\036\202\004\226\t\350\343,"
+	.string	"Mw\026\n\242\t\232\221\307\353h\276N\307y8\233\016\327\205>\316b\300\037\220\027\342D\237O\210\213\210\373\230\246\240\203I\236\254\343\210L\272\376i\243\344\225#\030"
+	.ascii	"sJx\307x\346j\200\2023\003Lk\275\302\310\310\212\007\326\033"
+	.ascii	"\004\217$\354\270\242|\353\020E\345\332J\233.\214K\315\260\317"
+	.ascii	"\330>T9B\215;~f\203\324\220E\225\333\256\242\007"
+	.text
+	.section	.gnu.lto_cms_Vtx_initSettings.45.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`J\007\265#"
+	.string	"\026{\322G\200\234N\007\013%\340\203\267N\241\205\345\202*,\355\213\360\252V>\332$?X\346x\336\356\261\312[#-\215\307\276\215\b\274\325\022!\251\256X\306\031x\246\373\331\215oo:\341\317\301||\230\b\331[\312-SJ\001\273"
+	.string	"\255"
+	.string	"\311"
+	.string	"L\332\321\272\267\203t \204\375\f=\263\020\023I\254\221\314\031\212\210\323\255\373\230\233uo\307H\346K\260\227\261\330\245nZ\2229\223y8\3356\331\271s\034r%.\206\375\330\302sU\026\006\267-\311\234\263\024\270\355\005\247\333\317.\340\272\365\361"
+	.string	"\327m\343\3561NV\314f\016,Vgjr\316\276\272\303\261\363v\247ymY\037\267\357\322!\224\363v\246\204\237/\255\031~\376|iu\271i\205\346?C\262\272\376\226\t\222Q\320x[\226\214R"
+	.string	"\026\220\264\352\355\226\227\274\341\226W"
+	.ascii	"\303\251\322'\347\354f\376WC\251\177SB\316\271?\035jy\367\274"
+	.ascii	"\273ytw\260\333T\020OP\236b\273\232;\001\321\356\303m#\375l\373"
+	.ascii	"\357\272\255q\251\231n\240\217\241\020\276\n\201\035\243\276"
+	.ascii	"\256q\322\250|\316\031\252\252\270^C\230\205\231z6\235\363\316"
+	.ascii	"\304\307H\2349\347\356`\211\367\324\353\003/\252\n\325\346\332"
+	.ascii	"\247\215\351T/s\237\250\247\353\335w\013Q\274\247:\025{IU\250"
+	.ascii	"\3764\261\266\374t\335dR_\211\335^\346\252\243\333\313\274u\352"
+	.ascii	"w\216\375\306)\277{\366\233g\277w\366\373\274\337\246\375\276"
+	.ascii	"\367\333\332\357\362~W\373\375\345\267#\340U\351R\200L\316Xu"
+	.ascii	"m2\027\273\026\304\317\334\217\356e^\273}\247\311P{\237\205\305"
+	.ascii	"\253@pa;\030?\260\361=\r\362W\351\356F\355\267z\027h\273\217"
+	.ascii	"\306a\330h\274n=\016\023y*\\\344\314y\nB\277\324O\341#\235\004"
+	.ascii	"\213=\026\253@`\307G\332\260\225\370PE@\305\317x\354\215\033"
+	.ascii	".d\f\007\343t(\317\033\033#\003E\344\226\2324D\345P\321\365t"
+	.ascii	"N\356\b9<\313$\217\352\332\307\024\035x\313\271\312\323v1\036"
+	.ascii	"GTR(\272E\327m\0308.:G\357\027\324K\317\233\334\232\322t\343"
+	.ascii	"\300\363\326fT\236U0\253\253\301\235\271[P\2367-Fs\027n\025\202"
+	.ascii	"+c\257X9\312`\263\224lh\225#\re\025\272Rk\367\006\227\302a\255"
+	.ascii	"\272\351\340cMg\255\256\306V\273?x#F\b\227\204v\327\f\200\f~"
+	.ascii	"\300$\007BA\004P\247\240\211`\210\337\211\037Q\0220\370\2244"
+	.ascii	"a\205\323S\200\006\006\255pzBJ\261\224\244\204\324\244\004\364"
+	.ascii	"-\005\177J> S\223/\250\247\205'\222\230|NB!\223\257G\026\345"
+	.ascii	"e\266\300\306%\252Ju\213\243\363*\221\313m\f(\312\271\231\024"
+	.ascii	"6*\254\260]%\366\233\356\350\375\373\216\336\234z\325\215\226"
+	.ascii	"9\177EH\226}]\347t\321\300\306\256\250\257+\317J\374\236\"f\244"
+	.ascii	"h:zq\252\017\3613\307"
+	.string	"\251=`]<%\r\336\323\034\r\033\361\r\214\343=m\037\036\0224\367\027\310#^d\223\204r+\021\351\275\240\307D\274\343=\355\325\007^S\310\"<-\260\271\036\001\200\247\2501T\007\025*!\tD$IA\222\306\360\002\021\241\032\035\0200\307\210\244I\322\001\360:\312\251\374/\230\006\334|\023\300m\224A\207\350\213-\203\261\003\030\033\354\201\314C\347\376S\206\326[?4L-b\036z\222sL\306\312\352\353\222\003\204!\233)Hc\325$<\265\356\206P\221\352\0209\221D\316\272(\013&\006+>\222z\321\215\"\276\007\262)!j\254\036\256k\255\274\307=\212&\214\210\230I\"\310\370so(\323\2710\013\200\t`\007\203\302\233g2;}\016\370\teh\301\267\255s%\177G\027\003\370\326\201@\343\004\332\341`__\374,\212\252\236\310&8;\022\013\365\217\271\226\320\0217\327\031\240MQ\374"
+	.ascii	"\343\254\223/\300S\034\340O\016!\2013$\377\354\2247/F1\t\331"
+	.ascii	"\017\211\303\330Qb\221\327|\2774\216\342\200\217\357n\"1]\355"
+	.ascii	"\030\374\366\210%l\233\343w\026:ch\325\025\b\214[Ny\321\263!"
+	.ascii	"oH\237\002x\252\022\360\346\3340\013\332\233h\352g\214\365\243"
+	.ascii	"z\327\217*\276\275\254\006"
+	.text
+	.section	.gnu.lto_cms_Vtx_onEnter.46.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"M\b"
+	.string	"2\017990q\323\001\200\"\302\007\211c\203\003\007\317\273J@\027\261}s\301\265\2571L72p\370\317\212\216\020\224\332\327P`\320\022\360\341wk\006\243(\263U\364f\335\310\336)\005\016m!\322\306\211\020\264\017\203\003\007Z\3364\tS\304\b\242\304u#\260\333h\251\201\324\321\355\003\251F`\357\201\373\250\311\363>\352\251{\025,A\303b\236\234\305X\322\236\240\220\037]p\232\2423\030i\302\362\262\262\306\256\242\234+\373\326N\225=3\031\227\203\231]\214\033\233m\271R>l\207\266\307\036\310\020]~\244\342"
+	.string	"\273\252\025\224\335\n2\250\363\313\266\037r\221\320V\371T\216\024g\345qQB\263\273\324\365\002\330\257\316\003\260_s\343\341e\350\237\344\026H\307\311\210\022/9\n\273k9\242R\367\274m\003\333\013\266k\r"
+	.ascii	"pJx\307x\346j\200\342\204\001/44\247\254\225\353]\303+,\232\036"
+	.ascii	"\202\017?\363\230\332I\006"
+	.text
+	.section	.gnu.lto_cms_Vtx_Commence.47.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\256\002\245\022"
+	.string	"FauI\320TQ:\251L\344\241\222P\203\214\037*\006\230\335M 3\352h\3640{\013-\361_6\206\\\255\266\277\323\306\342\3257A\025\266\311BVh(\332\244A\301\312V\256\262\271\317n\366\370\r\035\350\377\362\033ido)e\n`"
+	.string	"V"
+	.string	"b"
+	.ascii	"\263\037\374Q\352\013\227\037R\231\324\020=#$|K\007\034yY\336"
+	.ascii	"\031 \366\244V\035\220\034\265\226-o\371\226\376\377\312X\236"
+	.ascii	"\331\277S\225,p\243\034\236\233\r$\265\326\360\345\n\360\226"
+	.ascii	"~\013\300[\332+v\266<\373.\215\235;.\204\2208\264\345\321\202"
+	.ascii	"Z\353\231\304\301\355{\377\027\370_\341o\2265\306\257\316_5\274"
+	.ascii	"\344\322o\215\267t\233\224\253q\321A\\\211\210}\226\f\251\234"
+	.ascii	"\344/m\3349\377\316\332\272\277\371\251\346\243\232\177\242|"
+	.ascii	"\323\344\203\036\277\324|\022\345\177\223?j\276G\371t\362g\363"
+	.ascii	"{\362\271\371\213\002\356\b\031\030\252\225D\221\222\032D\201"
+	.ascii	"^\374\017Dj\255\t\276;\226\307\204\257\316\322S\200\201!\215"
+	.ascii	"\3508\365J\213\023`\233\372\267\020sc*5\310;z\244.\365\336\200"
+	.ascii	"l8.\220L\004\340Q\177\375c\210\271\371\274\036\371\310x%L\230"
+	.ascii	"{6\355\237%\362\222W\021\321\264\237\370\327\340\342%i\253\330"
+	.ascii	"\232\366\356ycC7)\267\315\2757\242o\317\006\0318\264d\363.\242"
+	.ascii	"\013Kl\035@\260R\301d\256\0060zq\365\301\306\303L\007\232\326"
+	.ascii	"8#\033\305\220\306\305\032C1&\013W\004\376\202\265b\241\315\353"
+	.ascii	"\025\013\301\262\266\263\266\356\373\235\247@E\255m\007c\244"
+	.ascii	"\360\317\300\201\255i\347\037\030\251\376\037\254PP\020\231T"
+	.ascii	"\257\244@\365\017aw?|\240\232\245H\356\007\305\251\377\b\333"
+	.ascii	"cL\t; \340\002\031\241\352\006\023J\370e|0\367\301\314u\257\262"
+	.ascii	"\250\253\005\272\272\255\031\361]\346\212c\240\373\232\215k\306"
+	.ascii	"1m\240\357\235#k\004\032F\"\374\362\006m1\004\373\343\271\301"
+	.ascii	"\300\031i\245\374\3020Cm\200e\310y\032\003K\350F\017\265\007"
+	.ascii	"g\006\207\345\355&\230\235\004\372W\201\245\355\236B\3424\023"
+	.ascii	"q\366$\rO\204\267\206'3\342h\032\372\360r\304\0317<Lcj!\031"
+	.text
+	.section	.gnu.lto_cms_Vtx_drawStatusString.48.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\275\001\315\021"
+	.string	"\206b|I\320\360(\035\360Q\020\353\202A\021\343\230\021G\344Es\363\230Cl\006\002( \222\322\nX\354\336gD@o]pb\377I\255\240\211\236\270\003\230j\002\327\031\006\300M\204x\263%\030\343pgI_\226\243lv\223\275S\nd"
+	.string	"h"
+	.string	"c"
+	.string	"\252/5\"D\312\237\360wn\342v\236\f\037\260\213c\304bW\254\256\340\251\305\0278\235\202'p:\265m\221\221\233q\027E\320\2404\304\220\001\352\355\212\253\031\342\270\177S\342|"
+	.string	"\273\334?\220\303\347\207"
+	.ascii	"\307\003\223\200\335\313\2472B\2229\357rf\007#%\212dw-u;\233"
+	.ascii	"\233\3366\003\3338\373K\001\226>hS\352-\325q\227f\274\261H\264"
+	.ascii	"\205\216\355\333Wq\363\203>t\236;R?<\"\232M\t\tq\247\247R4$d"
+	.ascii	"\373\306\324p\350\222\232\224vE\t\340i\nF\210\375 \377\347@"
+	.string	"\267\247\270\360m\007qs+:.vz\2735\013N]\002\236\316e\245J\204Ly\037_<\212\333{>\314\261\013\202\t\002x\032.\363\345\333\335\375f\216DM\373EA^\367\371\315\234\351\204\371Cn\200\271\331]\226|\323\207Qh\316\034\007\370\307\211\316\024\237#\030\331d\311{!\343+d\tf\354\306\\g\001\214\231)8=\321Mn\\\244\r\237\367\bG\313Tc\245\r[\314\311\231c\177\216\3438z\342\330\347\371Q\357\371\251\245g\256\265VU\255\265\252j\365\230\020{\315j&\265\n6\024W\250\342\021\266^,a\203\226\032\013\207\314\025{\240B\223\241B\f/\232\313\226\2022\253\305Bi\205\"# \006\\\266\224\351\026HK\215\345\304\026\013a'4Xk\025{\241\300V\255\031m\005r\300\262\225p\266\252\311d\263U\207\270\377\346\347yw\220D#\250H\372\270\323\2343\266\3474I\033"
+	.ascii	"o\312z\347a\205\325\240\242\320g\314e\325\334V+\f\025\024\212"
+	.ascii	"\224\323\226\201(\325\364\341\202\001,K\232\255\t\r\002\027\260"
+	.ascii	"wt\261\b\343\212I\255\002B\360BnO\215\202c\017T-6%4\215AA\001"
+	.text
+	.section	.gnu.lto_cms_menuCommenceEntries.52.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`8"
+	.string	"E\007"
+	.string	"\204\013\354"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\360\273\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\002\005\202\200\200\274\254\360\235K\177i\3053\206\bg\350\002e\307\310\001q\306\3048\206\bc\234\254\354\035a\313\314\001q\312\273\030_3\315\0014\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_vtx.c"
+	.string	"\004YES"
+	.string	"\bCONFIRM"
+	.string	"\024"
+	.ascii	"\336Ee\025\006\202\201\233\2672\0052r\030\016`.\\B\005C@\022"
+	.ascii	"\330\213\205\305\253vs\241\265\215zOY\027\246()C\017\240\b"
+	.text
+	.section	.gnu.lto_cms_menuCommence.53.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 `\001\003"
+	.string	"("
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\354\203\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"?\202\210\200 yw\274\001u\274\001s\274\001q\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_menuVtxEntries.62.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\032\002%\017"
+	.string	"d\027\260\002"
+	.string	""
+	.string	"^"
+	.string	"\005\001\006\035\001\021\005\001\006\357"
+	.string	"\177?\202\210\200\b}{\276\001\005\001'\002\206\by\005\001\212\001\206\200\200\374\230\330\360\276\nw\300(us\301\001q\277\001o\275\001m\274\001k\273\001\005\001\006\025\001\007\004\370\366sig3\206\be\254\254\024c\307\310\001q\306\001o\305\001m\304\006\017\202\200\200\370\365\263\017a_"
+	.string	"\202\200\200\350&\177]\3158\206\b[\350\002Y\317\320\001q\316\001o\314\001m\313\005\270\365\223\017aW\250&\177U\324?\350\002w\326\327\001q\325\001o\323\004\370\364\223\017aSQ\333E\335\336\001q\334\001o\332\003\206\200\200\270\364\263\017OM\350%\177K\342K\350\002c\344\345\001q\343\001o\341\002\001\357sIG\276P\206\bE\254\254\024C\353\354\001q\352\001o\351\001m\350\001k\304\001R\206\bA\234\254\370\036\277\177\357\360\001q\356\273\300\001\275\1773\361\0014\355\001\347\001\346\001\340\001\337\001\331\001\330\001\322\001\321\001\312\001\311\001\303\001\302\001"
+	.string	"\005BACK"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms_menu_vtx.c"
+	.string	"\004SET"
+	.string	"\006POWER"
+	.string	"\005CHAN"
+	.string	"\005BAND"
+	.string	"\004PIT"
+	.string	"\001"
+	.string	"\f--- VTX ---"
+	.string	"6 "
+	.ascii	"\003\021\241\223\007\304\031\241E\270\270:r\t\327\030d\204\256"
+	.ascii	"T\323\2509i]*\001\n\303\320u\261\004F\371~\325\220\330\275,\263"
+	.ascii	"s\272\301\315\255q\217\rr\337\246f7n\2620\224`\257e\355\234\231"
+	.ascii	"\3242_\013\372\0322\211\366\202\257\t\033\266\323\330u\237\032"
+	.ascii	"mF\254\350zI\226\373&6\354s\340\022pD\211\241\207Y\004"
+	.text
+	.section	.gnu.lto_cmsx_menuVtxControl.63.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 nq\003"
+	.string	"6"
+	.string	""
+	.string	""
+	.string	","
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\212\001\206\200\200\374\342\303\304\204\005\177}"
+	.string	"\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\234\236\370\037{y"
+	.string	"?\202\210\200 wu\275\001s\274\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\036./src/main/cms/cms_menu_vtx.c"
+	.text
+	.section	.gnu.lto_cms_Vtx_drawStatusString.part.0.83.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`(\007e)"
+	.string	"\252I4\020Fp\236Q:\263\302(VF\211\260Pq\237\363\274\376U\222TyU$\203\215\020\335\273As\271\213G\254\007S\n\211\365\346.\343\031\315\017\007\340\007\227a\320\251:\2646\320\322\206\346 \330\267\377K>!D\356$\003\361"
+	.string	"\335"
+	.string	"\356"
+	.string	"P\027k\300\267{\271\326\3168\304\372\324\207Z\346\342\263\3340\300\274W\312!&\022\332\236\311\277r,P\317r\343"
+	.string	"\356\355Bsv/\023\370\224\201\353Sf\236\200\372t\275"
+	.string	"\365)\363\255\360\204\nE%3\363\204\nPl<\363\313\312v\\\243\203\213\237{\231EO\033\311\215\357\361v\272\034\356\266\332\324\024m+d\344G\275\307\263\311%\326w\270%\326uDP\337\023\345\020\233C\tX5I\336\251\324B\035\344i\362\021bq\nn6\r\\WY_\235\312 \250\357\336{\264+x\242\004bmE\256\266\332\323H\234/K\254\247\250\003\2554=rK\035(\0017F\354\240h\202\256\"k\271%\025\352C\323F\007oy\264\215B"
+	.ascii	"\342E\ro9\205\n\2103\305\310\321n\253\226Gk\003\\\310\246\341"
+	.ascii	"\336\313\227\372:\0038\363\317\314E\230\325\034\001\304\337\323"
+	.ascii	"7s\f%\373$\373\220\035\305G{\n6wM\355\332\366\032c- \276\330"
+	.ascii	"/e\001q\013\265\027\363\373\371|>\271\273\230\331\262P[\356\265"
+	.ascii	"e^[\336\341,\353p\226sm\031\327"
+	.string	"\226o8\313\353\315\262m\265\254\336,\247l\031e\313\375\346\331\236\371\177\301\017\254\247u\257\3253\320\335J\305\200]\314\337\374\317~\263\243\314fE\376\331\233\027s4\316q\261X,^\254\301\032\245\\\307\216kn\006\305\377\3620/\343\334\323!\2612\262\341\325\211&\3140?Hfa\300\320\370E*o\311\264?y\356e\266X\237\016\235\221\300\374/\374\261w\201\272\227&\364\002a\336\250\031`f\302\374\334\253|\360\224O\254O\373\032=q\003\273\203j\353\336k4TE\002j\317\205\257\345[\002\277\247\267f\336\300\241\373\326GF\231\262O\326\225\021q^\230\232B\266>\370\332G\314\036\336d2k\017H\"\304\367%\225/\307\362\276\366\374\2605\037\316\377\206\370a\250>\2655JV\225\005\342\315\241j\313|8\323\346\273\311\261\304_\302\277\241>}ZR\215Y\304\233K\026\322.0\007\213\224}\362"
+	.string	"=\31255VC\336\311\262\365\321{\357U3Xau\271\315\305:0\202\234\227\307\332UZ\332^j\216\266\356\310\001K\302\204}\022mU\310\026\325\227\304\tk\203\266\027\337\250v\377\311\026:\005\354\307\274\251b\275\3672\257`a\237\354\246\261u\354(\356[7bdr\232\206j\373h\313\034*\373\207s\177\300\364qZ_"
+	.string	"\313\354\342\205}\322\266qk\252\243x"
+	.ascii	"\233\255\236\335\235\321\250\3742A\020?\266\264\302\356E>)\\"
+	.ascii	"\221\001\f\004\002\201>\225\203D\030F\224\360\331|)\247\214D"
+	.ascii	"\201\be \320\007\004\356b0)\021\235P8\311x\202\221$D\332\t\203"
+	.ascii	"J5\204\035l8\325\270\r\223\230@ 5\rmB\034J"
+	.string	"MIOG66\n\032\301\b\n'T\210` \351\351\2509\030\301\206S\215\027OL\302\245\027MK\301\"&%\030KEAbSQ\004\004<\234!$\0269\r\207\304\242\334\321\333]\037\322\006\215\231\251\277Q\025\352*f\026j\326 \325S\334\204\336\313\225\341g\177\036-\366\331\023dT\222\200\311\212|\220\337\323\336\261W\206\250i6\306\313\3751\202\0219Y\221_\376\236\362\366\374\315k\356t}\214T\210\252~Ow\266\035\257\314\n\203\2542::]\023\241\350\272@\022,RU\234a\244\020A\313\345\214RrR\2348=F*UV\344\217\277\247\270c\235\277qNn\013\354\332\037s<\306+\t\276\214YV\344o\200\211\250a@\344\020SFHDDD\222$i\003\220\002\231\2512n\021 \271\204\312j\2450\254\0017h\350\016\361\271\372(\347c\206E\232q\345\303\372Ws\266\340\246\2306"
+	.ascii	"s^\177\2067i\346\254\217\212\320mQ\235={\b\212\020\334\276\207"
+	.ascii	"\177\324\023h\204f\2325\335*\242JO\245\305\013\265\375\301'\320"
+	.ascii	"q6\231z\267aL\344\314\3421\021R\256d\017\273\017\220e\200M\b"
+	.ascii	"\276\30564\003\312\"\324pl\005>#\273\277T\030r=\347\313\276\200"
+	.ascii	"\230\272\362\203\245>\212cPn+\016$_@fD\317|)<>\b\036\265\177"
+	.ascii	"\372\202J\004\023\027\0304\266\313\331\264O\030H\235t\340e\322"
+	.ascii	"\002\225\311\027>Jo`\333U29\233\267\270 N\242\\_us\031hW;\350"
+	.ascii	"\311!\227O\265\024\257\261\201\204\223\022\257\0301!\016\036"
+	.ascii	"\036PF\263\365o,\265\311\0359\357\275Z\001\332\321\276I\262\210"
+	.ascii	"\276q\317\212N.Y\307\207\032\333\355t\335w!\231\003MQ\024K\236"
+	.ascii	"\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\273\002U\r"
+	.string	"6\023KA \207l:De\003\216\223(\fdp\336\017#1s\257\301zu\n\032\022\234\241"
+	.string	"Pg\302\253\024"
+	.string	"\022<"
+	.string	"\001\004\b\031\262~S\2612\b\202 \b\024\bp4\226\265\216{\177\002\005\033K\"S9"
+	.string	"7"
+	.string	"9"
+	.ascii	"\262\215\247\323t\272\f\207\005`l\022\006\346\003.m\262l*\r\022"
+	.ascii	"5a\217\0322\f-\342\370_\323E\031\273\377^\271Z\331B\376\376i"
+	.ascii	"\254E(\313\262\234t\210\373\317 \001\257\241\372/\210>\354\241"
+	.ascii	"\177:\364]"
+	.string	"\373\237+Y\345\2179\365\005\254\211,\241H\251\321GT\321\375\025\262\350@}\0329M\323\364\323O\300y\272\304uN\200\363XG>\242\271\333q{`\303\200\034\232#\310{f@\276\020A\226\240\225\217\023\314\360c\020=-\336\345c\357\343H\313\343\210)zL\321\237\251\372\005&\372\b$\372\264\210\276\201T\007_\330\356\215#\225\325\005^SSY\254\354\241\313-8g\r6u=\030\004P0V\226\240\365\\\225\306\307\214\254<A)\347v6h\016\310\312ak9\007j1\262r\006\250\300\001= \020\003\231\031\326\001\376\240\235`\371\216\037\022\320\221\264\bs,\036\0326\210\241\017-C\337\315b\204\f\260\\\310$\031!{R&\273\206\261&A\022$A\022$A\022$A2 \361\005TFr@\004J\32060\237\261C\3062N\222\002KR\200\346\033\274\2705\336\220!\002m)\271\030\363#"
+	.ascii	"\332\301\347\2413\206\201\023\0307b\002\242\216.V\007\027\253"
+	.ascii	"\003\\LS\2172"
+	.text
+	.section	.gnu.lto_.refs.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375 \365m\005"
+	.string	"\322\216('\220'I\007\377\377\377\377\377\377\377\377\177\f\276\207\365\365\233o?\030~dmkk\3657k\t!\215\330\335\b!R\246#\332`\243\r\035\2752m\332\212\312\3322M\272(Ca\024\240\001]\232\332\252\350)k\242\354\352\016\307\033\2163$\276\240^\341\360\004\365\b\344\007\352#K\2174n\3208D\321!\214\0270\376H\364\307\342\003\213;\032g\032_0\2760\336\026W\026\225\346\207\342\004\351\005\024w\234o\024g\370\313\375J\237p\204\262\272\277\343\350N\316\2278J\243~\207\243s\373\221#~\377\207\002"
+	.ascii	"#\020RJ\240\240"
+	.text
+	.section	.gnu.lto_.decls.a8a1ee2eba52e30c,"e",@progbits
+	.string	"(\265/\375`\\/\375\314"
+	.string	"\352<\035FV JI:\351\334xV\025A"
+	.string	"\001_\357f\247-\213\350\250'`\252~\267w33c+::\373\244\341o\374\370\006xI\027N\356\320\202\345?p\031\266m\333R\267\245\346\f\004\325,("
+	.ascii	"\264\032\025gZQ\315\200\201\266\270M\321V\210\361\214\265\332"
+	.ascii	"\270\267\224)\255\003A\004{\004\354\247s&\304Jk\205'2m\020TZ"
+	.ascii	"\002\315\236\226\331S#\366u\314!x\332e+\265"
+	.string	"aO\245\354\351\222}\233\261\177\313X\243\263Fw\2334\341\345(q]-\315\264S\267\243n\252\225\230\215\217\300^\352\313\315V\372\331\r\277i\303\200iY|\255\304}\274\306\307\007\016,9\036\027\334\316\324\330\312?\274!\310\326wtQLp\366\335\266\346\357\372x\341\003lS\303\314J\266\231uUCv\325\003\214\211!\007\256\215\022\026\272\276\323\322\234\021\332\220[\232+\343\302x'\234\2249OL7\370\320\360\036\223a3\314\307e\270\311gX\357,\206\307\374\247\311\027)\023`\230\315G)\303e\272\253q\206\3030\033e\206\t\323\274\242\274d\270MgSg8\217\361\270.\213y\253\204LYVZ?!p\376\270\256\256O\355\313\034\202 Zi\337N\366\274\306\236\311\3303\236=c\261?\343\335\365\344@\353\032\323\365\334\344;\273\020\304r\210\351\312u\334\345l\307/\\\266\323`y\357\022\333a"
+	.ascii	"\274w\t\003s\005\314\025\324%^E\326\202\365L\305\236\323l\206"
+	.ascii	"9\276\262#\265\246d\245\353M\274Mi2%KX\232\032\263\371\320{\267"
+	.ascii	"\344\3022\300\300\004_a8f\343\272\254\016"
+	.string	"\226\270\361q\031\223\321|p\356]n\t\273\227\211\205\265p\034\313\361\026\316\302M\276\302T\316U\330\312\233yo\323\275\027\350|\205\335\030m\002\031\367.\267:t\365A\351\370\273\227\031\342'\004\217Y\021;1>\365o\314!\250\303U\366\\\303\236e\330\257`\217\264 \242\360\0327)`)\307\300\304\251\322\223[\326\363\306\2057m\272>\005{\246 \310\201LA\360\027\260%\230C\220\235\360\023nZ\300P\316f\334\3448K\314\313\274\227\211\241\205\270\211r\326\365+,\017\212\363\331?t]\023\337`\317\026\004i` [\020|\333\f\314!\330\314\344g2.\243\200&\243\226W\355^\246\006\fL\254\032<\272\236\311\034\202\2267\004\273\350\303\317\020\264\211\024~\366\360\377\347\347\016m\200\2777@\324 ^\274\313\231\023\021?e\032k\027\377s~*\367w\213\277\211\177\263\370{\330A\235\201\306@_`"
+	.string	"?m\341g\267\237\331~n\373\371\355g*?7\333\002^\376\256\300\337\024@\372\231\003?\037\177>\177F\376\234\345\357\t\270\370y\003?\017\375\327\360\323)?3[\002\377\317P\350\371\351\007\330"
+	.string	"6w\004\016\342\247\034\374\274\354\023\216\363S\016tp\305\337:\020\270\226\313a\371\371\204~"
+	.string	"\330\231\363\375\037\3632\377\373\277\327&\374'\363\367\206\277K \341\256;x\006?M\201ue\200*e\005\027\376\324\303\317iZ\305\317~\355\200\377R\372\204\237E\374\237\340\031~\nD\327\0340\3012\262\242\252H\t\377\337\374\314\377\003\177\346\3616}\342\277\375i\003~\326\373;\001\247?\305\362\367\006\177\207\370\273\202\277!\370{\347o\341\337\3753\340\317l~\376\373\271\357g1?\177\371\271\356g.?o\371\271\312\317f?;\371y\354g#?\027\371y\310\317@~\366\361\363\327\317\\?o\375\254\3653\216\237\263~\306\372\371\352\347\252\237\225?K\375\f\365\363\323\3172~f\372y\205\237=\360\263\t?\307\370\371\001\377\213?7\340\277\005\377W\374W\363\363\004?K\360\337\356\347\3723\375\271\377\243)\373\257\200\377[\376o\b\f\f\f\374q\376~\341\321?"
+	.string	"\274V\0027Je\3435\021>a\016\333\301\t\n\032\305T\252I\245\230\355\247\2037:\276\253|\023q\241\225=3[p\002/\024t\006\245q\nu\n\325x\226y\2472\b\363\3132v\263\224\027<\330\305\376\375\007o\025\016\363\2761\361\004\177>\343\234/\370{\230\362"
+	.string	"\376\327{O\301\005\356U\332[\246\t\312u\331H\323\365\376^\245\245RC\222\331\354R&\233\272lp\262\331E\225lv)urn\211Jy\273\224\354]R\331\344\322\275\315\345\245\332av\335\313\354R\262\314%\345M2\273\226\032\222M]T\234l^\345m\272J"
+	.string	"$\357\245\272\315.3\234\274]\312dsI\245\3416\221%\223j\216Pq\026f\332\016'\311\246+\365a\254i\251\254K2\227\374v\257\222\232\323Uv\335\253\265\254\340\255\211\210\322\033S\235\2240\253\211\251\3047j0y-s\230L\267.\231d\371\302\351^0\267\206\006J\254\304\274\367>]&%\276\327\211\251\274\227i\251\201\254%\343=)o\317mZ\212b\362Z\36281-\237n\022.\246J6\275\226@ph\315\260\313\304T\342\260\013\246Ki\233J\314\233D\323\343\347\226\367\327\225>\365\254\211\352\222\367\303\236:\375T\211\323\202\311\246\256$];\020\350T\006\005C\005G\233\232+\317\355\314\217\256B\336\020\244J@\247K\315\244G2H\327 \275\177\007\366\017\0367:(=\272\342\320"
+	.ascii	"z\277\251<\324L\035\351\372v\323\314q\373\021\204\257k\267\001"
+	.ascii	"z\003v \204\307\222\256\224M\257\211\372Rc\253k\377\2515\361"
+	.ascii	"\304\355\221\035\331R\323g\032M\367u\032n\222\3512\315\227l\252"
+	.ascii	"b&\353-\206\355\262F\360\2521\206\377|\bp/\217\3000\277\276\322"
+	.ascii	"Xh3,G\212I\212\313\374\332J\307\255\335M\375\204\250Qd\322\230"
+	.ascii	"\341\251\017fY\376\300\033\366\376\034\035:\277\033a]\037\244"
+	.ascii	"\262\017F\3310\255\327`\270\331b\324\2644\235\027\024\337\275"
+	.ascii	"\315g \246\263\244yE\211i.\375\005\303\035\r,\271\277{\233\021"
+	.ascii	"\204\b\021\"\030G\305uek^{\301c\306\001\t\003\230\207G\357\310"
+	.ascii	"\336\202\364\335\033\357s9MtN\246\272\366\013m\307\243\306\213"
+	.ascii	"\227\224\266\353.=|\330\331X\363\251\342\205\306U\327\272&\023"
+	.ascii	">]\355!\351\372\276\227\301\221\022V\303\213_\317\375h\253k\223"
+	.ascii	"g\267\310U\257(?\304\272\266\334\035\317\275\023\364\\\331\340"
+	.ascii	"2g\217\023g\317\027\034sa\352\357\3152y\246\246\204,\245\330"
+	.ascii	"\2531\007*p=\240\2545\334\337S\372\215\3554\340\241\003\201n"
+	.ascii	"\374\272\036\fs\b\366\360\206`\267\001\275\3356\004\225Y\314"
+	.ascii	"\253\266\303\345\n_\223\256<\315&\205\347\r\232\031&]\327\226"
+	.ascii	"l\265\3410\261\347\262\255^\2369\241\304\304\221\033I\276\347"
+	.ascii	"t7U$,\007\237Y+\351%ULR|F\226zo\376\254\264Y\2271\032e\276\331"
+	.ascii	"\2473!\375\003H\203\371\350\036?\302\232\253\253{\224P\242\324"
+	.ascii	"{\363G\244\301\n\200\244N\357\315YGif;\351'\335\244\321\272\331"
+	.ascii	"j\315\244\323\032\n7\333\254\311\350\332\254\221\\%3\032 \271"
+	.ascii	"zoBP(#6\252>\324\343\330\260\307\231\261\244]\220\033\262e\243"
+	.ascii	"\353\030\323F\ts\247\243\317\276[h\261\377\376\364\274Ib\327"
+	.ascii	"\305\276\312\331\327*\366\325\315\276F\261\257M\373\332\304\376"
+	.ascii	"\030\261\r\326-\244\207\274\301:\bO\023\263\301*W\340\303\\\001"
+	.ascii	"N\334\220\245\263`}\025b_\275\354"
+	.string	"\005\365\206m\257\346\301\315\237\376\302\300vLRZ]_\253\354\n7\220\177\202\257I{\242wX:\250\257%]O\375\354\251\026\035~\f&L\307\234\326\234\234\217']\237\001\324\343|\2322\334&/ a\374\266\225\301\023\373\3218\003k\251\035|3\202\360\375}\3257\272\252mt\216f\241\263\032G[q\263\261z\352\255l\252\216\352\032?\032\253\235\330\016\355l\b_\323\340\266\306b\270\307Q'J\213\346\245\203\257\254\261:\031@\232]\233\037\027\374\b\0367?\330\254\272\326!|7\006\265\206\306\257\247\254\310\027.Z\366g\215\227W\r\262cGlk-\020\310k\020\332\202\013pF\272\326\0378Y\315\257/>\204U\226\315\">z\264\035\2168,<\352\227e\001\0200\255\353}f\360\350\251\234\262 N`\372\354\261^q\344\250\\\364\356^\246\022L&07\231\274"
+	.ascii	"\003\335\f2s[\257\\\257K\fL|O\207\215\211\271\343\317\351(t}"
+	.ascii	"L\366l\325\361\275\343\231\341`v\255Z/\343\203\207D\r\334\267"
+	.ascii	"\230\251\201\361\230\2635\353\365\006\225\255\257.+\366\2576"
+	.ascii	"\376\034\341\232\227\034aS\354{\324\354\217\217\0325\352\225"
+	.ascii	"\016+\2551\237\260\244\215$V\257W\301,ik\372\272\326*\035\031"
+	.ascii	"W`\242T\252)D\346dPU\345"
+	.string	"\315\322\305H[\327:\325jC\256\231#U\212\365t\274\0309\273\353\372\036\026\354O\235QgT\250\032VZc\301*c\230\320\321x\205\342\221\023s\244I\321\324\274/!po\354OTm\252M\365\351+\207\225\326_\r2f\256\313\351\365\251\301\364|\274u\2552(\032+\227\226\027\007H\237\224\3655\321\263\021\374\275yS\2278\003\223)O*LHv\244\215\262*\275.\311\270;\"\325\265\336\0342h\276\310\272\322@f\023Sf\013\225\256<Sl\004w\200\200\264\357gI\363\246\254\264\306F\210E\325\211\331\b\320\330\260\241\\?L\314\330\001V\262/5\246t=\017\r\373\241\312\317\217\376\t\241$m\026\225\253\261\256\177\024M\236\233'\032ll\004n(\366\276G\373\370\311\235b(YVZ\027\340\354-\301=\2459\355\253\201Ruh])\031\212\006\317N\013\r=\263W\327\224\354j\206J\321"
+	.string	"\262E\306R>Z&h\246*.\320\316\276\217\331\274\324\214\231\342f=,\205\tC\305\\\300\274J>{\313?\236\245\020\354\315\224\r\275\2070s#K\327\357\220Y\017nv\334\244v\364\213\237\262\207\016\216\310\220\256\247^~zG\361\250\026\234{\346\211\256+\233\001\235\346\275]q\002\354Z\371\334v\274\254\007-uu\264JU\007k\224;U\326\003\021::\312\005'yI,\225W<3\234\362\266\002\255\2075q\334\244qt\213\025\2106\314+\021\275\206w\364UQ\271\237^\241X\250\226\024\220\344(\363\223\243\344\246+HW\312\004t\232%"
+	.string	"mqp]{\356\033o\b^g\214\375i:;7\351\031\255\222\223\274\267\nD\240R\251%\242G\316M\220\026\272R*\314\246\273\2644n\356\254\024\232&\005E\307\024\332F\335(\0347\351\333\351\330\250\030\024\224\037jtmJ\306\026\037}\243M\232\346\003eG\b\0363H\266"
+	.ascii	"\321\251\327\331b\257S%\n\025\323d\017\356\211\275\016\031Ec"
+	.ascii	"V\026Z\210\242\004\314B\031\263lnkT\272^g\207\275\016\224\375"
+	.ascii	"\022\332d\tu\022\274\227\231\313)%\363\324\211\220\t\020e\030"
+	.ascii	"\337\375\251\241\261u\375\260EF\233\220Q3\276\312\022[\352\250"
+	.ascii	"Y\203\345XZ\222\321\225\226\361\335\225O\224\270\\\200\201\006"
+	.ascii	"\232\032\2463\3669T\254\004QH\220\320\261\2707:6\027dr\n\254"
+	.ascii	"\242b\301*+PfbT\t\226(+\274\376S\323\001d\216F\327$o28ThF\256"
+	.ascii	"<\261\034\230\24085b\204\016a\rMw)+\007\211R\214\210\020\313"
+	.ascii	"\301\b\212\323\"E\350\220\323\344\362\332\bk\"~oJ\272>\347\206"
+	.ascii	"\345\360\205\342T\210\020:\344\347\311U\202\321\305\007\233\277"
+	.ascii	"{\265D\320\344\022\2701\177=WZ\230B\243\353\301~\236\245\322"
+	.ascii	"\003\273\321\273\322\206\214\365\340\005\004\310\032:\353!\313"
+	.ascii	"\207\017\372\325\032\356]\372\013\263m\326C\r\024\354\002S\257"
+	.ascii	"s\223z\321/\234d\265R\206\357*\225\"(\017\241\025\227\035ng\366"
+	.ascii	"\026\211\225\300\307rI\271\310\230~Y\376(\027\031\034\273$D\326"
+	.ascii	"\266l\007%(N\267\316M\272E\223\375\344*%q\201\262\362wo\226\b"
+	.ascii	"\234\2511=\035]oe\330\017^\264\264\276\312\322\330\016v8p\200"
+	.ascii	"\tc'\210\222\225\325x\234\325\301\022\300*\266\003\026,\254\027"
+	.ascii	"\326\254\004X\256\256\242\210\331\016lUU\\\210\004\304!\243\212"
+	.ascii	"\223\350H(D\342\034\032\035\215-"
+	.string	"\202-\316\"\321\361\b\031t\324\342\3349\213\220\212EcQ\030T$:\213\210\220X\004\005eP\301x|q\032\213\302\026CbQ\215q$dD4\n\236'Q\204\tb\f\r\211\020@\216\320A\204\241\242\007\037b|\360\363\027#H\b\265\360\020\243\005\321i$a\250\350\001\021\306\020\271\001\303\211\f\332!\256(\032\221F)\222N\030\036\220D\242\244\023\205\240\025*RX$\221\350x\026\211B\341\3614\241\204\fEc\320\347$J\n\241h\310\302X$B\321\310Sd<\236Ec\212\244\023\205\244\237\022#\316\343\360h\005\022\351\034\236+T\030\036\207\004p$\236\305\020\212\306\"\244a\013\"\b\035\220)4\374\305\b\027E\242\343\211\f\222\340\203\023&\222N\030>g1\204\fg\320\007\036\234p\026C\300p\022\025\211 0\"\236\310\030+~\210BE\242\221\2211E\006\035\016'\f\273!\351\204!|"
+	.string	"\206\212\303\017P"
+	.string	"\300\205\210\216\304\"\321\205\275\006\033 `\203\023I\302\237@Q\002E\211\340O\240"
+	.string	"\002B\261\001\220\375\006@\364\f\002aE\t9H\027\303\242\0268C\304\024\204\206G\301\030\307\263\030\302\n\025)0\324\343i\202P\021\211\001\347Q\tHE\242\212\025*Rh\020*\"\265\260C#\030\021O\242\340\360\034\016\325z\376\305\210\343\360E\212\244\241\221\020\031\324s\"\203P8\217F\023b\f\213\216\220DC\033\210E,\206'\300\b\016\005\221*\030\217\025Yd\024\252\023\240"
+	.string	"\322xT\213D\342Q\bYT\204\304"
+	.string	"\"\022\251\247\310h\374 \bg\210x\034\022\213\204\204*\030!p4\"\217HB9A\026\303\243\213\2343\350\314\200$\236H,\210\216\347\351\301\231D<a\210x\036\215GGH+\206\210/\204\206B\024 \203\214-\212#\f!K"
+	.string	"@\f\241\"\021\211\003\304c\213\034\235\363\034\252@TTD\244\302G\307\356\034\211\347It@\022q\2508B\206\277\030\201$\036\3058%(\032\302\240IC#Z\304\371\213\021E\243\221\221Q(\by$\302 :\016\201@\006\3058\211\212\210X\f\217\206)\210BD0\210 $\23508\234E$c\212\034\236\343\360\205PE\022\215\206$\350\374\005\t#\021\0047\036\021\217$N\243\361Hb\007\031\344\202\250E\321\230\002\351\242Ht\236\304\025I'\214\rC\305!\213ZD,\026\207/\204\204G8\305\341\213\024\304!\243\212\223\350h\347\f:!4:\016\221D \250`,\3629\2036"
+	.ascii	":\213DH\366%\204J\f\205\210\030"
+	.ascii	"\230\030\361s\0168H\001\"\002$"
+	.string	"\210`\205F$\2350\202\220\212D\243 \244\221\020\211\"\321\320\210\204\320\021Ib\004\005\304!\242\343\221\b\243\204#Q\005\243\tIC\243\f{M}xtVc\252\230\220.151\025K\026 b6\364j\020\213E\212[\2320\\\025\330\361\244\005\206n\301\260\006$P\357\213\227k\261d8\251^\376n\353(\266\323:\302\343\253k\305\003z\315\303\271\261\205KH\327\035\336pW\355\252\244\350\021\351\372jW\226\324\304\024\330\025\b\350\265\0137i\343\004K\235\331\231\034\327\217\027(\027!\0165\3116.\324\251\247O\317\353\211\216V\031\203FI\222\271/8Q_\316(\331R\345\202\250\214\344U95\0377C\240^\320rw\276\240\315E\311B\235\330\274\252.2\272\326/0L\262{eI\007\t``Y\034\345\252Qn\374\360\262R\237f\374QU\201\332\001\223\301\304\206J\322\366\310\253[\203\373:"
+	.string	"\013M\224oL\202h\230\3120\231R\257pr(y\222\303\215\366]\341\2146`Wm\364\357\326\355\351\275\261I\001\021\204JGW3\035d\307\334\023+]\243I\030\034\223\332\254e\225\311\t'%\twd\265\331J\352\023\2533\027*Y=S\013\023S\233\374\306l>B/3+-\264\272V\241\324(U\255\246q\2636i\231\020?\326KY\232%\237z\2370\226\t\345\206\226\033N*\323l\315\222*3,6f\2726\251f7\316\224IBg\353\224\tQ_MT\354\263\274.\241b\330\350\350\344\\\240Cn\004\036\261\032k7\030pp}\321\350\372\223V\301*X\025["
+	.ascii	"\025\232\271\2610N\200\364 \362*\366\252\004\003\023\217\263"
+	.ascii	"JV\356\322 \251I\324\246\334\240\212\330j\244\036\331\301j\342"
+	.ascii	"\275\371ak\221\032\306KQ\001\204!\250\343\242\003\202X2\305\234"
+	.ascii	"bL!\022\232\031m\322\0013\025@@Ph*\025\316\263\332\r\023@\223"
+	.ascii	"*\364y\224\350Q\321\310hR(l\355\031\3670r\005\340\221\301\321"
+	.ascii	"\030C\360@\244\206\327\330\r\372\003F]]\223Z\320a\220\021\340"
+	.ascii	"8\2451\332\"\013\\)\205\207N>\222l>\345=\336\327\327o\336\331"
+	.ascii	"\032\246#\341:\253\277`c<\030)2\272\"\233\207 \317\362\372\301"
+	.ascii	"\037\234i\302H\355T\273\036\260\244\215\373\034G{j\354\350\224"
+	.ascii	"7\364\262d\232\316\007a\341\262\243\244\256\206 72\372\004.\301"
+	.ascii	"\354/\243\211AI"
+	.string	"+F\024V=8\232\223)*L\354S\204\217\271\256&\311#\265\347#):d\347\3511\220^\311\315\235\224CT\207\375\336\206\222\177\225Y\254V\314\215\245\345\212\004C\225\200\305$\301}\334\350\004\266-o\243m*\372\252{\363p2\227\254\233(\316d\227P\304\020\330\310gu/\224\355*\0216\323Gb\352a@\004\030\027V\025\345Zj\0060\256KJA\276\351\215G-W\"w1R(7\364\307\035\bR\265g\001\234A\221Pt.\177\030\002h\243\241\224\234\336*\032.\024\333RZ4\337K\364\371]\302\003\004\337;*\262O\be\311W\225\333\243fVm\331J\006\013\037\006n\275E\204\336\263\320\352\016;\020\376o\3319\354\302\3120\360Zm\351\252\024I(;\315\343r?\354p\314\3233\002\322,8p\027\310y3\034c@\273\367%\357\204\023\017\204y\023\355B\322\177\222\322\314Uk%"
+	.string	"\213\246c\255\203\353DL\263x\367\311n\312\023\275\364\360j\315\264\2264\020I\313\\\217E\3428\327E\002\303 \204\355"
+	.ascii	"\013\272\222p\325\013XK\311\313\214\251\246)\\~\200\351-\313"
+	.ascii	"\367~\213\260x\332\354\255\334\373\270v\252\013dNj8\031\214K"
+	.ascii	"\352\366\024s\224-\227\331W\031\232\375\200\271c"
+	.string	"\016\324!\271g~\311\337:\0309\322\024\003\272\\\302\0222\032U\220\351\005P\353:\352_\213\3779\232\233\nqgV \246\316\275\247\212Q\324*\214\276\004\020\375\004PuK\327k\024i\311\253\200I\314\233\325!\262\366\262\"\2105Qw|\237/\325\223\2766\226S\301\275\241\215[\316\001\237\274\343\363-rK\245\203cN\222ny_\303\326\334\020XA1\320[\314\001\005J\345C\251\322\221H\251\354\3461\b\340\007\204\204\343\301QN\220Q\fP*\364\3055KoV\257\276\342\234`\t\233\203Bu\203\035g$PTF\357\005\352\212\366'A\373\307\323\314\022C\222\214\224Np\255^\370\254\312.\254R\343\326\225\235\026\005\006\222y*D.\263|x\362\306n[\340\337\227<\343\312L\263\254\257\217shcJ!\002\232\2742\032\345ZW\207Jo^P\221\201#\f#2>%,\276\b\035\r\2555"
+	.string	"4\316\202\243\355\372\300\003%\034\313\346\221\034k\377\344\257\321\300WDre\205nj\271\353\366\017\314\304\267\031Y\354\257\302\334\350\203C@\022\307}B\274\255D\321\026\246\242\267c\344p\306A\321\362)&\227\0372K2\001\306\343/[\251Y\f\\\320A?f\217\260v\361]\217\256\333tepkb\006\343\034!\017\236\\\361T\307\360\213\300\271\005\204\266\304\034Z26\25126\274\005\245"
+	.string	"\203\177\372\027'\371P\261&\301@\251\037=9\013(\231\305uC\345\362\220\002\356\246|F\"\226\240N@E\253\006\352x|\345\r\231\355\335?\242g\206\327\313\016Y\360Th\340H\375\241e\017\214\267\301~\023++\t\td\353P2L\311k\323\002\326NO\321b\204\207\266s\026\360S+n\271\265\340\310\206\274\330XR\257\364KA\232\202m,\0054\357q\327\272\020\006\214\214\237\214\232\254\227\270;\271\333\\\304Y%`\b\025\357D\212\277\351\301\247\235\340\240h\344\350o$\220\200?\326\226\317\030\201SP\027\240\250C\260w\334\007\271I\215K\373\263\r\262~'q\030\214\2439\251Be\235P\304V\201\327\332\2031\b\204\243\007\372\254cRs\362\216\017\364\f\3564t\274\255\006F \bf\310\364W\202\030m~\217\217\307\261\236"
+	.string	"\351y\340\275u\275\376\357\203O\202\313w\360\206u6[\026\024\230\325\034\021.\271?,\200\207S\221u\275\032Rt\322*\235\301=\243\312ND\204\\\nm\t\021\224\227\247-%B\n`\022\316\023~\207\240\202\216\351\b\227\363\307y\240w\023\365\f\237\260\372\201sD\266\332b:\\C\223\357\321g\373\372t\360\263"
+	.string	"\375\261C\320X\207C\345\020\027\330{\300\374q\313\362j/\037g\324\3704 \357p\005\333\343\226\024\302\202\261]}&\372@\\1\004\277\3332~\317\365\274\277\314\004\221\035\031\241x\263\230\331\221\276\315/\177\341$~;\222\376\034<f\202e\334\272\364A"
+	.ascii	"\334\264\"\255\341X\007p>G\231\350\3716\3242\326@ew\311\261%"
+	.ascii	"}\274\221gS,='5\312\343/\027\227\325!\355a\357\023\234a\312\002"
+	.ascii	"\334\355\301\212\365\n\034\254\251y.\314\225/\321`\236\023\225"
+	.ascii	"3\027\273\"\205\001\3432\324;\001rK\353_\253[JN<.\227e\375\301"
+	.ascii	"\006*\022\242\306\320\243\305\224h\017Vj\026\270\375#\016s\351"
+	.ascii	"\241\006\235\225\005\303i\2050\035\t\274M\231d\252\005M\276\221"
+	.ascii	"\362/\033\013K\247\375\254\230\233\302\304e\326MrllN\311\002"
+	.ascii	"\352?\037\351yG\f\006\371\031!\276B\251X\"\210\345\366Q#O\275"
+	.ascii	":qr"
+	.string	"9\370\331\363\001_\224:Y\345\225\004\2005}\314\342E\3146\2079\327\336t\323\225|\301\232\027\2758\231\325\0044a`\007\3649\"\237w\251\021\377\273\360\220wI\305\215\206D\375\237\257\372\211\r%\001\f\375,\362\035;\035F\257"
+	.string	"p9\363u\033\357\334\310\232\324\3252\375\003Ti,\376j\365\037\025\261\236\316\300hhG)\355.st&3K\307\316o\266=\340\270\200\261\2425\211\270\r\342\253K\255\304\266!\001U\303U\222!\016s\345aGw@\020\337P]+f&dQ\313\245n\2256\322\324?\335\264\223\025`-\204\253&c"
+	.ascii	"\240\266\311g\321\350\275\266(\374g\262\214p8I0\272"
+	.string	"\351\203\017\253\\t(\260\257\r\315\244<%\224\311\3660}\201\321\020\214\345c\201\035\265\340\036\034\263%h\r)\350\220\222\206Y\332\036\204\f\301\370\272\211\277b\306\235\273\f\303\023%\007<\033J\3076d\326\362\250\255L8\232\240\255\026\005i\363Y\300\321\177\331\315\205\274\262\222\217\215\324r\320`\016\326b1\2543(z\215\233q\037\367?t\314\206\246'\233}\226\351\202p\277F\336<\023\335\244\003\257\360\316\005h\034\322\237\204\364\353\247\275\2339'\343\267\313\345\207\260S\325oT\304CB\235\2029\372\335\016\305\363`C\276\307l}\350\375cx\322g@\265\242n{$\003\320>\032\267w\2533\277\004\330\355\203O\355\336\216w\305\327y|\354\3507\336\354s\271\307\241\374\333\222\343\2407o}\020\324\026\366\273\214\277\306\361\214\226a\307R\177\222q\327\312I+\273j\364\352q\214\212\243f\367n\217\255Q"
+	.ascii	"~\325\3765\363\306\214}\341\276\364xVQKj\355 \332\3714Ew\351"
+	.ascii	"\245*k\352xD\344qgv\230\230QC\217\237\303\313\342\220l(\373\365"
+	.ascii	"\311V\320?\3127\353\350\340i\263\337s\245\037\007\224\004~\342"
+	.ascii	"\017\277\271\365.\236\277\231[#\220LT\366\253n\022\353_\321w"
+	.ascii	"\226\347\036\333\3709.\275k\202\330\201\365\355\310\257)v\351"
+	.ascii	"\256?:\247\2369\325\355\017|\213\001"
+	.text
+	.section	.gnu.lto_.symtab.a8a1ee2eba52e30c,"e",@progbits
+	.string	"cmsx_menuVtxControl"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"vtxSettingsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"vtx58BandNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"vtx58ChannelNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"vtx58DefaultPowerNames"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"vtxCommonSetPitMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"vtxCommonDevice"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"vtxCommonSetPowerByIndex"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"vtxCommonSetBandAndChannel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"vtxCommonGetPitMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"vtxCommonDeviceIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"vtxCommonGetDeviceCapability"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"vtxCommonGetOsdInfo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a8a1ee2eba52e30c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,5331 @@
+	.file	"bitarray.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/bitarray.h"
+	.file 5 "./src/main/common/bitarray.c"
+	.file 6 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	bitarray.c.09691840
+	.weak	bitarray.c.09691840
+bitarray.c.09691840:
+	.long	0x215
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF788
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF763
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF764
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF765
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF766
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF767
+	.uleb128 0x3
+	.long	.LASF769
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF768
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF770
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF771
+	.uleb128 0xd
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF772
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF774
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x5f
+	.uleb128 0x9
+	.long	0x87
+	.uleb128 0x3
+	.long	.LASF775
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	.LASF776
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x12
+	.long	0x87
+	.uleb128 0x9
+	.long	0xa4
+	.uleb128 0xe
+	.long	.LASF789
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xe
+	.long	0x72
+	.long	0xd5
+	.uleb128 0x7
+	.long	0x72
+	.uleb128 0x7
+	.long	0x58
+	.uleb128 0x7
+	.long	0x98
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF785
+	.byte	0x48
+	.long	0x58
+	.long	0x13d
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x48
+	.byte	0x33
+	.long	0x13d
+	.uleb128 0x1
+	.long	.LASF778
+	.byte	0x48
+	.byte	0x43
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF779
+	.byte	0x48
+	.byte	0x51
+	.long	0x98
+	.uleb128 0x4
+	.string	"ptr"
+	.byte	0x4a
+	.byte	0x15
+	.long	0x142
+	.uleb128 0x4
+	.string	"end"
+	.byte	0x4b
+	.byte	0x15
+	.long	0x142
+	.uleb128 0x4
+	.string	"p"
+	.byte	0x4c
+	.byte	0x15
+	.long	0x142
+	.uleb128 0x4
+	.string	"ret"
+	.byte	0x4d
+	.byte	0x9
+	.long	0x58
+	.uleb128 0xf
+	.uleb128 0x10
+	.long	.LASF780
+	.byte	0x5
+	.byte	0x50
+	.byte	0x12
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	0xb0
+	.uleb128 0x8
+	.long	0x93
+	.uleb128 0x11
+	.long	.LASF790
+	.byte	0x5
+	.byte	0x33
+	.byte	0x36
+	.long	0x7b
+	.long	0x163
+	.uleb128 0x5
+	.string	"val"
+	.byte	0x33
+	.byte	0x45
+	.long	0x87
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF781
+	.byte	0x2e
+	.long	0x184
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x2e
+	.byte	0x28
+	.long	0x184
+	.uleb128 0x1
+	.long	.LASF779
+	.byte	0x2e
+	.byte	0x36
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF782
+	.byte	0x29
+	.long	0x1aa
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x29
+	.byte	0x28
+	.long	0x184
+	.uleb128 0x1
+	.long	.LASF779
+	.byte	0x29
+	.byte	0x36
+	.long	0x98
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF783
+	.byte	0x24
+	.long	0x1cb
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x24
+	.byte	0x25
+	.long	0x184
+	.uleb128 0x5
+	.string	"bit"
+	.byte	0x24
+	.byte	0x35
+	.long	0x30
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF784
+	.byte	0x1f
+	.long	0x1ec
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x1f
+	.byte	0x25
+	.long	0x184
+	.uleb128 0x5
+	.string	"bit"
+	.byte	0x1f
+	.byte	0x35
+	.long	0x30
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF786
+	.byte	0x1a
+	.long	0x211
+	.long	0x211
+	.uleb128 0x1
+	.long	.LASF777
+	.byte	0x1a
+	.byte	0x2a
+	.long	0x13d
+	.uleb128 0x5
+	.string	"bit"
+	.byte	0x1a
+	.byte	0x3a
+	.long	0x30
+	.byte	0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 26 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF762
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF791
+	.long	.LASF792
+	.long	.LASF793
+	.long	.LASF794
+	.long	.LASF795
+	.long	.LASF796
+	.long	.LASF797
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF798
+	.byte	0x3
+	.long	.LASF799
+	.byte	0x3
+	.long	.LASF800
+	.byte	0x7
+	.long	.LASF801
+	.byte	0x1
+	.long	.LASF802
+	.byte	0x1
+	.long	.LASF803
+	.byte	0x6
+	.long	.LASF804
+	.byte	0x6
+	.long	.LASF805
+	.byte	0x7
+	.long	.LASF805
+	.byte	0x6
+	.long	.LASF806
+	.byte	0x3
+	.long	.LASF807
+	.byte	0x6
+	.long	.LASF808
+	.byte	0x6
+	.long	.LASF809
+	.byte	0x3
+	.long	.LASF810
+	.byte	0x3
+	.long	.LASF811
+	.byte	0x5
+	.long	.LASF812
+	.byte	0x3
+	.long	.LASF813
+	.byte	0x4
+	.long	.LASF814
+	.byte	0x4
+	.long	.LASF815
+	.byte	0x3
+	.long	.LASF816
+	.byte	0x3
+	.long	.LASF817
+	.byte	0x3
+	.long	.LASF818
+	.byte	0x3
+	.long	.LASF819
+	.byte	0x7
+	.long	.LASF820
+	.byte	0x2
+	.long	.LASF821
+	.byte	0x2
+	.long	.LASF822
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF775:
+	.string	"size_t"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF778:
+	.string	"start"
+.LASF758:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF757:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF694:
+	.string	"true 1"
+.LASF790:
+	.string	"__CTZ"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF471:
+	.string	"__P(args) args"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF756:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF733:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF719:
+	.string	"NULL"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF725:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF788:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF771:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF732:
+	.string	"_PTRDIFF_T_ "
+.LASF700:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF767:
+	.string	"signed char"
+.LASF773:
+	.string	"uint8_t"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF759:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF785:
+	.string	"bitArrayFindFirstSet"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF751:
+	.string	"__INT_WCHAR_T_H "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF777:
+	.string	"array"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF693:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF769:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF746:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF781:
+	.string	"bitArrayClrAll"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF784:
+	.string	"bitArraySet"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF721:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF783:
+	.string	"bitArrayClr"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF770:
+	.string	"__uint32_t"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF734:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF729:
+	.string	"_T_PTRDIFF_ "
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF727:
+	.string	"_ANSI_STDDEF_H "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF742:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF718:
+	.string	"__need_size_t"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF780:
+	.string	"mask"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF739:
+	.string	"__wchar_t__ "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF728:
+	.string	"_PTRDIFF_T "
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF762:
+	.string	"BITARRAY_BIT_OP(array,bit,op) ((array)[(bit) / (sizeof((array)[0]) * 8)] op (1 << ((bit) % (sizeof((array)[0]) * 8))))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF744:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF461:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF765:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF692:
+	.string	"_STDBOOL_H "
+.LASF753:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF730:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF695:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF736:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF763:
+	.string	"unsigned char"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF741:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF735:
+	.string	"_GCC_PTRDIFF_T "
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF772:
+	.string	"char"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF749:
+	.string	"_WCHAR_T_H "
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF726:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF761:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF752:
+	.string	"_GCC_WCHAR_T "
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF779:
+	.string	"size"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF731:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF766:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF717:
+	.string	"__size_t "
+.LASF748:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF776:
+	.string	"bitarrayElement_t"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF789:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF743:
+	.string	"_T_WCHAR "
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF745:
+	.string	"_WCHAR_T_ "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF747:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF768:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF738:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF740:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF754:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF750:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF764:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF755:
+	.string	"_BSD_WCHAR_T_"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF774:
+	.string	"uint32_t"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF782:
+	.string	"bitArraySetAll"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF696:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF760:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF737:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF786:
+	.string	"bitArrayGet"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF0:
+	.string	"./src/main/common/bitarray.c"
+.LASF812:
+	.string	"long-double.h"
+.LASF814:
+	.string	"stubs-64.h"
+.LASF817:
+	.string	"wchar.h"
+.LASF796:
+	.string	"/usr/include"
+.LASF818:
+	.string	"stdint-intn.h"
+.LASF819:
+	.string	"stdbool.h"
+.LASF806:
+	.string	"libc-header-start.h"
+.LASF822:
+	.string	"strings.h"
+.LASF801:
+	.string	"bitarray.h"
+.LASF794:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF803:
+	.string	"string.h"
+.LASF810:
+	.string	"timesize.h"
+.LASF799:
+	.string	"stdint-uintn.h"
+.LASF795:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF797:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF807:
+	.string	"features.h"
+.LASF816:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF820:
+	.string	"locale_t.h"
+.LASF793:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF800:
+	.string	"stddef.h"
+.LASF813:
+	.string	"stubs.h"
+.LASF792:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF815:
+	.string	"typesizes.h"
+.LASF808:
+	.string	"features-time64.h"
+.LASF811:
+	.string	"cdefs.h"
+.LASF802:
+	.string	"bitarray.c"
+.LASF809:
+	.string	"wordsize.h"
+.LASF821:
+	.string	"__locale_t.h"
+.LASF791:
+	.string	"src/main/common"
+.LASF804:
+	.string	"stdc-predef.h"
+.LASF805:
+	.string	"stdint.h"
+.LASF798:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 T-\002"
+	.string	"\204\003H"
+	.string	"\006"
+	.string	"\373\373\257\366\005\002\002"
+	.string	"\002"
+	.string	"\001\341\277\333\262\t\004\230\201\330\304\006\003\310\253\251\326\013"
+	.string	"\004\352\326\272\202\005"
+	.string	"\005\215\251\321\352\001\004\002\001\002\001\002\001\002\001"
+	.string	"\004"
+	.ascii	"2Ks\027\272\330\260\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 v\355\001"
+	.string	"t\002j"
+	.string	"\006"
+	.string	"\002"
+	.string	"\003\001\001\002\003\002"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\001\003\001\200\f\001\001"
+	.string	""
+	.string	"\t\004\005\003\003"
+	.string	"\002"
+	.string	"\002"
+	.string	"\b"
+	.string	"x"
+	.ascii	"B p\317U\354\034\025\354\346R\032\310y\003X"
+	.text
+	.section	.gnu.lto_.inline.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`\311"
+	.string	"\r\006"
+	.string	"\022\n!*`U\223\016\024\003<EE\377@\240Y\004\364\220\307\371\230\240q\013\200=\332Z/\333\026EQ\205ed\035c\326\266\215\020\271S\343\037\332\201p\032Wx5\366.|u\0030\211\274\tg\225<0\001\223V\306\307\261\250$\250X7\"\232\321T.\206\241\255\r\337\326\366[\233\373\007\357Od\246\342\373\2509i7y2\223\272\217\372\352\357\254\201{\261>\34623\243\367\273b\213\330Q\253%3\005\037\215\224\027"
+	.ascii	"\254\202?\002\310]\261.\275\030h9\330,\001\3708|\2649\310Y\033"
+	.ascii	"cU3<\232\373 \030\230`\007\341\006\245\001\321%\341CUm\264H\271"
+	.ascii	"\031\006\313\255<\355*\300\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \3465\003"
+	.string	"\242E\020\030\260%\351\f\013\324;\220$y\3120,p\005x\241\023\243M$\221I\006[\231/\303IU\3258H\201_\f\300\335\324\255\352\t\206\033\261\303\356\360\036u\006/\027\236\202$u\222\004\211<7\033\004\r"
+	.string	"A! \346\370O\213\366\230\241\272J\300)\201B`\230Q\fQ\254\220\315\361\300\326\\\306\337"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\205\004\001\232\004\002\232\004\003\230\004\004\230\004\005"
+	.ascii	"\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \247\215\002"
+	.string	"D\003\225"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	"\006"
+	.string	"\002\300\005\300\007"
+	.string	""
+	.string	""
+	.string	"\001\002\006"
+	.string	"\001\002\020"
+	.string	"\002\003\002\274"
+	.string	"\260\204\200\370\267\004\004\005\003@\200\004\007"
+	.string	"\001\002\007\0051cO3"
+	.string	"\n"
+	.ascii	"\177d\r0\231\256\231\374\304\357\f\325\\QG\310\331\272\263\005"
+	.ascii	";\374\007P\004"
+	.text
+	.section	.gnu.lto_.lto.1be836e42c7ef60c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bitArrayGet.0.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`\n\001-\r"
+	.string	"\026Z[B\020\221\223\016\370\223\213t\215\310\271hP\202b\036e\321\302y\021\366\017\351J\f\322\205\365\017\377Y\373\323\215\276\033.wX\253\252\352# L;\276\3601Z\b\0055\007}\016m\335\032!{\223$S\nI"
+	.string	"B"
+	.string	"G"
+	.string	">a\024)\313d0\200\314\030\031-27\005\035\311\354\272Y\300\263\313\f\362\354\3326\324 U\325"
+	.string	"\226\3430\301Z\261#s\323\016\302*\243\252\266\n_$^\334hqI1b\0202\263\330\342\322\301\275\333&h+\241\365\206-\366c\031\333\343\031\273s,\347\330\354a\261c\337\261\316a\257\013\373\013\213\307\372\003\213\001B#\223C\313&k8\027\"\332\246ZO{\261\204\2769E\3123\"\345d\302\324D\310\354B\256\327\204\020\3336\b,\362:\1777`\203\365R\263\270\200\222\205\250-<;wk\360\360{~\335\253\022\227;\343\341\377\367X\215\360\361f\335\250`\253\316\245y\235\373\227\216\325\315\n\266\352\201I\344\321n)\370\017\255\257\314\314>\246\001(\222\311K\302\340\301\202\022\007%$\240"
+	.string	"\256#\020\006\321\351$B\221L\264\023S\251d\032i'$QI\033\235*h\240\0035Q\230p\322P&\323I\363l\351~\036\242\362\225\326(\217\363\317\315\202\221\335\235s\0029X/\330\263\367\021c/@\263\n\025"
+	.string	"5W\214\245\213\314\325"
+	.ascii	"\305\242\351\240\324vX\203\f\217fnR\272\245fmbj\017\232\373\373"
+	.ascii	"s=\345B\0032\326\001\373\235\032\005\307\224\247Z4\t\363\t"
+	.text
+	.section	.gnu.lto_bitArraySet.1.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`\n\001\r\r"
+	.string	"\346\030XB\020\221\223\016\340\256Y\032\300\200\374\370\326A\3408NJ\300\222\213\\\315\320\322\360\004\321'?\240\217>dZ\030\322W\0036\334U\225\317P8c\211\363\030\255\342\203\273\363j\036D\263D\032\331$\311\224\002C"
+	.string	"@"
+	.string	"F"
+	.string	"\330Z\205Wpf\271\340"
+	.string	"\231\247\02702;\005\025\271\374\332\371\303\362\273,\300\362+\327\332"
+	.string	"\301\320\301\202\344\202#3\263\2230g\344j\2730V2\245\0305\0172\263X2mp\357\266\t\332Fhm\n\375\2515\213\315A\354\306-6\206\330\013\261\232\207\265\020\373\020[U\330\037\213\307\032"
+	.string	"6\302\343%SCJ&Q/\306\211\266\346\264G\221`\347\026\234[B\212e\206\250\001\341\362CP\035\206\304\001\003h\214d\0168\304\302\376N \206\364\241~\251\200r\231\250)\334\031@\3409\377=JQ\2712,\037\357\021\212\315}\223fT0\325\347\302X\3307\277\313hf\005S\375\3400#1G\333\245\340E\264\25623\003\"\220\311;\302\300\301\202\222\006%#\035\217\327O\307\202g\333<\"\220Iv\242\205B\332';\001yB\331gC\311:\006\252M\220\260e\"M\3332N\227\256\362\247>\017(\225\257\364z\201\022.\335\320\274\372u\220\030R\007\353\232\213\330z\031"
+	.ascii	"5W\214\245\213\314\276\023o\303WoB0\0237\250`\b\354\030C\235"
+	.ascii	"\231\221\224F\211\331 T\023d\25183#\371g\370\3105\214\031f\003"
+	.ascii	"\341;5\n\216\361\251\246\303\t^\\\223\f"
+	.text
+	.section	.gnu.lto_bitArrayClr.2.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`\032\001e\r"
+	.string	"\246YZB\020\221\223\016\370\336\313\357\200\n\234\300\341\215\223{\3334\3552+\257\016I\241\210%plk\370\317\366\315\332<\322W\0036\334U\225\317P8c\211\363\030\255\342\203{\372\325\345b\304\022id\223$S\nF"
+	.string	"A"
+	.string	"G"
+	.string	"/$\306\326%l\202d\030\013\016\220\211b\321\"3\225\240\"\230_S\366\270\3740\013\270\374Jje|\\\350\2540\251nd\346v\020&\031I\265S8;\261\244\0307\0162\263xb\321\340\336m\021\264\205\320\272C\231=\2525\214\335A\254\346\030\233\203\330\f\261\330\303n\036\366B\354C\254ea\177,\036k"
+	.string	"\231\215\216\031\231\031V4)\363\\\214hk\255\375\t\022L\031\005\3111!\3152=\314<\300\374\016X\017\027\361u\220\231\022\215\001\207\\\234\277\017\310aj\251UP@\301D\324\023n\f.\370\316\177\227^,\027\306\345\343]\"\241\335\267\251F\005W}\356\213\213s\355W\225jVpU\217\r1\022q\264\251\024\374\207\326Vf\243\220\311;\262\240\201\202\022\006%#\236\216W\220\247\302\247\353>\243\220\311v\302\211D\034h;\t}D\033\250C\331<\005\312I\210\320m#\216\3536-\225\266\362\250>\0162*_iv\002!|\242\201\335z\366\217\032\246\226\315\261\353\233\203\250L.\001\032"
+	.ascii	"5W\214\245\213\314\276\031o\303W\317B0\026n\3604\004v\274A|\f"
+	.ascii	"wfZRj\245f\215`\215\221\245\354\314\264\344\237\366+\3270f\230"
+	.ascii	"\r\204\357\324(8\306\247\232\016'xqM2"
+	.text
+	.section	.gnu.lto_bitArraySetAll.3.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\365\b"
+	.string	"\006\021?:0\345(\035"
+	.string	"\360\347q\301\212T\023\254\001\206kY\205L\002\t\016\256\035\\X\215\206i\255mc\202\371\247\376\034\006-uB!\344Qw@~\243 c(L\310 \233\310\235R,"
+	.string	"/"
+	.string	"*"
+	.string	"\217\332\013\262G\177\266\353\200c@\306c\245fw\245\222\374;\374\374\253\\ \245B\035\006D\354\256aJ\005r\353m+\330\236\260=\023\033\013\007\263\373\361\n\260\255\350Rb\373\233\255\"\03581\\\022\332\243\206t\016\355\243<\345;+\343\004\273\253\230\226\335\311\340\005\355\321\363\\\026'-\r\335p\204\252\177\335/\031T\333\342\004\237rB\207\242\314\231\320,\004`O\024\324\021\373\330\356\256ue\177\376z\326\017c\241\013Q\t3\307\001\242\301\363\340\341l\f\242A\233\323\307\363>&\021\205$u\243Q\007\222$\321g$A^In\020\334U\204<i\352:Ons\217\255\256\034\003\f"
+	.ascii	"5W\214\245\213\314\276\357\3336\334\322ua\255\205\261A!\270\f"
+	.ascii	"\204\232\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_bitArrayClrAll.4.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\345\b"
+	.string	"\306\220>:0\345(\035"
+	.string	"pw@\2455<\361d8\205\327\362Q\016`\207,\332\301\205\325h\230\326\3326&\230\177\352OR\220\215N\225\212?\266\301\034P(\217T\341\023V\273\311\226)\005,"
+	.string	"-"
+	.string	"+"
+	.string	"1\273\201\346\321\237\335B\360\030\210\001Qq\355\256\204%\377\256\237\377\224\013\240R\247k\300\304\356ZQ)\221\033\336\366\202\355\n\333/\001\332k7\344\025`Y\261\305\304\3667\266\272::5Z\024\331\243\316t\256\366O\216\362}\265\361\202]\025\314\312\356tpC\366\350yM\363\321\205\305\001;\034\025B\206+\2641Lz\224\025>\340\311\032\213\314*"
+	.string	"{\236\024\222\330\307vw\rU\366\347\017\277\3725\022\214\004\240\214\020\t3\007B\342\301\023\341\341l\007\321\237\315\304y\036W\nY\310Q'\022u\0379\nq\"\371\361HrKpw\001\362d\251\353<\271\231{l\241\312\001\f"
+	.ascii	"5W\214\245\213\314\276\355\333v\334\"ua\255\205\261A!\270\f\204"
+	.ascii	"\232\035\356\360\242\235d"
+	.text
+	.section	.gnu.lto_bitArrayFindFirstSet.6.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`7\007\335*"
+	.string	"\272L\234\020E`^N:\367\220Td\243GV\260\320a\373>\260|2<\224\007\017v\250\234\005\362\240"
+	.string	"\373\313>N\034V\327\331\213\332N\267\200;:K\374\320\221\320\315\247\211\nJ}\320\032\272\3761\244\021i\204\020\271\223\f\370"
+	.string	"\346"
+	.string	"\362"
+	.ascii	"\037\306\244\230\331`\374\022\275T\343\021\310\335\275H\017\351"
+	.ascii	"O{\224bN\3622\335\362J\223\307 w\367\336\004?yC\372=R\315E\006"
+	.ascii	"\022\321\355ZK\242\301\216\224\265\337r\300"
+	.string	"$\272]G#\206\364\347\331H\3352\037\313\263h\035Y\343E\367\026\231\003w/r\001+H\17722\275\225\253i1/M$\222\257\037\303\212]\362\356\275Q\301\007@\177\232\007\242?\373\bS\330\273\211<\253V\353\353OM}\350i\266\325\342\377\276\266\276~\370\343?\263\267x\231\273\204+S\222\\I\264\252\223\0210\261\247#\326\314|\267\363\n\223+ZTiM\311\035\"`?~^y\fl\230\334!\002&v\323\024\020E\314M\350\253\313D\020\346M\224\323\331\260m\3768g\355\312;\331y\215\231\023\316\354\270r\267[\343\027\227\265\276\n\367^\2668\276\300\316@g\346;\314\214\202\031\035\023 \310\206\266\017\337\355\277$\232\335\265}\230\221\\\266\313\230o\336{/w\021fk\271\300j\371i\265L`\265\354\024\\-71\035\356\274\244\364-\377\200\267\235\223\316\345G:\362?Z-\033\001U\313"
+	.ascii	"T\313E\252e\"\325\362\320\317\262\220\265\034\244Z\006R-\257"
+	.ascii	"\252\345\237jY=\3339\265\226}\3262j-\237\251e3\265\334\326\262"
+	.ascii	"\365Y\276\001\224\317\232$1\367"
+	.string	"\352\330\363s\353\3161f\207\373\331\376\2667\363\351\312\234Z\342\362.\034\303\356.\307\274\262\213\217\341/}[sS\356\275+k]\266k*\021C\252\345\3319)\324>\316\305\311`\231\310\373\325@\256\214Z\336O\256j\"\305\177\343+\315\340\260\332\326\220\220\270\030\027\314\353O\313\254\305\367\362/\007s7^mW\230\261\020:\332`\2307\354\207\223}\242\220\246^\323[\241j\377\372D(f\253\215\342\025\365\204\222\313\246\036\262\276\346\323QU\241\307\321\324\247\373y\020\305\352\272z\313&\301\322\216'P\322\fS\225+5S\177I<\343\242\263\013>\371\016d\303\317\275\007\221L\335\360fot\222&\026\352k+eM\316\351\316\341\tr\017\236[\346 \334\234\354\311\343\353\317=8D\333\327\326M1\214_\227\341D\272\204\017\003\375\211v/\215c@I2K}\270\007\317\036:\200.\265]\022\3754\375"
+	.ascii	":\240\317>\361\212aW\3769\222\312\306[s\214\323]\306J\235\324"
+	.ascii	"%\326\322tY>\214\252\331\244\025\245>\233\331G\255d\236\315\240"
+	.ascii	"\335fw\035\"\224\356~Qoh\367\370</\321\001m\333\254C\324\243"
+	.ascii	"\222\324o{\260\217:\251m\035\342\031\215\003Q\244~\367\237b\030"
+	.ascii	"\227\335c\233L;\352\207y+\246^\264\n\254)+S\230\325\242M\260"
+	.ascii	"\250\352\026\317\252\022v\325\214\024Xf\226p*\013\353d\006\016"
+	.ascii	" 4\210\360 \002\003(\243\223\251\240dL\t\205SY)JD\261\270\262"
+	.ascii	"\262\272\242\212b\221b\312*\212J\210\025\005\265\304W-\252\204"
+	.ascii	"QYWW\302\250\0259\274y\273Hz\227\366\366\203z\303A\323\3639\365"
+	.ascii	"\225_\247\24059\t\264\221Qs\205as\255]v$\271\033]~]\3061\322"
+	.ascii	"\204\244\301F\201\366f25\260\215I\rl\013g\224f\354\200"
+	.string	"]ah\373\020\317t|\251A`\007\373x\304\263d\036\273kwK6d97D\332R\023\005v\332\306\327\241\331A\203\272@\033\231\001\264SQ\0235\200\247.z\233\0175\221P\017\265oY\324;\352\264\205\244\030%\325<\211\210\003BDS\240\371rO\335\201\254\253\267\206\370@\212\371\272l\315\203\344\226A\375\270\017A\335]\214ch\256\307\217\035\033\264\t\254\375k\240\200\226\250A0\005\025s\210(\020\031%I\f\351p\002\2211\263n\021\200AT6M*[c\365\b\306x2\275\277M\013 z+\266\307\013\b\237\315\220\0071\273\303oI\276\"\037x\323\232\f\363\246\267M\036\337\350\203?\r\r\374\330\033W\333)\263\307\225\347;X'\t\261\364\017\220\203\334\255dq\200\225\301\021\221>Ao\355K\261\332\236x0+$2c\r\026\270\013\212\343\375\233\357\003X\204\361U3Jd\026hX\006"
+	.ascii	"\243\337\t\001;d\241\3641\006G\367\025\340\315\022\026\005\203"
+	.ascii	"\306\336\234r\" \006D\2064\004\343\231Y\023.\310\001F*\360 *"
+	.ascii	"F%c\310\270\270U\350\344\377\005\331\334\201\212\320y\245|\362"
+	.ascii	"\341 1T+\002d:\241[~\244\2754\265[\032Z\214\357y\243\005\006"
+	.ascii	"\203\2478\237\024\002w\3326\305\235`%ld@\313|\016\032\005\232"
+	.ascii	"Uvo\245Q\336\342\217\331!\307\367\353C\203jn\301\230\013\016"
+	.ascii	"U(\353%\003\310z\200>\207GC\004\216w)e\323\001\006\220\262\006"
+	.ascii	"q\312ZKl\31380q\373\327\306S\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \366\245\003"
+	.string	"D\005\362"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\b\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\001\177\t\002\177\n\003\177\013\004\177\f\006\177\r\001\007\177\016\377\037"
+	.string	""
+	.string	"\200\220\200\001\b\177\017\003\003\006D\003\004\005\007\243\267\222\306\002\001\244\022\003\005\007\231\300\227\241\001\001\304\032"
+	.string	"\f"
+	.ascii	"\2552\220f\030>E,\317\364b\004\303e\017\320\016|\016|\016|\016"
+	.ascii	"\274s\255\211\007"
+	.text
+	.section	.gnu.lto_.refs.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.1be836e42c7ef60c,"e",@progbits
+	.string	"(\265/\375`H\t\0355"
+	.string	"\372_0\025G`^R\007\347I\307\202l\356bx\034\337\013=Y\366&\336\243\2160\322\236\003\330\361\221\247h\030\330FN|\311\325\356\024K@\223(`\350\213 ,/\301\226\231UT\2460F\354\205*\301-P~\340n\327&2\245(\0012\001M\001\361\377?\275\261\365\177\247\370\370o\204Q$aG\363t\374\237w\2136\214V\260\217\223\021~z'@\034\3712\255`#/Y\230Wo\214[\277z\247\362\2502\333\370\337\377w8?s\270\250\275e\324\2678\027\217\233\314\273tzL\306\277\005\024\366\304E\226\321.\241\366\fo\262/\257\017s\354\304[=K'\330Z\027\027"
+	.string	").7\340\266z\342\314T\201\311hs\320\222\345\207\211\231WX<\224\304\212\312X\272]\212Oqf\356\265\001\377\326\177\314S\271\330\316\2402\352T\274\212\307=\277\322\276t\255\336\271\3613\377\343\240]\023\216\217\255\214\"\360\001)ZA\365\351uw\320\231\217\320Ym\357\245A\336K;\366\001\251\352\002\206\\\300\211n\027\n\340A^\306\351\245\273\3558O\332\355[\320\264\274t\335ne\204\t1\335\255v\373\223nG\273\033\256\273\331\272\333\331\335\315\356F\353n3\335M\246\273\261t\267Vww\351n\257\356\346\352n\005\335\235\245\273\231\335-\324\335d\335\255{>\237\317n\327\320\355K\335\272\247r2\352e\374\013\310\323h\022\253\2715=\367\342a\355_<\366/Nf\227\374\326\rh\251V\243\314\333'\223=UM\332W\226X;\231n\007\021|\314\347\337"
+	.ascii	"\212c\252\215VF},\273\030\037\323>\346a\332A\204\366q\177\312"
+	.ascii	"\177\354c\350\177\321\235\b\310\235\210G\fIQ+E\333\217\252\203"
+	.ascii	"\361.\265\355\210\227TF\333m\027T#\213\034cF\333]5w\247_<\376"
+	.ascii	"\377\024O\374`F\037\357u\377x\316\023t7\372\271\2405\377RG\342"
+	.ascii	"\244d\224;\342d\264\273\021|w\267\205\377\020\257\253<\362^f"
+	.ascii	"\261\345A\305J\344\313T\"y\037/w<3\310\377\353\302m.~\374H\241"
+	.ascii	"w\225H\365\213mo\374G\336\307\305\243\277\362\370n\025[\336\313"
+	.ascii	"T\266/\023F\362\336X\211|\367[\325]\376\2730\222\227\025+\377"
+	.ascii	"e\026\221B/\023n\243\216X\225\361\324\230Xn^\367\243\nd\271\360"
+	.ascii	"\361\354\215a"
+	.string	"\007\373o\267\234\376\350\361\277\362\237\n&\002s\223\264`\306\263(]\322\215[\347q\303h\005\357b\343\237\275N\340\026N\377\316\277\001\241\3656~ m7g\266\231\024\\\235\227Jk\t5\246v\016S\273\263\023\034\320\231\225g\221\214v\\\347b\\vQ\264\177cQlt\376K\325C\243\300<xdcg\027\235\202\231\237\333v8kjd\313\214\346\347\351\201C\215\223'\2212\2637_j\347*\252?\351\265\265\307is\270\\\323\347\333\345KQ\270\363\245\352\355\337d\257\347\n\324\025\2649\355p\355v\034Dh6j\026\224f1\243^\247\201\222e\302\332\336\234N\367\016@\023!L\254\037j3X\352@\"3\352r\232Mv\302\306\206\233\214\272[\213\371$\327\336\206\370\233v8\335\273]X\225\020\345\0167\335;]W\263\307UF;O\251\235\241T\027K\223\306\331<\304/\345VI\250\034o"
+	.ascii	"\342\274Y\205a\323\316&\346J\250\300\220d\324\327xWJ\266\204"
+	.ascii	"\nHF]M/\350\267\364\020\223\243\3464\247\323\354\252\352K\307"
+	.ascii	"\257\2519\032ii\336\034s\205\246\355\240j\325\332\233:4.0m\031"
+	.ascii	"u4\376\365\203\344\307\022\313\301rfVi\30615g\004\r-\367_\365"
+	.ascii	"u\225\244\006\226\346K\315y\225\225\271\031U\350\215k\254\264"
+	.ascii	"\245M\272\234\302\314\332\3154[\317\224\265\260\354\017\211]"
+	.ascii	"\203M:\340\032\024\256\301\037S\214\244\027\302\244\037\023#"
+	.ascii	"2\374~<,\323:T\342\221\301*\375\326 +\f6\245\370\375~\272E\003"
+	.ascii	"\026k\220\3102\371\200*\232\204Jk\320Gdj\362\021\020\n\233\326"
+	.ascii	"u\270\352^\f\211-\330\341\252[\221\004\024\242,\220i\t\270\224"
+	.ascii	"\262@\021,\0231\310A\305\032\3440$\024^ \n3\b\205\027X\240\b"
+	.ascii	" \2420\003\013\024q"
+	.string	"\240\207.\200D\037;\034\022}=\302\341\020\303\217\207\005v\270\300\006S\364\264R\220\b\\\201,\324\206p\304\340\b\t\206\256\221&\024M(J\033i\202\221\321\204##\265\217\214r\354\017(#\310\224\262?v\005.\001\205\033x\354\317\301\003v\r6\251]\004\001\311H\302\221\204\242\006C-AB\006\004$@tP\225\032\304H\"\022\223\330`\n\337:\\Z\032*\371\326`\322\222O\211\310\344k`\240\343\\\215\253;ord\227ukn\311hF\346f<\237\317'\334\1771#s\306\221\247:#\333\235\310\235(H\347\314z\213)\232\265\344\247|\3144\362S\226Z\320\226\251\311\321\353\3165:K\345(\254(\255\317h\206\3126<>\220o\344\332\345O\371\211\213\022g\247\251\266\037H\375\031\200\247\250q$F\2444DfhDd4I\322\001\220\002\221!Bz\021\240\245\242H*j\222Be:"
+	.string	"\tq?@\362\277\361\341\003#?\351\374\245\204\205\036g\363!\353\233+\237\221oFe\315'9F\370\200\335us\035"
+	.string	"\223\314\360)'$y\305\002h\004\243\265\355\r-?\262\3463\224\325\r(\202\020\322\3269\215\225\002\345\245\255\256w\034\201\201\364\211\337\"\210\272\0240~\216\372\242ZK\333\n\214\020\254\007\242\213@\3330\024\256\272\027\221\336\374\364<\332\216\253\024K\3214\345g\027\013\236\210OP\334\213qh0\335P\243\211\277\276H\327bZ\210`\324B\215\037\2711(xS\357\370+\337\f!t\323\257Q\307 \026\243wYFB,\204\n\207\227\211\024/\n\246\237\250\005\334$\233% \346\335\rP\034\253&^\037TY\204/\373\255\312\025\234\324\337\333\204VQ\034\036\024\2638 \216\207\312\030[\270\343\030\345P\365u\223>\371\f!\033i\306D<\302\370\001\275O\324\350\244\216b@~\325<\323y\337>\030\037\315\017\027\334c\017>\037\317\276\b\307\300\366.\345kx\232 \274\022\355G\316\027<\342p\314\361\234\371"
+	.ascii	"\236\313\007\f\224\017\027U"
+	.text
+	.section	.gnu.lto_.symtab.1be836e42c7ef60c,"e",@progbits
+	.string	"bitArrayGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332"
+	.string	""
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"bitArrayClr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"bitArraySetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346"
+	.string	""
+	.string	""
+	.string	"bitArrayClrAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.string	"bitArrayFindFirstSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.1be836e42c7ef60c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
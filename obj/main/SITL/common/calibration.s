@@ -0,0 +1,10064 @@
+	.file	"calibration.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/time.h"
+	.file 4 "./src/main/common/maths.h"
+	.file 5 "./src/main/common/vector.h"
+	.file 6 "./src/main/common/calibration.h"
+	.file 7 "./src/main/common/calibration.c"
+	.file 8 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	calibration.c.212665eb
+	.weak	calibration.c.212665eb
+calibration.c.212665eb:
+	.long	0x4b0
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF1460
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1406
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1407
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1408
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1409
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1410
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1411
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1414
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1412
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1413
+	.uleb128 0x4
+	.long	.LASF1415
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x53
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1416
+	.uleb128 0x10
+	.long	0x79
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1417
+	.uleb128 0x4
+	.long	.LASF1418
+	.byte	0x3
+	.byte	0x1e
+	.byte	0x12
+	.long	0x6d
+	.uleb128 0x11
+	.long	0x79
+	.long	0xa7
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1461
+	.byte	0x14
+	.byte	0x4
+	.byte	0x67
+	.byte	0x10
+	.long	0xf6
+	.uleb128 0x2
+	.long	.LASF1419
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x79
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1420
+	.byte	0x4
+	.byte	0x69
+	.byte	0x13
+	.long	0x79
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1421
+	.byte	0x4
+	.byte	0x69
+	.byte	0x1b
+	.long	0x79
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1422
+	.byte	0x4
+	.byte	0x69
+	.byte	0x23
+	.long	0x79
+	.byte	0xc
+	.uleb128 0x5
+	.string	"m_n"
+	.byte	0x4
+	.byte	0x6a
+	.byte	0x9
+	.long	0x4c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1423
+	.byte	0x4
+	.byte	0x6b
+	.byte	0x3
+	.long	0xa7
+	.uleb128 0x9
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1b
+	.byte	0x5
+	.long	0x12d
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x5
+	.byte	0x1c
+	.byte	0xe
+	.long	0x79
+	.byte	0
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x10
+	.long	0x79
+	.byte	0x4
+	.uleb128 0x5
+	.string	"z"
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x12
+	.long	0x79
+	.byte	0x8
+	.byte	0
+	.uleb128 0x18
+	.byte	0xc
+	.byte	0x5
+	.byte	0x19
+	.byte	0x9
+	.long	0x146
+	.uleb128 0x19
+	.string	"v"
+	.byte	0x5
+	.byte	0x1a
+	.byte	0xb
+	.long	0x98
+	.uleb128 0x1a
+	.long	0x102
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1424
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x3
+	.long	0x12d
+	.uleb128 0x10
+	.long	0x146
+	.uleb128 0x1b
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x23
+	.byte	0xe
+	.long	0x17e
+	.uleb128 0xb
+	.long	.LASF1425
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1426
+	.byte	0x1
+	.uleb128 0xb
+	.long	.LASF1427
+	.byte	0x2
+	.uleb128 0xb
+	.long	.LASF1428
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1429
+	.byte	0x6
+	.byte	0x28
+	.byte	0x3
+	.long	0x157
+	.uleb128 0x9
+	.byte	0x18
+	.byte	0x6
+	.byte	0x2a
+	.byte	0x9
+	.long	0x1e2
+	.uleb128 0x2
+	.long	.LASF1430
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x1c
+	.long	0x17e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1431
+	.byte	0x6
+	.byte	0x2c
+	.byte	0xe
+	.long	0x8c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1432
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xe
+	.long	0x8c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1433
+	.byte	0x6
+	.byte	0x2e
+	.byte	0x1c
+	.long	0x1e2
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1434
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x30
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1435
+	.byte	0x6
+	.byte	0x30
+	.byte	0xb
+	.long	0x79
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1436
+	.uleb128 0x4
+	.long	.LASF1437
+	.byte	0x6
+	.byte	0x31
+	.byte	0x3
+	.long	0x18a
+	.uleb128 0x9
+	.byte	0x18
+	.byte	0x6
+	.byte	0x33
+	.byte	0x9
+	.long	0x219
+	.uleb128 0x2
+	.long	.LASF1438
+	.byte	0x6
+	.byte	0x34
+	.byte	0xb
+	.long	0x79
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1439
+	.byte	0x6
+	.byte	0x35
+	.byte	0xd
+	.long	0xf6
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1440
+	.byte	0x6
+	.byte	0x36
+	.byte	0x3
+	.long	0x1f5
+	.uleb128 0x9
+	.byte	0x30
+	.byte	0x6
+	.byte	0x38
+	.byte	0x9
+	.long	0x249
+	.uleb128 0x2
+	.long	.LASF1441
+	.byte	0x6
+	.byte	0x39
+	.byte	0x1d
+	.long	0x1e9
+	.byte	0
+	.uleb128 0x5
+	.string	"val"
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x1c
+	.long	0x219
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1442
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x3
+	.long	0x225
+	.uleb128 0x9
+	.byte	0x60
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x9
+	.long	0x279
+	.uleb128 0x2
+	.long	.LASF1441
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x1d
+	.long	0x1e9
+	.byte	0
+	.uleb128 0x5
+	.string	"val"
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x1c
+	.long	0x279
+	.byte	0x18
+	.byte	0
+	.uleb128 0x11
+	.long	0x219
+	.long	0x288
+	.uleb128 0x12
+	.long	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1443
+	.byte	0x6
+	.byte	0x40
+	.byte	0x3
+	.long	0x255
+	.uleb128 0x1c
+	.long	.LASF1462
+	.byte	0x4
+	.byte	0x8d
+	.byte	0x7
+	.long	0x79
+	.long	0x2aa
+	.uleb128 0xc
+	.long	0x2aa
+	.byte	0
+	.uleb128 0x6
+	.long	0xf6
+	.uleb128 0x13
+	.long	.LASF1444
+	.byte	0x8b
+	.long	0x2c4
+	.uleb128 0xc
+	.long	0x2aa
+	.uleb128 0xc
+	.long	0x79
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1445
+	.byte	0x8a
+	.long	0x2d4
+	.uleb128 0xc
+	.long	0x2aa
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1463
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xa
+	.long	0x8c
+	.uleb128 0x7
+	.long	.LASF1446
+	.byte	0xb3
+	.long	0x2ff
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0xb3
+	.byte	0x38
+	.long	0x2ff
+	.uleb128 0x1
+	.string	"v"
+	.byte	0x7
+	.byte	0xb3
+	.byte	0x49
+	.long	0x304
+	.byte	0
+	.uleb128 0x6
+	.long	0x288
+	.uleb128 0x6
+	.long	0x146
+	.uleb128 0x7
+	.long	.LASF1447
+	.byte	0x80
+	.long	0x36b
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x80
+	.byte	0x39
+	.long	0x2ff
+	.uleb128 0x1
+	.string	"v"
+	.byte	0x7
+	.byte	0x80
+	.byte	0x50
+	.long	0x36b
+	.uleb128 0x14
+	.long	0x336
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x87
+	.byte	0xe
+	.long	0x4c
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.long	.LASF1448
+	.byte	0x90
+	.byte	0xd
+	.long	0x1e2
+	.uleb128 0x14
+	.long	0x35e
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x92
+	.byte	0x12
+	.long	0x4c
+	.uleb128 0xa
+	.uleb128 0xf
+	.long	.LASF1449
+	.byte	0x93
+	.byte	0x19
+	.long	0x80
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x9f
+	.byte	0x1a
+	.long	0x4c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0x152
+	.uleb128 0xe
+	.long	.LASF1450
+	.byte	0x7b
+	.long	0x1e2
+	.long	0x389
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x3c
+	.long	0x2ff
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1451
+	.byte	0x76
+	.long	0x1e2
+	.long	0x3a2
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x76
+	.byte	0x3a
+	.long	0x2ff
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1452
+	.byte	0x66
+	.long	0x3e3
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x66
+	.byte	0x36
+	.long	0x2ff
+	.uleb128 0x8
+	.long	.LASF1453
+	.byte	0x66
+	.byte	0x42
+	.long	0x8c
+	.uleb128 0x8
+	.long	.LASF1454
+	.byte	0x66
+	.byte	0x50
+	.long	0x79
+	.uleb128 0x8
+	.long	.LASF1433
+	.byte	0x66
+	.byte	0x5f
+	.long	0x1e2
+	.uleb128 0xa
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x70
+	.byte	0xe
+	.long	0x4c
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1455
+	.byte	0x5c
+	.long	0x402
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x5c
+	.byte	0x38
+	.long	0x402
+	.uleb128 0x1
+	.string	"v"
+	.byte	0x7
+	.byte	0x5c
+	.byte	0x43
+	.long	0x407
+	.byte	0
+	.uleb128 0x6
+	.long	0x249
+	.uleb128 0x6
+	.long	0x79
+	.uleb128 0x7
+	.long	.LASF1456
+	.byte	0x39
+	.long	0x438
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x39
+	.byte	0x39
+	.long	0x402
+	.uleb128 0x1
+	.string	"v"
+	.byte	0x7
+	.byte	0x39
+	.byte	0x48
+	.long	0x80
+	.uleb128 0xa
+	.uleb128 0xf
+	.long	.LASF1449
+	.byte	0x46
+	.byte	0x15
+	.long	0x80
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1457
+	.byte	0x34
+	.long	0x1e2
+	.long	0x451
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x34
+	.byte	0x3c
+	.long	0x402
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1458
+	.byte	0x2f
+	.long	0x1e2
+	.long	0x46a
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x2f
+	.byte	0x3a
+	.long	0x402
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1459
+	.byte	0x21
+	.long	0x4a0
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x7
+	.byte	0x21
+	.byte	0x36
+	.long	0x402
+	.uleb128 0x8
+	.long	.LASF1453
+	.byte	0x21
+	.byte	0x42
+	.long	0x8c
+	.uleb128 0x8
+	.long	.LASF1454
+	.byte	0x21
+	.byte	0x50
+	.long	0x79
+	.uleb128 0x8
+	.long	.LASF1433
+	.byte	0x21
+	.byte	0x5f
+	.long	0x1e2
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1464
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x14
+	.uleb128 0x1
+	.string	"v"
+	.byte	0x5
+	.byte	0x2c
+	.byte	0x2d
+	.long	0x304
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa
+	.file 11 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.file 25 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF999
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1026
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x26
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 40 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3
+	.file 42 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.file 43 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 44 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 45 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.file 47 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.file 48 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF712
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF991
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1119
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1132
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1133
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1152
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1160
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1315
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1465
+	.long	.LASF1466
+	.long	.LASF1467
+	.long	.LASF1468
+	.long	.LASF1469
+	.long	.LASF1470
+	.long	.LASF1471
+	.long	.LASF1472
+	.long	.LASF1473
+	.long	.LASF1474
+	.long	.LASF1475
+	.long	.LASF1476
+	.long	.LASF1477
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x31
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1478
+	.byte	0x9
+	.long	.LASF1479
+	.byte	0x9
+	.long	.LASF1480
+	.byte	0x2
+	.long	.LASF1481
+	.byte	0x2
+	.long	.LASF1482
+	.byte	0x2
+	.long	.LASF1483
+	.byte	0x2
+	.long	.LASF1484
+	.byte	0x2
+	.long	.LASF1480
+	.byte	0x4
+	.long	.LASF1485
+	.byte	0xc
+	.long	.LASF1486
+	.byte	0xd
+	.long	.LASF1486
+	.byte	0xc
+	.long	.LASF1487
+	.byte	0x9
+	.long	.LASF1488
+	.byte	0xc
+	.long	.LASF1489
+	.byte	0xc
+	.long	.LASF1490
+	.byte	0x9
+	.long	.LASF1491
+	.byte	0x9
+	.long	.LASF1492
+	.byte	0xb
+	.long	.LASF1493
+	.byte	0x9
+	.long	.LASF1494
+	.byte	0xa
+	.long	.LASF1495
+	.byte	0xa
+	.long	.LASF1496
+	.byte	0x9
+	.long	.LASF1497
+	.byte	0x9
+	.long	.LASF1498
+	.byte	0x9
+	.long	.LASF1499
+	.byte	0x9
+	.long	.LASF1500
+	.byte	0xc
+	.long	.LASF1501
+	.byte	0xd
+	.long	.LASF1502
+	.byte	0x8
+	.long	.LASF1503
+	.byte	0x8
+	.long	.LASF1504
+	.byte	0xc
+	.long	.LASF1505
+	.byte	0xc
+	.long	.LASF1506
+	.byte	0x9
+	.long	.LASF1507
+	.byte	0x9
+	.long	.LASF1508
+	.byte	0x9
+	.long	.LASF1509
+	.byte	0x9
+	.long	.LASF1510
+	.byte	0x9
+	.long	.LASF1511
+	.byte	0x9
+	.long	.LASF1512
+	.byte	0x9
+	.long	.LASF1513
+	.byte	0x9
+	.long	.LASF1514
+	.byte	0x9
+	.long	.LASF1515
+	.byte	0x1
+	.long	.LASF1516
+	.byte	0xd
+	.long	.LASF1517
+	.byte	0x7
+	.long	.LASF1518
+	.byte	0x6
+	.long	.LASF1519
+	.byte	0x5
+	.long	.LASF1520
+	.byte	0x6
+	.long	.LASF1521
+	.byte	0x6
+	.long	.LASF1522
+	.byte	0x3
+	.long	.LASF1523
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF1203:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1095:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1198:
+	.string	"USE_OPFLOW "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF792:
+	.string	"__DECL_SIMD_atan "
+.LASF994:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF962:
+	.string	"__DECL_SIMD_asinh "
+.LASF1002:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1369:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1170:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1396:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF960:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF829:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1014:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1241:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1175:
+	.string	"USE_GPS "
+.LASF1388:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1130:
+	.string	"_GCC_PTRDIFF_T "
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1040:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1230:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF848:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1285:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1457:
+	.string	"zeroCalibrationIsSuccessfulS"
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1190:
+	.string	"USE_RX_UIB "
+.LASF1144:
+	.string	"_WCHAR_T_H "
+.LASF814:
+	.string	"__DECL_SIMD_hypotl "
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF1158:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF1164:
+	.string	"USE_I2C_PULLUP "
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1291:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF882:
+	.string	"__DECL_SIMD_atan2 "
+.LASF774:
+	.string	"__DECL_SIMD_powl "
+.LASF836:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1220:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF833:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF806:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1110:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1067:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1183:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1023:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1152:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1171:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1424:
+	.string	"fpVector3_t"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF777:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1119:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF850:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1453:
+	.string	"window"
+.LASF1178:
+	.string	"USE_TELEMETRY "
+.LASF801:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF893:
+	.string	"__DECL_SIMD_log10f "
+.LASF1382:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1243:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1332:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1103:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1442:
+	.string	"zeroCalibrationScalar_t"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1364:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF471:
+	.string	"__P(args) args"
+.LASF1209:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1321:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1109:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF696:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1333:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF769:
+	.string	"__DECL_SIMD_expf32x "
+.LASF925:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1151:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1143:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1113:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF989:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1085:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1128:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1001:
+	.string	"__HAVE_FLOAT32 1"
+.LASF983:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF790:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1233:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1379:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1417:
+	.string	"double"
+.LASF1350:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF700:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF760:
+	.string	"__DECL_SIMD_logf64x "
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1251:
+	.string	"USE_CLI_BATCH "
+.LASF1275:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1132:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1463:
+	.string	"millis"
+.LASF1426:
+	.string	"ZERO_CALIBRATION_IN_PROGRESS"
+.LASF1083:
+	.string	"__MATHCALL_NARROW"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF718:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1108:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF781:
+	.string	"__DECL_SIMD_powf128x "
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1304:
+	.string	"U_ID_1 1"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1216:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1297:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1063:
+	.string	"_Mdouble_ _Float32x"
+.LASF1315:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF1283:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1087:
+	.string	"FP_NAN 0"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1043:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1200:
+	.string	"USE_OPFLOW_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF1384:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF1235:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF698:
+	.string	"_SYS_SIZE_T_H "
+.LASF1169:
+	.string	"USE_SERIALRX_IBUS "
+.LASF849:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1035:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF744:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1337:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1460:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1263:
+	.string	"USE_UART2 "
+.LASF1412:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1028:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1070:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1099:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1050:
+	.string	"_Mdouble_ float"
+.LASF952:
+	.string	"__DECL_SIMD_tanh "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF923:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1141:
+	.string	"_BSD_WCHAR_T_ "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1044:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF834:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1047:
+	.string	"__MATH_PRECNAME"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF812:
+	.string	"__DECL_SIMD_hypot "
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1224:
+	.string	"CMS_MENU_OSD "
+.LASF846:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF868:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1375:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1094:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1352:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF724:
+	.string	"__DECL_SIMD_cosl "
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1090:
+	.string	"FP_SUBNORMAL 3"
+.LASF1232:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1365:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1449:
+	.string	"stddev"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1012:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF754:
+	.string	"__DECL_SIMD_logl "
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1213:
+	.string	"USE_FRSKYOSD "
+.LASF901:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1335:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1428:
+	.string	"ZERO_CALIBRATION_FAIL"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF905:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1195:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1395:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1410:
+	.string	"signed char"
+.LASF903:
+	.string	"__DECL_SIMD_log2f "
+.LASF1334:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF695:
+	.string	"__size_t__ "
+.LASF1049:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1016:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1069:
+	.string	"__MATHDECL_ALIAS"
+.LASF1168:
+	.string	"USE_SERIALRX_SBUS "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1248:
+	.string	"USE_VTX_FFPV "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1419:
+	.string	"m_oldM"
+.LASF911:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1142:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1276:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1096:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF919:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF897:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1053:
+	.string	"_Mdouble_ long double"
+.LASF1406:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1378:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF762:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1194:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1262:
+	.string	"USE_UART1 "
+.LASF708:
+	.string	"__DEFINED_size_t "
+.LASF717:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1046:
+	.string	"_Mdouble_"
+.LASF1317:
+	.string	"NOINLINE "
+.LASF1310:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF920:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1118:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1188:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1022:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1025:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF969:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1436:
+	.string	"_Bool"
+.LASF811:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1462:
+	.string	"devStandardDeviation"
+.LASF714:
+	.string	"NULL"
+.LASF1167:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF855:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1328:
+	.string	"UNIT_TESTED "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF998:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1105:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF787:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF693:
+	.string	"__need_size_t "
+.LASF883:
+	.string	"__DECL_SIMD_atan2f "
+.LASF824:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1093:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1303:
+	.string	"U_ID_0 0"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1058:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF965:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1421:
+	.string	"m_oldS"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1225:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF970:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF733:
+	.string	"__DECL_SIMD_sinf "
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1149:
+	.string	"__DEFINED_wchar_t "
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1088:
+	.string	"FP_INFINITE 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1316:
+	.string	"FAST_CODE "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF788:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF828:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1306:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF726:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF963:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1288:
+	.string	"USE_PITOT_ADC"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1162:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1017:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1338:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF936:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF944:
+	.string	"__DECL_SIMD_erfl "
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1089:
+	.string	"FP_ZERO 2"
+.LASF1222:
+	.string	"USE_STATS "
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF1045:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF1240:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1115:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1339:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1254:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF766:
+	.string	"__DECL_SIMD_expf32 "
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF809:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1464:
+	.string	"vectorZero"
+.LASF1354:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF713:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1192:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1166:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1279:
+	.string	"USE_SERVO_SBUS"
+.LASF1458:
+	.string	"zeroCalibrationIsCompleteS"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1451:
+	.string	"zeroCalibrationIsCompleteV"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1265:
+	.string	"USE_UART4 "
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF908:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1215:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1273:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1284:
+	.string	"USE_RANGEFINDER"
+.LASF974:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1138:
+	.string	"_T_WCHAR "
+.LASF1154:
+	.string	"bool _Bool"
+.LASF862:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1277:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF796:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF924:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1393:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1034:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1404:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF725:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1048:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF909:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1042:
+	.string	"_Mdouble_ double"
+.LASF1331:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1336:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1065:
+	.string	"_Mdouble_ _Float64x"
+.LASF1390:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF973:
+	.string	"__DECL_SIMD_erfcf "
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_log1pl "
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF715:
+	.string	"NULL ((void *)0)"
+.LASF910:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1278:
+	.string	"USE_USB_MSC"
+.LASF785:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1448:
+	.string	"needRecalibration"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF802:
+	.string	"__DECL_SIMD_asin "
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF1066:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1269:
+	.string	"USE_UART8 "
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1055:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1205:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1391:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF851:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF823:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1433:
+	.string	"allowFailure"
+.LASF780:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1182:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF904:
+	.string	"__DECL_SIMD_log2l "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF959:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1249:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1026:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1345:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF839:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF1429:
+	.string	"zeroCalibrationState_e"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1320:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF731:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF1255:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1414:
+	.string	"__uint32_t"
+.LASF1362:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF832:
+	.string	"__DECL_SIMD_exp10 "
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF699:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1005:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF988:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1311:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF728:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF776:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1180:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1223:
+	.string	"USE_CMS "
+.LASF1450:
+	.string	"zeroCalibrationIsSuccessfulV"
+.LASF1405:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1427:
+	.string	"ZERO_CALIBRATION_DONE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF857:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1380:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF895:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF694:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF765:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1036:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1266:
+	.string	"USE_UART5 "
+.LASF1084:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1098:
+	.string	"MATH_ERRNO 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF975:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1397:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1256:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1366:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF990:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1270:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1129:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF991:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1019:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF783:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1246:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF753:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1124:
+	.string	"_T_PTRDIFF_ "
+.LASF1259:
+	.string	"USE_FAKE_GPS "
+.LASF1344:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1116:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1127:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF894:
+	.string	"__DECL_SIMD_log10l "
+.LASF884:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1068:
+	.string	"__MATHDECL_1"
+.LASF1176:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1392:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1181:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF772:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1018:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF734:
+	.string	"__DECL_SIMD_sinl "
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1307:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1425:
+	.string	"ZERO_CALIBRATION_NONE"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1107:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF1247:
+	.string	"USE_VTX_TRAMP "
+.LASF702:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF935:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1102:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1226:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF872:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1134:
+	.string	"__wchar_t__ "
+.LASF1295:
+	.string	"USE_VCP"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1444:
+	.string	"devPush"
+.LASF722:
+	.string	"__DECL_SIMD_cos "
+.LASF1011:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1349:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1252:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF738:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1327:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF863:
+	.string	"__DECL_SIMD_sinhf "
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1139:
+	.string	"__WCHAR_T "
+.LASF1431:
+	.string	"startTimeMs"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1104:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1346:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1377:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1298:
+	.string	"USE_RCDEVICE"
+.LASF1196:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF461:
+	.string	"__PMT"
+.LASF1077:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF779:
+	.string	"__DECL_SIMD_powf32x "
+.LASF932:
+	.string	"__DECL_SIMD_acosh "
+.LASF1299:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1052:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF899:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF981:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1060:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF997:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF800:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1056:
+	.string	"_Mdouble_ _Float32"
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1323:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1434:
+	.string	"sampleCount"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1445:
+	.string	"devClear"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1122:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF852:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1454:
+	.string	"threshold"
+.LASF1367:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF853:
+	.string	"__DECL_SIMD_expm1f "
+.LASF993:
+	.string	"__HAVE_FLOAT128 1"
+.LASF896:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1400:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF835:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1408:
+	.string	"unsigned int"
+.LASF704:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1212:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF957:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1264:
+	.string	"USE_UART3 "
+.LASF1064:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF902:
+	.string	"__DECL_SIMD_log2 "
+.LASF1286:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF873:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF1041:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1153:
+	.string	"_STDBOOL_H "
+.LASF1148:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1117:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF761:
+	.string	"__DECL_SIMD_logf128x "
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF987:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF1229:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF892:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF768:
+	.string	"__DECL_SIMD_expf128 "
+.LASF907:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF743:
+	.string	"__DECL_SIMD_sincosf "
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1301:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1231:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1187:
+	.string	"USE_GYRO_KALMAN "
+.LASF707:
+	.string	"_SIZE_T_DECLARED "
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1177:
+	.string	"USE_NAV "
+.LASF1359:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF773:
+	.string	"__DECL_SIMD_powf "
+.LASF1106:
+	.string	"M_PI 3.14159265358979323846"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF1123:
+	.string	"_PTRDIFF_T "
+.LASF1155:
+	.string	"true 1"
+.LASF1131:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1163:
+	.string	"I2C2_OVERCLOCK false"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF775:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1456:
+	.string	"zeroCalibrationAddValueS"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1370:
+	.string	"sq(x) ((x)*(x))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF770:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1394:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF757:
+	.string	"__DECL_SIMD_logf64 "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1440:
+	.string	"zeroCalibrationValue_t"
+.LASF1218:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF709:
+	.string	"___int_size_t_h "
+.LASF955:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1402:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1136:
+	.string	"_WCHAR_T "
+.LASF739:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1004:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF917:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF934:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1257:
+	.string	"USE_FAKE_BARO "
+.LASF706:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF858:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF821:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1160:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1211:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1435:
+	.string	"stdDevThreshold"
+.LASF1413:
+	.string	"char"
+.LASF764:
+	.string	"__DECL_SIMD_expl "
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF697:
+	.string	"_SIZE_T "
+.LASF947:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1135:
+	.string	"__WCHAR_T__ "
+.LASF843:
+	.string	"__DECL_SIMD_coshf "
+.LASF758:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1461:
+	.string	"stdev_s"
+.LASF1423:
+	.string	"stdev_t"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1219:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1348:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1258:
+	.string	"USE_FAKE_MAG "
+.LASF1272:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1355:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF808:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1189:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1407:
+	.string	"short unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF701:
+	.string	"__SIZE_T "
+.LASF939:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF916:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1403:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF752:
+	.string	"__DECL_SIMD_log "
+.LASF784:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1112:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF720:
+	.string	"_MATH_H 1"
+.LASF1242:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF986:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF996:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF984:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF898:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF755:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1443:
+	.string	"zeroCalibrationVector_t"
+.LASF782:
+	.string	"__DECL_SIMD_acos "
+.LASF1125:
+	.string	"_T_PTRDIFF "
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1340:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1302:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1237:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1374:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF985:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1161:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF810:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF915:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1282:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1092:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1236:
+	.string	"USE_SERIALRX_SUMD "
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF953:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1441:
+	.string	"params"
+.LASF383:
+	.string	"SITL 1"
+.LASF795:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF705:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1386:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1322:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF982:
+	.string	"__DECL_SIMD_tan "
+.LASF747:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1126:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1086:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1217:
+	.string	"USE_D_BOOST "
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1097:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1409:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF900:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1368:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF865:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1329:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1381:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF864:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1360:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1221:
+	.string	"USE_LOG "
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF741:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1030:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1072:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1351:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1280:
+	.string	"USE_DASHBOARD"
+.LASF945:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1039:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF1037:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF712:
+	.string	"__size_t "
+.LASF886:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1296:
+	.string	"USE_RX_PPM"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF822:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1208:
+	.string	"USE_DASHBOARD "
+.LASF1401:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1313:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF964:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1439:
+	.string	"stdDev"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF703:
+	.string	"_BSD_SIZE_T_ "
+.LASF716:
+	.string	"__need_NULL"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF730:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF926:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1357:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1261:
+	.string	"USE_BARO "
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF721:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1238:
+	.string	"USE_SERIALRX_XBUS "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF854:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1199:
+	.string	"USE_OPFLOW_CXOF "
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF692:
+	.string	"_STRING_H 1"
+.LASF763:
+	.string	"__DECL_SIMD_expf "
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1172:
+	.string	"USE_ADC_AVERAGING "
+.LASF745:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1024:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1147:
+	.string	"_GCC_WCHAR_T "
+.LASF951:
+	.string	"__DECL_SIMD_erff128x "
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF1057:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1387:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF992:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF791:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1399:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF874:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1193:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1300:
+	.string	"USE_ITCM_RAM"
+.LASF1371:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1245:
+	.string	"USE_VTX_CONTROL "
+.LASF870:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF943:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF805:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1197:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1326:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1447:
+	.string	"zeroCalibrationAddValueV"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF968:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1347:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF711:
+	.string	"_SIZET_ "
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1267:
+	.string	"USE_UART6 "
+.LASF1343:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1179:
+	.string	"USE_TELEMETRY_LTM "
+.LASF732:
+	.string	"__DECL_SIMD_sin "
+.LASF1091:
+	.string	"FP_NORMAL 4"
+.LASF1201:
+	.string	"USE_PITOT_MS4525 "
+.LASF1120:
+	.string	"_STDDEF_H "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1319:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1021:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1185:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF999:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1437:
+	.string	"zeroCalibrationParams_t"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1292:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1003:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1013:
+	.string	"__f32(x) x ##f32"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1290:
+	.string	"USE_1WIRE_DS2482"
+.LASF1341:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1446:
+	.string	"zeroCalibrationGetZeroV"
+.LASF1202:
+	.string	"USE_1WIRE "
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1268:
+	.string	"USE_UART7 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF723:
+	.string	"__DECL_SIMD_cosf "
+.LASF746:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1140:
+	.string	"_WCHAR_T_ "
+.LASF1293:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1054:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF736:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF793:
+	.string	"__DECL_SIMD_atanf "
+.LASF922:
+	.string	"__DECL_SIMD_atanh "
+.LASF913:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1061:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1411:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1100:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF942:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1287:
+	.string	"USE_PITOT_MS4525"
+.LASF1173:
+	.string	"USE_64BIT_TIME "
+.LASF841:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF825:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF995:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF948:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1356:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF844:
+	.string	"__DECL_SIMD_coshl "
+.LASF813:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1358:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1133:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1114:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1274:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1033:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1314:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1210:
+	.string	"USE_OLED_UG2864 "
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF847:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1312:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF771:
+	.string	"__DECL_SIMD_expf128x "
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF1398:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF807:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1455:
+	.string	"zeroCalibrationGetZeroS"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF972:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1071:
+	.string	"__MATHCALL"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1318:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF737:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1330:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1015:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1324:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1234:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF950:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1156:
+	.string	"false 0"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF778:
+	.string	"__DECL_SIMD_powf128 "
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1383:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1038:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF797:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1206:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1027:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF842:
+	.string	"__DECL_SIMD_cosh "
+.LASF885:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1184:
+	.string	"USE_PITOT_ADC "
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1145:
+	.string	"___int_wchar_t_h "
+.LASF804:
+	.string	"__DECL_SIMD_asinl "
+.LASF933:
+	.string	"__DECL_SIMD_acoshf "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1191:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1260:
+	.string	"USE_MAG "
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF954:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1418:
+	.string	"timeMs_t"
+.LASF798:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1385:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1159:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF912:
+	.string	"__DECL_SIMD_log1p "
+.LASF956:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1137:
+	.string	"_T_WCHAR_ "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1150:
+	.string	"_BSD_WCHAR_T_"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF845:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1000:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1415:
+	.string	"uint32_t"
+.LASF799:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF869:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF742:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1305:
+	.string	"U_ID_2 2"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1376:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF906:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1146:
+	.string	"__INT_WCHAR_T_H "
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1289:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1031:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF735:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1281:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF946:
+	.string	"__DECL_SIMD_erff32 "
+.LASF929:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1308:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1372:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1032:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1420:
+	.string	"m_newM"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF786:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF740:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF1422:
+	.string	"m_newS"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1416:
+	.string	"float"
+.LASF1250:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1059:
+	.string	"_Mdouble_ _Float64"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1228:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1239:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1157:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1207:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1271:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF803:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF794:
+	.string	"__DECL_SIMD_atanl "
+.LASF756:
+	.string	"__DECL_SIMD_logf32 "
+.LASF949:
+	.string	"__DECL_SIMD_erff32x "
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF729:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1294:
+	.string	"USE_ADC"
+.LASF1459:
+	.string	"zeroCalibrationStartS"
+.LASF1452:
+	.string	"zeroCalibrationStartV"
+.LASF1165:
+	.string	"USE_RX_PPM "
+.LASF1430:
+	.string	"state"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1174:
+	.string	"USE_BLACKBOX "
+.LASF1432:
+	.string	"windowSizeMs"
+.LASF1363:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1389:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1020:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1353:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1121:
+	.string	"_STDDEF_H_ "
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1244:
+	.string	"USE_RCDEVICE "
+.LASF789:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF815:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF767:
+	.string	"__DECL_SIMD_expf64 "
+.LASF759:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1342:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF1309:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1325:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1029:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF719:
+	.string	"_STRINGS_H 1"
+.LASF1051:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1253:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1438:
+	.string	"accumulatedValue"
+.LASF1101:
+	.string	"M_E 2.7182818284590452354"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF1186:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1227:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF710:
+	.string	"_GCC_SIZE_T "
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1361:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF727:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1204:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1373:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1214:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1513:
+	.string	"mathcalls-helper-functions.h"
+.LASF1505:
+	.string	"math.h"
+.LASF1493:
+	.string	"long-double.h"
+.LASF1503:
+	.string	"__locale_t.h"
+.LASF1517:
+	.string	"platform.h"
+.LASF1514:
+	.string	"mathcalls.h"
+.LASF1519:
+	.string	"target.h"
+.LASF1507:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1487:
+	.string	"libc-header-start.h"
+.LASF1516:
+	.string	"stdbool.h"
+.LASF1475:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF0:
+	.string	"./src/main/common/calibration.c"
+.LASF1506:
+	.string	"math-vector.h"
+.LASF1466:
+	.string	"src/main/common"
+.LASF1499:
+	.string	"stdint-intn.h"
+.LASF1474:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1477:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1494:
+	.string	"stubs.h"
+.LASF1469:
+	.string	"src/main/target/SITL"
+.LASF1491:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1511:
+	.string	"fp-logb.h"
+.LASF1473:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1504:
+	.string	"strings.h"
+.LASF1489:
+	.string	"features-time64.h"
+.LASF1478:
+	.string	"types.h"
+.LASF1509:
+	.string	"floatn-common.h"
+.LASF1508:
+	.string	"floatn.h"
+.LASF1468:
+	.string	"src/main/drivers"
+.LASF1476:
+	.string	"/usr/include"
+.LASF1465:
+	.string	"src/main/build"
+.LASF1520:
+	.string	"sanity_check.h"
+.LASF1488:
+	.string	"features.h"
+.LASF1518:
+	.string	"common.h"
+.LASF1496:
+	.string	"typesizes.h"
+.LASF1502:
+	.string	"locale_t.h"
+.LASF1467:
+	.string	"src/main/config"
+.LASF1497:
+	.string	"time64.h"
+.LASF1479:
+	.string	"stdint-uintn.h"
+.LASF1470:
+	.string	"src/main/target"
+.LASF1510:
+	.string	"flt-eval-method.h"
+.LASF1471:
+	.string	"src/main"
+.LASF1480:
+	.string	"time.h"
+.LASF1515:
+	.string	"debug.h"
+.LASF1498:
+	.string	"wchar.h"
+.LASF1512:
+	.string	"fp-fast.h"
+.LASF1472:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1481:
+	.string	"maths.h"
+.LASF1484:
+	.string	"calibration.c"
+.LASF1500:
+	.string	"string.h"
+.LASF1492:
+	.string	"cdefs.h"
+.LASF1483:
+	.string	"calibration.h"
+.LASF1486:
+	.string	"stdint.h"
+.LASF1523:
+	.string	"build_config.h"
+.LASF1501:
+	.string	"stddef.h"
+.LASF1495:
+	.string	"stubs-64.h"
+.LASF1482:
+	.string	"vector.h"
+.LASF1490:
+	.string	"wordsize.h"
+.LASF1521:
+	.string	"common_post.h"
+.LASF1522:
+	.string	"parameter_group.h"
+.LASF1485:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"\025\006"
+	.string	"\024\007w\001"
+	.string	"\r"
+	.string	"\214\220\316\360\r \002"
+	.string	"\002\001\002\003\004\001\337\327\210\377\017*\002"
+	.string	"\002\005\002\006\002\006\002\003\004\002\005"
+	.string	"\355\261\345\252\t\f\007\002\007\003\342\230\366\266\f\016\002"
+	.string	"\002\001\004\356\304\372\201\t\002\005\263\335\253\200\f\006\361\326\367#\007\325\266\342\352\b\b\002"
+	.string	"\b\364\271\270\341\t\003\t\005\n\005\013\005\f\230\266\211\242\002\007\002\007\002\007\002\007"
+	.ascii	"& \300\002*\253\035\277\003\b\006\301W\260ka\263\335\344\226"
+	.ascii	"\002:\262\232\004\304\303\303f\212\246\r)\306\002\342\022@\273"
+	.ascii	"\230\\f\3430_\215\r\030`A\036mx\257\231\0068\332\375\202\230"
+	.ascii	"}\215Vq\353!d2x\334f\343}\257%M\r\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\r\004"
+	.string	"\"\305\016\024\240\265\205\003\253\252\272\303m\300P\350F\326KKLn\231d[\n\230\251A@=ow\221\006m\005\314Y\002R\252\356J\304\357%\227\244\356Q\3345\036\022\262\277\375\343\210m\004\036"
+	.string	"\300\211\303\372\352`\031 \0348\004\034\007\207\341P\f\344"
+	.ascii	"5\3228\275\203\r@%\371\312L*\013\200\201\305\\\205\030\013\304"
+	.ascii	"Ar\002\272@#\253P`\256J\200 ]\240\b\036\212\250\345^\220I\001"
+	.ascii	"\206"
+	.text
+	.section	.gnu.lto_.inline.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\317\003\245\016"
+	.string	"V\024C6P\215\322\001\244\326\205*\364\031\037\317\222\274\341\333N\026\200sK\200\274\020%*\224\002mUNm\371\266\020\230\246\231\231i5\253\r*\320\317f\311&\261[&\231\0021"
+	.string	"3"
+	.string	"4"
+	.string	"\327\374\314\232\033\032\372\333ww\323\3679\3278\215<\f\330\334A \246\r\314e;s\325\226g\345\231NO\035\237\206V\317S\020\023]\201}1$\005\336\236\321\321\337r\243^4\364t\325\312\035\3633\223\273I\224\"\021\330\036%\371\bq0\270\255\n\227\020\341\3100\311\231\226;\003r\006t\333\231j\326\250:\331?g\340h\304'*\301|\301\350\315\275\307N3\027\254\354\037\237\342\024\032a\266(\326\250Zv\303\356vVc\311\241\030\032\265\273\027\373zZ;\252\332]\200\216\233\236\250J&jM\263\364[}\027\231\263\216L\356(K\005K\255\350\034cw\003\022\036\332\355\004\034!\302K\253\317\"\035#\306\030?\036\374\024\032yiM\253xdW\250\021A\307\324H\005\232\202\324\351p\242\251\251\342\r\022"
+	.string	"TE\311\302Jp\202\211n\362L\252\365w8\244\366\320\272"
+	.ascii	"\034\002\241ob\202\346\325 \313\367\226\340\326\364\366>\023"
+	.ascii	"}\263\204\365%\350L^s\262\027qB\370v\233\2226I\001\364\202\267"
+	.ascii	"\341\\#L\313C\207\264\251%\301\237\375\307sq\354<\315v\020>Z"
+	.ascii	"\255\013A\373\252\003bh\225x\321\212#\324\244\213\013\3725\351"
+	.ascii	"\225q_\372\372\323\311bH\b\365\007\020\274\332\234w\355\325;"
+	.ascii	"\241\264?\246F\241<>C\274X\3621V=$\006\260}\324\342\3504C)\025"
+	.ascii	"\310\227\bo'\232\212\225+K\240\374<\016\347:\355\235=,\306\246"
+	.ascii	"e\377\300\035\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"\035\005"
+	.string	"\242\207\025\034\260%\351\f\305\222\002\n\036\006\260Z\006 I\2228hm\263\2154B\366\336M&\031,\003\254\227q\252\340\205'\334\313\260w\231Gtj|\255.\211'\336\210=b=\3203\275\343\303?\021\245WeKV\326%\217\310+%\234\222\r\206N\357\236\340\313\203\017\002\036"
+	.string	"O\017\250\030\035\031\314\344X%\017\007"
+	.ascii	"Ji\300W5X\214\0139\206\003\330\027\212\2761\030j\231E\203\r\303"
+	.ascii	"X]5\2047\346f1\242^\005'S\016\233\362p!$q\264\t\003\333Ll\317"
+	.ascii	"\031h\362\327sU\r\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\205\004\005"
+	.ascii	"\205\004\006\231\004\007\232\004\b\232\004\t\205\004\n\205\004"
+	.ascii	"\013\231\004\f\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\306\001}\007"
+	.string	"\322\310\031 \220\245I\007s\377\227g\364\235\356\177\260qwwwwn\245\366\277\201\265o\337\356\233Y+e\ns\200\022$@\310\337\347\\o\235\t\36008c\034\213O'\376\374,eL\374\251\320\342\b#\256rt"
+	.ascii	"4\355q\307\236\344\204:\250\375\233\3137\033\251%WuZL\251\031"
+	.ascii	"\rI?\343a\316\253\305L\271r\003\002= \240\202\031!\273\003\241"
+	.ascii	"$`\237(\202\211\344p 6!\242\033Q\261!/\013\f\245\030HT\033\027"
+	.ascii	"\337\240~\201\314\005\3304\003\350=\336\250\253Bp\337\242\021"
+	.ascii	"\254\267\302\036@\326\035\0214\202\267\004\300\nU3xh\240v4a\244"
+	.ascii	"=\txP\336\367cU+_\260\203!P<&\206\025<c\316\275t\177\004\353"
+	.ascii	"\0358\370\262\324z\274\\r\375\331zu\306\307\224,a9Rw\271\306"
+	.ascii	"L\r~b\017\255pn"
+	.text
+	.section	.gnu.lto_.lto.427c7c1f498cc836,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_zeroCalibrationStartS.21.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\244\002\225\022"
+	.string	"V\342zI\300\324M:\230D\201"
+	.string	"\274$\243\221\2252/\301\342\217uH\033\210D\205\t\200\222q\267\265\033f\013\370\233\214\275\275\226*\324\265"
+	.string	"\271\325b\017w\221"
+	.string	"\322\333p\0242J\003RGV\215\217\035\004\bm~\344\223M\366N)`"
+	.string	"c"
+	.string	"j"
+	.string	"N\273K\343\005\336\253\247\2445\313\327\030\257\364\303\251\354P\n2\307{\215\341\316B\325\372\264\217t\032\343\223\200\276\262k4\345\264[\322\370\363^]\336\245{\365\316\322\275z\264\247\004p`5u\260Q\265\273\037]\361\361s\364\177\343+\222\250\366ib`w=I\242\0207\275m\031\333\025l\232\022\033Bz\324\342\325\007\352^_nTAs\211]H\b\331\211\304.k\223\252\260\317\355\356\232\032\331g\372Y_\372O\256\364{O\3729\223\351\331M\177\005\005\252\205\307.\210%IV\252>\271\260}\024{%\242U\247ms3\236\211\366\022\246\250\n)j\267\244q\004\357u\345\241E\227l\343T\366\203\320QCZ&=9B\206\315\366\224\261\031\\\3126"
+	.string	"\267\006\017\342\340V\025\3433\235\375\340?f|\020\270Q\301`Q\033\302{\320\242^\234P[\302\241l\333Q\300\310\t\217\332\023\256\343\t\206E\t\023\324\246p\247\037\033\005B\036I\231\366\0136O\236\376\240\020\2425\273\024\375`g[x\0160\345\310\276p\0342owq^\375\2460QC\ft\035\240\205\261\230\213\265\023\013yz`\"\217\317\212\026\356\314@Zg\035\330\r\016\216M\313\246&@\317\375\252\231\205\240\217K\324\001c\256\3277\013e\262\360\365\315@\227\354{\211=_M\214C\f0\361\363\tC\361C)\367\334R#\327\031RAT\310\003\346\244v\016\202y\3221C\264f\277H\206y#\355\004'\242\340\345\026- \300\202\231)\343\001@pP\022\232y\340\351p\312\t\007\373\200\340~\230\200\036\256"
+	.ascii	"4j\206,N\021\227\2519\344M\250\343\256\215\201\231\254B\354\210"
+	.ascii	"{\273\025:\314]\033LS\335\302W0\206a\273N\224\234\020A\230\243"
+	.ascii	",\273\216\210\305\357\215\315\221\0079*\261\341\273\217~\277"
+	.ascii	"\261tV\202\032^\b\231\f"
+	.text
+	.section	.gnu.lto_zeroCalibrationIsCompleteS.22.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"\205\t"
+	.string	"\306RD;0\305*\035"
+	.string	"X\352\320\340\220$ \317L\232z\224\304p\006Q\313(\005\232\"\027\332\232;~\267\031\253\375\363\rl\231\221H\013\017$H\223\320B(\366E\2572\244\222M\366N)2"
+	.string	"1"
+	.string	"4"
+	.string	"\237\335\013\270O\333\336pPN!LH\232\254%\302\262\033R\231\361\324c\312\277\307\023FJ\\/\325c"
+	.string	"\303\356:\272^\025\267\274m\005\333\r\266i\001\266\243\267\307~)\243?\0050\016Hv)j\0016e\236l\330F\331\236\335\31141\332\347x\007\352\261\323\tva-&\273\341\202i\367\351\360\006\\\233\274J\013\205\025k\266\353CH\227\231]:\bD\267\273\235\017\211\210\201\231\306\247\177\342>//+\261U\254\331\263\330\b\300\016UQ^\330\337vw-a\001\376\2008\235\316F\263\311\\J\367\227\031\325\220\311\003~B\016\236\217\216\252HT?:\nyD\364\003K4\203q}"
+	.string	"\201\324T+H\275p\357MbV\222\345\237\304]\006\n"
+	.ascii	"@\363\240\314\2000\fq8\342b3\306\336\255g\361]\243!:D\354\\\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_zeroCalibrationIsSuccessfulS.23.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`c"
+	.string	"\205\t"
+	.string	"\306RD;0\305*\035"
+	.string	"\210[&\020N&X\312\030\270YI\fg\220%\002\303\001\214\314\317\215\314\035\277\333\214\325\376\371\006\266\314H\244\205\007\022\244Id\t\024\373\242W\031R\311&{\247\0242"
+	.string	"1"
+	.string	"4"
+	.string	"\237\335\013\270O\333\326lNF!L\310\331\tK\004\300nH%\306Q\217(\377\036W(Yi\271R\217\001\f\273\353\330rU\334\362\266\023l7\330\236\005\266\243\267\307~)\243?\005T\016Rv)j\2645\231\262\r\333'\333\263\273\221L\214\3669\336qz\314t\202\335\027\215d7\\0\355>\035\336\200\013\233\224(,\331*\326l\327\207\214,0\233t\020\210nw9\037\022\021\0030\215O\337\304}^Z2b\252X\263g\2611\200\035\246\242\274\260\277\355\356Z\276\002\366|6\034\216&\243\301XH\367\207\021UP\251\003z@\016\235\217\212j(T?*\002uB\364\003I\024sq}\370\200\264T+H\275p\357M^Tr\345\370\021w\031\n"
+	.ascii	"@\363\240\314\2000\fq8\342b3\306\336\255g\361]\243!:D\354\\\363"
+	.ascii	"\t"
+	.text
+	.section	.gnu.lto_zeroCalibrationAddValueS.24.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\215\f"
+	.string	"\226\030XC\020q\224\016p\0070\024\242\300\b\212\200\003\035\220\022a2"
+	.string	"\371\351\342["
+	.string	"\333\024\305\244\341\352\242\217\322O\2755\210\344\344Z\004\371\177\327\314\007h\347n\373{?\201\025\324\237\304e%\036id\357\275S\nE"
+	.string	"F"
+	.string	"D"
+	.string	"\247\376\216Y\247\327-\326\251;\033F\201\n"
+	.ascii	"L,\220\314\330\335*="
+	.string	"\274\373\224\261\3637\274\322\347\205\341rb!!P\002<\3234P\242\"\306\301G\020\357\024#\305\263\273\216(\357\302Mo;\201\355\005\366\031\004TF\237\202\240\303\205\305nHXc[\320\025\"l\337\376\211\316\256\330\327\206M\214\007\375\357&\272\217P\230\003\026\304\244a\265{\312X\301u\212\231\267d\330<\276\204?\342$\272\253<N`W\304d\265\373e\\\257%+\371\016\353\022\004\2768\305\023\333\333St`){t\024\021\256\335\355\220\220&\004H\355\356A\234\372\036\326\351%\366A\365\021C\037|\003\031.6\322\260\277R\224\034\354\3130\fCK\021\373#\277u\325\037\022n\020\307\201N\207\263\341h.\243;\323\210\266\020\351\303\201B\017>Y\025m\232\266eU\024\372h5\343FU\203\361\006\201\203\253\244m\343j\345\333\317\365|H\323\347\356\356\254DKRi;\320\342Q\246\262\364\324I\022"
+	.ascii	"@\363\240L\350\214\021\244\027 \253\320 J\242nAW\030\013$\314"
+	.ascii	"2\227\365\210\271\n\347\202\021\252\036Tj\225q\202\233\272\217"
+	.ascii	"\306\240\366"
+	.text
+	.section	.gnu.lto_zeroCalibrationGetZeroS.25.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`c\001U\016"
+	.string	"6Z_D"
+	.string	"\221(\035|:6\234qd\303\371%}\022\326U,\307\332Ru8\327\3351\03656\003\016\225\325\320\360$\037\330\250\344\355R\240\027\372wu\261\377\022\211f\265#\250`[%m\030W\fYB\366\3362\245I"
+	.string	"G"
+	.string	"N"
+	.ascii	"\332\245\346\005\264K\237\354\032\377X{\227\213\006\030\331\356"
+	.ascii	"N\030\342\247\313\b\365\344\377\345\037)\357\344\222\345\021"
+	.ascii	"\200\307r\03071\0203D<T\\\320\362b\345"
+	.string	"/W\025/Eus\260\273\326\224\307\341\326n[\202\355\b\366M\004~\334\3355T\331\377~\355\255_F\265B\365?\266\0161\0046v7\314x,L\272(a\373 \366\226\243\243\237e\016\fX\224K\005\202\346r\243\321\271\332w\371\211\323[&'\260\253\222\261\330\375\030xj.\375}\023-\260\370R\340\247\350\374\n\231\361-\243]\212\260d!13m\201#\366\001\302\225\365\234v\br\311@\251\016\333\243\303p\033\226}\341(J\232\335\365\270L\030\002\260F\\\372&\332\345\341FD\013Eg\326\230\0360Vw\330\337\211\302\225\003\031nPI\003\217\207\244C\3021P\272C\034\022'2}:\220\250\302'4I\334h\304\205&I\364\031\315PW\232\234\004\346,\224t\323\304q\335\004\371\366q\241\312\017<\300P`\212\204+\370\030\251\033\366\204\257\360kDt\025\024\004\314(\034\331VN\"\025\036"
+	.ascii	"@\363\340\314\320Nc\340\021\212\335\354\200u\315p\204\252\300"
+	.ascii	"AF\200\343\210\345q1\003\203R\\\315\315\032\207\013\207\300\216"
+	.ascii	"/\024\207\213\346\022>&t\333\027\234\271\006\334\3020C\225\003"
+	.ascii	"B\r\034w\256g;O\351\250\321*("
+	.text
+	.section	.gnu.lto_zeroCalibrationStartV.26.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\365\003U\031"
+	.string	"\306n\242G\260ZM:\220\370\245\374+r\241\321sH\212\227\0059k\230=?\252\004{\322\362!\351\201\240\017\273\265\227\275\337\3303\242*2z\327\036g\2163\207\223=\354\363\252\211P#\365\373\260\336\354\377kTB\b!{\247\024\210"
+	.string	"\210"
+	.string	"\222"
+	.ascii	"8\235\225\335\3751\207\361\240H\244EwgR{\223\244og\225v\230\030"
+	.ascii	"\306\203=\237\370\243uj\037\311\223\324\256\304\305\007\3546"
+	.ascii	"\251\261\262\273\37319\036\364\356\005\302\203\343Y\341A\327"
+	.ascii	"l5\337\351\366N\252\304\2002\265\273d\355\341\372ow\177\264v"
+	.ascii	"\360\253\264\346\213C\347\0270\2411s\266\203\337\316\356\346"
+	.ascii	"\344^|\021\350R\016G\277 5^\357\364\007L\247\231\253q*\016\355"
+	.ascii	"\256\251\231\243q\207\267=\263Md\177:\001)N\245h\334]\241\203"
+	.ascii	"\376\224YYu?\016\372.\302\203\006zmn\264\312\364\024Rf)\225\275"
+	.ascii	"\263\321\312\303\376\2676\331\254G\371s\376\344_\275\311\037"
+	.ascii	"\340J\376\360\274\273\212\3244\244>\0011\212\f\202\252]\031U"
+	.ascii	"ov\f\210\005\310y\277}qK\313\227\342;\031G\214j\331<C\215\266"
+	.ascii	"\031\343\351\244\267fw}\016\032\305x\3608\2668\245\005R;HB\355"
+	.ascii	"Qh\337\361\334\230B\022%\202I\253>\361\323\267\263K\001\366\245"
+	.ascii	"V\254z\246\235\341i4\360\350z\035\020\2401@\353M\033PO\266)\003"
+	.ascii	"{\303\317\370\251\200[\334L\007\235\336\356N8h{x\231\017\002"
+	.ascii	"\032\350\246Vg\226Zw\327V\355\363\363N!\307\315\351\337\020\035"
+	.ascii	"\364\274\342;\bm\020\027\343 L\202^\233%9\325\016\361/4/GV\325"
+	.ascii	"\036q.~\212R\220\306H\200j\223\270\026(\036\0378\212T\273\304"
+	.ascii	"\263$a\251`L6:\324~\301\350\315\327\244\034\270j3=\207\374\261"
+	.ascii	"\320F\361*1\035\235\035\261\303f,d1\227\005Z)\223\271V'd%\321"
+	.ascii	"\021lF\204\004\200V\2360\212\321B\233\200I\020\022\nj\005\001"
+	.ascii	"\0358\272_@Fe\f\31153\021\223\271^\244QYTT\276H\243\230\253\210"
+	.ascii	"|\315\216H\240\036\227*`3\022\251,g$\316n\377\255M\376\371\361"
+	.ascii	"\3442\346Vq`\345a\261Ke\325*E}^\353\322\317k\255 \245D\335\210"
+	.ascii	"\321Q=t\243T\377>V=\357=7Je\b\257\225U\017\203\tG\253\314s^I"
+	.ascii	"@i\265/`\2407\335\243Tm\001G\250!<\003\221B\306(\023\210H S\265"
+	.ascii	"\220\016\260\002\031\"c\007\021`95%6)\237\373\006@Rg}\363;;u"
+	.ascii	"\346\312\005<\030\022\013\374D\017\030>\3519\376\036\215z\203"
+	.ascii	"\210\007\360\210\006\305N\322\n\252-\236C/=\237G\022\273\\\032"
+	.ascii	"\300I\007o\277\332\353\304v\204\256\364\231\321l|C\313\235:d"
+	.ascii	"\n\221\373R\303\n\rQ\302\236\206(\026\r\223\230:\373\221\336"
+	.ascii	"\304\275#H\302\213\312\3549\262\013\214X}\360T\274\303\252\305"
+	.ascii	"\307~\0011\212 \300*\246\347\373\271\327\361\004\025"
+	.text
+	.section	.gnu.lto_zeroCalibrationIsCompleteV.27.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"\225\t"
+	.string	"\006\323D;0\305*\035"
+	.string	"Xj\033JV\263\007\364\244\2538fA\247@\215\026#\027\263\265H\247\255\271\343w\233\261\332?\337\300\226\031\211\264\360@\2024I\b\f8_8\bD\310&{\247\0242"
+	.string	"2"
+	.string	"4"
+	.string	"\227\017p\237\266\335\361\250\274:h\021\373\204\312\013\204e\027\244\262\342\253\307\225\177\216o\031\021!0\031\353\261C\330]G\230\354\341\226\267m`;\301vJ\216\336N\373\245\214\376\354VL\n\302\335X\030`K\346\b\206m\225\215\261;\bN\214\3665\276\241:-u\201\335Y\213\310.x`z\3714x\002\3563\362'/\022W\fm\327\177\23025\373t\017\206\313\356~:\034\032\002j\027\237~\212\373\274\314\240\320Z14Fb#"
+	.string	"\033dEIa\177\333\335\265\234\331\001\016\211<\237O\207\323\331dN\267\267)\325\021\n\364\205F\n \217\226*\211T=Z\032\201H\324\373Nt\243q]\020}\024U\353G1\340\336\233\324\264\244\313\277\211\273\334\002\n"
+	.ascii	"@\363\240\314\2000\fq8\342b3\306\336\260g1\270fKw\210h\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_zeroCalibrationIsSuccessfulV.28.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"u\t"
+	.string	"\006\323C8@\255\322\001\003\334\262(|d\3625\233V\356\377\301g\213\031'\335\253\001\361\333\252:\325\203\214\325>\363f\206\035#\206\353\250\2012{\f\225\027|\023E\210l\262wJ\0012"
+	.string	"2"
+	.string	"3"
+	.string	"\224\013t\227\266\255\331\234\214z\215\271\036Qcu\214\354\326\031'\216:D\371\3178G\362 \322z\245\016'\007\273k\330z9\334\361\266\013l#\330\246\005\206\346.\373c\204\276\234\330@\bBv]7\333~\310\231\205\355\223]\261\273\222\f\204\366/\216q\272\314\364\200]\230\315c\267\032xR.]?\320]\0061\322X\263\025\274\331\246\347\030Yb6\351\033\013\224\335\345h40"
+	.string	"\304*.}Sw\371h\241\220\251\340\315\025\210\2055\273\246`\224\260\317\355\356:\302\354\366|6\034\216&\243\301XH\267\207\021QP\251\363y@\t\035o\212h(D\275)\002uB\323\373H\023s1U\370|\263D\3517+uo.^Tqe\370Q\367\310\005\n"
+	.ascii	"@\363\240\314\2000\fq8\342b3\306\336\260g1\270fKw\210h\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_zeroCalibrationAddValueV.29.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`4\001\005\016"
+	.string	"V\\bD"
+	.string	"\221(\035\363\371\364\342\333\357\252\324t\300\177\214i(\246\362\337\321a\365\361*Hw\203F]\262\210\210Ef\266\260\"e\366\031E\rR\t\024\276\034\375u\230dH\256\345\373}\231\3675\206\375\311&[\246\024K"
+	.string	"R"
+	.string	"L"
+	.ascii	"'\260\233\202I\261\353%\260&\037\355}\223=\312\027\310\036=m"
+	.ascii	"\027\367V\373\017\303\205\357\265\273\032T\231sb\363\030\324"
+	.ascii	"\351\003@u\307\344\206C\001\250\022\214\263\273o]OP'\325\214"
+	.ascii	"\307\356Z"
+	.string	"MP\031\356x\333\013l;\260\317!\020R^0\020\240\330E\211\241\261,\242\n\020\377~\373\231\312v\227\263h\262\225\315~\213\357:\211\371\317+d\227\"]>\224\027\273\313\361\350\006\362\221\203\335g\231\266\306\316:l\252oy\026\016\f\330\223k\305@>f\032\266\353G\370!.b\2365\022^\367\357\356B\250\362\037\222\035\202\\-N*\3036\367\023!\233\225m\272\211\trw=%@*\004X\255<\372#p\363\201E\2421~\353\017^<\300\304X\235a{\235B\225}\335\335\3160e\337\373\345Y\177\346\337\215A\3657\002\242S\270A\037\n<\236\216\255\243c\300t\207:$N$\362)\201D\022>!\215\304\215F\\H#\211>#-T2i\035\2169\220\217\222&\302q%M\343\355a\312\036$\260D1\250\362[._/5\224\343\030<\2615*a\006\332\021Fz\023G\330\335\001\024"
+	.ascii	"@\363\340\314\200u\316\300o\211\210)\b\027\315%|Lh \212\022\363"
+	.ascii	"B\013.c\314\022\004N\324B[\300\361\030\nap\3555%\364PC\266\253"
+	.ascii	"\224\001"
+	.text
+	.section	.gnu.lto_zeroCalibrationGetZeroV.30.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`h\002\005\023"
+	.string	"\246b}I\260\324Q:0x;,\241^\b\231\261\034\3778\223\221\277\275\016\205<\0016\254v\307\325\030}k\326>h\252\232Z\201m\\.\260\302}\346\262&y\347\007\311\203vg[\235.R\363??9(\027g\333\255'{\357\235Re"
+	.string	"d"
+	.string	"k"
+	.ascii	"\264\017\321\274\300\356\316\317\306\356\350\300\241\352\325"
+	.ascii	"\343Y\340\253\352\006\300W\323\354 \037q{\236\017\021\274\337"
+	.ascii	"\356\206\223\305i\257tJ\232\237\373I\022\035\217\243[\315\253"
+	.ascii	"*\347\364\275\0370\372\3719\272\345|R\226\323\212\037\003n6\224"
+	.ascii	"\201\016\323\211\347.I\334lR\002`\331]\313\233\033\316\r\336"
+	.ascii	"\366\004\333\027l\231\"\273\236;\366\307\237~\350\237T\372\001"
+	.ascii	"VQN\255\036\273&\246\220\254\257.\271\360u\357\311\274\310\347"
+	.ascii	"M\034#@\273\273\372\216\3056b\351\f\037\035A\277\335\261\301"
+	.ascii	"k\tn'3.\316c0\205\200\361{\365u2\366\352\365~\021\315^\331\225"
+	.ascii	"H\212\224\317\2153\t\b\254\215\016\005\004\325k\205J\271<\221"
+	.ascii	"\037t\241=\303\236\344\244\2361\274Fl\342h\304h\360{"
+	.string	"f\300W\023\334\257&\247\374\336%\b=\235\367\222\027@%\200\f\241\363\273\243\324\244\224\005 5I\245\"N*\346\344\221\027\301\317\026\035\224\215\214\262-\373\221\310\302\331\035.\343E\265\273+F\037<\230\340zh\300\327OV\213\241\232\234\262D\332\361\264R\312\036mr\362\330\247\273\001\316\320\232\2110/X\214\202\230\273\005\366`eE%E\245\205\340\345~\265\\\304\030\214k\326\022\333\340z\205.\242L&\276B\227\230K\026\276f/a\013\305\"\007\330,\204\021\305Y\270\032k\247;w\034A\312W\2336\373\273[h\362\035\021R\253'\222\3169m\n\025\344o\374\334Y@\314\232\373\334\350\370\250\3539p(\275~c\211E\224\264\340\001, p\202\231\262\343\001\300\274\017\344\203\342\320m\024\030\t\002\033,\"7V\251#\002\2301pg\310\330\2718\361\236\200\200F\341\207\311\b\362\360\021u\b\206\033"
+	.ascii	"\030r|\370\037\213/\312c\276\371\230iN\214\301z\213m\214\006"
+	.ascii	"\210w\\\250\220/f]\301\020\336\265\260\303\264u\316<\206\f\234"
+	.ascii	"\\\347\016O=\204\325\005\241"
+	.text
+	.section	.gnu.lto_zeroCalibrationAddValueS.part.0.35.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`i\006=\""
+	.string	"F|\321H\220\232Q:"
+	.string	"a@G\341\212?\242\017XU(\360\230\313\034\214\220U\335Q\344\243\025~L\313\353\215\337?k\315Qv\235\037\375\252\304 \006 !\211>\213~q\352/\243\375\236\314\023F\210\335\330\377%\237\020\"wJ\001\266"
+	.string	"\252"
+	.string	"\303"
+	.ascii	"3\177\313g\317\374D\254@\250\316\252\243\245\327\362\231\274"
+	.ascii	"\211\357NL\220<u\njFW\255A\n\347\313\033\371\364%'\002\020\353"
+	.ascii	"\013\252S\306\021\245'\372J\236\345\373\222\023\357\251u\307"
+	.ascii	"\233\256Z\211\013^:w\2764\361@\346\313\363?\346K\373X\266\237"
+	.ascii	"\3544'^U*\373\3544\001\242hoRh\271\251\265\346^.\217\373~\302"
+	.ascii	"\314\222\\\032\363\371\262\341\357'\254\310|\216\0273^\316\206"
+	.ascii	"R\265a\024%k\303\024\344\255\326:\033\006\351\222\b\274\252\264"
+	.string	"\271\224\027\205\241\232A\002\271\b\"\374\326\351\324\020\212R\237\307`\020j\255>\220\306-\273m\026\266\223l\323\027K\227\334E#u\003\212\326\261\315\364.\033w\216\366\207\033y{UkE\242\202\242\347\003y\351\2370_\322\335)\223\005\244u\374\255\313\212\3030\225\306\241k\345\215\235\254\273\303&\251\177Hj\237\222\272\207\244\346)\251m0\352\032I\275s\256\233VR\317JjYI\035+\251O\223\032VR\233%uIR\223\327\372\227\244\246'\376/\320\203\353R\253\213:rjUiE\310\271~\373>\327\237\370R<3\024\023\276\005O\037G\347\372\226\037\345\374qd?\n\024\023\347\217*hJG\013\257Zk\202\227\256p\276\274\277\365d\007#\314\332>G\0233\022\216f\304\320\231\035Pm\207jE\"\306\242\004\311\025\271\263\264m\232p36\022\225\331\t\355,\021\255\210\203\266\347\372\rH\343x"
+	.string	"\245P\201^H\333\247\252\340\376|)\377\212\242\215\375\257\340xu\355Z\315V\266\035\232|\tR8\266-\234L\222\203\343\230]\3568[\007eb{\256l\251\027\251!\027.&\211(\314N(\266DA\324\306\220\201^xn\203*\250\375\331\254\361Cwakk\330@/\364-j\177\366\2778\321\243\320\346p/JA]x\266#l/\224\021\303\\.[v\277\221Y\256\271\233Ew-F\266\253\245g\331\225k\353\221E\2130\310\275b\345\302\257\r%\226<x \341d\226\270;,5@Bbp\304"
+	.string	"'\344t\353p!zL$\224\232:0\201P\322\345B\364x\274\236.\027\202I\211\227\32359\345p7\367D,5\345H\364zM\271\331!"
+	.string	"\027\312{R:\345\303\022\022\356\b\034\327\200\371Y\0256\002\245\340\331\320\b\277|\226g\177\366R\\z\326gas\244\274\2004\312\350Shpw\255\236\375\224\036Y@\n\264\021\367\201\376x\n\256x\026\347\005\266V\367a\231\266/\311\351\370\260\346\0300\255<\230R\251\230E\276%\021\202XF\333\264\300\033\033\205\334\360\024\034\335$\361\215L[w6Fk\016\034\327"
+	.string	"(\036\261\355W\322\220\232\035\0209G\370e\333\027\001P4\"\300\353\b\227r\255\354\007{\250Q$\245\231T\"Da2\222\244\205\003\240\002\221\251\343<\021"
+	.string	"5\252\224\215\210\322\270u\003@\\\013\263\342\310\211\001c\303\332\364\322\302g\366\037$\213D!\"\226\325d\356\017G\243\203xG\336\2430Z\276\234\2210\3348\300\204\264'G\317R\312\022x\023<j\240\346\033\307\013\032\343\301\241\227\321\343\350\277\343\260I\211\372\316\030c}N\340e\016-\244??\004\2054\373hV\263\t0\211I\033\220\260\246up\300\310\357\320a\355w2u\362E\250\003E\307~\275\003\371~p"
+	.ascii	"h\334\325\302>L\367\tR\264\036\354\031\362\n\314\372\212L\274"
+	.ascii	"\021\331\224\321\216\376\277A26\177\304\325\271\035\337\026\203"
+	.ascii	"y\223L\rrq\333\336\346\332V\356\210(\026<\360\244y\375G\210\022"
+	.ascii	"\262\376>n\024\275\03290Ox\306\244\375\275Q\354Y\361IVV\271\201"
+	.ascii	"\003\331\013S=\300\213\205\253\177\306\2314"
+	.text
+	.section	.gnu.lto_zeroCalibrationAddValueV.part.0.36.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\251\r\235?"
+	.string	"\272h\310\026AP\244N\007S\364\331\263\206\304W\312yS\312k\307\346z\240w\271p\t,\306W.Zl(\3031\305\247!\002-"
+	.string	"\\8\"r"
+	.ascii	"\354:\274\270\373\204,\021Y\252\231e\206\326b\267\275wJ)\005"
+	.ascii	"V\001F\001N\001`\312|\260\373\333Rhe\253\377\374\360\374X\001"
+	.ascii	"\227\262\311\310H\2369\257\333\003;\347\226\302{\235\033\272"
+	.ascii	"\257\277p\217a#\233qR\315y\341\336X&[\335\327|\334O\366n\213"
+	.ascii	"\271\237\334`:\214\262\3050\264={k\301\360\271\351\271\367^\365"
+	.ascii	"\312\032\332^\223\352s\363\2311\033\271\371\224\314F\3562\343"
+	.ascii	"\310\326{\357u\231\341tt\325\366\232\030\314Z\257\206\223\363"
+	.ascii	"\306\275\261=\266\334\333\311\315\245\363\224\255W\243\221\356"
+	.ascii	"U\022\350\357^gV\257\254\325\366\312\316F\262\275\266\255\304"
+	.ascii	"\366\312\334Z\230\331\354\215Y\311\214\247\235\315\333|8\330"
+	.ascii	"\370\n\357\275Z\275>\023f\376!\376V\235\315F\252\262\221\216"
+	.ascii	"\216FED\306\342PKdW\365=I\311\rw\326HGu}T\217\022\f\036q\243"
+	.ascii	"%qr]D\354\032\354\fL\275=tqrM\244\036\320S\346OKyC\242\"\335"
+	.ascii	"\234,[\372f\304\215M)oE\274\250\036\021Q\023\244Y\363!b\327\222"
+	.ascii	"\270!\335J\321\305\ti\242\364M\210 \233\263CzU\223hZJ\372V\247"
+	.ascii	"&\371n\270\252\036\335{\215\340\324\324\004\367\336\036\323\336"
+	.ascii	"\006\207\346_\214\322\243]\251\223\210]\367^n4\273f\245fn\032"
+	.ascii	"\314\f\306L\224\027\336KN\336\3703\346\326\323\202h\272d\026"
+	.ascii	"\321yF@M\361\204\th\336\031CN\211\337K D\317)R\366\355\020\326"
+	.ascii	"\351%\237\365\377\331W\345\254\311\245\371!\323\201\2215\275"
+	.ascii	"W\315\0013\211\236c\002\253y\257\032\00391\276\270\357f\260\275"
+	.ascii	"\256\237U\007\020\315\017\033\016\373!\231\231FK\303\216\323"
+	.ascii	"{\257\003\261~3V\324\274\3672pcC\005\367]\215G\326\345\241\371"
+	.ascii	"!\367\230n\343\230\271\201\370\\7\344\357\277\367\236\3713\371"
+	.ascii	"\223\372\276\022\346*\326\231\212u\236b\235\013\260\316\004X"
+	.ascii	"g)\3269\331:G\261\316\003\240\210\316\002:\332\374\324:\007P"
+	.ascii	"\235\0018\251\316M\2523SC\233\221\252\363\222\022\353\234\324"
+	.ascii	"j\232\221\210\316G\035\330|l\235\215Z\347\242\326\231\250u6\266"
+	.ascii	"\316\305\326y\250%:\023Yg\226u^{\257[e\235\277\373\232\275\235"
+	.ascii	"\335\r!\351\301\226{\335\016\007\335\271\025\360I\367uC\273\003"
+	.ascii	"\273\325tG\271\243\203l\006\267:\312\246\r\033\345\213&\205\320"
+	.ascii	"V\303-\310F6\003\354@\3564f\177h\330\354o\253\241\r\310}\246"
+	.ascii	"\314\03130\332\2637&\036\314&$\332^\331.[\r\330\177\334e\002"
+	.ascii	"\\$\250U\372N\323\031\370\354\330\374\326\253>~\033\253m\325"
+	.ascii	"7\232\266\300l\262\371\255\276l\344\267\371\262\233\236\002!"
+	.ascii	"\323/}\323?!6!\310gz\025\312F\304\233\241\354\361\227\376\243"
+	.ascii	"lY\220<\241\337\320v7\344\343w\240\017=\263x\007\305C\364\034"
+	.ascii	"\315*\313-\203\255\3726f\245\357\300\343+u\232n\274'TZ\365\r"
+	.ascii	"m\273e\260A\346\226\236Q\351uC7\367^\34239\351\221\276\351\224"
+	.ascii	"Z\034\007\373Q9\233\027T\322S\325\3113z\256A\372V\323I)?zf\245"
+	.ascii	"\336\004\357%\322'\325\\\255\005U\323\323F\264\227\022\216\026"
+	.ascii	"&\301\317\306\"L\217^\205.\201\bv\353\007\n\245Yv\336{\327W\302"
+	.ascii	"F_\364'\366\006\231)\364\241\205\006\323B^ZF\337\240N\336\033"
+	.ascii	"\277\350=\272\006\245B\017\262\020e\350\325\324$\372\250\272"
+	.ascii	"\274'g\326\260\301{i|\256\271\264?c\177\352I\213_\b\310\353\273"
+	.ascii	"\255\330\241/\376C9\264\037\253c\207\356\343\365\315\241?\362"
+	.ascii	"u\361\211Ez[%L\272j\242\240\267\357\337\226\325\376\024\b\325"
+	.ascii	"\\\220\332\206\316\271\013M\275\367\336\177&3\267I47d\254\366"
+	.ascii	"o\277\007<\221 }}\3423\203\b\0211\300P\240x\341\202\005\363\200"
+	.ascii	"\002\fl\005\222X\307h>\001\306\305\200\201\202-\005\b\232\\4"
+	.ascii	"\177!XA&\366\302D\331\t\261\024&\276\264V\220\251PA\366\245\265"
+	.ascii	"B\314\204\n\255\2572\027Z\b\222L\306\002\254L\353\005\031Y\231"
+	.ascii	"\226\261\273\320>\r\311\367\224Q\232\272x\035\233S?\\\250\234"
+	.ascii	"zySO\265\305u\270\226"
+	.string	",SZ\n\\\301\263B\340\013\b\246Q\311\362)R\b`\221\336\207\302~M\315'a\310\251\223\261\343\312\267\344\223\374\001/\365\275&\030\365\311w\272\263\246\347\316\252\3174\361\3521Q\337g\352\362\352\330\217k\212\345\315\260\005M&cY\003\236\253\017\357\350\231\312(,\263\362\211+QFI25\365\343\243\357\b\362J\323\360\370L6\022)\202z\242\035\321U?==\2055\b\335\323w\364\200\034\033\037FP\337\321\247\207\302z\036\272\200*J<5\237k\301\344HF`5\345\302\252\246~dl\252)\240\207_\001f0'\302~Q\027|H\030\324T\310X\323\202f!S\037\\T\340\r\267\242\253\356h\303\350\301V\243t\367\220\333\212e\346\340?\254|\030\230\372Yz\022\n\360\314\025<\316\002T\023\316\013\331T\t-\371\004\370\236\262\3644,\202\t\274A\364L\006@\210\305y\310\200\362\035^H"
+	.string	"\017\325<\236\200\244\327\250\016!\337\311\351\313\366\320t\033'p\256\370\314\201&\250\2014#\035C33\"\222$\005I\007Q\005\304(\006\245\274\r\021\200)S\214h\302\024\266\260\261\031K\036\037\b\265\224\211\263S}\230\024\205\244K\335\237\003Z\262\207 ^\312\005\262[\276t\330\350\303j\205=\315\303:\356\345\3370\355Z64\350C\311\376\361\351\002\337}\376y\266\315b\200\242E\b\214P\026`\\V\202\316\204\200\304+"
+	.string	"mB<\305\022\t\261\266-4h\242\356x\331eb\347\246f\211\252\207\327\204\316\334\202\337H\372\003\201\205\240?\237S\252s\311\375"
+	.string	"[\025\263\273j\210\223\nlS7\342\031\237\202p%\311nn\266'\361;CgJ\320\356H\330\310\237\225\037\030\344\335\203\211\005\032C\217\2369\314\317I\237e\354Y\351\347\201\336\252y=\b\033\016\302\2747\244\225\261\330\212{\361\240S\037TR(#\245\024\n.N\330\017\2650\352\251\222[ak\253\036\177\234\203\361\246\rO\r\n\371\320Q\362\245\226~H]\3256\016C\350\026\r\215\347\347j\351\324QG$\345\223l>\357\323#:\210\205\270\302\343\007\023\357\210\035\342\006\".\324\226\037.V@$\177\210\312wd\206\307\247\f\264]\204\200M\252\352QHs=\31735\265(~\033\262-\252\361\233\210\332>\260\316\344"
+	.string	"\242jR\235\261\310,\226\371\007\005u\032\272s\225\340\021J&[K\033\024Z\004\200\024\262\204\314\322\001_.`\ta\373J\207\177\331'-twJ\213]qk\3352\214>\304\370D*\224\035\257\376xL"
+	.string	"O+\254r#\335\222\363\207\b_\254\312e\313\027\0205\203N\271!\254\3401\270\335\350J,\312\305\032\346e\264\253\265?f\270{"
+	.ascii	"\353Zh'v_L\334\361h\241\244yk\341\315\314,\3514^\232\300\262"
+	.ascii	"\227\270\337F\005J\020\007A\363\206\235zs\215\300\030t\216\222"
+	.ascii	"a\267x\\\343 @Z\2127OX\246q\333\035p~\305"
+	.ascii	"\215\003\260\200\374\206\220\021\254\205\364E%[\347cA\364.\264"
+	.ascii	"\002\352F*:\330\346\267\322t\200\224\201\200P\3203J\237\354y"
+	.ascii	"\303\224\203\n"
+	.text
+	.section	.gnu.lto_zeroCalibrationGetZeroV.part.0.37.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\270\002\345\021"
+	.string	"\006\336lI\340\262(\035@i\372\031\337\320\356\257\353\016\232\375\t\027t\222\r|N\002\f\207\\-"
+	.string	"\306Ca*\222\224\264\205\231\355\177g\203\235Z\221\364E\226\301\f\353\031\257GoC\277\370\n\310\347\220|.\fH\343\372\277\311\336)\005P"
+	.string	"\\"
+	.string	"X"
+	.string	"-n3\376f\366\222]\333N\306.\231\362\352\217\364j\362\005F\257\244\023\030\275\332ga\233\026\343\321\006r\362\266/\177t(w\273\373\275R\022\037O\2477\372/_\202\221\321p:\"\003\342\323\344\036"
+	.ascii	"\226\3355)\304]o{\305v\004\233\226\004\377GL\034\324\354~("
+	.string	"*\262#j\017\n\037\3470bw\341\277\2403C*v\3679,/\036\326\3339q\243f\267K.x-\335rb\307\311\276\342\207C\212\335qb\367K\232m\362\313\3216\031'\033\202\242\3639\234\354d\300n\310\211x@\373\315\354\204\334\231\230\352\0035\347I?6R^\303\307#2)\r\353\004\330\253\367H\b0\003\003K\306\003\023\304\246p\235u(\266\031<F+A\217\335m\020\236\347\202\201\333\356\246v2\274|\023\257\376l\364:)J\t\233\332,2\211\216\020\241\235D\223\322\230z\367\226\332\354:]\353\264\367\334O\353\364<\031\236p\022C\030\270rA\340r\267\254VR)\025\224\312\351\300\353\006O\256\220\005S\211-\254\n*\360s\205\255V\b~.\226\252\365\201\342\353;)pha%~\2600\024?\223\355yo\251\r\002QP\215\276\234D\007(\250F)\215\355J\205x\354\370\317u"
+	.string	"\315\333g\364Z\207<\232\003G= \260\002\231\232\344\006\300\274\177$\016fL\201\331\345\225z\261\205p7\177\007vN"
+	.string	"\316 y\367\306\344q\377\022\267\f\347\326|A\310\035~\216\3455\036\216\363I\f+\b5L$d\370\232\313\224\267\300\206\021\343\034\372\267i\221e9\237\0022\2239"
+	.ascii	"\256i`{\307\355\337\030XW\005\313\020\036\261\313\026\006s u"
+	.ascii	"%\264r\201\035\016\013\216\375\231\177Y\226\236sY0%\2570\013"
+	.ascii	"\334^\210\234\322\351\327\3661"
+	.text
+	.section	.gnu.lto_.symbol_nodes.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`g\001\315\b"
+	.string	"\262\31501pi\323\001\346\276~\372\007\001\355.=\004I \267^\230\317yo\022\315\377o\006"
+	.string	""
+	.string	""
+	.string	"84\373\357&\263~\373\377\240\320D\213\r\326\350N;\311\tml\206\003\005\013\bpolK\227\272\212a\306\255\345\363(\242\372\2759\376\317\3467|\251\263m\210\335\245\374ks$\301\321L>\201g\214\243A\250\374\307k\344\241n\312G\236\275p\321\241\240\362\3246\345\003<[\235\206\212*\237\321\f\243\227\213b^n31\213Z\234\351\005w\327"
+	.string	"\323\312\245\224XQ\313\024\235X*\371\367}\337D#\022\205D\364\241q\017\020u\304\207\016\330\241\231l5-\301!S3'8\307\335]\001\305\300\314\204\005\001( "
+	.string	"\003\031\232\362\020\264\236A2\230n~1\264\023c\222W\372m\206\327\327\001\227\363\261V\242Y\372\372\352apx\201\330\345\322\242$L\302\256\026\220}z@\370o\342\035L\274\303\204"
+	.ascii	"1\307\210\360\376\331\004\370\215\3245\034\203_\326\364\033\033"
+	.ascii	"\264U\235"
+	.text
+	.section	.gnu.lto_.refs.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.427c7c1f498cc836,"e",@progbits
+	.string	"(\265/\375`\001\031\315i"
+	.string	"\352\251\210%S0PJJ\007\257\276\372R\013\031\223\261\003\030\262\351\375\332\344t\263\321\337w\315\021W\361\347>\254\347j~\347\344\213\372o\355\334\223\322W\373\312\351i\254\351zb \245\241\313NK;\204G\251\313\332\263\352P\271<X\251\303\203\220\341\025\344I\311\2272\005\351\001F\002T\002<\330w\024\3736\262\314d\024k"
+	.ascii	"<\307\356.\243X#`\235\225\323xxX\230\240\201ea\247\260\031W\341"
+	.ascii	"3\246\302R\030\312h?'a%W\333{\223\354\224\200\005\243\261\030"
+	.ascii	"?o\214\355}\252\221\326\205\004Koh\356m\242]=a)\006U\370\253"
+	.ascii	"\354Q!-\266\\ (\234\304M\262\275P5\316nH}\202\237\275\030\215"
+	.ascii	"\303z\n`\272\267I\265\263\266\304\006\230\270{[\236\025+\020"
+	.ascii	"d\233\343F=W1\231\t78(\027\024G\271\n\306\264\331\035u\240E["
+	.ascii	"=\333`\217\003\313L\270\tC{8z\006\343\257\323$\333\353\274\267"
+	.ascii	"\305!\3721F\326\352\225X\337\013g'\247\241yY\234\005{\356Yq\270"
+	.ascii	"g}\017\313\317\3461>\342\374\344%\227\200\305}\311\333uo\313"
+	.ascii	"O\365\336#s\0027\314\t\360\222\030r\f[\325+\300\036\005{5\032"
+	.ascii	"Ve\235U\005\243"
+	.string	"X\337,\363\260\316z\242e\024+\313:kN\214\017\376\266Q\306\003\374\214\034\303\340\017\374]\003\017\217L\203\261l.\306\031\370[\350\347\027\367g\236\237w~F\3613\001?\013\3603\0028\\\347o\246\237]\334p\001\r\242#\304\230\346g\226k~\300\337^1n\3637\221\237!\260\341\276\277]@\341\007\315\337@\374\254T\303\3771\377\337\376\303\375\227\373\037\367\277L\312\177*\377\247\374\214T\343\277\231\231\377iO\341\006\374\315\343g\032?\023\177\026\376\034\374\331\203\237/\370\231\350\347\030~~\341\347\025~\366\371\031\205\237M\370\271\204\237?\370\031\203\237\177~F\340g\003~\266\371?\367\363\002\377\307\376G\377C\371\357\300\317\n\374'\373\037\343g\025?\037\360\363\315\317\374\363\377\327\375\247\373\017\343\177\003\377\317\376\337\324\325\325\325\375\252\364\337\225\3759$\004\306$E\210\244\355\260\211\311A)\223\367\306"
+	.ascii	"ZI\346RM\3312Yz\257\361\271t\227\334\336\333\274\267\0073\001"
+	.ascii	"i\322\312(E\252\335\350I%[#\363pB\372`\322\264\310\253\246,\302"
+	.ascii	",Z\272w\313u\242\300\310\306\366\336\253\303E\032\371\336\245"
+	.ascii	"vy/"
+	.string	"\222\t\203\024\223\261\350\260\27467ylB\372`\372\226\220L\035n\021 \030J\351\364\301\004z\262\304yu\221\255\221\257\356\226\346\222u\032\333\253\274\367\362\233\r\031h\226\270 \340zjiQ\304@\037\355\346\327\325\275\367\204\217\013\234\223\347\031\313\334A\241J\022D\n\0342\036RH\372\007\252\2331SF\255V\333\2076\005\013\351\222\303\216(\373\336q\223<q/\021^\323\356\241\241:*\013I\217\236bh\367\220\242\246\nK\207\227U=w\341 \202\207*iK\265\016\206\366\216\336\32190\350\232*\213\263j\253\204a\325\357\260\330\357\210\260\337\ra\243\376^\262\363\321f\356\264\0250TqAX\337S\337\300at\372\322j;\335\204\0013\343j\365;\034\354\377\336\241m0\264\233\376\316\241\227\272\211n\332M|\245\231\352\246+V\364\306\236mVVe#;\311r\315\334\351M\267h-\265\332:"
+	.string	"\275\225:\353R\252\2758;i\331\322\231V\233u\326\365\252\261\316\252\266\317\3671\n/\214\n\222c\033\237=\2562\037\317\276=6rlH\255V\177\256\373\231\213\273\230n\247lb\336\347\275m\016M\222,3:Z\345\271\036\022.\313\211\031\266e+e\344\312\360\031\206\262\231\237\325X\211.6\303WX.\256\314\024\307(\326\204cU9\356I\264\215\b\026\366\374\305c\230\215\341X\355\251\"YbJ\206\3050\224\307L0\206\263\260\340\345\206\224\026\317\n\237X\262EbU\337j\316 \337\260Z}Wa?\001\227)\240\266Gw_K\001vX\2332\365\362$v_Kv\211\017*\323\256-\217J\341\222\336{\247\274\004\177a0\034\206\241\354\306]\316k\214\305\215\265"
+	.ascii	"\2606EG\024\317\212\036\325\025)R\237\372\366b\337F\330\267\025"
+	.ascii	"\373\026\202}3\331wW\002\360R\333\301\2759\225P\342}\305-\214"
+	.ascii	"X\\o\325(\235\230\252\232\260\275\346\224)\235\306\236\270\310"
+	.ascii	"5\350U\215\027s\232\206\366N\353M%\277\030[\355*\275\305S\"\314"
+	.ascii	"\226\262V\373\214\312\232\305\366\326\310\310\332,\203\260\256"
+	.ascii	"\251o\b\326\023\230\262\267\031_\221\362\001\331j'\321B\372H"
+	.ascii	"\326\326\031(V\031S\026\025\313jA\201\322R\232%\332\244\217*"
+	.ascii	"(\255~5\262\354\023\350\241-\025\341\006\231\256\321\305\321"
+	.ascii	"\320]\257\033}K\371\251\214\036\221\264\220]\022\034Oe\330X\226"
+	.ascii	"\313\330\307\272\tK\335]\333\322fKj\305\b&\357&6mw\253H\253\215"
+	.ascii	"D\013\251)\302\311\215H\253}\004K\275\230\340\232Z\355\347\243"
+	.ascii	",\2233')\374\364\355\020\025\205J\232\244\305\222\264\223\247"
+	.ascii	"\246\244\305\224\264\323\205\2535:-\037\020$K\236\204\275\235"
+	.ascii	"=0_\236\270Zm\260\336\342\251\375\230\n\362\345\304\005\013\331"
+	.ascii	"W\353[B\006\207\021\207G[\220\034\264\330\363x`u\027Vs\255LE"
+	.ascii	"tW\021\315u\302]\243\323R\307\252\222KH\336\\\353\334\223\211"
+	.ascii	"\224V;\253\267zkrOc\266\264vf\226U\200\034i'\236\230VS\227#m"
+	.ascii	"\204\3652$\332\032)\242\036\233\234\211j\037\3323Y\320\272\214"
+	.ascii	"Ha\303\006F\254K\253\347]\366\252\032{!\204h\253\365^n\231O\313"
+	.ascii	"+\265\354a\233^\350\037\r\344]\325D\252\332\2125\336kl\357\023"
+	.ascii	"G\227ktqWJ\252ge\342\212\013b\310\333\352n\276{\273\356\275\005"
+	.ascii	"\334\230u\311\372\321j\017\321Bhz|\265\271\t\t\302\026\266D\017"
+	.ascii	"\236Kjq\322D\360\r\254\034\316Z\275\230G\331\bt\013\211V\257"
+	.ascii	"\002a\257.\261\177\377\353=.\357\275Q\274\366J\221\276\225y\347"
+	.ascii	"\236\337\206w\352N\003\270{\225\024\201[\2514w\300]\305\335\340"
+	.ascii	"^\023\224\311\3462G\351<\032sl\264M(\245\263\t\225s[\260\035"
+	.ascii	"\327\031\304\275\312$\323\330\307\333^\250\0237\331\204b\357"
+	.ascii	"q\252l\3572\347\266\307%\337\346R\371<\032s\224\316\246Q\351"
+	.ascii	"dB\345(\333&\324M^#\233\004\2737\311\204\312\321j\233W\351<B"
+	.ascii	"\235P:\231\001\302!\260\205\232\341\017\030|\241\004$b\215\206"
+	.ascii	"?\"\244_1H\tH\024\300\213|~\210C\240\222\321\220\210h\024\f\032"
+	.ascii	"\035\255E\304$\023\224\200D=\0312d\004\005\005\223d \022\201"
+	.ascii	"CCIA\005\004\001\213\302\027\304\021\006\b\nB\261#\034\002[("
+	.ascii	"\002C8@\206\f\236\b|\212\303\337\f\237 \"\016\020\370\220\321"
+	.ascii	"\020\210\004\234\201=\005- hQA\215\336+p\021\201\213\b\326W\340"
+	.ascii	"\002\b\310E\013 \366-\200v\305\2370(\003\257(4\301\f\031L\274"
+	.ascii	"\310G\211\200\032\\\003\333\300J\\\024\032\n\213C@\031\303_\360"
+	.ascii	"7\024T\024*\276\310\207XT\374\035\r\200$t\264#\n)\001\211\212"
+	.ascii	"\304\036\f\0304\200HDA\241\320\321\032D\003\210$t\264\256\300"
+	.ascii	"\244\340O\006\021\260\370\013&\035%\r\r\375N"
+	.string	"\004\177J\273\242\220\t;/Rq\341\f\340\360\247(\024\016\177L\020\005\205ED\340\260(\005%\240\007DE\"\016P(\350\205p\b\264A"
+	.string	"`\361W$\362R(\016\177E\242\211\242\020\021\006\360\310\250\310>\006 \213\026-$"
+	.string	"\222\300g\347\026X\360B\205\n1B`\207|\220\204F\305\3370\006\243\340o\350\007Ixt$\034\372A2\372\035\375\f\r\211?>\b\020a"
+	.string	"m0\n\242!$B2\242\341\013\n\205\035\b\361\200\303\244\240\321\017\004\032\302`\360\347+\"%\t_"
+	.ascii	"\2033\216~D\023\304\243\337\3607c}\373P\262\314\321\003\371\206"
+	.ascii	"\003\025\375\001\312\356\350e\245\"\2332fgtr\017Oi\316Vi\230"
+	.ascii	"s\273;\327u4F\026\252L\225\305\375M\367\256s\203s\322\344\255"
+	.ascii	"\311\031\256\336\264\251\210#f\254p\320\322\346\222e\310\324"
+	.ascii	"\234\2311\031B\356\313Y\324\310\221VyN1b\232\f\017{\275\304z"
+	.ascii	"\230\362\242\304\251Y\031\363&\343v\343$\203\206\205\261<\036"
+	.ascii	"\300\200\3517\316\342\203\216(v)n\354H\207y\277=\372\305\310"
+	.ascii	"\225\225\234\330\031\035V,\217\314\315\255\277\254c\3222e\252"
+	.ascii	"\020e\274\270\\\314\373\013Ki\344x0\347\232X\036\221\027\330"
+	.ascii	"\316\326^\030\354>\261\330\224T\017\017X\026-]\336^p\3564K\\"
+	.ascii	"\253\255\245\2714\227\226"
+	.string	"\224\034\\\332\032\254\231\343\311\233O\355J\353k\013w\251\021S\204\n\\/\311\256S,X\372\212\006W\273.\263\035~\320\302\366\230\324\324:\201\361\250\2610\207\024D\"\"\"\"\"I\222\244\003Q\005\204\030\347\244\324\016\022\240\0041\322)\307\220\031\032\021\021\221\024$I\266\326\n\244\316\305\305)\037\315\324\371\250\202\344\034\205\2469DZ\205\340\302\306\223Z\331=\206=:\227b\333b\333\206\311\2260\016\354\214\316O\017\330H\365\001\025r\207I\362\217!\251\266^\243\263\035\235\021YU\237\265\332\324I\017@,Bf\321\323\244E\256\217\205\227\256\311\222\206\261\257i\312\335\220\352\344\251,\225r\252\334\026\365\002\266k\357\370${\355H\2748\rB\027?v\346\373\337K\305\002!\2429\021\317\342&\2533\340\311?\233\253\267\030\254\215\007\033\227\325\275w\216\222[\255r\307XGB%%\335\bf\246\222\005\376"
+	.string	"\nn\365\233)B\b\331\023P\3370j\2419P\325\242\313\344y\247\377l}\340z\005\246'\031\006\350\206\256\2046\020\340D9s\265Sv\210\325a\201\240\352\374#\341\255|N|\035\350i'\266\220\363\221Ay\340\213/P\350Z\366\312o\034\362AvU\345[\322\340\254\347\302D'\375z\345\235\316c\372\201\375\361`\367k`\223p\317x$\350\006/|la\024\253\0032j\251\254\344\023^\257\b\301B\242\275\327\260\3603\001\312e\037G\013\361\353h\271d\241\01340C*E]\331\255\275\013\t,pa\371#B\354\337A=E\217G\220\270\242R4l>c\004\257O[|\023a\226\272`y }\341RwV\035\260\230$'\025\305\334O$\223\332hC\277}\324\224\363\024(\272\223\257\374\255\240\027\316\302"
+	.string	"m\004\364\225\352\027D\027d'!\266V\301Z4\013\215\360\302k"
+	.string	"\021\034\013\312\367\201N1g\020\257\037n_hg\331;\225\346\035\234\036\252w\364\343\237?T\254\300S\2611\233\372\233\033\006z8dE--\025\035\030\024\267\237f<\r\206\213\372!0\362\037|3\301X\210\313\202\245X \303\340R\253\006\353\206\215\241\262\236d\260_Y>bO\323E\351\321\016\313\262.+G\355\235\206\366\310\023\2501\217\b- \205\227\224\007`^|\341\221\347\234\023\201Q\310\351\274\022\315m\224\352\233\205&\022f*k'\340\315\305u\345{,\361yzb1^\342\275\024$\274H\276\300\261\240\r_\274\030\232o\270\004\264\263\030&\262Q4\2604\273\3104c\344\035\316\fBSD\260\336\344\320\362\031Z\311\b\366\316n\003\203\203\255u7\303m\311I/\374ij\263\177\204)\004\013N\326\235\022f\310\f\013n"
+	.string	"@\"D-\n\003\203{\b\364\214\220#[bo\3452\202 <\264\366O\005\005B^\031\033\343\235\bv\314Ul\327d=\230\036\251\326\205*T\242\356NP\0024l\251<\020\f8A\366\2108\267\360=\3548<A\030\366X\252\237$\375\303\035\3702o\372\371}\016t\213\274\217x\200\217(\322\362I\360\001:.\371\323\274\262\361\256\2563`Y\243\333\351\232:\235\336\tx\n:\352\211Q\222\225\035>\253\263\020\374\265\033\206\351\261\r\332Joy\246\332\215\202e\330\036\272\362s#v\1778wi\267\n\323o\267\177i\220\313\306\021\370%\3078\351\207\013\334\271;\251\201m\333\347\257\234=\355\204\227\343\023\232\314m?\374!\343~+\315=\2611Uuv\266a\247^j\270\356\342\256\307\306#\361s\256Y\003\033\013~\360.%\327\3266\245\277v\270"
+	.ascii	"*8=7\274nk\360=`\220\373e\3308\247\267\217\323\274\371\211\357"
+	.ascii	"4\215_\355E\371N[\f\317\032\237:\260\r\307\260\n"
+	.text
+	.section	.gnu.lto_.symtab.427c7c1f498cc836,"e",@progbits
+	.string	"zeroCalibrationStartS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"zeroCalibrationIsCompleteS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"zeroCalibrationIsSuccessfulS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"zeroCalibrationAddValueS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"zeroCalibrationGetZeroS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"zeroCalibrationStartV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"zeroCalibrationIsCompleteV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"zeroCalibrationIsSuccessfulV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"zeroCalibrationAddValueV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"zeroCalibrationGetZeroV"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.427c7c1f498cc836,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
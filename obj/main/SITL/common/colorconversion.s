@@ -0,0 +1,4642 @@
+	.file	"colorconversion.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/color.h"
+	.file 4 "./src/main/common/colorconversion.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	colorconversion.c.74adb262
+	.weak	colorconversion.c.74adb262
+colorconversion.c.74adb262:
+	.long	0x1a4
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x8
+	.long	.LASF716
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF697
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF698
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF699
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF700
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF701
+	.uleb128 0x2
+	.long	.LASF703
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF702
+	.uleb128 0x2
+	.long	.LASF704
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF705
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF706
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF707
+	.uleb128 0x2
+	.long	.LASF708
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF709
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF710
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	.LASF712
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x8
+	.long	0xd4
+	.uleb128 0x3
+	.string	"r"
+	.byte	0x1e
+	.byte	0xd
+	.long	0x85
+	.byte	0
+	.uleb128 0x3
+	.string	"g"
+	.byte	0x1f
+	.byte	0xd
+	.long	0x85
+	.byte	0x1
+	.uleb128 0x3
+	.string	"b"
+	.byte	0x20
+	.byte	0xd
+	.long	0x85
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.byte	0x3
+	.byte	0x3
+	.byte	0x23
+	.byte	0x9
+	.long	0xf4
+	.uleb128 0x6
+	.string	"rgb"
+	.byte	0x24
+	.byte	0x1c
+	.long	0xa9
+	.uleb128 0x6
+	.string	"raw"
+	.byte	0x25
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0xb
+	.long	0x85
+	.long	0x104
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF711
+	.byte	0x3
+	.byte	0x26
+	.byte	0x3
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF713
+	.byte	0x4
+	.byte	0x34
+	.byte	0x10
+	.long	0x13b
+	.uleb128 0x3
+	.string	"h"
+	.byte	0x35
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x3
+	.string	"s"
+	.byte	0x36
+	.byte	0xd
+	.long	0x85
+	.byte	0x2
+	.uleb128 0x3
+	.string	"v"
+	.byte	0x37
+	.byte	0xd
+	.long	0x85
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF714
+	.byte	0x3
+	.byte	0x38
+	.byte	0x3
+	.long	0x110
+	.uleb128 0xd
+	.long	0x13b
+	.uleb128 0xe
+	.long	.LASF717
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x12
+	.long	0x19d
+	.long	0x19d
+	.uleb128 0xf
+	.string	"c"
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x2f
+	.long	0x1a2
+	.uleb128 0x4
+	.string	"r"
+	.byte	0x1d
+	.byte	0x1c
+	.long	0x104
+	.uleb128 0x4
+	.string	"val"
+	.byte	0x1f
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x4
+	.string	"sat"
+	.byte	0x20
+	.byte	0xe
+	.long	0x91
+	.uleb128 0x10
+	.long	.LASF715
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0x9d
+	.uleb128 0x4
+	.string	"hue"
+	.byte	0x22
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x7
+	.long	0x104
+	.uleb128 0x7
+	.long	0x147
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 21 "./src/main/common/colorconversion.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF718
+	.long	.LASF719
+	.long	.LASF720
+	.long	.LASF721
+	.long	.LASF722
+	.long	.LASF723
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x16
+	.long	.LASF0
+	.byte	0
+	.long	.LASF724
+	.byte	0x2
+	.long	.LASF725
+	.byte	0x2
+	.long	.LASF726
+	.byte	0x1
+	.long	.LASF727
+	.byte	0x1
+	.long	.LASF728
+	.byte	0x5
+	.long	.LASF729
+	.byte	0x6
+	.long	.LASF729
+	.byte	0x5
+	.long	.LASF730
+	.byte	0x2
+	.long	.LASF731
+	.byte	0x5
+	.long	.LASF732
+	.byte	0x5
+	.long	.LASF733
+	.byte	0x2
+	.long	.LASF734
+	.byte	0x2
+	.long	.LASF735
+	.byte	0x4
+	.long	.LASF736
+	.byte	0x2
+	.long	.LASF737
+	.byte	0x3
+	.long	.LASF738
+	.byte	0x3
+	.long	.LASF739
+	.byte	0x2
+	.long	.LASF740
+	.byte	0x2
+	.long	.LASF741
+	.byte	0x2
+	.long	.LASF742
+	.byte	0x2
+	.long	.LASF743
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF383:
+	.string	"SITL 1"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF699:
+	.string	"unsigned int"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF695:
+	.string	"HSV_VALUE_MAX 255"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF710:
+	.string	"uint32_t"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF693:
+	.string	"HSV_HUE_MAX 359"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF715:
+	.string	"base"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF507:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"__uint16_t"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF713:
+	.string	"hsvColor_s"
+.LASF714:
+	.string	"hsvColor_t"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF716:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF696:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF707:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF708:
+	.string	"uint8_t"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF23:
+	.string	"_LP64 1"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF461:
+	.string	"__PMT"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF508:
+	.string	"__always_inline"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF712:
+	.string	"rgbColor24bpp_s"
+.LASF711:
+	.string	"rgbColor24bpp_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF709:
+	.string	"uint16_t"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF702:
+	.string	"short int"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF692:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF706:
+	.string	"long int"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF548:
+	.string	"__stub_stty "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF717:
+	.string	"hsvToRgb24"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF703:
+	.string	"__uint8_t"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF471:
+	.string	"__P(args) args"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF700:
+	.string	"long unsigned int"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF374:
+	.string	"__unix 1"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF694:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF358:
+	.string	"__k8 1"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF697:
+	.string	"unsigned char"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF705:
+	.string	"__uint32_t"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"signed char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF698:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF376:
+	.string	"unix 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF736:
+	.string	"long-double.h"
+.LASF738:
+	.string	"stubs-64.h"
+.LASF722:
+	.string	"/usr/include"
+.LASF742:
+	.string	"stdint-intn.h"
+.LASF730:
+	.string	"libc-header-start.h"
+.LASF720:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF741:
+	.string	"wchar.h"
+.LASF734:
+	.string	"timesize.h"
+.LASF737:
+	.string	"stubs.h"
+.LASF725:
+	.string	"stdint-uintn.h"
+.LASF721:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF723:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF731:
+	.string	"features.h"
+.LASF740:
+	.string	"time64.h"
+.LASF0:
+	.string	"./src/main/common/colorconversion.c"
+.LASF719:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF739:
+	.string	"typesizes.h"
+.LASF727:
+	.string	"colorconversion.c"
+.LASF1:
+	.string	"/root/repo"
+.LASF732:
+	.string	"features-time64.h"
+.LASF743:
+	.string	"colorconversion.h"
+.LASF735:
+	.string	"cdefs.h"
+.LASF726:
+	.string	"color.h"
+.LASF733:
+	.string	"wordsize.h"
+.LASF718:
+	.string	"src/main/common"
+.LASF728:
+	.string	"stdc-predef.h"
+.LASF729:
+	.string	"stdint.h"
+.LASF724:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 {%\001"
+	.string	"\320o"
+	.string	"\002"
+	.string	"\211\372\266\203\b0\002"
+	.string	"\002\001\002\002\001\002\003\001\240\342\234\212\n"
+	.string	"\003"
+	.ascii	"\237Cz'\322\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 *\r\001"
+	.string	"\270\036"
+	.string	"\001"
+	.string	"\001\003\002\004\002\002"
+	.string	"\002\001\002\005\003\001\001\020\004\006\003"
+	.string	"\003"
+	.ascii	"*\002\244\204\277\001,"
+	.text
+	.section	.gnu.lto_.inline.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375`\302\001m\t"
+	.string	"\"\317-+\200)I\007\246\205\211M\306h\203\017\240\004\351\254*\202\216\225\004\227dX\206\034\001++\217\201\235\206\324\205O\017\357F,!{\247\377\253\225\223\33220e\214\235\214i\2551mZ\323\234\315\335-\3471\r\221i\017\265\324"
+	.string	"%\024\021\007<U\037i\202q\361\260\316\326\023\202\023-\024p.=\035u\262\236\020\336\032\353\2204\321V\031Y\307\354\331\361"
+	.ascii	"\333\366\306\321IQ\024e\254Wh\013\275\300\247\025{I7\360\032"
+	.ascii	"*\241\304\335\3009\326\211\005w\372\034K\301\347\213\270\203"
+	.ascii	"\270\205\t_t\317:\005\t\022\027\220\245\357Y\013\237\001>\004"
+	.ascii	"l\210H*\266\370\033'\001: \320\002\241\354\034r\200\237\231["
+	.ascii	"\241P\350o\360\035\b\021\322\236\260\r\227u\020\201\205n\315"
+	.ascii	"\305\265@1\24306\254\223\334\330.d]\310A\bb\234L\210\201\020"
+	.ascii	"\2300\222\001\361\204\200\240\340\250d\023\304\232;*G;\033#\212"
+	.ascii	"H\006\266\b\363\204\203\316\244\321$^\313\270\334\033\005\365"
+	.ascii	"k\357\016\303\2703{J\001\001\356\"\017w\214\345\0043\250\265"
+	.ascii	"\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 \025\215"
+	.string	""
+	.string	"X\t"
+	.string	"\001"
+	.string	"\001\001\003"
+	.string	"\002\001"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\001"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 8\205\001"
+	.string	"T\002,"
+	.string	"\001"
+	.string	"\001T"
+	.string	""
+	.string	""
+	.string	"\001\002\t"
+	.string	"\002"
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.string	"\020\b\020\002\004"
+	.string	"\020\020"
+	.string	"\001\002\n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\2730[n\333"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.lto.17639bf762c1d2fa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hsvToRgb24.0.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375`n\016]7"
+	.ascii	"z_L\024<@\350J\007\341X<\376\347\242\207\325\036\007|O\376\332"
+	.ascii	"\177X\347!\223;Hh\274\3151)\324;\205^\t\262\357h\252\341\360"
+	.ascii	"\207Z0>\n\330\\a\224\335\217\206\334[n\222RJ\001*\001\026\001"
+	.ascii	"5\001l\225:\033Q\347*\353Le\235\001T\347\251\352,U\235\243\254"
+	.ascii	"3\224u~\262\316N\326\271\311:3\241\3166uNSg4u\256\251\363\231"
+	.ascii	":\027Q\347\257\316^\235\333\204\331\027\252B\367\006I\264t\001"
+	.ascii	"\235s\262\264`\367`7a\237^d\306\301}\246\325\364\232n\303M\316"
+	.ascii	"\210M\031\022i\237^\211\260\206\326y/\037a\210\264\317\337\201"
+	.ascii	"\246\323\340\350A\032Z\366\336\2765\177\036\322>\265\212J\263"
+	.ascii	"e\233\301\321\2025\212W\n\333\0306\205\367.\301\372\344\ri\237"
+	.ascii	"R\336T\325\373\230\271w\240\215\236\272\327\357O\234{\227aL\226"
+	.ascii	"\366\311\314\334bz\f\016\246\273ZJ\311\353 \006/\315\244{\227"
+	.ascii	"G^\266\261\366\2316U\355\363\2434]71\331\024\255g\361\235\216"
+	.ascii	";M\017ORY\327M{LH\354'\323\033\350\013-\025e+\002\036jt\352%"
+	.ascii	"\351>!H\360\220L\312\035\325\346\371\255\341\255>!J\320\"\312"
+	.ascii	"\326\227\247\244\037J\251\243\250u\357\3556\355=\224w\356(\333"
+	.ascii	"\275\227=\251\314kvjf\346\303\314n\314P]\001\216\340\224\370"
+	.ascii	"\275\267\356\377\t\2378sH\207Wbc\222\266oA\267\256\363fe\250"
+	.ascii	"\355\243\246\0046\021\343\220\f\337\204\255e\347\207\374\337"
+	.ascii	"\211]\243f\3706D\376\335y\"\373\3777\036\""
+	.string	"3\\\313\361\3172*\333\315\215\032\310f\323\021\370\354\374\220\231S4\234\025\351\275:\316\270\337\344(d\221\336{\333J\237\3346j\237\375V\207\002\355<\221s\b\272~\310U\207\202\256\0372/\353\272x\357\275\376O\230\273x\357\275\374~\314=\330\254\241\005\233\333\232\2609C\007vc\250\316\027\252\263\005\353\\\301:S\260\316l\251\363\204\324Y\002\352\034\301:\257Yg\b\325\371AuV\253\316i\325\031\315:\237Yg3\353\\\206:\223Y\3471\353\354\240:7\250\316G\353,f\235\303\2543\203\324\031,u^\200:\177Yg\005\326\331\253:wU\347\004\325\231\313:#\260\316\007\254\363\026\352\254e\235\rX\347\002\3259\253:\023\250\316X\325y\200u\026`\235\257\254s\200\324\003o\020\373\352\005<\312\f\360T\177\365EC\344\026\253\017`\3745\253?\007!\377\252\336\330\203\272\355\253\2762\221s\356"
+	.ascii	"<\025\200;\211\272\353\3249:R\216\004a\364\035#\242\\GsN\316"
+	.ascii	"\224\333y\235_\251\217\372\251o\344^\372RP\037\365\225\271\326"
+	.ascii	"4\352\323C\375\331D\002:}\323?}#\267\264\275\323\0275<\3237}"
+	.ascii	"#\377\230\376\r\361\020\347\312\\\002a\2644\"\352\260\331c\f"
+	.ascii	"u\003\002\252\363K\314\313\272\346Z\223\347w\376\223I\334\224"
+	.ascii	"N=C\356HE\366\344\275\363\341\210\373\321#2\342.\364I\212\270"
+	.ascii	"\233-\025\347\"\372\273|\207\270\021\361\242\364\336\272\336"
+	.ascii	"\343\366\252\314w\001\231\205\367\336\257.\304\314\213"
+	.string	"\272\367\230\231\027\245R\256\220\273\274_}\332\257].\022G\344\265\366\252mo\337\233H\300\2730\032\276\007\323\327\360m\230\242\237~q\020\022\261\376\371\3507rK\177\375o\026\331N=\2773|\361\335\020\017\321K\221C\013\n\004\210\211\207\366\303\354\263\244\237\371C\357\001\021\305,\242\365\214x\222r\357=\303\323yJ0\317\321y'\351\336$\003-\334f\274\f\267\030\017\027\303\355D\021nN\305\363\330\331\330\t\024nehbXo\315ob/\342V\304\220\203\233\361\"\356M.\256E\234\013\027qo\307\027+\334\\\034\337\344b\034\305\2708\016\006\234\334QF\\\234\334\261iy\373\375\330\007\351\322{\355:\231F\215\317\356\357\330\007\355\020\352\376\304\304\304KMd.\234\0214c\341\037\374\205\no\201\302W`\373\265\2470\341\331$L\210\360\022\"|eB\3705\bb\036\224\t$\363\340\275\031\306\305"
+	.ascii	"\206\371\"\251k\027&-`\276xa\222\306e\213\226%jY\260\\I{\264"
+	.ascii	"WK;{4\263?+\373\2617#\37322\007?\346\340\337\260\352A\352\212"
+	.ascii	"\304B\r\026\351*T\246\fi\020\005\312\223\343w}\003\261?\376\325"
+	.ascii	"\233\260\027{\224\311\340\025|\030\3303X\360\216\327`_\277\340"
+	.ascii	"\353+\323\353\025xA\r*\273\234\3645\351Bl\324m)\245\224\200\311"
+	.ascii	"\336\022\256\317\372\004\b\236\353Q;\007\036\301\327A[o\340\017"
+	.ascii	"h"
+	.string	"\375\226\326\237\315\002o\240\200$%zI\f\263\216\030)\322IGvY\357MG\213\272\013Q&\226\017\001a\364\274\021Q\256l\316\361\361 @~\314\351!\340=\222<\260~\300\023\300\022\360\003\376*\201\037\250AT\346\234*\221\221\240\240 )H2\214\001A\006\304 Ud\335\021\2408\211\230)\023\223$\205B\007\261\031M\274\034y\212\262\242\013\365\260\306,m\266\245\224:Pj\0334h\002\242.\311{\b\266\026&\260\320\370\021\372\345l$d\200\220=\265\245V\222\222PMV\342\312\332Ro\266Xa\304y\225\202\226\b\340\251\017\240h\212\t~@\304\3419@S=\303\262\227\2600\252\0312|\")\212s\232\321&\301Y_b\271(\212\205\003\327\267&\311\373\360\364\267\267\270\355\250\331\254\007\n\352w\371;\230P\342\204#\350 \212\273\373PF!]\3740\013U\245\361\365\343]\234\r\341|u"
+	.string	"\017\277\3109\367\305$^uY_\242>N\266\253\246\2773[\347@ \300b\216(\215\231\204?\026\256\237?\375.\234u3<\207j\177\021^\354\321\240\017\nJ\361\366\021\023\022PS\262P\233\366<\326\3425\263p\302\253\360\357t\340\363{?}|)uRg\224\223`\3110\243,\\j\221D\n\024\020\201/\304\022\332\016\031/\354\241M\225\251A<*,;\032\226\210C\2305B\220G\2246\313}\270\020o\316\361<\245\333\217<\325\305%\243\2261`\262[Z?\240\226z\302\260eJ\255\243|6T\322\212\211"
+	.ascii	"F\030\374~<\207}\211\316\234IQ-\227\036I!\261:\270\335~oB\r\226"
+	.ascii	"\203\r\313\326\262z2U\336L\353D$\351T\262\235\237T\241\315\242"
+	.ascii	"o2G^Ec\2436\023\037\031\275.\021\235^\240N\254\375x:\237'\357"
+	.ascii	"&~\216\362\252\3421\022\b\376\330z\377\363\002\230M\3352_\233"
+	.ascii	"\030\031\344\217Q\300d{\2346a\276\031\367\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 '9\001"
+	.string	"#"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\001\f\300\204\001"
+	.string	""
+	.string	"\003"
+	.text
+	.section	.gnu.lto_.refs.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375 n\235\002"
+	.string	"\344\003j"
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	"\001\001\021"
+	.string	"\001\001\023"
+	.string	"\001\001\025"
+	.string	"\001\001#"
+	.string	"\001\001-"
+	.string	"\001\001/"
+	.string	"\001\001>"
+	.string	"\001\001\300"
+	.string	""
+	.string	"\001\001\302\307\311\323\330\344\346\363\365\367\373\376\212\001"
+	.string	"\002\001\216\001"
+	.string	""
+	.ascii	"\f\004\001@\300\001\006\004\034`@\300\001\006\004\\\241\224\001"
+	.text
+	.section	.gnu.lto_.decls.17639bf762c1d2fa,"e",@progbits
+	.string	"(\265/\375`\026\007\005+"
+	.string	"\352OD\021Gp\\N:\377\007\343\305\313\335\352\201\034\262^\037\030\337\021\361\224\246\316c\003`=TZ\265nbA\255\241\201\002_\025\n\b\264J\004\224\344R\307\265\330\374g\003\255\016\221\326\235>\003\340\312\202\377\f\021\221!\215\310\024\336"
+	.string	"\007\001\375"
+	.ascii	"X\370\n\267q\313lL\345\\\205\255\274\274\335mw\373|>\"\223\256"
+	.ascii	"\353\354\0165O\002U\300C\247\031\002e(\034\205\333#\226r~\302"
+	.ascii	"g\347\021\336\276\345\017;P\232\224\346A\240\347\243\223\227"
+	.ascii	"L\362\321\371\017h\311B'3a4n\215\330\311\227\232\316K\321\272"
+	.ascii	"\254\373\006\001\335Qr\207Ni^\003\372\363;79\001a7\335D\317F"
+	.ascii	"''\331\350|\211\016\340\241\223\210\207\316\237\315~&\3432#\336"
+	.ascii	"\372\202m\265\356\333\013\2723`\204\225\346/\017\235(\013\235"
+	.ascii	"\377\307\374\217\373\017\367\337\311\177\271\377d\330\332\376"
+	.ascii	"_9\372\357!I\347\177\201\237\353\376\317\371\217\374\257\346"
+	.ascii	"\177\226\377\017\376K\371\217\340?\232\377g\376\317\375\337\362"
+	.ascii	"_\313\377\262\377@\377\277\374/\223\311d\362\177\330\317I\377"
+	.ascii	"\311\024mD\007\027\327\026\214\375\261\245\265b=\274)\213\365"
+	.ascii	"\334\221\210\266\351\355\265\273\331\016(N\2252HVS\364cf\206"
+	.ascii	"\333\\i\236\315\320[\366\343\345\365\203-\315\033`\355\013\212"
+	.ascii	"\2143s\001\\\f13\226\246\034\233\341\226\347\016\306h\"\247\320"
+	.ascii	"u\367\034{a7!\025\261\356.\362\371|\216\250p5N\363Mb\316\304"
+	.ascii	"\336\226\210\221\3412\034\307-\303\361\230\363=\237\301q\030"
+	.ascii	"5\261\356\353\363\021\371|\274\224\250m\250y\006\202\236\177"
+	.ascii	"\240\347\036\350\231\007z\006C\317n?w\341%\234\026\242[\355\356"
+	.ascii	"\002A!5\322J\223\237\374\316_\204N\242\361v\020oM\313V\235\034"
+	.ascii	"(\217\205\270\034\241\352\025)e\245\371\363\026\326\362\263\303"
+	.ascii	"\007\031 \245\231\345\022\361\210\261\261E\2444\3172\320\363"
+	.ascii	"\2225N\023\300\353\376j#\306gKM\314\306\227\323\370\315ha\214"
+	.ascii	"\r\335\204\377wfc5\236\202\200E7\373u@G\235'd\310\356\033v\377"
+	.ascii	"}6\340\240#\306\316\rP\21357,Yn\320q\f\034\262\322l\271\216\251"
+	.ascii	"\360\222Uhtq\203\376\345\177\266\220\330\3351xn\257\r\177\316"
+	.ascii	"<g\244\037\210y\314\340\277\331\274\004q\335_aw\247\227#\215"
+	.ascii	"\273\322\374\257\240\377\377B7\207U=\022{k+L{.\356\261\270\266"
+	.ascii	"\307b"
+	.string	"\257/\032\215n\303\272W\225MKa\337.\016h\365XD[H\267\336&\366\372\n\211\334G\342\252&L{k{L\327\226-\366\326{,\266\332)\252\242u\253l\261\227\344\036{m\205\305\001k\313\2468\302x\214\tai\355\330V\265\273\f$QY\342\333zY^\353N\325\266\232x\354\276\301.XS\203\244k\303\267\256\036\243zS\256\001c\b\306\372\334a\277\255FX\253\255\356\271\206\301\224rz\273\233\253\207)wo]b\367\220\rad9\216\213\330@\255\n_\f\301\330\237\255!\313\025ZQK\023$$\005yw\300\264$U\325\001\350a\352*H\205EU\205\236\311)\202\323\323\212\236?AI\200\222p\376\t\352\367\203r\372\241w\372\361\264\262\242N\234\220bZ\222\252\n\006\005\271\212\245X\252*\310S!\"\310\323\272U\222\201\003OP\005\225\264\200\300\240R\200\024\234\025\205!E\226\025"
+	.ascii	"\255(\247\037j\305ZQOZXW(z\276\344\264$5B\004\023\205\244\003"
+	.ascii	"\257P\001\203\202\017\0332\240SIX\300\253\254 U\n,\340T\020X"
+	.ascii	"\002h\302\004pJ\t\353J\204\t\245\251`\226"
+	.string	"RR\203,>\333\341;\334\"q\322G\275\335\372\310\331\341P+\315\227;\3203\322\031\304Hu\326\364\264!\271\204\224f)\367;\317\221\303o\274\306l\243\2114\243k\"\021\302\313#ZN\3711\033ns\246;\035#\321\333^\036\310\274\346 \333hD\352i\361\006\311\330\335\031\031\347\247\033\201\2003Cr\344\210\003\007@\233\"Ht\274a5]\304\354X]\327\233\027\001\311\3259IS\232\177\303\001w\250\201(\206\2143\312\210\210H04$Mr\200\002\021\262\242z\021\260%\242FN\222$m\006\322%\341\007*\016k\323\360K\316cC\004s\025]\374K\350\304\213\256\224\233Q\302\345e\245J\271\251Ycd\335\344\333\236\310Q\345^\2573\001\002\310B\".\222h\230Z\fn?N\211u\307\316\227\021:$\260\274\223%\354\356 c\305\211]F\230\313\333\337>8 \231Wd\3346\020\210\353\267"
+	.string	"\324QL\233\b\322\200\274l\370x\235J\345\213\200\301\tS\335\272H\241\343\244%\203LF\204\371\t\n,\322\005\002\024\321_a~\021Y\366\330\\I\364\272w\326\253Dde\232P=\001\311?,EL\256\347M\252\372\264\245\202d\035\r\177R0\316z"
+	.string	"\323:\233]o\274 a\250[<]:\276\252"
+	.ascii	"\332sL\273\233\377C\377\334\363\204\004\nj\372\246\374\334\300"
+	.ascii	"\"\321\365\346\374\272\036\f\367\216\177\324c\371T\206\033\262"
+	.ascii	"\303_\025"
+	.text
+	.section	.gnu.lto_.symtab.17639bf762c1d2fa,"e",@progbits
+	.string	"hsvToRgb24"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.17639bf762c1d2fa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
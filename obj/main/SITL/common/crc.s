@@ -0,0 +1,5838 @@
+	.file	"crc.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/streambuf.h"
+	.file 4 "./src/main/common/crc.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	crc.c.5c7bcde2
+	.weak	crc.c.5c7bcde2
+crc.c.5c7bcde2:
+	.long	0x42c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF744
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF709
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF710
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF711
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF712
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF713
+	.uleb128 0x5
+	.long	.LASF715
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF714
+	.uleb128 0x5
+	.long	.LASF716
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF717
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF718
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF719
+	.uleb128 0x5
+	.long	.LASF720
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x9
+	.long	0x85
+	.uleb128 0x5
+	.long	.LASF721
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x9
+	.long	0x96
+	.uleb128 0x5
+	.long	.LASF722
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x14
+	.long	.LASF745
+	.byte	0x10
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x10
+	.long	0xd7
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x1b
+	.long	0xd7
+	.byte	0
+	.uleb128 0xd
+	.string	"end"
+	.byte	0x1c
+	.long	0xd7
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x85
+	.uleb128 0x5
+	.long	.LASF723
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x3
+	.long	0xb3
+	.uleb128 0xe
+	.long	0xa2
+	.long	0xfe
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x9
+	.long	0xe8
+	.uleb128 0xf
+	.long	.LASF724
+	.byte	0x4d
+	.byte	0x17
+	.long	0xfe
+	.uleb128 0xe
+	.long	0x91
+	.long	0x124
+	.uleb128 0xb
+	.long	0x37
+	.byte	0x3
+	.uleb128 0xb
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x9
+	.long	0x10e
+	.uleb128 0xf
+	.long	.LASF725
+	.byte	0xda
+	.byte	0x16
+	.long	0x124
+	.uleb128 0x10
+	.long	.LASF726
+	.byte	0x21
+	.long	0x149
+	.uleb128 0x8
+	.long	0x149
+	.uleb128 0x8
+	.long	0x85
+	.byte	0
+	.uleb128 0xa
+	.long	0xdc
+	.uleb128 0x10
+	.long	.LASF727
+	.byte	0x22
+	.long	0x163
+	.uleb128 0x8
+	.long	0x149
+	.uleb128 0x8
+	.long	0x96
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF746
+	.byte	0x3
+	.byte	0x3a
+	.byte	0xa
+	.long	0xd7
+	.long	0x179
+	.uleb128 0x8
+	.long	0x149
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF728
+	.value	0x1ac
+	.byte	0x9
+	.long	0x85
+	.long	0x1c4
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x1ac
+	.byte	0x21
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF729
+	.value	0x1ac
+	.byte	0x32
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF730
+	.value	0x1ac
+	.byte	0x41
+	.long	0xa7
+	.uleb128 0x3
+	.string	"p"
+	.value	0x1ae
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x7
+	.long	.LASF731
+	.value	0x1af
+	.byte	0x14
+	.long	0x1ca
+	.byte	0
+	.uleb128 0xa
+	.long	0x1c9
+	.uleb128 0x16
+	.uleb128 0xa
+	.long	0x91
+	.uleb128 0x6
+	.long	.LASF732
+	.value	0x1a1
+	.byte	0x9
+	.long	0x85
+	.long	0x21a
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x1a1
+	.byte	0x1d
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF729
+	.value	0x1a1
+	.byte	0x2e
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF730
+	.value	0x1a1
+	.byte	0x3d
+	.long	0xa7
+	.uleb128 0x3
+	.string	"p"
+	.value	0x1a3
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x7
+	.long	.LASF731
+	.value	0x1a4
+	.byte	0x14
+	.long	0x1ca
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF733
+	.value	0x195
+	.byte	0x9
+	.long	0x85
+	.long	0x259
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x195
+	.byte	0x16
+	.long	0x85
+	.uleb128 0x1
+	.string	"a"
+	.value	0x195
+	.byte	0x23
+	.long	0x85
+	.uleb128 0x7
+	.long	.LASF734
+	.value	0x197
+	.byte	0xd
+	.long	0x85
+	.uleb128 0x11
+	.uleb128 0x3
+	.string	"i"
+	.value	0x19a
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF737
+	.value	0x18b
+	.long	0x2a3
+	.uleb128 0x1
+	.string	"dst"
+	.value	0x18b
+	.byte	0x23
+	.long	0x149
+	.uleb128 0x2
+	.long	.LASF735
+	.value	0x18b
+	.byte	0x31
+	.long	0xd7
+	.uleb128 0x3
+	.string	"crc"
+	.value	0x18d
+	.byte	0xd
+	.long	0x85
+	.uleb128 0x3
+	.string	"end"
+	.value	0x18e
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x11
+	.uleb128 0x3
+	.string	"ptr"
+	.value	0x18f
+	.byte	0x13
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF736
+	.value	0x180
+	.byte	0x9
+	.long	0x85
+	.long	0x2ee
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x180
+	.byte	0x21
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF729
+	.value	0x180
+	.byte	0x32
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF730
+	.value	0x180
+	.byte	0x41
+	.long	0xa7
+	.uleb128 0x3
+	.string	"p"
+	.value	0x182
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x7
+	.long	.LASF731
+	.value	0x183
+	.byte	0x14
+	.long	0x1ca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF738
+	.value	0x17a
+	.long	0x31e
+	.uleb128 0x1
+	.string	"dst"
+	.value	0x17a
+	.byte	0x26
+	.long	0x149
+	.uleb128 0x2
+	.long	.LASF735
+	.value	0x17a
+	.byte	0x34
+	.long	0xd7
+	.uleb128 0x3
+	.string	"crc"
+	.value	0x17c
+	.byte	0x13
+	.long	0x91
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF739
+	.value	0x169
+	.byte	0x9
+	.long	0x85
+	.long	0x369
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x169
+	.byte	0x24
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF729
+	.value	0x169
+	.byte	0x35
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF730
+	.value	0x169
+	.byte	0x44
+	.long	0xa7
+	.uleb128 0x3
+	.string	"p"
+	.value	0x16b
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x7
+	.long	.LASF731
+	.value	0x16c
+	.byte	0x14
+	.long	0x1ca
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF740
+	.value	0x160
+	.byte	0x9
+	.long	0x85
+	.long	0x390
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x160
+	.byte	0x1d
+	.long	0x85
+	.uleb128 0x1
+	.string	"a"
+	.value	0x160
+	.byte	0x30
+	.long	0x22
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF741
+	.value	0x15a
+	.long	0x3c0
+	.uleb128 0x1
+	.string	"dst"
+	.value	0x15a
+	.byte	0x26
+	.long	0x149
+	.uleb128 0x2
+	.long	.LASF735
+	.value	0x15a
+	.byte	0x34
+	.long	0xd7
+	.uleb128 0x3
+	.string	"crc"
+	.value	0x15c
+	.byte	0x14
+	.long	0xa2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF742
+	.value	0x149
+	.byte	0xa
+	.long	0x96
+	.long	0x40b
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x149
+	.byte	0x26
+	.long	0x96
+	.uleb128 0x2
+	.long	.LASF729
+	.value	0x149
+	.byte	0x37
+	.long	0x1c4
+	.uleb128 0x2
+	.long	.LASF730
+	.value	0x149
+	.byte	0x46
+	.long	0xa7
+	.uleb128 0x3
+	.string	"p"
+	.value	0x14b
+	.byte	0x14
+	.long	0x1ca
+	.uleb128 0x7
+	.long	.LASF731
+	.value	0x14c
+	.byte	0x14
+	.long	0x1ca
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF743
+	.byte	0x4
+	.value	0x140
+	.byte	0xa
+	.long	0x96
+	.uleb128 0x1
+	.string	"crc"
+	.value	0x140
+	.byte	0x1f
+	.long	0x96
+	.uleb128 0x1
+	.string	"a"
+	.value	0x140
+	.byte	0x32
+	.long	0x22
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.file 21 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 22 "./src/main/common/crc.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF708
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF702
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF707
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF747
+	.long	.LASF748
+	.long	.LASF749
+	.long	.LASF750
+	.long	.LASF751
+	.long	.LASF752
+	.long	.LASF753
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x18
+	.long	.LASF0
+	.byte	0
+	.long	.LASF754
+	.byte	0x3
+	.long	.LASF755
+	.byte	0x3
+	.long	.LASF756
+	.byte	0x2
+	.long	.LASF757
+	.byte	0x2
+	.long	.LASF758
+	.byte	0x6
+	.long	.LASF759
+	.byte	0x7
+	.long	.LASF759
+	.byte	0x6
+	.long	.LASF760
+	.byte	0x3
+	.long	.LASF761
+	.byte	0x6
+	.long	.LASF762
+	.byte	0x6
+	.long	.LASF763
+	.byte	0x3
+	.long	.LASF764
+	.byte	0x3
+	.long	.LASF765
+	.byte	0x5
+	.long	.LASF766
+	.byte	0x3
+	.long	.LASF767
+	.byte	0x4
+	.long	.LASF768
+	.byte	0x4
+	.long	.LASF769
+	.byte	0x3
+	.long	.LASF770
+	.byte	0x3
+	.long	.LASF771
+	.byte	0x3
+	.long	.LASF772
+	.byte	0x3
+	.long	.LASF773
+	.byte	0x1
+	.long	.LASF774
+	.byte	0x2
+	.long	.LASF775
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF701:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF742:
+	.string	"crc16_ccitt_update"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF692:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF727:
+	.string	"sbufWriteU16"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF383:
+	.string	"SITL 1"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF711:
+	.string	"unsigned int"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF695:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF732:
+	.string	"crc8_update"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF739:
+	.string	"crc8_dvb_s2_update"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF698:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF737:
+	.string	"crc8_xor_sbuf_append"
+.LASF722:
+	.string	"uint32_t"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF707:
+	.string	"__bool_true_false_are_defined 1"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF708:
+	.string	"CRC_TABLE_SLICES 4"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF507:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF716:
+	.string	"__uint16_t"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF726:
+	.string	"sbufWriteU8"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF376:
+	.string	"unix 1"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF548:
+	.string	"__stub_stty "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF693:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF703:
+	.string	"_STDBOOL_H "
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF728:
+	.string	"crc8_sum_update"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF724:
+	.string	"crc16_ccitt_table"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF744:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF697:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF719:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF720:
+	.string	"uint8_t"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF729:
+	.string	"data"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF746:
+	.string	"sbufPtr"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF733:
+	.string	"crc8"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF23:
+	.string	"_LP64 1"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF741:
+	.string	"crc16_ccitt_sbuf_append"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF745:
+	.string	"sbuf_s"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF461:
+	.string	"__PMT"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF743:
+	.string	"crc16_ccitt"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF706:
+	.string	"false 0"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF725:
+	.string	"crc8_dvb_s2_table"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF704:
+	.string	"bool _Bool"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF736:
+	.string	"crc8_xor_update"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF721:
+	.string	"uint16_t"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF738:
+	.string	"crc8_dvb_s2_sbuf_append"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF714:
+	.string	"short int"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF740:
+	.string	"crc8_dvb_s2"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF705:
+	.string	"true 1"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF718:
+	.string	"long int"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"length"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF723:
+	.string	"sbuf_t"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF715:
+	.string	"__uint8_t"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF735:
+	.string	"start"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF699:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF471:
+	.string	"__P(args) args"
+.LASF694:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF712:
+	.string	"long unsigned int"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF374:
+	.string	"__unix 1"
+.LASF700:
+	.string	"EXTENDED_FASTRAM "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF731:
+	.string	"pend"
+.LASF358:
+	.string	"__k8 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF709:
+	.string	"unsigned char"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF734:
+	.string	"crc_u"
+.LASF717:
+	.string	"__uint32_t"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF702:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF508:
+	.string	"__always_inline"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF713:
+	.string	"signed char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF710:
+	.string	"short unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF696:
+	.string	"UNIT_TESTED "
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF766:
+	.string	"long-double.h"
+.LASF768:
+	.string	"stubs-64.h"
+.LASF752:
+	.string	"/usr/include"
+.LASF772:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/common/crc.c"
+.LASF760:
+	.string	"libc-header-start.h"
+.LASF750:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF771:
+	.string	"wchar.h"
+.LASF774:
+	.string	"crc.h"
+.LASF764:
+	.string	"timesize.h"
+.LASF767:
+	.string	"stubs.h"
+.LASF755:
+	.string	"stdint-uintn.h"
+.LASF751:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF773:
+	.string	"build_config.h"
+.LASF758:
+	.string	"stdc-predef.h"
+.LASF753:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF761:
+	.string	"features.h"
+.LASF770:
+	.string	"time64.h"
+.LASF749:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF769:
+	.string	"typesizes.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF762:
+	.string	"features-time64.h"
+.LASF765:
+	.string	"cdefs.h"
+.LASF756:
+	.string	"streambuf.h"
+.LASF747:
+	.string	"src/main/build"
+.LASF775:
+	.string	"stdbool.h"
+.LASF763:
+	.string	"wordsize.h"
+.LASF748:
+	.string	"src/main/common"
+.LASF757:
+	.string	"crc.c"
+.LASF759:
+	.string	"stdint.h"
+.LASF754:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 \326\235\004"
+	.string	"\264\007\312"
+	.string	"\r"
+	.string	"\310\262\354Y\002\002"
+	.string	"\002\001\001\266\215\250\327\005\002\211\347\351\211\f\024\002"
+	.string	"\002\001\002\003\243\314\273\237\004"
+	.string	"\004\345\243\375\213\t\002\002\003\002\004\005\235\372\252\212\013\006\210\272\364\200\002\003\002\004\007\234\215\261\247\002\002\002\005\002\006\b\306\303\302\240\016\002\t\325\257\266\264\004\004\002\005\002\006\002\007\002\007\n\352\306\375\201\006"
+	.string	"\013\231\277\202\330\006\002\f\370\260\206\207\t\002\002\002\002\002"
+	.string	"\t"
+	.string	"\342\302\235*X\020"
+	.string	"\210\241\022\006_\t"
+	.ascii	"\226\004\326\200A\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 \356E\003"
+	.string	"\242\304\r\026\260%\351\f\3030,t\030\206a@\226\t\261{o\322\366\2262\005\0171\177\001\367\024\316\354[z\303\b\355\240U\266\002\331\2172\311\251\260\344_\223;\363t\356\342@\024"
+	.ascii	"2e\241\225\324 j\204`\020\30630\257\206\030\030i@\037\f\366\204"
+	.ascii	"\202\202\024H\200B\341\233s\341Q\302\202\013\200\311 \223\r`"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.inline.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`!\002M\t"
+	.string	"\322\315-0`k\222\016 \"_0t~\322\365f\352\310\335\016\364\361L\033^p\241!\252M\207\001!\310\301h\340\0022\262\205\246\241I\353f\375-\331r\247\267\n7:\037\214A\205\034\235\017\206\340\351\307\t\215\3472\200\237\205\306siK\214\302\214\213\223iG\267\243\252qq2\222\307\305\311DKf\263\273p\020\231\031\361\220\037\302\241\007\354\310L\200\241\nR|l\256\204\n^|l\256\203#S\212\255\241\025\354\016\200<\261\236X\305\277\177T12S`\244\264\252\225iQ\300\177\222z\355WU\"\323\202p\033\2737\362\f\214\375Q\357~I\357~\016\315\314\214~\032\013\0021 \240\"*\262\033@\022*r\f8/\221\036\230\f_b\206\201_++\017\252\001T"
+	.ascii	"\t}i\344OW\304\2506V#x)\260\370,H\020\300\264d\334\"\327\305"
+	.ascii	"%>w\354\f'\333\b\315qm\201\2774\034dL\242\263\320r/h\t\020\032"
+	.ascii	"L\306I+\240x\016\264\310\177\206y\211N\222t\326a\270\266\260"
+	.ascii	"K\222\351!\261\353\n>\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"\345\003"
+	.string	"\322\305\021\031\260%\351\f\303"
+	.string	"$IB\230\200\264\203+\034\310-&\244\221F\330&2\311C\007\rF\370/\210\030\026\325kqDJ\273\265\005&\331HiV\261\253x[\253\nKH\300s\f\354\021\374\203\206\025X\342\271\263\007\001\025"
+	.string	"U\220\005Hl\031\215\205R\324 \0370\314`\022\201z\007\243\254\247\0250.d=\230\201\021\305\tTh\311$\220f\021\230\264\002\221\275\\["
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.pureconst.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\200\004\002\265\004\003\230\004\004\200\004\006\265\004\007"
+	.ascii	"\231\004\b\205\004\t\231\004\n\200\004\013\205\004\f\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 \266\r\003"
+	.string	"\344\003\252"
+	.string	"\n"
+	.string	"\002"
+	.string	"@"
+	.string	"\002\003\200\007\300\005\300\007"
+	.string	""
+	.string	"\001\002\003\002"
+	.string	"\274\006"
+	.string	""
+	.string	""
+	.string	"\200\210\221\370\357\b\004\002@\006\007\001\002\r"
+	.string	"\001\002\007"
+	.string	"\001\300"
+	.string	"\300\b\004"
+	.string	"\t\002"
+	.string	"\024"
+	.string	"\013\f"
+	.string	"\016"
+	.ascii	"3;\361\323\361\213\263B\2611\202\bbG\022\354\201\354@gQ\025m"
+	.ascii	"\tH3L\220\341\006\332"
+	.text
+	.section	.gnu.lto_.lto.de8c7e893e0719dc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_table.0.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`95-\343"
+	.ascii	"\352\222\035UJ\200\216\004n:0J\354\354\320Q\344\313:\221\272"
+	.ascii	"\004\235xgffffF\313\220\213\316L\353\020\034\022J\365\237\204"
+	.ascii	"R\375'\241T\377I(\325\316Q\274U\262\360\205\222\365\355\212\365"
+	.ascii	"\255\222\365\335,\215G'{\357\275eJS\r[\005\013\005@\005\314\206"
+	.ascii	"\353f\307\265\\\3175]\3279\202'x\317\025|\301\031\274\301\035"
+	.ascii	"\334\347\017\016\341\021.\341\023N\341\025n\341\027\376s\f\317"
+	.ascii	"p\r\337p\016\357p\017\377p\020\007z\210\213\370\210\223\370\006"
+	.ascii	"^\342&~\342(\236\342*\276\342,\336\342.\376\3420\036\3432>\343"
+	.ascii	"4^\3436~\3438\236\343:\276\343<\336\343>\376\343@\036\344B>\344"
+	.ascii	"D\036\364\"7\362#G\362$\027\272\222\017}\311\231\274\311\211"
+	.ascii	"\356\344O\016\345Q.\345SN\345E\257r\243[\371\321\257\034\313"
+	.ascii	"\263\034\351Z\276\345\\\336\345^\236\364/W:\230/=\314\305|\314"
+	.ascii	"\311\274\314\315\374\314\321<\315\325|\315\331\274\315\335\374"
+	.ascii	"\315\231\016\347M\217s9\237s:\257{\204O\370\336+\374\3023|\303"
+	.ascii	";\274\357\037\036\342#^\342'\236\342+\336\342/\376\367\030\237"
+	.ascii	"\361\032\277\361\034\337\361\036\377\361 \017\374\220\027\371"
+	.ascii	"\221'\371\r\276\344M\376\344Q>\345U~\345Y\276\345]\376\345a>"
+	.ascii	"\346e~\346i\276\346m"
+	.string	"\376\346q>\347u~\347y\276\347}\376\347\201>\350\205~\350\211>\370Eo\364G\217\364I/|\245\037\376\3223}\323\023\337\351\237\036\352\243^\352\247\236\352\213_\365\306\267\372\343_=\326g=\362\265~\353\271\276\353\275>\371_\257|\260_~\330\213\375\330\223}\331\233\375\331\243}\332\253\375\332\263}\333\273\375\3333\037\356\233\037\367r?\367t_g\021l\202\355Y\005\273`\031l\203u\260>\373`!l\204\225\260\023\226\302VX\013{a\177\026\303fX\r\273a9l\207\365\260\037\026\304\002m\210\025\261#\226\304n`K\254\211=\261(6\305\252\330\025\313\242\201m\261.\366\305\302\330\030+cg,\215\255\2616\366\306\342\330\034\023X\235\022\314 \006C\b\276\036\f\330\036\334\360e\336q\311\227y:X\257\221f\233yt2\317\203/\363`\370F\024\251\256|[\231\347\302\227y#|\231W\023"
+	.string	"\3465\b\300\3508"
+	.string	"g1#"
+	.string	"\363T\3702\017\303"
+	.string	"eN\007h\2048\004xI\221\347\324\305\227yA\n`\036\304\002~\222\f\200z\342\313<\t\007\354v\036\300<\r\b\030m\020\201^\233\223\200\210\322\004\230G\344\313\274f\005\374&\305\002m\365\273@\234\020\0066\"2@\201\252\313</\r|Ml\300\307\303\227y_\035\210\202\362"
+	.string	"\363\344>"
+	.string	"\001!\bZ2B\220D\302\227ya#`^\026\t\024\022J`\206c\002g\352\320`\203\227\023$"
+	.string	"\r\005\3143JAG\265\250\300\205DV\300\274 _\346\271\265\200yW.\340\300\031\337\016\261\201\001\232\303\020\363\200D\"X\t\266\003[\221\213\r\031\265\260\354\310Q\254\220\230\307\220\304<\032aQK\311gl\b"
+	.ascii	"\235%\346)\360eb^Q\f_\346}\020\335\003\311\251\331\324"
+	.string	"\236\230\347\003\205VD\365\214\224\224g\201M\325\r\251~t|\213\314+\251:\020n\030\271\230V\022LG\026X\360e\336\t_\346=\360\315b\036\0202\206K\253\210\212/\363\242\270\016\220\312\256\260\036\257\005\212d\247\230|\371\022\207\222yK`\005\250[\356\\\204Q\241\360\025c^\027\034_\3465\221}`\253\214ySfo\276\263\217\037\276h\314kK;\b#RC\206\254\331\260\260\365\305B\233\334\f_\346\221\275e\300x\300\254\3109\200\353\3525\017\250\220q\314\023\223k@\022\337\267\265\003:\037\2229\250\203\001A\350\331I\250\222\350\035l=)0/\271\020\002%\206\340\\\203\267m\340\320\241\341\243\211{8\300r\202\030\303\210hP\2218\201\230p\245 \n\346uU\034\240h11r\261\345\362;\250z\303`^Q\306\002\3144\332\216\033\036l\340\220\251\351h\300\362\030[~4\326\r\210\323 "
+	.string	"\033\003&\204\316C\204yG#\027H#\231r\333\200'X\""
+	.string	"\021\023\346\265\234\034\0209\2400\317&\005\344L\305\355\212\357\n\363pXH\220\320\322\fY.\313\260\227\241\021\214\253\240\305\260\305\213\314\301\\\307\214\027\024\r\305W\215\nxl\246&n\334Hp\030$#\347E\250C$\307w\207y?\036\233\322S\323\364q-\342O\317y\001\271EU\220J\204\320\301Ph\b\354\204\b\302\"\b\304T\364\3044R\243:\222"
+	.string	"\027\322\nP\322\321\203\220\fL)Aj\3509\025KW>Lp\033M\235QB\264"
+	.string	"\235\023q\370\364\244"
+	.ascii	"\345@:Q\f1&\005\2465u\244F\245\001\244b\217|T\271Z\214\361\340"
+	.ascii	"j\310\212s\330\216\t+Wd@,'\322d\2310 \021`\305W\213ye[\375 \306"
+	.ascii	"\345Id\027K\365\274^\220\223d \310W\232\214\262\221\326\300\\"
+	.ascii	"\222\226,|\303\230\027\"\346F\242\261\306i#s\016cY\223\314\354"
+	.ascii	"\240i\346\214I\026\320\202\232\322\\\nN\215\223(k\352\005\033"
+	.ascii	"\273\374\264\035 \371\334\322\246\336\034\270\305\324\200\002"
+	.ascii	"\216\215=M?S\306u/J\316I\352\346\272i\211\216yM\016\276u\314"
+	.ascii	";\3312\207\t\337\223\355\001\037\034\234\300\003\001\275uJt\327"
+	.ascii	"9\321\311\223\242\225gE/O\213\026;/\232\354\374\265\331\211\321"
+	.ascii	"hgF\253\235\032\315vn\264\333\311\321\314\263\243\233\247G\313"
+	.ascii	"\235\037Mw\2028\302\t\364\336\031\342\013\247\2107\234#\356;"
+	.ascii	"I\034\342\334\300%\316\022\2478M\334\342<\361\337\211\342\031"
+	.ascii	"g\212o\234*\336q\256\370\307\311\342\300\263\305EN\027'9_\274"
+	.ascii	"\344\204\361\2233\306SN\031_9g\274\345\244\361\227\263\306cN"
+	.ascii	"\033\2379o\274\346\304\361\2333\307sN\035\3379w\274\347\344\361"
+	.ascii	"\237\263\307\203N\037\037:\177<x\002\271\321\031\344H\247\220"
+	.ascii	"\013\317!\037\236D\316t\006\235x\026\371\323i\344Q\347\221O\235"
+	.ascii	"H^<\223\334x\n\375x*9\3269t\344\271\344['\223w\235M\236<\211"
+	.ascii	"\256<\235|y>\271\330\t\345dg\224\233\235R\216vN\271\332I\345"
+	.ascii	"lg\321\335\316*g\236Fo\236V.w\036\235\356\274z\204\023\353{g"
+	.ascii	"\326/\234\310o8\265\336wn=\304\311\365\022g\327S\234^oq&\377"
+	.ascii	"w~}\306\251\374\215\023\354;\316\345\177\234a\017<\305^\344\034"
+	.ascii	"{\222\223\354K\316\262?9\315>\345<\373\225\023\355[\316\264\177"
+	.ascii	"9\325>\346\\\373\231\223\355k\316\266\2779\335>\347|\373\235"
+	.ascii	"\223\371='\334\377\234\315\017:\343~\350\224\373\3409\367F'\335"
+	.ascii	"#\235u/D\021~\210&<\023\332{\"\252\360O\350\302G\241\f?\2056"
+	.ascii	"|\021ux#\352\373#\372\360X(\304#\321\210\337B%\276\013\235\370"
+	.ascii	"$J\361J\264\342\227\250\305\213\241\027O\206\376\336\f\305x4"
+	.ascii	"4\343\325P\215gC7\336\r\345x&\332\361M\324\343\345\320\217\247"
+	.ascii	"CA,\002\n\264=4\304.\240\"\266\001\035\261>\224\304B\240\033"
+	.ascii	"X\t\264\304R\240&\326\002=\261?\024\305f\240)v\003U\261\035\350"
+	.ascii	"\212\375@Y,\020m\261\"\250\213%A_l\t\ncO\320\030\233\202\312"
+	.ascii	"\330\025tF\003\224"
+	.string	"\306\272\2405\026\006\265\2612\350\215\245Aq\254\r\232cqP\035\263\231\255'\236!\257B\373\"\211\260\220\332"
+	.string	"\350\202/\021\3374\276\\|\241\022h\274\370J)\330\264\220\t\024\006\337\"\276kN\025\364Q\343[\302\367\327\353\212\352\t$/7\276)|7\3706\034s\224g\021\254\252\347\240\343`*\017\034|\223\250\336<\002\345K\203\357\021\337\266/*\006\034\276\306\205\233ON5\227QW\260\001\235\360\315\200\t\341\013\3264\327+s\262,\344\304\f\320R\242\341\207/\031_,\276L|\205\344^\200D\276Rt1\003\020\351\005\n\261 \276f|\221nv\346\bZ5\025|\205dT0\3027\302\251\256s\306\214W|#\370\372\360u\341\013\262\024\307w\330l\371p,\210\232\036\276b|\217>\343s\344\016\331\262g\0242\251V:\370\262\360\365P\202;\206\335X\361}\340\273\3449\212\365@8}l\320\302\267\311w\330(qKK|A\370\272"
+	.string	"}\370F\\\215\361\345\341\373`\025\326Jp*J|=\370\262\270IG\323\n_&_a\003\214|\227;\2768\240\306\013_9\276L|\261\370\222Ih"
+	.ascii	"h\202-\253\314/\346\352\232\370\206\230\300\370\\\035\206\023"
+	.ascii	"\337\021\2762|\205*\264\316\370\"\371\232\005Q4\207H\303\305"
+	.ascii	",\321\361%\276%\251\260\351|8\360\255\342\013\326\"E4%\337\034"
+	.ascii	"\276/\r\033|S\334xH|3\370\236\260\031\265\332\0240\311\367\206"
+	.ascii	"\357\202w\340\2701\360\245\342\373\325\306\367H\003e\210&&\201"
+	.ascii	"/\024_.\2704\242\213\r,H\320\206\274\345\311h\213\357\f_\004"
+	.ascii	"\244(\276+]|k\370\366\370\376JL\324\232\202|\327\342\2120L\372"
+	.ascii	"\305&\250\300W\212\257\227\017\3770\020\007\261\020\0171\021"
+	.ascii	"\007\271\210\215\370\210\2218\211\205\254\304C^b&nb\";\361\023"
+	.ascii	"Cq\024K\361\024Sq\221\253\330\310V|\344+\306\342,F\262\026o1"
+	.ascii	"\027w\261\027'\371\213\225\f\306K\016c1\036c2.c3>c4Nc5^c6nc7"
+	.ascii	"~c&\303q\223\343X\216\347\230\216\353\032\241\023\272\327\n\275"
+	.ascii	"\320\f\335\320\016\355\353\207\206\350\210\226\350\211\246\350"
+	.ascii	"\212\266\350\213\3765Fg\264Fo4Gw\264G\1774H\003;\244Ez\244Iz"
+	.ascii	"\203.i\223>i\224Ni\225^i\226ni\227~i\230\216i\231\236i\232\256"
+	.ascii	"i\233\276i\234\316i\235\336i\236\356i\237\376i\240\016j\241\036"
+	.ascii	"j\242\016vQ\033\365Q#uR\013[\251\207\275\324L\335\324\304v\352"
+	.ascii	"\247\206\352\250\226\352\251\246\352bW\265\261\255\372\330W\215"
+	.ascii	"\325Y\215l\255\336j\256\356j\257N\366W+\033\254\227\035\326b"
+	.ascii	"=\326d]\326f}\326h\235\326j\275\326l\335\326n\375\326\001?\364"
+	.ascii	"\2533Peo\240`\335\201.\373\003\rk *\326\"\350X\223\240d]\202"
+	.ascii	"\226\365\tj\326)\350Y\257\240h\335\202\246\365\013\252\3261\350"
+	.ascii	"Z\317\240l]\203\266\365\r\352\3269\350[\357\240\314\356A\341"
+	.ascii	"\372\007mv\020\032\327C\250\\\007\321\2716B\351\032\t\255ka\212"
+	.ascii	"\320\3034\241\231\322^\023S\205~J\027:*e\350\251\264\241\213"
+	.ascii	"\251C\033S_\037\323\207\306J!\032\231F\364V*\321]\351D'S\212"
+	.ascii	"V\246\025\275L-Z,\275h\262\364\327f)F\243\245\031\255\226j4["
+	.ascii	"\272\321n\256\322\314\224\243\233iG\313\245\036M\227~8B\n\342"
+	.ascii	"\275\024\350\013i\2107\244\"\356KG\034\"%q\211t\003\247HK\334"
+	.ascii	"\"5\361_z\342\031)\212o\244)\336\221\252\370G\272\342\300\224"
+	.ascii	"\305E\322\026'I]\274$}\361\223\024\306S\322\030_Ie\274%\235\361"
+	.ascii	"\227\224\306c\322\032\237Im\274&\275\361\233\024\307s\322\034"
+	.ascii	"\337Iu\274'\335\361\237\224\307\203\322\036\037J}<\230\376\270"
+	.ascii	"Q\n\344Hi\220\013S!\037\246C\316\224\02291\r\372SZ\344Q\251\221"
+	.ascii	"O\245G^L\221\334\230&\3711\025:V\252\344\310t\350[\351\222w\245"
+	.ascii	"L\236L\233\\\231\022}\231:\271X\372\344d)\224\233\245Q\216\226"
+	.ascii	"J\271Z:\345l)\225\273\245Eg\246U\336L\215.\227Z9]z|\204\364\352"
+	.ascii	"{)\326/\244Y\337\220\"\337\227j=D\272\365\022)\327S\244]o\221"
+	.ascii	"z\375/M~F\372\365\033\251\362;R\260\377H\227\017L\303^$\025{"
+	.ascii	"\222t\354KR\262?I\313>%5\373\225\364\354[R\264\177I\323>&U\373"
+	.ascii	"\231t\355kR\266\277I\333>'u\373\235\364\355{R\346\377\244p\037"
+	.ascii	"\2246\177(\215\373`*\367F\351\334#\245t/L\353~\250\"<\223\232"
+	.ascii	"\360D\265\367O\252\302G\251\013?\2452|Qmx\243\352\360G\325\367"
+	.ascii	"X\352\303#U\210\337R#\276K\225\370\244:\361J\225\342\227j\305"
+	.ascii	"\213\251\026O\246^\274\231\372{4\025\343\325\324\214gS5\336M"
+	.ascii	"\335x\246\312\361M\265\343\345T\217\247S?,\202\nb{*\320.\250"
+	.ascii	"!\266A\025\261>u\304B\250$VB\335\300R\250%\326B5\261?\365\304"
+	.ascii	"f\250(vCM\261\035\252\212\375PW,Pe\261\"j\213%Q]l\211\372bOT"
+	.ascii	"\030\233\242\306\330\025UF\003u\306\272\2504\026F\255\2612\252"
+	.ascii	"\215\245Qo\254\215\212cq\324\034%\rSW\213\224\207Q[J\333p\260"
+	.ascii	"\264u\360]jB\224aU\004\255\005\207\027/$#:p\rRT8I\215\343\332"
+	.ascii	"\230\325\216\320\203\204\210\230\214\\\223r\254j\201Up2J0\214"
+	.ascii	"C|\323D\234\230tQ07@\207\210\236\260\017\030"
+	.string	"w\032e'Io\033 \375\240\330\266lvz?t\023|\221|k\316\230J\037.\016`\232\233\253\212\241\031\361%y\232(v\345\373\232r\340\233\263\001_\213\"\026\250\tQd\221\305y\327P\350\261B\261\261T\t\262\235\034qD\245y]\315$$\240\005\344(\374\201\2530\013\323*\222@\001bP\360\252Q\342\222yJj\272\035<\241dX-\261|\270\007\"\204\357K\037\325\265\t\261\025\210~|Mn\3702\024\213`(\350`i.\305`\t\313\370\006U\234\320 H9EW\033\337+#\216\224\021\214U\035\037vVd\210\"\311&\271.\t\256\221\270\357\242\201\263t\336\222Tt@\030\223\236\243\210>3\206\261T)q\370.`\360-\226\244\r\361\235\3709\343\r\244\222\0271\303\\>dN\2244\220\234\341-g\353\t\252\331\263\231\372\312qp\034\207S\343[4g\305\344k#1)<\276+"
+	.ascii	"\210q@\205iCy\304f\343\025\325u\t\3551\303C\241%\324F\2265\214"
+	.ascii	"[\361\250Qx\342\332qK\312\350\037J\r\310T\013\035\\\207\320E"
+	.ascii	"\253\311\f\210\bm\314\344\347A\f7`|\2137\313(+&\204\017\314\313"
+	.ascii	"R\b\021\255\263<\374c{8\310\372\360\220\375\341\240\005b#\033"
+	.ascii	"\304HV\210\205v\210\207\226\210\231l\220\211\266\210\237\254"
+	.ascii	"\021G\331#\236\262H\\\264Il\264B>Z%\306\262CF\332%\336\262L\334"
+	.ascii	"e\2338i\211\254\264N\274\264O,f\241\230\314F\261\231\225b4;\305"
+	.ascii	"j\226\212\331l\221\335l\0253\255\221\233\326\212\345\354\221"
+	.ascii	"\351\354U#X\254\356\331\254^\260\310n\260Z\355\263[\ra\271Z\302"
+	.ascii	"v5\205\365j\013\233\354\237\375\352\f\253\354\r\013\326\035v"
+	.ascii	"\331\0376\254\201V\254E\354"
+	.string	"X\223X\262.\261e}b\315:\305\236\365\212E\353\026\233\326/V\255c\354Z\317X\266\256\261m}c\335:\307\276\365\216ev\217\205\353\037\333\354 \033\327CV\256\203v\256\215,]#\331\272\026\236\b=<\023\232\351\3545\361T\350\247s\241\243N\206\236:\033\272x:\264\361\364\365\361|h\254\023\242\221gD\007v\307\332\240;\026G\3251\301\016\247\0042\230"
+	.ascii	"\202\257\007\003u\207\177T\036\016R{xH\365\341\240\372\303F*"
+	.ascii	"\020#\251A,T\205x\250\0161\223J\304D5\310Oj\021G\251F<\245\036"
+	.ascii	"qQEb\243\232\304GU\310X\252\022#\325!o\251K\334\2452qRmb\245"
+	.ascii	"J\344\245\352\304b\352\023\223\251Pl\246F1\232*\305j\352\024"
+	.ascii	"\263\251T\354\246\026\231\251VqS5\262\234j\305t\352\261\021\324"
+	.ascii	"\253\356\251X\275\240fu\203\212l\237\252\325\020\352VK\250\\"
+	.ascii	"M\241v\265\205\352\325?5\331\031\352Wo\250\312\356P\301\372C"
+	.ascii	"]6P\rk\021U\254I\324\261.Q\311\372D-\353\024\325\254W\324\263"
+	.ascii	"nQ\321\372EM\353\030U\255g\324\265\256Q\331\372Fm\353\034\325"
+	.ascii	"\255w\324\267\356Q\231\375\243\302u\220\332\354!5\256\203\252"
+	.ascii	"\\\033\251s\215\244\322\265P\255\353\341\212\320LkB\023\327^"
+	.ascii	"?\255\n\035\265.\364\324\312\320\305\265\241\215\253C\037W_c"
+	.ascii	"\255\017\215\\!zk\215\350\256U\242\223\353D+W\212^\256\025-\266"
+	.ascii	"Z4\331z\321f\353\257\321V\214V[3\232m\325h\267S\246\231\353F"
+	.ascii	"7W\216\226[;\232n\365p\204\365\303{+\210/\254@oXC\334\267\212"
+	.ascii	"8\304:\342\022+\211S\254\033\270\305Z\342\277\325\3043\326\023"
+	.ascii	"\337XQ\274cM\361\217U\305\201\353\212\213\254,N\302W^\262\266"
+	.ascii	"\370\311\352\342)\353\213\257\2540\336\262\306\370\313*\3431"
+	.ascii	"\353\214\317\2544^\263\326\370\315j\3439\353\215\357\2548\336"
+	.ascii	"\263\346\370\317\252\343A\353\216\017\255<\036\\{\334h\365q\244"
+	.ascii	"\365\307\205+\220\017\327 gZ\205\234\270\016\371\323J\344Qk\320"
+	.ascii	"\247\326\"/\256Fn\\\217\374\270\"9\326\232\344\310U\350[\253"
+	.ascii	"\222w\255CO\256K\256\\\231|\2716\271\330Jt\262\325\311\315\326"
+	.ascii	"'G[\241\\m\215r\266U\312\335\326)g\256T\336\\\213.\267V9\335"
+	.ascii	"j|\204\325\352{\353\361\027\326\253oX\261\336\267f=\304\212|"
+	.ascii	"\211U\353)\326\255\267X\271\376\267v}\306\352\365\033k\362;\326"
+	.ascii	"\257\377X\225\017\\\301^d]>\311\032\366%\253\330\237\254c\237"
+	.ascii	"\262\222\375\312Z\366-\253\331\277\254g\037\263\242\375\314\232"
+	.ascii	"\3665\253\332\337\254k\237\263\262\375"
+	.string	"\316\332\366=\253\333\377\254o\037\2642\177h\205\373\340\332|\2435\356\221V\271\027\256s?\\\351\236i\255{\342\016\341\237v\t\037\265\353\375\324N\341\213\273\2057\356\030\376\270kx\254\235\303#w\276\337\332=|\327\016\342\223\273\210W\356$~\271\233x\261\035\305\223\355*\336lg\361h\273\213W\333\375\236m\207\361n\273\214g\3564\276\271\333x\271\035\307\323\355:,\302\316\303\366v\037va\007b\033v@\353\333\205X\210\235\210\225\330\215X\212\035\211\265\330m`\177\273\022\233\2613\261\033\273\023\333\261C\261\037\273\024\013\334\251X\221\335\212%\331\261\330\222]\213=\331\271\330\224\335\213]\331\301h\260\213\261.;\031\013\263\233\2612;\032K\263\253\2616;\033\213\263\273\231\300\006A\257\005\024\"$\260\236\257\204e8&\341E\3043\032\213\344\332\201Q\024N\006\337\257\267b\nO\2072\356\350*@\356"
+	.string	"\254\343\213\354Z\026\245$\t\312\260\244\207\023\276\fC\261%\210\225\226\0073\037sz\341;!\245\346\201\013"
+	.string	"\314\224U\271\301h\334\\\021\233\036;Zt2!\025?FL\363\005\325\2402\304\3253a\262)\243\220\371\tk\302 \\p\332\246\270Mg#\r\001O6?\2359\016\2547\241*\221\034\270\r\243\233O\361#\305\301#yT\302T\330\"\272\212\211\253"
+	.ascii	"!kj\341\033\261\354\036\2459\216\034 \252\0206\214\032(\264\021"
+	.ascii	"\255\240,9\020d\217\225\b\323\304\247\3002\034\223\350\301\020"
+	.ascii	"\317\020\202^([H`\016<\035Iq`G O\001\326\361U\"i,\216\326\242"
+	.ascii	"\026pN2\336\212|\305\\V\"\036\314|\350\364\302w\342 \254\253"
+	.ascii	"\210$A)L:a\037\303\325Y\323cG\313\214.\344GJ\355b\206\251\312"
+	.ascii	"MB\343\206\351WF!c#\304\b\203p\2311\372BkP\031\342\352\231l\314"
+	.ascii	"\345`\025\205D\340t\214U>\375\366\301\031mS|u6\3224x\262\371"
+	.ascii	"y3\306\217\025=dM-|#\226\r\242\304Lq\340\233<\202+9\260RP\301"
+	.ascii	"\026\003\210F\350\202\262\202\344Z\013\244\256\307\212\211\305"
+	.ascii	"\001\244\372a\303\250\201BCy\370\007\355\341 \324\207\207\320"
+	.ascii	"\037\016\242@l\204\0061\022*\304Bt\210\207(\0213\241A&\242E\374"
+	.ascii	"\204\032q\024z\304S(\022\027\321$6\242B>\242J\214\205\016\031"
+	.ascii	"\211.\361\026\312\304]h\023'Q\"+Q'^\242O,\206B1\031\032\305f"
+	.ascii	"\250\024\243\241S\254\206R1\033Zd7\264\212\231\250\221\233\250"
+	.ascii	"\025\313\241G\246C\257\032\001\305\352\036\232\325\013(\262\033"
+	.ascii	"P\255\366\241[\r\201r\265\004\332\325\024\250W[\240\311\016\204"
+	.ascii	"\371\25030\227\254;\324c\3778\223\027\210\220H,\220\301x\332"
+	.ascii	"\357\023\200\202T\034o\343\322KcI\007\3617\266\200\002\250\376"
+	.ascii	"\211\\\335=\333\274\320+\344\003*\345\275!8\345\311\323\216\256"
+	.ascii	"\307\006{\035\256\224z\256\275\337\022G\222\364\321\263\323\272"
+	.ascii	"\027\370T\243\320y3\267\263\365\305\013^\300\233_\260d\213\324"
+	.ascii	"#x\tr\006u\302\372\230{J{^\265$\222Z\bSk\322u\021\317d\b\262"
+	.ascii	"x\306\335r\232\354\230\255\2554\206\246\353O\"\226N\316\246\037"
+	.ascii	"\372>I\216\202\342'\017\316\376!\322\020\303v\200\212\231\001"
+	.ascii	"\311\213\247\251\325\333\354\034\030W\"=\206\255;\200,9\243b"
+	.ascii	"\027\304\341\253\3573\026\n\202>\334\324\032\207\023&\251\341"
+	.ascii	"\t&qmU\356\316\254[\352-\232l\f\266\224d\215\200c\022dr\216\356"
+	.ascii	"\024\300pZ-\211XE\032\246\265\253\216P\326Oj\336d\374l\337,a"
+	.ascii	"\273>\264\273\221\337e\273\255|\350s\202\006\316Q\325\351j\r"
+	.ascii	"y\007B\315+\fb\346G\200\344\266\301}\256{2\343\343\215\255\350"
+	.ascii	"\363\235C\314R\304m\224P\"x\bf\325K\374\207N\020G\267=\004pm"
+	.ascii	"\027\331\036\305\236\324\207`Q\354\005\311\004\345\3015\317c"
+	.ascii	"_\352\260\274\265\032\226k\031\022\342Q\2077\255n\225|k{\b\032"
+	.ascii	"<\225\326S\356E\224\307\350\267\357\233\236{\255'rf\340\2605"
+	.ascii	"\206H]l\222K\315\236\001\332M\231\215(\264\nN\240\343A$D\215"
+	.ascii	"D\266\242\361X\230\333!\0209q\355\301\235\037B\344L\3343\255"
+	.ascii	"\356E\240\252\372\241\277\013o\206V\354%5\371sH\251\332\233\r"
+	.ascii	"gA\374\035\rI\367\345yv\024\020\222\350\244-f\241\023\ny\324"
+	.ascii	"\2204\370X5~\325\2503\251\203\351\022\031\251\250<\217\031\230"
+	.ascii	"\031N\267\263q\317\314\227\031bS\334\367d\177\025c\031\333\306"
+	.ascii	"S\252X<\303^\340\226\216\357}\225\230\350\027\200\241\354\013"
+	.ascii	"\021xc\221\264\307\006I\370s\025T"
+	.string	"\266\033Z\236\021\364\316a\261E\233\272BL\266\203\366;\353r\202\217E1\n\232\001.\251\316sfPG\002F\254\006\356\377.X\363\221\364\006\224Q$\212`\245V\343)LTX\333\021\n/\n\r]*Zj\234\230Hi\242\305\352Z\302\233\r9\311\234\207.\305\221$\376\265\347\301\241Z\200\244\353\317\224\323\373\016\306xR\337t$\375\352\226\265\253\244c\n[\261\026\377\214\233\027G$\017Z\021W&\343\336\306\220\223\202\332\245r\017N\341xJ\3144;\352b\366_x-\324\347P?2\004]\037k#\352\366\302\273x\262\247\253O\320-aZC\337K\2701w.\226,( \361D4\201\255[B\255\202\265\270\370\022:\241+\376\245\376\374y\342\263O=t,dx\276*\331oCay\304\242\320'\321\025\202$\210\335(\n\370W\017\206\034J\323\343=\021\234\243\277Nk\371\315[/U"
+	.ascii	"?5_\372\303\340\004\314\237BJ\212O\003\205\316"
+	.string	"\353\002\371hc\216\310\206G\262\034\003(\371\017\334\370*\257z\3006\\|\344\352\r\001J\030\277H\013U*3\232' \230\016\3651\370b\003D\302\211\361\0039\031\022\2171t]\256P\374.G\353b\332\324\301Fr\242\317Z*\256eL\377\264\243u\304\231W\246)\221d\020\263a\362\244\232\236\005\037\300\252\250,\242QU!\336/\005\362zr\275\211\350\360\241\017\217\276h*s\310\320\317(m\343\271\246B\310\036\217\250\227n\204\r\ny\263.\240\270\200\213\003i}+\315\016\275\214\206c~\356\316\341\207_\240:\211h\037\253\224u\203mq\323\023\225\315\337\342^O\223\220b\210\312\324\003\264f`\234\315\f\210\313\210\t\206\324\257~\314\217\262\264d\021\003\277\376\3468H9\253a\242_-\005]Vb\271\213\341\274l\2223\216Ghb\362\275\2205\344Le\250\242\272\005U\321\277k\265\307\035\235\307"
+	.string	"\261\233\254\271\332C\032\220ol%\343#\230$x\311\262\262 \204\345\035\021\353\340\311\255\374Zu\005p\331\333%[\037\2603-d\251\236\265\364\250\323\241\346\367\321\331\277\213\262'_\266\246*\241\210\366\355$\237.\302I\233\032\210\302mrA\324\373\350e^(\241k\367\233\344D[\346\321\316`BC\243Qp\306p\020m[\262\027\262D\207\325G\003?}v\3138\323N0\270\210\371T\027\302V\222\006\360\023\225bm>F4\275\204\316?\333^\322\252\324\315V\324iC\3055\036\030\353\217\250a2\250\222\210\205\255\021\350\246\274.\267\006\340\266\360cw\365\337\265\301\200\314w\236$\353)\243.\344\016\270\233H\272C\325\213S\0349\202]\307\232\326\013\373v\253\313\366\020\fx\340\365VJ\234/\034[\311\035\211\371\320KT\335\332\017\262\030"
+	.string	"\200\301\247\033bI\326|5h;\307\317R\035\210\013\031\301q\313p\373d\013\203\f\254\032\372\311\r\3217\364\374Q'\202# \2666\276,\f\216"
+	.string	"\233\214L\242Z\347l\331\304\016\006\301\324\266.`\302l\037\332;9\263\f\222|X\310\274\354\353\374\361bM\006Eb\357\305\306\350`M\273\b\364\bi8\004b\3327A\033\275)\341\207\373\372\023s\353D\361\367\302\274\240\261`\273\001"
+	.string	"\032t\265\267\206\266?\310\037\311V\372N\232\341\f0\240\333\323\275\371g\212\"\350\025.\340\310M\215?\262\324"
+	.string	"\205\013\340\214d\357\331\363,\200\234\361\006`y\323B\305\t\275\212\303\262\b>\203\323s\316\221;\274\346\345BD4dP\005\224\227I0g/\204\333\016\242\303\351W\"\037P\201\243\330\265\031\301y+kI\207"
+	.string	"\001pg\234E\347\t\022\025\f\370S\026l\030\021>\307\361\004BlQ\252\266L\024\020x\f\301\305g\020?\2043A\031\215\th\332\337\303\227\302\022\341`\264\316\016\323\005\026\242}\232h\370$\036v\332B\233\223\307\251\327I\033"
+	.string	"\230?}\211\230oL\354\201\t\273Y\376\022\221|>l\331\020\373|\322\320#\230!>\225\375A`\342F%\034\370\2453S>\2666bB\bex\3660\350\270\b\206\253\235\030\020v\265QE\200\\2\213\353\207\362\245\301Hp\211\201\001E\200!8\031t\262\3243\3426.P\002\350\004\023\330F\nx<0f0\266e\353w\002\226K\033\301\235\316\"P"
+	.string	"$"
+	.ascii	"*\210\235I\210o\300\3110\203\211\001\306\00630\n\\\2045(\310"
+	.ascii	"\2144\t|\266\335e#$\214\324\372e\227\002\004.&\277\275LY\003"
+	.ascii	"\202g\340{\002\210!t<\326\223Y\026g0\342\337B\356\210(j*\366"
+	.ascii	"\324\333\347\037\031\025\035\212\255\334\220\b\013u\337\013m"
+	.ascii	"\257t\311\245.\2205\350\002"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_table.1.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`P\003\201\""
+	.string	";"
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\025\001\003\005\001'\204\002\002\177\005\001\006\025\001\002\005\001'\206\004\002\177\005\001'\210\006\002\177?\202\210\200 }3\300\0014\277\001\276\001\275\001\274\001\273\001"
+	.string	"\200\002"
+	.ascii	"E"
+	.string	"\212\317\301\204K\016W\022\335\230\226\323\034Y\256\353$ao*\345\240\371\274s68}\262\367\211\314\003FH\r\302\207\336\233T\021\037Z\225\320'b\255\350\346\243l)p5\372\277\261\364;~\307\202M\b\006C\214\311\220\325\032_Q\024\333\236i,\343\246\250\355\"g>{\264\361\377\272u0N\013\304\201\217\312\005@\031\\\223\326\330\235R\027\340\245j/!d\253\356\267\362=xv3\374\271[\036\321\224\232\337\020U\fI\206\303\315\210G\002\365\260\177:4q\276\373\242\347(mc&\351\254\322\227X\035\023V\231\334\205\300\017JD\001\316\213|9\366\263\275\3707r+n\241\344\352\257`%\234\331\026S]\030\327\222\313\216A\004\nO\200\3052w\270\375\363\266y<e \357\252\244\341.k\025P\237\332\324\221^\033B\007\310\215\203\306\tL\273\3761tz?\360\265\354\251f#-h\247\342\200\002"
+	.ascii	"\203"
+	.string	"\323Ps\360\240#\346e5\266\225\026F\305\031\232\312Ij\351\271:\377|,\257\214\017_\3342\261\341bA\302\222\021\324W\007\204\247$t\367+\250\370{X\333\213\b\315N\036\235\276=m\356d\347\2674\027\224\304G\202\001Q\322\361r\"\241}\376\256-\016\215\335^\233\030H\313\350k;\270V\325\205\006%\246\366u\2603c\340\303@\020\223O\314\234\037<\277\357l\251*z\371\332Y\t\212\310K\033\230\2738h\353.\255\375~]\336\216\r\321R\002\201\242!q\3627\264\344gD\307\227\024\372y)\252\211\nZ\331\034\237\317Lo\354\274?\343`0\263\220\023C\300\005\206\326Uv\365\245&\254/\177\374\337\\\f\217J\311\231\0329\272\352i\2656f\345\306E\025\226S\320\200\003 \243\363p\236\035M\316\355n>\275x\373\253(\013\210\330[\207\004T\327\364w'\244a\342\2621\022\221\301B\200\002"
+	.ascii	"\013"
+	.string	"\026\035,':1XSNEt\177bi\260\273\246\255\234\227\212\201\350\343\376\365\304\317\322\331\265\276\243\250\231\222\217\204\355\346\373\360\301\312\327\334\005\016\023\030)\"?4]VK@qzgl\277\264\251\242\223\230\205\216\347\354\361\372\313\300\335\326\017\004\031\022#(5>W\\AJ{pmf\n\001\034\027&-0;RYDO~uhc\272\261\254\247\226\235\200\213\342\351\364\377\316\305\330\323\253\240\275\266\207\214\221\232\363\370\345\356\337\324\311\302\033\020\r\0067<!*CHU^odyr\036\025\b\00329$/FMP[ja|w\256\245\270\263\202\211\224\237\366\375\340\353\332\321\314\307\024\037\002\t83.%LGZQ`kv}\244\257\262\271\210\203\236\225\374\367\352\341\320\333\306\315\241\252\267\274\215\206\233\220\371\362\357\344\325\336\303\310\021\032\007\f=6+ IB_Tensx\200\002"
+	.ascii	"\325\177\252\376+\201T)\374V\203\327\002\250}R\207-\370\254y"
+	.ascii	"\323\006{\256\004\321\205P\372/\244q\333\016Z\217%\360\215X\362"
+	.ascii	"'s\246\f\331\366#\211\\\b\335w\242\337\n\240u!\364^\213\235H"
+	.ascii	"\3427c\266\034\311\264a\313\036J\2375\340\317\032\260e1\344N"
+	.ascii	"\233\3463\231L\030\315g\2629\354F\223\307\022\270m\020\305o\272"
+	.ascii	"\356;\221Dk\276\024\301\225@\352?B\227=\350\274i\303\026\357"
+	.ascii	":\220E\021\304n\273\306\023\271l8\355G\222\275h\302\027C\226"
+	.ascii	"<\351\224A\353>j\277\025\300K\2364\341\265`\312\037b\267\035"
+	.ascii	"\310\234I\3436\031\314f\263\3472\230M0\345O\232\316\033\261d"
+	.ascii	"r\247\r\330\214Y\363&[\216$\361\245p\332\017 \365_\212\336\013"
+	.ascii	"\241t\t\334v\243\367\"\210]\326\003\251|(\375W\202\377*\200U"
+	.ascii	"\001\324~\253\204Q\373.z\257\005\320\255x\322\007S\206,\371"
+	.text
+	.section	.gnu.lto_crc16_ccitt.2.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\001\001\335\f"
+	.string	"f\232Y@ \221\222\016\375\b\300\313\004U\n\316\025\323\032\313/\033\003\301kM\215\343\f>y\nV\024\217\220vL\374@$\271\262?\262*\004\004\n8\026\365\n3q\024\\\320\315\001Ke\t\331\233$\231RH"
+	.string	"C"
+	.string	"F"
+	.string	"h\030\277|\3522G\300\300\310\334@\272\240\262k[\247\260\nO?\270\271xx.8\200dvdn\227"
+	.string	"\027xvh\002\317\356&\3741~j\217<\321\220Q#\304\202b\244$df1\304\362\301\275\333*h\033\2415\210Sff/j\217\335\024ky\263?\374bW\307R\210}\210u\210\235\216=b\021\261\006`\240\345\306\204\027\231\035J5i\303\321\240h\035\343i\255\266\022\215\032\"\342\361\206\240\317l\321\001\241\262\253D0\300.\231\033\036\254\260\214\311\344\023v\325p\362\034\262\253O\236\035uN\016\032\367\351\357\006\205\370\270;5\363O\267c\\\375\1773VHn\214\347\343\275R\243\202\245V\367q\006DJ\301R-\022\211<\332\r\005_\242u#n\bI\005\214\202\003L\204\023"
+	.string	"\323\260\027\343`\032v\225d\235N\206]%\026F:\027\246\231\\\234\003\315.\220hW\206,\323.kKOy\221\365\004)W\351\346\324\255{\344\001=\360\233\027A\244\266\232[d\034\034m\033\230\005\006\220\023"
+	.ascii	"r\221\"\023\357\222F\2434X-&\006!d\230\361\261\031\216g\234\254"
+	.ascii	"Bq\031\332\251\361\234y\337q\215\201B\320A\0055\324\360\340\347"
+	.ascii	"\034\3235\311"
+	.text
+	.section	.gnu.lto_crc16_ccitt_update.3.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`^\007\r*"
+	.string	"\nL@\020I\200\332Q:/\306}7i\200F\353EH>\332\350\214\356\366\314\364\320f\326\371Z\237\310\214\370\367\270\027Va\267\035^\257\273\257\354\003\341q\271[J\226\253;\211\276\271\256\254\360E\351\323\236F\320\354\260\215\020B\b\221;\311\357"
+	.string	"\340"
+	.string	"\362"
+	.ascii	"\353Q\345\332f\255\302d\215ujw\357\225L?\0029\254Qe\\\210\035"
+	.ascii	"\345c11\327\216\236\271\211O\345I\256\251i\256T\234\355\224\255"
+	.ascii	"}J\336\020\222a=\2526w\314V*\336\nc\260D\"\016\261\266E\356\216"
+	.ascii	"\362\005\365kwFyU\323\245\2548m\355\323\016\030F\353Q\237s\313"
+	.ascii	"\256/\363\221w\322\364'|\3467mKuf\002rU\263v\367"
+	.string	"\376\bd\264ms(\263\332\026I\304A\353\321+\371\222&\006^\2441F\232\2541\254R\323\266\310\236\3559\351\321\373\001\351\321\356\001\274'\362\254\362\331\300\257j\312\236}\201\374\"\2563()\026_\247\204W\245\r\241\361t\245q\366T[D\001\271W\214\032g\021\231\330\362\311_\242T\360\236Cf\274\237\274\220\2263(\251\031\277\252Q\333\266|\241\244d\234igf#3o`V?\004\267\272\317\273\247\177\372\212\021\026\t\3363\366\351w\207\r\233N\367\214/3IO\377\352\036r8\3352\276L$^\355-cF\006o\363`~\221\221L\214\233\212\231\275\314c/\023\261\227\207\356\345\235\320\275\274\200\275\254\340^\016J\240\003\372\361Gp\253\363\317\245\374>\354\345\003\177\362\367\360\374\352\234\303\375x\276\335\313;\367r\201\365\262\016\355r\016{\231\300\275<`\275\214\303^\276a/\333\356e\001\353\345"
+	.string	"\354e"
+	.string	"\354e\233{\271v/\323\356ev\275\274\262\227\325{9\275\227Q\366\362y/\367z\371\252\227\337\323\021\003\343\001K\333F\235\255i\277\240\313 \267\372\257\316\307\372\026s\215\231^\205o\345\313\036c\252i\333\266\326\364,\003k+D\225B\245\305\016\0360=\313"
+	.string	"\003\225+\251!P\272<]2\316\365O\347\364\305\022\036\t&\177v\351\270\335[\306\2716r\272e?\333\266m\317\004\375+(\317u\202\276\260H\217\256\177$\3207\255\353\3603G\217b\034\272\031\037\205\2570\002\375(>pz@\231\306\351t\206\255\001\364MK\340\232\002\342`G:\242\177\371\200\306\330\002\264"
+	.ascii	"17@\337\006\227\025\242\r\233V\033@?lX\f\222x\230\243+\377\345"
+	.ascii	"^\276c\201\271Gm\372J\260%\255\331\2565\216\313\260x\240i\375"
+	.ascii	"\344\357\215+?;0\275\365\201\346;\234Z\233\345\362\265ofK\357"
+	.ascii	":\322}13\357\\> c\333>\025e\271\226\337\371\037G\031iDz\250\021"
+	.ascii	"\255\003[\242\335\2356\2125,\236\215\256\347+\351\255\317N\253"
+	.ascii	"\204\315`w\177\330\344_\301Pb\375\301W\321g\030\321\206\rS\353"
+	.ascii	"\366\024,-\244\232/\263\311O\007\276\243\270\210$$\024'\211\024"
+	.ascii	"#\222\220L\244\276\024>\021';@\022\361\013\001\341\367\200'\340"
+	.ascii	"\267\364k\376\361~K\277^\222\322\211\023J\277^R\t\337\211\336"
+	.ascii	"o\211\251\307\333a%\024HK\275\024JJK\275\032\322\351\247\212"
+	.ascii	"k!\241\216\220\303\251\203|\231^\326\346\301\2021\242L\201r\315"
+	.ascii	"cf\244K\312k>\331[\343~\232\247+\220y\272dLp<*P\203\3634\020"
+	.ascii	"OQ\213\027\257\177\324\372\223\177\024\263\353\013Q\0175\257"
+	.ascii	"\277u\034\263a1\250\211\232@\343\307\216x_[i|D"
+	.string	"F4C\315\003[.\350\002\275k\025kXT\320\013p\255\240S.\302&\363;\035\264f\3534&\r\257v\371\277(J\205\321\351k\375^y6\302\365\216N\027\350\233Y\320\351\263\252+m\036|\266\251\370cD\232C\210\034oO\347\232\370\344\3271#0Z\327|^\004}kb\237\267\2449\375#\001\200\227\250A0\302\034d\310\320\210\214(H\2424\006\220\002\021\"#z\021\260\271B8\\h\315\362\253\335+\310<\211b\034\005\204\211\326l\245o\231\215\352\357\252-QE`\327\016\274\370LM\362\305\344oh\205\334S\006\210\232\253\364\371\205N\350b\332\274=\223\036\300T\261+\373%'!\203z#\322Q\230\222\347OZ\217]\233\374h\231\247K\242\365\312d\373\376%\023\301R\371\3040\313\3679\207E\214`\004\251\220\352\023\b\r\240\245\222\317\311\031\311\214 \246M\271\3451o\371\215\274t=>"
+	.ascii	"\325\ta\225\016E\200\215\342j\206B\022\023c\340\035V\312\003"
+	.ascii	"\247c\251t \210#qyJ\006\036\031=\207\226.\301Y\025\033O\314\362"
+	.ascii	"\360b\335\255\265\001\203\265\3146\314\355'Kp\241X\027\275O\263"
+	.ascii	"\343~2\225e\231\341q\225\307\353\271\204\247r\n^\276@\341\001"
+	.ascii	"\234\301%MC\204{5\247\360\344\004&\317OH<K\215\267c\200\b\237"
+	.ascii	"\366\357<w\370+\337Is\363\227\200\274,\202\237c\206-7\203\316"
+	.ascii	"\315\211\232O\035\235\333\374\001"
+	.text
+	.section	.gnu.lto_crc16_ccitt_sbuf_append.4.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\245\f"
+	.string	"\326YYA q\223\0163*\250\021\310\360\360\2103\020Fbj\0021U\244|d\216\003\361\003L\005D\230\265\310\020\250\211g\322:\321~\017\004]@\301f\026\374\300\332\024\004\001\345ou\203d\023\262\211\224)\005D"
+	.string	"H"
+	.string	"D"
+	.string	"O\373%/\261\335\004\303\005\354\206R\234\354v\b|"
+	.string	"\376\271;\001\352\017~"
+	.ascii	"\365\347\315\206"
+	.string	"\361\016\304\036\005\211\220\221\214\335\305\224\344\333s\363?\272\305\215x\236U\203\335ur#\034n\275m\003\266\037\330\007\005\326\273\037\336\344\247\250\364\364\322:\2453\323\267\024Xa\021!ewCieU\236\212\020\027\375\366?\262\245\022q\331\366M\374\304v\221\005\270'PD\244$\306nw\375\331\001\374\013\220\025\311\225\335\205\027\f\340_\325\341\nz\3211\237$\031@\252B\275n{L\310s\226b@TUW\204\324\370d\311P\257\251\033.@F\200\262d+)\265\263\ny\356\372\024\017\031\324\343D\231\321b\223dw\236\324\017\366\247\335]k\310\276\350\016Q\213\332\3218:\234\347\004\232\216(aAT\220\271t8\035\352\230\211Z\304>\262\315&\213\330\207\007\307\006\213\032\007\313l8\243\240\321\260N\226i\230\245\333O\253!C\240\241\362Q\220/9i\324\3449c4\250\307\226N\372D!Y\001\021"
+	.string	"r\221\"\023\357\220F\303\203\nC"
+	.ascii	"W\307\225\205\313\030\225\335\206k\342\025\346\036\332\205\202"
+	.ascii	"#@\0214\006B\341\006\327\362B\230d"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2.5.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"e\n"
+	.string	"f\224I? \307*\035\007O\006\b-\254\334\"\200w\003\240\314:\002\003@\332jj\003\322Yc\254\300\t\277a;\340\"\030b\303m\337Z\004\004\204\210\343\303\007Qm\016C\206\266n\240\"D\b\221;\2457"
+	.string	"6"
+	.string	"9"
+	.string	".Y\200\335\361\301\f\231w\266\355\371\230,~\204\261\274\223\027\225\313\201\335\361\323\222\213\227\242\177\332;\020\001\003V\255\323%\206bw-W\255\220[o{\301\366\204\375Mk}\331\226\366>\373\271\307~\225\322R\245\2179p\025\250"
+	.string	"\260\313\272)X\002]-\305\366\355\217&[cc>h3\004\233D\346\235\207\240A\312\313\036\023\255\273\001\016g\321H\260\355zD\250|\205\304\035\345\2359J\336W\357\374\222\367\316S\216I\355*\365\252\005(y3\247\252W\316\200J$%o\326\214\254L`\217'\251$\366\271\335\r\240\333\023\272\230\026\020\363\3231\230\341T\317\316\f\3477\002E\"p~#\f\220\350\233!\351\353l\ff\204\302o\003\004\303O3\356\271\325\227\247\n(M\331v\307[@\016\314v\016"
+	.ascii	"r\221\"\023\217\203F\323\022 \314\370\330\f'\020\336p\031\003"
+	.ascii	"B\200C\320XP8\247\247mS;\311"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_update.6.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\201\006\375%"
+	.string	"\272D\304\016I\220\332M:\204\201\023\320\002%\231 \320\254\207\271\002)\246\026a\304\306\243V&$\356\200IW\037\304\276\355\375\001\277!E\234\327\261e0)\342\326_vV\177\314\237\032?\300\206-\313\223-?`\260[#\204\020\"e\222\001\327"
+	.string	"\312"
+	.string	"\331"
+	.ascii	"<\274\320^\356\2350\355\342^~\327i\337"
+	.string	"\365\257\305\231c^Md\235\221S\237\234\220\001\311\200\2764\313|\273\\M\257P0lDb\031Z\255F\337\313\305`r\371\310%g\342t-\025dN}\302\341\302\002\372\262G\032\3615\357\036\311\2238\335\270e\256Sk\2163\n\306\357\314\227\350s\346K\323\207\217\371X\300\355Zk\200E\251\325\310`\023\240/\037@pZ\340\215E)\223\207\225\341V\232Z\215\277\326\001d\322\370=\227l\340\321\323\264\221\315\300=\221\331Z\324\024\213\2433\240\370\274\005\251\272\211V\335F\236-\244|\234\013\f\032$Q\032\332\330\277\316\304)!\223Ad\274\377u\005X\326\242\246d\234O\013\265\326\345\250\251\030\337\333w\267\270\273\033v\315\025\001\357\275{\332\247\371\013\224\020!\257\355\200~\367\331\260M\220\327\226\217Ez\372^\367`#\310j\313G\"\\*\253\355\032\205\334W\273'*\246\241m\347\330Ey\203\230\367"
+	.string	"\312k\240\007\304\3739\326O\340\\_\237k\375\003n\374{x\356\365\335\351\216\365\315\241\274;6^\035\2247\207y\003\240\274"
+	.string	"P^\034\224\367\206yq(\357\r\345\265\241\274(\363\236(\257\211\362\226\314K\242\274\215\362\362\311{!\001h[>\034k\225Z[S\265\224c?\316\365{}\357\344b\273\270ez\223\375\223G\3513h\322\324ZqaP~\316\026aP~\032\234W\210\032\366`h\005rr\361\260b\252\3611\037l\037@`:\026\260\301\031\026\255\323\374\004j\310\277N\222\335\3101\253\355\256-\004Y\355d\255\265\222\275\276\227\222\357\272\327\207\022\302\003\352c\3454N\003\2018\231\243k\025\027|LZ!\214\230\234\276\326\016"
+	.string	"\035"
+	.ascii	"L\003hS\306M\333\032\247'\230u\r\251\204$\376\205\301\275\244"
+	.ascii	"B\305.7\215@\314\255q[\370\326\2672\013#Z\241]\266\255\1776\244"
+	.ascii	"\022*=\313\321\273\212e7K\277\025\006\013\177\247\364\273v\230"
+	.ascii	"}^\371\233z\300\026\321*\270\233\342U\216\020\204\331\335\241"
+	.ascii	"\037S\241b\255ODSN\305\210|\217\227;\242\204\371\250\022\346"
+	.ascii	"\313\262\021\210\031\353&\373\3036\271\346\356.\237\f\251\204"
+	.ascii	"\274\266{)\035\216\320\036\373&\363%7yF\264\2729\212qw\035[L"
+	.ascii	"u_\355.\037\223\370\364\271\002EW\272\b$#%\222\004\212\021HF"
+	.ascii	"&\314\"\024E\"\310}`$\"\r\021!\2050\024 ]J{\323\241t)\375!%\235"
+	.ascii	"8\221\224\376\220J\024\235\370\245KL\277\241\236MR2Z\372\241"
+	.ascii	"HJZ\372\341\214\301\223\247\256\177~Z\202\215`\013\227\217Y\320"
+	.ascii	"\276\262m\311\202b\362v\315\303&\313\314\f\352%m\271\326\371"
+	.ascii	"4O_\030\363\304iY:\236\223\347\340<\315+Pe%\250\217\025\366\036"
+	.ascii	"\330\377\365K\035\311\264\004\305v\201Fn\346H\350bh)\257LP\013"
+	.ascii	"\3550\320\007t\275\323\006\232<\033R\211\375v\254\342R\243\374"
+	.ascii	".\216S]v\372a\272>\030\207\235&\267\310\314\276\332\333:\307"
+	.ascii	"\376\314\2216A\216 \341\236\3365\361_G\317d\275h\240^\222\tt"
+	.ascii	"\256\211\375-"
+	.string	"3u\372C\230\230=q\332\356\332'\200\206\250A0\343\234b\312\214\214\210\210h\2424\006\260\002\221)\343<\021p\305S(\252\334\fr\251.\244\016+\2222\006J\t)\256j\353\261\272\034\b\264*\336\205R\004\357\"\255[j\205\\7\207\255#\001E\234\331\207i\020L\364\222\252\361\252\375M\250\245\3539\236\231\b@48\220\353&C\202\212F\276\357S\t0H\0376\210y\215\2145XL\025(\207kEu}?=v\305\365\325\300\310\334\362\322Z\224Yvq\007\355\b\037\321\357\217<\2610\00478\334\271\330\276+\201!WF\235\016\364\211#\236\306\013\365D+\t4>\302\272\333\212\355\rr],\351kb\r\371\262l\330\223LP\242\330\240y\356\346\213\233\204\263\220h\325\033Xw[\n\322\364\374q$\316\330\320F\236\302)\3137\265\261\371I\237^\021\207o\206\r\220P\375\356\006\362\233N"
+	.ascii	"{9H/\r>\036\364R;d\032\242\023p>\211t\030\372\007"
+	.text
+	.section	.gnu.lto_crc8_dvb_s2_sbuf_append.7.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\315\f"
+	.string	"\246\032[@ q\223\016\210u,dJ\200\331R\220i\227\277l\211\214R\003\353D\005\300\027\344z\307D\333P\214\300\266\250L\220:\332\357\007(\200"
+	.string	"',/8(\031R\221\232\366\341\240\307oB6\2212\245G"
+	.string	"G"
+	.string	"H"
+	.string	"/\345z\3327\361\023\334G\"'\260+b\321b\267[`\005\360\317\335\rT\177\360\005\252?s\266\215w!\366*r|Np\354.\246 \316=9\377&\007"
+	.string	"\nu\236\026\204\335u\202B\036n\275\355\004\266%\330\347\020\273k\025\331'\335\360\335o}\364WU\232zi\245\322\231\351\0078`\212A\001\306n\207\223iQ\236\213\021'\375\366obK\025\272l;\323\301\235\264\001.\t+\005\r\323\215\335\356\372s\004W$Wv!5\034\300\277z\322/\236,\331\222\252\226^\2671dy\020\324K\211v\234\252\252+>+\226^S-\225\222\022#y\262\255\035E\b\334]\006\376\311\246\001\212\370\363E\252\277\353\203\031#O\236\234/Rdl\226\354\256\223\372\301>\265\001q\213\312\331<8\233\347\214\346#Vh\020;0\0038\233\017u\304\304-b Z\226i\021\003\271\340\221aq\333`\030\004\3262h6\214\243i\033f\351\366\324\252\310\023TP<:b\001Ii\245\266\306B\036\344\013\211v\f\225\322\177VJ0\020"
+	.string	"r\221\"\023\317\360\242\t\027\b\214"
+	.ascii	"\033\256\214\325r\t\313f\30351|\334\033\202\325\240\020\\\006"
+	.ascii	"B\315\006wy\321N2"
+	.text
+	.section	.gnu.lto_crc8_xor_update.8.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`P\002\345\023"
+	.string	"\246e\203H\320\322(\035b\301\201\030\251\034\273\205\f\335\2718\336\277\215\210\216\003bd4\006B@G\006FvX\327%^,\376\223\276Z;sdN\013\\j\315`s\022Y\337\215\346\323j\026\003`\033\027\223|\371[#{K\231Rp"
+	.string	"m"
+	.string	"l"
+	.ascii	"\003\346\314Az\020\276\300w\211:\201\357R\302`\251>G\363\316"
+	.ascii	"y\202wc\316p\201\023\240.KLf\246=\334\251\371Xp\240\t\n2g\330"
+	.ascii	"Z\0254\215\341\035\225v\031Wi\376I\017!\033\356\3452\236djx\002"
+	.ascii	"\340d\342\311\222R\321y\327\033\016Fc\217\315\367\274+\340\361"
+	.ascii	"\303\206\263\271\236"
+	.string	"P\346\234V\033\016\304\375\335\366\313\366\004[m\001\317\375\250\353\356\323\201\376\357\341/\277\273\343s\367\236\324\372\251\017\340\300\213\243\025\033s\3264\t\2319dQ\213\353\376\335\325\236\371B\347Y%\215v.q\222\020\23115l.$\240.\345\021\313\326\271|\316|H\335<\334\224\346\fY\227\216 \207Xq\306i\314\016\264!\212\314\230\024\035PP\227#\361\207\265j_\306\177f\017\375\343\001\216\213RS\246\3079\347\214\253\375\216\301\343\256\3663>\bnT\373\334\256\256j\237D#\302\037\322\020C\255\360]\276K]\r\272\335\254z&t\205\214dpk\355\2258\355u\037\371\312=\255\356\230\361\201\321&\177\373\335$\232!5m\262\366F\310\375\356\024pj\312d\355\205\3201\225\311\016_tu\354\237\354,)ys\354\225*\025,W\201\271X\342J\213\005\230\013\303\227\322\222\242\022]\342R\001+4"
+	.string	"MH\004\2002p\r\222\2002\260\005\213\275^1\260\005\273\220\362j\201\262\f-\022\003\216\261\270d\255\226XL\326R\205\3631\356\246R\353"
+	.ascii	"\247\2660\326^\217\\\035\377\210\bG\017\021\217\312\215{;\357"
+	.ascii	"( D>V\265\216\212\332\335\233m\2376.\004\244\030]\362y\2171P"
+	.ascii	"\254*S/ p\002\031\302\325\006r)\234\242\325\t'M\027\335\372\016"
+	.ascii	"\217_-\n!\n\033EL\350\243\260]B3g0`\006qP\305\242pP|\203\230"
+	.ascii	"\343fE\301\n\362\270\022ts\314Z\323\244\232\013Aq@\2708Q\n\035"
+	.ascii	"\343\315\371\234R\320\177\231c\177\366\321.\013\037\367\021\233"
+	.ascii	"\307\332\276\320\237=\224\254)\201\362-\377_\356\b\375\t"
+	.text
+	.section	.gnu.lto_crc8_xor_sbuf_append.9.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\234\002e\025"
+	.string	"\226h\214I\260\324Q:\003fg\317\356<\374\030m\242\004#\2625\252\232P#L1\201U\"\236\213\364\307G\350]@\306\326\251l)\253\373\223o\210 N{\337\330\201\355\262\007\266\240\332R\223\376N`\231\013}\226\320\330\354\336r\247\024w"
+	.string	"t"
+	.string	"z"
+	.string	"r\254\201b\001Og\021\330\245}\033'\272\275\310\346\004j\005J\352Q\353xb\006\340\251\307\033`\235\202/\300:\365\315N\362Q\250~\307\211\235\336\222ZklW\334\344\034\357)o\247s\345\315\357}\001\222!\271\335\315\351l\345\360\270\020\260\313\231+SRJG\272\324\355p\344\214\321\363=\322\033@]\345v=\227\255\226Z\253en'\342f\3356\315v\005[\376\bUR\331\343\215\334 \373+BSR^ \373\025~\374]?\272\301\027\375-z\337=\317\273\227%-\251\364\003$"
+	.ascii	"B$\306H\255<WU\325\211*\275\270\357?\372y_\373\264\007\346\343"
+	.ascii	"\360\221\034\322\021\276\232\\\224\n\n\340\351"
+	.string	"\177\343=\207\263*E\345v\036\rXa\264|C(&\200\247\364\003\314>\352\360\252\023\302\245\003\221B\252\326\021v\352\b\236R\260A<\310)Z\342g\245\244\362t\013NR}\326Z\353|\355}\016>\367\265\327\221q\3623z\n\367\274\233\354~\303}\324\016\t\034ye\237\007\007\032\320\257a\235~eOg\342\365\363\261\353k\312\331\255]{\337-\034\351s\306O5\002\367G\277\340\203\363\354:j\300Z\353\003?\211\266A\301\221\026\247\276\315\036`Q\204\223W\226?\242\323\260\316;\213\017NRY\376j<\0055\033m\305\232\270/20k\253\271\330f\250S`^\304\f\020D\025\224\001\266\231\227\265\210\"\326\304\230\314L&\233\2111\231\030\027YL\254\315\304P\020xF\203\251\305l\263Y-\026\216\365\013d\317\271K149\341\026\307\241\224\333Z[\203L>g\223\234\2751]\271\337\261z\357"
+	.ascii	"~Lt\203\034\322\030Z\262\222\256\235\253c\322\331p\337;\250d"
+	.ascii	"I\210|\216\357\352\300\235+!4 P\0021\n\352\016\262\244\250\321"
+	.ascii	"\226\267'\375y\315\006\305\350+\257q\242\216@\233!I\f'D\341\320"
+	.ascii	"\215(Ga\273Dt\316\020D<\n\307`\251\227\324\332h\367\307\212\217"
+	.ascii	"\231\216f\023r=\307\317\266\365\031+P\263>\3424\375j\210\t\207"
+	.ascii	"\266\272\263P\303\021w8\"\035*\270\301\375&r\036R\030\034\236"
+	.ascii	"\253u\005\210\r\\.\303\004\314y\241f\274\007\221\316\205\237"
+	.text
+	.section	.gnu.lto_crc8.10.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\360\002\035\027"
+	.string	"\206,\227G\320\026Q:\220\223\304&b(\007\3528K`=i\253\323\030\333\211 ]\300\332\035\264\356\327\255\"\326\031\266\277\305/\314\233\344\23732*\340\005Wx\t(\"ha\333\205"
+	.string	"\341W\n|\375\324~#\204\220-eJ\001\210"
+	.string	"z"
+	.string	"\203"
+	.string	"\362\006\217\232\217\b\341=\031\003\245\372\035\327\321\362\316Y##\310\234\343\002\037\b\3571h\300r\353#\f\023\337\315\r\354\026e\3161\265/\034^\2167\250\255\207\340\347\311\325\226o\273\304\301\304'F\366\362P\20223J\2763\243B>\350yBs\3345&{)X#\305\277\331=\221lv)\r$i\321\244$#!\t\324\024A1\222\215\320=\356\t\230\350bd)\256\340\2049\2475Fv\342\016\335\366\n\333\025\354\335\036_ti\366\037\364\300\320\360\272\260OV\233\254.\221\256\343\037\211^\373CV\207\277\335\340\307\373[\265\267j\251\352U\265\256\372"
+	.ascii	"\bTI\302\301gN\023AT&\022o\310\214\337\376\361j_\376@=w\234\221"
+	.ascii	"\004\202\363s\336\203\365\233u\302\227\2310\007$\007\317\234"
+	.ascii	"\223Bxo\345\002\276{\362\001\276{\367qX#9\242\354\333\306V8i"
+	.ascii	"\200\271\233\031<s\216\250{\226\0205i\332pc\366i\177\373\212"
+	.ascii	"\202\203{\332\303\324\024\b%\221oiG\360}[R-\201c\203\307\363"
+	.ascii	"\326\264\007\002\357\362\311\365\366\260\331\256\\\357\246\340"
+	.ascii	"\272\273\207\241\362\322\240\375\376\034?rv\344\322|\227\357"
+	.ascii	"+\"\247\310\b\235\342o\277R\007V\305\245A&\355|6'#E\310\032\365"
+	.ascii	"\337.\301\346\270K\033,&\024\322\312hCK\332\033\201\315^\032"
+	.ascii	"d\335\365\204\366\343#\330\270\364\307\272;\2623\365\307\001"
+	.ascii	"\033\036\302\202\270\022\275\0137\003\r\031D\f\016\304\006,&"
+	.ascii	"q%\256E\026q%\246:\250ZZTb\252\303\206\013-)q\365!\3052\300*"
+	.ascii	"\017\032V)\020*\325*5\262\355q~]\330\022\374Vd\321B\260q\355"
+	.ascii	"\313\267]\264\003\n\227f\220\346;\255\213N\206\242\016n\354\270"
+	.ascii	"\207@\272\332\027\356m\017\235\350d\224\264\337\306\302[\347"
+	.ascii	"\003\227\302\222\343\376\031\r\224\235o\365\307\340Np\351\217"
+	.ascii	"\3129\347\004\227f\365J\313\322\0059 P\002A\316]\007\340\004"
+	.ascii	"6\034R1\253\006U\247\035r\336\021?2Zq\3063K<k\215\274-d\367 "
+	.ascii	"\317\2075a\"S\236\017e0oV\244\264\342\242g\332blR\231\200\255"
+	.ascii	"\303\252\210\b\274Y\244`\250\210\177\254\315\261\267\f\367&X"
+	.ascii	"\213Y\232z\025\245\311f0\261[\344l\350Z\253\301\0303\216\240"
+	.ascii	"\205\340\322\036\342{\r\026:s\0336\323p\341!\240\315\3241^v\220"
+	.ascii	"}\215\317k\235\326<\001"
+	.text
+	.section	.gnu.lto_crc8_update.11.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`*\006=&"
+	.string	"\232E\360\016I\200\332Q:?\215\205&\300\323\362\374\264\037\020\344}\0220>XL:AV.\024\245\266\351\357\207\274\340\327f\356\337}\247-\037\332]\302c\266\243X~\031\374\267@'\322p\210\027=\351\203\224J\333>!\204\220-w\222\001\340"
+	.string	"\321"
+	.string	"\333"
+	.ascii	"\301\247t\350b\313\354^b\356%W\35049\333\344Nz\177r\202\323{"
+	.ascii	"\247\322\212\320\227\003l\230\\W\346_\235I\357D&\363\235{yd\211"
+	.ascii	"@\374\217\371\022}\217\371\262\265\344j\275\225\217\373^\034"
+	.ascii	"K\252\334KL\300\006\320\227\r\034\364\330w\342\017'\263\252("
+	.ascii	"\204\242\346^\242\256}0z\324W-\361\\k\337m\265\024=\315\322v"
+	.ascii	"\365\361\211\312\250\260\200Rq\233=W8\t9\331S\rK\204f\326\365"
+	.ascii	"\"\260\326\b\364\210\222zj\317\027O^N\366D\303\022\235\221\221"
+	.ascii	":\362u\b\325T\321\036Q3~\312\270Y\203\222\361\322\026\030\333"
+	.ascii	"!&\007*h\001\340\270\002\303\006\265\242Z\344\023()2\0255\343"
+	.ascii	"\375\342\313\252)gSQR\257g\321\275\227+\013\250\250\363\355\314"
+	.ascii	"\374\205\23150\227[\002a\347 \2642\020Z\371'\255\354\223V\356"
+	.ascii	"\251\225yj\345\235\264\262\016.\007\347`\347\233\355V\177z\254"
+	.ascii	"3\372'\377y\342o^\353loun\264r=+\037@\200#c"
+	.string	"#\216\367:\275is\267\224]C\016\366\207\375X\277\326-\363\371U\036\306G\262\215{\007\343\037\271\267\364(\374\256\1775\232/j\356\2756/+I\274\254\370\026\234]e\234\201\317\205UU\264@r\265\236\313\312\267\340\224b\2542{i\267r\257r#\237\212\221\312\322\247\360\027\252\342\t\3152*1\273\367b\270q\311\366\322\022s\314\337\342\006\016\226.\305\207^\"gV\325\020\263\013\350\3133\367\370Y/\262\315\002\265\230\354\235\241s\233\214R\210X@_Z\0279f,\246\337=d\026\352\207!xP\013\365\2038\004\f\235M\365\003&\256\201j\213&H\314L\237\376\351\247\t\335\374\216d\366\264O_\030\203\247{\272\204\202\340;\315\323\017\266\301\365N\233W\262\345d\254D2u:\205\223+M\025\215q\255\323\366K\350F,Mg\275X\303es\022\220\267H\246\304\316\344\f\370\325\316\351c\021\306"
+	.ascii	"\212\235\221\201=\202\216\337\36151-d\367\353o!\226\344r\373"
+	.ascii	"^\257\225\rw\237\353\\\304O\232\020\201\336{\037\204\317d\276"
+	.ascii	"\254\335\306\241\324-\231\243\022\235\005\2114\327\344\r\264"
+	.ascii	"\217\365\001o\263\321\256]\202G\200\365\r\237\375\3562\241\233"
+	.ascii	"_}\3035I\303\354k}\203\216_e\3035)\203\354V6\314D`m*\346\237"
+	.ascii	"\3002b\270y0\243\225\207\204\036F\017q&\016;\336\256$q\017IG"
+	.ascii	"$,\210\022\037\222\216F\230F%\214<Xnp\344a\327\341\301\316\201"
+	.ascii	"\002\334\216\267k\336)\330\361v\272$%$$\245\235.)\204\021\222"
+	.ascii	"n\307[\322)\020b%\022G<]\t%%\236\316F\374\335\326\272m\266\206"
+	.ascii	"\240\343\327@\256I#\266\246\342\217!\307\2448\375\342\323\"\310"
+	.ascii	"\253j\266\355!\247\267f[\323\356\266\305\333%S\367V\266\257\365"
+	.ascii	"\tf\320l\324,\212\353\033N_\213\301m\343\364\203Gj\334\270\365"
+	.ascii	"\255\300\302\274\376\342\357\224\314\261%\215\323\246\342S\352"
+	.ascii	"\024j\024G!\235{P\017\217<\232v\274:\207\372\307\243e\307\027"
+	.ascii	"\235\323\270\036\362\227\031\324\024\3004U\264\307\220:C\206"
+	.ascii	"\353\203\005u\321\317\336{/\332T\\M\240\356\035\257\312\237\036"
+	.ascii	"\n~\250a,\246\020cD\312\210H 3\"m\306p\002\2311\273m\020H\251"
+	.ascii	"h\222d\031\003r\250\030\204`\377\024\212\300\342\311\241\226"
+	.ascii	"\246O\255A\030\330\206\305]CM;\021\b\3740\214\340\270\0036\""
+	.ascii	"\ng\250)\206\314[Z\3553_qoQ\301d\031\302?NZ\277\n\244\302y\345"
+	.ascii	"=\316\206\341\032\313\t\221\370\214\302@!!\301\203'\223\013\374"
+	.ascii	"\017\005Q\353\234\254-\233e1\n\261}\375\t\363\037<\300f\261\020"
+	.ascii	"\216P\004j\317\374\222\323\006\267\t\304\303@\243t\001\"\030"
+	.ascii	"\211\031\177t\005\227\304L\271\031\345\020\201\r5a\221\002A\371"
+	.ascii	"\262\306\335\216\253\214\031\02771 -}j\037|\314\254{PY{\352\216"
+	.ascii	"\376\326P\344\037ed\031J\320O\250\031\034\031\230#\231I\337D"
+	.ascii	"\333\t\205Nf\347*k\0027\214\237d+f\305\265Q\324<\020b\314 \032"
+	.ascii	"0\215\022\3261\003O\377i{\224\301\367m\321\230\331\324\315\037"
+	.text
+	.section	.gnu.lto_crc8_sum_update.12.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`P\002\345\023"
+	.string	"\246e\203I\320\322(\035b\301\201x\375\b\2739\276K\271v\267\r}\302\374T\201\320\001`c1\274"
+	.string	"\033\322.yx\007\370\333N\372j\355\314\221\334mh\265\030\245\354\001 \364\366V\307\212`<L\325\b\263\254\345O\032![\312\224\002o"
+	.string	"m"
+	.string	"l"
+	.string	"\003\346\3049z0\276"
+	.ascii	"\370/<\001\360\337\316\254T\237\233y\347\264\341\311\230s\\\340"
+	.ascii	"\004\341\277\022\023\231g\037uh\300\035\0342BA\346\034Y{b\246"
+	.ascii	"r\274\245\316\376\311\325\231\177\222\344\303\206s\371'O14<\001"
+	.ascii	"p1\362dI\211\350\274\353\r\367\242\262\247\346{\336\025$\305"
+	.ascii	"\260\341j\256'\2249\247\325\206\373p\203\267\355\262=\301V[\317"
+	.ascii	"\375\341u\367\351A?\370\361\377\276\273\345s\367\236\324\n\252"
+	.ascii	"\017\340\300\r#\327\2179i\232\204\314\035\037Q\212\353\376\335"
+	.ascii	"\325\226\371C\3479\265;\273\0269C\210L\030\0309TH\b\377\355\212"
+	.ascii	"\225\255k\371\254y@\335:\350P\232s\\\375s\204%\261\222-\356B"
+	.ascii	"\366 \016Rd\302\230\230A\t\377\215H\020\253U\373,\016$\373\350"
+	.ascii	"\037\017\226\213BS\246\3139\347\224\252\375\216\301\345\252\366"
+	.ascii	"5\037\004#R\373\334\256nj\217T\263\361_l\200\205(\374\026\360"
+	.ascii	"\237\256\n\335D\250z4t\207j\304\340\326\332\233q\332\353>\362"
+	.ascii	"\375\366\264\332\243\346\363\242M\006\367\273H2Ch\332d\355\001"
+	.ascii	"}\373\335)\334\320\224\311\332\373\3411\225\311\036]ts\354\237"
+	.ascii	"\350,)yqlU\n\025+Wy\265V\344\005\026\013\257V\0060\205%EE\272"
+	.ascii	"\244\245\"Vh \232\220\b\020c\342Z$\021c\"\353\005s\271`\"\353"
+	.ascii	"\205!\305\305\022c\032X$\006\f[i\305X,0X\214\225\032\347\245"
+	.ascii	"\334E\241\326\301\rm_\254=\033\337\346\370FE6=\275$\375V\356"
+	.ascii	"\355\274\207@\212x6\265\226\032\356\356\315\266O+\027\302\021"
+	.ascii	"\214.\371\274\313\237\022\253\312\024/ p\002\031\302\325\006"
+	.ascii	"r)\234\242\325\t'M\027\335\372\016\217_-\n!\n\033EL\350\243\260"
+	.ascii	"]B3g0`\006qP\305\242pP|\203\230\343fE\301\n\362\270\022ts\314"
+	.ascii	"Z\323\244\232\013Aq@\2708Q\n\035\343\315\371\234R\320\177\231"
+	.ascii	"c\177\366\321.\013\037\367\021\233\307\332\276\320\237=\224\254"
+	.ascii	")\201\362-\377_\356\b\375\t"
+	.text
+	.section	.gnu.lto_.symbol_nodes.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\325\005"
+	.string	"\242\310 *\220E\351\253\210r\270\252\276t\022\255\240%\271\225l\177\343\307\356\356\334\240\377\332\372\337\376\267\377m\177/k\237\264\275\t\221R\246~VNW\206\301h\233\005\335f\325\3346K\332\315Jw-o\227r8\271\224\221\212v\245@\362\227\221\033\034\206@"
+	.string	"\362\302\200\206\3638\301\361\250\361\001\343n\361\246H(qH\021\177t\2722\354\360\325\2653\003"
+	.string	"\r\331\326\013\325\261o\007P\371\304\030\343\273\252\355\334\004\025"
+	.ascii	"`h0\264\313\320\255A,\3260@=|\200d\320\322\006\013\206g\017\t"
+	.ascii	"\211\003\310\006s\321\241\207\340\321\003|\003\350\230\202;v"
+	.ascii	"\322d+\232xt\252\f"
+	.text
+	.section	.gnu.lto_.refs.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\b"
+	.string	"\005\002"
+	.string	"\001\016"
+	.string	""
+	.string	"\001\024"
+	.string	""
+	.string	"\001\030"
+	.string	""
+	.string	"\001\034"
+	.string	""
+	.string	"\0015"
+	.string	"\001\004"
+	.string	"\005\004"
+	.string	"\005\006"
+	.string	"\005\f"
+	.string	""
+	.string	"\005\017"
+	.string	""
+	.string	"\005\023"
+	.string	""
+	.string	"\005\027"
+	.string	""
+	.string	"\005,"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.de8c7e893e0719dc,"e",@progbits
+	.string	"(\265/\375`F\017\365H"
+	.string	"\252y\230\032BP^N:\337t=\316G?|\344xDG\254q\254\346\230\227\303\262\236V\377"
+	.string	"\352\374\031\245\273U\203\003`\205\345\037,(G\024\021\031N\321\306\306d\030\213\0318p\204\374\200ej\230nO\354\226)P\001\226\001\255\001`i\320\253\376\303zf2r\"3\335\261]\021\n\306\325\345\252g\273\237[\006\303f\220\006\321\001\316\271\352\331\f\213\341:\206v;\273\273\300\361\257\313\220\275*\313\361\030\23661\2313\035\227\271\020\263\355\266\273=\336\264A\3230WM\342\001\306\213a5zp\236;R\\k\370]\317M\306bb\"7\031\031\250qP\3470F]]l\203W\345\304n\036`Lj\016`\344/Pg\270"
+	.string	"\306'Y\333\307\017ih\\\256Zd/?w\341\267\246\"\353\005\355\271\356\026\271:\361\350\336\256\372\226\007\030W\016`tj\001!B\321\177S\374\034\002\202\372\337\0237\372o\b&\017?k"
+	.string	"\361\363\322\207\377u\3606\0308\376\027\203\207K\241\303\317\3743\207\237/L\275\351I\377\035\200\367?\206\022\362\277B\377\013y\303\377\b\377]\020\375\274\347g\245\237\221\267\351\277\240\377\206\377\357\317\205?K\375\f\365s\205\237\235~\216\3603\204\237\027\374\314\3643\202\237\r\374\034\340\347\343\317"
+	.ascii	"~\276\377\017\377\023\376\377\373\377\346\277\325\177\301\377"
+	.ascii	"\t\376\227\371\257\367\037\360\377\336\3778\377\325\374O\363"
+	.ascii	"\337\356\377\333\177\005\377\363\376#%&&&\376w\360g\351_\004"
+	.ascii	"$-E\353f\235\320\345ev\333aI\355\214\206\255\315\024d\333~\""
+	.ascii	"\273e>\271\243Ov\216\271D\262\322\350\222\225B\303\220l\033\r"
+	.ascii	"kg/Wg\\\267\023\032\206\334\322F\233\2252\303\222X)ti\004\212"
+	.ascii	"\223.Jj\234xrXg\0179\260\305\t}\362\261-\224\357\272\227sZ\375"
+	.ascii	"\344\266;\332\255\004\332\340\316Iey\327\344\0332D\346l\227\\"
+	.ascii	"\366\325<\203\022\265\315\346c\257@qhu\373\365W\206%/\333\356"
+	.ascii	"\336\352\346\222\273\265\332gw\023*\203\f\312}[\317>j'\323\253"
+	.ascii	"y\0065\322jB\267\372J\023\016c\245gP\2503r\322\265n\266K^k\277"
+	.ascii	"\350s\225.\333f\273\233\375\034\021\232\251\023\350\252\034\310"
+	.ascii	"yx\352\304z\316{X\360D\316\266\245Dv\374\230\315]\225\001\007"
+	.ascii	"Y\317N\306#;\341\001<Rk\213k^\365o\211\207\314\301\033t\325\003"
+	.ascii	"Y\357\260\035\236\262\037\3179\323\341\276/\265\335e\272\373"
+	.ascii	"\374V\207\367\220\226\310n\264\267\265\356\366\030~"
+	.string	"(?\226\303{\305\226\255\033m\t\222\234=96\201\272\333%\t\022\324f\230?8F\365+V6\261\236\304\3723\337\236\220\364\315\240\336^\336\245\023\307\253\251\027\007)\317\030W\2238?\263\3416\fG\306Q\214\314\354\017\234\237\335\360\033\316\223\241\346\301B\205\253\217\020\335\020\005]5\351\266\335k\230\216\355\221/45i\272\274\f\332]\225\3170\032\23621\336\2434\274\270\214k\337\214\300\002\253\352\206\t\223\272$\306:}\007N\317*tfv\263[\246\324\255\306\026\363\300\346\004\365V!=I\222\0302\236/_V\344V\343\222k\344\032\271einT\351\030@bd\277eGX\236}^\256z\307$\254\255\341]\365\036\271m\353\215r\303\2467\354\212)=Q\214\341r\211\034E\267\276\bJC4\026H\206\246\311j\374\363\272\317\353u\301nC\323\346\0041L\311\2232\344\027\214\363V8I\316"
+	.ascii	"^\365~q\236T\337\327\232kd\035z^\347\235\267\213\311@\320qA\n"
+	.ascii	"\004\\&r\375v]O1Q\314\317\240\253\336 \227\375\203\272M\331\273"
+	.ascii	"U\264\206\304\317\240\277\241#MC6W\275Z<\307\214\310\024\270"
+	.ascii	"\275b\334\333\037\270A\353P\213x\304\313\214Z\033\222\243+\023"
+	.ascii	"l22'\343\336\22554w\371\313$b\023d\306u\325\333\\'$e\362\306"
+	.ascii	"\360{\224\316-n\314\307\250\007vh\b\270\336\346\003vc.\234r!"
+	.ascii	"\037*=Q\3201\023\354g\221\t\202n\031!\2372C\225H\331\0344m[t"
+	.ascii	"\267dZ\244\315\272\ny\300}\330\317y\220\003My\220\t\327e\367"
+	.ascii	"\262m0#\035+\0041P\223)q2:\t\242\344\016\2403\341\037\245\201"
+	.ascii	"\353\214\272\0230X\027\241\236\253\362\037\256C2c\303\373\273"
+	.ascii	"\352\3770\035\3411\323\267w\325s\333zc3\237\335MD\250\355\273"
+	.ascii	"\246\321Y\350\210\213\354\240\373\177\221\200_\367\021(\203\306"
+	.ascii	"7\321\261\3013h\021\335,Xg\364\211d\245\314%RH\033\rc\245\321"
+	.ascii	"0d\267qc\001SEXJ\026CRP/\252\2249\260`\030\355\350\221\245\n"
+	.ascii	"\300\272\372qDFeQ\321\360Q\203j*\211\225\344\301cF\201*\345\214"
+	.ascii	"\032<z(U\351\2401CI\205\374\222R\231#\231\244\222\202Jb%\213"
+	.ascii	"\236\314\201UeUuc}\006\251\nRS?\206>\325\341B\207\013\306Ou\200"
+	.ascii	"\202\352 \005\265^\n\252\250\244\212\302\240<\016\0136z\320\330"
+	.ascii	"1\243\nK\231\245\340W<\252\260\236\224WWXOE5\254\252\212YT6z"
+	.ascii	"\320\3102b)y\024\225TSCJ*)(\245U\216\036\353\243\252j$ilHj\260"
+	.ascii	"p<\007\016#\030\274PQbMZHb%\237\254\256v\354\270J>Y\345\230\261"
+	.ascii	"\343)\211\225\365d\241\300o\233\001\332\315\274p\027\314o\373"
+	.ascii	"\366\266\307\303n&s\203#s\203\333VF\f\321\370%\013 \263*^\312"
+	.ascii	"\3244\276B\25771\206\202\205\031\330E\2558D\313\236-.\314\233"
+	.ascii	"Fj\327\272]6Um\3127\270\205\017\211\306\320\350\216\264\265\335"
+	.ascii	",S"
+	.string	"\356\023u\343\302\362\233%M\317\t\221\253\336+\227U\203\264\035B\335\326K\247J\225\313\306q\r\226\301\220(N_\031/k\277l{q\203~\313\313\272\250\003\270\307\266^3\017\244H\271jK\320b \031-\304@\335dNEhtR@S~\325\204\250\024\326\361]\365\246]\226(\313\237\034\222:\025\256\215\354\t\332z\013\241@\201\203\324\347\206\213^\221\265h\367\344\311-3\221\324\315<\3235\2431!\202\204\354\252\"ir\2354\271hjjk\0202i\246\234\375\242\r1\021\343\367u\325\033\005\200gO\036\232\2743@\201vW}\261\031\201K\250\3014e\2304\"\"\"\"\"I\222\244\003q\005\204 \006-\254\007\021@-\243HhD\222$\251l\254\001\210(\340\005\357\260\224\3334Y\332\177\t\220\366\330\t\\\214\223\033\301\326\330\034\350\315,Ex\335E%Q\313\203!O\226sB\331\261L"
+	.string	"\033\347W\340G\226\262\017\202\372\330\353Ef\2348\355\341\357\232\023\353`vs\034\375\021\213J\200\245\"`Q\ta\005\2108\007(\005B\3045\371\323\200\340\353R\3266\332\376.\206"
+	.string	"q\215\262"
+	.string	"\361t\262\261o\273LQ\036*a\317\261\254\231\016\257\007\004)H1\347\364V1O\360\"\376\022\021\351\317\365>\262\262\276.\275\022\3361\336\335\227h\216B\220\357\330f\327\307(u\005\254\007\021\3572\r\3407\212\005\233&M\314\303\371\267\256*\206>\366\256Nt+\312m\357\037#\267\261\356O\307\203\236"
+	.ascii	"Q3\027\262ROXb\322\350\203\377h\020\202\0168\323P\b\237f\033"
+	.ascii	"\305\320\352%\207\364\202\210\260\201d\332\013\330\251\215\034"
+	.string	"\364;\001t\242\261\246\372j\r\244\027 \277\311\205\273\360\270\311\367\317U\274\305\371E\b\016\277\324\036\250\356\300\2274\202\177\311\212\rIW\007J\324\345\221\307\036\234\350\216\b\022\356g\313;\324\244\031x\t\246\032V\034S\355jLq\3650$\023\255\241\237\310\230\343\fd\362\334\204\316\236)\006Y\260\351G\336\227:\313\376\210\246\3678\023\325\0354\033\316\317gP\203\315\240<[$\036@\002\340\177\035s*\371<\221TH\024\023L\177(\215[\207\301\022\206\021\370\005\200\246!\226q\225\025+\020\341\244\266c\274w*3\233ps\001v-qQc!\377*C\246!\326H\356$1\345\037\240\365"
+	.string	"\336S\274Q\212\362\361\025\301\357\373\177|\341\016|\346rLL\326\271<\214\202\322\207\226SmVZ&\353&\026\343`I\036!\3478gV\257\273\347\3277\313\263\221;\317l\201\036\376xI\272\315\255\326$g\253i\273\027\335\263\353\3741\037\273\261"
+	.ascii	"\375\373\2073\034b\362\025\265ho\365\231\367\n\327R\300\316|"
+	.ascii	"\330g(\017I\377\323\316r\253e\315\037\324\25381\037\220\334\225"
+	.ascii	"K\036\033\307s\231b\330\333\374\215\372\225\345\t\334}I\277x"
+	.ascii	"\277\356\256}\215`0\3064\315\202T\001"
+	.text
+	.section	.gnu.lto_.symtab.de8c7e893e0719dc,"e",@progbits
+	.string	"crc16_ccitt"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\001"
+	.string	""
+	.string	"crc16_ccitt_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\001"
+	.string	""
+	.string	"crc8_dvb_s2_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"crc8_dvb_s2_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\001"
+	.string	""
+	.string	"crc8_xor_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\001"
+	.string	""
+	.string	"crc8_xor_sbuf_append"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"crc8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"crc8_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"crc8_sum_update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.de8c7e893e0719dc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
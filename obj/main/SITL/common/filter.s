@@ -0,0 +1,11330 @@
+	.file	"filter.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/filter.h"
+	.file 4 "./src/main/common/axis.h"
+	.file 5 "./src/main/common/maths.h"
+	.file 6 "./src/main/common/filter.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	filter.c.bbd7fdd0
+	.weak	filter.c.bbd7fdd0
+filter.c.bbd7fdd0:
+	.long	0xa12
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF1480
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1399
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1400
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1401
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1402
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1403
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1404
+	.uleb128 0x8
+	.long	.LASF1405
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	.LASF1406
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1407
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1408
+	.uleb128 0x8
+	.long	.LASF1409
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x4c
+	.uleb128 0x8
+	.long	.LASF1410
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x5f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1411
+	.uleb128 0x1a
+	.long	0x93
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1412
+	.uleb128 0x15
+	.long	0x30
+	.byte	0x4
+	.byte	0x14
+	.long	0xbe
+	.uleb128 0x12
+	.string	"X"
+	.byte	0
+	.uleb128 0x12
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x12
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1414
+	.byte	0x4
+	.byte	0x16
+	.long	0xd4
+	.uleb128 0x13
+	.long	.LASF1416
+	.byte	0x17
+	.long	0x93
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1413
+	.byte	0x3
+	.byte	0x18
+	.byte	0x3
+	.long	0xbe
+	.uleb128 0xf
+	.long	.LASF1415
+	.byte	0xc
+	.byte	0x1a
+	.long	0x10c
+	.uleb128 0x13
+	.long	.LASF1416
+	.byte	0x1b
+	.long	0x93
+	.uleb128 0x3
+	.string	"RC"
+	.byte	0x1c
+	.byte	0xb
+	.long	0x93
+	.byte	0x4
+	.uleb128 0x3
+	.string	"dT"
+	.byte	0x1d
+	.byte	0xb
+	.long	0x93
+	.byte	0x8
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1417
+	.byte	0x3
+	.byte	0x1e
+	.byte	0x3
+	.long	0xe0
+	.uleb128 0xf
+	.long	.LASF1418
+	.byte	0x24
+	.byte	0x21
+	.long	0x187
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x22
+	.byte	0xb
+	.long	0x93
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x22
+	.byte	0xf
+	.long	0x93
+	.byte	0x4
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x22
+	.byte	0x13
+	.long	0x93
+	.byte	0x8
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x22
+	.byte	0x17
+	.long	0x93
+	.byte	0xc
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x22
+	.byte	0x1b
+	.long	0x93
+	.byte	0x10
+	.uleb128 0x3
+	.string	"x1"
+	.byte	0x23
+	.byte	0xb
+	.long	0x93
+	.byte	0x14
+	.uleb128 0x3
+	.string	"x2"
+	.byte	0x23
+	.byte	0xf
+	.long	0x93
+	.byte	0x18
+	.uleb128 0x3
+	.string	"y1"
+	.byte	0x23
+	.byte	0x13
+	.long	0x93
+	.byte	0x1c
+	.uleb128 0x3
+	.string	"y2"
+	.byte	0x23
+	.byte	0x17
+	.long	0x93
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1419
+	.byte	0x3
+	.byte	0x24
+	.byte	0x3
+	.long	0x118
+	.uleb128 0xf
+	.long	.LASF1420
+	.byte	0x10
+	.byte	0x2c
+	.long	0x1b3
+	.uleb128 0x13
+	.long	.LASF1416
+	.byte	0x2d
+	.long	0x1b3
+	.uleb128 0x3
+	.string	"k"
+	.byte	0x2e
+	.byte	0xb
+	.long	0x93
+	.byte	0xc
+	.byte	0
+	.uleb128 0x1b
+	.long	0x93
+	.long	0x1c3
+	.uleb128 0x1c
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1421
+	.byte	0x3
+	.byte	0x2f
+	.byte	0x3
+	.long	0x193
+	.uleb128 0xf
+	.long	.LASF1422
+	.byte	0x6c
+	.byte	0x31
+	.long	0x23e
+	.uleb128 0x3
+	.string	"b0"
+	.byte	0x32
+	.byte	0xb
+	.long	0x1b3
+	.byte	0
+	.uleb128 0x3
+	.string	"b1"
+	.byte	0x32
+	.byte	0x12
+	.long	0x1b3
+	.byte	0xc
+	.uleb128 0x3
+	.string	"b2"
+	.byte	0x32
+	.byte	0x19
+	.long	0x1b3
+	.byte	0x18
+	.uleb128 0x3
+	.string	"a1"
+	.byte	0x32
+	.byte	0x20
+	.long	0x1b3
+	.byte	0x24
+	.uleb128 0x3
+	.string	"a2"
+	.byte	0x32
+	.byte	0x27
+	.long	0x1b3
+	.byte	0x30
+	.uleb128 0x3
+	.string	"x1"
+	.byte	0x33
+	.byte	0xb
+	.long	0x1b3
+	.byte	0x3c
+	.uleb128 0x3
+	.string	"x2"
+	.byte	0x33
+	.byte	0x12
+	.long	0x1b3
+	.byte	0x48
+	.uleb128 0x3
+	.string	"y1"
+	.byte	0x33
+	.byte	0x19
+	.long	0x1b3
+	.byte	0x54
+	.uleb128 0x3
+	.string	"y2"
+	.byte	0x33
+	.byte	0x20
+	.long	0x1b3
+	.byte	0x60
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1423
+	.byte	0x3
+	.byte	0x34
+	.byte	0x3
+	.long	0x1cf
+	.uleb128 0x15
+	.long	0x30
+	.byte	0x3
+	.byte	0x40
+	.long	0x262
+	.uleb128 0x16
+	.long	.LASF1424
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1425
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1426
+	.byte	0x3
+	.byte	0x43
+	.byte	0x3
+	.long	0x24a
+	.uleb128 0xe
+	.long	0x93
+	.uleb128 0x14
+	.long	.LASF1427
+	.byte	0xa0
+	.long	0x93
+	.long	0x287
+	.uleb128 0x10
+	.long	0x93
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1428
+	.byte	0x9f
+	.long	0x93
+	.long	0x29b
+	.uleb128 0x10
+	.long	0x93
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1429
+	.byte	0x88
+	.long	0x93
+	.long	0x2b9
+	.uleb128 0x10
+	.long	0x93
+	.uleb128 0x10
+	.long	0x93
+	.uleb128 0x10
+	.long	0x93
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1435
+	.value	0x148
+	.byte	0x6
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x148
+	.byte	0x2d
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1431
+	.value	0x148
+	.byte	0x3c
+	.long	0x26e
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1432
+	.value	0x14a
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1433
+	.value	0x14b
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0xa
+	.long	.LASF1434
+	.value	0x14c
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x23e
+	.uleb128 0xc
+	.long	.LASF1436
+	.value	0x13d
+	.byte	0x6
+	.long	0x358
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x13d
+	.byte	0x2a
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1431
+	.value	0x13d
+	.byte	0x39
+	.long	0x26e
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1432
+	.value	0x13f
+	.byte	0xe
+	.long	0x58
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1433
+	.value	0x140
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0xa
+	.long	.LASF1434
+	.value	0x141
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1437
+	.value	0x138
+	.byte	0x7
+	.long	0x3ab
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x138
+	.byte	0x30
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1432
+	.value	0x138
+	.byte	0x3c
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x138
+	.byte	0x48
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1439
+	.value	0x138
+	.byte	0x5d
+	.long	0x87
+	.uleb128 0x11
+	.string	"Q"
+	.value	0x138
+	.byte	0x70
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1440
+	.value	0x138
+	.byte	0x86
+	.long	0x262
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1441
+	.value	0x12a
+	.byte	0x7
+	.long	0x400
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x12a
+	.byte	0x2c
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x12a
+	.byte	0x3a
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1439
+	.value	0x12a
+	.byte	0x4f
+	.long	0x87
+	.uleb128 0x11
+	.string	"Q"
+	.value	0x12a
+	.byte	0x62
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1440
+	.value	0x12a
+	.byte	0x78
+	.long	0x262
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1432
+	.value	0x12e
+	.byte	0xe
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1442
+	.value	0x11e
+	.byte	0x6
+	.long	0x455
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x11e
+	.byte	0x29
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x11e
+	.byte	0x3a
+	.long	0x7b
+	.uleb128 0x2
+	.long	.LASF1443
+	.value	0x11e
+	.byte	0x4f
+	.long	0x87
+	.uleb128 0x11
+	.string	"Q"
+	.value	0x11e
+	.byte	0x69
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1440
+	.value	0x11e
+	.byte	0x7f
+	.long	0x262
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1432
+	.value	0x120
+	.byte	0xe
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1444
+	.value	0x119
+	.byte	0x6
+	.long	0x486
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x119
+	.byte	0x2c
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x119
+	.byte	0x3d
+	.long	0x7b
+	.uleb128 0x2
+	.long	.LASF1443
+	.value	0x119
+	.byte	0x52
+	.long	0x87
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1445
+	.value	0x113
+	.byte	0x6
+	.long	0x4ce
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x113
+	.byte	0x2e
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1443
+	.value	0x113
+	.byte	0x3f
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x113
+	.byte	0x5c
+	.long	0x7b
+	.uleb128 0x2
+	.long	.LASF1446
+	.value	0x113
+	.byte	0x71
+	.long	0x7b
+	.uleb128 0x1d
+	.string	"Q"
+	.byte	0x6
+	.value	0x115
+	.byte	0xb
+	.long	0x93
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1481
+	.byte	0x6
+	.value	0x107
+	.byte	0xd
+	.long	0x52e
+	.uleb128 0x2
+	.long	.LASF1430
+	.value	0x107
+	.byte	0x3b
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1432
+	.value	0x107
+	.byte	0x47
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1438
+	.value	0x107
+	.byte	0x53
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1443
+	.value	0x107
+	.byte	0x68
+	.long	0x87
+	.uleb128 0x11
+	.string	"Q"
+	.value	0x107
+	.byte	0x82
+	.long	0x93
+	.uleb128 0x2
+	.long	.LASF1440
+	.value	0x107
+	.byte	0x98
+	.long	0x262
+	.uleb128 0xa
+	.long	.LASF1447
+	.value	0x109
+	.byte	0x14
+	.long	0x187
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1448
+	.byte	0xff
+	.byte	0x6
+	.long	0x55e
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xff
+	.byte	0x24
+	.long	0x55e
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0xff
+	.byte	0x33
+	.long	0x26e
+	.uleb128 0x9
+	.uleb128 0xa
+	.long	.LASF1432
+	.value	0x101
+	.byte	0xe
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x1c3
+	.uleb128 0x5
+	.long	.LASF1449
+	.byte	0xf6
+	.byte	0x6
+	.long	0x5a6
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xf6
+	.byte	0x23
+	.long	0x55e
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0xf6
+	.byte	0x31
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0xf6
+	.byte	0x3e
+	.long	0x93
+	.uleb128 0x4
+	.string	"RC"
+	.byte	0xf8
+	.byte	0x11
+	.long	0x9a
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1432
+	.byte	0xfa
+	.byte	0xe
+	.long	0x58
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1451
+	.byte	0xf0
+	.byte	0x6
+	.long	0x5c8
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xf0
+	.byte	0x1d
+	.long	0x72
+	.uleb128 0x1
+	.long	.LASF1431
+	.byte	0xf0
+	.byte	0x2c
+	.long	0x26e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1452
+	.byte	0xdb
+	.byte	0x7
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xdb
+	.byte	0x2a
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0xdb
+	.byte	0x38
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0xdb
+	.byte	0x4d
+	.long	0x87
+	.uleb128 0x6
+	.string	"Q"
+	.byte	0xdb
+	.byte	0x60
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0xdb
+	.byte	0x76
+	.long	0x262
+	.uleb128 0x4
+	.string	"x1"
+	.byte	0xde
+	.byte	0xb
+	.long	0x93
+	.uleb128 0x4
+	.string	"x2"
+	.byte	0xdf
+	.byte	0xb
+	.long	0x93
+	.uleb128 0x4
+	.string	"y1"
+	.byte	0xe0
+	.byte	0xb
+	.long	0x93
+	.uleb128 0x4
+	.string	"y2"
+	.byte	0xe1
+	.byte	0xb
+	.long	0x93
+	.byte	0
+	.uleb128 0xe
+	.long	0x187
+	.uleb128 0xb
+	.long	.LASF1454
+	.byte	0xd4
+	.byte	0x7
+	.long	0x93
+	.long	0x65c
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xd4
+	.byte	0x29
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0xd4
+	.byte	0x37
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1455
+	.byte	0xcc
+	.byte	0x7
+	.long	0x93
+	.long	0x68d
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xcc
+	.byte	0x29
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0xcc
+	.byte	0x37
+	.long	0x93
+	.uleb128 0xd
+	.long	.LASF1434
+	.byte	0xce
+	.byte	0x11
+	.long	0x9a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1456
+	.byte	0xbb
+	.byte	0x8
+	.long	0x93
+	.long	0x6be
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0xbb
+	.byte	0x2d
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0xbb
+	.byte	0x3b
+	.long	0x93
+	.uleb128 0xd
+	.long	.LASF1434
+	.byte	0xbe
+	.byte	0x11
+	.long	0x9a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1457
+	.byte	0x8a
+	.byte	0x6
+	.long	0x772
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x8a
+	.byte	0x27
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x8a
+	.byte	0x38
+	.long	0x7b
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x8a
+	.byte	0x4d
+	.long	0x87
+	.uleb128 0x6
+	.string	"Q"
+	.byte	0x8a
+	.byte	0x67
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x8a
+	.byte	0x7d
+	.long	0x262
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1458
+	.byte	0x8f
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0xd
+	.long	.LASF1459
+	.byte	0x90
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x4
+	.string	"sn"
+	.byte	0x91
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x4
+	.string	"cs"
+	.byte	0x92
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0xd
+	.long	.LASF1460
+	.byte	0x93
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x4
+	.string	"b0"
+	.byte	0x95
+	.byte	0xf
+	.long	0x93
+	.uleb128 0x4
+	.string	"b1"
+	.byte	0x95
+	.byte	0x13
+	.long	0x93
+	.uleb128 0x4
+	.string	"b2"
+	.byte	0x95
+	.byte	0x17
+	.long	0x93
+	.uleb128 0x4
+	.string	"a0"
+	.byte	0xa2
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x4
+	.string	"a1"
+	.byte	0xa3
+	.byte	0x15
+	.long	0x9a
+	.uleb128 0x4
+	.string	"a2"
+	.byte	0xa4
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1461
+	.byte	0x85
+	.byte	0x6
+	.long	0x79f
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x85
+	.byte	0x2a
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x85
+	.byte	0x3b
+	.long	0x7b
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x85
+	.byte	0x50
+	.long	0x87
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1462
+	.byte	0x7e
+	.byte	0x6
+	.long	0x7e0
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x7e
+	.byte	0x2c
+	.long	0x631
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x7e
+	.byte	0x3d
+	.long	0x87
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x7e
+	.byte	0x5a
+	.long	0x7b
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0x7e
+	.byte	0x6f
+	.long	0x7b
+	.uleb128 0x4
+	.string	"Q"
+	.byte	0x80
+	.byte	0xb
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1463
+	.byte	0x79
+	.byte	0x7
+	.long	0x93
+	.long	0x806
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x79
+	.byte	0x1d
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x79
+	.byte	0x36
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1466
+	.byte	0x6c
+	.byte	0x7
+	.long	0x93
+	.long	0x84e
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x6c
+	.byte	0x30
+	.long	0x84e
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x6c
+	.byte	0x3e
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x6c
+	.byte	0x4b
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x6c
+	.byte	0x5d
+	.long	0x93
+	.uleb128 0x9
+	.uleb128 0xd
+	.long	.LASF1468
+	.byte	0x6f
+	.byte	0x15
+	.long	0x9a
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF1469
+	.byte	0x67
+	.byte	0x6
+	.long	0x86a
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x67
+	.byte	0x2d
+	.long	0x84e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1470
+	.byte	0x61
+	.byte	0x6
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x61
+	.byte	0x22
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x61
+	.byte	0x30
+	.long	0x93
+	.byte	0
+	.uleb128 0xe
+	.long	0x10c
+	.uleb128 0xb
+	.long	.LASF1471
+	.byte	0x55
+	.byte	0x7
+	.long	0x93
+	.long	0x8cc
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x55
+	.byte	0x24
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x55
+	.byte	0x32
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x55
+	.byte	0x3f
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x55
+	.byte	0x4c
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1472
+	.byte	0x4e
+	.byte	0x7
+	.long	0x93
+	.long	0x8fc
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x4e
+	.byte	0x24
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x4e
+	.byte	0x32
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x4e
+	.byte	0x3f
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1473
+	.byte	0x48
+	.byte	0x7
+	.long	0x93
+	.long	0x922
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x48
+	.byte	0x23
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x48
+	.byte	0x31
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1474
+	.byte	0x44
+	.byte	0x7
+	.long	0x93
+	.long	0x93d
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x44
+	.byte	0x2b
+	.long	0x88c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1475
+	.byte	0x40
+	.byte	0x6
+	.long	0x95f
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x40
+	.byte	0x2c
+	.long	0x88c
+	.uleb128 0x6
+	.string	"tau"
+	.byte	0x40
+	.byte	0x3a
+	.long	0x93
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1476
+	.byte	0x3b
+	.byte	0x6
+	.long	0x98b
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x3b
+	.byte	0x21
+	.long	0x88c
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x3b
+	.byte	0x2f
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x3b
+	.byte	0x3c
+	.long	0x93
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1477
+	.byte	0x34
+	.byte	0x6
+	.long	0x9b7
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x34
+	.byte	0x23
+	.long	0x88c
+	.uleb128 0x6
+	.string	"tau"
+	.byte	0x34
+	.byte	0x31
+	.long	0x93
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x34
+	.byte	0x3c
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1478
+	.byte	0x29
+	.byte	0x7
+	.long	0x93
+	.long	0x9f2
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x29
+	.byte	0x1e
+	.long	0x72
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x29
+	.byte	0x2c
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x29
+	.byte	0x39
+	.long	0x93
+	.uleb128 0x6
+	.string	"dt"
+	.byte	0x29
+	.byte	0x46
+	.long	0x93
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1479
+	.byte	0x6
+	.byte	0x23
+	.byte	0x7
+	.long	0x93
+	.uleb128 0x1
+	.long	.LASF1430
+	.byte	0x23
+	.byte	0x1d
+	.long	0x72
+	.uleb128 0x1
+	.long	.LASF1433
+	.byte	0x23
+	.byte	0x2b
+	.long	0x93
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x21
+	.sleb128 0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.file 10 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 24 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1004
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 39 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.file 40 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 41 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 42 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x1a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1328
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 44 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1398
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1396
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1482
+	.long	.LASF1483
+	.long	.LASF1484
+	.long	.LASF1485
+	.long	.LASF1486
+	.long	.LASF1487
+	.long	.LASF1488
+	.long	.LASF1489
+	.long	.LASF1490
+	.long	.LASF1491
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1492
+	.byte	0x6
+	.long	.LASF1493
+	.byte	0x6
+	.long	.LASF1494
+	.byte	0x1
+	.long	.LASF1495
+	.byte	0x1
+	.long	.LASF1496
+	.byte	0x1
+	.long	.LASF1497
+	.byte	0x1
+	.long	.LASF1498
+	.byte	0x9
+	.long	.LASF1499
+	.byte	0xa
+	.long	.LASF1500
+	.byte	0xa
+	.long	.LASF1500
+	.byte	0x9
+	.long	.LASF1501
+	.byte	0x6
+	.long	.LASF1502
+	.byte	0x9
+	.long	.LASF1503
+	.byte	0x9
+	.long	.LASF1504
+	.byte	0x6
+	.long	.LASF1505
+	.byte	0x6
+	.long	.LASF1506
+	.byte	0x8
+	.long	.LASF1507
+	.byte	0x6
+	.long	.LASF1508
+	.byte	0x7
+	.long	.LASF1509
+	.byte	0x7
+	.long	.LASF1510
+	.byte	0x6
+	.long	.LASF1511
+	.byte	0x6
+	.long	.LASF1512
+	.byte	0x6
+	.long	.LASF1513
+	.byte	0x6
+	.long	.LASF1514
+	.byte	0x9
+	.long	.LASF1515
+	.byte	0xa
+	.long	.LASF1516
+	.byte	0x5
+	.long	.LASF1517
+	.byte	0x5
+	.long	.LASF1518
+	.byte	0x9
+	.long	.LASF1519
+	.byte	0x9
+	.long	.LASF1520
+	.byte	0x6
+	.long	.LASF1521
+	.byte	0x6
+	.long	.LASF1522
+	.byte	0x6
+	.long	.LASF1523
+	.byte	0x6
+	.long	.LASF1524
+	.byte	0x6
+	.long	.LASF1525
+	.byte	0x6
+	.long	.LASF1526
+	.byte	0x6
+	.long	.LASF1527
+	.byte	0x6
+	.long	.LASF1528
+	.byte	0x6
+	.long	.LASF1529
+	.byte	0x4
+	.long	.LASF1530
+	.byte	0x3
+	.long	.LASF1531
+	.byte	0x2
+	.long	.LASF1532
+	.byte	0x3
+	.long	.LASF1533
+	.byte	0x3
+	.long	.LASF1534
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1052:
+	.string	"__MATH_PRECNAME"
+.LASF1167:
+	.string	"USE_1WIRE_DS2482 "
+.LASF804:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1100:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF729:
+	.string	"__DECL_SIMD_cosl "
+.LASF1215:
+	.string	"USE_CLI_BATCH "
+.LASF1465:
+	.string	"cutoffFrequencyHz"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF797:
+	.string	"__DECL_SIMD_atan "
+.LASF999:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1455:
+	.string	"biquadFilterApply"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1446:
+	.string	"cutoffHz"
+.LASF967:
+	.string	"__DECL_SIMD_asinh "
+.LASF1007:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1134:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1358:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1076:
+	.string	"__MATHCALL"
+.LASF1012:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1396:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1199:
+	.string	"USE_RX_MSP "
+.LASF965:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF834:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1019:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1205:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1139:
+	.string	"USE_GPS "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1228:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1435:
+	.string	"biquadFilter3ApplyDF1"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1045:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1194:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF853:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1282:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1154:
+	.string	"USE_RX_UIB "
+.LASF1242:
+	.string	"_WCHAR_T_H "
+.LASF819:
+	.string	"__DECL_SIMD_hypotl "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1158:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1128:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1288:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF887:
+	.string	"__DECL_SIMD_atan2 "
+.LASF779:
+	.string	"__DECL_SIMD_powl "
+.LASF1378:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF919:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1184:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1470:
+	.string	"pt1FilterReset"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1115:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1147:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1028:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1250:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1135:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF782:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1265:
+	.string	"USE_UART7 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1124:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1381:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1437:
+	.string	"biquadFilter3UpdateAxis"
+.LASF855:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1276:
+	.string	"USE_SERVO_SBUS"
+.LASF1142:
+	.string	"USE_TELEMETRY "
+.LASF806:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1144:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1344:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1006:
+	.string	"__HAVE_FLOAT32 1"
+.LASF787:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1108:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1416:
+	.string	"state"
+.LASF476:
+	.string	"__P(args) args"
+.LASF927:
+	.string	"__DECL_SIMD_atanh "
+.LASF1318:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1114:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1390:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1445:
+	.string	"biquadFilter3InitNotch"
+.LASF1200:
+	.string	"USE_SERIALRX_SUMD "
+.LASF930:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1476:
+	.string	"pt1FilterInit"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1241:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1118:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF994:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1090:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1066:
+	.string	"_Mdouble_ _Float128"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1226:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF988:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF795:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1197:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1054:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1467:
+	.string	"rate_limit"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1341:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1127:
+	.string	"I2C2_OVERCLOCK false"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1386:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF765:
+	.string	"__DECL_SIMD_logf64x "
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1272:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1166:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF917:
+	.string	"__DECL_SIMD_log1p "
+.LASF1088:
+	.string	"__MATHCALL_NARROW"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1113:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF786:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1180:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1294:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1461:
+	.string	"biquadFilterInitLPF"
+.LASF1460:
+	.string	"alpha"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1280:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1434:
+	.string	"result"
+.LASF836:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1092:
+	.string	"FP_NAN 0"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1164:
+	.string	"USE_OPFLOW_MSP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1346:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1075:
+	.string	"__MATHDECL"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF1133:
+	.string	"USE_SERIALRX_IBUS "
+.LASF854:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1040:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF749:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1480:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1260:
+	.string	"USE_UART2 "
+.LASF1407:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1117:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1033:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1104:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1055:
+	.string	"_Mdouble_ float"
+.LASF957:
+	.string	"__DECL_SIMD_tanh "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1443:
+	.string	"samplingIntervalUs"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1239:
+	.string	"_BSD_WCHAR_T_ "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF839:
+	.string	"__DECL_SIMD_exp10l "
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF817:
+	.string	"__DECL_SIMD_hypot "
+.LASF1083:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1188:
+	.string	"CMS_MENU_OSD "
+.LASF851:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF873:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1337:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1367:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1456:
+	.string	"biquadFilterApplyDF1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1317:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1454:
+	.string	"biquadFilterReset"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1017:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF759:
+	.string	"__DECL_SIMD_logl "
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1177:
+	.string	"USE_FRSKYOSD "
+.LASF906:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1159:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1403:
+	.string	"signed char"
+.LASF908:
+	.string	"__DECL_SIMD_log2f "
+.LASF700:
+	.string	"__size_t__ "
+.LASF799:
+	.string	"__DECL_SIMD_atanl "
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1021:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1459:
+	.string	"omega"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1212:
+	.string	"USE_VTX_FFPV "
+.LASF1146:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF790:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF916:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1273:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1101:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF902:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1058:
+	.string	"_Mdouble_ long double"
+.LASF1399:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF767:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1293:
+	.string	"USE_RX_PPM"
+.LASF1259:
+	.string	"USE_UART1 "
+.LASF1330:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1074:
+	.string	"__MATHDECL_ALIAS"
+.LASF1398:
+	.string	"BIQUAD_Q 1.0f / sqrtf(2.0f)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1051:
+	.string	"_Mdouble_"
+.LASF1314:
+	.string	"NOINLINE "
+.LASF1307:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF796:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1123:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1152:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1027:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1030:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1382:
+	.string	"UNUSED(x) (void)(x)"
+.LASF816:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF1463:
+	.string	"filterGetNotchQ"
+.LASF1453:
+	.string	"value"
+.LASF1421:
+	.string	"pt1Filter3_t"
+.LASF1131:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1408:
+	.string	"char"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1003:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1440:
+	.string	"filterType"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1110:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1375:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1230:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF792:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1039:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF888:
+	.string	"__DECL_SIMD_atan2f "
+.LASF829:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1098:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1300:
+	.string	"U_ID_0 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1063:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF907:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1405:
+	.string	"__uint16_t"
+.LASF1189:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF975:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF738:
+	.string	"__DECL_SIMD_sinf "
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1247:
+	.string	"__DEFINED_wchar_t "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1313:
+	.string	"FAST_CODE "
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1093:
+	.string	"FP_INFINITE 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1371:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1295:
+	.string	"USE_RCDEVICE"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF843:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF793:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF833:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1391:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1303:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF731:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF968:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1285:
+	.string	"USE_PITOT_ADC"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1126:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF864:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1022:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1323:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF941:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF949:
+	.string	"__DECL_SIMD_erfl "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1094:
+	.string	"FP_ZERO 2"
+.LASF1186:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1204:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1120:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1175:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF771:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1095:
+	.string	"FP_SUBNORMAL 3"
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF814:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF845:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1244:
+	.string	"__INT_WCHAR_T_H "
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1433:
+	.string	"input"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1156:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1286:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1130:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1331:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1207:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF942:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1262:
+	.string	"USE_UART4 "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF913:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1179:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1270:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF758:
+	.string	"__DECL_SIMD_logf "
+.LASF1281:
+	.string	"USE_RANGEFINDER"
+.LASF979:
+	.string	"__DECL_SIMD_erfcl "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF867:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1274:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF801:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1326:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF929:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1355:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1290:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1246:
+	.string	"_WCHAR_T_DECLARED "
+.LASF730:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF914:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1047:
+	.string	"_Mdouble_ double"
+.LASF1439:
+	.string	"refreshRate"
+.LASF1374:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1387:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1070:
+	.string	"_Mdouble_ _Float64x"
+.LASF1354:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1451:
+	.string	"nullFilter3Apply"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF1397:
+	.string	"BIQUAD_BANDWIDTH 1.9f"
+.LASF1372:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF915:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1275:
+	.string	"USE_USB_MSC"
+.LASF1302:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1258:
+	.string	"USE_BARO "
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF772:
+	.string	"__DECL_SIMD_expf64 "
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"__DECL_SIMD_asin "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1071:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1266:
+	.string	"USE_UART8 "
+.LASF1013:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1060:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1169:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1353:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF856:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1099:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF785:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1394:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF909:
+	.string	"__DECL_SIMD_log2l "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF964:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1267:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1447:
+	.string	"coefficients"
+.LASF1031:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF824:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1436:
+	.string	"biquadFilter3Apply"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF736:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1475:
+	.string	"pt1FilterSetTimeConstant"
+.LASF1422:
+	.string	"biquadFilter3_s"
+.LASF1423:
+	.string	"biquadFilter3_t"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF837:
+	.string	"__DECL_SIMD_exp10 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF993:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1308:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF733:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF781:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1438:
+	.string	"filterFreq"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1370:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1420:
+	.string	"pt1Filter3_s"
+.LASF1342:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF900:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF770:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1041:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1263:
+	.string	"USE_UART5 "
+.LASF1089:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1301:
+	.string	"U_ID_1 1"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1103:
+	.string	"MATH_ERRNO 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1392:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1359:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1253:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1368:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF995:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1251:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1227:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF996:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1024:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF788:
+	.string	"__DECL_SIMD_acosf "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1472:
+	.string	"pt1FilterApply3"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1222:
+	.string	"_T_PTRDIFF_ "
+.LASF1256:
+	.string	"USE_FAKE_GPS "
+.LASF1327:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1350:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF987:
+	.string	"__DECL_SIMD_tan "
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1424:
+	.string	"FILTER_LPF"
+.LASF1121:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1225:
+	.string	"_PTRDIFF_T_ "
+.LASF898:
+	.string	"__DECL_SIMD_log10f "
+.LASF899:
+	.string	"__DECL_SIMD_log10l "
+.LASF889:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1073:
+	.string	"__MATHDECL_1"
+.LASF1140:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1231:
+	.string	"__need_ptrdiff_t"
+.LASF1145:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF777:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1023:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1462:
+	.string	"biquadFilterInitNotch"
+.LASF739:
+	.string	"__DECL_SIMD_sinl "
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1304:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1373:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1112:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1406:
+	.string	"__uint32_t"
+.LASF1429:
+	.string	"constrainf"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1377:
+	.string	"STR_HELPER(x) #x"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1107:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf "
+.LASF877:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF842:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1232:
+	.string	"__wchar_t__ "
+.LASF1292:
+	.string	"USE_VCP"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1210:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF727:
+	.string	"__DECL_SIMD_cos "
+.LASF1333:
+	.string	"FAST_MATH "
+.LASF1016:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1216:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF743:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1237:
+	.string	"__WCHAR_T "
+.LASF1412:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1109:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF756:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1339:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1458:
+	.string	"sampleRate"
+.LASF1160:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF1082:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF784:
+	.string	"__DECL_SIMD_powf32x "
+.LASF937:
+	.string	"__DECL_SIMD_acosh "
+.LASF1296:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1057:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF904:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF986:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1002:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF805:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1061:
+	.string	"_Mdouble_ _Float32"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1388:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1320:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF774:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1220:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1111:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF857:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF923:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF1068:
+	.string	"_Mdouble_ _Float32x"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f "
+.LASF998:
+	.string	"__HAVE_FLOAT128 1"
+.LASF901:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1362:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1466:
+	.string	"rateLimitFilterApply4"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1325:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1401:
+	.string	"unsigned int"
+.LASF1190:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1176:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1261:
+	.string	"USE_UART3 "
+.LASF1069:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1072:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1283:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1046:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1122:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF766:
+	.string	"__DECL_SIMD_logf128x "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF992:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1193:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF897:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1384:
+	.string	"BIT(x) (1 << (x))"
+.LASF773:
+	.string	"__DECL_SIMD_expf128 "
+.LASF912:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf "
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1414:
+	.string	"rateLimitFilter_s"
+.LASF1413:
+	.string	"rateLimitFilter_t"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1298:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1195:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1151:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF778:
+	.string	"__DECL_SIMD_powf "
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1450:
+	.string	"f_cut"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1056:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF395:
+	.string	"true 1"
+.LASF1143:
+	.string	"USE_TELEMETRY_LTM "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1430:
+	.string	"filter"
+.LASF1291:
+	.string	"USE_ADC"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1332:
+	.string	"sq(x) ((x)*(x))"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1425:
+	.string	"FILTER_NOTCH"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF775:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1356:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF762:
+	.string	"__DECL_SIMD_logf64 "
+.LASF865:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1015:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1182:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF960:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1364:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1234:
+	.string	"_WCHAR_T "
+.LASF1395:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF744:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1009:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1087:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF939:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1254:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF863:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF826:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1141:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1418:
+	.string	"biquadFilter_s"
+.LASF1419:
+	.string	"biquadFilter_t"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF769:
+	.string	"__DECL_SIMD_expl "
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF952:
+	.string	"__DECL_SIMD_erff64 "
+.LASF848:
+	.string	"__DECL_SIMD_coshf "
+.LASF1426:
+	.string	"biquadFilterType_e"
+.LASF763:
+	.string	"__DECL_SIMD_logf128 "
+.LASF783:
+	.string	"__DECL_SIMD_powf128 "
+.LASF910:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1221:
+	.string	"_PTRDIFF_T "
+.LASF1183:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1255:
+	.string	"USE_FAKE_MAG "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1269:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1229:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF813:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1400:
+	.string	"short unsigned int"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF1196:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF921:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1365:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF757:
+	.string	"__DECL_SIMD_log "
+.LASF789:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1441:
+	.string	"biquadFilter3Update"
+.LASF1206:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1240:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1001:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF989:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF903:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1471:
+	.string	"pt1FilterApply4"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF760:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1352:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1481:
+	.string	"biquadFilter3SetCoefficients"
+.LASF1223:
+	.string	"_T_PTRDIFF "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1369:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1299:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1201:
+	.string	"USE_SERIALRX_SUMH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1336:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF990:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1125:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF815:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1366:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1279:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1380:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1097:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1328:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF383:
+	.string	"SITL 1"
+.LASF800:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF966:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1348:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1319:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1409:
+	.string	"uint16_t"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1224:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1091:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1181:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1102:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1402:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF905:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1343:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF869:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1324:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF746:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1448:
+	.string	"pt1Filter3Apply"
+.LASF1035:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1173:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1277:
+	.string	"USE_DASHBOARD"
+.LASF950:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1044:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1329:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1042:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF717:
+	.string	"__size_t "
+.LASF891:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF827:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1363:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1249:
+	.string	"__need_wchar_t"
+.LASF1310:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1213:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF735:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1236:
+	.string	"_T_WCHAR "
+.LASF1252:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF983:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1432:
+	.string	"axis"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF726:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1202:
+	.string	"USE_SERIALRX_XBUS "
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF859:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1163:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF768:
+	.string	"__DECL_SIMD_expf "
+.LASF1211:
+	.string	"USE_VTX_TRAMP "
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1136:
+	.string	"USE_ADC_AVERAGING "
+.LASF750:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1029:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1444:
+	.string	"biquadFilter3InitLPF"
+.LASF956:
+	.string	"__DECL_SIMD_erff128x "
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1349:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF997:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1361:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1157:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1297:
+	.string	"USE_ITCM_RAM"
+.LASF1153:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1209:
+	.string	"USE_VTX_CONTROL "
+.LASF1431:
+	.string	"values"
+.LASF948:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF810:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1161:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1427:
+	.string	"cos_approx"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF973:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF547:
+	.string	"__stub_chflags "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1264:
+	.string	"USE_UART6 "
+.LASF737:
+	.string	"__DECL_SIMD_sin "
+.LASF1096:
+	.string	"FP_NORMAL 4"
+.LASF1165:
+	.string	"USE_PITOT_MS4525 "
+.LASF1218:
+	.string	"_STDDEF_H "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1316:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1026:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1149:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1004:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1452:
+	.string	"biquadFilterUpdate"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1289:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1008:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1018:
+	.string	"__f32(x) x ##f32"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1287:
+	.string	"USE_1WIRE_DS2482"
+.LASF1162:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1479:
+	.string	"nullFilterApply"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1389:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1312:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF728:
+	.string	"__DECL_SIMD_cosf "
+.LASF751:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1238:
+	.string	"_WCHAR_T_ "
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1059:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF741:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF798:
+	.string	"__DECL_SIMD_atanf "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf "
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1404:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1105:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF947:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1284:
+	.string	"USE_PITOT_MS4525"
+.LASF1137:
+	.string	"USE_64BIT_TIME "
+.LASF846:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF811:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1000:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1449:
+	.string	"pt1Filter3Init"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1172:
+	.string	"USE_DASHBOARD "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF953:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1340:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF849:
+	.string	"__DECL_SIMD_coshl "
+.LASF1468:
+	.string	"rateLimitPerSample"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1132:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1245:
+	.string	"_GCC_WCHAR_T "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1119:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1038:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1311:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1174:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF852:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1309:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF776:
+	.string	"__DECL_SIMD_expf128x "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1360:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1233:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF977:
+	.string	"__DECL_SIMD_erfc "
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF725:
+	.string	"_MATH_H 1"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1315:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF742:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1020:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1383:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1473:
+	.string	"pt1FilterApply"
+.LASF1198:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF955:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1170:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF895:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1478:
+	.string	"nullFilterApply4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1345:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1043:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF802:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1379:
+	.string	"EXPAND_I(x) x"
+.LASF1032:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF847:
+	.string	"__DECL_SIMD_cosh "
+.LASF890:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1428:
+	.string	"sin_approx"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1148:
+	.string	"USE_PITOT_ADC "
+.LASF1014:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1464:
+	.string	"centerFrequencyHz"
+.LASF1243:
+	.string	"___int_wchar_t_h "
+.LASF809:
+	.string	"__DECL_SIMD_asinl "
+.LASF1376:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1084:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1474:
+	.string	"pt1FilterGetLastOutput"
+.LASF1085:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1155:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1322:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1257:
+	.string	"USE_MAG "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF959:
+	.string	"__DECL_SIMD_tanhl "
+.LASF803:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1347:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF961:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1235:
+	.string	"_T_WCHAR_ "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1357:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1248:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF850:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1005:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1410:
+	.string	"uint32_t"
+.LASF1271:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF747:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1338:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF911:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1187:
+	.string	"USE_CMS "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF991:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1036:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF740:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1278:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF951:
+	.string	"__DECL_SIMD_erff32 "
+.LASF934:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1305:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1334:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1037:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF791:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF745:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF969:
+	.string	"__DECL_SIMD_asinhl "
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1411:
+	.string	"float"
+.LASF1214:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1064:
+	.string	"_Mdouble_ _Float64"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1192:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1203:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1171:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1268:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1477:
+	.string	"pt1FilterInitRC"
+.LASF808:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF780:
+	.string	"__DECL_SIMD_powf16 "
+.LASF761:
+	.string	"__DECL_SIMD_logf32 "
+.LASF954:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1321:
+	.string	"__FAST_MATH__ 1"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF734:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1469:
+	.string	"rateLimitFilterInit"
+.LASF1048:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1185:
+	.string	"USE_LOG "
+.LASF1129:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1138:
+	.string	"USE_BLACKBOX "
+.LASF868:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1393:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1351:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1025:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1219:
+	.string	"_STDDEF_H_ "
+.LASF1457:
+	.string	"biquadFilterInit"
+.LASF1116:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1208:
+	.string	"USE_RCDEVICE "
+.LASF794:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1086:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF764:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1306:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1442:
+	.string	"biquadFilter3Init"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1034:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1415:
+	.string	"pt1Filter_s"
+.LASF1417:
+	.string	"pt1Filter_t"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1217:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1385:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF812:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1106:
+	.string	"M_E 2.7182818284590452354"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1150:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1191:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF732:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1168:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1335:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1178:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1527:
+	.string	"mathcalls-helper-functions.h"
+.LASF1519:
+	.string	"math.h"
+.LASF1507:
+	.string	"long-double.h"
+.LASF1517:
+	.string	"__locale_t.h"
+.LASF1529:
+	.string	"platform.h"
+.LASF1528:
+	.string	"mathcalls.h"
+.LASF1531:
+	.string	"target.h"
+.LASF1521:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1501:
+	.string	"libc-header-start.h"
+.LASF1489:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1520:
+	.string	"math-vector.h"
+.LASF1482:
+	.string	"src/main/common"
+.LASF1513:
+	.string	"stdint-intn.h"
+.LASF1495:
+	.string	"axis.h"
+.LASF1488:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1491:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1508:
+	.string	"stubs.h"
+.LASF1483:
+	.string	"src/main/target/SITL"
+.LASF1533:
+	.string	"common_post.h"
+.LASF1505:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1525:
+	.string	"fp-logb.h"
+.LASF1487:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1518:
+	.string	"strings.h"
+.LASF1503:
+	.string	"features-time64.h"
+.LASF1492:
+	.string	"types.h"
+.LASF1523:
+	.string	"floatn-common.h"
+.LASF1522:
+	.string	"floatn.h"
+.LASF1499:
+	.string	"stdbool.h"
+.LASF1490:
+	.string	"/usr/include"
+.LASF1532:
+	.string	"sanity_check.h"
+.LASF1502:
+	.string	"features.h"
+.LASF1530:
+	.string	"common.h"
+.LASF1510:
+	.string	"typesizes.h"
+.LASF1516:
+	.string	"locale_t.h"
+.LASF1511:
+	.string	"time64.h"
+.LASF1493:
+	.string	"stdint-uintn.h"
+.LASF1484:
+	.string	"src/main/target"
+.LASF1534:
+	.string	"utils.h"
+.LASF1524:
+	.string	"flt-eval-method.h"
+.LASF1485:
+	.string	"src/main"
+.LASF1506:
+	.string	"cdefs.h"
+.LASF1512:
+	.string	"wchar.h"
+.LASF1526:
+	.string	"fp-fast.h"
+.LASF1496:
+	.string	"maths.h"
+.LASF1514:
+	.string	"string.h"
+.LASF1486:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1500:
+	.string	"stdint.h"
+.LASF1515:
+	.string	"stddef.h"
+.LASF1509:
+	.string	"stubs-64.h"
+.LASF1504:
+	.string	"wordsize.h"
+.LASF1497:
+	.string	"filter.c"
+.LASF0:
+	.string	"./src/main/common/filter.c"
+.LASF1498:
+	.string	"stdc-predef.h"
+.LASF1494:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\376\001=\n"
+	.string	"\204\016\362\002"
+	.string	"\037"
+	.string	"\231\360\231\212\016"
+	.string	"\001\370\226\267\333\004"
+	.string	"\002\225\223\354\373\t\006\002"
+	.string	"\002\001\003\347\300\246\240\016\004\302\225\367\251\017\002\005\252\314\202\351\007\006\214\205\271H\b\007\236\202\214\200\007\b\335\371\314\371\013\f\t\343\227\236^\n\371\237\231\202\002\002\013\336\210\240\354\004\b\f\205\227\237\272\003"
+	.string	"\r\317\353\246\345\013\034\002"
+	.string	"\002\003\016\224\270\237\345\013"
+	.string	"\017\264\304\271\240\006"
+	.string	"\020\213\222\323\377\t\026\002"
+	.string	"\002\004\002"
+	.string	"\002\005\004\002\004\021\225\360\222\013\032\022\317\315\245\365\002\022\023\346\330\246\220\005\n\024\320\306\302\212\b\020\025\253\212\334\374\001"
+	.string	"\026\236\275\331\277\b\006\027\313\265\270g\n\002"
+	.string	"\030\212\210\215\371\005\005\031\032\033\365\307\235\332\005\024\005\005\005\034\220\253\260\233\b"
+	.string	"\035\201\211\325\264"
+	.string	"\005\005\005\005"
+	.string	"\002"
+	.string	"\036\373\245\364\n\036"
+	.string	""
+	.string	", \320\002**\355;\201\016\002P3G\234\314\3102\337\223\241\335\364\222\356rl\327\022\334n\234L\0066\261\300\213\325\240\201$p\220\254{\003"
+	.ascii	"\017\236\271\340\243\215\003m\372 M\004=Oct\2023\316\026\306"
+	.ascii	"\355\255d6\375\006!F;\365\260`\235\213\355\342\325\030Oq\310"
+	.ascii	"(\202\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\351\001\205\007"
+	.string	"R\b\032#\200EI\00730\00330\347\304\231\201\031\230\201\2717\002\370\007\376\201\377\350\177\364?Am\357-w\222\001\234\004P9\244\335G\331&\222\310\031dz\354\330\0323J\213\222\"1\331\277\346\\\304!\031\201\355\205\r\3530@o\2062<\002\"\277\275\nO\370\264\006]z\275j.\222\026z\233\252\227:\311\272\306"
+	.string	"RAC\250\201)\3078\323n\260\202\2411\352\001\022\340t\f\007\347\240"
+	.ascii	"\272\tny\327\267\030\310u\3475\b\2371\r\261\342\344B\301\333"
+	.ascii	"m\352\201)\322\312\2705x\244@\r@\231\214e\272oU\004\002\343\337"
+	.ascii	"^\305\226\036\003\373\032A\201\303\n\300\205'\224o`\252,\317"
+	.ascii	"\210\316\250\330pS\274~\341\306\267\365nk\0261\005\253A\256\230"
+	.ascii	"\326\200V:\275\001\317c\254Zf\216\261\222\021.g\316\271\335\340"
+	.ascii	"\035\344 \334\036"
+	.text
+	.section	.gnu.lto_.inline.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\235\013\355!"
+	.string	"\006\351\177D\360r\224t\312\307\240\343\214\373\342\321%\357\342\317\307\321 xx\202k\334Q\206\243\206\352\022p\273L\316 \036\372\300[90i\306t\317\203\325\236Z2\223\262\206\242\221\252\252Z\2338\354\243\375\326\b\331$\005_"
+	.string	"w"
+	.string	"i"
+	.ascii	"'H\243m\207\363/9\370\214?\007h\222\302\330\020\005c\264\025"
+	.ascii	"Y\213\332\227rs\316i\026l\312\022\270\224E\371\224\257m\323\264"
+	.ascii	"\316\277\271.\016Q\236\263x\302\037\346\232\224\017\306c\374"
+	.ascii	"\224\t\177M\276\367\206'\370j\253\031\302\315\227\340K\272\362"
+	.ascii	"}fo\241\255\352\363\241)\333\026~\313\236\016\001\331.\233\222"
+	.ascii	"\204\b\035\037\262\271O)\003\006\216U|\201\255\366B\311\243\222"
+	.ascii	"\007\007\023\0338-\037'\337\346\375OB\246%\205\210\ra \210\025"
+	.ascii	"\007\024\b\006\240E\317'\210\245\347\020\013\206`\023\216\244"
+	.ascii	"x\354\356\316(zG\227\343\b\216x\335hi\243,1\343F\212\367\266"
+	.ascii	")B\026O\223\020\362#$f\342\307\t \"w\036g#\342\2708R\305Q\276"
+	.ascii	"\343vT\345\332X\235\201\225L\371\325\305A\224\311#-3\335\332"
+	.ascii	"\366\324\314dm\317\354\371f\\\257\257gww.p\341<\227\362\225\345"
+	.ascii	"l_\"W\013\316"
+	.string	"\351\"\345\034\263\325\266\363/\237\370wR\bl\357\317\207J\326\347\017\261>\331o\312\bs\b\2231m\267CB\254'\212\016\240\013\0308.\344\335\244\254\341cG\313\3636\t\002\221\251!\023\2432G\253\"\371\024T\321\226\301\203\304\320\366\300\002dZ\325\347S\331\243\255\202\024\034\321\266\300,\207X\255\025\330\f\036Zl.\rAV\200\\\253\027=VV\001\245\200V\207X\240U\366o\323\374\360\304y\024\244\001aJu2\312\257\332<L\332h\253\222\307\004X\2455~\3068y&\335\353$6rI\202W\202\260s\312\027I\026\"\206\210\271\224\025\032t\001\201\020\250QAchDD\222\244\240\220\326\341\004D!\307\240u>\022\300S!\206\023-B\022\210\004\"\"\"2RF\222\024\2465Pz\032\247\036\374\357\007>\343y\332\r&\362\224\334\033\307x\367\372\316\350/\274Zc\326\211\335bn\272\026"
+	.ascii	"%\332\276\017\222\236\362\3475\\H\233\314\264M>\323B\373DS\256"
+	.ascii	"\371\004x\006\021\017=\236\250\360\n\365\271\002\270a\207l\316"
+	.ascii	"v\022\0132SEr\026\2232*\203\322s\004\342\321\324|\333\226\363"
+	.ascii	"\225\210\006R\305\274\271\2750\226f\317\362\313'\315\266|}\376"
+	.ascii	"\024\311\266\004\354\024.\221jy@)J\302\036\303\313\237\340,\364"
+	.ascii	"\310\255%\036\310\376\213\242\272\26548\321\335\325\001\217\006"
+	.ascii	"\036\265\255d*3\023\tO\002\246\007\324"
+	.string	"R\225\027\253){2\332\235U)\021oq\346\363{\351<f^\320\346}\311#k\343\241\210\234\352\362AfK\211\2165T\034\025A\311\315v\367j\350\013\273\367&\214,p\316\r(3\376\002y\226\265\0303\330\b \033q\034\320\213\371\277\351Ta%N\361\204O\205@W\223o'\222RN\365\376\335\027\276\374\017\336\374\021\323kR\320/e'\342\234\351U\346rQ\212Z\202W\254\300\350\270!\036v \237p\251j \320s$\257\036\020\230\302\231\325Y\f\206a\365\315l\n\364\022\202,\277\267xUTG\346\253\313\323\342\fV'\n\274{wCv\341 \370\271\002\336\243X\037xi6\354\303}Ub\312\350\252\020\026K\216w=\"\003\002#\364A\200g@oM\220hv\f\303|_7\334^q]@\376\312\240#\021s!\366{\210\344\024\207\244\n(H\237\333n%5]FJ\324\254*\036"
+	.string	"\327vHQ<9\377H0\255\371\300N\311Y@Nbp\024B\224[)\326)\37011\360((`R\244\224\346\236\234\214\310e\214\2002\037d\241\355\252+H\255\036\223\246\372\"\003\321\203N\267\013.\3771$\t\215\221p\305R\233"
+	.ascii	"\330\331\237\205\233f\371\373\305H\034K\211\013\360\035\017\026"
+	.ascii	"\363\301)E\020c"
+	.text
+	.section	.gnu.lto_.jmpfuncs.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\345\003\005\r"
+	.string	"&\32140`U\222tPApVBP\005\250\006\225\213\003"
+	.string	""
+	.string	"e\2352 5\b("
+	.string	"\b\200D\035"
+	.string	"\025(\327\377\357\353\377\376\272\331\326\032!\204\020\231d\""
+	.string	"'"
+	.string	"*"
+	.string	"\247X!\355\245\177\234\326;j\032\273L\277\"_\225Z\257\365\356Q\376T\276\272\365\240\022\3722\202\352#\027\211\366\351SD\310-X\031\211\"\246(\372\2522\\e\346<\3658=\347\324\017 \320\346\3519\275\324k\321+"
+	.ascii	":\374J\2704\016\f\nZ/\021\254S\247\322]a_a\235\027}\232\336\372"
+	.ascii	"SHo\365$\035\263\001\322\343\215\013\006\200\205T\026K\204`o"
+	.ascii	"=,\225\016\"\301x\3460\271\237\321@\216y1p\274\026*\324\304\223"
+	.ascii	"{:\005-\005\366XBc=\n\002K\250\f\\\250\361X\310\252\024\304\222"
+	.ascii	"\345p\002\221\2612;\022 tM\2054\252\224XPA\312*)*\333pN-\310"
+	.ascii	"\204\267\212bv\\\026\345\333\021\226=\205)P\211K\211\303\231"
+	.ascii	"\327\313\237P\210H\311\301\230`.\227\375\0061\222\b\247\320\225"
+	.ascii	"\350a\205\350*YN\021\231\016\265\031\322\320\341\fF\227\023n"
+	.ascii	"c\246\241\200X<\272\033f;\300\321!U\332\035.\247.\300\234\333"
+	.ascii	"\034p:\rh\341mZ\016$\372\331\036V\342g\241\274\242\255\371\216"
+	.ascii	"\365\355\206E\362\366\306q\026;\353\025\202\t\230\354J\200\327"
+	.ascii	"7\252 F\035\207\334\342\370\212\2616%6\2717\372$[\031u\2620\022"
+	.ascii	"~\262A\227\337\216Q\017\002\251\223\274\253Z\001\217\"\370\023"
+	.text
+	.section	.gnu.lto_.pureconst.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375 b}\002"
+	.string	"\"\306\022\033\200ma\f6G\321\f@\024EQ*n\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\211\210P\022!2N\361\211'\361\210\007\361\036\356\360\2063\264\205+<\341\b?\270\301+x\004\037h\002\0178\300'\227<r\310\313\343\272\343\215\306hU\251*K"
+	.text
+	.section	.gnu.lto_.ipa_modref.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\243\003=\013"
+	.ascii	"\262\f&&\240'i\f\377\263\377\023\230\257\306f\325c\374\037\326"
+	.ascii	"\377M\227\333f\377\377\377\377\377\267M:\355\377F\366\336R\312"
+	.ascii	"\024/KcM\334\373\254\rqx\240\206q\235\356\211\352\326\272'1,"
+	.ascii	"(\374\222\270)\341\327.\035\3022\016\316 \235\002S\211\004\257"
+	.ascii	"\353j;\260)S\266L\245\255[\t\343q\323\031r\240\204\311C\204\252"
+	.ascii	"\3650\213\277\225|\024\013,\316,`\200WLb\335>U\020\331\225C\231"
+	.ascii	"\253\235333\317\340\357\273\371\266\215\234\2558\344\300;c\337"
+	.ascii	"\335\330@\004d\250\220\222\325$\355\006\220\002\221\"\253\016"
+	.ascii	"\022\240\323,\206b\030\3211\206\254H\264\317f\300a\320\253\302"
+	.ascii	"u}0O\206\277\021Sb\200\01652\357C>Dp\356\371X\330U\207_\221\257"
+	.ascii	"\271]\335\034z\304`\205\265\261\305sbLn)\222p\303C\342\254j\230"
+	.ascii	"\331\362\260]\261d\345\204\336\204`\022\257V\317\265\016\333"
+	.ascii	"\363\211\r\270%jZ\274\314\362CeA\360F\311St>\243\r\033\325\013"
+	.ascii	"\212\267Z\323\264\365\220\357\377\206\370\302\324\304\245s~g"
+	.ascii	"\206}1\304\001\361#\204\220\276\364\354\372C0&\360\216y\334\340"
+	.ascii	"\317]S4\361=M\247:1\355\210W\232\267\377)@w\021\233\270d\276"
+	.ascii	"#\304\"\330d\207\344\311r\307\264\346\200\002"
+	.text
+	.section	.gnu.lto_.lto.45d2f8881dceb048,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_nullFilterApply.8.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\005\t"
+	.string	"F\321?;\020\0059\035`\332Q\245`\004\347.\340L~+\212\001T`\246\330\007\375\2641\246\037\244\313\214\270F\274\275\377v"
+	.string	""
+	.string	"\200N!\264\2226\266]\343\250L\017\317\321%O\233\354\235R."
+	.string	"-"
+	.string	"."
+	.string	"\026[\206\312EJ\315\356\326\202\177\262S\354\235\354t\202\\\274\024\375\237\334"
+	.string	"\205F\265J]\0060\354\256\245j\265q\317\333>\260\375`\233%\362-\273\314\331mqy\355.\310\r\332i\007@\350\322~\311M\304\217\226\271\300.\213\344\265;\202\214\240\235z\324l\373\"\037\021m\227C\236\013\036\024\263\302\357\370p\300\254\264\261\307\224\234\037\366\261\235,\373\255\377\2233\343\211\331\325\bp\263/t%\304\366m\213\366f{0B2\250\211\223\351\243N\360<\222\202'\022q\003\231;.\034\241\">R5\201\245\022\330U\323\007Q\252](Q9\002\203\247QXQ \030\326\315\266\307=\266\223\025\013"
+	.ascii	"4\211\220\326\300\254\305HB\034\225\213\\\303\205\263P\254\t"
+	.ascii	"\271A\023=JJ\347\232d"
+	.text
+	.section	.gnu.lto_nullFilterApply4.9.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\246"
+	.string	"e\n"
+	.string	"\266\022F> \345*\035"
+	.string	"<\342<\004(\364,\306\343h\212\034\267\t\211EM\300\236i!\332\243e\264\261q\020\230$"
+	.string	"\243\261\026\021=@\016VHF1\372CvQJ15\023\205\212\3216\331;\2452"
+	.string	"4"
+	.string	"4"
+	.string	"0\322\256Eht-\227\215Y\200\335\365\022\336\321\274r\347h^i\310\311O\322\177\312=3"
+	.string	",\227\352s\340aw=Y.\217\233\336\266\202m\n\373\236\313\261jM\334P\004H\250\204\346\274\3145\023\354\266\334l\273\3731\304\346\225C\013}\332\217\375\204|i\231\033\354\276b\266\335\362\343\205\315\253\313\215m\337\344\001\334\322\227\251\303G\006]\371\260\222\223tF`v\016\260K\325\244 \366\271\245/\373\262\377\264\233\351\260\354v\024 \260/uE\3046iw6'\206\346\032W\020#8\307\324WA\252c\nu*U3\200 \251\001\024\211@\007\032\177 q4^\224H\336)4\231\302\317;\225,L\336'bx \004\207\250\221\350\215a(z\235m\227\373\025"
+	.ascii	"4\211\220\326\300\223\215q\205p`.8\254\322\220\013\371x\263A"
+	.ascii	"66\002#\301\b\b\007\f\003Y\300\334\241\201X\023\022@c=Jt\347"
+	.ascii	"\232d"
+	.text
+	.section	.gnu.lto_pt1FilterInitRC.10.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\013"
+	.string	"F\326PC\020mL:\340\225h9\326\331~\022\331\234\204\302\f\210\306g"
+	.string	"\353\324\264\372H\220\222Tg\0035\274F\n\b\306\244\256#\200\022!\002\033\305\025a\310F\264\205\302\272p\030;t\016\334\241\311 \233\354\235R:"
+	.string	"?"
+	.string	":"
+	.string	"\327\330U\301d\273e\305!\336\253\313O\272W\357_\367j\322>\341\321\340\302\204\203WmwAJ\341\344'\351\377\365\310\tU\372\264\030\260\273\236'\024\204\233\3366\305\266\001\373\243^F\252\003\305\356\203\233mg\025\204\005\333\267\317\201\264%\366\267z\271l\005\274\327O\302e\316o\360\313k \337r\314\221\335\020%d\273[1\001\357\025\204\373R\227\317g\360/\034\003y\026)\025\"\214\210\331\236\024[\301=8\346\355n"
+	.string	"\277\303h\001\006mw\277z\365I\335\353\204V3\315\233'\"H\354\\a\227\245I'\330\347vwMU\366]\177\367\326\317\235\365\317\007\302)\302\204\250\001\204!G@\230\311X6:k,\343&\204\240\303\001?\242\307#j\300O\007\343\0015#\b\264|XL\260\031\301\220(\216\240\244\334sKUU\305\314D\031\270\2436\350\037Rp\324\026\035\306\021\024"
+	.string	"4\211H\313\224\231x\203\217\026k]\332\024"
+	.ascii	"\220+\206\313H\365\003\332=\2540t\227\001\020\030\310\002\362"
+	.ascii	"5Q\363\340n\241j%\234\340\3055\311"
+	.text
+	.section	.gnu.lto_pt1FilterInit.11.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`>\002\275\021"
+	.string	"\266\237pH\320\262*\035\020|\221\350I\260\352MS2Y\032\222c\230+\037c4rc\260n\207\261\033\017\002\3024\302/\251\022\307z\243\b'Y.["
+	.string	"+`\273E["
+	.string	"Y-N;\036\322F\217\016\351\032\022{\017\3376\331;\245X"
+	.string	"`"
+	.string	"V"
+	.string	"\341_L:\264\213\223c\263\273#\206"
+	.ascii	"z5}#\037\251O\3730\036#\374mv\002\273\266\030\233\335q\304\t"
+	.ascii	"@\257\036_\372\274\202N\372\274:\264\201\034\370\020\240\f\221"
+	.ascii	"\353\331]\220\262x\370\031\372\317=\264\302\342\341\023\300\203"
+	.ascii	"\335\365\\a1q\323\333>\331\256`O\031\001\006z\354\226\350\361"
+	.ascii	"vWo\\\3700'e\247\341\307|\3465\365&\242\301\271\320\340zBSMd"
+	.ascii	"G\220\330\024\2519/#{\r\223\021\376\342f"
+	.string	")\330\327}{Bdk3%\317\356\250\340\225\324\222\372\274N\366\333\214\212\220\320\362\203\347\325\207\221\331\242\327\213l\322\342x\023@\257#!\2519~F\034:\370.\257\376\354\363Z\332\351\021g\317'O\242C\3475\277\200cG\245\2479\275\314G\257\273I\234\245'5y\025\274\335n\355\240\327\343\325v\305\323\351A\344\240\315\236K\245\316\316\322\036i\223\256\260\377\355\356\232\332\354\343\376\372\333\377\375\345\237s\372\241\001<\002\261\022\030\265\260\232\260\230\n\003\253z\301j\305j\26021A\215>V\241^'\260\f(,0\305\325j\271T`\nJI\013T\275T@\024\002\2734\234\274@\230\313\365\002E\243\370\357\324\346:d'R\332\237;I\271\253\033\216\023DgI\253\374F\201\026(\304\034\322\366<\235t\3546L\n\330\331]\006\376M5 \320\002!\251\362\004D\244b\212 r\273\305\200\302\256$"
+	.ascii	"\315P\333\004\2762;\265Kk,\333Q\013\323P'\355\r\305\017\254\242"
+	.ascii	"(\003\361 \232aI\277N\254\201\335\241\263\033ie8\203\311\204"
+	.ascii	"\271\214uRq\335\t\027\226Wd\025\273\302V\036\367u/xYn+\333X\033"
+	.ascii	"\237F}V:\024\212a\316b\034\3361p\202\357\264\022T\360\342\202"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_pt1FilterSetTimeConstant.12.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\345\t"
+	.string	"\026\323E= \345*\035"
+	.string	"\275\002*\0255\023\341\205\206\203\367\b\205\177\024W\210\003F\341B\374\210\211\032v\372\305\006\224\266\330\343=\020@hS,F\017m6xE\263\nL\256\211xn\264wJ\0011"
+	.string	"5"
+	.string	"3"
+	.string	"\324\343\r\274\323\357\004\336\251E;\346\243\310\236\246\221Q\223\331\335:C.^\212\376i\337\274`\255\313\200\206\335\265|\3018\356y\333\036\333\020\266u\001\273\033\273"
+	.string	"\233\243*%\266\317\261;+!9\036E\374\3147ovYfp\273\373\261\303w\212\240\351\244\204.\355\233\374D\274\214\365\201\335X\013nw\3748\341{\256\270\315\267ow\027\374\332\205\205"
+	.string	"\f\311\251\317\362N\013F>\\rgi\353pY\t\300\036[r\202\330\327\354\356z\306\354\317\376y\331/\251\347\365\027]\024\242\325\264B\251tb(\215F\240\216g\022(4\255\"P\247\252\002S)\220TU(Q\252\222\302\211\n:0(a\n\353\n\004\303\312\031\367\232\2351?x\344\\\023\303s:\r"
+	.string	"4\211H\313\224\231\361\224\212\026D^k\002\266k\3503\314\016\304"
+	.ascii	"'\370T+\340$/\256I\006"
+	.text
+	.section	.gnu.lto_pt1FilterGetLastOutput.13.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`O"
+	.string	"\005\t"
+	.string	"\346\220>;@\345&\035"
+	.string	"|\356z\272`\271\363\313W\250\226#\256,\242NY\002\240\342\023A4\2134qZ\204 n\306m#\316\034E\260Vy\244\247\224=\347\260\035o\225 B\366\336)\005-"
+	.string	"-"
+	.string	"-"
+	.string	"2\030\027*5\273K;\347`\277\346\007\260_\362\343\341c\350\377\344\263\205\203\346\204*=\0064\354\256\343\t\265q\313\3336\260\355`\333%\032\255"
+	.string	"\033s\261\210\330\016m\315\336\214(<\332_\335$|%]`7\365\262\262[\021|\220\375r\315l\373$/\tm\326\254 \252\007\023O1+\333\335\005\037\245\202\"S\375\362I\222\023\2622\305\226\265\216\215"
+	.string	"\354Z\212\322\303\376\\\231\262c\264|\375\343,\310\370\f\314nN\350:\020C\347\361l\033\314\334\006~F\020!\020\025}\236\367qT\024z\360(\007J\320\215\300_\304\007\244\243\357\003\251V\367\266\224\035\223\264\260\035\r"
+	.string	"4\211H\313\024\231\241\301\210\247\210\261\263\200G&"
+	.ascii	"\327D|,\310\r&\b8\361\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_pt1FilterApply.14.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`O\001\235\r"
+	.string	"v\232\\C"
+	.string	"\223\223\016\260\252\242\344\313\266\242\257\255U\301\"b\004\215\367\304.\355/\242\261KM\3138A\033?z\221\200\276\340\311\271m\374z\364\273\252\227\224\242#\343\320\362O\007\025!\354\332\t\343&{\023)S\nH"
+	.string	"C"
+	.string	"I"
+	.string	"]\312\003\354\272\270\220\331\355:N\020\377\334E\333>\212\247\330l\225\325\205x\371\r\016\027P=v7;\360\001\360\317\272"
+	.string	"\370\247 \276=7\377+n\315t\230qbQy^\016v\327yb\321p\353m#\260\r\301\376L~\314\217\275\373\001d:f\372\3124\314\364\313\264\225i\315tf\372\033x\242F\210j7\303\352\307\322x0D\330\336l\314\346l\020\311|\214U\006\331\215Q#\263\273\035?\210\177\034\f\"O\3730W\261=\n\225\200\016n\204\245\251O!\212\223a\312\225US-\275xp-\246\223\267Pm\200r\026\251\035\273\302SV\305\335]\340\243&X\210/\177~\n\374\273\032\250\201Y\311\2253U\302\306\246\017\273SI\375`\337\332\335\265\2728%\024\223Q\350Y\001\bT\302"
+	.string	"42\342\341@\177<$\222\022\205PI6\322D\"\355\223\215B\022D\331\207t\222y\nX3!!e%M#eX\267\267\243F\360\260\242&g\312D\324\027\233\0344\247\035\227^\243Z4\\\013\324\247\227\206\340\340H\\\261\031"
+	.ascii	"4\211H\313\024\231\241\301\b\f\033?l\016\301b/\343\215a\344\032"
+	.ascii	"&:\b\004\002\0253\006\270\034\240\016\274\256(\352,E\233\337"
+	.ascii	"\330\334\270&\232,\370bB\002h\354I\2116]\223\f"
+	.text
+	.section	.gnu.lto_pt1FilterApply3.15.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`|\001\245\016"
+	.string	"f[aD\360\224\223\016hF\302\366-\361\361\224\004g\363\263\006?\202\306\032F\\\266\371\264a \306JS\240\376\217t\360\277\325=Y\0035b\373\0231\346\344b\360"
+	.string	"\3733\277n\f\2446\3274\021\355\023\2627\2212\245K"
+	.string	"H"
+	.string	"P"
+	.string	"O\301\335\2039h\227&gg\327;1\203\354\320^f\333?q\024\234\255sy\"j\276c\245\241Edw5\005/\020\017\257\017\210\207\032\342\334\223\363\337\372\025\243\003\r\325L\314\023\213\260\273N\325\f\207[o{\201m\n\366\217\004Jc\337\3467\371\315\377\271\367\223d\032\313t\3144\314\364\225i\315tf\372\001\342\214\034\007\276\335\r\237\221\305\001_\220\260\315\331%6(\310\3157\241\007J\346m\254c\222\335\032?vv\367\304\022\262C\320\r\224\247}Vj"
+	.string	"HWB\365\243\227\302Vg#\225\237?\232\252\032\207t\253\224\313sR\035\364\260\354\227\263\310\256\tzX0>jc\370\n\353d\273\373\300W\301\222\001\200\217\232C\037&\036\022\030\341A&?'\216\013\035\233El/&\025\204\375kw\327\001\025F\211zi1\221\240\033\214F+\020F))!\001\321\242\320I\005\305BZ\321L[\251\264\2114\023\351BI\023\235\\\264\020\002o-*'\r\265m'\255\304\333\333\230Z\370 \243)'\216\fL[\360\250\204D\275bz\361t+\250\227F\305xt&\256&\n\003\037"
+	.string	"4\211H\313\024\231\241\301\b\025\033_m\207\r\2638g\322\252\361c\r\213\300\"\260\250\230k"
+	.string	"\301\025\245g\005\366=\305\005TY\301\260T\357\336\261,v\\\023\215&00\fd\001s\207\006RLH"
+	.ascii	"\215=)\321\246k\222\001"
+	.text
+	.section	.gnu.lto_pt1FilterApply4.16.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`|\002\345\022"
+	.string	"\366bzH\340\322&\035\252\245\"\013\251\353\272w\237X\362\260\031\305\201\001F\027\236\315\336\254c\t:\035;\bw\241o\034m\315\342\266q\235no\3542\023\307\205\304*\265"
+	.string	"\021\212\226?P\261\334\34794M\213\241\021B\366\226R\246c"
+	.string	"]"
+	.string	"i"
+	.string	"\251\233\023\335_y\024\305LC\030Mu\343\270"
+	.string	"\352\016M\216\300\323\371\320\373\1775\241'f\277(\303\017;J#\004\206\237\035\335\375\221\350"
+	.ascii	"N\247T\021N'{\320\231J\336\331\265C\221B\034\222j\266\030\225"
+	.ascii	"\033\224\001\330f$Iw\353\n]\032\033m\267C\351\356o\315\246A?"
+	.ascii	"\365\177\312\177\b\377\n\005\275J\177\030\263\234\363\253l\306"
+	.ascii	"\371\265G5\2457U\224\372\250\2364T\r\331\275i\367\336\356\273"
+	.ascii	"\335s\273\237\273\227\273\347\335\357\356U\204\373!\243@Rw\206"
+	.ascii	"q\251\213f\220\210\377\263\037\344O\245\270]\224\001\232\206"
+	.ascii	"V\363\240\204\317\230\002\342dW{.\336\324\035\303\006Pw\233\334"
+	.ascii	"\201\24736\264\035\205$+8\342\371]4\210\371\300\221\022\212\377"
+	.ascii	"\027\005:\215\350\324\360\220\234\303/P5\326\250\206t\342\213"
+	.ascii	"\332a\251\250\250\337`\034\227f\272eJ\226\231\b\034\242\355\370"
+	.ascii	"\220[\216\355\356\030\346\234\213\377\267Dy\245\342hf{\374\267"
+	.ascii	"\240-.z\335\275\340\312\302u\301\333\321y\205\341t*\217\350\360"
+	.ascii	"\310\354\370\275\341\230\021\021Z+{aMpM\331K\013\313k>A\253\345"
+	.ascii	"b\320Z\255T\002\270\263T1\025Y\205\227\353c\201\255\254\300X"
+	.ascii	"\037\313\213\302\312\307\212\271|*\003\207\265\250\304>\031\f"
+	.ascii	"\026\373@\302V\3061\261\204\033\031\246}o>L\f\343DTC\362\230"
+	.ascii	"\331\304\222\b\264\351\230c\217;#\220\004s\212;&p\003\0341\031"
+	.ascii	"\305\034\317\037p\b\305\222's:\3001 \260\002\031)\263\003\264"
+	.ascii	"D\244t\212,4\202\214\033K\314\311\\k`\t\374\316]c%\320@\007*"
+	.ascii	"\201\304\342\363\270X\231\336\342\354\273F3\307\272\013{\316"
+	.ascii	"z\3428\bYdP\370ZY,\336\340f\276ih\001\255QC\271p\277\234h9\023"
+	.ascii	"\371\221\222\035\005ml$#\206k\330Y:w\030H1&\270\261I\027\033"
+	.ascii	"i\310\"\345\266\213\352\001"
+	.text
+	.section	.gnu.lto_pt1FilterReset.17.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\005\n"
+	.string	"6\323F> \345*\035\340,\004\202\205\250\020\324\330\316\\\343 }\f\250\001H%\007\004\317S_\b\005Y\354\364\213M"
+	.string	"Fc\r\307\205"
+	.string	"x\265\b\210&\332l0\007\214N\276\364\346\344s\243\275S\n1"
+	.string	"5"
+	.string	"4"
+	.string	"\324\343?\336\351w\003\357\324\242\r\340#\311\276\306\262a\023\260\273u\216\\\274\024\375\327\316\201\305\\\227\233\207\335\265\204\305:\356y\333\n\266%l\027\b\273\034;\002\233\243.&\266\337\261=+\222\343S\304\323|3g\027F\207\333]\220!\276\323\004\rA"
+	.string	"\321\245\375\223\243\210\237\265\356\331\225\265\340vG\220\027\276\007\276\270\212o\337\3566\370\266\f\214\001]\311\251\337\362N?3!/\271\263\\\361\220Y9\300\036]r\212\330\327\354\356z\312\354\323\376\371\331/\351\346#\006\341%,\213\225\nE\315P*\235\034J\243Q\250\3003)\024\232X\024\250SU\201\251\024H\252*\324D\252\222\302\212\032:0\2702\205\225\005\202a\355\214{\315N\231#@r\257\251\3419\035\r"
+	.string	"4\211H\313\224\231\361\224\212\026D^k\002\266k\3503\314\016\304"
+	.ascii	"'\370T+\340$/\256I\006"
+	.text
+	.section	.gnu.lto_rateLimitFilterInit.18.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"\305\b"
+	.string	"6\321>9@\345\2501"
+	.string	"\274\3243\236\033\263\347"
+	.string	"\241\237\241\005\315\211%\024k\016\240P\233\302\222\013\002\216\214c\335\246\311&.\303Cg\020\033A4uC.\216ak\255\355\275\245L)+"
+	.string	"/"
+	.string	","
+	.string	"\033\033t\346\n\2663\016?n\225\230\306\n\355\377\224\036\006\035\301\332'\016`\265T\216\232\207\377\215\254\026\207+\335\326\323\026\242mK\256\326/;n\232\221\030\004\330\277Q\013p\031\347\022\322\326\234v"
+	.string	"\206\301\261u\211M@\277R&\370]/,\177\250\320\204\215\271\206\356t\346\002\261\266\321\323Z8\245\261\315\377\206\032\345\002C`\366\337 \346\352Tg\2563\243\255b\255\021&\"\363\b\240\rUQv\264\336\376\2772]\020\211H\016\"\020\350S\3205\364\371F\250\211\022i\236<\223\311\013\315SI\3024C_\305\374\034\324\243\030}\023\345y\337\344\204\367v\351j\004\211l%3\332\t"
+	.ascii	"4\211H\313\024\231\361\236\212\026\340B\214\313(\337j4\270\313"
+	.ascii	"\213v\222\001"
+	.text
+	.section	.gnu.lto_rateLimitFilterApply4.19.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`u\002\245\023"
+	.string	"\326\344\202J\300\224Q:X\234\375\030\271\327\035\030$\344<\034\001\367%D\340\334x\205(q\216P\260\375bU\n5'\372\377\372\377\310\350\366\016\364\205\017RPB\205Y\026L"
+	.string	"X_\365q\220\341#+\226(\324pc%\203\020\"eJ\001k"
+	.string	"k"
+	.string	"g"
+	.string	"j\037\350A\271\2274\0170g\216\023\322\234e\212\025\220\027]\222\266}\027\177\221\263\203ay\242\347?rt\220Qd\316\371r\035e\274\030^\300xqM<w1\\\315\371\007>T\302!\342\373\351.\336<4\371\335|\303\004-\240\230"
+	.string	"\374j\302\002D\034v\016\274\332\374x\252%\017\346\234V\337/\304=\336\366\212m\f\266\356\004D\277\352B\177\352\345O~\350\037U\035\252zU\255\252~\253\244\251\307\201 s~\210:2y\2105R\274\350\267\337*a\376\f\337\310\252\026\f\230]\264\201\324\201\030`Sb\207\2209\347\202\213\266@^\274\235\263Uv\213\005\321\317\n\317\220\203ak\332\360DD \001S\275\220\203N\315\211#\t\322\2343\305\020\310\213\255\033\330\003\353\352\255n\367=\037\336~u\367\250\207c\317\234\206\203\344\234\263\201\177T\323@\366\\\364i\306\213\3373=\001\3554\312+`\322j_t\327N\215X\265\343\256V\201\364V\3604\3127\372="
+	.ascii	"\203\256\344\263\203\264\253\343\240mE0nK\214\246\032\205\262"
+	.ascii	"\002\177|L5b\227:]\035\373\341\334\034[\325\254\027\335\253\007"
+	.ascii	"2\230\030\032\013\205\233l\202\204\223\n1\305\315h3\230\0132"
+	.ascii	"\034\313\315\0047\023S\233\211f\020\213\2758\210\265\264\250"
+	.ascii	"\234\214vQ\271\311p0\263\227W\315F\243\331\\^\265\031\013\355"
+	.ascii	"\345r\223y\251\030\260-Fv{\341l\266\333KU\316\207ssX\353\332"
+	.ascii	"-o\211\265((\200\024\250CL\331 \3604b\007\274\241<\301%\025a"
+	.ascii	"\270I,'E\342\033B\252\356nj\355\f2z_\030- \240\002\031\272\333"
+	.ascii	"\001\240\020\307\202\023\221\233\366\024\221x F\3431\240^\342"
+	.ascii	"\t\351^\354\214$\2570\\\"\340\251\035\226MA^\327\262\204e\216"
+	.ascii	"\253\223\354\302\030\330Ec\017f\033\bk\211\241Ef\260\342\374"
+	.ascii	"\305\366DLP!\302M\036sg\346H\3412\207\271\203@\2129\341\215I"
+	.ascii	"Z6\350\245\357r5\256\272\007"
+	.text
+	.section	.gnu.lto_filterGetNotchQ.20.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"-\013"
+	.string	"\326\224MD\020\2158\035\\\323/\231"
+	.string	"\321w\256=7\223H\323\201\333\f\262m\336\306i\021\214\316\240#\215\370>j\002H9\301r\241\225\236h"
+	.string	"0\202\246\214TT"
+	.string	"A\275S\305\364\272\357\020\261\006\377\267\336D\356\224\0028"
+	.string	":"
+	.string	"9"
+	.string	"\266\317\340\rD{u\215\007\020\274C\210\226\b\254\335\325:\257\300>\257S`\237j\340\342\245\350_\365IA\200\206\023\212t\231\201\354\256\345\t\025\340\326\333\326\260Mb?#O\375\363\322\327\245\365\322\362\322\307d,\016\030\026v\001\264H\354\2069!\201}\b\242\235\2615\"T\243\207\221\313\247\346\303\307\345\037<\345\2251\273\027\034H\330]\016o\\>\035\231vX\264\344K\257\231b\025L\030T\245^\312\311`R\200\251\352\305\324\251R-J`:\365\252 L\013J\262\345\314\200\225#\354\221$\265\200\375k\225\200}\351\354\343\217\005]\367\205\243m\343\016\020\250\363"
+	.string	"}>\236\211\025\021\225\315\343F(\034\030\002r\241\307m\033o\036\220\013MB\235\346}\"\321\267i^\250D\244m`\212\346\341\370;\341@-\374>P\313\214{;\022"
+	.string	"\2212k\177\022\224\031\020\206\215CX\020\372\317\241A\346c\216\346\032.K\013H\205H\020\016d\006\262 j\370"
+	.ascii	"\324\034\3235\311"
+	.text
+	.section	.gnu.lto_biquadFilterInitNotch.21.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\250\002\345\024"
+	.string	"\226\346\207I\300\322Q:/\202#5V\241JbD\277\332t;!PY\263\022\036\224\003\365;"
+	.string	"BtO\275O\210t\233\316J|\246\240_\302\247L\021\376g\252\353\340\356\242\242\250yCbh@\026(3\241\245\225\315H#\204\310\235Rp"
+	.string	"r"
+	.string	"m"
+	.string	"\344\305V\357\025\n}(w\"\233Y\262\027v+\"\220\027Kf\212\327\354\335E\356@\025\254\332\375"
+	.ascii	"\265\200\274\250\022\266H\274>\355\263x\213\334\177,\334d\327"
+	.ascii	"\207F\322no\305\006\310\213\356=\300x\221<\200\361\242s\366\216"
+	.ascii	"\367F\354\203\242r\206\204\354\256KE<\367\231\363\177t\225N\017"
+	.ascii	"\316gJ\301\356z\352\364d\270\365\266\013\330\346\261\247\216"
+	.ascii	"??9N\247N\364\2137\372\303pZ\307\3519N\277\265\332p\203@pw'X"
+	.ascii	"d\233D`\t\037\351Lvi\334_\370I_R\037B*v\267\004*\021\001*y\b"
+	.ascii	"\312\371\277p\215~\"(\252\305\3435\316\377p\207\341\337yPv@\f"
+	.ascii	"Y\271\350\331\221pvy\361?r\331\222\361\262}\376\2218<(\274\034"
+	.ascii	"\030z\354\356\201\213\236\340\326\221\221\215\227,\275\017\370"
+	.ascii	"\037\375;\276\236&\022M)K\307\030\274\031#Z*\211\246\324\340"
+	.ascii	"\231\330\315\240\216\350\200\251\245\n\200\322\224*\020\036\212"
+	.ascii	"\335\f\372L_\025\005qZzY\364\003\307\316'_\017\234\372\337Ut"
+	.ascii	"\363\311\242N}\250\327C\361z\350f\320\323\327\343\264\363\311"
+	.ascii	"\356\355\246\206\260\037\356\356Z}\354q\2325N\223\214\323#\343"
+	.ascii	"ty\240_\365&7-60Z\f\027\203\231<\370M\213LV\273\341`$M\314\306"
+	.ascii	"`U\003A\306\205\202-v\2435\220@\213\221\231\231\271\324\234\030"
+	.ascii	"\001\f\214,\001\314\313\013\313\311h\030\213-v\223\211\221\271"
+	.ascii	"h\265\331\254\006s\321b\\f.\230\255\306\305\222\342\332L\314"
+	.ascii	"\346\272\325j6W\331\323=\\\365\261\003\016M:\335y5\377\331\310"
+	.ascii	"R\225\252\222j\327h\346u\034n\007\305\261\250\252\317\211\322"
+	.ascii	"\37148\0058 \260\002!:\233\003\245\001\200\303\231\b\312!\230"
+	.ascii	"jd\022\021)M\021\021\257]\212F\f\215}8\301\206\344\022\017\310"
+	.ascii	"Y0\331IkH\304\376\220%\255\n\034\020g\241\251)\035\256\337CP"
+	.ascii	"\336\304D\3020\344\354\016\203\211\356&pp1\274\353\215\025\f"
+	.ascii	"\306\"\315\265\275\253\261\357\251n\235r|\310\274\234Q\204\361"
+	.ascii	"m\032n\370\214z\331q\027\276;\372c|\243i\260\344\305\005\311"
+	.text
+	.section	.gnu.lto_biquadFilterInitLPF.22.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\355\013"
+	.string	"\306\026S?"
+	.string	"Q5\035\217\254\324\n\220\017#f\303w\001\330\232\200\264\212\316\342/\354\362\300'D\007\304\244\202\217\221D$R\fR\207\320\377q\271\320\212\377\321?\215"
+	.string	"\262\021\354\361\024\373\364'{\357\235R="
+	.string	"E"
+	.string	":"
+	.string	"\002vM3b\354\216\t\214"
+	.string	"{\365x\002\327+\366\001\327\253C\333\306\307\323~\325a\264\302\261\273\3314\361\3602\364\357\342"
+	.string	"H%\321%\244\301\356Z\222J\037\356y\333\026\333\232}\006\001\227S\372\220\b\n\032\007n\354z\370\310\261\255*\343\204\355K\354\t\b\fm\361Ux\326\005J\331\r$N\022\260W\003t\302\0013\307\263\b\257\302\340\272;\302\303\001\366J\221\001t`.\355\243\276\"|*\303\003\230\364A\227a\\\205\210j\255\351\256h\251\363\223N\033\254 O2\335\020Sd9??\332!\312\017\313\027\"j\254\364\260G\221\234%\354\323\335]O\223}\326_\237\372\351U\017\340\004\217f\341\333B\035\004\n]\307\363\3414\260\002\332\276\007\021+\330l8\0136\231\314\245rYs\371\266\220\247\303\311:\217\343<M\326u4.\323|`v)`\357\263}Y\310\363\276L2\356\351N\223#\244h\211S\203\003\023"
+	.ascii	"6\207\323$,-\243e\342\r\321h\360\020P\204\273\3175v\304\314\006"
+	.ascii	"\302\007\243\340\030\350\f\254\357\024*h\214O\211\006wy\321N"
+	.ascii	"2"
+	.text
+	.section	.gnu.lto_biquadFilterInit.23.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\306\n\375/"
+	.string	"\272P|\021F`\034R:7\341(\260hzD\362\261\265]*'\225\3678X\270DR\200J\374@*n\233\251\373\256>\255Z\034\021R<\203>\254\263\006\36776\340\363\355\333\306\300\303(\361\016PHn\355\027\233\335d\357$\003\n\001\352"
+	.string	"\005\001K\314\272\224\274\225\375(%\032\266F#\013\264\237\303\237\234\315\224\255\311"
+	.ascii	"\343\326O\273&x0\332\330\232-\344\236V\303dP\366\342r\232]\255"
+	.ascii	"\307@j\210\335jV\353Q\007\001\25711x9g\006"
+	.string	"\307M\265\036\037\330-\234C\3545\261\362\240\330\0201\230~\252A\331k+;h\247\365X(%\252^\236\246\365//\324\240\234Dbd\303z<T\311\020/\332\267h\235\213\214\30693\361\\X\217\203\2540\f\361\266\373W\216E\353Yf<@\316b\317\265\234\321\034\364\202\365\270\321>\240w\274^@\357\270\265\272\337\034\215,?mHW\032\236\234s\323Mr\255\257\276\036V\257\325\352\037=y.\277\216_}\316#8\262#\310{\r\272\340\327]\255R&]~\375\270\312\365\373J\366\006,\201\226)\357U\027\340\261\331\001\372\352R\007\344p\262\274\363\326\353k\313Z\237\205\234s\333\345\327\216\367\317\273\273Gw\033\351\376\325\b\t\2229#\221\216\217\346$\230H\273\247\203\356\275\030\252\304{\335o\243\251\345dz\360\236\367\216\331\373\353\324E.i\365t\3205\342\302\374\213\236\275=;e\225-;m"
+	.ascii	"\367\327\332u\365A\332i\333\246\225\272l\367t\243\035\355\035"
+	.ascii	"\353\376\235N\247y}\305\272\257\366f\372\363\275t\266\267R\022"
+	.ascii	"\022\266}\204`\370\346\177\340oo\243\203\371\r<\356]\364\271"
+	.ascii	"7\321\245\357\241g\371\205\376\345\017:\227\037\300\241o\341"
+	.ascii	"\243\357 \266\r\304\266\177\330\366\017\266\275b\333>l\273\207"
+	.ascii	"mcl[\305\266\357j\333\256\266O\004\312A\243@\232s\216)\237L\207"
+	.ascii	"\333\236\\\355\177\376l?\364\217\376o\177\334?\367K\377\323}"
+	.ascii	"a\037b_L\177\314\327\336v2/s3\207\273\334\317\234\356u\r\024"
+	.ascii	"N\321\204\361XJ\311n\370\230S\262\f\213\013L\367j\037\"\231\314"
+	.ascii	"\204,\335?\227\256\275\013:\201(\335\263}\2104\272J`[N\037u9"
+	.ascii	"*\264m\001\331\346\267ym=\347\227\333\024\351\036*Vt\221\362"
+	.ascii	"\036\335\203\367`3\017n\240\346\035\267:\276{\35090\201\232s"
+	.ascii	"\222\356\243I\327\246)\317\212\256M\372\314\200\232q\356\376"
+	.ascii	";Cw\264y\024\310\364\340\251\217\323\227\363+f\231\371\246\017"
+	.ascii	"\247\337\2549\037\017\326\307\352\035\267]f\256'f9w\337M\037"
+	.ascii	"l%\313:2ZVp|\340\016\223\266O\377\344\202\3158\243\3737\003\267"
+	.ascii	"w\215\256\275S\302\345\254\022\335\336U\323\224g[\321\242\373"
+	.ascii	"\270\024EP\242\3739\240\035\272\335,\244\354\227D\267\0053y\217"
+	.ascii	"\035l\272\r\335K?<\272\367\016\335\327]\350NI\004\016\263\302"
+	.ascii	"t\n\207\357\321m\253<\353\347\303t\331\241\353\251\027_\237\235"
+	.ascii	"\362L\275\276<%^\260\311\36640ng\265\346\234K\364\363tv\344\356"
+	.ascii	"\306\254b\007\343\257\230\302(E\205\247\260,\326\223-\252\250"
+	.ascii	"\212*b\bN\226\350d#8Y\bEK,\332\bEk\254\212\361\201\303\261@D"
+	.ascii	"\025]\\\031\263\2462\244\230Z\021U%U\304\022\2622^a\3705\004"
+	.ascii	"((\024\023\240\234\234\036\b\365\372\351\301\2251+j\005\212\246"
+	.ascii	")*))\252\247\246\251\025E\251\246\247+\254\246\007\005\232\252"
+	.ascii	"\312x\325\224EEu\325\004D\313W\363\025\3230\207\016y\267\332"
+	.ascii	"\026y\267\007\013\006\302\022\211c\201\274;\204\025\"L\023a\177"
+	.ascii	"\024\221\031\255\261N\251\232s\316+\217\250\016\350\r7\244\356"
+	.ascii	"\242]\262u?\331.\002dx\220N\033\345\312\341\304w\307:\204\032"
+	.ascii	"\214t\243?T\037\202+\274^!\312\340\327\371\353\376\303\214\342"
+	.ascii	"P\223n\253wx\203\327\253\033x\273IX.\246\013\244\362\273\335"
+	.ascii	"&\354\326\322\375M9a\217Q~nw\361S\341\375\201\262\336\356\247"
+	.ascii	"\347\365SB\237\317\b#\2005Lf\364\216\255\335R\216\322\r\336\365"
+	.ascii	"^5%\\X\200\330\250qL\306\0242C\"\"\"IA\2224\006\260\002\221\241"
+	.ascii	"\262\315\001\022`\2649\315I\003\225H \321\214\202\202\024\024"
+	.ascii	"\263\0319\256\277\001\364\215\214D\237\245\355\037\262\373\366"
+	.ascii	"\264G\366\344V,\230\245\265\330\0308\006\223M\367)\021]\300("
+	.ascii	"\255\343\3638\3501\320\250|\032c(\277\365\315\f\023M\263\001"
+	.ascii	"\232\356\267:\201\323\n\345%\243\322\267\201-Iv\356\310l\357"
+	.ascii	"\024\336\360\215\033\353V\252i\275\245\3643<$\336T\0138\352$"
+	.ascii	"<Pl\360 \371\346\346\322\206\230\360`\337v\355\344\362\020\235"
+	.ascii	"\345g\270\302f\261A\250K\261Ru\336\312:\322\\P\324lh\016\273"
+	.ascii	"\035'\361v&\005\"\017\350G4\275\273B\204l\016@\023Px\316\006"
+	.ascii	"4!_\313\033\321\321\004]k\213I0\333\016AG5K\314\253\372\007f"
+	.ascii	"\253\350\031P\304\214)OH\365s\b\214\232\337aSp\333Y\017\204\361"
+	.ascii	"\300B\213\002\001Cx\244\342\035G!\205\026\312\234se\037\343\351"
+	.ascii	"\230 ~C_T\262\270\016!0\363\310\251$\2731\243\357\200\357D\001"
+	.ascii	"Sh\315\363\027\207\361=\370\224\\sq=\004\227D\335\275\306\352"
+	.ascii	"`H\304\226v`\223_\205\325y\270C\034w\023\212\224K\365n\314S\211"
+	.ascii	"\342\250 \210\240\2406-\253\333|\325\2564M\262\217/\334\221\243"
+	.ascii	"\275@A\2322\241 \341\204[\033\340\373\241u<&\306\257\335\203"
+	.ascii	"\025w\2706\360A~a\222~P\226\035\233\257W\177\007\361\316\250"
+	.ascii	")\323\332r\nE\250\001"
+	.text
+	.section	.gnu.lto_biquadFilterApplyDF1.24.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`E\003m\024"
+	.string	"\326e\203J\300\224Q:\244\326\006\312\177\356\021L\231\346\003\030\251\2649\3702\f\316\216\003\016\372\355\3335\216\342\004\262Z\273\315l\006\266~\263$\247\223\007!"
+	.string	"e\301\020\312r\325\023\215^\330M\231\205\203\266y\310X\033%\237\020\"eJ\001k"
+	.string	"b"
+	.string	"r"
+	.string	"s*xh\b#\331\303\242\372\037\373l\232\263\350'4\347T\361\203\361!\251\303r\265\257{\213\331w7W\315\271\203Ch\316\235\212\023\214\017\275\033m\373+\316bf\373\300]\t\0371\303OC\217\310\234\263L9K|\b\376D|\270=\237]g\376{\007S\250"
+	.string	"\272\345\340\\K\016\346\234\326[N\207{o\373\200\355\b\366\272\bI\326\030FtL\375\331;\034]\036\373\340\334\035\373\274\233\365\237\177\365\335\177\242j\225\252MT]\242\352\224\252IU\243T}R5\211\252M\252\036U]R\265\250\352P\325\240\252W\325\252\352\243\244r9J\036snH*2\217\302!\023\347\375\366\314\357\371D\346Xl\036\206\021\207C\200\033\317\021 3$\233Z\0023l'P{Zr\013\bq\235\b\265\037R\341C\247\375\017\323\212K\262\002\214\214[Z\323\242\354\260\345j\257\013\215{#\234\216\006{Pi\357\013WW\334\020\3116\002\334\335pK4l\271\232\205\313"
+	.string	"\367=\234\216Vs\030\273->V\373\325\005\221l\271\232&\331\266\371\013\373\3069g\213\017$\341\302\350\363\320\277\021\037~\r\340t4\r2\031\233\232VL\224\331\320\314\270B/\200\201\211a"
+	.ascii	"\343\342\262\002@\364\313J\254%\223q\305\2243\260\327\013\366"
+	.ascii	"R\316\270&\274\312\227XM\2712\3000\232V\254\224\301`\261\362"
+	.ascii	"\264\233\007\347\356\260\266\001\t\332\326\254A(\216@\210@\255"
+	.ascii	"Q\210\325\336X\341t>\200k\203\354\241\275[\220 \017\254=\357"
+	.ascii	")4\375Y\265\251e\255\232l\311\252\026A\257\365\"\223U\"\n\257"
+	.ascii	"Q\262\332#79 \320\"\221\253y\264\210H\351\024Y\361\370\244h\220"
+	.ascii	"3L\f\271nh\211\266\236\310\236wS}\025\315\005\315u=$\315b\316"
+	.ascii	"\357\034\361zxQ\2131\303\233\305\231k\270\364b\315<1\242\304"
+	.ascii	";\246\004\"\226C\214\224|G\224\030\363\362x\257a\244\306\302"
+	.ascii	"\020RbD$\363l\207I\315\2041\245\004\031\362rj\301\231\303-L\307"
+	.ascii	"Q\022\346\023\262\221\302+\306\3345\361T\245\230\256E\006"
+	.text
+	.section	.gnu.lto_biquadFilterApply.25.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\235\002\315\021"
+	.string	"\246!tG\340\320(\035\360\303\371\246\321*F\244\355(\324f\352\372\317 E\013\320\225r\326\005!\f\356\217\354\376\207L[\220\320\356\231\221\337\023?c\210APKqh\346\252\307J`hL(WTn\377\333\2364\262\211\224)\005\\"
+	.string	"X"
+	.string	"`"
+	.string	"\036\355\002\t\365\354\256\210\023t\217\246\031#O\3739\327y=\204y\307n\315\212\236\335P\304\004\272G\207\235m\377\303A\274\354\332\026f\2709\f\013\022h7v\367\0139"
+	.string	"\356q\273\307=\252\315_\317\227\177\332\267\016\036j\262\031\330S\204`w\235\262\231\n\267\336\366"
+	.string	"\333\013l\005\t\263\333\373\316\357\361\360\357\310t*\323\250L\2372m\312t)\323\244L\2172\335eZ\224i.\3231\323[\2465\323\231\351\177\240~\\\224\b\355N\030\312\261-\242\317\206\317~\373\345\323\\:\301F\354Y\204\016F\341CfCCcw\013<ZAg\2621\222\371\035\327\002\332q\360\224S\221r)b8\340y8Um\032U\203b8\017^b\323"
+	.ascii	":\236~\366\220\230\304a\325TO\323D\214\306\345$TIdx\3505u\013"
+	.ascii	"\212\341\310\344\220\355\227\217p\255\333]\022_\004\003\b\335"
+	.ascii	"\315\243\017\303=^\005h\310\211\311!'O\210\027\2338\354\020\226"
+	.ascii	"\212\301\376\266Zc?\256\225\027\227\224\026\347ziaYE\033@AQ9"
+	.ascii	"\200bb\242\362\340|\242j\245\270VV*\037\013\310b\201'\037\313"
+	.ascii	"\252\001\353;i\271|*\020\203-)\255\317\005\202\255\257\024\356"
+	.ascii	"mOK.\304\250\214\223\007EJ\201Pj\322\324IQ\253\2538\225\324\344"
+	.ascii	"\340?\245\023$\3659\305H\232\254\306H;%\251\210E\214\206\365"
+	.ascii	"\236\221\236&\322\030. \360\"\221*\333\224\211H\305\024)40\302"
+	.ascii	"\202\304\357p\330\274\305\235k\007\215\031\214I/8\306\203\036"
+	.ascii	"!sV\032\231\002A!\216\345$X\224a\310)\201:c3\266\033\306\351"
+	.ascii	"\250=>l\024\351\374]{\301>\214YJ\220K^F;8\313p\211\2428J\204"
+	.ascii	"\371\200l\224\360\212\231\373M<U)\246+\223\001"
+	.text
+	.section	.gnu.lto_biquadFilterReset.26.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`z\001\365\r"
+	.string	"\206Z]D"
+	.string	"\2216\035\260\310U\3411*g\323\364\205\001\365\203\201ROXs\372\340{\013Ty\302\b\337\306\b\242\027n\021\004\325\b\302\212f\017\377\377\277\347\002\272\360\265z\027\223\3756\336\331\241\370\366\335h\023)S\nH"
+	.string	"D"
+	.string	"I"
+	.ascii	"\036\313\001\354\276\274H\355z\"V\200=\332\303l\3731/\301\331"
+	.ascii	"`\345\2018\335\306I\303\267cw3\003\037`=V\027`=\352\207"
+	.string	"sO\316\377\211W$bR\230\\Z\236W\204\335u\232\\8\334z\333\blO\260\037\006\253/\366e~\316\275\177\223\351+\323V\246c\246\253Lk\2463\323\007\t\251\231\001\201fwC\330ce\304\026\"lsv\307\376H\215d^\306\2407\273.hR\273+b\t\330\343\3077\362\264\217\272\t\356\001]\312WTZ \206\252\275r\025 7\3623\325p4U\365\245\021W\203wf\330\355\016\244\352W\202!eh\373\302Q\030\304v\267\201\377\2110`\247G\237\305z\274.\300\201\3522t\316\300\240\261\311\303\366ZR=\330\257\002\241\025\021\211\205h\006 \220\211\003PI\211'\200\345\217g\013\251\210NL2\024m4\322>\031\312\t\311(\373l)\231\207\2005\n\241-S\321\264-\353x{\233\243\017:tJr\316\344\270\324\326\016Zzi\254\021\265RKUG\t\206T\341,\242&\b\201\n\034"
+	.ascii	"4\211H\313\024\231\241\301\b;+>\\\346a\2558\314xp\215\242h\001"
+	.ascii	"a\370\201\016\274K0\301H\301q\024I\260`g(S\274\205e!/\275\t\316"
+	.ascii	"5\274\271\026\320d\301\027\023\022@cOJ\264\351\232d"
+	.text
+	.section	.gnu.lto_biquadFilterUpdate.27.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`X\003]\024"
+	.string	"\346\343\177I\300RN:\312'\333\350\200\016\205\033\b\254\326\206\377\326\337\342}\363\306\334\1779\263}7\311z\205fl0\261m\026\301\005\306m\375\023gD\376\337\306A63\333\\\260\211\204\f+x:S\304;\022\243\332\244\221M\366N)d"
+	.string	"m"
+	.string	"d"
+	.string	"?\">\264\200\257\241\3248o\237A\273\222K\273v\241\260v\273\233\342\007\340+\212\027>\215\237\366a<\006\3556\236\007\330E\212\332\355\336R\234"
+	.string	"|\365\355\004\276W\360\002\276W\323\354\253\337\222\366U/\202h`\355\256HK\234\366I\363\357t\227\020Q\355\263\345`w=\205\210\212nz\333\bl\347\330\324En]w\177\337\335\365\266\337\373\246g\235\376I\t\013\252\006U\273\033\262\206\354T\305\201\342\271\277\351\327\375\273{\366o\3437^\336\311\341K\303\316\206S\244\223as\324\344\022\345\307d\207\202p)j\300\327\027\211\321\316\271\004k\034\n"
+	.string	"U\325"
+	.string	"\262\273\n^=\343\220\310\350\3412\\U\b\302\344\3223\331!\037\034\005\253\221.\315<\223\r5\237N\372\240\".zz )\017 }\216\346Q`\207\026}S\315\241Z%\321G\257\203]\307\227U\351wg\t\321\343\330s\270\004w\227\201\377\204\001\307@\322\211W\237\347{\255\224\304\312\3263\263<uDz\354\024b\337j\223\216\260\357\355\356\232\"\331\307\375\2573\375\341\227\376\221+\375\256\347n\360M\017\343\316\\\331\231\343l\256\314&y3\233\020\341\244\216\213\204\231\034R&C\312B\034R\006a\304\013bbdXb^^TN>\303\250\310H\235\01342\242M\f\006\213\301\21064.0\021F\226#\252\034p\354\206\224\211:\261\230L\fo{o)RK\213\251\036\352c\220\372XA\245\202G\tb\007\311\217\001&\214J\216"
+	.string	"\314\027\r\351\b\235\324\2436ia^\310\336\032\321E\250ad\306\320\004B\024\2142K\332\026\003"
+	.string	"\003\221\261q\003\021\020\265d\314\246\224\217u\370(\355\226NZ\n\376\361\022w\357#\347\337\0168\302\324\270\271\036\244\363\333\310'/\020\322\371zv "
+	.ascii	"\321m\017h!\236\276\322\245)\235\361\234iJ\r\0036&\005\204\316"
+	.ascii	"\234\323\246\277h\224\321+\220\346\227\006VY\361$[]\364N\327"
+	.ascii	"a\230\352~~\335\305s7]\264\264`\350\256\030\274\3432\263\020"
+	.ascii	"\276\201\202\314/f\237\006"
+	.text
+	.section	.gnu.lto_nullFilter3Apply.28.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"=\b"
+	.string	"b\31788@o\323\001@\265\301\016\030!&\005O\0220\307\030=\221\023H.\241\273\365\026{\351\265~\244\375\333%\353&`x\0207H\017\264\261j\327c\0375ID\210\266\335;\245#N\"\324\231\260\254\260m\237\205\315\343\311\006,k\331\307\221B\240\017\025y]\347iT\004\352tT\373F43\260\027\301}\224\344y\037\305\352^\26324D\312\212BVxs\022U&,\033c\354Z\2122\303\276fw\3272\264\343\006e\205A\265{1#\263\253Y\302a\373\230\215\2418\261zD\305\341\372\304:8\217\366QO\201\367\260\313\005v\303\024\311nM0\302\365\351\372\002\353\363:\201\365i\320~y\335\330\213\264X\200\300\354.\225\032\007\037A\377\037\0170\235J\217"
+	.string	"\r\273\353h:a\334\362\266\017l?\330\016\t\r"
+	.ascii	"4\211H\313\024\231x\312\027\r\027}\345z\272\306\343\3020\240"
+	.ascii	"\006\334\033C\r\004wn\321\316'"
+	.text
+	.section	.gnu.lto_pt1Filter3Init.29.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\217\002\265\024"
+	.string	"\366\346\206I\260\022R:\nC\264\314\230\320\301\034?C1k\360\374\256\303\215\242\360\203j\216\\\245\3762\331\236g\2739\330\336\206\236\022EWj\005\376\237s\307Q\315\213_\344\341?\346v/\231\243\363p\311E\240\252Zlv\023\271S\nn"
+	.string	"p"
+	.string	"r"
+	.string	"\237$a\310T\354\322>\212#\331\236\244s\001\273D,\236vw(6\021?\275{\001\326\247x\002\254O\333\354\251\357\216\366\275)\017*\252v\027\246F\326\207\273;\224\266\317P\245\315o\255\364\256@\351FNw\373\f\003\354."
+	.ascii	"]\207PE\372\350vdh\"\350\372\246\233(\301\310\351\202.[+\273"
+	.ascii	"k\231\323\201\270Y\267]"
+	.string	"\263\335bK\244Zd\377\273\273V\"\373\365\244\037\344L\177\353\274\245\177\336w\253\224\226R\372\"#V3\"\004w\177\202W\373\233/J\334\367\363\\!b\376\n\277\311.\227\b\237\241\304\033\220\330\353YY\020?\377\236]\256\0171\233\307A\274\001\031\310\031U\341\330\335\223OW\260\213\207\351\007\005\3613\244GL\356\236\302\366%\217\006\331\215a\343iwQ<A\f.<\0368\332\335\007\266\206?\331|\216$\210\252z\215<Tw\367\246>\371}\2070\342M\017O\f\215TRm\234\267\360(\356n\003\337if\203H\024\211O_\207\365y\0379\0358\031\364\265\245Re\215\226\262\364\252P=B;Xz\336Ip\022\350\251\036?t\365\373\255%\004\203W<\273\270\022\226J\247\036\031;2h9\346\240\261\022h\357n2629.!\313\005\3312\223782\f1\323*\263Y\214\203\331\313K\312"
+	.ascii	"\226e)5\230\233\031\231\030X\r\215\206\206&\203\325\310\270\320"
+	.ascii	"\300d5\033X\n\002\3232\300\324`74Z\r\346\332\355\225\310\357"
+	.ascii	"]\034\201?\234\356L-2\210\224\276T\245\344\311U}l\033\345\252"
+	.ascii	",R<\322\n8\244^\301I\340\303\360\245\367\235\204\301U_\372\036"
+	.ascii	"\241\005?T\243mYb;\347\0014 `\002!f\327\003d\"RM\031C\373Nf\020"
+	.ascii	"\220\\Y\367i#wY\323\302\217\254\340[\027\226\224\030q\020\206"
+	.ascii	"qfp\271V\023Z~\204\357|o\267\310X\336\306*K\360\210\307\332\236"
+	.ascii	"\035\006F3\f\316\335)\264\314!\310d\337\215\261G\326\366\237"
+	.ascii	"\021\271\274^}\035\007\037\340.W\024\272;\200\274l\260\t>HY\356"
+	.ascii	"e\206\2106X\332\333\033\360\245\334\271\372\023"
+	.text
+	.section	.gnu.lto_pt1Filter3Apply.30.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\266\002%\025"
+	.string	"f\250\210F\340\362f8\212\004\361\272]\223\333Ep<>\210\200*\330\311\215\017V\311\335\332\210\366\210\377p\272W\340I\250\027\200\267\244O%'\017\2021F)\303\245"
+	.string	"\203\221\006|%4G\302w\245\277\260\335\233\354\275\245L)r"
+	.string	"j"
+	.string	"u"
+	.ascii	"\260\304\371\351\006\004\361\340\270\002\366\264\317\342-f?\312"
+	.ascii	"ykw\310\tj\027\207b\023\361\240q/\020\036\024O <\350\231\235"
+	.ascii	"\343\270\242\375R\217'\327cw_:\302\372\017w\1779;\370i\316\374"
+	.ascii	"\325\n\322\0210\351\260\335t\016~\003vW\344\246\341K\311\236"
+	.ascii	"\333N~(\200\256W\272\t\223\316v\003z\256Vv\327i\273\371\334\341"
+	.ascii	"m\313lO\260s*W\372\247B(w?R\233<\033\247\223Jd\377\273\273"
+	.string	"\326!\273u\334/\362\243?\300s\367\250i\226\246EM\2574\035f\032\374\322\337\227VM\247\246?2\022T#\302\322.\207\336\217\215\002w&\236\373\355\217:\230\357\302Wr\310\b\005\263\355\277x\322\3549\313\020u:\210KM\033v\354\356\311AK\020\017\226|\017\261\307\244\242^Y\032\322\250\205\330\311\236\212\272\002R3\272\206\272R\022 \265\023\276\356\306:\337O\341\301P\337\023DS\021\005\365\265\024\337=#T\375\3645\243\235\354yTU\222\034O\220\330\235\254\023SU\246\216lS8\f\353\\E\273\353\300\266\360&\033qw\0310\275\340$\260Q\342\240\237\023\036\274\272H\354h\3313\200\235\007\325\335\325Q\237\374\271\253\210\240%\317\00162\030X>\033\030\234\031\226\013\241S^^b\032\274\264\264\270FB\273\270d07321\257\232\030\rM\314\345U#\303B\363r\221\331\274\\\007\034\253"
+	.ascii	"#{\335\304b\262W\bn\377\325!#]\334\201\210\242\351\016\250Df"
+	.ascii	"QiK\225*O>j\017\312G}@\225!}\360\204F\257\320\222\367ow\367k"
+	.ascii	"\351s/\241%\317\013>jK\257\300\347'y\330\252>H\261tg\235\201"
+	.ascii	"\030\002\024\207\255*7 `\002\231\203%\017dD\244M\221\307K$\341"
+	.ascii	"\204\344\312\275,\260\231\311A\273\361\254\350ma\225T\026km\214"
+	.ascii	"H\206^\003p39\360\340\225\006\346\322\213+\207\025O\231\254\370"
+	.ascii	"*\n\023\006b\f\305\304|@p\3460\n\3632g\324\306\352\376\332,\216"
+	.ascii	"\356+\250\275\255\340\026O6,\326\344\020\350r\0134\206M\304\366"
+	.ascii	"5\343\032\336\013\302\201\357ef\334p\203\205\275\375\200\017"
+	.ascii	"\312\235k=\001"
+	.text
+	.section	.gnu.lto_biquadFilter3SetCoefficients.31.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`H\003\215\024"
+	.string	"\226d\203I\260\226Q:(\003.\316#\201\342\357\n_\031P\201/\342\261\201\303\226\362G\"J\236\t\264\334,\na\202\325\207fW\375\370\017\223\321\345V\341|\313\261\264\331=\3404\343\377Q\021phk\253\177\311\253\033\310'\233\354\235Ri"
+	.string	"l"
+	.string	"l"
+	.string	" \313\362\350\310x\021_S\224\274&\357:r?\262\023\310\262%^\3644\355n\213'\210\257\007\300\024#\257O\3738^\224\273\021\316\005\354\006U5\355\362Z\274@|5\357\004\302W\361\003\302W\347\354%\347\305\330\325P\317\316\216'\273;R\030\317}\346\374\367\236\262\373\321}\256$\354\256\347\356'\305Mo\033\201\355\265)P_\271\321\037\340K\277\312\225\376\326\223~\326\221~\221N\257\350tH\247+\235\006\3514\235\323s5\375\002._\324\013\217\335\236\037\224\205\252>\032g\372\355\277\347\026\253\305\353=\356#w\246\233\250\363\251\200\002\210j\327\207\301\253q\342\353d\221\300f\251x\325%\020BD\245\370\312\342Q2\261\253\371\275\300$\021Cb\232\274(\222{\001\031~DC-\002\213l8\021\016\340\364\335\240\324v\207\013qoejw!\330\260;\305\202\314\220"
+	.string	"\246f\274\3728\341\353t\262cb\327\274\347\236\270\273\016(U0dD\324\232*\264EYM\357y\020w\366\2546\2773\270+\250\316\247\223~'\212HO\177\342)g\376\354\2621}5\244vV\331<\335\244B\366\301\245A\366\217\0367\034\215,c\245LF\326b*\344\r\211\030\230\337dl`!l$\216\366RC+mnf\260\233\353\003i\243\300\272\225#`\240\033\320\320\310\036\320\314\314\270\270B\307\\l$\316\246\224\215\264\332lV\213\215\264\0226\033c\266\333\350b\300\265\033\3226\342j5\333\330\342\355\301\245A\266"
+	.string	"\004*\207\352\370\006\356\272\210@u4\177^%\2019\222\013\253\037\241\224\314\2430\2049\352SC\2501h\005\005\204f$\220\200\322\244iZ\f\020\003\031Z\265\001\021 AL\346N\352Q\177\007\215\310\264\003\210\351\323\243\206\025Q\002\340\244\203\311d\216\350\272\033+\264\246\2355CU\312-\033P6\241H\205\311p\205\265\275E+\266\tlbga0\037\250\302\365\322\355D\363\267]\275\342\334k\305\3628h\031y\361\370W5y"
+	.ascii	"\024b\001\035\232n]\267\026\216\224\265\357\371\"\n \177\221"
+	.ascii	"\f*"
+	.text
+	.section	.gnu.lto_biquadFilter3InitNotch.32.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\250\002\335\024"
+	.string	"6\346\206I\300RN:*\356g`\3200\031\322\301\262b\255\367CI\257~\006\fb\237C\b\255\263OPk\224\020\365\257\356\375\255\353\313\364\230\305~\273M\201\361f\341\217\"\b\342\366U\3612\213\261\230\351\277\350d\020i\204\020)S\no"
+	.string	"q"
+	.string	"k"
+	.ascii	"!\t\342\005\2528Q\356E5J2/\350\202\"\214\017IT\303KyG\221\373"
+	.ascii	"P\005\223sn\370)\030\037\246\200\244\317\353j?\350'r\027\262"
+	.ascii	"\360\2229\177\244\230\346\344\251\270\300\370\320\274\007\020"
+	.ascii	"\037\216\007 >t\316\246q\336\207y$\240\034\"\035sN\327zx\356"
+	.ascii	"\232\363\257tR\247\347\346\312J0\347"
+	.string	"\264\352\364\370\334{\333\004l\363\330Z\025B\377(\252Y/\372\303\037\375 \250^Q\255\242\372#&R1\032\314\230s\347\327cN\205>\021\376\322\237\354\322\270\257\360\231\356\2647\\\224\276&\036\276\246\f)r~\017\234G'\201\0044R\343%\352{\270\263p\357<';\034v\250<\364\354K8\273|\370+\271$\207^v\222{\343\r\317\311\256*\204\325\234\323\300CO0i\342\250\312e|O\362\375J\377\216\017jJdY\333Z\261\305\356E\310\226+\262(Q\273\021:\375m\310\016\320-W\200\217e\355\342\330\225\320\351\317\177:\210Q\016*\247\227F6dL\275\362\367>\335\367\236\202\243W\016W\367\340~\357cg\205\243?\253\017\212j\352\225\315\323\351v\260\017\3169\247\367\307\026\325-Q-\"\252CDu\371\241\237|%6,50Z\f\027\203\2258\270\r\213LV\273\341`\343L\314\266"
+	.ascii	"\204\006BL\013\005[\354Fc \201\006\023#3k\2411\361\201\227\027"
+	.ascii	"\031\202\027\027\227\025\023\321\260\025[\354\026\003#s\321j"
+	.ascii	"\263Y\r\346\242\301\264\314\\0\033\215k\005\3055\231\230\315"
+	.ascii	"u\253\325l\256\222\207sp\356\217\037\300\230\302Y\235A\364\237"
+	.ascii	"\211\255%ww\\\2736\243\327181\354\215\303\335}\316\217(\252\326"
+	.ascii	"\0069 \240\002!:\253\003\245\001\200\303\231\b\312!\230`d\022"
+	.ascii	"\021)M\021\021\257]\2126\036tm\247\t\030\222D< g\301d'\rCB\373"
+	.ascii	"\203\226LUx@\244\205\356\246\324\270>\rA\331\211\304\037\\g8"
+	.ascii	"\007\233\ts3\246\023\t\034T\f\367\272c\205\203\261\234\346n\317"
+	.ascii	"\325\370{\252]\247\214\017\231\227[\0241\276\215\303\035\276"
+	.ascii	"\243/c\334\205\357\216\362\030\337i\032.yqe2"
+	.text
+	.section	.gnu.lto_biquadFilter3InitLPF.33.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\345\013"
+	.string	"\306\226R?"
+	.string	"Q5\035\377XRk\004=\3303\374\"\213\304\266L\212\364\317\264o\323\256\227\271\t\035\315\244\202\217\221D$R\fR\207\320\177C\032\361\267\345Ux\220\373\230\211\\\300\211\356\376d\357\275S\n="
+	.string	"C"
+	.string	":"
+	.string	"\002vI/Z\354\216\007l"
+	.string	"{\365\370\001\327+\366\311\365\352\320\226\361Q\304~\205\211\020\252\265\273\331\f\361\3602\364\257\342"
+	.string	"D#\320\345c\301\356Z\212F\034\356y\333\024\333\232}\005\001\227S\372\017I\213\365\300\305\356\206\216\032\273\252*\022\266\017\2611\016\013MqT\370\224\005\032Y\r\037F@\300^\013\320\030\2269\036E\370\323\005\327]\0176\030`\257\021\371\t\313ri\277\364\023\341M\030\036\230\364=\227Y\274\204XZ\255\351\256H\251\363\223N\033\244 /2\335\016\023d9?\037\272!\312\016K\325\f\030+i\330#HN\020\366\351\356\256'\311~\352\2577\375\364\247\007\240\004\216V\341\333>\235\203\t\335\206\323\3414P\342\331\276\006\001\214 \223\321$\310\\.\025\311eL\345\333>\234\215&\353<\216\3630Y\267\321\270\f\363\201Y\205\200\275\316\366e\037\317\3732\310\270\247;I\216\300\261\022g\006\007\023"
+	.ascii	"6\207\323$,-\243e\342\r\321h\360\020P\204\273\3175v\304\314\006"
+	.ascii	"\302\007\243\34020.\b\337\251\321O\335XRV\300\265\274\020&\031"
+	.text
+	.section	.gnu.lto_biquadFilter3Init.34.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`)\003u\026"
+	.string	"\006)\217J\260\322U:`\306\372\rJ\177\024r\023s\341Ca\203\245QK\346s\t\364\351\213S\370\311\337\256\247\356:\321j\245\252\234e\377\323\037Wj\376\203>\334AR\370\275p\343`\272\317,\003{q$\342\352\2161\261d\223\275S\nt"
+	.string	"v"
+	.string	"w"
+	.ascii	"u\267GH\203\362u5\317\362\360\372\264\337\342.t\007\242\371\200"
+	.ascii	"]\340\215\030\273\301\024\237\224\257\016\236\204|-\317\"_\255"
+	.ascii	"\263}<\370\2637\002\352 \024dw]\324\204\351\307\340=N\335\353"
+	.ascii	"H\247\316G\261 \275@R\321\367\333\275\216\253\335\025\360\343"
+	.ascii	"0\252\314\233_o\216*rN\257\364\223$\"\337/\347\023\305\262\273"
+	.ascii	"\236\276_\210\233\274m\234\355\234MW\002\024h\253~\364\247^\364"
+	.ascii	"\227\037\372Q\007"
+	.string	"\372\311\007\375\365\302{\326\351\257X;= \024w?\024\207,\217\272\204\342\302\337~9\364\362\223|%\213\224D/[h\032\345\016DIdT\364cwQ^}+_/b\227,^\344Q\256(K\361\252E\036\216\253\275\351m\212[\312\327\022\370\032a\\H\367\241\013\343jkJ\360D(_KF\235\027\r\376\205\356A\033\034\260\353\300\021\373\215\021L;\3436<$i\232\275\206\252\211\322\360\001\361\320\3664`[\303\211\036\232\374\354\356\212\375\362%Z\271\273\td\340*\034\3709\361\352\323\220\257\255\246 ,\035\246\324L\321\222\242\350\351\244$\265o2\363>\217+\202\356\\\351\351m~\360f\321\001\2108\224\356\356\216\032\345\027~A\017o>\371J\037W\220\230\304\037\323\316';\270\233\324\307\37679\032\006\3308\213\3110A\302s\024``\026p\263\031\333\203\027\033\r&\246\006\313\215\310\314p\016"
+	.string	"XE&sQ kii\215\220\216\265p\263\031\030\232\213\313v\253\325n1\227\215\006\253\271b\270\234\253E\300\267\230\031\3165s\273\341\\\"\301\375\227\002}\244\227D\036\036<\332\253\324\307)'\252\242\324i\242|\322\233\224O\312\300\251f\ny\242,\274\371\364qT\321\013_\202\340\223\252\350mvz\263h\023\234_\216\035\001@\25018D\221CdDH&\232\231\024\346\030\240\002\231\262\232\007\022\340Vus*\323\332\365\177\003\215;\246\023\311\223z\035\025\025\ff\316iw3]6\241G\234\t\342w\234.\321\305\204\372H\277\252\032T\332\343\342\207\251L\023'\354\254-g\267Q"
+	.ascii	"\352\221/\006R\343\263\254\216\271\302c|\306\263\215RJ\224`\250"
+	.ascii	":\n\024\372\354o!\262m\262r\034\306\177\004_7%\257\253\367\330"
+	.ascii	"\226V\005+o#\354X\331[\224_\374NU\244\001"
+	.text
+	.section	.gnu.lto_biquadFilter3Update.35.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`W\004\265\027"
+	.string	"&j\225I\260\226Q:\250\363\255\306i\210\323\002\021U\236\f\234!\032\325\341\f\037\254\024kU\340Lwxx\247\321j\337\316\005&\273i\227S\343\337\236\365\255\251\330\230\343\334V(X\213\257\n\026\3656\320!\003\342G\311'd\357\235Rz"
+	.string	"|"
+	.string	"\204"
+	.string	"\\\240v7\307\r\312\2174\225\005C\366i_\306g\350N\303\350\002v\227\222@\355\002slS~4\3600\362c\371\031\362\243u6\225\003\233\366Q\242<\350\320\262\2731\232\302\363\025x\327\251\373X\351\324\371O/"
+	.string	"\244\212\357\267\373XaN.Z"
+	.ascii	"\370q\2506\305\037\303\013?\221~\275Y[(\235^x\233\037Y|?\245"
+	.ascii	"O\326\316\356z\372~\"n\362\266q\266\203\354j\013\366\353=\376"
+	.ascii	"\230\357\370a\236\343w\375\306\377r\032\177\353\301\233\234\323"
+	.ascii	"\343\234\256s\232\316\3519\247\017\233\211j\362\200\311.\210"
+	.ascii	"\253.+5\na\361\340o\237uE\346\373\360\205v\261\260\310\354\240"
+	.ascii	"\213\345.D\311\343i\211\225\335\275\371h\240\362\343]6\353\211"
+	.ascii	"\254\366\320\240\245\002\222\035\036V\231E\352\371\2400\224\321"
+	.ascii	"\034EUf\217P\224\200P~d\341\220M\340m\350~\303C\267v\215\004"
+	.ascii	"\025\312\023'\264O\325\"\225b\242\304\302\223P\342\214:R\244"
+	.ascii	"v\"3\310\324\322\017\361\020FE\f@E\213>,A<\254i\332]\005\366"
+	.ascii	"\205C\331\312\335E0\f\272\031hZ\361\3217\"?\236\326\250\020\302"
+	.ascii	"\233W\206!\326\240\263\270b\312\026j\234?\370\005&x\323\312\027"
+	.ascii	"\276\27681#\2035c(\fu\321\027z\363\026\265s\031\346}\256;\202"
+	.ascii	"\356<\2111\246vZ\331\300\335\244L\366\357DL\372`\272\024\271"
+	.ascii	"\332\006\236J"
+	.string	"\033*\232\020\3414\"\036\t@9\032\356\207\206sa\240\341\034\274\370\200\217\317O\002\237\236\036\235\001\244g:8\032QP\355'&t\263\331n\263\230P\215\307\026\233\341r1\035\002\276\r\321p1\242\333\r\027s\001\367t\311\177zID\"\305\243\275\2212\271UE_\224VM$\333\3169I\031T\035M.V$\335\341M\253\327\335\335\372\242\017\236\006\347$}\321w \321\233W\256I\2321N\221\022ev\252\261HS\250Qd\305\214!\031\021\221@\302hR\330b\360\002\0312*\016\022\300\204U\243\0218\301\344\273\374\036\370\223\254:\035Q\n\352|\372\355f\030Dn7\211\236\361\241D\223\r\303\216E\032\262\f\213eS^=\f\256\342\312\244v\376\026\333\216\365N\247\370\213\352\262h\223\212\351\027\301\366\266[!\214GQ\244\210\255h\220\215[\317C\361p\001\214\023\217$+\n\376\017\2072\236Z"
+	.ascii	"U\335\377T\264\020\270\302\027g\t\256d\020\204v\256\227V\342"
+	.ascii	"s*HHS\340\203\212O\357\334\016\361\244\001"
+	.text
+	.section	.gnu.lto_biquadFilter3UpdateAxis.36.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\035\001%\r"
+	.string	"\026\330XD\020q\224\016\300+\fV\204\202\365"
+	.string	"Vmu\030E8JD\003(H\2472\b>\003\346?\325\027\250\241\017\345h\2445\326\353-c\355\017\200B\013y\207\200\022\022`w\343P\341\350\316Z\364\t!{\313\235RA"
+	.string	"K"
+	.string	">"
+	.string	"\"\340G.\034\300.\213Ee7\334\330@\366\351\360\002\256\317\354\232\353\323\240=\343\241\211\275\214\226\f*ZvW\323\022\007\037A\377+~Y\201\250\036\261\004\273\353\270\002\361p\353m\027\260M\262\357\021\2732Y\234\260}\214\215\211\330&\312\204\020\016\237\017',\021\262OL\303&M(\310\314b !\322imZ\342\024\231\331\r\037 \030d\237\027\215-\206O\001\236\304.|\331\035\321R\331\335\215\025d\237\004\344\025c{\264\217\342\001\316\"\246\227N\225\252\032\325F}\361+\313\r\241*\307\0265`l\304a\207\252\250!\366\345\356\256\225e\037\345\307~\362_7\371\347K~y\222_?\362\307\213\306\306\213\006)\273\035r\264\002\334\311B\307\301\271\224\347\201\204\217\363D\234\207Aq\336\202\216oT\301#} \024\022!\b}>\234"
+	.string	"\227A\034\217K\221F\"\315\324\225J\035H3\215<%\r\344}\032g\200\273\023\347i\251\256\3634L\270\227\253,C\270\261\342\241\037\001\032"
+	.string	"x\346`\347"
+	.string	"4\211H\313\024\231x\2064\332qA\013\256\021\313f\030P\030\002\na\330PA\2009\220\031\214(D\211n\030\001\302"
+	.ascii	"\345\f5<\020\003\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_biquadFilter3Apply.37.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\032\005E\035"
+	.string	"V\265\266H\240\230Q:\244\352\351\001fGr\202\005\260\356>\321\216vMH\023@1\225\227\233\370\322\333C\275\336\377\331\371\301\320\222\016zh\016\312[\300\213))|C\201{\264\236\033?`\356\2649\354\312~\244h\304\222M\344N)\233"
+	.string	"\231"
+	.string	"\243"
+	.ascii	"O\342WYvJJ\341l\373JN\325\364\241\267J'\026\345\222\253b\230"
+	.ascii	"Zk\320\251'\224\247@\343e6\251\0037\205\316*#\241<%c\340>\355"
+	.ascii	"\027\271\221\246\037!\361\235Z\243\2508\251U\230\300\b\312S\013"
+	.ascii	"\337C\236\226\247\221\247n\262\301\\\330\243\376\n\315\211!\231"
+	.ascii	"Z\353myx?\n\357q"
+	.string	"6\235\216;\233\374\030\021\222\023\2302\006*\350t:\316j\2559A\023\243\202\t\f>\315Q\310\213\357\253\216\200X\204\n\276\370\214\021\325Z=\241\202-n\362\266y\2665\330\224(*\270\202\273\265V\247u\220\003\034\276\031\346W}$\222cB)j\2513\314\026:\315\335a\377u\243\354\237[\335\266\037\371\001\034\353\256]\370\373|x\323\3504\017\235\336\241\3233:\255C\247s\3504\016\235\276\241\3232:mC\247k\350tI\247ct\232\244\323\224N\217sz\307\3519N\177\200O\215,\025\306\324\272\242x\246b\241ZAn\365c\375\303\257}\262\b\316_\342_\235\211e\244\021\254\021@%f\025\bD!u\341\312jD\351\304\302\007\370#\205\205 8\007\277r+7\373.\233-W\266$\330O\312\2665k\263\266\341o\252\212\211\247\322\235\312\203\232=Ul\313\245`SL<\340\341R\n\304\366"
+	.ascii	"\f\333\336\352@\344\322\265\355\004\373\335\3302\361C\257\244"
+	.ascii	"G\201\340E\356\207_j;.]\212\3467e\033\303\265L\024j`\357\376"
+	.ascii	"\004DYk]\340\204B\317@\217S\237\004)\344C\3137\213\276\341r\241"
+	.ascii	"\245\266\307z\006\034\276g\2110\261\200\027\020\337Y\344im'\030"
+	.ascii	"\220\306\\\237\335\375o\310xW!\277s\377\233z\232E\323\366;^9"
+	.ascii	"\221\3067\213>\223?KL\037\224tt\t\211\251\227\343\221=\235\210"
+	.ascii	"\242\261\227cB*\nAZ\301\321\021\007\006G\0336"
+	.string	"\f\361\2206\032\342\345\226\220t\034nJ\273\244\244\235\321MIW\224t3\342\365nC\002\274\373\220\343\335\226v;\336M&\254\337(#y\311e\003\213o\237\350\356p\315\327\376\354~\315\240\323\026h\333\tN\333\b_%\246\231\260\034\264%\362\315\260\217\343\317~(t\332\376\354\1777\236\252~\036.\2125\0372f\360|\231\330\363egu\226g\266;^\214\336e\226\263:\\r\337\222\023\003g\263\230\330\203Eg\267\240\304\254lq6@\223.\023\337\345\325!b\2501D\006\035bF\250\244\240$%Ic\300\002\021\"\"z\021P\255T\214\310\002\3551\007$\034\244\364E\347\257\332L\322\220\215\2279\225\036\340(\3671\240JE\222\204\016\302\311#9}+\350\304\205\201\355\317\342\204\305\341\241\354\024\020A\377\373d\365\t\277E\250D8\302\276P2\004?\212\261Z\021B[\373v\212\344\206yg\357"
+	.ascii	"$\232\320\266\316\223#\020.\371\b;a/t\242\250\035z\310\210I\022"
+	.ascii	">y\t\255\354\261H\375\\\nK\205X\013\200\264\261!v\241\315\260"
+	.ascii	"I\237/\317\220~\264\222)\245.\213\203SAo\313y\022\360\371/\240"
+	.ascii	"Dt\214\334\255\346Gt\307@T}'\335\302AMV\360\236\346SJ\307\023"
+	.ascii	"T"
+	.text
+	.section	.gnu.lto_biquadFilter3ApplyDF1.38.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\005\006\365 "
+	.string	"\266\373\313G\220VN:\3448\004\251\177t`b\007)\247G\n]M\n\027\0300\362\037("
+	.string	"\fri\005W\256\323n\177\336\025\263Q\371\354\263\301\2748\357V\374\252\035d\363\305!\025\262\234\374EaW\245\372\276ZK6\221;\245\266"
+	.string	"\241"
+	.string	"\276"
+	.string	"a$|L\340T++\030\\\026\272\200\221\330M\255"
+	.ascii	"`u#\006\005\265!\177\210\377e\336)]\033\262\355\023y\021\251"
+	.ascii	"\023m\266\233Z\2613\"\366\002K\255\025\350\324\023"
+	.string	"v\247>\343y6%\033\232C\217\205\211\260;\245\304\241O\373>\376C\352@J<\247\326,\265$\265\016\0258\301\356\324\303\367\310\323\335w\310SK\331V>\324\252\027\303BA\364Rk\375\255\r\357\307\341=N\251\323q\247\224\257+\022r\003M\346\252\256\246NG\234Z\253\315\325\211q\301\264\272\242\232\243\216\026\337\177=\001\023\264\252\253\026\237\272\242Z\253g\325\025\213\233\274m'\333\032l\022(\273{\341\216\361N#\277s/\354\242\232s\356\355wTC1&8\347|\261?\305\031\217\335Z\353\324\032\210hFp\312\371_\037\275h\3143/(u\312\331\303\251\2715\354\277\326Z\275Y\366\317\301\356\236\003\371\007<\354\366}\370\0138\361\356\321i\036:\275C\247u\350t\016\235\306\241\3237t\332\206N\327\320i\032:\315\243\3233tZ\206N\357\350\264\216N\223t\232\322\351qN\3578=\307\351\033"
+	.ascii	"\260\366\344BY\253\212\2710\225\215\226\3458\330\037\366\023"
+	.ascii	"\277\366\351\333\220o\304?r1\363h\225\245\226\321\247 \321\322"
+	.ascii	"\331\227[8[\2639\273R\204\\7k\2638K\305\264\271$:z\224\0067K"
+	.ascii	"\344V\026|\222t6\233\345\235\030\373B\2632[\263=q\274\235Y\232"
+	.ascii	"-@\\s\3711\036\256\026\206\267\037\263U\026Lsy\270\242\322\233"
+	.ascii	"L\231\331\303\355\226\256\314\222b\2042tK\356n}f\302.\252%.\217"
+	.ascii	"\366\341h7\323\355\321\266\312\202f.O,2]\311\203\"\271'\272\371"
+	.ascii	"v\\\272T\214\260\313v\205\227\271\fr`\003O\026bWke\220D\302\023"
+	.ascii	"\002\255S\277\004\031\264U\026\234s\2469\353\001\305\267\017"
+	.ascii	"{\206\031\301\217\215py\240\210\303\367\030y\352\333\031g\365"
+	.ascii	"b"
+	.string	"\256\200PQ \232\224(\324R\324S\222\023\371\2444\302h|J\212Z2\022Az\001\022R\207\006H\0348\b\351\220>\022rJ\202ZR\352\360k\00221\001\217~MJFL\277#\247\247\237P\217\201 \222\234~P@\240\323\2177\254\177\335,\013\371\356\314\t[p\251\350\326\260\314\333\376\354\276M\240\367\326\312\266\025\274\267\020\336LL0r4z[\024\234r\037\307\237=1\350\275\375\331\013eP}\3756\\x\005\330\302J\343\342\262\267\005\355F\213\313^\0263\037\226+\004\266\260\310t\033\347\262W\204\273Y\263\252,Az\366`\367\341\331\234\355Y\fL\250\b\271vVgyv@\334\233\313\267\0257\334m\255\270\263os\243\342\362\001u\250A<\345\024s\206\206FAAR\2224\006\300\002\021\242\3426\021 \255e\320\f\205\261\307\264\031$\fR\362E\210\007R\207\260<\220pd\322\206\310"
+	.ascii	"\333*>\332\f\022\035 I\027\333\252\257q\270\f0ma\355\214\332"
+	.ascii	"\301\242\213\231\231b\t'-\373\275p%z^\307\263X\362\373\177 \177"
+	.ascii	"\234\016)\233\256n\322\261\270oH\321\315\374\374\216\340\220"
+	.ascii	"m%5]\256Z\030\217_\350B\350\340\240\024\356\036\022\252\216\n"
+	.ascii	"\205\275O\032\034\203$\021=c0\005\t\323\033\304\207\361\307\361"
+	.ascii	"\345\205\301\253.r\332\033\232\250jRb^\241\325\022\323\250?\264"
+	.ascii	",^\300O\360:>\266\316\256\334\034\214\302\347\342\035Z\216\352"
+	.ascii	"d\022\265\260\250o\320\0027\344\233\t1@\323zl\303m1\007#-@\240"
+	.ascii	":\310\364/\0045Y\355\275\364g\222N'\250"
+	.text
+	.section	.gnu.lto_.symbol_nodes.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\301\002\245\t"
+	.string	"R\01656`\213\322\001\030!\220\200\253\315\f\326\272\322\367!CH\234\360\b\342 \b\001"
+	.ascii	"\b\240\201a\030\206\275\265\377\255\021\322ZB\b\327Zy\253\333"
+	.ascii	"\272\250\203n\217\322J\031j\332\252\273[jl\222\331\304\346\305"
+	.ascii	"\213Z\356\356\0079\031z\026\357\204d\007\013C\324V\261\3020\305"
+	.ascii	"E\236x\354R\200|ht\221%\251\335\216\212\323\306F\341\206\223"
+	.ascii	"\030^\332\356V\335\276\205\217v\025.Jx\b\341\240=qH@\034\374"
+	.ascii	"c\360\256\340\334\022\334\263\245w\226t\316\350\232\350Y\350"
+	.ascii	"\030\350\327\347S\322\236\327\026\236o\3355\3343\374}_\310\366"
+	.ascii	"M\347\026\347\030\355\227\354\003\330\345u\313|e\363\250\271"
+	.ascii	"@\346\024\353\020\363\200\210\327\027\252W\315\210\330\252\273"
+	.ascii	"\373r\200\210\2522F1 `\203h\222\016\037\0066\004\313-\313\232"
+	.ascii	"I\221\207u\026\322Z\235\207\321\265\363\017\031^.}+\030\331\333"
+	.ascii	"\342Xc\377\306o@\3707|\203W0\361\006\003o0|\3437\276\341\033"
+	.ascii	"\345G!\253\034#\177c\3127\020\376\033\277\361\r\337\370\206o"
+	.ascii	"\374\3067|\343\033\276\261?\\\313\216\001"
+	.text
+	.section	.gnu.lto_.refs.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.45d2f8881dceb048,"e",@progbits
+	.string	"(\265/\375`\303&\275\217"
+	.string	"\n\337\2500R@P\312I\007\376z2S\024\204Z\376\377\325]\365\253\246\337\357\272\231\177\335}\r\275S\177S\325\363\177c\257\371\234\031\352v"
+	.string	"}"
+	.string	"\3247|\345OT\271\340\2369\344\035\212\013\265<#\026\207\322\305\265\273$\366\021T\372>\007f\352\351\233\335[\312\024\200\002\357\002\025\003)\211&\367\375\331J\001\372M\357\351\257-\357\355\234\371t\206GL\315K\254P\265\242\300\266\r\205c\235\341\334\214Z\224Q\264\363\360\354\027A*Xm\271\244gD\240\224D\271R\026]\203rQ\3512\333\261R\306\224\022\347f\026m\303*\213\206\251\251\231EyJ\225-\350\275\267\216\263\260\026\276c,l\307[X\216\351\370\213\347\330\355\374\306ps\314\366'\303\2151\263\253,z\357\245a\202\036\355"
+	.string	"\260gh\332J\3560d\200\275\322sWz\336J\317K\322s\222\364l\225\236mH\317U\351y*\305a\235a\002\034\005\212\r\037\030\265\264\266i\200U:\220m\317K\351\223\277\030\312hF&\224\23360C\324#^8\246\254=\323H\231\213\237\324#\016\345\035\273\267\231S\243\024K\332\2655\363@\274\2035\274\264\275\f\351\231K\214\tw5\371\363F\346\3365.\346\275\267\214\311\330\t\177\361\030\203\235\235\034v\333\274\227\350\336{\023\377\316\317L\270\213\307\270\371\247\0016\356]k\272\211s\023\213\362w\357\r\021\302C\b\231\271\250\r\"\251\375\b\351\341\270\303\260f\203\264f\304\331\353:_7\202\323\244\027\246\3574\001\3560\264M\3560LYg\370\234\337F\0208B"
+	.string	"\020\020\021\260\002\374\007\363\037\360\177\340\177AF\322&\216\363\3278\241\255?w\351\022|\377\007\271\2770\207i"
+	.string	"\305=\374\325\347*\310\374\347\373\231\346\2556\221R\247\336\300\211\177m\002\253\361\232\277\322\200\367\233\277\306\360\037\313\177\272\377Z\376\333\375\237\373_\367\377\356\177\334\377,\037v\376\177\270"
+	.ascii	"\177u\240\206&\201\3424\177\305\340\375\327\234\277\025\030\321"
+	.ascii	"\".\363\327\372\037\355\366o=\2407\027\250\220\251\bS!\t\nB\204"
+	.ascii	"\1777=\375\033\371\237\354\377\330\177\261\307\374Mc\002\240"
+	.ascii	"\327\277W\370\373\201\277A\374\275\300\337\004\374\035\300\337"
+	.ascii	"\304\277i\376\346\237\277\374\034\375\231\356\347\267\237\245"
+	.ascii	"\374|\3663\330\317M~\336\372\371\352g\251\237\237~N\372\371\370"
+	.ascii	"\263\361\347\031?\003\375\354\302\317*~V\341g\024~\026\341g\017"
+	.ascii	"~\336\340\347\t~\026\361\263\315\317\366?\227\377i\377\315\376"
+	.ascii	"\277\370\217\342g\002~\366\360\263\316\377\021~\276\371Y\370"
+	.ascii	"?\357?\336\177(\377\237\374\027\341\377\211\377W\376'0888\370"
+	.ascii	"\017\217\277\005\361\037P\003\357\257\274\232))L\035m\233I7\323"
+	.ascii	"\234hB\232M\352\221\"9\226\314\374\266\362\206\332\276\213\301"
+	.ascii	"\032/G\027.-\255TG\t\363m\305l%\351\275\267\336\373T\20594f\375"
+	.ascii	"@\303z+"
+	.string	"\351\255\032\320\226\332v\222\343\3218e\351-i\333W\177\336+H\232\\\333F\362'\232\227\035\325\221\251TgoD;\265\217\367\323\233\352\347\257~j#\314tk\236Y\017\255\277\313\344\004\302\326\240r\206)\3626\362g\3155\300&I\033\264J\333\256:\036\221\315\nI]\333\373\375\311I\320\262\312\246\232\310/#,B\026\266\327\366\225(}\017\271\201\302d\276\265m!iQ\013~H\215\024\321*je\003\351eK\2610<\022-\257\332vT\007yK5\324KD\360j\374\272\\\367\336\226:\241\274W\250\245\210\201\367\n\021\231\025`V\300jA\331P\366\227\222\340\016\303!\353\f\373\307\316[i\227LKj+l\273\364\303+tt\357\335!l^\350P\315Y\310\f\342\267\341\312\013\334\013A\340\275E\270\372n\232\256\254\236\264\275\031\\\343\022\"\241d\316m\336\243\243si<\206\311%s\232\027\210"
+	.string	"\327\031u\217\315e\322*o\337\346\345K\264L\276pl*\217\216M\245\021\347\022)\215\3676\2238\3071!#\037\235\313\344\321\251L\346\\\242k\274N! )\2212ydS&q\216N\241\344\221h\231\314\251\342\242\032b4'\267\306G\216D7\007\322I\350\b\007\356\330T^\273{y\254\350\036-p\257\223\362\310Nh\211\241Cp9\206\236\b)\271y\357\035"
+	.string	"9\004\245\274Dp\307+\345\275WC..\362\204\261\tw\247\030\316\030\345tq\024\335K"
+	.string	"\362^#_\270{\257\361\336\033s\344\324\274\267\007\316\221\211D\336\313\344\001y\235\214iE\367\366\330\0354ytB)w\322\304\234\314[\243id\346\265[\036\245N\243\327\305q\357e\276\224\231D\332k\013\242{\310\0205\2112t|>\306\264\322Nj%\376\372\320K\347\275f\272P\250y\233\3676\211M%H\006\326\026\347Hz\3760\254\203\203\374a\330Hz[x@=\245}\324I\376\352\035\377R^\347\275M\233*\244\324\366\0041$2\210\341\337:r\f\003\235Z\344\332\"c\2568qt2\355\033m\303\rG\033\361W\337\350\032\347)}\274\301M\2546\017!l\352\304\234\234C\373\326\221\362m\241\242\246\241\024\b\305\331\266\211n\262~"
+	.string	"\n\356Ya\013d@\016\303\202}{\210\301\264\020\017\362W\033\371\206\363\037\177\361R\345\tm\303\272\213\372Q!\002\365\262\306}BM\320h\334\030TO\215\373\204\2660\333\310W\270\217\341\306\354\336]\210\0203Y\304\356\276"
+	.string	"`\207\347\"\027)\215\324\3635\355Y\2458\261\213\016\221\220\241YEy\225\242"
+	.string	"\236\rI\332V(\307\273q\213\2123\036-=\242f\003\013\032\225\322\214\205\275:\t\253g[Lb\234\026=\261'\257gy6>\236\234\\\332V\263\013\210\256di[\313\310\306\304\206\311\264\006\313\353\025\314\253n\325U\205AM]}\r\2465lL^\2330\251[uNQ<\277\037{]x\251\r\022\353u\tV\335\022\243\001X#d\n\335\325z\335\2529\n\3711i[\263*\022\024\231\026%%k\251\f\332\220W\"C\352U3c\234L\351\210^\246#\020\177E\362z5s\365\024\374\322\266\332P\255\352\022p\t\244Z\325#M\234\31415\021\327P\002\361Q\231|\303\026'C\307\266\325\310\247|M\005.\265\255E\376\264\201k*!\333\326*\252)\341Vz\263W\225\257\313\252\254RY\220\314$\314\345\221 \257RyQ\032D\200mkTEJ\335"
+	.string	"\345\216\332V\250\231'nZ[\232\206n:\002\301"
+	.ascii	"\021\222\022\177,\275\362\250K\365)\275sa\2304:\274\304\354\252"
+	.ascii	"\217\327'\244\275)Im\253SE\262\351\021\206\n^\333\332\024\003"
+	.ascii	"d\352K\254m\355\321<XX\233[\362\260M\2200I1\t\223\251MW5z\305"
+	.ascii	"Q\215jRX\217(q\353\2133H\255\3415i(\350\205\343\250\"q\016\345"
+	.ascii	"QIE\252;b\322\242\206\bq\tl\332\253\253Iv\253WK-\270\266UG\363"
+	.ascii	"H\261T\025\301\322\266\346\350\246\233\252 ]Jm+2\346GY\240_\r"
+	.ascii	"\355\224\333\202\273!\274)\021\256\016U\033\225F\035\252\307"
+	.ascii	"\271/L\032(\\UT\332\326#\020;\036B\332\326\242h\212S\004\346"
+	.ascii	"\035\b\246\032\231-J\374\201\\\372\253\367\3258\243L#\022\327"
+	.ascii	"\266\007\333\013k\025\311\255\265\3550\202\200VR\234(zo"
+	.ascii	">\275\376K\357\334\2239\274\322\005\206\343\206\367\337P\315"
+	.ascii	"\217n\351\305.\0059ny\361K\373\266\302\344H\243\201:\371\315"
+	.ascii	"\3651ZM\223\323\035\337\236X\212s\207\367\356\202\327g\fF\026"
+	.ascii	"\215\021\022h\226\225\247$\315Iby\323a\351"
+	.string	"-El\006\363\240\f\335\275\267(1Bb\325\266\265t\323\312\261\235\r\266m\273\272,VH\232\363\204\355\355\306\326r\351\235{b\366^\233\226Q\334[\356i\231y;\260\264m\270~k\263KiN\340\2247\225)m\205\351\006*P\311J\225\267\225\347LX`\020.m{M\315\036S\016\313\347;\355\331Qd0\230\303\021\025n\tN\371\001\345\035\345i\237\177O\260n>5\2012\007\325K90\031{\227\215\365Yz\347\216\314t\t\024S\226'\3573\342\2220fIm\333\254\2335H@\376\236dk)\2077\347[\314\331_\200L\031\344\331QJXY\252s#\253\301z+\253\277R\343\275F\234;\304\205K\36421\201\250EONF\274\002E\036\240\027-\204?>A33\200d\304\210\301\223\"\bh\305\314]\210\brQ\344\201\321\342\307\207G\306\212\231\016A>34\020\300\204\007%\204"
+	.string	"@"
+	.string	"&L\364\024yX\304H!g\307\203\016"
+	.string	"\b*\376\364\370\254\360i\321\242\007\210\203b\017\n&\f\360\240\204\020tpLp\261\242\b4B\261\347\003\342\211\016:\305\236\240\236\023nN\230\270)\302\020\243\b\003\t\305 \236\020\212=\037\004P\374\341)\006\375"
+	.ascii	"q\320\003\303\007E\261\007\005\0176\034\234P\364\371\001\201"
+	.ascii	"x\002\347+zf\360\201\341S\214\001\224\276\030\304\323\202\204"
+	.ascii	"\241\f\036\027+\254\f/b\304\320\340\305\013\030~\210_\341#\243"
+	.ascii	"\347\247\247\205\364'$\200@\002\nf\304\234\002\013HX@bx\n,\330"
+	.ascii	"\331\261@\202\235\364\022\354\324b\212\022&\212)$\330)\376\370"
+	.ascii	"\300\220\366\244\350\211!\003\n\016E\0278(\205\211\232bP\n\023"
+	.ascii	"\304b\t\031\232\005\017\f/\370\250\270!\241\242wTt\t\025\275"
+	.ascii	"\303\323%xzgF\227\230\321;2t\261\350\003\303'\204\236\"\217\214"
+	.ascii	"\234\242\213\002\016\024\243G\306\210\"\020\220\214\0214(XtP"
+	.ascii	"\n\017v\2121hN\202\005\213\026\023\260P\241B\004\207WP\001\007"
+	.ascii	"\t\2440\302\007\351\n\0212z\212/|Z\214\370\001\202\001\003h\305"
+	.ascii	"\210\037\037\036\030#V\310\b\032!\202\200\236\"O1H\310\301\t"
+	.ascii	"}U\257\204>\356vP!\211V\2449*(\253!d\203z\\\354\221$+>\267!L"
+	.ascii	"\273\264+R\207\325\366Ok\304\013\247\346\256\357l\f*\025\326"
+	.ascii	" r[E\244\tsf\313\r`{TL\251\345\213\272\225\212\262C\030\2479"
+	.ascii	"\224e\2149\204\342\332\243\022r;\204\235\334\305E\t\222\"Sa\323"
+	.ascii	"\210v\372\255\323\355\223\223]\362\327\325a@\224;(\345\357^&"
+	.ascii	"\0205CU\226O \267\313'\026\030^Z[\253\264?|\324\245\302,\246"
+	.ascii	"\333\036LVi\013\023Mr\311\024\036<\322\322\341\215\344-R\322"
+	.ascii	"*\221\tFc\262\242\210\352l\322\255RJ\205\004Mjkk\250V\304)\256"
+	.ascii	"#9\354\216\230\256t\270f\221\267:,\262^\375\r\031\325M\345\210"
+	.ascii	"\221Jc\250\354\320-\r;doh\261R\307vG\304\032\335\336\310"
+	.string	"\023\222U\275\211\265\2656\252\325\r'CB\332\332\243\255a\213,Q\314\2164\235\002\370*\bh\215YSzs_mo\215i\0170}\202m\353`\265\022\006*\345\356\332\3260\201C\301T\246h\357\265o\257~\321BE\364k\243\242\366\367\372e\370\306\227f\324\266\336P\255\206L#\264\242\266\325\213\037\037]\232^\273\327;\273\032\325\3225|\376-\251\272\274Fk\222\340_\263m\315\253VXV]\250\332V<.[\264HIg\214\324\271\270J7xSe\310\0212\313+\335\221S\230\263m\305R\333,[\330\335Sn\350Lg\346\252\332\353ZU\253ouym\314#)n\257ovl\312\317K\333j\245\266\365\231\037\230'ml4\315>:,d\214\240R\227\276+]C\246L\211\245\257m\255Be\230$\203(\250\302\321,I\344\312\310\f\211\210H\222$\351R\013\020\004cY\036\346\326\003\022"
+	.string	"51\3169\205\020*\032\021)#\255\016\375\002\252\207!\200\205\375\017`\200M\3006N\207\267\300\314n\252,q\365\354\026\\\230\n\037\330\227Dr s6\230\0044p\006\213\237\032\331\377\2354\266\320\202\250\330\307\207\t\002\373\023\tY{\005\b\322\326\007\363\262\374\021\301\315\020\361\023V\316\276\354.\2168\016\013Z\300~\321C^k%1\332\017\t\324\024\221\225[\020\252\3228\023\334\031\345\n\215_\370\230]\251"
+	.ascii	"#U\031\327S\220\344\022}\301\017/\205i0}\320\367K\250\266\302"
+	.ascii	"\305\302qU!\236\356n\247\341\225\n\001'\325\317\320\350/y\217"
+	.ascii	"\b\214\221N\325\271\376\310\340\030YK\324\265p\205\335\272\342"
+	.ascii	"\320\017t\343\253\336\025m9\246c"
+	.string	"q\336\367J-\216C\021\270\\\306\242\333\377\256\314\227\302\240\237HA\267C5\324W\024\250AF\003\326\213\200\3349\365[)!\347`\325\f\324\324|*\301\306\016\334\302\035eq\337\375'fI\314W~w\232\354\203T\223\200\341\375\370P\344\353E\254-\333\255\323\355\200K\352g\377k\305\252Z=\030\341\357\201nTT6\324\375\177\335\306\371\240\207%.\342\340(\306^\302\376\016\016\007Vs\336\266]\244\037\373w[f\021\305\005\344\250\266\323\2667\005\255\207k\036\243\f\306\310[I\262n\277\331\241\220\211\325d\020w\332\335\3622\335:\223\006T\333\"\210C\242\275L\231\373]w\013\256\t/e\330\023\270\304_\237\030\300{D\375\341\004\320\374\377\227\023\bN\267n\327\251\274\273\003Y\020\25306.\303\351\367Z \362h\352\220\331\253\005V\b+\3240\004 \022\206p\035\221-\2708L<d\365\"#"
+	.string	"\271\246\b\021`N=45P\306t\310\261V<\342\346\213\004\305\261\013b=\311\360y\013v\242\004\005\314At\034\007\242\221\235"
+	.ascii	"7\242\021\254\205\312{\226\247\001\020*r\270E\2144e\346\013\t"
+	.ascii	"\026\255\226\306\3243u\353\b\266K\271P:P\3433+\212]\327\021\376"
+	.ascii	"\367\374\216\243\rPo4B\233'\004\034\301\205\377H\273c\265\345"
+	.ascii	";\276\302\036A;\032\0016\034\247\001\222G\021\240x\r\222~\216"
+	.ascii	"`(\027v\247\235\366R(\217\b\224\325\347u\030l\320\255\224\240"
+	.ascii	"J\327\306;\261\371\302\f\340\300r\016}M!\256\311\313*c\027\355"
+	.ascii	"\330\376\214\363\3469\306N\033\016\311\320\210>\316\016\242n"
+	.ascii	"\310%bT\031\244\374\347S\251\002\262y\313\231\344\240\035\275"
+	.ascii	"\320\023L\251I]\377\260X8\\w\206QC\322\276\226\203\2443\235\006"
+	.ascii	"Xp\225Eh\352\221G\036k\306\206A\303\310\201\233\304\034y$\245"
+	.ascii	"\276\036qM\313\370\262\230\374\001\327\351\343n\f\376Y@\237\261"
+	.ascii	"x\207\224&\031\204MB\305M\317tJ\337oW\2113\211\376\003\211\313"
+	.ascii	"|\253)J\311\n\236\273`\212H\215:I\307\273%\362\350\240h\013?"
+	.ascii	":\2244\351\234\347;3\276r\316\247$)L\336*?\343@\201&\360j\227"
+	.ascii	"\312i\027!\276\370;!\341P\272\026^\203\225\321laD8a\310\034x"
+	.ascii	"dt\221\375\240\363\030Sh\264\227\334m"
+	.string	"\201`\001@\031\272\224\020\352\311\221\b>\344Q\213w+u\356\245?*\270\3406\320+\031b\036\273\225d\347\035o\316\325\343\204\003\034\354]\343\201\202l[u\230\004'("
+	.string	"\245"
+	.string	"\021T@\372\327\235\335\230!>qMxk\303\326\b\204]"
+	.string	"\303x\331\232W\254\355\201\325<\345\017\322\004\315\363\r"
+	.ascii	"gK\206\302\200(\006\356,\263\\!G%\213\021\272\356\324&\032\266"
+	.ascii	"\264\245\273<B\360\036\016\032X\002h4H\200/\346\232\024\325\307"
+	.ascii	"b\344\275@\210u\274b\026\203"
+	.string	"$\017[\0011\207\3078\001\003\263\304\3207m/\245\025\023\260\327b\240\020!A{,\017\314\022\244\324=s\360\210\007\022\016\202*\331C\034&Ns;\214\"!~cp\240\303\323\262\305\020\324\007DK\025\210\b\032\270mp\321x+42\224\"\323\356\027S\201\005\2617\212\311f\370\035\027l\2617\236+\005\354\366\017\\o\336\0174\227\330>\373Q=\026?\267\\\277\240\360\250\320e\257\366|y\307w\311\253\234\362gc\355\372\360z\313=\037\326\022\022\257\354F\273\365\re\216\271\373\373\352\337\213\034*\370\265\177\355\342\3434>\306o\233\374Dq\035\340\237\317h\367\220\356\321\2771\236\2711b\201\362w\205\332\3751[c\317\360\320\237\321\177\232\034Nk\201\333\335\323S\263F\325km\224\233^\342\307]\225\177\346r\206\344\336\233\274\220.\211<\312\031\374\r\337`=-\362E\260\325~\357\371)s\363"
+	.ascii	"\306\377\266]\260\374\342\346\301\036\236\251\271\037\334\310"
+	.ascii	":o6\320\257f\210\345\325kf\2643\230\315\344<\373\340\374\377"
+	.ascii	"-\236\336\241/\274\374\331r0\304\356\334\241\354o\303pR\257\021"
+	.ascii	"\017\337't\007-\355\177{\254N\356\206\377\036\300P\264)\260\253"
+	.ascii	"\357\025T>@_$\337\345\251X<\321\276\263/\306\244\275\270\t\226"
+	.ascii	"\346\2307\210g\226\037\310}G]\002\034\342r\0139\306m\227>\335"
+	.ascii	"f\361w\212\007\363\244\365B\367\254\312\367{\201\313\177r\326"
+	.ascii	"o\261\360\352\260l\017\370A\341\260\241\245s0l\006\"\323\357"
+	.ascii	"\020\257\2343\365\305\213\374\031c\342I\242\253\367\314\361\214"
+	.ascii	"E\246\355\326\335\"\016\324b&\235\246\2538\246\274\342\233|r"
+	.ascii	"|\264\002"
+	.text
+	.section	.gnu.lto_.symtab.45d2f8881dceb048,"e",@progbits
+	.string	"nullFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"nullFilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"pt1FilterInitRC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\001"
+	.string	""
+	.string	"pt1FilterSetTimeConstant"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"pt1FilterGetLastOutput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"pt1FilterApply3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\001"
+	.string	""
+	.string	"pt1FilterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rateLimitFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"rateLimitFilterApply4"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"filterGetNotchQ"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"biquadFilterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"biquadFilterInitNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\001"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"biquadFilterApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"biquadFilterReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"biquadFilterUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"nullFilter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"pt1Filter3Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"pt1Filter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"biquadFilter3Init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"biquadFilter3InitNotch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"biquadFilter3InitLPF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"biquadFilter3Update"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"biquadFilter3UpdateAxis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"biquadFilter3Apply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"biquadFilter3ApplyDF1"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.45d2f8881dceb048,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9377 @@
+	.file	"global_functions.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/common/logic_condition.h"
+	.file 7 "./src/main/common/global_functions.h"
+	.file 8 "./src/main/io/vtx.h"
+	.file 9 "./src/main/drivers/vtx_common.h"
+	.file 10 "./src/main/common/axis.h"
+	.file 11 "./src/main/common/global_functions.c"
+	.file 12 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	global_functions.c.7955657a
+	.weak	global_functions.c.7955657a
+global_functions.c.7955657a:
+	.long	0xa0a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1289
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1132
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1133
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x30
+	.uleb128 0x4
+	.long	0x48
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1134
+	.uleb128 0x8
+	.long	0x41
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1135
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1136
+	.uleb128 0x5
+	.long	.LASF1138
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x67
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1137
+	.uleb128 0x5
+	.long	.LASF1139
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF1140
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x86
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1141
+	.uleb128 0x5
+	.long	.LASF1142
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1143
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1144
+	.uleb128 0x5
+	.long	.LASF1145
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x22
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x41
+	.uleb128 0x5
+	.long	.LASF1146
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x5b
+	.uleb128 0x5
+	.long	.LASF1147
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x7a
+	.uleb128 0x5
+	.long	.LASF1148
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x99
+	.uleb128 0x5
+	.long	.LASF1149
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x6e
+	.uleb128 0x5
+	.long	.LASF1150
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x8d
+	.uleb128 0x5
+	.long	.LASF1151
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xac
+	.uleb128 0x5
+	.long	.LASF1152
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xef
+	.uleb128 0xd
+	.long	0x54
+	.byte	0x4
+	.byte	0x21
+	.long	0x141
+	.uleb128 0x10
+	.long	.LASF1153
+	.value	0xfff
+	.uleb128 0x10
+	.long	.LASF1154
+	.value	0xf000
+	.uleb128 0x10
+	.long	.LASF1155
+	.value	0xfff
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1157
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1158
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x14d
+	.uleb128 0x11
+	.long	0x158
+	.uleb128 0x3
+	.long	0xb8
+	.byte	0
+	.uleb128 0x1e
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x177
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xb8
+	.uleb128 0x16
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x177
+	.byte	0
+	.uleb128 0x4
+	.long	0x141
+	.uleb128 0x7
+	.long	.LASF1174
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1d5
+	.uleb128 0x17
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xef
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1d5
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1d5
+	.byte	0x10
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x1da
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x158
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0xe3
+	.uleb128 0x4
+	.long	0x1d5
+	.uleb128 0x5
+	.long	.LASF1163
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x17c
+	.uleb128 0x8
+	.long	0x1df
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1164
+	.uleb128 0x5
+	.long	.LASF1165
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xfb
+	.uleb128 0x1f
+	.long	.LASF1290
+	.byte	0x7
+	.byte	0x4
+	.long	0x54
+	.byte	0x6
+	.byte	0x38
+	.byte	0xe
+	.long	0x240
+	.uleb128 0x2
+	.long	.LASF1166
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1167
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1168
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1169
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1170
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1172
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1173
+	.byte	0x6
+	.byte	0x40
+	.byte	0x3
+	.long	0x203
+	.uleb128 0x7
+	.long	.LASF1175
+	.byte	0x8
+	.byte	0x6
+	.byte	0x72
+	.long	0x273
+	.uleb128 0x1
+	.long	.LASF1176
+	.byte	0x6
+	.byte	0x73
+	.byte	0x18
+	.long	0x240
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x6
+	.byte	0x74
+	.byte	0xd
+	.long	0xd7
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1178
+	.byte	0x6
+	.byte	0x75
+	.byte	0x3
+	.long	0x24c
+	.uleb128 0xd
+	.long	0x54
+	.byte	0x7
+	.byte	0x1f
+	.long	0x2cd
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1182
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1183
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1189
+	.byte	0xa
+	.byte	0
+	.uleb128 0xd
+	.long	0x54
+	.byte	0x7
+	.byte	0x2d
+	.long	0x303
+	.uleb128 0x2
+	.long	.LASF1190
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1192
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x40
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1197
+	.byte	0x10
+	.byte	0x7
+	.byte	0x37
+	.long	0x351
+	.uleb128 0x1
+	.long	.LASF1198
+	.byte	0x7
+	.byte	0x38
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1199
+	.byte	0x7
+	.byte	0x39
+	.byte	0xc
+	.long	0xbf
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1200
+	.byte	0x7
+	.byte	0x3a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x14
+	.long	0x273
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0x7
+	.byte	0x3c
+	.byte	0xd
+	.long	0xe3
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x3
+	.long	0x303
+	.uleb128 0x8
+	.long	0x351
+	.uleb128 0x7
+	.long	.LASF1204
+	.byte	0xc
+	.byte	0x7
+	.byte	0x3f
+	.long	0x396
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x7
+	.byte	0x40
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1177
+	.byte	0x7
+	.byte	0x41
+	.byte	0x9
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0x7
+	.byte	0x42
+	.byte	0xd
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1206
+	.byte	0x7
+	.byte	0x43
+	.byte	0x3
+	.long	0x362
+	.uleb128 0xc
+	.long	.LASF1207
+	.byte	0x7
+	.byte	0x45
+	.byte	0x11
+	.long	0xfb
+	.uleb128 0x13
+	.long	0x351
+	.long	0x3be
+	.uleb128 0x14
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1208
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x19
+	.long	0x3ae
+	.uleb128 0xc
+	.long	.LASF1209
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x51
+	.long	0x3ae
+	.uleb128 0x13
+	.long	0x30
+	.long	0x3e6
+	.uleb128 0x14
+	.long	0x22
+	.byte	0x9
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1210
+	.byte	0x7
+	.byte	0x4c
+	.byte	0xc
+	.long	0x3d6
+	.uleb128 0x7
+	.long	.LASF1211
+	.byte	0xa
+	.byte	0x8
+	.byte	0x25
+	.long	0x44d
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x8
+	.byte	0x26
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x8
+	.byte	0x27
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0x8
+	.byte	0x28
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0x8
+	.byte	0x29
+	.byte	0xe
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xd
+	.long	0xe3
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.long	0xef
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1218
+	.byte	0x8
+	.byte	0x2c
+	.byte	0x3
+	.long	0x3f2
+	.uleb128 0xc
+	.long	.LASF1219
+	.byte	0x8
+	.byte	0x2e
+	.byte	0x1c
+	.long	0x44d
+	.uleb128 0xd
+	.long	0x54
+	.byte	0x9
+	.byte	0x37
+	.long	0x495
+	.uleb128 0x2
+	.long	.LASF1220
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1221
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1222
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1223
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1225
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1226
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x3
+	.long	0x465
+	.uleb128 0x7
+	.long	.LASF1227
+	.byte	0x20
+	.byte	0x9
+	.byte	0x43
+	.long	0x4fc
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0x9
+	.byte	0x44
+	.byte	0xd
+	.long	0xe3
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0xe3
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x9
+	.byte	0x46
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x9
+	.byte	0x47
+	.byte	0xc
+	.long	0x4fc
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1232
+	.byte	0x9
+	.byte	0x48
+	.byte	0xc
+	.long	0x4fc
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1233
+	.byte	0x9
+	.byte	0x49
+	.byte	0xc
+	.long	0x4fc
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x5
+	.long	.LASF1234
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x3
+	.long	0x4a1
+	.uleb128 0x7
+	.long	.LASF1235
+	.byte	0x30
+	.byte	0x9
+	.byte	0x4c
+	.long	0x58f
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x9
+	.long	0x30
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x9
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1236
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x9
+	.long	0x30
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1237
+	.byte	0x9
+	.byte	0x50
+	.byte	0x9
+	.long	0x30
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1238
+	.byte	0x9
+	.byte	0x51
+	.byte	0x9
+	.long	0x30
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1239
+	.byte	0x9
+	.byte	0x52
+	.byte	0xa
+	.long	0x41
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1240
+	.byte	0x9
+	.byte	0x53
+	.byte	0x12
+	.long	0x3c
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1241
+	.byte	0x9
+	.byte	0x54
+	.byte	0x12
+	.long	0x3c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1242
+	.byte	0x9
+	.byte	0x55
+	.byte	0xa
+	.long	0x41
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1243
+	.byte	0x9
+	.byte	0x56
+	.byte	0x3
+	.long	0x50d
+	.uleb128 0x7
+	.long	.LASF1244
+	.byte	0x30
+	.byte	0x9
+	.byte	0x58
+	.long	0x5f6
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0x9
+	.byte	0x59
+	.byte	0x26
+	.long	0x6a9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x501
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xd
+	.long	0xe3
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x9
+	.byte	0x5e
+	.byte	0xd
+	.long	0xe3
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1237
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1247
+	.byte	0x9
+	.byte	0x60
+	.byte	0xd
+	.long	0xe3
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1248
+	.byte	0x60
+	.byte	0x9
+	.byte	0x67
+	.long	0x69f
+	.uleb128 0x1
+	.long	.LASF1249
+	.byte	0x9
+	.byte	0x68
+	.byte	0xc
+	.long	0x6d4
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1250
+	.byte	0x9
+	.byte	0x69
+	.byte	0x14
+	.long	0x6ed
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1251
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xb
+	.long	0x708
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1252
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xc
+	.long	0x722
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1253
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xc
+	.long	0x737
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1254
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xc
+	.long	0x737
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1255
+	.byte	0x9
+	.byte	0x70
+	.byte	0xb
+	.long	0x755
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1256
+	.byte	0x9
+	.byte	0x71
+	.byte	0xb
+	.long	0x76e
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1257
+	.byte	0x9
+	.byte	0x72
+	.byte	0xb
+	.long	0x76e
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0x9
+	.byte	0x73
+	.byte	0xb
+	.long	0x78c
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x9
+	.byte	0x75
+	.byte	0xb
+	.long	0x7aa
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1260
+	.byte	0x9
+	.byte	0x76
+	.byte	0xb
+	.long	0x7c8
+	.byte	0x58
+	.byte	0
+	.uleb128 0x8
+	.long	0x5f6
+	.uleb128 0x4
+	.long	0x69f
+	.uleb128 0x8
+	.long	0x6a4
+	.uleb128 0x5
+	.long	.LASF1261
+	.byte	0x9
+	.byte	0x61
+	.byte	0x3
+	.long	0x59b
+	.uleb128 0x8
+	.long	0x6ae
+	.uleb128 0x11
+	.long	0x6cf
+	.uleb128 0x3
+	.long	0x6cf
+	.uleb128 0x3
+	.long	0x1f7
+	.byte	0
+	.uleb128 0x4
+	.long	0x6ae
+	.uleb128 0x4
+	.long	0x6bf
+	.uleb128 0x9
+	.long	0x495
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x6e8
+	.byte	0
+	.uleb128 0x4
+	.long	0x6ba
+	.uleb128 0x4
+	.long	0x6d9
+	.uleb128 0x9
+	.long	0x701
+	.long	0x701
+	.uleb128 0x3
+	.long	0x6e8
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1262
+	.uleb128 0x4
+	.long	0x6f2
+	.uleb128 0x11
+	.long	0x722
+	.uleb128 0x3
+	.long	0x6cf
+	.uleb128 0x3
+	.long	0xe3
+	.uleb128 0x3
+	.long	0xe3
+	.byte	0
+	.uleb128 0x4
+	.long	0x70d
+	.uleb128 0x11
+	.long	0x737
+	.uleb128 0x3
+	.long	0x6cf
+	.uleb128 0x3
+	.long	0xe3
+	.byte	0
+	.uleb128 0x4
+	.long	0x727
+	.uleb128 0x9
+	.long	0x701
+	.long	0x755
+	.uleb128 0x3
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x1d5
+	.uleb128 0x3
+	.long	0x1d5
+	.byte	0
+	.uleb128 0x4
+	.long	0x73c
+	.uleb128 0x9
+	.long	0x701
+	.long	0x76e
+	.uleb128 0x3
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x1d5
+	.byte	0
+	.uleb128 0x4
+	.long	0x75a
+	.uleb128 0x9
+	.long	0x701
+	.long	0x787
+	.uleb128 0x3
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x787
+	.byte	0
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0x773
+	.uleb128 0x9
+	.long	0x701
+	.long	0x7aa
+	.uleb128 0x3
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x1d5
+	.uleb128 0x3
+	.long	0x787
+	.byte	0
+	.uleb128 0x4
+	.long	0x791
+	.uleb128 0x9
+	.long	0x701
+	.long	0x7c3
+	.uleb128 0x3
+	.long	0x6e8
+	.uleb128 0x3
+	.long	0x7c3
+	.byte	0
+	.uleb128 0x4
+	.long	0x58f
+	.uleb128 0x4
+	.long	0x7af
+	.uleb128 0xd
+	.long	0x54
+	.byte	0xa
+	.byte	0x1d
+	.long	0x7eb
+	.uleb128 0x2
+	.long	.LASF1263
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1264
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1265
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.long	0x3be
+	.byte	0x29
+	.byte	0x4d
+	.uleb128 0x12
+	.long	0x3ca
+	.byte	0x29
+	.byte	0x7e
+	.uleb128 0xc
+	.long	.LASF1266
+	.byte	0xb
+	.byte	0x29
+	.byte	0xb6
+	.long	0x1eb
+	.uleb128 0x20
+	.long	0x7f9
+	.byte	0xe3
+	.uleb128 0x12
+	.long	0x3a2
+	.byte	0x2b
+	.byte	0xb
+	.uleb128 0x13
+	.long	0x396
+	.long	0x822
+	.uleb128 0x14
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1291
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x18
+	.long	0x812
+	.uleb128 0x12
+	.long	0x3e6
+	.byte	0x2d
+	.byte	0x6
+	.uleb128 0xe
+	.long	.LASF1267
+	.byte	0xc
+	.byte	0x88
+	.byte	0x7
+	.long	0x1f0
+	.long	0x855
+	.uleb128 0x3
+	.long	0x1f0
+	.uleb128 0x3
+	.long	0x1f0
+	.uleb128 0x3
+	.long	0x1f0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1268
+	.byte	0xc
+	.byte	0x87
+	.byte	0x5
+	.long	0x30
+	.long	0x875
+	.uleb128 0x3
+	.long	0x30
+	.uleb128 0x3
+	.long	0x30
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1269
+	.byte	0x9
+	.byte	0x8d
+	.byte	0x5
+	.long	0x701
+	.long	0x890
+	.uleb128 0x3
+	.long	0x6cf
+	.uleb128 0x3
+	.long	0x890
+	.byte	0
+	.uleb128 0x4
+	.long	0x501
+	.uleb128 0x22
+	.long	.LASF1292
+	.byte	0x9
+	.byte	0x80
+	.byte	0xe
+	.long	0x6cf
+	.uleb128 0xe
+	.long	.LASF1270
+	.byte	0x6
+	.byte	0x89
+	.byte	0x5
+	.long	0x30
+	.long	0x8bc
+	.uleb128 0x3
+	.long	0x240
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1271
+	.byte	0x6
+	.byte	0x8b
+	.byte	0x5
+	.long	0x30
+	.long	0x8d2
+	.uleb128 0x3
+	.long	0xbf
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1274
+	.byte	0xa1
+	.byte	0x9
+	.long	0xcb
+	.long	0x905
+	.uleb128 0xa
+	.long	.LASF1272
+	.byte	0xb
+	.byte	0xa1
+	.byte	0x26
+	.long	0x905
+	.uleb128 0xa
+	.long	.LASF1273
+	.byte	0xb
+	.byte	0xa1
+	.byte	0x39
+	.long	0xe3
+	.uleb128 0xb
+	.long	.LASF1278
+	.byte	0xa2
+	.byte	0xd
+	.long	0xcb
+	.byte	0
+	.uleb128 0x4
+	.long	0xcb
+	.uleb128 0x18
+	.long	.LASF1275
+	.byte	0x99
+	.byte	0x7
+	.long	0x1f0
+	.long	0x926
+	.uleb128 0xa
+	.long	.LASF1276
+	.byte	0xb
+	.byte	0x99
+	.byte	0x1e
+	.long	0x1f0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1279
+	.byte	0x8e
+	.long	0x948
+	.uleb128 0xa
+	.long	.LASF1277
+	.byte	0xb
+	.byte	0x8e
+	.byte	0x29
+	.long	0x1f7
+	.uleb128 0xf
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x94
+	.byte	0x12
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1280
+	.byte	0x3f
+	.long	0x9a6
+	.uleb128 0xa
+	.long	.LASF1281
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x24
+	.long	0xbf
+	.uleb128 0xf
+	.uleb128 0xb
+	.long	.LASF1282
+	.byte	0x43
+	.byte	0x13
+	.long	0x37
+	.uleb128 0xb
+	.long	.LASF1283
+	.byte	0x44
+	.byte	0x13
+	.long	0x37
+	.uleb128 0x1a
+	.long	0x986
+	.uleb128 0xb
+	.long	.LASF1284
+	.byte	0x5f
+	.byte	0x2b
+	.long	0x501
+	.byte	0
+	.uleb128 0x1a
+	.long	0x997
+	.uleb128 0xb
+	.long	.LASF1284
+	.byte	0x67
+	.byte	0x2b
+	.long	0x501
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.long	.LASF1284
+	.byte	0x6f
+	.byte	0x2b
+	.long	0x501
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1285
+	.byte	0x2f
+	.long	0x9d5
+	.uleb128 0xa
+	.long	.LASF1286
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x32
+	.long	0x9d5
+	.uleb128 0xf
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x31
+	.byte	0xe
+	.long	0x30
+	.uleb128 0xf
+	.uleb128 0xb
+	.long	.LASF1287
+	.byte	0x32
+	.byte	0x27
+	.long	0x35d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x351
+	.uleb128 0x23
+	.long	.LASF1293
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xf3
+	.long	0x9e6
+	.uleb128 0x4
+	.long	0x44d
+	.uleb128 0x24
+	.long	.LASF1294
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x95
+	.long	0xa08
+	.long	0xa08
+	.uleb128 0xa
+	.long	.LASF1288
+	.byte	0x7
+	.byte	0x4b
+	.byte	0xa9
+	.long	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x35d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xe
+	.file 15 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.file 30 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF656
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF661
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF724
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 36 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.file 38 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.file 39 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 40 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 41 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1103
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.23.96c4afc0737b13234a3b55c02753565a,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF611
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF723
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF845
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF846
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF865
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF893
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.global_functions.h.29.fb1af0cee01f455e1be8fe7fa6b2a019,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1107
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1128
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1131
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1295
+	.long	.LASF1296
+	.long	.LASF1297
+	.long	.LASF1298
+	.long	.LASF1299
+	.long	.LASF1300
+	.long	.LASF1301
+	.long	.LASF1302
+	.long	.LASF1303
+	.long	.LASF1304
+	.long	.LASF1305
+	.long	.LASF1306
+	.long	.LASF1307
+	.long	.LASF1308
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1309
+	.byte	0xa
+	.long	.LASF1310
+	.byte	0xa
+	.long	.LASF1311
+	.byte	0xa
+	.long	.LASF1312
+	.byte	0x3
+	.long	.LASF1313
+	.byte	0x2
+	.long	.LASF1314
+	.byte	0x2
+	.long	.LASF1315
+	.byte	0x2
+	.long	.LASF1316
+	.byte	0x5
+	.long	.LASF1317
+	.byte	0x4
+	.long	.LASF1318
+	.byte	0x2
+	.long	.LASF1319
+	.byte	0x2
+	.long	.LASF1320
+	.byte	0x2
+	.long	.LASF1321
+	.byte	0xd
+	.long	.LASF1322
+	.byte	0x3
+	.long	.LASF1323
+	.byte	0xd
+	.long	.LASF1324
+	.byte	0xa
+	.long	.LASF1325
+	.byte	0xd
+	.long	.LASF1326
+	.byte	0xd
+	.long	.LASF1327
+	.byte	0xa
+	.long	.LASF1328
+	.byte	0xa
+	.long	.LASF1329
+	.byte	0xc
+	.long	.LASF1330
+	.byte	0xa
+	.long	.LASF1331
+	.byte	0xb
+	.long	.LASF1332
+	.byte	0xb
+	.long	.LASF1333
+	.byte	0xe
+	.long	.LASF1334
+	.byte	0x9
+	.long	.LASF1335
+	.byte	0x9
+	.long	.LASF1336
+	.byte	0xd
+	.long	.LASF1337
+	.byte	0xe
+	.long	.LASF1337
+	.byte	0xd
+	.long	.LASF1338
+	.byte	0xa
+	.long	.LASF1339
+	.byte	0xa
+	.long	.LASF1340
+	.byte	0xa
+	.long	.LASF1341
+	.byte	0xe
+	.long	.LASF1342
+	.byte	0x1
+	.long	.LASF1343
+	.byte	0x3
+	.long	.LASF1344
+	.byte	0x2
+	.long	.LASF1345
+	.byte	0x8
+	.long	.LASF1346
+	.byte	0x7
+	.long	.LASF1347
+	.byte	0x6
+	.long	.LASF1348
+	.byte	0x7
+	.long	.LASF1349
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1109:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF669:
+	.string	"INT32_MAX (2147483647)"
+.LASF972:
+	.string	"USE_1WIRE_DS2482 "
+.LASF808:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF611:
+	.string	"__STD_TYPE typedef"
+.LASF1020:
+	.string	"USE_CLI_BATCH "
+.LASF967:
+	.string	"USE_OPFLOW "
+.LASF1146:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1228:
+	.string	"bandCount"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF887:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF939:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF873:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1222:
+	.string	"VTXDEV_SMARTAUDIO"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1010:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1031:
+	.string	"USE_UART1 "
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF799:
+	.string	"PG_CF_END 56"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF944:
+	.string	"USE_GPS "
+.LASF912:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF801:
+	.string	"PG_INAV_START 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1233:
+	.string	"powerNames"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF902:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF999:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1208:
+	.string	"globalFunctions_SystemArray"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1054:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF762:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF484:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF644:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1123:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF715:
+	.string	"INT16_C(c) c"
+.LASF1148:
+	.string	"int32_t"
+.LASF374:
+	.string	"__unix 1"
+.LASF933:
+	.string	"USE_I2C_PULLUP "
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1127:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF724:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1147:
+	.string	"int16_t"
+.LASF952:
+	.string	"USE_PITOT "
+.LASF981:
+	.string	"USE_TELEMETRY_SIM "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1286:
+	.string	"instance"
+.LASF865:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1195:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_YAW"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1037:
+	.string	"USE_UART7 "
+.LASF1046:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF759:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1097:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF947:
+	.string	"USE_TELEMETRY "
+.LASF1115:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF1241:
+	.string	"channelName"
+.LASF1182:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_POWER_LEVEL"
+.LASF906:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF631:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF760:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1181:
+	.string	"GLOBAL_FUNCTION_ACTION_SWAP_ROLL_YAW"
+.LASF656:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF694:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1126:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF471:
+	.string	"__P(args) args"
+.LASF1090:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF739:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF993:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF624:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1271:
+	.string	"logicConditionGetValue"
+.LASF1005:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1269:
+	.string	"vtxCommonGetDeviceCapability"
+.LASF864:
+	.string	"__need_wchar_t"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1077:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1064:
+	.string	"USE_VCP"
+.LASF1176:
+	.string	"type"
+.LASF698:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF841:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF777:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1112:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF1169:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_FLIGHT_MODE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF663:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF608:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF903:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF932:
+	.string	"I2C2_OVERCLOCK false"
+.LASF756:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF1225:
+	.string	"VTXDEV_UNKNOWN"
+.LASF883:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1211:
+	.string	"vtxSettingsConfig_s"
+.LASF897:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF672:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF693:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF920:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1166:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_VALUE"
+.LASF845:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF689:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1260:
+	.string	"getOsdInfo"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1116:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF776:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF770:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1073:
+	.string	"U_ID_1 1"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF769:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1066:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF710:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF1052:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF964:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF633:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF1004:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF938:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF665:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF743:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1197:
+	.string	"globalFunction_s"
+.LASF1144:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1114:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF1154:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF914:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1275:
+	.string	"getThrottleScale"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF745:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF840:
+	.string	"_PTRDIFF_T_ "
+.LASF565:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1223:
+	.string	"VTXDEV_TRAMP"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1259:
+	.string	"getPower"
+.LASF872:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1044:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF892:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF653:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF638:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF816:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF700:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1133:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1161:
+	.string	"copy"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF751:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1049:
+	.string	"USE_DASHBOARD"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF899:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1155:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1294:
+	.string	"globalFunctions"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF758:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF707:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1089:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1248:
+	.string	"vtxVTable_s"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1191:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE_SCALE"
+.LASF1224:
+	.string	"VTXDEV_FFPV"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF614:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1258:
+	.string	"getFrequency"
+.LASF594:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF1270:
+	.string	"logicConditionGetOperandValue"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF749:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1130:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1137:
+	.string	"signed char"
+.LASF1103:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF740:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1149:
+	.string	"uint8_t"
+.LASF629:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1002:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1075:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1038:
+	.string	"USE_UART8 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF613:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1200:
+	.string	"action"
+.LASF937:
+	.string	"USE_SERIALRX_SBUS "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF782:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1254:
+	.string	"setPitMode"
+.LASF855:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1253:
+	.string	"setPowerByIndex"
+.LASF1255:
+	.string	"getBandAndChannel"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF795:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1059:
+	.string	"USE_1WIRE_DS2482"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1231:
+	.string	"bandNames"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF685:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF913:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1220:
+	.string	"VTXDEV_UNSUPPORTED"
+.LASF1256:
+	.string	"getPowerIndex"
+.LASF786:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1156:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF948:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1086:
+	.string	"NOINLINE "
+.LASF1168:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_FLIGHT"
+.LASF1079:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1118:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF1237:
+	.string	"powerIndex"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF957:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF664:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1262:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF688:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF584:
+	.string	"NULL"
+.LASF1177:
+	.string	"value"
+.LASF1030:
+	.string	"USE_BARO "
+.LASF936:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF640:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1268:
+	.string	"constrain"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF680:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1232:
+	.string	"channelNames"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF678:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1083:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF563:
+	.string	"__need_size_t "
+.LASF974:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF601:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1216:
+	.string	"lowPowerDisarm"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1175:
+	.string	"logicOperand_s"
+.LASF1178:
+	.string	"logicOperand_t"
+.LASF1107:
+	.string	"GLOBAL_FUNCTION_FLAG(mask) (globalFunctionsFlags & (mask))"
+.LASF1142:
+	.string	"__uint16_t"
+.LASF876:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1045:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF1099:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF655:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF973:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1278:
+	.string	"outputValue"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1110:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF869:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF888:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF927:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF691:
+	.string	"INT_FAST8_MAX (127)"
+.LASF679:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1202:
+	.string	"flags"
+.LASF1104:
+	.string	"MAX_GLOBAL_FUNCTIONS 8"
+.LASF606:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF612:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF720:
+	.string	"UINT32_C(c) c ## U"
+.LASF699:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF670:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1264:
+	.string	"FD_PITCH"
+.LASF821:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1106:
+	.string	"GLOBAL_FUNCTION_FLAG_ENABLE(mask) (globalFunctionsFlags |= (mask))"
+.LASF1085:
+	.string	"FAST_CODE "
+.LASF709:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF813:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1226:
+	.string	"vtxDevType_e"
+.LASF982:
+	.string	"USE_FRSKYOSD "
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF1009:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF905:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1184:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_PITCH"
+.LASF761:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF654:
+	.string	"_BITS_TIME64_H 1"
+.LASF788:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF617:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF859:
+	.string	"__INT_WCHAR_T_H "
+.LASF940:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF812:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF602:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1284:
+	.string	"vtxDeviceCapability"
+.LASF961:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF647:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1058:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF935:
+	.string	"USE_SERIAL_RX "
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1242:
+	.string	"powerIndexLetter"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1131:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF687:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF649:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF639:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1017:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1042:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1283:
+	.string	"previousValue"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF954:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF726:
+	.string	"bool _Bool"
+.LASF875:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1139:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF924:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1266:
+	.string	"globalFunctions_Registry"
+.LASF854:
+	.string	"_BSD_WCHAR_T_ "
+.LASF650:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF959:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF696:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF928:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1205:
+	.string	"active"
+.LASF989:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1153:
+	.string	"PGR_PGN_MASK"
+.LASF1003:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF742:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF884:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF916:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF921:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF697:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF628:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1285:
+	.string	"pgResetFn_globalFunctions"
+.LASF690:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF729:
+	.string	"__bool_true_false_are_defined 1"
+.LASF870:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1047:
+	.string	"USE_USB_MSC"
+.LASF1074:
+	.string	"U_ID_2 2"
+.LASF976:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1274:
+	.string	"getRcCommandOverride"
+.LASF586:
+	.string	"__need_NULL"
+.LASF910:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1250:
+	.string	"getDeviceType"
+.LASF802:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF1095:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF771:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF893:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF966:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF607:
+	.string	"__SLONG32_TYPE int"
+.LASF712:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF992:
+	.string	"USE_CMS "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1180:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE_SCALE"
+.LASF891:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF661:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1230:
+	.string	"powerCount"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF984:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1196:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1145:
+	.string	"__uint64_t"
+.LASF1217:
+	.string	"maxPowerOverride"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF703:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF630:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1281:
+	.string	"functionId"
+.LASF596:
+	.string	"_BITS_TYPES_H 1"
+.LASF671:
+	.string	"UINT8_MAX (255)"
+.LASF708:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF1024:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1198:
+	.string	"enabled"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1160:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1080:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1213:
+	.string	"channel"
+.LASF832:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF949:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF668:
+	.string	"INT16_MAX (32767)"
+.LASF1277:
+	.string	"currentTimeUs"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1235:
+	.string	"vtxDeviceOsdInfo_s"
+.LASF23:
+	.string	"_LP64 1"
+.LASF868:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1243:
+	.string	"vtxDeviceOsdInfo_t"
+.LASF564:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF659:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1008:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF783:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1265:
+	.string	"FD_YAW"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF889:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1249:
+	.string	"process"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1194:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_PITCH"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF866:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF828:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF830:
+	.string	"PG_ID_INVALID 0"
+.LASF1039:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF842:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF753:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1015:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF798:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF837:
+	.string	"_T_PTRDIFF_ "
+.LASF1028:
+	.string	"USE_FAKE_GPS "
+.LASF750:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF820:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF660:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF833:
+	.string	"_STDDEF_H "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF945:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF648:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF950:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF778:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF850:
+	.string	"_T_WCHAR_ "
+.LASF1212:
+	.string	"band"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF1215:
+	.string	"pitModeChan"
+.LASF1076:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF746:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1240:
+	.string	"bandName"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF583:
+	.string	"__need_size_t"
+.LASF1267:
+	.string	"constrainf"
+.LASF825:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF1056:
+	.string	"USE_PITOT_MS4525"
+.LASF971:
+	.string	"USE_1WIRE "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF764:
+	.string	"PG_CF_START 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF847:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF595:
+	.string	"_STDINT_H 1"
+.LASF895:
+	.string	"FAST_MATH "
+.LASF1121:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF755:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1021:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF702:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF852:
+	.string	"__WCHAR_T "
+.LASF1172:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_LAST"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1007:
+	.string	"USE_SERIALRX_XBUS "
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF752:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF901:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1199:
+	.string	"conditionId"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1067:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1279:
+	.string	"globalFunctionsUpdateTask"
+.LASF461:
+	.string	"__PMT"
+.LASF1027:
+	.string	"USE_FAKE_MAG "
+.LASF1239:
+	.string	"bandLetter"
+.LASF797:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF904:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF634:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF603:
+	.string	"__SQUAD_TYPE long int"
+.LASF1236:
+	.string	"frequency"
+.LASF610:
+	.string	"__U64_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1092:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF835:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1102:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF593:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF747:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1136:
+	.string	"unsigned int"
+.LASF658:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF734:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1033:
+	.string	"USE_UART3 "
+.LASF1057:
+	.string	"USE_PITOT_ADC"
+.LASF763:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF827:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1247:
+	.string	"pitMode"
+.LASF1207:
+	.string	"globalFunctionsFlags"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF725:
+	.string	"_STDBOOL_H "
+.LASF861:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1170:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_LC"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF641:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF600:
+	.string	"__U32_TYPE unsigned int"
+.LASF909:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1210:
+	.string	"globalFunctionValues"
+.LASF838:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF881:
+	.string	"BIT(x) (1 << (x))"
+.LASF836:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1152:
+	.string	"pgn_t"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF1280:
+	.string	"globalFunctionsProcess"
+.LASF682:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF637:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF675:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1070:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1174:
+	.string	"pgRegistry_s"
+.LASF1163:
+	.string	"pgRegistry_t"
+.LASF823:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF956:
+	.string	"USE_GYRO_KALMAN "
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1094:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1234:
+	.string	"vtxDeviceCapability_t"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF714:
+	.string	"INT8_C(c) c"
+.LASF727:
+	.string	"true 1"
+.LASF844:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF652:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF616:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1252:
+	.string	"setBandAndChannel"
+.LASF1219:
+	.string	"vtxSettingsConfig_System"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF794:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF894:
+	.string	"sq(x) ((x)*(x))"
+.LASF623:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1204:
+	.string	"globalFunctionState_s"
+.LASF1206:
+	.string	"globalFunctionState_t"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF918:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF1135:
+	.string	"unsigned char"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1261:
+	.string	"vtxDevice_t"
+.LASF822:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF987:
+	.string	"USE_ANTIGRAVITY "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF995:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF926:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF849:
+	.string	"_WCHAR_T "
+.LASF871:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1192:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_SWAP_ROLL_YAW"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1026:
+	.string	"USE_FAKE_BARO "
+.LASF1171:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_GVAR"
+.LASF843:
+	.string	"_GCC_PTRDIFF_T "
+.LASF946:
+	.string	"USE_NAV "
+.LASF980:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1134:
+	.string	"char"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1120:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF857:
+	.string	"_WCHAR_T_H "
+.LASF1119:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF1214:
+	.string	"power"
+.LASF590:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF592:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF988:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1282:
+	.string	"conditionValue"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF754:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF804:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1159:
+	.string	"size"
+.LASF625:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF774:
+	.string	"PG_PID_PROFILE 14"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF741:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF958:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF834:
+	.string	"_STDDEF_H_ "
+.LASF911:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF1001:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1105:
+	.string	"GLOBAL_FUNCTION_FLAG_DISABLE(mask) (globalFunctionsFlags &= ~(mask))"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1276:
+	.string	"globalThrottleScale"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1287:
+	.string	"_reset_template_50"
+.LASF705:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1100:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1011:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF810:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF969:
+	.string	"USE_OPFLOW_MSP "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF917:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF811:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1157:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF860:
+	.string	"_GCC_WCHAR_T "
+.LASF1244:
+	.string	"vtxDevice_s"
+.LASF1108:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF686:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF692:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF867:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF925:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF898:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1138:
+	.string	"__int8_t"
+.LASF930:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF662:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF632:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF994:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1186:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE"
+.LASF1263:
+	.string	"FD_ROLL"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF951:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF383:
+	.string	"SITL 1"
+.LASF886:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF784:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1091:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1150:
+	.string	"uint16_t"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF839:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF986:
+	.string	"USE_D_BOOST "
+.LASF683:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1132:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1023:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1257:
+	.string	"getPitMode"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF796:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF809:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF831:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF716:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF721:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1035:
+	.string	"USE_UART5 "
+.LASF757:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF978:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1292:
+	.string	"vtxCommonDevice"
+.LASF1291:
+	.string	"globalFunctionsStates"
+.LASF1129:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF1084:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF582:
+	.string	"__size_t "
+.LASF856:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF977:
+	.string	"USE_DASHBOARD "
+.LASF1117:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF985:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF800:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1082:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF609:
+	.string	"__S64_TYPE long int"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF1018:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF908:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF723:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1096:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF706:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF737:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF851:
+	.string	"_T_WCHAR "
+.LASF1273:
+	.string	"axis"
+.LASF599:
+	.string	"__S32_TYPE int"
+.LASF1113:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF673:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF772:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1140:
+	.string	"__int16_t"
+.LASF991:
+	.string	"USE_STATS "
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF626:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF968:
+	.string	"USE_OPFLOW_CXOF "
+.LASF711:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF393:
+	.string	"_STRING_H 1"
+.LASF1012:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1016:
+	.string	"USE_VTX_TRAMP "
+.LASF657:
+	.string	"_BITS_WCHAR_H 1"
+.LASF941:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF717:
+	.string	"INT64_C(c) c ## L"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF792:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF789:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF853:
+	.string	"_WCHAR_T_ "
+.LASF923:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1098:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF962:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1069:
+	.string	"USE_ITCM_RAM"
+.LASF874:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF803:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1179:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_ARMING_SAFETY"
+.LASF1014:
+	.string	"USE_VTX_CONTROL "
+.LASF1068:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1201:
+	.string	"withValue"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF915:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF732:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1111:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF1251:
+	.string	"isReady"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1190:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_ARMING_SAFETY"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF744:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF643:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1036:
+	.string	"USE_UART6 "
+.LASF1025:
+	.string	"USE_IMU_FAKE "
+.LASF817:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF970:
+	.string	"USE_PITOT_MS4525 "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1088:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF636:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF738:
+	.string	"EXTENDED_FASTRAM "
+.LASF931:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1162:
+	.string	"reset"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1061:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF591:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF1051:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1063:
+	.string	"USE_ADC"
+.LASF790:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF814:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1060:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF785:
+	.string	"PG_GPS_CONFIG 30"
+.LASF695:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF877:
+	.string	"EXPAND_I(x) x"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF829:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF824:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1101:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1141:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF807:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF793:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF779:
+	.string	"PG_SERVO_MIXER 21"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1151:
+	.string	"uint64_t"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1188:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_CHANNEL"
+.LASF942:
+	.string	"USE_64BIT_TIME "
+.LASF667:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF765:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF773:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF965:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF963:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF735:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1218:
+	.string	"vtxSettingsConfig_t"
+.LASF1093:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF604:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1289:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF846:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF919:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF642:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF736:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF979:
+	.string	"USE_OLED_UG2864 "
+.LASF621:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1065:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1081:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1227:
+	.string	"vtxDeviceCapability_s"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF605:
+	.string	"__SWORD_TYPE long int"
+.LASF922:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF848:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF618:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF826:
+	.string	"PG_INAV_END 1023"
+.LASF704:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF701:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1203:
+	.string	"globalFunction_t"
+.LASF767:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1087:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF862:
+	.string	"__DEFINED_wchar_t "
+.LASF787:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF730:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF719:
+	.string	"UINT16_C(c) c"
+.LASF733:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF728:
+	.string	"false 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF597:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF713:
+	.string	"WINT_MAX (4294967295u)"
+.LASF907:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF674:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1122:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF1071:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF718:
+	.string	"UINT8_C(c) c"
+.LASF1128:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF953:
+	.string	"USE_PITOT_ADC "
+.LASF858:
+	.string	"___int_wchar_t_h "
+.LASF885:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1041:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF975:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF960:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1062:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF635:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF666:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF615:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1173:
+	.string	"logicOperandType_e"
+.LASF818:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1032:
+	.string	"USE_UART2 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1290:
+	.string	"logicOperandType_s"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF863:
+	.string	"_BSD_WCHAR_T_"
+.LASF681:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1246:
+	.string	"capability"
+.LASF1238:
+	.string	"powerMilliwatt"
+.LASF1124:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF1187:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_BAND"
+.LASF1193:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_ROLL"
+.LASF676:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF880:
+	.string	"UNUSED(x) (void)(x)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF900:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF627:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1185:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_YAW"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF780:
+	.string	"PG_IMU_CONFIG 22"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1043:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF619:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1072:
+	.string	"U_ID_0 0"
+.LASF1050:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF620:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1048:
+	.string	"USE_SERVO_SBUS"
+.LASF1000:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF998:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF896:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF819:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF929:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1165:
+	.string	"timeUs_t"
+.LASF1164:
+	.string	"float"
+.LASF1019:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF997:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1272:
+	.string	"command"
+.LASF1158:
+	.string	"pgResetFunc"
+.LASF646:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1040:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1167:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_RC_CHANNEL"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF781:
+	.string	"PG_RX_CONFIG 24"
+.LASF1053:
+	.string	"USE_RANGEFINDER"
+.LASF768:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1006:
+	.string	"USE_SERIALRX_SUMH "
+.LASF766:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1293:
+	.string	"vtxSettingsConfigMutable"
+.LASF990:
+	.string	"USE_LOG "
+.LASF1229:
+	.string	"channelCount"
+.LASF934:
+	.string	"USE_RX_PPM "
+.LASF1143:
+	.string	"__int32_t"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF943:
+	.string	"USE_BLACKBOX "
+.LASF1288:
+	.string	"_index"
+.LASF890:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF622:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1221:
+	.string	"VTXDEV_RTC6705"
+.LASF1034:
+	.string	"USE_UART4 "
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF878:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1013:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF1245:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF748:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1078:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF806:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF791:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF731:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF775:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1022:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1209:
+	.string	"globalFunctions_CopyArray"
+.LASF882:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF651:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF684:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1189:
+	.string	"GLOBAL_FUNCTION_ACTION_LAST"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF955:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF645:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1125:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF1029:
+	.string	"USE_MAG "
+.LASF722:
+	.string	"INTMAX_C(c) c ## L"
+.LASF996:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF805:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF815:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1055:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF879:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1183:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_ROLL"
+.LASF983:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1330:
+	.string	"long-double.h"
+.LASF1335:
+	.string	"__locale_t.h"
+.LASF1345:
+	.string	"platform.h"
+.LASF1317:
+	.string	"vtx_common.h"
+.LASF1347:
+	.string	"target.h"
+.LASF1324:
+	.string	"libc-header-start.h"
+.LASF1341:
+	.string	"stdbool.h"
+.LASF1306:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1296:
+	.string	"src/main/common"
+.LASF1310:
+	.string	"stdint-intn.h"
+.LASF1318:
+	.string	"axis.h"
+.LASF1305:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1308:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1331:
+	.string	"stubs.h"
+.LASF1300:
+	.string	"src/main/target/SITL"
+.LASF1299:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1304:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1336:
+	.string	"strings.h"
+.LASF1326:
+	.string	"features-time64.h"
+.LASF1309:
+	.string	"types.h"
+.LASF1328:
+	.string	"timesize.h"
+.LASF1298:
+	.string	"src/main/drivers"
+.LASF1307:
+	.string	"/usr/include"
+.LASF1295:
+	.string	"src/main/build"
+.LASF1348:
+	.string	"sanity_check.h"
+.LASF1337:
+	.string	"stdint.h"
+.LASF1325:
+	.string	"features.h"
+.LASF1346:
+	.string	"common.h"
+.LASF1338:
+	.string	"typesizes.h"
+.LASF1334:
+	.string	"locale_t.h"
+.LASF1297:
+	.string	"src/main/config"
+.LASF1339:
+	.string	"time64.h"
+.LASF1311:
+	.string	"stdint-uintn.h"
+.LASF1301:
+	.string	"src/main/target"
+.LASF1344:
+	.string	"utils.h"
+.LASF1302:
+	.string	"src/main"
+.LASF1313:
+	.string	"time.h"
+.LASF1315:
+	.string	"global_functions.h"
+.LASF1340:
+	.string	"wchar.h"
+.LASF1319:
+	.string	"global_functions.c"
+.LASF1303:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1314:
+	.string	"logic_condition.h"
+.LASF1320:
+	.string	"maths.h"
+.LASF1323:
+	.string	"string.h"
+.LASF1329:
+	.string	"cdefs.h"
+.LASF1316:
+	.string	"vtx.h"
+.LASF1342:
+	.string	"build_config.h"
+.LASF1333:
+	.string	"stddef.h"
+.LASF1332:
+	.string	"stubs-64.h"
+.LASF1322:
+	.string	"config_reset.h"
+.LASF0:
+	.string	"./src/main/common/global_functions.c"
+.LASF1327:
+	.string	"wordsize.h"
+.LASF1349:
+	.string	"common_post.h"
+.LASF1312:
+	.string	"parameter_group.h"
+.LASF1321:
+	.string	"stdc-predef.h"
+.LASF1343:
+	.string	"parameter_group_ids.h"
+	.text
+	.section	.gnu.lto_.profile.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\255\004"
+	.string	"D\006\370"
+	.string	"\f"
+	.string	"\373\262\242\210\005\002\002"
+	.string	"\002"
+	.string	"\001\211\305\375\277\007\002\002\001\002\002\002\240\342\234\212\n\003\335\343\351\265\rD\002\003\004\002\005\001\006\004\002\007\004\002\b\002\007\004\005\006\352\263\360\321\b\b\360\231\217\353\017\t\314\304\327\337\002\n\216\206\240\257\013\b\002\t\002\t\t\002\t\013\306\214\331\352\016\f\240\342\234\212\n"
+	.string	"\024"
+	.string	"\253"
+	.ascii	"R8\357\322\nQ\222\251;\2145\276Bl9\024S\021\340%\350\245\304"
+	.ascii	"\344\b\274\020p\025 \227\357%\363L\262\273;\234\313o\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 x\255\001"
+	.string	"\320l"
+	.string	"\006"
+	.string	"\001\001\001"
+	.string	"\003"
+	.string	"\002\003\b\001\001"
+	.string	"\001\t\n\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\013"
+	.string	"\020h\205\b\254P(\004\203\300\326$#\307Ae"
+	.ascii	"0\346%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\"\001\225\t"
+	.string	"\006P75P\305\246\320\001"
+	.string	"\211u\312\343v\347\252\260u.#\361\326\333=\220\326\027\236\031\343\177\261?[l\352^\364M\255\25033\013\354\341\013\377\0331\354I$[\356\024%"
+	.string	"-"
+	.string	")"
+	.string	"71\n\216m\370\023\004t\260\217\031\2062\323\372\356\246\231\231\324{p\323D\244K\377<h\241\211H\325S\027\023&\225\376)`\311\303\307\250\2722\266]pl\3036\253\327\177`\232\336 \006\200\321\005\006\242\024!#\025'b\351}_\326\224"
+	.ascii	"\016$\001\245\314\314X\036\277\364\252^A\316*\303MY]8\201/C\t"
+	.ascii	"\220GF\301\226\177\016v\312\361\001uTWg5\303\rM\024\377__\231"
+	.ascii	"3\232\236|@\241>=! \336\351N\232\273W\363^\007\325\"4\266\373"
+	.ascii	"B't\2039-e6`\002\" @\002B\240\274\016LZPp\345ahCQ\005D_3\\\375"
+	.ascii	"\013\3319/\341\202\205\262\2345\001\"\314\361\200\241\373\221"
+	.ascii	"H\007\026\202\302F.\261a\tJ\026\001\320\303\206\330\250X\013"
+	.ascii	"\361\300\316p\324\365\206\001D\004\n\344\031[\367>\334\332\323"
+	.ascii	"\356\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"E\005"
+	.string	"\022\210\030 \240'\351\377\217m\017z\371\377\027\305~1\363\233UU\205y\273\262\327\266~k\255\355F\232L2\004\324\226Z\363e(X\222\235\342N\365\244)\371Jsw\227\322G\270\177/^1\202\320~\352\237\3524X\223\242\314F\225\205K;E<E\223\305\034Cd\021\020t`\220\354\240E\036\250\035\317\342\211\034"
+	.ascii	"EK\244\233\206\3010\034\220\005\316\267\0256_\221\031\312\370"
+	.ascii	"\240SC\366B\365l@\302L\201q \260T\300\017\363\301\303\013\237"
+	.ascii	"R\006\232\240)V\363\300\230m\253\222\333y\031\216D\227\3317C"
+	.ascii	"*\300\020"
+	.text
+	.section	.gnu.lto_.pureconst.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\001\230\004\003\231\004\b\230\004\t\230\004\n\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 \263\035\003"
+	.string	"r\004\016\030\2605\303\001\340`\017\r\3030\f\303\350\364\246u\255Dd\263\275eJ\001\252n\261-\263Fh\240\036\266\220\314\350i\233\346\310\034m\321\212\272xl\215\255{\002{\004\004\021"
+	.ascii	"U-\336\231\316i\231\232B6\031v\013L\027\baGW\013\263z\303\230"
+	.ascii	"\334\2222\362\322nE\200\216.\be\003X"
+	.text
+	.section	.gnu.lto_.lto.b436cd1434314cc9,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_globalFunctions_Registry.27.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 \241\245\004"
+	.string	"d\bb"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	"\005\001\212\001\202\200\200\374\342\303\254\274\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\334\007us\354\006uq"
+	.string	"\005\001\006'\001\200'\001\374\007?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/common/global_functions.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_globalFunctions.31.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\321\001\225\021"
+	.string	"\246awH\320\360(\035b\037\225W\366\204M\224\024\032\337\311\340\361z7\244_\245\351;\236 \362S\2446\260$RQM\215\302\340\017\016\224\350\006\375Ff\200\035^JP\264If\2410Ih\322\221\216\303\367\274j?![\312\224\002a"
+	.string	"["
+	.string	"e"
+	.ascii	" \2739ID\2737\004N\200\272\347\333C\276{\250\257\276{\226\331"
+	.ascii	"6\b\310\0040\232\321\351\330]PE\030\365x\273c\312\356EM\231\037"
+	.ascii	"t\020\240\230{\361TcC\343\303&\023O\226n|x\356Ic\243e,q"
+	.string	"s}\356!=\270\032+l7\317S\312\356:5\3308\334\337m\307lC\260\237#\376\311R\215\307\232c\247\016\364\237\216\273\343\323\232\351\314\364\001\300\314\b\r\020\332\335\320\304cex.v\216\373\355\257T\260|\235\255Z\371\260\374\233\237\263\352\336\352\207e\333G\361\024\262\343\\\024w\250\201\017\222\322\356\216\334\363\003\324=\221x\225\275\342a=\355\373\374Gv \230\007\270\213\314r\347\003\217\232\322\327@\320\262\311\301\307\202G{\354_>\177\350\202\005\177\204\217\341\273\247:$\017\251'UE\211Q\353\021p\303\370\256\251\257\231\240e\223\243^\027\034\315\364\230e\223?:\340\254\356\250\243\242\031\233;U\241\032\246\026\352\221\037wV\210Y\356\361\004\316I\3300\341\330\334\331\267\230T\035\007\257\273eR\242\240\244\004\305\204\244\200\212\013\326\212\271\300^(\273H\\`\341+\346\202\275L\210\260\322\222\020\256P"
+	.string	"a!\013K\350\002a\257\026\013\350jq\001I\f8\254\240\322\002\306\302\260\005T\335\366\232\343\240\307\035\"&\245\231\322<\325\361\351\205\246T\223r\344Qi\\\364Ee\220\224!w\030\341DM\231\345\356qw7\246\364\001\" p\002)\205\272\003\f\346Pd\370\325\b\235\bT e\025oP\021\035Ndx\214\351[a\241[\221\275\b\033\266\006\bp4Z\307l\017a\b\306\312\233\235\3064\263\304]\317\272ba8'\276o\205\023\026\r\021\356\365\220l\302"
+	.ascii	"\243l\272\304\023"
+	.text
+	.section	.gnu.lto_globalFunctionsProcess.32.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`q\024\255I"
+	.string	":y\260\032@@\244N\007\273\312\240\252\233\036X.\306`\263"
+	.string	"\003\200"
+	.string	"\322\267m\202\276\225\362\0254#\022\207?}"
+	.ascii	"\354\237\026\242\260\016\372G\004V\334C\2656\255\366\354vw\214"
+	.ascii	"\b\212\350F\233\354n2\245\024\227\001s\001\235\001y\220E#\305"
+	.ascii	"\327\270\003\272\253q\337s\247:\333\355K\"l\032\271\\\213\263"
+	.ascii	"\314\021\330\310e\0321\257!\345\fg\246.gi \257\2566Ri\b\215\247"
+	.ascii	"y]\215\f\3179\244\037\346t\261\346,e\342:\373\331\227\332e\373"
+	.ascii	"g\025\265\226\231\212\016\272\335\221\231\212\322q\273\033\323"
+	.ascii	"\316wd\267\007\345jU\302\361\352\251\213i\244\263\3128T\032\314"
+	.ascii	"3\244|\006\227VG\304uV\231\307\253\273\367h\270M\251\3137'jm"
+	.ascii	"\337a\303\363\332\301`\2650\310\356~\231gz\001\356\020\272K\340"
+	.ascii	"\354\362\320\353\337\277\264wq=\033\356\245\253\030\262\331\017"
+	.ascii	"\007pl\317!\204\234m\022\256\263L_j\235%\372\262u\326Ev+\321"
+	.ascii	"x\375w3\330z\375\016G\343\234\335\310\374\345\234\261\272\201"
+	.ascii	"\353l\277\335|\234\320\212\256\317=B9g-\334\304_\247\232\222"
+	.ascii	"\212\202zrjbZRZ*\223\220\216\222FE\310\243\321-\266,\021\377"
+	.ascii	"\333^\224\200\347F\250Z\323\251\246\360^*\212\313C=iy\247&)\317"
+	.ascii	"\264D\347Jtl\240\374\362\311+\223\346\034i.P\356\217\336>Y\224"
+	.ascii	"`\324\346Em\325#\217d\373\243\261j\212\264\310\273\305\347\267"
+	.ascii	"UJ~\3449\313\3149\273\030\264':q\273\333\222%\212\021W\"]\313"
+	.ascii	"qT;k\331B\301hW)\221\346!1\021\201\365\214 \027\343U\204\322"
+	.ascii	"<\342\222\217(P\307\363OSs\376\027%\344\234\373\241j?\274\001"
+	.ascii	"x\3677\273[K\2672A\370\005-8\236\013>\225\3139;\350\302"
+	.string	"/\brv\374N\206\r\034\336\241\034ZgY\354\323\242i\021B.\354Tg6=\021ww\360\360\016\345\302\3143\334l\214\211\230X\347\231\250A\370\034\0218J\024J\037\241\034\214=P\214#\365\330\325\361\215q\037\204\304L\214{tJ\204\320\345\fY\311`\034\327\335%\332\307'\300\3449{C\335=\302\341\224\320\020]\342v\227\363\231\003\017\323}\303\005M\340%9~`\372\356r\316\\n\374\rX;\024g;L\354\035\252\242u\366q\201\271\274\366/\356x\356\322\261\223\026\262\"\003\225\200q%\340\364J\017\272?\216\375\2133\315\376\260\267\260c\367{&2\373k+\331I\013\031\346?\354\326s>\216\353v|\275^\3774^\322\355{\336]N\365\346\362;\367\255\343\267\202\343\267\326\361;\353\370\215u\374\276:~'8~#8~[\265\337\007\376\333\300\177\027p\277\t \277\007\270\337\002\334\357"
+	.ascii	"\355w\325\1773\377\033\200\373M\205\374\236r\277\245\334\357"
+	.ascii	"\250\366\033\352\277\237\376\333\351\277\233\332o&\367{\t\371"
+	.ascii	"\255\344~/\335o\345\361;\351\370\215t\374>:~'\217\337F\307\357"
+	.ascii	"\242\366\033\371\337G\343\267\361\277\335\366\273\350~\267\355"
+	.ascii	"7\373\337\304\3427n\277\377\277\335\203\007\261\272\341\375]"
+	.ascii	"\361\035\275\354\343z(\016U\3020\2208q\263\213R\302\252\373\220"
+	.ascii	"\351\225\325q\347\b\022\307uY\273T\342\026/\327\234\177\355\302"
+	.ascii	"JLD\364D\343\234\"\342\341\311\351\3411\311\n\021\t'MA\nd\374"
+	.ascii	"\003\365\344\324\217{T\367I|D\227t\323X\377\244\253W\205\375"
+	.ascii	"s\357\344\205{\343\336&MZg\243\252PC6\305\300\247'\247\325\326"
+	.ascii	"\b7q\250\241\373;\327\026a#\354\317 \316\207\373%\357\\;\224"
+	.ascii	"~\237\274t/"
+	.string	"]\353l\021\306\302\263\3064\355R\fD\223\262\236\307\271\260OQ\232\342\021\376\231\267[\006\233\217\350(\n\364\215\210\343\372\221\364'1\n\266\365\273\271N?#\375lE\264(\221\376\265\366\032\244_\bkH\255\377\007qO\217~\037\030/\255?\372Yt\364\357\360~hv:\251\313H\320\372s4\0377\347\246\273\265O\265\316\276R~\302\265Ys\316V\357\354n>\356n\256\\\226f\275l\325V\311G>\221\224o\226 \021\265\236\351\276\361\371\212\304Ysf\214K\250\350\375\231\361\016H\212\246Z\b\217v\216\250\253\207\016\375\n\274\213\215\270\373\265\362by\207\036q\3536\210\206\233Z\234\320\313e\020\205\020\321A3\202\002\031\375r\031?ON\355\006\315\376\020\317\377\274]\266\n\273'\270!\205\020Q:\254\373\371\261\272x\013O\237\013\210\212\224L\237'\247T\006Q\330Y\013\031\0261\237\013X{\276"
+	.ascii	"\350i\253P\303\026\027\261?\023\321h\271p\213\333:O5\316\266"
+	.ascii	".\354{,\356\n6b\214\261\030;"
+	.string	"\001\346\002\214\202X\330\330\f\261\n5b\314X\216\241 +\013K\212\311`\001\366\001\206\214\262\261\031b/\\\030\365\212\032b(\310\306L\264\r\366`\313\301\326V\327\203,)\024_\307\016\313\202AV6\026#\214LF\n\023,\300N\224\261P\241EV\326\242EY\230\026\331\030X\013\255\260\0270\264\262\bt\231\013\261\027Z1\312\312^h!\365\314\234\230\361\222\346\3232h\206\235\375f\356\217\210\230s\316T\n\260\240\326\323\302\n\376h\361\275}\237\367c-:\013U\007j\3306\305V\304\223|E\244\262\3660\261pV\036,> Q|jC<I\275B]\025\"%\300Wu\022\024z\032\004\304\223\324@N\b\346\270V\030\301\240\0255N\023UP\352\206i\315\322\201\346\013\2761\200\017\340\342\036\267\200\2015]\365*\f\374\3628r\200\005\260\027\2364J\004\3328\233\001\004\006\374\261\351\262\024\020"
+	.string	"\267X@"
+	.string	"\2747.J\300\244*\347\377\231a\342*\\\254\262\336\325\366\312\0010\373\272\032A\216\357\313\005\013\307"
+	.string	"\300\021\250 Q\255\361\300)\252\251\272@\367!\324\267#\251(\334b\251(j\333\021\357AeK\312 \346\254\304\313\372\345\257FPh\017\346\302V\341{\371/\357s\307\233\226\326>a(\\\024|&\352\372&|\345N>^\265w\350\023f\346\300\315\376\274\256F(|\274/\207\363wN\330\230\207\233pq\317\013\304\253\027\\&\374\324\271<)*\020@\036}E8\356\257\370\022v\302\255w@\257\276D\\\250R\221\227\355\035\272\204\231\013\276\373}{\223|\201\203\250AD\344\230RfFDDD\222$Ica\006\"Rd5\017\022\200\3034Gs,\246 c\"#%\006\225\322\264\006\322\002h\362A\307^;\341"
+	.string	"2\320\370\3236\305c\326I\321\332t\301n%\270n\341\276\274\354\323BC4\271Q\370\362\344\254\r#\271\307\020\224v]\3478\302\340\373W\026D5pO\005j{\366\371\304\344\364Rlhe'\027\3609\224\205P\r\334\253\032\324*\332-% .\314\354y`8\231)\373\275\2631\246"
+	.ascii	"\226\303\\\247.\242hP\013r\271\304c\265\322\254r\345\025\357"
+	.ascii	"\322\336\256\337\256\372\217[[\366\362##\341\246\247l\247\bN"
+	.ascii	"jRcZs\230\224\247\246\363\034\372\320\360\020\025e<3`\274L\252"
+	.ascii	"\231\313\251\331\220\214\274/\363\204\314\371\005Q>\fA\354;\216"
+	.ascii	"b!GW\264h\237\213\230l\216\366o\026\001N\221\224%\241\347\226"
+	.ascii	"\351N\375\357_\301\311\241\037$Qb)tn\205\237\344\222\302\270"
+	.ascii	"`\351\232\177\321\322\307"
+	.ascii	"\221u\023\223\323k\312$\276\263\3728\177"
+	.string	"\026\237AY\020\250\241\370\326%\210\257\260\215\333\221|I3K\321\177\306\001:3\232\206\277O\306\271\201\233\347\213i6B\214fI\0267\264\270\325ZxsEU\251\224f\311\222U\2200oF\026\002M\266\020\350\362\270\320\222\204\361\271n\202\347F\223\220\306y\350\336\260Tp\270\221\356c9I\304\353JI\314W\373\303\345bk\360\274\013\201kza\006\b\213MXP\f\350Q\245\276\rK\267\254K0D\2178\332\305]\376\277,\222\343\300\212\235e\260\207u.\376v\267\275\234\252~\337\363\323o\231#\336\270P\004>\3422\261\023\030v\217\301\263\202\026\272\350\276P\210Zp\231\305\231\004\334\021\020\241#(6a*\031m\021wXP\250P\247R\326qpI\377\203\t\274P\364\217\2043)\202\275,\022\021o3l\332x4SY\304\312z\364c\315gVpZ\335\rj\260K8\210v\002\361U\336"
+	.ascii	"X\235.-\215\323\222z\252\032t\330}\257\305N\370\2432\325w1=X"
+	.ascii	"\236\351\221\037\006=\323\304$o\354\332\005\370\203\241l\373"
+	.ascii	"F`d*\231:B\233\232\033\371Y\263\372(\361 6\bm\337\235\362\274"
+	.ascii	"\005u3W\334\373]s\246 7)\304aj`|\334\347\351B\026\305\013m\202"
+	.ascii	"\273\303\376\242\032"
+	.text
+	.section	.gnu.lto_globalFunctionsUpdateTask.33.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\244\001\225\020"
+	.string	"\326_qH\340\320(\035R\t/u\222\r\362\301\311\374\201\026\360\327o\260\001\364\253z\340\313\b\2175X\0167\017:\330m\363\240E\361\343\205\305\371W\007T\207\030\303\035F\247\351\032\342cs\215\356\210\263\340\332`#\204l\"eJ\001Z"
+	.string	"Z"
+	.string	"["
+	.ascii	"\337\245\307\033\350.\277"
+	.string	"\027\350.\355\262k|\254\231\257\315\270\324\202\346\234\340\216\360wn\2749u]r\253.\177\347\tln\260\230\312%\347\301|\2201 \326\201\003\371\261!s\332\365%\266\242\234\211\230\357io`3\003\026\213\271z!sN+,\006\342\356n[\264m\301\276\212\366\250\242+\263\017\362\323\202\343\245\261\275\317n]\365?\021\211\241 \006@sz\270\rM\037\331\242\304g\277}R\316\311\037}\232G$\235\223mC0\271>K\371&\216g\253\335\334\230stp\351\221\357\362#\233\204s\272\332\317\271\216\353(8\234\300\2344=+\346\034\0378Bsr+\263\355\355g\367xJ\247\353\355[fV\364f\005\266\036\221~\355p\203\036f\017\226U\261\356\367.;\002\330^\354\362\300\344`\261+{J\367\331EB\274T\310\247\235;!\242\347\255\316O\361Z\313\277\361\t\212\036v\351\243t\227\bjp\274\364f"
+	.string	".\324\266\023c\252P\252\033\365a\222`2M\370(\035h\211\220\254T\025LX$\242x\222\022\340T\251\305\nU&)\326\t\206\221\022\324\205\260$\003\310\nW\2530\005\262T\250\025\230\022[`i\201C\r$\"h\022\206\"8\032\347\227\306;\377l0|^\273\"Wf\221\314z+m\364<\327}\241@\203Eu"
+	.string	"m\310K\205\316\315\031\035"
+	.ascii	"AQ\036c\032\366i$\366\342\250[E\345:\333US\020\fa#\254\026\372"
+	.ascii	"\025\261jq\013?zla\035\254\020c\271\220Y\001`1\252\346\255\234"
+	.ascii	"\327\322\325AY\361[I\t\356\305\r\021e/T5\336O\"\235k>\001"
+	.text
+	.section	.gnu.lto_getThrottleScale.34.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\365\f"
+	.string	"\366\230YC\020\221\223\016\360\225\017'\023\275e5)\307zv8\353H"
+	.string	"\336\316\233\"\312\265\357:t\221\241\177{\375\231\266Q\331\022N\006l\0210\201\315A!\016\315\210\275C\247TN\002A\265\032\203(\222\275\245L)H"
+	.string	"@"
+	.string	"E"
+	.string	"\037\021\262U/\365\002\363\030!VN\334\330]\214\300E\254\303\367\020\353P=<\364\247\031\362?L\242?\017\r\327W@&\205\r"
+	.string	"&\225'\302\362\201t\324\263d\032ev\224\354\256\223d\312p\303\333^`;\202\375\006\00106q\330)Qj\007\373o\325\305~\332\372\351\207Ok\2463\323\277FP\227\321b\227e\225c_@\025 \354\247B6\210\035`\003\203\347Q?Y\345k\227\305)fw\r\030\201\307\241m_D\243w\245\035-\344I\226\252\212\f\325\036[\225\030J\007\362/321j\220\225jb\202\206J\3168\017\262\256\251_i\031\345\312>\211\227"
+	.string	"\3710\276\200\222'\035\372(\326\341u\300\214\226\224\\\371\250\177\240\250\021\316H6\t6\033\005$\032\001\234-\323\034p\266\317'v\024\036\204X\323x\270x\362\3218\220\004\b[f\022\267\t\030\027;\235\250a\334I\326\301\264\316\203iF\034+p:\354\023c\207\201\244\366\352rqX\341\"\241ZK\266U]\222\242\001\024"
+	.string	"Kq"
+	.ascii	"\f57\003!\0340\323\031!\023gip\210Y\006\253\266Cw\247aa\360\332"
+	.ascii	"b\017Q\230u\\\030\3031\246OeA\001\324\304\226\253i\f\n\n"
+	.text
+	.section	.gnu.lto_getRcCommandOverride.35.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\035\006% "
+	.string	"\026\270\305K\260\022R:\253\312\353\245+\361i1}\345\242f\264\264\267\231`\245\307C[T\246N\261]\271\222\277\367\352\007~k|\356d;\302!\246\222)\374\302\237\342G\321n\212\f{\343\335+\371\241\006\033\370\326\366lF\032\331D\312$\003\261"
+	.string	"\242"
+	.string	"\260"
+	.string	"\237\261\341g\255(t|\325ZT\260\021\212\345u\344\265vg\247\313\240<\335\335}\326_\020-\220\213SK$\321F\260\206\224Z\353.\367"
+	.string	"\344)_G\236v\212\003\177\346p7[\315\244\315J\031I\307f\340^f3\272\260B\242\304T\364\223\3529\252)\306QE\361mx\333\360WKP\\\033\226`\363\351\264\253%'\236=\021\270Z\"\301%\001\331x`(\004D"
+	.ascii	"#RLL\246 \223G\226\232\222\230\312l\2109\236\234\370\320\364"
+	.ascii	"\321dB\342\2761u\030gj\255\357:\013\231\216\230e6\265\326e%\246"
+	.ascii	"\017_\226\357^\302\356\006\355R\n\001IXG\337 \344\233\373IWG"
+	.ascii	"<\266\272~\217?\202bF<\266\354\025\342H\345*\273\305\"n\342\356"
+	.ascii	"\307Zk\335F\261+\023\003\363\342\322\362\031?\200o\375:\2263"
+	.ascii	"w\256/\216\344\275\221\2746"
+	.string	"\312[#yM\222\227Fyg$oI\362\312(/Iy)\345\035\231\267)/S\336\013\230e\275\030K\260\243V\017cVj\021\332C\305\271\276\273D\373\2565\317)7\347\002\226\365\253\f\022o8\251\265\"8]\236\362\f\273\031ywA\r\321\2674l\327:\234\222S\236\236Fn\230\3671^\274\f\242-k\016\013\212\265\2405q\377u]\367P\304\222Y\023\367\007fE\305d/\375\003\263\"[\372X`DF\227\306\265\220,\311\356+\357:\315\213\005\256m\214\312\227\t8\300\001/Q+Cj\311\226\214\265\212\265V\262\211;N\233\303M\b\325\324\245\317\365\231\0368\300}\325\350\322\034&t\252y=}\324@\352\332v\202F\022$\246r\256\265\026u\217\244\235CC\t\022S\331\361=rl\332\0176\355q<Go_\265>\f|\245\323=\006\362t\354\001I\232H\264\364\271\016\301\204\321od"
+	.ascii	"\032\230\252\332o O[\372aB'\243\006\320\335\017;C><\234\337\020"
+	.ascii	"\320o\310g\n\365d\340\215\313sP\323\240\246\346\201\003\032\001"
+	.ascii	"\026~x2\235\035 \241\031\236 ^\271:4B?\276\236\237\316\317\320"
+	.ascii	"\205\n>\274\034\237\017\317\356\307\327\353\371tv?=\274\336N"
+	.ascii	"'"
+	.string	"HhGc`}@;A\273\237\317\027\2643\213\365\343\355\0342\314\311\364\216\270\263YZ\270\273,\375\300\204Q\037\201\261\2342\267\226\261\365\355l\233\217\234\217C\215\220\302\231\271&\266\230\336\261\226\353\2636S\343q\336b\314\216\241\265\231k\032\214\005\322\301\303\n\333\013D\211\210R\033K\\\277\3533\254 Z4\230\336q\206\353\334,7\313\312\2310e\303\364e]\366\223\240\340\002\200\205\250A\\#\215afFD\202\2024\005I\007\340\"!\242\252\003\0210\2615\b\303\244Y\016\3502|\212\322\310\240c\220%]\0273\251\240DP3:\211\031\222\207w\221{*\222;\023\364\205\022\201J\224\210N\222\267\311o+\334\002\376M\227\3408Y:\322\270\230\202\020\201\330 %\020`\213\213#f\f\336\354\013\020\247\243g{\203S\243\315\212h\302\022\230\260\377\235\222\273#k\b\007>\022\020\200\260\236\240@"
+	.string	"0\305L6\032\2132\231\314\304\363\304\r\241\334\007\f\003\2307\237w\251e\323\n\032G\266\035\310v\277\200\342a\240\030R\032;]\030\022vE\277\341\370\215~\370>\303\345\"\332*\\B\325\211\205\021\244.\341"
+	.ascii	"\312P\216\013\316\004\352s=\b\340\311\354\326\260\262\273n3\021"
+	.ascii	"\276\300\032G$\254\272\204\357\215[\177"
+	.text
+	.section	.gnu.lto_getThrottleScale.part.0.50.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\202\001\245\016"
+	.string	"V\\`C"
+	.string	"\221(\035\300\217DJ\202U\004\2050\370\372\030\337@\344\244\365\334y\2162(\372&\276;LGSu\3040\253Z\333\033=lT\366\327"
+	.string	"V\034X\030}>\356pz\361\247CH\335\327y\354\336R\246\024N"
+	.string	"H"
+	.string	"K"
+	.string	"\2730,\\v\267\303\t\260\277\\\201\362`\333Oq\025){s+$R.\003\305\006\226\032\273\013\3776N@\363\347\316\321\374\351\210\247\256\351R~\262JD\256w\335\271\224\210\301*\371\360\314\356"
+	.string	"|\354\2561\020\367\273\355\006\266%\330\207\tWe\214\365\316)\212}\267zbg\372e\332eZ3\235.},\2032\273\035fdV\304{1\361\326\355\267P\276\313\033\333\250\004Y\r-\007\376\374V\312\336\374\031\203\275%\007\222\335]\004Y\b\220\314\257\\\305\233\003\004\3337\275\331N\016U[\024\363,\247\033+\025\261\267\277< \303\256\212#U\365+\030#\232\232,+\032\266;\376\362\013lw\027\370.\336r\301O\371s\351\224g\2354\177W8\343E\2253>a\262\251(-\376\3263c|\225\007\376xx\024x<\f<:\005@\241\217\346"
+	.ascii	"\0242\231\"\251\302\003\216\265Ni\024CL\332\3504\001B\350\023"
+	.ascii	"!\206(\300Q\024\211\242\006G!\037\021\324H%\3301\340h\001D\202"
+	.ascii	"\246\030Ipsw=\361]\317\322\351S\022\333O\375\241\322\021u\257"
+	.ascii	"U\023\013H\007! `\202!&\315\003K\016|\250\271\017\214\016\f\251"
+	.ascii	"0L\342\304M\366\356\274\207-\253\223TOl%\303\211\221\3709\205"
+	.ascii	"1\267c\336J\007\017\327\301<a\332R\255\307\231v\337\355\376\214"
+	.ascii	"+\304\301\2734\251\035\326\3314k\243\"\244\327\350\023\002\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`\021\001\255\b"
+	.string	"\324\f\r\002"
+	.string	""
+	.string	""
+	.string	"\002\037\177\027\260\206\3618\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\320\2022\177\030\200\200\200\200\004\271\224\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\036\031\301\204\001 \177\032\363\377\377\377\003\272\220\005\030\033\005\035\034\034\035*\036`!\177\037\220\"\177 #\177!\005\033\"\305\204\001"
+	.string	"pg_registry"
+	.string	""
+	.string	"\005\031#\001+\177$\377\037"
+	.string	""
+	.string	"\200\220\200\001)\177%(\177&'\177'&\177(%\177)\003\001\r\344\001\003\003\022\314\360\372\250\001\001\204\n\003\003\021\244\023\003\003\020\234\347\210\005\001\204g\003\003\017\244g\003\003\016\313\215\326\001\001\344j\304o\344orwwz\003\b\003\321\371\216\307\003\001\242\006\003\t\001\320\360\372\250\001\001\302\001"
+	.ascii	"  \340\002\241\272:\212(\2670J\213\264\020DW\2672\034\240\354"
+	.ascii	"\340\326.\320\005\235A\347\204\274\356\245%)\030\313\357\375"
+	.ascii	" B}\277\366\031\034\356\315\215n\030\310\230\310\203<\303\347"
+	.ascii	"b3q=\241n)\242W\305\003"
+	.text
+	.section	.gnu.lto_.refs.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375 \260\375\003"
+	.string	"\302\310\032%\200K\322\001Z\206/S\307\022\220\025\032\333\200\t\304\f\314\300\364o\220\347`f9"
+	.ascii	"\202lkM\222M\266L\001o\002;\013\250\245\016\340\326'\256J\211"
+	.ascii	"\323R\241\030\347D\322g\244\234\220\020\250\377\307\323\341l"
+	.ascii	"\"\276f\375\231\3621\375G\271\243\3370\316(_\364\025\367\211"
+	.ascii	"\305\021\367\207\373\302\342\204\365\203\373\350V\206\317&\377"
+	.ascii	"K\t\004\001@\310,\300[\330R\020\b8\300\244\226("
+	.text
+	.section	.gnu.lto_.decls.b436cd1434314cc9,"e",@progbits
+	.string	"(\265/\375`K!\315\233"
+	.string	"\212\376\3307R0\220\312I\007\024\b\344\366\2707\036&\377K\203\375{0J\317\240\351\037\345\251\260\037m\016\024\034\254\35273\320\326m\342\270\335k-h.\223\3105S'UA\251a\256"
+	.string	"\245\362\2120\254\311\260\t\255\002\255d\205\305\334\224u\273\3775k\311\2262\005\356\002a\003\207\003\275\304y\357\313cJ\256^\342\271\240\233\034S#kHhH\207\312N\210\227E{\306\330w\233\365\3357(\316p\0160SCk\364\307\037|\006"
+	.ascii	"\245;p\fit\207~\223\362\245\254\3216i\031\2326\367\005G\243o"
+	.ascii	"2{\036\233\343\270\237z/\2208Y\\\307t\274\206\355\370\311w\214"
+	.ascii	"\346\234\206\325\224\235\341\270\034\360R\220a3\3746e\301\226"
+	.ascii	"\033\272{\357\035_a0\3746\326\301\032\034:~{ \005\337q\030\216"
+	.ascii	"\373A\246\367\211\2027Q=\360\356M\207\204\206\206\206\206t\234"
+	.ascii	"\224\024\021\353A\337A,_\006\341\013j'\373n\262\254\003\313\361"
+	.ascii	"S\210\313\210I:U\345Y\032n\036\013\371\316v\226\305\360\030~"
+	.ascii	"\032\300p)\220\317\034(s\340\234\261g\003|\234\307\006\370\316"
+	.ascii	"p6\210A\370\334\204v\310H\375XS\263^\270\215\237\374\205\325"
+	.ascii	"\216\246\367\020\224qZ\245\302\264X\222g\350\356M\317V~\024\347"
+	.ascii	"/\274\205\331*\025\346UZ\241U\260tg\203\n\357\336+44\324S\333"
+	.ascii	"a\213\213\017e.\274\306\317\253q\027\035ez\301\330\b\027$WY\031"
+	.ascii	"\277\253\371\316;\354\231\206\226jC\t]\243?Z6c,\374\344,\214"
+	.ascii	"v&c+G\275\232\027\354\336\324\247\243\300q\031i\364A\333Ct>\373"
+	.ascii	"\001bn\212\013`\317$|@L\302w\017\026\375\331\021\f\302\3677\006"
+	.ascii	"!\026\226z@\305\242\252L5\372\363\027\030W\271Z7\357U\336{\007"
+	.ascii	"\350=\0213S\325h\223\340\017>\366Bq\376\372\340cN\245w\354\336"
+	.ascii	"\013\304\243\224\272\222\244Q\035\376\340\213\302\\\234\326\345"
+	.ascii	"\215\346\035\273\313\324\003+q(\363j\224\273x\3129e)\177 \305"
+	.ascii	"+\322\353r\335{9\215\240y\357\022\247@q\356]\002bF\200\031\001"
+	.ascii	"4\007+\034\256\370\320\267}\312 |\226?\370~.\322}\236\277\215"
+	.ascii	"4K@\302\234\377g(\020\371\371\0049-\276\363\267\332\317(~.\361"
+	.ascii	"\363\211\237\211\342\374\214\004\316\317B?w\275\371\231\212\233"
+	.ascii	"\271\237\373\347\260\035\230\315\177\272\237\357~\256\334\343"
+	.ascii	"+v\377\327\374_\363s\335\317+~^\201\351\376\243\375\314\365\177"
+	.ascii	"\200\377\"~\256\340g\266\237\327~\301\337M~\316\3623\032\n\367"
+	.ascii	"\375\315\343\347\037?W\375\334\343\347\251\237}\374\034\304\354"
+	.ascii	"g\246\237\245~\326Q\366\037\350\257\030\374L\366\263\330\317"
+	.ascii	"^?O\3719\311\317W?;\177n\376|\374y\204\237_\370\331\205\237\215"
+	.ascii	"~\016\376\f\374\031\205\237M\370\271\305\317\037\374L\364s\006"
+	.ascii	"?\373\376\267\371\337\342\177\225\377 \374|\301\317\026\374<"
+	.ascii	"\301\317*\376\303\375/\363\263\004??\360s\001?\333\237\177\377"
+	.ascii	"\361\376\357\360?\354?\t\377\323\377C\377\275\374\267yyyy\177"
+	.ascii	"\303\375\275,\177\b\246cDk_k6\236\272u\216n.\316\226\317K\023"
+	.ascii	"\224\274.o65?)\036\235\026\233\361I\215\330\020\"\306\006%!z"
+	.ascii	"o\341go\341\260\016\322\213d\262's\252\001\0365fuf\366g\255\345"
+	.ascii	"\254\323|\367r\332|b\336)&\211\377l\336ig:SX\314F\001\250\361"
+	.ascii	"l-\317\316b\221\"\2700{i5n\026\264w\2263\0263\023F\313\317\270"
+	.ascii	"\t\026(W\032\275\217\313\3367\304~\260\201\250\303"
+	.string	"Z\354=\366\2616\263\367^&\243\233\213\203w\247\246H\354\360X\342\344M\331\333\354jz\256\210^\n\004\212\231F\317\246\311\376\353\374Dm\265\001!\273\"\307%\265\245\215\315\301\226\245\313\n\243\361\225\301\262\252\202\263\177\377\276\233\243\227\336g\262\207I\374>\\9\201\377\350\255\177\001*\244\027\371\345\206;\037\233\223\307\335G\334\337\213l2=,S0's\251t\362\340%\230\023j\t\346D\366\262m\t\212y\235H{\233Pv\271t/X\363B\361\244\316{S'\322\246K\314\273L\235M\017K\245\023\212\227`\227y\225\227\t\300\362^\250\013\346\254\343\345u2\227`M(\017W\371\304\306R\315\026\024o\255\205\201\251[*\257\023\001[\312&\363m\2316\371y/r\254\35129\275\327yoU\023\201\2472\t\362\231|s\372M)S$S\341HZ5u\322\344}[2i\272h\272W\356\342\210"
+	.ascii	"\311H\0327\211\344{\233R\346\275\311&\013SM\206\243\301\274>"
+	.ascii	"W\271t#i\325\354iJ6i\\&B\030j\tf\325D\201\026\006\226u\223)\222"
+	.ascii	"\263\256\234\223i\301\220\351]\332\371\354\200%\016\257Q0\037"
+	.ascii	"77\302\304ay\355\faK\263s\332\356\352)\374\274\227N\377S\246"
+	.ascii	"\212\232%T\3664\360\275H\341\362\331%\347\2444\032E\204\033D"
+	.ascii	"\224\215\276\227\314\241\241(\261\241&\244\3216B>N\247\227\326"
+	.ascii	"V?!\242\004K\224F\233I7\341g\210v\262\346*\t\005\307\316p/\207"
+	.ascii	"\360q^\036\207X\202\204\307\351\n2\255\321\247(r\306o6\254\265"
+	.ascii	"\325\020\266F\322WX\200\264\363\247wo\323KV\222\316\352\033Z"
+	.ascii	"Ik5\016\374l$m\344}\244\261\336\215\244\211\264\363g)\275\314"
+	.ascii	"\037\031S\207*\274\241\236.\034\304\234\371A\377d\020\276\035"
+	.ascii	"4\213=jf"
+	.string	"\217V\261G\247\330\243K\354\321!\366\004\203\360u\220n\362\223\201\026\362\376\301o\357-\2457m,9V\276\032=\352\303\236\031\360\325\274<f\300w\264\206m\376P\325\343\307\203m\251\215\253F\337X\321\304\324\241\221\244\242k\035\275\243\251z\252y\360\263{t\216wTK]\350\311)\005\023G\326\275i\217\206\272\341\024t\225_OY\020\374\234\246G\343\350\033\3746\225\336\034\277\344T\020\255\241\036\236\020\251\373\203\366\210\252\305\276Z\261\257\\\366U\211}-b_{\334h\033>>\302\234h\236mC\003'>\3164\372\372d\377\256\341^P-5\245\220^6\215\236\273\251\344\216F\3374XN7q\230\247\032L\032m\246ZC\234\252;7\366\020\314\341\270\232f\375\304\254\226\275\304[\256\026fU\003\335\337\310N\266\222\237\001g\025\355\365\371\035\346Uz\313\236\265\r\2502\002@Kfg\334|X\300"
+	.ascii	"\301e\315e\231\231I\301\342l\324\003\227\025+\225\214\203\322"
+	.ascii	"d\234\217\25449\342\260\352\225W25\276W]\232;X\017B\300\300\252"
+	.ascii	"\030\023\241\262\361\304\343\221Z:\275\205\275\212\361\334/Y"
+	.ascii	"\2064Z\253p\232\275\2421\325\354b=\350\240B\245z\375\252,\203"
+	.ascii	"h\341\331\251,R[\215V\257\n%N\016\215\032Vl\020\233\254g\325"
+	.ascii	")B\315\032\367#\210\326\326O\326\222\007\223\034^\247T)kbn\330"
+	.ascii	"4Z\245t\345\252]\257Rj\224\036eZ\245\240\214\300\0173\002=5$"
+	.ascii	"K_>\364;_\2662\251Pv\230\244\344\254@\251[i\336\224\313F\237"
+	.ascii	"T\247\032F\200<\261\325ImR\227C-\017\313\236M]\242s\226\244\215"
+	.ascii	"iI\325Z\013\243\304,J\217!\271uUI\347P\3625\306\311\006\251\035"
+	.ascii	"9R\223\b\331+\205\310\023\335\316\230\034k\304T$\257I\324\232"
+	.ascii	"\320\334\335`\341X\231\002\327h\305"
+	.ascii	"\272\332\275\270Y\005QCu\240E\371\322\350w\2246\250\t\321\220"
+	.ascii	":\244^\261\327}\022\241\005\211\203\026\t\026\264\256\262\213"
+	.ascii	"\274^\2359\371J\203\326h\265\341gT\210\240\211i\264\022\371\331"
+	.ascii	"\261P\221\303\322q\263@k\210^\235\325\331`:\b\272\327j\316\223"
+	.ascii	"\335hI\225\201\331 &\"\206\302\335\3465\331\2466\353r\352F=p"
+	.ascii	"\246\252\001\036\251\032\324\320h4H\252\3542\273\2720O\354\231"
+	.ascii	"KY\233\312\320\321\250L\\r5\352\r'_\226\225\351\007\351"
+	.string	"\341\336!`\262\246*\220\372\243\372\250T\265\212\237\265G\305!\364V{\324\032\332\311oW\027p\271uT\355Q\235\352\016,i\206\206\206vj8\337~\374\240\312\247\021\221\\v\320uFG\345\301\317\272\343BuG}\252R<fT\216\244\341\205\030\362Y\003'\347\303'\025\365S\226\026\261k\264\346\370M\361\360\302\324\304\344g\205Rc\331l\241\301I\303\303\345\210\225[\243\327I\332[9\366\226\316V\0336\216\356\207\233\031{K\306\336\206\261\267]\354m\232\375kSe\352\201\261\335\271U&\216\033\363\345F\362i;\257\"\353\022\0243$\323\230}\275 \034\001C\326(\332r\336s~\235\276\242\332b\367e\337p:\016S\356\246E\261\3577GPOZ\215\266\033\333d\2230\320\333BB\266\245\321\267\233s\312\202O\225\326\020\"\215\366\016(\336x=*/B\260\032\345\261:\254\207,h\320\364\035"
+	.string	"Y\2770\"V\350\032\371\243.O\315\373\356m\367@\212~\342\273\242\005\310\216\272^\363\353\374\314(\271\263N\266\347\232\016(J\216\024\217^2\300\323U\327d\271\223\005\347\206$\215v\232\336j>\261a\307q=\2536h\316\354,"
+	.ascii	"rrmFH\313\033\337\020\326\006\246\3216\243\246\247\236uC\232"
+	.ascii	"\n\234\037Q\267\213\265]\210\336d\316\317&\323U\332\353\"\201"
+	.ascii	"l\274M5\320{\3322\363#\265A6\210Z\f7\334\263\341\372\253.;p\342"
+	.ascii	"\205\3562\327\032\260\315\036a\224X\366\334_\276 '\321;\f?;L"
+	.ascii	"\323\320Y\242tmth\034\236\030\260F\377\323a\201\316\020\275\333"
+	.ascii	"\370\331m\rF\207\001,\246O\327\363\t\0310\177\177i\267\206b\263"
+	.ascii	"<\021\022\326\250\345\353sc\001\bB#\342\007G$\245\237\021hB\213"
+	.ascii	"\030\276\242\035\031B\243\241\007C\244\n$\300Q\310\001\013\003"
+	.ascii	"\200\222\210\304\f\200\275\243\021\310s\024r0$\3128\306\020\241"
+	.ascii	"s\027%\214.\216\301\027&\bpa\210\024,\036\215Cb\321\316\f%\""
+	.ascii	"\013\340\361.J(\301 \026\217\200E\341Q\370\"X\f*\231(\032\302"
+	.ascii	"\340\031\272\320\305\236\021\330s\004\016\217\224z\303#\245*"
+	.ascii	"\224\001\311\210\032\215\302\242\221Q\3607C\211X\204\026\217"
+	.ascii	"J\325H8<BJ\n\376\214\204F\030\250\320\370{\021x\244\3243\243"
+	.ascii	"x4\"\035\tG\020*\n\372T\030\221\302\211\025zF\303\340\213\027"
+	.ascii	"D\026E#\034\205G\001\300`\f\266\020\036\203FJ%\204\020\332\300"
+	.ascii	"h\0041#X,b\360Bx4\316 \001X\200\321(,\"\026E0\n`\f \350D\211"
+	.ascii	"c1\250TB\230\024,\"A\230t<\022\213.Z\034\205G\003\274\b8\334"
+	.ascii	"\340(4\nG8R\n\361\"\244\242p(<\262\217@\205\003*V\310\370}\005"
+	.ascii	"\005'"
+	.string	"(8\341\373\n\nP\240\240@\005\n{\025(\352\361\b\214@\305\021h,A\370\002\351h\217\277\273(AD\n\300\b<BraHda<\032\"\035\217B\022d\034c|@\177\275a\320\005\013\241\021\361\203#\222\022\317\213b\320\210D\024\0031\351\347\bT\201\302\n\215\220\212Ea\214\020D\220\021|\001\224q\214a\302X\024\306@*\032\2150\002g\034\221\222\220Z\b*\005Y\b\213\220b\b\211d\034c\2008\016a\020Y\030\r\203-\350$\t\207\303\240\213\242\036\243\360E\020\204\2420\006\242\322\316\321\b\024\036\203G\022@\bc\334\305\002\306\243`\222\013=#p\203 #aR\013\301\241\360\3473\362\200\347\b\\q\034\"\301\370\005}\307\273(\201d4$\026\001OT\022\026M\034\211\304\242\t\236#\360\001\b\216C\244_\214\236\021\370#4\002\205J3Z\030\r\203E\241R\bEHG\304$"
+	.string	"\036\224 \205\212\024)&\220\240\204\210O0\001\213\021%\200\300\201-*a\034\022\221\216EC\030."
+	.ascii	"\223\202-\020\223\216L\f\211/^\020\213L\f\221\202/L\024\025\215"
+	.ascii	"&J( T\232qD\2050\222\202&\2708\"\305\240S\f\272(B\223WrHtp\322"
+	.ascii	"(zQ\344\321\245\243K\215.\325\274<\237\02481_^\232O\327\330T"
+	.ascii	"\333\0346 \034\254\224D\311\351*\326\206\270\267+q\222T#yivp"
+	.ascii	"\246\364|4\361\362\361\246z\371\336\322\230y\272\351/\035&\037"
+	.ascii	"su\215W\305\230\3368-i4\355=\347\314\335\350\0363W\300\260i\324"
+	.ascii	"-\035\373qre\316\221\273J&%\027\207\326(\232d\213\252j4\345\352"
+	.ascii	"yz\302j\326\321\2158\002\365\243\321'}$H\233\027\326\227)YWR"
+	.ascii	"j\231\n\246\271V41A\030\023\205\256\226\251o5.\352\013\n\335"
+	.ascii	"\275`"
+	.string	"\257mUn,\253\272\225\351\"\034\367\363\263\352\n\242u\246\316U3UMMS\321\360\263\226\251M^\311T\035,\031\256\273\245\037\364<d\266\236\340\017\2761i\025\252.T\rW\307\354t\271\311!\207\355\332\361\246\256Q15\214\016\325\2329&S\354y\266\354y\220\330\217\3618\355\327\030\204\257\262\245`?n:\220\221\003b?\234\251i\265KM\253k\314d\"\3274`\345cJ\212\304_\325^\327*\027\033\252\300\236\225K\335\342+{s\213\222\362\034\311\212\023\306\343d\231Y\243\266\274\201k\364\304U\332,\2737\005\322Ab\365d\245\321\372\354\032\202\255\250B\3018\310\362\030CH\231!\221\321&\205tB\n\020\006\203i\034\211\251=\022\34059\3151\250fh\322\244\3757%\027\270k\311\277\251\213\265\005D\330\\\245Z`\230!\003\300\016\232d7\346h2h\253\204\376\315s\022\253\246\371\243"
+	.string	"8,r\212\336\303$k\363\231\222{7QV\005\372\020\301*\357G\245\235\232\\\240Y\3731K)\301\263\223\306\330\037\311\037\236\267\305H\006f1*y\232\327\020\252\r\021\272\307\225\322U\031\233\246\262\245\250\357\322\013\264\270\323\326\201\267\357s#P$\204\231)D\355\335(\t\360\245\210bD7g\325\333\002\314L\376\244\204k$^@<*Y\017\016\200\305\347\227$,+\f\034%\022k\267K\357\312\031"
+	.string	"\272v\3341>\037\035\232\246\371\267\255\312\241i\213\275h\247\035\266dA\"\235\252c\336\260Od8\f\017\277I\353ZPg\237\033G\223\334\233\227\274]\314(u\305\240P\"\362\200L\345B\322\013\004&.\267\212\005"
+	.string	"\202=\337s\277\302\2112N\007\357\032\251\272eE\016\207cb\377F"
+	.string	"\351\ro\247\343\\\340\352\200\240\275\277\233\tV\203\351]U\245]\001\270@\341%G\026\313\266\016w\031X\243\233\347F\n^8#B5\332\311\323!h\024\255\375y\232\261\003\210S\275\364\347\tJ\221*\265):\271\177\207H\0044\023\313\334"
+	.string	"]\201\240\004"
+	.ascii	"\250\341\215^\200\377Cn^\373Zve$A\t\344:\375@\242\312\241\363"
+	.ascii	"\227\370"
+	.string	"\340 N\307\250O\354\373\224\340\327\236\364jb6va\262\355vL\032$6H\372\n2\315\277\204>\354.\202R\017\b\201\t\217g\006\335\324c\243J\241R\007\356\004>@h\363@\353\024\330\345\033c\223S\027[8\373\361\033\212\242,T\242O\001(B=P\222\347\036"
+	.string	"\365\321\306/}\f\\\035\360N\352m\346N\243\3041V\230\372\003\246r|\376\326e2&\336\031O"
+	.string	"\354U\200\333d\376:MB\001or\313 \001!\254\207\2225\300\237\227/\364=qxA\257\017y\264\300mx[\230\232\267\205\230-\\\276@\020\rQp3\367D>(c\016\032\344\013\211&\026\311\200\030\003\0270\";\374\323\334\254\222G\235\244\2602\221\250\314x\316\243\353\\\376\372\306\242_S78d\013 \365'\210S\375\002\307?$=\214\270\370\034o\302\025\331\3571#i&g@2\367xV8\035\025\323\276\242\325\340\027|p\2006\260\344\txX\326\032\247\200\236\207[\311\203\256\326\312K\274\304"
+	.string	"\321\303\251\355\2524\260\306\340^\026\365\213\222g\274\244HO4\200\177\361\f\304\260\005\3549k\376\332/\374\024`\337S\225\367\273\275Z\243\177E\232hx\257\251<\361\004U\206bO\272Gu5Qp\304\313\306|\2530n;\262y\206\272\220\343-\371\213\032-\1777\245Riein\252\302\240\257\354\306,\023P\025f\n\f|\241\241\252\217\005\032A\274\276+\261\370\300a\226\251\340\217<}\344\215\2652n\253!\234\017\325\223b\222\253\212m~bRZ\022\230\231u\247j\315\213\376/\364)s\033V\250\221\227\306\374{6\031|\367\227#\344\212\203z\206\327\334\331\366\030\210B\005UX7\252\372\376\203\006\275\360e\367\344&\223s\031\033\365v@\210\222\275i\242\320\023L)\207\306|\235L\3701:\230\325|\376\316\266\342\016\202\320\\ZF\254\036\215\f\247`"
+	.string	"\257\362h\210\200\031\016R\001\327\327\256\364\300\226\301\362\b\227\b~\001U\036!\260\377nx\320\302\b\376\346\"\020c\273\302+\030\207B8/\232#$\203\031\360\372\204G\356\020U\201+\316@x\230!\034\227g\364\210i\222yT\321\364\307dh.\265@\301r\317\323\213\305\345\336S\271\226\\\030\202\310\357n\031!\220\220\246\017\247\036-b\353\324BT\326\206\236\0024>\b\222\200\231\311y\017\020\013Lz\243\367\346\357\350\246"
+	.ascii	")\260\310k!]\254\256\232\\/)\236\243R\350l\3330\244\205\366\210"
+	.ascii	"\246\374\225\273Z\033\030\331\202g\312\207\273\242f\355\310\221"
+	.ascii	"\t\230\227\353\020\234\312\250\277\030\357\256\240_I\245\372"
+	.ascii	"\233\264}\374\2745@\f\026\356!\314\333P\023\337`\366\030\264"
+	.ascii	"Z\237\237\020\211\222#\027u\365\212\032@\235v3\211\360\233\f"
+	.ascii	"\314\254\315Hq\\z\305\2400\0352\365\216\312\016\345\251\320\353"
+	.ascii	"\231\361\225\r\356\264\261j\231CG\0176\243X\216.\f0\232h\213"
+	.ascii	"\005\342\002d\362\024l\274_\372{\375\f%\005P$\3376\336\202\321"
+	.ascii	"kh/@+\222d8\256\3603\215\245\356DI\333\034\335\026\244\313\251"
+	.ascii	"\341\210\264\3023\265\005Q\217Z\375d\2000#\364\003J\003D_Y\020"
+	.ascii	"\035b\306\377\341\013\341\252;WS|\354E|\017\216\037\371\363\361"
+	.ascii	"\037\02615\236@z\300\"\336\325\204\371Y\354\371\373u;n\307\310"
+	.ascii	"\357<\201\215N[,`c\234W'\226\372v\016\026\3533\304\257\346\215"
+	.ascii	"\360\322\200\2535\027.\255Z\247\020sC\332j\276\274/\330\030\003"
+	.ascii	"|)3\237e\200|\310\333\321;-\367\372n\336\027_\323\003\345G\331"
+	.ascii	"\033\017\266]\216\362\372{\252\346\326\331\267\002"
+	.text
+	.section	.gnu.lto_.symtab.b436cd1434314cc9,"e",@progbits
+	.string	"pgResetFn_globalFunctions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\001"
+	.string	""
+	.string	"globalFunctionValues"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"globalFunctionsProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\001"
+	.string	""
+	.string	"globalFunctions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"globalFunctionsStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"globalFunctionsFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"globalFunctionsUpdateTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"getThrottleScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"getRcCommandOverride"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"globalFunctions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"globalFunctions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\001"
+	.string	""
+	.string	"vtxSettingsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\001"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"vtxCommonGetDeviceCapability"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"vtxCommonDevice"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"logicConditionGetOperandValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"logicConditionGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.b436cd1434314cc9,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7481 @@
+	.file	"global_variables.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/global_variables.h"
+	.file 6 "./src/main/common/global_variables.c"
+	.file 7 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	global_variables.c.4fbce255
+	.weak	global_variables.c.4fbce255
+global_variables.c.4fbce255:
+	.long	0x300
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x13
+	.long	.LASF1109
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1067
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1068
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1069
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1070
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1071
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1072
+	.uleb128 0x1
+	.long	.LASF1074
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1
+	.long	.LASF1075
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1076
+	.uleb128 0x15
+	.byte	0x8
+	.uleb128 0x2
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1077
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x1
+	.long	.LASF1079
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x1
+	.long	.LASF1080
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x9f
+	.uleb128 0x16
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0xe8
+	.uleb128 0x6
+	.long	.LASF1082
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1083
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1084
+	.value	0xfff
+	.uleb128 0x17
+	.long	.LASF1085
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1086
+	.value	0x8000
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0xf4
+	.uleb128 0x18
+	.long	0xff
+	.uleb128 0x7
+	.long	0x7e
+	.byte	0
+	.uleb128 0x19
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x11e
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0xb
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x11e
+	.byte	0
+	.uleb128 0x3
+	.long	0xe8
+	.uleb128 0xc
+	.long	.LASF1093
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x17e
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0xab
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1088
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1089
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x17e
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1090
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x17e
+	.byte	0x10
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x183
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1091
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0xff
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	0x93
+	.uleb128 0x3
+	.long	0x17e
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x123
+	.uleb128 0xd
+	.long	0x188
+	.uleb128 0xc
+	.long	.LASF1094
+	.byte	0xc
+	.byte	0x5
+	.byte	0x1f
+	.long	0x1cd
+	.uleb128 0x8
+	.string	"min"
+	.byte	0x5
+	.byte	0x20
+	.byte	0xd
+	.long	0x87
+	.byte	0
+	.uleb128 0x8
+	.string	"max"
+	.byte	0x5
+	.byte	0x21
+	.byte	0xd
+	.long	0x87
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1095
+	.byte	0x5
+	.byte	0x22
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1096
+	.byte	0x5
+	.byte	0x23
+	.byte	0x3
+	.long	0x199
+	.uleb128 0xd
+	.long	0x1cd
+	.uleb128 0xe
+	.long	0x1cd
+	.long	0x1ed
+	.uleb128 0xf
+	.long	0x37
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1097
+	.byte	0x5
+	.byte	0x24
+	.byte	0x1f
+	.long	0x1de
+	.uleb128 0x9
+	.long	.LASF1098
+	.byte	0x5
+	.byte	0x24
+	.byte	0x63
+	.long	0x1de
+	.uleb128 0x2
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1099
+	.uleb128 0xe
+	.long	0x87
+	.long	0x21b
+	.uleb128 0xf
+	.long	0x37
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1101
+	.byte	0x6
+	.byte	0x27
+	.byte	0x10
+	.long	0x20c
+	.uleb128 0x10
+	.long	0x1ed
+	.byte	0x5f
+	.uleb128 0x10
+	.long	0x1f9
+	.byte	0x9c
+	.uleb128 0x9
+	.long	.LASF1100
+	.byte	0x6
+	.byte	0x29
+	.byte	0xda
+	.long	0x194
+	.uleb128 0x1b
+	.long	0x233
+	.value	0x10d
+	.uleb128 0x1c
+	.long	.LASF1110
+	.byte	0x7
+	.byte	0x87
+	.byte	0x5
+	.long	0x70
+	.long	0x266
+	.uleb128 0x7
+	.long	0x70
+	.uleb128 0x7
+	.long	0x70
+	.uleb128 0x7
+	.long	0x70
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1102
+	.byte	0x42
+	.long	0x27b
+	.uleb128 0x11
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x43
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1103
+	.byte	0x3c
+	.long	0x29e
+	.uleb128 0x5
+	.long	.LASF1104
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x14
+	.long	0x93
+	.uleb128 0x5
+	.long	.LASF1105
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x23
+	.long	0x87
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1111
+	.byte	0x6
+	.byte	0x34
+	.byte	0x9
+	.long	0x87
+	.long	0x2bb
+	.uleb128 0x5
+	.long	.LASF1104
+	.byte	0x6
+	.byte	0x34
+	.byte	0x17
+	.long	0x93
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1106
+	.byte	0x2b
+	.long	0x2dc
+	.uleb128 0x5
+	.long	.LASF1107
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x3e
+	.long	0x2dc
+	.uleb128 0x11
+	.uleb128 0x12
+	.string	"i"
+	.byte	0x2d
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	0x1cd
+	.uleb128 0x1e
+	.long	.LASF1107
+	.byte	0x5
+	.byte	0x24
+	.byte	0xb3
+	.long	0x2fe
+	.long	0x2fe
+	.uleb128 0x5
+	.long	.LASF1108
+	.byte	0x5
+	.byte	0x24
+	.byte	0xcd
+	.long	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	0x1d9
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.file 10 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 11 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0xb
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF784
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 27 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1b
+	.byte	0x4
+	.file 28 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF910
+	.file 29 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1d
+	.file 30 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF914
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 36 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1030
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF913
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.23.96c4afc0737b13234a3b55c02753565a,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF937
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF960
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1029
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1112
+	.long	.LASF1113
+	.long	.LASF1114
+	.long	.LASF1115
+	.long	.LASF1116
+	.long	.LASF1117
+	.long	.LASF1118
+	.long	.LASF1119
+	.long	.LASF1120
+	.long	.LASF1121
+	.long	.LASF1122
+	.long	.LASF1123
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x25
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1124
+	.byte	0x8
+	.long	.LASF1125
+	.byte	0x8
+	.long	.LASF1126
+	.byte	0x8
+	.long	.LASF1127
+	.byte	0x3
+	.long	.LASF1128
+	.byte	0x2
+	.long	.LASF1129
+	.byte	0x2
+	.long	.LASF1130
+	.byte	0x2
+	.long	.LASF1131
+	.byte	0xb
+	.long	.LASF1132
+	.byte	0x6
+	.long	.LASF1133
+	.byte	0x5
+	.long	.LASF1134
+	.byte	0x4
+	.long	.LASF1135
+	.byte	0xc
+	.long	.LASF1135
+	.byte	0xb
+	.long	.LASF1136
+	.byte	0x8
+	.long	.LASF1137
+	.byte	0xb
+	.long	.LASF1138
+	.byte	0xb
+	.long	.LASF1139
+	.byte	0x8
+	.long	.LASF1140
+	.byte	0x8
+	.long	.LASF1141
+	.byte	0xa
+	.long	.LASF1142
+	.byte	0x8
+	.long	.LASF1143
+	.byte	0x9
+	.long	.LASF1144
+	.byte	0x9
+	.long	.LASF1145
+	.byte	0x8
+	.long	.LASF1146
+	.byte	0x8
+	.long	.LASF1147
+	.byte	0x8
+	.long	.LASF1148
+	.byte	0xc
+	.long	.LASF1149
+	.byte	0x5
+	.long	.LASF1150
+	.byte	0x5
+	.long	.LASF1151
+	.byte	0x3
+	.long	.LASF1152
+	.byte	0xb
+	.long	.LASF1153
+	.byte	0x7
+	.long	.LASF1154
+	.byte	0x7
+	.long	.LASF1155
+	.byte	0xb
+	.long	.LASF1156
+	.byte	0xc
+	.long	.LASF1157
+	.byte	0x1
+	.long	.LASF1158
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF1005:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF540:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF396:
+	.string	"USE_I2C_PULLUP "
+.LASF402:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1057:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF473:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF996:
+	.string	"PG_CF_END 56"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF407:
+	.string	"USE_GPS "
+.LASF1049:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF998:
+	.string	"PG_INAV_START 1000"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF504:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1039:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF462:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF871:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF959:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF577:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF1078:
+	.string	"int32_t"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF415:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1013:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF839:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF403:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF854:
+	.string	"USE_UART7 "
+.LASF863:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF956:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF410:
+	.string	"USE_TELEMETRY "
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1043:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF957:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1101:
+	.string	"globalVariableState"
+.LASF481:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF564:
+	.string	"__P(args) args"
+.LASF907:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF800:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF936:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF435:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF894:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF881:
+	.string	"USE_VCP"
+.LASF841:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF793:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF974:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1024:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF953:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF804:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF483:
+	.string	"USE_CLI_BATCH "
+.LASF861:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF434:
+	.string	"USE_1WIRE "
+.LASF414:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF507:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF915:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF358:
+	.string	"__k8 1"
+.LASF494:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF973:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF967:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF890:
+	.string	"U_ID_1 1"
+.LASF442:
+	.string	"USE_OLED_UG2864 "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF966:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF869:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF785:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF518:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF498:
+	.string	"__USE_XOPEN"
+.LASF1045:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF503:
+	.string	"__USE_XOPEN2K8"
+.LASF467:
+	.string	"USE_RX_MSP "
+.LASF451:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF601:
+	.string	"__always_inline"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF401:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF514:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF940:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF1076:
+	.string	"long int"
+.LASF542:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1083:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1051:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF519:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF536:
+	.string	"__USE_XOPEN2K8 1"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF942:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF429:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF977:
+	.string	"PG_IMU_CONFIG 22"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF423:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1090:
+	.string	"copy"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF456:
+	.string	"CMS_MENU_OSD "
+.LASF866:
+	.string	"USE_DASHBOARD"
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1036:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1084:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF955:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF906:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF487:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF814:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF427:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF946:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1071:
+	.string	"signed char"
+.LASF937:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1079:
+	.string	"uint8_t"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF430:
+	.string	"USE_OPFLOW "
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF465:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF979:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF910:
+	.string	"__OPTIMIZE_SIZE__ 1"
+.LASF439:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF862:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1067:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF524:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF530:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1050:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF812:
+	.string	"__DEFINED_size_t "
+.LASF983:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1085:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF914:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF411:
+	.string	"USE_TELEMETRY_LTM "
+.LASF903:
+	.string	"NOINLINE "
+.LASF896:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF850:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF420:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF904:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF808:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF836:
+	.string	"NULL"
+.LASF1105:
+	.string	"value"
+.LASF399:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF463:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1110:
+	.string	"constrain"
+.LASF482:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF900:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF474:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1097:
+	.string	"globalVariableConfigs_SystemArray"
+.LASF437:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF513:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF784:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1074:
+	.string	"__uint16_t"
+.LASF501:
+	.string	"__USE_XOPEN2K"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF502:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF893:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF799:
+	.string	"__size_t__ "
+.LASF533:
+	.string	"__USE_POSIX199309 1"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF892:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1100:
+	.string	"globalVariableConfigs_Registry"
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF496:
+	.string	"__USE_POSIX199309"
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF394:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1103:
+	.string	"gvSet"
+.LASF1034:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1010:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF902:
+	.string	"FAST_CODE "
+.LASF445:
+	.string	"USE_FRSKYOSD "
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF500:
+	.string	"__USE_UNIX98"
+.LASF472:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1042:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF517:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF840:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF958:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1094:
+	.string	"globalVariableConfig_s"
+.LASF985:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF830:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF817:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF424:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF398:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF400:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF912:
+	.string	"__need_size_t "
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF851:
+	.string	"USE_UART4 "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF480:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF859:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1107:
+	.string	"globalVariableConfigs"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF923:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1073:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1061:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF825:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1065:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF452:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1082:
+	.string	"PGR_PGN_MASK"
+.LASF934:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF939:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF921:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1053:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1058:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF837:
+	.string	"NULL ((void *)0)"
+.LASF864:
+	.string	"USE_USB_MSC"
+.LASF891:
+	.string	"U_ID_2 2"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1047:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF999:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF534:
+	.string	"__USE_POSIX199506 1"
+.LASF855:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF537:
+	.string	"_ATFILE_SOURCE"
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF1104:
+	.string	"index"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF488:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF455:
+	.string	"USE_CMS "
+.LASF490:
+	.string	"__USE_ISOC11"
+.LASF541:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF447:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF806:
+	.string	"_SIZE_T_ "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF948:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF1002:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF527:
+	.string	"_POSIX_SOURCE"
+.LASF899:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF525:
+	.string	"__USE_ISOC95 1"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF991:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF803:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1089:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF897:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1012:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1029:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF935:
+	.string	"EXTENDED_FASTRAM "
+.LASF412:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF968:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF913:
+	.string	"__need_NULL "
+.LASF489:
+	.string	"_FEATURES_H 1"
+.LASF522:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF471:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF980:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF842:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1025:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1027:
+	.string	"PG_ID_INVALID 0"
+.LASF856:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF794:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF931:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF478:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF995:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF789:
+	.string	"_T_PTRDIFF_ "
+.LASF845:
+	.string	"USE_FAKE_GPS "
+.LASF947:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF509:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1017:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF792:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF408:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF413:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF975:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF821:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF495:
+	.string	"__USE_POSIX2"
+.LASF943:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF1109:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF961:
+	.string	"PG_CF_START 1"
+.LASF802:
+	.string	"_SYS_SIZE_T_H "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF818:
+	.string	"__wchar_t__ "
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF486:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF952:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF924:
+	.string	"true 1"
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF823:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF949:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1030:
+	.string	"MAX_GLOBAL_VARIABLES 4"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF884:
+	.string	"USE_RCDEVICE"
+.LASF428:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF554:
+	.string	"__PMT"
+.LASF1106:
+	.string	"pgResetFn_globalVariableConfigs"
+.LASF433:
+	.string	"USE_PITOT_MS4525 "
+.LASF994:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1041:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF969:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF538:
+	.string	"_ATFILE_SOURCE 1"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF1048:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF909:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF512:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF787:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF446:
+	.string	"USE_DJI_HD_OSD "
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF920:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF867:
+	.string	"USE_OLED_UG2864"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1069:
+	.string	"unsigned int"
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF444:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF874:
+	.string	"USE_PITOT_ADC"
+.LASF872:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF484:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF508:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF505:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF922:
+	.string	"_STDBOOL_H "
+.LASF832:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF535:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF461:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF790:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF788:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1081:
+	.string	"pgn_t"
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF887:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1093:
+	.string	"pgRegistry_s"
+.LASF1092:
+	.string	"pgRegistry_t"
+.LASF1020:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF419:
+	.string	"USE_GYRO_KALMAN "
+.LASF811:
+	.string	"_SIZE_T_DECLARED "
+.LASF600:
+	.string	"__wur "
+.LASF395:
+	.string	"I2C2_OVERCLOCK false"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF925:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF796:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1031:
+	.string	"sq(x) ((x)*(x))"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF476:
+	.string	"USE_RCDEVICE "
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1040:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF1022:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1019:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF450:
+	.string	"USE_ANTIGRAVITY "
+.LASF838:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF813:
+	.string	"___int_size_t_h "
+.LASF1063:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF820:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF843:
+	.string	"USE_FAKE_BARO "
+.LASF810:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF795:
+	.string	"_GCC_PTRDIFF_T "
+.LASF409:
+	.string	"USE_NAV "
+.LASF443:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF846:
+	.string	"USE_MAG "
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1077:
+	.string	"char"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF801:
+	.string	"_SIZE_T "
+.LASF828:
+	.string	"_WCHAR_T_H "
+.LASF1016:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1038:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF917:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF919:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF848:
+	.string	"USE_UART1 "
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF951:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF844:
+	.string	"USE_FAKE_MAG "
+.LASF858:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF971:
+	.string	"PG_PID_PROFILE 14"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF938:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF421:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1068:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF805:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1064:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF492:
+	.string	"__USE_ISOC95"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF491:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF499:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1007:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1054:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF1008:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1086:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF831:
+	.string	"_GCC_WCHAR_T "
+.LASF1009:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1062:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1035:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF393:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF457:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1088:
+	.string	"size"
+.LASF1108:
+	.string	"_index"
+.LASF416:
+	.string	"USE_PITOT_ADC "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF1096:
+	.string	"globalVariableConfig_t"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF493:
+	.string	"__USE_ISOCXX11"
+.LASF981:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF809:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF908:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1080:
+	.string	"uint16_t"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF791:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF929:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1102:
+	.string	"gvInit"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF422:
+	.string	"USE_RX_UIB "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF993:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1006:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1028:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF497:
+	.string	"__USE_POSIX199506"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF992:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF852:
+	.string	"USE_UART5 "
+.LASF954:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF441:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF539:
+	.string	"__WORDSIZE 64"
+.LASF901:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF816:
+	.string	"__size_t "
+.LASF827:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF641:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF440:
+	.string	"USE_DASHBOARD "
+.LASF448:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF835:
+	.string	"__need_wchar_t"
+.LASF997:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF807:
+	.string	"_BSD_SIZE_T_ "
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1095:
+	.string	"defaultValue"
+.LASF432:
+	.string	"USE_OPFLOW_MSP "
+.LASF822:
+	.string	"_T_WCHAR "
+.LASF960:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF847:
+	.string	"USE_BARO "
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF458:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF431:
+	.string	"USE_OPFLOW_CXOF "
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF911:
+	.string	"_STRING_H 1"
+.LASF475:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF404:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF989:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF986:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF824:
+	.string	"_WCHAR_T_ "
+.LASF1060:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF425:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF886:
+	.string	"USE_ITCM_RAM"
+.LASF1032:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1000:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF477:
+	.string	"USE_VTX_CONTROL "
+.LASF885:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF826:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1052:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF950:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF511:
+	.string	"__USE_GNU"
+.LASF815:
+	.string	"_SIZET_ "
+.LASF941:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF853:
+	.string	"USE_UART6 "
+.LASF1014:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF905:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF417:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1091:
+	.string	"reset"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF510:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF878:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF918:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF868:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF880:
+	.string	"USE_ADC"
+.LASF987:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF876:
+	.string	"USE_1WIRE_DS2482"
+.LASF944:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF877:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF982:
+	.string	"PG_GPS_CONFIG 30"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF543:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1026:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1021:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1072:
+	.string	"short int"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1004:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF990:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF976:
+	.string	"PG_SERVO_MIXER 21"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF520:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF873:
+	.string	"USE_PITOT_MS4525"
+.LASF405:
+	.string	"USE_64BIT_TIME "
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF962:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF970:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF426:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF932:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF798:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1056:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF933:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1055:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF898:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF1059:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF819:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF531:
+	.string	"__USE_POSIX 1"
+.LASF1023:
+	.string	"PG_INAV_END 1023"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1018:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF964:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF833:
+	.string	"__DEFINED_wchar_t "
+.LASF984:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF927:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF466:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF930:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF438:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1044:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF888:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF544:
+	.string	"__USE_ATFILE 1"
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF829:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF879:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1046:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1015:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF521:
+	.string	"_DEFAULT_SOURCE"
+.LASF454:
+	.string	"USE_STATS "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF849:
+	.string	"USE_UART2 "
+.LASF1111:
+	.string	"gvGet"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF834:
+	.string	"_BSD_WCHAR_T_"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF464:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF523:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1037:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF528:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF532:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF875:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF860:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF889:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF865:
+	.string	"USE_SERVO_SBUS"
+.LASF526:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1033:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF882:
+	.string	"USE_RX_PPM"
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1066:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF449:
+	.string	"USE_D_BOOST "
+.LASF1099:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF460:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1098:
+	.string	"globalVariableConfigs_CopyArray"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF926:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1087:
+	.string	"pgResetFunc"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF857:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF978:
+	.string	"PG_RX_CONFIG 24"
+.LASF870:
+	.string	"USE_RANGEFINDER"
+.LASF965:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF797:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1011:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF453:
+	.string	"USE_LOG "
+.LASF397:
+	.string	"USE_RX_PPM "
+.LASF1075:
+	.string	"__int32_t"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF406:
+	.string	"USE_BLACKBOX "
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF786:
+	.string	"_STDDEF_H_ "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF479:
+	.string	"USE_VTX_TRAMP "
+.LASF506:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF945:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF895:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1003:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF988:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF928:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF972:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF916:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF485:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF529:
+	.string	"_POSIX_C_SOURCE"
+.LASF418:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF963:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1070:
+	.string	"long unsigned int"
+.LASF459:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1001:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF436:
+	.string	"USE_TEMPERATURE_SENSOR "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1142:
+	.string	"long-double.h"
+.LASF1154:
+	.string	"__locale_t.h"
+.LASF1132:
+	.string	"platform.h"
+.LASF1134:
+	.string	"target.h"
+.LASF1136:
+	.string	"libc-header-start.h"
+.LASF1156:
+	.string	"stdbool.h"
+.LASF1121:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1113:
+	.string	"src/main/common"
+.LASF1125:
+	.string	"stdint-intn.h"
+.LASF1120:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1123:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1143:
+	.string	"stubs.h"
+.LASF1115:
+	.string	"src/main/target/SITL"
+.LASF1140:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1119:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1155:
+	.string	"strings.h"
+.LASF1138:
+	.string	"features-time64.h"
+.LASF1124:
+	.string	"types.h"
+.LASF1114:
+	.string	"src/main/config"
+.LASF1122:
+	.string	"/usr/include"
+.LASF1112:
+	.string	"src/main/build"
+.LASF1149:
+	.string	"sanity_check.h"
+.LASF1137:
+	.string	"features.h"
+.LASF1129:
+	.string	"global_variables.c"
+.LASF1145:
+	.string	"typesizes.h"
+.LASF1153:
+	.string	"locale_t.h"
+.LASF1146:
+	.string	"time64.h"
+.LASF1126:
+	.string	"stdint-uintn.h"
+.LASF1116:
+	.string	"src/main/target"
+.LASF1117:
+	.string	"src/main"
+.LASF1139:
+	.string	"wordsize.h"
+.LASF1151:
+	.string	"config_reset.h"
+.LASF1128:
+	.string	"global_variables.h"
+.LASF1147:
+	.string	"wchar.h"
+.LASF1133:
+	.string	"common.h"
+.LASF1118:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1130:
+	.string	"maths.h"
+.LASF1152:
+	.string	"string.h"
+.LASF1141:
+	.string	"cdefs.h"
+.LASF1135:
+	.string	"stdint.h"
+.LASF1157:
+	.string	"build_config.h"
+.LASF1148:
+	.string	"stddef.h"
+.LASF1144:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/common/global_variables.c"
+.LASF1150:
+	.string	"common_post.h"
+.LASF1127:
+	.string	"parameter_group.h"
+.LASF1131:
+	.string	"stdc-predef.h"
+.LASF1158:
+	.string	"parameter_group_ids.h"
+	.text
+	.section	.gnu.lto_.profile.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 m\265\002"
+	.string	"D\004a"
+	.string	"\t"
+	.string	"\317\362\243\373\013\006\002"
+	.string	"\002\001\001\364\323\271\202\017\006\002"
+	.string	"\002\003\002\240\342\234\212\n\003\004\223\276\262\271\017\005\325\257\244\275\016"
+	.string	"\006\367\201\234\223\006\004"
+	.string	"\002\003\007\255\310\312\267\t\b\240\342\234\212\n"
+	.string	"\006"
+	.ascii	"Q\211\322y%\245!\334\343\273\227`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 M\205\001"
+	.string	"\250A"
+	.string	"\005"
+	.string	"\001\001\001\002\003\001\001\004\003\005\002\002\001\006"
+	.string	"\001"
+	.string	"\013"
+	.ascii	"G\005\324\214\033\352\002\260\201\331\016\207\001\264i\021\240"
+	.ascii	"\022\343%\214\r`\001"
+	.text
+	.section	.gnu.lto_.inline.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`;"
+	.string	"]\005"
+	.string	"b\311\035&\200EI\007\273\013\200\0340\314\205 \331"
+	.string	"L\235\\\267\320P\335\324o\030C\214"
+	.string	"h\002Tx\204\r5B\266\334)\377\317Q2\245\246o\317e\246$x\231p\377\231\304. \002\001`f\324\n\021uf\247\212\201\210\321\257\263\305\242\252\270[\242\023D\f\254>8\232\265s\367\253\332\266=\255 b\263\375\367:ED\\\036j#s*\364\r\352#s\032\374\332\f\001\024"
+	.string	"\302v\230d\003\254\020\024\210\213\205\036Y\020C\303\270.KZ\314\200u\3418\212\013\274`\231n\206R1D\005\270I"
+	.ascii	"\247\016gQ\027\026`\b"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 y\005\002"
+	.string	"\324\002m"
+	.string	"\005"
+	.string	"\001\001\003\177\002\001\001\002\001\001\013\177\002\004\001\002\005\006\004\177\001"
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\001\177"
+	.string	"\004\004\005\004\006"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"I\350\300)~\301bW-\333\013 0h\003"
+	.text
+	.section	.gnu.lto_.pureconst.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\231\004\004\204\004\005\230\004\006\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 y\025\002"
+	.string	"\244\002m"
+	.string	"\005"
+	.string	"\001\270\006"
+	.string	"\001\002\006"
+	.string	"\001\002\005"
+	.string	"\001\001\002\274\001\002\007\001\b"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	""
+	.string	"\004\001\300\007"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\t"
+	.ascii	"[-\250\2026\200\323\232qw1r\336\210i\007\330\262\001,"
+	.text
+	.section	.gnu.lto_.lto.a5f0d8f6aaba062,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_globalVariableConfigs_Registry.18.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"D\ba"
+	.string	""
+	.string	""
+	.string	"3"
+	.string	"\005\001\212\001\202\200\200\374\342\303\254\276\023\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\250\326\030us\337\007uq"
+	.string	"\005\001\006'\0010\377\007?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"%./src/main/common/global_variables.c"
+	.string	"\004"
+	.ascii	")\302\303,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_globalVariableConfigs.19.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`.\002U\022"
+	.string	"\226\"zH\320\360(\035c\037\341\013;\035\357\206\344\324\024\240CUx7\244_\241\335\207\210\214\266O2\215PJ@AM-\367\340D'CU\277\214:8\034\200\237z"
+	.string	"$\316+\271h\335\027T\022PfL\202x\364\311\336r\247\024e"
+	.string	"^"
+	.string	"f"
+	.ascii	"\036\2737QH\2738\005\016\351\3704\356\253\357\263\343\002\276"
+	.ascii	"O\323\354\031\003^TK1C7v7\324\021\226\227\270[F\332\247\324H"
+	.ascii	"\363\205\356\341cc2\272\271|J\325\256'\004\200\333\213d@s\264"
+	.ascii	"\273\356Q\346f\213\222g\346z\335W%rLF\267\231\307\324\310\356"
+	.ascii	":z\270\201\270\277\333f\261=\301\216\020\002HP46\362l\234KT\034"
+	.ascii	"\373\336\365\320 Yol\360A\177\352\271[>Zct\214\321WQ\210!Z1\355"
+	.ascii	"~\350\345\330\0303\311\304s\277\375\331\242\304\307\371:\203"
+	.ascii	"3\251\304\266\237\342*h\317YIn\321\203\237\027O\273\313\3724"
+	.ascii	"J\307\347\207<h\317\241\222G\373?\007\242=\250\345\001Np\251"
+	.ascii	"\240\036F\204-\366\034\200u\333\302Y\204M;\373^o\366\025\237"
+	.ascii	"\316\023\207\335[\351\263/\274(\203\201\246\335m\340\023i\330"
+	.ascii	"P \207\304\247\337\362}\"\310\251\0215\245\252\207A\241\272\227"
+	.ascii	"\276k\324\303\234\260\305\236\245^\325FLT-\366\374\002\222\261"
+	.ascii	"\221\247Js\264\343Q\263\376\334\035\324\324t\227>6\327\t\260"
+	.ascii	"[Dd\301\313er\022\002B`\206\002;Y\211\221DX\331\0052{\245\230"
+	.ascii	"\264`\262\026\006\t)-\223X\nJ\270\022SQ\211\271\302\025XK%t\311"
+	.ascii	"f!\310\001\307*\274d!K,&\013A\334^o,t\271S\003\365TS\333T\034"
+	.ascii	"\247\\(\250\352\024Y\227*#\225\304\251C\304\001\303F\352H-\362"
+	.ascii	".ww%\250\317\375\243\026y\001( p\002)\245\201\036m\236M\231\315"
+	.ascii	"i\366\b\rx\362\360.\252\265w'\244\301\354\313p,\27070\217B#\n"
+	.ascii	"m\273c\r\261\3771\003;\006\303\320\022\320U\206\016\314@+(c\310"
+	.ascii	"\315A\016\b\023\262\217G\007\312\031\300\265\b\217a\232\370F"
+	.ascii	"\n~-\032\"\334+\366x\300DLW\177\002"
+	.text
+	.section	.gnu.lto_gvGet.20.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`\325"
+	.string	"\315\013"
+	.string	"f\027SA o\224\016\303\220n\n\256>!8\322\302\253Q\302<\001\270\341\202\024"
+	.string	"p(\226\250\276\020\350\343f\364\373\201Y\2543\372\t#\030\302!\030\215T\005\330Ol\315\356\006\240\001\254~\213do)S\n@"
+	.string	";"
+	.string	"A"
+	.string	" H\356\340\267\301\313\244\340\030\301bw-\313\tT\217\360\003\252G\325\360\356P\263\363K\207\024\017+L\036\206k"
+	.string	"o\003Zv\367\250g\207\247\221\211\301\331]\247\311\273p\307\333N`{\201\375K\366WJ=\331\207\253\037\266\323\361!\277:\235\232~\225$G\241b\327\243\304\305\232\210# \266Iv\305\216\035\020h\332\231\r\351!#\353n\006\020\022\273\337\305\232\311\243m\377\303\003\035jN\206j@=\271\302Et\223\335=\340\207\270H\310\347\360h\t\242\274\351\321\027U\217Q)#\252W\230\342x\221\221%\326R\271\273%\325\223\365\243J\025\023Im$\211\217\272\202\022'6[\004\336l2Z\2069\320`\nP\320\032\200:\321\031&\244y\260\253\303]\023\030x.l\363<\260@\333\347\263e\026\250s}\254\214\013Y\030\003\336 h\234\025a\3338\253\362\355\341\352\207\001xXH\277\253\216\272"
+	.string	"\215\232\032\017"
+	.ascii	"\331\323!W\323\251\326\030\307l\321c\211\243\320\317\313RK\365"
+	.ascii	"(0v\270&\302f\241\245\212\tQ\252\032F\035\337\332R\006"
+	.text
+	.section	.gnu.lto_gvSet.21.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`\303"
+	.string	"\335\013"
+	.string	"\326\226TC\020\2176\035Cd\025DAH\270\b|\311O\356s\006\022\021\244\374\316B\240zn@\303\233\376G\374\363\236\030\030\320{\357\225\206@)\002\200\\\"U0\355\254|a\310\242\235W\005ah\266\355-eJ\001A"
+	.string	"@"
+	.string	">"
+	.string	"\036\232Gs\266\213\001\243\r\230\023\0230v\227R\016\347\01659\377\244gt^\311\241&\303\025\"hA\361\002\200g\0027(\037\272\223\236\027<Qf\006dw\235\235\207\341\216\267\235\3006\003\373\002\002(10\313\022S\200\260}\373$8[\303\216\336\207\346I\276\210\217\340\376Up\306\356\206\023\245\335\345\360\002\315c\201o\246G\370"
+	.string	"\323c\034}d>\204;:\334WH\254\273\032<\224v?\016\007\223E&\344;\237t\220\221\226X\365\352<\211\021\312\230wpi)\251\252\350I&U\253\304\n\223t\361\346\205\305\346\213\375\211RU\354\303\325\024\373\337?}\345\327L?c\300\302[\250\330\r\230HV\215Dw:\035\330e=\360\340\020\240\2009"
+	.string	"y\242/N\b\226Y\225g\253F\032d\225\245e\020(\220\366\371h\027\005\362T\037\352\332B(\316\001k\021\260\215\222\240i\033\245\361\205\016WS\024x,!\025\301)\003\016"
+	.ascii	"\331\323\341\214i\0162\314`\253\f\303K\225\fo\306@z\361\3124"
+	.ascii	"\341\302\250\307\214\305qm\304\024\222\306\240\366"
+	.text
+	.section	.gnu.lto_gvInit.22.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`T\002\265\023"
+	.string	"\006\244\201J\300\322Q: \202cv\216\274$wL\277*@\315 \265\016\024\250\007AG\t\361\246\242p\227\340\b\342{\200\252\246V\365v/B?\340\302\267\034\301\245\272\256\242\260r\375\334(\343e\202\267\226\205\312\222\371\370\225\354\275wJ\001g"
+	.string	"i"
+	.string	"p"
+	.ascii	"=7\255pB\254\224|;R\273\233\362\352\225\325+\312\005\204\257"
+	.ascii	"\364\001\302\327\263z|\f\332\373p\034\222\204\354\2568S\230\236"
+	.ascii	"\2167\225\265W:e\3157z\001]\020\\\016\347\225\226\004\211F\230"
+	.ascii	"\3446\320\005;`\360\343\345N\356&\351\020\317\347\307\037\320"
+	.ascii	"9\341r<\227#.\273k\211\313\211\270\303\333\246\331\256\331\362"
+	.ascii	"AT\376x\372\342G\376z\240VR\331\343MN\240 \321\216\311\363\204"
+	.ascii	"\375^\357\226R\372#\253\035:V\f\300\261\013\242\252\310>\325"
+	.ascii	"\033-\336\373\355\373\3462|$\022\023?\030\273\313\262]\333\245"
+	.ascii	"\245B:&\236\220:\325\222\362\276\233\317p\023\0357gR\004\324"
+	.ascii	"\001\222\340\325\016V\257T\252\345\363\374\321\254W:\325z\214"
+	.ascii	"\037\325\036>7Y\345\223_\017\324\264\r\330I\220_\343\300\230"
+	.ascii	"\230\214<N&|\245I8\037\226\235\306\314\306\203\013\037\336nN"
+	.ascii	"\353I\266\315\227(\220t@q+\342\355.\203\337\225j|\241W[\300 "
+	.ascii	"\217{\3655\314\026\025G6Ye\337\367\217\007\02044\016\2212q\372"
+	.ascii	"Y\244\277\207\205\356\003\217\037\363\276\243\224\374vs\007\f"
+	.ascii	"\016M\247\374\275\267\224\260\311\226\220\001\006\201&\366\022"
+	.ascii	"\232\205E\001\354\005\023aE\205@\354~\251\324\300f`\\1\232\353"
+	.ascii	"\302\313\214\013f6\023#\322\314d\262\331K\244\211\271d\342\213"
+	.ascii	"V#\252\030\360l\002\214&V\230\315h\"k\264\335\350\253\037\211"
+	.ascii	"'\333\274\325\t\344\221\0343\2343J\246\\\316\035\333\246wS(g"
+	.ascii	"\203\250\034I\304\351\307\305&\251Nwwi8\337;\n\202\313\031\316"
+	.ascii	"\353\004- P\002A\n\253\016?#W\245\035\212-2\034\247\260\246\t"
+	.ascii	"'J\354kX\303\3531\260\324t\255x\321\245'kA,8h\220\242\241\034"
+	.ascii	"\215\246\016\016D\367X\215\375\311\230\300H\267\235l\353\362"
+	.ascii	"5\320\342\335\302d\247\0377\023S\220\032v)\310\332\241@\243\262"
+	.ascii	"\025g;r}\351G\004\027\204\240\261\360\270\321^\250\037\357M\244"
+	.ascii	"s\231'"
+	.text
+	.section	.gnu.lto_gvSet.part.0.26.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`3\003e\026"
+	.string	"\026\247\212J\260\022R:\n\f|\224\257s\341\332\327\0357\267RI\223E"
+	.string	"\313\373\333B\316\366c\250\265r;C\261\321U\177\332(\023W\333\324\257\313\262>i\037\365\215\013[_\312/H~\316\357\031<\027\300\275\204\243\261\247m\223\275S\nl"
+	.string	"x"
+	.string	"w"
+	.ascii	"W\272\361\310n\220S\324\356Fx\275\246\274\200\353\225\274\211"
+	.ascii	"\353\325\275#\341\274\334\036a\335y\241\363In\221\371\216\204"
+	.ascii	"c\272\373S\024\265[*x\265\313\353\325~\013\333=\333\352%\321"
+	.ascii	"\n\355\263\255Nv\002l\361\020\263v7\366JO\334w:I\237\177\342"
+	.ascii	"G\202\303\234S\222a\210O\002'\0014\330]\277D\334\365\266e\266"
+	.ascii	"=\330\324\026t\232\322\351\371\244\377$\003TH\354\366\024\331"
+	.ascii	"Z\240*\245b\n\245z\336\221\353SB\020\002\226+\216:\r\236w'%\021"
+	.ascii	"\b\330T\031{u\371\272\211\313\207z\312\225,\260h\353\352N\274"
+	.ascii	"\303\360\233\250\221\013\026\273\333K\001\226*<\216G+\257\365"
+	.ascii	"\007\023\3572l\024`T\344\361\211y\f\336\364\211=\033\346\023"
+	.ascii	"}6\314\275+\335\220\345\016\205u\370B\316/\371\345_\370\0027"
+	.ascii	"Hzc\217\"\214\017\250\247\342_\005d\323\334\206\r\005+\353\347"
+	.ascii	"h\027\270`\303kX\030\351`B\247x\264\273\f\214\237\302\371E\257"
+	.ascii	"\316a\230\017\356\\\257\224>\b\212$\237\351'\376e5\343(\344\352"
+	.ascii	"\347\364\007UA\333\364\217H\341\363a\005\326\244gz\312oj\371"
+	.ascii	"t\322\003F\036\"\277Y\304\265!:vjM:dJ\236\334\3355\025\262\351"
+	.ascii	"\264\353K\177\245\323d\256 \343\252\361n3\233j\231\254\245F\233"
+	.ascii	"\241\340\302\202@CmB\215\255\232\306\262\253\335ff6\335\314F"
+	.ascii	"\3466\233\311\335hb59\034.G\213\325\330f\270\030M\267\213\261"
+	.ascii	"$p\356BM\027\313\220\313\351b0\333\363\344R!\007\303\343\217"
+	.ascii	"\352P:d\333E\235\343\006\205\310\257\372Q\002L\314|0fG\020H\311"
+	.ascii	"\244\224\244\225\3323\332|\320E_\002\210\003\315\261];\016\233"
+	.ascii	"\001*(\252F\250a8f\020d$0\tD\206\244\264)6`\002\231Dg\007\022"
+	.ascii	"\300h!\203,\234Y\330\332\365\016\263\025\320(z\240\251\212\233"
+	.ascii	"\366\321\244\202%\337,\217\002\234\336@\333\335\312\016U\020"
+	.ascii	"\336b\331u\223'\366\034B\377\232?\3123\021L\306\350HR\2640\333"
+	.ascii	"\306\352\003\240R1\217\261\261t\224\252w_\305\225`,\341\227\002"
+	.ascii	"M\235w\017\225@\2071\272\222\261|\217Q\f@5\274\020\016\311\374"
+	.ascii	"|p \241\224,Rd\006R\376\301\300\033\372\321DS\224\016\270\212"
+	.ascii	"\331\020+\203z\025\377\361\302\024"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 \340\005\005"
+	.string	"\324\007\334"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\023\177\t\320\231\263\346"
+	.string	"\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\320\202\002\032\177\n\200\200\200\200\004\271\224\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\017\013\301\204\001\016\f\300\003\002\024\177\r\272\220\025\177\016\026\177\017\005\022\020\305\204\001"
+	.string	"pg_registry"
+	.string	""
+	.string	"\005\020\021\001\027\177\022\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\002"
+	.string	""
+	.string	""
+	.string	"\003\001\t\244\007\003\005\001\320\360\372\250\001\001\202\001"
+	.string	"\r"
+	.ascii	"\004f\004<\277q\030\002\203\275\203\234\235/\2003\2160\340\247"
+	.ascii	"N\203\030XB\005\024\335`\342\001"
+	.text
+	.section	.gnu.lto_.refs.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375 +Y\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	"\002\007"
+	.string	""
+	.string	"\002\f"
+	.string	"\001\003\016"
+	.string	"\001\004"
+	.string	"\003\005"
+	.string	"\002\006"
+	.string	"\002\t"
+	.string	"\001\003\n"
+	.string	"\003\007\002\002\002\b\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.a5f0d8f6aaba062,"e",@progbits
+	.string	"(\265/\375`\301\017\305P"
+	.string	"Z\215\350\036S@\216BJ\007'\340\346\026/\302\"\030\333wC\262\240\034x\353\003\320&\n7\206\361\251\265\342\231o\200{\032|qc}\001\354|\353\366Q\024\207v\275\3131\252Lr\034V3\004\006%\232#\234Ac\320r\032\026\0046F\023\034T\027\367\256\331nR\246\237\001\317\001\346\001L\r\345\310>!\233QK\241\261)M\252V:\215K\325l\314dm\032\317^\267\036\255(^Lw\210=\333\256\003\226\313[\270\270\316\310\325Y\335\347N\t9+\2716_\365{"
+	.string	"o\347\366"
+	.string	"!\266,\030\031&*\246_\263\325\262Rx\331\r\326\335\004\324\032\256\360\330b\272\275><\2365\301[2\241o\231\t^Ry\266\027\005K\244\256\230\352\276Ad\341)3X\240N\234'0\265*L\377\035\373\027k\263VL\207tZ\266W\367\331C\317"
+	.ascii	"i\362\204i\330\t\035&\261\036\324\230~\237\324\257\326V\025\b"
+	.ascii	"\246\254\024\035\234n\246\027\325f\375B_+\373\265RP4u3\211\004"
+	.ascii	"\300\205\345\013\b\\w\203-\226\275\262]ke\251|\275\266\312\351"
+	.ascii	"\331}\354\356\237\237\237\023:a\236hY\253\364\305\372\264\365"
+	.ascii	"\341\365Z\250_\241\356\271@l\327\313\266\371\375a\265\216s<\273"
+	.ascii	"\331\335;\233D\2131\t\323\227P{C_\256\017\260\326\355\342\274"
+	.ascii	"\nCw\367\276\214w\256)\326\207G\317\365\341\3255\301\333\016"
+	.ascii	"T\020\340_"
+	.string	"5\233\202\334\242\240\363s\001\377\3416\204\273\235\360\363\316\177+\377\257\374\007c\241\376\373\345\337\b\376\255\340_\n\376\215\361/\214\177'\370\327\002\020\376M\361\357\320\277.\366\203\377;?\033\377\365\340\337\f\376\275\340\337\336\1776\377\336\374\273\377\347\376#\361?\315\177-\377\307\376\207\375o\376\347\362\177\313\377,\377\305\376\317\370o\342\377\331\377\233\271\271\271\271\177\245~\376\341\357\221\020\347\322G\262\225\311\025\264\315\333\"\261k\336\226M5v\033O\004\342\2008\251Z\343\024\247\033\340\276lr\326\214\261:b\321r\276\302`\365\220\302\033\003\345\b\223\032.\365\034VwXC\333e\275|\323\276e\3226\315*[W\346\f\210\023\270V*W\354\246\240~0\265}\323\374L\257Q\354\226\230\\\raz5\213F\005,844g*\023\226\323\030\246S\036\361\362\306\264k\315,\225\263]\230\362vEf\213\370q"
+	.ascii	"\340j\333\372\301\364\274\254\3371\377q\230KM\016\215\351\262"
+	.ascii	"\325%\206R\261C\302\234Ea\372e\373\227l\277\254\030\027\272\217"
+	.ascii	"t\252\b\031#L\227\210\r\363\025\263`\304\f-\273\223V\314N\\w"
+	.ascii	"\322\316\256\002\273\n\320\253\250\035\276x\364,\244\236X\037"
+	.ascii	"\336\252\t}\327tbfKqLy\217\250?\377\274\356\037\273\263\305\224"
+	.ascii	"z\337\335w\305_bu\273\300\177\035\002p\335E\252\336xC0\205\274"
+	.ascii	"=E\323\356]\237\314\344\"\233\313'ds\231\\$\227\244'd\223\371"
+	.ascii	"\324\203<\036\237\252\216\314\345\"\217\235\354\223\331<\335"
+	.ascii	"\235L\036"
+	.string	"\333\330\323\315|\342\351\263\205t\263\215\365\330O}\\vMz\352\346\231\354A6\231Id\223i\354A6\223\236\220\275l\236>\245\222\335Lc\217\f\315\244d7\227O=\335dvS\021'\326\266\021\251bR\322\347\262W-\210\223i\\\352fR\211\356v:\251\214\275\356\244d\033\327\270G3\333zt\221\3364\253S\252\273\273\215^lQK\234S\251\323\220P\2266\226\272\331\272\307\220q\215gw3\265\222q\273\227\316d\267\322\322\005\345r\3010%\273D\037\223\234\224\242\226\275%\245e\347!\333\3053\360y\002\210\323\030\300\025\224\003\024\316)\210\026\323-\006sK\243fV\277YF\370\210\326\030&/\263\330\224\260\016Q\320\242x\251c\354\351\226\362BU\305Z\374\003c\261\025gm\027_1\2233\024\0239\262\024_\361\024'\3314$\027du\341\"W\334\204\243l\232\222\247\217X\314\264\375\374"
+	.ascii	"\300\203\231FD\207\032\271\031\024JH\031ZE\264u\237\377\271\007"
+	.ascii	"\366a\2738\312O\234\335^Qx\007\206\262i\312\263\177\344\\9\277"
+	.ascii	"d\201\353>\177"
+	.string	"\n\370)a\004\030\266!<(Ot\300\316\034\334\230\262\223\033\245\220\263\035ST\333\305<T5UcmnF\213\222(f=\205\252\247>\226T\"\332\210\320\246z\272\2432\016\234\303v\251`$_5\226\372.\351\354\223\227$Q\245+\256~U\360tss\253\202w\335\021\225g}x\327\241\251\327\221\251?\037\341\345\2569\304[\227%\332\0274'\24505\305\2125\301c!l\003\337`u\305\270\243K=+EP\342\305\nS\3124\234k@b\203\231\233\020\365\f\204\203\3748;I\266&\033\253\347\037\300'\037N\230\362S]\3225U\354\252\230X1cz~z\t('RSL\331\207\3209\271\263\341\354\310\022\2469\272\251J\303p\323Y\006nb\247\n\272x\264\321 a=\332\\\315\331i\rJ\223/\036E\352\256\310\020+\235w\260\0223\311\350\366\321\242\214\216\0309 h\274tfZ)"
+	.string	"\220%\241$\t\332.jM\231\260\243NY\351\220\241\263\261\213\215\273e\207\004A,\254\255\223I\007\256;V\232\303\3207\256k\343vN\306\331F\236\234\020I\245\003\273e\314\rL\222X\271\025;\356\360\320\203,\rS\035\013^\253ws[6\274\356\r>\267\001D\264Q\364\031\031 \f\372\206E\242\360\250\bG\007\322\221\006\t\024o\003\b\t\307\321\020H4\374\025\177F\276\241\017)\250H\210#GX\203\207;\"Q\257H$\004\"\355\204@$]\221\350\205P\375\305\020$R\"\3617\244A\303w\243\003\351\250\210\016\213H:\032?!0x\303wC\343G\304A\205G\301b\321\217x\363!\021\020\251\247cX$\006\201?\023\210\210\b\024\203\302\016r"
+	.string	"y\305\037\0079\200\273_\321W\234aB\207o8\304\300\350W$\352\230A\244\300\216\005Pq\350C\002*\376f\344"
+	.string	"\366^\364\213!h\024,\"\035\325\023G\320\r}6\212(\221H\270A\361G\374\231"
+	.string	"DJ\340E\301\341O\370\003\326\017\275x\340\005\f\030n\016#\006\213\030,x\207\021CH(\306\013\241\372\027B\272\"\021\214\2420\210\343\246x\033\r\374\b\3517\f*\036\035\r\203r~8n\370R(\336\300\341\253\361\243\321#\022\001\2035\204G\032\2440\2000h\244+\022\265\200\240(\f\336\334\205\213\026\277\242\027j\f\001\241\270\004\022h\220\002\005\0218\250E@\304\337\215\027|\301\241/\007\321\r\337\013G7\200A\302##\243\243\242 a\320g\024T4$\006\0011"
+	.ascii	"\203\317H\267\205\277tI\346\310\334\230\236\315\036\231//j\230"
+	.ascii	"\356\324\302\330\214\307\302\270\f\307\230c\006\306\343\n\256"
+	.ascii	"\225AV\374\234\345\\\306d\272$A\254\314\230\214\203\350\235\211"
+	.ascii	"\242r&\\C\026'\206\004\013\233-\247e\023_\231k\202\203\016D0"
+	.ascii	"\330\246i\202RB\303\224N\031\332.?7\317S\232\374\265\\\355C\200"
+	.ascii	"\26162Wp\335\312\025:UKAz\340*\347\257\2622okL\331\253\266\251"
+	.ascii	"\262\005\206)S\2719\353\022e\244\214\3220\206\205&e\247T)\223"
+	.ascii	"\2413\027s\355\234\f\236\356\251,\261\235%b\3168}\251tkh\255"
+	.ascii	"\226g\b\201\033\250\201,\206\030%"
+	.ascii	"3$\"\"\"I\222\346\001\005\204 '1\274\016\022@\3270\315\f35%A"
+	.ascii	"\222\244\240\220\266\003HvE\330\205\017\r\002\n%(\027WN\fRs\201"
+	.ascii	"!1\353M>\311T\330\b\336\232\322\377ay\351\004H\232\2442\250I"
+	.ascii	"\272\002\270?\377\260%et\264fv\034\242`sH\260\254W\350|\220\262"
+	.ascii	"\023%\246\235%s=}\037\271y\322\0270pc\270\313\021z\323\262ly"
+	.ascii	"8;,\375by\222\231n\253\244m\240\243\314,\224\221\303\322Cd5x"
+	.ascii	"H\267ys\223\220`\300\022SJ\204\307\355\022\356\222=J\016\220"
+	.ascii	"u\377\216\204\304a\222\273p"
+	.string	"mb#\273\fc\007a4\236e\210\373\346\nB4~\007\t\252\206\326\035\214\255\257\242M\306\016<\252\004\337\003Ih<\002lb\240\204\253,H!\347\372\320\242\262YT\350`\345\004\320.\006\244B\007\343\275\220\004\361\362O)8\031\237\310\307*}OBQ\343L\t\235\016}^u\363e\236\206\264`\233sd@\035\303\205\002J\3113Y\202@\350\374\013Nl\263i\235\241\250\360,\231\214u\017\272\017\021H\375,\204\234\304h\345c\365\n\321x\200g\342\252\b\210~\205_\331\266\362\205\330I\n\024G\257\3118:E\302\016\375S\024\357i\301>\350\247\205\3550r3\001\007\007\266\273 \026\331\035\t\330h\370\311\350\261O\241Id)\300.\230*\361\331\267\036S\202\250d,\277\005\344\220(m.\217\260\371\267/K\374\027 [a\030f\337\254\246\267\314\317M\344\n\370\307\357\025\212\030\376\t\035\023\274"
+	.string	"Nd\314y<\240\312\326\220\246^>\315\220u\242\322\031\316]\207)\236@}Q\244z@\025\034\347\303C\245S}4\275\005\272\025\247\265Fe\363$\036\003\001\276\250\030O9e\301\002\032Y\214\200%.\001\276\300\375X\022D3\324^R\277>\305'Y\236\n\303\220M\330\374\b\3663N/\313\244\362|&\363\254\226\313\331i\366\030a\264\234x\262\277\034\200\257\313,\362\240\230\203\370\351\324i\334\274\377"
+	.ascii	"\316\277\330\335\361\224\360\030\354\376'\241W\226%\375R\355"
+	.ascii	"\361\330\004W\356\313\341a\327\300\224o\024\251\002"
+	.text
+	.section	.gnu.lto_.symtab.a5f0d8f6aaba062,"e",@progbits
+	.string	"pgResetFn_globalVariableConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"globalVariableConfigs_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"gvGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"gvSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371"
+	.string	""
+	.string	""
+	.string	"gvInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"globalVariableConfigs_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"globalVariableConfigs_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a5f0d8f6aaba062,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14312 @@
+	.file	"log.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 5 "<built-in>"
+	.file 6 "./src/main/build/version.h"
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./src/main/config/parameter_group.h"
+	.file 11 "./src/main/common/time.h"
+	.file 12 "./src/main/common/log.h"
+	.file 13 "./src/main/io/serial.h"
+	.file 14 "./src/main/drivers/adc.h"
+	.file 15 "./src/main/msp/msp.h"
+	.file 16 "./src/main/msp/msp_serial.h"
+	.file 17 "./src/main/common/log.c"
+	.file 18 "./src/main/common/printf.h"
+	.file 19 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	log.c.2f42490a
+	.weak	log.c.2f42490a
+log.c.2f42490a:
+	.long	0xff2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x20
+	.long	.LASF2127
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1809
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1810
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1811
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1812
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1813
+	.uleb128 0x5
+	.long	.LASF1815
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1814
+	.uleb128 0x5
+	.long	.LASF1816
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1817
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1818
+	.uleb128 0x22
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1819
+	.uleb128 0x6
+	.long	0x85
+	.uleb128 0x5
+	.long	.LASF1820
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x6
+	.long	0x91
+	.uleb128 0x23
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1821
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x6
+	.long	0xb3
+	.uleb128 0x5
+	.long	.LASF1823
+	.byte	0x3
+	.byte	0x49
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.long	.LASF1824
+	.byte	0x4
+	.byte	0x28
+	.byte	0x1b
+	.long	0xdc
+	.uleb128 0x24
+	.long	.LASF2128
+	.long	0xe5
+	.uleb128 0x11
+	.long	0xf5
+	.long	0xf5
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2129
+	.byte	0x18
+	.byte	0x5
+	.byte	0
+	.long	0x12a
+	.uleb128 0x13
+	.long	.LASF1825
+	.long	0x30
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1826
+	.long	0x30
+	.byte	0x4
+	.uleb128 0x13
+	.long	.LASF1827
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0x13
+	.long	.LASF1828
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1829
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0xd0
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x6
+	.long	0x136
+	.uleb128 0xe
+	.long	.LASF1830
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x13b
+	.uleb128 0xe
+	.long	.LASF1831
+	.byte	0x6
+	.byte	0x21
+	.byte	0x1a
+	.long	0x13b
+	.uleb128 0xe
+	.long	.LASF1832
+	.byte	0x6
+	.byte	0x24
+	.byte	0x1a
+	.long	0x13b
+	.uleb128 0xe
+	.long	.LASF1833
+	.byte	0x6
+	.byte	0x27
+	.byte	0x1a
+	.long	0x13b
+	.uleb128 0x5
+	.long	.LASF1834
+	.byte	0x7
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x6
+	.long	0x170
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x272
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x25
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x43
+	.long	0x2fd
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x14
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1897
+	.long	0x30
+	.byte	0x1a
+	.long	0x31e
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1897
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x2fd
+	.uleb128 0x18
+	.long	.LASF1898
+	.long	0x30
+	.byte	0x20
+	.long	0x37b
+	.uleb128 0x1
+	.long	.LASF1899
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1900
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1902
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1903
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1904
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1905
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1906
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1907
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1908
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1909
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1898
+	.byte	0x9
+	.byte	0x34
+	.byte	0x3
+	.long	0x32a
+	.uleb128 0xf
+	.long	.LASF1915
+	.byte	0x10
+	.byte	0x9
+	.byte	0x37
+	.byte	0x10
+	.long	0x3af
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x9
+	.byte	0x38
+	.byte	0x14
+	.long	0x3af
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF1912
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x387
+	.uleb128 0x6
+	.long	0x3b4
+	.uleb128 0x5
+	.long	.LASF1913
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x10
+	.long	0x3d1
+	.uleb128 0x4
+	.long	0x3d6
+	.uleb128 0xa
+	.long	0x3e6
+	.uleb128 0x3
+	.long	0xa7
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1914
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x10
+	.long	0x3f2
+	.uleb128 0x4
+	.long	0x3f7
+	.uleb128 0xa
+	.long	0x40c
+	.uleb128 0x3
+	.long	0x3af
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1916
+	.byte	0x60
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x10
+	.long	0x4f7
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x9
+	.byte	0x41
+	.byte	0x24
+	.long	0x5b8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x9
+	.byte	0x43
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1919
+	.byte	0x9
+	.byte	0x44
+	.byte	0x10
+	.long	0x31e
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1920
+	.byte	0x9
+	.byte	0x45
+	.byte	0x13
+	.long	0x37b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1921
+	.byte	0x9
+	.byte	0x47
+	.byte	0xe
+	.long	0xb3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1922
+	.byte	0x9
+	.byte	0x49
+	.byte	0xe
+	.long	0xb3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1923
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xe
+	.long	0xb3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1924
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x17
+	.long	0x5bd
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1925
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x17
+	.long	0x5bd
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1926
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xe
+	.long	0xb3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1927
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xe
+	.long	0xb3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1928
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xe
+	.long	0xb3
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1929
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0xb3
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1930
+	.byte	0x9
+	.byte	0x52
+	.byte	0x1e
+	.long	0x3c5
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1931
+	.byte	0x9
+	.byte	0x53
+	.byte	0xb
+	.long	0x7e
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1932
+	.byte	0x9
+	.byte	0x55
+	.byte	0x23
+	.long	0x3e6
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0x9
+	.byte	0x58
+	.byte	0xe
+	.long	0xb3
+	.byte	0x58
+	.byte	0
+	.uleb128 0x6
+	.long	0x40c
+	.uleb128 0xf
+	.long	.LASF1934
+	.byte	0x68
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5b3
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xc
+	.long	0x5e8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x10
+	.long	0x601
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x10
+	.long	0x601
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x9
+	.byte	0x61
+	.byte	0xf
+	.long	0x615
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0x9
+	.byte	0x64
+	.byte	0xc
+	.long	0x62a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0x9
+	.byte	0x66
+	.byte	0xb
+	.long	0x645
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x9
+	.byte	0x68
+	.byte	0xc
+	.long	0x65a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xc
+	.long	0x67a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xb
+	.long	0x645
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xb
+	.long	0x68e
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1945
+	.byte	0x9
+	.byte	0x71
+	.byte	0xc
+	.long	0x69e
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1946
+	.byte	0x9
+	.byte	0x72
+	.byte	0xc
+	.long	0x69e
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1947
+	.byte	0x9
+	.byte	0x75
+	.byte	0xc
+	.long	0x6bd
+	.byte	0x60
+	.byte	0
+	.uleb128 0x6
+	.long	0x4fc
+	.uleb128 0x4
+	.long	0x5b3
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x5
+	.long	.LASF1948
+	.byte	0x9
+	.byte	0x59
+	.byte	0x3
+	.long	0x40c
+	.uleb128 0x6
+	.long	0x5c2
+	.uleb128 0xa
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x5c2
+	.uleb128 0x4
+	.long	0x5d3
+	.uleb128 0x14
+	.long	0xb3
+	.long	0x5fc
+	.uleb128 0x3
+	.long	0x5fc
+	.byte	0
+	.uleb128 0x4
+	.long	0x5ce
+	.uleb128 0x4
+	.long	0x5ed
+	.uleb128 0x14
+	.long	0x91
+	.long	0x615
+	.uleb128 0x3
+	.long	0x5e3
+	.byte	0
+	.uleb128 0x4
+	.long	0x606
+	.uleb128 0xa
+	.long	0x62a
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0xb3
+	.byte	0
+	.uleb128 0x4
+	.long	0x61a
+	.uleb128 0x14
+	.long	0x63e
+	.long	0x63e
+	.uleb128 0x3
+	.long	0x5fc
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1949
+	.uleb128 0x4
+	.long	0x62f
+	.uleb128 0xa
+	.long	0x65a
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x31e
+	.byte	0
+	.uleb128 0x4
+	.long	0x64a
+	.uleb128 0xa
+	.long	0x674
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x674
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x679
+	.uleb128 0x26
+	.uleb128 0x4
+	.long	0x65f
+	.uleb128 0x14
+	.long	0x63e
+	.long	0x68e
+	.uleb128 0x3
+	.long	0x5e3
+	.byte	0
+	.uleb128 0x4
+	.long	0x67f
+	.uleb128 0xa
+	.long	0x69e
+	.uleb128 0x3
+	.long	0x5e3
+	.byte	0
+	.uleb128 0x4
+	.long	0x693
+	.uleb128 0xa
+	.long	0x6b8
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x6b8
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x3c0
+	.uleb128 0x4
+	.long	0x6a3
+	.uleb128 0x5
+	.long	.LASF1950
+	.byte	0xa
+	.byte	0x19
+	.byte	0x12
+	.long	0xa7
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x21
+	.long	0x6fd
+	.uleb128 0x8
+	.long	.LASF1951
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF1952
+	.value	0xf000
+	.uleb128 0x8
+	.long	.LASF1953
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1955
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1956
+	.byte	0xa
+	.byte	0x2a
+	.byte	0xf
+	.long	0x709
+	.uleb128 0xa
+	.long	0x714
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x27
+	.byte	0x8
+	.byte	0xa
+	.byte	0x32
+	.byte	0x5
+	.long	0x733
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x19
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x733
+	.byte	0
+	.uleb128 0x4
+	.long	0x6fd
+	.uleb128 0xf
+	.long	.LASF1957
+	.byte	0x28
+	.byte	0xa
+	.byte	0x2c
+	.byte	0x10
+	.long	0x792
+	.uleb128 0x1a
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0x6c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1958
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xe
+	.long	0xa7
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1959
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xe
+	.long	0x792
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1960
+	.byte	0xa
+	.byte	0x30
+	.byte	0xe
+	.long	0x792
+	.byte	0x10
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x797
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1961
+	.byte	0xa
+	.byte	0x35
+	.byte	0x7
+	.long	0x714
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x4
+	.long	0x792
+	.uleb128 0x5
+	.long	.LASF1962
+	.byte	0xa
+	.byte	0x36
+	.byte	0x3
+	.long	0x738
+	.uleb128 0x6
+	.long	0x79c
+	.uleb128 0x5
+	.long	.LASF1963
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x12
+	.long	0xb3
+	.uleb128 0x6
+	.long	0x7ad
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x15
+	.long	0x813
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1976
+	.byte	0xc
+	.byte	0x23
+	.byte	0x3
+	.long	0x7be
+	.uleb128 0xf
+	.long	.LASF1977
+	.byte	0x8
+	.byte	0xc
+	.byte	0x27
+	.byte	0x10
+	.long	0x847
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0xc
+	.byte	0x28
+	.byte	0xd
+	.long	0x91
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xc
+	.byte	0x29
+	.byte	0xe
+	.long	0xb3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1980
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x3
+	.long	0x81f
+	.uleb128 0x6
+	.long	0x847
+	.uleb128 0xe
+	.long	.LASF1981
+	.byte	0xc
+	.byte	0x2c
+	.byte	0x14
+	.long	0x847
+	.uleb128 0xe
+	.long	.LASF1982
+	.byte	0xc
+	.byte	0x2c
+	.byte	0x39
+	.long	0x847
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x1a
+	.long	0x88f
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1986
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x3
+	.long	0x870
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x20
+	.long	0x955
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF1996
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF1997
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF1998
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF1999
+	.value	0x800
+	.uleb128 0x8
+	.long	.LASF2000
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF2001
+	.value	0x2000
+	.uleb128 0x8
+	.long	.LASF2002
+	.value	0x4000
+	.uleb128 0x8
+	.long	.LASF2003
+	.value	0x8000
+	.uleb128 0x10
+	.long	.LASF2004
+	.long	0x10000
+	.uleb128 0x10
+	.long	.LASF2005
+	.long	0x20000
+	.uleb128 0x10
+	.long	.LASF2006
+	.long	0x40000
+	.uleb128 0x10
+	.long	.LASF2007
+	.long	0x80000
+	.uleb128 0x10
+	.long	.LASF2008
+	.long	0x100000
+	.uleb128 0x10
+	.long	.LASF2009
+	.long	0x200000
+	.uleb128 0x10
+	.long	.LASF2010
+	.long	0x400000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2011
+	.byte	0xd
+	.byte	0x39
+	.byte	0x3
+	.long	0x89b
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x3b
+	.long	0x9d4
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x10
+	.byte	0
+	.uleb128 0x11
+	.long	0xbf
+	.long	0x9df
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x6
+	.long	0x9d4
+	.uleb128 0xe
+	.long	.LASF2029
+	.byte	0xd
+	.byte	0x4f
+	.byte	0x17
+	.long	0x9df
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x64
+	.byte	0xd
+	.byte	0x52
+	.long	0xa4b
+	.uleb128 0x29
+	.long	.LASF2030
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2043
+	.byte	0xd
+	.byte	0x60
+	.byte	0x3
+	.long	0x9f0
+	.uleb128 0xf
+	.long	.LASF2044
+	.byte	0xc
+	.byte	0xd
+	.byte	0x73
+	.byte	0x10
+	.long	0xab3
+	.uleb128 0x2
+	.long	.LASF2045
+	.byte	0xd
+	.byte	0x74
+	.byte	0xe
+	.long	0xb3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0xd
+	.byte	0x75
+	.byte	0x1c
+	.long	0xa4b
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2046
+	.byte	0xd
+	.byte	0x76
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2047
+	.byte	0xd
+	.byte	0x77
+	.byte	0xd
+	.long	0x91
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2048
+	.byte	0xd
+	.byte	0x78
+	.byte	0xd
+	.long	0x91
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2049
+	.byte	0xd
+	.byte	0x79
+	.byte	0xd
+	.long	0x91
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2050
+	.byte	0xd
+	.byte	0x7a
+	.byte	0x3
+	.long	0xa57
+	.uleb128 0x6
+	.long	0xab3
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x16
+	.long	0xaef
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x18
+	.long	0xb14
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2060
+	.byte	0xf
+	.byte	0x1d
+	.byte	0x3
+	.long	0xaef
+	.uleb128 0x4
+	.long	0x40c
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x1b
+	.long	0xb86
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0xd
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2075
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x3
+	.long	0xb25
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x35
+	.long	0xbb1
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2079
+	.byte	0x10
+	.byte	0x39
+	.byte	0x3
+	.long	0xb92
+	.uleb128 0xf
+	.long	.LASF2080
+	.byte	0xf8
+	.byte	0x10
+	.byte	0x59
+	.byte	0x10
+	.long	0xc67
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x1a
+	.long	0xb20
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x10
+	.byte	0x5b
+	.byte	0xe
+	.long	0x7ad
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x10
+	.byte	0x5c
+	.byte	0x1f
+	.long	0xbb1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2084
+	.byte	0x10
+	.byte	0x5d
+	.byte	0x10
+	.long	0xb86
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2085
+	.byte	0x10
+	.byte	0x5e
+	.byte	0xd
+	.long	0xc67
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2086
+	.byte	0x10
+	.byte	0x5f
+	.byte	0x13
+	.long	0xc4
+	.byte	0xd8
+	.uleb128 0x2
+	.long	.LASF2087
+	.byte	0x10
+	.byte	0x60
+	.byte	0x13
+	.long	0xc4
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x10
+	.byte	0x61
+	.byte	0x12
+	.long	0xb14
+	.byte	0xe8
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x10
+	.byte	0x62
+	.byte	0xd
+	.long	0x91
+	.byte	0xec
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x10
+	.byte	0x63
+	.byte	0xe
+	.long	0xa7
+	.byte	0xee
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x10
+	.byte	0x64
+	.byte	0xd
+	.long	0x91
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x10
+	.byte	0x65
+	.byte	0xd
+	.long	0x91
+	.byte	0xf1
+	.byte	0
+	.uleb128 0x11
+	.long	0x91
+	.long	0xc77
+	.uleb128 0x16
+	.long	0x37
+	.byte	0xbf
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2093
+	.byte	0x10
+	.byte	0x66
+	.byte	0x3
+	.long	0xbbd
+	.uleb128 0x9
+	.long	.LASF2094
+	.byte	0x34
+	.byte	0x17
+	.long	0x5e3
+	.uleb128 0x9
+	.long	.LASF2095
+	.byte	0x35
+	.byte	0x14
+	.long	0xc99
+	.uleb128 0x4
+	.long	0xc77
+	.uleb128 0x1b
+	.long	0x858
+	.byte	0xd
+	.uleb128 0x1b
+	.long	0x864
+	.byte	0x2b
+	.uleb128 0xe
+	.long	.LASF2096
+	.byte	0x11
+	.byte	0x37
+	.byte	0x55
+	.long	0x7a8
+	.uleb128 0x2a
+	.long	0xcaa
+	.byte	0x7c
+	.uleb128 0xd
+	.long	.LASF2097
+	.byte	0x10
+	.byte	0x6f
+	.byte	0x5
+	.long	0x64
+	.long	0xce6
+	.uleb128 0x3
+	.long	0xa7
+	.uleb128 0x3
+	.long	0x3af
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0xc99
+	.uleb128 0x3
+	.long	0xb14
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2130
+	.byte	0x9
+	.byte	0x82
+	.byte	0x6
+	.long	0xcfd
+	.uleb128 0x3
+	.long	0x5e3
+	.uleb128 0x3
+	.long	0x136
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2098
+	.byte	0x9
+	.byte	0x84
+	.byte	0x5
+	.long	0x63e
+	.long	0xd13
+	.uleb128 0x3
+	.long	0x5fc
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2099
+	.byte	0x12
+	.byte	0x71
+	.byte	0x5
+	.long	0x64
+	.long	0xd2f
+	.uleb128 0x3
+	.long	0x80
+	.uleb128 0x3
+	.long	0x136
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2100
+	.byte	0x12
+	.byte	0x76
+	.byte	0x5
+	.long	0x64
+	.long	0xd54
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0xd54
+	.uleb128 0x3
+	.long	0x136
+	.uleb128 0x3
+	.long	0xd69
+	.byte	0
+	.uleb128 0x4
+	.long	0xd59
+	.uleb128 0xa
+	.long	0xd69
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x85
+	.byte	0
+	.uleb128 0x4
+	.long	0xf5
+	.uleb128 0x2c
+	.long	.LASF2131
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xa
+	.long	0x7ad
+	.uleb128 0xd
+	.long	.LASF2101
+	.byte	0xd
+	.byte	0x9a
+	.byte	0xf
+	.long	0x5e3
+	.long	0xdae
+	.uleb128 0x3
+	.long	0xa4b
+	.uleb128 0x3
+	.long	0x955
+	.uleb128 0x3
+	.long	0x3c5
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0xb3
+	.uleb128 0x3
+	.long	0x31e
+	.uleb128 0x3
+	.long	0x37b
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2102
+	.byte	0x10
+	.byte	0x72
+	.byte	0xd
+	.long	0xc99
+	.long	0xdc4
+	.uleb128 0x3
+	.long	0xdc4
+	.byte	0
+	.uleb128 0x4
+	.long	0x4f7
+	.uleb128 0xd
+	.long	.LASF2103
+	.byte	0xd
+	.byte	0x6d
+	.byte	0xf
+	.long	0x5e3
+	.long	0xde4
+	.uleb128 0x3
+	.long	0xb3
+	.uleb128 0x3
+	.long	0x955
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2104
+	.byte	0xd
+	.byte	0x92
+	.byte	0xf
+	.long	0x88f
+	.long	0xdff
+	.uleb128 0x3
+	.long	0xdff
+	.uleb128 0x3
+	.long	0x955
+	.byte	0
+	.uleb128 0x4
+	.long	0xabf
+	.uleb128 0xd
+	.long	.LASF2105
+	.byte	0xd
+	.byte	0x8f
+	.byte	0x15
+	.long	0xe1a
+	.long	0xe1a
+	.uleb128 0x3
+	.long	0x955
+	.byte	0
+	.uleb128 0x4
+	.long	0xab3
+	.uleb128 0x17
+	.long	.LASF2112
+	.byte	0xb3
+	.long	0xea2
+	.uleb128 0xb
+	.long	.LASF2106
+	.byte	0xb3
+	.byte	0x1f
+	.long	0x813
+	.uleb128 0xb
+	.long	.LASF1978
+	.byte	0xb3
+	.byte	0x2f
+	.long	0x30
+	.uleb128 0xb
+	.long	.LASF2107
+	.byte	0xb3
+	.byte	0x42
+	.long	0x674
+	.uleb128 0xb
+	.long	.LASF1958
+	.byte	0xb3
+	.byte	0x51
+	.long	0x170
+	.uleb128 0x9
+	.long	.LASF2108
+	.byte	0xb7
+	.byte	0x12
+	.long	0x17c
+	.uleb128 0x9
+	.long	.LASF2109
+	.byte	0xb8
+	.byte	0x12
+	.long	0x17c
+	.uleb128 0x15
+	.string	"buf"
+	.byte	0xb9
+	.byte	0xa
+	.long	0xea2
+	.uleb128 0x9
+	.long	.LASF2110
+	.byte	0xba
+	.byte	0xc
+	.long	0x170
+	.uleb128 0x9
+	.long	.LASF2111
+	.byte	0xbb
+	.byte	0x14
+	.long	0x3af
+	.uleb128 0x2d
+	.long	0xe9c
+	.uleb128 0x15
+	.string	"ii"
+	.byte	0xc3
+	.byte	0x11
+	.long	0x170
+	.byte	0
+	.uleb128 0x2e
+	.long	0x37
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0xeb7
+	.uleb128 0x2f
+	.long	0x37
+	.uleb128 0x5
+	.byte	0xfd
+	.long	.Ldebug_info0+3740
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2113
+	.byte	0x98
+	.long	0xf0f
+	.uleb128 0xb
+	.long	.LASF2106
+	.byte	0x98
+	.byte	0x17
+	.long	0x813
+	.uleb128 0xb
+	.long	.LASF1978
+	.byte	0x98
+	.byte	0x27
+	.long	0x30
+	.uleb128 0x12
+	.string	"fmt"
+	.byte	0x98
+	.byte	0x3a
+	.long	0x136
+	.uleb128 0x1c
+	.uleb128 0x15
+	.string	"buf"
+	.byte	0x9a
+	.byte	0xa
+	.long	0xf0f
+	.uleb128 0x9
+	.long	.LASF2114
+	.byte	0x9b
+	.byte	0xb
+	.long	0x80
+	.uleb128 0x9
+	.long	.LASF2115
+	.byte	0x9c
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x15
+	.string	"va"
+	.byte	0xa8
+	.byte	0xd
+	.long	0x12a
+	.byte	0
+	.uleb128 0x11
+	.long	0x85
+	.long	0xf1f
+	.uleb128 0x16
+	.long	0x37
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2116
+	.byte	0x93
+	.byte	0xc
+	.long	0x63e
+	.long	0xf45
+	.uleb128 0xb
+	.long	.LASF2106
+	.byte	0x93
+	.byte	0x24
+	.long	0x813
+	.uleb128 0xb
+	.long	.LASF1978
+	.byte	0x93
+	.byte	0x34
+	.long	0x30
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2125
+	.byte	0x11
+	.byte	0x8a
+	.byte	0xc
+	.long	0x63e
+	.uleb128 0x1d
+	.long	.LASF2117
+	.byte	0x84
+	.byte	0xf
+	.long	0x170
+	.long	0xf77
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x84
+	.byte	0x25
+	.long	0x80
+	.uleb128 0xb
+	.long	.LASF2118
+	.byte	0x84
+	.byte	0x39
+	.long	0x7b9
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2119
+	.byte	0x6c
+	.long	0xf98
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x6c
+	.byte	0x22
+	.long	0x136
+	.uleb128 0xb
+	.long	.LASF1958
+	.byte	0x6c
+	.byte	0x2e
+	.long	0x170
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2120
+	.byte	0x67
+	.long	0xfb6
+	.uleb128 0x12
+	.string	"p"
+	.byte	0x67
+	.byte	0x1c
+	.long	0x7e
+	.uleb128 0x12
+	.string	"ch"
+	.byte	0x67
+	.byte	0x24
+	.long	0x85
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2121
+	.byte	0x39
+	.long	0xfe4
+	.uleb128 0x9
+	.long	.LASF2122
+	.byte	0x3b
+	.byte	0x1f
+	.long	0xdff
+	.uleb128 0x9
+	.long	.LASF2123
+	.byte	0x40
+	.byte	0x9
+	.long	0x63e
+	.uleb128 0x30
+	.uleb128 0x9
+	.long	.LASF2124
+	.byte	0x4c
+	.byte	0x1d
+	.long	0x5fc
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2126
+	.byte	0xc
+	.byte	0x2c
+	.byte	0x6a
+	.long	0xff0
+	.uleb128 0x4
+	.long	0x853
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 55
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x34
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 20 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 36 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF711
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF744
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF745
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.file 41 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x29
+	.file 42 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.file 43 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 44 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 45 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2d
+	.byte	0x4
+	.file 46 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1009
+	.byte	0x4
+	.file 47 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 48 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x30
+	.file 49 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 50 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa
+	.file 51 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1486
+	.byte	0x4
+	.file 52 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0x4
+	.file 54 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1556
+	.byte	0x4
+	.file 55 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1557
+	.byte	0x4
+	.file 56 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xf
+	.file 57 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 58 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 59 "./src/main/msp/msp_protocol_v2_common.h"
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 60 "./src/main/msp/msp_protocol_v2_sensor.h"
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 61 "./src/main/msp/msp_protocol_v2_inav.h"
+	.byte	0x3
+	.uleb128 0x14b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1808
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF698
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF710
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF717
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.version.h.18.0749c5787f9f78f6911e8b68405c348c,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF883
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF932
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF933
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF934
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF936
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF964
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF965
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF966
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF967
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF968
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF969
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF970
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF972
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF974
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF976
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF977
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF978
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF979
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF980
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1000
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF965
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1008
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1011
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1019
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1046
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1426
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1469
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.60.df1a5c043e2e4ca2e25f4ac4c907ab71,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_common.h.18.b86f8d7f853153e98d87360103e37a68,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1762
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_sensor.h.18.18fe88d41ea597d5df13b783c778426d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_inav.h.21.d7220ba697f30312e07cad49a55b0841,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1806
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2132
+	.long	.LASF2133
+	.long	.LASF2134
+	.long	.LASF2135
+	.long	.LASF2136
+	.long	.LASF2137
+	.long	.LASF2138
+	.long	.LASF2139
+	.long	.LASF2140
+	.long	.LASF2141
+	.long	.LASF2142
+	.long	.LASF2143
+	.long	.LASF2144
+	.long	.LASF2145
+	.long	.LASF2146
+	.long	.LASF2147
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2148
+	.byte	0xc
+	.long	.LASF2149
+	.byte	0xc
+	.long	.LASF2150
+	.byte	0xf
+	.long	.LASF2151
+	.byte	0x10
+	.long	.LASF2152
+	.byte	0
+	.long	.LASF2153
+	.byte	0x1
+	.long	.LASF2154
+	.byte	0x10
+	.long	.LASF2155
+	.byte	0x4
+	.long	.LASF2156
+	.byte	0x4
+	.long	.LASF2157
+	.byte	0x3
+	.long	.LASF2158
+	.byte	0x2
+	.long	.LASF2159
+	.byte	0x2
+	.long	.LASF2156
+	.byte	0x6
+	.long	.LASF2160
+	.byte	0x4
+	.long	.LASF2161
+	.byte	0x7
+	.long	.LASF2162
+	.byte	0x7
+	.long	.LASF2163
+	.byte	0x2
+	.long	.LASF2164
+	.byte	0x2
+	.long	.LASF2158
+	.byte	0x4
+	.long	.LASF2165
+	.byte	0xf
+	.long	.LASF2166
+	.byte	0x10
+	.long	.LASF2150
+	.byte	0x10
+	.long	.LASF2167
+	.byte	0xc
+	.long	.LASF2168
+	.byte	0xf
+	.long	.LASF2169
+	.byte	0xf
+	.long	.LASF2170
+	.byte	0xc
+	.long	.LASF2171
+	.byte	0xc
+	.long	.LASF2172
+	.byte	0xe
+	.long	.LASF2173
+	.byte	0xc
+	.long	.LASF2174
+	.byte	0xd
+	.long	.LASF2175
+	.byte	0xd
+	.long	.LASF2176
+	.byte	0xc
+	.long	.LASF2177
+	.byte	0xc
+	.long	.LASF2178
+	.byte	0xc
+	.long	.LASF2179
+	.byte	0xc
+	.long	.LASF2180
+	.byte	0xf
+	.long	.LASF2181
+	.byte	0xc
+	.long	.LASF2182
+	.byte	0xc
+	.long	.LASF2183
+	.byte	0xb
+	.long	.LASF2184
+	.byte	0xb
+	.long	.LASF2185
+	.byte	0x4
+	.long	.LASF2186
+	.byte	0xa
+	.long	.LASF2187
+	.byte	0x9
+	.long	.LASF2188
+	.byte	0x8
+	.long	.LASF2189
+	.byte	0x9
+	.long	.LASF2190
+	.byte	0x9
+	.long	.LASF2191
+	.byte	0x4
+	.long	.LASF2192
+	.byte	0x4
+	.long	.LASF2193
+	.byte	0x2
+	.long	.LASF2194
+	.byte	0x4
+	.long	.LASF2195
+	.byte	0x1
+	.long	.LASF2196
+	.byte	0x3
+	.long	.LASF2197
+	.byte	0x3
+	.long	.LASF2198
+	.byte	0x5
+	.long	.LASF2199
+	.byte	0x4
+	.long	.LASF2200
+	.byte	0x5
+	.long	.LASF2201
+	.byte	0x2
+	.long	.LASF2202
+	.byte	0x7
+	.long	.LASF2203
+	.byte	0x7
+	.long	.LASF2204
+	.byte	0x7
+	.long	.LASF2205
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1418:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1830:
+	.string	"targetName"
+.LASF846:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2048:
+	.string	"peripheral_baudrateIndex"
+.LASF1786:
+	.string	"MSP2_INAV_OSD_SET_PREFERENCES 0x2017"
+.LASF1054:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF698:
+	.string	"_ANSI_STDARG_H_ "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1248:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1935:
+	.string	"serialWrite"
+.LASF795:
+	.string	"USE_RX_PPM "
+.LASF1148:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF946:
+	.string	"USE_BARO "
+.LASF849:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1080:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF926:
+	.string	"_WCHAR_T_DEFINED "
+.LASF869:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1738:
+	.string	"MSP_SENSOR_STATUS 151"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1736:
+	.string	"MSP_V2_FRAME 255"
+.LASF831:
+	.string	"USE_PITOT_MS4525 "
+.LASF1119:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1174:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1425:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1922:
+	.string	"rxBufferSize"
+.LASF1597:
+	.string	"MSP_BOARD_INFO 4"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF953:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2014:
+	.string	"BAUD_2400"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF2051:
+	.string	"ADC_BATTERY"
+.LASF1559:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1192:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1941:
+	.string	"setMode"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF713:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1777:
+	.string	"MSP2_INAV_MC_BRAKING 0x200B"
+.LASF870:
+	.string	"USE_SERIALRX_CRSF "
+.LASF782:
+	.string	"FC_VERSION_PATCH_LEVEL 0"
+.LASF739:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1321:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1531:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF801:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF712:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1437:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1060:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF850:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1815:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1917:
+	.string	"vTable"
+.LASF1822:
+	.string	"uint32_t"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1949:
+	.string	"_Bool"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF954:
+	.string	"USE_UART8 "
+.LASF1946:
+	.string	"endWrite"
+.LASF1267:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF733:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1012:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2103:
+	.string	"findSharedSerialPort"
+.LASF1972:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2117:
+	.string	"logFormatPrefix"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1454:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1010:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1723:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF1800:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS_STATUS 0x2026"
+.LASF1209:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF766:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1929:
+	.string	"txBufferTail"
+.LASF1899:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF963:
+	.string	"USE_USB_MSC"
+.LASF1061:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1345:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1245:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1291:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1459:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1990:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1050:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF918:
+	.string	"__WCHAR_T__ "
+.LASF1964:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF1414:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"_WCHAR_T_DECLARED "
+.LASF796:
+	.string	"USE_SERIAL_RX "
+.LASF1973:
+	.string	"LOG_TOPIC_VTX"
+.LASF1688:
+	.string	"MSP_MOTOR 104"
+.LASF1669:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF1701:
+	.string	"MSP_PIDNAMES 117"
+.LASF853:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1253:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1237:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1464:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1386:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1477:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1332:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1489:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1461:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1859:
+	.string	"OWNER_LED"
+.LASF972:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2008:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF1390:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1667:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF1753:
+	.string	"MSP2_COMMON_MOTOR_MIXER 0x1005"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1639:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF1976:
+	.string	"logTopic_e"
+.LASF1821:
+	.string	"uint16_t"
+.LASF1884:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1504:
+	.string	"PG_RX_CONFIG 24"
+.LASF1827:
+	.string	"overflow_arg_area"
+.LASF1184:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1562:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF881:
+	.string	"USE_CLI_BATCH "
+.LASF761:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1449:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1320:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1078:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF721:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF996:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1828:
+	.string	"reg_save_area"
+.LASF1121:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2120:
+	.string	"logPutcp"
+.LASF1722:
+	.string	"MSP_SET_HEAD 211"
+.LASF1662:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF888:
+	.string	"_T_PTRDIFF_ "
+.LASF791:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1359:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1296:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF957:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1670:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF1492:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1200:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1762:
+	.string	"MSP2_COMMON_SET_SETTINGS 0x100E"
+.LASF1686:
+	.string	"MSP_RAW_IMU 102"
+.LASF1741:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1729:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF1643:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF1123:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1501:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1187:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF708:
+	.string	"_VA_LIST_DEFINED "
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1038:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1717:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF1470:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF917:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1073:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1181:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1682:
+	.string	"MSP_SET_TX_INFO 186"
+.LASF1103:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF759:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1548:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1312:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1774:
+	.string	"MSP2_INAV_SET_RATE_PROFILE 0x2008"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1873:
+	.string	"RESOURCE_NONE"
+.LASF1278:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1413:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1992:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF841:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1081:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1019:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1426:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF909:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2128:
+	.string	"__builtin_va_list"
+.LASF1034:
+	.string	"BIT(x) (1 << (x))"
+.LASF970:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1557:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1926:
+	.string	"rxBufferHead"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1089:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1212:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1240:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1106:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF781:
+	.string	"FC_VERSION_MINOR 6"
+.LASF1494:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1457:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2045:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1882:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF941:
+	.string	"USE_IMU_FAKE "
+.LASF1549:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1945:
+	.string	"beginWrite"
+.LASF1713:
+	.string	"MSP_SET_PID 202"
+.LASF745:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1399:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"___int_wchar_t_h "
+.LASF1864:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1714:
+	.string	"MSP_SET_BOX 203"
+.LASF1335:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1052:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1874:
+	.string	"RESOURCE_INPUT"
+.LASF1156:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF962:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2085:
+	.string	"inBuf"
+.LASF835:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2076:
+	.string	"MSP_PENDING_NONE"
+.LASF710:
+	.string	"__va_list__ "
+.LASF1593:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF981:
+	.string	"USE_RX_PPM"
+.LASF2059:
+	.string	"MSP_VERSION_COUNT"
+.LASF513:
+	.string	"__always_inline"
+.LASF1883:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1931:
+	.string	"rxCallbackData"
+.LASF1894:
+	.string	"MODE_RX"
+.LASF1569:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1031:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1966:
+	.string	"LOG_TOPIC_BARO"
+.LASF2004:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF784:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1513:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1001:
+	.string	"FAST_CODE "
+.LASF1750:
+	.string	"MSP2_COMMON_SET_TZ 0x1002"
+.LASF1715:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1953:
+	.string	"PGR_SIZE_MASK"
+.LASF842:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1159:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF975:
+	.string	"USE_1WIRE_DS2482"
+.LASF2027:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1231:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1603:
+	.string	"MSP_NAV_POSHOLD 12"
+.LASF1666:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF837:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1152:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF760:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF902:
+	.string	"_T_SIZE_ "
+.LASF2129:
+	.string	"__va_list_tag"
+.LASF944:
+	.string	"USE_FAKE_GPS "
+.LASF762:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1692:
+	.string	"MSP_ATTITUDE 108"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1129:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF838:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2113:
+	.string	"_logf"
+.LASF1315:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1577:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF1388:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1852:
+	.string	"OWNER_USB"
+.LASF1573:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1808:
+	.string	"LOG_PREFIX_FORMATTED_SIZE 13"
+.LASF1431:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF720:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF396:
+	.string	"false 0"
+.LASF1872:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF2068:
+	.string	"MSP_HEADER_V2_OVER_V1"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1451:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF913:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1378:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"MODE_TX"
+.LASF1439:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1571:
+	.string	"API_VERSION_MINOR 4"
+.LASF1453:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2005:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF863:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1259:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1759:
+	.string	"MSP2_COMMON_SET_RADAR_POS 0x100B"
+.LASF1297:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1497:
+	.string	"PG_PID_PROFILE 14"
+.LASF1243:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF802:
+	.string	"USE_ADC_AVERAGING "
+.LASF1568:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1104:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1712:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF1251:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"MSP_PAYLOAD_V1"
+.LASF2013:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1542:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1338:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1208:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF910:
+	.string	"_SIZE_T_DECLARED "
+.LASF873:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1854:
+	.string	"OWNER_OSD"
+.LASF1617:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1440:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1840:
+	.string	"OWNER_SERVO"
+.LASF1151:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF732:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1737:
+	.string	"MSP_STATUS_EX 150"
+.LASF1462:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1634:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF2079:
+	.string	"mspPendingSystemRequest_e"
+.LASF723:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1588:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1624:
+	.string	"MSP_MIXER 42"
+.LASF1368:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF986:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF919:
+	.string	"_WCHAR_T "
+.LASF1525:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1560:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1471:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF2042:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF1740:
+	.string	"MSP_GPSSVINFO 164"
+.LASF1871:
+	.string	"OWNER_IRLOCK"
+.LASF1164:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1113:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF716:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2102:
+	.string	"mspSerialPortFind"
+.LASF1082:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1784:
+	.string	"MSP2_INAV_OSD_SET_ALARMS 0x2015"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1120:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF894:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1443:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1087:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1154:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2015:
+	.string	"BAUD_4800"
+.LASF1816:
+	.string	"__uint16_t"
+.LASF1664:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1839:
+	.string	"OWNER_MOTOR"
+.LASF1693:
+	.string	"MSP_ALTITUDE 109"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1171:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1616:
+	.string	"MSP_MODE_RANGES 34"
+.LASF992:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1995:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1055:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1885:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF929:
+	.string	"__INT_WCHAR_T_H "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1636:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF1204:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1146:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1481:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF1649:
+	.string	"MSP_REBOOT 68"
+.LASF1059:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2130:
+	.string	"serialPrint"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF915:
+	.string	"__size_t "
+.LASF1928:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2021:
+	.string	"BAUD_230400"
+.LASF1509:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1919:
+	.string	"mode"
+.LASF2062:
+	.string	"MSP_HEADER_START"
+.LASF1389:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1090:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1381:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"MSP_SET_WP 209"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2023:
+	.string	"BAUD_460800"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1483:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF1824:
+	.string	"__gnuc_va_list"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1982:
+	.string	"logConfig_Copy"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF755:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF777:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1836:
+	.string	"OWNER_PWMIO"
+.LASF1583:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1758:
+	.string	"MSP2_COMMON_SET_SERIAL_CONFIG 0x100A"
+.LASF840:
+	.string	"USE_OLED_UG2864 "
+.LASF1207:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF857:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF880:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1024:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF751:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1862:
+	.string	"OWNER_RX_SPI"
+.LASF763:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2096:
+	.string	"logConfig_Registry"
+.LASF349:
+	.string	"__amd64 1"
+.LASF2002:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF1991:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1809:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF748:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1596:
+	.string	"MSP_FC_VERSION 3"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1551:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1011:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF895:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1455:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1698:
+	.string	"MSP_MISC 114"
+.LASF1676:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF810:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF807:
+	.string	"USE_NAV "
+.LASF1841:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1287:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1233:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"NOINLINE "
+.LASF1772:
+	.string	"MSP2_INAV_SET_BATTERY_CONFIG 0x2006"
+.LASF1567:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF1918:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1493:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1675:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1000:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1782:
+	.string	"MSP2_INAV_OSD_SET_LAYOUT_ITEM 0x2013"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1176:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1942:
+	.string	"writeBuf"
+.LASF768:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1668:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2000:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1014:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1552:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF887:
+	.string	"_PTRDIFF_T "
+.LASF1957:
+	.string	"pgRegistry_s"
+.LASF1962:
+	.string	"pgRegistry_t"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1128:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1427:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1832:
+	.string	"buildDate"
+.LASF2098:
+	.string	"serialIsConnected"
+.LASF1196:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF818:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1533:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1805:
+	.string	"MSP2_INAV_OPFLOW_CALIBRATION 0x2032"
+.LASF1732:
+	.string	"MSP_RESERVE_1 251"
+.LASF1633:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF780:
+	.string	"FC_VERSION_MAJOR 2"
+.LASF809:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1803:
+	.string	"MSP2_PID 0x2030"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1133:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2087:
+	.string	"dataSize"
+.LASF1526:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1955:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF805:
+	.string	"USE_GPS "
+.LASF1051:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1863:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1363:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1575:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF800:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1334:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1194:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1735:
+	.string	"MSP_DEBUG 254"
+.LASF1499:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1867:
+	.string	"OWNER_1WIRE"
+.LASF987:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1221:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1629:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF1524:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF925:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1199:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1703:
+	.string	"MSP_BOXIDS 119"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1288:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF868:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2017:
+	.string	"BAUD_19200"
+.LASF1217:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1846:
+	.string	"OWNER_RANGEFINDER"
+.LASF1728:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF1384:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1330:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1472:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1619:
+	.string	"MSP_SET_FEATURE 37"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1718:
+	.string	"MSP_SET_MISC 207"
+.LASF1173:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2026:
+	.string	"BAUD_1500000"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF705:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2124:
+	.string	"logAndMspPort"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1269:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2003:
+	.string	"FUNCTION_LOG"
+.LASF1083:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1550:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1947:
+	.string	"writeBufChunks"
+.LASF2094:
+	.string	"logPort"
+.LASF985:
+	.string	"USE_ITCM_RAM"
+.LASF1135:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1202:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1951:
+	.string	"PGR_PGN_MASK"
+.LASF787:
+	.string	"MW_VERSION 231"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1939:
+	.string	"serialSetBaudRate"
+.LASF790:
+	.string	"BUILD_TIME_LENGTH 8"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF939:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1404:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1333:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2125:
+	.string	"logHasOutput"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1512:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF864:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1887:
+	.string	"RESOURCE_SPI_CS"
+.LASF1971:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1752:
+	.string	"MSP2_COMMON_SET_SETTING 0x1004"
+.LASF1930:
+	.string	"rxCallback"
+.LASF1438:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF978:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1416:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1344:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF973:
+	.string	"USE_PITOT_ADC"
+.LASF2047:
+	.string	"gps_baudrateIndex"
+.LASF2071:
+	.string	"MSP_HEADER_V2_NATIVE"
+.LASF1695:
+	.string	"MSP_RC_TUNING 111"
+.LASF1646:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF767:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1829:
+	.string	"va_list"
+.LASF706:
+	.string	"_VA_LIST_ "
+.LASF844:
+	.string	"USE_DJI_HD_OSD "
+.LASF1375:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1924:
+	.string	"rxBuffer"
+.LASF1912:
+	.string	"serialBufChunk_t"
+.LASF1653:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1923:
+	.string	"txBufferSize"
+.LASF1903:
+	.string	"SERIAL_PARITY_NO"
+.LASF1963:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1592:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1761:
+	.string	"MSP2_COMMON_SETTINGS 0x100D"
+.LASF1169:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1795:
+	.string	"MSP2_INAV_SET_SERVO_MIXER 0x2021"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1436:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1641:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1749:
+	.string	"MSP2_COMMON_TZ 0x1001"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF830:
+	.string	"USE_OPFLOW_MSP "
+.LASF1958:
+	.string	"size"
+.LASF774:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1219:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1886:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1856:
+	.string	"OWNER_MPU"
+.LASF1432:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1626:
+	.string	"MSP_RX_CONFIG 44"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1045:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2080:
+	.string	"mspPort_s"
+.LASF2093:
+	.string	"mspPort_t"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1532:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1224:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1229:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1866:
+	.string	"OWNER_TEMPERATURE"
+.LASF1476:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF2065:
+	.string	"MSP_HEADER_V1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF912:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1595:
+	.string	"MSP_FC_VARIANT 2"
+.LASF1093:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF907:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1909:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF1857:
+	.string	"OWNER_INVERTER"
+.LASF1834:
+	.string	"size_t"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1766:
+	.string	"MSP2_INAV_STATUS 0x2000"
+.LASF1898:
+	.string	"portOptions_t"
+.LASF747:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1974:
+	.string	"LOG_TOPIC_OSD"
+.LASF1387:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1956:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1820:
+	.string	"uint8_t"
+.LASF1132:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1631:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF820:
+	.string	"USE_RX_UIB "
+.LASF1580:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF772:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1751:
+	.string	"MSP2_COMMON_SETTING 0x1003"
+.LASF2072:
+	.string	"MSP_PAYLOAD_V2_NATIVE"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1518:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1733:
+	.string	"MSP_RESERVE_2 252"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1587:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1258:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF1410:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF979:
+	.string	"USE_ADC"
+.LASF2075:
+	.string	"mspState_e"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF930:
+	.string	"_GCC_WCHAR_T "
+.LASF2089:
+	.string	"cmdFlags"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2077:
+	.string	"MSP_PENDING_BOOTLOADER"
+.LASF1876:
+	.string	"RESOURCE_IO"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF999:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1326:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1353:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF701:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF825:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF886:
+	.string	"_ANSI_STDDEF_H "
+.LASF1131:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1264:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF2032:
+	.string	"SERIAL_PORT_USART2"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF964:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF905:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF980:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1053:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF916:
+	.string	"__need_size_t"
+.LASF2060:
+	.string	"mspVersion_e"
+.LASF1838:
+	.string	"OWNER_PPMINPUT"
+.LASF1789:
+	.string	"MSP2_BLACKBOX_CONFIG 0x201A"
+.LASF2011:
+	.string	"serialPortFunction_e"
+.LASF897:
+	.string	"__need_ptrdiff_t"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1685:
+	.string	"MSP_STATUS 101"
+.LASF1768:
+	.string	"MSP2_INAV_ANALOG 0x2002"
+.LASF826:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF851:
+	.string	"USE_LOG "
+.LASF1033:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1155:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF884:
+	.string	"_STDDEF_H "
+.LASF1343:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF943:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1044:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1084:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1254:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF722:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1632:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF1709:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF758:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2009:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF1458:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1448:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1099:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF815:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1122:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2070:
+	.string	"MSP_CHECKSUM_V2_OVER_V1"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1604:
+	.string	"MSP_SET_NAV_POSHOLD 13"
+.LASF1530:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF757:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1168:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1699:
+	.string	"MSP_MOTOR_PINS 115"
+.LASF714:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1043:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF814:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1336:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1681:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF1422:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1282:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2127:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1776:
+	.string	"MSP2_INAV_OUTPUT_MAPPING 0x200A"
+.LASF1543:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1734:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1690:
+	.string	"MSP_RAW_GPS 106"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1547:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1362:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1118:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF700:
+	.string	"__GNUC_VA_LIST "
+.LASF1779:
+	.string	"MSP2_INAV_MIXER 0x2010"
+.LASF1102:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1627:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1540:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1193:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1801:
+	.string	"MSP2_INAV_GVAR_STATUS 0x2027"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2016:
+	.string	"BAUD_9600"
+.LASF1683:
+	.string	"MSP_TX_INFO 187"
+.LASF1377:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"charCount"
+.LASF1474:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF1228:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1234:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1865:
+	.string	"OWNER_COMPASS"
+.LASF1655:
+	.string	"MSP_SET_LOOP_TIME 74"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1057:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF753:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1380:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1365:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1620:
+	.string	"MSP_BOARD_ALIGNMENT 38"
+.LASF1999:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1959:
+	.string	"address"
+.LASF1356:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1242:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1302:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1993:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1544:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF997:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF982:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1879:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1105:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1018:
+	.string	"IOCFG_IPU 0"
+.LASF1672:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF1651:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF1607:
+	.string	"MSP_POSITION_ESTIMATION_CONFIG 16"
+.LASF1487:
+	.string	"PG_CF_START 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF935:
+	.string	"NULL"
+.LASF1554:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF771:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1227:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1755:
+	.string	"MSP2_COMMON_SETTING_INFO 0x1007"
+.LASF1878:
+	.string	"RESOURCE_UART_TX"
+.LASF2074:
+	.string	"MSP_COMMAND_RECEIVED"
+.LASF770:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1847:
+	.string	"OWNER_SYSTEM"
+.LASF871:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1787:
+	.string	"MSP2_INAV_SELECT_BATTERY_PROFILE 0x2018"
+.LASF1985:
+	.string	"PORTSHARING_SHARED"
+.LASF1446:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF959:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1270:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__PMT"
+.LASF1027:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF711:
+	.string	"_CTYPE_H 1"
+.LASF829:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1892:
+	.string	"RESOURCE_RX_CE"
+.LASF1849:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1586:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF816:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2049:
+	.string	"telemetry_baudrateIndex"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1020:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2122:
+	.string	"portConfig"
+.LASF1539:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1401:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2022:
+	.string	"BAUD_250000"
+.LASF1183:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1988:
+	.string	"FUNCTION_MSP"
+.LASF1835:
+	.string	"OWNER_FREE"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1482:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1659:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF1205:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1954:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1172:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1680:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF1130:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF877:
+	.string	"USE_VTX_TRAMP "
+.LASF742:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1094:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1788:
+	.string	"MSP2_INAV_DEBUG 0x2019"
+.LASF1360:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1101:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1026:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1663:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF1203:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF812:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1430:
+	.string	"UNIT_TESTED "
+.LASF974:
+	.string	"USE_1WIRE"
+.LASF1781:
+	.string	"MSP2_INAV_OSD_LAYOUTS 0x2012"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1285:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2053:
+	.string	"ADC_CURRENT"
+.LASF1584:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF923:
+	.string	"_WCHAR_T_ "
+.LASF735:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1754:
+	.string	"MSP2_COMMON_SET_MOTOR_MIXER 0x1006"
+.LASF776:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1064:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF994:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1769:
+	.string	"MSP2_INAV_MISC 0x2003"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1520:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1488:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1465:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1445:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF730:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF901:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1097:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1558:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1674:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1085:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1576:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF1978:
+	.string	"level"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1063:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF704:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1374:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1915:
+	.string	"serialBufChunk_s"
+.LASF726:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF797:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1671:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF1529:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1147:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1305:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1590:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF729:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1719:
+	.string	"MSP_RESET_CONF 208"
+.LASF1823:
+	.string	"uint_fast16_t"
+.LASF2073:
+	.string	"MSP_CHECKSUM_V2_NATIVE"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1855:
+	.string	"OWNER_BARO"
+.LASF1623:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1347:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF937:
+	.string	"__need_NULL"
+.LASF938:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2090:
+	.string	"cmdMSP"
+.LASF1705:
+	.string	"MSP_NAV_STATUS 121"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1095:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1485:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2052:
+	.string	"ADC_RSSI"
+.LASF1826:
+	.string	"fp_offset"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1527:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1076:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1825:
+	.string	"gp_offset"
+.LASF1968:
+	.string	"LOG_TOPIC_PWM"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1896:
+	.string	"MODE_RXTX"
+.LASF1711:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF1984:
+	.string	"PORTSHARING_NOT_SHARED"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF743:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF1572:
+	.string	"API_VERSION_LENGTH 2"
+.LASF1150:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1961:
+	.string	"reset"
+.LASF1137:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF823:
+	.string	"USE_RANGEFINDER "
+.LASF1161:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1565:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF1021:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2067:
+	.string	"MSP_CHECKSUM_V1"
+.LASF1850:
+	.string	"OWNER_SDCARD"
+.LASF1166:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1466:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2088:
+	.string	"mspVersion"
+.LASF785:
+	.string	"FC_VERSION_STRING STR(FC_VERSION_MAJOR) \".\" STR(FC_VERSION_MINOR) \".\" STR(FC_VERSION_PATCH_LEVEL)"
+.LASF1405:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1747:
+	.string	"MSP_RTC 246"
+.LASF1678:
+	.string	"MSP_SET_SPECIAL_PARAMETERS 99"
+.LASF1799:
+	.string	"MSP2_INAV_SET_GLOBAL_FUNCTIONS 0x2025"
+.LASF1579:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1003:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1810:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1213:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1813:
+	.string	"signed char"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1153:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1743:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF1704:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF898:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1657:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF1116:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1402:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF927:
+	.string	"_WCHAR_T_H "
+.LASF1226:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1608:
+	.string	"MSP_SET_POSITION_ESTIMATION_CONFIG 17"
+.LASF1900:
+	.string	"SERIAL_INVERTED"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF750:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1545:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1911:
+	.string	"count"
+.LASF824:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1757:
+	.string	"MSP2_COMMON_SERIAL_CONFIG 0x1009"
+.LASF1744:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF1311:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1654:
+	.string	"MSP_LOOP_TIME 73"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1658:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF906:
+	.string	"_BSD_SIZE_T_ "
+.LASF1853:
+	.string	"OWNER_BEEPER"
+.LASF1329:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF965:
+	.string	"USE_DASHBOARD"
+.LASF878:
+	.string	"USE_VTX_FFPV "
+.LASF1989:
+	.string	"FUNCTION_GPS"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1062:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1797:
+	.string	"MSP2_INAV_SET_LOGIC_CONDITIONS 0x2023"
+.LASF1067:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF749:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1831:
+	.string	"shortGitRevision"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1505:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1791:
+	.string	"MSP2_INAV_TEMP_SENSOR_CONFIG 0x201C"
+.LASF1650:
+	.string	"MSP_BF_BUILD_INFO 69"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2040:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2041:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF848:
+	.string	"USE_ANTIGRAVITY "
+.LASF1308:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF995:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF993:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1142:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1994:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1780:
+	.string	"MSP2_INAV_SET_MIXER 0x2011"
+.LASF876:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1843:
+	.string	"OWNER_SERIAL"
+.LASF1710:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF1005:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF2101:
+	.string	"openSerialPort"
+.LASF794:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1870:
+	.string	"OWNER_PINIO"
+.LASF834:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1952:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1110:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1369:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1661:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF786:
+	.string	"FC_FIRMWARE_NAME \"INAV\""
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1009:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1764:
+	.string	"MSP2_SENSOR_RANGEFINDER 0x1F01"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF940:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2006:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF1775:
+	.string	"MSP2_INAV_AIR_SPEED 0x2009"
+.LASF1519:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1463:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1071:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1108:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1773:
+	.string	"MSP2_INAV_RATE_PROFILE 0x2007"
+.LASF799:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1145:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1236:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1086:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1040:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1933:
+	.string	"rxIrqCount"
+.LASF2063:
+	.string	"MSP_HEADER_M"
+.LASF1215:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1441:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF740:
+	.string	"isascii(c) __isascii (c)"
+.LASF1647:
+	.string	"MSP_BF_CONFIG 66"
+.LASF1510:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF2064:
+	.string	"MSP_HEADER_X"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF775:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1272:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1016:
+	.string	"IOCFG_AF_OD 0"
+.LASF1802:
+	.string	"MSP2_INAV_TASK_TIMING 0x2028"
+.LASF1906:
+	.string	"SERIAL_BIDIR"
+.LASF1566:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF976:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1077:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1195:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2039:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2007:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF1275:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1793:
+	.string	"MSP2_INAV_TEMPERATURES 0x201E"
+.LASF1652:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1960:
+	.string	"copy"
+.LASF1877:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1665:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2031:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2033:
+	.string	"SERIAL_PORT_USART3"
+.LASF2034:
+	.string	"SERIAL_PORT_USART4"
+.LASF2035:
+	.string	"SERIAL_PORT_USART5"
+.LASF2036:
+	.string	"SERIAL_PORT_USART6"
+.LASF2037:
+	.string	"SERIAL_PORT_USART7"
+.LASF2038:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1058:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF855:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1351:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1468:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1818:
+	.string	"long int"
+.LASF788:
+	.string	"GIT_SHORT_REVISION_LENGTH 8"
+.LASF1180:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1502:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1785:
+	.string	"MSP2_INAV_OSD_PREFERENCES 0x2016"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1165:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1798:
+	.string	"MSP2_INAV_GLOBAL_FUNCTIONS 0x2024"
+.LASF1069:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF859:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF2097:
+	.string	"mspSerialPushPort"
+.LASF1594:
+	.string	"MSP_API_VERSION 1"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1198:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1844:
+	.string	"OWNER_PINDEBUG"
+.LASF1125:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF983:
+	.string	"USE_RCDEVICE"
+.LASF1392:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"LOG_PREFIX \"[%6d.%03d] \""
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1792:
+	.string	"MSP2_INAV_SET_TEMP_SENSOR_CONFIG 0x201D"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1563:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF891:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF2018:
+	.string	"BAUD_38400"
+.LASF1032:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF890:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1225:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1783:
+	.string	"MSP2_INAV_OSD_ALARMS 0x2014"
+.LASF1987:
+	.string	"FUNCTION_NONE"
+.LASF2109:
+	.string	"maxBytes"
+.LASF1257:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1893:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1605:
+	.string	"MSP_CALIBRATION_DATA 14"
+.LASF2106:
+	.string	"topic"
+.LASF1029:
+	.string	"EXPAND_I(x) x"
+.LASF1201:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"MSP_FEATURE 36"
+.LASF861:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF858:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1292:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_VA_LIST "
+.LASF1158:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2099:
+	.string	"tfp_sprintf"
+.LASF1914:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF904:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1833:
+	.string	"buildTime"
+.LASF1232:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1927:
+	.string	"rxBufferTail"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1266:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1767:
+	.string	"MSP2_INAV_OPTICAL_FLOW 0x2001"
+.LASF1745:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF1467:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1875:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1716:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF1796:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS 0x2022"
+.LASF1630:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF2131:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1940:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF932:
+	.string	"__DEFINED_wchar_t "
+.LASF947:
+	.string	"USE_UART1 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF1697:
+	.string	"MSP_ACTIVEBOXES 113"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1635:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF883:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF2112:
+	.string	"_logBufferHex"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2095:
+	.string	"mspLogPort"
+.LASF1516:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1456:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF920:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1691:
+	.string	"MSP_COMP_GPS 107"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF854:
+	.string	"CMS_MENU_OSD "
+.LASF1141:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1190:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF2058:
+	.string	"MSP_V2_NATIVE"
+.LASF1943:
+	.string	"isConnected"
+.LASF1724:
+	.string	"MSP_SET_MOTOR 214"
+.LASF1216:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1845:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1127:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1324:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1354:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF813:
+	.string	"USE_PITOT "
+.LASF1300:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF737:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF875:
+	.string	"USE_VTX_CONTROL "
+.LASF1819:
+	.string	"char"
+.LASF1970:
+	.string	"LOG_TOPIC_IMU"
+.LASF1197:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1599:
+	.string	"MSP_INAV_PID 6"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF2121:
+	.string	"logInit"
+.LASF1134:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1395:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1281:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2029:
+	.string	"baudRates"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1015:
+	.string	"IOCFG_AF_PP 0"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1561:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF752:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1276:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF900:
+	.string	"_SIZE_T "
+.LASF702:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1936:
+	.string	"serialTotalRxWaiting"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1435:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1109:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2030:
+	.string	"SERIAL_PORT_NONE"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1613:
+	.string	"MSP_SET_RTH_AND_LAND_CONFIG 22"
+.LASF865:
+	.string	"USE_RX_MSP "
+.LASF1260:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1023:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1684:
+	.string	"MSP_IDENT 100"
+.LASF395:
+	.string	"true 1"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1535:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1644:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF827:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF872:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF908:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1235:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1417:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF833:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1609:
+	.string	"MSP_WP_MISSION_LOAD 18"
+.LASF1869:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF2010:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1112:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF828:
+	.string	"USE_OPFLOW "
+.LASF1511:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1610:
+	.string	"MSP_WP_MISSION_SAVE 19"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1687:
+	.string	"MSP_SERVO 103"
+.LASF936:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1498:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1660:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF783:
+	.string	"STR_HELPER(x) #x"
+.LASF1981:
+	.string	"logConfig_System"
+.LASF1602:
+	.string	"MSP_SET_NAME 11"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1564:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1515:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF798:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1162:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1794:
+	.string	"MSP2_INAV_SERVO_MIXER 0x2020"
+.LASF1428:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1323:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1677:
+	.string	"MSP_SPECIAL_PARAMETERS 98"
+.LASF942:
+	.string	"USE_FAKE_BARO "
+.LASF1460:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF2083:
+	.string	"pendingRequest"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2078:
+	.string	"MSP_PENDING_CLI"
+.LASF1140:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1178:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1261:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"RESOURCE_EXTI"
+.LASF934:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1115:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF889:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF703:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF1484:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1556:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF806:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF2107:
+	.string	"buffer"
+.LASF699:
+	.string	"__need___va_list"
+.LASF2091:
+	.string	"checksum1"
+.LASF2092:
+	.string	"checksum2"
+.LASF1246:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1679:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF1303:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1249:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF860:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF817:
+	.string	"USE_GYRO_KALMAN "
+.LASF1182:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1578:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF2119:
+	.string	"logPrint"
+.LASF1739:
+	.string	"MSP_UID 160"
+.LASF1983:
+	.string	"PORTSHARING_UNUSED"
+.LASF2044:
+	.string	"serialPortConfig_s"
+.LASF2050:
+	.string	"serialPortConfig_t"
+.LASF725:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1223:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1398:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF756:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1420:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1902:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1500:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF2110:
+	.string	"bufPos"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF717:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1555:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1126:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF734:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1706:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1238:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1763:
+	.string	"MSP2_IS_SENSOR_MESSAGE(x) ((x) >= 0x1F00 && (x) <= 0x1FFF)"
+.LASF1450:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2056:
+	.string	"MSP_V1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2028:
+	.string	"BAUD_2470000"
+.LASF811:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1746:
+	.string	"MSP_SET_PASSTHROUGH 245"
+.LASF1771:
+	.string	"MSP2_INAV_BATTERY_CONFIG 0x2005"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF731:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF2108:
+	.string	"charsPerByte"
+.LASF1314:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"USE_RANGEFINDER"
+.LASF1170:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF778:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF2118:
+	.string	"timeMs"
+.LASF1611:
+	.string	"MSP_WP_GETINFO 20"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF715:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1075:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1039:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1098:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF832:
+	.string	"USE_1WIRE "
+.LASF1348:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2001:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF1490:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1721:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2057:
+	.string	"MSP_V2_OVER_V1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF924:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1179:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF793:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1860:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1111:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF998:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1366:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1214:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1218:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1905:
+	.string	"SERIAL_UNIDIR"
+.LASF1817:
+	.string	"__uint32_t"
+.LASF2084:
+	.string	"c_state"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1157:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1910:
+	.string	"data"
+.LASF1327:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1486:
+	.string	"__TFP_PRINTF__ "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1503:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1765:
+	.string	"MSP2_SENSOR_OPTIC_FLOW 0x1F02"
+.LASF1707:
+	.string	"MSP_3D 124"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1615:
+	.string	"MSP_SET_FW_CONFIG 24"
+.LASF1372:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2024:
+	.string	"BAUD_921600"
+.LASF1944:
+	.string	"isIdle"
+.LASF856:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1851:
+	.string	"OWNER_FLASH"
+.LASF1068:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1407:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1725:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2043:
+	.string	"serialPortIdentifier_e"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1017:
+	.string	"IOCFG_IPD 0"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1648:
+	.string	"MSP_SET_BF_CONFIG 67"
+.LASF1306:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1790:
+	.string	"MSP2_SET_BLACKBOX_CONFIG 0x201B"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1252:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1022:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF839:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2126:
+	.string	"logConfig"
+.LASF2046:
+	.string	"msp_baudrateIndex"
+.LASF719:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1925:
+	.string	"txBuffer"
+.LASF921:
+	.string	"_T_WCHAR "
+.LASF765:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF914:
+	.string	"_SIZET_ "
+.LASF1656:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1318:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1160:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1042:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2116:
+	.string	"logIsEnabled"
+.LASF1185:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF885:
+	.string	"_STDDEF_H_ "
+.LASF1056:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1074:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1423:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1092:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1177:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1293:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1727:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1408:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF958:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1861:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1507:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1136:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF852:
+	.string	"USE_STATS "
+.LASF945:
+	.string	"USE_MAG "
+.LASF1868:
+	.string	"OWNER_AIRSPEED"
+.LASF1429:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1210:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1804:
+	.string	"MSP2_SET_PID 0x2031"
+.LASF1241:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1601:
+	.string	"MSP_NAME 10"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1967:
+	.string	"LOG_TOPIC_PITOT"
+.LASF2104:
+	.string	"determinePortSharing"
+.LASF933:
+	.string	"_BSD_WCHAR_T_"
+.LASF1478:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF764:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1469:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1096:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1163:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF892:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF922:
+	.string	"__WCHAR_T "
+.LASF1730:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF2020:
+	.string	"BAUD_115200"
+.LASF1284:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1517:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF874:
+	.string	"USE_RCDEVICE "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1934:
+	.string	"serialPortVTable"
+.LASF1700:
+	.string	"MSP_BOXNAMES 116"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF728:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1222:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1622:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1600:
+	.string	"MSP_SET_INAV_PID 7"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1932:
+	.string	"rxFrameCallback"
+.LASF2100:
+	.string	"tfp_format"
+.LASF1969:
+	.string	"LOG_TOPIC_TIMER"
+.LASF893:
+	.string	"___int_ptrdiff_t_h "
+.LASF2114:
+	.string	"bufPtr"
+.LASF1473:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1897:
+	.string	"portMode_t"
+.LASF1079:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1036:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF989:
+	.string	"U_ID_1 1"
+.LASF988:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2086:
+	.string	"offset"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1506:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1996:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1694:
+	.string	"MSP_ANALOG 110"
+.LASF1950:
+	.string	"pgn_t"
+.LASF1047:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2054:
+	.string	"ADC_AIRSPEED"
+.LASF754:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1979:
+	.string	"topics"
+.LASF1570:
+	.string	"API_VERSION_MAJOR 2"
+.LASF1371:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1986:
+	.string	"portSharing_e"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF769:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF792:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1479:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF879:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1538:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1309:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2055:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1041:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1452:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF822:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1913:
+	.string	"serialReceiveCallbackPtr"
+.LASF1030:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF847:
+	.string	"USE_D_BOOST "
+.LASF903:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF741:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1806:
+	.string	"MSP2_INAV_DATAFLASH_STREAM 0x2033"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF991:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1491:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF966:
+	.string	"USE_OLED_UG2864"
+.LASF1433:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF882:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1004:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1574:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF1888:
+	.string	"RESOURCE_ADC_CH1"
+.LASF1889:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1890:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1891:
+	.string	"RESOURCE_ADC_CH4"
+.LASF866:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1255:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF727:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1708:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF1907:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1965:
+	.string	"LOG_TOPIC_GYRO"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1689:
+	.string	"MSP_RC 105"
+.LASF724:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1938:
+	.string	"serialRead"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF709:
+	.string	"_VA_LIST_T_H "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1124:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1088:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF977:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1037:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1350:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2111:
+	.string	"inputPtr"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1107:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1916:
+	.string	"serialPort_s"
+.LASF1948:
+	.string	"serialPort_t"
+.LASF1837:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1191:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2012:
+	.string	"BAUD_AUTO"
+.LASF1937:
+	.string	"serialTotalTxFree"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1614:
+	.string	"MSP_FW_CONFIG 23"
+.LASF1028:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF960:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1908:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1748:
+	.string	"MSP_SET_RTC 247"
+.LASF1975:
+	.string	"LOG_TOPIC_COUNT"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF968:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1581:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1006:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1731:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1091:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1612:
+	.string	"MSP_RTH_AND_LAND_CONFIG 21"
+.LASF746:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1998:
+	.string	"FUNCTION_RCDEVICE"
+.LASF1046:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1114:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1637:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF804:
+	.string	"USE_BLACKBOX "
+.LASF1411:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1273:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"PG_GPS_CONFIG 30"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1065:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF2105:
+	.string	"findSerialPortConfig"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF808:
+	.string	"USE_TELEMETRY "
+.LASF1149:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1167:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF2081:
+	.string	"port"
+.LASF1013:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1760:
+	.string	"MSP2_COMMON_SET_RADAR_ITD 0x100C"
+.LASF1585:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF836:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF961:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF984:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1528:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1756:
+	.string	"MSP2_COMMON_PG_LIST 0x1008"
+.LASF736:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1742:
+	.string	"MSP_ACC_TRIM 240"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF371:
+	.string	"__linux 1"
+.LASF911:
+	.string	"__DEFINED_size_t "
+.LASF1072:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1070:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1640:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF845:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1921:
+	.string	"baudRate"
+.LASF789:
+	.string	"BUILD_DATE_LENGTH 11"
+.LASF1848:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1901:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1638:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF1393:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1279:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF773:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1188:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2069:
+	.string	"MSP_PAYLOAD_V2_OVER_V1"
+.LASF843:
+	.string	"USE_FRSKYOSD "
+.LASF1904:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1144:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1211:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF738:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF1537:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF1977:
+	.string	"logConfig_s"
+.LASF1980:
+	.string	"logConfig_t"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1290:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1997:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1175:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF955:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2025:
+	.string	"BAUD_1000000"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF867:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1673:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1621:
+	.string	"MSP_SET_BOARD_ALIGNMENT 39"
+.LASF1812:
+	.string	"long unsigned int"
+.LASF1048:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1858:
+	.string	"OWNER_LED_STRIP"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF779:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF948:
+	.string	"USE_UART2 "
+.LASF1582:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1726:
+	.string	"MSP_SET_3D 217"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1553:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1442:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1591:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF1541:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1424:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1522:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1299:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"MSP_SET_MIXER 43"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF744:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1606:
+	.string	"MSP_SET_CALIBRATION_DATA 15"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1778:
+	.string	"MSP2_INAV_SET_MC_BRAKING 0x200C"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1598:
+	.string	"MSP_BUILD_INFO 5"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1496:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2061:
+	.string	"MSP_IDLE"
+.LASF1536:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1514:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1642:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1220:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1770:
+	.string	"MSP2_INAV_SET_MISC 0x2004"
+.LASF2082:
+	.string	"lastActivityMs"
+.LASF949:
+	.string	"USE_UART3 "
+.LASF1645:
+	.string	"MSP_RX_MAP 64"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1295:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1008:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1546:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1066:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1025:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF899:
+	.string	"__SIZE_T__ "
+.LASF1447:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1049:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1628:
+	.string	"MSP_LED_COLORS 46"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF971:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2019:
+	.string	"BAUD_57600"
+.LASF1523:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1811:
+	.string	"unsigned int"
+.LASF950:
+	.string	"USE_UART4 "
+.LASF1589:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1534:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1419:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1696:
+	.string	"MSP_PID 112"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF718:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF956:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1357:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1143:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF862:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1294:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1842:
+	.string	"OWNER_ADC"
+.LASF1814:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF819:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF821:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1702:
+	.string	"MSP_WP 118"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1396:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF951:
+	.string	"USE_UART5 "
+.LASF1342:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1495:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2123:
+	.string	"portIsSharedWithMSP"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1880:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1480:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF967:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1434:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1139:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1920:
+	.string	"options"
+.LASF1100:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF697:
+	.string	"_STDARG_H "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1383:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF896:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1444:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1263:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF952:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1189:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2179:
+	.string	"stdint-intn.h"
+.LASF2173:
+	.string	"long-double.h"
+.LASF2184:
+	.string	"__locale_t.h"
+.LASF2186:
+	.string	"platform.h"
+.LASF2135:
+	.string	"src/main/drivers"
+.LASF2199:
+	.string	"rx_pwm.h"
+.LASF2167:
+	.string	"libc-header-start.h"
+.LASF2145:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2181:
+	.string	"endian.h"
+.LASF2133:
+	.string	"src/main/common"
+.LASF2170:
+	.string	"wordsize.h"
+.LASF2188:
+	.string	"target.h"
+.LASF2144:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2147:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2152:
+	.string	"<built-in>"
+.LASF2178:
+	.string	"wchar.h"
+.LASF2139:
+	.string	"src/main/target/SITL"
+.LASF2162:
+	.string	"msp_serial.h"
+.LASF2137:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2151:
+	.string	"stdarg.h"
+.LASF2143:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2198:
+	.string	"config.h"
+.LASF2169:
+	.string	"features-time64.h"
+.LASF2148:
+	.string	"types.h"
+.LASF2191:
+	.string	"io_types.h"
+.LASF2203:
+	.string	"msp_protocol_v2_common.h"
+.LASF2171:
+	.string	"timesize.h"
+.LASF2166:
+	.string	"stdbool.h"
+.LASF2146:
+	.string	"/usr/include"
+.LASF2132:
+	.string	"src/main/build"
+.LASF2189:
+	.string	"sanity_check.h"
+.LASF2168:
+	.string	"features.h"
+.LASF2187:
+	.string	"common.h"
+.LASF2176:
+	.string	"typesizes.h"
+.LASF2164:
+	.string	"printf.h"
+.LASF2156:
+	.string	"serial.h"
+.LASF2134:
+	.string	"src/main/config"
+.LASF2177:
+	.string	"time64.h"
+.LASF2149:
+	.string	"stdint-uintn.h"
+.LASF2163:
+	.string	"log.c"
+.LASF2140:
+	.string	"src/main/target"
+.LASF2193:
+	.string	"utils.h"
+.LASF2201:
+	.string	"streambuf.h"
+.LASF2159:
+	.string	"log.h"
+.LASF2141:
+	.string	"src/main"
+.LASF2196:
+	.string	"feature.h"
+.LASF2155:
+	.string	"resource.h"
+.LASF2158:
+	.string	"time.h"
+.LASF2197:
+	.string	"parameter_group_ids.h"
+.LASF0:
+	.string	"./src/main/common/log.c"
+.LASF2200:
+	.string	"stats.h"
+.LASF2192:
+	.string	"io_def.h"
+.LASF2136:
+	.string	"src/main/fc"
+.LASF2185:
+	.string	"io.h"
+.LASF2204:
+	.string	"msp_protocol_v2_sensor.h"
+.LASF2174:
+	.string	"stubs.h"
+.LASF2142:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2161:
+	.string	"msp.h"
+.LASF2138:
+	.string	"src/main/msp"
+.LASF2205:
+	.string	"msp_protocol_v2_inav.h"
+.LASF2172:
+	.string	"cdefs.h"
+.LASF2183:
+	.string	"locale_t.h"
+.LASF2150:
+	.string	"stdint.h"
+.LASF2195:
+	.string	"build_config.h"
+.LASF2154:
+	.string	"stddef.h"
+.LASF2175:
+	.string	"stubs-64.h"
+.LASF2202:
+	.string	"msp_protocol.h"
+.LASF2180:
+	.string	"ctype.h"
+.LASF2153:
+	.string	"version.h"
+.LASF2194:
+	.string	"io_def_generated.h"
+.LASF2190:
+	.string	"common_post.h"
+.LASF2160:
+	.string	"adc.h"
+.LASF2157:
+	.string	"parameter_group.h"
+.LASF2182:
+	.string	"endianness.h"
+.LASF2165:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \360E\005"
+	.string	"R\b )\220+\035\307d\300\205]\325\271o\341\360\033\270\036\262\001\242?\207z\350\273\273\273\273\273\235U\264\265M\310\336{\313\275w\222;\215J\326\232\006Q\005\003\271\004|\256\257\357z;7\021\210>\017\235\276?\337't\305\300\"\223\317\3622>\276\020'\r\f!_5(\262*\236n>\031N7\300#[P\220J\326\232\236\223\227\213\362\034\276\017\377\356\356.\035\305\241\2610\237\333;\332{\220\264\332n\017"
+	.ascii	"I\020|.\361,\274X*\354\205\005\2403c\001\2135H|\275W\304G\025"
+	.ascii	"A\312Y\234\235\271\3347\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \315\225\003"
+	.string	"\344\003\301"
+	.string	"\007"
+	.string	"\002"
+	.string	"\001\001\003\005\002"
+	.string	"\020"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\001\003\004\001\200\f"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\n\006\001\001\200\004"
+	.string	""
+	.string	"\t\007\001\005\t\001\b\t"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"\001"
+	.string	"\001\003\002\002\026"
+	.string	"A(H\271\003\035`\217\347\n@H\250\013;\0023o\361I\312\346"
+	.ascii	"\246\027\253@\001\002\310Y\360T\305\244\032\020T8\210\"\313\245"
+	.ascii	"`\220\311\006\260"
+	.text
+	.section	.gnu.lto_.inline.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\315\001\365\013"
+	.string	"F\021;9 \345(\351\013'w\f{\215\037\006\246j\205\003\355\r$@\324\210\311\024\312\320\367\210\020G\022"
+	.string	"mS\240G\002t\b`\030\301\024I\"Lp\004\320\007\372\b\355\223\275e\n)"
+	.string	"*"
+	.string	"1"
+	.string	"/\002\373\023\246V\026#\242\374\tNx\"\340URp\333\330F\006\35486 \253\224\355\363b\3575\345{\357i~3\206\004!\220\027\227\001\bk\360\367\344_B\374\236R\005s\331\357\262\206\265\207=\304\203\260\355u@\217\367^\347\f)I"
+	.string	"\254\250\360\275\234\377` \tT\264p\214\360\213\302\227\004\205ja\316.\373\264\336[Mi\222r\255D\250\324\350\310`%\364b\343\262\376\035\314\230\020\205%\345#\024\377\177\273\313\362\373i\337z\262.\253\313\220\2241\"\005R\267\242\260\025"
+	.string	"\003f\224\275\0178\321\332p)\f\3725\277\001'A\250\201\2612\201\314U-#-\0060\002b\224\223w\021@\251GvAk\332\f>\216\244;4\374Dn\203\372\314\330Od\2462k\214\366\346\370O\317<W\202_\300\"\210\2562\362``\272\367\273$BK\007\301\325\241\210|Z\217\353(\221\221\231\030\023a\020\256\326s\354\254"
+	.string	"\002\021A$\230%\274\rY\313\327"
+	.string	"\027f\273\311\271f"
+	.ascii	"\202\251N\004\214I\245\352;1\313\303\212\360\337\230\370\347"
+	.ascii	"\004~\301U\312\016\251\027\371Y\327\202\265\007M"
+	.text
+	.section	.gnu.lto_.jmpfuncs.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\013\005=\025"
+	.string	"\266\037lE\020\217(\035\200\f"
+	.string	"\025\301\2024@\305\222\215"
+	.string	"\320\023"
+	.string	"\200\372\016\013\370xE\250\362\323\366\204\343\332\002\345\317p,\021\324\027\205\257\227#\005\023}A\177\0322\\\033=\372lE\315\306\227\016\362\2156\331[\246\024X"
+	.string	"S"
+	.string	"T"
+	.string	"\033\257\347syh\335\004\002\377E\223-\0200UE\2555;F \204\307K\334\205\304\232\202\r,+\032ZB.:\274p\201QW_\3071\177\347\220\307\3465yl\037a\262\016\2026\335\370\371\361\273o\032g\266\364{\315\277\230\266Ts\316\322\215\245\331\277\236\366l\254\025\263\326Z\357\026\022\376)~\231\357\265\275f\177\340?\234q\275\373\007rgfn\026r56K;\273\031\261\263\337_:\303\360\365z\335\364\277\214\264/\363\030\310\302\241\345\3338\346\307\330\377\216\242T\262\252+\265\326\001\307\f\363\023$\346\330\320\347\372\320z\r/\311C\021\234\375:j\276YZ`\351c\374\177\314\276\342k\027I_\344v_[eA\3505\366\037\"k\255\365\013\344F\006\223U\002\202\"\223%\001\004\033LV\b\b\206Lr96"
+	.string	"\032\243\235\275:\276\221F\372\021\371\217\310\2753x\026N\325\252j\255\253\376\250F\242M%\232\026q$n$\r\001\304\201\bf\003\251-\324}R[\227\332:6\021%\370\030}T\030q\231M\034\212w\241K\361N'\317\324\245X09u&T\252\343<\366T(\240:\f\236\207\352\002\3703\341\304C\264q'\244\255$\300\366$\361\325\344\306\277NGL\026\n\bJ\223H\353\342\254Fk\250q\251RfnD$Ia\241\324\0010\002b \263\352\022\200\263<F\322\230\204L\251\222)\353ll\006(@u\247\246\276\027,\247q\266\322\371\234\324\310\352v$\215\226\244E\230h\224\245D\201:\033\305"
+	.ascii	"\003\227g!\250\251*\036'D,\300\255$3\351Y\030\256t|\346V\240"
+	.ascii	"\366,:\302U\024_)\022j;\310\250\031\200\\\273\260/\203\211\002"
+	.ascii	"\";\212\037G\t\350\225\300\204i\245\250\216D\347`1\374wB\372"
+	.ascii	"\017\230\301\267\257\245N\032\022/\253\242\337\031\272U{\n\231"
+	.ascii	"\240\320\0038BQ\025hgO\354 '\237 \260\030#\262/YH4.:\035\026"
+	.ascii	"\201#\020lvJ[ug\373\224\3179I\001\024ef\003fP\212\221`\211a{"
+	.ascii	"b{'\266\240\262l\301\230:\264\205\332\312}\366\357\341#\233\026"
+	.ascii	"G\317\002)hPu\315\177s\221x\237"
+	.text
+	.section	.gnu.lto_.pureconst.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\232\004\001\204\004\005\230\004\006\230\004\007\230\004\b\232"
+	.ascii	"\004\t\231\004\017\231\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \367\235\004"
+	.string	"2\207\027!\240'\351g5 5v_\377\377\2551\376Nm\375o\336\274\375?\307H\374,\376o\244\233\335R\246\253\310V\013\333a8\n\025)\013\034\026\271\311\3355$\377%\033"
+	.string	"\201\211ND\373\241\201\301=\226\2071M\\V\246\241\023*\207:\237\362\247\366\247\225V\371\353\365\234e\24137?$\025"
+	.ascii	"S\242\273\272\343\252YVk\333\352g\253=\017\313R%\212\013\321"
+	.ascii	"\025\201\232t(\301\270`K\021[\t\002\247a\020\202s1|7\203%\220"
+	.ascii	"\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.8e0d2acf571f86e5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_logConfig_Registry.37.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 \204\335\003"
+	.string	"\324\006R"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\255\013yw\250\364\004yu"
+	.string	"\005\001\006'\001\b\371\0070sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/common/log.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_logInit.38.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\022\005\345!"
+	.string	"\246\276\336I\200XN:\374\273\255\244\007\372O\f\236t\325\326\257\263\212\fw\340w{\334W\210\322 @\274 \272ul\033\020b\350\324d:\342\370\237\021''w\3713\377\3218\306\353\220+`\036\267pP\237\356x3b7!{'\031\313"
+	.string	"\276"
+	.string	"\305"
+	.ascii	"O\376\353m\367\201L\204\372o}\270\236\0016I\2368\363\326"
+	.string	"\232\265Pp\315mH\217\376>\356\3263\300\365loS\277B\rI]\345\023H\030'\024\326\343\340\243\351o\360Q\340\020! \005\352\327\242t\212k\306\002\332Z\327\304\344\274\0328\332=\351\321V\273\267\344P\3210\255~\210\3119\007\357\215\253\347\245;\214\236\327\252\375\036\262x\336\216\r-\256\247;+\270\357\3403\250\307U\334\227Y[\347\214\2200g\350\211\203\245\343h\203\254:\013t\221\003\363\363\004~\321`\332 \251N\035(sV3\310){\317\003[B\242\330 \245\316\033+=\274\356\366\235\035Y\\\326\356\206r\316m\217H\255w\357\335\235\243\273\255\272O%\001sh.\276\003\266w\230\304\322\315\341D:\2449O-\350\007\001\341!\3159_\354\250\275\002\350\330\214\266\3314J\256\345yDA^\235\366\037\360\001\330+\357\273\335GH\366\307\337\004]T\267\330?\263\256G\341\257\375f1\313"
+	.ascii	"\230]\331)pqW.\024\366\335\020I\272);\246q\230K\337\375z\035"
+	.ascii	"\243%\3235\326\346|%\334\275T\302\376\350\273O\353\232\272\305"
+	.ascii	"\276\333Q\2622f]\266d\272\327\242\275`\335\277\315f\263\331\367"
+	.ascii	"\253\373\311\367\357\353\333\307\263\335\343\331\346\361l\247"
+	.ascii	"<\333\273\3246\336\331FQ\333'\266}Q\333\366\264\375\034b\r/\313"
+	.ascii	"1\327\312\232\261\232e\362\034\212\204,^QR\244D|\227,\357\355"
+	.ascii	"Sy\025b\016ul\254\212\217\375\335n\325L=\263?\336\373\201F\231"
+	.ascii	"d\231\t\270\220adw\002\377h\224j\313\337}\362:<\366W\302*\032"
+	.ascii	"\356V\323T5\373\343\357^\255\213\n\356W\241L{\024\026\222\013"
+	.ascii	"\243\304B\214\3570I\227\204\226\361\355?9\024a_\254U\037j\233"
+	.ascii	"U\333\360Q\033w\254\003\332~\004l/\001\2377\370\376\004|\345"
+	.ascii	"\321\333MD\301\376\210o\357K~q\213\335]t%\026\320k\273\314\030"
+	.ascii	"c3\332\246\221#a\320?r9\fg\033i\300?\036\355k\300Gi\336K\360"
+	.ascii	"\321\363\326t\2311\206D\3122[2\031\316\312\230u\017\362\257\275"
+	.ascii	"\207\214bV\326\002\215\340g\301\017\020\356\r\020*\020\241M\200"
+	.ascii	"\310\343\023\324!\362\004\211<\001\236\206\302\013N\304\242\244"
+	.ascii	"&\bJB\0235JK#\232\204\021z}\204\240A\020P\320\b\240\037\337\005"
+	.ascii	"\243\"\022OK\034\222D\f\217H\030\021\211\236\206B\247\233F\372"
+	.ascii	"Q\022\232\b6\t\231\230\204H\301\246\245#\246 \322\220\030\374"
+	.ascii	"\311i\241\223\210a\360I(\034\006g\326\3743\337\257!\343\225:"
+	.ascii	"s\316\231\347\300\356nzyb\324\025/\202\225V\275\330\363\267\203"
+	.ascii	"Q\221\017\256\260H\253\240z\216\376\355_\324\026\003p\344\\\365"
+	.ascii	"\243\352\"\255J\3529j\357\203\373*\027\fU\206\375\261\317\034"
+	.ascii	"\343\026\271\320\350i\251\301\313\242\202\235^j\030N\373WN\247"
+	.ascii	"\202\2357\3240\034\206\217\356.o\313h\233hG\230ud\001V\250! "
+	.ascii	"\343\024uF\231\031\tdFi\2326\220\002\021\252c\007\021\200)\244"
+	.ascii	"\252\266P\263\001x\b\013\362\344\236\272\245\020\024P\037\b\343"
+	.ascii	"\351\357*\310\346\227\237\033\005\221\3739\332K[GsC\201\373\021"
+	.ascii	"&\236\2140\324\326\3144\337\333\243\204\232\352%\215\371J\362"
+	.ascii	"\365M7\310'B\266\225\267\025\3567d\002\361\363\3453\n\036\277"
+	.ascii	"\336\240\344\330)\277\364\2471\362\343\264\251\220<P\"\344\312"
+	.ascii	"\255a\237 k\001l\222r.\016\323\244\312\355x\314\t\303\322\365"
+	.ascii	"\264\013\374\317\232\201v\204\021!\350\352\263:\317\207\342\314"
+	.ascii	"\273\241f\340Ji\036\202\016P\226`\004\361e\255\372\2764\334Q"
+	.ascii	"\333\314\036\226!\324"
+	.text
+	.section	.gnu.lto_logPutcp.39.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\223"
+	.string	"\355\n"
+	.string	"vUNC\020\311*\035"
+	.string	"\317\361\312\256\235l\007\300\316:c\360\376\001\035O\004/\372\265\244;+B\210\205(K\177c\242\205oS\3238\235\fA\004"
+	.string	" \020\246Ai\032G8\234\310\230\350\212\n\250\021D\b\3312\2458"
+	.string	";"
+	.string	"8"
+	.string	"\266\335\362c\n\360\236\313?|\367\300;|\367L\332\020^\316\354\006F\001\312\201\t\273\033N\231\223W\322?\355\013\256\327\352\272\321\330]\253\353\265r\317\333\236\260\215a\337\023\352\203\233\030\003\211\332\256J\256\302\336\274\005"
+	.string	"l\337~\001\322\346\330\035\032\317\324\323\034\272 _\252<w]\022\330v\367\343\021x\257\363\342\271\236\200/\373"
+	.string	"\3623?x\303.L\026\270\273\"X\374S\247J8\211\2654g\337@I\n\334\335\327\370$\337\275\317\214\024\026\226\346\254\265"
+	.string	"\rV)\330\345Jg\214\375nw\327\023f\277\374\277\317\376\256Sk\027\037\242\232T1\022\205D\035!\020\303\351\026A\036cHh\032K\245Q\fM \244R(\242DB\020\204\307\023\007*\034\031GT\310)\367\335N\330\206\200\033k\266\374M\037\201\211Jq\251\357^\204\203\2269\003\f"
+	.ascii	"`\2212\023/\303h\b\350\005^s\201\320\030Q\322\206:7K\331\315"
+	.ascii	"p\031\004\356\362\242\235d"
+	.text
+	.section	.gnu.lto_logPrint.40.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\325\001\355\020"
+	.string	"\326\240tG\320\324I:h\333\004\206\005B\024\270\246\323\314\313\32000h&\005\233R\375:\210\023D\357\007\362\364\177;F`-.N\214K\324\345ct\345\r`)a\353\b\227P\213\376BoM\367>\330x#m\223-eJ\001a"
+	.string	"["
+	.string	"a"
+	.string	"\006o\"\257m\017 \2579fK\035\0341U!n\370\274\230\232sr{\364\330UR\213\2531\377J_y\237\354*\241K\237\r\252mB\217\321"
+	.string	"\017\031AH>\237h\022\204\344\261\276\231n<\301\361\224\202\344\323\020\t|(r\272\322\365\347\353QU)\230sZ\275\257\303\275\335\366\005\333\tl%\t\241\225\tH\324T\"6(\323\025a\177\3030\f\275F\366\223\376\325\301\177\223j\251\251cT\357\252\337b@4\325\343d\307\234Aa\221\t\245\3158a\373\366[\304l\226\215\002\224\242z%p\347\311e\273\206\"K\271\236\205\257\342+bO\302p"
+	.string	"s\0325\305\230\023<\340\002\333\265\207\221\003\341\345E^\213+\200\204\352\310\245@\3748\322Jt\265\266KF\3579\256\314\333\322xG9\314\3009\347\212\332F\t\037E\261\202\334\205\261\364kGx\351\275]\027\242\331\312\334b\022\242_\024P\215\265\216\374\306,\351\230\351\020\373Kw\241\343\233pw\243\367\256\3717\362\332\267\225c\210G\0032\026jp\242aV\020\264\260\264\314\260\250\224\314\344\304\254]*4\235\004\316\246{\275:\027gS\003\363\342\\0\034Ne\200\273\t20\216B\327\3018\0268\037\347\032-\360"
+	.string	"\305\263=q\3169U&\252o \343\312]\355\215\3344\244\355\340\201\336s\234Cr\357s\204GC\267\232>\207(~\220d\216\214\233\301)  "
+	.string	"\003\021)^\f2\2242'\336\205\242y\017N\203)&Yw\351\002\227\227\362\200+\271M\303h\021\277\005\242\2402Ly\370!,\230\020\302\374\030"
+	.ascii	"\262qfc\0231*\302\220\366J\304\271\226\221\357\315\030u`f"
+	.text
+	.section	.gnu.lto_logFormatPrefix.41.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"u\f"
+	.string	"\366\330YC\020\257&\035\034:PA\336r"
+	.string	"\026\270h\204\327\030{\204\\\b\342\013"
+	.string	"\362\3473\366\335n\255\327o\240\366\030\201 ^\370~^H\222"
+	.string	"\215\252.\362\365\tv\302\034\001ua`\257\020H\b\331[\312\224\002E"
+	.string	"C"
+	.string	"D"
+	.ascii	"\003vY`bv=\017sX\217\266\375\0227\3611h\343\265\250T4\035J)^"
+	.ascii	"\354z\233"
+	.string	"\275\027\240\036\255\023\240\036\025\304AO\220\177\024\207#Z>SJ\350Y5\330]\247)E\345\326\333>`\033\202\375\b\001\351\353.\277\365\227\237\212\351\030\323\020\2465\246\023\246\217]\"V p\261\353\341\223\2613Q&\204\355\217\215\331\032-:4\355{?\361\371\313\006\003\330]\201\021\263{\3620\003\3531\203\0323\035\231w\341\360*,X\273\244\2338\213\344\200\343\321R\273\313\2207E\315J\032\262*\374\351\224\252V0$\022\243\374|M=M\251F\224\237+\026\367P\224^\r\314 \311\214\3623\266\262\031\303\366B\251\037\354\303U\026\333\001\316&\214$\370\330\320F\024lH\b\340y@\302\231\240P\026\371X\020\002\022R\002\242\t(\321@A\315\321*t\027\266\223\216\343:\316vb\"\302m\234\216g\3236\3560\220t6\224\256\353l\230\267\367\245\231HG\216z\351K5\242L\205\372\323\003\r"
+	.ascii	"r\221\"34\030\301b\2674\006[\312g\331\256\211i\265\330&\231 "
+	.ascii	"p\002\tM\205\237\356\230\204I\006"
+	.text
+	.section	.gnu.lto_logIsEnabled.43.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375``\002\r\024"
+	.string	"\306&\207H\300RN:\n\225$=lr\364\302\002\244\247\326\031\252\213\325\266\274Q\362\243\212\217\r\335\016\325\211\373\342\312\232\307\363|\326P\t\3743~\267JA\020\004\245\220\330<\244\351x\007\310\200\021\246\031\365\2235K\310&R\246\024u"
+	.string	"g"
+	.string	"w"
+	.string	"I\030\374\232S\310\351i\316\235\212\013\270.O\036"
+	.string	"\274\374^\002^\3326K\002\034\347|W\364\023\356\214\3101a\315\271\223m\210\347<\004\345\267\232\343\207.\237\020\021?zt\031\036\272:\034\314\211:\036\2251\335\316w2\347\274\013\036\375r\242\016\247\373\225\0049Q\305t\267/\205\n\205\207/]}t8\325\320e\316i\355\321m\270]\267\275c\273\201\255\032\002 \206"
+	.string	"\021\205\246j\331\273\233.\221\375\355\365z=\357\220m5\311\223\376\021\227Z\374\356\207\205\352\027\250\016W\r\256Z\202\352o\325\273j\225\352\307`7\246\016\354\230\363\247\2675sH\250\022\266\357\363\276ts%\257\222\r\254K\237wc\213\227\267ql\3216Y\241\262;\003>\030\270.MH\250\250\332gq$\234\007\217\212"
+	.string	"\265{\031F\347\221u\005%aV<\0348\315\362W\367\271\":\332\263-\341O\023\\s\342\024\3703N\343\305?\272\364\214F\003/\277=8\244\370\200\224\2645\202L\021}4\340k\0354=\006\rL\255\006^\276\366\365 '*\023\353\021\024\367'xU8\315\262\377\3420F\377\310\025l\372\036\033x)n\314\bHG{\376\322aM-tL\325r]E\0051\264\013\264\030\351\027\004\013ZXZ(\260\254"
+	.string	"\230\325fF\033\351\331\n\314\030#\223\031m\266q&\223\251\275\330d\263\032\013\262\025\001\036gh52\233q\254\221\211;\235\177s\207\254\022\345\272(W0\345\341\372\330&\331\023\235\2759\\\222])\3277\347\234\341\022\371W)\025ED\300?"
+	.ascii	"\301]+^\225\334]p\007H\345\200n\332\363\267rdS\376-\001&\236"
+	.ascii	"\255\033\204+ \220\242\232Jn\204\245@,\236,%\b\311\023\3076n"
+	.ascii	"\003\333\371jW(y.Q\334i\251\321\365=\357\236-\307'\334\336\302"
+	.ascii	"\023\370)\317\314Z\034\220&d\300.0\366\316\342\216\246V\330Y"
+	.ascii	"\030,\271\271\030E\032\347\205\035U\303\025Kh\030\354\220\335"
+	.ascii	"\214\254%\353\333\333\245\257\303D\336\252vA\001"
+	.text
+	.section	.gnu.lto__logf.44.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`%\006\325#"
+	.string	"\266\377\335I\200\030R:\377N?+\273\377\317\252\327B\222j\370a\206\203\342\342\215G\351\013j\215_\005\247\200g\341\260\326\006\302\372J~y@\334\342\217\251\326\263U\017\3413\234\273\362\374\025Z'I\237\016\030e\b\364\317e7\331;\311\302"
+	.string	"\277"
+	.string	"\314"
+	.ascii	"i\366aa\214H\210\3648\315\317d|\335\311!\216\252K\221f\316gF"
+	.ascii	"O_wY\243\245\304\253\264\311\227X3\347\214!=\366\231\362uw\277"
+	.ascii	"\311\235\250'K\361LuU\364\245\326\314\371\n\350\270\213\322\343"
+	.ascii	"\257=\2744\337U\362%\352\231\254x\200\234\275\322\020\245\307"
+	.ascii	"\275\246\274\244\317\256\013\244HH\217yI|\267\335\027\273\021"
+	.ascii	"\365GX4.\347\256\036g9\257\276V\220\036\367.\340v\214\236\347"
+	.ascii	"v\334j7\231\257`\371cC\252\306\330r\316\277\253\343\3521z\255"
+	.ascii	"\332'\036_y\224\306/\372\343\205\343\251\303\232B{\314-UW\336"
+	.ascii	"\306\3002Z\013`(\347\334\366\210%\343}{w\033u7\260\373\206\024"
+	.ascii	"i\310\2473[5\335"
+	.string	"\253\321\336\257\356\243\371zuc\333?\330\266\017\266\315\333\361\344l\357\234\311\257\363\2627\016\266\235\373\372\343~\344Oolcl\033\275\261}\255m\253\263}\004\004\274\270\266\276\302\256\2275[\265\255)n\301\313\036'\373\313\376\344\177v\264\373Z\260<\013\316jv\217\270f\253\253_\351\326\365\323\227\375*\267\202\263\304p\211\345\234u\352\323\202h\326\312WL\336\341\313\331\253\265\320\203\247\247\005\277f\253k\345\243T\0352\272\310hr\307\nt\374\323\345K\355\321\236N\245\307\364\254Y\206\212-61\266\343\036\361)O\335\272c\373'7;\224+[\307\343\022\345R\324\237E\0058\227\347\236\r\025\227\321\266\365\217\325\271_>\021\2459\027\177\374\362P*\024]\260?\356\\\017\310\252K\354\035\023Y\300\002\375\313?\311\340\003C\003\007\373c\3530\265\236Nk\366\003\275]\216\316\376\227a\016X\223\2702("
+	.string	",\347\f\341\030\275?s\314\262f7p\356\313\336+Z5}/\316=\233\2526E\333\326\003\254\275_^\351!\3159\377\330\375\001\204\375\361\336\336\216\355\0261\302\376ho\007\244\361\022\333\232\325x\232\034mdh\n\262a2\n\315\271k\302\317\216k*\261m}c6c\315\266\320\222\303n/\335~\221\226\204\231\262i:\307\342nz\273\201I\366\307\337\007\310\026\227\330\272\2535l94k\331\252\351+o\024&\200\326\351JC\244\013%\265Ai\210t\223j\032\n\211\240\216L"
+	.string	"qG(\254TP\3512%\241Hb\302}\304 \202\003!\007JBA9\300%'\241\024n`P\t!\323\257I\030\f\n\201\277\246\245\243\340\017\b\025\365\013\352i\241S\022\324OJ(\204\372\351\326\342\207\212\327x\374?\201\3059`B\324\260\335\305\367UmvY\362\323y\300\252FT$S_\236\316\235}\243\335x\356NG\004\013s5s\202\227\273\274\234\226,\215\205\371\236n\310ZV{\257x\2643}<\233\305\346\373N\n\301>\217\376\360vl"
+	.ascii	"\314V\361\350lp\237\373s\355\031\252 \306\344}\256\204\0276~"
+	.ascii	"\3459'@\326\262\225\247f\302\232"
+	.string	"\3172\017\336\256v\0352\007\354h\357\025\205\360\354\334\177\250a<\306\024R\246DDD\302L\n\322\034\220\002\231)\263\016\021@\301de\222\264\316~\006\004J\222g\273ZZCe'\226\353O\177\352\362e\226\037<\341\246\003\224\277F\311w\212%\312\274Y\310\235^\234V\274D(\027@\304\241\024\367\237?M\327\263\320:\202j\344\030\314\342W8\222\243H6\346Q \3036q\367\360\177\246\210\232\240_\232\216\004\272\021\373\005\367_\370\322\005\307P)\307)\346\023\0062n@\214\235\030,\322\311\374\2706i\022\020\335R&\020\243\207\017\002\311HJ$4\217.\005\355\3663L\337\261\375\364\313\206u\251\200\276t\324\256\035\255V\372[\213\336\b\034\b\277t\013[\262\203\304\336\360&\201\317\200\245\373\243\245>0\322c\366\035gX\276\022W\330\344{\375/\261\232\336\371\023\305\210\2028\271\357\007\331S\241\233"
+	.ascii	"\026s_,\251A\360\256>\023\3767\246DK\r"
+	.text
+	.section	.gnu.lto__logBufferHex.45.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`5\b-/"
+	.string	"JTD\022H`\034R:\033\324\341\021\214\354\310\033\225\202\244\3014b9\276N}e!\031`\003C\236z\317\260\267jk\372\234\271%\273Cs*r\215\002E\342\306\237g&\263\266\030\317\311[]\210\260\226\303x\355\227|B\310\336I\006\021\001"
+	.string	"\001\016\001O,)\231,\347\034\340\353PV\377zf0\307\346\274\345\244\t8eG\253\245\234\210\366\353Pr\330M&\365\314|\356\234\313\271\267\234\243\t\276\366\206\026*\033\252U\216C2\204\r\361\224\213!O\245\333\004\365d\245X\323B\373\265\243\255\220\222\341\215\026\255Mh\277\n\r\031\376v\377\311\241 \037%F\357r\336\n\333\222st\330\007\332\257\301\003\331\257\352\177\354\327Fv\263y\364+\177l\215\325\230\234\234\363\021\366B^5\372n/\362\276\036o\327\352\330U\305\027\331O\336\247\366^\217\363T\004o\\\340\274\355\331C\005\332"
+	.string	"k^\355B$O\036w\247\352\2266\300\336\366\334\241B\220{\353r\266_'ty[!WX\327\3518\2536X\312\311\342\201Z\251>9+3=(\363\256g\373\352\345\204\333\272\302\272*\334\272\312:V\rp\001\231\323\203*\325`\332\324\352j\2775\240U\367\352(\344\234\3736\241Wo"
+	.ascii	"\357\3563\335\355\354\3265\tHX\216\024\327\246\301\255o\301\276"
+	.ascii	"\314AhQ\335\271\276fkm\371\316u\317\355NZ\272o\372\340\253\275"
+	.ascii	"5\0233\255\302\311\356h\362\342\256\356w\\\026\327\2621W7\221"
+	.ascii	"\360U\376\002\217\376A\217\362\003\235\312\377s\2647\360\007"
+	.ascii	"\340\266\317\247\357\036\357e\357\235\357v\353\273\255\353\335"
+	.ascii	"fy\267\327\335mu\275\215\357\355\333\336\376\001\236/lFhr\266"
+	.ascii	"q\207\316s\272v)\362\351_\366\243\035w\177\210\306\260\277\326"
+	.ascii	"g\353\336\020t\332\364r>\267_\377+7\373\230\223\271Z\367\204"
+	.ascii	"\274\224i\241f\254\236\254\034kc\3048Mk\321\034\223\363\226\263"
+	.ascii	"\2125\303\356\177\351>\230\207A^\314\317Z\230\214\346\3443\347"
+	.ascii	"\334\324\336\313\317\324<\341kc9\332\r\212j\241\375\f\313\240"
+	.ascii	"\021$*\340k\377\254\373Z\336\305x\"\231\2259g\240-\347\202l\340"
+	.ascii	"-\212~\335\310=7(\372u\365\314\311gY\320\227\376\330\322$M\347"
+	.ascii	"u\220\204\216\360nd\343|\216\261\3159C\350\313\371\360\263\001"
+	.ascii	"_Y\231O\344h\354W\007\3574\366\353\220\233\033\036)\220&\343"
+	.ascii	"\003\t\027\213\364#+\304E\2614>\251\017!~\331\203TG\226\207\205"
+	.ascii	"\370\2161\177\364h#\272+~\333\343\220L\210\334rf\276\211l\322"
+	.ascii	"2_u\340+\213\273\221N\220P\2308\331<\f\304,\276\212W\374,Vv\372"
+	.ascii	"oS\310\260\226H_\n\337\311\203\352\336\351\036\376\301\030\263"
+	.ascii	"o\230J\252\356\235\366Iw`+`\226\320\025w\035\331O\357A\353lW"
+	.ascii	"\227l\361\3440p/\006\342n\013\027\204n7\006\r\367\315\213\203"
+	.ascii	"U\322\033\020\276\344\336T\002\327\007wo\350p\337\354\240\022"
+	.ascii	"'\333gVGB\334\020\034\030w5\221=V\022S\243\274r\375s\2030\020"
+	.ascii	"\356\006\021\342\276y\214\244u\315\346~\360\311>\"\016\200\037"
+	.ascii	"\331\227=\302\033 >\332\203\277{)\177\360\037\333M\242\304}\023"
+	.ascii	"\210U\262%Nv\035\234b\240\200hJA\353\344t\213L\034\214\305\244"
+	.ascii	"\024K>#S\324\213\nSIOm\223\224\022FZ`d$r(Fq\210\222\202b\341"
+	.ascii	"\3242\301p2\252E\246\246&)%v\005\223\013\246\025k')\210\340\200"
+	.ascii	"\201\203&\006F\001\226\234\240\210Qk/\031\241 \2568bA|z\".\035"
+	.ascii	"\261pJz:Z*\032\217\214\202\232\b\305T<\212\"\022\213G\275h>\005"
+	.ascii	"*\\u\237\212\223\275.\272-\276\311\377p\213\317\374QufG\304e"
+	.ascii	"\376\270\271\241\342\322\226\345\336\335PW\311\003\204\374\221"
+	.ascii	"\375a\035\276eNC\032\346S&\367\204\247\266<\374\303\316\376a"
+	.ascii	"%15\265\363\244Pv\270\253wjtD\370l\337q\301EQ\317\346=\354lU"
+	.ascii	"\267{[\003S\357v\036v\026\300=l\201\214\362\312\375\250\241\203"
+	.ascii	"w\357\\\367\360\247Ws\316\271\305]}#q`\254\026\234\332*\304;"
+	.ascii	"\354\354&\302\237>\370#\333\303D\370g\373\275j\350\330a\nTw\356"
+	.ascii	"\352p\227\333\b-*%E\367\001\362\b2\tO\200\241\250Q4\006\215R"
+	.ascii	"\246dFDD\222&\351p\002\0219W\335\021P\301Dt\232\224\322\030\005"
+	.ascii	"6\205\273\"\226\"`/0\345\257$l\246\361sd\024\271\242\331\374"
+	.ascii	"\252d \324\224j'\321\241\365\020\312\375\031\006/\032q\337\350"
+	.ascii	"c\017\346\3761\333\222\001\327\202:\271\250\375l\363\351~\206"
+	.ascii	">;\022\247\241O\212\264\204\210F\376n_\374\360\004\032KO\\\235"
+	.ascii	"m\276\021*\004\264\317n\374^}^\332s\30307\267\317\007\3325\357"
+	.ascii	"\307\200F\337)_\262\003\2063H\037\222\345\211\336\254\270\347"
+	.ascii	"\344\021\264!\0036\r\307\204:\t\232\"\261\013\260<@\221\242L"
+	.ascii	"\311+\364\332\001\032\215|w-\2244\204\227\033\300y\264\251`V"
+	.ascii	"\353\233\266\202>0$\335nC1\240\346/\273\214\370?\347o\204\201"
+	.ascii	">\003\177 \264s\245\317\347wsY\211\r\213\306<\017jqN&\371\301"
+	.ascii	"^\355\260\3607\003\205\007\207\322[\247\r\037\260\370\311\210"
+	.ascii	"\330\2005\356P\027\211\343\3258\204\025\016\330L\b\206\215\361"
+	.ascii	"\331\031\252-\343\3302b\252\311H\204(&4c\361\001\336\003\305"
+	.ascii	"\223\270h\254o'\354\302\377\3166\n\026)]\204\276\\\f\036\021"
+	.ascii	"7\256L\001S\250\267r\267\022.5"
+	.text
+	.section	.gnu.lto_logPrint.part.0.68.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375` \001\345\f"
+	.string	"&\030UA\020Q\225\016\240\230\210"
+	.string	"\305V\204\243\034\317c\262\355\021-"
+	.string	"\315\235x\302\224\375I\352\2416\206%\030W\013;` \242\020]\267\252\252|\217\2373`]\311\r\024\036\311{$\267\233i\321&[\246\024?"
+	.string	"D"
+	.string	"?"
+	.ascii	"\237\026/ \362\251=@\344\323\276\n\333"
+	.string	"\251\225?{\306\305\023+!\361\002\303Hcw\267Oi\342\337\245f\237\177\330'!\013\274\244\260<\\\001<\223(\330]k\037\356y\333\006l'\260\337\n\207\271b\373\035\257S\006\024\241\371\364\307\317\256|N\360I3X\020w\227\203\321\240\221\372\216\327\t\006\210\021h\237j\247\316\201\272\210\333a\205\0015\252\027\375\025g\361\235\003\365\215]\327\007\310\256X\340\323\004\264>\nG\360\364\241\027\371\274\234\204Pi\210\017\3737x\304d\254\372\036\377x\325\230\377\272\027\2504f\231\311\022\366\263\225.\373\342\257S\3759 \264\214\330\345\020Rc[\323E\212\217\267?\246\034!\n#/\363\207s\300\323\361\210:\033\213\310\324@\032\264q\320=\330H\035\307u\240\2154\372p\033\250\344m\233\213;\b\241\322&\241\353J\233>[\3512\003\0201T\262\202\244\250\312K\233\353\364\2413\027$h\277\305?L\001\034"
+	.string	"qI\271Zd\324\025\030\027\f\350\312\211{S\3062\330k\252\245\374\200\214k\370,+\034=T-d\20219\214z\230f\201k\\I\013*D\236%\317g\3306Sv\032"
+	.ascii	"\256\275\230rZN\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\n\003]\020"
+	.string	"T\031\006\004"
+	.string	""
+	.string	""
+	.string	"\002'\177\030\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006+\177*\377\377\377\377\003\271\220\005 +\300\204\001"
+	.string	""
+	.string	"\003\005!,\"-\301"
+	.string	"\002)\177.\002\304"
+	.string	"\177/ (\1770\002,\1771\232\220\202\002&\1772\272\00523`"
+	.string	""
+	.string	""
+	.string	"\00544556677\002-\177\025\205\244\234\363"
+	.string	"%8\305\204\001"
+	.string	"pg_registry"
+	.string	""
+	.string	"\005#9\001<\177:\037"
+	.string	""
+	.string	"\200\220\200\001>\177;?\177<=\177=;\177>:\177?9\177@8\177A1\177B0\177C3\177D/\177E.\177F\302"
+	.string	"\177G\301"
+	.string	"\177H\300"
+	.string	"\177I\003\005\022\304\001\003\006\023\244\001\003\007\025\330\214\342\221\002\006\241\362\253\332"
+	.string	"\001\202\006\003\007\024\256\213\261\377"
+	.string	"\001\304\007\003\b\001\302\001\003\b\031\310\377\241\372\001\001\244\007\003\b\005\302\007\003\b\030\304\013\003\b\027\204\016\003\b\026\244\033\003\b\007\202\036\003\t\036\003\001D\003\t\035\350\315\304\341\002\001\244\006\003\t\034\340\274\347\254\001\001\344\n\003\t\033\306\367\321;\001\304\016\003\t\032\317\235\227)\001\344\017\003\t\b\213\335\243\257\001\001\202\026\003\017!$\003\017 \204\006\003\017\001\342\007\003\017\037\225\251\363:\001\304\n\003\017\031\360\372\2508\001\204\013\003\017\005\242\013\003\017\022\221\205\327\307\003\001\304\017\003\017\007\244\262\235\334"
+	.string	"\001\242\026\003\017\007\274\372\312\022\001\242b\003\017\037\360\372\2508\001\304b"
+	.string	"8 "
+	.string	"\003!\242\325\001\365b\030\306\353\031y[e h\320\rm\350Cgh\206\261>\323t\221\375\320=\016C5\375\t\256Kc&\340\222\340"
+	.string	"\016\300\001\034\301\021\034\301\021\034\301\021\034\001\2073\020\333\226r$L\206-1\020\332\216\366J"
+	.ascii	"\035\235\201\037n\303\002\201{\270\272\361i@\256\036\244]\007"
+	.ascii	"\301uz\305Z\004\351\323\b\203r\2321\021\247\203\341\004"
+	.text
+	.section	.gnu.lto_.refs.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375 Q\005\002"
+	.string	"\322\004\016\024P\215\322\030033ub\003\006K\306j\337\022\261\211\334)\227\325\006\253\020\234\b\214"
+	.string	"|P6\030J\030]\222\210\261p\007M\314[c\207*\365Q\037s-\325\027\001\001"
+	.ascii	"T0\307"
+	.text
+	.section	.gnu.lto_.decls.8e0d2acf571f86e5,"e",@progbits
+	.string	"(\265/\375`\3313\225\342"
+	.ascii	"\272`YNU N\271\235\016\203l\232\3445K\312\037\225 \317\020\305"
+	.ascii	"\003\216\304\r\2344L5M\334\260\2036XA\222\371\201\270A\036\255"
+	.ascii	"\304\274\254\332\342\313~\210\303\213Z8\373j\373\222\312\f-F"
+	.ascii	"A\375k+\307\216\216\275\227\3041\3640\b\316\226Q\021\326Km[\312"
+	.ascii	"$SS\004\304\004\356\004*\373r ^*V\242\357G}\214;\365\271\227"
+	.ascii	"r\"\020\021u\2331\025U!\005jo\301\3659\242\343\274w\272<MdE\342"
+	.ascii	"\364\303p\2143\324\203MM;\036\323\216\277\364\265\253b+}\253"
+	.ascii	"w\003\361\223\216\242\033\307'=\022\222\263+\240\317Grm{T\237"
+	.ascii	"\035\277\320~\361\004[\300\335\035\367\356G\f\252Z\366\227\344"
+	.ascii	"\025\304\005\025\236\336\365cqj\330\316%'\252\262\301\237@\""
+	.ascii	"w\b\317\235Q\221k\244\250\310\221\233\344.\305\313\367\334\303"
+	.ascii	"\337\230JeR\266\304\363\362\314\317Y\321<\001\247\303\001u\356"
+	.ascii	"\242\376\204\226\r\263\373\226\202\016\320\211\212;)\023\334"
+	.ascii	"o\036\340\365+\023Cz\237\007\372\026\317\342\211\276\350S<\212"
+	.ascii	"\027z\243\017\372\241_\361<\257\342\241w\372=\257\343\277\363"
+	.ascii	"Ow\241\356\355\334{\373\305s\177\361\357\271\205\327\020\203"
+	.ascii	"\001\351\033\315\236\352\336T\277^\3567\260\347\n\271CR\320\001"
+	.ascii	"\332N\033CD\320I\333QH\2707u\004\227\021F\3109UPx\003\310\376"
+	.ascii	"D4q\333}\236~\247\031\330\237\0375\317\330c\233\372<\375\346"
+	.ascii	"v!N\357\234\344\336\264\277\232^1\3342,\f\323\331\352li\310\222"
+	.ascii	"\253\344H\257\353D\226\366\237\241Q\266\276\362\016?_$\2270\207"
+	.ascii	"EWXx\2120\001\371\354\317\244\375\217\264\377\n\355\257\243\375"
+	.ascii	"\"\321\032\252\332\375\016\251\256TSa\200v-*\206]wJ{\032\004"
+	.ascii	"9\355WM\373\245\352\273w\371\356\364\303\355\363Kv\313\374\304"
+	.ascii	"I\335c'zE\220\314\262\264\337\017\304\226\373\201\350\027J\213"
+	.ascii	"\260\273\034\210\027\210]\316\311\221\303\t\372\303\216\b\344"
+	.ascii	"k\223\371\360k\327\"\265\366\203\351\363\215\273u\207ktp\237"
+	.ascii	"/\217+w\247\"\3349\277t\267\207\2578\324M\375\250%gb\2375\\\016"
+	.ascii	"\304\177j\277\"\020\361\341\341\025\201\270\002\355\310\r\304"
+	.ascii	"\233\203\245\253I\254\353\263\217\3208\334L\222$\301\240~\016"
+	.ascii	"T\331\035`\246\037\r\262\317\367\306e3\001g\006\331g\367\313"
+	.ascii	"\266\206Q|\t\262}\276h7\355N=\270jT\257\275\251-*??Q\321\317"
+	.ascii	"\316\202\366\303\353\001\361\2369\334\275\362Q#\362\331\2158"
+	.ascii	"\240\273\237\244\354\200Z\252\373\354)h\020.\007bn\273cb+Fd\322"
+	.ascii	"\277\317~\247"
+	.string	"]\327\353\206\341gOt\233\355M\275\200\002XFA>_\352\005\363\033vkx\t\bp\314\f\333^{\357\033vBto\234\033\326\242do\234\226{C\2707\204\314\2654u\203\230\335\004\255\342\301\357\227\263\204m\004\370k\247^\016D}7\020\335\277\204\032)\356\370j\372\032\276>\310\313\375\211\272\236\313\013\340\216\027\340~u\374\226\373\217\320r\177\021d\271\277\f\356\217u\345~\333\236\206\373\263V\3567\354g\270;\b\256\314W9\001\3341[q\004\356\2566\345\034\334\361\216\373\223\340\3761\242\334/\004\\\305\035/\271\177\003\240.\217\177r\367/\367W\301\311\001\340\216\247bp\242;\246\200\373\325s\177\030\377\342\233\236I\310/\275\t\244\356o\243\364)\210\272\337\375\367.\334/\013\336\351\3769I\356\317\203t\3638\356\177D\365\005\270c8\367\327\300\375=p\377\016\334\177\003\367wq\177\016\334?"
+	.string	"-\334\177u\177"
+	.string	"\270?\007w_q\317\021p\377\"\367\027r\377\037\367\357q\177\035\367W\201\373\237\300\375i\334_\306\375a\334\177\004\356\257\001\367\237\200\373;\300\375Mp\177\003\270\277"
+	.ascii	"\334\037\004\367;\350~\005\335/\021\367[u\277\200\356\327\317"
+	.ascii	"\375\356\271\337\035\356W\316\375\272\271_4\367{\346~\311\334"
+	.ascii	"\257\230\373\345r\277[\356\327\351~\265\334o\007\334\257\007"
+	.ascii	"\356\027\313\335\221\356\216\304\335\227\270;\020\367k\345\356"
+	.string	"}\356\227\312\375\306p\277N\356w\311\375J\335\357\007\367\213\302\375\"\271\337 w\027\301\335\301\334\035\352~\177\334\257\217\273\257\271_\036\367\373t\277;\3567\307\375\322\270\337\031\367kt\277%p\277\037p\277\036p\277\037\270{\230\273\213\271\273\005\334}\316\335Q\016\017\017\017\3353\241\273\t\005\334?\364\0044t\007\037\017\270\354\342\263\263\217K\321\366\024G\354\320\364\200\307.&\233b\262Or\241n\025)\200TC,\302\rD%\301\265\222\366\373I\304\017\274\334\013\213\235\354-\002\216j\352X\f\203\275\031I\372\214\301\036Sq\230c0\254\342\244b\260|C`\2717\204\025N\nG\214\230]\033i\374\205\177\264\323\220\234\254\017-(\310\006\233>T\0230!mo\2373 \312\362\371\214\265\\Pxx\264)}v\215\243\035g\231\261,\221\342\271zq\214\365\201\032\234\333g\223\273\201\210\255\006y\214\354"
+	.string	"\3043p\025\246\">\235R\032\237E\\\016Db\324\213c\031\230\017\352&\364\331\261\224;\216\3021T\326z\330x\361\371\303\345@\\\357\006\342%{q\f\225\231\006\177f|v\374\344\216a`\247\0240\037J\266>_\252\313\201\b\200\273\201\210\233^\034\277hA\222\301$\372\314\341n`\302R\350X\220\266\317\001 r\201\227\\`\351\335@{W\201>\270c%\307\322\225\303\260@!\237q\324\001Q\202@\265\350\272a\037H\247c\tOw\340\302\003\036\302,\034\0239&\302Hz\357\355\322\203\312\020\213p\023\021} \362\335\271\240\201\217\034#\255;Q\267%\237\261\021\376Q\331\232\013\342\3433n\361\341i(\tJ\361\031\027\271\220\22540\247#\254\002\327-\3355\277\264\373\273\023\267\212\225\272\333\232*~\327\225\213\257"
+	.ascii	"\334=\357\355\356\037\224\330\2339X\025$\312IY\b\202\260}of\024"
+	.ascii	"\350\202'uL\n\364tJY\334\347\230\024\372\034\2232\377I\207\003"
+	.ascii	"\005\332R\246\336Q\250~\342\354=\026\335\320\024\252to\252\224"
+	.ascii	"\251\2518@\373I\225F/x:\245\320\373\034\333@\333\271\2010x\356"
+	.ascii	"\r\335c\322!\367\271\245@\317\261(\364\202\355\374\362z\026\266"
+	.ascii	"\200\336 ve;\230O\347\366\331@\313\031\005\262{R\243\267mo\246"
+	.ascii	"\231\316\006\222\356}\024\r\241\315)\203\331\326\264\3631!rR"
+	.ascii	"\231\267(Es)zBmn\273'\215(\t\235\275\371v\212\023\230\227\271"
+	.ascii	"\263\233\314\273\267\016\025h\357f\264\004D\321\213\267\003\264"
+	.ascii	"W\266\023\247\247\271\024U\321iFw6\r\245\013}\216-E_\334\310"
+	.ascii	"\306\250v\223\312\274T\233O\n\244\307\230\324\375,\262rd-\217"
+	.ascii	"\360\263c!\277aG3\230\232>\343\025/\216\203\326\2429\245\250"
+	.ascii	"\317)\030\312\202c\347l\016J\3257f\214I?c\237\37467\030\343\263"
+	.ascii	"\233\350\340\024=<\227\217\n\211\216\007EW\320\213\030'n\205"
+	.ascii	"WB'~0\303A\001\207\340'\336Y\333\322\352\372(\0201\257\315\331"
+	.ascii	"\003\353\340\234\235\252\332\216\317\330I=\251\242\341vWD\273"
+	.ascii	";\336\030\347\r\177\tf\376\341\235\342\346'\361/\274x\236\205"
+	.ascii	"T\t\357\341\0236\001\253\037\250\004\tn>\222\277\352\017!\242"
+	.ascii	"a7\357\204P\341\346\027\371\262\033\034"
+	.string	"t\031\341\322\t\222\271\261d'\212i\025\"\225v\342\322\037\271ceO\205\237\235\330\243_\360\215\334\351\017\356\225\224\24663\234\317&L\034\216\350k\022\355+\237v\263\225M{[\334\345"
+	.string	"\370\267\032!\034\374\352\273\323\377s\177\277\017\342u*Q\224\265\025CQ\237\257\313\335@|y\361\357\2735\n\301v\360\355=]\\\235\212\317\376y\257w\303Z\370\236J\336>\353\275\357^\374\361R\224\244~p|\366C \037V\220\3505\265~\370\030\333A\006V\346\343\347\256\337\2653\233\200\027\017\273\257\273\323\367\361=2uo3\037O\367\233\205I\335?&Q;\210\313\b,\201D"
+	.ascii	"\215\210\331W(\355+\223\366\025I\316\203\026\352P\n&\036qdC'"
+	.ascii	"\270\342v\244\224-U\241\370\254\303\344\360\206s\357\263\257"
+	.ascii	"+t\327O\331\356\274\252T/\343\332\021i\330N\261\032TKP/\003\305"
+	.ascii	"\235\031\002\314\324\262\236\353K)\r\307\267\375\215?{\264\317"
+	.ascii	"\361o\237\366n\017\367j\277v\247\317\3666\374\311\276\214\355"
+	.ascii	"\303~\314G\214\253\306\203u\225\261\275\325ca*U\005\226\246U"
+	.ascii	"/\266\177\361Obg/}\266g\272u\230\332\246w\304\320\252l\337\364"
+	.ascii	"\373\332\021m\346\220\023\266\242{t.'\201d0\b7\310\236\377t\013"
+	.ascii	"\225\020\310\230XN\022\2711\261\327QIjj\261\327\343\2511Meoo"
+	.ascii	"\332\263\r\257\377b\231\036\321\n\213\362:\372\255\225\347GY"
+	.ascii	"\020T+\237\320\376X?\343w\t4X\001\314A\303\360\363\323x\331\260"
+	.ascii	"[Pr\304\240\214>\337\032\271\251\003>+\350\222x.\314RAP\256\317"
+	.ascii	"\031\311\023\266\340x^}\316\204\230\306V\332\333\341\347|\344"
+	.ascii	"\336\031u\035\n~\316\203\016\030\366\365\243\360s6r\375\\\307"
+	.ascii	"\255M\350s\026\274\206\016\350\003\032\274IR\272\200$\341S\322"
+	.ascii	"\034\234\005\006\346!\f\350j\033\034\\\352\201\241\242\352yH"
+	.ascii	"\256B\021\345D\3649\013\271~ma>N\320P\373A\246\366\331Wz4\007"
+	.ascii	"2<\360\271\363\345?\227ht/+\305`\020\317\177y\013\007\365P\273"
+	.ascii	"\362K\261\023rA\304\257\017%\357\204\016(\235\347\3330\264\222"
+	.ascii	"\350\r\002\363\362\262\036\261\314M\317\020F\222/\277\254\367"
+	.ascii	"`'H\212\242K\342|x\376\341#\337\255S<DV'\007\304\363]\240\037"
+	.ascii	"\021f\363\363\324\224\311\307\347lgCo0\225#G\356\321\200\037"
+	.ascii	"]DZ\304\277\346\t\252\035\236{x\246k)\003\372A$\227\347t\252"
+	.ascii	"\272\224\246:\307e\036:}SZ*Z\"\234\344(\002<\244*\214!\343s\326"
+	.ascii	"\341\200\316i\r\244\317\031\0163y\216:\024?>\3477\314\343L\322"
+	.ascii	"\233Ji2\3177\310\262\333\372\265wS\004\265\311\267\237D\037L"
+	.ascii	"\006\005a\344\265yvKyb\221e\261\2556\334\346\006\331\326T~\344"
+	.ascii	"\030\256e\264\254\226R\3759\204\246\2651U\255\216\264\253\370"
+	.ascii	"\350l\346\371\314\375\344\004GR\223T\247\354\206\236\221\nS{"
+	.ascii	"JUwXBuj\036s\211\342\274\236\0263\264X\252V\316!1\317cmCPk9\214"
+	.ascii	"\312\334\201a`'D\376\2028Y\232FT0\352t\007\257\253\253<\315\240"
+	.ascii	"\253\272G\207\377~\034\036\371\362<\205;qV\345u\353V^L\267\276"
+	.ascii	">\347\256\313v\325\245\304\3649s9\234\377\230\233\312\371\234"
+	.ascii	"\261\362V\326\3616\215ni\215%\365\255\320q\322\202\013\310]\316"
+	.ascii	"z\0338Hnj\310?i\301\025*\302\322t\007=\0312\262\325\265\201\242"
+	.ascii	"\305\fb_\323E\333\f\317V,@C\324\033\237\363T\256B+;\004R\225"
+	.ascii	"\251p\234\317\\\324Qn\201\366\306\203\2527X\341\201)3\345\030"
+	.ascii	"7l\377d\360\005\355\"\"\334\233\350C\356\003{z\361/<\307\360"
+	.ascii	"\034U\002\002\034\216\371v'\b\205\363\314~\326x>\347'|74\206"
+	.ascii	"g\3709\303\310N8=Oc\237\337A\250,qJ[\36197]1\023-\236\033ER\210"
+	.ascii	"t\007&\017\236\245Y\212\267\356\\\333\312\326\023\324\320gO9"
+	.ascii	"\241;`y\270[\027\023zf\336)&\314Q\374$\332\320\007\2448\"AK\001"
+	.ascii	"I\311>\273\370\264\"C~(\321~\275\234Y\247o'\347x\361\241\310"
+	.ascii	"=X=\252\317\234\303\302\274`o&\037TD9)#e\243\\\224\217\3564\267"
+	.ascii	"\310)<\343\344f\017\367\227\334\"\237\270u\327\316\t\002^u\271"
+	.ascii	"E\366\311Ck\200((\244vH,\331\351\200\0354\237,L\203\be\026w\232"
+	.ascii	"\207\314\362P\376\311A\327\216H\r\f\253\256\303\b+D\360\370\214"
+	.ascii	"\210A\236W\244Qa\024\371\234U\230\020\261\230\313A\003\272\323"
+	.ascii	"\f5\242\345V\370\031\305L;J\230v\224+\235yt^\025\251nJ;J\224"
+	.ascii	"v\224\027\332Q\222\264\243\024i\367\254\223s\32619\301\272\234"
+	.ascii	"\363\373\256GOSH\377\007C|\230\367\226\0323'\205\306J\034/q*"
+	.ascii	"\322Q\344\251\035'\301\205@|\373\355\263\243l\355\030\311\f\024"
+	.ascii	"\013i\235\223\"\"\254ZRh:\354\364S=8\036\034\234\236 55\211\340"
+	.ascii	"\364\307yp,(\230\266r\343\254\260\006\232~\"Dp\365^\340\334L"
+	.ascii	"lT*G\366\021@0\375i\036\034\013\021\202\253.a[\005\313\0314\252"
+	.ascii	"\005\341\336t$\240\370\251Em*\321Sm\032\2447\340yp\374\367\207"
+	.ascii	"\001Y\210n\025\f\260\252\036\221\240_\344\364}a\256KF\025{C\241"
+	.ascii	"\003\200\325\347}\330\357\022m,\004\310\020K+\013\371z\301\344"
+	.ascii	"F\034\373\001\241!\343\306g?\301\321\036d\321\321\341=\275\251"
+	.ascii	";\366\212\326SZ\234\017\307{\216\365\256TY\2165<\234\207\203"
+	.ascii	"9%-\324\030\b\2763\221\242\335\005\tj\374\003D\013\217\030qt"
+	.ascii	"v\030\200\362\201\3669_\207#\342:\374\323\"\203)\266\367\031"
+	.ascii	"\367\370\240\366&\325\303\263\3425\265W\027\250=\007\216\313"
+	.ascii	"\201\345\210{_j\364\007\210\207c9\303>\027\203<Y\205<z\237?8"
+	.ascii	"\362\206\343\336\360\216\273\201N\350\242\352p\274#\305\006\027"
+	.ascii	"\216\375\031\303a\036\374\203\0238D\347i\327p\372\003755\354"
+	.ascii	"v\031\340Fms\354\246B\233\341\021\036}\306lW,\007\241)1Zc\221"
+	.ascii	"\003\203\342}\3266t\207$\017\216\321\320\360\226\211T\225\210"
+	.ascii	"\004\030\270\272\272\355\362HS4\2260iol\332\233\f,\215,\260%"
+	.ascii	"\214\313\f\212$\332#\n\212F\230$\r\215\221\003V\231l\227\254"
+	.ascii	"\262h\002\030c\273\324\200-\316 \217,\362X\023\223\001\222\265"
+	.ascii	"I\262\300\020\303*\215$`\210A\036e2\210A\036Wh\225I'\001b\203"
+	.ascii	"\345\221\206\346XCl\225\306v\211\301r\311\302\300\030\211#x\t"
+	.ascii	"\201\t$XQ@8\312`,\226X\316\260\3240cl\213\355\362HS\\AARI\242"
+	.ascii	"M\"Md\214,M\216A\262Ec\211\"\362\330\026\213\032b\330\026\206"
+	.ascii	"E\"\223*,[\270\200\304\362\006\206\024'\001bY\264\221iSf\260"
+	.ascii	"I\252\300\322\332\334$\2253E%\333\032mB\300\f\200]\246 e\276"
+	.ascii	"e\227\254r]\026glT\332\"r\306fE\316\330\340\274\\\262\312\230"
+	.ascii	"\030\243\311\f6I\230\254lmp\f\213\2349\322\030Mb\330\345Mf\227"
+	.ascii	"&\256,\316\330\250\314\240l\227\307\031\366\005\f\330\032#\006"
+	.ascii	"ZvFil'\300\326\034c8q\022 \220\311c\210\030\232\343\215\f\034"
+	.ascii	"\034K\260/\264\307\n\264\312$\211\245"
+	.string	"\206\345I{D\266 C\224\261!\312\254Z\004\210Vi\264\001\321\"\217\312\021&\2162\254rDk\254Q&W\320p\201V\2314\241I&%P\\c\220\024X\2660\223\244Qi\331\342\n\031\330\300\2647#f\2224\332aL\260,\314$i\212+\016sT\262HvF\373\t(\034"
+	.string	"\205\024L\230x\n\n\020\241"
+	.string	"\021DOA\001//\n@\341E;\n/\270-\262)8.\211l1\206\231$\rJ\213A\3628\203\262ekX\032\266\325"
+	.string	"\003\023,\215.\300 odT\330b\013"
+	.string	"\260Y\326,mf.0\301\306 [`[\243\262HcT\262$l\216J\326\306\305I\270,\2133G\031dR\205\231$M\n\r[\202\245Y\2270G\233dKl\2136\313\232\022\226\305V\231<q\201\2559\266z\351\302\f\355\261\304\261\205\211@\2734\322\260\260\305\032\266]\316"
+	.ascii	"\303\b\233eM\207v\311\336\234\200}a\006y\214A\2626,l\021\006"
+	.ascii	"\2665\266\313\"\214\211\314\215\004\220\307\265e\22722I\342\322"
+	.ascii	"(S\\1\266\306\030\315\026U\220\311\343R\311r\300"
+	.string	"fY\203\262\2341\322\254\020S\003\243G\300\340BL\r\f\361\245\346fi\002\030\226\004\314I\353$@\204X*\331\022GeL\007\236\264a\225!\332dR\031\"\245E\336$U8\201\262\005\023J\224eQ\205\003\25529B\003K#\2031\206\022D%{\2249\266H6\346\210\322\026\331\230\244\013(lL\262&\267\305\f\264\312\244\315\312\022\231<\2666I\023\2665\276\020sc\224A\263)8\302\240[\255T\2111\262,\264\305\022L\2409\032cP\262227\0220\321\252(\333\021.m\021\205\027\215bl\215\0230\241dQ\266#\330\022G\026\206}\201\306xT\262K\017\332b\n-\362xcb\002\030\243\f44F\025\330\032\243r\005\023\312\026\245\221\004Lv\243\210\004\234P\302\t2%\200h\361\004$@\005\0206\200\201\nh\030\0203I\232\020\310dMM\022&\004\362h\254\t\001\243\\\206"
+	.ascii	"\241\001\325\352d\332\367\025T\003g\025\241Uy\323\f5\001R\307"
+	.ascii	"T\366\265\n]9s\360x\255EO\034.\254>S\315\236dM'.\274\203\005"
+	.ascii	"\307\251+m\313M\337%Y\341i\345\036D\026\202QwY\353\214\024B\265"
+	.ascii	"\275\215\225\357\210J+\n\317\256\260\033\326\301g\264DC\017\317"
+	.ascii	"\261]eYa\261\2233&\241\332ZU\344B\016p\252?\260\261\312X\251"
+	.ascii	"V\031\353\324\211\210\034\321u\nWY-\365Ti\367U\n\013\351\241"
+	.ascii	"\034\260\242\0309\306J\224\024\313,j\332Rf\003\347p\205\302r"
+	.ascii	"ImzOyL#\201\013B\342T\265b\304oi\007\206T\312\036\031\335\331"
+	.ascii	"\213\247\026\256&\246\235\246\275\025\030y\205F\230p\225E\257"
+	.ascii	"\252Dm\351\3576M\223\212\244CV\344\234\306\202(\345\302\013d"
+	.ascii	"U\245\213b@\225\244\247\034=\027:\372I\214k,i\355)#\254Q\264"
+	.ascii	"\"\255GmG\324\232>\037]\2411.##\274\245\0245\246\3443\013_\211"
+	.ascii	"X\254E+\332\336\232\013\032\244n-\n:\263\352;Z\241\276\252X\241"
+	.ascii	"\253\320\252\266q\220\314(\232Z\203|\025r@\235\025zn\237\327"
+	.ascii	"\025>\227\335\332\256b\314\021\247f1\230X\366\352\343\353\317"
+	.ascii	"\352\223\241k\032\212\034S\311l\205Ow\340\\\237\353s\355\021"
+	.ascii	"q\367\016Z\223\213\352\n\224\220\214\235\365\204\257=+\317\021"
+	.ascii	"\0367=\036\024\231.\215'\257\311\220\207\220\034\232\003\274"
+	.ascii	"%KV\235\r< \013\317\306\212\343\253\316\232S\346\264\265\367"
+	.ascii	"yu\022\361\236\334\374l\254\315l\2702"
+	.string	"\255\252Ml+s\335vrCR\354\354`&\007=\374$\316\001\340S\215Jo\220\244H\221\\\330\201\350\340\240\026\006\002\204h\250cb\343\221dF\3129\005\235\242\221\021mS\350#\025@@PX$\033N8\233\017\023\300\024\212\203q\236J\221B%$I\222\324i7&\203.\223\276\334\030<\333\356%S\304\263\030\257a(\342u\356\222\246\f\343\263\231Q0\310.\"\253Z\034\353\t\301\266l\220\247}\215\211\030\255\271\b\314\342\f\274qK\270\2401\020\326\342Z\377\242\255\006\253b\327ZeL2\236Y\n\310\177\2263,\255UB\222=\341LD\270PUC\350%\204\271x\203\360<\246\"\026 \360'*/\3331rW\253\230@\211\224\267;\224\320b\325\353HFls{\3614L\230\224\251(a1\203\263j\342Lr\303}\0011%\303\336\326\200\327\032\002\212\0341d\327\221\366\356}\230\301\350"
+	.ascii	"\350Ip\265\304J\236\200\030\363X\302\340\256k\305i\312p\210W"
+	.ascii	"U\2422ao=\001\036\276\217\002\201\253\375o\bn)\336F/N1R\027\033"
+	.ascii	"b\277\006\025_\232\367\307\376n~\232\212\274wT\271m%b\202\026"
+	.ascii	"u\276\212\036(&\001$\243\277\230P\223\267\n\324\006\311\337\225"
+	.ascii	"\207\336\273\254\303\021\030M\234\204\035\211T\254E\242\316\340"
+	.ascii	"\210\324g\252\274\266\214\305\205\304'\225?+\002k{\216\346\275"
+	.ascii	"\253'\032\322<t\263\220\033\023_\264\034\243mvAW\262YB*\273\025"
+	.ascii	"\246+"
+	.string	"\337\345\2352\273!\245e\340\372\204\302\211E\214V\344\214*T\231\326\222\227\326b\221\245\222K\337X\206]\261\247\025\225R]'\207\342\177\224|e\211\330\366\242rl\326-[\t\242@&\222\334\016\233\201\313\262\304}\033\224\354\334\020!\255r\204\221\302\250\262\261\364\207\300\024\224@\201n\325-\352T\3351\357l\261\232\0044\270\033\340\030\357`\264y;\357\375\270\325\267\n\367\264\3369\344)\241\177\304}R\252\221>\210\243\313\273~\027\315o\374\273\2260\302i5\314\223\227\002\210\363\002Y\257\225\334\2405\371\030:E\247\0221\035\316\\\335_\2716\007K\355\035\374\020\216h'dP\325}\320.\025\235zH\245\030\255\245\235\036:;;\346N\205\244\366\022KQ\n\325\337\362\250\302\233\242\212\305\334\323&\034\024q4b\314\247\236\230\261\222I\303&\206\036\202\227\351\323\323\232x\302\f\364\353(\266\237\032Pr"
+	.string	"8\357\224+Z\305\354\223U\322\244+\214\256k\256\005=\363\244\233`k\002\271\"\270\214\f=\207\324\246\213}\304T\263\367\246hn\320W=\247\024\224\234\031:\2660\201.\306\277\372y\350\254\337\343Y\247'\024\007\270XjC\007o\030\373\0363|J)v\227\201\217u\230\212\335\254\247WD\223\016\263\005\027Q!\321\254X\241!\362%\352w\032\260\252\325j\231:~\246a\326\264{\275W\031&\212$\371\311w\277f\202\373"
+	.ascii	"\373b'k5\272\326\200\257\365\276MX4\231L\261\017Q\224\315/\034"
+	.ascii	"\370\257\362\262\023\203\330\213\321?B`0\375l\004\013\311\177"
+	.ascii	"\226H\236\242\210,\227&\246Yi\324s\252p\327n\342\231\202\b\307"
+	.ascii	"\2673\244<\r.\265:8\224K\017O\371\240\267eVi\326>\246f)\210\252"
+	.ascii	"\205L\032wR\177\204>\t\331\027\027\265\216+L+\312\026\0202\""
+	.ascii	"!\353\021\243\026t\3277\001\377\302n\274\324\202jj\254\340\033"
+	.ascii	"lA=\273}\t\365\252x\371\241+\022\277\224\271\"a\215\210\0019"
+	.ascii	"jv\002\346\037\034\f\210\246\2730\326\340VP\376\307s0\262\241"
+	.ascii	"\321\350\214\002w!\365b\206\346)\311\027}\373\327H\221\320\304"
+	.ascii	"y\002r\025\264\244\252\005\017\236\271u6"
+	.ascii	"s1,jD5\271\231\013?I\002^yL\005]\3026<\346\210\004\033e\201e"
+	.ascii	"\225\\O\030/L\3570,f\301;0g\211\257\034\335\034\253\326\256\273"
+	.ascii	"\304%'\2242\337\342\003\237\256\232W\206XM\3069\304T\330\312"
+	.ascii	"3\t\035OV\254\r\r\372q&i\206\203R6\254g\271\214G\205\204q\213"
+	.ascii	"\232}v\017\267\031);\\\245\003)U\275%O)\004\005vK\312f\034\325"
+	.ascii	"\221\004\373\313Y{\3754\234\277\364\237\0378\261\217\267\177"
+	.ascii	"\343\f\030-\261l0/&\030\376v\276\363\212\363\263A\231\336\375"
+	.ascii	"@4\217\rc\322\303%*\265&\261\215\346,\371\300u\224J\262\216\226"
+	.ascii	":\230\035\331D\263)t$&\255\223\321dN-\235C\025\373\325\204@\213"
+	.ascii	"4}\006\366\251\230\300\024<\241\261\251y\0252\016\260q\221\013"
+	.ascii	"\223\314\023\204+\215\315<\n\361r\355\354V\357\240\345\312\272"
+	.ascii	"\240QSe\360\310cH]\217\304^\352\304\203>?\302\004;\332\250;&"
+	.ascii	"\302\301\272HP\274\357w\206\245b\027\225=\220\200r\002\216\270"
+	.ascii	"\325>\252\321\"\243\360\303M\254\031s\0073\273eF\240A\344\345"
+	.ascii	"\025\034\322_\323> \252\362\312;\321\320q\004%z\253J\222\374"
+	.ascii	"\264"
+	.string	"+\022\243\255<}W\257\244\r\033\007\271\263S\276@\226J\261\001\256\001\\IP\227\2562\2120\326\317\324/L\220\310\365'\3721M\213G\323\037]\003\032ZY\016>c\237\250&\350w\366\265F\rI\030\252\0029f3\300}\364*\030\235:\200\360\302\177\222M\t6'\274j\305\324\205\200\002\t\256\f\025\321\364\353\337~ky\341\321\234\006\003\\\251\313\302\242q\242,7p\335\333F`\373l\344\275\257IF\212\f|h\332=\362\366\350J\333\306k\007<\002\223\005\343\341\371s\201\264\231\306>\260\003\\\322\350\262\033\020lt\361\331\224\265\271\226\2136\305\201Ud\224,\372w\332\027\364N\207G\366\211\271O\222\306\367\217\301\2322\216\256\036\334\3335\235\357\202'`\023.\275\002<\250\003\311\361\366v\0201e\376b\304I\311\320\t\365\200\254\343g\334\265\242\334\330\344\r\320n\274\037\311\362\253N\001\346\202"
+	.string	"\nD\256\200\203\374\215\246\2463\024P/\260d/w\366P\214&_\"\362+\204\301O,TN@\304\326\206#\247f\350\215\314\220T0.fw\360\372\216\214\225\t\244\r[\202\362E\213\007\353\274Q\300<\017\306\017\247\002\372\fOy\202\032\033\231\013:\345\272P\366xN\341\321X\322yH\261\267\2704z\267[\246H\253u\304\365Hx\370G\276\266\332\310)\250o!\276T+\324E\234\025\"+\203#\n\336\231\016\304$J\271\325\314\007\032?\344\274\t\343%\020\246\t\364R\220\233\330\242\253WK\202\266s\272\025b \351\347\216`\246b\336u\333\333\230;-B\2147V\264\203\004\005\001\256\366E\212\226M\245h\364"
+	.string	"l\274N$X\250\203\251\377\250"
+	.ascii	"/\237\302\342\205\310\003\222\346\216\211\366\343D&^\177\343"
+	.ascii	"7\f\030QI\233`\022\366/\003~\264D\374Kc\373\244.\374}V\270\346"
+	.ascii	"5\032\263\255\377\333S\001^\207b\r8\334\361\222]\244\327\b\366"
+	.ascii	"B\326\357bg\304\374gE7\030\366\340\304\324\030\255\356\226\276"
+	.ascii	"\006\221\004k\023L7\242\373z\271A\356}\331\007\206\365C\302\356"
+	.ascii	"g\240\230\274\227\327\220\003DC\260\334\215A\215\211\312Y\036"
+	.ascii	"\262\211\343\220V\255a\350\r\274j\346\233\243\346\270\r6\243"
+	.ascii	"\200Y\244\371\350\bL\017~\275\nK\020\260\\W|i\025\271\272jj\n"
+	.ascii	"\212\220\254\270\320a\243\030\030\346\274d,\232[\371\027\307"
+	.ascii	"v\351\206,)\307-\254\254\202\255h\204\234\245A\030Q,\262X\213"
+	.ascii	"\311\0203\373\235\374\247|D\247G:\017\n\034R\375^M?\355/ \371"
+	.ascii	"'\371#\345\330#.\265\332\232\207?\004~\332\2744w~\037iv\237="
+	.ascii	"\244\372\003z\036\347\376q$\262\371\312\375\343\017\337\305C"
+	.ascii	"\f\003q\027\277\356\264t\335\247\327~\257O\366\360\365[\357="
+	.ascii	"x\2628\032\314\3403\232\374o7\367\036\212\274G\3510\316/\302"
+	.ascii	"\007\214\t\f\271\361\231\370\342\217\224\374\222k\343\335\264"
+	.ascii	"&\336\321~\027\333[\0306\330}ys\352\263\334s6/,d\273\275c\370"
+	.ascii	"-\003\263\006\374;\274\325ov\3469\023yF\220\377\357K\264w8\r"
+	.ascii	"K\357T{S\372\210\216}@\255\337\237\267\315\257\345\003\316\230"
+	.ascii	"\223\245\2517O\356g\202\017\\\036\220\275\370\352-<\022\342\374"
+	.ascii	"u\214\231.\265[\321\366\336\2637\274^dO\324\016\374w\354\377"
+	.ascii	"\372\363\367\277\261\232\362\217\351\3649\341\304\340?\322\325"
+	.ascii	"\035`?\335"
+	.text
+	.section	.gnu.lto_.symtab.8e0d2acf571f86e5,"e",@progbits
+	.string	"logConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"_logf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"logInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"_logBufferHex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"logConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"logConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"shortGitRevision"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"buildTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"buildDate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"targetName"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"mspSerialPushPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"serialIsConnected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"mspSerialPortFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"determinePortSharing"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.8e0d2acf571f86e5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15608 @@
+	.file	"logic_condition.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/common/logic_condition.h"
+	.file 8 "./src/main/common/maths.h"
+	.file 9 "./src/main/fc/rc_controls.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/common/axis.h"
+	.file 12 "./src/main/common/filter.h"
+	.file 13 "./src/main/flight/failsafe.h"
+	.file 14 "./src/main/io/gps.h"
+	.file 15 "./src/main/navigation/navigation.h"
+	.file 16 "./src/main/common/calibration.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/drivers/io_types.h"
+	.file 19 "./src/main/drivers/bus.h"
+	.file 20 "./src/main/drivers/pitotmeter.h"
+	.file 21 "./src/main/sensors/pitotmeter.h"
+	.file 22 "./src/main/flight/imu.h"
+	.file 23 "./src/main/flight/pid.h"
+	.file 24 "./src/main/navigation/navigation_private.h"
+	.file 25 "./src/main/common/logic_condition.c"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 27 "./src/main/sensors/battery.h"
+	.file 28 "./src/main/rx/rx.h"
+	.file 29 "./src/main/fc/fc_core.h"
+	.file 30 "./src/main/common/global_variables.h"
+	.file 31 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	logic_condition.c.8b55b8ff
+	.weak	logic_condition.c.8b55b8ff
+logic_condition.c.8b55b8ff:
+	.long	0x1624
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF2166
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.long	.LASF1646
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1641
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1642
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x15
+	.long	0x3c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1643
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1644
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1645
+	.uleb128 0x3
+	.long	.LASF1647
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x69
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1648
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4f
+	.uleb128 0x3
+	.long	.LASF1650
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x88
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1651
+	.uleb128 0x3
+	.long	.LASF1652
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x3
+	.long	.LASF1653
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x3c
+	.uleb128 0x3
+	.long	.LASF1654
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x56
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1655
+	.uleb128 0x3
+	.long	.LASF1656
+	.byte	0x2
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1657
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1658
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1659
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0x9b
+	.uleb128 0x3
+	.long	.LASF1660
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1661
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa7
+	.uleb128 0x3
+	.long	.LASF1663
+	.byte	0x4
+	.byte	0x1b
+	.byte	0x14
+	.long	0xba
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xf8
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x5
+	.byte	0x21
+	.long	0x156
+	.uleb128 0x4
+	.long	.LASF1665
+	.value	0xfff
+	.uleb128 0x4
+	.long	.LASF1666
+	.value	0xf000
+	.uleb128 0x4
+	.long	.LASF1667
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1669
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1670
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x162
+	.uleb128 0x1a
+	.long	0x16d
+	.uleb128 0x7
+	.long	0xc6
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x18e
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x33
+	.byte	0xf
+	.long	0xc6
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x18e
+	.byte	0
+	.uleb128 0x9
+	.long	0x156
+	.uleb128 0xa
+	.long	.LASF1678
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x1ee
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xb
+	.long	0x11c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1671
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0xf8
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1672
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ee
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1673
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x1ee
+	.byte	0x10
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xf
+	.long	0x1f3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1674
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x16d
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0xec
+	.uleb128 0x9
+	.long	0x1ee
+	.uleb128 0x3
+	.long	.LASF1675
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x193
+	.uleb128 0x15
+	.long	0x1f8
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0x104
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x110
+	.uleb128 0xa
+	.long	.LASF1679
+	.byte	0xa
+	.byte	0x6
+	.byte	0x49
+	.long	0x289
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xe
+	.long	0xf8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xd
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x8
+	.string	"day"
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xd
+	.long	0xec
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x6
+	.byte	0x51
+	.byte	0xd
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0x6
+	.byte	0x53
+	.byte	0xd
+	.long	0xec
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1684
+	.byte	0x6
+	.byte	0x55
+	.byte	0xd
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0x6
+	.byte	0x57
+	.byte	0xe
+	.long	0xf8
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0x6
+	.byte	0x58
+	.byte	0x3
+	.long	0x221
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x7
+	.byte	0x1f
+	.long	0x325
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0x7
+	.byte	0x36
+	.byte	0x3
+	.long	0x295
+	.uleb128 0x1c
+	.long	.LASF1781
+	.long	0x56
+	.byte	0x7
+	.byte	0x38
+	.long	0x36b
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0x7
+	.byte	0x40
+	.byte	0x3
+	.long	0x331
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x7
+	.byte	0x42
+	.long	0x431
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x7
+	.byte	0x62
+	.long	0x473
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x7
+	.byte	0x6e
+	.long	0x485
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1757
+	.byte	0x8
+	.byte	0x7
+	.byte	0x72
+	.long	0x4ac
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0x7
+	.byte	0x73
+	.byte	0x18
+	.long	0x36b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x7
+	.byte	0x74
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0x7
+	.byte	0x75
+	.byte	0x3
+	.long	0x485
+	.uleb128 0xa
+	.long	.LASF1761
+	.byte	0x1c
+	.byte	0x7
+	.byte	0x77
+	.long	0x513
+	.uleb128 0x2
+	.long	.LASF1762
+	.byte	0x7
+	.byte	0x78
+	.byte	0xd
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1763
+	.byte	0x7
+	.byte	0x79
+	.byte	0xc
+	.long	0xc8
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1764
+	.byte	0x7
+	.byte	0x7a
+	.byte	0x16
+	.long	0x325
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1765
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x14
+	.long	0x4ac
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1766
+	.byte	0x7
+	.byte	0x7c
+	.byte	0x14
+	.long	0x4ac
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0x7
+	.byte	0x7d
+	.byte	0xd
+	.long	0xec
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x7
+	.byte	0x7e
+	.byte	0x3
+	.long	0x4b8
+	.uleb128 0x15
+	.long	0x513
+	.uleb128 0x10
+	.long	0x513
+	.long	0x534
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1769
+	.byte	0x7
+	.byte	0x80
+	.byte	0x19
+	.long	0x524
+	.uleb128 0xc
+	.long	.LASF1770
+	.byte	0x7
+	.byte	0x80
+	.byte	0x52
+	.long	0x524
+	.uleb128 0xa
+	.long	.LASF1771
+	.byte	0x8
+	.byte	0x7
+	.byte	0x82
+	.long	0x573
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x7
+	.byte	0x83
+	.byte	0x9
+	.long	0x3c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0x7
+	.byte	0x84
+	.byte	0xd
+	.long	0xec
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1772
+	.byte	0x7
+	.byte	0x85
+	.byte	0x3
+	.long	0x54c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1773
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1774
+	.uleb128 0xa
+	.long	.LASF1775
+	.byte	0x14
+	.byte	0x8
+	.byte	0x67
+	.long	0x5db
+	.uleb128 0x2
+	.long	.LASF1776
+	.byte	0x8
+	.byte	0x69
+	.byte	0xb
+	.long	0x586
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1777
+	.byte	0x8
+	.byte	0x69
+	.byte	0x13
+	.long	0x586
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0x8
+	.byte	0x69
+	.byte	0x1b
+	.long	0x586
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x8
+	.byte	0x69
+	.byte	0x23
+	.long	0x586
+	.byte	0xc
+	.uleb128 0x8
+	.string	"m_n"
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x9
+	.long	0x3c
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1780
+	.byte	0x8
+	.byte	0x6b
+	.byte	0x3
+	.long	0x58d
+	.uleb128 0x1c
+	.long	.LASF1782
+	.long	0x56
+	.byte	0x9
+	.byte	0x18
+	.long	0x657
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0x1
+	.uleb128 0x17
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0xf
+	.byte	0
+	.uleb128 0x10
+	.long	0xd4
+	.long	0x667
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1798
+	.byte	0x9
+	.byte	0x51
+	.byte	0x10
+	.long	0x657
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xa
+	.byte	0x15
+	.long	0x73e
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1802
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1803
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1804
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1805
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1806
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1807
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1808
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1809
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1810
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1811
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1812
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1813
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1814
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1815
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1816
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1817
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1818
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1819
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1820
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1821
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1822
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1823
+	.byte	0xa
+	.byte	0x47
+	.byte	0x11
+	.long	0x104
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xa
+	.byte	0x54
+	.long	0x7b7
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1832
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1833
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1834
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1835
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1836
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1837
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1838
+	.value	0x4000
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1839
+	.byte	0xa
+	.byte	0x66
+	.byte	0x11
+	.long	0x104
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xa
+	.byte	0x6c
+	.long	0x888
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1848
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1849
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1850
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1851
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1852
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1853
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1854
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1855
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1856
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1857
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1858
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1859
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1860
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1861
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1862
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1863
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1864
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xb
+	.byte	0x14
+	.long	0x8a0
+	.uleb128 0x17
+	.string	"X"
+	.byte	0
+	.uleb128 0x17
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x17
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1865
+	.byte	0xc
+	.byte	0xc
+	.byte	0x1a
+	.long	0x8d2
+	.uleb128 0x2
+	.long	.LASF1866
+	.byte	0xc
+	.byte	0x1b
+	.byte	0xb
+	.long	0x586
+	.byte	0
+	.uleb128 0x8
+	.string	"RC"
+	.byte	0xc
+	.byte	0x1c
+	.byte	0xb
+	.long	0x586
+	.byte	0x4
+	.uleb128 0x8
+	.string	"dT"
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xb
+	.long	0x586
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1867
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x3
+	.long	0x8a0
+	.uleb128 0x9
+	.long	0x586
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1868
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xd
+	.byte	0x33
+	.long	0x926
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1877
+	.byte	0xd
+	.byte	0x70
+	.byte	0x3
+	.long	0x8ea
+	.uleb128 0x6
+	.long	0x56
+	.byte	0xe
+	.byte	0x50
+	.long	0x950
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1881
+	.byte	0xe
+	.byte	0x54
+	.byte	0x3
+	.long	0x932
+	.uleb128 0xa
+	.long	.LASF1882
+	.byte	0xc
+	.byte	0xe
+	.byte	0x6a
+	.long	0x990
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0xe
+	.byte	0x6b
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0xe
+	.byte	0x6c
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0xe
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1883
+	.byte	0xe
+	.byte	0x6e
+	.byte	0x3
+	.long	0x95c
+	.uleb128 0x11
+	.byte	0x7
+	.byte	0xe
+	.byte	0x73
+	.byte	0x5
+	.long	0xa01
+	.uleb128 0x2
+	.long	.LASF1884
+	.byte	0xe
+	.byte	0x74
+	.byte	0xd
+	.long	0x57f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0xe
+	.byte	0x75
+	.byte	0xd
+	.long	0x57f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0xe
+	.byte	0x76
+	.byte	0xd
+	.long	0x57f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0xe
+	.byte	0x77
+	.byte	0xd
+	.long	0x57f
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0xe
+	.byte	0x78
+	.byte	0xd
+	.long	0x57f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1889
+	.byte	0xe
+	.byte	0x79
+	.byte	0xd
+	.long	0x57f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1890
+	.byte	0xe
+	.byte	0x7a
+	.byte	0xd
+	.long	0x57f
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1891
+	.byte	0x3c
+	.byte	0xe
+	.byte	0x72
+	.long	0xaaa
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0xe
+	.byte	0x7b
+	.byte	0x7
+	.long	0x99c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0xe
+	.byte	0x7d
+	.byte	0x12
+	.long	0x950
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0xe
+	.byte	0x7e
+	.byte	0xd
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0xe
+	.byte	0x80
+	.byte	0x13
+	.long	0x990
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0xe
+	.byte	0x81
+	.byte	0xd
+	.long	0xaaa
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1895
+	.byte	0xe
+	.byte	0x82
+	.byte	0xd
+	.long	0xaaa
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0xe
+	.byte	0x84
+	.byte	0xd
+	.long	0xd4
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0xe
+	.byte	0x85
+	.byte	0xd
+	.long	0xd4
+	.byte	0x2a
+	.uleb128 0x8
+	.string	"eph"
+	.byte	0xe
+	.byte	0x87
+	.byte	0xe
+	.long	0xf8
+	.byte	0x2c
+	.uleb128 0x8
+	.string	"epv"
+	.byte	0xe
+	.byte	0x88
+	.byte	0xe
+	.long	0xf8
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0xe
+	.byte	0x8a
+	.byte	0xe
+	.long	0xf8
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0xe
+	.byte	0x8c
+	.byte	0x10
+	.long	0x289
+	.byte	0x32
+	.byte	0
+	.uleb128 0x10
+	.long	0xd4
+	.long	0xaba
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1900
+	.byte	0xe
+	.byte	0x8e
+	.byte	0x3
+	.long	0xa01
+	.uleb128 0xc
+	.long	.LASF1901
+	.byte	0xe
+	.byte	0x97
+	.byte	0x1a
+	.long	0xaba
+	.uleb128 0xc
+	.long	.LASF1902
+	.byte	0xf
+	.byte	0x23
+	.byte	0x11
+	.long	0x104
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x10
+	.byte	0x23
+	.long	0xb02
+	.uleb128 0x1
+	.long	.LASF1903
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1904
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1905
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1906
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1907
+	.byte	0x10
+	.byte	0x28
+	.byte	0x3
+	.long	0xade
+	.uleb128 0x11
+	.byte	0x18
+	.byte	0x10
+	.byte	0x2a
+	.byte	0x9
+	.long	0xb66
+	.uleb128 0x2
+	.long	.LASF1866
+	.byte	0x10
+	.byte	0x2b
+	.byte	0x1c
+	.long	0xb02
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x10
+	.byte	0x2c
+	.byte	0xe
+	.long	0x209
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x10
+	.byte	0x2d
+	.byte	0xe
+	.long	0x209
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x10
+	.byte	0x2e
+	.byte	0x1c
+	.long	0x57f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x10
+	.byte	0x2f
+	.byte	0xe
+	.long	0x56
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x10
+	.byte	0x30
+	.byte	0xb
+	.long	0x586
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1913
+	.byte	0x10
+	.byte	0x31
+	.byte	0x3
+	.long	0xb0e
+	.uleb128 0x11
+	.byte	0x18
+	.byte	0x10
+	.byte	0x33
+	.byte	0x9
+	.long	0xb96
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x10
+	.byte	0x34
+	.byte	0xb
+	.long	0x586
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0x10
+	.byte	0x35
+	.byte	0xd
+	.long	0x5db
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1916
+	.byte	0x10
+	.byte	0x36
+	.byte	0x3
+	.long	0xb72
+	.uleb128 0x11
+	.byte	0x30
+	.byte	0x10
+	.byte	0x38
+	.byte	0x9
+	.long	0xbc6
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x10
+	.byte	0x39
+	.byte	0x1d
+	.long	0xb66
+	.byte	0
+	.uleb128 0x8
+	.string	"val"
+	.byte	0x10
+	.byte	0x3a
+	.byte	0x1c
+	.long	0xb96
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1918
+	.byte	0x10
+	.byte	0x3b
+	.byte	0x3
+	.long	0xba2
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x11
+	.byte	0x16
+	.long	0xcc2
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x11
+	.byte	0x43
+	.long	0xd4c
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1978
+	.byte	0x12
+	.byte	0x7
+	.byte	0x11
+	.long	0xec
+	.uleb128 0x3
+	.long	.LASF1979
+	.byte	0x12
+	.byte	0x8
+	.byte	0xf
+	.long	0xc6
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x13
+	.byte	0x3a
+	.long	0xd8e
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1985
+	.byte	0x13
+	.byte	0x40
+	.byte	0x3
+	.long	0xd64
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x13
+	.byte	0x4b
+	.long	0xed2
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2036
+	.byte	0x13
+	.byte	0x94
+	.byte	0x3
+	.long	0xd9a
+	.uleb128 0x1d
+	.byte	0xa6
+	.uleb128 0xa
+	.long	.LASF2037
+	.byte	0x18
+	.byte	0x13
+	.byte	0x9f
+	.long	0xf55
+	.uleb128 0x2
+	.long	.LASF2038
+	.byte	0x13
+	.byte	0xa0
+	.byte	0xc
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2039
+	.byte	0x13
+	.byte	0xa1
+	.byte	0xf
+	.long	0xd8e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2040
+	.byte	0x13
+	.byte	0xa2
+	.byte	0x17
+	.long	0xed2
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0x13
+	.byte	0xa3
+	.byte	0xd
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x8
+	.string	"tag"
+	.byte	0x13
+	.byte	0xa4
+	.byte	0xd
+	.long	0xec
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0x13
+	.byte	0xa5
+	.byte	0xd
+	.long	0xec
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2042
+	.byte	0x13
+	.byte	0xb3
+	.byte	0x7
+	.long	0xede
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2043
+	.byte	0x13
+	.byte	0xb4
+	.byte	0xd
+	.long	0xd4c
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2044
+	.byte	0x13
+	.byte	0xb5
+	.byte	0x3
+	.long	0xee0
+	.uleb128 0x15
+	.long	0xf55
+	.uleb128 0x1d
+	.byte	0xbc
+	.uleb128 0xa
+	.long	.LASF2045
+	.byte	0x28
+	.byte	0x13
+	.byte	0xb7
+	.long	0xfd0
+	.uleb128 0x2
+	.long	.LASF2046
+	.byte	0x13
+	.byte	0xb8
+	.byte	0x23
+	.long	0xfd0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2039
+	.byte	0x13
+	.byte	0xb9
+	.byte	0xf
+	.long	0xd8e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1767
+	.byte	0x13
+	.byte	0xba
+	.byte	0xe
+	.long	0x104
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0x13
+	.byte	0xbb
+	.byte	0xe
+	.long	0x104
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2042
+	.byte	0x13
+	.byte	0xc9
+	.byte	0x7
+	.long	0xf66
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2043
+	.byte	0x13
+	.byte	0xca
+	.byte	0xa
+	.long	0xd58
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2047
+	.byte	0x13
+	.byte	0xcb
+	.byte	0x10
+	.long	0xfd5
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0xf61
+	.uleb128 0x9
+	.long	0x104
+	.uleb128 0x3
+	.long	.LASF2048
+	.byte	0x13
+	.byte	0xce
+	.byte	0x3
+	.long	0xf68
+	.uleb128 0x3
+	.long	.LASF2049
+	.byte	0x14
+	.byte	0x17
+	.byte	0xf
+	.long	0xff2
+	.uleb128 0x9
+	.long	0xff7
+	.uleb128 0x28
+	.long	0x57f
+	.long	0x1006
+	.uleb128 0x7
+	.long	0x1006
+	.byte	0
+	.uleb128 0x9
+	.long	0x100b
+	.uleb128 0xa
+	.long	.LASF2050
+	.byte	0x28
+	.byte	0x14
+	.byte	0x1a
+	.long	0x1059
+	.uleb128 0x2
+	.long	.LASF2051
+	.byte	0x14
+	.byte	0x1b
+	.byte	0x13
+	.long	0x107f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2052
+	.byte	0x14
+	.byte	0x1c
+	.byte	0xe
+	.long	0xf8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2053
+	.byte	0x14
+	.byte	0x1d
+	.byte	0x14
+	.long	0xfe6
+	.byte	0x10
+	.uleb128 0x8
+	.string	"get"
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x14
+	.long	0xfe6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0x14
+	.byte	0x1f
+	.byte	0x1b
+	.long	0x1059
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2055
+	.byte	0x14
+	.byte	0x18
+	.byte	0x10
+	.long	0x1065
+	.uleb128 0x9
+	.long	0x106a
+	.uleb128 0x1a
+	.long	0x107f
+	.uleb128 0x7
+	.long	0x1006
+	.uleb128 0x7
+	.long	0x8de
+	.uleb128 0x7
+	.long	0x8de
+	.byte	0
+	.uleb128 0x9
+	.long	0xfda
+	.uleb128 0x3
+	.long	.LASF2056
+	.byte	0x14
+	.byte	0x20
+	.byte	0x3
+	.long	0x100b
+	.uleb128 0xa
+	.long	.LASF2057
+	.byte	0x80
+	.byte	0x15
+	.byte	0x2e
+	.long	0x1105
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x15
+	.byte	0x2f
+	.byte	0x10
+	.long	0x1084
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0x15
+	.byte	0x30
+	.byte	0xb
+	.long	0x586
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2059
+	.byte	0x15
+	.byte	0x32
+	.byte	0x1d
+	.long	0xbc6
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x15
+	.byte	0x33
+	.byte	0x11
+	.long	0x8d2
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x15
+	.byte	0x34
+	.byte	0xe
+	.long	0x215
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0x15
+	.byte	0x35
+	.byte	0xe
+	.long	0x209
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2063
+	.byte	0x15
+	.byte	0x37
+	.byte	0xb
+	.long	0x586
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2064
+	.byte	0x15
+	.byte	0x38
+	.byte	0xb
+	.long	0x586
+	.byte	0x78
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2065
+	.byte	0x15
+	.byte	0x39
+	.byte	0x3
+	.long	0x1090
+	.uleb128 0xc
+	.long	.LASF2066
+	.byte	0x15
+	.byte	0x40
+	.byte	0x10
+	.long	0x1105
+	.uleb128 0x11
+	.byte	0x6
+	.byte	0x16
+	.byte	0x20
+	.byte	0x5
+	.long	0x114e
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x16
+	.byte	0x22
+	.byte	0x11
+	.long	0xd4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x16
+	.byte	0x23
+	.byte	0x11
+	.long	0xd4
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0x16
+	.byte	0x24
+	.byte	0x11
+	.long	0xd4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x6
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x9
+	.long	0x1170
+	.uleb128 0x18
+	.string	"raw"
+	.byte	0x16
+	.byte	0x1f
+	.byte	0xd
+	.long	0xaaa
+	.uleb128 0x29
+	.long	.LASF2069
+	.byte	0x16
+	.byte	0x25
+	.byte	0x7
+	.long	0x111d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2070
+	.byte	0x16
+	.byte	0x26
+	.byte	0x3
+	.long	0x114e
+	.uleb128 0xc
+	.long	.LASF2071
+	.byte	0x16
+	.byte	0x29
+	.byte	0x1e
+	.long	0x1170
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x17
+	.byte	0x39
+	.long	0x11dc
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0xb
+	.byte	0
+	.uleb128 0x10
+	.long	0xd4
+	.long	0x11e7
+	.uleb128 0x2a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2084
+	.byte	0x17
+	.byte	0xa6
+	.byte	0x10
+	.long	0x11dc
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x18
+	.byte	0x7a
+	.long	0x1289
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x12
+	.byte	0
+	.uleb128 0x6
+	.long	0x56
+	.byte	0x18
+	.byte	0xfc
+	.long	0x12fd
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2116
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF2117
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF2118
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF2119
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF2120
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF2121
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF2122
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF2123
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2124
+	.byte	0x18
+	.value	0x116
+	.byte	0x3
+	.long	0x1289
+	.uleb128 0x1e
+	.long	0x534
+	.byte	0x4d
+	.uleb128 0x1e
+	.long	0x540
+	.byte	0x7f
+	.uleb128 0xc
+	.long	.LASF2125
+	.byte	0x19
+	.byte	0x30
+	.byte	0xb8
+	.long	0x204
+	.uleb128 0x2c
+	.long	0x1316
+	.byte	0xe5
+	.uleb128 0x10
+	.long	0x573
+	.long	0x1338
+	.uleb128 0x16
+	.long	0x2e
+	.byte	0xf
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2167
+	.byte	0x19
+	.byte	0x46
+	.byte	0x17
+	.long	0x1328
+	.uleb128 0xd
+	.long	.LASF2126
+	.byte	0xd
+	.byte	0x9e
+	.byte	0x11
+	.long	0x926
+	.uleb128 0x1f
+	.long	.LASF2127
+	.byte	0x18
+	.value	0x187
+	.byte	0x1b
+	.long	0x12fd
+	.uleb128 0x20
+	.long	.LASF2128
+	.value	0x1ae
+	.long	0x586
+	.long	0x1372
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2129
+	.byte	0x1a
+	.byte	0x8f
+	.byte	0xe
+	.long	0x586
+	.long	0x1388
+	.uleb128 0x7
+	.long	0x586
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2130
+	.value	0x1ad
+	.long	0x586
+	.long	0x139d
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2131
+	.byte	0x1b
+	.byte	0x97
+	.byte	0x9
+	.long	0xe0
+	.uleb128 0xd
+	.long	.LASF2132
+	.byte	0x1b
+	.byte	0x95
+	.byte	0x9
+	.long	0xd4
+	.uleb128 0xd
+	.long	.LASF2133
+	.byte	0x1b
+	.byte	0x8f
+	.byte	0xa
+	.long	0xf8
+	.uleb128 0xd
+	.long	.LASF2134
+	.byte	0x1b
+	.byte	0x89
+	.byte	0xa
+	.long	0xf8
+	.uleb128 0xd
+	.long	.LASF2135
+	.byte	0x1c
+	.byte	0xc4
+	.byte	0xa
+	.long	0xf8
+	.uleb128 0x1f
+	.long	.LASF2136
+	.byte	0xf
+	.value	0x1af
+	.byte	0xa
+	.long	0x104
+	.uleb128 0xd
+	.long	.LASF2137
+	.byte	0x1d
+	.byte	0x2e
+	.byte	0x7
+	.long	0x586
+	.uleb128 0x12
+	.long	.LASF2138
+	.byte	0x1c
+	.byte	0xd2
+	.byte	0x9
+	.long	0xd4
+	.long	0x1408
+	.uleb128 0x7
+	.long	0x56
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2139
+	.byte	0x8
+	.byte	0x87
+	.byte	0x5
+	.long	0x3c
+	.long	0x1428
+	.uleb128 0x7
+	.long	0x3c
+	.uleb128 0x7
+	.long	0x3c
+	.uleb128 0x7
+	.long	0x3c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2140
+	.byte	0x1e
+	.byte	0x26
+	.byte	0x9
+	.long	0xe0
+	.long	0x143e
+	.uleb128 0x7
+	.long	0xec
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2144
+	.byte	0x1e
+	.byte	0x27
+	.byte	0x6
+	.long	0x1455
+	.uleb128 0x7
+	.long	0xec
+	.uleb128 0x7
+	.long	0xe0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2141
+	.byte	0x1f
+	.byte	0x2b
+	.byte	0xe
+	.long	0xc6
+	.long	0x1475
+	.uleb128 0x7
+	.long	0xc6
+	.uleb128 0x7
+	.long	0x1475
+	.uleb128 0x7
+	.long	0x22
+	.byte	0
+	.uleb128 0x9
+	.long	0x147a
+	.uleb128 0x2f
+	.uleb128 0x21
+	.long	.LASF2142
+	.value	0x1cd
+	.long	0x1492
+	.uleb128 0x13
+	.uleb128 0x22
+	.string	"i"
+	.value	0x1ce
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2143
+	.value	0x1c6
+	.long	0x14b5
+	.uleb128 0x14
+	.long	.LASF2146
+	.value	0x1c6
+	.byte	0x28
+	.long	0x215
+	.uleb128 0x13
+	.uleb128 0x22
+	.string	"i"
+	.value	0x1c8
+	.long	0xec
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2145
+	.value	0x1be
+	.long	0x3c
+	.long	0x14d1
+	.uleb128 0x14
+	.long	.LASF2147
+	.value	0x1be
+	.byte	0x23
+	.long	0xc8
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2148
+	.value	0x190
+	.long	0x3c
+	.long	0x1506
+	.uleb128 0x14
+	.long	.LASF1758
+	.value	0x190
+	.byte	0x36
+	.long	0x36b
+	.uleb128 0x14
+	.long	.LASF2149
+	.value	0x190
+	.byte	0x40
+	.long	0x3c
+	.uleb128 0x30
+	.long	.LASF2150
+	.byte	0x19
+	.value	0x191
+	.byte	0x9
+	.long	0x3c
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2151
+	.byte	0x19
+	.value	0x162
+	.byte	0xc
+	.long	0x3c
+	.long	0x1524
+	.uleb128 0x14
+	.long	.LASF2149
+	.value	0x162
+	.byte	0x38
+	.long	0x3c
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2152
+	.byte	0x19
+	.byte	0xe0
+	.byte	0xc
+	.long	0x3c
+	.long	0x1541
+	.uleb128 0xe
+	.long	.LASF2149
+	.byte	0x19
+	.byte	0xe0
+	.byte	0x34
+	.long	0x3c
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2153
+	.byte	0xbe
+	.long	0x1584
+	.uleb128 0x32
+	.string	"i"
+	.byte	0x19
+	.byte	0xbe
+	.byte	0x24
+	.long	0xec
+	.uleb128 0xf
+	.long	.LASF2154
+	.byte	0xc0
+	.byte	0xf
+	.long	0x43
+	.uleb128 0x13
+	.uleb128 0xf
+	.long	.LASF2155
+	.byte	0xc9
+	.byte	0x17
+	.long	0x43
+	.uleb128 0xf
+	.long	.LASF2156
+	.byte	0xca
+	.byte	0x17
+	.long	0x43
+	.uleb128 0xf
+	.long	.LASF2157
+	.byte	0xcb
+	.byte	0x17
+	.long	0x43
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2158
+	.byte	0x19
+	.byte	0x48
+	.byte	0xc
+	.long	0x3c
+	.long	0x15d0
+	.uleb128 0xe
+	.long	.LASF2159
+	.byte	0x19
+	.byte	0x49
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0xe
+	.long	.LASF1764
+	.byte	0x19
+	.byte	0x4a
+	.byte	0x16
+	.long	0x325
+	.uleb128 0xe
+	.long	.LASF1765
+	.byte	0x19
+	.byte	0x4b
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0xe
+	.long	.LASF1766
+	.byte	0x19
+	.byte	0x4c
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0xf
+	.long	.LASF2160
+	.byte	0x4e
+	.byte	0x9
+	.long	0x3c
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2161
+	.byte	0x32
+	.long	0x1600
+	.uleb128 0xe
+	.long	.LASF2162
+	.byte	0x19
+	.byte	0x32
+	.byte	0x32
+	.long	0x1600
+	.uleb128 0x13
+	.uleb128 0x33
+	.string	"i"
+	.byte	0x19
+	.byte	0x34
+	.byte	0xe
+	.long	0x3c
+	.uleb128 0x13
+	.uleb128 0xf
+	.long	.LASF2163
+	.byte	0x35
+	.byte	0x27
+	.long	0x51f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x513
+	.uleb128 0x19
+	.long	.LASF2164
+	.byte	0x7
+	.byte	0x80
+	.byte	0x97
+	.long	0x1622
+	.long	0x1622
+	.uleb128 0xe
+	.long	.LASF2165
+	.byte	0x7
+	.byte	0x80
+	.byte	0xab
+	.long	0x3c
+	.byte	0
+	.uleb128 0x9
+	.long	0x51f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 48
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 25
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 32 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 34 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 36 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 37 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 40 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 42 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2a
+	.file 43 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF592
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF593
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.file 47 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.file 48 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF601
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF661
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF665
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF666
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF729
+	.byte	0x4
+	.file 52 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 53 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.file 54 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.file 55 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 56 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 57 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1039
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1040
+	.byte	0x4
+	.file 59 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1133
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.byte	0x4
+	.file 60 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.file 61 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3e
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1427
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1454
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 70 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1b
+	.file 71 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1573
+	.byte	0x4
+	.file 72 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1574
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 73 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1589
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x16
+	.file 76 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.23.96c4afc0737b13234a3b55c02753565a,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF616
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF658
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF740
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF832
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF938
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF939
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF590
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF958
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF986
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF987
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF988
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF989
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF990
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF991
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF992
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF993
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF994
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF995
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF996
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF997
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF998
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF999
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1000
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1001
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1002
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1003
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1004
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1022
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1132
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1147
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1426
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1473
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1473
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1483
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1486
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1477
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1496
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1497
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1498
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1505
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1506
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1507
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1508
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1509
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1555
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1610
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation_private.h.20.f031f155a7b4a02932e4cd7327b35035,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1640
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2168
+	.long	.LASF2169
+	.long	.LASF2170
+	.long	.LASF2171
+	.long	.LASF2172
+	.long	.LASF2173
+	.long	.LASF2174
+	.long	.LASF2175
+	.long	.LASF2176
+	.long	.LASF2177
+	.long	.LASF2178
+	.long	.LASF2179
+	.long	.LASF2180
+	.long	.LASF2181
+	.long	.LASF2182
+	.long	.LASF2183
+	.long	.LASF2184
+	.long	.LASF2185
+	.long	.LASF2186
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2187
+	.byte	0x13
+	.long	.LASF2188
+	.byte	0xf
+	.long	.LASF2189
+	.byte	0xf
+	.long	.LASF2190
+	.byte	0xf
+	.long	.LASF2191
+	.byte	0x3
+	.long	.LASF2192
+	.byte	0x2
+	.long	.LASF2193
+	.byte	0x2
+	.long	.LASF2194
+	.byte	0x2
+	.long	.LASF2195
+	.byte	0x5
+	.long	.LASF2196
+	.byte	0x5
+	.long	.LASF2197
+	.byte	0x2
+	.long	.LASF2198
+	.byte	0x2
+	.long	.LASF2199
+	.byte	0x6
+	.long	.LASF2200
+	.byte	0x7
+	.long	.LASF2201
+	.byte	0x8
+	.long	.LASF2202
+	.byte	0x2
+	.long	.LASF2203
+	.byte	0x4
+	.long	.LASF2204
+	.byte	0x4
+	.long	.LASF2205
+	.byte	0x4
+	.long	.LASF2206
+	.byte	0x4
+	.long	.LASF2206
+	.byte	0xa
+	.long	.LASF2207
+	.byte	0x6
+	.long	.LASF2208
+	.byte	0x6
+	.long	.LASF2209
+	.byte	0x8
+	.long	.LASF2210
+	.byte	0x2
+	.long	.LASF2211
+	.byte	0xf
+	.long	.LASF2212
+	.byte	0xa
+	.long	.LASF2213
+	.byte	0x9
+	.long	.LASF2214
+	.byte	0x5
+	.long	.LASF2215
+	.byte	0x2
+	.long	.LASF2216
+	.byte	0x12
+	.long	.LASF2217
+	.byte	0x12
+	.long	.LASF2218
+	.byte	0x13
+	.long	.LASF2219
+	.byte	0x3
+	.long	.LASF2220
+	.byte	0xf
+	.long	.LASF2221
+	.byte	0x12
+	.long	.LASF2222
+	.byte	0x12
+	.long	.LASF2223
+	.byte	0xf
+	.long	.LASF2224
+	.byte	0xf
+	.long	.LASF2225
+	.byte	0x11
+	.long	.LASF2226
+	.byte	0xf
+	.long	.LASF2227
+	.byte	0x10
+	.long	.LASF2228
+	.byte	0x10
+	.long	.LASF2229
+	.byte	0xe
+	.long	.LASF2230
+	.byte	0xe
+	.long	.LASF2231
+	.byte	0x12
+	.long	.LASF2232
+	.byte	0x13
+	.long	.LASF2232
+	.byte	0x12
+	.long	.LASF2233
+	.byte	0xf
+	.long	.LASF2234
+	.byte	0xf
+	.long	.LASF2235
+	.byte	0xf
+	.long	.LASF2236
+	.byte	0x1
+	.long	.LASF2237
+	.byte	0x3
+	.long	.LASF2238
+	.byte	0xd
+	.long	.LASF2239
+	.byte	0xc
+	.long	.LASF2240
+	.byte	0xb
+	.long	.LASF2241
+	.byte	0xc
+	.long	.LASF2242
+	.byte	0xc
+	.long	.LASF2243
+	.byte	0x2
+	.long	.LASF2244
+	.byte	0x2
+	.long	.LASF2245
+	.byte	0x12
+	.long	.LASF2246
+	.byte	0xf
+	.long	.LASF2247
+	.byte	0xf
+	.long	.LASF2248
+	.byte	0xf
+	.long	.LASF2249
+	.byte	0xf
+	.long	.LASF2250
+	.byte	0xf
+	.long	.LASF2251
+	.byte	0xf
+	.long	.LASF2252
+	.byte	0xf
+	.long	.LASF2253
+	.byte	0xf
+	.long	.LASF2254
+	.byte	0x3
+	.long	.LASF2192
+	.byte	0x4
+	.long	.LASF2255
+	.byte	0x4
+	.long	.LASF2256
+	.byte	0x4
+	.long	.LASF2257
+	.byte	0x4
+	.long	.LASF2258
+	.byte	0x4
+	.long	.LASF2259
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1364:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF888:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF988:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1181:
+	.string	"__DECL_SIMD_logf "
+.LASF861:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1386:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1057:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF962:
+	.string	"USE_FAKE_BARO "
+.LASF1192:
+	.string	"__DECL_SIMD_expl "
+.LASF966:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2081:
+	.string	"PID_VEL_Z"
+.LASF1075:
+	.string	"MIDRC_MIN 1200"
+.LASF1785:
+	.string	"THROTTLE"
+.LASF1299:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1133:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF949:
+	.string	"_WCHAR_T_DEFINED "
+.LASF911:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF827:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1099:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1480:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF973:
+	.string	"USE_UART7 "
+.LASF1154:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1218:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1754:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_HORIZON"
+.LASF608:
+	.string	"__SQUAD_TYPE long int"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2054:
+	.string	"calculate"
+.LASF912:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1519:
+	.string	"FP_NORMAL 4"
+.LASF1354:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF783:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1694:
+	.string	"LOGIC_CONDITION_AND"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1946:
+	.string	"OWNER_RX_SPI"
+.LASF741:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1294:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1410:
+	.string	"__DECL_SIMD_tan "
+.LASF1395:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF892:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1777:
+	.string	"m_newM"
+.LASF1845:
+	.string	"ANTI_WINDUP"
+.LASF1649:
+	.string	"__uint8_t"
+.LASF662:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2077:
+	.string	"PID_VEL_XY"
+.LASF1779:
+	.string	"m_newS"
+.LASF1611:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1098:
+	.string	"FAST_MATH "
+.LASF1805:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1773:
+	.string	"_Bool"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1316:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2057:
+	.string	"pito_s"
+.LASF1149:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1466:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF2091:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_POSHOLD_3D"
+.LASF1010:
+	.string	"U_ID_2 2"
+.LASF1578:
+	.string	"DMA_NONE (0)"
+.LASF1733:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_ROLL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2146:
+	.string	"currentTimeUs"
+.LASF1459:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1358:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1200:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1683:
+	.string	"minutes"
+.LASF2032:
+	.string	"DEVHW_M25P16"
+.LASF2110:
+	.string	"NAV_CTL_YAW"
+.LASF568:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1575:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2080:
+	.string	"PID_HEADING"
+.LASF1811:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1084:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF983:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1603:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1027:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1443:
+	.string	"__f32x(x) x ##f32x"
+.LASF1563:
+	.string	"HDOP_SCALE (100)"
+.LASF1139:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1287:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1195:
+	.string	"__DECL_SIMD_expf64 "
+.LASF941:
+	.string	"__WCHAR_T__ "
+.LASF1112:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1633:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF838:
+	.string	"USE_SERIAL_RX "
+.LASF1361:
+	.string	"__DECL_SIMD_acoshf "
+.LASF860:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1166:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF895:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1033:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1073:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1523:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF766:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1943:
+	.string	"OWNER_LED"
+.LASF992:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1626:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF921:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1661:
+	.string	"uint16_t"
+.LASF1872:
+	.string	"FAILSAFE_RETURN_TO_HOME"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1108:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1925:
+	.string	"OWNER_SOFTSERIAL"
+.LASF658:
+	.string	"__FD_SETSIZE 1024"
+.LASF616:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF781:
+	.string	"PG_RX_CONFIG 24"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2010:
+	.string	"DEVHW_AK8975"
+.LASF1820:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF923:
+	.string	"USE_CLI_BATCH "
+.LASF1994:
+	.string	"DEVHW_MPU6000"
+.LASF753:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1522:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1016:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF930:
+	.string	"_T_PTRDIFF_ "
+.LASF833:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF696:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1275:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF605:
+	.string	"__U32_TYPE unsigned int"
+.LASF1079:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1162:
+	.string	"__DECL_SIMD_sinl "
+.LASF1895:
+	.string	"velNED"
+.LASF787:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF977:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2116:
+	.string	"NAV_REQUIRE_THRTILT"
+.LASF804:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1945:
+	.string	"OWNER_TX"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF715:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1618:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1585:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1127:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1401:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF778:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF978:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1731:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_VERTICAL_SPEED"
+.LASF1842:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF940:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1183:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1580:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF2143:
+	.string	"logicConditionUpdateTask"
+.LASF723:
+	.string	"UINT8_C(c) c"
+.LASF1915:
+	.string	"stdDev"
+.LASF1421:
+	.string	"__HAVE_FLOAT128 1"
+.LASF673:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2092:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_RTH"
+.LASF1306:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1444:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1891:
+	.string	"gpsSolutionData_s"
+.LASF2113:
+	.string	"NAV_REQUIRE_ANGLE"
+.LASF1239:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1703:
+	.string	"LOGIC_CONDITION_MUL"
+.LASF1957:
+	.string	"RESOURCE_NONE"
+.LASF2074:
+	.string	"PID_YAW"
+.LASF1692:
+	.string	"LOGIC_CONDITION_MID"
+.LASF1182:
+	.string	"__DECL_SIMD_logl "
+.LASF1681:
+	.string	"month"
+.LASF654:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1274:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF883:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1419:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF809:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF1802:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF1691:
+	.string	"LOGIC_CONDITION_LOW"
+.LASF581:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1056:
+	.string	"BIT(x) (1 << (x))"
+.LASF1937:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2078:
+	.string	"PID_SURFACE"
+.LASF700:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1901:
+	.string	"gpsSol"
+.LASF1400:
+	.string	"__DECL_SIMD_erfc "
+.LASF1265:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF771:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1474:
+	.string	"_Mdouble_"
+.LASF1659:
+	.string	"int32_t"
+.LASF1422:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1966:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1859:
+	.string	"ROVER"
+.LASF1071:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF961:
+	.string	"USE_IMU_FAKE "
+.LASF1520:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2037:
+	.string	"busDeviceDescriptor_s"
+.LASF2044:
+	.string	"busDeviceDescriptor_t"
+.LASF1374:
+	.string	"__DECL_SIMD_erff32 "
+.LASF593:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2013:
+	.string	"DEVHW_IST8308"
+.LASF951:
+	.string	"___int_wchar_t_h "
+.LASF1948:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2130:
+	.string	"getEstimatedActualVelocity"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1887:
+	.string	"validVelD"
+.LASF1958:
+	.string	"RESOURCE_INPUT"
+.LASF2128:
+	.string	"getEstimatedActualPosition"
+.LASF1138:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF982:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2111:
+	.string	"NAV_CTL_EMERG"
+.LASF2121:
+	.string	"NAV_RC_YAW"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2141:
+	.string	"memcpy"
+.LASF699:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1001:
+	.string	"USE_RX_PPM"
+.LASF1914:
+	.string	"accumulatedValue"
+.LASF1967:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1375:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1289:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1531:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1288:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1090:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1857:
+	.string	"AIRPLANE"
+.LASF2069:
+	.string	"values"
+.LASF670:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1515:
+	.string	"FP_NAN 0"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2001:
+	.string	"DEVHW_BMP280"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1716:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_LAST"
+.LASF1744:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_ROLL"
+.LASF1475:
+	.string	"__MATH_PRECNAME"
+.LASF1325:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF663:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1505:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1021:
+	.string	"FAST_CODE "
+.LASF870:
+	.string	"USE_OPFLOW "
+.LASF1667:
+	.string	"PGR_SIZE_MASK"
+.LASF1835:
+	.string	"NAV_WP_MODE"
+.LASF884:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1507:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF2050:
+	.string	"pitotDev_s"
+.LASF2056:
+	.string	"pitotDev_t"
+.LASF2039:
+	.string	"busType"
+.LASF1478:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF692:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1740:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_RTH"
+.LASF635:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1462:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF879:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2095:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_EMERGENCY_LANDING"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF574:
+	.string	"_T_SIZE_ "
+.LASF2025:
+	.string	"DEVHW_DS2482"
+.LASF964:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1126:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1775:
+	.string	"stdev_s"
+.LASF1780:
+	.string	"stdev_t"
+.LASF1362:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1051:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1399:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1995:
+	.string	"DEVHW_MPU6050"
+.LASF880:
+	.string	"USE_DASHBOARD "
+.LASF2127:
+	.string	"navGetCurrentStateFlags"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1148:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1496:
+	.string	"__MATHDECL_1"
+.LASF1936:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1091:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF1752:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ALTHOLD"
+.LASF396:
+	.string	"false 0"
+.LASF1956:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF719:
+	.string	"INT8_C(c) c"
+.LASF755:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1448:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF585:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1432:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1012:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1314:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1824:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF702:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1284:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF2087:
+	.string	"NAV_FSM_EVENT_SUCCESS"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1137:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1250:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1818:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF721:
+	.string	"INT32_C(c) c"
+.LASF905:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1268:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF939:
+	.string	"__need_ptrdiff_t"
+.LASF2017:
+	.string	"DEVHW_LM75_0"
+.LASF2018:
+	.string	"DEVHW_LM75_1"
+.LASF2019:
+	.string	"DEVHW_LM75_2"
+.LASF2020:
+	.string	"DEVHW_LM75_3"
+.LASF2021:
+	.string	"DEVHW_LM75_4"
+.LASF2022:
+	.string	"DEVHW_LM75_5"
+.LASF2023:
+	.string	"DEVHW_LM75_6"
+.LASF2024:
+	.string	"DEVHW_LM75_7"
+.LASF1470:
+	.string	"_Mdouble_ double"
+.LASF2125:
+	.string	"logicConditions_Registry"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1619:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1593:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF1424:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1682:
+	.string	"hours"
+.LASF1677:
+	.string	"timeUs_t"
+.LASF582:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF617:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF744:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1803:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF1900:
+	.string	"gpsSolutionData_t"
+.LASF994:
+	.string	"USE_1WIRE"
+.LASF1427:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1123:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1031:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1589:
+	.string	"SPIDEV_COUNT 4"
+.LASF1307:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1728:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_3D_SPEED"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1006:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1968:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1132:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF2060:
+	.string	"lpfState"
+.LASF1351:
+	.string	"__DECL_SIMD_atanhf "
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1955:
+	.string	"OWNER_IRLOCK"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1902:
+	.string	"GPS_distanceToHome"
+.LASF1461:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF817:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1209:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1758:
+	.string	"type"
+.LASF2112:
+	.string	"NAV_CTL_LAUNCH"
+.LASF1713:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_FLIGHT_MODE"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1609:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF1695:
+	.string	"LOGIC_CONDITION_OR"
+.LASF2067:
+	.string	"roll"
+.LASF1707:
+	.string	"LOGIC_CONDITION_GVAR_DEC"
+.LASF936:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF747:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF701:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1069:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1650:
+	.string	"__int16_t"
+.LASF718:
+	.string	"WINT_MAX (4294967295u)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1620:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1652:
+	.string	"__uint16_t"
+.LASF2152:
+	.string	"logicConditionGetFlightOperandValue"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1923:
+	.string	"OWNER_MOTOR"
+.LASF1276:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1982:
+	.string	"BUSTYPE_I2C"
+.LASF1885:
+	.string	"gpsHeartbeat"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF952:
+	.string	"__INT_WCHAR_T_H "
+.LASF1590:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF596:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1219:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1246:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1418:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1631:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1223:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1163:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2089:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_IDLE"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1119:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1277:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1573:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1373:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1761:
+	.string	"logicCondition_s"
+.LASF1768:
+	.string	"logicCondition_t"
+.LASF2161:
+	.string	"pgResetFn_logicConditions"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1385:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF819:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1206:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1247:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2165:
+	.string	"_index"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF736:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1088:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1581:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF1719:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_HOME_DISTANCE"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1920:
+	.string	"OWNER_PWMIO"
+.LASF1145:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2006:
+	.string	"DEVHW_BMP388"
+.LASF1704:
+	.string	"LOGIC_CONDITION_DIV"
+.LASF1495:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1597:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF882:
+	.string	"USE_OLED_UG2864 "
+.LASF1540:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF899:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF922:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1045:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1509:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF683:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1272:
+	.string	"__DECL_SIMD_coshl "
+.LASF1825:
+	.string	"HORIZON_MODE"
+.LASF1255:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1644:
+	.string	"unsigned char"
+.LASF666:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1627:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF693:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1256:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF828:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1576:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF697:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF937:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1111:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF852:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF802:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1242:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1632:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF775:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1085:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1774:
+	.string	"float"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF770:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1020:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF720:
+	.string	"INT16_C(c) c"
+.LASF1476:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1833:
+	.string	"FAILSAFE_MODE"
+.LASF1498:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1372:
+	.string	"__DECL_SIMD_erfl "
+.LASF1564:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1350:
+	.string	"__DECL_SIMD_atanh "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF808:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF665:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1233:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF929:
+	.string	"_PTRDIFF_T "
+.LASF1678:
+	.string	"pgRegistry_s"
+.LASF1675:
+	.string	"pgRegistry_t"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1804:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1743:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_FAILSAFE"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1567:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF731:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1696:
+	.string	"LOGIC_CONDITION_XOR"
+.LASF1537:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF810:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1329:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1254:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1146:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1298:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF2063:
+	.string	"pressureZero"
+.LASF2153:
+	.string	"logicConditionProcess"
+.LASF1669:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF847:
+	.string	"USE_GPS "
+.LASF688:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF2149:
+	.string	"operand"
+.LASF1404:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1947:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1310:
+	.string	"__DECL_SIMD_atan2 "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2117:
+	.string	"NAV_AUTO_RTH"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF842:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1786:
+	.string	"AUX1"
+.LASF1787:
+	.string	"AUX2"
+.LASF1788:
+	.string	"AUX3"
+.LASF1789:
+	.string	"AUX4"
+.LASF1790:
+	.string	"AUX5"
+.LASF1791:
+	.string	"AUX6"
+.LASF1663:
+	.string	"uint64_t"
+.LASF1793:
+	.string	"AUX8"
+.LASF1794:
+	.string	"AUX9"
+.LASF776:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1951:
+	.string	"OWNER_1WIRE"
+.LASF1007:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1482:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1808:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF801:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF876:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF627:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF910:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1930:
+	.string	"OWNER_RANGEFINDER"
+.LASF1904:
+	.string	"ZERO_CALIBRATION_IN_PROGRESS"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF667:
+	.string	"__intptr_t_defined "
+.LASF1598:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF675:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF686:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1886:
+	.string	"validVelNE"
+.LASF2030:
+	.string	"DEVHW_MS4525"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1280:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1852:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1352:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1369:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1082:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1344:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2164:
+	.string	"logicConditions"
+.LASF2151:
+	.string	"logicConditionGetFlightModeOperandValue"
+.LASF609:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1698:
+	.string	"LOGIC_CONDITION_NOR"
+.LASF785:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1699:
+	.string	"LOGIC_CONDITION_NOT"
+.LASF1172:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1403:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1103:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1249:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2027:
+	.string	"DEVHW_SRF10"
+.LASF1492:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1005:
+	.string	"USE_ITCM_RAM"
+.LASF703:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1296:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1665:
+	.string	"PGR_PGN_MASK"
+.LASF1036:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1128:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1135:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2100:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_RTH_LANDING"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF849:
+	.string	"USE_NAV "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF959:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1759:
+	.string	"value"
+.LASF2158:
+	.string	"logicConditionCompute"
+.LASF980:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1971:
+	.string	"RESOURCE_SPI_CS"
+.LASF2014:
+	.string	"DEVHW_QMC5883"
+.LASF1322:
+	.string	"__DECL_SIMD_log10l "
+.LASF1347:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF998:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1141:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF679:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1889:
+	.string	"validEPE"
+.LASF993:
+	.string	"USE_PITOT_ADC"
+.LASF1199:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1815:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF844:
+	.string	"USE_ADC_AVERAGING "
+.LASF1118:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1345:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1435:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1150:
+	.string	"__DECL_SIMD_cos "
+.LASF1614:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1676:
+	.string	"timeMs_t"
+.LASF1526:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1712:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_FLIGHT"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1406:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF615:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF659:
+	.string	"_BITS_TIME64_H 1"
+.LASF1612:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF698:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1309:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1464:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF639:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF740:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1328:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1231:
+	.string	"__DECL_SIMD_asinf "
+.LASF872:
+	.string	"USE_OPFLOW_MSP "
+.LASF1671:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1970:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF603:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1940:
+	.string	"OWNER_MPU"
+.LASF1194:
+	.string	"__DECL_SIMD_expf32 "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1067:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1502:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1257:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1473:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1486:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1908:
+	.string	"startTimeMs"
+.LASF869:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1198:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1355:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1151:
+	.string	"__DECL_SIMD_cosf "
+.LASF1081:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1950:
+	.string	"OWNER_TEMPERATURE"
+.LASF1722:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_VBAT"
+.LASF584:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1539:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF579:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1941:
+	.string	"OWNER_INVERTER"
+.LASF1536:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1646:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1080:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1670:
+	.string	"pgResetFunc"
+.LASF641:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1176:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1660:
+	.string	"uint8_t"
+.LASF1721:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_RSSI"
+.LASF1381:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1596:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF862:
+	.string	"USE_RX_UIB "
+.LASF1625:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF1741:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_WP"
+.LASF607:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1487:
+	.string	"_Mdouble_ _Float64"
+.LASF1106:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1228:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF638:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1814:
+	.string	"ARMING_DISABLED_CLI"
+.LASF597:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF1340:
+	.string	"__DECL_SIMD_log1p "
+.LASF1822:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1799:
+	.string	"ARMED"
+.LASF795:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1591:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1583:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1629:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1408:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1370:
+	.string	"__DECL_SIMD_erf "
+.LASF1784:
+	.string	"PITCH"
+.LASF2147:
+	.string	"conditionId"
+.LASF2041:
+	.string	"param"
+.LASF999:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2047:
+	.string	"scratchpad"
+.LASF1143:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2073:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF953:
+	.string	"_GCC_WCHAR_T "
+.LASF948:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2058:
+	.string	"airSpeed"
+.LASF1960:
+	.string	"RESOURCE_IO"
+.LASF620:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF732:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF611:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF678:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1025:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1019:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2045:
+	.string	"busDevice_s"
+.LASF2048:
+	.string	"busDevice_t"
+.LASF376:
+	.string	"unix 1"
+.LASF1516:
+	.string	"FP_INFINITE 1"
+.LASF1506:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1270:
+	.string	"__DECL_SIMD_cosh "
+.LASF1508:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1160:
+	.string	"__DECL_SIMD_sin "
+.LASF1888:
+	.string	"validMag"
+.LASF794:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF788:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF956:
+	.string	"_BSD_WCHAR_T_"
+.LASF2101:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_WAYPOINT_RTH_LAND"
+.LASF1173:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2015:
+	.string	"DEVHW_MAG3110"
+.LASF2028:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1426:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF984:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF577:
+	.string	"_SIZE_T_ "
+.LASF646:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2085:
+	.string	"NAV_FSM_EVENT_NONE"
+.LASF1000:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF588:
+	.string	"__need_size_t"
+.LASF1922:
+	.string	"OWNER_PPMINPUT"
+.LASF1978:
+	.string	"ioTag_t"
+.LASF1850:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1203:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1234:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1451:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF868:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF730:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1477:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1490:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1556:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF926:
+	.string	"_STDDEF_H "
+.LASF1869:
+	.string	"FAILSAFE_IDLE"
+.LASF1357:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF963:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF713:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1066:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1096:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1801:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1253:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1454:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1437:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF729:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1929:
+	.string	"OWNER_TIMER"
+.LASF728:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1188:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1628:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1479:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1630:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF625:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF762:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1601:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF752:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF786:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF633:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2082:
+	.string	"PID_POS_HEADING"
+.LASF1988:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF613:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2126:
+	.string	"failsafePhase"
+.LASF1186:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1990:
+	.string	"DEVHW_LSM303DLHC"
+.LASF807:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1394:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2079:
+	.string	"PID_LEVEL"
+.LASF1065:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF856:
+	.string	"USE_PITOT_ADC "
+.LASF2162:
+	.string	"instance"
+.LASF680:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF726:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2106:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_CRUISE_ADJ"
+.LASF1343:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1894:
+	.string	"magData"
+.LASF1517:
+	.string	"FP_ZERO 2"
+.LASF1981:
+	.string	"BUSTYPE_NONE"
+.LASF1190:
+	.string	"__DECL_SIMD_exp "
+.LASF1717:
+	.string	"logicOperandType_e"
+.LASF2166:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF2159:
+	.string	"currentVaue"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1363:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1481:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF681:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1781:
+	.string	"logicOperandType_s"
+.LASF824:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1710:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_VALUE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1656:
+	.string	"__uint64_t"
+.LASF1159:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1125:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1158:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1727:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_GROUD_SPEED"
+.LASF1442:
+	.string	"__f64(x) x ##f64"
+.LASF1245:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1949:
+	.string	"OWNER_COMPASS"
+.LASF1232:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1414:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1411:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1917:
+	.string	"params"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1680:
+	.string	"year"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1757:
+	.string	"logicOperand_s"
+.LASF1760:
+	.string	"logicOperand_t"
+.LASF1672:
+	.string	"address"
+.LASF1131:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1488:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1117:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1726:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_GPS_SATS"
+.LASF2148:
+	.string	"logicConditionGetOperandValue"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2135:
+	.string	"getRSSI"
+.LASF1002:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF890:
+	.string	"USE_ANTIGRAVITY "
+.LASF1152:
+	.string	"__DECL_SIMD_cosl "
+.LASF1963:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1026:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1829:
+	.string	"NAV_POSHOLD_MODE"
+.LASF761:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1549:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF831:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1840:
+	.string	"GPS_FIX_HOME"
+.LASF1238:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1472:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2068:
+	.string	"pitch"
+.LASF1931:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF632:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1687:
+	.string	"LOGIC_CONDITION_TRUE"
+.LASF2122:
+	.string	"NAV_CTL_LAND"
+.LASF466:
+	.string	"__PMT"
+.LASF1048:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF954:
+	.string	"_WCHAR_T_DECLARED "
+.LASF871:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1976:
+	.string	"RESOURCE_RX_CE"
+.LASF1933:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF858:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1230:
+	.string	"__DECL_SIMD_asin "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1610:
+	.string	"P0 101325.0f"
+.LASF1041:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF816:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1637:
+	.string	"NAV_FW_CONTROL_MONITORING_RATE 2"
+.LASF1715:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_GVAR"
+.LASF1991:
+	.string	"DEVHW_L3GD20"
+.LASF1532:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1331:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1747:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_FAILSAFE"
+.LASF1823:
+	.string	"armingFlags"
+.LASF1493:
+	.string	"_Mdouble_ _Float64x"
+.LASF727:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1380:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1043:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1144:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1972:
+	.string	"RESOURCE_ADC_CH1"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1083:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1668:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1518:
+	.string	"FP_SUBNORMAL 3"
+.LASF1806:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1423:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1356:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF758:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF919:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1809:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1756:
+	.string	"LOGIC_CONDITION_FLAG_LATCH"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1709:
+	.string	"logicOperation_e"
+.LASF1962:
+	.string	"RESOURCE_UART_TX"
+.LASF1732:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_TROTTLE_POS"
+.LASF1617:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1047:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF942:
+	.string	"_WCHAR_T "
+.LASF606:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF854:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF734:
+	.string	"UNIT_TESTED "
+.LASF769:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1897:
+	.string	"groundCourse"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF707:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2120:
+	.string	"NAV_RC_POS"
+.LASF694:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1229:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF674:
+	.string	"INT32_MAX (2147483647)"
+.LASF946:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF763:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1014:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1039:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF1571:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF797:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1439:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF765:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1855:
+	.string	"AIRMODE_ACTIVE"
+.LASF1810:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF706:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF684:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF749:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF573:
+	.string	"_SYS_SIZE_T_H "
+.LASF631:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF742:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1510:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF1489:
+	.string	"_Mdouble_ _Float128"
+.LASF1157:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1453:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2104:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_CRUISE_2D"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1560:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1011:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1346:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2031:
+	.string	"DEVHW_PCA9685"
+.LASF1853:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1738:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_POSITION_CONTROL"
+.LASF1657:
+	.string	"int8_t"
+.LASF1285:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1557:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1700:
+	.string	"LOGIC_CONDITION_STICKY"
+.LASF1854:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF642:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF672:
+	.string	"INT8_MAX (127)"
+.LASF1863:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1342:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1224:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2103:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_WAYPOINT_HOLD_TIME"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF714:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1841:
+	.string	"GPS_FIX"
+.LASF2160:
+	.string	"temporaryValue"
+.LASF1878:
+	.string	"GPS_NO_FIX"
+.LASF1174:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF643:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF591:
+	.string	"__need_NULL"
+.LASF958:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2105:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_CRUISE_3D"
+.LASF1798:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF682:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2046:
+	.string	"descriptorPtr"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF997:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1291:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2124:
+	.string	"navigationFSMStateFlags_t"
+.LASF1236:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1204:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1599:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1335:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1566:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1220:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF873:
+	.string	"USE_PITOT_MS4525 "
+.LASF1497:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF660:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1800:
+	.string	"WAS_EVER_ARMED"
+.LASF1739:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_EMERGENCY_LANDING"
+.LASF1674:
+	.string	"reset"
+.LASF865:
+	.string	"USE_RANGEFINDER "
+.LASF1121:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1985:
+	.string	"busType_e"
+.LASF690:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1243:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF2084:
+	.string	"axisPID"
+.LASF1042:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1605:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1830:
+	.string	"HEADFREE_MODE"
+.LASF1237:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1934:
+	.string	"OWNER_SDCARD"
+.LASF1543:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1035:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1449:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF398:
+	.string	"_STRING_H 1"
+.LASF1412:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF628:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1879:
+	.string	"GPS_FIX_2D"
+.LASF893:
+	.string	"USE_LOG "
+.LASF1527:
+	.string	"MATH_ERREXCEPT 2"
+.LASF589:
+	.string	"NULL"
+.LASF1658:
+	.string	"int16_t"
+.LASF1366:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1533:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1023:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1642:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1858:
+	.string	"MULTIROTOR"
+.LASF1648:
+	.string	"signed char"
+.LASF1440:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1168:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF900:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1795:
+	.string	"AUX10"
+.LASF1796:
+	.string	"AUX11"
+.LASF1797:
+	.string	"AUX12"
+.LASF570:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1513:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1592:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1101:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1831:
+	.string	"NAV_LAUNCH_MODE"
+.LASF950:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2090:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_ALTHOLD"
+.LASF1848:
+	.string	"COMPASS_CALIBRATED"
+.LASF1368:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1097:
+	.string	"sq(x) ((x)*(x))"
+.LASF1164:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1336:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF708:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1535:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2156:
+	.string	"operandBValue"
+.LASF1501:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1572:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF1827:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1996:
+	.string	"DEVHW_MPU6500"
+.LASF1746:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_YAW"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1074:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF578:
+	.string	"_BSD_SIZE_T_ "
+.LASF1875:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF2163:
+	.string	"_reset_template_53"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF985:
+	.string	"USE_DASHBOARD"
+.LASF920:
+	.string	"USE_VTX_FFPV "
+.LASF1577:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1544:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1078:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1688:
+	.string	"LOGIC_CONDITION_EQUAL"
+.LASF2098:
+	.string	"NAV_FSM_EVENT_STATE_SPECIFIC_2"
+.LASF1332:
+	.string	"__DECL_SIMD_log2l "
+.LASF2065:
+	.string	"pitot_t"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF782:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF629:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2155:
+	.string	"operandAValue"
+.LASF1693:
+	.string	"LOGIC_CONDITION_HIGH"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF656:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1582:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1013:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1483:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1264:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1866:
+	.string	"state"
+.LASF722:
+	.string	"INT64_C(c) c ## L"
+.LASF1918:
+	.string	"zeroCalibrationScalar_t"
+.LASF1819:
+	.string	"ARMING_DISABLED_OOM"
+.LASF918:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF621:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF743:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1927:
+	.string	"OWNER_SERIAL"
+.LASF1393:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF928:
+	.string	"_ANSI_STDDEF_H "
+.LASF1528:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1938:
+	.string	"OWNER_OSD"
+.LASF1916:
+	.string	"zeroCalibrationValue_t"
+.LASF1763:
+	.string	"activatorId"
+.LASF1225:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1666:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF774:
+	.string	"PG_PID_PROFILE 14"
+.LASF1308:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF850:
+	.string	"USE_TELEMETRY "
+.LASF881:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2140:
+	.string	"gvGet"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF960:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1547:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1679:
+	.string	"_dateTime_s"
+.LASF725:
+	.string	"UINT32_C(c) c ## U"
+.LASF796:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1032:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1884:
+	.string	"hasNewData"
+.LASF1142:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1452:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF818:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF2061:
+	.string	"lastMeasurementUs"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2049:
+	.string	"pitotOpFuncPtr"
+.LASF1847:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF695:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2132:
+	.string	"getAmperage"
+.LASF841:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1177:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1954:
+	.string	"OWNER_PINIO"
+.LASF826:
+	.string	"PG_INAV_END 1023"
+.LASF1180:
+	.string	"__DECL_SIMD_log "
+.LASF1062:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1764:
+	.string	"operation"
+.LASF745:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF623:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1939:
+	.string	"OWNER_BARO"
+.LASF2009:
+	.string	"DEVHW_AK8963"
+.LASF1303:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF622:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1339:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1586:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1170:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2035:
+	.string	"DEVHW_IRLOCK"
+.LASF1193:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1283:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF757:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF996:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF875:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1244:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2011:
+	.string	"DEVHW_IST8310_0"
+.LASF2012:
+	.string	"DEVHW_IST8310_1"
+.LASF1673:
+	.string	"copy"
+.LASF1961:
+	.string	"RESOURCE_TIMER"
+.LASF612:
+	.string	"__SLONG32_TYPE int"
+.LASF1807:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF1899:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1430:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2064:
+	.string	"pressure"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1094:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2066:
+	.string	"pitot"
+.LASF1909:
+	.string	"windowSizeMs"
+.LASF897:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1622:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1263:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1037:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1655:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1184:
+	.string	"__DECL_SIMD_logf32 "
+.LASF779:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1606:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1986:
+	.string	"DEVHW_NONE"
+.LASF2038:
+	.string	"devicePtr"
+.LASF1333:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1595:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF2133:
+	.string	"getBatteryAverageCellVoltage"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF374:
+	.string	"__unix 1"
+.LASF1584:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF901:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF668:
+	.string	"INT8_MIN (-128)"
+.LASF1890:
+	.string	"validTime"
+.LASF676:
+	.string	"UINT8_MAX (255)"
+.LASF1928:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1003:
+	.string	"USE_RCDEVICE"
+.LASF1282:
+	.string	"__DECL_SIMD_expm1l "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF671:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1553:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF513:
+	.string	"__always_inline"
+.LASF1140:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF933:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1055:
+	.string	"UNUSED(x) (void)(x)"
+.LASF685:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2075:
+	.string	"PID_POS_Z"
+.LASF932:
+	.string	"__PTRDIFF_T "
+.LASF1100:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1997:
+	.string	"DEVHW_BMI160"
+.LASF1297:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1175:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1465:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1555:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1551:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1826:
+	.string	"HEADING_MODE"
+.LASF645:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1977:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1711:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_RC_CHANNEL"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1300:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1052:
+	.string	"EXPAND_I(x) x"
+.LASF1832:
+	.string	"MANUAL_MODE"
+.LASF790:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF903:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1215:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1471:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1662:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF576:
+	.string	"__SIZE_T "
+.LASF650:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1425:
+	.string	"__f128(x) x ##f128"
+.LASF1009:
+	.string	"U_ID_1 1"
+.LASF1834:
+	.string	"AUTO_TUNE"
+.LASF2138:
+	.string	"rxGetChannelValue"
+.LASF1445:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1538:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1286:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2004:
+	.string	"DEVHW_LPS25H"
+.LASF1330:
+	.string	"__DECL_SIMD_log2 "
+.LASF990:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1130:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1022:
+	.string	"NOINLINE "
+.LASF1871:
+	.string	"FAILSAFE_RX_LOSS_IDLE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF649:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1959:
+	.string	"RESOURCE_OUTPUT"
+.LASF2107:
+	.string	"NAV_FSM_EVENT_COUNT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1318:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1349:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1685:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1446:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1500:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2157:
+	.string	"newValue"
+.LASF1359:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF955:
+	.string	"__DEFINED_wchar_t "
+.LASF967:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF739:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2040:
+	.string	"devHwType"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1896:
+	.string	"groundSpeed"
+.LASF601:
+	.string	"_BITS_TYPES_H 1"
+.LASF1641:
+	.string	"long unsigned int"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF689:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1705:
+	.string	"LOGIC_CONDITION_GVAR_SET"
+.LASF925:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1534:
+	.string	"M_PI 3.14159265358979323846"
+.LASF735:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF793:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF760:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF943:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF896:
+	.string	"CMS_MENU_OSD "
+.LASF1216:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1720:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_TRIP_DISTANCE"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1030:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF2000:
+	.string	"DEVHW_BMP085"
+.LASF1169:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1837:
+	.string	"FLAPERON"
+.LASF1321:
+	.string	"__DECL_SIMD_log10f "
+.LASF1877:
+	.string	"failsafePhase_e"
+.LASF604:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1554:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF764:
+	.string	"PG_CF_START 1"
+.LASF1983:
+	.string	"BUSTYPE_SPI"
+.LASF851:
+	.string	"USE_TELEMETRY_LTM "
+.LASF845:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1558:
+	.string	"LAT 0"
+.LASF1643:
+	.string	"char"
+.LASF1503:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1749:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_RTH"
+.LASF1770:
+	.string	"logicConditions_CopyArray"
+.LASF1240:
+	.string	"__DECL_SIMD_hypot "
+.LASF624:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1388:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1623:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF2094:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_WAYPOINT"
+.LASF1762:
+	.string	"enabled"
+.LASF2033:
+	.string	"DEVHW_UG2864"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1110:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1323:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1984:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF602:
+	.string	"__S16_TYPE short int"
+.LASF1979:
+	.string	"IO_t"
+.LASF1114:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1456:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1136:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF572:
+	.string	"_SIZE_T "
+.LASF1730:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_ALTITUDE"
+.LASF1196:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF803:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1155:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1327:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1998:
+	.string	"DEVHW_ICM20689"
+.LASF829:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1874:
+	.string	"FAILSAFE_LANDED"
+.LASF664:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1594:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF2154:
+	.string	"activatorValue"
+.LASF1120:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF907:
+	.string	"USE_RX_MSP "
+.LASF1906:
+	.string	"ZERO_CALIBRATION_FAIL"
+.LASF1044:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF821:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF2102:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_WAYPOINT_FINISHED"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF812:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF2051:
+	.string	"busDev"
+.LASF1211:
+	.string	"__DECL_SIMD_acosf "
+.LASF636:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF580:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF867:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1197:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1729:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_AIR_SPEED"
+.LASF891:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF855:
+	.string	"USE_PITOT "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF661:
+	.string	"__STD_TYPE"
+.LASF2109:
+	.string	"NAV_CTL_POS"
+.LASF647:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1993:
+	.string	"DEVHW_MPU3050"
+.LASF691:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF619:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1429:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1783:
+	.string	"ROLL"
+.LASF1353:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF587:
+	.string	"__size_t "
+.LASF569:
+	.string	"__need_NULL "
+.LASF1953:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1147:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1302:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1460:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1191:
+	.string	"__DECL_SIMD_expf "
+.LASF1447:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1292:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1569:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF2097:
+	.string	"NAV_FSM_EVENT_STATE_SPECIFIC_1"
+.LASF2072:
+	.string	"PID_ROLL"
+.LASF2099:
+	.string	"NAV_FSM_EVENT_STATE_SPECIFIC_3"
+.LASF1235:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2016:
+	.string	"DEVHW_LIS3MDL"
+.LASF626:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1428:
+	.string	"__HAVE_FLOAT16 0"
+.LASF590:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2093:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_RTH_HOVER_ABOVE_HOME"
+.LASF1438:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1391:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1367:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1050:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1334:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF792:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF840:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1686:
+	.string	"dateTime_t"
+.LASF2115:
+	.string	"NAV_REQUIRE_MAGHOLD"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1621:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF2059:
+	.string	"zeroCalibration"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1639:
+	.string	"NAV_ACCELERATION_XY_MAX 980.0f"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF716:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1029:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1407:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1165:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1261:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1725:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MAH_DRAWN"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1525:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1965:
+	.string	"RESOURCE_EXTI"
+.LASF957:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF705:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1258:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF931:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1723:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_CELL_VOLTAGE"
+.LASF1911:
+	.string	"sampleCount"
+.LASF1360:
+	.string	"__DECL_SIMD_acosh "
+.LASF1880:
+	.string	"GPS_FIX_3D"
+.LASF1735:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_ARMED"
+.LASF1748:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_MANUAL"
+.LASF1213:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF848:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1499:
+	.string	"__MATHCALL"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF371:
+	.string	"__linux 1"
+.LASF1512:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1337:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF653:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF902:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF820:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1317:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF859:
+	.string	"USE_GYRO_KALMAN "
+.LASF1273:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2144:
+	.string	"gvSet"
+.LASF1107:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1467:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1416:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1463:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1992:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1405:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1511:
+	.string	"__MATHCALL_NARROW"
+.LASF1064:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF777:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2136:
+	.string	"getTotalTravelDistance"
+.LASF970:
+	.string	"USE_UART4 "
+.LASF832:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1545:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1210:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2145:
+	.string	"logicConditionGetValue"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1436:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1849:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1281:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1305:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF750:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1187:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2118:
+	.string	"NAV_AUTO_WP"
+.LASF754:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1217:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1529:
+	.string	"M_E 2.7182818284590452354"
+.LASF853:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1450:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1893:
+	.string	"numSat"
+.LASF1542:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1868:
+	.string	"double"
+.LASF2129:
+	.string	"sqrtf"
+.LASF1846:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1392:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1095:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF1058:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1905:
+	.string	"ZERO_CALIBRATION_DONE"
+.LASF634:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1816:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1469:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1550:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1061:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2055:
+	.string	"pitotCalculateFuncPtr"
+.LASF1248:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1383:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1615:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF767:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF644:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF2131:
+	.string	"getMAhDrawn"
+.LASF1387:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF947:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1782:
+	.string	"rc_alias"
+.LASF835:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1579:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1843:
+	.string	"SMALL_ANGLE"
+.LASF1944:
+	.string	"OWNER_RX"
+.LASF687:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1856:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF1018:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1613:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1530:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1836:
+	.string	"NAV_CRUISE_MODE"
+.LASF1865:
+	.string	"pt1Filter_s"
+.LASF1867:
+	.string	"pt1Filter_t"
+.LASF1653:
+	.string	"__int32_t"
+.LASF1457:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1524:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1654:
+	.string	"__uint32_t"
+.LASF1221:
+	.string	"__DECL_SIMD_atanf "
+.LASF1587:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1398:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF595:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF839:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1397:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1574:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1295:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF780:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2043:
+	.string	"irqPin"
+.LASF1821:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF1570:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1604:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF2042:
+	.string	"busdev"
+.LASF1851:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF898:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1935:
+	.string	"OWNER_FLASH"
+.LASF1212:
+	.string	"__DECL_SIMD_acosl "
+.LASF2150:
+	.string	"retVal"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1769:
+	.string	"logicConditions_SystemArray"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1485:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF610:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1697:
+	.string	"LOGIC_CONDITION_NAND"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1390:
+	.string	"__DECL_SIMD_asinh "
+.LASF864:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF599:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF913:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF837:
+	.string	"USE_RX_PPM "
+.LASF1734:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_PITCH"
+.LASF1348:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1201:
+	.string	"__DECL_SIMD_powf "
+.LASF1468:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF917:
+	.string	"USE_VTX_CONTROL "
+.LASF1054:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1207:
+	.string	"__DECL_SIMD_powf32x "
+.LASF586:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF677:
+	.string	"UINT16_MAX (65535)"
+.LASF1771:
+	.string	"logicConditionState_s"
+.LASF1772:
+	.string	"logicConditionState_t"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1434:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF877:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF652:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF927:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1765:
+	.string	"operandA"
+.LASF1766:
+	.string	"operandB"
+.LASF1634:
+	.string	"DISTANCE_BETWEEN_TWO_LONGITUDE_POINTS_AT_EQUATOR 1.113195f"
+.LASF1636:
+	.string	"NAV_THROTTLE_CUTOFF_FREQENCY_HZ 4"
+.LASF1315:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1860:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1077:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1324:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF822:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF915:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1844:
+	.string	"FIXED_WING_LEGACY"
+.LASF724:
+	.string	"UINT16_C(c) c"
+.LASF784:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF894:
+	.string	"USE_STATS "
+.LASF965:
+	.string	"USE_MAG "
+.LASF1952:
+	.string	"OWNER_AIRSPEED"
+.LASF813:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1491:
+	.string	"_Mdouble_ _Float32x"
+.LASF710:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1546:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1377:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1876:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF972:
+	.string	"USE_UART6 "
+.LASF1156:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1561:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1458:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1792:
+	.string	"AUX7"
+.LASF712:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF598:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF825:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1839:
+	.string	"flightModeFlags"
+.LASF1038:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1312:
+	.string	"__DECL_SIMD_atan2l "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1441:
+	.string	"__f32(x) x ##f32"
+.LASF934:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF945:
+	.string	"__WCHAR_T "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF806:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1076:
+	.string	"MIDRC_MAX 1700"
+.LASF2076:
+	.string	"PID_POS_XY"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1417:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1279:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1600:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1241:
+	.string	"__DECL_SIMD_hypotf "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1415:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF944:
+	.string	"_T_WCHAR "
+.LASF1753:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ANGLE"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1134:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2123:
+	.string	"NAV_AUTO_WP_DONE"
+.LASF1521:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1706:
+	.string	"LOGIC_CONDITION_GVAR_INC"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1378:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1008:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1319:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF657:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2003:
+	.string	"DEVHW_MS5607"
+.LASF1205:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1171:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1664:
+	.string	"pgn_t"
+.LASF887:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1565:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1034:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1070:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF709:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1989:
+	.string	"DEVHW_MMA8452"
+.LASF1227:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF834:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1559:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1607:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1251:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF815:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1167:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1638:
+	.string	"NAV_DTERM_CUT_HZ 10.0f"
+.LASF1063:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF600:
+	.string	"_STDINT_H 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF756:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1881:
+	.string	"gpsFixType_e"
+.LASF1420:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1624:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1053:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF889:
+	.string	"USE_D_BOOST "
+.LASF2002:
+	.string	"DEVHW_MS5611"
+.LASF575:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1552:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1755:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_AIR"
+.LASF2096:
+	.string	"NAV_FSM_EVENT_SWITCH_TO_LAUNCH"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2029:
+	.string	"DEVHW_VL53L0X"
+.LASF1701:
+	.string	"LOGIC_CONDITION_ADD"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1484:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF768:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF986:
+	.string	"USE_OLED_UG2864"
+.LASF737:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1341:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1714:
+	.string	"LOGIC_CONDITION_OPERAND_TYPE_LC"
+.LASF924:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1024:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF979:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1882:
+	.string	"gpsLocation_s"
+.LASF1883:
+	.string	"gpsLocation_t"
+.LASF1973:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1974:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1975:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1278:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF908:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1690:
+	.string	"LOGIC_CONDITION_LOWER_THAN"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1813:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1389:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1919:
+	.string	"OWNER_FREE"
+.LASF2034:
+	.string	"DEVHW_SDCARD"
+.LASF1260:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1431:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF651:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF594:
+	.string	"_STRINGS_H 1"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1365:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1122:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1750:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_POSHOLD"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF914:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF874:
+	.string	"USE_1WIRE "
+.LASF1226:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1059:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1776:
+	.string	"m_oldM"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1413:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1778:
+	.string	"m_oldS"
+.LASF1702:
+	.string	"LOGIC_CONDITION_SUB"
+.LASF2114:
+	.string	"NAV_REQUIRE_ANGLE_FW"
+.LASF1548:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1921:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF995:
+	.string	"USE_1WIRE_DS2482"
+.LASF1433:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1208:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2137:
+	.string	"getFlightTime"
+.LASF1049:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF733:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF655:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1222:
+	.string	"__DECL_SIMD_atanl "
+.LASF974:
+	.string	"USE_UART8 "
+.LASF1293:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1873:
+	.string	"FAILSAFE_LANDING"
+.LASF1562:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2036:
+	.string	"devHardwareType_e"
+.LASF1105:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1262:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1129:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF866:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1924:
+	.string	"OWNER_SERVO"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF935:
+	.string	"___int_ptrdiff_t_h "
+.LASF1913:
+	.string	"zeroCalibrationParams_t"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1320:
+	.string	"__DECL_SIMD_log10 "
+.LASF1266:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1861:
+	.string	"ALTITUDE_CONTROL"
+.LASF648:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2108:
+	.string	"NAV_CTL_ALT"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1376:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1259:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1326:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1161:
+	.string	"__DECL_SIMD_sinf "
+.LASF1068:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF846:
+	.string	"USE_BLACKBOX "
+.LASF1214:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1864:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1568:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1301:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1987:
+	.string	"DEVHW_BMA280"
+.LASF789:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1862:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF1202:
+	.string	"__DECL_SIMD_powl "
+.LASF2005:
+	.string	"DEVHW_SPL06"
+.LASF1980:
+	.string	"BUSTYPE_ANY"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF717:
+	.string	"WINT_MIN (0u)"
+.LASF2086:
+	.string	"NAV_FSM_EVENT_TIMEOUT"
+.LASF1179:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1384:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF878:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1724:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_CURRENT"
+.LASF981:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1115:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1004:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1745:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_PITCH"
+.LASF805:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF886:
+	.string	"USE_DJI_HD_OSD "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2071:
+	.string	"attitude"
+.LASF2007:
+	.string	"DEVHW_DPS310"
+.LASF1494:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF583:
+	.string	"__DEFINED_size_t "
+.LASF1124:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1999:
+	.string	"DEVHW_MPU9250"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1969:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1932:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1040:
+	.string	"MAX_GLOBAL_VARIABLES 4"
+.LASF1104:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF798:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1907:
+	.string	"zeroCalibrationState_e"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF885:
+	.string	"USE_FRSKYOSD "
+.LASF1640:
+	.string	"INAV_SURFACE_MAX_DISTANCE 40"
+.LASF1708:
+	.string	"LOGIC_CONDITION_LAST"
+.LASF989:
+	.string	"USE_RANGEFINDER"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1371:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1015:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF814:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1541:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1504:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF975:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1602:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1812:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1153:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF909:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1898:
+	.string	"hdop"
+.LASF2070:
+	.string	"attitudeEulerAngles_t"
+.LASF1116:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1942:
+	.string	"OWNER_LED_STRIP"
+.LASF704:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF968:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF711:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF830:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF746:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2083:
+	.string	"PID_ITEM_COUNT"
+.LASF640:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1087:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF799:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF592:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1379:
+	.string	"__DECL_SIMD_erff128x "
+.LASF637:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1455:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1635:
+	.string	"MIN_POSITION_UPDATE_RATE_HZ 5"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1817:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1736:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_AUTOLAUNCH"
+.LASF1742:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_LANDING"
+.LASF773:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF669:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1271:
+	.string	"__DECL_SIMD_coshf "
+.LASF791:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1113:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF630:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1870:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF1189:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1269:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF969:
+	.string	"USE_UART3 "
+.LASF1109:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2134:
+	.string	"getBatteryVoltage"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1028:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1647:
+	.string	"__int8_t"
+.LASF823:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF836:
+	.string	"USE_I2C_PULLUP "
+.LASF1178:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1072:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1046:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF571:
+	.string	"__SIZE_T__ "
+.LASF751:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF916:
+	.string	"USE_RCDEVICE "
+.LASF1093:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1828:
+	.string	"NAV_RTH_MODE"
+.LASF2052:
+	.string	"delay"
+.LASF2008:
+	.string	"DEVHW_HMC5883"
+.LASF991:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1060:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1102:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1751:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_MODE_CRUISE"
+.LASF2062:
+	.string	"lastSeenHealthyMs"
+.LASF800:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1645:
+	.string	"unsigned int"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1092:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF811:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1409:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF857:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1514:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1608:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF1089:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2142:
+	.string	"logicConditionReset"
+.LASF1311:
+	.string	"__DECL_SIMD_atan2f "
+.LASF976:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1382:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2088:
+	.string	"NAV_FSM_EVENT_ERROR"
+.LASF904:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF618:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1252:
+	.string	"__DECL_SIMD_exp2l "
+.LASF759:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1926:
+	.string	"OWNER_ADC"
+.LASF1651:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF863:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF906:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1313:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1588:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1304:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1912:
+	.string	"stdDevThreshold"
+.LASF23:
+	.string	"_LP64 1"
+.LASF971:
+	.string	"USE_UART5 "
+.LASF2119:
+	.string	"NAV_RC_ALT"
+.LASF772:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF614:
+	.string	"__S64_TYPE long int"
+.LASF1892:
+	.string	"fixType"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2167:
+	.string	"logicConditionStates"
+.LASF1964:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1838:
+	.string	"TURN_ASSISTANT"
+.LASF1402:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1689:
+	.string	"LOGIC_CONDITION_GREATER_THAN"
+.LASF987:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF738:
+	.string	"EXTENDED_FASTRAM "
+.LASF1903:
+	.string	"ZERO_CALIBRATION_NONE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1616:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1267:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1086:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF1017:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2139:
+	.string	"constrain"
+.LASF1718:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_ARM_TIMER"
+.LASF1910:
+	.string	"allowFailure"
+.LASF938:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF748:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2026:
+	.string	"DEVHW_MAX7456"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1290:
+	.string	"__DECL_SIMD_sinh "
+.LASF1767:
+	.string	"flags"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1185:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1396:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2053:
+	.string	"start"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1684:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1737:
+	.string	"LOGIC_CONDITION_OPERAND_FLIGHT_IS_ALTITUDE_CONTROL"
+.LASF843:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2254:
+	.string	"feature.h"
+.LASF2204:
+	.string	"io_types.h"
+.LASF2253:
+	.string	"mathcalls-helper-functions.h"
+.LASF2245:
+	.string	"math.h"
+.LASF2226:
+	.string	"long-double.h"
+.LASF2230:
+	.string	"__locale_t.h"
+.LASF2238:
+	.string	"platform.h"
+.LASF2176:
+	.string	"src/main/rx"
+.LASF2240:
+	.string	"target.h"
+.LASF2251:
+	.string	"fp-logb.h"
+.LASF0:
+	.string	"./src/main/common/logic_condition.c"
+.LASF2220:
+	.string	"libc-header-start.h"
+.LASF2218:
+	.string	"stdbool.h"
+.LASF2184:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2175:
+	.string	"src/main/navigation"
+.LASF2258:
+	.string	"dma.h"
+.LASF2189:
+	.string	"stdint-intn.h"
+.LASF2195:
+	.string	"rc_controls.h"
+.LASF2197:
+	.string	"axis.h"
+.LASF2183:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2186:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2227:
+	.string	"stubs.h"
+.LASF2235:
+	.string	"wchar.h"
+.LASF2255:
+	.string	"bus_i2c.h"
+.LASF2209:
+	.string	"navigation_private.h"
+.LASF2178:
+	.string	"src/main/target/SITL"
+.LASF2174:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2208:
+	.string	"pid.h"
+.LASF2182:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2199:
+	.string	"failsafe.h"
+.LASF2207:
+	.string	"imu.h"
+.LASF2231:
+	.string	"strings.h"
+.LASF2222:
+	.string	"features-time64.h"
+.LASF2188:
+	.string	"types.h"
+.LASF2246:
+	.string	"math-vector.h"
+.LASF2249:
+	.string	"floatn-common.h"
+.LASF2248:
+	.string	"floatn.h"
+.LASF2196:
+	.string	"runtime_config.h"
+.LASF2171:
+	.string	"src/main/drivers"
+.LASF2185:
+	.string	"/usr/include"
+.LASF2247:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2168:
+	.string	"src/main/build"
+.LASF2234:
+	.string	"time64.h"
+.LASF2256:
+	.string	"rcc_types.h"
+.LASF2221:
+	.string	"features.h"
+.LASF2173:
+	.string	"src/main/flight"
+.LASF2233:
+	.string	"typesizes.h"
+.LASF2169:
+	.string	"src/main/common"
+.LASF2170:
+	.string	"src/main/config"
+.LASF2201:
+	.string	"navigation.h"
+.LASF2225:
+	.string	"cdefs.h"
+.LASF2190:
+	.string	"stdint-uintn.h"
+.LASF2179:
+	.string	"src/main/target"
+.LASF2243:
+	.string	"utils.h"
+.LASF2205:
+	.string	"bus.h"
+.LASF2257:
+	.string	"bus_spi.h"
+.LASF2180:
+	.string	"src/main"
+.LASF2211:
+	.string	"mathcalls.h"
+.LASF2177:
+	.string	"src/main/sensors"
+.LASF2250:
+	.string	"flt-eval-method.h"
+.LASF2203:
+	.string	"resource.h"
+.LASF2206:
+	.string	"pitotmeter.h"
+.LASF2192:
+	.string	"time.h"
+.LASF2219:
+	.string	"config_reset.h"
+.LASF2214:
+	.string	"fc_core.h"
+.LASF2215:
+	.string	"global_variables.h"
+.LASF2213:
+	.string	"rx.h"
+.LASF2252:
+	.string	"fp-fast.h"
+.LASF2200:
+	.string	"gps.h"
+.LASF2210:
+	.string	"logic_condition.c"
+.LASF2239:
+	.string	"common.h"
+.LASF2259:
+	.string	"quaternion.h"
+.LASF2237:
+	.string	"parameter_group_ids.h"
+.LASF2193:
+	.string	"logic_condition.h"
+.LASF2194:
+	.string	"maths.h"
+.LASF2224:
+	.string	"timesize.h"
+.LASF2216:
+	.string	"string.h"
+.LASF2241:
+	.string	"sanity_check.h"
+.LASF2181:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2229:
+	.string	"locale_t.h"
+.LASF2202:
+	.string	"calibration.h"
+.LASF2232:
+	.string	"stdint.h"
+.LASF2236:
+	.string	"build_config.h"
+.LASF2187:
+	.string	"stddef.h"
+.LASF2228:
+	.string	"stubs-64.h"
+.LASF2244:
+	.string	"vector.h"
+.LASF2223:
+	.string	"wordsize.h"
+.LASF2212:
+	.string	"battery.h"
+.LASF2172:
+	.string	"src/main/fc"
+.LASF2242:
+	.string	"common_post.h"
+.LASF2191:
+	.string	"parameter_group.h"
+.LASF2217:
+	.string	"stdc-predef.h"
+.LASF2198:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\013"
+	.string	"=\005"
+	.string	"\304\007\377"
+	.string	"\016"
+	.string	"\246\316\201\203\002\022\002"
+	.string	"\213\322\312\371\005"
+	.string	"\003\375\304\212\207\006\004\317\270\240\327\b"
+	.string	"\005\336\217\317\207\001\030\001\002\002\002\003\004\002\005\002\003\002\006\002\007\003\002\b\r\355\304\203\212\013\002\002\t\002\n\016\240\342\234\212\n\017\213\225\200\203\013\036\002\013\002\013\001\t\002\n\t\002\n\020\021\265\312\201\237\r\022\271\222\261\200\r"
+	.string	"\023\373\354\211\360\r\004\024\313\262\334\233\004\025\240\342\234\212\n"
+	.string	"\021"
+	.string	"N\005`4T\027W\230\320\264\324\n\216:&\207"
+	.string	"\344\255t"
+	.ascii	"\347r\373\217\030\026\310\271\263sZ\257\204!G:\f\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 \305\355\002"
+	.string	"\264\002\271"
+	.string	"\t"
+	.string	"\001\003\002\001\001\003\001\004\004\003"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\001\005\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\r\017"
+	.string	""
+	.string	"\021\003\022\001\001"
+	.string	"\001\023"
+	.string	"\001"
+	.string	"\026"
+	.string	"*\201WnP\r\262\020N\t<\200A \337O\343\224`\273\214s\310xn"
+	.string	"VS5"
+	.ascii	"\334\200\007\\\336\344\036\200\035*\213_\326\200\001\026"
+	.text
+	.section	.gnu.lto_.inline.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\205\n\205 "
+	.string	"\226g\202F\320\224M:\330u\213B"
+	.string	"\265\334E\027\246\303\310\3406\364)-\315\366\204\206\217\r\"5\307\327\276S1\320&5-\200\217\210m#\345\n\032\362u\243\n\257\264d\t5\2045\357\372hk\326\310\r{v\333;\311\024e"
+	.string	"k"
+	.string	"t"
+	.ascii	"0gk\352\331^h\317\374\b'(\350t[)\274\347\203\r!\315\267_t\224"
+	.ascii	"\226\233\267\351\251k\375\372"
+	.string	"\333\342vd<\204\236\337\372\305u\334\327\201vdI\320r\r\343vw\023\370\376\313w\367\006\332\032vw\203\255\331\326\256\266#\t4\275\005W\327\200\nl\025\325^\343\2235\3464vd=\030\330%Fe\b0\263\3004\367\242\264U&kl\272\346c\272o\247\224\2619Wcs]ojt?\212\214v<\177w\376\275\030\245\324\330\356\312\335m\001ru=\317\251\252\023\302\227|^\024\271\267\335u\314\035\340\034p\251\253:[\345\027n\243\234\230\260\344J\225\322P\247\222H\002M\317]\025\006\246^\243)V\231wH\301\223\343%?[m\226\263\231\276\240Wo\260\272\315\275\322\027\324^!IU\247y\356.P\365\032\253\210\f)\301@\340\224\375^\224r\333\266m\252\365\372\251\177Qn\023%\267\227\364\\O\307\205\236\372\367b\224\322\365\254\372\343\334\270X\f.n6\233\021\265Z)\005\b\f\020\020"
+	.string	""
+	.string	"\312\211\tK\256T)\ru*i1\304Bh\205\252\n5`'\363#;2#\225\3314U\225%\316Q\315\270\031:?9'\237\230\005\206\222\340`!\224L\300\t\356H\347GD\264I\214p\037\017#\220\356\350\227\267\246\253\037@\326-\370V\230\313(2\272Ab\326\337\203\366\213\303\201T\302G+\346:\202\220H\254\270\253\225\210\003\220\316\212WQ\316\277\034\212\244\034'\340\327[\\\327\275m\363\257\367\304"
+	.string	"\301\003\3232\022\365\352!\3566\252BT\203\250v\032]\315f\001\2011\2501YC3\"\"\")HRHc\201\005DA\305\034\225\007\022`\304(\310\222A\243i\222a\377\317[*\300\216\032(v\036y$m\266\230\266\227\351&\203t\262!\205\035\322qQsN#\007\333\310}^\3233\031\326[\n\032\242\234A\376\355\200\321\31464\362(\365g;g]W\260\274xM\335\212\b\257\333%\205|\255s\215s\r"
+	.string	"\177\207\007\021w\322h\347b\350\024\363\020y\2621\307\264\273MD\255\214w\214\257\352\207\240&H\372\352si.\340\377\357'\261c\334\370\347\2708\021P\003\305\217Q[\267[\252\303\311S\305\205\320\360&\303w\217\366\255\341\216+C\004W\031\033\334\244\237S\022\216\232\236@v\217X\207m\233q\341:\031\253/\251\333\254\256:\033L\017\177\262{:'\3476l\256\035\320\265\275y\254\201\343n\220\311\273d\264Yg\311\036M\f\222\3209\235\367\323|\3661\362\212\317\243E'F!\355\200\307\342\203\351\243\336\364\032\340\323\004F\242\351\274Qs\026 [\021\356"
+	.string	"\324\030\"\221\271N`\227\256]\242c\322\224C0>a\344\352\250D\364I\200)\231\346\364\271\326g\320#?\323\036y\214"
+	.ascii	"-\\|\250v\324ej\3524\223{f\365\270E\306\0320]\243\213W\020G{"
+	.ascii	"/ 0m!v\242\216a6\243\n\370\034\203\334\344\310Z\030\323\321\341"
+	.ascii	"2\021XQ\317cFG\216\232O\313\177&B\245\017\377\374\315\235VA\031"
+	.ascii	"\003\021\2446TR\035a\337\366\362\021|\267\th\330*\327\n\240*"
+	.ascii	"\242\350!2\314\2545\267\006!\246q\016\375\030*\255\006\3238\360"
+	.ascii	"-czp!\250\2603\023\315\3418\0022<o\224\261\nxE\211\206\351\206"
+	.ascii	"\323\206\326\036\0276\327\254SX\360[U\353|*l\355\006y\364\360"
+	.ascii	"\244\003\375\354o2 \0315\227\353P\323\374\221Q\205)\307\344\332"
+	.ascii	"\234"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\001\004\365\013"
+	.string	"\302\216-.pi\222\016\274+\005Z\240`&=\003\241U'\357YU\205\237\320\255s\360X\377\377]\t\006\3270t\260\377\017\322\032\021\237\240\335v\222\001m!kH=\261\275,\362\303\341\270\"\006\020\254\256\314\314\2423\244:\244lg\274\001\303\365\326h\344\322\300`\220\271\331\034,L\266\021\262]b3\263\311\326\245Y\032\206\005\303\002\363\227\210\207\330~\370i[\2222\231\202L\202\364\003\340\340\235\303\224\353\371M\265\223r\207\371\313g\236i\211\"K\024]\ne\305\237\206\341cx\376\337U\"\271\025\312\360\212\372\212\262\253"
+	.string	"1\247E\273\251\337t\253\036\366\030:_\201\336EP\250A5\245H\264\2600\22510\002B\034Dt\033\022\340\301Q\002\b\2031\0169\206\2303\261\023\314LZX\334\232\001N8/\262\371\372\340\204a\205\016\177\r\315#\353\235\2326(h\331r\316\306o\214\214\027!\t\344\323\203c\022\305\037\301a\340\200\303\374\026\016\321\307p\311 \242\271x\302\205\340\203\3440w\030N\334\003\300\027\020\274\007\205E\277\266\345\032D\201O\343\342O\321\256\336(>\2000\201\357+\327\301h!h\021\351"
+	.ascii	"\251\345]\003\302\270X\003\2456\312#\347\022\242\226qo\256Rv"
+	.ascii	"aAo\227\346\342\300\003@\222tmEZ\026\022\203C\231@\013\304\251"
+	.ascii	" )\027\2478\\%\352\252\222C\201'"
+	.text
+	.section	.gnu.lto_.pureconst.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\204\004\002\230\004\004\230\004\005\230\004\r\230\004\017\231"
+	.ascii	"\004\021\204\004\022\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 \342m\004"
+	.string	"\022\007\030#\240)\303\001\377?\\\270\220\005"
+	.string	"|D\215\213\027\027\223\246\205!\261\335\375~\366w|\373v\267M\244L\001;\032\313\217\363< \316zCYX\021\t?\311t6\345M;`\345L)\270E\3571:]\271\353\\\224\267NEy\242\023Q\005xA)\245I\345E$\257 \226\207\362\300\354\247\004\022"
+	.string	"P\021\200\200\031\206\030S!/\352&\214\013\2071-Q\270"
+	.ascii	"\2349\274*\272\226\300\342\366\2634\202)w\027\003\004<\200\""
+	.text
+	.section	.gnu.lto_.lto.2d3a2b9967aa3cff,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_logicConditions_Registry.79.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 \240\225\004"
+	.string	"D\bb"
+	.string	""
+	.string	""
+	.string	"2"
+	.string	"\005\001\212\001\202\200\200\374\342\203\264\277\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\335\007us\355\006uq"
+	.string	"\005\001\006'\001\300\003\370'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"$./src/main/common/logic_condition.c"
+	.string	"\004"
+	.ascii	"*\"\301,:E\2217\200\""
+	.text
+	.section	.gnu.lto_pgResetFn_logicConditions.80.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\363\001m\022"
+	.string	"\326\343}H\320\322(\035B\313j\264\"\252\203\335`@\353\312\355\231\372\030\200\026\364#\003*\246PS\205\026Y\365|\340\312\r\337\246\247h(\264\246\r<&2\276\2704U\"~\"fs\036\013\035E\325u\321\377\277\376O\310\2262\245h"
+	.string	"e"
+	.string	"i"
+	.string	"j\377\347@\262\007\2018\2019uv5\346\034\035\370A\352\237\307\223\200\377R/"
+	.ascii	"\376\263\314\376q\200&\300\256\206H\310\234\223\265<\036p9\336"
+	.ascii	"Re*\363\205\256\267\242\231\177r\225n\340\004\334hd\013\207'"
+	.ascii	"\307uW\233\033Me\317\315\367\272\223\270\2401\031\335n\256\250"
+	.ascii	"\2249\247\325v3q\203\267-c\333\202\255\b\00293\335e\013\334S"
+	.ascii	"\214ONSy\3668\243\273c\177\301\210\241\022^\035[\365\240\037"
+	.ascii	"\365\334-\257\336U\353\252\017`E\324\3000\2204'\211\036\221\251"
+	.ascii	"\343\263\241B\365\271\020H\313'\262W\341R\313\037}\235W\377B"
+	.ascii	"\246\226m\377\305\207d\317\371H\316\030*?=\232\346\234\341?W"
+	.ascii	"H\375+\221_\331!\216\326\003\227\253\332\327ph\332\243@c|r\322"
+	.ascii	"\320\223\223\322\027\375E\237\021\223K'\346\254\335\346\313\270"
+	.ascii	"Q\007y\024\377\374!\006\336\366\317\217\201\377vm\031\017z\233"
+	.ascii	"G|rj;c]\324\356J\360Qc\241\340F\002\277\272\257\255\240i\317"
+	.ascii	"r\277\023\202\324\024\231i\317#>\270I\364\024\017\244\035Sy\273"
+	.ascii	"JN@@\326\341\237;\204\257\333\305\005\205\345\344\204\005\305"
+	.ascii	"$A\213\013\266\022\023\203\275Rv\231\300\304W\314\013\003Lt]"
+	.ascii	"p\2752\210\033X0\361\345Et\261`\257\225\027\226\013&\3062a`\221"
+	.ascii	"C\013\f+F\024aX\253q~u|\241\253\364\214OM\263\245}\273c\324n"
+	.ascii	"U\273;\r/\327\306G\240\334\b\273\020:$\t'7e\246\274\3139\347"
+	.ascii	"\224\252}\356%3\345\271A\" `\202Q\f\327\003\373\016\2140\374"
+	.ascii	"$\203\t\251H\312B\337\240\362\037N\302\360@L\303\n\033\273\251"
+	.ascii	"X\3155\006\352h0\030A\266\016\267\362n\2471\315,yW\366\227N\f"
+	.ascii	"\2629\301\267\373M)\340Z4\004\334\263\265\344>:{\030\200\224"
+	.ascii	"M\227x\002"
+	.text
+	.section	.gnu.lto_logicConditionCompute.82.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`[\017U<"
+	.string	":g\250\026CP\244\326\030\263\3552\312r\245\255W\360S/m\210AY\305\246\324\207"
+	.string	"\232\377\\\240%\226\341[s<\201U\226\271(\020\226:"
+	.string	"\020"
+	.string	""
+	.string	"\3326'\t@\311\024\032\302\3356\343\227Pb\224l)SJ)]\0016\001W\001\316\305w&\2763\317;\017\337Y\270:\007Wg\366\235\327w\376w\366wn\b\253^\224\n\247\250\215\353\276\250\336q\367X;\"=\327\315\334\314\254\202[\312\305\247'U\314s\214\227\024\326|j\226M<\275=a\274\265\307\r[Kk\343\022\322\344F\226Z\225GQt\331\220\316\t\232\237\353F\241\230\303\260\331\247\263\252\366\226c\274.\033\316\255\331\360c\004\303f\231\231\373\331P\025\314xk\324\207\231\220Y\343\205B\307u]eR\007\005\233];\031l\366{\264\212>2*\"\032\022\n\002J\376\370\364 \217\306\266H\344\031\n\203\354\372\256\202\233h\366\325G\r\366l\243\021N+E\353"
+	.string	"\277+r^8\311\272H\031\234\023\235\031\202\212\002\205\023\242\022$\305\r\350\351\226\324"
+	.ascii	"\344\f\224\372\323\341\007\031(\325\347\371\303{\326\001\315"
+	.ascii	"/g-\246\314\307\032\024fmM\027)\213s$Kv\ft3\026\231u\334\264"
+	.ascii	"}\3054nD'`x\220k]\206\311\265*n\204\323\240\034\373qnkK{\255"
+	.ascii	"\203\346\007\245\352\200\361\354\027\022\004\310\033\021\347"
+	.ascii	"\220\034M\034i7\320l\324x\307\304\302\210f\314\270\240\3779\347"
+	.ascii	"ZG\331S\310\205\020\\\327e'3\203\321\f\240\231]\0033\2131\033"
+	.ascii	"\273\002\035e\205\216\337\227\003\016\351\370s\376\263\261\277"
+	.ascii	"\354+\200\344<\214],\371\326\346_\354`?@\266\004rW}\234Q;\334"
+	.ascii	"wz\366\350pS\221C\242\320\2678\334r\216B\366\240oo\270\341\030"
+	.ascii	"]\264\341\366k\305X\254\341fS\004D\303\235\206H-\303m\206\207"
+	.ascii	"\315\030n2C4{\334a\204yy\334`\202\\\272p{a\251h\341\336\262J"
+	.ascii	"\271\343\306\373%W\270\355\234\235\314e\302\265U\341\256\343"
+	.ascii	"\276a\017)\270hg\240o\256\032\035\367\024\3563\356h\2465\212"
+	.ascii	"`\263-\205\231\373\212h\3545\241\256\373\325Mf\346>'s\235\232"
+	.ascii	"\r\360\253K\304\0039('\246\245m\301\310\036\365\215\353v\230"
+	.ascii	"\243_\376l\314\375\325jU\217\177\007s;?hg\252vv\320\316\r\332"
+	.ascii	"\231A;/h\347\251v\226jg\005\355\034\325\316\t\332\031A\313u\037"
+	.ascii	"hg\003\355\254lg\250v~jg\247\246vf\352\271\346\245~\322\255\324"
+	.ascii	"M\272\221:\332\035\240\235\217\332\331\250\235\213\332\231\250"
+	.ascii	"\235\207\332Y\250\235\203\336\031\350\235\223\355\374\363\316"
+	.ascii	">\357\334\363\316\310w>\276\263\261\235\333\017q\232\276\347"
+	.ascii	":\t\314\355\260\322\007}\323?\337X\323\235\236yk\351M\026\364"
+	.ascii	"\200ja\377\305\356\242\221\336\211\370f\232\347\314n\247n\222"
+	.ascii	"\304.BWb\022%\274\311\\M\354\277\270\253\b\236\375\255\261\005"
+	.ascii	"\213\273\215\205\327F\365\373\231\302\211a\323\236f|\224\274"
+	.ascii	"\260\264!\235d\315\236gk\035N\322\204y\035&6\2474\334t;\275\201"
+	.ascii	"\004\372\004@v\304\263j_\267\323\030\307\344G\375|\362\373\265"
+	.ascii	"\373\2713GM\267R;F\237W\320\363\310\367y\347{\317z\376\001_;"
+	.ascii	"\344{\234\327N\370'\325;\323\255\024N{|\251\343\235\360\213T"
+	.ascii	"\013_\267R/E\343O\265o\374~\357\230\355\031\363\216\211\230n"
+	.ascii	"\245X\210\305_\360<_\374~k(=\361?\316S#=\317"
+	.string	";\233\367\216\tU\242\327\255\364\3113|\006F\260\341\221\034_\272\225\032\031\n\277\201Si\023\301\340\013\277\3378d\265\032\207\256M\004\331\017~\2175\221\236\375\225\315\033\b\226&\245\301\245[\351\r\341\372\016\210G\232\361\202H\277\306\t\317\252Y\272\225\306\b\376S\375\333\2359X\272\235\263\303\372?p\350\237\236\225n\347\340\354\255\317\306U\337o \230WY\351\221\276\377\331\274vL\257r\360\313qN\013\225Y%DXa8\321e\325\265\034\261\225\345u\224\020\001\213kh\325\2255b\311\303 @L}\210\212\3720U\340(\253\204\025\006/\256\254\256\256\022WE\276*\300\265\324\362\322\302\342Z^y\270\322\n\261\024\241\344Znm-\257\224\\ZV[\312\253.\022\312\002L\274\034\221\325\245\364Z.\273\224\305\250\333\277\203}\322\274uEO\317\346\275\322!\250g\271\274R!\345o\310\022d\3407\314"
+	.string	"Z\372\fI\222M\177!\313\217\322\027\305|\274u=\007\276\310\227&\255\363\247>\212\255y\353\210\220\276\002\217c\202\257*c\214\372nc\342l\025<U\231\242\324S\361 N}\323y\366\361,\370\376{:\207\f\336\217\300\365\t\033\374\002\036A\007/U\206\245z)\036\353\203G\2569\337:iO\030\003DZgD\240\217\276\0053\037=C"
+	.string	"{\346\360OO\215\372&J\267\003\256G\3176m\206\320-\200\006\0309#\243'\243\177(cq@txB-b/\212\212vK"
+	.ascii	"\033+\317%*\202**\022\207\244Ncy\211\016\271\214\366\263&R\022"
+	.ascii	"\265\025\3011\247\261\274\270T?!\357j5\205\353\016=s\b-o2\003"
+	.ascii	"\2374\366_C\357|c\315\"\032\235\214\376\353\226\316FP\021\306"
+	.ascii	"\3223\321\231-\t\375R\033\223\020S u\254\333) \220\234\246wJ"
+	.ascii	":N\003\201L\2501\\\307\0303\"\"\"A\222$\205B"
+	.string	"\007\241\0062SE\253\003\021\3004\312\250!\021\222$9t\251\223\205\001\350]\224|\1772\316\274\265\b\275D\325[\205?F\327\222\001$\177\331\247\nU\307\212\020YW\275\033\271\255\231\352\324\352C\353@\n\307\246\274\2148t%\246\365\235\361\002\r\t\223`\351D\356\245o\226l\342>i\363\307\031\302\274\235\205=\364@\013\344\267\334b\201\272\207TC\254)\351\341\217W\363M\026\344o\205\273\004\n\246\226u\022\375\001u\030\351\327&km\033\355\215\362\351\ri\365\241R+\252\253\024\246\2530+~{\253\240\\r\222K\031izNI\367n\021\002j\013\344GQBb\340\332\215Z\360\275\272\227\372\213.:\351S\206\353\006reMp@\370H\256S\344\027\210b\240\320\367\t\333\321\310\037\232Y%'X\036\2324{\275R\306\360\366J\025\364H\317\371,\345Z){>\036\361#$\004\204\032=\007R"
+	.string	"\b\353N\230\274{A\231\365\tK\373\377\356\236\004\263\017V\271h\36775\243H\312\207\323(\314\016\277\244w\366P\321%\366\217\264\235@\t\342\354{\340*\2377\245\300\265<\335\224BW\331t+\r.e\363\256\024\270\224\347{\270Y\276v\020\271\n`vo\330\253n$\315\032\317\033o\374\032\006\244g\244\316D\r?\277\312b\276Pj\372)\016A\206@\216+,\322\022\b\256\272X\365\301F\324p$\335%3\202\263\005z\360\030#\022\026\321k\340\253\203e\241jI0\216\342\341\203"
+	.ascii	"\306\273\263\252\253\244Y\004\"\032)1w\2751-\302!YL\205'\366"
+	.ascii	"\260Y\371t\335t\333Zo\255\331\2467\332-\220\2609\207\236\265"
+	.ascii	"\231;T"
+	.text
+	.section	.gnu.lto_logicConditionProcess.83.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\333\013u4"
+	.string	"\212UH\023EP\\R:\027\0351\001Kd\r\320I\202J\344`s\325\251`#\031C\252\373\250K\372Ir[\337\221%\204\2323t\355V\200"
+	.ascii	"\325P\321\224\242\300B\2349\301\003AB\264\022\276\201\311\253"
+	.ascii	"\265\222O\b\331;\311\024\001\017\001%\001w\353\0366\026\230\340"
+	.ascii	"\362\353\027/Vj\016\313XN\003\266/-\301\210u/VO\313]\367QG\017"
+	.ascii	"z\256w\301\352\036~m\031\337\322o\013\342c\253\322\335I5{\311"
+	.ascii	"\352\0224=h\237R\017\343\275g\223\361\265\226z\310J\036\025\334"
+	.ascii	"\340`\226=\370\332*\332\257\301\253\3650Ij|\226kI>\215F\233\345"
+	.ascii	"\325vy\203C"
+	.string	"/\347\354\340k7\265_\221N\304~U\037\200\375\332\235\344f\274\267[\2021y\250\215\3069\227\275\205\3119\355AOh\277v\262\233\316\323\316\362\333\376\230m}9\347\"F\362\344\207\302`\013dW\025\337d\037\270\364U\227\365!pIh\200\b\217\261\007\305n;\006\305+\354\002\325$=\271<\037s\003S\2571\225\250\253Is\350d^v\350\274q\327\251\027\020\025)\347|\265\255\253\006\375`[\276\001\343\004;V\215\312\322\200\t9\265\324\004l\212\310\271\333\257\016\347\362^\340R\316\271o\323\311\343\r\364\356\036\323\335\320\356!\206\371_\336K\027c\254\2661\377\032\305\335\244\300bd\3172h\316Z\025\316\245\273\306\357\236p\221\222m\031\007\3159[\230\276MT\177\311\327\236bq\337<\262_/\376[^\226>\333\257\366!t/\373\351\r\321\020i\373\020\035\030\257\035X\370\216\317v$\345\345\323"
+	.ascii	"\3601\353\207\371\247\274\177\232\270\227\375\354\344\313\247"
+	.ascii	";my\261Y\367\325\214\215t\267\267\217\036\3676jo\013\270\334"
+	.ascii	"\273\350\336&\372\334\233xo\017\035\372\003ho\013\265\267\203"
+	.ascii	"\332\333@\367\366Px[\030\274\035\274\267\333\340m\340\275\315"
+	.ascii	"\266\267\327\366\266zoc\340\355{o\277@\210>]eqE=9w\375\351\223"
+	.ascii	"\355V1h\217\373\345\376\271\343\356\333\255_tk\326\257h_\232"
+	.ascii	"\bsg.,\341\252\224\2110\367\326'\355\223\271\260|\353K\2623v"
+	.ascii	"\230\213\371\230$6sbhr\344h i\001\310ZH\2008\031\322~M\322\023"
+	.ascii	"\347\366f,\254\205\303_m\034\332\376\364\002\314\244\225{\003"
+	.ascii	"\017Mw\215\273u\265Z3\3173f\016|\"\024\235B\304\237;pY\f\304"
+	.ascii	"\335I,I-\367M\"\276\220\347\026\316\352\356\f7k\303\357\360n"
+	.ascii	"f\302hf\376\374\001\361\357\362\350\270\244\224\241;;\366l\016"
+	.ascii	"\357\323\341r9\353\376p>Lx\017\331\335z\272=~,\276\\\222dQ^z"
+	.ascii	";>/2\322\003\237<\225c\376\035\321(Iei\300\200\004X\001\330\316"
+	.ascii	"Z\336\t\260+\026\200\3732\303\226\r\342xl,8\353;N\t\360\370V"
+	.ascii	"\274 I\364\3114\237\245\301\016\341\253\235\2307U\343k\003G\353"
+	.ascii	"\356y\3169k\305fm\204\206\203\031\207\211\360\335\336\241N\263"
+	.ascii	"K\334U\372\020\326\321\304\252\030j\rN\267\210\327i\272@v\026"
+	.ascii	"\2453G\305\004\336\332\273\275'\334\333'<\243=\246C\370i\302"
+	.ascii	"\247\212\315\334z\304\343\264\224\002^\316\271\302\214\303qR"
+	.ascii	"p\206\367\274\022&N\3347O\260_\2110\005\2405\316\351m\322,c\203"
+	.ascii	"\333\212\275\030j\255N\353\356\351\273\375\304\337\024\314\235"
+	.ascii	"\352\354\374\370\002SX.\236Hd\320 E\365T5\005\003\031$c\212\252"
+	.ascii	"\225\3720\354\0263\246\244\250\216)\330),\027O$\252\220WO1\216"
+	.ascii	"WQOB\275b\205\005(\243\021\312\002\204\001\307w\024\004*\344"
+	.ascii	"\361\352(E\205\214J\021ud\201tQ\244B\276x\201\214*R\035\237^"
+	.ascii	"\024\243\252\254\212\020\0204\022\306TU\361\n\211\254*\016\323"
+	.ascii	"\224W36\322\252\036;?=%^\016\035\\IK\021$q::[\200wG\355\347\212"
+	.ascii	"\372a\241\020>bf\344M;\312\373'\b\013\341\325\017\023\354\022"
+	.ascii	"\261\2414\304I\3013\b+%\311B\214\356\t\273\320m\005\367n\204"
+	.ascii	"\201\246k-6\323\363#Ld\rN\236\003\341\243$\223[\326\304\024\004"
+	.ascii	"\312&\b\031P\035\036=\273\272\217\250\003\322R\005gbN\b\360\302"
+	.ascii	"\036\344\205\tE\245F\370q\fn\021&b!\036>IF\271o\032a$\346\210"
+	.ascii	"\333\243\245\301\"p}\027\314)8\027\255r\277\2068X\004\316o\312"
+	.ascii	"u&\2510\221\335\251\363\272]B\234@M\320\b_\2305jN\214^\261\243"
+	.ascii	"R\204/\327\342`\021\227\016&\214\246\246ys\004\321<\323\240\271"
+	.ascii	"\001\200\340\250Q4&!CD2A\222\244$\031\016\300\002\021\231\252"
+	.ascii	"\316\001\022 5)\br\314\031\202\225\3202J\352T:1\032\002\325i"
+	.ascii	"\037\bp\365\374\204K\235\265LK(\320P-\025\262\n\204\212\024\271"
+	.ascii	"\223\273\212\374\225\337Kv\232\272\0214\032<\307\035\216a\020"
+	.ascii	"F\306\322\372\013U\204\t\006\342\005\371\257\214\004j\220\200"
+	.ascii	"Q\251\267AL\254\205\r\362\361\rN\246\323pUe6\240\b\202\271\025"
+	.ascii	"\"\016?\345\341\316\311;ik\033[\026Z\240\214\004\202\247@\312"
+	.ascii	"X\325\237\211T\267\257\332A0\022j\206\031K\357\305h\354\003\345"
+	.ascii	".\305"
+	.string	"\202#\007\344w$\322\372\215\325\rCD\351\276*\246\355\374\302\006\230\215\341\2117\313\327\353k\274\033\033\033\357\001W\262\307\374\253k0l5R=\202\343a\343o(^}XH>\021D&\250\031\244,\346HJh\370T<C ]\322G\b\2559\3330\220\313Z\220ZA\350\035e\306\3037\007G\330W\244%\25038\223\250\277\325\221\024\276\203\023\204\204\207F\302\005Yff\006\177\240\311\270\334U2\365J\237:\023+v\367\214\177\331\262E\220|\fCk&\320\006\322R\377\266\242\037\024\377\245\204H\022\273)!\346\233\202~\301\243\332\340V\327\342\264\260\213V\246f\026\367\024\025\n\301%\337\371YY\253\r47\332S\020\335M%\2773\b\375\204\f\216\031\361\356\334\036\324\036{\271\036t\302b\264\245}\024\326\204\b\342\271\350Qz\374\033\356?\206sR\235\312\033\204#\n\217<g\217\023\351\334\212"
+	.ascii	"(\361\315\220\266\326\b\251&\212^B\r"
+	.text
+	.section	.gnu.lto_logicConditionGetFlightOperandValue.84.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\t\027\rU"
+	.string	"\252\224\f M V\322\031\016\357O7\356Lu\034\273\255\3037\036u\233|MTS\275D\013\371\264\305\020\007W^\217\250\213\232\203^\013r\342\t\275\020\337\306\343\n;\260fz\362\025^\327\367\303w\246*\013aVU\245\252u\323\326\366\356&\245L\001\314\001\313\001\002\002\016\230\374\006\200|\006\202\374\035@\376\002\315\327\201\362\243\200|\005\232\237\003\345\343"
+	.string	"\362\023h\376\r\224\217"
+	.string	"\220\177@\363m\240|\003\200\374\032\315\247\201\362g\240|\031@~\001\315'"
+	.string	"\345\017\320|\250\346?-\337\311\3447\231\374\030\313\207a\362_\230|\246\345\273X\276"
+	.string	"\313oa\362Y,?"
+	.string	"\346\003\260\374\025\314_Z\276\022\363\223\230\217\304\374\243\345\033-\277h\371C\346\013\227O\304\374\241\345\013\241\374\240\345\003\231\374\037\223\357s\362{L>\317\217\277\363\343\353,?]~\316\362q~\374\340\362\201\315G\233\177.\337l\376o\371\335|f\376.\023F\"-\271m\352\326\265I\337\2335\316Tb\371\257\3769?\f\036n,o\227\273=\270\2564\250!\263\256\253\323e"
+	.string	"\327\374\377\355a\223\352\357\366K\263\262\205\032\327\214_\334\254\353\n\265\264B\347\232\277\005:\327l\034V\335%\245$\244#\243\242\241\220hH(\b\350\307\247\207gG'\315\301\t\002\321\323\3745\253_\254]\3121S\032C&\355\244\021C\nA\207\257\2434]Fa\\\260+J\223e7\234\312\332\023\346!\211@"
+	.ascii	"Sg74%Fg'T\224\365f\027t\006h\214\335\317\231\024\263\226\314"
+	.ascii	"\363\231K\232\365H\260\2264\343\311a''\353K\207+\335\001\323"
+	.ascii	"\202]N\220\t\316\233`\036\022\210\326!\321\034k\347\234\211c"
+	.ascii	"-i\366[/\3733\"9\227\314\243\301\311\3326\232\227"
+	.string	".\311\036\316\314\270`\331a\354\212\0169\210Y\241\002\366%\203\327\224..c\221\205%8[\304\223\267\230\004\2614\300\260\226\304h\324\272\256\347\343\226\223\375\212\375\371\355?\220?h\210\307\240\022\r\314\n\331[O \026\332\3007\261\034\234g\243}\356\025\317\210\334w!\3761\320\200\367x\366\n<geB\254\020\2754\223\2716\306\232\304_\233\275F\276\363\024\366\342\340{\345\036H\231_\251\036\022\343\342!\333a\373\nb\205\350\255y?\036\336\276\276\030\333\375OQ\025{\251\330X\347\356f9#\3376w\343\025\341\224p\337S\376\207\020\341=n/2\214\330X\337a\363Zb\177\330$in\330`\361\236\017\223 \302\272\253\234c8C9\262\262uvb\304\345\205s\223\242+\254una\250%\00339g\t\265\270\230\205s\221H\253\005Vr&\016i1\351;\257Bo\336|\367\202\334\344}\253"
+	.ascii	"R\223\205\212o\233\2379)\276S\370 \301\346k\327cD\335w\r\217"
+	.ascii	"\230,P|\323\354\210I{\342;\247\023&\256\211\257\\\032&-\311E"
+	.ascii	"\211\357\0229V\340\276I\340\310p\304\027\211`\023#\276g\200Y"
+	.ascii	"Zn\337%\332\247\374\266\235zl_2\246\233,b\276c~\347\343jT\223"
+	.ascii	"e\210?uQ\373\256}\r\220\367n\347\232q_\356\204\226\226\344\262"
+	.ascii	"\206\001\361\246\257\001\002}\254\311\270$\227\365\341\377\232"
+	.ascii	"\341\030\033\260\344\272b-\330\3775|\\_\254\031A\377V/\314\367"
+	.ascii	"\365\262?\362\302\362\356V\326\373\323\260\270\253\374\373[\333"
+	.ascii	"\206\277\371k\\\376\026\227\277\304\345/\326\362\257\226\257"
+	.ascii	"\302\362\223,\037\205\345\237\260|$\313\267Z\376\221\345\027"
+	.ascii	"Y>\221\345\217\260"
+	.string	"|\252\345O-?\310\362\245\226\377\301\362;X\376\006\313\317`\371@\226\377c\371\026,\337\307\362)X~\217\345O\260]v#X\376\003&\237\207\311\017*\221\3678@s\020FT\242\341m\332VF\250\253\030[\252\327\313\006\215|J\226\351\204\3525\366\331\310\265j\373\324P\275E>b\021*\013RO=C\214\353\254\354n\3236\263\270 2\313l\353\024\244\251\235x\314\306\350&#\233iS\306 k\373\212b\3236d\034\020\017Wb`L\275h\0308;<\231\372E\026\213Q\265<\315\375\252\026\207Q]pae\3153\030\036Bm\262\245>yr\256\311\324Ot]\246\264AQ\263i[W\334OW\371\272h\252\036\342\025\317R\340\022\240]\264\360K\021\214\310<d\320\271\026\002\260\350\026\315uF\276?1\020\252\026\033g\037\370\007\025\212\024\265\253\353\\\223E7\211)\201\234\354\321-U\227O"
+	.string	"#"
+	.ascii	"\320\001\214\001P\005\236\023K%%\255\347j]W\020Y\352\025\315"
+	.ascii	"r^K\275B\330\222;\345\033\023K%\205G\251HR+}\261\331\331\266"
+	.ascii	"0\027\225\312\fj\r5\234k&u\013:3hq\233*\313\354 \365\0218'>\352"
+	.ascii	"_\305A\025\343=\"\365\222Q\037u\273\025\331\024\265P\033\365"
+	.ascii	"P\256\b6\354\244\267\"\031\261\207\235T'l\024o\250\211\272\350"
+	.ascii	"K\021\016\006\257\332\376\352\230\212\205\3678\324\347\021aK"
+	.ascii	"\032\353@\r\324B}\326\025\311\210\rD\206\374\351\2463-o\233*"
+	.ascii	"\315t|\332\n\311XT-;\370dQz\241\331TI%\355i$e|E\335\002\\\327"
+	.ascii	"\265\3069\007\326A5\373^Y\363j\017*\232\212v\256\331\323Hb]~"
+	.ascii	"\270\224O\212\330T)%g\211\177\035;x\217'\374\300\240gfS\266>"
+	.ascii	"\034\236F\001\211\177\036\020\360\036y\334\340\225\331\224\255"
+	.ascii	"Mp\247\223H\260s\367F\304\246lv@\235V\241\207Nk\200\306-\314"
+	.ascii	"\246lg\342\3203\221^\365\345t\332,W<#\342tN\233_\212d\301\306"
+	.ascii	"\021\362_\301\005\274\001\017!\004\033 \320\240\001\202\215'"
+	.ascii	"#!F\202XQ\225P\205~\352\311H\325\020\023\206\b1R5%55D\204*\022"
+	.ascii	"\240\214T\025)R5\005edH\220\"PSVH\240\236X\274\252\004*+(\023"
+	.ascii	"\252\252\254\240r\322\326m\033\276\310-p\034cwK\024\245\036\275"
+	.ascii	"e\313$\nz\353\312\300\220&\350TN\013\334\221\217N\307\264\200"
+	.ascii	"\031Y\320\251\030\022\256\350G\247cH\260!\220N\221T\340\204\031"
+	.ascii	"\364R\211B\264A\247b_pC\035tZ\366\005&\364A\367\f^pAR\275^Q\200"
+	.ascii	"\202\364\"\273\340~\246Z\0040`\214l>T\035D3\252\365\214\320A"
+	.ascii	"3\243\032\017\221^(7\354\024\351E>\201\3239\322\373\244\230Z"
+	.ascii	"\365\322m\021\221\203\244w\253\210sB\253B\004Qh5\n0I\257\260"
+	.ascii	"DUh\224\316\250v^5\372fT3\027\253\3213F\265\337\022%0\2161\262"
+	.ascii	"\365\026\373\201\326\372\377@?JI\023\367\205\345^\332>\252\373"
+	.ascii	"\372\372|X\342\321=\234X\212;\036wo0l\272\264Sr\240)hb6Q8\200"
+	.ascii	"\306\315\205M\227g\222\032\350\tzw\215\353\322\260\232+\273+"
+	.ascii	")\256\360\256\360\3165\033h$:\345\220r\211\306O6]\226Ab\240}"
+	.ascii	"\234{\325\346\334\321\f\364p\214Q\271\203\377+\275\253=\336\343"
+	.ascii	"\216\263\262\343\246K\263\243\005\332\002\035\275\300\256Q\255"
+	.ascii	"#\212\354\313\270\351\022i\244@\377\310\321\n\264\320\r\210\243"
+	.ascii	"s\340\030\232\262\204\302K6]v\025%\320@nt\002-|\373\255\313t"
+	.ascii	"\"\3207\020\030r\262\307X\233.\267\206\007t\0066\372\200\026"
+	.ascii	"\312\001\227\3514\240m\030P\005\036\337\246my\302\032\275\301"
+	.ascii	"\021K\243k\264\320\315"
+	.string	"h\206\270L\347\214\246\321\346\336\214\2737\275M\333\354\210\202\272\003\346r;r\312\350\240>\313@\323\346\346f\323\2663C\005\364\007\313t\022\320\005\264\260\316h\246g\231\316\001\232\2006\367\242\370W\261\002\201\314\250!H\007\231B2\"\"\"\"\005I\222t\241F2SE\253\003\021\260$\352,\232\031\222\244 \035\352n\356\241\307D"
+	.ascii	"\271\312\367\264\256\215:Z\371\005\306(\336\n\005\361\370\320"
+	.ascii	"\034N`\304\355\355\306\036\037\212"
+	.string	"k\216\n\220l\375\267\265\360\202a1\251e\331g\304WF\313\303\354\034,\207\203\371-\350\333\236_\210\f\007\246-Aj\235\307\360\325\211\201\357\344\303\217b\230\244\326\362\2633\306#l\207\341\204C\001&\262}hT+8O\036c\221/\316,EK\r\217\253\247\202<\310\2676\361\212\006\032\177\311\203\247\342&fVX\364\312\314\225\020e\354\237\002\234JW\n\212\205\032^\225A\362\217\367\2030\f\362\256\303!c\360}G\311:r\253^\317\\\177\250\341_\373+\"\275\0271w\352\013\b\367\313#\273\234\r\352\b\355:u\246~\366L\003\236F\241\034<\216\313\251r\024\220\251t\314\322\277a\346|\321%\372\201\204\b&_7\354\321\230gh\035j\321\251}_\225\215\263x\203\320\036\236y\276!\311\275I\352\273\034\310\264\232pV\254\372\275\3007r\270\003t\336\254\201\223 \035X\272&\222\2760Y\354"
+	.string	"\203\371\220\372 \317\300\371\373;\"\226\303\201\271\211\247\250\236\364\2276\241u\022QT\340\037(\243f<+\217=\237\231\006bJYa\374\226$\230\214\365\335\t8GY\366\035w\031\025\202\350\204\n\2021nV\017\"\326~\300\214\300\021TJ\3677"
+	.ascii	"G\366\276V\236W\013\313%\275l\370\251\321\211\215\363^\335\236"
+	.ascii	"\327\370V\222\355\f\231\217o#@\304\377\001\265\360\274\3125\316"
+	.ascii	"G\265\254\375C{\330\003^\037\371W\021\nS_\204\221\034\250\326"
+	.ascii	"5\nTA\231D\034\361$\016\261$.q\"\016\345\276)\240\b\252\355\327"
+	.ascii	"\272)\366\261\n[S\031-\250\320^\303\207\222\213#\311%\f#\347"
+	.ascii	"-D\365Ju1\325\366FA%P\255o\204r\337\024P\004\325\366\323\202"
+	.ascii	"\212=\\\230\234\341*T\220\274\237\325k\323[G\217\036\331C\236"
+	.ascii	"\336\300\033\003\311\357,\016\222\310\243$n9\264*>D!x\365[=\332"
+	.ascii	"\363\267\345\rEQ\f]\211k[\354L\034Y\267\202s\rO\3341\034\325"
+	.ascii	"UE\341\276\027l\215\2429\f\371\345LAZ\027\203\224MtC\253\231"
+	.ascii	"\207c\273\361\364Ff\313\023B8\211zCj1\235\021\355X*\2507\244"
+	.ascii	"\254r`J\216\240)\340\305\2661\r"
+	.text
+	.section	.gnu.lto_logicConditionGetFlightModeOperandValue.85.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\241\007% "
+	.string	"V\372\307F\240\330\312p\200\223\021_X`\311\007\217X?\323\311n\373\241\003T&\274\217\b\263\037($\313;tw\n\367\002\304\334\321\344\0169.\274\323Z\360\351\240\201\003\201x\231\273\273\231\273\273\021i\233\220M\366\336R\246\024\257"
+	.string	"\242"
+	.string	"\273"
+	.string	"\252.U\235[5N\325\244\252o\253\036U-\252:\\\365\252ZU}"
+	.string	"GY\347X\216\230i\202\bf1\325\304 .l?\331\245=\200\204\202\353\277lf\234in\001\311L\323<\262\001\322\357\272\327\223m\026\206\255\250\272Q\3658s"
+	.ascii	"M\323\334\001\335f\274\030\236f\274\270*\376t\2272\207#o\243"
+	.ascii	"\030\256>\371Pw\001\226\027\320r@\\\0044\022x\203\2006\002\305"
+	.ascii	"\007h"
+	.string	"^\\\341\301\036\242!\001z\265m\2110\361\305*qeu~\360\320!W%5\2160\256\304\276\025\302DNoI\246iZ\247\252D\334\272\333\027m;\260o\t\002DnO\310\202\370BF%lc>\231\250\344\207/\026\246\3650R\332\317\337\3415Ro\263\361\"[\016\037%!\363\232aj\335p\001\257\221$\003\023\t\233\327\214\327\260\275\246\023\343I\226\227iB=\313\366\232N\231\002.\362lhb\351\026\037\354\r\270\302\332\252\230\212\305\016\203\322Ma\177\203\301 \025/\n[\325FW\027]Mt\365\320\325BW\007]\rt\365\317\325>W\367\374\353\347\271zg\325:\252\316Q5\316\252oTm\243\352\032U\323\254zF\3252\252\216Y5\214\252_T\255[\265KRM~\0170\322\254\321Z\247\320li+;\017\f7\263@2;C\3367\306\254\214\224\230+T\200\234\007F\302l\320\313\302"
+	.ascii	"\351\366\005\212.\255\210\217\363h\250\335\\V\250\\\027\240\373"
+	.ascii	"\306\334\226NrD\312x\234GCk\304\355\020\271\270\230\373\306\333"
+	.ascii	"\222Ln_\\:\316\353R\023\307%z\332\305\0355\\Q-\304\221\361r\366"
+	.ascii	"\002\307y]Zm\341n\321\376\334\022\345\033uwo\244\232\374\206"
+	.ascii	"\204\346}\343W\367\247\225\224\006\355\0379\022\237\317\302\033"
+	.ascii	"8\350\247.\372\034\306\213_\225\222\325\302*J\203~9;\261\344"
+	.ascii	"6~.5 \033\224j1p\365\303\311\242\371EH63?\256P\001\301\204\003"
+	.ascii	"\007& @\342\241\320$\301\211\227\241w\263\022RSoI\303\022\205"
+	.ascii	"\246\236R\004\245%\013=\f\273\246\036\023SOi\327\264$\201i\247"
+	.ascii	"\344\344\333!\021\271\227\201\347\264\323\320\3539\355J\333\016"
+	.ascii	"3\277(\254\303:\177J\340:\020\347\257\354Y\035\325\371\313\371"
+	.ascii	"l\031<\177\270\237-\261\234?\022h\313)\347\357\026\264e\224\363"
+	.ascii	"7\nm\251"
+	.string	"\344\374\211C[\0369\177!\321\002\252\261sl\213vg\251l\357\254\223\242V\212\264\"$\254\255\312\303\356\244\3204M\323Eg{rV\307\304\331\034+8;YF\256\316\316++o\326\307fo\356\033k\326\246J\315\316\b#UC\316+\313\031\355\317\036\354\037\021\200\223\2501hE\325\020\211\202\024\224\244\240\222\016P\203H\233\346\021p$\2141\242\240\324\026\n\035\200+\252\340\277\250Kv\274mi\250\332\375\363\326\301\217\376\321m\210\205\224\220\310Pkt+qIp\211\204\314p\226d{\351\233Gj_\020\373*\374f\030/*\013\225\270\222\223p\304\204rSXi/x\022\244\257rlV\376\277\3434Kj\267`\005\355\254\274f!\375\362\372\357w\333\362\006\263\235'\261%\033\305O\275\226\310\313\227\274\rz\254\005A\r4\237\355\314!\004:\2312\027D\024\263\240#O;+S\364\311'y\275"
+	.ascii	"E\322,2\246\b\240\026\351\326M\230a\2456\317\252\210\214\002"
+	.ascii	"\350\311h\b\366\364\344\274\220\\\307Wr\242\322\332\t-\246\346"
+	.ascii	"\332d9\200\263(\373$4\334\302\260A\005"
+	.text
+	.section	.gnu.lto_logicConditionGetOperandValue.86.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`M\006-#"
+	.string	"\346>\332G\220\234M:\001"
+	.string	"\245\331\312<\302O3\242\216#\221\253\201\021t"
+	.string	"u\370D\020\002\017p"
+	.string	"\016!\036\372M\333\276\327\311\273z)DJ\214H\024\020\311\177?\"\350\364\223\370\224\326\225\n\254\3320\262\266\215l\"wJ\001\307"
+	.string	"\271"
+	.string	"\307"
+	.string	"\345\351m%_\3502H\316\316\016z8[\202\232ma\365`Sk=pj\rAiv3\313\303\021@u\322\321\242J\255\025\201)\314N\203\302v\237g\242\302\264Z\251\304\252\324\232\205\300\ff\247\266\375$W\242d\017\307\254+\340\261\256Xh\311\251\265\352\200\376C\236\216\367!O\227\307\225n+k\264\231\214\244\343N%\177<\262\206\353\007\\\272\255\0340\004\352\306\254\321\200\206@\325\2303\236)Bd\027^\002\326\2236\344"
+	.string	"\252(\034\247\243\0016V\340\334\200M\343\017\214\037\277\013?]"
+	.ascii	"W\314q\342\370\332\240\301\342\311\351TP8HZT\225W\r\330$\233"
+	.ascii	"2\241Z\253\347\017\030u\363\334v\034\333E6\365\022\\\264\370"
+	.ascii	"[6\n\026?\313\354\252\342[\261\330\354\236\277\372\002I\220:"
+	.ascii	"%\305\237b1R\013\227\253 O\017\305\266\330\316\200s\244\326\245"
+	.ascii	"KYl\376j"
+	.string	"\320)m\307Jc\216y~m9\360\007\317`\212i\326\361\374\302\"\246\316:vV\323\307\272V\366\307\272U\366\234\316\371\364\340\346\364\355\301\254\277<\223\2376\247g\017\336$\235\246tz$\247\227NO:\375\237\0331#\254!\202\253V\030E;5\214^\001\362\340o\337\327\272\227]:\351N\374.\331\0165Gj\255\245\322\267R\214\225F\004\254\253 '\2739\317\345\005\016\222\276\225B\201\354\212\23216\247\346]+\311\016/\303\301\367q\352!\336\374\217G\236\346\266\001\032&\266/@\257g\030\023\323\365\032\361\316\030'!\002\314\236\316u\013\225{\333\035\376\334\344\210E\bxEU\321\300|,w$\022\341r\033Q\310,\007\256\207\2731\274\215XCv#\312\350\261\315rm\242\021\363\277\236\335p#\306\270r\033\021H\372\354\203\007\332\365\331\325\242\315\271\266\357\304\374o\027i\312i\227\234\373\232\023"
+	.ascii	"\2705\207\256\225qG\"\347\236J\b\3464\351\030W,\026\213G\"\277"
+	.ascii	"s\377$\3254\213.\367\273oX\2141\315\242o_qN\345\027\036\203\233"
+	.ascii	"\260\245y\307^QU]\343Z=\271\205\226\346\035\377\247\342\305\215"
+	.ascii	"\213\365\342\203\321/]\374\2571\036&\224$\206*\034\365\214H\017"
+	.ascii	"ECF=\023>\231?|\330up\340\240\303.\201\200\236\211\244\243\321"
+	.ascii	"\274\004E>\242#\"\017E>\036\007\036\021\b\037\t]\221\257D\t\037"
+	.ascii	"OWD4TB\3073B\241K@\300>\023=#\335\221\317g\244+\263\230\276U"
+	.ascii	"\356\r\245\366\300\017\366T\362\354\321\020\177\320r\373.Zd\270"
+	.ascii	"=\222.Rd\317>\314\226)\324g/d(6\313%\327\205mr!L1m\223/|\215"
+	.ascii	"\330\206\\\241\340\f\033`aLQn\241-\026\213tl<?s\266\266\205\013"
+	.ascii	"\363?\236\275\360\343\233rg\353i\245\\+\357\221HJ\233\020o#."
+	.ascii	"\251\345|\256\347\270Q$\214\311\031~\306\303\006gj\255\017:\334"
+	.ascii	"\314\206\002W\265\326\035\231x\250AP\243\034SfF\002\td$I\n9\240"
+	.ascii	"\002\031\032#;\02109SN\321\004M\2221\002\203\374\333\361\233"
+	.ascii	"\2324vVut\213\bJ\264\305\346G;!\006\b\240qi\332\311w_\025\023"
+	.ascii	"\007\273{A\301\314\354w\214\227Wg\031\231\301\3056\021g/\325"
+	.ascii	"Oz\273\354\276i$\314\222\221T\237\234\206\226\330\341\356pH!"
+	.ascii	"r\033\b\023f\226lE\002C(\027.\n\013\023\216{&XW\264\n\324\321"
+	.ascii	"ics\315d\377\300\372\376\270k\356L\335J\302\326\206\033\346R"
+	.ascii	"\221\300\256h\216\243\374\020\027*?B\275\bi\255\003B\301\201"
+	.ascii	"\315([#9\016\006\304\347?3\312\033\0209;-\303&4\021\013\205\240"
+	.ascii	"b\020p\362N:\344\\\221sO\021l\342za@y\346\211\302u\351\304S\200"
+	.ascii	"\037+\002|K\030\310i\311\026\342\305\301\312f2G\233\b\236\262"
+	.ascii	"\231\245\005\003;C\005"
+	.text
+	.section	.gnu.lto_logicConditionGetValue.87.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\363"
+	.string	"\275\f"
+	.string	"\306\030ZC"
+	.string	"\223\223\016@"
+	.string	"\350c\017id\003S\224\030\027\013\2505\261\313\"\223\251\033\302\276\205\330\241\251\032E\037y"
+	.string	"\201@\226\0271|\034\3446\"@[\221\307\321Jf\343\022\237\242\243\235~7\fD\366\2262\245H"
+	.string	"@"
+	.string	"I"
+	.ascii	"5\017%\323}EN\213\ngw\257\005G`\035\276\037\260\0165\305\267"
+	.ascii	"?\315\315W\371#p\""
+	.string	"E\342\021\243{\271\276\004%\034/\005:\226\327\340\006\205\217\237\236.\035)Sddw\235\\g\342\206\267\215\301\266\006\373\027\002*\2511\366\337*\214\235ix\323\257\231\316L\337J\034\233\231\003Q\355\226X\rY\033h\243\205}\324fw\354\007)\013\231?Y\302g\273)\305\272[\222Qcw#x\002\200C\333\276\213\317lv1\016q\225k(\364\330\335\n\266I<e\342@fwA/N#\302Wq\350\021(y\356\320G\261\016\241\0060\251^\255\031-9+\271\362\200\034]\262\340J7\352\024K5D\243\203%\203\370\247\013\270\261\332\261)\304F\005.)\001\205>\237\020\310\243\200$C\307\230G\213\331IF\242El\003\226y\210\037.-\212D\021\273\264\214\203\350\302F&\227\207\201#\210\016\243\353$\306\321\325A\355\025\306\"?8\0304\022\302\177\272\001\205\232\352b;\325#+Jz\032\020"
+	.ascii	"B\315!0\025ve1\232\216\307\260%\210\301\3066\r\177\261\025\024"
+	.ascii	"d\032\242,\204\341\232x\237\t\222A\025\"U5\024]\n\n"
+	.text
+	.section	.gnu.lto_logicConditionUpdateTask.88.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`x\001\315\017"
+	.string	"\206\035kG\360\222(\035B\006X\271T\025'\202\257\257\222J\330\373/:\260)F\351Hg\217W\234\013\335\240\205r@\377\037\336j\361\341F\355\220e\001+\3213\033xvF\355\237\206\340\244\3455\030a\263Yt\331F\b\2212\245V"
+	.string	"U"
+	.string	"S"
+	.string	"\007\276{\237\033\370\356Ye\363x\271b\236F\004\013\215 sNp_L\340]yw\252R\225?\363\004:9\\\257\325\275nojb\003^\037\272\b\260\227\333m\327\226WK\273\030\227\357mg\240S\303\365r\271zJ\346\234V\327\253\304\375\3356i\273\202\375\023\0012\373\265\332\255\253\276\007\244c\247G\207\2349G\344v\246\215\207\243\305k\277\375\020\013\222_\3726\203B4\222m?\030\251^K}&\214\307\006\215\t\037s\226\r\356\231\302\347\336Av\b\005\351j?\306eT\227\341\341\005\346\224\325\334\230\263t`\b\237{.\037,\305\275\233s\316ng\266\277}\355#O}\272\337\036\004\254\2459/\200\305\340|\372\265U8\350]\036Y\331\225u\277g\031\302\322\234\003\334\\\354\336"
+	.string	"\221\371\261;{\312D\005Kq\276\355\335\213\230\b\214\336R\340L\305\331\345Jwf_$\204\215\2047\342\215\202Br2\032\235\220\210\020\244\230\224L\342\004\324\251D\222*\241"
+	.string	"\207\242\323(\242D\f\2471\264\020\212\031F\r\340i4\231\306\020<\211\027L`H\246\200\"\005\0367\224H\0205\216$\b*\347W\346\231\177n0lX\333\362vf"
+	.string	"\264\375\326\243\351g\\\267E\302\216\025\025\222\023\333\222\035"
+	.string	""
+	.string	"Q\023c2\354#$\366\367XZ\305\332:\333\265i\204\t>\354\030\313\354\275\302"
+	.ascii	"-\332\336\204\315`\005\326\345w,\016\302&\225\205W\304o\3352"
+	.ascii	"\017\313\314\267j:\020\0277\004\312\236\234\226\240\252\361~"
+	.ascii	"\022\351\\\363\t"
+	.text
+	.section	.gnu.lto_logicConditionReset.89.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`\245\001\275\017"
+	.string	"v\\gE"
+	.string	"\261h8\343Q.\374\360\2648F(\376\340\301\037\240\374gkOdl\n}\375\257\370\357\261M\312\346I\002\006\253\305\270\303\027\252\227\317\336\252\325U\255#L\202\271\270\332\335\237\030\322\177\346\225\357\266{K\231RR"
+	.string	"R"
+	.string	"S"
+	.string	"\013B\357.\362\312\246\361\332\313\276F\204kF\307\356~\352\342\001\347j7\227\253\\\37117\340s\363\202\241\274\3434G\006\213"
+	.ascii	"X\007\256A\314\305\366\331S\005\326J\356\304\312\365\263'\330"
+	.ascii	"\321\363\202\255<\275\221\335u\276`!n\320m\243l?\260\177\023"
+	.ascii	"\262\253@\037\017a\004+o\376\354\034\n\226\264\215:\2337\273"
+	.ascii	"\206\222*\263\377\341A\006\204\265\305\366>\336\231\351\207D"
+	.ascii	"<3hR5v?\374\360X\234.F\211\217\277\375\220\024\320O\341\317,"
+	.ascii	"\nq\201\n\300\325GUhMx/jb6vk\"\357\034\236~|\001\326U\240TO\237"
+	.ascii	"\022k\345\217\017\304\306\323n\213\247Q\271h\001CG\3446\206\263"
+	.ascii	"\260\r\310\313\3562\260\275\341+L>vv\227\244\3422\031|\022\357"
+	.ascii	"\254!\225\177\275\363S\240w\bvr\244^\271\031W\017V\3768\200\215"
+	.ascii	"\246\232\203c\274\241\032.)!\221\200 \tiD\240t\207\243\223X:"
+	.ascii	")M8\211a\204\260TA\264\360\235D\223I\f\277SI\202\351\013Q&\337"
+	.ascii	"\b\304\342\005\n\250\357D\024Q\237\250\266\327\026\307<d\263"
+	.ascii	"\301ai\253S\231\001\300\250\247\035L\236\366T\025\007<\034\322"
+	.ascii	"\247GGXy;\267\273\313\005% p\0021W\265\003\204\016\214\031v\n"
+	.ascii	"\371\320=dTa\252\263\275MA0{GL\024\372\242\024}\246j\313v\214"
+	.ascii	"\257\007\017`K\322B%\304\3547\247m\343k\265&\342\214\203aa\331"
+	.ascii	"\\t\005|\267\211\013?!\272\314h\\\264'g\t*\343}\210t\256\363"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto__reset_template_53.0.91.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 W\035\002"
+	.string	"\024\003J"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\177?\202\210\200\020}{\274\001y,\006w\030\001\1770us\273\001q\300\001o\277\001m\276\001k\275\001i\273\001"
+	.string	"\006"
+	.string	"G\305H\352\3020\333\201\261\024\373\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`.\004e\021"
+	.string	"\226\233hF\260ZM:|\214s\307\214siJa\324d\202a\022\307\003\261\201\256\357\337R\376AiA~0i\2234\t\021\352\373\262\354\224\372\203\376\203\376P\303\3240\235G(\327\337w \006\241\2736\b"
+	.string	"hM\022\271e\nT"
+	.string	"V"
+	.string	"V"
+	.ascii	"K\342\201\034x\0220\311@\337Il\375\251\300\303\0208\230\001\377"
+	.ascii	"2\364.,t-\034t\247\315\363<\017\250\317$6\375\364\225\304\375"
+	.ascii	"\365\373qs)\021\246\224\304\363B\006\372\364\225B\364|\f\377"
+	.ascii	"Gy0\030\330\343\357\377\b\250[\253\325h\254~\223\370\237["
+	.string	"\001\034\372V6\364\247\206\376\225\f},\030\372Y.\364\271X\350{\251\320\337B\241/fB\237&\241?%B\237\tB\237\212z\240\367\263j\017\372Q\324\301\215\360\277\342\205\342\210\204K\304\013\204\353\304\365\013\322\340H\230A\037J\004\027\364\237D\005\375\245\004/\202\240\037:\037\213w5{xoB\037^\233\037^U\215\004\342\245\2213A\274\251\020\365u\274*\025\200\213\260\206\020o\207\232Zj\001\243\333\226\305D\nU\310n\333\243\371\232&\244\221\314\331\266hj\027#\223\003g[\224\324uz\362A[\305\375\320o\362\320\257\322\241?\013\327\231\312fY\263M\265;\262UL[4\230fp\252\355r\270\245\221\235\333\231\230\236\210\f9\204\271M}\212\023CH\231!n\225\307\247\303\253;\244\216\020\307\274\361\331\220\032\233\375\355\360\"\311\024\341KN#YB\026M\001\274\2569\342\343\341%\232D2"
+	.string	"oS\250!\020\220\231mAA\212j\034\003 \003!b\035\021`<f<#\321\304\211L\220\007\343\267\235-z\220x\177\333\312\2116\037b{\217s\252\353M\252\331ep\323\225\024\374:\245\355\034t\227`\025\261\nB\231'\305/\032\312\020q\235s\f\343\230\3061\306\301\371\271\255\246#\244l9\220\034\"\177\023"
+	.string	"O\256\374\316\2464\255\034(\022aQ\360\0136yT\326\230[\273\221\003A\375\204l4"
+	.ascii	"X~h\r\213\252"
+	.text
+	.section	.gnu.lto_.refs.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375 \314\205\004"
+	.string	"\302\213 (pi\222\306d\247\021 \020X\f\237\017"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@n\265\240\274Q\370~V"
+	.string	"ZFb\033\324\370\337\215}\"S\317)8\351\0204Bj\037\265\311\351\250\003\273\202\242v\246\216I\237\250\275\324\017iKz!]IS\322\b\265A\272\352&\225HR\252\300N\"\002=\b\364\214\200c\\"
+	.ascii	"\334\"\003\371\322\334\320\314\320\214\036\035h\244q\316:l\313"
+	.ascii	"V\330\225\235\260\017\366d\243\355\330\221c\002\004\004\001\005"
+	.ascii	"\210\300BUq\0043"
+	.text
+	.section	.gnu.lto_.decls.2d3a2b9967aa3cff,"e",@progbits
+	.string	"(\265/\375`p;\365\t\001Z\233\235[X0\nIJ\035]O[\2152\255\311\211_:\223\214g\336iEy\357\346\341\335\275\1775~[T\357<Z\0022Fu\352,\340/\351*\354%>\n\344>8\f\006If`\261\242\225 \311 "
+	.string	"\212\224@\305\356\247[>\303\214pq\372I4}\255%\204l)\223L\001\005\005\234\005\335\005K\264_\254\260,\"n\026\303\2627\033\226\221\037{\261;\375\351\027\311`\372`n\026\363#\335;\204Q\244\346\236\325\2757\213\034U(\207\316\236\263\264\347)\355Y\207\366\f\245=\243\240\375l\353\245w\352n\317\3451uD\362~|\366\034C{\007\256\273\t=\377h\207\243\371!87\212 \371\354\330\212v\\\247\035/\321\216\217h\247\336\013\302\f\303 h(<=\220\237\302xNEAXT\2429:(\265\313\356\352\335h\301\343w\374\217\357\361>\236\352s<\324\353x\034/\365Qw\372S\177\303\377\351S\230z\241w\201\271\236z\352u\345\247\336\350Q\270p\320U\316J\235\224\"\352O]\257\373\004K\317\036"
+	.string	"\224$\375\251\013\205\b\r\352O\335\352\007a\256\347\003\2408\251{\357\033\205\357\372\305\370T\330\373\006\013\251\272\237z\247\240T\335O\335\277\353w\341\240\266\001\204v\207!\221W\027\020\t2\266\301\\\320*\332\f\275\0205\360\220\256\254h\344!]Y%\335!]Y\375\322;}\323\333x\246\217\336\351\243\360O\277d2"
+	.string	"\221\256\254\036\205?z\030\027\016\272\261\\\025i\207\016-I\233jF\205\354\270J;\306\241\035/i\307/\264\343!\355\330G?\214\377\027\037\303\037\306#\275\374<\214\274\267\317\275\025\304\334[\301\252\306\303\307K\230\375\003\265?\237\366\277\323\034\\\f\302\341\275 \374\026\357\202\216E]\023\375,~\350N\237\310sWt\177\355-\205\301>1\336\314h\20424B\3775\355\177\266\342\245ET _\227v\367\377y\237o\336\351\003\375\366K\345\326y\306z\346[\006\203W0\346\247\302\376ir\223\332{\3735{\240[\345\n^\270\260\235\233\226 ]Yu\350\320\341\216=\355\360\323\331\037\207\366\257\241\375e\350k\345\006\336\251\253\335+~\001\257\231\263\374H\367\027\2165&\216\317\376E:\305\360\272\232\320\177H\347 \3752\250+\\\277K\344\352\335("
+	.ascii	"\206GH\270\322>\337/\020~\373.\b\237P\351\016\303gIV\004V\265"
+	.ascii	"\360\336\351{w\361\3564\303\315\3332\227\017\252i\364Ds`\357"
+	.ascii	"\233Ax\007\007o\006\241\3375\355\367\210v83M\001\365"
+	.string	"N\265\334\314\265\"2G\375\354wK\3735;\303!\265u\344\032\211aV\330M9%)\2622\035XmQhi\303\"M(dp\335.\222\313\206\245g:\310\253\006uo)\b\367\004\204\270n\027\354\032\301R\251\335\224C\363\30047\355\253\356-\365\273\344\302\335\270\313\344:\271owz\335\256\022\277\\\267\313_\272\367\317\336\273\303\f\376\333J\243V\310~\217\264\337\025\372\252\335$w\312\341\256\371\375\272[\276\372H\267\364u\\\021\363\372\354\033\320~9\b\361\340\340\345 \364\024\332\225\332\221zFGS`\001Ms1\bo\221\033v\247\023\3341O@\b\307\314\256\215\265\267T\006FP\210\240\225\317N\001\375b\343W\314%\210\333!\\F\373\235@x\007\357\004B\037j\f.\006\341\277\366\263\213A\330r/\b1\270\027\204\025.\006\341\0042\322\030-\234>_,\032\354$\212\356\260\275\245\026`"
+	.string	"\347\232V\237]z1\b\365\275 \274K\334\263\313\220\373k\340\376T\200\264{\336\300W\370s\377\351\024\217\300=\023/\370\320=\027\340\223\334_\311\317\375\233\372\256\226\373\035\342~\273\334o\026\337\215\372\221\202\236\373\315\200\246J\310\235\373gayIq\377a\035\030\235\373\323\370\250\273\317\270\373\006w\347\360\"\270g\005\270\337\fQ\334\357\236\373\317\271_=\367\377"
+	.string	"\305\375*q\377'\356\227\315\375\345\334/\236\373\307\271\337<\367w\342~\247\356\267\354R\335\037\316\375V\335_\001M\334/\022w\327\340\356"
+	.string	"h\342\376J\274\203{\306\200\373\273Xs\177\031I\334\037I\r\002\217q\317H\312\334\275\002\316\342\236\207\356\177t\177\245\373g\300\375\223\356\277\343\376<\356\337\222\271\177\005\334\337\350\376\0270\342\3562\356\331\316\375\307\334\277\210\373s\271\377\226\373g\271\377\225\373\007q\177*\367\317\341\376P\356\357\344\376K\356\017u\377\027\356_\344\376B\356\217\302\375{\334\377\003\367o\200\373/\300\375;p\377\020\356\017\302\375k\334\277\203\373\323\270\377\006\367\267\300\375\t\340\376\024\270\277"
+	.string	"\334_\203\373K\340\376\330\375/\270\277\005\367\333\347~\315\334\357\227\373\303\270{\236\373\005\342\356#\270\277\213\373\263\270\377\320\375z\340\376\253\373\005t\277s\356>\346~\247\270\337$\356\327\211\273\227\340~\375\334\357\231\273\227p\277D\334\257\227\373\255r\277>\334\235\204\373\r\341~5p\367,w\307r\367\017\334\335\315\335_\006\007\007\007\335\363\022w\027\247\273\207\300yh\311\231\0175\235\205b\326\336\316\204\274t\016b\231\353S\n\373\354/W\332\003\237\315\025r\261\025\317?\031\b\3731"
+	.ascii	"\310\271.\341Q\367\363\205\007\177IA{8\263\301\201\370\212cA"
+	.ascii	"w\027\314M\275\367\276d6\342^T7\024J\363MdDad\037\317\315\353"
+	.ascii	"\205\246\024$31\334\340\214(\231\231\267\236\313\023\242\322"
+	.ascii	"\367>^\\^\237\007q\035\213\335\0258\030t\332\337]\270\217V\351"
+	.ascii	">k\276\370]a.\276\004p\367\274k\210\322\355s\005\313O\330\306"
+	.ascii	"$\303\217\202\355{3\243O\013N\351\027\323\323\371\303$\343:\277"
+	.ascii	"\230\214\234_L\314w.\3611zn&\246\336Q#\355\364\331\373+\272\215"
+	.ascii	"\\\244L{K\231\230Z\352\363\334N)S\324\202\363\207\311\350:\277"
+	.ascii	"\366s\377\354\347\003\316\275\215\366\027\323\336un\246\247\363"
+	.ascii	"+jda\3774)\022\322:;\272\325\352\330\336\224\363g\273\220\300"
+	.ascii	"\352'\372\204sJ\243\367lof\330\212\375d\332;)Z\301\331O\017\346"
+	.ascii	"Y\023\316\305\020\372#e\336\031-\232MQ\026is\3039\251\242:+\366"
+	.ascii	"\246\333-4`^f\320n2\357\336+\244\317\275\233Q\013@\243\367I\320"
+	.ascii	"s\303\354\037\037\242fS\364eE3\032\264\251l\\#\347WS\024\004"
+	.ascii	"\032\330\227\324nJ\231Wj\3231=\365\027S\272\235}0T\312\240T{"
+	.ascii	"T\001d9\342\003G\334\004N\252\264\317\370\017w po\037\374\367"
+	.ascii	"\270\212\2518\376\363{+\270\267\002\231!\235\225\323G8\305/S"
+	.ascii	"\221\372y\372\334'\r\034\322%\364\331]\224\360p\023\0347\346"
+	.ascii	"U\205*\207\2434\001\323\002\251\230\256\212\207\231\3407\314"
+	.ascii	"\365d\031jZ\271\303T\234\207\371\360\036\326\273S\214\207\353"
+	.ascii	"\034K\301v\030\357\215\256P[\250\232\244\352b\362\325\340B\244"
+	.ascii	"\335\345G\343'\030\312\235\316\340\271\270\246\213\244+\272\003"
+	.ascii	"{\360\316\b\275e\017;\211\261c\321\224\202\303p-I\264\267\220"
+	.ascii	"-i\231{\241\304\246\245\004\267\335)v\303l\031\034\301keM;*v"
+	.ascii	"\303bwR\253\032\025\2535a\366\226\250$CS\324$\215\3250\222!O"
+	.ascii	"\260Z\204\264\267\374hg\261\202v6&\245\007>sl\366\230)\016\316"
+	.ascii	"\354s"
+	.ascii	"\031^\222\204\214\005\2126\202\307\356\024\223\341i\030&{\243"
+	.ascii	"\033D\230\f\213\271\232\217\221\005hS=\236U!\330\215\247\224"
+	.ascii	"\034\332Y\2344.\002\302q\230P\020p(\354\263\f\030\021\226\265"
+	.ascii	"(nL\237\235\310\363e\257\354\256\351\253\313e*\325W\366\331\n"
+	.ascii	"k\365 \363\302\\w\212\273p\027\226\346\253-j\206\016yZmj\023"
+	.ascii	"fg\211j\277[WcRYx\013c\335)\326\3627\023r\365b\326\275\243F\244"
+	.ascii	"\264\360\220\253\027\343#\335\317\026\0346r,)\265nX\321\331Y"
+	.ascii	"|\264\353@\355\272\252]\357\005\361\252\023P\250\326g\307Ua1"
+	.ascii	"HD\254h|\306T \034\003\261\321\341t\365\031\343\037\353Z\214"
+	.ascii	"\264,\036\257\365]Xw\324(g\230)\205\032\005\373\320Q1\217\377"
+	.ascii	"\372\262\013\027\226\323\354\250\230\007\006\302O\032\232\316"
+	.ascii	"|\326d\007\316\201u`\0378\nOa)\334\343N1\017\234\202c(\214\303"
+	.ascii	"\352JUU\251W\217u\341\302F`\341Q?\b\346\361B\366\236\316:\350"
+	.ascii	".\237'\222\007\262\336[\213\351\033.oF>\230\264t\024\031x\351"
+	.ascii	"o\213\212\2350\023\266\201\243\030\205;\305M8\310q\023\377\370"
+	.ascii	"\314\n\354\"\206iao'-\251\"\354BC\323)\002[\026\0257\341\347"
+	.ascii	"e\273pP\f\300\302j\302F8\306\205\203J\367QK\224)\246*\325\031"
+	.ascii	"\026\024d\260=_r\022V\252a\241%\353i\353\240\244\032B\030\321"
+	.ascii	"$n4\034\327\360\274\026!0#6>\343\031XH\346\007\214j\213\317\030"
+	.ascii	"\232\205tQI\3622=\225D\250\352\212v\3071\034\006\bzJf\237_\264"
+	.ascii	"\210\265\330\342\332\323H\370\310E\n\213\235\007E\373\220\211"
+	.ascii	"\366!\233\366a\032n!\304\233vU\2754\321\320\365\261\302\t\035"
+	.ascii	"\013\307C0^\366\326\360\\T\244\240>\373\024,\364\002\245\n\026"
+	.ascii	"\031\026\302\316w+RD\306g\307N\034\344\276\367^\001\241MA+\355"
+	.ascii	"C*\355C)\3754\303\0244\336\303\246_\025\331g\037\026\351#\377"
+	.ascii	"\244\n\340\225\037\274\323\027|\263\027|(\037X\255B\225a\022"
+	.ascii	"!B\022\346\267\202fV\027U\325\017\370uO\345\302\205\345+\274"
+	.ascii	"*_\275\323\007t\300\247si!\315\243Z\315tx!\362#\235\n\363_K`"
+	.ascii	"\263o\352\263\013\251\3323\300\253qv\347f\230\353\031\001\013"
+	.ascii	"9%S\364\\\r\254\251\215\212e7\344\354\251\317\367~?\345N\177"
+	.ascii	"\357\363\374\347>J\335\336Kq3\240/\004\fy\376\265\r\227\342\330"
+	.ascii	"\316^\262\013\321\264\013\305\264\013\273\264\013\207h\027Ri"
+	.ascii	"\027"
+	.string	"\362\320.|\322.\204\241o\364b\020B 4z\271\365\311\330[\027\240f\362K\336\311\303}\223\177\273\323G\373\264\270W{\0301L\351.\222\031\202\313\243V\261\222<\026\323\233\024\210\265\307\222\346Q\253fnx;\217\n\366m2CRy\324j\334#\2411\032\216Q\363\2503\302\247\246\024FL\3665\354\225\270\344\371\225\r\231b[oh_\241\332\327!\355yP{\256\352;\223\3514\336\027\203\220Lf\017\006\375\0055\262\200\f\221\345f\332\224'\265\317\034\370\304\304\326\261)L|i\325\226\027R;\260u\352\353\230\\\017\274#\032g\001\366\327\224\323\034\346\300\300\326\"vq\177T\357\342\331bI\021w\026\250\216'\226\346\240\304\313k\375r\333\343\243Z\255_\201\325%_\331)%\b\\\324\r\315\201\214\213k\315\312@\027_\232\22500HR\004B\232\003\327\326\326\2325CJi:\003\215\212\346"
+	.ascii	"\004\013k\315\2429\002\323\007\344\264\226\305\326\242\203k\205"
+	.ascii	"\2156\315\001\207\020!\353\025\024\036R\267\307\023&hWz0?\262"
+	.ascii	"\250\200\225i\016JUUk\220\231(s\317\0025>\2733\226\255(\326S"
+	.ascii	"\020!\220\026\224\220\317\216\301Io\340\333\341k\217\035+\325"
+	.ascii	"S\257tC\243\314=\016\216T\211\302\366\202\225\244$\030\345+\225"
+	.ascii	"\257?\336\250\\\361[}\004\222\005\251\273\323\276J\345\037S3"
+	.ascii	"\330 \250\343\360\362\006FUf\346@\312\204L?\257< \220\323\033"
+	.ascii	"\336r\344X\241n\005i\023\217\211\024t\372\002\032\2469<=\255"
+	.ascii	"P\023\270\241\361Q\017\320F&\267\246\340+\224\233M\263\006\331"
+	.ascii	" \340\2417\234E\243\253\323L\224\331w\001\032_\334\021\206\021"
+	.ascii	"\264\206\346\324\364\322\267\206\026\370ye\032\344\341<\212b"
+	.ascii	"\303Lo\370\242Ac]\232\2112\371,X\213\033\222V\225q\341\324\326"
+	.ascii	"\\\227V\245%L\2260\371\274&E\300G\325\266\261\326\270\200\244"
+	.ascii	"i\240b\304X\2413zc\371(\243^?#2\350*\303W\350\025lAr%\007\216"
+	.ascii	"\013-4\215\226\221\321\372\342\212\361\005Y\312b>H\250\254H\276"
+	.ascii	"\276\310\373\253\023\362\366y=\272F\\\246sCZ\\Aa\035\225\215"
+	.ascii	" '\232\306\271\016\255Ck\321\355\332E\020\240Q\377\332hZ\344"
+	.ascii	"\216\370\342V\027\276\026\251\255\270\363\213\373\274\266p5m"
+	.ascii	"El\353\311\347\225\350\2015M\243f\003\350\371\n\340*\204\345"
+	.ascii	"^6\263k"
+	.string	"\027\r\307\256\252\236\325\355\204\322\304\f\3511\335X}|\025\362\325\231\200\020\216\207|\002\003\373\274\006\371\272\002G\037\230\023h]1ugD\320J\257?\027(U\261\021\330l\201\212\343\001\344\363\257L\307\363\026i@\224>\257\333\365\214pA%\r2i\222k~\316\202iAbnS:[\361\034\350\316\302\222\266t\203\tG\225\351\\\r)'\355\017(\351\rO\033\317T\250\344+\021*\354\3354x\306\262\203\307\322\003M\275\201\311\346\n\271\271\210g\266;\315E\362\024\354\204n\244\f\222<\300L\351\361t\367\331\357\215\364\3559\371S\222\335\352\250Kr\033]\223\354\244\352\r\304[nk\"\205\227\3732_\246\346\274\274w\247Y/\307me\275\314\204\t5\212^\226\313v\027\016Za\377\224\341\261`\202S\212\311J\034OC\323)\202\226\235\224|w\247\331\316g\262]~\222\353\\\310\272z\244e\350"
+	.string	"\303\367\204\256\206\260\216.\306\2104\205\276\3179\312\020*\303\r\210\b\224;\315syz\212\025\232\025<\227\265\034M]\332-`i\267\020\225\3414\024\252\022\023\034\332-\334\320n!\252\335\002T\273\005$\267\334\366\325\346\307$\267]#roD\315\"\235\221\344$yM\b\031\023(H{V\033!G\223\261\3179\247y>\342\316\362P3\222\364}v\013>\332\363YF{\322m$U\264g\263\034\243\"\037\237s\231^Q\001\217\303j\305c,\311g\317e\231\314\0020I>\234n|\316c\331\210g\262<\315d\032D\367\366\311d22\371\252)\252\002\235\316a <\213\2553\334l\350\370\354R\301L\323X\311_\371+\023\321S\222j)\353\003\204\363)\236\211\304Q\365\230\016\321\0078\222\2724w\351\235a\017H\354\350\212\313sW\336C\317\366\234\276\353ZQB\332L\372"
+	.string	"@\260\362\026V\326\022\201\211\0017\305\245\261\310\362\254\245v7\224\222(\216\002#\3051d\343\263W\030\322\033X\330x\016r\2479H\2762\342\300\203\331\342D\364\303)_\271g\253,\004\003\nw\344\261\265}\326\200\2452z\272\003W\376\221\177d 3M\234\344)\201s^T\236\201\254C\322\2442\256\021wgY\233\376\356\314\224\350\rV6\236\247\246\360\031\213s\357#\233)'O\250\207l#l\316\312\227>"
+	.ascii	"Z\336\221w\344"
+	.string	"(\fjL\341\\\324\310\217\036\236\243\\\366[\232\323\347\314\003\257i\250 hT\346I\027 G\016L\204F\211\223*2R&\251\f\220\216\321\262\361\f\0055\265gW\005s\025\005D\004\250\t\020h\343\371i\232\237\262\213\357\332L\2311\243\034KU\035'(\364G\325/Ql<;M\263\023\256\372\256}\024\302\350/\211ULV\330\016)b\232"
+	.string	"F6\236\231\35643e\"\354\214\356#\n\246\230Og\330\016\017\351\211\227\306"
+	.string	"f\3439\352w\232\243\231E\356\332\314\030\"QHW\325\275\241\036X\260Z\030]\301\322\030\322l</-eg\356\332F-8\246\370\250\232\3074l\352\263\307"
+	.ascii	"\351\016N9)'e#\025\314\270\027V0N\264\207\037\03002\215\213\301"
+	.ascii	"\017\346\f\3174\360XU\234\331\347\fu\265a\r\2513\353s\226\201"
+	.ascii	"\343b\260d<q~\3161\\m\350\306\244\t\005\2301-\023\304\3063\322"
+	.ascii	"\235f\244\354\024!\352sd\201\020'vU\325\275\331<\340(gT\324g"
+	.ascii	"\207\251\241;\254\310E\236\213\262\021\013t3\367@\by\322\270"
+	.ascii	"\347\247g#5\231\0327\214~\324`\240\ry\353\323\271E\206\026\263"
+	.ascii	"1\250\321\233\0162-\322\210\217,\022Y\324\021\321\262!\244PZ"
+	.ascii	"P\232\250\271\311\201\031qdO\024\225%\034\213m\262\204\226\315"
+	.ascii	"\211\300u>\244P\326\244P^p@\211\022\022h\331\234\241\0056\247"
+	.ascii	"\330\036\223&\034\217\254\210\023\0364\240es4\2609;\036\250P"
+	.ascii	"\262m[<\001\211\242\250\034\241\343\001\211\226\315q9\026o\226"
+	.ascii	"\255\361\204\232\036d\316\005)z\220\306\343\005\032l@\334\200"
+	.ascii	"\203\02457,\317\222\002\244\211\241\210\017o\242Uf`\271.\223"
+	.ascii	"$\250h\2157\311#k\302\261\330\323\336x\260cl\227\037\264l\216"
+	.ascii	"\004J\036\242\207\226H\242\004\b\031Z$\253T\366\210(\"k&`\211"
+	.ascii	"2\354\262\250C\002k\242\270<\032\213&`Z6\204\0239\253QY<A<\026"
+	.ascii	"OH\036s\f\320\262%N\344\254"
+	.string	"HcQ\331.\221\311\033\026\244Q\331.kX\234\236\343\r\322X\243\\\366\324Dp<\366 \221I\344\260%\nQ$\225:m\02294Qd\217Y\005\317\315\016\273#T\301\223\024\221\241u\235\017<\304\232\033d\217\013\322\304\257K\342KKD\346\360\254\310\034\036\314j\300\270\31488\305\241\n\236\344MV\266<\030\207E\346\030\217\305!\016\273\354\311\256$\346\360\274(\213:7Y\205\262]\032sX\t\020\227\0270\260,\362L`\246eC\210@EQ\251\364`\207m\227*J\020\227\001X.\331\233\244\222\004\fK\b&p\235\0178F\236\021\016 aiLQ\034\346 \215;\312\242\213>&\225\255\006\034dqg')\342F\311\322&\205\256\363!\307x\242\210dw\222\"$K`o\220\305vi\304!\226 !\204\007\n\300\266=<;I\0219F\023\310\036e\315\215\211\001\200`B\206\305I\222"
+	.string	"\241eC\340\320\022\227\3541\007\351\201\222=\366|\300\342\364\264\306\266-bh\211\303\366\001\277!\"A\220@\016O\006\2771*Y$\233\243]\203\r.\330\200\203\024C\347\240\003\f:\300@\350\034t"
+	.string	"\002D\007\033\200\320\276\001\b\214\301\207\fB\020yv\330\226\330\262KVI\204\240]\022+\340\260\307\023\212HV\210\343"
+	.string	"e\262-\2360\2667E\027\226X\201\305\203%1\206]F\340\001\226GE\233\033\200\203,*Y\236\244n]\307\202\245\b\f+\212\242\022\273\316\207\236\035cM\253\223c<\232\2309\036\223\312\254s\323\032yV\024E\025xyB\230\\\"\331\345\222(l\331\235\232\245\222=aT\342\210\300ps,\336\260\264K\"{ct9\301\216X\366\234 TQ<\2628k\253T\266$\334 {@\340\211@\314\2106\331\032yZZ6\007\237`q\260\322X\324-QY<\026oJ\264\304V\247-\356H\200$\356\340%\361\004\213\323.\207$H\240`\2218\307$qGX\002\005\213$\356\b\205l\317\261h\002\016\333\026\217=;=77\305\n\307\342\t\334\022I"
+	.string	"\200\353|\270\241"
+	.string	"\347\230\324Y\262J\235\022N\260#p\332\245\fK\214`I\242U\026\333\245\313\222\004\253\001c\t\024I\034\244\021\305\321X\004\001E\362x,\276\264\310\236\244\b\366\310\263S\\\272,w\212\312\"\217Py\202\361X\024\221T\262\032\220i]\347\203\211"
+	.ascii	"\224\200\363K\242\222m\217F"
+	.string	"\020@\264<.\313U\204\004\236m\213m\t\023<G\335\022\227\023\230@\213dw\212,\211\226\270$\241\227$T\350\264\307\"+\002\222eK\264\313\342\321BR\311V\340\205U\366,\227\254\222G/\211=\307d\211%O\216\005\024\354\b\313\242NK[dOh\225EV\004\023ZF\034Y\023Xr\212$> \341\003}L&\033@\\q\214\307\342\t\226eN\361hbe\211 ,yr^X\036\025%\2440\232\030\266\305\022;=Ha\353:\037\226<95I#\004\355\261\210\227\304\342M\022\002K\236\034\230\266x\304-1\001\031 \223G\254s<\342b[\034\221S\334\031\216\370`\204#{B\210\303\262<%\206\354R\331\223\024\201\203\354I*s^txX|\202\207\305<I\034\235\334\266\270\316\207\f\236\344a\2255m2\251\254qY\032\217G\343\216pIdw\214%\260m\021\207\350\322\0227"
+	.ascii	"\241\225EVE\326i\221\311\235UE\021\007/\225=I\235u\311\266=H"
+	.ascii	"\343\316\260%r\320\"\215=C7a\202\203\023B\2048\201\203\017\001"
+	.ascii	"p\005(@\004\005\023\030!\004}\363\001\231"
+	.string	"4\266F\342\2151'y\254A&wv\22275Hcq\247\346F\271\254\371P\200%\0162y\303.\207\354\216\261\315U \3256(BT\214^\260\272\376\226\376\306XP\330\361\342\311\224\245\354\244\250Y\345\267:\275\330H3\342\324\227]t\250>u\361e\242\341\235\024\020po\245z\341s\222\003\b\025J\347-M=\321\313,\206}E\202\325\274 B\242#YA\360\256\\\362\216\350\300\356\326\254\rADgv_2BKyV\2448\305\362\340\206\352\212\300h\205A\227\320e\032[v9d|\326BQ\253\251\271\034%\003T\305\305\217\317\322\365LP\217\350\363\213\224i\223)\237\245aUS\301\034\237_\212\212tD?K\261r\263\r)\3513\002\200V\267\025\316\335\326&\376\200\317\336\315\275\227r\330\2401{<\253\033\372\202\306}]\342k\223\225\211\336\226\216#&\353\233\0163!3\237A\274\b"
+	.ascii	"W%\322\257\030&Q\346\350\246h\367\225m-\3021\210\244o\r\032\303"
+	.ascii	"\205\347\227$\311\372b\213(*\204\304W5\276\0306j|^\323\326#A"
+	.ascii	"\244\246u\237\361\362~\334\245i}^\317V4\031()\261#\256\347\324"
+	.ascii	"g\225\252*\305l\025r1\304\312\323Zv\025\204\375\250\343B\343"
+	.ascii	"\221`\270\0039\246\224RflF\333\24413\024@@Ph&\031\216x\315\036"
+	.ascii	"\023@\325*\223\221\030\007\231Rj\206$IR\2439y\300c5\226\303E"
+	.ascii	"\2773\201\033zb`_\232\314\264\020\246 \213\277=\350\241j\024"
+	.ascii	"}u\034 \232\024c\306J\005\260\335\324\034\317\234>\347f55\n\037"
+	.ascii	"i_7\216\311\220\351Y\004\300\3567\304\223'\264\260\005x\245*"
+	.ascii	"\203\236"
+	.string	"\006\310\206`\266\201\212@\222\204\3254\307;v@\274p"
+	.string	"\033U\376\307gj\253G\260H\221\263Br\274Q\213\242\235"
+	.string	"\365Z\336\2729\364"
+	.string	"#\244a\005\016~\210\bW*R\006g\225\275\262\310\265C\2101\332\t\004\022C\344\260:v\013\237\352\231bMH\357\325N\\\031\025;~=\004>\241\264\030i\213\220\260d\273\314Y\254\0170\003\350\347U\001\351_\312\362\341\277\310\314@8\277/\303k\332\n\024\307\353vz{\247v\247\262v\326\023O\202T\r\021\025;H\262^\221X\204&\024X\265\220\277\227F\201;\226\362\346bQv\206\3754{\240C\021\006I\241\247\232\333N\262X\026\027\230e\262F\346TA\232\254\342\314\233\310l\237\031\345\023\261"
+	.string	"\236\320\243e\256\274\361~\026\213D\307\321\370\261]s\275\245\342\367\204f\207\245%p.\177<\263U$\221\016\314\212\3511/\265D\363\337\204D!\325\2147S\250S\270\353Ed\002UaNi\245\002\212\361n\r\b\271 \201z~\0226\232\214\340E\347@\202\340\215\177\241\365\303L/\033\233\367s\026*t\340\212\303\024\032\036\036\013\273-d\266\273\272F\363\212}$\200\237,\217\243\024`\353\021\315f\327\006\277v\327\223e\214\225\274\001\33163Nm\022\213\351\311G\".n\250C \205\355\316\305-\2673\343\273"
+	.string	"J\375\355\001\352\200\262\253\235\232\321\333WAM\207\020\275\004/\341\272Y\324FLv\362\007\360\266\353l_u"
+	.string	"\321O\364\007\376\245\377}-J\320\t\362\307\374}\365\230\031\232\336\270B.\325\2032\341\177\247\031\320\300l3"
+	.string	"h\252\n  \b\367VD\253\2006\221]\243v*\341\241.\246|e\271\003NA\007W\243\356\201\f\226\365\016\245+\346j\004\377\273\305\013\2771A?F\\\235L\233\3569\263q\021l\203v\327\237\256x)\325\202\220>3k\321\355\310\004=&\3137Zg\200\221Wh\233|%\024\362T\2602\243\267\236N"
+	.string	"\207\321\361\221\332\341\251\252\200^\3770+~\032\215\224<5\262gWAp\373\270\f\304QS\340"
+	.string	">\035<\b\260\276\212\257>HX\230\215\263\027|\244J+\335&\002d\206fK\022\017\207m\370\273\034O\226\225\303\020\357\370\253)@\234\032\256#n8\246\332\355C\356]\331\246Or\234r\224\234e\324S\242\352"
+	.ascii	">e\300\013\0378\003\243j\332\177N\352=\225\222\007\300\342\343"
+	.ascii	"\247\361\243/DW\345\275\302\250eYnY*\225^\2218\214(1\023\262"
+	.ascii	"\275\032\236\300\265\036>\320\341\340\266n\342\2767\344\007G"
+	.ascii	"\214\020\005mN\252bhN\265\215\b\020\2374a\224\341\225\220?\214"
+	.ascii	"\200\365jk\2651\305\241b'\210\310\017\253K\3739#2a\254\221Y\360"
+	.ascii	"@\2115\314\025\326\203\317&\2324q\372\302\271\330\001\313\270"
+	.ascii	"\232\315t\2631O'\\\"(\276\236\247M3< \3517n\270C\203s\252=\241"
+	.ascii	"7@\322\266 u\246\037\026\260\346l\325\363\267\273\217l1=\016"
+	.ascii	"\304\205.\233\313\3442\001c#XX\242\036\005\253^\327&\305\203"
+	.ascii	"\234j\326X\303\261_i09\265y)\264\002\263\300C\362\204\314E\242"
+	.ascii	"?\322{T\204-\253\0230\324\f\325\bb\224\313\355\363\331@\301\356"
+	.ascii	"\357\354\326\222\204L\\\313\262\005\013\272\321\336S\241\"\335"
+	.ascii	"W\371\217\027}\203\f\023tN\023\353T\\C7\275\r\247\376\002\r\271"
+	.ascii	"K9\360'\224\354\256\027\313\352\312\365l\220W\032\300\327\364"
+	.ascii	"\241SX\005]\371DyZ\233-\204f\235\236@\\\227\341\312\377\200\210"
+	.ascii	"\310\356\"\246b\310\375\375\021\361\223\207\030\033u\266\007"
+	.ascii	"Q \366qf\207n\273\320\260l,\001iE\255\004\306\236\t\211h\022"
+	.ascii	"\243x\221\037R\250\357\332\352\224[\301\250n0\233\236\204\270"
+	.ascii	"\354\035\320V\325V\254\300\220W\334\200\226\025\274Z\216\376"
+	.ascii	"\202\300{\210+\332a\270\320\203\371\327$\213\224\254\353\373"
+	.ascii	"\002U:mR\030&("
+	.string	"Z\202\2079\276\251\004:\341\036\240\027\311\357\231|\255\027Q\n\226\2767xHk\351\325\\\2342\346s\013\b\275\245\300\313\007\341\332\022\002Fdl\277\374\324\016\031\301\2706\032[\2555\256\003\331\"\020\234F\315xpR\341\276g\203\331\277\253Z\347\205\351'\305a6\006j\207|\323vA8\367\241\257\263\272f\1771\350\331^X+\207\215\b|~\3360\005\215o\273\016\222\016\357\314\023 \257\275\304\2677\333\366\240\240\030q\253\016\3375\217]F\351t2\344\234\036\360\222\365k\261A\370\267_\303\032\265-Xhr\312\004\243\220\221\022\033C\2049Q\363\265\037\263d#\217\211\226\ny#\301A\013\224|M&\345\257i\243Z\372\344CM'bD\307\034\243\331t3S\257\345:\301\310\347\252\362\033\230:\033\271\005\255\345\324\250\260\242`\265\222E\001\323!(W\007>\326%\2650\263(7\005QG\376\266"
+	.ascii	"\376\375\272\376Y\236\244\222`\303\3229\341>\007\364j\255\370"
+	.ascii	"\204\247p\271\303S\307\227_\021\023%\365\020\376\250HM"
+	.string	"\272\213\375~\212f\344?\241\241\203\272\030|\2106\247\275\215\205\212\344\227\204Ic\357\314Y\"\2110;\032\340\362\360&o\352\362>\217v\213\222<u4\013l\207^\255|\203\257s-h\003\003\232\033\270\032\241\372\350\"\026\002\322(\274(q\200s\020\2501M\234\342\375\036\251\3150a\036\356\376\346\237`T\247\270\236\022\361G2\234/?e\301`\330L\345K#\231\374\013C\247\226\224\310\232[\335J\276\340\212\016\360\277\362\315\262\fb\270\f\t\272g\354\240\221M \3579C\024\355P\004\002\343\323\327\205P\227\344\276]\204B\374\034\006\222\233\303\3757\367\304\315\035\271\333l\302)Y\"\013\016d\b?\\\333\315\241/\377\232} \342\247\316\243+\336G\212\220Q\351\267)\347I\331s\266\tDJ\005\246\377\216\361\331l\253cp\035\261\207\031\207\224\350p2\343\253\030\032\255\001\320\246#\373\273\315\362+>"
+	.string	"\360\200QB4\306\007\035\377\n\224\213\\\336@^#\273\335\314\003\r\030\372\277\212\257[\201\322\232\374j8\233\210b\023e\0233?\205Fd\314lBa\314N\257\022\361\302;O\303\376LP?\320,K\254\251.\230\222\201r.\rg\376\351O\032\334\342f\353\242xNj\007\211n\f\365\310\252\262\332\317\375\026Y\035uc\b\370\320\245w\315HNd\240\352\235\233H2\324D\247rW@\2546\243]@;\372\347\035\003\177\352\233_\270\024\233\213\232\217z{\3560p}d\351\243%\216\274\320#v\304\206\211\262\017\324\020\251\036*\002.r\243\260;\201\t\017zH\223\210\0046\320,.\301p\fL\231\216\366?\031\205\217F\356H\245<\336\372\003\332\213\342\n\301\261\217\233"
+	.string	"\224}\335rV\001\024\354\311\206\202:+\374E\tTMR\221\374\315\344\371}\tr\214\370\261\277/\322\333.\002\007\255d\311\026AF\220M\261*\214\225@Q\223\216\002l\357A\n\355\343\364\252:\270\220"
+	.ascii	"Nd\362SEp)0\231\311\352\036;\255\301.\201\321F\302\210\223\331"
+	.ascii	"\320*\277o\351\202}bhc&\357\nK\032)z\340\034\207\006HT\006\f"
+	.ascii	"\013\3205\003yw}`\bwT\013z\361\277\200_j\275O\367\226\262\260"
+	.ascii	"\005\265m/\217\306\226+\006\020)\334\200\373(vK\nT\221Sf"
+	.string	"B\004\033\230\023\200\234K>\032\231\004\337\312W?M`5\037\304p~\013\357J\305+\225\200q1f\215\320\323\253\212\270\336\306\224\357\020\241p\371_\325\b\231K\200\212\250\322\243\367\302q\266\021J\370 \225&\234&\242Hc\322\327#\220,Z\230\340e\366H&\036\302D\365\234\242\025\273\233\273\230\036\\4\250\232/|\301 \217'O\231\373p\343\216\304'\340\006\366\203\204\003\312\277\rd\342\340\300\355\3124\302\213\337\253\335B\324\305\022\251\333<\311\331X\3427\366\331\t\257D\254NQN\314>\322`eF\213s\315\2319\241\340}\301\201\225uH\360\017\275\221Ng\214hjBR[\267\231\215\334Pg\004B\002\264\305f\236Tx\315.\240\233\307\345\332\020\f\036<\017\201\366\263\204\334{\205e\226\027\347\215=\370\225\215\250.\365{h"
+	.string	"Ag\021\316\237\372\373Q"
+	.ascii	"s\367'(\202\020\032@T\213\026\023\025)B1\307@C1:\016\373\217"
+	.ascii	"\325\221\336\005\253\017\246\274\231\020\335\276<sn\217~cN\257"
+	.ascii	"\216\036\235;\237\177=o\036\035s\235\365\263\212\301\031%\370"
+	.ascii	"yq\240\263\231\314E}\234\320E\342\016@'\373\375r\037\256\355"
+	.ascii	"\270\225\327\250k\330\234\357/\006\003\2606\346\266\334\0245"
+	.ascii	"\332\354^\332\310i\001/\203\376\307\226\320~\335\3409\221[1\351"
+	.ascii	"p\345\370NX\316\325rJ\323%Y\370La\236\314.\305w\352,\315Li\267"
+	.ascii	"\b\307\211\035\245v\025\375q\2651~G\305W\225\237\373,\202sT\256"
+	.ascii	"\322\007\256~\326\357Q\035\347s=\177\302;V5\203\021\366=~\332"
+	.ascii	";\030\343K?\001\356u\306D\364k\361\307\037\240\234\026:\277\276"
+	.ascii	"*\271f\226\336=\226\216\347V>\017\215Jrb<6NV\360\306`kw\257\333"
+	.ascii	"\236\006q\306\002s`\232\206\007\377\236z\237\222\375x\032\350"
+	.ascii	";\016\234\311\025\226\373\370\\!\033\216\235\256"
+	.text
+	.section	.gnu.lto_.symtab.2d3a2b9967aa3cff,"e",@progbits
+	.string	"pgResetFn_logicConditions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"logicConditionGetOperandValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"logicConditionStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"logicConditionProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"logicConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\002"
+	.string	""
+	.string	"logicConditionGetValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"logicConditionUpdateTask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"logicConditionReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"logicConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"logicConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"pitot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"axisPID"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"gvSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"gvGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"navGetCurrentStateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"getEstimatedActualVelocity"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\002"
+	.string	""
+	.string	"getEstimatedActualPosition"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"getMAhDrawn"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"getAmperage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"getBatteryAverageCellVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"getBatteryVoltage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"getRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\002"
+	.string	""
+	.string	"getTotalTravelDistance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"getFlightTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\002"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2d3a2b9967aa3cff,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12523 @@
+	.file	"maths.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/maths.h"
+	.file 6 "./src/main/common/vector.h"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "./src/main/common/maths.c"
+	.file 10 "./src/main/common/axis.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	maths.c.04f2c5b6
+	.weak	maths.c.04f2c5b6
+maths.c.04f2c5b6:
+	.long	0xf7e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF1500
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1381
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1382
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1383
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1384
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1385
+	.uleb128 0xa
+	.long	.LASF1386
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xa
+	.long	.LASF1387
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xd
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1388
+	.uleb128 0xa
+	.long	.LASF1389
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1390
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1391
+	.uleb128 0xa
+	.long	.LASF1392
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xa
+	.long	.LASF1393
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF1394
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	.LASF1395
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1396
+	.uleb128 0x18
+	.long	0xb7
+	.uleb128 0xd
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1397
+	.uleb128 0x22
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0xe5
+	.uleb128 0x19
+	.string	"X"
+	.byte	0
+	.uleb128 0x19
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x19
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1403
+	.byte	0xc
+	.byte	0x5c
+	.long	0x118
+	.uleb128 0x12
+	.long	.LASF1398
+	.byte	0x5
+	.byte	0x5d
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1399
+	.byte	0x5
+	.byte	0x5e
+	.byte	0xb
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x13
+	.string	"yaw"
+	.byte	0x5
+	.byte	0x5f
+	.byte	0xb
+	.long	0xb7
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1400
+	.byte	0x5
+	.byte	0x60
+	.byte	0x3
+	.long	0xe5
+	.uleb128 0x1c
+	.byte	0x5
+	.byte	0x62
+	.long	0x143
+	.uleb128 0x1d
+	.string	"raw"
+	.byte	0x5
+	.byte	0x63
+	.long	0x143
+	.uleb128 0x23
+	.long	.LASF1401
+	.byte	0x5
+	.byte	0x64
+	.byte	0x13
+	.long	0x118
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0x153
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1402
+	.byte	0x5
+	.byte	0x65
+	.byte	0x3
+	.long	0x124
+	.uleb128 0x18
+	.long	0x153
+	.uleb128 0x1b
+	.long	.LASF1404
+	.byte	0x14
+	.byte	0x67
+	.long	0x1b1
+	.uleb128 0x12
+	.long	.LASF1405
+	.byte	0x5
+	.byte	0x69
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1406
+	.byte	0x5
+	.byte	0x69
+	.byte	0x13
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x12
+	.long	.LASF1407
+	.byte	0x5
+	.byte	0x69
+	.byte	0x1b
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF1408
+	.byte	0x5
+	.byte	0x69
+	.byte	0x23
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x13
+	.string	"m_n"
+	.byte	0x5
+	.byte	0x6a
+	.byte	0x9
+	.long	0x70
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1409
+	.byte	0x5
+	.byte	0x6b
+	.byte	0x3
+	.long	0x164
+	.uleb128 0x16
+	.byte	0x50
+	.byte	0x5
+	.byte	0x78
+	.byte	0x9
+	.long	0x1e1
+	.uleb128 0x13
+	.string	"XtY"
+	.byte	0x5
+	.byte	0x79
+	.byte	0xb
+	.long	0x1e1
+	.byte	0
+	.uleb128 0x13
+	.string	"XtX"
+	.byte	0x5
+	.byte	0x7a
+	.byte	0xb
+	.long	0x1f1
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0x1f1
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0x207
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1410
+	.byte	0x5
+	.byte	0x7b
+	.byte	0x3
+	.long	0x1bd
+	.uleb128 0x16
+	.byte	0xc
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x5
+	.long	0x23e
+	.uleb128 0x13
+	.string	"x"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0xe
+	.long	0xb7
+	.byte	0
+	.uleb128 0x13
+	.string	"y"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x10
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x13
+	.string	"z"
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x12
+	.long	0xb7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x6
+	.byte	0x19
+	.long	0x254
+	.uleb128 0x1d
+	.string	"v"
+	.byte	0x6
+	.byte	0x1a
+	.long	0x143
+	.uleb128 0x24
+	.long	0x213
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1411
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x23e
+	.uleb128 0x16
+	.byte	0x24
+	.byte	0x6
+	.byte	0x20
+	.byte	0x9
+	.long	0x275
+	.uleb128 0x13
+	.string	"m"
+	.byte	0x6
+	.byte	0x21
+	.byte	0xb
+	.long	0x275
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xb7
+	.long	0x28b
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1412
+	.byte	0x6
+	.byte	0x22
+	.byte	0x3
+	.long	0x260
+	.uleb128 0x16
+	.byte	0x10
+	.byte	0x6
+	.byte	0x24
+	.byte	0x9
+	.long	0x2bb
+	.uleb128 0x12
+	.long	.LASF1413
+	.byte	0x6
+	.byte	0x25
+	.byte	0x11
+	.long	0x254
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1414
+	.byte	0x6
+	.byte	0x26
+	.byte	0xb
+	.long	0xb7
+	.byte	0xc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1415
+	.byte	0x6
+	.byte	0x27
+	.byte	0x3
+	.long	0x297
+	.uleb128 0x18
+	.long	0x2bb
+	.uleb128 0x1a
+	.long	.LASF1416
+	.byte	0x7
+	.byte	0x8c
+	.byte	0xf
+	.long	0xb7
+	.long	0x2e7
+	.uleb128 0x14
+	.long	0xb7
+	.uleb128 0x14
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1417
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.long	0x7e
+	.long	0x307
+	.uleb128 0x14
+	.long	0x7e
+	.uleb128 0x14
+	.long	0x307
+	.uleb128 0x14
+	.long	0xab
+	.byte	0
+	.uleb128 0xe
+	.long	0x30c
+	.uleb128 0x25
+	.uleb128 0x1a
+	.long	.LASF1418
+	.byte	0x7
+	.byte	0x8f
+	.byte	0xe
+	.long	0xb7
+	.long	0x323
+	.uleb128 0x14
+	.long	0xb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1420
+	.value	0x202
+	.byte	0x7
+	.long	0xb7
+	.long	0x34a
+	.uleb128 0x7
+	.string	"x"
+	.value	0x202
+	.byte	0x1d
+	.long	0xbe
+	.uleb128 0x8
+	.long	.LASF1419
+	.value	0x202
+	.byte	0x2c
+	.long	0xbe
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1421
+	.value	0x1f6
+	.byte	0x5
+	.long	0x38b
+	.long	0x38b
+	.uleb128 0x8
+	.long	.LASF1422
+	.value	0x1f6
+	.byte	0x3f
+	.long	0x392
+	.uleb128 0x8
+	.long	.LASF1423
+	.value	0x1f6
+	.byte	0x4c
+	.long	0x397
+	.uleb128 0x1
+	.long	.LASF1424
+	.value	0x1f8
+	.byte	0xb
+	.long	0x1e1
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1fb
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1425
+	.uleb128 0xe
+	.long	0x207
+	.uleb128 0xe
+	.long	0xb7
+	.uleb128 0x10
+	.long	.LASF1426
+	.value	0x1ea
+	.byte	0x5
+	.long	0x38b
+	.long	0x3dd
+	.uleb128 0x8
+	.long	.LASF1422
+	.value	0x1ea
+	.byte	0x40
+	.long	0x392
+	.uleb128 0x8
+	.long	.LASF1423
+	.value	0x1ea
+	.byte	0x4d
+	.long	0x397
+	.uleb128 0x1
+	.long	.LASF1424
+	.value	0x1ec
+	.byte	0xb
+	.long	0x1e1
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1ef
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1427
+	.value	0x1de
+	.byte	0x5
+	.long	0x38b
+	.long	0x406
+	.uleb128 0x8
+	.long	.LASF1423
+	.value	0x1de
+	.byte	0x31
+	.long	0x406
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1e1
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0xbe
+	.uleb128 0x1e
+	.long	.LASF1430
+	.value	0x1d0
+	.long	0x449
+	.uleb128 0x7
+	.string	"A"
+	.value	0x1d0
+	.byte	0x2e
+	.long	0x449
+	.uleb128 0x7
+	.string	"x"
+	.value	0x1d0
+	.byte	0x3d
+	.long	0x397
+	.uleb128 0x7
+	.string	"b"
+	.value	0x1d0
+	.byte	0x49
+	.long	0x397
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1d1
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x3
+	.string	"y"
+	.value	0x1d2
+	.byte	0xb
+	.long	0x1e1
+	.byte	0
+	.uleb128 0xe
+	.long	0x1e1
+	.uleb128 0x15
+	.long	.LASF1428
+	.value	0x1c3
+	.long	0x48d
+	.uleb128 0x7
+	.string	"LR"
+	.value	0x1c3
+	.byte	0x33
+	.long	0x449
+	.uleb128 0x7
+	.string	"x"
+	.value	0x1c3
+	.byte	0x43
+	.long	0x397
+	.uleb128 0x7
+	.string	"y"
+	.value	0x1c3
+	.byte	0x4f
+	.long	0x397
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1c4
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1c4
+	.byte	0xc
+	.long	0x70
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1429
+	.value	0x1b8
+	.long	0x4cc
+	.uleb128 0x7
+	.string	"LR"
+	.value	0x1b8
+	.byte	0x32
+	.long	0x449
+	.uleb128 0x7
+	.string	"y"
+	.value	0x1b8
+	.byte	0x42
+	.long	0x397
+	.uleb128 0x7
+	.string	"b"
+	.value	0x1b8
+	.byte	0x4e
+	.long	0x397
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1b9
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1b9
+	.byte	0xc
+	.long	0x70
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1431
+	.value	0x1a4
+	.long	0x50c
+	.uleb128 0x7
+	.string	"mat"
+	.value	0x1a4
+	.byte	0x2d
+	.long	0x449
+	.uleb128 0x3
+	.string	"n"
+	.value	0x1a5
+	.byte	0xd
+	.long	0x9f
+	.uleb128 0x3
+	.string	"i"
+	.value	0x1a6
+	.byte	0x9
+	.long	0x70
+	.uleb128 0x3
+	.string	"j"
+	.value	0x1a6
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x3
+	.string	"k"
+	.value	0x1a6
+	.byte	0xf
+	.long	0x70
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1432
+	.value	0x197
+	.long	0x562
+	.uleb128 0x8
+	.long	.LASF1422
+	.value	0x197
+	.byte	0x50
+	.long	0x392
+	.uleb128 0x8
+	.long	.LASF1413
+	.value	0x197
+	.byte	0x5b
+	.long	0x70
+	.uleb128 0x8
+	.long	.LASF1433
+	.value	0x197
+	.byte	0x69
+	.long	0x562
+	.uleb128 0x8
+	.long	.LASF1434
+	.value	0x197
+	.byte	0x78
+	.long	0x70
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x199
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1435
+	.value	0x19a
+	.byte	0xf
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x93
+	.uleb128 0x15
+	.long	.LASF1436
+	.value	0x17a
+	.long	0x597
+	.uleb128 0x8
+	.long	.LASF1422
+	.value	0x17a
+	.byte	0x51
+	.long	0x392
+	.uleb128 0x8
+	.long	.LASF1433
+	.value	0x17a
+	.byte	0x60
+	.long	0x562
+	.uleb128 0x1
+	.long	.LASF1437
+	.value	0x190
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1438
+	.value	0x16f
+	.long	0x5c7
+	.uleb128 0x8
+	.long	.LASF1422
+	.value	0x16f
+	.byte	0x3d
+	.long	0x392
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x171
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"j"
+	.value	0x172
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1439
+	.value	0x163
+	.long	0x60f
+	.uleb128 0x8
+	.long	.LASF1440
+	.value	0x163
+	.byte	0x1d
+	.long	0x562
+	.uleb128 0x8
+	.long	.LASF1441
+	.value	0x163
+	.byte	0x2c
+	.long	0x562
+	.uleb128 0x8
+	.long	.LASF1442
+	.value	0x163
+	.byte	0x3d
+	.long	0x562
+	.uleb128 0x8
+	.long	.LASF1443
+	.value	0x163
+	.byte	0x49
+	.long	0x70
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"i"
+	.value	0x165
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1444
+	.value	0x154
+	.byte	0x9
+	.long	0x93
+	.long	0x786
+	.uleb128 0x7
+	.string	"v"
+	.value	0x154
+	.byte	0x26
+	.long	0x562
+	.uleb128 0x3
+	.string	"p"
+	.value	0x156
+	.byte	0xd
+	.long	0x786
+	.uleb128 0x2
+	.long	0x645
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x159
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x657
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x159
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x669
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x159
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x67b
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15a
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x68d
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15a
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x69f
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15a
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x6b1
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15b
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x6c3
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15b
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x6d5
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15b
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x6e7
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15c
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x6f9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15c
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x70b
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15c
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x71d
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15d
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x72f
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15d
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x741
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15d
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x753
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15e
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x765
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15e
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x777
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15e
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x15f
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x93
+	.long	0x796
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1446
+	.value	0x147
+	.byte	0x9
+	.long	0x93
+	.long	0x8a1
+	.uleb128 0x7
+	.string	"v"
+	.value	0x147
+	.byte	0x26
+	.long	0x562
+	.uleb128 0x3
+	.string	"p"
+	.value	0x149
+	.byte	0xd
+	.long	0x8a1
+	.uleb128 0x2
+	.long	0x7cc
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14c
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x7de
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14c
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x7f0
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14c
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x802
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14d
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x814
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14d
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x826
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14d
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x838
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14e
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x84a
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14e
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x85c
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14e
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x86e
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14f
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x880
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14f
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x892
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x14f
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x150
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x93
+	.long	0x8b1
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1447
+	.value	0x13c
+	.byte	0x9
+	.long	0x87
+	.long	0x950
+	.uleb128 0x7
+	.string	"v"
+	.value	0x13c
+	.byte	0x29
+	.long	0x950
+	.uleb128 0x3
+	.string	"p"
+	.value	0x13e
+	.byte	0xd
+	.long	0x955
+	.uleb128 0x2
+	.long	0x8e7
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x141
+	.byte	0x24
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0x8f9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x141
+	.byte	0x78
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0x90b
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x141
+	.byte	0xcc
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0x91d
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x142
+	.byte	0x24
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0x92f
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x142
+	.byte	0x78
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0x941
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x142
+	.byte	0xcc
+	.long	0x87
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x143
+	.byte	0x24
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x87
+	.uleb128 0xf
+	.long	0x87
+	.long	0x965
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1448
+	.value	0x131
+	.byte	0x9
+	.long	0x93
+	.long	0xa04
+	.uleb128 0x7
+	.string	"v"
+	.value	0x131
+	.byte	0x26
+	.long	0x562
+	.uleb128 0x3
+	.string	"p"
+	.value	0x133
+	.byte	0xd
+	.long	0xa04
+	.uleb128 0x2
+	.long	0x99b
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x136
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x9ad
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x136
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x9bf
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x136
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x9d1
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x137
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x9e3
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x137
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0x9f5
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x137
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x138
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x93
+	.long	0xa14
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1449
+	.value	0x128
+	.byte	0x9
+	.long	0x87
+	.long	0xa6b
+	.uleb128 0x7
+	.string	"v"
+	.value	0x128
+	.byte	0x29
+	.long	0x950
+	.uleb128 0x3
+	.string	"p"
+	.value	0x12a
+	.byte	0xd
+	.long	0xa6b
+	.uleb128 0x2
+	.long	0xa4a
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x12d
+	.byte	0x24
+	.long	0x87
+	.byte	0
+	.uleb128 0x2
+	.long	0xa5c
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x12d
+	.byte	0x78
+	.long	0x87
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x12d
+	.byte	0xcc
+	.long	0x87
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x87
+	.long	0xa7b
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1450
+	.value	0x11f
+	.byte	0x9
+	.long	0x93
+	.long	0xad2
+	.uleb128 0x7
+	.string	"v"
+	.value	0x11f
+	.byte	0x26
+	.long	0x562
+	.uleb128 0x3
+	.string	"p"
+	.value	0x121
+	.byte	0xd
+	.long	0xad2
+	.uleb128 0x2
+	.long	0xab1
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x124
+	.byte	0x24
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	0xac3
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x124
+	.byte	0x78
+	.long	0x93
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.long	.LASF1445
+	.value	0x124
+	.byte	0xcc
+	.long	0x93
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x93
+	.long	0xae2
+	.uleb128 0xc
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1451
+	.byte	0xf9
+	.long	0xba9
+	.uleb128 0x4
+	.long	.LASF1452
+	.byte	0xf9
+	.byte	0x2d
+	.long	0xba9
+	.uleb128 0x6
+	.string	"a"
+	.byte	0xf9
+	.byte	0x49
+	.long	0xbae
+	.uleb128 0x5
+	.long	.LASF1453
+	.byte	0xfb
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x5
+	.long	.LASF1454
+	.byte	0xfc
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x11
+	.string	"C"
+	.byte	0xfd
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x11
+	.string	"xC"
+	.byte	0xff
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"yC"
+	.value	0x100
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"zC"
+	.value	0x101
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"xxC"
+	.value	0x102
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"yyC"
+	.value	0x103
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"zzC"
+	.value	0x104
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"xyC"
+	.value	0x105
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"yzC"
+	.value	0x106
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"zxC"
+	.value	0x107
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"xs"
+	.value	0x108
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"ys"
+	.value	0x109
+	.byte	0x11
+	.long	0xbe
+	.uleb128 0x3
+	.string	"zs"
+	.value	0x10a
+	.byte	0x11
+	.long	0xbe
+	.byte	0
+	.uleb128 0xe
+	.long	0x28b
+	.uleb128 0xe
+	.long	0x2c7
+	.uleb128 0x17
+	.long	.LASF1455
+	.byte	0xdd
+	.long	0xc42
+	.uleb128 0x4
+	.long	.LASF1452
+	.byte	0xdd
+	.byte	0x2a
+	.long	0xba9
+	.uleb128 0x4
+	.long	.LASF1401
+	.byte	0xdd
+	.byte	0x44
+	.long	0xc42
+	.uleb128 0x5
+	.long	.LASF1456
+	.byte	0xdf
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1457
+	.byte	0xdf
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1458
+	.byte	0xdf
+	.byte	0x17
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1459
+	.byte	0xdf
+	.byte	0x1d
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1460
+	.byte	0xdf
+	.byte	0x23
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1461
+	.byte	0xdf
+	.byte	0x29
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1462
+	.byte	0xe0
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1463
+	.byte	0xe0
+	.byte	0x15
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1464
+	.byte	0xe0
+	.byte	0x1f
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1465
+	.byte	0xe0
+	.byte	0x29
+	.long	0xb7
+	.byte	0
+	.uleb128 0xe
+	.long	0x15f
+	.uleb128 0xb
+	.long	.LASF1466
+	.byte	0xd6
+	.byte	0x7
+	.long	0xb7
+	.long	0xc9e
+	.uleb128 0x6
+	.string	"x"
+	.byte	0xd6
+	.byte	0x19
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1467
+	.byte	0xd6
+	.byte	0x22
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1468
+	.byte	0xd6
+	.byte	0x30
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1469
+	.byte	0xd6
+	.byte	0x3e
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1470
+	.byte	0xd6
+	.byte	0x4d
+	.long	0xb7
+	.uleb128 0x11
+	.string	"a"
+	.byte	0xd7
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x11
+	.string	"b"
+	.byte	0xd8
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1471
+	.byte	0xd0
+	.byte	0x5
+	.long	0x70
+	.long	0xcf5
+	.uleb128 0x6
+	.string	"x"
+	.byte	0xd0
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1467
+	.byte	0xd0
+	.byte	0x1b
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1468
+	.byte	0xd0
+	.byte	0x27
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1469
+	.byte	0xd0
+	.byte	0x33
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1470
+	.byte	0xd0
+	.byte	0x40
+	.long	0x70
+	.uleb128 0x11
+	.string	"a"
+	.byte	0xd1
+	.byte	0xe
+	.long	0x77
+	.uleb128 0x11
+	.string	"b"
+	.byte	0xd2
+	.byte	0xe
+	.long	0x77
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1472
+	.byte	0xcb
+	.byte	0x7
+	.long	0xb7
+	.long	0xd10
+	.uleb128 0x4
+	.long	.LASF1473
+	.byte	0xcb
+	.byte	0x20
+	.long	0x87
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1474
+	.byte	0xc6
+	.byte	0x7
+	.long	0xb7
+	.long	0xd2b
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0xc6
+	.byte	0x25
+	.long	0xd2b
+	.byte	0
+	.uleb128 0xe
+	.long	0x1b1
+	.uleb128 0xb
+	.long	.LASF1475
+	.byte	0xc1
+	.byte	0x7
+	.long	0xb7
+	.long	0xd4b
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0xc1
+	.byte	0x1c
+	.long	0xd2b
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1476
+	.byte	0xb3
+	.long	0xd6a
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0xb3
+	.byte	0x17
+	.long	0xd2b
+	.uleb128 0x6
+	.string	"x"
+	.byte	0xb3
+	.byte	0x22
+	.long	0xb7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1477
+	.byte	0xae
+	.long	0xd80
+	.uleb128 0x6
+	.string	"dev"
+	.byte	0xae
+	.byte	0x18
+	.long	0xd2b
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1478
+	.byte	0xa4
+	.byte	0x7
+	.long	0xb7
+	.long	0xdb1
+	.uleb128 0x6
+	.string	"amt"
+	.byte	0xa4
+	.byte	0x18
+	.long	0xb7
+	.uleb128 0x6
+	.string	"low"
+	.byte	0xa4
+	.byte	0x23
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1479
+	.byte	0xa4
+	.byte	0x2e
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1480
+	.byte	0x9a
+	.byte	0x5
+	.long	0x70
+	.long	0xde2
+	.uleb128 0x6
+	.string	"amt"
+	.byte	0x9a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x6
+	.string	"low"
+	.byte	0x9a
+	.byte	0x1c
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1479
+	.byte	0x9a
+	.byte	0x25
+	.long	0x70
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1481
+	.byte	0x91
+	.byte	0x7
+	.long	0xb7
+	.long	0xe08
+	.uleb128 0x4
+	.long	.LASF1482
+	.byte	0x91
+	.byte	0x1d
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1483
+	.byte	0x91
+	.byte	0x2a
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1484
+	.byte	0x85
+	.byte	0x9
+	.long	0x93
+	.long	0xe3b
+	.uleb128 0x4
+	.long	.LASF1482
+	.byte	0x85
+	.byte	0x1f
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1483
+	.byte	0x85
+	.byte	0x2e
+	.long	0x93
+	.uleb128 0x9
+	.uleb128 0x5
+	.long	.LASF1485
+	.byte	0x87
+	.byte	0x2e
+	.long	0x93
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1486
+	.byte	0x7c
+	.byte	0x9
+	.long	0x93
+	.long	0xe56
+	.uleb128 0x4
+	.long	.LASF1414
+	.byte	0x7c
+	.byte	0x1c
+	.long	0x93
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1487
+	.byte	0x73
+	.byte	0x9
+	.long	0x93
+	.long	0xe71
+	.uleb128 0x4
+	.long	.LASF1414
+	.byte	0x73
+	.byte	0x1c
+	.long	0x93
+	.byte	0
+	.uleb128 0x26
+	.string	"gcd"
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x5
+	.long	0x70
+	.long	0xe98
+	.uleb128 0x6
+	.string	"num"
+	.byte	0x6a
+	.byte	0xd
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1488
+	.byte	0x6a
+	.byte	0x16
+	.long	0x70
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1489
+	.byte	0x5f
+	.byte	0x7
+	.long	0xb7
+	.long	0xec6
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x5f
+	.byte	0x19
+	.long	0xb7
+	.uleb128 0x11
+	.string	"xa"
+	.byte	0x61
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1423
+	.byte	0x62
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1490
+	.byte	0x44
+	.byte	0x7
+	.long	0xb7
+	.long	0xf3d
+	.uleb128 0x6
+	.string	"y"
+	.byte	0x44
+	.byte	0x1a
+	.long	0xb7
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x44
+	.byte	0x23
+	.long	0xb7
+	.uleb128 0x11
+	.string	"res"
+	.byte	0x4e
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1491
+	.byte	0x4e
+	.byte	0x10
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1492
+	.byte	0x4e
+	.byte	0x16
+	.long	0xb7
+	.uleb128 0x2
+	.long	0xf24
+	.uleb128 0x5
+	.long	.LASF1493
+	.byte	0x51
+	.byte	0x2f
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1494
+	.byte	0x51
+	.byte	0x51
+	.long	0xb7
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.long	.LASF1495
+	.byte	0x52
+	.byte	0x38
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1496
+	.byte	0x52
+	.byte	0x5a
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1497
+	.byte	0x3b
+	.byte	0x7
+	.long	0xb7
+	.long	0xf56
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x3b
+	.byte	0x18
+	.long	0xb7
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1498
+	.byte	0x9
+	.byte	0x2f
+	.byte	0x7
+	.long	0xb7
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x2f
+	.byte	0x18
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1499
+	.byte	0x31
+	.byte	0xd
+	.long	0x93
+	.uleb128 0x11
+	.string	"x2"
+	.byte	0x37
+	.byte	0xb
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF999
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1026
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x4
+	.file 39 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x28
+	.file 41 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 42 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 43 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1361
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1380
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF712
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF991
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1119
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1163
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1289
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1312
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1313
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1359
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1501
+	.long	.LASF1502
+	.long	.LASF1503
+	.long	.LASF1504
+	.long	.LASF1505
+	.long	.LASF1506
+	.long	.LASF1507
+	.long	.LASF1508
+	.long	.LASF1509
+	.long	.LASF1510
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1511
+	.byte	0x6
+	.long	.LASF1512
+	.byte	0x6
+	.long	.LASF1513
+	.byte	0x6
+	.long	.LASF1514
+	.byte	0xa
+	.long	.LASF1515
+	.byte	0x1
+	.long	.LASF1516
+	.byte	0x1
+	.long	.LASF1517
+	.byte	0x6
+	.long	.LASF1518
+	.byte	0x9
+	.long	.LASF1519
+	.byte	0x1
+	.long	.LASF1520
+	.byte	0x1
+	.long	.LASF1521
+	.byte	0x9
+	.long	.LASF1522
+	.byte	0xa
+	.long	.LASF1522
+	.byte	0x9
+	.long	.LASF1523
+	.byte	0x6
+	.long	.LASF1524
+	.byte	0x9
+	.long	.LASF1525
+	.byte	0x9
+	.long	.LASF1526
+	.byte	0x6
+	.long	.LASF1527
+	.byte	0x6
+	.long	.LASF1528
+	.byte	0x8
+	.long	.LASF1529
+	.byte	0x6
+	.long	.LASF1530
+	.byte	0x7
+	.long	.LASF1531
+	.byte	0x7
+	.long	.LASF1532
+	.byte	0x6
+	.long	.LASF1533
+	.byte	0x6
+	.long	.LASF1534
+	.byte	0x6
+	.long	.LASF1535
+	.byte	0x5
+	.long	.LASF1536
+	.byte	0x5
+	.long	.LASF1537
+	.byte	0x9
+	.long	.LASF1538
+	.byte	0x9
+	.long	.LASF1539
+	.byte	0x6
+	.long	.LASF1540
+	.byte	0x6
+	.long	.LASF1541
+	.byte	0x6
+	.long	.LASF1542
+	.byte	0x6
+	.long	.LASF1543
+	.byte	0x6
+	.long	.LASF1544
+	.byte	0x6
+	.long	.LASF1545
+	.byte	0x6
+	.long	.LASF1546
+	.byte	0x6
+	.long	.LASF1547
+	.byte	0xa
+	.long	.LASF1548
+	.byte	0x1
+	.long	.LASF1549
+	.byte	0x4
+	.long	.LASF1550
+	.byte	0x3
+	.long	.LASF1551
+	.byte	0x2
+	.long	.LASF1552
+	.byte	0x3
+	.long	.LASF1553
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1219:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1319:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF753:
+	.string	"__DECL_SIMD_logf "
+.LASF1192:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1099:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF986:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1168:
+	.string	"USE_RX_PPM "
+.LASF1297:
+	.string	"USE_BARO "
+.LASF1222:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF969:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1280:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1242:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF862:
+	.string	"__DECL_SIMD_sinh "
+.LASF1130:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1304:
+	.string	"USE_UART7 "
+.LASF1204:
+	.string	"USE_PITOT_MS4525 "
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF790:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF1243:
+	.string	"USE_SERIALRX_CRSF "
+.LASF926:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF906:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF763:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1174:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF982:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1223:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1406:
+	.string	"m_newM"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1386:
+	.string	"__uint8_t"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1408:
+	.string	"m_newS"
+.LASF1428:
+	.string	"sensorCalibration_BackwardSubstitution"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1425:
+	.string	"_Bool"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF721:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1305:
+	.string	"USE_UART8 "
+.LASF1341:
+	.string	"U_ID_2 2"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1031:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1413:
+	.string	"axis"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1314:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1358:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1015:
+	.string	"__f32x(x) x ##f32x"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF767:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1272:
+	.string	"__WCHAR_T__ "
+.LASF1143:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF904:
+	.string	"__DECL_SIMD_log2l "
+.LASF1169:
+	.string	"USE_SERIAL_RX "
+.LASF1414:
+	.string	"angle"
+.LASF933:
+	.string	"__DECL_SIMD_acoshf "
+.LASF738:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1226:
+	.string	"USE_CMS "
+.LASF911:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF864:
+	.string	"__DECL_SIMD_sinhl "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF726:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1252:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF764:
+	.string	"__DECL_SIMD_expl "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1139:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF1032:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF745:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1254:
+	.string	"USE_CLI_BATCH "
+.LASF1094:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF720:
+	.string	"_MATH_H 1"
+.LASF1347:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1261:
+	.string	"_T_PTRDIFF_ "
+.LASF1164:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1376:
+	.string	"atanPolyCoef5 0.05030176425872175f"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF734:
+	.string	"__DECL_SIMD_sinl "
+.LASF1308:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1109:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1158:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1309:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1271:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF755:
+	.string	"__DECL_SIMD_logf16 "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF1371:
+	.string	"sinPolyCoef9 2.600054768e-6f"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1016:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF811:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF754:
+	.string	"__DECL_SIMD_logl "
+.LASF1466:
+	.string	"scaleRangef"
+.LASF1491:
+	.string	"absX"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1214:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF991:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF706:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1321:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF762:
+	.string	"__DECL_SIMD_exp "
+.LASF972:
+	.string	"__DECL_SIMD_erfc "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF854:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1046:
+	.string	"_Mdouble_"
+.LASF1393:
+	.string	"int32_t"
+.LASF994:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1129:
+	.string	"FAST_MATH "
+.LASF1092:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF946:
+	.string	"__DECL_SIMD_erff32 "
+.LASF718:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1313:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1417:
+	.string	"memcpy"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1471:
+	.string	"scaleRange"
+.LASF1332:
+	.string	"USE_RX_PPM"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF508:
+	.string	"__always_inline"
+.LASF828:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF947:
+	.string	"__DECL_SIMD_erff64 "
+.LASF861:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF860:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1047:
+	.string	"__MATH_PRECNAME"
+.LASF897:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1249:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1352:
+	.string	"FAST_CODE "
+.LASF1057:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF825:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF829:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1326:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1050:
+	.string	"_Mdouble_ float"
+.LASF1457:
+	.string	"sinx"
+.LASF1459:
+	.string	"siny"
+.LASF1461:
+	.string	"sinz"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1034:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1210:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF699:
+	.string	"_T_SIZE_ "
+.LASF1295:
+	.string	"USE_FAKE_GPS "
+.LASF1040:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1157:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1409:
+	.string	"stdev_t"
+.LASF934:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1083:
+	.string	"__MATHCALL_NARROW"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1211:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1068:
+	.string	"__MATHDECL_1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1060:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF943:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF710:
+	.string	"_GCC_SIZE_T "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF1004:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1145:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF886:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1440:
+	.string	"dest"
+.LASF1401:
+	.string	"angles"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF548:
+	.string	"__stub_stty "
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF915:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF810:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF822:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1035:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1236:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF840:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1175:
+	.string	"USE_ADC_AVERAGING "
+.LASF1095:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF951:
+	.string	"__DECL_SIMD_erff128x "
+.LASF996:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF707:
+	.string	"_SIZE_T_DECLARED "
+.LASF1246:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1442:
+	.string	"array2"
+.LASF1154:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF847:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1337:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1273:
+	.string	"_WCHAR_T "
+.LASF923:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF781:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1474:
+	.string	"devStandardDeviation"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1398:
+	.string	"roll"
+.LASF1267:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1387:
+	.string	"__int16_t"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1019:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1473:
+	.string	"degrees"
+.LASF1454:
+	.string	"cang"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1126:
+	.string	"false 0"
+.LASF848:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1424:
+	.string	"beta"
+.LASF815:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1343:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF358:
+	.string	"__k8 1"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF1283:
+	.string	"__INT_WCHAR_T_H "
+.LASF1375:
+	.string	"atanPolyCoef4 0.3099814292351353f"
+.LASF893:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1105:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF787:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF849:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1419:
+	.string	"curveWidth"
+.LASF957:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF778:
+	.string	"__DECL_SIMD_powf128 "
+.LASF819:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1097:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1120:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1213:
+	.string	"USE_OLED_UG2864 "
+.LASF1112:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1230:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1253:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1377:
+	.string	"atanPolyCoef6 0.1471039133652469f"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1153:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1381:
+	.string	"unsigned char"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF910:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1025:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1268:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1142:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1183:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1180:
+	.string	"USE_NAV "
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1353:
+	.string	"NOINLINE "
+.LASF1396:
+	.string	"float"
+.LASF1493:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1495:
+	.string	"_left2"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1351:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF1282:
+	.string	"___int_wchar_t_h "
+.LASF1070:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF944:
+	.string	"__DECL_SIMD_erfl "
+.LASF884:
+	.string	"__DECL_SIMD_atan2l "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1492:
+	.string	"absY"
+.LASF805:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1260:
+	.string	"_PTRDIFF_T "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1462:
+	.string	"coszcosx"
+.LASF1434:
+	.string	"target"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1191:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF901:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1432:
+	.string	"sensorCalibrationPushSampleForScaleCalculation"
+.LASF719:
+	.string	"_STRINGS_H 1"
+.LASF1121:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF1178:
+	.string	"USE_GPS "
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1475:
+	.string	"devVariance"
+.LASF507:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1173:
+	.string	"USE_SERIALRX_FPORT "
+.LASF795:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1098:
+	.string	"MATH_ERRNO 1"
+.LASF1346:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1448:
+	.string	"quickMedianFilter5"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1446:
+	.string	"quickMedianFilter7"
+.LASF1444:
+	.string	"quickMedianFilter9"
+.LASF1479:
+	.string	"high"
+.LASF1338:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1054:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1091:
+	.string	"FP_NORMAL 4"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1279:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1476:
+	.string	"devPush"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1077:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1241:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1042:
+	.string	"_Mdouble_ double"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF1360:
+	.string	"__FAST_MATH__ 1"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF924:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF376:
+	.string	"unix 1"
+.LASF916:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF975:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1064:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1336:
+	.string	"USE_ITCM_RAM"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1005:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1281:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1044:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1481:
+	.string	"fapplyDeadbandf"
+.LASF1290:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1373:
+	.string	"atanPolyCoef2 0.99997356613987f"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1482:
+	.string	"value"
+.LASF1237:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF731:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF894:
+	.string	"__DECL_SIMD_log10l "
+.LASF1329:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1324:
+	.string	"USE_PITOT_ADC"
+.LASF771:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1217:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF917:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF722:
+	.string	"__DECL_SIMD_cos "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1199:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF1372:
+	.string	"atanPolyCoef1 3.14551665884836e-07f"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF900:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF803:
+	.string	"__DECL_SIMD_asinf "
+.LASF1203:
+	.string	"USE_OPFLOW_MSP "
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF697:
+	.string	"_SIZE_T "
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1045:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1058:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF770:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF761:
+	.string	"__DECL_SIMD_logf128x "
+.LASF723:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1127:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1427:
+	.string	"sensorCalibrationValidateResult"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF709:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1111:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF704:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1155:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1108:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1395:
+	.string	"size_t"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1394:
+	.string	"uint8_t"
+.LASF1490:
+	.string	"atan2_approx"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF1193:
+	.string	"USE_RX_UIB "
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1067:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1048:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF788:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1453:
+	.string	"sang"
+.LASF1163:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF962:
+	.string	"__DECL_SIMD_asinh "
+.LASF1330:
+	.string	"USE_ADC"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1284:
+	.string	"_GCC_WCHAR_T "
+.LASF1115:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF990:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1350:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF789:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1364:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF693:
+	.string	"__need_size_t "
+.LASF1088:
+	.string	"FP_INFINITE 1"
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF732:
+	.string	"__DECL_SIMD_sin "
+.LASF1198:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1259:
+	.string	"_ANSI_STDDEF_H "
+.LASF1488:
+	.string	"denom"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF1287:
+	.string	"_BSD_WCHAR_T_"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF998:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1315:
+	.string	"USE_SERVO_SBUS"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF702:
+	.string	"_SIZE_T_ "
+.LASF1331:
+	.string	"USE_VCP"
+.LASF1093:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF713:
+	.string	"__need_size_t"
+.LASF775:
+	.string	"__DECL_SIMD_powf16 "
+.LASF806:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1023:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1144:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1224:
+	.string	"USE_LOG "
+.LASF1049:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1429:
+	.string	"sensorCalibration_ForwardSubstitution"
+.LASF1257:
+	.string	"_STDDEF_H "
+.LASF929:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1294:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1123:
+	.string	"_STDBOOL_H "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1368:
+	.string	"sinPolyCoef3 -1.666665710e-1f"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1477:
+	.string	"devClear"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF760:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1051:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1345:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF1188:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF919:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF855:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1187:
+	.string	"USE_PITOT_ADC "
+.LASF1369:
+	.string	"sinPolyCoef5 8.333017292e-3f"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1463:
+	.string	"sinzcosx"
+.LASF1500:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF997:
+	.string	"__f128(x) x ##f128"
+.LASF935:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1053:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1156:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF804:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF983:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF1162:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1333:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF724:
+	.string	"__DECL_SIMD_cosl "
+.LASF842:
+	.string	"__DECL_SIMD_cosh "
+.LASF1208:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1036:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF714:
+	.string	"NULL"
+.LASF1194:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1052:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1404:
+	.string	"stdev_s"
+.LASF1399:
+	.string	"pitch"
+.LASF1244:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF461:
+	.string	"__PMT"
+.LASF1285:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1202:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1189:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF950:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1104:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF903:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF952:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1464:
+	.string	"coszsinx"
+.LASF752:
+	.string	"__DECL_SIMD_log "
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF995:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1465:
+	.string	"sinzsinx"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1149:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1250:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1185:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1325:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF892:
+	.string	"__DECL_SIMD_log10 "
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF801:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF1277:
+	.string	"_WCHAR_T_ "
+.LASF1379:
+	.string	"QMF_SORT(type,a,b) { if ((a)>(b)) QMF_SWAP(type, (a),(b)); }"
+.LASF800:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF471:
+	.string	"__P(args) args"
+.LASF1011:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF740:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF698:
+	.string	"_SYS_SIZE_T_H "
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1061:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1423:
+	.string	"result"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1436:
+	.string	"sensorCalibrationPushSampleForOffsetCalculation"
+.LASF1170:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF857:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF914:
+	.string	"__DECL_SIMD_log1pl "
+.LASF796:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF746:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF716:
+	.string	"__need_NULL"
+.LASF1289:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1063:
+	.string	"_Mdouble_ _Float32x"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1328:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF863:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1026:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF808:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF776:
+	.string	"__DECL_SIMD_powf32 "
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF907:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF792:
+	.string	"__DECL_SIMD_atan "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1069:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1196:
+	.string	"USE_RANGEFINDER "
+.LASF1152:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF809:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF912:
+	.string	"__DECL_SIMD_log1p "
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF692:
+	.string	"_STRING_H 1"
+.LASF984:
+	.string	"__DECL_SIMD_tanl "
+.LASF839:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1392:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1354:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1382:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1385:
+	.string	"signed char"
+.LASF1012:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF757:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1231:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1445:
+	.string	"temp"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF695:
+	.string	"__size_t__ "
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF1085:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1132:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1494:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1496:
+	.string	"_right3"
+.LASF936:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF940:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1128:
+	.string	"sq(x) ((x)*(x))"
+.LASF736:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF908:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1443:
+	.string	"count"
+.LASF1197:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1499:
+	.string	"xint"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF1014:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF703:
+	.string	"_BSD_SIZE_T_ "
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1316:
+	.string	"USE_DASHBOARD"
+.LASF1251:
+	.string	"USE_VTX_FFPV "
+.LASF1116:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1003:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1221:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1344:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1055:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1422:
+	.string	"state"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF965:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1356:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1100:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1167:
+	.string	"USE_I2C_PULLUP "
+.LASF821:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1362:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF758:
+	.string	"__DECL_SIMD_logf128 "
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1291:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1119:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1107:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1033:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1172:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF749:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1437:
+	.string	"squareSum"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1013:
+	.string	"__f32(x) x ##f32"
+.LASF1486:
+	.string	"wrap_36000"
+.LASF993:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1089:
+	.string	"FP_ZERO 2"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF765:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1327:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF1323:
+	.string	"USE_PITOT_MS4525"
+.LASF909:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1415:
+	.string	"fpAxisAngle_t"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1270:
+	.string	"__need_ptrdiff_t"
+.LASF1002:
+	.string	"__HAVE_FLOAT64 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1228:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF1390:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF756:
+	.string	"__DECL_SIMD_logf32 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1232:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF868:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1484:
+	.string	"applyDeadband"
+.LASF1334:
+	.string	"USE_RCDEVICE"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1134:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1497:
+	.string	"cos_approx"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF1264:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1263:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF869:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1037:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1365:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF872:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1451:
+	.string	"rotationMatrixFromAxisAngle"
+.LASF1043:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF701:
+	.string	"__SIZE_T "
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1340:
+	.string	"U_ID_1 1"
+.LASF1017:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1110:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1420:
+	.string	"bellCurve"
+.LASF902:
+	.string	"__DECL_SIMD_log2 "
+.LASF1161:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF921:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1456:
+	.string	"cosx"
+.LASF1458:
+	.string	"cosy"
+.LASF700:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1018:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1072:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF484:
+	.string	"__flexarr []"
+.LASF1020:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF772:
+	.string	"__DECL_SIMD_pow "
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF1455:
+	.string	"rotationMatrixFromAngles"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1256:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1106:
+	.string	"M_PI 3.14159265358979323846"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1274:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1227:
+	.string	"CMS_MENU_OSD "
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF741:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1374:
+	.string	"atanPolyCoef3 0.14744007058297684f"
+.LASF1286:
+	.string	"__DEFINED_wchar_t "
+.LASF1402:
+	.string	"fp_angles_t"
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF1118:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF807:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1186:
+	.string	"USE_PITOT "
+.LASF1176:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1469:
+	.string	"destMin"
+.LASF1248:
+	.string	"USE_VTX_CONTROL "
+.LASF1410:
+	.string	"sensorCalibrationState_t"
+.LASF1391:
+	.string	"char"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF898:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF958:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF728:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1141:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF895:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF812:
+	.string	"__DECL_SIMD_hypot "
+.LASF1028:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF852:
+	.string	"__DECL_SIMD_expm1 "
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1234:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF727:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF899:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF791:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1151:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1238:
+	.string	"USE_RX_MSP "
+.LASF1159:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1125:
+	.string	"true 1"
+.LASF729:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1200:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF783:
+	.string	"__DECL_SIMD_acosf "
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF705:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF769:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1206:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF1147:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1001:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1426:
+	.string	"sensorCalibrationSolveForOffset"
+.LASF712:
+	.string	"__size_t "
+.LASF694:
+	.string	"__need_NULL "
+.LASF871:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1122:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1430:
+	.string	"sensorCalibration_SolveLGS"
+.LASF1201:
+	.string	"USE_OPFLOW "
+.LASF978:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1292:
+	.string	"USE_IMU_FAKE "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF715:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF963:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF939:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1438:
+	.string	"sensorCalibrationResetState"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1171:
+	.string	"USE_SERIALRX_SBUS "
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1293:
+	.string	"USE_FAKE_BARO "
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1059:
+	.string	"_Mdouble_ _Float64"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF833:
+	.string	"__DECL_SIMD_exp10f "
+.LASF766:
+	.string	"__DECL_SIMD_expf32 "
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1288:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1022:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1262:
+	.string	"_T_PTRDIFF "
+.LASF797:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF989:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF932:
+	.string	"__DECL_SIMD_acosh "
+.LASF988:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1179:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1084:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1117:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1087:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1363:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1233:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1439:
+	.string	"arraySubInt32"
+.LASF1190:
+	.string	"USE_GYRO_KALMAN "
+.LASF845:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF942:
+	.string	"__DECL_SIMD_erf "
+.LASF1103:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1489:
+	.string	"acos_approx"
+.LASF1138:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1435:
+	.string	"scaledSample"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF782:
+	.string	"__DECL_SIMD_acos "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF853:
+	.string	"__DECL_SIMD_expm1f "
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF759:
+	.string	"__DECL_SIMD_logf32x "
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1367:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1184:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF913:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1114:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1397:
+	.string	"double"
+.LASF1320:
+	.string	"USE_RANGEFINDER"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF785:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1041:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1485:
+	.string	"_abs4"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF955:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF959:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1278:
+	.string	"_BSD_WCHAR_T_ "
+.LASF830:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1166:
+	.string	"I2C2_OVERCLOCK false"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1349:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1102:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1389:
+	.string	"__int32_t"
+.LASF1029:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1096:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF793:
+	.string	"__DECL_SIMD_atanf "
+.LASF418:
+	.string	"__USE_GNU"
+.LASF836:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1378:
+	.string	"atanPolyCoef7 0.6444640676891548f"
+.LASF1229:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF784:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF999:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1460:
+	.string	"cosz"
+.LASF1038:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1212:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF920:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF773:
+	.string	"__DECL_SIMD_powf "
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1275:
+	.string	"_T_WCHAR "
+.LASF779:
+	.string	"__DECL_SIMD_powf32x "
+.LASF711:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1380:
+	.string	"QMF_SWAP(type,a,b) { type temp=(a);(a)=(b);(b)=temp; }"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1258:
+	.string	"_STDDEF_H_ "
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF802:
+	.string	"__DECL_SIMD_asin "
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1071:
+	.string	"__MATHCALL"
+.LASF896:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF964:
+	.string	"__DECL_SIMD_asinhl "
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF844:
+	.string	"__DECL_SIMD_coshl "
+.LASF1225:
+	.string	"USE_STATS "
+.LASF1296:
+	.string	"USE_MAG "
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF949:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF922:
+	.string	"__DECL_SIMD_atanh "
+.LASF735:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1030:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF834:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1470:
+	.string	"destMax"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1265:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1276:
+	.string	"__WCHAR_T "
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF851:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF813:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF987:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF747:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1452:
+	.string	"rmat"
+.LASF1266:
+	.string	"___int_ptrdiff_t_h "
+.LASF798:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1090:
+	.string	"FP_SUBNORMAL 3"
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1447:
+	.string	"quickMedianFilter5_16"
+.LASF1065:
+	.string	"_Mdouble_ _Float64x"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1339:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF777:
+	.string	"__DECL_SIMD_powf64 "
+.LASF1403:
+	.string	"fp_angles"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF743:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1218:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1450:
+	.string	"quickMedianFilter3"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF799:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1165:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF1433:
+	.string	"sample"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF823:
+	.string	"__DECL_SIMD_exp2f "
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF739:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1021:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1000:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1195:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF992:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1220:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1342:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1056:
+	.string	"_Mdouble_ _Float32"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1317:
+	.string	"USE_OLED_UG2864"
+.LASF945:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1255:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1355:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1310:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF850:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1239:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1182:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1370:
+	.string	"sinPolyCoef7 -1.980661520e-4f"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF832:
+	.string	"__DECL_SIMD_exp10 "
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF846:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF820:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1449:
+	.string	"quickMedianFilter3_16"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1366:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF737:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF1245:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1205:
+	.string	"USE_1WIRE "
+.LASF953:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1405:
+	.string	"m_oldM"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF985:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1407:
+	.string	"m_oldS"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1498:
+	.string	"sin_approx"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF780:
+	.string	"__DECL_SIMD_powf64x "
+.LASF730:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1472:
+	.string	"degreesToRadians"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1311:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF794:
+	.string	"__DECL_SIMD_atanl "
+.LASF1136:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF973:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1160:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1124:
+	.string	"bool _Bool"
+.LASF1357:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF925:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF905:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF948:
+	.string	"__DECL_SIMD_erff128 "
+.LASF831:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF865:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1177:
+	.string	"USE_BLACKBOX "
+.LASF786:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1131:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF873:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1181:
+	.string	"USE_TELEMETRY "
+.LASF774:
+	.string	"__DECL_SIMD_powl "
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF956:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1209:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1312:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1146:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1335:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1431:
+	.string	"sensorCalibration_gaussLR"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1066:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF708:
+	.string	"__DEFINED_size_t "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1298:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1467:
+	.string	"srcMin"
+.LASF1135:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1361:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1216:
+	.string	"USE_FRSKYOSD "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1113:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1306:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF814:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1240:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1487:
+	.string	"wrap_18000"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1384:
+	.string	"long unsigned int"
+.LASF1207:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1299:
+	.string	"USE_UART2 "
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF882:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1418:
+	.string	"sqrtf"
+.LASF1137:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF744:
+	.string	"__DECL_SIMD_sincosl "
+.LASF717:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1027:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1024:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1388:
+	.string	"short int"
+.LASF843:
+	.string	"__DECL_SIMD_coshf "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1150:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF824:
+	.string	"__DECL_SIMD_exp2l "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1300:
+	.string	"USE_UART3 "
+.LASF1140:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1039:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1359:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1412:
+	.string	"fpMat3_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF696:
+	.string	"__SIZE_T__ "
+.LASF1247:
+	.string	"USE_RCDEVICE "
+.LASF1235:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1148:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF1322:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1133:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1383:
+	.string	"unsigned int"
+.LASF1301:
+	.string	"USE_UART4 "
+.LASF816:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1400:
+	.string	"fp_angles_def"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1086:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1411:
+	.string	"fpVector3_t"
+.LASF1441:
+	.string	"array1"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF883:
+	.string	"__DECL_SIMD_atan2f "
+.LASF742:
+	.string	"__DECL_SIMD_sincos "
+.LASF954:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF835:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1483:
+	.string	"deadband"
+.LASF733:
+	.string	"__DECL_SIMD_sinf "
+.LASF885:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF768:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1302:
+	.string	"USE_UART5 "
+.LASF1416:
+	.string	"powf"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF1421:
+	.string	"sensorCalibrationSolveForScale"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1215:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF974:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1468:
+	.string	"srcMax"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1318:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1348:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1480:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1269:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF1101:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1307:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1478:
+	.string	"constrainf"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1303:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF874:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1546:
+	.string	"mathcalls-helper-functions.h"
+.LASF1538:
+	.string	"math.h"
+.LASF1529:
+	.string	"long-double.h"
+.LASF1536:
+	.string	"__locale_t.h"
+.LASF1549:
+	.string	"platform.h"
+.LASF1517:
+	.string	"mathcalls.h"
+.LASF1551:
+	.string	"target.h"
+.LASF1540:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1523:
+	.string	"libc-header-start.h"
+.LASF1503:
+	.string	"src/main/target"
+.LASF1539:
+	.string	"math-vector.h"
+.LASF1501:
+	.string	"src/main/common"
+.LASF1512:
+	.string	"stdint-intn.h"
+.LASF1520:
+	.string	"axis.h"
+.LASF1507:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1510:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1530:
+	.string	"stubs.h"
+.LASF1502:
+	.string	"src/main/target/SITL"
+.LASF1527:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1544:
+	.string	"fp-logb.h"
+.LASF1506:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1537:
+	.string	"strings.h"
+.LASF1525:
+	.string	"features-time64.h"
+.LASF1511:
+	.string	"types.h"
+.LASF1542:
+	.string	"floatn-common.h"
+.LASF1541:
+	.string	"floatn.h"
+.LASF1547:
+	.string	"stdbool.h"
+.LASF1509:
+	.string	"/usr/include"
+.LASF1552:
+	.string	"sanity_check.h"
+.LASF1524:
+	.string	"features.h"
+.LASF1550:
+	.string	"common.h"
+.LASF1532:
+	.string	"typesizes.h"
+.LASF1535:
+	.string	"locale_t.h"
+.LASF1533:
+	.string	"time64.h"
+.LASF1513:
+	.string	"stdint-uintn.h"
+.LASF1534:
+	.string	"wchar.h"
+.LASF0:
+	.string	"./src/main/common/maths.c"
+.LASF1543:
+	.string	"flt-eval-method.h"
+.LASF1504:
+	.string	"src/main"
+.LASF1528:
+	.string	"cdefs.h"
+.LASF1508:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1545:
+	.string	"fp-fast.h"
+.LASF1519:
+	.string	"maths.c"
+.LASF1548:
+	.string	"quaternion.h"
+.LASF1515:
+	.string	"maths.h"
+.LASF1518:
+	.string	"string.h"
+.LASF1505:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1522:
+	.string	"stdint.h"
+.LASF1514:
+	.string	"stddef.h"
+.LASF1531:
+	.string	"stubs-64.h"
+.LASF1516:
+	.string	"vector.h"
+.LASF1526:
+	.string	"wordsize.h"
+.LASF1553:
+	.string	"common_post.h"
+.LASF1521:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`}\005\325\r"
+	.string	"\024\026q\006"
+	.string	"("
+	.string	"\241\211\265\265\b\026\002"
+	.string	"\002\001\001\326\205\303\322\007"
+	.string	"\002\370\221\255\220\b"
+	.string	"\003\366\307\313\303\f"
+	.string	"\004\337\356\204\230\n"
+	.string	"\005\374\321\300\300\006"
+	.string	"\006\220\202\266\254\n"
+	.string	"\007\364\313\364\333\016"
+	.string	"\b\371\206\236\300\t"
+	.string	"\t\357\361\376x"
+	.string	"\n\274\321\244\251\n"
+	.string	"\013\375\314\246\210\005"
+	.string	"\f\335\315\224\246\016"
+	.string	"\r\016\311\306\366\330\017\002\002\002\002\003\017\376\266\352\345\r\026"
+	.string	"\020\333\261\333\204\016\004\021\330\371\264\274\003\022\336\374\300\216\003"
+	.string	"\023\344\323\237\263\007"
+	.string	"\024\241\224\222\275\004"
+	.string	"\025\345\347\236\251\016\030\002\004"
+	.string	"\002\005\026\276\313\275\344\004\032\002"
+	.string	"\002\006\002\007\027\252\336\226\344\r\030\002\002\002\b\b\002\b\030\371\240\314\230\013\030\002\t\002\n\n\002\n\031\215\352\331\353\t8\002\002\002\013\013\002\013\032\251\346\311\214\0078\002\t\002\f\f\002\f\033\373\305\323\202\001h\002\002\002\r\r\002\r\034\372\361\253\360\003\230\001\002\002\002\016\016\002\016\035\311\327\201[\006\002\017\036\370\241\210\202\005\004\002"
+	.string	"\002\020\037\265\307\376\375\fV \325\341\341\217\003\026!\325\331\233\354\007\f\002"
+	.string	"\001\"\221\366\364\377\f\022\001"
+	.string	"\001#\316\224\227\370\004\001$\320\312\206\356\013"
+	.string	"%\322\312\350\330\f\006\001\002\001&\206\201\237\274\001'\257\235\330\210\007"
+	.string	""
+	.ascii	"( \320\202\26356\206s\340J\313q\205F\035n1]\311d  \366\211\333"
+	.ascii	"\036'\221\006\230>\f7\301\340\205\373\002MBq\003\263\346,_\330"
+	.ascii	"3Y\255\215(\305H\025C\252\b)\301k\205\276\001\032\177\340a\022"
+	.ascii	"\235@\027\2310\372\375\005\266\r\224:\304+IsC"
+	.text
+	.section	.gnu.lto_.ipa_sra.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\337\001%\b"
+	.string	"\"J\037#\200U\35130\0033"
+	.string	"\020]&dB&"
+	.string	"\270\256\353\272\256\353\272\266\021\302\341\227\r\221\275\t\221)\245\0244\351\312|3'1\276X\240\002tS\362\252\276\257P\372\211\244\244#\205\364\036\216\006c\241\200\310\250\352\277\330\330Dkl\255e\312\207h\217]\217g\312\367\301p\207z'S\372\303Z\257\331\223{\021-\331m.\264\204\301\037\t\354"
+	.string	"\304\226\371\334\316\371\275\375\266\324\320\001\001K\250\02194\251\232\275\003\260\202\"\324\266\001\021\200)4Gj\024\026\025\344\001\b\310\360\353\365TY{\337\320t|:\250>\361"
+	.ascii	"\315*\225\314`K1:\365=K\326&\316Z\304\006\221\312\236)\2367\264"
+	.ascii	"y\315\372T\260\017\374\"\026k)\312u\001\231h;\20108\253\024\357"
+	.ascii	"J\331\377\260\2539([\261\027\272\231{\334%\bM;\341\371\244\305"
+	.ascii	"\270\340F\332\257e}\302\200\220f\377\fC%7\234\313r\006"
+	.text
+	.section	.gnu.lto_.inline.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`l\02051"
+	.string	"V\177\315I\240\230Q:\200\333\310C\344\\"
+	.string	"\221T\276\342\"\277C\347.{\277\f\\\204 \177H{\202\364S\001]\336\225\361r\224Z\337\370\366O\005<;\272xU\032\232\200\027\263\364\264\256/;\033\235\2145T\203\333l\220\261\267\224)\267"
+	.string	"\273"
+	.string	"\261"
+	.string	"<\257\343\030Ew\316\301I\361\265\351\262N9#\377,\375\304q\221\246\250\023\344[|\335\315\332\245\275\323\n9a\345\327?\223\350\026\221\363\221w\350W\307&\351!]\2019}l\267\247\177Xo\253\223\367\344^"
+	.ascii	"O\303;4\034\302\305\030\346\357\333\013\340\310@\347\317\333"
+	.ascii	"d\352!]\261>\251\354t\306I:\243)~\025e\374J\276\316\346\214("
+	.ascii	">|\364\344)\210\356\316\375\340\376w"
+	.string	"\361z\310\261.\006Z\f\240\2137\274\345kc'I:\243\227\263\017\247(:\272\322\361a\026EGW7_>\327\270\273\033\374\201&\024\217R*\210\377\t4\241\312RJ\302\337\340\243,\334\242)jD}\025e\2573\256\344\271\362,\213g\361\260\371\271==\\g\337\342\235\335\236:\333\342\016\007?{\370\t\224\025\023\233\003p\371g\274\265)3\216\343\214q\235\306PVS2\350\303\327(\267x?\2150\365\220\\\036\276T,\271a\305\257\257W\036&\022\322\r\2511e$,TP`n\201\354\310?\034N?ms\207\324\020\023\3530\217\355\036\333\361\377\030\032\322\323\230\362\367\306T\254\037\f\2037eE\222\356\345/\344\351\214_E\362U\344\2411\210*\245\237\036BO\224\252\273_^\247\020\377\3533\207\222\202P\001\357\362\233\213\306L\3373]4E\225h\035\254\3644K\265JOA\273\333\336\256"
+	.string	"\203\235_\344IQ\034e2\031\370\211\233M\244\206\226\"\274\206V\221\204m\2032\375\233\370\260Y]\225\272{\346\\)\355\337\370\251\273i\316\334\266\311\353n"
+	.ascii	"\277\215y\341\f9?3\303\013\203\221\3442\355\334\227O\237YCg\204"
+	.ascii	"\344EN3\216\3438N\327"
+	.string	"\207\337\370'\233\360\nOc\346\375\374i\313\267\207w35\2376\356\226Nj\310\027\363\321\346\324\306W\2104\301\301\247\365\224FO\3053\025\317\224\247\3262[\331\206O\242\036R\311\272\3703=\323\031\227X\221\264\233\257K\265\275}\256\347z\256G\3645\350\365\026\177l\367W\332\362\207g\020N\236\215\356\\K\\0[\"NT\360\237\023<\266\203\341\307v\373\036^R\226UXN\312\022KK\314\321\300Dey5A\003\027\225\345\325\201#\3100g\224eU\206I\243,\253n~\340\377\274\345\302\337\221\356\334\003\272\374\231[p\362\357\323\346\354F\3210\030I\212b]\n\247\361\212bHo\023\247\327\3351\b\227\221?\037\217\366\317\307\233\375\363\361\270\177>\336\244Yz\272\201\033\227e\t\245:\225\345\224\253,K%2/p\272R\272M\324\360V\3516!s\002Y\230\314\336U\002\034\0221n\004g"
+	.string	"K"
+	.string	"\216_t\267\005\334|\271n@\233\177\336\020\364L\2330@\201j\250\021M\246\320\b\211\202$\005\251\244\003\021\005\004!\304 \204z\022"
+	.string	"35\307\342\230C\320\b\311\310\210\004IA\nR+\313\030\226e4\016\250\353\036\210\257\316\360`\031\335\355\376\256\304\276\211\201M\266\202\326~\207\033P$\2078t\341\310n8\017*\350M\311\266\374l\222\224\205\255\334\210MG\331\306\021\374j\347\224\372\332\362-&\022$\036,w,/A\354\247{\236!\331\023\222\013Yd\3100\227p\264\020\330\254\206\261\r\304\276\241\006\277\274\361\301\257| \203w4\034\343p\212@\210f\f\307\020B (\264"
+	.string	"\017\377\r\371\2200\353\320\033\370&zgs\224\305\272b\265\214\341~q\311\236\030\007\215"
+	.string	"\017VX\213\354\0344A7WAQtR\024C\364)l\342\345~c\244[\317h\2769\205\016\205]h\210\273H%\270\335b\270\013\200\240$\030%\tT\222\033\t5(\004\233\024;"
+	.ascii	"\234\036\234\311\265\005\272\220\027\260\240uK6&\177\322]\032"
+	.ascii	"\005)4*\r\033}\316q\275X\303#\252\334\245.>\333L\262$a\027u\311"
+	.ascii	"-\227D\330\027I"
+	.string	"P\016A\213\362p\005\034\326P\314\242\212\334\r\336\212DvM\343\264\244%\241AzW\037x\3717\234\0074\022xEF!Y\347\325::;\311#\n\336\210\260\202?Kb\267\333b\335\241ZA\020s\214K.Z\261!:\032\\G\216\314V\272%F\244\260yg\357\237\034s5\024\320\300\252\266oy\274Y4\204\264~\306\224\253\017Y\317\344\355aA\273\2013\356Ue\207\272\2040\013#\353\321\2148f\326\263\256\fR\206z,\0304\376\361_\265>^\343\034\271\311\252(M\\D\227M\007\344\306mM\360\262\273Ij\b2=$+\326r\344\212d\321\3607\321\301j\215+3c\316\211Fo\355n^3(\355\2170[.A;\322\363f\305\314\300\275o\217\204\226~\241~\341\324\333H~\372\327\323\341\204\370\304sh\216\236\237\274c\301\235\275\272\207-$\211\326\362]\347\273\233\371\315*\322\016\370"
+	.string	"\233\226\030/\206B\002\335v)2(\371$\255b\024J\220\020C\250#\335\306;o@\b\0344\031\036\311\201\346a\220\3048k\245\034Y\243\231\261\316\b\260 \026\001oY\201xQ|\245\201\222\n\377\177\3700\314\373\276c\245\217\310\371\254\373\320\200\"oU*\233\020\3349\202\332:\265@\312E;\030\331<\222\273i%\025}\032"
+	.ascii	"\330\032\021\\\247m\325\202C\353m\263=9\223[:\367\304iZ\307\340"
+	.ascii	"$\030\203\217B\316\001\375<\252\024\016\302c\"\3375\3706\232"
+	.ascii	"G\216k\270\363\207>\264R\025d\270\334\035\002\230qM\303e\033"
+	.ascii	"W\324\270\262'&):\2353\354(\226\035\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\213\003\305\f"
+	.string	"6\32051pU\222\016\200\256\177\216@ 8|\270"
+	.string	" \024\374\307D\333\377\377s\177\272\352\201o\177\233\330\326\265\261-\315nB6\207NN>i\233\310\235R\n("
+	.string	"'"
+	.string	"+"
+	.string	"\2701B/\340=\323s\2120\367tN=\334\201\021\002R\265\277\250*\013K\005&\256\367|\317f\377\316~.\273\022\305\f\354n\346\254\335\267\r\230\004_\247\300\275H"
+	.string	";\224dr\353]\266\324\026\201{\016LO\n\333+\022pb\323\270\251\003\322\202\2440\265\2471\341r\251T*\231\206"
+	.string	"A\232\311\301{\231Fa\314\034\366\206\357j&\223F\221\373\301\336\246\233\230\3060\033\023m\253\001 \243\302#\365\244\"\016\321\307\325\303\372|\240\274\265/Od\275{\373k\302\342\320g\237n\220\030\332\033`\250\321t\207h$J\2065\260\002\221\"\3436\022@\262j\222\222\2261\241@$\221\2422\3555\006\352\314\315\220\203\221\240*\035\376R\357\315\004\033\230\241\272q\310\036\350\036E\377\352\224Y\220\207R.\272\020\f\334>\304\331[/\301\336\316,/s\315\211\030+\2325+2)]o\2242?\261D\033d\201l\254G\221\303eN\360N\306\024\347c\224R"
+	.ascii	"\021ca-\305(a\232\305\245\265Tf\3761:*\321\021(\323\274\202b"
+	.ascii	"'\241\270\306\003\344@As\352?\343K\336\325\306i \233)m\272\232"
+	.ascii	"N(\224\252w\356\224\210\321\345\035/\370\363\271\260\307\236"
+	.ascii	"\250\037\"/\252\252(\361\036\024"
+	.text
+	.section	.gnu.lto_.pureconst.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375 }%\003"
+	.string	"\322\007\030\035`9\f\0070\\H[0\327\017A\020\004A\020<"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002\221\035\263tIw\364D3tA\367s=\267s9w35331\3632-\263r)w\362$/\362 \253\036\243\034\267q\031o\361\024/\361\020\357\360\f\2570\top\352S\202\027x\005\270\313\264\326:\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`=\002\325\n"
+	.ascii	"BN13Pk\223\016\260\224Jd\252*\267\374\306\352q\367El\303V\374"
+	.ascii	"\260`U\345\206\225\353f`p\025\263!H\306\204\210\r\220d6c\213"
+	.ascii	"\356\357\315\254\225;\005g0\231\210\t\314c\210\007h\314\001\302"
+	.ascii	"aq\361\201\032\330i(\267\241\341\"\214\217\016\212^\232\f\220"
+	.ascii	"\017\254\330p06\234\b\0275\270\016\306?\3132hA\241jeA\t\257i"
+	.ascii	"\267{\250\350-A\t.\301'\301R\265\274\366*\367\254\325\364X\326"
+	.ascii	"\264E\224k\"A8\310\216\201\245\003\355\225\202o\006\245\313\313"
+	.ascii	"\232\266\022`\022Y\375]\024\223J\230\361\374\275^\265T\005~/"
+	.ascii	"\341y\036i>in\031\200=\035\r5\257\232K\232?\225_\003<t\tB\250"
+	.ascii	"\301X\211\254NA\352V\003\200\202\231\261\243\007\022\340C%\211"
+	.ascii	"S\234\232\013*MZ\273\3653\311\005\025P\345}\251B\323HE\214\r"
+	.ascii	">\006\365\374\275&Z\317\215\254\357\016\002\021Mb \323GL\t\217"
+	.ascii	"\310\207\314\321\270m\224\341yo\r'\353\356\026m\036w\31061\231"
+	.ascii	"\264Gm\217\202\374\234\177i\207\315\035L\204\0272p\275\221\017"
+	.ascii	"H\r\200\224\252\343\312`\020\373M\350UyIB\333\251#\204\001\322"
+	.ascii	"\366\377@\225\035\030j\022\220\b\013\337t<\245"
+	.text
+	.section	.gnu.lto_.lto.ea2e7e5c021cb25,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sin_approx.25.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`1\0015\016"
+	.string	"&[aE\360\222(\035BK\336\332\031Z\033\340\247\215q"
+	.string	"]\024\333k\002\215\343\274\334\351\317\025\244\317\243a$\252?\350\r\r\265\375?\310\210\257d\r\017w\324\235e&-\340\326Te\037Ni\315vj\333\336[\312\224\002L"
+	.string	"P"
+	.string	"K"
+	.string	"\236C\333>\213\267\340\354\231\204\r\037\0167\\`\004\331\335MtP<|'\020\017u\004\307)\367\247\311\371"
+	.ascii	"\\\254?O\314\365%x\331\210\t\340j=P\216\020=\336=a\\"
+	.string	",\231\035\222\335u\276\270<\334\360\266#\330.\261\377\n\357\260[5\235\232\276\210\200\017\005b\354v\250\tY\034p\306\211\313n\377\005\347\317\274\363'\304\243\223ixKS\262b\007\211\3470\004dd\177&\346\331[\232\243H\361\343fwG\207\206\020\262\031=\357\3420\317,\262[C\205\214\335U`\004\001\035}\312\372\003\02287\032\273JL=\351jX\022\307\242\253\304k\352[^\255\254i\352p\031\002\242E\275\354\242\225\3141\324\250\367\321R\263\2225\277\373\004\0326\2339v\214\225*\202V\202f\302*c?\335\271\354\216\207\375\360\351\252\023\312\352\215\254\322\016N\032\224F*0X@\032\260\272K\244\024\013*\023\323vB\231L\250\322vB11m\245T\312F2`\324\005\n\251M\205B\245\266\317^e:\372\356#\020\351\231\355<\360\3744\265\365^BU\205\261cB\2651d\210\177\t\030"
+	.ascii	"re1C\023N\341\240\323VP[\013\263W\2456\306\260'\303\354\031\313"
+	.ascii	"\206M{@Y\333P\215\270\320\251\020l\327\231\002{\213\312\374("
+	.ascii	"\342'\225\301\250\266\005PxZ\332\243\201\251="
+	.text
+	.section	.gnu.lto_cos_approx.26.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\033\002\345\021"
+	.string	"\206\"wH\340\322&\035\202]T\367\331b\026\0250Bvvl\335\276:\005\013\333\004\226\034\305L$\006\205\350\351H\254-\031\273\272\321\256\246\347\371pg\300\345a(\307a\021HD\201\237l1\"\360,\f\334\001O,\331{\313\224\002`"
+	.string	"d"
+	.string	"\\"
+	.string	"\366\211\305\310\365\260\357\330\346\220]\031'Z\354\256\002#\350>m\373)\256\202e\333P4x77\232\037\037\273\013~7q\237\362\004\270\317(\342\254\313\250,\377\260\213"
+	.string	"\031\325\274d.q\036e\202\234\0318"
+	.ascii	"^-i\032\372\240\343\265\253\315\313\245Z2\331]k\315\213\303="
+	.ascii	"o\033\202\355\023[\303\352\207\004\260Q\340\306\356\206$ +4_"
+	.ascii	"\2248\355\267\357\377|\346\323^\263g\026k\365\230\017t`\307\373"
+	.ascii	"\224}.\001kss;\021\311V(\3279\242q\364\351\377\254|\236\373\330"
+	.ascii	"\373<\345\360\351\311 wv\202\002\207I\367yB\032\261\317\263\372"
+	.ascii	"\n\333\344\316\256c\302\350hwG>\375\240\373\274"
+	.string	"\037c\331^=A.\375\341\3570\334\214\\\274\2143j\021M\020S\f\031O\373\027\312\370\0353A\241&\371\265G\200A\004\364\t\260\032\217\227\375\013m\247\321 \t\255\325\265\033\212h||\321LNK\223\354yX\275\331\261\226\306\020\366\345\356\256#\b\373\352\356\352\222TsR=O\273\345w~}/,+1\262$F\355@\245\001\252\244\002\203\005$\003bn\024\211\213\205\227\224\024\310\242J\245T(\220e%%\005\242Z\\@\022\003V]\240\320\002\276\250T-\240\027^\306R|\355\022F\220P\333l\253H\027mlw\361\013c\313>\355\262\037\366\216\307M(\224%}\364g.\030\270\327\224\242\2142\352\242\307P\207\030;\f\307E\225( p\242\t\326\335rY\3644\001\274z\310>\3242\377\301,\261\001\005<\037K\272\202PO\004\210\366\266\221mU\321S\230D\030\342_\217\3340\026\241\\"
+	.string	"\200"
+	.ascii	"\3456\231p\233x\225\030\336\302\345\260\215\253\304\214\255E"
+	.ascii	"\377\226~v\255[p\374\374|\034E\031\300\023\253\353\247\024\035"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_atan2_approx.27.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\271\0065#"
+	.string	"\206\274\325K\220TR:\026\b\302\214\271\031\307\346\333\270b\340\202\350\033Q\025\001\233X'R\030y\233D\340\316=\233`f6wF\276o\021\210\330\317\036R\317\252e\210\235\233\253k4\343X\371n\334\367\375\335on\363\266O\b!D\356$\003\276"
+	.string	"\260"
+	.string	"\301"
+	.ascii	"\247e^\342w\375\353G\316\35181\272\240p\245\207\331\213\221<"
+	.ascii	"Wc\023\332z\230\271\030\2512A\331<uQU\271\367\366\374d\t:J\266"
+	.ascii	"\302\"\250?u\222=\267\327b$\337\3565\242c\354\336{\200\r\250"
+	.ascii	"?\231\231\277\343<\226\230\221\346\326\025\215/9\341\364\305"
+	.ascii	"v\357\375\361\274\006\375i~\006\375\3311\276t\334MM\321\323l"
+	.ascii	"\273\304O\177L\034.\216&\204L\307M\3756%\240\b\325\302\252\002"
+	.ascii	"\210QROM\002i0\244\\\t%e\372\250\222\250p\262\350\212\237kNH"
+	.ascii	"\302\2328\241\212\367N\0304y\356\275?\336>\t\233\254M\177\356"
+	.ascii	"\275lM\b\243\316\2713s\221\231=0\243\302\277\217\341\203\334"
+	.ascii	"l#\022\241\351s\3154\2155\222\361\372^\347\001\332-,\323\274"
+	.ascii	"~re\003\332%"
+	.string	"\243Z\326\330Cy\355\026\346-&\333V\3147oW1\347\370pz7\267ls\3135\347:\323\\\353\237\271\327\231\367\255_&\006fw\343Yw\313/\267\234\273e\334-\337nY\275\345\364\226\321[>o\331\274\345\276e{\313\327A\257\244\365\250\334\233b\311\345\242\235Cl\234\353\367\372\215o\346\357T!O\306\271\035\25316\rXbS\272fT\311P\242\207\377\203\017\344A8\267\203\"\354\314\202\372sG\n\214\221\277Q\327\242E\201!\243\202\372\375\240\215ljxk\\\377\276V\252\252\266&\267\366I\256\305+*P\320\212\004\323V\373fh\247\035\300l-.\227B\363l\264\001\254\231}6\200\257\265\270\242\215x\271t\233\215\363\265R\351\332vw/\331\214<U\031\033Z\027\333\247\331\212\305\310\213\005\305\206\227%,\227l\301{\201\003t\3756\325\326\342\217\307\031\217(u\375\0034o\372\306\363"
+	.string	"m\372\246\177</\271\2265\331\245M\027X[\261\344\020;\272vc\354\267B\366\363\0051\002\361\332-\267\367^\246n+F2\263\035P\323B]Q\202V\013[cRY\3237\376\306\020\310\353\232\016\240\266fi\262KNY\020\301\216\022A\205\304\260\n\224\212\210>"
+	.string	"\241\013\020(\025\021}"
+	.ascii	"B\023(q\330\320\001\t(M\"B\352\013\030\222\204\202L\021g\007"
+	.ascii	"B\r\206\024\0241@\340#3\342<\344\223\304A)\310\350\007\342\310"
+	.ascii	"\310\350h\350\007\242C\220\321o\b)\351\347\343\343"
+	.string	"\243\020DH?\245\243#\244_n\353\336\274]\325\345\226\323l\2520\035\023\323\017\206\300n\262\022\203\313\311\271\002<\273\035\177\303\312\232\222\372\232Mt\32703g0\252og\372\3322\241Y\315\224'[K\033\246m\305\177\222\245\344\304i\rYbf\257w\375$c\266Cqz`NY\320p\272\223+\326\315\212Dy\266\025\213\310\322\262\277\312\252\3217\255\353'f\026\352J\202\244\367\322j\367\372B\3262\033\314\365KCP\303u.\200\223\2501P\305\034b\246DD\222$\205\fc\320\002\021)\3436\021\3604H!\032\322\2445D\234\306b\222\027\352\224\304\235\306\003\236\307B\277\343\020\023\304\335R\005[\214\210\333\2009\335!\021\243\221\035\206-\314K\245\266Pi5\026h9\243\201'\352j\330\3535}\315[\247a\250\203X^\3547XYk\316\n->\003\b \371\007~\243\323G\253\024~\322"
+	.ascii	"\353xmk\376\2130mm\2026F:\3672,\303\236\245\263\211\370r\311"
+	.ascii	"is@\346\330\017\212\354\250\263:#\3030V\220\001\367_\314`W\360"
+	.ascii	"\213\224N\022\221;h\2028~StB!\205\223)\372\017\366\223\241K;"
+	.ascii	"\370\200\022@\006\265u\366\272l$8aT\335\234N\246E\205\252\350"
+	.ascii	"\261(\b\203_\204\216\245\020\260J\306\363\352|#\"\314%\376\005"
+	.ascii	"\241\266\231l\004#\222\027\241\220D\f\320l@\256R\240v\fkN\034"
+	.ascii	"i2\367@\357\013\303\323<\316\342&/5"
+	.text
+	.section	.gnu.lto_acos_approx.28.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`A\002\325\022"
+	.string	"&$~H\320\322(\035\230`\013\377\312\257\350\314\004a\201\212\fzw9\332\3017\254\272\351kc\231U%E\320\n\360\254\355\237Vrzm\004T\352N\361"
+	.string	"_<\0303\325\3034\213w\342\376\367\325\354~\265\002\254\375F\310\2262\245i"
+	.string	"_"
+	.string	"m"
+	.string	"C4\202\3149M\376Y\202\352\306\344\372\035\363|\232S\207\216\2159'\003/0\375\263\355\303x\f\230\315\2239\034\026\037\222\001\323c4\347\024W'"
+	.string	"\376\223\037"
+	.string	"\376\333\233\303.Wa~\354\362\270\024=bl2_\251@h\305\217\224\215&In?2\327]k\266\231j\te\316i\215\261\215\270\277\333\266`\273\202\2558\001\276\356\250\035\t\036S\221\354\\L\327\306\276\234[c_-\362\334\235:\317\035~\347G]}\272\332tu\351j\360\352\357jy\365^\255W\177\244t\023J\260\2333D/i\006}8Z<\367\363\\m\230?\343:\207*\034\217y+\332\310\254\315|p\024L\377T/L\354\234y\246\230\210\002c\246\325M\355\201|F\037\2455-\b4\336\300-m\251g\007\n\0253\351[p\r\f\031q\341\312\375\366"
+	.ascii	"\321\230s\242\366!\350\210\266+\027A\216\361f\336g\\\200\230"
+	.ascii	"\320\353\025\325\204\273\253\2521\346H\375\332\035<\350ctW\264"
+	.ascii	"\2159\\\363n\245\315)+\371*\321\210\233i\317\272+\021\356y\276"
+	.ascii	"\222)\222Q\033\356\201F#\231\366\002)/\352\242\201C\313\312\013"
+	.ascii	"t\004\025\b,\007\027\03648\t\360r\263NZ0\270\244\264D\026W\253"
+	.ascii	"\345b\211,\031RZ\"\353\325\"\236\220\330\265a\345%\272\270\\"
+	.ascii	"/1\314\315\313\2715>\215\016\020M\355u\027\260\"{\332\232\355"
+	.ascii	"\323\032E\2663\231Z\230\242 I\023\331\257\007\300n\3467\204\b"
+	.ascii	"\321\354\332\230g[KP\253\242\373\241\351\221ug\"\265\317\005"
+	.ascii	") \220\202\221\200\3156\262e\231\243=u\245\315{\256\320\323X"
+	.ascii	"\315\032l8~\263H\347\361 \332\342\341\302[\326\303<\266\f\257"
+	.ascii	"\002^\336(\025b\257\346\224\205tD\300\231\233V\321_\337\226\257"
+	.ascii	"\273\232\027@\352\030\311h\317\206L\311\310N\031\333\033o\312"
+	.ascii	"'J\241t_\001\3468\255\221\347bP"
+	.text
+	.section	.gnu.lto_gcd.29.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"u\f"
+	.string	"\006\327SB\020q\233\016p\315\260\202\202O+\016!\f\n(M\013\252\003C\251\234`4"
+	.string	"}gc\326\371\t\370^\035\210\377!\330\013,j\002"
+	.string	"\n@\363a\347G\212\332\n\024\342\347\375\002\351\376\255\355-eJ\001="
+	.string	"B"
+	.string	"<"
+	.string	"\006\246Gx\314\364\250&|kj\217PS\363\337\035\246\020\341\221\240"
+	.string	"\361\b:\204\234\022\351\033\260\205 \025*Ay\367\024m#\251\230'\325\331]'\311\366\341\236n{\202\355\b\366%\004z\356\316\247OQ_\215\314\214\335\222\225\035K#~'lk\366\305\316t\340P X\0363 \315\363#\253\030\300\356\210\020/vW\343\004\226\307\247|\205f\253@\356d;\t\031\034\\\344\330\335\n\301\003*b\001^\n\354^ ~\322T\321\273[H,<\304T\303\214\252*R\360T\217\0268F\262\344\364T\330\330\324as\240\303\335]U\023?9'%\222\265\204}\356\237>\372\343GwW\206}P\210~\340\341\300bP\241\301\202\r\201+\003\246\2666 \026B<W\205e\327\225Y\025v\301sU\326\007\244\332\034p\206\341\343S\205d\331\247\272p{\247\252^\177c\303'\222+\001<\030\352\305\bmQM\324\035\r\001\030"
+	.string	"\204\311\242ck\320\302\310\254\322\272\306\031\312C\266\341\021\017\270\220\213\204\320k\242%\366\342\301]j5\234\232\305 2\340\304P\370"
+	.ascii	"*\231\237\262\017G\311\252\233j\252F\273J\036"
+	.text
+	.section	.gnu.lto_wrap_18000.30.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`a\001}\r"
+	.string	"\326\226TB \221\222\016\230|\366\242\200\251\026j\313\013,\227p\271iG\200\002\b\334\202\017!<Z<9\3167\324$V\303\327\254\004\362\350\0371\001B"
+	.string	"\007\016\361\347lC\300\022[\b\212\306\277%{o)S\n<"
+	.string	"@"
+	.string	"G"
+	.string	"9v7r^"
+	.string	"\376\271\023\200\177\352\362\354\3609\315\314\237(wB\304\n\024-t\370N2\244\373p\025\240\2318\316\356~{\246h\242\314\211\332]'\212\346\341\236n\373\262M\331w\t\332b\337\255\262\330N?\372\363\243\373p\3021\003A\215\335\01676\033\363X\224\260\r\262A\354\0034\242\363\243\314\037\273+/0\273\253\300\t<\376l\373(\376\002r\346H$48\302\206\006\025\001*%*\242\2219TN\202P\321\033\177\030hL\274XI\247-\333\001\224d8\245J\262\306\240\231\230\273\005Lu\372\035'!Dy\343"
+	.string	"%\030\271\273!\335"
+	.string	"\363\f\246\206\244\210a\222:\234%\0272\23356)\224\001~\020\342\240b \241\301\202\316"
+	.ascii	"\021\013\023.\317s\325\031\241@\342\261\342\205Y\026V\305\253"
+	.ascii	"\202\307\212\325g$v\f\030\273 \362\211$\030\366\211 \244\275"
+	.ascii	"[eq\204\031u\372\355\0366\033\207\247j\347R\257)\n!( \260\"\222"
+	.ascii	"\301\036\226\263,\302\236\257\032\306\314B\210i\b\262\236\301"
+	.ascii	"\024\276U\315\312\257pM\370\356\206\261\344#\\\362\230w\227\205"
+	.ascii	"\231ve\031\231\331a\036\005\246\243\032\217\272\306+,m\245\335"
+	.ascii	"b3\221\374\221p0Kd\340\017\363\370sT\030\327\034\231\271qE\345"
+	.ascii	"\266\213\352\001"
+	.text
+	.section	.gnu.lto_wrap_36000.31.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`_\001\325\r"
+	.string	"&XXC"
+	.string	"\257(\035\230\307\nb\021b\354\240\302\220e\f\307\261)\320\364\355\024\324\031\273uI\030\3747\215B\321G\002\220\2658-\244\256\356QUUU\205\320\304\027\037\235\374"
+	.string	"`\335\351\220,\320mo)eJ\001B"
+	.string	"B"
+	.string	"F"
+	.string	"\004\336\235~\300\273K\017\327\376\234&j\376\306\243 VN\220l\245?\247\007bRVll#\312qz\341p\001\325\344\271\261\211(gw\277:\226l&\304\215gw\215$\233\206{s\333\"\333\036\373\251\366uS\305\326\274\352\307\253\356\277\f\223\030\003,v3\274\\\013\343J|\260M\2625\354\002-\314x\225f"
+	.string	"\273(,.\273\233\300\b0\356l\373!\316B\262\246\254\225\355\245\2700\214x\261\273\030\347\001\177\311\301\023T\2666X\305L\013\027\227)\277\240\240fj\365\214\326\246\351\tA\032\223R\300\334&\036\246\346kFN&|9@\313\013w\267\224\2312\236\240\256=\314\016\021(Dp\306\330R#\263Hc\263J\230\251v\320\321"
+	.ascii	"\264 \002\003\005\035\001\036\025$\210>\316\240\316\307\004\220"
+	.ascii	"O\b\023e\241P\006\302D\024>!\f4\372\300:\034\316,x\2140\220,"
+	.ascii	"\033a\032\254\275n\252\030\202\213\324\374\352\030.\022'\227"
+	.ascii	"iU\314gI>@\205\244\251\203L% \200\242\"\204=\226\262,\336\236"
+	.ascii	"\255\032>\263\320\261i\004I\317 \n_\252f\343V\274\206\370\262"
+	.ascii	"q}\035\315\205\363\356\2640\323\356,#3;\314\203\203\351\210\306"
+	.ascii	"\243\271\306R\245\007Z\354&\222\031\211\004\263E\006\2220\217"
+	.ascii	"o\216\312\343\310(\215QXc\273^\031"
+	.text
+	.section	.gnu.lto_applyDeadband.32.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`9\0015\016"
+	.string	"\206Z_C"
+	.string	"q\225\016`\030\032K\377DD\020>x\017\212Zv\275V\240\\Q\373aGa_\333<\305\t\322\314\220\233\307\324\231W=\2726\364\377\177!\227\320\026\352\3703:\362\305o9=\370\343\210\320\336R\246\024I"
+	.string	"N"
+	.string	"E"
+	.string	"\266\375\027\2071\342\323\203\241`a\\\037<\260\274\354n\344\274"
+	.string	"\346\360\235"
+	.string	"\346PO\374\364\247y\3623\236\347\"\205\313\212\205\372\333D\\\003\260H\036gw\037{\226\260T\231\031\317\356:W\254\0207\274\355\007\266#\330\037\021\257?\377\272\237\361x\3410\340\262kR\333\2617\240\f\026\033\025\361,W\321lVD\373+\262\023G%`U.\223\026\273\013rh\b\333\341}\225\021[coZ1\230\r\007\333\341\206Dt>\345\257\223\001\354\266Rb\354.\002\037\330\016\003\264\367^BM\2655l\300|\245\n\025\225\252.C}\372\330\267\231\254\206*u8\365\351\007\215\016/\251\254\3715\275\354G9I%\315_\371\313\321\312\226\022\263M\232\rC\245\272\354\277U\023\366a?t\372\351\003!\246\017'\001\206H\334'\304\211B\233\031|\026\200\024L\bI\320\031 \302`\201\313"
+	.string	"\r\352\230(\210p\243H\352F\243\016\024I\025\270Q\004\225L\261\363\341\356\202\250\024E\272\256\0245\260\375SU\0163@$\310\257%\332\340$\245$~\354\036-(\263UO*\003\035"
+	.ascii	"\226\311\022c\333`\204\236\305\207\265\250o\204\b\231 p\007\214"
+	.ascii	")\252Y\020AE\220\nVps\316Z\t\3365\334\334\304\277\025#`b\263"
+	.ascii	"\002\017\024\362\201=\220\031\030b\250\341\305\317q\214\032r"
+	.ascii	"\250\311\333U\312"
+	.text
+	.section	.gnu.lto_fapplyDeadbandf.33.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`:\001\355\r"
+	.string	"\246Z_D"
+	.string	"\261&\035\003\203a7\300\210]}\303\267|\364C\177(Rb.\223.\262\331\350=\311\n8\255\351\257\243B`;J\025Y\371\261\265\315\377\377W\377\017\241\017S"
+	.string	"\357>\221a\233\247L-\254%{K\231RL"
+	.string	"G"
+	.string	"K"
+	.ascii	"w\261\241B\210\233\335\315\004\274\003{\204\017\200=j\206\247"
+	.ascii	"\216E\250\231\362I\216\245<~\270\224C\350a\002\t\274Xl@\334*"
+	.ascii	"\025\202\250\320`\340\340T\260"
+	.string	"\343\305b\363\326\023\205cevBv\327y\302]\270;\267\255\331n`\177\025\337gm\261\237\306\236\216\367~\370\227_\237\316\247\357\371\304x\201\314\354Z\370r\226ED\341b;e\203\354\217\034O\005\003\317\343\207\214\354\371\027\273\274\261\233\002\204\211\3355\340\002\236G\333\276\207\177H\331.\350i\340\020X\324\263TT\371\345\211\b\223.j\247\212\351Y\035T\371\375#\\V\340@\355\354\262\235\003T\023\006LM\306\324\344\211\031\257\025\325\316P\257\"\030\232U\342X\365z\022\254\233\222\374\374\326?13-6i\330\036Ijg_\277/\244\223&\"i%\222\307\013D\nF\b\034$8\020\002P\232\020A\243\020=\n\211<\030\321L\331i3\231\266Qv\202\240\231\262\021J$\013yx\223PBe#\333\206\312@\336^[\234\020\323|!S#F}\353\033+2%2\025E\035R\242*\303\335\335\030"
+	.ascii	"\226\311\362c\333b\035\"\214tY\260\rl\001u~\316,\270}S\3530%"
+	.ascii	"\351\2500\254\326i\316\204\327\256\201U\023\030\030\006\262\030"
+	.ascii	"j\334\001T69\331\005\270\\U\267\267\332\t\005"
+	.text
+	.section	.gnu.lto_constrain.34.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\020\001\315\f"
+	.string	"\366VVD"
+	.string	"\223\223\016\274\233\003)@\271\211\370D\001\250\341\354~\216\b\325\327\321\251\261\205j72s+\006\317\020.\272\2553\t\324+r\221\374o_\337\375\235Z&\241$\260$,\316W\344\315\221\326~\262\267\224)\005@"
+	.string	"D"
+	.string	"@"
+	.string	"\217\360\004\254G=q\356\021jr\376\311c\204\0240R\035\210CO\227\002C\273{u*\251\360\200\210\032\026O\207\002?+\0238\376=W:\225\314\020\322\356:S\235\207\333\272m\021\333\020\354O\b\326\305\262BPc\267C\220\037k#\312Pa\233\263/\0334#\346\305\003\031\357\305\001\347\021\344\211\236\2071\215;\273%P\314\354\256\310\0068\217\266}\026\177\341l\032\350\271tW\255\340\320\202\307\356b\241\177\254+j\322\006E\211\001d>\334\345&\307\f\204\232\232\341\263\021\220\002\2221t\254H\250\252\254\232:\362\325\244\344\215\377\035\200\213\03676}\330\336I\252\312>\\m\261\037\363\303{\277\036\346\317\247\037&\013$&\250a\273\240n0\302 SPaA\202\321"
+	.string	"\224VRg#\023\023\252\244a%\233\246m\031VBR\322\260\354d\202\215\nx\303@\341\204\241\266\355\204]\336^[,\022\002\246J\330\241P\377\2753\202\206M\252^\003\031"
+	.string	"\204\311\202a\333\226:\230e\001\226a\205Wm"
+	.string	"]@\232\243\354PZ'\243\t\3035Q\020\033\272mB\004F@>0\f\004\001\346@fC\ri"
+	.ascii	"\315\221\b5\260:\336k\013\024"
+	.text
+	.section	.gnu.lto_constrainf.35.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\020\001\335\f"
+	.string	"\366\326VD"
+	.string	"\223\223\016\263\351\240\021T\271\21108\230\016\244\277\237\353\223\360?\243S\303_\262/R#\251\004\236!\\t[g\022\250W\344\"\371\267\277\276\373=\225\337b\250\330\020\004\234\257\310\233#\315B\262\267\224)\005A"
+	.string	"E"
+	.string	"@"
+	.string	"\217\360\005\254GEq\356\021jr>\312\243\004\0257X:\020\207\236N\005\206v\367\352VR!\002\0225\037<]\n\374\254N\354\370\367Du+\231"
+	.string	"Dv\327\311\322y\270\255\333\236`;\202}\n\001\326\005\263J\300c\267eH\220\305\021i\254\260\315\331\227\rJ\311\330@\020\341\251\036p\036A-\242\347c<\343\316n\r\030\232\335\025\371"
+	.string	"\347\321\266\377\34208{\006z/)\256CF\207\030?v\027\013\375c\005(\265\b\007M\211\002T.\376r\323\203\006BM\325\360\331\f@\261\310\031>V&TSVM%\371jT\362\306\377\036@5\"\307&\020\333CIM\331\207\253.\366e~x\357\327\307\374\371\364\003\245\013%%\270a\303\240v@\322 [`\201\201\202\021\201\223FRg\243\223\322\211\244a&\233\246m\031fRB\322\260\314t\202\215\fx\313P\301\204\235\266\315\204]\336^]<\322\002\246\216\204P\250\377\336)aCH\252^\003\031"
+	.string	"\204\311\202a\333\226:\230e\001\226a\205Wm"
+	.string	"]@\232\243\354PZ'\243\t\3035Q\020\033\272mB\004F@>0\f\004\001\346@fC\ri"
+	.ascii	"\315\221\b5\260:\336k\013\024"
+	.text
+	.section	.gnu.lto_devClear.36.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\235\b"
+	.string	"\306\320=8@\345\2501"
+	.string	"|pKF\264\366\023\364\217\355g\307\365`\377+\271\304vm\nK.\210p\214\036{l\206|5\307\312:L\372\001/L6\335?\370\034\nG\245\2252\245*"
+	.string	"-"
+	.string	","
+	.string	"\005\033\313z\255\214\277\327\035{\341\210\315\374\237\021\304\236\241W\333\304\002\254\226\3120\340\341\177!\253\345\341F\267=h\353\320V%0\033j:2\030P\355\357\250\005\370L\312D\332\272\323~h \303\326$.\361\fK\331\363\273FV\376\017T\004\216e?\033l,9\016\033Mp\213a\224\272p\376\213\352\223\f\215\201W\210e\235\332X\022\274h+X+La\2119\004\320~*\030?Zk\376\277\321\325:\025E4l\013\023\f\n!\317\005I\"v\013\235(P#n\226:\216\353\266Y\252\030qs3\235f\350\323\316\202d\232\250\2563\315\316wk\036]\205h\231\255b\t"
+	.ascii	"\204\231e\246=\245\254\005\226O\031\213\3432\364\267\032\r\356"
+	.ascii	"\362\242\235d"
+	.text
+	.section	.gnu.lto_devPush.37.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\013\003\225\023"
+	.string	"f\"xG\320\322(\035\252\232\222\355/\305\016J\340\252\232\004\357\274w3\214@p\326\267\003\216\037\334\021kn\255L\261#<\300\316\364\264M\277\261\207x\200]\353\001$3(\366\372\036\262}\230L"
+	.string	"Z\177 \277\221F6\2212\245`"
+	.string	"Z"
+	.string	"h"
+	.ascii	"\252\247}\023?\001\273M\346$\2737;@\2737\225\r\200\217\276\275"
+	.ascii	"\344{\004\017\340{4\314\336\361[\316\036\227#\003.iwY\032\342"
+	.ascii	"\260GO\023\346\277\347\246\031m\346\321\346\336\211fs\365\016"
+	.ascii	"\324ft@\321j\274\222\"\020:\336\363\324@\213e\226Tv\3279\243"
+	.ascii	"q\270\277\333v`[\305VW:6\232\3349\177\206jl\n\261o3\2518\366"
+	.ascii	"\275\325\033\373<\177\352\266\037\225\3510\323\247L\2332\rf\272"
+	.ascii	"\224\351/\3231\323^\246U\323\251\351\013\b\213\024\255n\354n"
+	.ascii	"\330\rY]l\261c\373\241m\242S\345\355(`\347q\316\246]\030>@\273"
+	.ascii	"\2532\003\360q\200g\"\024\232RO#NF\"\3109\325\023\035\033R\006"
+	.ascii	"!\025}\360\024'g;\t\330\257\263@\005\300\221\324\203\302W\240"
+	.ascii	"\362(\2456\314}\234;)`\344a\344\207\306G\314j:U\034\224\247\262"
+	.ascii	"\364\030\325d\020\347\017Q\252\212\221\234\317|\240\374\232\372"
+	.ascii	"#Y-\226;\333\025\236\302B\340\356\246\3708\226\013\240\210G_"
+	.ascii	"\346{\274\216\004\030\356\024\226\005\255\004\020\024 X\221X"
+	.ascii	"hy\240n\255`\"\304\254\270X./\227\353\325b\271HXq\261Z/0\254"
+	.ascii	"\225\211_\023Z^X1\257\327\013+\274\355\275\325\0337\330\351h"
+	.ascii	"4\026C\035\022\022\003H\250\266\353/N\njhROO%J\232R\223\226l"
+	.ascii	"\b\201?J.>U-\251G$\253E\365\364\323\313d\3044\352GD\306C\003"
+	.ascii	"A\250\221L%\005E\250\206\224\224\323\244\003\240\002\221\251"
+	.ascii	":\017\021\20055T\023\230SP\343\034\004\372\323\001\233\270\371"
+	.ascii	"Z\026O\244\371\356\364\332K\026\020\374\222\235\220e \264\232"
+	.ascii	"\275n\030\030\240\3328\353\315p\210\213<\255_\221Y\210\022\\"
+	.ascii	"\212\357\321]\027\f\261\333Qd I\226\375A\322{u6)\242#\244\372"
+	.ascii	"\026\244\322\212[D\202\2004$\263\031\345z\342X\220\207\266\320"
+	.ascii	"\2206\335\261 \353\334<\215\n\276\354?\257o\276\037\034\326@"
+	.ascii	"\240\032"
+	.text
+	.section	.gnu.lto_devVariance.38.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\005\001\375\f"
+	.string	"\026\031YC q\223\016p\204a\013\207\321\376h\360!"
+	.string	"\037X\221`\004 \217`\224\006\351\300iPD\303\356\355\177\324\222\221q+$\254\013(2\020@\3008\020\333\330\r\"\245%\303LQ\330o\261\210%{K\231RH"
+	.string	"A"
+	.string	"G"
+	.ascii	"N\301/\304\312gh\310\200B\307\356f\236\023\260\036\341\005X\217"
+	.ascii	"\n\342\335\241f\347"
+	.string	"?\007\211\030&\257\3440\200\227r\205\235\223\213\224\215w\002\017\250>\324\370\313\023\305#ef \354\256\323\344q\270\343mG\260\375\300\376H\326\364\365\357\317h:j\032fZ5\235\231>\200M\007\225\003\026\273\033V=VF\\1\302\276\211\316\326\330\035\227\317\363/~\313]\272\177$\347\354\242XT\354~\037#\270\036\375]\266\375\022g\351\0341\245\033\230Z8J'R\256l\217\236\302\251T\003O\021\246\223JU\305\t~U\03300Nr\207\355\013?\341\230kwA>L\b\206k\345\321'\261\036\257\003h\264\230\344\312\032\017\233<\354\257$U\305>\\E9\006Ih\240-\240\300@\001\306\031\371\230\240\326\260Q\005\221\320\226\201p\333\306i\031\210\205\320\226i\242Q\206u\314\205|\2102\021\216\023e\232o\257(g:e;\013DE\261\035\325c\242$\b\241\246^\232yQj\241\n5\006\025"
+	.ascii	"\204\3112y\266Uj\276\242\341OV\214\013\327{\214q4\206@\013\b"
+	.ascii	"\350\016\301\026\016\356Q\370\353\236\2325\\\030\203jl\363+\323"
+	.ascii	"\240\211HJ`\314;5Z\005\005"
+	.text
+	.section	.gnu.lto_devStandardDeviation.39.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\250\001\305\020"
+	.string	"\326\340rG\360\262&\035@\202\271E\3658\271\tn\"%\355.\375\231\211S\247[\242\020\032nT0\340{\214\301\227\374kcSo\033\322!\375xUk3\360\f\312KI\335\345r\262\340\221\335\230\026y\353\216H\223F\366\2262\245^"
+	.string	"\\"
+	.string	"b"
+	.ascii	"#s\326\320\2501gx\362\001\356\322!g\333g\361\026,\333'\206&n"
+	.ascii	".\004\203\341\t2\347\374L\027\260]\306\003\330.\267\304Y\217"
+	.ascii	"\253,\377;\2178+^\274b-\217]l\346\033K48fDb.\321@\020\211\241"
+	.ascii	"\323\25611\227\352\250d\316i}\305>\334\362\266!\330~`\353\200"
+	.ascii	"\356\242\232\024\325\334\252GQ\275E\265\\\365>\374\325\023Q\021"
+	.ascii	"\344\2406\247Lm\310\004\2226P\370"
+	.string	"\262\323V\356\302\347Y\331\f\2349\247w9+qq\210 \004#\2323DpY\3229]?[y\310\262y \311\300t \272\364e+\266w\226\355\331%\021\247\253\375\234\353\260\036\262<;\312\361rc\264\334\312\237\027\"\324wG\273\001y\241qi\r\303e\330g\333\002z\342E\023\264k\343\004\337]\0372\035.*\304\2479\3451\374\303\3159I|\030\0332\3707,\033\240GNKk>\355]O\210\035\347\271\327\003\202\207\356g7\265\264\310\336\210\251Ev\350\322\265\261\037\347\326\330Q\003&\221\320 \265\200\002\003\005\250\021\r'\023\326)TJ\005\025\023\325\207\002\252T`\352C\261`\242\372R\253\224\017U2x\341d\365\251\200\340\352\363\302\326\267\306\272\244=\355\336\320\217\034\265\217m%\320m\214m\271\246\326\272\334i\267\266\n\324\277\344\232\\\266\305\376\354\337\371a\260\024@\255\310\355\266\244\035"
+	.string	"\204\311\202{\333\006)\206\030\0323-t\357\271\\T\373a\325@\364\030\321"
+	.ascii	"\033\204\013\217\277Z\\5+\252K\3543CpM\254\231\025\033h<\\\004"
+	.ascii	"\320#\bN(\006\316G5\364\223\261\007\355FR\002i^\252\321*("
+	.text
+	.section	.gnu.lto_degreesToRadians.40.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`W"
+	.string	"e\t"
+	.string	"\006\322B<@\345h8\240\276\326\027\346g\242\326o\3431\322%`"
+	.string	"\303\315$(\376\304{<FcZk\215\266\333\025l\301\303\336lw\025\005\220\226\240\210:K\346u\177\030\307VK\366\2262\2451"
+	.string	"1"
+	.string	"."
+	.string	"\342\n\313c&!4\006vw\013]\241s-{B\347\232\252<|\206\376g\236\341\274\f`\265NO\317\305\356:Y\255\222[o\233\3016\206\355"
+	.string	"\001\327\f^"
+	.string	"*b\273$#\202\315\321nZl\207\366\307\006\251 2\355\307\\&\274\bbm\327Uc\263\273\016n(\270v\220\266}\230\277B\033\226\005\037I \342Z[\214c\001\325.j\341\252\372\225K*G\247^S\300\212"
+	.string	"*G\177N6\017\330\342)5\305~\266\212bkZ/\376\251\351\246\310\230\340\"6$\036D\b\245\256\0039:\r\2179Q\251\3034\3626\322\347y\037\267\221<F\336\306\201\245M\004\362\367\321\201\233\351\373\300\355#\356m\325\020JS6,\013"
+	.ascii	"@3\241L\2130l\026\002\350\253\253]\023)\262 .\230 \340\304\223"
+	.ascii	"j\305$L2"
+	.text
+	.section	.gnu.lto_scaleRange.41.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`8\002\255\021"
+	.string	"\226\241tF\340\322h8J\227U\206\321\030b%\0373\344&\256\027\220Q\330\201\\\241\336Q\212\005\211\354\206\016\321\217J\342\3513\260\n\275u\2767\3448\034s\316\023\266M\367\004\t\211 }\270Y\366\004h\333\336{o)S\nb"
+	.string	"^"
+	.string	"Z"
+	.ascii	"<\276q\341\276|\260\340\300\246#\324`EN\f\006)\306\033\005\340"
+	.ascii	"\273T\211\325\3638\276y\264\353\201\204\214\335\035`\001\340"
+	.ascii	";\333\376\315U\314\354\0337\322\310|\206\006f\207\307\356\212"
+	.ascii	"\252\223x\357\270\243\274w:\363\331s\346\337\347\\\r\233\033"
+	.ascii	"12,"
+	.string	"\317o\301\356:cd2\334z\333\001lG\260\223&\0179\317\017\242\351\222\246I\232\036e\032\314\364\227i/\323]\246\271Lk\2463\323'9\007\024,6$\350\331\275P\324cqt3L\274\366\333\236\366\314\177q\037\227RA6\003q\253!\334\227\036\0215\020\204V-\356b\366\232\201\2764\f#\230\236\021;vw\365\316\017F\360(/\365\023\237\346\355\026\352mW\265$\221=U\r\365C\264\023\235r\352i*\307\210v\232\032\022QN?\037zU\345\206h5.Y\344\020M\355v@\364\2326`~\264d\221\023\006\215\240M\"{dI\ra\237\333\335\265\202\260\237F\275v\237\236\363\233n\273\303\217\377\310q~\221\353<\254\237|\205\365J1Q\221\241H\370VX\257\024\223VL\346\031\301\311\201V\201\t\006\b\224\230V\356V\211\214\202\n\313%\276`.\027\254%\276RX.\261\025\223\211%"
+	.ascii	"\f\253\200\022\023U`\260\230X\032\3676JU-\352\342\222\242H:\322"
+	.ascii	"\222\236\326\201\244\007u\244\251\343\244\241\202\232;4\033\227"
+	.ascii	"\237\223\276\326\351\247\247\032\223\006/ \020#\232\222\007\373"
+	.ascii	"\240\202\273\344\313\"l[#\0042\244%9(\216q\214\3229\376\230\226"
+	.ascii	"\241\312\330c\241!\341\375\261\313\362\243`\224Is\370\017\341"
+	.ascii	"\033N\234\032\220M\236\363\332l\270i{\310Xb9!%\0017wn`\215\314"
+	.ascii	"w\330 \315\315\354\310p\r[\026#\343\006\020iLm%\003"
+	.text
+	.section	.gnu.lto_scaleRangef.42.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\254\001\365\016"
+	.string	"V\234dE\360\222(\035B\237v\024K\255#\030E\251\022Y\253PQi[P\177#w]\177F:\211\266\rzU\364\022e\253\037\267\017\233\220\037\365\360\f\341\035\256\343\226\305\302\362\330yd;0\256\226\326\022B6\2212\245N"
+	.string	"W"
+	.string	"H"
+	.ascii	"\021\272\307\0021@\317\27384gW\206\212\027\273\253\300\t\272"
+	.ascii	"G\333~\313W\254\354P\203\2318q\033\025\223\230\217\335\375>\037"
+	.ascii	"\260=j\027\260=j\211\257\236+\3772\327fZ\302\023\024\326\223"
+	.ascii	"\223\260\273\316\023\024\020\267\3366\002\333\030\354<\020\277"
+	.ascii	"\366\264>\235O\037\300Sn\260P\201\320c\327C\220\037;#\302X\271"
+	.ascii	"\354\237=\355\225\337\3422\366<\257\231\303O\207\220}\231\254"
+	.ascii	"\260\\\350\036=!@\266\314a\307\372@\300e\223"
+	.string	"\"\307\356\202\036m\301\2631\016\265\220}\265R*\360\200\001B\301\306K\215\t5\260Y2N9\332\321\323\350\350\364\263\177J\362\306\251\327NO\343B\301\351\246\2511\252\246W\215\271XZ\031\304\351\242\206\306\346\215\rc\245\222\260\257\355\356ZG\330O{\227\335\235\277\374\234\317\356\356\260\237\273\313\277\035\346\217\217\t\340G\256\002K#\221\024\212$\003\247\002K#\021\321\t\265\371\301\210\003\021\003\r\r\026\204\002\250nQ\b\265!\005\222\276\222\211D2\211\276\322\b$}\242\023\352\013\031\260\211\003\311\351K\231L\247\317\203\355mO?%\332rTUO\023\207KDG;U\315\230kfGG\037$ \020#\"\223\007\373\240\202\273\344g\021\266m\304\322\216\360\r}\230n\036\006K\314\177\267\355.\226\207g8\221h@\032o>\237(R(\271\255\221G\206k\330,\347\006\326\310|\207\r\322\3342\033\031r"
+	.ascii	"\221\321\324\216'"
+	.text
+	.section	.gnu.lto_rotationMatrixFromAngles.43.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\013\022m?"
+	.string	"zj\300\026?P\346J\007\353\327\251\256_\375\016\264\024\024\325\013\200B\250J\275T\207&H$\357\325j\250}\345\\\003\"\320\f \001"
+	.string	"\022\356j\243B"
+	.string	"\030S`\b\321\336\213"
+	.string	"\2124\262\267\334;\245\224\002i\0015\001\\\001b\016\371$\231I7\007\017\305>>cz\364\272\217\371\330u\270\371\236\316\257\313\275\367Hv\336\272\266\202&n"
+	.string	"\033\245\365\336\223\321z\330\256C\303\021*V\251\251z2\230\217yc\334w:\017\037\033\035\360'\017\236\031\347\255\333\360%\220P\207\332\350\200BJ\346\2763\326v\002\301\341P\033\265m\246\321t\232^\323m\332\256\341\364]\3435\035>6\335\315qk\246\236\034(d\201q\252\320(|\023'c\321\315\032\027hl\344\bY"
+	.string	"Q\343v\342H\335\224\021Q\316\260]\322xo\035\2717\037\324F\235\266(\233L\323\221u\031\266S\313\322\002\004qRGx\357\235j\2249\250\215&\317\246:\245\317\325pJ\272L:\035Yj\243Mq\312v\346\016\323qd-\306F+\335\273\344\316\233{\347\2528\201\332(\3175\223mTm"
+	.ascii	"\266Q&c\006\324sOn\243\211"
+	.string	";3sx\357]\276\223&k\244#\243c\221QM-z\276\223q7\2356\242\251\2255\322[\037\0259{s#\"}t\363\225\210\027\265\265\261\373\322\206$\266\271J \211\017\266N\317\f\233\300\22546\267A\032\2751\330\364s\255\377T\360\226g\rI\315\354d\342S\"\330\200\3559\324\230\356i\326\275\227\035M\315G3\262\2319\0213\373`V\002\013\200R\032\345\256a\033\3557\020(f\365EF\256!\323\334\315b\337uE\34693\177&\314}\336_\302l\2353Xg\f\251sV\352|\241\377\232-X\347\n\326\231\202u\236\220:KH\235#\264`3\226u\276\262\316\020R\347\007\251\263\203.ln`\235\255\2543\003\353\274 u^\246\316\312Fl\256\262\316T\326y*uV\220:'\360\262f\004\326\371@\213\351\026\320e\232\245\372LsT\3275C\265\232\346'o6;\245\316M\251s"
+	.ascii	"\353\314d\235\227z\256\033\200uV\262\316I\326\031i\235\221\254"
+	.ascii	"\363\221u6\262\316G\353\\d\235\215\326Y\265\316\251u\266\326"
+	.ascii	"\031\265\316\247u~\353\354\326\2715 \365\370&\030\272\267\307"
+	.ascii	"\342\241\273\207\306\251\322\177\335\202\335\205\335\210\355"
+	.ascii	"e\355\315\3562\335g\272\353\272\325t\021s\337`o\372\2313\237"
+	.ascii	"\356\317/{\231\257\211\270\027\021\035z\272\277Cn\304N4\364t"
+	.ascii	"}\bq\027\266\241 \356AS\204\3142\002=]\237.{\177\270\005{\320"
+	.ascii	"\317\323\371\035\362\311\353>\334\177\r\310G&\273c\007nK\240"
+	.ascii	"\261\336\303\355'\025\357\353\3218\325\246zZ3P\220\340\025 \370"
+	.ascii	"\004\b\336\313:\271\"\360u\361\300w\242\377\003\210\016\375\267"
+	.ascii	"\342\226\017a\373\"\f\276\337 \026r+\362\347>\\\360\235hL\247"
+	.ascii	"\332\254\247\365\325R\371\313\252WV}#vr\255Jl"
+	.string	"\255;C\275%W\310\355\352;N! 6A\335\204\252\325s\023\202\360m\230\242Sm\247\2475\205\007\016\376A\203w\320\340\273\260\223k\003\303AV\337\202:\271\352h\177+\302@\376\r\250\204\257\375p\267\033B\341[\216``\363\350!\304\366s\377\231\360=\330YL\364|\f\337\200=\325\346lW \303\347p\036-\301wt\204\227\200\365\021\260\276\005;\271b\r\266\326\235\237\336\222\013\354v;\262\332\t\311\360=\347\257\233N{X\333[]\261\273\257UA\212{\353\211\364\n\317\335\207\013\205m4\f\177~\231\3031\344C\362s\375\302f\375\t:=\246'r\262_\330\013\237\365m\341/\274\373\235%b\302\263\360\375\327\311\325\302\367`So\005l\255;\277\336\222\253\360\315\307\256\323\234\025\332\273\354\314{\327\002\375\025\276\375\232of\276\310\335\327Z\212}|\275ehO\177\357ure\025\236\243\313"
+	.ascii	" 3\013G\363R\357eBh\224\035\207\b\260\001\001b\035\343\253K\354"
+	.ascii	"\264\022s1\261\261\261\363\f\003\343\n\003\343R\305\276\272\302"
+	.ascii	"h|u\205\251a(Z\250\3702a\031\302\211\007\\V)\034,P*\3050\341"
+	.ascii	"\005\343d.e\330\212\030&\274\226_`^^`\\\313\257.\023^K.\030a"
+	.string	"K%\024\203\271@\001c\031\003\f\f\306\362\270\366y\004b\n\025#O\353%\017z\366\3267c\245\0373'\227\341\257^\351?/\351\343\302\200\211z\344'\275A=\362Q?<H^\272p9z\251G\372\323L\023\356\351\217\036\365\263c\244%\013\226\343\033Q\370#\235\242\267\002W\305\370O_\004'\365F<u\212\224(P\237\276\372o\330|c\360Q\237>\212\327\274bv\327\304\241<q\322\214g\033e\nd\203c\253|\211\222$K\217\276\375\317k^1C\337\007\233\203V\271\363\217\260\035\022\220\231\251\334\210\026\322\223{/V\b\177\033\241\336{\213l ad\3036\352yh\203\256\236\352\317\177\2748\251\3572K/\345%\352\373L'W\252\217\342\002\365]\267\364PZ\372\236\276\325tr\245\372\247o\303\346\0253,K\337l\274\351fF\220\376\331o0\275\237\035\035\247\332\212<\255\251\0024}"
+	.ascii	"\247orzovru:k"
+	.string	"\255;g\366\226\234\233\031\241\372v\343e\212D\022u#2:\360\354w*\201k\250aX\344\034\232\022\021IIA\222Bka\0062Re\266\r\022 \303Y\032\b\231$E\022\224\024\224S\230:\231\003\030\232l\363p\276\3342\213_8\001)\212j\340\216\227b\301\304\251\322;B\255\211\210\212\013\"\207\355\327\213\212\f\234\202\257M\013x\306\021\3429U\346^\365\246j\006\346\270Wk\271\020k4\3304u\367a!\273'-\2000\323}\256\334:\341\027\337\214\272\2452px8\221Y\307\276\205y\335|o\324\024\253!\240\372 LoX\267\370\372\275\\\364\332\371f=R\t\332\352\276\321\310@$\r<\016\340\365\262\235\025\305<\253lb\r\351s\fC\376\341M\373\320\377%\025\030I\222O \213\236\"\233^C\205-6\030\006\016\345\350\226Ga\2736\315n\244t9\341\302%\224q\004\272\020?\251"
+	.string	"\266e\326\r\314x\227a$\274k\243\351\rb\332a\213c\356P\031\177+\363\204\250^\201i\f\3310P\346ny4\274o\253\345d\210\261\210\270\022x\225PU\251\302\fr'0\r\0023\336e\030\t\357\332hz\203\004\275\2709\246\2651A\375<]\177cH\205\207"
+	.string	"\n\224s\377'\272L\367\034de\203(\272\247\251I\365\007\216\231\030\254L\321s\246\026\321\377\024\352\232\031\224\247\315"
+	.string	"H\362\311\333\363\203#\210\234\020Y$ \031X[\315WK\003\224\006\214.\347\304\317A\001U1O\225\\)\341),Y8q\372w$\244'|Z\314\024q\377\255\265\356Y;\322\252\326\017,Z\372\335\022\321$\265\350!0\2603\203\211\325\017*\214>5\261"
+	.ascii	"\363H\336\263>\306D\343\227\025\255\265e\205\315\267\335O\361"
+	.ascii	"S\027+\202)\037(d\257Y\021\"&\220\025%\2473=\321\264S\366NSB"
+	.ascii	"\232\361E\007G\372\365\240\314\211\316}\264\251\2749\354#F\353"
+	.ascii	"W\212\"\326\265\347/\016\373\212\t2\214\023\002\215\261\242s"
+	.ascii	"(]\361\260"
+	.string	"q\357\365A$h\013%&\b'\025\334\177\335\345[\264w4\030\362\232\231\201\332\024\264\362\214\331\250\332"
+	.ascii	"\006Nq9j"
+	.text
+	.section	.gnu.lto_rotationMatrixFromAxisAngle.44.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\b\r\2553"
+	.string	"JW\244\022DP\234N:C\260\244Qn\300\221\340<Z\003\234\227?\214\n\306\030\220B\n\222\360\376\266k0`\327\225\001\360\"\277\205"
+	.string	"\021_\t\210\313\3544~\255\240\375+|\301 hpw\250FfM\020K\b\221;\311#\001\373"
+	.ascii	"\024\001O\363"
+	.string	"5\\\274\312\344f\215\032\024i\333\006\301\312\237\n\366*\023!\222\371iR\034\rC\323\266\355hS\340,\331\253\367]\356\345_\016\346a\016\275\230\2179\335\311\274\314\315<\357g\316\307E\242v/\252%\246w\347\352\006\036\236\022>\356\300\016\253\316\354Z\204\210R\347\202J\313\\\230\0070rb\034\310\304\275\320\200\006\016\306\0058o1(\260W\211\242nc\023\300\332rH\230\301\306<>\201Z1\027eh\021\330\253E=\220\337r.]_c\262^2\210\302\316t\b\266m\353t\225\037\260W\217\251\261\020y\325T\030\001\265O.eR\354U# \362\227\371X\236\245\353i+\036\324\266C\362\342\332V\r\212\233\330\253\254v\343z\225\375\320z\225\273\230\337\\\355H{/\206`]\352\264m\233l#\357\372\252\246}\273\370D\251\266m\317\367\23602\257\2577\256\262(\374\272i\215wz\300\f\257\206"
+	.string	"2gj\344\023\002\370\300_1\262\347\275D\251\266m\371\206\221\3158\023\317\314$\230\331\2139"
+	.string	"P\357\002gi\315{\310\027Z\330\327\336(\263\232\3636\021\346\247m\017a^/G\255\227\223\354e${\031\352\200\347\247\365\262\323z\371"
+	.string	"{\271\211\275l\340i?\323\327\316Kg;+\275\355\234t\2673\322\337\316G\207;\033=\356\\t\2713\321\347\316\306\327\235\007\334\356<\364\273\263\320\361\316A\353e\240\023\236\177\256\366\013X/\373\254\227\213\353e"
+	.ascii	"\353\345\236\3652\273^&\256\227\327\365\262\272^N\327\313\275"
+	.ascii	"^\276\353\345#\020\322\343s@\246m\307\016\357\264{\252\\\223"
+	.ascii	"\003\376\204\377\332\317\366\267\375n\377\333\017\367\307\375"
+	.ascii	"r\377\334_\367\333\375w?\336\177\230O"
+	.string	"\207O\370B9\3749Ji1\234>x\"\016\321\231\207\212\340\233\340\211(\234\023\314\305\273\341\003>\220\213\334\325\225\342}\3746D'\236\342\325??'^\f\005\231\372\220\353\375\237\037C%\034M\360\fT{6)8M\204\303\330\237\373\261y\333hc@\277.\355\001\032.\214\027b)\215\241\276]\367\320\206\353\242\005X\313\221\t\365\357~l\336\026z\302\314\341\262\340\016\367\351\201\311o\352:\251\256\026\371\335f\372Kk\036\006\365\361~l2\364A}\303|\2419\243N}=BA\303=9\377\340\3318\321\025\250\371t\016\364\013/\365T\233\bs\332\311~\340\235t\\\2062\363%\020\325b|\347M\217\336@7\375\264\201\237>\341\217\315\237\3029@}9\320\177\001#\334k\371>\333\266I\340\r\324W\363e\346\034<\206h\234w(\024\374\313~\\\250a_T\177\017\360\347\373y\214\025\3565\323"
+	.string	"\367\315w#\242j}X\262\323\366\272b\350\360\001i\265c\255\310\376\300E\357y\355\360\361X+T#\373_f\316{\310O\r\325W\rX\036#\335S\037\360\307\346S?\360K\357\201\3070\246\257\315;hA\363\376\337\217\315\033\275\035&\333\266O\006|\303\017V\254\022\025\353\325\313o]U-\323\004\313+\342jJ+\025q5E\225*\257\\^%\363*\271\256r\271l%\223\331J.\256V2\227\255\344b\266r\311\325Z\313\253\305\274Z\\w\352\314\340\303\002\252\004!\024D!\203\266\246\254\262R\246Bj\215\330\232\262J^aYYaQ%\257\252\246\254\222TYZI$\022c\231"
+	.string	"\221\225\334\302\302\312J\026\233O\333\036\302\234\252\031\2260I\177x\247\026\263pf\257\331N\366i(O\234\024\265\217Y^\261\2330YR4\003 \t\2223"
+	.ascii	"ez\214\024!\222\324G\335C\307\266\220 @\210\232\035C\364"
+	.string	"a\326C\f\261s\334\035:\312\316t\253R#5\321,\313\nuo\330\250\261\324F\275\242]Q{\006C\177\374\230\371\351\222Q\020p\244m\333\006\025\256\214\013l\333\266w\354\001\006\037\277\025\353\325\233\0276\350\324\306V\273\303|\231UY\352\257\245\275$E\251\317\326\255\004%\251\337\366c\363v\222\023\244\276[\332H>\216\372o\335G=\214\372p\267\215v\024\365\343~l\246]TF\324\227\373\261\331\001\201\026\250ad\304\024\032\032\021I\n\212\2224\006A\006\204\220bW\036\022 \363Y\030\310\220&H9\005%5\n\303\236\001\215\333\273\254\300\235\253H\370\224x\205U\225k\343\324L\246\331\003\352tP\210;q\320\341\250Q\027\031i\303\201\263\345@m^\215\300Y\t\360\333\232\001\373f4]\375]\t.\325\237\342\310F;\033\343\032,\265\200\302\373<\222t\213w\027\366\271\035\\\361?,p\024S"
+	.string	"\301\247oB\013\316\007\0347\025\224\032\326NHP\032*\323\270\037!;\277\233\320D\016\251\366\365\tSk\177\200\216+\276\001SH[[\222\021\3016\2417L\206\200\352\32143<\031\223\262\2009\004\256.[\323<\273\005Eu&\323\330q\315\260i$Z;\036\203\202yY,o\331\223\263\374\003\334\002\032J\003\241\336\307\274\366\030\250\362\374!\265DI"
+	.string	";\300E\360\236=\252)\375\025\":\242?4\316\006i\201\272o\"\030\b\004\004\023\214R %\t\372\302# ;6'\3525\232\362:Z\026=y\247\354@@b@\256I\302\331\371\t\302\362\252\212"
+	.ascii	"*\006\016\361!\017_n\344\215\221{U\374\252\022\214\237\361f\334"
+	.ascii	"\335\241\265\336\372$\255\326\247 \213\257&f\356\342I\233\023"
+	.ascii	"\250\244\352&\345\230\215\323l\340\f\324\310\2118\200O\013\226"
+	.ascii	"\304M\023\230\306\207\266\343\235\005\316\261z(\206\307\212\035"
+	.ascii	"\b)\350\346A\316\023I1A\345\022t\3308+H-\303N`\"\255\360\213"
+	.ascii	"\201\231\270\3025\221\260h\220#\250\307X\003Yq-\223@\036\023"
+	.ascii	"\025\226\203\2744\b^\362\020\0244:\023D\243j\366'\fQ\3042%\200"
+	.ascii	"\253\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter3.45.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\323\003\005\030"
+	.string	"6\351\222K\240\022V:\342\252Cr(2\224;\007,i\351\311%\375\223\235\373\021\343y\266\013A~\363F\033\325\237\351\"u\273\367\345P\275\006\225\212\007\341\245\311\361P\323\203\"\007\034\337\204\034L\343\311\004\223\325K\334g\006I#d\313\235dy"
+	.string	"y"
+	.string	"|"
+	.string	"\r\232D`62Jw\357\342?\267\0279\334\325-DJ\352.\226\354\210yr\213\346\356\356Y\274\305mq\265\310\343+\211?5\306\035\335=\213\035V\236\254\177\225'y\347\270\233\254\222\254Lq{VJ]q\214\342\371r7\017\004o~g9\365~5\264\fq\222\246\003\2559\347\226oWc\335}\343\251\215o\206RVJw/\345\371n\276 \337]\234\335u\260\313S\0018NM\255v\2139\312\303\335\327f\341\356\322u\275\370\237\225nY\351\222\225n\255t\271\322\245\225\356_/\035\033\021\210\272?\\\371\350&R\t\305\205\376\335\303\202\216{\302\204vtz\216\366\204\245\210\355\004\364\316\304\216$\030\t\331~h_\264'L(;\021\316\314\365\314%\017G\251\356F1O\362\356mo\334\023\006B\006\364\240\333\205d\314\\O\205h$\325\335\223\235\334GW\201QI\036nef"
+	.ascii	"=b|\231\3708\230\177\003JIG\260\254a\374\003\031\\y\310'zB\""
+	.ascii	"\376t\364jK`\220O\236XL\274\034g\n6\237\350\007\226\320Q\253"
+	.ascii	"}"
+	.string	"\321+\217`S\253\323\356\3161\017w\371\214!\210\306\216\366(\241L\200Hr#\316\354n\006\347\026\224\222\216^-/\001M*\362\235Q\236\374\241\0333\264xx\2730\032\350y\033\243\341\334\276r\350R.5\226\230\352\362=\241\260\200\226\240\202\002\004&\256\r_\232\t\214\205\230\225\332\254\305V\253\331h\263\226\013+\265\031\355\005ffb`m.,/\263\030\233\355ev\026\373\265Y\350\342\230\216gV\246v\007Q.\364K\001\225\270\350\222\b\247\001\276\t<@L\222\243\236\270\212\370\013\340\323\242\"\371/\336\3629^\002\220\305\342\341\226Lr\201\023%\323\037$$\323\252\363\347T\001\241\247,C\246*=\216P\205\214`\276\321YS\001^\250AD\f\245!\021\221\222\302$\225\016\360\"\221)\336\020P\307\244(\303f\262@INq\322\025\205KOI\354DL\314\275Pl9\254\320a\327\205\234\371"
+	.string	"\275v\204\203<9\230\233=\007\326N\346F\235a\201\310\2069\31397\023\344\344\320\320\364oa\314o\334t5"
+	.ascii	"#\376\t\276D\366l*>$w\317\252\f\216e\360\356\242\2219^\256F\203"
+	.ascii	"\363\222\n\370\\\224A\2171\001\026\356\023\006\220\306MtB\311"
+	.ascii	"b\344l^\201\213\321\034\375\025\255\241?t]{(\356\310}Bb\336\302"
+	.ascii	"\206n\325\316\\]\001\205\260\265\231\215v\005\306l]\250\001"
+	.text
+	.section	.gnu.lto_quickMedianFilter3_16.46.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\322\003\365\027"
+	.string	"\346i\223F\300\030Q:@\307\314F{\017\033\024s\2601E@\201\313\f\301\025SG\376\331O\220\344\246i\337\022h\340\277\275\340R\204i\003\b,_EQ`,\316\272m>\314\304\001\204)\305\211\354\223\004\260\022\262\367\2262\311z"
+	.string	"z"
+	.string	"~"
+	.string	"\023\300\313\0063\205[\355\252\276\310\215\300\276K\361S7nJ\257{W\243\013\300K\335\201\252\252\027\362!0\215\355\356\206\317\324I\351\341\225\351n\026\201\033\230\227{\324\274d\033\217\035\374\246\214\2741\375W!\006iB\206V\223\035Tp{a\373w\344c\353\331)\343r\205\212\2151\316\246\032OTu\367y\337\026\265\235\335\257Bw\353\322j/\256"
+	.ascii	"\256\2520T\325\202*'\005G\275J\252;\331rN\365\261\273[\031\247"
+	.ascii	"\252\253\247\357\3760\256\316\270*\343j\214\253\034W7\256\036"
+	.ascii	"\205*\262E\303\223n\027KhZ\213$\322q\240_\365)+C\032\246\256"
+	.ascii	"\364\314\020\022\3220\365D5#\320<;ez\251\037+"
+	.string	"}\022\275\022\rSDV\017\212\201\335\003a\260\270\222\324\335\024\300KV\205\351y\032\246r\254\216\034\t\354@(\300\356a\320QI\352\366Y]j\030\240D\3119\215\314,\340L\224\253\321\274\214|/\314\347\322\205\210\314mf\341\375\302\024\216\234\343\007!9\321\331f\273\244\363\347\306\021\220>#Z\230\033\335\232\037\364\377\324\230\255\222^\311\243\231[\257\322\267\273e\3149U>\217@\202\205g\317\324,\037\32018/\006v\267\204\263\251\013\321l\227\224\213\204\200;\257Uf\310Or^\t\323\r\232j\216\211=MU+X\246\250\036[\304#7\256\017:\361\346\032\301\003\204\226\003\020\017\032\330\234N\\[69!t:\270X$^.\327\253\305\"!\242\203\213\325\302\311a\331$\320\327\315\007\034\226\316\353\205\303\nw\375\330\214;\261j\306;\212\"v\337(\034\350O:Rs\332\"\"G\005j\034\314"
+	.string	""
+	.string	"%\177A\3421:\333"
+	.string	" &1\222\317\344& C\337\360\363}\234\323\311\222\021\340\230\274i\030H\3361\241\221\320G\206\035s\006"
+	.string	"\023wh\201\230"
+	.string	"4\230\277\344\037\030\241\007[\250Q<\354\244!\021\031%\205IA!\035\340\"\021*\336\020H\307\244*\303f\362\352\2138q\222+\252Qe#\361\304m x\t\331\3561?\016\333\027z\b\266\340\2050\345\363F\300\f"
+	.ascii	"LwG\250\033U\206\025\242\021\0064 )\350\204\323\003\374&`\303"
+	.ascii	"\204i\203!\200\330+\360D\313YY\034Mn\234U9\\\353\340\322E\272"
+	.ascii	"\271Z\356DC\361\327\013\212_\230a\363\240`%\024<vw\214\322~\013"
+	.ascii	"\247\342\250\034\312X\n\022\265\257/\031\212\324\022\352&\253"
+	.ascii	"y\023\025V3t\252\3556\352|(\004\023\037\265=\025xp[\353\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5.47.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`C\b\305 "
+	.string	"f\364\270K\260\226Q:("
+	.string	"\256!h6\3756p\027\202^>\201S\004Q\256\241o4[\031\243Z\204\314\274n\303u\r0\372\245}\245C=cp\346\215\235\2350vh!\264\013\357_\r\357\357r\2030\001E\3457\322\b!\204l\271\223\f\242"
+	.string	"\240"
+	.string	"\243"
+	.string	"\"C(/\336'"
+	.string	""
+	.string	"\251X\255\314\017\362\241\234\377J<\346\336\237\243\244{\1772>P^\344_\311\314\374\037\007\222\3037\373\013\332\215\276\247\024@\252{/\rv\001\343E\373t\274\3307~;\314\013u\265N\226Y\222\243h\273\336\370\244\004\353\003\t)\267\303\035&\350\257\240\032\025\245q\027\215\031\265\325\363\263GFe\305\270\031\243"
+	.ascii	"\017\035\257\226\005z.xN6\351xR\324\021\306E\024'\252}\361Fw"
+	.ascii	";\026v\357=\360u\305\316D\255\244\204{/\327\334\316\3059\346"
+	.ascii	"\3147\300\314\023\230\311$\001\270\332@\314\267\267\177\230\271"
+	.ascii	"\362\314\177\277\214\255\214\332\312.[\271e+\237\2662\313V6m"
+	.ascii	"\345\322V&m\345\321V\026mek+\267\255\\m\345\033H\267L\271\300"
+	.ascii	"\344\336\026W^\256\0241\250\343DO\245\224\360\231NQQ\t\362\231"
+	.ascii	":)%\361\231.\031:\3423%\302\002\225\303\210\317\224\307\215\036"
+	.ascii	"\031G\370L}`;0w\307\006UR\252\"\306'\302/\302g\312\"\366\242"
+	.ascii	"[\211\323\225B\025W\240\356\275\021\312\213$s"
+	.string	"\016\037\310'\200\253\230\220\017\3119\021\211\022\247\253\340\033B\335\253\213=8fc\327/\b\304\256S\347\320\331\303\302\216q\354\206\342T\305\307\303\212\262]\215\016H\261ft\337\310\311\250#\257\240d\305\006b\333\335\256.L\366\274\324\2672\353~\225\247 \227\336\030\005x\nN\3326P\277\350G>\236\221\327\353\006N\344R.\313\227z\267_\364\363|t\252\025\277\310mU\357V\253\327{/\256\373\375a\b\323N\355\"\253=\300\207\340\300[y\357u\360F\237\202:\365\212[\b\245\254\001\316OF\231>\221\003C\240A9\346\033\021\3659\206\241h\034\247M\252\220I\323\255V\314\2775\265\r8\266\346\334@\003\003\032\005\034\026$\230\305\2148\323\314n:\340d\250\321@\330j5\033\r\r\204\207\f5\032\215\315\rmF\200m5\033lh86\233\r\355\374\335\333\333?3\r\323i\023L\302\336\333\213"
+	.string	"%d\246\n\2654\301\270\206\256\276P\311\013m\327\020uE\231\350K\250\325g_)\350j\365\331:[\346\220%3\373HI'\253\315ae\311\314f\221]\312\310~\222\237wt[u\263\201\270l\262?\22422J\323\353\nC\225Y\212\215\245\247^Bc3=XB\245\304>\222\243BF\277\300#\311\261\305\226\t\200\270\250aT\013\331\214\210\202\202\024\024\024\024\322\001 #\221!n\003\022\240\203=\310\364\304DB\222\221\222X\013{\006\362\351\213\277\215%\026\3664\3004t\301\020\267\303S\036\223R\005l\254k@\266\350H8\341\005\351\313p\277\236=\212R\203\354\200,\024\206\214e\335\242*\003\276\343\236\263\022\320\205\322\220\254F(@IwW\354\207\"\315\214P\234\231\f\264\225"
+	.ascii	"!\352!\213d\201\214\321/\023I\255\022\237o\233\034\177=\303O"
+	.ascii	"k\2072\272\362\343\020W`\242H\340\311\356\225\205\351\341\004"
+	.ascii	"jB\246\323\254P\224\326\371\211!o\215\347\226\265\204\201\210"
+	.ascii	"\323\244\331\246\3416\034`\245K\360D\342?a\200h\264l4\022\"\277"
+	.ascii	"\317Y\024~\202\031\330\256W1\227\312X\243\001\371\361\362\nl"
+	.ascii	"k\201\343\201D\317Zd\353c\365\244\312n\332Q\311'\217\001\023"
+	.ascii	"j-R\207\027\375\016\n\016\024\354`\377\366\321T\"T-\275\371\305"
+	.ascii	"\240\207\007\325\312\323\\\003E\022\005upD\251\371\375m\307\006"
+	.ascii	"\267\360h\021\031v\223\031f\324}\241\234\2260\031\341\n\353\336"
+	.ascii	"\262\347\017"
+	.text
+	.section	.gnu.lto_quickMedianFilter5_16.48.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`C\b\265 "
+	.string	"\3064\271I\260\226Q:-\220\255\324K`\211\253Xh\247\301\025x\303\307\317S\313{N\355\364\225\b>\344H\002U\021\240m\351Z\351P\317\030\234ycg'\214\035Z\b\355\302\373W\303\373[~\020\316\333\377l\226\304\022B\310\2262\311\241"
+	.string	"\240"
+	.string	"\243"
+	.string	"\265\356f\017\367A\260\214\375\2301\357\276\307}\350\374G\342\261Z\215\234\004k\375\321\326"
+	.string	"\371p\177\344\356\356w\234\207\316\346\370\207\264\023}b~\200`j\2556\330\003\210\017\371"
+	.ascii	"\304\207=\343\271\303^\247\253e\226,r\024C\332\234\333\217\021"
+	.ascii	"\250\216&VtA;\207!\375\205\024\203O\030w\301(\342\026\321M\242"
+	.ascii	"\027\\\016\2355D\340\306\216\307$\201^\n\241\217Q;\241\037\026"
+	.ascii	"[<4Q\202\351\212\367\031\344Cgj\255\007\236\201\202z\230\307"
+	.ascii	"\b\265\326e]P\212o\354\273/\260\273\022v\307#\001\273\277\035"
+	.ascii	"\356\243\335\323\332F\273\313K\363\337/CyO\312\353\242\274-\312"
+	.ascii	"kR\336\222\362\262(/IyG\312+R\336\220\362R\312\333\224\227)\357"
+	.ascii	"\013\b\030\242rAK\255(\256\304\324)\241S\215\007\271\354\307"
+	.ascii	"\2225eJ@\262\032Nk\312p\310\212\202k\312z2\240\2465e;\335\024"
+	.ascii	"\025\323\2321\253\037\"+E\326\214e\231\341\201U\237\0360\301"
+	.ascii	"\330\323l/d?d\315\330\223\331\227rd\r\222*\200NL\325Z!\220\017"
+	.ascii	"\307]\235=p\315\230\221\231\322\201\350<\310\b\262\006)\370\254"
+	.ascii	"\246\002\315V\007\302f/\246\0173G\005\033\242\330\035\345J\025"
+	.ascii	"\237P\271\20563\031\350R\026u\237\310\307-EN!\t\r\373hiw\273"
+	.ascii	"\302@\321\357\223\370\220\366\263\324\272_\005\213\323\227\236"
+	.ascii	"(\005\370\tN\232\366Q\177\351M>!\221\327k\006W\306'\035\227?"
+	.ascii	"\365j\177\351\347\311\340\341\252\375\220S\252^\345\252s\255"
+	.ascii	"u\247\373\355\001\b\224\017\207\241q\013\360\355\356\201\003"
+	.ascii	"sd\255\265\301\373\304\342\304\303W\333LT\220\\~\241\2102}!\007"
+	.ascii	"\2028\221t\2738!\370\272\2351\321;\013\300\212\225\214\211\252"
+	.ascii	"\\\02567\r9\324\346\313 \303\202\232\004\033\024 \250\305D|k"
+	.ascii	"j8\034r0\334l\037p\267\033\256\306\366\241\003\206\233\255\346"
+	.ascii	"\006\307V\033\2608\033\r7\266\034\034\356\306f\376\352im#\232"
+	.string	"\236\341\351\236\035Ak\355A\230R\242a&\274(\230K\312\325W\262\344u\266K\352t\271`\235\257\244V\233\375$N\256V\233-\263\305\222*i\254>\222\240Y6K\212K\032\253\313\261I\332\330?\362\363\232N\251\316\352\243%{l\017$md\021\365\272\272@\305\"\303\326\322^^IbC9x:\273\204}#?\223\230n\2017\216b\207-C\243&\006\200\267\250aP\354\330\214\210\004\005)(H\n\351 #\221!n\003\022\240\223=\210\364\304DB\222\221\222\0302\354\031\362\351\213_\215%<\366\030`\272\272\310\030\333\211R\207\365^\005\2440\f\310\234\"A(\341\006\351\213!\277\016<\nQw\216\005\300\231\201\204e\331\2422\003\376\301\375\323\334\364\036\300\272\002\nx\022\025\322_\361_\2124f\034q\312\361T+\277\276\345\257\0265\004,\243\253\334\210H\225p\353\353\362\370\354\f\204\274)\312"
+	.string	"\306\005\355\021\341\210#\001N\256-$\304uG\250-\231\002\263BQI\347$\202</\3368/j\032JN\222z\233\206\333\224"
+	.string	"\262v\211\037\204]\242e\331\\$\221\3741g\221p\001\312\300s=k\256/cGC\371wj\020\330\300\302t\0079\240\223b\005\252\312&\272\303\323G\204\001\223\262\226l\301\314B\235\305\304Y&v\272\177\033i$\232\301-\275\243\305\365\207\277\327*(\256\036\257\221\370"
+	.ascii	"\204\243\252\232W\276\222&\024C\026\300\026\207\b\003B\tU\025"
+	.ascii	"\240z.\255:=J\035\263y\316\037"
+	.text
+	.section	.gnu.lto_quickMedianFilter7.49.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\356\016U-"
+	.string	"\312F\\\017I\220\234M:H\204\210\217\371J\024"
+	.string	"D\344D"
+	.string	"\004\260\005\272\373\005\342\310(\016@j\b\037\260o2\352l\224\212\310Z+\267\002L\004\360;Zt\035\304\"\254G\267\352\036\013qcww\267F\210ZSk\204\020\262\345N2\345"
+	.string	"\326"
+	.string	"\340"
+	.ascii	"\350\217\036%_\"t&%J\"\244\bP\300\260{\221z.\362\202\362\342"
+	.ascii	"\275t\320\034=\2652?\311\247\204.4\361\332\2758\256\260\356\025"
+	.ascii	"\3720Oy\221\205%\337\310\217\b\361\220\0256%\215P,TP\255\271"
+	.ascii	"\367\376v\236\033/\332\337\306\213\255\343C\327\001\320\343\345"
+	.ascii	"\354t9\334\315VK\321\22363e\261\222\034E\333u\210O6\260RY\246"
+	.ascii	"\034%\021]\347\310\001\0341R{R\347IE\325\234\"\337\025\361Qu"
+	.ascii	"=\236\353\301\243\342v\374\266\003\252\332\236^{r\252i\323\321"
+	.ascii	"\246\032\365\244q\032\215\031u\266tsIF\225\305x,\206\200 H\300"
+	.ascii	"Z\n`j\241t\362\013\222\222\212:\302\270\230\002E\265/\336g\222"
+	.ascii	"\221\335\271\367\236\352uE\322\211Z\311\006\367^\256GI-\316\001"
+	.ascii	"\316\\Efv\300L\213\021B\242\332A\346\333\3338\230\271\262\203"
+	.ascii	"\013\177\036[\271g+\363l\345\034[yg+\353l\345\234\255\214\263"
+	.ascii	"\225o\266\262\315V\256\331\312\251\255\214\332\312\247\255L\263"
+	.ascii	"\225g\266\262i+\313l\345\230\255\\\332\312\244\255<\332\312\242"
+	.ascii	"\255lm\345\266\225\253\255\374\007\272*^*T\335\313\"\316\233"
+	.ascii	"\353%j\3718\223\237\371\265\026^l\326\\4\325n\027\2335\024e\266"
+	.ascii	"\260\231\242\331\222\205\315\324K\r(W\330L\247\024\341b3E\222"
+	.ascii	"\346\250\302f\nE#}\241\305f\nL\213\260\330LU\204]\261\211\016"
+	.ascii	"g\204uY\261\211\202\321\261d\005\205M4k\307(\275F7\326`\241R"
+	.ascii	"=\374&|'l\242S=\257\032*\211"
+	.string	"\220J*+\226\302\356\275\f\312\2134f!>\025\233\001>\262\230\214\034\226M\366\245\\\305\312&\207\347\255\3269\241\251\244\221/h\034\nlb\245\330`b:\215\223\022\032\325\335\245`\353\034\212\375(?\243\254>\001H\222\035\344\261\305\336=\201\215cW8>b\3274\346\224ID\002\220ql\037\227\032Ff\306V+\236\241lF\367\237\2344\003\345\021\262\254\330A\266\335Mk\343\263}2\335\0173FK\r\323\330\205\352\020\260\264\355`\277\352WNJ#\220\251\021\210!\267\216\316|\213\351\366\253~\240\215\242\352\206\357\344\226\r\323\255n^\357\275D\335o\016K\272\214j\233/\361\2745^\254\255s\032p\252\241\362\336\233\340}\216\321*\252q\270\271\242\312\252s\3262\362\364\233\234\352\303\331t\304\034bD\375\021\357\244h\"\326\r\251\\B\276\334\352\2069\036\2000\210\260\036\316\b.\034\370)\220\301"
+	.string	"\001_\215\304\371\307\027B\203\b\013@\277\016A@@A?\277\016\033,"
+	.string	"\375~@\204\370\371z\034\344\001\003\210\237\210\240 \020?Sxoo\343\340\336)\352\023\\\302\336\313\304 L\211\203\312E\345K\353\364x\375.^"
+	.string	"z\315\033\366xY\261\336\256\317\341\256\317\345gT\327'"
+	.ascii	"I^N\357z\367\224\263\313\311\265\316'\327\327r\322\314\226G\310"
+	.ascii	"\262\273\016\262\256sMk\243\353\223\311\351n_\270\341\255\217"
+	.ascii	"%K\016\327\267/\334\3606\205\253\201\331j}+Wn\266\256\201\331"
+	.ascii	"j6\324\2276\332\337\342\252\245\215\246}2hJ\003;\233\326\247"
+	.ascii	"\362\003\253\334\2629\332A>\233\326\034\300N44$\247\3715\363"
+	.ascii	"\231\375,-Z\007y\326f\357\236\276f>s\026\363\221\305\372S\260"
+	.ascii	"LY\307\002\201*\250aX\b\035\032\021\005)((((d8\261F\"S6z\022"
+	.ascii	"\340Ri\220\310)\206L B2\"\221X\320\202\324\036\262\3750\336\320"
+	.ascii	"Qux\371\312\355\255\032l\005\\\362?\347\221\034@Y\350\336\333"
+	.ascii	"1\021\322\232(`\267\243*si+B\250\214\334\206\241+\243\327W\274"
+	.ascii	"\264r\235\256\276\n\241\376\270`\031\363\223\244\3578a\022\375"
+	.ascii	"\372`N\377I\raX\031\303\034\215\224;\026\255/O\031\217C\246#"
+	.ascii	"G\314\244\336\026[l%\324\237\314I\006\265B\306\337\250\312\376"
+	.ascii	"\315P\235\202R\311\200\252d\347{m\227[\264I\312\037\244\003\376"
+	.ascii	"\001LJ\231\204\226\232k\321`#\312 _$V~T*s\343,B=\023\273@\244"
+	.ascii	"\252\224s\335\005\223Q~\216\361\212\230\272\360\2759\366FWfM"
+	.ascii	"Cj\"\365\314\034\336\301\330\355h\25443SQ4*G\326MTR]px\241\023"
+	.ascii	"\306\271\006=i\326S\220\026\317\317I*<\306\240\265\301L\331\345"
+	.ascii	"YN\316DL\022fg!\310\0339\236\246\022\334\t\bEu\"[k\201\020s\226"
+	.ascii	"#\331\270F\231H\231m\232\306\020\223x(\250)\034\255\210$r[\032"
+	.ascii	"\374\020?U\006\2326\t\270E\210\024\316v\310\267\237Wa\266&\362"
+	.ascii	")}\031\237G0\003,;\353c\277I\340\224i\216Hvx\207/\246 i8H\264"
+	.ascii	"\264\265\264\221\273\243\226q\215yU\355*Q\244/,\303\306\256w"
+	.ascii	"\222\350\021\b\351K\374\242\242\007\031T\373LsU\317\221H\220"
+	.ascii	"\204\236\365\230\221Z]\216\243\031 \351\300\n5To\303\352j\250"
+	.ascii	"^\r\325\333\260\272\032\252WC\365\257)&3\352~\241}Q\235\202\351"
+	.ascii	"\312\363fC:\177"
+	.text
+	.section	.gnu.lto_quickMedianFilter9.50.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\254\025]8"
+	.string	"*X \023Gp\234N\007\2247\201\327\243\202d[Bg\376\337\262\224\250i\326\322\257B\317Z\321\020\244\311\031\246\320|\361]\274\313~1\304\270\230\3303\235+\327\376~\341\367b\267\211\b\263\352(\212,\331\335K\2156\3312\245\224\002%\001\t\001\031\001\r|}\022\231\235\270\3118\rr\025!\351$N\255d\204\017j*B\016\036v\367N\025\365\311\f|}\272\r\241`\215\"w\346\016k1\247\036+\321\303{\263\322\324\356\0353b\001\276>y\314\307\314\334E\032\314\211\237\354\330\026U/\207\016\025d\313{/\022\262\213\275>m\023{}>\216~\352"
+	.string	""
+	.string	"\210\206\204\202\200\222\310\037\237\036\236\035\235\034\234\243\261xC\264\031\326\bW5\230\002\177>\264w\332\367'n\324\201\375z+\223\242\202\352"
+	.ascii	"n\r\300\355\211\023\245\365P\232\023\027B\353 \264&\016t\326"
+	.ascii	"\3113&\2164\353\03731\367\t\353\2360#\316\003\326;`E\\\347\253"
+	.ascii	"s\276\274\034\207H\037\211\364p#\217.\362\330\3417:\232\250#"
+	.ascii	"\207\333t\365\260\213\313k\266Z\270U\303W\032\255\322\230\341"
+	.ascii	"A\031\235\312\210\341@\030\375\203\221\3741u\345\276$V\225U\243"
+	.ascii	"qSV*\274\367\242\317\024(\334\272\350_\251\242,\362\336\333d"
+	.ascii	"\355+\250N\270\243\016\356\275\354RTU\315\002\232\331\2670\363"
+	.ascii	"\003f\"\211\314m\357g1\263sR\217u+\260\316D\326y\310:\013Y\347"
+	.ascii	" \353\fd\235\223\326\031i\235\177\254\263\217u\356\261\316<\326"
+	.ascii	"y\307:\353X\347\034\353\214c\235\217\326\331h\235\213\326\371"
+	.ascii	"\306:\023\255\263\215u\036Z\347\032\353,\264\316"
+	.string	"\253uV\255s\320:\247\326\031h\235\177\326\331g\235Q\353\334\263\316\247u\266\326\371\255\263[\347V:Vi\251 \346\336\026i\2307\313\271\326\243\225t3\367j\246\216\323u)\306\345\013\247\353\227(s\234\256nG\272p\272.\t[{\310q\272\006Yg\304q\272b\255+\262p\272N\031\301\203\343Tmzy\343T\255c\253\302\251Z\005,\211\033\247\252\231\352\243\215SU\210ZC\n\247jV\021\225\305\032\247jU\236\032\247\352\245K\3434\030\346\313n\n\032\247\3017\0342\310\3168\r\236!\243jn\324\215\245Z\020H\021\367\022n3N\203D\212\272\354\311\0075\345\213\262\302\313\356\336\033\237~C\351\325k\255'\\\241j\360\323?v1\203.\325K\203?%\360\177\337O\032\035\243\326\021\240\330\364\265\030\370\277W\317(\201G\277\007\242\357\033\200~;\351\276Jk\213\327\277\327b\337\243\277d4"
+	.string	"-\023'LC\001\357\347;\233b^)\364\352\375\303-`[\313\234\337Mz\365B\353\tW(\332\373\363\217]M_\357\275\311D\317we*\226\016\221\340\243\327\373\345\22599.+\340\030\373\216&\240\fp\306\1773it\314YG\200b\317\327b\373\377\352\231\345i\277\353\270\224\266\231\355[\216n\315\fV\017\013YC\240\362\366\265\276\313:\215\313\252w\205\365\b\346P6\251\273f\303\272\337e\335W6Lx\036\267Y[<\254\353y\355\367^\250\377\376\245$pQ~\346\316\233\331z}\372\033\271\214\232\354\311w\357M\320\277\322\255\231\3604\374md|.\324l\245\247\340{I\223uX\267\244\230?\204\360\226bd\212\207b#\234\267]\211\273\236\307<\006\345\257\025\034\230.\200\260\034\232\021X8\240T"
+	.string	"\203\001\002GC\021\315JG\0372\200HbB\332\320\304\304\324\244\204\264AC\022\023\222\222\207\017HG:\334\304\341\202\007$\020MM\036\220\322\261\333\366~V\322#M\374\t\036a\357\305j`\207$\311\247P\305}"
+	.string	"\242\241o0u"
+	.string	"\210~\350\216h(\rQ\2202\350\233\356\313\220\320\007)\205\202\204\222w@\312\344\267\227\271 \240O\336\001)\223@?L\344\377|s\351\222|-F\376\317/1\221o\374A\203\354Y\372\334\365|o\221\373\361\371\236\245\317]\217\317\016\217\321\316\267\226\270\036\236\337\3411\332\341\311y\235\243\234o,Yv^\213u>\347\227t\216r\362t\216L\034\345\361\373\n\\\016\316\037\2318\312#N\261i\\\026\277\255\274\035\215_l\032\213F\342\321\r\361\233J\367U\225\266x]|-\276y\342/\035\335\f \342\335\f\2336?\374\236\322\253\227[O\270B\2116?\374cW\323\346\275\311\034\332\b\2275/\374fk\033\326\274pY\243\024\326\250\253\372\035E\212p}u5R\315\254)3\030\201\243\250a`'\025\215\210\202\202\024\024\024\0242\034\361F\"C%n\022"
+	.ascii	"Ri\214\352)H\020\t\204dD$\020\013\232\264\366\262\236/e\240\357"
+	.ascii	"\n4\227o\347\3273a\\7\033V\032\327M\204\345\276\212\006\035\251"
+	.ascii	"\330\346\004\242\326\342*x~\200a\245\265\216r95\345\237W\267"
+	.ascii	"\367\314\347\305\224tm\246\202.d\332\332\242\235\337\325\206"
+	.ascii	"\0320\2407\253\214\311\331\272~\206pg\341\210\004\304\\\360\024"
+	.ascii	"\213y\212-*s\\\212l\r\347\376\022o\261\315\276\223\201\377U\213"
+	.ascii	"\031^,A>\213\344n\225Y9\233\211*\343H\224PD\346\r\346\342\210"
+	.ascii	"\267\330J\263\234\255\261\377z3\257\270EWD\205\3022cf\345z\277"
+	.ascii	"\207\025\260\022c\240\350\327\332G\262\341\210\210\274\016\306"
+	.ascii	"J\312\326\020\261\025\017\022#\322fH$a[fv\007\373.i\277\016|"
+	.ascii	"\257\330\211\305\212\013\227\363N\273\033\321v\261\256]'2H\332"
+	.ascii	"\341z"
+	.string	"\356\005\236\205\362+\027!\313W\211\030\265\031\246D\313\264\200Ke\266\002\306oj\2308\214\007\211\221\321\307\022\370\247I1\013\031\315\311\275:#pJF\232\303\227\234\017\243&\001\211\023\313\202\007o'mtdg\222\037\240byP\232)\307Y\013u\354V\235e\021@F\001\252\\0\003\215UQ\255\353&L\240\n\320,z\036\030\367\261\373E\224@\231^\220\241\203(\021X\321\327%\365Z\t\312\tU\230\017\304\311\374Y\3125\304\324<\002-\016\tc\373<\3208v=%\254\261\365\211\033\205\210\227\262\210\344\233\177\256B\304\232\034N\342?\361e\004\213\201\205|\373\330\336\244\225\337izK\326\346}\274~eN\262ELe%)\221\371K\225})\321\253(\355\331,\205T\026\245=*\373R\242W\211\375\277\230\313J)\325.J[\252{\307:\017\277 \350\3418\252m\246\271\367D\2218\257\260\205"
+	.ascii	"j'x\337\026\352\266\250\367\204\275\035\355\275p\267G}/\354\355"
+	.ascii	"h\357\r\273=\352{\341nG{o\330\333Q\337\013W\315\371?\243\232"
+	.ascii	"\017\022T\030GDZ\240\232\215\257\377\001"
+	.text
+	.section	.gnu.lto_arraySubInt32.51.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`|\002\025\024"
+	.string	"v\346\204H\320\322(\035jA\324\003\232\214\355\367\0320\212\261\341\267\234\021j_\252%\2622\004\354\261`\337\2237M\017\376\370%\213\243~\354\231\246Z\347\021\250\037\f4Eby\306\222E'\333\2160?\327\202\255\361\222O\310\2262\245o"
+	.string	"m"
+	.string	"m"
+	.ascii	"\276\213\373\324\376\363r\326\2349>Ds\216%F \036\364\370\001"
+	.ascii	"\341A\361\002\302\203\256\331:>\356\314\017\r\315\004\371\230"
+	.ascii	"s\272\366\204O\277\337\357w9\336Rk\007\345j\315\337\335\200\214"
+	.ascii	"]N\007sP\236djR\254t2\362\204i\251\350\275+\215\356\246\262\307"
+	.ascii	"\346\373\336\023 \355\310\351l\256'\2249\2475\247\003q\207\267"
+	.ascii	"\315\301v\005[u\002B\277\352\274\033\245j\361\352\223\252\303"
+	.ascii	"\253AU\313\253w\325\272\352\007 \300S\303\302\2159k~?f\022X\244"
+	.ascii	"\342\274\337\276\312\326\362a\370=\247T\267\226\315\263\221\b"
+	.ascii	"\363A\334\r\371\226\346\234$\007MA<\370\224\235\352\321\322\027"
+	.ascii	"\017\252]\310F\022\300\2141\021\202h\316Y\342\t\342\301\021\231"
+	.ascii	"R\002\002\"a\306\210\204\"\036L\025\265\256\016,.+\034\352\313"
+	.ascii	"\361\bW\256\270\233\003\307s\023\331\323\236\026\256\026\\\231"
+	.ascii	"\303\367up\021Q\370/\341intCv\3678\026\362\216\021~u\217[q\323"
+	.ascii	"\237Q\373]\337L\020\233\376\254:\032\261\273;\222\321\255I~\336"
+	.ascii	"!\224\260i\223\337\273l\201\243G\"lLm\262G\030]\035\373';LK\336"
+	.ascii	"\034\233\365\237_\344@\377\352\343\037\362*\247\255l\220\301"
+	.ascii	"@\023\006\036^\263\331+\364\203\013\016`&\031\032,h\261h-)\030"
+	.ascii	"\244a\255\026\r\264W\314\265\"\213\305d0\327\212\312+\346\202"
+	.ascii	"\315Z\\\255\002\226\261\244\314\\4\231l\346J\215\363\233\343"
+	.ascii	"\357.\036\365$\331\366\006\256\216Q7\313\332UR\222\243\226\306"
+	.ascii	"\266U\213\332\bH1\312D\003\007\265(6m\272\234sN\311\332\363>"
+	.ascii	"\242\340\250e\355q$\016\210\353\373\0021 \240\002\031K\361\345"
+	.ascii	"X\215d\021X\363;/,$\316\252\373\323\230\1771\207\253\265\n\324"
+	.ascii	"\244DI\334\367\341:\311#o2_\236P6+f\261\334E\351\224\367\204"
+	.ascii	"\346>\006S\234\207p\343>\242p\030a\026s\275\032r6~J\255\304\231"
+	.ascii	"\330\300M\264\013\3340\2074'0\214<.\210\006V\227\371|\323\302"
+	.ascii	"P\037\357C\244s\301'"
+	.text
+	.section	.gnu.lto_sensorCalibrationResetState.52.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\324\002\375\024"
+	.string	"\366f\207J\260\324Q:\214$\277\372\314\252WA\350>7\024$\005\367Z\337]\302\262F\031\272\223\315+\204\236n\234U\261\323\324\022\362)\253lU\260\350\203vvvvv\304\304\372o\314%-8#\034\024\331\030y@\213\335\b!{\247\024q"
+	.string	"l"
+	.string	"r"
+	.string	"I\2738\bnP/\032w\223\361b\375\200\361\242=\263\205\034w\333\367\230l\216\242v\267\244.B\207\017q\367HgW\325Q\f\351\234\371FW\300\304\273\251\315\\Uu^mtO #g\305\034w.\206"
+	.string	"\202B=\001j5\341\004\036_\360\274O\234\032\315\f\203tN\257\273\003\037\277\233\332\316\247jew=oj*n\222\333&\262\235\301\236\275;\245l\334\314\244?\366\t\370\202C\2466{U_\364\217\337\335\363\271\373\344\t\324\017\r\274\335\024SF\266I\334\001\364\335\237#\211J\377\310\347\231$g\354\220zO,\365\"\031\243\364q\276\316\344E\022\250\264\355\333\370\215\331s^\25239\225\327\013\002\265\273\254\213\306P/\242\204'm\322\247\374\264O\3435f/\222y\311\256\355H\254O\212c\333\341\2754N\312\362Tb\026\361y\017\211x\2056\245\036\356\356\206+\372\335QhS\312\017>\351\212\336\004\013\2329e\006\300\245\237\355\271\300\266\210\373\3743p\263M\342\275\230\023\247\335\265"
+	.string	"\342H!\352\356\252\340\200\2150\271\301\270\350\313\214\027\021\334\242hs\312\347\375(\200@Jy|\301 j\326\205\026\264)\345\353\036\016\371L\240\022\220\036\376r\253l\250\320\222\300\201B\204\224\022\027Y\213,&\272\225\022\353 kq\2250/\227\353\325*a^Z\\e\013\026+S\n\370\365\301\005V\312^/XI\342\366\324f\243W\340\220&\032\245Q\321\037\277R\233U<\304J\351\323d\375\024'\307\317t\372\334w\267f\254\364\271\323z"
+	.ascii	"\250\244\303?\023\247\330\223b\004\2348\375\004\260\307tP\210"
+	.ascii	"'I\244?&\351\241+*\276\250\001: \260\002\031\253\331\006\026"
+	.ascii	"\263\004\254\371[\266#\216\253\212.C\263$t\007\006\322\274\273"
+	.ascii	"\021bQ\220dLL\f\204o\232\026F\361;\224P\021\336\202\020\227\311"
+	.ascii	"\206\3021\266\213\342(&\270\303\341\003\302\306gR\234\270\320"
+	.ascii	"#\215n\334\267(n\002\207\021i\035^\273z\023\025\261\307\257\375"
+	.ascii	"\310\200]Mi\377\004\263\335\330\bT\300\013\353a\230\001\355\033"
+	.ascii	"\352\350\205\203\3147\203W.\343A\271s\235'"
+	.text
+	.section	.gnu.lto_sensorCalibrationPushSampleForOffsetCalculation.53.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`S\016m("
+	.string	"\232B\004\016Bp\350I:\023\210\241&I\b\023a\202_\241\f`\0020C\t\b\201(\357\371c;\200\b\351\3316\310\305\312eG\232\366Q\271\2300\205\022<V\221\374\003\300\256\311'\237<\322?F~#-I\231\002\276"
+	.string	"\257"
+	.string	"\344"
+	.string	"_;}\335\3645\323\327K_+}\355\333\255\223\276F\372\372\350\353\336\327\344nm\3645\357\353\361\353\335\327\337\255\367k\245`\245&\316\2057s\266\250K4\341\214sH4N\325V\325b$\244\266R\263(\334P\343,G\252\271\220\"\362q\3733\347\334\322\321\024H\035\257v\372\304;ZT\356Z\255\\\031\261e\202\365\315\356\351h\t\244\216G\201J][\245\350\224\241R!A\3054K`\021\"f\316\267.k\221:\372M\243x:\222\372\304\323\321C\273\217\276\271M\365\202\350\004\234\2419g\371 :\324\035ZU\213\366\332^\250\351\032E\230sz\333^\300P_mg\331\266`+u\tl\377\017\206\370G\303\fQ"
+	.string	"I\353\b\236\216\373\335 \0256\276X.\312\3156\227z\t.\341\231s\216\205\320.Br\316)\306e\330&\302\347VDG+\t\236\216\372(!sk[\347=sH\316\\:\373Mm\377\303\326\335\274\017[\343\324dzE\025\202RQ}\360\365\330\327\016\276\026\373:\354k\260\257\033|\375\3655\203\257\275\276.\277\376}\335\3655\327\327[_/\370Z\353k\005_'\370\032\301\327\007\2766\360u\326\327\005\276\306\372\372\352k\002_\017\370Z\300\327\001\276\006\360\265\325\327U_S}=\365\265\324\327Q_C}\375\024L\016\374G\260DI\222\003N\f\034\311\021#Y\367\335"
+	.string	"\221!B\262\226\024x\020 ?\260~\365\002\276c\365\340\261\343*\t\201\353\310\201c\300\251N`o\330\2501@\207\200\323\230\2612\002\\\351\0026\006\214\027\001p"
+	.string	"x\013\026\273\302\352\344\001\254\212\266\024V5\252~\202\270&\250>\365*\362T\313\266k\2536EC\352u\213\024E\035\352R\344\243\350\020\035\202\222\361\364B\204\0069\275\367'A\201"
+	.string	"9\251\211\321t?}\3700\375o\372\351\036=y\230\352\226~\307N\035\245#}\311\367_)\351\2769d\222\272\3218p\336\254\272\310\323\021I\321\321\331\254Q\323;\357G\344\377\336\325\350\344\307\"\232\235\321y\305.5S,\303\243\033?7F\214\266\005\332]?~\007\021s\260m\235w\037\213D%\001@\021\025\316\320\312D\204\020\366\316<\200"
+	.string	"\226\tyfg \204W\032\320\312H\213a\b3\373\312"
+	.string	"\346\365k:K+K\023\2166\373\t7\244\225\001\313\017A 0hV~\340P\006,\315\320\204\345\317\312A\020gheZ0\210V\"\275M]\003g\355l\036;\236;dw\360\261o\233:t\034\244\021\273\2348a\007\273\230\357ao\334\200\235ip6k\276\316\340\r\310\177\245A\303\240\350u3\305`\371\337\275\276d\377\313\357\340\210J\330\226\214\345\226\360t\330\271\340\357Ky\346\326\310\220]\343\364jm\351\334u\254\223]\333\020s\260\355\336u\336\030\256\213\221\3330\226So\2119\327\262\266\316\345\245\013\227\255)\013\256%\016N\353\276/\300r\305\212V\024\005\257BeJ\202\223W\020\005\312\223\004O\020\334I\223\200\367\250Qt\211\304DD$IQI\322\032\360\002\021\0212\325\001\021P4E\214aFi$Y\261\234\016\006|\021_\233\204&"
+	.string	"\310\035\n\236"
+	.ascii	"_\245\325n(\273s>\360F\302\366\251\250\356\030\3719Z\016\276"
+	.ascii	"\241\017\031\347\374\327)\341(>4\274\206\2179\324\245Q\3027I"
+	.ascii	"9)\360^\253\264\345M\310]\304x\360M\245\023\002\265}\305\005"
+	.ascii	"\006\203uf\215\223\342\210\0011\345\272y\331j>}\226\244\316#"
+	.ascii	"\274\351\260\221\355\3474\305\254v>\021\255\263\324V\001=l5\237"
+	.ascii	":c\213\206\352\245[\005U\003q\036\352\237U\252\003\002\327\224"
+	.ascii	"\b\002\354\327\360\275\342\027\b+a\307\023\264\006\320p8\275"
+	.ascii	"\373\371\223\214\016\316\253\305\214\336\006\351\315\3177Sj'"
+	.ascii	"6\025\237\242&s\344l\357t\376\"\316S,`!\321h\213\371\330\232"
+	.ascii	"\372\340<\266$\235\250\345\254E\300*k\3048\351\325\277\300V\024"
+	.ascii	"\216~\271\305r\303\215\274-\274\230\257\235\261E\213\332\252"
+	.ascii	"n\024\237\236\237\205\362\243b\347/\262\002\033\017DZ\204\252"
+	.ascii	"\314UT'}\253|\370\331\371\207\375\235U\304\034\264Q\264\220\354"
+	.ascii	"\371$E\fM\255\275\226\322h2?\2020\347)`\242G\337\314\272N\311"
+	.ascii	"<D\217\007\333I\300\314\231e>\274+\354^\274\033\260!\200\206"
+	.ascii	"6\332\340\005\302\336\275\205\324\331\"\005kSipf\214\225~\365"
+	.ascii	"\3622\322\021]/\341I\005q\272h!\025"
+	.text
+	.section	.gnu.lto_sensorCalibrationPushSampleForScaleCalculation.54.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\347\005u\037"
+	.string	"\2667\300G\240\232Qc\254\327\353\352\376\366H\217\362\324\333fvW4\320\027\206Q\036B\256\340\303\234)\204\251N-\262\360\341jk\rnY\366<.\361 \3079\035\034\362\304\234\304\310Q\036\322\226\261\324\362k\366o\262\345\2262\245\246"
+	.string	"\235"
+	.string	"\257"
+	.string	">\267\316P\336>f\233<\242\276Xx:+\365\211\024\031\321D\202?\304\236\271u\204\362\326\204qR\341\201\024=\210\255\306\331E\202\301\003\311\275\367\307\017\312\333\236\321dq\236\332\357q\037E\377AB\300\354\"\tqBr\257\360\307\005\312[\013\217C\336\226\007@\336\272\310\316r\241\323=\325S\022\221/\367\336\263\316p\375(\274GZt;VZ\344\303\202\214|"
+	.ascii	"\026&JA\243\333qv\357\265\t\226\030\021\320\245\340\021\035m"
+	.ascii	"0\275~\352\006\256\f\225\202L\247\260\240{\257\251R0\305M\336"
+	.ascii	"6\317v\316\266e\0027Q\364\252\365\336kT\355\343\300\305\217\212"
+	.ascii	"\361\247>\346xA\213]Y\227\212\261\205F\264\312\260\377[c\330"
+	.ascii	"<\257\272k\217\372w^\344\327y\220?\347?~\234K\3354K}c\251g\226"
+	.ascii	"Zf\251m,u\215\245\246\261\3241KmZ\352\031K]Zj\230\245&-\265\245"
+	.ascii	"\324c\245\256#5\035\251\337\263\303\024%\007u\357\211\2571\027"
+	.ascii	"\212%>\275\352\2272\211\247O\345\017\0353\223T"
+	.string	"yX\032\241\310I\342\332\241\001\352\364\217\370S\216\335\232Q\247-e\253\322\bE\tE\245c\313\2757K?\247U\b[H4\314\223\0274\007\375\250\230\217#O\275\324\201\323*O\375\233\212]\261*%+\212Y\313\032\253\325\352\211\207\001\234\200\356\004\313\254\001h\200\231\251W\305&W\342RVX\235\251\225\013\330T\253\265ZV\313u\341L<\254\331\236\360%9\034+\367\336\006\272[\355\312{/\003%\025B\310\234n}\022\344-\254\326\264\2104E/Y\265\372\252\367\220\325\326Z=\031`q\247\222\225\244\032\253\255\325\013\270\305'\212\350\2255\374\021\344\227Z\320\252Sk=\020\307x_\221\257\264\036x\343\210~\231V_-VR\231\037\375\362\207\017\270!\"\235\215\002\007\334\220\355\326\243\021\272\017\347\201g\363\221\270!\"\235\255G\336pD\275\036\017<[\331\023\022a\033\315`\303\202[\202\016\n\020"
+	.ascii	"\335\340|6_\317\372\006\324\373\340\263\351N\020;\235nw;A\b\331"
+	.ascii	"t\347\215\327;\201t\274#\302\361N\337n\307;c\302\373\337\032"
+	.ascii	"\303\030V@\371\325#\337\3240`r\263zS)V\027\257\231\nY\355\342"
+	.ascii	"\222\263\251\262J\275\264x(\263\"\364,9\233*\323\"^\005\263j"
+	.ascii	"*\026\017s\256\344d[5\036\336\024\351\336\037\001\232ZS+\025"
+	.ascii	"\260\251\212\2079Tr\262)545G\213\3703r\263\370e\253\f\303\212"
+	.ascii	"\225\247\326-\352sZ\rp\250A<\306\030sdfD&h\222\024\032\003\240"
+	.ascii	"\002\021\0323\036\022\340\0056\304\004\314\241\224rbk?\003\226"
+	.ascii	"\325\351\034\236\3467\232,\365\350b\322Pq\251\2720\356\241\254"
+	.ascii	"\342\211\304\363\254``E\007*\026\265~\253\225\\\374\026+\222"
+	.ascii	"\231\200\021\3346\234\267V\033Y\353\304\323\2549\261\2465\264"
+	.ascii	"\304_\263a$b\342zB\r\260:q$\221\207oE\253q\366\034\330\2316\367"
+	.ascii	"Q\2107\273\346\2771;\317]o\234\034m^\005\343\204\241x\223\246"
+	.ascii	"\263c\221\334\240\224,`\361\020Kc\203\353\342\347\233$\226\304"
+	.ascii	"\n\354\335\355MM\227\240\222u\262\254o\376\013\311\013G,\212"
+	.ascii	"f\304\330\251\277S\360 \225m\234\361\233)rX\350\236em\205\365"
+	.ascii	"]\304i\221\022\3374\235[4\200f|\245\2360/\ta'K\362\036\3677u"
+	.ascii	"\007\265\376"
+	.text
+	.section	.gnu.lto_sensorCalibration_gaussLR.55.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\207\b\365)"
+	.string	"\032J\314\017G\200ZN:_[\224sL\nz\241\306\202\215\367\250\341Z\n\330+\244\360\b\362\035\r\365\344\233Bk300\"DI\203\3468\337\347\270\354\3243s\214\017\312l\301\007\366j\336\345\220\310\2627\263F\266\021\222v\222\001\356"
+	.string	"\326"
+	.string	"\346"
+	.string	"U\214\206\024\013\247\315\336U\223\227\230\211\225\321\326\312y\325u6\221\213\202\246\326\232ds+\2346\207%\017K\223\351\032\211\223X\211\225\221),\254u\fNJ\255\310\004\273"
+	.string	"\351\036\235\315\323"
+	.ascii	"t6w}d\227gs\017\2346"
+	.string	"\255v\317\030IVwfO\264\322\330\324Z\215\337Q\362~\237nK\227H\357Og\345\034\235\237\020\350\353\361\316]Pg\226\247Vk\2423k\266\274\256\234\023\303:\216\353\252q\203\376t_4,\364\021\314\3002\033\3247\303\2752\030\327\025&\203\362\206t|\201\371\244`\326%\215\330\327\f\357\316\027\016\226?1@\302\200^Z\345\022\330\0231n\363\320Y\027\031\325\305\260Y\006k\255@\257\025\245\002\312\345\205E\313\037/|\267\3314sK#\366E\303t\027\241\326\272t\313\353\313\273\343]\263\330\335\f\273\273\261q\226'I\344\257\265\036\277I\017\202l\304\325\032\245Q\350\314f\b8\216\324\315\322\344\214\270J\335\354\"\257\350s\354\372\254\365j?\266\333\304\264\244d\244m,\"\031\315{dd5/\321k\336\242\222.\221\351\016\235\356\360t\013\224t\205L\227\300\351\0168\335\240\222.\220\351\n8\335"
+	.ascii	"\247\373S\322\365)\351\366\224tyL\027\300\351\356\234\256\260"
+	.ascii	"\244\033,\351\352\230.\360tsN\367W\322\365\225t{%]\236\351\236"
+	.ascii	"\247\273;]]I\327,\351\226\246\373\323\245\247\353\006>#[\330"
+	.ascii	"\214\030S\253\2138o\252\027\363\255\207\321l5{\315\337\265\323"
+	.ascii	"\334\304N\334\266>\036\230\005\f\254\314\206\342\254>vM\314\240"
+	.ascii	"\240"
+	.string	"\251\025\211An\r\354\302i\223\267Fm\255\fy5Y\236\252|\310t\376S&\347\306\003\177\3171\372\217\n\305Qk\213\263x\253\025\275x\232\366K*\031\326z\265{\216u\360c\273\323b2\335\334\322):\361\\kEG\274\0043]\210\267\232q\324z\3241\335j\3043\t%\201P\233\317\261\274\2607\335d\013&\371\350\\G/\272\004.*h\233u\233\3135bG\217p\244n\\\326Zk\331t\243y\210\300Go\272\263l\020\223B|\277\342-5\275\227\367\375pY>x7\337\273\231\226u\206Ue\335\230\244\252\212\2743\225\355n\374i(\326}wt\335M9\255\2713\277\255\333\021\031\221\214\371\243\262\267#\2153\304R\326\355\207L\255\325\301\332\355D\225\017\031\017\233\353\024\377)\363Fo\374\357\254 AoR\347\323;\353\f\213\306\331\242\3734\214\326\334\221\006R\006\341\020\026\341mzb"
+	.string	"\265\240\003\223\202\242\320\204S\324\2418\220(1\364@\345t.T\261\304\007\023NQF\251\251\250\250)(\243\024\b\247(#\024U\tc\021h\247Hp\2402\232\230\232\2422\372\220\325\037\333\rp^\216\307\312\321\371\330\356\302\204\305\237\215&\271\250\3100\2227\326\f\324z\374\t?\266\006~lya=\245\233[\273\342\215\316\205\305F\227`\306\350V[\341S\272\325\214\256\244\204(\314\272\365X\035\251\342\021:\320\211N\341di\031\336\370\241\002\037\026"
+	.string	"\263nD\262\tUBd\204N,\033p\343\t\004}@\320/\2475\367e\335z.T\361"
+	.string	"\275'\300\215\027\360\363"
+	.string	"?\247iZs\300$\226\365R\253\212\336\271t\223\r\230d$$$/\336\022\322\227\246\304\371\274\313S\317u\356\303\363\340{\3404\360\354\334x"
+	.string	"\302\357 ]\350\303\311\247`\021\007\200\261\250a0D!sDFD\0244)H\2061\340\002\221\031\333<\021"
+	.ascii	"\261SR\225IR\030\326\225\260\222\334\232\314\031I\206\026\032"
+	.ascii	"\230\313\253\312qIs\240\215(\374\325\"\245\344\"\033\251b[sS"
+	.ascii	"\272\370\374\016,\2651aG\023\2605\323\016\301\225\303\303\326"
+	.ascii	"W\344*;\004WY\265\034/n;\375\233'y\016J4\361\272\340\032\342"
+	.ascii	"OP1\312x}5s\312\371A\266\346\006\006\336Rz\322\273j\3775,%\341"
+	.ascii	"\367pG\231\370\371\2601\230\350}\326\364\031\240'\214\\\261\316"
+	.ascii	"\220\357\313cC\207cv\364\207U\274\205\232\016\304\215\354+!\021"
+	.ascii	"\250\020\361\327\271\347U\023\310C\r!\352\366\017\321g=/\266"
+	.ascii	"/\221|\223\310\305F|\204\214\356\340I\307\337Rkz#\371%:d\365"
+	.ascii	"D\\@)vA\217`\037$\007\270ut\365\236\253\201\225N\223+\300\220"
+	.ascii	"T\210\340\034<\006AUF\374\271j\360\004\310O^\356Lsz\254\"\352"
+	.ascii	"M\336\224\216\245\f\236W\247\233\177\016.\326\035H\233\031,\025"
+	.ascii	"\202\200z\360\316\204<\3501\334!\251Wv\220\353\304\234Bc\035"
+	.ascii	"\240E}\342\bY\224\246\305\177\2357p}&#\377\001"
+	.text
+	.section	.gnu.lto_sensorCalibration_ForwardSubstitution.56.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`-\004\005\033"
+	.string	"\2661\251H\300VQ:T\024V\210\335\342K\273\337\003\035\304e\210Yt\016\221\"\366\021\n\337\007.*r7\365\352\232\235\237PF\344=\005h\022\376\327\037\336|\3122\327\244a\034\036\005\r\336-\304|+\264EO\032![\312\224\002\223"
+	.string	"\212"
+	.string	"\224"
+	.string	"\323H)\027aT\305\370\271\372F~\344Hj\347\241\270kN\244-Ms\362\020\330\207w\034\361\341x"
+	.ascii	"\342C\373El\325C\027\030\037\272fs9/i\376\367\224b\311\323\234"
+	.ascii	"S\2669vC\313K\336\235\332\332\307\224\030\312\325\232\257OL\271"
+	.ascii	"\235\355\243da\tr\364+,bH\0052|X\2124\005\343\242l\3159mv8\231"
+	.ascii	"@u;#\r\177\274\270\364\351\222%\267{\361\375\357\006\272L\311"
+	.ascii	"\355`\\S\017\346\234\326\334\256\305\255\272\355!\266-\330r'"
+	.ascii	"~lN\233\027\311\206\235\367\353\274\256\364\347\234\311\217\363"
+	.ascii	"\336\355\272\357nI\365\215T\333Hu\215\252Y\253^\255\232F\252"
+	.ascii	"UW\217\253NI\265(\325\241\252\245\252w\325\272\352\017x\221\034"
+	.ascii	"J;hM\346\\\021UfZ\t\243\364x\357"
+	.string	"\367]\355\037\312\177^\251\210\370\f\214\251\346\264!\243\251\302\370P\225\344\347N\376\244\366\236\201\243\215\305\330D\305\030/sN\236\207\2360>\214I\025\217%LhH\270\361\243\352+Q\362\322\253\025\353\324\241f\257;Zm\316\262\276t\232]\271\226fe\206K1\323N\003\037(D\"\200\226\320G!>T\355\216\216(\251\325\331\261\225Z5\203\003RTB\334;\351\216l\202P\273sN\233\354\375\002+8&\\\277\251\204\231j\222\356\224\373\3427\2310\323\270\303\367\222\3700\\\375\351\216n9+\367@]\234\335=N\210\274\203\342W\3678 E\032\345\326~\365\227\342\314M\243\314\n\212\371\234s\256y\034\324\270)\224aa4\b\346\312T(\233g\323\305\341 \036\342\033~\342f\260\341g\346\323aA\202\036\027\006\n:\343 \202(\346a\bh\364\254\207\350\303\b\240 \231\020-(\2106\223\t\201"
+	.string	"\n\222\315\206\210d=\002L\023\301aH6\202F\033\222\255x\363\213d\r.\254\334\266h\314\211\257\335\236\362\274\005\024[\013a\313\024\337k\314iK\275\366\276\326\276\006\314pRqq8\325\223\260\rs\313s\327\352\\\333Z\bT\214\224\214\377\273\254b\303\265\017n\nu\031\302\366\275\307\016\334\265\260=\216\006\201\03177I\317}YqoV\2018\0375\253Z\233\r\\\250A8\306\020\222\210hD\024\244 i\206\003\260\002\021\263\331\006\020X\310T\323\030\204\252BW\007\317P\273\211"
+	.ascii	"\2308\002\201>o\\\377 \272\343\363\273.\177!\266\364\202H\317"
+	.ascii	"\210L\376\272\0217\345=\230z\354\016\353\255\225{\272+\023\276"
+	.ascii	"\"\302UuU\037\374\374\235n]\b\006\376\004(\307\273\371F\217\367"
+	.ascii	"\264\336G\271\345`\334~\201\346\224\24026\312\n\331\300\345\031"
+	.ascii	"\207\235\254^\023:_O\324\022\343\246\275Ys`.\226\333P\027\220"
+	.ascii	"\200\252!\331\256U\260rF{`\255\246\274\224^~7BL\343Z\2610\243"
+	.ascii	"\200\036\252\322q\035\345^u\201MB ;\031\376\001"
+	.text
+	.section	.gnu.lto_sensorCalibration_BackwardSubstitution.57.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\326\004}\035"
+	.string	"f\266\270I\240\230Q:\300\315 /-\360\234\360\f\311\f\361\037\031t\032\360\353z\331f('N"
+	.string	"\373}\255\332\231\375\177\223N-D\307\016I\t\337\003\256O\316\2075xQ3h\352\013"
+	.string	"\037\034\266x\231l\340o|\322\310\336R&\031\245"
+	.string	"\227"
+	.string	"\243"
+	.ascii	"\263\324\002\025\005#\002\225 \346}\221\247\225\n\020\253IO@"
+	.ascii	"\be\311$\350\274\027\362!'\242\373\260\304e\2652e\241\252u\350"
+	.ascii	"\263@\303\317\310\323\3627\344\351\356\203\354\272N\227@y\272"
+	.ascii	"\272]-\037:\325O\001M@a\325Zo=\243\233\356\374\034~[\255{\331"
+	.ascii	"\"\351l\326\355\031\214\225_p\367r\322T\341!\374\224\024-f\002"
+	.ascii	"\245b\225\036\267X\234\234\261ZkM\3207\02100\230\304T\307\212"
+	.ascii	"O \254\254_p\305\373\306\027\300\332\362\013\2628\267\034\324"
+	.ascii	"Z\227\177A\025_\327w\367\307\356V\330\235Q\001<B\266R\232RY\314"
+	.ascii	"\356p\307\335\264{[\255\273m\246\335\036\333\207?O\355O\377\316"
+	.ascii	"\243~\235\023\277\264\027\277\263\311\2133yo\316\013\240ye\223"
+	.ascii	"76ym&o\315\344\2051/M\363\276\232wf\362\272\316[6ok\362\222\223"
+	.ascii	"\2272\357d\336n^n\336\013x\020/O7\220\242\324\212\"kL\225B\253"
+	.ascii	"p\234\370\027\317\273\177\222\033\367Ub\025\367hs\325*C\211\212"
+	.ascii	"By\352\342\005\375"
+	.string	"\310\221\350N\334c\271KQ\032Aq\202K\255\325\300\351J(Om\001\037\260dc\343\364_\227&\333\246\371\350\313\001kW\327t_q\200\365\201\302W\3574\315\245>\323/Z\317\364\264\360%;Uc\260?\022\215\310\271B\367%\310SW\327hT\265\232\247\313X\253\231\214oG\357\210\354_\001\2055V:\272k\255\273Y\353\023o;\360Y\327\232\241|K=\030\264\367TG;\005s\372\325\257\313\236\ni\247J\033\373\225\"Oi\263\021(\344\355\364\354\037\271u\272\373\276\036\363\353\204|s\337\267\243\307Y;\3537\033M\224\341q\326\322X\275x\255\265\366\3724\210\301c1\033\037\016\342$\216\364]\240!\b\007\304A\001\202\037\231\205\t\214\333\020\302\310\326\241H\250\\\334\217\221\007\021BC7\242\334\320P\016w#\372 4t\303\025\031\335~t6\027bC\321MD.Wt{\r\353\233i3"
+	.string	"\221\302\353^\331M\333\252A\332\272\211\354\363\031\223\342c\324\272k\331\372\305\237\317\332V[r\201\003\273\351X\343\364\257|Mz\027\376d\247r0\214\230\335t\016\215*Y\3634"
+	.string	"%\177\313\232\241\034\305\372G\240\320\007\223\335\264\256\337\354i\372\353Z\323\032\270\273G\222\326\017\260$q\230\275\361\363\213\fZ;\340\261\230O\332C\353\236\016h\250A<\205\f\223\246FF$\214\302\244\031\306\260\002\2212Y\007\020P\310\206\323b\204\252\"r\025N1\363'O<\301\346|\316CR\337JF\360\350\2571\350\007\037$\356\023_\244\334\326}\220\203F!t\3263m\002\264\026\200\324CM\3624H\237\317\351\001\257\264R\347u\022\251B\350Wp\021"
+	.ascii	"\342)\001\201\bq3\310q +`y\201\211\034\177\036\374JZI3\223\r"
+	.ascii	"{\261\213.\227'\200\260)\301\240\027\250~xa\264\326\306\357\227"
+	.ascii	"\327\337m>\205[\002\"j.\031\013\244\030\212\003r\344\033\024"
+	.ascii	"\312\302*\034Hk\370\031\335\224?\245\333\277u<\303\337K\035\343"
+	.ascii	"\007tP\325\315O.l\324\007\314\r$yG\344?"
+	.text
+	.section	.gnu.lto_sensorCalibration_SolveLGS.58.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`{\002]\024"
+	.string	"\326d\203J\300\322Q:H\211\370\221\210\336"
+	.string	"\250\211\340!y\031\217`d&\027\377\244\221\231\034\225\245\333>\223\255N\205\250lo\251\206\2434\275\200o\376\rn\233\242\020\223 \202/\273\260\024\276\320\240\237\273\002\023\260\247:A\204\354\275S\nh"
+	.string	"p"
+	.string	"l"
+	.string	"&\273A>\247\335R\201W\312\013\020\037\216?\021\037\332oa\257\036\372\300\370\3203\273\307\313\334\212\020\345H(Q\355.IU\270\276\226w\235\263\207\225\316\231?\201;l7\332\303\312\372\031\241"
+	.string	"p\033Q\031\340\232~\357}\356\334pf-\3529}\357\b\252\246l\267\236O\221\226\335\365\264\335L\334\342m\307l_\260\247Q/\377z\336}\222\037\375\320\245\b\361b\267DP\310B\2053\210\276\364\363>\355\237\351=\217\214,\232.cv\236\237F\032\317\270#Z!\265\273\026\306\207\255\372\023$\327a<\306\354K6#\215g\265\3631$\265\313\223\362\320\025\306\207\337\222qHig\336\200\222\315\321\341(\374\270\346\364\223t\346\r\2310\216'\\\237\376\321\221\356b\366\362\346\001<rf\225\337{\265\001t\332R\233\300\327\335\335\312\242\347\275U\233@'\370)\213^\307\007g\006]\300'G\317\3664`[\304\231\334#\311\355\256\203"
+	.ascii	"9\252\332\f\232\345\323A)\256\351WD\235\362\340\247\206C\234"
+	.ascii	"\225\332\036>\314\333\334\312\2414\243\334@\2511}4\242v\002\355"
+	.ascii	"\2226\251\320\317\b\347d\032d\263\256\373\307\357~11\267\371"
+	.ascii	"\313A\334\r^X^+\031\\\013TL\"\374\0053C\323\322 s\031\375R\241"
+	.ascii	"\331P\343\002#eb0X\354E\312\304\270\300\310\227\214\206T!\340"
+	.ascii	"\330\f\214\214\254\211\305d\344H\271\247A\306\020\004\252Fql"
+	.ascii	"Sw\201 H%\315\240W\223e\244\034\246\242VS\244w:\323\r\231\263"
+	.ascii	"\305:\350P\232\247\017HH\205,b\243,J\227f\312Ow\374$\236J\b6"
+	.ascii	" \240\002\231\262\262\003sJ(\262\030\0373\360B\341\031\246{\331"
+	.ascii	"\203\004L\225\333\027m\272\312D\206\237k\315\256\225+\212\340"
+	.ascii	"\n`\370\267\351[\261J\033\276a\326D\254,\033\016\314F\300\356"
+	.ascii	"\245\026\324\322\326w\272\343\004\205\214\313\261\001tc\311\261"
+	.ascii	"\361x\265\237{\331Z\300,\327\204a\207\013\346\220\r\202cZ3\276"
+	.ascii	"\227=p\331\346\364b\234\367\362C\204\273\224n\356\363HG\310O"
+	.text
+	.section	.gnu.lto_sensorCalibrationValidateResult.59.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\204"
+	.string	"\235\n"
+	.string	"6\323HA \247j:\200\303s\f\027E\340\202L\340\004\274q\217O\347_L(\235\373\022\200\335#\022\362/\235)\030\304"
+	.string	"\305"
+	.string	"\345@G\222\003p\030\201\021*\372\020/\200\fEg\216\266L\311\330\210\354\224\0021"
+	.string	"5"
+	.string	"8"
+	.string	"\335Ml\203sf\360\316\331\366\206c\372|%A\275\345\362\200\311v+\270\215\234\364<=\375\003\025\307\251\305\263\273\246\037*\220{\273\355\317\366\204}\204\225\335X6=me\tJ\265]Tm\301\026\340\006\264l\337~\212i_l\313\201\016\245\177\375\344\256\243\230\257\245cvY\006\004\354\326\006o\352\025\272s\336\023\002\366\230\266\023\202Y\254b\265\207\235R\2323\267(\350\030\300\003\230\207\231\200\277\216\272\252\324\356f,\341\235\373*\021!\246J\311\352\257S\314R\263\330R\232]Ot\023\261\037\241\033\302\202\023n.\036\0344\030\222\306F\t\"\273\0204*?\f\362\3439\324\224\031\244\217\b\212FQ\034CP\024\372\210`H\226\240f\301\343\bD\202\244q$\301K5}c\375\354\002\021"
+	.ascii	"\310\223\360\376\026\377a\006\324\313\263\230\321\204\030\276"
+	.ascii	"\306\017\0161\340\004\301\364\270\271\303\313\252.\214\002\305"
+	.ascii	"X\364i\2501\255\334\266\344\001"
+	.text
+	.section	.gnu.lto_sensorCalibrationSolveForOffset.60.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\003\003}\027"
+	.string	"\326,\230E\260\032Q:\300\234w\200\t\177\302\207\245SB\032\266Y\211\216\250\035\037\377\233\321q\316\332\322\363=[[W\357WD\377\377j\252\345\307\177\202\321\177G\234\340\317:u\026Pw\344\334Xfu\264nB\366\2262\245\201"
+	.string	"\200"
+	.string	"\204"
+	.ascii	"\253\276\021 \017\315\350 O\263\001<z\203|\364r|\252\366\205"
+	.ascii	"|\210\353DR$(M\025GZ\020\315I\243\361\003\371h\332\021t\217\362"
+	.ascii	"\007\272G\333\236P\301\345\235\323p\274\270\016#\026I\274\314"
+	.ascii	"I\373\366\206\367\220vC\335y\204\253;\276gS;\374\021\006'\233"
+	.ascii	"\275\036ai\316I`\266\002JP\0273\036\205;b|/t\bI9\331,\306\325"
+	.ascii	"\263\231sZe3\030ww\333,\333 \354\245\t\232s\203 \212\003re*\222"
+	.ascii	"M\343\321\265a\377sk\330\245\003\375\003N\344\017p\333-=\265"
+	.ascii	"\267\352N\252"
+	.string	"\243TCO\275\235Z\243\372\006\032D\261\342\302\315\371\"\007fV\211E:n\373\203\356\021}\276\022_\3101^\223%g\342\272\315O\344\253G\326n\270\2439\347\007\371(\003o\273\374\232c<$\337\221<\211\353A:\362\325\003 \210\313\224\2439{f\036\355A>~\226~\240\363~|\001F+\337\n`\361=\324=*\025Y\227\333\r\347\2049\330\365v\267\304x\304\035\260\335>\326\003\336R:\270q\037\343\301\2439\313\205\373$\026a`\232\303y\315\267\013\273\013\262\024\t\3005\331\235s\276\3263\277\355\031|`\212\344\013\035\372\370)R@\277W\362ZN\r\016]\373\204\322\313\034\343\023\333\227}'\254\021/\272\321\205[|\242\034\231m\3427\0359\347\2640T\"%s<\372)\266K\222\311\200\00577\265P!`\353D\016\013\265\352N(\024,\231\021+\223\264\205\020\025N\023DP\220Pc"
+	.ascii	"\3252\265X\321\247\032\026\211\226)\365\341\250R)\325\351\303"
+	.ascii	"\2711\245\276\323\212\365\325(\260\n\005j\365\265T\252\325\027"
+	.ascii	"C\203\375sk\330;\035\006\037\330\362X\007\316\371\243\341A\377"
+	.ascii	"\021\220\346\374\332\003\340\240\304\265a\317hK\273Zt\346r]\320"
+	.ascii	"\\.\007-*\364\013\356G\256\rL\221\016aio\273L\204\313-\355c4"
+	.ascii	"\030\340\212\\\361\326\017; @\002b\030#=&\213\334\336'\226\013"
+	.ascii	"\237\345\276&+\027;\344\n\346\013LI\250\334\006s\016Q\343\212"
+	.ascii	"\215v\020\215\2546d\376\346\227#H\027\270\254\025h\317\323\016"
+	.ascii	"D\367\215ZX\260uX\341\026\300V\240\204\202a\315[.\230\t\022\245"
+	.ascii	"\344\006\311\252\023\264\004\323-\271Z~,\2749\034\261A\202\024"
+	.ascii	"\246\353\360\357L\320\024\217\023\273N1t9p!\246\201G\232\341"
+	.ascii	"^\230\301\250\323p\250!b\033\262\3666\006|Q\356\\\341\t"
+	.text
+	.section	.gnu.lto_sensorCalibrationSolveForScale.61.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\367\002M\027"
+	.string	"6\356\232F\260ZM:D\315\227\004\f\377\302\255\270+=\276\232V\260\363<N\361\035\300Q\246\360\306\322\3235\324\260VyO\363\246\272\266\336\325\357\216\322\361\316\017\245\023\260\201.\034d\343\256\221g\226U\217\325\266do\271S\n\205"
+	.string	"\177"
+	.string	"\207"
+	.string	"]7\305S\350\023!\362\221\002\231\365)R\303\303\274\315\006pi\016\363\262S\362 \264\037\344Bb\037\302\342\250\335\241o\311\256M\202\037\314K\333\216\240\273\234?\320]R\260\0203\317m9b|\007\226\027G\270\354\332<\305a}\264\335\021\362\\F\205<\376\311\346\366\b\344\373h5\331e\224\331]\0025\027q\002\204Q\353\201\221\307\214\353\215\016\341\313\321j3\016O6\273kH\253\311\270\273\333~\331\016a\253\203\r\230`N\213\224\205M\266\255\007\352\r\373\337\335\265\016\331\250\023\375\003>\344\017p\334=O\320'\205\356&\264\234\320\361\004\255\0354\224\3207p\003\024\245\305\267\033\343\373\262Pd\322\216\343\376\242C\373]\030\317G\342\0339\246\373\222\\I\35487\2312\240yCjZ\332]\020\363r&\336\216\3717\307tL\236m\337\310\217\304^\2643e@"
+	.string	"\212\262pY\332\005\242\271\364\207y\371\225\371\201\005\250\370>\352.\341\023\032\223\001\250j\217 \001O;\251\210 \037\225Y\352"
+	.ascii	"\355\364?>\342\355\244\213*\365?=z\340\347\251Q\017\346E\030"
+	.ascii	";\3477#aPMP%i\006?\013\310uQ\335]\231\232\346\307]C\320\f6\371"
+	.ascii	"F\217?\204\266\024\200\327#\371M\247&\007T[\265\202\2479&\350"
+	.ascii	"Ge\366\231\274L<\t\007j\274\342/\321\241\331)\216\2643w\367\302"
+	.ascii	"\021\n\326\324q\351\263\320\016\f\215\306\f~\0168O\301V7\021"
+	.ascii	"\246B\347\265ru\252\325\212\327\214\tWj\372\302\215\005\025\205"
+	.ascii	"\022\025&\324\240V\260\024\354%\255\252y\235\200\245X^N\213\305"
+	.ascii	"j\251\274\034\234\024\313S\271^^\315\002\267V\254\\\036\254\325"
+	.ascii	"ry1\266\331\277:t\236.C\320L{\274\023w\2056\274\350_\"\202\237"
+	.ascii	"\177{\200\334'\365\206OJ\212R\265\002i>\025\206\204O\355`\305"
+	.ascii	"\007z\311\tM\265\231\301\246\307\335\335\210\322\343>\023\341"
+	.ascii	"SQ\372\037\033\fr[\244\234\324Wr\031)3 @\002b\234\243\365\226"
+	.ascii	"d\241\312\336$\261&\217\264\371\350\004\264f\022\2134N\321\020"
+	.ascii	"\031\317\200)\017\252\336d\202\345\217\206\264\337\236\212uL"
+	.ascii	"\327\330,\333\b\361\027\214\200\200\004Ki\004C\317[\330\330_"
+	.ascii	"\022\245\344\216d\321\t\274\004\323-9]~,<sv\022\203\2711V+\236"
+	.ascii	"'\272\263\025\020\311&\201\307\307\201\030\214\335\200Y\005\246"
+	.ascii	"\306\215m\310\331\333\016\370\240\334\271\314\023"
+	.text
+	.section	.gnu.lto_bellCurve.62.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\323"
+	.string	"\305\013"
+	.string	"\206\026Q@ S\223\016\340\243\305\340Q\030i\035`\202p\tx\006&\2315.\263\020\365\001#\376v\276m\303\365\277\321\222\217$lJ\203\004%\200\254"
+	.string	"\336\200L\344V\311,\306$\226'\364\033\331{K\231R<"
+	.string	"<"
+	.string	"="
+	.string	"NP9\264\355\273\370\213\315&\275\016E\211\201\025\034\210\030=v\327\262|@<|\027\020\017\365\304\267\347\346\037\3061\241\021\035\334\350\363\234$\354\256\223\033\211\270\365\266\021\330\306\330\247\020v\246\251w\377\364\223?f\032f\372eZ3\235\231~\005\240D\311\350#8vC\224R6\007\234\241\302\366fWv4\351nD\250\034\306\026\n\236?\361`\220\335\032&2vE\026\004\033:\3449J-\037\364\343\247\252P\217\"\2621\351\244O\t\240\230t\277]\320\201T\325\270\343\232\ni\210x\200\262\344\250Q\257\360\207\210E(K\256Hl\372\260\273O\252\t\373o\225$\033\217\005\316\004\215\006-\303E\031B\205\007W\203\013\016\030\\\002p\270\257K\310\306\223\301\254N\206a\331eu8\031\314\272\264\020\353R\300\031\006\215fy\262L\263\252n\377\256$\224Z@\0322L\250&=E\312\b\021;\023"
+	.ascii	"r\311\"cyC\033O\310n\200u\001p\214\230!\n5\216\237UBK\353\211"
+	.ascii	"\237k\3702- \306\004\006\206\201!\204\032'\374Lcj'\031"
+	.text
+	.section	.gnu.lto_sin_approx.part.0.66.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`8\005M\034"
+	.string	"v\360\250H\300\226M:\024\036\261ag\254\"M\246\236U\357\332'$\f\251Q\252\261\341]bVp6\006\257|\013k{\264:\307\034'l+<\246+\b\302\274z\3506\24323\376\217\316!\320y\350X3b\t!\204l)S\n\222"
+	.string	"\207"
+	.string	"\225"
+	.string	"sN\005\367\234 \274g\277\251f\353$\256\006\216\242\0079\023\220\255\26304\232pB\004\245e\316)\273gs\232\357\236|\354\273\2674\274\376\026\350\256\261%\206\340\347\311\325\027\220\257$\214D\334\005\316r\227LZ\254 \241\200\361\361@\353\205\013\025\301\031\022\212\027\017wE-\244\315\234\363KE,\024$\032\322o\305\275p\305\245\004\207N\350\200\031\tI\b[\260\220<w-ad\323m\365Hq\215\375\005\316\346\234\276-\306\r\273\355+\333\024lo\003\272J\336\027\204\032[\260\274I\366q?"
+	.string	"U\307T=\243j\031U\307\250\032F\3250U\277T\355R\365\250\352\326\243n1\004?O\256\036w?\300k\230\346<\221\325e\312\360\220\354\270\324\037u\265o?\252\346K=\347\321\265\332\243\200\374\247Cy\274W#\005\212H\b9s\024\200D\231\205\367j\262\334\330\177\032b\235\234\271\363\360Q\005k\316ys\317\021\\\273\323\304QT\263\273Q=\356N\326Y\234S\311\217#\001\342>\3526\266p\305\275\325m)H\263.8\331\205#\230\004\356\347\205\t\214\304QUk\225\234\004\342\251J\307j'~\336~\373MyNH\006T4\375\b\345\267\353\251\220\267\032\236h\230\354\300U\2721\342\311\265\224\337\225I\023\252\366\223\273r\275\253\333Q\224%\236\224/"
+	.ascii	";\002Q\335o\t\333rB\023!\335\342&\244\317lrWi\217\273\215M\271"
+	.ascii	"\330\272\027!\312\362d\332\237\320\2346\004_]\317\352\306#H\263"
+	.ascii	"\374\334[WT\273\251\\\274_)\252!\243><:?\222\301\217\372\201"
+	.ascii	"\006\0079\f84X\200#\363s\347\340|\350\340\223aG\306C\333\331"
+	.ascii	"\241\345\310xt2\354\310rz>\310p\b\230\346aC\217\314\207F\353"
+	.ascii	"\221\215\266\365\233TAgb\234\331Xl=\263m\220k\2250L\241\322"
+	.string	"\002\327R\364\226@\216&\341\267\241\314\206;\263\307\022\263\255\225Y\365r#\211\215\331\005fc`+.\314~#\236\246d\\y-l\005X\335\216\\+\356k\007@\335\226tT_\240\214\353\332\002W:\204\314\300I\310\312\252\022w\\\003S\342\206\333ZMr[\242\261\262\013u\250aH%\0252T\"\223$IA\322\001\300\002\2311\333\006\021P9s\250h\nRP\310\316\032\366D\001\201_\207\210,\373\347x\315)\271\262\032.\263\037H[0\344x\335:u\221\330\354\270\fGb(2\003\230\227m\032!\005\333*\311\226\352\334\324\213\331\216\t{9Y\202uM)\356\376\347`\333\233\031\225\310AO3V\273'\032\022\335X\274\354Z:\020\n\021\370\237)F\357\245\260\323F\207X@\3179N\002`SC\370[\324\344PB8\373J\305p\027\026d\004J\232\272\266M\324\220\300\2651\\Y\252\304"
+	.string	"\360\0035\222"
+	.string	"\r-U\232\341\341\317\301\017(\265s8\244\037\221bp\212\3116\006\204\330\007>\243\341"
+	.ascii	"w\342#\366p\376D!Lm\210\331uJ#*\326+u\3310dQ\001"
+	.text
+	.section	.gnu.lto_applyDeadband.part.0.68.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\024\002u\021"
+	.string	"\226\237pG\360\320&\035(\243Y\270\271\\\2511\334\326,\360\020\326\221\311z%\326\0169\341\265c\004\225\3372\033\331\307\221\\/\204\203\351m@\2655\3440\261y\2623\024\372\316r\344\031\343?\034$O\026]sk\311\336r\247\024["
+	.string	"Y"
+	.string	"Y"
+	.string	"\022\024\361i3\017\035\302\034\273\273}\252^@\373\224'\240}j\210{\327\246\324H\362\374\207\227)F\340\220}\033\256E\331\027\363\211\372Z\244jwO\037\207(M_\314U~\314\304\370\200\372b\322"
+	.ascii	"\021\210\032\017\037]>\226\030=N\"\211\354\256K2w\351\266;\333"
+	.ascii	"\020\3548\022\357\361\203|\262\217gU,Eb;\320C\377'u\263\331\377"
+	.ascii	"\361\361T1\001\033\233\275\340\354.\310\247GJ\237\367\303\024"
+	.ascii	"\373\344\207*\366\311;5<;C\017R\256\343Ip?\230\224\314\346x\360"
+	.ascii	":\236\001\354\326\350\b\355n\202O#(}\332\317I\201\261\355\257"
+	.ascii	"8\013\025{\001BSg-N\003%Cq\0277\210h\244\352"
+	.string	"\301\253V\242\221\243^U\257\243\005\207%\356p\200\240\023\361F6C\244:\263=\355\252\201g(\026\213l2!c\243Q\324\231\225$Wm\354y\360\226\007o=\317\037\017\376'y\0348\332}\331q\2644\363E\211\003\375\366}\240!',.\302t\225p,\027\367r\225\334\200\305\240\265@B\210\202\325\200\327\205\n\034\206\351\326\352d\002\n\007\333J:\030\254km%\0248\330\32629\331V\037\356,\274L6\224\2563\331\342\325\306$=S*I\213\004y\006\0307\252:\325\305\366T\0074+\312\342\2077\005\345L\025Y\321\244\234Q\341\031E6\0021 \300\"\"d\007\025\311\362\023+ |\312\3365gm\033\275\242\275\217\r2\343N2g\320\301(\203+\341\220\206M\271^K\261\022\3650\367\2658\261\\\330\300\205\r\033\246f\262\3415\350z0L\220\357\261c\303|\214\031D>\007\203\204?"
+	.ascii	"\206:n0\3313\356\312in1\001\245\336\224`\212\365\376cm<\201\342"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`3\004\305\r"
+	.string	"\366\022JB \211L:,\024\f@\334\207\024\203\345\301\300`\004S\t\354\256\024\007\016 \020;l\353\025@\001@\001\020b\215T\335H\325q\013"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004p\024z\204\216[\325\001D\221\217\004C\222H\0317"
+	.string	"7"
+	.string	"9"
+	.string	"\241W\220\247"
+	.string	"\035\363\371\305s\0138[\201\366\n\364\ft^\231tw\217W\236\246\347\004"
+	.ascii	"#Pa\002\347\272\243\364\234\235@\365\252\016r"
+	.string	"\313\320\215\333\374\005\252\352\302)\255J\203\037\202\333Y\266\257jW\321\236\232\035%\373)v\023\354\245\327I\256\217Z\027\261\036Z\235T\035\224\372\007u\317\351\035\323\307\3229\\\226eI\372ft\215\350\231<\222\302\341\\\020\002\205\b\002v\302\024\3352\207\\\031\200\\\027l\347Z5\363\361\333z\334\266\035\257-\307i\033\237\375\016\004x\240qY\306c\232n\034\306a{q\227\305\003\272\022@\034\362\226\273\033G~xu\273\036\026}\234\221E\335f\344\235:b.\226\312\004\217Hp\203/\234\021\\B\"ry\020w\020\034\016\330\t\351\300\353[\020\024y\003N\250A(\343+\033Nac\016\020\003\031\322&\017\021\240\020B\3101B\210\220\t$\240\036\016Gd\361}\300=s\3124|\036\314L\326\006\260z?)\274\352=\364g^\235\307\366I\236I\332vfR~\2625\233\251\372U\333K\021\230\215"
+	.ascii	"Z.\f\343Cc\020Ax\233\362\346Of:6\305A\224$ \022.\301qEUUUU\025"
+	.ascii	"]\356\242jTJ`.X\211\330\345\217A\354\210U\365A\201\257\027\247"
+	.ascii	"\016\264\205]\247s;\252"
+	.text
+	.section	.gnu.lto_.refs.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ea2e7e5c021cb25,"e",@progbits
+	.string	"(\265/\375`\3161\365\306"
+	.string	"\3528\221EV JQ9\351\273\371{c\246\373\317\342<2\005\2162\347\031\243M.d|\271\362O\326\346\316.\274\331\261.b|\357r"
+	.string	"\\\340f\327\274\004\316\fzM"
+	.string	"\345E\253\3226i\333\226\240\223B0\214\2007\253h\210\263,\203\020\036Sr\003Z#\265F\366\226;\005\275\003;\004f\004m\243k\334\277\277\255\242\306]$\355`\\\2433\353RZ\211la\013EA\2336Q\017u\2459\233\2065k\242\016Wpl\211X\021\277m\254\035\344\201F\212S\323\221\306\357\274\336\"^!\351\246\355b\253\3309'\270\353\310\264\201\372\307\232u3\306Jk\251\257\210o\303\f\257\326\274X\255\345\234\263M\264_\254\231ED\264\207W\263sNl4,Lf\210\224\212\026\304\365\366p\2755\\o\013\327\333-\\\ba\240|\201\222jl\007;`\243,!\201{\353\026kf\005k\004m\240\325\202!H\232\233)\236\034\205\025n`l\001\020K!\306Z~\013h\247\266\312\0040kzJ\\gk\017\340\317o\006\020\r\216Fc\333'\365"
+	.string	"\303\267$\311\234t\265b\363\256X\222\004\352\316\254\236\215\263Ur\225\031\237\335\263fV\357\036V%[\236\320\"\3063\266q)\322$\262\336\304\034\2220:%Q\262:{\345j\030\2022\344\032@I\2429g;\233\305\336Y3[g\261\330D@\276\260\025\337\016Yoy\254\267;\326[\247\365Vi\275\255\362\333\026,\223\240\276\022(U\330\330\312\325\334R\271koC\207\215\333\036\2552pS\214sV\332\006\033\277u\2109\004\332\242\325\370vh\275\211'OkdN"
+	.string	"PT\327\202\t\265\273]\261\244\265\254*n\032\326\344j\030`r\206\003[\263k6\212\225b\335\254\231e\263g\267h6\355X\232sP\316\371\226\311_\363\333%\226\314\262\331\262\253]\261\244\\\203\206V\212)\277\262\304\302\234\363\006\033l\260A\207\r\214Rtpk2\370&\254\026j9\024%`\261\312\254\270\205r\013~2\212[\260~\202\365\031\326\303\254\357\365s\226C\021\003\313\241\210\307\254\330u\332\200J5\024\211v\220]i|+f\245Wkh\316g9\347\tV\032\203_\f\033\333l9\0243\330\rE\213\244\3466\311o\301l\330\206bR\2234;\3119\323|\020\204\307\221\306Wj9\024W\273\2418\245E3\371\033*\332,\f\252\260\341\307u$\244H!\303\217\247\230\360\377\376\030\311\n\016\374v\b\tQ\020x6\bX\250\261\316u\231\037\353 \200"
+	.string	"x\002\277M\201\342\267&\272\003\256\351"
+	.string	"\r\276\340"
+	.string	"\033\024\361\214\006!\272\261*\200"
+	.string	" ~\271\300\002\303A\020\035~K\201\337\337@\2524\374\026\001\207\371/\226\304\377\210\377\017\177K\365\333\325\032\357\341\277n\377\251\374\327\362?0\313\377\272\333\355\375=\345w"
+	.string	"\374W\354\307M\270\361!\004\277\360\337%\t7\205\377j\377\331\376K\371\337\366\230\377\332\374\217r\374\337\0130`\204\316o\241n\023\320\334\373w\320\216\253\177\017\276\377\366;~\375\373\312o=\320R7\376\275\344\357\250\277\231\376\026\372\233\205\277U\370;\205\277Q\370\233\204\277!\3607\b\177\237\370\233"
+	.ascii	"\177w\370\233\346\357\342\337\375[\304\337\032\376\226\360\267"
+	.ascii	"\323\337\356\375v\356\267m\277}\362[%\277\375\372-\327o\263~"
+	.ascii	"k\365\333\035\277e\372-\322o?\360\333\032\277%\372m\363\267,"
+	.ascii	"\3746\306oy~{\374m\n\277m\361\333\016\374V\305oA\370m\314\377"
+	.ascii	"\301\377}\377\337\376K\177\273\342\267\r\370-\003~\373\341\267"
+	.ascii	"\037\3746\303o\025\360\037\003\377I\370m\007\277E\300o\017\360"
+	.ascii	"[\r~+\200\337^\360[\020\277\335\360\333\b~+\363\333\013\377\t"
+	.ascii	"\377\373\375\237\362\237\305\177\261\377#\374\247\300\177\271"
+	.ascii	"\377\006HLLL\374\215\030\374\352\320_\200\016\001S\262\226\220"
+	.ascii	"\242\262\025\304\333\005\372\025\272@\227\250s\256\342\263\211"
+	.ascii	"EC\262\356\320/\021\330\023\312\226\033\004\266\202\b<|#\036"
+	.ascii	"\336\246mZ@U\334\324\270\205(\353\307\315\277M7\232\260\350\023"
+	.ascii	"\273\306\235h\224\263R\265\303\r\347`\003\253\362\305\310ZAS"
+	.ascii	"\341\333\260\260\261(\211\346\246&\rT'\276\303\276.A\326\n\312"
+	.ascii	"\002\337[\002\233p\315u6\242\305\237#W=\006\337\204x*\317\351"
+	.ascii	"G\343\026\274\032M\232X^\020-R\253\005H\374z\332\200~^0\331\363"
+	.ascii	",\351\357\306\372,Yz\257\b\302\271\302\256\371\032\317\256\367"
+	.ascii	":Cs\216\032\313z\030\251}JV\244\364\336{\375\354 \256\247_\343"
+	.ascii	"\316C\222j\231\366\263\250\2675Et\207\205\326\337\351z*T\032"
+	.ascii	"\213\b9[)\024))7\341\320\300\202\267*M\327W\2524\026\353l\346"
+	.ascii	"\334\314\220\201\376\256Ls\023\224\006\027\232t\3711\235{c\271"
+	.ascii	"\232m\262\207\245\355j\226+\355\013\212\225k\267\376\266\255"
+	.ascii	"0g+\232\254\231\274\313\336m]\326q\2534#\031\261\316\236\246"
+	.ascii	"\205\271)I\203\277\245\274\343\336-\224@\361?\231\fb\205)\253"
+	.ascii	"\267)\r\367\303\214\320\027\335\322Z\333\255\337V\261?#\300\033"
+	.ascii	"$\204\372%J\344/&\352E\310\240\035\203\211\023rsk\334l\035\245"
+	.ascii	"\b\244\351\216Ic\265^\373aT\254'L.\325\372N\303\020%\032\275"
+	.ascii	"\322\270\321\326\241\373\024b\035\202ud\250\361\033\355\314\003"
+	.ascii	"Eg\020\325V\343\206\322f\357\263~\362\022(~\233c9,\347\334g'"
+	.ascii	"\240g44\370HU\026\224\"\376]Z\273I\315\333I\336\223-Gc\365p\375"
+	.ascii	"\177[\314?I9g%U\232\327\200dnU;c\257\r@\316#\204\344<\244O\020"
+	.ascii	"\303\323\026\221\263c\220\033\220\233^A?O\rY\232\223\234dTM'"
+	.ascii	"\023\272\247\006i\236\232 \223\361\310N)\325\023Csgi\2669\210"
+	.ascii	"\352\251\202S\nMrJ\241\315\f9\b\332\314Y\372\314\340t\362\323"
+	.ascii	"\264N2\252\247\223\f\372\324\220\203r3\223\375L\255A\320\247"
+	.ascii	"\223\n\364\231\301I\366\363t\006Q=5`\365\0059+\372\243\213\263"
+	.ascii	"\201\316\240|d\004\365\223\224a\316)\205\346\274\234\255\223"
+	.ascii	"\241\234\024\200\234\241\240Iy?Lv\rh\356\b\350\354\007j\245F"
+	.ascii	"@U\320\0344\347\334\202\346\274\005\364\"\033\235hJ\3472\020"
+	.ascii	";\327\344\001\225m\f\345\374!Ks6\312\271i\363\\\316\271\231s"
+	.ascii	"6&AIs\326\221\301\03152\312\271\251\203Q\206j\262\r\345\334N"
+	.ascii	"\366\326\236N\262*h\r[\031Y4\023I\2336\232\363\250\222V\262\246"
+	.ascii	"X\266\261e\215>ohil\205\360\t1\215\205\3058\345\020B\023{\302"
+	.ascii	"=\264\322\300\244[\025\340\352\302j\334Hn\b\016s\376i$\335J:"
+	.ascii	"\311\033\311\245\326f`m\0064\306</\347\217\331\325\032\f\217"
+	.ascii	"A\3052\310\354\t\2429a;\362\245\036a1\3015n\257\016\027\360\320"
+	.ascii	"\206\220\327z\023\315\325Q+\026T\327%\332\\]\244\267\212u\206"
+	.ascii	"D]\205]m\304\232\265V\023\201\201s\003\023,\366VgY\2616<\344"
+	.ascii	"\241\265\265\252k\035]q\266\0346\024\237\235u\2245($HL\023\324"
+	.ascii	"T\007\t\314j\313\322\330\202\325\274\257h\352\324\006\2074\266"
+	.ascii	"\222\221\343z\266\325\337>\372G?\233\006JM\260\251\261\005a7"
+	.ascii	"\024;G\315\273G#\361\341\274\342Q\325A~@\356z\252\2510\334^"
+	.ascii	"\331Q\343\257Y\016\305\230\206\366\216'r]S\032\367sm:\341\206"
+	.ascii	"\032\333%5o)\314\203\020\211H\024\2242\n\2560G/\365\2235*I\021"
+	.ascii	"\213\322\270\231\272\311\232yh\247[\271\326q\365G\232\245Z\254"
+	.ascii	"\200\236\2153X\016\305\267\325\n\202\234\255\207\242ML\264\036"
+	.ascii	"\212$,\207b\321n\300\341\301h\204m\207\217\033J\315\244\350\207"
+	.ascii	"\251q+=e\326\016\207\226\032\367Q#Y\263\273u\322a\202\244\231"
+	.ascii	"\314\002\231\322\004\002]g\030\355\335\214\232\030\355K\307\222"
+	.ascii	"B\240\316\273\273c\276\343\275\"\222'\232\240\036\036\316\263"
+	.ascii	"\303K\027\313\026\302\"t\270\016K\327j\254\262\206\257`)x\r["
+	.ascii	"Y\2336+\311\323\264\260IJ3\210\333\261\225\343\026J\240\300T"
+	.ascii	"\f\367~\f6\306T\032\313\341*\307Tp\234L\220\024S\3019\377X\233"
+	.ascii	"\001\006k3P\335\260~\226\024\361a\242\3531\234\314!\023\331V"
+	.ascii	"c\374\206\247\300h\031\362\024\005\346*\204\261\350\253o\252"
+	.ascii	"\213\202l^V\032\343(\270\r\246h]k`(\307i\030\n\036k\222e5\305"
+	.ascii	"g\030\315l\005\\\3274\262c'dx\f\260\006\rS\030\222[c\\\206\233"
+	.ascii	"0q\262\302\030u\035\037\351\302c\205\321 \273)\301\306x\354X"
+	.ascii	"Lf\316\313\215)\351\235T\022\254d&HI\317\312+\004\f\020/^\207"
+	.ascii	"av,K\236\320Wc\f\3664\3745\306\005*m\325z\243\341\205\277\214"
+	.ascii	"\254Jk\214\215\037\307A~\340-\277\254\313\2247$\353x\353\270"
+	.ascii	"\310L\032\333W"
+	.string	"\021\221\365*l\007_c\034\305Z\366\313I\220h\265\021\302\230s\264\240d\b^\272p\304P\252\2541\306\272[\363\200\322\205\2551\026\202\201\340+\253*k\f\236\216c)\035\270\207\241Qj\211F\021\350q\217c\036E\b\233\b\253\032\256/N\256\2561\236\302T\305\273%.=\214SB\300$6\377\270\340\035xi\251P\211\035\206\302QO\306\037\353\005\246\347\361\215'n\272\202\315\226P\205a\246\343\246\277ND\263Q\206\227\270\214i\325-\341\034R)$!\355\225\273K\226Y\036\306\201\225\2145\326\013M\260\363\270\b;1\222\231\231\r\275;\036\370\350\030\351o\211\006\025Ucl\324X4wy\\Z\215\261\215\306\272VWP]\215q\215\306\202!$\"\210H\343\313*\203\024t<\024$\304\372\240\021DOho\245Y\302\371\370\007\347;\345C\202\311I\236\324\232SV\rZ\207\277\210\207\227\360\360"
+	.string	"ao8\276\210\255\021\330\025\376\032\026\336\251\336Z\245%\205\256\313\220U\002\034Z~\005\265\\B=\270\350\007\204^\002\007\177\t\237f\220\260\034\036i\261@\273+V[\212M\253\004^\372~\377n\337\235v\316@\224Le\240:\214\200"
+	.ascii	"\376N'P\206\325l\254\231$Q\2747\277\242\320\312\201\216\3567"
+	.ascii	"\013\335\335\353\022\345\3623x\365~\367\376\234\f\257T5\276y"
+	.ascii	"\327\312Z^\021(x\306+`uExw4W\016\225\300\331u\221\364\226-E"
+	.string	"\205\331\325\251z\353\004E\356\024\267;\327\004\211J\025\0245t\345wN\206\211\252\255J\343+w\255\340!%:\034V\252H\271\002k\263\203\3068.aOTn\217\264\204\344\342f\322j\310\031\211k\301\336\335`K\202\263}R\017*\021C\240-\270{\230\271\013d\302\367\266\266vhb\366\213fv\333\360\206`\370r\004\017G\224\3376\265\230\2627\264.\215/\033\236\023\035\210\215\357\332\325\274\364\250\2764\276jig*\331\352A\352.\021\273O~X\251=\343\2228\371}\342f$\242\327\304j|\233\\h\231\232S\343[v\267\013:~\3340k|\231\220\215}\255\036\006\301~\221\200]%O\321\025\212s\032\226\344W\211\315\341\0275\324O\030\242\202B\232aV\353\207$#\277_F.\027\336Q\324\262))\301\363Ro\254\037\242Z\267\353\026\321\272\\09\t\217F\f? D\266~\271\324`"
+	.string	"\271\242C\210\250D\353\007\263\253_!W7\313\216/:\003W$\255l\310oV\236\332\0256\276X\327G\203y\301\345\b\222\270~\330\233\372\255\232\272VL\254L\213H\177Y\324\032_\253?\fdR\322\226\\\037\335\205\311\341\222\217\333c\214*\007\333\233\314\\\324K\254\361y\330\263\017n\305\tR\021\256\024d\247\337'\247\273\303\356\354\022\342\350\202\223\372\335\241\266v-\361ck|\243\256v\261\036lP:\370V\n\264\356\363\367\306}^\246\036G\272+\356\017m\351\227I\035\352\023\244k|s\334\315\313\023%Y\032_\034JXV\n\350\256\321/\3225jB; \355\004\356H\327\021\333\n\002\354\322\370\255qi\\\242\303L\033\025\314\244\216\2171G\006O\017\376\013\021.\222:J\346\022"
+	.string	";;>\311$O\222\005\235eq\205\236\033\030H\030\305\277\020\261\334\3319\336,\231:-F\370$]p0\303'\251\263\303\301\211\0246)T\314\030\201\304\361\331\271I\352\214P.}F\214\270A\366,1H\346\030C\020\3212x\224/\230<Ic\316\021\271\203s\230J\025\226*2\206\322'\204\235\035d\013\030\013vxx@\260QO0\301\334\361Y\"K@2\2178:;G\r\\\300\342\001\024@\306\330\341a\361!\205\233#\b6\0058\341\204\t%jP\240\361a\3520\227-|X\340(\2172\224<\"\330\020\340\004\023&\224`!\342\004\023&\324\240\240\356\370\334\354\034C`\"\22799\025P\362\210\200\334\351\201qd1\202\211\\\"K\240 \002-|X\254pT*\2173\035D\220"
+	.ascii	"\024(R\324\330p0\241D2wtD@\216\220\302\215\216\217\n\021P\260"
+	.ascii	"\204\301\243\024a\206\216\222y\034\201\311\243\354\220s\001\351"
+	.ascii	"\"y,\001"
+	.string	"\271s\274Y\306,\223G\035\234c\t<\030X\"\221J\027H\234\f:1\220\016\300Q\036q\222G&\213\030H\034\t\2207\311\243\216\362\250\201\030H\234\013/\226>\026\210\201\3041*\217\310\235\020b q\326\234\230\244\316Q\311\\&yn`rrhH\220 \221\302\004\t\022$T\324\330\364\034\2252bpn\\\334\343\205\022\311#\363(\263\344\271\211\231\301I\036[\340\034\221\016Xa\247\247\347(A\f\t\021L\345\261G\304\f\036eO\317\321&\251\263\324\360\233\345\022yss,\236p\302\004\022(\250H\026t`\3500{x\3263\227\307\234\n\024\225\307\0277\270\004\n,\227>G\0276\036~\243\243D&\221.\326\237H\301A\n\0253\214W\341\001\t\017H\024\257\302\203\232\032\017R\324\254OQs\231G\236\235\034\225i\203d\036\231,\222<:\314\243\262\205\316\3161\004%\3172\211\\v\330"
+	.ascii	"s\003\227\003\314\r\\\246M\212\232\022&\230I\035#\323f\305Rg"
+	.ascii	"\306\212\236\234\031\225icB\003=9\027f\330\025,\0136\206]\352"
+	.ascii	"\3148b\246\215\t\346q\204\236\234\365/D(y\2307\310\030\024\300"
+	.ascii	"\260\314\0139H\034\233\031\031\307\025\256MO\016\314\316\016"
+	.ascii	"\217\022\277\270a\352\364\250K\344\216\213\344\261(\343\250\274"
+	.ascii	"\314\027\037\316\323\203T\216`\362\360(G\\H\332\300\270K\233"
+	.ascii	"\030H\034\346\322\370\024-P\334\224\3109AB\204\206w\320A\b\030"
+	.ascii	"d\200\204\007\2547\"\226/\230G\030#\222<0`\360\334\214H\352\034"
+	.ascii	"a\214\270Q.G\210\3600\302\b2"
+	.ascii	"\220I\234\035\036\033\030E\0262\220I\033\030E-5\nC\231[\234X"
+	.ascii	"\024\217\315$6\263\214\262:\256\206\340T\252\261\032D\025b\315"
+	.ascii	"*P\261f\020\277\020\275$\256\267\025\024m\242\255\240\370\253"
+	.ascii	"@\256^iY\232zj\254\376P\255\214D\241\350\231\335\357\257H_\224"
+	.ascii	"$\215\325\036\252\017\032\253\350\223\266\003~\232T\270U\270"
+	.ascii	"\247\362P\231\216\300\274\370h\334\177\211mx]d\322\304\bo\252"
+	.ascii	"\367\302\360\322\222T\250*\244\005\313\025\227\272\003\313\223"
+	.ascii	"\304\300\276\306\352\231\352t\365IuR\243:\310\007mOV\276\243"
+	.ascii	"-R\324\250\253P2D\232gY\252\016\303U\305S\211\256\322P\211T\246"
+	.ascii	"[w\371\276\214,ya\250\001H\325CM\272\312tu\251\004\212\373%}"
+	.ascii	"\224\2255Vs\\\305\001dK\231S\305\241\325w\206(\267\252J\034D"
+	.ascii	"\031N\035>\255\350\260\270\032\267\212t?\243(\\Q\215\325\243"
+	.ascii	"\003\236\211YA\251FV\252\352\200\032\253Ej\rkv9\325\306\2454"
+	.ascii	"\030\242\020=\221\223\262>\004\366rE\325\211\266\026\215V\034"
+	.ascii	"^\315\207\252PO\25547"
+	.string	"A\233\201*\332\272\0201,\314\316&\rd\302\240\242\020U\241\253A\267\n\227/\202?*\320!\232\021\275\034\353\325&.\242\345\004\027\243\024B\246J\331VZc\214x\234\030E\252\007U\321\372\343/P\356\236\242\215\037#\264\036&q-Vm9\036\334\202\r\251h\025M\327/\242.x\270\313\261\241Z\241\r\247\334\030s\301\205\352]`\224\017\023f\241\202^uSE\272\343\002'8\270\026\241\370\035\007\372\375=M\275b\246K\356\2744\306\200x\372\007\363\266\032\241\346\216\263\314a\276|\001\343\236\246^\001\203\366\250R\2614H4\035BB$\"\"I\222\2441R\013\020\204\"Y\030\306\364<\022\200d1\220)\245\020\221\221\031\021\021\021i\325\376\006I]\364\301\026.\023\375t'OF\236\r\263%\301\232\347\226\005.,\351BX\215\212Z\236]\177\3017$\256!\336\356\035\023\006/\302\001\236'\311"
+	.string	"\242\034\260\355\201\266\260\204\204\364\243\361S\302\214c\265\331Q\203\225%'\270zH\033\253\260\271\030\n\274\235\374\034\016\323/Z\2776\240\202\330~\206\214t\0016Ca\210\242\372\230$\271t\252\b\252^Zt0B\333_\211\033h\f\270\342^\314\312\362,\252Oc\355Y\347Q\006-\206Kh\t\324f\035+\373A7\270\001: \330X\235x\022"
+	.string	"s\252!\245\267b\230\244\216\216!?QB(I\303x\242x\372\266\025/\360e\2136\236\317\372\340n,l6\023t\371(\204+\206h\3433\257\003|\376\001N\301\266\022\230\231e\220T\021Z\251\004\223\317LB=Z\252\312\232\235p\002\375x\240\025\016?X\007\203[?\207\236\372\320+\227\354\002e\323\225\203\214]%\327\317\224\323\230\240\336qe\215\213E\257\213>\331\233\271\t\201\257\2779I>\334\214\235\242\260,\351\255\025-\202\236\267\332\032\003`\203\3418p\007\2430O\253nr\334\2779\365p5\"\030B\332~\024\013Q\327*\310E\254wa\3538\352A\347\353NW1\303[\320\346:<\375\316cB9~\342\037c\321\030~$\215D#c\205\017b\273\\\264}6\300i"
+	.ascii	"\354\f=\352#i\346c*F\r\025N\371\t\026\266u\0043\254\206\033\023"
+	.ascii	"\313\036\fQ\233jz@\202\016b\333\315\037\201\211\023}\366\377"
+	.ascii	"st\031*g\356jc\3346\3567\201Y\371\202c\023\350Xb\223{N\274\033"
+	.ascii	"\266\343\025\241\216\216S\032\222\366\235\256>\334O\022>\246"
+	.ascii	"\250>\322Y\300\260\257\016T\271n\003}\312T\313\327\020\367}\335"
+	.ascii	"\275\202\246\2555C\024B\306_\245^\304\327v\221Tf\2751\347=\270"
+	.ascii	"i\017\372\027\373o\314R\216\276d\306\026\222\205\\_B\016\f4e"
+	.ascii	"\003Hm'r\032\361\245\263\211D\257H\205\227Uj~\217I\032c_\257"
+	.ascii	"\320\031\2010&\036\323c\304\251\212\344\337\271M\352l\202\255"
+	.ascii	"\250\370\032>\232\300'J\273\277\263\346\007z?\365q\206F\354\273"
+	.ascii	"+PU\306\377r\352\316\335\255\252\301\"\345&}L\207\361\013Y\272"
+	.ascii	"Q\356=l\313\265\362 [#I\246\036\002g|\325\361\341\341)<\013\307"
+	.ascii	"\232[\031A\311\325%}\370\272\273B-\344\201\032\003\256\366/\t"
+	.ascii	"*i\357\300\0040\246\245'\271{\323\221\037qY\267\2522E\t\315\324"
+	.ascii	"\023\277^\023\364dE\360\330\203ej"
+	.string	"\016J>+\271`\251\250\376\3731\316\357\224=\251Ue\fle\336\346\3401\fqWw\266=\210\210\356.\231\340\357\365v\221\362\271\370\303\026L\360\366\217\337I^\250\265\277\304\027\330\250d'\253\225\212\021\f\260b\276[\311\026\236\271\377v\343_\301\270\374\251mY\263>\257D\203+\313l\256\311\033\005\277\323\006 \302\006\006-\300v\356\"\006I\216\374ok\241\221\266K/\364(6G\300Z~]\260h\367-(o\2564{\274\024\241P\004\331R\r6\315\215-\202\340\032\265\321r\353\357\370\203\227\224\272#t\276\255c\237\035H\270\346\254\377I\2059lTyY\255)FoS\265\267\310<\203\322\270\200\347\b+\356\317\245\342\004\254\242V\370\235&\353j\322S\210\007j$\322U\036sG\246\217\256%9\032\213W\241\352-\206\257r\351\254\017\006\231yl\206\274\024-\371G\243\350\001\351j\262\013\354"
+	.string	"C\311o\035\313ai\346{\270\264\240\271\271\224\347G\r\324q\030\3108u:\334\344\2465\013'\221\313\262!2-1\035!P\300G\222\353>\234k\343\311p;\216X\376X)\210\300bD\230j-Aw9^{\311c\t\350O\344\264E\302\231\212\355\262%\232b\316\227\336v\035N\2756M8\341\246(XU\302|\233Igr.eE\fTh\002\217\226\324kh\374\355\274:\211$\264\337\230J\241\353u\347% \373-~\020\r\326\244~\341\370V@\032\023Pk\315\211k:ifS\013\037\234u\354\322;G~g\265\276\2713ev-\003M\027\256f\374L\241\350i\211\354 \245qxK\354Q=\306k8Bp\026\232\305\301\251\f\215\027\"\366\\\205\372\352\350\352\242"
+	.ascii	"v\030K\306d&\n\334\2023\325\371?\314\210\372\"\207\322\3253e"
+	.ascii	"\3375\232\312\fK\225\301@TB\263\344\263(\244\342\225\026GCg\332"
+	.ascii	"9\327w\241JIr;\367\212W\034ks4\254\346\277\222\f)\355\212f\266"
+	.ascii	"\034w\2710\211\274\355\235\316Kj wm\037\206\373d\241\004\253"
+	.ascii	"*\336L\027\\\200\336\026\302\225j\370=AC\321~\215\377`\344<\304"
+	.ascii	"\201\374-\316\305wB;\224Z\001,\203%\226\204p\224\006\007\006"
+	.ascii	"D\200\337\316\233\b\202\346\300\316\271\275Q\036/\237\017n\334"
+	.ascii	"=\332\234\2267*\203}yI \220\206\374\341>4\316\302^i\301\314\034"
+	.ascii	"\264\303\2714\310\275x\274\002\254H\n\223s\324.\247{\324\322"
+	.ascii	"t\232\fPr5\204{(\177\266y\006C\\\"4\316r\231Pn/\177\022\027o"
+	.ascii	"\212\243p\303\255\355\003\214$|\313\311\2101\f\255ge\252e\245"
+	.ascii	"\362\002E\340\233\026J\032~\177\0166\005\ncY\210\350\327\024"
+	.ascii	"\020\3168\0053Q\363\0349\250)\262\030\354\3356\021\002\200\343"
+	.ascii	"dB\321W]\2102\2142\307\202|\353E`\210-\310\200\332$\004\260!"
+	.ascii	"\335\224\232\350\320"
+	.string	"\246\037df\230&\213HaM\362\262y\266\225$\311\341\217\223\246\265\322\300\257\326v\237$w\ryL~\267eY\230cQn'Kt"
+	.ascii	"l\200~!\266\216x\367nc>\236k\351\371Nv\275\217\317\203\255\363"
+	.ascii	"SN\3748+`\242\217\027\272\363 `KA\255\2026^\207\367\237\243\030"
+	.ascii	"\305\030\3656B\370\216\263\235R\331\275<\226\313\205\222]\222"
+	.ascii	"\264O\321\177>/\244\357\213;\372N\204\313\024c74\001\276'\371"
+	.ascii	"\326\371\3764\316\242\214Vaw\b?\303\260g\221\343\r\344\201\361"
+	.ascii	"\257\220>\265\"y\2266\315\261c\231>\303x\254#$\323\300i\253\350"
+	.ascii	"}\351\311_\373=\251sC\375y\272\276b\331\267\201\374\177\b\337"
+	.ascii	"\330\326\277\337f\350W\332\263\267\305F\236g\212\225zP\362\206"
+	.ascii	"\345\227?\371J3MBk\034\357\237\256\362\035\347/\244\r\214\307"
+	.ascii	"\260\270m\372\267\364\033o\203\257\025/\317\257|my\f\027\030"
+	.ascii	"k\267d\022\017\210ht\222\217f\263\016\275\272\022\323~O\220\247"
+	.ascii	"\216\027\353t\230\305\311\375\364h\\b\301B\253\370\303\372\313"
+	.ascii	"\301'\360a.\364\030\316`m>\224-P\r\222\265\361T\320\003\274\214"
+	.ascii	"p\325\337\3015V?\026/\247m\200F\264\006|\034\2607\345\204\257"
+	.ascii	"}\201\376RG\366}\024P\336\214Z\300\264\201\347\254\361R\222#"
+	.ascii	"\251\346\300\367\034\205\324j\377h\005"
+	.text
+	.section	.gnu.lto_.symtab.ea2e7e5c021cb25,"e",@progbits
+	.string	"sin_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"gcd"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"wrap_18000"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"wrap_36000"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"fapplyDeadbandf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\001"
+	.string	""
+	.string	"devClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"devPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"devVariance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"devStandardDeviation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"rotationMatrixFromAngles"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\001"
+	.string	""
+	.string	"rotationMatrixFromAxisAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"quickMedianFilter3"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\001"
+	.string	""
+	.string	"quickMedianFilter3_16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"quickMedianFilter5"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"quickMedianFilter5_16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"quickMedianFilter7"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"quickMedianFilter9"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"arraySubInt32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"sensorCalibrationResetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"sensorCalibrationPushSampleForOffsetCalculation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\002"
+	.string	""
+	.string	"sensorCalibrationPushSampleForScaleCalculation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"sensorCalibration_ForwardSubstitution"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"sensorCalibration_BackwardSubstitution"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"sensorCalibrationValidateResult"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\002"
+	.string	""
+	.string	"sensorCalibrationSolveForOffset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\002"
+	.string	""
+	.string	"sensorCalibrationSolveForScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\002"
+	.string	""
+	.string	"bellCurve"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ea2e7e5c021cb25,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8469 @@
+	.file	"memory.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/log.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/fc/runtime_config.h"
+	.file 7 "./src/main/common/memory.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	memory.c.917e710f
+	.weak	memory.c.917e710f
+memory.c.917e710f:
+	.long	0x41f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xc
+	.long	.LASF1293
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.long	.LASF1182
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x33
+	.uleb128 0xa
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1174
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1175
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1176
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1177
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1178
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1179
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1180
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1181
+	.uleb128 0x5
+	.long	.LASF1183
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5d
+	.uleb128 0xe
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1184
+	.uleb128 0xa
+	.long	0x80
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1185
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x7
+	.long	0x5d
+	.byte	0x4
+	.byte	0x15
+	.long	0xf3
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1191
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1195
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1196
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1197
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1198
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1199
+	.byte	0x4
+	.byte	0x23
+	.byte	0x3
+	.long	0x9f
+	.uleb128 0x7
+	.long	0x5d
+	.byte	0x5
+	.byte	0x16
+	.long	0x1ef
+	.uleb128 0x1
+	.long	.LASF1200
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1206
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1207
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1208
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1226
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1227
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1232
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1233
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1234
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1235
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1236
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1237
+	.byte	0x25
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1238
+	.byte	0x5
+	.byte	0x3d
+	.byte	0x3
+	.long	0xff
+	.uleb128 0xf
+	.byte	0x8
+	.long	0x87
+	.uleb128 0x7
+	.long	0x5d
+	.byte	0x5
+	.byte	0x43
+	.long	0x28b
+	.uleb128 0x1
+	.long	.LASF1239
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1240
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1241
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1242
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1243
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1247
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1248
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1249
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1250
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1251
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1252
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1253
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1254
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1255
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1256
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1257
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.long	0x5d
+	.byte	0x6
+	.byte	0x15
+	.long	0x356
+	.uleb128 0x1
+	.long	.LASF1260
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1261
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1262
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1263
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1264
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1265
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1266
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1267
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1268
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1269
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1270
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1271
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1272
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1273
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1274
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1275
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1276
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1277
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1278
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1279
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF1280
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF1281
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF1282
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF1283
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1294
+	.byte	0x6
+	.byte	0x47
+	.byte	0x11
+	.long	0x93
+	.uleb128 0xb
+	.long	0x93
+	.long	0x373
+	.uleb128 0x11
+	.long	0x33
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1284
+	.byte	0x29
+	.byte	0x11
+	.long	0x362
+	.uleb128 0x6
+	.long	.LASF1285
+	.byte	0x2a
+	.byte	0x11
+	.long	0x93
+	.uleb128 0xb
+	.long	0x22
+	.long	0x399
+	.uleb128 0x12
+	.long	0x33
+	.byte	0x24
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1286
+	.byte	0x2b
+	.byte	0xf
+	.long	0x389
+	.uleb128 0x13
+	.long	.LASF1287
+	.byte	0x4
+	.byte	0x2f
+	.byte	0x6
+	.long	0x3c1
+	.uleb128 0x8
+	.long	0xf3
+	.uleb128 0x8
+	.long	0x5d
+	.uleb128 0x8
+	.long	0x1fb
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1295
+	.byte	0x7
+	.byte	0x47
+	.byte	0x8
+	.long	0x22
+	.uleb128 0x16
+	.long	.LASF1288
+	.byte	0x7
+	.byte	0x42
+	.byte	0x8
+	.long	0x22
+	.long	0x3e9
+	.uleb128 0x9
+	.long	.LASF1289
+	.byte	0x42
+	.byte	0x2f
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1296
+	.byte	0x7
+	.byte	0x2d
+	.byte	0x8
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF1290
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x22
+	.uleb128 0x9
+	.long	.LASF1289
+	.byte	0x2d
+	.byte	0x37
+	.long	0x1ef
+	.uleb128 0x6
+	.long	.LASF1291
+	.byte	0x2f
+	.byte	0xc
+	.long	0x7e
+	.uleb128 0x6
+	.long	.LASF1292
+	.byte	0x30
+	.byte	0x12
+	.long	0x2e
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF539
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF605
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF641
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF521
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF669
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF670
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF448
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF730
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF745
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF747
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF562
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF749
+	.file 31 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF750
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF767
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF780
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF785
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF788
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF789
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF806
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF807
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF808
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF820
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF827
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF828
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF832
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x4
+	.file 51 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x33
+	.file 52 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF837
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF900
+	.byte	0x4
+	.file 54 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x36
+	.file 55 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 56 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x38
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 57 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x4
+	.file 59 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3c
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 62 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x3e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 63 "./src/main/common/memory.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1162
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF459
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF518
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF547
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF599
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF640
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF685
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF727
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF756
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF762
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF766
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF779
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF787
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF790
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF801
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF823
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF826
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF394
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF549
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF551
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF553
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF993
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1006
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1007
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF601
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF603
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1008
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1031
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1032
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1033
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1034
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1173
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1297
+	.long	.LASF1298
+	.long	.LASF1299
+	.long	.LASF1300
+	.long	.LASF1301
+	.long	.LASF1302
+	.long	.LASF1303
+	.long	.LASF1304
+	.long	.LASF1305
+	.long	.LASF1306
+	.long	.LASF1307
+	.long	.LASF1308
+	.long	.LASF1309
+	.long	.LASF1310
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x40
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1311
+	.byte	0xe
+	.long	.LASF1312
+	.byte	0xa
+	.long	.LASF1313
+	.byte	0xa
+	.long	.LASF1314
+	.byte	0x2
+	.long	.LASF1315
+	.byte	0x4
+	.long	.LASF1316
+	.byte	0x5
+	.long	.LASF1317
+	.byte	0x2
+	.long	.LASF1318
+	.byte	0xd
+	.long	.LASF1319
+	.byte	0xd
+	.long	.LASF1320
+	.byte	0xa
+	.long	.LASF1321
+	.byte	0xd
+	.long	.LASF1322
+	.byte	0xd
+	.long	.LASF1323
+	.byte	0xa
+	.long	.LASF1324
+	.byte	0xa
+	.long	.LASF1325
+	.byte	0xc
+	.long	.LASF1326
+	.byte	0xa
+	.long	.LASF1327
+	.byte	0xb
+	.long	.LASF1328
+	.byte	0xb
+	.long	.LASF1329
+	.byte	0xa
+	.long	.LASF1330
+	.byte	0xa
+	.long	.LASF1331
+	.byte	0xa
+	.long	.LASF1332
+	.byte	0xa
+	.long	.LASF1312
+	.byte	0xc
+	.long	.LASF1333
+	.byte	0xa
+	.long	.LASF1334
+	.byte	0xa
+	.long	.LASF1335
+	.byte	0x9
+	.long	.LASF1336
+	.byte	0x9
+	.long	.LASF1337
+	.byte	0x9
+	.long	.LASF1338
+	.byte	0x9
+	.long	.LASF1339
+	.byte	0xa
+	.long	.LASF1340
+	.byte	0xd
+	.long	.LASF1340
+	.byte	0xa
+	.long	.LASF1341
+	.byte	0xa
+	.long	.LASF1342
+	.byte	0xa
+	.long	.LASF1343
+	.byte	0xa
+	.long	.LASF1344
+	.byte	0xc
+	.long	.LASF1344
+	.byte	0xa
+	.long	.LASF1345
+	.byte	0x9
+	.long	.LASF1346
+	.byte	0x9
+	.long	.LASF1347
+	.byte	0x9
+	.long	.LASF1348
+	.byte	0x9
+	.long	.LASF1349
+	.byte	0xa
+	.long	.LASF1350
+	.byte	0xa
+	.long	.LASF1351
+	.byte	0xa
+	.long	.LASF1352
+	.byte	0xa
+	.long	.LASF1353
+	.byte	0xa
+	.long	.LASF1354
+	.byte	0xa
+	.long	.LASF1355
+	.byte	0xd
+	.long	.LASF1356
+	.byte	0xa
+	.long	.LASF1357
+	.byte	0xa
+	.long	.LASF1358
+	.byte	0xe
+	.long	.LASF1358
+	.byte	0xd
+	.long	.LASF1359
+	.byte	0xa
+	.long	.LASF1360
+	.byte	0x8
+	.long	.LASF1361
+	.byte	0x7
+	.long	.LASF1362
+	.byte	0x6
+	.long	.LASF1363
+	.byte	0x7
+	.long	.LASF1364
+	.byte	0x7
+	.long	.LASF1365
+	.byte	0xe
+	.long	.LASF1366
+	.byte	0x3
+	.long	.LASF1367
+	.byte	0x1
+	.long	.LASF1368
+	.byte	0x2
+	.long	.LASF1369
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF845:
+	.string	"INT32_MAX (2147483647)"
+.LASF819:
+	.string	"__ONCE_ALIGNMENT "
+.LASF943:
+	.string	"USE_1WIRE_DS2482 "
+.LASF685:
+	.string	"__STD_TYPE typedef"
+.LASF805:
+	.string	"__fsfilcnt_t_defined "
+.LASF938:
+	.string	"USE_OPFLOW "
+.LASF446:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1177:
+	.string	"unsigned char"
+.LASF636:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1139:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1182:
+	.string	"size_t"
+.LASF910:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1118:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF649:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1212:
+	.string	"OWNER_SYSTEM"
+.LASF1122:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF846:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF771:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1257:
+	.string	"RESOURCE_ADC_CH4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF981:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1017:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1289:
+	.string	"owner"
+.LASF546:
+	.string	"__stub_sigreturn "
+.LASF410:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF508:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF774:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF522:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF745:
+	.string	"__clockid_t_defined 1"
+.LASF1116:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF483:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF718:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1169:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF891:
+	.string	"INT16_C(c) c"
+.LASF374:
+	.string	"__unix 1"
+.LASF904:
+	.string	"USE_I2C_PULLUP "
+.LASF454:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1280:
+	.string	"ARMING_DISABLED_OOM"
+.LASF783:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1058:
+	.string	"U_ID_0 0"
+.LASF1128:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF923:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1008:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF608:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF911:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1069:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1023:
+	.string	"USE_UART7 "
+.LASF1032:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1113:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF918:
+	.string	"USE_TELEMETRY "
+.LASF617:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1088:
+	.string	"UNIT_TESTED "
+.LASF860:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF497:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF705:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1114:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF730:
+	.string	"__STD_TYPE"
+.LASF781:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF716:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF786:
+	.string	"____sigset_t_defined "
+.LASF470:
+	.string	"__P(args) args"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF749:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF794:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF518:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF964:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF698:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1286:
+	.string	"dynHeapUsage"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF897:
+	.string	"UINT64_C(c) c ## UL"
+.LASF976:
+	.string	"USE_SERIALRX_SUMD "
+.LASF898:
+	.string	"INTMAX_C(c) c ## L"
+.LASF601:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1063:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1288:
+	.string	"memGetUsedBytesByOwner"
+.LASF658:
+	.string	"__f64x(x) x ##f64x"
+.LASF1010:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1277:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF635:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1002:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF643:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF895:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF729:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF582:
+	.string	"__size_t "
+.LASF839:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF682:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1229:
+	.string	"OWNER_SPI_PREINIT"
+.LASF458:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF870:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF903:
+	.string	"I2C2_OVERCLOCK false"
+.LASF752:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF485:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF1135:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF848:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF869:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF760:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF530:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF991:
+	.string	"USE_CLI_BATCH "
+.LASF1030:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF861:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF865:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1264:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF825:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1278:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF1266:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF400:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF602:
+	.string	"NULL"
+.LASF1059:
+	.string	"U_ID_1 1"
+.LASF480:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF956:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF712:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1295:
+	.string	"memGetAvailableBytes"
+.LASF1052:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF886:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF542:
+	.string	"__stub_fchflags "
+.LASF1038:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF821:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF707:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF632:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF793:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF424:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1215:
+	.string	"OWNER_SDCARD"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF409:
+	.string	"__USE_XOPEN2K8"
+.LASF975:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF507:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF909:
+	.string	"USE_SERIALRX_IBUS "
+.LASF751:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF420:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF810:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1097:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF456:
+	.string	"__GLIBC__ 2"
+.LASF1293:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1175:
+	.string	"long int"
+.LASF765:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF785:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1290:
+	.string	"wantedSize"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF425:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF442:
+	.string	"__USE_XOPEN2K8 1"
+.LASF713:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1248:
+	.string	"RESOURCE_I2C_SCL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF755:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1099:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF937:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF565:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1191:
+	.string	"LOG_TOPIC_PWM"
+.LASF1124:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1207:
+	.string	"OWNER_ADC"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF727:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1131:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1239:
+	.string	"RESOURCE_NONE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF606:
+	.string	"WNOHANG 1"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF876:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1178:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF504:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF505:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF488:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF472:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF620:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1035:
+	.string	"USE_DASHBOARD"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1078:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1112:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1296:
+	.string	"memAllocate"
+.LASF1249:
+	.string	"RESOURCE_I2C_SDA"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1214:
+	.string	"OWNER_I2C"
+.LASF493:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF883:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1075:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1216:
+	.string	"OWNER_FLASH"
+.LASF1154:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1213:
+	.string	"OWNER_SPI"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF654:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF393:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1291:
+	.string	"retPointer"
+.LASF688:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1233:
+	.string	"OWNER_AIRSPEED"
+.LASF486:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF667:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF820:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF463:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF656:
+	.string	"__f64(x) x ##f64"
+.LASF1271:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1180:
+	.string	"signed char"
+.LASF1094:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1287:
+	.string	"_logf"
+.LASF763:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF672:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF474:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF973:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1243:
+	.string	"RESOURCE_TIMER"
+.LASF1198:
+	.string	"LOG_TOPIC_COUNT"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1222:
+	.string	"OWNER_INVERTER"
+.LASF521:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1294:
+	.string	"armingFlags"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF584:
+	.string	"__wchar_t__ "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF754:
+	.string	"__PDP_ENDIAN 3412"
+.LASF947:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF703:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1031:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1162:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF731:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1134:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF430:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF709:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF471:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1093:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF413:
+	.string	"__USE_FILE_OFFSET64"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF670:
+	.string	"_BITS_TYPES_H 1"
+.LASF792:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1144:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF919:
+	.string	"USE_TELEMETRY_LTM "
+.LASF812:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1065:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1234:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1019:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF928:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF739:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF840:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1050:
+	.string	"USE_VCP"
+.LASF800:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF916:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF515:
+	.string	"__restrict_arr __restrict"
+.LASF540:
+	.string	"__stub___compat_bdflush "
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1121:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF907:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF613:
+	.string	"__WALL 0x40000000"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF417:
+	.string	"__USE_GNU"
+.LASF452:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF856:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF826:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF494:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF854:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF640:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF563:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1125:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF708:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1077:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF545:
+	.string	"__stub_setlogin "
+.LASF1196:
+	.string	"LOG_TOPIC_VTX"
+.LASF562:
+	.string	"__need_size_t "
+.LASF945:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF675:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF527:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1147:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF512:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF432:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF626:
+	.string	"__WCOREFLAG 0x80"
+.LASF1152:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF900:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1201:
+	.string	"OWNER_PWMIO"
+.LASF965:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1205:
+	.string	"OWNER_SERVO"
+.LASF407:
+	.string	"__USE_XOPEN2K"
+.LASF1209:
+	.string	"OWNER_PINDEBUG"
+.LASF1268:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF408:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1269:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF664:
+	.string	"__lldiv_t_defined 1"
+.LASF510:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1071:
+	.string	"FAST_CODE "
+.LASF567:
+	.string	"_SIZE_T "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF439:
+	.string	"__USE_POSIX199309 1"
+.LASF1140:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1061:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF867:
+	.string	"INT_FAST8_MAX (127)"
+.LASF855:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF680:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF896:
+	.string	"UINT32_C(c) c ## U"
+.LASF631:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF875:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF402:
+	.string	"__USE_POSIX199309"
+.LASF645:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF902:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF660:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF659:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1098:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1161:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF625:
+	.string	"__W_CONTINUED 0xffff"
+.LASF719:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF732:
+	.string	"__ino_t_defined "
+.LASF885:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1204:
+	.string	"OWNER_MOTOR"
+.LASF962:
+	.string	"USE_STATS "
+.LASF1195:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF953:
+	.string	"USE_FRSKYOSD "
+.LASF457:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF406:
+	.string	"__USE_UNIX98"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF809:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF423:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF795:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF1115:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF728:
+	.string	"_BITS_TIME64_H 1"
+.LASF691:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1259:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF676:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1172:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF932:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF721:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF906:
+	.string	"USE_SERIAL_RX "
+.LASF789:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF514:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF908:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1020:
+	.string	"USE_UART4 "
+.LASF479:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF723:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF988:
+	.string	"USE_VTX_FFPV "
+.LASF744:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1028:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1080:
+	.string	"bool _Bool"
+.LASF1127:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF591:
+	.string	"_BSD_WCHAR_T_ "
+.LASF724:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF665:
+	.string	"RAND_MAX 2147483647"
+.LASF1160:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF1276:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1108:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF872:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF960:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF492:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF974:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1091:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1096:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1136:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF873:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF702:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF772:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF603:
+	.string	"NULL ((void *)0)"
+.LASF1110:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1033:
+	.string	"USE_USB_MSC"
+.LASF1060:
+	.string	"U_ID_2 2"
+.LASF1189:
+	.string	"LOG_TOPIC_BARO"
+.LASF502:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF604:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1255:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1256:
+	.string	"RESOURCE_ADC_CH3"
+.LASF440:
+	.string	"__USE_POSIX199506 1"
+.LASF1024:
+	.string	"USE_UART8 "
+.LASF650:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF853:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF443:
+	.string	"_ATFILE_SOURCE"
+.LASF681:
+	.string	"__SLONG32_TYPE int"
+.LASF888:
+	.string	"WINT_MIN (0u)"
+.LASF770:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF462:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF648:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF963:
+	.string	"USE_CMS "
+.LASF1151:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF396:
+	.string	"__USE_ISOC11"
+.LASF447:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF791:
+	.string	"__NFDBITS"
+.LASF836:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF837:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF797:
+	.string	"NFDBITS __NFDBITS"
+.LASF550:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF955:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF710:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF989:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF633:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF607:
+	.string	"WUNTRACED 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1105:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF857:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF879:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1284:
+	.string	"dynHeap"
+.LASF704:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1150:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1224:
+	.string	"OWNER_LED"
+.LASF1174:
+	.string	"long unsigned int"
+.LASF847:
+	.string	"UINT8_MAX (255)"
+.LASF813:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1235:
+	.string	"OWNER_PINIO"
+.LASF465:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF433:
+	.string	"_POSIX_SOURCE"
+.LASF1068:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1183:
+	.string	"__uint32_t"
+.LASF1246:
+	.string	"RESOURCE_UART_TXRX"
+.LASF431:
+	.string	"__USE_ISOC95 1"
+.LASF531:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF544:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1193:
+	.string	"LOG_TOPIC_IMU"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1197:
+	.string	"LOG_TOPIC_OSD"
+.LASF647:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1066:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1132:
+	.string	"UNUSED(x) (void)(x)"
+.LASF484:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1092:
+	.string	"EXTENDED_FASTRAM "
+.LASF920:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1250:
+	.string	"RESOURCE_SPI_SCK"
+.LASF790:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1120:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF644:
+	.string	"__HAVE_FLOAT64 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF466:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF564:
+	.string	"__need_NULL "
+.LASF395:
+	.string	"_FEATURES_H 1"
+.LASF428:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1231:
+	.string	"OWNER_TEMPERATURE"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF609:
+	.string	"WEXITED 4"
+.LASF706:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF464:
+	.string	"__LEAF , __leaf__"
+.LASF411:
+	.string	"__USE_LARGEFILE"
+.LASF979:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF496:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1244:
+	.string	"RESOURCE_UART_TX"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1141:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1241:
+	.string	"RESOURCE_OUTPUT"
+.LASF1011:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF686:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF935:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF776:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF1156:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF1025:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1003:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF834:
+	.string	"_BITS_WCHAR_H 1"
+.LASF661:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF759:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF986:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1210:
+	.string	"OWNER_TIMER"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF998:
+	.string	"_T_PTRDIFF_ "
+.LASF1014:
+	.string	"USE_FAKE_GPS "
+.LASF1171:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1104:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF415:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1001:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1149:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF1252:
+	.string	"RESOURCE_SPI_MISO"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1219:
+	.string	"OWNER_OSD"
+.LASF722:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF921:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF630:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF780:
+	.string	"_SYS_SELECT_H 1"
+.LASF587:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF524:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1062:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF401:
+	.string	"__USE_POSIX2"
+.LASF1100:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF827:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF583:
+	.string	"__need_size_t"
+.LASF987:
+	.string	"USE_VTX_TRAMP "
+.LASF1042:
+	.string	"USE_PITOT_MS4525"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF743:
+	.string	"__key_t_defined "
+.LASF1176:
+	.string	"long long int"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF533:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF538:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF599:
+	.string	"__DEFINED_wchar_t "
+.LASF833:
+	.string	"_STDINT_H 1"
+.LASF764:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF653:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1218:
+	.string	"OWNER_BEEPER"
+.LASF862:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1167:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF878:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1081:
+	.string	"true 1"
+.LASF519:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF589:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF978:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1225:
+	.string	"OWNER_RX"
+.LASF1275:
+	.string	"ARMING_DISABLED_CLI"
+.LASF469:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1106:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF742:
+	.string	"__daddr_t_defined "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF500:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1194:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF1053:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF460:
+	.string	"__PMT"
+.LASF1013:
+	.string	"USE_FAKE_MAG "
+.LASF941:
+	.string	"USE_PITOT_MS4525 "
+.LASF822:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF775:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1158:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF639:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1146:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF619:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF866:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF444:
+	.string	"_ATFILE_SOURCE 1"
+.LASF677:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF889:
+	.string	"WINT_MAX (4294967295u)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF418:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF535:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF996:
+	.string	"_ANSI_STDDEF_H "
+.LASF777:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF1292:
+	.string	"wantedWords"
+.LASF714:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF778:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF622:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1179:
+	.string	"unsigned int"
+.LASF828:
+	.string	"__have_pthread_attr_t 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF952:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF461:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1072:
+	.string	"NOINLINE "
+.LASF588:
+	.string	"_T_WCHAR "
+.LASF1043:
+	.string	"USE_PITOT_ADC"
+.LASF1041:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF992:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF414:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1079:
+	.string	"_STDBOOL_H "
+.LASF598:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1240:
+	.string	"RESOURCE_INPUT"
+.LASF1211:
+	.string	"OWNER_RANGEFINDER"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF441:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1232:
+	.string	"OWNER_1WIRE"
+.LASF715:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF674:
+	.string	"__U32_TYPE unsigned int"
+.LASF1265:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF969:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF999:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF491:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1133:
+	.string	"BIT(x) (1 << (x))"
+.LASF997:
+	.string	"_PTRDIFF_T "
+.LASF1226:
+	.string	"OWNER_TX"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF495:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF830:
+	.string	"alloca"
+.LASF517:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF543:
+	.string	"__stub_gtty "
+.LASF585:
+	.string	"__WCHAR_T__ "
+.LASF858:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF711:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF851:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1056:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF971:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF597:
+	.string	"_GCC_WCHAR_T "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF927:
+	.string	"USE_GYRO_KALMAN "
+.LASF506:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF779:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1283:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF740:
+	.string	"__id_t_defined "
+.LASF1253:
+	.string	"RESOURCE_SPI_CS"
+.LASF784:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF890:
+	.string	"INT8_C(c) c"
+.LASF736:
+	.string	"__nlink_t_defined "
+.LASF1274:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF421:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF726:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF455:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF690:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF697:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF616:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF467:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF523:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF615:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF473:
+	.string	"__STRING(x) #x"
+.LASF1076:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1208:
+	.string	"OWNER_SERIAL"
+.LASF520:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF629:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF958:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF966:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1203:
+	.string	"OWNER_PPMINPUT"
+.LASF586:
+	.string	"_WCHAR_T "
+.LASF1123:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF646:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1012:
+	.string	"USE_FAKE_BARO "
+.LASF1004:
+	.string	"_GCC_PTRDIFF_T "
+.LASF917:
+	.string	"USE_NAV "
+.LASF1220:
+	.string	"OWNER_BARO"
+.LASF1247:
+	.string	"RESOURCE_EXTI"
+.LASF951:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1242:
+	.string	"RESOURCE_IO"
+.LASF1184:
+	.string	"char"
+.LASF468:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF529:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1223:
+	.string	"OWNER_LED_STRIP"
+.LASF594:
+	.string	"_WCHAR_T_H "
+.LASF970:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF959:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1272:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1254:
+	.string	"RESOURCE_ADC_CH1"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1245:
+	.string	"RESOURCE_UART_RX"
+.LASF901:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1027:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1200:
+	.string	"OWNER_FREE"
+.LASF699:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1095:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1258:
+	.string	"RESOURCE_RX_CE"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1040:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF980:
+	.string	"USE_SERIALRX_CRSF "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF972:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF750:
+	.string	"_ENDIAN_H 1"
+.LASF448:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1157:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF782:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF398:
+	.string	"__USE_ISOC95"
+.LASF1005:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1145:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF881:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF397:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF982:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF884:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF405:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF627:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF638:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF767:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF475:
+	.string	"__BEGIN_DECLS "
+.LASF1143:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF766:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF868:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1119:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF503:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1109:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF610:
+	.string	"WCONTINUED 8"
+.LASF1155:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF787:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1237:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF838:
+	.string	"__intptr_t_defined "
+.LASF700:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF696:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1217:
+	.string	"OWNER_USB"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1187:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF930:
+	.string	"USE_RX_UIB "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1185:
+	.string	"long long unsigned int"
+.LASF383:
+	.string	"SITL 1"
+.LASF651:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1138:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1159:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF399:
+	.string	"__USE_ISOCXX11"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF741:
+	.string	"__ssize_t_defined "
+.LASF684:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1000:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1262:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF957:
+	.string	"USE_D_BOOST "
+.LASF859:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1086:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF668:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1009:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF747:
+	.string	"__timer_t_defined 1"
+.LASF436:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1163:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF621:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF733:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF662:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF499:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF403:
+	.string	"__USE_POSIX199506"
+.LASF753:
+	.string	"__BIG_ENDIAN 4321"
+.LASF892:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1236:
+	.string	"OWNER_IRLOCK"
+.LASF1021:
+	.string	"USE_UART5 "
+.LASF1111:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF949:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF824:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF605:
+	.string	"_STDLIB_H 1"
+.LASF445:
+	.string	"__WORDSIZE 64"
+.LASF1070:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF799:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF593:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1153:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF547:
+	.string	"__stub_stty "
+.LASF948:
+	.string	"USE_DASHBOARD "
+.LASF871:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF481:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF683:
+	.string	"__S64_TYPE long int"
+.LASF1082:
+	.string	"false 0"
+.LASF534:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF768:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF478:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF404:
+	.string	"__USE_XOPEN"
+.LASF590:
+	.string	"_WCHAR_T_ "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF808:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1285:
+	.string	"dynHeapFreeWord"
+.LASF940:
+	.string	"USE_OPFLOW_MSP "
+.LASF1188:
+	.string	"LOG_TOPIC_GYRO"
+.LASF1117:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1016:
+	.string	"USE_BARO "
+.LASF673:
+	.string	"__S32_TYPE int"
+.LASF849:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF614:
+	.string	"__WCLONE 0x80000000"
+.LASF915:
+	.string	"USE_GPS "
+.LASF596:
+	.string	"__INT_WCHAR_T_H "
+.LASF1227:
+	.string	"OWNER_RX_SPI"
+.LASF939:
+	.string	"USE_OPFLOW_CXOF "
+.LASF887:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF983:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF807:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF912:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF893:
+	.string	"INT64_C(c) c ## L"
+.LASF801:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF450:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF634:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF899:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF738:
+	.string	"__off_t_defined "
+.LASF933:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1055:
+	.string	"USE_ITCM_RAM"
+.LASF929:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF985:
+	.string	"USE_VTX_CONTROL "
+.LASF1054:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF841:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF818:
+	.string	"__LOCK_ALIGNMENT "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF637:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF541:
+	.string	"__stub_chflags "
+.LASF1170:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1107:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF788:
+	.string	"__timeval_defined 1"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF1267:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF717:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1022:
+	.string	"USE_UART6 "
+.LASF1103:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF737:
+	.string	"__uid_t_defined "
+.LASF994:
+	.string	"_STDDEF_H "
+.LASF1251:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF762:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1164:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF1074:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF925:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF528:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF641:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1165:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF511:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF416:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1047:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF835:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF655:
+	.string	"__f32(x) x ##f32"
+.LASF1037:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF501:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1049:
+	.string	"USE_ADC"
+.LASF624:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1045:
+	.string	"USE_1WIRE_DS2482"
+.LASF1101:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1046:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF942:
+	.string	"USE_1WIRE "
+.LASF1263:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF796:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF476:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF611:
+	.string	"WNOWAIT 0x01000000"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF449:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF842:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1279:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1181:
+	.string	"short int"
+.LASF459:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1199:
+	.string	"logTopic_e"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF426:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF803:
+	.string	"__blkcnt_t_defined "
+.LASF913:
+	.string	"USE_64BIT_TIME "
+.LASF843:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF773:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF489:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF802:
+	.string	"__blksize_t_defined "
+.LASF936:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1166:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF934:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1282:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1089:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF526:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF678:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1260:
+	.string	"ARMED"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1007:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF537:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF669:
+	.string	"_SYS_TYPES_H 1"
+.LASF487:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1090:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF950:
+	.string	"USE_OLED_UG2864 "
+.LASF695:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1051:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1067:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF490:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF679:
+	.string	"__SWORD_TYPE long int"
+.LASF1148:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF498:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF692:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF437:
+	.string	"__USE_POSIX 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF880:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF877:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1073:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF536:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF657:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1084:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1261:
+	.string	"WAS_EVER_ARMED"
+.LASF1087:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF946:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF628:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF671:
+	.string	"__S16_TYPE short int"
+.LASF823:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF746:
+	.string	"__time_t_defined 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1129:
+	.string	"EXPAND_I(x) x"
+.LASF850:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF769:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1057:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF592:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF509:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF894:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF924:
+	.string	"USE_PITOT_ADC "
+.LASF595:
+	.string	"___int_wchar_t_h "
+.LASF1137:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1126:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1206:
+	.string	"OWNER_SOFTSERIAL"
+.LASF761:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF931:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1048:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF525:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1230:
+	.string	"OWNER_COMPASS"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF513:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF642:
+	.string	"__HAVE_FLOAT16 0"
+.LASF663:
+	.string	"__ldiv_t_defined 1"
+.LASF427:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1018:
+	.string	"USE_UART2 "
+.LASF687:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF600:
+	.string	"_BSD_WCHAR_T_"
+.LASF1281:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF756:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1186:
+	.string	"uint32_t"
+.LASF429:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF689:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF852:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1168:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF864:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF477:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF758:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF434:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF438:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF701:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF623:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF532:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF844:
+	.string	"INT16_MAX (32767)"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1044:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1029:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF693:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF735:
+	.string	"__mode_t_defined "
+.LASF1036:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF694:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1034:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1238:
+	.string	"resourceOwner_e"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1173:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF922:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF832:
+	.string	"__COMPAR_FN_T "
+.LASF376:
+	.string	"unix 1"
+.LASF748:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF990:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1228:
+	.string	"OWNER_VTX"
+.LASF829:
+	.string	"_ALLOCA_H 1"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF968:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1202:
+	.string	"OWNER_PWMINPUT"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF451:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1083:
+	.string	"__bool_true_false_are_defined 1"
+.LASF612:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF720:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1026:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF618:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1039:
+	.string	"USE_RANGEFINDER"
+.LASF977:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1006:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF734:
+	.string	"__gid_t_defined "
+.LASF961:
+	.string	"USE_LOG "
+.LASF905:
+	.string	"USE_RX_PPM "
+.LASF482:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF539:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF914:
+	.string	"USE_BLACKBOX "
+.LASF666:
+	.string	"EXIT_FAILURE 1"
+.LASF1270:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1142:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1192:
+	.string	"LOG_TOPIC_TIMER"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF995:
+	.string	"_STDDEF_H_ "
+.LASF419:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1130:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF984:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF412:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1102:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1064:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF806:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1085:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF757:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF798:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF548:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF993:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF831:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF874:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF725:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1221:
+	.string	"OWNER_MPU"
+.LASF882:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF811:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF435:
+	.string	"_POSIX_C_SOURCE"
+.LASF926:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1273:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF1015:
+	.string	"USE_MAG "
+.LASF863:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF967:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF516:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1190:
+	.string	"LOG_TOPIC_PITOT"
+.LASF944:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF804:
+	.string	"__fsblkcnt_t_defined "
+.LASF954:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1346:
+	.string	"__sigset_t.h"
+.LASF1353:
+	.string	"struct_mutex.h"
+.LASF1364:
+	.string	"common_post.h"
+.LASF1326:
+	.string	"long-double.h"
+.LASF1355:
+	.string	"alloca.h"
+.LASF1300:
+	.string	"src/main/drivers"
+.LASF1350:
+	.string	"thread-shared-types.h"
+.LASF1320:
+	.string	"libc-header-start.h"
+.LASF1365:
+	.string	"stdbool.h"
+.LASF1308:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1340:
+	.string	"endian.h"
+.LASF1298:
+	.string	"src/main/common"
+.LASF1339:
+	.string	"stdint-intn.h"
+.LASF1362:
+	.string	"target.h"
+.LASF1307:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1310:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1327:
+	.string	"stubs.h"
+.LASF1302:
+	.string	"src/main/target/SITL"
+.LASF1352:
+	.string	"atomic_wide_counter.h"
+.LASF1324:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1306:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1319:
+	.string	"stdlib.h"
+.LASF1322:
+	.string	"features-time64.h"
+.LASF1351:
+	.string	"pthreadtypes-arch.h"
+.LASF1312:
+	.string	"types.h"
+.LASF1342:
+	.string	"byteswap.h"
+.LASF1331:
+	.string	"floatn.h"
+.LASF1316:
+	.string	"runtime_config.h"
+.LASF1335:
+	.string	"clock_t.h"
+.LASF1309:
+	.string	"/usr/include"
+.LASF1348:
+	.string	"struct_timespec.h"
+.LASF1337:
+	.string	"time_t.h"
+.LASF1297:
+	.string	"src/main/build"
+.LASF1345:
+	.string	"sigset_t.h"
+.LASF1332:
+	.string	"floatn-common.h"
+.LASF1361:
+	.string	"common.h"
+.LASF1333:
+	.string	"typesizes.h"
+.LASF1349:
+	.string	"pthreadtypes.h"
+.LASF1329:
+	.string	"waitflags.h"
+.LASF1336:
+	.string	"clockid_t.h"
+.LASF1321:
+	.string	"features.h"
+.LASF1334:
+	.string	"time64.h"
+.LASF1313:
+	.string	"stdint-uintn.h"
+.LASF1317:
+	.string	"memory.c"
+.LASF1303:
+	.string	"src/main/target"
+.LASF1368:
+	.string	"utils.h"
+.LASF1338:
+	.string	"timer_t.h"
+.LASF1314:
+	.string	"log.h"
+.LASF1304:
+	.string	"src/main"
+.LASF1299:
+	.string	"src/main/config"
+.LASF1330:
+	.string	"waitstatus.h"
+.LASF1315:
+	.string	"resource.h"
+.LASF1359:
+	.string	"wchar.h"
+.LASF1301:
+	.string	"src/main/fc"
+.LASF1356:
+	.string	"stdlib-bsearch.h"
+.LASF1354:
+	.string	"struct_rwlock.h"
+.LASF1305:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1363:
+	.string	"sanity_check.h"
+.LASF1325:
+	.string	"cdefs.h"
+.LASF1344:
+	.string	"select.h"
+.LASF1358:
+	.string	"stdint.h"
+.LASF1367:
+	.string	"build_config.h"
+.LASF1311:
+	.string	"stddef.h"
+.LASF1328:
+	.string	"stubs-64.h"
+.LASF1360:
+	.string	"platform.h"
+.LASF1323:
+	.string	"wordsize.h"
+.LASF1343:
+	.string	"uintn-identity.h"
+.LASF1369:
+	.string	"memory.h"
+.LASF0:
+	.string	"./src/main/common/memory.c"
+.LASF1347:
+	.string	"struct_timeval.h"
+.LASF1366:
+	.string	"parameter_group.h"
+.LASF1341:
+	.string	"endianness.h"
+.LASF1318:
+	.string	"stdc-predef.h"
+.LASF1357:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 g}\002"
+	.string	"\264\003["
+	.string	"\b"
+	.string	"\224\240\327\365\001\004\002"
+	.string	"\334\251\200\320\005\002\003\352\263\360\321\b\004\211\275\264\263\013\b\001\002\002\005\240\342\234\212\n\006\007\361\356\201\263\r\b\213\375\362\201\002\002\002"
+	.string	"\002"
+	.string	""
+	.string	"\007"
+	.string	":\245\244\234\331\331a\250\372.\241\3442\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 15\001"
+	.string	"\340%"
+	.string	"\005"
+	.string	""
+	.string	"\003"
+	.string	"\001\002"
+	.string	"\003\004\002"
+	.string	"\003"
+	.string	"\002"
+	.string	"\001\007\001\003"
+	.string	"\002\b"
+	.string	"\003"
+	.string	"\003"
+	.string	"0\203\0019m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\245\005"
+	.string	"R\212!+pK\222\016|\004p\030V\236\211\200H\032\f\003\f8x\305G$/\332B\003\261\376WU\017\203\333 k\254\265\304\266\266\211\334)\253\277F\255\004\330\026\342\315\213\207\320\026\372\345\301\216\006\007\314\261\340\2649\244h\373\330a\001\n?Y\"\374W\0170#b\342\342\276\02714*6\030\207\fQ\202\003\345h\366'\332\334\236$a\021-T& \004\337\266\323/\271\177\316\305_\251m\031\276=lh\013\371e\003\b\021"
+	.ascii	"\320F\350\016\372rm\005\033K\300a5Lh\205\016\265\353>\030\320"
+	.ascii	"\312p)k\224q[\023\2026\025\017?\257eiM\003C"
+	.text
+	.section	.gnu.lto_.jmpfuncs.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 \340\245\004"
+	.string	"\022H\034$pk\322\001\310P\305\372\377\013\267\312\264)K\227\007%\334\377\370h\201>P\364\302\367\032P\003\tb\267L\001C\006\267p\357Q\f\227\200^\365<`\024=\256QxBA\351I\016\002]e9\004\177\033xJb\332K\263K\240s\021\030\253\245\351\31426\031\007m\262\317\330\251\265S\313\0363\342\\=4\210\226_\226\351\327j\331~\300\212\277\022\r"
+	.ascii	"\204\312e\325X\024\330\310a\037P\b\344A\343&8\033\246\336\243"
+	.ascii	"\371\226\231G\354\302\032@\021"
+	.text
+	.section	.gnu.lto_.pureconst.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\230\004\002\204\004\004\230\004\007\204\004\b\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 \215\005\002"
+	.string	"4\002\201"
+	.string	"\005"
+	.string	"\001\002\t\001"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	"\374\007\002\n"
+	.string	"\001\002\003\001"
+	.string	"\007\001\300\001"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	"\013"
+	.ascii	"V\230t\224\336\247,R\223\232T\017\300\312{\312\330\302lg\016"
+	.ascii	"\330\266\2016"
+	.text
+	.section	.gnu.lto_.lto.326003c5ada12956,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_memAllocate.29.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`\030\004m\035"
+	.string	"\366w\300H\240\330M:\205\342\265/h\375\323\007\373\361tao\372h\3121M\b\244\323\264P\31632)\302\241oj\2375\217\025\216\251\024\2101\017\317\344\241w\\^?\332\326\327\016\311\342UD\030i=W|l\310 \233H\231d\251"
+	.string	"\236"
+	.string	"\257"
+	.string	";\236~\257\325\264\357\335\267\243\030\345\313\332\260\253^\231\017\342\251X#h\367=,\025C9\250\n\366v\234U\fN\327\202X\203\230\177\265?\257\244\351V,\326\246V\034`(\210\2474\260\206L\320\371I\216\204\351"
+	.ascii	"j\315a$J\255g\203] \236\356\356\336\310\253\232v\303|N\236\f"
+	.ascii	"\240\257]\257L\255gm\317\357\204\247\342\003\204\247\315\343"
+	.ascii	"M\247`s\323\376\276\033\360\375L)\247S\221\306A\231\024\2157"
+	.ascii	"\250\343\243\342b&\365\0046(\302\023\273\357\034%\225c\256\031"
+	.ascii	"\252\265.\233R2\276\341wW\303\356B\355\202\017\002Pl\373\037"
+	.ascii	"[&\361\315\244\360\224\233@\017\0338\376\355\016\027\330\254"
+	.ascii	"\217u\032\177\271\302\367\254\231K7\326_\257\020\247\3375itS"
+	.ascii	"9\376\355\201\324\232\020\025\216\305\366>\302\230\031SYl\367"
+	.ascii	"\314q\353\330=X;\307.\345\365\241\274=\224\227\347V\277N\316"
+	.ascii	"\261\276\263#\371qn(\357Hye\224\327&\344\025C\336\360Y_JyA\312"
+	.ascii	"\333!/S\336\013\030\341$\006\314Js9k\214\037\232\212\205n\005"
+	.ascii	"9\326\237u\336\375~\311\231\354\216\273t\255}\223\252\251\252"
+	.ascii	"Z\353x\272_\262\264\001{\337E-W\260\354\332iA\237\256\351\351"
+	.ascii	"\206\3604X{\372:!b\3634\030\266\033\3031\271,\213\bXe\261\277"
+	.ascii	"\320\335\310B^\031\373\n\023O\027+\262\266\351\261;L7\325\342"
+	.ascii	"-k\252eg#\307\277\017\367b\022\367]\257BTD\362M2<\265i\036/["
+	.ascii	"_bS\2719&lnq\326a\267\223\335\030\351\225\323\317\272\007*\334"
+	.ascii	"\271\222zx\346\356\256\370\024[\001^\2555\302\326\245\224\330"
+	.ascii	"\3778\335#\023&\302\323\234f-f\r\262\013\214\277X\371\272\272"
+	.ascii	"u,X\317\024\202=\342\352\353\211\317\354\254\273\301\276n\212"
+	.ascii	"\273\373\273\261\375\223\007kt\200&"
+	.string	"\201F#\311\333\004\332\217\021\251DTT\2368AD\253`\340F*!\035\225\030\224\310\233,\205\321\255\3540\336H\244\245\222.\t \007\020H\b\016\204~t\310\025G\033\214H%$\242%\331\026\375\250\270\2256\322VC*m\266\262\250\206tDd\253\025\335R\324~\006l\211\202\274\325\224\312\362V\033O\334A\220\366\b\343I\347\364MG\355\356M\013Q\341:\307\341w\323C8*\200w/d\340\233\264\273\235V\207\005C=Q\341\364nX&\206z:k\255@\374\031G\212\360\300\035\366\351k}K\007\004\274Zu7=\210:2\301)x\005\341\036D\270\033B\004\337\fL\250!\030H!\210\fB\246FDh\306L\007`\"1\205\267\001\020\200W\2535\225\217\220\343<F\020\356\361Vum\226a$\244-\272r\346\241\n\r\322Q\022\241\272N\3009\226<\035&i2\274N7v\361\210D\315"
+	.string	"@&x\324.\004\t\342n\341%\342\323/\301\276\020\307\367\236w\302\\\004\335\325\302H\2036X\314\215\2702Y\254'\342$"
+	.ascii	"\237\352q\363E\320\326\303\240\237\033s\222Y#\333\207W\244\351"
+	.ascii	"x\256\177#\"\243\346\350\305\022\255=\212\224\261\036c8Q\201"
+	.ascii	"\307L\337\204U\305\227\352\177\264m5\340J\003"
+	.text
+	.section	.gnu.lto_memGetUsedBytesByOwner.30.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\215\f"
+	.string	"F\330T@ q\223\016p,\001Y\316'2"
+	.string	"R\250\2329\355d%\n}\336+,\345\234(D\250v\267\206\366,w\"\n\357@aR\240^\002Xh\302<\0365)\"\210\376\242#b\367\033\331{K\231RA"
+	.string	"A"
+	.string	"@"
+	.ascii	"!\254B\t\032\273qr\374\200ww\271"
+	.string	"\200w\247\033~\3355\315\313\227D\234\f\f.\260\354s\007 ;y\273\234\\\003d\242\366\261\273\037=K\262P\246$\262\273N,3\271\337m+\260\235\300\376\202~[U\261\235v\217\277j\372\357eh\341\301\262{\241\345\306\262p+\036\354\217\360\330\030[Z\241\311\374\310\017q\021\236\307\2169vSXT\354F\003.p\271\373h\266\375\017\007\341\361\345\0219\230\274\273{\3007\361\023\017\374\016w\256`\036\273\363\341\273s\312\261\002\312\226\3744)\355\021\ty,U\365cU\223\270\223\026D(\273\253\311Tw\236\252\306 \001C\2245\214I\331\264a\307P\252\006\007n\240\001\t\241B@\020d:,\212C\002\2357\031\n\026\254\250j\342\300\252\202\233\211\343\200A5m\254\221)C\300\020\002eM\021 \264&L\004\275\255\252\370\243w4\247n\232z-\321\317@\001i\25057\341(\256\247x\021\030"
+	.ascii	"\237IEk<d\033\026b\"\202\020\b\227u \005Ps\325Y\241,\005)\300"
+	.ascii	"\016\251\261S\260\3275q\315\204\232\2130\257B\203\023\224T\203"
+	.ascii	"P\341i\252\351\241\220lm)\003"
+	.text
+	.section	.gnu.lto_memGetAvailableBytes.31.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"E\b"
+	.string	"\206P:4P\215\322\001\263\306l[yC\023\323u$\322\026@\312\177\335\334\373\357\315S\264\246-n\262L\335S\331\022\231\2316c\372\265\233%\201\263(c\333\233H\231R*"
+	.string	"+"
+	.string	")"
+	.string	"(\223]\rZ\273\300\273\003x\300\273\323\211{\236\036\377\034w%\020 \243\322\347YA\330]\347\250d\272\365\266-\266\017l\247\002\022\366\253\325\223\355\264\323\264j:3\375\3672F\b>vI\033\312\212\270\020\013\373\035\035\333\3625\276\321\261g@\2430\275\214$\nZ\355\235z\252\017]d\271\371\232zQ\212\357qm\343W\270\201\223\037\335\371\234ww\265\220<\200r\263\025\261ybk\237\324\306\\\034\260xe.\250\211\327\0251P\243\220pA\f\266\201\227\002\307\205\f\006\031b\304\240\245\355\253\325\223S\003\220f\256\234VP!\214,7g\n"
+	.ascii	"2\241\277\037\370d\002\327\315y\031*\024\327D\356!\210\314\210"
+	.ascii	"\304\2356\265\223\f"
+	.text
+	.section	.gnu.lto_memAllocate.part.0.35.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`\363\002\225\025"
+	.string	"\006'\211J\320\360(\035\220\321\224%\260\3369\004Z0P\r.q\355\334\377\024\374\320\216\263N\304\246\310\350l\325W\376\232Zo\250\244?|\\~P\250_\350\244w\373\004c\236t\f\f\205\033\271\331\206\216\354\017\207T;\233%d\357\224\002o"
+	.string	"v"
+	.string	"o"
+	.string	"g\361\036\333}f\006\260;\302\006\212\370p\005\332\3054\272\313\235\273;\222\302QB\351\317\363\320^`\027g\347h\367\204\340\007\342CpEm\306\266\277\363\236\315fRp\352|\030Q\202\371q\332=\307\207>\217"
+	.ascii	"\365P\274\001\324\303Z\342\266W\n\332\374\033\035\004\350\307"
+	.ascii	"\243yy\365\240\001q\372q0\305\332]\2135wx\333&\266cv\215\020"
+	.ascii	"?\321]\204\267\234\032=\025\233;Cb\246\241f\016x\320\341d\232"
+	.ascii	"\356\373\207\356#=\311V9\366#\337\327\263\351\355\256\n)\346"
+	.ascii	"\373\276\232?t\242\027\335\310*\327j\265U\356\\\232\231\363<"
+	.ascii	"4\026"
+	.string	"n\207\222B\251\351>\233\037t!\253\036\2121B-\314\324\363\343\224A|(\206(\261\037\004\324\302\302\355\026\374!q\366B\036z\2028\243\273\334\215\270% \375\217\003\366\225.#\305?a\225\026=\257\205z\370\232\300\204\210\033\375\231\324\261\264\364\311\001\350\217\036C\003\003\235]\335y.QG6p\200\3627\240\354WI\317\363JW_|\243\2134r,-\365aP\237\377\366\342\367\235\322'\237\347\226p\243O\256`\315\261\017\356\356\272\342\330/\272k\212\232\246\250\237\002\331\r\260\331\225\371\355\330\2330\t\305\213\002v1\313\027\371Z\261\224+Y\013\005\001&)\203\271\312\n2\322\364\210\255\230%\006\225I\302feh\226\021\022\023\322\204\344D\344\203\354\340\262\260B\312`*3\017\267D\\\314\362E\276FX\371z\225\255\021\346Ry\215-36\212,p\311\2014GYY\232\243\352\340V\034\247\300"
+	.string	"\321\361\265\306\330\256\365\344\346Vq\027~K[Y\267J\353\214\363n\020\330\335\247\240^i=L\r\216\376\002> \200\242)\253;\217\306\"4Ab1lG\023%\250\216\270\n\005t\031\346\335XE\003\217\324\355\335\305\336\003\263\003+\252mh\261\273\264p\253 .\202t\274\310\2101\200\300\251\244U\332\"S\021\217\352\350\217\366 \306\211\302R\\!<\302\005,\216\241\023\336\002\344\035\305V\334"
+	.ascii	"\303\035w \321\324\354M\311A\033\b\332\323M\177\302\026K[h\377"
+	.ascii	"Q\035\233\331\202\302\025\\\341]M\324\016\357l\370k\317\313l"
+	.ascii	"\334{m\300\003"
+	.text
+	.section	.gnu.lto_memGetUsedBytesByOwner.part.0.37.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`\214\001\025\017"
+	.string	"\246\\cC"
+	.string	"s\224\016#Mze\351\275\005\264\275G\200?\207\201J\203\005^{\236\362xS\246\260\255"
+	.string	"o\323>\250_O\3208\223\304o6\206\244\377\377z\020\bV\310x\342\017}\036r\263\300\2645B\366\2262\245O"
+	.string	"P"
+	.string	"N"
+	.string	"\273 j\304\330\375\026XA\3461\004\346\013)\305\266\237\342.%\233\f|#6d(\357\304\325c\367\333\036\375\275@\366\230\371\200\354QE\334tMh\362y\254rx*\026\256w==\025\016O\220C\215\301\356:\323\341\216\267]b\333\201\2351pW\001\274\024\013\257eS\237\210\310\246,\205"
+	.ascii	"\006\025\ne\307[O\373>\314c\354\215E\177Y\303z\241\330\335\r"
+	.ascii	"\214\350~\213\344\273\274\261M:k\024\262\022y\364[%{\363h\023"
+	.ascii	"\217\362Bjew;\032\215\216\346W\370*\376\225\316\032Y\023\232"
+	.ascii	"\372\223\037\376\213\303\220\340\2230\327\345\275.{\274&\320"
+	.ascii	"\261:e\314\2179\200\327\211\033\233\260kP}\300\261\351\273x\302"
+	.ascii	"|\326\335\340\2240+\324\020\366\341*\213\255\245\243\226\206"
+	.ascii	"ZZ\265tf\351k\002\020\270\354\242\304|\354J\224Q\242E\206\320"
+	.ascii	"\031!\371\220\214\224p@B\037\220I\027\355\341\214B\035\367\341"
+	.ascii	"6P\307q\235g\003Ex\300m\236\020\205\215s\300\335\204Oh\253\320"
+	.ascii	"u\241-\017WY\254i\221P\243f\260\035\365\256\377\345\345\301\306"
+	.ascii	"IQ\n\241j.\225\tT\306\234\n\367\236\221\251^\325\202\n# \220"
+	.ascii	"\2421#\363\036QA\223\221\337P\030%\241y/\347\f\227\200GE\035"
+	.ascii	"A\210\331\001r\305\254\221G\255\242Ed\374\341\016;\376\341B\226"
+	.ascii	"|\"\210\307\310\270\002\213\336O*\215\315e\237\325V\320D\240"
+	.ascii	"\234\032\214+\307\271\303\006\330\360\240;\257\305c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 \353\235\004"
+	.string	"\222\207\034'\220+\215\001\177\327\354W\327\257\320K3\366\005{\321\r`fQww\306\226F\002\345D\246\005\213\206\210\356\275\245L\001\343\303L"
+	.string	"\233&\210\027\246B\2711i\203\t\322p<Qc\270\211f\177\256\265O\205\020Z\341A\251\234\264\221\206\205+$\334\237\317\272H\312H\366(\311\020\024\003\205D\004\016\367W\373\336ey\375\216\205mw7\240\217\374\377\004\013"
+	.ascii	"\023\025F\325\241%s\005.\323;i\322\024%,x\020\035\320\021\216"
+	.ascii	"\004j\214\260\352\t"
+	.text
+	.section	.gnu.lto_.refs.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"\001\b"
+	.string	"\001\001\n"
+	.string	"\001\002"
+	.string	"\003\005"
+	.string	"\005\004"
+	.string	"\003\b"
+	.string	"\002\005\r"
+	.string	"\001\003\022"
+	.string	""
+	.string	"\006\024"
+	.string	"\001\006\027"
+	.string	"\001\007"
+	.string	"\006\005"
+	.string	"\001\b"
+	.string	"\003\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.326003c5ada12956,"e",@progbits
+	.string	"(\265/\375`\244\n]:"
+	.ascii	"\272h\340\026CP\346Q\007_\360\006\315w\365\n~\030\240\215#\242"
+	.ascii	"\210\355\247\272\277\026?u\235~\324\016n\226\f{:\354\2145\337"
+	.ascii	"\215aq{C\202|\021\243L8\001\300?"
+	.string	"+\325\004\243\357\223\232)\326\210\333\206D2\2457\001U\001_\001\271]\254\355\346Kj\222\233_\373\033\374\025\225Jq\346\271\222j\346lr\033\251\\\024\234\033\205\231\227\031\245\271U\246\340\334\037V7\343g|\314\325t;\032O\3239\314\371\320\377\227G\204\f\242\246\006\347\006\276\244foR{\336T\306\311v`u\342\312\340\334.\306\303<\212\344\374W\376\177\001U)eI\036\234}\214C}\254\245N\246\337^\222\331\025\231\024\347\356\260\"1\265\213u\357\371\031\032\257\235\303[\252\n\300N\\I\3650\277\366WI]6\337\357\031\271Xn\024\234#\270\022\230\226f+n\224Ip\356\366/\335\356\305\301\232\210\\-\347G\377_\037O\020\236$\027\234\373\365%uu%\365\217\233\230\257\333\325Z\354\2721\257\345\\\301Q\267\367\351n?\236\240\273\305\272}@\267#8\340\355\006\274@wK\350\356\026N"
+	.string	"A\267\243u\373R\267\253\335\035\327\355D\335\356\335\335\326\335\203\272{\256\273\335\272{\332\335\321\356\276\323\335u\272[\255\273\323\272\233Mw\227u7\231\356&\353\356/\335\r\326\335K\335-\355n\265\256\256\256\256\333\235t{W\367\212\"\017\272;?\321"
+	.ascii	",\377\\\201\002\251q\236B\002\341\334\335\r\276\273\373\303?"
+	.ascii	"\nW\371\\\372\\(\262\365e\275O\246\013}2}\377\206\ty\250\222"
+	.ascii	"\177W\351l1\362\337g\006x\345\223\271>\322\315}\177\351\373\027"
+	.ascii	"\271\364\177.\335(\262\365\271\320g\353B\235L\237\373>\231\257"
+	.ascii	"\374vU\206\375+\235L\037\227\367\371.\024\311\f\340B\235\355"
+	.ascii	"V \257\251o\n\365\302t"
+	.string	"\225\277\205\200\213\322\271\\s_\247\227\375\267Q\253_\372\373\377\374\357r:(SNi\313\222k[\273\246\362m}\b\217\244\227\263\350M\376\232\213\305)\303\352_\317\363\300\320z\373\376\377\325'[\377\267z\227\377I\347\213\246\323\357\\-\237\367J\244V\322\313\211d\225t^=\226$\316t\241^\316\337\2321(\225O\276\255Sy=\317\345\nm\337w\341xsi\330\350pn\362;E\312\367\241Ex\340\214Dq\356\027k\273\235n\247\343ur[\005\016\030\316\270\351K*\2049\277\366\265\235\030 \265\307\371\201+\311QC\3725&u\3368\034?\363\264\027X\253H\363\017\316\036\307\245\355i\216\326\02624Q\033\366`\377\357i\030\234\377HO\353\025\372G\366\334\035\270;\310]\274\276\312\250\001S\3321yp\306YMh\332H\321\302\342\201}\345\221\203\261\360\216\236\227\037L\242\274\275\2425\204\262"
+	.string	"q[wb\260\016|\205u`+\256\2547\374\234#\004\rgl%]wC\230\032'\307p\322\311\212\334\fF\352\206\323\254*\034S{\2411/\204\333\354\373G\242Q\371\345rB\343\266\333\r\371!g\303I\204\344\304\\\301\331\353~\215\377\b+\355\253\rg\242\272\177_R\003<\036[\325CLN\347>h\220\263\345\367\231)\342d\275\321\375\362\235\320X\313\332\356l\352\233\313\275\371\034\323\\Q\0205Ox\340\274C\303\004\347rp\036W\242\375o\337\347R\223XYoI`w\276\234\005j\217\363\350\312vF\350\r#Y\033\267\253\372\206\251\335\315\307\334\315\331r\3303\215\274\270\270z\320\375\237M\340u\371\322\241\345fm=z|\252\376\373\353\344Z~s\331\344\323\374\203\354\312\036\234w{\230\034\217\347i\337\343~\306|\217\267u"
+	.string	"\344\177\362\377H\263\300\263\220\031/t\337l6eC\\\\(8{[\373Az\005\2757=\320\330\301\331\371x4im\256\253\013\347\216\3635\335]\324\340\352\245\203s{\222\265}k\305\335\352#\227\377\337\003\300\373eI$\325\001\2647u\363\234\310\003-\303I\2528e\340\b\034\032\213Qj\324\221(4R\251QR\305)("
+	.string	"\354\024\f\340\224\020H\003\304"
+	.ascii	"V\nX\265\002i\027\303Xd\301\262\306\021T@\266\004\361F\214\036"
+	.ascii	"\201\033!\252\330\343\215\0201\330\252\025G\226\304\220\035."
+	.ascii	"h\031NR\302(b1\b\305\016\205G\342\f\343S0\212A\225\024pj\204"
+	.ascii	"\024Q84\002\217:A\027\251X\343\323\261X4>\035\035Up:\032\201"
+	.ascii	"TN\354\021\030,NM\201\b\n\215,\221\225Z\033\203\006\n\0328\330"
+	.ascii	"\3305\007\017\025<TP\233\203\207\337\317\203\206\337\332\032"
+	.ascii	"~DG(\013\027\216D\341\214\325\b\224\021\314,TPHUT!U\2342b\241"
+	.ascii	"\214,\261\306\t6h\234Q\254b\215\275#\024\213CX\245vT\205\337"
+	.ascii	"\006v\303\257\203\223\200\356\320AD\203\025&H\254A\247\033\306"
+	.ascii	"\342\220\035>\021\213\303a1\370D\024\002\207OAc\325\223\023\002"
+	.string	"#s\270I\006\213X\327t\347\232!\271R\304\355\344\346+h\n\021 \274&l\204\342\206\3406I\315\225\240i\323\331V\262\351ZV\277Qw,\351\004\347\235\022\3546v1\020\003N\242\2669D\232t\377\315&Le\272%\214Gc \215\177X\310\320S\227B\206M\232\036\330Gw\221\221Y\373\3654\264\342%f\356\236f\354\374\220[1\227S\017-\312Y\332\226\t(s\314\340\234\275\335\250X\313\333\364\002\200\277\250\2410\207\02042#$\"\232$Ic\200\002\221\251\312m\021p%tHJ$haRIc\2055@S3\305\364\375\036\r\373\316\307\206\231@\027\334\324\374\257F\274n\252\310\034\311[\257\253\226\335\212\363\355A:\336\200}\343\233\177b\031\321K\017\006\366\217\323\325\344\274\222C>\313'F\"\327+L\356\353\211\274\357\274\265\362\212\031\312\b\306L\fY'@\207u\271\036E\\B"
+	.string	"\335\306\222\220\236I\342\035\021\277*\247\022\031<\006\353\340\255\307\232T3\327\025A\262\277a\bY\333o\312\034O\023\017\020i\004\223\006eL\323N\262'7\r\315\327V\302H:a\371\002\367?\213ZF\324tL+\336\326\005\222\007\227\276\343\223Q\250\276\017\223\362\350\341Y\315\344\303\3074\2206\272P\324,C\020n4"
+	.string	"%\305*\n\3024\212Y\252/\373\203\006d\316F\355\317\337A\034H\200G\340\023\267Y\302\333!\343:i\n#\354P~\356\035\250\261\276\177\326c`#e\033\216\034\360R:\373P\374\267\321;\\\244v\270@\261j\006\177U\345\374\236m\240\307\216\343\300\230\020\006b\324\300h!i\256s\b(8\376\246\006\365S\264Z^"
+	.ascii	"\237R\336\363\027\366;\345\255\202\274O\227'\306K\265\224`s\277"
+	.ascii	"\360\233D.\035~ygkK\261\276Gp\021\356\360\370L\306\005o\022>"
+	.ascii	"\305\314\206\311\321b\341\362\366\375\330\361\351\020\343:\001"
+	.ascii	"\365hD\025"
+	.text
+	.section	.gnu.lto_.symtab.326003c5ada12956,"e",@progbits
+	.string	"memAllocate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354"
+	.string	""
+	.string	""
+	.string	"memGetUsedBytesByOwner"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"memGetAvailableBytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360"
+	.string	""
+	.string	""
+	.string	"_logf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.326003c5ada12956,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8116 @@
+	.file	"olc.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/olc.h"
+	.file 6 "./src/main/common/olc.c"
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	olc.c.9e642a56
+	.weak	olc.c.9e642a56
+olc.c.9e642a56:
+	.long	0x37f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF1246
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1199
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1200
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1201
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1202
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1203
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1204
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x58
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1206
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1207
+	.uleb128 0xd
+	.byte	0x8
+	.long	0x78
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1208
+	.uleb128 0x9
+	.long	0x78
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1209
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1210
+	.uleb128 0x5
+	.long	.LASF1211
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x4c
+	.uleb128 0x5
+	.long	.LASF1212
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x5f
+	.uleb128 0x5
+	.long	.LASF1213
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x5
+	.byte	0x8
+	.byte	0x11
+	.long	0x92
+	.uleb128 0x5
+	.long	.LASF1215
+	.byte	0x5
+	.byte	0x9
+	.byte	0x12
+	.long	0x9e
+	.uleb128 0xe
+	.long	0x7f
+	.long	0xde
+	.uleb128 0xf
+	.long	0x37
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	0xce
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0x18
+	.byte	0x13
+	.long	0xde
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x1b
+	.byte	0x14
+	.long	0xb6
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x1c
+	.byte	0x14
+	.long	0xb6
+	.uleb128 0x10
+	.long	.LASF1247
+	.byte	0x7
+	.byte	0x8c
+	.byte	0xf
+	.long	0x84
+	.long	0x11f
+	.uleb128 0xa
+	.long	0x84
+	.uleb128 0xa
+	.long	0x84
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1248
+	.byte	0x6
+	.byte	0xca
+	.byte	0x5
+	.long	0x58
+	.long	0x1bc
+	.uleb128 0x2
+	.string	"lat"
+	.byte	0xca
+	.byte	0x1c
+	.long	0xb6
+	.uleb128 0x2
+	.string	"lon"
+	.byte	0xca
+	.byte	0x2d
+	.long	0xb6
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0xca
+	.byte	0x39
+	.long	0xaa
+	.uleb128 0x2
+	.string	"buf"
+	.byte	0xca
+	.byte	0x47
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1220
+	.byte	0xca
+	.byte	0x53
+	.long	0xaa
+	.uleb128 0x6
+	.string	"pos"
+	.byte	0xcc
+	.byte	0x9
+	.long	0x58
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0xd1
+	.byte	0x12
+	.long	0xc2
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0xd2
+	.byte	0x12
+	.long	0xc2
+	.uleb128 0x12
+	.long	0x1a3
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0xce
+	.byte	0x34
+	.long	0xaa
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0xce
+	.byte	0x57
+	.long	0x30
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0xd6
+	.byte	0x4b
+	.long	0xaa
+	.uleb128 0x1
+	.long	.LASF1226
+	.byte	0xd6
+	.byte	0x6e
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1231
+	.byte	0xa3
+	.byte	0xc
+	.long	0x58
+	.long	0x25d
+	.uleb128 0x2
+	.string	"lat"
+	.byte	0xa3
+	.byte	0x25
+	.long	0xc2
+	.uleb128 0x2
+	.string	"lon"
+	.byte	0xa3
+	.byte	0x37
+	.long	0xc2
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0xa3
+	.byte	0x43
+	.long	0xaa
+	.uleb128 0x2
+	.string	"buf"
+	.byte	0xa4
+	.byte	0x1e
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1220
+	.byte	0xa4
+	.byte	0x2a
+	.long	0xaa
+	.uleb128 0x6
+	.string	"pos"
+	.byte	0xab
+	.byte	0x9
+	.long	0x58
+	.uleb128 0x1
+	.long	.LASF1227
+	.byte	0xad
+	.byte	0x11
+	.long	0xb6
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0xae
+	.byte	0x11
+	.long	0xb6
+	.uleb128 0x7
+	.uleb128 0x6
+	.string	"i"
+	.byte	0xb3
+	.byte	0x11
+	.long	0xaa
+	.uleb128 0x7
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0xb4
+	.byte	0x15
+	.long	0xb6
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0xb5
+	.byte	0x15
+	.long	0xb6
+	.uleb128 0x6
+	.string	"row"
+	.byte	0xbe
+	.byte	0x10
+	.long	0xaa
+	.uleb128 0x6
+	.string	"col"
+	.byte	0xbf
+	.byte	0x10
+	.long	0xaa
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1232
+	.byte	0x6c
+	.byte	0x11
+	.long	0x30
+	.long	0x2d4
+	.uleb128 0x2
+	.string	"lat"
+	.byte	0x6c
+	.byte	0x2b
+	.long	0xc2
+	.uleb128 0x2
+	.string	"lon"
+	.byte	0x6c
+	.byte	0x3d
+	.long	0xc2
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0x6c
+	.byte	0x49
+	.long	0xaa
+	.uleb128 0x2
+	.string	"buf"
+	.byte	0x6c
+	.byte	0x57
+	.long	0x72
+	.uleb128 0x4
+	.long	.LASF1220
+	.byte	0x6c
+	.byte	0x63
+	.long	0xaa
+	.uleb128 0x6
+	.string	"pos"
+	.byte	0x73
+	.byte	0xe
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1233
+	.byte	0x74
+	.byte	0x11
+	.long	0xb6
+	.uleb128 0x7
+	.uleb128 0x1
+	.long	.LASF1234
+	.byte	0x76
+	.byte	0x11
+	.long	0xaa
+	.uleb128 0x7
+	.uleb128 0x1
+	.long	.LASF1235
+	.byte	0x79
+	.byte	0x10
+	.long	0xaa
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1236
+	.byte	0x5b
+	.byte	0x14
+	.long	0xb6
+	.long	0x2ef
+	.uleb128 0x2
+	.string	"lon"
+	.byte	0x5b
+	.byte	0x34
+	.long	0xb6
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1237
+	.byte	0x4b
+	.byte	0x14
+	.long	0xb6
+	.long	0x322
+	.uleb128 0x2
+	.string	"lat"
+	.byte	0x4b
+	.byte	0x30
+	.long	0xb6
+	.uleb128 0x4
+	.long	.LASF1238
+	.byte	0x4b
+	.byte	0x3c
+	.long	0xaa
+	.uleb128 0x7
+	.uleb128 0x1
+	.long	.LASF1239
+	.byte	0x55
+	.byte	0x15
+	.long	0xb6
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1240
+	.byte	0x41
+	.byte	0xe
+	.long	0x84
+	.long	0x33d
+	.uleb128 0x4
+	.long	.LASF1219
+	.byte	0x41
+	.byte	0x2f
+	.long	0x58
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1241
+	.byte	0x31
+	.byte	0xe
+	.long	0x84
+	.long	0x363
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0x31
+	.byte	0x1d
+	.long	0x84
+	.uleb128 0x4
+	.long	.LASF1243
+	.byte	0x31
+	.byte	0x29
+	.long	0x84
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1249
+	.byte	0x6
+	.byte	0x1e
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1244
+	.byte	0x20
+	.byte	0x10
+	.long	0x58
+	.uleb128 0x1
+	.long	.LASF1245
+	.byte	0x27
+	.byte	0x11
+	.long	0xb6
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF902
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF929
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 29 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1d
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.file 31 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1027
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1028
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1091
+	.byte	0x4
+	.file 33 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF1188
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1198
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF958
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF970
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF971
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF972
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF973
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF980
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF982
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF983
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF984
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF985
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1090
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1132
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1145
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1164
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1181
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1182
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1183
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1185
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1187
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF1250
+	.long	.LASF1251
+	.long	.LASF1252
+	.long	.LASF1253
+	.long	.LASF1254
+	.long	.LASF1255
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1256
+	.byte	0x2
+	.long	.LASF1257
+	.byte	0x2
+	.long	.LASF1258
+	.byte	0x2
+	.long	.LASF1259
+	.byte	0x6
+	.long	.LASF1260
+	.byte	0x1
+	.long	.LASF1261
+	.byte	0x1
+	.long	.LASF1262
+	.byte	0x2
+	.long	.LASF1263
+	.byte	0x5
+	.long	.LASF1264
+	.byte	0x5
+	.long	.LASF1265
+	.byte	0x2
+	.long	.LASF1266
+	.byte	0x5
+	.long	.LASF1267
+	.byte	0x5
+	.long	.LASF1268
+	.byte	0x2
+	.long	.LASF1269
+	.byte	0x2
+	.long	.LASF1270
+	.byte	0x4
+	.long	.LASF1271
+	.byte	0x2
+	.long	.LASF1272
+	.byte	0x3
+	.long	.LASF1273
+	.byte	0x3
+	.long	.LASF1274
+	.byte	0x2
+	.long	.LASF1275
+	.byte	0x2
+	.long	.LASF1276
+	.byte	0x2
+	.long	.LASF1277
+	.byte	0x2
+	.long	.LASF1278
+	.byte	0x2
+	.long	.LASF1279
+	.byte	0x2
+	.long	.LASF1280
+	.byte	0x2
+	.long	.LASF1281
+	.byte	0x2
+	.long	.LASF1282
+	.byte	0x2
+	.long	.LASF1283
+	.byte	0x2
+	.long	.LASF1284
+	.byte	0x1
+	.long	.LASF1285
+	.byte	0x6
+	.long	.LASF1285
+	.byte	0x5
+	.long	.LASF1286
+	.byte	0x2
+	.long	.LASF1287
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1104:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF979:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1043:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF702:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF998:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF627:
+	.string	"__DECL_SIMD_cosl "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF897:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF865:
+	.string	"__DECL_SIMD_asinh "
+.LASF1213:
+	.string	"size_t"
+.LASF872:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1123:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF910:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF863:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF732:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF917:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1115:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF943:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF830:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF649:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF751:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF721:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1176:
+	.string	"_WCHAR_T_H "
+.LASF717:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1082:
+	.string	"INT16_C(c) c"
+.LASF1211:
+	.string	"int32_t"
+.LASF374:
+	.string	"__unix 1"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1245:
+	.string	"initial_exponent"
+.LASF785:
+	.string	"__DECL_SIMD_atan2 "
+.LASF677:
+	.string	"__DECL_SIMD_powl "
+.LASF883:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF736:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF709:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1107:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF926:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1187:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF723:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF680:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1022:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF753:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF704:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1221:
+	.string	"alat"
+.LASF1051:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1109:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF1006:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1061:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF471:
+	.string	"__P(args) args"
+.LASF825:
+	.string	"__DECL_SIMD_atanh "
+.LASF879:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1012:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF661:
+	.string	"__DECL_SIMD_logf128 "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF834:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1088:
+	.string	"UINT64_C(c) c ## UL"
+.LASF828:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1069:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1183:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1175:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1016:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF892:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF896:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1141:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF904:
+	.string	"__HAVE_FLOAT32 1"
+.LASF886:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1030:
+	.string	"INT8_MIN (-128)"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1106:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1060:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1152:
+	.string	"_T_SIZE "
+.LASF1234:
+	.string	"digit_count"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF647:
+	.string	"__DECL_SIMD_sincosl "
+.LASF694:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1220:
+	.string	"bufsize"
+.LASF885:
+	.string	"__DECL_SIMD_tan "
+.LASF663:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1145:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF815:
+	.string	"__DECL_SIMD_log1p "
+.LASF986:
+	.string	"__MATHCALL_NARROW"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1011:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF882:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF869:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF966:
+	.string	"_Mdouble_ _Float32x"
+.LASF1077:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF734:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF990:
+	.string	"FP_NAN 0"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1218:
+	.string	"initial_resolution"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF1111:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1231:
+	.string	"encode_grid"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF707:
+	.string	"__DECL_SIMD_asinl "
+.LASF752:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF938:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF844:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1032:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1246:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1038:
+	.string	"UINT8_MAX (255)"
+.LASF1207:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF931:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF978:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF973:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1002:
+	.string	"MATH_ERREXCEPT 2"
+.LASF953:
+	.string	"_Mdouble_ float"
+.LASF855:
+	.string	"__DECL_SIMD_tanh "
+.LASF1147:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF690:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF826:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1173:
+	.string	"_BSD_WCHAR_T_ "
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF947:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF950:
+	.string	"__MATH_PRECNAME"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF715:
+	.string	"__DECL_SIMD_hypot "
+.LASF981:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF983:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF749:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF771:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1215:
+	.string	"uolc_coord_t"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF997:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF993:
+	.string	"FP_SUBNORMAL 3"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF972:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF915:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF657:
+	.string	"__DECL_SIMD_logl "
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF639:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF804:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1162:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF1122:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF699:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1194:
+	.string	"CODE_LEN_MAX 15u"
+.LASF1189:
+	.string	"SEPARATOR_CHAR '+'"
+.LASF651:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1203:
+	.string	"signed char"
+.LASF806:
+	.string	"__DECL_SIMD_log2f "
+.LASF1102:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF675:
+	.string	"__DECL_SIMD_pow "
+.LASF952:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF919:
+	.string	"__f64x(x) x ##f64x"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF733:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF688:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF814:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1174:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF999:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF822:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1193:
+	.string	"PAIR_CODE_LEN 10u"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF800:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF956:
+	.string	"_Mdouble_ long double"
+.LASF1199:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1052:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF665:
+	.string	"__DECL_SIMD_exp "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1116:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF719:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1063:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1148:
+	.string	"__SIZE_T__ "
+.LASF737:
+	.string	"__DECL_SIMD_exp10l "
+.LASF949:
+	.string	"_Mdouble_"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF874:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF988:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1021:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF925:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1031:
+	.string	"INT16_MIN (-32767-1)"
+.LASF928:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1249:
+	.string	"init_constants"
+.LASF714:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1055:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1156:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1184:
+	.string	"NULL"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1047:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF758:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF824:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF901:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1008:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF794:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF695:
+	.string	"__DECL_SIMD_atan "
+.LASF786:
+	.string	"__DECL_SIMD_atan2f "
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF868:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF805:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1091:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF873:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF636:
+	.string	"__DECL_SIMD_sinf "
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1181:
+	.string	"__DEFINED_wchar_t "
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF991:
+	.string	"FP_INFINITE 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1240:
+	.string	"compute_precision_for_length"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF759:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF731:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF1058:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1130:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF961:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1046:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1013:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1159:
+	.string	"_SIZE_T_DECLARED "
+.LASF866:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF729:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1087:
+	.string	"UINT32_C(c) c ## U"
+.LASF1066:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF867:
+	.string	"__DECL_SIMD_asinhl "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF747:
+	.string	"__DECL_SIMD_coshl "
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF762:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF920:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF924:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF652:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF839:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF847:
+	.string	"__DECL_SIMD_erfl "
+.LASF764:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF992:
+	.string	"FP_ZERO 2"
+.LASF948:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1018:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1117:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF669:
+	.string	"__DECL_SIMD_expf32 "
+.LASF712:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF743:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1158:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1085:
+	.string	"UINT8_C(c) c"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1165:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF840:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF880:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF811:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF774:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF877:
+	.string	"__DECL_SIMD_erfcl "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1093:
+	.string	"bool _Bool"
+.LASF1248:
+	.string	"olc_encode"
+.LASF765:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1227:
+	.string	"lat_grid_size"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF930:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF827:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1120:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF937:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1131:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF628:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF951:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF812:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1034:
+	.string	"INT8_MAX (127)"
+.LASF1037:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF968:
+	.string	"_Mdouble_ _Float64x"
+.LASF1119:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF876:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1064:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF817:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1057:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1185:
+	.string	"NULL ((void *)0)"
+.LASF1196:
+	.string	"GRID_ROWS (ENCODING_BASE / GRID_COLS)"
+.LASF813:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF670:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF705:
+	.string	"__DECL_SIMD_asin "
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF911:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF810:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF1079:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF909:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF790:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF754:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF726:
+	.string	"__DECL_SIMD_exp2f "
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF780:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1028:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF807:
+	.string	"__DECL_SIMD_log2l "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF831:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF862:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF929:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1070:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF742:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF722:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF823:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1075:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF682:
+	.string	"__DECL_SIMD_powf32x "
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF735:
+	.string	"__DECL_SIMD_exp10 "
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF969:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF908:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF891:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF631:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1143:
+	.string	"_GCC_PTRDIFF_T "
+.LASF836:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF760:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF798:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF668:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF939:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF987:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF683:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1001:
+	.string	"MATH_ERRNO 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF878:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1124:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF778:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF893:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1142:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF894:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF922:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF686:
+	.string	"__DECL_SIMD_acosf "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1137:
+	.string	"_T_PTRDIFF_ "
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1192:
+	.string	"ENCODING_BASE 20"
+.LASF1019:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1100:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF797:
+	.string	"__DECL_SIMD_log10l "
+.LASF787:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF971:
+	.string	"__MATHDECL_1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1089:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1169:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF921:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF784:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF637:
+	.string	"__DECL_SIMD_sinl "
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF779:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1010:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1206:
+	.string	"__uint32_t"
+.LASF1151:
+	.string	"_T_SIZE_ "
+.LASF1154:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF838:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1235:
+	.string	"digit_value"
+.LASF1005:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1150:
+	.string	"_SYS_SIZE_T_H "
+.LASF1195:
+	.string	"GRID_COLS 4"
+.LASF775:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1083:
+	.string	"INT32_C(c) c"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF740:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1166:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF634:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF625:
+	.string	"__DECL_SIMD_cos "
+.LASF914:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF641:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF766:
+	.string	"__DECL_SIMD_sinhf "
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1171:
+	.string	"__WCHAR_T "
+.LASF1210:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1007:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF654:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1229:
+	.string	"lat_div"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1222:
+	.string	"alon"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1056:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF461:
+	.string	"__PMT"
+.LASF980:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF835:
+	.string	"__DECL_SIMD_acosh "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF955:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF802:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF884:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF963:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF900:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF959:
+	.string	"_Mdouble_ _Float32"
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1223:
+	.string	"_left0"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF1225:
+	.string	"_left2"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1135:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1009:
+	.string	"M_PI 3.14159265358979323846"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF755:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF829:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF821:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF756:
+	.string	"__DECL_SIMD_expm1f "
+.LASF799:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1127:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF738:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1232:
+	.string	"encode_pairs"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1201:
+	.string	"unsigned int"
+.LASF1025:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF870:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF860:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1170:
+	.string	"_T_WCHAR "
+.LASF967:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF970:
+	.string	"__MATHDECL_1_IMPL"
+.LASF776:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF944:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1092:
+	.string	"_STDBOOL_H "
+.LASF1180:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1020:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF664:
+	.string	"__DECL_SIMD_logf128x "
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF890:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF795:
+	.string	"__DECL_SIMD_log10 "
+.LASF684:
+	.string	"__DECL_SIMD_powf128x "
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF671:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1237:
+	.string	"adjust_latitude"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1049:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1042:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1113:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF727:
+	.string	"__DECL_SIMD_exp2l "
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF676:
+	.string	"__DECL_SIMD_powf "
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF945:
+	.string	"_Mdouble_ double"
+.LASF1136:
+	.string	"_PTRDIFF_T "
+.LASF1094:
+	.string	"true 1"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF678:
+	.string	"__DECL_SIMD_powf16 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1101:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1097:
+	.string	"sq(x) ((x)*(x))"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF673:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1121:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF660:
+	.string	"__DECL_SIMD_logf64 "
+.LASF763:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF913:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1186:
+	.string	"__need_NULL"
+.LASF653:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1161:
+	.string	"___int_size_t_h "
+.LASF858:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1129:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1168:
+	.string	"_WCHAR_T "
+.LASF642:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF907:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF985:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF820:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF837:
+	.string	"__DECL_SIMD_acoshl "
+.LASF841:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF761:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF724:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF545:
+	.string	"__stub_revoke "
+.LASF1236:
+	.string	"normalize_longitude"
+.LASF1208:
+	.string	"char"
+.LASF667:
+	.string	"__DECL_SIMD_expl "
+.LASF629:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1149:
+	.string	"_SIZE_T "
+.LASF850:
+	.string	"__DECL_SIMD_erff64 "
+.LASF746:
+	.string	"__DECL_SIMD_coshf "
+.LASF681:
+	.string	"__DECL_SIMD_powf128 "
+.LASF808:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1044:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1144:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF996:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF770:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF711:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF644:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF730:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1153:
+	.string	"__SIZE_T "
+.LASF819:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF655:
+	.string	"__DECL_SIMD_log "
+.LASF687:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1015:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1072:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF393:
+	.string	"_MATH_H 1"
+.LASF889:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF899:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF887:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF801:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF658:
+	.string	"__DECL_SIMD_logf16 "
+.LASF685:
+	.string	"__DECL_SIMD_acos "
+.LASF1138:
+	.string	"_T_PTRDIFF "
+.LASF1053:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1128:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1045:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF888:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1029:
+	.string	"__intptr_t_defined "
+.LASF713:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF818:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF995:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1191:
+	.string	"PADDING_CHAR '0'"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF856:
+	.string	"__DECL_SIMD_tanhf "
+.LASF383:
+	.string	"SITL 1"
+.LASF912:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF864:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF1157:
+	.string	"_SIZE_T_DEFINED "
+.LASF672:
+	.string	"__DECL_SIMD_expf32x "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1219:
+	.string	"length"
+.LASF650:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1139:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF989:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1050:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1202:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF803:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF768:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1108:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF767:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1036:
+	.string	"INT32_MAX (2147483647)"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF842:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF710:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF933:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1074:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF975:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF982:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF848:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF942:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF940:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1105:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF789:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1198:
+	.string	"LON_MAX (180 * OLC_DEG_MULTIPLIER)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF725:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1243:
+	.string	"exponent"
+.LASF1244:
+	.string	"inited"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF720:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1140:
+	.string	"_PTRDIFF_T_ "
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF739:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1155:
+	.string	"_BSD_SIZE_T_ "
+.LASF1090:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF633:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF781:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF905:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1238:
+	.string	"code_len"
+.LASF881:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF624:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF1040:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1230:
+	.string	"lon_div"
+.LASF646:
+	.string	"__DECL_SIMD_sincosf "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF757:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1000:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF666:
+	.string	"__DECL_SIMD_expf "
+.LASF1024:
+	.string	"_BITS_WCHAR_H 1"
+.LASF648:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF927:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1084:
+	.string	"INT64_C(c) c ## L"
+.LASF854:
+	.string	"__DECL_SIMD_erff128x "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF960:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1114:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF895:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1172:
+	.string	"_WCHAR_T_ "
+.LASF1126:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF777:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1098:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF773:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF846:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1214:
+	.string	"olc_coord_t"
+.LASF708:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1118:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF783:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF898:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF833:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF871:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1026:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1163:
+	.string	"_SIZET_ "
+.LASF662:
+	.string	"__DECL_SIMD_logf32x "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF635:
+	.string	"__DECL_SIMD_sin "
+.LASF994:
+	.string	"FP_NORMAL 4"
+.LASF1133:
+	.string	"_STDDEF_H "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF902:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF906:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF916:
+	.string	"__f32(x) x ##f32"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF976:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1076:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1062:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1241:
+	.string	"pow_negf"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF626:
+	.string	"__DECL_SIMD_cosf "
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF1023:
+	.string	"_STDINT_H 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1033:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF957:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF696:
+	.string	"__DECL_SIMD_atanf "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF816:
+	.string	"__DECL_SIMD_log1pf "
+.LASF964:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1204:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1003:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF845:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1081:
+	.string	"INT8_C(c) c"
+.LASF744:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF728:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1239:
+	.string	"precision"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF851:
+	.string	"__DECL_SIMD_erff128 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF791:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1224:
+	.string	"_right1"
+.LASF716:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1226:
+	.string	"_right3"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1146:
+	.string	"__need_ptrdiff_t"
+.LASF1179:
+	.string	"_GCC_WCHAR_T "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1017:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF936:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF750:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF674:
+	.string	"__DECL_SIMD_expf128x "
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF691:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1125:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1078:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1167:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF875:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF782:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1071:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF974:
+	.string	"__MATHCALL"
+.LASF1068:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF640:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF918:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1086:
+	.string	"UINT16_C(c) c"
+.LASF853:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1164:
+	.string	"__size_t "
+.LASF1095:
+	.string	"false 0"
+.LASF793:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1080:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1110:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF941:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF700:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1041:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF745:
+	.string	"__DECL_SIMD_cosh "
+.LASF788:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF796:
+	.string	"__DECL_SIMD_log10f "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1177:
+	.string	"___int_wchar_t_h "
+.LASF1216:
+	.string	"alphabet"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1217:
+	.string	"grid_size"
+.LASF693:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF861:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF903:
+	.string	"__HAVE_FLOAT16 0"
+.LASF857:
+	.string	"__DECL_SIMD_tanhl "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF701:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1112:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1039:
+	.string	"UINT16_MAX (65535)"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1233:
+	.string	"resolution"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF741:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF859:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1200:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1182:
+	.string	"_BSD_WCHAR_T_"
+.LASF1048:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1212:
+	.string	"uint32_t"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF772:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF748:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF977:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF645:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1103:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1228:
+	.string	"lon_grid_size"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1178:
+	.string	"__INT_WCHAR_T_H "
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1035:
+	.string	"INT16_MAX (32767)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF958:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF934:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF638:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF703:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF849:
+	.string	"__DECL_SIMD_erff32 "
+.LASF832:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1099:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF935:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF689:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF698:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF643:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF1132:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1027:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1209:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF962:
+	.string	"_Mdouble_ _Float64"
+.LASF1059:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1242:
+	.string	"base"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1096:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1190:
+	.string	"SEPARATOR_POS 8"
+.LASF706:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF697:
+	.string	"__DECL_SIMD_atanl "
+.LASF659:
+	.string	"__DECL_SIMD_logf32 "
+.LASF852:
+	.string	"__DECL_SIMD_erff32x "
+.LASF792:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF632:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF946:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1067:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1205:
+	.string	"__int32_t"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF923:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1134:
+	.string	"_STDDEF_H_ "
+.LASF1014:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1247:
+	.string	"powf"
+.LASF692:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF718:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF984:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF932:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1160:
+	.string	"__DEFINED_size_t "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF965:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1188:
+	.string	"OLC_DEG_MULTIPLIER ((olc_coord_t)10000000LL)"
+.LASF769:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF954:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1065:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1073:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1004:
+	.string	"M_E 2.7182818284590452354"
+.LASF679:
+	.string	"__DECL_SIMD_powf32 "
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF843:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1054:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1197:
+	.string	"LAT_MAX (90 * OLC_DEG_MULTIPLIER)"
+.LASF656:
+	.string	"__DECL_SIMD_logf "
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF630:
+	.string	"__DECL_SIMD_cosf64 "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1271:
+	.string	"long-double.h"
+.LASF1273:
+	.string	"stubs-64.h"
+.LASF1254:
+	.string	"/usr/include"
+.LASF1257:
+	.string	"stdint-intn.h"
+.LASF1265:
+	.string	"libc-header-start.h"
+.LASF1251:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1279:
+	.string	"floatn-common.h"
+.LASF1252:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1282:
+	.string	"fp-fast.h"
+.LASF1269:
+	.string	"timesize.h"
+.LASF1258:
+	.string	"stdint-uintn.h"
+.LASF1253:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1286:
+	.string	"wchar.h"
+.LASF1284:
+	.string	"maths.h"
+.LASF1266:
+	.string	"features.h"
+.LASF1275:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1280:
+	.string	"flt-eval-method.h"
+.LASF1281:
+	.string	"fp-logb.h"
+.LASF1255:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1262:
+	.string	"mathcalls.h"
+.LASF1264:
+	.string	"math.h"
+.LASF1259:
+	.string	"stddef.h"
+.LASF1261:
+	.string	"olc.c"
+.LASF1274:
+	.string	"typesizes.h"
+.LASF1267:
+	.string	"features-time64.h"
+.LASF1272:
+	.string	"stubs.h"
+.LASF1260:
+	.string	"olc.h"
+.LASF1270:
+	.string	"cdefs.h"
+.LASF1283:
+	.string	"mathcalls-helper-functions.h"
+.LASF1277:
+	.string	"libm-simd-decl-stubs.h"
+.LASF0:
+	.string	"./src/main/common/olc.c"
+.LASF1276:
+	.string	"math-vector.h"
+.LASF1278:
+	.string	"floatn.h"
+.LASF1287:
+	.string	"stdbool.h"
+.LASF1268:
+	.string	"wordsize.h"
+.LASF1250:
+	.string	"src/main/common"
+.LASF1263:
+	.string	"stdc-predef.h"
+.LASF1285:
+	.string	"stdint.h"
+.LASF1256:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 \247\215\003"
+	.string	"\204\005\233"
+	.string	"\013"
+	.string	"\335\223\343\205\n\024\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002"
+	.string	"\002\002\001\240\342\234\212\n\002\205\365\270\204\016\003\324\345\232\230\n\n"
+	.string	"\004\005\237\335\345\272\b"
+	.string	"\006\316\240\204\300\013"
+	.string	"\007\323\334\235\277\002"
+	.string	"\b\350\373\246\244\f"
+	.string	"\t\340\320\312\262\016\n"
+	.string	"\002"
+	.string	"\n\352\263\360\321\b"
+	.string	"\t"
+	.ascii	"9\203\335\241=\245\004\334\253\024\240\f\204XY\340\2451\030`"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 \353-\003"
+	.string	"\024\003\337"
+	.string	"\007"
+	.string	"\005"
+	.string	"\003\003\005\002"
+	.string	""
+	.string	""
+	.string	"\001\003\002\001"
+	.string	""
+	.string	"\002\006"
+	.string	"\007"
+	.string	"\003\002"
+	.string	"\002\b\003\001\t\005\001\001\003"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	"~\020@N=\020@4\200\304\214\313\231"
+	.string	"\204\241p\030\323\302\245\335\0278^\t@*\020\004n\331\006\f\303IO\345\332\316\202:\225\006R\336"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`A\002\215\017"
+	.string	"\206\031V@ \257$\215\001\351R\030\177\330b(\0308W\257v\005p\341\016|\264\205L\277X\177\327\002\f\343\263>+\324\001\007\345\333\326\022\322\005\034\206X\004R\227\221(\213\024\002N\300\3306\331DJ)SF"
+	.string	"A"
+	.string	"B"
+	.string	"\331\210c\335\365\274 \232\242\306\204\210\334\363\001=1#!&\037\360\225\357\275\267\273C\262\003\210\032\013\355<\257\2440\332`3}\211\302\320\020\342c`J\324M\314w\370\212\246\211\345\216\t\362\363\202\303\342\361\323J \355!\274\367>\277\030\3764\034\233\fPW\021}q\341R!\300\355*\273\312\362\007\260\177{\221,\241\211\210\353\210bx\357u\226\036$A9#\226\027\337\330\255\274yA\203b\245\300\346X\2421f\004\377 d\323\362\260Ak\251\340\026\222\021\241P\273\253l\317\335IJK\326v\273\020\345\340\2622\223;j\367\332/%\302\240\224\330\257\201\253hR\232\254+I\252\250\300\214\020\360\344\226z\255\f;\365\265\237c\225U\231\364>5\2755\205\213\340B\2762p@7\315\215\344\007\321I\212G\302t\240#\211\266"
+	.string	"\345\260\360\270s\225mh\307\035\226\272\217\235\225\373\307\327^\031AF\204\342\244\226H\002[\232x\230\020\302b\260\345\202\003? P\"B\223\326\003.b"
+	.string	"\342\004\231\340]\001sr\320\021o\364\3210%\215\370\021SI\261\250\275\351\207\341\007\023?\262\301\2704y\025\2415\b\354;\007B\031\257\227\360\343\341\031\232 C\f\305\320\035\022F1w\205\301\020\032h\206C\370\211+ \361\201x,R\001\231\263w\036\212\001e\036\351\335\332X%W\265H&Q\276\267\222\336\007"
+	.string	"\347\202\372\326+\"A5,\253]\312\255S\257\001\177\217b\252\027\214\025\n\211\t\377"
+	.ascii	"\244\315F\212\367d;\n\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\"\001-\007"
+	.string	"\302\212 %\200)I\007&1\205b\016\336B\207\t\335\222& \020+D\246K\031\221\025\2005\f'\240}K\b\331D&\031<\342!n2(\332VeU\254\f\246\207O\356h\207o\270\346I\201\356\216\037\001\f\t\023\367q\026\037\247\234\356\356\2143\252"
+	.string	"\240]\t\257d\262\245vj\351\273Hj\301\240\304\n\by\020\020\344\200\240ej\345\021\215\326C\362\202\262\252\252U\027\370\232Rj\254\225\032\272\r\021;\020- \240\202\221\273z\021\001\204\260FA\353\336\360H\306\204\201F\311\366\306\006\313\210\n\031f\373\005a&\321eW\227@\203\370"
+	.ascii	"X\002b3\330\002drLb\210\006\357/e/\353:;h\260\324e\017\3466\266"
+	.ascii	"\265M\006\235eG\262\207\226\254\364\264X\"\030\314P,\250\225"
+	.ascii	"\312\025\tK\n<\004"
+	.text
+	.section	.gnu.lto_.pureconst.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\232\004\003\232\004\005\230\004\006\230\004\007\230\004\b\230"
+	.ascii	"\004\t\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 \271%\003"
+	.string	"\344\003\251"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\007"
+	.string	"\005\374\007\370\007\374\007"
+	.string	""
+	.string	""
+	.string	"\001\002\006\001"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\002\003"
+	.string	"\005"
+	.string	""
+	.string	""
+	.string	"0\006\200\f\007"
+	.string	"0\b\002\274\007\t"
+	.string	"\005"
+	.string	"\001\002\005\001"
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\003.C"
+	.string	"\017"
+	.ascii	"\006#\2000\005\264\310\331Q7\205c\234Y\320\np\243\365\264\024"
+	.ascii	"\004|\224\323\272\034;C9\253\007P\004"
+	.text
+	.section	.gnu.lto_.lto.6b0c64094b398554,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pow_negf.4.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`H\001=\016"
+	.string	"fZ`E\360\222(\035 \331o\272\216\313\324\302\3053\356\271\035\212\2622=\307\210\242by\323\3218\027|\005\360\212jb\352\205veT\002\326l\262\362\033X\274C\220\334e\272\303\242\247\306\\\002\373\3324!{\357-S\nM"
+	.string	"J"
+	.string	"M"
+	.string	"\237y\031\017`^\302\020G}\312\b\025\345s\272\324g\306\272\224-,V\035\3531\026\250\201\261!\244[\211\003:\214\270\321\351T\n\343\001\01634\204t*\361c\343\001\307[W\227\216E\0253\331]\353\252\313pc\267-\262\335\300>+W\317\307\374\361\336\257W\237\343\231\t\360\332}\371~l\215|Q\302\276\f\312\356\330\363\325\362d\224d\227\263\005\202\353S<\306.\203\354\306@\341bwGl \273\264\355\233\370\t\224\355\212\236\b\022%7-+x\354\256F\340\001\273\023;I\320\2570(a\3522\026hX2\252\302\bm\n\025\364\253\t\035\300\254\300\2247\035\177\311\201\341B\244\361\251\2414;l`\240\313\266\212(\024\251\270Qi\017\277\365\007/\033\253>l/\245\020\204}\370}\337g\370\301\276\032\013(\245\255\304\235L\3302\223,\b%P@\2621"
+	.string	"y\266SH\024=\002\215\"pZ\211#\221\270\221V\202\020\"i#\323I\003\t0w\262\2314\024\2163i\035o\037\037%\006=,q\302\267>2\243v\335\252\332M\0219t\261MR\240J\334\r\034"
+	.ascii	"{I1\232H\237`\332/\030>\013qc\346L<p\0204Q\224C \245\025n\003"
+	.ascii	"E\001\277KY\f\252\234\006\300e\202+\327@*D\202p 3\220\005Q\303"
+	.ascii	"\r\240\346\334\334'\340I\005_\352\f"
+	.text
+	.section	.gnu.lto_compute_precision_for_length.5.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\246\002\005\024"
+	.string	"v\245\202I\300\224Q:\254\250\362\376\007A\217\346o\3459\242\021\343\366b\257\273\037\320!\231\303\327D\233R3\242\"\332\321\377\027R\312y\037\324\256S=\243(E\232\215'\016fX\246\004%oa\257\310\254\211\f\265\325~\262\211\224)\005l"
+	.string	"i"
+	.string	"o"
+	.string	"\251\313\3332;e\207\271\326\365>\0362j\316\022<j\3149\017\230\300\351\322\266\017\3431d\366\017\334\241Ha\342\325\320\364\212\3149E\224\233\204\227\340\003\204\227{\342\262KpU\346\317.5\340"
+	.string	"\201\020D\f\271\341B|\301\0029:@\254p3\240\311\221\211 \327]mp5U\223\312\234\323z\303}\270\303\333\216`\373\201\255J\001\252d\357j\272<\366\301\271;\366\252Y\253^\255Zu\237\037\265j\323\252\303U\313\253\301U\357\325z\365\001\204=G'DsvXB2\215\344\215\025\376\317\203b\337\3713\016\264?B.\346\234)_\217\310\327\313\3654\220\235f\036\004\320\360j\220\346\234\006.C\241\326\352y\261\313\360\317\301Y\034\001\202ti\006\377\211\331\0019#\251\377\3754\356\007\305\260V\356\314/\n\272\004\242\003\375d\004\207\217\271\003w|\347\035\205\246JV_Nm$\035\221"
+	.ascii	"\245\356\372w\035\227\314\314I\033`\3070\350o\253E\341\2603\353"
+	.ascii	"\356j\317\206D\323%\353W7\034\262\345l\370\312\037\266\0275]"
+	.ascii	"\262\3127\342*n9F\273<.\271\207B\324\262\360v\314\350\021_\367"
+	.ascii	"\022\037N\217\0312\260\027l|\311\360:\275bVX@\247(XA\220 \345"
+	.ascii	"\265\240\305\242 3\001\366j\t\355j\271ZF\0216\272\270\214.\021"
+	.ascii	"Va\305Et\301\304\210\255\023\217//\030Qf\034a\304\324\216\366"
+	.ascii	"\335\361\211\264\270\001U{\335Q:\271\242]\255iml\233\326*\264"
+	.ascii	"\255\311pY\253\332\025b\313\201R\031\216\026\364\267\020\\\271"
+	.ascii	"\233\344\002j\301\225I>\357\327\3757\2665 \320\002\2211\353\r"
+	.ascii	"\221R\231\320\364n\220\301\254p\267\221q\035\375\226\213Q\317"
+	.ascii	"E(0\343\206/\037%\322\304\006\336\r\031\277\314`\266M\223\017"
+	.ascii	"\0064\324\243\305\325\315p\0055\224\027\301$\260\036\277]\035"
+	.ascii	"\212Rp\336\341\3400q\302\305C\022\300!eg\330L\370\325Ba\315\264"
+	.ascii	"\303JV\330\356\224\236\227\233\325W\033\300\316|\324A;p\t4B\205"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_adjust_latitude.6.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`j\002\335\023"
+	.string	"f\245\202H\320\360(\035\002\220G:j\024\355p\210r\004\335J\301\033\360\222\234hrZ\001\0039\311\013\316\013\022b\n\337\366\026A\325\020WJ\312\255\0070\310\325\272\002K\321\310\204})s\004\016t\221d\025VZI#{\313\235Rm"
+	.string	"e"
+	.string	"r"
+	.string	";Z\216\327\315\354\261\353\201\206\320\356\216\270"
+	.string	"\370i\333\3579\n\030\317\344\016D.e\263\211\341\345\330]\027\353!\337\247\274\200\357S?|\366oJ\2153\037u\"M\330"
+	.string	"\315\344h\3776|J\0037F5 9\234\fA\312I\222\267T\216BT\220\234M\262v\367?\2174\271[\214\250\223\335u\234\311a\270Q\267\335b\273\201\035;\004\366\216\026u\307\276\\\325\261W\347\335\252\373\374\037\327\375\340w\335=5Z\312h\225\321Q\243\017\362\341@\022\231\261k\341\311ic\314!\021\347\375\366\277\232\226\257\302\3579\365ih\331\274\031H\273"
+	.string	"\006\345\360\330\330\335\326\247\031\200\237\267a\354\224\375\311\264\342\356)`\356\023\341\001vu\234\204vw#^\260\003gJ\270#\2678\207 \234]\037\270\355\326\bDU\025\341\341F\330\342\223Q\361j\273@\210\237\211\312\272)\315\037z\225,bv\324\342\223\337\373+\364^\270\006T$3u\007d\"\261\024M\364Y*\250SiV|j\312O\215\242\251Ry2\f\035\375\347\037=\027\240\236\324\342\356\322Tw,a()\304~\366\201\232\362ct\213:\034{=266\005\261P\305E\345\005\223\265x\304`+\016`\017\302\027\350\022\005(\b\022\224\300LH"
+	.ascii	"\274\240\254\250_$\257\225\320\025\013YX\302\227+\246\202\302"
+	.ascii	"\342z\311\\\\$\003\034\266\300d\256\2270\224\271R\266\275\333"
+	.ascii	"\313U\035\220\251\304\322\\\251\245\234\372}j\202SS\333\215\357"
+	.ascii	"[\351uRWz%\334\315\204\233\350S\251T%\302\235P\365`\250\364\274"
+	.ascii	"\263j\261\311\252*\215\0010 \220\"\":\363c#0U\002[\"~\235k\315"
+	.ascii	"u\031\231q\t3\031\266\254\220\360kp\324\370\3011\214\275\020"
+	.ascii	"\314\"6\250mC\005q@\f)\246\007\201^\215f\351\3212D`\027G\370"
+	.ascii	"\273a\025\254\340\207\001\267\344\341\037\326\331\303\271$\210"
+	.ascii	"[\254\006\002\2246=\t~\304y\354\360\366\216\337EF\370H\256M\270"
+	.ascii	"\242du{\233\360\364"
+	.text
+	.section	.gnu.lto_encode_pairs.8.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\177\t\r5"
+	.ascii	"\312\\ \024G`\330R\007\277\331'\363\217L\2475\020\356\214\205"
+	.ascii	"\021>\0027\303\262x\355\215\370\337\240\244@\334\313=R7\237\r"
+	.ascii	"k\013iS\243\342\302\0256|\303\205'\030\370~\0237\003h\023\230"
+	.ascii	"b\304\255\336Jl\223\275w\222)\0054\001\032\001,\001\255\333\334"
+	.ascii	"\023\314\023\221e\373\222\366\270.z\333\236-\273\341\252<C\271"
+	.ascii	"\206Zd~I\257\267\336m\325\256\304\337\272\330\222]\223U\266+"
+	.ascii	"\1779S7\360Xv[K\274W\\\257\225\254\357/\347\274\364\266+\264"
+	.ascii	"_K\234\244J\311\204\025\313w;\321#\302\353m\353\\\342#\316f\345"
+	.ascii	"H\252tf2\026\033\330\003\352\3535^\250c\032\274\336\262}K\307"
+	.ascii	"\256\226\242\2079\217=\211\313\231*\324A\257\267\216\346E\254"
+	.ascii	":\311R\247]D2\274h\333\227\234\251L \277q\275e\275\306\365\366"
+	.ascii	"o\274\316R\275\213=|+G\036e\214E\342\314\360\025\272-\373\330"
+	.ascii	"\252\375\312\221o.!K\3071\314e\302\314\270h`\343\2147\037`\306"
+	.ascii	"\025\003\027e8\321\2352|\206\025f\265\340\341z\\S\326(\360o\316"
+	.ascii	"\343\262\360P\210d\303\013\314\337\001c^_.\004\3129\027\273\242"
+	.ascii	"\330u=\256/:(n=\316[2?-c^`\316\022\237{Z\306\274j\370\263\312"
+	.ascii	"0\274\027\307.,\366f\nY\237\2779\336\352zb,D\31297\326\352\362"
+	.ascii	"\362\246\361ng\320\335&\272_#\001U._\275\313\352j_Z\345:\234"
+	.ascii	"[\020\3638g\205\214\345\274\240w\253\0039\235\370\223\022\355"
+	.ascii	";Z\304\023v-o\333\237\\o\203\336\206\357\013W\233$]\277\272\003"
+	.ascii	"1'\016\323\270zg4\r\374c\215U9o\272\355vV9\232\307\351\216\366"
+	.ascii	"\023\256\2676S@'\036lcu\355\347\312\t\332\277\264\013\274\277"
+	.ascii	"\022[\024,\034\330\356U.\201\367\307o\320\260'\036l\177sb5M/"
+	.ascii	"\3430\335\324+\374\322n\357\272\034u:\372\313\272\217\214\212"
+	.ascii	"\210\024 \030\3629o\246\220\273\271+\235\352n\300\325\334\223"
+	.ascii	"A\236\304\275\200#q'\340\342\016\340p\336?n\365\366\351\341\331"
+	.ascii	"\321q\252w\216\253y\343<\356\033!n\233\307]\363\270\001\bq\323"
+	.ascii	"<\356\231\0277\362q\037\205\270e\\\334F\277z\027]\334\304\027"
+	.ascii	"\367\360q\277B\334B\027\267\353\342n[\334\254"
+	.string	"\213\373]\334\270\305\355\r\210L\246\374d\311\271\305\240\230,\245\235\353\341s\356p\356V\367\253\263\335\336\266-\333\345\332\351\272\030[\004\376\347!\340a\341@\030\321(8\357j9\357\324\235\367\253\017\306a\372\347\221\330\234s\036\276\264\335\007]\230\320\2558v}\317\235\316\207brP\332\242\327\371\255\356#\033\357:\327\347\217\236\035\003=3z\207\253r\177\336\350q\027\247\021\325\242\323HN\027\357\222C\323\306g\n\350\344s\345\317<n\033f\020;Z\201\364\033\3325\210\260\237\234\261A\301\302\201\3561\274|\355\271/M\272E\037\305\306g\264\376@*}y\025*H\231W\376Q\246\b\027Ye\020\275S\215\237\363D\304o\337\370\216\005j\366\264\202) \276\202\234'\376\347A\317\236V\030\303o\267\203\302T\264\2668\361\240\225\230OYzs\3062j\217\342R\230X\337\341m\203hr\233\\o\207/"
+	.ascii	"\307\334+\377}\247\002\r\262\363B\004\357W\007rz\322\335y\004"
+	.ascii	"\217\333\240a\317\301\241w5\367q~\350\035\352\243\375\177\367"
+	.ascii	"\035j\306~\373\036\025t\262\357X\242\202c\364\230\357s\016\364"
+	.ascii	"\317|\214%*\3708\377\357\3203\237\307\377yQAa\240^\246sW\021"
+	.ascii	"LTNI$\246\240\250\232K\035\246\232@4y(J5G<T\263i\212\312\251"
+	.ascii	")\305\024EdB\321$\365\201JI\370\201J\351CL\201\200brr\241\232"
+	.ascii	"N\337\013\212\222\022\020-`::\200\234Jr\372^:\260\344\324dB5"
+	.ascii	"\237\236\232KL\250\246\244'\346R\224\024\363\200N7G0E1\247\232"
+	.ascii	"\315(f\221\232\375\313zD\235\332\261\347\323\240\357L<@\200o"
+	.ascii	"$\347?\221/m\261:\0262n\305\2335\026\277\007["
+	.string	"\357\364\362\335\205\246\0219\005\264y\345\337\274C\203\364\274\315{[T\320i\255\353y\277\036_\332\347\355v\030\214\270\362k\334\n\005\271\032\027Y_d\330\"\317\027}\317\213\257\304\306\207\255k\306\227\262tvD\241ovf\347y\204\236ty\036B\036\026\016|\241E\204\347\375Z\034\322\2003\005\244y\345\003\340y\032\241<\347y\241\307m\256\302\212F\234\371\262\366!k,^\243\367\2624?\326\361\374\347\267<\316\211E\326X\274G\303\262\264%l\320\373\374V\263\257\316\373\233\277_\322\324Xg\342;\254\234\333Kd\340s~\313\351\374\005\\\363{\207\276Y6\3718\037\200\312\250A0\005\231BJ\221\210\210\204\221$Ic\200\002\221\2512z\021`\2754f\233d\230\003|\214*#O\203\303n\240\341\0137\332\2430}\267/\314q&H\013\"\023`\322k9\322\314\303\026\352\0333\334\027z\036\3468"
+	.string	"#\220W\001\266k3Iv\302w\0354s\204\322D\2771\275\300K@&\203I`V\316,"
+	.ascii	"y&\0274\233\276\264\263\233\342\001\310\035\t\322!\221\374\271"
+	.ascii	"\207pd\235@\222^\266\223\255\227\031\fUjN\317??\"\023\271p?\315"
+	.ascii	"v\300\342\224*'G\237\311q\271\3271O#\314\3453\256\254\351\330"
+	.ascii	"X\363\\\363\252;!\267\254\302\263$\345\n\233\343.\034\017\255"
+	.ascii	"m\244\003\020\353b\205\276\n\306\333\261\016\032k\037\254\242"
+	.ascii	"\347\346\254\021\371\220\332\331\325\\\332\301\"\371\311\263"
+	.ascii	"\336\032\tf\371\360`\001\277\361?\254\375\006\0258%\370EM\303"
+	.ascii	"?\334* \321\024\333\271V\030W\244C\220\237\221\013\276\270F\243"
+	.ascii	"\251\263\305\267P\336U-\272\324\2517\303\231\\\353\213\306\367"
+	.ascii	"\367\214\274\313J&\021\301g\374\337m\f\260\360P\023\307\353Z"
+	.ascii	"^\236\255\332;\017\034\032\272:\314\237\322*\004\007\251\246"
+	.ascii	"\202a\241P\233\212T9f0\251[\341\247\210\210\274\245\304\016s"
+	.ascii	"^g'\316\264\203\276a\325(\244\351\337\364cB:\243\005Fw\302\351"
+	.ascii	"+\316\321\217k\312\207\n:\351\252\217\211D\343P\"qA=\340\236"
+	.ascii	"\2308\263\257y\335\203\327\203l3\317!\324"
+	.text
+	.section	.gnu.lto_encode_grid.9.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\223\b\3550"
+	.string	"\nY\034\023Ep\330N\007c\260v\321\306\314\204\247H\021\021M\263S\201~\377\310\226\365\225j~\275\277\340\355\200\244\b\355g\023=g\254\322unp\370\037\224\225q\370\327\020\310pxaZ\210\357\205&<M\366\226[&\231R\"\001\r\001\033\001&\346\352\276\236Z8\326v)\355\315\256q\364\246\255\335t\\\236\217cC\260d\027\301\234\225\253\243\235\245:\352\335]\355K\227\363\271\256\271Ef\333\275%\235\202X-\342\266\206\214:\331\230\334[\333\240:z\313\326n\270-u\305\230\n\227\344\023\3149\257\216\366\205\037\263Z(\\\016 \3474=)\026"
+	.string	"\327\177;\201\307\206.\334\342\004)\370\255\266\211\267u\271\023. \235ll\013\213\240T\357\224_\036\250\216\376ru\353l*z\2303\232\234\224\234\225M\215\244:\352J|IW\267\335U\252\221\245_K\244\033\231\234\363\323\220\367`G\257\357`G_G\247\317\347\363\351W\351\235\332.\037\252)F\357\333\256\366\025>\234\363\nH\027\352\337XY\363\313\246Bf8\276\020\230\034\331\341N\267bd\307\373M\236\340\371\220\2612\213z\323\227\200\364\201\221\315\360K\363\2257\210\366\202\206\377]2\253\022\003\207\314x{\374p"
+	.ascii	"\372\234\33302/kS\t9\347\266`d/\274i\274\273\333\272;\254[u\020"
+	.ascii	"vi\204\301\237\223\307\265Y\n\361+\334\316\327\205v\205\243\346"
+	.ascii	"\243\375\004v\224G-L\321>\333fyc@\r\270\032\377\311.\360\376"
+	.ascii	"\034\332\372\214\266L\273sa\002\357o\345\216f^\366\331>\3474"
+	.ascii	"K\033\177\331\022v+W\330Ov{7\013\223n\375i\335P\376\346\356\324"
+	.ascii	"\304\264z\235\367\222\337y+y\236w\222\353y#\035\271\322\375\200"
+	.ascii	"\221\263\271\033(\"r(\356\005\334\211;\001\032\333\002\234\316"
+	.ascii	"[\310\341\274\203<\316\033\310\231\336?\256\364\366q6\357\236"
+	.ascii	"\267\315\243\332\336\031\332\016\360\266\001\250\266uP\3339\250"
+	.ascii	"m\034l\373\006\333\266\301\266k\260m\032l{\210m\253\330v\212"
+	.ascii	"m\343\3246\232\332\276\251\355\307\266-j\333\023\340\254\371"
+	.ascii	"1}\311\331\305\323L\266\2026\203x\235\373\235{\236\273\236;\235"
+	.ascii	";\234{\234;\323\325n\277?\326\366)\355v\216\347T\334\3315\027"
+	.ascii	"\210\036\240\033\221\344-\223\201)\234\334q\335\\\246\223\215"
+	.ascii	"n\205k\001]\244\256\373p\264\247\2500\025v4\300\027\330\321\324"
+	.ascii	"y\247\007\360\236\345H\344\347u\336\233\336\231>T\364\237oz\353"
+	.ascii	"\266\3648\237\363\367\314\321\354:\027Vz\234\277{\307!^4\230"
+	.ascii	"\336\2257\357\363L6?\374\033\233\031k\315\367\374\372~\\\243"
+	.ascii	"\371\364k\336\217Ch\336\003\221\205E\246\f8\030q\036uf\303$["
+	.ascii	"z\257\033\376\222\372>?Lz\365\251\364~\227\276\322[7\374=\237"
+	.ascii	"\276\037\223 =\376\267C\026\026\317\330(6\322\356\260\213\300"
+	.ascii	"\350g\265q\271\377\217\376\333!ch\361\244\277\177\003\221\315"
+	.ascii	"\366-\214\364\3776\020\331\354Kz\317\273A\237\344\374Cz\327\363"
+	.ascii	"!\324\333\016\003=\322\333\300c\022\247;\213%\225\277\322\245"
+	.ascii	"\t\034\372I.\354t\216\341\314\233~\213\240e\274\243w\345\201"
+	.ascii	"?z\227;6\275\246\030\275\263\371\320\033x\243\367c\223\350\355"
+	.ascii	"\273\034\262\220\016\31610!z\217\363\241\242\237\377m\265\373"
+	.ascii	"\350\017U\326\301\252\260\243D\317\263\245\314.\225\254\t\316"
+	.ascii	"\212\226\260\003%\252:DiIY\245%\252:\244[\304\254\267\"N}\225"
+	.ascii	"\217 \206x-\251\250\016UY\037\242\260\210V7T(\252Fx \301!\365"
+	.ascii	"@\202\303\203\320\372\200Ee\205\261\210V\337\f\026H!P\300\200"
+	.ascii	"\312\201S\216\226\224\325\367\224\323\224\025\361\t\213xuE\234"
+	.ascii	"z\302\252\222\272z\232\312\032\361\344\004\324\304\020TYOZDb"
+	.ascii	"\326S\2152\277\371U\213\316\234b\277\272\200\026\360\366\275"
+	.ascii	"\336\206\351\317\367E\177\276\3102o\374y\237\267\363e\270\262"
+	.ascii	"\311Q\013\263\363N\317\363~$R\364;\357n\310\302\"\323F\017\365"
+	.ascii	"\223=\324\303P\357M\037\246\355\261]\277\342Bf8\311\313%\372"
+	.ascii	"\240%\203b\030i\230\346\344\273D\0174<\033d\342&'\333]\375\207"
+	.ascii	"\r3\231\335\243\367\3710w\272\032f\020\b^\337\347\\\305\262'"
+	.ascii	"v\215\276\347\303\b\274\320O\250b\264e\304\240\365\274\263\371"
+	.ascii	"\274+\177\336\231@\357qA\326\022\266\320K(ZB\2779\347\234B\275"
+	.ascii	"\323\371P\025\027z\250w\317\261\304\013\360\355|\032l\02600E"
+	.ascii	"\373\334\340\200Qj\316\306\006\355\\<\200\264\250A,\345\230b"
+	.ascii	"\310\334\210H\220$I\322\030\260\002\221\261\"7\020`h\333t\r\270"
+	.ascii	"\333\273\240\375r\367\035\004\f\234\224\316\366R\3401=Y)\n\312"
+	.ascii	"\302\234\237\212\242\226*\032\261\347\227\244X(\241\034\213S"
+	.ascii	"\251\200\016\235\363\234J\345\006shZ\267\335\2023/\273\252\210"
+	.ascii	"\270.*\241\272\345:\262\030\274qf\351\030V6\345*\242Iy,\3611"
+	.ascii	"\2019?\276{\263\026\024\372%\340\301\245\257\2251\031\355\206"
+	.ascii	"S\272\024\301\360\313\312\355\3527\214\232\3650\f\361\341\341"
+	.ascii	"tXj \211\005\fk<.\221\346<'(zV\026\202U\351Fg\267\025\225z\225"
+	.ascii	"k\334{C\017=\303\023>\342\001\210\006\206!\367\217\nq\235G\224"
+	.ascii	"C1\250\213\256\303\212\003a\206\315\204\260\253\312M\rg\367K"
+	.ascii	"\204\210\257EG\210>x|\2059\365@f0f\344\336\317E8Y\303\206\021"
+	.ascii	"\215\305A\350\241\325.\036\320u)\221\356V%\306\311\366\370,\302"
+	.ascii	"\342\332\030\262H\325\254m\260\360 u\007K\204\306A4\3079A\361"
+	.ascii	"\310\301\360n-\035\215\261\210\r~\3438\340\204:'\336\312(qC\376"
+	.ascii	"\351\311\004\022\023A\354v\0078\207v\243-E\3661\312X\033\375"
+	.ascii	"Y\315<B\250\001"
+	.text
+	.section	.gnu.lto_olc_encode.10.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\203\t\3154"
+	.string	"*\\$\024F`^R\007s\307\025m\326\262\323\251\370K\353e\336\f::je\277}\307\270\310\346\305\374.H\211 wx\224\312\344\213\317h\0372 g\310\231\346\207\220\300\257`\276u\006\342\345\367\240\031I\333[\356\235dJ\0012\001\036\0012\001*\021\264h\332\335J\246\350\327\337\246\374i\245>s\227{\361\341%\355\316\327v-S\335?_\325nf\373\025\317\342n\375\273f\240-]#\373Q\227s&\321\006\213\213a\026\200\234E6\304,D\235bw\233\213\366\212\253mc#R\227\363\263\350kw\350\013\246x\255T\025\311\020-\376\032\325"
+	.string	""
+	.ascii	"9K\315\306\205*\305;\305\325\230N\245\312}r\026\303\213\346\374"
+	.ascii	"T\320\025\236\355}\362\fC\241\365\365&)\372u)V\335\3139,-\232"
+	.ascii	"sV\320H\255\257P<\215\331-U\237e]N\326"
+	.string	"C\253\312]\316Yi\350B\354\253\352?\330\327'S\333]}z\263\317t\340\317\327kY\034T\3772\333\331%7'\252\315a\235i\353\272r\340\017\377\251\b\352\264\304\361)\327\017Uh\003\311\226\273\371\270\276\242\260\033=\274\247\"\370\222\363\362)\027\017U8F\210\032\217\363\"%\\=n\273\303yY\337\231\016\307\255\016\017N\271\200\250\303;\243\013\353\252g^\376\016\347\304\2639\2653m]^~\331\245\234s\337\255\256\033\336<\336\335y\335]\243\273M\023h`\315\006\203\201\037\374$\251\023\016\326\315k\366\254\307\223\260\3139\246\303A\302\200\357s\356_\234\316W\034a9J\361\001X\363\322\351\013E\233\346K\247\373\211u\177\254\333o\316\371\252_\254\033\351\350w\373\300\357\266\001\242\321\357v\321\357\366\320\337\274\211\206\330\333\005\204|\267\t\334\333\002|\315=\310\255\270\013\275\315\033\210\275\375\343O\367"
+	.ascii	"\216\305\333\307\245\270\367\334\333A\247\342\016t\250\267\357"
+	.ascii	"o\367z\267\333\3666\373\267q{{mo\253\354\355go_\366\266'\340"
+	.ascii	"\2313f\002]\3166\362\352d1\353[\022\177sos\307\342\016u\265\333"
+	.ascii	"_\310\324\313\364\357\305\310T\251y\207\217\250\214$c\222<\337"
+	.ascii	"\310.C\016\033\022\317Z\305\016\343t\375{\032\305\356\271\252"
+	.ascii	"\341\225\232(U\353\353\353\220K\032f=s\027\236C\253{\262h\375"
+	.ascii	"K{\\\377\232)\345\321^\201\230}\245y\221j\357\202\343\024\273"
+	.ascii	"\275\213\224s"
+	.string	"\031\363\272k\023\255\303u\377z\312\243\355[X\034R'9\347\0373[\311\001Pz\323\366;\307\263*\301\304dg\313\215\220\211[a\377\342\036\300\204A\022\270\035O\031\234\346\315\3431\315^6\247.\332SY\342#\025\375\347\233\324\322\264\273\3617-m7\322\306\206\273\276\325p\330\327\237\007\242\331q#\316Ata \023\203\367&\177\001zo\373\007r4\216\364\377X\352\354\225\261\003\303\253c\363\321\376\030\232\024|\364\255\006\211\236\210\343\310\204\344\271\025&\276\2059-\034D\366\350\300\037\335+gN\f\374\001\342\033`\323\301\206\351\204-\007\376\261\366\340\213\265p\232\334y\243o\365\006x\242\237A5\346E.\273\025&z\013rYw\216{9\351L\211~\251\251\346\234\263jT\364F\357p\356\263&\270\004j%;\024\036~\321c\242\037~_\340Z\236\324\323,Y\2659\347\r8\216Ll\3657\247"
+	.string	"\\\263\363?\006\347\2765:\323\274\305{fM\314\360\336\004x\177\363\241\324\347\035\213\017\233\357\363W\252u\247y\363\372\217\340x\313\336R\354\177\037\3339\277xn\360{\276\373\210\342\372\226\277\024X\214\277\352\013\3352\r\276\233\253\001\016\226OG$\023~\300`\371tD2\341\006\313\024(\240\242\230\330e\362\230T\256xqdB\032\241\226PI("
+	.string	"R\312\025\2774\"\215jR\2114\252G\030PROSM\354\323T\323\247X\242H\036\2218\251D~K\210`t"
+	.ascii	"A\302q\302\202\236\245\021\371\355\264\300\t\251TJ*U\250P:)%"
+	.ascii	"\241\214*\224\234\242\244\224\026\fh\345\212c\224\322R\251\214"
+	.ascii	"R\372=\233\376b\275\224\363\365\033\372\023vl|B\357\373\031?"
+	.ascii	"\001\254\371X}\241x\355\032p\337\030H\r\3002#\355T\330\327\236"
+	.ascii	"28\355\007}\317\367\355\273\017*\307\367\016\005\016\025x\241"
+	.ascii	"\037z_3\340\256\217\237\345\340\341\372V\201W[x\025\016>\373"
+	.ascii	"\356\374\nz\374\356\\\242\276\360\327w\247\231\320\253\177\253"
+	.string	"@\3374\\\024'e\277\037k\237Wa\3407\251\315]h\033\241w\250\017\t\274\320{\026\255;W\370A/\340\201\336\347\273C\210\270\276E\340\335\3151x\345\035\177\325\276\340\013\370b\226<\337\030g\243\330\t#\343\270\tX\263\214\257m\302\334\374\203\235\030<7\276\037\243K\222\225\353\214\370*\001\200\312\250Q$(\221b\312\320\214H\222\024$\215\001\220\002\221\251\272\315\001\021p\271UD\232\2442\034\217\230+\371WC\203\373`\276\037\322\331\310\216\034X;H\020\205<\260\361\233\237x\327\260\330\022\254\"\303S\333\307E\347\r\336\300\003\022\367:\254\364\264\324\205\365\037\345\360\373\353\306|\321\021A\036\013w\332K\213w\307\375:\303\322\005\013U\320\0231\222dOa8\367\035\211\310:1\364\006_e\301\224\376\007\b\rz9\331\026O\276\263U\2605\017\033T\236\315\213\272\376<\003\2100[\223)\201\b"
+	.ascii	"@q\260\332@\261v\223\366\034\3149\221\203\225\201J\002\305yx"
+	.ascii	"\256@\245\317IZ\242\201\205\1775O\t\001I\213^%m\317\226\212\021"
+	.ascii	"1\2540\016\320 \323\023\344D<\201\347\021\216\270>\326\210#\344"
+	.ascii	"\006M\026\250\272\340P.\330a\262T\300\211\022\260\031\361\332"
+	.ascii	"\020Z7\213A5\360\2023\021f\343(\277\201\317\300|\274\001\f\302"
+	.ascii	"[\376=\252\315\263\253\375>\243\253N\\\207B\331\222\333\213Z"
+	.ascii	"`lR\261\207\210\317\366o\034\250\366\266\t>\275*3\253\b@\374"
+	.ascii	"\230!\372UG;\034\255\232dc\376\0134\230\226<q\b\322q4n5\323\254"
+	.ascii	"\314\345\022\260\0341\267\265\220T;\021\205\002\035\264\263\316"
+	.ascii	"x\236\320\n\230\220|\2765m8\345g\324\340X\261\251\341\343\363"
+	.ascii	"\231\314uH\310x\227Y\007K\262\317\317\332\343\006)y\201\346\017"
+	.text
+	.section	.gnu.lto_pow_negf.part.0.13.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\027\001=\f"
+	.string	"&\227O= O\225\016\200\370\024\002\003\311\037y\013"
+	.string	"\0044\214+\203v\243\017Y\203\351FY\260\376?6;`.\226\230`\"\323"
+	.string	"A\bY\nG\351\0045\325\226\367\t\231\026\355G\262\267\224)\005="
+	.string	"?"
+	.string	":"
+	.string	"\266\037\342\"<\333\005W\037P\026\026\025\276\027\273\233=F."
+	.string	"{\204\017\200=\252\207{\327\204\236\237\243\322\347\372\357\222\025*F\245\fO\310a\306ew\335\320p\307\333\256\330f`\377B\360\253_3\235o\375w\234\300\206]\f\257\030\313!\226"
+	.string	"a\377\363\330\017\377\363\354\207Y&Z,\024\026\317U\213\"a#\016d~u\225]v\354\236H\221\330]\004\217.\320x\264\237\362\220\034!\353\241\352\3116T\273\356\234\260\013\222D\275\013Q\212P\276T\325\206 !?\202\032\241\240\037_S\363\023\265"
+	.string	"\345\313\377n\240\303&\214\324\223\025\036\256\232\354Lc\231\216\231\016\035n\343:M\204\255a\312\002L\002\005\224\2552\001\260q0\r\240\265\211\366\240\313\270.\223\351\264\214s\200\311d\332\206\223M\006\270\323l\233\254\323u\233\354a;\017WM\376wHF\305\324\202mL}\001i\036"
+	.string	"\362\022\270\350\21213\006\277e\213\006\255\302\"\340=\200\302e\203\nk\345\311\254\356\301\004X"
+	.ascii	"\331\001f\300\n\310\0072\003$^\005\320S#\3021~\006#V3\300\025"
+	.ascii	"\234y\205\247\205GM\231y\376\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`f"
+	.string	"\r\007"
+	.string	"\262K+/pM\322\001\271@\377\266\244\321`y\330.\332\247\237\244\256\203\373\251v/\335\326\374\177KVUUUG*\036\307\330\b\331d\357\2757\221R\246W\330\344E60(\266-\302\345m\327cm\327%\365}\214X\026\333\307\304\255]\230\324\fJ\211D\272p\210 Qks\223\211i\310@$\265\331\221\371p\002-Nm\202K\333\260\377\002\002v9"
+	.string	"\245\377\372\240\206v\367\202"
+	.string	"?\001\254\024"
+	.string	"'\335\030c\254\260c\340twG\034)\224!)\023\036\216\233>O\373'\003G\323\364_\365{0\343\347\037\004\3465\025\032\013\306L\377\347A\024"
+	.ascii	"\256\241)\314X`$]\303aa\306\321P\2109\306\315\312a\311\313\f"
+	.ascii	"\004\b\336\263\006\260\367*\217\3000\033Xf\324\221`hO\2458\016"
+	.ascii	"E\017"
+	.text
+	.section	.gnu.lto_.refs.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375 0\201\001"
+	.string	","
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\n"
+	.string	""
+	.string	"\002 "
+	.string	""
+	.string	"\002/"
+	.string	"\002\003"
+	.string	"\004\n"
+	.string	""
+	.string	"\002\302"
+	.string	""
+	.string	"\004\t"
+	.string	"\n4"
+	.string	"\001\n7"
+	.string	"\001\004;"
+	.string	"\001\001="
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6b0c64094b398554,"e",@progbits
+	.string	"(\265/\375`\026\f\rC"
+	.ascii	":w4\032B@\344Q:\301\017\221!\305\307\b\320Ri*~\033\013 \024\024"
+	.ascii	"\200\025X&\267\220m7k7\344z\307\376\001\377\372\007\177\275z"
+	.ascii	"\217\177\312~\317R\272F\002'\227\006\322\377/\326\002\017\244"
+	.ascii	"d\302\266L\001T\001\223\001\250\001\230\355:\375\326"
+	.string	"\325\250\266\263\244&\212\234\026\314>\205\373\216j\177Qm\317i:]\375[\257\275\331\272\355K\3177_\333CC\3222f!\264\201\226\375\340\362P\352\277\265\255\326p\272\372=\035\347\357O@\333\327\233=\230\375\225\373\037\375=o\322\004\230\205\275\245a\366\235\3667Z\273i\353\215\234\2379\347\003Mhm\232r\230m,m\2405\320Om_\247\336m\236\332\250\330\233\177\356#;`d\230-\320O\355\273\332l\376N\323j\332\212\004%2\315i9\277N$\31081\204\331~\373\354m\3555\307Pu$\2465Ws\316m\245\232\346\334l\353\217/\347\346\257;Bw\004\366\314\230\027\265\226}\006\367o\033h\335~j\231\240\336h.\300\232\253\216]\275\366o\274\272\266\360\377OW\3507\205\277\243\272\351\357\tmW\360\343'\274\226\340\364\367\237\377\201\376\313\365\203v\360\237\300\377\t\377k\234\375\337\373\337"
+	.string	"#\351\301"
+	.string	"\360w\243\377\214\232\301\337\t\026\374m\367\267\202\277\177\177/\375\335\377\371\376\347\375\327\373\217\367\337\356\377\240\377q\377\341\376\333\371\337\366\037\306\377\025\377\343\374O\373\377\342\277\365\177\201\377{\376\273}}}}\177\363\375-\347_\362\020o<n\317\271^m\235\260\204F\266\307'g\347\215\024F\357o\211mo\214\022\314v#\250w\334\273\332q\355vb\004\236\352]\216f\no/.\333\007\252\361t\236\267\236j\353i\270\276\220\235sR\r\315;B\306\350e\261hT\303\375\030\252\242\2302\203"
+	.string	"w\210<1\303l\373\261\021\306\246\013f\273O\337\201\312n\222`\266\371\264\0347\216\t]\020\314\366\236f\203\333\274Z\006a\366\213Z\316\377%$?c\201\234\230\275\017\027\377mnFs\316G\222\336\274\346dj;\251\251\221Z\302\1776#\225\345\fv\247\250\325C\rS\204\331\377\020\362\377\203\310\231\005\364I\215:A\257M\246\323\220\227*\205^\251R\247\374Z\303\362\225J\316\320\347\224\211\233\371\315\322\001\371I\225\272\271y\007}s\324)\277\315hgj\024\232\326d:A\257T&\364:\225:A_\2524?3\323}Zs~N\245Nf/5C\257M\351"
+	.ascii	"\350u\312,r7&\307\311\317\263\f\023\372\314`\n\314\236\323(\034"
+	.ascii	"\364\235\366Z\316\3144\257\034\3557gj\316O\246\021\326\236]\230"
+	.ascii	"kN80%\261\347\313l&E\234c\323\245\327\231\341\240b\246Z^9\323"
+	.ascii	"\345\"T\314f\2769\347\257\354dv\316^o4g\347\364\206\330\264\345"
+	.ascii	"\276\242\271)?\233D\234cS&/\347\364+\213\231\322R\350ul:\305"
+	.ascii	"\206v-\313\316\227\331e\231\216\032u\257\3147C\0235\345\315\231"
+	.ascii	"\323\013cl\316\315\356\b\002\272#$\275qi\262i\331#\211\231\316"
+	.ascii	")\001\023\263\223\342\006\340L\0347Q\242\360\271uQ\276\310A\351"
+	.ascii	"<\2450M\263\276'\270\t\332\233\2363\250\377Xz\254D\212\233`-"
+	.ascii	"L\231i\315F\224\346\236\350\021\323\313P\261(\327\020X\242:\230"
+	.ascii	"\305M\216\231\200a\306\361\022\206\305\370\344\224!\304\347\036"
+	.ascii	"/\t\363\205\t\036\334h\002S\03741s0\213\221\034'i\213R\205\212"
+	.ascii	"w\344_RR\023\344\244\354\220{<\310m\rAQh<\004\203a#\177cs\332"
+	.ascii	"\210\265\264;\f\347\266\201\210`0\"\270\210\313\344\240\346\213"
+	.ascii	"\216\213\324%\305\211\351\242\306\346\036\247\271X\nvb'\016\322"
+	.ascii	"W\232\210\211E\271F\234G\370"
+	.string	"`\350q\22070\262|\206Y\374\325n-\234\232\2660\230\305^\355F\345P\036(f1\020\374L\343&\331=\372#\314\304eJp\234N\356p>f\266\033\006\"\367\005\004\263\335\327nK{N\316\234a.nKu\344\250\371\006dg\240 e{o>&\2654}x\336X%lh\372D\335'J\324ym\316\375N\215D\3334\212ZOQ\347u\216\346,\326\241J\350\216\321;\217\016;\205\216\311\025\314\366\242\323\371\3159\243\323r:=f\216\0315\314\036\177\271\357<\267\353\240\336xx\355\306\276YJ\003\215\020>z\210\\\244*!Bm\347\276\331\210\022\0208B\370\324\2755\365\0014\207\006\263\215\350\220\241B\r\310\355@P=\327=\250\332\203z.\t\312\3321\273\313\321$\024\002D\254\256e1\353\2104\032\205[I\344\361\311\210D\206\b&]KJi4\n\207ZK\341\026P\271,\342"
+	.ascii	"v\035\263,\360\350:\026\215\026\250\254\202VW<\200D\254.\343"
+	.ascii	"\360X\004&\225]@\340\220\310\245\204p\314\241$B\n\357@&\265\226"
+	.ascii	"\310\243R\016!\321\310\346\330\201\344b\261\210\255ry\024.\225"
+	.ascii	"G\3440(\340\202\024\026\321\005@\304\352Z\026\227Bcp\251\354"
+	.ascii	"\322\201%\374i-\263\216Dc0\211\314\021<\"\213\312\342\220\230"
+	.ascii	"\344\n\022\227]\\[\310!\003\367\202\3242)\344\222\312\221E<\006"
+	.ascii	"w \271~\301%\254b2+\300\222\210C\250\305e\024\272\2471C\206\213"
+	.ascii	"\026,T\2408a\242\204\210\rW\032\254\252\2502`0pD\026\227]F\244"
+	.ascii	"\222\230\f\032\205\305e\361X$p\004Gr\021\223\300%\022\231\004"
+	.ascii	"\006P&\213B\256 \021\0139<\022\231>,&\211Gb\226{*+\013VW<\224"
+	.ascii	"~\305\341\002\207\013\355\2578LMq\260\232ro5\205\324\305\264"
+	.ascii	"\fb%\221\310aphD\006X\006\211=\212\3126)\324\032\262\267\252"
+	.ascii	"\022b\240\262\"n\220\372}\303\006\021\020b\2540\341\016\245\206"
+	.ascii	"F$\360\210\334\332B\016\201\307\242p\0138L*\201R\007\272\330"
+	.ascii	"\341\274&l\n\027\270\2448\202\366\202la~y4\344\bf1\031\322\017"
+	.ascii	"\276\234\233\230\fc-8\3131\331\337\237\022\235\031\264\331\262"
+	.ascii	"Iu\252`,U\360\025\227\031\300\211&\211\225\343+aY\352\342\334"
+	.ascii	"^e{\343\b\263G:\343\3421\214\251\230\312\361\030\236r\fUgz\276"
+	.ascii	"8\200\340\250\2214\206\0304\301\314\214\210H\222$\351p\002\221"
+	.ascii	"\2412\253\003\021\200\245\204hf\202$\005)\265\031\234\"\252\362"
+	.ascii	"\202\021N\273\021\001\323\217\377s\355\215Ft\323)\251\376\245"
+	.ascii	"\276J\300S\022\310\251q\034\r\324=XF\372A&D\317^\272\263-_N\371"
+	.ascii	"W\211Lk\363\234\r:\242\301\003.\302}\374\251,!\343\025)\247\341"
+	.ascii	"\216\210\264TR\366`\031\351\003\346\244\303\016\fX\327\026\366"
+	.ascii	"s\205\022\306$\017\361\274\241\273\376\017\b\212\033\242\352"
+	.ascii	"\335:\252\375\357\r\275\336\270\205$\337%\322\272\316\017Nhl"
+	.ascii	"\3142c\362c\276.J\305\247O\306f\255G~\031\314{\250\276\307n\251"
+	.ascii	"6\310\220\344N\201<\215\224\252vR\273\200iA^Y\222\272>\266Hz"
+	.ascii	".\235\374\006\361\200\026\366\022\017\270\f\"\321\"\277L\352"
+	.ascii	"\314\212/V\035\247&}H<\037\262\322\021\005\311\214\333\r\016"
+	.ascii	"\004\241\306\242a\331B\031+\2100\345\366\263Gh\311\370BK\307"
+	.ascii	"\214\347J\356\234\333\212p;[3\244\013,\310\007\t\251H\321q\032"
+	.ascii	"t]\367\344\360\272\255\225\270_\362\334f\325t\016\005"
+	.string	"\356\303"
+	.ascii	"\344\036;\200\230\350\240\346bR\331\367+ypR\177\307i\301g\005"
+	.ascii	"\355\325\025\311\022\340\364\371\373\0043\303\342< bb\013\013"
+	.ascii	"\331\206\234\r\324z%\bTE\016F~b\226\264p\005\037R|\bv\024\343"
+	.ascii	":\266?\233\020\263\231F3m\341\3720\262N\261\264\226\026[L\237"
+	.ascii	"\210\234\030\034\354q,J\260 \352\001Y\363\023c\377_\312V\373"
+	.ascii	"V\316.\2261t\260#\3401\277\265\023\362\266^\216;a\303b\333\322"
+	.ascii	"\357\031\226\207\310\246E\016\355}\322\026\354\311\030\006\300"
+	.ascii	"\243,\252"
+	.text
+	.section	.gnu.lto_.symtab.6b0c64094b398554,"e",@progbits
+	.string	"olc_encode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6b0c64094b398554,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
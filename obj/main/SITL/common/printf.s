@@ -0,0 +1,12222 @@
+	.file	"printf.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.file 4 "<built-in>"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/common/printf.c"
+	.file 8 "./src/main/common/typeconversion.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	printf.c.2d0ce618
+	.weak	printf.c.2d0ce618
+printf.c.2d0ce618:
+	.long	0xa8f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1a
+	.long	.LASF1716
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1553
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1554
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1555
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1556
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1557
+	.uleb128 0x6
+	.long	.LASF1559
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1558
+	.uleb128 0x6
+	.long	.LASF1560
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1561
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1562
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1563
+	.uleb128 0xd
+	.long	0x85
+	.uleb128 0x6
+	.long	.LASF1564
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xd
+	.long	0x91
+	.uleb128 0x1d
+	.long	0x91
+	.uleb128 0x6
+	.long	.LASF1565
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1566
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x6
+	.long	.LASF1567
+	.byte	0x3
+	.byte	0x28
+	.byte	0x1b
+	.long	0xcb
+	.uleb128 0x1e
+	.long	.LASF1717
+	.long	0xd4
+	.uleb128 0x14
+	.long	0xe4
+	.long	0xe4
+	.uleb128 0x15
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1718
+	.byte	0x18
+	.byte	0x4
+	.byte	0
+	.long	0x119
+	.uleb128 0xf
+	.long	.LASF1568
+	.long	0x30
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1569
+	.long	0x30
+	.byte	0x4
+	.uleb128 0xf
+	.long	.LASF1570
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0xf
+	.long	.LASF1571
+	.long	0x7e
+	.byte	0x10
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1572
+	.byte	0x3
+	.byte	0x63
+	.byte	0x18
+	.long	0xbf
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1573
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1574
+	.uleb128 0x4
+	.long	0x138
+	.uleb128 0x20
+	.uleb128 0x16
+	.long	0x30
+	.byte	0x16
+	.long	0x228
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x16
+	.long	0x30
+	.byte	0x43
+	.long	0x2b6
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x14
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1637
+	.long	0x30
+	.byte	0x1a
+	.long	0x2d7
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1637
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x2b6
+	.uleb128 0x17
+	.long	.LASF1638
+	.long	0x30
+	.byte	0x20
+	.long	0x334
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1638
+	.byte	0x6
+	.byte	0x34
+	.byte	0x3
+	.long	0x2e3
+	.uleb128 0x12
+	.long	.LASF1655
+	.byte	0x10
+	.byte	0x37
+	.byte	0x10
+	.long	0x365
+	.uleb128 0x3
+	.long	.LASF1650
+	.byte	0x38
+	.byte	0x14
+	.long	0x365
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1651
+	.byte	0x39
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1652
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x340
+	.uleb128 0xd
+	.long	0x36a
+	.uleb128 0x6
+	.long	.LASF1653
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x10
+	.long	0x387
+	.uleb128 0x4
+	.long	0x38c
+	.uleb128 0xa
+	.long	0x39c
+	.uleb128 0x2
+	.long	0xa7
+	.uleb128 0x2
+	.long	0x7e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1654
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x10
+	.long	0x3a8
+	.uleb128 0x4
+	.long	0x3ad
+	.uleb128 0xa
+	.long	0x3c2
+	.uleb128 0x2
+	.long	0x365
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x7e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1656
+	.byte	0x60
+	.byte	0x3f
+	.byte	0x10
+	.long	0x49b
+	.uleb128 0x3
+	.long	.LASF1657
+	.byte	0x41
+	.byte	0x24
+	.long	0x549
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1658
+	.byte	0x43
+	.byte	0xd
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1659
+	.byte	0x44
+	.byte	0x10
+	.long	0x2d7
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1660
+	.byte	0x45
+	.byte	0x13
+	.long	0x334
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1661
+	.byte	0x47
+	.byte	0xe
+	.long	0xb3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x49
+	.byte	0xe
+	.long	0xb3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1663
+	.byte	0x4a
+	.byte	0xe
+	.long	0xb3
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x4b
+	.byte	0x17
+	.long	0x54e
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x4c
+	.byte	0x17
+	.long	0x54e
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1666
+	.byte	0x4d
+	.byte	0xe
+	.long	0xb3
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1667
+	.byte	0x4e
+	.byte	0xe
+	.long	0xb3
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1668
+	.byte	0x4f
+	.byte	0xe
+	.long	0xb3
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1669
+	.byte	0x50
+	.byte	0xe
+	.long	0xb3
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1670
+	.byte	0x52
+	.byte	0x1e
+	.long	0x37b
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x53
+	.byte	0xb
+	.long	0x7e
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1672
+	.byte	0x55
+	.byte	0x23
+	.long	0x39c
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1673
+	.byte	0x58
+	.byte	0xe
+	.long	0xb3
+	.byte	0x58
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1674
+	.byte	0x68
+	.byte	0x5b
+	.byte	0x8
+	.long	0x544
+	.uleb128 0x3
+	.long	.LASF1675
+	.byte	0x5c
+	.byte	0xc
+	.long	0x579
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x5e
+	.byte	0x10
+	.long	0x592
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x5f
+	.byte	0x10
+	.long	0x592
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1678
+	.byte	0x61
+	.byte	0xf
+	.long	0x5a6
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1679
+	.byte	0x64
+	.byte	0xc
+	.long	0x5bb
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1680
+	.byte	0x66
+	.byte	0xb
+	.long	0x5d6
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1681
+	.byte	0x68
+	.byte	0xc
+	.long	0x5eb
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1682
+	.byte	0x6a
+	.byte	0xc
+	.long	0x605
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1683
+	.byte	0x6c
+	.byte	0xb
+	.long	0x5d6
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1684
+	.byte	0x6e
+	.byte	0xb
+	.long	0x619
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1685
+	.byte	0x71
+	.byte	0xc
+	.long	0x629
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0x72
+	.byte	0xc
+	.long	0x629
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x75
+	.byte	0xc
+	.long	0x648
+	.byte	0x60
+	.byte	0
+	.uleb128 0xd
+	.long	0x49b
+	.uleb128 0x4
+	.long	0x544
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x6
+	.long	.LASF1688
+	.byte	0x6
+	.byte	0x59
+	.byte	0x3
+	.long	0x3c2
+	.uleb128 0xd
+	.long	0x553
+	.uleb128 0xa
+	.long	0x574
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x553
+	.uleb128 0x4
+	.long	0x564
+	.uleb128 0x10
+	.long	0xb3
+	.long	0x58d
+	.uleb128 0x2
+	.long	0x58d
+	.byte	0
+	.uleb128 0x4
+	.long	0x55f
+	.uleb128 0x4
+	.long	0x57e
+	.uleb128 0x10
+	.long	0x91
+	.long	0x5a6
+	.uleb128 0x2
+	.long	0x574
+	.byte	0
+	.uleb128 0x4
+	.long	0x597
+	.uleb128 0xa
+	.long	0x5bb
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0xb3
+	.byte	0
+	.uleb128 0x4
+	.long	0x5ab
+	.uleb128 0x10
+	.long	0x5cf
+	.long	0x5cf
+	.uleb128 0x2
+	.long	0x58d
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1689
+	.uleb128 0x4
+	.long	0x5c0
+	.uleb128 0xa
+	.long	0x5eb
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0x2d7
+	.byte	0
+	.uleb128 0x4
+	.long	0x5db
+	.uleb128 0xa
+	.long	0x605
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0x133
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x5f0
+	.uleb128 0x10
+	.long	0x5cf
+	.long	0x619
+	.uleb128 0x2
+	.long	0x574
+	.byte	0
+	.uleb128 0x4
+	.long	0x60a
+	.uleb128 0xa
+	.long	0x629
+	.uleb128 0x2
+	.long	0x574
+	.byte	0
+	.uleb128 0x4
+	.long	0x61e
+	.uleb128 0xa
+	.long	0x643
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0x643
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x376
+	.uleb128 0x4
+	.long	0x62e
+	.uleb128 0xb
+	.long	.LASF1691
+	.byte	0x35
+	.byte	0x16
+	.long	0x574
+	.uleb128 0x6
+	.long	.LASF1690
+	.byte	0x7
+	.byte	0x39
+	.byte	0x10
+	.long	0x664
+	.uleb128 0x4
+	.long	0x669
+	.uleb128 0xa
+	.long	0x679
+	.uleb128 0x2
+	.long	0x7e
+	.uleb128 0x2
+	.long	0x85
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1692
+	.byte	0x3a
+	.byte	0xe
+	.long	0x658
+	.uleb128 0xb
+	.long	.LASF1693
+	.byte	0x3b
+	.byte	0xe
+	.long	0x7e
+	.uleb128 0x11
+	.long	.LASF1675
+	.byte	0x6
+	.byte	0x78
+	.long	0x6a5
+	.uleb128 0x2
+	.long	0x574
+	.uleb128 0x2
+	.long	0x91
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1680
+	.byte	0x6
+	.byte	0x81
+	.byte	0x5
+	.long	0x5cf
+	.long	0x6bb
+	.uleb128 0x2
+	.long	0x58d
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1694
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x7
+	.long	0x80
+	.long	0x6d6
+	.uleb128 0x2
+	.long	0x6d6
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1695
+	.uleb128 0x21
+	.string	"i2a"
+	.byte	0x8
+	.byte	0x18
+	.byte	0x6
+	.long	0x6f4
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1696
+	.byte	0x8
+	.byte	0x16
+	.long	0x70a
+	.uleb128 0x2
+	.long	0x77
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1697
+	.byte	0x8
+	.byte	0x17
+	.long	0x72a
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1698
+	.byte	0x8
+	.byte	0x15
+	.long	0x74a
+	.uleb128 0x2
+	.long	0x37
+	.uleb128 0x2
+	.long	0x30
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x80
+	.byte	0
+	.uleb128 0x22
+	.string	"a2i"
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x6
+	.long	0x85
+	.long	0x76f
+	.uleb128 0x2
+	.long	0x85
+	.uleb128 0x2
+	.long	0x76f
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x774
+	.byte	0
+	.uleb128 0x4
+	.long	0x228
+	.uleb128 0x4
+	.long	0x64
+	.uleb128 0x23
+	.long	.LASF1709
+	.byte	0x7
+	.value	0x127
+	.byte	0x6
+	.long	0x793
+	.uleb128 0x19
+	.long	.LASF1699
+	.value	0x127
+	.byte	0x28
+	.long	0x574
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1719
+	.byte	0x7
+	.value	0x111
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1706
+	.byte	0x7
+	.value	0x10b
+	.byte	0xd
+	.long	0x7be
+	.uleb128 0xe
+	.string	"p"
+	.value	0x10b
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0xe
+	.string	"c"
+	.value	0x10b
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1700
+	.byte	0x7
+	.value	0x103
+	.byte	0x5
+	.long	0x64
+	.long	0x80a
+	.uleb128 0xe
+	.string	"s"
+	.value	0x103
+	.byte	0x19
+	.long	0x80
+	.uleb128 0x19
+	.long	.LASF1701
+	.value	0x103
+	.byte	0x20
+	.long	0x64
+	.uleb128 0xe
+	.string	"fmt"
+	.value	0x103
+	.byte	0x32
+	.long	0x228
+	.uleb128 0xe
+	.string	"va"
+	.value	0x103
+	.byte	0x3f
+	.long	0x80a
+	.uleb128 0x27
+	.long	.LASF1702
+	.byte	0x7
+	.value	0x105
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0xe4
+	.uleb128 0xc
+	.long	.LASF1703
+	.byte	0xfe
+	.long	0x64
+	.long	0x83c
+	.uleb128 0x5
+	.string	"s"
+	.byte	0xfe
+	.byte	0x18
+	.long	0x80
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0xfe
+	.byte	0x27
+	.long	0x228
+	.uleb128 0x5
+	.string	"va"
+	.byte	0xfe
+	.byte	0x34
+	.long	0x80a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1704
+	.byte	0xf4
+	.long	0x64
+	.long	0x880
+	.uleb128 0x5
+	.string	"s"
+	.byte	0xf4
+	.byte	0x18
+	.long	0x80
+	.uleb128 0x9
+	.long	.LASF1701
+	.byte	0xf4
+	.byte	0x1f
+	.long	0x64
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0xf4
+	.byte	0x31
+	.long	0x228
+	.uleb128 0x13
+	.uleb128 0x7
+	.string	"va"
+	.byte	0xf6
+	.byte	0xd
+	.long	0x119
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0xf9
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1705
+	.byte	0xea
+	.long	0x64
+	.long	0x8b9
+	.uleb128 0x5
+	.string	"s"
+	.byte	0xea
+	.byte	0x17
+	.long	0x80
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0xea
+	.byte	0x26
+	.long	0x228
+	.uleb128 0x13
+	.uleb128 0x7
+	.string	"va"
+	.byte	0xec
+	.byte	0xd
+	.long	0x119
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0xef
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1707
+	.byte	0x7
+	.byte	0xe5
+	.byte	0xd
+	.long	0x8d8
+	.uleb128 0x5
+	.string	"p"
+	.byte	0xe5
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x5
+	.string	"c"
+	.byte	0xe5
+	.byte	0x21
+	.long	0x85
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1708
+	.byte	0xdb
+	.long	0x64
+	.long	0x908
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0xdb
+	.byte	0x1c
+	.long	0x228
+	.uleb128 0x13
+	.uleb128 0x7
+	.string	"va"
+	.byte	0xdd
+	.byte	0xd
+	.long	0x119
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0xdf
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1710
+	.byte	0x7
+	.byte	0xd5
+	.byte	0x6
+	.long	0x92b
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0xd5
+	.byte	0x18
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF1712
+	.byte	0xd5
+	.byte	0x25
+	.long	0x664
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1713
+	.byte	0x6b
+	.long	0x64
+	.long	0x9cc
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0x6b
+	.byte	0x17
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF1701
+	.byte	0x6b
+	.byte	0x21
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF1712
+	.byte	0x6b
+	.byte	0x2e
+	.long	0x664
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0x6b
+	.byte	0x50
+	.long	0x228
+	.uleb128 0x5
+	.string	"va"
+	.byte	0x6b
+	.byte	0x5d
+	.long	0x80a
+	.uleb128 0x7
+	.string	"bf"
+	.byte	0x6d
+	.byte	0xa
+	.long	0x9cc
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0x6e
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x7
+	.string	"ch"
+	.byte	0x6f
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x7
+	.string	"end"
+	.byte	0x71
+	.byte	0x11
+	.long	0x133
+	.uleb128 0x2a
+	.long	.LASF1720
+	.byte	0x7
+	.byte	0xd1
+	.byte	0x1
+	.uleb128 0x2b
+	.uleb128 0x7
+	.string	"lz"
+	.byte	0x7a
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x7
+	.string	"pr"
+	.byte	0x7b
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x7
+	.string	"lng"
+	.byte	0x7d
+	.byte	0x12
+	.long	0x85
+	.uleb128 0x7
+	.string	"w"
+	.byte	0x7f
+	.byte	0x11
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x85
+	.long	0x9dc
+	.uleb128 0x15
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1714
+	.byte	0x65
+	.long	0x64
+	.long	0xa16
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0x65
+	.byte	0x16
+	.long	0x7e
+	.uleb128 0x9
+	.long	.LASF1712
+	.byte	0x65
+	.byte	0x22
+	.long	0x658
+	.uleb128 0x5
+	.string	"fmt"
+	.byte	0x65
+	.byte	0x34
+	.long	0x228
+	.uleb128 0x5
+	.string	"va"
+	.byte	0x65
+	.byte	0x41
+	.long	0x80a
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF1715
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xc
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF1711
+	.byte	0x3f
+	.byte	0x19
+	.long	0x7e
+	.uleb128 0x5
+	.string	"end"
+	.byte	0x3f
+	.byte	0x2b
+	.long	0x133
+	.uleb128 0x9
+	.long	.LASF1712
+	.byte	0x3f
+	.byte	0x36
+	.long	0x658
+	.uleb128 0x5
+	.string	"n"
+	.byte	0x3f
+	.byte	0x40
+	.long	0x64
+	.uleb128 0x5
+	.string	"z"
+	.byte	0x3f
+	.byte	0x48
+	.long	0x85
+	.uleb128 0x5
+	.string	"bf"
+	.byte	0x3f
+	.byte	0x51
+	.long	0x80
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0x41
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x7
+	.string	"fc"
+	.byte	0x42
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x7
+	.string	"pr"
+	.byte	0x43
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x7
+	.string	"ch"
+	.byte	0x48
+	.byte	0xa
+	.long	0x85
+	.uleb128 0x7
+	.string	"p"
+	.byte	0x49
+	.byte	0xb
+	.long	0x80
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0xa
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 26 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF754
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF790
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF832
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF833
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF834
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF835
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF711
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF836
+	.file 37 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF837
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF854
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF867
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF872
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF875
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF876
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF895
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF907
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF914
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF915
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF919
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x4
+	.file 57 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x39
+	.file 58 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 59 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 63 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x6
+	.file 64 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1137
+	.byte	0x4
+	.file 65 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 66 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 67 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/common/printf.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1528
+	.byte	0x4
+	.file 69 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x45
+	.file 70 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1552
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF698
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF710
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF731
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF748
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF749
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF752
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF782
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF811
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF753
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF843
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF849
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF853
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF871
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF888
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF913
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF711
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF918
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF752
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1089
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1091
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1108
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1139
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1147
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1159
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1551
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1721
+	.long	.LASF1722
+	.long	.LASF1723
+	.long	.LASF1724
+	.long	.LASF1725
+	.long	.LASF1726
+	.long	.LASF1727
+	.long	.LASF1728
+	.long	.LASF1729
+	.long	.LASF1730
+	.long	.LASF1731
+	.long	.LASF1732
+	.long	.LASF1733
+	.long	.LASF1734
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x47
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1735
+	.byte	0xa
+	.long	.LASF1736
+	.byte	0xa
+	.long	.LASF1737
+	.byte	0xe
+	.long	.LASF1738
+	.byte	0
+	.long	.LASF1739
+	.byte	0x4
+	.long	.LASF1740
+	.byte	0x4
+	.long	.LASF1741
+	.byte	0x2
+	.long	.LASF1742
+	.byte	0x2
+	.long	.LASF1743
+	.byte	0xd
+	.long	.LASF1744
+	.byte	0xe
+	.long	.LASF1745
+	.byte	0xe
+	.long	.LASF1745
+	.byte	0xd
+	.long	.LASF1746
+	.byte	0xa
+	.long	.LASF1747
+	.byte	0xd
+	.long	.LASF1748
+	.byte	0xd
+	.long	.LASF1749
+	.byte	0xa
+	.long	.LASF1750
+	.byte	0xa
+	.long	.LASF1751
+	.byte	0xc
+	.long	.LASF1752
+	.byte	0xa
+	.long	.LASF1753
+	.byte	0xb
+	.long	.LASF1754
+	.byte	0xb
+	.long	.LASF1755
+	.byte	0xa
+	.long	.LASF1756
+	.byte	0xa
+	.long	.LASF1757
+	.byte	0xa
+	.long	.LASF1758
+	.byte	0xa
+	.long	.LASF1759
+	.byte	0xd
+	.long	.LASF1760
+	.byte	0xe
+	.long	.LASF1761
+	.byte	0xa
+	.long	.LASF1762
+	.byte	0xa
+	.long	.LASF1763
+	.byte	0xa
+	.long	.LASF1764
+	.byte	0xa
+	.long	.LASF1735
+	.byte	0xc
+	.long	.LASF1765
+	.byte	0x9
+	.long	.LASF1766
+	.byte	0x9
+	.long	.LASF1767
+	.byte	0x9
+	.long	.LASF1768
+	.byte	0x9
+	.long	.LASF1769
+	.byte	0xd
+	.long	.LASF1769
+	.byte	0xa
+	.long	.LASF1770
+	.byte	0xa
+	.long	.LASF1771
+	.byte	0xa
+	.long	.LASF1772
+	.byte	0xa
+	.long	.LASF1773
+	.byte	0xc
+	.long	.LASF1773
+	.byte	0xa
+	.long	.LASF1774
+	.byte	0x9
+	.long	.LASF1775
+	.byte	0x9
+	.long	.LASF1776
+	.byte	0x9
+	.long	.LASF1777
+	.byte	0x9
+	.long	.LASF1778
+	.byte	0xa
+	.long	.LASF1779
+	.byte	0xa
+	.long	.LASF1780
+	.byte	0xa
+	.long	.LASF1781
+	.byte	0xa
+	.long	.LASF1782
+	.byte	0xa
+	.long	.LASF1783
+	.byte	0xa
+	.long	.LASF1784
+	.byte	0xd
+	.long	.LASF1785
+	.byte	0xa
+	.long	.LASF1786
+	.byte	0xa
+	.long	.LASF1787
+	.byte	0x8
+	.long	.LASF1788
+	.byte	0x7
+	.long	.LASF1789
+	.byte	0x6
+	.long	.LASF1790
+	.byte	0x7
+	.long	.LASF1791
+	.byte	0x7
+	.long	.LASF1792
+	.byte	0x1
+	.long	.LASF1793
+	.byte	0x2
+	.long	.LASF1794
+	.byte	0x4
+	.long	.LASF1795
+	.byte	0x4
+	.long	.LASF1796
+	.byte	0x4
+	.long	.LASF1797
+	.byte	0x4
+	.long	.LASF1798
+	.byte	0x2
+	.long	.LASF1740
+	.byte	0x5
+	.long	.LASF1799
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1519:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF812:
+	.string	"__ldiv_t_defined 1"
+.LASF1057:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF948:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1349:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1675:
+	.string	"serialWrite"
+.LASF924:
+	.string	"USE_RX_PPM "
+.LASF902:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1249:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF773:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1035:
+	.string	"USE_BARO "
+.LASF978:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1181:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF742:
+	.string	"_WCHAR_T_DEFINED "
+.LASF998:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF845:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1275:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1526:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1662:
+	.string	"rxBufferSize"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1600:
+	.string	"OWNER_RX"
+.LASF1042:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1293:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1681:
+	.string	"setMode"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF839:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF999:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1422:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF930:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF827:
+	.string	"__pid_t_defined "
+.LASF838:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1529:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1161:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1219:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF979:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1559:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1657:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1689:
+	.string	"_Bool"
+.LASF1043:
+	.string	"USE_UART8 "
+.LASF1368:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"uli2a"
+.LASF1079:
+	.string	"U_ID_2 2"
+.LASF1527:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1140:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1661:
+	.string	"baudRate"
+.LASF884:
+	.string	"NFDBITS __NFDBITS"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1144:
+	.string	"IOCFG_AF_OD 0"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1669:
+	.string	"txBufferTail"
+.LASF1639:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1052:
+	.string	"USE_USB_MSC"
+.LASF1238:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1446:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1392:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1096:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF705:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1151:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF734:
+	.string	"__WCHAR_T__ "
+.LASF754:
+	.string	"_STDLIB_H 1"
+.LASF1515:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"USE_SERIAL_RX "
+.LASF982:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1354:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1487:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1433:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1599:
+	.string	"OWNER_LED"
+.LASF1061:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1522:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1008:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1565:
+	.string	"uint16_t"
+.LASF1624:
+	.string	"RESOURCE_SPI_SCK"
+.LASF850:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF1581:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1570:
+	.string	"overflow_arg_area"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1010:
+	.string	"USE_CLI_BATCH "
+.LASF1541:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1421:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"WNOWAIT 0x01000000"
+.LASF1085:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1571:
+	.string	"reg_save_area"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1017:
+	.string	"_T_PTRDIFF_ "
+.LASF920:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1397:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1301:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1047:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF824:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1128:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF733:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1174:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF807:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1613:
+	.string	"RESOURCE_NONE"
+.LASF1260:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1379:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1514:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF970:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1182:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1147:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF725:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1717:
+	.string	"__builtin_va_list"
+.LASF1124:
+	.string	"BIT(x) (1 << (x))"
+.LASF1593:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1611:
+	.string	"OWNER_IRLOCK"
+.LASF1666:
+	.string	"rxBufferHead"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1190:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1341:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF867:
+	.string	"_SYS_SELECT_H 1"
+.LASF1549:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1622:
+	.string	"RESOURCE_I2C_SCL"
+.LASF879:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"USE_IMU_FAKE "
+.LASF1700:
+	.string	"tfp_vsnprintf"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1685:
+	.string	"beginWrite"
+.LASF1500:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF744:
+	.string	"___int_wchar_t_h "
+.LASF1604:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1697:
+	.string	"ui2a"
+.LASF1436:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1153:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1614:
+	.string	"RESOURCE_INPUT"
+.LASF1257:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1051:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF852:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF964:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF710:
+	.string	"__va_list__ "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1070:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1623:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1671:
+	.string	"rxCallbackData"
+.LASF1634:
+	.string	"MODE_RX"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1162:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1319:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1119:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1005:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1090:
+	.string	"FAST_CODE "
+.LASF971:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1720:
+	.string	"abort"
+.LASF1064:
+	.string	"USE_1WIRE_DS2482"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1655:
+	.string	"serialBufChunk_s"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF966:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF854:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1253:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1473:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF718:
+	.string	"_T_SIZE_ "
+.LASF1718:
+	.string	"__va_list_tag"
+.LASF1033:
+	.string	"USE_FAKE_GPS "
+.LASF863:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF871:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF967:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1416:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1489:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1592:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF771:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1612:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1543:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF729:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1479:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1635:
+	.string	"MODE_TX"
+.LASF795:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1531:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1545:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF992:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1360:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1398:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF931:
+	.string	"USE_ADC_AVERAGING "
+.LASF768:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1205:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1552:
+	.string	"FTOA_BUFFER_SIZE 13"
+.LASF787:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1150:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1439:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF726:
+	.string	"_SIZE_T_DECLARED "
+.LASF1002:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1594:
+	.string	"OWNER_OSD"
+.LASF1532:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1580:
+	.string	"OWNER_SERVO"
+.LASF1127:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1690:
+	.string	"putcf"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF820:
+	.string	"__ino_t_defined "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1075:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF735:
+	.string	"_WCHAR_T "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1691:
+	.string	"printfSerialPort"
+.LASF1180:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1265:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1513:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1214:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF842:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1183:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF917:
+	.string	"alloca"
+.LASF1221:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF875:
+	.string	"__timeval_defined 1"
+.LASF1023:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1535:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1188:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1560:
+	.string	"__uint16_t"
+.LASF810:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1579:
+	.string	"OWNER_MOTOR"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1272:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1081:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1156:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF745:
+	.string	"__INT_WCHAR_T_H "
+.LASF822:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1305:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1247:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1160:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF868:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1668:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF885:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1659:
+	.string	"mode"
+.LASF862:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1191:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1482:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF781:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1567:
+	.string	"__gnuc_va_list"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1104:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1576:
+	.string	"OWNER_PWMIO"
+.LASF806:
+	.string	"__f32x(x) x ##f32x"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF969:
+	.string	"USE_OLED_UG2864 "
+.LASF1308:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF986:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1009:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1113:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1347:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1707:
+	.string	"putcp"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1553:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1139:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1024:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1547:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF823:
+	.string	"__mode_t_defined "
+.LASF939:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF936:
+	.string	"USE_NAV "
+.LASF1388:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1334:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1091:
+	.string	"NOINLINE "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1695:
+	.string	"float"
+.LASF1658:
+	.string	"identifier"
+.LASF1703:
+	.string	"tfp_vsprintf"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1089:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1277:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1682:
+	.string	"writeBuf"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1709:
+	.string	"setPrintfSerialPort"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1142:
+	.string	"IOCFG_OUT_OD 0"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1016:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF847:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1229:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1099:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1686:
+	.string	"endWrite"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF947:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF825:
+	.string	"__uid_t_defined "
+.LASF1438:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF865:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF934:
+	.string	"USE_GPS "
+.LASF1152:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1603:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF915:
+	.string	"__have_pthread_attr_t 1"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF929:
+	.string	"USE_SERIALRX_FPORT "
+.LASF770:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1084:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1295:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1607:
+	.string	"OWNER_1WIRE"
+.LASF1076:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1322:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF832:
+	.string	"__clock_t_defined 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF741:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1300:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF997:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1586:
+	.string	"OWNER_RANGEFINDER"
+.LASF1485:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF878:
+	.string	"__NFDBITS"
+.LASF817:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1274:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1352:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1370:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1702:
+	.string	"written"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1184:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1687:
+	.string	"writeBufChunks"
+.LASF835:
+	.string	"__timer_t_defined 1"
+.LASF1074:
+	.string	"USE_ITCM_RAM"
+.LASF1236:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF796:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF743:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1679:
+	.string	"serialSetBaudRate"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF873:
+	.string	"____sigset_t_defined "
+.LASF1678:
+	.string	"serialRead"
+.LASF837:
+	.string	"_ENDIAN_H 1"
+.LASF1505:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1434:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF698:
+	.string	"_ANSI_STDARG_H_ "
+.LASF1337:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF993:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1627:
+	.string	"RESOURCE_SPI_CS"
+.LASF1670:
+	.string	"rxCallback"
+.LASF396:
+	.string	"false 0"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF1067:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1517:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1062:
+	.string	"USE_PITOT_ADC"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1572:
+	.string	"va_list"
+.LASF706:
+	.string	"_VA_LIST_ "
+.LASF973:
+	.string	"USE_DJI_HD_OSD "
+.LASF1476:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1664:
+	.string	"rxBuffer"
+.LASF798:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1663:
+	.string	"txBufferSize"
+.LASF1643:
+	.string	"SERIAL_PARITY_NO"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF919:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF955:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF906:
+	.string	"__ONCE_ALIGNMENT "
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1108:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF764:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF959:
+	.string	"USE_OPFLOW_MSP "
+.LASF1701:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF889:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF836:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1626:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1596:
+	.string	"OWNER_MPU"
+.LASF859:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1135:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1490:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1696:
+	.string	"li2a"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1325:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF708:
+	.string	"_VA_LIST_DEFINED "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF1708:
+	.string	"tfp_printf"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1606:
+	.string	"OWNER_TEMPERATURE"
+.LASF793:
+	.string	"__HAVE_FLOAT64 1"
+.LASF728:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1194:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF723:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1649:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF1597:
+	.string	"OWNER_INVERTER"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF848:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1638:
+	.string	"portOptions_t"
+.LASF1488:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1564:
+	.string	"uint8_t"
+.LASF1235:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1233:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF949:
+	.string	"USE_RX_UIB "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF907:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1359:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1511:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1068:
+	.string	"USE_ADC"
+.LASF821:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF746:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1616:
+	.string	"RESOURCE_IO"
+.LASF1406:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF775:
+	.string	"__WCOREFLAG 0x80"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1088:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1427:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1454:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"__need_size_t "
+.LASF701:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF954:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF908:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1232:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1365:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF833:
+	.string	"__clockid_t_defined 1"
+.LASF749:
+	.string	"_BSD_WCHAR_T_"
+.LASF1719:
+	.string	"printfSupportInit"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF789:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1053:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF721:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1069:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1154:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF732:
+	.string	"__need_size_t"
+.LASF1578:
+	.string	"OWNER_PPMINPUT"
+.LASF1026:
+	.string	"__need_ptrdiff_t"
+.LASF851:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF980:
+	.string	"USE_LOG "
+.LASF1098:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1256:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1013:
+	.string	"_STDDEF_H "
+.LASF1444:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1032:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1451:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1134:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1185:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1355:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1459:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1284:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1550:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF778:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1540:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1200:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF944:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF870:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1223:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF790:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1269:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF840:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1133:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF943:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1437:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1716:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF788:
+	.string	"__f128(x) x ##f128"
+.LASF891:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1463:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF846:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF700:
+	.string	"__GNUC_VA_LIST "
+.LASF1203:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1478:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF892:
+	.string	"__fsfilcnt_t_defined "
+.LASF755:
+	.string	"WNOHANG 1"
+.LASF1329:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1335:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1605:
+	.string	"OWNER_COMPASS"
+.LASF901:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1158:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1405:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1466:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1457:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1343:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1310:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1086:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1071:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1619:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1206:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1146:
+	.string	"IOCFG_IPU 0"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF757:
+	.string	"WSTOPPED 2"
+.LASF751:
+	.string	"NULL"
+.LASF1328:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1618:
+	.string	"RESOURCE_UART_TX"
+.LASF758:
+	.string	"WEXITED 4"
+.LASF1587:
+	.string	"OWNER_SYSTEM"
+.LASF1000:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1371:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__PMT"
+.LASF747:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1602:
+	.string	"OWNER_RX_SPI"
+.LASF1632:
+	.string	"RESOURCE_RX_CE"
+.LASF1589:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF945:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF905:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1109:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF767:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1502:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"OWNER_FREE"
+.LASF882:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1542:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1629:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1320:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF786:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1546:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1006:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF858:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1461:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1202:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1115:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1304:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF941:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1102:
+	.string	"UNIT_TESTED "
+.LASF1063:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1386:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1332:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF739:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF900:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1165:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1083:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF476:
+	.string	"__P(args) args"
+.LASF802:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1537:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1481:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF717:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1186:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1164:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF704:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1475:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF904:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1652:
+	.string	"serialBufChunk_t"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF926:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1248:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF877:
+	.string	"__suseconds_t_defined "
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF894:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF886:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1595:
+	.string	"OWNER_BARO"
+.LASF1179:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1448:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF869:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF753:
+	.string	"__need_NULL"
+.LASF1027:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1196:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF960:
+	.string	"USE_PITOT_MS4525 "
+.LASF1712:
+	.string	"putf"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1066:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1569:
+	.string	"fp_offset"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1711:
+	.string	"putp"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1177:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1568:
+	.string	"gp_offset"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1636:
+	.string	"MODE_RXTX"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1286:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1251:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF952:
+	.string	"USE_RANGEFINDER "
+.LASF1574:
+	.string	"long long unsigned int"
+.LASF1262:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1110:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1590:
+	.string	"OWNER_SDCARD"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1506:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1092:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1554:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1557:
+	.string	"signed char"
+.LASF803:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1254:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF714:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF765:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1217:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1503:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"USE_UART4 "
+.LASF1389:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF834:
+	.string	"__time_t_defined 1"
+.LASF861:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF853:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1640:
+	.string	"SERIAL_INVERTED"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1377:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1651:
+	.string	"count"
+.LASF953:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1412:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1331:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF914:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF805:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF722:
+	.string	"_BSD_SIZE_T_ "
+.LASF1230:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1430:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1054:
+	.string	"USE_DASHBOARD"
+.LASF1007:
+	.string	"USE_VTX_FFPV "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1163:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1326:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF763:
+	.string	"__WCLONE 0x80000000"
+.LASF1168:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF888:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF779:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1566:
+	.string	"uint32_t"
+.LASF794:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF977:
+	.string	"USE_ANTIGRAVITY "
+.LASF1409:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1082:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1583:
+	.string	"OWNER_SERIAL"
+.LASF1015:
+	.string	"_ANSI_STDDEF_H "
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF923:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1610:
+	.string	"OWNER_PINIO"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF963:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1211:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1470:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1137:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1029:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1172:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1209:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF928:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1246:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF831:
+	.string	"__key_t_defined "
+.LASF1187:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1130:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1673:
+	.string	"rxIrqCount"
+.LASF1316:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1533:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF856:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1373:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"serialPort"
+.LASF1646:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1065:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1178:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1296:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1376:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1534:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1617:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1220:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1676:
+	.string	"serialTotalRxWaiting"
+.LASF1551:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1159:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF984:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1452:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1562:
+	.string	"long int"
+.LASF1281:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1170:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF988:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1299:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1584:
+	.string	"OWNER_PINDEBUG"
+.LASF1226:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1072:
+	.string	"USE_RCDEVICE"
+.LASF1493:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF898:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1710:
+	.string	"init_printf"
+.LASF1020:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1123:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1019:
+	.string	"__PTRDIFF_T "
+.LASF876:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF816:
+	.string	"EXIT_SUCCESS 0"
+.LASF1694:
+	.string	"ftoa"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1358:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1633:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1120:
+	.string	"EXPAND_I(x) x"
+.LASF1302:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF987:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1393:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"_VA_LIST "
+.LASF1259:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1705:
+	.string	"tfp_sprintf"
+.LASF1654:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF720:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1467:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1667:
+	.string	"rxBufferTail"
+.LASF808:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1367:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1059:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1615:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF719:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF809:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF880:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1680:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF748:
+	.string	"__DEFINED_wchar_t "
+.LASF1036:
+	.string	"USE_UART1 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF811:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1116:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1012:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1103:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF874:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1548:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF736:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF983:
+	.string	"CMS_MENU_OSD "
+.LASF1242:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1291:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1683:
+	.string	"isConnected"
+.LASF1095:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF814:
+	.string	"RAND_MAX 2147483647"
+.LASF1317:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1585:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1425:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1455:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF893:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF938:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1401:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF932:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1460:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1004:
+	.string	"USE_VTX_CONTROL "
+.LASF1563:
+	.string	"char"
+.LASF899:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1298:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF759:
+	.string	"WCONTINUED 8"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1704:
+	.string	"tfp_snprintf"
+.LASF797:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1496:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1143:
+	.string	"IOCFG_AF_PP 0"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF716:
+	.string	"_SIZE_T "
+.LASF756:
+	.string	"WUNTRACED 2"
+.LASF702:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF864:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF990:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1456:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1107:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1210:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF994:
+	.string	"USE_RX_MSP "
+.LASF1361:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1112:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF956:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1001:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF724:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1518:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"USE_1WIRE_DS2482 "
+.LASF942:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF792:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF731:
+	.string	"__size_t "
+.LASF713:
+	.string	"__need_NULL "
+.LASF1609:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF957:
+	.string	"USE_OPFLOW "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF752:
+	.string	"NULL ((void *)0)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1118:
+	.string	"STR_HELPER(x) #x"
+.LASF913:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF927:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1263:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1100:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1424:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1031:
+	.string	"USE_FAKE_BARO "
+.LASF872:
+	.string	"__sigset_t_defined 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1241:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1362:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"RESOURCE_EXTI"
+.LASF750:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1216:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1018:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF826:
+	.string	"__off_t_defined "
+.LASF703:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF935:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF699:
+	.string	"__need___va_list"
+.LASF371:
+	.string	"__linux 1"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1404:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1350:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF800:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF989:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF828:
+	.string	"__id_t_defined "
+.LASF1049:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1283:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF911:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF772:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1499:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1445:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1642:
+	.string	"SERIAL_STOPBITS_2"
+.LASF762:
+	.string	"__WALL 0x40000000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF843:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF857:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF376:
+	.string	"unix 1"
+.LASF1227:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1538:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF896:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF774:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF940:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1415:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"USE_RANGEFINDER"
+.LASF1271:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF841:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1176:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1129:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1199:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF1715:
+	.string	"putchw"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF844:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1449:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF740:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1280:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF922:
+	.string	"I2C2_OVERCLOCK false"
+.LASF813:
+	.string	"__lldiv_t_defined 1"
+.LASF1544:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1155:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1212:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1087:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF903:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1645:
+	.string	"SERIAL_UNIDIR"
+.LASF1561:
+	.string	"__uint32_t"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF769:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1650:
+	.string	"data"
+.LASF1428:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1528:
+	.string	"__TFP_PRINTF__ "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1411:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1028:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1218:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1684:
+	.string	"isIdle"
+.LASF985:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1591:
+	.string	"OWNER_FLASH"
+.LASF1169:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1508:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF712:
+	.string	"__need_wchar_t "
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1407:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1353:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1111:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF968:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF890:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF761:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1665:
+	.string	"txBuffer"
+.LASF737:
+	.string	"_T_WCHAR "
+.LASF1122:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF730:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1419:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1132:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1014:
+	.string	"_STDDEF_H_ "
+.LASF1157:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1175:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1524:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1193:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1278:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1394:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1509:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1601:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF897:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF981:
+	.string	"USE_STATS "
+.LASF1034:
+	.string	"USE_MAG "
+.LASF1608:
+	.string	"OWNER_AIRSPEED"
+.LASF1311:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF849:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1413:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1197:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF804:
+	.string	"__f32(x) x ##f32"
+.LASF1021:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF738:
+	.string	"__WCHAR_T "
+.LASF1385:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF819:
+	.string	"__u_char_defined "
+.LASF1674:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1323:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF818:
+	.string	"_SYS_TYPES_H 1"
+.LASF1338:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF881:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1714:
+	.string	"tfp_format"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1637:
+	.string	"portMode_t"
+.LASF799:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1126:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1078:
+	.string	"U_ID_1 1"
+.LASF1077:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1148:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF784:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1472:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF921:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1410:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1131:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF791:
+	.string	"__HAVE_FLOAT16 0"
+.LASF951:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF783:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1653:
+	.string	"serialReceiveCallbackPtr"
+.LASF1121:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF976:
+	.string	"USE_D_BOOST "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF946:
+	.string	"USE_GYRO_KALMAN "
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1080:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1055:
+	.string	"USE_OLED_UG2864"
+.LASF1105:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1011:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1093:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1048:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1628:
+	.string	"RESOURCE_ADC_CH1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1630:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1631:
+	.string	"RESOURCE_ADC_CH4"
+.LASF995:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1356:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1647:
+	.string	"SERIAL_BIDIR_OD"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1314:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF782:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF709:
+	.string	"_VA_LIST_T_H "
+.LASF829:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF961:
+	.string	"USE_1WIRE "
+.LASF1706:
+	.string	"_putc"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF887:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1208:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1656:
+	.string	"serialPort_s"
+.LASF1688:
+	.string	"serialPort_t"
+.LASF1577:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF801:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1292:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF909:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1677:
+	.string	"serialTotalTxFree"
+.LASF1117:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1101:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1648:
+	.string	"SERIAL_BIDIR_PP"
+.LASF895:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF918:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1022:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1136:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1215:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF933:
+	.string	"USE_BLACKBOX "
+.LASF1512:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1166:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF855:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF937:
+	.string	"USE_TELEMETRY "
+.LASF1250:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1268:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1573:
+	.string	"long long int"
+.LASF1692:
+	.string	"stdout_putf"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1141:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1693:
+	.string	"stdout_putp"
+.LASF815:
+	.string	"EXIT_FAILURE 1"
+.LASF965:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF776:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1050:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1073:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1417:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF727:
+	.string	"__DEFINED_size_t "
+.LASF1173:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1171:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF916:
+	.string	"_ALLOCA_H 1"
+.LASF974:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1469:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1713:
+	.string	"tfp_nformat"
+.LASF1625:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1588:
+	.string	"OWNER_SPI"
+.LASF766:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1641:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1494:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1289:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1672:
+	.string	"rxFrameCallback"
+.LASF972:
+	.string	"USE_FRSKYOSD "
+.LASF1644:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1245:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1391:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1044:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF912:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF996:
+	.string	"USE_SERIALRX_SUMH "
+.LASF777:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1556:
+	.string	"long unsigned int"
+.LASF1149:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1598:
+	.string	"OWNER_LED_STRIP"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1037:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1525:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1400:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1346:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1038:
+	.string	"USE_UART3 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1396:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1097:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1167:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1114:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF715:
+	.string	"__SIZE_T__ "
+.LASF1539:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1003:
+	.string	"USE_RCDEVICE "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1224:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1060:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1530:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1555:
+	.string	"unsigned int"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF866:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1520:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1420:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1045:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1458:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF991:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1094:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1395:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1582:
+	.string	"OWNER_ADC"
+.LASF1558:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF950:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1287:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1497:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1040:
+	.string	"USE_UART5 "
+.LASF1443:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF883:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1620:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1056:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1106:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1660:
+	.string	"options"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF697:
+	.string	"_STDARG_H "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1484:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1025:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1536:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF780:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1364:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1145:
+	.string	"IOCFG_IPD 0"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1041:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1290:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1775:
+	.string	"__sigset_t.h"
+.LASF1782:
+	.string	"struct_mutex.h"
+.LASF1791:
+	.string	"common_post.h"
+.LASF1752:
+	.string	"long-double.h"
+.LASF1787:
+	.string	"platform.h"
+.LASF1789:
+	.string	"target.h"
+.LASF1779:
+	.string	"thread-shared-types.h"
+.LASF1746:
+	.string	"libc-header-start.h"
+.LASF1744:
+	.string	"stdbool.h"
+.LASF1732:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1769:
+	.string	"endian.h"
+.LASF1722:
+	.string	"src/main/common"
+.LASF1758:
+	.string	"stdint-intn.h"
+.LASF1731:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1734:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1753:
+	.string	"stubs.h"
+.LASF1726:
+	.string	"src/main/target/SITL"
+.LASF1781:
+	.string	"atomic_wide_counter.h"
+.LASF1765:
+	.string	"clock_t.h"
+.LASF1725:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1737:
+	.string	"stdarg.h"
+.LASF1730:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1798:
+	.string	"printf.h"
+.LASF1759:
+	.string	"stdlib.h"
+.LASF1748:
+	.string	"features-time64.h"
+.LASF1784:
+	.string	"alloca.h"
+.LASF1735:
+	.string	"types.h"
+.LASF1764:
+	.string	"floatn-common.h"
+.LASF1771:
+	.string	"byteswap.h"
+.LASF1763:
+	.string	"floatn.h"
+.LASF0:
+	.string	"./src/main/common/printf.c"
+.LASF1724:
+	.string	"src/main/drivers"
+.LASF1733:
+	.string	"/usr/include"
+.LASF1777:
+	.string	"struct_timespec.h"
+.LASF1767:
+	.string	"time_t.h"
+.LASF1721:
+	.string	"src/main/build"
+.LASF1774:
+	.string	"sigset_t.h"
+.LASF1741:
+	.string	"printf.c"
+.LASF1747:
+	.string	"features.h"
+.LASF1788:
+	.string	"common.h"
+.LASF1755:
+	.string	"typesizes.h"
+.LASF1778:
+	.string	"pthreadtypes.h"
+.LASF1761:
+	.string	"waitflags.h"
+.LASF1740:
+	.string	"serial.h"
+.LASF1766:
+	.string	"clockid_t.h"
+.LASF1723:
+	.string	"src/main/config"
+.LASF1750:
+	.string	"timesize.h"
+.LASF1756:
+	.string	"time64.h"
+.LASF1736:
+	.string	"stdint-uintn.h"
+.LASF1738:
+	.string	"<built-in>"
+.LASF1727:
+	.string	"src/main/target"
+.LASF1793:
+	.string	"utils.h"
+.LASF1768:
+	.string	"timer_t.h"
+.LASF1728:
+	.string	"src/main"
+.LASF1780:
+	.string	"pthreadtypes-arch.h"
+.LASF1762:
+	.string	"waitstatus.h"
+.LASF1739:
+	.string	"resource.h"
+.LASF1770:
+	.string	"endianness.h"
+.LASF1795:
+	.string	"io_types.h"
+.LASF1757:
+	.string	"wchar.h"
+.LASF1796:
+	.string	"io_def.h"
+.LASF1794:
+	.string	"io.h"
+.LASF1785:
+	.string	"stdlib-bsearch.h"
+.LASF1783:
+	.string	"struct_rwlock.h"
+.LASF1729:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1790:
+	.string	"sanity_check.h"
+.LASF1751:
+	.string	"cdefs.h"
+.LASF1773:
+	.string	"select.h"
+.LASF1745:
+	.string	"stdint.h"
+.LASF1792:
+	.string	"build_config.h"
+.LASF1760:
+	.string	"stddef.h"
+.LASF1754:
+	.string	"stubs-64.h"
+.LASF1749:
+	.string	"wordsize.h"
+.LASF1772:
+	.string	"uintn-identity.h"
+.LASF1797:
+	.string	"io_def_generated.h"
+.LASF1776:
+	.string	"struct_timeval.h"
+.LASF1799:
+	.string	"parameter_group.h"
+.LASF1742:
+	.string	"typeconversion.h"
+.LASF1743:
+	.string	"stdc-predef.h"
+.LASF1786:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`J"
+	.string	"E\006"
+	.string	"\344\b>\001"
+	.string	"\020"
+	.string	"\317\376\220\274\016\004\002"
+	.string	"\001\305\215\344\234\007\006\002\001\352\244\234\366\013\002\003\240\342\234\212\n\004\232\241\344\274\n2\002\003\002\003\002\004\002\004\002\005\002\005\004\006\002\006\005\337\266\370\356\t"
+	.string	"\006\226\343\346\371\005\004\002\007\002\007\002\b\002\b\007\b\t\305\374\320\221\001\b\002\t\002\t\n\262\205\322\254\005\n\t\002\t\013\335\360\214\220\t\b\f\254\325\263)\r\270\374\235\203\002\004"
+	.string	"\002"
+	.string	"\016\345\260\204\346\002\017\254\205\301\254\017\002\002\002\002\002"
+	.string	"\030"
+	.string	""
+	.string	"S\007\234\371\252\325>\210\325\017\300\322\316S&\004\237d\251\273*\254\347\n\313\200\3139`7_\200\007G=\f\265\340\345\005\255\334\300\005\350\f\013d\231\033\275"
+	.ascii	"C"
+	.text
+	.section	.gnu.lto_.ipa_sra.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375 \330\005\003"
+	.string	"\262\304\f\025\300%\035\377\377\3676\376\377\3777\2675\244\231\326\210${\247\024\256:\261\303d\004=\310z\216\025`a\331\273\265\262\276\216\226\336uk1\246-\215\201I\022"
+	.string	"@I\206\003\234\201\252\f\357\226`\201\214\017\201\020\017 E\006g"
+	.string	"\204\025s<\fE\fN\032.\001\007Y"
+	.string	"5\303"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\203\003u\017"
+	.string	"\006\225G:0O\224\306\201\310\305\346\271\230\".\361\223\320\251\347|\214\2470zFA\341\300}\017=\254e+vk\3771\fDP\220YK \341\002:\240\263YB\b\001\371\233l)e\n4"
+	.string	"4"
+	.string	"<"
+	.string	"\235N\036\301^w\236\224\334]\b\357\023\344\205\n\231\016\004\336\177%\342o%V\211T\242\373\001X\245\002\375\021\363\250d\340\336\210\311\020\036<\243\002\177\355\032\004[\352\277\357'\231\2118ZtE\236\356\224 \347\211\272\327O\034\307\2126F\001\236"
+	.string	"\037\264m\003,\362\021\2004\347\213\246\330l0a=E\236\016(\007\027\001\022$\204\217\347\036\035\322\332\206\343k\233\245\370\233\262-:\002\221\261`\35527\355$\251\231\220\001\224O\226\024\265 \341\251^\214\330\204\020\303\303\005\250+&A\021b\300@\021\230\323\002#E\037\216\265-\235\365\245\277C\2522km\373\354\3565U\212 %\354.\026\241p\304\213\236\320\224\020Q\371G\005\005\024\220,\243\"\375\260\206\203\335}\360\227\324\260\273\324\001_\250\341%c#TaI\n\323\032p\002\231!4\017\022\300\365H%\031R\210H\021QT\205\3327j\223\334?\321E\216\326{}q\355\003\207\235E)^\304\002x^"
+	.ascii	"\362\243\370\262\200e\n\310\344\316\277\\$\276;\306\314c1\022"
+	.ascii	"\220\013\210\360)\215\fg ?\352\354\351\203A\255\346\256N\324"
+	.ascii	"\256jX;\262\267\261\250\0210\237\214x:\273H\377D\227\t\255t\026"
+	.ascii	"3\226\227\t\177r\202\215\032\363\254Y\023\372\274\345H\244\353"
+	.ascii	"\352\223\275\324\376\0200po\207\257\301[J\372t\262;@\212\206"
+	.ascii	"5\244\020O\0012\236\224\237\004a\232\252\2554i\017r\320\006\360"
+	.ascii	"/\360f\321\364\033\020'\251#>\351\364\2346,\322\251*q&\223Bp"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\356\006\245\017"
+	.string	"\326\0226/pEI:|\350_\347\262\356\021\274\001\377\255\306\001"
+	.string	" pC\326\337\373\374\377\357_\303"
+	.string	"g\207;\353\216bk\266\265\222\337\354n\273\311\264\003)"
+	.string	"("
+	.string	"*"
+	.ascii	"\355\212\2767\372\344\035\356\017\313F\037S\330\230\302\376\270"
+	.ascii	"G\261\217\262\231\345\2355W\323i2\272@\315\247IP\031\r\262E\200"
+	.ascii	"\005X\213\252\252\252n \376a{\272K|\304\227K\360%\330-\373\024"
+	.ascii	"\3327\357\221\232L3j\343,*3gW\267\354\371K\363\316\313\203-o"
+	.ascii	"I\235\351\214\376\364\031f\034\016\205\351\315\351\233\001\300"
+	.ascii	"F\020\246\360\311=\3415\321\254\325\334M\271\006O\222t6\320\\"
+	.ascii	">2c,\275\001\302\327\367\271\342)vr\b>d\241\002],\317\210\331"
+	.ascii	"r\2725\247\177Y\267\230\336\017\2100|\250\301A\252\231\221\024"
+	.ascii	"\244P\030\346p\"!*4\007\022\300\221)\004\304yJ1\211\224\tD\002"
+	.ascii	"\241`d\302\004)).V\003\2404\351\252\005\302\233\227N7\242\322"
+	.ascii	"\374\001j3`\266U\2138XH\004\254\210Hp\234\356\243\237S\r\272"
+	.ascii	"!\367\313\226\303\244\305?c\nb\230\221\303\221\024h*\241\033"
+	.ascii	"\024p\201\367\004m\200\334\036\360\245\255\305Z\301J{k\273X2"
+	.ascii	"@\363\240lI\005\207\2100\204\307\024\372\361\327E\221\n*\205"
+	.ascii	"\016\341\304h\340\342f\033\304\207\351\215\013j%a\030Ld\245\205"
+	.ascii	"\304\007\004\004\224@\360\206\370\204\351Adh\230j&,\277#1\032"
+	.ascii	"!\"OO\0263\351\354\221\346\242\233\274Il\016G\3656.\200\263\251"
+	.ascii	"Mq\300\251\r\276d\327 \027e\027,\2112dV\370+\227$\250N\353J\021"
+	.ascii	"\3751Q\237\034]{\375\300O\277\215\211X\212;\304e\312\356cy\215"
+	.ascii	"\003Y\204;\256\351\335\200\017>G\002\275C\261_Xp\026%\b\312\351"
+	.ascii	"V/\033\2032"
+	.text
+	.section	.gnu.lto_.pureconst.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\231\004\001\232\004\002\230\004\004\272\004\005\230\004\006"
+	.ascii	"\230\004\t\270\004\n\232\004\013\232\004\f\230\004\r\232\004"
+	.ascii	"\016\230\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"\305\004"
+	.string	"\002\006\025 \240'\351\300\373\377\237;"
+	.string	"\246*,\200C\317\255\2724\375\205o\267\237\320\332\355lBZ\2232\005\023\016\t\303\021\250\304\374w\200y\"\200S \312\225_\247*Wm\341\321X0\326\311\031\235d)_\332\316\233\233rP\316G\330\262e\016[\243\323\350\231\002\034"
+	.string	"D#"
+	.ascii	"\354\305\341\003\354\256\260\241\016\253Ac\313\006\252KO\361"
+	.ascii	"\210\f1\354\304\343\t\226\300P{\234\217kv\246\024S\007.\003O"
+	.ascii	"hx+\254\217\032\304eU\247\r\273\304+6\002\273\006P\004"
+	.text
+	.section	.gnu.lto_.lto.a5e89a283652abca,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_putchw.29.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375``\n\2753"
+	.ascii	"\332V4\023F`\246N\007\301\350\275\305\241\362\017{\210>\243\332"
+	.ascii	"d\237\035\352t\211\326!k-\357\363\034\222\356\\\235sp\260\177"
+	.ascii	"'\354\323#f\243w>E\030\376\265\246;\220hc\346\255\364\177D\210"
+	.ascii	"\211\210\b\331{o\231dJ\001&\001\024\001\031\001\357\204\004\033"
+	.ascii	"\b=\330\373\326m\274<X\035\375Qc\375v\373\022g\262\345\314^\343"
+	.ascii	"\304\234m\030\221\313\231\331\324\004VG\233\271:\022O\262\325"
+	.ascii	"\355\304\314\034dOO\023O\346\344\234\331\243\003\245\216b\367"
+	.ascii	"I\035}\034C>\302V\237\317\347\3231\323{E\267\234hH(\b\250\370"
+	.ascii	"\343\323C\034\362\b\203\300\237\321\327[\325\024\305\177\267"
+	.ascii	"\332\237fhIA\306\345DFz\334"
+	.string	"\241\".\364\303\203~\370\270@E\274\210\t\330\215\031\301@ukj\334m\354\310\375\341A\343\372\250Pje;\274g\207\023\331|\310\226\343\362`\025l\205\217\247:xs2\256P\205\272Q\246\364\240Z\031\232\003\321f\334\237w)\335h7\246\003\037\335\306\220\\\337\217\314\304\355\341\177\203\242\305\355\306\316\260\003%E\330\334\351Hnc1\356\212t\243\314\314U\025\n\002\23137jef\236\276p\024\017\250[S#$\013\303E\345\227\026`\027\267\360\027\222y\341c\316\331\235~\305\310\276\356U\241r\316}S\220\225y\027y\367\215\320\335R\335\35321<\213\273\234+\200A|\237\363c\327\315\303\370\227\327\330\326\303\371\311\224\350?4\357\276n\235\276\255\013d\202\264\256\233\327\267ea\227o^7\223\353\376\262\333\027\330y\321\321o\243\233ujB2y\025\357%\245$w\342.\300\337\334\0038\323\035"
+	.string	"\322\361\310\341\334\215\274m\335\215E\217\342N\204\336&z\234\367\320\345\274y\204A\240\323y\377\034\316\333\327[\325\324[o\024\337\306\370\366\343\333\027\275\355\007\324\027uCPr^\361\264\223\307\240s?<\316\275\212\273\234;\235\343n\357\356\255v*n\305\2578\026w\366\357G\f\333M\327\316\225klm\327P\340e\270\233K\201\001\216\\\362\310%\006\344\302\035\266\273Jr\315@\324\266i\206\227s\266\260:\nt\202\355\216\313\362\0346\326\013#\023\003/g&\322\321\256\260\3768\331\024.kh\230\277\232l\023\342\020(\330\362(I\037f/2f\022\232,\276\336\266\023\017\363\327\332\t\271\234sSG(\302\006ts\352\340\321\t\223\336\351\n\370\357\223\376\232\tS\n[,A\365\336\007\360-\340\373\b\366\\M\374\373n\342\316O\313\244\331\224\251c\002\374e\007x"
+	.string	"\357j\315/_\267\216\212V\211\203\221\362v\347\367\313\366,\306\036\322\033\257\351\257<\317\241\211\306\210]\336\341\373e\247N&\315\033\\\357\227=\"\210\017\365\350A\004Q\246F?<\023d\211z\374\306)\372i\277\337h\336\265{\321\220\\y\264g\245\216\372\273\031\261\263\243\367\270\003>\374\243\3678aB\274\356\323[\264C\322\341{\034\3169\347\365\350\344\351\037\337\235aJ/\"/\005\315\306\026\365\227}\325\026\006u.\336\241m\t\366,\316\363b\356\364UM\033\033\264\350\033c\343\243/\326}\333!F\357q\316 -us\272\257mC\357\315k\236\207\352J\273\350\275\365\243\361\213\336\301\204\275\351\272\317\006\266h\236L]\316\033"
+	.ascii	"[\031AG\334h\240\277\354\373GO\246\035\332|\\\003\236L\211/\206"
+	.ascii	"t\343sh~\tUSZZ\036\260D\250QT\027\353\352v\210\272WN\305\341"
+	.ascii	"\226\360*\247\222\252\232\372~:\260`*\312\200\024\002\247\236"
+	.ascii	"+\255\344\025\356('*\255*\017XWl\225U\210\020VQl\225\207\r!\330"
+	.ascii	"(\254,\326\311\330VWSX\254\226\225\025\026\373cf\037\n~\343\237"
+	.ascii	"\342\013\205\337 \255\353\275|P\\\b\211\200\020\271#\204,~P\210"
+	.ascii	"\351\033\027\235\276\327\013\303\324{&9\275 \333R\311\332\020"
+	.ascii	"2\370\310\247\020\306ySt\304i\022D\347\2053M\027P\217\225\271"
+	.ascii	"\032E\354\003\374\"\2278?\277\354\245\021QAlb\037\330\205\250"
+	.ascii	"\364\215{\214\336\267\364X\315\273\245\367*N\341C\022(\307\322"
+	.ascii	"\337'J\357p\276W\372\273FE\030\027\273\374\336\372\336\341\200"
+	.ascii	"n\342\324\345\360\371e\227iS\372\220\336\302\337\263/\326\330"
+	.ascii	"\267\276\333\b\022F\350\344N/\326=M\300o\372\373\304\r\361\227"
+	.ascii	"\376\301\f\261\232_\200\255\227G\302\002\314\016\017\220!\312"
+	.ascii	"`\322K\265)\215H\377\r8\013\"}c\343\372\252\372\356\326\274C"
+	.ascii	"R\037\351/\225#\352\357=\200\342\250AH\003\231C3#\"\")H\222t"
+	.ascii	"\260\002\221!+n\021@\261S\320\211\244\331k\f\2778-\373o\031\300"
+	.ascii	"\321K\324\200+d\276c\241>\273\266\t\341\306\354P]b~\003$\264"
+	.ascii	"m\234\037z\336C$\251K\321\230\372\351\317\252\340\347\212\310"
+	.ascii	"\267D\030i3(\226>w\031\316\034\2412\255\221\265\037\310 .\302"
+	.ascii	"\323\016\235\246\271\032\243G\311\202\266\035\366\177\207b\256"
+	.ascii	"\232\256\247m[\257\n4\375c6\323`\244\305|\236\340%O\321\277 "
+	.ascii	"\254\003\376\307\370*\273\231\265\265=\214.8\020\317\337\001"
+	.ascii	"\344a\353\310\b\223\372\235\353B\246s\004T\254\214x\026\240\222"
+	.ascii	"36>oh#\256a\216\2220`\253\261\304\263\263B\330\214D\200\242\214"
+	.ascii	"\210rv\350\"\234\264\022\347\363Oy\354!\373m\355(\230\004\027"
+	.ascii	"\227\243\324|\262x}\nx\016\n:\373\301iE\234X\355\030\264H\262"
+	.ascii	"\257d\222\212\271L\362\320Ir\270#\026\035\327C\366\270\337p\213"
+	.ascii	"\033PI\332Xv\256\321\267\276\310:\032G0\343\232eP\005\241_\310"
+	.ascii	".\202\323\221k*\2107fb\235\200AY\235W\277q\376@\214\035I\031"
+	.ascii	"\336\036\310\001\236\207\033h\til\002\353\273\376S\210A\262\241"
+	.ascii	"\024\233`\206\265\201\204}4P\334\212\313\203P\n!k\177\f\252\276"
+	.ascii	"\372\253\300\224\035\353?\036>\\4!\202\3342-\270Gx| r.\327\324"
+	.ascii	"\"<\331ytr\257\263\247\313\276\253\005\303\222\230\203\230\241"
+	.ascii	"\262\t\301\205\301\306D^Zi%\255!\024\350nC\372\037"
+	.text
+	.section	.gnu.lto_tfp_format.30.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"\345\013"
+	.string	"\266\026R?\020U\223\016PKh6a"
+	.string	"\031\246\314\377Z\377\265\3406\001LV\004s$P\324]\206a\251\033\306$\202\210T\244XCN\240\252\024\205\"5\304\263\222 ,\223M\241\245\200\210\264\275\245L)<"
+	.string	"D"
+	.string	";"
+	.ascii	"\324\241;"
+	.string	"\312\266?\34348\273\307\353\\\210\276B\207\210\222\"\273\0333'P9|\277T\016\265\305\271'\347\377\344OF\212\224\220\b\364\234 \354\2563$2q\353m#\260m\301>\205\234m\2611$\342\313\237<\207\t\207\002\0016DiD\005\037\207\r\340\320\023\250C\314F\315\227\220t\b\"aH\314|\211\344\001%\002ux\001\022\237\277\341\327\270\r\356\235\205\\\300\356\350\305\216\335N\201\023\004\252\325S\355\f\237|h\322\351\304\242P\220-*6\215\330\035(\225\205\375\267:\262az\272\311\017O\362\277\223~}\367'5\305\370q\200\310n\211\224#\353\003\362\200a\373\366Q\002\232\rim\262O\006\203\246\241\266\213\243\234\007\f\034l\254\005\027\032T\003\262MC\366lU\234\315\323\321\262\350\301\256\013\263\242\247\243\271\242\245}be\300X\266\321\342\206aZ\264t{\035M\232\371\240 L%\324\247\001\024"
+	.string	";\3051\240\"34\256\343\310\261\202vM\034@6\304(\f\206a\344\020.\310\006\232"
+	.ascii	"\274\300\226\241\022Ac'\n\th\342II1]\223\f"
+	.text
+	.section	.gnu.lto_tfp_nformat.31.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`!\027\215d"
+	.ascii	"\212\243\020$O0\220\322\031\016o\005\337\316|_a0\252ZuF\027{"
+	.ascii	"X\222\363\241M\2117R\200*\372\325bJ\317\306$Qy@\206{\262\315"
+	.ascii	"%s_K9\224\252\304\307\335\037\036P\212\003"
+	.string	"E\301\353\340.u|\260/Vu4Q\323\004\r![\312$\003>\002\365\001/\002(\324\261\251\rf\260\002\335\3121\265\244+\230\214#\200h\200U\305\017\377.w;\334\275|n\221J\033\232/\\\316y\030z\024W\263\002\324\354\374\326\365\253G\236\2152\260\271\033\267r\305\253\257\342\226$w8\264\232&R8\377FU\\\315j\266\250\341\371\255\353\032\005\244\271\333\2666\250\253\020\351\032&\003*U\372pm\024?\334\031\322\374\331\367.l\337WV\241\0054\300u]I|\270\022(\371\232C\336sa\303\340J\215\342[\3305~\2701\3004\325-V?9\253\226\332\222\267u}cZ\005\334\232\315\202\006w\006\260\320d~\226\225[\343\272\216qy[\327\225i\007(~\250<k\236w\217\345i\316K\267\206\353\254\253\222'o\353*e\332\244\342\207+-\336\312\321\234\273r\252t\t\330\223\324=\265"
+	.string	"2\317C\374P\375\016\361\3036a\231\330\371&\246%\245$\022HG#\214\212D\204 b\202\3700$\024\004\344\341\307\247\207g\271\243\324\311\301I\336\330 \217\306b\rq\2506;\367*\314u\201]\275I\355,ksGL\316\350}\335\251"
+	.string	"\\\251\302d\213\231\270\302\354\276\244t\366%\251\356$X"
+	.ascii	"\322\035\351\310\003(Gn\037\341\326\306FM?\264\263\242'_\320"
+	.ascii	"\316DL\037b\312\306Dqed\320\002\231 Z\370\2074,<\304N\336\320"
+	.ascii	"\316\204\202\320\016dE\005\366\220w\025\f\231\024-p,\254\356"
+	.ascii	"?>U\336\363\244\214y\356\276t\342\302\0270g\\\256t!#\022\245"
+	.ascii	"\f\351\362\261/\272\343N\223+\233\234\300:5.\306\302\216<\347"
+	.ascii	"XL\216sDeF\371Z\302I5\311\017.\207\353}1Qy@(\353\202\362\215"
+	.ascii	"\221\333\030)\302H\"?^\357\213H\336\211\242|\221\300\306\032"
+	.ascii	"\027s'\032\013\013\363\"\321X\230\220\327\\\357K\210\312\\\327"
+	.ascii	"\025\t\366d\242\312\243\3675DM\202\206\t\202\004\343\342\241"
+	.ascii	"\n\350\027\264\300\2610\273\253G\260 o\025\b\032&H\022LK5\022"
+	.ascii	"\223\304\314\347\316^`Y\3145.\326u]\356\002\013\3736\277\333"
+	.ascii	"O\273\353\334]\246\b<K\310\366V\304\017c4k\361\"a\330\337\362"
+	.ascii	"w\375\361w\210M=l\036\344\232\302\006F\367%\031\034\260\n\353"
+	.ascii	"\004\365\326\275\337.\271\226\346T\304\343\335\001\261\347\375"
+	.ascii	"@\326\320(\221\326\355\031;\252\325\217;s\351N}\255f>.hr\355"
+	.ascii	"Lq\207\273_\364N\320\313\334\352\253\205\321\335\337\345\232"
+	.ascii	"\335\217\310I\211R\323\321}\321-\372cjw\311\265:N;!\006>\242"
+	.ascii	"\321\251\2100zJm\006\2335:\275\036CC\026.\303\216.\263\363k\003"
+	.ascii	"\261\315\256@\033\201n\321^\273\313+f\201\177-\372m\037~\005"
+	.ascii	"\232a\261\240\252r\277h\004\232\310\3075\305\331\334\347\202"
+	.ascii	"fq\341\036\320o\017vOB,.<\320\022B\270\356\350*\375\200\016\272"
+	.ascii	"\372\033\203\247\305:lM\034\257\245)\235\020\303b\301\255A\323"
+	.ascii	"[Zy\013\374[YpWz\305\035\335\375R[\bf\333Jv\267\264\276\376`"
+	.ascii	"^\037VU\314K%\305\2749\242\230\027\312\006\363>\235\205\177\202"
+	.ascii	"\263\375\020\324\2401CF\f\030J^\004.\375_<\313\177\200\222\267"
+	.ascii	"\305\353\276,n\367]q\274\257\212\024(N\374\355k\302\251\204\312"
+	.ascii	"\333Ty\233\230\227\211y\227tx\225rx\223pxI<\356\213\304"
+	.string	"\274GI\336\021\314kD\344-b^\021\314\033\202y\211\220\274L\346\005q\303\373\341\310;\304\274B7\274A\314\013\304\274\036\230\367\307\206\327\347\310\333\303\274<\314\273D\362\356\034y\225\217\373\352\250\2749*/\016\363&\231\367\206ym\214\274H#\357Q\3455\252\274E\225\267F\345\0352o\027y\271\310\373?\207\310\240E\222\204i\031\244+\b\205;\254yj\334\223\323\375u\277\335\217\367\277\375q?\f\257\331\375\016\222\346\376\313\036\314\303\374\356y\213\334\031\303\323\301\007\231\035\025\363*g\315\032#h\266A`6\236\332\251mt\327\300\005-*.\233\247'\350\026\375\342\314i\205\337\365\324\352:\244\257x\332(DE/[\325\362$,\374!j@\036\341;\275\353L\023\200E\370\236\200\235A\237\2419\003l\314\240d\353\272\276K\351\307#\021\225\275\373\"\001~\327>\272\307\200\270\207A\204\240w\225M"
+	.ascii	"\007\\}\265Bli\212Ef(\354\271^\017\033\032 ?\303\243\35685\222"
+	.ascii	"\234\272\256c\001\234\356F\277,\\\270*\227\265\307v\311\206\007"
+	.ascii	"\370$\233]\336\025\017\346\234\311\021.\247\310\225)\357t\276"
+	.ascii	"w\026\tl1y\272)k\364\252:(:\005\207m_\017\340\251\210 ,\177\241"
+	.ascii	"i\"\365`\371\203\033\236\344u\260\334\325W\205\f\327\3623\206"
+	.ascii	"3i\326\262\326\036\331\033\257\313W\333W\034S&6\270'\334>\356"
+	.ascii	"\373\362e"
+	.string	"\350$\357\t Z\225U,p\317\267}\305b\214\365\004?\264*iv\267O\310\017Zd]\257\016\335\335>\356Z\327\024\255\256E\230\260.\005\213~\335N\004r5(\250\221\203\32398^\224\035\335*^\312ph\364\2527'\032E{\255\231S\021Q\300\241\350\277\351$\373t\347\301\256\277\233N\366\271\376\260\350~\323Be\204\364\260\235\005\2059\351\313\351(NG\367Q\324fX\262\245@\203\371\303\027s0\373\302\361+G\274\230\2571P\354\262\351\335\006\034\340w\321h\346\263\257\366D\3334\243y\022RQ\241\244\316.IhS\206\374\336U\264\327\363n4\203\353\263\231\321\253\"M\364\t)\"\322\356\355R\304c#O\364\261[\312\t\025}\274\033\274#3t\314h\3463:\275\330\306>\327\224oy\261\207\312\024\3012b\323\321\275\031\034\226\343i\370\227\244a1~\357+\332\353fpeG\031\315"
+	.ascii	"\2271F\233h\257\022\247\"\232`#b\202Yp"
+	.string	"W\264\013,\244\335k\210a\261\215 \243F\325\003>2\232\371j\272\246\333\216kJ\026\233\b+\322(ir\354\350\251\2101\312$\331B\210\321\177;\003bX28\305\036\b\033\344\340)\036l\201\216\034m\365(\033\254\003\252\252\n\307\224U\315\0057\270\002\035P]5\265\303\306\323\360)\003\276\001\305\203\212i\301\324S\261J*\252\243\2406\300A\245.\013'\025P7JT`\242I\311\243\n\003\036\352\336h\212\252\322\201c\212GS\307\016)\251\0357\232:p<I5oLQ5\233\202v\007\017\250\251f\325\216\035SM\344\356\256tE\341LN\275\352\022\251\277\325^[\335B\f\253\263\266\007\f\277_\22669\275\325\205\253h\276\002\375\256x\020\205\246\216\026\220\344\356\351\246*}\325%\235vj/\030c\017\360\300h\326\322l\352fS\373\224)\2025\367\003y\316\351\375\352\252T\242?\367\004\262"
+	.ascii	"\237n\305k\265N{\265\027(f\342\226:\272\200\t$<\335\222\244z"
+	.ascii	"U\022N\235|z=\335\216\276\366\367\360\356\212\242:\271\245\303"
+	.ascii	"\323M\204U'\243f\236n\314\037=\244{\256\tU5N4\355\351"
+	.ascii	"\366c\243K\350\224\350\307\005yn\231QjKA*G;\265\324R3\345`Zj"
+	.ascii	"\243\242\327\344=\245$\316hR+\365r\337\222\032\211\344O\312\326"
+	.ascii	"\333\240$\345\360u\3613oh\"H\242\207\037\340\237S/#q\222\255"
+	.ascii	"\334\225@\311x\t\324\211\t$\372~c\332\2140\007O\266\021Aj\033"
+	.ascii	"\262\256\313\266\021\364\216\276r\304\266\020F\264\201\351\360"
+	.ascii	"\344\264\320(/\360/\n\252\235:\252\273\313\210V\372\021\324\221"
+	.ascii	"\223\tqD\377Om9\025d\257'\247\201Ei\254\254\272\265pA\263\224"
+	.ascii	"\340\211\005\376\2110*j\243\346\032\236\"\272\250\213\262\304"
+	.ascii	"D\364\216\230\2771=\3233!\356\360^\370\344\324\216h9\255\373"
+	.ascii	"\341\243\235\372Gw\027\242\016\341#\004Q7\337rJ\307\004\321\\"
+	.ascii	"\302\231C\230\037\032\304\2079\020d\204:\347H\304\241\241\240"
+	.ascii	"\026\372\340StP\377\031\227\005\367!\312r\232\366\035\236\234"
+	.ascii	"\236\rQ\251\242j\247\256\362\320@T@\036\246R\204\222\030\207"
+	.ascii	"\037'\316'[\373\302\317\024J\320\221\037\224\314G\212\223\n\277"
+	.ascii	"\253\247}ZH\215o\215\203\274\247q\220\374\215\231\022\001\232"
+	.ascii	"\016a\254'\247\"x\350\231\006\201\367\250aD\006\231B3\"\"\222"
+	.ascii	"$Ia\030\003\261\005\304\030\345\234+z\021\3200\250\2403#%)H:"
+	.ascii	"`\241'\221b!Y\320\362\322\3156\202\302&?\241\346\251\035@\301"
+	.ascii	"h\357 \003Hq\374\223\262.(->d\305\244\332\rE\376\212\361#7\003"
+	.ascii	"\246d%\357\237\013\243B\375\311\037\352\366\254\236\247\265G"
+	.ascii	"\243\342\347L,\f\334\331{W\231E\322\261*\371.\300\341\242\200"
+	.ascii	"\321\024\255+]\3539\001\323\330Hk\213\207\212'PU\016p\327;\363"
+	.ascii	"\335\351\335\374\357S\nZV/~JJ\235.+\013\237+|\354\212\016K/\270"
+	.ascii	",\205ne\245}\201X \332\031\2659\267\004\0022\362\272b\0033\030"
+	.ascii	"x\250\306\251=|N\307o\340$T\rcT\201w%NA-\016c\232\216F\b-bD&"
+	.ascii	"\322\034\371\364B\235xP\036\334\360\265\021\250\371.\344i=wP"
+	.ascii	"\021^ \027\323\341\214\256\334_Wp\272]i+\265\231=L9\224)\215"
+	.ascii	"aBU\222]\247\037d\343qG*\370U\353\032\n\330\262\325@C.\241\341"
+	.ascii	"\b\251\242\341b\246\212\304\006RW9\315\376d\t\312rn\216>\251"
+	.ascii	"LE\223\226\230Dr\232\221\017\336\024IJd\276\232\247\351\3340"
+	.ascii	"*\303V\377\216\211.\2072&.HWc\217\232r\234\230\351DI\247\242"
+	.ascii	"\222F\n/0\245\242\300M\215\033)\362G%3JF\237>\361^\201\337Y\305"
+	.ascii	"\bxG\325\367\013\364!\354\\\026d\320\r*\220\222\376\201<:\375"
+	.ascii	"\325\363\022\354?/\301\356\371\023\354\236\267\204\240\002\263"
+	.ascii	"\364.73\366o$N\274\004\232\267\b\bP\222\026\324kW\264\263\"C"
+	.ascii	"\031\265I\031|\270=\356q\366B'M`>\031\004a\216\255\013\347\213"
+	.ascii	"\213\205{-\004\334P\n\343t`-\271n}\013\034\247\347w\312!\363"
+	.ascii	"\320L\313\314\270\334fRc\245\026Y\374\242\033\2327\312C3\235"
+	.ascii	"\313\2130?"
+	.string	"Ec\333I\t\\yb}j\234\357\200\324\031 \200u\rL6yRF\252\2261\337\243l\207\376\271\260\231\377\001T\275v\244\017c\372\351&\026\2063\354.\204\347\315x\324\271\201z\341}v\253\231\262\330\273\322\363\r&\257\340k\215b\013\340q\230L>\247\312cr\342\322\236F5 \337\247,\262 (\321$UR9]v5j\341\350\254\311\236=\023dh\351\303g@Uz\331\231Jr\335\312\030\254\f\002\227\377*9\340mzAQ7D\244Ia\250\303\207\245U\342\2755\357\244\344\213\r\226\204\213\0213U\261\031\233T\223\266\314N2X\324\nw\214\\P$\213;\231\314\340\337t\215#\f\310\240Z\"\025\317\330)v\265b\244h\364\347v\362e\361\020\t\024\367U\312\216q\024!CN\226E\357\"d\201.#\235\245\301|8\356\221d\016V;\021lH\204:r\300{\2303\326\204\031'"
+	.string	"\360\312\223\373\tRa\250;\034\372\212'\303\f\231\007\375XzM\272n\326\247\237\200\f20x\362\r\0205\030\222:\233\211[\213\273X~\002\200P\307\3333\b"
+	.ascii	"?\242B\034(`\006\211\377(bs\037\246\231\244bU\367\220G7\251\306"
+	.ascii	"\344\210\217N\364\3504\0248\270\333@'[\247\326\rJ\035\216w\205"
+	.ascii	"\225#wevA7A\002\241\257\230>\n\211\357 \201^\373)/\263\306\001"
+	.ascii	"\252\001"
+	.text
+	.section	.gnu.lto_init_printf.32.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"\035\n"
+	.string	"vSG> \005)\035"
+	.string	",\304\0048\345\f\360\223\200\361\234\347\340\317e\006\210\246\323\302V\203\326.U\266\261p\003F\"\225\344<\375\007\200"
+	.string	"\246\001\361H\310\210m\004\001m\375y8\377A6\331;\2452"
+	.string	"7"
+	.string	"3"
+	.string	"\247\036\217\300\235z~\300\235Z\264u>\226\354e'\0350\003v\267N\222\213\227\242\377\330\tZ\256\325\345\300\304\356Z\266\\\037\367\274m\005\333\025\366C\001\277\344\n"
+	.string	"\334H\b\330\365\250\025\330\031\255A\261}\373-\242\375\261A\"U\312\307\306\r\031\n\317)\b\244^\236\305W\371\212x\230i7\330}\245\320\354\216\f^\360\004\323\217\271\314\264\f\024jGN\337\345/)\337\304\032*\371\326\251\257\342NC9!,Y\263\234\261\301YI\300\036Wr\216\330\337vw=_\366a\377\3661\2440\365m\216p\200\030u\r\030\017\"\320\027\246\276\315\235\210\024\236J\340WO\236\311\344u\365T\2720\325\016DUQ\202\275o\004\326\320\363\300\372\031\367\333\316\227-\002\314X\223\303[\016"
+	.ascii	"\006Td\342a\320hq\001@h \023\300wK\265\362.x\017\225\r4!D!\004"
+	.ascii	"\327\334B\230O"
+	.text
+	.section	.gnu.lto_tfp_printf.33.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\363\003U\032"
+	.string	"\366n\245I\240\230Q:\b\200\341C\370\243;\032\213\204.\336\211M\"Q\212\253xbXc\0042B\270\2462\337\027\304\232\335\313\350\370\313/w\320\324\323\322\263'\201\215/\243\023\320[Y&\323\343\267M\241J\361\352\246\375d\357-S\n\215"
+	.string	"\216"
+	.string	"\217"
+	.ascii	"uh\254:\007>\250\026\024Z\247\257\221\271\022o\344\246\027\320"
+	.ascii	"X{\013|T?\233SKh\311L\021\277\366\177\034H\356\243\317ej\255"
+	.ascii	"\361\013\326:\"\360\201\326\251\307\326}\377\345\354\2469\336"
+	.ascii	"\350\275\310\207b\bU\255\025\366:Mx:/ <\225E\226\233\373\244"
+	.ascii	"rs~\217\337\023\257"
+	.string	"\247\373\214\331\341\342t\262\202X\344p\365\200\346\215U\324\022L/h\345\217>y\374\224x=\027_V\204Z\253\227\327\023\272\303\333\226\331\016aO\003\001\353\331Z\313\271^\326\3720\005p\020\305(\372I*ce\261\345j\007\205.\3518\360\267\357\027\271\223\355r\317\211\370G\256\364$o\262\221qE\364\253\265\272\230\200;*\304p\317t%\300\235P\310_\262]N\275!8S\305\357\203\243\317\222$$<YD\272OB\302\363\027\030\234\213\360\223\242N#\276%6\247\002\254\210s\217\324s#\276R3V\241\0171\240~T\247\266\360\"=\266\353\364v\316\017\362#\273d\244\204|H\356\300\0233\216\251JQ%\365\"o\304\024LB\372\323\f\232\365i\311K\361+}'\016\035\366\274\027\311zQ\207\244\316w\372\004\242(M\327\340#X\205\345\001\324\231Z\362\301\313'\255<\322_\273;\371\023_\361"
+	.string	"\002Dx\272\322\305g\362&<>\016\213\210\355y\261\360\364\222\246\312\320n\267xf*\nfm~\"?\232\025X\301\263I\344\354y~\005I\235c\246\240f\246\202URu\265\330\343\317J\033\366onXEY\326\260\001\254_>\376-\227\262\231m\347E\342\026k\341\330p<\266\031+\261:3\034.\347f\202\345\033\005\ff\262\004#\026\210\001p4\034i\231\210\203\323\311\271\331`:5\032\255&\203\351\344\304h0\331m\007&\016p\3156\273\301p\265\332\r\346\032w\177\221\rf\354\344\217O\314Zi@8\360\2172\332-^%\030Q\246\264\341_\036=\005\365\250i\341\224\267 V\200\326\312\004VJ{\002\205=oJ_\312\247\324*\\\270\020\236J\tS\245\001\215\272Z>k\255Uz\246\252E\315b\310"
+	.ascii	"$u\001S\250Q4L\024a\b\311\310\210\310\004i\2321\240\002\0311"
+	.ascii	"+\017\020H\310h\222\024\206\003B\230\nP0\342\313\363\234\311"
+	.ascii	";\330\3351\264\004\347\032\346\026\306(\fr\355\333\232{>\313"
+	.ascii	"\214\013$[\340\210#4z\200\240o\302\272\006B/j\326^L\367\366\215"
+	.ascii	"_\2017\327\262\326dw\356(V3\"g<\316\264*U\345\017\215\035\254"
+	.ascii	"H\025\003\2412\277\3017\320\t\321j\343\017E} \303\302\350\337"
+	.ascii	"\200M\311aGz=\330e\321\372\210\344\001u\212\217\210\373>\254"
+	.ascii	"\263\267P\033\206`\021'\323\233$X\342$;A\313w\002e\013=\037s"
+	.ascii	"\310\324\351\037"
+	.text
+	.section	.gnu.lto_putcp.34.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\005\013"
+	.string	"VUND\020\253*\035\300\355\2575\257J\3632\001\007\356\352\302\001\315\"\216\341\353q\362\336\302DH\232\311\215\255\2551\325\006\331p\20152\021."
+	.string	"\200\002 \334:\204K\021Y\265\203\"8\230\006\231*\222F\b\3312\2457"
+	.string	"<"
+	.string	":"
+	.string	"\264\335\262\343\213\357\235\313Kx\357\276Gx\357L\332\025^\306l\006\326"
+	.string	"e\226aw\301\t;y%\375\313\356\320r\251\256\231\320\356Z[\256\225{\336v\205\355\220}\213\352\177\017\002\"p`\330U\271m\330Z\007!\200\355\333O@\332\032{\343\2003\3652\2032\310\227)\317]\027\006\264\335\355\330\343{\267\231q\256G\340\033\370\001\3621S\370f\367U \023Z\346\264\275e\341\363O\235z\341\204"
+	.string	"Ko\366\025\224\240>"
+	.string	">\211\367\356\263#\205e\2457\353\203\027\t\253\032\354R\245\023\306>\267\273\353\371\262_\376\336c?\307\251\225\013\341\275\361\321\020\205\030! \017\204\351\016=\"\247\322h4\201%\221D\022C\2604\002!\201\3418\002z&,\232D#x\022\305\021\324\224{n\347\353c@m5Y\366\246\277\300$\2456\224\367\216\"\r"
+	.ascii	"{\2412\023/\303h\b\350\005^s\201\320\030Q\322\206:g\251\335\257"
+	.ascii	"\306b\206\313 p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_tfp_sprintf.35.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`S\001}\016"
+	.string	"\026\332`F"
+	.string	"\2216\035`\f\362=\314\236\016\342\036R\304\251\273\367_"
+	.string	"t\202\201\242\f\004\3465\032\225\273\304\005\226m\324\004j\206\020\243\247\032\357?\370k\275\327\277\013\316\020\352\222g6\033m\246\206\345U\376\206\214\032\331;\245G"
+	.string	"R"
+	.string	"J"
+	.string	"(\337vW\\h\354V\006^\240\035s\325l\373-\376\"\3323Wm9\235\345\006\b\231\326\356v\237\033\310\216]/\220\035\243,\027?E\377\254_,bf\220\247\361\223Caw=\311S\211\233\336\266\002\333\027\354\333\b?\005\200\202j\351\230\200c\227\304M\017\023\rV\303\345\252\177%\3722g\271\263\245xq\030\342W'\327\236\250;J\200\241Q\261\240\035\373\201m\005w\225g>)uO 0\255\227\217c\256\240m&\270\231\342 #D;\266\215\340>\355\307\334\205\370\032\243\024\233\020\031\275\352\"(\323,\035`r-\027\245\324\366\276y2\243\"\250\017t\264\247\254\341\314\217?\306Y\245\004\"H[\203\311<\351\217\007:z@\231\303SV\036;v\226v\035'Ua\377Z\272b_ugO\375\327k#\033&I\024\206#\320\204\023z$\324\020\034<\020\205\032`"
+	.string	"\001\021(\335!\020IH\032\201%\035\351\363\274/\324\221F#^\027\002K\035\b\201\277\022\021\330\205\337\007v\235\272\2673\032\001e\242\035|r\355\242\b\371\352\257I\315\033{lT\004\314\f\001  \300\242\031\264\035;Q\221\241\361\b\214\005w\032p\211\023\346\025Z\334|\017{\264\226\n}\245\264\2134\222{xL2\312\301\260"
+	.ascii	"\006\344\254qkA\033V\377\272\262\353\307\211\002\025\310B/\253"
+	.ascii	"hH'\236\270\025\223 \310"
+	.text
+	.section	.gnu.lto_tfp_snprintf.36.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\363\004\205\036"
+	.string	"V6\275I\260\226Uc,Jb\233\302\251tk\360DXI{\002C*<0\270\032wB\230\3303\210\316\0178\t\376l,\354\314\336\320\356V\343\272\207V\252\363\260\2613\005\027$\332\241\270\00446@q/!O\303\364\337[\312\224\002\240"
+	.string	"\255"
+	.string	"\241"
+	.string	"W\322c\273n\336\326\371G\276d\327\313\312\357Ht\007\372\224\227\b\275@\023\216\216B\031\316\2337\360\262\212\331F\374\004c\201\336\336\r\322\317Gs\323\030\316\327T\314*\251\250r\201I\254\326'\371\311\255{s \245\367\336\032W8o\276\200\261W\373GG\322\035\375\271\314\275:\206\244\367\2425fp\3364z\332\366\211\334\247\263\237J\224G\357FW\\\024\341r\357\225\301>\303\272Y\236"
+	.string	"\353\2465\272\356U\347\177\351\345\020$(\274\036\320+\214\205{\257+\2577t\333\333^`\033\3076E\004Ql\227{.\345Cy\261<B\244;\321V^\242k\255\374\2042LT\276y\320s\242\355\350\235\361!\2371\304\251\373\te\212\304\316\372\251\236?1\026\234\317\370\341\374\320\217\262.\367$\376\2223\371\323\241hnH)\362\335{]B \n-1\230z\341\235"
+	.ascii	"Q|y\023\273u\323\033N'tJ\314\326;)\2510\200\336\241;\241\301"
+	.ascii	"\362\376n\351\343\210\030\003\025\253\365\301\\\211\336\336\205"
+	.ascii	"~\302\232\247\026\202^\334\022xD\364q\2717\245\271\031\323\024"
+	.ascii	"{}\232;\372\303\022j\311\350\001\343xoZ\323\224\363\231b\272"
+	.ascii	"\304\3543\345~\306A\033\305\323~\370\003\351\245\310\343\256"
+	.ascii	"^y@\3051\355\245z@\314\030\357\335\235W\332K}\t\216\002\343\207"
+	.ascii	"9\263z\336i\001X]\"\013\344G]\003\215\"\3249\364\204 \267\310"
+	.ascii	"\214\027\232\366N\245}\360i\255W\266\366\351]yU\273\232t\201"
+	.ascii	"\244P\200J\363'\371R\211\0041xv\315D=\317\260\026\026\310\257"
+	.ascii	"\344\213\002^\210\310\252[\257l4\250\332\035\366\313ku\330\257"
+	.ascii	"n}x\237W\372\315'\375\345\321\337\nPp,\252a\204\305RA\357\214"
+	.ascii	"d\227\035\321"
+	.string	"\f\006\371\360O\177\340\255}_\311\003\263\357|F\333\311\301J\340r\316\234\024U\207\306\303S\303\371\300\360\330HX\332\212Z\256t\004\007\020h\263\006#nl\006\344\356\231\r\t\036\235\032nG\246s\263\331n3\231N-\307&\233\341r2\233\003\276\355\320p2\236\333\r's\241\273\333\247\225\200cg\203\354\003\374\217IBfj\007\017,x \253\214\374\224\367\346\250pL\252I\373C\241\323a\273\340\322[?\222BE\305Ku\330n\352\217:\207\036\021y\334]\271\237\345\204\315\377\341\377\260n\"\250RcW\223-K\001\006\215G9\200\246\033\305[\374i\205L\221[nc\235\352.\034\001\246\016\253\001k\250a@j\2242c\201\314$-l%\035\200\242\231:\363\021\020Q\313\312\024\n\313\034{t\021\325pA\335$\035\252s\300\315\2032j\327\212\213\275\346q\301I\371Z\311Z\037\030_\336'"
+	.ascii	"\017\337\344\364\353\234X\251>\022\240\350$\247=\002\270\252"
+	.ascii	"\257eI\335\245\017 \242\311\357\371\303A\330\032\263\256\200"
+	.ascii	"a\333\236E\237\251cN\316;\203\354`\t\275\315*\271@\020\022\310"
+	.ascii	"\325^Z\032\n\216}\2623\346\036+\026\211\355\n\231L\232\245\342"
+	.ascii	"z\262\251>\377\035\320\222\351\002?&\001yV\370\310p\033Xj\034"
+	.ascii	"\n\355\246\231\027\177\257\305\034\032\n\265\350\013\360\357"
+	.ascii	"\347^\027\255g^\231\246m\"\342\253Rl\345\033\022\312#\2070\346"
+	.ascii	"\225+\360\0347XL\020\335'\3417}\206\n"
+	.text
+	.section	.gnu.lto_tfp_vsprintf.37.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\363\003\365\032"
+	.string	"\306p\251I\300\226QcIv5\345\336\212\203\026BVWt?4\t\360\265CA$\020\362M\350\306\236\"\256\30282E;\272y]nb\276\331\322\221~\3707\367S\230\244:\271\304\304\332\207\367S\037 #s\300\332=\366\336R\246\024\212"
+	.string	"\240"
+	.string	"\213"
+	.ascii	"UJ\373?l\356\303=\022\347F\022\335P\001\274\367.\270\350\013"
+	.ascii	"?\252\331\253\213\267O{e\013\320Q\332\352\017\021\221xb\201\274"
+	.ascii	"\220\255\272\350\t5\312\032d\"\t\206\274(\340E\371j\237\307{"
+	.ascii	"\234Oo\336ro\317\317\356\336\364\305\n\310\213NI\333\376\216"
+	.ascii	"\003\235v/Lm\340\3563ub\b\352\336\353b\235\300x1\374\200\361"
+	.ascii	"\242\365\371\371z\372/z\370cTd\303\341\274\256\304\334{]m\270"
+	.ascii	"\334mo;\201\355\016v\350!E;\347\217\230\341\335\271\326I\013"
+	.ascii	"R\223\035<\250\375\210\371\364\262x\356r \317\230\034\0247\364"
+	.ascii	"a\244\004\004\3252T\256\3243\325^\304P\n\24477\003z\002\202\332"
+	.ascii	"@\336\347+\371\264\271\221\217\364 \027r\"VH\350\347\336\273"
+	.ascii	"\3529Ji\353{\037BDb\274\251b4\341\245K\312Z\317\01321\336T<G"
+	.ascii	":\3003\274F\024|\246X\226\312\261~\227\344\336o$/\205\316\313"
+	.ascii	"Ek /\352brPT\360\231Zp\221%\251|\275\316\346\351\315xS\255\270"
+	.ascii	"\241\003\274w\367\002\304\306\377\301\022\343\233\276\222\021"
+	.ascii	"\340Lg\241\274\027N\242\275\357,\264J9@\r\255\265_\252\205 \360"
+	.ascii	"t/z[\353_:R\f\301\223\315\367\211\220\325\333D\013\200\312\335"
+	.ascii	"\2618\276\3221\3608]\"\307\320BIh\337\263\366\274\326\277\273"
+	.ascii	"\256J\271"
+	.string	"\332\353\356j\223\202\326\240W3n\225\262\323\234ji\330\017\357\275\327\266\307~\365x\337-\236\350\017\037\364\333\247\177]\271\344\222\300\004\357e\021\254r\177\"/\307}\277\316?\372\257\366%\337\310\221\204\001\257\323\034V\"V\023\316\300h\264\330\254\266\"3\242\276`45\254\0203\031\222&\003a\035\241\001\004\330\213\301\007\007-\227\232\373\325\002A\233\211\315h\\3\246Lf\276\\31\031\231\3535\253q\265\f\330\244\201\315\\4\323\234\271V)\372\360\332\036\321\262P\233\343\233\360\336\0310\327]\005\f\252A\373\276\036ow\326\213\376\0259\334\317\005\206\323m:\013e\372\225\236\001\367\213\002\242K\3563\231\231>\016\377f\274x\240\211\013\264\006G+A\207\347\277\003H\212\341t\221\234\244\022\265\213\232r3V\250\221,h\0243H\315L4J\023c\016\220\242\031\263\252\003\021\260AU\344\306f\373S1"
+	.string	"\020c/\024\013\035\262yVS\306\214\375\374\352\271I\022\314\t\020?u%\3313\361\355qW\277NF\307/\255\016\232\335\236P\362\221>,\034\246\355g\235\221\027\002\245\215\372\006@\361\025\007\b\245;\352\003<\306&\007\035.\"Y\230Lc\235\3613\212\250qU\374y\003j\205\032d\tN8J\266>\021\3365"
+	.string	"\246\367I|h\004v\207\r#\302\"\035U=\366C+?\003\bj\351I"
+	.ascii	"p\264\256(\005\334\227\213\341Hn\232\036\220\273\n\370\324\236"
+	.ascii	"6e\022\315\037"
+	.text
+	.section	.gnu.lto_tfp_vsnprintf.38.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`T\002]\024"
+	.string	"\226f\207J\320\360(\035"
+	.string	"\352\217\352C\372\001\332\026\212\266\273\361S~\250\0060\335\\\013\354D5\003\016\tN\245\336\t[\r\036\307\340o\355\177\037q~\177`\301\016\202z%\310\023sU+ \217\341\342>4U\254\264\343\210%\204\354\235Rl"
+	.string	"u"
+	.string	"n"
+	.string	"\034\226\202\273\247\211#\034\261(\375\316ul\344\217]\024\275\340\356\232\030B\3711\004\310:}\216/\3433r?].\262k\003#\270\03341\202\362\243\317\322\266\037\34389\333H<W\360~\023\343\241\307iw\315\325I\310\217\342\005\220\037\253\212\347Ns\376\201.\276\350\rw\274\227\323T\312\356\232\356x3w\275\355\003\266/\330t'\266\312\270\377\374\340\211\304\037\232\335U\345>D\023\227f\353\322\n\t\215\262"
+	.ascii	"\367!\332\317\225\371\314Z(s)0\037V\364\365j\224|\024\351a\221"
+	.ascii	"\364@\334\205\274c\300\27135\034%\034\247\217\256\360 \234\255"
+	.ascii	"\372x\377\227S\205D\261\354\003\371lT\276\204(}n@0\355n\311G"
+	.ascii	"O\b\341\301\022\351i\374\247\3272\224P\336\307\376\370h\025\034"
+	.ascii	"\254J\337\303\023\300\023IK\364\262\351)\370\324\303\247\221"
+	.ascii	"\027^U\023\340@*,A\326\373\276\322Q(\003\240b\255\365?\334\213"
+	.ascii	"DiW\367\035\255\377=G\203\001\245\235\r\223\321\357\310\n\322"
+	.ascii	"\2644\365\305T8\"i)\224}\302\320\232\302\276\270\325\306>u\352"
+	.ascii	"\276\233|\357\027\317\363\327\353\374\364c\304\305\r\225\034"
+	.ascii	"\2732\303\250E\032\205-\356\373\355\373A/\n\255\317\036s\335"
+	.ascii	"n\257ZKje\003m\271f\266U\206\332Jy\203\261TW\207\227Mt\003\005"
+	.ascii	"\f\\\255\004\030PNFlw\353\204\345\026{\325ffL\006\203\311Zf\354"
+	.ascii	"\265\0023[5\233yB\300\262\231\253f\336d\262\232\251:u\267\311"
+	.ascii	"\352\240FWa<b\"i\205_\351\200?\320)\360\220\236\230tG\367m\314"
+	.ascii	"h>\013\337\205\374X@\007\211\363\251\372 F\204\216\016\375\242"
+	.ascii	"\203\004/ \220\"\"\274:\273\251\b\241\315\bl\206\342G\236\267"
+	.ascii	"/\265\302_l7\"S\310\021\353+x\016\\\317 \241\357\301 \326\031"
+	.ascii	"\017/\357\212\023>\033n\030^\021\306\312\261\332\334#\006vx\303"
+	.ascii	"\274$\343\303\033\022\245\250F\203`n|\032x\334\f\306&\301\306"
+	.ascii	"&\242\210\377\354h\213\211\t5'\256bM\b6\366T\242M\327\"\003"
+	.text
+	.section	.gnu.lto__putc.39.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\213"
+	.string	"e\n"
+	.string	"\006\325JA \213*\035\307\022"
+	.string	"\3060s"
+	.string	"\360\005\322\356\352<\376\002I\n \201\016\264"
+	.string	"_\016\376\220o\2311\b=\007H\202\032(#\310\"\243r\374\352\302a\210\367\207R\300eSXm\254hm\023)S\n6"
+	.string	":"
+	.string	"5"
+	.string	"\033rlayt\370\b\312\243\345\020\224G\177\366\205\207\006\266\262\022\200\212\200aw5-\360\357\371\371w\360\013\2302=+\237\335u\202)"
+	.string	"\267\336v\205\355\217\375\211\232\316,\375\212\2465\241\243\302\356IL\303\302\342\013\201\355c\354L\202\215\246\355\311\370\036\222Xw\007Hp\355.\307\034\226\307\314j\363\264\317:\203\357-[\370\303\256J\201k\003\024&j\262\377\340\020F\374\003\026!\345\301G\237DyT\275\004\270f\246\327\2436\2342f\r+_\013(lf\260CS*\001\373\331\356\256Ue?\374\263\230\326\333\275\201\241\001\332.@<\035\315\350\336:!%Q\310\033i\242\216\343\272M\023\205>8m\363HZG\302\335\b\344i\245\256\3634L\270\317VU\366h"
+	.string	";i\211\0352U\325\346\272<\350\013"
+	.ascii	"{\241\"\023\017\204F3\\l\020\\\027\372+\327\227k@\223\2059\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_printfSupportInit.40.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`D\001\305\r"
+	.string	"&\030ZE"
+	.string	"\2216\035`\330x\211\034\205\351\220\372\326\036\002\b\203/z\347\003\210\1776\212\032x\214\241\357\232\2237\264\271&z\020HQR\243\304\204\001\337[\322\277\371\357}\373\360\214A\2645\224r^]\031\372mm\247\024?"
+	.string	"K"
+	.string	"I"
+	.string	"[\025|\032A\347\323\365\037\234\317\316\005p>\375\026\221m}\336\262g\337x\035\261\207!\241\3014\356.\245D\334\273\364\374\263\034"
+	.string	"h\222\341\322\003dw-A\223\223\233\272\355\003\266#\330o\021\024\212]=\254#\016\t1v9\334\354\330\031\363E\t\277\345/\242\213~\212\233&\300\030w\327*\271\204BPJ\276\344\022\272\007\b\266\0072\332\260\325\212\030\025\t>=\035\250\224'\371'\216B\364\352\031\002uO4\0235\304q\0032\236\301\262\254d\307\232\231\242\002B\364a\036\203\301W1I'\017v\234\317\0016>|\362\306\177y"
+	.ascii	"\031\0314L\257\240\303\305)\307\305\222Pg\367;\370\022\375I7"
+	.ascii	"\360I\033\177\204+\247\232\2256v\035I*\305~\265\001\"\\\247U"
+	.ascii	"~\300\300A\310\265\340B\203\217G\343:\255\362\365\021\341@#\233"
+	.ascii	"FA\031\206e\027\005\215X\300\350\265\221\320O\001gZ\310F\271"
+	.ascii	",\333\250U\277WK\241x\206\365D\363Q#\333'\375,\247\020\256\234"
+	.ascii	"h|\026\017  p\202\251\251\344\001\006*\262x\323\033\r\205\031"
+	.ascii	"1B\003\314^@dv\335\331\2304aW\245\310\354\321\033e%-n\356\341"
+	.ascii	"$\212F2\264\234Ce\b\343\f;\313\221c\244\013\tv\314\232]\220/"
+	.ascii	"\376C\002\267\313 2/\332E\006"
+	.text
+	.section	.gnu.lto_setPrintfSerialPort.41.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\275\b"
+	.string	"\366P?90\221\322\001\200@\247\201\216\034\334\301'\rq)\233&\365-bYn\252\351\262\r\333\002o\366u\337q\177\246G#\f\201h\3645\032\3020\325\301\215\320\335\006\331d\357\224\002,"
+	.string	"/"
+	.string	"."
+	.string	"\017m\227\366l\235\177#{\231\231\016\230\235\335\235Q\344\336\241\347\237\345\001\256\027\353\020@bw\r]\257\217;\336v\202\355\t\333/\001~\354\207Z\b\005\207\"f\327c\326\2632Ycb\373 {\200\343\341\320\276\312W\274\307V'\330\205\335\320\354~\013V\370\\\372\273\301v\371\t\021f\213\024Y+n\030F\277\345.+\277\304\032*x\327\245\257\332.\017H@Zpfhs\222\263\220\307\376X0\206\330\327vw\035a\016\216h\200\030u\f\027\016\\A\252\322\212\f\021\251\216P\002\3568\214\224\211TO\323DK%\332M\023IT\232]EM\016\301\3644\2523Ei\235\240o\257m\b"
+	.string	"\204\223\240L\350\343\013<\270"
+	.ascii	"\3432\312\267\032\r\356\362\242\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\301\002\005\016"
+	.string	"\304\023\275\003"
+	.string	""
+	.string	""
+	.string	"\002\035\177\023\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006\"\177\021\200\200\200\200\004\270\320'\177\024\005\032\025\300\204\001"
+	.string	""
+	.string	"\003\002\037\177\026\260\223\316,\272\220\202\002\036\177\027 \177\030\005\033\031\005\034\032\002!\177\033\360\372\2508\232$\177\034\232%\177\035\232\002#\177\036&\177\037(\177 \272)\177!\0013\177\"\377\037"
+	.string	""
+	.string	"\200\220\200\001/\177#,\177$+\177%.\177&-\177'*\177(2\177)1\177*0\177+\004"
+	.string	"\277\341\344\356"
+	.string	"\001\225\027\004"
+	.string	"\376\302\311\335\001\001\225\037\004"
+	.string	"\301\365\252\313"
+	.string	"\001\225k\003\002\020\304\001\003\004\026\335\333\2446\001\244c\003\004\023\377\352\234\b\001\244v\003\004\022\204w\003\004"
+	.string	"\376\325\271\020\001\202z\003\004\025\304~\003\004\024\244\177\242\242\001\204\247\001\244\252\001\253\266\001\003\004\021\204\342\202\343\001\004\004\262\263\325\237\001\001\365\n\004\004\225\262\001\265\272\001\003\005\004B\003\t\031d\003\t\004\242\007\003\t\030\204\013\003\t\027\204\016\003\n\031d\003\n\202\007\003\n\204\022\003\013\242\006\003\f\031d\003\f\013\242\001\003\f\006\003\rB"
+	.string	"= \320\002\251*\316\001\310\303\215\020|\020\017\235,\023|\311\344#\017oh\205\321\335i\256F\"\245 5\216R\3450\272\325L[\332\263\240 \323#02\200\222\021@\270;\355\330j]\002\307\321\201\250\035\320\001\272\240\013\272@\007t\003\235W\310\007\262\364\265\005\203\354\245\216+8F\377\354\021"
+	.ascii	"\354\320\341vFv?\203|9\023N\030c:\f\322Y_\340\033\227\003\371"
+	.ascii	"#\0265Dp\223\370\034\2601"
+	.text
+	.section	.gnu.lto_.refs.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375 I\315\001"
+	.string	"R\004\f\021\240'\351\377?x\363\377\177kd\223M\332\226)\005\272y\260UK\233D\026,\260\345\025\013x\304\022F\251t\020\3138\324\216Ls\214[-\004\001"
+	.ascii	"\001\003\005\005"
+	.text
+	.section	.gnu.lto_.decls.a5e89a283652abca,"e",@progbits
+	.string	"(\265/\375`\261 \325\222"
+	.string	"z\355\2204Q0P\322I\007r\272f\021\235\210\3475\263<\022"
+	.string	"\317\367ulI\0033\233h\315\254\266\026\301\210\311\270\313}o\215\232"
+	.string	""
+	.string	"J\367>\037O\311QCK\030\303a=\254\024\240T\037q\334\362O\357\275CF\034\242L\367AD\367\210\276\331\275\245L\001\310\002@\003A\003\202\274\306\202\035\251fK\036z\353\032=\177\375\234\307\203\315\360\031\026\315\243\225I\345\f\211f\232\333\020\300u\215\232"
+	.ascii	"a\302\304\275\2015E\347\300}\003\252\303\225\005\030\036\256"
+	.ascii	"\355n4\223\f\354\256L\364f\325\245Y\365\355\352e\027EW\020\303"
+	.ascii	"\257\271$nn\352{M\315Y\023e\215 \231z\233\224E\235Q\303i\232"
+	.ascii	"\304p\345\360R\337[\352M\024\2570\203}9\220\001o\3303Gg\007\237"
+	.ascii	"\224\\\337\367\224\372\206\252o\"\352\233\207z\036Ty\376T=\341"
+	.ascii	"\225U\030\036\334\016q\r\327\034\024\236\032\002N=\257\251\347"
+	.ascii	"1\225\353x\fw\225`2\3471\256r\017\314\350*\365 \206\257\b\231"
+	.ascii	"\227z.1\334\341\022\303\363\225\232\002\216\005\210c9\270{cm"
+	.ascii	"-\311\2208\270\241\234\327:\006\346\f\267S\205\026'\325\227\271"
+	.ascii	"\360\227A\264\267i_nc7\356\"\301]\316o\354\345\302\242\350\032"
+	.ascii	"m*5eb}yX\200a\373P\317$\206vp\220I\fy\251>\371a\310k:\\F\304"
+	.ascii	"\270\372\236\0055\013\026\0334NH\242jg,\317#\256\bXe\031\255"
+	.ascii	"\261\276l\306i\024"
+	.string	"\024e\215q\032\232\325\341\325\227\326\227\317\330\nw%\300W\242]\353\032\335!\032\031Q=\373\376\004\365\203\234\300\220\313>e'>\256\354\365\275\337\361p\330\246\242\276\364\375\006j\b\026`x\325\370\203T,\207i\fz\327\367\334\305^\374\305a\326\311\343\271\222\255k\264'\204'Lv}9\312`\3470\236r\025\026\334*\303\326\256u]9\254\202\347\272\026q\330N\232u-\332a\026\301,\342J\211\2622\033\336_\240>\312\002\fU\3760$\216\370\277\003]-x\253\277\277\005\372\3407\277]\341g'\355\341\b\034\347o\034\317\371-\nF\013\260\340\342\003\374\326\372h\365\267>\037\376m\303\317sm\303v=<\363\267\260\257\211\266W\340o\274f\032\322~\226\322\377y\220\257\254\3719\213\232\2379H\363\263\340\317h~&\013\374\031\360\347\266\035~^\340\204\377-\036\367\377\205\377$\376\273\360\263\337\177"
+	.ascii	"~~\300\304S\374m\3653\013|!\356\341"
+	.string	"o*?Cp\365\357\345\317{?\337\375L\367\263\333\317k?\243\375\\\366s\330\317\\??\371\031\353\347\251\237\221\374\254\364\263\321\317\312\237m\374\\\303\317\307\237i\370\371\305\317-\374\034\302\317\037\374\334\301\317\t\374\314\342\347\n~6\3613\005\377\205\376\007\375w\361\037\354g\237\237%\3709\202\237G\374\034\342g\021\377U\370Y\201\377b\377\303\376K\360\277\313\177\235\301\301\301\301\377\262\370-\326_\300VK\200L\325\316\322k\322+*\256\233F\002\347nM\232\263\233+\301%L\372\266\332\361\204tM\255\276\276\235\366\351\216T\213\023\264\246\272Y\373\242#\256o_i(\246\223\230\257\266\"\244\202\245\313\237\225\237\021\343n\254\361\321\367gM\326f8zF\203HejRzM\276\324\337+\365WJ%^\031\361\246\322\325T\332\tDt\375\001\003\336Q4\202\337$u\247IL\254\247l\2240\335\036j"
+	.ascii	"B\244\\J\203\251+\213\301w\364\r6\025\306i}Y\373\366\224\343"
+	.ascii	"q[\223\247\257\233\331\331\342e+K\337\366j-\234);T\355\350\333"
+	.ascii	"]\237\252A\302\202\324\267\2718L\215.\025m\021#\002\222\215Y"
+	.ascii	"\351\373\333T{\242\214\350'\r\345\275\325Q\376\255\236R\225\353"
+	.ascii	"\252\214\256F6H\256<i\001\256JG%n\351\324\017\327\242\243u]\177"
+	.ascii	"\b\243\253\332\222x\026\236K\3749l\231\201u\375o5\270[W\257%"
+	.ascii	"}C7\350\220\276\207X9X\327\026N&\364\250\307)-R\366\354\210B"
+	.ascii	"\221\234R(R\317\032\r\033\262J\245\326\325\311|*\273h\215\256"
+	.ascii	"H<+\023\212\244\256Ez\316\350z\324\263F\213\216x\205\0369\311"
+	.ascii	"\212\224=N)T\351\224>\221z\234Q(\322\312\\\225*3l]\231O\244\236"
+	.ascii	"\255(tuJ\213\220x\234\322\247\262k\211U\023\001T\250\2009\343"
+	.ascii	"d\256>\f\330b>\217\340\234"
+	.string	"\321'\253\255\253\222\254\271\036A\327\265\351)B\215\311D\251\266\204\363a\243\304\214*\211\364XF==D\227+\234S\353)\243\271\256c\326\036\025(Y\211c]*y]\233\321\243u]>gPz2\035\216\2435ge\026\361XF=\211\315\345\023\307\252\005\305HNi\324\323\007\313\230\364j]F\225|\265\216\201\036\251Retu\362\345\354\200\026\006\320\311\277\3305XN\240\272\311\324_\022S\231(YXB?\300?/&\334\325X}\365/\304\347\rZ\222\020\252\276\f\202?\f}|\336Lx\212 \030[\325\361Z\t\006\245m\t\325\032\304\215\251/UO]$\251\235Z+yO\345\f\206\345\231\351\333I\216wc7\265\304\305a\235\367\266%\n\311\021U\310\r0\"}\337G\3766\302t\0346\003\0019MYRF\372\022\371\303\260\243|\336R\037\206GJ\321\225LH\244\013\024U_\034\376"
+	.ascii	"\205\3421WE\336\240\236;\\@\216,Yw<`\021t\022\344\251\235\232"
+	.ascii	"\236k\226v\352\"\201eN\216\3726\271\251\325]\365\275]\242\236"
+	.ascii	"\351\372\226\246\314\306sFbSzU\356\234\276\354\236\256\350\304"
+	.ascii	"p\031\035&\317\312\214JrU\345\317(o\217\317\354\230c\342c?\""
+	.ascii	"|;0\232\271\036>\315\203\007{\265\321+\233*Q;|Z\3317\222\226"
+	.ascii	"9\246[\216\327\234\243\352\034[T\310X\013\213\346\221\207\037"
+	.ascii	"sU\024\374\034\006\217\313T\021+\362\267Q\373\350\243^\352!\255"
+	.ascii	"\324D\272G\353\350 \315\324@ZH'\365\216\376\321H\334\325<\272"
+	.ascii	"\371\306\321\316\203\210\256+s]W\2377\017\016Y\234n\366\312-"
+	.ascii	"\332\364\017j\324\327Z1Su\246\244R[v\313\\\235\252\256n\272\342"
+	.ascii	"\330\320\310n\313\314\324\376\240}m\225w\031\262a\321\351\350"
+	.ascii	"k\307\250HU\035\035^^6\214y\242\313;+=\027z\320'\013v\033F\314"
+	.ascii	"ZK\262\352k\243%\2540\301\002\330\327N)\341$7\266\354k\277>\265"
+	.ascii	"QN\317\340\246\2509\\[[\226\213\303V#\256\273\332\373\003\264"
+	.ascii	"\322'f\300\254\224[.\026{#k\016\366\265Q\236\266\003\245\367"
+	.ascii	"ci(D\3151\032\321\344M\354\023\020O;\007\270\364\265\265\256"
+	.ascii	"J%\356\016qXj\326\311\355\0235\f`\232\034}\255\226\265j*-C\232"
+	.ascii	"\254\302\250\277\273\241\016U'p\311\022\213E&\355Ik\353\206\356"
+	.ascii	"J3\210\275\272\305\2729\302\244\354\262V\036\340\376\376\310"
+	.ascii	"\254\225e\302\305G\027\252\246\273t\246\245\255oU7Ot2\262T\367"
+	.ascii	"\247\356$Y%V\211\235*S\242\367&\304\311\214\337\355T\236\234"
+	.ascii	"\026\0233:u\347k\311&Y\262Hx=\"\263\243\213\3548\273r\272Er{"
+	.ascii	"\244\314\023\n\226\276\026j\215\3400\331\234T}m\224\225\202\272"
+	.ascii	"rH\323$}\355\263\367\262\214\232\230\364\265O'r\344\212\030\025"
+	.ascii	"a1!\031i\230Y_\333\364);\321\325\371\365\265L"
+	.string	"[\324\236\025\t\311*\361\352t\023\356\235e\321%\335*\335\016Q\225Z\346\372\204t\037\231\021\332\216\2766H\357\t\221\322\255\351k\201\264\231\027\361P\"\355\373\023I\254$\365\265?Xlk\207\031__3\225\307\310.\355\322\032\361\272\256y\322\332\322qJ\275\364\331\346\255\321\255\217-\2636\300\276V\207\355\241\302\021\301b\352kwX\036\302\265\346\324J(%A\264#\302\345\307m\216<\276++}\255\263\367\256%j\226\325\327\342h3M2\275\264\276\227"
+	.string	"L\221\253\276\366\006\213\021\t\342\324\3272\205PT\236.@@\253d\245\325\326\335=im]?\251\024.\202\267\312\333\265\247"
+	.string	"\001\0035\330}Y\224V\320\276\275\246\367l\240gs@\372\266\232\023;mK\270\274\2459a\n\314Y\337\333hXL\253*\251J\337\016\374\364~U\\c\372N\251=\\\360\372O]\243H\270\236\264"
+	.string	"U4L\004\235y\357\277\267\337m\246\261s\342\353>\257\245\263\033Qj\237\351=)A.PMj\353M\360\"h\240\322\230I\"W\345\244o\363\247\3037TN\227U\235\020I\315a\216x\333\331\035\217{\326UJ\360JxC%\006\216x\223!\323Z\031\240\tT\001p\322\365\030\272\256\343*UOZ\200wm\251\355\207\230w\235Z\2327\276\276\035\346x7[LH\314\246\022\266q\001\"\005O\375\360\326\326sm-\307\263.\347\256\\\021{$A\031\342\345-\367\216\253r\024\247\004\327\323&\026\027T\337\376\322`\324&\031\253\255:\022\036\326\210\340\r\276\035\217\310\374\232R\244owq\273o*"
+	.ascii	"TU^\245\331XI\203\250.z\253\222R\tU\312\004\220\211\345\315\366"
+	.ascii	"\336\302q\202Cxh\351)\\4I\242c\320O\321\206M\022YL\022\001p\303"
+	.ascii	"\020RFrH\310&F\321\030ta\b\031\205\216\311\240c\215\027??<AC"
+	.ascii	"C\036\374\bsH\322\230\021B\3628\203H\250\210tAt<\340\250\242"
+	.ascii	"x\213*\216\266\250\342\030TCXTq\254q/\343\204\320\320Qh\b\310"
+	.ascii	"H#\207d\003\305\241d\214kL\036\221-\264H\032\211>$\217B%\320"
+	.ascii	"\250\241B\217\215\034\025"
+	.string	"2\b\211l\b\021\021\2074\2225\206`$\211p~\222G\241#N\f>/P \203\360\206\210\310\b\004T\034\306\340\363B\0052\bC\034_\024\177l\020\345@\304CC1\371\223$:\006\375\024m\374\374\344$\2133\220C1\204~h\304H\342\250\300\363#\274A\306\360\007\3208\320\021i\0242\322\240\276\202\025\023\254`\201\203\315Y`\220\002\203\024\303\263\300\300\307\007\203\025>\352W\370\330\030@\311\0324\204\311\3138\201\202\bi\264qD\302@\340C4\214H\024\311\241!$\n\234\244P\215\241\017l@\226\200\003\362\206\350\207\310B\0229\324\202\307\030\364\242\350\302\306\020i<\3068&\205\2140\2167\311\037#\214!\023n\2140\206f\334\344\017\nI\344\020\215\034\"\241\241c\222\306\220\2151YL\001F\215\342\013\325\250\303Q\0055\251\"\2110\212F\022\222?*(\b:\026] \2151b\324\360"
+	.string	"\207$\021\231l\001\"\371\263\302G\275)&\213 \340\200\324A&[\030m\034\215@\306\024\202\212G\244\221(\201\344\017\213\244\320\261\206M\r@\305\027AA\305\017\2143\212H\021p@\356 \2132\200\356Y\370\2540\002\245\200\241\342\004"
+	.string	"\277\340\202\017B\254p\302\b*\320\211\030I\241#\222\006\n\241\241\0313\206\200P\b\035\2133P"
+	.ascii	"!\211P\2340@\307\023\035?'(Gr\030Y-\315\252A']\340\024H \016"
+	.ascii	"{\247\31695\241k^&\016\340\225\272\365\206\335\033B%\t\226\335"
+	.ascii	"%\016\221'7\274)\365\277EZ\304\275\251\221\037Wi\271\246\312"
+	.ascii	"\277\033}\257e\212\2312*;h\321\206d\225\311\262\306\2561\031"
+	.ascii	"\333\230\232\006k\241)\357(\215\r\023\362a\031\211\t\226\310"
+	.ascii	"\t\024\263\334Bc\313v\262\3164-u\340\273dM\231P\200n_\322\300"
+	.ascii	"\216\364\265\177m\375\354\016\267\177\217\376-\220fg\351\214"
+	.ascii	"K\326\260\257\331\306\316\372\220\372\346\335\352\345\331=\341"
+	.ascii	"\227\0252\366\305\355\314\355\236N\231=\345\262\357q\254\276"
+	.ascii	"\244\300\364\265f\206\250\027s[F\214\275\023z\255\3532Et9fu*"
+	.ascii	"\225\260\371\353C\022\306\356\366\016\307\371d\f\212\035sK&\213"
+	.ascii	"\223\021\250\221\372\333:31L6:\324\017\003\325\034#oo\226\316"
+	.ascii	"H\216\245/\3001hT\222X0\267tVN\310\024Z_+\3276\316\316\335\312"
+	.ascii	"Y8\"3j\345.\213\320a\026!\234V\025\211\r\357\207|\352\375\354"
+	.ascii	"\027bT\271\346}\361\342a\357\316\216\251\263d\272B\302\246\352"
+	.ascii	"\230M\247\326M"
+	.string	"\nN\327\237Q\222\266[7\016\24328\025\353k\271pXG\3512\322\354k\331\032*\345\263Z\353k\267|*<\323\205%\313\265\330H\251q\216\255\2519}jjv\215\311p\314\321\2333\313\355\332u3\242\327\243\257\305\3627\034i\023A45\307\313\331\231E\333\022J\005\202\273\250\"\2118\211#\241B\2101\021\221\2214I:\"\013\020\206\202Q \327\256\003\022\340TE\f2\307\320\214\214$)J\245=\003\303\340\244:\0049-\030\312T\303\250\232\257\007M\275\247\"}r\366\034\224\"t\360\316\270\006\f\240dM\340\372\225\21420V\260\322\030\367X\303\365\200\265\343$\342\253\303z\323\033\021\331\002G\207g\271\331\203\306\332:%{\231%\335@\"*\273\374\232\205\27407\375_\306\032\2657\240O\024<\345\200ox\342E\331\302\036t\314\234m\026M2\030A\256\tDC\006\311\247\320\rxe"
+	.string	"\034Z\325\370\236_{c#\374\020\3428Y\240\331x\240\243J\226\250_o\031h\006M23(\206\177\246\022\312|\372q\244\201X\033\252\215!\317/\300)a\016\360\363\337\332;%\326\344B\335.3\243\334\344\2422P\233\266\330\020'p\301;\262\205K\030\257N\271x!\356@\272u\3650\240\355\260\341\247\260\n\020x\211\331\232\rC\007\024x\206\370\006\360?\025\210~\246\3503\002\345\255\261\303S\212=J@j\2021\306\243\002C\375\326\242\357\306z8\030^\215b\274\351\307K\204\2104 \031\350\253<\211\330\270`\231\206\213\350\275\224\275\350\r\020\362\024\307\376\271\227\033Bs4\230\215\323 \313R\352_\300\225l\315\363\n\001\253p@\255\351`$\206AA\3139 b\260\375\016"
+	.string	"\302\bRIj`\244\272\310@u\n\0250/\0345q\212\004\304 \301\b\271\2210\316\r\362\344\305\356\311\306EO\255a\242\241S\331\302XV\205\001x\227\200\315\374\344o\026A6\300\220g\234\250J\275\006\356x\250\240=\241m\304z\210\210*a\350}\242\325\234\235H%t\277b\\R\211\234\204\316\fW$\242!\310(\216\250\002=3\204%\b"
+	.string	"\300[@\341\354<\225~I\217t\336\350\274Z\304\301p'\033\036\201$"
+	.ascii	"\304\027Ao\361w0\200Ol\256\222n\270\247\274\333\311\376\250\253"
+	.ascii	"\031\0336\353\246\220\377Z\314l\272MK\207'\203DEk>h\335\225\375"
+	.ascii	"\3745\204\364\b\237h\272jYw\362\254\351w\005\274\221\302\027"
+	.ascii	"\2655\006j\211((U\261\031#\243\265\313.\fr\316\267\355\343\350"
+	.ascii	"4XJ\032JJK\006\232\213\023\354"
+	.string	"\307\332\320\271H\231\346W\370m\243Z6<mk\316\202\235\004\232\243\360\215\210\021\027v\2376X\274\004\361)b\264c\212\017\356B\b_s\226\207\t\304\327b\227\026\247P\020\022\213\325\022~ \305\357\211x\204H\347\036U\373\223\266wn\021\215\020\004\\H\301\027\354\221Q\371\001w\3134\255)E\353\200\323:\306"
+	.string	"\024\215\266\217\356\234d\336'\230\312\017X\357\264\274A}\316&zaW\221\031\006a\203tS#\035#\302\034\020\241Cb<\016\"\020\350\227\210\343\023\263\ba\b\207\327/z\362qT\240uZ\345I\\\034?\252*\223Y\025\241\3526\013\207X\303H\321"
+	.string	"\201!\330\332.\303_\304Xd\274\372\\h\233_cq;o&\200\007\221\2233\241\003{\034\303\204iT\205\023\032\306\314\377\033\013\321Y\301\326l\0064\016>d\003\347 \330k\337\320\332+\300\027=`"
+	.string	"\275\006\303w\220\353\263\312eOp\340Z3\001\332\356+\036@N\215m5"
+	.string	"\320\323Nr\330\3550&\331+\205\016\227\202J}JW\260\246)o\362\320sA\204\201\221\230\327\346\263\346\267bj&A\0227P\221\006\254\3779\330.K\022\214yb\332\247\257\022;\202|\271\253\016\024,\345P@\020\270\306\305\2149\200SI\026\367\256\023\265\204\230\013+F#\352\177T\217\t\333@\253\206'\030u\302\315\021\272-\2531\224\036X\222\\\332\316\013\265p \206\243\215\257"
+	.ascii	"$F\337I%*\357\361>=kX\021\341\260_B\257\362j/?\006;QoV\277?\372"
+	.ascii	"MQ\262((tQ\251\257\216\r);,\270\317 \264+\200Jw\001)!R\\\242"
+	.ascii	"]*\031[*Kp\225\276T\bu>#\356N\222\362\234 \tD\b\367c\fI\364\345"
+	.ascii	"\274.\244\330%\356P\330\013\311 _\361\265y\016F\200\260\314\336"
+	.ascii	"\037F\371\366\212\253\253\314\0354\333>\213\323Z`m\026\376\265"
+	.ascii	"l\250t\260r\344\317\242\235z>nW\372\177\221^X\240\276\221\223"
+	.ascii	"6\262-\274\234\265\365\\\204-Y\377\362\\\267\307\350\215\354"
+	.ascii	"G\326\260\301\0337\363N\362\244\017\034\360v\262{\212'\262O\031"
+	.ascii	"\366\221\276_\034\347r\277#\337r\301\t\373\267\2348\033\211)"
+	.ascii	"\270]\024\335\0341\230\234\360\031\213M_#\355\225\356\205:O&"
+	.ascii	"\026\r\317\243\006r\032\264?\nM\373\201\326N\365[\0257\002\\"
+	.ascii	"\360\364i\372Z\276K\343\031\264;[\266\3709j\036@\214\344\377"
+	.ascii	"qu7\005\233\244\316\305\260\367\320r+\350\304\361\235bg\032K"
+	.ascii	"\225\007\302\324\342T\374a\302c\036\221\276NY+"
+	.text
+	.section	.gnu.lto_.symtab.a5e89a283652abca,"e",@progbits
+	.string	"tfp_nformat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\001"
+	.string	""
+	.string	"tfp_format"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"b\001"
+	.string	""
+	.string	"init_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"tfp_printf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"tfp_snprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"tfp_vsprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"tfp_vsnprintf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"setPrintfSerialPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"uli2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\001"
+	.string	""
+	.string	"li2a"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a5e89a283652abca,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,6519 @@
+	.file	"streambuf.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "./src/main/common/streambuf.h"
+	.file 6 "/usr/include/string.h"
+	.file 7 "./src/main/common/streambuf.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	streambuf.c.64727dcb
+	.weak	streambuf.c.64727dcb
+streambuf.c.64727dcb:
+	.long	0x5d5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xf
+	.long	.LASF784
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF725
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF726
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	0x4f
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF727
+	.uleb128 0x9
+	.long	0x48
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF728
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF729
+	.uleb128 0x2
+	.long	.LASF731
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x6e
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF732
+	.uleb128 0x2
+	.long	.LASF733
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x54
+	.uleb128 0x2
+	.long	.LASF734
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x8d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF735
+	.uleb128 0x2
+	.long	.LASF736
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x2
+	.long	.LASF737
+	.byte	0x2
+	.byte	0x29
+	.byte	0x14
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF738
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x5b
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF739
+	.uleb128 0x11
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF740
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x62
+	.uleb128 0x2
+	.long	.LASF741
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x81
+	.uleb128 0x2
+	.long	.LASF742
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x13
+	.long	0xa0
+	.uleb128 0x2
+	.long	.LASF743
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x75
+	.uleb128 0x9
+	.long	0xe5
+	.uleb128 0x2
+	.long	.LASF744
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x9
+	.long	0xf6
+	.uleb128 0x2
+	.long	.LASF745
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xac
+	.uleb128 0x9
+	.long	0x107
+	.uleb128 0x12
+	.long	.LASF785
+	.byte	0x10
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x10
+	.long	0x13c
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x1b
+	.long	0x13c
+	.byte	0
+	.uleb128 0xc
+	.string	"end"
+	.byte	0x1c
+	.long	0x13c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xe5
+	.uleb128 0x2
+	.long	.LASF746
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x3
+	.long	0x118
+	.uleb128 0x9
+	.long	0x141
+	.uleb128 0x13
+	.long	.LASF747
+	.byte	0x6
+	.value	0x197
+	.byte	0xf
+	.long	0x22
+	.long	0x169
+	.uleb128 0x8
+	.long	0x43
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF748
+	.byte	0x2b
+	.long	0xbf
+	.long	0x187
+	.uleb128 0x8
+	.long	0xbf
+	.uleb128 0x8
+	.long	0x187
+	.uleb128 0x8
+	.long	0x22
+	.byte	0
+	.uleb128 0x5
+	.long	0x18c
+	.uleb128 0x14
+	.uleb128 0xd
+	.long	.LASF749
+	.byte	0x3d
+	.long	0xbf
+	.long	0x1ab
+	.uleb128 0x8
+	.long	0xbf
+	.uleb128 0x8
+	.long	0x3c
+	.uleb128 0x8
+	.long	0x22
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF751
+	.byte	0xd2
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0xd2
+	.byte	0x21
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF750
+	.byte	0xd2
+	.byte	0x2f
+	.long	0x13c
+	.byte	0
+	.uleb128 0x5
+	.long	0x141
+	.uleb128 0x4
+	.long	.LASF752
+	.byte	0xcc
+	.long	0x1f2
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0xcc
+	.byte	0x1a
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF753
+	.byte	0xcc
+	.byte	0x23
+	.long	0x3c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF754
+	.byte	0xc4
+	.byte	0x10
+	.long	0x20d
+	.long	0x20d
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0xc4
+	.byte	0x2b
+	.long	0x212
+	.byte	0
+	.uleb128 0x5
+	.long	0xf1
+	.uleb128 0x5
+	.long	0x14d
+	.uleb128 0x3
+	.long	.LASF755
+	.byte	0xbf
+	.byte	0xa
+	.long	0x13c
+	.long	0x232
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0xbf
+	.byte	0x1a
+	.long	0x1cc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF756
+	.byte	0xba
+	.byte	0x5
+	.long	0x3c
+	.long	0x24d
+	.uleb128 0x1
+	.string	"buf"
+	.byte	0xba
+	.byte	0x26
+	.long	0x212
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF757
+	.byte	0xaf
+	.byte	0x5
+	.long	0x27e
+	.long	0x27e
+	.uleb128 0x1
+	.string	"src"
+	.byte	0xaf
+	.byte	0x24
+	.long	0x212
+	.uleb128 0x6
+	.long	.LASF758
+	.byte	0xaf
+	.byte	0x2f
+	.long	0xbf
+	.uleb128 0x1
+	.string	"len"
+	.byte	0xaf
+	.byte	0x39
+	.long	0x3c
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF759
+	.uleb128 0x3
+	.long	.LASF760
+	.byte	0xaa
+	.byte	0x5
+	.long	0x27e
+	.long	0x2ab
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0xaa
+	.byte	0x1e
+	.long	0x2ab
+	.uleb128 0x1
+	.string	"src"
+	.byte	0xaa
+	.byte	0x2b
+	.long	0x1cc
+	.byte	0
+	.uleb128 0x5
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF761
+	.byte	0x9e
+	.byte	0x5
+	.long	0x27e
+	.long	0x2e3
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x9e
+	.byte	0x1f
+	.long	0x2e3
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x9e
+	.byte	0x2c
+	.long	0x1cc
+	.uleb128 0xa
+	.uleb128 0xb
+	.long	.LASF764
+	.byte	0xa1
+	.byte	0x18
+	.long	0x113
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x107
+	.uleb128 0x3
+	.long	.LASF762
+	.byte	0x99
+	.byte	0x5
+	.long	0x27e
+	.long	0x30e
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x99
+	.byte	0x1e
+	.long	0x30e
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x99
+	.byte	0x2b
+	.long	0x1cc
+	.byte	0
+	.uleb128 0x5
+	.long	0xcd
+	.uleb128 0x3
+	.long	.LASF763
+	.byte	0x8d
+	.byte	0x5
+	.long	0x27e
+	.long	0x346
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x8d
+	.byte	0x1f
+	.long	0x346
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x8d
+	.byte	0x2c
+	.long	0x1cc
+	.uleb128 0xa
+	.uleb128 0xb
+	.long	.LASF764
+	.byte	0x90
+	.byte	0x18
+	.long	0x102
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xf6
+	.uleb128 0x3
+	.long	.LASF765
+	.byte	0x88
+	.byte	0x5
+	.long	0x27e
+	.long	0x371
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x88
+	.byte	0x1c
+	.long	0x371
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x88
+	.byte	0x29
+	.long	0x1cc
+	.byte	0
+	.uleb128 0x5
+	.long	0xc1
+	.uleb128 0x3
+	.long	.LASF766
+	.byte	0x7c
+	.byte	0x5
+	.long	0x27e
+	.long	0x3a9
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x7c
+	.byte	0x1d
+	.long	0x13c
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x7c
+	.byte	0x2a
+	.long	0x1cc
+	.uleb128 0xa
+	.uleb128 0xb
+	.long	.LASF764
+	.byte	0x7f
+	.byte	0x17
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF767
+	.byte	0x77
+	.long	0x3d5
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x77
+	.byte	0x21
+	.long	0x212
+	.uleb128 0x6
+	.long	.LASF758
+	.byte	0x77
+	.byte	0x2c
+	.long	0xbf
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x77
+	.byte	0x36
+	.long	0x3c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF768
+	.byte	0x6d
+	.byte	0xa
+	.long	0x107
+	.long	0x3fa
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x6d
+	.byte	0x1e
+	.long	0x1cc
+	.uleb128 0xe
+	.string	"ret"
+	.byte	0x6f
+	.long	0x107
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF769
+	.byte	0x65
+	.byte	0xa
+	.long	0xf6
+	.long	0x41f
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x65
+	.byte	0x1e
+	.long	0x1cc
+	.uleb128 0xe
+	.string	"ret"
+	.byte	0x67
+	.long	0xf6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF770
+	.byte	0x60
+	.byte	0x9
+	.long	0xe5
+	.long	0x43a
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x60
+	.byte	0x1c
+	.long	0x1cc
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF771
+	.byte	0x5b
+	.long	0x45b
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x5b
+	.byte	0x30
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF772
+	.byte	0x5b
+	.byte	0x41
+	.long	0x43
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF773
+	.byte	0x56
+	.long	0x47c
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x56
+	.byte	0x1e
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF772
+	.byte	0x56
+	.byte	0x2f
+	.long	0x43
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF774
+	.byte	0x4b
+	.byte	0x5
+	.long	0x27e
+	.long	0x4ad
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x4b
+	.byte	0x1f
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF758
+	.byte	0x4b
+	.byte	0x30
+	.long	0x187
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x4b
+	.byte	0x3a
+	.long	0x3c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF775
+	.byte	0x45
+	.long	0x4d9
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x45
+	.byte	0x1c
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF758
+	.byte	0x45
+	.byte	0x2d
+	.long	0x187
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x45
+	.byte	0x37
+	.long	0x3c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF776
+	.byte	0x3f
+	.long	0x505
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x3f
+	.byte	0x17
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF758
+	.byte	0x3f
+	.byte	0x24
+	.long	0xe5
+	.uleb128 0x1
+	.string	"len"
+	.byte	0x3f
+	.byte	0x2e
+	.long	0x3c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF777
+	.byte	0x37
+	.long	0x526
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x37
+	.byte	0x24
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x37
+	.byte	0x32
+	.long	0x107
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF778
+	.byte	0x31
+	.long	0x547
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x31
+	.byte	0x24
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x31
+	.byte	0x32
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF779
+	.byte	0x29
+	.long	0x568
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x29
+	.byte	0x1b
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x29
+	.byte	0x29
+	.long	0x107
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF780
+	.byte	0x23
+	.long	0x589
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x23
+	.byte	0x1b
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x23
+	.byte	0x29
+	.long	0xf6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF781
+	.byte	0x1e
+	.long	0x5aa
+	.uleb128 0x1
+	.string	"dst"
+	.byte	0x1e
+	.byte	0x1a
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"val"
+	.byte	0x1e
+	.byte	0x27
+	.long	0xe5
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF782
+	.byte	0x7
+	.byte	0x17
+	.byte	0x9
+	.long	0x1cc
+	.uleb128 0x6
+	.long	.LASF783
+	.byte	0x17
+	.byte	0x1a
+	.long	0x1cc
+	.uleb128 0x1
+	.string	"ptr"
+	.byte	0x17
+	.byte	0x29
+	.long	0x13c
+	.uleb128 0x1
+	.string	"end"
+	.byte	0x17
+	.byte	0x37
+	.long	0x13c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF591
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF651
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF655
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF656
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF648
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF654
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF724
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF786
+	.long	.LASF787
+	.long	.LASF788
+	.long	.LASF789
+	.long	.LASF790
+	.long	.LASF791
+	.long	.LASF792
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x1b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF793
+	.byte	0x7
+	.long	.LASF794
+	.byte	0x3
+	.long	.LASF795
+	.byte	0x3
+	.long	.LASF796
+	.byte	0x3
+	.long	.LASF797
+	.byte	0x1
+	.long	.LASF798
+	.byte	0x6
+	.long	.LASF799
+	.byte	0x1
+	.long	.LASF800
+	.byte	0x6
+	.long	.LASF801
+	.byte	0x3
+	.long	.LASF802
+	.byte	0x6
+	.long	.LASF803
+	.byte	0x6
+	.long	.LASF804
+	.byte	0x3
+	.long	.LASF805
+	.byte	0x3
+	.long	.LASF806
+	.byte	0x5
+	.long	.LASF807
+	.byte	0x3
+	.long	.LASF808
+	.byte	0x4
+	.long	.LASF809
+	.byte	0x4
+	.long	.LASF810
+	.byte	0x2
+	.long	.LASF811
+	.byte	0x2
+	.long	.LASF812
+	.byte	0x6
+	.long	.LASF813
+	.byte	0x7
+	.long	.LASF813
+	.byte	0x6
+	.long	.LASF814
+	.byte	0x3
+	.long	.LASF815
+	.byte	0x3
+	.long	.LASF816
+	.byte	0x3
+	.long	.LASF817
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF664:
+	.string	"INT32_MAX (2147483647)"
+.LASF671:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF606:
+	.string	"__STD_TYPE typedef"
+.LASF740:
+	.string	"int8_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF668:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF730:
+	.string	"size_t"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF710:
+	.string	"INT16_C(c) c"
+.LASF742:
+	.string	"int32_t"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF771:
+	.string	"sbufWriteStringWithZeroTerminator"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF741:
+	.string	"int16_t"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF722:
+	.string	"true 1"
+.LASF761:
+	.string	"sbufReadU32Safe"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF751:
+	.string	"sbufSwitchToReader"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF651:
+	.string	"__STD_TYPE"
+.LASF774:
+	.string	"sbufWriteDataSafe"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF689:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF471:
+	.string	"__P(args) args"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF619:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF693:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF582:
+	.string	"__size_t "
+.LASF658:
+	.string	"INT8_MIN (-128)"
+.LASF645:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF603:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF667:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF688:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF783:
+	.string	"sbuf"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF584:
+	.string	"NULL"
+.LASF649:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF705:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF628:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF767:
+	.string	"sbufReadData"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF679:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF784:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF739:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF637:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF565:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF648:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF633:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF695:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF627:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF626:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF702:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF776:
+	.string	"sbufFill"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF630:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF732:
+	.string	"signed char"
+.LASF743:
+	.string	"uint8_t"
+.LASF763:
+	.string	"sbufReadU16Safe"
+.LASF593:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF608:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF624:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF680:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF659:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF759:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF764:
+	.string	"value"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF635:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF675:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF673:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF563:
+	.string	"__need_size_t "
+.LASF596:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF618:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF719:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF736:
+	.string	"__uint16_t"
+.LASF754:
+	.string	"sbufConstPtr"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF650:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF686:
+	.string	"INT_FAST8_MAX (127)"
+.LASF674:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF715:
+	.string	"UINT32_C(c) c ## U"
+.LASF694:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF665:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF704:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF697:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF775:
+	.string	"sbufWriteData"
+.LASF612:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF597:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF642:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF682:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF644:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF765:
+	.string	"sbufReadI8Safe"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF721:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF733:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF692:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF685:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF731:
+	.string	"__int8_t"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF586:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF602:
+	.string	"__SLONG32_TYPE int"
+.LASF707:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF623:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF656:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF698:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF625:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF591:
+	.string	"_BITS_TYPES_H 1"
+.LASF666:
+	.string	"UINT8_MAX (255)"
+.LASF703:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF738:
+	.string	"__uint32_t"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF564:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF654:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF607:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF760:
+	.string	"sbufReadI32Safe"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF762:
+	.string	"sbufReadI16Safe"
+.LASF643:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF691:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF583:
+	.string	"__need_size_t"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF590:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF755:
+	.string	"sbufPtr"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF461:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF629:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF598:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF662:
+	.string	"INT8_MAX (127)"
+.LASF772:
+	.string	"string"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF729:
+	.string	"unsigned int"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF720:
+	.string	"_STDBOOL_H "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF636:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF595:
+	.string	"__U32_TYPE unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF677:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF632:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF670:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF723:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF709:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF601:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF647:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF611:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF620:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF728:
+	.string	"unsigned char"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF757:
+	.string	"sbufReadDataSafe"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF782:
+	.string	"sbufInit"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF727:
+	.string	"char"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF672:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF669:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF726:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF700:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF778:
+	.string	"sbufWriteU16BigEndian"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF777:
+	.string	"sbufWriteU32BigEndian"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF681:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF657:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF617:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF753:
+	.string	"size"
+.LASF639:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF744:
+	.string	"uint16_t"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF725:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF766:
+	.string	"sbufReadU8Safe"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF711:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF716:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF780:
+	.string	"sbufWriteU16"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF770:
+	.string	"sbufReadU8"
+.LASF749:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF594:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF734:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF706:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF393:
+	.string	"_STRING_H 1"
+.LASF652:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF712:
+	.string	"INT64_C(c) c ## L"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF718:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF752:
+	.string	"sbufAdvance"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF785:
+	.string	"sbuf_s"
+.LASF746:
+	.string	"sbuf_t"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF581:
+	.string	"_SIZET_ "
+.LASF638:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF631:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF609:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF678:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF779:
+	.string	"sbufWriteU32"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF690:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF769:
+	.string	"sbufReadU16"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF735:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF599:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF616:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF600:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF613:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF699:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF696:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF605:
+	.string	"__U64_TYPE unsigned long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF714:
+	.string	"UINT16_C(c) c"
+.LASF592:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF708:
+	.string	"WINT_MAX (4294967295u)"
+.LASF747:
+	.string	"strlen"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF713:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF748:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF756:
+	.string	"sbufBytesRemaining"
+.LASF634:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF621:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF661:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF676:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF641:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF773:
+	.string	"sbufWriteString"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF610:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF683:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF622:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF663:
+	.string	"INT16_MAX (32767)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF614:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF615:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF655:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF687:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF781:
+	.string	"sbufWriteU8"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF750:
+	.string	"base"
+.LASF604:
+	.string	"__S64_TYPE long int"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF724:
+	.string	"__bool_true_false_are_defined 1"
+.LASF745:
+	.string	"uint32_t"
+.LASF653:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF768:
+	.string	"sbufReadU32"
+.LASF737:
+	.string	"__int32_t"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF660:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF758:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF646:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF701:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF640:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF717:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF807:
+	.string	"long-double.h"
+.LASF809:
+	.string	"stubs-64.h"
+.LASF791:
+	.string	"/usr/include"
+.LASF795:
+	.string	"stdint-intn.h"
+.LASF801:
+	.string	"libc-header-start.h"
+.LASF812:
+	.string	"strings.h"
+.LASF789:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF798:
+	.string	"string.h"
+.LASF799:
+	.string	"streambuf.c"
+.LASF805:
+	.string	"timesize.h"
+.LASF796:
+	.string	"stdint-uintn.h"
+.LASF790:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF816:
+	.string	"wchar.h"
+.LASF813:
+	.string	"stdint.h"
+.LASF802:
+	.string	"features.h"
+.LASF815:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF810:
+	.string	"locale_t.h"
+.LASF788:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF793:
+	.string	"stddef.h"
+.LASF808:
+	.string	"stubs.h"
+.LASF787:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF814:
+	.string	"typesizes.h"
+.LASF803:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/common/streambuf.c"
+.LASF806:
+	.string	"cdefs.h"
+.LASF797:
+	.string	"streambuf.h"
+.LASF817:
+	.string	"stdbool.h"
+.LASF804:
+	.string	"wordsize.h"
+.LASF811:
+	.string	"__locale_t.h"
+.LASF786:
+	.string	"src/main/common"
+.LASF800:
+	.string	"stdc-predef.h"
+.LASF792:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF794:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`y\001\375\b"
+	.string	"\304\fm\002"
+	.string	"\034"
+	.string	"\336\223\200\263\r\004\002"
+	.string	"\002\001\001\343\300\313\236\004\006\002\341\364\367\222\005\f\003\371\363\325\272\017\030\004\373\222\200\367\007\005\337\320\237\335\005\006\265\225\307\214\b\006"
+	.string	"\002\001\007\357\225\320\354\b\335\322\304T\b\002"
+	.string	"\002\003\001\t\225\266\363\346\013\n\374\333\265\356\003\013\356\227\246\276\016\002\002\002\f\300\237\221\277\016\n\002\002\002\r\272\341\314\201\001\022\016\220\247\317\273\n\002\002\004\002\004\017\202\223\303\360\007\003\020\244\222\251\264\004\n\021\356\316\301\210\003\022\305\331\203\217\t\016\005\002\005\023\241\355\375\344\013"
+	.string	"\024\206\210\306\211\004\004\025\026\372\364\251\221\005\027\365\352\322\261\f\030\306\205\331\374\b\001\031\003\032\324\237\336\343\b\033\344\270\237\360"
+	.string	"\002\001"
+	.string	"$ \220\202\2423.\006\300h&)\306TX\264PP\245X*}\334\b\311\332\021\300\331x~\321\031x\355\370\022\301N\004\016\002D0\212["
+	.ascii	"Gl\305p\024\306U\303\335\fY\222\257\031\035\225\314\245\006\002"
+	.ascii	"\001`g\f\354W\030\256\224\314\204T\334!"
+	.text
+	.section	.gnu.lto_.ipa_sra.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\"\001u\006"
+	.string	"\302G\026\031pK\323\001\251\252\252\252\252\252\370s\375\373\372\277\217\367'\266\255-\221;\311\2741\243\347E\217\275\242'\256\202H\2441g\255\357\354\220H\245\036[\315\320B\t]\367\321\255\217\264cwp\327\004\001\325\001\351N\250\026\304e\311mo\232\005A\223\177\017bj_\226\016\232\0227 \260\002\251\271\365(\230\3122\326\\\352\322\300\263,\375\346qU\304~\301bd\204\275\207\237\031\212.\030Z\200$,\022S(Z7\355\352\266\341b\r\032O\301\026)\344X\204?"
+	.ascii	"\350\035\"N\345\260F\255\r\027\00235\355\240\021\343\346\304"
+	.ascii	"\375m\030\351\264m\307\303a\037\342E\f\003\244\374\036\013\264"
+	.ascii	"\210uu\b\262\241\024^\013\304\217\306\r)\360\020"
+	.text
+	.section	.gnu.lto_.inline.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\354\b\265\026"
+	.string	"\026\032Y@ \217\223\016\342\320\020\033k\023\233q>\253\025\226\315\227\027\036x|(\207\002\022\231\277\235I\243\222\006\003(\340\241F\b\311\b\210("
+	.string	"&@\002@0\236[\307+7\263F,!\233l\"e\222):"
+	.string	"E"
+	.string	"L"
+	.ascii	"n\313\330\237\214\367q\226\335\325p\372\275\254\354\355%"
+	.string	"\273[M\324\021o\374\234\264\273\227\257\276\372\330\361#g\251v\372G\243q\243\214\367\265|v\366\333\270}ww\2627\\\221\002\351\024ll\271\003t\245\352G\272\354\256\306\325\206/\354\210\035C/DB<\333#E+/\253\317q\244\335\321\t\202E\245d\343\367\236\236Bw\2002\3121GS\265\216\325\361\211aw1vnzO\235]\265\f\025>\254\250=y\"ATJ\237\363\036I\351B\013\312\306\036A\344\204BZ\347\300\006\356\007\261\212 \204\220h\314q\033\3658\013\224\220\t\364\263\246v\260\273\017\354\351\210\f\234\036\304\237\020\032\321RY\343\353\332\037O\346\243\315\2720\001\266m\3408a\001G\300\266\226\236\354\307\355\243\001\032\031\277\036\265!\244A\304e\001\377$\251\223\340\031FFN$\n\f\023\227\354*b\244\3400=E\005E\tP\007\223\020kZ\340&\027%\021\211\216\003`\320\003b"
+	.string	" \310\226\024\013/\350\003\306\276\"\200\261\2501U\207f\204\264 \205t\220\002\221\221*\252\007\022`c)Hb8\203\fC\"\231\221@\210\224WR`\270\006\217\020\333$T\370\006\026Hmwf[$\304^\022\260\324\375C\023\377\215\264qX\313i1v\313\241\357d\303\n\3603t{&n}\204\317\003\251f\235/Aa<\255u\372\215Tf\246e8)\243B'\244\013CHK|k\203\b\376\243\001Y\340\374>H&\302h\376\322W\301\253\0067\221\021g0\204\005f\016\323\225?O\252\225\t\3252\037^@"
+	.string	"M\300\241\r\310E\303\214\313\312\233\353\234\254]\246\211\301\233\373\007\353s\307b\227\255\b%\b\277\200\0136\343\205\226\301\264\006<\36430`1\001\300\001as\201\212\217~\307\026\n\t\217\026\267u\235\001\r{1z\326\t\221e\037\f\3778\375\276\375HL\263\341\017B\354\354\262\244o\347\260\034\335\243\017\357\020\020\244\341\244\314e\213\314\220\310\232,D\035v_1\256LF\216\303\335\200\276\217\311\333\265\313}\236\025\342b\213P\324\270\230\366\377\345\264\302\262\032\022\367\332j\222\375\333\001Z\212\311\232\002R\273"
+	.ascii	"9\377\233`R;m(Xz\315E\265tW\021\226\022\242\277p\230 d\004\326"
+	.ascii	"y\013\301<\250_o\217>\337k\254\243\351\320\214\272\371,\375\377"
+	.ascii	"Q\365\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`H\002\255\007"
+	.string	"\002\f#&\220)i\f\377\277\343;\300R\356\356\366\205~wwe\213\306\007\231\001\377\300\177\324\032!\255\021B\b\331m\357\224dv\202\202\200\0164@\033\322\002\202\306@\332F\027\260K\311uv\321\003\374\024"
+	.string	"~\214\303\357F\263hs65\214\205\037RfY1\336\217\321\225\304\b\205P/-\326\217\001yXk\255\344y\236G\233PH\273]\232\204Zp]\336\351a\246\207fJ\371\026\225(\220\224 \344\305\321\375\373\363sP\221)\030j\b, \240\"\242InPp\303\n\347\260\336r\323K\354D\266\302\356\027\311\261\"\341\350'<\236\216'!\207H\221"
+	.ascii	"\030\007\344?`\204`\242\"\366\272\202\374\230\214\353`z\210\032"
+	.ascii	"1*\b\220\023\350\t$\\*\201\030D\003\023\b\006b\322\030\353\\"
+	.ascii	"\360KI\322\017f\320nWrc\n\276`\027\354.<\\V\360!"
+	.text
+	.section	.gnu.lto_.pureconst.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375 YU\002"
+	.string	"\222\205\021\033\200I\215\001\017\200\0232\201\311\300\f\240\003\370\007\376\0013\2625#\333,\264M\006\236p\204\353\3402\270\n6\202l`\023\310\002\016\360\312)\333\344\222G\016\371\343\2167\316\370\342\212'\256#~\270\341\247\270\273E"
+	.text
+	.section	.gnu.lto_.ipa_modref.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`[\003\025\n"
+	.string	"\002\f)/pK\222\016"
+	.string	"\263a\317U\365\023\246PJ\027\t"
+	.string	"R\201\212"
+	.string	"\373\237k[\305\272\326\260\023n\bH\244\377\366\255)<\327\277\355\326\b\3312\005G\026\030\211\346\n\005\257T`(\315\016\263k\230\341_\331\205\233\254\302\230\271\250\004\2046(b#Cd$[\376\027\230\271\203g\254\343M$\377<\367p:\2668\246\026\"e\235\017H\031\234Gbh\034E\317\365\013NW@0\360\226\n\004@\200"
+	.ascii	"T\2729\327'w[\324SI\341\204r\232\245\356\363d\327\333\332\332"
+	.ascii	"\316\357\375\256K\256c\207\372a\350\027EA\250q93\311\026&\205"
+	.ascii	"\326p\002\221IU\334\022`\3234\303q\024\201\241\030#P\242\021"
+	.ascii	"\214\240D\025Oeh\016\t@\013\222\275'r\243\3548\316\223s\304U"
+	.ascii	"\343c\261\307\327\213\376$\321\345/\003R\225\215fE7,\314\204"
+	.ascii	"\377\361\223\375\334\342\3673\362T\233\bS\236V]\034F\262!\211"
+	.ascii	"0\356\343\\2)\200\f\031\251\275u\020\226S\276\336\036\240xx*"
+	.ascii	"\022\336w\2750\334\001b\2715\233\253\357Fj\024\020\356@\240}"
+	.ascii	"\361\361\355\374\300\331\267\005\204\201<e\256\026\341y\037"
+	.text
+	.section	.gnu.lto_.lto.7ea4a4565685d6e2,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sbufInit.0.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\355\n"
+	.string	"v\323IB0\211*\035\3006\317\236D\371\236\220\261\025\333p\373f\315\207\271DPghK](\220\365\212\320\307h\253\025(\rH0z;[f\300\332\322\326\205\250;  [\216\250\335\372=\005\"\354\266wJ\0014"
+	.string	"6"
+	.string	"7"
+	.string	"\003N"
+	.string	"\345\361\241\226\264\274\327\307\254\302n\355\\\217\241\234n\267PN'\311\307\313\321\277\354\0212\006+V\352\262R\261\273\226+V\353\236\267-a;\303\276E\257\377<\354\227\225\n\315b`\027\244va\033P\005/\333(\233\2639\004\261\b\030\005<YO\013.\266S.\200gy\330x\207]\227\200\004\2735\343\314vj\333\017\"\252\351\341\013\005:m\323\017L\230\323\3368\355\264\355\356\306\237up0<"
+	.string	"p\352\217\224\323\006\b!*Y\363E\202\203\225\026\354\232\222s\304\376d\247\313~\354\247\001\037\021h\212\245\321\264\347\373p<\316\304F\203\t\231<\244\211?M\310\344\001; \261D\352D!\b\206_'\322\350\200\335'\222:\r\204\303\021H\354Ja(v\\\335Ov\272\344\244\b\025"
+	.ascii	"Q\323\240L\350\f\003?\320@\3402\246<\200\275\2446\363m\326pa"
+	.ascii	"\354\324\214\324\214\215\300\b\030\007\206\201\340@5p\205P\343"
+	.ascii	"\202\237i:\355$\003"
+	.text
+	.section	.gnu.lto_sbufWriteU8.1.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"]\013"
+	.string	"\006\326OB kj:\300\022B\ta\361(\200.\030\202\347\031D\272@\200\tE\372\210\201\356(\320\256\214L\037\314\206\305*)\206\216!\230\005\b\233)\265\317}\320[zB&\302\370\302\372\263\036\244i\223\275S\n;"
+	.string	":"
+	.string	"="
+	.string	"\023\273\254\007\032vI\212)\332\253\311O\262W\355\222\354\325\242\355\241b@d,`!\304\356rt\301\305O\321\177\353\020T\252\364)\261\261\273\236\250\324\201\233\336\366\205\355\016\373\032\001'\377\354\343\217a\323\023\233\276\006A )w\r\224#\326U74\260}\373\023D{\263\267\225\205\316\267|\311\020O\216LwW\0318\264\327Me\371\274\004\037\302#\210\037I\017\257\024\257\004\223^\210t8\352\203\345\247\223\036\004\001\007\247Y\332\016_A\244\355.\306\247\020\002i\f^}R\366z\032y\215\246Yz\222\342\260S\204M\226&U`\037\333\3355e\331\001"
+	.string	"4!\352M\307\311\\2\030\230\312\344\023r\250\273\212\007h\343i:\340'\344<\237\347}\035\347\371\320x\\\007\206\\\305\302_\200\016\310}\276\017\3446r\217-eU\225\313DO\316\250\217A\300h\372\242,\017"
+	.ascii	"@\323\340L\350\030\003\333\240\267&5\262\250h \210\250\f\206"
+	.ascii	"*\307X\31515\326'\227ab\250\331\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_sbufWriteU16.2.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\267\002]\023"
+	.string	"V\"yH\3200'\035\337'?b$0\267\032P\355X\254\354w\256\026\325\220\246O\007\335\036\377\232`\203\250\361\034eK\035\274\276\310p:m\316T\003=]\370\024JL\033\355\246\221\250\fT\371\262do\323\326l[\332M\356\224\002_"
+	.string	"h"
+	.string	"a"
+	.string	"@4\273u\031[6\353\351\245\341G\324\236\203`\271\253AE\202y\271\021YM\257G\373!.\242v\234\314\003\354\362\2008\332\rC\0342/\035\276\303\273\234\027\340]\272f\303\360\220\340\322\325"
+	.ascii	"\321\330\335O{^{\254\371\377\371\312\006g\346Qe\262\273\2166"
+	.ascii	"8\025n\275m\002\266\027\330\212 \321sF\253\216\373\275\347\376"
+	.ascii	"\224\027\255\252\350\350E\037\300j\006G\213\335\233\250\032\233"
+	.ascii	"$Ot0\332\275H\366|\360\307L\2707\024@ND;\t\277\304\207$\207V"
+	.ascii	"\355\271\331\307\314\306\336^\354\2744^\310#\006h\317\315<\016"
+	.ascii	"\354\330\017J\355\205\215\215\260\3231\355\206 \227-\013\257"
+	.ascii	"\307\007\321\216\223\321\t\nb\340\230.\375>R\313\314\367"
+	.string	"\361A\357\222cI\207\245(@\227\213\3334\275\276R\226^\006\215\207\233Yn\002\234\273K\342\037\311b\276\217\214w\271R\327\022\356D?\301Q\032:\203'\026\327\013\335&\236>\350\037\266\350\344\224^_\003e\213Q\356\310Q\332\350d\207\267\250\033\354\247vw\255<\366\214f\315\350\325\f-(\017\324)0\225\222\221\222\002$\"\03510*j\230H\203YJ\feE\026\003\363\271\200\261\030\b\373\\\034\240\304>\230\f\346\023\031`\360eE\366\305\200\240\354k\205\266\247Vy,3$\331\364f\177\247\303\240/\034K:\272B\245\323\310,O\001N\225Q\221\352w\272\250:o$/\245QO\003u\323QZ\241\377\347'9I\266< \220\002\231\301:\007@dPzh\241)0\004\237\330'\366\271l\270\345\b\210<\256\253\035\311\303\346A^\232U\004\204\330\2271<\243\277\370\030~G\372\035N\265\370"
+	.string	"\262\306\201\037\027q\221ae\036:\022\352\fy3`\277\247\312\366}\353\205=\026\037F`(\340\264/\270\025\355"
+	.ascii	"\254\233Hp\344\201o\342,\\\3706$\253\027\177!\364U\333v\210\233"
+	.ascii	"%\3636X\337\215Zc|Gt\340\341E\333\311"
+	.text
+	.section	.gnu.lto_sbufWriteU32.3.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\372\0045\030"
+	.string	"\026\251\221J\260\022R:\313#\201\311$79\220<\232\007\177+\332QF\271_\001>iy\306\241\365\017\237\260\370J\276\366\317\322\225\320_\271\231\213\340\345\204k\376A/\3360\036x\036\345\214\235\024\234\304\210\351\250\312\227O\362\271\255\334)\005u"
+	.string	"|"
+	.string	"z"
+	.ascii	"\265\002QN\311\r\265\317/\351\376\303Y\f\bt\374p\234\372J:\233"
+	.ascii	"<e\221\266+Fm\002_b\367`\005\207\324\332a\352\300x:c\271\234"
+	.ascii	"j\237\366\217\216\264\373\017\347\261Z\201\214\206\265\002S\234"
+	.ascii	"2\236\032x\231x:\036\200x\352\235}\343\344\302kJG\251G\255\225"
+	.ascii	"\266\037\276\373\334\371Oz\310N\017\357\263\345Rk\365\334\351"
+	.ascii	"\321p\357m\017\260\235\300\246\274\323%\343tl\234\206\215\323"
+	.ascii	"$\343\364\3108-2N\277\306i\362\277\337\365\340?\212\323\255\326"
+	.ascii	"\264(N\323\3264K\234\336\326\364\024\247\037\200\344!sQ+O\220"
+	.ascii	"\037\225\212>\rIA=\212\016\025=\r\357D\205z4\t\277\202\n\025"
+	.ascii	"y\306\003V\236\f(O\241\273\t\377\304QP\020\344\356\301\233\031"
+	.ascii	"\017V}6~jt\236\311+\005t\017\336\234\030\370\261\277\304\252"
+	.ascii	"\034`\325\202p\nG+v/T1w7E\347j\274\243\304q\347nT\316\225\257"
+	.ascii	"\250\2522\375I\177!\242\352\3712\026\334\370A~)\236\232X\371"
+	.ascii	"\224,\214\362U\343;9j\217m\311~GN\b\237o\237*\307Z+\213\377\002"
+	.ascii	"\002\316\017\302\021Oc\373\262\372=\305_z\252P\\\001\220\031"
+	.ascii	"\3373\335.\256\375\322g\275\351\303\343~\257s\325\233A,#\252"
+	.ascii	"\252\323\207\r\364\315\365`\237U\027\310\036\003\021`(\254cl"
+	.ascii	"2-+-\004XTd652k\233J\203\t18\230\231\234M\r\215\246\304\341J"
+	.ascii	"\033\215\346\001\f\216f\313\325\320T\004\270\2240\223\243\331"
+	.ascii	"\224e\216F\002{g\325\0052%A\325[\237}\250\026H-\007\257\275A"
+	.ascii	"\356K\312\267\333 \245\242Z{\250\026\342\266N\304\243!\013#*"
+	.ascii	"3\2625Dv\344\311\267\323\020yr\242\373!\013\326R\030k\204P\205"
+	.ascii	"\210e`b\345\003\333*\222\2055\371v\252r$i\ne\250A`\305\020B$"
+	.ascii	"2\"R\220\202$\351\360\002\0211\252\016\022`\364%d\201\213\"\n"
+	.ascii	"\024\224Sh\377\036@P%\360.,\221\240\345\r\371!Z^\373T\257\004"
+	.ascii	"\2354o\277\211\300\362\b;\360Y\342\365\261I\225\225\330H\363"
+	.ascii	"\366\2641$\217\020\217\276D\246P\376\036\336\252\262\213\317"
+	.ascii	"\314\254\004\203\262\354\371'A\262hc\326\244o=#\226\003\326c"
+	.ascii	"\322gC\307l\273\021TEk(\270\347\334\334\212I\336\f\251\263e\026"
+	.ascii	"GZ\021\277\320|U\272K\302\3421\241\007kX\233\037%\\\212\030\337"
+	.ascii	"v\354\321>\326\224O\347\016\206\216\347\246\232\034\342\246>"
+	.ascii	"\320qIY>\326\037b\177\321\203T"
+	.text
+	.section	.gnu.lto_sbufWriteU16BigEndian.4.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\267\002u\023"
+	.string	"\346\342zH\340\360&\035\332\007?\252\377\206f\304\036\211\242\034\322\001Zh\021]\230K \211?\231\342\271}8\231H\260\035\365(\332\370\312\211|\272\312\026\251m\260^\310\007@f\177\0233\201\035\315!`\251^w\353\335h7\271S\n`"
+	.string	"j"
+	.string	"c"
+	.string	"~\020\315n]\306\226\315\032\361\322\360&j\317I\260\334\325 c\301\274\364\210,\017\257G\373$^\242v\\\315\005\354\372\350R\354\206$&\231\227\016\017\342]\316\017\360.]\263i\204Pp\355p\202p\354\356\247\034^{\254\371\007\372*g\307\346Q\225\262\273\2169;\027n\275m\003\266\033\330\252 \321\253\031=g\264\352\270\337{\356O\251\242U\025\035\275\350\007"
+	.string	"\240D`iW'*\3076\311\244\016H\272\037\311\020\",b\023\256\216\205\221\027\321~\302Gq\"\t\242U{n&b\343\261\267\031=/\215\037\262\t\002\332s\263\220\004=\366\205R\233\301c'\350vO\273\341\310e\013\303\353\361B\264\343j\264\002\003\033\270\247\313;\036\226\256"
+	.ascii	"]1\236S\343\365\225\262\3647n>\334\374\362$p\356\356\211\257"
+	.ascii	"B\026\363\177j\274\313\225\272v\270\027]e\307\351"
+	.string	"Dw\240\003\306F(G\375\320\235\342\351\205.b\213P\276F=\316\016[\214\362\274Yx)\275\376f\307-F\031d\311i#\224\035\336\242n\260\237\332\335\265\372\3303\2325\0030+\021\324,\260\026\024\023\224\003'% 43-jX\311\203\031Kl\305EF3\363\305\200\261\030\b\373b \254\304>\230l\346+)`P\306E\366\321\200\240\354k\205\266\247V},_4\331\364f_g\324Be>v<\352B\245\023\311/g\002\247\n\351H\365:\243\224\352\231\234v\350\007\272\312R\223\315W\202\231\371?>\350]~\004: \220\002\231\301\262\r@dPzh\241)0\004\237\330'\366i\331\214\226\003R\344u\335\333\221\003l\016\344\245\031E@\210}\031\343gD\374\035\211:\334j\361\001d\r\002\277\\\304)\303\316<\264\022\n\ry\013\370\002\274\037taO\304G\020.\2122\355\006nA;"
+	.ascii	"\353&,8\202\3007qv/<\r\311\326\213\253\020\372\252m;\304\315"
+	.ascii	"\222y\033\254\357F\2551\276#:\360\360\242\355d"
+	.text
+	.section	.gnu.lto_sbufWriteU32BigEndian.5.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\372\004U\030"
+	.string	"vi\222I\300\020)\035\233q\364O!\177\266\321\332\260\201\252\207Y\017\244\325\323&C\360\317\216H\204\262\261xe\273\237\255\323\275K\327Wn7\024~r\272\024M\222\346\277\342_\342=\332\"\024\324\220\357w\267\252j\277\022B6\221;\245w"
+	.string	"|"
+	.string	"z"
+	.ascii	"4j\005\232\234\2768\330>\177\264\373\317f3$\270\361\243q\352"
+	.ascii	"\033\355\354\327i\370\262]\036l\023x\022\274\023Y\360G\255\037"
+	.ascii	"`  Oi\241k\307\366i_\350C\274\377l>\253\365'\bU+\360\304'\344"
+	.ascii	"\251\201'\021O\311\003\020O\315\263e\224`\200\315\3101\302\252"
+	.ascii	"\265\3266\304y\237<\377E\377\320\341\271\371\034Yj\255\236:<"
+	.ascii	"\033\356\275m\002\266\025\330\364&&\247E\310\351\0319-#\247c"
+	.ascii	"\344t\b9\rBN\303\310\351\327\177\277\353D?9N\217\343\264(N\323"
+	.ascii	"q:\024\247w\234\236\342\364\005\304\250\002 \325\272\263\305"
+	.ascii	"\243V\321(\021TR\237\242\277\240(\250\233\240CXN\3017\321\241"
+	.ascii	" \323n\200uG\203\311\227v/\341#]\211\n\275x'\252\241\335\310"
+	.ascii	"\252/\206\217\215\316'9\305\300\356D5%\007|\354\037\205\265\203"
+	.ascii	"\254^\b\316\bM\341>\310\264\033\312\3667\254j\322_\364\026\033"
+	.ascii	"U=\177\005\203"
+	.string	"\032\037\310/\305\323\221\253\036\221UQ\302^\\\247\206\355\263\025\331\343\300\031\3413\356)J\262\326\252\342\243\210\220\363\201l\304\323\331\302\256~_z\013\217UU\372\202\036-\346>\351fq\355\217N\353\315,\177\347\236\344h\365\346\226K\356)\221\334\357N\341h\371\346\226IlX\325\231e\003}sA\330\017\353\3768\022\\*\254_n0+)+\005TPHhf`\3267\024\007\024^r.1:\232\231\232L\231\313\225\267\232\f\004\227\\\355\246\233\251\241\fp9!FW\243)K]\355\005\354=\254\373c\232U\325[\237}\251\023;\306\007\260\225\361Z\030\225q\217\361\242\232\032\367R'\310\035\3679Z=,\250'\035\"L\310^\201lH\224qw\001\022eB\334C=\321\025I\232#\310\204#l0r\325#\333\026\261\2259\031w\026%\031s\nd\250Ad\305\024\032\032\031II\nRH\007"
+	.string	"\003\021\261U\007\022`\344)d\211\212\"\n\024\224Sh\377\036@G%g/,\221\260\023\024\242j\006\237j\305\206?\335\217\361\2071\210\214"
+	.string	"z)\240,\235.\211\350\331\031my\355\355\223\227\335Q\224\305Y:%\221^\b}\353jWI\331G\254\r\351\363\356\250\024JL\320$\333\302#\366\001\217\203\377[\255\323\266-'\304\230\214hs\311\213\033[\177\240\260\224\341{\026G^\021\273\017\216\226\270\321\027\021 \023z0\rk\261\232DI\221\376\335\230\035"
+	.ascii	"\177\"\331@^\020\351\201\337B\236\213\304\234>\354N\274\3077"
+	.ascii	"\372#\233.\226\207\n"
+	.text
+	.section	.gnu.lto_sbufFill.6.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`0\001m\r"
+	.string	"6Z\\C\020\221\223\016\3638sU@o\t\210\263\217\371Gt\262\001,\205\205Vc\205<>$\360"
+	.string	"\306\330p\035\007-\253\023C+n%%"
+	.string	"\220\033\317E\240h\262F\017\304 \3045\036\004[$\322\310\336R\246\024F"
+	.string	"H"
+	.string	"F"
+	.string	"\361\212\341y\332\037q\022\336Q%\017\260{Zy\331\3758\346X\217\376\276\251\036\255\013\250\036\355\3311\036\022\260TJK\215\335\315\264\303\275\247\347\277\345\227I\245\364\314 \330]\247I\205\302\255\267]\3006\003\373!\002\377\376\314Y\376*\246cL\303\230VM'L\037\253.\274\360p\331\235\220\302\2610\221\305\212\355k\354\313\206GK\334\204w\026\267\360\265\273\301\305\313\356r\274\300z$"
+	.string	"\257\030\217\246\375q\300\373\027\301\272\233A\205\002\353\001P\261\017(\013\035yMU\265\271.o\262F\003\212\226lC8\n\022kwA|\227\221\221\005\342\321/\251\036U\001\310@e4+\275>%\207I\246\234'*\300\330\274a\177\245T\016\366\341\356\256\365d\037\365_\001!\320\210j$\355\003-\262}B>B\f\200t6\244\321G\275u\032\220\210p\032HD\032e\241\216\343\272-\0139\320\270l\023\215\262\316"
+	.string	"w\017@\242\214\324u\242L\363\355\341\352\311\t0\300\230\350\211\243\256\300<\3344\343\n5\352i\240\2108\311T\212\027"
+	.string	"@\323\240Lh\312\013\214\013\204p\337`0\324\034\030\306\036Z\026D>)N\334\213~J\326*\260\006\360\372paC0\263\0031\340D&\264"
+	.ascii	"B\341\016\327\360B\230d"
+	.text
+	.section	.gnu.lto_sbufWriteData.7.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`+\001M\r"
+	.string	"6\332[C\020\221\223\016sa\241%\004\235\215\300\313\301\253`\017\202\324G\266\307\344\277\3316"
+	.string	"\376\033k\277\037Y\374z\3364\217$\225\362\266\006\023"
+	.string	"\331|.\002+\337\202\036\210A\320o\203\025\321\334\221\354-eJ\001E"
+	.string	"G"
+	.string	"E"
+	.string	"\317\227\360WN\202\373\211\344\002vM+1\273\235\306\232x\350\356\036\325a\374\200\352\320\234\r\343\235\312\276e\002\n\212\306\356b\252\341\334\223\363\217\272UJ!=9\024\354\256\263\224R\341\326\333>`\333\201\375\016\001\034w\371!L?\230V\230\316\227\376U\201hA`\306.\205\224\215\225\201*<\330\276\375\027\316\276l\013\206\243y\224\317\362\026\356.^ak\027\303L\314\356j\334 \036\032x\026\013'\363&:\317\260`\020\017\255\021\234\332\261\241\372"
+	.string	" \257QSmm\313\227|]8Q\222m\tG1\022w\367\303?!\"\212\034\016}\222\35205\300\213\023\324\353Qn\224d\312\371b\301\305f\r\273#\245f\260\377vw\255&\373\335\037\177\372\003\240O\004\315F\231\3479\244\343\001A"
+	.string	"\222\340c\3431\022y\324\235\315\203\221\020-\373\204F\"\f\264i\332\326\301@\0202\r\353\204D\330\246\2007\221O\b\033m[\b\273\272\375[5-\b!S\242&~\n\323\241\362R\214\253\352\323\3138\021a\222\251\024\032\026"
+	.ascii	"@\323\340Lh\312\007F\\w`\357\033\f\206*\007\251\354\241eAd>\342"
+	.ascii	"\360\247\350\007d\255\002V\277.h\240\211(\bCT\016h7\206B\b\256"
+	.ascii	"\271\2050\237"
+	.text
+	.section	.gnu.lto_sbufWriteDataSafe.8.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\211\002M\025"
+	.string	"V\350\215J\300\360*\035\362-\235\204\267\205\270\2468v\013A$\342\237\317!\247\373\251tuF!RpLP\021\0253Q\377\363j\2339N.\301\357#\265\374\266\261\347Zf\221\b\305V\241r\216\242\306\247\256\356\003UY\331\020\331r\247\024w"
+	.string	"u"
+	.string	"|"
+	.string	"\265\326\0213 ?\212\320\325\205\330\226\236\001#\001\371qU\023\233\323>\320I\360\036|9\200Zu\202\210\265\226#\036!?\272|H\352#\371"
+	.ascii	"\251\217\266]b\302s\357%\217\315;d\230\021\026k-a\353\341\275"
+	.ascii	"\323\235=\037\346tk,\271x:\002Z\370\322\003\024\2128.`\f\375"
+	.ascii	"\200\232yq\341g\r\3607\247*\245\326\352I\003\274\271\307\333"
+	.ascii	"V`\333\201=\235\002\325\253c\323\351\327j\332EN\267^\376\036"
+	.ascii	"\037\372W\3444\371\340\257\3624%\247\227\234\236\252\351\203"
+	.ascii	"\230\224\305\032\003\236j\265\211\322Q\233\306\024>\376\360H"
+	.ascii	"\273\023\371G\013L\032Qke\335\250(\227\362\253P\351\021\206\025"
+	.ascii	"@\006>\322\022\261\324\274\321\356E9\001e\2759\216\017\021\250"
+	.ascii	"\370\321\r>\334\331\254\363l\226\275\332\020\243&.\304\373\220"
+	.ascii	"\231\274\252\225\003\0241=\301\024\021d~=\266\265\266\2146Oc"
+	.ascii	"\021\231\205\361j\377A\024\344\344'b0gw\307\257]\355L\210E\314"
+	.ascii	"\204\372\205'_\3744\341"
+	.string	"\240\341\332\327~fGk\311u\355\224!#\342W;\261\265\004z\034\341(X\310ZcN\374\023.\022|\020\271}\305\b\372f\224\217\364\005E\247zt\332\"\247xC\2657\272\210o\346\360\205\177\360\323\204\303F\2359\354\3627w\307>\255\265\006+\273\331\266\324&\254L'S\241\236\321TPJP\020\234\220\204\350r*k\032\311\312nf\223\325p\272\034\254\345f\263\335h\260\026\026\231\rF\303\345`$\005|s\251\341`\272\333\r\007c\225\276\323\272:N\271\3700L\232~/\245a\210\264\177/E\267\3066]\247\370\366G?\210\224vU\270xNc\343;ww2\311\204\370\315(\333\265/\335N|%\027\bd\255\365%\365q\256+. P\002!\222\2127@\032\004\017\315`\343\357\227\201\255\334\013B\033!\004\r,n\0324\035,\354v\333y\314Q\002\363\373\035\203$\347\"q8|\305\201"
+	.string	"\205\201\013\276a\b\021\201f\270\227\tu\263zm\227\312\016\310O\004\017\355$\024\224\213\013\323/mHY+AK"
+	.ascii	"\326\220\265\250\257a\021\017\227\214\327tO\022\216C+\247\350"
+	.ascii	"\n{"
+	.text
+	.section	.gnu.lto_sbufWriteString.9.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`m\002=\023"
+	.string	"\306\243|F\340\360h8\362\317\312C\261\302N\373"
+	.string	"\371K\032Y\301\005rc\003\254\324\017\352\215x9\f\303\230:\f\220@M%\252\030N>\303-\334\300C\275\004[ \216\377u\233\233\270v\nsRt\360\267\275\367\336R\246\024c"
+	.string	"h"
+	.string	"c"
+	.string	",\002\306\205\251\240\301\310F\351\237\2373\263O\377~\262\305\243T\216\026^(\020\377\2111RO\3736?A{\216\345"
+	.string	"verA\273\243\210E\304\177\036\017\002\376\023\037"
+	.ascii	"\374g\232=\343\343\314>\007\304\313\216\322\356\242\324\303i"
+	.ascii	"O\232\377\233\233n\270\226gh\262\273\316\033\016\346\326\333"
+	.ascii	".`\373\201\235F\0016\205i1L\207`\032|\356\377>\376\336\227N0"
+	.ascii	"}\017\020\t\306\200\335n\206\035\216%\372\204B\3709\007\232\035"
+	.ascii	"\307\337\271\317\177\030\264(\261\273'\332\372\254G\263?\251"
+	.ascii	"/\257\363Q<\305\354*<\344\215\213\273\213m \376\013\361h8)/\337"
+	.ascii	"\303c\0327\261@\274\216\211\r\303z\272\rG\006\376\231jR\317\353"
+	.ascii	"\314\236\013\352\003\255X\371\233O1.\332\342\0039\345B+\342\356"
+	.ascii	"\222\370+d*>\r\013\370/\324\017\031\271TP\177\240w\360p(\332"
+	.ascii	"\237C\030\021\264\224\224z\235\247\357\371\364:\017\251\345\r"
+	.ascii	"_SE^r\324r\347\216\364\324n\275\362\267\353q1\027\264\305\311"
+	.ascii	"S\243h\363\206=\332R;\330\367vw\2552v\230\001.\226\004U\311T"
+	.ascii	"(^\212K\005&\213\201>Y\241\224\034(A@2\002\"\213\241\250W#\021"
+	.ascii	"(\234\264T,\230,\206r\275Z\255\327\n\345RQ\265P+X\f5B\300\257"
+	.ascii	"\t,\030J\366z\301P\247\261voU\306\t\222\210jj\263\257\353\371"
+	.ascii	"o\356\240f\227\216L\312b\305c\3467$\025\325\244\267\341B\302"
+	.ascii	"\226\273!Q=>\344j\2713(\242\350#A\3654\f2 \240\002!1\255\003"
+	.ascii	"@\313\240\254\320\354R`\036\234M\374$g\033\304Nr\303\254Z\342"
+	.ascii	" \007\\$\303\005\306\264pD\271\225\2206\274\001\023\233\261\221"
+	.ascii	"\201\360 T\017\020\3149\343\361\352\013\350\032\311H\355\215"
+	.ascii	"\202\266\233K\r\345\313b\210\221L\262\354\263\034\3710\\\270"
+	.ascii	"\260\210;\b,\243\270\360\020\351\376\320+i\205\241\360\227\201"
+	.ascii	"8\263\341]^\264\213\f"
+	.text
+	.section	.gnu.lto_sbufWriteStringWithZeroTerminator.10.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\220\002%\024"
+	.string	"\366\345\203I\320\360(\035\017\252\2179\303\033\353\221\226\035a[\205\016\365!\231\237\f\372\221\004!\336u\330P\"s\241\217}\275\252*\377\315\265\035\243\242\277\300c\003u"
+	.string	"\200\312\013\200IV\t\250\0272\234cH\314\321\032i\204\020)S\nk"
+	.string	"m"
+	.string	"k"
+	.string	"<\332u, \345\214\271\300\241\350\306\350\241\277\243\331\344\303\223\366\330B\245%\006\020\217\351\262\323\260`|8\362TW\3737OQ\273\216\345\002\346\234)\372\231\263\024\261\310\370\320\345?\304\207\343\007\210\017]\263i\274\244\231\337\241\200\3211\232s\2466\304k\327\232\177\234\237p\271\226\253\311d\316i\305\345b\356\275m\003\266!\330K\0063\366\250&G5jT\237D\365x\335oz\371\213\241\0324\251\327\244VQ}"
+	.string	"bR\f\0022\346\334\360K\232C!\320\b\177w\237M\232\366\034_\347=\367i D\326f\317\004k\246\217*\324\367|\025_A;\013\277"
+	.ascii	"\313\231\273\320t0>\f\001k9*P\317\263\343\032?\301`<\317\344"
+	.ascii	"\226a\202\275\016A\007\036\236lT\327\0078\2232/\333\342\373\334"
+	.ascii	"\272\013\3308\347$\361\201VR\374\032\026\361\341i\003\314\320"
+	.ascii	"\201;\356}G\355| \272\317#\224\3709\302\001\356{\342\236\307"
+	.ascii	"\264\347=\304\246H\336\005W\004f\311\366\n\242\356\356_<\334"
+	.ascii	"\364\347\257n\250\004\263d\323\237I\025\327\236\340\322\343\276"
+	.ascii	"\317\311\270l\213u\007\211h*\222]\336tA\330\007\347\234\323\033"
+	.ascii	"\257\026\205]\315V(`\312K%6\223\211>a\241\224 (I@2\3621\223\241"
+	.ascii	"\254Y#\022,\234\270V\255\330L\226z\301\\.\030+\365RY\271R\254"
+	.ascii	"\230,5R\300\260\225V,5\203\301b)\262\264\035\234;c\005JC\266"
+	.ascii	"\275\331\357\361\3748\177`\363sd\203\334 X\007\315q7\306E-\271"
+	.ascii	"\317\361b\342\246?\030\250\355\020\241\263\351\317\"\t\017\035"
+	.ascii	"W\334\323\372\276\025K\0372 \200\002\2411\255\003@dPz\350\207"
+	.ascii	")0\t\316\023?\367Y\030\261\223\3340\353\226\270e\200a\017c\200"
+	.ascii	"8W\351\323\332\232L\263o\210\204\327\342\270\315\035D\177B\n"
+	.ascii	"\205\255\330\211G\202\305q\336X^rS\221\321\212GP\205\336e1\304"
+	.ascii	"\224L\264l\263\034}\030/\\h\304\035\004\226/.8D\252?\324JZ\302"
+	.ascii	"\274p\020g \304\271EK\237"
+	.text
+	.section	.gnu.lto_sbufReadU8.11.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\227"
+	.string	"\275\n"
+	.string	"\346TLB \213*\035\300\022\b\202A\003@`2PWU\311B\202"
+	.string	"\373T\265E\232\2239|\211\221\033E\r\017\335\321\2162\2070\317\332F\036`"
+	.string	"\205\r \314\316\226\334\303\260\021\204\335\230K\244mB\266L)8"
+	.string	"7"
+	.string	":"
+	.string	"\233\307_\3467\356\017\363\233mo,N\026?\276X\023\300\203\220\006\031v\307N\n\270x\025\375\313\256!0\231\260j\241\256\224\213\335\265\256Z#\267\274m\n\333\030\366%\002k\351\262\255\236\217\375\232T\253T\237B!\251"
+	.string	"\001a\2275\333\260\0246\t\006l\337\376x\262+6W@\243z\231\017{\202\323c\246;\354\272`\021vG\2141\334\003\337\246\274\005\221\022\225\f,\257\2570h~\251R/\200\034P\351\3146\351\013J\334\356r|\005\035\036\034\201o\276i~\273\264\f\210\245t\346\312\311\252\006{D\251\f`_\333\335\376x\031\235M\247\202\223\271x\241H\332\313h\220>\237\007\024\216D]\b\374>\320\353B\033\236\257\363BQ\227\2110\310\001\n\273\021\b\206]e\334k+]SN\244\244\312\276\203\017\221\363K3\r"
+	.ascii	"@\323\240Lh\030\003\333\277\370L]*\312\020X\026\225iP\245\033"
+	.ascii	"\253\345m\306b\206\313 \3235\311"
+	.text
+	.section	.gnu.lto_sbufReadU16.12.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\240\002\235\023"
+	.string	"V$}G\360\356&\035\302\026\317\234\274\377Cq\222\210\024\007\035BmG.x\304\021\301\315?\026\325\3377\377-\231\246m\345<\fa\240k\315\345\214\262\342\2608\211\222Z\331\335\021\021\341G\230\235<\324\307\241\3266!\204H\231Rg"
+	.string	"e"
+	.string	"m"
+	.string	"\262f\304>\3553\227\234ERF[\001cN\021\344\234M\244\2240\242\372\036\237\347)`.\276\034\300\2347<Es\212!\016\221\347,J\333\376\211\243\200\261KE\234\231\216V\223\3750\315)\202\034\367\350\316\351\003t\347\226\303]W\227\177\332\267\235\f,bh\"\\=\005sNk\f\215\205{o\273\200\355\005\366\022\bsolO\275\321\2515:\365\347\251S\235\032\365\331-7\265w\361\3578\365\306\251\227S\353\246>\207W\242\205"
+	.string	"\031s\312<9M$\316\350\303g\277}\242\241\355Yb\002y\220\375\331\345>\376\270:K;s\316\357\034\320\214\315\240b\264\232\364"
+	.ascii	"\344r\361\245\233A\311\300\202B\316\371?.\366wN}\037\230/(\242"
+	.ascii	"!\241\177\274D\370\244\270\036\373\354\007l^\332\364\323\376"
+	.ascii	"\n\243\016\222o\304\300\201\237\343\267\272s\033{\245\t\0304"
+	.ascii	"\266\250\325\201\363\230\030#\377Vc\365El\004\314\253\253h\311"
+	.ascii	"9'\211_\013Y~\316Kw\356\333\216\016</}\362\203\236\032/$}\374"
+	.ascii	")\2144.\272=\320?^\332d\017\204\216\032\222\2466\331\"Lw\203"
+	.ascii	"\375--*\341\032E\225Rb\240\004\001\211\210\207*l\255U\"+\020"
+	.ascii	"PV'*aK\013da\255V,\025\310\322\340d\005\252\302\026(2\300\254"
+	.ascii	"\007*!\330\302b\205\340'\276n\313M`\363Z\230u$\221$\367\263m"
+	.ascii	"\345\256\356\266\227\325l\354z\253\373\232\274\217\272\257\267"
+	.ascii	"\253\024sJ\355\367\262\031\276\220I\210\225\024jO\344\325\217"
+	.ascii	"L\374\3337 \220\242\241\253\036@6(\004\234as\re >\033c\245S\030"
+	.ascii	"k\244\370\316\357\024\306F\fG\001%\006)\b\013\266HC\362B+L\024"
+	.ascii	"\216\215\351\270\fv\031g\343^\215\036f\034\217\005\033\007~\270"
+	.ascii	"\210S\206\235y(%h\221\270\307\210dA\367w\372'6\203E\024X\305"
+	.ascii	"\347\331\032\214\365\211\021\254\270\271MD\242\214atO}\027\261"
+	.ascii	"\270H\310$\267\257]\243I1]\235\f"
+	.text
+	.section	.gnu.lto_sbufReadU32.13.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`t\004m\027"
+	.string	"\306i\221J\300\020)\035\362[w\360\241P\351\177d?T\313\354\007]\223\326d\350\037s\221\333\005L\204\211\377\273\017\321\367v\313\337X\350]\222\234\335\"b\001"
+	.string	"\200\360\026\266\371"
+	.string	"\356\215(hJ\306!\370\264\336\301\277\225|B\210\334)\005w"
+	.string	"x"
+	.string	"~"
+	.ascii	"6\254\032\036\320\310G\337\347\305v}\024\355\030\037h\327\352"
+	.ascii	"E\355?])cS\006\201*`\324z\212|\364I\271\202\252Qj\177\347<1?"
+	.ascii	"a\016\253\365fGX\3539\342\221\362\243\317\322\266/\342#b\254"
+	.ascii	"\023O\034\037\tl\232\361\241\252\365\244\315.#?\212\217\221\037"
+	.ascii	"w\303u\247:\377\300\213:\030Z\320\370dNW\bj\255\2464>\n\367\336"
+	.ascii	"6\001\333\tl\221*\032\354\213uol\221:D\244\226\221\324\261\221"
+	.ascii	"\372c\244\206\221\324\257\221\332\203\244\356\030\2519H\352\215"
+	.ascii	"\221\332\325b\225\377\335\253\237?)R\213\"\365\212\324T\244~"
+	.ascii	"\200\025\212\025\002d\324ZSE\243:\215H\036\376\373\355\017\205"
+	.ascii	"\3333EeT\264=S:CB\333#E%r \333\345\227\223\360\203\373AJ\247"
+	.ascii	"\326\352\372\370S{6\254\036\260\251\354P\243\364?/?a\310\246"
+	.ascii	"A'H\n^\036\373!\233OA\037#a\3531$\024\364\331.\351\251\356"
+	.string	"\177\237\305v\265/\232\251\261\243U?\360\237\020\034:\371&\026\334\374\034?G~\214\355\243\"\\\370X\246\034\b\316ib\324\016\333\217\245.z x6\257\224+k\255%~\022\016\202\237\003C~\204-\b\207\235\035\255\362\201\336\nZxz\360\227\020\364\261 \367?\237\355\350\f\257\2044\310\363T\351\f\373\344\321\r.+\270u\212M\305\244\200\211\201\022\022\231\r\327\262\266\2214\310\245\334PVp.-4\026\363v3m4\026\007(7\232\r\327B#\031`\363\301\n\216\346b\2328\232\353\334\335n\355\201\f\273\345\231\006O\264X+n\013@\310\212\033\033r\304\244\262\341\332\017m\036\352!\016[\327PxT\202\265\313z}\267cO\244\304\240\203cod\363N\313aTD\264T\322-+\224\367\022)[\272\007>\026\325\243\361Z\331\006Z\250Al\343H\221)\221\221\2224)t #\031\232\035\022"
+	.string	"\226!\"\275DT\312\333T\337\001@\245\212%\317\002\336\356XH4j\360\030\305\204\310\240\376\2270\202dU\270\231\254\215\2742\344:R\351I\026\"\264a\225I\326\bW\366\337`[\342u\312\365s\321\3243\006\264\376\3529Gl\256\221\355\253\b^\266G\365C\373\336\270\347\230Ye\004\215\b\257\324\177t\252\234\035\303>ux\360\taA\273;H\350\360\202L\347"
+	.ascii	"X\026\004\"\r4z\311\203\312+4\221j\n\n\246\304\f\030F\254jz\325"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_sbufReadData.14.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\313"
+	.string	"\325\013"
+	.string	"\366\227TA\020q\233\016s\371\334A6\270\312\240\301\0011\363/UO\023\n\263!\277\""
+	.string	"\227\001\336O\241\327u\347\032\230I0i\036\233\256*\237\025\345\327A\233\1774\377\273~"
+	.string	"\355\316\021\0305\332D\312\224\002?"
+	.string	"D"
+	.string	">"
+	.string	"\337\301\216o\354\206FHvC\213-\325\243\303W\246\307\352"
+	.string	"\246G\177\266\311C\016\373\020\027\037\"\031\273{\351\206\177\317\317\277\350\024\020\310\347I!\330]'\b\344\302\255\267]\300\366\002\373\n\002R\372\025\005C\305\200\321\256\205\023\032[\022Ox\260}\373%>\333\262\251\021\214\346E>\211\207|\0271\nSv3\230\220\354\256\305\t\252G\002\022\005b2?\"t\213\024\233\352\221\372\200y^\204\017\342!\002 [\030*\350\307\366v\023\021\252]\n\031\177\344uU\207G\277czL\r\300\002T\275\376\243\206G\2368G/Vl\316\260\303O\252\006\373\322\356\2565d?\374\247\203\177\274\310\2571\235\001\236\316\003\305<\214C2'\343\320\030\320\034\310\\*\031\327\251\263\013\003\t\034\r\353p^wy6M\333\262\313\323"
+	.string	"\323\256\214\353\256\213"
+	.string	"o\020:\334\345m\033wY\341^Z\rmb\224x\350\004[yM\235\324v\240\345\003\016"
+	.string	"@\323\340\314\320\\\003\033e\257\304X\246"
+	.ascii	"\333\247\313\0308\021\205f\210r\003\304\215\241\006\202;\267"
+	.ascii	"h\347\023"
+	.text
+	.section	.gnu.lto_sbufReadU8Safe.15.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`n\003}\031"
+	.string	"\266.\245F\260ZQcb\225`\301\360\024\211\240\211\271\240\361"
+	.string	"\224\0359\027\225\337\251\203\r\336\330a\314\3413&\264-\203\220\177\266\235\310\347\207\277\377\204\366\031\224Ov\202\317P-\270;$\365a\030\322v\215\220\275\345\2262\245\216"
+	.string	"\213"
+	.string	"\222"
+	.string	"I>vi\223*b\225\276g\362L\221\220\272%G\304(=\222?\344D|~\324\363"
+	.string	"\367\022\021Yr\257Ic\232\324\255\315\277\306\333\324\005\214\267\266\335\340\201\217s7s\244\370\215\250\022\276\341\275&\254\342x\356\243\025+\315\371\">>\370\004O>,\\\200\274\027\267..\212\002d(mq\361F\210\f\266\370\230\361\340\017\255\242\202\032TZ\270x$\304\327\225\033`\336;\r\342\355(%o\356\275\246@\274\0257y\3334\333\026\354:\024\225\310^Q\267(5KE]\246\250W\224Z\365\243\237\244\324\343\315\337\232\372"
+	.string	"*\b\207c\016\210\2717\305\031u\205\266\t\017?\311\231lW\362\225\220c\316\341Rj\307\222\355&O\b!\223\244\021\273\322\223\312[R(f?x\340\207\324\355A\006\261\234N\246\220\304f\227\377\355<\311?Ryg\220{oy\237\021\334\315\316\304\025\201C\302\005\267b/f\351};7\202#`\336\025\027\342\261d\b\315\255'\274\310\216]\336R?\365L\236\035J\317\200\034\367^\033\377\311M\3063\336\036\350)vUe\375\3301}\365s\241\344\242\220\273\024\374O\374\316\246\357"
+	.ascii	"\252!\254\265\310\013^V\234\"_~h\231\277\367T\026$!\224\323\252"
+	.ascii	"\226\365%\316\250\352XW\225\206!\001d"
+	.string	"7\273\023U-\240\3039o\242!u\357\217\215\317\344\266\3017\302\215\267c\005\340\345HGO\377\367\t\303\246{\344\242\025\033C2\266\336w\004:j\306\357\335\002\222\020\352\351R3\266\271\243\265\310~=\317\363t98\0162\0206\003\016\247\316j\266j\234\031\006\b\r 8\260\251y\335l\030\252g5\031p8:\262\234\332\315\006\353@\323\321\241\315`\0356\310t`\263\232\rVc\3004\01795\330\215F\253\301JSw\361V\242\bZP\374\230\250\237\033\207~A\373\347\306\327\240\352\033]\335\211\367\336;\262\2000l\253\372R<\\pu1z\351\210\341\002\2620T\030$U\304Z\344G9Yk, \257\251U\017\374\203WE!9A9\351.\205\303\005\337\310\357\031o[\365Z\202f\260\002C\2501\030\2061\210\030\231c\301(\321\302\322\001p\002\221\251[\017\020xG\323d\031\003@\377\211"
+	.ascii	"\364\016M\030y\367\027j\371:$\272\272o\251\325\304\330j\236v"
+	.ascii	"\363;\372\3447\fYA\227\241\304\241\306\210Q\333\233\016\316\247"
+	.ascii	"\351\210\302\\\373P\323\274\001b\260\267\352\n'C\326]\210\003"
+	.ascii	"P>N\207S@\364z$b\351\332F\212\311\030\344\310\201\222q\270.\337"
+	.ascii	"E@P-\037f\250\237\351\304\216\344\240oS\002\367Yh\"\263n5\306"
+	.ascii	"\025\2164\361\260[?\331\361\037"
+	.text
+	.section	.gnu.lto_sbufReadI8Safe.16.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`]\004\275\034"
+	.string	"\2663\265I\260\226Q:T \377u!\234^9\216Kd\002\313\f\266\r\017\250\260xf\030\346\2241\n\245\270\245\221\316\343\237\256\247dZ\2641\343Q\2333\303\203<%\353\336\332\330(\316S\352\377C\021\246y#\375m\311'\204\310\235R\236"
+	.string	"\242"
+	.string	"\236"
+	.string	"O\272\0318\253\n\0203\202H\304\"8\237H\217\r;Im \033f\227X\262=\177\226\334\230'K&2J\355#]\b\320\223B\\@\255FHQ\265\236\f\314\300<\351\3632\345I\363\003\312\223\266]\343"
+	.string	"\310\271\2378\210\336sQ\302G\254\365\214\355\215\347^\222\343\322\234\377\245\217@\216\254\204x\"^\0268\331\342\3438\340\305S\225\030\336\210qA\225\0360N\025DwL \303\t\213\030\036\211QF\212\215,\007\236\016\361v\224\266 \324ZM\205x*\356\326mo\260M\301\036W\004%\265\t\243n\275\250\313\222\232,\251\307\237\377>\351\247\001(\324U\357\305Z9+Q\021L\r\222R;\374\250_\325\256\304\267jm)\022\253L\035U\265\237?>E\347\247\250\236\204\346\031\021g%J\021C\366\251\027\361\245ZE2\373R\256q\200{\022\232Yy\264\234\246\024\207\236`F\325~\244\347M>\324\362\212ON;3\202\343\222\254E\377\324s\247\235\242\035Q\022\314\003q\037\342\0339\323\016\201\002Rk\205\375R\310\226\376w\376\334\307}7\b;\023ul::\221\024\234l\215\220\225\364>\\\276\360\340\215"
+	.ascii	"\216Z\253\215\037\305\307\302Oy\362B\\d'\327\364\261\273\372"
+	.ascii	"\353\327\302\352c\220ZE\365\237\370\025\205"
+	.string	"\327!$#\270\333\263\202\2676\207\b\226 \352\345\007\336\244\242\024\314\032\226\333\332\227\bC\356\270\345R-$~\354.\374\t\271\007\216\214\363&3\263\326 \033\237\211\217\216\237c\247<9n\200+I:Z\364\217\\\002\021\352c\024\032O\237\321\001\177\003Fx\246\217J'\261\313\356\177t\357\373\214\216~1\254F\245_\354sG\267g\177\213\305b\321kd\233\372\005\200\332\025:8\0168\037\310\f\270\234\235\331n\353\234\031\206\0075\017\032\330\320\310\360\3340\254g4\031p94\034\035\033\317-\326\241F\243\325f\261\016\032ph\261\231\355\026\243A\340\232\007\035[\214\247V\263\305`\247\356c]\243\033\254\241\037\022\362\317\225\007>\002\026\212\037\022\352\347\312\327\016\331~\355\214nw\366\177\276\177\351\346p\212F\326P7\326Zk\271=\322\265\276\020\204\314\221\213\230\246\025\316\322\302\004e\334\236/\345tm"
+	.string	"\232xB\327~\352\247\272\013\214\322\320\027\362T\360s\370\267\362\244k\2175\004\303\334_\005[\250q\034\2141f\210\246DJ\242T\206\003\200\002\031)S\307\020PfD\224\215\003@\256\0256\233D\370&\315\217?\016\326ky2\320\326\026\355\031\215\223w\272d\207\377\025\320w\275r\251Kq\230d\254\317m\276N6\024\231\344\330\350\332\036\"\223s\203\210\003\037\373\264\230(\264HC\234\301\006U\305\302\261\267\241\356cB\374k&k\023\203l\fA)\026mO6\245\267\345\031\203\252\314\bX\205\020BK*\222P\002\350"
+	.ascii	"\324 0\313\325w\322\030\3724c\372\315\0324p\007\30344{z\b\340"
+	.ascii	"\003H\223.{n\350\333\267\256\214;\030\210\303\245\037(!\254H"
+	.ascii	"\336\340\245\335G'\257Q\003"
+	.text
+	.section	.gnu.lto_sbufReadU16Safe.17.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\257\005M\""
+	.string	"\366{\323K\220\026R:\200\267H\207\306p\310\024\213h-\363\213}\245\302'p\256\306\201G5)\n\f\336\315b\362\235\363\033\353\243\203\276\275F\257\t\207\235"
+	.string	"\315$\022\3304\0223\001&\354D\"\211U\210;\224\267\322\370\366\177\020B\344N2\273"
+	.string	"\272"
+	.string	"\275"
+	.ascii	"\\\317{o\356YD\2109F\022\027UJ\241U\031x\212^\375R\373\254\241"
+	.ascii	"\023!\002X/\323\233p,\253\236O9\302\261\206\230sO\233\271\210"
+	.ascii	"9\307\254\332\370\365J$\006\301\366T\215\361\263\226\371U\017"
+	.ascii	"Rt+\020\237\271\027J\310\362\336\025\001#\260=\345\365=\365\251"
+	.ascii	"\355<\365)3s\002\006El\364\225\206\322\243^ e=\357]}=\343FWS"
+	.ascii	"\264\255\021_\304\325/O \355K\306\231\022\271\342\251\212\243"
+	.ascii	"(\257\005\022\263\035r\004z\300\214\207\213/\217l\243\005\306"
+	.ascii	"\232-v\310#\032\300\251\306\331\257n\223\220Fk_r\356\275lM \231"
+	.ascii	"\316/gf 3[`N\305\002\347\336\316r\315\3162og\231FgyFgY\006\306"
+	.ascii	"r\f\316\362\016\3062\f\316\262Ng9\227\263\214\303Y\276\335\352"
+	.ascii	"\177\301YV\277\376)[>\200^\025\214\246(\030}\266^\245.[\356X"
+	.ascii	"\332\205\343\314\237\371bM\372\312\312S\353a\302\177\361\227"
+	.ascii	"\264\016+`\277\307\245\333\021k\313y\003L\370\225H]\272)\031"
+	.ascii	"\2158\317\3447\201W\302\367\272\025\231T]\266\022\277\266\357"
+	.ascii	"\002~%\n\321\204\246R\375x\251\002\3711s\321\271\200\202j\254"
+	.ascii	"\023lI\200\271\247\266\024?\346o\361\225?\002<\022!\233\342z"
+	.ascii	"\227\0344=Y\202\355\251\214=O\325\0222\347\236\034\372\020~\221"
+	.ascii	"f\nv\355o\376(\222:\306\2127\353P\201?\305\347\240>\205\351\227"
+	.ascii	"%\271\320\365\303X\347R8\324\320\270\367\342\360\243\f/\020\251"
+	.ascii	"Oo\"\355\367[\353z\030\303\216K\252X\362\237H\"\243\200\275\344"
+	.ascii	"h\036\227t\"\273^\267\241\001Y\252u-\377\023J%d\017\323\362E"
+	.ascii	"\325\035\305\007\236k\036,'GV\313\177u\233\024/\247\232\023\327"
+	.ascii	"\271>\022\227[\253\215k{\345\370\303\250s(\267\026 \305\030\376"
+	.ascii	"$\203\355\336#\034\276\223\341\016\177\212\250>U;f\212U\321v"
+	.ascii	"\341'\037\341Iv\213\034}\362\364\314\222\366\263nS\264k\374\253"
+	.ascii	"S\360r\252\245]\273\306\274\032mG1\037\275\r\305|f?\304\016;"
+	.ascii	"\037\322\341O\2605\020y\272'(l\346\351\361i\220\240\301\002\234"
+	.ascii	"\233\336P\350\323\334s\243\201\310\003\264\363\023\034\n}\036"
+	.ascii	"\200@@\300\036\237\207\r;@\276\236\240\320w3\200\201A?A\337\020"
+	.ascii	"\b\f\372rk\361\350m\250\007e7\222\\\226\227\267N\311"
+	.string	"#\351o\244\276\223\232s\212mTu\312\260\264\327|,AB;\264\251\236\024\013e\223\205V\t)\364 \324\227\016bQ\321)\275\270\230\377\362\270\247\346Us\372 \353\365\2315\335\3435M\327\364\221R\3004o\246i\372[\266sS\225\351\231\356\262\343\226\230\226\3413\201\260\243\312cv}1\326\371\224[\357\304\2320\271\215M\362\370\362\021\262\035\317\274\202\247bw\250q(\007\2312\314\020M\320\322\026\246\003\200\002\221);n\021\260\251SfT\220\264\337\001@\252\212\f\0204\340\216\217;Xps\013\351\177\316 \322#\025\004\216m\343\260v\004\371\272-\217^\342\334\313\002\2527\263\262\002\021\277\267\337Q.\322\373_\343\263~5\345\032\246\214{\362d\371\203\203}F\331\007\366\337`\343\342\275O\253H\300\206\330\267\350\025c\371\276\327>\301\343\235\300H\251\231`\r\b%f\341\250\345\206G<\251T"
+	.string	"\266A\375\206\"\244"
+	.string	"\022O=s8\345\3737&K\214\243hz.\353U\272q\022\021@>\370VA~\221\222\272}"
+	.ascii	"+Xy\357W\006-\271\3655{n\272\244\b\013\037\317_\240\204\377\261"
+	.ascii	"\264\322\257y\216\370\253\261\201OuW\034@s|\255\234\030GW\301"
+	.ascii	"\323\361\200\210-V\376O\235<`\215\022\302\006\3355qi\367ir{j"
+	.text
+	.section	.gnu.lto_sbufReadI16Safe.18.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\025\t"
+	.string	"\266\021A:0\345(\035"
+	.string	"\316\031\n\350t.\231\006\226k9\0279\254\036\t\025\250\363\345d{\375\324\3006\200 A\f\373\314\245 \263"
+	.string	"\225\tf\273\035SB\306\021\031\221$r[\271S\n/"
+	.string	"1"
+	.string	"-"
+	.string	"\321\266=\n'\243>;X\177\205`\224\304v\247T\216\243\016Q\376I\216\001\361XY\265R\207\001\r\273k\270je\334z\333\007\266\037l\253\004\254"
+	.string	""
+	.string	"\226%\236|\330>\331\031;SutR\2448h\217\321\245\003\241}\221\217\234\016\253\370\300\256\013f\262;7\336h\217\236\327d\217\332\t\262\007j\341\f\252B\265M\023\360\253\250\f\032\027\232rfc\341\213=SP_\3661\273\273V\227m\350\370\371\353a?\314\004b-\b(\273\001\233\367\251C\233\350\343\371$,p4\245O\244\3368\020\246\020\007\032y\245O\222:\216\3536I\212"
+	.string	"qr\363>\311)p'1\362d\251\353<\231\231{G5P\005\n"
+	.ascii	"@\323\240\314\2000\314@\270$\\\263-&tP\b.\203\204\232h\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_sbufReadU32Safe.19.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\306\001=\021"
+	.string	"F!uF\360\356&\035\002\314\216\374\213\250\364\266\375\236~\267u\322\317L\347\205\3623\320`\374`\002?o\337\027\306m\304\275N\03276&hPs7f\\\244Z5\267)[c\214-\002\341\025\332\367EZ\220m{K\231R]"
+	.string	"`"
+	.string	"`"
+	.string	"\231\357\361y\036\342\345\264\n\017\260\233\323S\264\373}\370\203{\364\367\016\323#w\001\246G\333\026I\360b\330\277\r5\327\241\311\330n\273\237\247\032\016;\324\204\371\250\031\314!\227\341\n\017X\270\335"
+	.ascii	"\230\305\300\r%\231\243\327\23643Y\346\251dw\23533\233;\336\266"
+	.ascii	"\002\333\r\354\364\bi\356\264\377dJ\307\177?t:7\036\354\315\205"
+	.ascii	"\307\322n\315\222\214E\021I\354\370?\027r\271\217\037\2446G "
+	.ascii	"v\267\273\r\350U\"\303\260p\250\003\022\217\307#\254\205\304"
+	.ascii	"\274\315\345@\257\001\337\332\374f\247\210\347\366h\223\377\270"
+	.ascii	"\330\335\343}\237"
+	.string	"\027\273\263\343P\210\346k\037\205\022\f\270\307\330\023\022\257\235;2\332$$\rE\351efp\032UC\263\305\205\0172\b\037\301)\001\016^\371P\004n7f\304\0271a\345{x\231\036\243r\260\240\305r\311\027\272\311-\305\006\035\236\300\271\301\200z\333\r\3042\206_\273\003\243Mz\261\031\303\376d\251:\366\341\356\2565\307v\272\343\322\250SZ\303\024*\257\224\252Z.uJ\205B\"B\202`\004\244\243\305\205\242V\201\250\274R\253\223\224V\213\313ca\255V,\225\307\262r\262\362T-\227\007R\300,\t)-\257\205\305jy\335\027\273\346,PA$D\224>\314d\3554\225F]\022S\031\344H\250'\265U)\371\231N\243\302xE\021\rGU\307\037Gi\352\307DL*=  P\002!\262\316\007@\032\004\r\370=\243\273X}Cm\335\253\330B\016I\204\307D(:\2400P\301\033\206"
+	.ascii	"\021\350\f\324\265[l\227\312\216\301O\004\206\206\026\312\344"
+	.ascii	"\213\367\323\2070dk+\354%Y\\\243\256\0212\r\306\264\357\2431"
+	.ascii	"\204="
+	.text
+	.section	.gnu.lto_sbufReadI32Safe.20.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\r\t"
+	.string	"\266\321@:0\345(\035"
+	.string	"n801J\2360b\2415\302\3240\236<\317\301\362\312A3d\372\251\201m"
+	.string	"A\202\030\366\231KAf\001*\023\314v;\t&j\233\002\020\302\270\255\334)\005/"
+	.string	"1"
+	.string	","
+	.string	"\321\266=\b'\243>=Vw\245\\\230\300\354N\251\035G\035\242\374\227<\023\362\361\242b\245\016\003\026v\327P\305\302\270\365\266\rl7\330^\t\253"
+	.string	""
+	.string	"\266%\242\200\330>\331\232\0355::%T\030\262\307\230\321\201\320\376\310IN\177M\\`\267\365:\331\235\033o\262G\317k\260\307\354\003\330\003Za\f\252B\265M\021\360\252\250\n\033\026\232\262\306\2610\306\236)\250.\373\231\335]k\3136t\374\374\365\257\037b\232\210\313\206e7\233\367\251C\233\350\343\371\034$p4\245O\244\3368\016\246\020\007\032y\245O\222:\216\3536Iz"
+	.string	"qr\363>\311!p\0071\362d\251\353<\251\315\275\243\026P\004\n"
+	.ascii	"@\323\240\314\2000\314@\270$\\\263-&tP\b.\203\204\232h\272\346"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_sbufReadDataSafe.21.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`_\003\255\027"
+	.string	"\226\252\225I\300TU:\330<?\306\024\251\252\330V\277\023\325\023\337\241\013(\214"
+	.string	"\022!\230\215\372f\201\246\362\213\343\300%\273\213\327F\223 \212o\021laHP\362\305\305J\203\2043\265-p\333\300'\270\2229\035\021H#d\313\235R}"
+	.string	"\203"
+	.string	"\177"
+	.string	"\366\341R\255(~\276Z\253\212!\210\007O\224\016\251\2264QP\003\361 \025\242\232\323\276\316e\314\\G;\201Zoz\276ZI\025\253\210\007M>%<(\276@x\320\266W\030\314\270vR\205\210\343\004\325\354\224\265\222\251M\361\332\351\316\232\317\341t\215\224\020\031\342\341H|\251\202\016e\211"
+	.string	"8\032\212\262\244\246\310w>C\340ns\222\\j\255\236 p\271\033\274m\007\266%\330\233\023\272\237z\372"
+	.string	"*\f)\221\240v\265\212x\322\244\016\001\177^\370\276\367\220\361\330\\\222\362g\007\235\361#\373\016Z\211\027\276\b\242Of\217\367\231\375\206\217\343=\317\2619%9\265\326\261G+O\245,*\016\025\235\357\315(Yq\027Ry:\325\316\363f9\347q\271}\250\224\347\242\324Ip\220\004C5\347yf\327\321\f\2205\367\234\211R\247<\350\357f\366xp\3323\366hS#\025\245\361\0323\267\021(=>\204<\344\323\331\354\342\330\264\341\262j"
+	.ascii	"\321\314%\377\316\305\"@#~E\2455\355k\234\210\013ni'\221\207"
+	.ascii	"\0307\327\203\210{`\205-\034\310\005\261V\032\026\377\307\006"
+	.ascii	"\f~\013Zx\020\\\001Gt\266\371\304\357\361\007\245P\345q\032d"
+	.ascii	"S\036\321\375\317O\266\311\304\337\371\004\240\021?\243:\231"
+	.ascii	"\330\344m.\216}Z\367\306.M\217t\332$N\227H\323\342\311\237t\033"
+	.ascii	"\177H\232\006\03703\326\306\2702\354Jf\365B\315j\275\264\254"
+	.ascii	"\264,`A\245\264b\262u\013\0053c\275V\256\230\214,\025\003{\275"
+	.ascii	"`\255T\314\205\325+\325\212\311R(\004\206ip\305R20X,5\222\266"
+	.ascii	"\357\215C#D;\035\323\257\205'v=\373\327\302o\210\265\213mot\374"
+	.ascii	"!T{<\233_\321\2009\256\270\244\365}V\255y\020>yX\016\016w\274"
+	.ascii	"\317M\273#\241\232\343\024d\024\375\216\302}\217\264\347\375"
+	.ascii	"d\343\371)I\250a8\305\030R\312\fM\2324\205\346\006\200\242\221"
+	.ascii	"\262\335\020hW\333d\343@\257[\226\323}\246'c\245.\024\274fX\002"
+	.ascii	"\203\346 \022\250X\007\352\n\201\342\241oO/\242e\255\365`\374"
+	.ascii	"\347\302/\223K\303\001P\016\202\240\207\250T({o#?\34579\314l"
+	.ascii	"&?\301\033\24226\020?\335\306;\033\365\216\253G\346zm\230;\207"
+	.ascii	"\253Rg\375\301\252\237\2512\037\212\002\226\254p\312\177(o\003"
+	.ascii	"\354r\342 }c*\340\231\336x\344\300\307B\243\211\270\222\260\027"
+	.ascii	"\265\221\"a\324"
+	.text
+	.section	.gnu.lto_sbufBytesRemaining.22.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\231"
+	.string	"u\n"
+	.string	"FTI@0k\225\016\303\020\026\276\342\335\224\317\2315X\226\231a\310\310Kg\347h\251z<LH\370\r\013ak\244C\bG\330B&\r\005\262\242\302+\323\233\037\313\302\311\013\005m\002A\020!D\312\224\0026"
+	.string	"4"
+	.string	"7"
+	.string	"?p\004\240-\341\n\007\230\216b\221\032h\330\3358\271$;v=\";\246\002\016>A\377\253_\023R\027J\246\3203\222\261\273\316\222\t\300\255\267]a[\303>E\232\326Lg\246\037\331X\026\"\205\335\220\026\207\255\200EH\331\276}\005\240\275\331\327\312\342\371\225\257z\002\360!\350\020\273\247\007\020vC\212)\3321\207\232m\007W\325\314"
+	.string	"b`\344\335A\252\004\001\333\343\f:\332\356\207\305_\340\371h\005\216\371\240\354\330\365\001\203J\224-o\00167\330a(\025e\377Z=\331W:{\370c\001\316p\033\227\213\013\206\245\"\331|2j\256\262\371d:\214\346\363t\"\307\353:\217\213\034\016L\027\271\257\023+\023\366:4_\364x\336\027\267p\177\255\2362\235\210td\325LO\352\220\032\016"
+	.string	"@\323\240L\350\017\003s\277PR\205\007\327 *I\245\267N\032;\\\023\263\226\211"
+	.ascii	"\307\236T\323&a\222\001"
+	.text
+	.section	.gnu.lto_sbufPtr.23.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\345\b"
+	.string	"\266\220>90\217\323\001\260\\\204\005\032I\360F\2605[\r\256Rk\347\322\202\355\037\373\314\232\376(\374\233\304\t$\361\332=#\202H\006\003\"f\013`>\032\374D\033RQ#{\247\024+"
+	.string	"0"
+	.string	","
+	.string	"\026\254\227\335J]\237\311\216i'\310\216M\216\213\227\242\177\222_#H\n*e\272\004h\330]KTJu\317\333F\260\355`\033%W"
+	.string	"F\013\303\311\356E+fY\260\225\017\333%{\263\257\215\004)?\222>\260\273\nQ\331\255\032k\264c\266}\221\217\224,\026\324\016U\306j\005\363\3404+lK\334D\324vw\343\227PLh\036\307|\322\024p\031O\262\345-c%\214]Mrj\330\277v\256lK\317\217\277\f\356\274\007\216\002ga\303e>\243n\332\343>\243\356\353xBQ\210\202\300\357\003=\n\202\350|\324\013C\22430\030\341\t\251\b\004C\272\325\375\265s5\003\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufConstPtr.24.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\345\b"
+	.string	"\266\220>90\217\323\001\260\362\213\255\320\344\004\037\270\225\325\275\324Yd\310,\245\374\205\363\3347\370Q\3704\275\023H\342\265{F\004\221\f\006D\314\026\300|4\370\211v\331\372\326\366N),"
+	.string	"0"
+	.string	","
+	.string	"\252\223\230\335J]\277\321<\323^\240y6;~\272<\371'96\206\300\254X\250K"
+	.string	"\207\335\265\\\261Z\367\274\355\004\333\017\266Q\002\230\200FK\303\313n\306kfY2\025\020\333&{\2631\224\202\224\037K'\330u\255\244\354V\2169\3323\333\276\310GL>\031T\217V\200\n#\023!5-l\2137\231\320v/:~I\005\205\366\361\314/\315\001\2271%_\3366V\312\330\025%'\207}l\247\313\266\364\374\370\313\356<\b\317\202\207\241\303mBb7\355q!\261\373>\240\2204\242\"\360\373@\217\212\">\037\365\302\021\345\016\fJ\200BJ\002\301\220nu\217\355t\315\013"
+	.ascii	"@\323\240\314\320E\003\223\261\030.\013\330b\002pM\204\304\202"
+	.ascii	"\344!L\341gFS;\237"
+	.text
+	.section	.gnu.lto_sbufAdvance.25.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"U\013"
+	.string	"\346\025OA M5\0353\264$\004\"\f5\n\207@q\201\261t8E\bQ]\030\022\300\207)["
+	.string	"\205>\017\342k\214\030\355\221\314\002\204\n\341\b$\2175\331kG"
+	.string	"\352^E4\240\326i[\323&r\247\024:"
+	.string	"<"
+	.string	":"
+	.string	"(\n\255\335\221b\212\366\351\361\223\354S{F\366\351\320&\3611\265\327\300\240\304B\261\273\233>xx\031\372\307p\210\351$\272\264"
+	.string	"\260\273\226\246\323\202[o\233\303\366"
+	.string	"\373\001\002\342?UZ1i\251\322\327.\304\020\037%v\025\274T\254kz\220`\373\021[GX\344\370\013\341W\376`\310n\003\016\255\335\245X\200\366\271\201)\b\313\245\375\nW\205\027C\307\330\rzU}\202\t$\371r\246R\177\242\264\302\006\237\341\200\266\273\027\237\365\001i\021>\375P\366y\225@\020G\362e\331A%be\n{\024Iu`\037\333\335\265\242\354\257\376\354\001\033\004\035\020\263\206+\200\351\300x\\*\023\016H\243\346*\034\220\246\313l\276\017\270y\274\256\363\270\315\323\311t\033\367\201[E\303\236\201\315\267}<\357\333\"\343\036[E\231\200\005\327HIV\335 I\335d\"\021"
+	.ascii	"@\323\240L\350\020\007\306\005\202p\2712xk\016ChV\351\256\320"
+	.ascii	"f9uax\2061\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_sbufSwitchToReader.26.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\305\n"
+	.string	"\266SIA\020\347*\035"
+	.string	"\327\262\254\026\034\210\037\332}B\254t\207\245_oD\304\222\312\034\""
+	.string	"=\245\211\330\032\306\346LQV\t\375w\033\204\021"
+	.string	"\331\210d\242\255\245\215%R\021,\006P\357d\303n{\247\0242"
+	.string	"5"
+	.string	"8"
+	.string	"\334\251\353?\234S\356\013\234S\217\266\201\327\331\376\205\244\243%\301\356vS\344\343\345\350_\345\006\260\230\353\262#\261\273\226\260\330\307=o\273\3016\205\375\2102\373\365\247\247\375SJ\277\203\020`"
+	.string	"Dm\327\343\266`m\224\306\304\366=\366\254\"YY\265\t\356t\236\210.\355\243<e<\255u\205]Y\314\314n\005\031\024t\302$\214\200"
+	.string	"\370\264Ww9\230\035\001\354\200\235q\026\026\267\273#\177Ec\203+9\365[\234\323\317O\001\332K\336,ej\b\254T`W\227\234!\3667\273\273\236\001\246T\311\333\330\373,H\016\244\207Q\350sZy\323_\350\264\362\300\222IT\245:T\b\202\341\327\241.J`\367\211\251.\304\340\020\303$v\2520\024;O\335ov\312\\!\300\366\232\034\016\023"
+	.string	"@\323\240L\350\031\007\306\003\235\020\334\246\350"
+	.ascii	"\336*4CT\304C9\251tWS\263\234\2700\324\3020\240\020\\\006B\315"
+	.ascii	"\006wy\321N2"
+	.text
+	.section	.gnu.lto_sbufReadU32Safe.part.0.57.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`|\002e\024"
+	.string	"fe\204H\3200\25110\023\244\3368U\305\327|$\223\210\034\200 \020\215\301\007\247\220\314\204S\262\371Ox\004\215\220w\205\206B\376\227H\333~\004\322W\361h\244i:\n0x_\2041,\376\330Z\327w\301\310\357\270\245\2242\245l"
+	.string	"o"
+	.string	"n"
+	.string	"3\037po\220\316wo9r\353\021\361\326\345C\302[\361 \341\255\375\022.1\231\335l\273\304\204\346\332\313\020:\317!]\330M\335[\216\267\024\304k\267\225\316\260\346\323\334\036x\003RA\0313x8\236\327\211\203\313pZA|R\004=p\266\212 H\304\341\300\317\034\234\315\234\037\0179P\356\275\026{n\216\333\226`;\202=\217\002\255\377\276\363}\226E\313\276\317W\361&\332\235`D\232\233\330t\303\024\345\007\342-\253\036$|\217\374\t\237Gw\240\212\356\275gZ\222\241\330`\270\225'\024e$r[M\264\302y&\362K\262{\030\362\031M98\nr\372\273\231\275\362w4{uk;I\206\327\252\363JI20\030\314\256\233!P\336\235\233\325\265\350|\351\037\035\211v]J4l\323\206;z<1&\375\357\254\232I\345"
+	.ascii	"\363\324~\301\346q&=\356\307Fi|\340E\250\027\267\032RwRM\232"
+	.ascii	"3\r_/\r\262=]_\376t^\351?\200\003.\004|\270W\247\352\306\375"
+	.ascii	"\261\300\241\377\276\302~b\331J\b@BQFE\327vEl\223\366S\203\233"
+	.ascii	":\342\216\276\377\003z\345\331\235`\314\262\225\027w\263O\001"
+	.ascii	",\344\204\224\n\266\205T\241\256\230\214Z\305\265rRr\222@\001"
+	.ascii	"IH\214l\205\332E\322B\252\274RXb1\262\361\005\366z\301\\\343"
+	.ascii	"\213K\312kt\305d#I\001\303(\260\304\306\030\030,6\256^/\r\372"
+	.ascii	"\250\177-\2544\307v\245F\251\2416v\201N\317\322\245@\356\350"
+	.ascii	"u\2504G\375\026\026\\|\022!\"6\324\314*{\3644\320\317 \221\317"
+	.ascii	"\217\322\234\355\231\220\322X5 \200\")<;@\032|b\214i\t\374C\b"
+	.ascii	"`\022F\327\223G`F\307\"<\342> \255\312\305j\310+#\034b\330\220"
+	.ascii	"\370\3601\026D\343\t\355\033\201\237\346t<\366\220\335\305\277"
+	.ascii	"\r\342B\030K\006\352\273\374\2511\224\365\301b\274i\3727\206"
+	.ascii	"l\262\267\212~1\254\201\026>\2003\346.$\326\230/\034\0130\364"
+	.ascii	"\234\327Bu\230\265\201\004\313\275\337O[\343\336\025\306"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\203\002\265\b"
+	.string	"\342K-3`k\323\0300\f=\001$\310\272~A\240\b\242\312e\215g\203 \b\242\006\260\006\004A\020\004A\020x\323~\373\377\357&z\302zTjv\253[\022)\0039y`\353\261\256}!\224U\251V?\224\365L\250\205\3344\355\023\221\026CZ\310i\216\200thd\222\325\017\\\345\336Z\234U\274\321\270\305L\016\305\032\2358#1&\342\013\304\226\2071\207\257\206-\206\253\205+\n\023$<\260]\327u\bS\016\246:Q\32326\f\276\350<\341,Pp@\366\264Y\322,\311\f1\277\313"
+	.string	"\226#\354\275\206\254\025\3226\216\3143?6\215b\214\261:\241\314\334\003/ `\203\002Ia\007\254<\324\320\227\201\021\235\207\241\315\fc\311\343\363\340 \271B\330\234;d\330\353\341"
+	.ascii	"\202j\227\246J\302L\330\205\200\244\207o|\3037\276\341\033\277"
+	.ascii	"\361\r\370Fm\277\261\276\001\341\361\243\312*\217\341\033\337"
+	.ascii	"\360\215o\370\306o|\3037\276\341\033\277\361\r\370\341Zh\f"
+	.text
+	.section	.gnu.lto_.refs.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7ea4a4565685d6e2,"e",@progbits
+	.string	"(\265/\375`\266\035\225}"
+	.string	"\272\305\324+Q0P\322I\007\336\2646%\301\301\314\357]\315\f\023\355\231\214\362\251\316\n\n\200\371}\354\305\253\367h\321\350\201[\2436]K\033v\223*.\215-z\205ReQ\226C%\2668\017D\307\233\013a\216\246\005\211(C\205,\307\362z\250[#[\312\024M\002\260\002\274\002\254\205\363 \200\336K\304yE\301{\211\212\314$\230I\244H\250\264\324\206\351\231\307]\226!\221\272@\247N\271\216\261\360*\202\355n\221\261,\225\242\240\324\034n\224E\f\311\326\271++rW\346\206O4\3100\351\224\341\270\n\257\013p\334\331\n\313]H\264\336\265\261\006\323\312:\375\300!\206\315\244\236\027\030\332h\224\027\2402EM\363Bw\324)Ca7^Kp\224\363\033K\371\fs\275f3Z\374t\240uz"
+	.string	"\207\030\246\334T\317%\206E.\361\244\315\306H\313\016\307\332\200[\236\330\234\334dq\221-;]\023\301JX\334\006;=+U&\254\306+7\341\263\363\022F\273\210\365\336&\367\336s\2224.\303Q\346\334\333#\311\326\275\353Q\374:M\230\007.\263\353\220{{\354\300\251\273+\222\013\274w\025\321@\003\351\262,\317\3120=\t*_\0161\374\360\201z\016\324\237\315\312\204fU\376\346:\375\271\214\2230\231m\"A/\332\275kN\333\311!-;e%\034\306\353\b\036\373N\212[%\331Mr\357Z\274)s\244\f\231N_\201j\303\300\177\020D7\305[=\217\030r\224G\f\277r\210\241\312"
+	.string	"\fy\205\330\317a,h(\255\005\341DL\333\f>'\302\277\355f\376\216\013r\273`\311\317\026(\231\262\374\031\205$J\030l.\304\337\\Y"
+	.string	"\370\033\b'\245\256"
+	.string	"\335\346\357\033\023\320\374=C\001_B\r\203\213<\347o\027|\325\365\017\177\257\260\3021\201\377 \376\036\341g\256\254\243\001\024\374\334\024D\005\021: \022(\340\003\211\005\244\340\214P\340\177\001\\\3637"
+	.ascii	"-\210\177\317\374W\373\2376\3749\3723\326\317\320\237\235~V\376"
+	.ascii	"|\303\3173\374\034\303\317A?\377\374\354\363\363\005?\263\360"
+	.ascii	"s\n?\267\3709\204\237=\370\231\305\317\023\374\034\301\317(~"
+	.ascii	">\361\263\003?\227\370\331\200\237E\374\f\342\347\017?\343\374"
+	.ascii	"<\363s\372?\372\237\355\377\332\377\277\377|\377\201\376s\371"
+	.ascii	"\177\374\237\345\377\330\377\026\377\245\374\227\373\177\345"
+	.ascii	"\377\334\377)\377\333\376\223\375w\362\277\354\377\316\377\270"
+	.ascii	"\377#\242\321h\364\037\006\371;\372\007@&6\314\265\253R&\201"
+	.ascii	"\303LB\370\226ET6L\337e\324\236\342\241\247\316dA\265\024T\357"
+	.ascii	"\260KB\261w\213t\274w\260\232T\033V\247\0355\\\313[C\322i\347"
+	.ascii	"8_\r`\031h\340\234:\003g\303F?\243 \304\271i=\275\2374vbj\274"
+	.ascii	"u\3328\324:\036z(\351\264o0\031\r\233\324-\362\267\033O\300\344"
+	.ascii	"\336T\032\032MM\255\304\247\366X*K\023Si\252\234\316\274-\030"
+	.ascii	"\326\352\374\200\2504K\216\216Z\t\216\246\213\035\rh\322[i\246"
+	.ascii	"L \2261\2356\022\323\210\272\322\2332\234[\022\034\023\245\322"
+	.ascii	"\340\025\275\250k\250\367^{\357\016&[6K\256n\256\371\256!\024"
+	.ascii	"\"f\215\256\3236\232\361\312;\203\232K\305\270\236UKjM\215V6"
+	.ascii	"\215V6SU\336\253\374p\227za}D\267\035Ot\2356\363^\210Xs>\232"
+	.ascii	":m\"\036\244\301%\b%\023R\205\321c\353\364\275Tk\256\030\340"
+	.ascii	"0\334\3039\360\201\034U\327\273\264\243\265\364\f\274\317g\211"
+	.ascii	"\266\021\306\013L\231\235\024<hs\013\020\336\230\302\003I\247"
+	.ascii	"<\206\007k\262\326\250\301A\301\232-(\277\3015\"\216\345\230"
+	.ascii	")\2352\031>\323\321\024D\254S\026\223:9A\265:= \227Y\262$\200"
+	.ascii	"bq\352\337\377\360\0229\357\275M\302\365\266-m\316\302\033\266"
+	.ascii	"\214\300\377\364\336\377\326\352\336(\274\277a\225\251\247\277"
+	.ascii	">\340Zp\257\bM\346\2243\247iF\244\3149Z\247\230\232fSL9w%{\272"
+	.ascii	"f=\356m2\241\312&\272\353e\372p\231SL\352%\352k\256\327\231s"
+	.ascii	"W\"'\337)g\023\215H\231\3234\233R6\315\240L9\315u\212\3512\257"
+	.ascii	"Re\222\335\313\2042\345|\255S\267iF\304\364\241i\006U>\341\375"
+	.ascii	"8\0021\310\224\253k2\257\022\001_L\250\223\256\271B\271\355^"
+	.ascii	"%Z\321u\362z\357\324\275QP\022mL!\312\266%\235\022\361\311\\"
+	.ascii	"\225\274C\322\222\n:\263./]\263\013\032\243\350^\274\233\004"
+	.ascii	"\201\222\225\353\275\327\350.\225|o\321\352\274w\tm\341\t\345"
+	.ascii	",F\316{s\231DHK*\250M\321\022jt\273x0S\323\214\n\252\363\344"
+	.ascii	"\314l\353.W%o]\274)\247j\246\\o\323\357\246\007'w\201\200\177"
+	.ascii	"ZJZ\200\235\362\027\006\303\353\337\330\017\310\024%\020!*\r"
+	.ascii	"\304\277\365\361\245>\2068\001\353\224\365x\217\327\001\330\013"
+	.ascii	"\030\253%S\225\212\303\275<\300\220\243Q\036\240\013"
+	.string	"\227\"\230\215\252 \353\314\0232Ent\312[\030\357\234\027GsTv\313Nm\323\326\340\365qV\207\017\235\317\365\242\341@1J\213[\242>\007~\334\320\322\270-\202\262\303\307\224\230\372[\246\232\226\034[H\324\013\271T\213U\246\214Un\271\332\272\341\242\204\264e\357\255\322K\324\311o\260\323\216\362\340M\036\364H\032T\265O\304\210iA\n\226D\365\025\261\244\272H\221y\013\266`\337\032\327i\217\341A^\322\224\245gC\265`\374\356\327=\200\270W\315\b\311\206\257o\315\355\357\335C\207\261\202\303\b\251\3034\240\325A\311\037\333Z\264YZ\302\202\n\215\324\364\211\257\277\200\270\227\207\250\220\357\013t\251\357\375\205\313\310\376\360\224Q5%\322\245\275t\351\275\231\353\034\263\364\374\022\n\016a\222\244\367\336\373\233\205+\242\224j\264*=78=5]\273\273\353\274+7Qp=d\341\275\363l\240\354\375"
+	.ascii	"\354\264\267\264\2268UH\203\216\256\355\252\b\263TA{\202\345"
+	.ascii	"m7c\203\251E\244\323\256c\300\231\246\027X\027\023U\210\027\027"
+	.ascii	"\327sG\206R\324\230\240\344\336s)\017?-m\235\266\025\356#^\271"
+	.ascii	"\301\004\004L\035:I\221\322p:\226\236_\252\336\025Q\024\2257"
+	.ascii	"\234\210\256=\036\235\366\024\276\2023\205\365\025\207\245\016"
+	.ascii	"\231<\371\223\216\302\317k\357\236K\317/\376\203\203\272\353"
+	.ascii	"\264\243\250ZlhV\2356\024\276\303\241\242f\024\027\245\016\303"
+	.ascii	"4\351\266&\315F%h\303\245C\236\235\2237\333\314\327\026(f\247"
+	.ascii	"\275\306e5lQnL\322$\225\b\304\254\231\230\265\232\252\344[z\006"
+	.ascii	"\342\350M\325\201I{\253\325\344\335-\221\351\264\317\032M\355"
+	.ascii	"\332:\202k\264^B\203\304\213\016j-\362\3319\201u\332<|/\255\241"
+	.ascii	"\324\341(\275\352\2254\231\222\036\033\336\313+t\311y\237\316"
+	.ascii	"\022\302\255\260&\013\3531U\351#\254\243\264A\331[\337c8tqR\\"
+	.ascii	":m1\246B\024\003lj\352So\341T\342\333\221#\r&\267\225\346P\022"
+	.ascii	"\326\207\344\r6\005\013-\360\311\232J\034S\244\277\212\264\221"
+	.ascii	"\262\265\342]\223\0240^o#s7[=\2608\031SU\251!\3355\244\271\372"
+	.ascii	"B\357\335\"\236Q\241\365\341\360Qm\201\022ys1\231S^\322\217\026"
+	.ascii	"w\\\256x\251*\022\255ku\226z\301\322\261'\252(6"
+	.string	"T5\356\352\252\263\312\204,=\003g\232zVlA\336Y8FBj\334u\332X6L\374\354\302t)\032!s\244\245\323[\246\252\n6\264\241m\305T9\226\236\2017a\304\352\326\250\336V]\245\352!\301\302\324iWu\373\350\037\357\252\356\021F\344\f\031\351\321\b\204L\016\rk\220\341\023d\f\202q\3741\276\230\001\344s\3749\201\034\232qB"
+	.string	" \240\031\307\243\320\221\230ta\264\341gh8\203\0202FR\350H|\241\307\b\224&\215CA\306\240!\322(\324\"\206O\362g\206\022|\216=2\274\270\240\006\231\024!9t\024\302"
+	.string	"\231\024\201\b\343\370c$a\310\230\254\201\005\210\017;(:\340\3211\241\330\001\016\216M\361\001\023Id\217\f\023\002\354\240\340\321\251Qa\302\213\036#\t4H\241d\317\361'\bil!\2044\252\020#\371s\002\t\030\307\037d\262\204\"\220\220\020\013\027B\343\013=%\344\364${2\270\001\002\372\331@\335Aq\354\371yq\324"
+	.string	"\306\017\013\036\235\020;(xtlT\230`L\376 O\250\271O\362\347\330\201z\237\037\244\361h\204\241\036\002\036\007xT\320@\274\212\025\017\254x`x\025+ttV\360\350\250\347\321\261DdO\f\237t\230t\301\243\263\203BM>\206\001\027\222aD\236H\n\t!O\324\2748\032\355\220\213\027f\27004D&e\330\244\013\025\311\343\317\f\342]\360y\021\301N\004\020\360\230\bq\t$\300\340"
+	.string	"\023@\340@\3651\361\302\f\027\202z\214\310\344\320\211\243PP\220\220\317\211\343OO\320\t\037\344\320\t\023#\326\006K\265\364A\261V\263"
+	.ascii	"\236F\224\302z\354\332\004\351S\213b\2254\234\325r\373CZ\327"
+	.ascii	"\232\266\035i6:\265G8\032\025<Rl\232A\301,\222\333#o\001\211"
+	.ascii	"\ni\230Z/\233\203\340\275D\326\253\355\2275r\353\365\"\021\357"
+	.ascii	"\253I4,b\261\332\226\304\316\270n\273\212`p\360\310\321\251\035"
+	.ascii	"b\211\030\331R\313[\277\347\205K\017JX\247V\313n\025\255\266"
+	.ascii	"\322\334\316\367>g1\260+\220\213\020(Q\t\214L\225\315\262N8t"
+	.ascii	"bQ S\267Uv\312bY0\352\023\252\374B\301[\340\315\032\324\021\350"
+	.ascii	"\217[\254\333\253\235\024\366\350F\351m*L\247\026\210\225\365"
+	.ascii	"Q\023\366Vd\327\251\355q\313\254R\242\303B\365%\b\216+2\352\205"
+	.ascii	"\177j\347\335\270}\272a\241E\244{\221\256e\336\035q[8G|S>\240"
+	.ascii	"n\241\267R\307\252\263\263N\355\216['\020\277\263\246\016\353"
+	.ascii	"\034\242\327\244L\2476\312\001\035cx\b\346\270\025\226\254\""
+	.ascii	"\235\266\335!\tJ\021\035\235\332\347\371n\232\214YE\341\330S"
+	.ascii	"m\022\003\313[#\273\264NV\213\315U\222\335%\"\033\025/V\002o"
+	.ascii	"\363Y\242f\354h\254N\351\326\351\266i'\305\367\276\274\264\020"
+	.ascii	"uj\231n\235O9(}K\326\311\345\303\314\210\023\365\016\250d8\230"
+	.ascii	"\230:\265I\337\353\256=\244/\235Z\244\277\331<\267\004\376\260"
+	.ascii	"\001\202\220\250R\3114\210\024\0212#&\"2\222$I\007B\013\020\206"
+	.ascii	"\"i\230\327\262\003\022`\005-\023*\345\214\020\215HQJ\331Z\003"
+	.ascii	"oH#\322\202\303\203\223\367\206\006\025\300\314\001\310q\266"
+	.ascii	"h\330\373\371\232\033\034\237\t\017\013\260\304#\241\211\021"
+	.ascii	"\222\"L--d\032\257{\022s\351o&\3743K\370\205A#\0275\033H$\326"
+	.ascii	"\317\257y.\325\347\201\360\205'\215G\301I\236\350AG\214W]\241"
+	.ascii	";\006\303+\306\374\334f\256GB4 \340\333a\372^\3762\355\357\265"
+	.ascii	"h\331\354\201"
+	.string	"\254K\024\207\272#O\nE\223V\026:\241yy\374\216\f1k\242\177\253!\336Wic\352\244\275\237\027e!|\214\236/\212\271e*\356QJ\017w\351\375\356\214@\274]\275\001Mk\b\224\241\177#\265\341=\255\n\271H\316\246\3213\236\210\3337\2461Adf\213a\376\027\357\f\027\020\206*\235*\264\254/\303\272\220&Wb\265\352 \rl\255\352\337:\225\327^O\310\235.\020}\314\222\250\214\037B\374\007\247\274\346\003\242\355\027\235\220\251\376\305V@S\364\f\265xc\331\251!\307\342\360z^(\257Z\360\304\210\301\304\211\343\201eT+:\350\356U\177\017\351x\025\370FB\002\323\367\337\304>}\301\237\217\310r\361\245z\0203\327e\304\303\0379\313\277`\311\307-\016\332*\017\013\353@\"w\374\247\234\276\t\266\221`>\225M\320\246\213\231\242j8\350\247\032\t\253iN\345\004QuX\260\031"
+	.ascii	"D\324Z/\3766\376\234\240\323\003`\004$c\213\017\032\3251\325"
+	.ascii	"\355\305x\313\2470$\ro!\342\216\331\311\302\312\316@\255\334"
+	.ascii	"|\250\n\213) \365\261Q\\!Y\004E\324\242\024I\376\351\266j\231"
+	.ascii	"\242\256\356\336\206\350\377\307\352\017\240P\237\256c\006\365"
+	.ascii	"\361v\b/\032\223\344\242\375\244\274\250e0-V\267\244=\264D\036"
+	.ascii	"\217(\262\2112\356P\240\306\t2Y\360\255\266\206\324\320\317e"
+	.ascii	"\210R\262\253\327\220\271<\362\3441$\\\305I\307\0323k \355\330"
+	.ascii	"\364\225\340Y\224\243\b\312\350\334n\255\233\013)w\366\353\213"
+	.ascii	"\267`\2020[v\005\245\301\227\016\210{\205t2\365\244\356)\224"
+	.ascii	"\253T}\345\336\264\364G\201\263`\272S\315\212\317"
+	.string	"\340\356\257\364u\361\341\267\335a\321 \021\257R\2660\333\344\204\360bGiK\341\037\021SE\2628=ec\263\257c\253|\310:\313\277\3357 \331\262a\343\262\270I\332@\224\037\275J[\276hJ\r\2367\022\345\333\334\374ir\221\271\177\3560\221~\026\024\237\200\251\031\033\b\371~\244C\262\257\265D\232\"u\036|\215\216\267\002\177\230\302\307\371\250\231\035\032\022\217\334\263@\331\tu\250\251pb\242\023\344+\303A\313\375.\277\0214_\2023D\353\200\236\215\244u(io\355\236d\232\374\330\257\266\362\327\251\006\037Q\366\325}$\003&#)\330\346y\201\023\247\034\bv+\221\334\212s%=`\2607(9\t~\252\254\360\306-w\227\002\331i+\236\275\335!\254\310\353\271Y\364evk\0032\320U\f\002\244\316U\325\310\223!\264\254\323%\343\001\311Q\244\022Tk*v\177-\004\267\351\005\034K"
+	.string	"\252R(\267Kg\274\222\302?\331\270p\312\327\2708\233\376Kr\244\370}\274\316\312Q\277\235\230\366\332w\013\217\006\327\351\256\306j\377\006\320/+K\021\331\177J\257\264\231\313\224\265\367\254\314v\334\335v\264e\313\333\240\361\030\313=\341\367\351\243\227\273\324\341\r5\314\027X\311\375xf(\323\300\366\216\215\003\341\034R\327\240\376\202\336R\345\212\336q\377\242\315\262\216\205\363\242\333\222\206o\311\177\302y\261\376C\225\264.\226O\316\037\221\317\323\353\325w\270[\226u\361S?\037\303o\r\371\371\275\302\355\023}\224\234w\237=\217NX\320\367\253\337\303nN(\277\222\024/a\302tf\006=\357\320\2630\013\301\227"
+	.string	"N\377\007\324+\310\310n\263<\353\265#\352\036\316\315\311_\370\021m\216Y\350\237h\273x\3049:\374\230\307{\314\377\210\017\326.\346\311`\016\347#\371/\254o\005\362D\215N\336\224\306"
+	.ascii	"\370b\351\220\262\245u\327\020\372aL\347\323\177\002\343\nR\\"
+	.ascii	"\017\324\237\216}\005\274\247\020\235\347b\345q\341\2676N\345"
+	.ascii	"\257'\203\025\264\227\344Sp\362\016\324{\017\346\361"
+	.ascii	"\365\363Y\f\234\\\236>\367\2543\323\227\263\310Gz\233\303tr\361"
+	.ascii	"~\322O\354\260\025"
+	.text
+	.section	.gnu.lto_.symtab.7ea4a4565685d6e2,"e",@progbits
+	.string	"sbufInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"sbufWriteU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\001"
+	.string	""
+	.string	"sbufWriteU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"sbufWriteU16BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"sbufWriteU32BigEndian"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\001"
+	.string	""
+	.string	"sbufFill"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"sbufWriteDataSafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.string	"sbufWriteString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"sbufWriteStringWithZeroTerminator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"sbufReadU8"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\001"
+	.string	""
+	.string	"sbufReadU16"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"sbufReadU32"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"sbufReadData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\001"
+	.string	""
+	.string	"sbufReadU8Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"sbufReadI8Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"sbufReadU16Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"sbufReadI16Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\001"
+	.string	""
+	.string	"sbufReadU32Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"sbufReadI32Safe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"sbufReadDataSafe"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"sbufPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"sbufConstPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\001"
+	.string	""
+	.string	"sbufAdvance"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"sbufSwitchToReader"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7ea4a4565685d6e2,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
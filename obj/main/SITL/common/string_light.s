@@ -0,0 +1,4688 @@
+	.file	"string_light.c"
+	.file 1 "./src/main/common/string_light.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	string_light.c.555d1700
+	.weak	string_light.c.555d1700
+string_light.c.555d1700:
+	.long	0x15b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x8
+	.long	.LASF709
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x3a
+	.long	0x81
+	.long	0x81
+	.uleb128 0x1
+	.string	"s1"
+	.byte	0x3a
+	.byte	0x21
+	.long	0x8d
+	.uleb128 0x1
+	.string	"s2"
+	.byte	0x3a
+	.byte	0x32
+	.long	0x8d
+	.uleb128 0x1
+	.string	"n"
+	.byte	0x3a
+	.byte	0x3a
+	.long	0x81
+	.uleb128 0x5
+	.long	.LASF698
+	.byte	0x3c
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF699
+	.byte	0x3d
+	.long	0x9d
+	.uleb128 0x3
+	.string	"d"
+	.byte	0x3f
+	.byte	0x9
+	.long	0x81
+	.uleb128 0x9
+	.uleb128 0x3
+	.string	"c1"
+	.byte	0x42
+	.byte	0x13
+	.long	0x88
+	.uleb128 0x3
+	.string	"c2"
+	.byte	0x43
+	.byte	0x13
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	0x81
+	.uleb128 0x6
+	.long	0x98
+	.uleb128 0x7
+	.byte	0x6
+	.long	.LASF700
+	.uleb128 0x4
+	.long	0x92
+	.uleb128 0x6
+	.long	0xa8
+	.uleb128 0x7
+	.byte	0x8
+	.long	.LASF701
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x2
+	.long	.LASF703
+	.byte	0x35
+	.long	0x81
+	.long	0xd0
+	.uleb128 0x1
+	.string	"s1"
+	.byte	0x35
+	.byte	0x20
+	.long	0x8d
+	.uleb128 0x1
+	.string	"s2"
+	.byte	0x35
+	.byte	0x31
+	.long	0x8d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF704
+	.byte	0x30
+	.long	0x81
+	.long	0xe8
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x30
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF705
+	.byte	0x2b
+	.long	0x81
+	.long	0x100
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x2b
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF706
+	.byte	0x26
+	.long	0x81
+	.long	0x118
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x26
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF707
+	.byte	0x21
+	.long	0x81
+	.long	0x130
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x21
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF708
+	.byte	0x1c
+	.long	0x81
+	.long	0x148
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x1c
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF710
+	.byte	0x1
+	.byte	0x17
+	.byte	0x5
+	.long	0x81
+	.uleb128 0x1
+	.string	"c"
+	.byte	0x17
+	.byte	0x14
+	.long	0x81
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF393
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF394
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x3
+	.file 5 "/usr/include/limits.h"
+	.byte	0x3
+	.uleb128 0xcb
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF397
+	.file 7 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 8 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x8
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF451
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 11 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF542
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h"
+	.byte	0x3
+	.uleb128 0xc3
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF569
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/local_lim.h"
+	.byte	0x3
+	.uleb128 0xa1
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.file 17 "/usr/include/linux/limits.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h"
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF640
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h"
+	.byte	0x3
+	.uleb128 0xc7
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0x8
+	.long	.LASF660
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 21 "./src/main/common/string_light.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x4
+	.file 22 "./src/main/common/typeconversion.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF697
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.23.3c23ae3e8f372a0298be6ce978307bc7,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF429
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF444
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF434
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF462
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF521
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.32.6a1c51cbc8834927c9b529a347d7b23f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix1_lim.h.32.a7cb894e219b90f9f73cd9217f417c40,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.25.97ee4129efb08ad296101237bcd3401b,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.3.0a3ae0fffe30e22dfdd77ac2c1b1fbdd,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.42.a403368f4a1bbbff510e22bd9037c5aa,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x2a
+	.long	.LASF618
+	.byte	0x6
+	.uleb128 0x2b
+	.long	.LASF619
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF620
+	.byte	0x6
+	.uleb128 0x30
+	.long	.LASF621
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF622
+	.byte	0x6
+	.uleb128 0x35
+	.long	.LASF623
+	.byte	0x6
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x6
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF630
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.local_lim.h.84.535be492ad9773d11e46b49da2c4d18d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.posix2_lim.h.23.56b9c4f885cbac0b652f53ee56b244b1,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.limits.h.60.7bfe30ae3ff4e90f07238e284348f8e7,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF661
+	.byte	0x6
+	.uleb128 0x3f
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF663
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF665
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF667
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF669
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF671
+	.byte	0x6
+	.uleb128 0x62
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF673
+	.byte	0x6
+	.uleb128 0x67
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF675
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF677
+	.byte	0x6
+	.uleb128 0x6d
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF679
+	.byte	0x6
+	.uleb128 0x75
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF681
+	.byte	0x6
+	.uleb128 0x77
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF683
+	.byte	0x6
+	.uleb128 0x7b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF685
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF687
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF689
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF691
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF693
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF567
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF711
+	.long	.LASF712
+	.long	.LASF713
+	.long	.LASF714
+	.long	.LASF715
+	.long	.LASF716
+	.long	.LASF717
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x17
+	.long	.LASF0
+	.byte	0
+	.long	.LASF718
+	.byte	0x1
+	.long	.LASF719
+	.byte	0x6
+	.long	.LASF720
+	.byte	0x7
+	.long	.LASF721
+	.byte	0x7
+	.long	.LASF720
+	.byte	0x6
+	.long	.LASF722
+	.byte	0x3
+	.long	.LASF723
+	.byte	0x6
+	.long	.LASF724
+	.byte	0x6
+	.long	.LASF725
+	.byte	0x3
+	.long	.LASF726
+	.byte	0x3
+	.long	.LASF727
+	.byte	0x5
+	.long	.LASF728
+	.byte	0x3
+	.long	.LASF729
+	.byte	0x4
+	.long	.LASF730
+	.byte	0x4
+	.long	.LASF731
+	.byte	0x3
+	.long	.LASF732
+	.byte	0x3
+	.long	.LASF720
+	.byte	0x2
+	.long	.LASF733
+	.byte	0x3
+	.long	.LASF734
+	.byte	0x3
+	.long	.LASF735
+	.byte	0x3
+	.long	.LASF736
+	.byte	0x1
+	.long	.LASF737
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF574:
+	.string	"_POSIX_DELAYTIMER_MAX 32"
+.LASF620:
+	.string	"LINK_MAX"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF397:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF568:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1)"
+.LASF486:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF623:
+	.string	"__undef_OPEN_MAX"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF674:
+	.string	"SHRT_MIN"
+.LASF660:
+	.string	"_GCC_NEXT_LIMITS_H"
+.LASF512:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF652:
+	.string	"BC_DIM_MAX _POSIX2_BC_DIM_MAX"
+.LASF691:
+	.string	"ULONG_MAX (LONG_MAX * 2UL + 1UL)"
+.LASF493:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF600:
+	.string	"__undef_NR_OPEN "
+.LASF462:
+	.string	"_SYS_CDEFS_H 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF519:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF427:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF383:
+	.string	"SITL 1"
+.LASF497:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF424:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF415:
+	.string	"__USE_LARGEFILE64"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF526:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF461:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF614:
+	.string	"XATTR_NAME_MAX 255"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF436:
+	.string	"_POSIX_SOURCE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF634:
+	.string	"DELAYTIMER_MAX 2147483647"
+.LASF658:
+	.string	"CHARCLASS_NAME_MAX 2048"
+.LASF484:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF402:
+	.string	"__USE_ISOCXX11"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF457:
+	.string	"__GNU_LIBRARY__"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF443:
+	.string	"__USE_POSIX199506 1"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF545:
+	.string	"__stub_fchflags "
+.LASF538:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF710:
+	.string	"sl_isalnum"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF482:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF441:
+	.string	"__USE_POSIX2 1"
+.LASF434:
+	.string	"__USE_ISOC95 1"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF549:
+	.string	"__stub_sigreturn "
+.LASF477:
+	.string	"__ptr_t void *"
+.LASF641:
+	.string	"_BITS_POSIX2_LIM_H 1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF604:
+	.string	"_LINUX_LIMITS_H "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF472:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF579:
+	.string	"_POSIX_MAX_INPUT 255"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF703:
+	.string	"sl_strcasecmp"
+.LASF498:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF417:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF537:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF582:
+	.string	"_POSIX_NAME_MAX 14"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF514:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF653:
+	.string	"BC_SCALE_MAX _POSIX2_BC_SCALE_MAX"
+.LASF610:
+	.string	"MAX_INPUT 255"
+.LASF635:
+	.string	"TTY_NAME_MAX 32"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF409:
+	.string	"__USE_UNIX98"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF446:
+	.string	"_ATFILE_SOURCE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF471:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF534:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF573:
+	.string	"_POSIX_CHILD_MAX 25"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF447:
+	.string	"_ATFILE_SOURCE 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF523:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF548:
+	.string	"__stub_setlogin "
+.LASF707:
+	.string	"sl_isupper"
+.LASF666:
+	.string	"SCHAR_MAX"
+.LASF692:
+	.string	"LLONG_MIN"
+.LASF464:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF587:
+	.string	"_POSIX_RE_DUP_MAX 255"
+.LASF513:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF690:
+	.string	"ULONG_MAX"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF571:
+	.string	"_POSIX_AIO_MAX 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF651:
+	.string	"BC_BASE_MAX _POSIX2_BC_BASE_MAX"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF685:
+	.string	"UINT_MAX (INT_MAX * 2U + 1U)"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF676:
+	.string	"SHRT_MAX"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF577:
+	.string	"_POSIX_LOGIN_NAME_MAX 9"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF572:
+	.string	"_POSIX_ARG_MAX 4096"
+.LASF688:
+	.string	"LONG_MAX"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF552:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF426:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF406:
+	.string	"__USE_POSIX199506"
+.LASF532:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF490:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF474:
+	.string	"__PMT(args) args"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF509:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF546:
+	.string	"__stub_gtty "
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF524:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF621:
+	.string	"__undef_LINK_MAX"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF496:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF535:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF629:
+	.string	"PTHREAD_DESTRUCTOR_ITERATIONS _POSIX_THREAD_DESTRUCTOR_ITERATIONS"
+.LASF444:
+	.string	"__USE_XOPEN2K 1"
+.LASF622:
+	.string	"OPEN_MAX"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF624:
+	.string	"ARG_MAX"
+.LASF606:
+	.string	"NGROUPS_MAX 65536"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF433:
+	.string	"__USE_ISOC99 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF422:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF633:
+	.string	"PTHREAD_STACK_MIN 16384"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF401:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF602:
+	.string	"__undef_OPEN_MAX "
+.LASF400:
+	.string	"__USE_ISOC99"
+.LASF442:
+	.string	"__USE_POSIX199309 1"
+.LASF601:
+	.string	"__undef_LINK_MAX "
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF681:
+	.string	"INT_MIN (-INT_MAX - 1)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF478:
+	.string	"__BEGIN_DECLS "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF583:
+	.string	"_POSIX_NGROUPS_MAX 8"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF619:
+	.string	"__undef_NR_OPEN"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF609:
+	.string	"MAX_CANON 255"
+.LASF680:
+	.string	"INT_MIN"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF431:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF693:
+	.string	"LLONG_MIN (-LLONG_MAX - 1LL)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF709:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF611:
+	.string	"NAME_MAX 255"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF435:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF648:
+	.string	"_POSIX2_LINE_MAX 2048"
+.LASF516:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF594:
+	.string	"_POSIX_SYMLINK_MAX 255"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF451:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF565:
+	.string	"MB_LEN_MAX 16"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF575:
+	.string	"_POSIX_HOST_NAME_MAX 255"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF644:
+	.string	"_POSIX2_BC_SCALE_MAX 99"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF627:
+	.string	"PTHREAD_KEYS_MAX 1024"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF700:
+	.string	"char"
+.LASF544:
+	.string	"__stub_chflags "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF588:
+	.string	"_POSIX_RTSIG_MAX 8"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF673:
+	.string	"CHAR_MAX SCHAR_MAX"
+.LASF608:
+	.string	"LINK_MAX 127"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF640:
+	.string	"SSIZE_MAX LONG_MAX"
+.LASF488:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF529:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF668:
+	.string	"UCHAR_MAX"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF649:
+	.string	"_POSIX2_RE_DUP_MAX 255"
+.LASF527:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF511:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF656:
+	.string	"EXPR_NEST_MAX _POSIX2_EXPR_NEST_MAX"
+.LASF429:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF432:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF405:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF453:
+	.string	"__USE_ATFILE 1"
+.LASF410:
+	.string	"__USE_XOPEN2K"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF636:
+	.string	"LOGIN_NAME_MAX 256"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF570:
+	.string	"_POSIX_AIO_LISTIO_MAX 2"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF450:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF528:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF551:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF23:
+	.string	"_LP64 1"
+.LASF398:
+	.string	"_FEATURES_H 1"
+.LASF659:
+	.string	"RE_DUP_MAX (0x7fff)"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF423:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF566:
+	.string	"LLONG_MIN (-LLONG_MAX-1)"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF650:
+	.string	"_POSIX2_CHARCLASS_NAME_MAX 14"
+.LASF669:
+	.string	"UCHAR_MAX (SCHAR_MAX * 2 + 1)"
+.LASF687:
+	.string	"LONG_MIN (-LONG_MAX - 1L)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF413:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF696:
+	.string	"ULLONG_MAX (LLONG_MAX * 2ULL + 1ULL)"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF463:
+	.string	"__PMT"
+.LASF646:
+	.string	"_POSIX2_COLL_WEIGHTS_MAX 2"
+.LASF643:
+	.string	"_POSIX2_BC_DIM_MAX 2048"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF630:
+	.string	"_POSIX_THREAD_THREADS_MAX 64"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF393:
+	.string	"_GCC_LIMITS_H_ "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF487:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF416:
+	.string	"__USE_FILE_OFFSET64"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF576:
+	.string	"_POSIX_LINK_MAX 8"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF615:
+	.string	"XATTR_SIZE_MAX 65536"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF439:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF603:
+	.string	"__undef_ARG_MAX "
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF421:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF595:
+	.string	"_POSIX_SYMLOOP_MAX 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF466:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF481:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF503:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF510:
+	.string	"__always_inline"
+.LASF590:
+	.string	"_POSIX_SEM_VALUE_MAX 32767"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF440:
+	.string	"__USE_POSIX 1"
+.LASF675:
+	.string	"SHRT_MIN (-SHRT_MAX - 1)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF616:
+	.string	"XATTR_LIST_MAX 65536"
+.LASF661:
+	.string	"_LIMITS_H___ "
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF501:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF541:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF521:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF599:
+	.string	"_POSIX_CLOCKRES_MIN 20000000"
+.LASF586:
+	.string	"_POSIX_PIPE_BUF 512"
+.LASF520:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF483:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF480:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF662:
+	.string	"CHAR_BIT"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF505:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF705:
+	.string	"sl_tolower"
+.LASF467:
+	.string	"__LEAF , __leaf__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF591:
+	.string	"_POSIX_SIGQUEUE_MAX 32"
+.LASF515:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF475:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF502:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF539:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF395:
+	.string	"_LIBC_LIMITS_H_ 1"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF617:
+	.string	"RTSIG_MAX 32"
+.LASF672:
+	.string	"CHAR_MAX"
+.LASF697:
+	.string	"FTOA_BUFFER_SIZE 13"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF476:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF394:
+	.string	"_GCC_NEXT_LIMITS_H "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF500:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF592:
+	.string	"_POSIX_SSIZE_MAX 32767"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF396:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF647:
+	.string	"_POSIX2_EXPR_NEST_MAX 32"
+.LASF460:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF358:
+	.string	"__k8 1"
+.LASF694:
+	.string	"LLONG_MAX"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF404:
+	.string	"__USE_POSIX2"
+.LASF597:
+	.string	"_POSIX_TTY_NAME_MAX 9"
+.LASF677:
+	.string	"SHRT_MAX __SHRT_MAX__"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF550:
+	.string	"__stub_stty "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF454:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF495:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF657:
+	.string	"LINE_MAX _POSIX2_LINE_MAX"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF671:
+	.string	"CHAR_MIN SCHAR_MIN"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF684:
+	.string	"UINT_MAX"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF631:
+	.string	"PTHREAD_THREADS_MAX"
+.LASF678:
+	.string	"USHRT_MAX"
+.LASF371:
+	.string	"__linux 1"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF522:
+	.string	"__attribute_copy__"
+.LASF525:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF536:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF418:
+	.string	"__USE_ATFILE"
+.LASF412:
+	.string	"__USE_XOPEN2K8"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF489:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF407:
+	.string	"__USE_XOPEN"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF438:
+	.string	"_POSIX_C_SOURCE"
+.LASF469:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF612:
+	.string	"PATH_MAX 4096"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF419:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF584:
+	.string	"_POSIX_OPEN_MAX 20"
+.LASF445:
+	.string	"__USE_XOPEN2K8 1"
+.LASF645:
+	.string	"_POSIX2_BC_STRING_MAX 1000"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF499:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF607:
+	.string	"ARG_MAX 131072"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF430:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF637:
+	.string	"HOST_NAME_MAX 64"
+.LASF589:
+	.string	"_POSIX_SEM_NSEMS_MAX 256"
+.LASF448:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF581:
+	.string	"_POSIX_MQ_PRIO_MAX 32"
+.LASF543:
+	.string	"__stub___compat_bdflush "
+.LASF708:
+	.string	"sl_isdigit"
+.LASF569:
+	.string	"_BITS_POSIX1_LIM_H 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF473:
+	.string	"__P(args) args"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF459:
+	.string	"__GLIBC__ 2"
+.LASF664:
+	.string	"SCHAR_MIN"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF517:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF533:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF596:
+	.string	"_POSIX_TIMER_MAX 32"
+.LASF374:
+	.string	"__unix 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF683:
+	.string	"INT_MAX __INT_MAX__"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF580:
+	.string	"_POSIX_MQ_OPEN_MAX 8"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF567:
+	.string	"LLONG_MAX __LONG_LONG_MAX__"
+.LASF531:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF605:
+	.string	"NR_OPEN 1024"
+.LASF492:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF686:
+	.string	"LONG_MIN"
+.LASF665:
+	.string	"SCHAR_MIN (-SCHAR_MAX - 1)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF639:
+	.string	"SEM_VALUE_MAX (2147483647)"
+.LASF411:
+	.string	"__USE_XOPEN2KXSI"
+.LASF494:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF689:
+	.string	"LONG_MAX __LONG_MAX__"
+.LASF698:
+	.string	"ucs1"
+.LASF699:
+	.string	"ucs2"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF518:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF638:
+	.string	"MQ_PRIO_MAX 32768"
+.LASF504:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF701:
+	.string	"unsigned char"
+.LASF455:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF682:
+	.string	"INT_MAX"
+.LASF663:
+	.string	"CHAR_BIT __CHAR_BIT__"
+.LASF540:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF420:
+	.string	"__USE_GNU"
+.LASF704:
+	.string	"sl_toupper"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF468:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF428:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF655:
+	.string	"COLL_WEIGHTS_MAX 255"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF437:
+	.string	"_POSIX_SOURCE 1"
+.LASF456:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF626:
+	.string	"_POSIX_THREAD_KEYS_MAX 128"
+.LASF507:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF458:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF613:
+	.string	"PIPE_BUF 4096"
+.LASF408:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF585:
+	.string	"_POSIX_PATH_MAX 256"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF628:
+	.string	"_POSIX_THREAD_DESTRUCTOR_ITERATIONS 4"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF695:
+	.string	"ULLONG_MAX"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF702:
+	.string	"sl_strncasecmp"
+.LASF479:
+	.string	"__END_DECLS "
+.LASF667:
+	.string	"SCHAR_MAX __SCHAR_MAX__"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF593:
+	.string	"_POSIX_STREAM_MAX 8"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF414:
+	.string	"__USE_LARGEFILE"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF452:
+	.string	"__USE_MISC 1"
+.LASF618:
+	.string	"NR_OPEN"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF547:
+	.string	"__stub_revoke "
+.LASF578:
+	.string	"_POSIX_MAX_CANON 255"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF485:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF625:
+	.string	"__undef_ARG_MAX"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF530:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF632:
+	.string	"AIO_PRIO_DELTA_MAX 20"
+.LASF399:
+	.string	"__USE_ISOC11"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF465:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF491:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF542:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF449:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF654:
+	.string	"BC_STRING_MAX _POSIX2_BC_STRING_MAX"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF642:
+	.string	"_POSIX2_BC_BASE_MAX 99"
+.LASF470:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF376:
+	.string	"unix 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF403:
+	.string	"__USE_POSIX"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF425:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF670:
+	.string	"CHAR_MIN"
+.LASF679:
+	.string	"USHRT_MAX (SHRT_MAX * 2 + 1)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF598:
+	.string	"_POSIX_TZNAME_MAX 6"
+.LASF706:
+	.string	"sl_islower"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF728:
+	.string	"long-double.h"
+.LASF730:
+	.string	"stubs-64.h"
+.LASF716:
+	.string	"/usr/include"
+.LASF722:
+	.string	"libc-header-start.h"
+.LASF721:
+	.string	"syslimits.h"
+.LASF714:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF723:
+	.string	"features.h"
+.LASF726:
+	.string	"timesize.h"
+.LASF729:
+	.string	"stubs.h"
+.LASF715:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF717:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF732:
+	.string	"local_lim.h"
+.LASF731:
+	.string	"posix1_lim.h"
+.LASF735:
+	.string	"posix2_lim.h"
+.LASF737:
+	.string	"typeconversion.h"
+.LASF712:
+	.string	"/usr/include/linux"
+.LASF0:
+	.string	"./src/main/common/string_light.c"
+.LASF733:
+	.string	"pthread_stack_min-dynamic.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF724:
+	.string	"features-time64.h"
+.LASF736:
+	.string	"string_light.h"
+.LASF727:
+	.string	"cdefs.h"
+.LASF713:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF734:
+	.string	"pthread_stack_min.h"
+.LASF718:
+	.string	"string_light.c"
+.LASF725:
+	.string	"wordsize.h"
+.LASF711:
+	.string	"src/main/common"
+.LASF719:
+	.string	"stdc-predef.h"
+.LASF720:
+	.string	"limits.h"
+	.text
+	.section	.gnu.lto_.profile.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 L-\002"
+	.string	"\304\003@"
+	.string	"\b"
+	.string	"\221\231\321t"
+	.string	"\001\253\350\232\232\005"
+	.string	"\002\374\224\332\200\f"
+	.string	"\003\253\234\210\326\006"
+	.string	"\004\303\316\317="
+	.string	"\005\275\363\224\320\001"
+	.string	"\006\314\300\371\214\005\004\002"
+	.string	"\007\237\356\205\252\007"
+	.string	""
+	.string	"\002"
+	.ascii	"\222\033p\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 b\365\001"
+	.string	"d\002V"
+	.string	"\b"
+	.string	"\001\003\001\002\003\004\005\006\003\003\007\002"
+	.string	"\020"
+	.string	"\007\003\003\001\200\f"
+	.string	""
+	.string	"\001\201\f"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n"
+	.string	"\n"
+	.ascii	"\273`9\002  \030\f\f\001\343\300`*\323^\202\333@\033"
+	.text
+	.section	.gnu.lto_.inline.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`|\001u\007"
+	.string	"\242\313%,pi\222\016\374\177V\374\017\327_0\f\006\024\347\032\375\013d\233\307\307\345\206\300(\375\346\273\372\357\270\021\307\304\347 \1777B\244L\001\377\016\312\016\n\372\005\210\240f<\344DI+0\225\214A%\265\300T2\004\333D\243N\217v\365B\226,\354\305\3351N\250\351\325\2048#m\246j4\036\212\267\2028\330\274\027\352]\275\273\263g\270\273\3117?\313\007:f\221\240(`\004\tAV\341\201\347y.t\354\366\240m\350"
+	.ascii	"t\214M\330f\004]\356&\001\257\356B& \340\242\251\241\036.\004"
+	.ascii	"@l\002\252\fl]\221\323\016\037+\345\202e{\273\363\2561\013\342"
+	.ascii	"\036I\203-)\275\265\277\3100\262\301\306\311\362'\260\245\327"
+	.ascii	"\003eU\374]\326)\277-\274\332\352\260V\324B\254\245M\213c;\221"
+	.ascii	"\325\004\371}\315\243[)Ep\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 \214\215\002"
+	.string	"\202\204\r\026\300%\035\377\257w\375\377\017ZU_\377\017\232i\204\264-e\222\001\333\236B\252\252^18\315F\234\262\247\274G3\312\313\205'\271\244\341\357"
+	.string	"\246|R\177\301\210\n"
+	.ascii	"-\002\222\272\020f\336\323\335\003\343\300``\b\030We\234\r`\001"
+	.text
+	.section	.gnu.lto_.pureconst.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\200\004\001\200\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\200\004\006\205\004\007\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 Xe\001"
+	.string	"\300L"
+	.string	"\006"
+	.string	"\001@"
+	.string	"\001\002\003\006\003\300\004\300\004\300\007"
+	.string	""
+	.string	"\001\007\002"
+	.string	"\b"
+	.ascii	"\200\300\314\300L]\007\233\201-.\373\202\2547\200\005"
+	.text
+	.section	.gnu.lto_.lto.abf68c2f38d6c625,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_sl_isalnum.0.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`\311\002\255\022"
+	.string	"v\241uF\340.'\035\202ly\270\034sf"
+	.string	"\313\204!],y\356\033?h\361\013^\036\257\016\303\253\034\276\363t\255\030\021j\324\270^R\223a\0162\216\301y\270\210\240\306\212\3231\374\217\034\313\263j\362f\t\331[\312\224\002\\"
+	.string	"c"
+	.string	"^"
+	.string	"y\035\037\031\265+\003\242hw\025x\343\364h\333\027\361\034\227}\364\261\002mnZH\330v\367K\235"
+	.ascii	"\367\b\217\301=\352\207\273\316E\250\351\362;\217\020%\\d*\347"
+	.ascii	"X\342\t\346p\305\223\305R\003\310`0\265\273\337y\276\310b\231"
+	.ascii	"\235\307\356:]d\032\356\356\266W\266\037\330\032\003]Ls1\035"
+	.ascii	"c\032^\347\327\247\177\352j0j\273\031nM\213\024\215n\374\240"
+	.ascii	"\023\235\f\035\020\322\021:\311\t:\3619\020\312O\203ZM\r\345"
+	.ascii	"\303\301\t %\037\024\333{O\312g>\017\004\016\266GZ*6`c67J\273"
+	.ascii	"\233\361\230\0308\236\247\245\020\341<\372#Rl\357Qm\227\355\331"
+	.ascii	"i\202\343\001\232K,10\240G\230\237\203l\250\335\036\257\334]"
+	.ascii	"\025U\032\243n\302A\315$\036\024\261t\361\357\374\244\304\002"
+	.ascii	"\351\225L\026p\273\335\212n\302E\205z\226\030X\336\254\0325\227"
+	.ascii	"Z^\274\362\346\023\0356\245\370\320\241M\205\352\205\236z%\223"
+	.ascii	"=\231M&{\006K\245\261\017ww\2553vL\007\336\330`\260`BGG\207F"
+	.ascii	"\001\325\255\322(\251\020\"b!B\310J\244UB\362\255X##,\325\267"
+	.ascii	"\022\2210\362\251Z$\237\006\002\263.Ph}%,V\353\363f\257\303\325"
+	.ascii	"\031g\314x\302\004\277\276h\352\245\260\023g\364N3\211\006\300"
+	.ascii	"\346\241\353y\304\3419H\007\332\243\322\370\327\331\256\n\324"
+	.ascii	"\031\0037\3418\375\212\032\252\305\016\027A\2501dI\230C3\312"
+	.ascii	"P\222\202J\033\360\002\231!\253\003\021\300\245\202\214*L\366"
+	.ascii	"3Q_)\343T3\332\203\200${\222\326\234@\032\252\265B1\233\027\350"
+	.ascii	"\006\206\356\t\024\267I\255kq\257\372hK\240=h\355\027@\307m\242"
+	.ascii	"\263N\211.\244\361,t?\201ts\"u\326\301W\371E\267\242\342\205"
+	.ascii	"\2470>\316#\262E*IFz\200Zq\2104\272ZQ\0166\235ou\246\002"
+	.text
+	.section	.gnu.lto_sl_isdigit.1.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"U\t"
+	.string	"\206\322A7@\255\322\001\363\366\357\253uJK\210\r\f\3522\371\377\024\034\256oJfDm\243\333B\b\342\315P\fH/C\255\007\317)\332\200H\256/\2156\254nd\023)S\n0"
+	.string	"/"
+	.string	"/"
+	.string	"\240=S\230\3204\\\251\017\224\335\3454\027\330\036\265g\266G\3158\370\004\375\303\276\0219Q\255LOK\302\356:U+\213[o{c{\301\366H\3274\255\231\316L\337b1\311\220\354V\204*\033\022A8\354\307@\033c\347\353\340y\330_\236\371\262\313\332\220\355n\201;"
+	.string	"\217\266}\217\273\002\032\365\227\227\266T\325\247:\002\3020\224\275\264]SOq\201\312\320\232^\263$\265r\312\320\030\326f\212\0353\245b\330\327V[\366\323\361\257\007\356t\020\f\034<\036\017g\240\273;\016\t\342\003\212`\370\210@\037i\304\211\274P\310\3538\021\250!\304u\337\210\343\020\330\223x\3708\222\347}\034&\266\327V[Q5'EY\003\013"
+	.string	"QS\240\fk\367/\316\231\225\242B\017\233\266\270&\242cB\237*\200"
+	.ascii	"\250\211\235k>\001"
+	.text
+	.section	.gnu.lto_sl_isupper.2.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"m\t"
+	.string	"\206\222B90\345(\035\036\256\260\220P9\264\271\260\321\230\026\013\n\270\307t\f\240\364\275\327\326\032Q!\r/\030\337W\215\220\226\002q`\302\214X\356p\260%-U\314\326O6\2212\2451"
+	.string	"/"
+	.string	"/"
+	.string	"\240=s\270\320>NV%0\273\313q^\260=j\037\330\036\325\343\340\023\364\037{\247e\205\325B=3\r\273\353d\2654n\275\355\216\355\007\333.\001\3274\255\231\316L?\2431!P\331\315\b\001,KL\t\261/\003\355\215\235\035\013\317\307\016\363\314\232]\027\b\312\356&\370\023\360h\333\0379I\032\365\007?m\251\252_\211\b\204a\030\373i\273\246\036cC\225\2415\275\346\313*@*Co\\\2331\266\f\225\312a_[}\331O\307\303\036\376|\030\024$@ \220\307\240\273;\217\211\"$\252\200\b\221D\237\251\304\221\274\321\310\3538\222(b\304u_\211\363 \330\263\230\3708\223\347}\334F\266\327V_Q9)UY\003\013"
+	.string	"QS\240\fk\367/\316\231\225\242B\017\233\266\270&\242cB\237*\200"
+	.ascii	"\250\211\235k>\001"
+	.text
+	.section	.gnu.lto_sl_islower.3.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`e"
+	.string	"u\t"
+	.string	"\206\322B:0\345(\035\036p\273\037T\336(\356\305e\311\246\022\260`\315\247\0224\355\326?\372[#*\244\341\005\343\373\252\021\322R \016L\230\021\313\035\016\266\244\245\n\030\265\221M\244L)1"
+	.string	"/"
+	.string	"/"
+	.string	"\240\035\203\310\310FVR)"
+	.string	"v\227\323\374@{\314^\240=\252\310\301'\350\377\365\315\213\212jezf\036v\327\251Zu\334z\333\033\333\021\266a\002\3174\255\231\316L?\263y\030\204\273\034\241\200u\211-%\366a\240\275\331\271\321\360\374\353.\307<\260\313\"a\331\335\005w\004\036m\373'G\t\032\365\t/i\251\252O\231\020\204a\b\362\222vM\275\306\007*Cgz\315\230\324\200S\206\336X\233\001l\230)5\304~\266\332\262\237\216w=\356t\034\030(<\036\017\007\241\273;\016\311\342\003\272\220\370\210@\037i\304\211\274P\310\3538\021h\"\304u\337\210\343(\330\303\250\3708\222\347}\334\006\333g\253\255\250\232\223\242\254\001\013"
+	.string	"QS\240\fk\367/\316\231\225\242B\017\233\266\270&\242cB\237*\200"
+	.ascii	"\250\211\235k>\001"
+	.text
+	.section	.gnu.lto_sl_tolower.4.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`<\001\335\r"
+	.string	"\246\032]C\020\221\223\016\343|\217\355\300Z%\210%G\304\365o\206\2269 \353\223_q#\024w\340tO\201\231E\357\376\260\205a\352\245\336\221\b"
+	.string	""
+	.string	"\306X"
+	.string	"\016\2737p\225Kee\030\na\034\333\336[\312\224\002H"
+	.string	"K"
+	.string	"H"
+	.string	"\033\216C\333~\312M\210\354U\004\r\017\305E\244\005fw\261\353\035\361\360\275@<\324\020\027\375i\212|\253\345\305\b\027\362\027\200\353p\025\300\225\336\265\273?=I8Rf\346\301\356:G\270\222\033\3366\004\333\022\354\233\002~W\371\365\351g\254\026\035.v9t6\366\005\246 \341\257\234%t\224\257B0\002\3460u\225\bl\t\305\005\306\356*8L\020\251\320\211\022\207\376J\310\266\016\357\243D\266e\237F\203\347OW\361\312"
+	.string	"vM\"P\354\356\002\007 1j\312P\251(e\r\373\251\377t\216\030)/\003\272\256;\035$>\215\372\r\037H\331Y\365i\316\020\2711\312\316g9\364\260\342\252\303\022\026\252O\375\032e\214-\323f\214\215\"\245\236\330\177\253&\266\246\343\323P3\336l\0340\250\300\341p4\006\262;\323\200.xt0L\360\370t6\320\007\366\321<\036-\303>\035\n\036,\333>0M\002k\031,l\030H\3236\314B\215\376VM\234\251\232\n\365J\242\327HI\357]\367*\252\302\347\356\206\250\236\370\300\003\033"
+	.string	"Q#pB\326\216i\225\366WM\214^\241\215\211pF\207\215\342\213\013\204%-\013\317\\\326\205\021\030\313\364\217\275\017M\246\336\332\034V\230\302.\260\003\215\001mPe\363"
+	.ascii	"\324D\230\307\207jz\023J\031"
+	.text
+	.section	.gnu.lto_sl_toupper.5.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`:\001\345\r"
+	.string	"v\032]C"
+	.string	"\223\223\016\343\217\262\251>&\224\236\307\031\3064\314`\203\302C\025\255e\004BK\203\260\365L\261\325>\260\001X\033pT~\277\017\233\252\252,\245\200N\031\320\260\240\206\244\336\253\377\310/\266\275\267\224)\005H"
+	.string	"K"
+	.string	"H"
+	.ascii	"!\207\266\375\026wA\262W\023:\274\026\232\223\027>v\027\273~"
+	.ascii	" \036\276\033\210\207z\342\244?M\222o\301\250\201\302\231\374"
+	.ascii	"\005\340D"
+	.string	"\\\007p\247w\355\356a\236)\234)s\023aw\235(\\\210\033\336\266\004\333\024\354\233\b\351\367\227_\237\376F\300\n\0042vAt@v\006\322H\341\307\\ft\224\257Z\240\202\305a\352:\025\330S\013\215\216\335mp\230\037D\236O\215b\270\034\3721#\333:\311\266\354\337\020y\376\305+\003\330UA1cw\035\270\023%1j\362P\3318\345\217\037\346!;V3\004\272\256+\361\222\3704\352=\2200eg\325\247\331\343$H);_\346\320\005\307U\207#r\250>\365\253\2245\266T6kl\224)\225\305\376\333\335\265\256\330\232\216OC\r\356t <\300\340\361x8\t\262;\343\2104\214|6T\030\t}6\021\t\026\322@ -\303B\237\013 ,\333H0\016\003k\0342l\230H\3236\314B\225\376VW\234\251\232\n\365\232\242WIM\357Y\270WQ\025>w\327D\225\305\n\036\033"
+	.string	"Q#\220B\326\212i\225\366WM\214^\241\215\211pF\307\312-\273\037f\313\013\204}-[\316\\\201\\p\377\330\363\320\344\351\255\305a\305(,\203v\201b\251\206*\306\372"
+	.ascii	"T\036\230-\016%o\273\212\036"
+	.text
+	.section	.gnu.lto_sl_strcasecmp.6.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"]\t"
+	.string	"\006\222A80\221\322\001\200\202tK\024\264\262\201V\376\340\346h\004<U\r\352Zg\253o\250\b\256\001\220\367~\255\206/\221\224\001A\255B\373U\305\265JQi\345\267m\357-S\n0"
+	.string	"0"
+	.string	"."
+	.string	"\236=xD\023\231\017Y\315\356N\320\0078\227\361\002\234KX\362\356\332\371_\371\001\313\327r\255\256\035\207\335\265\266\\!7\274m\004\333\021\266g\0024\273 \337\315\302\310\227\023\333\235\375\261/\213\305@x.\017[\270\332O\271Jwo\343\001\273\257\026\227]/\301\"\317\245=\217m\037v\224\316\001\260\303R;\337\367}\367\214\003\241B;CC\337\212\260A\204\005W\376\214\254\332\330\336J!\211\375\270\360e\253:>\366\303{\277J"
+	.string	"\026A\n\234Z$b\030Q\220H\244P\301\210S\227B*\013\323\351B\302\224:m*n\2464\024J+\315\324i\0025K\0337C\006\3260*\266\251\322\264m~\274\275\035!\210#\r"
+	.ascii	"bS\240L\206\200\f\222`\267k\"\177\026DdB\004F\300\270\025j\036"
+	.ascii	"\334\355Q\255t\204I\006"
+	.text
+	.section	.gnu.lto_sl_strncasecmp.7.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`@\007\235'"
+	.string	"\272F\f\017H\220XN:\304\033\016>\0029\341\300\276\243-~*\307\366?\210\305\026\316\344\336\270\235V\316\217A\207EZ\373\027\036Q\245\273\270\353\3446\354L_\031\206Bx\240\365\261G\035\r\007\344\307\242\207J\3336B\310&R&\031\340"
+	.string	"\323"
+	.string	"\330"
+	.ascii	"4\003o\227+\205\203&\026\021\324\324\244\325*\274p\236z\340\355"
+	.ascii	"\016\267HV.\bD\216i\265V\241\323\265pB\3401_k\213{\253u\007\333"
+	.ascii	"W\255\265\300V8O\0318A\223p\236\022\361\316\273g\362&K\027\252"
+	.ascii	"\270N\255V]_\265\n\013,\321y\272\302\363J\276di\267\030a\005"
+	.ascii	"\351\203\rjk\255\326\272\323\275\247<%\317S\236v\217\3059\036"
+	.ascii	"\217\307\223\302/\216\227\236\303\335N\263\244d\363\322^A\r*"
+	.ascii	".\244\230\236;\213\262Alb\\\020\326T\325o5N\262\301\225\0310"
+	.ascii	"\016\366\240\263(\032$\377\020S\346\304\007\021\211\262\301&"
+	.ascii	"\325K(\343\023S\234\224\214\2237R+H]"
+	.string	"\3309(\345\304}\342)\217\026evLU\235M\007\265\326e\027RS_\233\357.\231\335\375\260[r\t\334W\273G@%\346c\333j\227y\201\230\367\347\344\3659y\0030o\017\363\002\340\3319yurN^\234\233k\3756w\362\347.\374q\037~\317s}\315{}\313k})\363\222&o3/\233\274\027\300\303\362)\253\025\3061M5\243`B>\374\271~\257\367\356\271\224\355\315\204\214d&\323\326\332\307vs\253\364,{-\003\202\254\211\2151\226\230R\327\303\222ne\217\305d\332BRk\315\355\222\017\266\264\253\361\230_L\372\225-F\200\220e,\355t{\347)\t\336>\312\376\353`%\252\374tN9\325\211\207\213\254Zk\207\3634\211\312\357d\212:\275\272\0047\234S\222\366R\224vs\247\274\273\264\207\362\256\02377\301+\205\216)M\226\206\363\001}*[\250\314\200f_\2019\331"
+	.string	"\372\306\337\312\276Z&\177\372a\337in\240\016\356\227\343\224\375\306{\271N\343t\353p9\235av:Uf$#\373[\272\311\023\235\323\3472;\307fH\005\324\257r\035\360\305\337x\222a\006\244\272o\261\344\376\271\332W\226%d_-\320}\245O\263\231'dN\314\366\207\375,\243\304\254\311}e\200\366\351?\341h\352"
+	.string	"\315g\240\326"
+	.ascii	"\307"
+	.string	"Ngh9\235\022\273\016\030v\232\344\254b9\206#]\270_|s\367\026\324\232}\027$\243\023\310>Ey\372&\311\202U@>\356\215\256\350e\3374\335z2\322\304\307=\330\377b(\243\307\350\310Z\353\345a\f\241\177x\3361\327\347j\303\365\275\256\224\003\310m\333\203\346\254r\333\256\260)\275\027\365\330@\217\213\f\374zI\344\207\037\335\300\217\227\210(A\321\207\003\007\016\f\375\024\375x{C(D\204\030a\202C\210\243\021H(~\273#\237\221\221\257\267;\032\341\301h\327C\372\355\206\202\326w\002\004\322\016\205\317\207\264\313\t\201o\253\345S\350\214\023\272Y\r\231b\356\364y\366\202\034\300n\332\023\217\033\0269;;\327W\313\344\226\323'\236\002\031#\347\332\354\340\301\2163\033\022\344v\3237d\2460\256\313\016\236x\002h7\236^\222m\232\322~\200\346\304ld\223\035\264\257U2\267\255\311\353"
+	.ascii	"\310m'k\255\025\307\323\327\032:m\036\342O\365\024\343"
+	.string	"\254v\205\301\n\273\375\312\236>\330\331\353E\221'b\234\230\355=V5T;\313\fA#%\273G\350;\215\364\004m\247?\274\016\b\324;\315R\236\262j\364\004\200\226\250Q0\344 S\310DDD\222$\305\302\001\240\002\231\251*n\021P\265d\214D\222d\377\031\003`\200/\266T#\026EepvR\203\310\272\201\001w\216\005t$E\321\2043W2\3724tKh)\351\300i+\326S\366X+`\224\206LoU\270\367\023\362\\\027\037\036?$&/c\274Q~ \322\00247\001\330;\020h\330\260P\006\030\364S\003\177\307\303 \017\246\021\233f4\310\223\035 \f\345M\302L\261Y\305g\277<a\342\372\347|gB\222W[\031\344q\273\177\242($\332\306\3436\221@\263:\375\366E\204\310\304\377\035h\364\251Bv\rk\327Z\347k\351\372IC\021\020\n\n\377\r\3019M\253@\227\201"
+	.ascii	"\003g=\335\023F\336\221rq`\245\333J\275\0048\244\2200\354\030"
+	.ascii	"\034\346\375\375\353xa\245\345!4\002!\240R\244\331\211\302\021"
+	.ascii	"t\307\375\fp\220\347\323(\332\005=MF~\t\003\240\377<+%\020\336"
+	.ascii	"\337i\347\001'\206\363\236\006\200P\262W\351\272\367L2\235\004"
+	.ascii	"\217k\263,\226b\242\327\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 \317\205\002"
+	.string	"t\003\313"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\004\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\001\177\005\002\177\006\003\177\007\004\177\b\005\177\t\007\177\n\252\331\2276\006\177\013\003\007B"
+	.string	"\t"
+	.ascii	"\021\223a\240\207\304 \006|\003|\003|\003|\003\374p\2559\006"
+	.text
+	.section	.gnu.lto_.refs.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.abf68c2f38d6c625,"e",@progbits
+	.string	"(\265/\375`v\006\205&"
+	.string	"JE4\017H\220\\\325p"
+	.string	"\"\020\254\307\263\353\215\231E\3704h\306\216\356\306 \340\204\021N\223\336\217P\324Gz[\371d\257&]\255\035\334\262\206\265`\212"
+	.string	"\276\312\244^e\002f\205\325\301\373r\213o\203e%=\356\306\306n[\246\307"
+	.string	"\334"
+	.string	"\346"
+	.string	"/n\354h\331\013\212\215\020\030\245\311M\374\344\354\304Nz\251\273\331)B\353$\223\231F\216|8\235\346uP~]%\332t\253\374\226\334\204\231\234\337\237\231x\311_A\267\337n\227\231\306L\223\345$\213\254\352i\316\370\300ir\001%\274\304\256kU\321vS\267;"
+	.ascii	"\265\"EuQ\232|\204\221|\001'9\204\236\273R&w\251\333\225\241"
+	.ascii	"O)\306\224\346K\364\274\340\344-^p\336\345\003'\312\005\316\377"
+	.ascii	"I\024\374'\003\340g'\377\255\300@Q)M\021\221\002\342\343\377"
+	.ascii	"\027\363g\035\347\3178\376'\377_\375\247\222\372\037\365\037"
+	.ascii	"\371\377\370\037\312\377%\377;\374w\377\303\376O\375\177mmmm"
+	.ascii	"\375\334\340\347\002?N-1\314\224\346\377Y\377\277\216\0015]\335"
+	.ascii	"n4H\024\216Y_\242p\300\372\266,\313\244JH\240]5\325i\327eQ\267"
+	.ascii	"M\007\254\256\332}Ee\321`\313\366\333\302\331\372\252-\270_\242"
+	.ascii	"pu\211B\235\365%\262\353\333\246\025\324\224u;\325Y\337\036\354"
+	.ascii	"\352\252B^_U\2706\016\341\206\023XHPk\260Y$(\022l\331\252\325"
+	.ascii	"m\331\330\2356\0255\313n"
+	.string	"7\261\333\250\245\031\203=R#\260\212E\3160\350\246,c\005\360\250}\271\300\256Z\203\264!\212\272\223\275\"B\312\251\333\335&\032\230rw\221\313v\003\333\017\303\226\261L\260\035\353\240\252\002x\324\302\212\200\255\211\016b\203\273\273\205\353{\324\332\240\232\274I\rtSN\352$\221E\337\324\355\265L,\315S\226\232\262\bE\246\024\307\241\214\b\233\024[\332\240\f\262<\013_i\3505I=\034\356\304\244\334\260\220au\276z\235`\247\030)M\326\302\305']\242\250)M\256\342\342\377\327\231\305DU\004\203\262\221\352T|D;\311m\025R\032+\224\223S|ej\352|\323T\343L\024Z\266\024[\221z2\225n\264\271QD\313a\024W\211z\362\322\3422\003\206\022\264LB2\025$\037\321\264\333\325Mc)\251\207F;14HG/J\363<\004-\233x\034\205\237\316R\240X\n\037y\330\351\231"
+	.string	"VTP\374P\323C\243\035\030VQ\213\321\224\363\361HX\267\002\331\f$a\2604\177\346H\023\006\224\022Ui\302x\306\373\230\272{\216\001\375\017z.\377\263U\266\273[\340\270m\004\302\3168\347\235?\306.f\320\256\004m\253XfN+\304\277]\316\245\343\361,"
+	.string	"\341\304\210\206n8_\320m\327\373\371\200t>\001\274\337\b\236\256\207#\"\022\361\313\t\345@\320\316#\302\365j?\036\257W\013p\036\036\t6\020===\017\020\234\002\205\0133\017\0342\240\267\007\277\020B9\035\220\320.\327\373\371j;\336\320\020\357V\333\345\202\206j\267\236\257\366`6$b\247\013\362\345\200t>"
+	.ascii	"\277\345z\270\035N\b}\004\037\007>\023H\344|\302\017\317\017"
+	.ascii	"\317\371\t?6\333\217\217\r\275\217\315e\366\202B\334f p;\241"
+	.ascii	"\234o'\"v\026\303c~$\223q\337\356\226\t\300\302eK\2624_\262("
+	.ascii	"\211\034>2\314U\224\227#\232\322d\255\222\2770\230\263\026{\201"
+	.ascii	"\005{I\313\354V\231i\002\230i8H\036\352\222\323|\211\002e\036"
+	.ascii	"YY\234\004s:\245\350\022\204\3139\t`\n\rR\232\322\344-\001r0"
+	.ascii	"\t\200\203\250\2618\243\230$\"\023\214\210\204Y\220$9\320\002"
+	.ascii	"\221\251b\035\021\300\231\324F\233b\366?\003!\006D<Y\305F\360"
+	.ascii	"x\256\342\356\027\324\226\264\242m35,n\302%\221\r\031\256\027"
+	.ascii	"H:O&\030\317\001\311f%\3712\343O\356\324!\245\343\372\223\351"
+	.ascii	"\027\235n\325\224\255k\323\334\264\0271\255\370\313\004\2175"
+	.ascii	"Q\321\320\001\235\350\212\241\353\237\005\350\236ZNX1I\257\364"
+	.ascii	"U_C?\372\236\241\231V\312\235TbF\334\242\276m\341\002]\223CA"
+	.ascii	"\340#\247\210\257 )QU\352 \353d\227C\232\343*\350\005\216\tW"
+	.ascii	"M05\203pBJ\236P*@\033\247\364-\t\313]\240\274\260\202\245\343"
+	.ascii	"\3371\200\247a\027\311*?\307\230\004\246^\316\340\026\361Gi\300"
+	.ascii	"\361\244\357`'k\371qBm\336\033\333we\324\266b?\202\362\234\227"
+	.ascii	"\260\202\332^\306\301\275\360k8\325.<<s9\347\017"
+	.text
+	.section	.gnu.lto_.symtab.abf68c2f38d6c625,"e",@progbits
+	.string	"sl_isalnum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323"
+	.string	""
+	.string	""
+	.string	"sl_isdigit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325"
+	.string	""
+	.string	""
+	.string	"sl_isupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"sl_islower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331"
+	.string	""
+	.string	""
+	.string	"sl_tolower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	"sl_toupper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.string	"sl_strncasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343"
+	.string	""
+	.string	""
+	.string	"sl_strcasecmp"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.abf68c2f38d6c625,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
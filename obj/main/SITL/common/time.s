@@ -0,0 +1,9021 @@
+	.file	"time.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/common/time.c"
+	.file 7 "./src/main/drivers/time.h"
+	.file 8 "./src/main/common/printf.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	time.c.ed34fa09
+	.weak	time.c.ed34fa09
+time.c.ed34fa09:
+	.long	0x807
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1d
+	.long	.LASF1190
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1082
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1084
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1085
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1086
+	.uleb128 0x2
+	.long	.LASF1087
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x2
+	.long	.LASF1088
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1089
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x2
+	.long	.LASF1093
+	.byte	0x1
+	.byte	0x2c
+	.byte	0x19
+	.long	0x9b
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1094
+	.uleb128 0x1f
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1095
+	.uleb128 0xa
+	.long	0xa9
+	.uleb128 0x2
+	.long	.LASF1096
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x2
+	.long	.LASF1097
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x2
+	.long	.LASF1098
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x13
+	.long	0x8f
+	.uleb128 0x2
+	.long	.LASF1099
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1100
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xa
+	.long	0xe5
+	.uleb128 0x2
+	.long	.LASF1101
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1102
+	.uleb128 0x2
+	.long	.LASF1103
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x143
+	.uleb128 0xd
+	.long	.LASF1104
+	.value	0xfff
+	.uleb128 0xd
+	.long	.LASF1105
+	.value	0xf000
+	.uleb128 0xd
+	.long	.LASF1106
+	.value	0xfff
+	.uleb128 0xe
+	.long	.LASF1107
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1108
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1109
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x14f
+	.uleb128 0x20
+	.long	0x15a
+	.uleb128 0x11
+	.long	0xa2
+	.byte	0
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x179
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x19
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x179
+	.byte	0
+	.uleb128 0x5
+	.long	0x143
+	.uleb128 0x12
+	.long	.LASF1120
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1d9
+	.uleb128 0x13
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x109
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1110
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1d9
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1d9
+	.byte	0x10
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1de
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1113
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x15a
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xd9
+	.uleb128 0x5
+	.long	0x1d9
+	.uleb128 0x2
+	.long	.LASF1114
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x17e
+	.uleb128 0xa
+	.long	0x1e3
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xf6
+	.uleb128 0x18
+	.long	0x30
+	.byte	0x5
+	.byte	0x35
+	.long	0x21e
+	.uleb128 0xe
+	.long	.LASF1116
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1117
+	.byte	0x1
+	.uleb128 0xe
+	.long	.LASF1118
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x5
+	.byte	0x39
+	.byte	0x3
+	.long	0x200
+	.uleb128 0x12
+	.long	.LASF1121
+	.byte	0x4
+	.byte	0x5
+	.byte	0x3b
+	.long	0x251
+	.uleb128 0x3
+	.long	.LASF1122
+	.byte	0x5
+	.byte	0x3c
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1123
+	.byte	0x5
+	.byte	0x3d
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x5
+	.byte	0x3e
+	.byte	0x3
+	.long	0x22a
+	.uleb128 0xa
+	.long	0x251
+	.uleb128 0xf
+	.long	.LASF1125
+	.byte	0x5
+	.byte	0x40
+	.byte	0x15
+	.long	0x251
+	.uleb128 0xf
+	.long	.LASF1126
+	.byte	0x5
+	.byte	0x40
+	.byte	0x3c
+	.long	0x251
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x5
+	.byte	0x43
+	.byte	0x11
+	.long	0xcd
+	.uleb128 0x12
+	.long	.LASF1128
+	.byte	0xa
+	.byte	0x5
+	.byte	0x49
+	.long	0x2ee
+	.uleb128 0x3
+	.long	.LASF1129
+	.byte	0x5
+	.byte	0x4b
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1130
+	.byte	0x5
+	.byte	0x4d
+	.byte	0xd
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x13
+	.string	"day"
+	.byte	0x5
+	.byte	0x4f
+	.byte	0xd
+	.long	0xd9
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1131
+	.byte	0x5
+	.byte	0x51
+	.byte	0xd
+	.long	0xd9
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1132
+	.byte	0x5
+	.byte	0x53
+	.byte	0xd
+	.long	0xd9
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1133
+	.byte	0x5
+	.byte	0x55
+	.byte	0xd
+	.long	0xd9
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1134
+	.byte	0x5
+	.byte	0x57
+	.byte	0xe
+	.long	0xe5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0x5
+	.byte	0x58
+	.byte	0x3
+	.long	0x286
+	.uleb128 0xa
+	.long	0x2ee
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0x2c
+	.byte	0x12
+	.long	0x27a
+	.uleb128 0x1a
+	.long	0xf1
+	.long	0x320
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x3
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	0x30a
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x2e
+	.byte	0x17
+	.long	0x320
+	.uleb128 0xf
+	.long	.LASF1138
+	.byte	0x6
+	.byte	0x36
+	.byte	0x1b
+	.long	0x25d
+	.uleb128 0x1b
+	.long	0x262
+	.byte	0x44
+	.uleb128 0x1b
+	.long	0x26e
+	.byte	0x64
+	.uleb128 0xf
+	.long	.LASF1139
+	.byte	0x6
+	.byte	0x36
+	.byte	0x8f
+	.long	0x1ef
+	.uleb128 0x22
+	.long	0x348
+	.byte	0xb7
+	.uleb128 0x23
+	.long	0x330
+	.byte	0x38
+	.byte	0x14
+	.uleb128 0x24
+	.long	.LASF1134
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1f4
+	.uleb128 0x25
+	.long	.LASF1191
+	.byte	0x8
+	.byte	0x71
+	.byte	0x5
+	.long	0x7c
+	.long	0x389
+	.uleb128 0x11
+	.long	0xa4
+	.uleb128 0x11
+	.long	0x389
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1141
+	.value	0x158
+	.byte	0x5
+	.long	0x3b4
+	.long	0x3b4
+	.uleb128 0x7
+	.string	"dt"
+	.value	0x158
+	.byte	0x20
+	.long	0x3bb
+	.uleb128 0x15
+	.string	"t"
+	.value	0x15a
+	.byte	0xf
+	.long	0x27a
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1140
+	.uleb128 0x5
+	.long	0x2ee
+	.uleb128 0x6
+	.long	.LASF1142
+	.value	0x14f
+	.byte	0x5
+	.long	0x3b4
+	.long	0x3dc
+	.uleb128 0x7
+	.string	"dt"
+	.value	0x14f
+	.byte	0x25
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1143
+	.value	0x143
+	.byte	0x5
+	.long	0x3b4
+	.long	0x402
+	.uleb128 0x7
+	.string	"dt"
+	.value	0x143
+	.byte	0x20
+	.long	0x3bb
+	.uleb128 0x15
+	.string	"t"
+	.value	0x145
+	.byte	0xf
+	.long	0x27a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1144
+	.value	0x13d
+	.byte	0x5
+	.long	0x3b4
+	.long	0x41d
+	.uleb128 0x7
+	.string	"t"
+	.value	0x13d
+	.byte	0x17
+	.long	0x41d
+	.byte	0
+	.uleb128 0x5
+	.long	0x27a
+	.uleb128 0x6
+	.long	.LASF1145
+	.value	0x134
+	.byte	0x5
+	.long	0x3b4
+	.long	0x43d
+	.uleb128 0x7
+	.string	"t"
+	.value	0x134
+	.byte	0x17
+	.long	0x41d
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1192
+	.byte	0x6
+	.value	0x12f
+	.byte	0x5
+	.long	0x3b4
+	.uleb128 0x6
+	.long	.LASF1146
+	.value	0x120
+	.byte	0x5
+	.long	0x3b4
+	.long	0x48b
+	.uleb128 0x9
+	.long	.LASF1147
+	.value	0x120
+	.byte	0x22
+	.long	0xa4
+	.uleb128 0x9
+	.long	.LASF1148
+	.value	0x120
+	.byte	0x34
+	.long	0x48b
+	.uleb128 0x9
+	.long	.LASF1149
+	.value	0x120
+	.byte	0x41
+	.long	0x48b
+	.uleb128 0x10
+	.uleb128 0x15
+	.string	"p"
+	.value	0x124
+	.byte	0x10
+	.long	0xa4
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa4
+	.uleb128 0x28
+	.long	.LASF1193
+	.byte	0x6
+	.value	0x11a
+	.byte	0x6
+	.long	0x4c3
+	.uleb128 0x9
+	.long	.LASF1150
+	.value	0x11a
+	.byte	0x25
+	.long	0x3bb
+	.uleb128 0x9
+	.long	.LASF1151
+	.value	0x11a
+	.byte	0x46
+	.long	0x4c3
+	.uleb128 0x29
+	.long	.LASF1152
+	.byte	0x6
+	.value	0x11c
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	0x2fa
+	.uleb128 0x6
+	.long	.LASF1153
+	.value	0x115
+	.byte	0x5
+	.long	0x3b4
+	.long	0x4f0
+	.uleb128 0x7
+	.string	"buf"
+	.value	0x115
+	.byte	0x1f
+	.long	0xa4
+	.uleb128 0x7
+	.string	"dt"
+	.value	0x115
+	.byte	0x30
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1154
+	.value	0x110
+	.byte	0x5
+	.long	0x3b4
+	.long	0x518
+	.uleb128 0x7
+	.string	"buf"
+	.value	0x110
+	.byte	0x1d
+	.long	0xa4
+	.uleb128 0x7
+	.string	"dt"
+	.value	0x110
+	.byte	0x2e
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1155
+	.value	0x10b
+	.byte	0xa
+	.long	0xe5
+	.long	0x533
+	.uleb128 0x7
+	.string	"t"
+	.value	0x10b
+	.byte	0x26
+	.long	0x41d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1156
+	.value	0x106
+	.byte	0x9
+	.long	0xc1
+	.long	0x54e
+	.uleb128 0x7
+	.string	"t"
+	.value	0x106
+	.byte	0x26
+	.long	0x41d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1157
+	.value	0x101
+	.byte	0xb
+	.long	0x27a
+	.long	0x577
+	.uleb128 0x9
+	.long	.LASF1158
+	.value	0x101
+	.byte	0x1f
+	.long	0xc1
+	.uleb128 0x9
+	.long	.LASF1134
+	.value	0x101
+	.byte	0x2e
+	.long	0xe5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1171
+	.byte	0xe1
+	.byte	0xc
+	.long	0x3b4
+	.long	0x5fd
+	.uleb128 0xc
+	.string	"buf"
+	.byte	0xe1
+	.byte	0x21
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF1159
+	.byte	0xe1
+	.byte	0x32
+	.long	0x3bb
+	.uleb128 0x4
+	.long	.LASF1152
+	.byte	0xe1
+	.byte	0x44
+	.long	0xb5
+	.uleb128 0x4
+	.long	.LASF1160
+	.byte	0xe1
+	.byte	0x51
+	.long	0x3b4
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0xe3
+	.byte	0x10
+	.long	0x2ee
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0xe5
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0xe6
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0xe7
+	.byte	0x9
+	.long	0x3b4
+	.uleb128 0x1c
+	.long	0x5ef
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0xed
+	.byte	0x41
+	.long	0x7c
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0xfc
+	.byte	0x4c
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1181
+	.byte	0xd0
+	.long	0x64a
+	.uleb128 0x4
+	.long	.LASF1167
+	.byte	0xd0
+	.byte	0x2c
+	.long	0x3bb
+	.uleb128 0x4
+	.long	.LASF1168
+	.byte	0xd0
+	.byte	0x4e
+	.long	0x4c3
+	.uleb128 0x4
+	.long	.LASF1132
+	.byte	0xd0
+	.byte	0x68
+	.long	0x64a
+	.uleb128 0x4
+	.long	.LASF1160
+	.byte	0xd0
+	.byte	0x75
+	.long	0x3b4
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0xd2
+	.byte	0xf
+	.long	0x27a
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0xd3
+	.byte	0xf
+	.long	0x27a
+	.byte	0
+	.uleb128 0x5
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF1172
+	.byte	0x98
+	.byte	0xc
+	.long	0x3b4
+	.long	0x69c
+	.uleb128 0xc
+	.string	"t"
+	.byte	0x98
+	.byte	0x1c
+	.long	0x27a
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x9a
+	.byte	0x10
+	.long	0x2ee
+	.uleb128 0x1
+	.long	.LASF1173
+	.byte	0x9c
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1c
+	.long	0x68e
+	.uleb128 0x1
+	.long	.LASF1174
+	.byte	0xbd
+	.byte	0x15
+	.long	0x7c
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.long	.LASF1175
+	.byte	0xc4
+	.byte	0x15
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1176
+	.byte	0x90
+	.byte	0xc
+	.long	0x7c
+	.long	0x6c2
+	.uleb128 0x4
+	.long	.LASF1173
+	.byte	0x90
+	.byte	0x21
+	.long	0x7c
+	.uleb128 0xc
+	.string	"nth"
+	.byte	0x90
+	.byte	0x31
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1177
+	.byte	0x81
+	.byte	0xc
+	.long	0x7c
+	.long	0x707
+	.uleb128 0x4
+	.long	.LASF1178
+	.byte	0x81
+	.byte	0x22
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1179
+	.byte	0x81
+	.byte	0x33
+	.long	0x7c
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0x83
+	.byte	0x9
+	.long	0x707
+	.uleb128 0x17
+	.string	"w"
+	.byte	0x85
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x10
+	.uleb128 0x17
+	.string	"m"
+	.byte	0x87
+	.byte	0xb
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	0x7c
+	.long	0x717
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1180
+	.byte	0x75
+	.byte	0xc
+	.long	0x3b4
+	.long	0x732
+	.uleb128 0x4
+	.long	.LASF1159
+	.byte	0x75
+	.byte	0x2b
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1182
+	.byte	0x6a
+	.long	0x748
+	.uleb128 0x4
+	.long	.LASF1159
+	.byte	0x6a
+	.byte	0x2f
+	.long	0x3bb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1183
+	.byte	0x49
+	.long	0x792
+	.uleb128 0xc
+	.string	"dt"
+	.byte	0x49
+	.byte	0x2b
+	.long	0x3bb
+	.uleb128 0xc
+	.string	"t"
+	.byte	0x49
+	.byte	0x39
+	.long	0x27a
+	.uleb128 0x1
+	.long	.LASF1184
+	.byte	0x4b
+	.byte	0xd
+	.long	0xc1
+	.uleb128 0x1
+	.long	.LASF1185
+	.byte	0x53
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x56
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x5d
+	.byte	0x12
+	.long	0x30
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1186
+	.byte	0x3d
+	.byte	0x12
+	.long	0x27a
+	.long	0x7f9
+	.uleb128 0xc
+	.string	"dt"
+	.byte	0x3d
+	.byte	0x36
+	.long	0x4c3
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0x3f
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x40
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x41
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x17
+	.string	"day"
+	.byte	0x42
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x43
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x44
+	.byte	0x12
+	.long	0x30
+	.uleb128 0x1
+	.long	.LASF1184
+	.byte	0x45
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1194
+	.byte	0x5
+	.byte	0x40
+	.byte	0x6f
+	.long	0x805
+	.uleb128 0x5
+	.long	0x25d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 54
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 10 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.file 12 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 14 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 18 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF733
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.file 27 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1b
+	.file 28 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 29 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1d
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 31 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1f
+	.byte	0x4
+	.file 32 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 33 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1081
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF747
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF840
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF853
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF895
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF918
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF919
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF920
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF921
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF923
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF924
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF925
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF926
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF927
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF928
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF929
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF930
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF931
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF932
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF933
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF934
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF935
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF936
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF937
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF938
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF939
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF999
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1009
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1078
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1195
+	.long	.LASF1196
+	.long	.LASF1197
+	.long	.LASF1198
+	.long	.LASF1199
+	.long	.LASF1200
+	.long	.LASF1201
+	.long	.LASF1202
+	.long	.LASF1203
+	.long	.LASF1204
+	.long	.LASF1205
+	.long	.LASF1206
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x23
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1207
+	.byte	0x8
+	.long	.LASF1208
+	.byte	0x8
+	.long	.LASF1209
+	.byte	0x8
+	.long	.LASF1210
+	.byte	0x3
+	.long	.LASF1211
+	.byte	0x2
+	.long	.LASF1212
+	.byte	0x2
+	.long	.LASF1211
+	.byte	0x4
+	.long	.LASF1213
+	.byte	0x2
+	.long	.LASF1214
+	.byte	0xb
+	.long	.LASF1215
+	.byte	0x2
+	.long	.LASF1216
+	.byte	0xc
+	.long	.LASF1216
+	.byte	0xb
+	.long	.LASF1217
+	.byte	0x8
+	.long	.LASF1218
+	.byte	0xb
+	.long	.LASF1219
+	.byte	0xb
+	.long	.LASF1220
+	.byte	0x8
+	.long	.LASF1221
+	.byte	0x8
+	.long	.LASF1222
+	.byte	0xa
+	.long	.LASF1223
+	.byte	0x8
+	.long	.LASF1224
+	.byte	0x9
+	.long	.LASF1225
+	.byte	0x9
+	.long	.LASF1226
+	.byte	0x8
+	.long	.LASF1227
+	.byte	0x8
+	.long	.LASF1228
+	.byte	0x8
+	.long	.LASF1229
+	.byte	0xc
+	.long	.LASF1230
+	.byte	0xc
+	.long	.LASF1231
+	.byte	0x7
+	.long	.LASF1232
+	.byte	0x6
+	.long	.LASF1233
+	.byte	0x5
+	.long	.LASF1234
+	.byte	0xc
+	.long	.LASF1235
+	.byte	0x6
+	.long	.LASF1236
+	.byte	0x6
+	.long	.LASF1237
+	.byte	0x1
+	.long	.LASF1238
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF838:
+	.string	"USE_CLI_BATCH "
+.LASF1143:
+	.string	"rtcGetDateTime"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF757:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF723:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1184:
+	.string	"unixTime"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF828:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF904:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1045:
+	.string	"PG_CF_END 56"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1164:
+	.string	"retVal"
+.LASF715:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1047:
+	.string	"PG_INAV_START 1000"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF817:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF927:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF998:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF777:
+	.string	"USE_RX_UIB "
+.LASF884:
+	.string	"_WCHAR_T_H "
+.LASF979:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF1097:
+	.string	"int32_t"
+.LASF751:
+	.string	"USE_I2C_PULLUP "
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1147:
+	.string	"formatted"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF770:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1062:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF1025:
+	.string	"PG_SERVO_MIXER 21"
+.LASF895:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1038:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF758:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF919:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF995:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1004:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF765:
+	.string	"USE_TELEMETRY "
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF709:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF996:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF471:
+	.string	"__P(args) args"
+.LASF963:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF803:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF856:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF975:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF823:
+	.string	"USE_SERIALRX_SUMD "
+.LASF790:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF950:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF937:
+	.string	"USE_VCP"
+.LASF897:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF849:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1161:
+	.string	"local"
+.LASF1023:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1122:
+	.string	"tz_offset"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF885:
+	.string	"___int_wchar_t_h "
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF706:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF750:
+	.string	"I2C2_OVERCLOCK false"
+.LASF992:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF860:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF700:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF917:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF789:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1134:
+	.string	"millis"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1022:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1016:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF946:
+	.string	"U_ID_1 1"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1173:
+	.string	"lastSunday"
+.LASF1015:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF939:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF925:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF841:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1121:
+	.string	"timeConfig_s"
+.LASF1158:
+	.string	"secs"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1136:
+	.string	"started"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF822:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF756:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1177:
+	.string	"lastSundayOfMonth"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1094:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1137:
+	.string	"days"
+.LASF1105:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1102:
+	.string	"float"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF944:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1170:
+	.string	"offsetTime"
+.LASF784:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1026:
+	.string	"PG_IMU_CONFIG 22"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1112:
+	.string	"copy"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF811:
+	.string	"CMS_MENU_OSD "
+.LASF922:
+	.string	"USE_DASHBOARD"
+.LASF1193:
+	.string	"dateTimeUTCToLocal"
+.LASF1153:
+	.string	"dateTimeFormatLocal"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1106:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF976:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF962:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1180:
+	.string	"rtcIsDateTimeValid"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF870:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF782:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF985:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1086:
+	.string	"signed char"
+.LASF702:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1099:
+	.string	"uint8_t"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF820:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF948:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1028:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF794:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1145:
+	.string	"rtcGet"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF918:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1080:
+	.string	"EPOCH_2000_OFFSET 946684800"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1082:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF716:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1176:
+	.string	"nthSundayOfMonth"
+.LASF1032:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1107:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF766:
+	.string	"USE_TELEMETRY_LTM "
+.LASF959:
+	.string	"NOINLINE "
+.LASF952:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF906:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF775:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF960:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1140:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1119:
+	.string	"tz_automatic_dst_e"
+.LASF864:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF892:
+	.string	"NULL"
+.LASF1118:
+	.string	"TZ_AUTO_DST_USA"
+.LASF754:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF956:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF792:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1090:
+	.string	"__uint16_t"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1006:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF913:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF855:
+	.string	"__size_t__ "
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF730:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1128:
+	.string	"_dateTime_s"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1181:
+	.string	"dateTimeWithOffset"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF1033:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1151:
+	.string	"utcDateTime"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF958:
+	.string	"FAST_CODE "
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1059:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF809:
+	.string	"USE_STATS "
+.LASF800:
+	.string	"USE_FRSKYOSD "
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF827:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF981:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1129:
+	.string	"year"
+.LASF997:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1034:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1079:
+	.string	"REFERENCE_YEAR 2000"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF886:
+	.string	"__INT_WCHAR_T_H "
+.LASF1191:
+	.string	"tfp_sprintf"
+.LASF873:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF779:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF745:
+	.string	"_VA_LIST_DEFINED "
+.LASF753:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF755:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1131:
+	.string	"hours"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"USE_UART4 "
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF835:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF737:
+	.string	"__GNUC_VA_LIST "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF693:
+	.string	"bool _Bool"
+.LASF872:
+	.string	"__size_t "
+.LASF1174:
+	.string	"secondSunday"
+.LASF1194:
+	.string	"timeConfig"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1087:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF727:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF881:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF731:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF807:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1104:
+	.string	"PGR_PGN_MASK"
+.LASF821:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF973:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF978:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF719:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF724:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF893:
+	.string	"NULL ((void *)0)"
+.LASF920:
+	.string	"USE_USB_MSC"
+.LASF947:
+	.string	"U_ID_2 2"
+.LASF1169:
+	.string	"initialTime"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1178:
+	.string	"currentYear"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1048:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF1002:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF911:
+	.string	"USE_UART8 "
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF810:
+	.string	"USE_CMS "
+.LASF1165:
+	.string	"_abs0"
+.LASF1166:
+	.string	"_abs1"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF749:
+	.string	"I2C1_OVERCLOCK false"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF802:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF862:
+	.string	"_SIZE_T_ "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF987:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF1051:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF955:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF983:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF859:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1111:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF953:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1061:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1078:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF974:
+	.string	"EXTENDED_FASTRAM "
+.LASF767:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1029:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1124:
+	.string	"timeConfig_t"
+.LASF898:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1053:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1074:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1076:
+	.string	"PG_ID_INVALID 0"
+.LASF734:
+	.string	"_STDARG_H "
+.LASF912:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF850:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1017:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF970:
+	.string	"UNIT_TESTED "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF833:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1044:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF845:
+	.string	"_T_PTRDIFF_ "
+.LASF901:
+	.string	"USE_FAKE_GPS "
+.LASF986:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF915:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF848:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1117:
+	.string	"TZ_AUTO_DST_EU"
+.LASF763:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF762:
+	.string	"USE_GPS "
+.LASF1154:
+	.string	"dateTimeFormatUTC"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF738:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF768:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1024:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF877:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF949:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF982:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF713:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1156:
+	.string	"rtcTimeGetSeconds"
+.LASF1092:
+	.string	"__uint32_t"
+.LASF834:
+	.string	"USE_VTX_TRAMP "
+.LASF1190:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1010:
+	.string	"PG_CF_START 1"
+.LASF858:
+	.string	"_SYS_SIZE_T_H "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF874:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF1185:
+	.string	"years"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF991:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1187:
+	.string	"second"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF694:
+	.string	"true 1"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1188:
+	.string	"minute"
+.LASF879:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF825:
+	.string	"USE_SERIALRX_XBUS "
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF988:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF704:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF940:
+	.string	"USE_RCDEVICE"
+.LASF783:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF461:
+	.string	"__PMT"
+.LASF746:
+	.string	"_VA_LIST_T_H "
+.LASF788:
+	.string	"USE_PITOT_MS4525 "
+.LASF1043:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF707:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1125:
+	.string	"timeConfig_System"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF965:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF712:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF843:
+	.string	"_ANSI_STDDEF_H "
+.LASF1133:
+	.string	"seconds"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1135:
+	.string	"dateTime_t"
+.LASF1127:
+	.string	"rtcTime_t"
+.LASF1009:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF923:
+	.string	"USE_OLED_UG2864"
+.LASF1113:
+	.string	"reset"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1126:
+	.string	"timeConfig_Copy"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1084:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF799:
+	.string	"USE_TELEMETRY_SIM "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF930:
+	.string	"USE_PITOT_ADC"
+.LASF928:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF839:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF692:
+	.string	"_STDBOOL_H "
+.LASF888:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF816:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF846:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF844:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1103:
+	.string	"pgn_t"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1159:
+	.string	"dateTime"
+.LASF1120:
+	.string	"pgRegistry_s"
+.LASF1114:
+	.string	"pgRegistry_t"
+.LASF1069:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF774:
+	.string	"USE_GYRO_KALMAN "
+.LASF867:
+	.string	"_SIZE_T_DECLARED "
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1001:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF695:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1132:
+	.string	"minutes"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF852:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1152:
+	.string	"offset"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1040:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF697:
+	.string	"sq(x) ((x)*(x))"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1021:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF721:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1071:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1068:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF805:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF813:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF729:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF876:
+	.string	"_WCHAR_T "
+.LASF1116:
+	.string	"TZ_AUTO_DST_OFF"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1163:
+	.string	"tz_minutes"
+.LASF899:
+	.string	"USE_FAKE_BARO "
+.LASF866:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1139:
+	.string	"timeConfig_Registry"
+.LASF851:
+	.string	"_GCC_PTRDIFF_T "
+.LASF764:
+	.string	"USE_NAV "
+.LASF798:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF902:
+	.string	"USE_MAG "
+.LASF1073:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1095:
+	.string	"char"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF857:
+	.string	"_SIZE_T "
+.LASF769:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1144:
+	.string	"rtcSet"
+.LASF910:
+	.string	"USE_UART7 "
+.LASF1018:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1013:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF806:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF990:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF900:
+	.string	"USE_FAKE_MAG "
+.LASF914:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1020:
+	.string	"PG_PID_PROFILE 14"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF977:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1083:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF861:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1168:
+	.string	"dateTimeInitial"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1007:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1157:
+	.string	"rtcTimeMake"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1056:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1171:
+	.string	"dateTimeFormat"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF720:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF1057:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1108:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF887:
+	.string	"_GCC_WCHAR_T "
+.LASF1058:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1175:
+	.string	"firstSunday"
+.LASF728:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF701:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF748:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF812:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1110:
+	.string	"size"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF943:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF1030:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF865:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF964:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1100:
+	.string	"uint16_t"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF847:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF804:
+	.string	"USE_D_BOOST "
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF733:
+	.string	"__TFP_PRINTF__ "
+.LASF1085:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF896:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1042:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF708:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1077:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF1041:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF908:
+	.string	"USE_UART5 "
+.LASF993:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF796:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF741:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF1146:
+	.string	"dateTimeSplitFormatted"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1072:
+	.string	"PG_INAV_END 1023"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF957:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF705:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF883:
+	.string	"_WCHAR_T_DEFINED "
+.LASF735:
+	.string	"_ANSI_STDARG_H_ "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF795:
+	.string	"USE_DASHBOARD "
+.LASF1141:
+	.string	"rtcSetDateTime"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1192:
+	.string	"rtcHasTime"
+.LASF1046:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1055:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF836:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF711:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF863:
+	.string	"_BSD_SIZE_T_ "
+.LASF894:
+	.string	"__need_NULL"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1003:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF787:
+	.string	"USE_OPFLOW_MSP "
+.LASF878:
+	.string	"_T_WCHAR "
+.LASF999:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF742:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1088:
+	.string	"__int16_t"
+.LASF1150:
+	.string	"localDateTime"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF786:
+	.string	"USE_OPFLOW_CXOF "
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF830:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF759:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1183:
+	.string	"rtcTimeToDateTime"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF714:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1035:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF880:
+	.string	"_WCHAR_T_ "
+.LASF726:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF780:
+	.string	"USE_RANGEFINDER "
+.LASF1149:
+	.string	"time"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF942:
+	.string	"USE_ITCM_RAM"
+.LASF698:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1049:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF832:
+	.string	"USE_VTX_CONTROL "
+.LASF941:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF882:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF826:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1123:
+	.string	"tz_automatic_dst"
+.LASF718:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF968:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1066:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1130:
+	.string	"month"
+.LASF1138:
+	.string	"pgResetTemplate_timeConfig"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF989:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF871:
+	.string	"_SIZET_ "
+.LASF980:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF909:
+	.string	"USE_UART6 "
+.LASF1063:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1160:
+	.string	"automatic_dst"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF961:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF772:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1142:
+	.string	"rtcGetDateTimeLocal"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF934:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF924:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF936:
+	.string	"USE_ADC"
+.LASF1036:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF932:
+	.string	"USE_1WIRE_DS2482"
+.LASF785:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF933:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1031:
+	.string	"PG_GPS_CONFIG 30"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1075:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1070:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1008:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1089:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1179:
+	.string	"wantedMonth"
+.LASF1039:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF740:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF869:
+	.string	"___int_size_t_h "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF929:
+	.string	"USE_PITOT_MS4525"
+.LASF760:
+	.string	"USE_64BIT_TIME "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1011:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1019:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1096:
+	.string	"int16_t"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF781:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF971:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1000:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF854:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF722:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF972:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF797:
+	.string	"USE_OLED_UG2864 "
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF954:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1155:
+	.string	"rtcTimeGetMillis"
+.LASF725:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF875:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF891:
+	.string	"__need_wchar_t"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1172:
+	.string	"isDST"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1067:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1189:
+	.string	"hour"
+.LASF889:
+	.string	"__DEFINED_wchar_t "
+.LASF994:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF829:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF966:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF744:
+	.string	"_VA_LIST "
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF969:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF793:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF903:
+	.string	"USE_BARO "
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF710:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1093:
+	.string	"__int64_t"
+.LASF739:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF771:
+	.string	"USE_PITOT_ADC "
+.LASF747:
+	.string	"__va_list__ "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1162:
+	.string	"tz_hours"
+.LASF776:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF778:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF935:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1115:
+	.string	"timeMs_t"
+.LASF1064:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF905:
+	.string	"USE_UART2 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF890:
+	.string	"_BSD_WCHAR_T_"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF819:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1101:
+	.string	"uint32_t"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF703:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF1186:
+	.string	"dateTimeToRtcTime"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF931:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF916:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF945:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF921:
+	.string	"USE_SERVO_SBUS"
+.LASF818:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF699:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF938:
+	.string	"USE_RX_PPM"
+.LASF1167:
+	.string	"dateTimeOffset"
+.LASF376:
+	.string	"unix 1"
+.LASF732:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF837:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1081:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF815:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF696:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1109:
+	.string	"pgResetFunc"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1182:
+	.string	"rtcGetDefaultDateTime"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF736:
+	.string	"__need___va_list"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1054:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1027:
+	.string	"PG_RX_CONFIG 24"
+.LASF926:
+	.string	"USE_RANGEFINDER"
+.LASF1014:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF824:
+	.string	"USE_SERIALRX_SUMH "
+.LASF853:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1060:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF808:
+	.string	"USE_LOG "
+.LASF752:
+	.string	"USE_RX_PPM "
+.LASF1091:
+	.string	"__int32_t"
+.LASF1098:
+	.string	"int64_t"
+.LASF761:
+	.string	"USE_BLACKBOX "
+.LASF1005:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF842:
+	.string	"_STDDEF_H_ "
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF831:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF984:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF951:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1052:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1037:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF967:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF868:
+	.string	"__DEFINED_size_t "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF717:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1148:
+	.string	"date"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF840:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF743:
+	.string	"_VA_LIST_ "
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF773:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1012:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF814:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1050:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1065:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF791:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF801:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1238:
+	.string	"parameter_group_ids.h"
+.LASF1204:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1225:
+	.string	"stubs-64.h"
+.LASF1205:
+	.string	"/usr/include"
+.LASF1208:
+	.string	"stdint-intn.h"
+.LASF1212:
+	.string	"time.c"
+.LASF1198:
+	.string	"src/main/drivers"
+.LASF1200:
+	.string	"src/main/target"
+.LASF1228:
+	.string	"wchar.h"
+.LASF1218:
+	.string	"features.h"
+.LASF1213:
+	.string	"printf.h"
+.LASF1221:
+	.string	"timesize.h"
+.LASF1201:
+	.string	"src/main"
+.LASF1209:
+	.string	"stdint-uintn.h"
+.LASF1207:
+	.string	"types.h"
+.LASF1229:
+	.string	"stdbool.h"
+.LASF1217:
+	.string	"libc-header-start.h"
+.LASF1206:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1215:
+	.string	"maths.h"
+.LASF1203:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1227:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1211:
+	.string	"time.h"
+.LASF1230:
+	.string	"stdarg.h"
+.LASF1199:
+	.string	"src/main/target/SITL"
+.LASF1202:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1226:
+	.string	"typesizes.h"
+.LASF1224:
+	.string	"stubs.h"
+.LASF1197:
+	.string	"src/main/config"
+.LASF1234:
+	.string	"stddef.h"
+.LASF1219:
+	.string	"features-time64.h"
+.LASF1236:
+	.string	"common_post.h"
+.LASF1232:
+	.string	"common.h"
+.LASF1233:
+	.string	"target.h"
+.LASF1222:
+	.string	"cdefs.h"
+.LASF1237:
+	.string	"build_config.h"
+.LASF0:
+	.string	"./src/main/common/time.c"
+.LASF1231:
+	.string	"platform.h"
+.LASF1195:
+	.string	"src/main/build"
+.LASF1210:
+	.string	"parameter_group.h"
+.LASF1223:
+	.string	"long-double.h"
+.LASF1220:
+	.string	"wordsize.h"
+.LASF1235:
+	.string	"sanity_check.h"
+.LASF1196:
+	.string	"src/main/common"
+.LASF1214:
+	.string	"stdc-predef.h"
+.LASF1216:
+	.string	"stdint.h"
+	.text
+	.section	.gnu.lto_.profile.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`K\001\r\n"
+	.string	"\364\016?\002"
+	.string	"\033"
+	.string	"\340\357\363\334\006\020\002"
+	.string	"\002\001\002\003\001\243\214\302\266\b\002\246\203\274\310\b\024\002"
+	.string	"\002\004\004\003\231\261\364\247\t\016\002\002\002\002\004\004\265\250\332\356\016\034\002\005\002\006\006\002\006\005\362\363\341\210\r\032\002"
+	.string	"\002\007\002"
+	.string	"\002\b\002\002\002\b\b\002\b\006\240\342\234\212\n\007\317\326\222\244\n\004\002\t\b\276\341\303\n\"\002\n\t\255\336\353\375\t\004\002\013\002\013\002\f\002\f\n\352\263\360\321\b\013\363\356\313\331\013"
+	.string	"\f\373\264\320\336\004\002\r\201\250\217\320\007\016\264\245\211\377\003"
+	.string	"\017\354\237\301\330\016\002\002\n\002\007\020\240\340\342\330\r\006\021\274\201\374\343\007\b\002\r\016\022\350\270\274\253\013\002\023\342\261\303\217\017\024\261\300\347I\004\025\317\204\234\236\b\024\026\245\272\233\340\f"
+	.string	"\027\275\213\223\353\030\245\367\347\320\t\031\276\372\246\264\007\032\240\342\234\212\n"
+	.ascii	"% \220\202*\253n\035'\307\b 3\fr\200\302\270\001TG1\257\304Z"
+	.ascii	"\333\270a>\313\004z\f\363\340\226Fb[\206U\b\325/\370(\260\343"
+	.ascii	":\0267m\341`j\0337\322p gp\016L\003\034\003\n@0\300_\273\343"
+	.ascii	"z\261\235T\013n"
+	.text
+	.section	.gnu.lto_.ipa_sra.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`$\001\365\006"
+	.string	"\342I\032\032\200\247I\007b`\006f`\206pDl\324\244\251\021\242ov\311\266\275\245L\001\337\037\205\340\310\016<\223\027(XD\352T\007\337\026\032\221Q\374Qh\325"
+	.ascii	"\200\032\016\361>EJ\236\032|\021\204M\236\342\337\375Y\310\233"
+	.ascii	"\233\302\232\321fX\374)\224\225\375\221RJ\351\250a\2615\020\210"
+	.ascii	"=r\020\254P\331[\243\206'\267 7 \300\202\2319zS\031@c\360\250"
+	.ascii	"\303h\013\305e\032\004\250l8:\f}\230n\212Y\033~\321_4\344^\254"
+	.ascii	"`\202E\307gQ\025\206G\004\0268\013\337\"\331_\244G\020Y\\4d\343"
+	.ascii	"\b\270\0042\013>82\\\007\231\t\\]r\203\300]\311n\373\016\323"
+	.ascii	"\342To,\226\307\035\314!\030\327\210Q\020\2127\303\030\367`5"
+	.ascii	"\"9 \354/\336\020"
+	.text
+	.section	.gnu.lto_.inline.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`}\007\235\034"
+	.string	"\266f~F\360\316(\035\330\210A\355\315~`0\364\235$2h\035>\201\237\203\226j\230\321\364\bX>\317k\321Wy\222\314\222\002\177\224\213|\257\307{\347rbpq\253\263\363{\234\002k\377\333\206i\373\301\375\244m\231d\n`"
+	.string	"o"
+	.string	"j"
+	.ascii	"\253\273x\345\254=\302\317\306\004\260B\327\364u\262Y>\204\243"
+	.ascii	"CS@m\253\236\231N\026\265\200\243C\003\342\177\277~\256S\276"
+	.ascii	"bwK~\256g\332\177vw\344{0\177\252>\254\353b\364\241\241?K\337"
+	.ascii	"\247\235\263k\272\273\373\352\354Y\215\352^\260\017\307\324\335"
+	.ascii	"\323$\247\212\002\355\256\207\315r|\tn\235\226\036\220\255\303"
+	.ascii	"\230s\262\350\004\231\231\033H\f\226\344\356\302\026\201\211"
+	.ascii	"\027\227\344\004\266\373-\361P\272]\317\244\213\335LI\261;\201"
+	.ascii	"\237"
+	.string	"\376\354* \371\020\356\372\020\345\351\357n\202\335\215\261;b\037N\245R\035\236\222\\\304Z\322\307@\366\270\222\347\245\036\271\223\351!Ywq\026\345\bg\326\017d\247\245\034\341X\331!WoA\235H\022.\"\204\blD\3034\301\223h\210rC\303/\206\344\3164\350\030SL\321\266\353\251\257g\212p\256\303\250:WN\264\273\002L\262\314\2266\251\314f\231\355\266O\3206\203\n76\024\\\356[\221\020\n\207\330\030\331\3377\325\004\021\214\275c\3479v\263\3509~\352\311p<56\267\020\256\365\264\332\314\"\235\202s\353\"/\006\311\246A\325\340\262\314v\341\205\204\234\222[&q\333\020\343\344\234 \025\207\031# \264\"k\366\\\325>\244\302'H\303\252T\317MN\213h\257\350\316\203\022 R7\320\202\032\f'w\330i\032|g\234\335\3350\n\305\331\266\355\256\2069Tg\251z:M\337w"
+	.string	"\317\224o\251\364h\r\216\221-\263\231N6M\241\277\253\274\201\203\f3!\243;WT\306\207\200\316\250!E\307\220\314\210$IA2\034p\002!\"\"\363\022`EE\fR\210DDJ\242T\206\3757\357\211\207\311TE\026kF\rBvp\331R\rGI\224\204\240\331\b\342W-\005\355D\035\027\323\261\345v2\277$\330\314\260s\377\3378X["
+	.ascii	"\371\366a\360q(}\212B\212H\251\234\211\t\215\2551\025U\371R\353"
+	.ascii	"\246\266.UJ\301\035\355\207\341\373r\271\200\336\217\313\031"
+	.ascii	"`\005\327\001\255\235\301%\3175J5\240'J-U\017\264\023PP\360*"
+	.ascii	"\377N)@\221E\244\3629\026|\332\345\007O\271 JB\364\004\374P%"
+	.ascii	"(5\r(I<\314\233D\300\257\240g\325c\022\314\356fhb7\242a\217\345"
+	.ascii	"i\t\234`\313\310\355\214NxK\237\266\377z\022\263\205\260\263"
+	.ascii	"\364\375\221\035\256\250\r\313\221\366\2659a\026\220\266\325"
+	.ascii	"\225\214r\377\350\302\034[\206+\327)\001\312\bVG9\2068$\021\275"
+	.ascii	"\025\333`\210)\222^\023\204\200\236\314<\313\033\030\327:\375"
+	.ascii	"(0%\343\204v\t\303\266m\361\036\362\026\220\371B\353\243\207"
+	.ascii	"\027~V\361 G$`\215\342\021#\030\241Pz\n\032\021j\252l\3420m\265"
+	.ascii	"c\3122\030.\351\224\302y\262\261\245\243\237\235\311\353i\355"
+	.ascii	"\247\200ZC\333\236\2775h\b\r\"2r1D!ZG\254\243\232{\007\345c\355"
+	.ascii	"c\326\003\215U\340\235\245OO\004\364Y\344\347\220?\017\336I\336"
+	.ascii	"F\305\337g,b\031\225\244{,.\337\3749\037\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`#\003\245\f"
+	.string	"\026\322:6`5J:\3250xd\021\263\002p\336F\035"
+	.string	""
+	.string	"\206J\254\300\272\207\031m\366E\202Y1\004l\371E\324\332C\037\177\3330\340\007\3645\332\027\377\b[\334D\246\035)"
+	.string	"*"
+	.string	","
+	.string	"7\321\307"
+	.string	"\206h\356\222#M\231{+\225\306\354\306\354;\244\364~\201\245iAl\224&6%\337\336k\177\225\343\3345\003\001\215O\354'\303*\016<\340\336OFQ\200t\341\220a\030\206}\004\246^\2744\035\315;\366\021\374#\343\362K\314E\323\213\246\036\227\222\314m`\257\372\343[Q\021\212\2324\023 G5\333;\356{ F\211\263\200\017p?\211\207\206\305\n\355\0221\227&\246\352'\b\027\352\\\226'\324\271\254\bk\304pY\033\017D\347\2624\243\206\313\332\034^Z\337\202\225C(E\271;\2104#\315\252\t\372\333\344\216\006/\334D\250a9Cr#\242\205)I\2061P\242\201\352\330\001\022\200\321q\002\006\307Q\245\214"
+	.ascii	"\233\232\345Y\336\255\006\320\320\205\243\214\276\202r/\311\234"
+	.ascii	"\005\227\007H\230\324\016P\225G\246&D\241\317\027kTF\264!BQK"
+	.ascii	"\230\020k\256\n\0227XD\"2\217\204]\256\313\3467\204\370\037\214"
+	.ascii	"\360]\353\254\332\377\240\220i\255\323F\001\321\f(\372 \322\372"
+	.ascii	"\005\225PGJ[\3738\025\264#\315\033H]\033\332'\202\313\305\334"
+	.ascii	"\252\212%\32203\022\341dU\034\005\314\364:\373\240\346\324\256"
+	.ascii	">\006\357e\214b\376\204\333\003"
+	.text
+	.section	.gnu.lto_.pureconst.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 D\355\001"
+	.string	"BD\016\026\220+\035\270l\302\334\335\335!\356f\332y\274\357\273jy\023\341;\027\272\317\251n\316mf\314\271\\\345&\027\031\217\321x\025'q\033Na\026\274\036\2013\215\247\356.\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`A\001\375\007"
+	.string	"r\312#-pK\222\016\220\375O\017"
+	.string	"\310T\032\204\201\271\241*C&\212"
+	.string	""
+	.string	"S\272\3051\374\243"
+	.string	"D\007\324D\335\026\033\213%P+\211\244I\231\002#HT\023+$\020\n\036\030<\b=\263\240/\223\025\247A\002\321\250n\272\007F\265)\224;\312\246\027\031\030\221\177\342\022\f\274\300\177\337|\312\237\t\003\244e\343\307\213a\250n\212D\214j\020\243\326BGy\304]"
+	.ascii	"G\345(Zp$f\321\3767o\355yo\352\300\2649\277'\224\377:\016]\210"
+	.ascii	"/ @\002b(\253\033\336\016\270\337u\262\300\371\004*\252\211<"
+	.ascii	"\376\264M\3040\300lS}.eh\017\267C\241\005L\254\237\267.Z\030"
+	.ascii	" \314h\3169 _8M\206\003\r$\3501\234D\350\245\214\306\030\234"
+	.ascii	"+\277r\352\320i\031.\357m\\ j\033B\205D\324\002\274\027\2002"
+	.ascii	"A\3543\022k\240;3\3033\2731C\261}\005\030\002"
+	.text
+	.section	.gnu.lto_.lto.d3756b604e863765,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_days.15.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`|\001\305\013"
+	.string	"\206SD<\020%9k\360\3140\202<\001\371\352\336\306)\343\224q\366$9E\020\371\367}\263\221 %\250\214j\200w\316\373\002@\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200,"
+	.string	"\304\325)\320"
+	.string	"\025\200Sk+\2737\3556"
+	.string	"2"
+	.string	"4"
+	.ascii	"\243^\027\231}\344\366\324\270j\2440l\341\201\341\340+B\211f"
+	.ascii	"]\203w\361\235\367\005\036\002\b\035V,\232\002\016[\213\002?"
+	.ascii	"\213\207"
+	.string	"\340w\200\264\b~\2719\256C\b\253\317O\310Y\243\243\234\236\262\272\312\353\255\331Wnw\215\263\\\327\r\"m\254@\233DF*D\203(m\272\274cs\217\317?\310O\243\203\234\036\262\032\032\235\312\345\362\327\346\260\317c\344/\243\303\234\036\263\272\314\353\262\331g\267\317\214\323t5/\302+y(O\3669|\030\337\351\213}\001\256\305-K.7\331<\334$\263\267\334^3\3563J(\260\271\234\266\371\315\3475r\234\321sN\327Y\335\366\372\316\354\267\333y\306{8\002\003\316\305\001M1\307\254o\335D\027< `\023Qs\363IQ(\262\022m\207\024\346Zk\245]\333Zi\327\264&\332\f}[k\244]\323Zi\327\264&\315\265\255\21168t\303\266\326b9n\230\333\206\030w\030nS\f9v.\002\373\240\337P\260#\367\016{e\316e\035\001v\343\260{\337C\333\001\273\256\252\f\211a"
+	.ascii	"\370#\261i\250E"
+	.text
+	.section	.gnu.lto_timeConfig_Registry.19.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007`"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001\212\001\206\200\200\374\342\203\267\217\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\325\006us\356\005uq"
+	.string	"\005\001\006'\001\004\363'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/common/time.c"
+	.string	"\004"
+	.ascii	")\302\303,\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_timeConfig.21.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"\030"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200\020\177}\274\001{\273\001"
+	.text
+	.section	.gnu.lto_dateTimeToRtcTime.22.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`Z\006=$"
+	.string	"ZE\314\016E\200\334M:\237J\376\304\314*-\005[\371\364\254\244jH\354fvw\355\230\r\352\211mAE/E\007\017\272-\314\213~\363gj3\370\314c\337\346\322\310\303\202}\r\215\035`\201\n\221h\215H#\204\310\235R\336"
+	.string	"\302"
+	.string	"\333"
+	.ascii	"`\374\267{\301\372\227+Z\2547NVTa\236\374\241\326\252iu4r\204"
+	.ascii	"\r\231\235]\031\246\245\347\202u\267\254\261X\305\\\244\245\221"
+	.ascii	"58i\024\337\202e\363N\336\326\362\253\374\354V~\345X\236\345"
+	.ascii	"m\346\371$a\003\376\316Z\207\314\231\200\262\026\303\211\212"
+	.ascii	"\232\f\020kia\035\276\240\001\177^?\325\213\310\f&\032\322\230"
+	.ascii	"\001\325\252\320\220\253\265\210\301<\351\023\307T<\025\255\227"
+	.ascii	"e\231/n\230V\210\324\220\253\2652\235t\005\363\344o|P\351#\204"
+	.ascii	"\211\322Oiq\240Z\213\274\321Rk\261\201\201\346I\333\276\224\223"
+	.ascii	"iy\213\250\210\004\007\b=`gvj\255A\027/T\2364\037T\236\334#\337"
+	.ascii	":\335\362\337\3661\n\217:ab/Nu\027j\255\246ab8\356\275m%\333"
+	.ascii	"Tv\t%\2766S\270\350\234\205\346\322T\212\307.v\3215b\177\254"
+	.ascii	"[\304"
+	.string	"6\251\027\360\250\201<\352%\036\265\022\217Z\301\216:\301\313\356\244\233\335HG\273\021<\355\376]\355>\372\332\355;\333\335\373\224\377\200ImtR\027\235\324D'\365\320I]\340\244\026:\251\t\234\324A'\365\200\223\032\350\244\3761\251}Nj\001'u\200\222\032@I\3153\251w%\365YR\233:j]I]\226\324\244\216z\324Q\257\216\232\352\250\317\340\001\235\241:\265\332\230\313S\317\220nK^\366\233\375h\177\332\257\366\257\375l\327\331\367\267\\\214\3153\326\265\370]\036f\251X\211Rk\345i\375\313\325X\221\324\021F\321\rSI\037k\340\214\350\300r\300\006\255\021\231/'\277\005\332\001[\364\263\002\026hK8\237\375\331\203\355!\273\234\323\321loA9\034\016\026\220\324\3525!\356o<\214\376\020\242|X\210\362\244\317\276\355@hcn\0136\301\352\366K\345n\027\254)\030\017\336\223\003\313"
+	.ascii	"+`G\270/'H\033`O\227\017\244\275\031\200EZ\301\344~+y\013`\307"
+	.ascii	"\267\335\362D|\215\323n{mz \330\243\235\213\300\334sG8\335\232"
+	.ascii	"\373\021\207\323\255ol\307o\237V\356\257\351\344\226;\236}\001"
+	.ascii	"\351\242s\036\227\334\223\270\232q{c:\216\366j\273G%\216f\267"
+	.ascii	"\227\303\267_\243\353{\272\031J\321\304z{\266\377\270(\036\177"
+	.ascii	"{K\337\300\366\330P'#4k\365\222\340\217\311\200\302T\322\242"
+	.ascii	"<\371\rUR*TH\r\313*(a\325\0305E\204\022V\225B\253\253)\251aI"
+	.ascii	"uEL1f=Em\n\253)\342\220\244z\022f\215\302\241\024\b\026RSW\246"
+	.ascii	")8x:\021\001B\224\260\351\307*\212\032\252I8\224\262\nN\021\207"
+	.ascii	"C\"TpJ\352i\030\204\242\252\n6\025\231\270BH\025\264\"\022\251"
+	.ascii	"\202\274\"\327m\340\376\270"
+	.string	"\266\313>\230\377\316\345o\273)\327\344\314\035\271\245UZ\340\376\013\210\321.\355\030\007\266\207\213\315=\246T\260J\273s\276\234$\255\202\213\371\316mG\232\032\346f\234\330\215;r\214\366`\356\013\\\\N!\210\275\341s\234\214Vi\354G\322\276\254h\223\366q`U\236\200\325\003K\242-\332\243\270/ \275\035Z\242\365\301=\316\013\354\320\366\364\370Vh\013\354\201\270\n\007\226\004Vh\017\234\035m\320\022\bu\25014\003!2\210\231\thD\222$\311p\020#\031\252m\021p)\206jd\255\0032\374bv\327\271\310s\t\321O\302\220W${\212\003\016bQ\366?\t\357F\226\260\037_\241\300\262\21497\235/\202\343\023p\b\202\027'\361k\f\t@<K8n\276\332^K\2024\n\352d\230Fr0\347\031_uX+\274=2\324\337\317\007)#\354\2661\206\202\320\373\202gK7\246\bt"
+	.ascii	"\250\325|\265\201\274B\364\210\3069\336\276\032v\314\331\256"
+	.ascii	"\2041\330\264\001\262\316\200\321cV2\274D\204M\\\254\264\301"
+	.ascii	"\316-,\023\250h\021\312;\224tN\037\263\211t\231&\252eZ\221\226"
+	.ascii	"5\023\260\253\222P*\346G\362\344!\031\202\301_USw\250"
+	.text
+	.section	.gnu.lto_rtcTimeToDateTime.23.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\312\0075*"
+	.string	"\272J\024\020Fp\336M:\317#%;@\213\362\264\030.EO\257X\027G\263\235\211\034x\032\006\205\220D\266me\263\250\275bL\303?\227\342\f\265@\250\253\234i\2314\234d\334\373\342\246\n>\370\350\277m#d\023\"w\222\001\362"
+	.string	"\330"
+	.string	"\360"
+	.ascii	"c\357r/\314\353\261\221\321\030;\002\244\355\336\033\242\215"
+	.ascii	"K\023\020q\312\340\357\030t\217G\236tyH\177\002!\205\327\362"
+	.ascii	"-\305\207\005\323\033X)\331\026\260\266{\223\302\237\234!\375"
+	.ascii	"\3713{j\2045Y\003\256\354\336\333\2001\244?{f\302W\346_9X\361"
+	.ascii	"Xl\\\350^$i\312\356M6\340`\372\223\223'\262?\323\017\331\237"
+	.ascii	"Ef;Or]\364\210V\225\330\236{\357"
+	.string	"\260\225\360x:\356\233\311\263\355\342w\272\024\265\247\331\265\310\257B\306\254\262n|g\236L\244D\371\032\326\017\363\302\031\0301UU\227\204\207\326\323\257a\371\270\024\254\037\0255\203\356\275\275\254\243\371\240^eQU\273\213\322\343g\002#<\264n\232\030\300\252,\351e\3410[\313\030\032/\353X\373^\256\364ci\225\325\343\025\335p\357\345j\225\305\343\314;3\2431\263\tf\024+\374\262\242\027\261\3418\371\311\267a\177\336\312\315\354\263+\206\363\231\375\265\331\315\2064\263\362\353\223\375g\254q\334\375\353\327\371\271B\006w/\303\326\356>r\310\273\266\t\246j\316X\227\214\302y\r{\324\357>CzQ\325%W%\225\265[\343\230\2237jo\205}u\351\340F\302\faI\250\224\024\004\"\035\313\257\340d\347\337\223\377\321\303\316\276+\317Fie\004f\345\003he\003h\345\"\264r\201\2642\001\264\362"
+	.ascii	"\2642\021ZY@Zy(\255\034 \255,\224V\016\262\225\201\322\312=["
+	.ascii	"\031@"
+	.string	"Z\371\307V\346\331\312;\264\262\316VN\321\312\250\255l\321\312\247\255l\236\225\373\254\\\315\312\217\200v\265)B\273w\307\262\317U;\315\240<\354W\376do\346_\354\001o)P\257\2018\234\255\310\3657nz\313>sB\007\016\355-\32619\225\272\371\324\243\271Q_\251\335\250;\3109V>f\036#F\275\301X\343>'\007\235k\225\372\312\377\200\226\313\345\362Ak\324J^\376-$\233\372$`\276\364\234\226\037\264l\266Q\013\373\212o\366\026'5\200\226\332\222v\254|\370\247\001\364\227\316\006\305\002f\366\3605)|p\356=VP\3634\025&S\223\275U\223\375\371\323\013\342\230\375(\361\274+\311\230\333\275\025\264W^C\021\273\246*\323\222\320\036\354$\2633k\367\213\213`\212<\227\227(b\356\232\3276\r)\2057%\330\2736\323\220^h\3012\007v\220\214\256\231\235n&m]_\256"
+	.ascii	"\260\323\356\2631@`\026\264\231[\234\214m\024\251-\030\322\303"
+	.ascii	"\374\327H\3757\244\327\327\331\314O\037\363\"\275\367R\bN\304"
+	.ascii	"'\0223\236\240d\2441N)&'\032\246\213)\250(\3429u\266\360\200"
+	.ascii	"\211\305\004\t+\234\034\004M\255\250\334\344\300\211\37045\204"
+	.ascii	"\212\"\022\243\232\206POL\304a\223T\214\241\203\"\216\202\341"
+	.ascii	"$5\234\212\212\222\032\362\222\367\272\253\235M\324\327\020\372"
+	.ascii	"\352C\0245cS1\202f\026q=\007\032AW\261\252\271/?\352\003]\211"
+	.ascii	"\030h\346\021w\253#\347Em\240O6\344\020\252\036\320E}d\027\201"
+	.ascii	".\320-V\f\3626\024@\256;)\216\270\354\020h\340\022\263\244\036"
+	.ascii	"\320-&\204\250\231K\234\316\0139+7\343_X\001M\004\241\005t\225"
+	.ascii	"\253\2323\216\001\031jf\023\217s\342\315\312\r\250\354'l\200"
+	.ascii	"\036\352\256#\324A\035@\330B\035\324\365\255j\3168\246\265\266"
+	.ascii	"\353\255$9\351R\263i\362\036\264>\037\234\257\037\366\233\367"
+	.ascii	"\336\253\353\255~\330\177\3066\367\365\022\003\244\\\177\205"
+	.ascii	"\211\t\200\241\250Q<\344\224b\210FFDR\220$i\f\260\002\221\251"
+	.ascii	"\242n\021\200\271Cec\220\032\303\001\240\303\227\353\007Eg\261"
+	.ascii	"Z\216\036\352:\025\373VN\316\376\350\347$\242\351[\255\023\355"
+	.ascii	"\342\373\020\324\313\310\350e\220\356\361\300\362;\214\235\312"
+	.ascii	"$eN\310\326\323\024!t\362L\333\fHJ\201P\265\0050\202\314\314"
+	.ascii	"=\\\360\366;\222\350\3764 \271\002$\025v.\315\253\273\230\003"
+	.ascii	"\276]\037g\377\221D\272?jeK@\232_\204\"\370\346\232\021\016\271"
+	.ascii	"\303h@*v\321\036\216\r\r\020\221C\262\202i\217\330\005\276\324"
+	.ascii	"@\260Q\313u6\326\324\311\0165\354\b\006\211\363\342V\257\227"
+	.ascii	"Y\306~g\223\rOB\036\206\346\267/4\233\300+*\343\263\202,\277"
+	.ascii	"\257\201Y\026\261m\265d3J\310\250\274s\002\257%\344\221Pd\330"
+	.ascii	"\344\216f\024\240\204\347\300I4\210\374^\004\t \377\335\242-"
+	.ascii	"\032\332\232\001ZX\2540\364\305\251\235\312N\006\210\351\016"
+	.ascii	"\343\346\345\005Nw\233\020\224\303\331\263\343C\321\313\370\304"
+	.ascii	"\231\312o|\210\243(\006\002\352I\347,7\304\332\300i\002\251\363"
+	.ascii	"\213\245\327D\201\337Q\026\025"
+	.text
+	.section	.gnu.lto_rtcIsDateTimeValid.25.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\371\002u\023"
+	.string	"F\244}H\340\322&\035c\242\016\236o\347\262\032#\2102O\356\366\231xVQ\210aY6\226B\201W\013w\365%\215\352\344\370~\354\264p3\337\366\016\343\034\254\031\212\242Af\"\264\224\211\211e\2660Bok\204\220\275\267\2242\005j"
+	.string	"`"
+	.string	"j"
+	.string	"A\335!\203'\340T>T\002S%\247\003\246\312\377\177 !\3462\032\242"
+	.string	"7\227\017\033\231\220\356\320\343\023*\243\244\216\333\246\214\2742\327\rE\212 1\273y\265\224\204\240\204\316\216v;\313\255\310\001\261\233\315\316\232\225\0376\226^4\313E9!\242Iw\253\217.\316\313\265\273\241t\367\367\346\245\243/\351\177\331\177\013\377\316\002\352b\305\205K\241\362\n3U*\027\340\3213\263\265o\f\034E\275D\376\260\265\034\3735vw\237a\377\367&\355Q\005 \367$\336wq\317\305\375\026\3673\356e\334\307\270\347\270_\336\353\310F\323Q\022\244\033\254\321:\207\034R\361?\346/\375#&\034\354\376\312B[\304h\017\214\n\350\206\331\bs\343\013`\217\224\002mF\223c7\240\337\234\334\001\234\375\020i\320\031\223\245P\021\236\207\335-K\364\233\222=\200;`hd\311Q\246R\031\321H#\307^\322o2c"
+	.string	"}~\210\264\246\337\\f\2165jF\270\266\366\177\203\312\276e)D\343\331\356n1\307\036"
+	.string	"HYS9\005\004\362s\203f\207\374_\351\013\026\327\335\023\036\247\320\340\264\022\001\202J\352\204$\365\2512\244^N*\334Q'\251O\365\342\261\254\276o\205\362XT\247\317C\265\270x'\007\276\342\220j\361^V\253\026\257\024\2662\354\333)\320\345\026(\211q\376\233\330d\206]'\261\211\325\346hfk\222\3041eZw\253c\3306S\326\354NJ\203\3251\027\244\034\247\200?P:\304\261\024:\342!\351\356\255\202~\0016 \360\002\021\221\353\006@\030\310\214\200\to\274\007\213\bNW\262[\200\240\374\210\026\3543\374F\344\356\275\355\206\005\226\341\035RY\264|\022\303\274b\201\327XV\317\030\016\251}\030S\241\024\362\251f\236\230\362\n\276\206\375\330\211\271\032\215a\211\303\016\013\266&\337QhI^\2642\345\304\340,fO\347Cj\376"
+	.ascii	"\017\263\033w\017\342\"\356!\316\240|#\226\365"
+	.text
+	.section	.gnu.lto_lastSundayOfMonth.26.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`!\006\255$"
+	.string	"\nB0\016J\220\232Q:$B>G\310B0,0\026\031\374T\333\263\256=\230]OX\343\332t}\221"
+	.string	"n/\231\272\341\347\346R\247F\341\244l\231\306\261]`\0041\033\343\265\006\353Z\213N.\300\016\0367\217\376g\263\204\020B\344N2\321"
+	.string	"\274"
+	.string	"\321"
+	.ascii	"G\302;\025\211\034%\332\275\302\337\016\013\351\315\276\td`\202"
+	.ascii	"\230\211\214L\223\234R*\341\t\256{\357\355&W\220M\031v\231\220"
+	.ascii	"\336\224\035\203nO\204\221\374\2727h\264\272\367\376\260-\275"
+	.ascii	"\371 \027\302cF\226\303\032O\350R\t&$c\356\275\270\234\0038o"
+	.ascii	"\226\2679o6\r\216\275"
+	.string	"\034\236a\226w\025\366J\321\323,\333\362\370IW\313RLW\221k9\275(\0374)\031\271\221\311\302tf@\271\370\213f\311\305\227 \324\213\247%\204!@l\\\313\251E\331\304\342\223\367pbaQT\310\370\022I\212/A(\027?S\0257\227l\271\252OJ\266gO\2762\347\336\373\342\355\357i\311ZT\350\336\313\266\351\t\352\034;3Ca\346\f\314\346\225?\327\351\235f\313\304\302g\223l\215-\256$K=V\201)\231\362:JI\241\240N\316\343\233\230A\bX\365\225\234\211M\013\234\221'3+x\221\221\334 \246%L\317&\371\305\303\214+\264\256\355b\036&\331\0262\237\215\350H\312\342\216b\276e\233\317\207\277\201\036\236[\3369\221_\347\226on\331\346U\347Z\315-\323n\231\346\226g\267,\273\345\330-\253\267\f;\361\374\272\345\364\226\321[>o\331\274\345\362\226\373\226\355-\377"
+	.ascii	"L\210\025\333\223{S$\313\334,\363J\307\253~\342O\365f\276\254"
+	.ascii	"+\210\237\204odUV\246\nK\n\f\351\3153\363\370S/\262*\313\022"
+	.ascii	"t$b\214>zP\232\356\351\237\365\252\246gM\323GjHg}c\343\252g\223"
+	.ascii	"/#\217\206b\025\325\204\266\220m\337n\313\333_<\254\306\221\211"
+	.ascii	"\211\3406\375{\325\031\310\350\031\217\0136\305\340\351\023\237"
+	.ascii	"\323\263]|\312\232\247\277d\005\306ZmY\007X\262\002}Z?;\326\002"
+	.ascii	"\266V)X\247\255\366if\005\362`\300\244\3206;\3556\263\002\313"
+	.ascii	"\263\321>\251\254R@\327\351\263M1+p\313\354^\262\366xQ63\377"
+	.ascii	"\304\264\334{\033\274\t\214M\017(\373[\353\016\237M\246g\013"
+	.ascii	"\371\267m\3610avTw{\231\342\322N\3358T\232\206#\013Hi\333\336"
+	.ascii	"\230\332\302Wt\332\366\211e\275\362\331\244\315y2\344\352\026"
+	.ascii	"\362\355;}c\212\213\222%\303\001F\0071b\250\250\024q\016HG:\n"
+	.ascii	"E9\244\243!\021*;H0\264!hAQ\016\210\266\033\312e@:\312\355v!"
+	.ascii	"\210T&\002\312\031u@\302\035\351\214\214tD\270\243\016CF8\242"
+	.ascii	"\035\b\034\020\016\353>\344v8$"
+	.string	"\235n\207S\207\367\035\305\\XU`\267sa\345Hm}s\323,\324k\037\223(\357\rF8U\r\027\321&\331\212\332BF\245^>\355\341x\346\274\275\326\277\033\177\001\013\305\253\247_|z\345X\345\344\351\232\3761\362\254\265\004.Q\2025\326vq\255\205z\266\353\345\275\367\302|\372U\b^k\237\376\n\034`\214a\211X\235\221\361j!k@{\372\325\277\313\300B\201\316\372\257~\333\272\261\254;f\306\0378I\341\226\264\205\\kZ\357\200n\240i\335\001\200\205\250AP\206\220q\206\204D$H\222$\351\220\002\231\251*;\020`g\323\202\024Z\003s\254\027}\023\\\033o`\304\021\215\276~\270\203D\342\337\225\003\204\006w1S\363\341\345\322\316\322f\001J\264\316\277\301gcn\273\311O\352\337I\370n\3762/M\302\250{\244\001\342\230\202C\003\233;\204\304c2_:\323\201\333\355D\302"
+	.string	"\376\200hJ\rD\273U\024\351J\273\350\241\n%#\220\025\244\321\035e\243{\370W\264\022\022%\227\300<gqb\214`\213\272T\363\304\210,+\023\023\n:\325I\210-C"
+	.ascii	"\342\b@\034\001\b\216k\266\330\343\311\353\365kf\213\003q\323"
+	.ascii	"!\226\215\001\007\233!\322\350,\236\326e\022(~D;\260A\347\023"
+	.ascii	"K\b\331S\224\201\244\247 o.zp,/\221\323\305\331:\342\016\235"
+	.ascii	"\016(\224L\004`\206\270LS\260\033P\004Z\\\347T!\315\001S\225"
+	.ascii	"\213T\372/[6\177"
+	.text
+	.section	.gnu.lto_isDST.28.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\332\013\3459"
+	.ascii	":c\270\025CP^N:sf\306\034\007g\340\307[\323>:\312l@.:I\2713\026"
+	.ascii	"xc\\\302wm\337\33762z\016\f\347\322(b\350\360!\244\306\0060\003"
+	.ascii	"\312\367\026\317\013\020\231\272\366\246\251\265\204\020\271"
+	.ascii	"\223\fP\001.\001K\001\203W\217\200\250\370w\374\247\220\022\217"
+	.ascii	"\241Oe\315\273V\002J\034\346\340\275\327\303\301\320`6^\265\314"
+	.ascii	"a|.w\262\361\b\247\313\275\204\375\013\030\361\356i0\273\022"
+	.ascii	"\275W-\303^\361\210\207\252\371-a\267c(qL\215\370e\311\214\336"
+	.ascii	"{\253\256r\005\342\325\247\364\230\206\312Z\3463\237%\354u5^"
+	.ascii	"t\357\033s\357\336\253\200\021\020\257r\363H\353U\342\217\326"
+	.ascii	"\253\016\"\204\261\330\233Kv\f\315\346\320\274\f\336\333\264"
+	.ascii	"j%llI>\333\033\230\265\247\315\363P\213}I)\t)ydTD4\204dj\022"
+	.ascii	":\032\213A\304\341\252\246m\305\370c_\002\242\224\004G\207`\022"
+	.ascii	"\024\350\023\213\344\304/\316&\241\222\2605\371\321\221\222\033"
+	.ascii	"\202FV\203L\272\"\270'\023K\224\016\315v<y\240\332\222tB\237"
+	.ascii	"(\337\371\332\354\320\223\260\0319\322\0329\323\225M\336t\205"
+	.ascii	"\316\n\0259\0221\252q\242\024\223\334\374\t\006\t\tb\2110\234"
+	.ascii	"\3341\t\335\330\346>|\240\032\220\365\314\270\206fU\2634\245"
+	.ascii	"jC\323\003"
+	.string	"\271V\226\"\255AB\347\316CIQ\233\263]\\#\033\262\"\301A\343\356\2466\327vx\341\336\3136m\215\355\f\340\3146\311\314.\230\213\036\002g\313\273\350=r\247\276\206\231\355\374ml\307\246\335)\343\2212\033\210\231Q\034\020\213xo\231\004\376\337\323d\361\233\\\345\255\025\366i+\326\253o+&uJ[\310\305>\305A\243\r\320\277\273\323\005\361\336\3734f./\3734~2\3531.\356\t\274\363!\312\034!\304s\255\037\346&\231\355%\363\273\260\260\220\017\367\033s\025[\236b\313\b\016\260e\003l\271\200T\024[&\300\226\241\330\362\323\355\316\003\234^\367\007`\313M\253e&\325\362\322jYi\265\234\244ZFZ-'U\313GC\313F\252\345\242\3252\321jyh\265\214\\-\013\255\226\217\252e\343j\271\250Z\016\032Z&\252\226\207\317;\257\253e\365}\347t\265\334\253e\273Z~\202"
+	.ascii	"y\332\210,\351\032N\363\356(\374s\325\250|P\336\367\347\375v"
+	.ascii	"\377\227\247\314\367\353\343\227\271\231\rD\344XM\007t\007\231"
+	.ascii	"\247\222\034\321\024\347c62\215\207\341\213\371\030\016?\362"
+	.ascii	"\2641\357\275\306=\275*{z||\202x5\317nB\\S(\216J\265\317\243"
+	.ascii	"\2216\357\332\331\340\232\314)STK5\016$\206\377\300\203J\365"
+	.ascii	"\005\245\365\343\246\215\363m\350@?\017\354\f]\245\372@\333\363"
+	.ascii	"\235\330\006*G\210\347a\266\370\250C\366\222\177&$ro\230\372"
+	.ascii	"\215\337\324o\310\276\033\362I\030U\324GQF}d\204\354\"@9\241"
+	.ascii	"\365W+\321\234#\233\b\360\036\211\277Z\207\344\034\331C\3103"
+	.ascii	"n~|\372\2511\366\022\317\205\372\211OhL\362\251\005\t\312\232"
+	.ascii	"\273b/\257\326cC\265\372\207F\246\303\261\r$=\261\004\032\307"
+	.ascii	"\340\232A\275\344Go\373R\270\310I>\351\220O+OQr\330 6\201n/h"
+	.ascii	"d\222\317)S}\376\340\f\355\2367\260Awc\355%\017h#\232b\033\373"
+	.ascii	"h\201\224\036\212-\200I\224\001}\273?)\255\037V\262\303\016j"
+	.ascii	"f\020\"\354\323\0064\261\203F\334I\202\330\022\230\330\036vC"
+	.ascii	"\321\002)\243xqr\356\250\352\257V\365\357\217\372\345\327\344"
+	.ascii	"\350\030=j\322^\362\360Wk\367\335\270\244)\263}\370\200~\265"
+	.ascii	"\332\356N\335\234\265\221\331Bf6q\347\225\004\333\001\344 \237"
+	.ascii	"<\002O\342\016F\307,\240\303A\341\240\375\206\017\307\022?\334"
+	.ascii	"'j\230sl\370m\330\016\361\336\261\267\375\002\326\253\311\033"
+	.ascii	"`XZ]3@|\311\210\321B\205\221\305WWkuyem\3118nq\265\b\261\365"
+	.ascii	"\205\245E\004\303\322\352\232\001\342K\006\326\213\"S`\200\245"
+	.ascii	"\002\302\003\255\255\005D_\347\254\005[\\-\276\254\272\274\270"
+	.ascii	"\270\274\262\254\272Z`qYe\305\220a\265\200\211\275`l\305\260"
+	.ascii	"\372\362\362\212ael*\337o\234Z\262[k\225o\253\274\245\"\330f"
+	.ascii	"\204\240\377|\n\270\247h\252-\035A;I\006\372\320\203P\002\004"
+	.ascii	"MO\251@_\235\025\237\332\3229\223&\b\252\221f~hzC\002\255\346"
+	.ascii	"9\235\307_l\275\363\033\334\3409\365\214|\261\265\251\251\371"
+	.ascii	"\202\262\311\030,\275\327\315\302\277\374\316\027E\355\324\234"
+	.ascii	"/\214Y@\351R/\0130\311\242(1\265\201+L\320\337\207\230\"II\247"
+	.ascii	"N\227:U\352%%1C\322>\231\276\037\372b\023\301&\222\337QUs\332"
+	.ascii	"\024\325NC'?\247~_\327\235\371\t\222\254\352\367\375IIx\247\256"
+	.ascii	"\362\313\021\310n\355\250\227\b:\255\2036G&\206G Q\031'cF\275"
+	.ascii	"\374\325\232\324S\314\244?\177\037\317Bb\030\2627E\351\220T\257"
+	.ascii	"H\275&\033\311C\262\235\344\324)\001\255}\274?)\237/\312\001"
+	.ascii	"\356\021F-\336\031\242^\006\311A\353\220\007\232\003\200\377"
+	.ascii	"\250QL$\2312$$\022%I\222\f\007\300\002\221\241*n\021\360<\310"
+	.ascii	" \242\221\264\224e?\003M!*\245\377\230\r\236\373J\006\0249^\375"
+	.ascii	"\271#z\316\221\370cv\227\255\223u\241\271s\b\0060\261\325\343"
+	.ascii	"\261\177O\205\212\020.\\\265T\022k\275\036\363\t]\016:\220\304"
+	.ascii	"\257fa\177j!F\302\350E\221\030s\345\310\313\316\b+\013A\020Y"
+	.ascii	"\037\356ZD\327\b\007\251\330\313\305\347f\217:?\220q\310.\032"
+	.ascii	"&\364\210\327\226d\261\021\005\333\336\013\3253\357=\002@\032"
+	.ascii	"\215\001Q\332)2\026\271\303q\212\022\312\321\307R\271\363\342"
+	.ascii	"\220\017\006\316`\303_\211\267\316KO&\375 4\004\243\363\364\203"
+	.ascii	"\320\022\214\372\233\007`(H\025\037\360\026\313\3526;\214\364"
+	.ascii	"\335\215\215\264l\221\272\021X&\342\212G}j\374\2124\232\333X"
+	.ascii	"E\006\030\375\262\270\017\324\314\241.N\265(\216\204\266\200"
+	.ascii	"[\2555\276\307v+\202D\244\247\236\343\342\260_\212\355\3156\331"
+	.ascii	"\201\242)\320K\350|\217C\227\362c'\335K\330\2273\302\370\006"
+	.ascii	"\353L\306t\235\336E9\222\035Q\310\346\230\236\356d\262\340c\203"
+	.ascii	"\004\037\t$\373\211\331VaQ\001\341\260L*\300\354*\244\006\345"
+	.ascii	"\261S\205\\\255j\304\315\034\315r\027Y6\334\260\276\214\312\305"
+	.ascii	".)\"j<>#\324)\306\304\212\002\035O'(~ \371\260TI\306\310\377"
+	.ascii	"\001\354@/4:o\"\225\313\202\206\3364\324\214\004'\333\027\266"
+	.ascii	"\324\316n\366\263w\360O\270Vu\325\310j.\2476\344n\373i\371\223"
+	.ascii	"\223\310\347\225aG3\225y\303\\\257\314\204\237\261\241\257\213"
+	.ascii	"{\024\276\234m\203)\214\304=\363\241T"
+	.text
+	.section	.gnu.lto_dateTimeWithOffset.29.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\362\005\265$"
+	.string	"jBP\016H\220ZU:"
+	.string	"\200L\272\344\343\026\013\004\201\030\320\003bIK\372\321\355\331\265\200\360\353\023\233t\237\336\337\337\246\023 \300\377\310\255f\325\007\344\200\346\274\021\316W\200\227\013\353H\374k\366\202y\026\301\256\250\244\021B\344N2\322"
+	.string	"\306"
+	.string	"\323"
+	.ascii	"Rv\346\315\261\336&\bH\326\003?_O\266\324~J\212K\331\r\255\267"
+	.ascii	"\351;\246\252\214q`<J\nf\330\317\376\223O1\214\307\310\221g\336"
+	.ascii	"\034=\027\370\004\b\224R\224\215Y\212\367\033\254\341\022\226"
+	.ascii	"\t\222u\357=\360\223\223\230\347\311vZ\346\005\016|o\302\342"
+	.ascii	"\353\200\"\226\261J\004\017[/Q\252\342\320d\263k\213\241\236"
+	.ascii	"\013dR\234\220\376\344\021\332"
+	.string	"n\231o\274\022\337\243\\\334\347^'\253*\367\256\t\330@\372\223\327\007\241?\323\003@\177\262\217Y\315\327\247\333\372\361$t\022\347\336[\353\037\367\3754\333\372\370-#\327\220\270\364\363\306M\030\021h[%\3020i\367\336O\335\306 2Y\3332\272\367\262\035\022\233\316\350\231\331\003371\237s\002\2742\331\366\301|\363\336{\271\235\230c\226\211b\226g\247\345\241\230e\241G\375A@o\362\377\304,\373|\311\337\023\263,\213YV\277\376\261K\235_\252e\227\314r*\263\3342-\243\247\345\363\264l\236\226[\265lc\226/@\275s\005\201\312\2754\226u\256\362L\016\271\324\317|~\226_!u\2712\202\357_L\320~\353\255q\306v\332\203\341[\335\013\322\277\230\260\353\255q\343\361(#\375\331c}\337\222\243\001\327K\274_l0{.|-\257B\372\226\234\271^\342\213\343\361\n\323\2374\363"
+	.string	"\320,HV\216Ew\205C\222IRw\314\262\242c\206\235\n3\214S\034\n\037\331Gx\b)\032\357\2750\376\224s\330\"\273\250})0\247qqe\021\265\254\325\376\325\201\322\004\213\275\\\316\232\250\331\ns0\331%[\241>-\353~\023,r\266O?\315\325_I\034a\224\377\214\244\r1U*\024 \340\344\246h\f\036\314\331\350\354s9m\250\315>\273\311\004\213\021\316Th\267\331D^\202Elw\031\020\035R!|\245\236Q\305\320\361\263K\346'_J\241\036\352\013\357\374\306\374-\204\004\313_I\"W\236\222!*\021<%\257\364O\3753\306\274\201\222\223\325\302:\017}\317\372v\202I&\273\344S\371+\231$\f\362\251\031\033Pr\332@\371\324\356VX\303O9\315\"\265\274\177\274\204\036?K\207\177l\254\231?\204\260\037\276[\364"
+	.string	"\366\022[$U\230k\351p\274\334\211\0239\035\312;\302\361\314\336s\260\335\253\307#\021\342(\327\273\351v\275\025\267\030\017\327[\221\224\323\265N\334r\275\\\022\005\031?Pp+\321\200\001\t\\QO\017\307+Q\342\002N\227\313\200\353\335H\250|T\204\323\345z\265\244\235N\267;\252%\345n\272\332\221\n^\255h\306;\0248\025\265\336n\247\242\006[\1777o;\261U\373Pp\212&P?\353MT\253\375\352\030\026\226\312_31\377xk\351\360\314\276:\250\231/`\260\0372\rF/1\322\316\253/u\002\275\213\227{\036\2526P[2*\033W\363`}\310&m\327\rmu\332\226*Xl\361 \327\334<\232\243\375\250"
+	.string	"Vmf\r\033\354\207h\257\270\275\367.u\373\340\263@\177z\004\2233@\033z\250Q$\007\225B\006\231!\031\221 M\232\016\200\002\231\251\253:\021\260=TEI\332\357?\300\256K\r\016\026~\310\037S\247K\020Kb\341RA\314\346\370\300\207lcK$\250\022`\301o\263\247\235Wc\013\304\266\215\256h\201\224\021\341Q!\252\302\004\013\037\f\245h\333+nu\230\311\314\321M|\274\022M\364T\261\365X\365\b[\252\357r\320\360\367\276\263\227\031\372+s\204j\2513-\003\327\024!\2716l\337\343\320\242\t\247S\235\230\032R{&\003R\244$\230\007\f\006\202{,\313\272\221\224\3745\246\341H\205;\342\360b>\fv\227\024\032o"
+	.string	"M"
+	.string	"\2120(\323\220\375@\2769\304v\316\376T\345\202Ta\034\026\340\004\346\256Fh\221\320"
+	.ascii	"\257\2144\377\036?L\260\350\316\301\030\302y\263\361$\007\341"
+	.ascii	"\374\237r\223\026\253'\243\304\032\020\002\025\252T\337\025\024"
+	.ascii	"\313\256l\312\373\003"
+	.text
+	.section	.gnu.lto_dateTimeFormat.30.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`T\t\3254"
+	.ascii	"\352^\310\024D`\246N\007\203\022q\340\355$\366i\347:6\331\217"
+	.ascii	"\017n|8\t\224\030@\310Ip\240\327b\236\240j\2450\034\020pc\362"
+	.ascii	"\227\232\025i\033\372\217f:\277\211W*\244\274\032\363\375\343"
+	.ascii	"\222\336d\313\235dJ\0017\001#\001?\001d\316<\204\315f\024\226"
+	.ascii	"oDK\341_'C\303Y\257\001l6s+F\344\226y\216\333\351ht\253\216\277"
+	.ascii	"\373\253\335\213\207q\246\267\255\252O\344\\\314\227\317\025"
+	.ascii	"\323,\027b\005\203\227sY\r9\240[\234Q\036[\013\343d\353M\350"
+	.ascii	"_\034\314\227\3035]\323\030\233`\211\267l\3139\267H\0357\235"
+	.ascii	"\255\260\373\r\254)\214\315?\246\226y\313'\307\275\"U\327\204"
+	.ascii	"\370:\0270g\017\020y[\326\215(\"\304X<\313\227k\261q\215\362"
+	.ascii	"\230X\017\271\234\313\034\264\207\324\261\321U\223\302g\275\350"
+	.ascii	"`H\035\253H\341\275\335\276t\267/\267\202\303\001\344\214\304"
+	.ascii	"\213\\\316\254\203f\220:n\326\221P\307\251\013@\035wwOI\370j"
+	.ascii	"0g\331~\370V/\353\226\274\234\331\250_s0O}(>\377\202\265"
+	.string	"\3734\234mW\376\220%\303<uJ3\033\342\276\223\351,M\020\242\344z\006\333\034\251\343\255;=)\033rQ!\216\325$\362l\3129\373H\352\270g\020\377\263\001\236\030?D\311\261\023\351\007\0232o\375\362H\212\335\353\323\220s\356K\2264\363\376yw\233uw\224\356_\007>\306[\257\224\254{\370\342:Y7\255\037\326N\177\276\257\203\204\230R\356\234\r\020\236\3347\030\372\337\"\013\235\261\013\250\235\376\376\377\265\263\006i\267\201\372\337\367u\214\330\335k\327\342\376GI\212\034\357^\037\351)\233z\334\301P\177\363/k:1j\3465\365\300]\246\221'\b\312\343\325\353\"\"wGM'M=\371\352u\263b\367\325\272\375\314\217\244\333\255\2703\300\267\027\340\333A\005\316\272'p.\356N\352m\004\370v\001\177\363&\340p\336L\036\347\2754\300Yo%|;\351w\033\t\337>\002\336\026\200o\007"
+	.string	"\336\006\200o\033\001o\027\341\333D\300\333C\370\266\020\360\266\212o\003\177\267\177};Mo\373\322\333hz\033\343\333g\337\376\276}\323\333\376"
+	.string	"A\240\263\"k_>\016\233\177\354\005\312l\360\\\023\177s\207s\217s\237\363\263\333U<jZU\361\354r\022m\273\302f\231wT#l4\255\252n\3164\235g\263\354;\356\326\354\360r\244^\327\2556\r\037\323^f\t\215\355l\3518k\234"
+	.ascii	"no\275\204hK\316\226\247\322\017x\362\245\367\326\221\320\342"
+	.ascii	"dY\263\364\013\376\200\0352/\231\226\355\034\235\242<\252q\227"
+	.ascii	"\302l\242\330+k\352\031\360\316\022x\177C_\315\337\334\204\322"
+	.ascii	"L\021\031\367\326\3237\202\224M\274c\035\020\336V\261\321\211"
+	.ascii	"Pj\363\214P\022CU\"\351\312\035\367\2726\201\344vGu\302[*9|n"
+	.ascii	"\227*^\205z]\253\360\266\212HN\316yB\022\033\237c\235\003\273"
+	.ascii	"L\271+\343)\237*\312\346\036'\343Mt7\347\034\206_\255\325\325"
+	.ascii	"ne~\360\321\2658\246\347\001\354\222fe\276\202G\327\302\254\314"
+	.ascii	"\373\344K\317\303[\017*y\234\005O\333y\023\274\322\363h\343i"
+	.ascii	"\200\253\364\335,\254\256\223\245/A9\366a\355\255\003\231\255"
+	.ascii	"\322;\273t\257^3\265\206\343\371j\255W\022\233\263N\245<\272"
+	.ascii	"\335\005\337\341\334\214\022\301\007\337\321\3705b\267\016\362"
+	.ascii	"=\202\357\213\004\204\346I\313if4\035\322\3178\nDy\204\343\370"
+	.ascii	"}\317\024\0069\207\3061\2244!f\225;\005\357q\336\204\276\202"
+	.ascii	"\277t\353\240\013\276\204\342G\337\221T\360\033\230S\244\250"
+	.ascii	"\355.\337s\013V\202\017\2355%\025\264\2205%\025\304\nvA\220\n"
+	.ascii	"BY@1%\025t\320\025A*\b\365@\252\330\342\312\n\307\270\302\"\306"
+	.ascii	"\300E\256.\"\f\253\033\306\26484v\311\320\332\262\272a\004\306"
+	.ascii	"\270Ja\034r\241\306b\226\025\226\226\361j\213h\354\272\0322\016"
+	.ascii	"\213.\\\020\321\341\226\026\212\241\361*+\355\nRW.\"@\310\032"
+	.ascii	"B\031\271\350j\361\215\0055\334\3222F\311 nm\021\261\242dh]m"
+	.ascii	"Eaq\025\243\240\226\2328c\310\025e$\022\271\242T\366\350\217"
+	.ascii	"\244\257\317\301\321\336\031\372\344M\207\026 \360\025\224\307"
+	.ascii	"\027\353\342\231sZ\006\237s\307\303\302\024\324t\231~\301\027"
+	.ascii	"x\340\013=\321\033}\200?\372\244\3671w\307\006%\266\234\221N"
+	.ascii	"\306!E\372\216\005\216\031|w\207\0177\243}X#}\222\212\253\243"
+	.ascii	"\n\351\261\200?:q\305\004\374\017\b\200\017`\342\206\001\370"
+	.ascii	"\241#\202\246\024\275Q\t\337+z\fd\350\211F\270\240\241\377\035"
+	.ascii	"Q_H\204\353Q\251?\324\nj\376\036\370\300+\314u\320\261Ax\263"
+	.ascii	"*m\317#Q\\\342\205:\376\375\017A\253s\346f\345x\367\322W\273"
+	.ascii	".\246O\033\245\357\2214p\255\2632\261\267qt\215\2712O\017\200"
+	.ascii	"\262\25010\006%S\244dD"
+	.string	"DAaA\222t\220\242\231\252\252\007\021\240\255dD\032S\2411\fx\361\201\236\374\324\375\251\304T\\\177G\f$\200\261\225@\213\017\374\250\205r*\277\203\347\037\r\004L\210\212\003\037\250 `\002*\b0\351\324\333\026\320\257\204\305\006\001\231\225T\006\265\310\303\276\355\017\374\235j\003$\004H\334C\206\005\031\017\330\260U?\324\251\317\2227\301i\337\306\022\257\006\357\177\021\375\nJ]u\361@'\354\023f\203\205\313\235\201\321\342{\370B\360r_\216\206p/\2327c!\2473\034D(\313@g\215\340&\337\035\205\211\321\017\212\265e\243\3569\346\"\215\335[|\023E%\226c\006\275\317p\344Pwu0zaGh&\020\007Z\016X\200@2ZY\2352\204\243\032\246\312\275\260\206\244O\025\005\307\205N\006\247\225\236\212\310\214}\215Q\210\247N\260SD\322\254*'\306\263\3447\374d\266S\022\311\351"
+	.string	"@\325\332Gr\030\3110\223\344\352\361Ll\253\203\\\f\267\\\213\277\347\265aG\216\022\2339Ev\222M\374TwR\031\364\313U\3153Nfq\21753a\234\324|\237\371\210\331\346`6\233<X \323\374Y\235\177\342\200"
+	.ascii	"\023\222\252\254\222\b/\022\333/\274\247\360\353\017"
+	.text
+	.section	.gnu.lto_rtcTimeMake.31.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\235"
+	.string	"\375\n"
+	.string	"\326UN?0Q\223\016\203(<\231\003\364\006c\372\201\352=\0069\237\224\225\361\377\031Y\300\377\350\346[\267\326\222\3001\002'\006h"
+	.string	"I6\f\f\302\204\342UC\022\230\262\244\207\223\316\346\304\356\275\245L)<"
+	.string	"@"
+	.string	"6"
+	.string	"\320\362l\373!.\202s\207@\347\241#\302\260 \"\321\330\335\312\335\007\304\303\351\002\342\241vx\347\331\361O:\314\200\202\305\210\303\363\2248\330]\347\210\243\343\326\3336`\373\201\375\003\001. \250\330\275P\262\261-`\212\017\366Op6\305\236\304\240^\236\344\227\270\t\356!\024\fw7\214\210\354v\224\033L\207\225\234\214P\231'\341\2178\b\367\256\202\001\354z\200\210\354.e\004\323\003\252\372$/\356\025\361\232\2523B @Y\362\323\353e\210n|\262d\212\307f\r\273\363\244r\260\377vw\255\037\266\323\361!?|\367?\230V\230N\230\376\024"
+	.string	"C\033\226\311`Y4\203\004\030\t\013\024D\270.\225\315\272\266g\353re\030\247\322hY\246Y\225\006\303d\225\265\331\252K\001k\023\256M\305\321\264ME\351\366o\365#\252\345\243 \253\246F}H\003\f\r"
+	.ascii	"\2049E&\336\nEC\177\001@x\017*\023u\315\236\032B\203\023y\252"
+	.ascii	"=\220\373\244\256\230\332I\006"
+	.text
+	.section	.gnu.lto_rtcTimeGetSeconds.32.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"\225\t"
+	.string	"\266\022D; \005)\035\347,\205\f%\b@\261\2058\325g\261\205\340`\227\r\350]\310\r\035\367\277\376\311\310\017\024Ip\3507"
+	.string	"`$\025>>\016\024C\246(\312\261\250\2465\262\211\224)\0052"
+	.string	"3"
+	.string	"/"
+	.string	"^m\240H\214\033\331x\261\334\354n\367\371\001\367\270\335\200{\324\220\257\236+\377\264o3\227\026X\214\365\344H\354\256\023\026\353\270\365\266\023lG\330\266\t\347\nLf&\302]\2160\300\312\304\230\022\333\267\277\242\262=\266@m!\3634\177v\025\325\301\324\tve/0\273 \203\025:\217\006;\266}\224\247\250\002Gq\327\324\013\3108qeh\277\206\201\352\220\370)\356\361z\032\r\217V\206\366|l\002\260AV*\210\375mUf;\035\017\376\233\246S\323\001\206h\bU<8P\214@\003\247[\004\032y\244SW\372<\357\023u%R\310\353D\246\213\016\204\340\317bd\352N\337g\352<\340~[\225E\375\264\324\345\324\250\177\r\340\324\004\013"
+	.string	"i\231\"3\236\325h\201&\324\247\321\034\2320\\\023+\224\211"
+	.ascii	"\307\214T\323&a\222\001"
+	.text
+	.section	.gnu.lto_rtcTimeGetMillis.33.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"m\t"
+	.string	"\366\222C9 \261\322\001\277\202\020P\201\001XC \334\350<\007\202\327*F\r\352\221\0161\271\231;\323\207n\t\323\rz\005\200\f0\244$\362!\210@\024\345\034\210m\210l\262eJ\0012"
+	.string	"2"
+	.string	"0"
+	.string	")\253t\3124:[\207\353$fwz\236\023t\227\372\201\3562\202\\uU\371\257\235\243\331^^\260\325u\003\261\273\326\027l\343\216\267}`\373\3016L\352w\002\263\225\210\226\335\214pfU\344M\304\366\355\227\244\354\216\r KP}\315\247\235$\365\211z\300n\f%ew*\030\201s\351\311\261\355\217|\026\336\270\374\324=j<\315\305\255\245\241}\023\213\023'\304Gu\227\217g\301\340`i\350\216\307\252\214=W\032?\354s\033c\266\325\362\363\347\242ZcvX"
+	.string	"M40H\210>\036\323\035\372\210\276\221\311#\201\337\007\206<\322\b\364y\241R\205\367)0H!*y&\020,y\235\271\3476\306d4`\305\2265\312xW\rK\303\n"
+	.ascii	"i\231\"3\236\325h\001Zh\207&`\327\304\ne\"\3001#\325\264I\230"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_dateTimeFormatUTC.34.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`T"
+	.string	"\035\t"
+	.string	"\006\322A; \345*\035\200\305\034\3418\226P\302\020p\241\345\005R\241\214\242\200(\254\252\250\035\272\272\006\343\2202i@\rw"
+	.string	"\202\004\200\267%\212Uf:\273"
+	.string	"\02417\376\022\315\256r\247\0240"
+	.string	"/"
+	.string	"."
+	.string	"\321\266\035\"Vf}\322b'\241\275Tn\273S\352\310Y\207,\377(OHyq\315\254\310Z\207\002\024\273k\b\223y\334z\333\n\266'l\313\004\033\023]Jl\337\366\312\346\330\233\016\217N\r\030\211\356q\263\036\b\355\237\274\266\272m\343\004\273\263Z\313\356d\360B\367\350y\003\356\261{\001\367W\205j\2532\340aQA /m\231\023\262\260\306\236-\250\"\366\003vw\2553\333\320\361\363\327\333~\310\375\303\344FS\301\262\033\013"
+	.string	" \251\0214\250!T\202x\030\221>\003%\225\205Z\364!y\246\224<}\236\367\211\344\311\024\362\244\b\205!?\007\376.H(\231\372>\224\344\314\275\243\"p\250\313\034\354\274\023\t"
+	.ascii	"{\231\"34\030!\"\334\022\270\214\b\n\301e\220P\023_\327|\002"
+	.text
+	.section	.gnu.lto_dateTimeFormatLocal.35.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\275\n"
+	.string	"\206\225MA m\225\0163`\031R\226\020\206\020E\200\315\345\371"
+	.string	""
+	.string	"9\304\321\022\020{\003\025{\240\352^\300\201\216\021\364\313\367\025"
+	.string	"`\021\314\023\250\017\016'\372r\355S\216\310\007\025\217\336|\022\264\211\224)\0059"
+	.string	"<"
+	.string	"7"
+	.string	"\207\216\327\220\034r\317\220\034\332\266\b\200\221I\217\025To]@\305d\273\261S\n'=I\3769\274\003\006\342U\242\303\252\364\334\n\354\2563\265\202p\353m{\330&`\237#\333\343\017\357\3725\230N-}\356\021Vv\302"
+	.string	"\212]\325L\305\212\200\0370\330\036\331\024{2\302\242\261\201\211\001\334\341$\204%\323~\206k\030\335\345\340\030\273\254\r\036v#\210?\270\025\224\226|M=\t\324\n;\301c\036\267\373 \200\377:\354\363-\034zA(\237:\364C\222\303+\246\3452\345\314\024\t\233)\354xJ\235`_\333\335\265\262l\247\003\242MZ@H\246\203\031\331p.\027\035\006\007\324\232\013\307\363\210\272\317\347y\237\246\373x2^\247\001\205\272\313\206?\005\034P'\372>PG\211\246{\323\212IO\266H\313S\241jj#\360\344S\233\006\013"
+	.ascii	"{\231\"34\030\001>\\1\250\354^\327\354\213\t\035\024\202\313"
+	.ascii	" \241&\276\256\371\004"
+	.text
+	.section	.gnu.lto_dateTimeUTCToLocal.36.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\374"
+	.string	"5\r"
+	.string	"&Z]D\020q\224\016@,X\342k"
+	.string	"\227\253N\350\310R\357\206l\215\024\251\022\2515T@\316\355\002\032\013\374\bY\377|f\365\035\344{\234dj\204O\024,\231\312\251~\304J\313BW\020r\377\355\215\310&{\247\024E"
+	.string	"J"
+	.string	"H"
+	.string	"\234C\373$_\341\035\325\341"
+	.string	"vM/Pv\253\002\037\230\227\256\347\300.\347\003`\227\366\354\031\257&\366'*H\252\225\335\315b\211{\207\236\177\325/\337\b\310\341\006\204\3355\374FB\334\361\266\013\330\266`\277\013\273\353h\262_\177y\324\177]\320\237/\255VhL\200\261\373\241UcW2\005\305S\277\375\253\214\271\244\340\330\366Kn\342=\3651\027e\222N$\254]\020\b.Ma^j\340\345\304\201\225\203"
+	.string	"\315\212\230x\2200//\"\0020\301\317\342*\f\363\223\361\212\366'\003\374g\002\244\bb\230\322\022\343\361\251_\306\247bs?\241sW\204\343\267\270\213\r\376\211K\207D\360\337\245/\302.\037\r\234P#\3302G\251\262\250,l\261k\b\214$\354_\033\335\026\362x(\246u\"\214\035,\350x\0320\270\260m4\033\367\251\260u\235\b\035\035\215vd\254m6\356\323e\036\224\343\250\226y|:\\\246\201B\331f\200\251\206\r\224u\224\2022L\035\375\332h\262,\255XX\243\030\342\217kw\304\003V\tl9\023\021"
+	.ascii	"@\021U9\007\316\f\r5\006\253\211\332jTK\033\302\b!\023\252\260"
+	.ascii	"\3175\373\ns\004\232\200\202#@s\020j \270s\213v>\001"
+	.text
+	.section	.gnu.lto_dateTimeSplitFormatted.37.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\224\002}\025"
+	.string	"v'\215I\300\324Qc\224F:Nt\024Q\313\035\314\2043H\350A\265\223\033\354 5\003\337|\025\206\306\214\322\341\3433\3732B '\345%UI\1776E\303\230\016B\246+\345\324v\356\363o\210\312\204\177<\203\334mK)eJ\001v"
+	.string	"r"
+	.string	"|"
+	.string	"s\332\237\361#\233#\345.\340\336\337\320\351\336R\201\021\220\267.\2572\336\222O\031oc\016l\254{I\324\363\242\032:A$\367\2260\212\302\343\324\2355\332J\247\316\2779\353\345\323\341\361\361\346\350\302\347\326\032UEM\r}\"^k\204#\031E/\237\207J\201J9\\>\234I/\374\204\222\342M\r}>\237\254\226{\257g\317\007\342&o[\307\366\005{\302\b\317\360S&\261\272\363\312.o&\035\262\377\200\330#\205\351\317>\360?y\371\003h\035\351gy\332\326:M\347\364|\360~\200\0039!)R\241\351\336\236\342\222\013\304\342`\361\340o\237l\022\363i\370B\273\310b\314\016\346~s>\264z;LD\356-\023\334\332\002y{\333\306v\331\244\025\260\206"
+	.string	"\312\305I\332\231 \025\243eM\225\013yK\362\210\005\367\216-\372\340\017\354\346\225Y^i\213\376\302\377D\210\237\271\024\364\323a+\255\364\224\307NyA<n\364\231:\340r\343\355"
+	.string	"\242#\273\0263f\376\350Y\261\374t\322\311$\307\2107\213N)AdQ\177IC\356\025d\205_3\336\252P\221\330\315\242_OA\006n\004\031\251t\310P\307\215\224\332\222\250p\246\022\237<\001\021i\324\020\340\220\232E\037<\006\023;\341k\f\241'\0054\237\321dnuv\223\301TCX \213i\300"
+	.ascii	"f\266\202\0023\273\335d4[-\246\345\227\225\031M\346\006\233\251"
+	.ascii	"\321h\265\027\330\214\214\214\006{\261m\200\255\024p\215ff\203"
+	.ascii	"\335j5\033\314U\336\323\237\004*\037JM\243\257\033/<\005\252"
+	.ascii	"\035JM\365\327\215\326R\267\354(O\005\213\016\2715\264-j{\223"
+	.ascii	"E\253}\033\247\324E\210\317\304\001GRz\236\021\273Z\024\252\264"
+	.ascii	"e7\257^\357\r4 p\002\231Y\325\003Q\0368\r|\363\006\210\3318j"
+	.ascii	"\033\233~\tl\017CV\t$\212\377\214\026\003\027\031\272.Jb\357"
+	.ascii	"\252\031{\\\234\316\321\322\222\215C+k\214-\327u=9\271\013\216"
+	.ascii	"=\341[+\t5\260\205\351\241\314\225\305}\217\253V\024\034\037"
+	.ascii	"\375\300\001\246\235<\rsX\301\255\232+@40`\201A[\221\324\340"
+	.ascii	"nX\r<\226\026z\004\262\342^\227y\002"
+	.text
+	.section	.gnu.lto_rtcHasTime.38.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 \377\355\006"
+	.string	"\022\01625@\215\222\016\360:\307\354\232\317\177H\306\254\376\237\316\263\030\220\272^,\023\376\177|\306\351\177\2345\025\377\3128X\007\347C\277-[\377\033\241\317\332\266\266\211L\001c\025Kv\321<\214\226e\032\3660\227\205\354a\231\206W\031Xc\260d\236F\3232\357\332\262hB$"
+	.string	"a\350\273\241\024\021+B\205\\\352\253\321\215\315\265\330\201\343:\252u9\224ZE\201\023\004\310\245\276\"\322\231\374\366q(\361\25523G\323\357F\347n\025\200\"Q\350\310$\245Nr\304\002\271\370\373\315\350\374\365\001BgO\267\nRO\"\"\216\222\314\355!E=u\236[\214V!\036\037\243\322\247\016 !3w\243\322C\307\376\005\277\301?\021\006"
+	.ascii	"2\001k8\343\003/@r\031\030\356\234\251\235O"
+	.text
+	.section	.gnu.lto_rtcGet.39.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\355"
+	.string	"\365\f"
+	.string	"\206Y[D"
+	.string	"\221(\035\340\021d&\020\016\3014\326gO\342\231\363\273g\027\260u\032\001\b"
+	.string	"G&-b\233K\277\301\353\007\001V\265\bl\322/Be\360Z\301\013\3158\267H\265\367\202j\374\030<N\320\336[\312\224\002G"
+	.string	"D"
+	.string	"G"
+	.string	"/"
+	.ascii	"\377\262\023\200\177\266\355 B\311\246G\022(_\241a\342\002\333"
+	.ascii	"\215\232\216\270\351N\323\344\007P\221\334e"
+	.string	"\036\256\016\301*eF\200\n\345\022\304x\231\234\365<Q\225dvx\354\2563\245\352p\277\333\246`{\202}\220.\355\234\316\354)&`6,\304\354\242\304r\354\353\275\260\330\276\337\272k\344\321\272\302\201bw7\177~k\304\336\374\335\217%{cg'\026d\236\345\253\370\212\322[H\347\354\256X`\354F\006V\220\3759\006\266\b:=\353\034W\212\226\314\f\230\222\244\261\317\342.\"\277\2049\220\362)\022\374sj`\345\303)c\276\353\027^dl\326<\0205`2g\035C\210\327\314\215\315\032;\242RU\354\273\335]\353\312v\032\276\345\177\001\226\320\340\003\004\302\203\f\237\316\200\321\355\351|@!#Md\003\2016\217&\022\362\001\322<!\221\3269\340M\303'\244\215\266-\244m\342\351Na\005\230\230\026/\3227\301\324\023\265\307IQ\016@>\265\267\r\371\024T\247$\247\021\021s\241\252\342\021"
+	.ascii	"iM\371Bh0Bh1T\021\237e\241\024f\257\241m\251!>\027\213ga\321"
+	.ascii	"\270\020\332K\250\3542\033\036*bSW\323\030\024\024"
+	.text
+	.section	.gnu.lto_rtcSet.40.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\335\n"
+	.string	"6\326N?0O5\034\263rC\226\032\013\f\0265\366m\272N\337\306\242q\344t\336\":\317^\227\237\330\337Q\333<\367&\247z\023\006)\305c\227`\274n\004\004R\021\022\001\350S\264\321\336[\312\224\002;"
+	.string	":"
+	.string	"<"
+	.string	"\376\340\256y|d\273\306\235c\273f\333\003\ft\034~\314 \272\006X\b\204kw\354\024\303\303g\350_u\t\007\226\005\024!F\236'F\202\335u\212#\322\255\267\355a\033\201}I\273\273\326\222\375\324\277i:\323\264f\351\324\3643\276A\202k\205\002\026\273\242\230\2135\241\2158\331\276\375\261cCl\216\004 \363*\337\303?t\236\342|c\267t\022\261;\006\by\361\332S\210-\325k\246I\002\002\n\2241\247\252>\364\202K\373A&/\246.\250"
+	.string	"R\217\375\025\270\341L>g\273v=,\302\204O\306\034\241\240\342\325\332la\217\236\324\013\366\263> \200\322\240"
+	.string	"\001\006\226\211\206\346\256L,\336E\323a>\317\373*\035\346B\361\272\n\230\351&\035\376\034X\300N\363}`\007\031\367\331j\311\0177\355\360B}\024\344,1:\221\251\277:k\343\233\354q\002\n"
+	.ascii	"iMq\330xl\204;\264\250\331\020\"\317\270\237\206\310gB\226\270"
+	.ascii	"\fz]\223\f"
+	.text
+	.section	.gnu.lto_rtcGetDateTime.41.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`>\004\r\034"
+	.string	"f1\261I\240VRc"
+	.string	"\3674\231^G\034\006\0043\177\036\225\353\351\034\326\310f\201\373\277\373\341\260:\265O"
+	.string	":\261BBd\374\212\273\330\224\363\200\231<\b\327\320k\340\211\310[\202\226)I\301\034\274\215\020\256\r\264m\357-eJ\001\227"
+	.string	"\230"
+	.string	"\240"
+	.string	"7\253M\344\027m\233y\301\331\250\320\257\211\025\265\244\257\024`\367\256\300\335\364\004\332L\013\256V\373\304\013!\272\324\320\005\334\313tD\353^t\201\023\320n\032\375\314y\223\366\001\347M\333n"
+	.ascii	"\201\310\277\243M*\276C)\211j\354^4gs\374\367\323,m\375\371E"
+	.ascii	"?\201`\231\266\313\325\215+U\302\027/K\007HcC\031!R\031C\226"
+	.ascii	"T\345\305\243jK\004L3\2202B\243\222\346IW\322\215\257JB\244Z"
+	.ascii	"g6\367^\327\240\220\305=\273m\236m\013vI\024\300Z\346\333\360"
+	.ascii	"\370\342qzh!\271\334Zf\243F\325\342\260_^\313d\273\032\206V]"
+	.ascii	"\273\324o\272\272\322\252?@\201\330\322p\007\n{\005\275*\222"
+	.ascii	"_n\227\271\305\343\350o\337G\362\254\022\307\362\201\034PK\304"
+	.ascii	"\033\201\256\254\213\024\312\n\355\321|\340f\365V@G{\036\260"
+	.ascii	"\272^\005d\333\220\224\260mOm\233\203>\345\033Q\240eix\357\265"
+	.ascii	"\235\252\310\220\215\321\211[V5iB\304\335\224!\342j=U\320\213"
+	.ascii	"\f\025@/\213K\311\320\"\216\3354\205\023\t\262m\001Mb\300\232"
+	.ascii	"\364\323\303\244A\214\234&\026E\003\031f\332S\235f\346\307\323"
+	.ascii	"m\330\005\254e\326\350\324\264\305\274=\001\250\267\246\265y"
+	.ascii	"t\365A\323 \331\"\333Z\314\222\031\307\006\\LZ\224\277\023\306"
+	.ascii	"\202 \222\345\250\222\235FL5\340\004\265D\364\215>\"\352\203"
+	.ascii	"0\266\264E'\253\221<b-t\326\354\215\0270\025U\f\243\202\345\250"
+	.ascii	"\222\331\337:\227\220\357\344]\257>\330;o\326\354M\007\f`M\372"
+	.ascii	"Y\277\331:b\335\214\0016\026f\374\r\224\343\325qd\240\310\260"
+	.ascii	"\251\027{1^\367\336\007ou\232\272\235\317\006\235o\247\207\346"
+	.ascii	"\273%0\330\t\361\300A\217\256&\200\257\247\232\247F\267\363\361"
+	.ascii	"\345F\360v;\036On\204\317\316.\307\363\003\224\2531`\036\t\335"
+	.ascii	"O\316\307\343\375\344l\266\215\002_^\313\344\363k\230f\231g\362"
+	.ascii	"\027\177\341\013F\232U\376\277\263Z%k\033\2405\262Py\257\215"
+	.ascii	"\n`S5yB\375\307\023\022\f\b\005\303\263\3504)\311p/\002\\U4\334"
+	.ascii	"\n\201$97\247r\033\"\345O\215\363)3B\376\034\016\217\222s\363"
+	.ascii	"\252i\324Q\347|\352\016\177\242#\023\301w\342\373\340;\r\235"
+	.ascii	"7o\001X\25014\307\230Rff$\030\021\231MRl\240\242\0312\353\020"
+	.ascii	"hH\233\244\306\001c\253b+\245f\251b\333\310)\375_\023\270\311"
+	.ascii	"\332dv\342\221\357D\321Y\304\211p\311*2\037J\006\020>\027\032"
+	.ascii	"\253\260\340\257\243\233\246yN\323:\022E\362\001t\024 c\204]"
+	.ascii	"\345+\033N`\205\210\335\375z8\273\231\344\220\361ksID;\025>\r"
+	.ascii	"\210\310\352\350Ro\306\2207\246;\350sCj\0067\005\247\350\177"
+	.ascii	"\214\035\343=~\341eC\334\215k\274\023\246q\214N\342k\335\261"
+	.ascii	"\224\321S>\257T\026\316\230&\r2\357n\377e\016\023\022\t\212\273"
+	.ascii	"\225m\207)\204\233\027\374d\240\177"
+	.text
+	.section	.gnu.lto_rtcGetDateTimeLocal.42.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`\271"
+	.string	"\275\013"
+	.string	"V\326RB\020Q\225\016p\016\367\006\332\3473*p\364W\365% >\002\343\224b\355\344U?\200\335\344W\323\226\006\t&\365b\204&\025\364@\035E\004"
+	.string	"AU(\267\r\311A@\001\372\353\324k\244\221M\244L)A"
+	.string	"="
+	.string	"A"
+	.string	"\017F\366\036\216\3608\211\217\323\212\327n\270\251\210{\3074=\377;\2467Db\230\260"
+	.string	"?\\1\214\351\005\002"
+	.string	"X\302,''\031g=S )\223\222\331]'\n\364p\307\333\226`;\202\375\004\001kU\331_\3751}\355!$\257\032\024Z\273\036;t,I\204a\302\366\310\256\330\024\227\202L\373'\216b\364\325\206\013\330U\271p\355\206\013\214@{tx\002\331\243\366\001\331\243m7\b\316pP\022V`\244D\313\250\030By\224\017\230\364\263eD\244\304&\256\025\210\332\313\256\025T\314(\345\211cF\2653h\310\243\256\030\220\222~>\353\023B:\340\260\261\231\303\016\277\324\020\366\261\335\r\206\300@c\301\001\206\323\271\004\020q\322\233K\207\363\210\266O\307q\335f\373x4\334\266\001\205\266\213\001w\027:\240M\324u\240\255\022\356U\345\214F\211\326\213|\212\237\365\374h\265\320\337\313RS\266S\003\017"
+	.ascii	"rM\231Ch\236:H\034VP\355\261\205%\264Z\025\036\002\261\242iX"
+	.ascii	"\245\013^\362\306T\306\254H\225\016E\255\202\002"
+	.text
+	.section	.gnu.lto_rtcSetDateTime.43.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`c\001\235\017"
+	.string	"V\037mF\340\222*\035C\350n\226\232"
+	.string	"\034\201\034\335C\247E"
+	.string	"*\375\266\0346_-e\211\351\302\030\360\003"
+	.string	"\256\301\326\234\313@\202.\251\343\245\265\225\3214d\230\301\252\022v\203\343\325\234q\036\353HHL\355\223M\266L)V"
+	.string	"Z"
+	.string	"Z"
+	.ascii	";Z\324\354.\350\322\023<\035\022 U\373\264\273P\335\005\304\t"
+	.ascii	"\354\316^\310\354N\006^\340\271\364\274\001\357\322\363\002\336"
+	.ascii	"\245m;\210\240\362\352sE\345)Z^\267\334\356\374\342\211\257\256"
+	.ascii	"+\377\265w-46B\030\353\332!\331]k\b\213\335\361\266\025\330\246"
+	.ascii	"`\037H\366<\265\354\250\273\273\374\321S_\344@\016\207\206\230"
+	.ascii	"]"
+	.string	"\225\234!{C\316X\341\303\034g\177\234\372\213\177\213\267\032\271\335\375\334\206\"q\211\330\016\006\315\244\201.=1\220\324\333R\237(\004sc\033bt\320r\227>L\312\376\\\336V\3715\177:(@\366D\371\246\214\020y\005\217^T\032),.\315q\027e\374\013\247\2459\016\240>\256\003I\037v1\203\314\025Y>\356\026pn\277PB\306\346\307\313k(\001+\341m\037\321\031!\217\237\257 k\351\215\001h\214v\t\324\207\217\030d!\"\313:\023$\307\352\215=]\032M\330\357vw\035g\266\247\001\247[B\203\022\016\020\036\230\214B\003N&jQhT\"\235\276\023\260T\002E\337\t\251\244\364\211L\037\276P\002\203\036F\246\357\004\202\246\357c\333\263\365n\343\314_y#\255\350\262?\257zc\337\366\327\356\351\301\202\305\246\006\346E?\306e\240\370*,B\351C\224wy\036\241\017\031\003\026"
+	.ascii	"\343\032\b\262\030Il\360\200\315\235\305-\226e\034xZ\270\324"
+	.ascii	"\230\237+[\324\264M\033I\252\225r\301\035\250\211\221\2656\305"
+	.ascii	"w\217Y\310T\371Y!\fH\321e\242\212h\272\346\023"
+	.text
+	.section	.gnu.lto_rtcGet.part.0.55.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`H\001\215\016"
+	.string	"\346\333aE\360\222(\035J\006\311]y\313\346@\221\273\273\232\243$4\2722\251\250\004\214=\376].\201\021\\\202\027}\304\364\373\237 \251j\347~\n\270\270\2013\2010\\\322\005\276\340\255\344\032\305\340\356\264zo\"eJ\001L"
+	.string	"R"
+	.string	"I"
+	.string	"\016\016\255\200sh\357\"\361\220s\003\361\320\276\013\223\224\234X\266MR\202rwO\305\312_v\250\274d\273\336v\250)\336]S\353\374\\\261\244\256\377\236\240\005\020\0249b,#\236\005\256\205\230\354\2569$nx\333\024lO\260\017\013\263\037\333\002k\300\330>\fA\312\253\320\232qC&f=x\rJ\356F>\250\016\0312\031\231\357\323\374Uz\f\253\253G\314\356v\016}\232\322\375\357dw\374\017ew|\372\214i\304[\021,\016\013\006\232\367\374\027\207\201\372\214\351\004v]04v\2759\263\037{M\310_a\r&\350\233\342\241\252\310K\211k\352U\202\244\344\314"
+	.string	"\322\3468\344W\327\013-*M\371\337-\234`\371\260\331\274Iu\261j\327V]\266\323\361\336\017cZ\213i\215\351\204\351\007Xp#\240\265\273\022\226\360\340$C\004\b\030@\236\001\244\373\343\001\211B\244\r\205\023\211\270\317\206\022:\021m\237Q\207\315s\300\334\006\320h#q\334h\353\\[u\371\337\323\004\254&\377.F\ra;\252MRTeUu\261\301\003\207\246~\214\364\327\312F5U\323\203h\251\002\034"
+	.string	"i\231R5\234\333+d\030W\261pj\b\030T\344\266\212\201T\320\203@"
+	.ascii	"y`\204+F`l\200\\6\276\312\306+&\302Qa\f\025!\315\325\005[\301"
+	.ascii	"\263\316\371\fPs\030u\006\222\324\3005\357\277\266\214\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`o\002\025\r"
+	.string	"\004\023k\003"
+	.string	""
+	.string	""
+	.string	"\002\026\177\037\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\017 \300\204\001"
+	.string	""
+	.string	"\003\002\027\177!\214\260\273\304"
+	.string	"\002\031\177\"\002\032\177#\340\201\257\301\034\177$\367\377\377\377\003\005\020%\301"
+	.string	"\002\035\177&\036\177'7\177(\224\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\005\016)\037\177*\272\220\202\002 \177+!\177,\"\177-#\177.$\177/%\1770\252\333\3426&\1771'\1772(\1773)\1774*\1775+\1776\005\0257\305\204\001"
+	.string	"pg_resetdata"
+	.string	""
+	.string	"\005\0238gistry"
+	.string	""
+	.string	"\005\0219\001,\177:\377\037"
+	.string	""
+	.string	"\200\220\200\001-\177;\003\005\002b\003\005\004\357\351\253\312"
+	.string	"\001\202\013\342\032\003\007"
+	.string	"B\003\007\005\201\200\200\200\002\001\242\022\003\007\002\302\027\003\b\007\320\360\372\250\001\001\342\007\003\b\003\023\003\b\033\344k\003\t\034D\003\016\b\017\202\001\003\020\007\242\001\003\023\t\310\377\241\372\001\001\302\001\003\024d\003\025\006\003\025\002\223\327\3232\026\025B\003\026\020\240\276\320\347"
+	.string	"\027\027\204\006"
+	.string	"0 \240\002\031\233\243\007\301\262\264\\W\030\016\007\267\b\034\205\f\370\\1\307k\263p $\206\266\203\310\344\005aT]\217gS\350\206\f\316U\371M\230\206\233`<\277\341\215\tR`\321N\341\317\3759?\367s\370\256\203X\223\t\3637\374\306o\340\317B"
+	.ascii	"o\310\r\b\2603\226f\336\362h\353\241Q\232\226%3\363\353\204\003"
+	.ascii	"\250\2200\363\201\002"
+	.text
+	.section	.gnu.lto_.refs.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375 XM\002"
+	.string	"\342\204\017\032\240E\215\001\377\377\377\377?X\325\2148\270\033k3Z\215\n\"id\313\224\002:\005\225\325\2234\356f\211\223Y\273\027e\353L\220-\363X\341,\326\314a\035\254\201\025\260\225\214\326UA\002"
+	.ascii	";\3054W)\003"
+	.text
+	.section	.gnu.lto_.decls.d3756b604e863765,"e",@progbits
+	.string	"(\265/\375`D\"\345\232"
+	.ascii	"\252\360\3304P R\322I\007\257\334tH\026\025\001\001\217\377\236"
+	.ascii	"U"
+	.string	"Dt\005\002\274\253\231\211\353\307\273!\006d2\235\004\317\336|\255\035\020\022\212\245\301(V4\022\007\210\212*\255JDUe!@\210\252\252TSS\004\"\255\252\006F\253`H\2324\262\245L\001\271\002A\003V\003\351yU\317K\320\004\346\274\325\301\311\005\362\231\3135\217]\236\336\220F\355\345\020)\013\016J\201\350/%`A\032\325\023\3420\2640\200f\376\206D\2367\332\032=\377\261\030\366#.\321D\321\321\350\331\217\3130\034;\357\035\300'\b\257\037>4\312B}-\316c\206@\354\212t5\252\303Aiz\3658(e0-\316|Ai\263j\275>\030te\2115j\277\224P\233\340\254\2145\372\263\027\336\323\231\0222\b\325\250\336*\204F\275I}5z\316R\317lV\270\274\312\332X\255G\371s\231\276\b\361Z\253\3225F\267\344\n\026\242\032\026\021\b\270\216\2630\234]\335T\034T\202"
+	.string	"\362\372\267\370\037\220\200\353\330\214\325\354\352u\231\276\274\241\270\302\202cP\360\336\365\216\267p\027\316c;\306c.\214\306u\034w\226\343\271\367zo\323\275\367\204\220US\246\005\360\007\275\r\352\3358D\2323\203\312n\374\306h%X\313y\n\227}\270\\\357\332]\203U\2504z\031\324s\211\324\026\026r\211\3640\250gA=\fU\350\205:\202C\244\367@5\301!R>c*\214v"
+	.string	"\247\375\001\tn\225gw\354\336\325\207\2070\n\241\233F\237\201\272\223\342?"
+	.ascii	"^\256\004\317Q\317\007\244\\\310\007\244o\225\005\207H\1778D"
+	.ascii	"\332\034\224J\341\261\003,s\207\363\256\335\273\002\371\254T"
+	.ascii	"OY\215~\345\020\251\312A)\013;\177/i\302\371\371x\346\342\374"
+	.ascii	"vH\306\362\\\020;\f\376\254\002\240\232\363w\222\235@!\244\230"
+	.ascii	"\244\236\277\273\374|\002\020G\304\277\267d\031\376\255\226\376"
+	.ascii	"\355\366\263\231?\n\374~\026\241\f\223!\3617\026k\020\306\004"
+	.ascii	"\337\317`|0\006{\020\260^\036\323\3773\235C\332\317\3374\\\350"
+	.ascii	"o#F\261\345]\376\343\375\277\373_w.\377K\020\360\367\233\377"
+	.ascii	"\204?\373\370o\177\033\345\347\262\237\247\374<\366\263\330\317"
+	.ascii	"d?\233m\371Y\353\347\260\237\241\324\375\367\371\355\215\237"
+	.ascii	"S\374\214\342\177\377\375\302\317t?\277\375\374\374\371\354g"
+	.ascii	"\252\237\233~^\376|\177\336\341\347\025~\326\341g\033?#\177N"
+	.ascii	"\372\371\350\347\031?\023\375<\364\263\013?\263\3603\n?\217\360"
+	.ascii	"\263\213\2377\3709\203\237+\3709\202\237\035\370\271\201\237"
+	.ascii	"G\374\234\300\1773\377\365~>\340g\241\377l~\016\372\037\343\277"
+	.ascii	"\001\377\031\370\231\370?\355\277\226\237\177~\366\371\231\347"
+	.ascii	"\347\236\237\325\237\355\317\3753\377\374\377\205\377\003\377"
+	.ascii	"\303\370\017\304\377\277\377^\376\357\375\037\373\217\301\177"
+	.ascii	"\273\377\"\n\013\013\013\377\024\354G\203~!\244hM\245\235\275"
+	.ascii	"^\251\264\312L\263\nE\216\223\017LS\254\324\235,eem\206Su-_\030"
+	.ascii	"U3l}\233\241^ph\330,\225\312s&&\326d\352\275\227/\207\327\255"
+	.ascii	"\232\032{\223]n\314\253\n_\243-\345rvxXD.\207\372x\223\322\245"
+	.ascii	"\321\333&\265\347\307\223'\035Fd\372\243j\nBy\207\365\024\n1"
+	.ascii	"\036O\025\234\324i\tB\355Y[\262\244\301\032\b`\2237\330\315\\"
+	.ascii	"\355\375\210\322h{\365\327\360JNL\223\257f\262"
+	.string	"\227\346mJO\307\312\316\215\t\223GL\033g\223<55\222\202\243pw\241uW'\301a\242xx\200\2679\205\242\177\340%]\200Q\272\311lU\006\255pQ}x\244\350\253\306zg=\253\271BXoT\214A\252\246\340\255j\232\370{\353\315\325\314\235k\200\317S[\023\252F\237\246\265\210Ol\330\244i\035A G\020=\275\353<e\321\245\031\3418\"B~\3245\372V\242\376\375\247w\331\274\367\362\030\256\327\215i'\345!\017[V\340?z/\330\275F\320\240I\271\\\375@\363\021W\203{O`6]5\201\230\317\245\022H\307z%\305|^I\001\335\365\354\307}f\335\313lr*{y\327+\365s\233\256\244\324\273\004d\256\267\tt\327e\223\357U\223\271\266T\0021\237WJ\346\323)\005\304\\\257\244n\323U\252Mg\36769\245\200\302\326\253\313|.\245~\230O\2472\013\r\227\222"
+	.string	"\332\320zH1\233.\024\001aM\316\246\036su\262\333\275\3125\247\333\344\365\336\253{\255\234$\334\232\224(\335\230\364\240\210UM\253\222\201<1a9qV\246\253\307\004s\322p\272\267\357>E\240d\345z\357\305q\231\224|\257\323\332\274\227\311\031C\225\223\301\340h^\236\333\264\334\301\204\345\334qbr\342\270`EX\212\371\304r\266xK{z]\246U\311^\267\357\252\251>\225\353e\006\362\254i\343\023l\264\247\315\227\2505\2156\021!b\031\233]\330\033\365=\344o\253\026\322O1\350Xm\r\022i\264\0019D\252\302\207\026\357 <M\310\350x6\352"
+	.ascii	"\007\245M\325?\030\355r]\205\323\264\336'\027\235\222\013\215"
+	.ascii	"z\003Q.\355\251\356\036\355\343=\325<v\232z\n\275w\311L\242\207"
+	.ascii	"\231\304P.\311\222\212\031u\035\333\211\212\352r6\272\352\270"
+	.ascii	"\r\2512\025\005\305\023$\355\312\017\255\241\236<x\022\244L\243"
+	.ascii	"\255\243w\274\237\272\207\333O\0218\357]\366\223\317\233{\227"
+	.ascii	">\314$\230I\240bXK\330R\364<F\375;G3\325,Q+l\264o\264\023\243"
+	.ascii	"\375\256q\034\r\323\003\226U\236\312\303-\344\3375\375\016\245"
+	.ascii	"sb\246d\022A\204\362F\344\310\262\rj\204I\233\024e]\332$\355"
+	.ascii	"\356G_B\234\272\270-\203\215\022\262\032n\3233\274\327\371\306"
+	.ascii	"\353\336;\310\205\214\306\204\354\346\374\206\331\236\367^BN"
+	.ascii	"\303j=\366\336!\203^\367\256'\204N\020\347\314\370\300R\024e"
+	.ascii	"-*\257aAF\023\301l\370\314\026\223\024\233\272\303\275,\"\345"
+	.ascii	"\302B\026\021H\254V\217\022\350\336\254</1\273\3322Kf\245\330"
+	.ascii	")\214f\307\354\222\333+\213\325\304ev\314v1\034\353mi0\206g\263"
+	.ascii	"\306\254\227\rc\275\252\237\333\324\366\007x\357=q\"\247\207"
+	.ascii	"+=!=\350\221\377\031\300\304\faJ\031\300{W(6\n\243\331\260\013"
+	.ascii	"\2557\3142\261OX\257j\275<t\260\254j\264\b\2128\301s\006L_\220"
+	.ascii	"\364\211\223\236+\253V`\243\026\254\352\207\335\r\264/F\263M"
+	.ascii	"\322\204\275\271\371;\035\022\2543\365\351\230\372t\211M\242"
+	.ascii	"\362\001\n\301\343R\237\032Q\237:\325\247U\352\323\036\352o\267"
+	.ascii	"\254\326\223\013\032<-\265/]v05\3724J\375\341\240t\204\211!\326"
+	.ascii	"i\247\242`Q\336 R\002\222<+\215\242Bz\013\310\\\240\205j\366"
+	.ascii	"\335\270 3\244\242\276\032\265>\250N\351\262\3040,\211\2259\353"
+	.ascii	"\303oqX \375\024\203\325W\226\221F\25774\243\246\\\254\323\255"
+	.ascii	"\017\353d\251\332l\225jA\320\n\205j\205'xf}\252l\270p\3105j\245"
+	.ascii	"l\017;\005\007\265C,\214z\313c\313K\022'\215\266\215\272m>\325"
+	.ascii	"\212\220\331So\237,\324\221\260;\302-\352\355\2167<\372\314\032"
+	.ascii	"\265:T\247\241\225\0223\fabu\3746\207\355\001\207\302\301>\016"
+	.ascii	"\221\362pPjq\264\270e\352\340\315\001\2265\2723\364R"
+	.ascii	"\211PMMa;\177h>\264\024Q\211\353rI\244G\317M\217(\215~\370\244"
+	.ascii	"\022\357\354\275\275\035\306\367\226\321\001\325\006\f\025BU"
+	.ascii	"]\022v!a\317\361\240O\363O\317o\215\252\222\271\351A7\375\006"
+	.ascii	"\3476\363\250\232a#\252\306\272\236\346\375\006\207I\023\254"
+	.ascii	"\035~\252\312\226&M\263YS\335\252\320X\t\276\3310\327\033\247"
+	.ascii	"\247F{MC\245pP\250\354\032m5\035\225\223\305\224\345KT\017\024"
+	.ascii	"\265\27229\025\247\tx\300\016To\025\261a\226\251&ig\336\201\351"
+	.ascii	"\333\233;g\243\035D\1771\363)7u\246\342\254\2311\323~<&\tU3\f"
+	.ascii	"I[\037\233\022\025\007p\314\307\264\237z\323)m\316\260\312\274"
+	.ascii	"\375\246\206`tPR\2156\231\206\362\013\203\002\263Rs\252\370\272"
+	.ascii	"\217\257\305T\t\322#\270E\213)\314[\f\303\241]\224tAu\2509MR"
+	.ascii	"\3545\230\275\376\002\300u\246qA\001\336\221\261\331\341\345"
+	.ascii	"\375\005\210j7\305\252\b\0335\247\355\256\365\356:/\035\223\303"
+	.ascii	"\312D\216\224\272))x\357<f\216\0173.\274F\273K\003!\262\207$"
+	.ascii	"\214\341\320\262&UG\376\324aa\212\256\343\346\202\326\\\232)"
+	.ascii	"\264^\0361\356.\212[>\365\334\314\364pM\007\327s\351\275\274"
+	.ascii	":\243\232\352U\\\323\305\365\234\252d.\277*\023:W\013\020\200"
+	.ascii	"r\3579\272\033ZVr\f\367\316\276\356\360\324[75g\315\225+\375"
+	.ascii	"\206\243\nUS\320\355\375f\2059(\326hgi(\237!g\354\310\032\355"
+	.ascii	"\266\376R\202\003\r\026n\363D0\314\0313Ug\020\r\255\331T\255"
+	.ascii	"-\252\246`\2257\033q\315s\255\277\210e\3104\273\032m\265\326"
+	.ascii	"z\201v\304J\243\235\326K\035&G\360\234\364\324N\017<\340"
+	.string	"\206(Q\323\261\024o*\347G5\2122\214!h$\223~N\003y4\326`t,\" 9\204|\241\236\206\212\002d\2442\222IF\307%\344\320\222\214\244\216\215%%\027>\311\323P\261TC\3518c\350hL\032\221\212\307\342\322\212\005\210\222j|\2204\"u\222d\364\0209\264\223\034J\232\2614L\232\261d\2158\030!Q$\322x,**\022m,)\021\241\307\344\222\375\216\215c\022i4\303\230\302PP\2211i\206\321Q\221XdD\326@\223\224\214\222\305d\261\35084c\211g\310\230,\036-!\031c$\215Hc\n3\226\b\200\021\324\2234\302@\026C J\036s\212\214\311\244\321\321\022\f\001\224b\270\210\241\302Q\221H\211\204 \0271Tx\361\003#i\004\3018C\361\205N\2211y,&\221\304\224\205\212\344\261\270\244\"i\004\201(y\344I\026\221\216J\037\364\230@#i\304\002"
+	.ascii	"H\306$\322\006\f\240\0300:@\032\r_\3100\301F\261(\251\006\214"
+	.ascii	"$\262x\004TdtT\\\001)\002Q\362\b@\007J1\200\2206\212E\350\211"
+	.ascii	"RP\212\001t\"\243\2431\3118C}\004\02380A\0057\020_\301\005,."
+	.ascii	"`\221\276\202\013Z\264\270`\202\026\352'ha\223\017@p\244\244"
+	.ascii	"\304\301\320\360X\244A\204&\211\222G\034\344\320\f#\031IJ.v\210"
+	.ascii	"I#R\206\f\245!\034\2228Id\321\020\221Q\262\210\244\224\254Q\034"
+	.ascii	"\302!\371\223\3149\r\021WZ2\036W$\225\224\216+t\220FGGFH)r\310"
+	.ascii	"\210d\024\303\230,\026\r\351$\207&h\241\036\213F\033(\215d\222"
+	.ascii	"\022\322\320F\261\310\"\2175\224h\f\221\306d\215$#$br\250\202"
+	.ascii	"d\222Q\r\342-`Q\224\021\001\004EF\025?\267\300\002\027#T(\001"
+	.ascii	"\004\225H\205\021\311(\271\"I\t\tI\211hE\222Q\021i\005\321\021"
+	.ascii	"\271B\205\020\262(I\211\310\210$\006v\240\233\230\2703\226\316"
+	.ascii	"\332eq\002%\2109\037*\353\2206\3007\242\233\323\026\032\020="
+	.ascii	"D\307\311\224D\214\031\373\326u\365d\255\377\302x\306\356\242"
+	.ascii	"L\361cC\267\230\340\3755\332\363\325g\313\330>KFUbq\261cn\311"
+	.ascii	"\354\350`n\331B$\024c6d\252\214\254\303p\321\301=\3155j\277X"
+	.ascii	"0\267|\267|m\371laaJ\006F-\365B\306H\270n\\\331=0\036e\004\335"
+	.ascii	"4\312c\225g\365l^\223\251J\342\r\342\037^'\211r&IU\243\326\316"
+	.ascii	"\362\360\346\336\245\265k\333\305\336\335\332\335\207\330\027"
+	.ascii	"\306\\\246\\\234bV\267k\013U\003^J!\215\246{L\307t\226.Us#\214"
+	.ascii	"\323jCF\306\322\33196@\234\203\215Z8\033\307h&\254\\\221\021"
+	.ascii	"\265\270*\352\331D\352c\"M\377R\244\245\3317>\273Q\001\2205\335"
+	.ascii	"\210\t\336[e\002\035c\306u\244\331n\337n\335\224q_\320\264\331"
+	.ascii	",kQm:\216\250\366\212\305B\365\004CHD\265V,\217/wp=\033\275\212"
+	.ascii	"\301\255+=\032\265U\032*L\007[\340\332\330\0221x\275\246\346"
+	.ascii	"#e\352\310\0178on\234\370\350\241\246g)n\237\366\331\316\376"
+	.ascii	"\271MXW\334\320*5lD&5\215\253\272-\302h\266\312\236\t\231\255"
+	.ascii	"J\035<3\351\223\233\245\255Q\263\276\022\030\304\236\032\365"
+	.ascii	"<v\304n\2151\302e\265\306\372~\260J\236t\t\203\022\250\322\301"
+	.ascii	"\226\303\201F!3$#2\222$Ic2\n\020\204Ba&\351i\017\022\300\005"
+	.ascii	"1T*\307FF\222\244\220\366;g%:(\330k\226\200y\216\021\242\244"
+	.ascii	"\256An\332!|\t\300-\235+\225\230#\366\2254Q\326\035\205\230\222"
+	.ascii	"\221x\337\247\007\022`\237\247\001M*&V\322\326\336\313\006O^"
+	.ascii	".\214\231\207\013\210\270\210!G*\016\337:\226\004%\221mz\270"
+	.ascii	"\200\377%\334\213)>2\024m\253\002\002xv\3065\242k1\ng\214\364"
+	.ascii	"J1 f\323\317\363\244\025\342h\1773\007I\237\003\265\\:yc0\316"
+	.ascii	"\253-\372u6u\236\245>\362\375\f\220\203\016\003\212t\330|\030"
+	.ascii	".\017\315\225\346\036+\r\322\263\247\352\237\237\242\333_&a\374"
+	.ascii	"\013\322\325\370\257\320\373#\356\273\026{v\032'\2465\031\274"
+	.ascii	"2h\337B\210b-\026\260.(\326c\227m\212\372$\035\241\020\026\001"
+	.ascii	"-\t\230\335\364*\240zm\200m\030\344\240\340.{7\201L\362E\023"
+	.ascii	"{\003\005\221\216_\037!\243\336\371\344\216\2033R\036x?\363\317"
+	.ascii	"\251\335J\003\034\222\023H\311\254\313\233-\032\314\344\222j"
+	.ascii	"\320O\253\316\373"
+	.string	"\n\224\247\232\273\242\t\027/e\331$0V\242\024\252tao\260\220\\\200\312k\"\210R\277\271\n\262g\377\212\203\227^\303\227\332\240\251u\"'\343\3122\237\206z\221\b\fv\036\021\351\030i\304\214\216\244\271\257S\352\233vW\263\324\034\035\025\374N\357\bx\037\007\021\211\026\377\205W\211\005+\300m\301\333\321l\020Q8\035\201\327L\024\3021\031%[(:&\271c\332\374F\315\264\252w\344\252\322\315\005[\030)\344n\327\251\331\300\225 _\232\236b.\022\274Tf\200\213\r;C]\264\026\277\345v\022\021\326\371\321\241\254}\370\245\340\336\313\035\035\327Y\277\356I\244\023\347\306zIj\277\263w\022\b\240\340\304\t\331\016 \217\b_\3608\025\304SY^\274+\320\343[\211\3571f*\032\245v'hT\330\252\310\353V\322\004\243\334\037\2106\356\337r,\260\237\222o?\350\3706\225\016\301\262\005\231"
+	.ascii	":\t\034\341\t\261\002'\232:lU\222b\2438HEl%\023Hw&\234\354\313"
+	.ascii	"\367\241"
+	.string	"\030\342\b\272.\274{\fs\321o\022T]\325\347\177\027E\236A\006Ji\312Yh\232\023\036\366tI\021{\024wd\256\304\312\333)\267\304\021\004\265k:Ww\261*\310\017\212\370\214\001\312"
+	.string	"\211\270\214>\027\"\31401}\324\321-\376M\n\324I\321_)>\207\212\355p\312\331\3073\307O\340v\202\204PAR\216h\034\340\372\272\323\tE\0330\325=\223\312\017 jD\231\223\241qv\275$\252\347g\025\330\251\331\242@\350\r\346`\263\201\021\275\"2o\375\243z\002\252\027\275\222\214\036\233\226T\\\253\023\341\016\224"
+	.ascii	"\21003\356\037\267Y,\316\221N\3532\212\367^@\002\314"
+	.string	"\345\261\2629)\026\266\334\242\321\f\353<\344\334N\273\235\352r\250t;\242F\363*O\317\0351\024\353#\335/\252\n\246\301\005\3251\004\330a\n\031\207,\235\240\030\023\007\031\365\326\237\021\033[s^\222\022Fw\222\205\201F\231\026;\322+\237r%\256\335\001\177}\022V\361\370\032#\n|\263\0320\323\363.]\021?\306\3715\312\f\202yj\0034\"\205(Z\030\262\266\216A\032\213\325\274\366\001\322\240u\031\276{bf:\230+\203\354\227~\227 .5\t\305I\240uE\227\341\344\322L\210\001\313kJ\301\325\327\235\"2:.6\330\236\314U\003\206\025\027]_\007\373\301\262\030+\241+M\315\231\331v\024\323*\345\264U\210+\237\341\222\026\342i]\224i3T\353~ p\342zg\251\331dq\371\002\365\025\326@H$\020\244\t 0-J%\214X\264\001h(\365\356\373\277%r_\365\206\177"
+	.string	"AB\245h\256\313\3143\232\204'\230>\330\216+`7X(\273\013\213\263\fn\235Gj\230\210\327\030k+T$Yw\340\fl\033\026>\335@\2108\203\002\375L>.\302\240\335%\364j\3632\227\362\227\340\303\206\b\362\306H\2153\361\302\371E\244>\247\001/u\207\210\366\345\244\341\227|\226\022p\315>k\350;X\321\006"
+	.ascii	"h\245AeB\025\275\324\313\002nZ\020"
+	.string	"\355\017s$\306\3200$\264\241\321\"\257\016Q\376\325A[\r\323!h\306\025\r\256\037\333\213b\217\036C\036Y\036{\225\211\217\332\276\374\274\177\350\361R\312Z\271\3061\3559\260S\313\251!\276\230\363F\330F\350\276c3\240\307v\\\207\364\363\3103R?\370}\035]6\031\246\221\373\274K\235\321\363\304]\370=\020/\270;\270\374\261\305!\306\377\260\275\336\"\375\0136&\3035\256\221\026[\207\340\326w\207\356<\224\225\376\352\210\344]\245\236\017\263\253\334\025lM\313\366\022\007\324~\354\343<-\246g\246:K\374I\215\024.\274\365\375\205m[\037\030\376\r\2775\337\270 \337\355\255Q\323~M\207\223\017\f\317\333\307\357\256y\247\247\312g\256\237S\023G\243\353+nl\336\273m\006O~\355\322Q\301oh~\314U%_\264\313\026\347E\377,\233{l\031W\341j\373\267\376c\271\347\314Y\310\227\360"
+	.ascii	"y\3479U\226\331o\232\347t\362\373\347i\314`\217W\376\310\240"
+	.ascii	"\363\203\331\222}z^m\333\272\213\206hSx\034]\200\356\300\177"
+	.ascii	"\343\177T\367\207\276\t\026\273\333\234v\226H|\352v\233\317\271"
+	.ascii	"{\350\373\273\255\373}Y\335\017If\261jy\301\362\265\325\3473"
+	.ascii	"\3339\274\311\354\375\345/\307\234x\f\307@\367I\331\317\244!"
+	.ascii	"\340\235\340\0079\247\262^\277\232\177R\370p\314\270+\370\221"
+	.ascii	"<\203_\236\027\324g\304z\304E\307\034\355\335\321<\261\246\277"
+	.ascii	"\207\226\314h\257\025"
+	.text
+	.section	.gnu.lto_.symtab.d3756b604e863765,"e",@progbits
+	.string	"timeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"rtcTimeMake"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"rtcTimeGetSeconds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"rtcTimeGetMillis"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"dateTimeFormatUTC"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"dateTimeFormatLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"dateTimeUTCToLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"s\001"
+	.string	""
+	.string	"dateTimeSplitFormatted"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"rtcGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\001"
+	.string	""
+	.string	"rtcSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"rtcGetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"rtcGetDateTimeLocal"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"pgResetTemplate_timeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"timeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\001"
+	.string	""
+	.string	"timeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"tfp_sprintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d3756b604e863765,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
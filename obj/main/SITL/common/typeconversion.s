@@ -0,0 +1,9716 @@
+	.file	"typeconversion.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/common/typeconversion.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	typeconversion.c.9143aabf
+	.weak	typeconversion.c.9143aabf
+typeconversion.c.9143aabf:
+	.long	0x419
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF1419
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1378
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1379
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1380
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1381
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1382
+	.uleb128 0x7
+	.long	.LASF1384
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1383
+	.uleb128 0x7
+	.long	.LASF1385
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1386
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x8
+	.long	0x79
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1387
+	.uleb128 0x14
+	.long	0x79
+	.uleb128 0x7
+	.long	.LASF1388
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF1389
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	.LASF1390
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.long	0x80
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1391
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1392
+	.uleb128 0xc
+	.long	.LASF1393
+	.byte	0x2b
+	.long	0x72
+	.long	0xda
+	.uleb128 0x6
+	.long	0x72
+	.uleb128 0x6
+	.long	0xda
+	.uleb128 0x6
+	.long	0x9d
+	.byte	0
+	.uleb128 0x8
+	.long	0xdf
+	.uleb128 0x15
+	.uleb128 0xc
+	.long	.LASF1394
+	.byte	0x95
+	.long	0x74
+	.long	0xf9
+	.uleb128 0x6
+	.long	0x74
+	.uleb128 0x6
+	.long	0xa9
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1395
+	.byte	0x5
+	.value	0x197
+	.byte	0xf
+	.long	0x9d
+	.long	0x110
+	.uleb128 0x6
+	.long	0xa9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1398
+	.value	0x135
+	.byte	0x5
+	.long	0x64
+	.long	0x150
+	.uleb128 0xe
+	.string	"s"
+	.value	0x135
+	.byte	0x19
+	.long	0xa9
+	.uleb128 0x9
+	.long	.LASF1396
+	.value	0x137
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x17
+	.string	"num"
+	.byte	0x6
+	.value	0x138
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x9
+	.long	.LASF1397
+	.value	0x139
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1399
+	.value	0x121
+	.byte	0x13
+	.long	0x37
+	.long	0x183
+	.uleb128 0xe
+	.string	"p"
+	.value	0x121
+	.byte	0x28
+	.long	0xa9
+	.uleb128 0x9
+	.long	.LASF1400
+	.value	0x123
+	.byte	0x17
+	.long	0x37
+	.uleb128 0x9
+	.long	.LASF1397
+	.value	0x124
+	.byte	0x13
+	.long	0x22
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1401
+	.byte	0xd1
+	.long	0xae
+	.long	0x1e5
+	.uleb128 0x1
+	.string	"p"
+	.byte	0xd1
+	.byte	0x1b
+	.long	0xa9
+	.uleb128 0x2
+	.long	.LASF1402
+	.byte	0xd3
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1396
+	.byte	0xd4
+	.byte	0xb
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1403
+	.byte	0xd4
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1404
+	.byte	0xd4
+	.byte	0x18
+	.long	0xae
+	.uleb128 0x18
+	.long	0x1d7
+	.uleb128 0x2
+	.long	.LASF1405
+	.byte	0xee
+	.byte	0xf
+	.long	0xae
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2
+	.long	.LASF1406
+	.byte	0xfb
+	.byte	0x16
+	.long	0x30
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1407
+	.byte	0x96
+	.long	0x74
+	.long	0x24c
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x96
+	.byte	0x12
+	.long	0xae
+	.uleb128 0x5
+	.long	.LASF1408
+	.byte	0x96
+	.byte	0x1b
+	.long	0x74
+	.uleb128 0x2
+	.long	.LASF1403
+	.byte	0x98
+	.byte	0xd
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF1409
+	.byte	0x99
+	.byte	0xa
+	.long	0x24c
+	.uleb128 0x2
+	.long	.LASF1410
+	.byte	0x9a
+	.byte	0xa
+	.long	0x24c
+	.uleb128 0x2
+	.long	.LASF1411
+	.byte	0x9b
+	.byte	0xb
+	.long	0x74
+	.uleb128 0x2
+	.long	.LASF1412
+	.byte	0x9c
+	.byte	0xd
+	.long	0x91
+	.uleb128 0xa
+	.uleb128 0x2
+	.long	.LASF1413
+	.byte	0xa5
+	.byte	0x2f
+	.long	0x85
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	0x79
+	.long	0x25c
+	.uleb128 0x1a
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1414
+	.byte	0x88
+	.long	0x74
+	.long	0x288
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x88
+	.byte	0x10
+	.long	0x64
+	.uleb128 0x1
+	.string	"a"
+	.byte	0x88
+	.byte	0x19
+	.long	0x74
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x88
+	.byte	0x20
+	.long	0x64
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1420
+	.byte	0x6
+	.byte	0x80
+	.byte	0xe
+	.long	0x74
+	.long	0x2b6
+	.uleb128 0x1
+	.string	"i"
+	.byte	0x80
+	.byte	0x1c
+	.long	0x30
+	.uleb128 0x1
+	.string	"a"
+	.byte	0x80
+	.byte	0x25
+	.long	0x74
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x80
+	.byte	0x31
+	.long	0x30
+	.byte	0
+	.uleb128 0xf
+	.string	"a2i"
+	.byte	0x60
+	.byte	0x6
+	.long	0x79
+	.long	0x310
+	.uleb128 0x1
+	.string	"ch"
+	.byte	0x60
+	.byte	0xf
+	.long	0x79
+	.uleb128 0x1
+	.string	"src"
+	.byte	0x60
+	.byte	0x20
+	.long	0x310
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x60
+	.byte	0x29
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1416
+	.byte	0x60
+	.byte	0x34
+	.long	0x315
+	.uleb128 0x4
+	.string	"p"
+	.byte	0x62
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x4
+	.string	"num"
+	.byte	0x63
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x2
+	.long	.LASF1397
+	.byte	0x64
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	0xa9
+	.uleb128 0x8
+	.long	0x64
+	.uleb128 0xf
+	.string	"a2d"
+	.byte	0x54
+	.byte	0x5
+	.long	0x64
+	.long	0x334
+	.uleb128 0x1
+	.string	"ch"
+	.byte	0x54
+	.byte	0xe
+	.long	0x79
+	.byte	0
+	.uleb128 0x1c
+	.string	"i2a"
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x6
+	.long	0x356
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x4b
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x4b
+	.byte	0x19
+	.long	0x74
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1417
+	.byte	0x39
+	.long	0x3aa
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x39
+	.byte	0x18
+	.long	0x30
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x39
+	.byte	0x2a
+	.long	0x30
+	.uleb128 0x1
+	.string	"uc"
+	.byte	0x39
+	.byte	0x34
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x39
+	.byte	0x3e
+	.long	0x74
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x3b
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x4
+	.string	"d"
+	.byte	0x3c
+	.byte	0x12
+	.long	0x30
+	.uleb128 0xa
+	.uleb128 0x4
+	.string	"dgt"
+	.byte	0x40
+	.byte	0xd
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1418
+	.byte	0x2e
+	.long	0x3ca
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x2e
+	.byte	0x10
+	.long	0x6b
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x2e
+	.byte	0x1b
+	.long	0x74
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1421
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x6
+	.uleb128 0x1
+	.string	"num"
+	.byte	0x1c
+	.byte	0x1e
+	.long	0x37
+	.uleb128 0x5
+	.long	.LASF1415
+	.byte	0x1c
+	.byte	0x30
+	.long	0x30
+	.uleb128 0x1
+	.string	"uc"
+	.byte	0x1c
+	.byte	0x3a
+	.long	0x64
+	.uleb128 0x1
+	.string	"bf"
+	.byte	0x1c
+	.byte	0x44
+	.long	0x74
+	.uleb128 0x4
+	.string	"n"
+	.byte	0x1e
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x4
+	.string	"d"
+	.byte	0x1f
+	.byte	0x12
+	.long	0x30
+	.uleb128 0xa
+	.uleb128 0x4
+	.string	"dgt"
+	.byte	0x23
+	.byte	0xd
+	.long	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF718
+	.byte	0x4
+	.byte	0x4
+	.file 24 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 25 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF999
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1026
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x21
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 36 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 38 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.file 39 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 40 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 41 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x29
+	.byte	0x4
+	.file 42 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1377
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF712
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF991
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1020
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1078
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1079
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1080
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1119
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1171
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1264
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF715
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1297
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1320
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1321
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1322
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1323
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1325
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1326
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1327
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1328
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1329
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1334
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1335
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1359
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1324
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1361
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF1422
+	.long	.LASF1423
+	.long	.LASF1424
+	.long	.LASF1425
+	.long	.LASF1426
+	.long	.LASF1427
+	.long	.LASF1428
+	.long	.LASF1429
+	.long	.LASF1430
+	.long	.LASF1431
+	.long	.LASF1432
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1433
+	.byte	0x7
+	.long	.LASF1434
+	.byte	0x7
+	.long	.LASF1435
+	.byte	0x7
+	.long	.LASF1436
+	.byte	0xb
+	.long	.LASF1437
+	.byte	0xa
+	.long	.LASF1438
+	.byte	0x2
+	.long	.LASF1439
+	.byte	0xa
+	.long	.LASF1440
+	.byte	0xb
+	.long	.LASF1440
+	.byte	0xa
+	.long	.LASF1441
+	.byte	0x7
+	.long	.LASF1442
+	.byte	0xa
+	.long	.LASF1443
+	.byte	0xa
+	.long	.LASF1444
+	.byte	0x7
+	.long	.LASF1445
+	.byte	0x7
+	.long	.LASF1446
+	.byte	0x9
+	.long	.LASF1447
+	.byte	0x7
+	.long	.LASF1448
+	.byte	0x8
+	.long	.LASF1449
+	.byte	0x8
+	.long	.LASF1450
+	.byte	0x7
+	.long	.LASF1451
+	.byte	0x7
+	.long	.LASF1452
+	.byte	0x7
+	.long	.LASF1453
+	.byte	0x6
+	.long	.LASF1454
+	.byte	0x6
+	.long	.LASF1455
+	.byte	0xa
+	.long	.LASF1456
+	.byte	0xa
+	.long	.LASF1457
+	.byte	0x7
+	.long	.LASF1458
+	.byte	0x7
+	.long	.LASF1459
+	.byte	0x7
+	.long	.LASF1460
+	.byte	0x7
+	.long	.LASF1461
+	.byte	0x7
+	.long	.LASF1462
+	.byte	0x7
+	.long	.LASF1463
+	.byte	0x7
+	.long	.LASF1464
+	.byte	0x7
+	.long	.LASF1465
+	.byte	0x7
+	.long	.LASF1466
+	.byte	0x1
+	.long	.LASF1467
+	.byte	0x2
+	.long	.LASF1468
+	.byte	0xb
+	.long	.LASF1469
+	.byte	0x5
+	.long	.LASF1470
+	.byte	0x4
+	.long	.LASF1471
+	.byte	0x3
+	.long	.LASF1472
+	.byte	0x4
+	.long	.LASF1473
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF799:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1095:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF724:
+	.string	"__DECL_SIMD_cosl "
+.LASF1262:
+	.string	"USE_CLI_BATCH "
+.LASF1209:
+	.string	"USE_OPFLOW "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF792:
+	.string	"__DECL_SIMD_atan "
+.LASF994:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF962:
+	.string	"__DECL_SIMD_asinh "
+.LASF1390:
+	.string	"size_t"
+.LASF1181:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1162:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1007:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF829:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1014:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1252:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1306:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1186:
+	.string	"USE_GPS "
+.LASF1154:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1275:
+	.string	"_GCC_PTRDIFF_T "
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1040:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF927:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1241:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF848:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1125:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF818:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1201:
+	.string	"USE_RX_UIB "
+.LASF1289:
+	.string	"_WCHAR_T_H "
+.LASF814:
+	.string	"__DECL_SIMD_hypotl "
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF1388:
+	.string	"int32_t"
+.LASF1175:
+	.string	"USE_I2C_PULLUP "
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF882:
+	.string	"__DECL_SIMD_atan2 "
+.LASF774:
+	.string	"__DECL_SIMD_powl "
+.LASF836:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF783:
+	.string	"__DECL_SIMD_acosf "
+.LASF1231:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF833:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF806:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1110:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1067:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1146:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1223:
+	.string	"USE_TELEMETRY_SIM "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1023:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1297:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1182:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF777:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1312:
+	.string	"USE_UART7 "
+.LASF1321:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1119:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF850:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1323:
+	.string	"USE_SERVO_SBUS"
+.LASF1189:
+	.string	"USE_TELEMETRY "
+.LASF1411:
+	.string	"decimalPoint"
+.LASF801:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1009:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1191:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1148:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1396:
+	.string	"sign"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF1103:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF471:
+	.string	"__P(args) args"
+.LASF922:
+	.string	"__DECL_SIMD_atanh "
+.LASF1365:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF976:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1109:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF696:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1129:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1247:
+	.string	"USE_SERIALRX_SUMD "
+.LASF925:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1214:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1288:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1113:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF989:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1085:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1273:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1001:
+	.string	"__HAVE_FLOAT32 1"
+.LASF983:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF710:
+	.string	"_GCC_SIZE_T "
+.LASF790:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1244:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF1401:
+	.string	"fastA2F"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1398:
+	.string	"fastA2I"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1145:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1174:
+	.string	"I2C2_OVERCLOCK false"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF700:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF760:
+	.string	"__DECL_SIMD_logf64x "
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1319:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1213:
+	.string	"USE_1WIRE "
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF912:
+	.string	"__DECL_SIMD_log1p "
+.LASF1083:
+	.string	"__MATHCALL_NARROW"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF718:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1076:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1108:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF781:
+	.string	"__DECL_SIMD_powf128x "
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF966:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1348:
+	.string	"U_ID_1 1"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1227:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1341:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1063:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF1327:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1400:
+	.string	"result"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1087:
+	.string	"FP_NAN 0"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1211:
+	.string	"USE_OPFLOW_MSP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF1150:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF1246:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF698:
+	.string	"_SYS_SIZE_T_H "
+.LASF1180:
+	.string	"USE_SERIALRX_IBUS "
+.LASF849:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1035:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF744:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1419:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1307:
+	.string	"USE_UART2 "
+.LASF1386:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1028:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1075:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1070:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1099:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1050:
+	.string	"_Mdouble_ float"
+.LASF952:
+	.string	"__DECL_SIMD_tanh "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF923:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1286:
+	.string	"_BSD_WCHAR_T_ "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1044:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF834:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1047:
+	.string	"__MATH_PRECNAME"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1414:
+	.string	"itoa"
+.LASF812:
+	.string	"__DECL_SIMD_hypot "
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1235:
+	.string	"CMS_MENU_OSD "
+.LASF846:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF868:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1141:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1171:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1090:
+	.string	"FP_SUBNORMAL 3"
+.LASF1243:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1069:
+	.string	"__MATHDECL_ALIAS"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1012:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF754:
+	.string	"__DECL_SIMD_logl "
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1224:
+	.string	"USE_FRSKYOSD "
+.LASF901:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF715:
+	.string	"NULL ((void *)0)"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1206:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1161:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1358:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1382:
+	.string	"signed char"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1130:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1389:
+	.string	"uint8_t"
+.LASF1049:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1016:
+	.string	"__f64x(x) x ##f64x"
+.LASF1350:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1259:
+	.string	"USE_VTX_FFPV "
+.LASF1193:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF785:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF911:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1218:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1320:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1404:
+	.string	"scale"
+.LASF919:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1308:
+	.string	"USE_UART3 "
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF897:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1053:
+	.string	"_Mdouble_ long double"
+.LASF1378:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF762:
+	.string	"__DECL_SIMD_exp "
+.LASF1329:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1205:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1155:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF708:
+	.string	"__DEFINED_size_t "
+.LASF1242:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF717:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1046:
+	.string	"_Mdouble_"
+.LASF1361:
+	.string	"NOINLINE "
+.LASF1354:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF971:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1346:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF920:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1105:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1118:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1132:
+	.string	"bool _Bool"
+.LASF1022:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1025:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF969:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF811:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF704:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF714:
+	.string	"NULL"
+.LASF1403:
+	.string	"value"
+.LASF1178:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF979:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF418:
+	.string	"__USE_GNU"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF855:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF998:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1277:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF787:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF693:
+	.string	"__need_size_t "
+.LASF883:
+	.string	"__DECL_SIMD_atan2f "
+.LASF824:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1093:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1347:
+	.string	"U_ID_0 0"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1058:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF965:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1236:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF970:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF733:
+	.string	"__DECL_SIMD_sinf "
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1294:
+	.string	"__DEFINED_wchar_t "
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1088:
+	.string	"FP_INFINITE 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1360:
+	.string	"FAST_CODE "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF695:
+	.string	"__size_t__ "
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1169:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF726:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF963:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF826:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1332:
+	.string	"USE_PITOT_ADC"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1173:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF859:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1017:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1370:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF749:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF936:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF944:
+	.string	"__DECL_SIMD_erfl "
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1089:
+	.string	"FP_ZERO 2"
+.LASF1233:
+	.string	"USE_STATS "
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF1045:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF1251:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1115:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1156:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF766:
+	.string	"__DECL_SIMD_expf32 "
+.LASF877:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF809:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF938:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1417:
+	.string	"ui2a"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1291:
+	.string	"__INT_WCHAR_T_H "
+.LASF1096:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF713:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1203:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF987:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1177:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF937:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1309:
+	.string	"USE_UART4 "
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF908:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1226:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1317:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1328:
+	.string	"USE_RANGEFINDER"
+.LASF974:
+	.string	"__DECL_SIMD_erfcl "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1196:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF898:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF862:
+	.string	"__DECL_SIMD_sinh "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1384:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF832:
+	.string	"__DECL_SIMD_exp10 "
+.LASF796:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF924:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1159:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1337:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1034:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1170:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF725:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1048:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF909:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1042:
+	.string	"_Mdouble_ double"
+.LASF1127:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1065:
+	.string	"_Mdouble_ _Float64x"
+.LASF1158:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF973:
+	.string	"__DECL_SIMD_erfcf "
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF914:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1397:
+	.string	"digit"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF910:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1349:
+	.string	"U_ID_2 2"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF767:
+	.string	"__DECL_SIMD_expf64 "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF802:
+	.string	"__DECL_SIMD_asin "
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF1066:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1313:
+	.string	"USE_UART8 "
+.LASF1008:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1055:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF1208:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1216:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1006:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF887:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1413:
+	.string	"_abs0"
+.LASF851:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF1421:
+	.string	"uli2a"
+.LASF823:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1094:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF780:
+	.string	"__DECL_SIMD_powf64x "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF904:
+	.string	"__DECL_SIMD_log2l "
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF959:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1314:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1026:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF961:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF839:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF819:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF731:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF1299:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1343:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF743:
+	.string	"__DECL_SIMD_sincosf "
+.LASF699:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1005:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF988:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1092:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1355:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF728:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF776:
+	.string	"__DECL_SIMD_powf32 "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF933:
+	.string	"__DECL_SIMD_acoshf "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF857:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1399:
+	.string	"fastA2UL"
+.LASF895:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF694:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF765:
+	.string	"__DECL_SIMD_expf16 "
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1036:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1310:
+	.string	"USE_UART5 "
+.LASF1084:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1098:
+	.string	"MATH_ERRNO 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1163:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1300:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF875:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF990:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1298:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1274:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF991:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1019:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1418:
+	.string	"li2a"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1257:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF753:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1269:
+	.string	"_T_PTRDIFF_ "
+.LASF1303:
+	.string	"USE_FAKE_GPS "
+.LASF1374:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1116:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1139:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF894:
+	.string	"__DECL_SIMD_log10l "
+.LASF884:
+	.string	"__DECL_SIMD_atan2l "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1068:
+	.string	"__MATHDECL_1"
+.LASF1187:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1254:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1278:
+	.string	"__need_ptrdiff_t"
+.LASF1192:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1263:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF772:
+	.string	"__DECL_SIMD_pow "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1018:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF734:
+	.string	"__DECL_SIMD_sinl "
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1351:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF876:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1107:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF1258:
+	.string	"USE_VTX_TRAMP "
+.LASF702:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF935:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1102:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1237:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF872:
+	.string	"__DECL_SIMD_cbrt "
+.LASF828:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF837:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1279:
+	.string	"__wchar_t__ "
+.LASF1339:
+	.string	"USE_VCP"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1038:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1199:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF722:
+	.string	"__DECL_SIMD_cos "
+.LASF1011:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF738:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1123:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF863:
+	.string	"__DECL_SIMD_sinhf "
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1284:
+	.string	"__WCHAR_T "
+.LASF1392:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1104:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1143:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1342:
+	.string	"USE_RCDEVICE"
+.LASF1207:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF461:
+	.string	"__PMT"
+.LASF1077:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF779:
+	.string	"__DECL_SIMD_powf32x "
+.LASF932:
+	.string	"__DECL_SIMD_acosh "
+.LASF1052:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF899:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF981:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1060:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF997:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF800:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1056:
+	.string	"_Mdouble_ _Float32"
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1367:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF769:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1267:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF852:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF926:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF918:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF853:
+	.string	"__DECL_SIMD_expm1f "
+.LASF993:
+	.string	"__HAVE_FLOAT128 1"
+.LASF896:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1166:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF835:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1372:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1380:
+	.string	"unsigned int"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1124:
+	.string	"UNIT_TESTED "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF967:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF957:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1283:
+	.string	"_T_WCHAR "
+.LASF1064:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF902:
+	.string	"__DECL_SIMD_log2 "
+.LASF1330:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF873:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF1041:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1131:
+	.string	"_STDBOOL_H "
+.LASF1293:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1322:
+	.string	"USE_USB_MSC"
+.LASF1117:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF761:
+	.string	"__DECL_SIMD_logf128x "
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF1240:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF892:
+	.string	"__DECL_SIMD_log10 "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF768:
+	.string	"__DECL_SIMD_expf128 "
+.LASF907:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1412:
+	.string	"dpLocation"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1345:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1152:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1198:
+	.string	"USE_GYRO_KALMAN "
+.LASF707:
+	.string	"_SIZE_T_DECLARED "
+.LASF507:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF773:
+	.string	"__DECL_SIMD_powf "
+.LASF1106:
+	.string	"M_PI 3.14159265358979323846"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF1268:
+	.string	"_PTRDIFF_T "
+.LASF1133:
+	.string	"true 1"
+.LASF1190:
+	.string	"USE_TELEMETRY_LTM "
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF775:
+	.string	"__DECL_SIMD_powf16 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1136:
+	.string	"sq(x) ((x)*(x))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF770:
+	.string	"__DECL_SIMD_expf64x "
+.LASF1160:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF757:
+	.string	"__DECL_SIMD_logf64 "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1229:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF709:
+	.string	"___int_size_t_h "
+.LASF955:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1168:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1281:
+	.string	"_WCHAR_T "
+.LASF739:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1004:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1082:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF917:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF934:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1301:
+	.string	"USE_FAKE_BARO "
+.LASF706:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF858:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1122:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1188:
+	.string	"USE_NAV "
+.LASF545:
+	.string	"__stub_revoke "
+.LASF1222:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1249:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1387:
+	.string	"char"
+.LASF764:
+	.string	"__DECL_SIMD_expl "
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF697:
+	.string	"_SIZE_T "
+.LASF947:
+	.string	"__DECL_SIMD_erff64 "
+.LASF843:
+	.string	"__DECL_SIMD_coshf "
+.LASF758:
+	.string	"__DECL_SIMD_logf128 "
+.LASF778:
+	.string	"__DECL_SIMD_powf128 "
+.LASF905:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1376:
+	.string	"white_space(c) ((c) == ' ' || (c) == '\\t')"
+.LASF1230:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1302:
+	.string	"USE_FAKE_MAG "
+.LASF1362:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1316:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1276:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1364:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF867:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1408:
+	.string	"floatString"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF808:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF1407:
+	.string	"ftoa"
+.LASF1200:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1379:
+	.string	"short unsigned int"
+.LASF827:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF701:
+	.string	"__SIZE_T "
+.LASF939:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF916:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF752:
+	.string	"__DECL_SIMD_log "
+.LASF784:
+	.string	"__DECL_SIMD_acosl "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1112:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF720:
+	.string	"_MATH_H 1"
+.LASF1253:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF986:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1287:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1373:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF996:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF984:
+	.string	"__DECL_SIMD_tanl "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF975:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF755:
+	.string	"__DECL_SIMD_logf16 "
+.LASF782:
+	.string	"__DECL_SIMD_acos "
+.LASF1270:
+	.string	"_T_PTRDIFF "
+.LASF1167:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1248:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1140:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF985:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1172:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF810:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF915:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1326:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF953:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1375:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF383:
+	.string	"SITL 1"
+.LASF795:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF705:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1366:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF982:
+	.string	"__DECL_SIMD_tan "
+.LASF747:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1271:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1086:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1228:
+	.string	"USE_D_BOOST "
+.LASF1097:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1381:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF900:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF865:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1147:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF864:
+	.string	"__DECL_SIMD_sinhl "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1371:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF741:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1030:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1072:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1220:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1324:
+	.string	"USE_DASHBOARD"
+.LASF945:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1282:
+	.string	"_T_WCHAR_ "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1039:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF1037:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF712:
+	.string	"__size_t "
+.LASF886:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1340:
+	.string	"USE_RX_PPM"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF822:
+	.string	"__DECL_SIMD_exp2 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1219:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF817:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1296:
+	.string	"__need_wchar_t"
+.LASF1357:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1260:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF703:
+	.string	"_BSD_SIZE_T_ "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF716:
+	.string	"__need_NULL"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF730:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1002:
+	.string	"__HAVE_FLOAT64 1"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1305:
+	.string	"USE_BARO "
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF721:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF788:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF854:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1210:
+	.string	"USE_OPFLOW_CXOF "
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF692:
+	.string	"_STRING_H 1"
+.LASF763:
+	.string	"__DECL_SIMD_expf "
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1183:
+	.string	"USE_ADC_AVERAGING "
+.LASF745:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1024:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1292:
+	.string	"_GCC_WCHAR_T "
+.LASF951:
+	.string	"__DECL_SIMD_erff128x "
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF1057:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1153:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF992:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF791:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1165:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1261:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF874:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1204:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1344:
+	.string	"USE_ITCM_RAM"
+.LASF1137:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF816:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1256:
+	.string	"USE_VTX_CONTROL "
+.LASF870:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF943:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1250:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF805:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1157:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF995:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF968:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF542:
+	.string	"__stub_chflags "
+.LASF711:
+	.string	"_SIZET_ "
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1311:
+	.string	"USE_UART6 "
+.LASF1194:
+	.string	"USE_PITOT "
+.LASF732:
+	.string	"__DECL_SIMD_sin "
+.LASF1091:
+	.string	"FP_NORMAL 4"
+.LASF1212:
+	.string	"USE_PITOT_MS4525 "
+.LASF1265:
+	.string	"_STDDEF_H "
+.LASF1272:
+	.string	"_PTRDIFF_T_ "
+.LASF1363:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1402:
+	.string	"frac"
+.LASF1021:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1128:
+	.string	"EXTENDED_FASTRAM "
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF999:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1336:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1003:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1013:
+	.string	"__f32(x) x ##f32"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1073:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1334:
+	.string	"USE_1WIRE_DS2482"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1335:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1359:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1406:
+	.string	"expon"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF723:
+	.string	"__DECL_SIMD_cosf "
+.LASF746:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1285:
+	.string	"_WCHAR_T_ "
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1054:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF736:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF793:
+	.string	"__DECL_SIMD_atanf "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF913:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1061:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1383:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1100:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF942:
+	.string	"__DECL_SIMD_erf "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1331:
+	.string	"USE_PITOT_MS4525"
+.LASF1184:
+	.string	"USE_64BIT_TIME "
+.LASF841:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF825:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF948:
+	.string	"__DECL_SIMD_erff128 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF844:
+	.string	"__DECL_SIMD_coshl "
+.LASF813:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1416:
+	.string	"nump"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1179:
+	.string	"USE_SERIALRX_SBUS "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1114:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1033:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1126:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1221:
+	.string	"USE_OLED_UG2864 "
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF847:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1356:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF771:
+	.string	"__DECL_SIMD_expf128x "
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF1164:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF807:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1280:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF972:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1071:
+	.string	"__MATHCALL"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF903:
+	.string	"__DECL_SIMD_log2f "
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF737:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1015:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1120:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1245:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF950:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1134:
+	.string	"false 0"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1149:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1395:
+	.string	"strlen"
+.LASF797:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1217:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1027:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF842:
+	.string	"__DECL_SIMD_cosh "
+.LASF885:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF893:
+	.string	"__DECL_SIMD_log10f "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1195:
+	.string	"USE_PITOT_ADC "
+.LASF1409:
+	.string	"intString1"
+.LASF1410:
+	.string	"intString2"
+.LASF1290:
+	.string	"___int_wchar_t_h "
+.LASF804:
+	.string	"__DECL_SIMD_asinl "
+.LASF1393:
+	.string	"memcpy"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1202:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1369:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1304:
+	.string	"USE_MAG "
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF958:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF954:
+	.string	"__DECL_SIMD_tanhl "
+.LASF798:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1151:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF956:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1420:
+	.string	"_i2a"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF856:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1405:
+	.string	"pow10"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1295:
+	.string	"_BSD_WCHAR_T_"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF845:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1000:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1318:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF869:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1074:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF742:
+	.string	"__DECL_SIMD_sincos "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1142:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF906:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1234:
+	.string	"USE_CMS "
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF1333:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1031:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF735:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1325:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF946:
+	.string	"__DECL_SIMD_erff32 "
+.LASF929:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1352:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1138:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1032:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1394:
+	.string	"strcat"
+.LASF786:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF740:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF964:
+	.string	"__DECL_SIMD_asinhl "
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1391:
+	.string	"float"
+.LASF1144:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1059:
+	.string	"_Mdouble_ _Float64"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1239:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1415:
+	.string	"base"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1135:
+	.string	"__bool_true_false_are_defined 1"
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1315:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF977:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF803:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF794:
+	.string	"__DECL_SIMD_atanl "
+.LASF756:
+	.string	"__DECL_SIMD_logf32 "
+.LASF949:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1368:
+	.string	"__FAST_MATH__ 1"
+.LASF889:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF729:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1338:
+	.string	"USE_ADC"
+.LASF1043:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1232:
+	.string	"USE_LOG "
+.LASF1176:
+	.string	"USE_RX_PPM "
+.LASF1385:
+	.string	"__int32_t"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1185:
+	.string	"USE_BLACKBOX "
+.LASF1377:
+	.string	"valid_digit(c) ((c) >= '0' && (c) <= '9')"
+.LASF1020:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1266:
+	.string	"_STDDEF_H_ "
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1111:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1255:
+	.string	"USE_RCDEVICE "
+.LASF789:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF815:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF759:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF1353:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1121:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1029:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF866:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF719:
+	.string	"_STRINGS_H 1"
+.LASF1051:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1264:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1101:
+	.string	"M_E 2.7182818284590452354"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF1197:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1238:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF727:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1215:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1225:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1464:
+	.string	"mathcalls-helper-functions.h"
+.LASF1456:
+	.string	"math.h"
+.LASF1447:
+	.string	"long-double.h"
+.LASF1454:
+	.string	"__locale_t.h"
+.LASF1469:
+	.string	"platform.h"
+.LASF1465:
+	.string	"mathcalls.h"
+.LASF1471:
+	.string	"target.h"
+.LASF1458:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1441:
+	.string	"libc-header-start.h"
+.LASF1425:
+	.string	"src/main/target"
+.LASF1457:
+	.string	"math-vector.h"
+.LASF0:
+	.string	"./src/main/common/typeconversion.c"
+.LASF1434:
+	.string	"stdint-intn.h"
+.LASF1429:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1432:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1448:
+	.string	"stubs.h"
+.LASF1424:
+	.string	"src/main/target/SITL"
+.LASF1445:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1462:
+	.string	"fp-logb.h"
+.LASF1428:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1455:
+	.string	"strings.h"
+.LASF1443:
+	.string	"features-time64.h"
+.LASF1433:
+	.string	"types.h"
+.LASF1460:
+	.string	"floatn-common.h"
+.LASF1459:
+	.string	"floatn.h"
+.LASF1468:
+	.string	"stdbool.h"
+.LASF1431:
+	.string	"/usr/include"
+.LASF1422:
+	.string	"src/main/build"
+.LASF1472:
+	.string	"sanity_check.h"
+.LASF1442:
+	.string	"features.h"
+.LASF1470:
+	.string	"common.h"
+.LASF1450:
+	.string	"typesizes.h"
+.LASF1453:
+	.string	"locale_t.h"
+.LASF1451:
+	.string	"time64.h"
+.LASF1435:
+	.string	"stdint-uintn.h"
+.LASF1452:
+	.string	"wchar.h"
+.LASF1461:
+	.string	"flt-eval-method.h"
+.LASF1426:
+	.string	"src/main"
+.LASF1446:
+	.string	"cdefs.h"
+.LASF1430:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1463:
+	.string	"fp-fast.h"
+.LASF1423:
+	.string	"src/main/common"
+.LASF1467:
+	.string	"maths.h"
+.LASF1437:
+	.string	"string.h"
+.LASF1427:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1440:
+	.string	"stdint.h"
+.LASF1466:
+	.string	"build_config.h"
+.LASF1436:
+	.string	"stddef.h"
+.LASF1449:
+	.string	"stubs-64.h"
+.LASF1444:
+	.string	"wordsize.h"
+.LASF1438:
+	.string	"typeconversion.c"
+.LASF1473:
+	.string	"common_post.h"
+.LASF1439:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375 \372=\004"
+	.string	"\344\005\356"
+	.string	"\f"
+	.string	"\377\321\216\223\013\002\002"
+	.string	"\002"
+	.string	"\001\316\372\227\367\001\004\262\251\223\334\f\003\273\212\223\237\004\005\250\205\263\252\007"
+	.string	"\006\376\255\341\263\005\b\002\001\002\001\002\003\002\003\007\363\365\215\210\003\n\b\217\202\326\342\016\030\002\004\002\t\271\316\374\244\001\f\002\n\331\240\357\301\f\004\002\013\205\273\255\261\n"
+	.string	"\021"
+	.ascii	"2K\001\031\307U\316I\004\025\300\216@\013\f!\202*(\256\030\210"
+	.ascii	"\263\001l\001V\367l\232\223\320%\204\r\264\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375 \356%\003"
+	.string	"\244\003\342"
+	.string	"\f"
+	.string	"\003"
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	"\001\002\002"
+	.string	"\001\004\001"
+	.string	"\001\001"
+	.string	""
+	.string	"\001\003\004\005\001\003\006\004\003\007"
+	.string	""
+	.string	"\b\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003\t\003\n\001\003\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\022"
+	.ascii	" &\346\272\221w\b.\357\306v\025\b\020\304a\020\202\034@\r\020"
+	.ascii	" `\330T\036\202\235AF@/\300\220\r`\001"
+	.text
+	.section	.gnu.lto_.inline.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`&\004m\024"
+	.string	"\226`nE\360\256*\035\350\242\327^j\351\216/\271v\373S\267\326\355\034[A.\3670\\\342\005\01651\240\207\301\263/\346$\336zpo\n\226l`\006~\317\240\357\300s\004\350\303\231\f\311w\002d[ww\3332\311\024X"
+	.string	"Z"
+	.string	"^"
+	.string	"{\001\346f\273\245\2029\247\313\346\230sU\177\221\363\003^+\352\263\020%\0172|\317\"K\202\202K\001W\313R\362r\242@T\233\200\306'\370ZW+\002\206\223\331\260\232\024[\333\240\215\215:\t\212\231\314\343\373\3216}\3169\341\376\352[Q\013\373Nh!\033\303\033\2159X\356\243\322\246@`\360\272\245H\024\362\035nBJ\264\324i\031\262-dZf\242u\332\264\321%\257\326\232\262\"\007\225\n\033\245\251nP\371\226\225EY\321\235{t>rw\224\025\345Y\216\326\3233\2500\221\205\274\261\241\374\232\024SR\fB\037\372\360C\r=(\rK\001\035\002H\351\311QM\212l\f\206\025%B\276\364eM\355\331;}\204m%\007\362Hd\323FW\347\bB555/t\025\355\271\207\347#7\207\256b|\353qf&\373\320a\016\310\033H[u\232\333\367\032"
+	.string	"\355\365\257\252V\325]\334\276\227\206\243N\303\322\277\023\225\225[z\336\307z\b6\211\266jY\320\\t\006T\353\202\346\242\343\360'\2651\257\026\333\306mM-\315\253\305\006\300\036\333\217\200\333\301(\354\366\256.\001\267\203\261\316\035[\255\267*)\246\031P1\3266\310Q\034P0ai\233s\202NkA\003\r\t\001\237\337\364s\026\210\216\317[^oj_\026\300>\007]\250\341Pe\224\221\031\t(H\222\244\205\003\200\002\231\032\"\272\001\022@UM\2454\204\250\032\352\177\r\333\001\214\352\277?\202&\234\310\376\347W\025\345\303\303\214\237]\242\025<\356\263\007\365\330s];\216R\"\276rG\213\f\311JMm\306\2323\202\337\307\216\360a\"F\345\265\022Wd\203/\217O\\\214K\225\234\026\005\350\245\303x\r:@+t\221I\005.\347\307\374\257~I\261\220\333\347"
+	.ascii	"~U\335X\216\214`\234\302\2176\270\rh\224\0040\261\215d\363!\217"
+	.ascii	"\304R&\330\026\206;\221\005\270Z\200\026\346\326\343\207>;IP"
+	.ascii	"\277i\016!HR\034\177|\254\270\353L`x\004\217\334\373\346\355"
+	.ascii	"\216\276\326\2217\216-\344|\2453\370\215\020\356\016"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\355\002\355\n"
+	.string	"\026\220-*\2005I:3\320W\320\271\340\305\005+b\310\204t\256\253\340\3400\211'\204N_\203\227b\240\252\340b\255}\322v#[&\031 "
+	.string	"!"
+	.string	"$"
+	.string	"\354\331\242w\372?\367\016y\375;d\244\224\322\007\302\017d\322\222\036{I\217\371\213\013\026Y\001\002fJ\335C\206z\365\311\016Wi\030W\354$E\322q\271,7\254L\234\021\353D\354)=\306\267\001U@\f\027\324\022\037q\347\365;\207=\005\032\342!w\346~\330?\254#\234pN\3234\215B\300\324\017\367\n4(\025K{\365\001%"
+	.string	"sl\003\250%\200\372\304=x\301F\250\177z\272\341~\332\312vF,G\250!I\244\220\230\230\270\306n`\002\031:\235\007\022 \023)\305\362\230\202\3140h&\314r\313\267\r"
+	.string	"V"
+	.string	"\\\246!\353to\200\313\237\334\303d"
+	.string	"V'T\001:pn8\022dZ\001\227\315\236\005&4x\245S\337\262hE\236\255t\270\337\311\356\340\b"
+	.ascii	"\301N\2124\226_\360\242\257\361Q\226&\007\004O&\365\027Y\212"
+	.ascii	"!\375\304C\326:\016>\r$=\321\344\201N/\017\266\314\261Q_-\004"
+	.ascii	"\207\353\021\203\344=x\217U\264\301S{\236\246\f\243\230\tP\216"
+	.ascii	"I\256\311jy\374fn\326\200uqO"
+	.text
+	.section	.gnu.lto_.pureconst.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\232\004\001\232\004\002\232\004\003\232\004\004\232\004\005"
+	.ascii	"\200\004\006\232\004\007\232\004\b\232\004\t\265\004\n\265\004"
+	.ascii	"\013\265\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"\005\005"
+	.string	"\"\b\035'\220+\215\001\253\033\246\3774JU\257f\321\221\274\334\326\251>\263s\235\r\006Q2\316t\031yfC{\373\357-e\nC\205d"
+	.string	"\034\305\b\001#\\H\321\r\t\366\331\324@aNKj\036\016\252\343a\f2\220\217\224P6\227Cc\022\251T\0223=\365\276\335\016\341\353\322\333>\237\273\352\252\023\263\306\326\277\367\252\372\372\3566\252Y\236\351\257C\023~N\021"
+	.string	"+\201\201a/\313L\343\236\017\r\304h\355b:{\340I\214!\205\302"
+	.ascii	"x1\325\037\224\r0\007\231\231\t4\214\201\""
+	.text
+	.section	.gnu.lto_.lto.6566a440e4d1b770,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uli2a.6.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`!\006\205%"
+	.string	"\212C\204\016I\200ZN:[\340\3726!2\236\310`dCc\r\277P\343T\021ZD\273y\033\"\233\2748j\221\203[v\255G=q\230\022\004\211\327\363$\016\377RK\334\253\306{e\004T\037\360,\324\241\026\325\337,!\204\020\271\223\f\330"
+	.string	"\307"
+	.string	"\323"
+	.ascii	"\367\253w\22310j\346W\206\205\350\331\335*\260\022\027\316~\255"
+	.ascii	"\204\315\324\240\334{\017\260\205\364"
+	.string	"&z\345g\277\216D\352I\214\370v/\2153\n\351\315\240\022-\373\3352\277\310\215H\375\310U\276\336\333u\204r\357\327\001V\220\336\344\257\363\316\233\351u\316\233,\305L\246\307*W\004k\211\232{\257\257m\360\216\313\226\272n\247\346p\267\024=\327\262\255\024\237\007&\2538\342:\031Wvwny]E\221hlq='Dc\013\306q.`\330\033\214\0266\345r\202\013U\213Xe\020\331\205~\234`a\317Oy}-Q+\255\035\347r\342F\351@-\255\354\311[b\221\312\226>R\274\237<\001 L\262\212)nQ\244{/\333\254\342\3269\347\314\307af \263i\f\2154U\336{oY\324G>\250\247w]\324\277r\365\203\312\2661\023\212fB\305\252\330\314+\376F\347\221\257\320\326[0c\312\2561\2006\\\256]c\376\032a\333\310|\007^ji\334]\314EDCBW\362\007\r"
+	.ascii	"\372\371\330\331\347a\177\200'\371{~\374yvx:\247\345\234\365"
+	.ascii	"\310\363\356bg\335\303\316\352\217g\034\324r\356\264\214;-\337"
+	.ascii	"L\313\251i\0315-\237\267l\336ry\313}\313\366\226_\340&L\247\314"
+	.ascii	"\275Zml\256\026\263\214\307\307~\344/\366f~j\342\307w\302'\343"
+	.ascii	"\233Tk\214HRCz\363o\362$\337\240l\304\330\354\3071\355\336\233"
+	.ascii	"!\275\231Z\375\230\221F\345EB\230r$\355\006\3275\321{\344\232"
+	.ascii	"/e\311I=\323\301\017q\336\264W\262\314\340:\327=6\324\017Kp\265"
+	.ascii	"\207\332.\271\002\222\323\267\306\365\257\270\314\276\365S2\271"
+	.ascii	"6\226l&\304k\r\327]\275\007u\022\032\216\264(inm\344\333\331"
+	.ascii	"\354\364\351\177\001\303\022%\303\232m\2511&m\343\321\300\254"
+	.ascii	"TY\265\277\213\230$H\364Qg\332O`hh\237\235\366\333`\245\360i"
+	.ascii	"\264-\032\254\"\275\353\372\234\022\003hm \"/~\372\307\237\376"
+	.ascii	"\230\253\262\026>\3751\263}\372c\312\306is\355\262m\033\262\247"
+	.ascii	"^V\234m\344\257\335\305g\030\256.j\034\0236\373'\3375\221\231"
+	.ascii	"\271\333vR\226*\253\306=\335m\2754O\333\376\025\021*\333\326"
+	.ascii	"v\t\026\333\224m\343'\177\363\261\013P\0356t\360\033\316a\311"
+	.ascii	"\002\243,\323Pi\251d\016KJJ\013\030$xp$\240)*\330\f<\n\n=\f\237"
+	.ascii	"\230@\004\205@\246\017\"\240|AaS\223\020\350\013zPj\362\001\237"
+	.ascii	"\206\276#\002,\374\300\364\344\203\022\n\237|7_\367\335\305\\"
+	.ascii	"\356\324\036`\016\3212\325T\314w:\371R\220\234l\356\354\314\224"
+	.ascii	"m\253\020D\267\356x\2756\361\311G\260Af\355\235\325\235\326\005"
+	.ascii	"hVuZm\"\257<\315\245*\3248M4:\327NB{\362\351\032\0258\375\243"
+	.ascii	"\332\017\323Y\273\306\353.\007\324g\030,(P\363$\3440\221#\352"
+	.ascii	"}\247\211'\373\004\022l\271\241\346\022U[\247\2116\367\323\350"
+	.ascii	"\r2\364\247\205\216Bm#\333[\203\017O\233\"\370\360To\260\341"
+	.ascii	"\230\312\207g\016Q_\314@\200\204\250A,\245\020\204\304\314L "
+	.ascii	"\"\243\005I:`\002\231:\253:\020`h\232\244\320\030\225\256*\336"
+	.ascii	"`u\267t\0272\316\027\320\225\017\022Z\005\367V\b]\017\214n\r"
+	.ascii	"4D\214\027\320sE\262\345L\006#\231\031Z\234CB\004\r\216#\370"
+	.ascii	"jzb\363*\353\332\242\365VIx\030\200\333\3230\n\024i\357$\240"
+	.ascii	"K\336m\375\020\216ui\241\330\324\302f\263\f\345\002\200V\030"
+	.ascii	"\007\034\266\264\027>\317\334\023Yi\323gK\n(\033\016\2635N\344"
+	.ascii	"\234\3472\026j\204\247qB\026\001\327\3713\332\265\205T\265a\243"
+	.ascii	"\252\210\226\255\321\337\360\214\017\313\273\236\230\306R\215"
+	.ascii	"\201\240\205b9)\204\033\t\007\0318\205e\215OE\252'\362B\234\266"
+	.ascii	"U\026\305_\304x\013\321\343\330\333:\2018\200\307n\202\361N\371"
+	.ascii	"\355\361U\270\177\300\276\rf\241F\322\377`\f\243\326%'d\315\367"
+	.ascii	"\237}9\273153N#k\376\317)\344\364\340\350\300N\005"
+	.text
+	.section	.gnu.lto_li2a.7.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`l\001\005\017"
+	.string	"F\234dE"
+	.string	"\221(\035c\310[z\214\301W\311\331\355\016\377a\362\2306Ee\313g\013S\204\020\333NtZ\350\177\271\2141\304\005\312`\227\357\236\177\317\227\370\236\300\221a-\2224#O\351\357\203\225\310\223X\262\211\224)\005O"
+	.string	"J"
+	.string	"T"
+	.string	"\013\343\020\263\273\036/\350\036\035\276\303=v/\300=\032e\3230@\201\363\202u\002\307\356~\272\341\250o\232(\377\262{\255W\352\233\313uC@\223A\206\200\027\313\366\3612s\271\354\351z\25527#\273\353l\275.\334\361\266IlC\260\217\"\231\303\035\031\030\2334;L\245j\260\277\355\356Za\266\327=\374\271\307\376\370\360\326\307\356\324\3649\001Xtj\273\026j:v&\246"
+	.string	"a\373\036\366\206\204H\206+!bvC\217\037t\217\033\030\221\247}\021\037\201z\314\263\023\330"
+	.string	"\236\200\273\332\247\224|\313 ,M\351Y;.{\204\026\231I\263\352\210j\363\\\205\363M\230T85\035\374\025\356q@\215\rU\326\354\351\303\220s\352\351c\264\300\254Vt \252\2449j\247\237\321RC\2255\217T\\\346\006\r\006\365\214\213\032*1c\t%\241tI\b\004b\320 \304\301\347\203\224RR\213>%\320\344d\032I(\201\242\321\311\004\224\257\004\222H\240\350+\231\200H\237\310t\372>\007\f\236\214L\037\n\b\232>\217p\277\255\302\\\341\203z\234\252\272.;\211\207\027\355\324[FMuE\0273*]y\223\252\n\036\036"
+	.string	"\225\023a\325\320\023\023\003\004A\023m\342\013\207\023\244\301\241pL\f\203G\263Z\304X\254\321\036\317ZA(\234@M\214\350\333\016+"
+	.ascii	"\205IM$Cc\\p\201]\336\330\262\341\261\205*\214C\035\034\327\306"
+	.ascii	"TBN)\324\036"
+	.text
+	.section	.gnu.lto_ui2a.8.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\377\005\245$"
+	.string	"\312A(\016K\220VN:\244p\013\361\032\2300\320l\352E\344x\327\216D4Q\022\276.\034HaB W\247(\207\254\346\316\270\330>T\376\3623\002\342N`D\022\2461+\326a\265`%\316\215\265\017C\263j\304\310\232%\204\020\"w\222\001\317"
+	.string	"\303"
+	.string	"\314"
+	.ascii	"\367\032wn\362\004F\257O\347x\330\322\217J\357\335\253\225EB"
+	.ascii	"z\223\215\3519\305\307~\361\031\223\036\367^\002\034a\2111\310"
+	.ascii	"\203\364\346\231\346s\313\374\033\307\261t/\035\306\335\233U"
+	.ascii	"\243\307\275F\002| \275i\363\230\363f\371\227\363&/"
+	.string	"1;\3619\251V\240\302\252\334{\201\315\202[\270\354\245\363ZV5\207K\321\263W\266]\342[\253\262(\"\323y)\236l\3139\305\365\025\375\311\232\302\272z\2235u\365\334\211+\213\273\262\262\251\232\024\026\272\022\241J\233\344o\272\244L\330\363B\256\367J\324I\004\214\253I\265(\025\264\261\231}\354vHl\262e\261\352\375\261\347\320x\022E\254\272E\177\356\275l\243\210Sg\2273\177ef!fS\030?\302\362\336{K\234>\36260\2556N\177\310SW\223}\343!,\255\003\315\211\330\034\343\366\353\234G\036\202\225\235\036\025B\353\3061T\324\256uc62\331\336b\276\002\25666n-f\234\233\032\032\001\377\372\003\314\374dNv\366\375\370\307\334\370\303\334\353\177q\341\231\226\327\335\221g\365bg\335\217\347\334\275\316\270\323rjZFM\313gi\331,-\227\245\345\276e{\313\317\351!\001"
+	.string	"\355^\021oWn\232i\026\343d?\362\027{3\037\275\362\341\363\340'Y\207\242 \343\263\224I*\325\261\002D\205\364\346\277\343c\254C\243\304\370\254\313\215\355\336K!\275\211R\3710#u\312\213l"
+	.ascii	"\344\n[\027\033p]\337"
+	.string	"\234'\322\346\377\320p\264*\271\367\376\005_\351\274i\207DAA;\355&\253\351\037\r<\32753\326>\033\355?a\331>\373\251\023\265\267J>\253\301\345\226k\255\235\007h\006k.\330|L\301\365\026\343\316g\247\257\237\004\214\310z\264\262gFV4I{\353k`B>\330\266\377\310\222/$z\017\247\331F`kew\233},PU\276.\333J\201\272\261s]7\220\022\277]\377l\214\220\351{\311\364\233<\231\251G*_\237\314\266\257\337\004*\213\320\276\361\256qm\333bI\376!\216\304\263\267\370\275\326\342\363\211\223\306\351\\Y\322\276\354j\017a\372\375.\260\"\037l\033\253\375\322o\033\366d\343c\307\025\325\016H\030,t\321-\374B\220\025J\262CG@A%_\b\002\002\352A``\001\317\217(\251\250Y\210\247(\230\341\310h\250CQPh\210\203\022\022\260(HD\024\024\002\026e"
+	.ascii	"\""
+	.string	"\002\n\031\035\001yr8\310a\310\b\210\024\f\032\001u\306\373\262%\327\002\034\310H\023v\023\363\217N\376\217\006GVU\022Eh\337r\307\"\257\247\272\364\256\207\037\273\203\030^\275\235\363:\323\272\230\346\225\327\271\036r\357\245\271\\i\032\327C\276\316\271K\255\274\341\372^\271\376Qg\255\033\357Z\324_o(\302@\177\355\222F)\022Qov>\323\303'\217SQL\2525\315%\232k^\017\255*\323HE,T\246iN\265\366\026[\\\202'\2356-\360\244\363H\212\311\034\243=\351\\o:\200\203\250A,\344\024\204\304d$\220@F\223$\035p\002\231:c\007\020`h\232\244\320\030\225\256T4xZ\257_\3162s]\030r\225e\022Z\005K\214\323\365P\263\215\202\341>\3260\024a\241\312\221\300\226d:28\b\016U\205\351\f\270\022\362yI\022\315\213\327\300X~\374\032q@T7\216"
+	.string	"\275\236P\026\333NQ\300\\a\210\034\325\327\320\3714\"A!=\215e\032\024\302\265*\370\021w8Z\031\026\262u?#G\017\2737\007\370o"
+	.ascii	"\"\2353P\021\217\001\223\343\207\202#\003\370\227\306k\030\224"
+	.ascii	"\030\257\3311\377k\036\3758\342\313\263\243}\026\305\\l\244!"
+	.ascii	"K*\310\313a\271\017\210\3426\212\007\250\032'@\360l\260K\260"
+	.ascii	"E\202\320%01I\372\221\235\327\352T\210ASM\222\205\013\364\243"
+	.ascii	"\213k/\326'\264\376a\214\255\210w&T\325\373^<\237\335L\327\314"
+	.ascii	"\322\340\252\377sJ8\277\310\035\330\251"
+	.text
+	.section	.gnu.lto_i2a.9.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\177\001\215\017"
+	.string	"\006\236iE\020\257h8\240\246\311\32184\035\215\246\374\203E\360\357\221\027\310\251=\\\364g\247\\<X\032j35BonX\200\205.\024\254\266\022"
+	.string	"\020\320\303\004\360^\372\213\335B,\321\325\220\227\037m\377\275\267\224)\005S"
+	.string	"P"
+	.string	"X"
+	.string	"\226\361\267{\201%fwAN\340\235\373\234@wn\373\200\356\234U\366\315E\r\373\261\202\353%\306\356\202\232\341\252o\232*\377\343\277Wl\365m\345\272\035\250\301\300\002@,e\353`\231Y\371\370\204\305Z\231\032!\273\353|\305(\334\334m;\260\r\301>\212\t\363!\305f\216-\256Rg\366\267\335]\253\314\376\274\327\376\356\264\237{\355\326\323\356\324\364=\335\211\232\002+v'\354\314X\032\256\004\007\333\347\260\273\021 )^\204\3525\224\013\330\225y\210\331\025A~\340\235\263\350u\"\310\323>\210\273\250N\013j\247L\362/\177\\\272\322\273t>~\003\306Df\346X\035\302\332tf\033\364\223\316\177A\235xl6\370(\335\271"
+	.string	"68\254\334\361\247\257}\274\323O\257B\245C+\204\367ae\2169\365\364-T^\260r\307\036\030\227\223\200QcAuf\217s:\032gRR\206\003\"\243\264\310H$R\260\340\203A\250\303drR\223B\247p$\205*E8\205\244\022\211\204\022\360\024\232L!\t<\215\210L \t\225\002C\006\034\222\224P`I\030\242@\016q\277\255\312\354\242EG\277NUa\037\357\341\264\334\250\247\336\222\323TX\003\031\032\226\266\254\221\252\036\3378\202\356\001\035"
+	.ascii	"\225\023\341\325\320\026\023\003\204^\023\355\343\013\227\023"
+	.ascii	"\304\301Qpw\f\246\265Zc\304xaZ6\f53\350I\021}\325a\261\243\224"
+	.ascii	"\307\331\306e\026\304\355M('\236\035\210\001N\360\251V\304I\236"
+	.ascii	"\352\312)\205\332\003"
+	.text
+	.section	.gnu.lto_a2d.10.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\032\002%\021"
+	.string	"f`sH"
+	.string	"\355&\035\223\240\236\t\265\260\022\220j3\225\037E"
+	.string	"7\270\037Lb\320\240x#\200\321\242=\220B}\362o6\222\340\360o04\377`\323\362\377\377\220\250\323\311b\2426\204\027!R\345\275\355\233Z#d\357-\245L\001b"
+	.string	"S"
+	.string	"`"
+	.string	"+{\211\335\240\250\265z\002\326\202\356\224\033\200\356\354\n\013.\267\321)\233\301\257\310r-\203a\223+\033Q\263A\022T\244\002\236\224\231.\21415\3116LX\027\226\260$\205\200\021\242\200\242\262-\t\210<)\246\220DZ"
+	.string	"\311H\354l\371$|1o\033\265\326\263I\210\262\037\355\377\223\377\f~\316\b\3438\216o\226\237\371%\346w\314'-\315\356\210\371\034\363\267\346S\346\317\346K\346w\363\271\371k\242E@\027%j\2150\026\325\237\251\003\363/\r\374\273\237\272h0\357\354\030\032\340\322@x\327*\2129\265\326\002\307\340v\376\377\312,\007\360\337\2214\013atF\211\326\3475S\243\240\313\354nv\327L|hH\2463\347\272\250\354\220\t\262\373\006"
+	.string	"L\210=\020\001\255\310\006\373\035\332]\352\022\216\317^0\021\177\272[>Z\027\345\346\250\351!\341\024\337\234u\321m\356\205\211/\036?\352m\356\211\255\030\341\361;[\022NOPe\025?M\204\273\345\337\016w\300\201B\035\3100\220\340t\361 \305O\235X_\307GK\025\302\372R*\017\027\210\307\372V\253/\345\261:P+/\325\372\360N\003\376y\250Z\036\310\367\265\274\216V\267Y\276+1 \350i\021h\330H\275\"b\304\331\365\316v\364\222aE\227\232k\256\2771\322/Yk\255\334\202\255I[w\355\304\207\0166%\233\315\006) "
+	.string	"#\221\3329\204 \354\025\360\266\237wi\030W\373^#\244\357.\350\225p@\263\206\336\306DA-\356\306\326"
+	.ascii	"\311\273t\221\315\274-\215\260\361X\025\373\362\233\025/\016"
+	.ascii	"\231\222\027$aG\316D\007\035\316|\271\201s\210v7G\310\363\216"
+	.ascii	"6\235G\250P"
+	.text
+	.section	.gnu.lto_a2i.11.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\037\006u&"
+	.string	"\nF$\017H\220\330Q:\204\342\347t\201I(N\360I\3226\026A\325\351\327\363\206\276d\300\203\016\270\236\227B\217FE\374\231\242\301\375.g$\217]g\245"
+	.string	"\221.\0314\032tESX# \264G\036\326\264_\276\265F6\2212\311\341"
+	.string	"\316"
+	.string	"\335"
+	.ascii	"`xe\326\206\225\351P;\245Yx\034\345\307\245_\255\330\332j\335"
+	.ascii	"\201\205C\355\024\250\354\3425\357\376\311\241,\335x\342\001"
+	.ascii	"j\345\261\345U\253q\301j0\236\307<\255}\307<\245X<\346\027\231"
+	.ascii	"\266k\035\346\360\252\265.\330\007\265\323\007\274\245e\272\321"
+	.ascii	"G\213\037\267\240\260\332\324Zw\335c)3\035w\336l5\232I\313f\246"
+	.ascii	"\375\004\034g\242\244P\034\367\244\023\237mU\344V\236H\346\370"
+	.ascii	"2\341\215\322\302\330\013'\257\022\326`\233\216\310\244\3662"
+	.ascii	"!\215*"
+	.string	"\341\f\246\335\274\fA\263\303\205\215\233\245\202\341\330\013\235\024T\311CF,s\260sP\n\310\264\b\214\227e\205\260\030-tRO%\007\031\203\346U\302\033\334O\276Lr\343L\224\024\2143\355B\255u9J\312\3057\367\335\r\263\273E\273\364*T\373\023\346\251\2559\031\254\321\304s\226\265`\224U>\3335:qO\355>\001\033!p\266y\3542\357\017\363\032\360\241\361\026`^\002\003h\274=\314\313C\343\025@\343\335y\326\037@Gw\344\325\217;_\374o\266\033\377\332\221_z\256o\371\342\267\231\227\231\367\007hE\262\237\256Z[\314\201S\273P\260!G\376\\\337w\035l\367\334\337\251\354\277\350W\230s\357U\326\031\025\216[\346\017\036\363\275\366\001\357\367\"S\003\232\326\221\312\354t\337\365\333=O\277\273\264\227\362)O\356I\315x\273\\J\257@\241-\212\2104\253\325H\302\rr\305\200\236"
+	.string	"\324'\342\024\"!j\247\346\023owk\305j(\204\265,\"\227Y\2555\350t?\320\215\225\003\242)\253\374\265\206l\007M\303W\314\344\346\031:}E\026\227\013\211\032v1{j\223\254X\224\271\016\301\344\t\007\235v\360:\254\206\245\256\317\203\211\020\266u\331\301'_3\263\032\226:\275%\337\272;h{\tS@\2038n\271\327K\230;-\240\017\034v\3574o\001;\206\261\177\375\226\205\305\213\0277\233\201\222\363\344\237\003\312F\367\213e\363\331\322\276\320T\326Z+\325\351\027O\301\212\t\237\216\017%\363T\247\017F\327\347r\360\262u\315X\300#Fr}\344\201~\372\235\353\233\001\016\233\366\233\267"
+	.string	"\253\234x\316\342\264\212\\Q\361\225\242\354\251\375i\\#\035\307\236\370\315\342\264p\264\2303 1zi5\312*\215\240\037y\b\254%\303\326\347\372\006\035M\017\353)\365\210\tG7R\352uR\321\210\242\020\364\310H\251W\022\375\204@\224CH\277^\021 \204\204 Dp@\201\201\017\211!\336!\006=_\321\017\211\310D\3177Dtt\"i\327\363\031\031\371\206v\275\"!\243\335\020\322o\307"
+	.ascii	"\301\372\216\210\220vI>\037\322\35646\305\271\215\366\236\264"
+	.ascii	"\267i\017({\317\262\267\313\366\351\340\332\272\367\354\336\262"
+	.ascii	"\273\317\263)\350hj\247\2455\031\320{2\017+\306\033f\236\346"
+	.ascii	"\306\320\226\3704\213\251\265\236*\367c\206\222\262\032\007\327"
+	.ascii	"S+!\311\315@\377\213\222a\215@\037\3546*$rL\236\376\351`\320"
+	.ascii	"\177\372o\216\\\236\370\315\326\201bh\331\350\322\324gX\300&"
+	.ascii	"g\006\003l\262l]\001o=\265\327\362\002P\n\2549\027''TlL?\bt'"
+	.ascii	"\263\324l\2324\304*\265\236Z\372\022fO\233\310\321\323\001z\250"
+	.ascii	"Q \306\230\202\b\321\210\004\023d6\315\030p\002\021\262\253\016"
+	.ascii	"\021\200\315s\303\255\261\031\204\266\242\344\321jK\373\342\211"
+	.ascii	"\202\365\021\3618\263<,\372\246+J\312\243\330m!$\256\300\202"
+	.ascii	"E\211\025P\210%:`r\210t\002\\\241\367 \202\262|\375\t\334\017"
+	.ascii	"\022\313FP\212\373;1jb\306k\016\023\335\232r\030.\3034v\277\226"
+	.ascii	"\027\211\313\202\346\024\2642DOf\f\325\360\341\225\005+^l\030"
+	.ascii	"\030\277\226\037\210s\357\240\341\222\333i\352h\220\032g\ri\351"
+	.ascii	"\255\2133~$\267\247\311X@\374\225\254\231\261l<\264b\240L7\347"
+	.ascii	"Ev\210\237\025\177h\225\r*\034\371\n\237*sXS\r\263Z.\207\262"
+	.ascii	"X\373\356\333T\327\261;\202y\347H?\215\034\317\305H\234\217\027"
+	.ascii	"6l\277\260\277\221n\302\367=\2010=\352\034\355\025\204\243A`"
+	.ascii	"U\313\306\301j\302\346\322@B\323\306\211\236\351dR\214\032"
+	.text
+	.section	.gnu.lto__i2a.12.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\312\001\335\021"
+	.string	"6\242{H\260\226Q:4\246p\346]\361\352t\2471)^\323\320\017\005\020/\214B\0303x\215\345\325\271\031U\355\226\2775\305\r\253]L\267\261\374\277\024\254i\013\026\215G\263\016\203i\327\331\251rc{A\250i\323Z\262\245L)c"
+	.string	"^"
+	.string	"f"
+	.string	"J\357a\273\350b"
+	.string	"s\316Hj\232ST\340\230\360 K\332\366y<\311\346\033\001\021\251H5\252H1B\231SlY|K\352`\370\001\251\203K\343\267\313\325\233\377\3612\ti\311\216\027t\271\342+\023@9=a\341\t\311\026\"\034\273\217\327!^NUU3\347\264\356xE7x\3336\266Q\330\217\022GVmju\226\210\bi\224\325\307\342\310T)\266\030\244{d_\3169\247\327\310\266ze\365\336\037\236\351W]\374S\357\335r\325\253jU\365YTb\030q\0212'\321o\312,\002>\345\260\377\303f\257l\320\306\310\224\004G\206\313\372\245\367n\0270\247Q\220\233\360 \350\302\245z\037~\313\302m\3160\227\273\262w\242\323\241\002c\327\367\375"
+	.string	")\222\033\376-u\360\343\216\tN\177'\016\004(\234Sh\246\026\352r\020\034\334u\325x\302\351O75D\367\224\323\237?^\305\367B\272\006'W\373\336Y8\225bPU\033\356\327\266\231\320\357V\313\322m\320\367Jt;r\372s"
+	.string	"_\213#EA5\355\006&1BD\210\034\020\037<t\300\341p\263AC\006\f6\027,T\2400AB\004\b\017hf\0344`\340\222\211\201Yp V{\351\310\327]B\347\365\222q\301\320\274\024\330\271a/\262\331N\215\026\373\221\315`\261\036 \237\226l\306\3033\203\265d;/\236\026\214Vk\275\030\360\254'Fk\371\314f\264\326J\234\227s\215\374\361a\023'\245]\255\245\206+w\310\366J\035"
+	.ascii	"s\203\360\303\320!0\n\204\321(<\331\227Lay\033\254h\340\016\""
+	.ascii	"z\202a\221\357\bn\216R\342\037\255\303lB\3432,n\002\3728\022"
+	.ascii	"\204\203\314\2060\004\314\035\032\312\022\306\351P\363\340n$"
+	.ascii	"\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_itoa.13.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`\241\006\375$"
+	.string	"*Ch\016E\200^Q:\227T\303\347\255\206$\303GCOuV\307.\242\231 \204\022\177Q\210\254\331\366\022?nZFO\227\236N\f\023+\315\201H\030\206Q\3726Q\372\n`\363Y\203UP\241\251\377K>![\356$\003\323"
+	.string	"\310"
+	.string	"\313"
+	.ascii	"\247:\271|\374\330s/1\351%\377\214\217\231\366\2622\363`\246"
+	.ascii	"1[B\305,\025}t\\O&\352\001\356\205\322\345x/1\211Q\234/-\036"
+	.ascii	"]\255\314\027\3631<Nd/\226\335{%\345x\357Mb\t\347K\234ef\376"
+	.ascii	"\227\203\341\301Q7\242\224\252\333\261\2322\006\272\227\230c"
+	.ascii	"\342\213\314\227\347\211\314\227\035\345Q\247\315dg\314,m\327"
+	.ascii	"(\276\345B\205K8\354q\332\314\300UU\222\313\016F\225d\353\006"
+	.ascii	"\260P!\251gL\311\300U\225\222\307\216\334\264\r\366 \001\331"
+	.ascii	"\206S\266h\210\025\341\223\301Z\332\004t\236\3449\030\225\225"
+	.ascii	"EZ\002\247\210\217j\213\274mC)\213\273\367\336\370\nd\b\2545"
+	.ascii	"\246t\357\345*\034V\235kgf3\314\274\203\331l\0219\314\332\273"
+	.ascii	"2r\244\252 \006\220\246i\330s\230\357\332\017.\001\326\224i\375"
+	.ascii	"\256v\246\302~5\345\212j\001\273u\0203\021X\033\213\371\235\246"
+	.ascii	"i\312\r\205\231\200Y\031\311V\036p\364|\263\225\217\214\314\312"
+	.ascii	"E\266\262\200\037\317D\266\362\320\311\374\266\023\377\332\213"
+	.ascii	"?\355\305\263\314V>m\345\230\255l\332\312%W\266\266r\227\225"
+	.ascii	"kY\371\007fk\3500\340\272wHJ\350~\225]W\216\376\307'\217G\276"
+	.ascii	"\253\257\270\030'E\274\303z#\336**\007\337\362\335\f\037\315"
+	.ascii	"\323\\M_\255\341r\357\245i\025\251h\025\337\240J\300\037\"\234"
+	.ascii	"\350\270\036\365\235L\224I%#\202\225\265\300\336,\017v\254\034"
+	.ascii	"\274,\255t\266>\313w\342\202\374*7\n\371<\311\374\342pz\347\275"
+	.ascii	"R\027\234\316\340\013\005/\213Z7\245\353WS\001m\306\tv\001k\212"
+	.ascii	"\304\250\177l\022#:k\267\355\241\346'}7\352\205D\215\013v\017"
+	.ascii	"\3566{\250\257'\350\005x\204\215O~I\263\261\330\354\356]\231"
+	.ascii	"8\311\317P#`\357\372\207\b\207u\272\217\264\375\243\331\347:"
+	.ascii	"\256l\263\357\025\344\323eWc\204\333\332\366\203Y\2005eYw\337"
+	.ascii	"k*l\006&\351=\223\357f\327\253\335\271\367\276\n?\312|i\223\342"
+	.ascii	"\247\206~A\376\241\303\244l\2543PRL\237\315\331VZ\313\032\b3"
+	.ascii	"\263\203\327zW\006\316\215\237\241]d\375\342Y\351\327vv\3662"
+	.ascii	"_|\206&\277:\210k\350\226wc\361\201\007<CF\f\030/\\\264`\261"
+	.ascii	"BE\n\024'L\224 1BD\b\020\037<t\340\260A\003\206\013\026*P\320"
+	.ascii	"M\220\020\001B\202\246\336\322\316.\235i\354\226\226&\350\"`"
+	.string	"x\200T\343\314\364\340\211W\243\007\325\244\343\211\307\324d\303\207#\367\304sr\3421\345\236j,9\345\230\240z\271\007\b\230g\243\t*\207\203\307\203\312\321\210\277\333\333Pl\215\241\311\257\201I{\267d\267f{\332\232@\003a\376\327\371sB\024\320B\263\220H!J \r\330\"\320Gg\267>\032k[\0375\177\353\026\353\263\217\352\264\321SHvvlKM\254\257e\353\243\375\254\343\372\354O\205\375bAPd\265\"\\\362u6\326\351\007)\306$j\266\245m\2439+\236t\307\017\037y\034\237\3537\376B\204a\276*\252\244\250\371nV\364\002\200\203\250\201H\204\030RfF\002\021\t3\005I\332\300\"\2212\253\003\021P9Tv\223\024\262qst%$\317\222\317hs\252\256\354Qg\323\370A\215\b\324$B\036\2129B\003\300\261\210\036\367O_\372`\323\004\350\261\020@\236\267\341+\234\214"
+	.string	"\r\257]\n, \330\262\033j\246\2225\306\341\023\324g\203<;\313p\020\033\373\217\273"
+	.string	"\007\260\357K\206\"\002d\177Q\356\373\035\203\334uyx\246[\246\360\230\013J\242\005\277)c\003gm,\364\ts\316dB\007@\0227\262;\332\262\3742\207[\201\247\364\202#p/R\253\353#\251\2709E\317\001\251\243\335'\363\341\2526\017i\304\353\324\264\252\025\221\202@\275\317\363\321\b\315\215\333H4%\352\006Z4\357F\347R\336H\016@P\341\\\017-\301\242\b*ZX\220c\022J\250j\244\017\037\351"
+	.ascii	"\316\025\274\025~\317\227\223Y\362\337Vw*"
+	.text
+	.section	.gnu.lto_ftoa.14.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`x\b=+"
+	.string	"\232I@\020Gp\334Q:\025i\315\3323\223\243\004\024!\360\320$\0069J\244E\002\205\020\261\242\273\r\201\333D\273\262-qb\b\007\245\224\0235A\024K\223\3462\2279\265\334\034\nA{\372e\005\260\321\276\375\007\371\204\020\271\223\f\357"
+	.string	"\342"
+	.string	"\366"
+	.ascii	"\274\007\320\n2s\201\372E*}\220j\272^\254OQ(A\013\030\236\376"
+	.ascii	"ec\275[\271\260,+o\3672%<\345\025k\307\005\331^\013\324\201\356"
+	.ascii	"E\322Uv/s\210I\254O{N\320Z\346c\271\327\323\231\354d\237{\307"
+	.ascii	",)\273\367\016\261\205\365)\020ef~\327\255<1\224\001\246V\325"
+	.ascii	"\3254\231\002\203\273\227Y\304\314\017P\237\256\017\240>\355"
+	.ascii	"$\207\372\317\327\343\355t>kNM\321\266P|\347\321)S\324\222T\306"
+	.ascii	"\377|=4\302\325\231\036oS^\241\003\270\224E,oG\204K9\304\352"
+	.ascii	"\214\334\007\275\200\003\216\310\333\224BP\036\236\2514w\236"
+	.ascii	"\001\2272\210]\031\344\216Ueuu\niS\037GuT>\336(\202\2533=|TR"
+	.ascii	"\250\003\266#n\356\274\325A\025em\256\303\275\227m\222\252\352"
+	.ascii	"\374sf\206cf!\314\2712\001\275\376\365\323\220WQ\366\311<\261"
+	.ascii	"\247m\222\274bkg\203^\033mA#e\361\260.\356\316\321b(\320\272"
+	.ascii	"\027\371\244\322\212\274\225\320\323sy\206\345\321\216\223"
+	.string	"\275\017\241\213\275\247Dy\264O\326\321\321\311\261bq\332\256\315\303\3144\332\316\272\215\204\231-?P-\013]\313\017\374\3279(\265\ft\262\363\317\317w\346\337;\363\274\256\226slYU-\2479\313\250j\271U\313\326Z>\004\237\025[\204\347\275;\236qw-=s\362\257_\354\377\362\223\035e>\212%\310/\343\237\361\016\3652\023\243fl\307\372\364\314O|\260\207\275\371\261;y\207N\005\231\311f\254F\345\032\2265\345\355\336\373\034U_\234\200\306\237{\263\250l\335\253\274Q$\330\345^\236.\346\264\336-\020`U\336\356U2\255Oy-\017\023\027\346\346SK\203\243\026\344I\257\315X03lBxd\304\240\235\201Y\013\333\331\033>\035`\332\312I\0266\035\201\005/{\023I\200\026\212\024@\034md^\323\214\310\353k\356f\323+\024\206\272\230M\031\226\245Og\361\257B\265m\264\245\r"
+	.ascii	"\2732\263ha\237\264}a)\325F\266M*mw\035\222\222\003^\2502\363"
+	.ascii	"\2047\205\003\334\356\275\032\n\270\32196\237\250\235\305*~\240"
+	.ascii	"\276N\022\263\247\177\275\266\016\376\f\365\247\215\266\250\331"
+	.ascii	"\246\021\237\325\235\321\324\227}\f\351i\334\222@\315\fch\237"
+	.ascii	"\224\260D\266\221\177\032\250\021\244!\341T*,\263\337kyv4\017"
+	.ascii	"Vs\310O\237\354\300\367\017\232\243}\342\271\367\nX\373\335c"
+	.ascii	"H\256;\257k\002Y\273\3031\365\371\266\232<nV\207m\211\376\372"
+	.ascii	"\314\003\217\316G\345\030\262v\231\303\363\351F\352\336c\203"
+	.ascii	"Ld\231-\005&#a\213\024iF\222\220FZ\301\002q\250k\"\016\213%\222"
+	.ascii	"\204J\303#$\027<bq\330$<*\216\220\341B\007\2038\\j:\321$,&\275"
+	.ascii	"\330\361\013#\241\360B\260\302\006\"\0045\316GD\304\342\220i"
+	.ascii	"\t\211\006\261x\204$\303FS\021\261\250\244T<*\"\016\205JEGKL"
+	.ascii	"ED\r\270(\003i\251\250\251X\\*\3321\357\321\333H\2707,\217\035"
+	.ascii	"%\346\204\336\213\305\341_\3767-\366\311\276\037"
+	.string	"\004l\256\201\275[\246\31592\036\326\236\315\250|\264\0309\2544\270\007\315\354\341\203P\003\373A\037\031%\201\r!\302>)\324@2\252\266k\215KB\001ZL\370P\352\323\005nt\322\006\266\032%\352y\300\246\235\300\r\330\314$L\004u\332\237\332c\233z\202\372_\007\036\365\334\206\212vP[0\344U7\332\350\233\251=G\373lv\243\270\363\233\023\200\245\250QH\307\214bfDDD$ISm\220\242\2212\353\006\022 \025&\352\254\242\231\n\n\n\n\352Q\332\f>E\224\225Vs\306[\220\027DO^\227;\242\270\310\224kkz\324U!2\373h:\231\206Y\n\213\374TG\216W\337\f\265\220\244\330)\306\311\013\344\026\030oE\335\323\276\307\223\336'\200\254\223\257\036Hr\314\232\235\277\277\376\353c\023\t\035\240l\334\r\267\200\n\003\b/\3767\245\315\"\311-\224\324\177\330=I}\3155"
+	.string	"\f\\\233\022?\226R|\320J.\2464\226\002\312\256\342(\331\017\275\303q\257\363\315\364\0322~\261l\305\362>,"
+	.string	"\016'\007\216\363\244\206\201\330N\304\254\343\030\357ST\261\340\333\374\331yBsc\317\375@\211wv@ \0343\336\317\301\222\266\314\240W\t\325\004A\335$h\364\\STC;\022\361J\356\305<\204\267*\237\001\240\224h\230\037\022l\323\220\036yO\353;~`\317\221"
+	.ascii	"6\250\"\265\036R/\305\327\202\034g\f[<*\025\273>\226\271\233"
+	.ascii	"\333\332H\201\b6\034Ln\361@\250@\013o\036\247\361\357\335\373"
+	.ascii	"\272\215\274\005\31544\243\342,\264\301\350\312%\0330\354\343"
+	.ascii	"\221G\257\374\032\271\256\006"
+	.text
+	.section	.gnu.lto_fastA2F.15.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`s\020}M"
+	.ascii	"\372~\274\033;@\246NcG\246S\\\016\\\310\354\232bg\364Y\325\016"
+	.ascii	"\341+;\377\335\352xT\335?\3339l\032M\007\360f\376\021\r\363\270"
+	.ascii	"\352\341\013B~\016\265\230Hi&B\233\354$\223\f\264\001\224\001"
+	.ascii	"\245\001\205\210\036\374\255k\222\350\246\365\320\020\032\306"
+	.ascii	"N\273\317\316\263\365\354=\333\216Uk\375\277\247=\376\217s\331"
+	.ascii	"Wg0p]\361`\354\245Y\337\261\306c\217\357\353\203cT\210\255\350"
+	.ascii	"\341\265\266\315z\216\351\270\216\371\354\361tv\254_\021H\\q"
+	.ascii	"O\213\227@\024v{QN\210\321\263O\245q]\377p\321c\242\350\341\333"
+	.ascii	"\2449\317>\213@\342\256\220\300}\t\\\327u\314C+\242x\2714_k\r"
+	.ascii	"\307q\332\214\347\303R\353\212\245\215\236u\305#\263\t\212\036"
+	.ascii	"Z\274\242\333\330M\233\265\317\024o\313\0273\342\002G\007\323"
+	.ascii	"\272\256fJ["
+	.string	"\251\036\246\246R=\274\026\"\261k\200S<\333-\213e\241\354\321\246\3046+\301\276\274\272\270\302\266\264\262\260\256\254\252\250\246\244\242\240\222O\310\243\223\261HT\207\351o\2335\264O\320\210\034\020+\301\354\370\013\316\365J\213\200qo\322\006\353\272\266\271]n\314\345\306a|k\356V\22696\326\262\033\033g\251y\336]\2540\276\"\252\025\240\033ce.\214\255\252\300|\271T`<\345\245\313\225z\306I\225\353\272r\271Q[\360\324](*N\022\0319\242de\216\212\237\3608\f0n\313\224\2134`\234\22402qt\367\030\226e.\212\235\b<\307X\231\213bcX\321\200qPL&\356\311%Z\231\203b55P7hIR\016.\265Bt%\322Q\356\355\016S\342\220$wI\271!i\003M\201P\363\3716\345\202\334t\314\022\337|N\321\260\211\032\221[\342KT[\327\325^#rs\266"
+	.ascii	"l\355\225b\255\245am\362D\376\363\20173e)B\270M\211\304\307\020"
+	.ascii	",T#\\\300}R\261\326^1\353\231\201\323s\212\200{\007\355\201{"
+	.ascii	"\317\b\001\302\223\tr\317\2372\305\333\331\261\037\311$J\004"
+	.ascii	"0\261\204\211\030\201\370\bQ,\022\2168\t\251\224\f\301\244\246"
+	.ascii	"i\200\023\337\334q\2510\365Of\246\372\253\230\343\350:\007\237"
+	.ascii	"\266W\310\272\272\211y\317\n2\roW\214$\210\344\"n\323\333\340"
+	.ascii	"\001\336\264<\324\341\327\036\t\271\232l\372\373\341\r\267\304"
+	.ascii	"\230\336J3U\377\376y\340\240\326{\332\3200\213_\254}\250\036"
+	.ascii	"\372\276\324\244s\273Qk>[\212\323P\200\273\245\353\272\256\251"
+	.ascii	"\210\033\317\3123\007\270\210\233\320\233\231 7j\221NJ\257\363"
+	.ascii	"7$\3566Y\bp\0054\206V\305\355\016\332\353\374\003\\\357\240\265"
+	.ascii	"x@\356\355\254u\203-\232\002\355\261X;BD\b\020\351\265\037\322"
+	.ascii	"k=\244\327v\340\260AC\006\f\027\326,TP\2430AB\004\b\017\214g"
+	.ascii	"7`\220^\273@A\232\235\266h\356\263Mp\346<[\004fed\336\263=`;"
+	.ascii	"\266c\006\n,\t\f\020\020@\275VL\275\026\300\2756\214x\255\222"
+	.ascii	"x-\030\361\332\257{\255\327\257\355\372\265\\\304k\267~\255\326"
+	.ascii	"\2756K\275\026K\275\366\352^k\225^[\225^K5\274"
+	.string	"vjx\255\224\365l\243\240\324k\223\352\265O\367Zdz\355qx\255\323\360Zczm\321x\266\304{\255\372k\207\2776\275\327\376\327\336{\255IL\005\313[\210\242n\211DWu;\353?\366\272\357\252\346\240L\335\321\344\206j\355\232J]~\r\312\344\200\211$T\211\221/o\323\324\355\254\375\330\3535\3468\262n\324vg\257[R\223\316\r*'\241\n\362\031\255\260|\005(L\200\353S\260k\311\0335RPe\267\310\250\233\275i\241\b\334\246H\250/\335\307]W1\207\353Z\357\242\303e\025\231\251f]\353W\022\0344\310]\326}\237\227\362*-\315n\275\250/\204p\222\024\336cp\322\223\0179\301\233\306c\343\027\302\273\344\204\333\364)\352eo\366 t&\325\036c\260\360I\302\t\274Y\310X\204|u\254\373\352\227$\306\352\327\257\356\311\207\200\365\022\334}\2763R\207\bJ\215\300\325\314"
+	.string	"\242p\367Y\351\226\340\024\310\004\371\233P\366\252O\370%\364V\227\340T\257\272\337\002M\235\352i\236\267@A\226\372\324\357gu\251_B\270\302\344\323\317t\202O\032%-\362\311G\002\324%<\343\364\231\002\036\373\310\363\315\323\221\354Qo\332\3648\340Po\356\310TxD^-3SU\237m"
+	.string	"W\344\355l\217A$N \316c\221\321\200L\366\346`\235S\210\333\324(\340\003\3364\332\206\232\374\032!\353\261\r\365\351\311\373\251\320\215\f\362Ie"
+	.ascii	"\331\255w\f1\340!\312\200\270\365\254<\276x\0207\241\323\217"
+	.ascii	"?\341["
+	.string	"\340\b[?\325x\247\247\222\336\352n|\352\007W\350v\243U\212d/\376\022\276\221y\216\231s\272\235\275E\373\331\205\240\223h?\357\020\234\244\0063\2304v\260\r\021\234\351`\322\030\256HQ\203E:\243\305\013\033)\033\216\030)r\f\331b\244XachY\250H\221\002-\355\314A\331\026\r\333\025e3\230/l\324`\3131\203\271\202\215\006\217\033f3\2302d0W\230\315x\221B\206\331\212\0326\314\312\304,\223\006[\r\263\033Lf\r\263#\336\352c\261\027\254\303\217l\276<|\301\207+\335\036\304.\370\201\177x\211>\301T\031\255\213r\"\333\324k\304\037<\270\331;\220\271`#nv\0177\237\215N\032\251\033\364\325u\366\021o\216\375N\202\022\002\256#\356<\257\3339i\302\205!\355\n\234 \341\272p\233\206!\370\331\233\217\254\340k\217\f\235)@t\005\222\234.\fQ/U\005\307"
+	.string	"\255t\341\316;\373\205_Jt\222\334\025\341\n;\226!\023?Z\032\266\236f\004\303\304\251\225\3416\315r\"#x\223\270VH\310\325\344d\356\017\301\235\227v\265-\r\230\274T\323\256\001*(\303\235\007\247\020\221\005\b\236\001\t\024\220V\212\205v\006f\274T\031|\353V\364f)\310\033\3005\013\214\0228W\033n%M\254\374\310ho\372\351\"\241\022\347\025\207\333\324\252\300\r\210\001\270\030\200.au\3203\006n<\264\333y\327u\005\202\305\301\3009\254\331p;\255\204\212F\243z\274T\225\337"
+	.string	"\366\257+\303\016\366\224\016\\\241\233\227*\332\277~h\032'\202\224\307wU5\346\035\321B\2521\233\213\\\335\324\001\217\275\351C\256P\225\205\307\210:\251*\334\207\334\335\324\332\013 \241g\254\227\252\235\246P\305\rZ\246\300\330m\307\312\202\0359\201t\250aD%\225BC\"\"\222$\005\205tQ\005\304 \007\035\274:\021\360@\247\234\242\222\024\244\262\254\001sHYdG\243\344MC\017\2563(\tF\334f\252\320\021ac\b4&\236r\345\240\300\003ta\262\224P\177\215-\300#;D\364\261\342qE\337\341\364\002\276\320\b\315\324wu\350ir\242\236\262a\271\252\343\2522\360\3234\335\300q\267WY\tjB\257\006\217|rn\216\2525~\312\237\315J\312\300Ce?\327\350\331B\206\245V(\357\004\323\377l\220\3237\301Ak\016\341\263\205\341?\267\007\251\033X\367Sv\360\225\032\230z"
+	.ascii	"\276\365\266\237Q\f\017\334\312\301\355\322\200\205\213[E\226"
+	.ascii	"o\267\231\022\226\023\351\004\344]\374\305l\223\276\341"
+	.string	"\350\215\360\350\257H\276\020\274\234\245\261L5?\247\313`\310R\355\322\213\231\024B\371\251^\201Q\177=\023z\"\201\211\004,\332\007XW\250:Z\351\b\351\277\347um~\207}-\177\271\205V\344\351\237\f\253QV\373\022sP\211\3723\277\236zT,\tqDc\261B\026\262\256\262\006\334\206&\224\366\210\314\3655\275\221\"\264\375\343$\2245us|W\b\332\221\327\353\027\024Hv\002J\225\306 w\267\221:\342\027\316\021dA&L;\234\200\035k\017E\254\243\341R\\\216\345\373\234\37024\200\345\354\t\365Z\250{\024\366\231\332;\253\323$uR;\264\2522\345\215\2710\212\305I\265G\307\001\343\240\bc\352\032P\202ac\356 \326\201>\241\3040E\277\321\314\3627\372\264m?\006\216\263Db@*=O\003\225: \3244?b\305\036\252l\033\020\374\327\342*\337C\361\365\021y|\n"
+	.string	"\243\245\306o6b\351K\347\031\252\342\271\300\266\020\n2c\370N\2646\372\362\017Y\232\311\214y\267\220h@s\013\203\276\004\262TN\001\b\321\354s\233\2632\2145\243\225$\025\3414k\273\210\207tI\206\364BP\352\213,K\bW|IS\026\313\032\342K\323\222\302\033\254\tD7\300\322\275\256Bq\005)\243\225H\256\202\365\"\356>\322\2748\375\340\360\350\234\222\217\300\271\300\212\303S&\024\2371%\344h\371\211\307\274\344\001t\001^\370Z\016\247"
+	.string	"\346on\334\266\017\300\370\002\032@\344\302gIo\brz\370\322\340{~/\n4?\257IE\270>\r\317c\205%\025"
+	.string	"\"\013J\316uH\\\313\022P\027\311\031'r\244\f\323\227\370\373\311\316"
+	.ascii	"\266,\235g\247a\271\034\312\322\001\212\232\203>V\200?\310\330"
+	.ascii	"\246\242\243\002"
+	.text
+	.section	.gnu.lto_fastA2UL.16.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`n\003\365\030"
+	.string	"\326\354\235L\260\322U:k\205\b\246>\217\242\231&\314JNiNk\021\004\0023\022O\353\342\373k\002Z\320"
+	.string	"\315\257\004t\220\277\354\312\006\301\\\274\355\032\317\275\203s)?\227eC\210\321\252Lw\020\273\224\207\\\327\331\366\023B\b!r'\031\211"
+	.string	"\205"
+	.string	"\205"
+	.ascii	"k\201\233\314\300\342\220\335\276\370r\327\275D\032F\367\256"
+	.ascii	"\006\330$\275\371\0227\301cN\006X}jPJ-~C?\356]c\274\036\300y"
+	.ascii	"3=\354\274\331\035\370\344\262yO\321S-\333\362\3703\030H@!\314"
+	.ascii	"\323\004E7\200@7GW\302\337\361\003\202h0\3303\275\271Z\24223"
+	.ascii	"?O\242\031\2263\246\245\243\037o\203\302\030[\002\331\274\177"
+	.ascii	"|)\202\310\007Phs\213\242\334{\331\002\2055g\324\231\231\207"
+	.ascii	"\231\0350\267JO\034\202\334\320,\220d\204\315\260\234\244;L\236"
+	.ascii	"7\376\301N\3176\261E^H\272\266\211y\205\261\335\303\374\231\017"
+	.ascii	"\323\0227\221\371\345j\261V_\317\252\027\377\324\215g\224\372"
+	.ascii	"\34295-\243\245\345\323Z6"
+	.string	"\333r\331\226\273-[k\3710\330\214\034\013\220\356\235y\002rq\230G\037\276\376\306[f\036?\305\217\234\262:d\314FN\376\372h\324\240\322\213\006\351M\333Cf\202\200\367U$\275 P\027JDK\367\006\252z\221S\325\271\243\215\020$\tU\177\375H\317\350\"\347\331\252~\020\237\006\263\317\376\317\251\267b\266-\n\342\364F\240\220!Tk\233\030\3257\376\354\036\376g>LKj\023\323\035C\247~5\2276\325i\007\331\345,[\201\216\n\226\251\313\376\317F\355\376\310u\347\333v\027\375\216\370+n\272\324\003\377\345\274\371>\217 N\317>\361\217\177\016R'e\224^y\357\275\345\253_\374H\311\323~\365k\370\204bl\273\225\t\272Z\356\334\331$\330\"\230\254\002!%\345\200\254\344\204D@\313\231Fr\303\331t\271\032\205\033\216Vkq\331\305n8\026\026\034-v\263\245\260\304h9]\214\204"
+	.string	"\343Zj\271\330\016\207\313\305R\353}\023\231\313\023\325.W\237\354\364:\206a2\322\356a\346\024\207\226\332\255\276O\b&\304B\233\325W5\332v\350\347\024c\3257&OT\257\332\016\371\202P\240<:\026PV\377\304\260\250^\305Q\035\374\361*O\206\037\264\325\\\252i\007J\250Q,\244\fR\312\031\222\231`Ha\013\307`\002\231\302\272\r\020hY\222\244\320\030s\256n\303\224\334\210*\245hrV>x@\360F;gD\316\2474{\317\b\314Zy\023a\274N^^\340\237\022M4\214\251|\372\211\212=)"
+	.string	"M\311\001\371\344\036a\020\237\246n,'\205\305\200\314\335\310m\346\026\307~\\\344l\344\372`\301\345\373b\314w\251]\200\247,K\232e\032\237\301\035\"\3449\027\261\366\350AI\377\207W\0029Dg\376\352\215\273\004\032d\031"
+	.string	"NB\230\3125wr\364"
+	.ascii	"K\223\307T"
+	.text
+	.section	.gnu.lto_fastA2I.17.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`!\007}*"
+	.string	"\352K\260\020Hp\334Q:\003\025Q"
+	.string	"$\265\226(k\221\340\027\022ZA\025@\242\302<\226\022\036\210\206\364\341\204i\240\006\034(\300k4#\033$F\363\217\242G=\353\223\217\332\251;\3002\255\336^\001u\250\266\377K>!D\356$\003\372"
+	.string	"\355"
+	.string	"\357"
+	.ascii	"J\317\302c,\215#\373\265\\3k\333\026\351*{`\357\020\245_\346"
+	.ascii	"_9\026\341\2333\336k[\"S\276\264m\223\001;`\257r\223}\225s\t"
+	.ascii	"\231\307\322\346\021\344\227r\212^jm\333\376|\037Z\257\246\027"
+	.ascii	"Z\257\266\021\316q\332\302\367\200~|x;]\016\307\336V5"
+	.string	"\355+\344\253<\240N6\\\2204\336+^\240\256\302\374I\257\005\307\371\350q\231Z(Se\345[G\254\353\343\2435\345\214\227\334:\n\271;\021Wj\\kYTG\256\013r(\220\233\313\242\272:\256\b\325\325\331\264\202\030\253\251G\217>\322\233\304\315\331\237?\260u\\\336\333\201,\252\037_S\005\3112U\217\036\177\244Ci\264\342\350\220\304\253\2467\033SK|\2206R\tx\314\302\374\371kDJ\335\224Y\365\376\363)\224\2602\034\310\252\337\333\205\266m\371\342@R\235\203\316|\016\314\\\202ye\021vt@\325\322\241~\363\276\006\317\365P\177\214\350D\352\356\341\235\330\332\005\353\221\314\323,t'\332\326A\372\273\316\026<\0302\274l|\305\312\242\355ecnJ\335V2?A\332\222<\334D\230\323\313G\351e\003\353\345\002\351e\002\353\345\001\351e\243\365\262\200\365r\200\177\235\213\210\206\322\313"
+	.ascii	"\204\202zo\376?\274w\235w\272\\z\031\327\227\331\364\362\355"
+	.ascii	"\315\363\252^V\325\313i_n\365\362\355\313\367\021II\323!\255"
+	.ascii	"m\247\366\344i\321\250a\230\274\353\377\342o9\224Y\3072\256\205"
+	.ascii	"\337E\035\373\222\322\266\255\216\205\347\022\225\266>\332~\343"
+	.ascii	"\245\r\227\332\272TJ\357\301\330\001\004\031\347\022\365f;E\341"
+	.ascii	"\n\r\027\203\253L\342[d0\353\256\236Y\310w\336\353O\326]$_sF"
+	.ascii	"@\351\3421_\r\240\266\306R\255I\b\366\352u\006_\036\\\003\264"
+	.ascii	"\200>1\311v\200\276f\212mC\3503\224\211\276\313A<i\256\325i\017"
+	.ascii	"v\276\3006\256\257\234b\333p\005\333\r\305\262\372\241\3537\213"
+	.ascii	"\372_\277\227\215"
+	.string	"y\375\256\264m\3336\327Jf\022\322\246.\370\032S\307\232\364\2426r\252\256}\246\325\332k\24262NH\327B\314\240~\327}G}\353\240\276\034b\362b\316\353[_3\304-\25417\300\330`[y\036[\217\032\312yfG\006$\332v\0336$V\267\336\332=\262\035I\025r\220!yh\314!k\232\346zmc\024\326\225\364\335\f\356b\355>\341ts\305\366\250\255\344?\317\272\301\362\322C\315\351\375\351\\\033\231a\254jcxS\343\342i\265_\254\302\245}\337]\254\357\333\r-\206\341\207\261p\301*\341\317X\257\276\217f\274\032\336=\374\347\037D,-\327\027\206\001+\226\356\223\212\246`\352\004\343\251_4\251hB\241r\212\023&L<Pj0!\311(x^Jz\0026\005\241\230b<\001\227\230ZD\275\370=\001\235\234\200K\277\247&\023N\277%\250\340/\t\001\003[0A\375^"
+	.string	"\201P?]s\250\347>\274f ^sz\343\365\016@\373\206-\305E\275k"
+	.string	"}\241\304\255K\026%\332\352\351\265\222#@\3711\320_\023%\311#\320\207~\203\032&\3050\235Q\037\265\021\351G}<\316\262\243~\226\373\206\007\373\237\307=a6\327\314\206\315\346E\244\002\244\301@\032\031-]\304\237V\362\311\274"
+	.ascii	"\226\002h/\223\262\342\305G\270$\320\r\335}\325a:t\264\304x\255"
+	.ascii	"d\365\301u@\307\300\032\320\355\305#\236E[0hi\262v\037pm\224"
+	.ascii	"\224b\327<1[\243\363%8\222hth\31466\b\351\2746\376\371\f`>\212"
+	.ascii	"a\254Ps\212#j\035\356\301U@\237p\232y\200\217\250A<\305\020d"
+	.ascii	"FJDD\244\240M:\200\002\231\261\262:\021p=DU\324\260\354\031s"
+	.ascii	"Z\342[\340\206I\210\216$\313\006\335\t\240NY\3470\352\363X\033"
+	.ascii	"\361\013qX\323\346D\216\316\346nE\302\236\363\306&\2129\364\321"
+	.ascii	"\324\273yc\304Y0w\312\226v\242\301/\307o\373\264\f\342\267*\253"
+	.ascii	"1}\2266c\320T2\252?\352\247\265u\373\226I(\232\266\177\323\274"
+	.ascii	"D\277\365\300\322\363@:\355.\004\034\253\276\023\003$\316\262"
+	.ascii	"[\250\f\347+\376g\317@^\347\026\250\306\020O3\335z\272.\365\230"
+	.ascii	"\365\320,\253#\300\223\225\313\213ROl\307\230q\247\206O\225n"
+	.ascii	"\363\216\235\025R\233\325Y\216K\343Wf7f\205\350\213%*\016x\210"
+	.ascii	"*\f\300\211\250\360\\KR\217o`\306\302\212\313\b\321\261G*\230"
+	.ascii	"+h\3320\332f9\216H\237\350\017I\331\"\304\376\242\b\351'\016"
+	.ascii	"#\270\216BD\263g<Y\271\353E\265Iid\2418\f)\263\021\277\334^0"
+	.ascii	"#u\354)@KLI\377\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`Y\001\375\b"
+	.string	"\202\21535`\213\322\001\260\177\252\267\273\005\216\270z\276=@\264\201\033\f*0\026\0338A\\6H@!a\213\202\301\3132?\265\366Wm%\237\220x\323\242\364~Id\nV\360\340\352\307TY\375<\254&t\330\352\346m]&Fj\364\001W=^:Dc!\002\256v\272\364Eic\004W3]\332\203D\301"
+	.string	"W5S\266zqX\253\034Q\272#\003d\304\226^\242t\205\003W\262\245\022\245pYi6d\206P'\222\255\236k\005\307\020\\\323\371&#(\332\033\347\227\334\334\242y\22696\360K\340\025\003\021\210\024\346\001\372}\337w9E;\200\345\233\335\342\342\304A\bu\302>\231D\216\213\022\366m\013PJb\214\361:\254lW\b\001  \220\002\2313\262\003\f\235ph\032\311\244\320\320\326\\\212\035\017\342\003\373\345\2153\250\352\0018"
+	.ascii	"\207C \tZJi\302\020\366\002\202#\031(\350\021\235\310^ \3641"
+	.ascii	"\344\337PB\214\b\302\373\2064\235\375\005\335\240\276\203'C\007"
+	.ascii	"\331\t"
+	.text
+	.section	.gnu.lto_.refs.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6566a440e4d1b770,"e",@progbits
+	.string	"(\265/\375`$\024U^"
+	.ascii	"\352\235\204\"T@NJJ\007\346\272\253\377\256R\2211\273\021%T@"
+	.ascii	"TT\265\247\031\236\237\371{{\257\256M\210ID]\3003\350~\355\327"
+	.ascii	"*\2517S\310\210\330\304\333qP\276'T_)<R\0069\f\362g\377lvkO4"
+	.ascii	"\214\315)Q\365\333\230\324DR7\2212\005\315\001\023\002 \002\312"
+	.ascii	"{\241t\326\344\322\322\275N\002,\335(\241Y\322\275\035&\246\314"
+	.ascii	"\2706\247\216?f`\315\344\225\241\024r\362>\221E\265)\364\272"
+	.ascii	"4\314\250I\243\215\271\266\347+?\243\261\025e*\345E\304\331V"
+	.ascii	"\207A\244\315;i\357\347\354L\265\252H\251i\313gh\fwwwwg\315U"
+	.ascii	"\230\312\371\354\34726\273\006$\345m\362\b\336Sk\035\246V\004"
+	.ascii	"\203H\255\224\346(<\345,\345J%K9\200\r\217\310\201\202r\005+"
+	.ascii	"%\203\242\346\210\341\365\324\366\f\345g1\036\343\245\t\367\""
+	.ascii	"\335{\003\350\020\205\365\203\252\355\333\030D\212\303;)?\371"
+	.ascii	"9\207\355\244E'\345\r\273yJ\223\022\322\226\003\357\244?\203"
+	.ascii	"}\3613\311C\255\355\317_\315\234\255\033@\206(s4\230\331!\301"
+	.ascii	"\321\366\314\305\314\237\233p\027/\321\225\306\361\206\335\253"
+	.ascii	"\374pA\222\035c\332\262\222\275\316Kv\362\336\211\243\302\345"
+	.ascii	"\345\272\367\362\322\304\361\336!/s\330\334;\314a\036\301<\302"
+	.ascii	"2\231*2\226\332k\240^\311 R\225wR\234\236\363\326w\220\367\304"
+	.ascii	"[U\241\327C\035|\340\3643\t?\353\3709G\361\347&\245\237M\370"
+	.ascii	"Y\005\031\330\200\365g\031\005\374O\372?\366\363P\304\337\034"
+	.ascii	"\210\260\341o\t~\206\341?\230\237[x2S\303\337>\267\177\207\370"
+	.ascii	"\371\f\243?\360\376F\377\3071\013r|\264\302\355\347\242\237}"
+	.ascii	"?\257\370\031\204\2373\3709\305\317\275\237\033\370y\201\237"
+	.ascii	"\017\3709\200\237=\374\254\376\314\377\353\376\313\375\177\376"
+	.ascii	"\267\362\177\305\377\016\376\233\375\217\362\337\353\177\t\377"
+	.ascii	"E\370\317\300\177(\377C\370\337\374\377\365\177\371\377\200\377"
+	.ascii	"i\377;\334\335\335\335\375\315\365\363\013\277\316Ze\324\320"
+	.ascii	"\246f\220\251iV\023\3371\232\330\253\252s\211n;X\214LJN\306{"
+	.ascii	"\275q\322!\233\332vR#\205\251)\332\2323\2335-T\243\241\006\022"
+	.ascii	".4}\337B\034,*6\212\264\345;\236\016dWfum\271\315\fvL\225ge\346"
+	.ascii	"\214\306\f\327\251\367^\364\336\036lI\0343l\\5\322\234\353\262"
+	.ascii	"P\305-\265e\272\253qh\036\261;\323\245\362\306\304\234\311\210"
+	.ascii	"a9v\272(\031.\245+u\327\311\211\207\227D\fG\221\270\263\334\313"
+	.ascii	"\330\2612:d[\206{Zj\305H\027\245\266\\\206\327\203\013\030\261"
+	.ascii	"-\277\335\311\023:\241\2641\023\247.\f\214l\214\226z\263\366"
+	.ascii	"0\026\316rN\3430\334\345i\374d\021\367&/\321\215\013\211!\232"
+	.ascii	"\222\221\272\353T\344\371\031\314\371\371\367N0\023\347\336\002"
+	.ascii	"\3243\2651c[\376\302\303\301\352I\021\254\266\354\205\231\033"
+	.ascii	"\212K![\333\243\341\311Q\002\243#r\321pCD\354+\006\365\274\305"
+	.ascii	"\303Y2\251\245-\267\251I0\030P\257\2100Ij{n\373\231\215\265\244"
+	.ascii	"+\0222\253m\t\006\221\246j?\3475\364i4\303\321\366\306H\355?"
+	.ascii	"\275\303\342\275\267\306\215\362\226\021qR\276a\346\371;0\312"
+	.ascii	"$\356\375\217zx\336\313Tu\306\303\216,,\262\266w\202+\324B\032"
+	.ascii	"\032?\\\345-\256M\244p\375\342b\374\240\274R\001\334\346\217"
+	.ascii	"\273*\221F{\274}\225\227/\022\322\250\302\252<\026W\345Q\250"
+	.ascii	"s\221\216\302{\225F\2355l(\344\265\2114\256\315\243\361\303E"
+	.ascii	"\272\302\333\034J\251HG\343\252v4\352\254\315\241qEB\032?,UM"
+	.ascii	"m\255b\226O\274eE\272LKQ\303\242N\333\252<\336\347\275\034\226"
+	.ascii	"t\213$\356\215:\026\237C\035\\Flc\"\222\r\217\254\274\367\016"
+	.ascii	"\260D\234:^\244\2665\353xo\026\261\305]2!T\266\335 \334&\374"
+	.ascii	"\021ui$\335K\300\322\275B\276m\367^\341\275\227W\214\n`m\033"
+	.ascii	"\314\227\366\342\366\267/\235!\341\321\266\271\034\316\253*\252"
+	.ascii	"\267\240lSn\304\266\315\326Z\230\353i\335ve\216\2073\031biZ\324"
+	.ascii	"\307\300OK[\215\312\333\312\225\316\202\316\025\333\306\230\023"
+	.ascii	"\254,o,;VQoR\324F{7\351r&\271\265m\347{\013\bS\033\227*rCrX\211"
+	.ascii	"\251\357\245z\2617\024\2626C\335\356%\226P\022\237w]yr\326d("
+	.ascii	"\2436\345m\366.\353\235\370\333\0062\2422FSl\rM\223\266-\345"
+	.ascii	"o\357\322\005\245l\333Q\016\327\345\b\235YW\330\220\037F\324"
+	.ascii	"\036k+\225\333z\3767\223w\027\223~\202\216\301\271\302\345m\342"
+	.ascii	"}\0219C\253\273\253\023O\0078\"q[\312\367\2237X\030\242\017\255"
+	.ascii	"\266\375u\016b\006lev\323\b\031\2626j/\035\340\261F\212\215W"
+	.ascii	"\025\027\"H\3326\337\231\266\023f\376\336\256\271\346z7\3715"
+	.ascii	"h8\353A\205$n\215}\331\221l\243\236\323\250]\314z'\311j\255\001"
+	.ascii	"\202\274\305=\235U%\225\274\265\234\234&\353\214\025\0228\265"
+	.ascii	"\313\256\336\311\253\306\352%yca\304\3428T]\341\0203\362\306"
+	.ascii	"J\353\020%\212\234Z\221/*J\354\252\267UW\365\220\001\300\004"
+	.ascii	"Q\272\242\205\246K\tR\310{\310\024\365\013\334\023\217\257\034"
+	.ascii	"%v3\276\004aSQ/R"
+	.string	"\357)\251\006\342\345*\t\264\344\311\026\2527\020T-,\351\256m\377\370\224\034\251\270\032PH,\252U{z\357xj\037\312\333\304^\234\224\256\324q\310JRE\354\361\366\3014\321\204\211\220\266\315\343\316\236\252\021\225l\333Q\314T\247$I\316\340\2648\314\266\326\240\252\2507I\212\357\032\305\326\301\3672\303\342P4\037YXr\274u\360\362\353\316\311l\3338\226pQ%\265\355\033\f\306k\232)B\245m\333\270\363r\\fg\257\302\3731\303\nf,SS(\245nj\032J\315\304\267x\257S\004SC\342\256S\024\017\216\220I\245e\351\315\344lNyZ-;A\240\336\003\301\237\217\027\004J\021\374\371\216xD@`\005@7A\240!\027|F\351P\321\321\013\373\033\"\002\372\371\202D\276\243\023\200\200tZx!\344b\310E\372\026=)\374|EA#\237!\024\216\210\204~>\237\"\243#\037"
+	.string	"\210\210\216~?\340\217\307\002\260\250E\020\370\343\261\b\032\"\262\301 \241\242\240Q\252\301\006#\250\030\364(\340\005\001\203,l\0200\350\263\276^\020\212B/\b\r\352\371\216lP\317Gtts\004\016|1T\344\023\004\002\213|8\f\271\340s\341\013\276"
+	.string	"\252\017\032\005\261\360 \r\352\371\200\354\205|EC\277\241\024\324\233@\341"
+	.string	"\212\0240xO\241\242\204\212\022\351S\250\370\371Q\201\342G=\212\037\264(\250\205\220=\213\023\202\202\0360\361\003A\017\001\207"
+	.ascii	"\002\013D\214\320A\006\252P\317\017\3503*\032Z\341\007\024\032"
+	.ascii	"z\321B\320\347\007t\341\002(\344\363\363\005\271\360\021*2\362"
+	.ascii	"\351!\361d\266\302\207\214(\247,\034\326\252d\2409\216\352\310"
+	.ascii	"\231\313!\265\243-z\003\305\201*I\216\205\371[\231#d\316\272"
+	.ascii	"\332\2425P\0339UI1*\207{\\N]V\235\030c\030\036\323\226\035\020"
+	.ascii	"\264\351hq\212\330U\322\026]B\231\316\266\374\272\261\3546\256"
+	.ascii	"\253*\224\306\251\222d\271*n"
+	.ascii	"xB\311H3\343\311"
+	.string	"\215\2323/B\224\346\322\262&'`2\264\217\341\225\223\006\272^I\237Pa&\333\242Hh\f\346\272\023M\342 V\204A\316\2500x\350E\205\314\025\002\035vh\263\244\215\035\031\365\034\"\345;\016\221\276g\3506G^]U\f\"U\200w\322\266\373y\263\331\260*\255C\332&\320k\370\331\346\316\216KM\013o\314\030ibv\235\034\226\\\024T\333\246\353F\323i\336t}\006\007\251\351\254\007\346\0217N\"Cf\252\262\232\2367*=\207\316Mpi\274\025\211\002\265\344X\346=\367\226\353\235\350-LN$]\333\216{7\235\326\316\342\340\272y\204\252\251\244\355\035P\2279\214F2c\230\253gM\254\303\240n\006\244\235\241iy\230\001\207\244\352\362\016\363~\376\200\200\005\201\242\250\261(e\244$22\"\"\"I\222\244\003Q\005\204\030\307\244t\335\021`\255\202HfDD\222\244\254f3\331\005"
+	.string	"\241\003\b\0061\245\216\263\247\241u\232\263\3412iUX\245\266;\212\326\3100|\345l\301\244\r\301\345G\033\370.\255\005\3102\370\016\271\245\\\345+sK\r\200\356\t\317hF+[\006\026~\253}L\354\217\262\037\245\3529\367\201O\346\3603\314u\206\001\323\001\276\030\360\321\372\243\b\3040\"\231~e\325B\353\263l\346\230I\362\224W\325 \213\024<\351_.\332\306![\310\256.j\351"
+	.ascii	"\323\220\002#\242)\265V\017@=\002\276\002jD\366\330@V-H\371\340"
+	.ascii	"\304\374\210\212\371eX\241\272\3101t\002\310\264K\277\033\ri"
+	.ascii	"\220q$\373\023\202\3465QH\337h\312\033\275\007\200\200p$\216"
+	.ascii	"w\307\220~g\355\336\t\234\216BfX0J\264\245\241\365\236\332\270"
+	.ascii	"\353\353\265\314\270\245\\\277\214\340\206(\323\234?SX\315\340"
+	.ascii	"\266\207S\217\220\n\347[\024k~N\255\214\t\222\267e\246G\202\300"
+	.ascii	"\231\362\264=&X\261\017A85\2140zx\016 !m\312!su>b\245\177d\261"
+	.ascii	"6\331\343+L\254\3262\372\2450B\343\006\251\307\013T\320\240$"
+	.ascii	"x:\017k\301\300s\372\226A}\307\023\023}\204\303\b\024\312\265"
+	.ascii	"\307\237\266\363\334\204h\276\276\337\203\230\212p\307y\370f"
+	.ascii	"\240#;y\221T\031Q\0013c\"\232\344\327W\242\034\007\036\242\312"
+	.ascii	"\n\003\200\254\002\274\022\341\327w\b\355\237\371"
+	.string	"\212$\026J\306\266\334\001\034cZ\n\217\023)3\f!+\372\371$=N\257\227\332\013[^\237B\271\201M\335\364>\330\033\020\24501\331\272\021\334\254 \342\237:\037Q)\226\330.F\232RvFZ*\227\227\377\370\020c\027\017\260x!\212\237\377(\363T\371\236\302\217Q\310\212I\001\215\374\003XWv\217\005\224\231\273\210\303{NwG\322\323\021$}\030\335A\212\257\314\2064\006\270\370)\267\257\204\374\025\r\201\273\204\225\024X\216%\245\004\217\277c\343\037\\\301{4\225\341 \273\f#\361<c\322\231<W\001\357!\217\022xu\251\360-\364>\3603\331\375'!TJ\237\"ZF9\266gJ\371\320lx2\245\367LH3;\bya\037\330x3\351\"\301N\324\240\216GI\354\002\025c\365\226\033\004\331\255\016\034\244E\314\007r\354\221\264d\360\"o\223\370\001\317\032\253j\275\357W\026\276\267"
+	.ascii	"x\241\337\032_\023\373\352\034\302\002\271\321\336\261\316\205"
+	.ascii	"A\304O\317\037B\320\245\376\306wI\275\352y\332\2751\373\245\365"
+	.ascii	"\314\255\370\323\345/\337\201\343\215;\202\365\342\262\257 \347"
+	.ascii	"\240I\375\r\326\032\315\210#\354\207b\310l%\336O6\364\t\312\227"
+	.ascii	"\374]|M\325S\314\263\375\216Aq\376f+\"\310G\322\261\211M\312"
+	.ascii	"\277h\377\266I\036\031\227\3565be\007\235\335=\227k\336a[f\315"
+	.ascii	"l\367\253\002"
+	.text
+	.section	.gnu.lto_.symtab.6566a440e4d1b770,"e",@progbits
+	.string	"uli2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361"
+	.string	""
+	.string	""
+	.string	"li2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"ui2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"i2a"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"a2d"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\001"
+	.string	""
+	.string	"a2i"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"itoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\001"
+	.string	""
+	.string	"ftoa"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"fastA2F"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\001"
+	.string	""
+	.string	"fastA2UL"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\001"
+	.string	""
+	.string	"fastA2I"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6566a440e4d1b770,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,4709 @@
+	.file	"uvarint.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/uvarint.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	uvarint.c.7d884951
+	.weak	uvarint.c.7d884951
+uvarint.c.7d884951:
+	.long	0x138
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF763
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF747
+	.uleb128 0x2
+	.long	.LASF753
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF748
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF749
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF750
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF751
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF752
+	.uleb128 0x2
+	.long	.LASF754
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x43
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF755
+	.uleb128 0x2
+	.long	.LASF756
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF757
+	.uleb128 0x2
+	.long	.LASF758
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0xb
+	.long	0x85
+	.uleb128 0x2
+	.long	.LASF759
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x6
+	.long	.LASF761
+	.byte	0x30
+	.long	0x3c
+	.long	0xf2
+	.uleb128 0x3
+	.string	"val"
+	.byte	0x30
+	.byte	0x1d
+	.long	0xf2
+	.uleb128 0x3
+	.string	"ptr"
+	.byte	0x30
+	.byte	0x31
+	.long	0xf7
+	.uleb128 0x7
+	.long	.LASF760
+	.byte	0x30
+	.byte	0x3d
+	.long	0x29
+	.uleb128 0x4
+	.string	"s"
+	.byte	0x32
+	.byte	0xe
+	.long	0x51
+	.uleb128 0x8
+	.uleb128 0x4
+	.string	"ii"
+	.byte	0x34
+	.byte	0x11
+	.long	0x29
+	.uleb128 0x8
+	.uleb128 0x4
+	.string	"b"
+	.byte	0x36
+	.byte	0x11
+	.long	0x85
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x96
+	.uleb128 0x5
+	.long	0x91
+	.uleb128 0x6
+	.long	.LASF762
+	.byte	0x1d
+	.long	0x3c
+	.long	0x136
+	.uleb128 0x3
+	.string	"val"
+	.byte	0x1d
+	.byte	0x1c
+	.long	0x96
+	.uleb128 0x3
+	.string	"ptr"
+	.byte	0x1d
+	.byte	0x2a
+	.long	0x136
+	.uleb128 0x7
+	.long	.LASF760
+	.byte	0x1d
+	.byte	0x36
+	.long	0x29
+	.uleb128 0x4
+	.string	"ii"
+	.byte	0x1f
+	.byte	0xe
+	.long	0x51
+	.byte	0
+	.uleb128 0x5
+	.long	0x85
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "./src/main/common/uvarint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF577
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF595
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF618
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF678
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF682
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF683
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF746
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF515
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF574
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF681
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF745
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF764
+	.long	.LASF765
+	.long	.LASF766
+	.long	.LASF767
+	.long	.LASF768
+	.long	.LASF769
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x16
+	.long	.LASF0
+	.byte	0
+	.long	.LASF770
+	.byte	0x6
+	.long	.LASF771
+	.byte	0x2
+	.long	.LASF772
+	.byte	0x2
+	.long	.LASF773
+	.byte	0x1
+	.long	.LASF774
+	.byte	0x5
+	.long	.LASF775
+	.byte	0x1
+	.long	.LASF776
+	.byte	0x6
+	.long	.LASF776
+	.byte	0x5
+	.long	.LASF777
+	.byte	0x2
+	.long	.LASF778
+	.byte	0x5
+	.long	.LASF779
+	.byte	0x5
+	.long	.LASF780
+	.byte	0x2
+	.long	.LASF781
+	.byte	0x2
+	.long	.LASF782
+	.byte	0x4
+	.long	.LASF783
+	.byte	0x2
+	.long	.LASF784
+	.byte	0x3
+	.long	.LASF785
+	.byte	0x3
+	.long	.LASF786
+	.byte	0x2
+	.long	.LASF787
+	.byte	0x2
+	.long	.LASF788
+	.byte	0x2
+	.long	.LASF789
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF691:
+	.string	"INT32_MAX (2147483647)"
+.LASF633:
+	.string	"__STD_TYPE typedef"
+.LASF502:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF695:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF753:
+	.string	"size_t"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF602:
+	.string	"__stub_sigreturn "
+.LASF466:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF564:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF578:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF539:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF737:
+	.string	"INT16_C(c) c"
+.LASF510:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF553:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF678:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF716:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF526:
+	.string	"__P(args) args"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF652:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF408:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF646:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF443:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF720:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF401:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF741:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF685:
+	.string	"INT8_MIN (-128)"
+.LASF672:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF630:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF514:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF541:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF412:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF457:
+	.string	"__USE_POSIX2"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF694:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF715:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF586:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF711:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF456:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF444:
+	.string	"NULL"
+.LASF676:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF732:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF598:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF655:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF480:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF460:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF465:
+	.string	"__USE_XOPEN2K8"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF563:
+	.string	"__always_inline"
+.LASF410:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF476:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF706:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF512:
+	.string	"__GLIBC__ 2"
+.LASF763:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF747:
+	.string	"long int"
+.LASF504:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF481:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF498:
+	.string	"__USE_XOPEN2K8 1"
+.LASF664:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF400:
+	.string	"_PTRDIFF_T_ "
+.LASF407:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF675:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF660:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF722:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF654:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF560:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF419:
+	.string	"_SIZE_T_DECLARED "
+.LASF528:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF584:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF549:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF729:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF449:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF542:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF605:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF519:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF752:
+	.string	"signed char"
+.LASF758:
+	.string	"uint8_t"
+.LASF620:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF530:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF635:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF577:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF520:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF651:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF761:
+	.string	"uvarintDecode"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF653:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF421:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF486:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF527:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF707:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF420:
+	.string	"__DEFINED_size_t "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF686:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF571:
+	.string	"__restrict_arr __restrict"
+.LASF596:
+	.string	"__stub___compat_bdflush "
+.LASF416:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF662:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF473:
+	.string	"__USE_GNU"
+.LASF508:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF702:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF550:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF700:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF601:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF623:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF645:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF568:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF488:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF746:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF463:
+	.string	"__USE_XOPEN2K"
+.LASF536:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF677:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF464:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF566:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF495:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF713:
+	.string	"INT_FAST8_MAX (127)"
+.LASF701:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF742:
+	.string	"UINT32_C(c) c ## U"
+.LASF721:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF458:
+	.string	"__USE_POSIX199309"
+.LASF692:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF731:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF513:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF462:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF479:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF639:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF624:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF669:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF570:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF709:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF671:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF661:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF754:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF433:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF548:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF719:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF712:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF445:
+	.string	"NULL ((void *)0)"
+.LASF558:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF446:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF496:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF499:
+	.string	"_ATFILE_SOURCE"
+.LASF629:
+	.string	"__SLONG32_TYPE int"
+.LASF734:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF650:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF450:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF452:
+	.string	"__USE_ISOC11"
+.LASF503:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF555:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF683:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF606:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF725:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF618:
+	.string	"_BITS_TYPES_H 1"
+.LASF693:
+	.string	"UINT8_MAX (255)"
+.LASF730:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF521:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF489:
+	.string	"_POSIX_SOURCE"
+.LASF756:
+	.string	"__uint32_t"
+.LASF487:
+	.string	"__USE_ISOC95 1"
+.LASF587:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF600:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF411:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF540:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF522:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF451:
+	.string	"_FEATURES_H 1"
+.LASF484:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF447:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF681:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF552:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF634:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF402:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF518:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF397:
+	.string	"_T_PTRDIFF_ "
+.LASF471:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF670:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF429:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF580:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF718:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF425:
+	.string	"__need_size_t"
+.LASF414:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF426:
+	.string	"__wchar_t__ "
+.LASF589:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF594:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF441:
+	.string	"__DEFINED_wchar_t "
+.LASF448:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF724:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF575:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF431:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF525:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF556:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF396:
+	.string	"_PTRDIFF_T "
+.LASF574:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF516:
+	.string	"__PMT"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF656:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF500:
+	.string	"_ATFILE_SOURCE 1"
+.LASF625:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF474:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF591:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF395:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF689:
+	.string	"INT8_MAX (127)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF751:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF517:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF470:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF467:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF440:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF497:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF663:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF659:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF622:
+	.string	"__U32_TYPE unsigned int"
+.LASF398:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF547:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF551:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF573:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF599:
+	.string	"__stub_gtty "
+.LASF427:
+	.string	"__WCHAR_T__ "
+.LASF704:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF697:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF439:
+	.string	"_GCC_WCHAR_T "
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF562:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF736:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF404:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF628:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF674:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF511:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF638:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF647:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF523:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF579:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF529:
+	.string	"__STRING(x) #x"
+.LASF749:
+	.string	"unsigned char"
+.LASF576:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF428:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF403:
+	.string	"_GCC_PTRDIFF_T "
+.LASF583:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF757:
+	.string	"char"
+.LASF524:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF585:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF409:
+	.string	"_SIZE_T "
+.LASF436:
+	.string	"_WCHAR_T_H "
+.LASF699:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF544:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF696:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF394:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF413:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF454:
+	.string	"__USE_ISOC95"
+.LASF727:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF453:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF461:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF531:
+	.string	"__BEGIN_DECLS "
+.LASF708:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF559:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF684:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF644:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF760:
+	.string	"size"
+.LASF666:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF455:
+	.string	"__USE_ISOCXX11"
+.LASF417:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF590:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF399:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF748:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF492:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF477:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF459:
+	.string	"__USE_POSIX199506"
+.LASF738:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF743:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF501:
+	.string	"__WORDSIZE 64"
+.LASF424:
+	.string	"__size_t "
+.LASF435:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF603:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF537:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF631:
+	.string	"__S64_TYPE long int"
+.LASF415:
+	.string	"_BSD_SIZE_T_ "
+.LASF534:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF432:
+	.string	"_WCHAR_T_ "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF430:
+	.string	"_T_WCHAR "
+.LASF621:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF438:
+	.string	"__INT_WCHAR_T_H "
+.LASF733:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF679:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF745:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF762:
+	.string	"uvarintEncode"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF597:
+	.string	"__stub_chflags "
+.LASF423:
+	.string	"_SIZET_ "
+.LASF665:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF658:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF636:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF567:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF472:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF705:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF557:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF717:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF532:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF505:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF755:
+	.string	"short int"
+.LASF393:
+	.string	"_STDDEF_H "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF482:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF515:
+	.string	"_SYS_CDEFS_H 1"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF545:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF582:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF626:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF406:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF593:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF543:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF643:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF546:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF627:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF554:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF640:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF493:
+	.string	"__USE_POSIX 1"
+.LASF726:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF723:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF632:
+	.string	"__U64_TYPE unsigned long int"
+.LASF592:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF619:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF735:
+	.string	"WINT_MAX (4294967295u)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF561:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF506:
+	.string	"__USE_ATFILE 1"
+.LASF565:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF740:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF437:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF581:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF657:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF569:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF648:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF688:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF483:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF422:
+	.string	"_GCC_SIZE_T "
+.LASF750:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF442:
+	.string	"_BSD_WCHAR_T_"
+.LASF703:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF759:
+	.string	"uint32_t"
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF637:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF698:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF710:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF533:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF490:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF494:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF649:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF588:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF690:
+	.string	"INT16_MAX (32767)"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF641:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF642:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF418:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF376:
+	.string	"unix 1"
+.LASF682:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF714:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF507:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF668:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF680:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF405:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF538:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF595:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF687:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF468:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF739:
+	.string	"INT64_C(c) c ## L"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF434:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF604:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF673:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF728:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF491:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF667:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF744:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF572:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF783:
+	.string	"long-double.h"
+.LASF785:
+	.string	"stubs-64.h"
+.LASF768:
+	.string	"/usr/include"
+.LASF789:
+	.string	"stdint-intn.h"
+.LASF777:
+	.string	"libc-header-start.h"
+.LASF766:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF788:
+	.string	"wchar.h"
+.LASF781:
+	.string	"timesize.h"
+.LASF784:
+	.string	"stubs.h"
+.LASF772:
+	.string	"stdint-uintn.h"
+.LASF771:
+	.string	"types.h"
+.LASF0:
+	.string	"./src/main/common/uvarint.c"
+.LASF769:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF778:
+	.string	"features.h"
+.LASF787:
+	.string	"time64.h"
+.LASF765:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF770:
+	.string	"stddef.h"
+.LASF786:
+	.string	"typesizes.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF779:
+	.string	"features-time64.h"
+.LASF767:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF773:
+	.string	"uvarint.c"
+.LASF782:
+	.string	"cdefs.h"
+.LASF775:
+	.string	"uvarint.h"
+.LASF780:
+	.string	"wordsize.h"
+.LASF764:
+	.string	"src/main/common"
+.LASF774:
+	.string	"stdc-predef.h"
+.LASF776:
+	.string	"stdint.h"
+	.text
+	.section	.gnu.lto_.profile.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 <=\001"
+	.string	"\3100"
+	.string	"\002"
+	.string	"\366\272\360\241\005\004\002"
+	.string	"\001\215\337\352\302\013\f\002\001\002\001\002"
+	.string	"\005"
+	.string	"9\203\225"
+	.string	"\270\220r\003m"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.ipa_sra.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 ,\235"
+	.string	""
+	.string	"H "
+	.string	"\002"
+	.string	"\003"
+	.string	"\003\001"
+	.string	"\003"
+	.string	"2%\006\221\300"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 e\335\002"
+	.string	"2\205\023!\240'\351\177\216N\304\323?\026|\270\\x\300\361\373b\3777\034"
+	.string	"\214`\214\031\215\270\261F\344N\001\277\323\314\314\215\003\224\t\006\004\344\021\035\222\241\300\364G\275\336\207H\261`\210\345\373>\315\314\300\361\330\244\332R\372\207M\250\266\222\357M\003"
+	.ascii	"v*\336C\005\267\001,"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 ,\035\001"
+	.string	"\330 "
+	.string	"\002"
+	.string	"\003\001\001\001?\177\002\004\177\002"
+	.string	"\177\002\003\001\001\177\002\002\177\002\003"
+	.string	"\002"
+	.ascii	"e\346\265\001,"
+	.text
+	.section	.gnu.lto_.pureconst.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\232\004\001\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 ]\255\001"
+	.string	"\340Q"
+	.string	"\002"
+	.string	"\003"
+	.string	"\370\007\374\007"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\001\003PT\002\002\004"
+	.string	"\001  "
+	.string	"\n"
+	.ascii	":\t\314\334\340e\320\250\b\273@7\351\346\274\254\033\006\202"
+	.ascii	"\334@\033"
+	.text
+	.section	.gnu.lto_.lto.cc052d295f560c26,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_uvarintEncode.0.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375`^\003\325\030"
+	.string	"\026\256\237G\300XM:\tx\312#\320\001\305eO2E\217QH\253*(r\243\035;\b/\347\204\220\362\022(\211\326\353}\304\363\235\204\244`\020\327\025\027\354y~\302u\221\217\275\355w0reH\035u)6B\366\336R&\031\216"
+	.string	"\204"
+	.string	"\211"
+	.string	"\266\027y\235\251\304\003\324z$\205\202\315\343\031x~\315\304\242j\265\241\324\244V\033\202=\340}~\310\225^\273O.\244\220IK\262&2\265V0\347+\372)\257\242\237}c'\277\356ut\312\346\327\376\304=\tT\302\330ha\364NNH\332\302\305F\224I\016/\214\250\215\030\373x\246\211C<{\024]J\bKAr\330\210(d3\215P\356\203\205\021\367\307\033"
+	.string	"2\316\304\242s\267Sk]\236\211-\276\250\357\256\213\335\325\260\333?\001\353S\324Y\2740)\351]\211\327\241\277=\002\r\030?\355\307o\310a\251\374\264k;\301\215\264{\006X\246$m\037\355\342\334t\274\2533\375\252\037\371\005\274\366\003\350xkR\037\345\245\231\274(\346\365^\373v\222\227N\336\311\274\362\267oO^\226\274\037\360mQ\215\251uE\316L\2752\235\360\370\355\337}\355\307\375X\007\270{\323\221\025I\005%\"`j\265\035\370\334\fL\003\354##\234,x\237\\\004r\264\221\226v\301I\234\356F\034\037\311SM\373x\0139\234\344M\257d"
+	.ascii	"\3755mwM\320\257)T\371xT\r\361c~\332T\357\300d\255\265N\234\376"
+	.ascii	"\3559\327\241\251\306\351S\211\311\230q\323\257=\247\373>\241"
+	.ascii	"_\337\364\277\304pC1f\357\227\b\20568v\354K0\231\211\201\325"
+	.ascii	"\207\224{\266l\222\021\275U-\373Zb@\2068\267_sK\030Ib\034E\221"
+	.ascii	"\215\264\002\372\3552b\005\005\227\331T\277\271I\206\203q.\255"
+	.ascii	"\026\373\220h\205\220\256 \020\275\t\026<P\340\300\201\207\006"
+	.ascii	",\325\007\036\241\336\036V\020P\313\305#$\002\004\n\177~\302"
+	.ascii	"\036\020\250\305\363\003\366\270B\200\254\002\033\202\360q\201"
+	.ascii	"Aa\350\002?[}\037\355\247\242\326\254w^\252t\253\376x\f*j\224"
+	.ascii	"\365\232\232\336\035X\017\351\360hz\325\227\341`L\336M\323?\023"
+	.ascii	"\223\261\032\202\002\nS\237\211\351\032\325\377B[\325^\277\211"
+	.ascii	"\203\020\002N9\242n\246\272\233\266r~\3355\215v\207n\332\327"
+	.ascii	"\262\372Q\200h)HF\250!,\307\220\221\006\031\031\221\031\031\251"
+	.ascii	"1c\200\002\021\272*\017\020pZ\332\006\026\351\301\"\345\233`"
+	.ascii	"\304\f\020\324\200nd\016I>\243\020}$\235\204H\323@D3P\336\247"
+	.ascii	"\302\356\227\236\275F\200\256N\322+\013?6 \251\350\245\347s?"
+	.ascii	"\2612\323.\001\220\241\365\217.\211\222\244\243\177\243v\310"
+	.ascii	"\220+K3\370{\224H\r\2768 d\240\210\005\220\252\325\236\034\233"
+	.ascii	"x-\202\211\2159l\246>\236Y\313\230\237\177\271Z\006\237\344\316"
+	.ascii	"\273iaL\223\274\257\261\314z\347\230?"
+	.text
+	.section	.gnu.lto_uvarintDecode.1.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375`9\005\335\""
+	.string	"\232@\360\rF\200\234\316p+z\305\252\006\351]H\022p\360f\320\360\004\3556Z\311{\250\331${U\221\212\217\3769\r\206$\3041x\222\247\330\216f\332\315wS\352\243\376y\371~\004\355\352\333Q\313s\023\262\367\336[\312$\003\321"
+	.string	"\275"
+	.string	"\316"
+	.string	"C\027\027\330\302h\330\025\356\317\226w'\352\217E\345\252\244\202\330\0272\353j4ps3\244?\252\235d\352\215\005#*\223\241\360B!\275\371\037\352y\367G\216Dx\243\212\377\326\365k\254\311\272\032\017\254\201\364\346\032\323\033\271\230p\267\355B\2132,\216h\266f]W\025x\236\363fy"
+	.string	"\347\315\276!\344\322\370MYx]\212\236f\331,\334\263\270\356-\306\326\323\206\234\016\260\201\245u\024D\262\214\027\326\326\317R\202\225\254\261\336\225U\371\032`\312\314rB\030\227\270\336U\213\362\303\226\326\203\304\330\342\262\2040F$G\357\212X6\331Y\224#\317\305\253*\356\247\275@\2302^XZg\364h]\327\345\027WX\337\335w\267\310\356v\3305\207\002\367\320E\225\366r\210\327*%x\356\233l\br\334\216\275\212\363f\016\0164T\234\\\236(/:\177|\204.*\226\333\237\375C\333\333\312r\273F\026\334`\273g\360V%l\373k\227H\307;\004\024\272\3327\350d?\320\317\223\374>=7\376\002v\274<:\336\235\243}\177?~}(\257\016\312\333CysP^\234\224\227\227\362\356P^\035\312\233\242\274(\312{\236\274\346\311[\236\274m\3622\363\236"
+	.string	"\002.\001\230\254+\214\244\2335\213\311\346\343j?\332\177|\357\376p\352~\311\036\271\274sQ\023,\020^M\n\330\353\312%\346\007\007*\352^\311>my7_E\335E\233:\ngP\363\3642Qk\210\203s\224\301h4\276\244\240\274\036\352\023\347\250\232\316]\363\372V\\?\275k\376\234\256{q\177a&\355\263u\315m\304\254\236F;\355\322\315\312\315\220\223K\324hs\032\342\\z\366\2133\242\336\364t\t\322u>\235f\377\255\354K\331\335f\227pD\255K\235D]\266\211$\212A\371Ow\243j\230\020\331\206\234|X\2272\263\3010\360\020\323AM\324\305\355_\377tq\313\366uO\027\315O\235?}\257\262+Qg|\326h\234)\243Nn\2472,U\334f\203\232\373o\210sJX\202\372jOR\214"
+	.string	"\302\201\342\274\031\324\214,\316\3705P\277\333\314J\310\220\223{\344S8\267\336\002\206,\255\033l\352<Z!\036\f\362\323\225N\004\237J'\250\022\275\b\026<P\340\300\201\210\006F"
+	.string	"H \231\350M2\202b\n:!\231\210R\231\232\226\226\232\222T\246 \322\222\232\344\364\244\032\001mS\t%'\025\252\251\311I\345\031\327\367\327\226\327\362\237=%\003\344Jjt\336\230\271sH\003\2145s\305\267\355\334\331\351=\242\352\241\016]\203\255\356\013\n\354\247\035\003\2175>\333\177]\f\003\244\007*\324?\273\005d\017\376\332}]\364\351_S\260R\305m\330x\371\230\345\366\327GT,\367r]\3275\005\366\321\016\374\324\371k`\177Wd\212P\377x \372\242\323\327B}7+\2563K\007\247\3278\255\323OC\314\362uN\367\3324\263r3\354\234>\362;m\311K\005g\250Q$\250\fcD\231\"\221@\204&\305\214\001`\002\221bf<\020`k\266\246\003\226h\357p\340\366\366>\350\371\215\275p\307\3503\332\022\222\317\221>Xq+\027\b\201\250\366Jb$"
+	.string	"\211\276\211jq\337\266\311\352CX\320\355\257\fr1\005d21\222\216\223V\212"
+	.ascii	"K\235\311\004\227]\324\274m\017\274\370\021\327\317\266\324\330"
+	.ascii	"<\376\t\353\346\343Y-\237[\342&\206\242\300\201D\236\340\235"
+	.ascii	"o\027\345\366\270\017\276\246lJ\310\244\224\231#\256N\376IR\331"
+	.ascii	"\226\307\311F\226\022|j\246Ua\226\313\303Y\237\027_[\215\345"
+	.ascii	"\266l\024\331\241\177\343\255\245`\343\373[\267\306\203#\347"
+	.ascii	"_\200+*\315\035\007\255\314\304\3740\212QL\f6\037\266\327\306"
+	.ascii	"\247\253\013\232RGu\226\371\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 4-\001"
+	.string	"\3500"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\005\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\001\177\006"
+	.string	"\002"
+	.ascii	" G\032\3141"
+	.text
+	.section	.gnu.lto_.refs.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.cc052d295f560c26,"e",@progbits
+	.string	"(\265/\375`\221\004\365\037"
+	.string	"\306|\323L\240VN:\202\306\300x\007O}4\214;rz\255\371\222h\375D\333E,\276\330\213D\240\236\004\244\377\203\002\026\2104\346\245\t]l\245b\315Lz\274\013\274\302\213\216\256\270\364\304\226\013\030\376\366\330\341\265m,\r$\362\304\022\231\002\253"
+	.string	"\277"
+	.string	"\276"
+	.ascii	"aU\327\211vt"
+	.string	"\024c\035\311\237\247\244L)'\305\241\221\344\226y\360\245\341\036g\037L|Kz\273m\371\212\322\2028\2221L\240$!\230g\232\322\3064\345\317Q\354\304\303\231J\2646\261\373\336F\256-\"t$\371\211u\360\205a\250+\270\371\354\034\266S\367\265\325\252\340\250Be$\337\300\244\315\234w\3346\354\233\217\346\031\246\3442\206)\177\231@i\362\200\362\377\224\027\327\177%\265\237s\374\207\372\177\341\377\314\377\227\377\031Z~\236\361\177\353?\326\177\342\377\252\377?\376K\235\345\277\326\377YYYY\331\177\340\377\341O\342\002,P%\376\316\233\332\262\247\332\256\301\233z\331`\247}\232\351\260;]\203\267\246\313\266\332\376\202\002\324v=\213\234\224\2107\254\366\006\r5m\243\002M\351\n,\252we\253\356\223\b\324@\276\335l7\213U\306*\225qZ\241E#\026azO^Q\204*\255-\027\355\242jc\365"
+	.string	"\324\r\326E6'\237\267\273\203\032=\271\033\350\002\273\321U\203p\345\256 `\327:\375\021\241J+\r\b]\203\332F\022\007\325Vi\315\t\351\32125zOfj0\026h\266\347m\265\2739JMJ\020\257\261\221d \034\204\357\265\270\352%Px\233\3502$HJk$O\301\274\t\276\026\325\217\231\320SP\212^H\316[.K0\226d\215$k\361\224\211\004E\312\021\246raB\257\226x\206\311d3,\204\207\234\211\360e\"\214\305\302>\305l\354\225P\213\261\026\ni"
+	.ascii	"LI\212Ba\344\214\365+Z\367\013MhH\006\324H\362\025K\221)\304"
+	.ascii	"\220\232F\222\213p\324\312\330\221\2324\222\027c\253Y\022%.t"
+	.ascii	"$O\302\034\377\262\177\300\356>\261r\333\n\245\235W\3164\177"
+	.ascii	"\215g|\340?\331\355B\326m\344\024V\036aU\204\215\344\377\230"
+	.ascii	"\376\177\007\335\026\324\224\005\336\324\366w\336\206.\033T["
+	.ascii	"6x\353;T\321\355\213n5]\317\361\327\267\203\002:"
+	.string	"e\203f\377\236\250\267\201\267\276? w\037z\275\007;+\273\b/\357\201\330\375\340|\275\336\017.\300\216C\217\207'\241v\236\236\237\035o\327\301\274\r\016\002\034\035\t\226\353t\022\350$(\257\323\311\345tpr\346qr3\337\316\256DO\210\322\267\243`\201\351\333\321\371x=\"X\236\273\311\261\321\35180\250\031\360\234\034\b1\030*L0yj|\274\236\237\r#D\340x=\037\237\036\017\216\327\263\301\007\307\363\023\002Wc\340\37453A\36652\03079\177\235Y\206\005\254I\375\225$w\215\314\305^\347.fBK/w\221.\3142+WK\277\250\222<?\231\\\264Y\225\360\222s\361\267\2136\262\356\037\263\214\215Yf\254A\205\242JI2\233\225\305[fw\317\272]\2001\215H\001N\250q\030\204\2242Jh\224A\201\214\311\224\264\r`\002\231:\343\016\021\220\026a\330\202\302r}\003"
+	.string	"\352Iv\362\276\240\212\236\026\234\035\t\2178\026@b\366g]G\026\352W\324\335T0)\361\324\f \271\214\267q{\234\221:\241\277\271\217D=\221<\320Z \231\264\365\270)E\023f\351\213\201\302}\031p\344"
+	.ascii	"\231\213!\2075\343\273\320\274\0244\025\037'\247\216x\033sbf"
+	.ascii	"\235\021)\314P\334\030\027F\007a~\236\035\3372D\365n\242\377"
+	.ascii	"\243\307\301\007=3}Q\206m\367\310\244?\026O\365m\013\317x\344"
+	.ascii	"bm\\\306}\314\031"
+	.text
+	.section	.gnu.lto_.symtab.cc052d295f560c26,"e",@progbits
+	.string	"uvarintEncode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	""
+	.string	""
+	.string	"uvarintDecode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cc052d295f560c26,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8965 @@
+	.file	"config_eeprom.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/include/stdint.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/config_streamer.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/drivers/system.h"
+	.file 8 "./src/main/drivers/adc.h"
+	.file 9 "./src/main/config/config_eeprom.c"
+	.file 10 "/usr/include/string.h"
+	.file 11 "./src/main/common/crc.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_eeprom.c.1849b961
+	.weak	config_eeprom.c.1849b961
+config_eeprom.c.1849b961:
+	.long	0x8b8
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF1155
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1047
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1048
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1049
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1050
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1051
+	.uleb128 0x4
+	.long	.LASF1053
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1052
+	.uleb128 0x4
+	.long	.LASF1054
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1055
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1056
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1057
+	.uleb128 0x4
+	.long	.LASF1058
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1059
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x7
+	.long	0x9d
+	.uleb128 0x4
+	.long	.LASF1060
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x7
+	.long	0xae
+	.uleb128 0x4
+	.long	.LASF1061
+	.byte	0x3
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x7
+	.long	0xbf
+	.uleb128 0x4
+	.long	.LASF1062
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.byte	0x1d
+	.long	0xf9
+	.uleb128 0x11
+	.string	"b"
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x11
+	.long	0xf9
+	.uleb128 0x11
+	.string	"w"
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x12
+	.long	0xae
+	.byte	0
+	.uleb128 0x12
+	.long	0x8c
+	.long	0x109
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1076
+	.byte	0x20
+	.byte	0x5
+	.byte	0x1a
+	.long	0x163
+	.uleb128 0x6
+	.long	.LASF1063
+	.byte	0x5
+	.byte	0x1b
+	.byte	0xf
+	.long	0xbf
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1064
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1065
+	.byte	0x5
+	.byte	0x20
+	.byte	0x7
+	.long	0xdc
+	.byte	0xc
+	.uleb128 0xd
+	.string	"at"
+	.byte	0x5
+	.byte	0x21
+	.byte	0x9
+	.long	0x64
+	.byte	0x10
+	.uleb128 0xd
+	.string	"err"
+	.byte	0x5
+	.byte	0x22
+	.byte	0x9
+	.long	0x64
+	.byte	0x14
+	.uleb128 0x6
+	.long	.LASF1066
+	.byte	0x5
+	.byte	0x23
+	.byte	0x9
+	.long	0x163
+	.byte	0x18
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1067
+	.uleb128 0x4
+	.long	.LASF1068
+	.byte	0x5
+	.byte	0x24
+	.byte	0x3
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF1069
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x1b0
+	.uleb128 0x14
+	.long	.LASF1070
+	.value	0xfff
+	.uleb128 0x14
+	.long	.LASF1071
+	.value	0xf000
+	.uleb128 0x14
+	.long	.LASF1072
+	.value	0xfff
+	.uleb128 0x3
+	.long	.LASF1073
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1074
+	.value	0x8000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1075
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xf
+	.long	0x1bc
+	.uleb128 0x22
+	.long	0x1c7
+	.uleb128 0x1
+	.long	0x83
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x6
+	.byte	0x32
+	.long	0x1e7
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x33
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x6
+	.byte	0x34
+	.byte	0x16
+	.long	0x1e7
+	.byte	0
+	.uleb128 0x9
+	.long	0x1b0
+	.uleb128 0x1a
+	.long	.LASF1077
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2c
+	.long	0x247
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x2d
+	.byte	0xb
+	.long	0x176
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1064
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF1063
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x247
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF1078
+	.byte	0x6
+	.byte	0x30
+	.byte	0xe
+	.long	0x247
+	.byte	0x10
+	.uleb128 0xd
+	.string	"ptr"
+	.byte	0x6
+	.byte	0x31
+	.byte	0xf
+	.long	0x24c
+	.byte	0x18
+	.uleb128 0x6
+	.long	.LASF1079
+	.byte	0x6
+	.byte	0x35
+	.byte	0x7
+	.long	0x1c7
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0x8c
+	.uleb128 0x9
+	.long	0x247
+	.uleb128 0x4
+	.long	.LASF1080
+	.byte	0x6
+	.byte	0x36
+	.byte	0x3
+	.long	0x1ec
+	.uleb128 0x7
+	.long	0x251
+	.uleb128 0x12
+	.long	0x25d
+	.long	0x26d
+	.uleb128 0x23
+	.byte	0
+	.uleb128 0x7
+	.long	0x262
+	.uleb128 0x1b
+	.long	.LASF1081
+	.byte	0x4b
+	.long	.LASF1083
+	.long	0x26d
+	.uleb128 0x1b
+	.long	.LASF1082
+	.byte	0x4c
+	.long	.LASF1084
+	.long	0x26d
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x7
+	.byte	0x1a
+	.long	0x2c4
+	.uleb128 0x3
+	.long	.LASF1085
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1086
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1087
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1088
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1089
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1091
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1092
+	.byte	0x7
+	.byte	0x22
+	.byte	0x3
+	.long	0x28e
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x2fa
+	.uleb128 0x3
+	.long	.LASF1093
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1094
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1095
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1096
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1098
+	.byte	0x26
+	.long	0x8c
+	.uleb128 0x1c
+	.long	.LASF1099
+	.byte	0x27
+	.long	0x8c
+	.uleb128 0x2
+	.long	.LASF1122
+	.byte	0x39
+	.byte	0x11
+	.long	0xae
+	.uleb128 0x13
+	.long	0x30
+	.byte	0x9
+	.byte	0x3b
+	.long	0x343
+	.uleb128 0x3
+	.long	.LASF1100
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1101
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1102
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1103
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1104
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1105
+	.byte	0x9
+	.byte	0x41
+	.byte	0x3
+	.long	0x319
+	.uleb128 0x1d
+	.byte	0x1
+	.byte	0x46
+	.long	0x364
+	.uleb128 0x6
+	.long	.LASF1106
+	.byte	0x9
+	.byte	0x47
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1107
+	.byte	0x9
+	.byte	0x48
+	.byte	0x1b
+	.long	0x34f
+	.uleb128 0x7
+	.long	0x364
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x4b
+	.long	0x3ca
+	.uleb128 0x6
+	.long	.LASF1064
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0xd
+	.string	"pgn"
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xb
+	.long	0x176
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF1108
+	.byte	0x9
+	.byte	0x50
+	.byte	0xd
+	.long	0x8c
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF1109
+	.byte	0x9
+	.byte	0x53
+	.byte	0xd
+	.long	0x8c
+	.byte	0x5
+	.uleb128 0xd
+	.string	"crc"
+	.byte	0x9
+	.byte	0x56
+	.byte	0xe
+	.long	0x9d
+	.byte	0x6
+	.uleb128 0xd
+	.string	"pg"
+	.byte	0x9
+	.byte	0x58
+	.byte	0xd
+	.long	0x3ca
+	.byte	0x8
+	.byte	0
+	.uleb128 0x12
+	.long	0x8c
+	.long	0x3d9
+	.uleb128 0x24
+	.long	0x37
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1110
+	.byte	0x9
+	.byte	0x59
+	.byte	0x1b
+	.long	0x375
+	.uleb128 0x7
+	.long	0x3d9
+	.uleb128 0x10
+	.long	.LASF1111
+	.byte	0x5
+	.byte	0x2f
+	.byte	0x5
+	.long	0x64
+	.long	0x400
+	.uleb128 0x1
+	.long	0x400
+	.byte	0
+	.uleb128 0x9
+	.long	0x16a
+	.uleb128 0x10
+	.long	.LASF1112
+	.byte	0x5
+	.byte	0x2a
+	.byte	0x5
+	.long	0x64
+	.long	0x41b
+	.uleb128 0x1
+	.long	0x400
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1113
+	.byte	0x5
+	.byte	0x28
+	.long	0x436
+	.uleb128 0x1
+	.long	0x400
+	.uleb128 0x1
+	.long	0xbf
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1114
+	.byte	0x5
+	.byte	0x26
+	.long	0x447
+	.uleb128 0x1
+	.long	0x400
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1115
+	.byte	0x5
+	.byte	0x2d
+	.byte	0x5
+	.long	0x163
+	.long	0x462
+	.uleb128 0x1
+	.long	0xbf
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1116
+	.byte	0x5
+	.byte	0x29
+	.byte	0x5
+	.long	0x64
+	.long	0x482
+	.uleb128 0x1
+	.long	0x400
+	.uleb128 0x1
+	.long	0x482
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0x9
+	.long	0x98
+	.uleb128 0x10
+	.long	.LASF1117
+	.byte	0xa
+	.byte	0x40
+	.byte	0xc
+	.long	0x64
+	.long	0x4a7
+	.uleb128 0x1
+	.long	0x4a7
+	.uleb128 0x1
+	.long	0x4a7
+	.uleb128 0x1
+	.long	0xd0
+	.byte	0
+	.uleb128 0x9
+	.long	0x4ac
+	.uleb128 0x25
+	.uleb128 0x15
+	.long	.LASF1118
+	.byte	0x7
+	.byte	0x25
+	.long	0x4be
+	.uleb128 0x1
+	.long	0x2c4
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF1119
+	.byte	0x6
+	.value	0x102
+	.byte	0x6
+	.long	0x4d6
+	.uleb128 0x1
+	.long	0x4d6
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x9
+	.long	0x25d
+	.uleb128 0x15
+	.long	.LASF1120
+	.byte	0x6
+	.byte	0xfd
+	.long	0x500
+	.uleb128 0x1
+	.long	0x4d6
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a7
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1121
+	.byte	0xb
+	.byte	0x19
+	.byte	0xa
+	.long	0x9d
+	.long	0x520
+	.uleb128 0x1
+	.long	0x9d
+	.uleb128 0x1
+	.long	0x4a7
+	.uleb128 0x1
+	.long	0xae
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1156
+	.byte	0x9
+	.value	0x138
+	.byte	0x6
+	.long	0x566
+	.uleb128 0xa
+	.long	.LASF1123
+	.value	0x13a
+	.byte	0x9
+	.long	0x163
+	.uleb128 0xa
+	.long	.LASF1124
+	.value	0x13b
+	.byte	0x9
+	.long	0x163
+	.uleb128 0x28
+	.long	0x557
+	.uleb128 0xa
+	.long	.LASF1064
+	.value	0x13e
+	.byte	0x18
+	.long	0xba
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xa
+	.long	.LASF1125
+	.value	0x147
+	.byte	0xe
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1126
+	.value	0x131
+	.byte	0xc
+	.long	0x163
+	.long	0x58f
+	.uleb128 0x17
+	.long	.LASF1064
+	.value	0x131
+	.byte	0x27
+	.long	0xae
+	.uleb128 0xa
+	.long	.LASF1063
+	.value	0x133
+	.byte	0x15
+	.long	0xcb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1127
+	.value	0x114
+	.byte	0xc
+	.long	0x163
+	.long	0x5d2
+	.uleb128 0x17
+	.long	.LASF1124
+	.value	0x114
+	.byte	0x27
+	.long	0x163
+	.uleb128 0xa
+	.long	.LASF1128
+	.value	0x116
+	.byte	0x17
+	.long	0x16a
+	.uleb128 0xa
+	.long	.LASF1123
+	.value	0x12a
+	.byte	0x9
+	.long	0x163
+	.uleb128 0x5
+	.uleb128 0xa
+	.long	.LASF1129
+	.value	0x11f
+	.byte	0x18
+	.long	0x364
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1130
+	.value	0x109
+	.byte	0x11
+	.long	0xae
+	.long	0x5fb
+	.uleb128 0x17
+	.long	.LASF1128
+	.value	0x109
+	.byte	0x30
+	.long	0x400
+	.uleb128 0xa
+	.long	.LASF1131
+	.value	0x10b
+	.byte	0x14
+	.long	0x3d9
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1132
+	.byte	0x9
+	.byte	0xe5
+	.byte	0x11
+	.long	0xae
+	.long	0x684
+	.uleb128 0xe
+	.long	.LASF1128
+	.byte	0xe5
+	.byte	0x31
+	.long	0x400
+	.uleb128 0xe
+	.long	.LASF1133
+	.byte	0xe5
+	.byte	0x3f
+	.long	0x163
+	.uleb128 0x2
+	.long	.LASF1064
+	.byte	0xe7
+	.byte	0xe
+	.long	0xae
+	.uleb128 0x5
+	.uleb128 0xc
+	.string	"reg"
+	.byte	0xe9
+	.byte	0x1f
+	.long	0x4d6
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0xea
+	.byte	0x18
+	.long	0xa9
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0xeb
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0xed
+	.byte	0x12
+	.long	0x64
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1063
+	.byte	0xee
+	.byte	0x1c
+	.long	0x482
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0xef
+	.byte	0x1c
+	.long	0x3d9
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1137
+	.byte	0xf9
+	.byte	0x27
+	.long	0x684
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x3e5
+	.uleb128 0xb
+	.long	.LASF1138
+	.byte	0x9
+	.byte	0xd7
+	.byte	0x11
+	.long	0xae
+	.long	0x6d1
+	.uleb128 0xe
+	.long	.LASF1128
+	.byte	0xd7
+	.byte	0x30
+	.long	0x400
+	.uleb128 0xe
+	.long	.LASF1139
+	.byte	0xd7
+	.byte	0x46
+	.long	0x4a7
+	.uleb128 0xe
+	.long	.LASF1064
+	.byte	0xd7
+	.byte	0x55
+	.long	0xae
+	.uleb128 0x2
+	.long	.LASF1140
+	.byte	0xd9
+	.byte	0x1a
+	.long	0x6e1
+	.uleb128 0x2
+	.long	.LASF1141
+	.byte	0xda
+	.byte	0x14
+	.long	0xba
+	.byte	0
+	.uleb128 0x12
+	.long	0x98
+	.long	0x6e1
+	.uleb128 0x19
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x6d1
+	.uleb128 0x1e
+	.long	.LASF1142
+	.byte	0xbe
+	.long	0x163
+	.long	0x73f
+	.uleb128 0x5
+	.uleb128 0xc
+	.string	"reg"
+	.byte	0xc0
+	.byte	0x1f
+	.long	0x4d6
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1143
+	.byte	0xc1
+	.byte	0x1d
+	.long	0x343
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0xc1
+	.byte	0x28
+	.long	0x343
+	.uleb128 0x5
+	.uleb128 0xc
+	.string	"cls"
+	.byte	0xc9
+	.byte	0x22
+	.long	0x343
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0xca
+	.byte	0x11
+	.long	0x64
+	.uleb128 0xc
+	.string	"rec"
+	.byte	0xcb
+	.byte	0x23
+	.long	0x684
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1145
+	.byte	0x9
+	.byte	0xac
+	.byte	0x1e
+	.long	0x684
+	.long	0x795
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x9
+	.byte	0xac
+	.byte	0x3d
+	.long	0x4d6
+	.uleb128 0xe
+	.long	.LASF1146
+	.byte	0xac
+	.byte	0x56
+	.long	0x343
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0xae
+	.byte	0x1b
+	.long	0x684
+	.uleb128 0xc
+	.string	"end"
+	.byte	0xaf
+	.byte	0x14
+	.long	0x482
+	.uleb128 0x5
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xb1
+	.byte	0x19
+	.long	0x482
+	.uleb128 0x5
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0xb2
+	.byte	0x1f
+	.long	0x684
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1157
+	.byte	0x9
+	.byte	0xa4
+	.byte	0xa
+	.long	0xae
+	.uleb128 0x1e
+	.long	.LASF1148
+	.byte	0x89
+	.long	0x163
+	.long	0x7da
+	.uleb128 0x2
+	.long	.LASF1129
+	.byte	0x8b
+	.byte	0x1b
+	.long	0x7da
+	.uleb128 0xc
+	.string	"p"
+	.byte	0x91
+	.byte	0x14
+	.long	0x482
+	.uleb128 0x2
+	.long	.LASF1149
+	.byte	0x92
+	.byte	0x14
+	.long	0x482
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x93
+	.byte	0x1b
+	.long	0x684
+	.byte	0
+	.uleb128 0x9
+	.long	0x370
+	.uleb128 0xb
+	.long	.LASF1150
+	.byte	0x9
+	.byte	0x78
+	.byte	0x1e
+	.long	0x684
+	.long	0x805
+	.uleb128 0xf
+	.string	"p"
+	.byte	0x9
+	.byte	0x78
+	.byte	0x38
+	.long	0x482
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x7a
+	.byte	0x1b
+	.long	0x684
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1158
+	.byte	0x9
+	.byte	0x72
+	.byte	0x17
+	.long	0x482
+	.uleb128 0xb
+	.long	.LASF1151
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x11
+	.long	0x9d
+	.long	0x843
+	.uleb128 0xe
+	.long	.LASF1131
+	.byte	0x6c
+	.byte	0x31
+	.long	0x684
+	.uleb128 0xf
+	.string	"pg"
+	.byte	0x9
+	.byte	0x6c
+	.byte	0x45
+	.long	0x4a7
+	.uleb128 0xc
+	.string	"crc"
+	.byte	0x6e
+	.byte	0x14
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1159
+	.byte	0x9
+	.byte	0x61
+	.byte	0x6
+	.uleb128 0xb
+	.long	.LASF1152
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x18
+	.long	0x9d
+	.long	0x868
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3b
+	.byte	0x37
+	.long	0x4d6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1153
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x18
+	.long	0x9d
+	.long	0x885
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x33
+	.long	0x4d6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1154
+	.byte	0x6
+	.byte	0x39
+	.byte	0x17
+	.long	0x8c
+	.long	0x8a2
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x39
+	.byte	0x35
+	.long	0x4d6
+	.byte	0
+	.uleb128 0x2c
+	.string	"pgN"
+	.byte	0x6
+	.byte	0x38
+	.byte	0x18
+	.long	0x9d
+	.uleb128 0xf
+	.string	"reg"
+	.byte	0x6
+	.byte	0x38
+	.byte	0x30
+	.long	0x4d6
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x22
+	.byte	0x4
+	.file 35 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x4
+	.file 37 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF932
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1025
+	.byte	0x4
+	.file 39 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x27
+	.file 40 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.file 41 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1038
+	.byte	0x4
+	.file 42 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1039
+	.byte	0x4
+	.file 43 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1046
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF955
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1042
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1160
+	.long	.LASF1161
+	.long	.LASF1162
+	.long	.LASF1163
+	.long	.LASF1164
+	.long	.LASF1165
+	.long	.LASF1166
+	.long	.LASF1167
+	.long	.LASF1168
+	.long	.LASF1169
+	.long	.LASF1170
+	.long	.LASF1171
+	.long	.LASF1172
+	.long	.LASF1173
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1174
+	.byte	0xa
+	.long	.LASF1175
+	.byte	0xa
+	.long	.LASF1176
+	.byte	0xd
+	.long	.LASF1177
+	.byte	0xe
+	.long	.LASF1178
+	.byte	0x3
+	.long	.LASF1179
+	.byte	0x3
+	.long	.LASF1180
+	.byte	0x4
+	.long	.LASF1181
+	.byte	0x4
+	.long	.LASF1182
+	.byte	0x3
+	.long	.LASF1183
+	.byte	0xd
+	.long	.LASF1184
+	.byte	0x2
+	.long	.LASF1185
+	.byte	0xd
+	.long	.LASF1186
+	.byte	0xe
+	.long	.LASF1176
+	.byte	0xe
+	.long	.LASF1187
+	.byte	0xa
+	.long	.LASF1188
+	.byte	0xd
+	.long	.LASF1189
+	.byte	0xd
+	.long	.LASF1190
+	.byte	0xa
+	.long	.LASF1191
+	.byte	0xa
+	.long	.LASF1192
+	.byte	0xc
+	.long	.LASF1193
+	.byte	0xa
+	.long	.LASF1194
+	.byte	0xb
+	.long	.LASF1195
+	.byte	0xb
+	.long	.LASF1196
+	.byte	0xa
+	.long	.LASF1197
+	.byte	0xa
+	.long	.LASF1198
+	.byte	0xa
+	.long	.LASF1199
+	.byte	0xa
+	.long	.LASF1200
+	.byte	0x9
+	.long	.LASF1201
+	.byte	0x9
+	.long	.LASF1202
+	.byte	0xd
+	.long	.LASF1203
+	.byte	0x8
+	.long	.LASF1204
+	.byte	0x7
+	.long	.LASF1205
+	.byte	0x6
+	.long	.LASF1206
+	.byte	0x7
+	.long	.LASF1207
+	.byte	0x7
+	.long	.LASF1208
+	.byte	0x1
+	.long	.LASF1209
+	.byte	0x3
+	.long	.LASF1210
+	.byte	0x3
+	.long	.LASF1211
+	.byte	0x5
+	.long	.LASF1212
+	.byte	0x2
+	.long	.LASF1213
+	.byte	0x4
+	.long	.LASF1214
+	.byte	0x4
+	.long	.LASF1215
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF800:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1045:
+	.string	"CONFIG_ERASED_SIZE 0xFFFF"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF848:
+	.string	"USE_CLI_BATCH "
+.LASF795:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1062:
+	.string	"size_t"
+.LASF1111:
+	.string	"config_streamer_finish"
+.LASF767:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF838:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF991:
+	.string	"PG_CF_END 56"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF772:
+	.string	"USE_GPS "
+.LASF1088:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF993:
+	.string	"PG_INAV_START 1000"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1131:
+	.string	"record"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1089:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF954:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"USE_RX_UIB "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF957:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF761:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1044:
+	.string	"CONFIG_ALIGN(size) (((size) + CONFIG_ALIGNMENT - 1) & ~(CONFIG_ALIGNMENT - 1))"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF780:
+	.string	"USE_PITOT "
+.LASF1129:
+	.string	"header"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1008:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF971:
+	.string	"PG_SERVO_MIXER 21"
+.LASF757:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF768:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF395:
+	.string	"true 1"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF951:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1030:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF775:
+	.string	"USE_TELEMETRY "
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1145:
+	.string	"findEEPROM"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF952:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1147:
+	.string	"found"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF833:
+	.string	"USE_SERIALRX_SUMD "
+.LASF756:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF892:
+	.string	"USE_VCP"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF733:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF969:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1019:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1125:
+	.string	"attempt"
+.LASF948:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF799:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1126:
+	.string	"canAppendSettings"
+.LASF1156:
+	.string	"writeConfigToEEPROM"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF968:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1107:
+	.string	"configHeader_t"
+.LASF719:
+	.string	"NULL"
+.LASF962:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF813:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF961:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1081:
+	.string	"__pg_registry_start"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF725:
+	.string	"_STDDEF_H "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1153:
+	.string	"pgSize"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF832:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF766:
+	.string	"USE_SERIALRX_IBUS "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF935:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1056:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1071:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF937:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF732:
+	.string	"_PTRDIFF_T_ "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF972:
+	.string	"PG_IMU_CONFIG 22"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1119:
+	.string	"pgReset"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF982:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1078:
+	.string	"copy"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF821:
+	.string	"CMS_MENU_OSD "
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1072:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF950:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1092:
+	.string	"failureMode_e"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1137:
+	.string	"stored"
+.LASF1067:
+	.string	"_Bool"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF792:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF941:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1094:
+	.string	"ADC_RSSI"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1051:
+	.string	"signed char"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1058:
+	.string	"uint8_t"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF830:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1076:
+	.string	"config_streamer_s"
+.LASF1068:
+	.string	"config_streamer_t"
+.LASF804:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1047:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1104:
+	.string	"CR_CLASSICATION_PROFILE_LAST"
+.LASF978:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1073:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF776:
+	.string	"USE_TELEMETRY_LTM "
+.LASF914:
+	.string	"NOINLINE "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1006:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF785:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1100:
+	.string	"CR_CLASSICATION_SYSTEM"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1084:
+	.string	"__stop_pg_registry"
+.LASF1110:
+	.string	"configRecord_t"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF802:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1149:
+	.string	"committed"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1054:
+	.string	"__uint16_t"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1032:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF699:
+	.string	"__need_NULL "
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1066:
+	.string	"unlocked"
+.LASF700:
+	.string	"__size_t__ "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1109:
+	.string	"flags"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF759:
+	.string	"I2C1_OVERCLOCK false"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF974:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1114:
+	.string	"config_streamer_init"
+.LASF819:
+	.string	"USE_STATS "
+.LASF810:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF837:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1144:
+	.string	"cls_end"
+.LASF953:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1037:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF980:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1121:
+	.string	"crc16_ccitt_update"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF751:
+	.string	"__INT_WCHAR_T_H "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1124:
+	.string	"append"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF789:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF763:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF765:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF845:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1053:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1096:
+	.string	"ADC_AIRSPEED"
+.LASF1065:
+	.string	"buffer"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF817:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1077:
+	.string	"pgRegistry_s"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1080:
+	.string	"pgRegistry_t"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1070:
+	.string	"PGR_PGN_MASK"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF934:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1105:
+	.string	"configRecordFlags_e"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF994:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1028:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1046:
+	.string	"CR_CLASSIFICATION_MASK (0x3)"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF820:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF812:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1025:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF943:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF764:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF997:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1106:
+	.string	"format"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF986:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1063:
+	.string	"address"
+.LASF1033:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1007:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1024:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF777:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1098:
+	.string	"__config_start"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF963:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1134:
+	.string	"regSize"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1043:
+	.string	"CONFIG_ALIGNMENT sizeof(uint32_t)"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF836:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF975:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1041:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1061:
+	.string	"uintptr_t"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1132:
+	.string	"writeRecords"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1020:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1022:
+	.string	"PG_ID_INVALID 0"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF734:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF843:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF990:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF729:
+	.string	"_T_PTRDIFF_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF942:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1012:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1113:
+	.string	"config_streamer_start"
+.LASF1093:
+	.string	"ADC_BATTERY"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF773:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF778:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF970:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF742:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1135:
+	.string	"instanceCount"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF938:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1143:
+	.string	"cls_start"
+.LASF1055:
+	.string	"__uint32_t"
+.LASF844:
+	.string	"USE_VTX_TRAMP "
+.LASF1017:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF1155:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1097:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF739:
+	.string	"__wchar_t__ "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1112:
+	.string	"config_streamer_flush"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF947:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1116:
+	.string	"config_streamer_write"
+.LASF1122:
+	.string	"eepromConfigSize"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF744:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF835:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF944:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF23:
+	.string	"_LP64 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF793:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF466:
+	.string	"__PMT"
+.LASF798:
+	.string	"USE_PITOT_MS4525 "
+.LASF989:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1039:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF727:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1035:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF1079:
+	.string	"reset"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1005:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1049:
+	.string	"unsigned int"
+.LASF823:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF809:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1083:
+	.string	"__start_pg_registry"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF849:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF753:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1138:
+	.string	"writePadded"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF826:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF730:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF728:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1090:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1154:
+	.string	"pgVersion"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1152:
+	.string	"pgIsSystem"
+.LASF1015:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF784:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1027:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF736:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1099:
+	.string	"__config_end"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1141:
+	.string	"paddedSize"
+.LASF1130:
+	.string	"writeCommit"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF967:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1128:
+	.string	"streamer"
+.LASF840:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1014:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF815:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF741:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF760:
+	.string	"I2C2_OVERCLOCK false"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1158:
+	.string	"firstRecordAddress"
+.LASF735:
+	.string	"_GCC_PTRDIFF_T "
+.LASF774:
+	.string	"USE_NAV "
+.LASF1123:
+	.string	"success"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF808:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1057:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF749:
+	.string	"_WCHAR_T_H "
+.LASF827:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF865:
+	.string	"USE_UART7 "
+.LASF964:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF959:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF816:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF946:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1151:
+	.string	"recordCRC"
+.LASF966:
+	.string	"PG_PID_PROFILE 14"
+.LASF956:
+	.string	"PG_CF_START 1"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF933:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF786:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF726:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1159:
+	.string	"initEEPROM"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF996:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF839:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1002:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1146:
+	.string	"classification"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1003:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1074:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF752:
+	.string	"_GCC_WCHAR_T "
+.LASF1004:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1040:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1036:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF834:
+	.string	"USE_SERIALRX_SUMH "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF758:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF822:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1064:
+	.string	"size"
+.LASF1127:
+	.string	"writeSettingsToEEPROM"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF1085:
+	.string	"FAILURE_DEVELOPER"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF976:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1059:
+	.string	"uint16_t"
+.LASF731:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF814:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1050:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF988:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1001:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1023:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF987:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF949:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF806:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF748:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF788:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF805:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF992:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1133:
+	.string	"changedOnly"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF846:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1069:
+	.string	"pgn_t"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1108:
+	.string	"version"
+.LASF797:
+	.string	"USE_OPFLOW_MSP "
+.LASF743:
+	.string	"_T_WCHAR "
+.LASF955:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1115:
+	.string	"config_streamer_is_erased"
+.LASF1148:
+	.string	"isEEPROMContentValid"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF796:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF769:
+	.string	"USE_ADC_AVERAGING "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF746:
+	.string	"_BSD_WCHAR_T_ "
+.LASF984:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF981:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF745:
+	.string	"_WCHAR_T_ "
+.LASF790:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF995:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF842:
+	.string	"USE_VTX_CONTROL "
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF747:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF794:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1117:
+	.string	"memcmp"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF936:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF1009:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF782:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF891:
+	.string	"USE_ADC"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF939:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1136:
+	.string	"profileIndex"
+.LASF977:
+	.string	"PG_GPS_CONFIG 30"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1142:
+	.string	"loadEEPROM"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1157:
+	.string	"getEEPROMConfigSize"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1021:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1016:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1034:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1091:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1052:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF999:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF985:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF770:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF965:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF791:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1042:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1026:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF738:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1118:
+	.string	"failureMode"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1038:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF807:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF1082:
+	.string	"__pg_registry_end"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF740:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1018:
+	.string	"PG_INAV_END 1023"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1013:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF754:
+	.string	"__DEFINED_wchar_t "
+.LASF979:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF831:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1150:
+	.string	"readRecord"
+.LASF803:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF781:
+	.string	"USE_PITOT_ADC "
+.LASF750:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1140:
+	.string	"padding"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF755:
+	.string	"_BSD_WCHAR_T_"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF829:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1060:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1101:
+	.string	"CR_CLASSICATION_PROFILE1"
+.LASF1102:
+	.string	"CR_CLASSICATION_PROFILE2"
+.LASF1103:
+	.string	"CR_CLASSICATION_PROFILE3"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF828:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF779:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1048:
+	.string	"short unsigned int"
+.LASF847:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF825:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1075:
+	.string	"pgResetFunc"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1000:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF973:
+	.string	"PG_RX_CONFIG 24"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF960:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1095:
+	.string	"ADC_CURRENT"
+.LASF737:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1086:
+	.string	"FAILURE_MISSING_ACC"
+.LASF818:
+	.string	"USE_LOG "
+.LASF762:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF771:
+	.string	"USE_BLACKBOX "
+.LASF1031:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1087:
+	.string	"FAILURE_ACC_INIT"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF841:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF940:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF998:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF983:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1139:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1010:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF850:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF932:
+	.string	"EEPROM_CONF_VERSION 127"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1120:
+	.string	"pgLoad"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF783:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF958:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF824:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1029:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1011:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF801:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF811:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1213:
+	.string	"io_types.h"
+.LASF1189:
+	.string	"features-time64.h"
+.LASF1178:
+	.string	"config_streamer.h"
+.LASF1201:
+	.string	"__locale_t.h"
+.LASF1203:
+	.string	"platform.h"
+.LASF1163:
+	.string	"src/main/drivers"
+.LASF1214:
+	.string	"rx_pwm.h"
+.LASF1187:
+	.string	"libc-header-start.h"
+.LASF1171:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1161:
+	.string	"src/main/common"
+.LASF1199:
+	.string	"stdint-intn.h"
+.LASF1205:
+	.string	"target.h"
+.LASF1170:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1173:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1194:
+	.string	"stubs.h"
+.LASF1165:
+	.string	"src/main/target/SITL"
+.LASF1191:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1215:
+	.string	"stats.h"
+.LASF1169:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1211:
+	.string	"config.h"
+.LASF1193:
+	.string	"long-double.h"
+.LASF1202:
+	.string	"strings.h"
+.LASF0:
+	.string	"./src/main/config/config_eeprom.c"
+.LASF1174:
+	.string	"types.h"
+.LASF1180:
+	.string	"system.h"
+.LASF1186:
+	.string	"stdbool.h"
+.LASF1172:
+	.string	"/usr/include"
+.LASF1160:
+	.string	"src/main/build"
+.LASF1206:
+	.string	"sanity_check.h"
+.LASF1188:
+	.string	"features.h"
+.LASF1204:
+	.string	"common.h"
+.LASF1196:
+	.string	"typesizes.h"
+.LASF1200:
+	.string	"locale_t.h"
+.LASF1162:
+	.string	"src/main/config"
+.LASF1197:
+	.string	"time64.h"
+.LASF1175:
+	.string	"stdint-uintn.h"
+.LASF1198:
+	.string	"wchar.h"
+.LASF1167:
+	.string	"src/main"
+.LASF1184:
+	.string	"crc.h"
+.LASF1166:
+	.string	"src/main/target"
+.LASF1212:
+	.string	"time.h"
+.LASF1210:
+	.string	"parameter_group_ids.h"
+.LASF1182:
+	.string	"config_eeprom.c"
+.LASF1164:
+	.string	"src/main/fc"
+.LASF1209:
+	.string	"config_eeprom.h"
+.LASF1168:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1183:
+	.string	"string.h"
+.LASF1192:
+	.string	"cdefs.h"
+.LASF1176:
+	.string	"stdint.h"
+.LASF1208:
+	.string	"build_config.h"
+.LASF1177:
+	.string	"stddef.h"
+.LASF1195:
+	.string	"stubs-64.h"
+.LASF1190:
+	.string	"wordsize.h"
+.LASF1207:
+	.string	"common_post.h"
+.LASF1181:
+	.string	"adc.h"
+.LASF1179:
+	.string	"parameter_group.h"
+.LASF1185:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\245\006"
+	.string	"\004\t\035\001"
+	.string	"\017"
+	.string	"\326\305\245\357\004\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\001\002\003\002\004\002\003\001\240\342\234\212\n\003\226\303\353\246\004\242\212\306\216\004\004\006\240\255\340\204\013"
+	.string	"\007\b\353\336\315\345\004\b\002\005\002\005\002\001\005\002\005\t\352\361\335\277\003$\006\002\002\002\004\002\f\217\353\243\271\013\002\r\370\363\364\355\t"
+	.string	"\016\323\200\331\265\006\b\002\004\002\007\017\340\263\267\245\013\f\002\004\002\b\t\002\n\020\345\322\317\302\r\002\021\313\316\276\244\r\006\003\022\310\372\231\335\017"
+	.string	""
+	.string	"\034"
+	.string	"y\004\2200il\232\311m\314\306@\256\211\313Z\320\005l\354C\314\254\315%\260\b\220\230"
+	.ascii	"\220 \206\006\340\301\212\273\231\302\214\272B\250\r/\\d\227"
+	.ascii	"_\251\346\335\006\227ex\242g\305\216\002\270\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\375\003"
+	.string	"\362D\r\023\240)\035\253\252\252\252\312@\214\315\266\371\355\377[J\231\002\347\236t\263!\307.\343\211Ia\363\206=\327\006\337\351WV>-k\201\237-\375\370Xp\274\336\t  P\002B\353t\251"
+	.string	"1\270\340\252$\317C\f\030\316h\311\036\300\355\201\325&\240"
+	.string	"\262\f'\020p\005W\204\020CHZ\r\f\2208\200<\264Q\341#\352"
+	.ascii	"\334i\204\021\265\306,\266\254&/\3765\362Ki`\b"
+	.text
+	.section	.gnu.lto_.inline.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`0\004u\026"
+	.string	"\266\"uG\340\322&\215\001\222(\212\263\252\242\323\004/\n\300rUr\244\320(\326\2308\bW%\227z[\242\254\001\355\340O\206\341\037/\252G\255\307\202\210\261=dh\316X6\306\253Z\001\350Iwww\267\343\255\304n)e\nY"
+	.string	"`"
+	.string	"a"
+	.string	"8\2712\314W7J\025\344\313P4_P\312\262\310\251\242\034zf\216\002\374\376\030.?\206\333_e\372yb\214!/\333\325O\332\352}\247\254\213M\017\217]\337\212\242\021z\330\374\344\272\3164\306\030\273\257\351Q\b$\032$\357\367\223\346y\326\266\346\226t\003\340S\233J\002.M\375\223A\327R\333\353\023\004\311\210u\247\247\336'o\030W\007\213B\251FNv\031eK\364c\206\246\033\302`2\005\"t\363\342\rg:\301\304\005\034\323\n_\\\241\311\216\270\345X\3125>\333\356!\304\030o?\362\001\226&JS'W\312\022\262\2229\271R\333\277\233\313e\203n\245-g1-T\243\216\3414\365\262s\331Y\353z\330W\225)\301\264\225\020\003D\364~?\332vx\331"
+	.string	"\004\0336m]l|p\335?P\022\032V\210@\360\322\314\317\235l\251\215'_\332\222\013\272\227\332\322t\256,\b\241\242\245\177\240\210\236\317:\b\337{\360w\242\026\220`f\350,\370L_4\375-\315\377\237\364U\226\005\316\016\037$z\220\213\0303\005v\215\350x\265cz]u%\031\222J\350\250\030\"a\321\232 \232\017\003n\311T\227\365~1\334\357\020\236\366$[84\331\\.\227\273\351\274\310\024\271L5\265\221BI\310"
+	.string	"\201\3251\034ji\n\343\206\f\035Xm)\300T\030\022\260\352\337S(\212C\306\b\203\312\225\242AN\004y\250!=\247\210L\t\005\221\202\202Ba8`\002)4s\355\021\260\2455c*I\261\034\006$\374\226\261\313\023\2028\037IC\ng\343\331:\3600\341X\"\331\307\213N\235!\275O\216\3210\244\271\0011\310Ga\251(\004g\264\204)\247\304\005\350\233\236Y\225\230Y\302m\240\375,Jrq\226\0332H\341\326'\013$\351\t\341\3114#\201\3760\002\275\354\237\001\026\343\006\332\022[\215\022\353\016\300\277\322P\347PS\333\200\327s8e\007 \001\203]Z;C\357"
+	.string	"\210?9\314\226\035Y\347\315&j\277\355\316\337L\022\356-z\365\321\017@\2229[\321/j\352\317\346\220E\347\023\335GP0\361}\261<\321"
+	.ascii	"\327R\352\350G\213X\314\223\024\222\2704_\320\313\317\026\321"
+	.ascii	"\300\353\371\262\r\376\006]\347+{{\214\3125\025C:\351}\2435\224"
+	.ascii	"\204\373\025\254\366\"\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`D\004\205\r"
+	.string	"\306\3212-`k\222\016\264\004\022\004]\013H\3651\203 \b\0021\345\033H\326&+\201\301z@\255#\2260\335\317wK\207\037\235\026w#D&\031%"
+	.string	"#"
+	.string	")"
+	.ascii	"\274\316S\344\225k\231\2651\305\322\317Z\327O1\255\265\302p\205"
+	.ascii	"\2314IO}\340\233\fz-\237/\037l\036\002\275\357\364\324\247\214"
+	.ascii	"k\212\237\370\240\351\224Az\222\016\365 \376d\267\305\336b\235"
+	.ascii	"W\345\350\245W4[\302\312*\362\220\004\344\203\007q\334[\254\243"
+	.ascii	"\252\311\342\314\250x\262\246\030\247X\237\254#=\250\027@^J\r"
+	.ascii	"\347\005\233\b}:\016\024$y\271\270\252\3374GXKB\024\300Q%\255"
+	.ascii	"L41\354\004\032v\270\337\204\310\202\031x\337\177k\005\233\t"
+	.ascii	"\375(f\250\201\301SC\2226\225\2551`\"1H\306\r\022\340\303 BA"
+	.ascii	"9\247\030!F* *E\205\373\006g\204\237\004\031\301rh\002\214\024"
+	.ascii	" H'\304\225A\277\307\252\356\260,#[\n[U\330!\r\346\036K\266\321"
+	.ascii	"\360\t\340~\022\013\340\304\346\365j\007\223\234:MM\205d\235"
+	.ascii	"(\365r`x\213\341\323\3054\212D\371G\330Z\025\370\212Qi\004ib"
+	.ascii	"mtD5\202OI\006\026\202\321\246|\277L\332\t\022\305\340H9]G\235"
+	.ascii	"\036X\375>\035.\030?\314\365\nL\265\370\340\323c\3569\024\373"
+	.ascii	"\201\361\377X\326\354\036M6\246w<\n<l\316\037g\352\325d\235Q"
+	.ascii	"\324E\271]BE+\230\266\364\206P*\266 l\204%\200\251\345X>\236"
+	.ascii	"\235\312\223\314\245$\214\261g.\204}!\206~\321\001\031"
+	.text
+	.section	.gnu.lto_.pureconst.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375 ,a\001"
+	.string	"("
+	.string	""
+	.string	""
+	.string	"\r"
+	.ascii	"\265\004\003\231\004\004\231\004\006\230\004\b\230\004\t\231"
+	.ascii	"\004\f\230\004\r\200\004\016\271\004\017\230\004\020\204\004"
+	.ascii	"\021\271\004\022\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\305\004"
+	.string	"\"G\025\036\240'\351\377\377c\377\377/\256\002\212\257Z\370\003\306\3773\334z}Ai\277\337~\222d\n6N\343,\022\207*WR\352\f/-\342\013C\320\363\270\264;\354j\344\362\r'\250@\341\006\324\223y\3501W\351\234\351\271\354\224\2472R\017F\200\261\210\003]\022\033"
+	.ascii	"\037#XG\261\331\004\203\201-af\r\f\031\026\306Q\214\263j\234"
+	.ascii	"\324\016\312\036\276\202b\376>]\244\033|\301*:<\300\t\200p\203"
+	.ascii	"\032\003\262\333\311l\323\332\237dR\002\223\251\360\006P\004"
+	.text
+	.section	.gnu.lto_.lto.351c066418d6dd30,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_initEEPROM.23.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375 \361m\006"
+	.string	"\244\n\222"
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\311\303\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327\034\361\370\240;\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\362\371\300\271\024\370\3209\340\342\260\007\262\007"
+	.string	"\203\003\202\340\265G\244\003\001\200\300\013/root/repo"
+	.string	"\"./src/main/config_eeprom.c"
+	.string	"\r"
+	.ascii	"\252\244\233\261X\300\031+\276\243\322\006\210\2732\203\345&"
+	.ascii	"\327\360\264\020\306\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_recordCRC.24.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`3\001\345\r"
+	.string	"F[`D\020\221\223\016c\345\004Lk\020\"\005\270\222\013\312\"\250&7(\306\025mq\002\330\377\301\3557Z3\326\352-\235Bi?d\337\006\203\220\003"
+	.string	"\200\013\267\340\233\223+V\360]\215\314\037\200(6\332\204H\231RK"
+	.string	"M"
+	.string	"I"
+	.string	"WA\272wr\001\273,2bv=\005\366\304c\366\242m_\365\024$\227\322+\301\301C\304\013\025Vk\327\3236'"
+	.string	"\217\345\007\300cJ\342\245g\311?\353\027\n\017_j\305\364\344h\260\273\316\324J\207[o;\201m\b\366[\002\207\371;\276\272\343\275\037r\244/\230V\230N,}"
+	.string	"\f\2665\343\300\314\356\206\317\306\312`.L|\365\333$\237\345ls\342\363\225I\334\230\230\001\005\203f\327\0039\346\007q\343\362Q\030\317\024\330,\312\n\r\016\342\261M\210O\246\375\227\276\246^\345\206\rz\013\223\270\213\022\342\263\350B\321\345\230\177\002\217]\265\226\227S~\376P\321D\375\352\234S\3268Kx\022\b\025\344\266\210\313\247\242b"
+	.string	"\221\242&\177\250dj\320\330\254\261=S\352\b\373\327*\213\355t\026[\267ih\224\366\204\210L\020Y\360\361t\fP\350\270\r\324Ao\035\021\327\215@\240\b\241\221\n%\334\246\225\214H\020i[gA\353 07\002u\332\005\216\353\264\314\333;S\316IQ\316R\265C/\315\224\023\365\n\360}_\353$0U\3651R>\240\362\013\025"
+	.string	"v\366\240Jf\231\266\301\bA\273\353\217\034"
+	.ascii	"c\307B\321\2504\300\245\025\356\237\032\3325\321\0016v\322\202"
+	.ascii	"\004G\335(\204<T9\025j\036\3345R\255\230\204I\006"
+	.text
+	.section	.gnu.lto_readRecord.26.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\252\002}\025"
+	.string	"\006\251\220I\320TQ:\344\251\201HB\360\232\341\310\002\262Td6j\230\231\370\303\003\344\364xU\223\301[\233\345\375\267\370\177s\343\361WU\304\030\3707\350\006B\211V\016lU\335\003z\205\201:\355\t5\006\r\251,!d\023\271S\n\177"
+	.string	"t"
+	.string	"~"
+	.string	")^\021Om\373-\356\202\307\256\001d\220\206\223\216G\023\342\325J\242L^"
+	.string	"x*\376\004<\335\022w]\fA\372\355t\371\257\213_\312\212\240\244\033\371|\370"
+	.string	"\354n\310\302\303>\034\374\016\004\261\2010\331h\337\311\006!=\250\354\373^\212\216H\230l\261\017\034\321\241h\264\315\346~-DB\2740\331z\2761\203Q\356\271O\013\266\331\234!L\255\325\263f\323p\227n\233\203m\006\366T\021\037\367\373\034\263\024=\263\364\334\365\214\306=\371\t?\260\231\344\347\336\340\305O\317H\235I6\371\232{\263\277eY\226^ \373\270\177\364ti\247E:\035\35648\247\3517\375\355\364\234\3237-\320\301+\2022Tk\2062I\325A\211N\330\346\361s\036O=\026\233t\275\316|J\030v \021\251\2254pj\005\247!,s\036G\341&\265\002\361j\324J\006\247#\\"
+	.ascii	"\033\307\301CQ\024\356\355s\207\017\222\n\322\230A\227\346\333"
+	.ascii	"q\351\376\310~\353@DI[\002\233e\213 \017:\032\236z\272\034\261"
+	.ascii	"\2114\225\020\241\240\361\355\315[\226\277\001\347\322\350\216"
+	.ascii	"l\233\313\270\021k\215\271\370;\b8b\255\365&\\\340\351\\:bI\017"
+	.ascii	"\007\233e\211\027\020$k\241\026\212\217Za\257\371\272\303X\371"
+	.ascii	"&N\275\323\232\257\235\372-\360\364;\243+\212M$\237E\017X\253"
+	.ascii	"\224\212\005z\305\345e\346\245\005\301\212\n\001\235;\245\202"
+	.ascii	"\263b\351\250T15649\253\024*\307F\006\007\225b\265P*\005\274"
+	.ascii	"\322Q\261P\021V+\026j$\353\277\272@\016e\027hC\341\270\317=\001"
+	.ascii	"\217\n\273!\3601^Z\013\266Kk\030\330\366|\265\326*\356M\\pgt"
+	.ascii	"?Lf\270\343\33212\3635qw~d\373\262O$\3415;u\033\252\323pA\241"
+	.ascii	"Z\007\273\346C\340\006, `\2421\206=\026\375+\323\t`\232e\332"
+	.ascii	"c\324\270\0061\325\210\301\037\021\376\253\225\037$\006\217y"
+	.ascii	">\366B\3374v\344\270\263\326(n\216\371\222\216\030\216E\344\311"
+	.ascii	"x\202)\310\3150\310Y\022\236j4\303Aq\364\025\314_\037[\305\200"
+	.ascii	"\023\317\304\006\005\037\215\002\261\373\220/\307\375eI.\315"
+	.ascii	"\t\017R\336\351\216\241Vl\006"
+	.text
+	.section	.gnu.lto_isEEPROMContentValid.27.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\332\004M "
+	.string	"\006\273\316J\220XN:\300\311\013\375\241\330\327\334\230\212\315\371\270\266\266\215\374A\243) \355\201\023\334\270uhP\217*\355s\037\242\346\355KC\333T\357\314G=\3243"
+	.string	"\020 \313\030-*\201\031\020`\020)\317\346\223F\b\331\204\310\235d\277"
+	.string	"\254"
+	.string	"\271"
+	.ascii	"\377q \277\272\221S\033\016, \023Sb\037x\024\203\310\313\004"
+	.ascii	"s\211\214SU\035\256\210A\032l\024\251p\276\264u\331\334\352>"
+	.ascii	"\204><A^&\342]2aC\314*\301"
+	.string	"K\2469_2\361\003\354\313\3637\373\222\0250\020\342\241\023\245\220\036\005#hD\273\227\230\353\032l\326\241\327\320\323\264%\331i\035\342\247x\255\206j\210\225\226\031KMG\311\005;T\020\3711\t\006\231ne\311\221*\001\353I\232EH7~Lb\"m\266\230}\021U\223\346\305\255\213\227\001\224\214\212*Y\233\336\347\213\247\307\244\030\244\314\275\367\306\327#%`\255\346\315\275\227\253Pi\351\f\340\314\214\305\314;\314$\215\314\036^\004\347\274\227\250\206\337u\257\234>\353B\273\367\332\212D\320\356\375\001\265\255l\370\253i\\\271z\034?\204\347@\352\336\337\205|\256\013\321\361\251^\362\216W/\344\331\227\307:\320\323\257r\341\033\177\341H\225\226\263[\2710\023\201\265\243\314\214`\031\343\206b\306}x\276\305\300\330\270rz\342\271\366\342\031M+\237\265\312\246Y\331\242\225\313\2632yVn\263r\265\225O"
+	.string	"'\345$#\252\251\245\020/RZ\227;V~\341\370\360'\376\3057\363\371Y\327bN\271\304\203\260M\013('\253{o\372\222\237U\2029}yf!\016UH\013\323h\037}\375\326\276\253)\267\376\3602\005*\332\314\023(\324\013o\355\341\211\250S|\205P\tZ+\027\256\365\315\311{\3575\215G\255\302V\224\270f\222\254\265\255\217j\211k\021`VH\\\303\364\021\363-\3618O\001\270\256\034\017\205JQ\253\304`m\373\256\312,\\\f\203\355\001eC"
+	.ascii	"\\N\216\270~\3612e\243\215\35331\322\201\3427Kv\331\326K\220"
+	.ascii	"\251\317Jl7\331\026\314\310\tX\323\270v\367\203_\2303\034\311"
+	.ascii	"\206#\0328\234'\354\313\332\004v\300\306:+\254H\211\354\250s"
+	.ascii	"\021H\220\254;\212\177\033\251-fi\332q\354[\347j\nQ\335\302\001"
+	.ascii	"\276\335N\316.\204\365\371\316\356\347\207\247\247\247\247C\231"
+	.ascii	"\246\246\201N\203\005643\005v|=\335\316gY7\323\323\363\371\354"
+	.ascii	"v8<\036\020#z\272\334\b\236\234\236\234\316G\"7s\200{>;_\356"
+	.ascii	"\247\327\363\345R\342\357\r\305\226l+\313\013\375\207\354\215"
+	.ascii	"\177@\346\224\345\325\374!\233r\332|\363k`\215\253\020\026g\363"
+	.ascii	"\243\234\354\001\237\212!D\250\021\204gf\237]\261\004\277\360"
+	.ascii	"\217<\004Ob\332l\022\314h\007\260\246%\2713IU\272\240\244Y\353"
+	.ascii	"\030'\217i\235\2532\001a\304\263\n\354F\312\017\262LZ[\327\372"
+	.ascii	"\350\306K(\232\nz\245\337z\023\236\201%g\242\343k\355x\266*'"
+	.ascii	"\031\367\376\310s^\250Q0\004!R\314\210\214D\"#\211Z\003\200\002"
+	.ascii	"\0311+\017\020pV\323fZ\003\326D\324\365E\244\250N\211\253\\("
+	.ascii	"\333i\005\032\245]\244T~\236\023\200\322<\npA\203\244\b\024\307"
+	.ascii	"\032\334\201\326\313X\333\323\314\315[\023\275\200Xp\304>\365"
+	.ascii	"^\253.Ux\351\273\353\t\247Z\340\307\271:\236\214\376`\300\342"
+	.ascii	"\351J\034\306\207\360\205\355\242Z\303\034f{\236'\217\211\260"
+	.ascii	"\3131LHF5\222\"\324rw\357d4\203'2\361i\326\272.\336\223\261\001"
+	.ascii	"\023s>\203\r\351\276\006}\252\350\212\315\276\001n\352\301.\027"
+	.ascii	"E,-\324\004j\2237\362F\246\024\342\036\027\204\350Q\035\217\177"
+	.ascii	"yqB\236\036\365\005\017\315\231$\347\221a5"
+	.text
+	.section	.gnu.lto_getEEPROMConfigSize.28.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\002"
+	.string	"\005\007"
+	.string	"r\r14`m\322\001"
+	.string	"9J\304\003\006\241@\212i\331\333$\334S\020h\272X!\232E\275c\224^o\272\216$\027A\220\022\274f\375?5U\256G-\331[\312\224\002\246.\031hm\252\na\001\243\240\201\324\323`\0222\217\262\030\336e\300pSY\257\001B\353Mq\337VA\251\226\217>\330\007y\274\374\220\0358y\354\316\347Hw\251"
+	.string	"\032\023\237\034y\262\330D\261\243'\365\302~[\005\331N\247N\024$\005%\273\021\243\224\035q\"\033\266;\366\344w\334\243\343\253\305\214L\022\205@\210Nv\343\263\\@\272k\017\220\356\024\343\327\363\362\377\361\306\0212\3012\317\263r\260\273N,\223\270\365\266\tl\033\330\256\b\t"
+	.ascii	"\252\244\2231Mz\303\320\006\013]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_findEEPROM.29.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\007\006U&"
+	.string	"\332E4\017H\200\232U:\357/7s\344z\221BYV\r\365\275\201\337\265\204\224p\235\365AV\366\207\332\233c=\203\267\017&\273\263\374\246\273\2717\216\301)\203\323P\261\tE'\360\b\\\265\207\230\307\322m\360l-\t\"\204\310\235d\340"
+	.string	"\323"
+	.string	"\343"
+	.ascii	"U\230i\214t*l\240\314\275W\016\216/\205\277\264\211Q\255\350"
+	.ascii	"AI)\361)H\314\264\243\226\371\005\177\352J\246\331\306$\177*"
+	.ascii	"\2064G\250Gmjp\314R+\316[D^&\017C\276\216\f\216\262\b\233\026"
+	.ascii	"\256\221\177\362\342PX\234;7\311\007T\006\365(\202\323V\205\263"
+	.ascii	"\366Q-\316s\357\0171\253{\221\r\330\201z\364M~|\301?\001\310"
+	.ascii	" L:S[\303\251\257{\2217F\376'=\252\276'=\332@Xf\177We)z\266\375"
+	.ascii	"\361\225?\227\020Q*\021a\\=e1\226\240\336E\243xF\bkb}\031\264"
+	.ascii	"2#9\236\n-\252\342\370y.h\332\262a#&\235?_|\234\371\325\255\f"
+	.ascii	"b\f\333_~\001T\225\0221\307\255l\302\275\227\255\022\221\351"
+	.ascii	"\274\236\231y0\363\rft*\177:\312B\271\\zt\247\255\030\341\221"
+	.ascii	"\240\035\343\267\355\017\347\360\267\234\213\216\377\304;\"{"
+	.ascii	"%\242\364\350\273\201\220\"\320\216\261\217V\363\277\364\311"
+	.ascii	"\257p\002\3328\354\243\305\005\266\346\3328\314\310\240m#\363"
+	.ascii	"#\004\tkr\377`\006:\224\377g\265\354\363\250\277\007\300j\231"
+	.ascii	"\347R\347\235\231e\333"
+	.string	"\251\3165\332\223\347\231jy\245YVi\226e\253\345Tf\031\235Y>W\313\255Z\2662\313\017\020 L\323\016#\263\311 \357\322\230\234\313\205b\0219\325/\365'\337\314\347W\035\213\357X\374+\005r<5\035\263\\\f\341:~\361@\341\254}\226\357Q-\004 /\323\255\276\206X\r\216\352\bq|*\374+\235\241\325\357WHc]\022c\246i\242\312\307L{<\001\230\374\317R\213\013X#m\343O\243\255\302\326h\377\352=b\3039\375\002\351\331\266f;,\006\371\302\2752\234\215\256y\303\344:\340\024\313\240m\344\277k\\%S\316\376\301<\335\335\213\342\225d\303\230Y\303\311h\031\332\240\336{\273\017x\375WW\3330\213\2005\017\214\235C\352\323<-\300\315\260\030\344\016\017\363A\2757\t\002\037\214\007\020\374\247\026\351Q\237\276\224\220( \226\243\314\036\367\312\327/\315%#\233\236~\326\021"
+	.string	"\227Z\272j}\253\377\234\256\256\206a:\265RK\fb\267\321\312\277\344\fx9\327\253\b\345\b,\025i:2\232\364\350\362k\033&\r\260&\260\312gJ.]T\276\036\2358\201\261\371\362'\222\036w\231\325\265\323\227\372\007\333|f\256@\220{\201W\342k}+\004\007\\\"\350\b\211\327#\022\352\355R\354P\344z\271#\005$z<\335\256\227\036\235\204\021\022o\b%a\264k#^Q\212\234\256h\250\310\347\313\235\320\331\330\001\004\t#$<\210\340 h"
+	.string	"\321\256\327\254\013B\301\353\035\355vBDECF<\335\315\250(\207\342\246\353\371nA\t\230w\264\353\335R\360x\275\033\r\t\374)\2435"
+	.string	""
+	.string	"-\301\t\330A\276\362\263\245\232.\265\215|\206\231&\005\352/\237\301\350e\345j\232\265\226\301g:\353+\217AL\227a\225}\226\323\230w\272\326\024\266\222l\330\223,\263h\226\352\347\275\367\312\332\270>1\273\240\265\346\363\244\365\254e0\003\365\251\216`\355Z\003\365\231\302#.\336\223\252\275v*6,\006Y+\225\265\332)\026aS\332\262\n?c!\355"
+	.ascii	"^\237\261dv\315\372\311\007p\250Q\030\304\230C\b\031B3R2\323"
+	.ascii	"\2441P\002!\304\322:\021\3605D3M\245\322\0325\365+*2\325\246"
+	.ascii	"F\3606_^\261\023_\261rW\223v\337^\312Zq\207\200\301\310pL\201"
+	.ascii	"\344<3\310\234\002\354\374\247Z\332\350w\340\024kF@#\013\276"
+	.ascii	"\021,\220\250?zK\"`2s\334dk\330\251{\226\315\377b\001U\241\224"
+	.ascii	"\353\371\201\333%\026\270\316\220\246\237\024iN\334~\337\336"
+	.ascii	"\026\266\r\004\304v\b\377\037\214\223-0\274\365<\271\266\022"
+	.ascii	"\021\355\302\203B\b%3\200\bW\323\005\351\333\036\266Kjr\022\317"
+	.ascii	"\273\213fW\354|\260U\t\021\022\267\215\351\234\252\360a;\247"
+	.ascii	"\276\326\\\345\250f^\231q\237H\024\336\200\034\337\263sH9c[\t"
+	.ascii	"\335[\344\241\372\255$_\313c\361V\267&\033\231@_%>c=`\337Z/\003"
+	.ascii	"\255xz\250\347l\371\235&\374\001"
+	.text
+	.section	.gnu.lto_loadEEPROM.30.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`(\007\355+"
+	.string	"\232N0\021HpZN:q\316\211\376\250\210\211\001Y\376\275Q\230(\210"
+	.string	"|6\005\023LS;'\200\305\310}\330}g/lU\227\334\237z\210\3041\355\003\221.\0047\301Xh\\5\226\374[\275X%\365tkD\032!d\357$\003\377"
+	.string	"\357"
+	.string	"\001\001S\276&\214b:\375\2609+\315\256\230X\237\nm\244]\312\323\325\234\326\250\255U\356\252\206\210\365\351\017\232\343F\250_\326G\313\271\023\372\331\241<\275\225\361l\265\305j\321\321\250\313\271}\360\264\203\326\247\335\276G}\272~\250>\355\233\315\350\006>\275\335O\335\300\226 \364\324Po\303\264\276\214s\245\206\227sK\304D\372\327\352XW\333\334XW\033\335\321\366\035\304P\317\t\002\177\354\352SS\024_\250\376\223'\030\223\003\243c\343\212z\316\017\264\251\033\034\222\364q \352\253\322Jr\347V\017\324\202^\035\334\335\254\356oH\322\353\354\201\365\312d\327}\350\260\253m\356\316-\036(\204\2711\257c\271\272\252\333;\020\351\262S&\275\236\3468\212\022"
+	.ascii	"\342\005\207\220"
+	.string	"\213\n]0\006,\315\327~\261\270\252.>\332\035\220\265ey\312\244\217__\206\234s_$W\362-|\367\tt\267W\267\332\"\3136,>\333\177\2048\234y\355\267\321\274\341\264\020\246\247\006\343eo12\b\313\331\352\310\276\334\265\020\241?\362\264\213F\365H\243\372\364\355\241\276\244\356^\037\355(\023%\217]\316c\223\357^w;u\361\262\373\252\336\363Hc!\335>\177{\367\260\267y\036\367\036\356\004o\353\274\371\016^\355\r<\363\375{\373f\201\267\327\365\266\357w[\375\335N\331\333\350z\033\373n_\365\366\0074]\301\263#>s\326z\302\311bR8\261\277\375q\177\363W\373\231\177{\265\373B0\241\376\225>\334\2614P($\256\263\260\021\361\252\3139g\211\2755%\351z w\b\265\033\217&\034\263\353V\353\333f\234J\277\n\216S#\3139\003\237\262e\230\242\221Q6\261\2722\274"
+	.ascii	"]\204\360=\333\214\2672|\332\234<\230\275\253d\204\247\302,\324"
+	.ascii	"\217\322\017\330\007\340\371|\342\335\205\232b\025\373\356\254"
+	.ascii	"\200\2408\305\277\n\3612"
+	.string	")P\\\341\314\331\305\030\363\244\225a\306\351\026q2#\234%H\2549\347\213\205_@\220\234\3614\315\356\031\2347f|x\331oR{\360\225ih\204M'\316\214\377\366\237\236\033\304,\3566q\342\036\331\203?\366U\205\243Z\330l2\304\217\373\317\361\020_+?\034\304\307h\031+%S\367\331\307\362g5\231`\246\226\252-\025/\033\306\033\364`\376%vM\3740\007b,\030s\350\277\260evg\270\357\244\3760V\367\017\347\370\222r;j\246\034s\376\360\231\277w\257\2018\203T\212\325\216\"\210\363N\352\231\037\372j\376\020\200%\327\003-Ru\3601-\f\325\325\373\327\276\272\261\373\312\253\223\302:\270\200\332U\234F\361.)\326\234\251(\364\271\034\r\365\217\310P\237\362\340\267\0259\223\272\317~\333\323=e\225\263c\336d\0051\214+\220>\030\217\214X$\035\225\202E\343\021/\035\025q\267"
+	.string	"RjJ:\026\r\035\215L\306\027DG\"%\005LG\"\246%v\005\222qh\351\250\350\353 \n\027T\\\230`!\bh@\221\361\210\273\b\364\"\351\250d4\016\025\031\261@J*\022\221\214\210^\020\213\307%\"\020\202NR2\036\211LIIG\"\260\225:\026r(\025\223\345)\221\302S\375'/q\327\212\345\340eW\360\002\356`\237\336\355\"\213\261\326\030W5POX\274\301\013\325\325\353pC\331b"
+	.string	"\323\363\021\334\301o\033|\250\262x\007\337j\311\324}\352xir\335: ^v\020\032\326\007\263F\322\037\016v\0071\020oH\303(\203\370\315\2439\347\374\363\301o~y\020\373\340\337\006Y\233\255\313\036\270PP4\3744e<6\247\301%+l5p1\366\341\025\0179x\270G\366oI\346\201\243\272\177\306h\315\231\352\310\356\0177\003\342\351\212\323;\244\0165\200\212\250!<&\221R\212\220\210\210\314$I\206\003P\0021\306\352l\003\020`H\244IaX\003\226dN1\302\020^)9_U\316 w)A\356\377\026\252\017\247~]\313\254\365\352\377\"U\321d"
+	.string	"^1\345\230\f\274B\347 \246\024\n\2733i\360\357e\022N\241\326\t\354\364\357jh\004\330\364\016E&\342\351Ti{>\2710\377[\0022<\355\025\002P\024t\363\032\002\226\242eCQc_"
+	.string	"dnY\244A\374\301\361\026P]?\362\266c\351\272\251\bb\304z\327\264NS#\323sIh\265q\213\215\003/\273\236\303f:\037\033\026\344dl\027\301K\002*/\355\r\270\226#Q\324\f\2470\262\374\033IU\004\232H\271q&-\200P\352\273\032\377\300\277\033o82"
+	.string	"W\237\232<\315\300>\225\272>?\fe\016]o\231\327\001\352{\353\270\320\302\212e\306\006\230I\217/\263\310I\305\020}Y\374Ca\200\235\023\222"
+	.ascii	"V\271{\351\260\326\002\330\377\t\333\241\235Q\307X\367\246SQ"
+	.ascii	"\333\211\036\031w7\3332\324}\323W\017\177"
+	.text
+	.section	.gnu.lto_writePadded.31.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\310\001-\021"
+	.string	"\306\337sH\340\322&\035\240\325\324\003\026\315\371\020\00416[\327\276:\354E\002F!\245\214,\353\250\201\377\372c3\242\276\327\2533\002\236'\362z\364k\241\216\216\343\304y`\001X\203w\fQ\244\361\355>5\324N\364\336{\313\224\002["
+	.string	"_"
+	.string	"]"
+	.string	"5\246\203\250\3260\201S\266O\207\233m\377\305{l\314\222!\n\220\264\303\223\023\024\244\326\220;}"
+	.string	"\375\224\027@?\343\316Y\227qY\376g\227-zf0\260u\371\341Q\032\300Q\203\005\t\350\222'\"J\b}\366\325"
+	.ascii	"\342\354\2128\250\265za\240\316=o\373\201\355\013\366\222\002"
+	.ascii	"1f\337\347\337\036\376\3642\240_\322\365\322\365K%:7\032\314"
+	.ascii	"j\355P;\2526\346\f\236\313>m\374\231K\246 \224-\233\331Z\036"
+	.ascii	"6\241\034\027>j\r\017|z\302f\342Ay\017\304\222&\325eB\205\204"
+	.ascii	"\030*\372\270\007\001\223\352\372\341\020a\3734\205@\355\332"
+	.ascii	"\207\361\0306\017k\036\240\006\316\320B\017\373\364[\350\247"
+	.ascii	"\214\177\2558\032Y\031\267H\243\355a\330\303|z\305\226\001\320"
+	.ascii	"\214\026,\332@#\326P\032W~v\270v\210\227&d\306\313~\272Y#\227"
+	.ascii	"\324j\265\243\317\320\307\0317G\016\210\370\031*\343\243\b\217"
+	.ascii	"\327\b\234\255\231\004\310\322~\024\3255\262\303\326\306\023"
+	.ascii	"\366e\r\035\315\n\202\252S\251R0\244\216f\025#S2)\225t\312\002"
+	.ascii	"\225\025\025\005\fRP\n|\235K\252\373db6\263\240\270x\037L\327"
+	.ascii	"Q\260\260\252\360\342\261p/\253\224\013\307\362\305p('\366`\272"
+	.ascii	"\217\223\361\274\217+\205\365\262\306\330\214*$n\"\216w\b\224"
+	.ascii	"#\273\3612N\324\202@G\255\257\303|\332\207V\362)>\003! P\"2)"
+	.ascii	"\347\001:\235\251I'\3304\2044\3141\313\275K\226]A\263Z\260\032"
+	.ascii	"\355\266\213a1.0\033\253\217\247\304\320\303\340\262\223\230"
+	.ascii	"\346D=\013\200\230\203n\205e8\370'\n\260\341\255\312\362#\fc"
+	.ascii	"\\N\305\347\273\013\310\006\255\"M)\f\024"
+	.text
+	.section	.gnu.lto_writeRecords.32.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`-\017\245O"
+	.ascii	"\272\206\250\035R@P\312I\007\333\216\253\254\374@\253\314\275"
+	.ascii	"\255\252\255\353Z\f\277fT]\322V|n\370\341?\337\316\317!s\250"
+	.ascii	"\275\266\027#\352\343 \305\363\211\023;;\037\250\275A\2217\004"
+	.ascii	"u,\326\307R\334TzS\3527\360n!\nM\367]\323\022M\b\2212\311\307"
+	.ascii	"\001\256\001\276\001Y\2524i\271\243\322\264\353;\021\273\276"
+	.ascii	"\315q!\366CL\260\025\267EVk\365\335\\+\253\226\261f]@\026GV\227"
+	.ascii	"S'<\371k9\236\006\365c\254Y\247b\206\n\257\356\346\217\211p\357"
+	.ascii	"\303^\312\325v\020\002\361 t\374\370\204V5\324\007\025\226\022"
+	.ascii	"\320\2339\3743\373\201\004\037\276dI\326Z\231\304\204\373\036"
+	.ascii	"\366Q~H\204\273iP\257SW=\253/W\206G\313\261\353\273y\356\352"
+	.ascii	"\330\237\255\357GDx\263\024\335q\205\242\241\035\223\265\032"
+	.ascii	"W\334\\\017\320_\013\302\222w\021P@\307y8\341\347e\352\310\254"
+	.ascii	"d\200\336\374U\t\231w_\366':nL\341\300Z\213\310\251\325j<`\213"
+	.ascii	"\320\233kD\337\344d:6-\215`X5F\200\240:\253\253\325Ht\342<\347"
+	.ascii	"\315\362\301\363f\033\351\016\356\251D\210\024/J\204H\371\362"
+	.ascii	"\322\370\345\351\364=<;A\035`\016\316\215\315\317W\323CiN\263"
+	.ascii	"lN\367g/\231\244\225)b\355xOI\323\303*\311\221WI\312#3\311\265"
+	.ascii	"G\221b\036$\337)s\256\304J\027S\034\234!\353\310u\220\007\206"
+	.ascii	"=\247\004`\213\226%G^\205\225B1\020\371\341\310\0170v\005\306"
+	.ascii	"8\003xe\321\360\233-\266\031\302\277\030\330W\252\030\273\202"
+	.ascii	"\201k\312\240\020)^\316\302\213\222\027>v\365\002\367J\025I!"
+	.ascii	"\310<\314\007@^q\225<VI\212\037\273\022\302\250W\226\326i\220"
+	.ascii	"WZGR\361\331v\b\214\264\205\361\312:r3\310\3132h\213\r\310\r"
+	.ascii	"\026\217r\bN\206\271\253\235\253\260zp?\312M#W\302xe!9\3234P"
+	.ascii	"k].be}}\276{*\273\333\303\256M\217bw6\330%Q\264\212\006\340\214"
+	.ascii	"\n\357\312\315;+\357\301\221\251\362;\352\200\024\352\037\177"
+	.ascii	"\265\327\200\335u\331%\005\310\373\214\023E\0135\320\024*-\251"
+	.ascii	"}\340vOh\255<\214\366u\025D\260\027\203:o\242\350\237\311\225"
+	.ascii	"Eq\336\236\210\233b\274\352\020\357\301!auF\fP\177\355'\324~"
+	.ascii	"\026\216K^k\255\335_K\206F\001`\265N\275\270G\342c$(/vs)\240"
+	.ascii	"q\276H\343\274\371\264\247\217\362r\211WU\362\364\274\331atE"
+	.ascii	"\361\335\362\221\013Y\371n\327(\305\375\265{\2348<\264\355\""
+	.ascii	"\273@^\031@\336\030A^\030@\336$\006~x\205@^\244#\243\033\377"
+	.ascii	"\027O~\213\\\234\207\237(\310\273\342"
+	.string	"\207W\305\341\276C)\200\274(\200\274BA^\023%o\211\263}\203\236\366\005\372\271\231\331\267\307\207\227\307\207w\307\2077X\362\352\364\360\002yxs\202\2748A\336\033 \257\r\220\367\007\344\365\355\360\326\004y{@^T\207\227F\207\367\004\362\2329\274e\311\333%/\343\360\276\001\235-\270\2442\265Z\345%Q\337\314\265\032\236\374\335~\270\237\355O\373\315~\356\376G'\3340\353\373\211I.\375\370bw#zD\223\021B.\261*q/b\b&\211\013L\016\030Dn\210\305.n\230\345^D\370\226}\227#\256\"\\\200I\270\210\240V\227E\270\327\262\177;\222\r\316FY\265r*\0174-6\324jd\362\305\215\t\2556X@\345\226\254\365\352\206\243p\333\324\330v\nZ\333\213\240YD\240\362+MV(\330\232\253\0227}.r]\323ef\366\263\351_\267\027\233\376\024\035X\353\327?\013\343"
+	.string	"\200\214\335\371\372k}\215\366\351\240\310q\013\034$\215!\025\342k\002\344\312\326\n\026\037Gj\372k\227\316\242\376\330\316qLQ?\371\023\bpM\003\rI\271\370\305\242>\321\353\232>\317\250\360\320^\037-,\314\017\344(f\361\330\200\220\365\316="
+	.string	"\347\223wx4+\332DW\235p\022\365\275\240\200\2719\272\241D\3766\203'\256\326j\324gE\272\026<\324\337R\334M\277R#\374\"\3329\272z\364\216\2759fA\232\b\353iEq^\211\322\364\212\37698\317\246\351\240.S[Rg\237ten\377\020&`u4\375\365\273\013;i+\017\n\333\\\334\031\244\026\356\003\\|B\352K\t+;\302\2109\030G\376\226\"Y#\030wr\3113]v\311\244\206\361\373N9ctR\377L\231\302\223*\342f\0310\3579\241\223\223Q\303\337\322\033~\344{og\256\354\222f\036\243e\364\317\030*-\251M\225p\217tI\214\276YX\231\227\233m]\336\203Kr1{7\325\341o3\326\310\004'yE:\364\005\234Bm\366\325\312\320\246\266\322\035X\306>\217k\272\303^l\377\2266\331\363\251\223\363f"
+	.string	"a\311\233\343\023\344P\037\356'\312~\017uw\231\302\241\273\354\0075w\367\247\306\204\232\233f\314n\372\344g\034@k\255o\026\310\337\307\321I\327Zw\234\375\265\\\036\340#\273+k\026/\321U\273+4\350\212j{\351\304\2536A\226\350\377\360\rJ\263\2778\001'L\300J\013N\025\335eP\334x\260\2315\206\304'\034P'\024\324\220X\243\206\022M\r\342\323\322\220x\2320\254\341$\301p\004&\020\236\2107~\033B\213\0339\236\2106: \016q\f\233\224\210J7R\fQ`\302\300\306\220H\203\303)\307\323\214\341\222\223\022\016('&\033\033Cb\017Q`\202*O\030\301\311\202\032C\033NJ!,\371\266\310\b\351\003\244\004\216\212Z"
+	.string	"\021\207MJC\"\016(t\227Z4=\021o\f\207\035\330`\002\301\351i\211\310\211I\251\211h\211\bE\324Bh\237n\f\211D8\236\236\210D>c\324K\236\237f\200\201F\352\212j\251\375\331k\326\206\244\365\364\327.\360\302N\212~\224\027`\206\227\002\032\275-su@]\265\345\216\213\376\331\321:;<>\335\177\272jY\214\006\312G$(W\205< \b~x\375\244\335*\016/\215'\350\323.R\364\323\fx\360\004\352\024} \333Q\t\357\364\327\276"
+	.string	"\243s\324o\373\020\r\346\212\007u\325\352\364\364\226\346O\373tU\211\016\352\031l<\330\314q\270\331\0061\337\275\f\2267>\035\206U\0064\352\236\243>\033\213\007\365\021\360h\325\244g\033\210\342;\3261\352\233\3714O\033\365\247\266\244\f8w\232\247y\212\f\016\366PK\245=\370\305\235\026\352`\227c\250\360\326\\"
+	.ascii	"&1\372\364\214\001\366b\205\264\212_\334\023;k?\244`\001SCN\177"
+	.ascii	"m\n\347\2135,\306\233k\023\203\303T\326\352%\343nA<!I\036\360"
+	.ascii	"\346\266j{-N\335\377\303\313\307\215N?\007$\316\351\241\006Z"
+	.ascii	"\245X\374\242N\223\3205\325;v\231\013\203\037\274\225\006\271"
+	.ascii	"\t\354\322\210b\013Q9}\343\211\033\025^\227\0219\263\301\351"
+	.ascii	"\233\266A\342\364\3110\f\251\013\001\201?\250q \306\230c\206"
+	.ascii	"fDd$I\2224\006\021\005\204 h%<\017\021@\275DD#\222\024\244 \225"
+	.ascii	"\341F\253\257j\016\241j\246:\324r0\347URj>-\252'H\350\025H$\250"
+	.ascii	"-\247\227G\320L\262\366\334\265\255\267\363\242 E\316Dv\265\177"
+	.ascii	"\f\211\363>"
+	.ascii	"\300\312\215\200\251\017\305\301g:`I\303x~\2166\303\315(cC\302"
+	.ascii	"\027"
+	.string	"\240\027A5\332=\373\361\307\340\251\221\035\332\332C\262\016\333\016Q\035y\331&o\251\372.\342\212e\276\371\2412M/\240\253\001\255\232\\b2\331\316\310=/nD\314\237\023\002\035-{@\244\216n}\257\366\025\243\243\3736\364\264\216\300\341\267^+q\005H4\nD\355\235\241M\270\013<r{\261\275\303c\201\303\266\"\3574\211@\204&e@v\304L\234\027v\231\017\032?\263\316\352\254Z\320\255h\223\305\303\017/p\242\261\265\300\316H\310\267R\376\021\370p\275\202\302m\373\244?\0322\244`\230A\313\351\017/fz\265\206\237LjJQT\334\323c\004\366m\003\233\032\006qD\331\334\256\221:\315\346\365PH]\220\264\21331\200\254F\t\274\320\374\217\023\032\222\r\205\003t\255\357\026\351\326e\345+}\020,\345z.'\273[r\264 \214rk$A\b}Ww-*\354\354\327\262\024\307\213"
+	.string	"7\370\213\026\265'\326\254\201a\357\230=7\315\216~{\355\377\013\002\235\3268\0176\347\232\302A\371\240\017\332\351(\264Y\211\301\257\351\262\304\2604H\360\313(\347\245\357\267\025R3\337o\301\013\223\223:\206>\215w\342\032$\"\327t\327T\201\003\330\212\201f\274\2779\216\205\023\340\227\213\027\210\271\321\204\236\323\fC\024\217\323Zg\320\233\371]\t\353\316\334\352\374\245\177\\\321"
+	.ascii	"\234\223x4\357\320\272)\326\322\334NdQ\301;\030\226K\205\256"
+	.ascii	"p\224\276\364\376\306\030#\270'b\355\377\236\255;S\301\220\t"
+	.ascii	"iIM\007\364u\256\312\303^\003\f\257\346X\021\30000j\3778!\242"
+	.ascii	"\241i\334\217>\351\316\247B\231\327)\334t\357\267\350\002\212"
+	.ascii	"E\350\206\366\025I\001\204\330\261D\036\213\017s\016\020\240"
+	.ascii	"\223\t\324\277V\036p\225\331z\307\314\001\356\035\377\016\251"
+	.ascii	"|\017\032\314\341B\316\343P\341\003'^.\013\305\251E\200\241\250"
+	.ascii	"'V\245\177\330Qe\214\205\262\230o\2329*"
+	.text
+	.section	.gnu.lto_writeCommit.33.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\033\001\315\r"
+	.string	"fZ_E"
+	.string	"\2216\035\360\376\362\367\207\024\001Q\001\031\270\217\325w\252\021\330\327\234\250\f\310t5\267\242c~\207\314\373\311\310\370\242\022pw:T\342e\250\3712\036\211\301\017&\211\300\211oroS\216\274\355w#[\246\024I"
+	.string	"K"
+	.string	"K"
+	.string	"\027=\234\300\256JL\215]\321\201=\363\230\305i\333w\361\027$\227.q\345\004\200\305\204\b\225\314\256\270!8';v\275@vL\252x\351Z\362?\376j1\203Fx2]5\021v\327\032\236H\334\362\266\027\330\266`\377$&\3322\247D\313\fk\225\207-\232T\246\260\177\255T\261\255\336\\\3745\227\372\332SP2:$\330\330=i\365\330\033\330\013\213\247~\233\344\217\3264\034\037v\252dn\313\204\021'V\273(\r\216\231\302\324`>T\355\303\270\013) T\bi2'\005e\206uiw\037?\0011\273\373QU\310\n\240\276sd\217\361q4C[\304A\037^V@\201\220&\353\213\013\314<\203\314\366>~\376\314\035#\n\342\253.c\304_\341\217#?<\246\357\220\0353\300\262\n\031\300\217\353\300\314\236\017\b\003\350\001\004O\347"
+	.string	"\330y\241\016$\031Ms\035\357\003E\272\356\302\006\221\206\220\217\333BD!o\343\300\321\326I\340O\244\0037\222\357\0037M\334\333D~p\311\265\213\002d\225\322\226\007\350|I\301\212F\332!N\037nd\026"
+	.ascii	"zv\246J:\231\026aX\327\234\250j\210m\026\0311X\021\327\b\301"
+	.ascii	"B\257\366\215\2541@0\345\242lqM\214\322B\243L\230\214\"\233\250"
+	.ascii	"\202\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_writeSettingsToEEPROM.34.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\311\005=\""
+	.string	"6>\331H\220XN:\301\017/\343\215\225\217\275\312\013\207\343\200\224\222\223:\306\274Ly\204\243s\030Y>\370\244}\33363u\002v.4\257\372\303\257h\250'\031`4\005&\375\347\274\350T\245\301\371`i\231\265\204\020B\244L2\307"
+	.string	"\264"
+	.string	"\312"
+	.ascii	":\261%*\240\234\260-\241/\277+\265Or\343\352t:\220^\274\022\251"
+	.ascii	"\207\261 kV\261\376D4Q\263\372\200\276\344\372\036\363%\320y"
+	.ascii	"\314\227\272!H\273HR\240_\261V5(3\003\023z\271\032t6\220\230"
+	.ascii	"\017\226\006\270\0316\260+\265\026\031\254\021\372rw\267\001"
+	.ascii	"\004\251M_$V\235.\274\250\226\260\325Z,\352\034O\217CO\263$\233"
+	.ascii	"\323\3759\001\254\254\314\360\352w\0349\344\005\210\f\036\255"
+	.ascii	"'^n|\201\037VZ\214\036\250\365\223\352\207U\026\233\344\002\265"
+	.ascii	"(hvWTdO\025\217\241\220K\254\223\271+\254\367\356j\212\004\252"
+	.ascii	"\265\336x~q\025d>'\324Z\227\207W0\276\271\357\356\326\3562\355"
+	.ascii	"\226A\0027\353}\f\224\020e\275c\001S+\360\303\275\223?I\332{"
+	.ascii	"\275\\\245\036\177\370r\3373_\276\005\254\021\n\t\362qm\244\234"
+	.ascii	"I{\247\246O\2170\212\231b\267\335Y\333\361\305n\344\241\303]"
+	.ascii	"\023L\374"
+	.string	"\341\002M\365ow\264\244\365`\241\265\255UN\263[\374qs\355\276\217\307\343q\033\307\356\362\006\035\354\367a^\236\034\357\016\312\253\223\343\315\301\361\342\234\274\273\345\275a^\033\224W\307\274\271\222\027\207\362\242(\357\211\362\232\314[\232\274\344\311\333&/\227\274O\200\200\255\006\215\256\035\375\245X\253\216j*Z)\245\307\227\374a\347\335\353\214H{\261\375\330\352\002%R\264\326\272\342H\356`\013\b$-\302\037\332t\371\325\366\2453\203\330\266\0264$-\302\363e\200/\226\036I\223\334x\016Zhm]\252 k\275!A-\214\217\373\303B?Y\013-\002\374w0O\3661\n\007\210'\253`\301\346,F\332\361\003\314\335\013\037K\332#\001D3;o\271\326\365\311\034l\355\271\244\351\372To\270\316\365\321z\267B\334\222\245w2\"\026\\\377t\021\n\t\216\275\214a\306\266F\376\360\3201dh\201\006"
+	.ascii	"\227\215\366\006\016\302\376\355\331f\243\3752a\215*\275#*g\227"
+	.ascii	"T\314>\331e\277\214\352\255\233\233\354\013\277\202R~\326a\357"
+	.ascii	"\265\036@\2000_v\343\262\336\334\004\312\250\336\200|\334\r>"
+	.ascii	"\036\t%\336\t\323\307kR\342\371PD\241QQ\274\245\245\024Q\347"
+	.ascii	"\032\035E\030\021\341\001\222\021\221\017\t'\036\024\224\222"
+	.ascii	"\271KDMO>(\036/\311\004S\t\247\247\245\"'&\245\246\242%_T\021"
+	.ascii	"\221\201}\202\342\371\212P<=\371\212t\305\372\306\261|\n\235"
+	.ascii	"\321\241\363\364\213\335\rj `\007\227E\030O\007\365Q\262\326"
+	.ascii	"Zq;\235\243\323;\375\263f\323\256\033S\035G:}2]H\200|\\\234\336"
+	.ascii	"\247\351=p\313\351\013\203\004\371\270\273\306a\333\365\305\302"
+	.ascii	"d\001\371\330;\345\b\021\"\332\\o/gi\314\234\315\265g\362\233"
+	.ascii	"\376\017\243\030\005\274\233\366H}\360\2077\235\264\025\354\337"
+	.ascii	"\211njffs\t\335\246\331\315\030\206\317\214\\l(j\25018\306\220"
+	.ascii	"C\b\311\310\214\3100H\n\215\001\240\242\221\253\331\001\020@"
+	.ascii	"\210HH\222\244\003\266wR\237\034T\370\313L)\245\031m\202U\022"
+	.ascii	"\032c\032\231\220\214/\224\321\001v?\316\223s\3619o\016\t\362"
+	.ascii	"\345S\316C\277\302\020GIt\207\275\254\347\025\032\227\303\336"
+	.ascii	"|\330\316\344\262wW\356f\023\2165\364\030\240ShP]\t\n\263 \032"
+	.ascii	"\353!\007O|H\266A\033\336\266\321ju\2175ZhM\345p\304\215cA.6"
+	.ascii	"\225B\027\350h@\2412B\bAF\207)\236\304F\26632\332\344\037\374"
+	.ascii	"\002q\233p\310}\216\020\236\b1S\302D\362@\241\032\222\334\301"
+	.ascii	"N\322\004=l\026\256\270\333\\\275\314\307\227\004\374#\372\177"
+	.ascii	"\201\026\\nJ\337&\320\216\345\376\021\200N\374\320\207\340\333"
+	.ascii	"\202\371\003"
+	.text
+	.section	.gnu.lto_canAppendSettings.35.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\371\001\355\021"
+	.string	"\326\343zG\320\322(\035k!\274\003vC\316\\.\314\231\tUb\266\242\273\302\007I\212h\006\326\270q^<W\210?M=\324\257\007\033\250n\263]\003C\350\224z0\252\336\252\250\232"
+	.string	"\230\007\217\004\272\355S\377\t!\233H\231Rh"
+	.string	"^"
+	.string	"g"
+	.string	"\037q\022\263\377\304\270\264\353\301E\320nhb\024\360Q\365\021\357\261\273\210\367h\333\006\020\314L{\310\223\363a\340q\003\024d7\\\351\207\323\036;M\232\377\334\243\215\026@l7\231Gp\303;\325\356\232n5\251]\001\242\027E\250\033M7\222\023\302\366\334\023\3476\223\3711\330]\247\355\246\341\366n\033\202\355\007v*\bGv(\223\272c\277\333\335\265\352\330N\247\376\363\243\216\273O^\272\3444\350\245\277\230\366b:\306t\027\323\032\323\331\245/@\244\006\216\006B\2739IB\366F\204!\342\270\337\236\3719\233L\265\024\333~\370\022\263\343,|m2\224pz|\020\355\206$\217v"
+	.ascii	">:\004\001\024\245d\332\001FDA\252;\3664\252\376\344\206h\322"
+	.ascii	"\310>\213W\311\216\025-\236\352\320I;\215z\224v\232:n\220h\234"
+	.ascii	"\364\270\253jyd\325\324\223\346\017\233\0163*^&<\273\265\333"
+	.ascii	"|\024O\341\362}\036M\341\365\362\036Uu\3105\3657H>\320M\304\370"
+	.ascii	">\206\301\344m\217>\214\367x]\320\303\241\226I\316\030B96\003"
+	.ascii	"2Y+\306\302\262\362\031%EE\202\312\201\004('\003Z\027\\\262\316"
+	.ascii	"\254\223\027,\366\322jEhqMp\201\261V.\256\225\327\212\025\223"
+	.ascii	"\255N\b\030\366\322\212\255*\300`\261\225)\334\253\216\263#y"
+	.ascii	"j\311K\212c;\245\252\232\316\270\244)\275\027u\347\n\002wbFw"
+	.ascii	"\232\007\366\b\220\237\236\324f\265\3626PU5*c\224~\372\311\370"
+	.ascii	"y\002! p\2422\270\033\322}\251\351\032Y,4\376\374\275.Rc\n\023"
+	.ascii	"\034\200 \343\n\020\003\341\023b\262c(\033^D\276\244\203\250"
+	.ascii	"\r\363<\270a\371\357\3467\361\346\242\305\275\001[0\377\304u"
+	.ascii	"\211\362\025\007\226\306\250\321j\314a\207\254\265C\001"
+	.text
+	.section	.gnu.lto_writeConfigToEEPROM.36.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\204\004\325\036"
+	.string	"\346\270\304K\260\226Q:,\020\375\340(\302:BS5\225\237\356\253\335\223\332\310x\206\342\201\3053\350\314;VG\265\251\244\340\370S\333TBn\350}\006\257/\266\013\2475N7\024\246)0D\3749\2368\361\242\242\241=i\204\020\262\345N2\263"
+	.string	"\247"
+	.string	"\254"
+	.ascii	"\305+!\316\223\263\307\312\223\366\003\312\223\365C\016d\027"
+	.ascii	"z\243\351@1\311\017H\207\363$\032\244\206&B\356\277\0253]\360"
+	.ascii	"\016\321\024\245~W\367\006cN\362\314y\222s\314V\036\244q\177"
+	.ascii	"\344*5ru\357\245\365\f\356\333\340\331\254\271\243\255\323,I"
+	.ascii	"\3335\307G{\272\243\t\224^\034\275u*\242\030\300\323\006\240"
+	.ascii	"\"2\262\016\204\252\271\243\350\345\211\257F\242\260\nI\257\350"
+	.ascii	"$\214[\213`\311w\204\365\202\354\314\311Tz\247'\340AtT\333.\270"
+	.ascii	"\242$\013\254\307\302\306\206p\354\016|\345\365\200j5m\356\275"
+	.ascii	"\\w\275\027g\327\231\031\212\231K0[\r\001UX\200\335L=B8%\250"
+	.ascii	"ja\2632\343P\324\357\336\017\222\200Z\3071_\222\243\325}\372"
+	.ascii	"\177\002|@\276\242|\323\233\350\250\343\247b\361\201\347\340"
+	.ascii	"\243q\264\272\025\2139\250\253\315\304\374\307\330\022\005\n"
+	.ascii	"\367\0223\214\354\302s\354\3033\354\277\363\313\353\225]\257"
+	.ascii	"\214\276r\353\225\3177\235M[\271|e\362\225mW\356\256\\_\371\006"
+	.ascii	"\032\330@\222Q\343\330U\301;\224\265\345N\221Kr|\370\013\377"
+	.ascii	"\337\337t\313|\264\t\221]\250\324\220\215\025\244\256~7Fj\370"
+	.ascii	"A\276\023\273P$'\362\"\271\013U\314\202\202\267w\013g\033\002"
+	.ascii	"\265lf\020\"\352wgS \273\354\247]~j\026\277\264m\262Icj\024s"
+	.ascii	"X\333."
+	.string	"\253\244K\200j\326\031\245\307=Z\365\275WW6\323\006(^Z\264\262>\360\031j`\245\305\372\247\2774\2179\346\037\336B\322\017\361\326\207\322\375\260\343\245m~\356\275\227\224\365\177\237\325n\346\033\234\372\235\254gA]\273\273\032\205\220\200j\026\303\352\241\316\\3Q\277\253\375\037IA\255\343WT\221\214\212\213)\333L\254\242\214u\217PJ\315w%\326\027~\346\252\f\316?Q2\357\330\352w\261\316%\261h\035\337\351o\301\204\013\025M>\267\235\232\217\017\216YK\241\203\2638\\-'\007\005\316\344\031\t\023FL\200P3#S\200\004O\355v\303)9Gf\307\326s\253\325nL\350\224\340\261\345\320xtpvh9=8\232\214\002\266\335j=4\037\233\255\207\346\n\336\367\222\315O\003\241\225<\207\222\331\303\207\372\035\243QF\252\013O@\253\2265_m6\317\354q6\023\003\020R\302\364\211\327"
+	.string	"5\224\026I\036\333\362\324\222\026\311?\375\325<Wc\230\202v\253]m\271\244F\257F\217\352\331X\302\272\325\366I*\204\364)\275j\305bX\177xk\302\364\207\23718\254a\372BH'\376C\242|Tg\277)Y\250Q,\344\230SJ\211\004B\022H\222f\r`\002\031*3\017\020Xf\265Ik\326\202T\370\362\252\230\215!\025k\302\025\327p\3460><d*\263"
+	.string	",s\344\272\b>\022eAC\354*\305\300\256\364\232`\322\002v\223[\003\315\361pL\252{r_\270\303\034W#\346\207\360\022\306\327\252\tY\302\177.\222\007=\264\315~\f\245`\272C\001\305\261Xe\256\200\257kU+%\237j\032F\261\325*\255\020a\330\013%)\366\3459\222X\013\222\374~BTg\232\333\345v\326\372l\212\200\207\3569(\025\364\366C\321\242\315\304\247o\306D"
+	.ascii	"\325[\367\345\006\227\24191\255m!\363m\350\261\351\232\311n\264"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\006\003\025\020"
+	.string	"fYaG\340\3206\035\206l\320\300\363\200\347S\376\202\007\266\006\023\223j\231\016\350-P )P\003\324\260\022\310H\340f\260Np\250\037L\230a\2066\220\034\020\244GFFFF\306\030\370\270\267\036f}\322{\372\264\244\245-eO"
+	.string	"Q"
+	.string	"L"
+	.string	"'f\370\264\364\207\364>\017,M\222+m\242\262\202\245\270\320\237\326\016J\217\2344\211\354d0\2236m)\330\307q\034K\332C^\265\326J\322\245\004#(\330w\031\007\204\251\303vwV\317\373:\354\366n\211\217oP\254\225H\207\310\335\275d\323\233\2413\370\3203\034iA\234\220\242c>\023\231{jpX\361\3533D\300\361\033\350\227\233f)\320-\004\232f@\237l\272\246\246mN=C\32303\035\303\365\253\273&\231Va\306\020\324\202EL\237L\326\250\001\246E^\032D\272t\311\256\002\374\020=\365\266\324\244\007\020B\004j\364\231\212Y"
+	.string	"=\003\276\007\375\006^\333\263\220\031\305Z\231\3506\376\300c\331\212\241\002hjw\0202\223\340y\261\241C{\203\220\237\223AD"
+	.string	"\355\013D\336V\317\205\017\253]\201\307\257\265B\270\366K\n\371\300\b\035\031!\3347\221r\027y\033\334\263\024\227`P\360\tq\237 \237\\"
+	.string	"\351h\3349\265q\357T\314\022x*\240>F\357B\2269A4~@F\247 \177\007E\204oG\347\0207zN\305'\321s!\277DO\3057 \220\002\251\252\253\003\006\032]\351\035N\323 \273\263\017s\030\007M(XC\347\n\366\307\364Qh\013j<\030\307\037/s\274Ov.p_\271r\016\303z\b\216\300\0218"
+	.string	"\007\340"
+	.string	"\034\200\003\340p\001\271t\351e\302 ,\211@{\006\021f\214\004\023\204i\354#R\252Y\t"
+	.ascii	"qj\001\361>\bu\234\334\310\302\240=\023^\t\0326\254\303\363\032"
+	.ascii	"\275\3714\016\037cY\031"
+	.text
+	.section	.gnu.lto_.refs.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375 \205\025\003"
+	.string	"\202G\025\036\260'\215\001\200$I\222$\3400\f\225x\335i\203\301\f\315\314Z\262\357\261\211\224$\311\024\332H\353@\023\006%\343]\224\036\336\302-\340=\245\3465\267\340\230\250\022\361\0326`\242[{/\227D!i\215\240\317.f\245L\267w\333*^\345\265\322D}\004\003"
+	.ascii	"I\220\264]\274oP\240"
+	.text
+	.section	.gnu.lto_.decls.351c066418d6dd30,"e",@progbits
+	.string	"(\265/\375`\026'\375\255"
+	.string	"\272\r\265;[ N\271\244t:0\217\372\200rw\367\261\317!:\210\002\273[\216b\260G\016\tHC\001\005\024.\356s\030\351\362\006\3226\3775\257(\320\024\263\376-g\035\201\276z\233\334\005F\035\263r<\254\034\227_"
+	.string	"\266m\370\354*\224\001-\307\336\255\336\354\233\030\022\353\324\372\275\245L\0010\003\237\003\311\003\234US\247L\226\324\215.\034\206\301\260\027\236\343/\374d\272\363\026N\2572IW\257\234\250\321\221(\037\323q\026\316\352\035q\356\020\032\r'\035sa\271\232:- 5\005G\327[J\357r\207\346B)\214\303\316LU\214f\215\236=\313=\013\304\275"
+	.string	"\340\215%!\203\321\366\276\363\f:\273\245Sz33\243\t\213\2678\2247C&\267\302\351\206\236\317\320\016\244\240<\034\206\202\300\031Xy\343a\245Sem\335\322\344\275w\247\275\264\304Q\351B\317TV\274\325\226r\261\026\025[\023\006\203\201\214\251~_\027k\365\2169\367\302\230\342\2747E\3436fc5\256\302k\374\3444~r\206\302aI\366\3424N\302_lF\003\002Te\\$\215\2430\0256s\302\271\311$W\340\356\275\0348p\340\260\303\201\303\214\211\246YT\317Z\375\n\007CJ\024\252\336\340\356M\317g\374d*\337I\357=\003~\037\025\026\343)5\345q/\f\035\002@\256\231\3402wo\312a\003\0166Y\252\260=\355\246\224\365\274\322\031Z\3322\231\214S\323\030Q\022\312O\226r\031j\356\345"
+	.string	"\3452\305\204\313\257\374\347\321@\261!\305G\350\231\bm\036\027\234\240ipQemOD/DY\t/\341\247\007\314\344\214\204\275\036\203Lo\3327\300l\035i{ z\366`W\353\352\330\203\335A\240\315:;\034\316`w\020\240_\001\325\212\271\022\333R\246\305Y\215F\2064\324\226\215\360\021~j`\254\2070\302\353\321\310\245\2727\275\261\t#$\314\227\266\307"
+	.string	"Z\343\373\257\001\362\216\360\035z\326\260\343:\326\260{\2438\254\263\353\240\312\0034\331\244\213\252\355\317D\230\212\247*\221\230W\353\3364\307\246\213\332\320T\333\247\234\301\016e\035\260\026\300\317\312fAop\202o\360\327\r?\377\350\035\026\032"
+	.string	"8\177w\370\031\001?'[\203\251\316\340\347\021\215A\353\234\240/\3709\355\034\020|\3258\335"
+	.ascii	"\005\374U\307K\367\022\020\224\363\367\230\005z\206w4\017\f\235"
+	.ascii	"\223F\377\356\247q\t\017\343\205\273p!F\340\357\264\2373\360"
+	.ascii	"\263\226\237\237\262p\\\315\337K[p?3\301\362.\"\220\341?Z\013"
+	.ascii	"W~v\34355\003\374U\003\235\032Wi!H\267\177\335\300\354g\021S"
+	.ascii	"\376\313\361\356g\237\bBp\016~.\273\206\277\376\314\375,\366"
+	.ascii	"\037L\224\013\376n\362\337\013\253\200\362\237\205\377\036\374"
+	.ascii	"\335Uc~~\362\363\327\317\\??\177\266\372y\310\317B~\006\362\263"
+	.ascii	"\363g\250\237\231~^\376\234\3643\322\317%~&\372\031\371s\013"
+	.ascii	"~^\301\317.\374L\3749\350g\024~\016\376\f\374\031\304\317$\370"
+	.ascii	"y\004?\243?w\340\177\335\177\267\237S\370\217\365\237\311\317"
+	.ascii	"\032\370/\374\331\001?\337\374\034\200\237I\370y\204\377\t\370"
+	.ascii	"Y\204\377Y?\207\3603\b?{\370\231\346\347\231\237y\377\265~\356"
+	.ascii	"\237\371\347\377\177\373O\344?\325\177\023\376\217\375\357\325"
+	.ascii	"\325\325\325\375;\005\374\366\307\257!\001\001kq)\230\306\304"
+	.ascii	"\240\222\266lp\035o\321\352\225\321\300\232!\312y\2132f\t\213"
+	.ascii	"\307\223\266\355\244\241\310\034E!\"\003\312\023\232\0225\262"
+	.ascii	"\300\271\315\0206\325\004\214\237\364\270d\275\271\240\262i\361"
+	.ascii	"c\206\344\r4-\263!\205\254\255\222^2\303\265\226\242*J\211M\f"
+	.ascii	"\2767\221\255\346j$\350u"
+	.string	"n K\b\334]\246\370\240{t\r\371\201\324\366\355\365wTW\021w\254\300j\313H|\357\256\272\344I\021\235\n\324\246\204\257\213t\372\266\272Uk\241\367\336\231\031;\224\302\346\256\323\222\347\357\254\267V?Q\351\021$\252m\037i\254\352\"\205\2114\254\347\214\331\322QG\020\033#_\244n\333\367U\317@\235\354\320\361B\3336r,\306\344\224\220~\332\225)\321yi{[\002\375\356\"\227\367^\0241\351]2T\263\343\2303\317o\303\225\013P\377O\200yo\021\263-;\261f\323\226wp!po\n\312ds\231\243\274B\036s\216\322\346\222\362\252\271\224sS#M\367\n\306\275\312$\363\330\310\233\336%\234\233l.\241\027\t\247L\3572\347\246\310%\337\346R\251\205<\346(\257\232G\345\025s)G\2316\227n\362\036\321\244\221{\223\314\245\234\251\264y\225W\310%\034\345\025\363Xe\266\243\r"
+	.string	"V\210\272X)\2237)"
+	.string	"SI\346\322L\2312y\311\275G\255\242\273\344\364\336\346\275P\314\rK\222:\216K\206\314\222d\234\222\351\221W\234\030\222b\362\322\241k\246\374\301\024Qt/\333=!\302\221\217\351\275\327\350\016\035\371\336\242ty\357\020\023\204\023\223\253\030-\257\315M\"\221\206\244\2305ECL\243\373\343\005/)\257\244\230>&XW\316;\224\036\331y\331\232K\364\352\230^\345\275\227\265\330\310%I\233k\273#\326Cj\244\274E\251au\fF\230\251ME2\221)\021\322S[rb4\332\006\331\251!\262\202I\352\007\312\204fI\213\255\024mwI\337\373\307\263\177p\026\033\271J)(\t\373\240\241d\255"
+	.string	"2\303G\367\250&\210lQ\222R\325()\335`\266u\222\24619\244\352\344\332\211"
+	.string	"gU]\333\266\301]-cH\253\370}L\315\354%qnR\207\026\\\212-g\\\277p\260\036\357\336&\227\323\006'9X/\231\026\200\252\tj\352\336[\243qt\216\326\3217z\007?\333F\3178\027i\032T6\372D/{\307\364*\205\320\325\004\305\241fn\271%\251g\373V\025hK5\f~~\254c\334\036\311\001\221\322\366\365\b}\013\370c;\250v\301fN\023\370\252\202kf7\365S/\231\336%\026\2124A\315\275\350&?\233y\233\336{\265\001\257I\353(ng\337.~e#\203\2234G\333\216\362\275[<\340\006\214\030\332\326\256\202\266S\257\340'O\263x\243\340\270\363\222\351\275\342\251i\211\322\032C\317<\273\033\346\331\275\243\240\357/\364f\255\004}w\241\226uv\275\354V\352\245\367\262\223j\222\275\264\367\"\2317\364\2307\304\200\345@\036\331\331\367\023}S!}\314\366"
+	.string	"K\2768*Za\305\220\246\211\02223\260L\335h\333J*\031\2526\247\252\034\350\031\320EM\244\324F\374\354\242w2\204\021\250vfN\314\371(\262\366-c\210.&\311\350\256@\376\032nR\246\0230\372\330wG\344J\223f[\256\323\232\361\n\013\343\324\366\335\204\236\257\310\240\003\013\\'\230\332\236\207D\345iK\006\263#\2636*_E\322\2668Ddu\nY-C\2174hn)x\312\332\207R\332\232T\027)iMZ\202\260u*\363\005%.I,JM\023&`\315\256bKJ\354\250a\225\251\235\\)I\333\362r8qR\2370\2211\027"
+	.ascii	"$\247\026\330\353\023(O%#\315\244\256-\341\030\262\004\345\215"
+	.ascii	"yy\325\257\035f]\003s\0045\005\247T\026\204\311\353\327\314\033"
+	.ascii	"\226\334\214\266uIC\351\321eIe\265\255JzEJ"
+	.ascii	"\264\226mk\222ca41\030,\332V$\007\223\031+\223r\261\205\362"
+	.string	"\252\262\262*\327\016\263\266\2318\202\232\262\001\203d\356j\353\225\353\247\006S\217\266U\253\241\324\224=q\304\260BQ\030\216\034\251\317$N\231\027\230\226_\256^\2373]\302L(q\240\350\023\021\"\325\212q\322!+ap\f\005'\025\225\276Z\025U\321\021\246m-\322XYN\256\200\264\255UL(J4dH\025\302F\006 \326\0045\225D\304hJ\333\243\027\225q\013\022\244\nyM\336\026S\2347kG*[\246^\205\374(V\016(I\2316\024\315\352\321\243\002!k\202\342\245M6\027?^\201\364\222\306\312+\306\263m\365\3212\320'\026FJ`V\005\223!dJP\236Q\213W\030-\252\263\236\241N\314c\034\b<\224_\340\346\256\322\211\207F\210\033\fNj\274:_w\260\027\233\223F\333\252\3435G\r-XJ\0345\307\317\343\361\260\342\025\306\211\326\033\013\210\362\362\202\316\306i\234\345"
+	.ascii	"\322\266\371`\273J\343X.\306d\356\251m\235q,6^V4\240\252\214"
+	.ascii	"2)\264\241\266\265\367e\2645V\003\255\315W\251*\260\"\264\027"
+	.ascii	"he\276\276\370y,#\311\354\f\n\375\253\2138\034L6\332^\246\t\275"
+	.ascii	"\314\022E\317\234\234*\324\016\263\272Ei\202\332m\2718\214<\275"
+	.ascii	"B\035\314\206\215\013\316E\333\312\342&\251\355\206\fm\353\212"
+	.ascii	"\366\241&\347\345\346\005\235\271>\024(*\323.k)\207b\356^'\236"
+	.ascii	"\230\271:4\031\255\342\225\351KT\211\2665\005\177]\271\020\363"
+	.ascii	"\322\266\276\220\004\235a.\227\025\2715\307B\346f\204\305\200"
+	.ascii	"\332\250%%\205\261XB\252\300v\2407*\216\216*\022\n\273\247\327"
+	.ascii	"T\030\030CHnA\314v<\2414J\325\250\032\325\0228\252\362\265\204"
+	.ascii	"W\023\027AvD\350\315\213d\262\022\305X\341\304S\333\272<i\276"
+	.ascii	"\022\361x\370\220B\202Cq\216\324c=V$\037\331\202\342\341Ea*9"
+	.ascii	"\301\205\237\025y\366C\007W\032:\243\006\006L\327\311\224h\013"
+	.ascii	"\363\256[\332py\232U\3054Am\026\337\333\313\227\236\333\301I"
+	.ascii	"\257\324"
+	.string	"\223\023\214[\233R\021\36416\320\230\353{o\341\322s;F\356\261\207\006u\0045w/\324\007;$_r\f\341\267^b\322\241\265\225\373\f5\314\345M\326H\213c\266u\253S]1\242\264}\214\023\372\230$J\363\005\013\226\316\302N\267\256!Q\n\233\212{g\261[\310\345\216\266\r\327X3Pp\271X\326\230@\321\244\205\034J\363\365\366\326Wfj\254\260\362\276\362T\211\264P\341\302\352&dG'\336\320\233)k_\3536\364\310\034\333\273\255\3076\024w\326>h\244\310\252\220\231\2418Kgg\235\206\316HUy\247\361W\243x\332b\266m\264\036+;\243bu,1]\316\023jO\320\030/\276\267\231Y\222\n\204\013J\220,t\227\344{\227=\273\254\237lz\227T\350\262L?\270\205\001\355\025i\322RX\353\346)%\354-e,&\304\036\021>\366\003@C\236Q\030\254\303\335\n\305\013"
+	.string	"\rg6"
+	.string	"4\254\0210\026\211\301\020\027\\D\207 \240\261\230\202\242\207 \361\207\003\232\237\036\241\f"
+	.string	"\rw2\030\220\030\021BD1(\f\206\320\340\007X\354!\002\177\305\240\b\242\261\350\001\370Cb\204\2170\350\201X$\341A\203\021#H\b\205BB\031\343o\327\202\020Q\204QH(\023\242\0078\302\002\211$\206v\030\344\023\004\f\332\3752\270\210\016>D\037\017B\241\240\240\035\240\261\347gH\342g4\006}|~\037|>D\237\013tz\204F\314\030\201@:B,d\360\023\034\321\363\001\243\020h\024\n\235P\fb`\f\n\2033E a\320h\004\256\360#\004\016\207\021\020\366\370\344\350\030\211=\030\374\b\201\277_\016\361\0074\374\r\205\214\305\337\217\203N\261\306\030\f\n\022:\341\247\007H\2349A\205\023\210<#\261\307X\354\001U\020\\\341\004\034\rp@\205\024(@\201\037a0\304\f\360\007\374\021\322"
+	.string	"\220HbD\260'\204\215\314\017\360\347\247'\005\2401Hl\201\346>A\"P\b\004B/\302\207\005| \301\005\231\223`\002\b&\200\260;\t&\370|&|\360\241\377\340\253 t"
+	.string	"\022\006\177~z\206<\340\257\002:\306\037\341\357WS\374\345\030\177D\343\220w\021\035\210\300\240\036 \321X\374\225\200\215\277\020\030\320\002\023\201!B\220(\301\316\330\323D\"\260\216\020\022\222\300/Fh\204\220\004j\374\021\201?=@\024\214=AD\241\020;\343\357\207(\344\003T\241\367\002"
+	.string	"\r\373\007h\002\237\236\341N(\024,\022\201(\220)\002\365\214\b\021\343C\364\251\306\213\3500$!D\004\372\021\201F`P\017\261gx\200\013\r\201D\017F!!\242\007\032\037!\211\n\030\201E\032a\2106\002\213@bL\361\227\002\242\261\030\004\002\252"
+	.ascii	"4\2541\376\204@\303\030!\320\260\032\177\037|(P\005\301\242-"
+	.ascii	"\026\201\304\237\237\036\231\024\f\205|\254\361G\202Q\030$!s"
+	.ascii	"\337\207\022JP\202\b$\370:l\360\022J8\241\003\017l\300\002\250"
+	.ascii	"O\207 !\342\020\b\374\001\005C\b\205|<\b\203=A\036|\210E\017"
+	.ascii	"\0356\020\215\303\nU\237\304\274\235\r\341\361TK\334\\\244\250"
+	.ascii	"$\213\256\273ac\306@ZQ\201\230(R\345J\333T+-\f\030\257&\"\td"
+	.ascii	"A\212\301T\205\330$]\223HE_A\331\304\200d\245\260K\336\213\254"
+	.ascii	"\032W/t\026\366\232Q\025\207\302\n\314\027#D\354R}\362\232V\252"
+	.ascii	"\242vn\200\240\370\262J\277M\342+V\271S&\233?\332\356Xgg\221"
+	.ascii	"|\267'\330\226\230\250h\033\303:\273\337\036iu\265\220\202f\302"
+	.ascii	"ys\006\003\251\243\355m\t\253\004qo\272{a\225\003\254\255-\262"
+	.ascii	"F\267JKt\255R\004\346\275H\253\274\271\2611H\355\340\332\331"
+	.ascii	"\363\234h\b"
+	.string	"\276\333\344n\312\311\213.v\350\313\331\\\214\265\266\366\330\366Z\344\355\361ij\217\004`\321\025\326cgs\350j\035]\r\303[.\357uz@Y\02780\257a\262lx i`\221\201\212\315\245lm\253\\\235\343\347\301j\227^\331\232\032[\023uA\006\207\215K\235\201\213\227\247-\215\004\365\212Bt\324\002%\203\312\r\033m\323+\f\234\202$\305q\331.\244\313\204\253_3CV<5a\221R\335\246\212\\\3100'\343\205lN\255m}\343\272:\272\267\033\345\025\363J\265\362\372\366\013\002I\nig+[m\001\335\275\310\312\326\325\255\266\275\262\235y\003\363\206\033\031\266)%rgq\272\324\352\232Z\275\267\305\027'o\211\3464\317j\332Y\255r\201\343p\356\b\n\355\265J\215\302\302\250\007\224(\314\203l\250\222\271<\006\363\0302\006\241\031\021\222&I\032\003r\n\020\204\"a\242\2511;\022"
+	.string	"EE\021*\250fd$I\n\303\001\311)v\271\207\246}A)\nTv\261\360\375#\224\2153\333\003-\002\363\030\270\316\036s\016\232\210h\327Q\213=\023\272\301\267\017;\231R\233\356\025`\37141\b\374\333\3126\030@\341\017\017\022\327\005\345\345T\2629\246!\302\240b\241\355\r\001\304Fe\271\343\035\245\236<v!\f\204XG\305\234\226\341\2404\231G\261#/\013\037K\r\371\235{x~&e3\242"
+	.ascii	"Z\323\004"
+	.ascii	"\017 \225\222\227\274\306\fe \037UW\200*WFq\304\336\273n\364"
+	.ascii	"\335\301\332\350m\344\0276\261p\033\363\341\214\377K\005,\212"
+	.ascii	"\340W<v\362?L\212d\356O\235\310\255J\bl\265\240\317,\266\350"
+	.ascii	"\233\220\035\237\224\374\031\035{\234\225\377\23218\326\036\f"
+	.ascii	"f\307\214\2622k\366D"
+	.string	"M\213\365\020\342X\2265)\027G\372\f56\306\317u\235\020\330\227\036\267\270:8\350\277=\250\357\366\204\330CN\222<j|u\377\241GB\353\237i\310\337jQ|\327\0012\256\346\336\225<\n\256\361`\035\023\254CM\257\246\216Rh\221\371\256\307\004\331\233\237\n-\354\334|\200\211\200\021\216\325kq\226p@/\243<oBu\224\351\346bHq$\001!\315\034P\007\226\031\2422\\\b@\233\305\223\327/\345un\275\341\n\245\261\206)\221\366\036E\n\244\rzIt\022P\n\007\300\304\337\035\205ef\312ss\302\274z\243qM\357'\373\003\365Z\373*\343\\Bo\352\340vUt.\331\032?l\b\020<$@g\247\242v\n\227\312\357\347\275\224o4\254\310\b8\220\266m\372u\277f&gA\276sI\n\221FU\354\364{b\243\333EGs/\270O\203\036ME\367\307\247x\244\036\305n"
+	.string	"\001;2\036\310\003\2755R\356\255#q\321u\373O\022d\220\203\365+\313x@\033\377e\2510\375\201Y\026.\375\215\201\260.\rr\375\212~B\235sM\272,\035,t\017\036\326@\352\227\375G\"EL\204$\316\321G\343\277\026O\305\331J\324[\371\223(\261\221\256\323\343\2276A\007\250\266\0369Z\221\267\362s\315)0\f\210\206\201\031\261\331\242Qx\240\316\004\267N\314\366\326\002\324\376\335-[i\266`\374\027O\232\303$\034^Y}\030\032\021\340\342\377a\236H\326\177\300u\240H*\027d\324F+\203\364|\216u\206\036\211\222\351\273J\023\253\031\n\246\307\271\363\357\306\037\326\274\020\314\226W\200\034\t\240\302\013\360##Xj\245\326V\241\003\344\006\024\276\311\025\247`\263&yp"
+	.string	"\022<\345\004R\230rl\353\t:l\022_. (\206\370\245\233\322`\201\3532\3228\237\f\324\rz\312\203}\0271\016\333\230\234\206\307\036!\213\036F\325\344v\037\223\355\006\b\203\235<x\302\325\230!*\004Ob\377\005\342\323+I\366\250\312\033@\314j,D\013b\007\271\272\007S\221Z\274\316\231a\206\342\rs<<\317\344\367\3579*\375\233\341\265\303T\372?\305\320\031\263j\307\021i\266\303S\213\271N\300\266r\362w>\336M\"\rj\017\251\351XF\231x$\311\003\205\245v\027\252\333\243\205\363C\247\363\370u\2140\364\364\272\340\314\"\313\370Ax\357\225\200\231J?H\300+n\034\244\005m\244\270\252\366\246\\\340\005\001=\333\241\233\\\307"
+	.string	"\236Hv\241\f\352e\302\343\021\261\341\336l\032\036e\272E\327\036\374D\313\327B\201\362\001'\321\020b\035\313\301\300J\030\347Z"
+	.string	"\2474\b\250\324=\347\235\356n%\"\210\021CY\2431\261G\347\230\231.\332o\245\331#\354\246co>M\007\265\204\037\216|\306\312\320\201\r\001\245rX=f\234A\302\250\212g\353\267\335\371]@\352\370\311RL.#\177\006\201\367\004x\006wk\207\322`E\374\3650\321\020Z\017\270\353\301g\314\257\037\264\227\211\330\206\303x\247q\207\262\326\277\301\327\335\362\376\227\3002\261\230\230\320\302D\001X_\246\035>w0\\\0363\247R\313\221\377hx\350\333\253\334"
+	.string	"\212\0342\237\250\241D\037U\261\246\207\274\377\213\301\261\224`\262\272\271/*\027\320\334Y\336\357\340\261oRb\0039`a\020\250R8\203\322<\373\217\"\377\246v\205\034(\314\240\230/\036\236&\320\360\202e\233\023\231\013\254p\253\323"
+	.string	"9\216a\004\320\322\335\226=\201\2070B=\215\362\250\024{*j\320\322\001\244\020\205\241\300\2430\206\243\202=W\217\240\001\002\037\215\261\304\325D\303\362}9v\304'\234\2605"
+	.string	"\253\341\311(\315E\026s\230\243\266_B\356\303\357zaq\226\265F\260A\235#B2\b;\237B\032H8\002\246\342\243\224+_\344&\264\323\232\003\01707\341\3016\303\343\322\201\256yn@y\213\351CLL#\016\216C\215\376E\027\313\265|\260\2275\033\017\312\341\342^\220\223"
+	.ascii	"\t\0061\f\252c\246\n#\021;\220\201\210\230\366\277/\240\023\367"
+	.ascii	"s\267\365f&\021\277\242\177\373\303W\242\235\351\334S\f\201j"
+	.ascii	"\027\360\226\227E\372S>\343\240\016\347\374\276P\361\347\306"
+	.ascii	"\207B\375\002\230\245\333\234\330\265\371\037\351\267\234\273"
+	.ascii	"\310\262\177\230u\026=[A\207\240\267n\373\b@\207\030\035\364"
+	.ascii	"\371{\323;\205a\300\277\365]\3209\312ufb\243u\301\304\217\324"
+	.ascii	" 9S\326\013z>\221\016\023G\036n\277\235\371\271\274\017*\213"
+	.ascii	"\216\200NG\333\007\240\007[\267\303\023C8\360\311v\301{dh\221"
+	.ascii	"\250\307B\367\t\257O\232\233\257\301\355\t\363\317\376m\367\201"
+	.ascii	"\336*_\266=c\216\300Z\020\354\254{\365Y/2\242hk\361\263\237\357"
+	.ascii	"\004\370\375\363\350\377\260\316|\006\335\274\374\024\277\223"
+	.ascii	"6\026\321\373\021\353\005\375\223\r/}\367\302\307\n\346\034{"
+	.ascii	"\220\317\211|\303\361\335eg\034%\274\3417\375q\273\377\260\356"
+	.ascii	"\370!\301\023\325\315\2721\334X\335\373<\266\003\n\034\220\237"
+	.ascii	"xD\364\275\237\355\311\254\303\3522\336\f\277\343#B_\333\007"
+	.ascii	"\357\235~=\316\206g\333'\177\354\316\200n\277\301\333\350\312"
+	.ascii	"\\w\207F\213lOpN=\217\364 \337K6\351\256;\206\202ce\366)\032"
+	.ascii	",\336\226\233\354\215\375\263\033\321t\230[\177\321\335\305\342"
+	.ascii	"L\361a\352\027\252\234\362+\345s\274\311\312{\277t\304pp\366"
+	.ascii	"\030y\0031$\332\n"
+	.text
+	.section	.gnu.lto_.symtab.351c066418d6dd30,"e",@progbits
+	.string	"initEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"getEEPROMConfigSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"__config_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\001"
+	.string	""
+	.string	"__config_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"__stop_pg_registry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"__start_pg_registry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"crc16_ccitt_update"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"config_streamer_is_erased"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"config_streamer_init"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.351c066418d6dd30,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
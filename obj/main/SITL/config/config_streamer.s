@@ -0,0 +1,6918 @@
+	.file	"config_streamer.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/include/stdint.h"
+	.file 5 "./src/main/target/SITL/target.h"
+	.file 6 "./src/main/config/config_streamer.h"
+	.file 7 "./src/main/config/config_streamer.c"
+	.file 8 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config_streamer.c.514c0d7e
+	.weak	config_streamer.c.514c0d7e
+config_streamer.c.514c0d7e:
+	.long	0x376
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF968
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x2
+	.long	.LASF929
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF923
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF924
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF925
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF926
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF927
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF928
+	.uleb128 0x2
+	.long	.LASF930
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4a
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF931
+	.uleb128 0x2
+	.long	.LASF932
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF933
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF934
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0xe
+	.long	0x87
+	.uleb128 0x2
+	.long	.LASF935
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x2
+	.long	.LASF936
+	.byte	0x4
+	.byte	0x5a
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x1a
+	.byte	0x7
+	.byte	0x4
+	.long	0x51
+	.byte	0x5
+	.byte	0x8c
+	.byte	0xe
+	.long	0xdd
+	.uleb128 0x4
+	.long	.LASF937
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF938
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF939
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF940
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF941
+	.byte	0x5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF942
+	.byte	0x5
+	.byte	0x92
+	.byte	0x3
+	.long	0xb0
+	.uleb128 0xe
+	.long	0xdd
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x5
+	.long	0x10a
+	.uleb128 0xf
+	.string	"b"
+	.byte	0x1e
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0xf
+	.string	"w"
+	.byte	0x1f
+	.byte	0x12
+	.long	0x98
+	.byte	0
+	.uleb128 0x1c
+	.long	0x87
+	.long	0x11a
+	.uleb128 0x1d
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF969
+	.byte	0x20
+	.byte	0x6
+	.byte	0x1a
+	.byte	0x10
+	.long	0x16d
+	.uleb128 0x8
+	.long	.LASF943
+	.byte	0x1b
+	.byte	0xf
+	.long	0xa4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF944
+	.byte	0x1c
+	.byte	0x9
+	.long	0x3c
+	.byte	0x8
+	.uleb128 0x8
+	.long	.LASF945
+	.byte	0x20
+	.byte	0x7
+	.long	0xee
+	.byte	0xc
+	.uleb128 0x10
+	.string	"at"
+	.byte	0x21
+	.long	0x3c
+	.byte	0x10
+	.uleb128 0x10
+	.string	"err"
+	.byte	0x22
+	.long	0x3c
+	.byte	0x14
+	.uleb128 0x8
+	.long	.LASF946
+	.byte	0x23
+	.byte	0x9
+	.long	0x16d
+	.byte	0x18
+	.byte	0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF947
+	.uleb128 0x2
+	.long	.LASF948
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x11a
+	.uleb128 0x11
+	.long	.LASF949
+	.byte	0x1a
+	.long	0x87
+	.uleb128 0x11
+	.long	.LASF950
+	.byte	0x1b
+	.long	0x87
+	.uleb128 0x12
+	.long	.LASF953
+	.byte	0x95
+	.uleb128 0xa
+	.long	.LASF951
+	.byte	0x5
+	.byte	0x96
+	.long	0xdd
+	.long	0x1af
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF952
+	.byte	0x5
+	.byte	0x97
+	.long	0xdd
+	.long	0x1c9
+	.uleb128 0x3
+	.long	0xa4
+	.uleb128 0x3
+	.long	0x98
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF954
+	.byte	0x94
+	.uleb128 0xa
+	.long	.LASF955
+	.byte	0x8
+	.byte	0x3d
+	.long	0x85
+	.long	0x1ee
+	.uleb128 0x3
+	.long	0x85
+	.uleb128 0x3
+	.long	0x3c
+	.uleb128 0x3
+	.long	0x22
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF956
+	.value	0x13e
+	.long	0x3c
+	.long	0x208
+	.uleb128 0x6
+	.string	"c"
+	.value	0x13e
+	.byte	0x2f
+	.long	0x208
+	.byte	0
+	.uleb128 0x13
+	.long	0x174
+	.uleb128 0x5
+	.long	.LASF957
+	.value	0x134
+	.long	0x3c
+	.long	0x227
+	.uleb128 0x6
+	.string	"c"
+	.value	0x134
+	.byte	0x2e
+	.long	0x208
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF958
+	.value	0x12f
+	.long	0x3c
+	.long	0x241
+	.uleb128 0x6
+	.string	"c"
+	.value	0x12f
+	.byte	0x2f
+	.long	0x208
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF959
+	.value	0x121
+	.long	0x16d
+	.long	0x275
+	.uleb128 0xb
+	.long	.LASF943
+	.value	0x121
+	.byte	0x29
+	.long	0xa4
+	.uleb128 0xb
+	.long	.LASF944
+	.value	0x121
+	.byte	0x36
+	.long	0x3c
+	.uleb128 0x7
+	.uleb128 0x14
+	.string	"p"
+	.value	0x123
+	.byte	0x14
+	.long	0xa4
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF960
+	.value	0x114
+	.long	0x3c
+	.long	0x2b3
+	.uleb128 0x6
+	.string	"c"
+	.value	0x114
+	.byte	0x2e
+	.long	0x208
+	.uleb128 0x6
+	.string	"p"
+	.value	0x114
+	.byte	0x40
+	.long	0x2b3
+	.uleb128 0xb
+	.long	.LASF944
+	.value	0x114
+	.byte	0x4c
+	.long	0x98
+	.uleb128 0x7
+	.uleb128 0x14
+	.string	"pat"
+	.value	0x116
+	.byte	0x19
+	.long	0x2b3
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x93
+	.uleb128 0xc
+	.long	.LASF963
+	.byte	0xe9
+	.byte	0xc
+	.long	0x3c
+	.long	0x2f6
+	.uleb128 0xd
+	.string	"c"
+	.byte	0xe9
+	.byte	0x2a
+	.long	0x208
+	.uleb128 0x9
+	.long	.LASF961
+	.byte	0xe9
+	.byte	0x36
+	.long	0x98
+	.uleb128 0x15
+	.long	.LASF962
+	.value	0x10b
+	.byte	0x18
+	.long	0xe9
+	.uleb128 0x7
+	.uleb128 0x15
+	.long	.LASF962
+	.value	0x105
+	.byte	0x1c
+	.long	0xe9
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF964
+	.byte	0xdd
+	.byte	0x15
+	.long	0xdd
+	.long	0x320
+	.uleb128 0x7
+	.uleb128 0x16
+	.long	.LASF965
+	.byte	0xdf
+	.byte	0x14
+	.long	0xa4
+	.uleb128 0x7
+	.uleb128 0x16
+	.long	.LASF962
+	.byte	0xe0
+	.byte	0x1c
+	.long	0xe9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF966
+	.byte	0xd7
+	.byte	0xc
+	.long	0x16d
+	.long	0x33b
+	.uleb128 0x9
+	.long	.LASF943
+	.byte	0xd7
+	.byte	0x25
+	.long	0xa4
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF970
+	.byte	0x7
+	.byte	0x3b
+	.byte	0x6
+	.long	0x367
+	.uleb128 0xd
+	.string	"c"
+	.byte	0x3b
+	.byte	0x2f
+	.long	0x208
+	.uleb128 0x9
+	.long	.LASF967
+	.byte	0x3b
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0x9
+	.long	.LASF944
+	.byte	0x3b
+	.byte	0x46
+	.long	0x3c
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF971
+	.byte	0x7
+	.byte	0x36
+	.byte	0x6
+	.uleb128 0xd
+	.string	"c"
+	.byte	0x36
+	.byte	0x2e
+	.long	0x208
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 9 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 21 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.file 23 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x5
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF684
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF744
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF749
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF812
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 29 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x4
+	.file 30 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1f
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF921
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF922
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF747
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF811
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xc
+	.long	.LASF1
+	.long	.LASF972
+	.long	.LASF973
+	.long	.LASF974
+	.long	.LASF975
+	.long	.LASF976
+	.long	.LASF977
+	.long	.LASF978
+	.long	.LASF979
+	.long	.LASF980
+	.long	.LASF981
+	.long	.LASF982
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x21
+	.long	.LASF0
+	.byte	0
+	.long	.LASF983
+	.byte	0xb
+	.long	.LASF984
+	.byte	0x7
+	.long	.LASF985
+	.byte	0x7
+	.long	.LASF986
+	.byte	0xa
+	.long	.LASF987
+	.byte	0x3
+	.long	.LASF988
+	.byte	0x1
+	.long	.LASF989
+	.byte	0x1
+	.long	.LASF990
+	.byte	0xa
+	.long	.LASF991
+	.byte	0xa
+	.long	.LASF992
+	.byte	0x7
+	.long	.LASF993
+	.byte	0xa
+	.long	.LASF994
+	.byte	0xa
+	.long	.LASF995
+	.byte	0x7
+	.long	.LASF996
+	.byte	0x7
+	.long	.LASF997
+	.byte	0x9
+	.long	.LASF998
+	.byte	0x7
+	.long	.LASF999
+	.byte	0x8
+	.long	.LASF1000
+	.byte	0x8
+	.long	.LASF1001
+	.byte	0x6
+	.long	.LASF1002
+	.byte	0x6
+	.long	.LASF1003
+	.byte	0xa
+	.long	.LASF1004
+	.byte	0x5
+	.long	.LASF1005
+	.byte	0x4
+	.long	.LASF986
+	.byte	0xb
+	.long	.LASF1006
+	.byte	0x7
+	.long	.LASF1007
+	.byte	0x7
+	.long	.LASF1008
+	.byte	0x7
+	.long	.LASF1009
+	.byte	0x7
+	.long	.LASF1010
+	.byte	0x4
+	.long	.LASF1011
+	.byte	0x4
+	.long	.LASF1012
+	.byte	0x2
+	.long	.LASF1013
+	.byte	0xb
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF757:
+	.string	"INT32_MAX (2147483647)"
+.LASF699:
+	.string	"__STD_TYPE typedef"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF627:
+	.string	"USE_OPFLOW "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF593:
+	.string	"USE_I2C_PULLUP "
+.LASF929:
+	.string	"size_t"
+.LASF956:
+	.string	"config_streamer_finish"
+.LASF599:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF748:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF953:
+	.string	"FLASH_Lock"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF670:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF604:
+	.string	"USE_GPS "
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF659:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF877:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF484:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF732:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF803:
+	.string	"INT16_C(c) c"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF796:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF938:
+	.string	"FLASH_ERROR_PG"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF612:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF845:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF751:
+	.string	"INT8_MIN (-128)"
+.LASF600:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF621:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF373:
+	.string	"linux 1"
+.LASF860:
+	.string	"USE_UART7 "
+.LASF869:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF607:
+	.string	"USE_TELEMETRY "
+.LASF772:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF719:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF678:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF942:
+	.string	"FLASH_Status"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF782:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF471:
+	.string	"__P(args) args"
+.LASF913:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF712:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF665:
+	.string	"USE_SERIALRX_SUMD "
+.LASF632:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF900:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF887:
+	.string	"USE_VCP"
+.LASF847:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF786:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF821:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF582:
+	.string	"__size_t "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF696:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF760:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF781:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF680:
+	.string	"USE_CLI_BATCH "
+.LASF867:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF631:
+	.string	"USE_1WIRE "
+.LASF611:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF358:
+	.string	"__k8 1"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF584:
+	.string	"NULL"
+.LASF896:
+	.string	"U_ID_1 1"
+.LASF639:
+	.string	"USE_OLED_UG2864 "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF726:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF889:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF798:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF875:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF813:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF721:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF664:
+	.string	"USE_RX_MSP "
+.LASF648:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF508:
+	.string	"__always_inline"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF753:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF968:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF933:
+	.string	"long int"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF626:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF741:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF667:
+	.string	"USE_SERIALRX_XBUS "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF620:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF924:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF653:
+	.string	"CMS_MENU_OSD "
+.LASF872:
+	.string	"USE_DASHBOARD"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF795:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF912:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF937:
+	.string	"FLASH_BUSY"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF965:
+	.string	"page"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF624:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF928:
+	.string	"signed char"
+.LASF934:
+	.string	"uint8_t"
+.LASF686:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF662:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF701:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF969:
+	.string	"config_streamer_s"
+.LASF948:
+	.string	"config_streamer_t"
+.LASF636:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF717:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF868:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF608:
+	.string	"USE_TELEMETRY_LTM "
+.LASF909:
+	.string	"NOINLINE "
+.LASF902:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF856:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF617:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF807:
+	.string	"UINT16_C(c) c"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF752:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF910:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF947:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF961:
+	.string	"value"
+.LASF596:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF728:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF679:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF768:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF766:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF906:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF671:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF563:
+	.string	"__need_size_t "
+.LASF634:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF689:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"__STD_TYPE"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF812:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF743:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF946:
+	.string	"unlocked"
+.LASF565:
+	.string	"__size_t__ "
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF898:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF779:
+	.string	"INT_FAST8_MAX (127)"
+.LASF767:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF964:
+	.string	"eraseConfigPages"
+.LASF797:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF808:
+	.string	"UINT32_C(c) c ## U"
+.LASF787:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF758:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF591:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF963:
+	.string	"write_word"
+.LASF777:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF971:
+	.string	"config_streamer_init"
+.LASF908:
+	.string	"FAST_CODE "
+.LASF642:
+	.string	"USE_FRSKYOSD "
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF669:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF846:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF958:
+	.string	"config_streamer_status"
+.LASF742:
+	.string	"_BITS_TIME64_H 1"
+.LASF705:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF839:
+	.string	"__INT_WCHAR_T_H "
+.LASF690:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF891:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF735:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF595:
+	.string	"USE_SERIAL_RX "
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF597:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF775:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF737:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF727:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF677:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF865:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF917:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF930:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF834:
+	.string	"_BSD_WCHAR_T_ "
+.LASF945:
+	.string	"buffer"
+.LASF962:
+	.string	"status"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF784:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF649:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF785:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF716:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF778:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF870:
+	.string	"USE_USB_MSC"
+.LASF897:
+	.string	"U_ID_2 2"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF586:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF966:
+	.string	"isEraseAddress"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF861:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF695:
+	.string	"__SLONG32_TYPE int"
+.LASF800:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF652:
+	.string	"USE_CMS "
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF747:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF749:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF644:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF791:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF718:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF684:
+	.string	"_BITS_TYPES_H 1"
+.LASF759:
+	.string	"UINT8_MAX (255)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF941:
+	.string	"FLASH_TIMEOUT"
+.LASF905:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF932:
+	.string	"__uint32_t"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF943:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF903:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF609:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF952:
+	.string	"FLASH_ProgramWord"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF949:
+	.string	"__config_start"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF564:
+	.string	"__need_NULL "
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF668:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF936:
+	.string	"uintptr_t"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF700:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF862:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF822:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF675:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF817:
+	.string	"_T_PTRDIFF_ "
+.LASF851:
+	.string	"USE_FAKE_GPS "
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF970:
+	.string	"config_streamer_start"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF820:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF605:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF736:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF610:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF830:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF899:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF583:
+	.string	"__need_size_t"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF827:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF957:
+	.string	"config_streamer_flush"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF683:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF954:
+	.string	"FLASH_Unlock"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF960:
+	.string	"config_streamer_write"
+.LASF790:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF832:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF23:
+	.string	"_LP64 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF890:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF461:
+	.string	"__PMT"
+.LASF630:
+	.string	"USE_PITOT_MS4525 "
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF722:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF691:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF915:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF815:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF643:
+	.string	"USE_DJI_HD_OSD "
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF873:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF927:
+	.string	"unsigned int"
+.LASF746:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF641:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF880:
+	.string	"USE_PITOT_ADC"
+.LASF878:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF681:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF415:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF916:
+	.string	"_STDBOOL_H "
+.LASF841:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF729:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF688:
+	.string	"__U32_TYPE unsigned int"
+.LASF658:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF818:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF816:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF770:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF725:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF763:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF893:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF616:
+	.string	"USE_GYRO_KALMAN "
+.LASF507:
+	.string	"__wur "
+.LASF592:
+	.string	"I2C2_OVERCLOCK false"
+.LASF919:
+	.string	"false 0"
+.LASF940:
+	.string	"FLASH_COMPLETE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF802:
+	.string	"INT8_C(c) c"
+.LASF918:
+	.string	"true 1"
+.LASF824:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF950:
+	.string	"__config_end"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF740:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF704:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF711:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF673:
+	.string	"USE_RCDEVICE "
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF926:
+	.string	"unsigned char"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF647:
+	.string	"USE_ANTIGRAVITY "
+.LASF738:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF829:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF849:
+	.string	"USE_FAKE_BARO "
+.LASF823:
+	.string	"_GCC_PTRDIFF_T "
+.LASF606:
+	.string	"USE_NAV "
+.LASF640:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF852:
+	.string	"USE_MAG "
+.LASF925:
+	.string	"char"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF837:
+	.string	"_WCHAR_T_H "
+.LASF951:
+	.string	"FLASH_ErasePage"
+.LASF854:
+	.string	"USE_UART1 "
+.LASF765:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF850:
+	.string	"USE_FAKE_MAG "
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF864:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF713:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF618:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF814:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF793:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF840:
+	.string	"_GCC_WCHAR_T "
+.LASF774:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF922:
+	.string	"FLASH_PAGE_SIZE (0x400)"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF590:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF750:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF720:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF944:
+	.string	"size"
+.LASF613:
+	.string	"USE_PITOT_ADC "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF914:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF698:
+	.string	"__U64_TYPE unsigned long int"
+.LASF819:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF771:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF619:
+	.string	"USE_RX_UIB "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF804:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF809:
+	.string	"UINT64_C(c) c ## UL"
+.LASF858:
+	.string	"USE_UART5 "
+.LASF638:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF907:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF836:
+	.string	"_WCHAR_T_DEFINED "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF548:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF637:
+	.string	"USE_DASHBOARD "
+.LASF645:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF844:
+	.string	"__need_wchar_t"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF697:
+	.string	"__S64_TYPE long int"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF811:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF955:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF629:
+	.string	"USE_OPFLOW_MSP "
+.LASF831:
+	.string	"_T_WCHAR "
+.LASF687:
+	.string	"__S32_TYPE int"
+.LASF761:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF655:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF959:
+	.string	"config_streamer_is_erased"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF714:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF628:
+	.string	"USE_OPFLOW_CXOF "
+.LASF799:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF393:
+	.string	"_STRING_H 1"
+.LASF672:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF745:
+	.string	"_BITS_WCHAR_H 1"
+.LASF601:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF805:
+	.string	"INT64_C(c) c ## L"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF833:
+	.string	"_WCHAR_T_ "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF622:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF892:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF674:
+	.string	"USE_VTX_CONTROL "
+.LASF835:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF418:
+	.string	"__USE_GNU"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF731:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF859:
+	.string	"USE_UART6 "
+.LASF848:
+	.string	"USE_IMU_FAKE "
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF911:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF724:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF614:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF702:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF884:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF874:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF886:
+	.string	"USE_ADC"
+.LASF882:
+	.string	"USE_1WIRE_DS2482"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF883:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF783:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF931:
+	.string	"short int"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF879:
+	.string	"USE_PITOT_MS4525"
+.LASF602:
+	.string	"USE_64BIT_TIME "
+.LASF755:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF625:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF623:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF692:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF694:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF826:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF730:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF709:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF904:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF693:
+	.string	"__SWORD_TYPE long int"
+.LASF828:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF706:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF792:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF789:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF842:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF663:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF635:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF853:
+	.string	"USE_BARO "
+.LASF685:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF801:
+	.string	"WINT_MAX (4294967295u)"
+.LASF762:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF894:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF806:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF838:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF885:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF723:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF654:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF754:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF651:
+	.string	"USE_STATS "
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF855:
+	.string	"USE_UART2 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF843:
+	.string	"_BSD_WCHAR_T_"
+.LASF769:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF661:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF935:
+	.string	"uint32_t"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF703:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF764:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF776:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF715:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF756:
+	.string	"INT16_MAX (32767)"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF881:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF866:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF707:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF895:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF708:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF871:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF888:
+	.string	"USE_RX_PPM"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF646:
+	.string	"USE_D_BOOST "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF780:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF660:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF657:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF967:
+	.string	"base"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF920:
+	.string	"__bool_true_false_are_defined 1"
+.LASF734:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF863:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF876:
+	.string	"USE_RANGEFINDER"
+.LASF666:
+	.string	"USE_SERIALRX_SUMH "
+.LASF825:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF921:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF788:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF650:
+	.string	"USE_LOG "
+.LASF594:
+	.string	"USE_RX_PPM "
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF603:
+	.string	"USE_BLACKBOX "
+.LASF710:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF857:
+	.string	"USE_UART4 "
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF676:
+	.string	"USE_VTX_TRAMP "
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF901:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF682:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF739:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF794:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF615:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF733:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF773:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF810:
+	.string	"INTMAX_C(c) c ## L"
+.LASF923:
+	.string	"long unsigned int"
+.LASF656:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF939:
+	.string	"FLASH_ERROR_WRP"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF633:
+	.string	"USE_TEMPERATURE_SENSOR "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF992:
+	.string	"libc-header-start.h"
+.LASF1000:
+	.string	"stubs-64.h"
+.LASF1008:
+	.string	"wchar.h"
+.LASF981:
+	.string	"/usr/include"
+.LASF1005:
+	.string	"common.h"
+.LASF989:
+	.string	"config_streamer.c"
+.LASF1003:
+	.string	"strings.h"
+.LASF1002:
+	.string	"__locale_t.h"
+.LASF975:
+	.string	"src/main/target"
+.LASF990:
+	.string	"string.h"
+.LASF1009:
+	.string	"stdint-intn.h"
+.LASF0:
+	.string	"./src/main/config/config_streamer.c"
+.LASF1012:
+	.string	"system.h"
+.LASF985:
+	.string	"stdint-uintn.h"
+.LASF980:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF982:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF974:
+	.string	"src/main/target/SITL"
+.LASF993:
+	.string	"features.h"
+.LASF1007:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF988:
+	.string	"config_streamer.h"
+.LASF1010:
+	.string	"sanity_check.h"
+.LASF1001:
+	.string	"locale_t.h"
+.LASF978:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF983:
+	.string	"stddef.h"
+.LASF999:
+	.string	"stubs.h"
+.LASF972:
+	.string	"src/main/config"
+.LASF1006:
+	.string	"typesizes.h"
+.LASF994:
+	.string	"features-time64.h"
+.LASF1011:
+	.string	"common_post.h"
+.LASF997:
+	.string	"cdefs.h"
+.LASF987:
+	.string	"target.h"
+.LASF996:
+	.string	"timesize.h"
+.LASF973:
+	.string	"src/main/drivers"
+.LASF1004:
+	.string	"platform.h"
+.LASF977:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF976:
+	.string	"src/main"
+.LASF1013:
+	.string	"stdbool.h"
+.LASF979:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF995:
+	.string	"wordsize.h"
+.LASF998:
+	.string	"long-double.h"
+.LASF991:
+	.string	"stdc-predef.h"
+.LASF986:
+	.string	"stdint.h"
+.LASF984:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375 \304\025\004"
+	.string	"\364\005\270"
+	.string	"\n"
+	.string	"\355\351\205\206\003"
+	.string	"\003\331\214\214\215\001\006\002"
+	.string	"\002\001\004\240\303\365\236\007\004\002\002\005\302\206\367\346\001"
+	.string	"\006\254\324\371\225\r\n\003\002\002\001\007\255\317\216\321\003\020\004\002\004\002\005\002\001\002\b\250\357\224\341\003\002\002\006\002\006\t\245\362\275\220\n\002\n\324\272\362\203\001\013\237\346\277\263\017\006"
+	.string	"\016"
+	.ascii	"n\340\214\252\001/\\\004\265\002\200\002\210\201\003.\026wy="
+	.ascii	";\250\271\224L|\356H\330@\033"
+	.text
+	.section	.gnu.lto_.ipa_sra.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375 \263\365\002"
+	.string	"\"E\016\024\300%\303\001\377\256\377\377\377\314^\2004\262\367\336mK\231R\356\016\27402>\223\321\225}\3448\024\357\"\341"
+	.string	"\243F1\031\210\207@2\332\250\212\244\241\376j:\025\034\004\016"
+	.string	" F\252"
+	.string	";A\227\270\f@h\232G\270"
+	.string	"\\\204\300BQG\215\221Qc\264\f\001\306\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\222\002\r\017"
+	.string	"\006\330O? o\223t\023\274MM<\301\202,\203R\036\310\303\241\377\261\314\372\320\"#Q:\300b\241\231z;3\001D3\2631\315o\037\022\260\200"
+	.string	"\202\024\024@ Q\212\216\375\337Z\353f7\221;\005;"
+	.string	">"
+	.string	"@"
+	.ascii	"8^\003\315\314\274\224\221\n(\325s\032\n\311\244T\341\267\251"
+	.ascii	"\336\367iT\204\347\001\bs\033\313\356\357\322\376{9"
+	.string	"\315L\317\364\007\252\342\344\244\305\325?\004\305 r\"\203\345\257\233\203W\266\024Q\323JF\036 p\314\214\233\026\242!\302\250r1sQS\023\027)&\334\325\234\2122\263r\253\234^Af.x\352\252\2376\340\252r\334BJ\254(\0010\216ecY\177\f\006wJ\241\004\032U\243\020B)\0350\277Q\017 ,^d\264\336\325k\031| \301\310\230\272\356\261\300\247Y\277im\262D\355K0Y\345\270_\247\245\217\320\210\345\351\357\261\254\365\257\323Pd&\025\337\221\234\325\216\r\037!\021k\313aY\221\324F\001X\215\232\212\252\3772;\032\220\360x\004\370B\016n\375\240\013\034bT\002\211\205\021\231\366S\275~\033\r\361\001!]\256\b\230\350\337f\274/\001A\25019C\344\320\0042\022\223\224\2061`\2421R\267\007\022@eA%\2612\301\334LZ\373g1\034tP3\373F\005\034\361\335"
+	.ascii	"\240\004$\204\314\002](\362y}\240\212\026\367\205\370\t\307\217"
+	.ascii	"<\265\357\256\376\241\271 \256\312\376\246$\333\242 g7\254\251"
+	.ascii	"\313\271\017\246&Ub\367\310\001\254\016~\302\313\253\001\235"
+	.ascii	"nu\233\"(#$tMs.\347Ivl\224\3603\271\251\207\273\304\301'f\033"
+	.ascii	"\223\335\025\250\307\023\276\017\226\221#\3552*\303\216h\264"
+	.ascii	"\310\331\255\253\235\021\276\325\t\334\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`q"
+	.string	"\275\004"
+	.string	"\362H\027\035\240%I\007\217\256x\025\030\003"
+	.string	"\300SM\252\272\250K|\211\214\033\261\255\021\273\267L2\333,}1\300\365\222B\375\005\024\276\262\314\322\2339z\201\361$\326\032F\260\003;K\370\251\034\307K\n\267\007\363\265\312\234\037\330Z\327\214s\316\371V\031>[<i+\013\331\205\274q\233\331\205\026"
+	.ascii	"I\017\250\031\271(\206N\320\256\256\206\372\212Ue#\240(\256\037"
+	.ascii	"\022>s\027\264KS\034\231\304\360\024\367R3\226\020\200Pe\300"
+	.ascii	"\334\247\002\237Y\fy\036W\200!"
+	.text
+	.section	.gnu.lto_.pureconst.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\270\004\003\232\004\004\231\004\005\230\004\006\232\004\007"
+	.ascii	"\232\004\b\265\004\t\205\004\n\232\004\013\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\005\006"
+	.ascii	"B\b\032!\240'\351\340j\\\305.\005\270\353\374\357?W-e\342\006"
+	.ascii	"8\013F\024\375\267\326\310&\255\021\262e\n\013\006\205\300\262"
+	.ascii	"\247\312\322\214\3104\271\224]V\200\312#\355\036og\261\023\333"
+	.ascii	"\254\032\004\006\251wv^\210\347\335>Cw\315e=-\020\222\024OcH"
+	.ascii	"0z\374\210E\234Y:\317\357]YW\254\214!;\031\371\036\002% \200"
+	.ascii	"\002\2319\363\001-\005D\013\330=-r\244d\200\\s\253\251\300\027"
+	.ascii	"\320<\020C\016\346\350\371\f\2307\240]\t\252\013d\354L\370\266"
+	.ascii	"$Y\260\310\f\270\326~\260\220\033\250\335\360\327c\206\273e\304"
+	.ascii	"\350#^\235(\370#\336\321\222\300\252i\031\214\3600V\212"
+	.text
+	.section	.gnu.lto_.lto.76007f62fa001f6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_config_streamer_init.6.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"\005\b"
+	.string	"\262\017980q\323\001\200\300v\312\350s\034d\300\232\222?\261\n$\211D\227\324\330a\204\214\360\257/\352w\247\023\273\006C\203\016Bw\314\f\222\366\205(\037\304\366\377\275\311\226)\005\326 (\030\262\207\006\020v\220\335\031\306i\243\220\306\231J\023\026\242\n\322\226M\222(4\232\031W\232X\202\267\013\215\233\246m\343f'\334[\033AK\231\324F\344\260\245\237\273\345R\270F\033#C\377\371\343\021={b^Vi\354\320\3238b\337\332\335u\004\355\243~\265\004D\nV\273 \253\232MI\226\022\333\357\330\027\f\350j\377\344(\335Q\032\037\330\005]Vv\303\005;p.\035\336s]rNp]\272\263U\006\035\001\252\017\225\231\335\235\221\344\335\265\363\237r\200\357\344]7\021\273k\375N!w\274m\004\333\022\266M\002\t"
+	.ascii	"8gU\305\263\314>\335\333&\334\322p\301\372[\215\016wx\321N2"
+	.text
+	.section	.gnu.lto_config_streamer_start.7.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\277\001\245\017"
+	.string	"&\034gH\340\262(\035\300\236\304\3440\037\300(\001\0162\030 \213\343J](\244\217\364\357B\246 \024+f\017\346\217\365\224\263\254\b\316YEA\022\261\002\224Q\303\3720c(\253*:"
+	.string	"\202\021\320\211\267T\030 \371d\357\275S\nP"
+	.string	"N"
+	.string	"U"
+	.ascii	"\373\3121\356\212%~\260\275Z\374\210\366\272\275\200\366\352"
+	.ascii	"\224\335\003\201\bQO\213\f\310\356rS\305S\247S\246\374\313\016"
+	.ascii	"\240\345R\235\226\370\244\013th\374\b\271Xt\344%\246u\331\245"
+	.ascii	"\213k%%h\302\356Z\266\\#\356z\333\025lc\260%\201\247\273\273"
+	.ascii	"\236/\3734?\350\342_\037\373)\225\276h\306\264\314\016\350\330"
+	.ascii	"}\371\361\331\233ZC\306\366C\266v\2034a|&u\032\333P\001\313J"
+	.ascii	"\3412\356n\211/l\257$T\033IRT\361\261\260\275j3\322\245}\027"
+	.ascii	"\177\221zl\345\0036'\371\226IVSeQ\215\t\234\303xt\306i\224\366"
+	.ascii	"i2\303\203%yl\177\237\201\332>Crb$@\323\366p\031\266\t\220#k"
+	.ascii	"\\8u\332\341c\250l\273\033\301\237\201\3700a,^\375\025\355Ud"
+	.ascii	"\305\t\026\371\343\313\350\004\361\261\262\307\026Ur\302\330"
+	.ascii	"\001^\bSH\275\260dB\355I\320\320\240\203\340\2004J\320\335\335"
+	.ascii	"\b\364N%\017L\t3\234\2306\240|\035\207b*\235\270\016\f\271\221"
+	.ascii	"\002\177\035<\220K\371>\220\013\211{\272\363e\n8nX\346\312\f"
+	.ascii	"n\237\334\006lG\244\305H'\314Q\332\210\n1\260cGC\021\2226\207"
+	.ascii	"$ \220\002\031A\273\001\330\263\252\347yz\037\206\326\275\260"
+	.ascii	"\252\243\212\027\214;=.\331\370\262\350f\222[,\332\260k%hz\210"
+	.ascii	"T\204\315\336\027\236\265a\356K\266\263M.\243i\214\001\261\016"
+	.ascii	"\375\200\206\307D\f\236pjDE\033\003\001q\017\032\236\n9\2458"
+	.ascii	"{"
+	.text
+	.section	.gnu.lto_eraseConfigPages.9.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`s\002=\024"
+	.string	"\306\245\204I\320\322(\035bD\224K\272\017\025\363!\321A\200P\372\317~zA-[\271\247\f\300f(+\013~\342\245\036\361\373\363\005c\355\300\316m\334\177"
+	.string	"\033\3750J]|$\213\252\034H[\222\235A\354\355\202vb\367&r\247\024l"
+	.string	"m"
+	.string	"p"
+	.string	"9\005\237n\020~:\027\336n\261E\237\347=-\226\2019\235Q\314\361\261\365x\324\232C\211\234"
+	.ascii	"\375\004?\200~n\216\251\224\335D'\270R\346\317n\n\031m\337\271"
+	.ascii	"H\232\242\346\223B\217\321m\374p\020\224\340\263\202D\310\b\003"
+	.ascii	"\356.\310\350\275\313\230\361E\356wO\300\363\273"
+	.string	"\2155\227\246\222Z\253\345m\244\271\303\333\266\331\266`\313Z5l?h\362\347\357\016\252\030q\237\237\212~HU.\331\271\231\\\234}\bH1Jxql\361t\336\035RK\357u\267\004\245\017\022 \304\214\b;j\345\360\363QeL\027(\316\373u\227\366\351\230\362\201\374\236EJ\223:o%\234\315\204>\233\320\204\360\223\302\244|\026\376\316\342'\255\245~\236k\271\216\345\2656\003 \306\366\223Tk\365,T\256\270\257\211p\021pT\364\223C68/\346\342,w\224d\366\264\341\306\330!>\017\005\212lt\200\2133\370\025zZ\027\320\215\027\331\303 \276\016Hu\317\273\bM.\371$\345\332(-\371\333i\017\342\346eg~\357\337\340\033\227\006\216\035\321.\256\302\r\355C1\004:\265\322~\363\203.\244\301?\361\351WL\376\366\351\307\350']\031\257\030L\005{Q\263H0,X9`\360`\304"
+	.string	"\313D\245\002z5\342b\241\250X.\330\353\202\311I\206\224\326\n\225r\242BA\255\\/\324\310\001\267TX.\024\254\325r\241\304\\\375\342\204IJG\024\274\214\276\367\323\216\222\f\030\356\356\272\204\266.&L\2133\t\214)\356$\222t\245ws"
+	.ascii	"\035\371\276\330[\330(:\371~*\311-\241\311\245\203\265\326J\305"
+	.ascii	"\275.\f0 P\002Q\344\226\007\3663(=?\2576'\016\341\342\036\337"
+	.ascii	"mMh9\342\006\036z\306`(\207\314\374\035\256\325\n\344ZI\366\262"
+	.ascii	"\0061[\366\002\376G\016\211{\3566\211\225\t#\260\004\002B\005"
+	.ascii	"R\261\374\341\306P\354F(\305W\345& +F-D/\310\234X9\347o7J\f\301"
+	.ascii	"}`+25\2647\324\215ek\bxD#\304u\256\367\004"
+	.text
+	.section	.gnu.lto_write_word.10.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\r\003u\030"
+	.string	"&\256\242I\300\226M:HH\222\313)\264\266\326\001\324d\251+\332\356\202Y\"\004\245\377\023\251\227\363\021\334,"
+	.string	"\257\376\220\215\305\373\230\215\325\232\354\274\336\245\202\002\344w\226\205 A\t\256\211\210\374E6}i\324I7B\310&[\246\024\211"
+	.string	"\213"
+	.string	"\220"
+	.string	"EL\230Uk\216-\026\304Sz\304\365=\021_\310\207\334^\236\270\200Z\211\2424\325Z2\360\003\361\324\245h\333\007\362\243\233\375\364\225Fd\230\203\222\343U\325Z[5\247\001O\277\017"
+	.ascii	"Og\321o\007\3517\367\346\307\220<\007E\030\247\337\004\250\027"
+	.ascii	"Af\310\237\357CYv#\t\264\337\231\276,\310\237\221\364\331\371"
+	.ascii	")\020\202z1C\366|4T\206\264\234\367MA\002\355\2067\265V\257\216"
+	.ascii	"tq\207\267\r\302v\314\236\016\002/\362\307|\351f\205\353\360"
+	.ascii	"\345\017\202\353\031\256\027\\\177&\201\221P\215\242(\323JY["
+	.ascii	"\204\371R\247P\247\036_\372\355S+\256+9\322H\245\230D\236 \261"
+	.ascii	"\207b\305\225"
+	.string	"\354\321;G\362\223\024 \"\022:\252\265\216\247IHl\257@A\254\\\016\312\024\330\303E\367I;Gb#PV\027\237\361\243\352\250\352\324\033~d\307\036O\327G\272\215T\212\313>\317H\211\032\237\262\222#\222\236\034U\325Z.85\006\2216\271v\277{N4\242LE5\304\344\013\347\316\016\273+>\353\345\347]\254B\006YM\341\224\356D\226\300\250V\334u~\223?\305\354\017\262\275N\006\236\206s\253\344\300(=F\t\227\250'\2718\325e\312\212\313\316'\275\006\267Ww\262\311H\035\220\332)s\205\206\f\332%]\250\340\230S\207\027\374\263\303\016\213\317z\261\235\363&?E\360{\264\231Xk=\217\023\340\351'\200\035Bp\033\306\347\375\302\225\017+\252\272Wv\331\263S\207\375\257N\"\033\\\217\001\265Z\214\206\203\363\nk6\235\227N\r\214\331B\274HP\307$\3404\200Ap\340\2621"
+	.string	"\273a6\264X\316+F\323\251q\370 \363 b\006k\211\220\275rZ0Z\255e\203\300\263\0211ZKg6\243\265\306\022\367\217\216\363L\257\200BF\256\367\331P(\202\312\365\366s\316\024\266\347\364\rn\366\200\0036f\202\323\316\240a\257\033\347y\277\371\231<\333\353-\211A\277\227"
+	.ascii	"Y\223\266\303\"\343d#\2125\277\024`\355\027l\257c\315\323\270"
+	.ascii	"\3213y|\246_E6 P\"2\245\347\001\230Y\325\236\337\255V\024de*"
+	.ascii	"\f\226\343\266Wjk\213\022\221\347\271\021,\361\2231$\260\365"
+	.ascii	"\331\373h^\327\302\245AK\254W\260\013\264'\021\367\330i\351\245"
+	.ascii	"\306\212I\240\332\230\bG\352r\250K\321\353\312\026F\204r-R6\331"
+	.ascii	"\013q\231\346\300\217\356\346\327\r\345\3746\032\002[\375,\321"
+	.ascii	"\177?\267x\2053\211e\230\343\343\341y\334\235d\203\025\241->"
+	.ascii	"-\361LU\213\241"
+	.text
+	.section	.gnu.lto_config_streamer_write.11.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\252\003\225\031"
+	.string	"\006/\243G\300ZMc\004\342\333;Y1#H\267\352\375XrP>\026\261\341\256J\346#\255\207\303\272x\347\210$\220\360\272\240\276&\260\262\244\243@\300|w]\004Ch\337\372\266!DaF\177\273\305\242\026g\357-\245\224)\005\213"
+	.string	"\207"
+	.string	"\217"
+	.string	"\340\255\265\271>\355\037]\b\355\344\211\017\270\027\027%\311\275\344\003G"
+	.string	"oM\202\007\362 4{W\311\334x#\034BJ`\356\275-\326W\336m}\001\357\226\336\240\315J\336\336\244\375\363l\245\223\346+\275\3760\342$\216?\377\352w#\312\221\032\205\352\315\023S\371\245\317\241\021hz\001v\270\270m\361Z#\334\300\304H\215\267*\363$d%\034m\223~\351\f\2128\211\243\213\317\257\302\275\327S\034W\334\340m\023\331\346`\323\036\001<4j\023\312_z\365Qc\226P\252\334\te\223?\223\026\331\277\311=1\231\342\354U\235V\235\374SO\372g>\344\017\257\273Ap\372\373\246\275:m\275\351j\247i\235\236u\372\007\b\214\241b\201\313\275DQa\356\024[\352\270\356\267oq.\237\210\277\344\320\026\271l\235\317o\220\n"
+	.string	")\214r0\335K6\270\265\006\360\3666\315\016m\373\302E\347\223HT\001\327f#\006\206\024\2569\304\007\201\200kCBq!b\223\201Yi\212\332\0338\314\213\226\262n\364\307v\2077!A\303d\001\226\232*\277\370\211\f\036\270J\213\\\357\2357\351\f)\213m>Y\246\354R\205R\333&\276\304\303\201\334\275\367\306~\275\204\255r\261+\021q;C\277\210M\265#\311\221\201\276\217wKiU\032\2021\351\021\232\334\305&\007?\235\224\356\202f"
+	.ascii	"\315(\333#n\304;\360\336;\301/\362\001\007\304q\353\237\360n"
+	.ascii	"Oi\214\216j3\3122\245\024\252kr\033\251Cz\335\003=\257\035\032"
+	.ascii	"+!\343\251;w\214\002\b\b0\t6\256\232\004\260\033V3\213\341\274"
+	.ascii	"b\263\036\036\017\"d!rt`\255\034\331\013\247\005\233\361\264"
+	.ascii	"j\024Xg'6k\365\350\350\314Z!yOq*\312\252Q GQ\321T\226#\245\007"
+	.ascii	"(\305|\264\3106\242]\321\017\306\f)H\207@\372\321\371\003I\213"
+	.ascii	"GC\372\315P\217z[\204\306\324f\224\225Q\003\244\025j\023\352"
+	.ascii	"\365\336{\275\025\2536\241ls\220\256\350\203z<i\005\224\311\302"
+	.ascii	"6\370\223\025\026/N\226\332\031\356\304;P5\257\004G\250a,\310"
+	.ascii	"\2203dFF\002\021\241\221\344\032p\002\231\271c\007\021\300\271"
+	.ascii	"\252\253\244\245\345h\017\251p\341k\024B\215\344\341q\202\004"
+	.ascii	"\320$\245\220\330'\205)\361R\354\3563\367\355\202\006\357\200"
+	.ascii	"\375RICkC\032\321\302\236r\333\265:\377A\0233\253M\261\375\357"
+	.ascii	"(\301X\352j\304y\232A\232\377\320@F\307\270\301\2335\321\\\002"
+	.ascii	"Z\200\036\033\266Q\023eT\322#\252##\035j\223O\314A3\034Y\fq\273"
+	.ascii	"\213\255\227\252\253\353\231\256\264\242?g\"\260\211;\2726)G"
+	.ascii	"\"\272\272j\\\245\023\032*"
+	.text
+	.section	.gnu.lto_config_streamer_is_erased.12.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\"\003M\030"
+	.string	"\026\356\237H\300VQ:\320`\317\030\366GT\223oZ\261\201Hm\344C\006\255\233\263\202\023H"
+	.string	"L\377\007G\003\022P\007\033?)\376\\\003\2239jC\244tv\225\004E#\347\027\300on+\t\300~\f\265\036)i{o\271S\n\212"
+	.string	"\205"
+	.string	"\221"
+	.string	"\266|\322Z\360Bt>\304L\fSk\020\226\244Z+\003c\370>\021H\231\324\212\321>\321\203\350\274(\347\003j\025ZJ\252\025d`\b\337\247\301\027\240\237\337\t\320\317\007\022t<;X\243\3476t6#^\255 ki\230\306\331St\312\2153\337\304S\001n6\236[-\322\036>\237(\244\254\240\344\323\023\340vBF\034LYT7[\334\207\217JSpUv7\237\307\324L\255\325q\347\326\342\376n{\307\366\006{Y\001\006kq\207\354Op\261t\303+d\257R\321\252\017\371c^\364\177\216\246\317\3353\025-S\321K\243\343\214>\200\277H\342e\271\320\244\326\236\236\227\032e*\331\361\334o\3377\372\021\316\213\370\273U\242\362\243\326\252\272n\246\246\242\312\235\221\"D<\272\243\025\343u8/\3121"
+	.string	"\326\026\007\002\302#\342}J+-\237\210\037J\246\226\235\313yM\301\002\206g\305\221S\255\340\202Ok\270\021\216\255\372\274\255c\253\0020j\261\347\r\362\303#\352\254\314h2\005\364z\275\336_4n\fw%I\211\327\227\303\037A?\343\276\211\007\210\026{\373'\327\213\n\245\305\tP\216\213\334!\253vn\f\307t\"v\371\303\177O? \224\023\355\350H`\nj\324J\373\216\177\344H\037\374\034\237\276\201\305\357\300\350\247j\343\024\333\027Z\354\371G\217A\332\"\245\356\3769=9Am\231{\335\021\320b\224WK~\244l\223\f\036\274\365\267\317=C\fZx\351\343\270\307\240\032\243\034!\356\"\361\222I\273(\3304\250\211\340@\202\314\001\231\314\025\263\261\241I\271F&\346\272\241q\305D\3108xxu"
+	.string	"\001\253a\201x\321\334\260jb2\226L\002\303B\270b,\0210X\214\245\002i_!\303 \205\341^\3510Ka(\375\031}x\013LH!\022\372\317(\245\353\031\332\326R;d"
+	.ascii	"]\346j\347.~;\227g\256\334\250\003\007\345\333]\031\263\273\263"
+	.ascii	"\311\366\345\341\247\213\240\031Z\214\272\254\265V\272\332\347"
+	.ascii	"\344\355\204\316]\355S\0049 `\002\031Aw\036\035'S\272\253j\341"
+	.ascii	"m\345\035_SR\265\n.u\320\315\304\021\021\352\200\003\266\024"
+	.ascii	"\272(\366K\2645\354\2734\255\302\375\307#!+[\f\331\201>t\302"
+	.ascii	"\212\3333P\204\341\351\031N\023\321\370\301\345\203\202Py\035"
+	.ascii	"\247\032\204qICWC\261\221\244\245\266\027\030VA\216\307x\236"
+	.ascii	"jd\376\305\352\344\024\202\210[\201y\202\317.\201Y7\203\352\\"
+	.ascii	"\307\267\315[@\320\240\213\t=\337\245\302\353\302d"
+	.text
+	.section	.gnu.lto_config_streamer_status.13.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\r\t"
+	.string	"\026\321>9@s\322\001@\244\n\361K\016\206A\376\241-9l5C!_\356B\221\240\267\026i\210kS\230.QOH\373\374\030_\377\363\031\177\255\204\2000\372\302*\215F\366\336)\005-"
+	.string	"-"
+	.string	"."
+	.string	"\017qi\260\334\354.\375|\240sl\336\3239&?\016>\202\376S>K\\^T!\352\021\300aw\035U!\307-o\333\3006\204\355\231\273\033\257\234\245\301bFl\203\266fO\022\320\243}\326Q\300\327\323\005vW.\230\335z`\205\354\230kf\3337\371\th\267f\005\t\003\266-\276\342V\266\273\f\276\n\306E&r\314?\311"
+	.string	"\033V*\276\254ul\304\261+*J\017\373s\345\312\216\321\362\365\217\323#S\363\320\022\356\032$\020\270\205\004\320F\300\335\334\366u\243P\367\231J\021\024\242\t\222\307Q\222(4\242\334W\242[\201\275\212\356\243&\317\373\250V\367\266\224\237\224\314\b\r"
+	.string	"8gU\305\263\314\325"
+	.ascii	"\305S\330\330\231\301#c\201k\">\026\344\006\023\004\234xR\255"
+	.ascii	"\230\204I\006"
+	.text
+	.section	.gnu.lto_config_streamer_flush.14.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\023\002M\021"
+	.string	"6\037nG\320TQ:8%$\031\301\233\246\026\203f5\\\035\350\013K\266n=\246g\347\201\007X\273f\f<\034E\177{\265\306|\365E\241\017\231\244T\236b\004V4\007\003$\212\231\370\0041\341\217\365\211\242\337\222\275\245L)W"
+	.string	"S"
+	.string	"\\"
+	.ascii	"\2669C\003N \272t(\262\355\253\370\n\227}\213!-\366\233\0365"
+	.ascii	"\265\2379\247w\272\251\273\214'u\227;\342\256\307U\227\377\234"
+	.ascii	"\307\0242|\300\330\353\021\3047\026\310\315\030r\022\233\211"
+	.ascii	"&\233\022\340s\256\036b0\325P\2039\247\025\214}\270\345m;\260"
+	.ascii	"\r\301\326U\"\022\227~Lw\3715\271\301\221\321 k\217\r\035S\213"
+	.ascii	"\330\341Kwf?\316\225\331\252\036=\374IT\035\352\324\235T\313"
+	.ascii	"\250\216\253\336U\253\252\037\200\364\223\343\301\2179m\202\214"
+	.ascii	"L\034\222\307\204m\227]bG\021*W\3738g\341z\030s\001s\312n\004"
+	.ascii	"&Z\f\224nM\244\334HwS.\327\376Rz\320'\232}\255D\341\303\340P"
+	.ascii	"\242\201v\313_\250\b\3402\334\305\352\262\204\213\25350\304\306"
+	.ascii	"\273F\267\373\035\232\0230\r\362W7\344\243\346\b\200\036\237"
+	.ascii	"\323\200r\266\335\231S\376\255\240\303cF\201l\263\336\3027\321"
+	.ascii	"\234s\201\257\203aCN1\260p\340S\200@\0055\340\273?T+\265bI\265"
+	.ascii	"`^VZT\027\\X\237\347\242bYy_\353\305C\241\230\245!\325\362`X"
+	.ascii	"\254\226W\022\316\307\271\262\321\236d\026f\032{\262\203H\334"
+	.ascii	"\031\317\b'$Hh\355\b\267\371&2\241i\r\004R\322nI\326\2260A\017"
+	.ascii	"\206\366\324a_\266)|g%. `\002\021\251e\007\030fU\312\263\264"
+	.ascii	"\017B\333\346\332M]\031O\307~\220qv\375\220C3\201\236\006\327"
+	.ascii	"\375\017\236\271\262\016\263\006h\330\300\t\307u\324\013^\317"
+	.ascii	"a*\211\243f\232jw\237\255aB\202\025G\264\203\f\200hD\3350\252"
+	.ascii	"\300'Y`\357\301r\017\324(\263\3346\332lM\344/b_\205 8\021\311"
+	.ascii	"\rZ\2134\2450P"
+	.text
+	.section	.gnu.lto_config_streamer_finish.15.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`!\001\r\r"
+	.string	"\226\227WD\360r\234\016*\006\265\223\021\303\035\246\312\366\231\253^AM*\300\375\242o+[\204r|Mz\203\2370\204\210Q9\355\234\375\251uO\232\305I?\003\235C\305\031G9\002\315\327\277U\336\004ND\310\226;\245C"
+	.string	"@"
+	.string	"F"
+	.string	"$?4\244\270\354\356\326\371\006\3735\037"
+	.ascii	"\373\245!\016~\252"
+	.string	"\004\375\237|\232\210\261\"\024Q\237\036\256\223@\213\013\035\0321dnDF\204?\271\334 \252\244\314\030\354\256e(v\270\257\333n`\373\201}S\272\262U:\373\370O)}\355%\034\\n8h\355\212\264z\354\214\353\005\t\333\240\215\261\325\307\347\322\276\311S\200\037O\007\260\273\222\241\262;\0260\002\355\227G\315\266\177\342(@{e\216,\361\001\034\020,\232\264-\220\344CwT\2122\b\214\017,g\275\264\250\250M\3305\002\212\215\020\371b\373\302U\230\264\335U\340\243`\310\240\211\370\345\237\260_\327\f\211IJ\266\274)\261;p\254\344a\217(\251#\366\347\006\356\026H0\300%8\360\361\b\340n\316\363u\"P\367\225H\020(\204&\214<n\033\205@\242\215\373H\233g\200\275\n\335\267\225<\357\3330\343~\256\2562\355\244Te[\364\026^\311TS\243d\352H\312YdX\034\0329\002\031"
+	.ascii	"8gU\305\263\314>\337o[\261Um\214'\030n\310pX!\020\002\373\302"
+	.ascii	"4/\322\231a.\032\254\005\202Q\204@\217p\032Mp\256\341NZ\274\253"
+	.ascii	"L<\270\033I5h\225HS\n\005\005"
+	.text
+	.section	.gnu.lto_write_word.part.0.24.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`F\003\325\027"
+	.string	"\346\253\231F\300\332(\035\240\205\310b\376\242q\212\007Q*\007;f\253h0*"
+	.string	"m\243\007[&\373\355\261\223{\213\375w\346\360V\032w\275\"\253^\004\001\214e\021LY\0170\321@;\273\333Az\366\f\225|\262\211\334)\005\202"
+	.string	"\207"
+	.string	"\200"
+	.string	"UG\231\f\260+\361A@\326\0307:$\316\371%~\222\223\261+\3619\201ZuX\212j%\033\234:Bxj2\264\177\004v\263\355\033yP\314\256\362\221@8R\355\250&\324\253\265\242NO?"
+	.string	"\236~7"
+	.string	"\236n\217\307N\277\235`\314\2376\234\354\264\002\217\350\303\2603c\303\321\370~\026\264\3148\022"
+	.string	"G\373\276\203\f\223\363>]\340fs\0268H\272PkuX\343&\335\366\006\333+{Q\0044\022\007\202\3702\317I \030\025\212\364P\247k\3377\242RR0\342\215\276\363\3130e(\273\205D-^\234\201\362\"\333\344\327\237\370D\tt\272\\P\255\325t*%\312\370\312\342V\252\325\216\316\200ADp^\312\353Q\306\337(\322\013\352q\b\241\274<\375\035\314\347\331\344\241\036\237h\337\305L\2474\213h\337\311P\317\211FV\\\211\335\225\240^\255$\316\2515\204\206\275\311\211\217\254\270\"q\347\205\336\344\204K5\313\303\337{\300o=0\031C\233j<K\"\337~\367\323\317\\\343"
+	.string	"sw\256\275\0021o\373\366\264be\266w~4\206\265\326\t\376\225\024!| >\340\351\334\005b\220\374\3146>\3577\345\220/u\256\231\313\303\013\376\253\265V\257\316.M\223\302i0\234\246\337\335\337\205\376\r\247\347\227\374\007\300\340\207\200\\\2550\332\260\2518h\031\344\273\337\350V\fA\204\231\347$\033`\233\2019\022R\003\343\270j\351\350\244H\343\313\225r\215\340\352%\"e\202zEA\307\201J\302\0031G\201\352V\345\264V#R\253\226k\354"
+	.string	"b\347\003\t\226\nEb'5\002\245j\215\250\234\005f\225X\265P.\026\253\2052}u\346\241\221\373p~\336K9dpY\025w\025\220\264.l\223\326\027~v\346\245\2634\002\267\313\270@\267\241\371\356, ]p\247\020\213\334l\266\331Bw}\314r\312\246\361\262C\314w3\303I]\035\006P\032\331\337\344\264\330\330@\250Q<\343\224Q\304\030\033\211dD\332\026\007`\242Q\320\356\021p\305\224\304F\241\315\030\332J\235\343\345\227\017\"\276\373'\023\243\261\006\242\223!\3514|3\360yo\236c\356\261\346\b\210\377Sc\351\n\335[\377\220\305\007GhX\267\222\304\315%\013\306\266\221\004\r\323\235>\274V\031 \246\371\343\213#\307\312\247k-\013Yu\032\\c\317\316"
+	.ascii	"'\334\034\303\307\215\355\225\241\341|\200\277\321\035\256A\261"
+	.ascii	"\0053\254\316uh\360\301\213f\235\217Vh"
+	.text
+	.section	.gnu.lto_.symbol_nodes.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\372"
+	.string	"\355\007"
+	.string	"t\013\366\001"
+	.string	""
+	.string	""
+	.string	"\002\t\177\016\252\333\3426\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\023\017`\025\020\002\030\177\021\200\200\200\200\004 \n\177\022\006\006\177\023\272\220\202\002\007\177\024\013\177\025\360\372\2508\f\177\026\252\331\2276\r\177\027\016\177\030\017\177\031\001\024\177\032\377\037"
+	.string	""
+	.string	"\200\220\200\001\022\177\033\020\177\034\021\177\035\026\177\036\003"
+	.string	"\f\312\302\353\343\003\001\304\001\003\003\rd\003\004"
+	.string	"\323\243\362\362"
+	.string	"\001\242\007\003\004\003\227\321\317\317\002\001\242\n\003\005\016D\003\006\017\320\360\372\250\001\001\244\006\003\007\004\244\262\235\334"
+	.string	"\001\302\007\003\n\016\n\004\202\007\003\013\020\244\001"
+	.string	"\035"
+	.string	"`h\227\201\315Y\206C\007N4\203\002\365"
+	.string	"\340"
+	.string	"\340\360\001\302\372\245~\020\f\227=@\273\235\337\245\022\266b\216\001\220\351\020`bb;\t"
+	.ascii	"nT\025\020p\003\202\013|zZw\251; \260\024\224'"
+	.text
+	.section	.gnu.lto_.refs.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\003"
+	.string	"\002\002\022"
+	.string	"\001\004\002\001\t"
+	.string	"\001\b\002\001\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.76007f62fa001f6,"e",@progbits
+	.string	"(\265/\375`\345\021\005W"
+	.ascii	"\332\222H U@\322%\245\003\332\324\003\333\374\005\025'\325\347"
+	.ascii	"\221\320\312\021\037\306\244\031p\233.\305\310\220m\260y9g\363"
+	.ascii	"\277\350:\003i\320o\255\025N\250\263\177;u\3164\1773n\316\b5"
+	.ascii	"\"g\252\252UE\023\314\340\313\300k7q\213\235p\032u\334\r[\032"
+	.ascii	"\311\2272\005\246\001\361\001\373\0017X\326\302[X\3723>\273\312"
+	.string	"$\247\305\245\3253\022{\030\370g\274s\020{\236\262R\270\214\323\232\033\220u\275\335{\017\301\017d\306Ox\354\204\f\367>\217\350xQ\263\344d\356\336u\3129\260\224\315\256\256*T\230\350\365\bc\202\343\251\347\2623\231\n\367\n\340s3[\223\264\312U\330\nK\013\340+g\321\342;#\330\345\362\255a\262\206\256\325\027\331\327q\001<\236\002t\246\"\202\267l\256W\207\202\032\2024iuGd\031\nGai\017\213\235W\366z/\271\336\350\275\253No\355\f\ra\255>\005\213\023\343\034v\002\300n\213\003`\317=<\035\356\341}\307\276g\237\306#x\347\331\267UY\004\017\005\217\340\3558\371y\213\271~\266S69o\330\275+\217\2125M\002i\365+\217\340Y\026\301\373\331\207\306\027\235\277Elp\020\177\213 \306\206\364\363\214\024 $\300\201\001]\2015\233\376'\373?\206\207\377l\\\302\177"
+	.string	"\3763\360\377\304\177\032'\3617\004?\3370\t\377\323\360\bdP`\021\036\300\337<\334"
+	.ascii	"\b\377\257\360\007\377Q\370\331\003\037\376\343\374,\367_\314"
+	.ascii	"\317\030t\360\037\314\377\265\377d\332\356\373\233\201\237-\340"
+	.ascii	"\3406\177\023\360\363\006"
+	.string	"?g\360s\214\237\177~V\361\363\002?\247\3709\201\237\r\370\331\304\317\"~\366\375l\177\356\375\257\373\257\346?\335\1773\377\313\376\227\371/\366\377\313\177\032g\376\303\375\177\373\357\366\177\306\377\266\377\\\377\017\370\177\366?D]]]\335\337s\177o\371}\273g\27248\367\236\350=\243Qh\255\262\017\274\246\217\"rS<w\025\314\351\333\035y\240Ui\365\215\303\376\375\363\356qy\357\315a\263^+H\234\263\315\271\347\367\361\356\352.E\326\275Sqq\274-\317\036qGq/\270W\2062\371\\\362(\243G#\017\323\372d*\243O&\317]\301z\334h\220{\225I\247\261\217w\275\314\235\233|2\355=\276)\327\273\344\271\353q\311\367\271T\206\035\215<\312\350\323\250\214:\231<\312\365\311\274\311k\264I\260{\223N&\017t}^e\364\310\334QF\235F\2518\"n\"\334\242tLe\362\342\030"
+	.ascii	"\232t.\323\224\253\223\255\334k\fS\272K^\357}\336;\203\023\001"
+	.ascii	"+\311*\243\025d\032\216\233fr5r\224\023\222\312\331[\2217M\231"
+	.ascii	"\345<R\272\227\355:E`d\343z\357]\272H#\337\253\264.\357E:Uh:"
+	.ascii	"\031\314\322\362\372n\362\330\204\244r\342(!\235K7\013\b3\225"
+	.ascii	"Q*'\320\025(\321\253\213\\\215|u\331\236K\0335\256Wy\357\345"
+	.ascii	"3>9*a\346\342\316\370\260\272\214\221\265\272F\003h.\301a\206"
+	.ascii	"\315\270\206Ti\301\275\355n8\211\253\262r\341<=\325\340\344A"
+	.ascii	"\355f+\007\252\263\033\267\345H\345\266\024i\265L\t\034'Q<\250"
+	.ascii	"\260X^\343,\314\345\004R\371A\327\326\033\343\360\003E\331,'"
+	.ascii	"\271s\223Ua`\322+\257\257Osz\367>\305\256\326\030\313\2479\311"
+	.ascii	"5\001\256\2458\350\2757\f\263\361\030&\303bx\007\226\362"
+	.string	"\032\243\235\273\260\016/\261\336\233d\256\237\273~\026-x\215\323X-\307\270\336'\026cKq*J\250\300\231[\306\341\310QY\255\371\013\2039\253\261\027\234$\253\251\367\036\231\021\310aF\300f\232\344\210\003O=_\261\3470\333\227G\360Pp<\230\314V\233\311\333:\253\255\t\256\325\206~\332\0243GdI\027*5d\253}C\016\331\222\364\254\325\333\\\333J\336Y\177\257G&%\3449g\377\306\372{7bk?\256\316\330\253e\354\316\n\t\222\266\342\235\025\031\306\352\212\267*\273\224\252\336V;\304\276\232\255v\022\346\322UJ~\234\251[\354\316G\027)\322GJ8\215p/\246ijf\346\356m\366\210\300C\214\031#\357#\234\246\3116'\204\213M\231\260\034Z\214\330\235\333\220!k\260\274\300\241\265z5\207U\235:H\007\351\347\316E\216)s\245zib\303\372\301\252D\234\316~\366\306\350"
+	.ascii	"\005\205\266\241I)\201\274\237S\013%\t\226d\030\253~\375\370"
+	.ascii	"\321R&\306H\241\240P\213f\006L\027\ro)V\013\361%E\310\223V{\206"
+	.ascii	"1\253\242\351\035\275\243\243\330\b\022(\350\234\315a\206\256"
+	.ascii	"\333|GM}lboS\255v\017\035\034cjpk\265y0\034\316\232\234\0242"
+	.ascii	";-\313\333\352\247~j\250\335\275RtW\273\257&SJ9\336Pn\252\022"
+	.ascii	"\230\2525\25563\212YT\253\325^2\027\373\303\307\322\323\247\352"
+	.ascii	"\216+[hS\226'\206\351L\355\304\315\273+\343\326\354\321a\302"
+	.ascii	"\206DK\323\333\311\r\204\017Yn(\273\f\215\311\251\325\357n\330"
+	.ascii	"\033\215\255\344\335\313\253\363ii\003\355c\313\320\307VZ\343"
+	.ascii	"\315\222"
+	.string	"\226^z+?\275\202\243S\323j#[i\247\303k\372C+u\f \322\230\306\2522>0:\252\333j'\031\315\232YUA\265z4<\366\277\307\353\362\364C\232:\373n\263\273\0331\316uuL\366]\362Jm]5\226(QZivwc\234\325HY\r\2231\330}\222\321\344fq`\247%\206e\311\025k\323C\fF\303=\234\345\244,\307t\366\336\033\202\210\023(\350\334m.{\376\243\tC\241\243!\024D\277\240\021\220\030L\362a@\004\346\2600$\f\001\204\t?\3621\n\002\207E\342\317\217(\ti(\b\374\031\022\223~H !%\005\203\302\340M1\210gC8<*\n\2037EB?$\265\370#\326\370\325\340\021\r\205'\324\020\032\032\t\2072x~\344\023\002\r\020f\374\024\177FC\241\"\n\016t\216\210\300 \260\210\304\0211\t\251\210H\202(\210\b41\242\b\f\002\203\002"
+	.string	"\261\302\2478\024j\301\207h(\264\021\364+\002\2076x\210\202?\234\342P(((\347C\304\244\242PqF\320\00730\b\241\003\034\342\317HH\206\006?\242\320\360\267\363!\340\360\027\374\031\331G\340\342\001\027/\\\270\371\013\030+`\254\340\375\005\f  \030.\200\354]"
+	.ascii	"\355\212HBa\006A6D?\026\206\204H\301$K\f\342)\006\r\213-\364"
+	.ascii	"\210\304\337\220\210H\350\346\367\002\220\250\376(\305\205-\374"
+	.ascii	"\206?E\241p\370\023\242\030\364\342f\005.\006\261\200\240\030"
+	.ascii	"\004&\331\377$ Z1\024\001P\013\037\002>\301\004\032\2400a\004"
+	.ascii	"\017\354\220\317\360WC\3507,\022\203\214\200EA\341\320O\020("
+	.ascii	"T\343ghH\374\361Q\300\006\017\177EEI+\360\212B=\034\376v\323"
+	.ascii	"\266\212\301\311GY\233\225q\032t\352\252\313\232\314n\251r\204"
+	.ascii	"jK\205\351m\212\025\345\262\007\331\223\256B\307\225\005$\206"
+	.ascii	"Vy\316\261\2462\326S\254tHyOQSu\3201\261\301\246K\354\210N\032"
+	.ascii	"\254\033WR&k5\264&\344\212\223\345IS\262\2434\230*\215*B\325"
+	.ascii	"P\332+\315\253\316H\253;\035\321h\203%\271\3629\337\250\220Q"
+	.ascii	"bw\322\257\377\253\301JLW53"
+	.string	"s\275#I\260\324\264\312\322\006\263\371\222U%6\304\356\252\330\360\326\262\241\275vk\274\336\246s\307C\0262]\320\253l\366\204\370b\372\362\322\344\355\365\356b\321\342m\320\033\326\216\255\266\223\3474\321\310\336\266\232\353\357\201P\"$\272d\311\376\001\260\201m\250\241 h D#2#\"\222$I:a\005\204 &\251\264\r\022\200UE\221)\206DdF\223J\255\351$\326\240\270\346\210\236\347D\024\225\002\271\2044\361\277t@P<\272Hj\322\020\340yOI\236\2168\215\303i\367\315JI\320\230\210\030\307\207=\322\254M+{U\307\311\376\177\377Dj\325\276_\211?a%\272\341\022\257%\253\255\304R4u\244\250\244Tf\t\006\227\362G\353tA\031\346\366+aR\334I&\016\354\320\365\343\254&\215N\260\213\361j\030\231U)7\20456\216\352H\244\026\226.,\026\345\020\271\244S\331\243"
+	.string	"[\013\030|\211Npz\313\f8\255\370\245A\214\005\307\272\241\323K\306\276\201\214\205\247\331\232\276\242\347Z\033_\024j\217\332\274\240"
+	.string	"&\272b)\315D)\367S>p\311\272\227.6b\236Q\3735\370\324y\273\022+j\233|\256\t\362\024\260\315\363/(\325\026\001LY\254\323K)\366q\210\275\322*\327\342\260\307>\335\316\233\031\t\366\252A\204\3715\031q\001\223\251\310\220\346\204m]"
+	.string	"}\356\276\340\312=\265\033\fR\214\227\310\367\3475\214\332\322"
+	.string	"Y6^\347P\220\027\217\266c3\2427\271g\241c9W\300\030\346\310\363,\336\350\355"
+	.string	"\\z\313\221\337\033\323\021[y\220k\255E\b\323\324V\333\005\325\322\002W\200g\310\265\241\n\303\263\352\342hSL\242^\313\212\210\304;%dj\233\203\362\374M\225\237\007\342|\316Oc\234\f\270\334\315\b3*/\022\353\234\244;?P\376\361\034\2528\3043T\003\202Q\036\3221\262\207\":\034sI\251T\355\327\b\216\323\373\373\234\362\"\347\322\b~\375\347\203\347?\357\354\352\226\275\357BK\245\206\354\301\251\305O5\025\235}\360+\243oD\350\214E\026\036\240\\Q\037\271\002\363\357\334u\016\335\225\216\346q\007'zp5\373^C\300\252\274\022\004?-\270\036\216\257\370\350\"\247:\246\n\"I\272_\2305\233\220\206\210\303\275\204 \334eO\037\0022\202\365~\213\227l\033\212\032\352r\230\307\247\320\020\314\353\025M\246O\n\367H\362.\215\203\177\024\372\2349\237:s\273&\350"
+	.ascii	"\377\003]t\330\007\310z#\255\345C\273\032\177\332o%\007\367\347"
+	.ascii	"\030\336\022\327\351\027}B\002r\320q|\243\377\371Q[\276\334\355"
+	.ascii	"\377\265\263\372k>/F\247\177\323{\253\376V \330\317\356\214\277"
+	.ascii	"\2550\n\336\r|\233\220V\241\215\203\364\355\275\237\337T<\213"
+	.ascii	"-\253\330tkW\373.\254\253Z\2728\213Ny4db:\210\017\365K\334bU"
+	.ascii	"\247C\253\001"
+	.text
+	.section	.gnu.lto_.symtab.76007f62fa001f6,"e",@progbits
+	.string	"config_streamer_init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\001"
+	.string	""
+	.string	"config_streamer_start"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\001"
+	.string	""
+	.string	"config_streamer_write"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\001"
+	.string	""
+	.string	"config_streamer_is_erased"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\001"
+	.string	""
+	.string	"config_streamer_status"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\001"
+	.string	""
+	.string	"config_streamer_flush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"config_streamer_finish"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"__config_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"__config_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"FLASH_ErasePage"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"FLASH_ProgramWord"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"FLASH_Unlock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"FLASH_Lock"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.76007f62fa001f6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,7627 @@
+	.file	"parameter_group.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "/usr/include/string.h"
+	.file 6 "./src/main/config/parameter_group.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	parameter_group.c.5d582c65
+	.weak	parameter_group.c.5d582c65
+parameter_group.c.5d582c65:
+	.long	0x4de
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF1052
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF991
+	.uleb128 0x5
+	.long	.LASF998
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF992
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x8
+	.long	0x3c
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF993
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF994
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF995
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF996
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF997
+	.uleb128 0x5
+	.long	.LASF999
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x56
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1000
+	.uleb128 0x5
+	.long	.LASF1001
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x48
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1002
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x6b
+	.uleb128 0x8
+	.long	0x8c
+	.uleb128 0x5
+	.long	.LASF1003
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x8
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF1004
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x19
+	.byte	0x7
+	.byte	0x4
+	.long	0x5d
+	.byte	0x4
+	.byte	0x21
+	.byte	0xe
+	.long	0xeb
+	.uleb128 0xc
+	.long	.LASF1005
+	.value	0xfff
+	.uleb128 0xc
+	.long	.LASF1006
+	.value	0xf000
+	.uleb128 0xc
+	.long	.LASF1007
+	.value	0xfff
+	.uleb128 0x1a
+	.long	.LASF1008
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1009
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1010
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0xf7
+	.uleb128 0x1b
+	.long	0x102
+	.uleb128 0x7
+	.long	0x8a
+	.byte	0
+	.uleb128 0x1c
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x121
+	.uleb128 0x11
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x11
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x121
+	.byte	0
+	.uleb128 0x9
+	.long	0xeb
+	.uleb128 0x1d
+	.long	.LASF1053
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x10
+	.long	0x17c
+	.uleb128 0x12
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0xae
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1011
+	.byte	0x2e
+	.byte	0xe
+	.long	0x9d
+	.byte	0x2
+	.uleb128 0xd
+	.long	.LASF1012
+	.byte	0x2f
+	.byte	0xe
+	.long	0x17c
+	.byte	0x8
+	.uleb128 0xd
+	.long	.LASF1013
+	.byte	0x30
+	.byte	0xe
+	.long	0x17c
+	.byte	0x10
+	.uleb128 0x12
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x181
+	.byte	0x18
+	.uleb128 0xd
+	.long	.LASF1014
+	.byte	0x35
+	.byte	0x7
+	.long	0x102
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0x8c
+	.uleb128 0x9
+	.long	0x17c
+	.uleb128 0x5
+	.long	.LASF1015
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x126
+	.uleb128 0x8
+	.long	0x186
+	.uleb128 0x13
+	.long	0x192
+	.long	0x1a2
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0x197
+	.uleb128 0xe
+	.long	.LASF1016
+	.byte	0x4b
+	.byte	0x1b
+	.long	.LASF1018
+	.long	0x1a2
+	.uleb128 0xe
+	.long	.LASF1017
+	.byte	0x4c
+	.byte	0x1b
+	.long	.LASF1019
+	.long	0x1a2
+	.uleb128 0x13
+	.long	0x98
+	.long	0x1d0
+	.uleb128 0x14
+	.byte	0
+	.uleb128 0x8
+	.long	0x1c5
+	.uleb128 0xe
+	.long	.LASF1020
+	.byte	0x4f
+	.byte	0x16
+	.long	.LASF1021
+	.long	0x1d0
+	.uleb128 0xe
+	.long	.LASF1022
+	.byte	0x50
+	.byte	0x16
+	.long	.LASF1023
+	.long	0x1d0
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1024
+	.uleb128 0x15
+	.long	.LASF1025
+	.byte	0x2b
+	.long	0x8a
+	.long	0x218
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x7
+	.long	0x218
+	.uleb128 0x7
+	.long	0x29
+	.byte	0
+	.uleb128 0x9
+	.long	0x21d
+	.uleb128 0x1e
+	.uleb128 0x15
+	.long	.LASF1026
+	.byte	0x3d
+	.long	0x8a
+	.long	0x23c
+	.uleb128 0x7
+	.long	0x8a
+	.uleb128 0x7
+	.long	0x3c
+	.uleb128 0x7
+	.long	0x29
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1027
+	.byte	0x76
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x76
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x6
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x78
+	.byte	0x1f
+	.long	0x26c
+	.uleb128 0x6
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x7a
+	.byte	0x16
+	.long	0x17c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x192
+	.uleb128 0xa
+	.long	.LASF1028
+	.byte	0x68
+	.long	0x2a1
+	.uleb128 0x2
+	.long	.LASF1030
+	.byte	0x68
+	.byte	0x15
+	.long	0x3c
+	.uleb128 0x6
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x6a
+	.byte	0x1f
+	.long	0x26c
+	.uleb128 0x6
+	.uleb128 0x4
+	.long	.LASF1029
+	.byte	0x6f
+	.byte	0x16
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1039
+	.byte	0x60
+	.byte	0x5
+	.long	0x3c
+	.long	0x301
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x60
+	.byte	0x21
+	.long	0x26c
+	.uleb128 0x1
+	.string	"to"
+	.byte	0x6
+	.byte	0x60
+	.byte	0x2c
+	.long	0x8a
+	.uleb128 0x2
+	.long	.LASF1011
+	.byte	0x60
+	.byte	0x34
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x60
+	.byte	0x42
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1031
+	.byte	0x62
+	.byte	0xf
+	.long	0x43
+	.uleb128 0x6
+	.uleb128 0x4
+	.long	.LASF1032
+	.byte	0x62
+	.byte	0x3a
+	.long	0x3c
+	.uleb128 0x4
+	.long	.LASF1033
+	.byte	0x62
+	.byte	0x63
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1034
+	.byte	0x56
+	.long	0x369
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x56
+	.byte	0x21
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x56
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1035
+	.byte	0x56
+	.byte	0x44
+	.long	0x218
+	.uleb128 0x2
+	.long	.LASF1011
+	.byte	0x56
+	.byte	0x4e
+	.long	0x3c
+	.uleb128 0x2
+	.long	.LASF1036
+	.byte	0x56
+	.byte	0x58
+	.long	0x3c
+	.uleb128 0x6
+	.uleb128 0x4
+	.long	.LASF1031
+	.byte	0x5b
+	.byte	0x13
+	.long	0x43
+	.uleb128 0x6
+	.uleb128 0x4
+	.long	.LASF1037
+	.byte	0x5b
+	.byte	0x3e
+	.long	0x3c
+	.uleb128 0x4
+	.long	.LASF1038
+	.byte	0x5b
+	.byte	0x67
+	.long	0x9d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1040
+	.byte	0x4c
+	.byte	0x5
+	.long	0x39b
+	.long	0x39b
+	.uleb128 0x2
+	.long	.LASF1013
+	.byte	0x4c
+	.byte	0x17
+	.long	0x8a
+	.uleb128 0x1
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x23
+	.long	0xae
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x4e
+	.byte	0x19
+	.long	0x26c
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1041
+	.uleb128 0xa
+	.long	.LASF1042
+	.byte	0x43
+	.long	0x3b9
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x43
+	.byte	0x29
+	.long	0x26c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1043
+	.byte	0x3e
+	.long	0x3db
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x3e
+	.byte	0x22
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x3e
+	.byte	0x2b
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1051
+	.byte	0x6
+	.byte	0x30
+	.byte	0xd
+	.long	0x40a
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x30
+	.byte	0x31
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1044
+	.byte	0x30
+	.byte	0x3f
+	.long	0x17c
+	.uleb128 0x4
+	.long	.LASF1045
+	.byte	0x32
+	.byte	0x14
+	.long	0xa9
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1047
+	.byte	0x6
+	.byte	0x25
+	.byte	0x11
+	.long	0x17c
+	.long	0x448
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x6
+	.byte	0x25
+	.byte	0x2e
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1029
+	.byte	0x25
+	.byte	0x3b
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1045
+	.byte	0x27
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF1044
+	.byte	0x29
+	.byte	0xe
+	.long	0x17c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1046
+	.byte	0x1b
+	.byte	0x15
+	.long	0x26c
+	.long	0x471
+	.uleb128 0x1
+	.string	"pgn"
+	.byte	0x6
+	.byte	0x1b
+	.byte	0x22
+	.long	0xae
+	.uleb128 0x6
+	.uleb128 0xb
+	.string	"reg"
+	.byte	0x1d
+	.byte	0x1f
+	.long	0x26c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x18
+	.long	0x9d
+	.long	0x48e
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3b
+	.byte	0x37
+	.long	0x26c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1049
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x18
+	.long	0x9d
+	.long	0x4ab
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x3a
+	.byte	0x33
+	.long	0x26c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1050
+	.byte	0x4
+	.byte	0x39
+	.byte	0x17
+	.long	0x8c
+	.long	0x4c8
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x39
+	.byte	0x35
+	.long	0x26c
+	.byte	0
+	.uleb128 0x20
+	.string	"pgN"
+	.byte	0x4
+	.byte	0x38
+	.byte	0x18
+	.long	0x9d
+	.uleb128 0x1
+	.string	"reg"
+	.byte	0x4
+	.byte	0x38
+	.byte	0x30
+	.long	0x26c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x6e
+	.uleb128 0xe
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 7 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF577
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF595
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF620
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF621
+	.byte	0x4
+	.byte	0x4
+	.file 19 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.file 21 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF624
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF684
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF688
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF689
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF752
+	.byte	0x4
+	.file 26 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1a
+	.file 27 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 28 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1c
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 29 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1d
+	.byte	0x4
+	.file 30 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 32 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 33 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF515
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF574
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF639
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF681
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF683
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF687
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF990
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1054
+	.long	.LASF1055
+	.long	.LASF1056
+	.long	.LASF1057
+	.long	.LASF1058
+	.long	.LASF1059
+	.long	.LASF1060
+	.long	.LASF1061
+	.long	.LASF1062
+	.long	.LASF1063
+	.long	.LASF1064
+	.long	.LASF1065
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1066
+	.byte	0xc
+	.long	.LASF1067
+	.byte	0x8
+	.long	.LASF1068
+	.byte	0x8
+	.long	.LASF1069
+	.byte	0x3
+	.long	.LASF1070
+	.byte	0xb
+	.long	.LASF1071
+	.byte	0x3
+	.long	.LASF1072
+	.byte	0xb
+	.long	.LASF1073
+	.byte	0x8
+	.long	.LASF1074
+	.byte	0xb
+	.long	.LASF1075
+	.byte	0xb
+	.long	.LASF1076
+	.byte	0x8
+	.long	.LASF1077
+	.byte	0x8
+	.long	.LASF1078
+	.byte	0xa
+	.long	.LASF1079
+	.byte	0x8
+	.long	.LASF1080
+	.byte	0x9
+	.long	.LASF1081
+	.byte	0x9
+	.long	.LASF1082
+	.byte	0x7
+	.long	.LASF1083
+	.byte	0x7
+	.long	.LASF1084
+	.byte	0xb
+	.long	.LASF1085
+	.byte	0xc
+	.long	.LASF1085
+	.byte	0xb
+	.long	.LASF1086
+	.byte	0x8
+	.long	.LASF1087
+	.byte	0x8
+	.long	.LASF1088
+	.byte	0x8
+	.long	.LASF1089
+	.byte	0x8
+	.long	.LASF1090
+	.byte	0x6
+	.long	.LASF1091
+	.byte	0x5
+	.long	.LASF1092
+	.byte	0x4
+	.long	.LASF1093
+	.byte	0x5
+	.long	.LASF1094
+	.byte	0x5
+	.long	.LASF1095
+	.byte	0xc
+	.long	.LASF1096
+	.byte	0x1
+	.long	.LASF1097
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF697:
+	.string	"INT32_MAX (2147483647)"
+.LASF795:
+	.string	"USE_1WIRE_DS2482 "
+.LASF639:
+	.string	"__STD_TYPE typedef"
+.LASF843:
+	.string	"USE_CLI_BATCH "
+.LASF790:
+	.string	"USE_OPFLOW "
+.LASF502:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1027:
+	.string	"pgActivateProfile"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF998:
+	.string	"size_t"
+.LASF762:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF833:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF767:
+	.string	"USE_GPS "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF602:
+	.string	"__stub_sigreturn "
+.LASF466:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF822:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF578:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF877:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF953:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF539:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF782:
+	.string	"USE_RX_UIB "
+.LASF743:
+	.string	"INT16_C(c) c"
+.LASF756:
+	.string	"USE_I2C_PULLUP "
+.LASF510:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF883:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF775:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF763:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF860:
+	.string	"USE_UART7 "
+.LASF869:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF950:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF770:
+	.string	"USE_TELEMETRY "
+.LASF712:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF967:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF553:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF951:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF684:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF722:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF526:
+	.string	"__P(args) args"
+.LASF913:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF408:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF652:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD "
+.LASF443:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1031:
+	.string	"take"
+.LASF887:
+	.string	"USE_VCP"
+.LASF847:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF726:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF401:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF747:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF424:
+	.string	"__size_t "
+.LASF691:
+	.string	"INT8_MIN (-128)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF636:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF514:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF964:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF755:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1022:
+	.string	"__pg_resetdata_end"
+.LASF541:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF412:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF700:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF721:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF586:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF867:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF469:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF621:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1028:
+	.string	"pgResetAll"
+.LASF456:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF896:
+	.string	"U_ID_1 1"
+.LASF682:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF808:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF889:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1016:
+	.string	"__pg_registry_start"
+.LASF738:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF598:
+	.string	"__stub_fchflags "
+.LASF875:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF661:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1049:
+	.string	"pgSize"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF480:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF460:
+	.string	"__USE_XOPEN"
+.LASF969:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF465:
+	.string	"__USE_XOPEN2K8"
+.LASF827:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF563:
+	.string	"__always_inline"
+.LASF410:
+	.string	"_SYS_SIZE_T_H "
+.LASF761:
+	.string	"USE_SERIALRX_IBUS "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF476:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF693:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF934:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF512:
+	.string	"__GLIBC__ 2"
+.LASF991:
+	.string	"long int"
+.LASF504:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1006:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF481:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF498:
+	.string	"__USE_XOPEN2K8 1"
+.LASF670:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF936:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF400:
+	.string	"_PTRDIFF_T_ "
+.LASF477:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF681:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF666:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1043:
+	.string	"pgReset"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF728:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF660:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1046:
+	.string	"pgFind"
+.LASF560:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1013:
+	.string	"copy"
+.LASF419:
+	.string	"_SIZE_T_DECLARED "
+.LASF528:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF816:
+	.string	"CMS_MENU_OSD "
+.LASF872:
+	.string	"USE_DASHBOARD"
+.LASF584:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF960:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1007:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF949:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF549:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF735:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF912:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF974:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF449:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF542:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF663:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF787:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF519:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF940:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF997:
+	.string	"signed char"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1002:
+	.string	"uint8_t"
+.LASF1047:
+	.string	"pgOffset"
+.LASF626:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF530:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF825:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF641:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF600:
+	.string	"__stub_revoke "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF657:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF868:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF659:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF421:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF486:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF527:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF713:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF854:
+	.string	"USE_UART1 "
+.LASF420:
+	.string	"__DEFINED_size_t "
+.LASF1008:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF771:
+	.string	"USE_TELEMETRY_LTM "
+.LASF909:
+	.string	"NOINLINE "
+.LASF902:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF856:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF780:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF692:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1041:
+	.string	"_Bool"
+.LASF1035:
+	.string	"from"
+.LASF571:
+	.string	"__restrict_arr __restrict"
+.LASF596:
+	.string	"__stub___compat_bdflush "
+.LASF416:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF444:
+	.string	"NULL"
+.LASF1019:
+	.string	"__stop_pg_registry"
+.LASF759:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF668:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF473:
+	.string	"__USE_GNU"
+.LASF508:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF708:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF550:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF706:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF906:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF601:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF618:
+	.string	"__need_size_t "
+.LASF797:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF629:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF651:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF583:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF568:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF488:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF752:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1001:
+	.string	"__uint16_t"
+.LASF463:
+	.string	"__USE_XOPEN2K"
+.LASF536:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF683:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1040:
+	.string	"pgResetCopy"
+.LASF464:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1020:
+	.string	"__pg_resetdata_start"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF566:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF407:
+	.string	"__size_t__ "
+.LASF495:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF898:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF719:
+	.string	"INT_FAST8_MAX (127)"
+.LASF707:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF737:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF748:
+	.string	"UINT32_C(c) c ## U"
+.LASF727:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF458:
+	.string	"__USE_POSIX199309"
+.LASF698:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF754:
+	.string	"I2C1_OVERCLOCK false"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF908:
+	.string	"FAST_CODE "
+.LASF717:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF814:
+	.string	"USE_STATS "
+.LASF805:
+	.string	"USE_FRSKYOSD "
+.LASF513:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF462:
+	.string	"__USE_UNIX98"
+.LASF832:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF479:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF846:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF952:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF645:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF630:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF784:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF675:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF758:
+	.string	"USE_SERIAL_RX "
+.LASF570:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF760:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF715:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF535:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF677:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF840:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF865:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF577:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF917:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF999:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF985:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF433:
+	.string	"_BSD_WCHAR_T_ "
+.LASF678:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF724:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF989:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF812:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1015:
+	.string	"pgRegistry_t"
+.LASF548:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1005:
+	.string	"PGR_PGN_MASK"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF933:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF977:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF982:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF725:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF718:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF445:
+	.string	"NULL ((void *)0)"
+.LASF947:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF870:
+	.string	"USE_USB_MSC"
+.LASF897:
+	.string	"U_ID_2 2"
+.LASF558:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF446:
+	.string	"__need_NULL"
+.LASF971:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF496:
+	.string	"__USE_POSIX199506 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF861:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF499:
+	.string	"_ATFILE_SOURCE"
+.LASF635:
+	.string	"__SLONG32_TYPE int"
+.LASF740:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF656:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF450:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF815:
+	.string	"USE_CMS "
+.LASF976:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF452:
+	.string	"__USE_ISOC11"
+.LASF503:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF689:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF606:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF807:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF942:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF731:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF658:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF624:
+	.string	"_BITS_TYPES_H 1"
+.LASF699:
+	.string	"UINT8_MAX (255)"
+.LASF736:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF521:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF489:
+	.string	"_POSIX_SOURCE"
+.LASF905:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF487:
+	.string	"__USE_ISOC95 1"
+.LASF587:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF411:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1012:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF903:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF540:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF772:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF522:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF619:
+	.string	"__need_NULL "
+.LASF451:
+	.string	"_FEATURES_H 1"
+.LASF484:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF447:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF687:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF831:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF552:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF848:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF640:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF794:
+	.string	"USE_1WIRE "
+.LASF862:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF402:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF518:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF559:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF838:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF397:
+	.string	"_T_PTRDIFF_ "
+.LASF851:
+	.string	"USE_FAKE_GPS "
+.LASF941:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF471:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF958:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF768:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF676:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF773:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF429:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF580:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF899:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF457:
+	.string	"__USE_POSIX2"
+.LASF937:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF425:
+	.string	"__need_size_t"
+.LASF839:
+	.string	"USE_VTX_TRAMP "
+.LASF879:
+	.string	"USE_PITOT_MS4525"
+.LASF414:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF426:
+	.string	"__wchar_t__ "
+.LASF589:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF594:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF441:
+	.string	"__DEFINED_wchar_t "
+.LASF623:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF946:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1051:
+	.string	"pgResetInstance"
+.LASF730:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF918:
+	.string	"true 1"
+.LASF575:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF431:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS "
+.LASF525:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF943:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF962:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF556:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF520:
+	.string	"__LEAF , __leaf__"
+.LASF396:
+	.string	"_PTRDIFF_T "
+.LASF574:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF890:
+	.string	"USE_RCDEVICE"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF516:
+	.string	"__PMT"
+.LASF793:
+	.string	"USE_PITOT_MS4525 "
+.LASF1023:
+	.string	"__stop_pg_resetdata"
+.LASF965:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF662:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF500:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1037:
+	.string	"_left0"
+.LASF631:
+	.string	"__SQUAD_TYPE long int"
+.LASF1032:
+	.string	"_left2"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF915:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF474:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF591:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF395:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF695:
+	.string	"INT8_MAX (127)"
+.LASF873:
+	.string	"USE_OLED_UG2864"
+.LASF1014:
+	.string	"reset"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF996:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF804:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF517:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1018:
+	.string	"__start_pg_registry"
+.LASF880:
+	.string	"USE_PITOT_ADC"
+.LASF878:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF844:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF470:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF467:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF916:
+	.string	"_STDBOOL_H "
+.LASF440:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF497:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF669:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF628:
+	.string	"__U32_TYPE unsigned int"
+.LASF821:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF398:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF547:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF551:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1004:
+	.string	"pgn_t"
+.LASF573:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF599:
+	.string	"__stub_gtty "
+.LASF427:
+	.string	"__WCHAR_T__ "
+.LASF710:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF665:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF703:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1050:
+	.string	"pgVersion"
+.LASF1053:
+	.string	"pgRegistry_s"
+.LASF1048:
+	.string	"pgIsSystem"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF779:
+	.string	"USE_GYRO_KALMAN "
+.LASF562:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF919:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF742:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF404:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF634:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF680:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF511:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF644:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF955:
+	.string	"sq(x) ((x)*(x))"
+.LASF653:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF523:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF579:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF979:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF529:
+	.string	"__STRING(x) #x"
+.LASF995:
+	.string	"unsigned char"
+.LASF576:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF810:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF818:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF987:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF428:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF849:
+	.string	"USE_FAKE_BARO "
+.LASF620:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF403:
+	.string	"_GCC_PTRDIFF_T "
+.LASF769:
+	.string	"USE_NAV "
+.LASF803:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF852:
+	.string	"USE_MAG "
+.LASF994:
+	.string	"char"
+.LASF524:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF585:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF409:
+	.string	"_SIZE_T "
+.LASF436:
+	.string	"_WCHAR_T_H "
+.LASF811:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF705:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF850:
+	.string	"USE_FAKE_MAG "
+.LASF544:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF864:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF702:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF932:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF781:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF394:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF413:
+	.string	"__SIZE_T "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF988:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF454:
+	.string	"__USE_ISOC95"
+.LASF733:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF453:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF834:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF461:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF564:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF978:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF531:
+	.string	"__BEGIN_DECLS "
+.LASF1009:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF439:
+	.string	"_GCC_WCHAR_T "
+.LASF714:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF986:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF959:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF753:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF690:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF817:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1011:
+	.string	"size"
+.LASF672:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF893:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF455:
+	.string	"__USE_ISOCXX11"
+.LASF417:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF914:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1003:
+	.string	"uint16_t"
+.LASF590:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF399:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1021:
+	.string	"__start_pg_resetdata"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF809:
+	.string	"USE_D_BOOST "
+.LASF711:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF992:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF492:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF966:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF555:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF459:
+	.string	"__USE_POSIX199506"
+.LASF744:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF749:
+	.string	"UINT64_C(c) c ## UL"
+.LASF858:
+	.string	"USE_UART5 "
+.LASF948:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF801:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF501:
+	.string	"__WORDSIZE 64"
+.LASF907:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF963:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF435:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF603:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF800:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF537:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF637:
+	.string	"__S64_TYPE long int"
+.LASF415:
+	.string	"_BSD_SIZE_T_ "
+.LASF841:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF534:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF432:
+	.string	"_WCHAR_T_ "
+.LASF1026:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1036:
+	.string	"version"
+.LASF792:
+	.string	"USE_OPFLOW_MSP "
+.LASF430:
+	.string	"_T_WCHAR "
+.LASF954:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF973:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF627:
+	.string	"__S32_TYPE int"
+.LASF701:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1039:
+	.string	"pgStore"
+.LASF438:
+	.string	"__INT_WCHAR_T_H "
+.LASF791:
+	.string	"USE_OPFLOW_CXOF "
+.LASF739:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1045:
+	.string	"regSize"
+.LASF605:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF448:
+	.string	"_STRING_H 1"
+.LASF835:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF685:
+	.string	"_BITS_WCHAR_H 1"
+.LASF764:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF745:
+	.string	"INT64_C(c) c ## L"
+.LASF506:
+	.string	"__USE_ATFILE 1"
+.LASF972:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF751:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF984:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF785:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF892:
+	.string	"USE_ITCM_RAM"
+.LASF956:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF837:
+	.string	"USE_VTX_CONTROL "
+.LASF891:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF789:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF597:
+	.string	"__stub_chflags "
+.LASF944:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF423:
+	.string	"_SIZET_ "
+.LASF935:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF671:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF859:
+	.string	"USE_UART6 "
+.LASF911:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF664:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF777:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF642:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF567:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF472:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF884:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF874:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF557:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF886:
+	.string	"USE_ADC"
+.LASF882:
+	.string	"USE_1WIRE_DS2482"
+.LASF938:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1029:
+	.string	"profileIndex"
+.LASF723:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF532:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF505:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1000:
+	.string	"short int"
+.LASF393:
+	.string	"_STDDEF_H "
+.LASF981:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF482:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF515:
+	.string	"_SYS_CDEFS_H 1"
+.LASF765:
+	.string	"USE_64BIT_TIME "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1042:
+	.string	"pgResetCurrent"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF545:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF788:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF786:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF582:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1038:
+	.string	"_right1"
+.LASF1033:
+	.string	"_right3"
+.LASF632:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1052:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF406:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF980:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF593:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF543:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF802:
+	.string	"USE_OLED_UG2864 "
+.LASF649:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF888:
+	.string	"USE_RX_PPM"
+.LASF1017:
+	.string	"__pg_registry_end"
+.LASF904:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF546:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF633:
+	.string	"__SWORD_TYPE long int"
+.LASF983:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF554:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF646:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF493:
+	.string	"__USE_POSIX 1"
+.LASF732:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF729:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF638:
+	.string	"__U64_TYPE unsigned long int"
+.LASF910:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF592:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF826:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF798:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF853:
+	.string	"USE_BARO "
+.LASF625:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF741:
+	.string	"WINT_MAX (4294967295u)"
+.LASF968:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF894:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF561:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF565:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF746:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF776:
+	.string	"USE_PITOT_ADC "
+.LASF437:
+	.string	"___int_wchar_t_h "
+.LASF1025:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF783:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF885:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF581:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF667:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF569:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF654:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF694:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF970:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF483:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF422:
+	.string	"_GCC_SIZE_T "
+.LASF855:
+	.string	"USE_UART2 "
+.LASF993:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF442:
+	.string	"_BSD_WCHAR_T_"
+.LASF709:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF824:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF643:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF704:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF716:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF533:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF961:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF490:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF494:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF655:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF588:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF696:
+	.string	"INT16_MAX (32767)"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF881:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF866:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF647:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF895:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF648:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF871:
+	.string	"USE_SERVO_SBUS"
+.LASF823:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF900:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF957:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF774:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF418:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF376:
+	.string	"unix 1"
+.LASF990:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF688:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1024:
+	.string	"float"
+.LASF842:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF720:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF820:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF507:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1044:
+	.string	"base"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF920:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1010:
+	.string	"pgResetFunc"
+.LASF674:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF686:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF863:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF876:
+	.string	"USE_RANGEFINDER"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH "
+.LASF405:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF813:
+	.string	"USE_LOG "
+.LASF757:
+	.string	"USE_RX_PPM "
+.LASF538:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF595:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF766:
+	.string	"USE_BLACKBOX "
+.LASF1030:
+	.string	"profileCount"
+.LASF650:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF857:
+	.string	"USE_UART4 "
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF836:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF468:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF939:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF901:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF434:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF975:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF622:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF604:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF845:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF679:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF734:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1034:
+	.string	"pgLoad"
+.LASF491:
+	.string	"_POSIX_C_SOURCE"
+.LASF778:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF673:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF750:
+	.string	"INTMAX_C(c) c ## L"
+.LASF819:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF572:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF796:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF806:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1092:
+	.string	"target.h"
+.LASF1073:
+	.string	"libc-header-start.h"
+.LASF1081:
+	.string	"stubs-64.h"
+.LASF1064:
+	.string	"/usr/include"
+.LASF1063:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1089:
+	.string	"stdint-intn.h"
+.LASF1095:
+	.string	"stdbool.h"
+.LASF1084:
+	.string	"strings.h"
+.LASF1083:
+	.string	"__locale_t.h"
+.LASF1058:
+	.string	"src/main/target"
+.LASF1070:
+	.string	"string.h"
+.LASF1090:
+	.string	"platform.h"
+.LASF1054:
+	.string	"src/main/build"
+.LASF1068:
+	.string	"stdint-uintn.h"
+.LASF1067:
+	.string	"types.h"
+.LASF1096:
+	.string	"build_config.h"
+.LASF1088:
+	.string	"wchar.h"
+.LASF1057:
+	.string	"src/main/target/SITL"
+.LASF1074:
+	.string	"features.h"
+.LASF1087:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1091:
+	.string	"common.h"
+.LASF1093:
+	.string	"sanity_check.h"
+.LASF1082:
+	.string	"locale_t.h"
+.LASF1061:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1094:
+	.string	"common_post.h"
+.LASF1097:
+	.string	"maths.h"
+.LASF1066:
+	.string	"stddef.h"
+.LASF1080:
+	.string	"stubs.h"
+.LASF1056:
+	.string	"src/main/config"
+.LASF1069:
+	.string	"parameter_group.h"
+.LASF1075:
+	.string	"features-time64.h"
+.LASF0:
+	.string	"./src/main/config/parameter_group.c"
+.LASF1078:
+	.string	"cdefs.h"
+.LASF1086:
+	.string	"typesizes.h"
+.LASF1077:
+	.string	"timesize.h"
+.LASF1071:
+	.string	"parameter_group.c"
+.LASF1085:
+	.string	"stdint.h"
+.LASF1060:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1059:
+	.string	"src/main"
+.LASF1079:
+	.string	"long-double.h"
+.LASF1062:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1076:
+	.string	"wordsize.h"
+.LASF1055:
+	.string	"src/main/common"
+.LASF1072:
+	.string	"stdc-predef.h"
+.LASF1065:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+	.text
+	.section	.gnu.lto_.profile.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375 \252\335\003"
+	.string	"\304\005\236"
+	.string	"\013"
+	.string	"\374\222\2645\004\002"
+	.string	"\002\001\002\002\002\001\003\311\266\217\327\005\004\002\003\002\001\002\004\002\004\004\335\242\377\373\017\004\002\001\005\363\261\364\250\003\002\b\273\350\217\312\n\t\257\225\275\272\n\275\216\307\206\001\013\207\201\300\322\n\002\f\310\272\221\217\006\r\301\363\373\361\b\016\257\256\232\277\001\b"
+	.string	"\f"
+	.string	"\002#XC"
+	.ascii	"\020\006\334\202T\025\020\006\334\302\324\326=\253@\025\020\203"
+	.ascii	"\032o\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\365\004"
+	.string	"\002\b\023\024\2405\351\003p"
+	.string	""
+	.string	""
+	.string	"'\267\376\337\254%j\215\354-S\n\256z`\0270y\354*c\311\025\177\351\347\314\220e\245\302\272dtQW\207\002\331\230\032\261U\0355y\023\006\331\bh\303\236\376\034\026a\232\020\261\364\315\225=\r\037\004\" P\2021G\313\003\031\016\262\b\247\f \223\271\006?\bl\232b\327M.\363\013\rC\\\366\020\263\322ZS\213j\3418|`\301\312\001\222\240\021=\230\r\276\\\260Q\342\205\246\031\307\024\302\224\334P\013A\255\001\"3\254/"
+	.ascii	"\304(\200\033"
+	.text
+	.section	.gnu.lto_.inline.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`V\003\255\017"
+	.string	"F\326K>0m\223t"
+	.string	"U\232\036\250\024\017\320\201\363\222g\243\027\273\214\301k2nv\375\276\364\1777\"r\r\236A\025\357\272z\314\301(\031\216\013\017J\270\212\324o\223|\213\366[7\333\032\331r\2473"
+	.string	"8"
+	.string	"?"
+	.string	"\367\277\362v\007\340\364\033m#(\237\212\343X\240\371\256aF\007\3073:\371_\264^L\276\367\036\365\0042\303H\304\302\3651S\b\0324\034\226\237\334\004\004!\017\310Zj\231\006\340\246\221\027R\204@\375r\271\231ejL\202\336{\222K-x\357i\336\372\222K\212[\305\334\345R\361\252\f\320\345\230`\242\212`I\204\363\331\270[ \224'\035\323W(|H"
+	.string	"A\331j\177M\232\235\335\246\321\317\246\202\211J8)\270E\030\211F\256\253"
+	.ascii	"\226,s\356Ro\264B\020l#8\237\r6\365sL\237\311\025\r8\264\300"
+	.ascii	"\fT\023\377\2671\351A\302c\241\035\365\240\030\t\261\344\207"
+	.ascii	"\203\r!7\206#\206\250\337+\037\323\023\034\f\036n\370 EJt<*="
+	.ascii	"\220!D\214:T\276\300\n\263R\b\347\263\241|aR\273\212\t\037\002"
+	.ascii	"X\250\021E\246P 54\205\245Y\306p\002\241\021B;\022@\203\211\206"
+	.ascii	"h-r&nh[\267\376\006d\366M\236\265x\372\325_\317B)5\245\023\254"
+	.ascii	"\275\363\221\300\266!\234v\027\"\266\266?\322\366e7Sl\366\204"
+	.ascii	"\036\214\253\274\345\n\b\217\203\357?\3221^\361i\245{\201P!\357"
+	.ascii	"J\366\023\200VH\031\276!\300\315\310\241an\320\325\204\361\353"
+	.ascii	"\262!-\255\314\003\314q\0236\304\324\224\325\006_Q\235w'Z\017"
+	.ascii	"d\276\263i\327\264\275\227,\001`4\205;@0\353\310|\226\223\273"
+	.ascii	"\275\375S\371Tk\350\026\3779%\211==\\`\377$?\254Tc\344\234\021"
+	.ascii	"e\352b\224bz\225|\030\245j@\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\272\0015\b"
+	.string	"R\214\"&\220'I\007\360\367\355\343~"
+	.string	"\206\217\277\201<3\023*\363\177fff\2048\f\214\3006k{#\333\210\335[\246\035tl\375\362\302+\2340\230\307<\351\020\363\020\303oq\302#\\+\354=(\252F\275\2268\366xB0B\021\260\205e\360\345yd=\300\214gba\353\021\001\347\234\343\030\250Y3\307.\370\261\223v\3707\233j6\257/G\371\301\033\374c\336845\030\3368\227\026\241-2\3215\243`=I!\026\0043 P\2421u\351\001G\"\227}\277\211\214\361\355\005i\201e\336}\342\272\313!\240.\300\365\223R\026x\034V\027\013\351l=\206\260"
+	.ascii	"&\305\300\367\276\305 w\2405@\222{\34268\335\021\336\212\220"
+	.ascii	"\200\335\327\340\314\212pB@\020\266\004\021\200%\022r4Z\203&"
+	.ascii	"h]\032l\222\202\017\235\200\257j\203\266{\001\331\334\004\304"
+	.ascii	"\230\257~\303\030\013A\004\230\347\200\255\24797"
+	.text
+	.section	.gnu.lto_.pureconst.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375 &1\001"
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"\013"
+	.ascii	"\231\004\003\231\004\004\231\004\005\205\004\b\231\004\t\231"
+	.ascii	"\004\n\231\004\013\231\004\f\231\004\r\231\004\016\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\275\005"
+	.string	"\342\007\032!\260'\035\200$\t\330\301\200\227\024\300\002\002\366d\035\260\241\r$G$\022\273d\033\221{o\222R\nmL\303R\033kL\303\320\3525\336H\222\005\b\261p\n\007\361)\240\225Y\345N\310\323\007\n(\376Pn|N\004\254J,\b\325\353\356\272\237\272\233\277\r\345\034\334\353\273\033<3\353\272\351o\336\313\2134im\b\" \240\242\031T\017+Y\260\310\254\354\0357;:D#\303\206+\346u\023\361\220a\365f\3436\350\025x-\\2kd\004\177\032k\017\"\n\016\0344\206*\365\016\311\005\013\227\022\031\205\r\027\026\212iG\021\033z\355\026\265d"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.963ec99ff402cd7c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pgFind.11.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\024\003u\027"
+	.string	"V+\230I\300\224Nc\224\374@\374\211\356\250\235F\200\003\3773$\266\254\343\213\263\345%N%Z\032\tn\327\rqX\243\211$\005n\320\f`\343\236"
+	.string	"\206\002\331~\371s\305\347Q\362\314:\212\267o\344\214\274A\352d\357-\267\224)\005\202"
+	.string	"|"
+	.string	"\206"
+	.string	"O\276\323]\330\334\254\261\2757\210\n\353^3\305\013\312\333"
+	.ascii	"\364Kg\2621\357\3044\352\251\260\224sz\335k\312l\336d\274-_2"
+	.ascii	"\336\326\"\217I?U=\222~\252\270.\232\367Hy'G+V\312\3639\234$"
+	.ascii	"\371\345\374<\335\371\371\350\250\302\347\326\002\207:\277\020"
+	.ascii	"\027\305\006MJG$\277\016b\205\022j\305~7\264\376\274I\t \027"
+	.ascii	"\325\317\347\224\244\335{Mu~=wy\333$l\327\330\024HD\366Yt\320"
+	.ascii	"8\341:d\303,uI\336\374GKmMM\037\274\017@B\216\260\204\353\336"
+	.ascii	"\017\303\"\027\207\215\221\342\301\337\276\017\374\024\315\243"
+	.ascii	"|)\002&\224\356\275\261[\341\025O\031[L^\260\254\231\351\205"
+	.ascii	"4\017\362N\314\333s,/\234\033)\267\345\216\331\243\016\345\237"
+	.ascii	"%\217\231\375\363A\036\315\347!\302\221\246\256{\315\004\267"
+	.ascii	"\236P\336\372@\032;v{\037\312\306\216\331\245\326\254\322\007"
+	.ascii	"b}\205\325\035{f(\300\n(\210X\211\\\326\261\352\200>n(\021\373"
+	.ascii	"\302\377<\204\"\034C\272\n\f\177\033m-\353\211\220\034\021>\277"
+	.ascii	"\034+Cy\357\r\213\177\265\001\306G\342\215\267\266>x\344\324"
+	.ascii	"\243C\177\352\326\206\220\324a9\272x\232\202\324\013\217\342"
+	.ascii	"b\244\356\370\001EU+\221a\354\016\030\335\213s\035\377\305\253"
+	.ascii	"p\342\221n-\263\033\257\263\033o\037</\250w^d!\364\247S\370\322"
+	.ascii	"q\351\227m\372h\r\306p\263\351\252WXj\n\030\254\270\254\250\f"
+	.ascii	"\210\271\345\252k*9\r8\335\315\202\3166c\203i\321\265\344d\267"
+	.ascii	"\227\0131\270\232,\346\245\005FV\323\355d*\006\214\313\331t\262"
+	.ascii	"\031\034N'\213\231\275\327!\261\005\225\360j\274\325-\302*\245"
+	.ascii	"\325\264^\365\241 +\221g#,YI\"\3242\257;\236\261+\263l\257\016"
+	.ascii	"j\374\374\003\020B\264\036\375\272x\357\275#Y\037<\n\202J\326"
+	.ascii	"\343\254\360\321\241\177\376<<\276\350\024\320\320\226\r9 @\002"
+	.ascii	"B\220\203\347\001\030\221\312\324\201\021\030n\226A\224P\217"
+	.ascii	"\327p\024\251:\242\214\"wP\316\231\2454\271\360PY\fx*tU\024\312"
+	.ascii	"W\247\260\033Ilowuk\360\362\215+O>k6MIw\200\326\272\220D\355"
+	.ascii	"{\006\266M-)\353\300\372\210\216\320\\|\345W\311\366^\231.\211"
+	.ascii	"\325\330\226\210\346\306a\f\307\357c`\337\301Z\002j\214'\250"
+	.ascii	"\r\266\326z\352\336\3013B\224\323\236Sl\362\373\262\202d\230"
+	.ascii	"\256@\006"
+	.text
+	.section	.gnu.lto_pgResetInstance.13.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`K\003]\030"
+	.string	"\026\254\233D\300\032i8"
+	.string	"\264*\027/\213G\313)\322E\234\007\006\335R\205\261Q\006\226@\272k\207\330\035mD!\225"
+	.string	"\255\025\026\035I=b\2009\001\002\b\312\206at\375\267\260\375\213\312\315\004\260\205\264\275\367\2262\245\205"
+	.string	"\200"
+	.string	"\210"
+	.string	"\271S\361\333A=\034\273\344<\355\033\371\221\331uB\027\260k\364\005\312\356\316\201!\240\036zw\226\370\020\365\001\342C\317\3540\337\345v\202\027[\317iw[\332\343\263\217b\bj\316\374Q\207F\227\033n\350\243\b\016\260\321\204\313\ng\003\033p\021rC\205+\312Pg\374n8\032\007\301\005LQ\312\260`"
+	.string	"\271\251p\265\324\025\216\005h\263\273\357=]\340h\231\243\316\356:o8\0317\352\266\205l\327l\245\020\233g\354\035-\225\207}pw\327jd\243\3225\337\375)T\032u\335?\216ipL\253\230\3160\375\025"
+	.string	"%\004\236\354\302\370\241\331,\241\224 \376\321\231\330*\007]\211\277\204\002\221\"\273\253:\222\016\255\305\202\274\244\235\021\247\024\216\234\347\221\202\256\023*\260[\031Oz\262\305pz\350\037\005\331\252\207\177\317\2521M\316\221\2347{\022\024\340\346t\250\200a\332\3351xh\r\250\207\001rl\312\t\265|z\356\356\220:\211GAn\267\3507\177\312}\030@g\340\021\177\343\021=\360\260\324\362\311\366\206K\341\300\362\342\016\217\342z\270\312\355n*\253\312\322*\257\f\236R\373\005\313\337lS\244Cz[\032\226\322R\215>\311\337\273\005'9\3140!\370\335GDi\215\032\360\331j\320,\342NP\240vk\021\374&@?\376\017!}\357\213\216(\177>\223\207M;\276\344)-c^\350h\032\365H\267!\3123f\371\226\002\016\361J\341\263\003{\311\306W\t\227\007\3208\021z\036H\300\371\200ss"
+	.ascii	"\366\222\251{n\200N\304d\260\016\262\227\211\327\217K\346\002"
+	.ascii	"j\301|@\214\210\365\264F\370\270~Z=\262\022\255\233\004\216\001"
+	.ascii	"\275d-\023\261\230\254\245\332\021\035\\5\n\315d!R\332x SjP\r"
+	.ascii	"!GM\207\234\nj^y\221I\037:\266\f\021+\210\252+x`RU\325gKCB\214"
+	.ascii	"\372@r\244\024\032\310k\252\205\013/,\236r\244H\016T\036\276"
+	.ascii	"\022\317}TvT\307\263\022C\250Q \311 \345\224)\tDfdH\n\322\006"
+	.ascii	"p\002\021\242\344\003\022\300\027\"\025\260\266\353\377\006U"
+	.ascii	"j\247\351\353`\347D\226\317\362VA\002\203\216m\365\345\346N\245"
+	.ascii	"\335\004\216Z\213;++5&\355\231\340\234\254PE`\210\326T\022\234"
+	.ascii	"\261z\263,\003\027\310\377\341w\232\002\245\302\357\245\263\235"
+	.ascii	"EV\254\326x+\212t\376\006\361\225\006\b#\203\245\300Y\371[\323"
+	.ascii	"\032\242\037E\316\nP\376\377\004\230\367\367] \254\020\007\003"
+	.ascii	"\321\375\205\227\330n\326\254\202\340\361ja\363M\031\250"
+	.text
+	.section	.gnu.lto_pgReset.14.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\270\004=\036"
+	.string	"\006\365\273H\240\330Qc\200Ej\227\006\324\240|\215J}0\227!\0372\017p\361\361\203\226\n\341\357\257\tu\206\n\330\020\351\032~\323\310\304\304\302e<\270\036\343\243\343E;\306A\312^\341\207\266\027="
+	.string	"\332hq\227\220\275\245L)\236"
+	.string	"\250"
+	.string	"\245"
+	.string	"\345\335\241\253B\225\2367i\352k\230r\366\233"
+	.string	"\317\004\205nHT\201)\013\354^\343\202\233\366\360\250\037\233v\263\322\354\031U\256\032\277$x'#\215\336{c\253\352\336\313\300\031\316\233\267r\366\224{\265\317t%\3017\001=\300\275JP\252\35652\360\203\363\246\215\267\221\335<_#\273\351\240\315\345\206Em\f1J\354\336\213\263:\036|ik\320\377\323\321\242b\320K\243\333R\201\027\216-\266\242PI"
+	.string	"\211\313\350W\257-\212\303Zg\272{\257kQ1\306m\3366\005\333E\273\234\022\226\221\251F\177\274O\264z\206V\313ju\371\246\337\336\351?\200\0063\004$\357}\221\024s\273L\253\037?\376\366\375\254s\371\266\b\3708\242\025\244\345\2632\226\345\263i\247\362\363)>\326\004\035bH\335\220\350\226QFY\230\304P$\344\317\233\200n\2147\306\261\302\020\221\210\375\350[\375\312\301 \360P\276\224Wa\200:r\357\245\005\357d\342\026Ds\207[r\344j=\225\035\344"
+	.string	"\357d\342F\302\027\373S\345=\242\271BQ\306\2344r\257\237j\002\262D\026\230\246\300\242"
+	.string	"\375&\227:\201H\371N\376\004x(>\001`2\213\332\003Q\3041\\7\307\266\216z}\321\262!r\332\037/!Ixt\207c\331\031\330qZ"
+	.string	"<l\204|\315\354\255\376\253_x\002\006\006\fA\362<\231\314\316\354"
+	.ascii	"$\361h\350\364^>\347\275B\020\374\256\024=\277\007\220\354\246"
+	.ascii	"\314>JK\223\260&}*7\273\334\270XG\275\274\270\b\353r\221\277"
+	.ascii	"\t\257\256\301\306W\325\321\245\032W."
+	.string	"\324\212\003\347\320\251n\235\265\237\372\237^\223\204u\314O\336H\331mi]\211G\303\232teR\374\272u\3146\016\253]\262_^\253d\333fh\325\265ZM\2535\026\221\252\330\311\320K\177\263\324g\367\241L\221\202\340\261\220\222\330\t\341\373\365\324\234\003\201\347 B\016\210\034\234\002\275\364g\315\303\351\001\372~\275\016\277\364DZb\367\333\365\340z;!x|<\034\317\316\256\004\216\367\363\301\341$\260\257'\375\341N\370|?\034\315(|y\255\222iE\256NA\n\251\236\326f[\350\310\350\022\332\241k\252\315Zko\340P_\344\033\013\033De\035\030]I\276l\366\307r\306\376\370[\315\236v\306>lh\b\315\326\354elii\366CAfV\306Zdj\344\3070\257$k\227\374\0212\324~x\342\022\252at\244\222\300\004a\250\201(f\034C\210\261\221$I\n\013\351\200\002\021*;\017\022"
+	.string	"\2679\222\036\245P\331g\337$\276E\231\276\222\035x\353\300\363h\310\361\253|T\376s>\355\034.@\372\031\334\300\325\305U\310T\216m\212uW-\022td5K\367\311\271\201\301\001\214C\240P\227\247\006\363\375\260"
+	.string	"\021Q\2036{\356Z\207)\317`=%A\373\320\350\373\272z\361\325($\303~\031.:\277q2\227\002h8\320*J\373\256\235\017\321p \332\307\033\003\256^\b\274S~\206\305\"i^\361[\352\370\030a\367\216\031\263\231`5dU\373W$/\315G\260\262\363\rP\rSw"
+	.ascii	"\202p\334\f:\222\377\261K\344\260\310\021\0348\355\206.Z>\321"
+	.ascii	"\237\350S[NY\b5"
+	.text
+	.section	.gnu.lto_pgResetCurrent.15.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\321\001\355\020"
+	.string	"F\337pH\320TQ:\241%\002#\025\301\240\302"
+	.string	"b\250\345\246\021o\312<4!r\261"
+	.string	"\223\024\352\216"
+	.string	"ky\013\217\266\267^\240\311\210\314L`\177\365k\360\305\003\274\362c\366\357uAB\036\242C\305H\323\254\360D\223\275\367N)X"
+	.string	"Y"
+	.string	"_"
+	.ascii	"\005vmr\364\354\216\016\214\342\275z\374\201\356\325\273\201"
+	.ascii	"\356\325.[\310G\025{[\f\314\316\317\356~3\305]\257tJ\227\177"
+	.ascii	"\332C2\361\365\352\315\234\002\020g>)\002\032\035\"\006\210/"
+	.ascii	"\224\001\356D\220\323.c\304\230\224%*\273k)\023e\356\356\266"
+	.ascii	"'\330\336`\037(\323\306\256\322\035\225\246\237\375sJ?\324\301"
+	.ascii	"\300\231\374\330\r\021\224d}\252\r\027~\316uX\037}\333\024o\242"
+	.ascii	"\327Tb\037\226\362\214\300\201\363\263;6x\r\275j\254\317Z&\343"
+	.ascii	"\312|G\316\303\215\237W?\207e\213^\357\217.[d\227\334@\270<\315"
+	.ascii	"\307\271\f\327g\255\007\273\237'@f\001n%d\013\031\rn\332\245"
+	.ascii	"\353f\005\033\217\027\211\304~\355\247\335\363\361\242\347\310"
+	.ascii	"\020:\273\251`\007\006\310\340gh\360v_R\374\033\007\026\377\246"
+	.ascii	"\325\235g\305\f&\203|\235\327\234\211\333\036\302\031\001\301"
+	.ascii	"\202\310\234\257}\001L\346,o$z\254\314\331cLN\024\366\351\356"
+	.ascii	"\256\003\306@J1=\210@\262@\032%@\235\302i\323h\345\002\206(\n"
+	.ascii	"\341\251\345\244*\205\245\325\207J]X\001M\337J\252\244\372L!"
+	.ascii	"\3137:1\270:\205_\013\b\206\237h\204\235\356\264\261\204\030"
+	.ascii	">\260\031\253\004d\311$/3\235\257\327(\202\253\241\002\344\347"
+	.ascii	"\2346*%/3JM\207\371\262\235\3414T\336\006# @\002B\230\2047\221"
+	.ascii	"\311c\272\201#k4;\n\254\302\013\257@0\2418\\\361\241\r4\310\245"
+	.ascii	"X\033[C\255\306\355\202\313\206\225\215\022\307FI\264)\t\005"
+	.ascii	"\305Y3\2600\003AC\217\307m\0247\300\305,V8\004\313\2510\251\231"
+	.ascii	"\251\345E\310\326\344\032W\206\002"
+	.text
+	.section	.gnu.lto_pgResetCopy.16.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\233\004m\037"
+	.string	"V\370\306L\240\024R:\fK5\034\003>\245V\334\340h\026\346e\321_\037p+\3740N\324\217\312\315<\204\347V\036\337\366\332\267\263\320\235\177Yy\364\225\277\300\277\340r\244\b\0134\370.?\310\2071\272\244\255\331$fFK\b\331d\357$\003\260"
+	.string	"\254"
+	.string	"\262"
+	.string	"\2705\244h\260f\256\367\341\373\223N\343\234e i\322\343\001\366\\\326\254\355~\323y\370\356\324QN \347b\222U\316\353\203\216\220\036\367z\003\347q\372\226\363\030B\214\257\177_\217|N\364\202\307\270\314y\245]\243>\225\202\250\230(\005Q\201\335\\\337\330\376\236\242'6\257\375\365K<\245\340\202\252il\350\007\350\250\371\022\204\003\371.\025@\346\001&UK7\362\330S"
+	.string	"Qx\345m\0171h\361\215\0267\315\t<\230f\b \356\230\367\351\250\245\022\205\366^y\003BP`S\304\026\267\350L\316\271\355\220\370\363\236\275\273utw\35667\004,\251\355Yj;}\362\215\336\351\307\177\372o\333>\200"
+	.ascii	"6\204^\020\301\270`k\366\271R%sa\254\244'\377\356\367\217\317"
+	.ascii	"\352V;\347V},\0051\256|\306\254\255Y\220\032\266\277\312yT\017"
+	.ascii	"\301"
+	.string	"\232\177n\265\024.\227SO\366\225>K\324\244\211\351U8\377\321\247B\245(\231r\316j\037i\346\243l\016\203\270R\255\232i\217\304\371\223\316K\005\026;\302\216S\257\332\247\016\244/\225~\325\272/\205\363\250\336L\360D6\217bM\232\226@p\372\307\234n\365\370\335\276\276\261U\324\247\326\035\325{\026\252\230\245 \022\n\313yu\3609c\226\373\344]^\336r\242\227\345^\230#\300W\231\024\214\342\226y\213zv\357\345A9\331\261d\277\362\030\214\270\306\302\026\\y\315\231\336\331E@\205\007(\330\266\027\271\2459\357\310\364\211\354p}\244\336y\234\336G\315p\002\332+\375\254c$C\031\353\263%a(\244\210\241\367Ww\001a\245\353zAy\232\272Z\271\006G9\013?\354\013\371\020\033\363H\307=\"w~\230;\217\237\374O\006Pysi(W\235\246\254+S=\203\221\2151\261{\217|\317"
+	.ascii	"mY\337x\032%\256\261)\331\226u\257A{\213\272/\323e\204F\337b"
+	.ascii	"7\266\255\006-\002w\343\335\033\334\356v\214\214\rB-\006D\fL"
+	.ascii	"\002\235\235\316f\266\rf\327\323\361p\036x7\022\267\\\r\257f"
+	.ascii	"G\303\331\204\270\321\331h7659\232\215\227C\203a\320\272\335"
+	.ascii	"\215G#\241\323\361h\352\n\374-\366\351U\343\250<\373\2773\306"
+	.ascii	"\021\211\376\277\363\267\347\366\f\360\006\221\322\023\253\305"
+	.ascii	"\342\253\336n\016\035\354\207\355b\342\226\350\033\237~-\345"
+	.ascii	"\261)\005\222"
+	.string	"\212J\350-2uL\035\225\370[o\363\242W\335\272z?@=\261?zt\251\367Q\277\361\263*J5\316[\324\022\\\230,\027%\263\257\032\201\336\236V\222K\223x@\257\205#;\226\354\302\212\241\244\231sX\250q\034\005\021q\316\214\210H\211h\232\244\003@\002b\020;\255\003\022\340\266\241\345\220\026\226\353\377\006Dj\317[\325\262\255\363-=i\"\243\244\034\331\001\301\226&\374K\016K(\273\003\366\022\345\300\016\035\224\024@\265\200I>\337\350\002amPw(a\005\202\t\034\315d\305D\223\025CD\030\243C\307\305\211\\\205\331\032S\372\231F\367\016\313\226\354vc\331\036\334\230\350?\313\"\007\316R\343i\347y@k\t@?5\217\023n\264`\177\300vOt\031\026\006\260\027\202\"\b\240\006\276Ber\261\330\230\3033\227\336\215?\334D\022\3104\275k\304\315\364\347m\272\205\366\267\272\246\310"
+	.ascii	"\350\321\263\264;O\305\315\236\026\034\322DM\023E\005"
+	.text
+	.section	.gnu.lto_pgLoad.17.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\202\002\345\024"
+	.string	"\266\347\214J\260\022R:\n\007\245\2121m\217\352\353\305\370\030ji\223\323\332\361(|\202\222\3440.\007\341}N\273\210\332/\033F\370H\222\265\357\353\207\211\344\376`\375I\241w\017zY\336s\274:g}\334+Z\276\343d\020B\366N)r"
+	.string	"x"
+	.string	"t"
+	.string	"\272\027yh\327.\217\024\324\356\2328B\371\261D$mTN\337\302\027\372\220\356@\231\017\330\365Q\202\332\r\232\230A\371\321\301\217\220\037\313\023 ?Zg\333x\260\304^\bDst\265\273\261J\342\272\213\225\352\374+\335\345\373\315\\,s^E\004:2r\002\374z\342\bUO\215+\235\332\374x\224\202\254\354\256\251\357\207s\217\267\355\3006\b\233\216\b/\372\307\003\177\221R\037"
+	.ascii	"\251EU`k"
+	.string	"\367fKk\247\306\250\024>\323\237b\276\344;\215D3\202v\367\365\321\366\233Vx5+6\211\260\022\272\332\r&\370\350b\321\024s\240\fIpq.\205E\023\343\352\243\317\024c\277>\336_\322\331/\233\fRJ\n\262\200\302\005\222\207\242\310\366ztL\036\225J\177d\344\033$\"\333\023~\230P~$C\250Pz\241\037<Q\016\251\257\247\371\261\243[W\261b\007\313\nv\017\311W\r\251$C\017?x\246=\352B\271\333K\361a\300\324\374\0232\344\307W\375\213*\340\216n\371O\037y\360\334\351\256\241\0347&t\210\365M/\331\321,\223;J:V\261\332\031r\364>\227t\2503\246H8h,\315\262\203<Z\177\354\213\273\273\256>\366\215~\330H\375\032\251C\216\364\273\236\364\227\001\256`\273\321r\247\t\003br\240\345\304\332\355t\0217\230-6\b&\006\232\313\355\304\301\214\222\"[\320"
+	.string	"\245\005\345\304\300\314<\253e'8\r\267s&\3414_\314\032\313\311\202\213\315h.\266\233,f\243\261\324b\2623\027;9\340\033\316<c/\267\333\031{\005w\027\267\372<\3601\265\253<Q"
+	.ascii	"uUX\225\231 u\306e\365\314\036\322\232\336\316\356*\240\007\362"
+	.ascii	"\351L\325\372\343\262\276R\020V\365h\217+ p\202\0213\273\030"
+	.ascii	"qN\026S\316\236\345\027*\253Y\005\214w\305\267\025\021\017o\306"
+	.ascii	"\200\3755J\216\254\367mwEL\3336%\245\203?\366\202+\251\213\352"
+	.ascii	"O\344\302\230\b\020\372H`\314\257`D\b\370\247\016\263\246\275"
+	.ascii	"2[\026\362\334\202\021\204\363\025\317%\t%J>\206\230\347\335"
+	.ascii	"BhE$9\274\222\306\340\367"
+	.text
+	.section	.gnu.lto_pgStore.18.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`@\006\225%"
+	.string	"\032Bt\016K\220\330Q:\200\037U\346\027Py\2736\353\257\323*\353\323\311\005\302\300'~!\272\276l\323\341\245|d\017/\253\267\357\\\266\013(/3d\034"
+	.string	"\244k\004\200Y7\006\220\244M\265\347M\262\301\231N\223?(Nc\263\204\354\235d\313"
+	.string	"\321"
+	.string	"\323"
+	.string	"\351\321\333\375\rQ\327\375,\366KB\360\004M\344\323\310\362\2128\226sKt%\275n\365\350\355\376\365\261ZE\247\350\272\257D\244H*R\253\257$\314\234\363\202\243-\224\242[:;\277#\031\361[\016~-q\260\322\341\373#m\354Z\316Q[\2129g\006\235\201\250\273E\232K\327\205\364(\232C\367\333}\252\023\371\275=zM\316RX\305\234[\006\335 =\332m\332\335\375!'\376\272\215g;\305\364\030W\302\252\261\234s\016w\234\331\321\3637\263\243\230\306\177?\361\375\365\217\3653\310\023\226%&\244\237M\307g\202d\214-4LI\347"
+	.string	"\030]MG\376\236`\n\336K\343\3119\367]bZ\361F\337\335\026\272\373F\367LB33\267e~|\253/\362\327\216\344O\361m\332\333\177\366#\377\211oc\231\333\027\337\376\r\355E\262\200V\316)\312\304d/t\013\307\217\177\367\373U\216e\350V\372W\"$\227K\030\313\241'a\204ah\026]'\377\205\202\351\272\225m\304\205)\346\234i\204y\355p\3006\253\240\265x*\036*\2552\324\255~J\267\332\275G\351w\r\270\021DJUS\226\032\222\224\336\333\243"
+	.ascii	"m^q*d\302\260\261\037\373P\216\354\337\217}\222\276\223?A\221"
+	.ascii	"\226\252\361\314N\031k\231\241\303\367\306\326\331a\217dD\200"
+	.ascii	"\214\275\364\310B\034\343J\362\324\246/t\277\347j\217\260\211"
+	.ascii	"\n\304,\346\026\333\317z\223TG\223>\223k\261/\022\235y\212\007"
+	.ascii	"\212\026\223\027\006\252\204c\246\034%\353z-\tF\n\216\017\245"
+	.ascii	"\212\177\274\204\341\2617\274\013\207\002S*\266\325\240\302\341"
+	.ascii	"\241\204\262\345oBy-)le1sn\027\340\200\310c\200R>\271\205\032"
+	.ascii	"\305\346\227|\343\233\007\310u\\\2121\276U\370\342_+\027J\032"
+	.ascii	"\376\325\211\f\201\230\206\257\024\026\274eX\201\230p\f\255\031"
+	.ascii	"e\203\357\365\177\375(\306\204\f\233\314\003e\337\315j\260\r"
+	.ascii	"\026`\024:\005\273\303\265\020\2459'9\350\203\361z\3726\216f"
+	.ascii	"Gk\360\253\300\250\200\267\254\217\345\350\227\250|\345\265d"
+	.ascii	"X\n\260/\031\177y\334\f\310\211\257\374\305\206\300K\326\377"
+	.ascii	":\312#\352Z\261P\346K\326\335\006/\226\321\3753\347\234\033K"
+	.ascii	"u\333n\333\330n\327\334l4\267i\360\355:>\240\025D\317\254\201"
+	.ascii	"O(h\307\353\241\265\320Zbw!h\345\321\326\236\217\207s\035\362"
+	.ascii	"\361\235$\326\017E\025V\020; \226g$\263\226\330\365N\326w{\307"
+	.ascii	"\301\217\316\203\235\017;9\004\202V\036\356\237\034#\021,/\250"
+	.ascii	"\207\267\372V\"\037\236\217Q.h\007T\304\376\344\212v>D\271\037"
+	.ascii	"^/\227\203\240Y\243\225\227\363\261,/\247\266\300\237\031K\265"
+	.ascii	"\372\003\371\223\210\024j]\025\337\360\211\356\246a\bC \0166"
+	.ascii	"\315I\t\340^|\3035\334\215A\303\375R\253C%\214\324\375\243\221"
+	.ascii	"\353\307zm($G\2239Dy\303?\2366\374\343q4X\3056|1\245\0363\230"
+	.ascii	"\006\343\343\031\214\215J;V o\"\226\034\342^g2\330\203\221\256"
+	.ascii	"\244\033\346G~\202\222a\223Y\203ep\177\250a(\344\230SffH\002"
+	.ascii	"\221\231\264Pl`\2421Vg\033\022 g9i)ia\251e\377\r\341\225\246"
+	.ascii	"L\353\263\321\206,\030\242>.\267)5\007\nR\016\274k(\306\204\340"
+	.ascii	"\n\330\017\020C\rI\275\016\243\234\357\346\276\026O\3418\370"
+	.ascii	"\f\315;\370\302\337x\fT\001b\307\002\034\305\023\311\026\022"
+	.ascii	"\312\003\260\322\375.\3409!\346+\346\213Sz3\263\333b\213\215"
+	.ascii	"x<\272\r\240\013\333\336\016H\276\334b#]\177\212\250\265\354"
+	.ascii	"X\303h\211e3\032\017c\266\022A\335q&\274\202\2128\350\213\202"
+	.ascii	"\272\2063\001\177a\216T\240*\264\246\225\003JclUDxq\270\300\245"
+	.ascii	"\360cC\002\354_\213(1\305\315\323\345d\235k\320|\331q\\\202E"
+	.ascii	"vk\310pP\330\302.u=\036\323\006\260ue\3234\263\f#\364\207\364"
+	.ascii	"\270<jjx\016\263P\343\274k\325\f3\021\342\340` G=\344R6\237\343"
+	.ascii	"aG\020\025\007\311\210\304U\273\337S\222\346\017"
+	.text
+	.section	.gnu.lto_pgResetAll.19.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`?\004\005\035"
+	.string	"\2064\271K\260\224U:`\002\016\207\302vX\214)i\304\001\032\3304hL\216b\326\211\266/\023\205\207\213\357\003}r\202\367\375\033Y(w\002;8\211\216\356\337\017\372\017h\364\373\207\004#/g<NN\230\033\\]\321\032!d\023\271\223\f\243"
+	.string	"\235"
+	.string	"\241"
+	.ascii	";\316\303\366%F\302\253{\2031\210\334{\0350\204\363V\346\003"
+	.ascii	"\312[\362\001\312[\033s\226\243H\367MKxD\252{/\254]\230\307\343"
+	.ascii	"\361Xri\243\250H\305FQ\261\312I\364|\266\355\253\323,-\311\352"
+	.ascii	"j\3433\035\001\212*\275\237\320W\227\362\025\021q\365<\320\002"
+	.ascii	"h\342&i\352\210d\274~<\322\246j\n\352\305\327\241\237\256\226"
+	.ascii	"5H\334\326\336\257\304\311\223\304Y\344\200/\271&\227\362\031"
+	.ascii	"\221\fvFa\353\227\253}\342-\213(-A\240\211W3v\357\345\332\373"
+	.ascii	"\001\317\2553s\026f\3761wRFf\024W[\310|\001-\222\234\270\217"
+	.ascii	"\230m\345\030\027\353K\377IV6\377t\256\037\236\3772\227H10\344"
+	.ascii	"^\242#\230\033\305B\315\370\323?\264\300\030\027\271eE\304\230"
+	.ascii	"\237\030\311)\344;\237\232\240L\335{gt\347\235\202\376\203\017"
+	.ascii	"\244\213`i\335\2461\034\210K\026O\240;\250VB\261\256O\203>\004"
+	.ascii	"\"\200^\340\237\030y>\252{Q\007\267v\027\343\243|\242\345\305"
+	.ascii	"\356\343M\266\017\201~w\276\025\321\224\250\251{\321\231[\266"
+	.ascii	"p\3362z\276G\020s\353\266\266\230Ic\354\225\371\001G\376\221"
+	.ascii	"\224I\352Uk\277\370\217H\213t\247Jt?\373\2523\1773\313r\352{"
+	.ascii	",\243k!~\2459\370\212\027\"\025\262\205\374\333 UM\261~\312\230"
+	.ascii	"\2465A\311\325*\346\247?\361'\027\0354\276L\231\035\323\006\210"
+	.ascii	"\2740\254s#\033\316{s\021\370P\037v\3700\200\312[\263_|\261t"
+	.ascii	"\253G\276\323\2551\b\344+)^B\254\330r\373\351e\\\351\215\037"
+	.ascii	"\245@\223t\013\231HM\001\322\275\273\367\370B>dF\036\306-w\250"
+	.ascii	"\225"
+	.string	"\357\325\312\333\017oSq\253F>\361\244R\260\246JR\267\006\036d\030x*h\310\221\321\232k\"\340<\260\251\301PCS\300\207\347g6A\306A'\303\214\326\343b\034\232\236\237\031-\347\002M\346#\333\271\241\335\364\300rt2\360\314p`<:7;0\034Z\rF\223\200g=2\032\314g6\243\301Z\350\355}\304\3643e\022\345\326\270 \253\026\262\004#\323\325fU\345\016\357\241\250\332\311\344\346\024D\004\207\307A\354\242\342t\365\207\013\036\240|\273\372\273$\342\0018I\225\252\331B\2561\262\254\266VX3\257=tv\355\tNr\265\3126\351\330\255\032O\336{o\311\352?]\246\301k\263\372;\024\270\032P\2501$\344\224a\30603\221\314\320\314\250\r`\002\0212<\017\022 \246]FiXXX\254\377\033p\201\3526\377\321+\262\373W*\316\266\310h{\331 V\034vS\236\002}"
+	.string	"\007\312\223a\231\344\241\327\362\220\217e\202\326Th\036\301X0T$E\3646\177M\230dl5\206^0\222.X\310j\261\250n5 \t\224\262"
+	.ascii	"`\321\341\2706\"\323\373\320O\003\247\340+^t\023Y\301\021\261"
+	.ascii	"\004\232N:\230.\222\237\240\365'\r\366\331\346P\332Sr._\033\307"
+	.ascii	"\240f\337\252\260\360\017\277({\0046\003\216\320\0226h\272,S"
+	.ascii	"Q\320\\\354\341\206?\n\311\364zT"
+	.text
+	.section	.gnu.lto_pgActivateProfile.20.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\262\006\345'"
+	.string	"\332D,\017Hp\236Q:3\242F]/\322pb=\340\277"
+	.string	"\266\322#\326_j\2008\017k4\037\270\032\352\217\217\332\215\365\025\n\\}QwB\311{mh\212\205h\212r\241\027|\270ie]\023\371?wM\361\213\222O\b\331;\311\326"
+	.string	"\335"
+	.string	"\335"
+	.ascii	"\250\325\220'\262\314v\203\305\367\315\032_\"\rPf\246{\241\021"
+	.ascii	"\227\312rVFx\212va\373\312>\023\315b\177\345T\300/\221\236\207"
+	.ascii	"K\266\035e\312\2369+!<m\023\353\323V\256\267"
+	.string	"R\243\373\366\364\336\272Q,\354o\367\221\257\002|\262\265\332\226\363\023\022+\347\034\241)\254O\203\016\244>E/@}\332\300\356\261+\243\362\251\306\210\314\262\234\263\016#i\325\t\020+4N\200X\2459\252|\253\027\370\232\232\242\370\002\373SW\320D\247h\274\361\032ZS\332\241$g$\242\027\316\236Yg\376\3460\n\257\n\200\311\217\247>\216\242\f\300\212\260\311\031\225\320\002C\234=n\306\244\213\317\374\203\246f\321\370\343\267\306\346\234\373\026\215L\357\365\335-\244\273}t\253\277\375\013Qgc\215\215t\377\340n\373\374v\317o\347\336\365\346\271\335\306\335n\267mO\376+\200\333\265\337N\277|_\333\355\007x\332\261\210\033\234F\231w\244\325\311_i\326\222w\375\313\276\226\177\311\370\230>\231\fH\274\230=\304\206x\311\330:#.\275\253/\346\316\006^Y\375\250\316T\371\256\325\007\36305+v\244"
+	.ascii	"\237\344\241\371\2301\233#\354\357\271z\202\220\357I\336\200"
+	.ascii	"\214\335<\021Cn\255A\266\226H\030GF\265\230\021C\216a\373\213"
+	.ascii	"\227\227\037\232\217\312\314d\242\t\013Y\306\264f\371\372W\357"
+	.ascii	"\2622\351\322\337r.\276c\301@s\024\313\305\345Y\\\237\372\334"
+	.ascii	"\013@\262\335\277\362\335\352\307\nq\\\250*\244\024\245U\213"
+	.ascii	"\214\356\333\263\3248\226~\025\006\253s{\332d\2058r<\370]\307"
+	.ascii	"\340\324\325#\336\206\304\201(\036\334#\225\004r\022\206\303"
+	.ascii	"\027\363;\377!\3133A\332K\2506\214\303\004\264\210G\341\327S"
+	.ascii	"22\267\201\305\361zP\320y\021Maa\356A\n\313\214,k\031!X\207\347"
+	.ascii	"z\263\301\255\377\313Q3\247`\332[K]q\212\373\022\217\302\233"
+	.ascii	"\326\377\362\353h\312\371\22459\224\320\026j\r\367\250\234I\367"
+	.ascii	"\254\373\315\237\371\265lj\311\354i\3035\214\200I\274\323'\236"
+	.ascii	"\006\306\232sR\205>\032\032(\372I\220\324\2476|+\251d\360\246"
+	.ascii	"\365\263<E{\312U\267\201\315\321A\204\f\277\371 \\\223\f7\301"
+	.ascii	"(\0311\206j3m\203\250\234\207/\366\303^f\b}\222\247\275k\325"
+	.ascii	"\027[\365@\247\340E\3533\217By\272\3157a\371\242u+\205\027Cu"
+	.ascii	"\275\030G"
+	.string	"\270\245Q\024\202\250\355\325Z\337P\n\264Y\020\265=\334B\025v\023.\b\251\020\222``F\253\302\250C\353\242h\005\257w\204\353\235\204\243\037\257G\204\242\327\306h_\f\365\206\216tDE+\214x;\235Q\321\320\013\335\256\347\323IX\320\274\243\266\247\213\301\343\365t7e\360\330\310\324\327\246\235\257 \026>k\030\252-\004Io\270vv{wq\2169\355*\007\304\305\032\234I\367l\003\217\247\345\321\234sVo\370K\007\027\240^|\303\037>a\376\307\331|s\323\037\334\207c\343\227\023\353\277P\237\036Ps\354\016\361\247\2105\347|\f$\225l\322\361\322\305\365\240\266=\247\234\314\236T~0\353\203y\360\017\276\234\341\223\036\354\203\237\303)\356\301\0376\301\341\034\306Z\304;m\224\260<\366\"(_A\016YW@P\302\002\200\212\250a$\005\025C\b\325\210\210\2104M:`\002\231)3\333\022"
+	.string	"\006>F)\242\240\325z\354\035*\265\321\017[\361\312\337\246\253\217PA\206\267\261\225\371=\004\220o*`\034\333\267\314\230\335\256\231w\007\327m\340\206\221y\215\337L?\354#\335\371\230\252)V\333\210\225\262\365\211\026\036<\001\214\271/\035{\017\260\026\377\f_Js\236\307\336\354\332k\r\322\214F\202\241S\203\260\341\324"
+	.ascii	"\325\371\366Q\f\313\377\031]F\016\323\332\206\251\n\036\272\030"
+	.ascii	"\030F$\250#0\372>kh\306\"\275un$\311\251E\036\350\366:|\026\201"
+	.ascii	"\023\fG\234r\351\355\323\241\006\036\375\223\344WrT\211\261\214"
+	.ascii	"\nw\353\204\026)&T\024+\250>*\177\245\001\300\006\217)\235\274"
+	.ascii	"\250\016'\330\226b\303\260\242\257\236A\246\213l\353\237\210"
+	.ascii	"Tkg)mO2;\321\346|m\370\223\242\364\337\264\013\274\366E\373\334"
+	.ascii	"&\256E+K/\275>d\353NJ\334\007,\316gzF.\234\256\245I\201t\276"
+	.ascii	"U\345\241\f\310\r\230\217\b\376b\200\221\350;X\374\007"
+	.text
+	.section	.gnu.lto_pgResetCurrent.part.0.32.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\237\001%\017"
+	.string	"V\033bF"
+	.string	"\221(\035 \003\264+\021b\325\375\314Q\276h\017_+6Fb\bO;\254\371\371\223\300v&\240\212\032b\356Wi\204\320H~\371\364K\001\252\252\327\337\363S\201!\331T\210\310\332#,\036\201|\262\211\334)\005G"
+	.string	"Q"
+	.string	"P"
+	.ascii	"\353\222Q\263;\025\\\232Aw\351\371\001\334ew\001\334\245\375"
+	.ascii	"\023\266U,\2076\216\317\327^\306\005\203\214\266\273\336\245"
+	.ascii	"\212xx\215[\350?\366\216\226\326\352\352\321\352\360\030\340"
+	.ascii	"\033gdw\335y\270\345m\177l\237\354\337\b^q\026(\237\342|\261"
+	.ascii	"L5\026\033\357\022@\274?s\025\250\313\3703m\315.\033I\311\260"
+	.ascii	"\233\213\0171P\320vg\310e\307J\206:\215\032\213\r\3553\250\373"
+	.ascii	"1\225\335\361c\241\335\261\3521)\002s9\2608\260\0061~\372)\016"
+	.ascii	"\023>&u\220\r5\026J|\230\177\302]\252\236\306\005\204]\372\213"
+	.ascii	"\257\333U\021\361i.T\360a)\3562*\202\0210(\361\306\037\263\022"
+	.ascii	"66\326\242\276X\267o\253.\233\213V\031\035?\377s \tf\354n\270"
+	.ascii	"\311\261!$\f\022-T>m\373Z\3314\250\314\220\236\360\021\t-p\360"
+	.ascii	"\211\360\361\024\030\211@u\310c:\371\300\021\004Pd\"*\201@\220"
+	.ascii	"\311\033\221$\220|!\217\204\004*y!\260\304\363\034\360g\022\201"
+	.ascii	"\236\311\367\201^\307v\374\266\352z`\242\006\212\246\250\276"
+	.ascii	"\330\376\210\252W\233D!\276\305\006Vte?% P\002A\320$\017\221"
+	.ascii	"\311\323\352\201\357dX\030Qz\036\225\007\302\2327\334\222\207"
+	.ascii	"\021V\214\377\n\377\3432w\304\232(Z\245t\221\345\200\217@r\224"
+	.ascii	"Q\343\242\005\2601\260\216\n\026C\352\336N.S9\020]\027-\301\352"
+	.ascii	"9\327\202\235\274\317,`{!9\325\351\327\3161"
+	.text
+	.section	.gnu.lto_pgLoad.part.0.36.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`D\t\3650"
+	.string	"\032Q\330\021H`ZR:\377\266'k\252v\303\333\026\255\235o\256/\275\322\256x\005\224\342\272\321x\024$\017o\030\215\321\231\341Gt\322\257I\022{\030\345\371\005\223k\244\266`!\272\241\201\315\035\315\214\241\311\356m\265\237\020\262w\222\001\376"
+	.string	"\021\001\373"
+	.string	"]\200H\271\352rv\372|\005n\001\335{2\244\233M\231dua\220\324\3763\331\037\353`w\377\213\227\206^\016Y\331\303\347k\377\271\324\035\374\n\243\033z\241\226\315\234s\004V\353\213\027\255g\267\370}\275\035\306EI\030\227\206\252=yY\204\252MV\001\251\367Z\262\264\\\201\236\274\364\302\221\"\251:\363\224\024\353\003\b\337\203\365\257\334k\351_\rm`\316Uf\317\234s\210\337W\241\232|\227R\001g\326!\305\336"
+	.ascii	"\272\367\316>\225WYz\227\322\003\344l\265\345\231\263\363\301"
+	.ascii	"\327\246\360\373\332\316\023`\277\376>\200\375\332\375\255\356"
+	.ascii	"NJ\365R7\233;\257\362\275\2260\301\352r\316\303\257\030\311\227"
+	.ascii	"\276\252\370\262K\375\217\035hc\212\351k\316\024\217\253\327"
+	.ascii	"\306\324\216c\265AZ\021\270\235\251\245z\200\352l\307\337~oL"
+	.ascii	"5\335+\340\254/(\347\334\277\036o\337\273\273Dwgu\003\035\004"
+	.ascii	"\227\251\211j\276rRq,\235>\335}\324\304\353\274\2222\262c\222"
+	.ascii	"\r\277\376y`\367\367\362\372z\027\210\230\251\213\353\340\265"
+	.ascii	"Djw\265\376\335\361\222\311\236\274l\022\023\003\272\335\243"
+	.ascii	"\3758\237>\247u\r\025\352=\235\374\276\262e\342,\035\016Q\250"
+	.ascii	"tf)\037\025\326\257\315\351\332\271\003J\264\3340\271i\321\356"
+	.ascii	"\230dm\332\262\313\035\035\256\317\006\003\222\2728\260\035m"
+	.ascii	"TqGb\354\230dg\356\326_\363\267N&\211\256\326W\363\266\225\t"
+	.ascii	"-\371\257\242\232\177d\fw\204\255'\374\020\375\253X c\271(m\\"
+	.ascii	"k? k]J\030*\253ajm\\\3214ih\214-\\\262^"
+	.string	"@\217\376\331Oc\277\322\320\030\205Kg\236\032\021\244\214\253\316\352w\206\250ov\264\237\023\264~\231\237\021\335\214\0135_\005\225\211I\205\374\276\366\334\017\340\002\352\276\031\321\311\034\275\326\264\370\370\225\035u\007/\246;\330H\007\323\207\256V\314h\345\234\203_\311\202\232\240\262\032\321\266{\300zN\347\262Z\221\202\337\323\331\336A\312\265\261\206\262?\f\304}\231?X\354\303\327\3012\215f\234\346\352\230\246R\305,\376\023\035\306*\366\2012\365r\246\2522\276\335\205\375\274\037\357\217\272\312j2\225.\330;\221\275\030c\003P\346\217\246&qk\270\370\345\274\254\320\027\212F\211~\022%|0\267*\312\273\327\337\373:W\245w`\032]\024\326\\\306\317\273\220\355Zq^S\211\367u\253*\247\371q`\211\023\315\027\033y\372\237\277\367\256\357\345\235Ay\357\032\263\330H\367\325\214\255\272\257\345\357\341\331\021p\033"
+	.ascii	"\276\255\023\340v0\007\337\006\036\354"
+	.string	"\377\365\334\366\341\333\354\303\376\025\337Vync\236\333\367\316\377\003\002\f\317r\216\332\303\313\315\025\f\223G\377\273\337\316\251\2350\334\204\037\244.\336y\025ub\312$ckJ\3661\250\t\312I\355\322G\f\345\344\366\356\016\021\222\206\332\027(X\tI,\212F$\n_\353B(Img\030C\024[\244\257E\022R\2416\213\242\243\021\t\331\306\360\2653\214H*\321\0219\244\312hW\024uh_\030\207\216H#\235\376\251@\234`\341g\305\017\004\004\305\026\211\233\b\301\b\306\021YD\201l\223Z\"!\244\220\321\260h\034*:\022\207EF!\242!\021\2114\204\300\240\217F-r\230t<\"\207\301\253\031[\215]C\026\232\251T\211\233Vl\244\203S\336\256r\221a\212\335\034\314\203ot\033\270>\334\203yp\367\007\020\3676\232B\363\t3u\337\215m\r\330\314rN\245[Q\036|7uG\b"
+	.string	"\347\340\035\3747OQt0"
+	.string	" V\261\016\306\320\247'm\326\307\336\2445\261\t6\210Ux\235-\257\335\206\260\346Tzq\020+"
+	.ascii	"c\352\321}\275\233;0\r\216\233\013\tH\211\346\340\273\375B\323"
+	.ascii	"\255C\334\034\"\022\\\345`\036\254*\004\240D\327\304\375o\377"
+	.ascii	"\260E:\225*\345\330\304]\250|\273\210!\001\200\322\250\2018\246"
+	.ascii	"\020C\206hF$IA\222\016\200\002\221\2512\333\022 w%\245\220\311"
+	.ascii	"\204\245)\324h\337q^\253\232\232\242&^\013=\3221\304w\303?'\002"
+	.ascii	"Vh\313\344E\345\261\222\367A\264\017\245H\274\t\323%p^\307!\004"
+	.ascii	"=S\371\344\362(]\r\002\203\025\240\371\235\376\034{{\276B\312"
+	.ascii	"\342 \f\270#\354\361B\224<U-\302\r\220*\316\036w{?\340\371\241"
+	.ascii	"\023\327\364\366\240\242\220\253\315\265\351\244f\n\017\341\001"
+	.ascii	"\274\313\217\306K\235\264\001I\342\277\321\333#I\007;\020\326"
+	.ascii	"]\234\276\2416\013\302\024\235\266\344\023!NNrl\334\225L\002"
+	.ascii	"\212\351O\177M]\321Gb MMr\1774[\244Y2w\023/\324I\326\276\330"
+	.ascii	"\263\321\2319^-\254\314\200\225\275\353\206\307\355(R\257\036"
+	.ascii	"\226\365uU\2559$\\\301\331\"_\t\304\223\003c\202\217^\376\022"
+	.ascii	"\254\020hA,\216\275\022\204\217\222\330\240\b\343\345\210\341"
+	.ascii	"\364\270u4\335\353\266cD\202\351\335\373M\245\331'u\020s\321"
+	.ascii	"\343\302\b\225\346\212\333 :]lr\264\356\242\360\341\355\003\370"
+	.ascii	"r\307@<(\341\303\227>A\322\363E4\364V\306\310\275\234'\336\366"
+	.ascii	"\004\007)\025X\225\357-\343\2010:N\222+\320\221h\241\205)\177"
+	.ascii	"1-\275\255$\324\360\266!\321\350\321v\354\234w\212\303?\367\204"
+	.ascii	"\004'\200\223`;\177N\277=\023w\357\261\026\004\366\321\200\361"
+	.ascii	"\350\376\314o\211\\4J\300\216\237~n\224\231\256\001+\302\037"
+	.ascii	"\366\237\320\246\211\250\327\306i"
+	.text
+	.section	.gnu.lto_.symbol_nodes.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\025\t"
+	.string	"\022\21668Pm\323\001\004q@\364aP\245\2400\242\027\211\267\322\310\231F\206cZ\302\237\313\357[23\315\315L\243$2\0350\203\005\0362\353\267v\306\004\0322\353&B\244\224)\277D\345\017\022\210\bL{\312\212\007\n\246\261\007\300WH\225\364\001\231P\031;`\031o!\3550D\031\307\3605UEF\323\004_\330\022uI\037\220\351\027\346\3461\376N\033\305:\317\234\215\272\027\024'\245S\030\221~\244Cc\264\235\255S\346\254\320\236\312P\376\236\226\204\376\264a\304\242\202\320\335v\025%\020\2609O\017\034\264\300\032t\246\240\267%\350\200O\323\331T\377w\206\034\fb\211\005\2473\257\027@9\247\304\246\301\325t\036:N\365\337\222s\206\033\177\377!\241RRJ\311\265\266\377u\f\034"
+	.string	"9\341p0Q\315j<0\264\313\320\016\035\303\017\203\363\251\034}L\177\n\206\313\236N\027?\257\333;\277!\365#XH\263C"
+	.string	"\032\037J*\003\340\006\034\346\242!/\274\006\324\350\311\352\245\204"
+	.ascii	"\306\323Z\236"
+	.text
+	.section	.gnu.lto_.refs.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\002\001\016"
+	.string	"\002\002\017"
+	.string	"\002\005\002\006\024"
+	.string	"\002\007\021"
+	.string	"\002\n\002\006\025"
+	.string	"\002\007\022"
+	.string	"\002\r\002\006\035"
+	.string	"\002\007\032"
+	.string	"\002\016\002\0062"
+	.string	"\002\007/"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.963ec99ff402cd7c,"e",@progbits
+	.string	"(\265/\375`\002\027\315k"
+	.ascii	"j\260\270&R0PJJ\007\377\312\02199\273\261Q\275\323\316\230\023"
+	.ascii	"\221g$\213\332\033>*\362\263w\322\307\275\245\250\355\330uRo"
+	.ascii	"\255\035\266\310x\373Q\307\344\3267\325D \266\360\250\004\207"
+	.ascii	"R\261\025Ta\352\"\003o\003Vib\213\323ew\317#F\032!R\246\017\002"
+	.ascii	"X\002d\002[kb\254\204\2222\336\372}\240\260\027\216q\347^![\254"
+	.ascii	"\230\3405V\343.\214\306^\330\311i\f=/\301W\222\034\205\323x\n"
+	.ascii	"W\3413*\r\266\314\230I\032\217\361\031\237=\351\334$\2257\270"
+	.ascii	"{/\017\017\017\217\n\036\236\023"
+	.string	"I\3153 8j\373\267\003\220\312\020\230|\201\273\267\335\302\\\330\311gW\321\336\373\237\337\347\214\261\260Y\332\022q\257\220*\003\216oIu\321{[\036\002xn\304\244\255\375X\315\312p\244\264E\306\264\312ZzO=\310p8ea'\223\035\214\315\275\007\260e\262\252\224\241\251\271\022\304\0243\261g$\266[\344`\205\355\002\007\244\006\366C\226\2510\030;\037\340\260\263\024\216r\336\261\275m\037\251{\322\325\352\211\330\363\003kzw\307\017\254\037b\233Q\254:\234b\375\013\354Y`\177\376\362\3429\263\2201k/~6Z\331\022\262Uv\302\\\354D\200\223\370\0040\236\032\271\356\326\275m\316\215\235\021vs\255\276\004\326\346\347\334u\001\270.\214\257\354\031\201\225\357\030\201\365\315\3520\212u\005\022?k\361\326\003\251r\211y\277\356mw\330\244\225([\255\276\345\024+\313(V\007\n\370\333\202\233\277\325"
+	.string	"\360\340\277\212\277\221\332p"
+	.string	"\300IE\037\340o\035~6\340\347\344\377.\027\310\343u\376v\361\243 \370s\315\016\317\357\374M\300\377:\326\341\177\032"
+	.string	"\234\003\343\360"
+	.string	"\376\206\341\277\226\237\215~.\002S\266\361\377\354g.,\003\rL\224\271\360\363\fu?\207\375\357\302\r\324\370\377\373\237\002\316\337\033\374,\364s\013?{\3603\007?g\360\263"
+	.string	"?W\360\263\315\317/~\206\340g\007~^\361\363\001?\337\374\334\373Y\375o\367\237\314\3771\377\331\376\027\375\267\362\037\370\377\371?\211\377)\374\207\373\357\300\3770\377\301\374\177\373\357\365\337\355\377\227\377m\377\267\3763\360\237\354\277\315\335\335\335\335\257\266\360w\022\277\0164a\030-\213\020\037\255v\323\241dfSR\207\252?T\321*\333b\237V\261GB\352\245\365^n\231L\313^\263\223ZG'\365\022k\344.\245\247\0266WmD\332Vz/1\330\232S\256\207\205\251\203G\253O\245\330\247Hl\232\366\363>\312\321I\326i\357\024\225\025\315\227\027\037G\314\260o.l\n\375y\337\267\261\223\314u\2155]RJW\321{\241\"\340=\251\272v\215t\362r\323\322n\33101\035a\266\332\307g\f\313;"
+	.ascii	"\373\374\301iM\n\373V\302\366\310~\330\f\313\235\243\217\262"
+	.ascii	"\035\333^\246\031kNb\321\373\264l\301v73\0061\326*7\301t+\326"
+	.ascii	"\362\2109\272\271\032$#b\340\330\332kf,\313J\253N>\303P\2342"
+	.ascii	"^_\244\330+\345\332*\323\244\325\267\221\375\373_\357qy\357u"
+	.ascii	"\342\2657\fis\346\235[\3747\234\262\002\377\325{\377\247\t\234"
+	.ascii	"\335+\305$\263fi\366 \323+\256\006\367\232\240L6\227;J\347\321"
+	.ascii	"\270\243\3246\233\224\316f\323\316m\271z\\\247\220{\225I\246"
+	.ascii	"\261\217\267\275M:7\331lb\357\021N\331\336\345\316m\217\313\353"
+	.ascii	"\274\227os\251\374:\032w\224\316\246Q\351d6\355(\333f\323M^#"
+	.ascii	"\233\344\2727\311l\332\311j\233W\351<6\351(\235Lc\024\263\b\026"
+	.ascii	"\024iI9'\312\344\335Q@V\222\271<S\266L\016\273\327\370ut\227"
+	.ascii	"\334\336\333\274\027\212\311\",Ye\fC\236\355\350=%[#\003\241"
+	.ascii	"\0039\305\244i\221\367Ly\305\254qt\357\332\325A\201\221\2159"
+	.ascii	".\322\310\367\036\265\313{\221\314\030\236\230\234\226cyon\362"
+	.ascii	"\270\204\234b\332\034!\2319\356U\020nR:\247\230>U\236N\253\213"
+	.ascii	"l\215lu\327\232K\326il\257r\314\215\034\225.Q+<$Swr\255\266\004"
+	.ascii	"\364z\350\202\203j\225\343\370\356\216..G\351d\336{\3441,\346"
+	.ascii	"\034\367\313\314\202\231EN\fKSK\253\327s5\013BK\331\227W\313"
+	.ascii	"\312Qi\322\321jX[\023\026\365\304\207\267\257'\231\250/ng6GW"
+	.ascii	"\213\217\376\322F\363l\263\314Zek\223\367^\025-eL\034\0270\366"
+	.ascii	"\274\325\362\027[\223'\354\0257M\336\250:\253\032'JN\270ly\243"
+	.ascii	"\275\231\310R\342\345\330js\301y*\023\203;kh\222!\316%\255\336"
+	.ascii	"\005\313\305\243\251\251\3256\273z[\212k\265\313\016\265yR\213"
+	.ascii	"\026!\3439\261\351\231\237\347\033\312\263\307R4\233k\344\272"
+	.ascii	"L\275(Yjf\242W\371\324\002G)LsH\225\367\330\373\312\0040\376"
+	.ascii	"\006$\362|\266\332K\274\241F\306<\225J4\224\b7)vc\330\266\342"
+	.ascii	"\002\310\231 t\255\276\305\250\230@\202\325j\363\241k\207\265"
+	.ascii	"\0161, \2556\330\303\334HqB\005\325T\314\246\320\220\255v\224"
+	.ascii	"\226\302\316\223\365\224u\371\324\336/\034\261\034O\310\334\330"
+	.ascii	"\363\300'[\373\353\375\344\247\241\021\213\032\322Lc\377\366"
+	.ascii	"\202\342\345\207\325\026\366\352\030\253n\265\263\235\315\245"
+	.ascii	"s\221h`\2544\230\262\322z\262j\\\3336\027?a\3205\006\307;Sj\315"
+	.ascii	"\234\274\271\300\364\234\031(XZ,/\210\0217\242\231\360\275_N"
+	.ascii	"bYQK\2245!\361f\002\255\"{\n\321jo1]\rZ\311\036Zm\255\234\246"
+	.ascii	"\037lL\264\332G\034\332Uo=\210=ySf\334\300\222\260+[[\265U/\341"
+	.ascii	")(\216\032\357\324\212x/i\254\256!uKZm\254\356\253V\362\306\352"
+	.ascii	"$6\311\266\261Tf\201\303\314\202\007Er\354Z\325\253H\330&\342"
+	.ascii	"o\274,gd\220P\203\260=#\216\374HW\361\275nvNbQv\310\224\035L"
+	.ascii	"$\357\252!#<\212h\265\205`:\033\263$\204\030\242\002\301\246"
+	.ascii	"E~\336TF\232\210\212\037VumlL\255^\305\301>\205cS%?\357\346\247"
+	.ascii	"\232\210\n\256k\304A\203R\272\212\256S\346\220hq[71\351\320\206"
+	.ascii	"\b\261a\336\030\351\022\307l\225ME\232\025e\b"
+	.string	"\0263\366)\024\226\375\212\352 Q\315\f\301\005-'\261(\216\024X\335\025\2517\223\351T)( T\254\304z\246\311\017Z]L\335\203\251\241\376\376\361\206\252a:2#\246\325\366q\002K\324\013\227V\033\210C\301\230AZ\355\247\207\251)c\307\214\256\306\237e\367X6\017\276\313{\237n\212V\345$\226\245\342\230Sk\376\360\346q\342\313S\256H\253\355\003\323\321yMy\265\332=\034\212s\004\366\265l\265\235\036E Q\n\f\022\021\207\276\025~B\032\033\276\"\361\006\nD\021~\302\023E\037\221\006\215\022~B\024~\302\225\004\037\3615^\374\200D\303\"\261\3077dT$\004$\352\031\022\215z\004(*2\002\002\203\300^\021h\265!8\254Q\f\002{4\202|E\352\r\241\220\r\237\215\325WDD#84\301W\f\252\201\250(\264\301O\270ST\264\301\t\3370XD\341'\354\025\005\203\034"
+	.ascii	"\361n\b\203\035\364P\004\260\203b\bH\364\301O\270\256CA\301\021"
+	.ascii	"~\302\033\034\t^\024\207A\302\027E"
+	.string	"\240o84\352 \305\020\320\007\2000\030"
+	.string	"P"
+	.ascii	"A\305\240!\240\237\020\2508\f*\022\201\200xR\\\310'\004\f*\022"
+	.ascii	"\201\"\344\\\210h\350\003\372~\354)\210\341\"\206\214\033z\227"
+	.ascii	"1C\202\031\022\254\2271\303\307gF\f\037\3661|\322\342k0\360\240"
+	.ascii	"\3207\354)\006\203\303\236\032!\240\321\007E\037\261\006H\243"
+	.ascii	"\213>\242o\310#\002\335\030\026\211D?\337\t?\241M\021\b\370\023"
+	.ascii	"\362\200?aZ\004\212\341\303\372p \"\252D\242o84\024\324\273!"
+	.ascii	"\f\n\251E \031E \221Q\3570b\bM \003\306\020\214\027\006\334\002"
+	.ascii	"\013:X\241\002\t \260B/\204F\301\341\017h\350+\372l\004\r\203"
+	.ascii	"\204=?\"\032\300\240P\017\220(\310F\217\320\220\330\363b\201"
+	.ascii	"aQ\230>=Js\260"
+	.string	"\363\320T\371\024)M:M\262m\235\367\336\034\03435/k\255\256\340\024\253\312(\326\363\270\330\033z\177\212\243\241.M\022*IM\322d\225\032e\3512[\2459\222\336\024\231\336\364H\263\274\300\254\t\270\324\370\364\370\274!\342H\025&\353\256\227\204d]\325\331\261\035\217\265m\251j\225\215\243\353:\2729\036\022\226M\222\353\271\226\3533!\030O\230\322M\274\317\260W\026\217+m\253\035e\272\025\215\311\020I<!l\016\230\025\025\026\231w\231\367\225\0341<\202\374h\265\305\364\230%VP\330\300$q\023c\322j\303u\034\225\325\023+\017s\270eN\364*\332\026\246\307no\207\326\034\0210I\376!\205T\346\374\333\301\244\321 E\\74\234\263&wFZ\245\331\321\326_\332\322{\243\316X\361\200\2605\221\336\231\262\250\227Vi\272\364Z\227V\023A\030U\272\212zy\253q\225\024\213\217\034E"
+	.string	"\301\252QY\336Z\2624Z\316\323\275K\001\201\347\250\2010\207\034D#\"#\"\222$I\206\0031\005\204\030\346,u\334\022 \026=\320!fj\206$I\366\353>d*X\227n)-h\377\213\273%SzR\335\250V=\300\233\364,\251\312\217\317\365\006\255\254"
+	.string	"Kwp\034@C\236\347\026F\325|\325\376\351$+>?y8\317B'U}.C\245\0254v\272\242M\216j\037$\005\372\225Jid\254\372TD\nq\250"
+	.string	"\344\352\272n\223\233\242\266\203\203\035^\324<}\317\205\004bB&?\305B%<\362j\223\212Be_\363\371\345\214\232/\t\323\035\305E\246}\304;\360\366J`\307\234\b0\264\342\bY\254\306k\017\254\373\b\250\364\005\223\244D\250\201\336\363/\201\007\306*\0301\350\236\231\024b}\227\226\376\005\326\204o;2+\240/\344\344s\366'OM\256xRf\024@\261\233i(5>\234kj\374\262\317\342\320@\b\347s\023\355\221q\217 \275~m\256\035,|\334\303\307\310\\\021\362 \252\233'\267\315\020%\364\344([Y\312@\347?\"`1V4d\227\220()\020/\262"
+	.string	"\341A\264\027\363\n\036\234\250\237\305T\262\314\n\003\333n\361\030\320\260U\203\004\275\232\331\361\022WL\351\263F\b$\005L\204\365\263\f\376c\001\2350\261Ca\334\360c\001f\21730ip\300\367\177\236\367\352;h\342\273\374\023$o\226oD/n~,T\241\273\236\264\007\333'\260r\255\222t!\216\252\375\370\341\006V\376\004\340\036\215\2201\002d4mK\343\210\376\031/\310o\026"
+	.string	"q\325\234B\0213\032\216<+\202r\243\017\343\235\223\253\230\275<7f\235\025\211\337\320\024\f\241\253\310\357\220\265\222J=1\330\261\314\004b\346\016\207\243y4(\210!\261gdf\370Y\302\202<\264\371B\330\203+j`\333\365\2611#\033Sg\244\b<X\215\037=\370\340.\301\323\267f\0067\377E\252\241\246\310\027\334K\266pu\200XD\2645n\313P\225C\017d;HH\250\362\326d\244j\371\207\331|\030h\317\253|\216BL\261\205\004#:|S/\bM4\230\306Wd\245~L\n\244\007\004\276k\324ynF%\231\3018\363\030\265\024l\323\273+h\214_f\177\016\001\232\033c\245\b\257\324\361u@\267|\354\305$<%\243\001\277\367\205\177t\035j\t\266t;H\212\216\001\363\210\243\365EHb<\036@\327 J\261\242K\302\214]S)F\361\360\246"
+	.string	"\346\220\216\256\334\004\354\302M\036O\245A\023d.W\212\213\017\337\361\224EE\213\217\230\331Lm\036\252uc\361\203\313\243&\220\230\275F%,'\325\007\352\300\237\204\364\371e\327o\264_F\307L8\003X\005\263\326Af%\243\227\277\317|\376\234\235d\271\251\252\353s\240\345U\331 \373\242\034@\271*g"
+	.ascii	"\377F^\340\257\f\263\231\034\002\250\257\246-\372\250\370*\024"
+	.ascii	"\276\017\337[\013\251k\006p\234\346\353\363\214\001\332T\325"
+	.ascii	"\225_]\357\331|m\303\354/&\016\332\376:\205\337\356\336g\217"
+	.ascii	"\321=E\355\177\361\354AX\262k\003\312l[n)\376\251\275\313N`\376"
+	.ascii	"\222\026\327\232;I5kl\316\322\375\"\031\373\031\276:\334:\241"
+	.ascii	"zL\036\007ey\346S\310\332\324\032\3447\334\332\241\312\023\363"
+	.ascii	"\034\233\207\n]\235\f]\0340\007\362w\373v\274{\313\371\351,\313"
+	.ascii	"7\031\266X\317\313\224h\200\303\267\366c\275Y\267\32447Cne>:"
+	.ascii	"\357\220Wu\007\325\237\362\001\265\304VH\277\016b\027\027S\005"
+	.text
+	.section	.gnu.lto_.symtab.963ec99ff402cd7c,"e",@progbits
+	.string	"pgFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \001"
+	.string	""
+	.string	"pgReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\001"
+	.string	""
+	.string	"pgResetCurrent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"pgLoad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\001"
+	.string	""
+	.string	"pgStore"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\001"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"pgActivateProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\001"
+	.string	""
+	.string	"__start_pg_resetdata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"__stop_pg_resetdata"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\001"
+	.string	""
+	.string	"__stop_pg_registry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.string	"__start_pg_registry"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.963ec99ff402cd7c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12544 @@
+	.file	"accgyro.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/log.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/drivers/bus.h"
+	.file 7 "./src/main/drivers/exti.h"
+	.file 8 "./src/main/drivers/sensor.h"
+	.file 9 "./src/main/drivers/accgyro/accgyro.h"
+	.file 10 "./src/main/common/time.h"
+	.file 11 "./src/main/drivers/accgyro/accgyro.c"
+	.file 12 "./src/main/build/atomic.h"
+	.file 13 "./src/main/target/SITL/target.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	accgyro.c.eb90856a
+	.weak	accgyro.c.eb90856a
+accgyro.c.eb90856a:
+	.long	0x9d5
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1849
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1659
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1660
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1661
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1662
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1663
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1666
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1667
+	.uleb128 0x3
+	.long	.LASF1668
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1669
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1670
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1672
+	.uleb128 0x9
+	.long	0xa4
+	.uleb128 0x3
+	.long	.LASF1673
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF1674
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1675
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x9
+	.long	0xc8
+	.uleb128 0xf
+	.long	0xc8
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xf
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF1678
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1679
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1680
+	.uleb128 0x4
+	.long	0xab
+	.uleb128 0x4
+	.long	0xc8
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x4
+	.byte	0x15
+	.long	0x173
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0x4
+	.byte	0x23
+	.byte	0x3
+	.long	0x11f
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1694
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0x5
+	.byte	0x7
+	.byte	0x11
+	.long	0xc8
+	.uleb128 0x3
+	.long	.LASF1696
+	.byte	0x5
+	.byte	0x8
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1697
+	.uleb128 0xf
+	.long	0x19e
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x3a
+	.long	0x1d4
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1703
+	.byte	0x6
+	.byte	0x40
+	.byte	0x3
+	.long	0x1aa
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x4b
+	.long	0x318
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1754
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x1e0
+	.uleb128 0x15
+	.byte	0xa6
+	.uleb128 0xd
+	.long	.LASF1763
+	.byte	0x18
+	.byte	0x6
+	.byte	0x9f
+	.byte	0x10
+	.long	0x39c
+	.uleb128 0x2
+	.long	.LASF1755
+	.byte	0x6
+	.byte	0xa0
+	.byte	0xc
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0x6
+	.byte	0xa1
+	.byte	0xf
+	.long	0x1d4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1757
+	.byte	0x6
+	.byte	0xa2
+	.byte	0x17
+	.long	0x318
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0x6
+	.byte	0xa3
+	.byte	0xd
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x10
+	.string	"tag"
+	.byte	0x6
+	.byte	0xa4
+	.byte	0xd
+	.long	0xc8
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x6
+	.byte	0xa5
+	.byte	0xd
+	.long	0xc8
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1760
+	.byte	0x6
+	.byte	0xb3
+	.byte	0x7
+	.long	0x324
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0x6
+	.byte	0xb4
+	.byte	0xd
+	.long	0x186
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0x6
+	.byte	0xb5
+	.byte	0x3
+	.long	0x326
+	.uleb128 0x9
+	.long	0x39c
+	.uleb128 0x15
+	.byte	0xbc
+	.uleb128 0xd
+	.long	.LASF1764
+	.byte	0x28
+	.byte	0x6
+	.byte	0xb7
+	.byte	0x10
+	.long	0x418
+	.uleb128 0x2
+	.long	.LASF1765
+	.byte	0x6
+	.byte	0xb8
+	.byte	0x23
+	.long	0x418
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0x6
+	.byte	0xb9
+	.byte	0xf
+	.long	0x1d4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0x6
+	.byte	0xba
+	.byte	0xe
+	.long	0xea
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1759
+	.byte	0x6
+	.byte	0xbb
+	.byte	0xe
+	.long	0xea
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1760
+	.byte	0x6
+	.byte	0xc9
+	.byte	0x7
+	.long	0x3ad
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1761
+	.byte	0x6
+	.byte	0xca
+	.byte	0xa
+	.long	0x192
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1766
+	.byte	0x6
+	.byte	0xcb
+	.byte	0x10
+	.long	0x41d
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x3a8
+	.uleb128 0x4
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0x6
+	.byte	0xce
+	.byte	0x3
+	.long	0x3af
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0x7
+	.byte	0x1c
+	.byte	0x22
+	.long	0x43a
+	.uleb128 0xd
+	.long	.LASF1769
+	.byte	0x8
+	.byte	0x7
+	.byte	0x1f
+	.byte	0x8
+	.long	0x454
+	.uleb128 0x10
+	.string	"fn"
+	.byte	0x7
+	.byte	0x20
+	.byte	0x1a
+	.long	0x470
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1770
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xe
+	.long	0x460
+	.uleb128 0x16
+	.long	0x46b
+	.uleb128 0x8
+	.long	0x46b
+	.byte	0
+	.uleb128 0x4
+	.long	0x42e
+	.uleb128 0x4
+	.long	0x454
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x8
+	.byte	0x1a
+	.long	0x4b7
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1780
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x475
+	.uleb128 0x4
+	.long	0xbc
+	.uleb128 0x3
+	.long	.LASF1781
+	.byte	0x8
+	.byte	0x2d
+	.byte	0x10
+	.long	0x4d4
+	.uleb128 0x4
+	.long	0x4d9
+	.uleb128 0x16
+	.long	0x4e4
+	.uleb128 0x8
+	.long	0x4e4
+	.byte	0
+	.uleb128 0x4
+	.long	0x4e9
+	.uleb128 0x17
+	.long	.LASF1782
+	.value	0x170
+	.byte	0x39
+	.long	0x5d3
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x13
+	.long	0x73c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x9
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x4c8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x5d3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x1f
+	.long	0x5ff
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x26
+	.long	0x624
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x1d
+	.long	0x5f3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1789
+	.byte	0x9
+	.byte	0x40
+	.byte	0x17
+	.long	0x42e
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1790
+	.byte	0x9
+	.byte	0x41
+	.byte	0xb
+	.long	0x17f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1791
+	.byte	0x9
+	.byte	0x42
+	.byte	0xd
+	.long	0x6b6
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1792
+	.byte	0x9
+	.byte	0x43
+	.byte	0xd
+	.long	0x6b6
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0x9
+	.byte	0x44
+	.byte	0xd
+	.long	0xc8
+	.byte	0x48
+	.uleb128 0x10
+	.string	"lpf"
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0xc8
+	.byte	0x49
+	.uleb128 0x2
+	.long	.LASF1794
+	.byte	0x9
+	.byte	0x46
+	.byte	0xe
+	.long	0xea
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF1795
+	.byte	0x9
+	.byte	0x47
+	.byte	0x12
+	.long	0x1a5
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1796
+	.byte	0x9
+	.byte	0x48
+	.byte	0xe
+	.long	0xea
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1797
+	.byte	0x9
+	.byte	0x49
+	.byte	0x14
+	.long	0x4b7
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x18
+	.long	0x730
+	.byte	0x60
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1799
+	.byte	0x8
+	.byte	0x2e
+	.byte	0xf
+	.long	0x5df
+	.uleb128 0x4
+	.long	0x5e4
+	.uleb128 0x18
+	.long	0x19e
+	.long	0x5f3
+	.uleb128 0x8
+	.long	0x4e4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1800
+	.byte	0x8
+	.byte	0x2f
+	.byte	0xf
+	.long	0x5df
+	.uleb128 0x3
+	.long	.LASF1801
+	.byte	0x8
+	.byte	0x30
+	.byte	0xf
+	.long	0x60b
+	.uleb128 0x4
+	.long	0x610
+	.uleb128 0x18
+	.long	0x19e
+	.long	0x624
+	.uleb128 0x8
+	.long	0x4e4
+	.uleb128 0x8
+	.long	0x4c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1802
+	.byte	0x8
+	.byte	0x31
+	.byte	0xf
+	.long	0x5df
+	.uleb128 0x3
+	.long	.LASF1803
+	.byte	0xa
+	.byte	0x21
+	.byte	0x12
+	.long	0xfb
+	.uleb128 0x1e
+	.byte	0x6
+	.byte	0x9
+	.byte	0x23
+	.byte	0x9
+	.long	0x66d
+	.uleb128 0x2
+	.long	.LASF1804
+	.byte	0x9
+	.byte	0x24
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1805
+	.byte	0x9
+	.byte	0x25
+	.byte	0xe
+	.long	0xde
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1806
+	.byte	0x9
+	.byte	0x26
+	.byte	0xd
+	.long	0x66d
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0xc8
+	.long	0x67d
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1807
+	.byte	0x9
+	.byte	0x27
+	.byte	0x3
+	.long	0x63c
+	.uleb128 0x9
+	.long	0x67d
+	.uleb128 0xd
+	.long	.LASF1808
+	.byte	0x10
+	.byte	0x9
+	.byte	0x2b
+	.byte	0x10
+	.long	0x6b6
+	.uleb128 0x2
+	.long	.LASF1809
+	.byte	0x9
+	.byte	0x2c
+	.byte	0xe
+	.long	0x630
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1791
+	.byte	0x9
+	.byte	0x2d
+	.byte	0xd
+	.long	0x6b6
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.long	0xbc
+	.long	0x6c6
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x3
+	.long	0x68e
+	.uleb128 0x17
+	.long	.LASF1811
+	.value	0x110
+	.byte	0x31
+	.long	0x720
+	.uleb128 0x2
+	.long	.LASF1812
+	.byte	0x9
+	.byte	0x32
+	.byte	0x12
+	.long	0x720
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1813
+	.byte	0x33
+	.byte	0x16
+	.long	0xd9
+	.value	0x100
+	.uleb128 0xe
+	.long	.LASF1814
+	.byte	0x34
+	.byte	0x16
+	.long	0xd9
+	.value	0x101
+	.uleb128 0xe
+	.long	.LASF1815
+	.byte	0x35
+	.byte	0x17
+	.long	0xf6
+	.value	0x104
+	.uleb128 0xe
+	.long	.LASF1816
+	.byte	0x36
+	.byte	0x12
+	.long	0x1a5
+	.value	0x108
+	.byte	0
+	.uleb128 0x11
+	.long	0x6c6
+	.long	0x730
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1817
+	.byte	0x9
+	.byte	0x37
+	.byte	0x3
+	.long	0x6d2
+	.uleb128 0x4
+	.long	0x422
+	.uleb128 0x3
+	.long	.LASF1818
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x3
+	.long	0x4e9
+	.uleb128 0x9
+	.long	0x741
+	.uleb128 0x1f
+	.long	.LASF1819
+	.byte	0x4
+	.byte	0x2f
+	.byte	0x6
+	.long	0x76f
+	.uleb128 0x8
+	.long	0x173
+	.uleb128 0x8
+	.long	0x30
+	.uleb128 0x8
+	.long	0x115
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1820
+	.byte	0xdc
+	.byte	0x5
+	.long	0x19e
+	.long	0x795
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xdc
+	.byte	0x23
+	.long	0x795
+	.uleb128 0x19
+	.string	"ret"
+	.byte	0xde
+	.long	0x19e
+	.byte	0
+	.uleb128 0x4
+	.long	0x741
+	.uleb128 0xa
+	.long	.LASF1821
+	.byte	0xd7
+	.byte	0x9
+	.long	0xc8
+	.long	0x7b6
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xd7
+	.byte	0x30
+	.long	0x7b6
+	.byte	0
+	.uleb128 0x4
+	.long	0x74d
+	.uleb128 0xa
+	.long	.LASF1823
+	.byte	0xc6
+	.byte	0x5
+	.long	0x19e
+	.long	0x81e
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xc6
+	.byte	0x24
+	.long	0x795
+	.uleb128 0x5
+	.long	.LASF1824
+	.byte	0xb
+	.byte	0xc6
+	.byte	0x38
+	.long	0x81e
+	.uleb128 0x6
+	.long	.LASF1825
+	.byte	0xc8
+	.byte	0x19
+	.long	0x823
+	.uleb128 0x6
+	.long	.LASF1826
+	.byte	0xc9
+	.byte	0x9
+	.long	0x19e
+	.uleb128 0xb
+	.uleb128 0x6
+	.long	.LASF1827
+	.byte	0xcb
+	.byte	0x13
+	.long	0xc8
+	.uleb128 0x6
+	.long	.LASF1828
+	.byte	0xcb
+	.byte	0x67
+	.long	0xc8
+	.uleb128 0xb
+	.uleb128 0x6
+	.long	.LASF1814
+	.byte	0xcc
+	.byte	0x17
+	.long	0xd4
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x6c6
+	.uleb128 0x4
+	.long	0x730
+	.uleb128 0x13
+	.long	.LASF1829
+	.byte	0xbf
+	.long	0x857
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xbf
+	.byte	0x26
+	.long	0x795
+	.uleb128 0xb
+	.uleb128 0x6
+	.long	.LASF1827
+	.byte	0xc1
+	.byte	0x13
+	.long	0xc8
+	.uleb128 0x6
+	.long	.LASF1828
+	.byte	0xc1
+	.byte	0x67
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1830
+	.byte	0xb5
+	.long	0x886
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xb5
+	.byte	0x27
+	.long	0x795
+	.uleb128 0xb
+	.uleb128 0x6
+	.long	.LASF1827
+	.byte	0xb7
+	.byte	0x13
+	.long	0xc8
+	.uleb128 0x6
+	.long	.LASF1828
+	.byte	0xb7
+	.byte	0x67
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1831
+	.byte	0xa6
+	.byte	0x5
+	.long	0x19e
+	.long	0x8ae
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0xa6
+	.byte	0x32
+	.long	0x7b6
+	.uleb128 0x5
+	.long	.LASF1832
+	.byte	0xb
+	.byte	0xa6
+	.byte	0x3d
+	.long	0x19e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1833
+	.byte	0x72
+	.long	0x8c5
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0xb
+	.byte	0x72
+	.byte	0x21
+	.long	0x795
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1834
+	.byte	0x2c
+	.byte	0x23
+	.long	0x965
+	.long	0x965
+	.uleb128 0x5
+	.long	.LASF1835
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x3c
+	.long	0xc8
+	.uleb128 0x5
+	.long	.LASF1836
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x51
+	.long	0xde
+	.uleb128 0x5
+	.long	.LASF1837
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x82
+	.long	0x965
+	.uleb128 0x5
+	.long	.LASF1838
+	.byte	0xb
+	.byte	0x2c
+	.byte	0x8f
+	.long	0x7c
+	.uleb128 0x19
+	.string	"i"
+	.byte	0x2e
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF1839
+	.byte	0x2f
+	.byte	0xc
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1840
+	.byte	0x30
+	.byte	0x27
+	.long	0x965
+	.uleb128 0x14
+	.long	0x933
+	.uleb128 0x6
+	.long	.LASF1841
+	.byte	0x34
+	.byte	0x4c
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	0x944
+	.uleb128 0x6
+	.long	.LASF1842
+	.byte	0x34
+	.byte	0xd1
+	.long	0x7c
+	.byte	0
+	.uleb128 0x14
+	.long	0x955
+	.uleb128 0x6
+	.long	.LASF1843
+	.byte	0x3c
+	.byte	0x7a
+	.long	0x7c
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.long	.LASF1844
+	.byte	0xb
+	.byte	0x3c
+	.value	0x112
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	0x689
+	.uleb128 0x22
+	.long	.LASF1850
+	.byte	0xc
+	.byte	0x20
+	.byte	0x17
+	.long	0xc8
+	.long	0x987
+	.uleb128 0x5
+	.long	.LASF1845
+	.byte	0xc
+	.byte	0x20
+	.byte	0x35
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1846
+	.byte	0xc
+	.byte	0x1a
+	.long	0x99f
+	.uleb128 0x23
+	.string	"val"
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x31
+	.long	0x11a
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1851
+	.byte	0xd
+	.byte	0x83
+	.byte	0x18
+	.long	0xea
+	.uleb128 0x1a
+	.long	.LASF1847
+	.byte	0xd
+	.byte	0x82
+	.long	0x9c3
+	.uleb128 0x5
+	.long	.LASF1848
+	.byte	0xd
+	.byte	0x82
+	.byte	0x2f
+	.long	0xea
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1852
+	.byte	0xd
+	.byte	0x81
+	.byte	0x14
+	.uleb128 0x5
+	.long	.LASF1848
+	.byte	0xd
+	.byte	0x81
+	.byte	0x2b
+	.long	0xea
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 30 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF740
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF776
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 36 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF819
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.file 41 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF823
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF853
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF879
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF881
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF905
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF907
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x4
+	.file 64 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.file 66 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 67 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1088
+	.byte	0x4
+	.file 69 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1f
+	.byte	0x4
+	.file 70 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 71 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x47
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 72 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.file 73 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1203
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1204
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 75 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4c
+	.file 77 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1219
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x4
+	.file 78 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 79 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x4f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 80 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 81 "./src/main/drivers/nvic.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x8
+	.byte	0x4
+	.file 82 "./src/main/drivers/system.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x52
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1636
+	.byte	0x4
+	.file 83 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x53
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x9
+	.file 84 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF860
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF878
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1017
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1166
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1202
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1206
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1236
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.nvic.h.9.d6270fc6047e88c0b9bf5c6e1a266829,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1635
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1646
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1649
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1658
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1853
+	.long	.LASF1854
+	.long	.LASF1855
+	.long	.LASF1856
+	.long	.LASF1857
+	.long	.LASF1858
+	.long	.LASF1859
+	.long	.LASF1860
+	.long	.LASF1861
+	.long	.LASF1862
+	.long	.LASF1863
+	.long	.LASF1864
+	.long	.LASF1865
+	.long	.LASF1866
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x55
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1867
+	.byte	0xa
+	.long	.LASF1868
+	.byte	0xa
+	.long	.LASF1869
+	.byte	0xa
+	.long	.LASF1870
+	.byte	0x2
+	.long	.LASF1871
+	.byte	0x5
+	.long	.LASF1872
+	.byte	0x5
+	.long	.LASF1873
+	.byte	0x5
+	.long	.LASF1874
+	.byte	0x5
+	.long	.LASF1875
+	.byte	0x4
+	.long	.LASF1876
+	.byte	0x2
+	.long	.LASF1877
+	.byte	0x4
+	.long	.LASF1878
+	.byte	0x1
+	.long	.LASF1879
+	.byte	0x6
+	.long	.LASF1880
+	.byte	0xd
+	.long	.LASF1881
+	.byte	0xe
+	.long	.LASF1882
+	.byte	0xe
+	.long	.LASF1882
+	.byte	0xd
+	.long	.LASF1883
+	.byte	0xa
+	.long	.LASF1884
+	.byte	0xd
+	.long	.LASF1885
+	.byte	0xd
+	.long	.LASF1886
+	.byte	0xa
+	.long	.LASF1887
+	.byte	0xa
+	.long	.LASF1888
+	.byte	0xc
+	.long	.LASF1889
+	.byte	0xa
+	.long	.LASF1890
+	.byte	0xb
+	.long	.LASF1891
+	.byte	0xb
+	.long	.LASF1892
+	.byte	0xa
+	.long	.LASF1893
+	.byte	0xa
+	.long	.LASF1894
+	.byte	0xa
+	.long	.LASF1895
+	.byte	0xd
+	.long	.LASF1896
+	.byte	0xe
+	.long	.LASF1897
+	.byte	0xa
+	.long	.LASF1898
+	.byte	0xa
+	.long	.LASF1899
+	.byte	0xa
+	.long	.LASF1900
+	.byte	0xa
+	.long	.LASF1867
+	.byte	0xc
+	.long	.LASF1901
+	.byte	0x9
+	.long	.LASF1902
+	.byte	0x9
+	.long	.LASF1903
+	.byte	0x9
+	.long	.LASF1904
+	.byte	0x9
+	.long	.LASF1905
+	.byte	0xd
+	.long	.LASF1905
+	.byte	0xa
+	.long	.LASF1906
+	.byte	0xa
+	.long	.LASF1907
+	.byte	0xa
+	.long	.LASF1908
+	.byte	0xa
+	.long	.LASF1909
+	.byte	0xc
+	.long	.LASF1909
+	.byte	0xa
+	.long	.LASF1910
+	.byte	0x9
+	.long	.LASF1911
+	.byte	0x9
+	.long	.LASF1912
+	.byte	0x9
+	.long	.LASF1913
+	.byte	0x9
+	.long	.LASF1914
+	.byte	0xa
+	.long	.LASF1915
+	.byte	0xa
+	.long	.LASF1916
+	.byte	0xa
+	.long	.LASF1917
+	.byte	0xa
+	.long	.LASF1918
+	.byte	0xa
+	.long	.LASF1919
+	.byte	0xa
+	.long	.LASF1920
+	.byte	0xd
+	.long	.LASF1921
+	.byte	0xa
+	.long	.LASF1922
+	.byte	0xa
+	.long	.LASF1923
+	.byte	0xd
+	.long	.LASF1924
+	.byte	0x9
+	.long	.LASF1925
+	.byte	0x9
+	.long	.LASF1926
+	.byte	0xd
+	.long	.LASF1927
+	.byte	0x8
+	.long	.LASF1928
+	.byte	0x7
+	.long	.LASF1929
+	.byte	0x7
+	.long	.LASF1930
+	.byte	0x7
+	.long	.LASF1931
+	.byte	0x1
+	.long	.LASF1932
+	.byte	0x3
+	.long	.LASF1933
+	.byte	0x2
+	.long	.LASF1934
+	.byte	0x2
+	.long	.LASF1935
+	.byte	0x5
+	.long	.LASF1936
+	.byte	0x5
+	.long	.LASF1937
+	.byte	0x5
+	.long	.LASF1938
+	.byte	0x5
+	.long	.LASF1939
+	.byte	0x5
+	.long	.LASF1940
+	.byte	0x5
+	.long	.LASF1941
+	.byte	0x5
+	.long	.LASF1942
+	.byte	0x5
+	.long	.LASF1943
+	.byte	0x5
+	.long	.LASF1944
+	.byte	0x5
+	.long	.LASF1876
+	.byte	0x5
+	.long	.LASF1945
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1616:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1655:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF798:
+	.string	"__ldiv_t_defined 1"
+.LASF1770:
+	.string	"extiHandlerCallback"
+.LASF1047:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF938:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1446:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1139:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF914:
+	.string	"USE_RX_PPM "
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1025:
+	.string	"USE_BARO "
+.LASF968:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1278:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF728:
+	.string	"_WCHAR_T_DEFINED "
+.LASF988:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1797:
+	.string	"gyroAlign"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1821:
+	.string	"gyroSampleBufferCount"
+.LASF1372:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1169:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1032:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1390:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF825:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1636:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF989:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1519:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF920:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF813:
+	.string	"__pid_t_defined "
+.LASF824:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1100:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1258:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF969:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1665:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1520:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1697:
+	.string	"_Bool"
+.LASF1781:
+	.string	"sensorGyroInitFuncPtr"
+.LASF1033:
+	.string	"USE_UART8 "
+.LASF1465:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"U_ID_2 2"
+.LASF1208:
+	.string	"DMA_NONE (0)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1768:
+	.string	"extiCallbackRec_t"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1237:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1689:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF870:
+	.string	"NFDBITS __NFDBITS"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1750:
+	.string	"DEVHW_M25P16"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1117:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1205:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1241:
+	.string	"IOCFG_AF_OD 0"
+.LASF1163:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1777:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1749:
+	.string	"DEVHW_PCA9685"
+.LASF1309:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1259:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1147:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1845:
+	.string	"prio"
+.LASF1233:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1489:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1122:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1779:
+	.string	"CW270_DEG_FLIP"
+.LASF1248:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF720:
+	.string	"__WCHAR_T__ "
+.LASF740:
+	.string	"_STDLIB_H 1"
+.LASF1681:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF1612:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"USE_SERIAL_RX "
+.LASF1690:
+	.string	"LOG_TOPIC_VTX"
+.LASF1658:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF1226:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1451:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1641:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1584:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"samples"
+.LASF1158:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1530:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1051:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1676:
+	.string	"uint16_t"
+.LASF1312:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF836:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF1178:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1551:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1000:
+	.string	"USE_CLI_BATCH "
+.LASF1712:
+	.string	"DEVHW_MPU6000"
+.LASF1112:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1518:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF746:
+	.string	"WNOWAIT 0x01000000"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1007:
+	.string	"_T_PTRDIFF_ "
+.LASF910:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1543:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1286:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1494:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1036:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1088:
+	.string	"ATOMIC_BLOCK(prio) for ( uint8_t __basepri_save __attribute__((__cleanup__(__basepriRestoreMem))) = __get_BASEPRI(), __ToDo = __basepriSetMemRetVal((prio) << (8U - __NVIC_PRIO_BITS)); __ToDo ; __ToDo = 0 )"
+.LASF1398:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1828:
+	.string	"__ToDo"
+.LASF1215:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1197:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1037:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF810:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1142:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF719:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1271:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF793:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1476:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1539:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1611:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1625:
+	.string	"NVIC_PRIO_MAX 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF960:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1279:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1244:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1624:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1138:
+	.string	"BIT(x) (1 << (x))"
+.LASF1049:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF946:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1287:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1846:
+	.string	"__basepriRestoreMem"
+.LASF1438:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1632:
+	.string	"NVIC_PRIO_USB 5"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF853:
+	.string	"_SYS_SELECT_H 1"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF865:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1834:
+	.string	"chooseGyroConfig"
+.LASF1168:
+	.string	"FAST_MATH "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1763:
+	.string	"busDeviceDescriptor_s"
+.LASF1762:
+	.string	"busDeviceDescriptor_t"
+.LASF908:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1731:
+	.string	"DEVHW_IST8308"
+.LASF1597:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"__timeval_defined 1"
+.LASF1587:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1533:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1250:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1659:
+	.string	"unsigned char"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1041:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF838:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1060:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF777:
+	.string	"__HAVE_FLOAT16 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1683:
+	.string	"LOG_TOPIC_BARO"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1719:
+	.string	"DEVHW_BMP280"
+.LASF1133:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF995:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1080:
+	.string	"FAST_CODE "
+.LASF1357:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1756:
+	.string	"busType"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1478:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1429:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF848:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF956:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF840:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1350:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1693:
+	.string	"logTopic_e"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1743:
+	.string	"DEVHW_DS2482"
+.LASF1023:
+	.string	"USE_FAKE_GPS "
+.LASF1196:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF849:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF857:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1670:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1713:
+	.string	"DEVHW_MPU6050"
+.LASF957:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1819:
+	.string	"_logf"
+.LASF1513:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1318:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1623:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1795:
+	.string	"dataReady"
+.LASF757:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1257:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1114:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1526:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1576:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1792:
+	.string	"gyroZero"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1371:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1776:
+	.string	"CW0_DEG_FLIP"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF982:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1826:
+	.string	"popped"
+.LASF1457:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1651:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1495:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1735:
+	.string	"DEVHW_LM75_0"
+.LASF1736:
+	.string	"DEVHW_LM75_1"
+.LASF1737:
+	.string	"DEVHW_LM75_2"
+.LASF1738:
+	.string	"DEVHW_LM75_3"
+.LASF1739:
+	.string	"DEVHW_LM75_4"
+.LASF1740:
+	.string	"DEVHW_LM75_5"
+.LASF1741:
+	.string	"DEVHW_LM75_6"
+.LASF1742:
+	.string	"DEVHW_LM75_7"
+.LASF754:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1302:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1631:
+	.string	"NVIC_PRIO_GYRO_INT_EXTI 4"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF831:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF773:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1247:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1220:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1536:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1600:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF992:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1809:
+	.string	"timeUs"
+.LASF1103:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF932:
+	.string	"USE_PITOT "
+.LASF1141:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1193:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1639:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1219:
+	.string	"SPIDEV_COUNT 4"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1566:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1065:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF721:
+	.string	"_WCHAR_T "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1152:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF1277:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1362:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1311:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF828:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1280:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1662:
+	.string	"long unsigned int"
+.LASF903:
+	.string	"alloca"
+.LASF803:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1772:
+	.string	"CW0_DEG"
+.LASF1013:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1106:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1285:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1666:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1511:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1668:
+	.string	"__uint16_t"
+.LASF796:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF396:
+	.string	"false 0"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1700:
+	.string	"BUSTYPE_I2C"
+.LASF1802:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1253:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF731:
+	.string	"__INT_WCHAR_T_H "
+.LASF808:
+	.string	"__gid_t_defined "
+.LASF1775:
+	.string	"CW270_DEG"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1402:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1162:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF854:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF871:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1290:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1288:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1579:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF751:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF767:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1164:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1095:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1836:
+	.string	"desiredRateHz"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF792:
+	.string	"__f32x(x) x ##f32x"
+.LASF1724:
+	.string	"DEVHW_BMP388"
+.LASF1227:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF959:
+	.string	"USE_OLED_UG2864 "
+.LASF1405:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF976:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF999:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1127:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1444:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1410:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1192:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1796:
+	.string	"sampleRateIntervalUs"
+.LASF1790:
+	.string	"scale"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1183:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1206:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1104:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1014:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1181:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF809:
+	.string	"__mode_t_defined "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF929:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF926:
+	.string	"USE_NAV "
+.LASF1485:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1431:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1081:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1694:
+	.string	"float"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1079:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF730:
+	.string	"___int_wchar_t_h "
+.LASF1374:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1239:
+	.string	"IOCFG_OUT_OD 0"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1006:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1173:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF833:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1326:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1090:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF937:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF811:
+	.string	"__uid_t_defined "
+.LASF1771:
+	.string	"ALIGN_DEFAULT"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1648:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1535:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF851:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF900:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF924:
+	.string	"USE_GPS "
+.LASF1249:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1638:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF1561:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1435:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF919:
+	.string	"USE_SERIALRX_FPORT "
+.LASF756:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1120:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1392:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1066:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1419:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF818:
+	.string	"__clock_t_defined 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF727:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1397:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1223:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1582:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF864:
+	.string	"__NFDBITS"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1228:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1748:
+	.string	"DEVHW_MS4525"
+.LASF759:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1449:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1467:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1281:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1745:
+	.string	"DEVHW_SRF10"
+.LASF821:
+	.string	"__timer_t_defined 1"
+.LASF1815:
+	.string	"overflowCount"
+.LASF1064:
+	.string	"USE_ITCM_RAM"
+.LASF1333:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1481:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF729:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF859:
+	.string	"____sigset_t_defined "
+.LASF1018:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF823:
+	.string	"_ENDIAN_H 1"
+.LASF1602:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1531:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1175:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF983:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1688:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1057:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1823:
+	.string	"gyroSampleBufferPop"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1052:
+	.string	"USE_PITOT_ADC"
+.LASF1652:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF921:
+	.string	"USE_ADC_AVERAGING "
+.LASF1188:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1336:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1359:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1627:
+	.string	"NVIC_PRIO_I2C_EV 2"
+.LASF1832:
+	.string	"slaveMagEnabled"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF905:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF892:
+	.string	"__ONCE_ALIGNMENT "
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1367:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1099:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF750:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF949:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1593:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF822:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF845:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1149:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1363:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1848:
+	.string	"basePri"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1422:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1157:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF779:
+	.string	"__HAVE_FLOAT64 1"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1194:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF834:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1691:
+	.string	"LOG_TOPIC_OSD"
+.LASF1585:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1675:
+	.string	"uint8_t"
+.LASF1332:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1330:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF939:
+	.string	"USE_RX_UIB "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1176:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1716:
+	.string	"DEVHW_ICM20689"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF893:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1135:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1221:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1213:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1202:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1456:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1759:
+	.string	"param"
+.LASF1608:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"USE_ADC"
+.LASF807:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1766:
+	.string	"scratchpad"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF732:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1503:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1411:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF761:
+	.string	"__WCOREFLAG 0x80"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1078:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1524:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1764:
+	.string	"busDevice_s"
+.LASF1767:
+	.string	"busDevice_t"
+.LASF1437:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF697:
+	.string	"__need_size_t "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF944:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1005:
+	.string	"_ANSI_STDDEF_H "
+.LASF894:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1462:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF819:
+	.string	"__clockid_t_defined 1"
+.LASF735:
+	.string	"_BSD_WCHAR_T_"
+.LASF1733:
+	.string	"DEVHW_MAG3110"
+.LASF1348:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1746:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF775:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1151:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1850:
+	.string	"__basepriSetMemRetVal"
+.LASF1059:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1629:
+	.string	"NVIC_PRIO_TIMER_DMA 3"
+.LASF1251:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1107:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1695:
+	.string	"ioTag_t"
+.LASF1016:
+	.string	"__need_ptrdiff_t"
+.LASF837:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF945:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF970:
+	.string	"USE_LOG "
+.LASF1089:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1598:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1353:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1003:
+	.string	"_STDDEF_H "
+.LASF1788:
+	.string	"updateFn"
+.LASF1022:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1548:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1148:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1282:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1609:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1538:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1381:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1617:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"temperatureFn"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1121:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF764:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1111:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1297:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF934:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1706:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1231:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1320:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1708:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1791:
+	.string	"gyroADCRaw"
+.LASF776:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1366:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF826:
+	.string	"__BIG_ENDIAN 4321"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF933:
+	.string	"USE_PITOT_ADC "
+.LASF1344:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1534:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1699:
+	.string	"BUSTYPE_NONE"
+.LASF1480:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1515:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1849:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF774:
+	.string	"__f128(x) x ##f128"
+.LASF877:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1560:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF832:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1300:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1184:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1671:
+	.string	"__uint64_t"
+.LASF1575:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF878:
+	.string	"__fsfilcnt_t_defined "
+.LASF1155:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF1195:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF741:
+	.string	"WNOHANG 1"
+.LASF1656:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1426:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1432:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1255:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1502:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1563:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1793:
+	.string	"imuSensorToUse"
+.LASF1201:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1554:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1500:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1407:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1061:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF954:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1303:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1243:
+	.string	"IOCFG_IPU 0"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF743:
+	.string	"WSTOPPED 2"
+.LASF737:
+	.string	"NULL"
+.LASF1653:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF875:
+	.string	"__blksize_t_defined "
+.LASF901:
+	.string	"__have_pthread_attr_t 1"
+.LASF744:
+	.string	"WEXITED 4"
+.LASF990:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1109:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1468:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__PMT"
+.LASF733:
+	.string	"_WCHAR_T_DECLARED "
+.LASF948:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1541:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF935:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF891:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF753:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1709:
+	.string	"DEVHW_L3GD20"
+.LASF868:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1794:
+	.string	"requestedSampleIntervalUs"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1484:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1113:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1417:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF772:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1328:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF996:
+	.string	"USE_VTX_TRAMP "
+.LASF812:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1329:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF844:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1558:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1299:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1129:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1401:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF931:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1093:
+	.string	"UNIT_TESTED "
+.LASF1053:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1654:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1483:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF725:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1262:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1073:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF476:
+	.string	"__P(args) args"
+.LASF788:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1642:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1108:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1578:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1295:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1283:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1261:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1572:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1829:
+	.string	"gyroSampleBufferStop"
+.LASF1789:
+	.string	"exti"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1570:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"int8_t"
+.LASF1393:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1345:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF863:
+	.string	"__suseconds_t_defined "
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF880:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF872:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1276:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1545:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF855:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF739:
+	.string	"__need_NULL"
+.LASF1017:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1293:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1166:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF950:
+	.string	"USE_PITOT_MS4525 "
+.LASF1633:
+	.string	"NVIC_PRIO_SERIALUART 5"
+.LASF1647:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1056:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1544:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1274:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1685:
+	.string	"LOG_TOPIC_PWM"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1229:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1711:
+	.string	"DEVHW_MPU3050"
+.LASF1335:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF942:
+	.string	"USE_RANGEFINDER "
+.LASF1191:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1703:
+	.string	"busType_e"
+.LASF1680:
+	.string	"long long unsigned int"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1124:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1235:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1822:
+	.string	"gyro"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1643:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF906:
+	.string	"_STRING_H 1"
+.LASF1517:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1603:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF972:
+	.string	"USE_CMS "
+.LASF1674:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1082:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1660:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1753:
+	.string	"DEVHW_IRLOCK"
+.LASF1754:
+	.string	"devHardwareType_e"
+.LASF1663:
+	.string	"signed char"
+.LASF789:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF977:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1156:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1222:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1314:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1171:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1486:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1785:
+	.string	"readFn"
+.LASF820:
+	.string	"__time_t_defined 1"
+.LASF847:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF839:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1167:
+	.string	"sq(x) ((x)*(x))"
+.LASF1474:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1838:
+	.string	"count"
+.LASF943:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1509:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1428:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1714:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF791:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF1327:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1527:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1044:
+	.string	"USE_DASHBOARD"
+.LASF997:
+	.string	"USE_VTX_FFPV "
+.LASF1207:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF749:
+	.string	"__WCLONE 0x80000000"
+.LASF1265:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF874:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1830:
+	.string	"gyroSampleBufferStart"
+.LASF765:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF780:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF967:
+	.string	"USE_ANTIGRAVITY "
+.LASF1506:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1452:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1212:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1102:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1084:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF913:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1487:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1351:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1308:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1567:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1203:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1784:
+	.string	"initFn"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1182:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1019:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1640:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1269:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1306:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF918:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1343:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1434:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1460:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1284:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1144:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1413:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1727:
+	.string	"DEVHW_AK8963"
+.LASF842:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1799:
+	.string	"sensorGyroReadFuncPtr"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1470:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1216:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1055:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1275:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1443:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1473:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1729:
+	.string	"DEVHW_IST8310_0"
+.LASF1730:
+	.string	"DEVHW_IST8310_1"
+.LASF1105:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1317:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1256:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF974:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1549:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1645:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1728:
+	.string	"DEVHW_AK8975"
+.LASF1378:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1441:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1704:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1628:
+	.string	"NVIC_PRIO_TIMER 3"
+.LASF1267:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1214:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF978:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1396:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1323:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1062:
+	.string	"USE_RCDEVICE"
+.LASF1590:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1010:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1137:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1009:
+	.string	"__PTRDIFF_T "
+.LASF856:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF862:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF802:
+	.string	"EXIT_SUCCESS 0"
+.LASF1423:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1209:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1455:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1550:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1134:
+	.string	"EXPAND_I(x) x"
+.LASF1399:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1490:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF896:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1356:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1677:
+	.string	"uint32_t"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1466:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1273:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF794:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1464:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1722:
+	.string	"DEVHW_LPS25H"
+.LASF1200:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1644:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1463:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1573:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF795:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF866:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1800:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF734:
+	.string	"__DEFINED_wchar_t "
+.LASF1626:
+	.string	"NVIC_PRIO_I2C_ER 2"
+.LASF489:
+	.string	"__flexarr []"
+.LASF797:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1130:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1765:
+	.string	"descriptorPtr"
+.LASF1002:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1094:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF860:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1119:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF722:
+	.string	"_T_WCHAR_ "
+.LASF1769:
+	.string	"extiCallbackRec_s"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF973:
+	.string	"CMS_MENU_OSD "
+.LASF1339:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1085:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF800:
+	.string	"RAND_MAX 2147483647"
+.LASF1414:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1101:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1522:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1701:
+	.string	"BUSTYPE_SPI"
+.LASF1552:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1498:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1557:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF994:
+	.string	"USE_VTX_CONTROL "
+.LASF1586:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1807:
+	.string	"gyroFilterAndRateConfig_t"
+.LASF1672:
+	.string	"char"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1687:
+	.string	"LOG_TOPIC_IMU"
+.LASF1787:
+	.string	"intStatusFn"
+.LASF1395:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF745:
+	.string	"WCONTINUED 8"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1816:
+	.string	"enabled"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1479:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1751:
+	.string	"DEVHW_UG2864"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1240:
+	.string	"IOCFG_AF_PP 0"
+.LASF1702:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1696:
+	.string	"IO_t"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF742:
+	.string	"WUNTRACED 2"
+.LASF1027:
+	.string	"USE_UART2 "
+.LASF850:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1291:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1116:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF980:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1553:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1098:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1833:
+	.string	"gyroIntExtiInit"
+.LASF1190:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF984:
+	.string	"USE_RX_MSP "
+.LASF1458:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1126:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1198:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1493:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1783:
+	.string	"busDev"
+.LASF991:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1782:
+	.string	"gyroDev_s"
+.LASF1818:
+	.string	"gyroDev_t"
+.LASF1615:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1186:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1678:
+	.string	"uint64_t"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1217:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF1657:
+	.string	"GYRO_LPF_NONE 7"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF778:
+	.string	"__HAVE_FLOAT32 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF1649:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF947:
+	.string	"USE_OPFLOW "
+.LASF1020:
+	.string	"USE_IMU_FAKE "
+.LASF1734:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF738:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1778:
+	.string	"CW180_DEG_FLIP"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1132:
+	.string	"STR_HELPER(x) #x"
+.LASF899:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1831:
+	.string	"gyroSampleBufferIsSupported"
+.LASF917:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1360:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1091:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1521:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"USE_USB_MSC"
+.LASF1021:
+	.string	"USE_FAKE_BARO "
+.LASF858:
+	.string	"__sigset_t_defined 1"
+.LASF1637:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1420:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1338:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1376:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1459:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF736:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1008:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1165:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF925:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1825:
+	.string	"buffer"
+.LASF371:
+	.string	"__linux 1"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1447:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF979:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF814:
+	.string	"__id_t_defined "
+.LASF1852:
+	.string	"__set_BASEPRI"
+.LASF936:
+	.string	"USE_GYRO_KALMAN "
+.LASF1380:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1461:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF758:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1773:
+	.string	"CW90_DEG"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1177:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1596:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"sensor_align_e"
+.LASF1542:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1710:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1529:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1618:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF748:
+	.string	"__WALL 0x40000000"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1160:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF829:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1496:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF843:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1210:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1324:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1827:
+	.string	"__basepri_save"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1835:
+	.string	"desiredLpf"
+.LASF760:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF930:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1820:
+	.string	"gyroCheckDataReady"
+.LASF1814:
+	.string	"tail"
+.LASF1635:
+	.string	"NVIC_PRIORITY_GROUPING NVIC_PriorityGroup_4"
+.LASF1469:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1512:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF804:
+	.string	"_SYS_TYPES_H 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1368:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF846:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF827:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1841:
+	.string	"_abs0"
+.LASF1842:
+	.string	"_abs1"
+.LASF1843:
+	.string	"_abs2"
+.LASF1844:
+	.string	"_abs3"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1806:
+	.string	"gyroConfigValues"
+.LASF1143:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1296:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF830:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1546:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1389:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF726:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1377:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF912:
+	.string	"I2C2_OVERCLOCK false"
+.LASF799:
+	.string	"__lldiv_t_defined 1"
+.LASF1252:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1077:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1614:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1564:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1839:
+	.string	"selectedLpf"
+.LASF1416:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1669:
+	.string	"__uint32_t"
+.LASF1634:
+	.string	"NVIC_PRIO_SONAR_EXTI 7"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF755:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1715:
+	.string	"DEVHW_BMI160"
+.LASF1525:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1761:
+	.string	"irqPin"
+.LASF1717:
+	.string	"DEVHW_MPU9250"
+.LASF1508:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1234:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1760:
+	.string	"busdev"
+.LASF1315:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1813:
+	.string	"head"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1266:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1605:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1242:
+	.string	"IOCFG_IPD 0"
+.LASF1591:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1504:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1450:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1125:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF958:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF876:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF747:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF723:
+	.string	"_T_WCHAR "
+.LASF1136:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1516:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1154:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1383:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1004:
+	.string	"_STDDEF_H_ "
+.LASF1254:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1272:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1621:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1755:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1375:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1491:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1840:
+	.string	"candidate"
+.LASF1499:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF971:
+	.string	"USE_STATS "
+.LASF1024:
+	.string	"USE_MAG "
+.LASF1620:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1408:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1684:
+	.string	"LOG_TOPIC_PITOT"
+.LASF835:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1510:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1159:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1646:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1294:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1472:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF790:
+	.string	"__f32(x) x ##f32"
+.LASF1011:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF724:
+	.string	"__WCHAR_T "
+.LASF1482:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1043:
+	.string	"USE_SERVO_SBUS"
+.LASF805:
+	.string	"__u_char_defined "
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1230:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF867:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1686:
+	.string	"LOG_TOPIC_TIMER"
+.LASF698:
+	.string	"__need_wchar_t "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1140:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1803:
+	.string	"timeUs_t"
+.LASF1068:
+	.string	"U_ID_1 1"
+.LASF1067:
+	.string	"U_ID_0 0"
+.LASF806:
+	.string	"__ino_t_defined "
+.LASF1798:
+	.string	"sampleBuffer"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1721:
+	.string	"DEVHW_MS5607"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1245:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1492:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF770:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1569:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1707:
+	.string	"DEVHW_MMA8452"
+.LASF911:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1824:
+	.string	"sample"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1211:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF998:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1507:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1145:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF941:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF769:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1588:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"USE_D_BOOST "
+.LASF1720:
+	.string	"DEVHW_MS5611"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1747:
+	.string	"DEVHW_VL53L0X"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1547:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1045:
+	.string	"USE_OLED_UG2864"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1096:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1001:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1083:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1038:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1851:
+	.string	"__get_BASEPRI"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1146:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF985:
+	.string	"USE_SERIALRX_SUMD "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1453:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1682:
+	.string	"LOG_TOPIC_GYRO"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1752:
+	.string	"DEVHW_SDCARD"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF768:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF909:
+	.string	"_STRINGS_H 1"
+.LASF1732:
+	.string	"DEVHW_QMC5883"
+.LASF815:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1225:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF951:
+	.string	"USE_1WIRE "
+.LASF1316:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF873:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1305:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1757:
+	.string	"devHwType"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1606:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1808:
+	.string	"gyroSample_s"
+.LASF1810:
+	.string	"gyroSample_t"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1054:
+	.string	"USE_1WIRE_DS2482"
+.LASF1131:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1475:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1039:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1692:
+	.string	"LOG_TOPIC_COUNT"
+.LASF904:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1199:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1599:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1012:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1150:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF923:
+	.string	"USE_BLACKBOX "
+.LASF1180:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1471:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1263:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF841:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1705:
+	.string	"DEVHW_BMA280"
+.LASF927:
+	.string	"USE_TELEMETRY "
+.LASF1347:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1723:
+	.string	"DEVHW_SPL06"
+.LASF817:
+	.string	"__key_t_defined "
+.LASF1679:
+	.string	"long long int"
+.LASF1698:
+	.string	"BUSTYPE_ANY"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1238:
+	.string	"IOCFG_OUT_PP 0"
+.LASF801:
+	.string	"EXIT_FAILURE 1"
+.LASF955:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF762:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1040:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1185:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1063:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF963:
+	.string	"USE_DJI_HD_OSD "
+.LASF1532:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1514:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1725:
+	.string	"DEVHW_DPS310"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1270:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1268:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF902:
+	.string	"_ALLOCA_H 1"
+.LASF964:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF895:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1026:
+	.string	"USE_UART1 "
+.LASF752:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1174:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1477:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1386:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF962:
+	.string	"USE_FRSKYOSD "
+.LASF1342:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1048:
+	.string	"USE_RANGEFINDER"
+.LASF1505:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1074:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1488:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1369:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1034:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1232:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF898:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF986:
+	.string	"USE_SERIALRX_SUMH "
+.LASF763:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF916:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1246:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF953:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1123:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1805:
+	.string	"gyroRateHz"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1622:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1497:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1804:
+	.string	"gyroLpf"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1718:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1189:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1028:
+	.string	"USE_UART3 "
+.LASF1179:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1087:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1664:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1264:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1128:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1110:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF993:
+	.string	"USE_RCDEVICE "
+.LASF1187:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1321:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1801:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1726:
+	.string	"DEVHW_HMC5883"
+.LASF1050:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1172:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1630:
+	.string	"NVIC_PRIO_SDIO 3"
+.LASF1661:
+	.string	"unsigned int"
+.LASF1029:
+	.string	"USE_UART4 "
+.LASF852:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF987:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1425:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1528:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1224:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1035:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1555:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1341:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF981:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1118:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1667:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF940:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1218:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1594:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1030:
+	.string	"USE_UART5 "
+.LASF1540:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"gyroSampleBuffer_s"
+.LASF1817:
+	.string	"gyroSampleBuffer_t"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF869:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF961:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1161:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF1046:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1097:
+	.string	"EXTENDED_FASTRAM "
+.LASF1153:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1774:
+	.string	"CW180_DEG"
+.LASF1837:
+	.string	"configs"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1260:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1076:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1581:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1015:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1115:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF766:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1744:
+	.string	"DEVHW_MAX7456"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1758:
+	.string	"flags"
+.LASF1847:
+	.string	"__set_BASEPRI_MAX"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1031:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1387:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1911:
+	.string	"__sigset_t.h"
+.LASF1871:
+	.string	"io_types.h"
+.LASF1930:
+	.string	"common_post.h"
+.LASF1889:
+	.string	"long-double.h"
+.LASF1925:
+	.string	"__locale_t.h"
+.LASF1920:
+	.string	"alloca.h"
+.LASF1923:
+	.string	"string.h"
+.LASF1918:
+	.string	"struct_mutex.h"
+.LASF1879:
+	.string	"target.h"
+.LASF1915:
+	.string	"thread-shared-types.h"
+.LASF1883:
+	.string	"libc-header-start.h"
+.LASF1881:
+	.string	"stdbool.h"
+.LASF1864:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1905:
+	.string	"endian.h"
+.LASF1939:
+	.string	"dma.h"
+.LASF1868:
+	.string	"stdint-intn.h"
+.LASF1877:
+	.string	"accgyro.c"
+.LASF1945:
+	.string	"axis.h"
+.LASF1863:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1866:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1890:
+	.string	"stubs.h"
+.LASF1875:
+	.string	"accgyro.h"
+.LASF1940:
+	.string	"io.h"
+.LASF1858:
+	.string	"src/main/target/SITL"
+.LASF1917:
+	.string	"atomic_wide_counter.h"
+.LASF1901:
+	.string	"clock_t.h"
+.LASF1887:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1934:
+	.string	"maths.h"
+.LASF1862:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1935:
+	.string	"resource.h"
+.LASF1936:
+	.string	"bus_i2c.h"
+.LASF1895:
+	.string	"stdlib.h"
+.LASF1926:
+	.string	"strings.h"
+.LASF1885:
+	.string	"features-time64.h"
+.LASF1916:
+	.string	"pthreadtypes-arch.h"
+.LASF1867:
+	.string	"types.h"
+.LASF1900:
+	.string	"floatn-common.h"
+.LASF1944:
+	.string	"system.h"
+.LASF1899:
+	.string	"floatn.h"
+.LASF1857:
+	.string	"src/main/drivers"
+.LASF1865:
+	.string	"/usr/include"
+.LASF1913:
+	.string	"struct_timespec.h"
+.LASF1873:
+	.string	"exti.h"
+.LASF1853:
+	.string	"src/main/build"
+.LASF1910:
+	.string	"sigset_t.h"
+.LASF1937:
+	.string	"rcc_types.h"
+.LASF1884:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/drivers/accgyro/accgyro.c"
+.LASF1892:
+	.string	"typesizes.h"
+.LASF1914:
+	.string	"pthreadtypes.h"
+.LASF1854:
+	.string	"src/main/common"
+.LASF1902:
+	.string	"clockid_t.h"
+.LASF1855:
+	.string	"src/main/config"
+.LASF1893:
+	.string	"time64.h"
+.LASF1869:
+	.string	"stdint-uintn.h"
+.LASF1907:
+	.string	"byteswap.h"
+.LASF1859:
+	.string	"src/main/target"
+.LASF1933:
+	.string	"utils.h"
+.LASF1904:
+	.string	"timer_t.h"
+.LASF1872:
+	.string	"bus.h"
+.LASF1870:
+	.string	"log.h"
+.LASF1903:
+	.string	"time_t.h"
+.LASF1897:
+	.string	"waitflags.h"
+.LASF1943:
+	.string	"nvic.h"
+.LASF1898:
+	.string	"waitstatus.h"
+.LASF1860:
+	.string	"src/main"
+.LASF1876:
+	.string	"time.h"
+.LASF1874:
+	.string	"sensor.h"
+.LASF1894:
+	.string	"wchar.h"
+.LASF1941:
+	.string	"io_def.h"
+.LASF1928:
+	.string	"common.h"
+.LASF1921:
+	.string	"stdlib-bsearch.h"
+.LASF1878:
+	.string	"atomic.h"
+.LASF1861:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1919:
+	.string	"struct_rwlock.h"
+.LASF1856:
+	.string	"src/main/drivers/accgyro"
+.LASF1929:
+	.string	"sanity_check.h"
+.LASF1888:
+	.string	"cdefs.h"
+.LASF1909:
+	.string	"select.h"
+.LASF1938:
+	.string	"bus_spi.h"
+.LASF1882:
+	.string	"stdint.h"
+.LASF1931:
+	.string	"build_config.h"
+.LASF1896:
+	.string	"stddef.h"
+.LASF1891:
+	.string	"stubs-64.h"
+.LASF1927:
+	.string	"platform.h"
+.LASF1924:
+	.string	"locale_t.h"
+.LASF1886:
+	.string	"wordsize.h"
+.LASF1908:
+	.string	"uintn-identity.h"
+.LASF1942:
+	.string	"io_def_generated.h"
+.LASF1912:
+	.string	"struct_timeval.h"
+.LASF1932:
+	.string	"parameter_group.h"
+.LASF1906:
+	.string	"endianness.h"
+.LASF1880:
+	.string	"stdc-predef.h"
+.LASF1922:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \242\355\003"
+	.string	"\024\006\226"
+	.string	"\b"
+	.string	"\211\225\267\240\r\022\002"
+	.string	"\002\001\002"
+	.string	""
+	.string	"\002\001\001\263\373\315\215\002"
+	.string	"\002\361\262\201\203\f"
+	.string	"\003\237\241\201\217\f\b\002"
+	.string	"\002\003\004\002\003\002\005\002\003\004\214\271\244\333\002\002\005\362\360\266\275\007\n\002"
+	.string	"\002\006\007\002\007\002\b\006\226\242\352\214\003\004\002"
+	.string	"\002\t\007\330\334\352\305\002\004\002\005\002\003"
+	.string	"\013"
+	.string	"X\205\331\005\3772zw\236\213)v\3553\027"
+	.ascii	"w\300\261\235\246\033h\003"
+	.text
+	.section	.gnu.lto_.ipa_sra.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \\\355\001"
+	.string	"\204\002P"
+	.string	"\b"
+	.string	"\004"
+	.string	"\003"
+	.string	"\001\001\001"
+	.string	""
+	.string	""
+	.string	"\005\001\002\002"
+	.string	""
+	.string	""
+	.string	"\001\003\003"
+	.string	"\001\004\005\002\003\006\003\007\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\b"
+	.string	"@\020D"
+	.ascii	"\001\253\314\250\031E%H\240\223\r`\001"
+	.text
+	.section	.gnu.lto_.inline.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"]\006"
+	.string	"\242\n!)\200\265I\007b"
+	.string	"\272\265\022\215\021!\204]\250\222\271x\212\232\0302\277\337\304\300\231@\201$\230\203\317\206\326\337\326>\331r\247\027+Vla\336\245\242dvI\224\363P3\t"
+	.string	"\201\241\217\216\n\\\022\365<\370\007\372\350\362\366C\3157(\227\363\307{\017\362}t9.&O\370\017\3157F\364v\273\f\274\327\365\275\367\224\217Z`M\225\242\375O1\377B\321)\342\347M\261m\2142\300\232\252\3043c$\036"
+	.string	"\200`\2201(\004\227AY\020\n\001{\003\027\037%~5s[o\270\031*<\247\263g\214\325\234\025P"
+	.ascii	"\303\300\232\243\034v\202\273\342KL]CG\202\205\300+\304\300\205"
+	.ascii	"/\225\347r/\242\354(\200\033"
+	.text
+	.section	.gnu.lto_.jmpfuncs.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`!"
+	.string	"\255\005"
+	.string	"2\312#+\200K\322\0013\260LLC\006f\200S\262+!\006\007\233UZ\035X\220\016\0300\212\3549\372\215\224\020\261\333@\b\331m\313\224R\205\232\306\244\206\f\3244&5\304\260\250\270\300\005\b\003\002B\360\301\220y0\314@\347\301\001\342i\300'B\302Ih\262\274g\257\344y\317\001\373\016u\317\263\217\340]\376\263\353\233\352\311MG\313\216\326]\351*\322\tE\303\006w\347\203\365\326*\342\332\024\353\005\002O?\001\236\001OO\266\255\252T\241\355F\016"
+	.ascii	"\307,#\317aU\206\256\316\r\214\225}\226!&\3070\r\231\223\026"
+	.ascii	"\315+\320\356L1\330\2057\200\""
+	.text
+	.section	.gnu.lto_.pureconst.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\231\004\001\200\004\002\200\004\003\232\004\004\232\004\005"
+	.ascii	"\232\004\006\232\004\007\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`$"
+	.string	"\345\004"
+	.string	"r\007\027\036\260%\351"
+	.string	"\311\204\001\"\013\320\004D\227\004h\222J\241x\263\3046\366Zv\333\2154)S\227\231\221\214\206G\375\311I\260j\263+pT\222\375\022\3233\203\236]\232\351\250!\324(\236Z\226\273\232!\204\240\212\202\fH\317P\232\363\213\003e\035X\264-\t(\377#\201\374\331f\022\031"
+	.ascii	"4\236\n\277\200\214\306)#\202'\257\3645\024\225\3235\005w\021"
+	.ascii	"d\306y\032\\\214;\026f(U$\230\0327\bLz6\034\224hp\245K[@\220"
+	.ascii	"\2272\204\"\003\317\241\n0\004"
+	.text
+	.section	.gnu.lto_.lto.45d6aa66528eedb5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_chooseGyroConfig.31.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`^\n\3658"
+	.string	":d\320\025?@\336J:\033`\223\374\314]\367B\216\033\031H8\265\t\340\356\362@\260\b6R\353a\003E\3650m\225\346\301\0164%(\001j\351\200\032wS\036L\377\260\237\026\214\351C\032!$m)\003T\0010\001E\001\367\271\304\317\260\306\236\031\267!7\"3\223\226\034\262\342\032\003\307\032\346\212\344\335\332)\312,\307]\246\007\273\220\231IO3fBVD\357\030\bS\036[\006\r3fA\025\350\375\301\340\212\232:\367^\027k\247I>\314\230\003\347\034\324\315\240P$\262\316\275\200X\235\262\033\022\2370-F\256\307\260\"zt\237|F\f\357\275Z\274\266v\332D%\315\330\366\227\271\246\243\373\004\203w\266v\212\264\246\001\233\213\\waa\217\356\263\316o\303\332\351\221EJ4\273e\376\n\223\353?\030\374{\213"
+	.ascii	"2\274\027P\213\301\326N;Kk\221\343\271&\300\276\034\335#\315"
+	.ascii	"\035\030>\367\002r1`/\251\235\256\255\244v\372%\225\225C\274"
+	.ascii	"\254\254\254\244l\024\260Y\375\\\023\r1\205\202\326\245\232\242"
+	.ascii	"\267s\334c?\366\340\351\305h\242\206\304A\344\207\035R\222cH"
+	.ascii	"3\205X\241\246\023\322A\350U\2214;\032\022\007\020t\211\r\022"
+	.ascii	"\311.l\250)8\202\330\025j/\307\220^\242K\0317\236\024\351\335"
+	.ascii	"\241c~\352 \346\351\325YUHJ\217Ny4Z\244'\003m\336{\231zO\373"
+	.ascii	".lkF\r\236^\217\266K\007\367^\266xz9\232\213\232\271\t0\363\031"
+	.ascii	"\346\240\021\001?\372\266\233Rg+\031\352\177\201\301\255\333"
+	.ascii	";\201\271\243D\354To\317\211\346b\026e\350\235\263\310\026\257"
+	.ascii	"n\344\b\335!\326[\260\233t\366\017\367\261\336n\356(\231\327"
+	.ascii	"\372\221\215\252\357\336\247\030\267\343\034\2236\251\310&sj"
+	.ascii	"\247}*\277?:[\311\375\267\264\005\362\332?\314\2001\354\371\230"
+	.ascii	"{\254\317O\035~\022\3462\262[\036\353\304f\005\267,\326\207\315"
+	.ascii	"a`\267\234\240\031\233\277n\331\253\027\233\273\372\257{\253"
+	.ascii	"\273tk\365\230\356,\254\376\322}eUE5%u \252\t\233\241n\271y\313"
+	.ascii	"O\267l@\265\\\340\226\235V\313\004ny\200jY\300-7\251\226\003"
+	.ascii	"\3342\323jy\t@\0076+\265`s\322-#\255\226\217n\331\350\226\213"
+	.ascii	"n\231H\265<\304\226\231K\313BK\313A\267\274\336\362R\265\254"
+	.ascii	"\262\345ti\031]Z\376-[\325r/\360\322\263D\347\336\033\225\200"
+	.ascii	"\356\232\024\021J3v/v'v\037v\007v\013v\023\366\222\271\223\024"
+	.ascii	"\033\231\231d\206\321\217\t\220/g\230\231DfQ\f\036@utPQdf\322"
+	.ascii	"\225DVl>\217\002oF\246\033\375\353\025\226\316\364F\r\325\023"
+	.ascii	"\211\346\351[:\252\007\316_cg\320\363:W\036\246\225\256\367\""
+	.ascii	"\322\215\336\365'\305\243#9\333\215\332:\367\244m=\272}\364\373"
+	.ascii	"\323\272\321\257\316t\004){\267\203\354\371\021)\324\326\217"
+	.ascii	"\220+\216AO\302E'\372\233\0278I/::8t\242w\0336'\023mLCw\022\372"
+	.ascii	"\325\231\255\246\203.\024\365\240\333I7}V\225\352J\317cU\352"
+	.ascii	"I\275D\323\251\r\2236\354\325\251\236\307hz\340\313<J\213u\251"
+	.ascii	"\347-\031\323\262?\320\346\361\241\376\300\t\324\233P\212\252"
+	.ascii	"\321{\357U\317gar\016\232R}\352y]\330\030\234<\242dg\364R?\360"
+	.ascii	"<\346\2627aVC\275\354mW\244\256\260\203\362,\036\260\366\017"
+	.ascii	"O\335\001\235\375c\323\364\035\330#T8\222\251'\373\007\357(U"
+	.ascii	"4v\033"
+	.string	"9]\306\240\347\343\261\213\275\013{\275\343%\315\323\372a\005\037;\0050F\215{\n\336\211W\360\262A\273(R_\317`R\261-`\021;\002E;>K5{a\357\303n.o\037v\001n\354\242|\371f\303\326s\342\332ZR}\317\361\373C\177\365\364mWEmnT\003\354\341\253k\252EW3\313\303W\327T\213\256&\234\232\363\255\271@\256\201VS\256\2316\325\314J\233j\302hJ\240\020\001C\206\007\315\f\032>H K\360\345\325\005G\342lD\272\326qh\316\023N8\2463\356,m-\r\305\031ZP\034\n\025nh)\234\332Z\t\024nh\313\027\023\234qg\032\210\370L,l\254\213\214\204sK\251D\212\013i\316\26758g\232\020\243m\271\275\271PCC;\343\202{s\256X{K\343B\261v\326\306\205\366\006\307\2655\305n)\234o\\qnno\\L\300\333\350\220\325\001"
+	.ascii	"8\331\021\272\327\261\rC\004\362\332\246\017\270\323\r\374\311"
+	.ascii	"\260\365tx\352\273\327\256\361>\254vm\244\252\323\267\225\332"
+	.ascii	"\035Be\0261\3026\036\243w\310c\360\326\233\357;\312\247\0027"
+	.ascii	"p-;l\005\336\225~\177\004\356t-:j+\201[E\277?\001\0370\311f\003"
+	.ascii	"IZI\001\267\201\002\274\351Z\254\325q\330\356\030y\357s\214\371"
+	.ascii	"\254\341\240\255\367>\305\0349"
+	.string	"\264]0\300\357\b\007\221\316V\n\205\321A\304\254:\243K\245[1\301\376\300%VGE9\211z\023Z\r\321y\024b\236\321 \253W\201E\035l\017d\025s\007vo\371\263\206y\276\004\367b*\361\362\370\365\004\007\301\344\343+\200\327\250Q,\306\234cdfDDD\222\264\205\003\200\002\231\251#z\021P\265d\3166i3\207M\351\261ln\342\372E\022\224-\376\241\377E\332zv\220\200\315%\246\270\240C\234\264g\367&\304\3244A\205\223\fY\267\023\354\265\241\267\366\2373\032\231\333x\022\366\376\373\260p\355E\204'U\020\326\203S(\235\214o\314\207n\237\214\361\257\354\235\267\212m3 \252~\370\221\005\202\016\020\333\357!\260h\214\201\252\350O\177l\n?\031\206#\323\223}\023m.e\376\233&\221\247#/\224\022hN\366\216\314\354\261\301\276]\211\017K\307\355\003U\212\275B\343i\253\377"
+	.ascii	"B\035\2105\024\301K\215\261\250\302\321X\333.\354\254\245\210"
+	.ascii	"/L\276Ff\356\315\336\035.\203\034\230\271_W\247@\205=\035\240"
+	.ascii	"\312k\257\267\376q\306Z\036\263 \022\251c\202\217+gK\200\006"
+	.ascii	"\215\034\t\t\340@\007m\345\261G\200\255G\347\255s:\231\005B\204"
+	.ascii	"\032\324L\016\274O8)X&M\211\324+\021\3355\024\240\020\224\243"
+	.ascii	"\255\203\263\336\305Jd1\312\2274\335\3452c@s=\365~\276f\001("
+	.ascii	"e-\005'\327\217\311x\004<s\301t5\307\352\253'r\302\206\273j\020"
+	.ascii	"ZH\224\311\202r\207\b\242\301\246I\335\214\020z\245!,\004o\227"
+	.ascii	"\233\360\311\322>Ln\344\214u5\230?\227\013\035wJ\230\264q\006"
+	.ascii	"JD\306\036\243\372\215H\344\215\177:\237kK\365\"\013\004\270"
+	.ascii	"D\240\260\002\214\221B\372\273Q\026j)\213Ry\257\351x\346\017"
+	.text
+	.section	.gnu.lto_gyroIntExtiInit.32.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"u\007"
+	.string	"B\01645`o\032\0030\265\304.\316\t \354\007\211\365\037\341\246\210\016E\210J\"\177\226\367\250\373\266~v\366\224\213\2273 \377\216U\363rn\332J\274\007\331[\312\224\002\305\024\022\026\016<\017\332\325\251\232]\233\274\210\3102,\206\244f\001\222\020q\002\204I\304L\206\342U\320\215B\223\261b\333d\334L\221a\327\217\b\216\352\021;\230\246K\313\337K;G\017z\264\256\376\277\260k}\262\037l@\245X\006R~\216\030\230\243,\024\220\266\336\264\234\020\217_k\021\2338\2370\314\371;\223\223\177\032\024Ac\253\323\002\031[\032w2\266\312\265+\236\0377\211\212FI\352\177\204%s~\\\035@\312\360\003\370\374\357\333 u\270\320m\t\3322\264-\005\n"
+	.ascii	"3K\200@\276Bof\300F\315\210\273L.\243|\253\321\340.\337\266\344"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_gyroSampleBufferIsSupported.33.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\\"
+	.string	"\225\t"
+	.string	"6\321B; \261\322\001\360\302p\031vy1CwGN|\214U\321!O\224\200\2160Q\372\2030CY\2649\240T\023\001\331\022\b\241\025\002\364\306\236\367i\003Q\270P\020f\017\t\332[\2460"
+	.string	"1"
+	.string	"2"
+	.string	"\377\202\250\365\221/\310\213e*\032'\267\356K\347\007\217,\3073\233p\201\210\315\013\f\n\314\305\022\340\241\273/7`\034\374\311\377\017\376G\374O\t\377\367\177<FS\362\035\t\370&\206\266B\362p\367\351\030I\3713\215IZ\\r\301\237\356\230L\255\373&\234\301\303\335/\017x\334y\030\344q\367\007\364\273\315\2437Gp3\214\231\361\317\366\325\\\004Xfp5-q\376\353\222S\366s\247\273\3733\366K\211\331\215\006!\327\375\312\345tKg\013\371\337\n\2460U\252*\210S%\205\254\232Z\005\2746\210\034\024F\2450\004\352\034\f\211\326\342\004\202\225\256l\310BY\023U\241\352\004\005\355\212\206\f.R\204\226V\210\242\r\016"
+	.ascii	"3K\200@\276BOf@\030\016\"\254\024\"\251\334`\261\211\256y\024"
+	.ascii	"\013\217\204;H\250f^\302$\003"
+	.text
+	.section	.gnu.lto_gyroSampleBufferStart.34.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`F\002=\022"
+	.string	"V\240vI\320\3606\035\230\321\210\007N\202H\203\n\216\277\204\233MW\374#\255\236\215\246\370G\022\230(\332r\213\356\311\344Dx\b\230\242\327\264\234\321\367\204\340Q@*X\212\266NW\202\025\261\211E\002\272,\354\375d\364\277\333\222\235RZ"
+	.string	"`"
+	.string	"h"
+	.string	"\027v\202S\215\033\264\335\024\3019\253\254\316\035\304f\321p\275\332\3779\211\363@6\017\260\313s$\333MK\254`u\316\351\007t\347V\027\351\316\371\264\231\236\366\354\211\2260\020\325v\327\333@\234\365|=\375\007\375\003G\247\302\253*ew]qt4\334\333m\223\330\336`W\233NA?\322\275\350\017:\2405\3127zj\304\216"
+	.ascii	"\0314(\034[\243\354\364\246n\037\354\247vw\275\361\330\007\372"
+	.ascii	"\253\352\223\325\232ZO\2739=v\354\f\016I\004k\311\345\247\376"
+	.ascii	"\320\215\f\302b\372\211\242X\201m\227C\b\031\314\304\211^^\302"
+	.ascii	"\366\3079\257\254\316\261\240\\\266\235\340\344\274P\354\033"
+	.ascii	"E\277\321SP\0247\350\330-l\263\037\332OmwM\374\341S\313\341A"
+	.ascii	"C\253\215\fI\263\260\263\305\307p\201q\240\347i\354l\b\177\361"
+	.ascii	"rQ\322\243\343\3506y\244\026N\263\215uv\204\2630G\224v=\240\330"
+	.ascii	"3_!a\265\273(*(\324\204(\371\330t\347H\224r\f\325\036\006\220"
+	.ascii	"\242i\266\r\232v\366\261\356B\017~i\205\343\213\224\001\275\026"
+	.ascii	"\230q\206\205\200H\003\232_\bl&\006\024aB\325KT\021KR\306\024"
+	.ascii	"\035\214%L4A\226\357\023!\031\220+\337\327\031D9Y`\342b\021["
+	.ascii	"\")\207-\262\254q\tC\3203K\221f,[\274\230\021|yaiz-\003&ab\351"
+	.ascii	"\311\220d\351\201\244\350\203\236J\222\325h\350vc?- \200\002"
+	.ascii	"\2313\333\001\364\246\370/eR\002\002\371\246'\r\210aN\206%K\260"
+	.ascii	"\347\030\311\027\372a\0130\234\001\204\024\255w07\206jea?3\033"
+	.ascii	"\343\251\306,\370\206\335\270N\032\206\343H\223\214p\274&\n\341"
+	.ascii	"\325\260\316C\232q\f\216\300\017\324~\310kT \321>\203\fN!\267"
+	.ascii	"\211\340\275\026+\337\254\351H\362\342Zd"
+	.text
+	.section	.gnu.lto_gyroSampleBufferStop.35.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\232\001u\020"
+	.string	"F\036oH\340\260\272p\350\377\260\204\3248\3102\214\333A\235F)\325\314\373\n\371\200\363$c\250B\253\307\204\026JvY\352\013\n\0327\247\270\330\265\334{\t\304\324L\002\305s\337\t)\361\0019\313*\300s\205\205\327x\364d\247\024R"
+	.string	"["
+	.string	"\\"
+	.ascii	"+\202"
+	.string	"\203.\371\034|\310\026\2310\335\263\017;\212\3641\227\003\330\245\261\345\354\256\t\274\340s\320\353\005\204\007?\037\205\007\235\3325\276\326\354g\273\0133\335\356\212\337\210\324K\357\245\376e\007\301\310P\270\347q\332]{02\033\356\357\266\013\330\366`\037F\236\0233\001r\032r\330Xo\307^_\274O\204}\317\356\256?\032\373\261\337\363\254\254\272\034\tm7f\247ce\2001J\210b&\177\365q^sH$\373\n\332\213\300\267\373\201D\016K\305g(Oa\033t\320&\237\203\242\026&\333V0\222\376\346\365\265\260\022n\314\300\200\333\r\352\367b\237\366\327~RY\334+\277^\341\273\301p0\335\356\212\030d\243\213\331\201S\355\321\310\300\341\266fh\257\334\206\206\350\354\206(\331\256\277\210\360\331\335\222\213\t- :6.\341\301\00358p\274\235?l\035n\333 7\263\177\205\277\271O\352C\302\323\376"
+	.ascii	"\204\352\355\370\265\007F!\221\252\225\331\032\305\223\024\225"
+	.ascii	"+5\240d\031Q\024\b\313\2452\226)\244\307\252,)O\263\205\226\016"
+	.ascii	"T'\253D\307\024\n52\031\230&(T\350\2614B\"bJ\225\244\221\307"
+	.ascii	"$\311<[ \220\344(\242g\311\242:OD\025\325\270\022\311\023\025"
+	.ascii	"I\006l\262\312Sl\231\346)\206V\365\262{r\253\016\027  @\002\202"
+	.ascii	"\2542\036tS\374\2242/q\201|\322\223\004\3640\334\3022H\260\202"
+	.ascii	"\305\210\223\240\177\334\021\\\322\366\b\334\327\224\025^^\353"
+	.ascii	"\204\244g\307\240\005\262\245\266C^Q\001E\373\0162(\205h\023"
+	.ascii	"\305{-V\276k\323Q\362\342\312d"
+	.text
+	.section	.gnu.lto_gyroSampleBufferPop.36.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\\\004-\036"
+	.string	"F5\277L\240\226U:\254\247\222+\222\020\033\340s\213p\205\177\234\241\217\200^z\301\026 \317\372B9\217\3506\232l2h\0327\002Q\026\013,\017#\f\222\022\361J\372\032tz\037\266\253\003\037\016\260\243\2152\323\b\017\350K\032!{\357$\003\246"
+	.string	"\242"
+	.string	"\256"
+	.string	"\265\363e\214\257\210\216\025Lr2;\377\323\027\362\245\206y!c\335Czp\036Z3\f5i\375\200%v\342\256&\305\232\201\022\222\214\f\037\274l\234\363\305$vW\237\244\206\363\345\013I\314\332\356\017\017\344\347J(> \347\"%\306\234W\b=\341|\331\353g\314\227\347e\314\227\335\335\022(\374\364\356\353\021\360F.~K\311\234W\3305\332\331\335\361\265\273\376\227\216{\370\210\002\nJq,\364\213g\244\324\270\342\n\362a\007A(B?\336\262\b\352Y\313\262\220sn\013\024\004\343]\276\2733t\267\216n\314!T\331\351\037\362\232\0239\223\236\004R@\335\351\237t\316\234\363\315\022\\\2557\020A\005\2078P\230/\233D\367\334\207\211\303\251a2\347\034!'\344\331\253.\240%[Qe{\325\275\366\354\265\321}\234oQ\367\327\037\300\215\357\326\225~\326\211\357\222e\033\267l\337\323\266e\331\276"
+	.ascii	"\232\035A\"#\340\215Z3\360\013\227\fU:\345\270\361'>\006\030"
+	.ascii	"\3537\365\217\r\023\363\302\230;3\022+I\024\321\224P2\326'\322"
+	.ascii	"7\362b\303\274|Y]\t\223\256\346\346\034\274aT\201\344I~~\244"
+	.ascii	"\273[/;\367 t\025\217\370F\315\334' \252\327u\346\275\370\342"
+	.ascii	".\277\241\336mf\353\336\213\237V\004{A\220\331^\235\370\024\020"
+	.ascii	"\r\216r\316\025\272=\034\371A\201\024\324\b\020.\251\276\217"
+	.ascii	"\371\322@\025\247\326\265\027W\375\274\360\354\227v\025\201 "
+	.ascii	"\355\261J\312\214{m\\U\210\025\237\335\322\335\262G9\177i\002"
+	.ascii	"\024\177 [\367\306\313\204\274F\017\205v\346<\343\246\377\004"
+	.ascii	"\247\303\340\b\352=\346\313\326=PE\211h\277\364\217\177\213b"
+	.ascii	"\0222c\310B#7\271\316|\221\267\005\036\215y\246w\020\362\212"
+	.ascii	"\307<hd\244\357\314\023\177_X!\305h\031\262\n-\302\206V\263\335"
+	.ascii	"xPX\316NM7C\260SCypj\002\315\311\\8]\t4\335\241\261l\251\206"
+	.ascii	"T\275\361\344R\0165\025\227\346\320\231L&s\273p\303\221\311L"
+	.ascii	"5\r"
+	.string	"\021B73sR\034\356\2063\323\035\234\r\315\231\215\336P\250\020!6Kmdp\323ln\252\217\016\215\206\302rjj\242\246\346\300J\324P\033\214\246\346`6\013\372\206KU\030\317\355\246\302`V\336q\276E\031~G\277\246{\251\233F2~M\366M^^\026\335]\336\230\220w{\375\245\343T\255L\177\361N\256\273\357\"\273\205#\031\203\312\024\257\t\\q\301\243\274'Z\034Z\250q,\207\234B\244\220\bQ\020\243\302\302\001P\0021\310\314n\020pV\243c\216\245\f\377j\260w\376\033\252 AJ\031S\257$_C\3612\240{#tp}\031\257\224\320\362\030\035\331\333\326f\002\241\343i?iQT\307%\316\240\023\350\026\336c\236\276\200%P\226\006\204\266\364\214\250]\353\020W\003\2647|w\274f\216\025\371K\367\353y\214\342\242=JV<`AG\032<\234\t\367\352Y_\300\326\320\231"
+	.string	"\rT\323.\311\"\210\356\"=G\360M\245aGDT\323\323(\373\205\233"
+	.ascii	"\262L\"U0\212\304\214\251\fXGg\357\202\206_wK\321h\357\013\267"
+	.ascii	"\213\204\340\233\024<\211\272\354\266Oi\342\017"
+	.text
+	.section	.gnu.lto_gyroSampleBufferCount.37.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\355\n"
+	.string	"\306TL@ M&\0350\344\020\210\272\021\330\bj5\307\362\r@*\307\215\025P\340\"\321\335\006C\370\261.\033@F\021\363\313\002!\n\033\021\261P\261F*6\003y\316z\200+\261fn\265?\022\245L)7"
+	.string	"7"
+	.string	"<"
+	.string	"\016\217\021\277I^\211\337l;\2431\031|Ha\025_\260\324\354\304n\310\351\353\340\023\364\277\341\002 `"
+	.string	"\241b\235\236\221"
+	.string	"\273\353T\261\"\334z\333\034\266\007\330\317\004km\331N\307\307\376M\323\252\351\324\364#\025&H"
+	.string	"\370\260\273\252\245\330\021\233\b\230m\223=\261)\0258\231\3663\\\203\351\261\322-v[\264\020\273\341\305\036\222o\001\252\2321{p\001\025\272\007QgvI\355\330\336;\210,\264]\327\306\036]\226@\262\353`\303\201\264\340\202f\341\233_\212\337\256\226\0221Y\326<\231\260\211\302\016O\251.\373\220\335\r\366l4\037\035\034\002\037L\005\342\016\343}\f\ft\235\207\033}\037\005\240\257"
+	.string	"w"
+	.string	"\344\tq\3357\3420\033\366\020|>\216\344y\0377\t\367\216\252\321@Q\246\034\214\252Q\237\222\200\312\232S\037\020"
+	.ascii	"3K\200@\276BOf@\030&\2279\002\332\003\232\200s\247\"cV\323bB"
+	.ascii	"\217{a\240k\266t\207\210\246k>\001"
+	.text
+	.section	.gnu.lto_gyroCheckDataReady.38.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`?\001-\016"
+	.string	"\226\032`E\360\260(\035\342\341\331\336>\324Q\027YI].\267\203\275\351\357E\354\223\336\333I\360z&:G\355\324\326S\210@\232"
+	.string	"K\3762\324\212\023\257\255\251\f\353P\204J\222A\373\200Z\241\343rG\323\332M\244L)H"
+	.string	"J"
+	.string	"P"
+	.string	"\f\270C\307\027\340\034r\357\340\034\332\366\007\210\311\247G\020\254\277`\252\231\214\335\330\351\353\247o\232'_\004\366b\365\241\276m|\033\256\236oe\363\330\335\313\236,\237Jfgdw\235\253O\303\ro\333\201m\b\366=\004.\373\333\356\256\265e?\366\303\307;\235~\347\300\210\016\034^.\312\".\353\206\306\252\200)D<\376\266\311\227\231#\300\n\364x\362@\305e}\220\240\201%8\364\003\316S\003\224i\037v\027\323c)\037\260\333\212\231\331\215\n\034\372x\217\2446u\315\016\343\241\031\240\305(\251ex|\203\226T\332\030\200\314\267\"w\027\245\352\362O\234+\311\213\213\225\234a\333\302M`\340v?\204\370/%\024.\304\241\237\3029\274zZ\304J\344\215\t\324\320\b\250\241\325`l\332\330\021\225\032\245\221\247\016\205\200\210,"
+	.string	"\221\214>\035\233E\037\222\207\"A$\nu'\336\350\202\211W\322Q0\tM\350D\336I\367A`R\205\221\327\225H$\257\343\210\373m\265\345N\214\nE~\366\316\013F%\243?\361T\026\333\251\240\226\224\252\370\262G\250\315d\032"
+	.ascii	"3K\200@\276\242g\262\320\370Y(5\033\242\312\330Y\301\032X\361"
+	.ascii	"\205\301^\310\001v\31407iHZ .~.\302\262\214e\244s\r\314Y8Pdz"
+	.ascii	"\202\225\023\225\031\230-\016%o\273\212\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \352E\003"
+	.string	"\324\004\346"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\037\177\031\360\372\2508\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\002 \177\032\200\200\200\200\004!\177\033\"\177\034#\177\035$\177\036%\177\037&\177 \001'\177!\377\037"
+	.string	""
+	.string	"\200\220\200\003"
+	.string	"\b\360\372\2508\001\344r"
+	.string	"\n"
+	.ascii	"F\013}\231\313p\331\003\264\003\237\003\237\003\237\003\237\003"
+	.ascii	"\237\353\"\223\f"
+	.text
+	.section	.gnu.lto_.refs.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.45d6aa66528eedb5,"e",@progbits
+	.string	"(\265/\375`\343\032\345|"
+	.string	"\372\311\334,P0\220J\352\377\377^\370\303>L^\264\3038\210qT"
+	.ascii	"\310\301\334\253t\003>\347\rf!\331`\210\370\003\270\225(1\206"
+	.ascii	"5s\205\201\201\225\3279\t\004\002\261QBiLFB=\216*\020\317\261"
+	.ascii	"k\263\210\261\222\345\332\335\021\035\267\373o\231R\nl\002\274"
+	.ascii	"\002\304\002\375Z\330"
+	.string	"~+l\t\317s<\177\346\254\314\301\261V\005\313\253\376\306\355\\\332\301\357\274\215V\262\t\306\272\220\363t\352\035V\377\"j\257\303ilM{\257\366Ca\373\215\260\375C\330&\373(\266\337\240\025\316g\307\351J\226\331\253.\367\216\306\323\264\3139\r<J\227SsF\272\207\360q\017\201\243\205\013\031\266\252\375Ml\373\336\220\307\351(\337\237N\234\233\037dn\330\366/>\306\307\274\311{\272\302:\234\207q\251\213\351\366/N\245U\260g\216\346\374\366`\244\216\267+C\353o:\235N}hm\227\262j\232\003\255?\231\t\347@m\013\260\312,f^\317\305\267\350Da\242'\346Ug{\205|\300\214,\251\362j\373\026\333\376V\3611\207\323\222\300k\006\272\234_\242,~\305\325|p\316O\264\256\234\363\232kq,.\365\031\034\255\377\315Y\231s\356\023\335D\335&Px\026'\3633\017\311\234\261~"
+	.ascii	"!\305\306\334\334\345\374\212\020!$b\202\"Z\254\260j\273Z\373"
+	.ascii	"\031\t9\017\360\323\205\t\344U\023D\355i@+\323\371\346\337\372"
+	.ascii	"d-\b\336\253\235\304\226\360\240uu\240\325\313\334\212K?\270"
+	.ascii	"Y\233@\321\370\b\226\275z\372\240\364\351\275\332$\260\355\037"
+	.ascii	"V\237\372\207\265C`\035\314\303\\\272\200\213\265\177\371\333"
+	.ascii	"8\3107\2779\277\277\337\342+\013{\2657`y h\2176\001`\031E\367"
+	.ascii	"\260\355\013\254x:\365\005\326~\226\203\007\255\357@+\b\017\232"
+	.ascii	"\322\355R\334\353\003^F=3Y\316\357\317\357\325!\005\303\253\375"
+	.ascii	"z\320\312:\320\332\355\355\326\332\215A\020\223n\320\355\031"
+	.ascii	"t\373\005\036\026@7~\321\033\272\261\003\335\035\355\240\343"
+	.ascii	"\272}\003\r\272=F\267\253\350\366\021\232C7>\321j7&\321\337\215"
+	.ascii	"Ct;\224*\335\235\245\333\337\356^\353\366\257\356VS\240\273E"
+	.ascii	"\350n\017\335NE\200n\034\324\355Q\272}\253\333\211t{V\267\367"
+	.ascii	"\350v\036\335\276\243\333\231\335\016\325\355\304n\207\321\355"
+	.ascii	"i\272=E\267'u7[w\243\351v\027\272\275\205nw\273\333\203\3566"
+	.ascii	"\353n\261nG\241\333\227\272}\330\355J\335.\354\366\023\272\335"
+	.ascii	"\204n\017v7\227\356\336\322\335^\335}@w\273u\267\316t:\235v\177"
+	.ascii	"\004\335j\007\335A.\002/\344\315\336_\365xh\037\237\227\033?"
+	.ascii	"\303oW\316XV\024__\301U\230\0024\215y\242\333\361<<$\2270|\364"
+	.ascii	"\321\351y\337G\355\214YB]\335\201q2;I\036PWwC~\253\206\236w\351"
+	.ascii	"o{&\257\345\350\223\274\202\272\272\233\353v\275=(\251\251\327"
+	.ascii	"\301\302\324\337\332\274\214\233\361Q\276\271\231\023\346|\337"
+	.ascii	"\036\314w\371\2707\363l?\346\271\274\227\027\363p\357\366a\236"
+	.ascii	"\314\227\371/\277\305\245\337\366T\3751\374\222\267\315k\360"
+	.ascii	"<\374\246\275\310\272\321\366G^\t"
+	.string	"[\036\233n_\323\346m\374,'K\n\352\252G\007_\325\020\004\3245\225\214\031\033h\257\366zd\373D\224\2072\202\234{\315\340j|\216o\246\362`.\f\226O\373+\237\345\321\\\372j\177\326\356\346^Z\310\251\274\332;y\031\034\216\254\305\0275(^\355\237<\024\207sF\340%\r]\316a\324\336\353\315<$\227\352\032\032\272\234\263\b\021?$\315&+<j\343\340\261\215\023\307\366\233u\177\223\227\362Vx\370x\304\300\365j\231\322\206W\022\2646V\354\277>\314Cri\201\227\027\257n\242\027\363=\317\363A\276\371\270\342\r\352\352.\347<\366d.}\261\217\366_\275T\204\b!\036\250/\2506\253\352g\354\277_\305\245\355\366`\355C\203tnI\030\333/x\273\255\215\343\305\376\024\242~*}x7\310^\3751a9d\234$,O\237\2241A\214\300\375\\\313\215\214\236\017\3663\016\025;"
+	.ascii	"\335+\351\2565?\256\274\232dC\231\324\027N\222E\362\\;h\240\362"
+	.ascii	"\234\035\333*\335\033)6\231\013\322\245Hka#t4t\021\351\327:\312"
+	.ascii	"\231\231Q\263\300\220C\247\211UY\232)l\253N>\2103\321s\223\346"
+	.ascii	"\343\t$G\211\007\366\005\253\037\210K\231\033c\367\352\377\370"
+	.ascii	"&\333Eu\264\341C\207M\0310Z>\332\361T!J\320\244\274\332\352\024"
+	.ascii	"\313\301\201V\347\343\350\021\205R\3036\016\363V.\3028\177\224"
+	.ascii	"\261U\237#\316\013\355\r\216\376\034r\270\016k\bW\323\277\234"
+	.ascii	"VW\276\311\374qq\353\273z\225\371Tk\2245I\346\027\333\330\t\013"
+	.ascii	"\302\201\326G\3421%\224W\241\\\3727|\332Bo\316d7>\377\223\303"
+	.ascii	"9\337\214\303%\273z#$\202'?\341\251\251OK\237\232\242[\276\372"
+	.ascii	"N:^\252\254\332^m\354\304v\277\r\227~S\317\361\344\354a(\310"
+	.ascii	"\022\034\257v\335+\237H\2315y\257v\277\362\223*3\217\361x\365"
+	.ascii	"\2219sM1`ul\377\321\247\375A\220d\332\260\375pl\277\033\033l"
+	.ascii	"\376\016/n\r\264q\326?\371\260\023\362*\016\202\247\260\230\274"
+	.ascii	"i=w\270\260\340\312<\201P\021S\243R\306\023\367\366\005\004c"
+	.ascii	"}\364kP3&\026\206\345\240\325\243\007f\026\321\3319\237\254d"
+	.ascii	"{f\246g,\207-<x`\246\320[\232\t\244\023\231\023\366\247\t\007"
+	.ascii	"\016\274#\20068\234:\245SLG\343\035.\207\323\324}\205\275\212"
+	.ascii	"s`+\2376\255\234gU\265\003f\013\225\247w\347\331lb"
+	.string	"\306\345x\240pd\301\272b\177\220DEa\246\320\224\247\217\241u\271\274\252\303T\215\231\033\234RbS\360\024\233\343\275\252\302SX\n\223\275j\31338\f\223\036[^\355\034(\366G\n\001\316\370\330\030\331H\f\305\346\234\001\220{\355\234w\331\351\034*\221\235=\236\032C\341&'uk{\257\342\245\237\341 \321\340!_\305N>\226\023\305\265\006\313\2538\211\233\206\232t\201\303M\330\006\017\030[\221'g{_\270\342\342z\025+\333\247\224\330pk-\335\255\243Z\251Iy\313\302\366w\257\031\007\316\233\323\222<k\267\267\343\264\017u\3678\366\0032\356\376\220A\316\3074Z5\254]\240;jh\020\271s>>\231?\3137\ne.\225\320\035\276\214B\233\313(\364\370K/\310&3C\217l~6\331%2\347\35037w^h\316/\364\310\276Hf^\276\320\347\317R\tm\3722\232\231Y\231\231"
+	.ascii	",sn\346(\224\215/3\224\271\214>\233?Y\t\005\315\322\315\233\246"
+	.ascii	"\243\245\215\365\b\263T\346)\002\236(\237L\270\345\373\364\264"
+	.ascii	"\234\217dM\231\351o\316\320\234}<C\244)\221\034\323\222pS9N\345"
+	.ascii	"{t\036R\311\254\247\316\233\314pK&\317\244\246\234\317d\251\006"
+	.ascii	"\216~t\312\311\243\347\334\3642sN>Ip>\235\214\0233\367d%2*\231"
+	.ascii	"\365\344iJ>\2352\223 \336\\F\263\236Djb\321\256\234|\217\336"
+	.ascii	"\225\317@\231l\364\370\346e\316\331\335\364\330\241\225\271\233"
+	.ascii	"v\237\324\333e\346\325\376\276\356\277{\274\347#\341Wg\245\210"
+	.ascii	"\215W_\357\367\372\371>/?_\003\317\234\221\317\367\333\313\031"
+	.string	"\371s\017\341\036B\215\222\225\304\312\252\366Z\204\305d\036\264>\340@\353\277!\352\267\313{\231\\^U\341@\353\327\240\256\271\2759\202\365n^/\036*\252\255'\033\2725>%\270\215UZ\2325b%\250\362d\230\263\202\261\230b\336\324\274\226\265\b\232fY\032\227\313\221\302\226E&7\324\203\027\227|\202\206\206\263#S`x\365\314\263M\b\217*\266}\216n\n\352\352\356\355\214\253\331\020Fu\"+n\221\nw\030\\;i\004\r\242\220\304\220\250\244D4\022r\201JE\"\322\212\344\016\203\305\245\025\211\006Q\330\342\004\2436\211\305\022\221\003\240%b"
+	.string	"n\021\350\312\b:j\335\"qi\211I\206\021F\001AW\205\n\334!\214_\033\275h\215Db\222\021\2076\n\026\333aK\203\355\006R0\220B\205\n9\255bE\211\025%\326V\261\202\210hE\n\"\266S\020\341\"0\311Hm\213\214\202KD\017h\020\205\033\\\367\250\025\226"
+	.string	"\034\2669\306\""
+	.string	"\\c\021\217[\304\032g\264JAw5\346\034\001\333$U\030\004\272\252;d\"\262H\201(D*\2665\210=\305\026\t\211\211\002\036\327X\324\032\005wj\264-\214L%\300p\203\303`\320\320\305\021\260-\256@\027\330\242\303\320E[dr\201\305vI\251u{\226\230\212 \206.\214L.\320\225\341\016\203;E\227\003\243!\323\fbq\205\027\003\030\213j\264-\206.Z\027x\264\304\304v\322\b\002\212\255\360h\b\264"
+	.string	"\310\035\"\275\261\310\250\215q\202\021\260\004\241\020\310\342'\350\252\320\252\255\020hd\304I\001\030\203E\213\t6\344\020\213\255\blk\234A\364@\006\223R\320\007iI\210e\034\265\256\261eB\241-v\020\022\211\024\024\341\254p\004lc"
+	.string	"]\340\221\216[d\342\204q\206\020X\243\330\272C\030\255pI\th\f\240-\002\026\025\211\306ak\364\031\322\b\n'\320q\213\216\206\023\024[W\030t\321\241\223\022h\342R[$\341\022\211E\022;\306\226I\b\374\200F\020iHd\301\301-R\221\203\264\204A\216[\224\202\310\035\006\231\330\006\246@\241\242\304\003%\264#\200\372\201\007X\200\230\241\301\013\326h\204\221\021\220\204\261\330\326\b\026\217H\f\203@%\022FE#\211\021\b\260`A\353\002c\020\213+\320\330\320qE\246U\277\332\365P\303\366*\216>\016\303\322\306\321~_\0345`\357we\306%\206\025,\n\2212zu\377m\\\340+S\362\352\373\356\244a\225U\275\212\275\360\024\227\na*b\222S>\314\330\027\262\013\255=u\241\325\007\013\004\\\\8\212\203e*7c\223\265v\227\263s\350\273\346d"
+	.ascii	"\213\241q\224\306P\270\306\262\240\311\200\237t\353l\300rL\002"
+	.ascii	"\335bq\023\354\004j6\246\n\006\0263\031\361k;\302\305\313\022"
+	.ascii	"\r\214\2001{U\365\326\262b%_\367Cr\f3\363*\356\032\232a\215+"
+	.ascii	"*I\217W\0223_\222 \371I\251\032rDGM\257\211\025\026\353\263\246"
+	.ascii	"H\021\274e\367\372\264"
+	.string	"\031b\004\317H\343-9\003\316t|ao\260\277+!-\004\023qg>\262A\240\216n\207\317\211\351\034\322\230\210\237i\261k+\303V?6%D\266\352\330\237\224\037?pV\202-\250\202\2618\n\023\031#B$#$I\222tr\n\020\206\343Y\244\230\362\006\022\20059\217A\247\206D\244II\241^\313\032\243E\265\221PC\020Y.+\034\241\343\275 \027\372\364\177\227\363\021\r\362\006\027\347\307tz\007aQ\203\371\321\236\214\200\033\256\372\352\260\2248Q\205\033\031\203\326-yIT\2622\321\326\020`D\2218\265\306)5\253\024\003\201\355\307\177\327\203\207\\0\177\233\367\265j\340d\324\266\250V\020\034\303E!\260\331u=\335z3\354\200U\001k8<\335\305\0138P[\033\235\232\250&\320\310g(\373\364\254\203\216\004#A\233\232\035\236\032I\204S\252q\371\026\033\007\256\366s\222\033\004q\006"
+	.string	"C\263\022<\321\342l"
+	.string	"\200(\004G2\306D&5=\032\366\2044\320b\250(\240C\022R\217\317-Z&\331[\324\353L\t\367\336\245^\342\\hf\327\241\354\202\005\330\f\350I\246I\302\367\270pB\350\357&\032\013\330\376\215\007\261\241P\370\004]\236\227\013\351\335zG\350\330\375Y\220A^\366z9+\310w\244\317\335\221\240]\313\244\262\357Q\177.)A\374\310)\271\001\266\276\340\336\035\256\336\252\262\330\025\330\352\256\300wH\n\374\256\365\344P\3123\352\221\212v\333@c\\\241\340\016\231\241|\0227\276\353\250h\275_\035\300"
+	.ascii	"\357\302+\242j2\311a\356\304\021\n\267_\301\002\214zd\227\240"
+	.ascii	"\333.\021\022k&\2660\305"
+	.string	"ZU\301\360\327\256d\237i\304F\350\277\331\376\370\271\334q\374\330\253~ \354\201\234V!\033Aj\231S\321\244\235\003\001f\317\225\333\323\b\350\030\226:um\177\016:\241g\276lN\245`E\032Q\232\257Ri0\221\2319\020^\204}\333V\247\357\336=\020\230*\313\227\260\034~\250<\352\240\020\326,O\003\324\320Nu\201fg\307\353\3748b\027>r\265\324\002\031u M\372\007\256\03296\241\346K\0024\252\320\222\366\324\031\024|:\347\037\201\350x\237\333\016e0E.rU\t\370\023\361I\204d\337\365<\311\234\301\304_\"\320\351\231\210jv\0056\363o\305\223u\356\214=<7\371\253D\207\366\002\327\272\344\350x\222T\001Y\367\036-\267\223Z\263\036\304\234\247\202\002\034\306Yq\205\272\240\274i\203\323b\346\f\366\314F\362\257m\225\017<)\\\346s\355>\016\023ch\266\344\207\321\020Q"
+	.ascii	"\331\311\316:\t\326\036N\274\262N\f\026\314\023\023\330&O\302"
+	.ascii	"\032\026d.t\216\277\302h\231\332~\220\254\302\025\227\206@G%"
+	.ascii	"\223\332\266j\316\2540:\003\005\322\007tn\f\304Y\256y\213\241"
+	.ascii	"\332sq1+z;\306\333\315\217\006\327\022*\213f\247\204\232\020"
+	.ascii	"2vT\315\235\0168\3436\221\372\274\224[4P*\3010M\205\251\0340"
+	.ascii	"\372}l]5\021\337\223\024\002v?R(\267\202\265\201\216\315\312"
+	.ascii	"\222I\210\006)\224\n%F\177\352 r\270lF\260\240q\337kgE\271\311"
+	.ascii	")\245Y\370#\211\344\225\025\254$w\t\344\352\306>\260\217jQF\325"
+	.ascii	"\212\224@\211\f\304\242b\345\333\246E\257\222\375D,\035\016\272"
+	.ascii	"\3108\005k\203\355\252g}\256YeU]3\203\026\302\322$\003\322SJ"
+	.ascii	"e\231(\360;eWo\272\333}\027\2041Rp\351\234+o\257\236@q\343\013"
+	.ascii	"w,\211\004\211\207Y\235\206.GT\016\256f\267D\374$\247\036\204"
+	.ascii	"\037&!\365\251\307\211\250!\005S\335\240B\222\222d\312\022\205"
+	.ascii	"Gt\2338\375d\245\0275\354\202\324!\243Jor\230hXF\245M\b\304\250"
+	.ascii	"\266\337\025\301i\221\362!\326\032B)\322\3345cR\311\2070\255"
+	.ascii	"_H\364\366\262r\025\312\032\304q\246\306\271\216O\002M\243\272"
+	.ascii	"\333S\350\260\0211\313\270\226\254^\210\375\273b7g/\320\232s"
+	.ascii	"\356y\214|\213\307\036\346\023.vg\003\237\023x\242\037\034\363"
+	.ascii	"\232\303h\3617\210\274\326\017\027\023\372\235\366\3762\253\367"
+	.ascii	"\227\007\250\357\365\374vLq\333\340Bt\t\277:l\243g\305\006\237"
+	.ascii	"\277\360Z\"\027\003\036q\373N\203\311A|\377\267\314\256\303\004"
+	.ascii	"\247\364"
+	.ascii	" \332\370\314l\255"
+	.text
+	.section	.gnu.lto_.symtab.45d6aa66528eedb5,"e",@progbits
+	.string	"chooseGyroConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"gyroIntExtiInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"gyroSampleBufferIsSupported"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"gyroSampleBufferStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"gyroSampleBufferStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"gyroSampleBufferPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"gyroSampleBufferCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"gyroCheckDataReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"_logf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.45d6aa66528eedb5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
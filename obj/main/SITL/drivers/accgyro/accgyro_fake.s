@@ -0,0 +1,8484 @@
+	.file	"accgyro_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/drivers/exti.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/bus.h"
+	.file 10 "./src/main/drivers/sensor.h"
+	.file 11 "./src/main/drivers/accgyro/accgyro.h"
+	.file 12 "./src/main/drivers/accgyro/accgyro_fake.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	accgyro_fake.c.00c47475
+	.weak	accgyro_fake.c.00c47475
+accgyro_fake.c.00c47475:
+	.long	0x9e3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1250
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1033
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1034
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1035
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1036
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1037
+	.uleb128 0x3
+	.long	.LASF1038
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1039
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1040
+	.uleb128 0x3
+	.long	.LASF1041
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1042
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1043
+	.uleb128 0x3
+	.long	.LASF1044
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1045
+	.uleb128 0x3
+	.long	.LASF1046
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1047
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xd
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF1048
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1049
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xd
+	.long	0xc8
+	.uleb128 0x3
+	.long	.LASF1050
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x8a
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x14
+	.long	0xfd
+	.uleb128 0xe
+	.string	"X"
+	.byte	0
+	.uleb128 0xe
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xe
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1051
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF1052
+	.byte	0x5
+	.byte	0x7
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF1053
+	.byte	0x5
+	.byte	0x8
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x3
+	.long	.LASF1054
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x22
+	.long	0x12d
+	.uleb128 0xa
+	.long	.LASF1173
+	.byte	0x8
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x8
+	.long	0x147
+	.uleb128 0xf
+	.string	"fn"
+	.byte	0x6
+	.byte	0x20
+	.byte	0x1a
+	.long	0x163
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1055
+	.byte	0x6
+	.byte	0x1d
+	.byte	0xe
+	.long	0x153
+	.uleb128 0x10
+	.long	0x15e
+	.uleb128 0x7
+	.long	0x15e
+	.byte	0
+	.uleb128 0x4
+	.long	0x121
+	.uleb128 0x4
+	.long	0x147
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x258
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1059
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1060
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1066
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1067
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1068
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1070
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1072
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1074
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1075
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1076
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1077
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1079
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1080
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1088
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x25
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x8
+	.byte	0x43
+	.long	0x2e2
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1095
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1096
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1098
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1100
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1102
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1103
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1104
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1105
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1106
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1108
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1109
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1110
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1111
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1114
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1115
+	.uleb128 0xd
+	.long	0x2e2
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x3a
+	.long	0x318
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1117
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1118
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1119
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1120
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1121
+	.byte	0x9
+	.byte	0x40
+	.byte	0x3
+	.long	0x2ee
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x9
+	.byte	0x4b
+	.long	0x45c
+	.uleb128 0x1
+	.long	.LASF1122
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1123
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1124
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1125
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1126
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1129
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1130
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1131
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1132
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1133
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1134
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1135
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1136
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1137
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1138
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1139
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1140
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1141
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1142
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1143
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1144
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1145
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1146
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1147
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1148
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1149
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1150
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1151
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1152
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1153
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1154
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1155
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1156
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1157
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1158
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1159
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1160
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1161
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1162
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1163
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1164
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1165
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1166
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1167
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1168
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1169
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1170
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1171
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1172
+	.byte	0x9
+	.byte	0x94
+	.byte	0x3
+	.long	0x324
+	.uleb128 0x12
+	.byte	0xa6
+	.uleb128 0xa
+	.long	.LASF1174
+	.byte	0x18
+	.byte	0x9
+	.byte	0x9f
+	.byte	0x10
+	.long	0x4e0
+	.uleb128 0x2
+	.long	.LASF1175
+	.byte	0x9
+	.byte	0xa0
+	.byte	0xc
+	.long	0x96
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1176
+	.byte	0x9
+	.byte	0xa1
+	.byte	0xf
+	.long	0x318
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1177
+	.byte	0x9
+	.byte	0xa2
+	.byte	0x17
+	.long	0x45c
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1178
+	.byte	0x9
+	.byte	0xa3
+	.byte	0xd
+	.long	0xab
+	.byte	0x10
+	.uleb128 0xf
+	.string	"tag"
+	.byte	0x9
+	.byte	0xa4
+	.byte	0xd
+	.long	0xab
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0x9
+	.byte	0xa5
+	.byte	0xd
+	.long	0xab
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x9
+	.byte	0xb3
+	.byte	0x7
+	.long	0x468
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x9
+	.byte	0xb4
+	.byte	0xd
+	.long	0x109
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1182
+	.byte	0x9
+	.byte	0xb5
+	.byte	0x3
+	.long	0x46a
+	.uleb128 0x1c
+	.long	0x4e0
+	.uleb128 0x12
+	.byte	0xbc
+	.uleb128 0xa
+	.long	.LASF1183
+	.byte	0x28
+	.byte	0x9
+	.byte	0xb7
+	.byte	0x10
+	.long	0x55c
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x9
+	.byte	0xb8
+	.byte	0x23
+	.long	0x55c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1176
+	.byte	0x9
+	.byte	0xb9
+	.byte	0xf
+	.long	0x318
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1178
+	.byte	0x9
+	.byte	0xba
+	.byte	0xe
+	.long	0xc8
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1179
+	.byte	0x9
+	.byte	0xbb
+	.byte	0xe
+	.long	0xc8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1180
+	.byte	0x9
+	.byte	0xc9
+	.byte	0x7
+	.long	0x4f1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1181
+	.byte	0x9
+	.byte	0xca
+	.byte	0xa
+	.long	0x115
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x9
+	.byte	0xcb
+	.byte	0x10
+	.long	0x561
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x4ec
+	.uleb128 0x4
+	.long	0xc8
+	.uleb128 0x3
+	.long	.LASF1186
+	.byte	0x9
+	.byte	0xce
+	.byte	0x3
+	.long	0x4f3
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x1a
+	.long	0x5b4
+	.uleb128 0x1
+	.long	.LASF1187
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1188
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1191
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1193
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1195
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1196
+	.byte	0xa
+	.byte	0x24
+	.byte	0x3
+	.long	0x572
+	.uleb128 0x4
+	.long	0x9f
+	.uleb128 0x3
+	.long	.LASF1197
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x10
+	.long	0x5d1
+	.uleb128 0x4
+	.long	0x5d6
+	.uleb128 0x10
+	.long	0x5e1
+	.uleb128 0x7
+	.long	0x5e1
+	.byte	0
+	.uleb128 0x4
+	.long	0x5e6
+	.uleb128 0xa
+	.long	.LASF1198
+	.byte	0x28
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x10
+	.long	0x64f
+	.uleb128 0x2
+	.long	.LASF1199
+	.byte	0xb
+	.byte	0x4e
+	.byte	0x13
+	.long	0x885
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1200
+	.byte	0xb
+	.byte	0x4f
+	.byte	0x1a
+	.long	0x5c5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0xb
+	.byte	0x50
+	.byte	0x1a
+	.long	0x64f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1202
+	.byte	0xb
+	.byte	0x51
+	.byte	0xe
+	.long	0xbc
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0xb
+	.byte	0x52
+	.byte	0xd
+	.long	0x7ff
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0xb
+	.byte	0x53
+	.byte	0xd
+	.long	0xab
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0xb
+	.byte	0x54
+	.byte	0x14
+	.long	0x5b4
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1206
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xf
+	.long	0x65b
+	.uleb128 0x4
+	.long	0x660
+	.uleb128 0x11
+	.long	0x2e2
+	.long	0x66f
+	.uleb128 0x7
+	.long	0x5e1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1207
+	.byte	0xa
+	.byte	0x2d
+	.byte	0x10
+	.long	0x67b
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x10
+	.long	0x68b
+	.uleb128 0x7
+	.long	0x68b
+	.byte	0
+	.uleb128 0x4
+	.long	0x690
+	.uleb128 0x13
+	.long	.LASF1208
+	.value	0x170
+	.byte	0x39
+	.long	0x77a
+	.uleb128 0x2
+	.long	.LASF1199
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x13
+	.long	0x885
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1200
+	.byte	0xb
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x66f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x77a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1209
+	.byte	0xb
+	.byte	0x3d
+	.byte	0x1f
+	.long	0x7a6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1210
+	.byte	0xb
+	.byte	0x3e
+	.byte	0x26
+	.long	0x7cb
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1211
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x1d
+	.long	0x79a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1212
+	.byte	0xb
+	.byte	0x40
+	.byte	0x17
+	.long	0x121
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1213
+	.byte	0xb
+	.byte	0x41
+	.byte	0xb
+	.long	0x88a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1214
+	.byte	0xb
+	.byte	0x42
+	.byte	0xd
+	.long	0x7ff
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1215
+	.byte	0xb
+	.byte	0x43
+	.byte	0xd
+	.long	0x7ff
+	.byte	0x42
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0xb
+	.byte	0x44
+	.byte	0xd
+	.long	0xab
+	.byte	0x48
+	.uleb128 0xf
+	.string	"lpf"
+	.byte	0xb
+	.byte	0x45
+	.byte	0xd
+	.long	0xab
+	.byte	0x49
+	.uleb128 0x2
+	.long	.LASF1216
+	.byte	0xb
+	.byte	0x46
+	.byte	0xe
+	.long	0xc8
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF1217
+	.byte	0xb
+	.byte	0x47
+	.byte	0x12
+	.long	0x2e9
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1218
+	.byte	0xb
+	.byte	0x48
+	.byte	0xe
+	.long	0xc8
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF1219
+	.byte	0xb
+	.byte	0x49
+	.byte	0x14
+	.long	0x5b4
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1220
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x18
+	.long	0x879
+	.byte	0x60
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1221
+	.byte	0xa
+	.byte	0x2e
+	.byte	0xf
+	.long	0x786
+	.uleb128 0x4
+	.long	0x78b
+	.uleb128 0x11
+	.long	0x2e2
+	.long	0x79a
+	.uleb128 0x7
+	.long	0x68b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1222
+	.byte	0xa
+	.byte	0x2f
+	.byte	0xf
+	.long	0x786
+	.uleb128 0x3
+	.long	.LASF1223
+	.byte	0xa
+	.byte	0x30
+	.byte	0xf
+	.long	0x7b2
+	.uleb128 0x4
+	.long	0x7b7
+	.uleb128 0x11
+	.long	0x2e2
+	.long	0x7cb
+	.uleb128 0x7
+	.long	0x68b
+	.uleb128 0x7
+	.long	0x5c0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1224
+	.byte	0xa
+	.byte	0x31
+	.byte	0xf
+	.long	0x786
+	.uleb128 0xa
+	.long	.LASF1225
+	.byte	0x10
+	.byte	0xb
+	.byte	0x2b
+	.byte	0x10
+	.long	0x7ff
+	.uleb128 0x2
+	.long	.LASF1226
+	.byte	0xb
+	.byte	0x2c
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1214
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xd
+	.long	0x7ff
+	.byte	0x8
+	.byte	0
+	.uleb128 0x14
+	.long	0x9f
+	.long	0x80f
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1227
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x3
+	.long	0x7d7
+	.uleb128 0x13
+	.long	.LASF1228
+	.value	0x110
+	.byte	0x31
+	.long	0x869
+	.uleb128 0x2
+	.long	.LASF1229
+	.byte	0xb
+	.byte	0x32
+	.byte	0x12
+	.long	0x869
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1230
+	.byte	0x33
+	.byte	0x16
+	.long	0xb7
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF1231
+	.byte	0x34
+	.byte	0x16
+	.long	0xb7
+	.value	0x101
+	.uleb128 0xb
+	.long	.LASF1232
+	.byte	0x35
+	.byte	0x17
+	.long	0xd4
+	.value	0x104
+	.uleb128 0xb
+	.long	.LASF1233
+	.byte	0x36
+	.byte	0x12
+	.long	0x2e9
+	.value	0x108
+	.byte	0
+	.uleb128 0x14
+	.long	0x80f
+	.long	0x879
+	.uleb128 0x15
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1234
+	.byte	0xb
+	.byte	0x37
+	.byte	0x3
+	.long	0x81b
+	.uleb128 0x4
+	.long	0x566
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1235
+	.uleb128 0x3
+	.long	.LASF1236
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x3
+	.long	0x690
+	.uleb128 0x3
+	.long	.LASF1237
+	.byte	0xb
+	.byte	0x55
+	.byte	0x3
+	.long	0x5e6
+	.uleb128 0x16
+	.long	.LASF1238
+	.byte	0x20
+	.long	0x7ff
+	.uleb128 0x16
+	.long	.LASF1239
+	.byte	0x52
+	.long	0x7ff
+	.uleb128 0x17
+	.long	.LASF1240
+	.byte	0x68
+	.long	0x2e2
+	.long	0x8d7
+	.uleb128 0x6
+	.string	"acc"
+	.byte	0x68
+	.byte	0x1d
+	.long	0x8d7
+	.byte	0
+	.uleb128 0x4
+	.long	0x89d
+	.uleb128 0xc
+	.long	.LASF1243
+	.byte	0x60
+	.long	0x2e2
+	.long	0x8f6
+	.uleb128 0x6
+	.string	"acc"
+	.byte	0x60
+	.byte	0x22
+	.long	0x8d7
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1248
+	.byte	0x59
+	.long	0x91c
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x59
+	.byte	0x19
+	.long	0x9f
+	.uleb128 0x6
+	.string	"y"
+	.byte	0x59
+	.byte	0x24
+	.long	0x9f
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x59
+	.byte	0x2f
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1251
+	.byte	0xc
+	.byte	0x54
+	.byte	0xd
+	.long	0x934
+	.uleb128 0x6
+	.string	"acc"
+	.byte	0x54
+	.byte	0x23
+	.long	0x8d7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1241
+	.byte	0x43
+	.long	0x2e2
+	.long	0x94e
+	.uleb128 0x9
+	.long	.LASF1242
+	.byte	0x43
+	.byte	0x1f
+	.long	0x94e
+	.byte	0
+	.uleb128 0x4
+	.long	0x891
+	.uleb128 0xc
+	.long	.LASF1244
+	.byte	0x3d
+	.long	0x2e2
+	.long	0x96d
+	.uleb128 0x9
+	.long	.LASF1242
+	.byte	0x3d
+	.byte	0x2a
+	.long	0x94e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1245
+	.byte	0x36
+	.long	0x2e2
+	.long	0x992
+	.uleb128 0x9
+	.long	.LASF1242
+	.byte	0x36
+	.byte	0x2f
+	.long	0x94e
+	.uleb128 0x9
+	.long	.LASF1246
+	.byte	0x36
+	.byte	0x3e
+	.long	0x5c0
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1247
+	.byte	0x2e
+	.long	0x2e2
+	.long	0x9ac
+	.uleb128 0x9
+	.long	.LASF1242
+	.byte	0x2e
+	.byte	0x24
+	.long	0x94e
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1249
+	.byte	0x27
+	.long	0x9d2
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x27
+	.byte	0x1a
+	.long	0x9f
+	.uleb128 0x6
+	.string	"y"
+	.byte	0x27
+	.byte	0x25
+	.long	0x9f
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x27
+	.byte	0x30
+	.long	0x9f
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1252
+	.byte	0xc
+	.byte	0x22
+	.byte	0xd
+	.uleb128 0x9
+	.long	.LASF1242
+	.byte	0x22
+	.byte	0x25
+	.long	0x94e
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 29 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.file 30 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 31 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1f
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 33 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x21
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 35 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.file 36 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF992
+	.byte	0x4
+	.file 38 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF993
+	.file 39 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x4
+	.file 40 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x28
+	.file 41 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1006
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 42 "./src/main/drivers/accgyro/accgyro_fake.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF946
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF956
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF991
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1032
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1253
+	.long	.LASF1254
+	.long	.LASF1255
+	.long	.LASF1256
+	.long	.LASF1257
+	.long	.LASF1258
+	.long	.LASF1259
+	.long	.LASF1260
+	.long	.LASF1261
+	.long	.LASF1262
+	.long	.LASF1263
+	.long	.LASF1264
+	.long	.LASF1265
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1266
+	.byte	0x9
+	.long	.LASF1267
+	.byte	0x9
+	.long	.LASF1268
+	.byte	0x9
+	.long	.LASF1269
+	.byte	0x2
+	.long	.LASF1270
+	.byte	0x5
+	.long	.LASF1271
+	.byte	0x5
+	.long	.LASF1272
+	.byte	0x2
+	.long	.LASF1273
+	.byte	0x5
+	.long	.LASF1274
+	.byte	0x5
+	.long	.LASF1275
+	.byte	0x5
+	.long	.LASF1276
+	.byte	0x4
+	.long	.LASF1277
+	.byte	0x4
+	.long	.LASF1278
+	.byte	0xc
+	.long	.LASF1279
+	.byte	0xd
+	.long	.LASF1280
+	.byte	0xd
+	.long	.LASF1280
+	.byte	0xc
+	.long	.LASF1281
+	.byte	0x9
+	.long	.LASF1282
+	.byte	0xc
+	.long	.LASF1283
+	.byte	0xc
+	.long	.LASF1284
+	.byte	0x9
+	.long	.LASF1285
+	.byte	0x9
+	.long	.LASF1286
+	.byte	0xb
+	.long	.LASF1287
+	.byte	0x9
+	.long	.LASF1288
+	.byte	0xa
+	.long	.LASF1289
+	.byte	0xa
+	.long	.LASF1290
+	.byte	0x9
+	.long	.LASF1291
+	.byte	0x9
+	.long	.LASF1292
+	.byte	0x9
+	.long	.LASF1293
+	.byte	0x8
+	.long	.LASF1294
+	.byte	0x7
+	.long	.LASF1295
+	.byte	0x6
+	.long	.LASF1296
+	.byte	0xd
+	.long	.LASF1297
+	.byte	0x7
+	.long	.LASF1298
+	.byte	0x7
+	.long	.LASF1299
+	.byte	0x2
+	.long	.LASF1300
+	.byte	0x3
+	.long	.LASF1301
+	.byte	0x1
+	.long	.LASF1302
+	.byte	0x5
+	.long	.LASF1303
+	.byte	0x5
+	.long	.LASF1304
+	.byte	0x5
+	.long	.LASF1305
+	.byte	0x5
+	.long	.LASF1306
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF962:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1146:
+	.string	"DEVHW_AK8975"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF958:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF925:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1180:
+	.string	"busdev"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1068:
+	.string	"OWNER_SYSTEM"
+.LASF1112:
+	.string	"RESOURCE_ADC_CH4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF926:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1029:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF711:
+	.string	"USE_GPS "
+.LASF1135:
+	.string	"DEVHW_MPU9250"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1190:
+	.string	"CW180_DEG"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1090:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1152:
+	.string	"DEVHW_LIS3MDL"
+.LASF1208:
+	.string	"gyroDev_s"
+.LASF1236:
+	.string	"gyroDev_t"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF1053:
+	.string	"IO_t"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF978:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1181:
+	.string	"irqPin"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF928:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1046:
+	.string	"int16_t"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1187:
+	.string	"ALIGN_DEFAULT"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1031:
+	.string	"GYRO_LPF_NONE 7"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1137:
+	.string	"DEVHW_BMP280"
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF975:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF984:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF1209:
+	.string	"temperatureFn"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1220:
+	.string	"sampleBuffer"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF976:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1217:
+	.string	"dataReady"
+.LASF1015:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1199:
+	.string	"busDev"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1249:
+	.string	"fakeGyroSet"
+.LASF940:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1007:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF886:
+	.string	"USE_VCP"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1148:
+	.string	"DEVHW_IST8310_1"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1085:
+	.string	"OWNER_SPI_PREINIT"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1165:
+	.string	"DEVHW_VL53L0X"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF972:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1139:
+	.string	"DEVHW_MS5607"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF936:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF1175:
+	.string	"devicePtr"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1124:
+	.string	"DEVHW_ADXL345"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1195:
+	.string	"CW270_DEG_FLIP"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1246:
+	.string	"temperatureData"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1212:
+	.string	"exti"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1192:
+	.string	"CW0_DEG_FLIP"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF1243:
+	.string	"fakeAccRead"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1138:
+	.string	"DEVHW_MS5611"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1214:
+	.string	"gyroADCRaw"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1071:
+	.string	"OWNER_SDCARD"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1075:
+	.string	"OWNER_OSD"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF959:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1196:
+	.string	"sensor_align_e"
+.LASF1250:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1043:
+	.string	"long int"
+.LASF1140:
+	.string	"DEVHW_LPS25H"
+.LASF1016:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1117:
+	.string	"BUSTYPE_NONE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF961:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1063:
+	.string	"OWNER_ADC"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1061:
+	.string	"OWNER_SERVO"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1094:
+	.string	"RESOURCE_NONE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1126:
+	.string	"DEVHW_LSM303DLHC"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1034:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1025:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1230:
+	.string	"head"
+.LASF1104:
+	.string	"RESOURCE_I2C_SDA"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1070:
+	.string	"OWNER_I2C"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1072:
+	.string	"OWNER_FLASH"
+.LASF1115:
+	.string	"_Bool"
+.LASF1223:
+	.string	"sensorGyroReadDataFuncPtr"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1218:
+	.string	"sampleRateIntervalUs"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1009:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1240:
+	.string	"fakeAccDetect"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1089:
+	.string	"OWNER_AIRSPEED"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1206:
+	.string	"sensorAccReadFuncPtr"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF965:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF916:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1037:
+	.string	"signed char"
+.LASF956:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1047:
+	.string	"uint8_t"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1098:
+	.string	"RESOURCE_TIMER"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1078:
+	.string	"OWNER_INVERTER"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1032:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1228:
+	.string	"gyroSampleBuffer_s"
+.LASF1234:
+	.string	"gyroSampleBuffer_t"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1213:
+	.string	"scale"
+.LASF992:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1033:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1116:
+	.string	"BUSTYPE_ANY"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF955:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF853:
+	.string	"USE_UART1 "
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF1221:
+	.string	"sensorGyroReadFuncPtr"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1005:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF945:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1125:
+	.string	"DEVHW_MMA8452"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF908:
+	.string	"NOINLINE "
+.LASF999:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1198:
+	.string	"accDev_s"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF1021:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1133:
+	.string	"DEVHW_BMI160"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF476:
+	.string	"__P(args) args"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF841:
+	.string	"NULL"
+.LASF1188:
+	.string	"CW0_DEG"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1168:
+	.string	"DEVHW_M25P16"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1142:
+	.string	"DEVHW_BMP388"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1194:
+	.string	"CW180_DEG_FLIP"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1064:
+	.string	"OWNER_SERIAL"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1167:
+	.string	"DEVHW_PCA9685"
+.LASF1242:
+	.string	"gyro"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1013:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1057:
+	.string	"OWNER_PWMIO"
+.LASF1041:
+	.string	"__uint16_t"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF986:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1065:
+	.string	"OWNER_PINDEBUG"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF921:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1207:
+	.string	"sensorGyroInitFuncPtr"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF806:
+	.string	"_SIZE_T "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF804:
+	.string	"__size_t__ "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF941:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1018:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1120:
+	.string	"BUSTYPE_SDIO"
+.LASF1178:
+	.string	"flags"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1147:
+	.string	"DEVHW_IST8310_0"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1028:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF1224:
+	.string	"sensorGyroInterruptStatusFuncPtr"
+.LASF1211:
+	.string	"updateFn"
+.LASF1060:
+	.string	"OWNER_MOTOR"
+.LASF1055:
+	.string	"extiHandlerCallback"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF977:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1173:
+	.string	"extiCallbackRec_s"
+.LASF1054:
+	.string	"extiCallbackRec_t"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1176:
+	.string	"busType"
+.LASF1130:
+	.string	"DEVHW_MPU6000"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1114:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF822:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF1132:
+	.string	"DEVHW_MPU6500"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1238:
+	.string	"fakeGyroADC"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF917:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1229:
+	.string	"samples"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF1012:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF927:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1038:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1201:
+	.string	"readFn"
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF970:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1011:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1103:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1151:
+	.string	"DEVHW_MAG3110"
+.LASF995:
+	.string	"DMA_NONE (0)"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF953:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF924:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1008:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF922:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1110:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1111:
+	.string	"RESOURCE_ADC_CH3"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF982:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF759:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1233:
+	.string	"enabled"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1216:
+	.string	"requestedSampleIntervalUs"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1044:
+	.string	"__uint64_t"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1244:
+	.string	"fakeGyroInitStatus"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1080:
+	.string	"OWNER_LED"
+.LASF1036:
+	.string	"long unsigned int"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1091:
+	.string	"OWNER_PINIO"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1042:
+	.string	"__uint32_t"
+.LASF1101:
+	.string	"RESOURCE_UART_TXRX"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF1179:
+	.string	"param"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1003:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF932:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF954:
+	.string	"EXTENDED_FASTRAM "
+.LASF1222:
+	.string	"sensorGyroUpdateFuncPtr"
+.LASF1105:
+	.string	"RESOURCE_SPI_SCK"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF23:
+	.string	"_LP64 1"
+.LASF920:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1087:
+	.string	"OWNER_TEMPERATURE"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1153:
+	.string	"DEVHW_LM75_0"
+.LASF1154:
+	.string	"DEVHW_LM75_1"
+.LASF1155:
+	.string	"DEVHW_LM75_2"
+.LASF1156:
+	.string	"DEVHW_LM75_3"
+.LASF1157:
+	.string	"DEVHW_LM75_4"
+.LASF1158:
+	.string	"DEVHW_LM75_5"
+.LASF1159:
+	.string	"DEVHW_LM75_6"
+.LASF1160:
+	.string	"DEVHW_LM75_7"
+.LASF1099:
+	.string	"RESOURCE_UART_TX"
+.LASF1231:
+	.string	"tail"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF942:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1096:
+	.string	"RESOURCE_OUTPUT"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF918:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1191:
+	.string	"CW270_DEG"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF950:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1066:
+	.string	"OWNER_TIMER"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF966:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1107:
+	.string	"RESOURCE_SPI_MISO"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1123:
+	.string	"DEVHW_BMA280"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF923:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1162:
+	.string	"DEVHW_MAX7456"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1074:
+	.string	"OWNER_BEEPER"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF973:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1225:
+	.string	"gyroSample_s"
+.LASF1227:
+	.string	"gyroSample_t"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF968:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1150:
+	.string	"DEVHW_QMC5883"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF1052:
+	.string	"ioTag_t"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1203:
+	.string	"ADCRaw"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1024:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF989:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1202:
+	.string	"acc_1G"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1035:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1210:
+	.string	"intStatusFn"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1069:
+	.string	"OWNER_SPI"
+.LASF1095:
+	.string	"RESOURCE_INPUT"
+.LASF1067:
+	.string	"OWNER_RANGEFINDER"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1088:
+	.string	"OWNER_1WIRE"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1237:
+	.string	"accDev_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1232:
+	.string	"overflowCount"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF934:
+	.string	"BIT(x) (1 << (x))"
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF1082:
+	.string	"OWNER_TX"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF993:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF981:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF1108:
+	.string	"RESOURCE_SPI_CS"
+.LASF1017:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1197:
+	.string	"sensorAccInitFuncPtr"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1026:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF991:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1122:
+	.string	"DEVHW_NONE"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1183:
+	.string	"busDevice_s"
+.LASF1186:
+	.string	"busDevice_t"
+.LASF1169:
+	.string	"DEVHW_UG2864"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF843:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1059:
+	.string	"OWNER_PPMINPUT"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF713:
+	.string	"USE_NAV "
+.LASF1102:
+	.string	"RESOURCE_EXTI"
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1215:
+	.string	"gyroZero"
+.LASF1143:
+	.string	"DEVHW_DPS310"
+.LASF1045:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1164:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1079:
+	.string	"OWNER_LED_STRIP"
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1241:
+	.string	"fakeGyroDetect"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1109:
+	.string	"RESOURCE_ADC_CH1"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1100:
+	.string	"RESOURCE_UART_RX"
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1056:
+	.string	"OWNER_FREE"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1245:
+	.string	"fakeGyroReadTemperature"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF957:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1113:
+	.string	"RESOURCE_RX_CE"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF1014:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF1136:
+	.string	"DEVHW_BMP085"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1022:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF946:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF987:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1219:
+	.string	"gyroAlign"
+.LASF1251:
+	.string	"fakeAccInit"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF944:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF919:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF971:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1093:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1073:
+	.string	"OWNER_USB"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF937:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF1010:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF939:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1048:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1166:
+	.string	"DEVHW_MS4525"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1092:
+	.string	"OWNER_IRLOCK"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF1200:
+	.string	"initFn"
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1001:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF915:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF821:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1247:
+	.string	"fakeGyroRead"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1226:
+	.string	"timeUs"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1184:
+	.string	"descriptorPtr"
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1163:
+	.string	"DEVHW_SRF10"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF983:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1019:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF1141:
+	.string	"DEVHW_SPL06"
+.LASF979:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1131:
+	.string	"DEVHW_MPU6050"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1004:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1039:
+	.string	"__int16_t"
+.LASF758:
+	.string	"USE_STATS "
+.LASF1144:
+	.string	"DEVHW_HMC5883"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1083:
+	.string	"OWNER_RX_SPI"
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1128:
+	.string	"DEVHW_L3G4200"
+.LASF1252:
+	.string	"fakeGyroInit"
+.LASF1149:
+	.string	"DEVHW_IST8308"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1020:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1030:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF1235:
+	.string	"float"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF997:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF948:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF931:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF969:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF820:
+	.string	"_SIZET_ "
+.LASF960:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF1106:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1127:
+	.string	"DEVHW_L3GD20"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1185:
+	.string	"scratchpad"
+.LASF1172:
+	.string	"devHardwareType_e"
+.LASF1121:
+	.string	"busType_e"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF885:
+	.string	"USE_ADC"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF963:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1171:
+	.string	"DEVHW_IRLOCK"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1027:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF851:
+	.string	"USE_MAG "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF988:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1040:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1050:
+	.string	"uint64_t"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1006:
+	.string	"SPIDEV_COUNT 4"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF951:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF980:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF952:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1193:
+	.string	"CW90_DEG_FLIP"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1174:
+	.string	"busDeviceDescriptor_s"
+.LASF1182:
+	.string	"busDeviceDescriptor_t"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1076:
+	.string	"OWNER_BARO"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1170:
+	.string	"DEVHW_SDCARD"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF974:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF933:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF949:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF852:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF929:
+	.string	"EXPAND_I(x) x"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1239:
+	.string	"fakeAccData"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF994:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF938:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1062:
+	.string	"OWNER_SOFTSERIAL"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1205:
+	.string	"accAlign"
+.LASF1086:
+	.string	"OWNER_COMPASS"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1097:
+	.string	"RESOURCE_IO"
+.LASF1023:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF998:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF996:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF967:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1049:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1118:
+	.string	"BUSTYPE_I2C"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1119:
+	.string	"BUSTYPE_SPI"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF990:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF376:
+	.string	"unix 1"
+.LASF1204:
+	.string	"imuSensorToUse"
+.LASF1051:
+	.string	"timeUs_t"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1084:
+	.string	"OWNER_VTX"
+.LASF1161:
+	.string	"DEVHW_DS2482"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1134:
+	.string	"DEVHW_ICM20689"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1000:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF757:
+	.string	"USE_LOG "
+.LASF1081:
+	.string	"OWNER_RX"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1248:
+	.string	"fakeAccSet"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF985:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF943:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1177:
+	.string	"devHwType"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF930:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1002:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF964:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1058:
+	.string	"OWNER_PWMINPUT"
+.LASF947:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1145:
+	.string	"DEVHW_AK8963"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1129:
+	.string	"DEVHW_MPU3050"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF935:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1077:
+	.string	"OWNER_MPU"
+.LASF1189:
+	.string	"CW90_DEG"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1270:
+	.string	"io_types.h"
+.LASF1287:
+	.string	"long-double.h"
+.LASF1293:
+	.string	"platform.h"
+.LASF1295:
+	.string	"target.h"
+.LASF1281:
+	.string	"libc-header-start.h"
+.LASF1279:
+	.string	"stdbool.h"
+.LASF1263:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1305:
+	.string	"dma.h"
+.LASF1267:
+	.string	"stdint-intn.h"
+.LASF1272:
+	.string	"axis.h"
+.LASF1262:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1265:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1288:
+	.string	"stubs.h"
+.LASF1276:
+	.string	"accgyro.h"
+.LASF1258:
+	.string	"src/main/target/SITL"
+.LASF0:
+	.string	"./src/main/drivers/accgyro/accgyro_fake.c"
+.LASF1285:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1261:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1302:
+	.string	"bus_i2c.h"
+.LASF1283:
+	.string	"features-time64.h"
+.LASF1266:
+	.string	"types.h"
+.LASF1257:
+	.string	"src/main/drivers"
+.LASF1264:
+	.string	"/usr/include"
+.LASF1271:
+	.string	"exti.h"
+.LASF1253:
+	.string	"src/main/build"
+.LASF1297:
+	.string	"sanity_check.h"
+.LASF1303:
+	.string	"rcc_types.h"
+.LASF1282:
+	.string	"features.h"
+.LASF1294:
+	.string	"common.h"
+.LASF1290:
+	.string	"typesizes.h"
+.LASF1254:
+	.string	"src/main/common"
+.LASF1255:
+	.string	"src/main/config"
+.LASF1291:
+	.string	"time64.h"
+.LASF1268:
+	.string	"stdint-uintn.h"
+.LASF1259:
+	.string	"src/main/target"
+.LASF1299:
+	.string	"utils.h"
+.LASF1274:
+	.string	"bus.h"
+.LASF1304:
+	.string	"bus_spi.h"
+.LASF1277:
+	.string	"accgyro_fake.c"
+.LASF1260:
+	.string	"src/main"
+.LASF1269:
+	.string	"time.h"
+.LASF1306:
+	.string	"accgyro_fake.h"
+.LASF1275:
+	.string	"sensor.h"
+.LASF1292:
+	.string	"wchar.h"
+.LASF1256:
+	.string	"src/main/drivers/accgyro"
+.LASF1286:
+	.string	"cdefs.h"
+.LASF1280:
+	.string	"stdint.h"
+.LASF1301:
+	.string	"build_config.h"
+.LASF1296:
+	.string	"stddef.h"
+.LASF1289:
+	.string	"stubs-64.h"
+.LASF1284:
+	.string	"wordsize.h"
+.LASF1298:
+	.string	"common_post.h"
+.LASF1300:
+	.string	"parameter_group.h"
+.LASF1273:
+	.string	"resource.h"
+.LASF1278:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 \314\035\004"
+	.string	"\242\206\031%\240)\215\001\240\326\247\306F\312b\313]t\313\364\2155>7\3203"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\326w\333{o\271\267L[\006\251\267\365\267\356\336\365@\013\r\340}\373\331\277\353W\303T\211\f\023\227V% K\2441u\215\314F\260+Wry0T\272\307q\016\372\006\b\212\342\363t\016\003\261\0201)'\304\310\2210!\001\013"
+	.ascii	"U\371d\227\017,C*\267\253\306@\033\310\f\020\250\253\341^\231"
+	.ascii	"\002\006m"
+	.text
+	.section	.gnu.lto_.ipa_sra.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 hM\002"
+	.string	"4\003\\"
+	.string	"\n"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\005\001\001"
+	.string	"\003\003\002"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\020"
+	.string	"\007\003\004\005\003\005\001\001\006"
+	.string	"\003\b\003"
+	.string	""
+	.string	""
+	.string	"\001\t"
+	.string	"\003\n\013\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\b"
+	.ascii	"9e\034\305tWJ\200\341\230F\3244\245b\317\006\260"
+	.text
+	.section	.gnu.lto_.inline.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`v"
+	.string	"\245\003"
+	.string	"\002\004\016\030\2405\351\377\347\252\300\027\352\220\323\226\376\377\377\203\330F\315\251\265-w\n\033F\234ca\220\365\230\206\"\004f\351c\200_\207\271\236\345\223\266\200\347\027b\333\332\237\013\t\027"
+	.ascii	"#\013\005\\w\224c\226@\0048n\315\342\2434\003\216m\r\272+\354"
+	.ascii	"\315b\216v\235\211!\031@\212\243\344Y\002aG\275vS\262K\350\231"
+	.ascii	"\2476-\343\346\300\005p\003"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 h-\002"
+	.string	"\364\002\\"
+	.string	"\n"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\002\001\001\001\003\177\002\002\003\002"
+	.string	"\002\013\004\005\003\006\003\b\003\001\001\001?\177\002\f\t\002\n\013\001\001\003\177\002\003"
+	.string	"\b"
+	.ascii	"@bN\301t\323\207:Ti\214'\316e\216\265\001,"
+	.text
+	.section	.gnu.lto_.pureconst.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\200\004\001\232\004\003\200\004\004\200\004\005\200\004\006"
+	.ascii	"\232\004\b\230\004\t\232\004\n\230\004\013\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`i"
+	.string	"=\005"
+	.string	"\322\206\026\037\260'\035\f \324\245\314\021\006`L\034\346`\225\3376u\267F\324\335\232\272\265\335V\246\224\002\344\365\370\373\301\264\301pQ!$\374\317_>\037\353?\211\361_\213\244h\302>\204\323b4\240\200fm\332(\350"
+	.ascii	"\354\242\231-\005aY\036ZpipI\006\"-]&\254#$ \340\002\261\251"
+	.ascii	"\036D\"\330\243\333\021\314 r\305\215\0312O\262c\366\r\353\241"
+	.ascii	"\3421\344\234c\330\004\024b)\303\220\324\260\302\350\372 \303"
+	.ascii	"~\f\314\273\2035\312\201-\330s/\306>\302\233\345\024\270#\037"
+	.ascii	"B\205*\277\202\272\001"
+	.text
+	.section	.gnu.lto_.lto.a55517828c4b1e3b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeGyroInit.17.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\205\007"
+	.string	"B\21645`o\032\003pH\b0tZ\350\351qG\312IQ\323)@\347\\\307\222Y\336\243\356\213\352\257\275O("
+	.string	"65v\237h\312i\220\227\b@\002Y\"\267\224)\005=\030\211F\",\024\262\006\252bV\026q=4h\363\002\002\303.Y\232\231\005i:\310\t\322%!\261Y\222VA5\212l\312\nM\233\322\323\335\325!\327\230z\311\200\032\005y\300\374\315\264\235\351\301\217\326\325\377\027r\355\353\260\b\270\374\03454\177\211+\"m\355i?-\n~\255GL\262\271\004\303\001?\227\242\362w\006E\3408\2663h\343\310\361g\343\330\255\215q\027\362\004\224\215\023\231\377\022\202x\363\333j\233\270sB\231\374"
+	.string	"\026\376\367\235P\035.t[\202\266\fmS\001\n"
+	.ascii	"@\004Nv\276\362Of\365\347-\206[a.\230|\253\321\343\016/\332I"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_fakeGyroSet.18.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`\002\001}\013"
+	.string	"\006\224KD\020\351(\035"
+	.string	"O\300J\310\\\001\243\316?\370\301ozZ\363\346\323\350\002i\177\027*P\036\270!\341\177\234/(\254\342\2069fXl\005\300"
+	.string	""
+	.string	"\250*\343\275Ay\\W\200\004\231ny\322*\331d\357\224\0025"
+	.string	"7"
+	.string	"8"
+	.string	"\273#Wx^\033\036\362^\347A\336\253I\033\202h\205A\001\013-\302\356~T\346\344'\351\237\300\027^\260\326\247\302\305\356z\276`.7\275m\b\333\032\366S\002\273k\032\263?\373\275\227\177w\331?=\237Z\310\266\333\222\233\260\270\312\300\306\366?6\250\300\354A\306\200\362\206\341y\005\345X\314i?\300\005\220\227\261\\wa"
+	.string	",\330\024\301\023\334\334\300\323\351F?`"
+	.string	"gR\333\022\267\261\034fv\227\302\247\275F\342\327\274\332d\234\177\275\372\243\367\372@\363\342\2329\207n\034\354\224`\227\255Ic\354w\033(\037\357\211\223\351d\002K%\222\350\344\006I\251\017T\307F(\216\036 \210\372Vb\252D%r|!*\024\310\007\212\253\217\024\341P$%~#a(~\237r\337-\215\271\356\340\\T\305^\033"
+	.ascii	"5\245\377\312?\231\325\200t1\276\310j\326\200\370\264r(Yv\300"
+	.ascii	"\036h\006\226\003\261L\305\001\354\315\254\032\024\027\206x\030"
+	.ascii	"\n\f\003C\300\034\b\f\030\001\343^\250)\341\016/\332I\006"
+	.text
+	.section	.gnu.lto_fakeGyroRead.19.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`s\001\035\r"
+	.string	"\226\026TD\020q\224\016\360\302J\322\241\302\020\001cB\031\203b\021\003E\323M\321\355S\364\021E!\002\255,\377\r\333\326im\304\302\344c\335\262\f(\002"
+	.string	"\214\324nkW\345\375m"
+	.string	"XaQ\326\353Gn+eJ\001>"
+	.string	"<"
+	.string	"C"
+	.string	"\033r\234"
+	.string	"\363\350\360Z\366\210\271&{\264\355\003\240\225\301\207\036<D1\\\"7v\303M;\034|\202\376O<5\214\240Q\203\344\203\365\354X\260\273\316\327G\206[o{c\233\201}\033\001\333\302\262\211\303\016Y\251\034\354_vw\2550\373!\177\324\264j:5}"
+	.ascii	"\022\\#Zl\327#\226ceD\224\020\266Wv\306\326lP\220i\277\304M\254"
+	.ascii	"\036\242\272\200]X\311\311\006'\267\212J\252I\t\347$,RK\231q"
+	.ascii	"\0359\rX\261\351+>\004\"\250.\300\n\210*{T\223\027\213m\003W"
+	.ascii	"q\302\354\256\310G\361\024\237\017\362\350\n\251\374\353\321"
+	.ascii	"Oe\217\327\315\007\224V\306|\020\001\006\205>\241\017\347\361"
+	.ascii	"t\b\\\314uH\021F\017\032t\336\005\b\0347\332>\217d\241\3449\330"
+	.ascii	"&\224F\246\215\363\276\255S\300\035\005\222\267\241\272\316\333"
+	.ascii	"2\341\376\262\n\363\301LI\264\210h)\006k0T_\244\274\305]\004"
+	.ascii	"\" p\242)\324\016\020\201\306\316\027\377Vr\265Cv\330\327o\023"
+	.ascii	"H3X\206\260\240\301t\207\332\356\212\036\322,T\227\344p\2421"
+	.ascii	"b!\247\201g\330N]2\370w\362W\313J\306\237\266\031\213\333\033"
+	.ascii	"\317\004\324\270\306\263\220\334@t/\316\3532d"
+	.text
+	.section	.gnu.lto_fakeGyroReadTemperature.20.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`g"
+	.string	"}\t"
+	.string	"\206\221B<0\345(\035\036\354\025\273\201\201\256pp\210<6L\253\346\004\213\261\304\231\"M#6l\033G#\366E\276\356\360&\207XJ\"\205T\250\373\236-\223\300\0046\037\363\255&\204\354-S0"
+	.string	"2"
+	.string	"/"
+	.string	"\377\277"
+	.string	"R=\344\033\322b\210a\235\314t\337)A8\344\030\236\331\204cG\314\003&\305\265\342\030\340\320\335\217\033.\016\276\344\377\b\377G\377U\002"
+	.string	"\332\205c\201\375W\375\233\237\243!\222\027\025"
+	.string	"B\303\034\001M\024\343\317$\034SqI\212\007\272_-+\335W\341\r\032\346~\271\240cN\303\234\216\271\337g\347\346\377o\363\326\362u\016;92\023\301\220\031g\031\331\013\303z&\353H\373\357*\312\217\237\267\356\356\313\327\037S,\024\203Zw\253\026\024\244\017\325Z\200\324VS\251\202\002\007\205>\241\217\347\361t\016\266{\235JAG\021\237EMx\036\235'[/HVbV\220hiz\3664;\t\377L\325N0\r"
+	.ascii	"@\004Nv`\365Pj;Ha}\025\304,6\3155\317b\002\002\205\340\262G\250"
+	.ascii	"\211\257k>\001"
+	.text
+	.section	.gnu.lto_fakeGyroInitStatus.21.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"=\b"
+	.string	"\322\317:90s\322\001<u/*\302\255\300ZQD\243\266\306\022{vf\350=27D\rI\300\3707\222\274#\004\201\020\205\203\002*k\326c\207O\032\205\312\326\263!B\310\336)\005.\231H&R7\032m\006\230\273\315\253\340&\">\272A\321u\334DQO\343D%\346\305\211\263\230\035E\315-\301\037\206Gg\306\367\321)\262\355\272\307V\266\374P\223*/\224\016\351a-\004\347.\235\327\316F\037\273\246\242$\261\217\355\356Z\266\354(?T1\005<\273\253\240\237\265\311h\\\266A[d\013\3348\304h\177\345,\340[8\036\260\333\252\231\331\255\nn\b=s=\201\366,\364\001\355\231m/\224@\207\257&+\006 \025L\317n\235\262\344\341c\350\337\345\007)/#92\254\324#\300\303\356:\202\260Dny\333\b\266!l\237\004\t"
+	.ascii	"@\004Nv`\365\260e;0a\025\313Jt\341Gw0\363j'\031"
+	.text
+	.section	.gnu.lto_fakeGyroDetect.22.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`o\001\215\r"
+	.string	"\266WZF\360r\234\016HF\276y\242\004\260O\206\317\225\362Re8\252-\356X\271\354\334B\243\335\\\033B\261\246\205\362\300\272\013\334d\360G\b%jj\234\304a\261\3526r_\360\330\273T\334\006\243\303\370,\332\376\336)\005B"
+	.string	"C"
+	.string	"N"
+	.string	"(.\273\244\002;\320\\3\371\002\3335\315\tl\327l{\301\310e\361d\254\344)H\214P1wI\256\256\270x*\372G\371G\306\322#\346\206\t\311\351H\204\3355}\231\224\270\353m#\260=\301\376\217\327\374\326v\215\276\274L\214\3644G\3462\013\262t\210M\222\320\252\302~fw\327\025f\377\344\247"
+	.string	"\030\220&\020O\314n\311Ida\264\035-l\273\354\215= \345\001\245\366g\234\206\353'\255\013\330\205\005\235R\b\214\226\317`|\354\032\302y\232\"v\307\217M\3419\334\302)\315\027\025,\034(M\307\321U\026\231\227\352\304\276\3338\275\240@\245\f\224\252\253\200\264\b]9\301c\303\252\023\333\035\377\262;<\345\203fw\033\3705@\260\002\224,\002\036\221D$\221\027\n\201<\031{\240/\325a0\201!\353\344y\035\267\n?\017\250\360\002\227\001\325\2518/\\q\240\004\0065|!\307\001\004Cnc\333\344>\263\025\346\213[\2251s1\326\020\246+1^\332l\t\327Q\n\035"
+	.string	"@\004Nv`\365Phw@\\K=\305\316\020\322\300\270\\\033\323c\257\205\2064`\\0\b\310\bH\b\b\003#\203\214"
+	.ascii	"=\360\030\300\031d\304\252\204\271\032r\327\033\255\214\315q"
+	.ascii	"\215\226\360\020\361u\315'"
+	.text
+	.section	.gnu.lto_fakeAccInit.24.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`\""
+	.string	"\235\007"
+	.string	"\242\31655Pu\032\003"
+	.string	"\240\212\371\217\322S(]\343b(\340\311o\336\362\266S\326\016\004\217fm\210\030\233\274H\"\205i\2663C\263\213L\351\303\2750\322v7)S\nU \215H#)\022a\005Rf\260\022\323(2\t\210mjLH\231E\323\3242J3\"Z\224\262\212(\247)b\b\335.\264\0311\266m\306Pw{\016Uu\220\231\341\200\035},05\1779mwzp\244\265\347\377\013U\355\273bh\fn\376\217\035\235\317X/&m\035j\005V\f~\255O\214\3029e\303\001\277\252\305\345\357\022\272"
+	.string	"\262\325\316\004\227-\220\007.[\345Z\033w\253\177DJ<Vp\376GHb\316\217\253\255b"
+	.string	"T\352\344\367i\370\337\207J\201\270\320m\017\332>\264\r\t\t"
+	.ascii	"7\345\377\312?\231\325\242\2678n\005\272`\362\255F\203\273\274"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_fakeAccSet.25.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`\t\001\225\013"
+	.string	"VTLD\020\311*\0358\330\035\215"
+	.string	"\306A\223 \202\007\354\275\007G)\320\005,\257\202\233\"\n\354]\261\231\332\0326CV\303pE\r\233\267\004\005L\005\200 \022\265H\r\300\332H@\230\3726\222\3056\310&{\247\0245"
+	.string	"8"
+	.string	":"
+	.string	"\333\261\206\346\325\341\021\336\353\374\203\367j\322\236\360\322\265\227\275^f\025v\367\243\001N~\222\376eoP\255N\237\f\034\273\353\251Z\261nz\333\025\266A\354\247\002\273k\332\262\037\373\275\227\177w\330?5\036.\002\305\203\335\230\034nm\265\001\001\333\337\330\034V\f\302\007LY\363\320\274rvcN\373\005n\200<\314\344\272;\363b\260\033\036\255}\201\002;\360n]\347\t\020X\230\324\366\305\017\230 \\\273\233\341\317NS\361\007\274\232e\234W\275\372\243\367*!@\0065s\2364\n\022v\336\354\3624)"
+	.string	"\373\335\006.\037o\214\020(\004\002?\037\317D\313\rzF%\242\221\220P\034I@P\364\225\304\321\nI\024\371NH\"\223\017\024K\237\307\302!\312H\374R\302P\3746\345\276[\332r\307\005\033\212\246\034\033"
+	.ascii	"5\245\377\312?\231\325\207t1\276Hk\326\200\370\266rHYv\200\035"
+	.ascii	"8\006\254\003\206P\305\001\330U\255.\034\327\200x\030\n\f\003"
+	.ascii	"C\300\034\b\f\030\001\343^\250)\340./\332I\006"
+	.text
+	.section	.gnu.lto_fakeAccRead.26.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`w\001E\r"
+	.string	"FWVD"
+	.string	"s\224\016p\004\356\340\221rU\273\330\217\311\312\200\316d(BY?k\274\017\321\026%\202\032\034\020!dS\344\260\021;+%\334\022\bP"
+	.string	""
+	.string	"TY\273_\031\312I\030\203R\265\001x\002\333\270\255\224)\005@"
+	.string	"?"
+	.string	"D"
+	.ascii	"\273\341\307\245\315\243\303\017\310\0367\027\220=\332\366\202"
+	.ascii	"\021\313\340\303W\211\206\344\305\206\224\227\335PS\021\007\237"
+	.ascii	"\240\177\0257PB\007\216\0351\023\221\247\346\301\356:[&\034n"
+	.ascii	"\275m\004\266!\330\367\021\236\023 `\\6\201\330\241Hj\b\373\231"
+	.ascii	"\335]\253\313>\312\0375\255\232NM\037@\251\345\345G\001\225\335"
+	.ascii	"\222\230 \333\022YF\330f\331\034\273\323\303A\246}\024O\301:"
+	.ascii	"J\310;\273\256\330J\267\215\354Q=\244\312\210\361y\fF&\254\303"
+	.ascii	"\215+,\345y\031u\027\037\203\024U\027\340u\022\222=f\216\226"
+	.ascii	"\213m\005o\221\332\354n\003\177\305Y|\376\311\2431\254\362\255"
+	.ascii	"G\177\225=^\017\360`\031\311\030\007\036\221D$\021\027\n\201"
+	.ascii	"\bp\334\246\346@\246\n\333\204\b\235\247\201\002\307m\332\347"
+	.ascii	"\2312\234<\t\232\205\323\206\3228\357\323@\t\334]0y\232\252\353"
+	.ascii	"<\215\023\3563\253.\037\314\324\004\f\211\021%q\302>\250\326"
+	.ascii	"\240q\225\317X\t  p\242!\334\rg\362\177\361\317%WGd\007f)7\201"
+	.ascii	"4\2035\244u\032Tw\350vYw\273\267t\303\251`\032RB\203\237\261"
+	.ascii	"\335\252dq\237e\026\316\b\3019m2\026o\257\214\t\270q\215`a\331"
+	.ascii	"\001\t_\234\327\365\310"
+	.text
+	.section	.gnu.lto_fakeAccDetect.27.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"=\013"
+	.string	"\326\024OE\020\253*\035\300\027~\335-\250\375\230\224\034\377\372\306\332\001\013\363k\350z\234\273\276\004\302\254+\225\211\255a\254{\222\254dc\254\242\215$\251"
+	.string	"\n"
+	.string	""
+	.string	"`g\301\"U\371\302\242\240\002\003\256\344\326\030\t\332;\2459"
+	.string	"9"
+	.string	"@"
+	.string	">\317\371\356e\036\361\335\263\355\f\220\312\346\317\230\353/\024Vj\271\335\023\254\001n\236\232\376\025\274\242"
+	.string	"\006\013\027\034\274V\247\017\242\3355m\275X\356z\333\026\266=\354\213\002\347\212V"
+	.string	"\3661\273\273\2560\373\264\237~\034\267\\\006\212\b\273\256]\207\275y\023\006\330\276m\225\255\2617\017:(\265\237\3403\325i\251ova3\t\273'\20672\367\002\254\252bj\223}\364\331\343\033\2148\270\r\bH%\323k$\265\031\250@r\342\340vYo\331&g\200\222\331]\r\177A\n\n\"&\340\236\237\372\356Q\b\255\026\026\335YB\346\242\323\260\224\203\035\006\205>\241\217\350\361t&D1\254\026;c)\f\371 K\324H\024C\360T\216'\244\022\004\024!\205&P,O`\347\302\344\310X\202%$Y\202\032\333>\367\230\2550\337\374\352\001\035\201\017"
+	.ascii	"7\345\207\325C\216\355 \266\245\304\200\235\252\322\200q\301"
+	.ascii	"\300\240 \253&\340\n\222\273\312heB\376]&\276\256\371\004"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`\024"
+	.string	"e\003"
+	.string	"\244\004\020\001"
+	.string	""
+	.string	""
+	.string	"\002\021\177\030\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006\023\177\031\005\020\032\300\204\001"
+	.string	""
+	.string	"\003\002\024\177\033\025\177\034\002\030\177\035\032\177\036\005\027\037\022\177 \272\220\202\002\026\177!\031\177\"\033\177#"
+	.string	"\r"
+	.string	"\200\036\340\317N\002\300\215\227\t\b\234A\207l"
+	.ascii	"e\\U\023P\006 \324\037\350\240\203\351\004"
+	.text
+	.section	.gnu.lto_.refs.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375 Y\265\001"
+	.string	"\222\205\f\017\260\0254\007\f\303\340\2625\333\275\275I\222)*\263\207\005;4\205\346\264@X\261\263\025\331\035 \316S\236\277\n\2134\220NNXkX\337\205:\b"
+	.text
+	.section	.gnu.lto_.decls.a55517828c4b1e3b,"e",@progbits
+	.string	"(\265/\375`_\031\005s"
+	.string	"\252\272T)Q0\320J\352\245\307\320\355\3678\210\314-BW\200\004\020t\336\337\327\353\212b\241&3RM&s\037\221~e\235\326P\330\301\004V\354\204\003\356\215(\202[\366\207Uh \236\376%"
+	.ascii	"@\030\353G_\362\343 #\367\235\031\354\362\201!\331l\357\224R"
+	.ascii	"=\002\200\002\206\002\\9\007Q\362St\223#\211\\\316\257\020\211"
+	.ascii	"\235\f\305\246le#\3478pL\215\277\372\232\234(\225\016.J8\037"
+	.ascii	"\363\270n\333\311Y\304\320\217\256\251_\033\316\337\272;\347"
+	.ascii	"i\030\3436\367\246fEf2\253_\323\354\332\222a\2348\3411G\343n"
+	.ascii	"\335Y\350\177\f\305$\177\355'\342v4\270\235\r\267\247\341v3L"
+	.ascii	"\344Up\273\030\3661\236\346c\003\270\232*t\222\301x\350\222\320"
+	.ascii	"\265\371\302\355\003\260^\347\003\260\3557\340v:\017\334o\020"
+	.ascii	"+\345\351<Q\001\002\345W\367\362\036\365/\355^\334\254\0330\352"
+	.ascii	"\235b\006\313\371u/k"
+	.string	"\316C\367\002x\356\005\340`12\024c\327\366\030p\373q\310\267\344\024\337\236\23445<\234E\334L\216\305\321\342\346\240~\355\021\260Wq+>\346W\272\235\212C{u\262\314\315\234_\036uX\345\205\312\257\355Cl\217\017\261\335\001\036\341A\354\nu \326'{\020\373Hi\016\376\004\362\330\"\367k\373\263\333_\017s\247/s.\346\234A\354\246\256\204U\371\325\235\270\230\217\205\360'\355L\234\254q\206o~=\r\0261\371\253\007\017b\033\003\274c\324\336l\020\303l\324\217_\310\331C\260^W\347!X\"\017bY\007b\235IQ{\023 \026\251|s\217\n\315\342\344\346\327_\322\355_\016\026B5\336Xfg\316\257\317\356\2062\037B~\355\327\203X\354@l\2677uu\373\t5t{\220\327\255\212\320\355(0YX\301\314\372\340\201n\307\3005\340\352v\027\034lu{\006Z\335~\001\021"
+	.string	"\272\325\027Uj\267\312"
+	.string	"\325\332\255*\320\355\026\bu\264\273;t\253\002p\320l\267\252A\177\267\n\324\355G\272=\253\333\211t;V\2673\273}\331\355W\335^\325\355T\335.\325\355\307n\207\352\366\030\335.\243\273\261t7\006\335\356\323\355\037\272\035w{"
+	.ascii	"\335\276B\267{\320\335\316\356&\353v\235n\027v{\356v\030\272"
+	.ascii	"\373\202n\177\241\333]\350\366\026\272\235\205n\377\240\273\237"
+	.ascii	"\335\r\326\335\007t\267Yw\353\324\325\325\325u\377P\367j\324"
+	.ascii	"\r\224&Q6~\212\356\r\030\031_S\337\255\035\031\220\033g\232\212"
+	.ascii	"\032\206\004\300\t\rjz\342\351\241D\020\215\025\\\321M\315\264"
+	.ascii	"\271\233!3\002\256\254\026\225+\363,SD]H\265\250\334W\275\f<"
+	.ascii	"\267-\207"
+	.string	"\322\377\374 ?&\202h\3149\307\210\256\245ZTN\332\355f\330\242\374\215\323\275\223K\225o\236\352\321\232\372\224\247kq..u\346aREW~\245<\225\317\341\263\274\226\177\362V\336\371Q\276\312C\037\312\227\375\225\307\362S\236\314\307\376\351u\375\314\007B\366\3642\376T_\350\004@lLs\316\317\277\372\037Y\346\320\272\375\354\351b|\315\245\312,D\203\202\013\252\026\345\251zC%\344\200\265\271\212Q\253\321\304}\202\310\017\321\221\262\345`K\034\fO\370f\251\016R\244gN\376\375&/\366L|\354\303\036\254=\212Ki\207~\330\013y\032\\\352<\372r\306\350\303\036\353\207\270T\031A\224m\232\363Y\330g\375\227\b\242q\275RfJ\202\004\211\236#I\247\034v\326\306\001\303\2153\004\367\177u\377\f_\344\225\354\274\261\252\301\310\257I\2125\300\264\246\374\3328W\370mx\255\357\022A4R"
+	.ascii	"\026\235\346\374\266\203u\027\275\r\316\346O\336\360\315\302"
+	.ascii	"]\021\250ZT.\347|\303\343\340co\303{\365G=\222\026zI\220\020"
+	.ascii	"\332\211j\022\225\206]\235\f\376\255\347\362\2616\373\032\232"
+	.ascii	"Gf\254\255K\212\033\006o3\266W.\370\215\024\365\037a\351\330"
+	.ascii	"\330p\376\332S\206=\3445\312\016\335\027\332\0172i\217c\231\211"
+	.ascii	"i\223\004\177^\2630\210\351\377\350\245\033\017*\277\372\350"
+	.ascii	"\360<6\t[\342\036\317C\247LTn\373\265W*\334\353\361w i\373\261"
+	.ascii	"\306\252\225*\221)\231\255\030\372\225B3P\324\324)U\016\022\035"
+	.ascii	"O\266.\270U+\030\371I)\367j\243\006\232\004)\265+\262q\362\005"
+	.ascii	"G\277\224\177\265\241\255\371\365\217/\304[R\302\0327r\320\214"
+	.ascii	"\001\203u\243\335\271\316\3005\345\253\b\366\340@\254\361\247"
+	.ascii	"dhF\375\332j\024\356\247\373\032-\316\224<\322p\221\230\223\006"
+	.ascii	"6%n\330O\354n\300\310\275\250p=\204\030y\2417Q\352\240\362\302"
+	.ascii	"\317=[\314\350v\374\372\331\353X%nDd\024\367[\301#\034"
+	.string	"\210M#\244\222\025\223\374:\347c\336\306\335Z\350\315}\242\273\250\215O\235\215\372\006\035\24022/\320;\0320\320\224\r\033\352\021\347\234w6\244k\230\310e%\362F\253G\002\242T}\331\355\300@U\214T\242Zl\265F\2535T(Wf\225\314r\r\023\034\262\222j\250[5\266\n\325Ay|\262D}\3029\336\035T\352\223\352\244:\3372\343oQ\317\274d\320\022\006ww;\233\247p\336\f%\356\260\335\336\216\323>\324\315\343\252\033\320\335k\316=@\bo\026\236\t\362\306va\306\360\326#r\347,\\\"}\214o\223\2114\026\2311\270\261\311L\032\233L\341\033\243\303$23\2058/\223\3308\314\271\271\314I\235\227\231\363\313\024\342w\210\314\306\227\271\3641\026\231I7632\0273\362\307\230s27\231h\334\230\231Hcs\231\364\311\305/(c\234W\322\2678\311|\224\031\213\031G"
+	.ascii	"8\024\227H\251\361]:4g\241\323)#\2319_-\013\200\026\217\b\241"
+	.ascii	"D)\216\235\262\370\n\335\352H\004\262\314y\211Yj\364Z\306p\312"
+	.ascii	"y-\037Q\b]\370\346\234\2372Q\3509;\275\310\234\211\313\021\224"
+	.ascii	"K\027\363\204\314<\2718\274A\004\262\334q\".\237\262\327\017"
+	.ascii	"O\032\233@\226EeO\232[\231\370\n}+\2571\221\270)|\2631\347\354"
+	.ascii	"jx\326L\031#7T{\250\2310N\204\317\266\323\272\222\005\213\232"
+	.ascii	"\375\n\216X\027%\303:$/\f\233\022+t\305\325\215\023M\354\215"
+	.ascii	"\325\225\324\331\321M\267\301\3212\242\305\355\3279\\\246)\215"
+	.ascii	"z\341>\001\307\023z\310D\264\"[o\006\367Q\"\323\207{/\177\246"
+	.ascii	"\276P\374$6d\372\006\356\321x\0265\f\211\241\020\263\246q\317"
+	.ascii	"\346\345~\315\247\371\267W\343c\017\367a\372\335~\nV\365m8\304"
+	.ascii	"|\300\251pB\346D\241\365\200\373\034O\006\310\020\222\254\332"
+	.ascii	"p\222q\343am\266\b\376!\007b\377\214\031#c\256\256\374\332l\025"
+	.ascii	"\233\231Gs\346\2652\375f\3302\302,s\277\226\346\246\252L\353"
+	.ascii	"\327f\205ji/\305\013*\312\230\376\264\235\271\350\027*1\2744"
+	.ascii	"&T\254\210A\343\035\303d\346\257h\037&'n\355\315\227\034\376"
+	.ascii	"/\017\306\307\022x\351\027y\363\024s\303\355\t\260j]\235'\300"
+	.ascii	"6\316\032n\2343\334P\017\352\302\005G\311Z\022\344\327\337\262"
+	.ascii	"\3442\203\225\026\334.\r\303%U\213\312M\351\342`\322\fqMO\344"
+	.ascii	"x\035qn>\256\257u\333#\036\267u\341\363\255\350\340\372Z\267"
+	.ascii	"=\342\271\255\013\237o\305\017\007 X\034\255\320!\261\323>%`"
+	.ascii	"\373k"
+	.string	"K\300\215\"\005\003)T\244\260k\025\020\020A@\304\266\n\b\212\212 HQ\204;E\221\352\372|+>\370|=<A\021\222\317\327cY\327Mj\227H\350\375\332]\020\351\307\355\030%\020\b\"\355\270H8\370\242\225\241\344\262\301]R\257\215\261.)\365\334\325\37551\261@\201i\t\006\260\245\301\304\003la\300h\222`\307\r\"\265>%\035\032\355Q\260\211\204\n\\\245\237R\320\257ER\257\005\262=\267w\024\342\327\242\0056\271=`;CF\353\362\314h\002\216\370\265\b6\271=\327\205\373S\322\001\272\031\370~M/\230\200*L"
+	.string	"\"\210D\243=\372\265h\335^\322\214&\3341J\004\320L3Z\240\t\227\211\thB\007\330.%\375z\024"
+	.ascii	"\271?\030\037D\362\265\033\230\340\353\221\260\264\324c\341\243"
+	.ascii	"\344\246\320\256\355R\317\027\304A\241\267\001\213\243\025\035"
+	.ascii	"\230\200-\b\270\r\276`\342\300E\223\f%\236\213\244b\007c\306"
+	.ascii	"\222\352\"\251u\203m\323\t-0\304\022\023\223\004H8*$\365\332"
+	.ascii	"\rzn/)\307Ej\340\204\373Sj\302\301\027K=\032\300\326\375U\320"
+	.ascii	"\272\275\r\332\245\0312z\301\017-R\017\t\310\024\374\265A\336"
+	.ascii	"\257\004\245\245\0259.R\212\"\367\247\264k#\007P8\200\302GDT"
+	.ascii	"B\250\037x\200\305\210\027\030L\200}%Z\023z0\220\230\200*\224"
+	.ascii	"\340\363\365L\004\201-\r%`\222\211\237RO\206\t\0370h\242\204"
+	.ascii	"\002^K\374\246E\367\243\353j\247\215*\254\256\006\225\n\347\214"
+	.ascii	"\210\231\026.\365\370Ta6\240\331R\241\206"
+	.string	"(\271\362\257>K\216\034Q\227\037\276\262;\265\346\270\260\260O\\V\226\212%t\003\222\027\345\342\004\306\003\377x\021!\242\036?pm\251g\206XW80PV\220 *\226?\247\312\241\335\023'\333\021\032Z\305z4+,\305_U!\356T\233:\274\360\370U\235\301\2359a`\254\276\334\311\333z\313\022\376\332x\210}\272\214Ze2\3759\224\363\324\b$\3138\354\023\355\321C]\022%\311>Z]\276\215\034\371mW\006\377\\)\225\352\225#y\3270\221\223\241\325\253Ux\304J\026u\207\223#\335\233\272C\265\362\265)\033\25496\2631__\360\217\225\252*\365\350\006\335A\301?g\222I\225\352H\225\243U\252)cb\236~U\247\324\247\225\315\031/\263]\027\366\031b\324\252\324\230*\345\317\177\2630\202\035\250r\3414\312\"\r#3#\"2#I\222\016\342\n\020\b\303i\034\230\324\003\022"
+	.string	"5A\0232\252d\246 \251d?\346\006\251\004\234\220\247 \007\024K\354}\253\244\020zJ\226i\026\307\373\367\005U\234\310\336#\b\330t\337g\340\202R~\274\243\355\267\362\003\005\227/y\215\313F#\004\003\230\230!L\251\035\324sA)\372\273\241s\001\346\374$\023\3708\004\034"
+	.ascii	"\023\336J\362;DO\220\002e\240H\314Vz\357h50\330\276\332G\362"
+	.ascii	"1E0\237\200\202\byq\221j\006d\t\030\326\203?]\317\272\207t@["
+	.ascii	"3O"
+	.string	"`\265s\337r\020`\364\250=\255\240=\001\325\t\266_5O+tHk\370\253\267\007p\343\340~\302\265\225|\372q @{<\222\264[\254\212q\351\254\370s\035\272\354\321 \036\004>-\037\\\345\256\r\353\364E\317\373A\2620\324\301\001\206\243\336\357+N\307\220\260rc\324\324-\022\371L\202I\246\254\201\224-\360\023\231r\213r\231\005\rK\364\177ZK\252\3075%\321\262\356\325\325\027\364\203\202P\241\035\371qZ\020\221\301\f\352\212\244\351]\200\332\267\344\315\256X\251\r\345\026\253\221y*\327v\220\362\222+\017\253\272\327\022^\030\377@\334\204Q\352H\331\251E\202\221D\270^\314M\02465CK\t\255\202UJ\320\214\004\002k\265QV\220\347\372\263\n\206T\025&\253\261\200\205\240\206\232K\206}`\210\023\244\365\027\035Ta\237b\0227\025[%\201\213_\033\027\273_h-\303\366\031\370\034\007"
+	.string	"\212\304\022\n\n\365>1\202\032%\315\025\262~\016<|9yRa\302\227\214\301\tv\273xc\001\334A\202T(\0068Y\003P`\335\277\251\201ah5\3004\203\")RX\207\nv\001Dx4\007c5\247\350\026UO\325T\311\203veN|\1770\232\345\337\no\221\375c\270\n~\351\276\253r<m\313.\362"
+	.ascii	"o\373\0033\213o:#\212I\303\327\205_\177\364\265\254\371\273+"
+	.ascii	"\013\322/\237U?/\221\304\274\210\227@}\033)5Q\f\374\364\313\245"
+	.ascii	"\210\260?@F\271\263\0220J\272\020"
+	.string	"v\"1\030'\303M\205qFA\350L7&Y\037\345O\203\217q\223\214lk'\336\315\304\355|\304\023\017mz\024\205\272\252\305\217 /\364\370\333\354\362c\034\317\023;\217*\313\341\005(\007\200=\246\355kJ\033\271\256\016-\201\211)\200\330_\030\221\030\210\212\024\343\271\317\r\223\333w\351Y\260\334BD\034\251\313>\355\276\347\216K\314\363M(\335\375\257\033D\214\363\033\232\200\311\352\0064\\w)U9\r\374\241\260@\362\204\305\034\232e\177o\303\314k\022o\250\004\004\273qL\tDjj\227*7\233rx3\337\224\270Q\367\016H\2300\232\006\307\025\205$\354\353a\340BF\223\030z\245\276E\007H~\007F\022\217!A\"\b\026\247 \031\371\363\277{!\212\244S\362tt\211>\220B\fNCw+l\205\216L\364\024\265u\006\351r\260\234\n{*\302B#\325\234K\026U^\272\031g+"
+	.string	"\317\307dn\377\201\257\326.\217h\274W\023i\271)"
+	.ascii	"K\212Y\246\332\341'U\276\323\255^qE\206\306j\344M\336@\246\357"
+	.ascii	"\365s\300\263\343\230\034\367\023\254TF\231/g\316\266bn\214\217"
+	.ascii	"d\030\n5\310\b\\\nz\344M\225om \006\254\203^%1}\321\244s\365"
+	.ascii	"\030\247l\202\241\023\214BF\2447\213\253\236\037y\237z\337q\372"
+	.ascii	"\276\206i\370\2749\234\266w\372\020\251\306\326\t\336\201?\315"
+	.ascii	"\t\344o\342#\035\007\254\027\214\366\210\207\220\343\226\001"
+	.ascii	"\223q\306\035m\351\3158\314\353;q\213\264\372\244\317>7\202\235"
+	.ascii	"\202\253\360\253\314bc\242\316\372\377\240\271\264/\276B\266"
+	.ascii	"\201\300V"
+	.text
+	.section	.gnu.lto_.symtab.a55517828c4b1e3b,"e",@progbits
+	.string	"fakeGyroSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"fakeGyroDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"fakeAccSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"fakeAccDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a55517828c4b1e3b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
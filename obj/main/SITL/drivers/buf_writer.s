@@ -0,0 +1,4615 @@
+	.file	"buf_writer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/buf_writer.h"
+	.file 4 "./src/main/drivers/buf_writer.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	buf_writer.c.2e42f57c
+	.weak	buf_writer.c.2e42f57c
+buf_writer.c.2e42f57c:
+	.long	0x183
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xa
+	.long	.LASF710
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF692
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF693
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF694
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF695
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF696
+	.uleb128 0x3
+	.long	.LASF700
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF697
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF698
+	.uleb128 0xc
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF699
+	.uleb128 0x3
+	.long	.LASF701
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF702
+	.byte	0x3
+	.byte	0x15
+	.byte	0x10
+	.long	0x87
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0xd
+	.long	0xa1
+	.uleb128 0x5
+	.long	0x66
+	.uleb128 0x5
+	.long	0x66
+	.uleb128 0x5
+	.long	0x58
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF711
+	.byte	0x18
+	.byte	0x3
+	.byte	0x17
+	.byte	0x10
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF703
+	.byte	0x18
+	.byte	0x10
+	.long	0x7b
+	.byte	0
+	.uleb128 0x7
+	.string	"arg"
+	.byte	0x19
+	.byte	0xb
+	.long	0x66
+	.byte	0x8
+	.uleb128 0x6
+	.long	.LASF704
+	.byte	0x1a
+	.byte	0xd
+	.long	0x6f
+	.byte	0x10
+	.uleb128 0x7
+	.string	"at"
+	.byte	0x1b
+	.byte	0xd
+	.long	0x6f
+	.byte	0x11
+	.uleb128 0x6
+	.long	.LASF705
+	.byte	0x1c
+	.byte	0xd
+	.long	0xea
+	.byte	0x12
+	.byte	0
+	.uleb128 0xf
+	.long	0x6f
+	.long	0xf9
+	.uleb128 0x10
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF706
+	.byte	0x3
+	.byte	0x1d
+	.byte	0x3
+	.long	0xa1
+	.uleb128 0x8
+	.long	.LASF707
+	.byte	0x29
+	.long	0x119
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x29
+	.byte	0x22
+	.long	0x119
+	.byte	0
+	.uleb128 0x4
+	.long	0xf9
+	.uleb128 0x8
+	.long	.LASF708
+	.byte	0x21
+	.long	0x13c
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x21
+	.byte	0x23
+	.long	0x119
+	.uleb128 0x2
+	.string	"ch"
+	.byte	0x21
+	.byte	0x2e
+	.long	0x6f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF712
+	.byte	0x4
+	.byte	0x16
+	.byte	0xe
+	.long	0x119
+	.long	0x181
+	.uleb128 0x2
+	.string	"b"
+	.byte	0x16
+	.byte	0x25
+	.long	0x181
+	.uleb128 0x9
+	.long	.LASF709
+	.byte	0x2c
+	.long	0x58
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0x43
+	.long	0x7b
+	.uleb128 0x2
+	.string	"arg"
+	.byte	0x16
+	.byte	0x51
+	.long	0x66
+	.uleb128 0x12
+	.string	"buf"
+	.byte	0x4
+	.byte	0x18
+	.byte	0x12
+	.long	0x119
+	.byte	0
+	.uleb128 0x4
+	.long	0x6f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 22
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.file 7 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x8
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 9 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xa
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 13 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xf
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF623
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF628
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF691
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF713
+	.long	.LASF714
+	.long	.LASF715
+	.long	.LASF716
+	.long	.LASF717
+	.long	.LASF718
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x15
+	.long	.LASF0
+	.byte	0
+	.long	.LASF719
+	.byte	0x2
+	.long	.LASF720
+	.byte	0x2
+	.long	.LASF721
+	.byte	0x1
+	.long	.LASF722
+	.byte	0x1
+	.long	.LASF723
+	.byte	0x5
+	.long	.LASF724
+	.byte	0x6
+	.long	.LASF724
+	.byte	0x5
+	.long	.LASF725
+	.byte	0x2
+	.long	.LASF726
+	.byte	0x5
+	.long	.LASF727
+	.byte	0x5
+	.long	.LASF728
+	.byte	0x2
+	.long	.LASF729
+	.byte	0x2
+	.long	.LASF730
+	.byte	0x4
+	.long	.LASF731
+	.byte	0x2
+	.long	.LASF732
+	.byte	0x3
+	.long	.LASF733
+	.byte	0x3
+	.long	.LASF734
+	.byte	0x2
+	.long	.LASF735
+	.byte	0x2
+	.long	.LASF736
+	.byte	0x2
+	.long	.LASF737
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF635:
+	.string	"INT16_MAX (32767)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF393:
+	.string	"_STDINT_H 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF604:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF667:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF484:
+	.string	"__flexarr []"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF704:
+	.string	"capacity"
+.LASF668:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF633:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF383:
+	.string	"SITL 1"
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF694:
+	.string	"unsigned int"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF641:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF628:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF640:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF610:
+	.string	"__TIMER_T_TYPE void *"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF708:
+	.string	"bufWriterAppend"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF622:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF630:
+	.string	"INT8_MIN (-128)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF566:
+	.string	"__S32_TYPE int"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF611:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF651:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF703:
+	.string	"writer"
+.LASF709:
+	.string	"total_size"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF673:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF686:
+	.string	"UINT16_C(c) c"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF648:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF682:
+	.string	"INT16_C(c) c"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF691:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF652:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF664:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF649:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF603:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF621:
+	.string	"_BITS_TIME64_H 1"
+.LASF581:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF563:
+	.string	"_BITS_TYPES_H 1"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF618:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF584:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF507:
+	.string	"__wur "
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF592:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF579:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF627:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF595:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF661:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF631:
+	.string	"INT16_MIN (-32767-1)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF674:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF586:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF567:
+	.string	"__U32_TYPE unsigned int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF663:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF638:
+	.string	"UINT8_MAX (255)"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF665:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF613:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF605:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF634:
+	.string	"INT8_MAX (127)"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF617:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF658:
+	.string	"INT_FAST8_MAX (127)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF710:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF646:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF689:
+	.string	"INTMAX_C(c) c ## L"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF643:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF687:
+	.string	"UINT32_C(c) c ## U"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF675:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF612:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF660:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF699:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF655:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF701:
+	.string	"uint8_t"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF669:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF666:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF601:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF608:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF705:
+	.string	"data"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF625:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF632:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF712:
+	.string	"bufWriterInit"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF578:
+	.string	"__STD_TYPE typedef"
+.LASF587:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF564:
+	.string	"__S16_TYPE short int"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF23:
+	.string	"_LP64 1"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF593:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF589:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF568:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF647:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF681:
+	.string	"INT8_C(c) c"
+.LASF565:
+	.string	"__U16_TYPE unsigned short int"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF620:
+	.string	"__FD_SETSIZE 1024"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF461:
+	.string	"__PMT"
+.LASF571:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF683:
+	.string	"INT32_C(c) c"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF623:
+	.string	"__STD_TYPE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF577:
+	.string	"__U64_TYPE unsigned long int"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF574:
+	.string	"__SLONG32_TYPE int"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF650:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF645:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF626:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF596:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF619:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF508:
+	.string	"__always_inline"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF616:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF671:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF639:
+	.string	"UINT16_MAX (65535)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF678:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF685:
+	.string	"UINT8_C(c) c"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF679:
+	.string	"WINT_MIN (0u)"
+.LASF598:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF588:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF684:
+	.string	"INT64_C(c) c ## L"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF657:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF573:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF572:
+	.string	"__SWORD_TYPE long int"
+.LASF697:
+	.string	"short int"
+.LASF662:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF707:
+	.string	"bufWriterFlush"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF698:
+	.string	"long int"
+.LASF624:
+	.string	"_BITS_WCHAR_H 1"
+.LASF590:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF659:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF548:
+	.string	"__stub_stty "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF585:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF600:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF690:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF607:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF680:
+	.string	"WINT_MAX (4294967295u)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF676:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF576:
+	.string	"__S64_TYPE long int"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF700:
+	.string	"__uint8_t"
+.LASF599:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF575:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF471:
+	.string	"__P(args) args"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF695:
+	.string	"long unsigned int"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF656:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF374:
+	.string	"__unix 1"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF602:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF570:
+	.string	"__SQUAD_TYPE long int"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF358:
+	.string	"__k8 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF692:
+	.string	"unsigned char"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF636:
+	.string	"INT32_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF672:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF702:
+	.string	"bufWrite_t"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF629:
+	.string	"__intptr_t_defined "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF580:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF642:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF583:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF569:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF653:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF609:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF670:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF688:
+	.string	"UINT64_C(c) c ## UL"
+.LASF696:
+	.string	"signed char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF693:
+	.string	"short unsigned int"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF615:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF606:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF677:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF591:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF597:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF582:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF614:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF349:
+	.string	"__amd64 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF637:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF376:
+	.string	"unix 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF711:
+	.string	"bufWriter_s"
+.LASF706:
+	.string	"bufWriter_t"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF644:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF594:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF731:
+	.string	"long-double.h"
+.LASF733:
+	.string	"stubs-64.h"
+.LASF717:
+	.string	"/usr/include"
+.LASF737:
+	.string	"stdint-intn.h"
+.LASF725:
+	.string	"libc-header-start.h"
+.LASF715:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF736:
+	.string	"wchar.h"
+.LASF729:
+	.string	"timesize.h"
+.LASF720:
+	.string	"stdint-uintn.h"
+.LASF716:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF718:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF726:
+	.string	"features.h"
+.LASF735:
+	.string	"time64.h"
+.LASF713:
+	.string	"src/main/drivers"
+.LASF714:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF734:
+	.string	"typesizes.h"
+.LASF732:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF727:
+	.string	"features-time64.h"
+.LASF730:
+	.string	"cdefs.h"
+.LASF0:
+	.string	"./src/main/drivers/buf_writer.c"
+.LASF722:
+	.string	"buf_writer.c"
+.LASF721:
+	.string	"buf_writer.h"
+.LASF728:
+	.string	"wordsize.h"
+.LASF723:
+	.string	"stdc-predef.h"
+.LASF724:
+	.string	"stdint.h"
+.LASF719:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.text
+	.section	.gnu.lto_.icf.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 S\245\001"
+	.string	"$\002G"
+	.string	"\003"
+	.string	"\235\363\355\271\b\b\002"
+	.string	"\002\001\002\002\002\001\002\003\001\316\272\324\341\005\b\304\330\255\353\017\b"
+	.string	"\006"
+	.ascii	"+\004$E\224\317\003.\301\330\215\260\2016"
+	.text
+	.section	.gnu.lto_.ipa_sra.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 <5\001"
+	.string	"\3200"
+	.string	"\003"
+	.string	"\004"
+	.string	"\003\001\001\001"
+	.string	"\001\002\002"
+	.string	""
+	.string	""
+	.string	"\001\001\001\200\004"
+	.string	""
+	.string	"\001"
+	.string	"\004"
+	.ascii	"@4\315`\200N6\200\005"
+	.text
+	.section	.gnu.lto_.inline.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375`z"
+	.string	"-\006"
+	.string	"b\212\036%\220'I\007\377\377s\204\203w\337Z\332*+\033\226\325B\335\370\364\330\311\314\274\350Xn\2556H#mo)S\277<\374\021M\2346\253;\346\325\250\013\n\r\f\212\373\362\324\366"
+	.string	"HQ\256%\327\222k\001\016O35n\272\002d\320#\334\235\363\310J\235\312\362\003\225\317\204\232\007\310\250\301\306$\250\207;g1\177\240\3676\3103\275\273\263\372\255$gS\016w\227\276fA\035"
+	.string	"k\033D\321\222iZ\006As\0166\2662\331 +l\334\b\313\031\337\242\261F\037\254\231\013xr"
+	.ascii	"\270\333\223\217\2272b\226\311\t\363xap\327\2051R4\013\207\270"
+	.ascii	"/\004\021\0139\242\002\273\\\231\2459\r\f\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 \202e\002"
+	.string	"b\005\017\027\300%\035\377\257w\375\377\300R\357\377k\320\317\200\333\332\266\233\310$\003[\211\305\316\016O\256\330\347\035E\314?\367R_\212o%\231M\346\255f\311\037\260"
+	.string	"K\254\300~\376idF\004"
+	.ascii	"\006\341\270\234\005\022L^6\320\006"
+	.text
+	.section	.gnu.lto_.pureconst.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\001\232\004\002\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 \270\325\002"
+	.string	"\364\002\254"
+	.string	"\003"
+	.string	"\004\270\007"
+	.string	"\001\002\013"
+	.string	"\003\002\007"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\b\300"
+	.string	""
+	.string	"\200\001\b\020\220\001\220\210\001\b\b\001"
+	.string	""
+	.string	"\002\001\177\021"
+	.string	"Qm\222\264\001\f\026`\\!\220a\2727\206\025\210`)(\fZ%Xic(!/7.\006\276\264"
+	.ascii	"\034\204A\033"
+	.text
+	.section	.gnu.lto_.lto.da3489fb23e69777,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_bufWriterInit.0.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375`\264\001\335\017"
+	.string	"\026]jH\320\322(\035*\t\234\037\310\013-\252\216\362j\225\017\234\031\201e>@\355\255Q\002#\260{m\202@\271\301\227\214=\374\361\373\332\305\220eKY\017\261\324\326\0130?;\221\243\344C6\324\226&b\205>\311\347\266[\246\024Q"
+	.string	"W"
+	.string	"V"
+	.string	"\273'V\361>MH\372\003\252\376\306\303\007\354\322\304\300\355\216'\376\274O\333~\213\273\230\231V2\326\310DP\001\263\363cw\374<\336@\367\351\275@\367)Q\234v\245\371\367y\202\034\243[\314\313\265\224\262\273\326[\214\314-o[\201\355\224\255\b\002\347\371K\327\371\347o~\331\251\265S\237\244\344\203@nwD.\310\336\2303V\330\236\371>\036\321\"\320\356\241\245\330B\250"
+	.string	"\261\310\261;.\370t\005\035\002'\217\211l(\330"
+	.string	"I:\262\022\001\373!G\204\004\357S\203@\251\366\307\277\230\035\307A\026\3315A\003\267\001\007Q\302\2469\233\344%i\007f\b\220\273:\273u\234\013\200P\221QI\332-\227a\242"
+	.ascii	"6=\246\264_\377\221y\273\353\300\207\301A\003IM\212O\237\326"
+	.ascii	"}\236\206H\3244\347\023\017)\337\363\t35=\362I\007\216\325#{"
+	.ascii	"|Qy\302>i%\215}\234\337\024,\027\225d\021S\262\013;\264`+\027"
+	.ascii	"R\261W\314\344\325\203\006,\024\006!\n\352\200\352^\241\3040"
+	.ascii	"\326\022e+,\027\325\007\023\303\r-\321\302\207\241\225j\371V"
+	.ascii	"\"\354C\231\370\225!\024\277\330\353%~#\343\336\226\022\302L"
+	.ascii	"M\332|\022\242\322f9\220Kk\334v\\\350\256\356Re! \220\"1;\036"
+	.ascii	"\242C\203!C\331b\207%\0204\311\025\3533\2430\306\341\257\310"
+	.ascii	"4\034s\272\333\334\036FB\017#u\227\027fWo\327\300(0\263]0;\033"
+	.ascii	" \360\350f\327\232\357m\2308\270J\254\303\020O\034m\032\374\334"
+	.ascii	"\351\b\206\f"
+	.text
+	.section	.gnu.lto_bufWriterAppend.1.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375`n\001\205\016"
+	.string	"\346[bE"
+	.string	"\221(\035s\024\004@I\336\035x7\327\007\0023\f\326\242\372\314\255\207\202\005\307\033\027\025\251\230_\364Q\f\257#\236\313\002\360.\246mUUKS\002\205\361\216\314\260\352\357\273n\334B\325\225\337\356-eJ\001N"
+	.string	"G"
+	.string	"Q"
+	.string	"\256\0274\273\337\001k\331\243\277\207:\217\331\003t\036\335\3317\nh"
+	.string	"\315\260\260\310\261\273\232\222xw\250\331\371\217\371\307k\251\016=\\\241\001\234\232\034\220\026\013\206ZLx\217yrh\2552=\fv\327\351\265:\334\361\266\033\330~`\277&\271\303\376T\251/\366\341\356\256\325e\377\373?\207\375\036\230\206\232V\230N\230>\350\223#@\306nK\214\307\336\304\030'l\377\303N\024#\232\366\210\244\373\227\262\356\272\314p\220=\346k\344i?\305Ut\207\251\034\300n4X\251\303\266\311a@\r\331"
+	.string	"\361Q\333\031\356\"\005\362\332\335\005\366\3513\026\036\225"
+	.string	"\214\bUM\033\226\036\251-B^\367p\374\251\31655m6\270\2542f\033\365\025\251lw\023\3702')Y\211G_\245\363x\r\201\201\255d\314\241\01756\023J\351\222\002\222\222\021\202m$\032@\272K\"nC1q\030 \224\244\2204\024\267]0q\022\264\n\246\b&Z\211Ci\"\021\237N6NC9\2358\355\343\333\303U\227\343\210\233\025]APz\3246Q\310{\026a\251\312[\210\277t\340\320\250\276\030j*I&\033"
+	.string	""
+	.ascii	"\030\316\230\006 \033\001\332Z\240{+m\201l4\306-\2401)aX\220"
+	.ascii	"\335\035Ck@\b@#\2523E\031\002\313\2462M\252t\321j\004\255\261"
+	.ascii	"\271]c\303\302\020 \324\354q\207\247jr\212\246\366"
+	.text
+	.section	.gnu.lto_bufWriterFlush.2.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375`a\001\245\r"
+	.string	"\366\330XB \221\222\016sd!\361\311\027\242\004\t^\202\017>\032M%\310V\347\254"
+	.string	"\233\252\"B\336\r!\202m\353\260g\220\355\001\f\022\211\020@0PJ\374\353\314\r\200\r\236k}\304\237\312\222F\366\2262\245E"
+	.string	"@"
+	.string	"G"
+	.string	"#\232\024\273%\002\216\324\241K\367L\207\324\005L\207\336l\031\003(tX\264\310\324\330\335\250\032\276\375in>G\244\243\023q\177\030\256"
+	.string	"D,\357\263\273\207yZ\020\255drDv\327\331\211.\334\360V`\177&\352\301\201\244\2227\366|h\261y\303.q\251/\366\337\356\256ud\237\364SS\032\302\364{i\325tf\372UE\303\263b\327\345\006\307\326@\025\036l\277\262\323\245\300\323\276\210\217\330NJy\200\335\025\224\263m\235\3061:6 \033\240v^\220n\002\245\263\257\31788|\252.\272\fW\325\243h\311ac\227y\220\027\210\334]N\235M\327P\f\f\226\264a\233\344%2jw\021\370$J\"P\035\016\375\224\351\360\001\266\022\034\030\t1p\205\200@B\267\005\322\256\023L\233\260`\004%\024M\264K\002\2465\210%\030\003\222hi&\021\364q\006\341\322\342I\226i\261*\355\337\352\310\020\246FEW\236\276\304\374DFy|\330\314x\210\217T}\n\325\251\376\004  `\202Ar\345\003"
+	.ascii	"\030\016\323\210m\250\245-\037\355\2606\374\225\035\313\355\245"
+	.ascii	"a`\315\356(\2554x\276^s\217\310\316{\341\250+\177p\230A%\364"
+	.ascii	"\027\202_\365\024\227@\341\36028\366\003~\367\224\330\315\rX"
+	.ascii	"\250\334\213\233\037\024\034"
+	.text
+	.section	.gnu.lto_.symbol_nodes.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 c\r\002"
+	.string	"d\003_"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\177\f\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002\002\177\r\001\177\016\004\001\201\200\200\200\002\001\265\006\003\002\001\320\360\372\250\001\001\342\006"
+	.string	"\003"
+	.ascii	"\200\036\340\207k\3151"
+	.text
+	.section	.gnu.lto_.refs.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.da3489fb23e69777,"e",@progbits
+	.string	"(\265/\375`I\007\245*"
+	.string	"*K\244\020Gp\\\322p5\317\325\303\210\003j\213\364\224\036\360\022\0261\207\305\334\247I\237#\277HiC\fV\316p\267\235b\242\237\235\214\301\020\025\2731\355r\326kNO2\346`\"\232\321\310%\351\313\334V\242\332\211w\3332\005\327"
+	.string	"\375"
+	.string	"\366"
+	.ascii	"\351\201\352Q\2507\241>\204\312Y\274\205\257\204XK\2676\337\036"
+	.ascii	"\257\216\224:s\320\364\034\324\263\320\216\347Xhw\r\352\017\023"
+	.ascii	"\330\375p\201\335\317\316+=oi,\032\232\236\257\370\312\317T\330"
+	.ascii	"\212\233\2726\207\333Y\335\257\257\227\225\246G\0274\375\031"
+	.ascii	"\353\334\374%\024\275\315\247\333\252\273\203R2\2548O\320\224"
+	.ascii	"_5\211\224\0378\320\224\255\234\355\306\212\003\nM\377\206'\215"
+	.ascii	"\362\242\362DS\037\007\347*\037\320\354\242\243\352_.\260S\231"
+	.ascii	"\300\356?\326\330\263\371\363\363\331\3776rb\377\305h\261\371"
+	.ascii	"\037\366\377\013\214\004\357\347\270\377o\377\333\376?\377\233"
+	.ascii	"\3757\363\377\305\177\256\377Z\377\203\376\223\370_\366\277\314"
+	.ascii	"\177\262\377W\376\367\376\217\375O\347\346\346\346~V\177n\360"
+	.ascii	"\357x\002:(\254\274\276\335\375\324\354\312\335N/\262\233uS("
+	.ascii	"]F\363\204l^\037\2159X\246\353\343\304\272O]U\204\223\255\223"
+	.ascii	"\351\376\274\2628\247\232}W\236\352\264%Ru\256o\267\335\315n"
+	.ascii	"xq^\316\344\316|\351"
+	.string	"\220$}\264f\274u\346\231\2035#\324{\177\3500Rv6t\305\202\022\206\2269\031\017kyd\013\232>\201P\263\263\250*J\324O\360\302]]Q\260\200q\030\376\022\240\3536ZMM\340\302[\\\246\2740e\n[\375?0\356r\266 \266\375\360D\212[\367;\306cX\214\303\230\f_1\030{\235\2770\230\003\275/\3729\013\203\261\026\336\nb\273\211\f\021`\306E\313\034\271\356whhh\bh\210\367\206\312\032\227Oz\376\332J\321}\354\356\003<c^\236F\320\364\277\263\230\023\330!\225o\367\002\034\001\023d\r\232\236\206\312@/T\346j\362TY\261\261D\003L\255)\266\265\264*j=>yL5\036;\326\260W\317\323\222(,4e5l\306\244J\212\241)\247]Lz\245%J\rM9\rw\3610\225P=\330z\306(a\222\215\251G\377]\033\221\335\335\003\300\333]\254\317\031"
+	.ascii	"\217u\314\240uBH\272\205\244\301\355\304\226@\340\320\364\277"
+	.ascii	"\202\376\177\f\335#\332\343\022\351k\235\306\325\007\365.\223"
+	.ascii	"\255s\231\364\365\333\004\322N#\335\355\321]Qc\277\235\374\351"
+	.ascii	"\3432\251\266\321\255}\033\351\353\327\210lg7\367\022\331f\031"
+	.ascii	"W_\353\\\256\255\323M\372\332w\231\354c\257\352\261\331}t\223"
+	.ascii	"\276(\357\262[\2471\371\323:\335\025H\332\021\250\001t\216O3"
+	.ascii	"\355\261w \210rt\221e\355\353rW\367\232\345\324H~\273\227\335"
+	.ascii	"B\334\005]G&k\027[\266cGy|W\226\322\3012]\236\227\355\262\266"
+	.ascii	"\312u\341\324\235\326\001+\224\204KK\031z.\230\232^t\020\360"
+	.ascii	"`q\250\004\202\367\340\220(T\022\266PO\301\350\201\321\021\215"
+	.ascii	"\235\037!E@\212\260\373\021\322\357\207d\364So\364\323\025\357"
+	.ascii	"B\301c,\t\211D\305\0301\210D=\300\"pE\312\224D\354)&\235`\321"
+	.ascii	"\244\"\300\256\005\021\250\253Q\034\006\201K\300\240ZL:**\r\233"
+	.ascii	"v\212@\364\301\nE,$P\020J\200`\340\026,lPPB\204\0075\b\201(,"
+	.ascii	"\016\2113\222X4\251 b\"\ne\f\211+\210\224\206@\030DA\"\023\021"
+	.ascii	"\204\004q\336\320\254n\310\241)J\004\016\216\343\324\356\326"
+	.ascii	"u\023\3312\305U\032\313\023\3169\016Km\214\213\246\374\206\331"
+	.ascii	"\250\322d\221\332\002\300\204\263\306%\245\2426\334\334\370\355"
+	.ascii	"\247\331\2650\267];QK\2669\277\365(\221\002\243\342\036\0319"
+	.ascii	"\354\0224=\212CE\255\0340\032>;"
+	.string	"\243\035\215\333\324\267y\\`\302\203J\256\225\312\006;a6~4Q;\2671\033\212%\200\222\250\2614\245\030D\"\"\"\022D\322\244\031\003\220\002\221\261\3436\021\2401\203D\252$\245\3759\301\273\263gdeO\335\017\330\317\025_m\217\0343\033q\f\245T\261\334\275\226\226\222y\f/$\214\3277\2541\006\035\336OcO7\235\203\364\204\034\266G\215\275\t$\304\311\350\203\222\273\316[16\211T\204\213\b\261L\002*\030\356\022\372\230N\320\302\022\355\035\002\262u\nk\310\246\t}7$\230\326E\246\377S\032J\t#\n\024\336H\200,\217! ^?d\352\205V\271\216S\250n\320o\024\337\f6\fH\315\371$#]\311\021\375)\022\"\020\310 K\317\200\212_?s^\022\272\302|j\207\371\320\263\030\260Chj\277\353~1\036{\321\300\334$\212\200\270S\351\203.F6\034\301\220\377\f4"
+	.ascii	"!\365\031{N\357\020\276\252\332E\352=p\221\003\351\0010iYb\315"
+	.ascii	"*7l\365\347\207X\325\037\fL\331\375\344\214\026\366\356\377J"
+	.ascii	"\006l\321\261\217\367:/\335\365\013\221-,\352\3551\234u5\205"
+	.ascii	"\251\002"
+	.text
+	.section	.gnu.lto_.symtab.da3489fb23e69777,"e",@progbits
+	.string	"bufWriterInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356"
+	.string	""
+	.string	""
+	.string	"bufWriterFlush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362"
+	.string	""
+	.string	""
+	.string	"bufWriterAppend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.da3489fb23e69777,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12029 @@
+	.file	"bus.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/resource.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/drivers/bus.h"
+	.file 7 "./src/main/common/memory.h"
+	.file 8 "/usr/include/string.h"
+	.file 9 "./src/main/drivers/bus.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	bus.c.cdd5bb2b
+	.weak	bus.c.cdd5bb2b
+bus.c.cdd5bb2b:
+	.long	0x83f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x19
+	.long	.LASF1753
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.long	.LASF1594
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1588
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1589
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1590
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1591
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1592
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1593
+	.uleb128 0x4
+	.long	.LASF1595
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x4a
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1596
+	.uleb128 0x4
+	.long	.LASF1597
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1598
+	.uleb128 0x1b
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1599
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0xe
+	.long	0x87
+	.uleb128 0x4
+	.long	.LASF1600
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x8
+	.long	0x87
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1601
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1602
+	.uleb128 0xf
+	.long	0x51
+	.byte	0x4
+	.byte	0x16
+	.long	0x1a7
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1612
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1613
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1614
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1621
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1622
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1623
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1624
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0x25
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1641
+	.byte	0x4
+	.byte	0x3d
+	.byte	0x3
+	.long	0xb7
+	.uleb128 0x4
+	.long	.LASF1642
+	.byte	0x5
+	.byte	0x7
+	.byte	0x11
+	.long	0x87
+	.uleb128 0x4
+	.long	.LASF1643
+	.byte	0x5
+	.byte	0x8
+	.byte	0xf
+	.long	0x85
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1644
+	.uleb128 0xf
+	.long	0x51
+	.byte	0x6
+	.byte	0x32
+	.long	0x1fc
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1650
+	.byte	0x6
+	.byte	0x38
+	.byte	0x3
+	.long	0x1d2
+	.uleb128 0xf
+	.long	0x51
+	.byte	0x6
+	.byte	0x3a
+	.long	0x232
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1656
+	.byte	0x6
+	.byte	0x40
+	.byte	0x3
+	.long	0x208
+	.uleb128 0xf
+	.long	0x51
+	.byte	0x6
+	.byte	0x4b
+	.long	0x376
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1684
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1685
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1687
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x31
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1707
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x23e
+	.uleb128 0x14
+	.byte	0xa6
+	.uleb128 0x15
+	.long	.LASF1716
+	.byte	0x18
+	.byte	0x9f
+	.long	0x3f1
+	.uleb128 0x2
+	.long	.LASF1708
+	.byte	0xa0
+	.byte	0xc
+	.long	0x85
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1709
+	.byte	0xa1
+	.byte	0xf
+	.long	0x232
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0xa2
+	.byte	0x17
+	.long	0x376
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0xa3
+	.byte	0xd
+	.long	0x87
+	.byte	0x10
+	.uleb128 0x1c
+	.string	"tag"
+	.byte	0x6
+	.byte	0xa4
+	.byte	0xd
+	.long	0x87
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0xa5
+	.byte	0xd
+	.long	0x87
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0xb3
+	.byte	0x7
+	.long	0x382
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0xb4
+	.byte	0xd
+	.long	0x1b3
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1715
+	.byte	0x6
+	.byte	0xb5
+	.byte	0x3
+	.long	0x384
+	.uleb128 0xe
+	.long	0x3f1
+	.uleb128 0x14
+	.byte	0xbc
+	.uleb128 0x15
+	.long	.LASF1717
+	.byte	0x28
+	.byte	0xb7
+	.long	0x464
+	.uleb128 0x2
+	.long	.LASF1718
+	.byte	0xb8
+	.byte	0x23
+	.long	0x464
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1709
+	.byte	0xb9
+	.byte	0xf
+	.long	0x232
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0xba
+	.byte	0xe
+	.long	0x98
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1712
+	.byte	0xbb
+	.byte	0xe
+	.long	0x98
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1713
+	.byte	0xc9
+	.byte	0x7
+	.long	0x402
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0xca
+	.byte	0xa
+	.long	0x1bf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1719
+	.byte	0xcb
+	.byte	0x10
+	.long	0x469
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x3fd
+	.uleb128 0x8
+	.long	0x98
+	.uleb128 0x4
+	.long	.LASF1720
+	.byte	0x6
+	.byte	0xce
+	.byte	0x3
+	.long	0x404
+	.uleb128 0xe
+	.long	0x46e
+	.uleb128 0x1d
+	.long	0x3fd
+	.long	0x48a
+	.uleb128 0x1e
+	.byte	0
+	.uleb128 0xe
+	.long	0x47f
+	.uleb128 0x16
+	.long	.LASF1721
+	.byte	0xd5
+	.long	0x48a
+	.uleb128 0x16
+	.long	.LASF1722
+	.byte	0xd6
+	.long	0x48a
+	.uleb128 0x1f
+	.long	.LASF1723
+	.byte	0x18
+	.byte	0x6
+	.value	0x10e
+	.byte	0x10
+	.long	0x4d9
+	.uleb128 0x12
+	.long	.LASF1724
+	.value	0x10f
+	.byte	0xf
+	.long	0xa4
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1725
+	.value	0x110
+	.byte	0x15
+	.long	0x4d9
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF1726
+	.value	0x111
+	.byte	0xe
+	.long	0x98
+	.byte	0x10
+	.byte	0
+	.uleb128 0x8
+	.long	0x93
+	.uleb128 0x20
+	.long	.LASF1727
+	.byte	0x6
+	.value	0x112
+	.byte	0x3
+	.long	0x4a3
+	.uleb128 0x17
+	.long	.LASF1728
+	.byte	0x7
+	.byte	0x20
+	.byte	0x8
+	.long	0x85
+	.long	0x506
+	.uleb128 0xb
+	.long	0x22
+	.uleb128 0xb
+	.long	0x1a7
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1729
+	.byte	0x8
+	.byte	0x3d
+	.byte	0xe
+	.long	0x85
+	.long	0x526
+	.uleb128 0xb
+	.long	0x85
+	.uleb128 0xb
+	.long	0x3c
+	.uleb128 0xb
+	.long	0x22
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1732
+	.value	0x185
+	.long	0x1cb
+	.long	0x542
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x185
+	.byte	0x23
+	.long	0x542
+	.byte	0
+	.uleb128 0x8
+	.long	0x47a
+	.uleb128 0x18
+	.long	.LASF1730
+	.value	0x17a
+	.long	0x55f
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x17a
+	.byte	0x2c
+	.long	0x542
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1731
+	.value	0x16f
+	.long	0x577
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x16f
+	.byte	0x2a
+	.long	0x542
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1733
+	.value	0x154
+	.long	0x1cb
+	.long	0x5ab
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x154
+	.byte	0x21
+	.long	0x542
+	.uleb128 0x6
+	.string	"reg"
+	.value	0x154
+	.byte	0x2e
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1734
+	.value	0x154
+	.byte	0x3d
+	.long	0xa4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1735
+	.value	0x139
+	.long	0x1cb
+	.long	0x5eb
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x139
+	.byte	0x24
+	.long	0x542
+	.uleb128 0x6
+	.string	"reg"
+	.value	0x139
+	.byte	0x31
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1734
+	.value	0x139
+	.byte	0x40
+	.long	0xa4
+	.uleb128 0x9
+	.long	.LASF1726
+	.value	0x139
+	.byte	0x4e
+	.long	0x87
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1736
+	.value	0x11e
+	.long	0x1cb
+	.long	0x61f
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x11e
+	.byte	0x22
+	.long	0x542
+	.uleb128 0x6
+	.string	"reg"
+	.value	0x11e
+	.byte	0x2f
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1734
+	.value	0x11e
+	.byte	0x3c
+	.long	0x87
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1737
+	.value	0x103
+	.long	0x1cb
+	.long	0x65f
+	.uleb128 0x6
+	.string	"dev"
+	.value	0x103
+	.byte	0x25
+	.long	0x542
+	.uleb128 0x6
+	.string	"reg"
+	.value	0x103
+	.byte	0x32
+	.long	0x87
+	.uleb128 0x9
+	.long	.LASF1734
+	.value	0x103
+	.byte	0x47
+	.long	0x4d9
+	.uleb128 0x9
+	.long	.LASF1726
+	.value	0x103
+	.byte	0x55
+	.long	0x87
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1738
+	.byte	0xf3
+	.byte	0x5
+	.long	0x1cb
+	.long	0x690
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xf3
+	.byte	0x2d
+	.long	0x542
+	.uleb128 0x3
+	.string	"dsc"
+	.byte	0xf3
+	.byte	0x4c
+	.long	0x690
+	.uleb128 0x7
+	.long	.LASF1739
+	.byte	0xf3
+	.byte	0x55
+	.long	0x3c
+	.byte	0
+	.uleb128 0x8
+	.long	0x4de
+	.uleb128 0xa
+	.long	.LASF1740
+	.byte	0xe5
+	.byte	0x5
+	.long	0x1cb
+	.long	0x6d1
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xe5
+	.byte	0x25
+	.long	0x542
+	.uleb128 0x7
+	.long	.LASF1724
+	.byte	0xe5
+	.byte	0x34
+	.long	0xa4
+	.uleb128 0x7
+	.long	.LASF1725
+	.byte	0xe5
+	.byte	0x4b
+	.long	0x4d9
+	.uleb128 0x7
+	.long	.LASF1726
+	.byte	0xe5
+	.byte	0x56
+	.long	0x3c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1741
+	.byte	0xdc
+	.byte	0x8
+	.long	0x85
+	.long	0x6ec
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xdc
+	.byte	0x39
+	.long	0x542
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1742
+	.byte	0xd3
+	.long	0x718
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xd3
+	.byte	0x2d
+	.long	0x718
+	.uleb128 0x7
+	.long	.LASF1743
+	.byte	0xd3
+	.byte	0x3b
+	.long	0x98
+	.uleb128 0x11
+	.string	"mem"
+	.byte	0xd5
+	.byte	0x10
+	.long	0x469
+	.byte	0
+	.uleb128 0x8
+	.long	0x46e
+	.uleb128 0xa
+	.long	.LASF1744
+	.byte	0xcd
+	.byte	0xa
+	.long	0x98
+	.long	0x743
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xcd
+	.byte	0x36
+	.long	0x542
+	.uleb128 0x11
+	.string	"mem"
+	.byte	0xcf
+	.byte	0x10
+	.long	0x469
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1745
+	.byte	0xb9
+	.long	0x764
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0xb9
+	.byte	0x26
+	.long	0x542
+	.uleb128 0x7
+	.long	.LASF1746
+	.byte	0xb9
+	.byte	0x36
+	.long	0x1fc
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1747
+	.byte	0xaa
+	.byte	0xf
+	.long	0x718
+	.long	0x7ad
+	.uleb128 0x3
+	.string	"bus"
+	.byte	0xaa
+	.byte	0x27
+	.long	0x232
+	.uleb128 0x3
+	.string	"hw"
+	.byte	0xaa
+	.byte	0x3e
+	.long	0x376
+	.uleb128 0x3
+	.string	"tag"
+	.byte	0xaa
+	.byte	0x4a
+	.long	0x87
+	.uleb128 0xd
+	.uleb128 0x13
+	.long	.LASF1748
+	.byte	0xac
+	.long	0x464
+	.uleb128 0xd
+	.uleb128 0x11
+	.string	"dev"
+	.byte	0xaf
+	.byte	0x1b
+	.long	0x718
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1749
+	.byte	0x71
+	.byte	0xf
+	.long	0x718
+	.long	0x801
+	.uleb128 0x3
+	.string	"bus"
+	.byte	0x71
+	.byte	0x27
+	.long	0x232
+	.uleb128 0x3
+	.string	"hw"
+	.byte	0x71
+	.byte	0x3e
+	.long	0x376
+	.uleb128 0x3
+	.string	"tag"
+	.byte	0x71
+	.byte	0x4a
+	.long	0x87
+	.uleb128 0x7
+	.long	.LASF1750
+	.byte	0x71
+	.byte	0x5f
+	.long	0x1a7
+	.uleb128 0xd
+	.uleb128 0x13
+	.long	.LASF1748
+	.byte	0x75
+	.long	0x464
+	.uleb128 0xd
+	.uleb128 0x11
+	.string	"dev"
+	.byte	0x78
+	.byte	0x1b
+	.long	0x718
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1751
+	.byte	0x6a
+	.long	0x817
+	.uleb128 0x3
+	.string	"dev"
+	.byte	0x6a
+	.byte	0x24
+	.long	0x718
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1752
+	.byte	0x43
+	.long	0x82e
+	.uleb128 0xd
+	.uleb128 0x13
+	.long	.LASF1748
+	.byte	0x46
+	.long	0x464
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1754
+	.byte	0x9
+	.byte	0x31
+	.byte	0xd
+	.uleb128 0x7
+	.long	.LASF1748
+	.byte	0x31
+	.byte	0x39
+	.long	0x464
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 40
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 36
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 12 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 13 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 16 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 22 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 23 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.file 24 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.file 25 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x19
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.file 27 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF684
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF744
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF748
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF749
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF812
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 32 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x4
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 36 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x24
+	.file 37 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.file 39 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF971
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1007
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1049
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1050
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1051
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1052
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF563
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1053
+	.file 49 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1054
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1071
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1084
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1089
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1092
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1093
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1110
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1111
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1112
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1124
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1131
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1132
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1136
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x43
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1137
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.file 69 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1138
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 70 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x4
+	.file 71 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x47
+	.file 72 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1153
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 73 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 74 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x4a
+	.file 75 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.file 76 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1587
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF741
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF747
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF811
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF825
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF843
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF826
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF844
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF999
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1006
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1058
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1062
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1088
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1105
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1109
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1152
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1206
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1586
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1755
+	.long	.LASF1756
+	.long	.LASF1757
+	.long	.LASF1758
+	.long	.LASF1759
+	.long	.LASF1760
+	.long	.LASF1761
+	.long	.LASF1762
+	.long	.LASF1763
+	.long	.LASF1764
+	.long	.LASF1765
+	.long	.LASF1766
+	.long	.LASF1767
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1768
+	.byte	0xd
+	.long	.LASF1769
+	.byte	0x9
+	.long	.LASF1770
+	.byte	0x9
+	.long	.LASF1771
+	.byte	0x4
+	.long	.LASF1772
+	.byte	0x4
+	.long	.LASF1773
+	.byte	0x4
+	.long	.LASF1774
+	.byte	0x2
+	.long	.LASF1775
+	.byte	0xc
+	.long	.LASF1776
+	.byte	0x4
+	.long	.LASF1777
+	.byte	0xc
+	.long	.LASF1778
+	.byte	0x9
+	.long	.LASF1779
+	.byte	0xc
+	.long	.LASF1780
+	.byte	0xc
+	.long	.LASF1781
+	.byte	0x9
+	.long	.LASF1782
+	.byte	0x9
+	.long	.LASF1783
+	.byte	0xb
+	.long	.LASF1784
+	.byte	0x9
+	.long	.LASF1785
+	.byte	0xa
+	.long	.LASF1786
+	.byte	0xa
+	.long	.LASF1787
+	.byte	0x8
+	.long	.LASF1788
+	.byte	0x8
+	.long	.LASF1789
+	.byte	0xc
+	.long	.LASF1790
+	.byte	0x7
+	.long	.LASF1791
+	.byte	0x6
+	.long	.LASF1792
+	.byte	0x5
+	.long	.LASF1793
+	.byte	0xd
+	.long	.LASF1793
+	.byte	0xc
+	.long	.LASF1794
+	.byte	0x9
+	.long	.LASF1795
+	.byte	0x9
+	.long	.LASF1796
+	.byte	0x9
+	.long	.LASF1797
+	.byte	0x9
+	.long	.LASF1798
+	.byte	0x6
+	.long	.LASF1799
+	.byte	0x6
+	.long	.LASF1800
+	.byte	0x1
+	.long	.LASF1801
+	.byte	0xd
+	.long	.LASF1802
+	.byte	0x2
+	.long	.LASF1803
+	.byte	0x3
+	.long	.LASF1804
+	.byte	0x1
+	.long	.LASF1805
+	.byte	0xc
+	.long	.LASF1806
+	.byte	0x9
+	.long	.LASF1807
+	.byte	0x9
+	.long	.LASF1808
+	.byte	0x9
+	.long	.LASF1809
+	.byte	0x9
+	.long	.LASF1769
+	.byte	0xb
+	.long	.LASF1810
+	.byte	0x8
+	.long	.LASF1811
+	.byte	0x8
+	.long	.LASF1812
+	.byte	0x8
+	.long	.LASF1813
+	.byte	0x8
+	.long	.LASF1814
+	.byte	0xc
+	.long	.LASF1814
+	.byte	0x9
+	.long	.LASF1815
+	.byte	0x9
+	.long	.LASF1816
+	.byte	0x9
+	.long	.LASF1817
+	.byte	0x9
+	.long	.LASF1818
+	.byte	0xb
+	.long	.LASF1818
+	.byte	0x9
+	.long	.LASF1819
+	.byte	0x8
+	.long	.LASF1820
+	.byte	0x8
+	.long	.LASF1821
+	.byte	0x8
+	.long	.LASF1822
+	.byte	0x8
+	.long	.LASF1823
+	.byte	0x9
+	.long	.LASF1824
+	.byte	0x9
+	.long	.LASF1825
+	.byte	0x9
+	.long	.LASF1826
+	.byte	0x9
+	.long	.LASF1827
+	.byte	0x9
+	.long	.LASF1828
+	.byte	0x9
+	.long	.LASF1829
+	.byte	0xc
+	.long	.LASF1830
+	.byte	0x9
+	.long	.LASF1831
+	.byte	0x9
+	.long	.LASF1832
+	.byte	0x4
+	.long	.LASF1833
+	.byte	0x4
+	.long	.LASF1834
+	.byte	0x4
+	.long	.LASF1835
+	.byte	0x4
+	.long	.LASF1836
+	.byte	0x4
+	.long	.LASF1837
+	.byte	0x4
+	.long	.LASF1838
+	.byte	0x2
+	.long	.LASF1839
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1578:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF645:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1029:
+	.string	"__ldiv_t_defined 1"
+.LASF875:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF618:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1621:
+	.string	"OWNER_BEEPER"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1408:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1195:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF594:
+	.string	"USE_RX_PPM "
+.LASF1119:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF990:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF853:
+	.string	"USE_BARO "
+.LASF648:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1240:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF836:
+	.string	"_WCHAR_T_DEFINED "
+.LASF668:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF630:
+	.string	"USE_PITOT_MS4525 "
+.LASF1334:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1585:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF860:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF698:
+	.string	"__U64_TYPE unsigned long int"
+.LASF691:
+	.string	"__SQUAD_TYPE long int"
+.LASF1352:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF1056:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF669:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1481:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF600:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1044:
+	.string	"__pid_t_defined "
+.LASF1055:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF935:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1220:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF999:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF649:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1595:
+	.string	"__uint8_t"
+.LASF745:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1644:
+	.string	"_Bool"
+.LASF861:
+	.string	"USE_UART8 "
+.LASF1427:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1142:
+	.string	"DMA_NONE (0)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1171:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1703:
+	.string	"DEVHW_M25P16"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1569:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1542:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"IOCFG_AF_OD 0"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1702:
+	.string	"DEVHW_PCA9685"
+.LASF870:
+	.string	"USE_USB_MSC"
+.LASF1297:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1203:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1505:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1167:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1451:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF957:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1210:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF828:
+	.string	"__WCHAR_T__ "
+.LASF971:
+	.string	"_STDLIB_H 1"
+.LASF1574:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"USE_SERIAL_RX "
+.LASF1160:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF916:
+	.string	"_STDBOOL_H "
+.LASF1413:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1397:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1546:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1492:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1627:
+	.string	"OWNER_LED"
+.LASF879:
+	.string	"USE_PITOT_MS4525"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1581:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1738:
+	.string	"busTransferMultiple"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1715:
+	.string	"busDeviceDescriptor_t"
+.LASF1274:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1067:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF741:
+	.string	"__FD_SETSIZE 1024"
+.LASF699:
+	.string	"__STD_TYPE typedef"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1513:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF962:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF680:
+	.string	"USE_CLI_BATCH "
+.LASF1665:
+	.string	"DEVHW_MPU6000"
+.LASF947:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1726:
+	.string	"length"
+.LASF977:
+	.string	"WNOWAIT 0x01000000"
+.LASF903:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1281:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF817:
+	.string	"_T_PTRDIFF_ "
+.LASF590:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF779:
+	.string	"INT_FAST8_MAX (127)"
+.LASF688:
+	.string	"__U32_TYPE unsigned int"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1456:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF864:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1360:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1149:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1283:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF865:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1041:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1198:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF827:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1233:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF806:
+	.string	"UINT8_C(c) c"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF708:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1024:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1545:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1438:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1501:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1573:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1749:
+	.string	"busDeviceInit"
+.LASF640:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1241:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1178:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1586:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1194:
+	.string	"BIT(x) (1 << (x))"
+.LASF877:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1639:
+	.string	"OWNER_IRLOCK"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF783:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1249:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1400:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1084:
+	.string	"_SYS_SELECT_H 1"
+.LASF1002:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1096:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF848:
+	.string	"USE_IMU_FAKE "
+.LASF1723:
+	.string	"busTransferDescriptor_s"
+.LASF1727:
+	.string	"busTransferDescriptor_t"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1716:
+	.string	"busDeviceDescriptor_s"
+.LASF1034:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1684:
+	.string	"DEVHW_IST8308"
+.LASF1559:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1092:
+	.string	"__timeval_defined 1"
+.LASF1632:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1495:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF1212:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1316:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1214:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1747:
+	.string	"busDeviceOpen"
+.LASF869:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1069:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF634:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF888:
+	.string	"USE_RX_PPM"
+.LASF508:
+	.string	"__always_inline"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1008:
+	.string	"__HAVE_FLOAT16 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1221:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF753:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1672:
+	.string	"DEVHW_BMP280"
+.LASF1189:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF746:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF675:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF908:
+	.string	"FAST_CODE "
+.LASF1319:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1709:
+	.string	"busType"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF775:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1391:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1079:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF636:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1071:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1312:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1532:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF1696:
+	.string	"DEVHW_DS2482"
+.LASF851:
+	.string	"USE_FAKE_GPS "
+.LASF1080:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1088:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1598:
+	.string	"long int"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1289:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1666:
+	.string	"DEVHW_MPU6050"
+.LASF637:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1475:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF1548:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1620:
+	.string	"OWNER_USB"
+.LASF1280:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF988:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1640:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF802:
+	.string	"INT8_C(c) c"
+.LASF949:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF1538:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF548:
+	.string	"__stub_stty "
+.LASF951:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF804:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF662:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1419:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1688:
+	.string	"DEVHW_LM75_0"
+.LASF1689:
+	.string	"DEVHW_LM75_1"
+.LASF1690:
+	.string	"DEVHW_LM75_2"
+.LASF1691:
+	.string	"DEVHW_LM75_3"
+.LASF1692:
+	.string	"DEVHW_LM75_4"
+.LASF1693:
+	.string	"DEVHW_LM75_5"
+.LASF1694:
+	.string	"DEVHW_LM75_6"
+.LASF1695:
+	.string	"DEVHW_LM75_7"
+.LASF985:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF687:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1264:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF910:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1062:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1004:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF969:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1209:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1154:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1498:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF672:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1622:
+	.string	"OWNER_OSD"
+.LASF938:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1608:
+	.string	"OWNER_SERVO"
+.LASF1197:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF960:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1153:
+	.string	"SPIDEV_COUNT 4"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1037:
+	.string	"__ino_t_defined "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF893:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF829:
+	.string	"_WCHAR_T "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1239:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1324:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1273:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1059:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF942:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1242:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1134:
+	.string	"alloca"
+.LASF1724:
+	.string	"rxBuf"
+.LASF823:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF941:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1247:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF784:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF801:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1027:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1607:
+	.string	"OWNER_MOTOR"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1331:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF899:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1215:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF1551:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF839:
+	.string	"__INT_WCHAR_T_H "
+.LASF1039:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1364:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1306:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1219:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1491:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1085:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF582:
+	.string	"__size_t "
+.LASF782:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1102:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1252:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1250:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1541:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF982:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF998:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF930:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1604:
+	.string	"OWNER_PWMIO"
+.LASF1023:
+	.string	"__f32x(x) x ##f32x"
+.LASF1677:
+	.string	"DEVHW_BMP388"
+.LASF1161:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF639:
+	.string	"USE_OLED_UG2864 "
+.LASF1367:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF656:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF679:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1183:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1406:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1630:
+	.string	"OWNER_RX_SPI"
+.LASF766:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1741:
+	.string	"busDeviceGetScratchpadMemory"
+.LASF1591:
+	.string	"unsigned char"
+.LASF749:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1432:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1140:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF939:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF824:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1040:
+	.string	"__mode_t_defined "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF609:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF606:
+	.string	"USE_NAV "
+.LASF1609:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1447:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1393:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF907:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF803:
+	.string	"INT16_C(c) c"
+.LASF838:
+	.string	"___int_wchar_t_h "
+.LASF1336:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1173:
+	.string	"IOCFG_OUT_OD 0"
+.LASF748:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF816:
+	.string	"_PTRDIFF_T "
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1064:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF1288:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF925:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF617:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1042:
+	.string	"__uid_t_defined "
+.LASF608:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1082:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1131:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF604:
+	.string	"USE_GPS "
+.LASF1278:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1648:
+	.string	"BUS_SPEED_FAST"
+.LASF1554:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF959:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF507:
+	.string	"__wur "
+.LASF1523:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF599:
+	.string	"USE_SERIALRX_FPORT "
+.LASF987:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1494:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1354:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1635:
+	.string	"OWNER_1WIRE"
+.LASF894:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1381:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1049:
+	.string	"__clock_t_defined 1"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF835:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1359:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF710:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1448:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF667:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1614:
+	.string	"OWNER_RANGEFINDER"
+.LASF1544:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1095:
+	.string	"__NFDBITS"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF750:
+	.string	"__intptr_t_defined "
+.LASF1162:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF758:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF769:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1701:
+	.string	"DEVHW_MS4525"
+.LASF1333:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1411:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1429:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1243:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1698:
+	.string	"DEVHW_SRF10"
+.LASF1052:
+	.string	"__timer_t_defined 1"
+.LASF892:
+	.string	"USE_ITCM_RAM"
+.LASF1295:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF786:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1013:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1090:
+	.string	"____sigset_t_defined "
+.LASF1754:
+	.string	"busDevPreInit"
+.LASF846:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1054:
+	.string	"_ENDIAN_H 1"
+.LASF1564:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1493:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF808:
+	.string	"UINT32_C(c) c ## U"
+.LASF919:
+	.string	"false 0"
+.LASF885:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1576:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF762:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1168:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF880:
+	.string	"USE_PITOT_ADC"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF601:
+	.string	"USE_ADC_AVERAGING "
+.LASF1535:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1298:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1321:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1015:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF805:
+	.string	"INT64_C(c) c ## L"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1136:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1649:
+	.string	"BUS_SPEED_ULTRAFAST"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF742:
+	.string	"_BITS_TIME64_H 1"
+.LASF1123:
+	.string	"__ONCE_ALIGNMENT "
+.LASF781:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF722:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF934:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF981:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1557:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF629:
+	.string	"USE_OPFLOW_MSP "
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF1555:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1053:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF686:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1624:
+	.string	"OWNER_MPU"
+.LASF1076:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1205:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1549:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1325:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1750:
+	.string	"owner"
+.LASF1384:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1634:
+	.string	"OWNER_TEMPERATURE"
+.LASF1010:
+	.string	"__HAVE_FLOAT64 1"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1253:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1625:
+	.string	"OWNER_INVERTER"
+.LASF1594:
+	.string	"size_t"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1065:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1547:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF724:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1599:
+	.string	"uint8_t"
+.LASF1292:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF619:
+	.string	"USE_RX_UIB "
+.LASF690:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1536:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1669:
+	.string	"DEVHW_ICM20689"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1124:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1191:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF1155:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1147:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1418:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1712:
+	.string	"param"
+.LASF1570:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"USE_ADC"
+.LASF1038:
+	.string	"__dev_t_defined "
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1719:
+	.string	"scratchpad"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF840:
+	.string	"_GCC_WCHAR_T "
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1465:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF992:
+	.string	"__WCOREFLAG 0x80"
+.LASF798:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF906:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1486:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1717:
+	.string	"busDevice_s"
+.LASF1720:
+	.string	"busDevice_t"
+.LASF1399:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF563:
+	.string	"__need_size_t "
+.LASF624:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF815:
+	.string	"_ANSI_STDDEF_H "
+.LASF1125:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1424:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF843:
+	.string	"_BSD_WCHAR_T_"
+.LASF1686:
+	.string	"DEVHW_MAG3110"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1699:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1006:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF871:
+	.string	"USE_SERVO_SBUS"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF887:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1213:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF583:
+	.string	"__need_size_t"
+.LASF1606:
+	.string	"OWNER_PPMINPUT"
+.LASF1642:
+	.string	"ioTag_t"
+.LASF826:
+	.string	"__need_ptrdiff_t"
+.LASF1068:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF625:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF650:
+	.string	"USE_LOG "
+.LASF924:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1560:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF813:
+	.string	"_STDDEF_H "
+.LASF1503:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF850:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF796:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1204:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1244:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1414:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1343:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF811:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF1579:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF956:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF995:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1165:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF946:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1259:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF614:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1659:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF736:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1087:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1282:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1661:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1007:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1328:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1057:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1721:
+	.string	"__busdev_registry_start"
+.LASF613:
+	.string	"USE_PITOT_ADC "
+.LASF763:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF738:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1484:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1652:
+	.string	"BUSTYPE_NONE"
+.LASF1442:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1477:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1753:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF809:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1005:
+	.string	"__f128(x) x ##f128"
+.LASF1108:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF764:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1522:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1063:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1262:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1743:
+	.string	"value"
+.LASF1537:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF972:
+	.string	"WNOHANG 1"
+.LASF1388:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1394:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1633:
+	.string	"OWNER_COMPASS"
+.LASF1118:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1217:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF922:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF771:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1525:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"busSpeed_e"
+.LASF1516:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1402:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1366:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1369:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF889:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF849:
+	.string	"USE_FAKE_BARO "
+.LASF1265:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1050:
+	.string	"__clockid_t_defined 1"
+.LASF1177:
+	.string	"IOCFG_IPU 0"
+.LASF955:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF974:
+	.string	"WSTOPPED 2"
+.LASF584:
+	.string	"NULL"
+.LASF1106:
+	.string	"__blksize_t_defined "
+.LASF1109:
+	.string	"__fsfilcnt_t_defined "
+.LASF1132:
+	.string	"__have_pthread_attr_t 1"
+.LASF975:
+	.string	"WEXITED 4"
+.LASF1615:
+	.string	"OWNER_SYSTEM"
+.LASF670:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF944:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1430:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF461:
+	.string	"__PMT"
+.LASF841:
+	.string	"_WCHAR_T_DECLARED "
+.LASF628:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1617:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF615:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1122:
+	.string	"__LOCK_ALIGNMENT "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF984:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1662:
+	.string	"DEVHW_L3GD20"
+.LASF1603:
+	.string	"OWNER_FREE"
+.LASF1099:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF810:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF948:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1379:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1751:
+	.string	"busDeviceDeInit"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1003:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF676:
+	.string	"USE_VTX_TRAMP "
+.LASF1043:
+	.string	"__off_t_defined "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1291:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1075:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1520:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1185:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1363:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF689:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF611:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF928:
+	.string	"UNIT_TESTED "
+.LASF881:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1143:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF790:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1445:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF777:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF757:
+	.string	"INT32_MAX (2147483647)"
+.LASF833:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1117:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1372:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1224:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF901:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF471:
+	.string	"__P(args) args"
+.LASF1019:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF963:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF789:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF767:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF943:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1540:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF714:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1729:
+	.string	"memset"
+.LASF1245:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1732:
+	.string	"busIsBusy"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1223:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1534:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF596:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1355:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1307:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1094:
+	.string	"__suseconds_t_defined "
+.LASF794:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF725:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF755:
+	.string	"INT8_MAX (127)"
+.LASF1111:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1103:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF603:
+	.string	"USE_BLACKBOX "
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF797:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1623:
+	.string	"OWNER_BARO"
+.LASF1238:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1507:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1086:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF726:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF586:
+	.string	"__need_NULL"
+.LASF845:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1255:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF884:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1236:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1163:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF1345:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1310:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1271:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF622:
+	.string	"USE_RANGEFINDER "
+.LASF1656:
+	.string	"busType_e"
+.LASF773:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF477:
+	.string	"__END_DECLS "
+.LASF1180:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1169:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1618:
+	.string	"OWNER_SDCARD"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF393:
+	.string	"_STRING_H 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1565:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF711:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF652:
+	.string	"USE_CMS "
+.LASF923:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1740:
+	.string	"busTransfer"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF844:
+	.string	"__need_wchar_t"
+.LASF1589:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1706:
+	.string	"DEVHW_IRLOCK"
+.LASF1373:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1593:
+	.string	"signed char"
+.LASF1020:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1313:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1676:
+	.string	"DEVHW_SPL06"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF565:
+	.string	"__size_t__ "
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF1156:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1276:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1562:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"_WCHAR_T_H "
+.LASF1386:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1563:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1051:
+	.string	"__time_t_defined 1"
+.LASF1078:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1070:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1436:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF791:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1739:
+	.string	"count"
+.LASF623:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1471:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1390:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1667:
+	.string	"DEVHW_MPU6500"
+.LASF1653:
+	.string	"BUSTYPE_I2C"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF1022:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1489:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF872:
+	.string	"USE_DASHBOARD"
+.LASF677:
+	.string	"USE_VTX_FFPV "
+.LASF1141:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1110:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF980:
+	.string	"__WCLONE 0x80000000"
+.LASF1227:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1105:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF996:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF712:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1011:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF647:
+	.string	"USE_ANTIGRAVITY "
+.LASF1468:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF739:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1146:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF900:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF704:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF937:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1611:
+	.string	"OWNER_SERIAL"
+.LASF912:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF593:
+	.string	"USE_I2C_PULLUP "
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF1638:
+	.string	"OWNER_PINIO"
+.LASF633:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1480:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1270:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1529:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1137:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF847:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF961:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1231:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1268:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1631:
+	.string	"OWNER_VTX"
+.LASF778:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF598:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1305:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1211:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1048:
+	.string	"__key_t_defined "
+.LASF1246:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF1200:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1375:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF706:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1001:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1680:
+	.string	"DEVHW_AK8963"
+.LASF1073:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF921:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF967:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1646:
+	.string	"BUS_SPEED_SLOW"
+.LASF1150:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1237:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1435:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF1683:
+	.string	"DEVHW_IST8310_1"
+.LASF952:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF695:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF761:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1279:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1218:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF654:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF1511:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF966:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1681:
+	.string	"DEVHW_AK8975"
+.LASF1340:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1403:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1728:
+	.string	"memAllocate"
+.LASF1657:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1229:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1148:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF658:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF751:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF759:
+	.string	"UINT8_MAX (255)"
+.LASF1358:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1612:
+	.string	"OWNER_PINDEBUG"
+.LASF1285:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF890:
+	.string	"USE_RCDEVICE"
+.LASF1552:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1115:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF820:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1193:
+	.string	"UNUSED(x) (void)(x)"
+.LASF768:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF819:
+	.string	"__PTRDIFF_T "
+.LASF1093:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF1647:
+	.string	"BUS_SPEED_STANDARD"
+.LASF1668:
+	.string	"DEVHW_BMI160"
+.LASF1752:
+	.string	"busInit"
+.LASF1385:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1417:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF721:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1190:
+	.string	"EXPAND_I(x) x"
+.LASF1361:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF657:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1452:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1127:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1605:
+	.string	"OWNER_PWMINPUT"
+.LASF1318:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1600:
+	.string	"uint32_t"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF733:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF895:
+	.string	"U_ID_0 0"
+.LASF1731:
+	.string	"busSelectDevice"
+.LASF1025:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1426:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1675:
+	.string	"DEVHW_LPS25H"
+.LASF965:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF716:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF732:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1485:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1026:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1097:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF842:
+	.string	"__DEFINED_wchar_t "
+.LASF1496:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF854:
+	.string	"USE_UART1 "
+.LASF484:
+	.string	"__flexarr []"
+.LASF1028:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF684:
+	.string	"_BITS_TYPES_H 1"
+.LASF1186:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF772:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1718:
+	.string	"descriptorPtr"
+.LASF682:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF929:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1091:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF954:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF830:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF653:
+	.string	"CMS_MENU_OSD "
+.LASF765:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF1031:
+	.string	"RAND_MAX 2147483647"
+.LASF1376:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1613:
+	.string	"OWNER_TIMER"
+.LASF936:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1730:
+	.string	"busDeselectDevice"
+.LASF1654:
+	.string	"BUSTYPE_SPI"
+.LASF1514:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"USE_PITOT "
+.LASF1460:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1519:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF780:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF674:
+	.string	"USE_VTX_CONTROL "
+.LASF1590:
+	.string	"char"
+.LASF1116:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1357:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF976:
+	.string	"WCONTINUED 8"
+.LASF707:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF1014:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1294:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1441:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1704:
+	.string	"DEVHW_UG2864"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1174:
+	.string	"IOCFG_AF_PP 0"
+.LASF1655:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF685:
+	.string	"__S16_TYPE short int"
+.LASF1643:
+	.string	"IO_t"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF729:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF973:
+	.string	"WUNTRACED 2"
+.LASF1033:
+	.string	"EXIT_SUCCESS 0"
+.LASF855:
+	.string	"USE_UART2 "
+.LASF1081:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF660:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1515:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF933:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF705:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF747:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1158:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF664:
+	.string	"USE_RX_MSP "
+.LASF1420:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF918:
+	.string	"true 1"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF626:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF671:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF719:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1577:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1737:
+	.string	"busWriteBuf"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF744:
+	.string	"__STD_TYPE"
+.LASF730:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1664:
+	.string	"DEVHW_MPU3050"
+.LASF774:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF920:
+	.string	"__bool_true_false_are_defined 1"
+.LASF702:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF696:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1009:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF564:
+	.string	"__need_NULL "
+.LASF1637:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF627:
+	.string	"USE_OPFLOW "
+.LASF1722:
+	.string	"__busdev_registry_end"
+.LASF1687:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1188:
+	.string	"STR_HELPER(x) #x"
+.LASF1130:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF597:
+	.string	"USE_SERIALRX_SBUS "
+.LASF754:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1322:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF926:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1483:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF799:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1089:
+	.string	"__sigset_t_defined 1"
+.LASF958:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1382:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1300:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1421:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF788:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF818:
+	.string	"_T_PTRDIFF "
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1157:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF605:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1497:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__linux 1"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1409:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF756:
+	.string	"INT16_MAX (32767)"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1017:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF659:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1045:
+	.string	"__id_t_defined "
+.LASF616:
+	.string	"USE_GYRO_KALMAN "
+.LASF1342:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1423:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1128:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF989:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1383:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1558:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1504:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1566:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1580:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1047:
+	.string	"__daddr_t_defined "
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF979:
+	.string	"__WALL 0x40000000"
+.LASF1377:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1060:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1074:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1144:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1286:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF694:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1113:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF991:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF610:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1474:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"_SYS_TYPES_H 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1330:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1077:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF717:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1058:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1235:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1222:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1199:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1258:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1682:
+	.string	"DEVHW_IST8310_0"
+.LASF1508:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF727:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF834:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1339:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF592:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1030:
+	.string	"__lldiv_t_defined 1"
+.LASF1628:
+	.string	"OWNER_RX"
+.LASF770:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1746:
+	.string	"speed"
+.LASF905:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1526:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1120:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF1378:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1597:
+	.string	"__uint32_t"
+.LASF1151:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF418:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF986:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF1734:
+	.string	"data"
+.LASF1487:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1138:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1714:
+	.string	"irqPin"
+.LASF1670:
+	.string	"DEVHW_MPU9250"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1713:
+	.string	"busdev"
+.LASF1277:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF655:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1619:
+	.string	"OWNER_FLASH"
+.LASF1228:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1567:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF693:
+	.string	"__SWORD_TYPE long int"
+.LASF1176:
+	.string	"IOCFG_IPD 0"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1466:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1412:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1181:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF638:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1107:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF978:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF831:
+	.string	"_T_WCHAR "
+.LASF1192:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF581:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1478:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF760:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF735:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF814:
+	.string	"_STDDEF_H_ "
+.LASF1216:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF743:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1234:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1583:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1708:
+	.string	"devicePtr"
+.LASF700:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1337:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1453:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1568:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1629:
+	.string	"OWNER_TX"
+.LASF807:
+	.string	"UINT16_C(c) c"
+.LASF1114:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF651:
+	.string	"USE_STATS "
+.LASF852:
+	.string	"USE_MAG "
+.LASF1636:
+	.string	"OWNER_AIRSPEED"
+.LASF1582:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF927:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1370:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF793:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1066:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1472:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF795:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1256:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1021:
+	.string	"__f32(x) x ##f32"
+.LASF821:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF832:
+	.string	"__WCHAR_T "
+.LASF1744:
+	.string	"busDeviceReadScratchpad"
+.LASF1444:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1725:
+	.string	"txBuf"
+.LASF1164:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1098:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF822:
+	.string	"___int_ptrdiff_t_h "
+.LASF970:
+	.string	"__need_wchar_t "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1016:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1196:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF896:
+	.string	"U_ID_1 1"
+.LASF1602:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF740:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1674:
+	.string	"DEVHW_MS5607"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1207:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1454:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"BUSDEV_MAX_DEVICES 16"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1531:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"DEVHW_MMA8452"
+.LASF591:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF968:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF1145:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF678:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1469:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF683:
+	.string	"_STDINT_H 1"
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF621:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1000:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1550:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"USE_D_BOOST "
+.LASF1673:
+	.string	"DEVHW_MS5611"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1700:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF898:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF728:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1742:
+	.string	"busDeviceWriteScratchpad"
+.LASF873:
+	.string	"USE_OLED_UG2864"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF931:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF681:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF911:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF866:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1202:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF715:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF665:
+	.string	"USE_SERIALRX_SUMD "
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1396:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1415:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1705:
+	.string	"DEVHW_SDCARD"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF734:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF1685:
+	.string	"DEVHW_QMC5883"
+.LASF1046:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1284:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF1159:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF631:
+	.string	"USE_1WIRE "
+.LASF1510:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1104:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1267:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1710:
+	.string	"devHwType"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1018:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1351:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1572:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF882:
+	.string	"USE_1WIRE_DS2482"
+.LASF1187:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF867:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF1112:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1707:
+	.string	"devHardwareType_e"
+.LASF1135:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1561:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF792:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF917:
+	.string	"bool _Bool"
+.LASF913:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF731:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1206:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1571:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1433:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1225:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1072:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1658:
+	.string	"DEVHW_BMA280"
+.LASF607:
+	.string	"USE_TELEMETRY "
+.LASF1309:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1101:
+	.string	"NFDBITS __NFDBITS"
+.LASF1601:
+	.string	"long long int"
+.LASF1651:
+	.string	"BUSTYPE_ANY"
+.LASF1301:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF800:
+	.string	"WINT_MIN (0u)"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1172:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1032:
+	.string	"EXIT_FAILURE 1"
+.LASF635:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1645:
+	.string	"BUS_SPEED_INITIALIZATION"
+.LASF993:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF868:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF891:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF643:
+	.string	"USE_DJI_HD_OSD "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1678:
+	.string	"DEVHW_DPS310"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF1232:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1230:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1133:
+	.string	"_ALLOCA_H 1"
+.LASF644:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1528:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1126:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1616:
+	.string	"OWNER_SPI"
+.LASF983:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1553:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1439:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1348:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF642:
+	.string	"USE_FRSKYOSD "
+.LASF1304:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF876:
+	.string	"USE_RANGEFINDER"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF718:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF902:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1736:
+	.string	"busWrite"
+.LASF1450:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1335:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF862:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1166:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1129:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF883:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF666:
+	.string	"USE_SERIALRX_SUMH "
+.LASF994:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1588:
+	.string	"long unsigned int"
+.LASF1208:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1626:
+	.string	"OWNER_LED_STRIP"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF787:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1179:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1036:
+	.string	"__u_char_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF940:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF723:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1584:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1459:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1405:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1575:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF720:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1671:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1748:
+	.string	"descriptor"
+.LASF752:
+	.string	"INT16_MIN (-32767-1)"
+.LASF713:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1380:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF856:
+	.string	"USE_UART3 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1455:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1226:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1184:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF945:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF673:
+	.string	"USE_RCDEVICE "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF709:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF1679:
+	.string	"DEVHW_HMC5883"
+.LASF878:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1592:
+	.string	"unsigned int"
+.LASF857:
+	.string	"USE_UART4 "
+.LASF1083:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1387:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1490:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1061:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1735:
+	.string	"busReadBuf"
+.LASF863:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1517:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF661:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF701:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF953:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1610:
+	.string	"OWNER_ADC"
+.LASF1596:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF620:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF663:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1152:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1539:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1641:
+	.string	"resourceOwner_e"
+.LASF1346:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1556:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF858:
+	.string	"USE_UART5 "
+.LASF1502:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF697:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF1100:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF641:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF874:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF932:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF904:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1543:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF950:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF997:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1697:
+	.string	"DEVHW_MAX7456"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF1711:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1733:
+	.string	"busRead"
+.LASF1410:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1327:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1745:
+	.string	"busSetSpeed"
+.LASF859:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1349:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1820:
+	.string	"__sigset_t.h"
+.LASF1772:
+	.string	"io_types.h"
+.LASF1834:
+	.string	"bus_spi.h"
+.LASF1784:
+	.string	"long-double.h"
+.LASF1788:
+	.string	"__locale_t.h"
+.LASF1798:
+	.string	"sanity_check.h"
+.LASF1827:
+	.string	"struct_mutex.h"
+.LASF1792:
+	.string	"target.h"
+.LASF1824:
+	.string	"thread-shared-types.h"
+.LASF1778:
+	.string	"libc-header-start.h"
+.LASF1801:
+	.string	"stdbool.h"
+.LASF1760:
+	.string	"src/main/target"
+.LASF1814:
+	.string	"endian.h"
+.LASF1756:
+	.string	"src/main/common"
+.LASF1797:
+	.string	"stdint-intn.h"
+.LASF1764:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF0:
+	.string	"./src/main/drivers/bus.c"
+.LASF1785:
+	.string	"stubs.h"
+.LASF1759:
+	.string	"src/main/target/SITL"
+.LASF1826:
+	.string	"atomic_wide_counter.h"
+.LASF1810:
+	.string	"clock_t.h"
+.LASF1782:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1783:
+	.string	"cdefs.h"
+.LASF1763:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1832:
+	.string	"bus_i2c.h"
+.LASF1805:
+	.string	"stdlib.h"
+.LASF1789:
+	.string	"strings.h"
+.LASF1780:
+	.string	"features-time64.h"
+.LASF1825:
+	.string	"pthreadtypes-arch.h"
+.LASF1769:
+	.string	"types.h"
+.LASF1809:
+	.string	"floatn-common.h"
+.LASF1808:
+	.string	"floatn.h"
+.LASF1758:
+	.string	"src/main/drivers"
+.LASF1766:
+	.string	"/usr/include"
+.LASF1822:
+	.string	"struct_timespec.h"
+.LASF1812:
+	.string	"time_t.h"
+.LASF1755:
+	.string	"src/main/build"
+.LASF1819:
+	.string	"sigset_t.h"
+.LASF1833:
+	.string	"rcc_types.h"
+.LASF1779:
+	.string	"features.h"
+.LASF1791:
+	.string	"common.h"
+.LASF1794:
+	.string	"typesizes.h"
+.LASF1823:
+	.string	"pthreadtypes.h"
+.LASF1787:
+	.string	"locale_t.h"
+.LASF1811:
+	.string	"clockid_t.h"
+.LASF1757:
+	.string	"src/main/config"
+.LASF1795:
+	.string	"time64.h"
+.LASF1770:
+	.string	"stdint-uintn.h"
+.LASF1816:
+	.string	"byteswap.h"
+.LASF1796:
+	.string	"wchar.h"
+.LASF1838:
+	.string	"utils.h"
+.LASF1813:
+	.string	"timer_t.h"
+.LASF1773:
+	.string	"bus.h"
+.LASF1774:
+	.string	"memory.h"
+.LASF1761:
+	.string	"src/main"
+.LASF1776:
+	.string	"bus.c"
+.LASF1807:
+	.string	"waitstatus.h"
+.LASF1771:
+	.string	"resource.h"
+.LASF1802:
+	.string	"time.h"
+.LASF1815:
+	.string	"endianness.h"
+.LASF1765:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1821:
+	.string	"struct_timeval.h"
+.LASF1837:
+	.string	"io_def.h"
+.LASF1806:
+	.string	"waitflags.h"
+.LASF1836:
+	.string	"io.h"
+.LASF1830:
+	.string	"stdlib-bsearch.h"
+.LASF1829:
+	.string	"alloca.h"
+.LASF1767:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1828:
+	.string	"struct_rwlock.h"
+.LASF1775:
+	.string	"string.h"
+.LASF1762:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1818:
+	.string	"select.h"
+.LASF1793:
+	.string	"stdint.h"
+.LASF1804:
+	.string	"build_config.h"
+.LASF1768:
+	.string	"stddef.h"
+.LASF1786:
+	.string	"stubs-64.h"
+.LASF1781:
+	.string	"wordsize.h"
+.LASF1817:
+	.string	"uintn-identity.h"
+.LASF1835:
+	.string	"dma.h"
+.LASF1839:
+	.string	"io_def_generated.h"
+.LASF1799:
+	.string	"common_post.h"
+.LASF1800:
+	.string	"debug.h"
+.LASF1803:
+	.string	"parameter_group.h"
+.LASF1790:
+	.string	"platform.h"
+.LASF1777:
+	.string	"stdc-predef.h"
+.LASF1831:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375 \364U\005"
+	.string	"4\b\350"
+	.string	"\021"
+	.string	"\370\363\364\355\t"
+	.string	"\001\313\306\202\211\f\004\002"
+	.string	"\002\001\002\002\002\001\002\305\317\242\271\003\036\002\003\002\004\002\002\002\004\002\005\002\004\002\006\002\001\007\005\367\360\352\254\003\f"
+	.string	"\002\001\006\322\373\317\276\013"
+	.string	"\007\362\347\323l\006\002\b\002\t\002\b\002\001\b\231\357\234\365\013\002\002\n\002\n\t\254\236\303\207\002\n\210\226\321\372\006"
+	.string	"\013\336\334\275\207\n"
+	.string	"\f\r\016\017\020\263\373\315\215\002"
+	.string	"\021\022\300\265\356\337\r"
+	.string	""
+	.string	"\020"
+	.ascii	"*\203\301``\b\030W\314\251]\016\260b\350\325ZF\230\013\\x\365"
+	.ascii	"`%\036\020\276\031l\205\"e\003m"
+	.text
+	.section	.gnu.lto_.ipa_sra.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375 \353}\003"
+	.string	"\342\004\017\031\260%\351\f\3030\3444\f\3030\374X\262\255\265\304ZK\266mD\222\224\002\216,?\234\257\221e(l\204\255\304l\260\225\b6P\324 ~\027\035I\226\0030W\354&\343_\217\211\025"
+	.string	"*\203A(\260\335\242\034u\332\340\"#\f4\300\205e\236\332\021"
+	.ascii	"\027\327\314\270(:7C\263:\206\225\215\300,n\204\2345d\206\262"
+	.ascii	"\001,"
+	.text
+	.section	.gnu.lto_.inline.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`&\002\355\b"
+	.string	"\302N13P\213\222\016\b\231Bb\317\212\314k\1779p\325"
+	.string	"\350=\274x\366Vx5#p\007\306\210\201\242\212\345|\"3t\004\343\202\002d\277\375\337@>\331r\247\013`.\001"
+	.string	"\226\313\252P\316\210\360\277\022+\352\364\201\341\372\310\320\020\351\004B\271j\355\266\333\020\352!\202\312\360j\254Y\253\233\275\367&\237\200\356\352\313\261\301U\332\271\343B'B\237\215\353\211\353\320\270\030\211p\317)E\205\307T\300i\311b\3041\260\344\3613\242\374-\355\262&G\022\245\254}\334o2\203\344\001\035\344o\025Mh\325\341\0377\316j\347\0347\031\222J\201\fnV\257\320>j$\343\327\375\303{\017\342\373\210\365\275\367\3621'A$ p\242be= \205\344!\311D\212\221\007\2221)\016\31037\311\2021\273\276!\256\331\270\342\023\fV\341$7O9\2000\374\320!\321,\357\253p>\021=2\330/\242p\036"
+	.ascii	"\326l4\366(S\201>\344\003\022|\020\353\312\330j\\\214\023\343"
+	.ascii	"b\272\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"=\005"
+	.string	"R\211\033!\220\245I\007\377Y\375\377\177\374n\266\356\177\374\367e\257\n\370\266\266\266\275m\333'\377\223'V&\031\\%\237Y\224&\261\2621+\r1;\236\262P\030O\351\224\315'\002\323\273\333w\315K]\275?8\216\001T\035\347\204jZ\002\245\\W\025\001\b\232\001\252\344\206K^S\304S4\251\222\322zH\317\350!\376S\357\025?\311\205\037\002\027"
+	.ascii	"\252!\2500`ph 5\200\b\004+\312\274\232\"YL\344\237q\036Yh\361"
+	.ascii	"K w\346)h\254\252l2\234Nj\r!\034\202c4\233\274\314\2475\340\006"
+	.text
+	.section	.gnu.lto_.pureconst.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\200\004\001\232\004\002\232\004\005\205\004\006\200\004\007"
+	.ascii	"\232\004\b\231\004\t\232\004\n\200\004\013\200\004\f\200\004"
+	.ascii	"\r\200\004\016\200\004\017\200\004\020\200\004\021\200\004\022"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"\265\005"
+	.ascii	"b\310\032$\220)\3510\277\344\256\013\267\262\303\231\017\336"
+	.ascii	"\354\342[\374\333\252(\326\204\022oV\374\337\332\377Ik\233H\231"
+	.ascii	"\002/\030\016\305rT D\030\b\236\345\364\232\2134\200\2304\n\022"
+	.ascii	"=\b\270)K=\345\207\243\220\375m\231y\375Y[K\342\031u:\235\327"
+	.ascii	"\265DC\371\227U\256_]=M7\247\267\333s~\355R)!\241\231g#! \200"
+	.ascii	"\0022\243;l1\367%(P\216y\310\270s\034\0060\355\305\234}\231\307"
+	.ascii	"\201v\020\032\306u\341\202,\t\320\206\"\002\004\t\034\330\351"
+	.ascii	"\007\315P\321m\003\203\":\0348jd\031\013\031/C\303H\266\360q"
+	.ascii	"\036\\\021"
+	.text
+	.section	.gnu.lto_.lto.6d529b7b35f8576e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_busInit.28.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"U\t"
+	.string	"f\021A90\221\322\001"
+	.string	"\227\034\007\003\373\242*\022\236\r\271\006+Ee\266\247\221\376\245\212V\266\"\177\260h-\210\270\347O"
+	.string	")(\b\223D\273~\252\001\035sj~[D6!;\245-"
+	.string	"2"
+	.string	"1"
+	.string	"%\266\357qh\327|\034\331\27386\\nv\227f\"\241\f/C\377\254\007\210\250\214K\200\207\335\265\024Q\251;\273m\004\333\020\266e\002\233\362\330\035\025\234\320\371\364x\203\355\263\363\202\355\363& &-E%_\0371+c\366x\222Y\210}m\263\225-\267\023\230\317\314nG\016\316\302\346K\254w^(0Sv\362f\243\332\326\245\214\331w\225\034hv5.\372,o\261\320N\362\351\213\322v\361\323/m\237\004*\006\253|%|\013C~\306\346\0268\256\301\363:\320@\375H#Q\355\300\220'\340\016\004Rp\024\254\241\nQ\365\350\204(B\202v\025\244\240\003\177\243P\245\244\357\253\3243\232\256m\266r\r"
+	.ascii	"RS\240Lh\364\307\200\204S^u\271\032\226\314\\\267\262\246\013"
+	.ascii	"#Z\260\370e\210p\351\026\355|\002"
+	.text
+	.section	.gnu.lto_busDeviceDeInit.29.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\365\n"
+	.string	"\026\024LD\020\307j:\200\330\232\213\307\325S\342\240\345\b\247R\211P\364\305\361\\\035^l\223\020@<\343\334\316\200\f\306\301k\214\313\214\005&t0"
+	.string	""
+	.string	"H\001J\301\2114\245\025`\330\314\020t\232g\315\332\221\354\224\0024"
+	.string	"7"
+	.string	"="
+	.string	"\246\330\274s\275\307{\267\271\203\367\316\246\315\340u\265\217\035H\221\325v\027\344`n\236\232\376_O@\245NN5\034\273k\212J\265\334\334mO\330\376\330\337\b\365D\271\027\373\231\335]s*\373\256\237v\037Z\255A\004\202]\226[\204\235u\006"
+	.string	"\330\276\375j\332\034\233A\245\342\364/\277u\001\346]\2467\354\252\b\024\330\255\026\001\035\326\354\245g\223.+7\n+\210\325\203\223\336\254\t\220\340\325\244\307J\252`w5|\230\t\211\277\025\232K+\346\235o*qy\224\flA\255u!qR\233;\254\n\301\301R\233\035\0161\3020C\024A\337B)$r\006}$)\004\3111T\022\215\"\b\"\362\370"
+	.string	"A#\t~\017\036\205\204Fpd4\032AN=\237YN\325\361\232\235\334\311>\351\331\"\037@z\002\020"
+	.ascii	"s\2212\023\257\360\3212\314\005@\022P\307\250CFL\025\f5\021J"
+	.ascii	"\330\370\231\205\017\243nbB\b]&\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_busDeviceInit.30.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\275\b\035."
+	.string	"\nM$\021F`\034R:\303\034\302jSy\331\006f\033;u\251\007Y\f\373\350\367\0017GIA^\230\033B\377\266i\363>\263\270\t\367m\246\301$6\270R'\225\036\007\"\277\rz\330\314\376z!\217\325~\311'\204\354\235d\374"
+	.string	"\363"
+	.string	"\376"
+	.string	"_\373e5\272\203\177\352\016v\017\337\210l\027&\025(3\271\262\030\205!\256\267{B\205\247oi:P^\306\031\321\020%b\262\034z\030\332\257\303'\361\336\356\217=\313\323\241N\375\313y\013\214Z\316P\b\315\240\375J\244>\354\317\247N\016\200zY\371\342\336Hq\231\346\f-6\364B\354\327\366"
+	.ascii	"\330\257xI\003U\350[x\223\367\021\006\201\277\326\307\256*\276"
+	.ascii	"\311>\324}\316~\247\252\226W\230@\211\025\326\203\017\336\236"
+	.ascii	"`@_Q\332U\275/=Y\377\031\371\026U\021V\210I[\223N\260E\225\205"
+	.ascii	"[\025\200\233*\\\227Re\251\304\25324O{\002)TW\327\247b\020\273"
+	.ascii	"\362\205\311\242n\301*\251\313\022\345\234\327\237*\035QWU\035"
+	.ascii	"8\337\202\\JuD\025Z\303\025'X\305\274\370gw\340\234{\342mYa\375"
+	.ascii	"\372\212r\316}\233UV\357\237w\177Aw"
+	.string	"\233\350n)\004)\376\266\242\315\231i\241\177\006\006\213\326\311\021#x3\246\274{-\214\242\221\34288de\030wu\031\243\205\271\234\243\336\354\273\235\f\222z'_[\311\310\276id\277\336\354\217\242\245<\273Je\313gF\372\350I\210A\301\273\3137\257\033\272\274\270\253\373\n\260\250\3005N\322=t\264w\320\267\374@\207\376\303\223\375?}[\b\274\331\373'\274\335\006o\373\204\267\331\340\355\025x[\r\336\306\300\333\367w\373\006\004\3009\261\270\350\260\033h\376\261\247'\303\255kO\216\366\233\275M\314\205 \323\257\3258\230~\230\013B\346\234\317\234s\360\253\232\232\257\240\331*\203\323\313s\n4E\354{\265\032GK\016\200f\253_e\251=\247_\207w\304\376\227~\032\035\264\244\217\270)\t7\304\276\227\376\331p\216x\263\343s\024\325o\310R\216]\316\320\007_\333C\033uB^w\332\307\353\272"
+	.string	"W\234X\277\023\373\365w\272\273n]\343r%g\250;\353n37 b^\275\016`\006\244\005{\035\037n\223a\277+\341\303\304=\026w'\305n\227\314\302f\305,\276\224\336\206\327\225X1q\217\212\273\215\036\307\311N\363Ny\367\350P\304P1\204\257\261"
+	.ascii	"\321\274\037\356>\372\334\261\3159[\350\263Q\321A"
+	.string	"\200\327\202\257+\337\264\300%z\237a\037\\\210\273?\200\270o^\255(\f\325\307\362 ,\304}\243\246,\203D\355\250D\344\334Z\225\005\342\037\236J\262A\370[Z\350~\242t\244A\370ho\322Rv\210\307\211\210\301\002\302\\\020>\360\264\337Gt\016+5\375\362\001a\214}\364F|M\t\214\177G\255\303\312R\254\023;\304B)\3568eV\300V\334\325C|\361mc\342iP\\\254\341\353O\002=#\247\342\256\376\301\307H-o\2307Ow\0078\214K\030y\264A\343\005R\211\311\270\004D\032g4\035\327\026H6p\223\213\333I\023\222\222*,-)E\0302\335H\302\255\024\201\351FR\221\ti\304\361\002\271T\234\361\002IFQ\t\311T\214@\240\2174\214\310\242\215\343\021Y\fB\225\307I\344~\361\262og\215\017\356j\rt\301!\034l\336V\002\342\251\276=\214\355\345\201\244&\251"
+	.string	"\261\321\033\363\346\341\200g\013\210\213\2247\357\302!|\263\001\007\300\002\361\020\376\177L\305\324.\23283$\301;jnZFw\307Z\037])\266>\272:\216\355\367|-\214\232\352\2465\315\003\304]c\322>\333\355\224j\214\356\322I\310\253N\030\034\336\235\231\277\255\217.\324Q\350e\300\253\016\026i\036\323G\337;\256>\354\234\317\276\023+}<S%\243\233f\tD\312\266\003\243`\322,\346'\302\264\360\350\260\235Hy\363~rlpxw\031\317\273\b\352\356i)_\262~\270+\257\257\247\003\200\265\250q$E\235B\250FF\202$I\222\016\220\002\221\2512n\022"
+	.string	"\3465g%\021\021\221B\005\365\3102\007\363\351\201'\bL\263\365$\353+=\031-f\347\235^I\360)\265y%"
+	.string	"\020f\f\251\245L<\211\020\256,\374[\f\327k\211\222\243\332g>-\243E\202\213\335,\035Z\373\214v\001\310\224\b\n\022\345P\337m\236\273\325\220\037\324m\001\207.Mz\321\376\314Y\3044=\357\302\270\217:b\033oE\"\245\237\221\266\256\204\204\273\345\217\267\367\267\226\002\303\034\361>\262\035O\021\275\026p9\373$\325 \005\bJ\032 \007\353\206kM\002\252\325\034O\243V\301eaV\364\334\340\305\222\266~z|x\266\310\300R\323\360qv\001=Q+#\324\352sJ\234\020\317\375j\232\375\270\326\320k`\016\267U\230&\254\333~\b_\300\231\234\220\227J\357\332\005]V\315"
+	.string	""
+	.string	"1z8\025\004\250\315\216\317\027\216\022\357J\251GK\235\317\250\033\275\334\037R\217\024X\322\307\255\332\0076q\301\323\361\230\2268\3351<\2501~\301\271\350\023ysL\026\004S\207\274\177\206\361.\251G\354\220\177\375\215l\333,\f\243\360\243O\022 \023~\320u\350u"
+	.ascii	"\230\033]\346Q\330\224_\233?\021\212\2228\230\2637\257(_b\344"
+	.ascii	"\253\314P\274@\177\re\2020\333\177\331\314\037"
+	.text
+	.section	.gnu.lto_busDeviceOpen.31.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\265\004\265\036"
+	.string	"\206w\303G\220\334McI\204\263\376\371\266\240\031\003\005a\351\201\032\335t\273%\304\335\354\310j\301\026\256\370\235\350-n\034\377\224\372\rn\231}V\025D.\002\363;M@+8#\223\277od\b\235\335\204\226\264\275\367\336R\246\024\260"
+	.string	"\244"
+	.string	"\260"
+	.ascii	"GO\215<\2737\270\005\345\336\364\306\r\316\2236\343\215\334\352"
+	.ascii	"\310H\006\322\034@\363\353\212\023\326\231{S\235\323\023(O\236"
+	.ascii	"\027P\236\2648L\323Qe\307\307\364F+\322k(mv\232%"
+	.string	"9\332\212\344'\275V\214\222R\252\350\202\033@\031\247\231;\367\336\033\023\330X\020(\365\331(\341H\021\252\333\253\241\225\003\211\202Q\317\003\211zQM\247Z\332\334{\321_S%o?\246g\275B\375\232\3528:\230\341\325\342\304/(F\305\030\tl\261\021\206\376\226\252}\326\035\364\320b\205&\b\224\361j\356\334{]\237~\300\333v\373\005lk\260G\n\001?j\370\262>\n\t\036\3534bU\361V5v\232T\255\320>\0021\027b\266S\366\355ZK\376\332\323\037\375\325Os\365\371\341m\226\325\345\265n\362\254\036g\325\366\254\256f\365q \306\234\031\273\311r\357\212\2625W\013)\305\307\265\376\341q3r~\023\237h\024GC\013I\305W\026\f\347I\034\213\234\317\304\3172z\022\327\"\367a\357\267)j\346\202\311k\314\275\351\203\223\256p\236\274}d\2436.E\216\2546\204\bG_Rt"
+	.string	"W\211K\f\035\262\234\275BA&\341<y#\223\253\325>\222'\t\307\322+\355\004\260\032\226\261\340i\205\036m\265\017j\270\227\321y\357\315\361\273v\033\220l\001\252\0331J\321f\257\365\242\032>s8W\207\233/6\233\340\304_\0051\t\003+\257\027f\315Zk#\363p+\037\254}\231QL\352:\225F%jkE\3534\351\016kB\244\212\264B\243\266\332\352\005\304\251\204\250V\207\352\237J\273\272\214VhoyJ\300\226j\032\333<\227\342s\336\273\224\343G\031\3729y\364\254\0020$\276Z\346\032\321\210\345\022\346*\313Z\341VP\316\227{\233\376\344;\371\023\021\343y\2344PP\371\247\223~Py\362\303?'~v\226'D4\004\304\363\351\375\354h\"x\210l\321\210\352\036\b==\021v;\037\034\\\317D\217\265\017N\317D\217\256\307\3739\001\304\333\351J"
+	.string	"\361\220\320\371\360z:\234\003\026\032\372\341\351\210\204\204x:4\275\267S>\326-|\211\r\267\320_\371\211\237\205u\221\315H{Z(\333\247\365\216\317*\211\251Y\241u\300\320n\026}\252\0062-T1\350\334r\301\264\025\274\226j\032\013f\202\246\335\361U5\037\357\315~x\033_Uc\003\027P\232\366f\337\024D\251\226\005(\203\252\252?0 \315\n\375\260.\262\323fI\013e\017 N)\232\213\213\310\314\264\245\265C2\004[\250q$E\235R\204D$\220\221$\"Q\007\220\002\021\261#z\020@\250\246(i3\363\375\345\340'\215\202EF\213p\321>\315u\233D\0310<2\2153\371R\013G6\256\036M\001\224\016\227\315\213/P\267\266\b"
+	.ascii	"\205\374\236\001cL\304\272..\016\225\361\264\226E\253c\336\271"
+	.ascii	"\0350i0\352\025\025\022@OBA\274\024\211.w\241L\200\203\261\351"
+	.ascii	"\300\362\372E\214\236\247p\214RQ'\204\277\337\207\365k\357\017"
+	.ascii	"\220\307\241E\256\\\\\b5\304L\3623\341*\r\215\242HQ\374>M \023"
+	.ascii	"\032p-\030\233!\312\n\334}V\326\367KgQrW\273*\300G\023\356?\301"
+	.ascii	"\377YO\3604\030\267\351\274\202\361\003"
+	.text
+	.section	.gnu.lto_busSetSpeed.32.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\325\b"
+	.string	"V\220=: \0057\035\200\241tKC\220\265\343\021\025v\326\266K\n\221=\370\001\334\312\006}\217\257\245\240\373V\241b\274\t\004\b\231"
+	.string	"\215\200OX7\322\203\203\006\356\310$o\273\355\235R*"
+	.string	"."
+	.string	"-"
+	.string	"\234O\207v\352\025d\177\252\3218\321\354.\225\037\017\037C\377(\357\214H\242\307"
+	.string	"\207\335u\034\2218ny\333\b\266\037l\273\0046\006\343\211\365&\341O,\334\331\355H5X\237\007\025\246\342y\264O\362\222\360\246\213\017\354\226VXv\253\202\023\254O\327\027p>\255\023\004+K\206\030Aa\310\f_61eFf\343\215]EQz\330\257vw-K\366M\177\224\230H\f}\331\335\b"
+	.string	"`Q\263%\304\366\257\\\327\201\300imA\323\0308n\313\004B\035'\275e`\205F\301\257\013}>\216N|\"$\350\366\20143\260\007\352>J\341y\037\275\352\276\n\r"
+	.ascii	"s\221\"\023/\373\242\341\242\257\\\037\327(f\230\r\204\357\324"
+	.ascii	"(8\306\247\232\006'yqM2"
+	.text
+	.section	.gnu.lto_busDeviceReadScratchpad.33.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\356"
+	.string	"\035\r"
+	.string	"\306\030[D"
+	.string	"\221(\035\340\030\023\007\370\371]\241\277\2341\214`,\204U\373\037\232\\\006~\262^\361Q\323\341\232\342\177d\007\003\252\007\330\r\215\332\327\003TU\2537\330\327\034\345\f\270cdM\034\203\201m{o)S\nF"
+	.string	"J"
+	.string	"D"
+	.string	"\257[\341\342\213\207\222\0243\273]\366q\003\361\360\335#\036*\210o\177\232\233\377\223\021/,.\365\027\200;\271>\017\224\025\261\016\267z\236XK\312]\236-\216$s\023aw\235,\216\303\ro[\202m\b\366)\004\233\223\311\f\r\0076v7\324\344\330\027\320E\210\303~\033\345\273\270\243#\302c\303F\276\032L"
+	.string	"\260J>\304\354v\n\016\375\200\323a\361d\3327\361\023\250w\031>`\3275\243\305n\267\300\t8\207\3568\266}\022/\201\362\026)\252\254y\306ZP`T_\376H\204J"
+	.string	"\205L\f\031\253\304\341d\001\003\003\352a\377P%\215c\252\332'\fy\026\324\t*+M\271@\215\230\0332\2334v\227J}\331\177\253.\333\351xX\367\253\323\017\244\021I\rb"
+	.string	"\0025\020\211B\037\001\"#\221:\3641\235@\231I\033\211\200h\242\314\002H\005R\026\322L\331\347\200K\027FZ\026R*iYG\267\177\253.g\372[L\215zm\351;\250\250\224\344=}\251\b\331\020\254\260D}+\024"
+	.ascii	"sI\351B<Y\005\340\t\261\306\345\222\336sY\353Q0\036\327!I-\355"
+	.ascii	"\302\3706\353\247\315\\\322X\017)b\211*\036\334\005\244\032\214"
+	.ascii	")\247\306\245\240"
+	.text
+	.section	.gnu.lto_busDeviceWriteScratchpad.34.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\n\001}\r"
+	.string	"\006\331\\E"
+	.string	"\221(\035`im?tC`f\003\350\023i\3726J\023\375\366\035\327G\252f\021\016v|\273\246\370\037X\201\265\325\003\254\232=\220\030\355.U\367V\363\372\307G9\003\376\232L\362\2364\224h\262\211\224)\005E"
+	.string	"J"
+	.string	"F"
+	.string	"\003\262G\355!\331\243A\273\306\303\227\275\n\021+-\233\335\335\024\304\301c\232\240\377\3269)\225\351\030\207+\026\302\302\302\325Q\2410\217\013\246\303[\317\013*\225\314\017\006\273\353L\2516\334\361\266\037\330v`\377\0137=\226&\276(q\326o\377-\203t0xl\026\312\327\202\006Nj\205\204\215\335\320\300\243\033\270c\362dx\024\340eR\314\331\375\360Z\240=\216`"
+	.string	"rx\236\366M\374\004\370\230\n\027\260\273\2021\263\033\036p\001\355\321\341\003,.T]|\224,*\227\202\006*y8[\304\220\021\365\254\217\234\362\345,Um\322I>\0255B\013JM\026\251\231\331\201c\363e\207\246T\027\373\330\356\256ue_\346\317\316\212\371U;i\261\271\241`\306n\206!/\244\036I\002I)\232C\300q\t\272\016\364\tP\362:5\3503\"q\333\350\363J%_\267M(!\tm\240o\264}\bXD\301\3736\023\221\350\333@\302=\266\272\202PCsR\025,S\177\205IJ\347e\204H\b\017\247\274q\247c\323\005\023\026"
+	.ascii	"s\22123^\323hH\\\310\207\025P\3738\355\362O\200<NV\222\n\245"
+	.ascii	"k\004\005\033yaW\236\202\354\023\342\005\341;5\n\216\361\251"
+	.ascii	"\246\305I\236\352\312)\205\332\003"
+	.text
+	.section	.gnu.lto_busDeviceGetScratchpadMemory.35.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\016\001%\r"
+	.string	"\026\230YD\360\224\223\016\250\005\336\005\017\305i\342*\222BE%\200\264\037\023t\235\216\035\227\230\261\224\241\207\264G\3060,\177\264q\3523\3465I\007\236\201\315\314;x,\016\322'\223w\340\326\300bD\342\336[\312\224\002D"
+	.string	"B"
+	.string	"H"
+	.ascii	"\021&\005\003\343f\267\303\334\335@<\264^ \036j\211\223\3764"
+	.ascii	"I\376i\376T\244p"
+	.string	"\234\270\322\037\210\353{\340\203\023Q\302\231\336\365\001\310\216\323<;p/\231$\022v\327y\342bnx\333\023l\243\330\037\005])\225\204\375\267\212\2625m]\365CMg\246\017`\303\314\315\020\224 \273\036r\216\354\n\332Ha\233d_\266\200\025\203\347U\243\023\330E\341\324\330\355\032x\201uh\333g\361\024\311\376\201\2403\021\023\020\3368\325\\\031\340\026\242\311U\242\r\312\220?\245~\205\f\007-Y\263\021\342\034#\210\314\250[\3425{\321\303\224El\207\356b\305\3325\235\370-D\032,\024\207\376(\036^KN\250\\2\307&6+\234\232M#v\316\034d\031\004M\363t\006\260|4\265\247\023Z\311\260\320\366aI\3314\354B\n\005\025\314\263\205\260N\002\2030|6L\004\002m\330\325\355\337*\312\322\b2.\3722\343\200\2254B\350x\2512Z\254\335=\361c\210>\nxT\210\017\027"
+	.ascii	"s\221\"\023/\371\321@&\026.3\031#^\311]\031A,\273\353\305akX"
+	.ascii	"\245F\361\326\020\034lEa\227>\314\3313\326\271\f\017D\361\230"
+	.ascii	"0\213\237\031\255ji\212\246\240"
+	.text
+	.section	.gnu.lto_busTransfer.36.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"U\013"
+	.string	"d\023)\001"
+	.string	""
+	.string	"N"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\364\263#\001\307\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\315\247\001\217\250\300\001\177"
+	.string	"}52"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\023\001\b\005\001\006\025\001\300"
+	.string	"\005\001\b("
+	.string	"-\300\200\200\320\315\244\200\200\021\001{\276\001}\275\001\274\001"
+	.string	""
+	.string	"\002\002,\244\r\005\001\b<\354y\300\003,\257B\233\303\204\200\020\030w\302\004,\272\r\004 \005\001\bH"
+	.string	"-\200\200\200\320\256\243\204\200\020\004\325"
+	.string	"\306\001}\305\001\304\005,\305\r"
+	.string	""
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\367<\361\370\220}\002"
+	.string	""
+	.string	"\244\003"
+	.string	"\200\200\200\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\362\371\240\373\024\342\266\017\270\272\320\017"
+	.string	"\203\003\202\260\371\270\003\006\177\001\200\300\013/root/repo"
+	.string	"\031./src/main/drivers/bus.c"
+	.string	"\003dev\017.cdd5bb2b"
+	.string	"\005rxBuf\005t\006length\026"
+	.string	"R\"\314\345\264L\333`\344\211"
+	.ascii	"`\b\t\306\201a*\347X,\245k\210\330D\017\304\200\023mh\004h\006"
+	.ascii	"\303@p\240\032\270\002\t5\346uM2"
+	.text
+	.section	.gnu.lto_busTransferMultiple.37.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"U\n"
+	.string	"\246\022H? \345*\035"
+	.string	"\234\237CS\rd6\030\373S \236\301\016\2130\003\0374\005"
+	.string	"1\337\361\336@HV\001\250!\024\2433\226\240\004\001\244L\r(\242\035.\3153bq\230\275\264H\2156\331[\2463"
+	.string	"8"
+	.string	"6"
+	.string	"\006\030\266\377\017\n\2257\371\364X1\254%\203v\353>o\205\261\311\324<3\215\031Bf.\333I+\305T@\324\335\247\032\255\r~\345\377\r\377#~\356\002)\035\247U\256\217Zw{.\362\330.t\032\\\247\236\025\t\234V\3118\036<\266\032\227\016\245?\2170I\311%\026L\320\375R\251u\237\236;xl\1772\002\206\255\307\001\025\343\005\254"
+	.string	"\233\033\313A.\206\003\320T\300\177\246h\355\370\271\353\356~}\375\224[\254\333\013\204\255{\225\033\320+\026\005\344\177\371g\376\001U\2473aY\311\263\007\246\322I\004-H\206\365\037\350\373Ba\b~6\250QX\017~\310\323w\311q\204\"\215\341-\221$&.8\222\367\243p\221b4^\223(\2167s6\233\230*\202\213]\004\020"
+	.ascii	"s\221\"34\030A\"\200\026B\202\271*7Xl\252k\336\320\004\n\304"
+	.ascii	"\200\023Nh\004h\206\204\232\363\272&\031"
+	.text
+	.section	.gnu.lto_busWriteBuf.38.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\355\t"
+	.string	"f\022E;0\257\322\0010\232\3149\0135h\004\"?\206\365p\031\301z\315\242\304:\315\276\315,\246\342\367\307\233\275f\r\tDJM\220\362K9.07\3239OV\242\226T\022\264wJ\001/"
+	.string	"7"
+	.string	"2"
+	.string	"/\360\336}'\360\336\331vH\364r\371\372!;H\306\205-\267[A\352\361\362\263\364\003f\260O\200\321\356zb\3144nz\333\b\266\035\354\323\256{6\326\022\302\240\362\351NX\006\236\265@\221\215\276w\035\222\317f\276\272Lw9^\026\276w\035\221\317\234\366Kn\362z\215\342\003\273\264\225\333nUp\302\367\3165\245\347Q\005\215\371\266?\314n21;g\354\n\233\264\303\376fw\327\224f\277\366O\372\215\232\203ip\331\225\325\320,K\207\033\261\375\2629v\007\227\022\020+\023j\214\360H+\222\2701\215$u\030\nC\221(\226@\002\255Q\244.\201T\254\020T\221c\353D\212 \352D\222"
+	.string	"K\244\n\004\035851\222\340*\225\"AN\335\007\017"
+	.ascii	"s\221\"340B5\300%\204&\327\224\244\t\021\224\bF\2000\276*\034"
+	.ascii	"\350\234$\334\203\204\032s\257\222\007"
+	.text
+	.section	.gnu.lto_busWrite.39.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"\005\t"
+	.string	"\326\020?:0\345(\035"
+	.string	"\326.\021kDeIF&\352\313\254\005\tj\333l\300_\021Q\306\217}h\343\237q=\235IL\244\321\200\362/\345\235\357U\034(\305\b\323\006\204\221M\366N)+"
+	.string	"0"
+	.string	"."
+	.string	"/\310.m\233\3231\371{\005A=\204\225q\322\332\2553~\374;\374|\201\324\3510\300\263\273\206\032)\325\035o\033\3016\203\355\226\233\235Q\225\270<\332e\006C\203\301W\n\307\335\216\225\005\355r\003\240\201\320\376\310ILgU\234`w\205\222\262[\025\234\240]\272\336 \273\324\002_f\217E\274\360M\356\260\26110\013\003\330\365\004\243\207}lw\327qe\237\365\303x\016\227\326K\303k\027\365r-\213T\021\261m\262\003\037\322\247\303\036<\032\315q8\256\323u\240\315@\311\353\242A\233\321\0047G\324+\205h7#B\037\210\t\242\243\2719\260H\302\243\223$\022\321\271\325}\r"
+	.ascii	"s\221\"340B5\300%\204&\327\024\225\t\021\024\001\343\002\235"
+	.ascii	"\223\204{\220Pc\356U\362"
+	.text
+	.section	.gnu.lto_busReadBuf.40.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\365\t"
+	.string	"&\022E= \345*\035\200\021\357\334D\271\b\001\270\322`,G\001\200S\035p\\\tz\003hL}\303\224\n\336\222\336\212n\216\004\nH\024B\230\244l?\255\022\213 \303\343\355\222l$A{\247\024/"
+	.string	"7"
+	.string	"1"
+	.string	"\006\336;\316\013\274w\266\r\n\271L\276\004\211=$\207a\303\355\226\225~\234\374$}\001\331\3533@\264\273\236\032\262\215\233\336v\202m\007\3734/*\255w\026\0263k\270y:\224\325Ag/R2D+\236\315|\3312\335\235\3110p\336}%\2369\355\233\374\304\365Z\305\tvi,-\273\345\202\0258\357\\>'=\213,(\314\267\035\202c$G\263\263\306._\223z\330\337\354\356\232\322\354\327\376IO\322\201\233yp\331\215\005"
+	.string	"\2600\335M\304\266\313\376\354/\021\252\322I\224\360F\252Q\270)\211#5\b\002\301P\030\222>\003,1\244&}R+\260\246F\221e\032\303z2\215&*iL\325\017\202Q\024\342XU(\324X\277r\003\020"
+	.ascii	"s\221\"340B5\300%\204&\327\224\244\t\021\224\bF\2000\276*\f\206"
+	.ascii	"\001\215\234\204{\220Pc\356U\362"
+	.text
+	.section	.gnu.lto_busRead.41.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\005\t"
+	.string	"\006\021?8@\217\322\001\214BI\346\202\243\002\323\037\243]\243\005\210\232\243Q}kfv\304\206|\357[\273\342\271\372\221\330\351\032+4b?Wg\346\036\213\350Q`?\"\233\354\235R,"
+	.string	"0"
+	.string	"-"
+	.string	"'\320.m\233\3239\371{\335H\235\243\343\242$\266[g\324\370w\370\371\001*\324!\200gw\r1T\253;\336\366\201\355\005\333)\001\336\354\215\245\221#%\030\317J\223\301W\t\307]\026\212B\346r\263\320@h?\344\"\247\273&>\260\3332y\355\326\004#d.]_\240]f\002\036\212X\341\223\234\341\003\326\302\262\320\305\256(\0303\354g\273\273\216-\373\256\037\306\203\274b+\r*\273\251\230\227\205\311\023\017\333\267}r\037\322\247\313\034<\032\315q8\256\323u\240\215\200\311\353\242A\233Q\211\233#\352\231B\264\233\020\241\317\303\004\321\321\334\030X\024\341\321I\022\211\350\334\352\376\323\034\r"
+	.ascii	"s\221\"340B5\300%\204\206.\003\202\302\257.\003#\200\006I\302"
+	.ascii	"=H\2501\367*y"
+	.text
+	.section	.gnu.lto_busSelectDevice.42.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"=\007"
+	.string	"\022N34`W\032\003\320\302\257\320Ai.|\034\3005P\322j\022\246\331t\201\020\231)\031\255L[]\267\367\022B\024M\226\256;\272%#\262>\255\021B6\2212\245\265\030,\253\001\303\256J`\224a\260W\265]Xq\223\331H$\261H!\222\230\210\227\334buP\255\"\223\321B\323d\f\315\273s\330\025\242\346\224\0015\372X\\b\376n\332Iz\360\243u\347\377\013\273\366\031\320\300D\240\374\03498?Q+\"m\035j\003d\024\374Z\217\230\204s\t\206\007\376\256E\345\237\013M"
+	.string	"\231\352t\201\307\024\310\004\036S\345\332\031\317\220;\345e\343\304\346\177\204 \346\374\270\332&\006(\231H~\237\207\377}%S\207\013\335\026\241\255C[\217\b"
+	.ascii	"s\221\"\023O\364\242\305\005K\227A\276\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_busDeselectDevice.43.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\b"
+	.string	"E\007"
+	.string	"\022\21635Pu\032\003\200H\030\225\223\203\206\316\f\211\2120ia\261\257\f\3673f\344 \202\261>\r*\370\336{\204\250*\375\371\032'\200\020\356\037\bd\"\264\211\224)\005\265\030,\253\001\303\256J@\224a\260W\265]Xq\223\231($\261H\021\222\230\210\227\334beP\255\"\223\321B\323d\004\315\233s\330\025\002\344\224\0015\372Z<b\376j\3329zP\2445\347\377\013\273\366\035|\300D\274\374\03476?Q\246\222\266\006\265\001&\005\277\326&>\341\214\202\341\201\277sa\371\347B\023>\246:]\3201\3651A\307T\271V\306\223\344^\241\331P\231\371\037\341\2109?\256v\212\001H\245\221\237\347\341\177\037\251\324\341B\267Eh\353\3206$\b"
+	.ascii	"s\221\"\023O\364\242\305\005K\227A\276\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_busIsBusy.44.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\020"
+	.string	"m\007"
+	.string	"\242\01655Po3\006"
+	.string	"\3179\231\3066\021\207\033\226\030J\tO$S\265\226\375\"\206\335!\330\374\222\021Z\214\210EEU[\253\345\256H\305U\360\360\3354\036AR\246\024\275:\327\345\3112\314\022\biY,fu\023\227\3548-\004\3422\t\001jx\220\030\327I\313\240[\204\306I\211m\343$g\336_\325OE\264\250I\314\200r\202i9\214i\247\b\306\215\326"
+	.string	"\377\337Xjm\262a\264\312\351\205\305\301\345\037\315\310|\205J\001i\353\265\234v\023\222"
+	.string	"ak\021\217x6Qx\340/\231\234\374S\241\b\032S\235.\250LiLP\231j\333\216\307\353\347\3311\362G\306E\311\313?e\344\360g\370\325\033\222\3100\340\363\277\020\203\244\341F\267=h\273\320\326#\b"
+	.ascii	"s\221\"340B5\300%\204&\327\024\t\016\021\357U\234"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\t\001-\006"
+	.string	"\324\b\005\002"
+	.string	""
+	.string	""
+	.string	"\002\034\177\032\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\035\177\033\036\177\034\340\265\234\"\005.\035`"
+	.string	""
+	.string	""
+	.string	"\005-\036\002\037\177\037\356\226\356\034\002 \177 #\177!!\177\"\"\177#$\177$%\177%&\177&'\177'(\177()\177)*\177*+\177+,\177,\001/\177-\377\037\001\220\316"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\220\200\0010\177.\003\002\023\327\344\227\004\001\244\013\003\007\024\260\366\236\331"
+	.string	"\001\244\001\003\b\007B\003\t"
+	.string	"\027"
+	.ascii	"-2\250Z\303\360\251\254J\231\307\271\032\320\003|\003|\003|\003"
+	.ascii	"|\003|\003|\003|\003|\003|c\252o\3007\336\360\021\244\232\253"
+	.ascii	"XH\252\316\200\037m;\307"
+	.text
+	.section	.gnu.lto_.refs.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\002\002\002\003\303"
+	.string	""
+	.string	"\002\004\300"
+	.string	""
+	.string	"\002\005\002\003\034"
+	.string	"\002\004\031"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6d529b7b35f8576e,"e",@progbits
+	.string	"(\265/\375`\262\032\245w"
+	.ascii	"\372\3028+T@\020JJ\007\352\355\344"
+	.string	"b\326\237\2319\033\213\bI\325.w\313\362\222\321%\016b\325\237CkWW\327\342\264\256J*\322\267}\003\373\205\231\031\230\027\254\031f\034\362Gd\017\313\"\237\250\332\377D\321\031\244\225\306fP\235O\324\266\034\021\261`\226\021\"e\n9\002\242\002\270\002\367\242ne\301\001\326e\375\300\034\354\352n\320\324\232\262\272\216.E:1/\331\275\255O\r\232\263\031\245\325\271\366\347\306+\307\020\316\312zv\022\205\247\244N\345\352\004\316\fo\311\023\n\027\2112&\333\031\366\334\"\334\023.3&s\302l\034\306bC\206\263\273\347\257_\210\331\230\n_\3311\266w\371\203+c\260\237k\370G\220`6\316\3027\354\f\333\013\365\343\321%\t\205\340W\302_\314\3066\374\316D\223\362\032\227\210\215 \246IJ\201\336\333n\3417\216c8\346\302r\354\306m\354d6V;c\341\265\377\264\027\304\317\315\336\236\215:"
+	.string	"T-*\016-<\206\374X\317;V\376\341\344z\036Va+<c\315\032\274Z\375\213*K\234v3&\t\021\271V\257\302\312g\214\306N\226\362\363\023\206rU\214y\237\367\266:)\021\207\226\263V\317@>\036\006\362=\305\372\201;\370\3246\021\326\203\2602\023n\302\316\003x\354#H<\035\212\335\257{[\036\2354I\322\350\265\372\f\326\363\001>\336\343\003|\247`\355\341\016>'\213\375B\020\234[\3465\336{\007\270!\352\330a\243\325\234\020\347\366"
+	.ascii	"\210]\022\267Y\337k\017s\360\375p\007\337[\356\340[\231\203o"
+	.ascii	"\231*\360T\300\373O=\034y\206i\372\002\031!]\322\032\321\177"
+	.ascii	"\337\337eX[\377\317 }\347\357\035F~&\001\210\t\277\277\265\236"
+	.ascii	"\376=\305\001\001\177'\367\376\303\375\314\177c\035Z\377\331"
+	.ascii	"~\376\361\237\313\317\003\374\337\362\263\217\377q?\367h\340"
+	.ascii	"\277\001\377\251\374Gc\340o\026\376\243\341\277\375\372w\321"
+	.ascii	"\317\025\360x\315\337'\374\234\365\363\325\317\313\237\237~N"
+	.ascii	"\376|\374y\370\363\013?\013\177N\372\331\350\347\024~F\361s\b"
+	.ascii	"?s\360\363\005?[\360\263\211\237\205~\006\3613\316\377\271\237"
+	.ascii	"\323\237\027\370o\302\317\004\374\374\363\037\357g\017?s\370"
+	.ascii	"\271\347\377\330\377\264\237u\376[\371\237\367s\316\3177?\333"
+	.ascii	"\374\274\376\374\373O\367\263\357\347\232\237\325\377u\377\203"
+	.ascii	"\376\257\375\007`ooo\357O\263\376t\350\017\340*\2346\207\304"
+	.ascii	"HdH\007_\254\316\272xo\312\236\302\234-\204\313\340\324\315\270"
+	.ascii	"^\256\254=Q!\332G\377xk9[\253\201\254\367^^\222\244\212B\257"
+	.ascii	"T\025P\016\2204\274&d\336@\356%\347^\003j\334\272\206\230\265"
+	.ascii	"\372\364\310\372\367\357\273D\345\275\227FM{\321\2129\f\364\353"
+	.ascii	"p\312\t\374W\357-\201w/\022\2561>,\315\2501\375\341bp/\n\244"
+	.ascii	"\261\251\364A>\211C\237d\333\\\"\237\315\245\317m\305\242\356"
+	.ascii	"3\353^\244\2219l\342m\357\262\347\032\233\313\365\022\361\220"
+	.ascii	"\355U\372\334\226\250\344\333T\"\311\210C\037\344\2639D>\231"
+	.ascii	"K\037d\333\\^\343\035\256F\261{\215\314\245\217W\333\274\310"
+	.ascii	"'q\331\203|2\207G\270\204\200\t`%F\225!\322xc \300\313\310T\266"
+	.ascii	"![&\243\335;$k\272\312\346\275UL\004\320\214C\206h\305\266\030"
+	.ascii	"~R\306v8\365T\304b\332"
+	.string	"\264\305\333\206\354b\266h\272w\356>E0\344\341\361\026\207|oS\253\274\267\310\\A\212\311\\\216\312\253s\215D\247\"\0263\247\251\310<\336\256\035\274D>\261\230BR\232<\271n\261\0352\327\235k*\327\347\260\275\310{/\213\3211\023\005\016\332\203\307\017\311\263FT\253Y+\336\f='\350\372n6\223\235\215\325:\252\232*\251\365\243\261\372\252L\013\257\261\332\252\247\270M\252\2754~tWI\350\017\b\020 v\332\343\035\330\252\276\301\254o\265\365=e}C\241\352\034\351\f\2601g\255\266_9PP[\314)&{\323\342Tl\265o4\016v~\255\243|J\251\366\222\355\244\035\313\326\232\254\207\201\277\346\243\3215T\242\227\r_J\232F+\263 \213\f\331j(0\355\216\334Z\027\345\223\023w\211\241\211\231/\032\347\344\231\344\350\272\345VEo\006\220N^\\\321K\306\357z\350\234A\ry"
+	.ascii	"O\213\343)\353(\245\233\252,\301B\003\261\325\277c\264Q\347\314"
+	.ascii	"G\332S\253]\374\371!\251\030y^\231E\205\3020\031\032pP\274\032"
+	.ascii	"\236\ff\214\211\036\032>\303z}\233\310iz\310N\336\3432g3\f\335"
+	.ascii	"\313\343.y\034\235q\244\302\373\332\343,\354\305D\223\322\246"
+	.ascii	"i,\007\036\224=\016\343/rS8Yl5\232=Q0k\231\227\266d\253o\033"
+	.ascii	"k\0035\222\314y\f\207\201RB6\327\356\034\303\234\325hU\f\253"
+	.ascii	"\335{\325$Zf\317(\020\343\331\030\333\373\264\211\023cE\006f"
+	.ascii	"\375\342\374\035\337\005A\274r$\261K\233\236\036;\b+\022\245"
+	.ascii	"\3254\006\017\227\330\362I\253\251\221\237`}\201\365T*\366E&"
+	.ascii	"L\312\212\263u\346L:\314\373)\311\341%Mz\237\016o\210\244\001"
+	.ascii	"#k\265\367v\236\222q\316V;\315\016\227\245U\264\325F\323S57\250"
+	.ascii	"\034\355\232\2548ve\312t\224\256\006\233\0334\204\035\363\336"
+	.ascii	"Q(T\2624[mh\233\255\313"
+	.string	"f\031T\253m\206\311n\354\276\254\245\201\2559W_\276\364\030\272$U\324\313\327~\231qD\314{\214\332P\006\264\325\016\323fZ[\254\230\2556\030&\343\033VP\035\2556^S\331T\001\t\203\246\246\310\232\303\026\367\270\276\343{\345\354\250\242^;_\232T\206ty\337\275A\355~\264\332vm\226\352\241\321ei\265\345\272n\210\207\027\255k:9\033\266n\026\017\032-uys\255Cg\n\254\013\315j\325\271\261\266\326\\|@\321\211\232KS\203\355\315\245\335\256d\234\021\322j\273uo\351\267\267[\267\345\030\333vS\357%2#\260\303\214@M\025!\304%>\3655Qk\337\320f?#\031\027\264V[KO\245I\212lEi\265\2634\225\316^t\357\371*\352\r)J\264\264\372\232\344\252\323\305\212\225V[yl+HkE\317\206\267Z\016\031\2544bZ\355+M$+\206\227\024\203\361\335"
+	.string	"u&\032f\335\261JKk*cV\252Z2\357\307\2247\025\006\303\202Y$\007\226UGJ\224(\215\266\372\216_\235w\244Qw\366F\373\035O\226\230993\365,\317h\006\266\356,\031\033\353'L\362p\2608\225i9y?\361uQ-m\264\332dmfC\205m\2060fe9nwlf5F\212jY6\032\356\310\225\267\"\353\016\027\247\263\231|"
+	.ascii	"\207\205\277\310\020\273\236o&\314\343\007\233U\253\275\204\257"
+	.ascii	"\354l\315Iyk\265\305xJ\216\3629w\205\311\260\312t9\303Zm\240"
+	.ascii	"B\274\303\302\032\354\247\247\275>\204p\371\252|\031\237\255"
+	.ascii	"^M\2566S!\3364\234\206\006\373\021\273C\016\307!U!\0068#\036"
+	.ascii	"\231\016\247\2529\304\255\325\257+\311a*=\330\\\315\351\371\320"
+	.ascii	"\001R\0255\205\314\312#\304\210\221\366\372\275\321QE\241\251"
+	.ascii	"\234\225\327s\206\267W\023\351\264\036xa\2556\022\276Rc\354\242"
+	.ascii	":\266\332Gx\212\f-#[\255v\027\223\371\222\\p\\\226\037\216\355"
+	.ascii	"\026"
+	.ascii	"\271\265g\030\244e\b\322E\370*\357\225\272\351\033\026\252\250"
+	.ascii	"\327\225\222\002\262\311j\312\320\243\271\336E~M\310\212\305"
+	.ascii	"VO\246\211\374\267\to!\002\006p)\211M\nRZJJZ**\200\025\022\025"
+	.ascii	"-!!e\220\304&\341\274\205\b\026JG@a0\2105bB*R:\n\002\006\231"
+	.ascii	"\202\004@BbRRZR\372\275X\002\266\020.)\375V\020\261H\252\220"
+	.ascii	"\r&\261I>\030A\246\023A\020\202>\302\"\026\211M\261\202\351\304"
+	.ascii	"\272\202\351\004\213\344\342H\210\304$\002\007\244\245\245\023"
+	.ascii	"C58\254\360\b\210\302\217\021\021[\202\007\030\300\245$V\204"
+	.ascii	"\024B\326\003\003\204l\n%\326\005\t@\"a\320\203\221\022;\004"
+	.ascii	"\003(\f\036\261`\201CCC\035t\212\204GJ \274\350\b\310*\261,\326"
+	.ascii	"GP\302\201\022&\\\370\335\304\004\017L\360\200\357&&\020\022"
+	.ascii	"\232\240\204\320\372\022B\251\260\205\220\205\022\213\004dW\004"
+	.ascii	"\225\210\200\036\2005+\230N\270 \254\021\016\261/\034\005}\354"
+	.ascii	"\220\021\313\272H\021dRq\303\016\001Y\245\027$\260E@\246\245"
+	.ascii	" \013\344\021\032\021\271hQ$$\002\026\005o\202C8@!\n#\035\341"
+	.ascii	"\320\b\bV\341\020\t \250\302\267\030\340K.X`\220pi\t\030\204"
+	.ascii	"#\034bAd\302\322\321O\351\b\005\013\300#_p\b\270$tq\004,\n\262"
+	.ascii	"\033l\020dR\321\001(D\301\026\035\261C6A&\025?v\210\005\022\275"
+	.ascii	"0\002\022\371\260.`\230\360\342\203\026X#\233 \013\"\244\025"
+	.ascii	"5,\210\204\251p\310\204P\351\210\351\227D\004$rQs\025#T\250 "
+	.ascii	"adT$\202\347\022H\240\301\207\023F\360`-\022\021dR\021\024\004"
+	.ascii	"\262-\034\001\215\202\224\216\210\222\202\212\200\301 \021?-"
+	.ascii	"\260FA&\025\276 i\226\315\224\335\r\252t\253\321\342\214K\352"
+	.ascii	"\200\244W;ma{Zo\241;d\270\255\342\224Achk\265Ec\346\t\222\264"
+	.ascii	"\007\230\317\351J\222)\255\332\330\355\370w\244Y,v\241|2n\031"
+	.ascii	")\350\275R@\352\030\2343\006\326\323\254;+4\240\274\265\2326"
+	.ascii	"[j\247\315LU\225\317k\275i\nQ\343iT\215\364*\215\313\271C\261"
+	.ascii	"\013\365;\263A\f\r\350"
+	.string	"EJ\001\3418\223\316-9\236^=\3251\202\304\357V/$q\304VS\253\247URZ\322\360\250\322*#<\2363L\255w@\f\307r\331j:\365\273\356\272s\002\323j*\365*9RrP\037R\351\rXo\305V\323\033Oq\244\351\340\321\\\256\177j\303,\216\212\253\325\373\234\326\373b\2547=\240\240\322\245\220'\252(\224\263\220\230!\246\312\247\313\325l(7Co\275\031K\237\322\2474\331s\213vQ\256\024K\023)I\272\365\206-\225\221\312H\223N\330\250\242\320\26297\273t\306\323\244\027\034wQ\364\324\326\0333i1-\246G\273\202/\250B\3018\311#\031\"C%\"\"\222&I\0072\013\020\206\203I\234\307\324\003\022 \0251\3239\307\310\f\211\264 Ie\331\f\206b\352P\352\227\344zm.$byoj\037\252\251\013G\311\363h\374V\244\231\262\274\267`^F\371Vc\220"
+	.string	"\300Zp\"\354\237\371\262\025\374\371\003G\312\212\341O\013\314\233b\r"
+	.string	"\373\225_#\b2'%\022\204\205\315\364Wv\313.i4\275_\245\310\251\017f6`\207\273\004l#\024\264\"0\216\243\313\317#\230i\3234\311\221\365\037"
+	.string	""
+	.string	"\260\376\310u\275\310\300\331\277k\235h\345\235HA4@\303:\207\251\301\f\372df2"
+	.string	"\304\330\300\265E\377D\206g\344\b%\235\037\353\342\330"
+	.string	"\204/\316\303\236fd\267\324VA\270H7E4\331\032\bm\304Rz\257\317\360\033\033\361\374VBS\022G\002\032\033\222\310[\230\347\204\274\261d\215\300F\210\375\250:\212F\207\336\001+t\t\226+\016*E\273\036i\033\377\302Jm H\0050\361z\374\032\355G\372\020JRR\212\214$dSJn)\004\217\351\247\2400\360\026\215-\314\\\232\311\346\273R?V\b(\363\325\023*\036\223B\310\217\243O\355u0\244VW'\022\364"
+	.string	"\230\307\345G\256\017\325\3564\266a\200vc\203\036\265]\362a\221\350\340\256DD\311\356\025\302\313\2312K\271t\214\334\227\240\221\f&?Z1\302\216\336\023q\2375\210OA\335\231\323\022\264\007K\224f\201XJD/\270B\344\rK|\331\214\027\213W!\241,\350wZ\216j\027\362H\002-L\346H@\027\304\003E\253J\246&\206\005\357\307\357\376\206z\024\301G\377$\323\272\277$\300\217\027z4\\\2135\027\374\335S\207\203\006\261(y\004\214\314\303\275\257?52\f!K\341R[\211\376w\343\304\200F\240\254\025\257\256JH\f\035\242\374\274(s\261\351\350\207\223\224J\323\364\310*\002"
+	.string	"i0\214\tg\314\370:\003\311\"\265c\353\253\034\253+`\b\307\t]&\316\363\034\323\262\212\363\311\2448\365\016AqF\225x\020\311\200\271:D\371.\333f1\203\030\352z\201p\021sd\220\240\335\245\357\326\325\031|a\212&\004$\306y\273\202\223;\356\022t\346\271\235J\256\253[\220\214\013\260\251\323\340)\025\351;\243&\221\242\220\222\261\352\226\236\306\200c\036V\3152\210\373\257\311B\207Fj\024\031Y)\346\312\203v\326\022 \203\001\017\336\320\203\354\256\244\006\204\364_\223\221cE@@\204\t?\225\003EU\366\273)\262\375a\t\212\341c\246G\313\371\363\275\007\t>-ks\361\346\251\350&24"
+	.string	"\374Xqy\240\f\323\fi\203\202\326ao\322\377\374\205z\376\203\027YpP\340!}V\212 \026\355\220\276]N\216\345\207\200a\341 -]rA4\302\ng\006\274\344\244\305oi|\035\220:\002A\3076\312OK\345iJ6\220\2178\301B\222\361\024[OD\231.\342\224\321K\322\363t\307=r\3431\374\330\356\033\276\227\001\331\032!\314\206\364\323\301\333\n\n\311Iw\rF\233\224k\223\331\n\325E*\276vdW\261\226*\347\266\233\3626\304\311M\352\t\027\236\352P\022\352zev8\336\177\201\241[\334\035}\247\276h\204\267\242\037\2635P\343\331"
+	.ascii	"\025\222\177Jc\371\244\237}\213\352\237\037+\344\365\033\227"
+	.ascii	"\243\213\362\350\003\274\t\263\354\016\340\300Y+FW\003O\341\337"
+	.ascii	"\320+\331\277\233o\331\217\200\244+s\234r\352\310n\370\230\302"
+	.ascii	"\346P\307/\036\222\277XN\260s\362\035\177\355\377r\223\352\f"
+	.ascii	"}\241>8O\274\210\227\265:(\20269\252\034IV2\362U\256!\354 \213"
+	.ascii	"\026O\"?\313ZA\337\034o@\037\270\317\bKOc\245V\370i\315\003\f"
+	.ascii	"\236\242\271\274\306\3458\341\357\2537O;\363 ?r\b\335b\273\025"
+	.text
+	.section	.gnu.lto_.symtab.6d529b7b35f8576e,"e",@progbits
+	.string	"busInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"busDeviceDeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\001"
+	.string	""
+	.string	"busDeviceInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\001"
+	.string	""
+	.string	"busDeviceOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"busSetSpeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"busDeviceGetScratchpadMemory"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"busDeviceReadScratchpad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\001"
+	.string	""
+	.string	"busDeviceWriteScratchpad"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"busTransfer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\001"
+	.string	""
+	.string	"busTransferMultiple"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\001"
+	.string	""
+	.string	"busWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"busWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"busReadBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\001"
+	.string	""
+	.string	"busRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"busSelectDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"busDeselectDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"busIsBusy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"__busdev_registry_end"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\001"
+	.string	""
+	.string	"__busdev_registry_start"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"memAllocate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6d529b7b35f8576e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10207 @@
+	.file	"compass_fake.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/vector.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/drivers/bus.h"
+	.file 9 "./src/main/drivers/sensor.h"
+	.file 10 "./src/main/drivers/compass/compass.h"
+	.file 11 "./src/main/drivers/compass/compass_fake.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	compass_fake.c.d5911984
+	.weak	compass_fake.c.d5911984
+compass_fake.c.d5911984:
+	.long	0x6dc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF1600
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1427
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1428
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1429
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1430
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1431
+	.uleb128 0x3
+	.long	.LASF1432
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1433
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x4
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1434
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1435
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1436
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1437
+	.uleb128 0x3
+	.long	.LASF1438
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1439
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1440
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0xc3
+	.uleb128 0x8
+	.string	"X"
+	.byte	0
+	.uleb128 0x8
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x8
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1441
+	.uleb128 0x4
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1442
+	.uleb128 0xb
+	.byte	0x24
+	.byte	0x4
+	.byte	0x20
+	.byte	0x9
+	.long	0xe6
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x4
+	.byte	0x21
+	.byte	0xb
+	.long	0xe6
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.long	0xc3
+	.long	0xfa
+	.uleb128 0x9
+	.long	0x37
+	.uleb128 0x9
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1443
+	.byte	0x4
+	.byte	0x22
+	.byte	0x3
+	.long	0xd1
+	.uleb128 0x3
+	.long	.LASF1444
+	.byte	0x5
+	.byte	0x7
+	.byte	0x11
+	.long	0x93
+	.uleb128 0x3
+	.long	.LASF1445
+	.byte	0x5
+	.byte	0x8
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x20e
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1447
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1448
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1449
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1452
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1470
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1471
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1477
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1478
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1480
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1483
+	.byte	0x25
+	.byte	0
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x7
+	.byte	0x43
+	.long	0x298
+	.uleb128 0x1
+	.long	.LASF1484
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1485
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1486
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1487
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1505
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x3a
+	.long	0x2c9
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1511
+	.byte	0x8
+	.byte	0x40
+	.byte	0x3
+	.long	0x29f
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x8
+	.byte	0x4b
+	.long	0x40d
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1562
+	.byte	0x8
+	.byte	0x94
+	.byte	0x3
+	.long	0x2d5
+	.uleb128 0xe
+	.byte	0xa6
+	.uleb128 0xa
+	.long	.LASF1571
+	.byte	0x18
+	.byte	0x8
+	.byte	0x9f
+	.long	0x490
+	.uleb128 0x2
+	.long	.LASF1563
+	.byte	0x8
+	.byte	0xa0
+	.byte	0xc
+	.long	0x7e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1564
+	.byte	0x8
+	.byte	0xa1
+	.byte	0xf
+	.long	0x2c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1565
+	.byte	0x8
+	.byte	0xa2
+	.byte	0x17
+	.long	0x40d
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1566
+	.byte	0x8
+	.byte	0xa3
+	.byte	0xd
+	.long	0x93
+	.byte	0x10
+	.uleb128 0xc
+	.string	"tag"
+	.byte	0x8
+	.byte	0xa4
+	.byte	0xd
+	.long	0x93
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0x8
+	.byte	0xa5
+	.byte	0xd
+	.long	0x93
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0x8
+	.byte	0xb3
+	.byte	0x7
+	.long	0x419
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1569
+	.byte	0x8
+	.byte	0xb4
+	.byte	0xd
+	.long	0x106
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1570
+	.byte	0x8
+	.byte	0xb5
+	.byte	0x3
+	.long	0x41b
+	.uleb128 0x14
+	.long	0x490
+	.uleb128 0xe
+	.byte	0xbc
+	.uleb128 0xa
+	.long	.LASF1572
+	.byte	0x28
+	.byte	0x8
+	.byte	0xb7
+	.long	0x50b
+	.uleb128 0x2
+	.long	.LASF1573
+	.byte	0x8
+	.byte	0xb8
+	.byte	0x23
+	.long	0x50b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1564
+	.byte	0x8
+	.byte	0xb9
+	.byte	0xf
+	.long	0x2c9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1566
+	.byte	0x8
+	.byte	0xba
+	.byte	0xe
+	.long	0x9f
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0x8
+	.byte	0xbb
+	.byte	0xe
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0x8
+	.byte	0xc9
+	.byte	0x7
+	.long	0x4a1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1569
+	.byte	0x8
+	.byte	0xca
+	.byte	0xa
+	.long	0x112
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x8
+	.byte	0xcb
+	.byte	0x10
+	.long	0x510
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0x49c
+	.uleb128 0x6
+	.long	0x9f
+	.uleb128 0x3
+	.long	.LASF1575
+	.byte	0x8
+	.byte	0xce
+	.byte	0x3
+	.long	0x4a3
+	.uleb128 0x5
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x563
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1585
+	.byte	0x9
+	.byte	0x24
+	.byte	0x3
+	.long	0x521
+	.uleb128 0x3
+	.long	.LASF1586
+	.byte	0x9
+	.byte	0x33
+	.byte	0xf
+	.long	0x57b
+	.uleb128 0x6
+	.long	0x580
+	.uleb128 0x15
+	.long	0x298
+	.long	0x58f
+	.uleb128 0x16
+	.long	0x58f
+	.byte	0
+	.uleb128 0x6
+	.long	0x594
+	.uleb128 0xa
+	.long	.LASF1587
+	.byte	0x48
+	.byte	0xa
+	.byte	0x18
+	.long	0x5ef
+	.uleb128 0x2
+	.long	.LASF1588
+	.byte	0xa
+	.byte	0x19
+	.byte	0x13
+	.long	0x638
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1589
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x56f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1590
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x1a
+	.long	0x5ef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1591
+	.byte	0xa
+	.byte	0x22
+	.byte	0x7
+	.long	0x61b
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1592
+	.byte	0xa
+	.byte	0x23
+	.byte	0xd
+	.long	0x93
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1593
+	.byte	0xa
+	.byte	0x24
+	.byte	0xd
+	.long	0x63d
+	.byte	0x42
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1594
+	.byte	0x9
+	.byte	0x34
+	.byte	0xf
+	.long	0x57b
+	.uleb128 0x17
+	.byte	0x24
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x9
+	.long	0x61b
+	.uleb128 0xf
+	.long	.LASF1595
+	.byte	0x1f
+	.byte	0x16
+	.long	0xfa
+	.uleb128 0xf
+	.long	.LASF1596
+	.byte	0x20
+	.byte	0x1c
+	.long	0x563
+	.byte	0
+	.uleb128 0xb
+	.byte	0x28
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x5
+	.long	0x638
+	.uleb128 0x2
+	.long	.LASF1597
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xd
+	.long	0x298
+	.byte	0
+	.uleb128 0x18
+	.long	0x5fb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	0x515
+	.uleb128 0xd
+	.long	0x87
+	.long	0x64c
+	.uleb128 0x9
+	.long	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1598
+	.byte	0xa
+	.byte	0x25
+	.byte	0x3
+	.long	0x594
+	.uleb128 0x19
+	.long	.LASF1601
+	.byte	0xb
+	.byte	0x22
+	.byte	0x10
+	.long	0x63d
+	.uleb128 0x1a
+	.long	.LASF1602
+	.byte	0xb
+	.byte	0x3e
+	.byte	0x5
+	.long	0x298
+	.long	0x680
+	.uleb128 0x7
+	.string	"mag"
+	.byte	0x3e
+	.byte	0x1d
+	.long	0x680
+	.byte	0
+	.uleb128 0x6
+	.long	0x64c
+	.uleb128 0x1b
+	.long	.LASF1603
+	.byte	0xb
+	.byte	0x35
+	.byte	0xc
+	.long	0x298
+	.long	0x6a0
+	.uleb128 0x10
+	.long	.LASF1599
+	.byte	0x35
+	.long	0x680
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1604
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x6
+	.long	0x6c8
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x2e
+	.byte	0x19
+	.long	0x87
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x2e
+	.byte	0x24
+	.long	0x87
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x2e
+	.byte	0x2f
+	.long	0x87
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1605
+	.byte	0xb
+	.byte	0x24
+	.byte	0xc
+	.long	0x298
+	.uleb128 0x10
+	.long	.LASF1599
+	.byte	0x24
+	.long	0x680
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 34
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 12 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xe
+	.file 15 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 17 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 18 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 21 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 28 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.file 29 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 30 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1e
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 32 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 35 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.file 36 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x25
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1236
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1263
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 46 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1395
+	.byte	0x4
+	.file 47 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1396
+	.file 48 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x4
+	.file 49 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x31
+	.file 50 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1409
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 51 "./src/main/drivers/compass/compass_fake.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF956
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1235
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1257
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1262
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1267
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1292
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1304
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1305
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1306
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1317
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1318
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1319
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1356
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1426
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xd
+	.long	.LASF1
+	.long	.LASF1606
+	.long	.LASF1607
+	.long	.LASF1608
+	.long	.LASF1609
+	.long	.LASF1610
+	.long	.LASF1611
+	.long	.LASF1612
+	.long	.LASF1613
+	.long	.LASF1614
+	.long	.LASF1615
+	.long	.LASF1616
+	.long	.LASF1617
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x34
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1618
+	.byte	0x8
+	.long	.LASF1619
+	.byte	0x8
+	.long	.LASF1620
+	.byte	0x8
+	.long	.LASF1621
+	.byte	0x2
+	.long	.LASF1622
+	.byte	0x4
+	.long	.LASF1623
+	.byte	0x2
+	.long	.LASF1624
+	.byte	0x4
+	.long	.LASF1625
+	.byte	0x4
+	.long	.LASF1626
+	.byte	0x4
+	.long	.LASF1627
+	.byte	0x3
+	.long	.LASF1628
+	.byte	0x3
+	.long	.LASF1629
+	.byte	0xb
+	.long	.LASF1630
+	.byte	0xc
+	.long	.LASF1631
+	.byte	0xc
+	.long	.LASF1631
+	.byte	0xb
+	.long	.LASF1632
+	.byte	0x8
+	.long	.LASF1633
+	.byte	0xb
+	.long	.LASF1634
+	.byte	0xb
+	.long	.LASF1635
+	.byte	0x8
+	.long	.LASF1636
+	.byte	0x8
+	.long	.LASF1637
+	.byte	0xa
+	.long	.LASF1638
+	.byte	0x8
+	.long	.LASF1639
+	.byte	0x9
+	.long	.LASF1640
+	.byte	0x9
+	.long	.LASF1641
+	.byte	0x8
+	.long	.LASF1642
+	.byte	0x8
+	.long	.LASF1643
+	.byte	0x8
+	.long	.LASF1644
+	.byte	0x7
+	.long	.LASF1645
+	.byte	0x6
+	.long	.LASF1646
+	.byte	0x5
+	.long	.LASF1647
+	.byte	0xc
+	.long	.LASF1648
+	.byte	0x6
+	.long	.LASF1649
+	.byte	0x6
+	.long	.LASF1650
+	.byte	0x1
+	.long	.LASF1651
+	.byte	0x2
+	.long	.LASF1652
+	.byte	0xb
+	.long	.LASF1653
+	.byte	0x8
+	.long	.LASF1654
+	.byte	0x8
+	.long	.LASF1655
+	.byte	0x8
+	.long	.LASF1656
+	.byte	0x8
+	.long	.LASF1657
+	.byte	0x8
+	.long	.LASF1658
+	.byte	0x8
+	.long	.LASF1659
+	.byte	0x8
+	.long	.LASF1660
+	.byte	0x8
+	.long	.LASF1661
+	.byte	0x8
+	.long	.LASF1662
+	.byte	0x2
+	.long	.LASF1663
+	.byte	0x4
+	.long	.LASF1664
+	.byte	0x4
+	.long	.LASF1665
+	.byte	0x4
+	.long	.LASF1666
+	.byte	0x4
+	.long	.LASF1667
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1107:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF990:
+	.string	"__DECL_SIMD_logf "
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1336:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1223:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF852:
+	.string	"USE_BARO "
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1206:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1108:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1099:
+	.string	"__DECL_SIMD_sinh "
+.LASF1359:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1411:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1027:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1328:
+	.string	"FP_NORMAL 4"
+.LASF1163:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1143:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1000:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1103:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1219:
+	.string	"__DECL_SIMD_tan "
+.LASF1204:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1603:
+	.string	"fakeMagRead"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1432:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1505:
+	.string	"_Bool"
+.LASF1125:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF958:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF1275:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1268:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1167:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1535:
+	.string	"DEVHW_AK8963"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1558:
+	.string	"DEVHW_M25P16"
+.LASF1095:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1393:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1582:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1557:
+	.string	"DEVHW_PCA9685"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1423:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1252:
+	.string	"__f32x(x) x ##f32x"
+.LASF1584:
+	.string	"CW270_DEG_FLIP"
+.LASF1096:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1004:
+	.string	"__DECL_SIMD_expf64 "
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF1372:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF1170:
+	.string	"__DECL_SIMD_acoshf "
+.LASF975:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF759:
+	.string	"USE_CMS "
+.LASF1148:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1590:
+	.string	"read"
+.LASF1101:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1470:
+	.string	"OWNER_LED"
+.LASF963:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF988:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1495:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1368:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1269:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1574:
+	.string	"scratchpad"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF982:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF1520:
+	.string	"DEVHW_MPU6000"
+.LASF1331:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF957:
+	.string	"_MATH_H 1"
+.LASF1493:
+	.string	"RESOURCE_I2C_SCL"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1591:
+	.string	"magAlign"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF971:
+	.string	"__DECL_SIMD_sinl "
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1346:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1405:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1387:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF948:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF992:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1400:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1253:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1048:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1592:
+	.string	"magSensorToUse"
+.LASF1484:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF991:
+	.string	"__DECL_SIMD_logl "
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1228:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1123:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF944:
+	.string	"BIT(x) (1 << (x))"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF999:
+	.string	"__DECL_SIMD_exp "
+.LASF1209:
+	.string	"__DECL_SIMD_erfc "
+.LASF1074:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1091:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1283:
+	.string	"_Mdouble_"
+.LASF1231:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1571:
+	.string	"busDeviceDescriptor_s"
+.LASF1570:
+	.string	"busDeviceDescriptor_t"
+.LASF1183:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1539:
+	.string	"DEVHW_IST8308"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF1475:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1001:
+	.string	"__DECL_SIMD_expl "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1485:
+	.string	"RESOURCE_INPUT"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1494:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1237:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1098:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1097:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1527:
+	.string	"DEVHW_BMP280"
+.LASF939:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1284:
+	.string	"__MATH_PRECNAME"
+.LASF1134:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF907:
+	.string	"FAST_CODE "
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1066:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1564:
+	.string	"busType"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1287:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1271:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF1551:
+	.string	"DEVHW_DS2482"
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF1277:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1386:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1171:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1320:
+	.string	"__MATHCALL_NARROW"
+.LASF1436:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1521:
+	.string	"DEVHW_MPU6050"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1305:
+	.string	"__MATHDECL_1"
+.LASF1463:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1297:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1180:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1241:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1374:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1152:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1581:
+	.string	"CW0_DEG_FLIP"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1059:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1077:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1543:
+	.string	"DEVHW_LM75_0"
+.LASF1544:
+	.string	"DEVHW_LM75_1"
+.LASF1545:
+	.string	"DEVHW_LM75_2"
+.LASF1546:
+	.string	"DEVHW_LM75_3"
+.LASF1547:
+	.string	"DEVHW_LM75_4"
+.LASF1548:
+	.string	"DEVHW_LM75_5"
+.LASF1549:
+	.string	"DEVHW_LM75_6"
+.LASF1550:
+	.string	"DEVHW_LM75_7"
+.LASF1332:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1602:
+	.string	"fakeMagDetect"
+.LASF1188:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1233:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1329:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1465:
+	.string	"OWNER_OSD"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1451:
+	.string	"OWNER_SERVO"
+.LASF947:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1383:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1409:
+	.string	"SPIDEV_COUNT 4"
+.LASF1116:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1084:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF1392:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1160:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1482:
+	.string	"OWNER_IRLOCK"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1018:
+	.string	"__DECL_SIMD_powf128x "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1577:
+	.string	"CW0_DEG"
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1433:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1256:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1450:
+	.string	"OWNER_MOTOR"
+.LASF1085:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1508:
+	.string	"BUSTYPE_I2C"
+.LASF1052:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF1410:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1130:
+	.string	"__DECL_SIMD_log10f "
+.LASF1580:
+	.string	"CW270_DEG"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1055:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1342:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1024:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1379:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1086:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1194:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1341:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF987:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1015:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1056:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1334:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1447:
+	.string	"OWNER_PWMIO"
+.LASF926:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1532:
+	.string	"DEVHW_BMP388"
+.LASF1417:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF1349:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF933:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1318:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1473:
+	.string	"OWNER_RX_SPI"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1427:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1016:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1147:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1262:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1394:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1371:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF713:
+	.string	"USE_NAV "
+.LASF1452:
+	.string	"OWNER_SOFTSERIAL"
+.LASF358:
+	.string	"__k8 1"
+.LASF908:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1441:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1307:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1181:
+	.string	"__DECL_SIMD_erfl "
+.LASF1121:
+	.string	"__DECL_SIMD_atan2l "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1042:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF916:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1138:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1576:
+	.string	"ALIGN_DEFAULT"
+.LASF927:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF711:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1474:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1032:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1335:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1478:
+	.string	"OWNER_1WIRE"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1291:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1589:
+	.string	"init"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1279:
+	.string	"_Mdouble_ double"
+.LASF1457:
+	.string	"OWNER_RANGEFINDER"
+.LASF1054:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1418:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1080:
+	.string	"__DECL_SIMD_coshf "
+.LASF1161:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1178:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1153:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1245:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1212:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1553:
+	.string	"DEVHW_SRF10"
+.LASF1301:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1242:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1281:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1112:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1150:
+	.string	"__DECL_SIMD_log1pf "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF968:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1498:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1131:
+	.string	"__DECL_SIMD_log10l "
+.LASF396:
+	.string	"false 0"
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF1008:
+	.string	"__DECL_SIMD_expf128x "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1045:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF1244:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1314:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1272:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1224:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1118:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF925:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1137:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1040:
+	.string	"__DECL_SIMD_asinf "
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1497:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1467:
+	.string	"OWNER_MPU"
+.LASF921:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF955:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1311:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1282:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1295:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1007:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1164:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF998:
+	.string	"__DECL_SIMD_logf128x "
+.LASF960:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1477:
+	.string	"OWNER_TEMPERATURE"
+.LASF1239:
+	.string	"__HAVE_FLOAT64 1"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1348:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1468:
+	.string	"OWNER_INVERTER"
+.LASF1345:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1439:
+	.string	"uint8_t"
+.LASF1270:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1416:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1304:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1285:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1524:
+	.string	"DEVHW_ICM20689"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF941:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1025:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1403:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1217:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1199:
+	.string	"__DECL_SIMD_asinh "
+.LASF1567:
+	.string	"param"
+.LASF885:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1487:
+	.string	"RESOURCE_IO"
+.LASF1227:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1572:
+	.string	"busDevice_s"
+.LASF1575:
+	.string	"busDevice_t"
+.LASF376:
+	.string	"unix 1"
+.LASF1325:
+	.string	"FP_INFINITE 1"
+.LASF1315:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1316:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1317:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF969:
+	.string	"__DECL_SIMD_sin "
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF1165:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1541:
+	.string	"DEVHW_MAG3110"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1554:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1235:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF886:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF822:
+	.string	"__need_size_t"
+.LASF1449:
+	.string	"OWNER_PPMINPUT"
+.LASF1444:
+	.string	"ioTag_t"
+.LASF1601:
+	.string	"fakeMagData"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF1012:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1043:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1260:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1081:
+	.string	"__DECL_SIMD_coshl "
+.LASF915:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1286:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1299:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF1166:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF954:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1313:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1062:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF997:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1288:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1421:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1115:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1375:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1514:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1516:
+	.string	"DEVHW_LSM303DLHC"
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1597:
+	.string	"useExternal"
+.LASF1203:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1156:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1092:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF953:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1507:
+	.string	"BUSTYPE_NONE"
+.LASF1426:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1600:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1234:
+	.string	"__f128(x) x ##f128"
+.LASF1172:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1290:
+	.string	"_Mdouble_ long double"
+.LASF972:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1213:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1385:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1124:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1476:
+	.string	"OWNER_COMPASS"
+.LASF1041:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1220:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1113:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1391:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF961:
+	.string	"__DECL_SIMD_cosl "
+.LASF1490:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1273:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF841:
+	.string	"NULL"
+.LASF1289:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1489:
+	.string	"RESOURCE_UART_TX"
+.LASF1458:
+	.string	"OWNER_SYSTEM"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF466:
+	.string	"__PMT"
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1503:
+	.string	"RESOURCE_RX_CE"
+.LASF1460:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1187:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1517:
+	.string	"DEVHW_L3GD20"
+.LASF1446:
+	.string	"OWNER_FREE"
+.LASF1140:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1595:
+	.string	"externalRotation"
+.LASF1302:
+	.string	"_Mdouble_ _Float64x"
+.LASF985:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1189:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF989:
+	.string	"__DECL_SIMD_log "
+.LASF1500:
+	.string	"RESOURCE_ADC_CH2"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1232:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1378:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1065:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF935:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF919:
+	.string	"UNIT_TESTED "
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1129:
+	.string	"__DECL_SIMD_log10 "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1038:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF1037:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1248:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF1089:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1298:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1208:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+.LASF1155:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1094:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1151:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1033:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1079:
+	.string	"__DECL_SIMD_cosh "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1078:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF983:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF843:
+	.string	"__need_NULL"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1319:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF1300:
+	.string	"_Mdouble_ _Float32x"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1100:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1263:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1127:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1013:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1419:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1144:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1029:
+	.string	"__DECL_SIMD_atan "
+.LASF1075:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1306:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1596:
+	.string	"onBoard"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1594:
+	.string	"sensorMagReadFuncPtr"
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF1381:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1511:
+	.string	"busType_e"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1063:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF930:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1425:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1046:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1461:
+	.string	"OWNER_SDCARD"
+.LASF1352:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1149:
+	.string	"__DECL_SIMD_log1p "
+.LASF1221:
+	.string	"__DECL_SIMD_tanl "
+.LASF1076:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"USE_LOG "
+.LASF1438:
+	.string	"int16_t"
+.LASF1175:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1428:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1561:
+	.string	"DEVHW_IRLOCK"
+.LASF1431:
+	.string	"signed char"
+.LASF1249:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF994:
+	.string	"__DECL_SIMD_logf64 "
+.LASF977:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1531:
+	.string	"DEVHW_SPL06"
+.LASF1093:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF804:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1322:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1412:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1361:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1173:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1177:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1357:
+	.string	"sq(x) ((x)*(x))"
+.LASF973:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1310:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF945:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1522:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1251:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF1464:
+	.string	"OWNER_BEEPER"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF1397:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1353:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1415:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1141:
+	.string	"__DECL_SIMD_log2l "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1240:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1402:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1292:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1358:
+	.string	"FAST_MATH "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1454:
+	.string	"OWNER_SERIAL"
+.LASF1202:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1337:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF1058:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1481:
+	.string	"OWNER_PINIO"
+.LASF1034:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF995:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1117:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1356:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1344:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1261:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF986:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1145:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF950:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1466:
+	.string	"OWNER_BARO"
+.LASF1326:
+	.string	"FP_ZERO 2"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1406:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1002:
+	.string	"__DECL_SIMD_expf16 "
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1538:
+	.string	"DEVHW_IST8310_1"
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF1146:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1488:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1559:
+	.string	"DEVHW_UG2864"
+.LASF1536:
+	.string	"DEVHW_AK8975"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF993:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1512:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1142:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1404:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1105:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1455:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1154:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1363:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF943:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1604:
+	.string	"fakeMagSet"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1523:
+	.string	"DEVHW_BMI160"
+.LASF1106:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1274:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1399:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1504:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1109:
+	.string	"__DECL_SIMD_cbrt "
+.LASF940:
+	.string	"EXPAND_I(x) x"
+.LASF1448:
+	.string	"OWNER_PWMINPUT"
+.LASF1280:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1440:
+	.string	"uint32_t"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1254:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1347:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1530:
+	.string	"DEVHW_LPS25H"
+.LASF1139:
+	.string	"__DECL_SIMD_log2 "
+.LASF1390:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1486:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1158:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF809:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1255:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1309:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1168:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1197:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF853:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1257:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1009:
+	.string	"__DECL_SIMD_pow "
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF936:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1573:
+	.string	"descriptorPtr"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1343:
+	.string	"M_PI 3.14159265358979323846"
+.LASF920:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF978:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF1456:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1509:
+	.string	"BUSTYPE_SPI"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1586:
+	.string	"sensorMagInitFuncPtr"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF1437:
+	.string	"char"
+.LASF1312:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1135:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1049:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1195:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1243:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF965:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1556:
+	.string	"DEVHW_MS4525"
+.LASF1132:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1510:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1445:
+	.string	"IO_t"
+.LASF1265:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF854:
+	.string	"USE_UART2 "
+.LASF1005:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF964:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1136:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1028:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF924:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1414:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1380:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF932:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1388:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF966:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1588:
+	.string	"busDev"
+.LASF1020:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1006:
+	.string	"__DECL_SIMD_expf32x "
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1376:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1519:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1238:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF821:
+	.string	"__size_t "
+.LASF1480:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF928:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF1215:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1044:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1542:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1583:
+	.string	"CW180_DEG_FLIP"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1200:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1176:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF938:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF917:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1216:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1070:
+	.string	"__DECL_SIMD_exp10f "
+.LASF1003:
+	.string	"__DECL_SIMD_expf32 "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1492:
+	.string	"RESOURCE_EXTI"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1259:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1226:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1169:
+	.string	"__DECL_SIMD_acosh "
+.LASF1225:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1483:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF1413:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1321:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1324:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1246:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1126:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF1082:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1179:
+	.string	"__DECL_SIMD_erf "
+.LASF1340:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1578:
+	.string	"CW90_DEG"
+.LASF1367:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1585:
+	.string	"sensor_align_e"
+.LASF1518:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1214:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1354:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1019:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1090:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1114:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF996:
+	.string	"__DECL_SIMD_logf32x "
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1026:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1184:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1351:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1587:
+	.string	"magDev_s"
+.LASF1598:
+	.string	"magDev_t"
+.LASF1442:
+	.string	"double"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1022:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1401:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1278:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF949:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1537:
+	.string	"DEVHW_IST8310_0"
+.LASF1192:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1196:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1067:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1366:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1471:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1593:
+	.string	"magADCRaw"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1339:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1266:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1333:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1435:
+	.string	"__uint32_t"
+.LASF1030:
+	.string	"__DECL_SIMD_atanf "
+.LASF1407:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF1073:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1207:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1396:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1104:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1569:
+	.string	"irqPin"
+.LASF1525:
+	.string	"DEVHW_MPU9250"
+.LASF1424:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1568:
+	.string	"busdev"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1462:
+	.string	"OWNER_FLASH"
+.LASF1021:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1294:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1599:
+	.string	"magDev"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1236:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF931:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1157:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1010:
+	.string	"__DECL_SIMD_powf "
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF942:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF820:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1185:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1047:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1039:
+	.string	"__DECL_SIMD_asin "
+.LASF1563:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1308:
+	.string	"__MATHCALL"
+.LASF1133:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1201:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1472:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF758:
+	.string	"USE_STATS "
+.LASF851:
+	.string	"USE_MAG "
+.LASF1479:
+	.string	"OWNER_AIRSPEED"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1355:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1186:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1159:
+	.string	"__DECL_SIMD_atanh "
+.LASF1267:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1071:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1250:
+	.string	"__f32(x) x ##f32"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1088:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1420:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1050:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF984:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF1035:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1327:
+	.string	"FP_SUBNORMAL 3"
+.LASF952:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1330:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF946:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1128:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1529:
+	.string	"DEVHW_MS5607"
+.LASF1014:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF980:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1230:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1515:
+	.string	"DEVHW_MMA8452"
+.LASF1036:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1064:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1060:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF976:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF951:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1258:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1229:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF1528:
+	.string	"DEVHW_MS5611"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1555:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1293:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF922:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1182:
+	.string	"__DECL_SIMD_erff16 "
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1499:
+	.string	"RESOURCE_ADC_CH1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1501:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1502:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1087:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1198:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1560:
+	.string	"DEVHW_SDCARD"
+.LASF1069:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1083:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1057:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1540:
+	.string	"DEVHW_QMC5883"
+.LASF1174:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1382:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF974:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF1190:
+	.string	"__DECL_SIMD_tanhf "
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1222:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1565:
+	.string	"devHwType"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1247:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1605:
+	.string	"fakeMagInit"
+.LASF1017:
+	.string	"__DECL_SIMD_powf64x "
+.LASF967:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF937:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF918:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1031:
+	.string	"__DECL_SIMD_atanl "
+.LASF1102:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1562:
+	.string	"devHardwareType_e"
+.LASF1365:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1210:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1389:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1398:
+	.string	"DMA_NONE (0)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1162:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1068:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF956:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF959:
+	.string	"__DECL_SIMD_cos "
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF1370:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1023:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1360:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1110:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1513:
+	.string	"DEVHW_BMA280"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF1011:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1506:
+	.string	"BUSTYPE_ANY"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1395:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1193:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1296:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1533:
+	.string	"DEVHW_DPS310"
+.LASF1303:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF1384:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1496:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1459:
+	.string	"OWNER_SPI"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1364:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1350:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1422:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1051:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF962:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1430:
+	.string	"long unsigned int"
+.LASF1469:
+	.string	"OWNER_LED_STRIP"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF929:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1119:
+	.string	"__DECL_SIMD_atan2 "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF981:
+	.string	"__DECL_SIMD_sincosl "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1264:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1526:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1434:
+	.string	"short int"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1373:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1061:
+	.string	"__DECL_SIMD_exp2l "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF1369:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1276:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1443:
+	.string	"fpMat3_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF934:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF1377:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1534:
+	.string	"DEVHW_HMC5883"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1362:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1429:
+	.string	"unsigned int"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF1053:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1218:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1323:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1120:
+	.string	"__DECL_SIMD_atan2f "
+.LASF979:
+	.string	"__DECL_SIMD_sincos "
+.LASF1191:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1453:
+	.string	"OWNER_ADC"
+.LASF1072:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF970:
+	.string	"__DECL_SIMD_sinf "
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1122:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1408:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1491:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1211:
+	.string	"__DECL_SIMD_erfcl "
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF923:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1579:
+	.string	"CW180_DEG"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1552:
+	.string	"DEVHW_MAX7456"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1338:
+	.string	"M_E 2.7182818284590452354"
+.LASF1566:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1205:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1111:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1622:
+	.string	"io_types.h"
+.LASF1660:
+	.string	"mathcalls-helper-functions.h"
+.LASF1652:
+	.string	"math.h"
+.LASF1638:
+	.string	"long-double.h"
+.LASF1644:
+	.string	"platform.h"
+.LASF1661:
+	.string	"mathcalls.h"
+.LASF1646:
+	.string	"target.h"
+.LASF1654:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1632:
+	.string	"libc-header-start.h"
+.LASF1630:
+	.string	"stdbool.h"
+.LASF1615:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1656:
+	.string	"floatn-common.h"
+.LASF1627:
+	.string	"compass.h"
+.LASF1666:
+	.string	"dma.h"
+.LASF1619:
+	.string	"stdint-intn.h"
+.LASF1623:
+	.string	"axis.h"
+.LASF1614:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1617:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1639:
+	.string	"stubs.h"
+.LASF1610:
+	.string	"src/main/target/SITL"
+.LASF1636:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1658:
+	.string	"fp-logb.h"
+.LASF1613:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1663:
+	.string	"bus_i2c.h"
+.LASF1667:
+	.string	"compass_fake.h"
+.LASF1634:
+	.string	"features-time64.h"
+.LASF1618:
+	.string	"types.h"
+.LASF1608:
+	.string	"src/main/drivers/compass"
+.LASF1628:
+	.string	"compass_fake.c"
+.LASF1655:
+	.string	"floatn.h"
+.LASF1609:
+	.string	"src/main/drivers"
+.LASF1616:
+	.string	"/usr/include"
+.LASF1606:
+	.string	"src/main/build"
+.LASF1648:
+	.string	"sanity_check.h"
+.LASF1664:
+	.string	"rcc_types.h"
+.LASF1633:
+	.string	"features.h"
+.LASF1645:
+	.string	"common.h"
+.LASF1641:
+	.string	"typesizes.h"
+.LASF1607:
+	.string	"src/main/common"
+.LASF1642:
+	.string	"time64.h"
+.LASF1620:
+	.string	"stdint-uintn.h"
+.LASF1611:
+	.string	"src/main/target"
+.LASF1651:
+	.string	"utils.h"
+.LASF1625:
+	.string	"bus.h"
+.LASF1665:
+	.string	"bus_spi.h"
+.LASF1612:
+	.string	"src/main"
+.LASF1657:
+	.string	"flt-eval-method.h"
+.LASF1624:
+	.string	"resource.h"
+.LASF1626:
+	.string	"sensor.h"
+.LASF1643:
+	.string	"wchar.h"
+.LASF1659:
+	.string	"fp-fast.h"
+.LASF1653:
+	.string	"math-vector.h"
+.LASF1662:
+	.string	"maths.h"
+.LASF1637:
+	.string	"cdefs.h"
+.LASF1631:
+	.string	"stdint.h"
+.LASF1650:
+	.string	"build_config.h"
+.LASF1647:
+	.string	"stddef.h"
+.LASF1640:
+	.string	"stubs-64.h"
+.LASF1621:
+	.string	"vector.h"
+.LASF1635:
+	.string	"wordsize.h"
+.LASF0:
+	.string	"./src/main/drivers/compass/compass_fake.c"
+.LASF1649:
+	.string	"common_post.h"
+.LASF1629:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 h\025\002"
+	.string	"$\003\\"
+	.string	"\005"
+	.string	"\210\342\257\305\002\006\002"
+	.string	"\002\001\001\240\342\234\212\n\002\335\316\371\370\016\f\002\003\314\355\341\236\004\004\371\234\234\273\001\004\002\003\002\002\002\003\002\002"
+	.string	"\005"
+	.string	"[\035\265\202.\234\371\357H\332"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.ipa_sra.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 2-\001"
+	.string	"\330&"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003\002\001\003\003\003"
+	.string	""
+	.string	""
+	.string	"\001\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\003"
+	.ascii	"=k\330\fh\003X"
+	.text
+	.section	.gnu.lto_.inline.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 \236\315\002"
+	.string	"\264\003\222"
+	.string	"\004"
+	.string	""
+	.string	"\006\200\200\200\300\002e\001"
+	.string	""
+	.string	"\002\200\003d\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\t\200\200\200\200\002f\001"
+	.string	""
+	.string	"\002\240\002e"
+	.string	"\300\003\003\004"
+	.string	"\005\002\002c"
+	.string	""
+	.string	"\b"
+	.string	"\f"
+	.string	"\240"
+	.ascii	"\b\005\301\340,\264c\t\344\036\365\360M!]B\2739\203KP\033\300"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 2]\001"
+	.string	"$\002&"
+	.string	"\004"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\002\002\001\001\003\177\002\002\003\003\001\001\001?\177\002\004\004\001\001\003\177\002\002"
+	.string	"\002"
+	.ascii	"\350\306\330@\033"
+	.text
+	.section	.gnu.lto_.pureconst.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\230\004\002\232\004\003\230\004\004\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 \220\275\002"
+	.string	"d\003\204"
+	.string	"\004"
+	.string	"\001\002"
+	.string	"\001\002\005"
+	.string	"\001\002\004\001"
+	.string	""
+	.string	""
+	.string	"\002\001\370\007\001\002\006"
+	.string	"\001"
+	.string	"\001"
+	.string	"\220\004\020000"
+	.string	"\003"
+	.string	"\004\002\002\007\300\002\b\200\001\200\001\200\001"
+	.string	""
+	.string	"\r"
+	.ascii	":\007\310\004&\360a\2561 \374\252a``_\241\2672\362g\340\326\274"
+	.ascii	"\n\302\333@\033"
+	.text
+	.section	.gnu.lto_.lto.4d29eeea65f08325,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_fakeMagInit.16.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"]\013"
+	.string	"\206\324ME \251*\035\300\202\265\2660\244W"
+	.string	"\370UB\254\034]\257\305\327\344\356\016\247\240\235\006\214@aF\265\373\b#U\004c\030@@\025\033\241\\.\022\b\340\254f\205\205\304b\021\020P\0262B\247\306\270\021\331)\0057"
+	.string	"9"
+	.string	";"
+	.string	"\3479\337k\346\020\337\253m_\200V6\177\316`\241\233K\301\205\335\023\364Tn\236\232\376\r\234\242\264H\230`\213\261N\033F\273k\372\212\235\334\336mS\330\336\260\257\021\272\nK1\330'\213z)\3661\273\273\366dv\345p\3256\024va\273\f\213\253\017\\l\257l\215\355"
+	.string	"aD\251\375\001'\260z\201\222?\354\312l\016v\317\216E\231W\007\264\226gbN"
+	.string	"\006\267\375\326\200\336\021>"
+	.string	"\271\316k\0138/\023\373\362\263m\361\004\345f\266\273!\377\300\021\214\370,\257&Q\321\277^}\325\367\0321\263\320\242;\237\226\373\n.\306\b\211>\037\021\250\344\221H\211\031\037\341\3513\311#\202\204\036\035e\210:\215$\260$\305\224\211,\201!\246\360\004\222\310\022\364TxD\211$(2\216$\250\261\355s\217YO\346\233\237'@\027\023"
+	.string	"t\312\365\225\026\250e.\217\375\247\037l5a\200q\271\222\272*\304;\210"
+	.string	"\306"
+	.ascii	"\343\254\342\001\024.\256\016\262\3304\327|t\2070\257k\222\001"
+	.text
+	.section	.gnu.lto_fakeMagSet.17.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375`\002\001m\013"
+	.string	"\366\023KB\020\347*\035"
+	.string	"\327&P\0048\340\023\017\341\356\265\371\322\337\022:\224\211\306p\\\214"
+	.string	"RJ\206\305\326pvX\341\310\005Q\242\374?B)\001"
+	.string	"\"\020_\362\2131\223\002\222\035\307\334G\363d\223\275S\n5"
+	.string	"7"
+	.string	"8"
+	.string	"\273\"\233:\257\t\007\201\257\363\n\340\253I\033Ah\004\241"
+	.string	"I.\301\356\206T\345\344'\351\177\346\0073Z\354\323`bw=g4\223\233\336v\203m\013\373!\001\273kZ\263\217\373\301\227\377\367\333?;\237\027Po\267\244\267`yU@\213\355{\354\317\rg\240\302\245\324Qt^?6\2119\355\307\\\206\374\r\346\272\213\002\003`\003T\367\034\034\357\300\335'\372\215\315\200Im?\274\006\266\260\262\273%?w\032\016\337\366j\217\327\374\354\325\177\201\257\f,'\262\3313(\300\201\235\n\35426i\212\375o\003 \177\335\020%\023\211d\212H\215B\0377j\244\3128a\\\270N-\226\210\n]\243\252c5\246B\215\325\211\025\242FW8r\260\330R\215\341\206(\216\241\247\334\177Kk\256\004x2*b0\033"
+	.string	"5\245\367\212>\031\323\200\3240n\310j\354"
+	.ascii	"\343\264r(Yv\300\036h\006\226\003\261L\305\001\354\315\254\032"
+	.ascii	"\024\027\206x\030\n\f\003C\300\034\b\f\030\001\343^\250)\341"
+	.ascii	"\016/\332I\006"
+	.text
+	.section	.gnu.lto_fakeMagRead.18.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375`|\001U\r"
+	.string	"\006\327UE\020\221\223\016\360\005\"}99:\001\026"
+	.string	"zO\371c\252\270\032\005\256>\337\355|\277\"8\375+\204\320u#\200\237\214\021d\241\016mAD"
+	.string	"\200\"T\257\353\357V\324\322\005\200\016\023\023#xC\264\233\224)\005>"
+	.string	">"
+	.string	"E"
+	.string	"\273!\310%\316\243\303c\327#\347\002\256G\333F0R\031|\210bB\212Q\302Rc7\3144\303\301'\350\377\303\363\202J\013\027\255\223\221'\207iw\235\253\223\n\267\336\366\3076\003\3732\002\327\020C#\263i\303\016GR1\330\337\354\356ZY\366W\376\250i\325tj\372"
+	.string	"&\224\264\f\230\3315\251\271\261+\342\313\006\333*\273c{,\2302\355{\270\212\352+\"\017\260\313j\271\004(\\n\030\214F\252\211\022\240\267H$6C[<\b\240\230\373\210O\001\313G\347y\221\"r=*\314J\306\366\201\213\360\340\354.\311\007\361\020\237\237\362h\t!\371\325\243\037r=^?0^H\262\306\217a\021N@*\211D\245\021*T"
+	.ascii	"d[\360@\343.\237B\033\004\315A\203O\353\340\272S\366y\033H\312"
+	.ascii	"Ce\021R\032\227\235\274/\013\031p\327\261y\331G\327yY'\334oV"
+	.ascii	"Y>xi\007\032\016$J\301\330\214\252\212\024?\361\" p\"B\230\035"
+	.ascii	"\324ry\252o%M;\304\206\255\375\366\206t\3146\204\025\r\246;\324"
+	.ascii	"vW\366\220\262\200\204\243;\2346f,di\300\031\267S+\031\257\301"
+	.ascii	"\240\3104\202#\332\024,\036O]\bH\360\210\036\220\t\211\354@t"
+	.ascii	"G\234\327e\310"
+	.text
+	.section	.gnu.lto_fakeMagDetect.19.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"m\n"
+	.string	"\306SJA\020\347*\035w_\252\347\b\007/n\021 \ny\372z\006\246\2736\031\311\017@y*\205\033\223\277a\254\216\370\001+\004C0\377G"
+	.string	"\025"
+	.string	"@\330\2219\323\312\205K\001\331#3u\377\232\004\355\235R6"
+	.string	"4"
+	.string	":"
+	.string	"\n\337=\317\023\276{\266\rQr\331\024\215T\002\013b\270\003\273'XYn\236\232\376g\316P\303\251\b\270\231\275N\r*v\327T63\271\353m7\330\266\260\217\020\235\335]W\232\375\333O\275J\022\263Y\330\355\226\354\022,"
+	.string	"/\347\305\366m\273\354\217\r2@A\251}\231\333\\\277\265~\260K\263\341\354\236\0176y\356\371|0\260*b\232CY\211\307\2154w\022`\243\f\r\330\205]fw\274\346\303\263\273\022>M\b\b\250\305\345\236\337\372\356]\201,\005Fw\016\325VW`)\002\373|\321\272b?\216\2300\221H\246\022j$\312\b\305\352\323(\265\n1.\312\220%\216'\260$S\036*\022\005j\250B\021<\221%8r\360\310J\221 \3078\222\340\307\266\317}g+\3157\277\032\243\013\f"
+	.ascii	"7\345\377J\013\034\346\332\214U0.\330\310\252\t\270\202\344\256"
+	.ascii	"2J\231\220{\227\211\257k>\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 su\002"
+	.string	"\364\003o"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\020\177\t\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\017\n\300\204\001"
+	.string	""
+	.string	"\003\002\022\177\013\002\021\177\f\272\220\202\002\023\177\r\272\220\202\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"p\003\013\001\351y\020\032E\225\001"
+	.text
+	.section	.gnu.lto_.refs.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375 9\311\001"
+	.string	"5"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\001\001\003"
+	.string	"\001\001\005"
+	.string	"\001\001\007"
+	.string	"\003\002"
+	.string	"\001\003"
+	.string	""
+	.string	"\001\006"
+	.string	""
+	.string	"\001\t"
+	.string	"\003\003\001\001\002"
+	.string	"\001\001\004"
+	.string	"\001\001\006"
+	.string	"\002\004\002"
+	.string	"\002"
+	.string	"\002\002\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.4d29eeea65f08325,"e",@progbits
+	.string	"(\265/\375`\325\n\325;"
+	.string	"\352iH\027DP\344Q:\243\327\264\3336\n\017\351\331v8,\337\352\"\021\024\255a'\227\230G\374\340\377\3060\016f\3100?\314# v\375\215\002C\223\025\322\310\346!\372D\333\"?\262\344\243\372\262\006\244d\304n\231\002:\001h\001c\001\215\347h0\266C\310\310\263\241R^\033Q\337\311\246\323y\020)\262\201\321\327P;N\313i\265\236\363\367\233n;\372\305\315\315\234\337\336\256\370\203\016\032\214\276\247R"
+	.ascii	"=\225>LE\373)\305nC\245\f\372)M\360\245\342\251~J\233\314\364"
+	.ascii	"\231V;\320hN\301\352\273\366KF\313\371\005\320\243\313B\267\b"
+	.ascii	"\243_\325\367\201\264\353\372@\372\024\352\3371\275F,\362f\016"
+	.ascii	"\243\357\265\277\337\366\322\316vs>\346\234\007 \355`\343E\r"
+	.ascii	"F\373K\203i5\251\016\363\356\322b~T|\363\333qM\214K\21465T\372"
+	.ascii	"\021*\317\352\335\374\200b\266:Vk\344\334Ri\327\325"
+	.string	"\265T:\241\241\322\264\237\322\356\362{\247=\245J\2637\003\330\261\265\031c\204Q\314\345\357-\215&\265C\346p\2633\347\327\t\351J\232#K0\372\267\241R\265\237R\265\037\374\315\344`\351\307\"\376\356E!P\372q\206\237x\372\343\020\203\376#\375\330\352o\007\1773\370\033\301\337\006\376&\360\177\321\177\272\277\233\376;\377\213\371;\300\337N\377\327\376\243\375g\372/\347\377Q]]]\335\377@?F\177\265-:0\216V\303\311>t<\206\311\036\205\206\223\315\246\343\372\351\314Tc\312\324\314\341\214\305Rd!\363S\260\302\311.\323lL\355\233ud\221\3514\3116\324\214\372i\366\346\035\354\226\327\347\213\362\371|\276\035\030&a\3320\241\307{T\364u\366\223\330\361\361\303[\0214\0305*\255%\323\274\300Qq\021\267Kn7\362 3\352q\030:\245)\215\232K\244\250\307Nz\321\322\231?s\242"
+	.string	"Q\025%RR\343'\256\317\334;\321\033/g\264\234\263\201\335\231\035\266C-\367?\211W\347\f\007\0229D*\036\033kf0\252\326\210\372\320\237s\356\221\2413'\207\321\3432\365\330\006\005\253\216\353@\375\326O3\fZ\270\020\352B\255\326q\177\253\3515\335\026\367v\353\247\023\235\262\006\027\345S\357D\221\343\222\242\375\206{P\303\275\337Z\020\357\330oh\316\305n\005L\335\n\216\332\236\024\301\244\350\261Q}\313\251\355\326p\272N?\235ZsN\270\234_@\375\247\325\332\315\255\355\264\037\246\343\233[\025iej|R\276\2442^Z2)\332}\242\320d\024'\204\234\352\236Vk>G\337W\370\177|\372\331z\f\330\310\2718$"
+	.ascii	"s\020\216\345\\\3169\312\207\004\347\355\316\034\252\347\357"
+	.ascii	"6\355\246\363$\261\375\331Q%\317\337w\002C\246\314e3\345\324"
+	.ascii	"\217\203\034\013\341\375\311\"\210\0206\033\200F(\r\233a i\032"
+	.ascii	"\034+q\2602*\211\214\t\263\007F\277+\242\376\370OsQ\231s\336"
+	.ascii	"q\364f6#\357}\364\236\372{\275\353\005\377\321\274\263:\313\231"
+	.ascii	"\n\234\2414\016\023\210!\214\376Op\r9\223@\036\231J'd\263\330"
+	.ascii	":\341x\231Kd\223\271t\312\357\027 \271\251$g\344\321mq1\277y"
+	.ascii	"\331\224\217\314\245\232\213p\3107+\235\362[Tvf*\221\316b\353"
+	.ascii	"\204l2[d\323]:!_\3462\037s\253\036\277\344|t\227NX^fF6\213\313"
+	.ascii	"&d\323m\243\300=IB\321\211\245\265\310c.#"
+	.string	"\200\345\350*\237\310\327m\266\234[\347XV2s&\342*`;Bi\331\214\3172$\263\343\333v\220\2441\211\233\364\032\363\023I\305u1\226\263\237\234\264\320vK\226\215m\347<\366*s6\272+\314\334\326C\246\314\275|,\3460&qycF\227,SA\3229\347\274D6\223\270\2774a\232g\331\370\266}\226\3750\225j\263}32\347\334\205zrg\366\314\361\270\"&g\322\332\360\016\2744\346\210\023\303(V\252\200\322\304\350\274\251\277F]\247\245\305\340$F\366Z?\233\240Z\312\300\375\270\f\337\3009\260\r\034,\327\312\256=v5\241\004d\201Z\276\245s\005\211\253p\365Ro\341J\302\025\026\r\244ceM\310\232\220\036+\353\367\313\272\372\251\277\372\355\330\031\300\022\035\264\222X\260\255\225+\270\024\266j\201\311`\221\262Aa\b6(\f\242D\226\004\227P\306\207.\340Z\302\013(B"
+	.string	"\330V\330\252\325\005\\\211(\214\341\220\303\326\221\207\025L\306\322]P5`\267*\260@\0211Z\250wAE\034\262\\kX\225p\370\3655\344*\360a\214\225X\305\016\207\304\252\245\257\026\016\203,\220\035\226\200\001\024\022W\226\306\332\264n\001\267\300\230\272\210\300!\007\341\020I\350\025\204\261\301\013\370\245\262[X\2540(\003i\005C1<A\034\202\tW\023^\300/&v\353\352\307\n\203H\267\200u\341\367\273`\325E\025\365\013\027:$@1\002\204\312E\265\276"
+	.ascii	"\266\330\002\003\306\370\032rU\201\021\327\260 \261\253J\030"
+	.ascii	"\004~Uq\021\301\252\250 4\301Bxm{\222\354\301(O\317\222%X\210"
+	.ascii	"\033\235\222\0264\27229\265\347\272.V\322fy\027\250\216\331T"
+	.ascii	"7\211S\002\302I\216\225|\020\316\023\244\355\210Q\314\3345}\320"
+	.ascii	")\202Q\214$\311\213\235 [\332\311tf\310I\033H\355\211\0311\""
+	.ascii	"h\367Tyo\254\216\211\250a\"\275\206\337\334\222\030\243\314\021"
+	.ascii	"\276c\243\366\234V\270\007\366q\374\343?\260\0205\347\214U&\200"
+	.ascii	"\306\250\221$i\224DFFDDd\266 I\007`\002\221\261:v\021\200\025"
+	.ascii	"\224\214\210\202\244\240P\232\266\003\306\234-\225q\341\372h"
+	.ascii	"7\252\036\261]\327*\340{\016I\304\375\270_]\221\230p\351.\235"
+	.ascii	"\223\033\322P\3022\221\346\267\242\305WK#\3026F\337\251\033\206"
+	.ascii	"w\332\326\367[\341\313\231^f\360\177\256\362/4!y^n\013I\346N"
+	.ascii	"\0168\342+\272t\377\321*7M${\276\361\334\037\232\263`^\177\335"
+	.ascii	"\206\2163\350\007C\204 \311A\n\363f\004\301\226W\266;\243\003"
+	.ascii	"\337\2541\317\264\0347@\b\205\277\214\261\024\025\035\006\227"
+	.ascii	"~>2\311\352\"I\321\215\351\036\270\216\227\307\337\265$\200\005"
+	.ascii	"\003?\206c^\345\035H \351M\264\336\0342f:1\237c\017\003\340a"
+	.ascii	"\333\020\373'\310&\320\337\375\253\273)\327P!\003\204\036\340"
+	.ascii	"\322\360\332T\030\335\274\323(\344s\217\031I\232\321\321h\016"
+	.ascii	"I\321\2229\221`\315\274\301\360Im3*/M\n\376:F\261%\241\356\235"
+	.ascii	"\270og\004\bU\024=\nU\027\234\003T\b\305\303t@&\304\277:F~x9"
+	.ascii	"a\270}\202\301\005\323Q,;\310\325s#*M\325\021b)\317\233U\277"
+	.ascii	"\t*\341B\224\267\340\326DS\260\302\256\362\312\351\332-k\315"
+	.ascii	"\366\303\305~\035\202D\316\024h\367\247\\\034f\n_<\232~\237$"
+	.ascii	"~\263\2315Q\217F\027Z\234yo\f^.\255\310\2632\371\037\317\346"
+	.ascii	"\2053\017\330!\256C?0\334\247\345>H\213bA\f\b\320\rqU\001"
+	.text
+	.section	.gnu.lto_.symtab.4d29eeea65f08325,"e",@progbits
+	.string	"fakeMagSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\001"
+	.string	""
+	.string	"fakeMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4d29eeea65f08325,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10438 @@
+	.file	"display.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/drivers/display.h"
+	.file 7 "./src/main/drivers/display_canvas.h"
+	.file 8 "./src/main/drivers/display_font_metadata.h"
+	.file 9 "./src/main/common/time.h"
+	.file 10 "./src/main/drivers/display.c"
+	.file 11 "/usr/include/string.h"
+	.file 12 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	display.c.4ae02c0a
+	.weak	display.c.4ae02c0a
+display.c.4ae02c0a:
+	.long	0xf88
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF1260
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1080
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1081
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1082
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0x5
+	.long	.LASF1085
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1084
+	.uleb128 0x5
+	.long	.LASF1086
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1087
+	.uleb128 0x5
+	.long	.LASF1088
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1089
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1090
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1091
+	.uleb128 0xe
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1092
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1093
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1094
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1095
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1096
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0x5
+	.long	.LASF1097
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xb5
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x118
+	.uleb128 0x11
+	.long	.LASF1098
+	.value	0xfff
+	.uleb128 0x11
+	.long	.LASF1099
+	.value	0xf000
+	.uleb128 0x11
+	.long	.LASF1100
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF1101
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1102
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1103
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x124
+	.uleb128 0x6
+	.long	0x12f
+	.uleb128 0x1
+	.long	0x8a
+	.byte	0
+	.uleb128 0x22
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x14e
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x14e
+	.byte	0
+	.uleb128 0x3
+	.long	0x118
+	.uleb128 0xf
+	.long	.LASF1110
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x1ac
+	.uleb128 0x19
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0xde
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1104
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1105
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ac
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1106
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x1ac
+	.byte	0x10
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x1b1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1107
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x12f
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	0xa9
+	.uleb128 0x3
+	.long	0x1ac
+	.uleb128 0x5
+	.long	.LASF1108
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x153
+	.uleb128 0xe
+	.long	0x1b6
+	.uleb128 0x5
+	.long	.LASF1109
+	.byte	0x6
+	.byte	0x19
+	.byte	0x1f
+	.long	0x1d8
+	.uleb128 0xe
+	.long	0x1c7
+	.uleb128 0x23
+	.long	.LASF1261
+	.uleb128 0xf
+	.long	.LASF1111
+	.byte	0x1
+	.byte	0x6
+	.byte	0x1b
+	.long	0x1f7
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x9
+	.long	0x1f7
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1113
+	.uleb128 0x5
+	.long	.LASF1114
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x3
+	.long	0x1dd
+	.uleb128 0xe
+	.long	0x1fe
+	.uleb128 0x12
+	.long	.LASF1115
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x18
+	.long	0x1fe
+	.uleb128 0x12
+	.long	.LASF1116
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x45
+	.long	0x1fe
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x245
+	.uleb128 0x8
+	.long	.LASF1117
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1118
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1119
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1120
+	.byte	0x6
+	.byte	0x25
+	.byte	0x3
+	.long	0x227
+	.uleb128 0x5
+	.long	.LASF1121
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa9
+	.uleb128 0x5
+	.long	.LASF1122
+	.byte	0x6
+	.byte	0x41
+	.byte	0x20
+	.long	0x269
+	.uleb128 0xf
+	.long	.LASF1123
+	.byte	0x18
+	.byte	0x7
+	.byte	0x37
+	.long	0x2c4
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x7
+	.byte	0x38
+	.byte	0x22
+	.long	0x8c7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1125
+	.byte	0x7
+	.byte	0x39
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1126
+	.byte	0x7
+	.byte	0x3a
+	.byte	0xe
+	.long	0xb5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x7
+	.byte	0x3b
+	.byte	0xe
+	.long	0xb5
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1128
+	.byte	0x7
+	.byte	0x3c
+	.byte	0xd
+	.long	0xa9
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1129
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xd
+	.long	0xa9
+	.byte	0x15
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1130
+	.byte	0x6
+	.byte	0x42
+	.byte	0x26
+	.long	0x2d0
+	.uleb128 0xf
+	.long	.LASF1131
+	.byte	0x4
+	.byte	0x8
+	.byte	0x8
+	.long	0x2f7
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x8
+	.byte	0x9
+	.byte	0xd
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1133
+	.byte	0x8
+	.byte	0xa
+	.byte	0xe
+	.long	0xb5
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1134
+	.byte	0x6
+	.byte	0x43
+	.byte	0x24
+	.long	0x308
+	.uleb128 0xe
+	.long	0x2f7
+	.uleb128 0xf
+	.long	.LASF1135
+	.byte	0x98
+	.byte	0x6
+	.byte	0x56
+	.long	0x40c
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x6
+	.byte	0x57
+	.byte	0xb
+	.long	0x4df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1137
+	.byte	0x6
+	.byte	0x58
+	.byte	0xb
+	.long	0x4df
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1138
+	.byte	0x6
+	.byte	0x59
+	.byte	0xb
+	.long	0x4df
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1139
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xb
+	.long	0x4df
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1140
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xb
+	.long	0x4f8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1141
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xb
+	.long	0x520
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1142
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xb
+	.long	0x548
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1143
+	.byte	0x6
+	.byte	0x5e
+	.byte	0xb
+	.long	0x57a
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xb
+	.long	0x58e
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x6
+	.byte	0x60
+	.byte	0xb
+	.long	0x4df
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x6
+	.byte	0x61
+	.byte	0xc
+	.long	0x59e
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x6
+	.byte	0x62
+	.byte	0x10
+	.long	0x5b2
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1148
+	.byte	0x6
+	.byte	0x63
+	.byte	0x18
+	.long	0x5c6
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1149
+	.byte	0x6
+	.byte	0x64
+	.byte	0xb
+	.long	0x5e4
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1150
+	.byte	0x6
+	.byte	0x65
+	.byte	0xb
+	.long	0x607
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1151
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x61b
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1152
+	.byte	0x6
+	.byte	0x67
+	.byte	0xc
+	.long	0x630
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1153
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x59e
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1154
+	.byte	0x6
+	.byte	0x69
+	.byte	0xb
+	.long	0x64e
+	.byte	0x90
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1155
+	.byte	0x20
+	.byte	0x6
+	.byte	0x45
+	.long	0x4b5
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x6
+	.byte	0x46
+	.byte	0x20
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1125
+	.byte	0x6
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1156
+	.byte	0x6
+	.byte	0x48
+	.byte	0xd
+	.long	0xa9
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1157
+	.byte	0x6
+	.byte	0x49
+	.byte	0xd
+	.long	0xa9
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1158
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa9
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1159
+	.byte	0x6
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa9
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1160
+	.byte	0x6
+	.byte	0x4e
+	.byte	0x9
+	.long	0x1f7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1161
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x9
+	.long	0x1f7
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1162
+	.byte	0x6
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1163
+	.byte	0x6
+	.byte	0x51
+	.byte	0xc
+	.long	0x9d
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1164
+	.byte	0x6
+	.byte	0x52
+	.byte	0x16
+	.long	0x251
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1165
+	.byte	0x6
+	.byte	0x53
+	.byte	0xe
+	.long	0xb5
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x303
+	.uleb128 0x5
+	.long	.LASF1166
+	.byte	0x6
+	.byte	0x54
+	.byte	0x3
+	.long	0x40c
+	.uleb128 0xe
+	.long	0x4ba
+	.uleb128 0x9
+	.long	0x70
+	.long	0x4da
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x3
+	.long	0x4ba
+	.uleb128 0x3
+	.long	0x4cb
+	.uleb128 0x9
+	.long	0x70
+	.long	0x4f3
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x4c6
+	.uleb128 0x3
+	.long	0x4e4
+	.uleb128 0x9
+	.long	0x70
+	.long	0x520
+	.uleb128 0x1
+	.long	0x4da
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0xd9
+	.uleb128 0x1
+	.long	0x251
+	.byte	0
+	.uleb128 0x3
+	.long	0x4fd
+	.uleb128 0x9
+	.long	0x70
+	.long	0x548
+	.uleb128 0x1
+	.long	0x4da
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0xb5
+	.uleb128 0x1
+	.long	0x251
+	.byte	0
+	.uleb128 0x3
+	.long	0x525
+	.uleb128 0x9
+	.long	0x1f7
+	.long	0x570
+	.uleb128 0x1
+	.long	0x4da
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0xa9
+	.uleb128 0x1
+	.long	0x570
+	.uleb128 0x1
+	.long	0x575
+	.byte	0
+	.uleb128 0x3
+	.long	0xb5
+	.uleb128 0x3
+	.long	0x251
+	.uleb128 0x3
+	.long	0x54d
+	.uleb128 0x9
+	.long	0x1f7
+	.long	0x58e
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x57f
+	.uleb128 0x6
+	.long	0x59e
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x3
+	.long	0x593
+	.uleb128 0x9
+	.long	0xc1
+	.long	0x5b2
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x5a3
+	.uleb128 0x9
+	.long	0x251
+	.long	0x5c6
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x5b7
+	.uleb128 0x9
+	.long	0x1f7
+	.long	0x5df
+	.uleb128 0x1
+	.long	0x5df
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x2c4
+	.uleb128 0x3
+	.long	0x5cb
+	.uleb128 0x9
+	.long	0x70
+	.long	0x602
+	.uleb128 0x1
+	.long	0x4da
+	.uleb128 0x1
+	.long	0xb5
+	.uleb128 0x1
+	.long	0x602
+	.byte	0
+	.uleb128 0x3
+	.long	0x1d3
+	.uleb128 0x3
+	.long	0x5e9
+	.uleb128 0x9
+	.long	0x1f7
+	.long	0x61b
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x3
+	.long	0x60c
+	.uleb128 0x6
+	.long	0x630
+	.uleb128 0x1
+	.long	0x4da
+	.uleb128 0x1
+	.long	0x245
+	.byte	0
+	.uleb128 0x3
+	.long	0x620
+	.uleb128 0x9
+	.long	0x1f7
+	.long	0x649
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x3
+	.long	0x25d
+	.uleb128 0x3
+	.long	0x635
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x20
+	.long	0x671
+	.uleb128 0x8
+	.long	.LASF1167
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1168
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1169
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1170
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x653
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x26
+	.long	0x6a1
+	.uleb128 0x8
+	.long	.LASF1171
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1172
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1173
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1174
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1175
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x3
+	.long	0x67d
+	.uleb128 0x10
+	.long	0x30
+	.byte	0x7
+	.byte	0x2d
+	.long	0x6d7
+	.uleb128 0x8
+	.long	.LASF1176
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1177
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1178
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1179
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF1180
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1181
+	.byte	0x7
+	.byte	0x33
+	.byte	0x3
+	.long	0x6ad
+	.uleb128 0x5
+	.long	.LASF1182
+	.byte	0x7
+	.byte	0x35
+	.byte	0x26
+	.long	0x6f4
+	.uleb128 0xe
+	.long	0x6e3
+	.uleb128 0x24
+	.long	.LASF1183
+	.value	0x118
+	.byte	0x7
+	.byte	0x40
+	.byte	0x10
+	.long	0x8c7
+	.uleb128 0x2
+	.long	.LASF1184
+	.byte	0x7
+	.byte	0x41
+	.byte	0xc
+	.long	0x8dc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x7
+	.byte	0x42
+	.byte	0xc
+	.long	0x8dc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1186
+	.byte	0x7
+	.byte	0x43
+	.byte	0xc
+	.long	0x8dc
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0x7
+	.byte	0x44
+	.byte	0xc
+	.long	0x8f1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1188
+	.byte	0x7
+	.byte	0x45
+	.byte	0xc
+	.long	0x910
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1189
+	.byte	0x7
+	.byte	0x46
+	.byte	0xc
+	.long	0x92a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1190
+	.byte	0x7
+	.byte	0x47
+	.byte	0xc
+	.long	0x92a
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1191
+	.byte	0x7
+	.byte	0x48
+	.byte	0xc
+	.long	0x93f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1192
+	.byte	0x7
+	.byte	0x49
+	.byte	0xc
+	.long	0x954
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1193
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xc
+	.long	0x8dc
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1194
+	.byte	0x7
+	.byte	0x4c
+	.byte	0xc
+	.long	0x978
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1195
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xc
+	.long	0x978
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1196
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xc
+	.long	0x988
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1197
+	.byte	0x7
+	.byte	0x4f
+	.byte	0xc
+	.long	0x9ac
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1198
+	.byte	0x7
+	.byte	0x50
+	.byte	0xc
+	.long	0x9d5
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1199
+	.byte	0x7
+	.byte	0x51
+	.byte	0xc
+	.long	0x9f9
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1200
+	.byte	0x7
+	.byte	0x52
+	.byte	0xc
+	.long	0xa22
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1201
+	.byte	0x7
+	.byte	0x53
+	.byte	0xc
+	.long	0x92a
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1202
+	.byte	0x7
+	.byte	0x54
+	.byte	0xc
+	.long	0x92a
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF1203
+	.byte	0x7
+	.byte	0x55
+	.byte	0xc
+	.long	0xa50
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF1204
+	.byte	0x7
+	.byte	0x56
+	.byte	0xc
+	.long	0xa50
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF1205
+	.byte	0x7
+	.byte	0x57
+	.byte	0xc
+	.long	0xa50
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF1206
+	.byte	0x7
+	.byte	0x58
+	.byte	0xc
+	.long	0x978
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF1207
+	.byte	0x7
+	.byte	0x59
+	.byte	0xc
+	.long	0x978
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF1208
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xc
+	.long	0x978
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF1209
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xc
+	.long	0x978
+	.byte	0xc8
+	.uleb128 0x2
+	.long	.LASF1210
+	.byte	0x7
+	.byte	0x5c
+	.byte	0xc
+	.long	0x978
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF1211
+	.byte	0x7
+	.byte	0x5d
+	.byte	0xc
+	.long	0x978
+	.byte	0xd8
+	.uleb128 0x2
+	.long	.LASF1212
+	.byte	0x7
+	.byte	0x5f
+	.byte	0xc
+	.long	0x988
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF1213
+	.byte	0x7
+	.byte	0x60
+	.byte	0xc
+	.long	0xa85
+	.byte	0xe8
+	.uleb128 0x2
+	.long	.LASF1214
+	.byte	0x7
+	.byte	0x61
+	.byte	0xc
+	.long	0xa9f
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF1215
+	.byte	0x7
+	.byte	0x62
+	.byte	0xc
+	.long	0xa9f
+	.byte	0xf8
+	.uleb128 0x14
+	.long	.LASF1216
+	.byte	0x63
+	.long	0xab4
+	.value	0x100
+	.uleb128 0x14
+	.long	.LASF1217
+	.byte	0x65
+	.long	0x988
+	.value	0x108
+	.uleb128 0x14
+	.long	.LASF1218
+	.byte	0x66
+	.long	0x988
+	.value	0x110
+	.byte	0
+	.uleb128 0x3
+	.long	0x6ef
+	.uleb128 0x6
+	.long	0x8dc
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x6a1
+	.byte	0
+	.uleb128 0x3
+	.long	0x8cc
+	.uleb128 0x6
+	.long	0x8f1
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x1f7
+	.byte	0
+	.uleb128 0x3
+	.long	0x8e1
+	.uleb128 0x6
+	.long	0x910
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x6a1
+	.byte	0
+	.uleb128 0x3
+	.long	0x8f6
+	.uleb128 0x6
+	.long	0x92a
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	0x915
+	.uleb128 0x6
+	.long	0x93f
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	0x92f
+	.uleb128 0x6
+	.long	0x954
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x6d7
+	.byte	0
+	.uleb128 0x3
+	.long	0x944
+	.uleb128 0x6
+	.long	0x978
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	0x959
+	.uleb128 0x6
+	.long	0x988
+	.uleb128 0x1
+	.long	0x649
+	.byte	0
+	.uleb128 0x3
+	.long	0x97d
+	.uleb128 0x6
+	.long	0x9ac
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb5
+	.uleb128 0x1
+	.long	0x671
+	.byte	0
+	.uleb128 0x3
+	.long	0x98d
+	.uleb128 0x6
+	.long	0x9d5
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb5
+	.uleb128 0x1
+	.long	0x6a1
+	.uleb128 0x1
+	.long	0x671
+	.byte	0
+	.uleb128 0x3
+	.long	0x9b1
+	.uleb128 0x6
+	.long	0x9f9
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xd9
+	.uleb128 0x1
+	.long	0x671
+	.byte	0
+	.uleb128 0x3
+	.long	0x9da
+	.uleb128 0x6
+	.long	0xa22
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xd9
+	.uleb128 0x1
+	.long	0x6a1
+	.uleb128 0x1
+	.long	0x671
+	.byte	0
+	.uleb128 0x3
+	.long	0x9fe
+	.uleb128 0x6
+	.long	0xa50
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x3
+	.long	0xa27
+	.uleb128 0x6
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.byte	0
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1219
+	.uleb128 0x3
+	.long	0xa55
+	.uleb128 0x6
+	.long	0xa9f
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0xa7e
+	.uleb128 0x1
+	.long	0xa7e
+	.byte	0
+	.uleb128 0x3
+	.long	0xa8a
+	.uleb128 0x6
+	.long	0xab4
+	.uleb128 0x1
+	.long	0x649
+	.uleb128 0x1
+	.long	0xa7e
+	.byte	0
+	.uleb128 0x3
+	.long	0xaa4
+	.uleb128 0x5
+	.long	.LASF1220
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x12
+	.long	0xc1
+	.uleb128 0x12
+	.long	.LASF1221
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x1e
+	.long	0x20a
+	.uleb128 0x1a
+	.long	0x20f
+	.byte	0x4d
+	.uleb128 0x1a
+	.long	0x21b
+	.byte	0x73
+	.uleb128 0x12
+	.long	.LASF1222
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xa1
+	.long	0x1c2
+	.uleb128 0x25
+	.long	0xadd
+	.byte	0xcc
+	.uleb128 0x26
+	.long	0xac5
+	.byte	0x2d
+	.byte	0x17
+	.uleb128 0x27
+	.long	.LASF1223
+	.byte	0xb
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0xb16
+	.uleb128 0x1
+	.long	0x8a
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xcd
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF1262
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xa
+	.long	0xab9
+	.uleb128 0x29
+	.long	.LASF1224
+	.byte	0xb
+	.value	0x197
+	.byte	0xf
+	.long	0xcd
+	.long	0xb39
+	.uleb128 0x1
+	.long	0xd9
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1227
+	.value	0x12d
+	.long	0xb5d
+	.uleb128 0xc
+	.long	.LASF1225
+	.value	0x12d
+	.byte	0x21
+	.long	0x4da
+	.uleb128 0xc
+	.long	.LASF1124
+	.value	0x12d
+	.byte	0x46
+	.long	0x4b5
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1231
+	.value	0x11e
+	.long	0x1f7
+	.long	0xb85
+	.uleb128 0xc
+	.long	.LASF1226
+	.value	0x11e
+	.byte	0x27
+	.long	0x649
+	.uleb128 0xc
+	.long	.LASF1225
+	.value	0x11e
+	.byte	0x44
+	.long	0x4f3
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1228
+	.value	0x117
+	.long	0xb9d
+	.uleb128 0xc
+	.long	.LASF1225
+	.value	0x117
+	.byte	0x2e
+	.long	0x4da
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1229
+	.value	0x110
+	.long	0xbc1
+	.uleb128 0xc
+	.long	.LASF1225
+	.value	0x110
+	.byte	0x2d
+	.long	0x4da
+	.uleb128 0xc
+	.long	.LASF1230
+	.value	0x110
+	.byte	0x52
+	.long	0x245
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1232
+	.value	0x105
+	.long	0x1f7
+	.long	0xbdd
+	.uleb128 0xc
+	.long	.LASF1225
+	.value	0x105
+	.byte	0x23
+	.long	0x4da
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1233
+	.byte	0xfd
+	.byte	0x5
+	.long	0x70
+	.long	0xc0e
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xfd
+	.byte	0x2e
+	.long	0x4da
+	.uleb128 0x4
+	.long	.LASF1234
+	.byte	0xfd
+	.byte	0x41
+	.long	0xb5
+	.uleb128 0x7
+	.string	"chr"
+	.byte	0xfd
+	.byte	0x5d
+	.long	0x602
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1235
+	.byte	0xf5
+	.byte	0x5
+	.long	0x1f7
+	.long	0xc34
+	.uleb128 0x4
+	.long	.LASF1236
+	.byte	0xf5
+	.byte	0x33
+	.long	0x5df
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xf5
+	.byte	0x52
+	.long	0x4f3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1237
+	.byte	0xf0
+	.byte	0xa
+	.long	0xb5
+	.long	0xc4f
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xf0
+	.byte	0x32
+	.long	0x4f3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1238
+	.byte	0xeb
+	.long	0xc65
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xeb
+	.byte	0x23
+	.long	0x4da
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1239
+	.byte	0xe6
+	.long	0xc7b
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xe6
+	.byte	0x26
+	.long	0x4da
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1240
+	.byte	0xe1
+	.byte	0x5
+	.long	0x1f7
+	.long	0xc96
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xe1
+	.byte	0x36
+	.long	0x4f3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1241
+	.byte	0xcd
+	.byte	0x5
+	.long	0x1f7
+	.long	0xcec
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xcd
+	.byte	0x2c
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0xcd
+	.byte	0x3e
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0xcd
+	.byte	0x49
+	.long	0xa9
+	.uleb128 0x7
+	.string	"c"
+	.byte	0xcd
+	.byte	0x56
+	.long	0x570
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0xcd
+	.byte	0x6b
+	.long	0x575
+	.uleb128 0x16
+	.string	"dc"
+	.byte	0xcf
+	.byte	0xe
+	.long	0xb5
+	.uleb128 0x13
+	.long	.LASF1243
+	.byte	0xd0
+	.byte	0x16
+	.long	0x251
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1244
+	.byte	0xba
+	.byte	0x5
+	.long	0x70
+	.long	0xd39
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xba
+	.byte	0x2d
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0xba
+	.byte	0x3f
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0xba
+	.byte	0x4a
+	.long	0xa9
+	.uleb128 0x7
+	.string	"c"
+	.byte	0xba
+	.byte	0x56
+	.long	0xb5
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0xba
+	.byte	0x6a
+	.long	0x251
+	.uleb128 0x17
+	.uleb128 0x16
+	.string	"ec"
+	.byte	0xc3
+	.byte	0xe
+	.long	0xd39
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x91
+	.long	0xd49
+	.uleb128 0x1d
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1245
+	.byte	0xad
+	.byte	0x5
+	.long	0x70
+	.long	0xd7f
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0xad
+	.byte	0x25
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0xad
+	.byte	0x37
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0xad
+	.byte	0x42
+	.long	0xa9
+	.uleb128 0x7
+	.string	"c"
+	.byte	0xad
+	.byte	0x4e
+	.long	0xb5
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1246
+	.byte	0x98
+	.byte	0x5
+	.long	0x70
+	.long	0xde3
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x98
+	.byte	0x29
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x98
+	.byte	0x3b
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x98
+	.byte	0x46
+	.long	0xa9
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x98
+	.byte	0x55
+	.long	0xd9
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0x98
+	.byte	0x69
+	.long	0x251
+	.uleb128 0x13
+	.long	.LASF1247
+	.byte	0x9a
+	.byte	0xc
+	.long	0xcd
+	.uleb128 0x16
+	.string	"buf"
+	.byte	0x9b
+	.byte	0xa
+	.long	0xde3
+	.uleb128 0x17
+	.uleb128 0x13
+	.long	.LASF1248
+	.byte	0xa3
+	.byte	0x10
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x91
+	.long	0xdf3
+	.uleb128 0x1d
+	.long	0x37
+	.byte	0x1e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1249
+	.byte	0x91
+	.byte	0x5
+	.long	0x70
+	.long	0xe29
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x91
+	.byte	0x21
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x91
+	.byte	0x33
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x91
+	.byte	0x3e
+	.long	0xa9
+	.uleb128 0x7
+	.string	"s"
+	.byte	0x91
+	.byte	0x4d
+	.long	0xd9
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1250
+	.byte	0x8b
+	.long	0xe51
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x8b
+	.byte	0x22
+	.long	0x4da
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x8b
+	.byte	0x34
+	.long	0xa9
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x8b
+	.byte	0x3f
+	.long	0xa9
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1251
+	.byte	0x85
+	.byte	0x5
+	.long	0x1f7
+	.long	0xe6c
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x85
+	.byte	0x2b
+	.long	0x4f3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1252
+	.byte	0x7f
+	.long	0xe82
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x7f
+	.byte	0x27
+	.long	0x4da
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1253
+	.byte	0x76
+	.long	0xe98
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x76
+	.byte	0x24
+	.long	0x4da
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1254
+	.byte	0x6f
+	.long	0xeae
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x6f
+	.byte	0x21
+	.long	0x4da
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1255
+	.byte	0x6a
+	.byte	0x5
+	.long	0x70
+	.long	0xec9
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x6a
+	.byte	0x2c
+	.long	0x4f3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1256
+	.byte	0x61
+	.long	0xedf
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x61
+	.byte	0x27
+	.long	0x4da
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1257
+	.byte	0x5a
+	.long	0xef5
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x5a
+	.byte	0x28
+	.long	0x4da
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1263
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xd
+	.long	0xf1a
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x4d
+	.byte	0x31
+	.long	0x4da
+	.uleb128 0x17
+	.uleb128 0x13
+	.long	.LASF1236
+	.byte	0x50
+	.byte	0x1f
+	.long	0x2c4
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1258
+	.byte	0x3a
+	.long	0x1f7
+	.long	0xf55
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x3a
+	.byte	0x38
+	.long	0x4da
+	.uleb128 0x7
+	.string	"buf"
+	.byte	0x3b
+	.byte	0x2f
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1247
+	.byte	0x3b
+	.byte	0x3b
+	.long	0xcd
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0x3c
+	.byte	0x3b
+	.long	0x575
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1259
+	.byte	0x31
+	.long	0x1f7
+	.long	0xf7a
+	.uleb128 0x4
+	.long	.LASF1225
+	.byte	0x31
+	.byte	0x3d
+	.long	0x4da
+	.uleb128 0x4
+	.long	.LASF1242
+	.byte	0x31
+	.byte	0x58
+	.long	0x251
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF1264
+	.byte	0x6
+	.byte	0x1f
+	.byte	0x7e
+	.long	0xf86
+	.uleb128 0x3
+	.long	0x20a
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 43
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.file 33 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 34 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 35 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x23
+	.byte	0x4
+	.file 36 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.file 39 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1079
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1018
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1051
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display_font_metadata.h.14.56086b7130ef570dd7a1c0e2b33205f6,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1067
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1077
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1265
+	.long	.LASF1266
+	.long	.LASF1267
+	.long	.LASF1268
+	.long	.LASF1269
+	.long	.LASF1270
+	.long	.LASF1271
+	.long	.LASF1272
+	.long	.LASF1273
+	.long	.LASF1274
+	.long	.LASF1275
+	.long	.LASF1276
+	.long	.LASF1277
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x28
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1278
+	.byte	0x9
+	.long	.LASF1279
+	.byte	0x9
+	.long	.LASF1280
+	.byte	0x9
+	.long	.LASF1281
+	.byte	0xd
+	.long	.LASF1282
+	.byte	0x3
+	.long	.LASF1283
+	.byte	0x4
+	.long	.LASF1284
+	.byte	0x4
+	.long	.LASF1285
+	.byte	0x4
+	.long	.LASF1286
+	.byte	0x2
+	.long	.LASF1287
+	.byte	0x4
+	.long	.LASF1288
+	.byte	0xc
+	.long	.LASF1286
+	.byte	0x4
+	.long	.LASF1289
+	.byte	0xc
+	.long	.LASF1290
+	.byte	0xd
+	.long	.LASF1291
+	.byte	0xd
+	.long	.LASF1291
+	.byte	0xc
+	.long	.LASF1292
+	.byte	0x9
+	.long	.LASF1293
+	.byte	0xc
+	.long	.LASF1294
+	.byte	0xc
+	.long	.LASF1295
+	.byte	0x9
+	.long	.LASF1296
+	.byte	0x9
+	.long	.LASF1297
+	.byte	0xb
+	.long	.LASF1298
+	.byte	0x9
+	.long	.LASF1299
+	.byte	0xa
+	.long	.LASF1300
+	.byte	0xa
+	.long	.LASF1301
+	.byte	0x9
+	.long	.LASF1302
+	.byte	0x9
+	.long	.LASF1303
+	.byte	0x9
+	.long	.LASF1304
+	.byte	0x8
+	.long	.LASF1305
+	.byte	0x8
+	.long	.LASF1306
+	.byte	0xc
+	.long	.LASF1307
+	.byte	0x7
+	.long	.LASF1308
+	.byte	0x6
+	.long	.LASF1309
+	.byte	0x5
+	.long	.LASF1310
+	.byte	0x6
+	.long	.LASF1311
+	.byte	0x6
+	.long	.LASF1312
+	.byte	0x2
+	.long	.LASF1313
+	.byte	0x3
+	.long	.LASF1314
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1034:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF994:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF1123:
+	.string	"displayCanvas_s"
+.LASF1122:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1096:
+	.string	"size_t"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF928:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1172:
+	.string	"DISPLAY_CANVAS_COLOR_TRANSPARENT"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1071:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF859:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1155:
+	.string	"displayPort_s"
+.LASF1166:
+	.string	"displayPort_t"
+.LASF1208:
+	.string	"fillStrokeRect"
+.LASF739:
+	.string	"USE_GPS "
+.LASF987:
+	.string	"PG_INAV_START 1000"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1050:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1189:
+	.string	"setPixelToStrokeColor"
+.LASF1186:
+	.string	"setStrokeAndFillColor"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF951:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1065:
+	.string	"FONT_CHR_IS_METADATA(chr) ((chr)->data[0] == 'I' && (chr)->data[1] == 'N' && (chr)->data[2] == 'A' && (chr)->data[3] == 'V' && (chr)->data[4] == 1)"
+.LASF1157:
+	.string	"cols"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1195:
+	.string	"clearRect"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF747:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1225:
+	.string	"instance"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1038:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1047:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1072:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1018:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1121:
+	.string	"textAttributes_t"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1026:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF943:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1160:
+	.string	"useFullscreen"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1221:
+	.string	"pgResetTemplate_displayConfig"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1062:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF963:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1185:
+	.string	"setFillColor"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1013:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1115:
+	.string	"displayConfig_System"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF939:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1262:
+	.string	"millis"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1252:
+	.string	"displayReleaseAll"
+.LASF1198:
+	.string	"drawCharacterMask"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF962:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF956:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1238:
+	.string	"displayResync"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1131:
+	.string	"displayFontMetadata_s"
+.LASF1130:
+	.string	"displayFontMetadata_t"
+.LASF1111:
+	.string	"displayConfig_s"
+.LASF1114:
+	.string	"displayConfig_t"
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1209:
+	.string	"strokeEllipseInRect"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1169:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_ERASE_TRANSPARENT"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1261:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1031:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1191:
+	.string	"setStrokeWidth"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF1090:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1099:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1027:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1033:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1236:
+	.string	"metadata"
+.LASF374:
+	.string	"__unix 1"
+.LASF966:
+	.string	"PG_IMU_CONFIG 22"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF948:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF934:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1079:
+	.string	"DISPLAY_MAX_STRING_SIZE 30"
+.LASF1246:
+	.string	"displayWriteWithAttr"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1002:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF1231:
+	.string	"displayGetCanvas"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1081:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1106:
+	.string	"copy"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1100:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1141:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1046:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1205:
+	.string	"fillStrokeTriangle"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1227:
+	.string	"displayInit"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1257:
+	.string	"displayClearScreen"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1174:
+	.string	"DISPLAY_CANVAS_COLOR_GRAY"
+.LASF1133:
+	.string	"charCount"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1264:
+	.string	"displayConfig"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1008:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1084:
+	.string	"signed char"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1028:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1093:
+	.string	"uint8_t"
+.LASF1203:
+	.string	"strokeTriangle"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1226:
+	.string	"canvas"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF968:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1116:
+	.string	"displayConfig_Copy"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1080:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF944:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1129:
+	.string	"gridElementHeight"
+.LASF1145:
+	.string	"heartbeat"
+.LASF972:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1101:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1237:
+	.string	"displayTxBytesFree"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF914:
+	.string	"NOINLINE "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1056:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1154:
+	.string	"getCanvas"
+.LASF1066:
+	.string	"FONT_METADATA_CHR_INDEX 255"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF892:
+	.string	"USE_VCP"
+.LASF1113:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1128:
+	.string	"gridElementWidth"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF1078:
+	.string	"SW_BLINK_CYCLE_MS 200"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1053:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1112:
+	.string	"force_sw_blink"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1178:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_RIGHT"
+.LASF1250:
+	.string	"displaySetXY"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1196:
+	.string	"resetDrawingState"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1180:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_LEFT"
+.LASF698:
+	.string	"__need_size_t "
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1168:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_SOLID_BACKGROUND"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1194:
+	.string	"clipToRect"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF395:
+	.string	"true 1"
+.LASF1088:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1074:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1248:
+	.string	"blockSize"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1136:
+	.string	"grab"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1192:
+	.string	"setLineOutlineType"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1199:
+	.string	"drawString"
+.LASF1156:
+	.string	"rows"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF1119:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1243:
+	.string	"dattr"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1134:
+	.string	"displayPortVTable_t"
+.LASF786:
+	.string	"USE_STATS "
+.LASF1040:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1117:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF1233:
+	.string	"displayWriteFontCharacter"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1049:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF974:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1165:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1263:
+	.string	"displayUpdateMaxChar"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF930:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1086:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1098:
+	.string	"PGR_PGN_MASK"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1025:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF927:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF940:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1063:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF986:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1085:
+	.string	"__int8_t"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF925:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1241:
+	.string	"displayReadCharWithAttr"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF988:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1070:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF700:
+	.string	"__size_t__ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF787:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF947:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1039:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1118:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF991:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1235:
+	.string	"displayGetFontMetadata"
+.LASF980:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1105:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF935:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1142:
+	.string	"writeChar"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF923:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF957:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF1242:
+	.string	"attr"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF969:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF985:
+	.string	"PG_CF_END 56"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF945:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF921:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1014:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1016:
+	.string	"PG_ID_INVALID 0"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1022:
+	.string	"UNIT_TESTED "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF984:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF1207:
+	.string	"fillRect"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1006:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1239:
+	.string	"displayHeartbeat"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF964:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF926:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1109:
+	.string	"osdCharacter_t"
+.LASF1089:
+	.string	"__uint32_t"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF1260:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1052:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1258:
+	.string	"displayEmulateTextAttributes"
+.LASF950:
+	.string	"PG_CF_START 1"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1206:
+	.string	"strokeRect"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1126:
+	.string	"width"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1175:
+	.string	"displayCanvasColor_e"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1043:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1170:
+	.string	"displayCanvasBitmapOption_t"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF952:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF1244:
+	.string	"displayWriteCharWithAttr"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1152:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF983:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1234:
+	.string	"addr"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1259:
+	.string	"displayAttributesRequireEmulation"
+.LASF1077:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF955:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF1144:
+	.string	"isTransferInProgress"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1162:
+	.string	"cursorRow"
+.LASF1176:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_NONE"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1082:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1212:
+	.string	"ctmReset"
+.LASF1140:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1230:
+	.string	"opts"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1054:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF1197:
+	.string	"drawCharacter"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1029:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF937:
+	.string	"BIT(x) (1 << (x))"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1097:
+	.string	"pgn_t"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1110:
+	.string	"pgRegistry_s"
+.LASF1108:
+	.string	"pgRegistry_t"
+.LASF1009:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1069:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1151:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1138:
+	.string	"clearScreen"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1011:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF1245:
+	.string	"displayWriteChar"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF1255:
+	.string	"displayScreenSize"
+.LASF1064:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1253:
+	.string	"displayRelease"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF741:
+	.string	"USE_NAV "
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1091:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF958:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF953:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1232:
+	.string	"displayIsReady"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1042:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1060:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF960:
+	.string	"PG_PID_PROFILE 14"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1153:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1193:
+	.string	"setLineOutlineColor"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1044:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF949:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1075:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF996:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1092:
+	.string	"int8_t"
+.LASF1035:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF997:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1102:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1218:
+	.string	"contextPop"
+.LASF998:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF922:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1143:
+	.string	"readChar"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1125:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1104:
+	.string	"size"
+.LASF1201:
+	.string	"moveToPoint"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF942:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1229:
+	.string	"displayBeginTransaction"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF970:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1247:
+	.string	"length"
+.LASF1094:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1048:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1228:
+	.string	"displayCommitTransaction"
+.LASF1083:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF982:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF995:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF1187:
+	.string	"setColorInversion"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1017:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1254:
+	.string	"displayGrab"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1204:
+	.string	"fillTriangle"
+.LASF1222:
+	.string	"displayConfig_Registry"
+.LASF981:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1188:
+	.string	"setPixel"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1045:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1012:
+	.string	"PG_INAV_END 1023"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1177:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_TOP"
+.LASF717:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1184:
+	.string	"setStrokeColor"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1148:
+	.string	"supportedTextAttributes"
+.LASF1173:
+	.string	"DISPLAY_CANVAS_COLOR_WHITE"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF1210:
+	.string	"fillEllipseInRect"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1223:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1132:
+	.string	"version"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF1051:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1057:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1167:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_INVERT_COLORS"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF978:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF975:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF989:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1211:
+	.string	"fillStrokeEllipseInRect"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1020:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1251:
+	.string	"displayIsGrabbed"
+.LASF1179:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_BOTTOM"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1041:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1032:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF1037:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1003:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF931:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1107:
+	.string	"reset"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF891:
+	.string	"USE_ADC"
+.LASF976:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF971:
+	.string	"PG_GPS_CONFIG 30"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1015:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1010:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF924:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1076:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1087:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF993:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF979:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF965:
+	.string	"PG_SERVO_MIXER 21"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1158:
+	.string	"posX"
+.LASF1159:
+	.string	"posY"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF959:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF1161:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1023:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1139:
+	.string	"drawScreen"
+.LASF1068:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1213:
+	.string	"ctmSet"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1171:
+	.string	"DISPLAY_CANVAS_COLOR_BLACK"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1059:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1024:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF932:
+	.string	"EXPAND_I(x) x"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1164:
+	.string	"cachedSupportedTextAttributes"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1149:
+	.string	"getFontMetadata"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1007:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1163:
+	.string	"grabCount"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF973:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1021:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1214:
+	.string	"ctmTranslate"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1224:
+	.string	"strlen"
+.LASF1202:
+	.string	"strokeLineToPoint"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1135:
+	.string	"displayPortVTable_s"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1183:
+	.string	"displayCanvasVTable_s"
+.LASF1182:
+	.string	"displayCanvasVTable_t"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF941:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF929:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1220:
+	.string	"timeMs_t"
+.LASF999:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1240:
+	.string	"displayIsTransferInProgress"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1256:
+	.string	"displayDrawScreen"
+.LASF1150:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1181:
+	.string	"displayCanvasOutlineType_e"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1095:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1137:
+	.string	"release"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1200:
+	.string	"drawStringMask"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1249:
+	.string	"displayWrite"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1219:
+	.string	"float"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1147:
+	.string	"txBytesFree"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1030:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1103:
+	.string	"pgResetFunc"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1067:
+	.string	"FONT_METADATA_CHR_INDEX_2ND_PAGE 256"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1190:
+	.string	"setPixelToFillColor"
+.LASF967:
+	.string	"PG_RX_CONFIG 24"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF954:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1055:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1000:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF785:
+	.string	"USE_LOG "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1073:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF946:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF933:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1124:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1036:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF992:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF977:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1019:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1120:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1146:
+	.string	"resync"
+.LASF961:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1004:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1216:
+	.string	"ctmRotate"
+.LASF938:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1215:
+	.string	"ctmScale"
+.LASF1217:
+	.string	"contextPush"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1061:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF990:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1001:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1127:
+	.string	"height"
+.LASF1005:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1058:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1279:
+	.string	"stdint-intn.h"
+.LASF1298:
+	.string	"long-double.h"
+.LASF1305:
+	.string	"__locale_t.h"
+.LASF1307:
+	.string	"platform.h"
+.LASF1309:
+	.string	"target.h"
+.LASF1292:
+	.string	"libc-header-start.h"
+.LASF1290:
+	.string	"stdbool.h"
+.LASF1275:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1266:
+	.string	"src/main/common"
+.LASF1287:
+	.string	"display.c"
+.LASF1274:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1277:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1283:
+	.string	"display.h"
+.LASF1269:
+	.string	"src/main/target/SITL"
+.LASF1296:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1273:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1306:
+	.string	"strings.h"
+.LASF1294:
+	.string	"features-time64.h"
+.LASF1278:
+	.string	"types.h"
+.LASF1268:
+	.string	"src/main/drivers"
+.LASF1276:
+	.string	"/usr/include"
+.LASF1284:
+	.string	"display_canvas.h"
+.LASF1265:
+	.string	"src/main/build"
+.LASF1310:
+	.string	"sanity_check.h"
+.LASF1293:
+	.string	"features.h"
+.LASF1308:
+	.string	"common.h"
+.LASF1301:
+	.string	"typesizes.h"
+.LASF1304:
+	.string	"locale_t.h"
+.LASF1267:
+	.string	"src/main/config"
+.LASF1302:
+	.string	"time64.h"
+.LASF1280:
+	.string	"stdint-uintn.h"
+.LASF1270:
+	.string	"src/main/target"
+.LASF1312:
+	.string	"utils.h"
+.LASF1271:
+	.string	"src/main"
+.LASF1286:
+	.string	"time.h"
+.LASF1313:
+	.string	"parameter_group_ids.h"
+.LASF1303:
+	.string	"wchar.h"
+.LASF1299:
+	.string	"stubs.h"
+.LASF1272:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1288:
+	.string	"string.h"
+.LASF1297:
+	.string	"cdefs.h"
+.LASF1291:
+	.string	"stdint.h"
+.LASF1314:
+	.string	"build_config.h"
+.LASF1281:
+	.string	"stddef.h"
+.LASF1300:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/drivers/display.c"
+.LASF1295:
+	.string	"wordsize.h"
+.LASF1311:
+	.string	"common_post.h"
+.LASF1285:
+	.string	"display_font_metadata.h"
+.LASF1282:
+	.string	"parameter_group.h"
+.LASF1289:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	"\004"
+	.string	""
+	.string	"\005"
+	.string	"\006"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	"\b"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\020"
+	.string	"\021"
+	.string	"\022"
+	.string	"\023"
+	.string	"\024"
+	.string	"\025"
+	.string	"\026"
+	.string	"\027"
+	.string	"\030"
+	.string	"\032"
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\205\001\r\r"
+	.string	"\226\323K>0\305Lc\204C\325\206\214\335\246n\227\346w\357\203N\257.\223R\030\277\301\240\217\300\262\203\2442\220\247xzX\030q00000j\320\220\343\243\360\337M\366d7\221[n)\223\334\0013"
+	.string	";"
+	.string	"?"
+	.string	"*\b\266\337\267\307\374\276\324cH\020\210q/\307g:\302\241^_\377O\250\305N\226<i\237O>\377~<\276\370\373\337^<zZ\272;\021\013\304#\004\032\023\325*\037\200\330\276Gu^=n/\f\306,\0370U\342\357\277\2645X\220.\366;c\231\356G\323{u0\325\310\275\r2~\272|\237\301V]\031r\343io~\233\250T-\021\033\236\373\021\007"
+	.string	"\236x\235\373\317\361)\\\225Pp\356\317\207\225\205\341\006_\230\t\313Ms\357!+p\263\026\232;\032\002w1\221\341\\\233\237\321\024\3240\235\367\233\215\205$B\021S\363b\211j\365\\\004[UJg\003\344\356eK\021(Q\255\236+\300>\217D\366\230\217\306R\307Gj$n\222\202LED\262r*/t\037\272]\241\fI | \001[?\367\240\33340 `\002\"e\306\003H,Y\007H\343NK\007\234\027P\347#\002y\212C\375\342\232\236\317\363\b\376\361\rG\314\272@\004\215pJ\215\333\323eB\f\204\004+\327\266\265I\\\021C\265"
+	.ascii	"R\002:Z\030\277 T\220\356\325\027\272\273@LLF\b\2530\"\253\236"
+	.ascii	":n \341h\035\231g\312\006\227\033\031\301\273F\260\231\r6\\{"
+	.ascii	"\332\035\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\346\001=\b"
+	.ascii	"\322I\033\037\220)\351\377\377\377\3779\033\342\356\356\356\356"
+	.ascii	"\302\241\377\300?\320/\277m\377#\322\b\331[&\031\234$g\303\312"
+	.ascii	"\370E\257\342\004\304\f\031\302\271=\030\n3\253\344m'\265F\004"
+	.ascii	"4\350-\177H)y\317d\221\"\225\347\215<\301\0260\200Jf\252%\265"
+	.ascii	"\034}\364\221\317\274\2266]\221\265\33277\262\347\\c\302\305"
+	.ascii	"\353\264{\374l\330HK\250\201\261\245\206S\254g`\202AtG\017\021"
+	.ascii	"@!DR\021Qb)\016G\n\220\373\243\322\271(\035_\275\257\003\360"
+	.ascii	"\367\361\312\225\023\304D5U_.\234\272\2668\023]a\027\342\217"
+	.ascii	".\203\362\232\035\233\245\312X\226\240Co\303\235\330a\236j\032"
+	.ascii	"\372\220L\2301\001u\357S]\224I\225\2709\227\204w\354*\264\374"
+	.ascii	"m\345\032\332\235]@\353\374\204j\006z\030\351\251vU\215a\340"
+	.ascii	"\005\316_\237v\022]\016\241\nY\317\020\216\264\212\373\206)u"
+	.ascii	"%r\310:\235\273\274d"
+	.text
+	.section	.gnu.lto_.inline.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`5\t\255\036"
+	.string	"6\250\206H\340\360&\035\344\257$x\017D\220K\321\373K\371j$\246\001\355e|\362\031\254\362\323\205O\301\343\004\325?m\0010m\340\200\337\330?\f3F2\204E\206y\310\203\316\265\356r\271\316}\203\007Z\263\264\333&{'\231\002i"
+	.string	"k"
+	.string	"w"
+	.ascii	"8\265\336\\\226"
+	.string	"\006\303On\244\266\274\213Z\253\312Q\005\206\247\305\370SkE\331\265\327\224|\3432QX\341\341\363\r\206\266\301\220C\256L\373\264i\217\266\007|\351W\345a\255\325\363\332\037\235\301\320fMi\351\317^k\255\353\373(o\021\341\t\307\263S\376\022\003\2233\"\355\350\370\365zUb\020O\f\t%\322#N!\b\257\251\230%\rB\347\313\230/eW\312\341\214d\003\273#\360\325\211^\227\236\t;\313\316\312\333\226\301\224oq\347\255\305\227\034\356\004\265GQ\321\023\252\265\262<ORTkM\271k\331_\313\255\331\375\326V\277%\2134fJ\273u>\215\371Tv[\303\334\3710\017f\344k/\214mK\354\353-\366\326\350]0_\267yzW\0365.\272>\373\246\031\236\245\004\357PE\247#\021@7\245\361\251\202 \221\362\271\271=Hu6\371\3065)\0321\r\334\346\316\206\206\006 \021s\030\264"
+	.string	"\206+-m\217)eG:bj\232\376<{\022\206\036 i\005\206}>\355\016n\036\335\237\355\331\327m\262\300]\\v\346\353-2\306\f\345<\035x\255\326\235m\227\267\212(Q>zWj\313*\333\221\336\336Z\216G9\034\021\213\005nHF\310-\244\224\223\201Y\200m\224\213\\\300\r-\251\0342ir8\024+\007\230q#\306ie"
+	.string	" \250\317\375\004\033\031\222:\354\232\273\336\224\350\244S\001\006\207[ \254\370q\222\317`\b3-r\3001\261$\375y\266\323\373\236|#\313\364n\223\0161On\213\250\017F5^\264\242\207\301\220\306\250\3543\033lR\314\216\024t\353 \277\257v\032\025DF*\242\033\231\200\315\250!A\205\320\314\211(HA!\323\030p\002\031\0212\253\007\022"
+	.ascii	"\225-F%\"H)\021\221@$\311\004\005)\253 \205\016\346\n\226\223"
+	.ascii	"\036\222`G\213\177\003\273\331\214)\241\024\007A\362\bi\032a"
+	.ascii	"\210 \372\272\343,T\272\360z\365<mEe\"\013)\245\215~\024B+\376"
+	.ascii	"\300\206\242\235\346\205\200;\203\355=\220\254\0071|?M\2008^"
+	.ascii	"\222\366\221\257\365\034R\020\202\332CO\305\302\216\264\027!"
+	.ascii	"`\214\203\025\350\372\031?'E4\324&\350/\335t\n\317\347\352m`"
+	.ascii	"\225\313_\247\232\210V%~\250\023@K\347u\216\\V\t\231\273\270"
+	.ascii	"\331\230\352\2065\006(\223\235$\357\214\204\\\211\225h\276\263"
+	.ascii	"\304\263T\216\027\342\256\024p\251f\001\206\274\204\261X\"\371"
+	.ascii	"\034`\256'\n\361\260\004wp\211\353\024K\343\211\003\324\337\251"
+	.ascii	"X\025\222_\320M\272\221\217\264\235\355pt+B\225\213/>\024\t\214"
+	.ascii	"\272=84G\207\007\353\031(\276\027\320u\375\247\326\326\265\270"
+	.ascii	"n\340\211\205\213\371!t@\3118(,\260\257\261s\034 ;\352\030\024"
+	.ascii	"\232\2078JK\016\312\274\363\301\251I\202\006\265\363k\245@\b"
+	.ascii	"c\021y{\306\206k!R1J\261r\003\270\333\236W\374c\020\tP\235\002"
+	.ascii	"\330|\320D\030\023\315\354\fA+`7<\216\247\201\274\234>\271\340"
+	.ascii	"%#\307\365\346\255\346\266\200]&\004\003[(\032\f\031i\025\333"
+	.ascii	"\375\317\232kq\306KR\352;d9Z\324:\275\367 \377Q\036\270\335H"
+	.ascii	"\344\r\225\312\204\211\202\371QA\344\270\254\254/\333\1771\324"
+	.ascii	"\303\264B\272\320\341u*w"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\t\005\025\r"
+	.string	"\206\0213-`k\222\016\022\004\201\002d8@l\001"
+	.string	""
+	.string	"\200\371q\213\242(\232<$+\352R\275^\324\276\227$I\222\352\257\372\377\333'm\023\231v#"
+	.string	"#"
+	.string	"*"
+	.string	"\307{\026E\033\207\242\272\260\020[y\276\365\030\325\254\326\353\027Cq\273\340u\354\353lv\263\351\315b\317GKR\217\032\362\215\211\205\265\260\263\025\177\222\\\004\202\230:\236\3761\246\277d\354]\204\275p\210O\333\343?\004\003\002Q%\021\326a\310\372\251\330\026\212\031JZ\031v\005D\035c[\207\342\2305>cn%\324\300jX\310\372\001\220\230\2576\207Bq6'v\206\243mh\366\\P\210j\225\265\326\332\"8y& \260\007\3013O\034\334\273\343\017\234\3624\270\202^\250a=\203j\264\240\205\245a\r\220\002\221\252\";\022"
+	.ascii	"\323 \001\302\243\030\201\302\240\224\004UL\346O\241\341\350"
+	.ascii	"B\206A\235\304\366\\\251\344 \264<\026\372+R\232?=\f\376C\246"
+	.ascii	"OT{L\255bt\345-+8\260\351\265\217\305P\266Y\315\325\376\b\236"
+	.ascii	"A\367\242U\264\346@\223B\236Wse4\364\362Q\337\265b\336\377Z\033"
+	.ascii	"\257\r.\273\323{\034\212\342f\270\371.\370\240\323\214\326^\341"
+	.ascii	"\223\243\310z\004\342n\252Q\301\001\3452\27495=M9&\367.\240x"
+	.ascii	"\f\020\331\034\001\0209\016\240\340\232l\230\344:\013\206\301"
+	.ascii	"\301\204\2124\243\244\227,J\260\330\0334-\020\\\356\364\211\343"
+	.ascii	"c\024\255\225\355M\350\231;!;Y\311\275\273\203W\265\"\003"
+	.text
+	.section	.gnu.lto_.pureconst.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375 V5\002"
+	.string	"b\205\020\030\200e\241\0036\267\240&h\2162\"\203\003\360\267\360\267\360\267\220\247\204\3547\033\200\315kZ\263\232\324\234\2464\243\t\315g:\267\271\314]\256r\223\003\310=\256q\213I\314\357p\205\033\334\323\356n\013"
+	.text
+	.section	.gnu.lto_.ipa_modref.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\007\004e\f"
+	.string	"\342M.2P\213\222\016\220\210\231I\304\356\346q\320vb\222\223\360\256\252\020\231\2340\3252\3030\210'>\373\r\260\205h:\214\343\330\350\305\211\261\b\265F\244L\001Cx\200*\352\016\007\210C\375\345B\321\226v\024M\363S\276!\321\240\265a\r\177[\006K\306\202F\001#\241\"\302\305\001\307\340g\201E\253\250\274\207\021\274g\240b]\224\217\325\021\b\265c\250\304\002x\021\2007\231w,1\tEy\246\245\376\311iG\253\323\350\216\244y\307QD;\246\233\262\354\356\311:\276S'\220\021\353\203\364d\2445\206H\360\207\362\211\316\252S\323\236\351\327\327s\316\3121e;L\371I$j\2501md\027hg\337\260\002\221!;m\022"
+	.ascii	"#yB9i\240\231@\306dr\246\234\273\001\266d\320!\260\004\b\222"
+	.ascii	" \223d,I&[D\250\273\023\026\234\216dN\317\030\t\243\325\316y"
+	.ascii	"\304\177Z?\266W\270;6\213\236\223\304\204\322\212\266\325\370"
+	.ascii	">\372p\310z\013\002\370\241@\022\037\305\300\031g\017\321X\302"
+	.ascii	"\210\313\354\320`\232\212\221\022\224\355\f\274\254\256i\334"
+	.ascii	"}\\^B\340\301\005\210\233\331\326\372<F\301\277\341\332u\272"
+	.ascii	"#\fQ\232I32\323\202vd\275\f\034\202\207\375\254\352\367\340\""
+	.ascii	"=r\264Q\334\004\025\355\003p\026\r\003]W\322 \234\361\b\203\314"
+	.ascii	"q'\330\304%7v}^\251\341\200\304\\\250\036*\"\334\263g%\032\005"
+	.ascii	"\250"
+	.text
+	.section	.gnu.lto_.lto.4532185fc8eb772,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayConfig_Registry.22.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375 \227m\004"
+	.string	"\364\007`"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\255\330\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\364\006us\250\314\006uq"
+	.string	"\005\001\006'\001\001\365\007?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/drivers/display.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_displayConfig.24.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375 \034\341"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\177\001"
+	.string	"?\202\210\200\b}{\273\001"
+	.text
+	.section	.gnu.lto_displayEmulateTextAttributes.26.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\330\001}\021"
+	.string	"\266\"xG\340\320(\035rJgH2r\233\216p\031\013\360P\371\230\313\b@\r\to\210wd\035w\224\026\207`\243?=\244j\267\263\0017o\363)V\341x\030H\206\033\003X\206i\304\260:8\273\307\223k\211\335\233H\231Rc"
+	.string	"_"
+	.string	"d"
+	.ascii	"%\335\343\007\316\247z\021>\210\207h\271\215\345\035s\336\b\375"
+	.ascii	"\314\031\032p\201\356\321\341\005\310\307\356\036\362\321\266"
+	.ascii	"E\276\026\303\036\342\310 \030\232\335\204\346\f\275\335p\330"
+	.ascii	"\271U\230\017\240"
+	.string	"\026;\327\315|\271\021\nB\031J\265\027nch\306\342\267kLM\246:\"\231sZi5\013w\274m\005\266\035\330:\022S\211\3540\246\253\301>7\347\234\336\033\333\352\322u~\216\207\377\306m?\351<\177g\265\034\251\343H\315\215\324+\325*\325\357X\f3\237\0010\346\224)\2421\201\342\211\034\333\267\337\323b\223\354\217\022_\324\337x^4:4\260}\234~Gg\002\321\017\003\017\337\352G\204+\013Sb#\212\021\244\365\311,\n\363\022\3169C\324-~l6k\224\214k\262\363\342E\207\374\243$\267q\027\305\214FF\342(\271\313\255\246\250\360\201\244v\204\024=m\367\263\221m\314\332sAw]\234\026\364\032_\311\257\356e\314hdZd\337G\265\352\346\234\347\340\277\344\3437AL\215\213\026Y\316\250\370\3551\007hFP,\227\013\344 \270P\252\023\212|\3602Y\203!&\221\220\023x"
+	.string	"\304\343dR\201\256\226*\325\331\004\262\002\242\250\264R'^\213u\222\220b\235x\252\024\230\342\231X-\017\204\200W*'\226\347Z\255X\036)\234\347\346\336\370\267/XQ\343cB}\230\364\226Vn\214m\271&qY\031\027@9vcm\320\244\247\2256n\314\335+\037"
+	.ascii	"tS\260\305\320\331\177x\276\355\025\205\306\340\2759y\be\023"
+	.ascii	"d\271\314.yc\003\214\022\302\256\022Z;J\232Q\347\354\224\351"
+	.ascii	"/\266\232.#\202\304C5\004\302@\200\220M\b\255\001\021 \024\241"
+	.ascii	"\222\245\241\332iJ<\032\203\332\003"
+	.text
+	.section	.gnu.lto_displayUpdateMaxChar.27.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\262\004\325\035"
+	.string	"\246\262\266J\240\230Q:\300\331\233\230<\341\013\230\213\335\336\243\213\236\217\237\3448\360\311\236\326\351&E\003\370\226.\302\024\330\267\373&:n\3574\243\327\037G\214\307\030\260\nkK\007h\303\214X\013\020\016M29\336\315l\311\337\204l\231d\234"
+	.string	"\232"
+	.string	"\247"
+	.string	"A\005\322\213\364\027E\264\240\270n\362\205"
+	.string	"1\313n\266\214\331\306g{3\037\352Az\027\006\235voS\225\343\275i\003fp\336\344\364\002\354\315\3634\366&\367\230\257<}\272/\0333\212\206p\335{k\365\306{\227\305`\347\313,\273\307\177\345\300\214\202\276\313\224\036K"
+	.string	"{\345\324@\222\3613\251\370\004<\2001\372\365,`\322\261\250\315,\240Rys\357}\024Q\227eMQ\230\034\263 Q\251\200\313\207\374\324{Ep\250\373\225s\357\3456\n\"\235c\316\3147\230\371\306\\\346\b\251PW'\346\327d2\231\344\332\304\034k\246\311\232g\316f"
+	.string	"\261\346\031\254Y\346l\216\271\360\267\257\346~5?\200\335\202b\200\313\275.\222_.\226\211\324q\252\237\371|\342\217?\257\342\033\271\361H\226\\\tyO6\333\277\022\362,\022+*\237\0023lf\337\352\347T>J\2046,l\\\2649\2621\221\027\351\235*\305y\217\2471\312\323\326\275\300\0057\331\302y\363\246<\215%\3760\313>\005\364\224/U\203F\331\207\345\215\221^\244\tI\013n\0228\332\336\037\002]\030X^\245\344\353\362\342`g6\374\t\007\020\270\231z\200sw\322\241\311\316\003\317\336\004p<\206'\306k"
+	.string	"s\354\272\252z\321g\246et\253\337\374\220\305W8B`\372m\241\321\345\303$ag\374\341\037\365SJ\217\255\256-Z\333\3122uVoLC\325\3071\310\035\r#=\002\226\250\225\251!\244\254\fu\227\017W\202\236\367\016I\340'\021\201\323\331\2332\365"
+	.ascii	"\347~Dw\336{%\360\221\273\021|\034A\366fL\rPE\370\353$\177\352"
+	.ascii	"\031\226\262.u3x\344\322b\353\207\277\371\265\027n"
+	.string	"bT\326m/\314\001h\017\252\203\366\344L\234\214:\300=p\220C#\340\320\344p<h\017\217g\347d\034\316\017Z\342\004oG\247\306\333\345P\354\354tj<;\250\211\032n\307\253\341\324\260\356DnW\353\321\351v5Y\372{yk\023\021\013\326\257\n\2257Eyo\r\n[\303N\376\210U'*\b\264\266X&3\342\021\254_\013\244\017 \260\256\314\027.\3456@\353\336[\301\030e\251\311\344o\366\265\253\235\242bI\250\223\314\214\341\305\333+\203\0311\tO1\222\2029\253\323\222\323\352\356\352/\276\231\006\264\2555GMKP<Si\365\306Dd\fk\250q\034\350\240s\244dDR\232\202B:\200\002\221)\273\016\021\220\265TgJ\225\306tFG\246\312n\017'\2100>\254\230\035_\270.\215o\347\003\311\367\241\027\320%r|\333\340\n4\217i\273\374\274b<\232\324\223v<\361\220\271"
+	.ascii	"\236=\2545q\273\tT\210\240\336(\241\356/]J(\232\332\303\004)"
+	.ascii	"\210\276\343\252@\245\221\354\200\036\271\331M\345\345\2105="
+	.ascii	"\241\261\370\252\005\301\324%^\022\341\031N~\020\334\b\351\253"
+	.ascii	"\004RT\214\214G\345z\367#C\365%{\225\200H\237\232\306\245\002"
+	.ascii	"\366S\2260g\223\300\217\252)\331|\376\311\021\201\"\217\233\033"
+	.ascii	"c]\315\f\300\257\352zCFT\365Q\234\337\302\277d\252\211\250\017"
+	.ascii	"\352#F\341\r\222\254\210\312\241\354jp\210\242I\356\251\001"
+	.text
+	.section	.gnu.lto_displayClearScreen.28.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\305\013"
+	.string	"\026VQE\020\213j:\300\1778\224\235\020_\343}P\005\205\023E\265\315J\001\245\310e."
+	.string	"\310\026\302O\327\232.\2558\263\261\034\032\307\n4\"\003"
+	.string	""
+	.string	"\"T"
+	.string	"\bz\210\206\003*"
+	.string	"LM9F\200\n\032\022\264wJ\001;"
+	.string	"="
+	.string	"?"
+	.string	"\273\312pa\367\334\260F\367\315\347)\270o\3351\3347\2336\207\237\t\366\023\032\fh\315v\327\253\bn\236\232\376!\274\222R\231N#@v\3274\245*p\327\333\316\260-b\377\0130\326\211\326<\301\340\244\305\226\202\260O\023\255\007\354Svw]W\366Y?\245RSJ\375\356\243\303\314\303\205\206]\002\265\020\353\3320,\260}\213\235\201y\234\332w\360\007\346Y\245Kl/\231\213\026\373?\234-\276\302\347\362\262x\311\270\017\033*\224RM\253-\006P\325d{|\253\244\333Eq|\n\001J\022\367\215\326\n\333\344\022H\034?\302\350\244\333\335+\370\346\227\270o\257\227\3766 \307&\374:4\230\020\004}\242\022$v\0065"
+	.string	"\276\221P)v\274\222\fG\"\331\361@\342G\342\201d\351i2\036C!\351\211\306\221\364,\347\276\256\034Rs\235\252"
+	.string	"\233\367pvx\013\036\214\022"
+	.ascii	"t\263\240L\300\3307\003.\bP\223\233\230qNC\377bc/\344\370jC4"
+	.ascii	"X\007\266QjJZB\021\227\261\277\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_displayDrawScreen.29.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`H\002\235\022"
+	.string	"favH\320\362&\035 \016\206m\213\276\215\224\376c\005X>'{nz9\003\262J\352<\207J\020\232h\203d\266c\016\316\024\026\334\254\354\3270\335\252\\\341\245q8x\210\344\033\276\007\320\237\006\204N\354\263\237\020\262\211\224)\005_"
+	.string	"]"
+	.string	"b"
+	.ascii	"=\261\333n>\262\253Sd"
+	.string	"\264{;`\024\360\321\267\017\360\036\301\223x\217\216\3318~\033\261\307\261\250\240biwC\025\361\330c\247\031\363\277\324\310\r\234\307/\225;I\216\031\215\241\232\206w\024P5Z\252Hm\326\235\354\356}\236\030j\264\314/\265\273\316\013\265\234\333\273\355\026\333\013\354\314\t\032\302~\267\273k\325\261\275\364\251K\203\334\366\1771\335ui\325tj\372!\337\316\214\0020v3\374\360\261H\361\205\t\377\3479\233\337|\234\326l,\035(5\263\260\035\221\007!\003\217%2V\236\007\262\271\355\246\344\2669\337\320\023\203g\351\321\377\261\261Q\217G\331&G+O\373<\017\2734\026\277\005\314\213k\274\307\223\022p\353D5\006Q\021%?\367SQ\212\244\343\316\240i\207i\307\247\007\372\211,\233\034\022\324A\273\013=\365<\036|(\025\205\304swq\324.\357\332\202S\242e\017\3331\017r\201\273\313\342\257\230\201"
+	.string	"\226\270\361\036\257\002\224l\262\374\341\f\342\220\264\331d\337f\031V\251\254\020\250\260T\tRHX+\031\025\rL\246\005z\2252A\0053\003k\271\204\260\027+B\353\345\022\312\264T1\341\352\005\013SL\354\232a\275B\032\227\353\025\242n\262w\253:Vp\002I\2463\007\350\354\006?r \341\245\263[wQ\243*\362\341\3679X\003\205\021\223\016Y\004\220\237\372\244F\201\240)\216\237\363\352E,03 `\002!dg\007t.8\017m\227\030\r\t&\260\035\002y\223F@\304?Q\312\366S:\025Fxd\340\0310\003\363\215<\203\267\030\321\023\226ay\245\361\243q\245\375\343\035\336c\261\273\335;\204&!\307}\024t\\\016\0167Q\\v\r\243\215\331"
+	.ascii	"\361\304\243\253\216\360\1771\305\342\303C([\305\255\364-\244"
+	.ascii	"\204]\3627\215\032\317A\230\345\024U\323\233\200\313"
+	.text
+	.section	.gnu.lto_displayScreenSize.30.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"u\n"
+	.string	"&\224I>\020\0059\035"
+	.string	"\360\022"
+	.string	"\034\322\242\225r\004<\224\356\177'\250{M\263\\\004h\002~\341\337\364{\f\374\224\237\330\267\246\024\002"
+	.string	"@\005\n\323X\n\356P\242\034\371\027\2610zjd\357\224\0027"
+	.string	"5"
+	.string	"9"
+	.string	"Gy\212i\323d\247\210\353\0375\031/\001v\327\003}`\273\226\335\263]\253!7OM\377,\317L8"
+	.string	"\264\\\252\323\316\303\356\232\266\\\033w\275\355\003\333\020\366\013\002\316\250\267\237\177V\251)\245~\247s\222\363\271\331\325\210\rX\034m\246\304\266iw\366G\205\341\324>\354+\346\317\324\005v_62\273g\202\021\270k>9\333\016\264n\325\241\203UU\266#\036C\202\271\030-\266k\264\032\330\023w)\271]V\203\337\202\242\340H\256\371\251\355\332+\301\blEc\356<\226\n\260O\025\255 \366\263\255/\007\376D\240\202(\374\026B\236\020,}\247\262$r\006C\025\237\204\251\024G^I\206(\221\034y%\361#y Yz\241\217GSHz\247q$\275\356\334\333[\005\255*\206;\232U\007\016"
+	.ascii	"t\263\240\314\2000L\204\t\031d\007\366\256t\326C\023\206k\"N"
+	.ascii	"\026\372\006\023\004\234xR\255\230\204I\006"
+	.text
+	.section	.gnu.lto_displayGrab.31.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\\\001M\r"
+	.string	"\026\331XB \221\222\016\260\242\300\317Ge\366\223Y\214U\356\307\204\206\201\024^L\026\020\263\237\320!\374\337\364\017\345\252\205\3142\363Z\211 \r0"
+	.string	"\f\004ID\rb\326\002\316| \260E\374v\223\275\211\224)\005D"
+	.string	"A"
+	.string	"H"
+	.string	"~\210\213\360|\264r"
+	.string	"\273\242\030\025\273\335\210\013\304?w\017"
+	.ascii	"\377\342C\340\237="
+	.string	"\366\215w\036\366&b\200`r\354\256\245\035\356yz\374\217\270G\350\345\363\244\022\354\2563\364\202\341\326\333&`{\201}\032\001\252\2611b\311\222\223\304b\306\246\016\273\373\244r\260?\355\356ZE\366G\377\307\224\216/M\2754\234\322O\323S\246U\323\231\351k\250\0272\006\220v/\224v\254\314[\001\302\366+[d\003\202\247\003\224\336B\206\226,\371)\324\021\320\fv\024\331S\020\027\023\203\307L\320&\222\252\206jQ\345\207:\325\225\006\027\375\330vp\230\223\270\353R\342\237\250\240\251\300\277T\0016\204\227P\211\273[\342\223h\300\305\017\177\376\n\374{\276H0\003$\331u`\023\222a\235+\205\353p\242\261\r\205\353\001\n\3071\261\270-\223\300\331L\254\016\347:\261\260\215\2636\"\326P\262\315J\321\264\315\252\272\375\264*\262\002\0302,\332\342\250)2\220\032\017\341\320\250\007\315\374\021 \324\033"
+	.string	"t\263\240L\350\020\032\030\017\204D\300|\333\270\217\034 \323\205W\253\001\214"
+	.ascii	"? \037\330\f\266\323BiD\021\002\334\005C\032_\007{\206\353\300"
+	.ascii	"6\225\316ji\202'.\303|\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_displayRelease.32.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`]\001E\r"
+	.string	"&\231XB\020\221\223\016\200\032\354\004\204A/\021\030\302\351\311\034\321\035\001\222\366\360@"
+	.string	"\364\363\204\303\360\337\330\360\274\237\bY\320\254\355A\222\020"
+	.string	""
+	.string	"YH\300\220*\220\035(\020I\177\024\264m\373\233\354M\244L)C"
+	.string	"@"
+	.string	"H"
+	.string	"~\210\213"
+	.string	"\275\204r"
+	.string	"\273$\025,v9\020\027\210\177\346\036"
+	.ascii	"\376\305{\300?"
+	.string	"\203l\230s\036\366&`D-1\273[i\207\203\236 \377#\3161b\t=\251\004\273\353\034\261d\270\365\266\t\330^`\037F\312\221QJ\311\316\3512\343\305\246\214\315\205R9\330\237vw\255$\373\245_3\245\343KS/\r\247\364\323\364\224i\325tf\372\034\312\206\213\001\335.\206\356\306\276\274\026 l\177c\177\\@\360t\224\336\202\006\225\354\374\024*\210h\346z\n\354iG\314\304\340(&d\223\213*\207\252\261I\215:\325\233\r+\032\262\355\340-$qwE\304?Q!;\201\177\251\002l\b/q\022wW\304'\321`\213\037\376|\024\370\367\266B.\003!\230u\240\343\201]\037\313d\373x\242\257\016\005\353A\311\346\031\2516\r\223\340\321F\252\217\307\"\251.m\253:\037\316J0\2552\3112\255\332p\373i\225d\0052/)\252\342\250+\260\216\030\037\321\320\250\027\315\274{\004\b5\033"
+	.string	"t\263\240Lh\021\032\030\017\224D\300}\333\330\217\034!\323\345W\253\001\214"
+	.ascii	"? \037\330\f\266\323BiD\021\002\334\005C\032_\007{\206\353\300"
+	.ascii	"6\225\316ji\202'.\303|\253\321\340./\332I\006"
+	.text
+	.section	.gnu.lto_displayReleaseAll.33.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\251"
+	.string	"\r\013"
+	.string	"\006\225MC\020\251j:"
+	.string	"\357\216\214\246c~\231"
+	.string	"@\013\217\315\177\300\203\001\f\257\354\377\021\240\f\007)\225\027\332\320\245\225uY\313\241\027!$TWU]\005\024@x\033L\237\002\005\266\343"
+	.string	"\246\307\334F\215\354\235R7"
+	.string	"9"
+	.string	"<"
+	.string	"{NX\242\373\346\363\r\334\267\356\032\356\233M[\302\317"
+	.string	"\373\004\263\220W\205\335\365*\200\233\247\246\177\003\267\254X\250\323\212\305\356\232\256X#w\275m\b\333\027\366=\001$\020\226Z\260O\024\255)\366\265\335]\327\226}\327\257UjJ\251_\271\230<\210\200\355\212\314.lls0\300\3661\366\206B\305\251}\002/`\336u:\303n\213A\203\r\207\2052\262\215l\302\245\304B\265jZ\215AQU\224\355\361\257\215nW\365\361\025|\224&\356\033\255\0166\307\021\230\272\335\375\370\007J\035\235\200o\376\211\373\366\232\211\340J\321\231\351\202\376:\240\247\023~\024\034M\b\212>R)\022;\203\034\217/cT\212 \257$\303\222H\202<\221\370ix Yz\234\007\217\243\220\364H\343Hz\230s\257mm\031\343$\226\252 \366C\234-\006\017"
+	.ascii	"t\263\240Lh\303\013\f\017\341\213\335\274\220\356\2535\317\320"
+	.ascii	"2\200\273R\\\315\214u\3412\340\267\232\002\356\362\242\235d"
+	.text
+	.section	.gnu.lto_displayIsGrabbed.34.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"\225\f"
+	.string	"F\330XC\020\221\223\016sJ\b\355\241$\267\032\264(\252 P\211\224\230w\314g\312TQ\325\013G\245\307j\260\317Z\246W#\344\310(\227\tB\035\001"
+	.string	"E\212\300\371\035\262\353\360\201~s\023i\230H${K\231RI"
+	.string	"B"
+	.string	"E"
+	.string	"\031Rbn\354~\230\206\270\350\021j\212\374\303\034\316\214`\241\342\235<r8\204\004<\314lHP\003\202\306\345aH\205\233\226\026\250"
+	.string	"\036\trP/\035\016\363\\\361P2=\034\354\256S\305\323pW\267\r\301\366\003\373\037\001?\375\n\323\251\351W"
+	.string	"J\324(\260\261\313\222\322\2614\361\005\t\333!\373\262\013\320\210d\332?q\024\241\237L.`\267\004Cf\367\3730\307z\364\367\001\325\243\365M\365h\333!\"!\213\376\211`\271);F\231\252\242\232\240K\214L\r\250\245\256z\f{\302Ut\326.\251\201\237\302\002\005\313\345\361\212@\306i\224\251'\352\245\305\205\332\244R\275\211\0253H\211\303\327\207\315\034\366w\222j\262\017ww\255%\333\351\030\316@\264\020\220-c\320\331l\332'+\351>\036\313Z\347B\026\201\244\363\214`\035\267U\360p#\330\307\223I\3004\256\303:\006\f\"\3318\254\004\004\342\260\353\333\303\325\222\023.x*\347\251+\266\243\036\030)\212S\243>%\021"
+	.ascii	"tS\320\301\320;1\274\032\027\001\327\200\034\260{\b[Pc\tX!\265"
+	.ascii	"{\n\226\221k\240rY\034$\\zU\305\254`\356\001"
+	.text
+	.section	.gnu.lto_displaySetXY.35.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\264"
+	.string	"\325\n"
+	.string	"F\024KB \307*\035"
+	.string	"\213"
+	.string	"9\323\214\300\013dn"
+	.string	"\371\374\005%1\267\233\203B\"!1\251C\023\262\206\020\306z;k\303"
+	.string	"\035\020@\222H\020\b\033  \250\251\246\324\203h\023\252\3355\250#\302n{\247\0244"
+	.string	":"
+	.string	"6"
+	.string	"\216\330^]\236A\363\272\275\243y\365h3x\271\262\227\231\214\310\032\354.GU>~\216\376\003\034\241\345Z}n,v\327\263\345*\271\351m?\330\326\260_\021'\377\271I \017@$\330%\251=XZ5\340b\373\034\3333 V\313 Et\332!\321\3702e\272\213\262\340b{\365\274\210>\355\307\0346\236T}a\3675+\260[J\004\225\332\342\t\300(\265;. \265\355.\205/\013\371PP\320\362\352\2534\257\r,'\254Y\363\234\301 \330\351\300.W\223\246\330\317\354\356\232\276\354\307\376\372\362\247\001\250\203\334\035\310\013\201\276n\342\323\371<Rw\022I\340f\357\203\3526L\"8\342\304\360\363"
+	.string	"\303\021G\002;\016\316\013E\356\343\340\222\351\013\271S\251\024r\234r\237Y\3722\006"
+	.string	"\032\213\2128\021"
+	.ascii	"t\263\240L\350\t\007\206\013\252)\277\200\tS\217\3356v\214k\354"
+	.ascii	":\214\007\212\200q`\030\240\202\005\241f\203\273\274h'\031"
+	.text
+	.section	.gnu.lto_displayWrite.36.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\265\001E\020"
+	.string	"v\037nF\340\262(\035\203\002\030\226:\247\203\304\330\267\3719\241\0326(\300q\310\232\261\315\241\3410\201\240dh\037\3339\205\340\2076\354s\364\007\333a\206\232\306r\214\26323\274\005\341@\303\313\267&C\355\223F6\2212\245W"
+	.string	"V"
+	.string	"^"
+	.string	"[\343\203A\367H\"K=\355\343\234\005\3700\346\"\2736/f\354\206\t\214\240{t\330\331\366U|\005h\327\330\302\0224\277\251\315\354\004\331]\257\344\001\270\307\355'\356QI\034|\202\376]|Ka\342\007\215&\366\f-\330]'\215\246\303\255\267]\300\366\003;S\001B\3540\226zc\177[\265\2615m\272\316_z\370\223\236\363\217\316\363\2134\035\3224\327\245c(\275qi\345\322\031\323\027\031\341\320a\340g\227C\320\220\315\021}P\330\006m\222M\"\"\265\361`\020`\332Y\213\020\016<\350"
+	.string	"5\330\220\322\264OR\340s`\254\033\021\272\335\031\212O\303EB\307\302=F%P\303\261\277\313`\3516\035\251\341\334(\251\255z\214\221\032\210\354\261\241j\257\016\003\246\333]\024\277\207\302\004"
+	.string	"=N<\3721\334c\362\240\001\031\3515\324\310d\220\257\251\2723\003$\313 \223R\244v\005\225<\355za\304Lc\316\236\237\035\233\001\260\277<\303\375\231\250NLV\237\002\324i\245j}-\260\026\253\263\n\365\362YX\201\261R<\330k\345\302z\245x-\326\247\342\251^0\0175\300\256\225\325\313kq\271^\036)\334o\2536\266m\322\022\231\312\370\224\007.RNCJRG5\351\266\0374\346\221\206\364%\345\364<f\200 \334'\037"
+	.string	"t\263\240L\350@_(/#V:*\300J:\021 \026\266x*+\030\006\256\335\024\r\252l"
+	.ascii	"C\030\266\025\3173\230\300\f\3335q\031\331\210_\013\210\013\205"
+	.ascii	"\3010\020\004\224\003\203\201\021\200\n\241B\r\001'\236T+&a\222"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_displayWriteWithAttr.37.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\234\005U$"
+	.string	":D\230\016D\200^Q:\003\305\327Tis=\346\243\214\277\177\007]e.\326)\371\316[p\362\2619\034\2126l\034h\2358\264H\241X\201\310\364\221\212\031x\307\231@\362T\277*\f\\\201\202\304\366\255D\226\020\271S\n\332"
+	.string	"\303"
+	.string	"\333"
+	.string	"0^\251\200\324\2129\266\234\325\212\f\301\305\343z\227\360d\202g\255bA\213\313Y\255@\024\334\264\207\363\346\003\031\310Y\021\023\303\f\003o\200\302+\267f\0200\252S`\244hX\022\346\306\215*1\216\217\fFxK\355\007<\341\277\334\360\326ZE\b\303y3\347\203wj?\353^\204G\342\370Q\255M\310\314\324\212d\340\005\347M#O\333>\227w\021\332a%\362\311\361VXE\255@\265\326\235\356\003h7\313\007\240\335\\'\027\236f\226K\205>Q\323\327K,)j\214G\251\323t\265\326\223QQ\363\034\362\262Lpv\346\317\311N}\374\230b\374W\016\272e\202\2526B"
+	.ascii	"\034\247\312\001p\230\344\271\330\351\216#\221R\242\246Z\253"
+	.ascii	"\251\361\030\344&\272m\033\266W\330\346\224\225\022\262\221D"
+	.ascii	"\272V\3667\231L&\275Ml\033"
+	.string	"\265n\251\231\226zi\251\225j\324\271\245.\360\261;\351a~\001G\376H\377\362\037\335\3536\372\326_\364\255\033\267\324\267\245\266-u\255F}\342\250\211n\3244\033\265\271\324e\215zk\324\264F\375\0037,p\024|\325\372#Y\250\226\231`T>\366\223\371\275\276\366sa<\223\371\226\023\0333\346\3502q^\314\276\371w3>\232\207m\0209X\265\326[\232\262\026\251{G\017o\351\323\370\001\357\207\254?$P\2015\021u\324\222\013\n\262K \2468\274\323\203\375\216\304\261:j\371%&\246K\240\233\376\231\237}\273Im\241_\346_\276\345\274\360l\257\364Fs)()\256\224q]F\222\366c\327\0318\f\232\321&-\325\242\352C$\373yt\021\231\240\345h\307\\\253o\034&Yv\224gA\323]7<\330\377\365S\016Y\025t6\324-\365S<\324c\363)\306\252\262]++8\323\236"
+	.string	"sg\212\016\362\322\226\313\264\367S,\242\264KK\265\212Gr\253$f\021\207\023\303\271U\262\223%\366\017j\314\036\366\013=\200\b\342S\237\346nB\332\203\355\226\373\342\241\213\371.\316N\327Q\300\332$\376&\351\n\t\3452\264v\211\273\271q\326Z#\370mF\230"
+	.string	"P'\n\016\332M:\307\270\347h\277tOUE\244\311]\255\342\241!M\3326\210r\0012\332{]7\244\204\\D\213\326~\352\321\033\215\226\204\222\251\2252\345\362c\026=\033\276\016,\236~-N\324VD\251\200\352\265\240\245\210qb\201QQNe\3605N\343vr\360\364\300A\317\tB\203"
+	.ascii	"\275'(\247\250 \224\357\364S\203\032N-^\004}(vA`O"
+	.string	"\206\017\210b\007\345sr\261{\002\006w\r\226\374{\321\003\356\242~?\340\356f\333\310\341\313\272M\020\f2\3752\035\314 t\260\\\226E\213\333\035\266\013\254n\270D\007\313Z\227T8\373B\223^\242\265\305\255mo\213\264&\332\002[\326\"+\345\243\275\tX\333\271\265s\001\\!\271p<\030\316Z\247\"\370w\200\031N\037\355&\3212]e\331\032^\307G\333\244\253\254\341\327m]W\314p\373\255c\331\326\213\272\222\224\r\313Zk\245\255\225\331\315\005\022\240_\3631\034\222\366k^\246\303iDZ\373\003\210h\250q\030\346\020cL\215\214\214(H\232\2441p\242\031\263\353\021\360\251EcZc\016}S\335\027\264\005R\261\246\373\212\\ @\331*O\324\363O5\035\025J%\276\346\346\237q\327|\250Y\007v\215G\336\026pq\002\311;\204o\340\031\256\3230Z}`,3>\323\322\r\206\323"
+	.ascii	",\223Y\214\2308'\030\023\020\274\246\225\\Z{<\322\355X\372\272"
+	.ascii	" \3067\271\323\253\t\2377\344\304\305\243\366\t\266-\251\210"
+	.ascii	"3I\376\251\350\032\207\361v\244\246\033@\242\037\343\326e\nt"
+	.ascii	"\233\227\277\206\002 \367\027\246\251\275\353\2209p\274;\203"
+	.ascii	"\307\252T\031\252\314\243x\177F&BFN\226\236\021\350\364\320\304"
+	.ascii	"\337\266\267\320\343R\307\267\303\354. R\005CT\250D\024\343k"
+	.ascii	"\302\025\036\2350\370&\205\247\006"
+	.text
+	.section	.gnu.lto_displayWriteChar.38.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\325\002-\025"
+	.string	"6\250\214J\260\022R:#\036`\351\321\nJ\020ug\374U&\275\016q\271|\362\006x\203d:\303\326\216N\221I\254\257\375\256\233\272e\366\323J\224\257\2636c7F\234\242^\341\270\244\314;\377\321V\253wZ[\342\264\344\223M\344N)w"
+	.string	"q"
+	.string	"z"
+	.string	"/V>\355\013o\304\3730\347\002j\rR\321T\353\020\305\007\312S\017K\333>\211\227\340\331O\343p(x\241\"\217\322\217Z+\355\3441\362t<\ty\272\037\316;I\307\235<\277w2A\321\0250\270\341tT"
+	.ascii	"\002\207\224H\020\303\370\200\303\317\316\0345|\307\002TN=D\202"
+	.ascii	"\2771\346S\004<\323gO\3207'\253\245\326\352\t\ff\270Y\267\215"
+	.ascii	"\263\355\300^X7\352\004b\017{s\205\354\217u\203\354\235\216="
+	.ascii	"\351\207\375\350\177}\351\037\371\360w\355tk\247\313\235f\355"
+	.ascii	"4YNS\326\364HN/\235\236t\372\262\020*\033(>j\365\271\nRk\320"
+	.ascii	"\025\"l\363\354\020\333\204\307O\034\005\357K7\363U\177>\240"
+	.ascii	"\006\345\351k\232\344H\332\375U}P@\006P+;m\225\025\336\217v\336"
+	.ascii	"Z\201t,(OM\002\344)]\002DB{\302]\320\214+#\022\322\200\255]\373"
+	.ascii	"\223\214\250\203Nq\327\266\235\305ND*\n\270\343;\362\265\273"
+	.ascii	"\253\264\003\344\223\261U-F\230\240+\344\221\235\353\2024\243"
+	.ascii	"i\256l\022\237F\327t\255M\0017\017\364\311o{\016@t\372P\025U"
+	.ascii	"\323\372\206\374\272 M\375f\225\355\nOq\303\342\023_`\312Z\353"
+	.ascii	"C\234\3729\344\351\267dJ\2503\257|\246\003 \032\005\266\343\374"
+	.ascii	"\302]K\261\251\244\334j\bf$7[L\255F\027\203+m\233\341\324,\314"
+	.ascii	"\350p/4]\356f\203\313\275\320bp5\030\232-\247\243\315\006Xf\346"
+	.ascii	"\226\243\325\310\310\344h!\303\372\261n\220g\212V4\266gz\313"
+	.ascii	"CQ8\316\336\332\036\333\255u\213\316\372\310\222i\340\344\262"
+	.ascii	"\266\\\327\232nl\307\372\263=\277\266\204-k?\262\344>\212\307"
+	.ascii	"\n\302cD(k\375\261\3700l$\320\0040 \200\"\222C\036t\026\334Y"
+	.ascii	"h\0047|\021{\005\3306\234\367>\216U\207\032j\217SVi\341\325a"
+	.ascii	"\273v\223\222\007\271{\\~\374\306\327h4\275D\334.\274\362,K0"
+	.ascii	"\271\344p\rn_\n\013\301\256\232<\356\024b\255\030\212\2338\351"
+	.ascii	")\242K\301-]\225h\224c\351\255\251\243#\200\206P\361\020OLj\203"
+	.ascii	"q\035llxL)\004\024"
+	.text
+	.section	.gnu.lto_displayWriteCharWithAttr.39.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`{\006\205'"
+	.string	"\032Hx\017Dp\336M:\353L\372\037@\036Q\250^\260@\213\206\314\033\335F\020\346\356\257(1\341\226\274\370fO\\\035\204\273+\213\003-\345\304C\221\016ut\312\033x\321\016"
+	.string	"\224q\376\276\231\343o\333\324\032!r\247\024\346"
+	.string	"\322"
+	.string	"\354"
+	.string	"\265\"\035\330\303Xp\275\374\013\326\325h\320\242\2725t\322\341\274YD\177_]\256^T\207p\3108\2347\177\\\301\2456\204 \326\267\\yk%\022\267\341\2749"
+	.ascii	"P\360\324>\332\263`\275x\343F\265\"Y\203\254\265\350\300\r\316"
+	.ascii	"\233.\236\266\375+\307\202e'\313\242\222\260\233\301\021\323"
+	.ascii	"\374\324Z\201L?\312\335,\037 ws\223\034\353=\336\356\324\345"
+	.ascii	"\314r)\226\237\365\236\361\032\210dy\312\304\204\234\247{*\023"
+	.ascii	"#\373\256\251L,\310\3176\260 %S\255\365\3111\252#\322\\\271\200"
+	.ascii	"\210\032\037o\003#+\217\336\034\261\3635.j\226\026\226\314\241"
+	.ascii	"\343\013\303Q\216\b2v\343\233\244\200\t\241\245\217o\271\340"
+	.ascii	"\215L\037_\330Vy\364\345\244\353\306S\257\260!\245\272\247Z\253"
+	.ascii	"iW\230\330-t\333G\333$\354\034\2077\236g\374\323V) \2738\244"
+	.ascii	"kf\277\254\213\304\346Q'Xj\004K}`\251\r\354\250\013,u\323\273"
+	.ascii	"\374K\337\362+\375\256\366'\275\370#-\265Q\321\325n\242\245\366"
+	.ascii	"-\365\320R\013-uoG\315\033\242\336\tQ\237;j]\217:\307\2436\227"
+	.ascii	"\272\334Q\357IMO\352"
+	.string	"+\360Uy\003lS\353W\\\240\352\306\\{\3622\277\375\037\223\240\223\356\375\232\004\35521\316\n\345$~\361z\253\025\214\301M\2138\277&|\030\177\314\311l\2174+\265\326\036\262\254cu\353\334\t.=\322\020\202\302b\375\232\300u|\032\346\250%\230'H\0067\227\340\004O\177\024\276xcs\324r\f\233\032\026?7}1B\273w\223\332Xv\317\376\031\001#\003\r2{A\r\236\234\242\220\333#\2675\337Q\210R\225%\311s\315\332\334\334\252\001\364l7z\370?\344\316\366d\210\256\021%\350\273\314\255P\204\270Y\366\215%\177\035G \024\354$\227\350\316\"\227\340LZ?\376\306\237q\362\024\371\363\246\225`)\037\342 \2514L\312\212k\27153\203#\330\024\\\352\034\330r\021\354\371\020\307\2064\316\006\366\300\3224\"Y\2015\260f\023g#\303\005V\311\rm\355#\314\264\235\3145\354"
+	.string	"\373\263\247\036y?!\355\217g\322\242\200\274[\356\211\203\300|W\310m\310\361\307\302\261U\321b\256\231\223\226n\n.j\324\320E\242\306\270\022"
+	.ascii	"E"
+	.string	"Z\373\004\n\372.3mm\226\205\214\200\256\004\356\r\271\246\221\373\246\340\342\266E\341lC\375\f\215\263\326*\3017\003\"\352dr#w\363+\300\rM\213\3069QR\264\312\312\n\252\214\272\215\327\270\241\036DAx \005\025\301)\200T\024\025\224\225\220j\352t\224\223\r\250\0260\204S*\200\302*\251\031SU*\200TSP.\200QUB\240\023\001\277\200!U\005\264z\361\242\n\330+j}\221\030\306\036'\274\246\275\361\273\"yx\224N7\262\321\322\035\366rI\353\035\321\2724\223\266h\275l&\332[\241\035Z\337\"\255w\333\264e\035\333,+\255oi\207\212V\210\267=\336\372\316\206\\8\036\fg\255[\022\374;T\031V\344n\356v\351\fM\303\355\2548\027\351\f\215\312\322\332\033^\007\351l\212nm\016\247s\345\243#\247K\317\257rJ\253\333M\343\"2<F)\372\341F\213\267f"
+	.string	"\316\337\272\324%-\321z\3311\312Z\313,\274\314\237\274\321\333\026\032g\242\275\332\356\267W;Sn\177\001w\250a\034\006\rc\210\231\tdDD\2324\035P\2421\306\314\016\021p15t4\005\205B\007t\321k\273xXJ\272\310k\306F\"\34738\027\017)Y\250=\n\314\252\302\330\234\362E\230\006\245\307\306\272k\255\2111=\330\3641\344J\"\231\030\276`\305\316b\3562B\204mKX\236\241\241\360\264\346\b\343@\323O3\256\260\355\203\313T\226}cd\007sW\224\344\305!\016\214\341U\003\251\254m\031L\020\321\222\216i\031\004"
+	.ascii	"\2454|\270\303\201\301\203`\027\260\233\024\375\344\367?#T\336"
+	.ascii	"n<I\211(\017\243\355\260grt|\342wsY\220\\M\307\230y\376h\206"
+	.ascii	"\005\003cn\316\263P\246\243\f\263\354\241Y\236G\321\002\247d"
+	.ascii	"\3766\306\256zTw\377\200\020`\277*iB\276\232\203f\r\272\355\226"
+	.ascii	"\020\321\265\314?\365\024\250=\002\323+\232|\002\246\213\"\023"
+	.ascii	"Ia5\376B\245\310n\314\225dha\035\341\211\376OS \243\006"
+	.text
+	.section	.gnu.lto_displayReadCharWithAttr.40.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\215\003\355\030"
+	.string	"\346\355\241H\300VQ:\024P\327\353-\3109\210\325M/\336\b\224z\252\017\310\276\bG\244\251Y\244J\301\b{\203\221\226#'\224\253\223\317\315\211\337\342c[B AV\001\227\r\370\235L7Q\021Q\372\224\320?\204\220\275\345N)\215"
+	.string	"\211"
+	.string	"\223"
+	.string	"e*\210\2475E/)\355\027\271\221\236\353J\\@\255DQ~\265\356\026X\201x\352\335\t\200\247\342i\300S\333n\360\352\261\317wF,\256\203\006\016\211T\255;\327\352\270\317\305\020\244s\245\217\377s\361\276S\300\351\270\340p1\3640\306A\334}\227B9\024\222\302\370\234\n\256\004\231\301\312\235\23042\232\256\254rAr\247\003!)|\254\034\320\\-E\005\271\357\007\200\264\030\2222\274\251\265Z\252\310\271\270\001\334\366\n\333\033\354\215\021\266t\353\273\237u\244?\300{\377\314y\377\352\272_e\351\360\275\033<\357\246SzN\351UIK"
+	.string	"\322\247\031\001%\305%BT\255,\246\306\324'\272\344\307\225\376\246K\273\307_\272\317\253\032'\257'9S\317\233fb\375\211\270$\033\032\304\323\226\254yz\331J!\304z\0242%\031A\325\372Kp\352\fb\r\323\013\354\325\240`@zQ\336N\201V\r:\342\343\302\020$\236\267*P\025\031\026\216^S~\307\343\255\265Fenr\212\f\270\357\205K\265\001F\275K\210\002\267\b\001\221\271L\236Hy\356j\351\n\325\300\231\373\256R\362\205\356\315\215n\221o\207\225E\305y\207p\343&\305xF\311\024*&\223\345\305o\356\200\253\001_\2366\307\021O\313\302@\271\034\216h\t\222al\217g\002\023k\rz\340/1\021\313Y\003v\207\377r\304Z\353\003\337\311\203L\354q\352\227"
+	.ascii	"O\277\004v\350nr\312\254&\254\037\225\373\236\301\013\024\230"
+	.ascii	".U\212\261w?r\213\354\317\272D\0160\034"
+	.string	"I\263\331F\034J\263\331\306\t;\317I\334#\003X\003\006\261\321\201\rM\f\2463\332j:2\3210\033\236\361\003\210\232\f\307U\243\305D\310h8.\035\331\230\343\202\321j.\033\003\236\201\210\321\\\266\331\214\346Z\355\352g]\"\2078\035\316)l-\026\036IN\322\367\001C\207\353\233\333\0029\204\322l\326\212c\302\233~($9%n\001)\220\024:\263\340\n\331-\t.\335\335\271\252\265\334\326\316:\264?f\355\334\007\330\335[\301\005D\250!0\206\031B\2022C\022\314H\n\n\n\035\240\242\021;\363\020P\347fT\030\306tE\227E\"`\350x\224{\036\223\036\034\206\216\363\264sG\316'\375\251M\234\314S(\275\236\362\324\035R\306{F\361pj`\004\256\252\363\265\324\"pA\037U\314!&\n0\036\313J\356m\210j\364\252\327\365\310\233g;\262}\271Rq\323_\347\301\342J\302%"
+	.ascii	"`\n}G`\254\314\\WX\207\303\f\300O\236X\202\231p\263J\273\236"
+	.ascii	"s\341Hq\377\252\002"
+	.text
+	.section	.gnu.lto_displayIsTransferInProgress.41.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\202"
+	.string	"-\n"
+	.string	"\006\024I> \3458\035"
+	.string	",\004X\002\202\002\222\001I\"o\3774$\252\205DU\224\021\376b\002\361\341\207\217B}\365/\307\215S\212\004\001\"0\304\255\374\204N\224\262\022\223\036dV?5\262wJ\0015"
+	.string	"6"
+	.string	"7"
+	.string	"\004\334\267\356\031\356\233ms:&\237~~\260\376J\311\220\005\330=\277\372\372\351\364\344\277\344\332\b\254e\325B\235b\"v\327t\325\322\270\353m+\330\226\260\337\005\325e\233\232{\354\3274jZ\251\217\021\330x\201`\331e\315\006\254\313\266\"b\333d{\266\301\252C\251}\330IL\217\225>\260\353\002\240\262{2x\241\373\346\363\001\\}\340PU\224\355\211\313>(\027$\211\373F+\202]\361\023\263\333U9\370&#\213.\344\233_\342\276\275\026\200\304Rtf\257c\251"
+	.string	"\373D\321\352a_\333\335u\0067!g#\202\r\232\214\030\202@\221\t\032;\207\032\022H\0212G\317g\226\342h,=\037h\004?_X\232\237\346\300dH,?\021I\226\237w\356\315\325\204T\305\260G\265jZ\003\013"
+	.ascii	"t\263\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_displayHeartbeat.42.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\025\n"
+	.string	"\366SH= \3458\035"
+	.string	"\254\204\216\001F\026`F!\2218\365\001 w\336E\023\020\305\003P4E\210\033\212\200\177\365\017\362zJ\221 \005\023\b\261\217>\350\004\022%\003\035\232\260OH\204\354\235R3"
+	.string	"5"
+	.string	"7"
+	.string	"\t\3357\237'\340\276u\367p\337l\3323?A\366,1\rX\315\356z\365\343\346\251\351\037\345\034V+u\272y\330]SV\213\343\256\267\215`\033\302\376&)Z=\354k\273\273\256.\373\257_\253\324\224R\237\023 \201q\230\355n\314\002\254l{\021\261\375\216m@\323pj\337\344'\346_\250\017\354\272b.\273\247\202\003Z5\255\356t\254j\312\366x\030E\267\273\n\371+\030\345\211\373Fk\201]q\225S\267\273!?\305d\321\205|\363Q\334\267\327"
+	.string	"\231\227\212\316L[Fb\226\002\260\317\376@\340\002(\374\030>\236\020\034}\245r$v\006?\027\237\004\251\024E^I\206&\221\024y#\361\233\360@\262\364>\007\036I!\351\225\306\221\364:\347^\333\352rD\211LU3\314\241\001\013"
+	.ascii	"t\263\240L\350\r\0076.<\260M\245\263\232\231\340\302e\300o5\005"
+	.ascii	"\334\345E;\311"
+	.text
+	.section	.gnu.lto_displayResync.43.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"%\n"
+	.string	"fTI> \3458\035"
+	.string	",\004X\026\320\245\035 ,\202x\202\375\207/\025\231\244"
+	.string	""
+	.string	"v\020~\337\021\342\206\"\340_\375\203\274\236R$H\301\004\002\220\024\356C\272C\002\2606\3663\255\324\310\336)\0055"
+	.string	"4"
+	.string	"9"
+	.string	"\f^\350\276\371\274\001\367\255;\207\373f\323\006\360Sd\237\362\302\021\013\260\273^\r\271yj\372\207]\243Z\235N\005\"v\327T\265\362\270\353m+\330\226\260\257\t\366\265\335]W\226\375\327\257UjJ\251\317\021\264` dv;f\003V\266\265\220\330\276\375\323\26476\202\313\303\351a~\353.\363/\323\013vY*,\273g\246\325\233\217T=\331\036\037\263\350vS\037\037E\243,q\337h=\260/~R\352v\367\343\233\2200\272\221o\276\211\373\366:0\363B\321\231\351JI\314R\001\366y\242\025$\376<`\203'\374\034:\234\020\f}\2432$v\006;\031\037\205\250\024A^I\206$\221\004y!\361\253\360@\262\364:\t\036E!\351\215\306\221\3646\347^\333\312\232p\311Pu\303\032\252\325\n"
+	.ascii	"t\263\340L\350\r\003\227\374\356\003\333T:\253\232\t\216\272"
+	.ascii	"\214\001wy\321N2"
+	.text
+	.section	.gnu.lto_displayTxBytesFree.44.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\305\n"
+	.string	"\266TK?0O\224\016\263\\\304b\314\001lD^\275\356\225\336\302\246\313\324p\250\365\244\315m\315\364\327\257\257\301j\314F\301\tRa`\304\204\342L\247\345\261\246\005R\210\302\347\b!\304#\204\333J\231R8"
+	.string	"7"
+	.string	"9"
+	.string	"\266\017\342!:\366d\334P\241B\271\020\225\200\261\0331\216{T\207\371Iu\250\032\356yz\374\217x\344\203i\305\210\364yZ\fv\3279\"Y\270\365\266\007\330n`_@\266\323\326\343\017aZ#\351\324\364\257\r\025-\026\234\330\245\220\222\261,`\n\017\266;\266\304\0069!\310\264o\272\210\316#\347\035\273\245\027(vc\001\023\270\016\035/\007P\235\252\252\340BH?\266\271\243\034\230\220p\331("
+	.string	"\273;\t\b\327n(\201\177\322|W\207C\237S\035^?8\230@\231\262\004\303f\f;~R3\330\217\354\356ZK\001\316*\232\201\312\226\035\240L6\r\223i>\fwY\243l\262\007\231\217\263`\237\267E\340<\013\206\341\262\013\246y\037F\tq\227\331<L\323u\036&\211{[\032"
+	.string	"\244\023\254j\351E342\017"
+	.ascii	"t\263\240\314\2000\354\304\\\235\225\275 ;\245+\236\306\342J"
+	.ascii	"gm4a\240k\366\013&\b8a\244Z1\t\223\f"
+	.text
+	.section	.gnu.lto_displayGetFontMetadata.45.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`*\001\345\r"
+	.string	"\026\234cD"
+	.string	"\221(\035#\302\361\355;\221\350"
+	.string	"E\016\020FV\177nQ\345P?\351P!\342?\200\212\n\366\250\236,\365gcE\3738\300\314\266\364\367{\246\336i\031)\007\227\352]\262\343\307p t\311'\233H\231RP"
+	.string	"M"
+	.string	"Q"
+	.string	"F\300=:|\201\355\221\273\307\366h\333!\036\224S\017YT\276\"\003\005\305l7\354t\345\251k\232)_u-\256dV/*Z\031\256\332\007J\r\020"
+	.ascii	"Z,\355\300L\345r\3303\245\265\312\324\210\354\256\323"
+	.string	"B\013\303\035o\273\201\355\021\373'\001\332\356\256\325e;\275\371\353\327<\3747\2475\246SK\177#%b\006\303`\306\256\312\214\314\266\210.!l\337\276\t\224\315asX<\232\207\205'N\200e\305<8\340\0369\033<\231/\341\2178\t\324_\024.`\327\025c\305n\230 \035\271\251F\235\272\321\021\016'\252r\207\f&5\204\027Zj\222-\365A\f\006+cl\207\336B\222\242\202h\302\366\230j\300&\375D\004n\227\265\300\217\201%nw\377\341\321?m\217W\002/^&9\343\303\276!c\341b\223\206\035\252R;\330\017\337g\344\231J\243\020g\017\344\023\002\362y\n:\036\236\311\003y\246O\304\371\3239y\020JJ!PW\002?\t!\020\324\215B\236\250\373\200\245\256\363aR\311\007v&\022\t\3548\302\275\266\352\362\366\022\323\"K?\265\035\366\001\272Q\325\024\333\252\0261\321\225\026\020"
+	.string	"tS\320\304\3209}x\221\331k\251\306@K\017\273_\306.\220\007\330\246\224\032"
+	.ascii	"\271\214\003r\234\206\032\221\252\032\212.\005\005"
+	.text
+	.section	.gnu.lto_displayWriteFontCharacter.46.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`p\001e\017"
+	.string	"\246\235iF\360\222(\035*\215\036\212\035'i!\315\325-5\024G\022\250I\207\237\027\200\216\330\002\373\tI\367\177C\n\004C|\302>\320\233k\237H\234\264\263\374uM\354&\006\327\023*3\243It\371\337\203\337\222-eJ\001S"
+	.string	"V"
+	.string	"V"
+	.string	"\033\"\360\201\355\232\303\315\266\257\342+>\333F\fK\200\267!\"\243\003dw9\224\023\370\\\213/\371\\S\233\177\217\232\237\357z\204\360B6\003~\270\306o\340!\""
+	.ascii	"\030\213\013f!v\\\366\244\001a\231\240\225\335u\316\200\036n"
+	.ascii	"\355\266\033\330\216`\237'\241\357\374#\317\371\267"
+	.string	"\207?H\323Q\323\372I\247\226\276\210\004D\016\006\263\335\016=C\026\207V\003\205\355\317\016\331'\257R\334\261p2\332\030\016\213\007\3335\223YI]\034\347{\016\206\034m\f\306\301\301vm\224&?JO\3737o\361=\214\271\200\335\232\03346!E\321\240.o\252\232:2ED5@\235\245\330\031\241f\371\244J\300\361\021\313 \266S\347a\331vc*\276\214\f-0Z\300^=\006\214\212\017\203\345\262\355\356M\\\363c>\327\256\003z\334\274\262\307\227\035\300\214\036\035\233B\354\320\225J\302~\\\255\2615\035\336\004\223z\247S\027\335\245\230\022\244\240:\005\244\022\224I\325\275\264T\251\315&\322\205\216\002\253\225:q-\017U!\345\2358U\252k\341L^\213#\031\360\212\205\362\270\227\325\312\343B\341>\256\326\330\005<\221\244_v\022\riT\032\333Q\275\362RX\024\345\210\252\202\324\251\001\032"
+	.ascii	"tS\360\305\320\301>\370\313\354\025k\017(,\007\n\3650\361\315"
+	.ascii	"\330\241t\305\326X\254\324\224\265\204\342\232\250#\033\033n"
+	.ascii	"\2417\241p\241\206\003\341;5\n\216\345\251F\200\210H\352B\251"
+	.ascii	"j\240\271\024\024"
+	.text
+	.section	.gnu.lto_displayIsReady.47.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\373"
+	.string	"\325\f"
+	.string	"\306\331[C\020\221\223\016s\256\211h_\025\210"
+	.string	"\345\266\007\031\246d\006\320\364vj\303\013-\206\003x\007\214\035[_\037\236\217\220\005\355\267\3344$"
+	.string	"\021\254`\020q5\370#\003\252x\272\037\007\025\004\321{o)S\nI"
+	.string	"C"
+	.string	"J"
+	.string	"\320\335\017\304\303\352\037\361\320\266EFB\026\275\003\001\363\020/-1\251\335\316\322\017\027\375i\212\374\321\037\334^\220d\264\3402\\\037HK\216\021\003\270\355)H\215P?=]8R&\200\222\335uZ\340.\334\3606\261\377 \356F\251\036\354\277\335]k\311v\272\272\351\217N\353K\247\246\037\340\030fR4Lj\354\302\324\340\330\031\210\"a\373\366\273\220\355a#\220\031\311\374\3117\361\023\241\233VN`\267\344Bf\267c\340\005\325\003Q\235Z\251\203\016\233\216,"
+	.string	"U\"5t/\234\032\213\251\020T\314\330\322\206m\224\307`\325\356F\342\257\250 \001\024\017S\023\330\332S\200H|\024\331\204jw/\342\320_\211\207W\0034&\226\254\361O\357@q\210\261y\303\001\276B8\"!\235\253\301\346\243\303\371\\*\332\307S\231\263\001]\021R4\317\211\245e\035\n\236\354\304\372x.\024\213\223i\326\006\304XJ'\263T0,\263<\272\375[-9\322l`\001#\177Q\374\351\005\264RU\027\333\252.aQ\322\353\310\017"
+	.ascii	"tS\220\304\320)}x\220\331+\251\026@\241\036&^\031;\300\336JM"
+	.ascii	"YK(\024\227\201\250*g\244\256~pp"
+	.text
+	.section	.gnu.lto_displayBeginTransaction.48.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\r\001-\r"
+	.string	"\026\031[D\020s\223\016\360\027\24086\\\356n\324\036\f\213\037B\307\320\251F\344\333k\b&\303\344\341\260\377\026M\336\201Y\3504\325n\275AH"
+	.string	"\021\315\213\b\024"
+	.string	"(\217=\201\245\006\300&\353\342\231 \262\267\224)\005E"
+	.string	"H"
+	.string	"G"
+	.string	"G`=^\327X\217\366\354\035\377N\373\230\023\007\030\036\273\213)\211{\207\232\236\377\324\001\260\224F\207 \256P\323\342b5\240D\202$+\227\020O=;\224V2A\034\354\256\223\245\364\341\216\267\375\300\266\004\373\236j\262\377\362[G\375\021\246S\323\277\f\320\270\021\341\305\256\207\231\037+\023U'l?\304\026Aa\222\337Wx\177\311"
+	.string	"\t,ID\t\b\327\343\b\0249\231<\355\247\270\n\357\250\224\027\3305\331\200\261\373-0\311\365\350/\252\031\271ri\211\241\336\254T\n)\035\244\354a\333\363\230\355\332%\235\370-4X\020Y\217\251\t\354\356,D\327\356\236\3700\241\013\227\211G?\305z\274\036\310\201R\311\031\247J\006\216M\037\3667J\035a\037\356\356:]\b\264Ag%\032\203\022N\326`\243\341h\237,\324}:\227\265\215(\253"
+	.string	"\352:(X\307q0t8\024\354\323\311<\230\306u\330F\2017\020\207\303B\333\306a!\337\036\256\232<\241\206\214\212\256\300"
+	.string	"iiT\247zd\203\216, \025"
+	.string	"t\263\340L\350\310\307"
+	.ascii	"\"T\307\354\225T\013\240\360\016\023\217\214\035`\357JgU6\301"
+	.ascii	"\231k@3\214\001\302wj\024\034\343SM\213\223<\325\225S\n\265\007"
+	.text
+	.section	.gnu.lto_displayCommitTransaction.49.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\326"
+	.string	"\025\f"
+	.string	"&\327TC\020q\233\016\360\314\310\024\334\214/\003\310\237\035\307\260R2\240\036:_\341\036\210\227\341\312\026Q\240\327#\002\315\0305\"\262\021\246\210\004\200\202\324\2442H(E\277"
+	.string	"JNw\313\201\377?}\332D\312\224\002@"
+	.string	">"
+	.string	"D"
+	.string	"\324\243=\273\306\303\021{\026+\033\\`v\327R\021\367>iz\376[\256A\001C\237@\\'NJ\213\022"
+	.string	"\360\233:%\226\020oyr"
+	.string	"O23\016v\327\211\002~\270\343m?\260\r\301~\203\251*\366\247\335]\253\310\376\350\217\232\316L?#"
+	.string	"&F\204\025\273\035bv\354K$\255\330\376\306.\340\201\301\323~\211\233\360>*y\200]\021\f\027\273a\002w\252G\207'@=V\347\004\244\033YbIy\241\252b{\204J\235\220\202\306\2279low\031\251v?\020_\205\206\216\204zL5`[8\n\222jwA\374\023 \f\025\211G\277\204z\274\016\23012\311\030'\311\206\214M\035v\030\n\276>0\005\037\331\265\300\303\311\260\317\005\352>Ze\314\223\341\242 \322i!V\307e\0274.\304\372hW\005\013\343:\313s\300\233H\306Y\240m\343\254M\270\237VE\226\200\343\305DO&MFu\252\021|\032\262G\020"
+	.ascii	"t\263\340L\350\307\213\3415\324\306\354u\264\255;\324\3571v\200"
+	.ascii	"\275+\235U\315\004\027.\003~\253)\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_displayGetCanvas.50.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`S"
+	.string	"e\t"
+	.string	"V\021C> \3458\035"
+	.string	"\274\370\233[\326\004"
+	.string	"\214\210BL\257\360\002G\263\206\\P\006\030^@i\fDY\250\005b\030\005S \344+D\304\305\250k\025\224_\250`\004Qm4\201u\321\352\3362\0050"
+	.string	"1"
+	.string	"3"
+	.string	"\377?\f\344K\276 '\016a]\240\264\272o\245\037\\\362,\317l\302\007+\231\016\230\024\224\211\247@Cw\177b\2404\370\224\377#\374\207\370\317\022\377\311\177\363wZ zK\005\003mq\222\341\2401\326\211\001\315\3713\t\227\220\314\232`\202\356\224\312J\367Ux\202\306\330/s2\3064\3362\306\036us\233\313\214\216\270T\024\264\342\333jS\275p6f\\5=\001\374\3274\251\307\317\001\335\335\247\251\1772\207\252E\363\360\352>\275\002\264\013\326\"\362\237\003^\007\332\321\b~\332\255\247\373x<\273\300m\243%\201\266\313\336q%\033!\032\277P\035E\217\364\211\241\n~V\242v\342X9\203\207\"O\254\2430\024\003\013"
+	.ascii	"R\263\240\314\2000\034D\330)DR\271\301b\323\270\f\b\nCB\315y"
+	.ascii	"]\223\f"
+	.text
+	.section	.gnu.lto_displayInit.51.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`}\003\r\026"
+	.string	"\206\245\207I\260TRc\224\330\276A8\316\236\3220FE\024\r\301\230C\252\274_2\\\330}\231\330\313@|\b\350\304JBR0@T\177@Ys\tS\320\302u\236\272Q\375\201\257\240|\372cL\347\201a\250/bk)\267\224)\005n"
+	.string	"m"
+	.string	"v"
+	.string	"U\306\344\362i\237\305[\360\036\f\372\200{\217\232\236\356\025\0360\013\371j\341c\366\225<\314\276\232g\373\270\360\304}\323\024\321\213\255{/\215\2328\357\266\216t\362|\022\030"
+	.ascii	"?\240\320\355\207\327\023`\206q\345\336\213a\216\036NGX\221S"
+	.ascii	"\361\004\350\033Y\212J!\356\342S\003\2607'\t\314\275\327\363"
+	.ascii	"\007\354p\223\334v\216m\032\233\256\b\024vH \373z*\273\n\316"
+	.ascii	"!\024\361E\355\334\231\200\310{\357\213\277T\301\302\211\025"
+	.ascii	"\212W?\310\276\242$\215\030\232]\216\211\300\032\222u'\227-\354"
+	.ascii	"M\212d\177\274\364\310\276\360\177=\370\227\324i[\247\253\235"
+	.ascii	"\036\3534\035\247'\235~\312K`m\375\230\021r/\207\256\"\267\252"
+	.ascii	"F\245\260\375\227-{r\231B\240\024\001\327\267\264A\206|\r\246"
+	.ascii	"\236c\30645"
+	.string	"\363\277\032\373:R\225\244 \020\342H\251T\215\200\235\361\313\222MJ\351m\230\f\251\210\263\250T\004Emc'\275Y\352\341\233DlC\370\r\233I\003\\\005\247j\326\216\360\032\265\231\024O\302\243p\020KkO8\215RE\305mwB\261\322\"a\364\235\265oo\332\031\260\322\202E\231\314\022\352S\277\214|T\3106\3561r\310{}/>\2147\235\233\362\301\217u\331bC\320r+\023\314`7\033O\351\263\343\301\221\266\315.\224:=;\034\016m\247\273\375\340t84\036\\\271C\263\351v\264Y\001\347zn:\232O.\247\243\275\204C\037/=r\320U5D{^\261\202\005\363?\257\314\241\221\030k3x1\206\313\332\035\261\377\262~\3445[\251\245\226\007\021\210\336\354\262\216Z\245\261+\223a\220{\257P\245H2>\312\234*H\250A8H\225B\203\224]P\232\342\240\002\021)2\037\021"
+	.ascii	"5\253X\225\202\024E\303\001t\235\232n\255\345-\3177(\033{\372"
+	.ascii	"\366\375\002\222\031\00179\222\200\265\256\244\037LlE\302\314"
+	.ascii	"\023\025\274\1770\333\006)\200\026\tz\tW+6!\337\3266#\007\307"
+	.ascii	"\243\030\346\262\270\237\211=\254E+\001\237V\300\213\347\244"
+	.ascii	"\267{rf\323\\\337\212\342zGE\252\304\355 \3447B\316Z)\312'\356"
+	.ascii	"\201[\252B\246\004Q\2378\240\307\266\031\242W\315\340\245APT"
+	.ascii	"\342\250\204\"6\223\243p\312.\324"
+	.text
+	.section	.gnu.lto_displayEmulateTextAttributes.part.0.55.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\033\002\325\021"
+	.string	"\366`uI\320\322(\035 \3227kK\377\354\200\037r{\330\274j\033\007\177\310@\271!\007\373C3g\272g\030\336#n\217\313\312Zymw\302i\264\270Z\312\025\336\214\203\n\244\236\355\304sigk\355aB\377\221hB\210\224)\005^"
+	.string	"f"
+	.string	"Z"
+	.string	"\372\322\177q\036\230\367\304v\206\342\271\021\315Y&xg\004\337;\227'\340\275\373N\342\275\263\357\302\246\224\227\033\3336\245\300X\366r\307fA\321\006\232\2209K\360\335\236\270\354\253\234\314\327\032\234\230\357\207~\342\003F\016\0361p<\\G\316\211\234\346\234\376>\334\335m3\260-\301\326\f\001\263DW#\305m\277\320\325\276}\333\213/\364!\223\202j-E9\020\rv\232\231=hQ\204\362\316\267\301\330\244VP(\242\017\252\265v\206\nb\024\301e\230\3164\224s\316\260d'\354\364@4\330\316PDED\206\360\275\343l\037\027\236\220\323\377\370\270|\300\23497\032\016^\336\0233P\316\0167%+\302\r]\201\036@d\364\310\272\337\335\357\240a1\243G\366B\340\230z3"
+	.string	"\3255\271ox_\233\205\245\257\261\t\315\306\370C\377t\250(\207\374\230\272:3~\241Z\3532~\333Uo>\355\260\313\350\315\313\255\216}nn\216m5\267\352\375\317\257/\377\177'\"\004\214\230\323\346\310(\344\353%r\252\324J|\271V\343g\341Ua\245Z\361,\206)S\250\022\025\224H(\300&\254S\245\230\270\322\342\032U@\027\251\2720\222*\340j\024Y\300\024\351\002K\007\314jQ\221\340\213\305\"A\322\271\2719#\372\313<n9\330\346\326'\231\235\331\0066 jsM8"
+	.ascii	"\020\t\177\364|\033\030F\037\205\037\363\036+ \220\242\261+;"
+	.ascii	"\027\253\370w8H\211\266'\330\222\230?\207\"\332\241\002N\026"
+	.ascii	"K1\213\020J\347\227\031\251\t\364\233\270\226\306v\020m\236\354"
+	.ascii	"\350Z\272\370\340\344\330,Zn\245\224Mb\256M\004\304B\330\316"
+	.ascii	"\030h\301\332Enl\310\311\322\224m\013xu\254\rP\034\2664\220\324"
+	.ascii	"\201\313\356\277\366\215\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`\230\003e\017"
+	.string	"\004\027\224\004"
+	.string	""
+	.string	""
+	.string	"\002\033\177=\377\377\377\377\003\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\0067\177>\200\200\200\200\004 \032\177?\006\034\177@\272\220\202\002\035\177A\036\177B\037\177C \177D!\177E\"\177F#\177G$\177H%\177I&\177J'\177K(\177L)\177M*\177N+\177O,\177P-\177Q.\177R/\177S0\177T1\177U2\177V3\177W\005\023X\301\204\001"
+	.string	""
+	.string	""
+	.string	"\005\030Y\305\204\001"
+	.string	"pg_resetdata"
+	.string	""
+	.string	"\005\026Zgistry"
+	.string	""
+	.string	"\005\024[\0016\177\\\037"
+	.string	""
+	.string	"\200\220\200\0015\177]4\177^\004"
+	.string	"\220\215\300\227\002\001\265\006\004"
+	.string	"\372\201\233\313\001\001\365\013\003\001\037\304\001\003\002 \344\001\003\002\001\240\276\320\347"
+	.string	"\001\242\007\004\003\225\001\004\004\201\200\200\200\003\001\225\007\004\004\265\n\004\005\006\006\004\007\001\006\004\b\001\003\013!D\004\013\265\007\003\f!\003\001D\003\f\002\351\221\2719\001\202\022\004\f\325\027\003\r"
+	.string	"\320\360\372\250\001\001\242\001\004\r\301\266\326\372\003\001\225\013\003\016\003\016\002\252\325\3548\001\202\017\004\016\325\033\004\017\351\304\260\243\003\001\325\013\004\020\021\001\004\022\023\001\004\024\221\325\001\004\025\241\306\271\367\003\001\365\001\004\026\027\321\231\263\346\030\003\032"
+	.string	"\202\022\004\032\265\001\004\032\225\013"
+	.string	"C\250Q \201\017U\222$\005.\245\003 \003\231\242\264\001\021\200\220\245\024\0244\241H =\034\002.\357u\252\225\035"
+	.ascii	"sL\247b\370\357\230K\211\243\302 \205\341\017\b\374G\3142\255"
+	.ascii	"\234\245-\263\216\fP\0371\221\225\256\314\362_W\347\261\025("
+	.ascii	"\231\241\2456G\233\n\311\212\234At6\273\273\273\277\373\007\303"
+	.ascii	"\311\343\233)\223\223\211\b\330\035\340\374D\252\265qY\226\247"
+	.ascii	"\005\255\006"
+	.text
+	.section	.gnu.lto_.refs.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375 \023\231"
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001\032"
+	.string	"\033\027"
+	.string	"\003\035\002\033\002\036\002\034"
+	.text
+	.section	.gnu.lto_.decls.4532185fc8eb772,"e",@progbits
+	.string	"(\265/\375`27u\347"
+	.string	"j_\221MV \016!\235t\177\315\356\376\367\272\376\314\354R}\031`n\365E\211\377\377U_l \340\221"
+	.ascii	"\302$RO\242j2\250\315\001(\261z\273x_\b\305\247\204\267\257f"
+	.ascii	"\322\222J\001\340I\211[N\016\265\203\013\214\316\3135rf\355\335"
+	.ascii	"\375\3209\002x\333,\331D\312\024\t\004\336\004\362\004C\265\005"
+	.ascii	"\222\213\032\200\226\004g\bv\223\r3\246\t\246a\274\233\250\360"
+	.ascii	"\0251\352\252\205\251\225A\264#[~\275\364VB\200\331\224\026g"
+	.ascii	"\337l(\366\357#\027A%.\\\244\232\305\333E\213\240\022)VH]CtR"
+	.ascii	"\246\250y\313d\260\350E\241%\261d\366l\234!\330D5pM\253\274\256"
+	.ascii	"M\324C\250\226\226$\031]9\260/\217uh\344\211$r\303,\334\321\r"
+	.ascii	" Z\366\334!\310\201\334!\3304l\037\006I^\f\351\312}v\251f\005"
+	.ascii	"\246+\177\34114+\364\271\251\215\331\353;!P\360\272\2129\"r\322"
+	.ascii	"E6\f\203\271\375\024\206\211\325\235=\030\326\243\202\244\365"
+	.ascii	"\244\347EH\005\b\217\276\256e\315\256+)1S\354\345\360\356d\334"
+	.ascii	"\354\224H]\371\256MLJ\325\223\256\314\205\315\252X\025\227TW"
+	.ascii	"\276\302u56\226\200\360ue,\234\205\307@0\335Y\013o9:\324\264"
+	.ascii	"i\254?#d]/\360M\260\333\354\031D\360\f\fd\020\301\203a+3b\276"
+	.ascii	"\214\270\254\314\315d\371\222\244H\327*\315a\214 WNf\226\n\313"
+	.ascii	"\005e\230!1\362\262g\033\026"
+	.string	"\216\006J\024e]W\206\3437\3062\013\243\325\225\337\232\335X\312\371\215\243\320\0245\371\255\336;\304\374\241\206\371\003\332\306c\210,X\317R\226\235\354\363\332\232\\i\373\353\352\312M\206~I\206\260\272\362\0226[\032\322\005K\311\223 7\336\2722\333\001\304\312bt\275\013,#\3414\036\343$?\253\361\332+\021\346-\273\2679<\207\234\340\222t\365\3007\301\312!\2026\034\"x\024\330\237\215\240Y\320\001&\307\337\331\031\355\357\340\203\337\321\334\033v\357\345\320K\346\204\204u=\230\313\360\f\263\0329\272\376l\306a\\\344L\"1/\332\275M\f68\254\252\310\350ZV\303\004\213\213\246\256'\201\035c2&rq\204,\232\354\266\272>\003\226\346\304\337\374\006\252\373\3011\260o\313\2273\004Y\331\344\233\240\345\f\301\237\213lx9\257p\377\034\002\036r;?HA\375+\021\004\"J\360\237\004MB"
+	.string	"7\363\327\016\374/\341w\034\350\303\300\3172?\227\200-\024`\370W\022<H`\004\267\360\327\007\374\234\341\347\0230\0065\204\237=\374\274\201\017\033\352\007vX$X\307?\374\265\304\317!~\3169\200\001~\363W\005\330u\325\317HM\205\343\257\002\370\231\001?w\240\233L\\\004\307\340\257\001\370\271\305\317,.\374\353\320\376\2259"
+	.string	"\370\307\001\2771?\023\211\240\237N0?7\340g\023\234\360\263\003N\363\237]N\370\331\317\0368\372\371\242=\303\177\332\375\\\364\363\317\317+\376\333\374l\002_x\315\177j\371\331\350g'\242\327QH\276\017N\3107\374\247\332\317]z\306\377\346\337\311\277[,\017B\003\206\377\344\372{\204\237\177\205\361\267\317\337\305\277U\3607\320\337)\376\016\372\373(\343o\021\374\235\202\277Q\340\364\337\346\257u\177\307\370\333\305\337+\376V\341o\241\277I\370\233\001\177\177\3607\211\277E\374\235\200\2779\370;\304\337\006\370\273"
+	.string	"\177{\370{\203\2779\374\275\341o\234\2773\370\333\346\357\341\337\301\277\3773\340\317~?\363\375\274\367s\230\237\277\374|\367\263\227\237\261\374\\\345g*?\307\375<\345g\270\237\245\374\374\366s\224\237\241\374\374\344g'?\267\375\254\374\271\311\317L~\336\3719\351\347%\377\331\376\317\375,\366s\007?k\360\177\313\177\003\374w\3739\354\277\206\377\374s\220\237\275~\346\360\363\217\237}\374\234\365\363\n?\367\370\231\307\317;~\306\3729\307\317V?O\375\314\374\271\306\317R?G\375\f\365\363\323\317\032~\246\361\363\214\237a\374\374\342g\246\237\323\237\227~V\3729\205\3779\377\337\376o\020\030\030\030\370\313D\340\027\352\370A\230\bYkig\323o\355T;\331\316$\247\222\023\t\217\235i\215\366\023\3554R\342L\353\276\363\f"
+	.string	"I._\030\312\305mN\257\246>\350g\031\347\314L\206\323\215\256\256E\23231\204H\251\302b\317\262\263f\314\225\226\034\233}\360\210}\220\314>\2505\344\024\203\022\367\242\254\253\030\034\232(Gv\370\350Z\211\334`@u=\301N <\366\2673\310k\226\2600\362\326\365A,\373\027\360\337\202W\232G\312V\020y\235?\362\220\0345\351\332\305c\347\217\223\213\233?\316-~\253A6\357R\320\252\211\303\001\215\025(t}\265>\370d\037D\322*b\247\241+:\037\334\206ny\262\303J\026\343\325<\211B\204k\205>\262\360\267\244\207\244G\f\033\267!`=xP\t\263\344\361H\332qb\2351!\313\352\372\023\25395\306\243\255k\007%~\352\b~5\231\032s\245\2436\021\341q\226\343\264\242\201\344\244\255\353O\253\377\274q\342h\037'\270WC\320.\213\333RW\336\343\233\240"
+	.string	"8C\360\254*\361\323F\206\240r\331\274h3\177i^\206\272npR5X\r\214\246\035\223\251\026R\243^\2548b\032\t\322X\2169\252\321\301\246\351\224dC\ngX\347\0077%\212\337\2028\251B\203bB\307\364"
+	.string	"\277\306\316\247\366Q\201\037Ou4\316%W\240\025\262\256\313\323\311\001@f\344\3118g\360\330\271d0\335\274\267\304\362\214\301u5C\315\253\024\2221\361\2248\034\f\327"
+	.ascii	"\275V\004\353Q(\366\350\232\375\317&\020EL\220\204\301\360\033"
+	.ascii	"\333\001\206\367\202\311\206\n\027&\252\346\320\024\340\227\222"
+	.ascii	"\2474\033\331\226 \347\322\251\004h\326EH\327\262!\020)5.aZz"
+	.ascii	"\310\213\211\256\017\366f\344\361\335\316hn\tL\230\216:\253z"
+	.ascii	"\312;\207\272\257\001M\030)e^\020)\361\0261\3149\247=\272s\350"
+	.ascii	"\274\\w6\331,\0132,/z\374v6\263\204fU5\362:\257K\343\325 /\\"
+	.ascii	"\242\271\034Y\275\245\256\361Ht\361\332\027~+\300\226\034\213"
+	.ascii	"3\351,:W\234F'\321\351\342L\236H'\362<:[\360\3309\304D\336X\035"
+	.ascii	"(v\016\365\230\216b\271\345Ev\361`\353\3169\235G>d\274\330P\217"
+	.ascii	"\232\331\276|\003\370\347\306CJ\206\025kD\313\\\224_\223\r\001"
+	.ascii	"\271\252@u=:\304\036\375\262G\267\354\321\036\366\350\225=j\303"
+	.ascii	"\3428\331\243J6\004ZdI\360M\260\271\264\035\217\341\364\235\r"
+	.ascii	"W!R\202\372\263/\270\201\214\023|\325\263&\370&\370\332v\223"
+	.ascii	"\005K\240\332\337\225\306r\205\212\332\224\216\256V\232E2[D^"
+	.ascii	"\234\306\3549\214\237\360\224\020\362\270\013\373\205\320Lz\321"
+	.ascii	"1\362\346\234\276\234\252Z\207\020\254\006\322B\022\340\225\265"
+	.ascii	"\302\250\217\250<\2001\305\370\b\267%)\205pK\020i\246\004t\345"
+	.ascii	"\3159q\036\377uQ\225\007\260\2549\247=\036\302F\032\3607[Gi\270"
+	.ascii	"\236k&]\245\335zJ?i)M\245\225\264\\;\351\270n\353&\275\244\337"
+	.ascii	"x\254\2414\331\273\254\213\034\247yo\321\275\367\013@b#\034\210"
+	.ascii	"\222wh\212\004\230r\316i\017kG\203\205e\211"
+	.string	"\ri&\226[^\270Ed@\262Z\254\331LJ'\034\307x!\260\225\030k\246\313a2\232\212\345\226\315\373\202\001rsN_\3676\277"
+	.ascii	"(m\326I\202\220\230\267\205\321\\\224\023\tJ\225\270\275{\233"
+	.ascii	"\034\340p\020\204\333\021\205K\210$\275\346\307\302\213\262\325"
+	.ascii	"\336klU\324\324\272\366Y\247\t\215b\\\245\264F\"F$\251\254\353"
+	.ascii	"\021F\"\005VY\3306\322h6I'`\212\304X;+\303\3133\212\375\331\304"
+	.ascii	"\376L\263?\233\366g\227\275 $\254\276\355\t\021\023\344\035V"
+	.ascii	"\223\004\346\326\342\324\001\366\305X\240x\351\362z\177\031i"
+	.ascii	"1\005\351\332?\330\f\265\262b\244\324\265\273l\325\226\030\272"
+	.ascii	"\256\315\325Q\301\037\200aX]\233Goq\r9\036_[\255\025\244\t\307"
+	.ascii	"\216\246\215\214\222\276\256\030]{\205\316z\373\350\036\267}"
+	.ascii	"x\300\274w\250}\330\370\335;d\303\374\201\371C\005R\265\302\221"
+	.ascii	"`\375y\303\316\260\0368\203\216\253\341\221\330\n\265\034\357"
+	.ascii	"+\0135\226\304\232tm+6\263Cqaw]\033\007\377\311\270\273\352\332"
+	.ascii	"7:\252\016!\023\242\354\3326\270\016uj\263+\032\342\260\267&"
+	.ascii	"\267d\247x\214\016\212\211\371\236\222\241\261\244\307\242k\327"
+	.ascii	"`\263\270#8\244\256-\325Q\302\300,KF]\373\251\243\350\226y\\"
+	.ascii	"PC@0\300\223\205\355\031M\303\002\021\240\237\023\r\256\223\261"
+	.ascii	"\242\017I/\255\302\300\004.\003pH\303\245\355\020Lj["
+	.string	"=\003SC\256h\222\001\035qH\272\326%\257d9f8\321SR\307\224t\267\t\033\017\323\222V\327\232\304\032\r\217@\240_<\2208\351\372\232\344\257@\352\332\020J\313\306\215\256\227K+\361\252\206\316x\233\302\352:\363\305\336\340\235`0\256`\257h`\325H\210\340\r\233\002\227w\225P\b\b^\375\341\371h\236`E\260\252\272\326\262jV\317\230(!\001\341b_\213X\310Q\205GW\327\346\267\005+\221W\262\262\263\251-Y\354k\263\216\341\370\222\002\030g_\207\370\275\240\033\353Z\305\254\021\215\022\020)\220\362Q\305\376\032V\205\264 \360\217\216o\202C\316\020\254@J\274\006\231\342$oHW\032\232-{\243\344\304\253\327X\365:\253\340\\d\027\020XY\312%\002\320\0265\316\224\244l\006`Z\327\252]\366j\360\324[\302\270\340z\355\242\t\343Cn\261\231\260\251\234\001(\225u\325\365\302f"
+	.ascii	"\227\225\325k72\344\240BT\256%In]O\203\264\032V\364\350\301h"
+	.ascii	"ZV\310\n\272\360\0032\205\316j\210\332\261\203\233h\020\343\006"
+	.ascii	"\362\355\361\323\227\332\031\233\3250\246\243b\351`8fB\273\222"
+	.ascii	"R\240\306\254\006\270\0349\370\356\005B c[iV\026G\tG\265\302"
+	.ascii	"\301}\026\3717\214\262#pFiq\270\250\250\252\215\316\022\232\235"
+	.ascii	"\3211\017\253\250\245\252W\033\\w\001\007\214\271\256\177\026"
+	.ascii	"'\t\263N1\031\315"
+	.string	"\"\263\274e\241a\340\336p\340Y\234+U\252J\235\255\345\331lA\313\021d\212\305\351\253P\025\252\233T\034\211I\213B\304j\340TiT\032=ed\013\344\373\262p\343\260\244\351\260\032pY.\373\212\017\275\302\325E\217\311n0\302\304T\235\340\3165+dG5\306\253\223\375b\2423\352Z\233d~\f\311\222\324\265\302\350\250\013\225\245k}\321Q\347\022[\037\027\327m-qt\275\205k7\004\326\245\272\324_W\276\262h\\\254\341\370Rg\003\240\227L\326\244\033WvK\0170eH\257Im6KI\257\256\365\210\315\324p(Q\352Z]tT\315\231\333\327T\327\332b&H\223\021\257-\257\276#,S,\207\253:T\207\252Q\221\247<\013`.\276\264\250+^\215\356\266\330-uu\255ElfS#\315\310H\327J\324Q\026\352\360\336\226DU\205\341\222D\211\345\240\244\336z\273i\004\f\224"
+	.string	"bA\252\321\264\034\270"
+	.ascii	"\002\006fU\257*)\036=l\207!?\277\273\254\253$*Rj\330\016K>>F"
+	.ascii	"#\213\253q\361\004J\f\206\355\320co\257\303\036P\345\226'l\021"
+	.ascii	"\267D\322\3652H\333\301H\2300!(\003\371\276\2067\314\251\013"
+	.ascii	"\236\355\020\367\345_\030\315^\034\257e\210\232,Q_\220]o\245"
+	.ascii	"\330\323\321\235^\202\367r\223\271\244<\275\344@\022i\322\365"
+	.ascii	"\314;\237\272H\023+\313\031vN\251\232#\352\272\001\r-'\236\226"
+	.ascii	"\363\316\"\357\025.1\317;\2573*}]O.l6\201@\300\027]\317\272\363"
+	.ascii	"i\006\260\310\n\251\353\271\345\f\003\242\343\211\223\035bo\237"
+	.ascii	"l\0070'N+\347\225\237X\216\205\321\230-\220o\357.\225!.\244\263"
+	.ascii	"\017\336\027h\363\262\021\321\234\321!\237<\200{/\200\234\346"
+	.ascii	"E\376\205}\t\272Q\311\370r\017\367\367\"\231J\f\311f\031\225"
+	.ascii	"2YD%\203\223eTL\3112*d'\245\f1)/\025\322^&\223M\016\335[\306"
+	.ascii	"\274L3M\252{\233TH\333\034R\336d\223\212\211!YD\305\304\311\262"
+	.ascii	"\253\274EW\t\200\344\275L\267\214\252\013'/\2252Y\306d\302p\213"
+	.ascii	"\206,%\001\331\230xo\357\254\213\217d\321U\332\360U\304T\312"
+	.ascii	"%\233Lf\273\027\211ft\225T\367B1?\260\025\365@\262\021\311)\t"
+	.ascii	"\227EM$\317H\"\252b\3124\211\256\\\222\213\211\302\350^\272\233"
+	.ascii	"\344\001\222\221,.\021\222\3575j*\357%b\236`\311d+,\224wx\213"
+	.ascii	"\206\220\210\252\2304FDL\026\227k\212\231\222eU\314\022J\314"
+	.ascii	"\312\262.Q\023\311Y\227\216Ji\313\220\315\233\274\367\262\336"
+	.ascii	"P\314\332\225\275\256\315\232\340\217\035,\224P\301\021j-\271"
+	.ascii	"\023n\331%f\030\036]\233tI\244\256A\255\272:\263#\027\026\224"
+	.ascii	"\274|\210\305h\242\t\354qD\b\325\224P\031h\026\247\343*\030\247"
+	.ascii	"\005\003\020\354kh\245\326D\324u\313\334\223\226\2565[1p0\351"
+	.ascii	"Z\223b\250\020u\225qr\306\025\327\025\256i\323\266|\253\302d"
+	.ascii	"\t\2252<\266\256GP\032N\313\253\256i\034\210\222#\374\0303\306"
+	.ascii	"u5\350\275\314\276\254\264\223\b\327\261\\\216\b"
+	.string	"\204\361\035\351\250\232\363^\251\277?@=i\261GH\005i\t\037\322\242PP\375I}\212G\343\206c\216\021\003i\212\236\2435\366\370\370\364\244\b\036\205\b\343\210tG\310G\347\247gD\321(4\"\003\037\037\241\237\037\240\037\241\n@E\024G\240\037a\n\304\324\247\036Sc\2124EPE\020\220\b\307\243\020\021$\004T\344\311)\246\3074\005\261H\f\032\241\243\363#d\201cj\234\371I\241Qc\016\3151\347\207'\b\375\341\t:\353\316\016Q\250\"\bH\247\026\217A\347iT\024\217\306\036\236\264\204\235\364\207\247\307\207(\334I\215B55\n_\314\341\t\032\346\004\245HO8\246\306\264\004\236\240\016)\322\243Q\205\t\307\236\037\022f. \002\316\004T|@\203\fN(a\004\022\002\240\001\347\003(\216=\037\370@\b@pLivR\024\214$\\\360\361\221@\t5(\020\213\027\2301\201\002\030"
+	.string	"\300\201\204\210c\221\030$\"=\022}\204RT\200"
+	.string	"\327\301@z$\356\004u"
+	.string	"\203\353\364\024\323\237\224\307\336\003\020\024"
+	.ascii	"\202\t\026\bo\342\004\211\023$\2027q\242D\211\023 \224\260\007"
+	.ascii	"\241\304y<\n\021:\005\030\001\303Q\005\364\210\202\247'E\021"
+	.ascii	"Dq\334\351\371\300\361'M\221\372T`\247\247\310s\341\230\223\266"
+	.ascii	"\240\307\0304\346\360\364\244\360\003\224\202\237\036\037\024"
+	.ascii	"rT0\346\244:E\240\024j\216BD\212\234\343\017P\n9\b\370\001\352"
+	.ascii	"\021\312\260\200\230B\270\202`\252\323\263\202t'hT\001\250X\215"
+	.ascii	">"
+	.string	"@:\025\004!0\002\005U\037\037!\013\244F\241\341N*T\001\250\204\"\220\261(\244\023<\376\b\001\211 c\302N\212B\207\250\323\341\210\242\303\201\202\322\342\210#\020Pq\304\3141\307\306H\\\301\017Q\204c\312#c\314I}P \236\340\001\024\210E\236\232\032\211\251OZ\024\026\211\251\217\316\214\t*\020\213;\026\322\026\364\230\360\223\246E\035\243\205\"\021\205N\345\371\351)\036M\230\2219\346\230\020\022\323\2425\032\323\"\017Pq\003?$\024\323\024\214=\030\034\211)\n\307\"1E!\243\363\243\302\230\026\203\307\234\016\026\220\246E\013\030\323\243\212\t\260\3408s\3149^0\246G!\024z\212\307\243\004\216,HO\330I\217E\240\240 !\243\206\2431\347\206x$\356\020\217)\006\216)\217\3151\007\204\022\307\237\036!{4\346\354\030\201j\212\351Q\207X$\242\020\341\370\003d\201\364\330ST\001"
+	.string	">@@\023\310AU\354\020\323\022\214=\3024'H\003\033~zxR\024.\034\2159\307\"\320\006\206'\222\320\351\200DJ\364@D\206\207\020\202\b\036:\220\201\013X\035\021*\210>A\306\236\235\021\306b\272\202\236\342\316\210\237\036b\212\021:E\343\b\021\034~\200z\216:D\343\017\261x\302\261'E\n \035\f7\320\025rC\002\257P\033\347\335\2151I\002\273n\320\206\326@\253\320\032(\325\bIJt\352(\225\016;\244\276\256(\223\315\376\327\343H]W\233\026\366G\245\320\030lKC\314\272\242P\215>\241QG\241~\"\233M\024J"
+	.ascii	"\314\037lh \201\242\025\244qz\261\360\364E\017n\006\352\342|"
+	.ascii	"K\322\345\265<\253\330H=\361\262'\303\b"
+	.string	"\334\030\330\221\256\031P!\035U\242Hh\214\323\213]2\221]\036\3206f\250F\003\214\311t4\306\321\246\016>8\303\206JmTa\272\2420^\240K\257~bmFs]Q\245W>%\271*I]v8\331\024\331\327\374\331\f\234P\026(\013\324\005\023\271K\3013%b\232\366\356]\206\250V|B\266\034\314QTf\314\f\346\037\272s\343\254I\024\373\232%\366&\314\2111\257\177c\320\025'\026\232\213$r\227\204I\242\350\205\331\273\311e\210\231\261\2431*\350=\272\342hQ\007\037\334\356\007\226\241\256(\321\321\241%\334\222<$:\264u\243\314k\313^\001D\234\230\230\272\326\300\333\235\313\016\251K\327\n\3706\232e\226=\253\332\367\352\267D\352\006\025\026\337\021,OY8\354kj\330\233''^\305\374b\316*\\\307&\\am\251\252\353k\220\354\215\026$\257Nx\254\"\251`\316\344\362\302"
+	.ascii	"q\224\025\310\267g\367\306\224\215\351\372%M\257\013\225@{\016"
+	.ascii	"\213R\337\264\344I\251natyq\225\312\017\270<\270\352V\203\304"
+	.ascii	"p\257\215\270,\273\252W\275\324\274zW\273\360X\305\253U^\237"
+	.ascii	"T(\025\257N\231\222\207U\361\352\\\255[\263\313\273\367r`\301"
+	.ascii	"\005\225\\TM\215\"V\227wosK\345\302c\265\016\255\326U+U\313\214"
+	.ascii	"\332\330\335\027\r8\030z\261B\367\024\324R\351\322\232Vz]k\026"
+	.ascii	"\341R\306\333\212\265+<V\261\334\201\371R\322w\273?\321Q\205"
+	.ascii	"\304~X\304~\370e\253\234\275\222\0275E\313~\330\303~xe?\234\262"
+	.ascii	"\037B\275U\267\213\226\271}\231R\335"
+	.string	"\242n\317\005\204\324\2503\323\223yh\266$\221b\216\020\r\215$I:C\025@0PP(\233,\343\226\017\023@S\b\004\242\022\247\231BE#\")(H*\331\030\003\202\243\263\231(%\001\273\352\3372j+F\026f\321[[\330\344\221\204\002\257\030n\\\025zz\\\326\226\336\363d@0\003;\337%s~\026\334\321d+\357\274\273\225\347\\\206E5C\250\200\303^\006E\262\371\314z\020\331\204\234\340S\224\037.&R\f\007\001\004\030oC\305!\341E\005`\226Dl\"\351\b\341&\213F$\220\177(\b\306K|\263A\240\002'+Z\264\264$\205\367B=p\276\356\026\370\031$\020A\003\020\360t\251\204\216\200$8\303\241\335T\317?\316\302\303\001\246N\"\326\213\025\306\324H\326./'\321\222\320r\220\320=\2512\r\367\331qc\216\267\362\306\336\034\030l\306\347\0232\037+\227<\236\004\001"
+	.ascii	"\037t\027\034\341A<\006\344\345\332\353\035XR\342\024\017\274"
+	.ascii	"/\013"
+	.string	"\302\260{\264h;\360\003\321\301\234D]\255\273+0\363[\002q\033!b\321\310`\356H2\213>\020\376\252E\342\267\224\256\247\356FmC.\217\\\260\251E\337\325\226e%nR\321+!\366\216\267|O\304\3269\3541h\315\024A\327I\315\224\rd}\232W\244-\213!|\241\320\216\300\266h\345ytE\034Qi\251\2357r+\344\002\266\013\365\260\372&\372\214%\211\346\264\006VL_\024qph\340$\235C\212w\020\270#\312\266'v\204\353q\230o&~\3515\233O\tF<\235\250\033\217G\217\205\023i)\306\005\022\205\333D\371|\346\223>mk\200_\301\001\n\256\347\001M)k\376rkb\355.\262\326\330\036p\255\203\265\244\2479\b\203\220\251F\313\\O\262}\006x\345={\356:M\350\237\306\246Z\361\254\312\256\004n9Q\262\345\273\231\203=i\300\376#%\344\320\205\370\003T\373"
+	.string	"\337/\311.\371\007S\r\352\027\301\310_y\232\374r\301\262'`LJ\341\013\344$0\321\212~\022\027\r\365\340\257U7;~\272\030\f\313\372\027?\024\276\232*?"
+	.string	"\017x'\311\226*\242/@\031\330'\253\375\244\n\236&\2219\302]p~.\025\240\001\366\324 \3167.a\361\24732\256\247)"
+	.string	"\202\310\tus\343k\344(\352\234\227\214\267\237\376\340\361N\037_\2022\306\364H\212\331\237\025hv\211'\036\376\006%\r\261\227\211\361\223\231\017\364K\245-\360\022\324\227\357\214\240\313\016|b"
+	.string	"\223\032\265^\344\322\273Uk\365LM\317\214\364\316\236C<\337V\347rt\363\260j\367~\201F8\005\214\336\007\002c?\026&\257\206\306\210\3561\235\201\361\t\365\212K{IR\220#m\256\301s\222\225\301\251U\247\211\245\330\215)7\236\035O\342\232ky\033\212\271II\026\343 \001{LE\021\307\347\247\360q\341\226\222u '\365\366U\260Bw\325Q\234\257#:\353(\222\003M\302y\004\236\327\267\214\262\227\252\270\225\234\336%2\343J\215\206$\"\t\356E\204g4\357\215\240E\022i\261\227\023\205k\036\355\364^v@\272\205\227\344\203"
+	.ascii	"\fj#\272sf\267bS\037\263f\036\372\322\026\330k3\323G\0315\211"
+	.ascii	"U\262\331\030\235\306C\335[a\235=2\366\033\215\f\036x\323o'\031"
+	.ascii	"^\302\025\230\360\036-\017\360-\314/\270\370\273b`N\235\225\356"
+	.ascii	"\277Q\351\265*\016\3510\352\255\310b\227>\343\206)|@D\350\016"
+	.ascii	"\227VB$F\210\270\355M\322\t\2520\377\337\227\273P\264\305x\230"
+	.ascii	"\240[\224j\t\317`\244\233\271N\221h*46s\262\320\340\332?\252"
+	.ascii	"a8e\305\260\204\231Z\345w\350OK\031|\334\250-\267\310\2677h"
+	.string	"\353OA\225\023(U\206K\261\211e\305\027\317!\250\250\016\023\321\371\034(\346Z\340\254\266\350\021\032\351\t]\327\006\2601W\265h\363\001p\276X\301\013\234\324\204\256\267?\265~\201tJHG\237\232\324\346\243\314\245\237\312\021\307\274g!\f\001\351\001\334\324y'\207\006u"
+	.string	"\001\221\032\002\233\007@\3754\264\2072i\300\261b*\312\031\333\030\031\205\3739\227L\312\352\365\033e\327X\206\223\307\273B9\240\262S\313fb\375F\316\f\253y\262\300e\370 \212\214\241I\351S\200\203\216\264\307\362\345\253\026x\265\253\226j\030\366\017\315\223"
+	.string	"|gq-E6\007\013\360C0!\017\217e\306\265\227\030x\f9X\025\006\325e\r9\220\r\234\031N\233l\252\344\253\214\252\235'f\223xA&C\257/\204\226c\275a\334\232\224\244\b_\336\346\001\001N\215\374\343\004?\304\344{\023\030/15v\035\222\360\307%\360\335\3658jv'\327\260~X\020%\341A\300\340\017\263\261\331\241i3L\336\325\027\022c\f\373\307\2766\312\007>\027\031\004\037\230r4\375\211\304\320)T\314s<\315\t\241\341\201\037i{\377x\335\232&%$\262l\033\033F\357\311\333\271\261\376\367e\265\244\256\215\f\223\310\370\033A\215\036"
+	.string	"\326\344/$\3542\331AZ9\365"
+	.string	"3\233\002\212\301\333\206\271'NNd\303\221\027\260B2vL\323\261\371\272\305\246\351G\314@\245v\316r\373\353Q\223a7\244\245x\351\277\303\321P.\265\332\350\232\031\207w\032\026F\034g\203_$O\350\2252\277\227\201\215\245\201\3679f\201\0317\005\303\263v\314\373\217\t\033\340\214\377&\277\230\335\252(Du\200\203}}ZM\265\336+I"
+	.string	"\373yY_\275f=\207\245\311\022\363z\212f\220A91M\3120\022\355%*\t[\367Xa\330\366\177@\033G\367\204\277|\217C6&\216)H\267\266\363\020\3440>\022/\254\343\244^ \025\340\233\214\275e '\377\263\277Gd/\201y\367,\b\241f5\002\331\206k\326\264%\0055\0058\272f\306\225dn\304\372\327\361\350\bP\002~\2032\324\344\002y\276\227\316_\341H\365)\201J\307\252\3446\232cU~\222\003\2522\346\275\317\262\f1\215\213AA\335j\273\222\262\254\214_|\250(\257\372\326\r!\362g\277f\262p\007\215\375\3030N-\365n\310>>\335\234"
+	.string	"\225\233\035\341\207\303\237\360,L\304\210\275\231I\001\036n\251\252$0\222\333n\250\230\324;\270\032\203\3117u[\177[\263k\310Ov%\212Nn\030\007\3625\2631H\371\307\265\363\217\213\3025y\2427Y\357T6\242W\201\030\\\377\214?\027\351}\260c\016Z]\201r\3060\323]R>:\201\374;\207\257\321\2515MM:\320\277\346h\367\236\345\262Y\346)\356\302\243\3458\216\004\335\307\251x\334\300\350\026\007%E\251\361\250\337l\370k\250\274\264\343\034$KO\352P\241,\206\375=\227\357\235\351G\233\227\033\355\367\237\333\302\361\003a\207\334c\215\301\211\021\017#\034r\340rL\213\260\326\032\355\354\226<P\246\264\231\327F\206N\272a,^H\002\332\305\2657\r`&^E\0038h/\301@E\016\330"
+	.string	"i\203\321 \327\333\344\352\241%{\253\360U>\222\276\362\221B\211\240v\006=$\230\204\005%\261\013\027\002\2102\337b_\034e\007\332\276\255<\006F\310\035\217l\223\364\355\333\336\235\334\366\177\370\304\306\205\225g\357y\260H\265\377\275_]/\236`~\310\316/\36333~\3725\316;\312\371"
+	.string	"{\260!\331{1\333Uo\002i6C\357\\[\233(\034\376\373\260\321\233\025\223\304}\n\237{\2713\001\301\225w\354\366$~\225\375R\177\030\375\346|\276\2706H?sn\247\025\357"
+	.ascii	"\256\245:\355)\355\277\334\241\337#\201\355\346H\271\037\353"
+	.ascii	"@\302a\221\235\177n\033\373us\244\304\025\362\375\327\230\246"
+	.ascii	"\375\307\277\030?\323\234\033N'y\376}\035\207\003\340o\233\256"
+	.ascii	"kX\006\205SI\302_\303\345\362\302S9\275*{\nt\206\210S\265\227"
+	.ascii	"\241\377\266\376X\331\376\363R\236p\314v5o\017\271b\022<\340"
+	.ascii	"\373\372\344\2029\371\002\250s\300r\207\276.XKW\326\357\336~"
+	.ascii	"\203\261\307\3740\340|\373\214P\327\020O\315\037\"w.\340\330"
+	.ascii	"\275\355\3272#\3556\002\253\rh~\221\276\231\373\006\025#\240"
+	.ascii	"\267krX\346\214\333\3569\366\306]\306&=\355!\247\261\257O\376"
+	.ascii	"lZ\035A#\211\316X\306\351\366z\351\035\032o\252j\244\037\206"
+	.ascii	"_\330\361gFN\361\273C\356\231\277\027\377f\242\343k\021\177="
+	.ascii	"\005\034\250}\361t\230\312\270\264\322\2030]~\337\357\201k\366"
+	.ascii	"=\325=9\267,\361x{\2217G\034\323\217\017p~\371'$N\322\331\362"
+	.ascii	"_\262\264+\312#\317\317s\026\300\232\340i\213a\001xM\366\375"
+	.ascii	"\275g\352N\353\3266\303\332\233w\367\374;Y\303\257\267\262\223"
+	.ascii	"\367f\t\361zp\027\375\220\335\335\314\220\037-\315\357\236\311"
+	.ascii	"K\373\273\361\206\021\341'~\017a\330\336\334\345\3138\375|\260"
+	.ascii	"\267z\357\3334\304f\030\266)\013\205\035\256\213z\320\272\225"
+	.ascii	"1p\352\n"
+	.text
+	.section	.gnu.lto_.symtab.4532185fc8eb772,"e",@progbits
+	.string	"displayClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\001"
+	.string	""
+	.string	"displayDrawScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"displayScreenSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"displayGrab"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"displayRelease"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"displayReleaseAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"displayIsGrabbed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	"displaySetXY"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"displayWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"displayWriteWithAttr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"displayWriteChar"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"displayWriteCharWithAttr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"displayReadCharWithAttr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"displayIsTransferInProgress"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"displayHeartbeat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"displayResync"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"displayTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\002"
+	.string	""
+	.string	"displayGetFontMetadata"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"displayWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\002"
+	.string	""
+	.string	"displayIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\002"
+	.string	""
+	.string	"displayBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"displayCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\002"
+	.string	""
+	.string	"displayGetCanvas"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"displayConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"pgResetTemplate_displayConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\002"
+	.string	""
+	.string	"displayConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"displayConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4532185fc8eb772,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
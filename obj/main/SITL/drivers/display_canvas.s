@@ -0,0 +1,7367 @@
+	.file	"display_canvas.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/display_canvas.h"
+	.file 4 "./src/main/drivers/display_canvas.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	display_canvas.c.0326d892
+	.weak	display_canvas.c.0326d892
+display_canvas.c.0326d892:
+	.long	0xbfc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x10
+	.long	.LASF811
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF697
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF698
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF699
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF700
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF701
+	.uleb128 0xa
+	.long	.LASF703
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF702
+	.uleb128 0xa
+	.long	.LASF704
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF705
+	.uleb128 0x12
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF706
+	.uleb128 0xf
+	.long	0x74
+	.uleb128 0xa
+	.long	.LASF707
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	.LASF708
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x20
+	.long	0xb5
+	.uleb128 0x8
+	.long	.LASF709
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF710
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF711
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF712
+	.byte	0x3
+	.byte	0x24
+	.byte	0x3
+	.long	0x98
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x26
+	.long	0xe4
+	.uleb128 0x8
+	.long	.LASF713
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF714
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF715
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF716
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF717
+	.byte	0x3
+	.byte	0x2b
+	.byte	0x3
+	.long	0xc1
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x2d
+	.long	0x119
+	.uleb128 0x8
+	.long	.LASF718
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF719
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF720
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF721
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF722
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF723
+	.byte	0x3
+	.byte	0x33
+	.byte	0x3
+	.long	0xf0
+	.uleb128 0xa
+	.long	.LASF724
+	.byte	0x3
+	.byte	0x35
+	.byte	0x26
+	.long	0x136
+	.uleb128 0xf
+	.long	0x125
+	.uleb128 0x13
+	.long	.LASF760
+	.value	0x118
+	.byte	0x3
+	.byte	0x40
+	.byte	0x10
+	.long	0x2e9
+	.uleb128 0x4
+	.long	.LASF725
+	.byte	0x41
+	.byte	0xc
+	.long	0x365
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF726
+	.byte	0x42
+	.byte	0xc
+	.long	0x365
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF727
+	.byte	0x43
+	.byte	0xc
+	.long	0x365
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF728
+	.byte	0x44
+	.byte	0xc
+	.long	0x381
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF729
+	.byte	0x45
+	.byte	0xc
+	.long	0x3a0
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF730
+	.byte	0x46
+	.byte	0xc
+	.long	0x3ba
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF731
+	.byte	0x47
+	.byte	0xc
+	.long	0x3ba
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF732
+	.byte	0x48
+	.byte	0xc
+	.long	0x3cf
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF733
+	.byte	0x49
+	.byte	0xc
+	.long	0x3e4
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF734
+	.byte	0x4a
+	.byte	0xc
+	.long	0x365
+	.byte	0x48
+	.uleb128 0x4
+	.long	.LASF735
+	.byte	0x4c
+	.byte	0xc
+	.long	0x408
+	.byte	0x50
+	.uleb128 0x4
+	.long	.LASF736
+	.byte	0x4d
+	.byte	0xc
+	.long	0x408
+	.byte	0x58
+	.uleb128 0x4
+	.long	.LASF737
+	.byte	0x4e
+	.byte	0xc
+	.long	0x418
+	.byte	0x60
+	.uleb128 0x4
+	.long	.LASF738
+	.byte	0x4f
+	.byte	0xc
+	.long	0x43c
+	.byte	0x68
+	.uleb128 0x4
+	.long	.LASF739
+	.byte	0x50
+	.byte	0xc
+	.long	0x465
+	.byte	0x70
+	.uleb128 0x4
+	.long	.LASF740
+	.byte	0x51
+	.byte	0xc
+	.long	0x48e
+	.byte	0x78
+	.uleb128 0x4
+	.long	.LASF741
+	.byte	0x52
+	.byte	0xc
+	.long	0x4b7
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF742
+	.byte	0x53
+	.byte	0xc
+	.long	0x3ba
+	.byte	0x88
+	.uleb128 0x4
+	.long	.LASF743
+	.byte	0x54
+	.byte	0xc
+	.long	0x3ba
+	.byte	0x90
+	.uleb128 0x4
+	.long	.LASF744
+	.byte	0x55
+	.byte	0xc
+	.long	0x4e5
+	.byte	0x98
+	.uleb128 0x4
+	.long	.LASF745
+	.byte	0x56
+	.byte	0xc
+	.long	0x4e5
+	.byte	0xa0
+	.uleb128 0x4
+	.long	.LASF746
+	.byte	0x57
+	.byte	0xc
+	.long	0x4e5
+	.byte	0xa8
+	.uleb128 0x4
+	.long	.LASF747
+	.byte	0x58
+	.byte	0xc
+	.long	0x408
+	.byte	0xb0
+	.uleb128 0x4
+	.long	.LASF748
+	.byte	0x59
+	.byte	0xc
+	.long	0x408
+	.byte	0xb8
+	.uleb128 0x4
+	.long	.LASF749
+	.byte	0x5a
+	.byte	0xc
+	.long	0x408
+	.byte	0xc0
+	.uleb128 0x4
+	.long	.LASF750
+	.byte	0x5b
+	.byte	0xc
+	.long	0x408
+	.byte	0xc8
+	.uleb128 0x4
+	.long	.LASF751
+	.byte	0x5c
+	.byte	0xc
+	.long	0x408
+	.byte	0xd0
+	.uleb128 0x4
+	.long	.LASF752
+	.byte	0x5d
+	.byte	0xc
+	.long	0x408
+	.byte	0xd8
+	.uleb128 0x4
+	.long	.LASF753
+	.byte	0x5f
+	.byte	0xc
+	.long	0x418
+	.byte	0xe0
+	.uleb128 0x4
+	.long	.LASF754
+	.byte	0x60
+	.byte	0xc
+	.long	0x51a
+	.byte	0xe8
+	.uleb128 0x4
+	.long	.LASF755
+	.byte	0x61
+	.byte	0xc
+	.long	0x534
+	.byte	0xf0
+	.uleb128 0x4
+	.long	.LASF756
+	.byte	0x62
+	.byte	0xc
+	.long	0x534
+	.byte	0xf8
+	.uleb128 0xc
+	.long	.LASF757
+	.byte	0x63
+	.long	0x549
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF758
+	.byte	0x65
+	.long	0x418
+	.value	0x108
+	.uleb128 0xc
+	.long	.LASF759
+	.byte	0x66
+	.long	0x418
+	.value	0x110
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF761
+	.byte	0x18
+	.byte	0x3
+	.byte	0x37
+	.byte	0x10
+	.long	0x33f
+	.uleb128 0x4
+	.long	.LASF762
+	.byte	0x38
+	.byte	0x22
+	.long	0x33f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF763
+	.byte	0x39
+	.byte	0xb
+	.long	0x72
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF764
+	.byte	0x3a
+	.byte	0xe
+	.long	0x8c
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF765
+	.byte	0x3b
+	.byte	0xe
+	.long	0x8c
+	.byte	0x12
+	.uleb128 0x4
+	.long	.LASF766
+	.byte	0x3c
+	.byte	0xd
+	.long	0x80
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF767
+	.byte	0x3d
+	.byte	0xd
+	.long	0x80
+	.byte	0x15
+	.byte	0
+	.uleb128 0x6
+	.long	0x131
+	.uleb128 0xa
+	.long	.LASF768
+	.byte	0x3
+	.byte	0x3e
+	.byte	0x3
+	.long	0x2e9
+	.uleb128 0x7
+	.long	0x360
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0xe4
+	.byte	0
+	.uleb128 0x6
+	.long	0x344
+	.uleb128 0x6
+	.long	0x350
+	.uleb128 0x7
+	.long	0x37a
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x37a
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF769
+	.uleb128 0x6
+	.long	0x36a
+	.uleb128 0x7
+	.long	0x3a0
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0xe4
+	.byte	0
+	.uleb128 0x6
+	.long	0x386
+	.uleb128 0x7
+	.long	0x3ba
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	0x3a5
+	.uleb128 0x7
+	.long	0x3cf
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x30
+	.byte	0
+	.uleb128 0x6
+	.long	0x3bf
+	.uleb128 0x7
+	.long	0x3e4
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x119
+	.byte	0
+	.uleb128 0x6
+	.long	0x3d4
+	.uleb128 0x7
+	.long	0x408
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	0x3e9
+	.uleb128 0x7
+	.long	0x418
+	.uleb128 0x2
+	.long	0x360
+	.byte	0
+	.uleb128 0x6
+	.long	0x40d
+	.uleb128 0x7
+	.long	0x43c
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x8c
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	0x41d
+	.uleb128 0x7
+	.long	0x465
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x8c
+	.uleb128 0x2
+	.long	0xe4
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	0x441
+	.uleb128 0x7
+	.long	0x489
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x489
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	0x7b
+	.uleb128 0x6
+	.long	0x46a
+	.uleb128 0x7
+	.long	0x4b7
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x489
+	.uleb128 0x2
+	.long	0xe4
+	.uleb128 0x2
+	.long	0xb5
+	.byte	0
+	.uleb128 0x6
+	.long	0x493
+	.uleb128 0x7
+	.long	0x4e5
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.uleb128 0x2
+	.long	0x64
+	.byte	0
+	.uleb128 0x6
+	.long	0x4bc
+	.uleb128 0x7
+	.long	0x513
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.byte	0
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF770
+	.uleb128 0x6
+	.long	0x4ea
+	.uleb128 0x7
+	.long	0x534
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x513
+	.uleb128 0x2
+	.long	0x513
+	.byte	0
+	.uleb128 0x6
+	.long	0x51f
+	.uleb128 0x7
+	.long	0x549
+	.uleb128 0x2
+	.long	0x360
+	.uleb128 0x2
+	.long	0x513
+	.byte	0
+	.uleb128 0x6
+	.long	0x539
+	.uleb128 0xd
+	.long	.LASF771
+	.value	0x10e
+	.long	0x566
+	.uleb128 0xe
+	.long	.LASF773
+	.value	0x10e
+	.byte	0x2f
+	.long	0x360
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF772
+	.value	0x107
+	.long	0x57e
+	.uleb128 0xe
+	.long	.LASF773
+	.value	0x107
+	.byte	0x30
+	.long	0x360
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF774
+	.value	0x100
+	.long	0x5a1
+	.uleb128 0xe
+	.long	.LASF773
+	.value	0x100
+	.byte	0x2e
+	.long	0x360
+	.uleb128 0x15
+	.string	"r"
+	.byte	0x4
+	.value	0x100
+	.byte	0x43
+	.long	0x513
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF775
+	.byte	0xf9
+	.long	0x5cb
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xf9
+	.byte	0x2d
+	.long	0x360
+	.uleb128 0x1
+	.string	"sx"
+	.byte	0xf9
+	.byte	0x42
+	.long	0x513
+	.uleb128 0x1
+	.string	"sy"
+	.byte	0xf9
+	.byte	0x4c
+	.long	0x513
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF776
+	.byte	0xf2
+	.long	0x5f5
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xf2
+	.byte	0x31
+	.long	0x360
+	.uleb128 0x1
+	.string	"tx"
+	.byte	0xf2
+	.byte	0x46
+	.long	0x513
+	.uleb128 0x1
+	.string	"ty"
+	.byte	0xf2
+	.byte	0x50
+	.long	0x513
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF777
+	.byte	0xeb
+	.long	0x64d
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xeb
+	.byte	0x2b
+	.long	0x360
+	.uleb128 0x1
+	.string	"m11"
+	.byte	0xeb
+	.byte	0x40
+	.long	0x513
+	.uleb128 0x1
+	.string	"m12"
+	.byte	0xeb
+	.byte	0x4b
+	.long	0x513
+	.uleb128 0x1
+	.string	"m21"
+	.byte	0xeb
+	.byte	0x56
+	.long	0x513
+	.uleb128 0x1
+	.string	"m22"
+	.byte	0xeb
+	.byte	0x61
+	.long	0x513
+	.uleb128 0x1
+	.string	"m31"
+	.byte	0xeb
+	.byte	0x6c
+	.long	0x513
+	.uleb128 0x1
+	.string	"m32"
+	.byte	0xeb
+	.byte	0x77
+	.long	0x513
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF778
+	.byte	0xe4
+	.long	0x663
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xe4
+	.byte	0x2d
+	.long	0x360
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF779
+	.byte	0xdd
+	.long	0x69d
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xdd
+	.byte	0x3c
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xdd
+	.byte	0x4f
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xdd
+	.byte	0x56
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xdd
+	.byte	0x5d
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xdd
+	.byte	0x64
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF780
+	.byte	0xd6
+	.long	0x6d7
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xd6
+	.byte	0x36
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xd6
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xd6
+	.byte	0x50
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xd6
+	.byte	0x57
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xd6
+	.byte	0x5e
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF781
+	.byte	0xcf
+	.long	0x711
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xcf
+	.byte	0x38
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xcf
+	.byte	0x4b
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xcf
+	.byte	0x52
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xcf
+	.byte	0x59
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xcf
+	.byte	0x60
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF782
+	.byte	0xc8
+	.long	0x74b
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xc8
+	.byte	0x33
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xc8
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xc8
+	.byte	0x4d
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xc8
+	.byte	0x54
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xc8
+	.byte	0x5b
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF783
+	.byte	0xc1
+	.long	0x785
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xc1
+	.byte	0x2d
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xc1
+	.byte	0x40
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xc1
+	.byte	0x47
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xc1
+	.byte	0x4e
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xc1
+	.byte	0x55
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF784
+	.byte	0xba
+	.long	0x7bf
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xba
+	.byte	0x2f
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0xba
+	.byte	0x42
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0xba
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0xba
+	.byte	0x50
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0xba
+	.byte	0x57
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF785
+	.byte	0xb3
+	.long	0x811
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xb3
+	.byte	0x37
+	.long	0x360
+	.uleb128 0x1
+	.string	"x1"
+	.byte	0xb3
+	.byte	0x4a
+	.long	0x64
+	.uleb128 0x1
+	.string	"y1"
+	.byte	0xb3
+	.byte	0x52
+	.long	0x64
+	.uleb128 0x1
+	.string	"x2"
+	.byte	0xb3
+	.byte	0x5a
+	.long	0x64
+	.uleb128 0x1
+	.string	"y2"
+	.byte	0xb3
+	.byte	0x62
+	.long	0x64
+	.uleb128 0x1
+	.string	"x3"
+	.byte	0xb3
+	.byte	0x6a
+	.long	0x64
+	.uleb128 0x1
+	.string	"y3"
+	.byte	0xb3
+	.byte	0x72
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF786
+	.byte	0xac
+	.long	0x863
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xac
+	.byte	0x31
+	.long	0x360
+	.uleb128 0x1
+	.string	"x1"
+	.byte	0xac
+	.byte	0x44
+	.long	0x64
+	.uleb128 0x1
+	.string	"y1"
+	.byte	0xac
+	.byte	0x4c
+	.long	0x64
+	.uleb128 0x1
+	.string	"x2"
+	.byte	0xac
+	.byte	0x54
+	.long	0x64
+	.uleb128 0x1
+	.string	"y2"
+	.byte	0xac
+	.byte	0x5c
+	.long	0x64
+	.uleb128 0x1
+	.string	"x3"
+	.byte	0xac
+	.byte	0x64
+	.long	0x64
+	.uleb128 0x1
+	.string	"y3"
+	.byte	0xac
+	.byte	0x6c
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF787
+	.byte	0xa5
+	.long	0x8b5
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0xa5
+	.byte	0x33
+	.long	0x360
+	.uleb128 0x1
+	.string	"x1"
+	.byte	0xa5
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x1
+	.string	"y1"
+	.byte	0xa5
+	.byte	0x4e
+	.long	0x64
+	.uleb128 0x1
+	.string	"x2"
+	.byte	0xa5
+	.byte	0x56
+	.long	0x64
+	.uleb128 0x1
+	.string	"y2"
+	.byte	0xa5
+	.byte	0x5e
+	.long	0x64
+	.uleb128 0x1
+	.string	"x3"
+	.byte	0xa5
+	.byte	0x66
+	.long	0x64
+	.uleb128 0x1
+	.string	"y3"
+	.byte	0xa5
+	.byte	0x6e
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF788
+	.byte	0x9e
+	.long	0x8dd
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x9e
+	.byte	0x36
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x9e
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x9e
+	.byte	0x50
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF789
+	.byte	0x97
+	.long	0x905
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x97
+	.byte	0x30
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x97
+	.byte	0x43
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x97
+	.byte	0x4a
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF790
+	.byte	0x90
+	.long	0x94c
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x90
+	.byte	0x33
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x90
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x90
+	.byte	0x4d
+	.long	0x64
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x90
+	.byte	0x5c
+	.long	0x489
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x90
+	.byte	0x74
+	.long	0xe4
+	.uleb128 0x3
+	.long	.LASF792
+	.byte	0x90
+	.byte	0x97
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF793
+	.byte	0x89
+	.long	0x988
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x89
+	.byte	0x2f
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x89
+	.byte	0x42
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x89
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"s"
+	.byte	0x89
+	.byte	0x58
+	.long	0x489
+	.uleb128 0x3
+	.long	.LASF792
+	.byte	0x89
+	.byte	0x77
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF794
+	.byte	0x82
+	.long	0x9d1
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x82
+	.byte	0x36
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x82
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x82
+	.byte	0x50
+	.long	0x64
+	.uleb128 0x1
+	.string	"chr"
+	.byte	0x82
+	.byte	0x5c
+	.long	0x8c
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x82
+	.byte	0x76
+	.long	0xe4
+	.uleb128 0x3
+	.long	.LASF792
+	.byte	0x82
+	.byte	0x99
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF795
+	.byte	0x7b
+	.long	0xa0f
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x7b
+	.byte	0x32
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x7b
+	.byte	0x45
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x7b
+	.byte	0x4c
+	.long	0x64
+	.uleb128 0x1
+	.string	"chr"
+	.byte	0x7b
+	.byte	0x58
+	.long	0x8c
+	.uleb128 0x3
+	.long	.LASF792
+	.byte	0x7b
+	.byte	0x79
+	.long	0xb5
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF796
+	.byte	0x74
+	.long	0xa25
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x74
+	.byte	0x36
+	.long	0x360
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF797
+	.byte	0x6d
+	.long	0xa5f
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x6d
+	.byte	0x2e
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x6d
+	.byte	0x41
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x6d
+	.byte	0x48
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0x6d
+	.byte	0x4f
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0x6d
+	.byte	0x56
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF798
+	.byte	0x66
+	.long	0xa99
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x66
+	.byte	0x2f
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x66
+	.byte	0x42
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x66
+	.byte	0x49
+	.long	0x64
+	.uleb128 0x1
+	.string	"w"
+	.byte	0x66
+	.byte	0x50
+	.long	0x64
+	.uleb128 0x1
+	.string	"h"
+	.byte	0x66
+	.byte	0x57
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF799
+	.byte	0x5f
+	.long	0xaba
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x5f
+	.byte	0x38
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF800
+	.byte	0x5f
+	.byte	0x5c
+	.long	0xe4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF801
+	.byte	0x58
+	.long	0xadb
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x58
+	.byte	0x37
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF802
+	.byte	0x58
+	.byte	0x61
+	.long	0x119
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF803
+	.byte	0x51
+	.long	0xafa
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x51
+	.byte	0x33
+	.long	0x360
+	.uleb128 0x1
+	.string	"w"
+	.byte	0x51
+	.byte	0x4b
+	.long	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF804
+	.byte	0x4a
+	.long	0xb22
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x4a
+	.byte	0x38
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x4a
+	.byte	0x4b
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x4a
+	.byte	0x52
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF805
+	.byte	0x43
+	.long	0xb4a
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x43
+	.byte	0x3a
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x43
+	.byte	0x4d
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x43
+	.byte	0x54
+	.long	0x64
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF806
+	.byte	0x3c
+	.long	0xb7d
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x3c
+	.byte	0x2d
+	.long	0x360
+	.uleb128 0x1
+	.string	"x"
+	.byte	0x3c
+	.byte	0x40
+	.long	0x64
+	.uleb128 0x1
+	.string	"y"
+	.byte	0x3c
+	.byte	0x47
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x3c
+	.byte	0x5f
+	.long	0xe4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF807
+	.byte	0x35
+	.long	0xb9e
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x35
+	.byte	0x36
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF808
+	.byte	0x35
+	.byte	0x49
+	.long	0x37a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF809
+	.byte	0x2b
+	.long	0xbbf
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x2b
+	.byte	0x3a
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x2b
+	.byte	0x5e
+	.long	0xe4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF810
+	.byte	0x24
+	.long	0xbe0
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x24
+	.byte	0x31
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x24
+	.byte	0x55
+	.long	0xe4
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF812
+	.byte	0x4
+	.byte	0x1d
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF773
+	.byte	0x1d
+	.byte	0x33
+	.long	0x360
+	.uleb128 0x3
+	.long	.LASF791
+	.byte	0x1d
+	.byte	0x57
+	.long	0xe4
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x7
+	.long	.LASF1
+	.long	.LASF813
+	.long	.LASF814
+	.long	.LASF815
+	.long	.LASF816
+	.long	.LASF817
+	.long	.LASF818
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x16
+	.long	.LASF0
+	.byte	0
+	.long	.LASF819
+	.byte	0x2
+	.long	.LASF820
+	.byte	0x2
+	.long	.LASF821
+	.byte	0x1
+	.long	.LASF822
+	.byte	0x1
+	.long	.LASF823
+	.byte	0x5
+	.long	.LASF824
+	.byte	0x6
+	.long	.LASF825
+	.byte	0x6
+	.long	.LASF825
+	.byte	0x5
+	.long	.LASF826
+	.byte	0x2
+	.long	.LASF827
+	.byte	0x5
+	.long	.LASF828
+	.byte	0x5
+	.long	.LASF829
+	.byte	0x2
+	.long	.LASF830
+	.byte	0x2
+	.long	.LASF831
+	.byte	0x4
+	.long	.LASF832
+	.byte	0x2
+	.long	.LASF833
+	.byte	0x3
+	.long	.LASF834
+	.byte	0x3
+	.long	.LASF835
+	.byte	0x2
+	.long	.LASF836
+	.byte	0x2
+	.long	.LASF837
+	.byte	0x2
+	.long	.LASF838
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF761:
+	.string	"displayCanvas_s"
+.LASF768:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF772:
+	.string	"displayCanvasContextPush"
+.LASF749:
+	.string	"fillStrokeRect"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF778:
+	.string	"displayCanvasCtmReset"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF784:
+	.string	"displayCanvasStrokeRect"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF727:
+	.string	"setStrokeAndFillColor"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF802:
+	.string	"outlineType"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF810:
+	.string	"displayCanvasSetFillColor"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF804:
+	.string	"displayCanvasSetPixelToFillColor"
+.LASF476:
+	.string	"__P(args) args"
+.LASF806:
+	.string	"displayCanvasSetPixel"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF780:
+	.string	"displayCanvasFillEllipseInRect"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF790:
+	.string	"displayCanvasDrawStringMask"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF726:
+	.string	"setFillColor"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF739:
+	.string	"drawCharacterMask"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF750:
+	.string	"strokeEllipseInRect"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF786:
+	.string	"displayCanvasFillTriangle"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF711:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_ERASE_TRANSPARENT"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF732:
+	.string	"setStrokeWidth"
+.LASF811:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF705:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF799:
+	.string	"displayCanvasSetLineOutlineColor"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF754:
+	.string	"ctmSet"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF746:
+	.string	"fillStrokeTriangle"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF716:
+	.string	"DISPLAY_CANVAS_COLOR_GRAY"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF701:
+	.string	"signed char"
+.LASF707:
+	.string	"uint8_t"
+.LASF744:
+	.string	"strokeTriangle"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF788:
+	.string	"displayCanvasStrokeLineToPoint"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF697:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF767:
+	.string	"gridElementHeight"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF797:
+	.string	"displayCanvasClearRect"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF769:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF766:
+	.string	"gridElementWidth"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF720:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_RIGHT"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF737:
+	.string	"resetDrawingState"
+.LASF722:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_LEFT"
+.LASF710:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_SOLID_BACKGROUND"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF735:
+	.string	"clipToRect"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF704:
+	.string	"__uint16_t"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF714:
+	.string	"DISPLAY_CANVAS_COLOR_TRANSPARENT"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF733:
+	.string	"setLineOutlineType"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF740:
+	.string	"drawString"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF736:
+	.string	"clearRect"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF773:
+	.string	"displayCanvas"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF703:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF731:
+	.string	"setPixelToFillColor"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF808:
+	.string	"inverted"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF775:
+	.string	"displayCanvasCtmScale"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF748:
+	.string	"fillRect"
+.LASF794:
+	.string	"displayCanvasDrawCharacterMask"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF779:
+	.string	"displayCanvasFillStrokeEllipseInRect"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF798:
+	.string	"displayCanvasClipToRect"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF747:
+	.string	"strokeRect"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF764:
+	.string	"width"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF717:
+	.string	"displayCanvasColor_e"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF782:
+	.string	"displayCanvasFillStrokeRect"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF712:
+	.string	"displayCanvasBitmapOption_t"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF795:
+	.string	"displayCanvasDrawCharacter"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF776:
+	.string	"displayCanvasCtmTranslate"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF466:
+	.string	"__PMT"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF800:
+	.string	"outlineColor"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF718:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_NONE"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF699:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF753:
+	.string	"ctmReset"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF792:
+	.string	"opts"
+.LASF812:
+	.string	"displayCanvasSetStrokeColor"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF738:
+	.string	"drawCharacter"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF774:
+	.string	"displayCanvasCtmRotate"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF777:
+	.string	"displayCanvasCtmSet"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF796:
+	.string	"displayCanvasResetDrawingState"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF803:
+	.string	"displayCanvasSetStrokeWidth"
+.LASF706:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF489:
+	.string	"__flexarr []"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF734:
+	.string	"setLineOutlineColor"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF789:
+	.string	"displayCanvasMoveToPoint"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF759:
+	.string	"contextPop"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF763:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF742:
+	.string	"moveToPoint"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF801:
+	.string	"displayCanvasSetLineOutlineType"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF787:
+	.string	"displayCanvasStrokeTriangle"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF730:
+	.string	"setPixelToStrokeColor"
+.LASF708:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF700:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF728:
+	.string	"setColorInversion"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF745:
+	.string	"fillTriangle"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF729:
+	.string	"setPixel"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF719:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_TOP"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF725:
+	.string	"setStrokeColor"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF715:
+	.string	"DISPLAY_CANVAS_COLOR_WHITE"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF751:
+	.string	"fillEllipseInRect"
+.LASF805:
+	.string	"displayCanvasSetPixelToStrokeColor"
+.LASF809:
+	.string	"displayCanvasSetStrokeAndFillColor"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF807:
+	.string	"displayCanvasSetColorInversion"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF709:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_INVERT_COLORS"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF791:
+	.string	"color"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF752:
+	.string	"fillStrokeEllipseInRect"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF721:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_BOTTOM"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF793:
+	.string	"displayCanvasDrawString"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF702:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF781:
+	.string	"displayCanvasStrokeEllipseInRect"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF713:
+	.string	"DISPLAY_CANVAS_COLOR_BLACK"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF755:
+	.string	"ctmTranslate"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF743:
+	.string	"strokeLineToPoint"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF760:
+	.string	"displayCanvasVTable_s"
+.LASF724:
+	.string	"displayCanvasVTable_t"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF771:
+	.string	"displayCanvasContextPop"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF698:
+	.string	"short unsigned int"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF723:
+	.string	"displayCanvasOutlineType_e"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF741:
+	.string	"drawStringMask"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF770:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF783:
+	.string	"displayCanvasFillRect"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF762:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF757:
+	.string	"ctmRotate"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF756:
+	.string	"ctmScale"
+.LASF758:
+	.string	"contextPush"
+.LASF785:
+	.string	"displayCanvasFillStrokeTriangle"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF765:
+	.string	"height"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF832:
+	.string	"long-double.h"
+.LASF834:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/drivers/display_canvas.c"
+.LASF817:
+	.string	"/usr/include"
+.LASF838:
+	.string	"stdint-intn.h"
+.LASF824:
+	.string	"stdbool.h"
+.LASF826:
+	.string	"libc-header-start.h"
+.LASF815:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF837:
+	.string	"wchar.h"
+.LASF830:
+	.string	"timesize.h"
+.LASF833:
+	.string	"stubs.h"
+.LASF820:
+	.string	"stdint-uintn.h"
+.LASF816:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF818:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF827:
+	.string	"features.h"
+.LASF836:
+	.string	"time64.h"
+.LASF813:
+	.string	"src/main/drivers"
+.LASF814:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF835:
+	.string	"typesizes.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF828:
+	.string	"features-time64.h"
+.LASF831:
+	.string	"cdefs.h"
+.LASF822:
+	.string	"display_canvas.c"
+.LASF821:
+	.string	"display_canvas.h"
+.LASF829:
+	.string	"wordsize.h"
+.LASF823:
+	.string	"stdc-predef.h"
+.LASF825:
+	.string	"stdint.h"
+.LASF819:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375 O\345\001"
+	.string	"\362\004\016\024\020\313\233\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\377\377\025V\224\207\025-J\001\017\r\013\t\007\005\003\001\277\336.w\253\315b\257\326*u*\215B\237\316&s\251L\"\037\215\305\210O\004"
+	.text
+	.section	.gnu.lto_.icf.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`+\001\035\013"
+	.string	"D\022\037\002"
+	.string	"$"
+	.string	"\255\363\305\251\005\004\002"
+	.ascii	"\002\001\002\002\002\003\001\200\332\324\340\004\002\354\271"
+	.ascii	"\314\350\r\003\214\355\242"
+	.string	"\200\007\006\004\320\335\354#\004\002\003\005\265\217\326\227\n\005\002\003\006\221\345\231\347\t\004\006\002\003\007\210\220\353\270\013\b\321\315\334\321\004\007\002\003\t\226\241\234\335\t\b\002\003\n\257\343\340\207\001\002\002\003\013\235\207\301\353\013\t\002\003\f\343\255\364\216\016\r\323\257\267\277\003\n\002\003\016\262\255\356\340\006\013\002\003\017\227\262\362\327\017\f\002\003\020\341\217\322\374\007\r\002\003\021\323\253\370\351\t\016\002\003\022\235\354\330\335\b\006\002\003\023\264\266\377\273\t\024\313\227\374\216\017\017\002\003\025\206\303\311\310\003\026\345\271\233\314\017\027\335\334\346\313\n\t\002\003\030\361\320\236\270\017\031\213\376\354\303\007\032\221\220\300P\033\273\200\272\206\003\034\235\200\365\274\001\035\240\333\341\275\005\n\002\003\036\345\363\330\212\007\020\002\003\037\204\202\361;\021\002\003 \215\214\276\237\n\021\002\003!\323\214\365\374\002\022\002\003\"\313\300\207\270\b#\334\365\372\222\001\n\002\003"
+	.ascii	"% \240c7\243\224s\0340N3\270qFQ)\322R\242\350\245\2243\212R\312"
+	.ascii	"\031E9\343\214c\234q\3061J9\343\030g\034\216\"u^4\343L\031\245"
+	.ascii	"C \346\245\220\322\212<\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`*\005\035\b"
+	.string	"\262F\026\034`O\322\001\3040\f\3030\f\303\300'\343\362\211&\032\245\037\326\221\354\275\311\336I\006\035\363\245,\025\243\344\363Dr\021\310=\034\327`,n\321\362T$\fq\330d\035\347\366p4\024~\302\340>A"
+	.string	"P)m\303[\273-4:d\2054\327'\347\324\226\325\325L\361\tN\250\300P\0252\255\001\300\002\031\241\243<\022\340\0210\f\016AXI"
+	.ascii	"\241\220\020!d\004F\210\260p\"\013&r\034\bW\211\257\n\272$\370"
+	.ascii	"\266\212\226\260\261\224\020\"\221D]\225\277\244\227m\251\037"
+	.ascii	"\367\272\355\303\344\370q5\320gz\361\323\003YqX\334M\332\200"
+	.ascii	"\375\322?\253\t\300\317\3353;\340yf\f\355Q.KX\027\257\325Q\263"
+	.ascii	"\303\374\362\331q\235F\257\216\016T0\244\021\257\232g\216\335"
+	.ascii	" :B\304T6\244\033\262\bF\354&\004L\363m\021\335eiX\311\364\345"
+	.ascii	"\260\r\005\320\334\251F\263\227I\340\327\002"
+	.text
+	.section	.gnu.lto_.inline.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\355\n-\013"
+	.string	"\342L-1pk\322\030\374_#\202p*\361B\200D\354}\360\251\n\315\273\002\252\337"
+	.string	"D\001U\r\360\\\377\377\377\2335\262\215\250[#j\215\020B\266\2242\005/($ \354\301\032\024\020\f\b\004"
+	.string	"h2\230\035\214\376\214\244\003\213\034\326\327\305\222VV;\b\375\230\210j\304\254S]\2714W);\230\177\325 b\326\231\236P\317\177I\027\357=T\236$\031\221\242\035\334\337\002Qd\034\213\311PT\301\301\"(?_4S\033\265!1\003\241v\002#\303C\363j\356\340\016\352o=\355\2666h\256\353F\177\263\357\275\007\265\337W\363<\035T\002\213\033\3243<}\004J\250\361l#Eu\n\313\236\001\360\242\221\240\250\036\022\300P@\004@\222&"
+	.ascii	"\031\002\206\340\212\240!\374\016\201b\2405?\347\234\267\211"
+	.ascii	"E4\255\343\023\232\2224\247\203\013\334\022\267\\`\325\360\261"
+	.ascii	"\241M~\264\307\264\241\022\270\004=\217HL\032nM1\372\364.\244"
+	.ascii	"-\263v\312q;m\177\005\224\233P\357q)\f\217|:P\340\214\271\303"
+	.ascii	"\354R{\034G{`<\207\212~b\274\022\320\304\344T\321\327\251\205"
+	.ascii	"\246\210\356\030\374\206\247\030\027\341\001\317\211\226\336"
+	.ascii	"X\360\360\023\313\177\246\216?\250)\023jT\240\224\002\374l8\230"
+	.ascii	"\375\254*)p\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`4\n\235\f"
+	.string	"\242\f(*\2007I\0073\n\023\262\ns \003\263\244LHgD\246\241"
+	.ascii	"D"
+	.string	"\204\213\201a\277\277\3556\213\030\375\350\373\321o\215l\262\323\016\266\240\2205\213$d\026!\253(\274\310r`P\020\201@\017\345x\234\254\262x\210~i0\b\242\001LE\210\022PE\005t;\316\344\225&\255\005\335\215\353d\221\275\357\364\001\212\254\025\023\217\212VL\342\001\340@,Y\305\341OJ\272\242\025\341<w\364\217*k\317\270~7\177\226\276\224\356\2545k\255\265]4\353\241\304F\311\266\025\321\271\277\231?c0\246!d\250Q]w\243Ba\3317\240\002\021\231*\333\006\022\240\262\034B\301,\002q\020B\210\b\211\022\"\341DP\024\021\224#&\342\003\335p\177\035\267\002#S\230\213\236\0230&\246e\274\216#F\031\340\201\374\225\222xQ\276P\371\207\013\032u\203\250n\270\216r <\242\372q\225\201\235}g\214\311%\201\243\004d\233+\360.\b\323\246myQ\376\373\370}\250\035@]"
+	.string	"\236\303A\210\231I\344{4\323\017*86:x\254\235\227\026\335wwY'\257E\240\216\n\333\301\361\271w\205f%EC)\324\263\231A"
+	.ascii	"D\210\021\234\235/n\032*\244b 0d\310\351\233a\314-\210\352\304"
+	.ascii	"\272\263\201\017\213G\225\003\340[(%\203O\254\242T\312\204\004"
+	.ascii	"!\262\317\226\226<\035\t\224\013\206\006\335\341\322\262u\200"
+	.ascii	"t@\"m.\022\245\344\317\324\252\357\036"
+	.text
+	.section	.gnu.lto_.pureconst.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375 q\235\002"
+	.string	"\022\307\023\034\200\3310\00630W\314\300\f\3147\002\370\007\376\201?\326u]\327u][\326\266\f\336p\206/\\\341\tG\370\301\r^p\202\017\\\340\001\007\370\346\232g\216\371\345\226WN\371\344\222G\016\371\343\2167\316\370\342\272\342\211#~\216\273{\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\326\003M\005"
+	.string	"T\005\312\004"
+	.string	"$"
+	.string	"\002\002\034"
+	.string	"\001\002\003"
+	.string	"\001"
+	.string	"\001"
+	.string	""
+	.string	"\300"
+	.string	"\300"
+	.string	"\002\035"
+	.string	"\001\002\036\001"
+	.string	"\002\003\004\037\005 \006!\007\b\"\t#\n\036\013$\f\r%\016&\017'\020(\021)\022!\023\024*\025\026\027$\030\031\032\033\034\035%\036+\037, !-\"%#"
+	.ascii	"; \360\2251C\260\263\f\023\373\006\303\304\036\306\254\304\316"
+	.ascii	"f\243\2147\262Q\306a\314\226\361\006\213\211}\203ab\017cV\260"
+	.ascii	"\263\f\023{1f\005;\233\r\301\3162L\354a\314J\354l6\004;\3130"
+	.ascii	"\261\2071[\306\313#\227t-\022\212\021Z\341\335"
+	.text
+	.section	.gnu.lto_.lto.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeColor.0.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\036\001U\r"
+	.string	"\226Y\\D"
+	.string	"\223\223\016\360\235\242z#\001\250Z\262>\031*\2124\354\031\330H\307\324\307\263\2132\373\024\206\250!-\200\320\b\236 >\202aY\214@U\365~\307\036\302\237\216\003I\0362\005\312\331\307\230x\262\267\224)\005G"
+	.string	"H"
+	.string	"G"
+	.ascii	"\327\243\277#\260\036\257s\254Gwv\216\004/\002h:\330\360\330"
+	.ascii	"]LO\274;\324\354\374\247\016\002\343\225\016C\\!'"
+	.string	"&\206\212\200g\202\rT3#\236zz\360\\2\001H\330]'\214\007\342\216\267M\301vf\037C5\277u\324\037a:5\375\013\304\004g\307\356\207\325\217\275\2114dl\337~\213\316\016\261;:J2\237\362\277\263\350^\263\001\026X\023\t\231\n\327\243\b\354\330(y~\205\257\3424\335Q,7\260{\302!c\367s`\222\251\232\211\231\241\326\254\324\013\251\033\246\354a\373\3440\264k\327\364\361_p\310@\262\036S\027\330\334]\220\256\335\375\3706*\032\256\024\217>\213\365x\355\240@\265\344\312\007V56}\330_)\265\204}\270\273k=\331\017\233f\242\201\242G\"@\b}FH\036x\024L\030`\220\207\313VP2\220\005Rf\222\302\215B\030\267\211VF[\bC\031e'\030h\3430\017\003k)\242\rS\321\264\r\013\371\366p\365\344(\342\246E]`\200\2644\252S-\362\242%\213\274\025"
+	.ascii	"C\241\320\274Wj&\2341\ry6\276\332\332\230\275\221j\013\264\354"
+	.ascii	"\260{\310\330\001\366\256t\026c\023\274r\031\346\251y\340D\241"
+	.ascii	"je\234\340\251\256\234R\250="
+	.text
+	.section	.gnu.lto_displayCanvasSetFillColor.1.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\036\001]\r"
+	.string	"\226\231\\D"
+	.string	"\223\223\016\360\005t\272H"
+	.string	"\252!;d\006\254\020T\221CD/\212\251\035>\035\213\230\2430D\ri\001\204F\360\004\361\021\f\313b\004\252\252\367;\366\020\376t\034H\362\220i\257\234}G\022D\366\2262\245G"
+	.string	"I"
+	.string	"G"
+	.string	"\330\243\277\207\\\217\330;\327\243=[\007\202\027\0015\034fx\354n\246'\356\035jz\376Y\007"
+	.string	"\2032\035\202\270\302NLM\213"
+	.string	"\352\004\031\264T\"\316zv@\271d\202D\330]'\f\352\303\035o{\202m\315\376\2052\377\365\325\037a:5}\214\023\342\300\216]\0177?\326&\326Xa\373\366ax6\307\366\330(\311<\313\377\376\302\273\214\006X`O%TP\300\036E\240\207\246\344y\027>\213\267\360\276b\271\201\335\024\216\031\273_\003\223\004\331R\305\320PoW\252\005V\216S\366\260}r\232\r\333=\201|\031\0330\224\256\307T\005v\367\030%lwA\376\214J\006,\305\243\317r=^=(V-y\343\220\02176}\330\237)\325\204}\270\273kM\331\017\334f\262\205\242G <\020\201FH\034|\022H\030\340\320\247\323VP\264P\205\222f\222\322\221DY\307\215VH\234(C!i'Y\210\353\262\317\002o)#.S\3316.\343|{\270\232rT\331\264\250\013\f\220\227Fu\252E^\324\344\021\211\025"
+	.ascii	"C\241\320\274Wj&\2341\ry6\276\332\332\230\275\221j\013\264\354"
+	.ascii	"\260{\310\330\001\366\256t\026c\023\274r\031\346\251y\340D\241"
+	.ascii	"je\234\340\251\256\234R\250="
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeAndFillColor.2.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\227\002\275\023"
+	.string	"\266\343~I\320\322(\035`A\204$T\365H\004r\353PW\273\310\217~\355X\334\233\031~\353 \264y.\326d\005Qn\303\262\320\216\240\224\312\253\310\372\225\0014a\364\320c\025\206\021\027\360\334"
+	.string	"\371\262\032\374\266\207\260H#{\357\235Rg"
+	.string	"k"
+	.string	"d"
+	.string	"\217\341\303\270\217\3546\232\017\330\315Y\"\332\275-\360\t\370\352\333I\276W\360#\337\253e\266\017\002\264\220\243\016@@v7\234(.\373\351\253tJ\231\377\334\001\334\324j~R\375\033\361\312aG\2234@\215\304'\035\301\341\365\004\324F\252\240\307c\342\271\313\0175\033)O)\273kyS\023q\203\267-\332f\331\262'T\372!\".Ht\354\202h\n\262H\265\306\n\037\350\273\330\177\374\240\017\025h\321\263\273(\241\325\230\332q\347\207P\354\270\231\207"
+	.string	"u8\354\353\350\226H\355\310;R\332\275%xU\355\320\305n\243\231\036 \030\371(\275\372@1\033\365z\377Gf\243l\025\217\212\224\317\371\267\313\220\0357CS;\236\260M"
+	.ascii	"_WT\225B\3452L>\321qx=\026\024%\353\244\323rzE\2335v\371\310"
+	.ascii	"\036\017N\321\264\313'g\205\034\217Q.\331\276p\"\027pwD\361i"
+	.ascii	"lx\311|\257r\036\2601|\206\f\270\273(>/\006\006\356\320|\257"
+	.ascii	"\237*\025\266\231l2\311\213\244\225L\366\315FN\035\373tw\327"
+	.ascii	"3\307\256\322\340q\177\275\355\247UZ\006\342\253\345\325\252"
+	.ascii	"6q\320`\005\305\344\204A\211\201\007\"n\225\300X1/\254\026\205"
+	.ascii	"\030\253\005\006\306\262\022\302DW\f\213\270\022\276\260\260"
+	.ascii	"\\\302\226\b\013K\020\370\005\343\022\303\f\257\227\030\242n"
+	.ascii	"\263\323\2359\365\006\322l\332\234\354\322 \177\343\347\236B"
+	.ascii	"\2335\037Xs\017\\\220Q\235:E\007\277\263\205\3330\370\335#4%"
+	.ascii	"\355\320%0\345\250\363Bt^\367\325L\0065 \200\002\221A\353\001"
+	.ascii	"CP\310\356\225\262\204c\246\213b\270\234VP\301\027.\256oG\316"
+	.ascii	"&\020\341\272p\306\240@j\222]o\201q\240\035\016m\213\201\024"
+	.ascii	"#Q%\372.U\331\307\275D\030\356]\321\354\237q\237whe\f\f\206\206"
+	.ascii	"!T\316\020\212\225\352\326\025\214\365\225\334\222\367\252%\256"
+	.ascii	"\247C\373\262\345u\036'\nO+\022\222\303\223m\315\025kW\026\347"
+	.ascii	"\032\243\306E\241"
+	.text
+	.section	.gnu.lto_displayCanvasSetColorInversion.3.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\037\001u\r"
+	.string	"\266Y]D"
+	.string	"s\224\016\363\275TT\3300J\203e\013\335\021\001j\332\017\222\303\026\320\0222\240Y\201->bC\020"
+	.string	"mF\350\260\023\330\tb\303\tP\2254J\353\002\334\004J,\264\260\267!\331\272\342I#\233H\231RH"
+	.string	"G"
+	.string	"I"
+	.string	"\332\243\303\207d\217\332A\262G\203\266\214\001\025"
+	.string	"7T+v\354\356\246%\016\036\323\004\375\277|\263\262B\035\013q\305@X/^\002V)\214\301\253E\304_\236\037V)\231\032\t\273\353\\Y\261\334\361\266)\330\346\354c\b\273\326\226\375\360\327\334\365g\232\326\230N,\375\315"
+	.string	"\022\005t\354\202\230\361\2611Q\006\n\333\347\330\035\226\021M\373\363"
+	.string	"|\330\341!\002\226\013\227\031\025\264\307\216j\344i\337\345)\300\273NN`\267%\003c7l`\221\252z\325\217\016G\276ZX1\324\244,\365\002\214\215T\362\260\235\341-H\332n\n\344\263\360`2\311\036S\023\330\033\256\302D\333]\220\017\343}\332\211G\377${\274vL\270Pr\306!4jl\366\260CT\352\b\373\330n\\W\342u\247\322H\363'\002\004\016\364\021q\34090!\200E\236/t*\205D\0268\2044\220|#n\373\274\3564\362\270\2554\n\2216\221\367m\236\0056\221t\336Vb2y\033'\334c\253-\307\0341(\232\202qR5S\247Z\201\212\242\254\t\025"
+	.ascii	"C\241\320\274Wj&\2341\275y\033J\3302\231\275\246\352\006\026"
+	.ascii	"\006-;\354^2v\200\275+\235\205\325\004\227\256\001ca\032\bup"
+	.ascii	"\\\033S\t9\245P{"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixel.4.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`m\001\315\016"
+	.string	"F\333cF\360\262&\035\020\333\214\241\2351\333-\273\035\371G\326_2\314\270\207a\313\242\261:G\375G\237\375\332\"r\252\270\021\016P\222=j\031\022\034\206\305s\260=\026kC\247B\272U\306\222w\232bE\020K\366\3362\245M"
+	.string	"Q"
+	.string	"L"
+	.string	"\273\341\211S\266O\207'\321>\267\217h\237\006\355\036\0068\004\370\231\201\001dw\271h\342\340eT\320\377\316Eh^\255\313\020\217r\304\206G6\340\345\222\nd7#\276s\365\360\222Q\005=\330]+\315\353\303=o[\202\355\224}\025\001\007\035\347\327\036\373\347T\253T\037"
+	.string	"\003\021%>vkf?\3533k\244\260\375\220-\372Q\212:\254\026\026v\344\324P\330>E9J\032\336\005x\034\337\220\004\326E\242C\317\356\236x\302\366i\"E6JW\373+\316\002|\f\346\005va8z\002\262\033\033\032\321+M\343\205\027<\\\032\3046\206\317Xm\273.\222\317\263\241{\321>5\"\2603\\\306\313\266\273$?F\313\267\241\370\364a\264\317\307\222\023\261\030\235\231d\210\216U!v\330\322X\302\276\334\335u\204\331\327\371\267\347<^\247\322\235&\353\032n\024\007\rP$\224\224\005\243\003\020\004\3704\372L.+\246S\005\226I\205\345S\241\270\317K\271\250<\024\267\2422\255\270\223\367q\243\004\356XR\036\327\322u\036\027\n\367r#\314\021@\370\304D\031\031\322-\202\242\026g\264F\233\314\304\226S3\r\035"
+	.ascii	"C\241\320\274Wj&\2341My\033C\330\372\230\275\231j\f\264\354\260"
+	.ascii	"\373\312\330\001\366\256t\026*+\270w\rh\262a\204(\034\34227\214"
+	.ascii	"\200p\3000\220\305P\303\0031\300\t>\325\3128\301S]9\245P{"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixelToStrokeColor.5.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`G\001\005\016"
+	.string	"f\332_E\360\262&\035 \370@\307\246\260\316q\350\327\354\250\357\243\213\201\343\257\277Or\023\3150\305 \304.\306\206\310\251\001#\034`\370-4\343\205\2658L\303\377e\365\376:\025\322\2552*\315\022%D\020K\366\2262\245I"
+	.string	"M"
+	.string	"H"
+	.ascii	"\331\243\277\033\300\036\263\213`\217\366l\036\377N\354qf:\274"
+	.ascii	"z\354\256\246&\356\035jz\376_\007\221Y"
+	.string	"\245\016A\\\241\b\r\215\236\001+\025d\320c#\342\257\347\314*&\023\004aw\2352\253\017w\274\355\t\266Q\354\207\b7?v\327\037a:5}\020L\005\016\004:v=\374\374X\236h#\205\355\207\330\241/\247U!{\f\2618\311\357/\274\337\370\006$\260*\0225;\273Kb\n\331\343\b\f\265N\236\366[\334\205w\327\313\013\354\262|vv?\022\233\00445\324\033\226j\001g\207*}l\253|\306\226\355\252F\276\214\r\030P\330c\252\002\273{\fT\266\273#\037FK\206\254\365\350\277`\217\327\003(\\0\371\343\324\031\221c\323\207\375\245RK\330\207\273\273V\226\375\234\037\364\250k\270K\03680\215JL\032\210\022D\020\340\222\250#\271\254\220J((\322\005\226\356d\322:.\305\345\304\231\264\225\023IE+q\235&Z\340\215%\205\323Z\266\215\323B\276=\\eY\302\n\036\030\215\201"
+	.string	"\022\244\230Fu\252G8h\312\001tj\262\307&\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetPixelToFillColor.6.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`G\001\r\016"
+	.string	"f\032`E\360\262&\035 Q\240j\223\203b#\330\227U\203&\r\021\210z\205\356\263\344\213\365\343\306\024\315.\306\206\310\251\001#\034`\370-4\343\205\2658L\303\377e\365\376:\025\322\255r\030\254\270U\342\211%{K\231RI"
+	.string	"M"
+	.string	"I"
+	.ascii	"\331\243\277\033\300\036\263\217`\217\366l\037\377N\354sl:\270"
+	.ascii	"|vWS\023\367\0165=\377\256\207\314\254R"
+	.string	"\207 \256p\244\306\306k\300J\005\031\274nl\356zzX\311d\202 \354\256sf\365\341\216\267=\301v\212\375\020\0018?\366\326\037a:5\375\020\254\265\003\201\216]\232\237 \333\023q\254\260}\021;$B'E\205\3541D\203\222\337cx\307q\016H`U$F\360\354n\211)d\217$0\244By\332w\361\027\336[0/\260\313\362\341\331\375J|\02257\324\033\226j!\247\207*\177\330^y\215-\333U\215|\032\0330\240\260\307T\005v\367\031\250lwG\276\f\227\f\231\212G\037\006{\274\036@\321\212\311\037\347\016\013\036\233@\354/\225Z\302>\334\335\265\262\354\353\374\240\007\250k\270M\03680\215LN\032\210\022D\020\340\222\250#\275\260\220J)(\322\205\226\356d\322:N\345\345\304\2314\226\023iE+q\235&Z\340\255E\205\323\\\266\215\323D\276=\\eY\002\214\236\030\225\201"
+	.string	"\022\244\230Fu\252I8h\312\001vZ\344\353&\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeWidth.7.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\035\001M\r"
+	.string	"\346\030[D"
+	.string	"\223\223\016\360\005Z\235\270B\232\366\303lt\t\024%\222\035\331F\211\260e'\266\212\363#5D\ry\020\205F\360\004\221\333\377\031\207\301\377_k\036{\b\177:\016B\362\b\335~\201U.\202\366\336R\246\024E"
+	.string	"G"
+	.string	"E"
+	.ascii	"\235xx}$\036\232\263y\274C\261_\315x\260\361\261\273\230\236"
+	.ascii	"8\367\247\311\371_\035@\f\312\364'\342"
+	.string	"\372Fd`\264\b\240NoA\213f\304W\317\017(\230\314\020\b\273\353\214A\205\270\341mO\260]\301>)\366k\376x\325\017_:5\375+\326\270Ar\263\013\"'\310\342\300\031*l_\304\356\364@\311\356-\270\327(x\005\366T\202\004\205\353\260\344ur\240<\355\2578\013\356*\227\033\330M\355\210\261\3331\360\311u\350\356\001-\032\031\031\352,\246^X\3518\345\017\333\244\277\310\256\335\323\307w\301!C)\036\246\"\260\267\263J\327\356~|\033\026\rW\212C\337%\036^\017\314\250^2\307\311\272\301\261\t\304\356L\251&\354\277\335]k*\033n\223\007\016D\037\223\223\006\036\222\b\003\034\362l\240\026\025P\310B\t\204ae\033\211\260MKi\031i\"Le\004\"a!m\303<\t\234\255\244h\030K\226i\230H\267\177\253)K\260\201\363\2420/@F\205\352T\227tP\223\005\260hd\027"
+	.ascii	"C\241\320\274Wj&\2341\035y\033@\330\352\230\275\222j\001\024"
+	.ascii	"\336a\342\221\261\003\354]\351\254\312&8s\rh\2061@\370N\215\202"
+	.ascii	"c|\252iq\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetLineOutlineType.8.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`'\001\245\r"
+	.string	"\206\331]E"
+	.string	"\221(\035\340{H\233\260\341\265K\276\320\315;\324Qj!\326\n<W\371\363\360M\333\234X\325\r\3114\016\335 3\026,\225\372\205\254\326\377\177\207\264\036!\024\220\226\327\037\305[\362d\371\"h\357\275eJ\001G"
+	.string	"H"
+	.string	"H"
+	.string	"\3379\363\022;\310\274\264g\343\370wb\337Z\341\341\205\307\356f\320\304\275G\250\236\377\326\001\254\250P\217\"\016#\bK\214\027\001U*2x\265\214x\353\372A\245\242\372\021aw\255+\252\020\267\274m\n\2663\330\037\005k\270\262\357\362\317\263~\031\325\n\325\307\346L\215\0041\273 jz\254\214\244\241\302\36676'\206D\277\273\360\356\262!\026\330\024\t\030\013\330eH\344\274 \271\332g\361\026\336Y(7\260\273\312!c\367k\340\021\354\322\001(\013p\355\320W\013\313\f\350m*\304\320\272\221\322\031\333\243\303l\330n\312\343\303\340\240\3414/\025*\260\273\273N\330\356z\374\027\223\t\226\342\322G\231\227\207\007P\260R\264\306\352\322ac\225\306\376P\nK\330\217\273\033\241\322\251B\210$*1\231l\033\213@x"
+	.string	"\362\210\2148\350 \2200\300\237N\247\235\220\264\317\205\223VR\352D\240\254\343B'\"\016\224\221D\332(\373p]\326Y\340\255\024\3422\323\266q\331\346\333\307\205+O\240\221I\201*1\200N(\241\025:\244\003\f\027"
+	.ascii	"C\241\320\274Wj&\2341\035y\033@\330\352\230\275\222j\001\024"
+	.ascii	"\336a\342\221\261\003\354]\351\254\312&8s\rh\2061@\370N\215\202"
+	.ascii	"c|\252iq\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasSetLineOutlineColor.9.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`(\001\225\r"
+	.string	"6\331\\E"
+	.string	"\221(\035p\"\224\204\r\257]\362U>[\350qn\360o\217\362\250\312\261\217\303\237\234X=\320G2\215C7\310b{s\330lBVU\265\016$\366\322\2569$\357\376G\032\203\236)\f%\215\354\275eJ\001F"
+	.string	"H"
+	.string	"G"
+	.string	"\347`\227\331A\260K{\266\215\177$\366-\025\031dhvW\203#\356=B\365\374\267\336\301\242B=z8\214 \253\027/\001\252TT\360z\t\361\326U\203jEu\363`w\255,*\016\267\274m\b\266)\330'\005\320\305~\314\217\235\365\313\250V\250~\266\0011\343\200kwCM\216\235\2212P\330\276\207\3159A\242\337Wx\217\261\020\007l\252\005&Bv\031\0229-$W\3730O\341\235\225r\002\273.40v\277\005\036\311.\375\005\256\017\372zY\305\200\236\230\302\t\255\032)\275a\233t\0273\333My\374\026\027*\234\260K\205\b\354\356,N\331\356z|\031\323If\342\322O\301.\017\013\224`\251h\215\325\325\201\306*\016\373C)\024a?\356\356:\334\034\315\222PI42\235\314\017\2138h"
+	.string	"\362\210\2140\350\030(\t\340O\247\333PJ\333G\302i\033\231t\"\220\326q!\024\021\007\322J\242\215\244}\270N\353$\3604\tq\232iNN\363\370\366\253\031\025\270\022\001(\006%\264B\207`\200(\177\004\030"
+	.ascii	"C\241\320\274Wj&\224i\021\206\201\026\366t\203v\3142I5\013\n"
+	.ascii	"\3570\361\310\330\001\366\256tVe\023\234\271\0064\303\030 |\247"
+	.ascii	"F\3011>\325\2648\311S]9\245P{"
+	.text
+	.section	.gnu.lto_displayCanvasClipToRect.10.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001-\017"
+	.string	"V\\fG\340\262(\035(A\021\324i\020\245\210l1{\025\004 \204h\2517\230w9\366\340 \353\235\272\355\351\210\3654\371V\313,,\261\355l\005\006\203\031\326\303(\242\nx\020\0350\247(#_2e\323\335\237\354\275eJ\001O"
+	.string	"T"
+	.string	"N"
+	.ascii	"5|v?\022\233\314K\177\037q\227\363\"\334\245[\366\216\1773{\233"
+	.ascii	"\036\017/z\354n\007M\274\365\b\265\345\177\347!X\314\365\030"
+	.ascii	"\3420\212\310xl\002b\257\270\300F\033\361\235\353\207X\214*\350"
+	.ascii	"\301\356Za1\020\267"
+	.string	"\274\355\b\266O\366q\004?\3505?\367\332/\243Z\241\372\"\220\n\033\007n\27327 \373#g\320\330\276\310\036\311\350\320\240\314\313Q\007\234\231\nAnd\023\346\345\b\217\023\375\356\242\365\032\323\210\003\366E\002\346\263\273$\2260/\023\304\221\034'W\373,\336\242\365\332\313\t\354\316\0026\232L\006\264\307)D\261\321\361R\037\266U\036\303\233\273\257\222\337\303\001\003\213\273T\210\300^\235\2075w\267\344\303h\3110Q\\\372/\334\345a\201\0235\030\275YsR\334X\375a\177.\205%\354\307\335]\303\231}\235?t\234\177\376&\026\256\341\254o\270K\0344@\225JL\030\220\f@\b\340\023ierY1\235(\260L\027XV)T\267R\245\270\244T\250n%eR\351N\252UGR`\217%E\325\265x\236\252\023}\373\270pf\257\370\201\20111DCpB\020\344\240\204V\350\270\"\240\313"
+	.ascii	"rh\032  \360\002\021:\325\001c(\004\367J=\241\3004\306\032\361"
+	.ascii	"\020\253\244\226\005m\030(\274ob\331v\260w\305fU%\203\027\316"
+	.ascii	"0\307\307cd\276F5'3F\206k\230Y\214\303#F'\370X+\242\344\311\225"
+	.ascii	"S\n\275\007"
+	.text
+	.section	.gnu.lto_displayCanvasClearRect.11.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\r\017"
+	.string	"\266\333dG\360\262&\035 \225G\350P\340\340\255}\222\216\032\324\341\376\250\202#_7\257\205\242\251F(\006\200n\325\026\221\223"
+	.string	"\213p\200\341?V\2336j\006\2363H\354\371\2577\251\220\256w\377/g\016\255\2334\262\367\226)\005M"
+	.string	"S"
+	.string	"K"
+	.string	"\033\222\330d\373t\370\002\332\347\366\021\355\323\240\355\343a\212=\f\207\007\031@v\227\213(\016^F\005\375\367\\$\343b]\216x\224#4\261\231"
+	.string	"WK2\230\335\220x\317\025\204+F5\004aw\2552.\021\367\274m\t\266Q\366y\004\241\343\374\332_\377\224j\215\352\217B7t \370\261\033\"h\310\002M\0336\266?\262I2\036\026(1\235\022\026`93\024\266OR\213\023\r\037\003<\216er\300\266L|\360\331]\022O\330>\025H\222\315\311\325\276\213\277"
+	.ascii	"\377z9\201\335\232\034>\033\3564\215(\260\036-\rb[\3455\272m"
+	.ascii	"\267e\362it\310\260\322>5&\260\277\307V\333\356\232\374\031-"
+	.ascii	"\032\266\025\237\376\213\366\371h@\305\013F\203\254;0v\254\n"
+	.ascii	"\261C\226\306\023\366\345\356\256c\215}\236_t\235\177{\316\037"
+	.ascii	"\027\276\341\253s\270K\0368H\231JL\032\224\016D\b`T\351;\271"
+	.ascii	"\254\234P\025V'\f,\237*\305}^\212\213\312Kq+\252\223\n\207\362"
+	.ascii	">\256\264\300\035K\212\307\265t\235\307\215\302\275\f\b&\306"
+	.ascii	"H\021\025\305-\206\242\026g\264F\313\235\211,\003\330\371\321"
+	.ascii	"\331\r\315O\f\" \360\002\021:\325\001c(\004\367J=\241\260\370"
+	.ascii	"\341\243\r\353!AI-\013\3320Px\337\304\262\355`\357\212\315\252"
+	.ascii	"J\006/\234a\216\217\307\310|\206\r\302\034\231\035\031\216ag"
+	.ascii	"1\034\236\030\235\340\213\255\210\222'WN)\364\036"
+	.text
+	.section	.gnu.lto_displayCanvasResetDrawingState.12.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"-\f"
+	.string	"\306\026TB\360R5\035 \351}q\025q\2060\022\355\202\327k\344L\251\3630\351\177Sq\215\315\343\367\233}|%\251\206\2126\222\016\333\363\353p\233\310\250\241\337g\336!\r5\237\022\256\374\034&mi\223-S\n?"
+	.string	"="
+	.string	"@"
+	.string	"\323\240m\362\321\304^\004\307\207\021\036\273\273\311\022\007\217I\005\375\207\274\242\022O\307F\\b\227\325\213\227"
+	.string	"1\304\030\274@H<\344\nBL\251R$\354\256U%\212\270\347mW\260m\301~\204>\266\273k\311\262\357\372\247T\253\252O\241\350\250\201 \307n\210\223\037[2e\244\260}\213M`5\341j_\305W\200w\231>`\227e\002cwl`\215\366\351\361\005\262O\355\227\354\0011\244l\331\026e*1\210\334\b\265\207\355\356#\"m7\334\370.<|\245\354Se\002{\303[\224\264\335\335\370,F\0344\024\237\276)\373\2744p\302\205\322\023+\311\f\033\253>\354\361\244\262\345\316@x\320\331d4\0160\007(\0040\007\363q$\020\307\271\320\201\313\020\372>\235\355\363<\244\217\327\331@\037N\303\306\361\276\r\263\300]\310\343m\243\256\3636\313\270\337Q\202\222)\254\242SZ\245\025\204\362d"
+	.string	"$4\364\005\262\n\023"
+	.ascii	"C\241\320\274Wj&\224i\021\206}\026\266n\203n\3142G\033\270C\347"
+	.ascii	"\036c1\330\273\322Y\325Lp\3412\340\267\232\"\356\362TMN\321\324"
+	.ascii	"\036"
+	.text
+	.section	.gnu.lto_displayCanvasDrawCharacter.13.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\270\001=\020"
+	.string	"&\236lG\340\322&\035\256\346\f5\036>E*\262[[F<WGST\236\307\025\331\034\020\317+\240\237O=\020\332z?\242\324\035\f?\243]\351`\230a\356\314\216\347\320\271\320\016\356;"
+	.string	"\221\002\315mlM\032![\312\224\002U"
+	.string	"["
+	.string	"T"
+	.string	"80\027\260k3\004\264\033\212\230\244\373\346\360\004\270o\335S\3347\203\266\216\207'\366:E3/\210v\327S\023\007\0375A\377?/\321\320b\036A\\c\252&F-"
+	.string	"m\026\023\324nD\374\347\271\201&\313$5\330]'\r\355\303\275\335\366\003\333'\366\215\002\244\343\374\\\246\225K\347\226\376\311\344\341FH\216\335\016G>Vh\243\241\302\366A\354\001\262U\364\301\300\303E\264J\030\347\001\337\363\222\250\235\311VP\350\276\241r\307\316\b\t\335\267Tm\225\341]\200\317q\215\210\332\031\t\016@\273+\342\b\335\267\0031ec\365\264\317\342-\300\007'\036\243\254\335\324\004\251Q\270\324\n:C\263\354a\373\365 \224nwV\342\003iHi\321\020\033\366\031-\335\356\226\3702\276\013]\212o>\f\367\355Z"
+	.string	"\005\216L\0369y\212pl\026\331aLj\t\373qw\327jc\337\3477}\347/=\347\357\336\363\0071\226\025X\374NZ\372\362\f\367\b\203\005\256\222\021\022\005*\003\016"
+	.ascii	"\270\245\212\261\\TX\255\t/,\013+\261\227\313\213}&.\257\317"
+	.ascii	"\345\251\274X)^\353\213y*\004\206\255\230|\036\013\f\366y \341"
+	.ascii	">\256\332\030\002MHFe\361\224&U-i\247\234:\325qCh\214I\252\372"
+	.ascii	"\231\037\001# \220\002\021\302\363C(D\367J9\341\320\364(\033"
+	.ascii	"\322m\275\334\333\256\335kL\353\336\3566\355P^\241\325\342*\317"
+	.ascii	"j,\005O\374a\242\214\335\246\320\3752\361\b\247\030\f_\177\224"
+	.ascii	"\227=\f\311\\\231\215'V`N\360\235V\004\222\247WN)\316\036"
+	.text
+	.section	.gnu.lto_displayCanvasDrawCharacterMask.14.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\344\001\345\020"
+	.string	"v_pF\340\322&\035\"\001(\317g\335\013\3628{\343:]\006\213#\320:3d\016\373\257\017\315\362\013)\013\005\307\305\177E\270\223\361]B\273\322\3010\303\334\231\035\317\241s\361\006\026\026\352\271\351\213\356\330\244\221\275\245L)Y"
+	.string	"`"
+	.string	"X"
+	.string	"=\177\341\272O\314\005\354\342$\025\355\312H|\262=Z\366\001\332\343v\224\366h\227\235t\231\316>\310\246&\210\307\356r\252\342\256CM\227\177\242\233l`2\207\"\256\020\025\033B\n"
+	.string	"{\301\005H<#N\364\004\001\243\311,=\330]\247\r\354\346\216\267\035\3016\213\235\b\002\177\351>\277\226i-\245SK_$\304D\016\0058vC\004\371\261G\321h\307\366O6*(\025\2078\344\264\320\340\"\005g\035\222X;\251\224\361\031\256\013\301\344\310\276hz,l\217#\231\002H\207\302\366\210*\221J\331a\270\376\343\033pd_(bE\273K\342\t\333\343\001\210\272I=\355\0075@"
+	.string	"\314H$\022O\254\206\272\245\245^\210\261\343\225=lc\270\215\326\266\373B\361\215>l\370\324\200\275\362\242o\333]\024\237\206\327m,\036\375\030\355\361J`\205\317L\006q\316b:6}\3302\231\324\034\373pw\327\212c\177\350?}\366\207\034\3507\375\347\337.\024\237KK\007\275N\245[E/\303Ja\356\3416q\320\200\205br\302\240\244"
+	.ascii	"\004\021\257J>\325\013\213jU\001F\245\322\362\265X\334\347\245"
+	.ascii	"\274\264<\026\307\322R\255p+\357\343J\022\270kI\3618\227\256"
+	.ascii	"\363\270\223l\017Wq,\341\304\321\214\322@\221<i\210\252\232t"
+	.ascii	"SM\235j\2701\225qIU\037' \240\002\021\302\363C(D\367J-\341\324"
+	.ascii	"ti6(\330\212\265\367^;\327H\353\266\335w\332\241\262\302?\213"
+	.ascii	"+1\253\303\024\334\261\207\2013\266\302\b(\fcp-\325\\]\021\316"
+	.ascii	"u\212\301\360uGw\331s\b\346\316l8\261\003{\202\257\266\"K\236"
+	.ascii	"]9\245\360{"
+	.text
+	.section	.gnu.lto_displayCanvasDrawString.15.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\233\001\235\017"
+	.string	"\366\\iH\340\262(\035`\002@\347\230yr\b0\251/\326\035\2479b\274\354\024\352\016\216\036>\273\260\360\233\254C\277\306\251s\310\350oS\354\037n#\201a\2141\025&\217\217^\211N1>\326\376\361\302\215_%\237\354\275eJ\001Q"
+	.string	"X"
+	.string	"P"
+	.string	"{\303\301\263\033\216\270\304\373tx\002\335\247w\221\356\3231;\307C\024{\033\233\007\033\036\273\373\305\023\217]F\215\371\317\271\210V\223]\212x\224\"\266\235\234\200\332L2\310\301\220x\316\365C\355E5\004aw\255\264Z\210{\336\266\004\333\030\354\377\004\237\371\273\343\376\331\251u\252?\002\020\343\263\340\306.\210\037A\3333i\254\260\375\221M\n:I\234\r:Lv\234\342\r\314@\310\316hZ\\"
+	.ascii	"\252\261U\360>I>'\r\377\"\366\031\327\220!;+A\343\331\335\021"
+	.ascii	"S\360>\023H\222\215\323\325~\314eb\307\265|\300\0060\266\031"
+	.ascii	"\321(\235F\023\032\240\231\366\260\275\272\f\024owf\362ctHY\351"
+	.ascii	">5\"\260Y\337Y1\3710^\032\274\335\275\212O\277\245\373|,\220"
+	.ascii	"\002\347\242?\254:,~V}\330\241L\243\t\373rw\327\361f\037\347"
+	.ascii	"\027\375\346\367^\363\207\002\340\253\305\222\340a\347p\223<"
+	.ascii	"p\2402\221\2244(\035\210\020\300\251\022\210bQA\245,\300P\031"
+	.ascii	"Z\340J\365\201\256\023\226\225K\365\251\254P)_\312\005~%\005"
+	.ascii	"f\265N\\\337\213\305r}\243p/7\336<A\246\307%\276H\020\025E/\206"
+	.ascii	"b\027g\264F\313\035\021e\006\321q\241\271  \240\002\031\302;"
+	.ascii	"c(\264{\245(\341\3104\006\033\207m\221\334\033\254\215)\274a"
+	.ascii	"bYv\264\267\272)\250\205R\330#\026\031&t\241\310e\002#\004\302"
+	.ascii	"\250\260\3330\2034\207\314\306\211\021\370\023|\276\025Y\362"
+	.ascii	"\354\312)\205\337\003"
+	.text
+	.section	.gnu.lto_displayCanvasDrawStringMask.16.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\307\001U\020"
+	.string	"F^mH\360\260(\035p\216l\f\235M\2061\223\2178\322\322,\307\334^\375<\375\314\251\021\235\035\220\371)i\005z\005\366\024\347\2432\343\337\fu{\350\003\317%\232\356\231\327* \332t8_h\224\275\005\212\366\244\221\275\367N)U"
+	.string	"]"
+	.string	"S"
+	.string	"6\225\007\330\255\315\300\355\216\"&\361^=^@\367\352=\244{5\314\256\361Qf\257#\323A\307\306\356~s\304a\247S\302\374\367\\\3242\213\235\206\370\244!4\0249"
+	.string	"3\031U\220\253yy\317\245\207\031\213\224!\007\273k\3312\003q\327\333\206`\233eK/\017\375\346\357n\373kHZv\322\367\030\271\200\221`\305\256KP\216\005\252,hl\277\303&\215\247z\313\020Cs\241\304\211\362h\240Q2s\232;/\002 +\303\261\251"
+	.string	"\223#b\202\367Jz9\311\361'`\277\361\017\005Y\031\314\007\334\356\212X\202\367z\200\222\\N\227\366mn\002\3662WC\363\231^ur\226\340\310\220\311\033\266-\334g\345\355\312L>\216\003\006\261{\225\323\200}r\025\242\267\273&?\205\013\364f^}\225\356\365s"
+	.ascii	"\t\333\212\f\262\274\375\304X\211\303\036cr\306\330\247\273\273"
+	.ascii	"\2365\373\267\177t\236_\364\235\337{\316\003\242\253\005\322"
+	.ascii	"\020d\201\251*\376\365\r\367H\003\006*\323\b\311\202R\201\007"
+	.ascii	"\037N\225DT\n\n*E\341\205b\265\304\225\352\023C\223\224U\250"
+	.ascii	"\372PV\250\223/\025\212_\t\201\301\226I\370\271@0\374:\306=\335"
+	.ascii	"Ys\204\027@+\223\205~\310\321\024Mo\206f7\353\264\234\246K\233"
+	.ascii	"1{\334Z\004$ \260\002\021B\363c(\264{\245(\341\310\264\006\033"
+	.ascii	"\311m\231\266w\271\215+\274c\342\233v\264w\305fu\227\202+\356"
+	.ascii	"0\344\307\266p\001\305a\f.t5\261+\"s\005\303Pa\227a\202l\256"
+	.ascii	"\314\006\023\033\370\023|\271\025Q\362\344\312)E\335\003"
+	.text
+	.section	.gnu.lto_displayCanvasMoveToPoint.17.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`G\001\005\016"
+	.string	"f\332_E"
+	.string	"\261&\035`\350C!aS\007\377?\244\315\034\237\372\022-0u\243\355\307\377\237\346\022\204\202Y\265E\250\274\250\02120\225\034\221\365\\\252\252'\321\362-\002W\303h8Q\306\343\200\361\210\030\304\222\275\245L)I"
+	.string	"M"
+	.string	"H"
+	.ascii	"\331\243\277\023\300\036\263\207`\217\366\354\032\377F\354]5"
+	.ascii	"\033\\=\273\253\251\210{\207\232\236\177\327=bV\251C\017W\030"
+	.ascii	"2\303\202G\300J"
+	.string	"\005\025\360\330\320\334\365\224Y\301d\202\034\354\2563f\325\341\216\267\r\301\366\211\375\017\0017?\366\326\037a:5}\217\217\036\030\trv9\374\354\330\235\350\242\306\366A\354\220\017\016\315\204\3541d\303$\277\243\360~\343\027p\300\252@\310\350\354\356\210%d\217\"0$\303\344i\337\304Oxo\271<\264\313\232\241\263\373\215\270$3-\324\033\226J!\005\rU\352\260\235\362\025[\266\253\032\371\257\f\026P\330c\352\001\273\273\nT\266\273#?\207\345BV\342\321w\301\036\257\005H\264^\362\307\371\272\021c\323\307\376R\251!\354\303\335]+\313>\316\017z\250c\270I\03200\215HJ\026\210\f<\b\340\222\250#\265\250\220J'(R\205\225\356d\322:\016\245\345\304\2314\225\023)E+q\235&B\340m\005\205\323X\266\215\323@\276=\\e9B\216\235\027\205\201\037\tRL\243:\325\"\0324e"
+	.string	"/\034\311c\023\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeLineToPoint.18.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`G\001\005\016"
+	.string	"f\332_F\020\221\223\016p&\020\304j\240L\f\337T\230\3377\232\316@\252D\017\253A\346n\237d\370\213\fQ\303\373\334\001\021dA\372\315?\233\364\002\200\0025\036{\322\334\f+\001\r\r\216\276P\267\306'\226\354\275eJ\001H"
+	.string	"L"
+	.string	"I"
+	.string	"\330\247\303\023\270>\261\207\\\237\376\354\234\2072{Uj\203J\307\356j\361\304\277\313\250\237\177\325?b\300\322%\210G\031r\222\301\022"
+	.ascii	"\232\244\002\326\f\211\253"
+	.string	"\256\034@\030\325\216\203\335\265\306\200\036\356y\333\020l\237\330\017\0214\377\365\324?\245Z\243\372\037\036\0217\022\264v;\264z,\316\244\241\302\366=vV\243Ff\002\366\231\331\230hx\027\337ilC\016XS\211\323\315\356\216X\002\366)\"\263\026&W\373+\316\342{\312\345\331.*\347f7\034qI\247\031\321\334\245\221\302\213\034&\335a;\345+\016\3335\201|\233\f\026H\327\247\306\003\266\367\030$lwA>\f\226\013X\212O\337\345\372|,\200\"\365\242-\353\n\304\261\312\303\016K\032M\330\227\273\273\216(\3735\177\347\001\244c\270I\0320\020\201HJ\026|\f<\b\340\320\307\333ZT\266\320\ti\253\260\342\215D\232\327\241\264\214:\221\2462\332R\264P\347i\037\004\346VP:\215\205\343:\315\023\356\345F\224#\214\300y\2110\022D;\361\2123Z\243E4\304\222\001\254>(k&\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeTriangle.19.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\362\001m\020"
+	.string	"\026^mH\320\262*\035 \031\202\343\332"
+	.string	"\347\256\306J\225v\021\205\020a\210\372\231\332m\341\352?\024\246a`\245\3264k\002\254\023\264\245\t\242\030\255Bz\200/\256\206\325`\373\354\314|\255\226>4\242L\323\n[\322\310&[\246\024U"
+	.string	"\\"
+	.string	"U"
+	.string	"9\227\227vq:vvG\022\243\300O\217\027\360}\202\027\371>=\263y|$\261\267\331Y\260\371\331\335P\216\370\354\236\324\231\377\335C07\332=\016\227\236H\214\316'\300\315\346\215\370\314\310|w\275p{Q\005-\330]+\314m\303=o\273\201\355\024[O\0017?\370\232\037t\232\377{\356\237\236Z\245\372!\243\0257Fz\354j\b\002d{&O\n\333\037\331%\023:\033\021@\344\304\200\320\001'\327\302p\203\002\005\374,\325j<\234\200\237\244\037\023\035\377bv\032\327\360Hk\013\221agwI\374"
+	.string	"\3744\340\221v\230\\\355\267\270\213\331\003\222f"
+	.ascii	":*\324g&f\206\364\353S\211\002#\207M}\234\306\013\334\265\245"
+	.ascii	"|\236\n\023\304\357Se\001;\366\035\021\334\335\224/\203\205\002"
+	.ascii	"x\342\323w\371>/\007\224\310\3254\210U\347\003\216\325\037\366"
+	.ascii	"HS)\302\276\267\273k\211\263\257\373G\317\371E\307\371C\017("
+	.ascii	"QQ2=\211z\222i\211\250%2\365IA\002V\352\204B`\"\300 \304+SL\325"
+	.ascii	"\242\242Z\235\210*\t+1\027+\214\301Z-.\030+Tq\251R\302\025,\026"
+	.ascii	"\232\016\370\265\322\202\205,\257\027,\034\215{o%\316\016X\364"
+	.ascii	"\324\344\213'\322\221\024\311\220\004%H~rJ\253\264\2672\001)"
+	.ascii	" \020\003\221\261m\003cP\250\356\225\362\204\343\2469mc1[\250"
+	.ascii	"\356\215n.\264n\263\313k\206`h\277\333T:\253\317\035\374\361"
+	.ascii	"\rs`\274F\346;l\220\346fvd\270\206\315rn`\215\314\367\250\346"
+	.ascii	"\226\33101\201;\301\247[\021H\236\270rJ1\366"
+	.text
+	.section	.gnu.lto_displayCanvasFillTriangle.20.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\362\001U\020"
+	.string	"\326\035lH\340\260*\035\360\203\031\241\022\345G\270(\337[i9\310>N \024(Ra\275&\315\325\341\036\301_\204\027\241\345Jei\315\243\204\273k>\034\3140O\361\007x\013\034\r\312\023`2\306\206\027\232\361K\032\331d\313\224\002T"
+	.string	"Z"
+	.string	"T"
+	.string	")\027\260k\233\241\333\035I>\201\237\036?\340\373\004\377\361}Zf\327\370HbO\263\203\201\346\306\356\206r\304e\367\244\312\374\347\034\304R\233\335\353p\351}\264\344z\002\324h^\202\036\030\227\347\\3\324VT?\rv\327\312R\343p\317\333~`\233\304VS\240\327\374\340q\377\3473\377\367\333?=\265J\365=D\273\030$\033\273\033v\350X\236\2713a\373\"{\004#\2673\201\305MN\002\316&\206\205\242\346e\344\004\356\203\b\3709\022\021\242\343U\310>\343\027\336hi 4\350v\227\344\b\340\347\001o\344!\344j?\3462\262\337\002.rf"
+	.string	"8)\264\007\246\305\205\264\353S9\262\202\006Mq\\\307\005\356\322P\376\356B\005\361\373Ti\300\206]'\202\273\213\362[\234X"
+	.ascii	"_>\375\224\357\363\222@\211\233\212\356\260\342\310\310X\315"
+	.ascii	"a\2173\225!\354{\273\273\2266\373\271_\364\233?t\233?'QO15\211"
+	.ascii	"j\212)\210\250 1\265\211\301\202\025\312tRP*\340\300\303\252"
+	.ascii	"\022,\205R\222R\211\210)\n&\260\326*\204\275X(\255\327*,i\245"
+	.ascii	"HB\325\013\026\226\020\330e\302z\205'.\327+\024\215{o\245\315"
+	.ascii	"\020txT\344\212\027R\221\fI\220\004\345G~rJ\253\264\267\001*"
+	.ascii	" \020\003\221\261m\003cP\250\356\225\362\204\343\2469mc1[\250"
+	.ascii	"\356\215n.\264n\263\313k\206`h\277\333T:\253\317\035\374\361"
+	.ascii	"\rs`\274F\346;l\220\346fvd\270\206\315rn`\215\314w\330 \315-"
+	.ascii	"\263ab\002w\202O\267\"\220<q\345\224b\354\001"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeTriangle.21.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\362\001]\020"
+	.string	"\326]lH\340\262(\035`\002\330mx\225.\007\r\275SavA"
+	.string	"\243\304\022\241\224\346\366.\030\250\372/\345\265?t=\re\303\270\216\302q\205\271\217m\230a\224\321\343\324\027\260\261X\006=:\f\bo\b\275-\371d\223-S\nT"
+	.string	"["
+	.string	"T"
+	.string	"/\027\260{\333\261\333\035K|\002?=~\300\367\t\236\344\373\264\314\326\3611\304\376&G\206\233\037\273\033J\020\227\335\223*\363\277s\221Lmv\257\303\245G2\243\363\tP\243y\t|hl\337\271j\250\305\250\206\032\354\256U\246\306\341\236\267\375\300\266\212\255\246\242\343\374\340m\376\320k\376\357\270\177zj\225\352\207\220x\324(\335\330\335\020\004\264=\223\247\204\355\223\354\021\f\272\237\t@\271\030\022|\344\344X8pL\244\320\260\031\201\002~\212\2748\321\361)d\2571\fodi\036l\273\335-q\004\360\363\200'\262\342\344j\377\304Q\310\216\013693"
+	.string	"\235\031\352C3\323B\332\365\251LQ\361CS w\341\002wi(\237\347B\005\361\373Ti\300\206}'\202\273\213\362Y\264X"
+	.ascii	"I|\372/\337\347%\001\0218\030\r\262\352\310\260\261\032\304\036"
+	.ascii	"g*?\330\367vw-o\366u?\351\271\177\364\234?'QO15\211j\212\251"
+	.ascii	"\211\250&1\265\211\301\202\025\312tRP*\340 \304\252\022,\345"
+	.ascii	"\262\222R\241\210)\n,\260\326*\204\275X.\255\327*\\i\245TB\325"
+	.ascii	"\013\026\226\020\330\305\302z\205-.\327+$\215{o\345\315\020z"
+	.ascii	"\364\300\310\030o\244$9\222\"\t\312\220\374\344\224Vio\003* "
+	.ascii	"\020\003\221\261m\003cP\250\356\225\362\204\343\2469mc1[\250"
+	.ascii	"\356\215n.\264n\263\313k\206`h\277\333T:\253\317\035\374\361"
+	.ascii	"\rs`\274F\346;l\220\346fvd\270\206\315rn`\215\314w\330 \315-"
+	.ascii	"\263ab\002w\202O\267\"\220<q\345\224b\354\001"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeRect.22.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\005\017"
+	.string	"\026\\eG\360\260(\035\342\377\003+G\224o6dz\237\265y\214\021\261\017\027\0307c\231\027\3211\330\337\2733\342Gd\245!\020d\343{z\332r\204\026\331M0C\020g%'Z/\234/\032\271c\356\212'\215\354\275eJ\001N"
+	.string	"S"
+	.string	"M"
+	.ascii	":\273\241\207A\266O\2077\240}n\357\320>\r\3325\036\276\354kz"
+	.ascii	">\324\330\330].\2268x\031\025\364\217\363P\313\265\272\024\361"
+	.ascii	"(;^9\263\001.\226d0\223i9\316\025\204kE\025\004aw\255-W"
+	.string	"\210{\336\266\004\333'\3733\002\247\371A\237\371\265\307\376)\325\032\325\027\211r\304\340vvY~p,\317|\021c\373\"{t\342&F\004\306\346\345\202\013\315\253\302\3669j\t\321\360*\300\317\030\206$\260,\227\226\316\356z\230\302\366\251@\216XB\256\366Q<\005\370X\312\013\354\302v\002:\223y\271\210\3564\215\"+h\260\264\3076\311[t\333.\253\344\263\360\240A\245}jL`\177\317Qm\273[\362e'\0336\230O?E\373|<`\"\246\242?V\331\r\031\253>v\270\322H\302\276\334\335u\204\331\277\371C\267\371\267\030\316\341\252w\270?\0368@\225>@\032\220\020D\020\340\023\3513\241\224\230N\026T\246\f&_\n\305}\336\bJ\312Cq%)\023\tw\362>\216\264\300\235\311\210\307\235t\235\307\211\302\275\334\b\363\204\037\036\225\270\"\001h(n\021\024\2658\2435Z\356\210\270r"
+	.ascii	"\231O! \360\002\021\272yc(\004\367J=\341\3004Fl\034\267E\332"
+	.ascii	"\336\2406\\\341m\023\313\330\201\275+4\253\252\024\274p\2069"
+	.ascii	">\036#\363\0316\bsdvd8\206\235\305pxbt\202/\266\"J\236\\9\245"
+	.ascii	"\320{"
+	.text
+	.section	.gnu.lto_displayCanvasFillRect.23.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\035\017"
+	.string	"\026\034fG\340\262(\035\300\002(\250\323 \332\001\345r<6\2151\006\242\005\303\372\270B\206\376\177\217}e\027\351\320\257q\352\214\rx\306\223/\255F\373 F!\352D\247\307Q\017\242\003\346\224z`|\240\356y\322\310\336[\246\024O"
+	.string	"T"
+	.string	"N"
+	.string	"=\273a\211O\266O\207/\240}n'\321>\255\262\205<d\261\267\361\241C\r\"\273\333\305\025W]FU\371\337y\210\246\265\272\024\361(I\\<3\256\305\222\013f6%\276s\005\321\232Q\0059\330]+M+\304=o\033\202m\223\375\037\001\307\371A\277\371\265\303\376)\325\032\325\027q&z\240\354\330\2559bdeS\007\f\333\027\331\334\217\316\013\225!9(*"
+	.string	"\301\251\231\260}r\262\024\r?C\365\033\373\310\001\313J\341\241gwK,a\373L 9\237\224\253\375\030\227\241:,\346\004v_<\002:\263q\345\210\3664\215*4\202\260\264\210m\226\343\360\266]\026\311\217q\300\220\322>5\"\260\301\363\244\266\335%\3717^2l.>\375\030\355\363\321@\013\230\214\036\261\306F\370X\375\261\303\225F\025\366\345\356\256\343\313\276\316\037z\316\277\005\026\256\341\251o\270M\032\240\234H&'\fF\007\036\b\260i\004\226`ZJ&\n\251\322\005\027\020u\352\300o\005\006\365\235\272\026T\211\2453}`7R`\317e\345\353^<\357\353D\341^n|9\302\t\231L\234\221"
+	.ascii	"4\024\267\b\212Z\234\321\032-\227D\\9@\314\025! \360\002\021"
+	.ascii	"\272yc(\004\367J=\341\3004Fl\034\267E\332\336\2406\\\341m\023"
+	.ascii	"\313\330\201\275+4\253\252\024\274p\2069>\036#\363\0316\bsdv"
+	.ascii	"d8\206\235\305pxbt\202/\266\"J\236\\9\245\320{"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeRect.24.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\035\017"
+	.string	"\026\034fG\360\262&\035 i\341\250X\340\334\316\023\241Q"
+	.string	"g\351##Y\213\220\344\2522Vu\b\346q\215r1\266\262C\205\032\341"
+	.string	"\303\177\2546m\324\ft\347\200\272|w\033\222\n\351\272\317\226\344A\326\250I#{o\231RO"
+	.string	"T"
+	.string	"N"
+	.string	"A\273\341\210K\266O\207'\240}n\027\321>\315\262{<L\261\2371\303A\206\217\335\355\"\212\263.\243\262\374\373|$\363j]\206x\224\"4?3\356\345\222\nf7\"\356s\355\360\212Q\0255\330]\253\314\013\304=o\373\201m\224}\035\001\337\371E\327\371\265\307\376)\325\032\325'q.p\230"
+	.ascii	"\355~\030\n\262B\323\206\215\355\223l.\247\007\007\245\005O\r"
+	.ascii	"\005\233\035\022\022\266O\356\304\211\206\317a]\3077\244\200"
+	.ascii	"u\225\360\020\264\273#\216\260}\"\220\334\210\223\253\375\027"
+	.ascii	"\207\301z\354\345\003va<\002:\273\241\251\021\355i\032Qb\354"
+	.ascii	"p\351\017\333*\007\362\266]\227\311\227m\270\260\322>5\036\260"
+	.ascii	"\301\377\254\266\3355\3714Z0l5\237\376\213\366\371X@E\fF\207"
+	.ascii	"\254\262\0259V\201\330aK\243\t\373rw\327\021f\277\347\037\235"
+	.ascii	"\347\337\002\025\236\341\253k\270IL\030\244L$%\013J\006\034\004"
+	.ascii	"0\252\004\236\\VN\250\t\253\223\005\026P\225\352\300/\305E\365"
+	.ascii	"\245\272\025\325I\245C}`WJ`\217%\345\353Z<\357\353H\341^n\204"
+	.ascii	"\031\002\216\020L\214\221!:\212[\024E-\316h\215\226;\023[\006"
+	.ascii	" c\021! \360\002\021\272yc(\004\367J=\341\3004Fl\034\267E\332"
+	.ascii	"\336\2406\\\341m\023\313\330\201\275+4\253\252\024\274p\2069"
+	.ascii	">\036#\363\0316\bsdvd8\206\235\305pxbt\202/\266\"J\236\\9\245"
+	.ascii	"\320{"
+	.text
+	.section	.gnu.lto_displayCanvasStrokeEllipseInRect.25.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\025\017"
+	.string	"\026\334eG\340\262(\035\"\211\200\347\375\030W0\032\326k\226\323"
+	.string	"@\210\226\006\216\001\351\332\300\007\257\246pT\257\201\352i\362\255\016x\306\223/\255F\373 F!\352Dg\177\001\017\242\003\346\224z`|\262\375X\362\311\336[\246\024N"
+	.string	"T"
+	.string	"N"
+	.ascii	"<\273!\211M\270O\207\037\260}r\037\331>\335\262}<D\261\317!!"
+	.ascii	"#\003hw\273x\342\255\313\250-\377:\027\315\300\\\227 \036\345"
+	.ascii	"\b\315N\255\004{\311\004\265\032\021\327\271v\200\305\250\206"
+	.ascii	"\034\354\256u\006\366\341\236\267\r\301v\312\376\216\277\371"
+	.ascii	"C\267\371\267\313\376)\325\032\325\037\225p\3744\310\331\365"
+	.ascii	"\020$d}\246\r\026\266?\262K2\263\031\312\020\234\026\025~\334"
+	.ascii	"\250\230\300}\222z\234hx\030\255\333\270G\006\330W\211\021<\273"
+	.ascii	"Kb\t\334\347\001I\3729\271\332w\361\027\255\313^.`7\006\024Z"
+	.ascii	"\253\241\251\021\355m\032Qb\360x)\020\333*\247\341q\273\257\223"
+	.ascii	"O\343\200\201\265}j4`\203\337aq\273{\362g\264d\340V|\372/\333"
+	.ascii	"\347#\201\0242\030\r\262\322n\350X\rb\207.\215&\354\313\335]"
+	.ascii	"\307\230\375\331/:\316\317\005\026\256\341\254o\270K\030,P\235"
+	.ascii	"JL\024\230\n< 9e\002Q.+\250\024\005\026\352\002\013\270Ru\340"
+	.ascii	"\227\342\262\372T\335\312\n\245\322\245>\2603!\260\307\222\362"
+	.ascii	"u-\236\367u\243p/7\306\034!\207\017L\214\221\"*\212\\\f\305-"
+	.ascii	"\316h\215\226\033\"\272\f\200\326\023! \360\002\021\272yc(\004"
+	.ascii	"\367J=\341\3004Fl\034\267E\332\336\2406\\\341m\023\313\330\201"
+	.ascii	"\275+4\253\252\024\274p\2069>\036#\363\0316\bsdvd8\206\235\305"
+	.ascii	"pxbt\202/\266\"J\236\\9\245\320{"
+	.text
+	.section	.gnu.lto_displayCanvasFillEllipseInRect.26.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\r\017"
+	.string	"\026\234eG\340\262(\035 5D\220C\303\3442\250\344\264\305\245Z\021\352\005\315\024K\346\264\343H/\247p\274\331@\r\253\372\316\017x\306\223/\255F\373 F!\352Dg\177\001\017\242\003\346\224z`|\272\276(\371d\357-S\nN"
+	.string	"S"
+	.string	"N"
+	.string	"<\273!\211M\266O\207'\240}n\037\321>\r\332>\017i\3661Rx\200\001dw\2718s\3602*\350_\347!\231\326\352R\304\243\034q\355\314DZ,\251`fC\342:\327\017\255\030U\320\203\335\265\312\264B\334\363\266#\330>\331\327\021\217\375\240\337\374\332a\377\224j\215\352\213D|\340p\360\263\013\342g\310\366L\0335\266/\262G3r`(1\234\032\013+b4\024\266\317\221\212\023\r\357\002\374\215oH\001\313*\341\342\331]\022O\330>\021\310\321\314\311\325>\213\267"
+	.string	"\017{\371\200\335\227O:\263q\325\210\3564\215(/v\2604\210m\225\323\350\266]V\311\227u\310\240\322>5\036\260\277\357\250\266\335-\3712Z4l(>\375\027\355\363\261\300\t\030\214\376Xe<r\254\n\261\303\225F\023\366\345\356\256\343\313~\316\037:\316\277\005\027\276\341\252s\270K\0320@\225JL\026\220\f@\030\371D\372L.+\246S\005\225\t\003\313\227Bq\237\227\342\222\362P\334J\312\244\302\235\274\217#%p\307\222\342q-]\347q\242p/7\276,\341G\017L\214\221"
+	.ascii	"4\024\267\b\212Z\234\321\032-wD\\9\200\254G! \360\002\021\272"
+	.ascii	"yc(\004\367J=\341\3004Fl\034\267E\332\336\2406\\\341m\023\313"
+	.ascii	"\330\201\275+4\253\252\024\274p\2069>\036#\363\0316\bsdvd8\206"
+	.ascii	"\235\305pxbt\202/\266\"J\236\\9\245\320{"
+	.text
+	.section	.gnu.lto_displayCanvasFillStrokeEllipseInRect.27.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\232\001\r\017"
+	.string	"V\334eF\340\262(\035`r"
+	.string	"\3579\005f\215\220\332l\201\306\030\003\331\r\217k\366\276\177<\310\337\214\363\317\177\350z\232|\253e\026\226\330v\266\002\203\301:\214\262(D\325\360\024\0350\247\324\003\343\357o\353\357F\366\3362\245O"
+	.string	"S"
+	.string	"N"
+	.ascii	"=:\273\237\210I\346\245\277\027\340.\347C\270K\267l\037\377V"
+	.ascii	"\354i\314>\314\340\331\335\016\252x\353\021j\313\377\315A\260"
+	.ascii	"\230\353\021\3460\206\304\324l\001b\257\270\300&c\3427W\020\261"
+	.ascii	"\027\325\017\204\335\265\302b\"ny\333\022l\237\354\357\b\377"
+	.ascii	"\3473?w\332/\243Z\241\372!\00109\036\374\330\rq\353\331\035y"
+	.ascii	"\343\205\355\207\354\321\b\233\232\t\254fva^\216\\4.*\314K\021"
+	.ascii	"O\211~\217\321\372\214q\304\001\373BqBgwELa^&\210\242\036%W\373"
+	.ascii	"0>k\235\326r\002\273\2626\231\030\033\320\036\247\320D\006\217"
+	.ascii	"\227\002\261\215\362\034o\356\276J>\216\007\r,\356R!\002{\365"
+	.ascii	"\032k\356n\311\257\261\262a\266\270\364[\270\313C\003,h.z\263"
+	.ascii	"\342\334t\254\006\261?\227\302\024\366\343\356\256\241\314\276"
+	.ascii	"\315\017z\315?O\023\030\316\341\254w\270G\0344@\225FH\030\220"
+	.ascii	"\016D\030\371DZ\231XRL'\013,S\006\225U\n\325\255T',)\025\252"
+	.ascii	"KI\231P\272\223j\325\221\024\330S9Qu+\236\247\352B\337>.\224"
+	.ascii	"y\002\211\035\027\370\022\001(\bN\370\201\034\224\320\n\035\267"
+	.ascii	"\004tY\224\023\323  \360\002\021\272yc(\004\367J=\341\3004Fl"
+	.ascii	"\034\267E\332\336\2406\\\341m\023\313\330\201\275+4\253\252\024"
+	.ascii	"\274p\2069>\036#\363\0316\bsdv\300F\314w\034\0361:\301\307Z\021"
+	.ascii	"%O\256\234R\350="
+	.text
+	.section	.gnu.lto_displayCanvasCtmReset.28.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"]\f"
+	.string	"&\027VD"
+	.string	"s\233\016\360\005tJ\200\272S\201OB\347\001\200\316\003!\301\342G`\240Y}\303\322.S\240\327`"
+	.string	"\300\302&D\334"
+	.string	"\343\375\301_\332\325\373\246\367 h\364fNdT\033JG=~\177\332D\312\224\002A"
+	.string	">"
+	.string	"D"
+	.string	"\327\243=\233\307C\024\373\031.\037Z|\354n\246'\356\335\322\364\374\263\\\223\002\236n\215\270Z\035\025\227U"
+	.string	"\360\263\024\254R$\316\362\004\001\242df\"\354\2563\005\024q\307\333\246`\333\202\375\007\001\251+\366\255\335]+\312\276\352\217\232\316L?#\200E\016\b=vC\304\004Y\230hc\205\355ol\316\r\tO\373-\356\302\273\312\344\003vQ8h\354\206\013\f\302\036\035\236\300\365\210\275\023/&r\225R\251\241\272b[\344J\305\020c\307\227?loo\021\301v\277\220/\303CWr=\246\036\2607\034F\t\266\273!\377\305\b\007L\305\243or=^\013\244P\235d\214\363\245\204\216M vx\n\3768h0\n}@\f<\006&"
+	.string	"\260\310\323i$&Mt\241\203\226!\244+\215\262\216#\221\224\270Qf*i\0322\021\327e\236\004\336BH\\6\262m\\\266\t\367\326*\312\025R0'\212bi2\252S\215\340\323\2239\001\022"
+	.ascii	"C\241\320\274Wj&\2341\375x6\274\332\332\230\275\216\266u\207"
+	.ascii	"\372=\306\016\260w\245\263\252\231\340\302e\300o5E\334\345\251"
+	.ascii	"\232\234\242\251="
+	.text
+	.section	.gnu.lto_displayCanvasCtmSet.29.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\370\001]\020"
+	.string	"F\336lG\360\260(\035p\216\314^\342F\212\342\n\210\033s\315s\037\351\377'\237t\"k\343U\243C\316_<n|\005\366\302\341{\033\220\017/+\307'26\263\314\272N\273\321\310\307\027\246G\2477,\364\177\311'\233\310\235RU"
+	.string	"["
+	.string	"U"
+	.string	"/(\037\260{\323\311\355\216!6}\237\036O\300\373\374\016\342}:f\343\370Xb\017Cg\303\013\035\273\013*\211\307\336\251\214\371\2779\250f\223\275\373p\355@Vlx"
+	.ascii	"\330h\235\002\236\026\226\337\\\252\330fR~\036\354\256e\315\346"
+	.ascii	"\341\236\267\035\301\366\313\226a?\3503\377w\231\377\363\230"
+	.ascii	"\337\373\313?;i\251\322\377\b\220\243\341\300\306n\207\236\036"
+	.ascii	"\2733sT\330\276\310\036\301\330\344h\255\250\231Ar\202&\306\005"
+	.ascii	"\0213)T dBT\370>G5\0219\036&\366\030\343:\001\2532\343\220\333"
+	.ascii	"\335\020O\370>\021t\242\036\221K\373-\356\022{\335\262\250\314"
+	.ascii	"#\234\213\344iY\301Q\263<\251\026\\\334\240\311\035\266\305\313"
+	.ascii	"`}\273\264\223\237\243\001\003\314\373\224z\3409\330\267\273"
+	.ascii	"'\037g\222\341C\361\351\243x\237\327\002&^Rd\217%\216E\215\225"
+	.ascii	"<\354Q&u\204\375nw\327z\263o\363\213^\363\207N\023\241I\324\222"
+	.ascii	"I\3240\024\265\024\212\032\226D-\225Du\330\200\201\352\024\232"
+	.ascii	"\026\220\f@\370p\212\364B\235\224\240R\024`(\222\326k\245\002"
+	.ascii	"_\256\221\223\225K\005\226\254P\"\230r\275@R\002\263Z#.\320\204"
+	.ascii	"\305r\201\242q\337\255\336,\001g'Eg]H\2124\244 \375\364\243\236"
+	.ascii	"N\265T\007*  \003\221\261mcP\210\357\225\342\204\303\2469dci"
+	.ascii	"[(\366F7\227Z\267\331\235\327\216\357*\354 >W\365\231\226?vl"
+	.ascii	"\016\214\327\310|\206\tbNfF\204c\230,\347\004\306H>\303\004a"
+	.ascii	"\016\231\r\023\033\270\023|\272\025Y\362\374\225S\212\270\007"
+	.text
+	.section	.gnu.lto_displayCanvasCtmTranslate.30.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`I\001\025\016"
+	.string	"\206Z`F\020\221\223\016p&\200\306\313\371\355\241\262\335\037\377\3070Ju\004-\320\266=\021\336\021kGWk\215\032\336\347\016h!\013\322o\376\331\224\004P"
+	.string	"j\374\352\223\346f\330\001\264\022\264I\261\316\030\203X\262\367\226)\005H"
+	.string	"L"
+	.string	"I"
+	.ascii	"\331\247\303\033\300>\263\207`\237\006\355\034\017e\3666/\016"
+	.ascii	"+\035\273\273E\022\007/\243\202\376W\377xA\225.A<\312\220\230"
+	.ascii	"\027.\001\250\223\\\340\232\021\361\325\025"
+	.string	"\006eR\355@\330]\353\013\352\303=o[\202m\316~\2104?v\325?\245Z\243\372\037\003j\330x\200\263\353!\247\307\266f\214\023\266\257\331\332\253F\346$\373\324Z&\032^\005x\032\263$\201\2051u\270\331\335\021S\310>E\244&\303\344j\037\305S\200W\265\274\300n\n\307\315n8\342\22210\242;Lc\205\025\257\223\356\260\235r\027]\266{\372\370-4\\ a\237\032\023\330\337Y\220\262\335\375\3706#\f\231\211O\277\005\373|<PB\345\2429V\326\214\033\253<\354\260\244q\204}\271\273\353\230\262_\363w\036\244\221f\030\251I\0344\b}HJ\030x\020D\b`\220\347\343XT8\320\t\211\263\260\362\211B\333\347\241\260\210\274\320\246\"\342R6\220\367m\036\005\356VP\274m\324u\336\246\205{\2711\345\t8-\227h\222 \332\211X\234\321\032-\262!\226\f\200EC]3\001\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasCtmScale.31.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`I\001\r\016"
+	.string	"\206\032`F"
+	.string	"\223\223\016\270\325$\331\313\r\322z\3139\356\211*@\351\"\016}O+\306'\237\036\213C\005n\215\032\362\204\207\363\341\t\322\020\037k8#iW\357\325BS\370\323\351a\"\016e[\335z\214A,\331{\313\224\002H"
+	.string	"L"
+	.string	"I"
+	.ascii	"\330\247\303\033\270>\261\213\\\237\006m\035\017K\354mr8\254"
+	.ascii	"x\354\256\026I\034\274\214\n\372_\035\344\204\"]~x\224\"22Z\002"
+	.ascii	"P&\271\2405\023\342\253"
+	.string	"k\f\252\244\352\201\260\273\326\023\312\303=o[\202\355\315>\2104\377u\325?\245Z\243\372 \003tn<\250\261\333aGgq&\215\024\266\237\331YX#\002\005\373\314T\234h\370\026\340i\314\222\0046\246t\272\331]\022S\300>Gdv\342\344j\177\305Y\200W\275\274\300n\312\306\315nHb\22323\242\271Kc\005\0279L\332\303\266\312cp\330\256\t\344\303\320p\341\273>5&\260\275\277\370\260\335\005\3716-\0300\024\237\376\313\365\371x\300\204\nFw\254\254\0358V}\330!I\343\b\373rw\3271e\277\346\367<\237\247\031<u\211\203\006\"P\211\t\203\017\202\b\001\034\372x\233\313\312\026B\3716\013,\336H\244y]\212\313\250\023i+\243ME\013u\236\366Q`\216%\245\323Z8\256\323\262p/7\246<\341\007\016L,\311\020\365\304+\316h\215\036\331\020I\006\300\312\321\326L\031"
+	.ascii	"C\241\320\274Wj&\2341=y\033B\330\372\230\275\226j\f\264\356\260"
+	.ascii	";\312\330\001\366\256tV\013+\270u\rx0C\201a \213\241\206\007"
+	.ascii	"b\200\023|\252\025q\222\247\272rJ\241\366"
+	.text
+	.section	.gnu.lto_displayCanvasCtmRotate.32.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\036\001]\r"
+	.string	"V\031\\D\020\221\223\016p&\200*4\220\f8\375\335\275\341\372\211\f\030B\226\212\007\364U\3326\212\331y\326\250\341\3758\340\207,h\277\361kl>@\021<\354ao\354\337\260\003h%h3(\217a\220J\366\2262\245G"
+	.string	"G"
+	.string	"F"
+	.ascii	"\337\023\\\217\330?\256G{v\216\177*\3663!@\310\350\330]MS\334"
+	.ascii	";\324\364\374\257\036\200\005E:,q\205\037"
+	.string	".3Z\005P&\350\240\005\363\362\325\363\204*e\002\220\260\273N\026\024\211;\3366\005\333\030\354\213\0021\377u\325\037a:5}\f\301\213\215\n4\273#nz\254Md\265\260\375\314\316ZH\362;\f\3571\246\201\006\366T:\325\354n\210/`\217 0\023A\362\264\357\342/\274\253T~`7U\243f\367\013\361\b\366\3500.4\324\333\225\252a\205\303\224;l\233|f\303vM\035_\206\007\016\243\3531\225\201\335=\306\b\333\335\216/\203\322\001c\361\350\253\\\217W\005+T+y\343d\265\334\330\344a\177\244T\024\366\341\356\2565e?\334-\022\001\002\250#2\362\200\263`\002\001\1778\235'E\344\371d\030y6\234t!\220\326q%)!\016\244\211B\036\023\355\303u\032\247\201\267\223\022NC\3316N\313\276=\\M\331\302\t\233\025-A\001yiT\247\032\344\203\222<\200e\"[\001\026"
+	.ascii	"C\241\320\274Wj&\2341\035y\033@\330\352\230\275\222j\001\024"
+	.ascii	"\336a\342\221\261\003\354]\351\254\314&8s\rx\2061\201\030\340"
+	.ascii	"\004\237jE\234\344\251\256\234R\250="
+	.text
+	.section	.gnu.lto_displayCanvasContextPush.33.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"U\f"
+	.string	"&\327UD"
+	.string	"s\233\016\360\005U\332"
+	.string	"u\021"
+	.string	"\035\324'f\200\362)\3749\365#\220\266\3417AAv(\320k0"
+	.string	"`a\023\"n\200\361\376\340/YeiG{\0204z3'2\252\215.\373<>}\332D\312\224\002A"
+	.string	">"
+	.string	"C"
+	.ascii	"\327\243=\233\307C\023{\032+ ^|"
+	.string	"\354n\246%\356\335\322\364\374\273\\\243\002\232n\215\270Z\034\226\032+\001\340g-X\241H\334\345\031\002L\311\314D\330]\247\n(\342\216\267M\301\366\005\373\020\002\251-\366\255\335]\353\311~\352\217\232\316L?C`\005\216\n3vWb\202,LT\245\260\375\215\035\322C\302\323~\213\273\360\236:\371\200\335\223\016\033\273!\003\177\260G\207/p=b\347\004*\025\271B\261\334Pm\261=r\245f\210\261\343\313\037\266\267\277\214`\273\037\310\227\361\2413\271\036S\021\330\034\016\303\004\333]\220\377\202\244\003\206\342\321?\271\036\257\006N\244P2\306\251B\345\330\004b\207\246\366<p \002y>\r:\007&\004p\250\323i%%-\204\301\203\246A\244#\211\262\216\033\225\2208QV\"i\033\262\020\327e\035\005\336DF\\F\262m\\\266\t\367\326\352\311\026X\300\240h\212\245\311\250Nu\202OM\006\020\022"
+	.ascii	"C\241\320\274Wj&\2341\375x6\274\332\332\230\275\216\266u\207"
+	.ascii	"\372=\306\016\260w\245\263\252\231\340\302e\300o5E\334\345\251"
+	.ascii	"\232\234\242\251="
+	.text
+	.section	.gnu.lto_displayCanvasContextPop.34.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"U\f"
+	.string	"&\327UD"
+	.string	"s\233\016\360\005(%@\375x\262g\342\3412\003\224\007B-\227%\205\202W\337\260\264\313\024\3505\030"
+	.string	"\260\260\t\0217\300x\177\360\227\254\262\264\243=\b\032\275\231\023\031\325F\227}\036\237>m\"eJ\001A"
+	.string	">"
+	.string	"C"
+	.ascii	"\327\243=\273\307C\024{\031&@\274\370"
+	.string	"\330\335LO\334\273\245\351\371w\271F\0054\335\"q\2658+3T\002\300\317Z\240j)q\227g\b0%3\023aw\235*\340\210;\3366\005\333\027\354C\b\251,\366\255\335]\353\311>\352\217\232\316L?C\300\206\216\n\253]\021\253 \033\023S+l\177c\207\340\220\360\264\317\342-\274\243N>`\367\224\203\306n\310\300\037\354\321\341\013\\\217\3309\001\251\032\251jY\201Qe\261=r\245f\200\301\343\313\037\266\267\277\214`\273\037\310\217\361\2413\271\036S\021\330\034\376\302\004\333]\220\357\202\244\003\246\342\321?\271\036\257\006R\240Pr\345L\301\354\330\004b\207\246\366<p \002y>\r:\007&\004p\250\323i%%-\204\301\203\246A\244#\211\262\216\033\225\2208QV\"i\033\262\020\327e\035\005\336DF\\F\262m\\\266\t\367\326\352\311\026n\304\240h\212\245\311\250Nu\202OM\006\020\022"
+	.ascii	"C\241\320\274Wj&\2341\375x6\274\332\332\230\275\216\266u\207"
+	.ascii	"\372=\306\016\260w\245\263\252\231\340\302e\300o5E\334\345\251"
+	.ascii	"\232\234\242\251="
+	.text
+	.section	.gnu.lto_displayCanvasSetStrokeAndFillColor.part.0.37.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\361\002\325\024"
+	.string	"f$\202J\300\020)\035\200\220/\220\030\2500C!\013\342\315w\207\035R\t\341H\222\201`\276\275p*\317$\272\311\007\263j\373[\354\377\204\335\204\372\3725\374\365\0214\3738\264y^"
+	.string	""
+	.string	"\215SX\374\023\273\374^\327\203x\262\311\336)\005g"
+	.string	"q"
+	.string	"l"
+	.ascii	"=\271\373\334>`\327&\212h\267T\360\352\023\361\325\345\013\204"
+	.ascii	"\257\342A\302W\373-l\343l\247\2278K\343\234\355$\"\023@\211C"
+	.ascii	"\020\324\356\216\2574\305s\007\351\2549\377\274\003\230\331\301"
+	.ascii	"\034\2343\273\020\247 HM\257I\300\216\004\0234\351\220\370\321"
+	.ascii	"\247\207]\314\234\004^=\034\354\256E\021wx\333\021l\273l\332"
+	.ascii	"\n\276\332\257GT\263U\237a;\f?\306e\214\354\260\330]U\217E\256"
+	.ascii	"\226\314\321\321\263\035\350\3454\342\013\033<O\037\002w\304"
+	.ascii	"j\311\236\322\323n\211\3405\004\307\220\355>7\332\001\002\r\236"
+	.ascii	"\247\013\331\246\317\303\331*\237\227\263U\306\225\273\323A\241"
+	.ascii	"\363A\276\213\377\344\016\364\002\256\226D\321CA|e\201\270\373"
+	.ascii	"\334D\312\005A\023\202\2032\347K\237\347\001I\0320\320\302WJ"
+	.ascii	"\rx\3455h\342\356\266|\244\r2?\347\026\276N\032\242\242G7w\370"
+	.ascii	"G\227P\202i\215>\241\346\006H_D\357\373\217i\247\324Y\272)u\230"
+	.ascii	"oI7\245&\2751\255\340\356\256\251\215\375\240\037\364\230\246"
+	.ascii	"\341\364|\371_<\311\324\356\207\035S{\242\376V\370D?\252\375"
+	.ascii	"n4\262\003UdTTK\352\371\204\0023\231\212\354Um\322\200AJ\313"
+	.ascii	"\344dA\t\311\203\017\277Jh.\027\026\327\253\302\213K\245\205"
+	.ascii	"\026K\031i3\230Kl\2262\262\304\\+\343kF\033K\016X\326\002\233"
+	.ascii	"\215\031d\262\331\250\262=\017.\265qEZ\322\321\030\337\317{\375"
+	.ascii	"\201\037\023\244\247\246\324,\031\nc\230\t&\372\331\244S\343"
+	.ascii	"\243\364\306v,\244\324\302O\016rF]\270RL\334%[~B\250QL\245\210"
+	.ascii	"S(\230\221@d\264\005-\034\220\002\031\243\272\r\021\2009du\222"
+	.ascii	"\322\036\007\343\243\352eQ\365g\276\304\004IbR\366\236\001c^"
+	.ascii	"\337\177\207\253\013\246\345 P:\231\035\325\276\241\2659}\035"
+	.ascii	"V\360Y}\032/\371\33660\310\341\307Yf\350\220\342\\`40 \036&1"
+	.ascii	"\034\034\323\021\352\016\350\301x\020\253\2604d\007\276x\354"
+	.ascii	"w5U\237\026DZ\300\233\256 \262\303$\231\200\303{\347\302E\020"
+	.ascii	"\034\235\317\243\201\324\373\236\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\345\003\365\b"
+	.string	"\244\r\341\004"
+	.string	""
+	.string	""
+	.string	"\002%\177.\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\224\202\202\200 "
+	.string	"\177/\272\220\202\002\001\1770\002\1771\003\1772\004\1773\005\1774\006\1775\007\1776\b\1777\t\1778\n\1779\013\177:\f\177;\r\177<\016\177=\017\177>\020\177?\021\177@\022\177A\023\177B\024\177C\025\177D\026\177E\027\177F\030\177G\031\177H\032\177I\033\177J\034\177K\035\177L\036\177M\037\177N \177O!\177P\"\177Q\004"
+	.string	"\321\231\263\346\002\001\225\007\004\001\325\001\004\002\003\003"
+	.string	"\260\346\314\231\001\001\202\n\004\003\003\326\307\302\353"
+	.string	"\001\365\007\004\004\365\001\004\005\006\007\b\t\n\013\f\r\016\365\001\004\017\020\325\001\004\021\022\023\024\025\026\027\030\031\032\033\034\035\036\037 !\"#"
+	.ascii	"H\250\021\220\005\356\266\322\236\001\340\225\016\0210\004\024"
+	.ascii	"\001\261\005EX\361\001\320K\223\226\026-\367J\217J\313\352n\027"
+	.ascii	"\022\242'Q\242\325&i\007M\240\200\002\t\024H\240\200\002\252"
+	.ascii	"\361\002\356\352i@V\001"
+	.text
+	.section	.gnu.lto_.refs.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"(\265/\375`\254,\025\234"
+	.string	"\332\361\2205K \022\352\205\003\302\220\2456\333\217\327\232\325\300P\033\301\bGe\214[\351\375\350\366\354\350\272\243\257\234\006\227\231\231d\204\245\036Sr\256\f"
+	.string	""
+	.ascii	"\252\322\214\231\231\231\232*Peg\352\252\372\306\f\257y3Se\226"
+	.ascii	"\334&R\246\224\002\344\0028\003J\003ZV$\307\336\213\331A\204"
+	.ascii	"\207\333_o\354=;}\263\223\372\353\214V\026\037\212}\032\211\333"
+	.ascii	"\251`\017k\202\333\357\260W\325\f\241,\323\f\177\306\376:\024"
+	.ascii	"\031\275/'c\177\375\211\277\315\364x\374\212\374\353\204\275"
+	.ascii	"\3672\245\225C\356\257;\351=\f\031\267\326\344\257\017\366\036"
+	.ascii	"\213\037\023,\253\275\353\204w\366\327\003\373\335\216\300+\214"
+	.ascii	"\224\300-\254\277~m\201T\344\322\372\353L\374m\006\354\220o\310"
+	.ascii	"_\377[&\031\371z\374\353K\b\341\246\256\374u\277\266\303e\205"
+	.ascii	"T\311\277\336\327vJ\266,\274\037"
+	.string	"\376:\337\023\366\253\023a\275\231G52\250\277\256\347\3426\005\360\371\327\217\034Q\027\247\374u\274\266\233\251c{\322\345\031{\242\327,\351\\\274\320\206$\375u\272%\025\027\343\344_\227\363\267\013\365\013\024l;\037\25333\362\267q`\270\233wx\267\3657\002\nZ\nL\316h9\347\001\224\222Wt\222\177{\261[0\240~\315\375u4'b\243G\323\f\227s\225\246E\255\r\311\372\327\352rUfT\177[\006\334\356\226G\314D\221,\006\375m\0260\f\211\266LA\313\340~\374\331k\226/\255\272\315\022{\315\222\006?!O\005h\260\203\t\f\272[JW\242\002\033\004\220\240\273\231\364D\254\350n\300n\317qE\301\206\201\37457E\r4\007\020\315\024 \024S\"\352E\204\321\267\334\232 (,3O\345\013\324\262t\367\r\035)\343\375\332\036&'\201$\013\350\366\034N\220P\321\355P\335~\247"
+	.string	"\t\307\n\272\235\007\0275\214\033t;\016\347\240c\272\255aw\343\320p\355\322m\t\223\024\005\273\033\251\241 \002\016\225Ps\b\243\333\225b\030&\351v\027\272\375\347\205\024yK\204\267\333\217\224\2031t{\021\216`N\267\353p\243a\272\255\233S\313t\3331\032"
+	.ascii	"I\350\366\350\017/\241\246_\272\355Y\367\027\320\375&\272\277"
+	.ascii	"D\367\013\320\375\"\272\337\246\373k\272\237\246\373g\272?\246"
+	.ascii	"\373_\272\277\245\373Y\272_\331\375\266\373\275\333'\273]\262"
+	.ascii	"\333!\273\335\261\333\031\273}\261\333\251t\273b\267#v\373a\267"
+	.ascii	"\033v{a\267\023v\373`\267\013v{`\267\367u;`\267\377u\273_\267"
+	.ascii	"\357u\273^\267\347u\373\221n\307\353\366\273n\267\353\366\272"
+	.ascii	"n\247\353\366\271n\227\353v#\335\036\327\355p\335^\244\333\337"
+	.ascii	"\272}\252\333\203t7\n\335N\242\333g\272=\205\356N\321\3352\272"
+	.ascii	"\275\246\333#\350v\033\335N\244\333\255\335\356\326\355m\335"
+	.ascii	"\316\326\355\325n_\353v\265nO\353v\264n?\353\366!\335n\326\355"
+	.ascii	"e\335.\244\333\251\272\235\254\333\307\272]Gw\303\350n\277\356"
+	.ascii	"N`rrr\262\033/\351f\371\321m\242&zR\326'\262\303\372\346\206"
+	.ascii	":\226\374\375PR\242\242\033\232\375\222g\362M\220\302\004=\212"
+	.ascii	"\033VPe\241\370sRD\2652*~\305%\277\212\300\375\334\324\241\024"
+	.ascii	"7<K\364)nX\006\375\350\017u\355!\371\276(*^\305%\301<\211\377"
+	.ascii	"\260\026\366\374!\2570"
+	.string	"\352w\275\231\0175_\3638\013\356\020\325\312\006\235\274\024\026UD\2652\350\023\375\025W\230\004n\036W5\371\331%\177\330\335\371\236\021\027\364&n\350\327(\0209\310--\354\207\234}\233_\243\252\231I\202DD\265\262\234\253,\254\323'\376\034\317\3214\023A\201\212lZ#\"Tc\316\325\021\013\2604Q\213\352\022\341\266R\t\246\371(e\033n\245\030ne\017\334J\251\224CL\210\004Ia\224\376\303e\342\225R\365\357\033J\245\200\210\n\213\230\362\252\376~\341\377\223\207\322_\370\2040A\325/\2749\377\270\243\220qG\241\334\373\361\343\266\274\255,\302}\0331\210&/\310\202\247#O\352\177\350\027\364\303$\213^\177?\360\376DJ\235\375\375k\357\001\251;\334\372\373\200\275\027\263tDdv\021q_>|\342\022\351\343k\321A-3R\322\3177\224c)\312\337O\342oO%+^*\212\336\254"
+	.string	"\221a\b\364\362\\\240"
+	.string	"\357\032\217\364\347\265\\uM\301\203\371\002\302\304x\307\024)y\370\367\355\226\323#\270)U\335\215\316\311\271X\271\313*4\322/g\255X\371!\316\337~\340\342Rl\202i\272Bw\244\n\356j!n\013\210\373\216\256\355\331\354W\340\223\254\257\366\263q\025:\201\375\3755\177k)\202\312\005\376}\265\246(ZB\177?\255\367\232\200=\321^\314\245\007\244\226\334\032\356\253\331\227\275L\007\025\245/\244\277\354>\366\210\246\375}2(\222+\332\337\037\0232z2\376\375 \275\207\235\344"
+	.ascii	"\241\374\375\037/\366\364;\003\362\367\277\036\314\331R|X\277"
+	.ascii	"\017\017\244\225?\325\\\315\271:\363]\222qn\177A\270\315\362"
+	.ascii	"-\031nO\261\264\223\223\236b\371^<p\367sm\271\354\211\275Y\361"
+	.ascii	"\321\277%\302X\236\226\277\311\034>\177x\374\375\036\036\305"
+	.ascii	"\253\352\360\357g}\2202E\254\277\317\343\251\324\300\254\264"
+	.ascii	"\225\302\235x\365S\0268\254*]o\325?]\0069*\222\370\367\253Z\354"
+	.ascii	"\376\242\324\376\376\016\313HF\204\344\357\353@\363\263j\372"
+	.ascii	"\373NO\025\247\3057G\365SgM=\274\2523-x\220cN\177\037\352\243"
+	.ascii	"\372\245\376\311>\333^j\202i\316?/5\023\231\363\317\214;\nw\024"
+	.ascii	"w\b\026\230\221\345m\333\204\177\351\233\340\242R\203L\237c\351"
+	.ascii	"6\215\363a\222\351\245\rX9\341\372\373J,z\320\352U\020\177\321"
+	.ascii	"\0339\333'u\377\321#\365m\233fk\316\325\030\373\363\364g\367"
+	.ascii	"\367\204\333,\257\212\345\214\253X\366\353\341~8\354\371\207"
+	.ascii	"^(\306.*\t\221\017\352\027\202SK\253\373\373@\376\346?\2241\241"
+	.ascii	"\362\367\177\310p\277\026v\351OIF\312\\\315\310\222\376zd\314"
+	.ascii	"\243\023\264\352_\177\3647\227||/\267\314\331\253S%i\216\222"
+	.ascii	"\252\020Q\205\201Mb\225\264\355\263~}/\207\2379?\253Y\311\345"
+	.ascii	"\302&\233\032sT\224\212\032\037\212,k\270Y\234p\367w/3\223\262"
+	.ascii	"\232\357\200`\226\335\336\256\214q\353\006t\367\315\271\273m"
+	.ascii	"w\023\200B\316\317*aU\226}T\250*}\"\177\316\317\251\224&Z\265"
+	.ascii	"R\245\321 *\224G\255\324\245\250\225\372\374\350\222\237%i\246"
+	.ascii	">q\236.\341\350O\316\326i^z\251Rs\256R\237\270\372#\315\321*"
+	.ascii	"uJ\023\r\242.y\324\232\2459(KCDs^\312V\252\242G3U\032\265N\227"
+	.ascii	"hr\320Y\224(\343\343\2223\271\026I{F\203r\022\211\262\240\251"
+	.ascii	"\364\032\255N\375.\347'\334P\226Rs\3261Eq\027\364\365\274\003"
+	.ascii	"\272&\261D\005U\237.\205\004\2045m\251\002\345k4\310\324\306"
+	.ascii	"P\316O2\322\004O\177B3\320\323s\036\252Js\006\232\302\0205\365"
+	.ascii	"&Pi\216\311A?G@XS\230!\240)4\007\271\362\245\250\025k\312\002"
+	.ascii	"\357\315\032\226\201\252O\017\313O\250Rl}Vs4\347\354Tb\030\353"
+	.ascii	"\006\033\353\350\240B\215I\177Q$\036!\f\274\3168\021r\204L22"
+	.ascii	"\246\320\307_\325\325\324\241\202Y"
+	.string	"M\\[\266\2611\020jVVE\356\311\252\215\255.z\030\364\027&l\207S\216\277\356U\b'D/\357\237N~b}|J\264\244\f\t\271\223!?\250\277\202U\253\345\025\204\370R\016\253V \037\337\376V\377G\335\233\364\255.\306Lk-\215\210\357\301<eE\263\325\003_|x\003\nssI\226\"\350^\265\355\352\245N\261L\222\215\313\021\312\032\221\352\233\265P\tZ\211Z\37361=F\2658\030 E\240yin\270\204\302\3658\204\246\207T\305\204w\326\247\224\336eY\207\fa0\310\266+\263&\337CIQ\264L\312\325\362\352[\022\362sJ\300\247'O\310\354X\240\025\361\356\257u\204r\352)j\013\255G\037\016"
+	.ascii	"\024\025\201\3141\021\b\217\027\223Q\346<\205\f\263`6\353\305"
+	.ascii	"\374\352c\003\264\307D[\365\303b\311\330\234\253$\303\036\311"
+	.ascii	"\202Y+\213\345\327\250\f\206D&\372`\303"
+	.string	"\254\230\005b\203\330/g\263`\336\326\266\313z\201Y-\313\025\302.#\252)\243\364\tR\221\271\275d\202}\204\327p\331-\250\247\2541;U}qJ[\202e}\374\024\031\307- \327$\270\227w\270\227Fp/\335\260\235\332+g3a\2511W\314\256@\236\341v\023K\237t\023\313^ra\025n\263\354\266;t0P\004\204\314\352\260T\317\007\310W\364\327NUG,\245tE\303\376\366\262\t\267\004\216\350\206C\250\217\365\\[i\277xET+\033D\fCT+\353\266P\177\305.\275\243\315a\233\354\363\033m\221\035\262R\366\310\n\331\037\033\375G\233m\320G\332\250\237|\306\207\264J6\311B\255\324\002Y&\213d\215^\322>\275\025K\344l\326\351\247\364S\371*=\242\232sP\316\271\035\315\225x \234\035\022\337\213\333\363\373!%57\342urE\236\356\003<;/^\274\250ya\203"
+	.string	"\b'@"
+	.string	"!\306\t#<\360"
+	.string	"\306\213"
+	.string	"^\210(\240\304\211\030\004\304\020\240D\343\030"
+	.string	"\301\003\316\236\033\236\007b(\3208\315\036\246\016\263\006\356\tZ8\320\302\205\r,\355\342\002\b.\200`\331..`\301\342\202\026,p\267`aE\240\301\261d\3424q0i,kP:m\324h2m,\2353\\\2608u\2307\2309\037\320h\366\324"
+	.string	"\341l\033\b\364\016\017\263g\205sg\247g\305\013\317\216\213\317\ffN\f72X\260q2}`h\350p`\223\263\263\323\301\f\245\316NSg\004'\323\207\006\333\344\3444A\330\221\221\303\264\241\251\202\r'\215f\013N\246\217\fs\006\223\347\006\031!\230:\315\034'\r)8\231>5;2x\23298=7\314\034\234\226\0305t\2325\334\364x\320C\023\343\234\321\202\205S\247I\003\356a:qnznl\274\240q\351\271\261\201s\2313zvrv^"
+	.string	"\340\234\241\263\323t\362\244\300ss\303\331\354\240\304\f>7'\324\320i\3668c\324p\323CC\006\307\316\215\027\247NsG\205\035\031L\235\246\t4>20\314\234\032:7\315\036\031!|\\\260\214O\r\215\023\207\tCg\004\246\017O3'\347\003\346\f;=\316\03099M\031D8\231>L\030N\346\222\351\274\311\361\321\271\351\221q\303\211\003\303\314\271\301\211q\303\211\203\231\316\033\347\016\214\033N\234\026\247\317\214\0273\035\201\005.h\264\210@\002\b\036 \321\026X\360\342\304\n(\204\200q\036\360\271\301\241s\2033\343\206\233\034\036\237&\215\025>=L\034\315\036\032+t\23277V\340\364\370\254x\340"
+	.ascii	"\033>4\250\340\264\201\351\324\331\301yi\227:+\253\302\252wC"
+	.ascii	"\3721\363\204]\234\354\330\341pJJ\275\2439<I\354r\205\212\312"
+	.ascii	"\351\n\2432\\t{qN\360\313\225\224\224\343\331\023!\256;\374\""
+	.ascii	"\007\005"
+	.string	"\345zP`~T)\035\222\341\227E''\277\372\341g[\224#\025\303\320\345\310\341p\204s7O\254*s\204a\004\227\226\322\\)2\251\213\020\307\354PR\372ZN\335\240R8\034\223\004\t\311*\346\210\220.P\013\313,\031\031E\275\214I\315\351\370\3331FXF\216\210\210\220hieMR]\3043BP\250CyT\032M\3255\376\341\2315!!Ck\204\360-H\032\006\261\004\004\264\004\3469wX\205\205A\b\336\347}z$]K\222#wU\3766\f\024\323\214MN\252\315\350\bj3\362\004\323\374IJ\276\020\330[\005\005\361a\207C\bAB\376\324\307\214u\252hK\f\207\230st\374-)e\024\246\260\245\277\375B\205k\242\214\214_6XtW\244+.\022\327\340-.>\033\244]zRd\024\210\001P\242B\305\341\242\270\034AJ\002\327\206\001\310RT\374\233\311J\033\032\354\302"
+	.string	""
+	.string	"\"\":\224:\245\334\224\244\311\277\355\222\003\333H\035\036\276\334\232K=\375\254\246`\233!\206\206\237Wv\325\244(\"\035\3016~\205\205\317\267%\303c\355*\222\f\333<\022\022NY%\213\222L\177\273\305\t\007@\035\034|!\f\"\003\t\032\205\311\300=]\245\246\340"
+	.string	"\214\b\276\240Ge\213X\235l*\303JVR\226\226\340"
+	.string	"$\003;\360\017q>|\301\323\213d\222\206E\254\001\332+\340\\L\337\017\252*\026\026q\375\263L\376\322\302\254^\017G\256\277\215\241\270\003\203\300\250BQ-\007\323\306\030\232\221\021\221$I\322\030b\f\ba\244\224T^\007\022"
+	.string	"\023%\033\202\222\021\304\220\210\210(HQ\222J\353\031\334\206\247\270\213\027E,\255"
+	.string	"/\241\217T\203\353\177\0341\364\2729\013\261\234\n\310+\375\2234\345\037\221\\\330(\r\005:n\0137(a\354\221\027q\355\301\360R|\266qs\230@a\350*N\202F\325\250\033\221\214\266e@Z2\344\330W\020\n\263\320\257\257\227\b\354\276\t\274\021\003 *\301\013,&\321\367\234\036\342\236^\262\215%i\307(\334P\b\276\271\036\221g\241\323\333Q\301#A\203\273\203]\207\273\003\005\030\016R\220\n\363\016\317\220\300\024J\317\242`\313=1"
+	.string	"K[\253\031G`\340\215@/\311\342\274\366\"\376\260\337\001nDC\3052\362\354q\023\340%\n_BZ\0341\207\tDv\231\037\326T\362f\2203\342\331:J\245\212\020\032`bA\230A\314Q\347\2724\352Y\265\023\007\225\307m\220\333\330\325\024\340\214a\207c`\256\221\037\303\270\364s\203\271\340}\177\306\031|\222\2119\b\203\247\311Kb\005\230E\033\304\205\321\367s"
+	.ascii	"\224\313\373\262Iy|\374\207\315\377>b\230m\016\300\312\341\371"
+	.ascii	"\005\305\254M\304v\225>\027i\2204+\243\217\331r\3117\257\211"
+	.ascii	"\252\033RZ\300O/\272\013\357G\276\355\t\313:|\351\324\236mP\230"
+	.ascii	"\331/\236\227\361\216^\341h_\356\234E\364\303\r\377\026G\204"
+	.ascii	"c\027DB\263l\202\273\376\220\346\240\376\006n\372ku@<\273\"\222"
+	.ascii	"2Pqn\367\257DB\025\270L\276\377\302\361\177\321\2738\227\331"
+	.ascii	"\237\2673T\352\354\357yo\310\373\221o\247\213M\377ny\271\376"
+	.ascii	"ux\335\037\266\376\213\356\346\272\241?\f\347i\343\243\311\373"
+	.ascii	"\230\254yN\313\001\347\226\331]\035W\002V/\314\253\262\247\355"
+	.ascii	">#\271B\230\243\256\276C(\320Ln9\312\022\2614\241\336\261*\352"
+	.ascii	"\376\017mw\352=\221s\r\245$P\325\021>\277/\215\210\242\006kf"
+	.ascii	";gAo\007\235"
+	.string	"Eeh\225\022S\342!\206\334#\250B-\264jU\"h\230c;\\y\357\216\211V\312\2213\226\372\034cg\2101\\\323\214\311\re\345\032\376\363\n2(\307\036j\236\313D\314\310pk\224\013\215\337\276&2\256\220?\227\230\301vD\231\272\214>d\2010\202\337\fc\b\326\207H\246ee\354\342\343S\372&\224\b\371\t\252r\363\361\324\363\003q\275\003\354\315S~iA\341\216\263 \036\216;\325\036\350L\324\3175\374\347\305\022\240\227\236\005\024\206\3452\215\343\3341\371\017\214\016\033\272\204\373|\310\227\\\200\247\324\354\302x@\032\327O\270\270\023@7\222\341\004S\316\035\235\037\353z\234\311\267h\215\357\r>X\346\360'\"\020A\032\364\2007N\356<\335\030\016"
+	.ascii	"e\035\213'\364@\033\311h\377\221\235\001\bI\377\272\353\316\351"
+	.ascii	"9\212\202\207\224\254\304\343\336?)\324\026t\230\374\240\320"
+	.ascii	"\237i\313\007\226+$\347\222\217/\275\371\214\215\302\261\214"
+	.ascii	"\377\034@\242\241\266\312\265\246\364\367\2476z\034\2265\bz\215"
+	.ascii	"\245\233\240\004\315\267T\210\027\342\332\221\371\353=\356\002"
+	.ascii	"j6\204\266\365\005/4\202\023=iW\253\275\207\277\220\264\367p"
+	.ascii	"\273wp\334G!\225\200\331q\034\243\343\007\235\310dy\3342z\031"
+	.ascii	"\205]q}4\2374\277?5\033\302\256\252\365t\332'l\215\264\036\217"
+	.ascii	".\357L\273n\373\001XL6\237s\243+#\224g\301\310\370\031\366\016"
+	.ascii	"\322\311B\312\210\004#\204\306\316\t\002!\270\260\344Nx\315\036"
+	.ascii	"\3528V f\2150\\>'s\206\017\375\234\247\031\b\204\261X'\201\231"
+	.ascii	"`\t\2306x\002\317\013\035y\317%>\026p"
+	.string	"\0339+\003\262\234e\355\337*\321\234\255\365\237\250=h)p\177\003\324\275\224\327*Uf\034I\021\300\313\026\244M<\352\006\227\221\005\033\216L\n\210%<\b l*\275HZ\217.'1\003$x\210\3706\2641X\315`\260P\334S\303'\305\240pXUZ\273%AD\344\371\313\272$\375\242O\251%&\333\214\204/A_pE\fz4t\350\303\033\335\n\324^*N\223\006\233\317\370`\324\200[\275\340\023\275244\3620\225\035ER\324\275d\275\330\212\332\233\316\314\fa\215\272eB\207\023\177o\372\024\325\270\270\3506\330\224P\221\326\026\216B\371wqs\242D\275JU\2729\334\r\034hO\006,\273\304lC\322\273%\210\245J\320\253v]l;\032\"&\264\221\021\032\246\333`\221O\306\270\2430\232+\275\270\213>o\326S\207H\274\310\334\251\270\370jf\025N\263_\310\377\343T\005\006"
+	.ascii	":0i\"\267\256\016\362\026G\310\265q\310\r\232\375\327\321\314"
+	.ascii	"\001a\3206\341+\216\2404\254\213*\357\327\372i\221\215k R\314"
+	.ascii	"\rE%\003\030\237?w\356\200+\343\273XzU7\366\361p^\352\327\275"
+	.ascii	"\375\337b\340\274c`\312Bng\r\273\267\002QK\330\255@\245\356\022"
+	.ascii	"Z\242\234\365%\202\376\226;\252\020\302\317\235\330\264\366\033"
+	.ascii	"\b\243\302\251\350\363j\201\271\224\277\357\213\234\375\fG\310"
+	.ascii	"\241\326\333\270\346\037\016\2667$\374\005zlwzx\373\303\332\377"
+	.ascii	"3\262\350\374\325\313.O|\350\353\314\006z\370\205\223\327\034"
+	.ascii	"\221/B\247\221\371\372O\375\023\312a\326\025\312\320\rF\254>"
+	.ascii	"\277T\377c\322\351\007\374T\326\037\217[\340\374\343\355g\317"
+	.ascii	"\220M\024\276\251W\361\326W\334k0\227W\3275\311\375\235r?\372"
+	.ascii	"\003q=\277\354\245)\\Kp\337\231\352\266fw\212\327_GE\363\016"
+	.ascii	"\311\257E\334\276\r\356\362\314\310\033\276w.vo\261_1\026\242"
+	.ascii	"Z\371.\034Jq\263|\372\373\336R\367\356\345\224\200B\355r\001"
+	.ascii	"\265\002"
+	.text
+	.section	.gnu.lto_.symtab.e7fb0e44f5a85a8c,"e",@progbits
+	.string	"displayCanvasSetStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\001"
+	.string	""
+	.string	"displayCanvasSetFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"displayCanvasSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"displayCanvasSetColorInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"displayCanvasSetPixel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"displayCanvasSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"displayCanvasSetPixelToFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"displayCanvasSetStrokeWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"displayCanvasSetLineOutlineType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"displayCanvasSetLineOutlineColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"displayCanvasClipToRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\001"
+	.string	""
+	.string	"displayCanvasClearRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"displayCanvasResetDrawingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"displayCanvasDrawCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\001"
+	.string	""
+	.string	"displayCanvasDrawCharacterMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"displayCanvasDrawString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\001"
+	.string	""
+	.string	"displayCanvasDrawStringMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"displayCanvasMoveToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"displayCanvasStrokeLineToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"displayCanvasStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"displayCanvasFillTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"displayCanvasFillStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"displayCanvasStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"displayCanvasFillRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"displayCanvasFillStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"displayCanvasStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"displayCanvasFillEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"displayCanvasFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"displayCanvasCtmReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"displayCanvasCtmSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"displayCanvasCtmTranslate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"displayCanvasCtmScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"displayCanvasCtmRotate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"displayCanvasContextPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"displayCanvasContextPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e7fb0e44f5a85a8c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
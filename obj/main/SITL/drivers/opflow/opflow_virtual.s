@@ -0,0 +1,7284 @@
+	.file	"opflow_virtual.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/sensor.h"
+	.file 7 "./src/main/drivers/opflow/opflow.h"
+	.file 8 "./src/main/drivers/opflow/opflow_virtual.h"
+	.file 9 "./src/main/drivers/opflow/opflow_virtual.c"
+	.file 10 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	opflow_virtual.c.f1c8967c
+	.weak	opflow_virtual.c.f1c8967c
+opflow_virtual.c.f1c8967c:
+	.long	0x3e2
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xb
+	.long	.LASF1119
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1027
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1028
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1029
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1030
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1031
+	.uleb128 0x2
+	.long	.LASF1033
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x51
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1032
+	.uleb128 0x2
+	.long	.LASF1034
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1035
+	.uleb128 0xd
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1036
+	.uleb128 0x2
+	.long	.LASF1037
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1038
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1039
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2
+	.long	.LASF1040
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0x87
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x16
+	.long	0x19a
+	.uleb128 0x1
+	.long	.LASF1041
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1042
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1043
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1044
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1045
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1048
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1049
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1050
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1051
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1052
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1053
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1054
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1055
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1056
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1057
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1058
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1059
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1060
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1061
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1062
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1063
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1064
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1065
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1066
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1067
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1068
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1069
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1070
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1071
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1072
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1073
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1074
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1075
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1076
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1077
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1078
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x43
+	.long	0x223
+	.uleb128 0x1
+	.long	.LASF1079
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1080
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1087
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1088
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1089
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1095
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1096
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1098
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1099
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1100
+	.uleb128 0x5
+	.long	0x22f
+	.uleb128 0xe
+	.long	0x223
+	.uleb128 0x2
+	.long	.LASF1101
+	.byte	0x6
+	.byte	0x38
+	.byte	0xf
+	.long	0x240
+	.uleb128 0x5
+	.long	0x245
+	.uleb128 0xa
+	.long	0x223
+	.long	0x254
+	.uleb128 0x6
+	.long	0x254
+	.byte	0
+	.uleb128 0x5
+	.long	0x259
+	.uleb128 0x7
+	.long	.LASF1106
+	.byte	0x28
+	.byte	0x7
+	.byte	0x26
+	.long	0x28d
+	.uleb128 0x4
+	.long	.LASF1102
+	.byte	0x7
+	.byte	0x27
+	.byte	0x1d
+	.long	0x234
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1103
+	.byte	0x7
+	.byte	0x28
+	.byte	0x1f
+	.long	0x28d
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1104
+	.byte	0x7
+	.byte	0x29
+	.byte	0x12
+	.long	0x2dd
+	.byte	0x10
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1105
+	.byte	0x6
+	.byte	0x39
+	.byte	0xf
+	.long	0x240
+	.uleb128 0x7
+	.long	.LASF1107
+	.byte	0x14
+	.byte	0x7
+	.byte	0x20
+	.long	0x2cd
+	.uleb128 0x4
+	.long	.LASF1108
+	.byte	0x7
+	.byte	0x21
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1109
+	.byte	0x7
+	.byte	0x22
+	.byte	0xd
+	.long	0x2cd
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1110
+	.byte	0x7
+	.byte	0x23
+	.byte	0xd
+	.long	0x7b
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0x87
+	.long	0x2dd
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1111
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x299
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x7
+	.byte	0x2a
+	.byte	0x3
+	.long	0x259
+	.uleb128 0x7
+	.long	.LASF1113
+	.byte	0x18
+	.byte	0x8
+	.byte	0x1d
+	.long	0x329
+	.uleb128 0x4
+	.long	.LASF1114
+	.byte	0x8
+	.byte	0x1e
+	.byte	0xb
+	.long	0x22a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1115
+	.byte	0x8
+	.byte	0x1f
+	.byte	0xb
+	.long	0x22a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1116
+	.byte	0x8
+	.byte	0x20
+	.byte	0xb
+	.long	0x33d
+	.byte	0x10
+	.byte	0
+	.uleb128 0xa
+	.long	0x223
+	.long	0x338
+	.uleb128 0x6
+	.long	0x338
+	.byte	0
+	.uleb128 0x5
+	.long	0x2dd
+	.uleb128 0x5
+	.long	0x329
+	.uleb128 0x2
+	.long	.LASF1117
+	.byte	0x8
+	.byte	0x21
+	.byte	0x3
+	.long	0x2f5
+	.uleb128 0x11
+	.long	0x342
+	.uleb128 0x12
+	.long	.LASF1120
+	.byte	0x9
+	.byte	0x29
+	.byte	0x26
+	.long	0x35f
+	.uleb128 0x5
+	.long	0x34e
+	.uleb128 0x13
+	.long	.LASF1121
+	.byte	0xa
+	.byte	0x3d
+	.byte	0xe
+	.long	0x72
+	.long	0x384
+	.uleb128 0x6
+	.long	0x72
+	.uleb128 0x6
+	.long	0x64
+	.uleb128 0x6
+	.long	0x93
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1122
+	.byte	0x9
+	.byte	0x37
+	.byte	0x5
+	.long	0x223
+	.long	0x3ac
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x37
+	.byte	0x27
+	.long	0x3ac
+	.uleb128 0x15
+	.long	.LASF1118
+	.byte	0x9
+	.byte	0x37
+	.byte	0x4a
+	.long	0x35f
+	.byte	0
+	.uleb128 0x5
+	.long	0x2e9
+	.uleb128 0x16
+	.long	.LASF1123
+	.byte	0x9
+	.byte	0x31
+	.byte	0xc
+	.long	0x223
+	.long	0x3cd
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x31
+	.byte	0x2e
+	.long	0x3ac
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1124
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xc
+	.long	0x223
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x2b
+	.byte	0x2c
+	.long	0x3ac
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 34 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x22
+	.byte	0x4
+	.file 35 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 38 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.file 39 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 40 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF995
+	.byte	0x4
+	.file 41 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF996
+	.file 42 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x4
+	.file 43 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2b
+	.file 44 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1009
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF994
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1008
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1125
+	.long	.LASF1126
+	.long	.LASF1127
+	.long	.LASF1128
+	.long	.LASF1129
+	.long	.LASF1130
+	.long	.LASF1131
+	.long	.LASF1132
+	.long	.LASF1133
+	.long	.LASF1134
+	.long	.LASF1135
+	.long	.LASF1136
+	.long	.LASF1137
+	.long	.LASF1138
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1139
+	.byte	0xa
+	.long	.LASF1140
+	.byte	0xa
+	.long	.LASF1141
+	.byte	0xe
+	.long	.LASF1142
+	.byte	0x2
+	.long	.LASF1143
+	.byte	0x5
+	.long	.LASF1144
+	.byte	0x5
+	.long	.LASF1145
+	.byte	0x4
+	.long	.LASF1146
+	.byte	0x4
+	.long	.LASF1147
+	.byte	0x4
+	.long	.LASF1148
+	.byte	0xd
+	.long	.LASF1149
+	.byte	0xd
+	.long	.LASF1150
+	.byte	0xe
+	.long	.LASF1151
+	.byte	0xe
+	.long	.LASF1151
+	.byte	0xd
+	.long	.LASF1152
+	.byte	0xa
+	.long	.LASF1153
+	.byte	0xd
+	.long	.LASF1154
+	.byte	0xd
+	.long	.LASF1155
+	.byte	0xa
+	.long	.LASF1156
+	.byte	0xa
+	.long	.LASF1157
+	.byte	0xc
+	.long	.LASF1158
+	.byte	0xa
+	.long	.LASF1159
+	.byte	0xb
+	.long	.LASF1160
+	.byte	0xb
+	.long	.LASF1161
+	.byte	0xa
+	.long	.LASF1162
+	.byte	0xa
+	.long	.LASF1163
+	.byte	0xa
+	.long	.LASF1164
+	.byte	0xa
+	.long	.LASF1165
+	.byte	0x9
+	.long	.LASF1166
+	.byte	0x9
+	.long	.LASF1167
+	.byte	0xd
+	.long	.LASF1168
+	.byte	0x8
+	.long	.LASF1169
+	.byte	0x7
+	.long	.LASF1170
+	.byte	0x6
+	.long	.LASF1171
+	.byte	0x7
+	.long	.LASF1172
+	.byte	0x7
+	.long	.LASF1173
+	.byte	0x1
+	.long	.LASF1174
+	.byte	0x2
+	.long	.LASF1175
+	.byte	0x3
+	.long	.LASF1176
+	.byte	0x5
+	.long	.LASF1177
+	.byte	0x5
+	.long	.LASF1178
+	.byte	0x5
+	.long	.LASF1179
+	.byte	0x5
+	.long	.LASF1180
+	.byte	0x5
+	.long	.LASF1181
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF965:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1111:
+	.string	"opflowData_t"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1039:
+	.string	"size_t"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF939:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1053:
+	.string	"OWNER_SYSTEM"
+.LASF1097:
+	.string	"RESOURCE_ADC_CH4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF739:
+	.string	"USE_GPS "
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1038:
+	.string	"int32_t"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF942:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1037:
+	.string	"int16_t"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF978:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF987:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1018:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1010:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF892:
+	.string	"USE_VCP"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1070:
+	.string	"OWNER_SPI_PREINIT"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF975:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF949:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1056:
+	.string	"OWNER_SDCARD"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1060:
+	.string	"OWNER_OSD"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF962:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1119:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1035:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1088:
+	.string	"RESOURCE_I2C_SCL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF964:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1048:
+	.string	"OWNER_ADC"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1079:
+	.string	"RESOURCE_NONE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF977:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1089:
+	.string	"RESOURCE_I2C_SDA"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1055:
+	.string	"OWNER_I2C"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1057:
+	.string	"OWNER_FLASH"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1054:
+	.string	"OWNER_SPI"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1124:
+	.string	"virtualOpflowInit"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1012:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1074:
+	.string	"OWNER_AIRSPEED"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF968:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1031:
+	.string	"signed char"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF700:
+	.string	"__size_t__ "
+.LASF996:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1083:
+	.string	"RESOURCE_TIMER"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1063:
+	.string	"OWNER_INVERTER"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF961:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1027:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1110:
+	.string	"quality"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1107:
+	.string	"opflowData_s"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1017:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF958:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF914:
+	.string	"NOINLINE "
+.LASF1116:
+	.string	"update"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1075:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF1024:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1100:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1015:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1016:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1042:
+	.string	"OWNER_PWMIO"
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1046:
+	.string	"OWNER_SERVO"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF989:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF935:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF954:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1021:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF963:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1045:
+	.string	"OWNER_MOTOR"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF980:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF994:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1099:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1005:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF941:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1103:
+	.string	"updateFn"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1050:
+	.string	"OWNER_PINDEBUG"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1014:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF998:
+	.string	"DMA_NONE (0)"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF938:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF950:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1011:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF936:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1095:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1096:
+	.string	"RESOURCE_ADC_CH3"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF985:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF953:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1105:
+	.string	"sensorOpflowUpdateFuncPtr"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF787:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF970:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1065:
+	.string	"OWNER_LED"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1076:
+	.string	"OWNER_PINIO"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1086:
+	.string	"RESOURCE_UART_TXRX"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1006:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF946:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1090:
+	.string	"RESOURCE_SPI_SCK"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1040:
+	.string	"timeDelta_t"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1019:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1072:
+	.string	"OWNER_TEMPERATURE"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1084:
+	.string	"RESOURCE_UART_TX"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF955:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1081:
+	.string	"RESOURCE_OUTPUT"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF932:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1051:
+	.string	"OWNER_TIMER"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF969:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1092:
+	.string	"RESOURCE_SPI_MISO"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF937:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1120:
+	.string	"highLevelDeviceVTable"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1059:
+	.string	"OWNER_BEEPER"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF976:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1066:
+	.string	"OWNER_RX"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF971:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1115:
+	.string	"init"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1106:
+	.string	"opflowDev_s"
+.LASF1112:
+	.string	"opflowDev_t"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF992:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF1122:
+	.string	"virtualOpflowDetect"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1029:
+	.string	"unsigned int"
+.LASF995:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1023:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1109:
+	.string	"flowRateRaw"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1080:
+	.string	"RESOURCE_INPUT"
+.LASF1052:
+	.string	"OWNER_RANGEFINDER"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1073:
+	.string	"OWNER_1WIRE"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF947:
+	.string	"BIT(x) (1 << (x))"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF1067:
+	.string	"OWNER_TX"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1123:
+	.string	"virtualOpflowUpdate"
+.LASF984:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF1093:
+	.string	"RESOURCE_SPI_CS"
+.LASF1020:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1049:
+	.string	"OWNER_SERIAL"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF1044:
+	.string	"OWNER_PPMINPUT"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF741:
+	.string	"USE_NAV "
+.LASF1061:
+	.string	"OWNER_BARO"
+.LASF1087:
+	.string	"RESOURCE_EXTI"
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1082:
+	.string	"RESOURCE_IO"
+.LASF1036:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1064:
+	.string	"OWNER_LED_STRIP"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1094:
+	.string	"RESOURCE_ADC_CH1"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF1085:
+	.string	"RESOURCE_UART_RX"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF1101:
+	.string	"sensorOpflowInitFuncPtr"
+.LASF1041:
+	.string	"OWNER_FREE"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF960:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1098:
+	.string	"RESOURCE_RX_CE"
+.LASF1028:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF934:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1025:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1118:
+	.string	"vtable"
+.LASF959:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF990:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF957:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF933:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF974:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1078:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1058:
+	.string	"OWNER_USB"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF1013:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF952:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1030:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1077:
+	.string	"OWNER_IRLOCK"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1102:
+	.string	"initFn"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1004:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1121:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1022:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF982:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1007:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1033:
+	.string	"__int16_t"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1068:
+	.string	"OWNER_RX_SPI"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1000:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF945:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF972:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF1104:
+	.string	"rawData"
+.LASF1091:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF891:
+	.string	"USE_ADC"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF966:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF857:
+	.string	"USE_MAG "
+.LASF991:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1032:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1009:
+	.string	"SPIDEV_COUNT 4"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF983:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1108:
+	.string	"deltaTime"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1008:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF721:
+	.string	"__need_NULL"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF943:
+	.string	"EXPAND_I(x) x"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1114:
+	.string	"detect"
+.LASF997:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF951:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF940:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1047:
+	.string	"OWNER_SOFTSERIAL"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1071:
+	.string	"OWNER_COMPASS"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF786:
+	.string	"USE_STATS "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF1001:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF999:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF993:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1113:
+	.string	"virtualOpflowVTable_s"
+.LASF1117:
+	.string	"virtualOpflowVTable_t"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1069:
+	.string	"OWNER_VTX"
+.LASF1026:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1003:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF1002:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF785:
+	.string	"USE_LOG "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF1034:
+	.string	"__int32_t"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF988:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF956:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF944:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF967:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1043:
+	.string	"OWNER_PWMINPUT"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF948:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1062:
+	.string	"OWNER_MPU"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF986:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1146:
+	.string	"opflow_virtual.h"
+.LASF1176:
+	.string	"io_types.h"
+.LASF1158:
+	.string	"long-double.h"
+.LASF1166:
+	.string	"__locale_t.h"
+.LASF1168:
+	.string	"platform.h"
+.LASF1170:
+	.string	"target.h"
+.LASF1152:
+	.string	"libc-header-start.h"
+.LASF1150:
+	.string	"stdbool.h"
+.LASF1136:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1126:
+	.string	"src/main/common"
+.LASF1140:
+	.string	"stdint-intn.h"
+.LASF1135:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1138:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1159:
+	.string	"stubs.h"
+.LASF1173:
+	.string	"build_config.h"
+.LASF1130:
+	.string	"src/main/target/SITL"
+.LASF1156:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1134:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1178:
+	.string	"bus_i2c.h"
+.LASF1167:
+	.string	"strings.h"
+.LASF1154:
+	.string	"features-time64.h"
+.LASF1139:
+	.string	"types.h"
+.LASF1128:
+	.string	"src/main/drivers/opflow"
+.LASF1175:
+	.string	"parameter_group.h"
+.LASF1129:
+	.string	"src/main/drivers"
+.LASF1137:
+	.string	"/usr/include"
+.LASF1125:
+	.string	"src/main/build"
+.LASF1171:
+	.string	"sanity_check.h"
+.LASF1179:
+	.string	"rcc_types.h"
+.LASF1153:
+	.string	"features.h"
+.LASF1169:
+	.string	"common.h"
+.LASF1161:
+	.string	"typesizes.h"
+.LASF1165:
+	.string	"locale_t.h"
+.LASF1127:
+	.string	"src/main/config"
+.LASF1162:
+	.string	"time64.h"
+.LASF1164:
+	.string	"stdint-uintn.h"
+.LASF1163:
+	.string	"wchar.h"
+.LASF1174:
+	.string	"utils.h"
+.LASF1177:
+	.string	"bus.h"
+.LASF1180:
+	.string	"bus_spi.h"
+.LASF1132:
+	.string	"src/main"
+.LASF1131:
+	.string	"src/main/target"
+.LASF1142:
+	.string	"time.h"
+.LASF1144:
+	.string	"sensor.h"
+.LASF1133:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1148:
+	.string	"string.h"
+.LASF1157:
+	.string	"cdefs.h"
+.LASF1151:
+	.string	"stdint.h"
+.LASF1145:
+	.string	"opflow.h"
+.LASF1141:
+	.string	"stddef.h"
+.LASF1160:
+	.string	"stubs-64.h"
+.LASF1155:
+	.string	"wordsize.h"
+.LASF1181:
+	.string	"dma.h"
+.LASF1172:
+	.string	"common_post.h"
+.LASF1147:
+	.string	"opflow_virtual.c"
+.LASF1143:
+	.string	"resource.h"
+.LASF1149:
+	.string	"stdc-predef.h"
+.LASF0:
+	.string	"./src/main/drivers/opflow/opflow_virtual.c"
+	.text
+	.section	.gnu.lto_.profile.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \fa"
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\002"
+	.string	"\004"
+	.text
+	.section	.gnu.lto_.icf.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 P-\002"
+	.string	"t\003D"
+	.string	"\005"
+	.string	"\330\330\212\336\b\004\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\352\263\360\321\b\002\363\222\300\277\016\003\002\002\003\254\276\327\327\t\006\004\002\005\004\377\206\275\347\002\002\002\001\002\002"
+	.string	"\004"
+	.ascii	"\273\030G]\004\316\3416\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 U\005\002"
+	.string	"\264\002I"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003"
+	.string	"\002\002\001"
+	.string	""
+	.string	""
+	.string	"\001\003\001\002\003\002\003\003\001\004\002\003\002\001\200\004"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	".\001\244\n\034*\004\0272\212\242A%\204\r\264\001"
+	.text
+	.section	.gnu.lto_.inline.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"%\005"
+	.string	"\262\211\034$\200EI\0073c\314^,\"\205\360\347\341t\255\326\f\224G\312\020\325\216\304\300!|\317\355\243E\332&R\246\277\251\265Z\335,a\233s\315\271\206\350"
+	.string	"\005\"\300\233'\375\343\356\236O\217NeK>+l\031t\244\266A\233H,"
+	.string	"\315\366|\265\320_0$\210\240\325\342o`f\312\031pw\204\333\330\177ozE\357\356\254\317E/w7x\233\207\023"
+	.string	"w\023\\\260\t\n+\360\313\325bJ=\237\254;+\273\214\3707\013\343\r\201\001\035\b\030Pq\325\205\250\262\322\024\233\224u`\301\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \250\345\002"
+	.string	"\322\205\020\030\260%\351\f$\f\344\200\205V0\fg\232G"
+	.string	"(@\266\223\266\233L)J\3307\2339\360\032\303\330C\221>XZ\244\025\232\340E\034\333Hy\244h\247I|\222\335\013"
+	.string	"\025\032\361:f!}GC\t"
+	.ascii	"3\217\341\225\034_I\201\2734\333\321\352\021\210\273K1\b\003"
+	.ascii	","
+	.text
+	.section	.gnu.lto_.pureconst.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\231\004\002\231\004\003\232\004\004\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \232\345\002"
+	.string	"\242\004\017\032\2605\303\001\f\303\334\203\273\244b^\003.\221\224\326PNDDh\323&I\246*\013\223\b\233C(\260\032\007\240\nY\245\3229\217\327\030\326A\341.=\211\335\317_}\"\223\372\004\f"
+	.string	"8\001\232\3461\303\334\252\002]\002|\271\313\225\001\226K`\270=\007\003\330\300"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_.lto.697c7130133183d1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_virtualOpflowInit.17.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"=\n"
+	.string	"\346SH; \261\322\001\260\036"
+	.string	"$\205P\001\213\020\324\200\301\003\200}\235\243\027\371:\301\323\315\274\355^\321b\205\241\275E\tI\0010\320\022\027^\036\023!\345\300\214\320\264\232|n\264wJ\0015"
+	.string	"4"
+	.string	"8"
+	.string	"\345=\337+\370\201\357\325\266\031\032`\216\275\004\261\205V4x3\273eH?\036\373\214\371'\271\001O\246v\223}r\"v\327\263v\333\270\351m#\330\226\260\335\013\376fw\327\024g{\272n\246'\235\376\327\211\361\274\354\332z5\333RSBl\303\354\216\315Q\201\230\323\276\356#\260\357..\260\213cA\331-\025\374"
+	.string	"\276:\242\016\032\225\331N\2357\202\273\031 \377\004\243\002\314\275\276\327I\001v~\311M^~\316\253\326|\355\325o}\257\247\0070\034\263\331\363u\036\021\227\2354v)\233\324\303\001\026\035@\242\220\270`\372\020\270J$j\361\203\032\265X\344\3115a1\242L\2521\\\221%\327\211$\205\024\247Q*\024\311U\370I\360\250*\221!k\034\311\260S\356]i\301\214\322\034Pi\r"
+	.ascii	"r\242e\225|2-\3020\203\235,`\206\251\306\204P\3065\224=\225\206"
+	.ascii	"\354\302\022\325\301b\247\235O"
+	.text
+	.section	.gnu.lto_virtualOpflowUpdate.18.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`\310"
+	.string	"\275\013"
+	.string	"\306\226RB\020q\224\016p\031"
+	.string	""
+	.string	"\030R\340\035\210h?_!2"
+	.string	"\344\235\267\003\024\2521@\032!\321\353/\206\332\370!\006\301>bO\262\210\b"
+	.string	""
+	.string	"Y\3136\036\376\373\222\2274\252\277\b\377\215\204p[)S\n>"
+	.string	"<"
+	.string	"B"
+	.string	",v\277\004~p\035\372{\246:\274.\240:\264\355\005\fJ6\375C\215tT8\240\324\330\375\242\206\270\351i\362_\342\005P\320\360HNOK\302\356:=\222\016\267\336\366\001\333\023\354G\b)26m\330\337)\025\204}\313\356\256\265\304v\332z\352\2070\255\226tj\372\027"
+	.string	"\027\003RvGVnl\f\330B\204\355\222}\261\255\023\b\231\366G\234D\351)\220\007\330-\201\021+<0(\317\316\256\242\302\265\273\234\024#-\242@\252C\325\317\360<\330\302QD\327\256\b\307?\241a\273L>\252\303T\216\224\177r\023\037\276\2111ty\357\320\357\252\303\253\001\225\017!\271\342\277\310\004\306\032p\034t0\005\240\r\001R\366Qc\233\220\307c\304i$\n\031\266\020\250c\213\035\227\2214\356\023/h\036Q\304\270.n\020x\353\310\2708\3326.^\276\275-\325\204\350\006cR\325\251\226jD\364d?\020"
+	.ascii	"r\242e\225|2-\3020zv\231\bFc\332\267TuIo\273\306\256P\3065\224"
+	.ascii	"=\225\206\316\205\020\325\301N\247\235d"
+	.text
+	.section	.gnu.lto_virtualOpflowDetect.19.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`Q\001\035\017"
+	.string	"\346\235jF"
+	.string	"\261&\035\374\324tn(9\005\200n\344\033\352\237s\242\340\257Jn\340x\304\2200\261C\276\337\326\214\261\235ghca\220\221\376~_\235\277\252J\030\264a\261;\203\330\322\367\254\2238\204:7id\023)S\nX"
+	.string	"R"
+	.string	"V"
+	.string	"\340\tl\217\334A\266G\333n\360\300\345WH\213\002\335p\331\t\332\005;5\361\327\267\250i\276|"
+	.ascii	"\037\354[\201G.\3045\315AK\220\210\017\035.4F_K\252\006\"\003"
+	.ascii	"\343'\3007\323\024\374\334\314<\347\031\363\3112C$\273\353\204"
+	.ascii	"\371>\334\241\333\276`\273\304\376K\3270\fC+\215"
+	.string	"\355\264\3508?w\360\217N\253\323\251\245\377\2410.<\006xv;\204<VF\214ac\373\366[\270\354\221\035\0321\242\371\034\220%D\300\316tf,p\217!\020#\231g\341\253\370\n\327q8|\300.M\217\317.\270\300\023\270G\007\306\220\222\207\021iT\230_\354|=\242\326\\Q\244\260\021\323\264\306\177m\251/\301\245\257\251\025H\310\024f[\303]\254\270\335\231\210\257\303Z\341v\367'\036\257\bj\340\3042|\376\334\310\370\250Y\266\250&:@\263\324\341\347<\332x\310\201cs\207\r\302Rk\354\247\224I\211\325\332l\202 \"!\202\211\001\n\351@\353t\2426\221R\245\025\226\207j\225lP\245PTT\335\312;\265P\336I\227\001UJ\351L\336\252#%\260J\345\344u,\225\312\353F\340^[\245\2410\343\205\247G\373\316\035E\252\032c[\325$1\225Y\333\335\335F\031\225S\007\025"
+	.ascii	"r\242eU\2766LS\314\360;c\003\f\372\243\331\203\22183:\\\343'"
+	.ascii	"L\001\001\233\206P\fa@.#\202\314\323PsZ\356u\325\\U(\263\254"
+	.ascii	"\271\007"
+	.text
+	.section	.gnu.lto_virtualOpflowDetect.part.0.21.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`\310\0015\020"
+	.string	"6\036lH\360\262&\035\020\030S1\375\370\205<\035\360\351k\0262\205'k\335S\200\037\177:\354\200]Bw\334\236a\0303\2676Y\341\361\006v\272\355\005\227\236\201\312\016\007\021\350\346\303RX\205\346R\030I\003i\373d\023\271S\nT"
+	.string	"V"
+	.string	"Y"
+	.string	"4j\354\212\016>Ma\364i\361\006\270\317\321\013p\237\366]\270\304Df\332E\235\030\031\333.1\231\231f\022\241<|\220\030\203\354\212\335\247\2668\355*7\232/\303\031\230\353\307K\233\036\0269\202fN\\\216|\023I\331]\217h\356y\333\025l\243l\311 \027xn\206~\254$\222\232c\335\276\255\342\330\226\336\246\264^\374\345\177\376\003h\020\nP\261\0333\244ho\246\020\217\355\333\037e6\311\037g6\311>0\033\224M\376\307\007f\032\260!~P\250\310\336\0233\211kBF\204\006E\345E\377\305a\314\336\023;\201]\234$W\265U0\310\207\206p3Ba\354\013\275\2242\334\006\352\300\247\252\034\211R+\005\252\317\360\244\220!oX!\320\261[{hs\270\214\226"
+	.ascii	":\273{\342\007}\370\374\235\030\367){\2045\036\020\034W?\306"
+	.ascii	"\201`\376\216=\264\344\303O\277\305}.\330\221\242&\207\370\343"
+	.ascii	"\003\036KC\312\365\342\254\212p2A\202\352\001\313)\301\313[Q"
+	.ascii	"\253N\254\324\213\013\\\275P\260\217\305\342\362u-\320{\255\300"
+	.ascii	"\225\256\303*\325\322\251\300Vw\"\361\347\342\201\235\353\373"
+	.ascii	"\300\216\364m\025gD\3764n\323\022\2667uJMAXUsl[\210\251\001Z"
+	.ascii	"]\341\027\225d\351\276\301\005% \240\"*\254\035RhY\317\0274\033"
+	.ascii	"\334\033~\020\313Hl\226\320\317\345\r\334ti\303TH\273+\036\021"
+	.ascii	"D\202\260db:\2576*\257\333\2734\357\035\n\233\r\314\223\001\001"
+	.ascii	"c\326\222\361\273\2309b\376`Yu\334\025Phx\351S\224\356\277\366"
+	.ascii	"\215\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \304E\004"
+	.string	"2G\032#\240)\035\253\t\030\033\305k\351\252L\\\370H\331`\223\213\377\377\377\037\230\207\265FH\3632B\244\224)\005\376\342\206q0,\210\237\334\025J\"sxN\243\271\373\305\360\017\243*\235\324\rQ\022n\333VIn\255\265\240\034\034tW\021y\262`\202\214\354\354#\244\300\323\330vt\327\002\261\323\236\324QU\025\220\220\331\266\024\013"
+	.ascii	".C\267\006q\302`\237\030\206\027\204\013\2603x@\034\004\245\347"
+	.ascii	"Ah\024U\006"
+	.text
+	.section	.gnu.lto_.refs.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002"
+	.string	"\001\003"
+	.string	"\003\003\001\001\002"
+	.string	"\002"
+	.string	"\004"
+	.string	"\002\002\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.697c7130133183d1,"e",@progbits
+	.string	"(\265/\375`\315\r\005G"
+	.ascii	"\252y\314\032A@\344Q:_MdS5\bu\204E\250PV\323J\204\230\005\365"
+	.ascii	";$r\276\322\323Vo\355\361\361\002\204\250\253\311\257\212\024"
+	.ascii	"b_\376tf6\375\327\223*\305\374\277!Q+\366\013\344\004\344o\231"
+	.ascii	"\002n\001\234\001\240\001|m\362x\321\3151\321AT"
+	.string	"f\207\347\366\004\357\036\2651\301\253\334\313l\261>Izo\355[\315O\305\246\331\322z\215\234\206\353\272\350\013\241\355k\nZ\316o\236\326\323x\372\355\270n{\303\3518\217zsf\346\234\237\341\247\212\3537\315\006|\303\344|EJ\223\332 $}~9\277\024(DQ\030\232\335\245\021k\341\336\326#\322h\235\276\363~cB\023\263w\005\257\357k\267\377KB0r~\323v\263\303\036r\373\312x\255\023 \016\nw\226\244\375\351\364\2347G\365\336\035<5\274\276s{!mG]\265\277\321\276\337f\373;M\253i7@'\2304\267\345\374:\231X\004\206\005\257\377\373\336n~\f\033zm\230s\202\2450c\306\300\360\332k\270\325\232\372^\3536\307\260\341CfV\223\363\333kk\316\312\356\006L\335\r\224\342\312\224k\354z\033\355\020\304;\355\b\324\362\206\007\333\343V\300\333Pl\333O\354\337\037F"
+	.string	"h\021\177\017\241~<\343\357\b!\340\206?\216\361\377\316\337\302\277\333\307\375mA\323\217I\374\247\376\317\343F\355\277\360\307\033\376\006\361\267\204\277'\374\275\340o\005\177#\370\237\367\337\320\337L\177\017\370/\367\267\323\337\002\376n\372\037\350?\237\377{\346\376?\375\247\373\257\364\367\367\367\3677\326\217\251\374"
+	.string	"\324\004d\304\032\352\244\216I\251\356\260Q\315\362\362M\266Y\316\233>[j\362\315\316\275"
+	.string	"\215\352\b\362\203{\303W\364\354\230-\301G"
+	.string	"\334\201\243g\205\315\315+\fKt\310\016?\217\225,\331H\222\202W\034&5\306\267\304\353\201S\332g(\324\207\036\331\251b$\235\b\037\301\263\247\252\006#\351AM(\301\322\271b\222\\5\347\027\f\177\341$\375b$\355\347\255\327\210\036E!\252\3730\371xi\327:\3021\265\246 \274\342&\316\230\311\244\224\263T\216Y/\372\251p\263\373:R\327\265\255h\342T\177\354\304^\330H\277\270\331s\336\202\032\357+n\266\244\376cb\276\031*\003\316\223\252_\316\271e\223\210\320]\273\342$V\366{"
+	.ascii	"/\337\325Vt%\345\233\337^\264e\t\255\266Dr\356\003l\377\375\365"
+	.ascii	"\001\3668\257\235\324\244\247\317\212\033\237\366\370\255}G\372"
+	.ascii	"{\257\371\032\022\226\346l`\350\026\251\351\004\257\335\250\375"
+	.ascii	"\372}\\;z?\352E_b\276\231\332dz\222dx]\343\264A\202\3758\266"
+	.ascii	"\253ToF\177b\237\32177\001\335\3624#\261i_\327P\354\260\237X"
+	.ascii	"\006\r\305\nh(\026\343\263\026K\350'\326\220\035\320\312t:\006"
+	.ascii	"\257\307U\332\343'm\347\331-\035Y\203D\225\324\276\371\332\226"
+	.ascii	"6\024K\340.\220\220\354\013\316 \274\006\262c\363\364\244)\002"
+	.ascii	"\364\266\303q\270\314\251\013\302y\315\351\325\375q\001u\211"
+	.ascii	"\204\327?\355gX\246\b\332\314k\377\356\003\267.\n\233\356\361"
+	.ascii	"a\013U\260L\253\355\217\275\304\301\223bf\250\375z\327^\f\223"
+	.ascii	"\211\341-l\316\375J\225<\203\314)&\233\342-\235\2379G3\260P\242"
+	.ascii	"\250\004&\27407R-\307[\200Ph\023(x\305Y\200l\312,^\260"
+	.string	"4\235IDV\005\313\025B\207\326\316\310\275m\242v\316\360X\267\225\r\222\002\207\327\257n\355\3272m0\214\025+\204V\261\226\205\003\201\2454\246\362b*=\027\365\346%=e\317\363\255\360\365\253}\367\034\033\244\003\0023\301M\216\235\034;\301Q\3327+\351@We\222_\216>%\374\030\312q\024!\034\"<{_\002@6\307\bP\364\370\t\331\235\237&\016\243\222f&\207N\373\343\237\315\312g\316y\211\322\233\335\226\303\267R\200\006\266\203\377k\006\2060\313\331L\225\217\235\233>\341\303\353\177\006/\2213\f's\372trR\225I\247\257w\nuR\247P\247\374\252=\311\324+9;\231\322$V\3467C\005d\346\024\332fe\325\371\346\247S~\225\317\316\323\247\263M\231trR\247I'U\nur\276Shf\346d\313T\313\231)\205:\241\275\323\354\244*\241\002\234Ti\362\254Z\246W"
+	.ascii	"\221\021\272\244\223\231\303\020\2401\245\317:\347+m\267\234"
+	.ascii	"\223m\315\374\234\346<E\332\300\215\371%\351\266\254\013\013"
+	.ascii	"F\231o\262\241$Y\216I\227\336e\256s\222\221f5s\316\313I4$;\351"
+	.ascii	"\225\227\311\316\271\371>s^JqD\245}\347\365\314\0012S\t\266\034"
+	.ascii	"\223\016\233K\251W\016\317\222\332q4\"]\256\251\"V\227\326\325"
+	.ascii	"\3218\205\344\352\232*\240\245\325u<n\035\203\256Uq\210\221\213"
+	.ascii	"\005\262\205\314r\267\216A\035\304\242\326\352\026\271x\024y"
+	.ascii	"\260\027\244\\$\261\207\024\n\004O\305"
+	.string	"+\343\217\"\n\255\342\217b\213\254\035\306,\250_9\375\312\210,\036\213;\332k\250\262P\325!H\360\035>\\\370p\201}\207\017TT\037\252\250\332WQ\001\335gI=p\255\252\250\204\270F-b\227\217\240k\205\242\310\303\350\n\213<\2144\210\256V\021k\311\265\302\220\301=\032\203@\2102\212.Q\206\220\210\f\272\306#\013\003\307\024,\322\205qu\354JQ\003\271\305u,r\0358\246h\271\254~\024\205\356\263*|\253G\0219\345nm!\247\204.\227\025\321%\242\030\026]\"V\217.\226\313\252\250\225\203H\303\306\013(\367\252\350\026\261X\255\255-\023VJ\277\342P\345\241\303\025\225\016)\004\367\340\341\004\203\032.T\264WRZ\304.\027i\374a\005dKKG\217\255).d\361\207\021\2115u4\022yL]!\271\246\244(\270\306\243qMK\303T\227\366G\306&J\227\250\224\271fK"
+	.string	"Hrb\350\340\225\275\003\321\345\030L\027\234\006\2107\314I\265\254$hG\256P\025\277\354\214J\020\266\371j\003\350\3548\3151\032\f\033\256\327\242\235\341)\361\212\317\234)\332\347\255j\006\243\215\301B5\363\327\336B\253\346\004\n\305+.s=LF\017L\021^1\231\307\r\243\203\374\264\214\3613\026h\211Wl\206\303\364{:,\346MLo^p\350\374\332\027\351\323\261\270\354\370\313\277\264\364\026\201\022\250\2214\245\230C#\"#\"2\223$\303\0011\005\304 \t\2513\017\022"
+	.string	"V-\222)\310\206\032j\354\307n\376\002$4\375\214\337\013\024\177\274\254Dk\276\310\263\233\301]\357G\375\r\375\251B&\325\372\361\341\350m\235\213PJ\022\202q9\031\017\234\355}K\326\335[\306\201#\032m\300\211!\364\031|\300\177-\325\222\323\212x\377\2105y\036\004L\332\020\036\005j\\\036\024"
+	.string	"$\2205e\fT\225\313\326Q\020!%&\260ED\205\313\311AM\352\215\336\220^]o\220F\300PIu\366+\032\223\244\234\234\242\204\360\356\030\311\302p\340\tt\002\327\257"
+	.ascii	"r&aV4\360\b\206u00\270{\021\223\326\355+\333&=_R\250\310\330"
+	.ascii	"G\305=\243\354\3426\364\351\255\247_\220\353\353\366\016]\225"
+	.ascii	"\006a\026\236\022\264\230>ab\347\021?\250'\223\3502\nc\300\373"
+	.ascii	"\b\304vX\220b\304\207a\032\274\027\372|f\342*?\005&:&\225"
+	.string	"\270@\317\376\376\243\216\317\366\212\033|\356\3509 \360l=\253\247\354Cbx\006u\016Lj\370\372\337\226)c\337l\351d\373l\035M* J5\350\"\021\326\260\232\262\177\003\203\341N\342\206\254[\316`\340\331W\226\340\233a\372\335D\\TQ\350\026\227\262\\$\300\250"
+	.ascii	"\032\004I\356M\324\004G\355\232\240\351\237S\006\217\242\267"
+	.ascii	"\216[\340@\230\201\256h\242*)T\206q\206`\271\2350\202\327\320"
+	.ascii	"H\317\350Q\006\234\004\340\327J%\220\251\232\374W\330q\2305f"
+	.ascii	"\363]\220Y\\'N\341\262\310\200\200\311-\350\344\346\301\320\270"
+	.ascii	"\205\016\003\232\242\023\214\275I\327=\257\364P\243\203}\215"
+	.ascii	"\313cr\301;\023\351\344c\315\346\354\0162\236\262\274tGf\264"
+	.ascii	",7\032\253\246XU\334`~\310l\201\355\007\212\203\204\205\275\r"
+	.ascii	"\304\343\357\246?\322\376\335\363\266\356\370[:\0243\345\216"
+	.ascii	"\315\267\256\007}\217\336E\321;j\324\204Au\234]\350\017?y]\n"
+	.ascii	"\353`\203^\214\320\034\212\252\213c*"
+	.text
+	.section	.gnu.lto_.symtab.697c7130133183d1,"e",@progbits
+	.string	"virtualOpflowDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.697c7130133183d1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
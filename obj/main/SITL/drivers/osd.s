@@ -0,0 +1,6290 @@
+	.file	"osd.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/display_canvas.h"
+	.file 4 "./src/main/drivers/osd.c"
+	.file 5 "./src/main/drivers/osd.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	osd.c.ffe7561b
+	.weak	osd.c.ffe7561b
+osd.c.ffe7561b:
+	.long	0x713
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x11
+	.long	.LASF878
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF792
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF793
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF794
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF795
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF796
+	.uleb128 0x7
+	.long	.LASF798
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF797
+	.uleb128 0x7
+	.long	.LASF799
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x12
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	.LASF800
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF801
+	.uleb128 0x13
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF802
+	.uleb128 0xf
+	.long	0x80
+	.uleb128 0x7
+	.long	.LASF803
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	.LASF804
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF805
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x20
+	.long	0xcd
+	.uleb128 0x6
+	.long	.LASF806
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF807
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF808
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF809
+	.byte	0x3
+	.byte	0x24
+	.byte	0x3
+	.long	0xb0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x26
+	.long	0xfc
+	.uleb128 0x6
+	.long	.LASF810
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF811
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF812
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF813
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF814
+	.byte	0x3
+	.byte	0x2b
+	.byte	0x3
+	.long	0xd9
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x2d
+	.long	0x131
+	.uleb128 0x6
+	.long	.LASF815
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF816
+	.byte	0x1
+	.uleb128 0x6
+	.long	.LASF817
+	.byte	0x2
+	.uleb128 0x6
+	.long	.LASF818
+	.byte	0x4
+	.uleb128 0x6
+	.long	.LASF819
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF820
+	.byte	0x3
+	.byte	0x33
+	.byte	0x3
+	.long	0x108
+	.uleb128 0x7
+	.long	.LASF821
+	.byte	0x3
+	.byte	0x35
+	.byte	0x26
+	.long	0x14e
+	.uleb128 0xf
+	.long	0x13d
+	.uleb128 0x14
+	.long	.LASF857
+	.value	0x118
+	.byte	0x3
+	.byte	0x40
+	.byte	0x10
+	.long	0x301
+	.uleb128 0x2
+	.long	.LASF822
+	.byte	0x41
+	.byte	0xc
+	.long	0x37d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF823
+	.byte	0x42
+	.byte	0xc
+	.long	0x37d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF824
+	.byte	0x43
+	.byte	0xc
+	.long	0x37d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF825
+	.byte	0x44
+	.byte	0xc
+	.long	0x399
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF826
+	.byte	0x45
+	.byte	0xc
+	.long	0x3b8
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF827
+	.byte	0x46
+	.byte	0xc
+	.long	0x3d2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x47
+	.byte	0xc
+	.long	0x3d2
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF829
+	.byte	0x48
+	.byte	0xc
+	.long	0x3e7
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF830
+	.byte	0x49
+	.byte	0xc
+	.long	0x3fc
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF831
+	.byte	0x4a
+	.byte	0xc
+	.long	0x37d
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF832
+	.byte	0x4c
+	.byte	0xc
+	.long	0x420
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF833
+	.byte	0x4d
+	.byte	0xc
+	.long	0x420
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF834
+	.byte	0x4e
+	.byte	0xc
+	.long	0x430
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF835
+	.byte	0x4f
+	.byte	0xc
+	.long	0x454
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF836
+	.byte	0x50
+	.byte	0xc
+	.long	0x47d
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF837
+	.byte	0x51
+	.byte	0xc
+	.long	0x4a6
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF838
+	.byte	0x52
+	.byte	0xc
+	.long	0x4cf
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF839
+	.byte	0x53
+	.byte	0xc
+	.long	0x3d2
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF840
+	.byte	0x54
+	.byte	0xc
+	.long	0x3d2
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF841
+	.byte	0x55
+	.byte	0xc
+	.long	0x4fd
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF842
+	.byte	0x56
+	.byte	0xc
+	.long	0x4fd
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF843
+	.byte	0x57
+	.byte	0xc
+	.long	0x4fd
+	.byte	0xa8
+	.uleb128 0x2
+	.long	.LASF844
+	.byte	0x58
+	.byte	0xc
+	.long	0x420
+	.byte	0xb0
+	.uleb128 0x2
+	.long	.LASF845
+	.byte	0x59
+	.byte	0xc
+	.long	0x420
+	.byte	0xb8
+	.uleb128 0x2
+	.long	.LASF846
+	.byte	0x5a
+	.byte	0xc
+	.long	0x420
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF847
+	.byte	0x5b
+	.byte	0xc
+	.long	0x420
+	.byte	0xc8
+	.uleb128 0x2
+	.long	.LASF848
+	.byte	0x5c
+	.byte	0xc
+	.long	0x420
+	.byte	0xd0
+	.uleb128 0x2
+	.long	.LASF849
+	.byte	0x5d
+	.byte	0xc
+	.long	0x420
+	.byte	0xd8
+	.uleb128 0x2
+	.long	.LASF850
+	.byte	0x5f
+	.byte	0xc
+	.long	0x430
+	.byte	0xe0
+	.uleb128 0x2
+	.long	.LASF851
+	.byte	0x60
+	.byte	0xc
+	.long	0x532
+	.byte	0xe8
+	.uleb128 0x2
+	.long	.LASF852
+	.byte	0x61
+	.byte	0xc
+	.long	0x54c
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF853
+	.byte	0x62
+	.byte	0xc
+	.long	0x54c
+	.byte	0xf8
+	.uleb128 0xc
+	.long	.LASF854
+	.byte	0x63
+	.long	0x561
+	.value	0x100
+	.uleb128 0xc
+	.long	.LASF855
+	.byte	0x65
+	.long	0x430
+	.value	0x108
+	.uleb128 0xc
+	.long	.LASF856
+	.byte	0x66
+	.long	0x430
+	.value	0x110
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF858
+	.byte	0x18
+	.byte	0x3
+	.byte	0x37
+	.byte	0x10
+	.long	0x357
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x38
+	.byte	0x22
+	.long	0x357
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF860
+	.byte	0x39
+	.byte	0xb
+	.long	0x7e
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x3a
+	.byte	0xe
+	.long	0x98
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF862
+	.byte	0x3b
+	.byte	0xe
+	.long	0x98
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF863
+	.byte	0x3c
+	.byte	0xd
+	.long	0x8c
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF864
+	.byte	0x3d
+	.byte	0xd
+	.long	0x8c
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	0x149
+	.uleb128 0x7
+	.long	.LASF865
+	.byte	0x3
+	.byte	0x3e
+	.byte	0x3
+	.long	0x301
+	.uleb128 0x4
+	.long	0x378
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0xfc
+	.byte	0
+	.uleb128 0x3
+	.long	0x35c
+	.uleb128 0x3
+	.long	0x368
+	.uleb128 0x4
+	.long	0x392
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x392
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF866
+	.uleb128 0x3
+	.long	0x382
+	.uleb128 0x4
+	.long	0x3b8
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0xfc
+	.byte	0
+	.uleb128 0x3
+	.long	0x39e
+	.uleb128 0x4
+	.long	0x3d2
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x3bd
+	.uleb128 0x4
+	.long	0x3e7
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	0x3d7
+	.uleb128 0x4
+	.long	0x3fc
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x131
+	.byte	0
+	.uleb128 0x3
+	.long	0x3ec
+	.uleb128 0x4
+	.long	0x420
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x401
+	.uleb128 0x4
+	.long	0x430
+	.uleb128 0x1
+	.long	0x378
+	.byte	0
+	.uleb128 0x3
+	.long	0x425
+	.uleb128 0x4
+	.long	0x454
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	0x435
+	.uleb128 0x4
+	.long	0x47d
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x98
+	.uleb128 0x1
+	.long	0xfc
+	.uleb128 0x1
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	0x459
+	.uleb128 0x4
+	.long	0x4a1
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a1
+	.uleb128 0x1
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	0x87
+	.uleb128 0x3
+	.long	0x482
+	.uleb128 0x4
+	.long	0x4cf
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x4a1
+	.uleb128 0x1
+	.long	0xfc
+	.uleb128 0x1
+	.long	0xcd
+	.byte	0
+	.uleb128 0x3
+	.long	0x4ab
+	.uleb128 0x4
+	.long	0x4fd
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.uleb128 0x1
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x4d4
+	.uleb128 0x4
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.byte	0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF867
+	.uleb128 0x3
+	.long	0x502
+	.uleb128 0x4
+	.long	0x54c
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x52b
+	.uleb128 0x1
+	.long	0x52b
+	.byte	0
+	.uleb128 0x3
+	.long	0x537
+	.uleb128 0x4
+	.long	0x561
+	.uleb128 0x1
+	.long	0x378
+	.uleb128 0x1
+	.long	0x52b
+	.byte	0
+	.uleb128 0x3
+	.long	0x551
+	.uleb128 0x16
+	.long	0x98
+	.long	0x577
+	.uleb128 0x17
+	.long	0x37
+	.value	0x1df
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF879
+	.byte	0x5
+	.byte	0x44
+	.byte	0x11
+	.long	0x566
+	.byte	0x4
+	.uleb128 0x19
+	.long	0x577
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xa
+	.uleb128 0x1a
+	.long	.LASF880
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x5ba
+	.long	0x5ba
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x64
+	.byte	0x36
+	.long	0x30
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x64
+	.byte	0x42
+	.long	0x30
+	.uleb128 0x9
+	.string	"pos"
+	.byte	0x66
+	.byte	0xe
+	.long	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	0x98
+	.uleb128 0xd
+	.long	.LASF869
+	.byte	0x52
+	.long	0x621
+	.uleb128 0xe
+	.long	.LASF868
+	.byte	0x52
+	.byte	0x33
+	.long	0x378
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x52
+	.byte	0x3f
+	.long	0x64
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x52
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x5
+	.string	"w"
+	.byte	0x52
+	.byte	0x4d
+	.long	0x64
+	.uleb128 0x5
+	.string	"h"
+	.byte	0x52
+	.byte	0x54
+	.long	0x64
+	.uleb128 0x9
+	.string	"gx"
+	.byte	0x5d
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x9
+	.string	"gy"
+	.byte	0x5e
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x9
+	.string	"gw"
+	.byte	0x5f
+	.byte	0x9
+	.long	0x64
+	.uleb128 0x9
+	.string	"gh"
+	.byte	0x60
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF870
+	.byte	0x46
+	.long	0x67c
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x46
+	.byte	0x25
+	.long	0x64
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x46
+	.byte	0x2c
+	.long	0x64
+	.uleb128 0x5
+	.string	"w"
+	.byte	0x46
+	.byte	0x33
+	.long	0x64
+	.uleb128 0x5
+	.string	"h"
+	.byte	0x46
+	.byte	0x3a
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF871
+	.byte	0x49
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF872
+	.byte	0x4a
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0x9
+	.string	"ii"
+	.byte	0x4b
+	.byte	0xe
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0x9
+	.string	"jj"
+	.byte	0x4c
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF881
+	.byte	0x4
+	.byte	0x28
+	.byte	0xd
+	.long	0x6eb
+	.uleb128 0x5
+	.string	"x"
+	.byte	0x28
+	.byte	0x2d
+	.long	0x6eb
+	.uleb128 0x5
+	.string	"y"
+	.byte	0x28
+	.byte	0x35
+	.long	0x6eb
+	.uleb128 0x5
+	.string	"w"
+	.byte	0x28
+	.byte	0x3d
+	.long	0x6eb
+	.uleb128 0x5
+	.string	"h"
+	.byte	0x28
+	.byte	0x45
+	.long	0x6eb
+	.uleb128 0xe
+	.long	.LASF873
+	.byte	0x28
+	.byte	0x4c
+	.long	0x64
+	.uleb128 0xe
+	.long	.LASF874
+	.byte	0x28
+	.byte	0x5c
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF871
+	.byte	0x3a
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF875
+	.byte	0x3b
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF872
+	.byte	0x3f
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF876
+	.byte	0x40
+	.long	0x64
+	.byte	0
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0xd
+	.long	.LASF877
+	.byte	0x1f
+	.long	0x711
+	.uleb128 0x9
+	.string	"ptr"
+	.byte	0x21
+	.byte	0xf
+	.long	0x711
+	.uleb128 0x9
+	.string	"end"
+	.byte	0x22
+	.byte	0xf
+	.long	0x711
+	.byte	0
+	.uleb128 0x3
+	.long	0xa4
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x88
+	.uleb128 0xb
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 6 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.file 9 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 11 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 12 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 15 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5
+	.file 23 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x17
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF709
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF728
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF745
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF746
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF747
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF749
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF780
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x8
+	.long	.LASF1
+	.long	.LASF882
+	.long	.LASF883
+	.long	.LASF884
+	.long	.LASF885
+	.long	.LASF886
+	.long	.LASF887
+	.long	.LASF888
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x19
+	.long	.LASF0
+	.byte	0
+	.long	.LASF889
+	.byte	0x3
+	.long	.LASF890
+	.byte	0x3
+	.long	.LASF891
+	.byte	0x2
+	.long	.LASF892
+	.byte	0x2
+	.long	.LASF893
+	.byte	0x2
+	.long	.LASF894
+	.byte	0x6
+	.long	.LASF895
+	.byte	0x7
+	.long	.LASF896
+	.byte	0x7
+	.long	.LASF896
+	.byte	0x6
+	.long	.LASF897
+	.byte	0x3
+	.long	.LASF898
+	.byte	0x6
+	.long	.LASF899
+	.byte	0x6
+	.long	.LASF900
+	.byte	0x3
+	.long	.LASF901
+	.byte	0x3
+	.long	.LASF902
+	.byte	0x5
+	.long	.LASF903
+	.byte	0x3
+	.long	.LASF904
+	.byte	0x4
+	.long	.LASF905
+	.byte	0x4
+	.long	.LASF906
+	.byte	0x3
+	.long	.LASF907
+	.byte	0x3
+	.long	.LASF908
+	.byte	0x3
+	.long	.LASF909
+	.byte	0x3
+	.long	.LASF910
+	.byte	0x1
+	.long	.LASF911
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF858:
+	.string	"displayCanvas_s"
+.LASF865:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF759:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF811:
+	.string	"DISPLAY_CANVAS_COLOR_TRANSPARENT"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF846:
+	.string	"fillStrokeRect"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF824:
+	.string	"setStrokeAndFillColor"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF751:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF395:
+	.string	"true 1"
+.LASF791:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF712:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF774:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF789:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF747:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF739:
+	.string	"_WCHAR_T_DEFINED "
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF705:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF726:
+	.string	"_GCC_SIZE_T "
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF823:
+	.string	"setFillColor"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF716:
+	.string	"_T_SIZE "
+.LASF770:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF836:
+	.string	"drawCharacterMask"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF786:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF697:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF847:
+	.string	"strokeEllipseInRect"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF808:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_ERASE_TRANSPARENT"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF714:
+	.string	"_SYS_SIZE_T_H "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF829:
+	.string	"setStrokeWidth"
+.LASF878:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF801:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF851:
+	.string	"ctmSet"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF704:
+	.string	"_PTRDIFF_T_ "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF779:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF843:
+	.string	"fillStrokeTriangle"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF813:
+	.string	"DISPLAY_CANVAS_COLOR_GRAY"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF796:
+	.string	"signed char"
+.LASF782:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF803:
+	.string	"uint8_t"
+.LASF841:
+	.string	"strokeTriangle"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF868:
+	.string	"canvas"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF881:
+	.string	"osdGridBufferConstrainRect"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF792:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF864:
+	.string	"gridElementHeight"
+.LASF724:
+	.string	"__DEFINED_size_t "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF866:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF863:
+	.string	"gridElementWidth"
+.LASF720:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF748:
+	.string	"NULL"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF817:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_RIGHT"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF834:
+	.string	"resetDrawingState"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF819:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_LEFT"
+.LASF807:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_SOLID_BACKGROUND"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF832:
+	.string	"clipToRect"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF799:
+	.string	"__uint16_t"
+.LASF762:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF755:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF830:
+	.string	"setLineOutlineType"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF837:
+	.string	"drawString"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF775:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF833:
+	.string	"clearRect"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF870:
+	.string	"osdGridBufferClearGridRect"
+.LASF729:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF711:
+	.string	"__size_t__ "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF798:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF737:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF758:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF771:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF749:
+	.string	"NULL ((void *)0)"
+.LASF756:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF788:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF715:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF766:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF828:
+	.string	"setPixelToFillColor"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF776:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF752:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF706:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF701:
+	.string	"_T_PTRDIFF_ "
+.LASF845:
+	.string	"fillRect"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF733:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF757:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF800:
+	.string	"__uint32_t"
+.LASF718:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF844:
+	.string	"strokeRect"
+.LASF730:
+	.string	"__wchar_t__ "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF861:
+	.string	"width"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF814:
+	.string	"displayCanvasColor_e"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF809:
+	.string	"displayCanvasBitmapOption_t"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF735:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF466:
+	.string	"__PMT"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF699:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF815:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_NONE"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF794:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF850:
+	.string	"ctmReset"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF784:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF835:
+	.string	"drawCharacter"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF702:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF768:
+	.string	"BIT(x) (1 << (x))"
+.LASF700:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF723:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF876:
+	.string	"extraHeight"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF708:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF725:
+	.string	"___int_size_t_h "
+.LASF732:
+	.string	"_WCHAR_T "
+.LASF744:
+	.string	"_WCHAR_T_DECLARED "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF722:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF707:
+	.string	"_GCC_PTRDIFF_T "
+.LASF802:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF713:
+	.string	"_SIZE_T "
+.LASF740:
+	.string	"_WCHAR_T_H "
+.LASF731:
+	.string	"__WCHAR_T__ "
+.LASF761:
+	.string	"STR_HELPER(x) #x"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF871:
+	.string	"maxX"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF831:
+	.string	"setLineOutlineColor"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF880:
+	.string	"osdCharacterGridBufferGetEntryPtr"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF717:
+	.string	"__SIZE_T "
+.LASF754:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF780:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF879:
+	.string	"osdCharacterGridBuffer"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF778:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF856:
+	.string	"contextPop"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF753:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF860:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF839:
+	.string	"moveToPoint"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF773:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF721:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF827:
+	.string	"setPixelToStrokeColor"
+.LASF804:
+	.string	"uint16_t"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF703:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF795:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF825:
+	.string	"setColorInversion"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF842:
+	.string	"fillTriangle"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF826:
+	.string	"setPixel"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF816:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_TOP"
+.LASF728:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF822:
+	.string	"setStrokeColor"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF812:
+	.string	"DISPLAY_CANVAS_COLOR_WHITE"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF848:
+	.string	"fillEllipseInRect"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF787:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF719:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF750:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF734:
+	.string	"_T_WCHAR "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF806:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_INVERT_COLORS"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF736:
+	.string	"_WCHAR_T_ "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF760:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF849:
+	.string	"fillStrokeEllipseInRect"
+.LASF738:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF818:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_BOTTOM"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF727:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF797:
+	.string	"short int"
+.LASF869:
+	.string	"osdGridBufferClearPixelRect"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF785:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF872:
+	.string	"maxY"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF810:
+	.string	"DISPLAY_CANVAS_COLOR_BLACK"
+.LASF710:
+	.string	"__need_ptrdiff_t"
+.LASF743:
+	.string	"_GCC_WCHAR_T "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF763:
+	.string	"EXPAND_I(x) x"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF877:
+	.string	"osdCharacterGridBufferClear"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF745:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF767:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF852:
+	.string	"ctmTranslate"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF840:
+	.string	"strokeLineToPoint"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF857:
+	.string	"displayCanvasVTable_s"
+.LASF821:
+	.string	"displayCanvasVTable_t"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF741:
+	.string	"___int_wchar_t_h "
+.LASF772:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF781:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF793:
+	.string	"short unsigned int"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF746:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF820:
+	.string	"displayCanvasOutlineType_e"
+.LASF805:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF742:
+	.string	"__INT_WCHAR_T_H "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF838:
+	.string	"drawStringMask"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF790:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF867:
+	.string	"float"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF873:
+	.string	"totalWidth"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF874:
+	.string	"totalHeight"
+.LASF709:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF777:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF698:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF764:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF859:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF783:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF854:
+	.string	"ctmRotate"
+.LASF769:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF875:
+	.string	"extraWidth"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF853:
+	.string	"ctmScale"
+.LASF855:
+	.string	"contextPush"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF862:
+	.string	"height"
+.LASF765:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF903:
+	.string	"long-double.h"
+.LASF892:
+	.string	"osd.c"
+.LASF887:
+	.string	"/usr/include"
+.LASF909:
+	.string	"stdint-intn.h"
+.LASF895:
+	.string	"stdbool.h"
+.LASF897:
+	.string	"libc-header-start.h"
+.LASF884:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF893:
+	.string	"osd.h"
+.LASF910:
+	.string	"utils.h"
+.LASF885:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF901:
+	.string	"timesize.h"
+.LASF890:
+	.string	"stdint-uintn.h"
+.LASF886:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF908:
+	.string	"wchar.h"
+.LASF898:
+	.string	"features.h"
+.LASF907:
+	.string	"time64.h"
+.LASF883:
+	.string	"src/main/drivers"
+.LASF888:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF906:
+	.string	"typesizes.h"
+.LASF904:
+	.string	"stubs.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF911:
+	.string	"stddef.h"
+.LASF899:
+	.string	"features-time64.h"
+.LASF905:
+	.string	"stubs-64.h"
+.LASF902:
+	.string	"cdefs.h"
+.LASF891:
+	.string	"display_canvas.h"
+.LASF900:
+	.string	"wordsize.h"
+.LASF0:
+	.string	"./src/main/drivers/osd.c"
+.LASF882:
+	.string	"src/main/common"
+.LASF894:
+	.string	"stdc-predef.h"
+.LASF896:
+	.string	"stdint.h"
+.LASF889:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \267=\002"
+	.string	"\224\003\253"
+	.string	"\006"
+	.string	"\225\345\354\367\r0\002"
+	.string	"\001\367\311\245\277\013\002\002\001\002\001\002\240\342\234\212\n\003\221\361\215\352\b\n\002\002\002\004\346\334\323\300\003\004\002\003\002\005\233\300\346\367\003"
+	.string	""
+	.string	"\004"
+	.ascii	"\273\360\271\303<67\373\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \211\245\002"
+	.string	"\344\003}"
+	.string	"\005"
+	.string	"\006"
+	.string	"\001\001"
+	.string	"\001\003\004"
+	.string	"\001"
+	.string	"\001\004\005\002\002\005\002\003\024\001\001\025\001\001\020\002\007"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\004\003\200\202\f"
+	.string	""
+	.string	"\003\200\204\020"
+	.string	""
+	.string	"\002\200\006\b"
+	.string	""
+	.string	"\001\005\002\003"
+	.string	"\b"
+	.ascii	"S\240\022%\026\204\273KD\305\372\2403\240\022\030`\001"
+	.text
+	.section	.gnu.lto_.inline.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`(\001\325\t"
+	.string	"\306Q840\305(\351@\364\234,%\013\221\026\304\200\356\227\313['\247\302\242\356*u\032\021\344\317\031\203/C!\013\325\317\350\310\021%%f5zJPk\233\310\235\002*"
+	.string	","
+	.string	")"
+	.string	"\231I\335v+\315\314\274{#Z1\022\201\b^\202Ylp>\f\001?\273\352\365Y\302U\325\224}\230v\214D\032\013O\335\203\235\274B\255\177\031\346\311+$\371p\264t\303q\021B]\274X\251\207I\304\304\306\201\361\241\243u\321\272\350\3002\002|\220\356\366\245\244\240\303`S\275\213\367\f\237\265o\242\035\220\221M\301\370\337\325oI4\275N\237\022B\3774\345\234>%\203\331\177\251>\303\002\377OpK)2\363z\224\364\256\037D\223\272\301#@\345\2307o6\312\255\035\351FA\013\025\254\021S"
+	.string	"\231iM\276$ `\202q\206\350\016\255\346\327\345}X\237"
+	.ascii	"@\340\344\336\353j|\017L#\027\303\205\030\005\227\265`,nb@\264"
+	.ascii	"\204\025\224\366vkg7\323\006q\367x\226\371\2035\2048\323>\334"
+	.ascii	"\235\203\373\333j\\\376\034{\257\270a\256\225\271\271[\323\030"
+	.ascii	"j\370\236]\001\206"
+	.text
+	.section	.gnu.lto_.jmpfuncs.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\036"
+	.string	"\035\004"
+	.string	"\362\005\023\034\240'\351\376\037\227\177\333I\252\252\306\227\252\252j,83\354\311w\355\336\264\255L2\254Z\325\006\337\262\342\272\273\206\341\036\240\332\224u\2279\016\"\310dPO<b{.\250\363\320I\370$\223\202\007@N5b\255p\023\013'\004\026"
+	.ascii	";\003\230j\232\f\001\275\024\n\026\200\031\205<Li\\\f\270\003"
+	.ascii	"\215\321\210\200\030\227\303Wy\263\254\235r\2410\326a\2409\027"
+	.ascii	"\250{t\246\301%\005\030\002"
+	.text
+	.section	.gnu.lto_.pureconst.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\232\004\001\232\004\003\232\004\004\231\004\005\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \237\035\003"
+	.string	"\224\003\223"
+	.string	"\004"
+	.string	"\006\020\020\020\020"
+	.string	"\001\002\006\004\002\001"
+	.string	""
+	.string	"  "
+	.string	"\003\001"
+	.string	"\002\001\003\001\002\b\001"
+	.string	""
+	.string	""
+	.string	"\003\t"
+	.string	"\001\002\t\004\005\024\n\001"
+	.string	"\001"
+	.string	"\240\001\b\020"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.string	"UC\354p"
+	.string	"\330"
+	.string	"V\327$\275\213\301\005\360\f"
+	.ascii	"\346\3001\320\004\210+j\003\264\003\302R.\356\332\201\025a\320"
+	.ascii	"\006"
+	.text
+	.section	.gnu.lto_.lto.14ed685dfcee7603,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_osdCharacterGridBufferClear.3.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\326\001\225\020"
+	.string	"\306\034jH\320\262*\035@c\221\206CM\212\3350\362\316\206*\fpf0\242\037\222\001\343\3030\241_\004@,\373BE\265\350\"8\332\f\024qN%\002\276x\203\315\251%\021&u\214\203l\266\"\346r+\207\025T\311&r\247\024R"
+	.string	"T"
+	.string	"U"
+	.ascii	"\036/\372>A'\360}\272e\367(\020\033\301\371\220\023dwAE\341\353"
+	.ascii	"\356\215\267'[\237\236\312\226_\002D\224\271>\275\013?r\204d"
+	.ascii	"1\217t#\226\210\221\301\244\267b\346z\333e\r\034\242l\346\022"
+	.ascii	"@iw-E\031\210\373\273\355\224m\222-\017\004\376\352;\311\304"
+	.ascii	"K\372X\024B\307J\037{tI\245\331\237270\326\231=?\336\377\002"
+	.ascii	"\354(\321\331\225\371\031\262\271\311\223\342\343o\3778\267Y"
+	.ascii	"D\300nd\231\270\006\354\316n*$\200>C1\006w\361\027\255\327X%"
+	.ascii	"\030L\205\332\216nw\\\360i\005\240\317>\367vw\275\251\037o\342"
+	.ascii	"\351\324{`\001\223?>\017\232\225\317\237\361\2622\322c\343\263"
+	.ascii	"\276O\222\032\037/\371\343\323\b\251;\035N\210ZD\263\243J\240"
+	.ascii	"\363[\313\204\232\335\215\360)Cs\267\215\232\210\347\254\020"
+	.ascii	"\364\354\276.\3720\036\203\203o\363i\227\225\274\370\031!KJ\235"
+	.ascii	"\241\301\003\007\020N((#\022\223\312I}22\251P\240*<mH\tM\240"
+	.ascii	"J\n\006\r\340I\250\002G\006\214J\235B\220\005\205\nA\221qO\""
+	.ascii	"\367R\330T\232C\267\232N\325\235\264\313\312\302,\3105\306\346"
+	.ascii	"\301\265\274\320Z\320\270R\270\321A\356|\333=\334\211k\351%\003"
+	.ascii	", \200\002\231\272\271\003\363\245\304\321|\262\227\001\206\254"
+	.ascii	"\256\265\n\313\336\203-\221\223T`\026\027Q^\214\017X\255\253"
+	.ascii	"\\KM\022\227\226\302\037 \217\325l\265;\271\025IvL\236\204\001"
+	.ascii	"\332G\022\334\214\350\214\361\t\335\361yeK\261+\300\225GD,6\235"
+	.ascii	"\234\3460\373\360\034\210A\310\034B\267\355\256\367}\271#\364"
+	.ascii	"'"
+	.text
+	.section	.gnu.lto_osdGridBufferConstrainRect.4.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\230\007= "
+	.string	"&8\303K\220\026R:\204\211\361\204W%\244^\"Z,:\224\217Ol\177Z\271\322\336\213co\345\202\323m\004(\266\033u{\353\371\245\022:\274\322\031\021'"
+	.string	""
+	.string	"\030\267\006\003\314\033\2147\234\335\202*\260\037e]\355\333\236\315\022\262eJ\001\260"
+	.string	"\233"
+	.string	"\254"
+	.ascii	"\310Z\253\215\033\2347eJ\333\022\016c\305\250T\243(\020\f\222"
+	.ascii	"\240\242,\b\032\215(8o\332<\320|\355\023o\303\367\242\261\276"
+	.ascii	"R+S\026\262V\243\215\t\2347m<\016v\363|\013\354\246}\366\221"
+	.ascii	"\033]T\005@:H5\251\265\352h\213\373~\263\325h3\331\031\203\231"
+	.ascii	"%]\237\377\253\313\216\202D\277\to\023\252\330\232\322i\\HJ)"
+	.ascii	"v\226tY\322\214\f$\024{\316\260\020q\342\261s!\235\350\2600\023"
+	.ascii	"7\201\034\266$qZ\016\330Z*r\013\032\225\001\204AH\374\352\373"
+	.ascii	"!\370\333\2155\250\265z\217\202\"\356\224\333\376\262\255\301"
+	.ascii	"\216\275\00457\376\003\216\343\027\360\342?s\250_f\3271\273\206"
+	.ascii	"\331\365\313\256q\273v\331u\313\256Yv\275\262k\225]\247\354\372"
+	.ascii	"\266k\333\256k\273\246\355z\266k\331\256\317]\307v\r\333\265"
+	.ascii	"\271\353r\327t\327\273\353\033\3009\342x\324\032\342\013J\325"
+	.ascii	"2\255b|\352\257\372\221\277\325K\373\247:\217\367\370\225i6("
+	.ascii	"\253'BSH/\037\037UN\312\310je\361\345\304\243EcO9y\022!\235\307"
+	.ascii	"%\017Hj\255\005n:\202m4v\020!\274\240\331\343s\370\256\303\311"
+	.ascii	"R\245\032-)\005k\204\270BWj\311\354\t\211\3120\205\336\250\312"
+	.ascii	"0e\210\354\366t\313:i\023\361\346B\t\020[\221Fk\324\346T\254"
+	.ascii	"\375\210\321\210\264$l6\224\321\331P\206<\237b\024F\317\247\330"
+	.ascii	"\r\0236\204\331(\315bWIM\372%\300$E\305\222>\312kPZ#\362\243"
+	.ascii	"$KO)}\027P\370\333/\342\322\357h\274\307\222\255\025\2246\271"
+	.ascii	"\300Ow\242\202\030\355\023\373I_\321\311\263\326\372\027\276"
+	.ascii	"\261`7OO\365!\251h\277\214\233\301U\327\3136\022-m\262_\326Z"
+	.ascii	"\253)\223\375\251;\347;~\234W\3357G\336\271\353\370mnu\007\022"
+	.ascii	"\206t\200\312\331\204!\035\240R\207\327\033\332\321z>\025~v\017"
+	.ascii	"h>\275\236\237\b\026tzA\275\231\3175|\303\275\203\203\340@\202"
+	.ascii	"\035\005\n\271\224\241\233'\327#\024\244"
+	.string	"\023\342\3552\374\360zt\027~t\200t<<!]\016\200\2030\354x\272^P\020OG3\326\227\2252\331\001\n\255\"\372\273\305\fs\350\013\215\251\035K\330r\3668\"\207~\n\206\346\340\320\033\nCi\027\320\351w\f\336\320W\275P\034\275\031\276\340\350J}\325\\r\224\205\272x-\214#\341\026-Gw\242\204\340\234\344\350\2215o\2419\033ZC[(\315\002:\375\230\324\320[]\246h\275\314BWh\r=\025P\370c\241\001\200\245\250Al$UM \"\222\242\024$i\f@\003\021m\324\001\021\200<\307$4\2455f3+\016h\024:K\302\2544d\3613h\330r\377\030&\347h\322\233&\327\272\337\363\214\341\222\235\333V\340h}\335\026\203!\203%\254\t\354\213\026\300~\301t!+p\301\003\343\016\225\323\201\201\243>\024\001\337\254]\363\302\272\021\006\246u=\204\356\023\230B\336\216\035"
+	.string	"\n\314;\231\r\177h\322!\350\335@Qp"
+	.string	"E]\307D\374v\227\233\243\006U#\025\244\342\312XB\r\005\242%\3108\033`d5\264\337\004[t6\272\250\346\266\340\217\370h\022\025j\320\254*o\263\177\270,\017n\221\242\213q\203;\221/\242b89\030p\246\207\366\006\341\257}\3420\232\313\234\220\030Z\365T\224>\302\0275\263\033%p,f"
+	.ascii	"6|{&uB\020\020\275\r_1\266\2478Q\r"
+	.text
+	.section	.gnu.lto_osdGridBufferClearGridRect.5.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\221\005\275 "
+	.string	"v\272\307J\220XN: \354\"\351\025\234x\017\370\276\313\201-\\#\264"
+	.string	"\215d\245<V<>\346\036"
+	.string	"G\235\374sa\333\177\007\236\027}\312\351\274\223\240@\201\b\240\016\326B\013\240\235\355+E"
+	.string	"\257%\233\256\265\026\275\033\331D\356$\003\265"
+	.string	"\254"
+	.string	"\257"
+	.ascii	"6B\272+\304\224\004E!\214\307|r\227\005B\262'S\215\262{\357\201"
+	.ascii	"W\316\261\257\314\267\263\2111B\022&\\\036\b1\2478\260\2577\037"
+	.ascii	"\274S\346#y\222\237Oq\027\327\356]\272\312\272\027)\001\357\354"
+	.ascii	"\253\315k\312W\3623\345\353\017s\227\233O\367C\243\"'a\356\275"
+	.ascii	"\275\336\241\323\221\234;\036\217\307\223\346\271\354\237\323"
+	.ascii	"lY\311\246?\374\252\033\250A\f\n\201N\2632n\213\260^@\n\211\006"
+	.ascii	"-g\274\222\264\241# 8\341\020\211"
+	.string	"c,\333\372\326\351\013a\020%\243d\274\217u^R\225\240p\306)-\347\336\3134(\214q\256\235\231\2150s\006\346\332\"/\215\307 \334M\314\007;\323\3144e\031\335\317s\356Tg\334\265\212g{\312\264\246\\6\345z\312\344)\367)\323S~M\231eE\300\361\336\243\243\230+V\267\202\034\354\327\372\213\377\371S\235\177u0~\030\333\370\311\256\bu\257\351\363(\374\256\177\265\225\242\315\313t\3622w\001\356]\214\361\271v\344\245\24204\262)\361\232\236kjw$+e\b%\301\353\255\013\217\237\305\337\362\242e5T\302@\306\343[\361\261nW\2126\240.\374\312\307\366j\003\302c>\024\237?\331\021\207\305\262{M\013\366\365'\276\212m7,*\356\n\377\361\312;?\372\340\211\362\365\301\023\030 =z\375\210\350\210\030\220\230\203\246\017&\323e\323\364\315\b|W\326\226ijF$\025\024v"
+	.string	"\304\033c\367\353\207AL\"\253}\257\262\317u\033\333e\277hL\255k\337\254h\fp\3537:\217t\023\277\206\204\335N\375\342!\3508\326\311!K\367,\222\353\237dw\347\232\2344\337\364\034\202\353S\335\006H\317\230\366\033\327\277\"\302\021\304\344\264k\237\372\273\206\207\022\220\036\271\224*\251\216\300\271\253\274\325\235\f\227\334\352J\230\313\006\231S\254\240\0172y\223\032\210\351\0315v\351\031\263\031D\333\2119#FP\237\217\366\374L\364\006\016,:\354\220\"\276\342-\316\036\0240X\320@'D\210\233\034\213\363\207\033\020=\277^\017\217\216\n\037\017\210^\t_\207\235\336\007\236\236\336\315"
+	.ascii	"\376\231\320\341\351\241\370\375xz6\023\370nb\256\272=\265\304"
+	.ascii	"\200\035Dk'\276\355&\266\005\253\256{\013}[\333\264~\226a\025"
+	.ascii	"\\\323\2465yE~\261\375\242\004&c\216R\327/\332\326U Bq\236\214"
+	.ascii	"e\265\235\330\026\354\231\256=lw\255_03\347\272\326\023\250\b"
+	.ascii	"Q#y\266T\353\034 =;y\357\275\344L_\013\301k=\323G@dd\354\372"
+	.ascii	"\312\2031k8\026_-J\013\016\237\354WHp\177\250A4\306\0303L\315"
+	.ascii	"\210\214\024\264\260\320\001\220\002!\"\253\016\020`VEi9a\246"
+	.ascii	"\360i\220vU\301[i\254\n\246\366=\371\272\331\357&q\225\275\337"
+	.ascii	"\357\245V\266nLA\374\016\235\263\261\025\264\232(X\334\253\033"
+	.ascii	"\260-\300\360\304d$2o\322\r\264\257\300\265\021\n\250\346\312"
+	.ascii	"T])]\301\002n\351 \276M\240c\225\265\242\343\341\016]4hYdbO\364"
+	.ascii	"&\271v\r\350\363\215\177\345U\252\352@k\022\366\376\232\013\003"
+	.ascii	"\252\315\254\252\333O\207\231\025>\003\242X\260\315\342\257e"
+	.ascii	"\277\367i}F)p\034\324\373\232F\375\276\371R\317,\036\311\370"
+	.ascii	"\232'\233\340\311\340)\026\212\233\t~\242\203\002s\254a\262P"
+	.ascii	"5\306\2032NV6\024g\212\310\342TgS\321\244$5*\"\300\200V\255\372"
+	.ascii	"\206K\360\005\007c\2036\205\306\026\365\363\256\244\222\315\327"
+	.ascii	"\275\016]\177"
+	.text
+	.section	.gnu.lto_osdGridBufferClearPixelRect.6.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\213\004\305\032"
+	.string	"\366\361\251I\300VQ:T>g\003@\377t\003\213M\252G\004\376d\225/\216\240\275K\311\030\247\354s\304"
+	.string	"\353H\205\375-\266\305\370D\244\034CHEQ\022\362\277K\263H\266N\305\177&*nA\232\255\366m\317f\244\221\275\245L2\227"
+	.string	"\211"
+	.string	"\226"
+	.ascii	"t!\354h\305W\343A\224\322\205\203\246\3362\315W\365!:\321@<\035"
+	.ascii	"\223\220\274;\220\333y\313\264\251Za\004\177\265V\003\273@<\255"
+	.ascii	"\231#\021\362\274\373\036\367q\373\021\211\303j-\222\362\253"
+	.ascii	"ug`\t\210\247\273;\200\360T|,<\335\333n\225\357d\324\007\241"
+	.ascii	"\361#\244K\255\225\354\030\277=\244\263\371\266?\360) \035\317"
+	.ascii	"\303\026\247\271\022<\205\336s\200\023\321\224\226\316g\316\206"
+	.ascii	"\230\b\035x\016\322\3650\243\030\324Z\227\201t*\276\250\357\256"
+	.ascii	"\206\335\245\260;y\001\273\343\3416\332\375\254]\264{\244\357"
+	.ascii	"\354I_\331\227\2764\377}g~\364\007\220\211\275\367\307\334\367"
+	.ascii	"\303^\256\363\376\326\313\237u\337w\365\362;\276\367U\235\367"
+	.ascii	"M1\257\310\274(\346\r\231\2272\357l\336f^n\336\013@\t9\315\232"
+	.ascii	"\324\212\"\370\245:\241Gn\034\351O\372\227\376\337\347\356_\344"
+	.ascii	"J7r\340\216c\227\237\217\t\270\245#\t&\222\226\251\306\347\007"
+	.ascii	"\216\b\342\351\252\005\271\213\264L\"O\n\261$\362]\251\265\026"
+	.ascii	"xJ\232K03\375\037w\252g\372J9\036o\356\377\204\331\265=\t\b\261"
+	.ascii	"\326\232`\217\204\302\216X\343tO\"<}\013\230q\204\343\340\223"
+	.ascii	"\252\337[\365}\241L\337\007k\031.\261~/\246a\035\323B\333h\346"
+	.ascii	"\330\322/V\217\035t\340\305)9\252\264\253wr\253S\035\004;\360"
+	.ascii	"\2522K\212\371i\307f\200\233\257~\311\352\027\026\\\023W\237"
+	.ascii	"\367\032\034?m\253Y\355\3527\345\206z8\270\253\262\351@-N/\272"
+	.ascii	"\215\n\234\325\025\2020\361a/\313\345\222'\225\2376\"tx\204\016"
+	.ascii	"\357\3500\006\035\306\360\235\217\270\210o\205\003\t\020(\310"
+	.ascii	"\271p\301\306e\273\t\301\341\006'\\\034\033\0136\032i\253\345"
+	.ascii	"\204\310P\263@r\310p\263\201\304\251\331H\033\331\322:\344\324"
+	.ascii	"\310\0174Z\215"
+	.string	"\034w\365\263v\321\016\035T\006\326\253\0356h\254w\316\230Vu\020\004\026Np\335\263*\236\265\254iz\246w7\320\370@[\363\323<\313CV\314\372Hb\317P-6\245\262\352\331\250!:Y?)l\231\315i\207M\241\344\206\306\346\246\315J\271\241\236 M\177i\266\252i\272\247\207\007_\250!X$\241\032\231\021\221\222\024$I\007\020\003\0211n\003\021P\271DF\262\n\303\032\016\177\033\345\247\025\327\233\226\223r\275\227\362%4gw\360t\341\237\220b\351\203\013\032\365\"9y1\352\361<\350\252\306C\r\037\021\r\275\212\372~/N\244\263\3561Le\007\244\273x\2526_\264\027\027\305\026\342\375a\255\350g\020\300P\215F1|`\3723*yH\237>A\271\211\326\030\260\n{\366\205\270\332*\227\016\313\022X\2105\341P\024\220\2311#\b\300`\343\204B\2321\020\310\214\313@\222\361\261~"
+	.ascii	"\243\0254C\323\223L\211\252\032"
+	.text
+	.section	.gnu.lto_osdCharacterGridBufferGetEntryPtr.7.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\351"
+	.string	"\255\f"
+	.string	"f\030XC\360t\233\016@Hn\323\261W\237\201\r\363\002\335:\304\333y\242\340x\206\034\253\360\250\030i\f\030\255i\350\032\243&\rm{Gs\325&\262\211\254\265\022q.h\177\3257p\224\260"
+	.string	"\005\222\245M\244L)B"
+	.string	"I"
+	.string	"?"
+	.ascii	"Cv\354F"
+	.string	"\006\306\254C\016e\333\177q\030#w\005\"LK\005$\207\007\223\221\335\2309\236@uh}@u\250(\336=;\377\246S.\\N\036\013\351\271\251\260\273N\217\245\345\326\333V`\233\202\375\224\177f\372\233\r\013\037\007\210\354~8\035\331\036\220\307\212\177\267Oct]*:\366M\037f\221@X32:\212\354\306\005\207\236`\035\332\327\213L\fF\t\330\016&<\t\326\341\345\322\311\374\f?\306e\214\0361\223\354\226\b\320\034Dy\357\320\027U\207P\037\304\013Q\"A\351\277sJYc\325+\245\247Y\031\201\340X\225zM\232\225\026*yr\316\210\370\261YcGR\352\213}j\365\204\3554\374wS\217\277>&\234v\242\242\373B\203\007\016 \204JJ<\001R\356\217\007\304i\031\267\205PL6P\226\301\304\002\206\354\263q\231\307\200\265\223\320\226i\320\264-\273\342\336P9%U\261\217\243\003"
+	.string	"\343\331F\371\r.\201\220\335\215P\34366\370)\036\024"
+	.ascii	"a\221\"34\030Ac\247\224-S\3324\007\355\232J\3303\303pM\264\335"
+	.ascii	"\204\326\305c\205\030\022\022\003+@\346\035j\036\334}R\255\230"
+	.ascii	"\204I\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \233%\003"
+	.string	"\224\004\227"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004\177\013\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006\003\177\f\210\256\217\005\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005\002\r\301\204\001\005\177\016\257\377\372\006\002\006\177\017\002\007\177\020\003\003"
+	.string	"B\003\004\003\302\027"
+	.string	"\t"
+	.ascii	"C\207$\341\032;)mu\001\025\016\002\332\030\312~\236d\350`:\001"
+	.text
+	.section	.gnu.lto_.refs.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375 \033\331"
+	.string	""
+	.string	"\027"
+	.string	""
+	.string	""
+	.string	"\002\001\002\002\016"
+	.string	"\002\002\013"
+	.string	"\001\003\001\002\036"
+	.string	"\001\005\002\002\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.14ed685dfcee7603,"e",@progbits
+	.string	"(\265/\375`\030\n\3257"
+	.string	"\212d\f\026EP\036R:\305C\273\305\\p\003\366\001\347H\326\020\310\263\205\032\220\266\221%W\357\366\3606\326v\335\036\020\333\023\213=\271}\351\355\026\006\323"
+	.ascii	"\200\rF\242\204\003\205\030\007:08\257\331\307y\022)\322\266"
+	.ascii	"L\001%\001R\001I\001,/\261\0216k\302\300\212<\271\252\232\226"
+	.ascii	"\250\307\2255dW=;YN\303h\332^:\022\224\304I\334Uo\203\375\221"
+	.ascii	"\275\025{*\366R,\207a1\3342\361\230Wxz/\231\326V\214\nM)tw\325"
+	.ascii	"\257`\317L+\3471\323\372\020l\022\007X\203\254\344\205\t\251"
+	.ascii	"\005\353\"r\325\237\335\332\326\260\033wmW\345-\314\205\333\007"
+	.ascii	"\274v\356\302l\037R\266\335\336%\204\272\250]5\211\225\326\313"
+	.ascii	"\201=?X{yy\374`\375Y\313\317U\330\nO{M\256h\257u\267@\266\313"
+	.ascii	"\236\270\034W\345+\214\205\333 g9\247\261\332\177\314\266\247"
+	.ascii	"\335-\322o\316\237 kWU\300J\253z\201-jpF\373\021\234~\372e\317"
+	.ascii	"\301\025\211\203\353[VZY\016\260\372\376\373\364\363\217\351"
+	.ascii	"\177\234\377r\bN\364\337\bt/\372\257\022\036\276|\200\375\271"
+	.ascii	"\317\317\006~V\372\031\300\317\275\377v\377\353\376\333\371\317"
+	.ascii	"\366_\355\377\203\377(\376\217\371\177\347\277\333\377\266\377"
+	.ascii	"\323\377'\376\003\377\253\371\277\346\345\345\345\375\214\340"
+	.ascii	"g@\277\017PS\351\023\330mZXO\211t7\231\321\344Uv\333\317\244"
+	.ascii	"fJ\237l+\347\232m;\201\335*\235\334RgsM\231\0046\247\322ds\032"
+	.ascii	"}\002\233\255\364\331\314N\262\314\264nf\364\t\224\322J\2739"
+	.ascii	"U>\223\232\323h\222\b]\2222\001_\264|=\233\314\3662 \205\031"
+	.ascii	"u\3065\333(\277u'\327\262\332)\355\006\022]\360\306,K\276-\343"
+	.ascii	"\274|Pf\233d\037]K\262\350\257]v\\\363,Z\225\325]\247\273.$9"
+	.ascii	"\251\325\313$wg\265\316\356e\224\0054\312q\264\234m\324L%\327"
+	.ascii	"\222,Z\224\265\214j\365\331\020~6\247dQ\2470[\246f\275l\223l"
+	.ascii	"\326u\244Nv\232l\273\331\335\374\307(\320\0279vW\275S\364f\312"
+	.ascii	"\347\355\252v\206\304\300\240I\004\261g+f\256\007\301\2629\002"
+	.ascii	"\212\240968n;\032\352\216\336\231Y`9.\303m\034\207\244\203\225"
+	.ascii	"As_\3360\231\243^\367\030!3V\373\031\314_\341\211\345\370\215"
+	.ascii	"\311p\034t\003\025\274\271\356V\016\307a:<\207\3530\034nY\216"
+	.ascii	"\333\234\335p\334\227\332nfw\337\302\357$"
+	.string	"\307g\230M\257m\322M\204-\301\262\214W\023\273\356\026\302\022\204\241<i\344\376\034\251g(\001W\207W\327\024\266h\310\275qo\334-\206rP\363\372-\361\201\366uq\374n\251w\\G\204\\\3656\017G$v\344\253\355\252W\353pw]\320\342\\\365f\365\306X\"f\203\363\240s\241\226\007\335\345\210\333\314\263+s\355\204F \352\023V\267\346\252\277\313\237\363ns\033G\t\\=Q\334\030\271\352M:\375*\003\254Nh\333H\234%\207\236\255\253\366\334p\200uC\263\322\352k\361\230\320\377\373\311i\242%v\325\367\300\330\363\035\t%n\332\256\252\362\341\326\337<\326h.P \266K\352e\036\264\271\206B\203\034F\212\233\327U\331\016\316Y\031\233\034[\204\327\200\363\260\236\363\236\357\341:\266m\035Qg\300\234\3305\324\031\374\231\356\\\367=E\335\b\206\246\224I\363\247\250\255\316\024\313U\331\017"
+	.ascii	"\270\2602BW\345>\276\257;Yw\256\312s'\303:A#d\315U\231\217OM"
+	.ascii	"\0332!W}\335\341\376\377\324\036a\252\260\271\352o\031\373\337"
+	.ascii	"\177m\245\263\273w\f\265\375\266,:\017\235\203\277\021\367\230"
+	.ascii	"\301\177\265\333\301Yw\021:\2725\2154\214\356\252\377\025\364"
+	.ascii	"\377w\350.\321dJ\235\300\346T\231\004\346h\245\317fFd\211\032"
+	.ascii	"F\344\025\b$Q\304\002+\"\215b\211\003C\342\225\213\242\225\320"
+	.ascii	"7\300($Z\031\211\310)\241QX\365ax\304:\360\002\310)\242\211\253"
+	.ascii	"\242\320\210<^a}0\022\251\250bx\030\026\215\"\206G,\003\237*"
+	.ascii	"\032\211WD\027\354/@I\200\312@\303\367\fQ\024\242(\254\317\020"
+	.ascii	"\345\344\024\005\345\304\036\312\251\207|\325\204)\251\006\307"
+	.ascii	"\202A46!\261\260\214MD#\200G)$\344QJ\305Q(\343J\370\241\206\320"
+	.ascii	"\n\306\2618T\"Z\265\020\242\220\261\022\247\2122\210\303u\306"
+	.ascii	"\020\262\312E\221X\265\"\2452\370\252\220\303\342\n\344\025\361"
+	.ascii	"\005\321\n\304\260ht\221\204\224\202rBJU\260\200\274*\306`\337"
+	.ascii	"\302\t\352\t\003\221\212j\002\3225h\370\240 \005\t\021\354\324"
+	.ascii	"\204\341\021\253\351h$\312(\032\207MW"
+	.string	"E\341\213\246)\343\261i\302\322\377;v\267xI\035\236\231 \\\207$K\031\007d9\364\203\211\023\317U\211\270\302\356\217\260+v;\332m\346\333\"\3476\327P \301\237\016-jn>~\305\330MM\026\0263W\275\320 \2736\026E\032D\332\332\002h\t\307\022\241]\256\313u{\310)1\003\020=c\244\214\307o\217#2es\236\\\365:\357\027\222\221Aex\367\353\356\370aI\353\232\332\341\266\261)?\256z\237\334\006\251Y\246\216y\325\200\262\250\261(g\0303DHfDd4M\032\003\220\002\021\"+z\021\200)tDhD\222\202$\331:\331\347\223\025wf\033\001P\315\202\271z|?\030\270\275\323N\020\360\375j\271\2161\202\351XUx\345\323\315\232\303'\322\354:J\321!fi\312_\202$ep B\002 \371}*2\344\016\247\026\275)\033\245[SiN\330C\306\275oA"
+	.string	"\254\016<\022\344)7\274\217\026\021\270_\250\254\020\001~KW\333\352t\022\221"
+	.string	"q\217\210\210\tVPe0\300\210\364\326\355a\303W\001IO\206\362\342\322\232\021\326\231\204`'}x\223qtn*\330\256 @^-\232\227\263\364q\026\351|=\277;\263p\372\365\210\020\226\341`\3223SB\261\244"
+	.string	"cw\001\220\363X\374\361\321\310\312\242\374\363UV:\220\224\217\314\354\0357\276\367\t\267\243p\266i\245d\274=B]\242\227k|9f\303D^\314\231\347\267\331b\020\351\267r\235\350\315\247K\3717\265{p\b\273\005\017\221P3\240\203\346\377LCr\337\253\"\036H&Jm\210\204/=\027\306\224lw\371\224\rU*Z\002\211`\344\245F\267QW\037'P~\245\303lWQ_w\333\360aFW\321O~\346\277\020\373J\0306L\244\363\335\035\370\326_\374\017"
+	.ascii	"_\2233x\036\266\374\221V\001"
+	.text
+	.section	.gnu.lto_.symtab.14ed685dfcee7603,"e",@progbits
+	.string	"osdCharacterGridBufferClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370"
+	.string	""
+	.string	""
+	.string	"osdCharacterGridBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\001"
+	.string	""
+	.string	"osdGridBufferClearGridRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\001"
+	.string	""
+	.string	"osdGridBufferClearPixelRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\001"
+	.string	""
+	.string	"osdCharacterGridBufferGetEntryPtr"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.14ed685dfcee7603,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
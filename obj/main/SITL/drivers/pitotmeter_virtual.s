@@ -0,0 +1,13458 @@
+	.file	"pitotmeter_virtual.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/io_types.h"
+	.file 6 "./src/main/flight/pid.h"
+	.file 7 "./src/main/common/filter.h"
+	.file 8 "./src/main/common/vector.h"
+	.file 9 "./src/main/navigation/navigation.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/navigation/navigation_private.h"
+	.file 12 "./src/main/drivers/bus.h"
+	.file 13 "./src/main/drivers/pitotmeter.h"
+	.file 14 "./src/main/common/maths.h"
+	.file 15 "./src/main/flight/wind_estimator.h"
+	.file 16 "./src/main/sensors/pitotmeter.h"
+	.file 17 "./src/main/config/feature.h"
+	.file 18 "./src/main/drivers/pitotmeter_virtual.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pitotmeter_virtual.c.0de17850
+	.weak	pitotmeter_virtual.c.0de17850
+pitotmeter_virtual.c.0de17850:
+	.long	0x12ea
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1911
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1540
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1541
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1542
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1543
+	.uleb128 0x3
+	.long	.LASF1545
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1544
+	.uleb128 0x3
+	.long	.LASF1546
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1547
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1548
+	.uleb128 0x3
+	.long	.LASF1549
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1550
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1551
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1552
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1553
+	.uleb128 0x3
+	.long	.LASF1554
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF1555
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1556
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1557
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1558
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1559
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF1560
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe7
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1561
+	.uleb128 0x11
+	.long	0xff
+	.long	0x116
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1562
+	.byte	0x5
+	.byte	0x7
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF1563
+	.byte	0x5
+	.byte	0x8
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xa
+	.byte	0x26
+	.long	0x229
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x80
+	.uleb128 0xd
+	.long	.LASF1572
+	.value	0x100
+	.uleb128 0xd
+	.long	.LASF1573
+	.value	0x200
+	.uleb128 0xd
+	.long	.LASF1574
+	.value	0x400
+	.uleb128 0xd
+	.long	.LASF1575
+	.value	0x800
+	.uleb128 0xd
+	.long	.LASF1576
+	.value	0x1000
+	.uleb128 0xd
+	.long	.LASF1577
+	.value	0x2000
+	.uleb128 0xd
+	.long	.LASF1578
+	.value	0x4000
+	.uleb128 0xd
+	.long	.LASF1579
+	.value	0x8000
+	.uleb128 0x8
+	.long	.LASF1580
+	.long	0x10000
+	.uleb128 0x8
+	.long	.LASF1581
+	.long	0x20000
+	.uleb128 0x8
+	.long	.LASF1582
+	.long	0x40000
+	.uleb128 0x8
+	.long	.LASF1583
+	.long	0x80000
+	.uleb128 0x8
+	.long	.LASF1584
+	.long	0x100000
+	.uleb128 0x8
+	.long	.LASF1585
+	.long	0x200000
+	.uleb128 0x8
+	.long	.LASF1586
+	.long	0x400000
+	.uleb128 0x8
+	.long	.LASF1587
+	.long	0x800000
+	.uleb128 0x8
+	.long	.LASF1588
+	.long	0x1000000
+	.uleb128 0x8
+	.long	.LASF1589
+	.long	0x2000000
+	.uleb128 0x8
+	.long	.LASF1590
+	.long	0x4000000
+	.uleb128 0x8
+	.long	.LASF1591
+	.long	0x8000000
+	.uleb128 0x8
+	.long	.LASF1592
+	.long	0x10000000
+	.uleb128 0x8
+	.long	.LASF1593
+	.long	0x20000000
+	.uleb128 0x8
+	.long	.LASF1594
+	.long	0x40000000
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1596
+	.byte	0x4
+	.byte	0x6
+	.byte	0x51
+	.long	0x263
+	.uleb128 0x6
+	.string	"P"
+	.byte	0x6
+	.byte	0x52
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x6
+	.string	"I"
+	.byte	0x6
+	.byte	0x53
+	.byte	0xd
+	.long	0xcf
+	.byte	0x1
+	.uleb128 0x6
+	.string	"D"
+	.byte	0x6
+	.byte	0x54
+	.byte	0xd
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x6
+	.string	"FF"
+	.byte	0x6
+	.byte	0x55
+	.byte	0xd
+	.long	0xcf
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1595
+	.byte	0x6
+	.byte	0x56
+	.byte	0x3
+	.long	0x229
+	.uleb128 0xb
+	.long	.LASF1597
+	.byte	0x2c
+	.byte	0x6
+	.byte	0x58
+	.long	0x289
+	.uleb128 0x6
+	.string	"pid"
+	.byte	0x6
+	.byte	0x59
+	.byte	0xc
+	.long	0x289
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0x263
+	.long	0x299
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1598
+	.byte	0x6
+	.byte	0x5a
+	.byte	0x3
+	.long	0x26f
+	.uleb128 0xb
+	.long	.LASF1599
+	.byte	0xac
+	.byte	0x6
+	.byte	0x67
+	.long	0x452
+	.uleb128 0x2
+	.long	.LASF1600
+	.byte	0x6
+	.byte	0x68
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1601
+	.byte	0x6
+	.byte	0x69
+	.byte	0xf
+	.long	0x299
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1602
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xf
+	.long	0x299
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF1603
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xd
+	.long	0xcf
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF1604
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xe
+	.long	0xdb
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1605
+	.byte	0x6
+	.byte	0x6f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1606
+	.byte	0x6
+	.byte	0x70
+	.byte	0xe
+	.long	0xdb
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1607
+	.byte	0x6
+	.byte	0x72
+	.byte	0xd
+	.long	0xcf
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1608
+	.byte	0x6
+	.byte	0x74
+	.byte	0xd
+	.long	0xcf
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF1609
+	.byte	0x6
+	.byte	0x76
+	.byte	0xd
+	.long	0xcf
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0x6
+	.byte	0x78
+	.byte	0xe
+	.long	0xe7
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1611
+	.byte	0x6
+	.byte	0x79
+	.byte	0xe
+	.long	0xe7
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1612
+	.byte	0x6
+	.byte	0x7b
+	.byte	0xd
+	.long	0x452
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1613
+	.byte	0x6
+	.byte	0x7d
+	.byte	0xe
+	.long	0xdb
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1614
+	.byte	0x6
+	.byte	0x7e
+	.byte	0xe
+	.long	0xdb
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF1615
+	.byte	0x6
+	.byte	0x81
+	.byte	0xe
+	.long	0xdb
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF1616
+	.byte	0x6
+	.byte	0x82
+	.byte	0xb
+	.long	0xff
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1617
+	.byte	0x6
+	.byte	0x83
+	.byte	0xb
+	.long	0xff
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF1618
+	.byte	0x6
+	.byte	0x84
+	.byte	0xb
+	.long	0xff
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x6
+	.byte	0x86
+	.byte	0xd
+	.long	0xcf
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x6
+	.byte	0x87
+	.byte	0xb
+	.long	0xff
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0x6
+	.byte	0x89
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0x6
+	.byte	0x8a
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF1623
+	.byte	0x6
+	.byte	0x8b
+	.byte	0xd
+	.long	0xcf
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0x6
+	.byte	0x8d
+	.byte	0xb
+	.long	0xff
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF1625
+	.byte	0x6
+	.byte	0x8e
+	.byte	0xb
+	.long	0xff
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF1626
+	.byte	0x6
+	.byte	0x8f
+	.byte	0xd
+	.long	0xcf
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0x6
+	.byte	0x90
+	.byte	0xb
+	.long	0xff
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0x6
+	.byte	0x91
+	.byte	0xb
+	.long	0xff
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF1629
+	.byte	0x6
+	.byte	0x92
+	.byte	0xd
+	.long	0xcf
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF1630
+	.byte	0x6
+	.byte	0x94
+	.byte	0xe
+	.long	0xdb
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF1631
+	.byte	0x6
+	.byte	0x95
+	.byte	0xd
+	.long	0xcf
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x11
+	.long	0xb7
+	.long	0x462
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0x6
+	.byte	0x96
+	.byte	0x3
+	.long	0x2a5
+	.uleb128 0x17
+	.long	0x462
+	.uleb128 0x1e
+	.long	.LASF1819
+	.byte	0x6
+	.byte	0xa0
+	.byte	0x16
+	.long	0x47f
+	.uleb128 0xa
+	.long	0x462
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1633
+	.uleb128 0xb
+	.long	.LASF1634
+	.byte	0xc
+	.byte	0x7
+	.byte	0x1a
+	.long	0x4bd
+	.uleb128 0x2
+	.long	.LASF1635
+	.byte	0x7
+	.byte	0x1b
+	.byte	0xb
+	.long	0xff
+	.byte	0
+	.uleb128 0x6
+	.string	"RC"
+	.byte	0x7
+	.byte	0x1c
+	.byte	0xb
+	.long	0xff
+	.byte	0x4
+	.uleb128 0x6
+	.string	"dT"
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xb
+	.long	0xff
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x3
+	.long	0x48b
+	.uleb128 0xa
+	.long	0xff
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1637
+	.uleb128 0x14
+	.byte	0xc
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x5
+	.long	0x500
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xe
+	.long	0xff
+	.byte	0
+	.uleb128 0x6
+	.string	"y"
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x10
+	.long	0xff
+	.byte	0x4
+	.uleb128 0x6
+	.string	"z"
+	.byte	0x8
+	.byte	0x1c
+	.byte	0x12
+	.long	0xff
+	.byte	0x8
+	.byte	0
+	.uleb128 0x1f
+	.byte	0xc
+	.byte	0x8
+	.byte	0x19
+	.byte	0x9
+	.long	0x519
+	.uleb128 0x20
+	.string	"v"
+	.byte	0x8
+	.byte	0x1a
+	.byte	0xb
+	.long	0x106
+	.uleb128 0x21
+	.long	0x4d5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x500
+	.uleb128 0x11
+	.long	0xb7
+	.long	0x535
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1639
+	.byte	0x14
+	.byte	0x9
+	.byte	0xe4
+	.long	0x583
+	.uleb128 0x2
+	.long	.LASF1640
+	.byte	0x9
+	.byte	0xe5
+	.byte	0xc
+	.long	0x484
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1641
+	.byte	0x9
+	.byte	0xe6
+	.byte	0xb
+	.long	0xff
+	.byte	0x4
+	.uleb128 0x6
+	.string	"lat"
+	.byte	0x9
+	.byte	0xe7
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x6
+	.string	"lon"
+	.byte	0x9
+	.byte	0xe8
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x6
+	.string	"alt"
+	.byte	0x9
+	.byte	0xe9
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1642
+	.byte	0x9
+	.byte	0xea
+	.byte	0x3
+	.long	0x535
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0x9
+	.value	0x100
+	.long	0x606
+	.uleb128 0x4
+	.long	.LASF1643
+	.byte	0x9
+	.value	0x101
+	.byte	0xd
+	.long	0xcf
+	.byte	0
+	.uleb128 0x7
+	.string	"lat"
+	.byte	0x9
+	.value	0x102
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x7
+	.string	"lon"
+	.byte	0x9
+	.value	0x103
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x7
+	.string	"alt"
+	.byte	0x9
+	.value	0x104
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x7
+	.string	"p1"
+	.byte	0x9
+	.value	0x105
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x7
+	.string	"p2"
+	.byte	0x9
+	.value	0x105
+	.byte	0x11
+	.long	0xb7
+	.byte	0x12
+	.uleb128 0x7
+	.string	"p3"
+	.byte	0x9
+	.value	0x105
+	.byte	0x15
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF1644
+	.byte	0x9
+	.value	0x106
+	.byte	0xd
+	.long	0xcf
+	.byte	0x16
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1645
+	.byte	0x9
+	.value	0x107
+	.long	0x58f
+	.uleb128 0xf
+	.byte	0x10
+	.byte	0x9
+	.value	0x11e
+	.long	0x638
+	.uleb128 0x7
+	.string	"pos"
+	.byte	0x9
+	.value	0x11f
+	.byte	0x11
+	.long	0x519
+	.byte	0
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0x9
+	.value	0x120
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1646
+	.byte	0x9
+	.value	0x121
+	.long	0x612
+	.uleb128 0xf
+	.byte	0x14
+	.byte	0x9
+	.value	0x128
+	.long	0x690
+	.uleb128 0x7
+	.string	"kP"
+	.byte	0x9
+	.value	0x129
+	.byte	0xb
+	.long	0xff
+	.byte	0
+	.uleb128 0x7
+	.string	"kI"
+	.byte	0x9
+	.value	0x12a
+	.byte	0xb
+	.long	0xff
+	.byte	0x4
+	.uleb128 0x7
+	.string	"kD"
+	.byte	0x9
+	.value	0x12b
+	.byte	0xb
+	.long	0xff
+	.byte	0x8
+	.uleb128 0x7
+	.string	"kT"
+	.byte	0x9
+	.value	0x12c
+	.byte	0xb
+	.long	0xff
+	.byte	0xc
+	.uleb128 0x7
+	.string	"kFF"
+	.byte	0x9
+	.value	0x12d
+	.byte	0xb
+	.long	0xff
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1647
+	.byte	0x9
+	.value	0x12e
+	.long	0x644
+	.uleb128 0xf
+	.byte	0x44
+	.byte	0x9
+	.value	0x134
+	.long	0x740
+	.uleb128 0x4
+	.long	.LASF1648
+	.byte	0x9
+	.value	0x135
+	.byte	0x9
+	.long	0x484
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1649
+	.byte	0x9
+	.value	0x136
+	.byte	0x1a
+	.long	0x690
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1650
+	.byte	0x9
+	.value	0x137
+	.byte	0x11
+	.long	0x4bd
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1651
+	.byte	0x9
+	.value	0x138
+	.byte	0xb
+	.long	0xff
+	.byte	0x24
+	.uleb128 0x4
+	.long	.LASF1652
+	.byte	0x9
+	.value	0x139
+	.byte	0xb
+	.long	0xff
+	.byte	0x28
+	.uleb128 0x4
+	.long	.LASF1653
+	.byte	0x9
+	.value	0x13a
+	.byte	0xb
+	.long	0xff
+	.byte	0x2c
+	.uleb128 0x4
+	.long	.LASF1654
+	.byte	0x9
+	.value	0x13c
+	.byte	0xb
+	.long	0xff
+	.byte	0x30
+	.uleb128 0x4
+	.long	.LASF1655
+	.byte	0x9
+	.value	0x13d
+	.byte	0xb
+	.long	0xff
+	.byte	0x34
+	.uleb128 0x4
+	.long	.LASF1656
+	.byte	0x9
+	.value	0x13e
+	.byte	0xb
+	.long	0xff
+	.byte	0x38
+	.uleb128 0x4
+	.long	.LASF1657
+	.byte	0x9
+	.value	0x13f
+	.byte	0xb
+	.long	0xff
+	.byte	0x3c
+	.uleb128 0x4
+	.long	.LASF1658
+	.byte	0x9
+	.value	0x140
+	.byte	0xb
+	.long	0xff
+	.byte	0x40
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1659
+	.byte	0x9
+	.value	0x141
+	.long	0x69c
+	.uleb128 0x22
+	.long	.LASF1660
+	.value	0x2a8
+	.byte	0x9
+	.value	0x143
+	.byte	0x10
+	.long	0x7b4
+	.uleb128 0x7
+	.string	"pos"
+	.byte	0x9
+	.value	0x145
+	.byte	0x15
+	.long	0x7b4
+	.byte	0
+	.uleb128 0x7
+	.string	"vel"
+	.byte	0x9
+	.value	0x146
+	.byte	0x15
+	.long	0x7b4
+	.byte	0xcc
+	.uleb128 0x5
+	.long	.LASF1661
+	.byte	0x9
+	.value	0x147
+	.byte	0x15
+	.long	0x740
+	.value	0x198
+	.uleb128 0x5
+	.long	.LASF1662
+	.byte	0x9
+	.value	0x14a
+	.byte	0x15
+	.long	0x740
+	.value	0x1dc
+	.uleb128 0x5
+	.long	.LASF1663
+	.byte	0x9
+	.value	0x14b
+	.byte	0x15
+	.long	0x740
+	.value	0x220
+	.uleb128 0x5
+	.long	.LASF1664
+	.byte	0x9
+	.value	0x14c
+	.byte	0x15
+	.long	0x740
+	.value	0x264
+	.byte	0
+	.uleb128 0x11
+	.long	0x740
+	.long	0x7c4
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1665
+	.byte	0x9
+	.value	0x14d
+	.long	0x74c
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x34
+	.long	0x7ee
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1669
+	.byte	0xb
+	.byte	0x38
+	.byte	0x3
+	.long	0x7d0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x3a
+	.long	0x824
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1675
+	.byte	0xb
+	.byte	0x40
+	.byte	0x3
+	.long	0x7fa
+	.uleb128 0xb
+	.long	.LASF1676
+	.byte	0x24
+	.byte	0xb
+	.byte	0x42
+	.long	0x91a
+	.uleb128 0x2
+	.long	.LASF1677
+	.byte	0xb
+	.byte	0x43
+	.byte	0x9
+	.long	0x484
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1678
+	.byte	0xb
+	.byte	0x44
+	.byte	0x9
+	.long	0x484
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1679
+	.byte	0xb
+	.byte	0x45
+	.byte	0x9
+	.long	0x484
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1680
+	.byte	0xb
+	.byte	0x47
+	.byte	0x9
+	.long	0x484
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0xb
+	.byte	0x48
+	.byte	0x9
+	.long	0x484
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0xb
+	.byte	0x4a
+	.byte	0x20
+	.long	0x7ee
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0xb
+	.byte	0x4b
+	.byte	0x20
+	.long	0x7ee
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1684
+	.byte	0xb
+	.byte	0x4c
+	.byte	0x20
+	.long	0x7ee
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0xb
+	.byte	0x4d
+	.byte	0x20
+	.long	0x7ee
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1686
+	.byte	0xb
+	.byte	0x4e
+	.byte	0x20
+	.long	0x7ee
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1687
+	.byte	0xb
+	.byte	0x50
+	.byte	0x9
+	.long	0x484
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1688
+	.byte	0xb
+	.byte	0x51
+	.byte	0x9
+	.long	0x484
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0xb
+	.byte	0x52
+	.byte	0x9
+	.long	0x484
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0xb
+	.byte	0x55
+	.byte	0x9
+	.long	0x484
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0xb
+	.byte	0x56
+	.byte	0x9
+	.long	0x484
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0xb
+	.byte	0x57
+	.byte	0x9
+	.long	0x484
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0xb
+	.byte	0x59
+	.byte	0x9
+	.long	0x484
+	.byte	0x22
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0xb
+	.byte	0x5a
+	.byte	0x3
+	.long	0x830
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0xb
+	.byte	0x62
+	.byte	0x9
+	.long	0x94a
+	.uleb128 0x6
+	.string	"pos"
+	.byte	0xb
+	.byte	0x63
+	.byte	0x11
+	.long	0x519
+	.byte	0
+	.uleb128 0x6
+	.string	"vel"
+	.byte	0xb
+	.byte	0x64
+	.byte	0x11
+	.long	0x519
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1695
+	.byte	0xb
+	.byte	0x65
+	.byte	0x3
+	.long	0x926
+	.uleb128 0x14
+	.byte	0x44
+	.byte	0xb
+	.byte	0x67
+	.byte	0x9
+	.long	0x9bb
+	.uleb128 0x6
+	.string	"abs"
+	.byte	0xb
+	.byte	0x69
+	.byte	0x1a
+	.long	0x94a
+	.byte	0
+	.uleb128 0x6
+	.string	"agl"
+	.byte	0xb
+	.byte	0x6a
+	.byte	0x1a
+	.long	0x94a
+	.byte	0x18
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x6b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0xb
+	.byte	0x6e
+	.byte	0xb
+	.long	0xff
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0xb
+	.byte	0x6f
+	.byte	0xb
+	.long	0xff
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1698
+	.byte	0xb
+	.byte	0x70
+	.byte	0xb
+	.long	0xff
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0xb
+	.byte	0x71
+	.byte	0xb
+	.long	0xff
+	.byte	0x40
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1700
+	.byte	0xb
+	.byte	0x72
+	.byte	0x3
+	.long	0x956
+	.uleb128 0x14
+	.byte	0x1c
+	.byte	0xb
+	.byte	0x74
+	.byte	0x9
+	.long	0x9f8
+	.uleb128 0x6
+	.string	"pos"
+	.byte	0xb
+	.byte	0x75
+	.byte	0x11
+	.long	0x519
+	.byte	0
+	.uleb128 0x6
+	.string	"vel"
+	.byte	0xb
+	.byte	0x76
+	.byte	0x11
+	.long	0x519
+	.byte	0xc
+	.uleb128 0x6
+	.string	"yaw"
+	.byte	0xb
+	.byte	0x77
+	.byte	0xd
+	.long	0xc3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0xb
+	.byte	0x78
+	.byte	0x3
+	.long	0x9c7
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0x9a
+	.long	0xaee
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x23
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1739
+	.byte	0xb
+	.byte	0xcb
+	.byte	0x3
+	.long	0xa04
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xb
+	.byte	0xcd
+	.long	0xbd8
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x22
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1775
+	.byte	0xb
+	.byte	0xfa
+	.byte	0x3
+	.long	0xafa
+	.uleb128 0xf
+	.byte	0x14
+	.byte	0xb
+	.value	0x123
+	.long	0xc18
+	.uleb128 0x4
+	.long	.LASF1776
+	.byte	0xb
+	.value	0x124
+	.byte	0xe
+	.long	0xf3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1777
+	.byte	0xb
+	.value	0x125
+	.byte	0x11
+	.long	0x519
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1778
+	.byte	0xb
+	.value	0x126
+	.byte	0xb
+	.long	0xff
+	.byte	0x10
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1779
+	.byte	0xb
+	.value	0x127
+	.long	0xbe4
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0xb
+	.value	0x129
+	.long	0xc66
+	.uleb128 0x4
+	.long	.LASF1780
+	.byte	0xb
+	.value	0x12a
+	.byte	0x11
+	.long	0x519
+	.byte	0
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0xb
+	.value	0x12b
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF1781
+	.byte	0xb
+	.value	0x12c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1782
+	.byte	0xb
+	.value	0x12d
+	.byte	0xe
+	.long	0xf3
+	.byte	0x14
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1783
+	.byte	0xb
+	.value	0x12e
+	.long	0xc24
+	.uleb128 0xf
+	.byte	0x2c
+	.byte	0xb
+	.value	0x130
+	.long	0xcd0
+	.uleb128 0x4
+	.long	.LASF1784
+	.byte	0xb
+	.value	0x131
+	.byte	0x1b
+	.long	0x824
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1785
+	.byte	0xb
+	.value	0x132
+	.byte	0x1b
+	.long	0x638
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1786
+	.byte	0xb
+	.value	0x133
+	.byte	0xb
+	.long	0xff
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF1787
+	.byte	0xb
+	.value	0x134
+	.byte	0xb
+	.long	0xff
+	.byte	0x18
+	.uleb128 0x4
+	.long	.LASF1788
+	.byte	0xb
+	.value	0x135
+	.byte	0xb
+	.long	0xff
+	.byte	0x1c
+	.uleb128 0x4
+	.long	.LASF1789
+	.byte	0xb
+	.value	0x136
+	.byte	0x11
+	.long	0x519
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1790
+	.byte	0xb
+	.value	0x137
+	.long	0xc72
+	.uleb128 0x23
+	.value	0x98c
+	.byte	0xb
+	.value	0x141
+	.byte	0x9
+	.long	0xe79
+	.uleb128 0x4
+	.long	.LASF1791
+	.byte	0xb
+	.value	0x143
+	.byte	0x1a
+	.long	0xbd8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1792
+	.byte	0xb
+	.value	0x144
+	.byte	0x1e
+	.long	0xaee
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1793
+	.byte	0xb
+	.value	0x146
+	.byte	0x17
+	.long	0x91a
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1794
+	.byte	0xb
+	.value	0x149
+	.byte	0x20
+	.long	0x7c4
+	.byte	0x2c
+	.uleb128 0x5
+	.long	.LASF1795
+	.byte	0xb
+	.value	0x14a
+	.byte	0xb
+	.long	0xff
+	.value	0x2d4
+	.uleb128 0x5
+	.long	.LASF1796
+	.byte	0xb
+	.value	0x14b
+	.byte	0xb
+	.long	0xff
+	.value	0x2d8
+	.uleb128 0x5
+	.long	.LASF1797
+	.byte	0xb
+	.value	0x14e
+	.byte	0x20
+	.long	0x9bb
+	.value	0x2dc
+	.uleb128 0x5
+	.long	.LASF1798
+	.byte	0xb
+	.value	0x14f
+	.byte	0x1e
+	.long	0x9f8
+	.value	0x320
+	.uleb128 0x5
+	.long	.LASF1799
+	.byte	0xb
+	.value	0x151
+	.byte	0xe
+	.long	0xe7
+	.value	0x33c
+	.uleb128 0x5
+	.long	.LASF1800
+	.byte	0xb
+	.value	0x152
+	.byte	0xe
+	.long	0xe7
+	.value	0x340
+	.uleb128 0x5
+	.long	.LASF1801
+	.byte	0xb
+	.value	0x155
+	.byte	0x11
+	.long	0x583
+	.value	0x344
+	.uleb128 0x5
+	.long	.LASF1802
+	.byte	0xb
+	.value	0x158
+	.byte	0x18
+	.long	0xc18
+	.value	0x358
+	.uleb128 0x5
+	.long	.LASF1803
+	.byte	0xb
+	.value	0x159
+	.byte	0x10
+	.long	0xcd0
+	.value	0x36c
+	.uleb128 0x5
+	.long	.LASF1804
+	.byte	0xb
+	.value	0x15c
+	.byte	0xe
+	.long	0xe7
+	.value	0x398
+	.uleb128 0x5
+	.long	.LASF1805
+	.byte	0xb
+	.value	0x15d
+	.byte	0xd
+	.long	0xc3
+	.value	0x39c
+	.uleb128 0x5
+	.long	.LASF1806
+	.byte	0xb
+	.value	0x160
+	.byte	0x11
+	.long	0xc66
+	.value	0x3a0
+	.uleb128 0x5
+	.long	.LASF1807
+	.byte	0xb
+	.value	0x163
+	.byte	0x13
+	.long	0xe79
+	.value	0x3b8
+	.uleb128 0x5
+	.long	.LASF1808
+	.byte	0xb
+	.value	0x164
+	.byte	0x20
+	.long	0x484
+	.value	0x958
+	.uleb128 0x5
+	.long	.LASF1809
+	.byte	0xb
+	.value	0x165
+	.byte	0xc
+	.long	0xab
+	.value	0x959
+	.uleb128 0x5
+	.long	.LASF1810
+	.byte	0xb
+	.value	0x167
+	.byte	0x1b
+	.long	0x638
+	.value	0x95c
+	.uleb128 0x5
+	.long	.LASF1811
+	.byte	0xb
+	.value	0x168
+	.byte	0xc
+	.long	0xab
+	.value	0x96c
+	.uleb128 0x5
+	.long	.LASF1812
+	.byte	0xb
+	.value	0x169
+	.byte	0xb
+	.long	0xff
+	.value	0x970
+	.uleb128 0x5
+	.long	.LASF1813
+	.byte	0xb
+	.value	0x16a
+	.byte	0xb
+	.long	0xff
+	.value	0x974
+	.uleb128 0x5
+	.long	.LASF1814
+	.byte	0xb
+	.value	0x16b
+	.byte	0xb
+	.long	0xff
+	.value	0x978
+	.uleb128 0x5
+	.long	.LASF1815
+	.byte	0xb
+	.value	0x16c
+	.byte	0xe
+	.long	0xf3
+	.value	0x97c
+	.uleb128 0x5
+	.long	.LASF1816
+	.byte	0xb
+	.value	0x16f
+	.byte	0xd
+	.long	0x525
+	.value	0x980
+	.uleb128 0x5
+	.long	.LASF1817
+	.byte	0xb
+	.value	0x170
+	.byte	0xb
+	.long	0xff
+	.value	0x988
+	.byte	0
+	.uleb128 0x11
+	.long	0x606
+	.long	0xe89
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x3b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1818
+	.byte	0xb
+	.value	0x171
+	.long	0xcdc
+	.uleb128 0x24
+	.long	.LASF1820
+	.byte	0xb
+	.value	0x177
+	.byte	0x1f
+	.long	0xe89
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xc
+	.byte	0x3a
+	.long	0xecc
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1826
+	.byte	0xc
+	.byte	0x40
+	.byte	0x3
+	.long	0xea2
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xc
+	.byte	0x4b
+	.long	0x1010
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1877
+	.byte	0xc
+	.byte	0x94
+	.byte	0x3
+	.long	0xed8
+	.uleb128 0x18
+	.byte	0xa6
+	.uleb128 0xb
+	.long	.LASF1878
+	.byte	0x18
+	.byte	0xc
+	.byte	0x9f
+	.long	0x1093
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0xc
+	.byte	0xa0
+	.byte	0xc
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xf
+	.long	0xecc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0xc
+	.byte	0xa2
+	.byte	0x17
+	.long	0x1010
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0xc
+	.byte	0xa3
+	.byte	0xd
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x6
+	.string	"tag"
+	.byte	0xc
+	.byte	0xa4
+	.byte	0xd
+	.long	0xcf
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1649
+	.byte	0xc
+	.byte	0xa5
+	.byte	0xd
+	.long	0xcf
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0xc
+	.byte	0xb3
+	.byte	0x7
+	.long	0x101c
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1883
+	.byte	0xc
+	.byte	0xb4
+	.byte	0xd
+	.long	0x116
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1884
+	.byte	0xc
+	.byte	0xb5
+	.byte	0x3
+	.long	0x101e
+	.uleb128 0x17
+	.long	0x1093
+	.uleb128 0x18
+	.byte	0xbc
+	.uleb128 0xb
+	.long	.LASF1885
+	.byte	0x28
+	.byte	0xc
+	.byte	0xb7
+	.long	0x110e
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0xc
+	.byte	0xb8
+	.byte	0x23
+	.long	0x110e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0xc
+	.byte	0xb9
+	.byte	0xf
+	.long	0xecc
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0xc
+	.byte	0xba
+	.byte	0xe
+	.long	0xe7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1649
+	.byte	0xc
+	.byte	0xbb
+	.byte	0xe
+	.long	0xe7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0xc
+	.byte	0xc9
+	.byte	0x7
+	.long	0x10a4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1883
+	.byte	0xc
+	.byte	0xca
+	.byte	0xa
+	.long	0x122
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0xc
+	.byte	0xcb
+	.byte	0x10
+	.long	0x1113
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0x109f
+	.uleb128 0xa
+	.long	0xe7
+	.uleb128 0x3
+	.long	.LASF1888
+	.byte	0xc
+	.byte	0xce
+	.byte	0x3
+	.long	0x10a6
+	.uleb128 0x3
+	.long	.LASF1889
+	.byte	0xd
+	.byte	0x17
+	.byte	0xf
+	.long	0x1130
+	.uleb128 0xa
+	.long	0x1135
+	.uleb128 0x25
+	.long	0x484
+	.long	0x1144
+	.uleb128 0x10
+	.long	0x1144
+	.byte	0
+	.uleb128 0xa
+	.long	0x1149
+	.uleb128 0xb
+	.long	.LASF1890
+	.byte	0x28
+	.byte	0xd
+	.byte	0x1a
+	.long	0x1197
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0xd
+	.byte	0x1b
+	.byte	0x13
+	.long	0x11bd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0xd
+	.byte	0x1c
+	.byte	0xe
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0xd
+	.byte	0x1d
+	.byte	0x14
+	.long	0x1124
+	.byte	0x10
+	.uleb128 0x6
+	.string	"get"
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x14
+	.long	0x1124
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0xd
+	.byte	0x1f
+	.byte	0x1b
+	.long	0x1197
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1895
+	.byte	0xd
+	.byte	0x18
+	.byte	0x10
+	.long	0x11a3
+	.uleb128 0xa
+	.long	0x11a8
+	.uleb128 0x26
+	.long	0x11bd
+	.uleb128 0x10
+	.long	0x1144
+	.uleb128 0x10
+	.long	0x4c9
+	.uleb128 0x10
+	.long	0x4c9
+	.byte	0
+	.uleb128 0xa
+	.long	0x1118
+	.uleb128 0x3
+	.long	.LASF1896
+	.byte	0xd
+	.byte	0x20
+	.byte	0x3
+	.long	0x1149
+	.uleb128 0x16
+	.long	.LASF1897
+	.byte	0xe
+	.byte	0xa0
+	.byte	0x7
+	.long	0xff
+	.long	0x11e4
+	.uleb128 0x10
+	.long	0xff
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1898
+	.byte	0xf
+	.byte	0x21
+	.byte	0x7
+	.long	0xff
+	.long	0x11fa
+	.uleb128 0x10
+	.long	0x11fa
+	.byte	0
+	.uleb128 0xa
+	.long	0xdb
+	.uleb128 0x19
+	.long	.LASF1899
+	.byte	0xf
+	.byte	0x1c
+	.long	0x484
+	.uleb128 0x19
+	.long	.LASF1900
+	.byte	0x10
+	.byte	0x43
+	.long	0x484
+	.uleb128 0x16
+	.long	.LASF1901
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x5
+	.long	0x484
+	.long	0x122b
+	.uleb128 0x10
+	.long	0xe7
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF1912
+	.byte	0x12
+	.byte	0x53
+	.byte	0x5
+	.long	0x484
+	.long	0x1247
+	.uleb128 0x13
+	.long	.LASF1902
+	.byte	0x53
+	.byte	0x24
+	.long	0x1247
+	.byte	0
+	.uleb128 0xa
+	.long	0x11c2
+	.uleb128 0x28
+	.long	.LASF1913
+	.byte	0x12
+	.byte	0x3e
+	.byte	0xd
+	.long	0x12a8
+	.uleb128 0x13
+	.long	.LASF1902
+	.byte	0x3e
+	.byte	0x2f
+	.long	0x1247
+	.uleb128 0x13
+	.long	.LASF1903
+	.byte	0x3e
+	.byte	0x3d
+	.long	0x4c9
+	.uleb128 0x13
+	.long	.LASF1904
+	.byte	0x3e
+	.byte	0x4e
+	.long	0x4c9
+	.uleb128 0x15
+	.long	.LASF1905
+	.byte	0x41
+	.byte	0xb
+	.long	0xff
+	.uleb128 0x29
+	.uleb128 0x15
+	.long	.LASF1906
+	.byte	0x44
+	.byte	0x16
+	.long	0xdb
+	.uleb128 0x15
+	.long	.LASF1907
+	.byte	0x45
+	.byte	0x13
+	.long	0xff
+	.uleb128 0x15
+	.long	.LASF1908
+	.byte	0x46
+	.byte	0x13
+	.long	0xff
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1909
+	.byte	0x38
+	.long	0x484
+	.long	0x12c2
+	.uleb128 0x13
+	.long	.LASF1902
+	.byte	0x38
+	.byte	0x29
+	.long	0x1247
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1910
+	.byte	0x32
+	.long	0x484
+	.long	0x12dc
+	.uleb128 0x13
+	.long	.LASF1902
+	.byte	0x32
+	.byte	0x2a
+	.long	0x1247
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1914
+	.byte	0x6
+	.byte	0xa0
+	.byte	0x53
+	.long	0x12e8
+	.uleb128 0xa
+	.long	0x46e
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 18
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 35 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x23
+	.file 36 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 37 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x25
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 39 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 42 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 43 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 44 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 45 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x2d
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.file 46 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1033
+	.byte	0x4
+	.file 47 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1034
+	.byte	0x4
+	.file 48 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6
+	.file 49 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0x4
+	.file 50 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.file 51 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x34
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1359
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1386
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.file 62 "./src/main/common/calibration.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3e
+	.file 63 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1501
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1502
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.file 67 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1504
+	.byte	0x4
+	.file 68 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1505
+	.file 69 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x4
+	.file 70 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1518
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 72 "./src/main/drivers/pitotmeter_virtual.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1358
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1380
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1385
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1388
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1390
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1415
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1418
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1418
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1409
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1427
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1428
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1429
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1430
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1437
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1438
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1439
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1441
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1442
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation_private.h.20.f031f155a7b4a02932e4cd7327b35035,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1497
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1499
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1517
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1539
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF1915
+	.long	.LASF1916
+	.long	.LASF1917
+	.long	.LASF1918
+	.long	.LASF1919
+	.long	.LASF1920
+	.long	.LASF1921
+	.long	.LASF1922
+	.long	.LASF1923
+	.long	.LASF1924
+	.long	.LASF1925
+	.long	.LASF1926
+	.long	.LASF1927
+	.long	.LASF1928
+	.long	.LASF1929
+	.long	.LASF1930
+	.long	.LASF1931
+	.long	.LASF1932
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x49
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1933
+	.byte	0xe
+	.long	.LASF1934
+	.byte	0xe
+	.long	.LASF1935
+	.byte	0xe
+	.long	.LASF1936
+	.byte	0x2
+	.long	.LASF1937
+	.byte	0x4
+	.long	.LASF1938
+	.byte	0x6
+	.long	.LASF1939
+	.byte	0x2
+	.long	.LASF1940
+	.byte	0x2
+	.long	.LASF1941
+	.byte	0x8
+	.long	.LASF1942
+	.byte	0x5
+	.long	.LASF1943
+	.byte	0x8
+	.long	.LASF1944
+	.byte	0x4
+	.long	.LASF1945
+	.byte	0x4
+	.long	.LASF1946
+	.byte	0x2
+	.long	.LASF1947
+	.byte	0x6
+	.long	.LASF1945
+	.byte	0x9
+	.long	.LASF1948
+	.byte	0x3
+	.long	.LASF1949
+	.byte	0x4
+	.long	.LASF1950
+	.byte	0x11
+	.long	.LASF1951
+	.byte	0x12
+	.long	.LASF1952
+	.byte	0x12
+	.long	.LASF1952
+	.byte	0x11
+	.long	.LASF1953
+	.byte	0xe
+	.long	.LASF1954
+	.byte	0x11
+	.long	.LASF1955
+	.byte	0x11
+	.long	.LASF1956
+	.byte	0xe
+	.long	.LASF1957
+	.byte	0xe
+	.long	.LASF1958
+	.byte	0x10
+	.long	.LASF1959
+	.byte	0xe
+	.long	.LASF1960
+	.byte	0xf
+	.long	.LASF1961
+	.byte	0xf
+	.long	.LASF1962
+	.byte	0xe
+	.long	.LASF1963
+	.byte	0xe
+	.long	.LASF1964
+	.byte	0xe
+	.long	.LASF1965
+	.byte	0xc
+	.long	.LASF1966
+	.byte	0xb
+	.long	.LASF1967
+	.byte	0xa
+	.long	.LASF1968
+	.byte	0x12
+	.long	.LASF1969
+	.byte	0xb
+	.long	.LASF1970
+	.byte	0xb
+	.long	.LASF1971
+	.byte	0x1
+	.long	.LASF1972
+	.byte	0x1
+	.long	.LASF1973
+	.byte	0x3
+	.long	.LASF1974
+	.byte	0x2
+	.long	.LASF1975
+	.byte	0x2
+	.long	.LASF1976
+	.byte	0x4
+	.long	.LASF1977
+	.byte	0x4
+	.long	.LASF1978
+	.byte	0x5
+	.long	.LASF1979
+	.byte	0x5
+	.long	.LASF1980
+	.byte	0x7
+	.long	.LASF1981
+	.byte	0x11
+	.long	.LASF1982
+	.byte	0xe
+	.long	.LASF1983
+	.byte	0xe
+	.long	.LASF1984
+	.byte	0xe
+	.long	.LASF1985
+	.byte	0xe
+	.long	.LASF1986
+	.byte	0xe
+	.long	.LASF1987
+	.byte	0xe
+	.long	.LASF1988
+	.byte	0xe
+	.long	.LASF1989
+	.byte	0xe
+	.long	.LASF1990
+	.byte	0xe
+	.long	.LASF1991
+	.byte	0x6
+	.long	.LASF1992
+	.byte	0x2
+	.long	.LASF1993
+	.byte	0x11
+	.long	.LASF1994
+	.byte	0xd
+	.long	.LASF1995
+	.byte	0xd
+	.long	.LASF1996
+	.byte	0x11
+	.long	.LASF1997
+	.byte	0x4
+	.long	.LASF1998
+	.byte	0x4
+	.long	.LASF1999
+	.byte	0x4
+	.long	.LASF2000
+	.byte	0x4
+	.long	.LASF2001
+	.byte	0x4
+	.long	.LASF2002
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1230:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1791:
+	.string	"navState"
+.LASF1775:
+	.string	"navigationFSMState_t"
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1113:
+	.string	"__DECL_SIMD_logf "
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1318:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1019:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF852:
+	.string	"USE_BARO "
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1329:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1231:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF1585:
+	.string	"FEATURE_TRANSPONDER"
+.LASF969:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1520:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1745:
+	.string	"NAV_STATE_POSHOLD_3D_IN_PROGRESS"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF1789:
+	.string	"homeTmpWaypoint"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1677:
+	.string	"horizontalPositionDataNew"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1036:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1286:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1123:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1648:
+	.string	"reset"
+.LASF929:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1226:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1342:
+	.string	"__DECL_SIMD_tan "
+.LASF1327:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1642:
+	.string	"gpsOrigin_t"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1546:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1803:
+	.string	"rthState"
+.LASF968:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1633:
+	.string	"_Bool"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1081:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF1719:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_PRE_ACTION"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF1507:
+	.string	"DMA_NONE (0)"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1678:
+	.string	"verticalPositionDataNew"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1391:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1290:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1850:
+	.string	"DEVHW_AK8963"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1747:
+	.string	"NAV_STATE_RTH_CLIMB_TO_SAFE_ALT"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1873:
+	.string	"DEVHW_M25P16"
+.LASF1218:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1270:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1499:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1031:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1086:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1872:
+	.string	"DEVHW_PCA9685"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1187:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1716:
+	.string	"NAV_PERSISTENT_ID_RTH_FINISHING"
+.LASF1493:
+	.string	"NAV_THROTTLE_CUTOFF_FREQENCY_HZ 4"
+.LASF1818:
+	.string	"navigationPosControl_t"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1375:
+	.string	"__f32x(x) x ##f32x"
+.LASF951:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1079:
+	.string	"HDOP_SCALE (100)"
+.LASF1219:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1127:
+	.string	"__DECL_SIMD_expf64 "
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF982:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1769:
+	.string	"NAV_STATE_CRUISE_2D_IN_PROGRESS"
+.LASF1489:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF1173:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1293:
+	.string	"__DECL_SIMD_acoshf "
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1098:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF759:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1224:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1147:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1455:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1663:
+	.string	"fw_nav"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1634:
+	.string	"pt1Filter_s"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1574:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1558:
+	.string	"uint16_t"
+.LASF1124:
+	.string	"__DECL_SIMD_expl "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1459:
+	.string	"MATH_ERREXCEPT 2"
+.LASF373:
+	.string	"linux 1"
+.LASF978:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1755:
+	.string	"NAV_STATE_WAYPOINT_PRE_ACTION"
+.LASF1802:
+	.string	"rthSanityChecker"
+.LASF956:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1689:
+	.string	"isAdjustingHeading"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1851:
+	.string	"DEVHW_AK8975"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF1835:
+	.string	"DEVHW_MPU6000"
+.LASF941:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1454:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1080:
+	.string	"_MATH_H 1"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1094:
+	.string	"__DECL_SIMD_sinl "
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1096:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1347:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1056:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1766:
+	.string	"NAV_STATE_LAUNCH_WAIT"
+.LASF997:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1333:
+	.string	"__DECL_SIMD_erfcf "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1022:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF1049:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1115:
+	.string	"__DECL_SIMD_logf16 "
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1794:
+	.string	"pids"
+.LASF1365:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF983:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1037:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1797:
+	.string	"actualState"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1114:
+	.string	"__DECL_SIMD_logl "
+.LASF1388:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1531:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1710:
+	.string	"NAV_PERSISTENT_ID_RTH_INITIALIZE"
+.LASF1750:
+	.string	"NAV_STATE_RTH_HOVER_ABOVE_HOME"
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1351:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF932:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1798:
+	.string	"desiredState"
+.LASF1018:
+	.string	"BIT(x) (1 << (x))"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1034:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1122:
+	.string	"__DECL_SIMD_exp "
+.LASF1332:
+	.string	"__DECL_SIMD_erfc "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1406:
+	.string	"_Mdouble_"
+.LASF1556:
+	.string	"int32_t"
+.LASF1354:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1660:
+	.string	"navigationPIDControllers_s"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF1452:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1708:
+	.string	"NAV_PERSISTENT_ID_POSHOLD_3D_INITIALIZE"
+.LASF1884:
+	.string	"busDeviceDescriptor_t"
+.LASF1306:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1502:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1854:
+	.string	"DEVHW_IST8308"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1720:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_IN_PROGRESS"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1751:
+	.string	"NAV_STATE_RTH_LANDING"
+.LASF1540:
+	.string	"unsigned char"
+.LASF1658:
+	.string	"output_constrained"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1757:
+	.string	"NAV_STATE_WAYPOINT_REACHED"
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1610:
+	.string	"axisAccelerationLimitYaw"
+.LASF1721:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_REACHED"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1059:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1773:
+	.string	"NAV_STATE_CRUISE_3D_ADJUSTING"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1188:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1307:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1584:
+	.string	"FEATURE_UNUSED_10"
+.LASF1591:
+	.string	"FEATURE_UNUSED_11"
+.LASF1731:
+	.string	"NAV_PERSISTENT_ID_LAUNCH_IN_PROGRESS"
+.LASF1220:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1842:
+	.string	"DEVHW_BMP280"
+.LASF1013:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1407:
+	.string	"__MATH_PRECNAME"
+.LASF1257:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1437:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF1603:
+	.string	"dterm_lpf_type"
+.LASF1439:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1890:
+	.string	"pitotDev_s"
+.LASF1896:
+	.string	"pitotDev_t"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF1410:
+	.string	"_Mdouble_ float"
+.LASF1709:
+	.string	"NAV_PERSISTENT_ID_POSHOLD_3D_IN_PROGRESS"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1637:
+	.string	"double"
+.LASF1777:
+	.string	"initialPosition"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1394:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF1866:
+	.string	"DEVHW_DS2482"
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF1400:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF996:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1294:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1443:
+	.string	"__MATHCALL_NARROW"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1836:
+	.string	"DEVHW_MPU6050"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1616:
+	.string	"fixedWingReferenceAirspeed"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1428:
+	.string	"__MATHDECL_1"
+.LASF1664:
+	.string	"fw_heading"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1380:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF396:
+	.string	"false 0"
+.LASF1303:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF943:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1364:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1692:
+	.string	"isTerrainFollowEnabled"
+.LASF1681:
+	.string	"verticalPositionDataConsumed"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1900:
+	.string	"pitotIsCalibrationComplete"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1613:
+	.string	"pidSumLimit"
+.LASF1275:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1170:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1041:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1182:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1200:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1858:
+	.string	"DEVHW_LM75_0"
+.LASF1859:
+	.string	"DEVHW_LM75_1"
+.LASF1860:
+	.string	"DEVHW_LM75_2"
+.LASF1604:
+	.string	"dterm_lpf_hz"
+.LASF1862:
+	.string	"DEVHW_LM75_4"
+.LASF1863:
+	.string	"DEVHW_LM75_5"
+.LASF1864:
+	.string	"DEVHW_LM75_6"
+.LASF1865:
+	.string	"DEVHW_LM75_7"
+.LASF1402:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1356:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF963:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1783:
+	.string	"navCruise_t"
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1583:
+	.string	"FEATURE_BLACKBOX"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1565:
+	.string	"FEATURE_VBAT"
+.LASF1021:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1359:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF993:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF954:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1518:
+	.string	"SPIDEV_COUNT 4"
+.LASF1239:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1756:
+	.string	"NAV_STATE_WAYPOINT_IN_PROGRESS"
+.LASF1207:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF1071:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1736:
+	.string	"NAV_PERSISTENT_ID_CRUISE_3D_IN_PROGRESS"
+.LASF1608:
+	.string	"heading_hold_rate_limit"
+.LASF1539:
+	.string	"P0 101325.0f"
+.LASF1741:
+	.string	"NAV_STATE_IDLE"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1044:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1661:
+	.string	"surface"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1141:
+	.string	"__DECL_SIMD_powf128x "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1543:
+	.string	"long unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1538:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF1671:
+	.string	"NAV_HOME_VALID_XY"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF935:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1768:
+	.string	"NAV_STATE_CRUISE_2D_INITIALIZE"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1724:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_RTH_LAND"
+.LASF1547:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1058:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1549:
+	.string	"__uint16_t"
+.LASF1379:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1592:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF1208:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1823:
+	.string	"BUSTYPE_I2C"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1899:
+	.string	"isEstimatedWindSpeedValid"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1666:
+	.string	"EST_NONE"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF1519:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1253:
+	.string	"__DECL_SIMD_log10f "
+.LASF1116:
+	.string	"__DECL_SIMD_logf32 "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1178:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1350:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1069:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1465:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1790:
+	.string	"rthState_t"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1030:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1246:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1586:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1209:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1305:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1283:
+	.string	"__DECL_SIMD_atanhf "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1110:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1138:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1179:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1640:
+	.string	"valid"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF921:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1510:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF964:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1847:
+	.string	"DEVHW_BMP388"
+.LASF1196:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1526:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF1472:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1007:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1441:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF992:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1792:
+	.string	"navPersistentId"
+.LASF1641:
+	.string	"scale"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1065:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1568:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1385:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1032:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF933:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF981:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1739:
+	.string	"navigationPersistentId_e"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1477:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF713:
+	.string	"USE_NAV "
+.LASF1673:
+	.string	"NAV_HOME_VALID_HEADING"
+.LASF1174:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1759:
+	.string	"NAV_STATE_WAYPOINT_NEXT"
+.LASF908:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1561:
+	.string	"float"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1623:
+	.string	"iterm_relax"
+.LASF1650:
+	.string	"dterm_filter_state"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1762:
+	.string	"NAV_STATE_EMERGENCY_LANDING_INITIALIZE"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1408:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1430:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1304:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1488:
+	.string	"NAV_BLACKBOX "
+.LASF1165:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1570:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF916:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1469:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1261:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1503:
+	.string	"_STRINGS_H 1"
+.LASF965:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1744:
+	.string	"NAV_STATE_POSHOLD_3D_INITIALIZE"
+.LASF1805:
+	.string	"homeDirection"
+.LASF1533:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF711:
+	.string	"USE_GPS "
+.LASF1712:
+	.string	"NAV_PERSISTENT_ID_RTH_HEAD_HOME"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF953:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1155:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1458:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1573:
+	.string	"FEATURE_UNUSED_4"
+.LASF1577:
+	.string	"FEATURE_UNUSED_5"
+.LASF1578:
+	.string	"FEATURE_UNUSED_6"
+.LASF1582:
+	.string	"FEATURE_UNUSED_7"
+.LASF1589:
+	.string	"FEATURE_UNUSED_8"
+.LASF1590:
+	.string	"FEATURE_UNUSED_9"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1414:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1451:
+	.string	"FP_NORMAL 4"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1788:
+	.string	"rthInitialDistance"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1150:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1177:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1527:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1871:
+	.string	"DEVHW_MS4525"
+.LASF1203:
+	.string	"__DECL_SIMD_coshf "
+.LASF1212:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1284:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1301:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1276:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1449:
+	.string	"FP_ZERO 2"
+.LASF1335:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1181:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1868:
+	.string	"DEVHW_SRF10"
+.LASF1424:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1228:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF998:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1404:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1620:
+	.string	"navVelXyDTermLpfHz"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF975:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1091:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1254:
+	.string	"__DECL_SIMD_log10l "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1045:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF1131:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1705:
+	.string	"NAV_PERSISTENT_ID_ALTHOLD_IN_PROGRESS"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF988:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1277:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1367:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1082:
+	.string	"__DECL_SIMD_cos "
+.LASF1686:
+	.string	"estHeadingStatus"
+.LASF1560:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1241:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1054:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF925:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1260:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1163:
+	.string	"__DECL_SIMD_asinf "
+.LASF1265:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1201:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1714:
+	.string	"NAV_PERSISTENT_ID_RTH_HOVER_ABOVE_HOME"
+.LASF1029:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1434:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1781:
+	.string	"previousYaw"
+.LASF1189:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1817:
+	.string	"totalTripDistance"
+.LASF1418:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1130:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1512:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1287:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1083:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1227:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1581:
+	.string	"FEATURE_DASHBOARD"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1471:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1376:
+	.string	"__f64x(x) x ##f64x"
+.LASF994:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1468:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1770:
+	.string	"NAV_STATE_CRUISE_2D_ADJUSTING"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1625:
+	.string	"dBoostMaxAtAlleceleration"
+.LASF1557:
+	.string	"uint8_t"
+.LASF1393:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1525:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF1063:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1419:
+	.string	"_Mdouble_ _Float64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF976:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1754:
+	.string	"NAV_STATE_WAYPOINT_INITIALIZE"
+.LASF1618:
+	.string	"fixedWingItermLimitOnStickPosition"
+.LASF1160:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1015:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1038:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1839:
+	.string	"DEVHW_ICM20689"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1148:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1811:
+	.string	"activeWaypointIndex"
+.LASF1672:
+	.string	"NAV_HOME_VALID_Z"
+.LASF1067:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1340:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1302:
+	.string	"__DECL_SIMD_erf "
+.LASF1214:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1649:
+	.string	"param"
+.LASF885:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1887:
+	.string	"scratchpad"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1905:
+	.string	"airSpeed"
+.LASF1683:
+	.string	"estPosStatus"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1888:
+	.string	"busDevice_t"
+.LASF376:
+	.string	"unix 1"
+.LASF1448:
+	.string	"FP_INFINITE 1"
+.LASF1438:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1202:
+	.string	"__DECL_SIMD_cosh "
+.LASF1440:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1092:
+	.string	"__DECL_SIMD_sin "
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF1629:
+	.string	"antigravityCutoff"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF1105:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1856:
+	.string	"DEVHW_MAG3110"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1869:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1358:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1645:
+	.string	"navWaypoint_t"
+.LASF886:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF822:
+	.string	"__need_size_t"
+.LASF936:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1562:
+	.string	"ioTag_t"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF1135:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1166:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1669:
+	.string	"navigationEstimateStatus_e"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF915:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1409:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1422:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1072:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF1289:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1718:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_INITIALIZE"
+.LASF1727:
+	.string	"NAV_PERSISTENT_ID_EMERGENCY_LANDING_FINISHED"
+.LASF1028:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1186:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1185:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1369:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1812:
+	.string	"wpInitialAltitude"
+.LASF1700:
+	.string	"navigationEstimatedState_t"
+.LASF1779:
+	.string	"rthSanityChecker_t"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1120:
+	.string	"__DECL_SIMD_logf64x "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1411:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1068:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1530:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF940:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1607:
+	.string	"yaw_lpf_hz"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1238:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1829:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1814:
+	.string	"wpDistance"
+.LASF1831:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1566:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1326:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1279:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1215:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1801:
+	.string	"gpsOrigin"
+.LASF1815:
+	.string	"wpReachedTime"
+.LASF1027:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1217:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1822:
+	.string	"BUSTYPE_NONE"
+.LASF1776:
+	.string	"lastCheckTime"
+.LASF1535:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1760:
+	.string	"NAV_STATE_WAYPOINT_FINISHED"
+.LASF1911:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1600:
+	.string	"pidControllerType"
+.LASF1357:
+	.string	"__f128(x) x ##f128"
+.LASF1295:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1413:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF984:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1336:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF995:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1247:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1813:
+	.string	"wpInitialDistance"
+.LASF1164:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1771:
+	.string	"NAV_STATE_CRUISE_3D_INITIALIZE"
+.LASF1346:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1696:
+	.string	"sinYaw"
+.LASF927:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1236:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1001:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1420:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1242:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1732:
+	.string	"NAV_PERSISTENT_ID_CRUISE_2D_INITIALIZE"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1084:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1619:
+	.string	"loiter_direction"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1396:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF949:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF841:
+	.string	"NULL"
+.LASF1481:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1244:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1309:
+	.string	"__DECL_SIMD_erff32x "
+.LASF1412:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF938:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1695:
+	.string	"navEstimatedPosVel_t"
+.LASF1785:
+	.string	"homePosition"
+.LASF466:
+	.string	"__PMT"
+.LASF1010:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1599:
+	.string	"pidProfile_s"
+.LASF1632:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1885:
+	.string	"busDevice_s"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1832:
+	.string	"DEVHW_L3GD20"
+.LASF1464:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1263:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1729:
+	.string	"NAV_PERSISTENT_ID_LAUNCH_WAIT"
+.LASF1796:
+	.string	"posResponseExpo"
+.LASF1425:
+	.string	"_Mdouble_ _Float64x"
+.LASF1108:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1312:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1048:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1450:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1355:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1317:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1389:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1288:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF1035:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1345:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1784:
+	.string	"homeFlags"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1494:
+	.string	"NAV_FW_CONTROL_MONITORING_RATE 2"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1682:
+	.string	"estAltStatus"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1009:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF919:
+	.string	"UNIT_TESTED "
+.LASF1901:
+	.string	"feature"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1161:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF1810:
+	.string	"activeWaypoint"
+.LASF1630:
+	.string	"navFwPosHdgPidsumLimit"
+.LASF1656:
+	.string	"derivative"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1704:
+	.string	"NAV_PERSISTENT_ID_ALTHOLD_INITIALIZE"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1398:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1371:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF957:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF937:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1421:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1331:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1278:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1691:
+	.string	"isGCSAssistedNavigationReset"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1554:
+	.string	"int8_t"
+.LASF1693:
+	.string	"forcedRTHActivated"
+.LASF1073:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1140:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1274:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1156:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1644:
+	.string	"flag"
+.LASF1106:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF843:
+	.string	"__need_NULL"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1442:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1423:
+	.string	"_Mdouble_ _Float32x"
+.LASF1806:
+	.string	"cruise"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1436:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1223:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1386:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1168:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1136:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1528:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1267:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1490:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1152:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1429:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1907:
+	.string	"windSpeed"
+.LASF1042:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF991:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1826:
+	.string	"busType_e"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1910:
+	.string	"virtualPitotStart"
+.LASF1175:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1004:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1534:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1715:
+	.string	"NAV_PERSISTENT_ID_RTH_LANDING"
+.LASF1169:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1606:
+	.string	"dterm_lpf2_hz"
+.LASF1475:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1272:
+	.string	"__DECL_SIMD_log1p "
+.LASF1344:
+	.string	"__DECL_SIMD_tanl "
+.LASF1861:
+	.string	"DEVHW_LM75_3"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"USE_LOG "
+.LASF1171:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1153:
+	.string	"__DECL_SIMD_atanf "
+.LASF928:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1498:
+	.string	"_STRING_H 1"
+.LASF1555:
+	.string	"int16_t"
+.LASF1298:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1541:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1876:
+	.string	"DEVHW_IRLOCK"
+.LASF1544:
+	.string	"signed char"
+.LASF1372:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF952:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1117:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1631:
+	.string	"controlDerivativeLpfHz"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1761:
+	.string	"NAV_STATE_WAYPOINT_RTH_LAND"
+.LASF1216:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1893:
+	.string	"start"
+.LASF804:
+	.string	"__size_t__ "
+.LASF959:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1445:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1521:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1221:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF971:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF1587:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1753:
+	.string	"NAV_STATE_RTH_FINISHED"
+.LASF1579:
+	.string	"FEATURE_RSSI_ADC"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1300:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF967:
+	.string	"sq(x) ((x)*(x))"
+.LASF1112:
+	.string	"__DECL_SIMD_log "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1433:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1837:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1374:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1070:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF1506:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1476:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1524:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1311:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1453:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1264:
+	.string	"__DECL_SIMD_log2l "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1363:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF1622:
+	.string	"iterm_relax_cutoff"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1511:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1415:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1635:
+	.string	"state"
+.LASF1651:
+	.string	"dTermLpfHz"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF931:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1325:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1460:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1157:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1118:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1737:
+	.string	"NAV_PERSISTENT_ID_CRUISE_3D_ADJUSTING"
+.LASF1240:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1569:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1572:
+	.string	"FEATURE_UNUSED_3"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1055:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1908:
+	.string	"horizontalWindSpeed"
+.LASF1467:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF955:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1046:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1384:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1889:
+	.string	"pitotOpFuncPtr"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1109:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1033:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1268:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1024:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1353:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1575:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1235:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1748:
+	.string	"NAV_STATE_RTH_HEAD_HOME"
+.LASF1894:
+	.string	"calculate"
+.LASF926:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF961:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1191:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1515:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1102:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1125:
+	.string	"__DECL_SIMD_expf16 "
+.LASF945:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1804:
+	.string	"homeDistance"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1723:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_FINISHED"
+.LASF1852:
+	.string	"DEVHW_IST8310_0"
+.LASF1853:
+	.string	"DEVHW_IST8310_1"
+.LASF1593:
+	.string	"FEATURE_OSD"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF946:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1362:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1903:
+	.string	"pressure"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1874:
+	.string	"DEVHW_UG2864"
+.LASF1195:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF960:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1552:
+	.string	"long int"
+.LASF1740:
+	.string	"NAV_STATE_UNDEFINED"
+.LASF1913:
+	.string	"virtualPitotCalculate"
+.LASF1827:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1898:
+	.string	"getEstimatedHorizontalWindSpeed"
+.LASF1101:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1513:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1906:
+	.string	"windHeading"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF1749:
+	.string	"NAV_STATE_RTH_HOVER_PRIOR_TO_LANDING"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF973:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1485:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1702:
+	.string	"NAV_PERSISTENT_ID_UNDEFINED"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1017:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1838:
+	.string	"DEVHW_BMI160"
+.LASF1229:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1849:
+	.string	"DEVHW_HMC5883"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1397:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1483:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1039:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1232:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1787:
+	.string	"rthFinalAltitude"
+.LASF1014:
+	.string	"EXPAND_I(x) x"
+.LASF1100:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1403:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1559:
+	.string	"uint32_t"
+.LASF1726:
+	.string	"NAV_PERSISTENT_ID_EMERGENCY_LANDING_IN_PROGRESS"
+.LASF1819:
+	.string	"pidProfile_ProfileCurrent"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1480:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1377:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1470:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1845:
+	.string	"DEVHW_LPS25H"
+.LASF1262:
+	.string	"__DECL_SIMD_log2 "
+.LASF1668:
+	.string	"EST_TRUSTED"
+.LASF1000:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1902:
+	.string	"pitot"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1250:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1281:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1197:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF809:
+	.string	"_T_SIZE "
+.LASF1808:
+	.string	"waypointListValid"
+.LASF1378:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1432:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1291:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF489:
+	.string	"__flexarr []"
+.LASF1601:
+	.string	"bank_fw"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1725:
+	.string	"NAV_PERSISTENT_ID_EMERGENCY_LANDING_INITIALIZE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1886:
+	.string	"descriptorPtr"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1466:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1800:
+	.string	"lastValidAltitudeTimeMs"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1597:
+	.string	"pidBank_s"
+.LASF948:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1735:
+	.string	"NAV_PERSISTENT_ID_CRUISE_3D_INITIALIZE"
+.LASF1764:
+	.string	"NAV_STATE_EMERGENCY_LANDING_FINISHED"
+.LASF1614:
+	.string	"pidSumLimitYaw"
+.LASF930:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1486:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1624:
+	.string	"dBoostFactor"
+.LASF1665:
+	.string	"navigationPIDControllers_t"
+.LASF1824:
+	.string	"BUSTYPE_SPI"
+.LASF1774:
+	.string	"NAV_STATE_COUNT"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1074:
+	.string	"LAT 0"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF1553:
+	.string	"char"
+.LASF1655:
+	.string	"proportional"
+.LASF1765:
+	.string	"NAV_STATE_LAUNCH_INITIALIZE"
+.LASF1679:
+	.string	"headingDataNew"
+.LASF1258:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1172:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1320:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1366:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1567:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1088:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF980:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1255:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1825:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1563:
+	.string	"IO_t"
+.LASF1594:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1040:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF854:
+	.string	"USE_UART2 "
+.LASF1128:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1087:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1259:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1151:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF924:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF990:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF1006:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF1746:
+	.string	"NAV_STATE_RTH_INITIALIZE"
+.LASF1089:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1782:
+	.string	"lastYawAdjustmentTime"
+.LASF1657:
+	.string	"feedForward"
+.LASF1891:
+	.string	"busDev"
+.LASF1143:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1129:
+	.string	"__DECL_SIMD_expf32x "
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF986:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1615:
+	.string	"fixedWingItermThrowLimit"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1834:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1361:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1285:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF821:
+	.string	"__size_t "
+.LASF1500:
+	.string	"__need_NULL "
+.LASF1050:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF966:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1234:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF1338:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1167:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1857:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1763:
+	.string	"NAV_STATE_EMERGENCY_LANDING_IN_PROGRESS"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1323:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1299:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1012:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1266:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF917:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1496:
+	.string	"NAV_ACCELERATION_XY_MAX 980.0f"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1339:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1193:
+	.string	"__DECL_SIMD_exp10f "
+.LASF1126:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1758:
+	.string	"NAV_STATE_WAYPOINT_HOLD_TIME"
+.LASF1047:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1912:
+	.string	"virtualPitotDetect"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1457:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF958:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1532:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1248:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1292:
+	.string	"__DECL_SIMD_acosh "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1807:
+	.string	"waypointList"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1522:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1738:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_HOLD_TIME"
+.LASF1444:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1269:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1447:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1249:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF1205:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1463:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1588:
+	.string	"FEATURE_VTX"
+.LASF977:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1348:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1395:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1833:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1652:
+	.string	"integrator"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1337:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1509:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1142:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1213:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1237:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1119:
+	.string	"__DECL_SIMD_logf32x "
+.LASF942:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1405:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1149:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1752:
+	.string	"NAV_STATE_RTH_FINISHING"
+.LASF1628:
+	.string	"antigravityAccelerator"
+.LASF1461:
+	.string	"M_E 2.7182818284590452354"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1382:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1474:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1602:
+	.string	"bank_mc"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1145:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1492:
+	.string	"MIN_POSITION_UPDATE_RATE_HZ 5"
+.LASF1697:
+	.string	"cosYaw"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1778:
+	.string	"minimalDistanceToHome"
+.LASF1401:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1909:
+	.string	"virtualPitotRead"
+.LASF1482:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1023:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1895:
+	.string	"pitotCalculateFuncPtr"
+.LASF1315:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1053:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1319:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1183:
+	.string	"__DECL_SIMD_exp2f "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1190:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1571:
+	.string	"FEATURE_GPS"
+.LASF1609:
+	.string	"itermWindupPointPercent"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1051:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1462:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1701:
+	.string	"navigationDesiredState_t"
+.LASF1685:
+	.string	"estAglStatus"
+.LASF1636:
+	.string	"pt1Filter_t"
+.LASF1550:
+	.string	"__int32_t"
+.LASF1132:
+	.string	"__DECL_SIMD_pow "
+.LASF1456:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1551:
+	.string	"__uint32_t"
+.LASF1713:
+	.string	"NAV_PERSISTENT_ID_RTH_HOVER_PRIOR_TO_LANDING"
+.LASF1516:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1330:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1435:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1639:
+	.string	"gpsOrigin_s"
+.LASF1580:
+	.string	"FEATURE_LED_STRIP"
+.LASF1505:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1883:
+	.string	"irqPin"
+.LASF1840:
+	.string	"DEVHW_MPU9250"
+.LASF1536:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1882:
+	.string	"busdev"
+.LASF1688:
+	.string	"isAdjustingAltitude"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1684:
+	.string	"estVelStatus"
+.LASF1144:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1417:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1322:
+	.string	"__DECL_SIMD_asinh "
+.LASF1061:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1005:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1280:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1133:
+	.string	"__DECL_SIMD_powf "
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF1016:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1139:
+	.string	"__DECL_SIMD_powf32x "
+.LASF820:
+	.string	"_SIZET_ "
+.LASF1383:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1734:
+	.string	"NAV_PERSISTENT_ID_CRUISE_2D_ADJUSTING"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1162:
+	.string	"__DECL_SIMD_asin "
+.LASF1879:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1491:
+	.string	"DISTANCE_BETWEEN_TWO_LONGITUDE_POINTS_AT_EQUATOR 1.113195f"
+.LASF1064:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1431:
+	.string	"__MATHCALL"
+.LASF1256:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1617:
+	.string	"fixedWingCoordinatedYawGain"
+.LASF1324:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1576:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1204:
+	.string	"__DECL_SIMD_coshl "
+.LASF758:
+	.string	"USE_STATS "
+.LASF851:
+	.string	"USE_MAG "
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1478:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1717:
+	.string	"NAV_PERSISTENT_ID_RTH_FINISHED"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1282:
+	.string	"__DECL_SIMD_atanh "
+.LASF1095:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1077:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1390:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1194:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1271:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1373:
+	.string	"__f32(x) x ##f32"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF1479:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1349:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1211:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1529:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1653:
+	.string	"last_input"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1667:
+	.string	"EST_USABLE"
+.LASF1904:
+	.string	"temperature"
+.LASF1107:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF1611:
+	.string	"axisAccelerationLimitRollPitch"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1368:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1020:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF1310:
+	.string	"__DECL_SIMD_erff64x "
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1251:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1612:
+	.string	"max_angle_inclination"
+.LASF1844:
+	.string	"DEVHW_MS5607"
+.LASF1137:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1103:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1676:
+	.string	"navigationFlags_s"
+.LASF1694:
+	.string	"navigationFlags_t"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1809:
+	.string	"waypointCount"
+.LASF1690:
+	.string	"isGCSAssistedNavigationEnabled"
+.LASF1780:
+	.string	"targetPos"
+.LASF1830:
+	.string	"DEVHW_MMA8452"
+.LASF1675:
+	.string	"navigationHomeFlags_t"
+.LASF1159:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1075:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF962:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1099:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1495:
+	.string	"NAV_DTERM_CUT_HZ 10.0f"
+.LASF1025:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1728:
+	.string	"NAV_PERSISTENT_ID_LAUNCH_INITIALIZE"
+.LASF1381:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1360:
+	.string	"__HAVE_FLOAT16 0"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1352:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1062:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF1843:
+	.string	"DEVHW_MS5611"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1484:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1002:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1870:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1416:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1706:
+	.string	"NAV_PERSISTENT_ID_UNUSED_1"
+.LASF1707:
+	.string	"NAV_PERSISTENT_ID_UNUSED_2"
+.LASF1730:
+	.string	"NAV_PERSISTENT_ID_UNUSED_3"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF922:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1273:
+	.string	"__DECL_SIMD_log1pf "
+.LASF950:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1057:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1643:
+	.string	"action"
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1026:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1210:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1321:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1875:
+	.string	"DEVHW_SDCARD"
+.LASF1192:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1799:
+	.string	"lastValidPositionTimeMs"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1698:
+	.string	"surfaceMin"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1206:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1180:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1855:
+	.string	"DEVHW_QMC5883"
+.LASF1297:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1097:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF1158:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1313:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1654:
+	.string	"integral"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1772:
+	.string	"NAV_STATE_CRUISE_3D_IN_PROGRESS"
+.LASF1699:
+	.string	"velXY"
+.LASF1881:
+	.string	"devHwType"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1370:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1647:
+	.string	"pidControllerParam_t"
+.LASF1711:
+	.string	"NAV_PERSISTENT_ID_RTH_CLIMB_TO_SAFE_ALT"
+.LASF1052:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1090:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1011:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF918:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1154:
+	.string	"__DECL_SIMD_atanl "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1877:
+	.string	"devHardwareType_e"
+.LASF1605:
+	.string	"dterm_lpf2_type"
+.LASF999:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1703:
+	.string	"NAV_PERSISTENT_ID_IDLE"
+.LASF1487:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF394:
+	.string	"bool _Bool"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1252:
+	.string	"__DECL_SIMD_log10 "
+.LASF1198:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1308:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1742:
+	.string	"NAV_STATE_ALTHOLD_INITIALIZE"
+.LASF1225:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1733:
+	.string	"NAV_PERSISTENT_ID_CRUISE_2D_IN_PROGRESS"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF1146:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF970:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1233:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1828:
+	.string	"DEVHW_BMA280"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF1134:
+	.string	"__DECL_SIMD_powl "
+.LASF1846:
+	.string	"DEVHW_SPL06"
+.LASF1687:
+	.string	"isAdjustingPosition"
+.LASF1821:
+	.string	"BUSTYPE_ANY"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1504:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1111:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1316:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1564:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1626:
+	.string	"dBoostGyroDeltaLpfHz"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF985:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1820:
+	.string	"posControl"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+.LASF920:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1659:
+	.string	"pidController_t"
+.LASF371:
+	.string	"__linux 1"
+.LASF1848:
+	.string	"DEVHW_DPS310"
+.LASF1426:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1078:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF853:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF974:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1066:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF1497:
+	.string	"INAV_SURFACE_MAX_DISTANCE 40"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1914:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1473:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1722:
+	.string	"NAV_PERSISTENT_ID_WAYPOINT_NEXT"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1085:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1743:
+	.string	"NAV_STATE_ALTHOLD_IN_PROGRESS"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1043:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1003:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1508:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1076:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF934:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1104:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1501:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1767:
+	.string	"NAV_STATE_LAUNCH_IN_PROGRESS"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1387:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1816:
+	.string	"rcAdjustment"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1841:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1627:
+	.string	"antigravityGain"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1646:
+	.string	"navWaypointPosition_t"
+.LASF989:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1184:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1121:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1878:
+	.string	"busDeviceDescriptor_s"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF979:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1399:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1545:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1795:
+	.string	"posDecelerationTime"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1008:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF939:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF1060:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF987:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1892:
+	.string	"delay"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF972:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1598:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1296:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1542:
+	.string	"unsigned int"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF1176:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1343:
+	.string	"__DECL_SIMD_tanf "
+.LASF1341:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1674:
+	.string	"NAV_HOME_VALID_ALL"
+.LASF1446:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1537:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF1523:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1786:
+	.string	"rthInitialAltitude"
+.LASF1638:
+	.string	"fpVector3_t"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1243:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1595:
+	.string	"pid8_t"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1314:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1680:
+	.string	"horizontalPositionDataConsumed"
+.LASF947:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1392:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1548:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1093:
+	.string	"__DECL_SIMD_sinf "
+.LASF1662:
+	.string	"fw_alt"
+.LASF1245:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1517:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1670:
+	.string	"NAV_HOME_INVALID"
+.LASF23:
+	.string	"_LP64 1"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1427:
+	.string	"__MATHDECL_1_IMPL"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1334:
+	.string	"__DECL_SIMD_erfcl "
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF923:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1199:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1880:
+	.string	"busType"
+.LASF1596:
+	.string	"pid8_s"
+.LASF944:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1867:
+	.string	"DEVHW_MAX7456"
+.LASF1621:
+	.string	"iterm_relax_type"
+.LASF1222:
+	.string	"__DECL_SIMD_sinh "
+.LASF1793:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1328:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1514:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1897:
+	.string	"cos_approx"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1999:
+	.string	"rcc_types.h"
+.LASF1937:
+	.string	"io_types.h"
+.LASF1989:
+	.string	"mathcalls-helper-functions.h"
+.LASF1981:
+	.string	"math.h"
+.LASF1959:
+	.string	"long-double.h"
+.LASF1995:
+	.string	"__locale_t.h"
+.LASF1965:
+	.string	"platform.h"
+.LASF1990:
+	.string	"mathcalls.h"
+.LASF1918:
+	.string	"src/main/drivers"
+.LASF1977:
+	.string	"rx_pwm.h"
+.LASF1953:
+	.string	"libc-header-start.h"
+.LASF1930:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2002:
+	.string	"pitotmeter_virtual.h"
+.LASF1922:
+	.string	"src/main/navigation"
+.LASF2001:
+	.string	"dma.h"
+.LASF1934:
+	.string	"stdint-intn.h"
+.LASF1967:
+	.string	"target.h"
+.LASF1974:
+	.string	"axis.h"
+.LASF1929:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1932:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1960:
+	.string	"stubs.h"
+.LASF0:
+	.string	"./src/main/drivers/pitotmeter_virtual.c"
+.LASF1943:
+	.string	"navigation_private.h"
+.LASF1924:
+	.string	"src/main/target/SITL"
+.LASF1971:
+	.string	"build_config.h"
+.LASF1921:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1958:
+	.string	"cdefs.h"
+.LASF1928:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1991:
+	.string	"failsafe.h"
+.LASF1942:
+	.string	"config.h"
+.LASF1998:
+	.string	"bus_i2c.h"
+.LASF2000:
+	.string	"bus_spi.h"
+.LASF1996:
+	.string	"strings.h"
+.LASF1955:
+	.string	"features-time64.h"
+.LASF1933:
+	.string	"types.h"
+.LASF1982:
+	.string	"math-vector.h"
+.LASF1985:
+	.string	"floatn-common.h"
+.LASF1984:
+	.string	"floatn.h"
+.LASF1957:
+	.string	"timesize.h"
+.LASF1951:
+	.string	"stdbool.h"
+.LASF1931:
+	.string	"/usr/include"
+.LASF1983:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1915:
+	.string	"src/main/build"
+.LASF1948:
+	.string	"feature.h"
+.LASF1979:
+	.string	"runtime_config.h"
+.LASF1954:
+	.string	"features.h"
+.LASF1920:
+	.string	"src/main/flight"
+.LASF1962:
+	.string	"typesizes.h"
+.LASF1916:
+	.string	"src/main/common"
+.LASF1917:
+	.string	"src/main/config"
+.LASF1950:
+	.string	"stdc-predef.h"
+.LASF1941:
+	.string	"navigation.h"
+.LASF1963:
+	.string	"time64.h"
+.LASF1935:
+	.string	"stdint-uintn.h"
+.LASF1925:
+	.string	"src/main/target"
+.LASF1975:
+	.string	"utils.h"
+.LASF1944:
+	.string	"bus.h"
+.LASF1980:
+	.string	"gps.h"
+.LASF1923:
+	.string	"src/main/sensors"
+.LASF1986:
+	.string	"flt-eval-method.h"
+.LASF1926:
+	.string	"src/main"
+.LASF1945:
+	.string	"pitotmeter.h"
+.LASF1936:
+	.string	"time.h"
+.LASF1972:
+	.string	"debug.h"
+.LASF1964:
+	.string	"wchar.h"
+.LASF1988:
+	.string	"fp-fast.h"
+.LASF1978:
+	.string	"stats.h"
+.LASF1949:
+	.string	"pitotmeter_virtual.c"
+.LASF1919:
+	.string	"src/main/fc"
+.LASF1966:
+	.string	"common.h"
+.LASF1946:
+	.string	"maths.h"
+.LASF1987:
+	.string	"fp-logb.h"
+.LASF1993:
+	.string	"string.h"
+.LASF1969:
+	.string	"sanity_check.h"
+.LASF1927:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1994:
+	.string	"locale_t.h"
+.LASF1992:
+	.string	"calibration.h"
+.LASF1952:
+	.string	"stdint.h"
+.LASF1947:
+	.string	"wind_estimator.h"
+.LASF1968:
+	.string	"stddef.h"
+.LASF1961:
+	.string	"stubs-64.h"
+.LASF1940:
+	.string	"vector.h"
+.LASF1956:
+	.string	"wordsize.h"
+.LASF1970:
+	.string	"common_post.h"
+.LASF1976:
+	.string	"adc.h"
+.LASF1973:
+	.string	"parameter_group.h"
+.LASF1997:
+	.string	"resource.h"
+.LASF1938:
+	.string	"pid.h"
+.LASF1939:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 Z=\002"
+	.string	"\204\003N"
+	.string	"\004"
+	.string	"\254\264\361\325\006"
+	.string	"\001\002\212\210\327\374\006\020\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\002\004\002\004\002\003\002\005\002\003\005\322\264\327\344\n\b\002"
+	.string	"\002\006\002\007\b\002\006"
+	.string	"\005"
+	.ascii	"\273\374ss\276\334\2402\344\006\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 <%\001"
+	.string	"\2400"
+	.string	"\004"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\003\001\002\003\001\005\001\003"
+	.string	"\002"
+	.string	"\006"
+	.string	"  \013\341\240\310\202\200U\306\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"5\005"
+	.string	"\202\b\034&\200K\322\0013\204\221\226x~\312PCA\3308\323]\027\036\220\023\315\301\0243\260\362\024q\001\020\2234\264\267\334)\177\324\354\233\243\226\314\024\f\030\324VP\b\267\356\272\013\201\027\027\365PSe\343\330(\206\232\252\300\2051*\347S\231\034V\377\253\331\333\306\256R\357@W\311\360{4\243\271H\022\255}\241\207df\344\373\306hf\346=n\206\024"
+	.string	"D\f 797\r\240\361\373\024\f:-a%\266\231\341\230\261\030fQ\235\204Utc4\006\321\206\303\253fUC\020\034E\316\346\022\334\304\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 c\025\002"
+	.string	"\342D\r\024\260%\351\f\303\200\323\332BhEsX\222\034\335mo\231R\3523\036\036\026\320F+yAkA/h;\330\f\237\261Nu\262\222\025M\300/\233\246\357\030\b\003"
+	.string	"\213\224\200*\343l"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.pureconst.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\200\004\001\200\004\002\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 \250%\003"
+	.string	"\222\006\022\031\320\2455"
+	.string	"\224J\300\224\n"
+	.string	"\200IGB\b\331do\005\311&d\247\224\002\345\361x\247sb\231\216\fbE\351dv\330\310\260\t\026\006\352e)\035\331R\331\ng\262%'r\022\276\301Fu4G\263\261m\200\024\001\n"
+	.string	"4\003(*\027\230\303\271\\\300\331Ni|;Q\\\266"
+	.string	"Yo"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.6d6ea1bd361740b1,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_virtualPitotStart.50.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"m\b"
+	.string	"&\320<9@\217\322\001\200m\f/\325\030\305\013\267t\030\374\316\200\364PG\203\371\210\234Q\033\202\237Oriy\234~6\205\251*\232\2043-b\233\003\316\302\217x\367k\022\273wJ\001,"
+	.string	"+"
+	.string	"+"
+	.string	"\235\317\340+K\365aI\215\270\354\326)3\016>\202\376E\036/:TVJV\250G\200\206\335u\254XY\334\362\266\017l;\330f\00510\213\202\231l\330\376\354\215m\320b\210\321\376\307A\276\207H<`7t\265vk\202=\232c\256\037\310\216i.\220\035\263\355\205sc\333u\237Y\031\372`&=^\034\023\222\302w\245\\\243\276Z6\276\330\025\025%\206\375\314\356\256ehGR\212\204\340dW\025\346t>\036\205M\304\321\n0\2074\bP\204G\271\323\003\335\274m\344u\036W\232&\272\2358*\232$\0164\232!j\232\032\202\273\322F\247\327u4\b"
+	.ascii	"?\251\370\034\201\254\217a\t\241XB\232k>\272C\230\3275\311"
+	.text
+	.section	.gnu.lto_virtualPitotRead.51.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\205\b"
+	.string	"&\220=;0\345(\035"
+	.string	"\274u\207-N\t\211\346\206\207\033\266DYz\214\300S\270N\347(j\310\314\263A\256\211\342\001\210M\216\221\021A\3126\223\361\017\020Q\353\016\274\3706H\354\336)\005+"
+	.string	","
+	.string	","
+	.string	"\235\317\340\353*\365q\241H\\\273u\312\216\203\217\240\377\221G\215V\213\213\211\352\364\030\340\260\273\216\030\252\214[\3366\202\355\007\333\253\001"
+	.string	"\354\n\226\302\262\375\331\033\373\340\243!F\373!o}\027\241\270\300n\250\202\262[\025\354\321\034s=AvL\363\201\354\230m3\004sc\333u\237Y\031\372`&A^\036\026\362\302\207a9k\343\365\2621\306\256\247(9\354gvw-C;V\240J\nNvS\001\346t>\236\205M\304\321\f0\207\264\b\320\204G9\023\004\335\274m\344u\036G\232%\272\2318*\232\022\034h4C\2644\265\004w\244\215N\257\353h\b"
+	.ascii	"?\251\370\034\201\254\217a\t\241XB\232k>\272C\230\3275\311"
+	.text
+	.section	.gnu.lto_virtualPitotCalculate.52.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`\222\006m("
+	.string	"\312I \020Fp\336M:saV\242\326\327~CM\3468\036L\270\262\375\200\025V\002^\030G5\022}\345VC\333\033\213\253Z\377\320\217B\375HK\221\365\200:I\311H\2138:\333\b\335z\212\370\260\266M\032!D\356$\003\354"
+	.string	"\333"
+	.string	"\360"
+	.ascii	"\274,B\376.\325\324\220)U\351\317#$fJ\267\252\036\351\3010\367"
+	.ascii	"\230\307\275\260\316h\326\373\311\377\302\203\271\367\323\276"
+	.ascii	"\214{\017\370(13\277\313\311\212_y\231\032\255\f$\335\202\310"
+	.ascii	"\335{'\374\344\034\351\317\"\363A\334\026>\033\372]$\027.\325"
+	.ascii	"M\311\216\361\031 \030\351\317\007f\224n\231\237\345a\305\213"
+	.ascii	"\371\270\200{\233\254A\273w\254\002'\245?y\354\005\320\237\351"
+	.ascii	"\t\240?\271\310\034\367\261\257\313!\020\020\262=\367^`;y\361"
+	.ascii	"\274]\252CO\263m\221\377\262\357\224W\306\363\266\276\3332\252"
+	.ascii	"b\245eS#&E\262\2563\th\231\275\235\215U\226I\341\rl\013\210E"
+	.ascii	"\261~\362\256\260n\376\350]!m\233\022\344\322\364\004]%\315\002"
+	.ascii	"D\242(_vKu5e\255\356\303\275\227\255\362\252\310\271wf\226\302"
+	.ascii	"\314Y\230\321\004\001_\223\221*\231\2034\354\225\b\272\330\205"
+	.ascii	"l#\243"
+	.string	"[_\373\253V\255\244\266:`f{\225\271\355\241j\273\203o=\362\257>rh-\205\276gp\211\203\264}\330g\231\2058\354\225o\f]Smd\273\032Y2\263u\360\365I]G\353\207\321\"v\275bs\255\037\346\261)\333^\3147\357\275\227\273\t\363\267\374F\037\373\031\020\335\354\254\340gg\004C;\313B_\317\277\324r\200\324rPj\031@j\331\227Z\356\245\226y\251\345]j9M-\353t\226Q\235\345Sg\331D-\367i\331\236\226\357 \003\226\320\334\275D\346\376\334\266SM\312\315\376\263_\355_o2\377\b\251\304\367\302\027\363\345\327\270w\364\003\355i\305\253\355H/ZJ\305E\210\334\275hY\351\317\237=\262:\013\237S\fK\357Ej\340\313IQ\324\002\341\013J\023\372s\250\243\bi\303\025&v<\234\303\201\340C\341\020\"\354\225\"\320\237B\3758\270\254\2039\t%L\276\\"
+	.string	"\2310VXT\360\224\375U+\030\333\3312*9w\230\3672\361p\265_n\213\235c\242\376\372\242c\257\211\332\346!q7\274\004~\265aq\364\345\326k\340\023\261%\n\372f/:\362ZA[\266d\225\004v\327\314&N\330+y]\204lc\025\240!]\036\346\346\364\244\275k\224N\262\312\362^\230\203\220\367\036\035\350:\355'\317\240\255k\":I\271\263\315F\373"
+	.string	"\240\344\224);\307\314(\256F\305\3370\2578\033\213\263\301\271\367j@\3634-\370P~\262\213\027\366\312\027\350\317\263\377\006N\254\333\354\003\tt\265w\177\t\227u\264s\034\264*A\320?{\221"
+	.string	"\3731\001|\003iI\b\005$\336\260!d\2521d\303I\270\024TK\364v\354\226\234\204-\230\202D\247\247\036\302\341\323\r\002K\252\n\265b(\f\246\352P\212\030\034\252PM*\261\247\016\245\242\242\324!T\312\0262lH\272\240.Y@Zp2\r$\246\240\024q(\324!c\250\022\325&\342\023Q\b\005\214\032\252:\204\303%\240\2230\330\004\2441\214\002\"E\340'(u\b$>=\r\201\275\261\343\315\333Mx\304Z\333\261\247x\355\305l\025\304\254m"
+	.string	"?\256\230E\350k\3171m\327^tndW-ln\032\240\371q\037x\351\203c\331\224w\216dx\272\032\004u\200\036\022\223\344\352\272w\001\200\016j4O\22270\353k"
+	.ascii	"}\322\371\365\257}m\222\371\3260\373\006\246\225\246k/\023\f"
+	.ascii	"k\355;+T\002\231D\315D\205\313~\314\177Mu>C\031\274\354\274\365"
+	.ascii	"\312\257?\034\321\241\376\372\030]G.b\t|\2501\034$!\006\2212"
+	.ascii	"3\301\210\314H\222\264\001\220\002\021\252\252n\0210Q\210\256"
+	.ascii	"6\303n\231)\330\365\271\273f\376\235\260$t\254\227,\3323Xq'\001"
+	.ascii	"\364\031\313j\237\303\304\311\342%\307G\202E|\321\001k\022h~"
+	.ascii	"\312\343\fQ\375\200\214\273\304\276\314\007Q{\326\232gJ\206\336"
+	.ascii	"\253p\001iYO\033z[\313e\355\240h\215<\263\243_*\253\013\245\320"
+	.ascii	"\247\355\324\223\242\245h[^c\213\345\007\310U\032#\205\374\324"
+	.ascii	"\311T\327\320\200\275\270\275\020j\321\354\033S\276(`\200\353"
+	.ascii	"Y\373\033\364\020P\245\231\361%e?\006*0\277K\025\212\315\221"
+	.ascii	"h\030\327q\353\327\246\2274\220\235u\374\352\0131\337\273\256"
+	.ascii	"\377\224\376c\363\254DP\346P\016\202\357\202\236\177\303\256"
+	.ascii	"\212\220\364<\254\f\227\001\002+\351d1d\030\327\263\036B\320"
+	.ascii	"\202\020\253\003\247Q\035\022\267&\251\221\256D\004\356k\241"
+	.ascii	"w\2532\314\037"
+	.text
+	.section	.gnu.lto_virtualPitotDetect.53.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`\025\001-\f"
+	.string	"\006\326SG\360\216j:\300\253W\340I\334x\3235\367R\367\366'\201\241n'\201S\350tg|\2036M\376\b\2021\035\2266\005TT\255\357tv\021x\006\236J\266\250\311\315\ti \235\223\262\216\206\335H\304\210I\320\336)\005;"
+	.string	"="
+	.string	"E"
+	.ascii	"\376x"
+	.string	"\347|~\323\235\363\256\351\316\331v\211\207\345\326O\023v\006\017\n\320V\354\236_u\360\326i\313\277\205c$(\350P\306\\\247\027*\273kZ\306\020\334\365\266Cl\203\354\033\b\246\265\020&\226\262\260O\027\255\r\354cvw]e\266\251\275\317~\212\321\331Jp\234\330\205\335Z,\t\356C\004\333,;c\203LH\241\324>\205W`}\266\272\306\256l\203\207\335s$/\275\212\262\200@u\231\326R\210F\035\3405\260\250@\021\212\233\226g\240\215(\211\033\346\356\353\245\r\340\264\023\005Q&\020\301\341\300U\235\215:\006\225\267\273&\376\005\001\0012L\b\347\374Uwnc\332^\364\026\356xN>$ \251\303\361\340<\342\270\210P\344\030\246B#H\202%R$C\323w\032\301T8\222\276\227PT\372F\343\351\343\210X4\201\343G\212\342\370e\316\275\275\372\361\252\003\254\241\337\203:{%D\003\025"
+	.string	"?\251\260\234\002e\006\204a\201X\227\200\341"
+	.ascii	"\221\2002\360\004\300\003\020\003\376\001\302Z5T\251R\202\301"
+	.ascii	"^\0351\313\004L\327h\351\016\021M\327|\002"
+	.text
+	.section	.gnu.lto_.symbol_nodes.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\315\004"
+	.string	"4\0072\001"
+	.string	""
+	.string	""
+	.string	"\0022\177\025\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\0063\177\0264\177\027\005:\030`"
+	.string	""
+	.string	""
+	.string	"\005<\031\0025\177\032\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\001;\177\033\377\037"
+	.string	""
+	.string	"\200\220\2009\177\0348\177\0357\177\0366\177\037\003\002\t\244\001\003\002\b\320\360\372\250\001\001\204\006\003\002\007\263\357\3407\001\204\007\003\002\006\304\013\003\005\n\304\006"
+	.string	"\017"
+	.string	"M\215\266uG\310\f\016\324\016\200\016\200\016"
+	.string	"\347#o\307W\340Y\372\302\021\225"
+	.ascii	"\001e\200\0324;\235"
+	.text
+	.section	.gnu.lto_.refs.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375 !\t\001"
+	.string	"\035"
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	"\003\021"
+	.string	""
+	.string	"\003\032"
+	.string	""
+	.string	"\004!"
+	.string	"\003\005\002"
+	.string	"\004"
+	.string	"\002\001\006"
+	.string	"\002\002\b"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.6d6ea1bd361740b1,"e",@progbits
+	.string	"(\265/\375`d8\335\360"
+	.ascii	"jkaQV \312`:\035?\371\215\261\277swK\266&\3152\205\252j\332\r"
+	.ascii	"\341\370\277\257T4\311j\303\367\r\253\321\357\005\016\315\313"
+	.ascii	".4I\323\355o\233\3275\200\002P\231\205\201%Y\2436\3529\240\355"
+	.ascii	"\322q\316\241\277\200U.u\311:4P\030\366\262%\311\272\267\224"
+	.ascii	"R"
+	.string	"\246\254\004\353\004=\005Q0\260\360\307]\3134\271\034\227\255d\270<\207\241\231.W\241\313T2\322\322Y\006(\fFi\0046\272\021\326\242\317L\227\337>\215\207j\207&\325\326\247\355\244\270\355\005\367\253U\370\253k\374U'\374U(W\237X\250\3465\235\224\224\227\227\367\253[\334\211Y\224\f%O\301\320,\345?\243\3454)\371\t\232\224\334\004s\311:k\366\336o\306t]\311\342\373\325\033\374\325(\376\352\021\3774\3121\023\363\250\022rY\237^\333Z\035_\222\3072YN\222\225d(\206f&\331\311$\213\351}\34504<\274hW^f\222\221\3401\032l\371\001\036\226\350\323\353\323\232Tdi\2421\311G>M\203-#H\201\247%j\301\002w\372\232\332\272\331\237F\311`x\317\311\023\325\027\317\317\337aL\033\215\364\202JZ\336\237n\361O\261\370\247S\374S%\376{\013\247`\337\361\214"
+	.ascii	",T\3258,T\363\020\232+|5\240p\374\267\023\376{\214\317,\261P"
+	.ascii	"\315?n\236\254\226\304\310\373\267\223\177\206\0210\230\254\267"
+	.ascii	"(~\346,\fE\203-9\331\022*Y+c\265E{d\037yG\346\201\241Y\353\263"
+	.ascii	"\026\236\321\234s:o\376\200\260\330\002\334\257\277\360\327y"
+	.ascii	"\374u\034\177\315\306g\2309\307\177F\221Sd\253\2322xOx\344\235"
+	.ascii	"\253l\216\274\324\344\312\370\343\347rE\023\312\251\371\204\315"
+	.ascii	"n\322\336\2315\324r\215\034#\337\310\314<#\343\310404\333\370"
+	.ascii	"\317/2\214g\0236\323O5\336\224\365\024\225\247n\216rz\022\236"
+	.ascii	"\212fW\266\221Y`0JYM\315\274B\003\r\331F\246\312S\372\331\234"
+	.ascii	"!\313\202\212\366\376|\\\366\331Fv\302f7H9]I\305S\323B\217\205"
+	.ascii	"\324I.\206\230\235\375Z\t\307=-\262\024\206\006 \273\260)\303"
+	.ascii	"UFL\336\257\221\360\307\001P\361\037\016\200\372\272\b\177-\204"
+	.ascii	"\277\376\301_k\361\327X\374\365\025\177]\3053`\362\371\254\202"
+	.ascii	"\246\314\223\270\273\274\035\240\247\370\267\3250\261P\235ib"
+	.ascii	"\241\232\221r>\312I\237\221r\017*\365\256\336\237\031i\367\216"
+	.ascii	"\204q\0057\030W\220F\351\201$\246\356\327,\370g2\374\363\036"
+	.ascii	"\177(\346Q\261\230\036\240\034\216\037pl<\f\246\303\\4\330r\002"
+	.ascii	"Y_}\330\017Cq\230\177\f\207\343\320\302`>\f\346F\351\331\243"
+	.ascii	"f\262\240Rm=\026\260\022\031\027\"\352\306]\260\027\f\375(\370"
+	.ascii	"K\326\224\243\254\036\334\304\314GQ?gq\274e\002\016\224\030T"
+	.ascii	"F\362\376\\\203?\316r\243\224\323\373\016\257(\326\303V\360\025"
+	.ascii	"\034\007\335D\214D\243x\017C\261\336\004 \026\220\027y\352~\334"
+	.ascii	"e\267\003?\357>\355\206\246\367"
+	.string	"5,\265\336\273\026\234\207\261`(\316\262\237\237\341\337\347q\026\214\367i\024T\364\276f\003Gi,\315\255\257\367n\301B\217\205\240\217\347\033\027\276\037\363\361\307[\370\343=\376\370\312?\236\303h\237\226\231\275+\365\336%\310p[l\364\345\215\231\370<\256\323jRR\214\321\302\037\343\361`\033\307\035\363\2509X\250\356\250a\241\212\333\260\033\206\366\340\267\327@\303\353\243\260\3365\227\004E\343\t\017A\377\303=\352\343/\276\023\207{\360\3073\370\343%\307M\260\023\f\255\200\237<\376\302\317\247Qz\366\261\336\2378\305+2(y?^\342\217+\2508\270\202\372'\370N4\016\363\250\217\317\260\031fv\tn\244\2228e\344\215\223`%\030:\001/y\314\004\227}\212\364\354O\314\005+)*\357\034\314\243f\017\360\240\210\307d\017T\3255|\005\034\004\275\377\375\341\t*\026\363y<&T\227T\317\216\363"
+	.ascii	"\255\034F\362\326\022\370gN\001\346Q7\026\252\302\216\275\376"
+	.ascii	"\361\021\334\205\201frbvh\357O\035\256\364\244\254+\357\177b"
+	.ascii	"\036\225c\241\372\237\265\210\361\373\317^G\302\374g#\\T$\374"
+	.ascii	"\247G\3763\023n\372\317q}\377xE\002\3761\024\230\377l\345\213"
+	.ascii	"\235\027\022\377o\200.o\301\177\372\243\211\025\306\377\257\377"
+	.ascii	"\323\033\377Y\357?c\371\317w\377\271\356?\313\375g*\377\331\355"
+	.ascii	"?\263\375\347)\377\271\311\177N\373\317E\376\363\325\177\336"
+	.ascii	"\340?\177\375g\262\377<\343?\307\370\377\017\376\377\313\177"
+	.ascii	"N\362\217\025\360\237\305\376s\330\177\006\373\317\317\377L\343"
+	.ascii	"?\313\370\177\017\376s\006\377?\342\377\273\376\237\202\377w"
+	.ascii	"\373\377\364\357\357\357\357\0373\377\203f\377\026\356\002Z\370"
+	.ascii	"\013\263\360\027\342\361\027\332\361]\305\3477\034\223\030#y"
+	.ascii	"\003\351\370\013\331\370\013\233\360\027\206\361\027n\361W\023"
+	.ascii	"^\361\027\302\340\257&t\342\277\323\205\377\316\033\377\0351"
+	.ascii	"\376;9\370\357\2641\2518\274\030yk\340\363\033MuB\301\021&\357"
+	.ascii	"\337\201\342\037\267\203\304_\207\217\277N\033\177\235"
+	.string	"/\376:V\374\243:\235\177\316\036\377\2347\3769e\374s\234\374sxp\334sn\360\317A\301\037'\312\037'\216\343%\316\022\3768E\370\036\262\2670\024\203M$k\221Y\"\346\203?\306@\325\177\177\030\003\365q`p\274\201\244N\024,\340\320\360\262\242\273iC\245\2259\241\355\251\334\247Y \001\3734\024`\t\360\332,v\213\262\246\350\325\236\312:r\223k\215\355\b\220 \030\214\226WtOi*{E\026(\"\277\2472W6k\342:S\313l\025\024I\303S\330\310\224\301T|\270\324\332\354\362V\331\216\250^\316P\332Sy)\347\310R\026\005\222\205\344\255\"\317=\205\345\360\030\251\004pE\347\234}{*k\311]4\330\322\002e7\274\350(\031{J\273\320m.*\020\262|Ji\213\"\331S8\f\237\351\247\032\315\222\026\\\225=\205\377\272T\300\365\234s\366\345\266=\225\335\362\225\336\242"
+	.ascii	"[js\316\276\256(n\321\264=\205\3250\224(\006\034y\366\3302\366"
+	.ascii	"\213\rc\317\330W{\307\276\261s\354\030\033\307\326\332Y\233\271"
+	.ascii	"G\330:6\325\266\332\315mc\373\330U\273\306\246\261\261\366\217"
+	.ascii	"\315\003C\367\324\377\226\332.\300\222\314%\331\2601\225\320"
+	.ascii	"\t\013\325\035\005|\326\330\342\226\367\343 \355e\230\375\024"
+	.ascii	"\264B\242'\025\267\235n\324\370VQ#&+kK\336\177\203DN-\357\331"
+	.ascii	"\305\247\351\303\305G\255\212\317^\206>\347t\3529:\346\234\323"
+	.ascii	"\371e\001\3139\247S\303\277\017\237\317s\316\351\204\313H7G\317"
+	.ascii	"\316BC\334\234\323i\245n9\347\354{fQ\323\321\177\237-@\242>Z"
+	.ascii	"\232s\316\276\377}\264\225\364\337f\332H\272\214\016\243\301"
+	.ascii	"h2{I\213\321};I\217\331(v\337)0T\373i/\257\335\364\233\366\323"
+	.ascii	"W2\022\216\243\352G[.\330\352s\316>\037=\215\305J\206\237\266"
+	.ascii	"\323X\220\\P $n\316\331\327\373\223&\354\007\337\363\202\375"
+	.ascii	"7Z\374ob\360\267\371\343oc\307\337f\215\277\r\027\357\261\241"
+	.ascii	"\301\337\206\005\177\033$\376A/\374\203w\032o&\213\f+\2753}\027"
+	.ascii	"\354\342\037\304\342\037t\301\377.x\304?:\307\277\257&\t\377"
+	.ascii	"\032\037\374k\260xfb"
+	.ascii	"\036\365\002,T\331\202K\316\232`y\177\315\023\327/`\314\320L"
+	.ascii	"\312X41\335\223\331\223\254\247\323\2404t\211&\353Z2\234\350"
+	.ascii	"5\rEO\321Q\264\024\f\325O\264\332\353\026ZJO\275~\242\233h2\r"
+	.ascii	"\266\244\200\026\2157/\276\032"
+	.string	"7\373k\220\370\003\355t\332\277>\323h\232lF\f[\223\217\274\203\330\354\t\307\365\022\270\306\265V2\223\307\234\362\005\245\341\367\224A\346K\203i/=\246\303t\022\375\324Gt\2276\242\221`\250\026{\277\031c\250\376\232]5T\204\341\312\302\344\243\305\2643#)\311\322\022\243\214\026\3237t\326^\324\210\026\3236\372\264\230\336\241\213\034\335,\321\223j\263\260\233\340\342\336z\366\003\267\370\003\177pM$-\333\303\262\221\367\003e\360\317\340\203\255\213\207\033\232\326[\263G[\263\251\177\250\240\"\325\346\004\242\205\350!:\210\336\302P\335\374\236\232'oRN\202\373\201/\370\003\245\370\003\227\374\201O\374\201+\370\003\2258\026N\377[\372\222\367\323\364Yy5\231]#h\035:\007\206\352+]u\245q|\032\216\203\366\232% >\372\234\275w\032\272\250\212\035|?\r\033\177\2323\3764d\374i\306\370\323"
+	.ascii	"\341O\243\203?\315\f\3764K\3764K\374\271\037\177\276\307\237"
+	.ascii	"\323\361\347oBu\307M\341\026R,.\306\237\013\341\032JuzqU\311"
+	.ascii	"\3739\325\230$\270f\030\215\002\017\363Y\271\3452mQ41wQ\275\244"
+	.ascii	"\225t\222\030[\324I\253\320O:\205n\322+4\023\206\352\245\fF/"
+	.ascii	"e2tU\2425LOW\232\344\354\347-\370s(\256\221\324+\2655*a\262\236"
+	.ascii	"YS\037\345?\f\325]wLW\326\314x<\236\234\324\3753^\370\317\350"
+	.ascii	"\361\237\261\343?\363\3063x\252\361\315\034\303B5\315|N\264+"
+	.ascii	"/\362\376\231\"\3741Z\326\303\\\272\225^\263\367\276\227\271"
+	.ascii	"\344(\206\346-\3779K\316\313[\254\264tm\201@t\316\351\324A\352"
+	.ascii	"\222P\361\3753B\370\317\350\340\230\002s\006\212\253M\365\013"
+	.ascii	"\257\003\246\245\005[\362\372R%8R\276`H\001S\207\347\274;\372"
+	.ascii	"r\307\001"
+	.string	"\027\247\253\274\013\360\026M\275D\323.\217[ \365\236\324\273\r\031\b\350\222\362\021\301\003+\303\307\345n\n\312GJ\025B\213\327\224-\233O\267\365X\343\013\343\027L\345\345\245z=LmG\247%\303i\003\327\"-*\325\362\251\236\215\227$qH\362\226Z\205\305\030\277\274\177B\r~\301\n,X\322;\037!#\3649m\242\300\361\320!\307-\370\263\263K\357p\3163\tKW\024\330\007\365\264\365^>\275\243\001\"\304\312\211\214[`\205\216.\255\353aj<)\253\027N\354\227\024\265\262\362i\035\216\221\026:\366\306\344\372\206\364$q\013\320D\300\301\245r8\254\263\240\300\206\364\327\254\300\217\300\\\f\211\373T.\r\223a\221{\222\206\267\320\270\230P\341\027hQ\241\"a+\bU\205mw6\202\023\023\316\371D|\352\006M\335R\031\232\211\211T\265\201\r\351\253J_\357k\007P\347zd\311j\362"
+	.string	"L\211\370\224\rCS\266T\t\bf\227\202\200W\224\352"
+	.string	"4kc\202L]\361\013\314\236<I\247\374\230[J\371t\n\316Q\226T\336i\224\364,\205#K\372\313;\205\"\001\013^"
+	.ascii	"\254&M\3224L\325\365\036\322\2276g\004ex\001\302D\244KR&\237"
+	.ascii	"\226}Y\232\306{\3573OU_\332\372:\225\213\n\377)\332\247i3H\376"
+	.ascii	"\234\316h\210,\t#rfv#\006J\351\353\313\305\030\">\304\370\177"
+	.ascii	"\376W{\213\364\331\325\222\202\217\323\307\025\376m\260\306\004"
+	.ascii	"\350\3755\360\201\336Q\330auQ\333\252`t\311\273\177\357G\314"
+	.ascii	"\245\016\323s\254j\311\244T\005\0033\215UE1\215U\035e\2467\244"
+	.ascii	"\250e\257:\342\235\031\305"
+	.string	"\231\220z\037c\366\250\232gU\357\317\252#\376DZv\246g\025S\207I\251*\n3\215\365eW\352\313\035\246\336\243\372X\325\026\314\324\253\226Lc\314(\235\216\202\213\311\n>\"S\330Lm\n\f9&\245\0165\201S\211\271\214cz2\261Z\357G\320\024}Y\325;\rf\005jJ>\216\324\222\342\240f\250\224\236G8\306S\222\025\223\346\231\324\343\230\2060\205R\364~\327\237\024p\204\217\226z\322\021\356=\305s\331{\022s\003TLlei\331m\272\022\222S\222\0253\230\"\211\271\324\207\340\300QLcVL\237&J\306\232=\351y\204\233\375\256j\311\307\216\236\235\211\317\006\fZ]_\336\237\226\222\2015{\3579A,]\316\240T<M\322\205lL\222\274?\202#\376\237\216\355\"*\f\024b\312\304\210\004[\270\355\345\205\345\030\322\242)\n\354yC.E\317\373\213JT\220\252/\3743"
+	.ascii	"I\235_\276\220\244]\351\221\324H\312\205\241\251Wz\343\323\037"
+	.ascii	"i\363{\272l\244:n\216tz\317\201\2449B\252\203B\022\023\2105\257"
+	.ascii	"h\352\225b\355\"8\016+\002]]^iV\352\003\307Q={\013\240]\020\275"
+	.ascii	"\266\276\036\0137`\254-\203;-\262\005\364\322\321\205|\021\331"
+	.ascii	"R\247\230R\334\206|\272\365z@\025J\314p\344\235\nIq\340\b\231"
+	.ascii	"\352{\312;\r\262\271\302\300\320x4\016D\212\n\"[<WH}|\217\017"
+	.ascii	"{5\322\362\346\001\\\362\364\005\226\305\265\322\035XVt\275\274"
+	.ascii	"\237\247\006\177\236\027\374y\226\374yV\244WV\252\026&a}bx\016"
+	.ascii	"+\034$\205\334]\325\247VH\301N!\203\201ib\345\375^R\034\377O"
+	.ascii	"\023\254\363\353:\303\301\314ndd0\362\206\246\314\357i\030\252"
+	.ascii	"\2442Q\376\022\362\370\177Z\203FJ\025\345F\221'\221$<\204\314"
+	.ascii	"\220\201\203\205\310\362S\031i\f<\3264#,\357\224J\017\321r\262"
+	.ascii	"\004\356l\247\335 \211i\206\325\305\370\032\203\n\302\225\005"
+	.ascii	"\205\016K\220/=\232O\362\312\230\210\225\371J\342T\346D/j\344"
+	.ascii	"\b\n\254\246\021/\033\332\n\230\214\246\221\256\253\033]\320"
+	.ascii	"\025{\215\215\212\266\342\326\026-\023#\023\375z\326\315hF\231"
+	.ascii	"b\005\027E#k\212\n\341\261\215 \251a\246\226\267\304\302D\271"
+	.ascii	"\254a2moA\266\337v\346)\262\253\375%V\307B\203\337\336\262\243"
+	.ascii	"ti\213\024i\223I"
+	.string	"]\244O\351\212\324)=JQ\244M\351\213=&\235JY\244I\251\212\r&]\246)R\030i\337aR\2504*\225\332}\251R\312\264\313\244K[\314\376\303\320\355\267\371~w\331^~o\263\355\267\233\344\255\276\346\216\"e\027I\272\333J\266\337^\262\213,%Q\001\204j\242zr\260_\002\224\003y\034\341/!\213\277\004\034|O\351\306\311O\252\t\f\256eS\331y\372\331\354 \211+\332{\327\303\320\255e\277\341\236\355\024\203F\227\275\177\347e\331\200zf\247\342/o,=;\255\251\013E\336/a\311_\203\234V3\216Gs\216nG\263n[\311S\n\330r\362U\345\312\276\333x\333\016Cw\335\246\263q\341\207\302\t\270_\330\205\2770\254\261\005r\223?E\fA-\320\321%R`\223D\357\312\002\315\270\312#\253d_\326\210\034r;p\2405\256\035\224!&P\266\023\330a\361\330\032\215"
+	.ascii	"Q|\331\240\001\274\320\005\245\320\273\016M`\302M\"\221\353P"
+	.ascii	"\351\022\201/\221}Y\017;\357\221M&\211:L@\002y\212++\"\347+\214"
+	.ascii	"\370"
+	.ascii	"\321yb\233d\217l\020\177\005l\220\200\r6\230\230\371\r\r\310"
+	.ascii	"\240\001\031\250\277\241\001"
+	.string	">>\r\330\300\207\377\006>\372]]\245\373\363B\027(\350\300\303\276\253\221\210h\\\2114\257r\310\022\333\232\"\326\203\222\210\003\352\211\325\310\026\3237\231|\177\210G\242\017H\013\334(\207E\254\007\340\313\006\351\327\0031\002\345\2205\266@n\362\247\330\"\203,\362\004\t\035#\240\367}\241\013\305\026\211\341\025\nj\215@=\037>d\345pC\261E\252?8\004\366\200\213-R+9(\266H\032\342\320\260\304q\345\300\314\215\bB\303 \216\bBC\r\200\220F\033\021\204\206@H\343\320h=\0014&\207E\243+4\224\340=\262\304$\373\363\203$*\036[\f\fI`\264\206\320#D|\333\037\243\321\025qt[ekb\025\300\321m\215\304c;d\215A\307uhb\035\342\2511ZC\030Ql\2217FnR\210DO\221e\221\312d\313\201%\036\331$\013\304\212\230\300h\r\341\330\026\223\256\333\001"
+	.string	"%\210\355;\342h\201\020A\307\026\003E\326D\013D\200\342\3205\346x8\221\001#\013B\321z\334a\221'\336\034\342p\307\304jd\223m\315\372!h4rx9\230X=\230\260\276F\326\203\233<\321\301\253t]\016\212\022\216\355\332\001N\322%r\210"
+	.ascii	"\b\310}\211\212\326dP\373\036W\235\267\035j+0D\244"
+	.string	",\266?AE\020J\367\307\350C\321z\214\340\035z0\342\203\004\266h=rvX\f\361\036\223\354O\321z\304y\213/\221\003\b\022\"\212,1\351\002\355(\207:F\354\007\023\214\330\017$0b?\270y\217\256\bm\322\025\022@\221\035\"R\036\335\016\353\273z \266o\222-\242\360\0329(\335\037\026\004%Q\020\207W\311\006\331\241\222\350U\2629B\020A\307V\331\356\b@\304\007E\366U\266J%\207\021\035:P\266\024\212\254\221\003\353Q\002F\256\321\350~H\262$\224m\004\312\364\r:\266\305\225\025\032\032\001\001\225C\245\207\020?3\257q}\2078E\366\330\256\311Wyt\211\303\227\b\371\022\271;/\253d\223\351;\374I\262F\243\233|\217n\207b\213\224\360\341C\t\375S\"\207(\221=\224\310$J\344\2415\271\"\323\227D1\177\360y\2215i\007\021Yil\201\206CI\366-\356\210"
+	.string	"\002\bY\201\241$K\242\bL\272/\360%B\036\333!\320\270&\203\330\367\330r\343\232t\221n\022\031d\213Z\266\b,&W\243\244\373\241\310\262@5E\353qh\004\244*\213-r'Y#Kd=(]\244\320E\232\220"
+	.string	"\253<\272H%+B\351\"q\336\341\004!d\300\310\026\245J\016\254\372\035\032Y\020\330w\035j_\245\004\212\326\243\004c\320\252\215\326\020\216\255Ru\211\352\261\365\200%\256@I\"%\220\270\326\274C\017=F\266H\027\331d\253d\213A\245\007\022\274\312aMQ\312\032W\2422=\266Am\322\002Jd\020\315;\334qI\f\265\307v\210\307\246\305I\262%\210\254P\207\023o{\\G\274C r\210\004\316;\004\301\243\fZ\215\037h\216\355\007\2417\231#\364&w\330w}G\b\275I\316\203l\262\365\300\016\271B6\357\260C\321zd\337\265\250M\"\207\0070ZCx\225\253\221\207\rJ\256/\215\321\032\202\222\310m\213\330$\262\206U\266DI\242\372\016m\202V#\320&\2329\272\352\273\032\365\3215\352\327\270j\037d\326"
+	.string	"\2313 s\320\350\272\034\f\323bk\\Ax\225m\005t\336#\221\333\241U\272?E\353\221\347\205.\270\355\273\006\265E\353\321\202w\250A\006\243\365\204~\207\031@@\002\325\274\320\205\244\373\022\331\"\fGwh\310%\002\340]$\233\304\360\272n\022C\215\t|\002\213\200\213\260\322E\352\233w\270\341=\266\252\t\266x\f\361\036[\027yb\305"
+	.string	"[\324\276\304U\310\026\211\336\3665r0\256\355\333\036C \215t\214\200\357P\351\001;\324\276\234\035jI\024Y!\342\312\212@\032\331\274\303\r|\336c;\363\031h\330\260"
+	.ascii	"\037\266\230\301\005\001<\003\030\320\201\202\013|\320\001'^"
+	.ascii	"0\256Do\262-\032&\331\227\035z\335\267EbP&\331\242"
+	.string	"6Y\304pl\327!\f\304\244\022\303\005\f\336#;\364*\211:P\344@L\006Y\342q}\225\255\007d\233$a\\_\367\325\031\243\207s\307\274r\0223\305\0015\316\262\370\245\335\\q\275\261\b\363rK\376\002\204\267\250c\343\023\202@Rr\030R\n1C43\264I\007\363\023`P`\\4 \216\206\275\036\023\300P\351\002\332X\017;&#\"\"I\nJ*u\246\003\317/\320\353\007\026\242p~U\377\206\004C\245\t\222\303\216\217\225\241y\313\350<\b\262/\266`\274ZL\275]\312\236H?\312f\262\272\352\361,\322\315\017\n\b\004U5\035\006-\321C_\341K\270\031l\035<\221\230\22782\007#\230\313\310\235E\220\311n[\020&\344\363[%\033\206\335\t)\032\344X8\334 \207\034a\\,\356\351\b\021\376\235\313.G\306\343B\273\204h\223C6}\013\312ESe\361\350\2013\230\347"
+	.string	"\300\377\360\2714Xa\207\323\t\r\017\017\375u|\2023Q\344q\337\306)\252\365j\375\3126]/+GS\031&Z\351\324x\276\245\377'\355\264\357\301\314\316\332p\351\205\203\016\3058&\315\005\301C\307D\026\262+O\320\257v\305\210\265I\366\374\t\374\372\256\0363\37512\210.,ef\036\264s\235T\3022\244\025\237\bt\263\272\216\365\2214\216\031\350\366\013\331\335\006\367\237*\367\304\212\312\321\331j+\265\377\025\255\371\231\333\205\237\375\r\252\261\351l\331"
+	.string	"\307u\206;\017-\263%\237h\333\365\031u\f\363\201\202\351\004\276}t\013\214`A\t\220\270\324^\345)\211\224\352\245U\"\205>\303\302?\003\200\b\243ml\3061\024\232~\354\2350\230Tsk\205\023\"\210\264\034F\356\360\301\006\206\330\310\316V\310\2670\034;3A`H\253\030\213\271\002\001,\327d=q\315\367\361\274hS\236\244O\273\206\005\216\311\350\037Qk\361dgW\221\336\327\310\\\365\360\013\321[|\377]\017e\237(>\203\362\022"
+	.string	"\236;\350~\254\375\025\314\335\324\234\270T\226Yc\346=\\\234-\331C\373i\303'\215\254\235~t\3442P\351\216\207 \323\026Cldun;\242V\352\031\276i\033\330#\316\356\236\270\327j\346-\226\206i\002n\357,\271\346\377v{\334?7n\363?}+F\365,\237\242WtQ\350\032B`S\341\367F^\240\217\022\021\240%1\322#?\264\221d\222A\227\304BD#\225p\312\354\013@\3157t&\371n\340w\334\366B\220~\232\230\340\360?\376\245\026@r\224\253\365\203 \341\\KN\013\340A\037\002\240!\376{\374}\264\370\312\b\247\337\246\003\235\fR\220\205h=\267\274U\276\370z\343\312\344"
+	.string	"Q7\272\232\274\374*\223\306eWa`\233k\205\265\241`0\261\261\021\r\fun\312Pq&\343\361>\315\0229\355w1\260w 3 \302\274\2162\231v\224\346\031h\313\345y\f1_r\313\371o\026\330\312\177\322L\265l\036\372\212"
+	.string	"\216\346\334"
+	.ascii	"`\364\333\274zOG#\3473`\342\342\321G\323\274\240\306\376QX\264"
+	.string	"\002\365o\177\216\276\231\341\273Q{\244\236\216\332\334\236M\035\202\274%K\256\212I\024bC#:\036C\223\240\256\316\002\361\310pdb\301#v\356_.\032\320\215\232t\325HD\037Z\013O\357\016\310\241F\345\351\021\235N\234\021\342h\263J~;\212"
+	.string	"\036J\270Ob\020K\306+81\034+\336&\315#X=-\351M\301\226\354^\235\006&\0340\301\244\361\271\n\351_\366\203\033b\334\357\264\006\260\337Y\231\254v7B\025\023\310\027\306\304\235\352[\350P\314R\002\321H\263\224F\233\207\022\033\264\265\225\351\2004\351/\021\3317\210hq9oo\236\3726S\001\335J(\\kh\2114\022\364n\247\027\354\265\003Z\361=\004\217\274\300\270\023\212x\021D\021d\027\032L\2509%\th\202\324tF\200}\232_%\376\342\254\255\250\213i\344\210-\354\006\200e\333\326,\350#\343(m\350\264\220%{\254\236\340~d\317\232\207\324\243\374t\322m.M\2509\373\243\335%5q>\001\306\347\357\341\342\251\t\024C\211m\002\027?"
+	.string	")w50j\t"
+	.string	"\231\032*\261\n-\277&"
+	.ascii	"\205\362b\306V\267pm\177T\227Zh\b\277Z\347\032\237\354\321\035"
+	.ascii	"\013\331\026&\257\016{\372\376\021\230\320O\314\220\031>\205"
+	.ascii	"Y\371\225<\270\353\331\367P\361D\252\337s\016\3167\322\250f="
+	.ascii	"F\237\376[s\332\302'\201\300f\335Bu\371\026\323\027\254\t|\030"
+	.ascii	"2Gub\262I\240lV\"\013\347#\304\376\272WutE\003\024\007W9\260"
+	.ascii	">\324eG86\336\"\345,\326J\2411\326dP\334o\373\274\330\016\371"
+	.ascii	"j\347\032>\th\374\260Y\270!7\240\233"
+	.string	"\263`\317\345\374\036y\253\001\213^\277\3729\033'\255\366\375\326\331\332[\350W;c\352'\270f\227\237Ny\205\215\033\b\215z)6X\304\263d\302Y\002\032\270>LI\233\265\001\357\203\373\rm\327\3149\230\316\177\225\034v\034e.+k+`\210bD\310_\370+dY\007\246A1pT\367\204S\246\260L\245\223\377s\256N\3451('\200\210O\225\253\372\316n\221\020&\f\231>!\255\331\243\236\251\006\320\017Ml~\220\020\204\320v\025'\225\223\325\321\304\006\3333w\207\027\350\013\342\205\213\007\001\334\335\340|\365*.y\025\277K\201U\035\366\316/j3\346R\032\245`\025\206\274\207BY\253\335\226\324\354C_.\360\224\213\236\235\201G\f\237w5\030~\346#\37255B\237\332#>1W\220\347\345B\346#\211{\262%\026\003\277\313\306\307]0\220Ux\007\b\031\025\016\207\202\024\375t\027"
+	.ascii	"\314,\276\356\361\205\002\340uG\345"
+	.string	"\271c\222D\327\034b\206\017O\201O\350\256Zu\224/\230\362\357#\214\257\243\2346\217\177\216Gh\2347\315\230~#\350\365\356\223\024\"\r#Ip\343\026#?\357\227\346l\373\361U\006X^\220{\360\266\244d\252=\263\221pw\374\2016\226C9\331\342\376\232BKj\224\346\374\361\020\003=Q\373N\346S\370h\212\037\"gd\033\220K\351\0322\316s\005\013g[\361\035\227\266v-\206\260\304\224\370=z\036%\211L\2157\020\333\363\340\321>\227g\315a\200\303\005qk\305 \302\303\220gP\226a\303H\215\361\307\n\246aQ}\bg\367a\033\247!)F\366y\3379\006$&\315y\305\006\337#N3\262|pd\375\267\322F6\202\002c\230AV\345_\301x\235\316\022^|\217\203\205\013f\232\322\267!\235\be\350\373\350.\345\207\207!\r\363\003\2502ub\314\206\351\257\315W\370\343[\224"
+	.string	"^o;/\223\306\300e\3019T\330\020W\313\245)\032\260\256\333\305/\310\303i\330z\314\003\226d\202"
+	.string	"\320p\336\264!zr\334\261\372m\225]N2\237\361\016\004<\252\177\240\211y\325\327\304\233\027hR\320x\255\177\016m\201\206BHH\373\347\237d>\025\311S\204\217\206\255j"
+	.string	"\031\2366\203!\354Zt\256\262\177&\200\f/SF\021\204\""
+	.string	"\021\225-M\3765\307\300-\337\257\333b\333\201\324\204t\2065\246b\260g+ovZ\36409\376\306E\250\2140z\273\035\026S\207\261\324W\326\032\253=hh\252\017\263\271\3537(\372\021\330%\374\335b3\357@f4\210]%\275\340\323\377\205\232\t\222\230\305\bS\273:;\200!\315\202\355\242u\2168\353\0341\206\252\267W\215\036\236\362w\020\216*\023\033\267\027\324\376h\211\004\340\276\305Q\267\205}6\t\212\223sD\334\226\022\360\356\336%\345q>oT\361\231c\254\320\250\252\200\022bdz\020)S\303\325\355\302m\b\202gSnH\001\330\353\202\223%\255\223mb\372\274Y\371b\001\210bD\256/\373\354\322\201WF\272\f\241\330"
+	.string	"\262^\212i@\340\305\3715C\316\216\272\324\f}\341\216W\020--9F\326\315\310J\341u?\220\311e\377\345S\2512\360\017\304t\0279 O#\225\322\212L(\351\200\322\007\370\327\005u\024\220\322\274\030;\304lo\0078\nv\b\367\203\355\236\267U{\225\tU\221*p\374"
+	.string	"\342\2271N\2425\200\007\350\023\312\330\f{\354A\367\030AE|\350\253\347\357\301\026\n;z#\020:)\f\261\323!\231\353\3739\231\211W\273Di\323\214\n\355\212\rP\371\326\006o\201\377\351\344M\036\\\005\020\305\f\341\0057\035\264e\3724(\300\251\t\302\f4v\204\206\235\215{_|\210\245\371q:\007\255\370\t\370N\362\240<\376\307\320'w\013\340IDr\"o\214\t\206atK\330\375`\2709`\024(\307\313\n\002(\3305W\331q\306\344rLW\026\222\204k\206\261\006\245\267\214\275\f\204\333I\200\361\347\251c\234\300P\360\200\034\224\356\031|w\306\201\217\253\177M\031\274\3232\201\236\214\374\214/T\336\200\217\360 \277\323\320\311\234\367\t\262\356HO)\326\321AJ-Q \2557\311J\312\370\004\230\b\177\340W\244"
+	.ascii	"wO5'\025\266\216)\320\022h\347L\022\266\353\213\376\224\201B"
+	.ascii	"\250\202\317n\266G\331\263\237\007p\336\223\300\0337^\260L\f"
+	.ascii	"\361aS\"\277\362\357nG\337\276\370\344E\303\227re\354\303~2\377"
+	.ascii	"Vg\3313f\310\340\303\362!\357\357\327v`\371\365\323\365!\330"
+	.ascii	"\261\f\323\366\033\356\n"
+	.text
+	.section	.gnu.lto_.symtab.6d6ea1bd361740b1,"e",@progbits
+	.string	"virtualPitotDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\002"
+	.string	""
+	.string	"posControl"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"pidProfile_ProfileCurrent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\002"
+	.string	""
+	.string	"getEstimatedHorizontalWindSpeed"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"isEstimatedWindSpeedValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pitotIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.6d6ea1bd361740b1,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9887 @@
+	.file	"rangefinder_virtual.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/io_types.h"
+	.file 7 "./src/main/drivers/bus.h"
+	.file 8 "./src/main/drivers/rangefinder/rangefinder.h"
+	.file 9 "./src/main/drivers/rangefinder/rangefinder_virtual.h"
+	.file 10 "./src/main/drivers/rangefinder/rangefinder_virtual.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rangefinder_virtual.c.77f544e4
+	.weak	rangefinder_virtual.c.77f544e4
+rangefinder_virtual.c.77f544e4:
+	.long	0x6ac
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xd
+	.long	.LASF1587
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1421
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1422
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1423
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1424
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1425
+	.uleb128 0x3
+	.long	.LASF1426
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1427
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1428
+	.uleb128 0x3
+	.long	.LASF1429
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1430
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1431
+	.uleb128 0xf
+	.byte	0x8
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1432
+	.uleb128 0x3
+	.long	.LASF1433
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1434
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1435
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1436
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x3
+	.long	.LASF1437
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x5
+	.byte	0x16
+	.long	0x1bf
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1441
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1442
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1444
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1445
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1447
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1448
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1449
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1451
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1452
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1465
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1466
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1467
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1468
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1469
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1470
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1471
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1472
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1473
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1474
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1475
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x5
+	.byte	0x43
+	.long	0x249
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1477
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1478
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1480
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1483
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1484
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1485
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1486
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1487
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1497
+	.byte	0x6
+	.byte	0x7
+	.byte	0x11
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF1498
+	.byte	0x6
+	.byte	0x8
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1499
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x3a
+	.long	0x292
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1505
+	.byte	0x7
+	.byte	0x40
+	.byte	0x3
+	.long	0x268
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x4b
+	.long	0x3d6
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1556
+	.byte	0x7
+	.byte	0x94
+	.byte	0x3
+	.long	0x29e
+	.uleb128 0x9
+	.byte	0xa6
+	.uleb128 0x7
+	.long	.LASF1565
+	.byte	0x18
+	.byte	0x7
+	.byte	0x9f
+	.long	0x459
+	.uleb128 0x2
+	.long	.LASF1557
+	.byte	0x7
+	.byte	0xa0
+	.byte	0xc
+	.long	0x8a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1558
+	.byte	0x7
+	.byte	0xa1
+	.byte	0xf
+	.long	0x292
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1559
+	.byte	0x7
+	.byte	0xa2
+	.byte	0x17
+	.long	0x3d6
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1560
+	.byte	0x7
+	.byte	0xa3
+	.byte	0xd
+	.long	0xab
+	.byte	0x10
+	.uleb128 0x10
+	.string	"tag"
+	.byte	0x7
+	.byte	0xa4
+	.byte	0xd
+	.long	0xab
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1561
+	.byte	0x7
+	.byte	0xa5
+	.byte	0xd
+	.long	0xab
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1562
+	.byte	0x7
+	.byte	0xb3
+	.byte	0x7
+	.long	0x3e2
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1563
+	.byte	0x7
+	.byte	0xb4
+	.byte	0xd
+	.long	0x249
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1564
+	.byte	0x7
+	.byte	0xb5
+	.byte	0x3
+	.long	0x3e4
+	.uleb128 0xa
+	.long	0x459
+	.uleb128 0x9
+	.byte	0xbc
+	.uleb128 0x7
+	.long	.LASF1566
+	.byte	0x28
+	.byte	0x7
+	.byte	0xb7
+	.long	0x4d4
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0x7
+	.byte	0xb8
+	.byte	0x23
+	.long	0x4d4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1558
+	.byte	0x7
+	.byte	0xb9
+	.byte	0xf
+	.long	0x292
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1560
+	.byte	0x7
+	.byte	0xba
+	.byte	0xe
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1561
+	.byte	0x7
+	.byte	0xbb
+	.byte	0xe
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1562
+	.byte	0x7
+	.byte	0xc9
+	.byte	0x7
+	.long	0x46a
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1563
+	.byte	0x7
+	.byte	0xca
+	.byte	0xa
+	.long	0x255
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0x7
+	.byte	0xcb
+	.byte	0x10
+	.long	0x4d9
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	0x465
+	.uleb128 0x4
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1569
+	.byte	0x7
+	.byte	0xce
+	.byte	0x3
+	.long	0x46c
+	.uleb128 0x3
+	.long	.LASF1570
+	.byte	0x8
+	.byte	0x25
+	.byte	0x10
+	.long	0x4f6
+	.uleb128 0x4
+	.long	0x4fb
+	.uleb128 0x11
+	.long	0x506
+	.uleb128 0xb
+	.long	0x506
+	.byte	0
+	.uleb128 0x4
+	.long	0x50b
+	.uleb128 0x7
+	.long	.LASF1571
+	.byte	0x30
+	.byte	0x8
+	.byte	0x29
+	.long	0x580
+	.uleb128 0x2
+	.long	.LASF1572
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x13
+	.long	0x5ac
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1573
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xe
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x8
+	.byte	0x2d
+	.byte	0xd
+	.long	0x93
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1575
+	.byte	0x8
+	.byte	0x30
+	.byte	0xd
+	.long	0x93
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1576
+	.byte	0x8
+	.byte	0x31
+	.byte	0xd
+	.long	0x93
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1577
+	.byte	0x8
+	.byte	0x34
+	.byte	0x1e
+	.long	0x4ea
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0x8
+	.byte	0x35
+	.byte	0x1f
+	.long	0x580
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0x8
+	.byte	0x36
+	.byte	0x1e
+	.long	0x58c
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1580
+	.byte	0x8
+	.byte	0x26
+	.byte	0x10
+	.long	0x4f6
+	.uleb128 0x3
+	.long	.LASF1581
+	.byte	0x8
+	.byte	0x27
+	.byte	0x13
+	.long	0x598
+	.uleb128 0x4
+	.long	0x59d
+	.uleb128 0x12
+	.long	0x9f
+	.long	0x5ac
+	.uleb128 0xb
+	.long	0x506
+	.byte	0
+	.uleb128 0x4
+	.long	0x4de
+	.uleb128 0x3
+	.long	.LASF1582
+	.byte	0x8
+	.byte	0x37
+	.byte	0x3
+	.long	0x50b
+	.uleb128 0x7
+	.long	.LASF1583
+	.byte	0x20
+	.byte	0x9
+	.byte	0x1f
+	.long	0x5fe
+	.uleb128 0x2
+	.long	.LASF1584
+	.byte	0x9
+	.byte	0x20
+	.byte	0xb
+	.long	0x603
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1577
+	.byte	0x9
+	.byte	0x21
+	.byte	0xc
+	.long	0x609
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1578
+	.byte	0x9
+	.byte	0x22
+	.byte	0xc
+	.long	0x609
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1579
+	.byte	0x9
+	.byte	0x23
+	.byte	0xf
+	.long	0x613
+	.byte	0x18
+	.byte	0
+	.uleb128 0xc
+	.long	0x261
+	.uleb128 0x4
+	.long	0x5fe
+	.uleb128 0x13
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0xc
+	.long	0x9f
+	.uleb128 0x4
+	.long	0x60e
+	.uleb128 0x3
+	.long	.LASF1585
+	.byte	0x9
+	.byte	0x24
+	.byte	0x3
+	.long	0x5bd
+	.uleb128 0xa
+	.long	0x618
+	.uleb128 0x14
+	.long	.LASF1588
+	.byte	0xa
+	.byte	0x29
+	.byte	0x2b
+	.long	0x635
+	.uleb128 0x4
+	.long	0x624
+	.uleb128 0x15
+	.long	.LASF1589
+	.byte	0xa
+	.byte	0x40
+	.byte	0x5
+	.long	0x261
+	.long	0x662
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x40
+	.byte	0x31
+	.long	0x662
+	.uleb128 0x16
+	.long	.LASF1586
+	.byte	0xa
+	.byte	0x40
+	.byte	0x59
+	.long	0x635
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b1
+	.uleb128 0x17
+	.long	.LASF1590
+	.byte	0xa
+	.byte	0x37
+	.byte	0x10
+	.long	0x9f
+	.long	0x683
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x37
+	.byte	0x41
+	.long	0x662
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1591
+	.byte	0xa
+	.byte	0x31
+	.byte	0xd
+	.long	0x69b
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x31
+	.byte	0x39
+	.long	0x662
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1592
+	.byte	0xa
+	.byte	0x2b
+	.byte	0xd
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x2b
+	.byte	0x37
+	.long	0x662
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 13 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xd
+	.file 14 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 16 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 17 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x11
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 27 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 31 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x20
+	.file 33 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 34 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 35 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x23
+	.byte	0x4
+	.file 36 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 38 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.file 39 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 40 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF993
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 41 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 42 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.file 43 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1384
+	.file 44 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x4
+	.file 45 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2d
+	.file 46 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1397
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1418
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1420
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1015
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1396
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1414
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1417
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1593
+	.long	.LASF1594
+	.long	.LASF1595
+	.long	.LASF1596
+	.long	.LASF1597
+	.long	.LASF1598
+	.long	.LASF1599
+	.long	.LASF1600
+	.long	.LASF1601
+	.long	.LASF1602
+	.long	.LASF1603
+	.long	.LASF1604
+	.long	.LASF1605
+	.long	.LASF1606
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x2f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1607
+	.byte	0xa
+	.long	.LASF1608
+	.byte	0xa
+	.long	.LASF1609
+	.byte	0xa
+	.long	.LASF1610
+	.byte	0x2
+	.long	.LASF1611
+	.byte	0x5
+	.long	.LASF1612
+	.byte	0x5
+	.long	.LASF1613
+	.byte	0x5
+	.long	.LASF1614
+	.byte	0x4
+	.long	.LASF1615
+	.byte	0x4
+	.long	.LASF1616
+	.byte	0x4
+	.long	.LASF1617
+	.byte	0xd
+	.long	.LASF1618
+	.byte	0xe
+	.long	.LASF1619
+	.byte	0xe
+	.long	.LASF1619
+	.byte	0xd
+	.long	.LASF1620
+	.byte	0xa
+	.long	.LASF1621
+	.byte	0xd
+	.long	.LASF1622
+	.byte	0xd
+	.long	.LASF1623
+	.byte	0xa
+	.long	.LASF1624
+	.byte	0xa
+	.long	.LASF1625
+	.byte	0xc
+	.long	.LASF1626
+	.byte	0xa
+	.long	.LASF1627
+	.byte	0xb
+	.long	.LASF1628
+	.byte	0xb
+	.long	.LASF1629
+	.byte	0xa
+	.long	.LASF1630
+	.byte	0xa
+	.long	.LASF1631
+	.byte	0xa
+	.long	.LASF1632
+	.byte	0xd
+	.long	.LASF1633
+	.byte	0xe
+	.long	.LASF1634
+	.byte	0x9
+	.long	.LASF1635
+	.byte	0x9
+	.long	.LASF1636
+	.byte	0xd
+	.long	.LASF1637
+	.byte	0x8
+	.long	.LASF1638
+	.byte	0x7
+	.long	.LASF1639
+	.byte	0x6
+	.long	.LASF1640
+	.byte	0x7
+	.long	.LASF1641
+	.byte	0x7
+	.long	.LASF1642
+	.byte	0x1
+	.long	.LASF1643
+	.byte	0x2
+	.long	.LASF1644
+	.byte	0x3
+	.long	.LASF1645
+	.byte	0x5
+	.long	.LASF1646
+	.byte	0x5
+	.long	.LASF1647
+	.byte	0x5
+	.long	.LASF1648
+	.byte	0x5
+	.long	.LASF1649
+	.byte	0x5
+	.long	.LASF1650
+	.byte	0x5
+	.long	.LASF1651
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1375:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1205:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF1417:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF858:
+	.string	"USE_BARO "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1037:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1131:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1382:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1399:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1149:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1379:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1278:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF960:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1017:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1426:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1279:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1499:
+	.string	"_Bool"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF1224:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1383:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF996:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1529:
+	.string	"DEVHW_AK8963"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1552:
+	.string	"DEVHW_M25P16"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF977:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1366:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF994:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1000:
+	.string	"IOCFG_AF_OD 0"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1551:
+	.string	"DEVHW_PCA9685"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF1094:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF956:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1302:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1411:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1248:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF982:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1007:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF1371:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF1586:
+	.string	"vtable"
+.LASF787:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1210:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1343:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1289:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1462:
+	.string	"OWNER_LED"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1071:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1141:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF987:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF1514:
+	.string	"DEVHW_MPU6000"
+.LASF972:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1277:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1078:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1157:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1393:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1080:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1144:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF951:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1030:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1138:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1060:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1476:
+	.string	"RESOURCE_NONE"
+.LASF1235:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1370:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1038:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1003:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF963:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF947:
+	.string	"BIT(x) (1 << (x))"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1251:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1197:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1063:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1434:
+	.string	"int32_t"
+.LASF1213:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1415:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1565:
+	.string	"busDeviceDescriptor_s"
+.LASF1564:
+	.string	"busDeviceDescriptor_t"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1533:
+	.string	"DEVHW_IST8308"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF1467:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1573:
+	.string	"delayMs"
+.LASF1292:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1009:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1477:
+	.string	"RESOURCE_INPUT"
+.LASF1113:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1486:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1018:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1175:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1129:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1521:
+	.string	"DEVHW_BMP280"
+.LASF942:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF913:
+	.string	"FAST_CODE "
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1116:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1558:
+	.string	"busType"
+.LASF1579:
+	.string	"read"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1581:
+	.string	"rangefinderOpReadFuncPtr"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1109:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1329:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1545:
+	.string	"DEVHW_DS2482"
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF1576:
+	.string	"detectionConeExtendedDeciDegrees"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1431:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1086:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1515:
+	.string	"DEVHW_MPU6050"
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1272:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1345:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1455:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF396:
+	.string	"false 0"
+.LASF1475:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF974:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1335:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF976:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1216:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1254:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1537:
+	.string	"DEVHW_LM75_0"
+.LASF1538:
+	.string	"DEVHW_LM75_1"
+.LASF1539:
+	.string	"DEVHW_LM75_2"
+.LASF1200:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1541:
+	.string	"DEVHW_LM75_4"
+.LASF1542:
+	.string	"DEVHW_LM75_5"
+.LASF1543:
+	.string	"DEVHW_LM75_6"
+.LASF1544:
+	.string	"DEVHW_LM75_7"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1061:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1208:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1006:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1295:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF1241:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1457:
+	.string	"OWNER_OSD"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1443:
+	.string	"OWNER_SERVO"
+.LASF950:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF985:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1397:
+	.string	"SPIDEV_COUNT 4"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1325:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF1487:
+	.string	"RESOURCE_SPI_SCK"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1474:
+	.string	"OWNER_IRLOCK"
+.LASF1121:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1363:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF967:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1039:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1077:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF966:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1044:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1111:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1427:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1571:
+	.string	"rangefinderDev_s"
+.LASF1582:
+	.string	"rangefinderDev_t"
+.LASF1540:
+	.string	"DEVHW_LM75_3"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1442:
+	.string	"OWNER_MOTOR"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1128:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1012:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1348:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1398:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1161:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1103:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1016:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1420:
+	.string	"VIRTUAL_DETECTION_CONE_DECIDEGREES 900"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1049:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1047:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1338:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1439:
+	.string	"OWNER_PWMIO"
+.LASF1526:
+	.string	"DEVHW_BMP388"
+.LASF1405:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF1164:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF936:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1203:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1421:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF995:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF964:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1227:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1298:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF741:
+	.string	"USE_NAV "
+.LASF1444:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1244:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1190:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1133:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF998:
+	.string	"IOCFG_OUT_OD 0"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1085:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1153:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1090:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF739:
+	.string	"USE_GPS "
+.LASF1075:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF984:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF1320:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1291:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1151:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1470:
+	.string	"OWNER_1WIRE"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1178:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1577:
+	.string	"init"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1156:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1245:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1449:
+	.string	"OWNER_RANGEFINDER"
+.LASF1341:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1406:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1130:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1122:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1226:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1570:
+	.string	"rangefinderOpInitFuncPtr"
+.LASF1408:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1040:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1584:
+	.string	"detect"
+.LASF1547:
+	.string	"DEVHW_SRF10"
+.LASF1592:
+	.string	"virtualRangefinderInit"
+.LASF1092:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1159:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1361:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF1247:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1290:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1193:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1490:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1373:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF1095:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1118:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1437:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1319:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1126:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1354:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1489:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1459:
+	.string	"OWNER_MPU"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF958:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1346:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1011:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1181:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1186:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1469:
+	.string	"OWNER_TEMPERATURE"
+.LASF1117:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1050:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1460:
+	.string	"OWNER_INVERTER"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1344:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1435:
+	.string	"uint8_t"
+.LASF1089:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1404:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1518:
+	.string	"DEVHW_ICM20689"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF944:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1391:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1215:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"param"
+.LASF1367:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF891:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1568:
+	.string	"scratchpad"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1479:
+	.string	"RESOURCE_IO"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1283:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1566:
+	.string	"busDevice_s"
+.LASF1310:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF698:
+	.string	"__need_size_t "
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1221:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF1535:
+	.string	"DEVHW_MAG3110"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1548:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF892:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1010:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1441:
+	.string	"OWNER_PPMINPUT"
+.LASF1497:
+	.string	"ioTag_t"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF785:
+	.string	"USE_LOG "
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1357:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF1300:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF957:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1041:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1140:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1237:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1409:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF971:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1056:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1508:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1079:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1510:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1125:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1293:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1501:
+	.string	"BUSTYPE_NONE"
+.LASF1239:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1414:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1274:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1587:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1059:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1150:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1334:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1468:
+	.string	"OWNER_COMPASS"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1014:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1261:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1313:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1163:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1166:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1482:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1062:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1002:
+	.string	"IOCFG_IPU 0"
+.LASF980:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF719:
+	.string	"NULL"
+.LASF1184:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1481:
+	.string	"RESOURCE_UART_TX"
+.LASF717:
+	.string	"__size_t "
+.LASF1450:
+	.string	"OWNER_SYSTEM"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF969:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF466:
+	.string	"__PMT"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1465:
+	.string	"OWNER_RX_SPI"
+.LASF1495:
+	.string	"RESOURCE_RX_CE"
+.LASF1452:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1240:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1511:
+	.string	"DEVHW_L3GD20"
+.LASF1438:
+	.string	"OWNER_FREE"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1419:
+	.string	"VIRTUAL_MAX_RANGE_CM 250"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1243:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1162:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1492:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1176:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1087:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF1088:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1051:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1317:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF938:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1160:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1356:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1242:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1188:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF1021:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF476:
+	.string	"__P(args) args"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF988:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF968:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1337:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1054:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1042:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1020:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1331:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1152:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1104:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1262:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1458:
+	.string	"OWNER_BARO"
+.LASF1304:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1057:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1052:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1033:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1407:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1142:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1107:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF1505:
+	.string	"busType_e"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF933:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1413:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1453:
+	.string	"OWNER_SDCARD"
+.LASF1123:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1276:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1362:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1433:
+	.string	"int16_t"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF1422:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1555:
+	.string	"DEVHW_IRLOCK"
+.LASF1425:
+	.string	"signed char"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1546:
+	.string	"DEVHW_MAX7456"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1110:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1525:
+	.string	"DEVHW_SPL06"
+.LASF1322:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1400:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1073:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF1183:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1191:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1591:
+	.string	"virtualRangefinderUpdate"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1233:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1268:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1187:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1516:
+	.string	"DEVHW_MPU6500"
+.LASF1502:
+	.string	"BUSTYPE_I2C"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF1456:
+	.string	"OWNER_BEEPER"
+.LASF1286:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF939:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1385:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1403:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1019:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1024:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF1265:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1211:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1390:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1099:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF962:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1446:
+	.string	"OWNER_SERIAL"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1473:
+	.string	"OWNER_PINIO"
+.LASF1246:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1067:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1326:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF993:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF986:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1028:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1065:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1466:
+	.string	"OWNER_VTX"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1102:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1008:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1219:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1043:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF953:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1172:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1485:
+	.string	"RESOURCE_I2C_SCL"
+.LASF992:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1229:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1034:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1232:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1532:
+	.string	"DEVHW_IST8310_1"
+.LASF965:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1480:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1076:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1105:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1015:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1308:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1530:
+	.string	"DEVHW_AK8975"
+.LASF1137:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1506:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1026:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1392:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1155:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1447:
+	.string	"OWNER_PINDEBUG"
+.LASF1082:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF1349:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF946:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1517:
+	.string	"DEVHW_BMI160"
+.LASF1182:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1108:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1387:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1214:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1496:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF943:
+	.string	"EXPAND_I(x) x"
+.LASF1158:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1249:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"OWNER_PWMINPUT"
+.LASF1115:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1436:
+	.string	"uint32_t"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1189:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF1223:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"DEVHW_LPS25H"
+.LASF990:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1222:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1478:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1282:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1583:
+	.string	"virtualRangefinderVTable_s"
+.LASF1585:
+	.string	"virtualRangefinderVTable_t"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1567:
+	.string	"descriptorPtr"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1147:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1173:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1448:
+	.string	"OWNER_TIMER"
+.LASF961:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1084:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1281:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1503:
+	.string	"BUSTYPE_SPI"
+.LASF1311:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF1257:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1316:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF1432:
+	.string	"char"
+.LASF1154:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1091:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1352:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1238:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1553:
+	.string	"DEVHW_UG2864"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF999:
+	.string	"IOCFG_AF_PP 0"
+.LASF1550:
+	.string	"DEVHW_MS4525"
+.LASF1504:
+	.string	"BUSTYPE_SDIO"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1498:
+	.string	"IO_t"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF860:
+	.string	"USE_UART2 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1312:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1066:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1217:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF935:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF1252:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1572:
+	.string	"busDev"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1192:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1374:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1513:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1225:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF699:
+	.string	"__need_NULL "
+.LASF1472:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1069:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF1536:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF941:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1574:
+	.string	"maxRangeCm"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1119:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1280:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF983:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1097:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1135:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1218:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"RESOURCE_EXTI"
+.LASF989:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1072:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1401:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1260:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1206:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF1139:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1180:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1355:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1301:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1512:
+	.string	"DEVHW_L3G4200"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1377:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1578:
+	.string	"update"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1255:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF376:
+	.string	"unix 1"
+.LASF1388:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1083:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1195:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1402:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1228:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1271:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1416:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF1127:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1032:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF952:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1055:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1531:
+	.string	"DEVHW_IST8310_0"
+.LASF1305:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1136:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1463:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1068:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1323:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1429:
+	.string	"__int32_t"
+.LASF1430:
+	.string	"__uint32_t"
+.LASF1395:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1114:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1284:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1384:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1563:
+	.string	"irqPin"
+.LASF1519:
+	.string	"DEVHW_MPU9250"
+.LASF1569:
+	.string	"busDevice_t"
+.LASF1267:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1412:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1562:
+	.string	"busdev"
+.LASF1074:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1454:
+	.string	"OWNER_FLASH"
+.LASF1025:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1364:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1001:
+	.string	"IOCFG_IPD 0"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1263:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1209:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF934:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF945:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1275:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1124:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF955:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF1013:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1031:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1380:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1557:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1134:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1250:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1365:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1258:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1464:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1093:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF786:
+	.string	"USE_STATS "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1471:
+	.string	"OWNER_AIRSPEED"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1167:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1198:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1269:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1053:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1231:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1120:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1179:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1194:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1036:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF949:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1523:
+	.string	"DEVHW_MS5607"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1004:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1070:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1328:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"DEVHW_MMA8452"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1389:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1266:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1418:
+	.string	"RANGEFINDER_VIRTUAL_TASK_PERIOD_MS 30"
+.LASF1270:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1347:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"DEVHW_MS5611"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1549:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1491:
+	.string	"RESOURCE_ADC_CH1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1493:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1494:
+	.string	"RESOURCE_ADC_CH4"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1212:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1554:
+	.string	"DEVHW_SDCARD"
+.LASF1170:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1590:
+	.string	"virtualRangefinderGetDistance"
+.LASF1534:
+	.string	"DEVHW_QMC5883"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1081:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1045:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF1307:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1253:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1201:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1064:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1559:
+	.string	"devHwType"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1148:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF940:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1234:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1556:
+	.string	"devHardwareType_e"
+.LASF1386:
+	.string	"DMA_NONE (0)"
+.LASF1358:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1048:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF959:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1368:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1230:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1022:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1507:
+	.string	"DEVHW_BMA280"
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF1106:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1500:
+	.string	"BUSTYPE_ANY"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1098:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1165:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF997:
+	.string	"IOCFG_OUT_PP 0"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1273:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1527:
+	.string	"DEVHW_DPS310"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1029:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1027:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1488:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1451:
+	.string	"OWNER_SPI"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1350:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1296:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1145:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1101:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1168:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1132:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1410:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1424:
+	.string	"long unsigned int"
+.LASF1005:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1461:
+	.string	"OWNER_LED_STRIP"
+.LASF1264:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF932:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1588:
+	.string	"highLevelDeviceVTable"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1204:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1381:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1256:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1202:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1520:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1177:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1023:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF937:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF970:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1575:
+	.string	"detectionConeDeciDegrees"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1528:
+	.string	"DEVHW_HMC5883"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1423:
+	.string	"unsigned int"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF1376:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1580:
+	.string	"rangefinderOpStartFuncPtr"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1314:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF978:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1445:
+	.string	"OWNER_ADC"
+.LASF1428:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1396:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1336:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1143:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1353:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1299:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1483:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1096:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1589:
+	.string	"virtualRangefinderDetect"
+.LASF1332:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF975:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1220:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1560:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1207:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1146:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1614:
+	.string	"rangefinder.h"
+.LASF1612:
+	.string	"io_types.h"
+.LASF1626:
+	.string	"long-double.h"
+.LASF1635:
+	.string	"__locale_t.h"
+.LASF1637:
+	.string	"platform.h"
+.LASF1639:
+	.string	"target.h"
+.LASF1620:
+	.string	"libc-header-start.h"
+.LASF1618:
+	.string	"stdbool.h"
+.LASF1604:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1594:
+	.string	"src/main/common"
+.LASF1608:
+	.string	"stdint-intn.h"
+.LASF1603:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1606:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1627:
+	.string	"stubs.h"
+.LASF1598:
+	.string	"src/main/target/SITL"
+.LASF1624:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1647:
+	.string	"io_def_generated.h"
+.LASF1602:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1648:
+	.string	"bus_i2c.h"
+.LASF1636:
+	.string	"strings.h"
+.LASF1622:
+	.string	"features-time64.h"
+.LASF1607:
+	.string	"types.h"
+.LASF1597:
+	.string	"src/main/drivers"
+.LASF1605:
+	.string	"/usr/include"
+.LASF1593:
+	.string	"src/main/build"
+.LASF1640:
+	.string	"sanity_check.h"
+.LASF1649:
+	.string	"rcc_types.h"
+.LASF1621:
+	.string	"features.h"
+.LASF1638:
+	.string	"common.h"
+.LASF1629:
+	.string	"typesizes.h"
+.LASF1634:
+	.string	"locale_t.h"
+.LASF1595:
+	.string	"src/main/config"
+.LASF1630:
+	.string	"time64.h"
+.LASF1609:
+	.string	"stdint-uintn.h"
+.LASF1599:
+	.string	"src/main/target"
+.LASF1643:
+	.string	"utils.h"
+.LASF1613:
+	.string	"bus.h"
+.LASF1650:
+	.string	"bus_spi.h"
+.LASF1600:
+	.string	"src/main"
+.LASF1610:
+	.string	"time.h"
+.LASF1651:
+	.string	"dma.h"
+.LASF1631:
+	.string	"wchar.h"
+.LASF1646:
+	.string	"io_def.h"
+.LASF1645:
+	.string	"io.h"
+.LASF1596:
+	.string	"src/main/drivers/rangefinder"
+.LASF1601:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1632:
+	.string	"string.h"
+.LASF1625:
+	.string	"cdefs.h"
+.LASF1619:
+	.string	"stdint.h"
+.LASF1642:
+	.string	"build_config.h"
+.LASF1616:
+	.string	"rangefinder_virtual.c"
+.LASF1628:
+	.string	"stubs-64.h"
+.LASF1623:
+	.string	"wordsize.h"
+.LASF1615:
+	.string	"rangefinder_virtual.h"
+.LASF1633:
+	.string	"stddef.h"
+.LASF1641:
+	.string	"common_post.h"
+.LASF1644:
+	.string	"parameter_group.h"
+.LASF1611:
+	.string	"resource.h"
+.LASF1617:
+	.string	"stdc-predef.h"
+.LASF0:
+	.string	"./src/main/drivers/rangefinder/rangefinder_virtual.c"
+	.text
+	.section	.gnu.lto_.profile.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	"\002"
+	.string	"\003"
+	.string	"\005"
+	.text
+	.section	.gnu.lto_.icf.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 s\245\002"
+	.string	"4\004g"
+	.string	"\006"
+	.string	"\360\361\310\337\002\004\002"
+	.string	"\002"
+	.string	"\002\001\002\002\001\352\263\360\321\b\002\354\305\200\200\005\003\304\311\360\226\001\003\002\002\004\342\367\217\377\n\020\004\002\005\002\006\007\b\002\005\005\377\206\275\347\002\002\002\t\002\002"
+	.string	"\006"
+	.ascii	" \213\235ip\221\314Q\300Y\334\006\260"
+	.text
+	.section	.gnu.lto_.ipa_sra.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 L\275\001"
+	.string	"T\002@"
+	.string	"\005"
+	.string	"\001"
+	.string	"\020"
+	.string	"\007\001"
+	.string	"\001\002\003\003"
+	.string	"\002\004\002\003\005\002\003\002\001\200\004"
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"0\003\334\fC)Rp\031\013\231\033h\003"
+	.text
+	.section	.gnu.lto_.inline.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\005\005"
+	.string	"\202\t\035&pU\222\016\374\371\006\321\347\377\237\337\377\217\370\336A\375\3749\320;\370\207\375\177_/*\034i\003\321\264\266\233\334)\377\375\272\247\352\251\342\367\321\375\337\207\270O\232'\315;\020\240\022\311\330\353\321\026\362\320;\017&\315\336,F2\314\001\221\r;\314$`\263~(j\332FOQ\242 |\353.m\005;,8\377\234\320'\330\266\307\267\005)m\003\377l\206\021"
+	.string	"/B\213)\265}b=\232\373T\247\206f\246d\326\004L&V\006\300.\350\001V\fn\323\024\334\024{`\031\243"
+	.ascii	"n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 gE\002"
+	.string	"\224\003["
+	.string	"\005"
+	.string	"\001\001"
+	.string	""
+	.string	"\002\005"
+	.string	"\177 \002\003\004\002\001\001\017\177\002\005\177\002\002\005\002\001\001\016\001\004\004\177"
+	.string	""
+	.string	""
+	.string	"\001\300\004\001"
+	.string	"\300\004\002\177"
+	.string	""
+	.string	"\004\177\001"
+	.string	"\001:"
+	.string	""
+	.string	"\005"
+	.ascii	"f\036\353r\027\224\333R\322\006\260"
+	.text
+	.section	.gnu.lto_.pureconst.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 \024\241"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\005"
+	.ascii	"\231\004\002\231\004\003\231\004\004\232\004\005\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 \317=\003"
+	.string	"\022\005\020\034\260%\351\f\340p\224'I\n\226$I\305r\271\333\326Hk\255aM\220\326\222L\001\252n\323\330\321\002,h\266\254\025s"
+	.string	"I@\247d9\347\362Q)\n\023\311\260C\236\307\356\347\257>\217\203\020"
+	.ascii	";c\241\277K\005\033\320\016\b\203ymg\213@ \327\005,\230e\271"
+	.ascii	"\004\206\003\t\363i\002\300\006\f\332"
+	.text
+	.section	.gnu.lto_.lto.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_virtualRangefinderInit.17.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"]\n"
+	.string	"\346SI@0\305*\035"
+	.string	"x\376z\376\034~}3\311\024\311"
+	.string	"\3701\013Vj\320\326l:\233Zk\265\267\037\323\247m\353\261`&\006\201\241\303\302\220l$\0338!PY\253\306\301\333@\225\fn\264wJ\0014"
+	.string	"6"
+	.string	"7"
+	.string	"\335\251\307s\270\323\356\b\334\251E[\300\307\222\215x\351\260\031\330]o\222\\\274\024\375\247|\301V"
+	.string	"\026k]\026H\354\256%,\366q\317\333n\260]\262} \022\201=\266\344\034\261\237\331\335\365\224\331SZJ\351\323\r\001\016\200]\217[\202\205\241.&\266\277\261\rD(.\355\323\216\"\276\266\361\203]\331\200\226\335\321\301\023\001\256\371\262FZNC\204\274f\313vx[F\267\313\361\340\263h\234\272\031\213;\225SS\363U\276\302\362gN\255\344a\247\376\212;\375d\b"
+	.string	"\342\2227\237\3069\211\331\366|\036\317\207\004\002u\022T\337hZ\324\261\b\245P\025TU\324od\002I_\311\024\252\336\251~*\260\216<\023\030\272\360D\365\344u>\0161\276\352\241\302\260z\233q\237\331)\263B\r"
+	.ascii	"|~k/\\d\332\203\312\332p#QcB(\343\032\312\236JCs\301\345[\215"
+	.ascii	"\036w\270\323N2"
+	.text
+	.section	.gnu.lto_virtualRangefinderUpdate.18.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`\222"
+	.string	"m\n"
+	.string	"\346\323IA0\247*\035"
+	.string	"U\316\037\243=\350\326\2658\216\037(~O\02204\"\263\372\204\021\315(\254\376?nP\200\266\216\211\327s\250\f\025#\202&Q\240^\377\316j0\231\302\0033\250*a\334h\357\224\0024"
+	.string	"6"
+	.string	"8"
+	.string	"\335\251\307k\270\323\356\n\334\251E[\301G\223\245\260\201\320\026\354\2567K.^\212\376U\356  \201\013\266\272D\250\330]K\027,\344\236\267\ra{d\273A\322\201=\256\344$\261o\331\335\365\214\331SZJ\351\323L\201\205\332\356\353\366`\017P\002'\266\217\2613\257\213K\373(O\021?\363x\302n\214\301\200\3351\302\026\001\254\331\362EZNO\214\264\346\312vx\032G\267\373!\341\007\350(u2\025w*\347e\346\257\034\200\312\227\371\224\222w\235\372)\356\364\363\301&\302\2227\337\200\246\206`\003\346|\034NG\344\361l\030P_h\032\264\311\370\234L\025Da\324/D\002E\337\210\364\251^\251~(\260\206<\022\370\321\360@\265\344m:\0167\276\352\231\302\260z\230qo\331\031sC\r"
+	.ascii	"|~k/\\d\332\203\312\332p#QcB(\343\032\312\236JCs\301\345[\215"
+	.ascii	"\036w\270\323N2"
+	.text
+	.section	.gnu.lto_virtualRangefinderGetDistance.19.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\355\n"
+	.string	"6\024LC\020\311*\035"
+	.string	"?\335/3\002\240\310\n\260\b"
+	.string	"\374\313\tgVx\3044\276\002A\351\212Mk[u\265\344\242u#4&\205\312X\005@\nDLAq\371\036.\036\266Gl\303\316\322\203d\220M\366N)7"
+	.string	"8"
+	.string	"9"
+	.string	"\266/\340\003Vfq\343\213\354\343\201\311\201\t\273\373i\236\351N\271Kt\247\323\345\254K\226\377\002\267\260-\210\311Z\227\013\034\273k\031\223\245\334\363\2661l\217\354?\004-\366\271\235,\266\245)'-\247\364;\210"
+	.string	"\023\266]\224[\205e@\025"
+	.string	"\260\275\2621\266\203\004\017)\355\323N`\365\221\204\"ba\265\223\004\273c\206;\274S\217\236\003\rtn\254\274f\3136\3516\321\333\205i\370\bJF\274\231\252;\225\223\201\346\327n@\345\317lB\311\307N}Tw\372y\341@\305%o~\204\f\204\006+)\330cK\316\346\200\034NG\344\361l*R`h\032\264\t\371\240N5L\201T0T\nE\340\250\364\251\237\251\202\251\260\206\276R\370!}\240j\3726\035\213\"`\375N\242X?\314\2707\235\032\327|9\020"
+	.ascii	"|~k/\\d\332\006#\fv\247\200\331\020\033\023B\031\327P\366T\032"
+	.ascii	"r!\227\307\354}`\354A\273=JJ\347\232d"
+	.text
+	.section	.gnu.lto_virtualRangefinderDetect.20.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`b\001E\017"
+	.string	"\366\235kG\340\262(\035\2404@\350\371\321kqF[\345\233 T\370!\002\027\201-SP\200v\377\223\340\272\346\217\365\225\340\032?\370\333If\312\216\253\310B\210\307\3031\302\3220G\211c\250(($\313Z-Ad\023)S\nY"
+	.string	"R"
+	.string	"W"
+	.ascii	"$\334c\367\021\356\321\266\025\234`\216=\0241\363\233\r\032|"
+	.ascii	"\204vCOC<v.n\232"
+	.string	"1\037@Mv\216\300c\327\341\333v\340\203\r\016$9nx\214j\030R\267\221\232\030@\001j\264\r\001\220\216\207\363<ej\263L\221\223\335u\306\324hn\221\333\206`{e_&\273\273V\034\333i\321w\376\356\341\037\235V\247sK\237t\262\021\362Q\362\263;3D\310\342\2104J\330\276}\0260{d\223j\240h\236'|)\021\260\264\036\024\023\272G\022\f\224\314\257\360S\\\005\354;\027>`\027'H\306n\230\300\f\272G\207\017-\371\030\221F\225y\250\307\213\033Qs\256\031hN\334l\232\343\307\270\324\203\350\322\327\324\00763\225\331\266\360\026\255n\227\266\300\357q\271t\273{\022\217\327\002A;09\344\t\244S3C\375\302EM\351\331AK >\317\035\230\260\031\372\261\031\304\016e\2519\366\267\037K\n\312\365\342l\372L\246\323\212\211I\311\300\353K\251UJ,(\027\027\250zE"
+	.string	"\277\324J\265\362IX\241@\257\005~/\025\230\362V*T\213\247\002\266\274\322\311\254\n\037\350\271X,\320\033\205\373m\025\247\201\216\021.~\266\373\334Q\244\2522\266U}\002\2433n\224Q;\265)\004\025"
+	.ascii	"|~k/.m\330\243\2305wfq\312V\370\243\205\203\22183:\\\343'L\001"
+	.ascii	"\001\233\206P\fa@.#\202\314\325PsZ\356u\325\\U(\263\254\271\007"
+	.text
+	.section	.gnu.lto_virtualRangefinderDetect.part.0.21.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`a\002m\021"
+	.string	"\326\036qJ\300TU:T\245%\023\251\331f\210\226<\200bo\373\030\230\233\006kJ\314\216\361\355\361%\003+\227s\361\251[7}\177\241\214\020n\024G\325\1775\tlGR\210v3\233\t`\256&\374\335\241s\232\274\324\030!d\357\224\002W"
+	.string	"Z"
+	.string	"b"
+	.string	">\266\023\330\355\031\335\330=\025\\\264\003\322E\23770^$\275\300x\321~\f\263\244n6\266\315\222\3029\367\323\307{\316\007\017\301\"\273'y\261\256x\356\225\2069\237\356n8\274>\370\025!6r\200\b\335\21085yX\342\262\273&\215\270\305\333f`\373e\323_\343E\025\243\022:z\344\007O\372\261\343\302\310\220\245Hh\325q\r\037n\355\331\246\256?\177z\340\177"
+	.string	"+,\004\234\330\345\035%\331\024\342P\013\333\267\037\274\331%?\210\263K\376\251\351x\t\351\201?\265\224\001[\003\344\301p\273\217-\345\334\0206&\241\227J\177\372=\227\201{'\021\336C\002\021\317\004\025\n\205\363\250\020\004\206-\250N\212vu\337\331\253\357`Q\242\035\316\213\241\333\345s\220;%51\307\221\240\b\305\221\313\214\266\3535d\016\024\231@p\330h\323\234\006,\200ow\027\370B\0334\370?\333x\021\305G\304\004D\302\307\253?\343A5\377\347\330\214~w\321\237\005\345\314\205\225\2146\032U\242P)\230\226\226\223\n\255lU\263N3\253\231\314t\321Tf\331z\271`\312\230\327\312$cfIs\231-\362\345Z\321\220,3F\236R\206e(MR\006\203\231d\351\341\326\236\t\375sc\255 l\327j\027]\355\340Z\253\216\355\006<\234\240\255*l\002\352y"
+	.ascii	"!1 \020\243!\2336\234\277\265\037\227fi\016XZ+)\366\366<\300"
+	.ascii	"\341\020i2O\300\003A\346\34113\004`Ay\203U\206=\331'\n\3765\232"
+	.ascii	"\211\346\030W\254\263\bK\206\3248\273W\226\020Z\305{\205\302"
+	.ascii	"\307\006\335\211\001\2011kgl\027\231!\346\032,\263\316\271\007"
+	.ascii	"(\016\243:\220\024\003\027\337\177\355\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 \302\275\003"
+	.string	"\004\006\276"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\021\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\020\025\300\204\001"
+	.string	""
+	.string	"\003\002\022\177\026\002\023\177\027\025\177\030\271\224\202\202\200 \024\177\031\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	"\265\001\004\002\003\003\005\004\336\310\355\371"
+	.string	"\001\302\001\004\005\321\231\263\346\002\001\225\001"
+	.string	"\b"
+	.ascii	"\200\210V!M\030\016\270\001\202\002\216\321\263&4\212*\003"
+	.text
+	.section	.gnu.lto_.refs.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\001\002"
+	.string	"\001\003"
+	.string	"\001\003"
+	.string	"\001\003"
+	.string	"\004\004\001\001\002"
+	.string	"\002"
+	.string	"\f"
+	.string	"\002\002\016"
+	.string	"\002\003\020"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"(\265/\375`\322\016\305E"
+	.ascii	"Zu\360\031A@\246Nc\220\333\344\346\233\276\257\367E\0073sl=\334"
+	.string	"\345^\223<\362l\246a\006\251\t\031\016\372\351\256\n\223\342n\2348_\377\203\357\r\224\357\375\313\347\240?\307\347\223wD`l\333\275\211\224)W\001\233\001\216\001y-\307\300\370l\3571&\001\332\362\342\212\370\355\035G\021\243\242\242\204ih\306\334\244\364\317ts\252\227\0331]\346\336\250?\326\310\276\3504\257\311r\031\356s\231\315s\233\354\346H\315xG\367\336L\231\n\034%\025\235.\310Nj\232\305V\036G\371s\352\263\221U\357\354\244.\350\261\016_<\237y\215\345\266\360\003of:\360yE1\223\313 \235m\201z\3514\227\3219\232\335\236\313d2\303f\234\313\244{/sf\260\2243\203\340\334\225%\0315\275\323\372\245\365H\353\237\343?\207\311jy\f\320\365\202\367\333\336qSzF\214\f\252\323\377\206\236\307\374\024,<o\270\267\332\336\033A0\017\027,p:\275^\001\304\331I]\263"
+	.string	"5\303\237\0014a\3703S\036\376Y\370g\244\254\364\340\351\3278\376\\u\341\277\333\17787\363\350\377\341\257m\374\177\363?\316\334\335\374\027\376\372\005\035T\212\377k\377\347<\030\363\244_\207\370\263\205?[\3759\302\237\241\376\374\340\317\016\376\274\376\367\363\037\320\177\276\377\212\376,\340\317\007\376\\\367\347\247?\023\377\\\340\317\004\376\354\364\347\001\377\361\374\267\373_\347\377\235\377v\376\033\370O\347\277\372\367\367\367\367\347\262\037\270\364\013\327h\324h K\312\246\275\307\362\314\324\330r\240E\201\264S\023\321\257\036\242\275t\020\375\245\205d8\r\226\365\\3uS\203e\277\274(\333\275]\251\325\351eBK\301\275a?f\271\220\241L(\333\221q"
+	.ascii	"\203\267WA\203eFzI7'\037\322`\271/\023ZZ\306\373\325P\307\311"
+	.ascii	"\236\337\336;**\212\030\245\324\205/K^\200T\273\\\021\f%R\033"
+	.ascii	"\243\2734WJ\006Zv\246\177\\s%\215\255\001\272\002\234p\275\274"
+	.ascii	"V\202\320k\262F\247z'\235\0312\206m\313\372\227\033\t\377\004"
+	.ascii	"\331yS\326\003\3415#\312\2112\034TV\0243eE1\363F\247\007&Y\237"
+	.ascii	"\241T&(\365@\260\365\300\346z\273\354\244^\003Z\277\227\235\324"
+	.ascii	"\274\227\007e\270\247\314\367,(\347=\270\214w\314G\306t\352Y"
+	.ascii	"}\354\235\237\324\374\367\227\237\324\353\266\025@vRu\026\240"
+	.ascii	"\002\202 \244Q\034\225\354\347\216\rO!#`+\336\035\022\242\260"
+	.ascii	"\272#\271\317\363]\025?Y\242:\275\241\314\347?\022\222^\037\023"
+	.ascii	"6|\366\034q\225\371\201\323)\\\336\223\365\374{\357%%m\006\271"
+	.ascii	"\215\362@)!\352\303\364\202\207\216\t\252FL\315.\246\323v\204"
+	.ascii	"\354\216\235|\347t\273\323v\352H\211\303dM\247u1\361\210o\013"
+	.ascii	"\0202:}\326\263>\253\261\345\330\313\0319\031N\246\223\343d\270"
+	.ascii	"<'\307=\243\311iN\214\367n\356\275\237\325\324d\272\2658\252"
+	.ascii	"\266\374\206\200\351\212H{\333\333;~\205?\213\231\023o\f\341"
+	.ascii	"A \353s\266\243*-y\241\233h'\327O\376?\321\3205\336`GV\314\372"
+	.ascii	"\320\371\355\260\027\352\327\317kh0\255K\0200\032J\306C\273\023"
+	.ascii	"\203\002\013\321\276D\351\323\351\036]\204\fv\277t\372Tm\375"
+	.ascii	"\365\257n\"\301x\3131\207\352\237\237\203J\031\230\033\374O7"
+	.ascii	"\360?QG\274\225n\201\n\251s\236I\n-\330\337[\t\277Mn\034}\276"
+	.ascii	"n\363\231$\273\321\247\323\215>\225\332\255[:\337\375T\256\033"
+	.ascii	"v\256\356r\357(\274\235\302\370\271w\374T\256\361\362\335n\374"
+	.ascii	"\204\233\334\346\323\231\335\350~ws\277\001\334\275\235;\372"
+	.ascii	"\034\224\335\375|\335(\354l\332\315\2630\256\2360g\026\022\307"
+	.ascii	"\355\310 \267\271\277\fxi\302\257\235\033\303Yno\345\033\327"
+	.ascii	"~\237{3\201\031\3105\261(\345\230v_Ga\315X\231\305\2060\2410"
+	.ascii	"R\314\334v.\027\230\006\327\336x{H\2252+\2736S\231\367\346\212"
+	.ascii	"\337\275\2310\21408\357\351z\267\322n.\275\230Px\310\305\204"
+	.ascii	"\2736\027(\331\351F\2410\025\033\267\250\331f\306\312l\266\361"
+	.ascii	"\236\357\032U\306\333%\244\324\247\206\217\037\335\\\020oI\033"
+	.ascii	"4\235\306i\276\372\304tj&\026~\351\005\312#\226\337\226\n\261"
+	.ascii	"\321u\205\351.\035\245\b4H\022\274\264K\0259\213\220\374\351"
+	.ascii	"\250\013\233'R\216h#on\342\352\350T\027!\002\335p\001\022\353"
+	.ascii	"\364)\327\372\nk\371\017\002\246+\242\221\240\275\255\221m\331"
+	.ascii	"\253\tRm\262\230C\352J\001kD\026\333\255\343U\313\206H\320\202"
+	.ascii	"x\203\335\301\222\2401\343H\303\351F\0027\036\223,\222\235\261"
+	.ascii	"\276\312J\202\025\006\036G\307\240a\202\206\t\3521h\240\242\322"
+	.ascii	"`E\265\336\212\n\330\236\206\224\204\254\"\253\242\335\302b\215"
+	.ascii	"G\341\016\366jKG\f\265\305\332*\301\3428\266\353V\211\036\305"
+	.ascii	"\033l\326\021\016\017<\2128\222\210-\226\025\325\026\313&g\260"
+	.ascii	"WG#{\225\305f!\331\226\307\007\026\251\345\001\251u\\pD\216 "
+	.ascii	"&[\024F\244\016\020m\262\330\256\310q\342i\013k\007{\005\240"
+	.ascii	"\245a\341Z9\330\344"
+	.string	"T\253\245\225\234\022\266X\024*\264\310\343QV\221M\246[X\354\215\030E\026.T\030x\025[UeA\306\205\013R\n\236!\203\207\005-L\204X\215R7\212:\332\344q\007V\222\315B\036e\2603\220\305\344\324V\222\335qLfM!\217E\034S\306\344\326\224T\325\r-\255\016X\301\326\310\266l\226\332\036\221\307\224m\213Y9t\250`t\2310\321X\225#_\240IlrB\206x\321hoF\340\260\3504,\032M\335;\3070\330;\004\223E\247e\321h\253r\300\331\016\203J\202\235(\3334\227k\264\264I\220>ut\252\2670\365\265\275Q\264\b\375\240\215\330\264\234-\332\362\006M]\374B\016Z\2326\313qD2O:\207\326\007\351\326\341]\225*\272,\207m\220\323\333\263r]\226\3370\215\231\351%\nzY\225\230ddW\336\340\223uH\345\205\036\313Z\n\234\226\222\355\020\343M\204"
+	.ascii	"\2407\201\036\250\2018\210\0304#\"\"\"\222$I:q\005\304 \310\234"
+	.ascii	"<"
+	.string	"\017\022 \025=\320)\352\f\211HSPP*m\255\001\032w\267\364Z\260\225\234FVB\230- $\256\265\217Nj\332F\025\366\\\257\320\302\337\354\2628x3#\361\235\315\202\\!\007\002<V\3426_\337\204)\236\357\353\204\207L\211\312\330m\3200\241\342F=\255\245\325N(\007\305C)\313\243P\001 J\\\200\336\205:\365\242\001\002\377rv)\363sko#Lm\376\2208\347^\361\232\235\303\036t\345W\306Q\312\177\317\203\355\300 \006b7ej\342(+\257\247\255\032\"\241=\202\t\366Qj&\001\016\007\001IV\3020}{\2432\314y*\362P\211'\224\225\373.\003\\C\212\367M\201\001*\316\3503*\347\037\250\037\253\335v\265\240\2330L\026(\253:\036\247\n\250\035\224\257l\363\355\324\203I}\303G\251\217\023\302y\236\373\335)rp^\f6\273\250*m4\301\031J\251\341\256"
+	.ascii	"]c\204\306\0064\320\215\022\262\037\321X\357\342\325\325\r)l"
+	.ascii	"\341\207\r<.!\250\363\200\201\316\026\366\331H\305\376\310\340"
+	.ascii	"\007o\340\2109n\341"
+	.string	"1\320\202k\352\375\365\306\317\320i\t\331\314\326:U\372.;]\235J\023r-\360\035\254K\t\017\326\362w\016\277\256$(n\017\n\271;y\326\310\315\352n\366\221\220\323\221R\302$s&\227\226(OyP\035(X,sK\273\321\030\3763"
+	.ascii	"\304\262g\315'\213\002q\007\275.7\245\302\260\036\336\336\277"
+	.ascii	"\237<\355\033\201F\314\377\340'\004q(\321q\024\314\201\t\233"
+	.ascii	"5\217\353-\364Y]E\344(\t5v9\221\321H\206d\342s\277?\354\2133"
+	.ascii	"\270\027\244\240\327\304\370\231o\n\242j\004\203\244\314H\200"
+	.ascii	"v\211\"X\342+Kl a\251\241>\266\350^\261\327!\317\243\317\233"
+	.ascii	"\357\237\235\271\231\001p\322\323\310}\352\223\277\360\374\314"
+	.ascii	"\356\263|\246\336/\233p\346V\001\247\333?J\214}J\203\275\001"
+	.ascii	"{\357\316Y\337!\203\313\371\314\030\004=\212\232\334\274R\005"
+	.text
+	.section	.gnu.lto_.symtab.2f9b24f4a6c62c3f,"e",@progbits
+	.string	"virtualRangefinderDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2f9b24f4a6c62c3f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
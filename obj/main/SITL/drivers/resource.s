@@ -0,0 +1,2782 @@
+	.file	"resource.c"
+	.file 1 "./src/main/drivers/resource.h"
+	.file 2 "./src/main/drivers/resource.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	resource.c.8b0a6a7f
+	.weak	resource.c.8b0a6a7f
+resource.c.8b0a6a7f:
+	.long	0x206
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x9
+	.long	.LASF458
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x4
+	.long	0x111
+	.byte	0x16
+	.long	0x111
+	.uleb128 0x1
+	.long	.LASF394
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF395
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF396
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF397
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF398
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF401
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF402
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF403
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF404
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF405
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF406
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF407
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF408
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF409
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF410
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF411
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF412
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF413
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF414
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF415
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF416
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF417
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF418
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF419
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF420
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF421
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF422
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF423
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF424
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF425
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF426
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF427
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF428
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF429
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF430
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF431
+	.byte	0x25
+	.byte	0
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF432
+	.uleb128 0x5
+	.long	0x13a
+	.long	0x128
+	.uleb128 0x6
+	.long	0x12d
+	.byte	0x24
+	.byte	0
+	.uleb128 0x2
+	.long	0x118
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF433
+	.uleb128 0xa
+	.byte	0x8
+	.long	0x146
+	.uleb128 0x2
+	.long	0x134
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF434
+	.uleb128 0x2
+	.long	0x13f
+	.uleb128 0x7
+	.long	.LASF456
+	.byte	0x3f
+	.long	0x128
+	.uleb128 0x4
+	.long	0x111
+	.byte	0x43
+	.long	0x1de
+	.uleb128 0x1
+	.long	.LASF435
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF436
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF437
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF438
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF439
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF442
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF443
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF444
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF445
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF446
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF447
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF448
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF449
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF450
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF451
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF452
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF453
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF454
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF455
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.long	0x13a
+	.long	0x1ee
+	.uleb128 0x6
+	.long	0x12d
+	.byte	0x13
+	.byte	0
+	.uleb128 0x2
+	.long	0x1de
+	.uleb128 0x7
+	.long	.LASF457
+	.byte	0x50
+	.long	0x1ee
+	.uleb128 0x8
+	.long	0x14b
+	.byte	0x14
+	.uleb128 0x8
+	.long	0x1f3
+	.byte	0x1c
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 1
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 2
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 3 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF393
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x3
+	.long	.LASF1
+	.long	.LASF459
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4
+	.long	.LASF0
+	.byte	0
+	.long	.LASF461
+	.byte	0x1
+	.long	.LASF462
+	.byte	0x1
+	.long	.LASF463
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF417:
+	.string	"OWNER_LED_STRIP"
+.LASF400:
+	.string	"OWNER_SOFTSERIAL"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF426:
+	.string	"OWNER_1WIRE"
+.LASF431:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF383:
+	.string	"SITL 1"
+.LASF411:
+	.string	"OWNER_USB"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF432:
+	.string	"unsigned int"
+.LASF438:
+	.string	"RESOURCE_IO"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF373:
+	.string	"linux 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF401:
+	.string	"OWNER_ADC"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF349:
+	.string	"__amd64 1"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF447:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF430:
+	.string	"OWNER_IRLOCK"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF427:
+	.string	"OWNER_AIRSPEED"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF425:
+	.string	"OWNER_TEMPERATURE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF435:
+	.string	"RESOURCE_NONE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF449:
+	.string	"RESOURCE_SPI_CS"
+.LASF395:
+	.string	"OWNER_PWMIO"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF396:
+	.string	"OWNER_PWMINPUT"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF376:
+	.string	"unix 1"
+.LASF410:
+	.string	"OWNER_FLASH"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF419:
+	.string	"OWNER_RX"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF423:
+	.string	"OWNER_SPI_PREINIT"
+.LASF397:
+	.string	"OWNER_PPMINPUT"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF416:
+	.string	"OWNER_INVERTER"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF440:
+	.string	"RESOURCE_UART_TX"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF458:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF420:
+	.string	"OWNER_TX"
+.LASF409:
+	.string	"OWNER_SDCARD"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF434:
+	.string	"char"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF442:
+	.string	"RESOURCE_UART_TXRX"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF403:
+	.string	"OWNER_PINDEBUG"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF436:
+	.string	"RESOURCE_INPUT"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF23:
+	.string	"_LP64 1"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF405:
+	.string	"OWNER_RANGEFINDER"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF439:
+	.string	"RESOURCE_TIMER"
+.LASF404:
+	.string	"OWNER_TIMER"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF441:
+	.string	"RESOURCE_UART_RX"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF422:
+	.string	"OWNER_VTX"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF452:
+	.string	"RESOURCE_ADC_CH3"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF429:
+	.string	"OWNER_PINIO"
+.LASF455:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF418:
+	.string	"OWNER_LED"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF445:
+	.string	"RESOURCE_I2C_SDA"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF414:
+	.string	"OWNER_BARO"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF457:
+	.string	"resourceNames"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF437:
+	.string	"RESOURCE_OUTPUT"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF399:
+	.string	"OWNER_SERVO"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF393:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF413:
+	.string	"OWNER_OSD"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF424:
+	.string	"OWNER_COMPASS"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF371:
+	.string	"__linux 1"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF415:
+	.string	"OWNER_MPU"
+.LASF456:
+	.string	"ownerNames"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF402:
+	.string	"OWNER_SERIAL"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF386:
+	.string	"__REVISION__ \"43e234f\""
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF428:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF433:
+	.string	"long unsigned int"
+.LASF394:
+	.string	"OWNER_FREE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF374:
+	.string	"__unix 1"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF448:
+	.string	"RESOURCE_SPI_MISO"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF446:
+	.string	"RESOURCE_SPI_SCK"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF444:
+	.string	"RESOURCE_I2C_SCL"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF358:
+	.string	"__k8 1"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF407:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF398:
+	.string	"OWNER_MOTOR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF408:
+	.string	"OWNER_I2C"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF454:
+	.string	"RESOURCE_RX_CE"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF421:
+	.string	"OWNER_RX_SPI"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF450:
+	.string	"RESOURCE_ADC_CH1"
+.LASF451:
+	.string	"RESOURCE_ADC_CH2"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF453:
+	.string	"RESOURCE_ADC_CH4"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF412:
+	.string	"OWNER_BEEPER"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF406:
+	.string	"OWNER_SYSTEM"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF443:
+	.string	"RESOURCE_EXTI"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1:
+	.string	"/root/repo"
+.LASF463:
+	.string	"stdc-predef.h"
+.LASF462:
+	.string	"resource.c"
+.LASF0:
+	.string	"./src/main/drivers/resource.c"
+.LASF461:
+	.string	"resource.h"
+.LASF459:
+	.string	"src/main/drivers"
+.LASF460:
+	.string	"/usr/include"
+	.text
+	.section	.gnu.lto_.profile.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \032\265"
+	.string	""
+	.string	"\200\016"
+	.string	"\002"
+	.string	"\370\361\303\330\002\001\351\275\235\350\006"
+	.string	"\001"
+	.ascii	"\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.c542c1c62797f662,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ownerNames.0.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375`\250\004e\032"
+	.string	"Fq\257>p\356&\0350\374\360\203X\352\213{\\\242\034\006\242\272\322\307_\251K6\224\230\263\345P\263\301D\370\372\377\t{\022\365g\241m\311\342\031\326:2\267\001&\\\203\376\215\007\251\265\204\356$\003\241"
+	.string	"\246"
+	.string	"\235"
+	.string	"\217c_\021H\322Q\201\261\261\257\t\036\245P\001\2367c_\0250\nc_\027$\362b_\251\f\255\320\002\317s\261\257\f\006\375\212}m"
+	.string	"\350`\366\325A\037.\252\260\007\261\257\017\366\364\300\357\260\257\020\360\350Z\200\347\r\373\032\241\016\317\276J\220\263\345\002<\267\354\353\2047\\;\360Da_)\260\361\002M\373Z!M\f\260\013<I\330W\013ff@"
+	.string	"\253\001\236 \354\353\2051\275\032\205\223\r\360\374`_1\\A\354\265\017\306\013A\035@O@}}\235\007\362z\003<\251}\355\227\335\037\016\277\364L\327tN\357\364O\007uQ\037Eq\320\034t\007\345A{P\037\024\b\rB\207P\"\324\310\007\212\204&\241K(\023\nF\235P(4\n\235B\251P+\364\n\315\342\201n\351\200\3651\372\362\221#DS-t\016\2265\366\225V\001@\245\320\357\311\027\373Z\233\364\300.\3665F\225d\235"
+	.ascii	"O*;B\245\330\"^\340\022\373*%\244\007\022\261\257\001~\364\026"
+	.ascii	"\204\321\036\366u\212\236\\\240'\373:\243:,\331W\001\364+\222"
+	.ascii	"}\035\020\212\221}%\340\211\220}-\260\251\217}5\200I\007\346"
+	.ascii	"\261\257\007*\0059|3\251\002\223\345\254\3132$qc\r\354\233\255"
+	.ascii	"\3140_\022w\315Y\337\214\2612l\220\265x/Yf\034JuVx#K,R\020\357"
+	.ascii	"m\024\320#\316a2\326Z\032tZ\274\031\273."
+	.string	"\035\217\326\305\323\321\330\342\261\240\275\330Z\301E\323\342u\3214H\350\035\f\035\217&c\267\343\321\246\272Dm\274e,\353\207\271\230\223y\231\2379\232\253\371\232\267\271\233\303y\234\3179\235\333\371\235\347\271\236\363y\330\375\374\317\003]\320\t\275\320\017\035\321\025}\321\033\335\321!=\322'\235\322-\005}o\266\325\0361\r\207E\312\032\207E~\215#\311\257\363h\216\270X\217W\371\2261\3236\226S]\023\303\257o!\316\267\224\265\b\253\252+\342\260\031\353|\305\034\266]\021\2710\317\032w\3152\253\2245&\313\257k\034\360\327b\016kb)\353\021ex\263\305\272\252\264\372:_\362\336*Y\213\345\370\365\230\303\252\332V$\356\313\367*\207\245\232\304\331,\003\264xo_\347{\205o\355f\251\316\32741\256\314\205\331\234\265\007\016\266\234\213\265\t\363\352k\023\007O\250!8\b\231gRK\352QX\306"
+	.ascii	"#\251)n\020 b\270\t3\036\320\t\365(\255\036^*\324F4@\273\312"
+	.ascii	"\f\331@p\314F\235\366\244k\327\006\200?\251\3524\322\251\241"
+	.ascii	"\241\017\324-\336\240\275W\327\207Z\021\362\213\302\310\"\353"
+	.ascii	"\322\365\241Svd\nF\004/\273\360K_\233\202\027Z\360[\357)\272"
+	.ascii	"#\025\224\275$[&\371\244\340\017A\270\001\323?u\205Zx\275Pu\001"
+	.ascii	"\322|\334\205fr\244\243\257W\221\300\373\213\343\003"
+	.text
+	.section	.gnu.lto_resourceNames.1.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375`\367\001\275\017"
+	.string	"f\332dG\300\030m:(\n\\+"
+	.string	"UQP:#\220\316\b<]E\321\234&9D\266\017D\306\364j\030.\337\307H'\337\020\003\334\353\243O\t\265\316\347\350\250z\337 \324_\276\224\001\364'\262\373B\311\326/j\241F\222\fP"
+	.string	"Q"
+	.string	"R"
+	.string	"C\022\372L\362Q\316T\237\003\3548\365Y"
+	.ascii	"\016\227\206Y\277>\017\250\361\242\211y}& \303A\237\013\274`"
+	.ascii	"\320g\003,\312\271\240\317\007R\224LTb\303\2546}Fp\030\356\274"
+	.ascii	"7\361:\211\016D]`\260z\017\347\240Y\263>\357\210\335L'B\034\032"
+	.ascii	"\354\267\364\304\254f\275\210\316\362\232\017\321\347\314J9\017"
+	.ascii	"\242\317\332\024Qf\302\254\377\320\347\r\nK&Va\326\013\365\231"
+	.ascii	"\233\004\365\231S\3623\307Y\201\372\374r\030\016\t\206\231\241"
+	.ascii	"\326\254\024\332\210k&\346\323\347\321\220r\362\364\031@\220"
+	.ascii	"\222&?tE\266hM\314\216\027D\222f\030G\222\222\326\353\264\375"
+	.ascii	"\211\243\270\212\257x\213\2738\214\307\370\214\323\270\215\337"
+	.ascii	"x\216\3538\217\367\370\217\003\271\220\307N\344E~D\301\223\274"
+	.ascii	"\350K\316\344N\376\344Q.\345T^\345W\216\345Zp\316\345\206'+\202"
+	.ascii	"\005\373\335\371\264m\303\324\251DK;\337hQ\236\351\013\271U\205"
+	.ascii	"sU(\252\nK!*'E\332/Ty\274\021r\036\200\333B\350\300m?\360d\342"
+	.ascii	"=\201\237\211\027\354\264\265Ip\203\243\323m\273\252\021W\244"
+	.ascii	"kl\211$m\221\"\020\213\364\241\026X=\001- \260\"J\252\007\341"
+	.ascii	"\300\244\002\357c\027\033\232\300n\003\264\362\224J\3270\230"
+	.ascii	"\262\013\326<\232vA\036\353\223s\227\211-\337\354\3025\227G\227"
+	.ascii	"\376\322\222\n\251\373\226\240l\315\347\301\326m&\254\255\035"
+	.ascii	"\344Q{\253\031c\370\233\333H|,g\203\255dL\376fb\256\231<\332"
+	.ascii	"\332\2375A\371\r\245\b"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \030\301"
+	.string	""
+	.string	"\024"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001"
+	.string	"\301\204\001"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	"\001\301\204\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.c542c1c62797f662,"e",@progbits
+	.string	"(\265/\375`\243\006\315!"
+	.string	"\026\375\320G\200\226N:\023\002\325\036\253pN\355y\013!\335\335a\004\253\354\022\244\2156<0\306\222\3723\027w\004e\370P~\321Zi\0342L\327=\322\375\245T\252\336~`\"\336]\367\347\336\036\266\300\023,\244%\276\255L)\227"
+	.string	"\312"
+	.string	"\306"
+	.string	"\302\2754\005\022\376\n~\005\225J\307\324\327Ym\341w,\324Wb_\371\254\341y$\003+\355J\323T\b\004KcNm5\326\211\347\357\303s\370\341\031\314\361\223\270@V\212c\001\277\231\364\304\363L\037\236\336\237m0\3734\366\203\237\261/c\273\306\376\222\355'\366c\354W\373\267o\333L\333{\266\363l{\261mg\273\316\366\234m9\333K\333Xl\277\331v\263\335f\233\3156\232m)\266\211\366y\330\206b\233\211\355\265\235f\333\327l6\233\266\255l\023\331\347\205dJ[c\3744\264z\347\266\226\264\325G\263\177v)\347\322\020|\013\263\203\332\032\341\304\023\300\207\347\313P\337l\221<%\243\266\236\037\236>f\330\325\303\016\245\326"
+	.string	"\361E\231e\301\003\223\t\332\221U\264\325\027\373\330\317+\314\222\324\326\223\241\276\223\231dQRj\353\202\017\317\001\013\205\342W\203r~\344\257\272z\325\231\034)M\201\244\204?l[O\362\322#\032\r"
+	.ascii	"\324(\"V\005,@Q\334\225\034\026PF\262I\222\255\376\227}\253#"
+	.ascii	"\271W\220)M\205\3224-\340\253\003ZnY\257w\371\222FLX5\302*\030"
+	.ascii	"ORXV2dzD\224\266^\353[>\327\227\370\006\307\276\237\254\324*"
+	.ascii	"M\323s=`JS\240s\005z\337kNu1\332\352\261\023\317\2318\324\007"
+	.ascii	"#\004\343\353\307\227\274\0318\234\236g\037"
+	.string	"\357^\226\204AE\321mMp\342Y\273\240\376\335\204\036MT[}\\\3542 \005y\333\352\333u1}\254h\333\3723\324\257C\320$\n\031\335\334/\306\220ri\253?g\237\312\345hh\bir\332\352)ZP\177K\314R\032\216\036[\201Y\2261\312$\336\027\234\277\264\037w,QJIm[\335u\342)\243D}8\241\025\261\273\037W\336\200OZ_J[\3757\373V\356v\242\311\364\262\325q'\2364TP\277\n\220\255\214\356jkpJ\033\315\335RG\212\255~\233\375\262\263\235I\241\034C\266:PC\3755_\034R>G\036\243\016\362\b\242D\317\214\021\270'\304\021Y\024\321\323\203,\002\221F\017;\325\035r\214\020\214\0166D\260!`\t\022($\300\240S\341\267cS\364A\036I|@r(\202\370`\344)\356 }\2126\007|\216<F\235\343\016rD\217\317\021I\323bY\274"
+	.string	"[.\013\373\006\307\312\204PPs+\212z\215~\245\2474[Q\264E\224MD[\275E\366\273\254\212\352dcyc\253\201\024\2507\351\033+#\332\333\272K4\024T\272H\032\262\325;d_\313\n\335\030\361\330\261\325gz\2507\3504\222\324\243Z\240\375\201\333R\363\332\352\375\261\257\266i0lM\353i+\003<\324o\326&<\027B\3020\207\216\324\206\266\372L\373\001x\250Q<e\2104H\023\031RFA\262\034\240\002\t\304\216\272\001\021@\245\202FRe\346\326\317@\243t\302^\244\367\202\203I\232j\252o\312\341\335t5\342\2005\300\304\201\374OQ\362X;\202\001\342a\340\bv\317h\0134\252Yj \313\221\330\232\032\030\030e!9\301:J\222\323\2027\2560\256\325\306\245\256\266-Ns\322nI\206\030\325\233C\016\301V\3437\204\330\311\345\217\307n!\031\tc\234G,$\240\022\035"
+	.ascii	"\343\334\231/\023+P\022\326\"L`\344@\177+\364\211$X\234\263N"
+	.ascii	"\236N\004y\343\212Zt<|Na`qK\237e\322Oh\266\020y\324[\2006\342"
+	.ascii	"&-F\210\034\334\234\016\227\214\211k\021\037\027y\221i\026\322"
+	.ascii	"\307\363\375ZL\022\272\360\274\371V\346c\340\006Z\261*\263\345"
+	.ascii	"C\267[\3747\270\320\340M\200\343B\242\n"
+	.text
+	.section	.gnu.lto_.symtab.c542c1c62797f662,"e",@progbits
+	.string	"resourceNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314"
+	.string	""
+	.string	""
+	.string	"ownerNames"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324"
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c542c1c62797f662,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,9353 @@
+	.file	"serial.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/drivers/serial.h"
+	.file 4 "./src/main/drivers/serial.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	serial.c.11d09f41
+	.weak	serial.c.11d09f41
+serial.c.11d09f41:
+	.long	0x688
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x12
+	.long	.LASF1420
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1335
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1336
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1337
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1338
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1339
+	.uleb128 0x6
+	.long	.LASF1341
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1340
+	.uleb128 0x6
+	.long	.LASF1342
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.long	.LASF1343
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1344
+	.uleb128 0x14
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1345
+	.uleb128 0xb
+	.long	0x80
+	.uleb128 0x6
+	.long	.LASF1346
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0x8c
+	.uleb128 0x15
+	.long	0x8c
+	.uleb128 0x6
+	.long	.LASF1347
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x6
+	.long	.LASF1348
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x4
+	.long	0x87
+	.uleb128 0xf
+	.long	.LASF1352
+	.long	0x30
+	.byte	0x1a
+	.long	0xe0
+	.uleb128 0x5
+	.long	.LASF1349
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1350
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1351
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1352
+	.byte	0x3
+	.byte	0x1e
+	.byte	0x3
+	.long	0xbf
+	.uleb128 0xf
+	.long	.LASF1353
+	.long	0x30
+	.byte	0x20
+	.long	0x13d
+	.uleb128 0x5
+	.long	.LASF1354
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1355
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1356
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1357
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1358
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1359
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1360
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1361
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1362
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1363
+	.byte	0x10
+	.uleb128 0x5
+	.long	.LASF1364
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1353
+	.byte	0x3
+	.byte	0x34
+	.byte	0x3
+	.long	0xec
+	.uleb128 0xd
+	.long	.LASF1370
+	.byte	0x10
+	.byte	0x37
+	.byte	0x10
+	.long	0x16e
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x38
+	.byte	0x14
+	.long	0x16e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1366
+	.byte	0x39
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x6
+	.long	.LASF1367
+	.byte	0x3
+	.byte	0x3a
+	.byte	0x3
+	.long	0x149
+	.uleb128 0xb
+	.long	0x173
+	.uleb128 0x6
+	.long	.LASF1368
+	.byte	0x3
+	.byte	0x3c
+	.byte	0x10
+	.long	0x190
+	.uleb128 0x4
+	.long	0x195
+	.uleb128 0x9
+	.long	0x1a5
+	.uleb128 0x3
+	.long	0xa2
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1369
+	.byte	0x3
+	.byte	0x3d
+	.byte	0x10
+	.long	0x1b1
+	.uleb128 0x4
+	.long	0x1b6
+	.uleb128 0x9
+	.long	0x1cb
+	.uleb128 0x3
+	.long	0x16e
+	.uleb128 0x3
+	.long	0x64
+	.uleb128 0x3
+	.long	0x7e
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1371
+	.byte	0x60
+	.byte	0x3f
+	.byte	0x10
+	.long	0x2a4
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0x41
+	.byte	0x24
+	.long	0x352
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0x43
+	.byte	0xd
+	.long	0x8c
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0x44
+	.byte	0x10
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0x45
+	.byte	0x13
+	.long	0x13d
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0x47
+	.byte	0xe
+	.long	0xae
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0x49
+	.byte	0xe
+	.long	0xae
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0x4a
+	.byte	0xe
+	.long	0xae
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x4b
+	.byte	0x17
+	.long	0x357
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x4c
+	.byte	0x17
+	.long	0x357
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x4d
+	.byte	0xe
+	.long	0xae
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x4e
+	.byte	0xe
+	.long	0xae
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x4f
+	.byte	0xe
+	.long	0xae
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x50
+	.byte	0xe
+	.long	0xae
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x52
+	.byte	0x1e
+	.long	0x184
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x53
+	.byte	0xb
+	.long	0x7e
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x55
+	.byte	0x23
+	.long	0x1a5
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x58
+	.byte	0xe
+	.long	0xae
+	.byte	0x58
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1389
+	.byte	0x68
+	.byte	0x5b
+	.byte	0x8
+	.long	0x34d
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x5c
+	.byte	0xc
+	.long	0x382
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1391
+	.byte	0x5e
+	.byte	0x10
+	.long	0x39b
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0x5f
+	.byte	0x10
+	.long	0x39b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0x61
+	.byte	0xf
+	.long	0x3af
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x64
+	.byte	0xc
+	.long	0x3c4
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x66
+	.byte	0xb
+	.long	0x3df
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x68
+	.byte	0xc
+	.long	0x3f4
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0x6a
+	.byte	0xc
+	.long	0x414
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1398
+	.byte	0x6c
+	.byte	0xb
+	.long	0x3df
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1399
+	.byte	0x6e
+	.byte	0xb
+	.long	0x428
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x71
+	.byte	0xc
+	.long	0x438
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x72
+	.byte	0xc
+	.long	0x438
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x75
+	.byte	0xc
+	.long	0x457
+	.byte	0x60
+	.byte	0
+	.uleb128 0xb
+	.long	0x2a4
+	.uleb128 0x4
+	.long	0x34d
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x6
+	.long	.LASF1403
+	.byte	0x3
+	.byte	0x59
+	.byte	0x3
+	.long	0x1cb
+	.uleb128 0xb
+	.long	0x35c
+	.uleb128 0x9
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x8c
+	.byte	0
+	.uleb128 0x4
+	.long	0x35c
+	.uleb128 0x4
+	.long	0x36d
+	.uleb128 0xc
+	.long	0xae
+	.long	0x396
+	.uleb128 0x3
+	.long	0x396
+	.byte	0
+	.uleb128 0x4
+	.long	0x368
+	.uleb128 0x4
+	.long	0x387
+	.uleb128 0xc
+	.long	0x8c
+	.long	0x3af
+	.uleb128 0x3
+	.long	0x37d
+	.byte	0
+	.uleb128 0x4
+	.long	0x3a0
+	.uleb128 0x9
+	.long	0x3c4
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	0x3b4
+	.uleb128 0xc
+	.long	0x3d8
+	.long	0x3d8
+	.uleb128 0x3
+	.long	0x396
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1404
+	.uleb128 0x4
+	.long	0x3c9
+	.uleb128 0x9
+	.long	0x3f4
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0xe0
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e4
+	.uleb128 0x9
+	.long	0x40e
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x40e
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x413
+	.uleb128 0x16
+	.uleb128 0x4
+	.long	0x3f9
+	.uleb128 0xc
+	.long	0x3d8
+	.long	0x428
+	.uleb128 0x3
+	.long	0x37d
+	.byte	0
+	.uleb128 0x4
+	.long	0x419
+	.uleb128 0x9
+	.long	0x438
+	.uleb128 0x3
+	.long	0x37d
+	.byte	0
+	.uleb128 0x4
+	.long	0x42d
+	.uleb128 0x9
+	.long	0x452
+	.uleb128 0x3
+	.long	0x37d
+	.uleb128 0x3
+	.long	0x452
+	.uleb128 0x3
+	.long	0x64
+	.byte	0
+	.uleb128 0x4
+	.long	0x17f
+	.uleb128 0x4
+	.long	0x43d
+	.uleb128 0xa
+	.long	.LASF1405
+	.byte	0x88
+	.byte	0x5
+	.long	0x3d8
+	.long	0x477
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x88
+	.byte	0x20
+	.long	0x37d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1406
+	.byte	0x7f
+	.byte	0x5
+	.long	0x3d8
+	.long	0x492
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x7f
+	.byte	0x2b
+	.long	0x396
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1408
+	.byte	0x79
+	.long	0x4a8
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x79
+	.byte	0x23
+	.long	0x37d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1409
+	.byte	0x73
+	.long	0x4be
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x73
+	.byte	0x25
+	.long	0x37d
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1410
+	.byte	0x6e
+	.long	0x4ea
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x6e
+	.byte	0x1f
+	.long	0x7e
+	.uleb128 0x2
+	.long	.LASF1365
+	.byte	0x6e
+	.byte	0x38
+	.long	0x16e
+	.uleb128 0x2
+	.long	.LASF1366
+	.byte	0x6e
+	.byte	0x42
+	.long	0x64
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1411
+	.byte	0x69
+	.long	0x50b
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x69
+	.byte	0x22
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF1374
+	.byte	0x69
+	.byte	0x37
+	.long	0xe0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1395
+	.byte	0x64
+	.byte	0x5
+	.long	0x3d8
+	.long	0x526
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x64
+	.byte	0x35
+	.long	0x396
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1394
+	.byte	0x5f
+	.long	0x547
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x5f
+	.byte	0x26
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF1376
+	.byte	0x5f
+	.byte	0x39
+	.long	0xae
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1393
+	.byte	0x5a
+	.byte	0x9
+	.long	0x8c
+	.long	0x562
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x5a
+	.byte	0x22
+	.long	0x37d
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1412
+	.byte	0x55
+	.byte	0xa
+	.long	0xae
+	.long	0x57d
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x55
+	.byte	0x30
+	.long	0x396
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1413
+	.byte	0x50
+	.byte	0xa
+	.long	0xae
+	.long	0x598
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x50
+	.byte	0x33
+	.long	0x396
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1414
+	.byte	0x4b
+	.long	0x5b9
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x4b
+	.byte	0x32
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF1387
+	.byte	0x4b
+	.byte	0x5a
+	.long	0x1a5
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1415
+	.byte	0x3e
+	.long	0x5f0
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x3e
+	.byte	0x29
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF1416
+	.byte	0x3e
+	.byte	0x4b
+	.long	0x452
+	.uleb128 0x2
+	.long	.LASF1417
+	.byte	0x3e
+	.byte	0x57
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0xe
+	.string	"i"
+	.byte	0x43
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1418
+	.byte	0x2c
+	.long	0x627
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x2c
+	.byte	0x23
+	.long	0x37d
+	.uleb128 0x2
+	.long	.LASF1365
+	.byte	0x2c
+	.byte	0x3c
+	.long	0x16e
+	.uleb128 0x2
+	.long	.LASF1366
+	.byte	0x2c
+	.byte	0x46
+	.long	0x64
+	.uleb128 0x10
+	.uleb128 0xe
+	.string	"p"
+	.byte	0x31
+	.byte	0x1d
+	.long	0x16e
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1390
+	.byte	0x26
+	.long	0x647
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x26
+	.byte	0x20
+	.long	0x37d
+	.uleb128 0x11
+	.string	"ch"
+	.byte	0x26
+	.byte	0x32
+	.long	0x8c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1419
+	.byte	0x21
+	.byte	0xa
+	.long	0xae
+	.long	0x662
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x21
+	.byte	0x2a
+	.long	0x37d
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1421
+	.byte	0x4
+	.byte	0x19
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1407
+	.byte	0x19
+	.byte	0x20
+	.long	0x37d
+	.uleb128 0x11
+	.string	"str"
+	.byte	0x19
+	.byte	0x36
+	.long	0xba
+	.uleb128 0xe
+	.string	"ch"
+	.byte	0x1b
+	.byte	0xd
+	.long	0x8c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 5 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 6 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 7 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x7
+	.file 8 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 10 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 11 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xb
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 14 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 16 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 22 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.file 23 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 24 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x18
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1a
+	.byte	0x4
+	.file 27 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.file 28 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1c
+	.file 29 "./src/main/drivers/resource.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x4
+	.file 30 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 31 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x1f
+	.file 32 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 33 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1422
+	.long	.LASF1423
+	.long	.LASF1424
+	.long	.LASF1425
+	.long	.LASF1426
+	.long	.LASF1427
+	.long	.LASF1428
+	.long	.LASF1429
+	.long	.LASF1430
+	.long	.LASF1431
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x22
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1432
+	.byte	0x6
+	.long	.LASF1433
+	.byte	0x6
+	.long	.LASF1434
+	.byte	0x2
+	.long	.LASF1435
+	.byte	0x2
+	.long	.LASF1436
+	.byte	0x9
+	.long	.LASF1437
+	.byte	0xa
+	.long	.LASF1438
+	.byte	0xa
+	.long	.LASF1438
+	.byte	0x9
+	.long	.LASF1439
+	.byte	0x6
+	.long	.LASF1440
+	.byte	0x9
+	.long	.LASF1441
+	.byte	0x9
+	.long	.LASF1442
+	.byte	0x6
+	.long	.LASF1443
+	.byte	0x6
+	.long	.LASF1444
+	.byte	0x8
+	.long	.LASF1445
+	.byte	0x6
+	.long	.LASF1446
+	.byte	0x7
+	.long	.LASF1447
+	.byte	0x7
+	.long	.LASF1448
+	.byte	0x6
+	.long	.LASF1449
+	.byte	0x6
+	.long	.LASF1450
+	.byte	0x6
+	.long	.LASF1451
+	.byte	0x6
+	.long	.LASF1452
+	.byte	0x5
+	.long	.LASF1453
+	.byte	0x4
+	.long	.LASF1454
+	.byte	0x3
+	.long	.LASF1455
+	.byte	0xa
+	.long	.LASF1456
+	.byte	0x4
+	.long	.LASF1457
+	.byte	0x4
+	.long	.LASF1458
+	.byte	0x2
+	.long	.LASF1459
+	.byte	0x2
+	.long	.LASF1460
+	.byte	0x2
+	.long	.LASF1461
+	.byte	0x2
+	.long	.LASF1462
+	.byte	0x1
+	.long	.LASF1463
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1368:
+	.string	"serialReceiveCallbackPtr"
+.LASF1249:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1155:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1095:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1411:
+	.string	"serialSetMode"
+.LASF933:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1175:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1225:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1373:
+	.string	"identifier"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1334:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF711:
+	.string	"USE_GPS "
+.LASF1300:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF958:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF962:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1238:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1232:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1173:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF923:
+	.string	"IOCFG_IPD 0"
+.LASF1307:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF978:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1067:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1010:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1083:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF1046:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1136:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1407:
+	.string	"instance"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1026:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1152:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1205:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1169:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1322:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1030:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1283:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF948:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1377:
+	.string	"rxBufferSize"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1291:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1061:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1091:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1229:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF886:
+	.string	"USE_VCP"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1265:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF1224:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1120:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1149:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF972:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1000:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1058:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF1236:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF944:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1304:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1333:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1176:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1412:
+	.string	"serialTxBytesFree"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1062:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1195:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1207:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1150:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1079:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1119:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1064:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1168:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF987:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1139:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1146:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1420:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF1344:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1190:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1327:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF919:
+	.string	"IOCFG_OUT_PP 0"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF804:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1247:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF953:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF927:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1171:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1158:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1259:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1202:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1145:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1143:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF990:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF976:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF918:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1316:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1081:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1339:
+	.string	"signed char"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1346:
+	.string	"uint8_t"
+.LASF1405:
+	.string	"serialIsIdle"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1163:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1093:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1076:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1141:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1060:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1294:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1075:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1335:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1261:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF973:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1226:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF853:
+	.string	"USE_UART1 "
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF1204:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1130:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1129:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1092:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF908:
+	.string	"NOINLINE "
+.LASF1059:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1116:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1200:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF921:
+	.string	"IOCFG_AF_PP 0"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF1281:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1036:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1134:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1354:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1243:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1131:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1404:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF924:
+	.string	"IOCFG_IPU 0"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF841:
+	.string	"NULL"
+.LASF1056:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1001:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1228:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1391:
+	.string	"serialTotalRxWaiting"
+.LASF1363:
+	.string	"SERIAL_BIDIR_PP"
+.LASF979:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1380:
+	.string	"txBuffer"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1295:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1342:
+	.string	"__uint16_t"
+.LASF936:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1050:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1039:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1082:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1096:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF929:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1256:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF949:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1395:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1280:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1070:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1156:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF975:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1073:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1135:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF1421:
+	.string	"serialPrint"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1385:
+	.string	"rxCallback"
+.LASF961:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF758:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1297:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF928:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF965:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF917:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1181:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1028:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF993:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF822:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF1074:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1384:
+	.string	"txBufferTail"
+.LASF968:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1410:
+	.string	"serialWriteBufShim"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1025:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF821:
+	.string	"__size_t "
+.LASF1197:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF935:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1341:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1313:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF932:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1415:
+	.string	"serialWriteBufChunks"
+.LASF1360:
+	.string	"SERIAL_UNIDIR"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1216:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1109:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1099:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1020:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1364:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF1416:
+	.string	"chunks"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF1113:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1162:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1043:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1123:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1151:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1277:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1142:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF759:
+	.string	"USE_CMS "
+.LASF1351:
+	.string	"MODE_RXTX"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF974:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF952:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1292:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF977:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1379:
+	.string	"rxBuffer"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1127:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1078:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1051:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1397:
+	.string	"writeBuf"
+.LASF1006:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1329:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1125:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF940:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1024:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF971:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF959:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1383:
+	.string	"txBufferHead"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1027:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF982:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1211:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1413:
+	.string	"serialRxBytesWaiting"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF950:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1055:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF926:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1217:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1031:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1157:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1194:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF1102:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1114:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF1198:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1187:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF1382:
+	.string	"rxBufferTail"
+.LASF1144:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF931:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1343:
+	.string	"__uint32_t"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF1273:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1210:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF1137:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1153:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF957:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1128:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1331:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1392:
+	.string	"serialTotalTxFree"
+.LASF1069:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1015:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1124:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1369:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1053:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF970:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1289:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1112:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1389:
+	.string	"serialPortVTable"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF964:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1267:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1054:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1235:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1330:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1387:
+	.string	"rxFrameCallback"
+.LASF466:
+	.string	"__PMT"
+.LASF1011:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF1284:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1018:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1352:
+	.string	"portMode_t"
+.LASF1219:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1089:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1101:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1258:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1045:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1159:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1366:
+	.string	"count"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1193:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1097:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF1110:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1111:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1337:
+	.string	"unsigned int"
+.LASF915:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF969:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1401:
+	.string	"endWrite"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1285:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1160:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1084:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1220:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF942:
+	.string	"BIT(x) (1 << (x))"
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1183:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF967:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF992:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1393:
+	.string	"serialRead"
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1044:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1419:
+	.string	"serialGetBaudRate"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1174:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF996:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1057:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1253:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF997:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF980:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1147:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF1378:
+	.string	"txBufferSize"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1318:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1191:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1199:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF983:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1298:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1319:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1121:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1105:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF713:
+	.string	"USE_NAV "
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF851:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1345:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1276:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1040:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1021:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF1359:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1049:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1148:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"serialSetBaudRate"
+.LASF991:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1250:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1336:
+	.string	"short unsigned int"
+.LASF1104:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1233:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF1264:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1118:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1170:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF954:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1038:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1065:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1172:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1270:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF995:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF1278:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1362:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1052:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF916:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1019:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF999:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1066:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF945:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1047:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF947:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1023:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1376:
+	.string	"baudRate"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1347:
+	.string	"uint16_t"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1414:
+	.string	"serialSetReceiveFrameCallback"
+.LASF1338:
+	.string	"long unsigned int"
+.LASF1402:
+	.string	"writeBufChunks"
+.LASF1033:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1072:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1408:
+	.string	"serialEndWrite"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1087:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1237:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1246:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1003:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1301:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF985:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1032:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1192:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"rxCallbackData"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1418:
+	.string	"serialWriteBuf"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1223:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF856:
+	.string	"USE_UART4 "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF955:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1361:
+	.string	"SERIAL_BIDIR"
+.LASF1398:
+	.string	"isConnected"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1034:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1371:
+	.string	"serialPort_s"
+.LASF1403:
+	.string	"serialPort_t"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1417:
+	.string	"chunkCount"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1188:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF1390:
+	.string	"serialWrite"
+.LASF1328:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1004:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1177:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1288:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF1271:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1165:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1321:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1154:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF934:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1306:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF925:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1005:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF963:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF939:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1358:
+	.string	"SERIAL_PARITY_NO"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1132:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1088:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1234:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1014:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF820:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF1252:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF1279:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1244:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1048:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1140:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1108:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1409:
+	.string	"serialBeginWrite"
+.LASF1399:
+	.string	"isIdle"
+.LASF1208:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF885:
+	.string	"USE_ADC"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1355:
+	.string	"SERIAL_INVERTED"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1090:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1016:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1400:
+	.string	"beginWrite"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1182:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1185:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1340:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1374:
+	.string	"mode"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1214:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF1324:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1166:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1349:
+	.string	"MODE_RX"
+.LASF1106:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1068:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1167:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF984:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1180:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1303:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF960:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1189:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF920:
+	.string	"IOCFG_OUT_OD 0"
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF988:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1138:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1179:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1332:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF843:
+	.string	"__need_NULL"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF1353:
+	.string	"portOptions_t"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF941:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1370:
+	.string	"serialBufChunk_s"
+.LASF1367:
+	.string	"serialBufChunk_t"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF852:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1077:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1103:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF937:
+	.string	"EXPAND_I(x) x"
+.LASF1186:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF1164:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF946:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1085:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1251:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1126:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1286:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1325:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1133:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1381:
+	.string	"rxBufferHead"
+.LASF1350:
+	.string	"MODE_TX"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1348:
+	.string	"uint32_t"
+.LASF1013:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1196:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF956:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF1209:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF1161:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1042:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1022:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1080:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1396:
+	.string	"setMode"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1282:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1035:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1094:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF986:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1356:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1357:
+	.string	"SERIAL_STOPBITS_2"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF1122:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1268:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1017:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF757:
+	.string	"USE_LOG "
+.LASF1086:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1314:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF1071:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1063:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1375:
+	.string	"options"
+.LASF1029:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF951:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1107:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF1240:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1117:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF922:
+	.string	"IOCFG_AF_OD 0"
+.LASF1372:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1274:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF981:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1406:
+	.string	"serialIsConnected"
+.LASF1266:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1041:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1222:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1365:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1312:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1255:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1309:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF943:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF966:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF989:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1388:
+	.string	"rxIrqCount"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1213:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1439:
+	.string	"libc-header-start.h"
+.LASF1447:
+	.string	"stubs-64.h"
+.LASF1452:
+	.string	"platform.h"
+.LASF1430:
+	.string	"/usr/include"
+.LASF1451:
+	.string	"stdint-intn.h"
+.LASF1462:
+	.string	"utils.h"
+.LASF1425:
+	.string	"src/main/target"
+.LASF1450:
+	.string	"wchar.h"
+.LASF1440:
+	.string	"features.h"
+.LASF1443:
+	.string	"timesize.h"
+.LASF1459:
+	.string	"resource.h"
+.LASF1433:
+	.string	"stdint-uintn.h"
+.LASF1429:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1431:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF0:
+	.string	"./src/main/drivers/serial.c"
+.LASF1449:
+	.string	"time64.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1423:
+	.string	"src/main/drivers"
+.LASF1461:
+	.string	"io_def.h"
+.LASF1435:
+	.string	"serial.c"
+.LASF1427:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1460:
+	.string	"io_types.h"
+.LASF1448:
+	.string	"typesizes.h"
+.LASF1434:
+	.string	"serial.h"
+.LASF1446:
+	.string	"stubs.h"
+.LASF1428:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1455:
+	.string	"stddef.h"
+.LASF1441:
+	.string	"features-time64.h"
+.LASF1457:
+	.string	"common_post.h"
+.LASF1453:
+	.string	"common.h"
+.LASF1454:
+	.string	"target.h"
+.LASF1444:
+	.string	"cdefs.h"
+.LASF1458:
+	.string	"io.h"
+.LASF1463:
+	.string	"io_def_generated.h"
+.LASF1445:
+	.string	"long-double.h"
+.LASF1424:
+	.string	"src/main/target/SITL"
+.LASF1426:
+	.string	"src/main"
+.LASF1437:
+	.string	"stdbool.h"
+.LASF1442:
+	.string	"wordsize.h"
+.LASF1456:
+	.string	"sanity_check.h"
+.LASF1422:
+	.string	"src/main/common"
+.LASF1436:
+	.string	"stdc-predef.h"
+.LASF1438:
+	.string	"stdint.h"
+.LASF1432:
+	.string	"types.h"
+	.text
+	.section	.gnu.lto_.profile.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375 %)\001"
+	.string	"!"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\003"
+	.string	"\004"
+	.string	"\006"
+	.string	"\b"
+	.string	"\t"
+	.string	"\n"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\017"
+	.string	"\020"
+	.string	"\021"
+	.string	"\022"
+	.text
+	.section	.gnu.lto_.icf.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"=\007"
+	.string	"rL/5Pm\323\030\26054\2275"
+	.string	"\246\246\262p\226a\021\301\022k\233w\f=hq2\233\201\364\210\232\231\231\231\231\231\231Y\204\315m\366\337Mh\251\221-\267L{\007O\007\220\235\301H\204\221\021)\017\016\027=[\016\006\367\261\350\331{u\233\310G\345\301\215a\241\001\3231\357\033mDs\351\227\341\206&\264\fK\267P#\020\310\243\322+\257\344\016\022 \346\224\te8\252\302\342\3023\355\330C\212\001\005I\277\346l\230td\265u\365<Z%\233\246\261:\025\347\007\205\244 \256\247s\302\241\373\364\023\201\3536KK\313\n$DC"
+	.string	"u\371\376\216\307\365\207\277g\224\350\020\t\274\354\301\200\021"
+	.ascii	"0e\204\003\300\036\030\257\n\021@L\020$\230\t\002\224)\020\374"
+	.ascii	"-Ih\026\200\030\264\035*\315&\223\274\002\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\003\001\245\005"
+	.string	"\302\006\024\035\260%\351\f\3030\f\013\205I\222$y\224\265\326ZK\254\265\315\266F\032id\313\224\002\356\302\204\323\017\020e\251\r\301\002\312"
+	.ascii	"'\310*\261G\036\313Y\3530Y\206\256\312xP\032\351j\257\352\230"
+	.ascii	"\2649\240!\366\333\275\376\024\277j\324\322\340\213, \240\"1"
+	.ascii	"\253\0332\2001\275\322\341$4\203\341\026\340X\267\203It\221N"
+	.ascii	"\304\f\023H\035\001\030\250L\263<d3\b\022\334\r\214\244x\007"
+	.ascii	"\263\231\364<a\336\336\254\204E\203\235p\221`\316@\245C\022\006"
+	.ascii	"\2727\323\242\b4\334#m\003@G\207\r`4\227FL\2743].\030\004\271"
+	.ascii	"\250pC"
+	.text
+	.section	.gnu.lto_.inline.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`k\004e\013"
+	.string	"&P74Po\322\030H\216\364\210H\3614\200j\345f\250\311\340\330\317\363L\031\026\243\252X2M\374\r\324\230\212\252\252\252Bm3\277i\221HS\267&mo)e\n("
+	.string	"("
+	.string	"&"
+	.string	"o\234\300\317\354\375A\356\356\356\360<C\211b\222\330\300\374Bz<\240R\002\371\023$&\216\fZB\245:>\037\360+\b\b\312\3137\354\356\350\335\230\241\017\214 u\347#\250\003\013\207\251\372\220B\354FX\"]\013\215\026l\\\333\316\230\344c\026)r\372\270\300~\235\313\332\246\377\345@\352Pew\224\355\264-{\351\376O\"\276\256\211\nY\262\273\232\365\335i\020\257m\210Q\"\221l\356x2\016\247\2024\262b\r\220\240)\330\265\261T\223Y\333\320\203\371Av\267:\257\364\361r'\024\247\020L\0249 \200\"\2219\343\003\b`\006\304@\302\260t\227\3319\"\361\207{Cr%\233\026\017"
+	.string	"/\201\334\261\331\2168\316Y\214\320\273\363\020c\321\265\031e\240$\310\367\034P\305\235.\374\330[z\005? \241\f\027:\tv~c.1F\325\0065F\315\265\201X\0062X=\327\214#8\232\241\214\360\210xY$0\206Y\0368\357"
+	.string	"3#\001\354\257\243Zbo\255\007MG3n\333\002\027\364\334<\311:\246\207\0214V2\004S"
+	.ascii	"7"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`N\002\265\006"
+	.string	"\362\211\035$\2205I\007\377\377\377@www\306\314\314<C}z\177\247\032\240\331\177\374\377\337o\237\336\376\326\310&2\355\206\026+\022\313\307\001x"
+	.string	"\"r0\250\332\262\326Z\337\273\006G<=\023*\020T9??\200T\231\211D\244\200\245\007\220\252\225\275{\311\217\203h\347\251\372\232I\236I\270\362\362\\\325^\237\252Yy\215}\315f\326\243\203=\026\221\004\3771\206\235\202+ \320B2\363R\\G\262^\322[\016ka\177\304\244\226\374;\007\005Cg\365\202\024#D\362<\\\254\267\2708\224\037\222\224\340\274\005\215\374v\2307\302E"
+	.ascii	"\200\002\371I\006k4-\327<6\3267'\360prDX\027P\310B8-\366\257"
+	.ascii	"]\347\023\004Y\216k\200\026\275\002\017\001"
+	.text
+	.section	.gnu.lto_.pureconst.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375 >\361\001"
+	.string	":"
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\271\004\001\271\004\002\205\004\003\231\004\004\231\004\005"
+	.ascii	"\231\004\006\231\004\007\232\004\b\231\004\t\231\004\n\231\004"
+	.ascii	"\013\231\004\f\231\004\r\231\004\016\230\004\017\231\004\020"
+	.ascii	"\231\004\021\231\004\022\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`L\001\365\005"
+	.string	"2G\030!\200M\206\003X\022\212\2201P\024E)3\353\0078\202\206!p!\323#("
+	.string	" D\366\336[\312\024\377O\216bJ 6\007\203\2460\0212\003\214 pi\224[Z\300\314\343"
+	.string	"5\2524J'\237\264\273r&YG\312!\375\375VU\316\3613\347\214\362G\371\257\307J\227\345\267\220\264zq;\001, \340\202\241)z\254\030\273=\032\306\256\030\354b\"\222\366 !\034\r\234\242\026\263\016\262\330^\214\261r\354\344i\034\2732\004\370:0\027{\233Y,64\030\266qi\317\"\305d\270\301\214\031[\311\245<w\303X\t\333"
+	.ascii	"2\347\204\275\017_vm\211\303\277ru\255\f\001"
+	.text
+	.section	.gnu.lto_.lto.ce3487c4064d963c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_serialPrint.8.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\256\002\315\025"
+	.string	"\226h\216J\300\322Q:J\2110\307N\220\212\003\b\205\202\326\260\322\264\256\241f\372\300\001#p\244\323\007\001\331\263\\\303\305?>nKv\366\200u\025h\277Up\230B\245,\004x\0248\260\013\177\024\227\346^\270Xu\324\306f\t\221;\245y"
+	.string	"v"
+	.string	"w"
+	.ascii	"\020\354\302\021\243'\316\224\203\362\244K*vj\337\350+r\377\345"
+	.ascii	"\034@\255A\303\246Z\317\004>)O\372\374\200\325\311\362$\253\223"
+	.ascii	"\316\331S%<W\021\217pG\255\365\265#<\322\334\311qi\316\337b\317"
+	.ascii	"\247srd\361|J\210\370x#\013\025\321\351\301\323\036\337\216\216"
+	.ascii	"J\247\036\230zD?\337\007\177\340\304\214\236\357\347\224\325"
+	.ascii	"Rk5\355\371:\334\253\333~\261\035\301\2466\002o\035x\227\254"
+	.ascii	"\237?\371\363\336\0255%\251\037\302\312A\362T\253OU\217\nE:\231"
+	.ascii	"8\360\267\357\013\257d\233\306\235\205\217\364\244\002!\314\241"
+	.ascii	"\211\316H\335\3250\212\221\364C\247\250\340\016\274)i\360\302"
+	.ascii	"\376\321X\201F\352\316R\221\213(v\372#\334\1779\273\341\001\007"
+	.ascii	"\027\304\223\276\020g\233'\377\240\315\220\032\263\355\024\225"
+	.ascii	"\334\2017c\005b\220B\005\261\326\363\344\244\003?\377\340K\031"
+	.ascii	"E(\335Xk\255\243\b\375\266\326\346"
+	.string	"\332\024\301[\035\332\233(\224\265\356\254\370L\026j4\253\223\346\022\360\205\267\240)k\255+\376\022L\214?\224\263:\t\262\"4~W\272\004\242'}\002\210\030ux\267\264\366G7\321\321\242\313\375\236\347\207\216V\331\245\270HO<\337\332F\200\216\250J\213\366\271\243+d\237\205\004\025\321\033d\227\324&\213\032\344\277\007\025f\324Vs[\303b/\013\024\270\300`(\001h3\031Y\315M\246Vz\206\002#\253\331h\267\327\315F\313P\263\271\274dj\262\230\327\314v{\241\030\360\f\006\232\355U33c{\231\247\356\033T\005\245\333\035\271B\b\250\226\265\036)\271\273=\366\315\252\334\337\bJ\355P*\227{ \335r\251\220\347\207\357d#\373\220\217\263:I\227\302\350\371\3002\201}\227\265\324\207\006\024\273\340[D\036Q\273\0015 `\002\231\2722\017c&\030\016\254\346\216u\031\032\2555\270\214J\267"
+	.ascii	"h&z\343U9\264\2218c\260\263\230\032\004$\344H\023M\013 \371\300"
+	.ascii	"\235\354)\213\323\273\366R8\003\355CQ+o\326K,6\366\220Uh\377"
+	.ascii	"*\376\201\325\241\\?\256\026\bZ\314\006\013\201s\221-\213\257"
+	.ascii	"\220\007\n_\230\006f\243\230\233\260s\337\300\245Q|c \304\355"
+	.ascii	"6\313 \255(\362\247w.\374\004"
+	.text
+	.section	.gnu.lto_serialGetBaudRate.9.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\035\t"
+	.string	"\026\321?;@\345&\035"
+	.string	"|\256(h{\324\360J>\345\313\021\233=u\312\016@\241D\020\315\"m\236\bv\215.wW\322\222\216\341A:]\224\240Q\356W\317\374"
+	.string	"\007!4\032!{\247\024."
+	.string	"/"
+	.string	"."
+	.string	"!\250\216eCef\267\316\315\0214\307\256\033h\216I\220\207\217\241\177\224sV1'T\3511"
+	.string	"bw\035O\250\216[\3366\307v\204mV+\007/\273\034\255"
+	.string	"+\203\271\220\330&\331\232=\300\352b\264\257\372\t\351ut\202\335\024L\313ne\360Bv\3145\263\355\227\334\204\344\360\252\001rc\222\032\266/\276\n\263\335u\360S20\262\221c\376H&\210\250L\261e\315c#"
+	.string	"\273\226\242\374\260\177\255L\331\216\226\257\177\274\004\002\346:\211\207\206\017\307m\005\236\007\324\021\201\240/\263g\233\350|\324\003'H=\213\217~&\350\353PL\017\005\347\246\340P\205G\247(\024\242S\253{\313\f"
+	.ascii	"c\223\240\314\2000,)\016\343\314`\220\261\3005\361\215E\376\300"
+	.ascii	"\004\001'zT+\035a\222\001"
+	.text
+	.section	.gnu.lto_serialWrite.10.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\257"
+	.string	"-\013"
+	.string	"\266VP> Q\224\016\263\002\210'\r\022P\026\360\034\3630\313_He\315\323\200Q\003\316\033\3537\334\244K5`\344\355q \311\324"
+	.string	"\240\022\244\300\352y;\331\001\356\2650\233qL\266\021\267\2252\245="
+	.string	";"
+	.string	"?"
+	.string	"\250\317\005\354\232`\310\330\375(^\020\017\375}R\035\306\023\250\016\355\3317\016\210$1F-p\354\356\245$\356==\377 \007@*\201\236\036\021v\327I*\201\270\365\266\025\330\236`\377A\366\277\277:\352\207\232V\230\316H\372\321\nQ \265\373!\245cC\340\f\023\266o_\205g[\266\344\343\242y\0207p\340\375\333`\335\025aCB<\224\234.\317\247\360?\216\302{\"\005\271RU\312h\207\205\277\330\304]\017\030\337\005\207\315S\035\246\032\2603\234\205'\356.\306_\321\351b\211C\377S\035^\003\324@\2052\345\311\211\306f\016\373\003\245\216\260\037\331\335\265\232\002\025\260\264\345B\001\002\003\215\305R\031\220a\234L\247\343h\321X\345BF\343\262\356\352\270L\203\306i.\216\226\331\\\030\327]\025\004\3360d\334\325\3316\356\262\276}d\325dx\"$\244\035l\245*T\247:A\f"
+	.ascii	"c\223\240L\350\023\007\026\027\0340\024\330\246\322Y\\M\360\313"
+	.ascii	"e\230\030jv\270\303\213v\222\001"
+	.text
+	.section	.gnu.lto_serialWriteBuf.11.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\262\001\025\021"
+	.string	"\346\341wH\320\322(\035\032B\364\317\250\261\274\222\033\b P"
+	.string	"?(\200\263\032'\031\357GC\306\242E\252\n\254h\307\020\004\206C;\260\257x\261\374\320\303P\351a\237\226x\016\3050\b\200\273\370\206S\327\b\275\265\b${\313\235R`"
+	.string	"c"
+	.string	"`"
+	.string	"\377\361U\274\007\274O\314\007\354\352\024\031\355\206&.\361>\035^\325}z\027\351>\r\3327\016\320\244hl\300\361\330\335OM\200\240\202\237R#\350\037wS\315M\346\323\273\271<\335n\256R\004\347\005\022\310\315&\021 \245\020q\334\243\315\255\026#"
+	.string	"\225\335u\254\271\201\270\273\333^\261\r\301\216\017\236\017\272\345\214\2162\372\001\004\204P\341\330\365\260\244\264GS\006\317\207~\373\251\021\253\267\270\020*Ebe\237h\bF\245\306\241A.)\307nX\362\351\025\357\363\276\020h\243\354\324\207\225\306\343|\026\007\002\037\344\0312dm%:\030\355\256\211\035x\237$2E\263\212\361+B\030%\006\336'*\267z\f&\365\324QM\242Ae\354\372\t\311\371\001\244\272\343\267tQ#"
+	.string	"\331\260\305\234m\n\217\321\342\355\332R|\030\031b/\335g\324\021\333\302\213^\274\335M\361]\300f\336\211O?\246\373\274\026H\362\231\211KV\365\324\330\330\303\016kQw\354\033\300\361\241\303\252c?\350?=\374M\367\371\275\017=.\247\301.\304Z\223Ec\261H\243\254$(H\300\202\202rB\300\325\202\261h3\330\313s\353\244\002\353%s\315\276\231\314\205\341%c\371`/V\313\327\222\315\276\223\021\307\\\\\262\217\026\213\311>T8s\325\301}\301\216\243\031\255M\335\361\211\376"
+	.string	"EN4\351T\033\313xR\25166\210]\023\342k\334\251\314\273\334\022\217D\305\223\006\031"
+	.string	"c\223`\314\300=w\3508\370\321WFQ4A\274I\257\255\243\"i\353f\260w\245\263(Z\341M\313\031\226\215"
+	.ascii	"\0372\2401(\210\r\022Ac1\024nq-\357\024\262\251\3115.\005\005"
+	.text
+	.section	.gnu.lto_serialWriteBufChunks.12.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\266\001\025\021"
+	.string	"\266\241wH\320\322(\035\242A\245\203\251*\027\037\300\006\360X\n\374\t(g\016$\2216\036g\342^\232+\247\256R\216/(%\223\357\336&H\260\035\201\343B\347\310\247\302\321C\361\r\002\340.\276\253\006\202\251gsW\262\311\226)\005`"
+	.string	"a"
+	.string	"_"
+	.ascii	"\217\341\2778\214\360\264\231\013\330\315!\022\332\255\245\030"
+	.ascii	"e^\272\366\002\336\345<\211w\351\320>*\341p*\342\341\026dw\301"
+	.ascii	"\230\"\324\360\262\213\032\372\277\275d3\213]N\234w\246\031\316"
+	.ascii	"cGB\302\206Q\200\231\254;`\304\242\304o\327\233Y\215*\200\005"
+	.ascii	"\273k\265\231\211\270\275\333~`;\202\375\\j\355\324?\241\200"
+	.ascii	"\030\310\355\202\310\021\331\"\211\203\347>\277\375oG\3524\216"
+	.ascii	"\373>\036)\373?>\036\232\261\020\023\310v\203\264\273(\227\206"
+	.ascii	"0/\357"
+	.string	"\343B\373\263?\242T\324\337\374\031\267\205\357\361P7\2622\024<B\273\233b\007\363\362\244\373\202R\252\227Q\323P2\2622\233\211\006\363\362\263\245\256\001>\351\020c>\341F\324\264\370\361!F\035\377\305\323(\301\346C\246I\266]\036\3642we+\376\215\r.\031\357R\243\211\215\3415d\346\356\256\370@-\330Tq\351\317x\227\217\004z\320h4g\305\315t\254\016\261k1\215:\366\357\"\307\221\020\307\034\373\265\337\364\236\277t\332?\357sK\031\254\303\264b\\\fL0\227VL\005\225gTj\202\002\004-(\224\312\200\225\252\305\002\003k\261\246U*\026XX\257\025\f\204\275V\031X\257\026\260\305by\001U/\030\250bb\327\205\325\013\204q\271^\340W\333\307\234\333'\356D\021M\254\221Q\307\377yig\005MQ.\343\215)\304\350m\354\305\330\023\354$!u\237\226\242)\316h\215\001\031"
+	.string	"TD\030\233\264e\206\3663\334\215Cv\276\r\212\332\364\230x\226\336{\307F\322V\313"
+	.ascii	"\356JqE\264\254'.cXB\024\242\312\200\306\240 6\310<\206\032\030"
+	.ascii	"\356\334\316v\232BR\243UP"
+	.text
+	.section	.gnu.lto_serialSetReceiveFrameCallback.13.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`t"
+	.string	"]\n"
+	.string	"\266\023KD \311(\035\300 \021N.\037\240\206\200.\330\256Z\201i-\003\353\036`\251\t\210\020\315\326\256\315Zl\353'\334\267\320\276\007\006%%\t\300\002XMb\310\235F*\340,i5C<\300\022a\334v\357\224\0023"
+	.string	"8"
+	.string	"7"
+	.string	"\332\251\307Wd\247\332)\262S\213v\205\217\003\366/\231\227\005\027v\227\233\002.^\212\376\023\334!\245:]6\200\354\256eJ\025s\317\333\326\260=b\333B\366\307\177\336\365K\232\261\036\\D\330\205\211eX\030u`\300\3667{+\320\221c\311\"b]^\007D\264\323\r@\347\322>\353-\361.\323%vW\024\032\354\216\034\336\b{\315\316\225=-\030j\266xN;\345\nJ\332\356z\370/\226\225\007\t\273{\002\247\276);\315\2300\203\2221K\006\b \254\304`\217'9\003\330\327\354\356z\256\002&^G\002\002u!_\250\253\036\225\naN\247\344\243\343\303\341l&>O\324\221B\021\250\331\333\200:\260~!\027\326\017\005\254\037N\004v!\316\253!\267\301\360\350\344\253\034i4\252\3346\006\n"
+	.ascii	"c\223\240\314\320I\005^\\\200v\215\242\205\261A\341 \324@p\347"
+	.ascii	"\026\355|\002"
+	.text
+	.section	.gnu.lto_serialRxBytesWaiting.14.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"U\n"
+	.string	"\266\224J?@\305(\035"
+	.string	"\274~\335\363\335\377\275\257\232\312\343\365\301\226\b\271\363\200\217Y\371\325`\031\237\355U_\303\262\017ZY#\353`\263v\fe\354\207E\013\212j8\356\017\276\001\321\244mB\366N)7"
+	.string	"6"
+	.string	"8"
+	.string	"\266\237r\025\224SZ\205\271\250\f\306\341r`\267z\233#\320o\332\017\350\267I\362\324e\312?\3135\024\220\001-\227\3522\023\261\273\226-\327\307=o\233\301\266\204}M\266\245\351\353\257i\322rJ?C\005\024H\210\331\365\230%X\002[\200\023\333\267\215\262;\273\353\360Hi?\366\025\324\353\351\005\273/\003"
+	.string	"v\253\203\033\270o\256\234\003!\254\251\262Mq\230\321\213F\230A\277\311\271`_\274e\344vY\020\276\314\204\301\355\356M\276\371'\372\355SS\022[\311\231;\221\225\b\354\252\222s\304\276\266\273\353\371\n\356x&>\017\242N\207c\360\205H\240\322H\0029\2078\025 P\374Fo\024?\023(\212<\022\b\032y!q\3648\n\016->\321+\205\241\350uuo:7\253\271\341Nj\323r\322\371\t\013"
+	.ascii	"c\223\240\314\2000,\204\271\031d\007\366\006\245\006|.s\300\t"
+	.ascii	"#\325\212I\230d"
+	.text
+	.section	.gnu.lto_serialTxBytesFree.15.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\220"
+	.string	"\245\n"
+	.string	"\206\224KB \311(\035\300"
+	.string	"\003\036Y\230\007"
+	.string	">d\277\352\255\277+S\"\305,p\273\230\0021J\273~\315\364\277\231\306\017ZYG\030\3106\020\200\260\020\230\fAmPM\254\026\360\356T"
+	.string	"\026b7\331{\247\0247"
+	.string	"7"
+	.string	"8"
+	.string	"\366\007\234\200\311\247Y[X\024\006\240\004\301\204\335\312e\376@\237\315;\320g\222\345\247\307\223\377\327\247"
+	.string	"\224\330\212\205z\304h\354\256\343\212ur\313\333\256\260\275a?\"\246\257\377\234\321QF\037C!8\220\220\260k\022\253\260\r2\006\001l\337\276\001\223\275\331\013\02181\376\345\273^\300\364Z:\303n\353\301\202\335za\013\355\231\253f\007TvRT\022e\273\343\nB\tF>\021\372,J\n\033\344\007BmW\225\341\303H!\332\3133\277D\237]B\270\270R1\346Me#\005\273\242\242\\\261?W\266l\307\336p8:\030\240\315F\323\320}D\236Q(\3624\1774\036\036\017\354B.\004;\222\007\2028\221\347\tq\0370\3444\023\376>:\220\033}\037\310mu?W\266\250\314\244$\211\2678\245\243\f\r"
+	.ascii	"c\223\240L\350\r\003c~\301\201<\3006\225\316\232h\302pM\254P"
+	.ascii	"&\002\0343RM\233\204I\006"
+	.text
+	.section	.gnu.lto_serialRead.16.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"=\n"
+	.string	"f\024J> \345*\035"
+	.string	"\234G"
+	.string	"r\210#L\006\216\344X9\205\004\031\337#\024"
+	.string	""
+	.string	"@\204G\270\335\277\317\230Y\250\245-\030\310\020"
+	.string	"H\020\024\266\205nKV\212\t3w\262t\024\3627!{\247\0247"
+	.string	"6"
+	.string	"8"
+	.string	"\345\013\352;\357\004\365\235m?@\260\334z)\"\253\037'\0326"
+	.string	"\273\345GC\336\372l\371W9g\302Q\023\233\271>7\021\273\353\031\233m\334\364\266\027lK\330\367\002\273kJ\263=]_\3739nz\322\351oj"
+	.string	"\232\003\231]\331m\300\316t0%\266Yv\307\346\304\200\346\264\217\362\024\326k\253\013\354\322\\^v\313\0063x\357\034T\324\001\243.\333\246\333Do\027\026\362[0,T\365\335\244\t6y\026\225\267\273!\177%u\341\221\274\363W\365\335\251\301H\3555o\356x\354\024`\227\256IA\354s\033\376\200&D\016\245\317\3073"
+	.string	"\222N#\024y\n=\223<\024\243p\004\311\217\034\301T8\226\276S82}\244\221\374<\b\026+\300\361C\211\342\370u\312\275+Ux\321\fs&G=i\r\n"
+	.ascii	"c\223\240\314\2000\354\bs\t\330\273\322Y\323L\030\344\232-\335"
+	.ascii	"!\242\351\232O"
+	.text
+	.section	.gnu.lto_serialSetBaudRate.17.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"}\013"
+	.string	"VVQB m\225\016\260\030"
+	.string	",\004\005"
+	.string	"\264i\377\307-9:"
+	.string	"\256`*\026d\336\266\230\311_d\3618\354\321\007o\236\202\301|\304\013`3\231(E\333\247-$z/\330b\\]\363g7oK6\331;\245;"
+	.string	">"
+	.string	">"
+	.string	"\273\252\017 vG\017w\324S\217\317\320N\3531\264S\213v\211\217\023\366-\r\t\\&vw\233\022.^\212\376[\237\240R\246K\t\310\356Z\242R\013\356y\333\034\266C\354o\002\273\273\236*\373\254\237~\365g\231\264\234\322\227H\032\210\260\274v\025\304R,\214\206\250`\373\025\233r!#\307o\020\317\"\340\311.\204\023\234z\272\221Q,d.\355cx\006\361\253\322-\002tf\323r\272\362"
+	.string	"\3014\331\376\334\303Ww\017h\374\016\005\006\220\264S95\354\360\034Huw5\276k$\252\024N\375\222v\372YAbu\2221\313\027\203\021+Q\330\243I\316\b\366\263]\210\023\361\210\270\221jL\006\300\346\303\203\301\\.\272\016\210\013\205 \257\272s\t\300y`\027n!\330\215<\320\263\201<\356\263u\300p\273X\374\t\350\300-\364}\340V\031\367\331N\2259\016`\247i\300\024\031\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\n\216\361\251\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_isSerialTransmitBufferEmpty.18.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"=\n"
+	.string	"\366\223IA\020\3478\035"
+	.string	"W=\303)\002\340\031\200S)\b\277n\336\021\020\271\221\206\302@P>\264\363\360\017?|\330\024\303\253\034\007![\210"
+	.string	""
+	.string	"D\""
+	.string	"\347\007\363\230U2*J\303\030y\364\324\310\226)\0055"
+	.string	"5"
+	.string	"7"
+	.string	"\n\334\267\356\t\3347\333\226\230@9\365R\305\365\223"
+	.string	" \262\004\273\3457S\236\272\246\374\307\\s\031A\320z\251\256\232\212\335\265\266^!\367\274m\007\333\026\366\273\023f[\315=\366k\232Z\247\372\032\rI\201\315\201]\327l\301\022\330\006\264\330F\331\236m \342Q\265\377r\030\324c\247\037\354\302\f\b\330-!\374\320}s\371\334\374\224\260\246\3126\306e#"
+	.string	"\036b\007\367M'\203\275\361\031\262\333eQ\3702&\216\216\345\233\177\342\276}.\254\304V:\263g\262\252\300.U:Q\354k\273\273\016\356x.>\021\242N\207\203"
+	.string	"\206H\240\022I\n;\2078\031\240p\004\311\217\034AS8\212>R\b\032}\241\221\3748\033\213\032\340\370\225Dq\374\274ron6\254\346\207=\325\246u\006\013"
+	.ascii	"c\223\240\314\2000,\204\271\031d\007\366\256t\3264\023\006\271"
+	.ascii	"fKw\210h\272\346\023"
+	.text
+	.section	.gnu.lto_serialSetMode.19.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"m\013"
+	.string	"\026\326PD \2518\035\300 \215\234F\006\236\374\002>\f\257\277\001\020\323\226j$:\236`\221"
+	.string	"\355\375\237d\020\275\376\024\327\006\311\031\3558%[2 $\244\030\200\342\345\265\230H\244\251\237`\320\260)}\332d\357\224\002:"
+	.string	"="
+	.string	"="
+	.string	"\333R\260`\267\304\360\005\367\352\362\021\333+w\210\355\325\244-\341e\313\036\346\300$Vaw=\312r\362\223\364\017{\267b\245>1\032\273\353\271b\241\334\364\266-lo\330\367\004\273\246-\373\257\277\336\365k\332\364\244\323\307`\002<\240h\260{2\273\260\262\312\340\305\3663v7\343\314\362\005\310\277B\334\355\252L\370p\257\025ZG\201\363i\177\300\t\220w\241\356\260\001\324\223:\223RBS\266GO\020r\273$\035\037\201\310\307i{\235T\302\036o\340\304\355n\307\217\231@8\227W\037\265\275\2366Dp\251\346\314\363"
+	.string	""
+	.string	"\b;-\330ej\322\025\373\332n\237(\034i\336p8<\031\242\315F\363\360\205H\240\322H\0029\2074\035 P\374Fo\024?\023(\212<\022\b\032y!q\3644\023\016=>\321+\205\241\350e\312\275\266\264\345\217"
+	.string	"\231\212\216\230aV\252\005\017"
+	.string	"c\223\240L\350\016\007\006.\024\260w\245\263\032\233\340\3145\240\031\306"
+	.ascii	"\341;5\n\216\361\251\246\301I^\\\223\f"
+	.text
+	.section	.gnu.lto_serialWriteBufShim.20.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\216"
+	.string	"\215\n"
+	.string	"&TJA \2518\035\300\200\205\030Bz\303J\021\340"
+	.string	"w\301^\3626\002H^\207\233\001C\bPJp\314\254H\234\247\324!\007\f%\324"
+	.string	"\007\020P\214\020\200\301\221o\0268\373(\316\264q\373\251\221\275S\n4"
+	.string	":"
+	.string	"6"
+	.string	"\236\300n\371\374\303u\013\273\303u\313\245\035\341'\201=\310D\"B\355\256V\007\274<-\375\213\236\231\035\316\351\304bwM\315\016\200\273\336\266\204m\f\373\n\001\023\366d\221\n\330>\305\316L[MpP\371\220\033T\013+\022\300\034\355\256\305\027\330\255J\225\2256z~\2402\330\255l\301vj\337\300\017\224\377\030\302\031v=\bF\273\247%\316\224N 5\304\027\255j\255\264\332\033\017z\323\225\221\3121U\300\340\301R\t\366\311\241U\200\375jw\327\325c?\364W?\377\372\317O\257\t\311ADj\267$\025$\270\t;\213#9Me\314\226QA\241\301`.\r^\007r\344\b~\230\273\213\006\367\211\336\250\215\242\327\361\211\032\r\374\270\r\255\023G\355\002\341\220\303\02352\fE\215r\356\253\255\236\016"
+	.ascii	"c\223\240Lh\t\032\030\270P\3065\366\301f\347\204\030p\342\t\215"
+	.ascii	"\b\245\b\032\213\241p\203ky!L2"
+	.text
+	.section	.gnu.lto_serialBeginWrite.21.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\345\013"
+	.string	"\266\026SA"
+	.string	"Q5\035p\024@E\266\313\213\021\265S}4\365\272\021\230\201\243R\3643\360\370"
+	.string	"\375\227P\304P\"\350\037\022$\351\240N\340\f\360\377\032\202\371\003\361\213\230\313\177\335\207x\266\231,m\262eJ\001?"
+	.string	"="
+	.string	"@"
+	.string	"\323\240\235\343c\210\375\007\016\r :vW\223 \016\376\222\n\372g}b\022G\277<\\^\225\223\212V"
+	.string	"1\274\022\264T\037\316\272n\020K\252\022\007\273k5\211\035\356y\333\020l?\260\337 \376\265\273k\211\262\277\372\247T\253\252/\221\304\230a\240\306.\207\221\036+2]\214\260}\212=!\221\271\332/q\023\340W\242\013\330E\255`\261;*0\202\354\323\343\013`\237\331+\330\003-\244L\331\376`*#|\334\bu\207\355\356 \237l7\324\370)2|!\354S\245\305\266p\024\241lw5\376\t\020\206L\304\247/\302>/\t\330X\221t\304\032\362\202\306*\017{\034\251L9\306d$0X\320\301`.\0036\216g\003\372<\\f\316e\302\206\363\266O\373\274\355\002\347u4\017\267\241\240q\274O\273X\334U\330<\r\324u\236F\031\3672DH\262tMtJ\253\364\201P\216\f \004\206\266T\247\021"
+	.ascii	"c\223\240\314\2000\354\263\260u\033tc\2269\332\300\035:\367\030"
+	.ascii	"\213\301\336\225\316\252f\202\013\227\001\277\325\024q\227\247"
+	.ascii	"jr\212\246\366"
+	.text
+	.section	.gnu.lto_serialEndWrite.22.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\324"
+	.string	"\345\013"
+	.string	"\266\026SA"
+	.string	"Q5\035\200\243\245\001\245Z\233Q\377\341\350\rM\275n\004f\030L\212~\316<>@\377%\0241\224\b\372\207\004I:\250\0238\003\374\277\206`\376@\374\"\346\262\005:i2\302B\2266\3312\245?"
+	.string	"="
+	.string	"@"
+	.ascii	"\323\240M\343\243"
+	.string	"\210=\007\210\206\016\033\273\253\311\020\007\177I\005\375\263>1\211\243_\036.\257\312iE+\200\030^\tZ\252\017g]7\210%U\211\203\335\265\232\304\016\367\274m\b\266\037\330o\020\376\265\273k\211\262\277\372\247T\253\252/\221\204\3000\360b\227\303\310\215\375\230.H\330>\305\236\200\310\\\355\227\270\t\360+\321\005\354\242T\260\330\035\025\030A\366\351\361\005\260\317\354\025\354\001-\244L\331\376`*#p\314\b5\304v\367\216O\266\033j\374\024\031\276\020\366\251\322b[8\212P\266\273\032\377\004\bC6\342\323\027a\237\227\004d\254H:b\365\250\021cU\304\036G*S\016\306d$0X\320\301`.\0036\216g\003\372<\\f\316e\302\206\363\266O\373\274\355\002\347u4\017\267\241\240q\274O\273X\334U\330<\r\324u\236F\031\367\"\037$Y\272&:\245U\372@(G\006\340\001\242-\325)\021"
+	.ascii	"c\223\240\314\2000\354\263\260u\033tc\2269\332\300\035:\367\030"
+	.ascii	"\213\301\336\225\316\252f\202\013\227\001\277\325\024q\227\247"
+	.ascii	"jr\212\246\366"
+	.text
+	.section	.gnu.lto_serialIsConnected.23.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\245\f"
+	.string	"\266\327XD"
+	.string	"u\223\016\250\365\234bv\343?\177G\357Q\264\013\026]H1T\250\356\350\325\214\306\314d\346~d\f\373\020\331\302\030*\214\013\023=\252\032\214\266[W\265\327\nw\3165\357\241\274\004\003L\032\331[\312\224\002G"
+	.string	"@"
+	.string	"G"
+	.string	"n\340\200\344\322\277\026,W\321\n\001C\263\373e\312\342\245C\315\222\377\227\037\210\221\343\007\220\025\312th\342\nIZv\260\004\240NP\001\313\005\305_\236#P+\231\233\b\273\353\024\201*q\307\333\246`[\202\375\t\001\273\273\326\224}\325\037a:5\375M\005\031\232!\bt\354\262\264\216\254L\354\361\3026\311\346\330"
+	.string	"@\234d\332\237q\032\244\253R>`7\345\203\307\356\267\300\t\260G\177/p=b'\271\036m\007jr\200\325\211\231d\271\264\304\250CW\252\205\033BNY\3046\206\303\204p|\340<\\\217\251&\366\206\333\360\260\335\323\003\277\306\210\003\346\342\321O\271\036\257%AT*\331rI\f\211\032\"\233F\354\317\224\272\302>\f\366\234\\\200\300"
+	.string	"\305\343\351\020\320@\242\317\310\023m\230A\235\f\237\255\323\274\314\353\264\016[\207\222\211\266O(\003u^\32611\247A\353\262\021\307u\031\347\333\303\325\324K\227\312\250\201\241\242+\316U\212\031\310\311\250N\265\201S\021"
+	.string	"cCP\303\320\233\017\254\211\253r\314\211G\335\005Tx\304\r2a\201<\3006\225\316\322f\202\013\327"
+	.ascii	"\3051q^u\377\224BA\001"
+	.text
+	.section	.gnu.lto_serialIsIdle.24.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\366"
+	.string	"\355\f"
+	.string	"\246Y\\D\020\221\223\016pn(y\242\016 \002>\r\nk\314\0012\243]\013J\017\235\333Z\373\256\323d\375\315\330\006\243\033\021\030\263_\226\023\355\n\b\004XA\201\356S4E\224"
+	.string	"\f\322\275\036:\320oD\366\2262\245J"
+	.string	"C"
+	.string	"K"
+	.string	"\207\361$\327\241m+X02\351\335\b\230\313x\320P\203\263\333a*\342\244?M\222_\372\203&\03046X\250\016\327G\022\363\242\025"
+	.string	"uz\007Z3\037\276z\276\240\\2?Pv\327\271\001\305\341\206\267\355\300v\003\373\021\002vWJ\225\261\377vw\255)\333\351x\325\1779\255/\235\232>\b\204\033\034\035\005lvarz\354\r\234Q\302\366\310\026\261c\016\223L\373(\236btU\313\005\354\246\\\304\330\355\020\330@<tw\002Wy\251S\243>\bq\322\222\001\260Ndk&F\206Z\273R%\320\3408\345\016\333*\257\321\342\356\351\304g\221\301\002\313u\230Zbs_\301r\342\253\330.\304\335=\211C\277\345:\274\016\270\2412e\216\277z\b\313\004\215M\036\001\366\230L`\220 \305\343\351\214d \321g\205\023\205\242A\035\n\237\320\226q\030\267e\030B[\n&\n}T0\320\306a\235\022k\025\262\r[\321\264\r\023\351\366o5\345\217\032 Z\330\244O\272\276\372\210FU}\261\255j\024\223\272\274\220\017"
+	.ascii	"cC\220\304\320)}x\220\331+\251\026@\241\036&V\031;\300\336JM"
+	.ascii	"YK(\351\232MeL\210T\325Pt)("
+	.text
+	.section	.gnu.lto_serialWriteBuf.part.0.28.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`<\005}!"
+	.string	"\306<\322J\220\330Q:$\322@(\317\353\300\261\002\3536\326\247>\222\213/\370R\222\300Cd\237\364d\340\303\005W\366j\370\263j\375Qj\350b\036\335\023\024\331\033\217\254\321*\301\234\303Y\273\021\211\300\315p\303!c3\322\310&r'\031\267"
+	.string	"\301"
+	.string	"\271"
+	.string	"NC\333\020g\326_\361\233\334\352w'\274e\326\334 \017\027\306{\257\005\364\026\307d\342\263\tq]_\305\3047f\302\321\251\214n\210\027\3060U\342j=\221\257\344K~\2472:\200{\241\236\030\357%&\270\345\034\364\226\211'p\336\242\027p\3362\037\t3\0371{9\321\307\035\362\217\331\313\215\320\366\265\324D\314\275\367v\333=\270y\266\\.\2277\211\347\263\177\237\235\326\354\212\376\370/\236\306\302\t\351\263%`=kS2nk\246b\3344g\302\027Ah\234\204\246\003e\362x\343k\223S\260\266\200W\233\243\263\236{/\0378\343L;3\353`f\017\314\226'\225g3\225Ok\253l\246\225\273V\271\236\370\177\300\021$\271\367\305r\314}\262G!\317z\025\026\302\t\326\260\bJ}%o\220\230\303\314D,\364\341"
+	.ascii	"&\253* \267\333o\275\231\317\347\372\027\221W\202\"b\272t\265"
+	.ascii	"/8\264\276\213\350T\272sH\243\221\004\204\213\2109=\262w)\374"
+	.ascii	")\247r\300\310\221{ozt-\036\016R\315M\342\222d\213\0270\350]"
+	.ascii	"\213w\363@\213\003z4\357\214\232\033\204\362\225\234:\366Ne\324"
+	.ascii	"L\025\206X\311\254?\341"
+	.string	"\0339\212\257\332j\340\236\365\"\037\313f\003\307|\254(\276\236$&\nJ\262\344\275\304\234[\326p(\275\312/\0361\247\374\342\2179\345#\342\r\r\370d+2\0305\r\031\362\035\246\304.\225\203\2701v\277u\356\001\036\317\236\365\273,\225\341k)\332\300\227\342\373\316\333\263M\260&\032=0\037\227m'H\241\223\311B\247\331\037RE\026\254\312\337xZ\021d\030\260\2261\201\372\346n\263y\236\202\215\364\341X@\214\251\ba\342\274\355F\300\"~e\004zo\260\001?lE\216/\245;ok\333\374X\002\254K\376\327kVV\304\274\376\026J^c\267\337u\034\340\024\362\306\243a\270\304n-\343\276y\357\275\335Q\334w\340C\231\254\r\305\215\236\312\245\020n(\346W\3754\277\372gl\351\257\3165\232\312\264Ze\324\f%|*\212\027\r\365t>6W\224\3731y\007G\202G\301\317\316\216N"
+	.string	" \237\241\\\021o(\be\037\235\023\271\240\035\020\357\306\333\001\245\b\332\375\334\206\202rB7\237\035\357\246c\200u(\200v\267\"\235nwK\231\271\276\241\212\227"
+	.ascii	"&\f\330I\334\263\216\342Y\027J\3237\376V\264\266\266\335\304"
+	.ascii	"&:\3233J\233v\255\233r^\353\bU\202Ui\221\354\270\265\214k\265"
+	.ascii	"\226\261\355gA\340\241\314qv\0243\333\372Y;\267m\353Y\026%\""
+	.ascii	"i\377J\347\265N\373$\243\204#\251.\271\263L\021\273[\307\341"
+	.ascii	"\037\017\026V\240\316\372\315\264\346\364I\330H\027\316\005\303"
+	.ascii	"P\bZ\333\220!Y\304\267\230@\357\275\001q\250q0\307\224A\306L"
+	.ascii	"I$33M\213\001\200\002!\2629\017\020`\251\250i\016g\263\266\301"
+	.ascii	"\302\355\313\220\244\234j\220\027\274\205\322\020Dk8igZ\350\343"
+	.ascii	"\245t\325\r\016@\023::\307\023GQkk_?d[\006\310\310\303\21526"
+	.ascii	"\333\343^XZ\307g\364\351\030\243\235!\205\024\331\340r\211\276"
+	.ascii	"/\240{,\261\376\307\3059\307\343\327L\326\n\377\005\317\035\257"
+	.ascii	"\030BR\366\270,\022\324\033\350\225\007\0039\300\352\022\214"
+	.ascii	"7_\006\310i\332o;\203_\357\315%\007TP\024\351h\027\241E3\212"
+	.ascii	"\242\007\271\203|Yym\233a0\002Z<\".\275\211?Q\247y\251\037d\323"
+	.ascii	"\377\177\n(\360\t\352\277|C\245\325\313\212\253,\023\347}\027"
+	.ascii	"\333\202\350\262\023\324\360\244\343W\234\263\336\202kz\251\022"
+	.ascii	"\3261\025"
+	.text
+	.section	.gnu.lto_serialWriteBufChunks.part.0.29.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\234\002\335\024"
+	.string	"&)\213H\320\016)\035\203\034J\234\202\202\035\360\021\343\300\347\230\031.vG\004\202\346i\007\221\311#9\"\265ym\227\037\326\215\306\2652\253\274\310\364\215&\b\316\341J\235\343e3\034\312O\204@\276\375\244\243\210\315H#\233\310\235Rs"
+	.string	"w"
+	.string	"q"
+	.string	"R~\347\237\270\217\355?/\347\330\315Q:\332\335\205|\032D\374\364\356\002\302O\361\035\341\247}\023\266k6\323w;{c\233\315\344!\003 j&h\306\356\262>\025\204S\277\337\357wpw\253\264\035T9m\376{W\321\350`\016\202)\031\033\021\032:\034H\342\324\204t\243\313\032\335M\352j\304\205\313\216\317T\311\356Z\304p\207\267\235b\333\201-}\001\226\367\335\327\340 "
+	.string	"\265k\363\203Z\234\211\324s\337o\337\367\035\205o\344\3215\177\340F\030\255\373\336\363\213\306\245\226\375\242\024N\022an\304\036\257\246iwA>\335@\374\274\337\253\331\243\337\263\331\243k\273\325\335\214J-P\236\310\017\272\220\355CN\0027\026\367\241\347hw\031\210\237\037 \220\213\257\245\362< \027\217\215\305\3616,\250\375\347\305c\267\026nF^+\232RQ\355\027\004y\032'\300\311)\214m\330\223TR\312\262W\256B&\356\342\016\370H,\023\374\020\237\276K\370\031\252\202\030>\252\240N}\256D\214\374y\343f\021JU}\216D\214JM-\315D\335\344\3177\372+\bix\261\362\311z\035Z!\243\223\252c\235$;NM\326\034\373D\377J\365\335/\206\322)P:T\351y\336\017Ni\2352\260\263\304Zd&+\232J\254%\305\025z\244\365"
+	.string	"\201\001\224\221\021\221"
+	.string	"/W\354\204\205\026\203\211v\211D8\201\315^4\026m\366\242"
+	.string	"\233\241\260b\260\223\025\226kFc\211\f\260L\302k\306b\221\311f\254\321\266\274\346\370\275\213B\035\\\3344\006T\035O\236\t\362\221G\252\364Z\263\322\253I\013\234t\002ex\270\226\334\300\335]U\035\333*\275\357\0377\371\344\002\277\252\3649\016!\271\f\0322\f/ \200\002!\303\331\001\244\bg\245\315\\N\336\242\0012\227\241\330)bC\323\260\032\303\362\276\035\2345\200$\270P\0378\236'[\214\375 sBm%\f\313\254\342\251\215\230\005P\203\360\004S\t\371K\354\251X{\371\217\215\200\366\330D \002- \343v1\263\304\274\301\362\352\274\033\200\211"
+	.ascii	"\\&\371\346\305>u\256n\372\to\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\225\001e\b"
+	.string	"t\013\221\002"
+	.string	""
+	.string	""
+	.string	"\002\034\177,\257\377\372\006\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\224\202\202\200 \b\177-\360\372\2508\272\220\202\t\177.\200\200\200\200\004\n\177/\013\1770\362\375\231\027\035\1771\f\1772\371\356\335\273\001\r\1773\016\1774\017\1775\020\1776\021\1777\022\1778\023\1779\024\177:\025\177;\026\177<\027\177=\030\177>\004"
+	.string	"\265\013\004"
+	.string	"\225\006\004\001\221\205\327\307\003\001\365\006\004\003\265\001\003\004"
+	.string	"\242\006\004\004\303\376\236\020\001\325\001\003\005\004\342\001\003\006\005\202\006\004\006\211\364\264\203\001\001\325\001\004\b\225\001\004\t\n\013\f\r\003\016\004B\004\017\321\231\263\346\002\020\021\022"
+	.string	"' \340\242!\254\003\210X\271\252\330D\210\326p\023QNa_D-\304\307\250\244\253\255\032\025/W\2733\224~\207H\271p\364\370\r\337\340\033\277\341\033\277\3017\372\306\364\215}c\367\033\324\210\365o!<7d\304\350\317\206"
+	.ascii	":\361\351\216!3\007g\f"
+	.text
+	.section	.gnu.lto_.refs.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.ce3487c4064d963c,"e",@progbits
+	.string	"(\265/\375`\354\037\365\203"
+	.string	"\272\315X-O T\312I\007\277\376\357b?\203\353\037\213K2\355\352\373\357\377\314\374d\274W7\273\325#\"\263Y\275{M\256mf\3755O\330\267R\243\377Q\005Oa\340\340DM"
+	.string	"\274\276\002a\f\253\206\217\220x\365K2\216\347\330\266=\3314!R\246T\002\304\002\331\002x2F\0249\035\301dE'\037\025\245.7\202_\356\256\326\2533\247/\275\362\026\246c0\266c#\316\\\270\356kX\364\216\335\333\326\330,\325m\365\350\225\005\237\030\256\f\204=\273\030\336\260\213\341\031\21099b\036T\220X\334Y\356\346N\257\351\252W\326\302d2^L\314^9\313\367h\372\b\243\200o[\217\252li\351\365\274dcp"
+	.ascii	"onl`\233\220@,g\267\032\265!J\246\\1\266\313\353\345J\333\f\230"
+	.ascii	"<<gk\323,\"\r\242\327\003\261\255\021\267\200!\213J9\257\261"
+	.ascii	"\232\212U\265\306\324+\2535S\341*g5\236bt\266\254\266\336\313"
+	.ascii	"dna\303\334B\246\215\212)6\\\357\303\346`\337\272\300\232\025"
+	.ascii	"\237\274d\221\366\312f\277\004\025\334\213\361^\256{\257\212"
+	.ascii	"\"T\221%W\257\357\373\314\314\234\237\237Y\257?\2231\027CQ\237"
+	.ascii	"?\242\327\354\336\266\204\352FD\204T\257c\253\022\232\225\267"
+	.ascii	"^\177\002\013\306b\034vQ\030\231\236\224\354z=\r\326\030\343"
+	.ascii	"o\037\300\226[\301i\3307{\265\271\226O\fY\016`\310;\360p\026"
+	.ascii	"n\274`q\025\377\033x\212_\245\361\277\312\317)\326\320\220\004"
+	.ascii	"8\013\262\242\254\350\177\001f/\376\252\217\350\211"
+	.string	"\277*\364\377\356g\003\360\354\272v\370\217\345g\002\356v*8\374\347\373y\2000@\377\005\177>`\3604\277\372\303\"\313\206\237\3773\212'\267\2004\361\263\n>\341\303k~\325\205\237\217\244\375\217\3739\201\313\375\346W;0\376\352\n?\353\\\346WS\370\371\347\347\341\317\b\274\300\304\344I\374*\t?\243\375|\366s\331\317P~\026\373\271\353\347\255\237\237\374\254\365s\326\317C\374\214\365s\325\317K~\216\376,\365\263\222\237\241~F\3623\322\317C~>\372Y\310\317A~\006\362\263\321\317\310\237\241?\027\375L\364s\017?\003\361s\217\237\025\370\231\347\277\335\3171\376\217\371o\343\347\347\377\351\317B?\007\375\314\343g\347\317\315\237\231?/\177\276?\377\360\263\017\377k\374|\303\317@?+\177\356\371Y\307\317\016\374\274\300\3174\374<\303\317\f\374\347\340?\021\377M\024\026\026\026\3762\017\374*\341?"
+	.ascii	"\223bF\264t\226\216\353.\315\245\353\332\256\211h\267\246\353"
+	.ascii	"#zK\033\321E\364[\317\265\034\2035\034\207\235\273\372J\267\r"
+	.ascii	"\327j\334E\005\203\262Q\232?\246p\r\245\313h\350\226V\036VJ\214"
+	.ascii	"P`\275\f\017vx\337mV\314\300\362\356V&vT\226\364\312\326=\206"
+	.ascii	"^tQp\204\354W>\366\253\027\266\250\325\305\245\260\247\264\024"
+	.ascii	"\037|I\266\314\261_\335\330\257T\330\257a\354\327&\354\327\251"
+	.ascii	"\262\223\311H\227\204\351\315\335\030\t\267\350\220\364\372\325"
+	.ascii	"\211\375:\204\375\332\203\275*\310^\335c?\307'\206]\355\305\265"
+	.ascii	"\362`c\213\272\322\325\\\303-]\227\254\267\336"
+	.string	"\\TS\212H\322kc\365\223\302)Y\332z\355&=\004\2035\320N\336Y\255u\031f{\333\226\032<\023\353\225\004\237\030\266*\205=70T\013\013\271\201a\030{\365\252\245U[Ob[G\354\222*\242\030\246 Z\252w\325\362\016\213\254\327V\322S\0230\231\220M\265\024\020]a\250\264\306\242\"\251h\257-\304\333\270\t\221\0240zX\2248\305\365z\225G\020P7dN\256\244\r\325O\314 .g\275\266\316>$,P\\D\360\034\034\216\263\237\\\177\033i\246.\322K\215\324I\372H+uRG\033I\023i'\006\353\246\356\361\006\242}\034E{\257\363\336\373\t\270\360\313\357\217\t\351\316\220\244\200pEp\236\212\346\363\256bnH\322,\257/>\343\271$\022\327)v'\355\372\321C\204\232zSNc\266 \2728\257(|v\204\027~\033\322MA\222\0022\327\217\323\315f\312\b\202\316"
+	.ascii	"\321\364\232\352\355q\037\317%\265\027\b\261\231\206$\375\004"
+	.ascii	"Ml\205\337d\004A\257S\314\352\002\036yC\002\001\357m_\274@\361"
+	.ascii	"bh\305\244\345D\305\220#\243Q\230\257,B\336G\303\272\242+Az\355"
+	.ascii	" kW\212p\351\265\207\032\b\021H\025'Y\003i#+xOi\275B\333\241"
+	.ascii	"\025\"B|\241\261]\324D\305-+\321\251'lK\261\303wi\245g\013\331"
+	.ascii	"\36419\201\352\240\267\020\313\005P\260G\257\315\203\311Z\312"
+	.ascii	"\n\322\025\013\3128\371\345Q\351\365M\304\236\003\331\277\231"
+	.ascii	"\275,&\rVi\351\373^~1>\321M9\331\021\016JP'\035\002<\017\262"
+	.ascii	"\240\220\2670\250^9\220\3050\330\n\036\243.\303"
+	.string	".W\r\241\026\341\0309\366\274b\310\205\274b\310VX\022}aT&\316$\036|\3470\304)\333\031W\257\f\206H%\016.\357\3130\256HP\214\013\236\3168\333\233\231:>#fh\354Y\213=\033aY\344\341\321\360\361\215\205\335\235\003E\212\250\321\341\275\334F\213\2407\t\352\202f\032C%\242*]]R\221\200\251Kj\224]\336\273lo\021\243\265{\\\2007)\311E\017\301\244\327E=r5Z\003\025\270f\244W\225\251\250\257\356\252W\325HM\241\230\302\261^e\344\330\313\234\261\177\377\303\013D\246\275jM\343\220e\316.\376\032V\277^\325\203{\227X\346\302\f\341\232\220\302\234\305\375\3572\n-\361l\307\232\240Og\023\022?\307\232\214\236cM\313~fa\032Ao\323\222\275Q#\366\311\274w,z\215h\332\246{\333\246%\3332\241\367\3316EK<\235MF\374\034\273\320\353\274P"
+	.ascii	"\236\367\032\335\261\246/\374\274M\320\347X\324\250\304u6q{\342"
+	.ascii	"\255\0311UK\366\006\366t^\242\002\262\234Q\350\334\263\215\262"
+	.ascii	"\332\275K\263\240\013m\272w)\332B\315Y\265Tk\316\021\021\223"
+	.ascii	"\234\355\222\211\f5\235\2423m\363\316=\261\2429\202\356\355r"
+	.ascii	"\207(X\362R\3506\227|oP\013\275\267\031\205!)\312F\bAo\315u2"
+	.ascii	"\1774\235\242\306\240fT\350b!a\243\347\230S\024\247\n\331\230"
+	.ascii	"\3646\333%Ko\227&(;\266l\357\223\257\346o\n\027@\2665\336c\202"
+	.ascii	"I93S\241P\274\332<<\033$\257$`zu\033#\002\025\325\353\320I\025"
+	.ascii	"\344\251\327\031\350\\]\034s\2716\245\035Q\3307RZ\216<MI\025"
+	.ascii	"1\205D\256W\365\207:\304`oS\211\3321\2338\273\272.\275^&\312"
+	.ascii	"\356 \276m\330\366\265H\236\275\n\2653S\263&n-[-eY>\331\212A"
+	.ascii	"_aBBg.\264\030i\013\312c\2650\275\210\360\3407v\310\271$\345"
+	.ascii	"\344>\033\"lv\177M\302B(\037\314%\304\271\"\261\245\345\220\031"
+	.ascii	"B(VV\352\235\032\022\022\001\023+$t\212\262\253\352\025\232f"
+	.ascii	",d\312\211\031\323b\336\306sf\0360\t\234\336{\3074`O\251h>Ep"
+	.ascii	"\003\034lA\006\3531Mt\366\353\300\264{\357\213\027(\330\271\345"
+	.ascii	"\027UbY\346\350on\330$\355\312\317EM`]3\253/\314\226\020\250"
+	.ascii	"\251{3SeL\223\243^\373K\203y\363\365\3646\037\005\321{\231\315"
+	.ascii	"w#"
+	.string	"x/\363\206\271\005s\213\365\211\323\222(\303\3652\320\275g\261+\272\205\344E\217\030x\326\004\n\247f'\315c\3461q\023\202w\247\366'\345\251\3271>\032{R\244=S\232^\365W\221\230\222\251\030\2234\354H\267`\374\305\306I\342:\235\242\244uhEf]\346\203\256\210_\024\"~iM\205nh\332p]\205\005\325VJ,s\3621]\353\266 \315\036L\256'5\305\222\025\325V@\350\250\246c\374\245,G\236\235\021\214#|\240\003\231\243\006"
+	.string	"5jl\224\3709*s\230\261\003\205\025&R\204\320\203L\236p\035\233\030\021(\22395D\200\003h\306\211\353 \223\307\236\243\f\354)\260"
+	.string	"\002\013d\354 ^F\00612\2101\274\214\fpp2\260"
+	.string	"\207\275\0058\252\262\007\251\352\310\344(sv\326dN\016\235U\331\003\344C\303\206\344\b;\222\305\033\206\311#\022\007R\331s\334A\352X\2257L\250\371\351\361A*k\360!\306\300\036u@\326`\225l\322\270\223s\024\201\007\231cc\207\322\230T\236\200By\303\002\234b\2162\307\203\035I\233\244\362\204\343\r\310\243\316\n\032trb\340\341\311\241q\324\221\223\004aG\362\3469T\334\247\206c\022\206\322\307'\t\203Fy\343\207\206\036\240\0344l\216<1\344\330P\201\004\215\f=H%2g\205\035(\2308\036\223 \354\260\301\223\243\364\261\241\274!\203\270\223sD\241\250\274!\301\004\312\036$\020{T\346\240\260\003\2243Cy\254Q\"\007e\r:>H\036q\340"
+	.string	"\232\241D\352\370\351\311I\332\250\361\203L\241\274\221\364\251\241x\334\361!Ay\374!\342"
+	.string	"\232\201\003\273sT\352\034{z|h\374 ix||f\334\2209\362\354\214\360\203\034\366 e8\306PT\376\334P&}N0\036\207\002\034\030\304\330\301\301\211"
+	.string	"\200c\200\001\r\026)\224\020\002\253\023\001O\0162y\374\201\361\223<\336\200L\356\300\350A\346\350\200\241\223\374\201\021A\212\243\022\231\\a\247\347\310J\271\0325K;\372\353\225\315\202\206\306k5\356\036W\026\337)0w`X\366O=S\317\276\246{\\\200,7\205\2474\307\316"
+	.string	")+\013\264\271dT\313*\354L\024\024(l\206']\307\374\230~\265\354\214\327\327\227*\026'\235I\032\032\262\026vU\214\behPH\257*\330\365\214MB\177\204\275\252-\221\212\235\271S\273\324.\306{\233\016\233_lQ\216\260E\037^\316^\330\215\275&\264f\274@A\203z-B\361\036\357q\030\336@\354\253\270\027\227D\251\327b\031\377\361\037\017:=\231\332`\201M\345\365Z\334\242f\251ZjV/\351\250\2443\203C-q\210-\016\0161D/[J$\023\213\232\032\365\336\306\360"
+	.ascii	"Y\232$\253\253V*\026{\351\212\334t\231-\r]]\305\3426@\250W\257"
+	.ascii	"*\223\"\030\245\272++#\033"
+	.string	"\030\226\026\034\225\272\204\252\217\264\252\324%U}\304.\t\245:D\202IP\330\017\205`\215A\264S\235jg\013\221\270\315\274)\254\004/\213\252WcYT\224\252d&I\003\254\263\251\352'$g\246\nqU\311L\020uC?z\035\"\261\306-NwR\241\330{\257z/\223\226\264\306I\335W\231\372t\025\312\006:\244\215\322\253\232\304\210VV\270\245\373\234\214\361Q\327\353\207>\330\007\202\277\250\222\3510\310\022\231!5#2\"I\222\244\0032\013\020\204CQ\234\326\264\003\022\340\003A\221r\222\031\242\021\221\240\240(IA\251\322\001%\223n`k\003\273Ku\344l!\203\247\225\017V\036\037\265\251\324 \005=\005=\2669ry\237\244\366}\3109i\240\0076\322\270\022F\3073\274\0050\315\023\r\n\244\224J\276.\355\360\320]\001\310\251\376)D\033\0212\022\222\234\217;'\025\251r\355\235iH"
+	.ascii	"\362G\254\026.\b\231\233\005 \023\246\304\316`\027\207\211\205"
+	.ascii	"\013`\264b\222l\236~\b\262\026\331f\272\332\253\303\347\327\342"
+	.ascii	"@<\366D\351\376\250\310\371\222\374\2323s\376\335;\210A\001\301"
+	.ascii	"l\337\375\027C\321\20029\302\271\264\254u\263\1774B\354\221\246"
+	.ascii	"8 \355J\351:`p\003\306\340\200\245\365G5\364\t)z\245b\025oI\332"
+	.ascii	"\025\344\027]\223O\246.\264\203\360(\n\204\206\t\024\226\360"
+	.ascii	"\263\361\210\003\210{\201{<\325x\214\205\361\200\270\311\036"
+	.ascii	"\277\242\350\300\035ws\253HG\r\336\220!\2466\020J^\2602\303="
+	.ascii	"\354\272=\264\261\245\252\216_\361J\204]\206\320\2624b[7\253"
+	.ascii	"\257\r\272K)\320d\"\315\201\313\023\352'\224\234\251\234C\237"
+	.ascii	"\236\217\324f\201#\276\240\340\304\261\003\207W\210\372\"\022"
+	.ascii	"\032J\207\271\361\177\363q5>\224\027\\\243X\312\226\346\351\214"
+	.ascii	"Rs,\354/\344,\301\031\001BO{m\3448\2108\330\333*fU9\214\\h+\362"
+	.ascii	"hPoZ\335\321R\022j\230\364;\202\240}w\201\336r\347L\242*\035"
+	.ascii	"\020\376@\023\371A`\260\031\270\231uHk\234_i\313\036\201\336"
+	.ascii	"\f\001\032\266/\bZ7\024\211\026}\\\204\211f\\~\253\034\005\251"
+	.ascii	"\200\215Ie\312\026\370\350!\370!\341\200=\307ukIN\236\241z[5"
+	.ascii	"\225`C\245m\256<&\201\2414k\224\347\250)\227\031\2246\330\324"
+	.ascii	"\021[\276\024`\200\301\003c\314h?su\370\354\\\256\267\203\375"
+	.ascii	"\327p\024\207\352bd\362\356\r\264I\337\247\254:\373m\003#\020"
+	.ascii	"\217y\240\250\255\n\377H,\007\376E\326[\021\002\213!\006\240"
+	.ascii	"\373"
+	.string	"\351\355e\007\332\377\266H\271(\244\372\340\215\310\320H8Kv>I\367\363\247\252j\204?|Q<1\260\256B\262\323(\035;W\027\375N\017\030\235\263c\2303ib\362\275e<\003\213\363\206\023i+\214\006\262\311h\0021\314\006\243\313\206\026RE\374D%\t\007\350b\350\355\251Q\202\300\204b\3536\340'\r)G\022\201\224\031\325\300\226\2750\230}I\3211\007w\244<\250\221\351\256\033\031qd|\202\263&bP\205\032c\002\360\345d\360\353\370\235\222\355\221\370\b\352\301:X\365{\265\nZ]\025\004\" \270\204\333\340,\203:\273H\211fV\036q7\202\022\372\256jA%\350s\316\312\315\362y\3373<\325\034\023\211\230@7\027Nr\\\034@\305\371\215DR\205\304K\210\211(,|8\022^\206J3\333\001M\033`\234\350\272/'<\304\003J\366\n\3048\255\013\002Y\020,0\210\023\035"
+	.string	"0\351g\003\b\370C\277\376`\007x\300\321u\037\313\217\341\006\003L\b\273\220_\244\317\005,\214\257,\321|Z\200n\r\001\214\223Kf+\363\2146k\0365\3371\251]U\205\267._\264\240C\236D+_\243\306\207\211R3\323\343eCp\257\2715\025A\261\021q\276{,\261\365\277\266\326\324\274\022\351\222\355\302KuS\300\2054\322P\252NmhRv\\\245\334Q?/\262\262j\241\025\307i\345G\222\270LGX\n$\364U\022\270\0028r\272x\331ik\"\024UcA\244\301\365\t\344"
+	.ascii	"\007A#X\212\337\267\006{\302\215]@\251\267j\324)\2149\2626\373"
+	.ascii	"\346\025N\023G\254\242\251\207\247\203^#L\230{`Z\353,7\001\n"
+	.ascii	"\351j(\361\274V\334dBt\352\271\\\024I\377\263\235\200QFJ\320"
+	.ascii	"\3311\361L\352j\312+\212\213\315\307\366\221"
+	.ascii	"8\316\250:\264s\310b\006\3310\030\347\007\t'<\r\224y\364\350"
+	.ascii	"\347\236-\360\232&\031\353\227\366>@\350K\305)\247_\325vA\372"
+	.ascii	"\315\377Qf\257}\217GK{\366\237\032N\232Z9\35353e^\177\"\362\331"
+	.ascii	"~\233\332\306\200u\206\212^v1\311a\306\214\0037\036\273M\313"
+	.ascii	"\313\234\n\301\272{\2657\345\016nX;x7\352\234a\213\347v}}&\325"
+	.ascii	"\001\035\271\3027`m!i.\235\264m\023\312\317\220!\246r\233<c\363"
+	.ascii	"\262d85%;\244o\356v\236\344\215\320\271\252\034\247~\317+\224"
+	.ascii	"\353|S\271?S\255\016yt\300\207CN\370\227\334\273]mz\2705\034"
+	.ascii	"sb\333\366\215\361\027:\346\357\266^H\257A\217\333\215\t\260"
+	.ascii	"\357\371\023\302\356\343\302\316\017fC\233\001\3169\367\3613"
+	.ascii	"2\311h%\276\331Z\001"
+	.text
+	.section	.gnu.lto_.symtab.ce3487c4064d963c,"e",@progbits
+	.string	"serialPrint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"serialGetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"serialWriteBufChunks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"serialSetReceiveFrameCallback"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"serialWriteBufShim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\001"
+	.string	""
+	.string	"serialBeginWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"serialEndWrite"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\001"
+	.string	""
+	.string	"serialIsConnected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"serialIsIdle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce3487c4064d963c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
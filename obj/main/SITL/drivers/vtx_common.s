@@ -0,0 +1,8193 @@
+	.file	"vtx_common.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/vtx_common.h"
+	.file 6 "./src/main/drivers/vtx_common.c"
+	.file 7 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	vtx_common.c.b017e01e
+	.weak	vtx_common.c.b017e01e
+vtx_common.c.b017e01e:
+	.long	0x66c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0xe
+	.long	.LASF1146
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1058
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1059
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1060
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1061
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1062
+	.uleb128 0x5
+	.long	.LASF1064
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1063
+	.uleb128 0x5
+	.long	.LASF1065
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1066
+	.uleb128 0x5
+	.long	.LASF1067
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x10
+	.byte	0x8
+	.uleb128 0x4
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1068
+	.uleb128 0xb
+	.long	0x85
+	.uleb128 0x5
+	.long	.LASF1069
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x5
+	.long	.LASF1070
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x5
+	.long	.LASF1071
+	.byte	0x2
+	.byte	0x1b
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x4
+	.long	0x8c
+	.uleb128 0x5
+	.long	.LASF1072
+	.byte	0x3
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	0x91
+	.uleb128 0x5
+	.long	.LASF1073
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0xa9
+	.uleb128 0x11
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x5
+	.byte	0x37
+	.byte	0xe
+	.long	0x10a
+	.uleb128 0x9
+	.long	.LASF1074
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1075
+	.byte	0x1
+	.uleb128 0x9
+	.long	.LASF1076
+	.byte	0x3
+	.uleb128 0x9
+	.long	.LASF1077
+	.byte	0x4
+	.uleb128 0x9
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1079
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1080
+	.byte	0x5
+	.byte	0x3f
+	.byte	0x3
+	.long	0xd7
+	.uleb128 0xc
+	.long	.LASF1088
+	.byte	0x20
+	.byte	0x43
+	.long	0x16a
+	.uleb128 0x1
+	.long	.LASF1081
+	.byte	0x44
+	.byte	0xd
+	.long	0x91
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1082
+	.byte	0x45
+	.byte	0xd
+	.long	0x91
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1083
+	.byte	0x46
+	.byte	0xd
+	.long	0x91
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1084
+	.byte	0x47
+	.byte	0xc
+	.long	0x16a
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1085
+	.byte	0x48
+	.byte	0xc
+	.long	0x16a
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1086
+	.byte	0x49
+	.byte	0xc
+	.long	0x16a
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0x80
+	.uleb128 0x5
+	.long	.LASF1087
+	.byte	0x5
+	.byte	0x4a
+	.byte	0x3
+	.long	0x116
+	.uleb128 0xc
+	.long	.LASF1089
+	.byte	0x30
+	.byte	0x4c
+	.long	0x1f3
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x4d
+	.byte	0x9
+	.long	0x64
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0x4e
+	.byte	0x9
+	.long	0x64
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1092
+	.byte	0x4f
+	.byte	0x9
+	.long	0x64
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x50
+	.byte	0x9
+	.long	0x64
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1094
+	.byte	0x51
+	.byte	0x9
+	.long	0x64
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1095
+	.byte	0x52
+	.byte	0xa
+	.long	0x85
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1096
+	.byte	0x53
+	.byte	0x12
+	.long	0xb5
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1097
+	.byte	0x54
+	.byte	0x12
+	.long	0xb5
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1098
+	.byte	0x55
+	.byte	0xa
+	.long	0x85
+	.byte	0x28
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1099
+	.byte	0x5
+	.byte	0x56
+	.byte	0x3
+	.long	0x17b
+	.uleb128 0xc
+	.long	.LASF1100
+	.byte	0x30
+	.byte	0x58
+	.long	0x253
+	.uleb128 0x1
+	.long	.LASF1101
+	.byte	0x59
+	.byte	0x26
+	.long	0x2f9
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1102
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x16f
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1090
+	.byte	0x5d
+	.byte	0xd
+	.long	0x91
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1091
+	.byte	0x5e
+	.byte	0xd
+	.long	0x91
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1093
+	.byte	0x5f
+	.byte	0xd
+	.long	0x91
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1103
+	.byte	0x60
+	.byte	0xd
+	.long	0x91
+	.byte	0x2b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1104
+	.byte	0x60
+	.byte	0x67
+	.long	0x2ef
+	.uleb128 0x1
+	.long	.LASF1105
+	.byte	0x68
+	.byte	0xc
+	.long	0x324
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1106
+	.byte	0x69
+	.byte	0x14
+	.long	0x33d
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1107
+	.byte	0x6a
+	.byte	0xb
+	.long	0x358
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1108
+	.byte	0x6c
+	.byte	0xc
+	.long	0x372
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1109
+	.byte	0x6d
+	.byte	0xc
+	.long	0x387
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1110
+	.byte	0x6e
+	.byte	0xc
+	.long	0x387
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1111
+	.byte	0x70
+	.byte	0xb
+	.long	0x3a5
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1112
+	.byte	0x71
+	.byte	0xb
+	.long	0x3be
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1113
+	.byte	0x72
+	.byte	0xb
+	.long	0x3be
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1114
+	.byte	0x73
+	.byte	0xb
+	.long	0x3dc
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1115
+	.byte	0x75
+	.byte	0xb
+	.long	0x3fa
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1116
+	.byte	0x76
+	.byte	0xb
+	.long	0x418
+	.byte	0x58
+	.byte	0
+	.uleb128 0xb
+	.long	0x253
+	.uleb128 0x4
+	.long	0x2ef
+	.uleb128 0xb
+	.long	0x2f4
+	.uleb128 0x5
+	.long	.LASF1117
+	.byte	0x5
+	.byte	0x61
+	.byte	0x3
+	.long	0x1ff
+	.uleb128 0xb
+	.long	0x2fe
+	.uleb128 0xd
+	.long	0x31f
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0x3
+	.long	0xcb
+	.byte	0
+	.uleb128 0x4
+	.long	0x2fe
+	.uleb128 0x4
+	.long	0x30f
+	.uleb128 0x8
+	.long	0x10a
+	.long	0x338
+	.uleb128 0x3
+	.long	0x338
+	.byte	0
+	.uleb128 0x4
+	.long	0x30a
+	.uleb128 0x4
+	.long	0x329
+	.uleb128 0x8
+	.long	0x351
+	.long	0x351
+	.uleb128 0x3
+	.long	0x338
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1118
+	.uleb128 0x4
+	.long	0x342
+	.uleb128 0xd
+	.long	0x372
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0x3
+	.long	0x91
+	.uleb128 0x3
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x35d
+	.uleb128 0xd
+	.long	0x387
+	.uleb128 0x3
+	.long	0x31f
+	.uleb128 0x3
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	0x377
+	.uleb128 0x8
+	.long	0x351
+	.long	0x3a5
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0xc6
+	.byte	0
+	.uleb128 0x4
+	.long	0x38c
+	.uleb128 0x8
+	.long	0x351
+	.long	0x3be
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0xc6
+	.byte	0
+	.uleb128 0x4
+	.long	0x3aa
+	.uleb128 0x8
+	.long	0x351
+	.long	0x3d7
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0x3d7
+	.byte	0
+	.uleb128 0x4
+	.long	0x9d
+	.uleb128 0x4
+	.long	0x3c3
+	.uleb128 0x8
+	.long	0x351
+	.long	0x3fa
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0xc6
+	.uleb128 0x3
+	.long	0x3d7
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e1
+	.uleb128 0x8
+	.long	0x351
+	.long	0x413
+	.uleb128 0x3
+	.long	0x338
+	.uleb128 0x3
+	.long	0x413
+	.byte	0
+	.uleb128 0x4
+	.long	0x1f3
+	.uleb128 0x4
+	.long	0x3ff
+	.uleb128 0x12
+	.long	.LASF1121
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x15
+	.long	0x31f
+	.uleb128 0x13
+	.long	.LASF1147
+	.byte	0x7
+	.byte	0x2b
+	.byte	0xe
+	.long	0x7e
+	.long	0x449
+	.uleb128 0x3
+	.long	0x7e
+	.uleb128 0x3
+	.long	0x449
+	.uleb128 0x3
+	.long	0xba
+	.byte	0
+	.uleb128 0x4
+	.long	0x44e
+	.uleb128 0x14
+	.uleb128 0x7
+	.long	.LASF1122
+	.byte	0x9b
+	.byte	0x5
+	.long	0x351
+	.long	0x481
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x9b
+	.byte	0x26
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1120
+	.byte	0x9b
+	.byte	0x46
+	.long	0x413
+	.uleb128 0x15
+	.string	"ret"
+	.byte	0x6
+	.byte	0x9d
+	.byte	0x9
+	.long	0x351
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1123
+	.byte	0x93
+	.byte	0x5
+	.long	0x351
+	.long	0x4b2
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x93
+	.byte	0x2a
+	.long	0x338
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x93
+	.byte	0x3e
+	.long	0xc6
+	.uleb128 0x2
+	.long	.LASF1125
+	.byte	0x93
+	.byte	0x50
+	.long	0x3d7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1126
+	.byte	0x8a
+	.byte	0x5
+	.long	0x351
+	.long	0x4d8
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x8a
+	.byte	0x2f
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x8a
+	.byte	0x51
+	.long	0x4d8
+	.byte	0
+	.uleb128 0x4
+	.long	0x16f
+	.uleb128 0x7
+	.long	.LASF1128
+	.byte	0x82
+	.byte	0x5
+	.long	0x351
+	.long	0x503
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x82
+	.byte	0x2e
+	.long	0x338
+	.uleb128 0x2
+	.long	.LASF1129
+	.byte	0x82
+	.byte	0x43
+	.long	0x3d7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1130
+	.byte	0x7a
+	.byte	0x5
+	.long	0x351
+	.long	0x529
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x7a
+	.byte	0x26
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x7a
+	.byte	0x3a
+	.long	0xc6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1132
+	.byte	0x72
+	.byte	0x5
+	.long	0x351
+	.long	0x54f
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x72
+	.byte	0x29
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x72
+	.byte	0x3d
+	.long	0xc6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1133
+	.byte	0x6a
+	.byte	0x5
+	.long	0x351
+	.long	0x580
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x6a
+	.byte	0x2d
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0x6a
+	.byte	0x41
+	.long	0xc6
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0x6a
+	.byte	0x51
+	.long	0xc6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1137
+	.byte	0x63
+	.long	0x5a1
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x63
+	.byte	0x27
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x63
+	.byte	0x3a
+	.long	0x91
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1138
+	.byte	0x55
+	.long	0x5c2
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x55
+	.byte	0x2c
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1139
+	.byte	0x55
+	.byte	0x3f
+	.long	0x91
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1140
+	.byte	0x47
+	.long	0x5ee
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x47
+	.byte	0x2e
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1090
+	.byte	0x47
+	.byte	0x41
+	.long	0x91
+	.uleb128 0x2
+	.long	.LASF1091
+	.byte	0x47
+	.byte	0x4f
+	.long	0x91
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1141
+	.byte	0x3e
+	.byte	0x5
+	.long	0x351
+	.long	0x609
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x3e
+	.byte	0x29
+	.long	0x31f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1142
+	.byte	0x35
+	.byte	0xe
+	.long	0x10a
+	.long	0x624
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x35
+	.byte	0x32
+	.long	0x31f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1143
+	.byte	0x2e
+	.long	0x645
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x2e
+	.byte	0x24
+	.long	0x31f
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x2e
+	.byte	0x38
+	.long	0xcb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1148
+	.byte	0x6
+	.byte	0x29
+	.byte	0xe
+	.long	0x31f
+	.uleb128 0xa
+	.long	.LASF1145
+	.byte	0x24
+	.long	0x667
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x24
+	.byte	0x26
+	.long	0x31f
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1149
+	.byte	0x6
+	.byte	0x20
+	.byte	0x6
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.file 11 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 25 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 30 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 31 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1f
+	.file 32 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 33 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 34 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x22
+	.byte	0x4
+	.file 35 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 37 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.file 38 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF990
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1001
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1057
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1150
+	.long	.LASF1151
+	.long	.LASF1152
+	.long	.LASF1153
+	.long	.LASF1154
+	.long	.LASF1155
+	.long	.LASF1156
+	.long	.LASF1157
+	.long	.LASF1158
+	.long	.LASF1159
+	.long	.LASF1160
+	.long	.LASF1161
+	.long	.LASF1162
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x27
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1163
+	.byte	0x9
+	.long	.LASF1164
+	.byte	0x9
+	.long	.LASF1165
+	.byte	0xd
+	.long	.LASF1166
+	.byte	0x2
+	.long	.LASF1167
+	.byte	0x4
+	.long	.LASF1168
+	.byte	0x4
+	.long	.LASF1169
+	.byte	0xc
+	.long	.LASF1170
+	.byte	0xc
+	.long	.LASF1171
+	.byte	0xd
+	.long	.LASF1172
+	.byte	0xd
+	.long	.LASF1172
+	.byte	0xc
+	.long	.LASF1173
+	.byte	0x9
+	.long	.LASF1174
+	.byte	0xc
+	.long	.LASF1175
+	.byte	0xc
+	.long	.LASF1176
+	.byte	0x9
+	.long	.LASF1177
+	.byte	0x9
+	.long	.LASF1178
+	.byte	0xb
+	.long	.LASF1179
+	.byte	0x9
+	.long	.LASF1180
+	.byte	0xa
+	.long	.LASF1181
+	.byte	0xa
+	.long	.LASF1182
+	.byte	0x9
+	.long	.LASF1183
+	.byte	0x9
+	.long	.LASF1184
+	.byte	0x9
+	.long	.LASF1185
+	.byte	0x9
+	.long	.LASF1186
+	.byte	0xc
+	.long	.LASF1187
+	.byte	0x9
+	.long	.LASF1188
+	.byte	0x9
+	.long	.LASF1189
+	.byte	0x8
+	.long	.LASF1190
+	.byte	0x8
+	.long	.LASF1191
+	.byte	0xc
+	.long	.LASF1192
+	.byte	0x7
+	.long	.LASF1193
+	.byte	0x6
+	.long	.LASF1194
+	.byte	0x5
+	.long	.LASF1195
+	.byte	0x6
+	.long	.LASF1196
+	.byte	0x6
+	.long	.LASF1197
+	.byte	0x1
+	.long	.LASF1198
+	.byte	0x3
+	.long	.LASF1199
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1038:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1081:
+	.string	"bandCount"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1072:
+	.string	"size_t"
+.LASF1122:
+	.string	"vtxCommonGetOsdInfo"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF989:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1076:
+	.string	"VTXDEV_SMARTAUDIO"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF806:
+	.string	"USE_GPS "
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1086:
+	.string	"powerNames"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF734:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1023:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF759:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF1004:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF374:
+	.string	"__unix 1"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF733:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1056:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF735:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF765:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1020:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1029:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF1044:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF1097:
+	.string	"channelName"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1142:
+	.string	"vtxCommonGetDeviceType"
+.LASF1021:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1055:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF476:
+	.string	"__P(args) args"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF753:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF770:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1000:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1126:
+	.string	"vtxCommonGetDeviceCapability"
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF959:
+	.string	"USE_VCP"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF746:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF784:
+	.string	"_GCC_SIZE_T "
+.LASF1041:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF1120:
+	.string	"pOsdInfo"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF699:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF747:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF774:
+	.string	"_T_SIZE "
+.LASF1079:
+	.string	"VTXDEV_UNKNOWN"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1116:
+	.string	"getOsdInfo"
+.LASF708:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF731:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1137:
+	.string	"vtxCommonSetPitMode"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1134:
+	.string	"pBand"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF1149:
+	.string	"vtxCommonInit"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF725:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF737:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF758:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF772:
+	.string	"_SYS_SIZE_T_H "
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF722:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF729:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1146:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1066:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1043:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF750:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1006:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1077:
+	.string	"VTXDEV_TRAMP"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1115:
+	.string	"getPower"
+.LASF751:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF701:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF853:
+	.string	"USE_STATS "
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF760:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1019:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1131:
+	.string	"pOnOff"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1114:
+	.string	"getFrequency"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1010:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1062:
+	.string	"signed char"
+.LASF1001:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1069:
+	.string	"uint8_t"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF710:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF743:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1110:
+	.string	"setPitMode"
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1111:
+	.string	"getBandAndChannel"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1084:
+	.string	"bandNames"
+.LASF718:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1058:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF726:
+	.string	"isascii(c) __isascii (c)"
+.LASF706:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF926:
+	.string	"USE_UART1 "
+.LASF1074:
+	.string	"VTXDEV_UNSUPPORTED"
+.LASF1112:
+	.string	"getPowerIndex"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF981:
+	.string	"NOINLINE "
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1047:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF1093:
+	.string	"powerIndex"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1118:
+	.string	"_Bool"
+.LASF739:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF778:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF788:
+	.string	"NULL"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1085:
+	.string	"channelNames"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF703:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF767:
+	.string	"__need_size_t "
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1065:
+	.string	"__uint16_t"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1031:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF727:
+	.string	"toascii(c) __toascii (c)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1039:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF716:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF769:
+	.string	"__size_t__ "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF754:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF732:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1133:
+	.string	"vtxCommonGetBandAndChannel"
+.LASF1104:
+	.string	"vtxVTable_s"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF745:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1005:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF980:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1080:
+	.string	"vtxDevType_e"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1103:
+	.string	"pitMode"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF780:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF787:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF764:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1064:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF998:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1003:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF789:
+	.string	"NULL ((void *)0)"
+.LASF1017:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1106:
+	.string	"getDeviceType"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1027:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1139:
+	.string	"index"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF854:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1083:
+	.string	"powerCount"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1067:
+	.string	"__uint64_t"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF763:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF709:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF773:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF1091:
+	.string	"channel"
+.LASF717:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF999:
+	.string	"EXTENDED_FASTRAM "
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1144:
+	.string	"currentTimeUs"
+.LASF1119:
+	.string	"vtxDevice"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1089:
+	.string	"vtxDeviceOsdInfo_s"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1099:
+	.string	"vtxDeviceOsdInfo_t"
+.LASF768:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF698:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF738:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1105:
+	.string	"process"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF761:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1037:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF720:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF995:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF1011:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF702:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1090:
+	.string	"band"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1007:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1022:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1096:
+	.string	"bandName"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF776:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF749:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1045:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1050:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1016:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF775:
+	.string	"__SIZE_T "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1013:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF1095:
+	.string	"bandLetter"
+.LASF1052:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1140:
+	.string	"vtxCommonSetBandAndChannel"
+.LASF1092:
+	.string	"frequency"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF1125:
+	.string	"pPowerMw"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1135:
+	.string	"pChannel"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1034:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF707:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF713:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1060:
+	.string	"unsigned int"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1128:
+	.string	"vtxCommonGetFrequency"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF781:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1026:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1087:
+	.string	"vtxDeviceCapability_t"
+.LASF719:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1107:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1108:
+	.string	"setBandAndChannel"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1138:
+	.string	"vtxCommonSetPowerByIndex"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1117:
+	.string	"vtxDevice_t"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF783:
+	.string	"___int_size_t_h "
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1073:
+	.string	"timeUs_t"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF730:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF808:
+	.string	"USE_NAV "
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1068:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1049:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF771:
+	.string	"_SIZE_T "
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1048:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF1129:
+	.string	"pFrequency"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1015:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF714:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1002:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1059:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1078:
+	.string	"VTXDEV_FFPV"
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1032:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF1100:
+	.string	"vtxDevice_s"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF762:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF383:
+	.string	"SITL 1"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF779:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1070:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF756:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF993:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1136:
+	.string	"onoff"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1113:
+	.string	"getPitMode"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF700:
+	.string	"__BIG_ENDIAN 4321"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF1018:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1148:
+	.string	"vtxCommonDevice"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF786:
+	.string	"__size_t "
+.LASF748:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF782:
+	.string	"__DEFINED_size_t "
+.LASF1046:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1124:
+	.string	"pIndex"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF736:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF777:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF790:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1028:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF1024:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1042:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF740:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF766:
+	.string	"_STRING_H 1"
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF752:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1141:
+	.string	"vtxCommonDeviceIsReady"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1130:
+	.string	"vtxCommonGetPitMode"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1040:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1123:
+	.string	"vtxCommonGetPower"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1014:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF785:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF988:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF728:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF744:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1143:
+	.string	"vtxCommonProcess"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF715:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF958:
+	.string	"USE_ADC"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF1008:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF741:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1109:
+	.string	"setPowerByIndex"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF924:
+	.string	"USE_MAG "
+.LASF742:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1033:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1063:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1071:
+	.string	"uint64_t"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF712:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF996:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1145:
+	.string	"vtxCommonSetDevice"
+.LASF1025:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF990:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF997:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1088:
+	.string	"vtxDeviceCapability_s"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF724:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF991:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF994:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF396:
+	.string	"false 0"
+.LASF925:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1051:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1057:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF1147:
+	.string	"memcpy"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF757:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1098:
+	.string	"powerIndexLetter"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF927:
+	.string	"USE_UART2 "
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1012:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1036:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1102:
+	.string	"capability"
+.LASF1094:
+	.string	"powerMilliwatt"
+.LASF1053:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1127:
+	.string	"pDeviceCapability"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF705:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF697:
+	.string	"_CTYPE_H 1"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF755:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF711:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF1035:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1132:
+	.string	"vtxCommonGetPowerIndex"
+.LASF852:
+	.string	"USE_LOG "
+.LASF1082:
+	.string	"channelCount"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF1030:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1075:
+	.string	"VTXDEV_RTC6705"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1101:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1009:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF992:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF704:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1121:
+	.string	"commonVtxDevice"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF791:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF723:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1054:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1061:
+	.string	"long unsigned int"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF721:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1179:
+	.string	"long-double.h"
+.LASF1190:
+	.string	"__locale_t.h"
+.LASF1192:
+	.string	"platform.h"
+.LASF1153:
+	.string	"src/main/drivers"
+.LASF1173:
+	.string	"libc-header-start.h"
+.LASF1160:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1187:
+	.string	"endian.h"
+.LASF1151:
+	.string	"src/main/common"
+.LASF1185:
+	.string	"stdint-intn.h"
+.LASF1194:
+	.string	"target.h"
+.LASF1159:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1162:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1180:
+	.string	"stubs.h"
+.LASF1154:
+	.string	"src/main/target/SITL"
+.LASF1177:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1158:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1191:
+	.string	"strings.h"
+.LASF1175:
+	.string	"features-time64.h"
+.LASF1163:
+	.string	"types.h"
+.LASF1171:
+	.string	"stdbool.h"
+.LASF1161:
+	.string	"/usr/include"
+.LASF1150:
+	.string	"src/main/build"
+.LASF1195:
+	.string	"sanity_check.h"
+.LASF1174:
+	.string	"features.h"
+.LASF1193:
+	.string	"common.h"
+.LASF1182:
+	.string	"typesizes.h"
+.LASF1189:
+	.string	"locale_t.h"
+.LASF1152:
+	.string	"src/main/config"
+.LASF1183:
+	.string	"time64.h"
+.LASF1164:
+	.string	"stdint-uintn.h"
+.LASF1155:
+	.string	"src/main/target"
+.LASF1156:
+	.string	"src/main"
+.LASF1166:
+	.string	"time.h"
+.LASF1197:
+	.string	"debug.h"
+.LASF1168:
+	.string	"vtx_common.c"
+.LASF1184:
+	.string	"wchar.h"
+.LASF1167:
+	.string	"vtx_common.h"
+.LASF1157:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1169:
+	.string	"string.h"
+.LASF1178:
+	.string	"cdefs.h"
+.LASF0:
+	.string	"./src/main/drivers/vtx_common.c"
+.LASF1172:
+	.string	"stdint.h"
+.LASF1199:
+	.string	"build_config.h"
+.LASF1165:
+	.string	"stddef.h"
+.LASF1181:
+	.string	"stubs-64.h"
+.LASF1186:
+	.string	"ctype.h"
+.LASF1176:
+	.string	"wordsize.h"
+.LASF1196:
+	.string	"common_post.h"
+.LASF1198:
+	.string	"parameter_group.h"
+.LASF1188:
+	.string	"endianness.h"
+.LASF1170:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375 \036\361"
+	.string	""
+	.string	"\032"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	"\001"
+	.string	"\006"
+	.string	"\007"
+	.string	"\b"
+	.string	"\013"
+	.string	"\f"
+	.string	"\r"
+	.string	"\016"
+	.string	"\017"
+	.string	"\021"
+	.string	"\022"
+	.text
+	.section	.gnu.lto_.icf.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\025\007"
+	.string	"t\013\035\001"
+	.string	"\023"
+	.string	"\270\340\226\243\n\004\002"
+	.string	"\002\001\002\002\002\003\001\231\307\346\373\004\004\002\003\002\370\363\364\355\t"
+	.string	"\003\254\205\301\254\017\002\002\005\002\005\004\352\263\360\321\b\005\376\263\302/\006\321\364\215\262\001\006\002\003\007\374\210\346\255\017\007\002\003\b\310\372\232\234\n\b\002\003\t\262\235\230\371\n\004\002\t\002\001\n\361\257\324\241\002\002\013\201\227\225\354\f\334\300\251\277\f\n\002\003\r\355\227\236\210\r\013\002\003\016\243\235\246\211\013\017\246\333\330\320\003\f\002\r\002\003\020\211\226\361\366\006"
+	.string	"\021\276\304\307\200\006\f\002\016\002\003\022\364\234\367\340\b\026\017\002\003\002\020\002\021\022\002\021\002\023\022\002\021"
+	.string	"\021"
+	.ascii	" \323\3734F\220\004\251\b @\231E\302\220J\f\270\207}.\266\355"
+	.ascii	"\254\002\343\310\034\207\252)\230y\037\231\243\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\217"
+	.string	"e\004"
+	.ascii	"b\305\017\026\220\247\351\370\314\314\314\314\214\307#\270\370"
+	.ascii	"\350\233u\023\262DJ\231\002\377'\002j\r\004\254\271\002|\202"
+	.ascii	"8\324\\\027\300c\343\213\016W\303\322\213\335q\344\236\030\326"
+	.ascii	"\355/\247v\236\005\256\247\227\b\" \260\002\221\302\333\370\314"
+	.ascii	"p\005\273!T\024\203\367\334\030\024\241R|!\234I\366\251\325\302"
+	.ascii	"5(\331,\323\302\024\f\002\034g\023\204\350Cx\002\002\0349\214"
+	.ascii	"?\034\267l8\266{\232\274\205\311\034\"\232\005\313\253\225\237"
+	.ascii	"]\205\033\002"
+	.text
+	.section	.gnu.lto_.inline.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`v\006\275\020"
+	.string	"\266\224J>0m\224\306F \345\344\021Z\022w\243\340\3228\265\351w\231[\030x\312\330\253[\275=\376\214@"
+	.string	"\374\301\234\234\266a\272\024\227Q\255\214\360\244\352\006\215\361\033!16c\263\335\244\2242\005/"
+	.string	":"
+	.string	"<"
+	.string	"z\346\217\221`\226N#\021\326x'\244\177\346\355{\032H<O-_\323m\333\266\267\370k\022\363u"
+	.ascii	"\211\353\bJ\214\020]\206\313g\236 \b\020,h*\365\201\323\200#"
+	.ascii	"4<\032\\"
+	.string	"Ov\265|\320\235*\2747;;\267@v\247\321\006NY\313\227\210\013\036\246\202\217~\210P\034\256\237\304\223\251;\203m\333\270\317G-\003k\261\364'\240k\266Da\304\204\345\312\235\220^\026;\274\236}9sD'\"t\370\nx=\253\246\013 PT\003t\216\256y\022DV|`W\034\006\312\224qM\271\023B\216\t\001\253\203\222\007\251\362n6\331\332\036H\022\032\027#XF\212\r\220\352%X\220\013\021\025\001\316X\033\320\302\274~\222\324\0212\252\3168+q\320\263\260\213S\f\035\250\024\366\305b\342!\204\243D\266\025i\250!I\246L\215\205I\262l\006\300\002\231\021\"v\022`\345$\b\202\312\020c\214\022\225\n&\036\031\211D\024,-\034L\002@\332n\302\204\206\250\327\033\377\233)!\210\252\302\347\322Z\323\340\211&\215\256\351\233\330p\362A\037\204\247W\"%\200}B\367\3722jn"
+	.string	"\n\346\r\376\213\3659d\026`LW\274\rq\261\313\300\207?\375\311\365\2320\004Z\343,A\013y\224@\216\t\f3\032\3137\233:eQ\fKh\244\303\252\006\246w\357}Pj]\264\370HR\344\307\"\234\032\b\361\032 ^I7\210\005\3267\3572M\336\341\036\244h\265\363,\370\t%2\202\f\352\347>\3048M\\DY\361\367HV\204\344\007\300\234\302\017\244a"
+	.ascii	"\033b\337\2038\356\267\252\361\270\342\261h\033\354\034\177\375"
+	.ascii	"\344zn\372\251\326\220;\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\361\001}\006"
+	.string	"R\211\033!\2207\351\377\373\276\177\310\335\335\035`f\246!\365\374\330\340\025\330]l\366\366o\366o\237<\2612\355\3064\220\302\330\335\306X\354\321\372hq[ \013\3017@\\Y\n\327\207pe\325U\017\177\022\312\325\236\022k\007\326V\200\\\031\270^u\340\263\311s\231\001f\017\343U-\317\257O\227J\262\225\264mU\313a\035v\256\370\017k\214\215) \300B\2721\017<\360<\3014\006G,nEK\334\022c\274\026\210s;\3501\b\b\035\273F\346|"
+	.string	"\350\225\2416\206\307\240\3231\3104)\036\271\216\004\305\362\314\361V\301\246,> ,k\202\350\227iAw?3\370"
+	.ascii	"R\212a\373\004\0266\267/\363\261}r`\007\253\226\323\314\020"
+	.text
+	.section	.gnu.lto_.pureconst.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\231\004\001\231\004\002\200\004\003\230\004\005\204\004\006"
+	.ascii	"\231\004\007\231\004\b\231\004\t\231\004\n\231\004\013\231\004"
+	.ascii	"\f\231\004\r\231\004\016\231\004\017\231\004\020\230\004\021"
+	.ascii	"\231\004\022\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`A\001\245\006"
+	.string	"\002\b\035*pU\222\016\200\323\377_\307R\375\\\021\335\375\177\270\377\177\225\256*\336\306\344xn\337\336\237:7\254\353\330\266v}\374M\312\024_\326\345\371X\021vc\343\364\256m\362\216\3313\243\370\246\320\232f\034\230A"
+	.string	"\001&"
+	.ascii	"\360\027\\\351baT\213JQILE\334=p\220\3566\r\324Q\242I\341\t,"
+	.ascii	"\037\232\246\244<\322\333\3559\177\224C\332\033\337\267\0230"
+	.ascii	" \020\003\021\242\351\331\f\355{\0378\246m1&\231\305\356Z\031"
+	.ascii	"vW\032|{\247D#\330M\314\020\303\261\f09(\bw`\254\204]\200\211"
+	.ascii	"|\227\315\232\313f\354-\241\232]\271\3560.\325\006\006\203\254"
+	.ascii	"\024\204\253\201%\260\335x\313\034\006f\3322\017R\264B\036\250"
+	.ascii	"\r\266\r\001\016"
+	.text
+	.section	.gnu.lto_.lto.d0a388d00e85a09b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vtxCommonInit.17.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375 \306e\005"
+	.string	"\362I%.pU\323\001"
+	.string	"\240\214g\201N|\216\360\363>\376\030\377O\005\376\276m\374\273\310\201\337\001\275\023\002"
+	.string	"\022\020\327\330\026\221\260$\202\"\332[\246\246&\214^\027\245\030\020m\233Y\2556\253:&f5\256I\325lN\222\351\243\252S\243\264\316(\374JP\212H\211\023\217\003v\330Ey\261w\360\377\226\240\035!\314\301\363W\n\b\016@\370hlod\316\016@L\f\035\nG\340\377\224\231\3456r\336\335,\344}\335\306\302\342\277\243\367Y\326rm+lO\266\255\007"
+	.ascii	"3\003\366\231\241\300\367\317e\374\313\270\341r,\332I\006"
+	.text
+	.section	.gnu.lto_vtxCommonSetDevice.18.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\245\b"
+	.string	"\346\220>8@\217\322\001@\301j\233\303caO2\352\304X\335\377\323\340V3\2645\261}d\245\206\267p\301,\372.\221\256k\202\b\364\266v\246\237\201\270\315}#Z$\233\354\235R,"
+	.string	"."
+	.string	"-"
+	.string	"\237\231\013d\237\006m\026\002\212MI\005\311\313\356R\311q\360\021\364\037rM\265B=\002(\354\256\243juq\313\3336\260\315`\273\025\226,\373\255?b\232\313@\313\256\305+f]\023\305\303\3665\366&%\341\321\376\307A\300\267N\017\330e\231\234\354\206\007\246\231O\207\347d\001\341\036[\311\362\324p\245\344\204\243\364E>r\362;,a\212W}\372\246\354\263\263\202\221\212/s2T6\302\330!*\312\r\373\330\356n\256\037OE\370x\036\266N\345@_](\221>\315\334&\352B\241\216k(\221>:\362\352\007\362 \250\b\344\020\242\2347\242[\201\273\210\352QR\327yT\023\b"
+	.ascii	"\270\223\241\214i\3413,8\013\3412\312\267\032\035\356\360\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_vtxCommonDevice.19.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375 \376\375\006"
+	.string	"\202M14`m\322\001"
+	.string	"\255 1\017\356"
+	.string	"9\212\031\366\275R\356\222N\275a\b\323\032\352\335\354k\027bsh-\037A\220\320\260h\325#B\255\344\375\201h7)S\n\266\252\314\273\256g%4l8N\003/\034\f\\p\031\214\302\345,\250q\225\305\217\341\002\335\346=\350\250\270\327Q\252\005\244\017\366=\0361?\303\016\235|\366\346w\246\267T\001\f\tP\226LQl\232\330\361\223Za\237\262:\262\235N\245>*!\273\021\245\223%i \032\266=6\345o\234\303c\214 ^\210\016D H%\273\3219\2762\275\005|`zS\213cO\314\177\307\013H#Y\350\363\004@\330]g\026\022\335z\333\006\266+\333\023\001\b"
+	.ascii	"2\001\0038\003X\034\240k\270k\304\300B\344\341\256t\332I\006"
+	.text
+	.section	.gnu.lto_vtxCommonProcess.20.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`7\001\245\r"
+	.string	"v\331\\D\020\221\223\016p\273\241\025\356\016@Prm0\320\240\251\235\244\315A\270k\024^i0\261*+\376\326\357\214J\202\210g\222\254\345\006\240\\\372\020 \026 \030\031!\231\b)ib\301\303\263\013\201d\357-S\nH"
+	.string	"D"
+	.string	"K"
+	.string	"\325\245u\217\352\322!\233\006\001\322\006\306\206\0242\273{\301\020\017]F\250!\377.\347H\361D\227\037\0365\336Ha\364P\201A\005\360H\361"
+	.string	"\252\005\304]\256\034<\024U"
+	.string	"\013v\327\232\342y\270\253\333\206`;\202}.\nW\354\307\335]\303\222\375\357\257n\372cT+T\337\352 \301\231\331\3550sccd\213\021\266\257\2617%D\364\313 \323\300\272\334\260\210\\\355\233\370\211\320M&\027\260[\202a\261\373!\360e]\372;'\n\375A\202\"O\027O\3258\245\"\\\361\263J\341Y\354\n_\221\251\320\240\371\030\252K\205\006l_8\n\220\265;J\340\277t$\226\210\313\303\0022L':sE\265\250\234\240M\252\bG^f\2144e\316)\306\252\r\373\023\005\240\0073\3638\340>s\333H\260\016\317\020\220\251 \004d\2443`b\236n2(\341:\016c\235\217\226e\032&\241\204\353.\3206;\317F\341\372x&d\027\266\201\256\316\2075\013s\2738M\333.\315\267\217\013K\362E\314\tD\221\032\255`\204\016\031"
+	.ascii	"\270\223\341\214\351\310\033\006\242\025\315\300\033\304z\230"
+	.ascii	":pM\032F\001y(E\007\321\013mc\024\030Dj\342\024,+\327\200Z\030"
+	.ascii	"\006\024\202\313@\250\331\340\227\213\320\344U\232\253:\346\036"
+	.text
+	.section	.gnu.lto_vtxCommonGetDeviceType.21.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`:\001\005\016"
+	.string	"F\233`D"
+	.string	"\221(\035p\\\200\3163Tl'bK\232\t\226\237\325T\026\375\026\200k\261\344)qP"
+	.string	"Tu=U\030\366o\276\b\360\301\004\331z\353?D\343\037\304\3041H\313\353;\236\374\341\374"
+	.string	"\321do)S\nO"
+	.string	"E"
+	.string	"N"
+	.string	"7\361\023#\223\340\027\302[0c\203\n\032\273\237\006r\017\354\021\276"
+	.string	"\366\250 Nz\204\232$\277\364\25002+^\207C\223\306SI\205\034\017(\022\002\274\024\210\301\210\021\363\325\223\305S\311\344\030\331]\347\212\307\341\306n\033\202m\007\3665\004\376\352\017d^l\332\260\277R\252\213}\270\232\262\235\316\376\375\321i\205\351\324\364;\006\274|\270vO\257\033\353\"\262\030a{dk\354"
+	.string	"(N\246}\325Q\214\376\235\234\300nJF\314\356\207\300Z\366\350/\263\355\252\036A\321\224\250\311\250N\315\224\363\301\244%{\270P\256\025-\240\272\370\034\226\372\0226\205\303p/\031:\037\003\366\230z\300\266\205\247"
+	.string	"e\273\246\004>+t!\333\335\213x\274\032\230Q\241\344\353\332j\261J\352\023,*\tk\306\2245\002\336DB6\005\"!$\233\217\255\343\021m\fLB\242\016w6%\035\307u\235\b&!\221\006\372l\"\317g\202V\342\221\300i\235\017H\333\200\270\253\260}\264P\327}4\215m\177{\270\2322\200SK\276u\216\223\nf\372\325\033\234Z\364\257\2230U\026\333\001\027"
+	.ascii	"\301\016\307\264\336\226\233\255\370\260\266\022\023\240\206"
+	.ascii	"\343\320L\032p\001y(EGD\335\003VK\355\222\005;\\\023\267\265"
+	.ascii	"\320\277\231 \340\004\034m\220\b:\260j\f\034\253\022\346\036"
+	.text
+	.section	.gnu.lto_vtxCommonDeviceIsReady.22.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`.\001-\016"
+	.string	"\306[cE\360\222(\035\270\371d\257#+\037#\006\r\273?\300w+\006\272_\252\323\233OE\027\030\247\326\252\001\275\362\201v\377VIU\233\223\232\341\342a\340l\271\236\351\305\240\234vd\016\351x=\326 \210l\"eJ\001R"
+	.string	"H"
+	.string	"Q"
+	.string	"\332\243mC\210P\262\t\301\212\326\334\244blv]\235\256\270\3511\3234\371\247\307x\202y\351\220\001\236x\226%H\335\2700\2609\321p *5\023a\231\021\023"
+	.string	"\256d\016b/(\336z\252@\225L\220\222\335u\212"
+	.string	"K\334\332mc\260m\301>)\233=l\327)\265\305\276\206a\030ZW\266\323\333Y\177tZ\263tj\372!:\"\005;\020\356\222\b}\354\215H\323\302v\311\346l\356\007\205L\373.\376\242t\026\312\007\354\256l\314\354\272\036\270\333\036\355z\001\355q\273H\\Fu\352\246\027R\240\364\344"
+	.string	"2&\376\252\241\"\226i\213\377\321R\357bsx\314\007&\304\347\203\320\036S\033\330\366\360\030\241m\027%\301\207!\372\260\355\356Y<^\025\354`\245d\370\214\275\260\314\250Q\264\250&\257\032T\362\360[\007 \003\342\b\366HF\274\t$#&\034\003^\3073\362*\220D\243\020w8'\337\347\363u2\220D\243.\004\362F\036\320\206\356\304\243\341\323u@\241\216\263\300_\007\017\324\211\276\017\324q\256}\266\272r\352a\327r\250`4\3227io\235@\266\251\252\312\266\252KRT%\333\024"
+	.ascii	"\270\303PE\323^={I\033\265v\005\020\023abJ\302\335i\030\005\344"
+	.ascii	"\241\024\035\021u\017X1\265\033\027\354H\327\354Ie!\032\241\006"
+	.ascii	"\255\256fYs\017"
+	.text
+	.section	.gnu.lto_vtxCommonSetBandAndChannel.23.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\313\001\355\020"
+	.string	"\266\337qG\340\362$\035\022\024\202Q\r\322\370\271\356D!\211\240\025\002\324\222R\032\320mC\r\216\037\2730\257\312:\"\257Ok;\301Ha\027\203\304\276\004\004\303\304h\214\033\263b\301\005(7\236,\b\224\321\207\020\262\267\334)\005\\"
+	.string	"X"
+	.string	"^"
+	.ascii	"\356\266O\207\027\311>\267\023\310>\r\332:\036\362\354c64B<v"
+	.ascii	"\267S\022\007\237M\251\021\364A`/\3176\021\237\034\244L\200\223"
+	.ascii	"t\023\002\223"
+	.string	"\221\"J998\330LT\311\300\247\003\214\020X\214\344\212v\364<\366\370\0016\023\243\206\262\273\21650\020\267v\333\025lO\260\357\024rw\327\252c\037\350\337\036\376\332\177\376\251\321R\243UFG\031}.\233\241d\200h\327\346\311ikL\031(l\337~\020hs6\267\024\003\032!\001\351D\343]xA\003\360a\313\005l\214\r\017\021\266O\316\350\344\361-\374\025g\001\376\307\345\003vuh\304\330\r\025\004\272\343M\243\252\211\325_\264\374\210\251\350FLQ\177\324\364xs#\004\016\251;\326\364\212\212%\331\337\211ZFxl\r\037Z\331v\327\301\247/\344\332p\200gw\177\342\363:R\342\007&>9\016\251\320\234\024AMj\227l**\326$\023{\370\261\203\f\365,m\364a\207/Qw\354\007\030<\026+\305BJSa\245\240\244=\223\022\357\201I\t\212\244\200\227R\275<\b,\256\027"
+	.ascii	"\247HX\337j\365\245(\260\270^\335J\313{\251Z*\035K\225\262\352"
+	.ascii	"R\255\225\216\004\201\277\f^\253s}_\253\343\302=\n\214\306d\001"
+	.ascii	"\242T\325\251\266\352B|\r\312\214\276xS\251\232\246\252\2164"
+	.ascii	"?\356\203\204\3434\003$ \220\002\241!\355\270\313P\266X\303/"
+	.ascii	"\205\255.PC\366\202\264\353\270\253\277\302\237#L\3059\024\t"
+	.ascii	"b\0227\372\fh\352sc\200-n1\013\213\267\226\244 #D%\303x\334\004"
+	.ascii	"\301\270\3028\0366(\330\030p6\340HT{G8=\263\241\212\025\005"
+	.text
+	.section	.gnu.lto_vtxCommonSetPowerByIndex.24.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`*\001=\016"
+	.string	"\006\234dE"
+	.string	"\221(\035s\314\002&\376\263I\021\310e\273U)<\267\210\206\206\357\0215\336\372P\016Q\273\340\007\376G\021\352^\333\353HN.\f\333\252o\242J\006X\345\250\"\030\036a\271\266\311Q\f\210D\223\275\267L)Q"
+	.string	"L"
+	.string	"P"
+	.string	"\332\005d\237\376l\032\017Y\373\227\b\026\232\033\273\313E\017\377>e\324\317\377"
+	.string	"Q\237Z\207Ky\340\005\346\002\002\256\310\020\033\230\031\033\250\322(\025\310\\X\001\002\252\310M\205\215\022w]1\200*U\217\316\356Z[\300\rwv\333\020lG\260\177\022~\370go\3752\252U\252\257yh\260!`c7CL\307\276\230-F\330\276\375\024\237\275\331\233LI\324\273\234`\301\367\020\305q\367%\366@\373\334@\224\\\217\3027\361\023\337[)\017\260\273\202\261\330\r\021\230\323>\035>$\373\f\032S\227\030\034d\310\030\343,>z^0\333;\r\212\b\313\266\360\031\222\266\273\f>\375\227\351\244"
+	.string	"kw\037\342\363Q\344C+\2451kM\215\bCb\346&:%\223\321\363\272YQ\034\276\353\0375.`\254\346\260C\224\306\030\373rw\327q\345\247\316D\004\232\356HF\272\006$#\036\316\200\356\0032u\016N%\023"
+	.string	"\1778\"/\024\362>\022N%\023G\032u&\320\310\204\023\201&\204\270\317\210\304q\f\330\253\320\215\270\222\347\215\270-\334\313\215+wRQen\252QF\233BH\337\322QE\224\263\250\321\312\262#\025\023"
+	.ascii	"\270\223\241\214\351\300\333P\242Q\314\300\213\252|\t\213\005"
+	.ascii	"0\307\301x\026\214\337\305>P\3054nX\b\203r\0311\206\0328\356"
+	.ascii	"\334WM\215\212\2513"
+	.text
+	.section	.gnu.lto_vtxCommonSetPitMode.25.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`B\001\r\016"
+	.string	"\306\032`D\020\221\223\016s\233\300\212\327[$\002\177\317e\025\353\310\f\344\354\257|\237j\217\345!3\277\367\206\250\341\221\301\035-*\323~tOk\251PA@\256\005C\027\306G\026a\025\t\017.\207L\223F6\2212\245J"
+	.string	"H"
+	.string	"N"
+	.string	"\027\200=f\007\301\036\375\3318\036\216\330\257\\\234X\350\330\335ME\374{\2744?\3771\347\240\300\322c\313/\r4\245^ ./h"
+	.string	"\200,\327\001\032\030\017\217yn"
+	.string	"W27\rv\327\211\002;\334\330mK\260\035\301\376)kM\331\017\377\315U\177\324\264\306t^\351s6'f\020\250\261\313\241\206\307\316D\031&l_\263\265\026\022M;\201\202\357a\006\353n\210\026\204\354QC\221<\355\247\270\212\357\252\224\007\330M\301\210\261\033\"\360\226=:\f=>X \336\312!\323\272\364\305?\301R_\302\376\234u\322B\003\310\307\200=\246\032\260\335}\305\205l\327\264\300_\215D\031\211\307k\001\033*\225\254y\322\300\270\310\250S\260\250%\253\033\246l9Y\037hl\356\260\303R\352\213\375kw\003&&]\250\213\346FD8\006#\"%\235\001\234\347C\342\034\240\214H\034{:\241\016\004\352<\023PF\244M\344q\244\217Wa\013}(\2006\217'\332:!\356,p\3366\352:o\323\302\375\265\232z\200bFEW\342G\252Fu\252CX\264\344\215\252\376\024\030"
+	.ascii	"\270\223\341\214\351\316\033f\242U\320\340\2651iQ\204\0011u\340"
+	.ascii	"\2324\214\002\362P\212\016\242\027\350\306(0\230\324\204,\330"
+	.ascii	"\246\256\001aa4\020j\340\370\271\"\264s\2256\252\216\t\005"
+	.text
+	.section	.gnu.lto_vtxCommonGetBandAndChannel.26.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\213\001\025\020"
+	.string	"\366\236oG\340\264&\035X\353H\324\253\036\235\022\214xnt\210\243\021\270@\216\236\344Li\361\241\326\361w\017\325h\273:\241~[\030d\305\002'\365\325\022\255"
+	.string	"p&T\232\277\036\221\024\\TIT\300\211\220\204I#\233H\231R\\"
+	.string	"W"
+	.string	"Z"
+	.ascii	"\322\341\013l\227\334O\266K\333v\360\200\306\257\207-r\276\202"
+	.ascii	"\307M\320\321\234\241\267,\376\272\324V_>\354R\302\212\210Bn"
+	.ascii	"\310N\\\323"
+	.string	"Pn\226\364(8\202\025\225d1]\355D'\307,\200L\204\306`\346\203\342\342\025Gf\243Jb\231sZK\310L\334\333mg\260\255\301\276P0]\036\373;\216\343\350\335\261\255\356\016\364s\017\177\322\177~i\365J\265j\352\227$\314##(Fs\346\214J\346\017Y\004\3036\215]\262\273#@.0\fY\331\020\304\001\0013&\222\260\300]v>VT\355\3178\r\232\377\314|\300\234;=\210\346\f\033\330\343\0366\3324QnI+\327\272\335^H1ba6\031\222qq\207\212\231\266<\376\313\246\373\036;u\033/5B\250\374\017\333\245\356\002\333\340\205<ps\306 \370A\255\030n\316\371\027\227_\004C~jt\274\316|t\210\3263\233\334\026\221HL\221\370\342\273\241\030@\246&\261\303\035\276\325\352\304\201\002\f\347\262:M\200\221\376TR\276\b*)-&\003\037*\345\372*\310\264\\"
+	.string	"\2142\255@\225\nDm\220i\271\274\030\326\347J\261\\\274U\352\244\362P\254\030\317\224\300 \314\307\362Z \310\362J\341\2746w\307\272\307\361-\210\321\220\016\365_\333\305\023\320\272\335\305\261\275k\226\232\r\032"
+	.ascii	"\270\303\320E\323~={M\033Qw\005\024\023mb\352\3005i\030\005\344"
+	.ascii	"\241\024\035\021u\017X1\265\233\031\354\030\\\023\325&00\f\f"
+	.ascii	"\001sA\030\240\360$t\034#\224\253\325\325,k\356\001"
+	.text
+	.section	.gnu.lto_vtxCommonGetPowerIndex.27.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`]\0015\017"
+	.string	"v\035jF\340\262(\035*\031\310z4mY\3500\337\371\024V\025\340\203\003\324!\220\360$\340\322Ig\316\202\244\272\276J\267\245\257\f\334Cn8'\200a)\b\206;\203TEc\270\320\350\310Y\377@\264\332\267F6\2212\245X"
+	.string	"P"
+	.string	"V"
+	.string	"\217\241\213p\217\266\335\300\301\313\260\203%d>\302\007\206\305\317.\330)\211\303\0367M\230\037{\2141\0363\034/d \276m\005`\202\334$\370\211\361\220d.\251\233\310\f\214\032"
+	.string	"\331\313\266\240\206\023\342:\317\030YK&\310dw\235\036d\037n\356\266/\330\266`\237&\006c\2516\3665\f\303\320Zc;-:\370\203\236\363G\2475\246sK\177\024a\177v\030\240\261+\023\376\330\032\221\347\204\355\227M\262G\263\022\0059"
+	.string	"\241\020z\034\241(\311\264\237\342*^\317Yy\200\335\232\236\235]\220\201\273\320\243\301\017\340\002\033\222 \215\352T\221V\240y\321\230Ch3>\223!\242\266\251\215\237\302\245\376\306>\235\226\322\242\003\312\337\300=\246*\260\375}\205\206\320\256\313\003\177\306Z\205v\367&\036\257\007r\344\260d\370\254\341\314\354\250W\270\250'3\037\227\354\341\353|D\353\261\261\351\303\001.\017%5A\205\263G2\342A \0319)\021\360L\247\226'\301\305j\211l*\245>\024\3523ap\261Z\335J\345\265N*\224.u\312\200\352L\252UWB\340O\305Su\254\357Su$p\277\255\3268\365.\316\335\320A\213\221>\214\273\316\005l\"U\215\261\255j\023\026m\331\002\027"
+	.ascii	"\270\303\220E\323n={K\033\005w\005\022\023lb\352\3005i\030\005"
+	.ascii	"\344\241\024\035\021u\017X1\265[\030\354p\327\354\245\t\035\024"
+	.ascii	"\202\313&\241#\032\241\006\255\256fYs\017"
+	.text
+	.section	.gnu.lto_vtxCommonGetPitMode.28.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`]\0015\017"
+	.string	"v\035jG\360\260(\035\343\333\007\356\206\3133n1\366\236\222Wm\345\246\363\310B\303!\275\325\262\217\302\3040\034\372/\257\211\277\376B\331\203\230\3636M\202>\353\211\337q\205\235\241dP\346\301\272\347\372\276\267%\237l\"eJ\001X"
+	.string	"P"
+	.string	"U"
+	.ascii	"\227\336=\272K\333V\260`e\326E\020"
+	.string	"1\367p{1a\233S\374\366\303Y\227\334*\313o]\312\326\316LF\212\227\206s\034\201\227\035\033\003\266VN\350\345\322\345<fT\324:^.\034\202\332\315\206\313\2560\257\026U\317\310\234\323\232\341%sw\267\035\3016\004\3734\001\026[\2725\366w\034\307\321\013\263\255\376\\\374=\217\375\322\352\225j\345\324\007\225L[\215\017\027s\306\2147\346\013\231#\302\366\312\016\331 \016\"+^\270=\360.A2\"\252\366G\234\304\352\261\225\003\230\023\266\002gN1\201?\357\322\342\005t\001\223C=+\327\272\237-\241q\331\2269h:\237\265\350P\343\266\306G\351toc\223NC9\201\241\344[\350.u\017\330\016_\242\2027\247\213\201?K\241\2749\347C\\~?f\304Xt\274\326nfp\326+\235\\\223\031\r\227\336|\331A4\0330\246\3528''$&\222\224\316`\b\b\330 \004\304D4"
+	.string	"\034\221T\240\003\225\224\352\343\221\310\024\226J\341H\202JJ\365\241N\240\212t\242\360\231H\023J\337\350\204\372D\005\034\246\200\247/\025\206\247/$\316ssa\326=\212w1F\032\013\365Y\335e\017\300}v\027\306\366\256GX\266\205\013\027"
+	.ascii	"\270\303\220E\323n={K\033\005w\005\022\023lb\352\3005i\030\005"
+	.ascii	"\344\241\024\035\021u\017X1\265[\030\354p\327\354\245\t\035\024"
+	.ascii	"\202\313&\241#\032\241\006\255\256fYs\017"
+	.text
+	.section	.gnu.lto_vtxCommonGetFrequency.29.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`a\001m\017"
+	.string	"\006^lG\340\262(\035\"9"
+	.string	"\006x\266\250`(\3462h'\346\311\n\210EI\272b\320\256\001\365\273\367\3514~\377\n\002\377\332\251G-|a\264a\f8\006\016\3360\306$\241\341\202D\007\036\372'\245h\345\267d\023)S\nZ"
+	.string	"S"
+	.string	"W"
+	.string	"\004\270K\320C\270K\333~"
+	.string	"ae\326E\023\261\317\300\274\260\350\231S\364\266\304Y\227\333*\313o]J\027\016\315\206\216,\304\267\355\300\313\017\032\005=-\036\221\354\245\273\205\314\\\324"
+	.ascii	"\310\\\266\006\265\032\021\277\271\302d-\252\237\2229\247\025"
+	.ascii	"F\006\342\346n;\203m\f\366c\002bKw\306\376\216\3438ze"
+	.string	"l\253\273\213\377\3476\277\264z\245Z7\365C\027f\217\016\0062\346\214\215>\346\f\311\203\302\366\312\026\331\335\016\222\025W\f\004\230/\032\254\002\350\262\313A\242j?\305U\254n\303r\001s\312\304\330\231St`\017ti\361\001\333\004\321\317\312\265n\267\026b\\\266e\020\235\021\247\301 Q\333v\306?\341tOc\227\236s\202\363\301\344{\340.u\027\330\006\277\"\0054\347+\202OK\241@s\316\237\270\374\"\270a\343\322\361Z\253\231\355\254Y8\271&4\034/\345\341\337<\2443\2431\265\207\035+\244\323\327!\345\013)\240\204\374\215\210|\022FDLF\005>RI\365MPI\251:\223F'\320d\002I\032TR*\017\025~\252R\310\301;\2256\230<R\210\362F\t\f\242|\241\227\002\301\320\023\211\363\333\\\031\353\276\305\271\032\261\234\027\352\263\270\337|\300\326\355.\314\366\256K\\\333\022\026"
+	.ascii	"\270\303\220E\323n={K\033\005w\005\022\023lb\352\3005i\030\005"
+	.ascii	"\344\241\024\035\021u\017X1\265[\030\354p\327\354\245\t\035\024"
+	.ascii	"\236\204\216c\204r\265\272\232e\315="
+	.text
+	.section	.gnu.lto_vtxCommonGetDeviceCapability.30.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`&\001M\016"
+	.string	"\226[eG\360\222(\035\240\322=\202D\025\215\253\346\031O\300\024|\236\033(\264\235{\353zS\212\275\017\317\211l\201\352)m\021\322>\221\021{\025,[D:\267\250\272_\234\276Z\f.\323\324\304\266\364\337BL<!{\313\224\002P"
+	.string	"M"
+	.string	"S"
+	.string	"\3345\2177\260]\343^`\273f\333\016 \244\254\372\b\213\271L\211\0174<\273c'S\\\365)U\345\257>\345\016\016\212\0366.\021\227s\001\211\0267\003\\\254\211\200\007\215\027\227]a\\/\252"
+	.ascii	"Rv\327\332r\205\270"
+	.string	"\265\333\256`;d\177%\253D\354q\245R\306\376\334\335\265|\331\037\377\355\261\177Z\255R}\016\003\b\236 \frvcz\212\254\016\315\006\013\333){\304\376\314@\221#*\001\201e\315TX\340\256}d(\252\366g\036#\365X\313Iv_95v\307\006\356\002\266J\247\270\310\227\031`F\347\243%7\216\355r\2236\270\242o\371\301\t\017re\237\006\245\240e\233.\203\003\267\273\021\256\3713\261\003\310\307\356~\305\265\313\231\2435\302E{,\300\006\206\316c.\200\300\244[\266)E\263\037,\035\342\313~\341\306(d'\250\323\267\341\023\205J\241\t%\022{'&\236\204\023\023\021\350\2007\372D\217\002\313I\374x\004R\001I$p\224\201\345$v\246\320\023\277PC\247\362\205H\335(4u\240\022\203%/\354N \030v#\343~\256|y\333\001\253\301Q_\265\231\250\271\221\277jS\t\343\022"
+	.ascii	"B\r\tw\030\252\336\2641\354g\\\313\024\333\253F\017\375\260\234"
+	.ascii	"x\212\002\b6\r\241\026\3020\327l\234\t\035\024\226\204\032\207"
+	.ascii	"\252r\212.\265\007"
+	.text
+	.section	.gnu.lto_vtxCommonGetPower.31.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\214\001=\020"
+	.string	"6\337pG\340\322&\035#I\234\261\276{\032\372 rp\205B\203\3009\007\243\347\236\036"
+	.string	"\373co]\256g\253\303v\260\034;-\340i\3600P\302s\304\272\223\361x\234W^?R\342\324'\216\332\367\276\355\326\244\221M\244L)\\"
+	.string	"Y"
+	.string	"\\"
+	.string	"\227\016o`\273\344>\262]\332v\004\t3~=\354\3019\017\013\033!\2449\303nW\374u\251\255\276|\330\245\244\311QsD$+qMK`\223\344\303"
+	.string	"\tf\204\222\305t\265\021\035\0333\001\262\020\332\203\331\217\211\213\327\033Y\215j\351d\316i\035!#qo\267\235\301\266\212\375\241\272<\366w\034\307\321\273c[}z\320\317=\374K\007\372\245\325\273\251U\252\217J\311A\022\342\340hN\234\261\310\354!\215\\\330\236\261Q\266I\205\211\026\004\203`\300\214\211=)'L6\374\220\204\302]\232rLT\355\303x\214\231\003\311\234\300\234;:\212\346\f!\270\343\0025\332\f\240\334\226V\256uO\213\001\205\210\205\031"
+	.string	"\021\217\2138R\314\264\345\361W\233\356}\354\r\247\261\232\001\202\203\357a\273\324m`\233\365\241\217\23336\301\027ju\340\346\234oq\371U"
+	.string	"\004\210F\307\353\354G\247h-\263\311]\021\203\304t\210/\376D\264\303\307T\"v\b\0130\027@\017\346Cq\341b<\226\026\013.\233\275\022\022\217B\t\311J\352\200\247Z\271\274\n1-\227\311\252T\313\307b}*\225\230\226\253{\001=\327\nd\351ZV\032X\235\n|\351R\013\374\271x`\327\372>\260C\205\363\332\334\035\353\276\306\267\037/d\334P\377\265]|\001\355\264\2737\266w}B\263\001\032"
+	.ascii	"\270\303\320E\323~={M\033Qw\005\024\023mb\352\3005i\030\005\344"
+	.ascii	"\241\024\035\021u\017X1\265\233\031\354\030\\\023\325& P\030"
+	.ascii	"\f\003\301\201j\340\312$t\030#\224\253\325\325,k\356\001"
+	.text
+	.section	.gnu.lto_vtxCommonGetOsdInfo.32.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\251\003\275\027"
+	.string	"6\351\227L\220TR:l\207\211\001\t\265\030\342=\361\002\025\235X6\374\343Os;\303\036\365\366\362\252\317\200\275w)\370\335\354&&n\337\212\262^\325\233\3148\217"
+	.string	"\307\257J\b\216\031\342\245\307\274\211\004c\375Ua\242*\030\373\023B\366N2~"
+	.string	"~"
+	.string	"\202"
+	.string	">l\326v\277\3522\212n5\364"
+	.string	"9Gim\345\274\302\264\212\217\366z\001\351Q\374\225\364hw7\215\203\242\016~E*\375Hu4\343H\316\253zO<xLKO\033\354\323l\224?aHa\025\215\302\343\004&\230\234N{\213%\247\263%\347\214b<\262\251\211\321\310\236\347\312\323\r0\024\343\321\331"
+	.string	"l\n\304\225\267HF\242\2654\233\234s\333\242\221\351]\362\356\006\352\356\234\356\233\0258\305\321\337Z\230\325\320\236\335\202M=q\235\037J\317\273\243,B\264e\315\342%\366`\372\344\357\022\331\212\2415\353\024\257/2#\331\232u\257B{\217\335?\363\215\352Vy\362\215\277\376\351\255\376\023\265mO\333g!\020EB\304\261\352\022Y\263\322\031\222\f\004\355R\361\344\337]\324W\266\t\036\263=\031l\021\256Y\211\006E\263\352\345h\3370\016\263\335U\250@J&*\223*\340\24380\277\245\335\031\376u\253\271\320p\035\013\246p\216\243\206d\221\363.\004%t\276u\240y\262\034\361\362n\334\265:\007\3169\327\364\263z9\226\246Pz\324"
+	.string	"rlh\317\376a\031\202y\207X^D\332=^\035_y"
+	.string	"\313'&\2766'6\275\347m{\361\205"
+	.ascii	"\345\341\n\373did\276L\214\253,\275\307~Oj\357\245\272u\267\321"
+	.ascii	"S\203h\327\347\220\036\265\327\245\273y\307\002\3029\023k\372"
+	.ascii	"4\200\276\rc\177\271\336\345m\360\221\300\343\273\371\301\235"
+	.ascii	"\233\221\311=\230\221\331\211\031\220\303\351\200\271\bA?`I\343"
+	.ascii	"b|x\273\035\017\227\023\364\003\252\276^\016\250\353\361\250"
+	.ascii	">:\235\235\212\353\371\324\230\226\346\375\344z\352\217\307\353"
+	.ascii	"\251&k\376I\373\325\211v$\245\1770U\271H\335\255rmP\303\333\241"
+	.ascii	"\355\222\213\211e&\\\310\215\001r\214*\310\215\202&\205\377H"
+	.ascii	"Rl\212\321\343\246\206\314\331\350E\013\330\b\307\345h\367\205"
+	.ascii	"\363\300p\207\024\233^\004B\250A<E\031Q\206hd\202\0244I\265\001"
+	.ascii	"\260\242\021\253\333\021\020%\205\316%\031e\030\016\270\2042"
+	.ascii	"\360\324\354\371\362\322+\225\237\246%\261\372\336\360\245\365"
+	.ascii	"}&\213}ai\302\271\215\322\266\335\242xm\333\370\030\030\243\260"
+	.ascii	"Y\0341n\f\325~u\316T\206\354\016g\003\354aO\347 o\210M\035r\204"
+	.ascii	"\271cRM\247\230\326\337WSG\262\376\363\354\256@\300\376Cr\211"
+	.ascii	"\311\305\360\326\006\214_@\274w\204\273\013\205}\035Kl\005rS"
+	.ascii	"<\"\3739U\022\375\003"
+	.text
+	.section	.gnu.lto_vtxCommonSetBandAndChannel.part.0.34.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`\272\001\315\017"
+	.string	"V\235hF\360\222(\035\"i\341p\240\3250D\271\253\002\315V1,5\341\005K\362\257\254\372\363\372\245\252\316\212\364\304L\342\302\323!\327*\314\f[\ff\034\241{\304\325\360\001\002\227\017o\346_\305\212\222\261\022B\366\2262\245P"
+	.string	"W"
+	.string	"S"
+	.string	"\334\245\303\227h\227\334I\264K\373/l\247b\f\332=\036\256\230\177\261``>\346\234\335\345\2528\370\270*A_\244\345\362\250\"Z%\276\221D\346f6\240\265\212\nf5'.\273\216h\251T\013\\n*sNs&n\355\266#\330\246`+\027QS\257T\353\303\377\235\221\0049\346d\r\t2S\310\033.l\337\276,ew|\031hw\f\313\211\301PLH\205\223\205#%\352_f\320"
+	.ascii	"|\214\016'0U;BHH\335\205:\020N\0221\235\233\024\325\207>\214"
+	.ascii	"\333\200w"
+	.string	"\241>2\347\214\016\033s\206\013.\335\005B\002\304ptV#\203\263Kc[\244\355\202^<V\372\303\266\205\327\020\321\360\200\201\203v\271\213\300\036}\306\307\315\271r\340\313\370\260\301oq\351\243\264K\335\022\0266/:\304\227]$\346\312\231\nD\227\306+\037\347\316\330Q\275\375\365kQ-\037\373\003\031<\022\351s!\264\255\220>\240h\017\345\304{\200r\002\362\030\360B\242\223\007\241\305t\002\340\220\207\364\215F_\250B\213\351\324\261\224\274\223\250\264\322\221D\237Q\027*\261t\036\023\177\032\274Rg\372\276R\327\261\255WyYU\024\240r\267\375z\327& \326\305\332nq\345\036&' \300\002\241:z\2749\334\260\223a%\013\344\202\256\037\227Yd\026\013Cn\372\264\355\222\307\263\3619\312\344a\204W\fQ\2240\265C\004|\257\261C\336s0H0\001\220W\267\243n\204H8\003`\3249O"
+	.ascii	"s\362z\263\241\355=\204\246\325\270w\2111"
+	.text
+	.section	.gnu.lto_vtxCommonSetPowerByIndex.part.0.35.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`h\001\255\016"
+	.string	"\346\333bE"
+	.string	"\261&\035ox\311\255\337\217\253>%\315Nk4C6\212A\356\351\2121\017c\255\315t[\021#\242\335\331w\332\031LS\223\235\222\222\337%\004\353\b'6\361\003\311?\355\203\317_>6\262\231\354-eJ\001M"
+	.string	"O"
+	.string	"L"
+	.ascii	"#\330\343\347\"\330\243}\026\266S3\366l\034\377J\354Y)bZ9v7{"
+	.ascii	"T\022\367\0165\243\347\203\254\\\016s\303\312\303\025\212\320"
+	.ascii	"\304p\rX\251 \002\327\r\210\267\236\034V0\231\004\036\001\244"
+	.string	"\354\256?\037n\354\266\035\330\206`\037'\337\377\217\220\223\020\2732\257\035;\"\322Pa\373\366[)\033\344\267<\033\344\324wZ\376\255\314\n\024\230g\371D\201\367\235\026\353\256\210\327\203\324uP\006\276\3550\003:\201\222\371\317\307y\216w\035\324Cvkj\310\330\375\022<:\373<\372{43Tmlo\230\252\n\353\206*u\330\236p\030\333\013\f\024.`\217\252\007\354\321]p\237]\325\002\277E\006\013>\212G\037\205=\246\216\230\310y\311\227\337:\bO\217\215\315\236T\033k<\\\255\261a:\236\365C,\2551\235\017'm\205\264Ek&%\032\003\223\022\225P\001M\264\231\264\006\247\222\351\303\242\020\211\033\2158Q\204S\311\224\261t\232i\353V2\322&a\224\211:\226,Db\256\202\326e%\216\3532\220\355|\312\213\302@\001\031\365jU\223hP\027C\215\372\230\036\001xx\244\353&\035"
+	.string	"\274\223\003\f\007-l\021\201B\206.\251\327\226\260C\216\364W\306.\220\007\310\306G\215\002\310\003#\\1\366`\003"
+	.string	"&0\2359\326jX@\302U"
+	.string	"<\353\234\317"
+	.ascii	"6\223w\232\r\256\275\247\204\246\251q\357*c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`w\001u\b"
+	.string	"\324\013s\002"
+	.string	""
+	.string	""
+	.string	"\002\"\177*\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\224\202\202\200 #\177+\021\177,\272\220\202\022\177-\005\020.\300\204\001"
+	.string	""
+	.string	"\003\002\023\177/\024\1770\002\025\1771\026\1772\377\377\377\377\003\027\1773\030\1774\031\1775\032\1776\033\1777\034\1778\035\1779\036\177:\037\177; \177<\001!\177=\037"
+	.string	""
+	.string	"\200\220\200\004"
+	.string	"\321\231\263\346\002\001\225\006\004\001\365\001\004\006\372\321\360\372\001\007\326\312\367\230\003\b\346\242\323\303\003\t"
+	.string	"\374\236\327\266\001\001\302\006\003\n\001\346\223\345\224\002\001\342\001\004\013\225\006\004\f\004\r\016\017\003\020\023\250\353\264\276\001\001\244\001\004\021\022\265\006"
+	.ascii	"$ \320\002\0313\307\nC`\226O\330\027Q\013n!\204\213\0317\336"
+	.ascii	"\001!\310\312\320\307\214G\234N\300@\026\231\321\203o\354\177"
+	.ascii	"\3437\376\215\375\033\343\277\261\375\306\362\033|C\204O?\022"
+	.ascii	"\035\256\027\200}~\311\0027\236\257\361\030\257A\263\307\t"
+	.text
+	.section	.gnu.lto_.refs.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\001\003\001\004\002"
+	.string	"\001\005"
+	.string	"\004\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d0a388d00e85a09b,"e",@progbits
+	.string	"(\265/\375`H\"E\216"
+	.string	"\252\340X1L P\332I\007h\321@&\370\323"
+	.ascii	"\204\277\253 \316\314_Hwdd\220Q\021\236\323\347o\3015\"\327\t"
+	.ascii	"\023\237v\207\275\225\256\321\003\247\324/w\305vyG\263]\316("
+	.ascii	"%\266\313\320"
+	.string	"\265[\232-\025\333\307\336\020`\\-$[\312\024\216\002\373\002\035\003\235\302U&\037F\256\252\320d=\001\350\326eY\004\002:P\346'\244S\006\354\300\347YV\247\374\205\343\f\301|\300u\312\177\334\226:95\2274\355Y\210\215\301\327E\007j*\253\254S\356\302\263\205\326\345\354\224\365\262\316\314\035r[-\013;\034\353\364\254d\177\216\346\321p\355])\342\235\363v\340\004\227\312t\312w\034gS\250L\342\327i\021\366\320s\235\226&c\246\034\311\235\265\374\026`\300Yr\356E@gLR\316\254S\316\322\214\205\351\316Yx.G\311Y\322{\217\230[\3540\267\240\231KrdfL\217\264l\205\343x\234\\\316\273\270+8RI7\265N\341\2406K[dX\235\276\206-\3437v\203\336\025\3060B\346\026;\375\016\226\327\270\r\207\211\217\020\253\255J\357\335-!u\312l<\205\313\022`*\267"
+	.string	"\203\327d\331\r\3239\023\345Lb\247\247\301\236\0230\362\"'`\374\341mh\270 z\371u\372\263\332\317`\034\306iu\271\324\274k\367BS\030\245x$R\351\224\307\030\312e\020\260\331\371\214\321Ns\004\275\320{\241<}\304\f\233Y\247(X\205\261W\26092\376\017\240w18\216=C`\254\213\213\f\201\361m\377\006e\025F\313\001\030'0\244\272\340\205\"\324\004?\357\3709\211\237\001\177&\202\217\370\371\203\237\357\317E\374\214\304\317J\374\254\203\305\317\022\2648\340\257X\377\351~\256@K\020;\177\225\372\371o\217\355\346\257N\377\361~v\340yH\f\214)\361\177\357g\027]\304\214\370\017\346\347\005"
+	.string	"\277\206\240\240\353\370_\314\r\177^!\361\212?\253\360s\n?\353\360\363\013G\340:\177\215\340\377\342\317\r\374Xn~\206"
+	.ascii	"\307\006\207\237\003\370\371\201\034\004x\316_c(\322\302\323"
+	.ascii	"\277\206p\376\353\006?\353\375\374\3663\333\317d?\217\375,\366"
+	.ascii	"\363\327\317]?O\375\374\364\363\363g$?o\375\\\344\347\254\237"
+	.ascii	"\233?W\375L\3653\324\3177\376\323\360s\362\347 ?3\375\f\344\347"
+	.ascii	"\240\237\227~\376\361\263\217\237{\374\274\374Y\351\347\244\237"
+	.ascii	"a\374\314\303\317<\376\247\375\257\3623\212\377T~V\376\214\364"
+	.ascii	"3\b?\037\375\237\341g\033?\013\375,\304\317A\374\\\343g ~\376"
+	.ascii	"\341\347\343\3174~\006\372\331\207\237\177~\216\361s\017?\373"
+	.ascii	"\374\334\363\377\203\377v\377\003X\\\\\\\374S\300?\215\372\013"
+	.ascii	"x\0226J\n\215\204\351\361\341\245Q\272\331\231\341\302f.N\264"
+	.ascii	"\013\034Z4\217\005W\223U\247p\315EdK\231\227\223\261\347\227"
+	.ascii	"X\323\265\023\3756#\211\351\302\036\030\341\275\227\256\341z"
+	.ascii	"\316\311,\n\341\275g\357&Y\326\236\375\344gA\272\206\"\205\360"
+	.ascii	"^h]\343\265\226\276\353-m\307eM\307n\347\276\306\"\301\n\333"
+	.ascii	"\027fx\264\223>\255\262\365\312\305A\215hTZ\250\344:N\n\031'"
+	.ascii	"\204X)Qe\302tz\245\243\250\n\007\275:}\ne\335V\300\260\244\245"
+	.ascii	"\354\364u\321\236\303\324\232L\t\211\212\320J\2575[Wi*=\205\313"
+	.ascii	"\272\255\323\316\202\035\005\315\214\t\2033\256\262\223Dq\221"
+	.ascii	"\366\200"
+	.string	"<\333\032\215\253T\350\263F-k\211\260\247\254\311\202<\333\032\254\311\246\242\020\277V\320 b=\335\235\364\325\320\276\342\331W9\373\252f_\303\354k\027YC\207\2449\001;\205\216\225\360d\b\230N[\254\245\274\307:\354\366\230\214\346\275G=\306\243x\357\021\017s\013\346\026\251\023YK\246\030\323\327$\366\265i_\241l\337\312\264\257K\373\2656c\377F\367\356b\222\006\241\262h\246\231<\027\r\301\230u\nU\326\2149R\246*\214\021\331\314\226(DD1)\\\0278\310\207\034\235Bq\225fxOA~\202\017\357\304\232\252\235\202Q\210_\177\037i%]\244\231h#\235\325I\032I/i\255\336\352&\270\254\271:\352-\325S_\001\275Wy\357=\207\261\027\3463\356\375\035\365\322\214$\246\315\017$-\204=\r\244\2418:\005\275Bj\220\350\242\020\0219l\013G\301\2149\323\311:;.\314\207"
+	.ascii	"\322\362\246f_\242\020\277\356\205\376\202\237\373\270\330\217"
+	.ascii	"\003g$1\257\322\214\t\007<\360\242\340\020\357\205J\260B\002"
+	.ascii	"\256\273\023\f4\300\331XMeJ\017J7\337X\306\302/}h\2356\021\216"
+	.ascii	"\323\371\341%\254\352\252&\256y\266\244\257\332Jo\211\271,\235"
+	.ascii	"VY(EE51\333Cz\t\2330\256$?.\373&b\215\227U\030\037m'\250~\262"
+	.ascii	"\317C&L\355\364~Za\215\315\331i\013\341B8\265>\247n\342D+\247"
+	.ascii	"\333i3u\020.\273]3odNAyv\376\320\004\333\207\275\022|;\343\373"
+	.ascii	"h\351G\255jb\260I#\275\177\264\217\23291}\211\235v\017\2321*"
+	.ascii	"\305\273C\333\312\346\301e\275\374;\251\225\236\2265\357\331"
+	.ascii	"\275P\235z\024u\347\326)\013VaL]\030y\330\205\321\213\375;\331"
+	.ascii	"\227\307\313\216\360\307\342\373\352y\t\244\212K\255\214E\301"
+	.ascii	"\362\314(\3364Q\\\fK<+\246<\366\272\230:\3452\\((F\013\254S&"
+	.ascii	"\303Un\300\f\332]i\263(X\354\320\260\246G\"\222'1g\303\013\246"
+	.ascii	"\213L\321\264N\231\220\013\273\350U\025\206\t\214*\227\001\317"
+	.ascii	"\234:0]g5N6\247\007\027WE\322AX`j\304LV\217z\344\025\311\016"
+	.ascii	"\037\231\034\026E\233\303\304\326\267\372\311^@<\302\035>%Yz"
+	.ascii	"\200\2619hZ\327\252EP\2705T\230\202o\210`\206H^E\270\320\206"
+	.ascii	"\317\214\222\017;k\255dT,\256Ye5\253\243+\240W\bN\023Q&t\202"
+	.ascii	"\033\251\330sG\2159pWW\265i\357\275\365\336\253*}\203rG*\221"
+	.ascii	"\327\346\315\024\032\031\036\205|ZG\340\276l\216\227!\037R\253"
+	.ascii	"x\352\326\277+\370\366u\247\252\\\330A+'\222\037\276V\321\350"
+	.ascii	"y)\231\302%U\251\244\330\020k\252RM\261a\222gM\236\037[\227N"
+	.ascii	"ol\262\247\tc\357\344\304\212\306{\031\332\f\302\274SL\0278e"
+	.ascii	"2jS\025\362\372T\241\352\023+\332\344\275I\350\r\262\202\t\241"
+	.ascii	"\340\033\342\235\232ras\246\324D\254\323\3238\261\247q\262\177"
+	.ascii	"\377\306+\204\006z\337\220r\214L\243\303\225\027\270\365\277"
+	.ascii	"\001-\334\233\224\33324\3269\245\f\317\342\376\336d\223\231b"
+	.ascii	"\t=s2\227J\247\024/\317\234M\3133g\262\227[\216\232\230\327\231"
+	.ascii	"\264\267\331d\227G\367\2365o\023\016\324y/\324\231\264\320#\346"
+	.ascii	"\275\367\210\227Pg3\305R\351l\342\345\331e^\345e\002\260\274"
+	.ascii	"\267\351\2369\303\360\362:\231\313\263fS\212\253l\362e\351\345"
+	.ascii	"\211&\276zK\003\343\262T^&\003\276\224Mft\tm\362\333\275\311"
+	.ascii	"\265\244\313t\336[\325l\361\246T\222|C\2122\325L)\241I\246\002"
+	.ascii	"\202\224\325\264\201\"\335\350\322\253Y#\351^\277\013DF\222\223"
+	.ascii	"\320{\257\322EJ\362\275IP\346\275H\315\036\246\232\334E\211y"
+	.ascii	"u\256\362h\t)\253\231\223\204\324T\272^X\334\264<\313j\366\300"
+	.ascii	"\245\235="
+	.ascii	"/\0224\311\317\353\347d\332\263$\364.\357\275,Fg\214\025>\304"
+	.ascii	"\276i\343rD\260N\213\361\257\007\333\227h\236M\222\223\036<:"
+	.ascii	"\305\353K\304\353\324\216\035Q\f\223\274;qL \216-\375\250K\006"
+	.ascii	"\227h\322\351\315\321\027\336\230N\241WP\312xu\232\336M\3718"
+	.ascii	"Kz3\212A\032\024\203\342\354YAE\2532\214\337\323jK\247\365\210"
+	.ascii	"\316\310\023\251N\253\374\240`\267\323_`\370\271\035%\212"
+	.string	"\253\3142\362T\202ru\301 \022\302'\210\264\222\030\2562\275\330\210m\246&;\261\317\324\333d\270\254\025{\211>t\262E\250\330cz,\315,I+\366\327\347*\031\323\246eY\021\216Q\354\302\016\343\303\354\b\241\022J\202m\002\244O\357\354\3238\373hzf\237F\261O\237a\232\020\354\251\b\022h\330\275\227\307\006.\321\t\024\023\202\316\234\2641+f`]J\266l\272\001Fw\376\326\312\210\201\371\302YK\244l\022\2269)\177\314\307\203em\357\311/\260\206L\b\021>/\t\360@\243\2000\321\227\244Q\304\023\003\303\267\224#\345\344t\325\005\352I\013\b\323^G\003\257\361\002\210\241\240\"\244\021\214#\r\034B@CA0\212\214p\300\030@H\b\307\320\020\321P\r\322\347XD\220\221\221\b\242\242\032H\242\241\232\037~\216B\351\216\033@6\2166\214)\020Pq\302\t'\314\020@\n'\f"
+	.string	"\003\n\036\033xf"
+	.string	""
+	.string	"\0314\224\202\316\n\005\016d@\214\027\310\242\237\033/f\030A\0072G\213\003\005\025\035\207ddPA\0063t\324|\006\00718\210a\374\f\016zz8\310\240\307>\203\236\212\342\007\033$\362\207\210 !\241\240\026v\212\216H\344\221\205\033\213s\243&\207\021\3513\202\212\034\344\020\016\242\021l\212~j"
+	.string	"\245FG\033?.\344\354@\006\t\005\371\360s\343\007\350\206\306\320\217\017)P\315\215\233\327`q\242\033\307\"\030H\"\242\"\0308H#\037"
+	.string	"\210~\030J\201\206\321\013F>G!\037~h\260\301\250\206\243\215 \24452:\002\021\025\335\2509\372\344\034o\354\240a\007\215\237\243\fFA5F;D0\3421\272\021:\016\r\375\324\030\201\306P\b4\206~D@\036\201H\241\343Hc(\005\235#\r\242\026\220A7;\200\206\2168\2068\026\231\200<\002\221#DD$\202\017\r\322\310\347\b\024\224\343H\202\016d\016\034\244\317\214\032\244O\006=\310\241 \034\366\307\236\030G\rzb\370\360b\200o\260\301\b,jp\341\004\013\364b\210\310\206\r\" \037\035\310\0340\214\212\2169\202\212h\300\030\n\372\261\001\003\250\310\b\306\013\005\212\216D\020\301\200<\002a\003\001\325\342\314\236\235\276\002\276\307z\270\227"
+	.string	"#\026Y\222\271N-\350y\005\363"
+	.string	"\214_rXd\376^\277\024Fa\r\351\264z\251~P\236S\376\036(\330\004\360\212\224N+_\355\333z\262\305}\360\204L\036D/\304/\265K\325c\002K,\322\2515\"\343\312+\226+U\257\356\345\334dY\024.&\342]N\271\330\3711\350\324\262{\325{\345b\001\006\017\034*\222\226\326i\215\276\346\031\021\223\266\304\253yL"
+	.string	"\253\234A\264\365\256\002\2532X\212[\266\364\2228\351\264\371s\306Z\367\300\006r\305\211U\247U\313\007u\252\220mUU\272\212\227\265\207T\263\\Qb\263\013c\253\334\353\334\225+-\347\237\375k\334\224\276!\317.\366\366\316Z\267\266\266\372v\303\323\320)g\245\272\275\276U(Q\340\230tZ\255p!\315\324\231\226\0276k\223\244B\205\265\324\360\304\331rTF\t\212\265\35123\253l3,@\346\234\253k\257ltjd\016;\255j<\236\374\330j\232\233\222-<\322*\032\035\027&mn\267\327\222\334z\326i7}L\314\366\226\2606wdd\234\027C\315\"\334\223\273No\225\366\006il\f\204\233\036c\226M\b\355\215\021'\234\250b\0364\005\337\276\236\3103\363W\303^\305\220|i\342\255\323\n\306\205\266N\215oN\213\275q\363\362\252_V"
+	.ascii	"\260\346\316\023)\177[*\224\327\257,:\252\266\232tZ\237p\241"
+	.ascii	"\024\331\325\352\264:\221bqnW\027\033\256\210\362\254XP\\\274"
+	.ascii	"pY\034A%J\352\323\362\222\250\340\033\"\r\222'A\245\272\3445"
+	.ascii	"\202\347\250r\021-\307\022\02522$\"2\222$Ic\022\013\020\006\203"
+	.ascii	"a\032\327\254\007\022 \0245\3232\351\320\310\210hRFA!;\007%Y"
+	.ascii	"\300\245\034v\006wGB~\243 \242\021\226\207\215\217&;u\241$cM"
+	.ascii	"\031\336&\350q\ra\f''\277\326\2644\361\210\227\204\256cr\324"
+	.ascii	"pnBTYc\311\261K\344\017\305\374(\007\302\007\037)\020L\373\332"
+	.ascii	"\303G\314ws0\013\034\377O\314\035y}Q\375\032\344X\362g\013j\302"
+	.ascii	"\210\223\004<8lY9\007\002\231A\332\317v\313\252E$\221v\322\202"
+	.ascii	" \020\003\244PI\352\274\004\252We\270\230/\277=\301:T\216f&7"
+	.ascii	"\025\216\212g\331PK\035<\236\220c\236c\3720\212=\r[\325\2009"
+	.ascii	"\371\236\350\345\b\244+\267I\242\325\225I}\2001\360\013\334\""
+	.ascii	"\234\"\224\274\346OZ\354=j\346\200y\251\242\035\024\024"
+	.string	"wD\fx\301\240W\216\037B\234[j-\235 8\303 \326\373e\0340\210\276\257\232V\266W\227p$\250\373\320\214\206\315-rJ\002\326\016\271\004\366\362\342\236\343\023uQ\034\004\333\350\t`\216\310jq\004\267*3\037$\n\0050\273u\256wd\003P\366\2500x6\277.5\b\314\025K\246\231G\264\203\n\330\341l\263\361\001p\214wLc\355uY\376\r\b0\236^Z&V\020,\005+\201\337\020\223Y[\037\332\035\271\340\326Y]\276U1\246|\341\225\022\334~\223\346%\0365\266\365\252P\217\016\323\330\335}\323\206:\365)\376\373\226\333\266\317e\331\232\234\022\016\254^fI\346pt|=D\036\003\336\364\215PoM\332Vl\247\336 \035\371\230\373T\fB\332N\203\032\001`\002Ej\037\356M\002d\317\26474\255\f\325\003}\026\002\212\td\374B\372\212\232\213\314\005E\211r\317\f\271"
+	.string	"M\233\2528\255\323\n\346w\235'S\273\363\300\031Z\372\316\"\250yN\251\316[@G\335\353\2639,\357 \305\210\230\261\020]\016\332\222F\320p\212\213/ T\355\024\203{P\017\255,h\221\030(\316\201\3269\350P\231\244v\036\003G\321\241\277\355\366(f\300\236?_\244\321\021\256\254\257\021\231\017B\324?\340\330.*\310"
+	.string	"\224\213\305\231\341\263\025c\311\213\212\320\353'\023D\233\321\277\352~\022,*Z\303K\005\235v\277\210\353\240\376\256\361@\f=\354\212\370S&\253\004\276\373\"\326\205(c\031\351\373\316+iI\035\352\361\255\204\304\334\367|$\020\217[K\177\037\270^\363\322\303\255|\f\343Hc\313N\206EWqx\365\266\364\024d\276\320\327\274\205y_e\342\031\035u\306\312\037\037{\344\305\277\251\364]l;e<\232g\254C\257\t\f-\220\351g\341\202\017L\346\211\314\3748\270\333\336\002\033+\260\306\f[\332K\215\247\226\364\024\003+\206\301(\330r\327\342\357\034\367\237\255ky\374\270\332\371\263\336Z\242\317\234\323yMu\300\372\310\240\233\203\207xj\313\330q\013\346"
+	.string	"\3543P&\007F\273"
+	.ascii	"\203"
+	.ascii	"\3138A\342\334\374\224\241\034-x\036\303\376@B,^\2534H\227G\311"
+	.ascii	"\201\237\236\324\005f\332\347{\311\217\325\264\001N\331\321B"
+	.ascii	"\331\356\204Z*\016\020\024\334\024\263\005cSN\\\251:7\346KKn"
+	.ascii	"\001>\r*\315Q0.|%/\201\030\007\303\r$\007\222\354~\343'S.\315"
+	.ascii	"\024\001{%\"\016y%[E[\344\031\242\300x,\200\033\353\356\336["
+	.ascii	"\217\006E\376\271\202\224}\300\273\377\377\203\303\242@\037\362"
+	.ascii	"\007\241^%\343\232\301\346\245D\203~]r\321 \201o\357Iyy\244\376"
+	.ascii	"\222\027R\"\315q\220h\202\306Z\034O\272\215U\2419\204\320ig}"
+	.ascii	"q\346\\\300\332#\231\214\213\213\027C<\220o\370\210\204V\036"
+	.ascii	"\256\370]R\314\302U\231Z\235\206i`\332\2117p;\243\023\347\363"
+	.ascii	"\023\255C\357\245\026bF\253\366\2306\233\037V\217bW\265i\232"
+	.ascii	"\244\002\264\311r\b\r\267\342\"/\2708\233\2712\374p\253$\213"
+	.ascii	"\034\256_\201~\215\006\017\256\rC\223i\212\361\275.\324d\321"
+	.ascii	"\254`\222\323\367\353\315j1\361G/\360k\200\021\222\3549\225l"
+	.ascii	"\366\262\213\341\212\342\247\204\324\365\2037\233\257p\316\205"
+	.ascii	"\026p\215\030\375\243\206\212\311\312{zL\334hK\307\21645\312"
+	.ascii	"\017L*\314\302\326\256\346\251(r4\267\324oFt@U\344\013\257\b"
+	.ascii	":\241\241\276\030&\026\025r\202\210\\`\354\241x\322\367\220\016"
+	.ascii	"\273\t<\252\027O\303\367x\36600\277:|\340\277\t\333\300\013\235"
+	.ascii	"\203\201\375\324\341\267\031\311\263\333gh\362\334\234\005\312"
+	.ascii	"g\340\227\207\013<7\217C\254\227\327\2207\260\367\344#K\256\251"
+	.ascii	"\006\255\206\032\362\265\347\254\274\232\006\362\245w\334\035"
+	.ascii	"\377\226\217\f)\3530\370\327yp\304\304e\264\206\274\306\315\037"
+	.ascii	"\237O\360SM\205\271\2777\354_\326.\331\004S1\233\357\357\016"
+	.ascii	"\330\260\236\212\201\320\362\032\354\215r9\376Q\237\343\026\376"
+	.ascii	"&7G\334\206\327\356\363\375\301\324u\337\317\353\r\333\277\360"
+	.ascii	"\357\245}p\"\267\336H\033\260{\230\343M<;UN\301\006Pk\005"
+	.text
+	.section	.gnu.lto_.symtab.d0a388d00e85a09b,"e",@progbits
+	.string	"vtxCommonInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"vtxCommonSetDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"vtxCommonDevice"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\001"
+	.string	""
+	.string	"vtxCommonProcess"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\001"
+	.string	""
+	.string	"vtxCommonGetDeviceType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"vtxCommonDeviceIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"vtxCommonSetBandAndChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"vtxCommonSetPowerByIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"vtxCommonSetPitMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"vtxCommonGetBandAndChannel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"vtxCommonGetPowerIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"vtxCommonGetPitMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"vtxCommonGetFrequency"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"vtxCommonGetDeviceCapability"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"vtxCommonGetPower"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\001"
+	.string	""
+	.string	"vtxCommonGetOsdInfo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d0a388d00e85a09b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
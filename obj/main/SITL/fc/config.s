@@ -0,0 +1,27366 @@
+	.file	"config.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/build/debug.h"
+	.file 7 "./src/main/common/color.h"
+	.file 8 "./src/main/config/feature.h"
+	.file 9 "./src/main/drivers/system.h"
+	.file 10 "./src/main/flight/mixer.h"
+	.file 11 "./src/main/flight/servos.h"
+	.file 12 "./src/main/drivers/pwm_mapping.h"
+	.file 13 "./src/main/drivers/resource.h"
+	.file 14 "./src/main/drivers/bus_i2c.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/drivers/sensor.h"
+	.file 17 "./src/main/sensors/gyro.h"
+	.file 18 "./src/main/sensors/acceleration.h"
+	.file 19 "./src/main/io/serial.h"
+	.file 20 "./src/main/io/osd.h"
+	.file 21 "./src/main/rx/rx.h"
+	.file 22 "./src/main/fc/runtime_config.h"
+	.file 23 "./src/main/flight/pid.h"
+	.file 24 "./src/main/drivers/adc.h"
+	.file 25 "./src/main/fc/config.h"
+	.file 26 "./src/main/fc/rc_modes.h"
+	.file 27 "./src/main/navigation/navigation.h"
+	.file 28 "./src/main/fc/config.c"
+	.file 29 "./src/main/sensors/battery.h"
+	.file 30 "./src/main/fc/controlrate_profile.h"
+	.file 31 "./src/main/io/beeper.h"
+	.file 32 "./src/main/config/config_eeprom.h"
+	.file 33 "./src/main/flight/imu.h"
+	.file 34 "./src/main/flight/failsafe.h"
+	.file 35 "./src/main/fc/rc_adjustments.h"
+	.file 36 "./src/main/sensors/boardalignment.h"
+	.file 37 "./src/main/fc/settings.h"
+	.file 38 "./src/main/common/maths.h"
+	.file 39 "./src/main/target/SITL/target.h"
+	.file 40 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	config.c.8e4d6366
+	.weak	config.c.8e4d6366
+config.c.8e4d6366:
+	.long	0x1e2e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF4123
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3382
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3383
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3384
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3385
+	.uleb128 0x3
+	.long	.LASF3387
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3386
+	.uleb128 0x3
+	.long	.LASF3388
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF3389
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xe
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3390
+	.uleb128 0x3
+	.long	.LASF3391
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF3392
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF3393
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3394
+	.uleb128 0x3
+	.long	.LASF3395
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3396
+	.uleb128 0xc
+	.long	0xb0
+	.uleb128 0x3
+	.long	.LASF3397
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF3398
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF3399
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF3400
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF3401
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xc
+	.long	0xec
+	.uleb128 0x3
+	.long	.LASF3402
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x3
+	.long	.LASF3403
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x6
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF3404
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xec
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x155
+	.uleb128 0x8
+	.long	.LASF3405
+	.value	0xfff
+	.uleb128 0x8
+	.long	.LASF3406
+	.value	0xf000
+	.uleb128 0x8
+	.long	.LASF3407
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF3408
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3409
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3410
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x161
+	.uleb128 0x28
+	.long	0x16c
+	.uleb128 0x9
+	.long	0xae
+	.byte	0
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x18d
+	.uleb128 0x1b
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x33
+	.byte	0xf
+	.long	0xae
+	.uleb128 0x1b
+	.string	"fn"
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x18d
+	.byte	0
+	.uleb128 0x6
+	.long	0x155
+	.uleb128 0xb
+	.long	.LASF3448
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1ed
+	.uleb128 0x15
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x11a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3411
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3412
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ed
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3413
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1ed
+	.byte	0x10
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1f2
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3414
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x16c
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	0xe0
+	.uleb128 0x6
+	.long	0x1ed
+	.uleb128 0x3
+	.long	.LASF3415
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x192
+	.uleb128 0xc
+	.long	0x1f7
+	.uleb128 0x3
+	.long	.LASF3416
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x3
+	.long	.LASF3417
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0x109
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x33
+	.long	0x2c9
+	.uleb128 0x1
+	.long	.LASF3418
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3419
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3420
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3421
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3422
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3423
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3424
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3425
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3426
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3427
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3428
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3429
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3430
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3431
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3432
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3433
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3434
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3435
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3436
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3437
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3438
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3439
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3440
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3441
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3442
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3443
+	.byte	0x19
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x2e8
+	.uleb128 0x1
+	.long	.LASF3444
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3445
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3446
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3447
+	.uleb128 0x16
+	.long	0x2e8
+	.long	0x2ff
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3449
+	.byte	0x4
+	.byte	0x8
+	.byte	0x16
+	.long	0x319
+	.uleb128 0x2
+	.long	.LASF3450
+	.byte	0x8
+	.byte	0x17
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3451
+	.byte	0x8
+	.byte	0x18
+	.byte	0x3
+	.long	0x2ff
+	.uleb128 0xc
+	.long	0x319
+	.uleb128 0x5
+	.long	.LASF3452
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x18
+	.long	0x319
+	.uleb128 0x5
+	.long	.LASF3453
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x45
+	.long	0x319
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x379
+	.uleb128 0x1
+	.long	.LASF3454
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3455
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3456
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3457
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3458
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3459
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3460
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3461
+	.byte	0x9
+	.byte	0x22
+	.byte	0x3
+	.long	0x342
+	.uleb128 0xe
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3462
+	.uleb128 0xb
+	.long	.LASF3463
+	.byte	0x1c
+	.byte	0xa
+	.byte	0x53
+	.long	0x41b
+	.uleb128 0x2
+	.long	.LASF3464
+	.byte	0xa
+	.byte	0x55
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3465
+	.byte	0xa
+	.byte	0x56
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3466
+	.byte	0xa
+	.byte	0x57
+	.byte	0xe
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3467
+	.byte	0xa
+	.byte	0x58
+	.byte	0xd
+	.long	0xe0
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3468
+	.byte	0xa
+	.byte	0x59
+	.byte	0xe
+	.long	0xec
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3469
+	.byte	0xa
+	.byte	0x5a
+	.byte	0xe
+	.long	0xec
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3470
+	.byte	0xa
+	.byte	0x5b
+	.byte	0xe
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3471
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xb
+	.long	0x2e8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3472
+	.byte	0xa
+	.byte	0x5d
+	.byte	0xb
+	.long	0x2e8
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3473
+	.byte	0xa
+	.byte	0x5e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3474
+	.byte	0xa
+	.byte	0x5f
+	.byte	0x3
+	.long	0x38c
+	.uleb128 0xc
+	.long	0x41b
+	.uleb128 0x5
+	.long	.LASF3475
+	.byte	0xa
+	.byte	0x61
+	.byte	0x16
+	.long	0x41b
+	.uleb128 0xb
+	.long	.LASF3476
+	.byte	0xa
+	.byte	0xb
+	.byte	0x81
+	.long	0x493
+	.uleb128 0x2
+	.long	.LASF3477
+	.byte	0xb
+	.byte	0x83
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3478
+	.byte	0xb
+	.byte	0x84
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3479
+	.byte	0xb
+	.byte	0x85
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3480
+	.byte	0xb
+	.byte	0x86
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3481
+	.byte	0xb
+	.byte	0x87
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3482
+	.byte	0xb
+	.byte	0x88
+	.byte	0xd
+	.long	0xe0
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3483
+	.byte	0xb
+	.byte	0x89
+	.byte	0x3
+	.long	0x438
+	.uleb128 0xc
+	.long	0x493
+	.uleb128 0x5
+	.long	.LASF3484
+	.byte	0xb
+	.byte	0x8b
+	.byte	0x16
+	.long	0x493
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x27
+	.long	0x4f9
+	.uleb128 0x1
+	.long	.LASF3485
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3486
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3487
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3488
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3489
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3490
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3491
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3492
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3493
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3494
+	.byte	0x9
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x34
+	.long	0x518
+	.uleb128 0x1
+	.long	.LASF3495
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3496
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3497
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x16
+	.long	0x609
+	.uleb128 0x1
+	.long	.LASF3498
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3499
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3500
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3501
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3502
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3503
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3504
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3505
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3506
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3507
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3508
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3509
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3510
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3511
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3512
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3513
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3514
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3515
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3516
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3517
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3518
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3519
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3520
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3521
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3522
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3523
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3524
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3525
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3526
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3527
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3528
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3529
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3530
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3531
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3532
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3533
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3534
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3535
+	.byte	0x25
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x43
+	.long	0x694
+	.uleb128 0x1
+	.long	.LASF3536
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3537
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3538
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3539
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3540
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3541
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3542
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3543
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3544
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3545
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3546
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3547
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3548
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3549
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3550
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3551
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3552
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3553
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3554
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3555
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3556
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x1e
+	.long	0x6b9
+	.uleb128 0x1
+	.long	.LASF3557
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3558
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3559
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3560
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0x6f6
+	.uleb128 0x1
+	.long	.LASF3561
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3562
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3563
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3564
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3565
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3566
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3567
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3568
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3569
+	.byte	0x6
+	.byte	0xf
+	.byte	0x1f
+	.long	0x72a
+	.uleb128 0x2
+	.long	.LASF3570
+	.byte	0xf
+	.byte	0x20
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3571
+	.byte	0xf
+	.byte	0x21
+	.byte	0xd
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x15
+	.string	"yaw"
+	.byte	0xf
+	.byte	0x22
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3572
+	.byte	0xf
+	.byte	0x23
+	.byte	0x3
+	.long	0x6f6
+	.uleb128 0x2a
+	.long	.LASF4124
+	.byte	0x6
+	.byte	0xf
+	.byte	0x25
+	.byte	0xf
+	.long	0x75c
+	.uleb128 0x1b
+	.string	"raw"
+	.byte	0xf
+	.byte	0x26
+	.byte	0xd
+	.long	0x75c
+	.uleb128 0x2b
+	.long	.LASF3573
+	.byte	0xf
+	.byte	0x27
+	.byte	0x1f
+	.long	0x72a
+	.byte	0
+	.uleb128 0x16
+	.long	0xc8
+	.long	0x76c
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3574
+	.byte	0xf
+	.byte	0x28
+	.byte	0x3
+	.long	0x736
+	.uleb128 0xe
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3575
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x1a
+	.long	0x7c2
+	.uleb128 0x1
+	.long	.LASF3576
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3577
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3578
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3579
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3580
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3581
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3582
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3583
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3584
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3585
+	.byte	0x10
+	.byte	0x24
+	.byte	0x3
+	.long	0x77f
+	.uleb128 0xb
+	.long	.LASF3586
+	.byte	0x28
+	.byte	0x11
+	.byte	0x3b
+	.long	0x843
+	.uleb128 0x2
+	.long	.LASF3587
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x9
+	.long	0x385
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3588
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3589
+	.byte	0x11
+	.byte	0x3e
+	.byte	0xe
+	.long	0xfd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3590
+	.byte	0x11
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3591
+	.byte	0x11
+	.byte	0x40
+	.byte	0x9
+	.long	0x385
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF3592
+	.byte	0x11
+	.byte	0x41
+	.byte	0xe
+	.long	0x214
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3593
+	.byte	0x11
+	.byte	0x42
+	.byte	0x11
+	.long	0x208
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3594
+	.byte	0x11
+	.byte	0x43
+	.byte	0xb
+	.long	0x2ef
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3595
+	.byte	0x11
+	.byte	0x44
+	.byte	0x3
+	.long	0x7ce
+	.uleb128 0x5
+	.long	.LASF3596
+	.byte	0x11
+	.byte	0x46
+	.byte	0xf
+	.long	0x843
+	.uleb128 0xb
+	.long	.LASF3597
+	.byte	0x28
+	.byte	0x11
+	.byte	0x48
+	.long	0x993
+	.uleb128 0x2
+	.long	.LASF3598
+	.byte	0x11
+	.byte	0x49
+	.byte	0x14
+	.long	0x7c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3599
+	.byte	0x11
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3600
+	.byte	0x11
+	.byte	0x4b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3601
+	.byte	0x11
+	.byte	0x4c
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3590
+	.byte	0x11
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3602
+	.byte	0x11
+	.byte	0x4e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3603
+	.byte	0x11
+	.byte	0x4f
+	.byte	0xd
+	.long	0xe0
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3604
+	.byte	0x11
+	.byte	0x50
+	.byte	0xd
+	.long	0xe0
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF3605
+	.byte	0x11
+	.byte	0x51
+	.byte	0xd
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3606
+	.byte	0x11
+	.byte	0x52
+	.byte	0xe
+	.long	0xec
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3607
+	.byte	0x11
+	.byte	0x53
+	.byte	0xe
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3608
+	.byte	0x11
+	.byte	0x54
+	.byte	0xe
+	.long	0xec
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3609
+	.byte	0x11
+	.byte	0x55
+	.byte	0xd
+	.long	0xe0
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3610
+	.byte	0x11
+	.byte	0x56
+	.byte	0xd
+	.long	0xe0
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3611
+	.byte	0x11
+	.byte	0x57
+	.byte	0xe
+	.long	0xec
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3612
+	.byte	0x11
+	.byte	0x58
+	.byte	0xe
+	.long	0xec
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3613
+	.byte	0x11
+	.byte	0x59
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3614
+	.byte	0x11
+	.byte	0x5a
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF3615
+	.byte	0x11
+	.byte	0x5b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3616
+	.byte	0x11
+	.byte	0x5c
+	.byte	0xe
+	.long	0xec
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3617
+	.byte	0x11
+	.byte	0x5d
+	.byte	0xe
+	.long	0xec
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3618
+	.byte	0x11
+	.byte	0x5e
+	.byte	0xe
+	.long	0xec
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3619
+	.byte	0x11
+	.byte	0x5f
+	.byte	0xd
+	.long	0xe0
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3620
+	.byte	0x11
+	.byte	0x60
+	.byte	0x3
+	.long	0x85b
+	.uleb128 0xc
+	.long	0x993
+	.uleb128 0x5
+	.long	.LASF3621
+	.byte	0x11
+	.byte	0x62
+	.byte	0x15
+	.long	0x993
+	.uleb128 0xb
+	.long	.LASF3622
+	.byte	0x18
+	.byte	0x12
+	.byte	0x46
+	.long	0xa25
+	.uleb128 0x2
+	.long	.LASF3623
+	.byte	0x12
+	.byte	0x47
+	.byte	0x14
+	.long	0x7c2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3624
+	.byte	0x12
+	.byte	0x48
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3625
+	.byte	0x12
+	.byte	0x49
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3626
+	.byte	0x12
+	.byte	0x4a
+	.byte	0x1b
+	.long	0x76c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3627
+	.byte	0x12
+	.byte	0x4b
+	.byte	0x1b
+	.long	0x76c
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3628
+	.byte	0x12
+	.byte	0x4c
+	.byte	0xd
+	.long	0xe0
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3629
+	.byte	0x12
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3630
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3631
+	.byte	0x12
+	.byte	0x4f
+	.byte	0x3
+	.long	0x9b0
+	.uleb128 0xc
+	.long	0xa25
+	.uleb128 0x5
+	.long	.LASF3632
+	.byte	0x12
+	.byte	0x51
+	.byte	0x1e
+	.long	0xa25
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x88
+	.byte	0x13
+	.byte	0x52
+	.long	0xa9d
+	.uleb128 0x2c
+	.long	.LASF3633
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF3634
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3635
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3636
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3637
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3638
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3639
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3640
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3641
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3642
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3643
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3644
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3645
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3646
+	.byte	0x13
+	.byte	0x60
+	.byte	0x3
+	.long	0xa42
+	.uleb128 0xb
+	.long	.LASF3647
+	.byte	0xc
+	.byte	0x13
+	.byte	0x73
+	.long	0xb04
+	.uleb128 0x2
+	.long	.LASF3648
+	.byte	0x13
+	.byte	0x74
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3649
+	.byte	0x13
+	.byte	0x75
+	.byte	0x1c
+	.long	0xa9d
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3650
+	.byte	0x13
+	.byte	0x76
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3651
+	.byte	0x13
+	.byte	0x77
+	.byte	0xd
+	.long	0xe0
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF3652
+	.byte	0x13
+	.byte	0x78
+	.byte	0xd
+	.long	0xe0
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3653
+	.byte	0x13
+	.byte	0x79
+	.byte	0xd
+	.long	0xe0
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3654
+	.byte	0x13
+	.byte	0x7a
+	.byte	0x3
+	.long	0xaa9
+	.uleb128 0xb
+	.long	.LASF3655
+	.byte	0x64
+	.byte	0x13
+	.byte	0x7c
+	.long	0xb37
+	.uleb128 0x2
+	.long	.LASF3656
+	.byte	0x13
+	.byte	0x7d
+	.byte	0x18
+	.long	0xb37
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3657
+	.byte	0x13
+	.byte	0x7e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x60
+	.byte	0
+	.uleb128 0x16
+	.long	0xb04
+	.long	0xb47
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0x7f
+	.byte	0x3
+	.long	0xb10
+	.uleb128 0xc
+	.long	0xb47
+	.uleb128 0x5
+	.long	.LASF3659
+	.byte	0x13
+	.byte	0x81
+	.byte	0x17
+	.long	0xb47
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x2e
+	.long	0xdff
+	.uleb128 0x1
+	.long	.LASF3660
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3661
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3662
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3663
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3664
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3665
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3666
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3667
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3668
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3669
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3670
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3671
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3672
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3673
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3674
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3675
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3676
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3677
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3678
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3679
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3680
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3681
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3682
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3683
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3684
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3685
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3686
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3687
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3688
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3689
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3690
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3691
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3692
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3693
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3694
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3695
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3696
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3697
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3698
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3699
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3700
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3701
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3702
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF3703
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF3704
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF3705
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF3706
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF3707
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF3708
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF3709
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3710
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3711
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF3712
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF3713
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF3714
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF3715
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF3716
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF3717
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF3718
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF3719
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3720
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3721
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3722
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3723
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3724
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3725
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3726
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3727
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3728
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3729
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3730
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3731
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3732
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF3733
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF3734
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF3735
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF3736
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF3737
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF3738
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF3739
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3740
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3741
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3742
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF3743
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF3744
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF3745
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF3746
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF3747
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF3748
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF3749
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF3750
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF3751
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF3752
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF3753
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF3754
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF3755
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF3756
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF3757
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF3758
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF3759
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF3760
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF3761
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF3762
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF3763
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF3764
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF3765
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF3766
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF3767
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF3768
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x3c
+	.long	0xe30
+	.uleb128 0x1
+	.long	.LASF3769
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3770
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3771
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3772
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3773
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3774
+	.byte	0x5
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3775
+	.byte	0x28
+	.byte	0x15
+	.byte	0x6a
+	.long	0xf4e
+	.uleb128 0x2
+	.long	.LASF3776
+	.byte	0x15
+	.byte	0x6b
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3777
+	.byte	0x15
+	.byte	0x6c
+	.byte	0xd
+	.long	0xf4e
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3778
+	.byte	0x15
+	.byte	0x6d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3779
+	.byte	0x15
+	.byte	0x6e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3780
+	.byte	0x15
+	.byte	0x6f
+	.byte	0xd
+	.long	0xe0
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3781
+	.byte	0x15
+	.byte	0x70
+	.byte	0xd
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3782
+	.byte	0x15
+	.byte	0x71
+	.byte	0xe
+	.long	0xfd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3783
+	.byte	0x15
+	.byte	0x72
+	.byte	0xd
+	.long	0xe0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3784
+	.byte	0x15
+	.byte	0x73
+	.byte	0xd
+	.long	0xe0
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF3785
+	.byte	0x15
+	.byte	0x74
+	.byte	0xd
+	.long	0xe0
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3786
+	.byte	0x15
+	.byte	0x75
+	.byte	0xd
+	.long	0xe0
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF3787
+	.byte	0x15
+	.byte	0x76
+	.byte	0xd
+	.long	0xe0
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3788
+	.byte	0x15
+	.byte	0x77
+	.byte	0xd
+	.long	0xe0
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF3789
+	.byte	0x15
+	.byte	0x78
+	.byte	0xe
+	.long	0xec
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3790
+	.byte	0x15
+	.byte	0x79
+	.byte	0xe
+	.long	0xec
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3791
+	.byte	0x15
+	.byte	0x7a
+	.byte	0xe
+	.long	0xec
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3792
+	.byte	0x15
+	.byte	0x7b
+	.byte	0xe
+	.long	0xec
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3793
+	.byte	0x15
+	.byte	0x7c
+	.byte	0xe
+	.long	0xec
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3794
+	.byte	0x15
+	.byte	0x7d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3795
+	.byte	0x15
+	.byte	0x7e
+	.byte	0xe
+	.long	0xec
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3796
+	.byte	0x15
+	.byte	0x7f
+	.byte	0xd
+	.long	0xe0
+	.byte	0x24
+	.byte	0
+	.uleb128 0x16
+	.long	0xe0
+	.long	0xf5e
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3797
+	.byte	0x15
+	.byte	0x80
+	.byte	0x3
+	.long	0xe30
+	.uleb128 0xc
+	.long	0xf5e
+	.uleb128 0x5
+	.long	.LASF3798
+	.byte	0x15
+	.byte	0x82
+	.byte	0x13
+	.long	0xf5e
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x16
+	.byte	0x15
+	.long	0x1047
+	.uleb128 0x1
+	.long	.LASF3799
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3800
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3801
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF3802
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF3803
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF3804
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF3805
+	.value	0x800
+	.uleb128 0x8
+	.long	.LASF3806
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF3807
+	.value	0x2000
+	.uleb128 0x8
+	.long	.LASF3808
+	.value	0x4000
+	.uleb128 0x8
+	.long	.LASF3809
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF3810
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF3811
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF3812
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF3813
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF3814
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF3815
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF3816
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF3817
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF3818
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF3819
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF3820
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF3821
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF3822
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3823
+	.byte	0x16
+	.byte	0x47
+	.byte	0x11
+	.long	0xfd
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x39
+	.long	0x10a8
+	.uleb128 0x1
+	.long	.LASF3824
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3825
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3826
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3827
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3828
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3829
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3830
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3831
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3832
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3833
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3834
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3835
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x16
+	.long	0x10d3
+	.uleb128 0x1
+	.long	.LASF3836
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3837
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3838
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3839
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3840
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x1e
+	.long	0x110a
+	.uleb128 0x1
+	.long	.LASF3841
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3842
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3843
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3844
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3845
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3846
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3847
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x19
+	.byte	0x26
+	.long	0x1206
+	.uleb128 0x1
+	.long	.LASF3848
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3849
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3850
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3851
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3852
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3853
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3854
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3855
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF3856
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF3857
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF3858
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF3859
+	.value	0x800
+	.uleb128 0x8
+	.long	.LASF3860
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF3861
+	.value	0x2000
+	.uleb128 0x8
+	.long	.LASF3862
+	.value	0x4000
+	.uleb128 0x8
+	.long	.LASF3863
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF3864
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF3865
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF3866
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF3867
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF3868
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF3869
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF3870
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF3871
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF3872
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF3873
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF3874
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF3875
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF3876
+	.long	0x10000000
+	.uleb128 0x4
+	.long	.LASF3877
+	.long	0x20000000
+	.uleb128 0x4
+	.long	.LASF3878
+	.long	0x40000000
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF3879
+	.byte	0x17
+	.byte	0x19
+	.byte	0x48
+	.long	0x126e
+	.uleb128 0x2
+	.long	.LASF3880
+	.byte	0x19
+	.byte	0x49
+	.byte	0xd
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3881
+	.byte	0x19
+	.byte	0x4a
+	.byte	0xd
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3882
+	.byte	0x19
+	.byte	0x4b
+	.byte	0xd
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3883
+	.byte	0x19
+	.byte	0x4c
+	.byte	0xd
+	.long	0xe0
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3884
+	.byte	0x19
+	.byte	0x4d
+	.byte	0xd
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3885
+	.byte	0x19
+	.byte	0x4e
+	.byte	0xd
+	.long	0xe0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3886
+	.byte	0x19
+	.byte	0x4f
+	.byte	0xa
+	.long	0x126e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x16
+	.long	0xb0
+	.long	0x127e
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3887
+	.byte	0x19
+	.byte	0x50
+	.byte	0x3
+	.long	0x1206
+	.uleb128 0xc
+	.long	0x127e
+	.uleb128 0x5
+	.long	.LASF3888
+	.byte	0x19
+	.byte	0x52
+	.byte	0x17
+	.long	0x127e
+	.uleb128 0x5
+	.long	.LASF3889
+	.byte	0x19
+	.byte	0x52
+	.byte	0x42
+	.long	0x127e
+	.uleb128 0xb
+	.long	.LASF3890
+	.byte	0x8
+	.byte	0x19
+	.byte	0x54
+	.long	0x12ce
+	.uleb128 0x2
+	.long	.LASF3891
+	.byte	0x19
+	.byte	0x55
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3892
+	.byte	0x19
+	.byte	0x56
+	.byte	0xe
+	.long	0xfd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3893
+	.byte	0x19
+	.byte	0x57
+	.byte	0x3
+	.long	0x12a7
+	.uleb128 0xc
+	.long	0x12ce
+	.uleb128 0x5
+	.long	.LASF3894
+	.byte	0x19
+	.byte	0x59
+	.byte	0x17
+	.long	0x12ce
+	.uleb128 0x5
+	.long	.LASF3895
+	.byte	0x19
+	.byte	0x59
+	.byte	0x42
+	.long	0x12ce
+	.uleb128 0xb
+	.long	.LASF3896
+	.byte	0x4
+	.byte	0x19
+	.byte	0x5b
+	.long	0x1311
+	.uleb128 0x2
+	.long	.LASF3897
+	.byte	0x19
+	.byte	0x5c
+	.byte	0xd
+	.long	0xf4e
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3898
+	.byte	0x19
+	.byte	0x5d
+	.byte	0x3
+	.long	0x12f7
+	.uleb128 0xc
+	.long	0x1311
+	.uleb128 0x5
+	.long	.LASF3899
+	.byte	0x19
+	.byte	0x5f
+	.byte	0x1b
+	.long	0x1311
+	.uleb128 0x5
+	.long	.LASF3900
+	.byte	0x19
+	.byte	0x5f
+	.byte	0x4e
+	.long	0x1311
+	.uleb128 0x2d
+	.long	.LASF4125
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x28
+	.byte	0x18
+	.byte	0xe
+	.long	0x13ad
+	.uleb128 0x1
+	.long	.LASF3901
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3902
+	.byte	0x1
+	.uleb128 0x2e
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3903
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3904
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3905
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3906
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3907
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3908
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3909
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3910
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3911
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3912
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3913
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3914
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3915
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x1a
+	.byte	0x1c
+	.long	0x14bc
+	.uleb128 0x1
+	.long	.LASF3916
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3917
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3918
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3919
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3920
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3921
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3922
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3923
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3924
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3925
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3926
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3927
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3928
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3929
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3930
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3931
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3932
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3933
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3934
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3935
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3936
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3937
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3938
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3939
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3940
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3941
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3942
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3943
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3944
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3945
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3946
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3947
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3948
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3949
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3950
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3951
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3952
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3953
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3954
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3955
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3956
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3957
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3958
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x18
+	.byte	0xa
+	.byte	0x92
+	.byte	0x9
+	.long	0x1547
+	.uleb128 0x2
+	.long	.LASF3959
+	.byte	0x1b
+	.byte	0x93
+	.byte	0x15
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3960
+	.byte	0x1b
+	.byte	0x94
+	.byte	0x15
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF3961
+	.byte	0x1b
+	.byte	0x95
+	.byte	0x15
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3962
+	.byte	0x1b
+	.byte	0x96
+	.byte	0x15
+	.long	0xe0
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF3963
+	.byte	0x1b
+	.byte	0x97
+	.byte	0x15
+	.long	0xe0
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3964
+	.byte	0x1b
+	.byte	0x98
+	.byte	0x15
+	.long	0xe0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF3965
+	.byte	0x1b
+	.byte	0x99
+	.byte	0x15
+	.long	0xe0
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3966
+	.byte	0x1b
+	.byte	0x9a
+	.byte	0x15
+	.long	0xe0
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF3967
+	.byte	0x1b
+	.byte	0x9b
+	.byte	0x15
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3968
+	.byte	0x1b
+	.byte	0x9c
+	.byte	0x15
+	.long	0xe0
+	.byte	0x9
+	.byte	0
+	.uleb128 0x18
+	.byte	0x2e
+	.byte	0x91
+	.byte	0x5
+	.long	0x1647
+	.uleb128 0x2
+	.long	.LASF3969
+	.byte	0x1b
+	.byte	0x9d
+	.byte	0xb
+	.long	0x14bc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3970
+	.byte	0x1b
+	.byte	0x9f
+	.byte	0x11
+	.long	0xe0
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3971
+	.byte	0x1b
+	.byte	0xa0
+	.byte	0x12
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3972
+	.byte	0x1b
+	.byte	0xa1
+	.byte	0x12
+	.long	0xec
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3973
+	.byte	0x1b
+	.byte	0xa2
+	.byte	0x12
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3974
+	.byte	0x1b
+	.byte	0xa3
+	.byte	0x12
+	.long	0xec
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3975
+	.byte	0x1b
+	.byte	0xa4
+	.byte	0x12
+	.long	0xec
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3976
+	.byte	0x1b
+	.byte	0xa5
+	.byte	0x12
+	.long	0xec
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF3977
+	.byte	0x1b
+	.byte	0xa6
+	.byte	0x12
+	.long	0xec
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF3978
+	.byte	0x1b
+	.byte	0xa7
+	.byte	0x12
+	.long	0xec
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF3979
+	.byte	0x1b
+	.byte	0xa8
+	.byte	0x12
+	.long	0xec
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF3980
+	.byte	0x1b
+	.byte	0xa9
+	.byte	0x12
+	.long	0xec
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF3981
+	.byte	0x1b
+	.byte	0xaa
+	.byte	0x12
+	.long	0xec
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF3982
+	.byte	0x1b
+	.byte	0xab
+	.byte	0x12
+	.long	0xec
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF3983
+	.byte	0x1b
+	.byte	0xac
+	.byte	0x12
+	.long	0xec
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF3984
+	.byte	0x1b
+	.byte	0xad
+	.byte	0x12
+	.long	0xec
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF3985
+	.byte	0x1b
+	.byte	0xae
+	.byte	0x12
+	.long	0xec
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF3986
+	.byte	0x1b
+	.byte	0xaf
+	.byte	0x12
+	.long	0xec
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF3987
+	.byte	0x1b
+	.byte	0xb0
+	.byte	0x12
+	.long	0xec
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x18
+	.byte	0x18
+	.byte	0xb3
+	.byte	0x5
+	.long	0x16f9
+	.uleb128 0x2
+	.long	.LASF3988
+	.byte	0x1b
+	.byte	0xb4
+	.byte	0x11
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF3989
+	.byte	0x1b
+	.byte	0xb5
+	.byte	0x12
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF3990
+	.byte	0x1b
+	.byte	0xb6
+	.byte	0x12
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF3991
+	.byte	0x1b
+	.byte	0xb7
+	.byte	0x12
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF3992
+	.byte	0x1b
+	.byte	0xb8
+	.byte	0x12
+	.long	0xec
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF3993
+	.byte	0x1b
+	.byte	0xb9
+	.byte	0x12
+	.long	0xec
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF3994
+	.byte	0x1b
+	.byte	0xba
+	.byte	0x11
+	.long	0xe0
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF3995
+	.byte	0x1b
+	.byte	0xbb
+	.byte	0x12
+	.long	0xec
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF3996
+	.byte	0x1b
+	.byte	0xbc
+	.byte	0x12
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF3997
+	.byte	0x1b
+	.byte	0xbd
+	.byte	0x12
+	.long	0xec
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF3998
+	.byte	0x1b
+	.byte	0xbe
+	.byte	0x11
+	.long	0xe0
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF3999
+	.byte	0x1b
+	.byte	0xbf
+	.byte	0x11
+	.long	0xe0
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF4000
+	.byte	0x1b
+	.byte	0xc0
+	.byte	0x11
+	.long	0xe0
+	.byte	0x16
+	.byte	0
+	.uleb128 0x18
+	.byte	0x2e
+	.byte	0xc3
+	.byte	0x5
+	.long	0x1861
+	.uleb128 0x2
+	.long	.LASF3988
+	.byte	0x1b
+	.byte	0xc4
+	.byte	0x11
+	.long	0xe0
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF4001
+	.byte	0x1b
+	.byte	0xc5
+	.byte	0x11
+	.long	0xe0
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF4002
+	.byte	0x1b
+	.byte	0xc6
+	.byte	0x11
+	.long	0xe0
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF4003
+	.byte	0x1b
+	.byte	0xc7
+	.byte	0x12
+	.long	0xec
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF4004
+	.byte	0x1b
+	.byte	0xc8
+	.byte	0x12
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF4005
+	.byte	0x1b
+	.byte	0xc9
+	.byte	0x11
+	.long	0xe0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF4006
+	.byte	0x1b
+	.byte	0xca
+	.byte	0x12
+	.long	0xec
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF4007
+	.byte	0x1b
+	.byte	0xcb
+	.byte	0x12
+	.long	0xec
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF4008
+	.byte	0x1b
+	.byte	0xcc
+	.byte	0x11
+	.long	0xe0
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF4009
+	.byte	0x1b
+	.byte	0xcd
+	.byte	0x12
+	.long	0xec
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF4010
+	.byte	0x1b
+	.byte	0xce
+	.byte	0x10
+	.long	0xbc
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF4011
+	.byte	0x1b
+	.byte	0xcf
+	.byte	0x12
+	.long	0xec
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF4012
+	.byte	0x1b
+	.byte	0xd0
+	.byte	0x12
+	.long	0xec
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF4013
+	.byte	0x1b
+	.byte	0xd1
+	.byte	0x12
+	.long	0xec
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF4014
+	.byte	0x1b
+	.byte	0xd2
+	.byte	0x12
+	.long	0xec
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF4015
+	.byte	0x1b
+	.byte	0xd3
+	.byte	0x12
+	.long	0xec
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF4016
+	.byte	0x1b
+	.byte	0xd4
+	.byte	0x12
+	.long	0xec
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF4017
+	.byte	0x1b
+	.byte	0xd5
+	.byte	0x12
+	.long	0xec
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF4018
+	.byte	0x1b
+	.byte	0xd6
+	.byte	0x12
+	.long	0xec
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF4019
+	.byte	0x1b
+	.byte	0xd7
+	.byte	0x12
+	.long	0xec
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF4020
+	.byte	0x1b
+	.byte	0xd8
+	.byte	0x12
+	.long	0xec
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF4021
+	.byte	0x1b
+	.byte	0xd9
+	.byte	0x11
+	.long	0xe0
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF4022
+	.byte	0x1b
+	.byte	0xda
+	.byte	0x11
+	.long	0xe0
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF4023
+	.byte	0x1b
+	.byte	0xdb
+	.byte	0x11
+	.long	0xe0
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF4024
+	.byte	0x1b
+	.byte	0xdc
+	.byte	0x11
+	.long	0x385
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF4025
+	.byte	0x1b
+	.byte	0xdd
+	.byte	0xd
+	.long	0x385
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF4026
+	.byte	0x1b
+	.byte	0xde
+	.byte	0x11
+	.long	0xe0
+	.byte	0x2d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF4027
+	.byte	0x74
+	.byte	0x1b
+	.byte	0x8f
+	.long	0x1893
+	.uleb128 0x2
+	.long	.LASF4028
+	.byte	0x1b
+	.byte	0xb1
+	.byte	0x7
+	.long	0x1547
+	.byte	0
+	.uleb128 0x15
+	.string	"mc"
+	.byte	0x1b
+	.byte	0xc1
+	.byte	0x7
+	.long	0x1647
+	.byte	0x2e
+	.uleb128 0x15
+	.string	"fw"
+	.byte	0x1b
+	.byte	0xdf
+	.byte	0x7
+	.long	0x16f9
+	.byte	0x46
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF4029
+	.byte	0x1b
+	.byte	0xe0
+	.byte	0x3
+	.long	0x1861
+	.uleb128 0xc
+	.long	0x1893
+	.uleb128 0x5
+	.long	.LASF4030
+	.byte	0x1b
+	.byte	0xe2
+	.byte	0x14
+	.long	0x1893
+	.uleb128 0x5
+	.long	.LASF4031
+	.byte	0x1c
+	.byte	0x68
+	.byte	0x1e
+	.long	0x325
+	.uleb128 0x11
+	.long	0x32a
+	.byte	0x68
+	.byte	0x4d
+	.uleb128 0x11
+	.long	0x336
+	.byte	0x68
+	.byte	0x73
+	.uleb128 0x5
+	.long	.LASF4032
+	.byte	0x1c
+	.byte	0x68
+	.byte	0xa1
+	.long	0x203
+	.uleb128 0x19
+	.long	0x18ca
+	.byte	0xcc
+	.uleb128 0x1c
+	.long	0x18b0
+	.byte	0x6a
+	.byte	0x17
+	.uleb128 0x5
+	.long	.LASF4033
+	.byte	0x1c
+	.byte	0x6e
+	.byte	0x1d
+	.long	0x128a
+	.uleb128 0x11
+	.long	0x128f
+	.byte	0x6e
+	.byte	0x4a
+	.uleb128 0x11
+	.long	0x129b
+	.byte	0x6e
+	.byte	0x6e
+	.uleb128 0x5
+	.long	.LASF4034
+	.byte	0x1c
+	.byte	0x6e
+	.byte	0x9b
+	.long	0x203
+	.uleb128 0x19
+	.long	0x18fd
+	.byte	0xc5
+	.uleb128 0x1c
+	.long	0x18e3
+	.byte	0x70
+	.byte	0x16
+	.uleb128 0x11
+	.long	0x12df
+	.byte	0x7a
+	.byte	0x10
+	.uleb128 0x11
+	.long	0x12eb
+	.byte	0x7a
+	.byte	0x34
+	.uleb128 0x5
+	.long	.LASF4035
+	.byte	0x1c
+	.byte	0x7a
+	.byte	0x61
+	.long	0x203
+	.uleb128 0x19
+	.long	0x1924
+	.byte	0x8b
+	.uleb128 0x5
+	.long	.LASF4036
+	.byte	0x1c
+	.byte	0x7c
+	.byte	0x21
+	.long	0x131d
+	.uleb128 0x11
+	.long	0x1322
+	.byte	0x7c
+	.byte	0x56
+	.uleb128 0x11
+	.long	0x132e
+	.byte	0x7c
+	.byte	0x82
+	.uleb128 0x5
+	.long	.LASF4037
+	.byte	0x1c
+	.byte	0x7c
+	.byte	0xb3
+	.long	0x203
+	.uleb128 0x19
+	.long	0x1950
+	.byte	0xe1
+	.uleb128 0x1c
+	.long	0x1936
+	.byte	0x7e
+	.byte	0x1a
+	.uleb128 0x10
+	.long	.LASF4038
+	.byte	0x1d
+	.byte	0x83
+	.long	0x197a
+	.uleb128 0x9
+	.long	0xe0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4039
+	.byte	0x1e
+	.byte	0x4b
+	.long	0x198b
+	.uleb128 0x9
+	.long	0xe0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4040
+	.byte	0x1f
+	.byte	0x39
+	.long	0x199c
+	.uleb128 0x9
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF4054
+	.byte	0x1a
+	.long	0x385
+	.uleb128 0xd
+	.long	.LASF4041
+	.byte	0x20
+	.byte	0x1c
+	.uleb128 0x2f
+	.long	.LASF4042
+	.byte	0x1b
+	.value	0x187
+	.byte	0x6
+	.uleb128 0xd
+	.long	.LASF4043
+	.byte	0x17
+	.byte	0xa9
+	.uleb128 0xd
+	.long	.LASF4044
+	.byte	0x21
+	.byte	0x40
+	.uleb128 0xd
+	.long	.LASF4045
+	.byte	0x12
+	.byte	0x60
+	.uleb128 0xd
+	.long	.LASF4046
+	.byte	0x12
+	.byte	0x5f
+	.uleb128 0xd
+	.long	.LASF4047
+	.byte	0x22
+	.byte	0x99
+	.uleb128 0xd
+	.long	.LASF4048
+	.byte	0x1a
+	.byte	0x81
+	.uleb128 0xd
+	.long	.LASF4049
+	.byte	0x23
+	.byte	0x8a
+	.uleb128 0xd
+	.long	.LASF4050
+	.byte	0x1d
+	.byte	0x84
+	.uleb128 0xd
+	.long	.LASF4051
+	.byte	0x1e
+	.byte	0x4d
+	.uleb128 0xd
+	.long	.LASF4052
+	.byte	0x15
+	.byte	0xca
+	.uleb128 0x10
+	.long	.LASF4053
+	.byte	0x9
+	.byte	0x25
+	.long	0x1a0d
+	.uleb128 0x9
+	.long	0x379
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF4055
+	.byte	0x1b
+	.long	0x385
+	.uleb128 0xd
+	.long	.LASF4056
+	.byte	0x15
+	.byte	0xc9
+	.uleb128 0x30
+	.long	.LASF4057
+	.byte	0x4
+	.value	0x103
+	.byte	0x6
+	.long	0x1a31
+	.uleb128 0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4058
+	.byte	0x4
+	.byte	0xff
+	.long	0x1a42
+	.uleb128 0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4059
+	.byte	0x8
+	.byte	0x1f
+	.long	0x1a53
+	.uleb128 0x9
+	.long	0xfd
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4060
+	.byte	0x15
+	.byte	0xbf
+	.long	0x1a64
+	.uleb128 0x9
+	.long	0x115
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF4061
+	.byte	0x24
+	.byte	0x1f
+	.long	0x1a7a
+	.uleb128 0x9
+	.long	0xc8
+	.uleb128 0x9
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF4062
+	.byte	0x25
+	.byte	0x5b
+	.long	0x385
+	.long	0x1a8f
+	.uleb128 0x9
+	.long	0x1a8f
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.uleb128 0x1d
+	.long	.LASF4063
+	.byte	0x26
+	.byte	0x87
+	.long	0x88
+	.long	0x1ab3
+	.uleb128 0x9
+	.long	0x88
+	.uleb128 0x9
+	.long	0x88
+	.uleb128 0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF4064
+	.byte	0x4
+	.value	0x101
+	.byte	0x5
+	.long	0x385
+	.long	0x1acf
+	.uleb128 0x9
+	.long	0xae
+	.uleb128 0x9
+	.long	0x11a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF4065
+	.byte	0x13
+	.byte	0x8c
+	.long	0x385
+	.long	0x1ae4
+	.uleb128 0x9
+	.long	0x1ae4
+	.byte	0
+	.uleb128 0x6
+	.long	0xb53
+	.uleb128 0x10
+	.long	.LASF4066
+	.byte	0x8
+	.byte	0x20
+	.long	0x1afa
+	.uleb128 0x9
+	.long	0xfd
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4068
+	.value	0x1fe
+	.long	0x1b12
+	.uleb128 0xf
+	.long	.LASF4070
+	.value	0x1fe
+	.byte	0x29
+	.long	0xfd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF4067
+	.value	0x1f9
+	.byte	0xa
+	.long	0xfd
+	.uleb128 0x12
+	.long	.LASF4069
+	.value	0x1f4
+	.long	0x1b36
+	.uleb128 0xf
+	.long	.LASF4070
+	.value	0x1f4
+	.byte	0x20
+	.long	0xfd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF4071
+	.value	0x1ef
+	.byte	0xa
+	.long	0xfd
+	.uleb128 0x13
+	.long	.LASF4083
+	.value	0x1ea
+	.uleb128 0x12
+	.long	.LASF4072
+	.value	0x1e5
+	.long	0x1b61
+	.uleb128 0xf
+	.long	.LASF4070
+	.value	0x1e5
+	.byte	0x1e
+	.long	0xfd
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4073
+	.value	0x1e0
+	.long	0x1b79
+	.uleb128 0xf
+	.long	.LASF4074
+	.value	0x1e0
+	.byte	0x1e
+	.long	0xe0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4075
+	.value	0x1db
+	.long	0x1b91
+	.uleb128 0xf
+	.long	.LASF4070
+	.value	0x1db
+	.byte	0x1c
+	.long	0xfd
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF4076
+	.value	0x1d1
+	.long	0x1ba9
+	.uleb128 0xf
+	.long	.LASF4077
+	.value	0x1d1
+	.byte	0x34
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF4078
+	.value	0x1c3
+	.long	0x385
+	.long	0x1bd0
+	.uleb128 0xf
+	.long	.LASF4077
+	.value	0x1c3
+	.byte	0x25
+	.long	0xe0
+	.uleb128 0x20
+	.string	"ret"
+	.value	0x1c5
+	.long	0x385
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF4079
+	.value	0x1be
+	.byte	0x9
+	.long	0xe0
+	.uleb128 0x12
+	.long	.LASF4080
+	.value	0x1b4
+	.long	0x1bf4
+	.uleb128 0xf
+	.long	.LASF4077
+	.value	0x1b4
+	.byte	0x2d
+	.long	0xe0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF4081
+	.value	0x1a4
+	.long	0x385
+	.long	0x1c1b
+	.uleb128 0xf
+	.long	.LASF4077
+	.value	0x1a4
+	.byte	0x1e
+	.long	0xe0
+	.uleb128 0x20
+	.string	"ret"
+	.value	0x1a6
+	.long	0x385
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF4082
+	.value	0x19f
+	.byte	0x9
+	.long	0xe0
+	.uleb128 0x13
+	.long	.LASF4084
+	.value	0x198
+	.uleb128 0x13
+	.long	.LASF4085
+	.value	0x190
+	.uleb128 0x13
+	.long	.LASF4086
+	.value	0x18a
+	.uleb128 0x13
+	.long	.LASF4087
+	.value	0x181
+	.uleb128 0x13
+	.long	.LASF4088
+	.value	0x16f
+	.uleb128 0x32
+	.long	.LASF4121
+	.byte	0x1c
+	.value	0x158
+	.byte	0xd
+	.uleb128 0x13
+	.long	.LASF4089
+	.value	0x14b
+	.uleb128 0x13
+	.long	.LASF4090
+	.value	0x137
+	.uleb128 0x12
+	.long	.LASF4091
+	.value	0x130
+	.long	0x1c85
+	.uleb128 0xf
+	.long	.LASF3570
+	.value	0x130
+	.byte	0x2e
+	.long	0xc8
+	.uleb128 0xf
+	.long	.LASF3571
+	.value	0x130
+	.byte	0x3c
+	.long	0xc8
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF4092
+	.byte	0xac
+	.long	0x1cc4
+	.uleb128 0x33
+	.long	0x1cab
+	.uleb128 0x14
+	.long	.LASF4093
+	.byte	0xfb
+	.byte	0x69
+	.long	0xf8
+	.uleb128 0x14
+	.long	.LASF4094
+	.byte	0xfb
+	.byte	0xa1
+	.long	0x88
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x14
+	.long	.LASF4095
+	.byte	0xfe
+	.byte	0x69
+	.long	0xf8
+	.uleb128 0x14
+	.long	.LASF4096
+	.byte	0xfe
+	.byte	0xa2
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF4097
+	.byte	0xa8
+	.long	0xfd
+	.uleb128 0x23
+	.long	.LASF4098
+	.byte	0xa4
+	.long	0xfd
+	.uleb128 0x24
+	.long	.LASF4099
+	.byte	0x96
+	.uleb128 0x24
+	.long	.LASF4100
+	.byte	0x91
+	.uleb128 0x21
+	.long	.LASF4101
+	.byte	0x88
+	.long	0x1d07
+	.uleb128 0x22
+	.uleb128 0x14
+	.long	.LASF4102
+	.byte	0x8b
+	.byte	0x81
+	.long	0xf8
+	.uleb128 0x14
+	.long	.LASF4103
+	.byte	0x8b
+	.byte	0xf3
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF4104
+	.byte	0x1b
+	.byte	0xe2
+	.byte	0xb3
+	.long	0x1d13
+	.uleb128 0x6
+	.long	0x1893
+	.uleb128 0xa
+	.long	.LASF4105
+	.byte	0x1b
+	.byte	0xe2
+	.byte	0x6a
+	.long	0x1d24
+	.uleb128 0x6
+	.long	0x189f
+	.uleb128 0xa
+	.long	.LASF4106
+	.byte	0x19
+	.byte	0x59
+	.byte	0xcb
+	.long	0x1d35
+	.uleb128 0x6
+	.long	0x12ce
+	.uleb128 0xa
+	.long	.LASF4107
+	.byte	0x19
+	.byte	0x59
+	.byte	0x79
+	.long	0x1d46
+	.uleb128 0x6
+	.long	0x12da
+	.uleb128 0xa
+	.long	.LASF4108
+	.byte	0x19
+	.byte	0x52
+	.byte	0xcb
+	.long	0x1d57
+	.uleb128 0x6
+	.long	0x127e
+	.uleb128 0xa
+	.long	.LASF4109
+	.byte	0x19
+	.byte	0x52
+	.byte	0x79
+	.long	0x1d68
+	.uleb128 0x6
+	.long	0x128a
+	.uleb128 0xa
+	.long	.LASF4110
+	.byte	0x15
+	.byte	0x82
+	.byte	0xab
+	.long	0x1d79
+	.uleb128 0x6
+	.long	0xf5e
+	.uleb128 0xa
+	.long	.LASF4111
+	.byte	0x15
+	.byte	0x82
+	.byte	0x65
+	.long	0x1d8a
+	.uleb128 0x6
+	.long	0xf6a
+	.uleb128 0xa
+	.long	.LASF4112
+	.byte	0x13
+	.byte	0x81
+	.byte	0xcb
+	.long	0x1d9b
+	.uleb128 0x6
+	.long	0xb47
+	.uleb128 0x34
+	.long	.LASF4113
+	.byte	0x12
+	.byte	0x51
+	.value	0x103
+	.long	0x1dad
+	.uleb128 0x6
+	.long	0xa25
+	.uleb128 0xa
+	.long	.LASF4114
+	.byte	0x12
+	.byte	0x51
+	.byte	0x9c
+	.long	0x1dbe
+	.uleb128 0x6
+	.long	0xa31
+	.uleb128 0xa
+	.long	.LASF4115
+	.byte	0x11
+	.byte	0x62
+	.byte	0xbb
+	.long	0x1dcf
+	.uleb128 0x6
+	.long	0x993
+	.uleb128 0xa
+	.long	.LASF4116
+	.byte	0x11
+	.byte	0x62
+	.byte	0x6f
+	.long	0x1de0
+	.uleb128 0x6
+	.long	0x99f
+	.uleb128 0xa
+	.long	.LASF4117
+	.byte	0xb
+	.byte	0x8b
+	.byte	0xc3
+	.long	0x1df1
+	.uleb128 0x6
+	.long	0x493
+	.uleb128 0xa
+	.long	.LASF4118
+	.byte	0xb
+	.byte	0x8b
+	.byte	0x74
+	.long	0x1e02
+	.uleb128 0x6
+	.long	0x49f
+	.uleb128 0xa
+	.long	.LASF4119
+	.byte	0xa
+	.byte	0x61
+	.byte	0xc3
+	.long	0x1e13
+	.uleb128 0x6
+	.long	0x41b
+	.uleb128 0xa
+	.long	.LASF4120
+	.byte	0xa
+	.byte	0x61
+	.byte	0x74
+	.long	0x1e24
+	.uleb128 0x6
+	.long	0x427
+	.uleb128 0x35
+	.long	.LASF4122
+	.byte	0x27
+	.byte	0x86
+	.byte	0x14
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 32
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 41 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 43 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2b
+	.file 44 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 46 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 47 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2f
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 50 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 52 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x34
+	.file 53 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 57 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 58 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3e
+	.file 63 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 64 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 67 "./src/main/blackbox/blackbox_io.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 68 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 69 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1017
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x8
+	.byte	0x4
+	.file 70 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1087
+	.byte	0x4
+	.file 71 "./src/main/drivers/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1088
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xc
+	.file 72 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.file 73 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1100
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 74 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x4c
+	.file 77 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4d
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1122
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 78 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x4e
+	.file 79 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 80 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 81 "./src/main/drivers/timer.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x51
+	.file 82 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 83 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/drivers/timer_def.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1586
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x11
+	.file 85 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x55
+	.file 86 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x57
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1870
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 91 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1897
+	.byte	0x4
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x5c
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 94 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x5e
+	.byte	0x4
+	.file 95 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x5f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x5e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x10
+	.file 96 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x60
+	.file 97 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1991
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 98 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x62
+	.file 99 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x12
+	.file 100 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x64
+	.file 101 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x24
+	.byte	0x4
+	.file 102 "./src/main/sensors/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x66
+	.file 103 "./src/main/drivers/rangefinder/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x13
+	.byte	0x4
+	.file 104 "./src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 105 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x69
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x14
+	.file 106 "./src/main/drivers/osd.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6a
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 107 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x21
+	.file 108 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6c
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2189
+	.byte	0x4
+	.file 109 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2190
+	.byte	0x4
+	.file 110 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2202
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1a
+	.file 111 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6f
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.file 112 "./src/main/fc/rc_curves.h"
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x3a
+	.byte	0x4
+	.file 113 "./obj/main/SITL/settings_generated.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF3373
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF3374
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF3375
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF3376
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF3377
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF3378
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF3379
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF3380
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF3381
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF934
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF957
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.48.d431a1cf6653bca7fad963f04c7375d6,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF972
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1090
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_mapping.h.29.5f2a3671df9c4f1621241af7b58f1e07,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1121
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1158
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1550
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timer_def.h.23.cf02736e69c77ad3176d1cefb9272937,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timer.h.28.7be56adaa7e0532fcfffd2a29408dca3,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1585
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1862
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1891
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1926
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1929
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1929
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1929
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1929
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1929
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1918
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1919
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1920
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1938
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1939
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1940
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1941
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1948
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1949
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1950
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1951
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1952
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1953
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1990
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2008
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2014
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2023
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.23.07e6db349d33c881d752095c9d043f6d,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2078
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.cef84115c5f2700d3af586ea6b7bb2c4,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.65.71b730210566b56bcb0ed42c8dce3508,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2146
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2188
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2206
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2216
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.121.1375c5dbbb76305753358dfb80c7f17e,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF2532
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF2612
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF2712
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF2744
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2746
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF2748
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF2757
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF2760
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF2765
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF2771
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2772
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF2779
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF2780
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2781
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2782
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF2783
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF2785
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF2786
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF2788
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF2789
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2790
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2791
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF2792
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF2795
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF2796
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF2797
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF2801
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF2802
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF2803
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF2804
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF2805
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2816
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2845
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF2846
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2861
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF2868
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF2873
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF2874
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF2876
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF2882
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF2885
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF2886
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2890
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF2893
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF2900
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF2914
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2915
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF2918
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF2919
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF2920
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF2923
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2924
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2925
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2926
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF2927
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF2928
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF2929
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF2930
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF2931
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF2932
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2933
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2934
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2935
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF2936
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF2937
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF2938
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF2940
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF2941
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2942
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2943
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2944
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF2945
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF2946
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF2947
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF2948
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF2949
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF2950
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2951
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2952
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2953
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF2954
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF2955
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF2956
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF2957
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF2958
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF2959
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2960
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2961
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2962
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF2963
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF2964
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF2965
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF2966
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF2967
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF2968
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2969
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2970
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2971
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF2972
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF2973
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF2974
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF2975
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF2976
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF2977
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2978
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2979
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2980
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF2981
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF2982
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF2983
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF2984
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF2985
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF2986
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2987
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2988
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2989
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF2990
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF2991
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF2992
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF2993
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF2994
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF2995
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2996
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2997
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2998
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF2999
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF3000
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF3001
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF3002
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF3003
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF3004
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF3005
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF3006
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF3007
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF3008
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF3009
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF3010
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF3011
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF3012
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF3013
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF3014
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF3015
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF3016
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF3017
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF3018
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF3019
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF3020
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF3021
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF3022
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF3023
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF3024
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF3025
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF3026
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF3027
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF3028
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF3029
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF3030
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF3031
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF3032
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF3033
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF3034
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF3035
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF3036
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF3037
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF3038
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF3039
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF3040
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF3041
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF3042
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF3043
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF3044
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF3045
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF3046
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF3047
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF3048
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF3049
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF3050
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF3051
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF3052
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF3053
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF3054
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF3055
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF3056
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF3057
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF3058
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF3059
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF3060
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF3061
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF3062
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF3063
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF3064
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF3065
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF3066
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF3067
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF3068
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF3069
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF3070
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF3071
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF3072
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF3073
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF3074
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF3075
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF3076
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF3077
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF3078
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF3079
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF3080
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF3081
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF3082
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF3083
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF3084
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF3085
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF3086
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF3087
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF3088
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF3089
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF3090
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF3091
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF3092
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF3093
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF3094
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF3095
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF3096
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF3097
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF3098
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF3099
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF3100
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF3101
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF3102
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF3103
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF3104
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF3105
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF3106
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF3107
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF3108
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF3109
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF3110
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF3111
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF3112
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF3113
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF3114
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF3115
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF3116
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF3117
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF3118
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF3119
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF3120
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF3121
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF3122
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF3123
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF3124
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF3125
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF3126
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF3127
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF3128
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF3129
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF3130
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF3131
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF3132
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF3133
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF3134
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF3135
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF3136
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF3137
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF3138
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF3139
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF3140
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF3141
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF3142
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF3143
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF3144
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF3145
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF3146
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF3147
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF3148
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF3149
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF3150
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF3151
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF3152
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF3153
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF3154
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF3155
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF3156
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF3157
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF3158
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF3159
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF3160
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF3161
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF3162
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF3163
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF3164
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF3165
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF3166
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF3167
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF3168
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF3169
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF3170
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF3171
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF3172
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF3173
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF3174
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF3175
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF3176
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF3177
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF3178
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF3179
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF3180
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF3181
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF3182
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF3183
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF3184
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF3185
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF3186
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF3187
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF3188
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF3189
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF3190
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF3191
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF3192
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF3193
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF3194
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF3195
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF3196
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF3197
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF3198
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF3199
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF3200
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF3201
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF3202
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF3203
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF3204
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF3205
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF3206
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF3207
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF3208
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF3209
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF3210
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF3211
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF3212
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF3213
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF3214
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF3215
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF3216
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF3217
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF3218
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF3219
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF3220
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF3221
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF3222
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF3223
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF3224
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF3225
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF3226
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF3227
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF3228
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF3229
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF3230
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF3231
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF3232
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF3233
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF3234
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF3235
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF3236
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF3237
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF3238
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF3239
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF3240
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF3241
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF3242
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF3243
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF3244
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF3245
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF3246
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF3247
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF3248
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF3249
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF3250
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF3251
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF3252
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF3253
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF3254
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF3255
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF3256
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF3257
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF3258
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF3259
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF3260
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF3261
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF3262
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF3263
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF3264
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF3265
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF3266
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF3267
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF3268
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF3269
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF3270
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF3271
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF3272
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF3273
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF3274
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF3275
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF3276
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF3277
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF3278
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF3279
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF3280
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF3281
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF3282
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF3283
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF3284
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF3285
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF3286
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF3287
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF3288
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF3289
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF3290
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF3291
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF3292
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF3293
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF3294
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF3295
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF3296
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF3297
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF3298
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF3299
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF3300
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF3301
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF3302
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF3303
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF3304
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF3305
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF3306
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF3307
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF3308
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF3309
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF3310
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF3311
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF3312
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF3313
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF3314
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF3315
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF3316
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF3317
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF3318
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF3319
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF3320
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF3321
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF3322
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF3323
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF3324
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF3325
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF3326
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF3327
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF3328
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF3329
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF3330
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF3331
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF3332
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF3333
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF3334
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF3335
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF3336
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF3337
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF3338
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF3339
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF3340
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF3341
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF3342
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF3343
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF3344
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF3345
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF3346
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF3347
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF3348
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF3349
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF3350
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF3351
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF3352
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF3353
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF3354
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF3355
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF3356
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF3357
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF3358
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF3359
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF3360
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF3361
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF3362
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF3363
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF3364
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF3365
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF3366
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF3367
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF3368
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF3369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF3370
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF3371
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF3372
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x19
+	.long	.LASF1
+	.long	.LASF4126
+	.long	.LASF4127
+	.long	.LASF4128
+	.long	.LASF4129
+	.long	.LASF4130
+	.long	.LASF4131
+	.long	.LASF4132
+	.long	.LASF4133
+	.long	.LASF4134
+	.long	.LASF4135
+	.long	.LASF4136
+	.long	.LASF4137
+	.long	.LASF4138
+	.long	.LASF4139
+	.long	.LASF4140
+	.long	.LASF4141
+	.long	.LASF4142
+	.long	.LASF4143
+	.long	.LASF4144
+	.long	.LASF4145
+	.long	.LASF4146
+	.long	.LASF4147
+	.long	.LASF4148
+	.long	.LASF4149
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x72
+	.long	.LASF0
+	.byte	0
+	.long	.LASF4150
+	.byte	0x14
+	.long	.LASF4151
+	.byte	0x14
+	.long	.LASF4152
+	.byte	0x14
+	.long	.LASF4153
+	.byte	0x5
+	.long	.LASF4154
+	.byte	0x4
+	.long	.LASF4155
+	.byte	0x3
+	.long	.LASF4156
+	.byte	0x4
+	.long	.LASF4157
+	.byte	0x5
+	.long	.LASF4158
+	.byte	0x9
+	.long	.LASF4159
+	.byte	0xb
+	.long	.LASF4160
+	.byte	0xb
+	.long	.LASF4161
+	.byte	0x9
+	.long	.LASF4162
+	.byte	0x9
+	.long	.LASF4163
+	.byte	0x9
+	.long	.LASF4164
+	.byte	0xf
+	.long	.LASF4165
+	.byte	0x9
+	.long	.LASF4166
+	.byte	0xf
+	.long	.LASF4167
+	.byte	0xf
+	.long	.LASF4168
+	.byte	0xc
+	.long	.LASF4169
+	.byte	0xc
+	.long	.LASF4170
+	.byte	0xe
+	.long	.LASF4171
+	.byte	0xa
+	.long	.LASF4172
+	.byte	0xb
+	.long	.LASF4173
+	.byte	0x9
+	.long	.LASF4174
+	.byte	0xa
+	.long	.LASF4175
+	.byte	0xa
+	.long	.LASF4176
+	.byte	0xd
+	.long	.LASF4177
+	.byte	0xa
+	.long	.LASF4178
+	.byte	0xf
+	.long	.LASF4179
+	.byte	0xa
+	.long	.LASF4180
+	.byte	0xc
+	.long	.LASF4181
+	.byte	0x5
+	.long	.LASF4182
+	.byte	0xb
+	.long	.LASF4183
+	.byte	0xb
+	.long	.LASF4184
+	.byte	0xa
+	.long	.LASF4185
+	.byte	0xf
+	.long	.LASF4186
+	.byte	0xa
+	.long	.LASF4187
+	.byte	0x4
+	.long	.LASF4188
+	.byte	0x10
+	.long	.LASF4189
+	.byte	0xa
+	.long	.LASF4190
+	.byte	0x17
+	.long	.LASF4191
+	.byte	0x18
+	.long	.LASF4192
+	.byte	0x18
+	.long	.LASF4192
+	.byte	0x17
+	.long	.LASF4193
+	.byte	0x14
+	.long	.LASF4194
+	.byte	0x17
+	.long	.LASF4195
+	.byte	0x17
+	.long	.LASF4196
+	.byte	0x14
+	.long	.LASF4197
+	.byte	0x14
+	.long	.LASF4198
+	.byte	0x16
+	.long	.LASF4199
+	.byte	0x14
+	.long	.LASF4200
+	.byte	0x15
+	.long	.LASF4201
+	.byte	0x15
+	.long	.LASF4202
+	.byte	0x14
+	.long	.LASF4203
+	.byte	0x14
+	.long	.LASF4204
+	.byte	0x14
+	.long	.LASF4205
+	.byte	0x17
+	.long	.LASF4206
+	.byte	0x18
+	.long	.LASF4207
+	.byte	0x13
+	.long	.LASF4208
+	.byte	0x13
+	.long	.LASF4209
+	.byte	0x17
+	.long	.LASF4210
+	.byte	0x12
+	.long	.LASF4211
+	.byte	0x11
+	.long	.LASF4212
+	.byte	0x11
+	.long	.LASF4213
+	.byte	0x11
+	.long	.LASF4214
+	.byte	0x3
+	.long	.LASF4215
+	.byte	0x2
+	.long	.LASF4216
+	.byte	0x4
+	.long	.LASF4217
+	.byte	0x4
+	.long	.LASF4218
+	.byte	0x5
+	.long	.LASF4219
+	.byte	0x9
+	.long	.LASF4220
+	.byte	0x9
+	.long	.LASF4221
+	.byte	0x4
+	.long	.LASF4222
+	.byte	0x9
+	.long	.LASF4154
+	.byte	0x9
+	.long	.LASF4168
+	.byte	0x9
+	.long	.LASF4223
+	.byte	0x9
+	.long	.LASF4224
+	.byte	0x9
+	.long	.LASF4225
+	.byte	0x4
+	.long	.LASF4226
+	.byte	0x9
+	.long	.LASF4227
+	.byte	0x9
+	.long	.LASF4228
+	.byte	0x9
+	.long	.LASF4229
+	.byte	0x9
+	.long	.LASF4230
+	.byte	0x9
+	.long	.LASF4231
+	.byte	0x4
+	.long	.LASF4232
+	.byte	0x17
+	.long	.LASF4233
+	.byte	0x14
+	.long	.LASF4234
+	.byte	0x14
+	.long	.LASF4235
+	.byte	0x14
+	.long	.LASF4236
+	.byte	0x14
+	.long	.LASF4237
+	.byte	0x14
+	.long	.LASF4238
+	.byte	0x14
+	.long	.LASF4239
+	.byte	0x14
+	.long	.LASF4240
+	.byte	0x14
+	.long	.LASF4241
+	.byte	0x14
+	.long	.LASF4242
+	.byte	0x9
+	.long	.LASF4243
+	.byte	0x9
+	.long	.LASF4244
+	.byte	0xf
+	.long	.LASF4244
+	.byte	0x7
+	.long	.LASF4245
+	.byte	0x6
+	.long	.LASF4246
+	.byte	0x9
+	.long	.LASF4247
+	.byte	0xf
+	.long	.LASF4247
+	.byte	0x8
+	.long	.LASF4248
+	.byte	0xc
+	.long	.LASF4249
+	.byte	0xc
+	.long	.LASF4169
+	.byte	0x9
+	.long	.LASF4219
+	.byte	0xe
+	.long	.LASF4250
+	.byte	0x4
+	.long	.LASF4251
+	.byte	0x9
+	.long	.LASF4252
+	.byte	0xa
+	.long	.LASF4253
+	.byte	0x4
+	.long	.LASF4254
+	.byte	0xa
+	.long	.LASF4255
+	.byte	0x1
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1303:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2960:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF4079:
+	.string	"getConfigBatteryProfile"
+.LASF2048:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1705:
+	.string	"__DECL_SIMD_exp10l "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF3243:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF4100:
+	.string	"validateAndFixTargetConfig"
+.LASF2124:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF3257:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF2901:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF1787:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF3435:
+	.string	"DEBUG_RPM_FREQ"
+.LASF2748:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF1489:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF3971:
+	.string	"waypoint_radius"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1162:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF3477:
+	.string	"servoCenterPulse"
+.LASF3123:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF2520:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF1536:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF2926:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1769:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2826:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF1812:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF2141:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF3054:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF1367:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF3198:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF4025:
+	.string	"useFwNavYawControl"
+.LASF1605:
+	.string	"__DECL_SIMD_sinl "
+.LASF3034:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF1911:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF4042:
+	.string	"navigationUsePIDs"
+.LASF3445:
+	.string	"RGB_GREEN"
+.LASF4092:
+	.string	"validateAndFixConfig"
+.LASF1921:
+	.string	"_Mdouble_ float"
+.LASF2177:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF3794:
+	.string	"rcFilterFrequency"
+.LASF3385:
+	.string	"long unsigned int"
+.LASF2645:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1115:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF3102:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF2579:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1606:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF3425:
+	.string	"DEBUG_ALWAYS"
+.LASF3210:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF3679:
+	.string	"OSD_POWER"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1975:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2339:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF2612:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF1191:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF3357:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1402:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1394:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3450:
+	.string	"enabledFeatures"
+.LASF3444:
+	.string	"RGB_RED"
+.LASF2711:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF3207:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF3328:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF1325:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2295:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF3530:
+	.string	"OWNER_1WIRE"
+.LASF2178:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF3643:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF3772:
+	.string	"RX_TYPE_MSP"
+.LASF3644:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF2971:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF995:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1659:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF3880:
+	.string	"current_profile_index"
+.LASF1092:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF1712:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2487:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF2082:
+	.string	"LON 1"
+.LASF1596:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF3406:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF3900:
+	.string	"adcChannelConfig_Copy"
+.LASF3271:
+	.string	"SETTING_SIM_PIN 348"
+.LASF2459:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF2275:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF3439:
+	.string	"DEBUG_IRLOCK"
+.LASF2611:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF2437:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF3082:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF3531:
+	.string	"OWNER_AIRSPEED"
+.LASF1385:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2893:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF3052:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF3266:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF3647:
+	.string	"serialPortConfig_s"
+.LASF3761:
+	.string	"OSD_GFORCE_X"
+.LASF3762:
+	.string	"OSD_GFORCE_Y"
+.LASF3763:
+	.string	"OSD_GFORCE_Z"
+.LASF1013:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1742:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1654:
+	.string	"__DECL_SIMD_acosf "
+.LASF3801:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1121:
+	.string	"MAX_INPUTS 8"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1682:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF3784:
+	.string	"spektrum_sat_bind"
+.LASF2183:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2442:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF2887:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF2225:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF2066:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1803:
+	.string	"__DECL_SIMD_acosh "
+.LASF1010:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF3027:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF4027:
+	.string	"navConfig_s"
+.LASF4029:
+	.string	"navConfig_t"
+.LASF2650:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF3663:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF2726:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF2123:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1663:
+	.string	"__DECL_SIMD_atan "
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2497:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF3259:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF3115:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF937:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2230:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF2425:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF2762:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF2872:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF3594:
+	.string	"gyroADCf"
+.LASF3041:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF2063:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1436:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF3160:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF2358:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2617:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF1953:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF3539:
+	.string	"RESOURCE_IO"
+.LASF1395:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2408:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF2792:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF2194:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF3834:
+	.string	"PID_POS_HEADING"
+.LASF4105:
+	.string	"navConfig"
+.LASF1967:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1617:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2229:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF1699:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1105:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF2475:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF3751:
+	.string	"OSD_TEMP_SENSOR_3_TEMPERATURE"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1428:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2131:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF3886:
+	.string	"name"
+.LASF1973:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF963:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1575:
+	.string	"DEF_TIM_OUTPUT(ch) DEF_TIM_OUTPUT__ ## ch"
+.LASF2321:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF2429:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF2445:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF3230:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF3498:
+	.string	"OWNER_FREE"
+.LASF1153:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2011:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF2691:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF3535:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF3795:
+	.string	"mspOverrideChannels"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1902:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF2282:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF3461:
+	.string	"failureMode_e"
+.LASF2101:
+	.string	"OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)"
+.LASF1406:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF3929:
+	.string	"BOXLIGHTS"
+.LASF1320:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF4066:
+	.string	"featureClear"
+.LASF2238:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF2355:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF2979:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF1652:
+	.string	"__DECL_SIMD_powf128x "
+.LASF943:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2336:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF2074:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF2785:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF1552:
+	.string	"DEF_TIM_DMAMAP_VARIANT__0(_0,...) _0"
+.LASF1550:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF2386:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF3609:
+	.string	"gyro_stage2_lowpass_type"
+.LASF3548:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2899:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF1832:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1159:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2994:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF2977:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF2302:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF4045:
+	.string	"accInitFilters"
+.LASF986:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1278:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2624:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF1984:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF3304:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF1672:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2604:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF1251:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2303:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF2337:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF3318:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF2821:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF2987:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF2059:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF3280:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF2844:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF3049:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF3240:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF1341:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF3920:
+	.string	"BOXHEADINGHOLD"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF3680:
+	.string	"OSD_GPS_LON"
+.LASF1655:
+	.string	"__DECL_SIMD_acosl "
+.LASF1138:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF2929:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF2382:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF3612:
+	.string	"dynamicGyroNotchMinHz"
+.LASF3026:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF1948:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2657:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF3300:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF2633:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF1831:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1513:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2716:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF3315:
+	.string	"SETTING_NAME_MAX 16"
+.LASF2421:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF2332:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF3141:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF3084:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1664:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2492:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF1538:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF3402:
+	.string	"uint32_t"
+.LASF1161:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1545:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2100:
+	.string	"OSD_VISIBLE_FLAG 0x0800"
+.LASF2477:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF2959:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF4051:
+	.string	"activateControlRateConfig"
+.LASF1274:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1350:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2790:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF3092:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF1607:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2127:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1087:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF1746:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2210:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1069:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2171:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF3674:
+	.string	"OSD_GPS_SATS"
+.LASF2526:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF1061:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF3120:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF1519:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1337:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1431:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1022:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1205:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF3312:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF4019:
+	.string	"launch_timeout"
+.LASF3839:
+	.string	"ADC_AIRSPEED"
+.LASF3982:
+	.string	"rth_home_altitude"
+.LASF1897:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1316:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1109:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF3201:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF3744:
+	.string	"OSD_MC_POS_XYZ_P_OUTPUTS"
+.LASF1597:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2853:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF2113:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1057:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1710:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF1994:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF3020:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF1312:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1884:
+	.string	"__f32(x) x ##f32"
+.LASF2886:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF1543:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF1922:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1418:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF3078:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF3733:
+	.string	"OSD_MANUAL_ROLL_RATE"
+.LASF3008:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF3369:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF3329:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF3310:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF1006:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1247:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2582:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF2409:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF3381:
+	.string	"SECOND_PORT_INDEX 1"
+.LASF1146:
+	.string	"BIT(x) (1 << (x))"
+.LASF1565:
+	.string	"BTCH_TIM1_CH2N BTCH_TIM1_CH2"
+.LASF2712:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF1766:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1603:
+	.string	"__DECL_SIMD_sin "
+.LASF3540:
+	.string	"RESOURCE_TIMER"
+.LASF2536:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF3134:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF1577:
+	.string	"DEF_TIM_OUTPUT__CH2 (TIMER_OUTPUT_NONE)"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1904:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2738:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF1445:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2732:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF4032:
+	.string	"featureConfig_Registry"
+.LASF3665:
+	.string	"OSD_ONTIME"
+.LASF3045:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF1168:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1773:
+	.string	"__DECL_SIMD_log2 "
+.LASF1630:
+	.string	"__DECL_SIMD_logf32x "
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF2909:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF4075:
+	.string	"beeperOffSet"
+.LASF1602:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1381:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2869:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF3735:
+	.string	"OSD_NAV_FW_CRUISE_THR"
+.LASF2428:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF2383:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF3360:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF2149:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF3922:
+	.string	"BOXHEADADJ"
+.LASF2884:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF2255:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF4091:
+	.string	"applyAndSaveBoardAlignmentDelta"
+.LASF2861:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+.LASF2471:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2265:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2653:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF2718:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF2544:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2638:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF2723:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF2631:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF3660:
+	.string	"OSD_RSSI_VALUE"
+.LASF3954:
+	.string	"BOXUSER2"
+.LASF3991:
+	.string	"braking_speed_threshold"
+.LASF1982:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF3764:
+	.string	"OSD_RC_SOURCE"
+.LASF1285:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2564:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF1358:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1791:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF3050:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2805:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF2326:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF1517:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF3959:
+	.string	"use_thr_mid_for_althold"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1894:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF3975:
+	.string	"max_manual_speed"
+.LASF2202:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF2532:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF3212:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF1432:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF976:
+	.string	"HSV_VALUE_MAX 255"
+.LASF2287:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF3248:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF3967:
+	.string	"rth_climb_ignore_emerg"
+.LASF2562:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF3235:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF2157:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2344:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF2508:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF1152:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF2341:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF1703:
+	.string	"__DECL_SIMD_exp10 "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2438:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF1066:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF3088:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF3153:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2128:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF2635:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF1954:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2369:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF3614:
+	.string	"dynamicGyroNotchAnalyser"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF2767:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF3512:
+	.string	"OWNER_I2C"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF3190:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF3559:
+	.string	"I2C_SPEED_400KHZ"
+.LASF1868:
+	.string	"__f128(x) x ##f128"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF2474:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF1534:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF3181:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2279:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3411:
+	.string	"size"
+.LASF1997:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF2448:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF1416:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF3142:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF3683:
+	.string	"OSD_HOME_DIST"
+.LASF3409:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF3127:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF2029:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF2351:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF2085:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1709:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF3566:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF1483:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1145:
+	.string	"UNUSED(x) (void)(x)"
+.LASF2249:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF1972:
+	.string	"M_E 2.7182818284590452354"
+.LASF2449:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF3473:
+	.string	"motorPoleCount"
+.LASF2313:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF3458:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF1568:
+	.string	"BTCH_TIM8_CH2N BTCH_TIM8_CH2"
+.LASF1837:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF2746:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF3204:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF4043:
+	.string	"pidInit"
+.LASF2025:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2687:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2951:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3239:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF1268:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF4071:
+	.string	"getBeeperOffMask"
+.LASF1786:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2088:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2218:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF1628:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2065:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF2813:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF3926:
+	.string	"BOXMANUAL"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1123:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF3269:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF2343:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF3110:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF3819:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1629:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2144:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF2509:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF3945:
+	.string	"BOXCAMERA1"
+.LASF553:
+	.string	"__stub_stty "
+.LASF3947:
+	.string	"BOXCAMERA3"
+.LASF3492:
+	.string	"PWM_TYPE_DSHOT600"
+.LASF2367:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2815:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF3012:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF1100:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF3187:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF3962:
+	.string	"rth_alt_control_mode"
+.LASF3578:
+	.string	"CW90_DEG"
+.LASF3288:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF3791:
+	.string	"maxcheck"
+.LASF2454:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1180:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2610:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF2724:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF3449:
+	.string	"featureConfig_s"
+.LASF3451:
+	.string	"featureConfig_t"
+.LASF2002:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF3483:
+	.string	"servoConfig_t"
+.LASF2728:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF892:
+	.string	"USE_VCP"
+.LASF2385:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF1230:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF969:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF3316:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF2740:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF2015:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF933:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF3780:
+	.string	"halfDuplex"
+.LASF2488:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2315:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF721:
+	.string	"__need_NULL"
+.LASF1293:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2346:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF2608:
+	.string	"SETTING_YAW_RATE 127"
+.LASF1782:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1024:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1858:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1618:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1494:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2607:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF2614:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF4012:
+	.string	"launch_accel_thresh"
+.LASF2900:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF3133:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF3068:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF1017:
+	.string	"EEPROM_CONF_VERSION 127"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF1041:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF4099:
+	.string	"targetConfiguration"
+.LASF1676:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2431:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF3194:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF1035:
+	.string	"PG_RX_CONFIG 24"
+.LASF1478:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1880:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF3965:
+	.string	"disarm_on_landing"
+.LASF3699:
+	.string	"OSD_EFFICIENCY_WH_PER_KM"
+.LASF3545:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2782:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF1767:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1179:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2055:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1371:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1796:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF3423:
+	.string	"DEBUG_SBUS"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1289:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2996:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF1386:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1947:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2116:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1172:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF2296:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF3185:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF2676:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2072:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF2776:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2156:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1656:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF3267:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF3536:
+	.string	"RESOURCE_NONE"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1019:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1263:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF3317:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF3171:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF1579:
+	.string	"DEF_TIM_OUTPUT__CH4 (TIMER_OUTPUT_NONE)"
+.LASF3952:
+	.string	"BOXBRAKING"
+.LASF3507:
+	.string	"OWNER_PINDEBUG"
+.LASF1005:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF2073:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF3925:
+	.string	"BOXNAVPOSHOLD"
+.LASF2860:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF1504:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2348:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF4024:
+	.string	"allow_manual_thr_increase"
+.LASF2778:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF3501:
+	.string	"OWNER_PPMINPUT"
+.LASF1267:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF2878:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF1555:
+	.string	"DEF_TIM_CHNL_CH1 0"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF3129:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2505:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF1980:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF3980:
+	.string	"emerg_descent_rate"
+.LASF3667:
+	.string	"OSD_FLYMODE"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF3069:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF2523:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF3103:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF3174:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF3025:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF1305:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1219:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2068:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1914:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF4069:
+	.string	"setBeeperOffMask"
+.LASF3752:
+	.string	"OSD_TEMP_SENSOR_4_TEMPERATURE"
+.LASF1496:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2401:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF3846:
+	.string	"ADC_CHN_MAX"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1093:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF4081:
+	.string	"setConfigProfile"
+.LASF3223:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF3457:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF2263:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF3113:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF1217:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF3454:
+	.string	"FAILURE_DEVELOPER"
+.LASF2670:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF1417:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF3344:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF2936:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF3197:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF2342:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF3747:
+	.string	"OSD_BARO_TEMPERATURE"
+.LASF1096:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF3998:
+	.string	"braking_bank_angle"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1055:
+	.string	"PG_INAV_START 1000"
+.LASF1213:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2253:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF2353:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF2387:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF1321:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF3430:
+	.string	"DEBUG_SMARTAUDIO"
+.LASF3697:
+	.string	"OSD_BATTERY_REMAINING_CAPACITY"
+.LASF4050:
+	.string	"activateBatteryProfile"
+.LASF3437:
+	.string	"DEBUG_DYNAMIC_FILTER"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2881:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF1866:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2534:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF2698:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1444:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF4014:
+	.string	"launch_idle_throttle"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1834:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1409:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1650:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1620:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF747:
+	.string	"USE_PITOT "
+.LASF981:
+	.string	"sq(x) ((x)*(x))"
+.LASF3841:
+	.string	"ADC_CHN_NONE"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2102:
+	.string	"OSD_POS(x,y) ((x) | ((y) << 5))"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3481:
+	.string	"servo_protocol"
+.LASF3895:
+	.string	"beeperConfig_Copy"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1389:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2174:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF3494:
+	.string	"PWM_TYPE_SERIALSHOT"
+.LASF1182:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF4118:
+	.string	"servoConfig"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1744:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF3471:
+	.string	"throttleIdle"
+.LASF3075:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF3215:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF2078:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2273:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF3388:
+	.string	"__uint8_t"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1259:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF2021:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2552:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF3270:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF3149:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF1811:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF719:
+	.string	"NULL"
+.LASF1357:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF3940:
+	.string	"BOXSURFACE"
+.LASF3693:
+	.string	"OSD_THROTTLE_POS_AUTO_THR"
+.LASF2260:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1288:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF3125:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF2654:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF2807:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF3023:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF3885:
+	.string	"throttle_tilt_compensation_strength"
+.LASF3723:
+	.string	"OSD_BOARD_ALIGN_PITCH"
+.LASF1836:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF376:
+	.string	"unix 1"
+.LASF1188:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF857:
+	.string	"USE_MAG "
+.LASF2820:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1074:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF2777:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF1826:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2405:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF1301:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2863:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF2254:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF2162:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF2799:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF3678:
+	.string	"OSD_YAW_PIDS"
+.LASF4065:
+	.string	"isSerialConfigValid"
+.LASF3079:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF2198:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF967:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF3147:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF2032:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF953:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2946:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF2510:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF1029:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF3828:
+	.string	"PID_POS_XY"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF3596:
+	.string	"gyro"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1936:
+	.string	"_Mdouble_ _Float64x"
+.LASF1765:
+	.string	"__DECL_SIMD_log10l "
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1640:
+	.string	"__DECL_SIMD_expf32x "
+.LASF2587:
+	.string	"SETTING_TPA_RATE 120"
+.LASF1264:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3254:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1207:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2325:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF2006:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF2586:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF1464:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF3055:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF3094:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF1382:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2795:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF3960:
+	.string	"extra_arming_safety"
+.LASF1116:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2187:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1908:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF3196:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF3881:
+	.string	"current_battery_profile_index"
+.LASF3703:
+	.string	"OSD_MAP_NORTH"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF2483:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF2502:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF1404:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF2717:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF3988:
+	.string	"max_bank_angle"
+.LASF1677:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1585:
+	.string	"HARDWARE_TIMER_DEFINITION_COUNT 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1776:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1797:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF3150:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF3848:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2850:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF2071:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1706:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF2226:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF3157:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF3651:
+	.string	"gps_baudrateIndex"
+.LASF2967:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF3513:
+	.string	"OWNER_SDCARD"
+.LASF2616:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF2300:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1957:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2879:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF3918:
+	.string	"BOXHORIZON"
+.LASF1245:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1657:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2003:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF3521:
+	.string	"OWNER_LED_STRIP"
+.LASF1649:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1619:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF3774:
+	.string	"RX_TYPE_UIB"
+.LASF3628:
+	.string	"acc_notch_hz"
+.LASF3865:
+	.string	"FEATURE_DASHBOARD"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1433:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1127:
+	.string	"IOCFG_AF_OD 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF3279:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF3990:
+	.string	"auto_disarm_delay"
+.LASF2648:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF4087:
+	.string	"writeEEPROM"
+.LASF2688:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF2220:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF1683:
+	.string	"__DECL_SIMD_hypot "
+.LASF1335:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF1998:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF2223:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF3672:
+	.string	"OSD_MAH_DRAWN"
+.LASF3955:
+	.string	"BOXFPVANGLEMIX"
+.LASF2518:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF3884:
+	.string	"cpuUnderclock"
+.LASF3299:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF4052:
+	.string	"resumeRxSignal"
+.LASF2160:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1661:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2191:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2877:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF3091:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF1119:
+	.string	"PWM_TIMER_HZ 1000000"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1515:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2753:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF1722:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2690:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF3370:
+	.string	"NAV_BLACKBOX "
+.LASF1021:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF3258:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF3307:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF2132:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1835:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1383:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF4030:
+	.string	"navConfig_System"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1177:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1072:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF2662:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF4082:
+	.string	"getConfigProfile"
+.LASF3817:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF3380:
+	.string	"FIRST_PORT_INDEX 0"
+.LASF2384:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF3417:
+	.string	"timeUs_t"
+.LASF1186:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1728:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3016:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF1331:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF3788:
+	.string	"rssiMax"
+.LASF2835:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF3799:
+	.string	"ARMED"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF2727:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF1484:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2482:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1537:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF3608:
+	.string	"gyro_stage2_lowpass_hz"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1716:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1241:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2663:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2692:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2450:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF3587:
+	.string	"initialized"
+.LASF2761:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF1514:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1943:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF4006:
+	.string	"min_throttle"
+.LASF3275:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF1558:
+	.string	"DEF_TIM_CHNL_CH2N 1"
+.LASF2168:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF3517:
+	.string	"OWNER_OSD"
+.LASF3422:
+	.string	"DEBUG_FLOW"
+.LASF2422:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF971:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF2081:
+	.string	"LAT 0"
+.LASF2083:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2196:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF2559:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF2875:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF1243:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF3755:
+	.string	"OSD_TEMP_SENSOR_7_TEMPERATURE"
+.LASF1648:
+	.string	"__DECL_SIMD_powf64 "
+.LASF3262:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF2456:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF2259:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF959:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF3006:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF1067:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1639:
+	.string	"__DECL_SIMD_expf128 "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2913:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF3823:
+	.string	"armingFlags"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1359:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF2430:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF1210:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2641:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF2714:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF3712:
+	.string	"OSD_CRUISE_HEADING_ADJUSTMENT"
+.LASF1588:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF3706:
+	.string	"OSD_WIND_SPEED_HORIZONTAL"
+.LASF3871:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF2022:
+	.string	"GYRO_LPF_NONE 7"
+.LASF3616:
+	.string	"kalman_q"
+.LASF3617:
+	.string	"kalman_w"
+.LASF3024:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF1693:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1879:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF1701:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF3056:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF1150:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF2683:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1686:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1917:
+	.string	"_Mdouble_"
+.LASF3914:
+	.string	"AUX11"
+.LASF3915:
+	.string	"AUX12"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1468:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF3941:
+	.string	"BOXFLAPERON"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1460:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2953:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF2989:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF2862:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+.LASF1572:
+	.string	"BTCH_TIM20_CH3N BTCH_TIM20_CH3"
+.LASF1637:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2551:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF1192:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1275:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2042:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1053:
+	.string	"PG_CF_END 56"
+.LASF2578:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF3591:
+	.string	"sampleBufferActive"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF3510:
+	.string	"OWNER_SYSTEM"
+.LASF1000:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF3416:
+	.string	"timeDelta_t"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF3564:
+	.string	"SENSOR_INDEX_MAG"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF3086:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF1039:
+	.string	"PG_GPS_CONFIG 30"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1240:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1559:
+	.string	"DEF_TIM_CHNL_CH3 2"
+.LASF1702:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF3899:
+	.string	"adcChannelConfig_System"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF4115:
+	.string	"gyroConfigMutable"
+.LASF3224:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF3798:
+	.string	"rxConfig_System"
+.LASF3126:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF2115:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2000:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF4064:
+	.string	"pgResetCopy"
+.LASF1794:
+	.string	"__DECL_SIMD_atanhf "
+.LASF3022:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1730:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF2707:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2829:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF3734:
+	.string	"OSD_MANUAL_YAW_RATE"
+.LASF1058:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF2533:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF3888:
+	.string	"systemConfig_System"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF2935:
+	.string	"SETTING_PID_TYPE 236"
+.LASF2435:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF3131:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF2545:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF1938:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1082:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF3894:
+	.string	"beeperConfig_System"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1487:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2858:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2462:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF1008:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2109:
+	.string	"OSD_HOMING_LIM_H3 38"
+.LASF2380:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF2823:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF1505:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF3452:
+	.string	"featureConfig_System"
+.LASF1828:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF914:
+	.string	"NOINLINE "
+.LASF1160:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1408:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF3592:
+	.string	"lastSampleTimeUs"
+.LASF2917:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF1839:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1154:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1317:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3633:
+	.string	"SERIAL_PORT_NONE"
+.LASF1490:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF3671:
+	.string	"OSD_CURRENT_DRAW"
+.LASF3736:
+	.string	"OSD_NAV_FW_PITCH2THR"
+.LASF2537:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF1183:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF3773:
+	.string	"RX_TYPE_SPI"
+.LASF3503:
+	.string	"OWNER_SERVO"
+.LASF3345:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF4125:
+	.string	"rc_alias"
+.LASF3634:
+	.string	"SERIAL_PORT_USART1"
+.LASF3635:
+	.string	"SERIAL_PORT_USART2"
+.LASF3636:
+	.string	"SERIAL_PORT_USART3"
+.LASF3637:
+	.string	"SERIAL_PORT_USART4"
+.LASF3638:
+	.string	"SERIAL_PORT_USART5"
+.LASF1923:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1915:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF3641:
+	.string	"SERIAL_PORT_USART8"
+.LASF2084:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF2948:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF3165:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1690:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1785:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2647:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF1874:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF3611:
+	.string	"dynamicGyroNotchQ"
+.LASF2972:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF3193:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1400:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2902:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF1248:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF3986:
+	.string	"rth_home_offset_distance"
+.LASF3855:
+	.string	"FEATURE_GPS"
+.LASF950:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2949:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1107:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF3935:
+	.string	"BOXNAVWP"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2962:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF2486:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2583:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF3716:
+	.string	"OSD_LEVEL_PIDS"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF4076:
+	.string	"setConfigBatteryProfileAndWriteEEPROM"
+.LASF2922:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF3151:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF2414:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF1330:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1271:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2890:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF1623:
+	.string	"__DECL_SIMD_log "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2968:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF3358:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF3004:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF3203:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF1104:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF3251:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF3529:
+	.string	"OWNER_TEMPERATURE"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF3923:
+	.string	"BOXCAMSTAB"
+.LASF3297:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF1206:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1668:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1043:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF960:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF2013:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF3946:
+	.string	"BOXCAMERA2"
+.LASF1643:
+	.string	"__DECL_SIMD_pow "
+.LASF1847:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF4072:
+	.string	"beeperOffClear"
+.LASF2600:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1065:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2120:
+	.string	"MIDRC_MAX 1700"
+.LASF2568:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF2216:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF3241:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF3682:
+	.string	"OSD_HOME_DIR"
+.LASF1034:
+	.string	"PG_IMU_CONFIG 22"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF1313:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF3031:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF2262:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2320:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF1983:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF3787:
+	.string	"rssiMin"
+.LASF4060:
+	.string	"parseRcChannels"
+.LASF2591:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF1374:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF2010:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF1419:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2897:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF3972:
+	.string	"waypoint_safe_distance"
+.LASF1717:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF3849:
+	.string	"FEATURE_VBAT"
+.LASF1287:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF3455:
+	.string	"FAILURE_MISSING_ACC"
+.LASF3891:
+	.string	"beeper_off_flags"
+.LASF3466:
+	.string	"motorPwmRate"
+.LASF2513:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF2615:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF1729:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2037:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF1720:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF3325:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2205:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF2801:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF2779:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF3583:
+	.string	"CW180_DEG_FLIP"
+.LASF3298:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF3391:
+	.string	"__uint16_t"
+.LASF3669:
+	.string	"OSD_THROTTLE_POS"
+.LASF3278:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF1971:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF3575:
+	.string	"double"
+.LASF3824:
+	.string	"PID_ROLL"
+.LASF1392:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF3753:
+	.string	"OSD_TEMP_SENSOR_5_TEMPERATURE"
+.LASF1738:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1480:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF3284:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF1106:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF2876:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF2842:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF3838:
+	.string	"ADC_CURRENT"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF3352:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF2444:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF3803:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF3943:
+	.string	"BOXAUTOTRIM"
+.LASF1050:
+	.string	"PG_VTX_CONFIG 54"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF2504:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF3293:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF2606:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF3156:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF3776:
+	.string	"receiverType"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF3917:
+	.string	"BOXANGLE"
+.LASF3831:
+	.string	"PID_LEVEL"
+.LASF1425:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1867:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF4085:
+	.string	"ensureEEPROMContainsValidData"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF4084:
+	.string	"saveConfigAndNotify"
+.LASF2417:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF3938:
+	.string	"BOXGCSNAV"
+.LASF3191:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF2613:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF1687:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2237:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF3552:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2354:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF3806:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF2574:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF2458:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF3650:
+	.string	"msp_baudrateIndex"
+.LASF3403:
+	.string	"uint64_t"
+.LASF787:
+	.string	"USE_CMS "
+.LASF2070:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF2185:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1689:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF2397:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF3597:
+	.string	"gyroConfig_s"
+.LASF1283:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2646:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF3046:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF2266:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF2846:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF3246:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF3255:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF3234:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF4044:
+	.string	"imuConfigure"
+.LASF1680:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1531:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2885:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF3095:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF1503:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF3263:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF4038:
+	.string	"setBatteryProfile"
+.LASF3030:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF4112:
+	.string	"serialConfigMutable"
+.LASF3790:
+	.string	"mincheck"
+.LASF2939:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF2517:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF3482:
+	.string	"tri_unarmed_servo"
+.LASF3350:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF1049:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1175:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF1988:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF3948:
+	.string	"BOXOSDALT1"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF3950:
+	.string	"BOXOSDALT3"
+.LASF1613:
+	.string	"__DECL_SIMD_sincos "
+.LASF2478:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF2955:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF2153:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF3857:
+	.string	"FEATURE_UNUSED_4"
+.LASF3691:
+	.string	"OSD_GPS_HDOP"
+.LASF3135:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF718:
+	.string	"__need_size_t"
+.LASF3874:
+	.string	"FEATURE_UNUSED_9"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF3610:
+	.string	"dynamicGyroNotchRange"
+.LASF2067:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF2713:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF1711:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF512:
+	.string	"__wur "
+.LASF349:
+	.string	"__amd64 1"
+.LASF1714:
+	.string	"__DECL_SIMD_coshf "
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF2794:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF2420:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF2854:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2033:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF2062:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF3083:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1780:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1511:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2763:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF957:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1014:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF3889:
+	.string	"systemConfig_Copy"
+.LASF3462:
+	.string	"_Bool"
+.LASF3999:
+	.string	"posDecelerationTime"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF3128:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2797:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF3446:
+	.string	"RGB_BLUE"
+.LASF2882:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1571:
+	.string	"BTCH_TIM20_CH2N BTCH_TIM20_CH2"
+.LASF2061:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF2699:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2592:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF1991:
+	.string	"SPIDEV_COUNT 4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2883:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF2525:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF3225:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF1777:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1112:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF1347:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF3338:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF2937:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF1719:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1063:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF2017:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1707:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF2495:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF1108:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF3714:
+	.string	"OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE"
+.LASF1631:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2468:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF3014:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF3901:
+	.string	"ROLL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1919:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF956:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2309:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF3121:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF3958:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF3276:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF1125:
+	.string	"IOCFG_OUT_OD 0"
+.LASF3137:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF1291:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2140:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1310:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF3067:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF3619:
+	.string	"kalmanEnabled"
+.LASF3985:
+	.string	"max_terrain_follow_altitude"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF4083:
+	.string	"beeperOffClearAll"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF3741:
+	.string	"OSD_MC_VEL_X_PID_OUTPUTS"
+.LASF1147:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1117:
+	.string	"MAX_MOTORS 12"
+.LASF1624:
+	.string	"__DECL_SIMD_logf "
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2760:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1194:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1171:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1459:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1451:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF3323:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF3048:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF2947:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF1306:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2555:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF3410:
+	.string	"pgResetFunc"
+.LASF2747:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2684:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF2491:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF3567:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF3478:
+	.string	"servoPwmRate"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF3607:
+	.string	"gyro_notch_cutoff"
+.LASF2921:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF1899:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2666:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF1854:
+	.string	"__DECL_SIMD_tanf "
+.LASF4046:
+	.string	"accSetCalibrationValues"
+.LASF3689:
+	.string	"OSD_RTC_TIME"
+.LASF3464:
+	.string	"maxthrottle"
+.LASF3221:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF2802:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF3253:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1532:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF396:
+	.string	"false 0"
+.LASF3642:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF1679:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2988:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF2479:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF3429:
+	.string	"DEBUG_REM_FLIGHT_TIME"
+.LASF3808:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF2634:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF1600:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1819:
+	.string	"__DECL_SIMD_erff128 "
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF3228:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF2803:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF3590:
+	.string	"pidProcessDenom"
+.LASF3694:
+	.string	"OSD_HEADING_GRAPH"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1364:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2264:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF3600:
+	.string	"gyroSync"
+.LASF2928:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF2005:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF2091:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF4088:
+	.string	"readEEPROM"
+.LASF2350:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2184:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF3421:
+	.string	"DEBUG_FLOW_RAW"
+.LASF1157:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1218:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3005:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF1901:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF2347:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF2775:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF3859:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1075:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF2731:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF3327:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF4070:
+	.string	"mask"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2804:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF3337:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF1399:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2356:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF2743:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF1542:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1823:
+	.string	"__DECL_SIMD_tanh "
+.LASF3286:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1413:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2570:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF3424:
+	.string	"DEBUG_FPORT"
+.LASF2880:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1995:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF3569:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF2798:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF1778:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2434:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF2106:
+	.string	"OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)"
+.LASF1176:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2924:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF2590:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF2565:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1260:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF2412:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1979:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF3377:
+	.string	"RSSI_ADC_CHANNEL ADC_CHN_NONE"
+.LASF1184:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1391:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3681:
+	.string	"OSD_GPS_LAT"
+.LASF1845:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1149:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1715:
+	.string	"__DECL_SIMD_coshl "
+.LASF1078:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2023:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF3613:
+	.string	"dynamicGyroNotchEnabled"
+.LASF1169:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2046:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF3729:
+	.string	"OSD_YAW_RATE"
+.LASF358:
+	.string	"__k8 1"
+.LASF3989:
+	.string	"hover_throttle"
+.LASF2136:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF2129:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2811:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1956:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2075:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF1881:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2649:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2484:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF1239:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3933:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2839:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF3295:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF3812:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF3105:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF2104:
+	.string	"OSD_Y(x) (((x) >> 5) & 0x001F)"
+.LASF3306:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF2207:
+	.string	"BOXID_NONE 255"
+.LASF3533:
+	.string	"OWNER_PINIO"
+.LASF2915:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF3349:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1329:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1379:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2720:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF973:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1781:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF2481:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF3322:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF982:
+	.string	"FAST_MATH "
+.LASF1779:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF3738:
+	.string	"OSD_DEBUG"
+.LASF4101:
+	.string	"validateNavConfig"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF3659:
+	.string	"serialConfig_System"
+.LASF4123:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF2584:
+	.string	"SETTING_THR_EXPO 119"
+.LASF1302:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2284:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2679:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF3265:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF3821:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF3710:
+	.string	"OSD_HOME_HEADING_ERROR"
+.LASF3387:
+	.string	"__int8_t"
+.LASF3205:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF972:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF1753:
+	.string	"__DECL_SIMD_atan2 "
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF1912:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF987:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF3939:
+	.string	"BOXKILLSWITCH"
+.LASF1214:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2501:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1625:
+	.string	"__DECL_SIMD_logl "
+.LASF2828:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1599:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1891:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1892:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF2705:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF1626:
+	.string	"__DECL_SIMD_logf16 "
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2089:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF3963:
+	.string	"rth_climb_first"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1865:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1235:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1047:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2706:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF1855:
+	.string	"__DECL_SIMD_tanl "
+.LASF941:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF3343:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF3555:
+	.string	"RESOURCE_RX_CE"
+.LASF2335:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF1103:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF2053:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF1430:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2112:
+	.string	"OSD_HOMING_LIM_V3 15"
+.LASF2133:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2439:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF1256:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1003:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1349:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF3685:
+	.string	"OSD_VARIO"
+.LASF3869:
+	.string	"FEATURE_TRANSPONDER"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2651:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2549:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF2009:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF1863:
+	.string	"_BITS_FLOATN_H "
+.LASF1495:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2393:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF3087:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF3282:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF1732:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF2931:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1037:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF2553:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF2024:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF4053:
+	.string	"failureMode"
+.LASF1520:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF3333:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF1481:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1163:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF3942:
+	.string	"BOXTURNASSIST"
+.LASF1491:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1960:
+	.string	"FP_ZERO 2"
+.LASF2134:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1582:
+	.string	"DEF_TIM_OUTPUT__CH3N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF3314:
+	.string	"SETTING_NAME_MIN 0"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1674:
+	.string	"__DECL_SIMD_asinf "
+.LASF1856:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1616:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF3700:
+	.string	"OSD_TRIP_DIST"
+.LASF2040:
+	.string	"LED_MODE_COUNT 6"
+.LASF3557:
+	.string	"I2C_SPEED_100KHZ"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF3853:
+	.string	"FEATURE_UNUSED_1"
+.LASF2292:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF3856:
+	.string	"FEATURE_UNUSED_3"
+.LASF3858:
+	.string	"FEATURE_TELEMETRY"
+.LASF3861:
+	.string	"FEATURE_UNUSED_5"
+.LASF3862:
+	.string	"FEATURE_UNUSED_6"
+.LASF3866:
+	.string	"FEATURE_UNUSED_7"
+.LASF3873:
+	.string	"FEATURE_UNUSED_8"
+.LASF1853:
+	.string	"__DECL_SIMD_tan "
+.LASF3983:
+	.string	"min_rth_distance"
+.LASF1976:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF3245:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF1030:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2831:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF2675:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF2376:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF2725:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF4036:
+	.string	"pgResetTemplate_adcChannelConfig"
+.LASF1167:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1368:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF3508:
+	.string	"OWNER_TIMER"
+.LASF2622:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF1129:
+	.string	"IOCFG_IPU 0"
+.LASF3588:
+	.string	"targetLooptime"
+.LASF998:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3863:
+	.string	"FEATURE_RSSI_ADC"
+.LASF3434:
+	.string	"DEBUG_RPM_FILTER"
+.LASF1044:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF3603:
+	.string	"gyro_soft_lpf_hz"
+.LASF3580:
+	.string	"CW270_DEG"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2172:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF3469:
+	.string	"motorDecelTimeMs"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2500:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF2825:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1070:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF3771:
+	.string	"RX_TYPE_SERIAL"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1848:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1068:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1216:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2812:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF2188:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2236:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF2064:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF3066:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF2138:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF2190:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF3096:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF1510:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF3100:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF1651:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1621:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1963:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1502:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1574:
+	.string	"BTCH_TIM16_CH1N BTCH_TIM16_CH1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF2293:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1591:
+	.string	"_MATH_H 1"
+.LASF1864:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2121:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1578:
+	.string	"DEF_TIM_OUTPUT__CH3 (TIMER_OUTPUT_NONE)"
+.LASF1927:
+	.string	"_Mdouble_ _Float32"
+.LASF966:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2599:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF1833:
+	.string	"__DECL_SIMD_asinh "
+.LASF3173:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF3247:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF1336:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3934:
+	.string	"BOXFAILSAFE"
+.LASF1001:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF3154:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2239:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF2864:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF3754:
+	.string	"OSD_TEMP_SENSOR_6_TEMPERATURE"
+.LASF2640:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF3677:
+	.string	"OSD_PITCH_PIDS"
+.LASF1062:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF3383:
+	.string	"short unsigned int"
+.LASF3684:
+	.string	"OSD_HEADING"
+.LASF1932:
+	.string	"_Mdouble_ _Float128"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF992:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1246:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2331:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF2669:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF1004:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1501:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1692:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1315:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2569:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF1800:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF3618:
+	.string	"kalman_sharpness"
+.LASF2317:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF1770:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF3890:
+	.string	"beeperConfig_s"
+.LASF3893:
+	.string	"beeperConfig_t"
+.LASF997:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF2182:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2464:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF2280:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF3456:
+	.string	"FAILURE_ACC_INIT"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF3389:
+	.string	"__int16_t"
+.LASF1196:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2057:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF2257:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF3443:
+	.string	"DEBUG_COUNT"
+.LASF2152:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1079:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3018:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF1945:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2424:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF2970:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2419:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3291:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1450:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1366:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1442:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF3860:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF3097:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2035:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1783:
+	.string	"__DECL_SIMD_log1p "
+.LASF3428:
+	.string	"DEBUG_CRUISE"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF3161:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2151:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1641:
+	.string	"__DECL_SIMD_expf64x "
+.LASF3061:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2816:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF3101:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF2372:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2941:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF4021:
+	.string	"launch_climb_angle"
+.LASF2575:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF3426:
+	.string	"DEBUG_SAG_COMP_VOLTAGE"
+.LASF1959:
+	.string	"FP_INFINITE 1"
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2451:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF2245:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF3504:
+	.string	"OWNER_SOFTSERIAL"
+.LASF2702:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF3695:
+	.string	"OSD_EFFICIENCY_MAH_PER_KM"
+.LASF3448:
+	.string	"pgRegistry_s"
+.LASF3415:
+	.string	"pgRegistry_t"
+.LASF3080:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF1842:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1363:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1634:
+	.string	"__DECL_SIMD_expf "
+.LASF1930:
+	.string	"_Mdouble_ _Float64"
+.LASF3334:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF1355:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2598:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF3412:
+	.string	"address"
+.LASF3109:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF2515:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF4028:
+	.string	"general"
+.LASF2819:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF3532:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF3003:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF3400:
+	.string	"uint8_t"
+.LASF2056:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1872:
+	.string	"__HAVE_FLOAT32 1"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1281:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1204:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF3292:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF3878:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF3476:
+	.string	"servoConfig_s"
+.LASF2808:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF2527:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF2406:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF3779:
+	.string	"serialrx_inverted"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3172:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF3813:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF4004:
+	.string	"cruise_speed"
+.LASF3728:
+	.string	"OSD_ROLL_RATE"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1375:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1882:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2984:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF2580:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2908:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF1089:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2407:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF4121:
+	.string	"activateConfig"
+.LASF1590:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF2324:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF2016:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF3268:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF3968:
+	.string	"auto_overrides_motor_stop"
+.LASF2361:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF2247:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1045:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF3487:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2764:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF3765:
+	.string	"OSD_VTX_POWER"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF2418:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF2147:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2051:
+	.string	"LED_POS_BITCNT 8"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1339:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2465:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF3913:
+	.string	"AUX10"
+.LASF3576:
+	.string	"ALIGN_DEFAULT"
+.LASF2983:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF1825:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1025:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF1857:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF2329:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF1272:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1893:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1361:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF3977:
+	.string	"land_descent_rate"
+.LASF3136:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF3711:
+	.string	"OSD_CRUISE_HEADING_ERROR"
+.LASF3447:
+	.string	"float"
+.LASF3076:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF1426:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF3029:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF1401:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF3582:
+	.string	"CW90_DEG_FLIP"
+.LASF2966:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF1841:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1277:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2027:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF3496:
+	.string	"SERVO_TYPE_SERVO_DRIVER"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF3382:
+	.string	"unsigned char"
+.LASF3226:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3835:
+	.string	"PID_ITEM_COUNT"
+.LASF3354:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF3036:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF1723:
+	.string	"__DECL_SIMD_expm1 "
+.LASF3742:
+	.string	"OSD_MC_VEL_Y_PID_OUTPUTS"
+.LASF2308:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF948:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF3493:
+	.string	"PWM_TYPE_DSHOT1200"
+.LASF1340:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF3995:
+	.string	"braking_boost_timeout"
+.LASF1203:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1941:
+	.string	"__MATHDECL"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1850:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2538:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF1802:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1314:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF962:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2981:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF2848:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF1258:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1691:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2173:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1231:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF3538:
+	.string	"RESOURCE_OUTPUT"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF3726:
+	.string	"OSD_THROTTLE_EXPO"
+.LASF4039:
+	.string	"setControlRateProfile"
+.LASF1469:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1226:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF3732:
+	.string	"OSD_MANUAL_PITCH_RATE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1698:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1903:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1477:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF4097:
+	.string	"getGyroLooptime"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF698:
+	.string	"__need_size_t "
+.LASF3830:
+	.string	"PID_SURFACE"
+.LASF2390:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF2142:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF1567:
+	.string	"BTCH_TIM8_CH1N BTCH_TIM8_CH1"
+.LASF3195:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF2781:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF3217:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF373:
+	.string	"linux 1"
+.LASF3864:
+	.string	"FEATURE_LED_STRIP"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2840:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF786:
+	.string	"USE_STATS "
+.LASF3463:
+	.string	"motorConfig_s"
+.LASF3474:
+	.string	"motorConfig_t"
+.LASF1818:
+	.string	"__DECL_SIMD_erff64 "
+.LASF955:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF3361:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF2910:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF4000:
+	.string	"posResponseExpo"
+.LASF1992:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF3829:
+	.string	"PID_VEL_XY"
+.LASF2620:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF3220:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF3757:
+	.string	"OSD_PLUS_CODE"
+.LASF2581:
+	.string	"SETTING_THR_MID 118"
+.LASF2682:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1073:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1569:
+	.string	"BTCH_TIM8_CH3N BTCH_TIM8_CH3"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF3527:
+	.string	"OWNER_SPI_PREINIT"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3116:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF4103:
+	.string	"_right1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF4094:
+	.string	"_right3"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF4096:
+	.string	"_right5"
+.LASF2457:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF3244:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF3074:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF3146:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1114:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2619:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF1528:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF3166:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF1576:
+	.string	"DEF_TIM_OUTPUT__CH1 (TIMER_OUTPUT_NONE)"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1540:
+	.string	"DMA_NONE (0)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2573:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF3842:
+	.string	"ADC_CHN_1"
+.LASF3843:
+	.string	"ADC_CHN_2"
+.LASF3844:
+	.string	"ADC_CHN_3"
+.LASF3845:
+	.string	"ADC_CHN_4"
+.LASF3379:
+	.string	"AIRSPEED_ADC_CHANNEL ADC_CHN_NONE"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2889:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2126:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2489:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1731:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF3526:
+	.string	"OWNER_VTX"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1126:
+	.string	"IOCFG_AF_PP 0"
+.LASF2814:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF1748:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF3072:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF1646:
+	.string	"__DECL_SIMD_powf16 "
+.LASF3414:
+	.string	"reset"
+.LASF2077:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF2563:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF935:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF3759:
+	.string	"OSD_MAP_REFERENCE"
+.LASF2312:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF4037:
+	.string	"adcChannelConfig_Registry"
+.LASF1556:
+	.string	"DEF_TIM_CHNL_CH1N 0"
+.LASF3605:
+	.string	"gyro_to_use"
+.LASF3143:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF1015:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2175:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF3756:
+	.string	"OSD_ALTITUDE_MSL"
+.LASF1199:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF2952:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF2391:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF3624:
+	.string	"acc_hardware"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1653:
+	.string	"__DECL_SIMD_acos "
+.LASF4059:
+	.string	"featureSet"
+.LASF2585:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF3040:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF3987:
+	.string	"rth_home_offset_direction"
+.LASF3252:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1466:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2974:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF2700:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2316:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF1563:
+	.string	"DEF_TIM_TCH2BTCH(timch) CONCAT(BTCH_, timch)"
+.LASF3593:
+	.string	"sampleDeltaTimeUs"
+.LASF1135:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2934:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF1671:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF3814:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1795:
+	.string	"__DECL_SIMD_atanhl "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF2868:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF4041:
+	.string	"writeConfigToEEPROM"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2950:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF1390:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1849:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2810:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF2169:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF3261:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF2256:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1493:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2547:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF4054:
+	.string	"isEEPROMContentValid"
+.LASF1678:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF3348:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF2108:
+	.string	"OSD_HOMING_LIM_H2 16"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2602:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF1122:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF3192:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF2044:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2125:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF3366:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF3724:
+	.string	"OSD_RC_EXPO"
+.LASF3872:
+	.string	"FEATURE_VTX"
+.LASF1414:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF2766:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF3964:
+	.string	"rth_tail_first"
+.LASF3290:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF1033:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1535:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2330:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF4113:
+	.string	"accelerometerConfigMutable"
+.LASF3506:
+	.string	"OWNER_SERIAL"
+.LASF3520:
+	.string	"OWNER_INVERTER"
+.LASF3287:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF2176:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF2060:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF2416:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1324:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2485:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF3767:
+	.string	"OSD_ESC_TEMPERATURE"
+.LASF3211:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF3793:
+	.string	"rx_max_usec"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF1594:
+	.string	"__DECL_SIMD_cosf "
+.LASF3739:
+	.string	"OSD_FW_ALT_PID_OUTPUTS"
+.LASF3441:
+	.string	"DEBUG_KALMAN"
+.LASF1156:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1060:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1934:
+	.string	"_Mdouble_ _Float32x"
+.LASF2288:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF3704:
+	.string	"OSD_MAP_TAKEOFF"
+.LASF1189:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1198:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2215:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2304:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF3715:
+	.string	"OSD_POWER_SUPPLY_IMPEDANCE"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF4057:
+	.string	"pgActivateProfile"
+.LASF2413:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF2146:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF4040:
+	.string	"beeperConfirmationBeeps"
+.LASF1962:
+	.string	"FP_NORMAL 4"
+.LASF3009:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1580:
+	.string	"DEF_TIM_OUTPUT__CH1N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF4010:
+	.string	"land_dive_angle"
+.LASF1173:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2446:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF1136:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF2571:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF1925:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1026:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF3519:
+	.string	"OWNER_MPU"
+.LASF3393:
+	.string	"__uint32_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF3717:
+	.string	"OSD_POS_XY_PIDS"
+.LASF2843:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF1441:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2667:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF2601:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF1155:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1918:
+	.string	"__MATH_PRECNAME"
+.LASF1989:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2736:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1233:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1223:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF4031:
+	.string	"pgResetTemplate_featureConfig"
+.LASF3837:
+	.string	"ADC_RSSI"
+.LASF3916:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF3144:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF2392:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF2945:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF2398:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF3363:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF3692:
+	.string	"OSD_MAIN_BATT_CELL_VOLTAGE"
+.LASF1101:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1713:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2759:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF1429:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF3140:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1178:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1548:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1928:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF3277:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF2733:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF1970:
+	.string	"MATH_ERREXCEPT 2"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF3168:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF1612:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF4110:
+	.string	"rxConfigMutable"
+.LASF965:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1354:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1346:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3810:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1750:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1485:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2049:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF2195:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF2261:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF3720:
+	.string	"OSD_VEL_Z_PIDS"
+.LASF1040:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF4009:
+	.string	"loiter_radius"
+.LASF3500:
+	.string	"OWNER_PWMINPUT"
+.LASF3629:
+	.string	"acc_notch_cutoff"
+.LASF1292:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF3296:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF1666:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2943:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1871:
+	.string	"__HAVE_FLOAT16 0"
+.LASF3319:
+	.string	"SETTING_STATS 364"
+.LASF2076:
+	.string	"LED_XY_MASK 0x0F"
+.LASF2079:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2942:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF3570:
+	.string	"roll"
+.LASF1808:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF3283:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF2961:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF2566:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF984:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF3070:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF2528:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF1681:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2954:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF3903:
+	.string	"THROTTLE"
+.LASF3802:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF3042:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF3183:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1570:
+	.string	"BTCH_TIM20_CH1N BTCH_TIM20_CH1"
+.LASF3686:
+	.string	"OSD_VARIO_NUM"
+.LASF3219:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF2453:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF2674:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF3657:
+	.string	"reboot_character"
+.LASF3502:
+	.string	"OWNER_MOTOR"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF3851:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2973:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1564:
+	.string	"BTCH_TIM1_CH1N BTCH_TIM1_CH1"
+.LASF3937:
+	.string	"BOXHOMERESET"
+.LASF2203:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF2557:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1758:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF4077:
+	.string	"profileIndex"
+.LASF2627:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF1376:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2148:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1647:
+	.string	"__DECL_SIMD_powf32 "
+.LASF3981:
+	.string	"rth_altitude"
+.LASF3484:
+	.string	"servoConfig_System"
+.LASF2222:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF1083:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF3750:
+	.string	"OSD_TEMP_SENSOR_2_TEMPERATURE"
+.LASF3586:
+	.string	"gyro_s"
+.LASF3595:
+	.string	"gyro_t"
+.LASF1700:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF3547:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1009:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF3892:
+	.string	"preferred_beeper_off_flags"
+.LASF1736:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1896:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2655:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF3108:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF2561:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1566:
+	.string	"BTCH_TIM1_CH3N BTCH_TIM1_CH3"
+.LASF2980:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2099:
+	.string	"OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)"
+.LASF1342:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3833:
+	.string	"PID_VEL_Z"
+.LASF1422:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3966:
+	.string	"rth_allow_landing"
+.LASF1760:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1056:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF2039:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1694:
+	.string	"__DECL_SIMD_exp2f "
+.LASF2874:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF2519:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2976:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2923:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF4102:
+	.string	"_left0"
+.LASF1165:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF2231:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF1595:
+	.string	"__DECL_SIMD_cosl "
+.LASF2560:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF3372:
+	.string	"RADAR_MAX_POIS 5"
+.LASF3687:
+	.string	"OSD_AIR_SPEED"
+.LASF2363:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF3433:
+	.string	"DEBUG_ERPM"
+.LASF3573:
+	.string	"values"
+.LASF1427:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2461:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF3630:
+	.string	"acc_soft_lpf_type"
+.LASF2093:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF2389:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF3169:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF3098:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1215:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF3489:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1862:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF2576:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF1910:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF2357:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF1740:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1820:
+	.string	"__DECL_SIMD_erff32x "
+.LASF3549:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1134:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1111:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF3690:
+	.string	"OSD_MESSAGES"
+.LASF1098:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF3236:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF1372:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2328:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF2832:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2964:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF975:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1749:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2721:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF2686:
+	.string	"SETTING_DEADBAND 153"
+.LASF2975:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF1387:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF3107:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF942:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2297:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF1257:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2709:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF3696:
+	.string	"OSD_WH_DRAWN"
+.LASF3560:
+	.string	"I2C_SPEED_800KHZ"
+.LASF1985:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF3574:
+	.string	"flightDynamicsTrims_t"
+.LASF3740:
+	.string	"OSD_FW_POS_PID_OUTPUTS"
+.LASF3584:
+	.string	"CW270_DEG_FLIP"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF3997:
+	.string	"braking_boost_disengage_speed"
+.LASF974:
+	.string	"HSV_HUE_MAX 359"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF3670:
+	.string	"OSD_VTX_CHANNEL"
+.LASF1883:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2054:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF3051:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF2404:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF4109:
+	.string	"systemConfig"
+.LASF1827:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2891:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF2535:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF945:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1974:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF489:
+	.string	"__flexarr []"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1094:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF3870:
+	.string	"FEATURE_AIRMODE"
+.LASF2625:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF3376:
+	.string	"VBAT_ADC_CHANNEL ADC_CHN_NONE"
+.LASF3459:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF4020:
+	.string	"launch_max_altitude"
+.LASF3760:
+	.string	"OSD_GFORCE"
+.LASF1164:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3957:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF3351:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF2402:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1601:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1724:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1940:
+	.string	"__MATHDECL_ALIAS"
+.LASF4017:
+	.string	"launch_motor_spinup_time"
+.LASF1299:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3516:
+	.string	"OWNER_BEEPER"
+.LASF1636:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2597:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF2990:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1978:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1465:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2240:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF2020:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2594:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2531:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2286:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1300:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2529:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF2744:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF3786:
+	.string	"rssi_channel"
+.LASF2999:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF3727:
+	.string	"OSD_PITCH_RATE"
+.LASF2096:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF2472:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF3655:
+	.string	"serialConfig_s"
+.LASF3658:
+	.string	"serialConfig_t"
+.LASF1097:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2338:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF3490:
+	.string	"PWM_TYPE_DSHOT150"
+.LASF2769:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF3418:
+	.string	"DEBUG_NONE"
+.LASF3571:
+	.string	"pitch"
+.LASF2838:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF3249:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF2135:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2873:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2427:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF3038:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF4114:
+	.string	"accelerometerConfig"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1457:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1554:
+	.string	"DEF_TIM_DMAMAP_VARIANT__2(_0,_1,_2,...) _2"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2993:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF2730:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF2043:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF2661:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF1759:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2014:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF4003:
+	.string	"cruise_throttle"
+.LASF2314:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF1529:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1211:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1086:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF2757:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF2932:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF3743:
+	.string	"OSD_MC_VEL_Z_PID_OUTPUTS"
+.LASF3621:
+	.string	"gyroConfig_System"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF2362:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF1370:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF3748:
+	.string	"OSD_TEMP_SENSOR_0_TEMPERATURE"
+.LASF3725:
+	.string	"OSD_RC_YAW_EXPO"
+.LASF2161:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1455:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF3974:
+	.string	"max_auto_climb_rate"
+.LASF2539:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF3770:
+	.string	"RX_TYPE_PPM"
+.LASF2301:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF4026:
+	.string	"yawControlDeadband"
+.LASF1667:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2365:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF2396:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF3227:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF1492:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2554:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF4034:
+	.string	"systemConfig_Registry"
+.LASF3063:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1438:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1255:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3159:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1642:
+	.string	"__DECL_SIMD_expf128x "
+.LASF891:
+	.string	"USE_ADC"
+.LASF2660:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF1181:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2377:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF3324:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1405:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2978:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1253:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1415:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1695:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1752:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1739:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2789:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF3114:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF2907:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2012:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF2241:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF1298:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3374:
+	.string	"BRUSHED_MOTORS_PWM_RATE 16000"
+.LASF1338:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2783:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2665:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF3708:
+	.string	"OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH"
+.LASF1547:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF2473:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF2212:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF3436:
+	.string	"DEBUG_NAV_YAW"
+.LASF3979:
+	.string	"land_slowdown_maxalt"
+.LASF1955:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1124:
+	.string	"IOCFG_OUT_PP 0"
+.LASF4080:
+	.string	"setConfigProfileAndWriteEEPROM"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF3688:
+	.string	"OSD_ONTIME_FLYTIME"
+.LASF2745:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF1397:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1295:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF3709:
+	.string	"OSD_REMAINING_DISTANCE_BEFORE_RTH"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2145:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF3208:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF1737:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF3368:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF2411:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF3781:
+	.string	"rx_spi_protocol"
+.LASF3099:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF4098:
+	.string	"getLooptime"
+.LASF4033:
+	.string	"pgResetTemplate_systemConfig"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1113:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF2004:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF3820:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF3782:
+	.string	"rx_spi_id"
+.LASF1120:
+	.string	"PULSE_1MS (1000)"
+.LASF2896:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF1356:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF3111:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1523:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF3032:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF1052:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1225:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF3622:
+	.string	"accelerometerConfig_s"
+.LASF3631:
+	.string	"accelerometerConfig_t"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1244:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF3390:
+	.string	"short int"
+.LASF1942:
+	.string	"__MATHCALL"
+.LASF2636:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF1345:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1764:
+	.string	"__DECL_SIMD_log10f "
+.LASF2310:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF3976:
+	.string	"max_manual_climb_rate"
+.LASF4007:
+	.string	"max_throttle"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF3984:
+	.string	"rth_abort_threshold"
+.LASF1334:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2242:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF2399:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF3796:
+	.string	"rssi_source"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3775:
+	.string	"rxConfig_s"
+.LASF3797:
+	.string	"rxConfig_t"
+.LASF2197:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1144:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF2511:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF3534:
+	.string	"OWNER_IRLOCK"
+.LASF4035:
+	.string	"beeperConfig_Registry"
+.LASF1708:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF700:
+	.string	"__size_t__ "
+.LASF3919:
+	.string	"BOXNAVALTHOLD"
+.LASF3311:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF2092:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2703:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF2694:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF2618:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF1131:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2470:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF1229:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF3364:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF988:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2542:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF2349:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF3737:
+	.string	"OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1725:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1410:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF2991:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF2327:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF2895:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF2678:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF3002:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF1002:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF940:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF954:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2359:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF1977:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2982:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1423:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2130:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF2403:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF1754:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2506:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF476:
+	.string	"__P(args) args"
+.LASF3544:
+	.string	"RESOURCE_EXTI"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF944:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1032:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF3719:
+	.string	"OSD_VEL_XY_PIDS"
+.LASF3606:
+	.string	"gyro_notch_hz"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF4015:
+	.string	"launch_throttle"
+.LASF741:
+	.string	"USE_NAV "
+.LASF2415:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF2159:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF3598:
+	.string	"gyro_align"
+.LASF2155:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF3550:
+	.string	"RESOURCE_SPI_CS"
+.LASF1860:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF934:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2751:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF1890:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF3649:
+	.string	"identifier"
+.LASF2379:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2930:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF3028:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF1237:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1562:
+	.string	"DEF_TIM_CHNL_CH4N 3"
+.LASF2849:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF1344:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2773:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF3491:
+	.string	"PWM_TYPE_DSHOT300"
+.LASF4067:
+	.string	"getPreferredBeeperOffMask"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF3089:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF2206:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF4073:
+	.string	"beeperOffSetAll"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF2164:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1474:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2476:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF1023:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF3731:
+	.string	"OSD_MANUAL_RC_YAW_EXPO"
+.LASF2830:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF2426:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF383:
+	.string	"SITL 1"
+.LASF2603:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF2749:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF3273:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF3815:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF3281:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF1887:
+	.string	"__f64x(x) x ##f64x"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1012:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF3652:
+	.string	"peripheral_baudrateIndex"
+.LASF2318:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF2824:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF2179:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF4008:
+	.string	"pitch_to_throttle"
+.LASF3332:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF3827:
+	.string	"PID_POS_Z"
+.LASF2621:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF3342:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF970:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF3978:
+	.string	"land_slowdown_minalt"
+.LASF3932:
+	.string	"BOXTELEMETRY"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF2034:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF3927:
+	.string	"BOXBEEPERON"
+.LASF3623:
+	.string	"acc_align"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1133:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF3877:
+	.string	"FEATURE_OSD"
+.LASF2111:
+	.string	"OSD_HOMING_LIM_V2 10"
+.LASF2139:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF2629:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF2944:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2291:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF1516:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2809:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF3825:
+	.string	"PID_PITCH"
+.LASF3722:
+	.string	"OSD_BOARD_ALIGN_ROLL"
+.LASF1877:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1907:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1999:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF2774:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF2668:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF3956:
+	.string	"BOXLOITERDIRCHN"
+.LASF3581:
+	.string	"CW0_DEG_FLIP"
+.LASF3305:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF3497:
+	.string	"SERVO_TYPE_SBUS"
+.LASF3392:
+	.string	"__int32_t"
+.LASF1525:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF2514:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF1227:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1673:
+	.string	"__DECL_SIMD_asin "
+.LASF2927:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2905:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF3924:
+	.string	"BOXNAVRTH"
+.LASF2323:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF1801:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1059:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF3936:
+	.string	"BOXAIRMODE"
+.LASF2958:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF2997:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF3562:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2541:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF2227:
+	.string	"SETTING_LOOPTIME 0"
+.LASF1365:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF3646:
+	.string	"serialPortIdentifier_e"
+.LASF1987:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF1380:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2652:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF1905:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1421:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF3604:
+	.string	"gyro_soft_lpf_type"
+.LASF1968:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF3721:
+	.string	"OSD_HEADING_P"
+.LASF2672:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF3043:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF3931:
+	.string	"BOXOSD"
+.LASF3359:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF3698:
+	.string	"OSD_BATTERY_REMAINING_PERCENT"
+.LASF4117:
+	.string	"servoConfigMutable"
+.LASF4086:
+	.string	"resetEEPROM"
+.LASF3233:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF2632:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF3648:
+	.string	"functionMask"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF2322:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF2098:
+	.string	"OSD_ALTERNATE_LAYOUT_COUNT 3"
+.LASF1846:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF3440:
+	.string	"DEBUG_CD"
+.LASF1046:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2410:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF3868:
+	.string	"FEATURE_UNUSED_10"
+.LASF3875:
+	.string	"FEATURE_UNUSED_11"
+.LASF2378:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF1508:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1939:
+	.string	"__MATHDECL_1"
+.LASF2963:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF3313:
+	.string	"SETTING_NAME 362"
+.LASF1411:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2463:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF3178:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1610:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF3970:
+	.string	"pos_failure_timeout"
+.LASF2433:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF3189:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF3015:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF3007:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF1269:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1920:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF3059:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF2516:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF1557:
+	.string	"DEF_TIM_CHNL_CH2 1"
+.LASF2558:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF3001:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF2498:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF2333:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF3013:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1549:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF2770:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF3453:
+	.string	"featureConfig_Copy"
+.LASF4063:
+	.string	"constrain"
+.LASF3214:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF1202:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF3164:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF2659:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF3896:
+	.string	"adcChannelConfig_s"
+.LASF3898:
+	.string	"adcChannelConfig_t"
+.LASF1456:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2137:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF3930:
+	.string	"BOXNAVLAUNCH"
+.LASF1309:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1290:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2524:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF3847:
+	.string	"ADC_CHN_COUNT"
+.LASF2818:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF1755:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1200:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1276:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2639:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF1873:
+	.string	"__HAVE_FLOAT64 1"
+.LASF3480:
+	.string	"flaperon_throw_offset"
+.LASF1586:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF1966:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF2423:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF2969:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF1961:
+	.string	"FP_SUBNORMAL 3"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1311:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF2919:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF1064:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1965:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1889:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1546:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF3551:
+	.string	"RESOURCE_ADC_CH1"
+.LASF4048:
+	.string	"updateUsedModeActivationConditionFlags"
+.LASF3553:
+	.string	"RESOURCE_ADC_CH3"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2289:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF1592:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1635:
+	.string	"__DECL_SIMD_expl "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2512:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF1166:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2163:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2001:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF3563:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1448:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF3398:
+	.string	"int16_t"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF3170:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF4058:
+	.string	"pgResetAll"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2494:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF1662:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2167:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1369:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2158:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1743:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1608:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF1201:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF3992:
+	.string	"braking_disengage_speed"
+.LASF3766:
+	.string	"OSD_ESC_RPM"
+.LASF1990:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF3347:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF1132:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF2786:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF3250:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF3339:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF2685:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF3148:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF1265:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1804:
+	.string	"__DECL_SIMD_acoshf "
+.LASF3558:
+	.string	"I2C_SPEED_200KHZ"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1286:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF3850:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1644:
+	.string	"__DECL_SIMD_powf "
+.LASF3876:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF1762:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2765:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2796:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2214:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF3460:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF3626:
+	.string	"accZero"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1598:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1051:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF3792:
+	.string	"rx_min_usec"
+.LASF1916:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1929:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF3035:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF1261:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3021:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF2490:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF3768:
+	.string	"OSD_ITEM_COUNT"
+.LASF2192:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF2593:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF2114:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1665:
+	.string	"__DECL_SIMD_atanl "
+.LASF1745:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2122:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2189:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1553:
+	.string	"DEF_TIM_DMAMAP_VARIANT__1(_0,_1,...) _1"
+.LASF1933:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF3073:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF2758:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF2334:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF2443:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF1851:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2272:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF1348:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3800:
+	.string	"WAS_EVER_ARMED"
+.LASF699:
+	.string	"__need_NULL "
+.LASF1885:
+	.string	"__f64(x) x ##f64"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2780:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2154:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF4074:
+	.string	"beeperCount"
+.LASF3222:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF2400:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF1609:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF4111:
+	.string	"rxConfig"
+.LASF4016:
+	.string	"launch_motor_timer"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2507:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF1307:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF3804:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2119:
+	.string	"MIDRC_MIN 1200"
+.LASF1805:
+	.string	"__DECL_SIMD_acoshl "
+.LASF3106:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF3601:
+	.string	"looptime"
+.LASF1627:
+	.string	"__DECL_SIMD_logf32 "
+.LASF4002:
+	.string	"max_dive_angle"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF3335:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF1028:
+	.string	"PG_PID_PROFILE 14"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF3822:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF2623:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF3085:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2269:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF1875:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2276:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF3867:
+	.string	"FEATURE_BLACKBOX"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2026:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF3145:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF3777:
+	.string	"rcmap"
+.LASF1398:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3053:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF3749:
+	.string	"OSD_TEMP_SENSOR_1_TEMPERATURE"
+.LASF1090:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF2696:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF2319:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF3661:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1071:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF989:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF3537:
+	.string	"RESOURCE_INPUT"
+.LASF3200:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF2181:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1584:
+	.string	"CC_CHANNELS_PER_TIMER 4"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF4119:
+	.string	"motorConfigMutable"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF3365:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1088:
+	.string	"RX_SPI_MAX_PAYLOAD_SIZE 32"
+.LASF2234:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF2228:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF3229:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF4011:
+	.string	"launch_velocity_thresh"
+.LASF2768:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF2756:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF3039:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF1027:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF3556:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF1840:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF3033:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF3785:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF939:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF3431:
+	.string	"DEBUG_ACC"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF2817:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2298:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF3199:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF2305:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF2209:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1373:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF3495:
+	.string	"SERVO_TYPE_PWM"
+.LASF2432:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2166:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF2281:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF3523:
+	.string	"OWNER_RX"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF2503:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF2836:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF1696:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF4049:
+	.string	"resetAdjustmentStates"
+.LASF1252:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1870:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2283:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF2735:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF3019:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1273:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3620:
+	.string	"gyroConfig_t"
+.LASF3353:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF2345:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF1958:
+	.string	"FP_NAN 0"
+.LASF2244:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF1816:
+	.string	"__DECL_SIMD_erff16 "
+.LASF3058:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF2788:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF2094:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF2036:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF3386:
+	.string	"signed char"
+.LASF3017:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF2695:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2754:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF3778:
+	.string	"serialrx_provider"
+.LASF2031:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF3676:
+	.string	"OSD_ROLL_PIDS"
+.LASF2058:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF3303:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF2845:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF1424:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF3093:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF785:
+	.string	"USE_LOG "
+.LASF1187:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1645:
+	.string	"__DECL_SIMD_powl "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1632:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1054:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF2892:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF1142:
+	.string	"EXPAND_I(x) x"
+.LASF3274:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF3309:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF3071:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1944:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF952:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2998:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2395:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF3373:
+	.string	"RX_SPI_DEFAULT_PROTOCOL 0"
+.LASF3524:
+	.string	"OWNER_TX"
+.LASF3702:
+	.string	"OSD_ATTITUDE_ROLL"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF3994:
+	.string	"braking_boost_factor"
+.LASF2643:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF2658:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF3047:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF2090:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF1888:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1174:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2642:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF3675:
+	.string	"OSD_ALTITUDE"
+.LASF1792:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1993:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1937:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3179:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF1353:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF983:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF374:
+	.string	"__unix 1"
+.LASF2186:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1670:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF3486:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF932:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF2772:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF3479:
+	.string	"servo_lowpass_freq"
+.LASF1475:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1507:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2644:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1589:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2859:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF2755:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF3238:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF3010:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF2274:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF3653:
+	.string	"telemetry_baudrateIndex"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF996:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF3599:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF3260:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF3420:
+	.string	"DEBUG_AGL"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1242:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1886:
+	.string	"__f32x(x) x ##f32x"
+.LASF3302:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF3395:
+	.string	"__uint64_t"
+.LASF2030:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1193:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF3419:
+	.string	"DEBUG_GYRO"
+.LASF1931:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2857:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF2271:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF1499:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF3186:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF2912:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF2388:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF2047:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF3397:
+	.string	"int8_t"
+.LASF3705:
+	.string	"OSD_RADAR"
+.LASF2251:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF1332:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF3122:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF2143:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF1830:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1561:
+	.string	"DEF_TIM_CHNL_CH4 3"
+.LASF1420:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF2693:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1734:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1412:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1526:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1768:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF3231:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF1581:
+	.string	"DEF_TIM_OUTPUT__CH2N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF3565:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF3625:
+	.string	"acc_lpf_hz"
+.LASF3000:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF978:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF3180:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF3340:
+	.string	"SETTING_VTX_BAND 371"
+.LASF2252:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF1952:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1784:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1318:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2637:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF2050:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF3326:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF2742:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF1447:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1212:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1751:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF3627:
+	.string	"accGain"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF3656:
+	.string	"portConfigs"
+.LASF1328:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF3407:
+	.string	"PGR_SIZE_MASK"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF3928:
+	.string	"BOXLEDLOW"
+.LASF1909:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1143:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2270:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF1726:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF3394:
+	.string	"long int"
+.LASF3321:
+	.string	"SETTING_STATS_MAX 0"
+.LASF2208:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF2368:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF1018:
+	.string	"PG_CF_START 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF3401:
+	.string	"uint16_t"
+.LASF2180:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2278:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF1238:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1541:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF3330:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF3730:
+	.string	"OSD_MANUAL_RC_EXPO"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1876:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF3060:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF2374:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF2567:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF938:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF2605:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1042:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1439:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2837:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF1675:
+	.string	"__DECL_SIMD_asinl "
+.LASF2008:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2784:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2995:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF3485:
+	.string	"PWM_TYPE_STANDARD"
+.LASF4001:
+	.string	"max_climb_angle"
+.LASF3805:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF2250:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF3579:
+	.string	"CW180_DEG"
+.LASF2441:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF2933:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF4122:
+	.string	"__NOP"
+.LASF3308:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF1360:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2170:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF3707:
+	.string	"OSD_WIND_SPEED_VERTICAL"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1996:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF3158:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF994:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1388:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1327:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2268:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF964:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1684:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1158:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF3664:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF3118:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2311:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF2307:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF3413:
+	.string	"copy"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1254:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1821:
+	.string	"__DECL_SIMD_erff64x "
+.LASF3237:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2080:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF2697:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF968:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF2940:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF3718:
+	.string	"OSD_POS_Z_PIDS"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF3897:
+	.string	"adcFunctionChannel"
+.LASF739:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF3213:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1697:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1756:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF3511:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1799:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF3356:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF4124:
+	.string	"flightDynamicsTrims_u"
+.LASF2589:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF1761:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1793:
+	.string	"__DECL_SIMD_atanh "
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF3256:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF3188:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF1633:
+	.string	"__DECL_SIMD_exp "
+.LASF1949:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1950:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1951:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF3467:
+	.string	"motorPwmProtocol"
+.LASF1981:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2224:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2117:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2201:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2522:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF3577:
+	.string	"CW0_DEG"
+.LASF1296:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1817:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2701:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF3662:
+	.string	"OSD_CROSSHAIRS"
+.LASF2800:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1080:
+	.string	"PG_INAV_END 1023"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF2750:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF2107:
+	.string	"OSD_HOMING_LIM_H1 6"
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF2847:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF3130:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF3472:
+	.string	"throttleScale"
+.LASF2898:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF2499:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF1822:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1614:
+	.string	"__DECL_SIMD_sincosf "
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2277:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF3371:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF2771:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF395:
+	.string	"true 1"
+.LASF1208:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1829:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF3645:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2556:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF2791:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF1806:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF2352:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF2841:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1319:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF3585:
+	.string	"sensor_align_e"
+.LASF1859:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF3432:
+	.string	"DEBUG_ITERM_RELAX"
+.LASF3090:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF2447:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF1741:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF3996:
+	.string	"braking_boost_speed_threshold"
+.LASF1895:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2855:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF2543:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF958:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1906:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF2715:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF4120:
+	.string	"motorConfig"
+.LASF3167:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1209:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2467:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF2219:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 12"
+.LASF1869:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1669:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2906:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF1250:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF3062:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF1843:
+	.string	"__DECL_SIMD_erfc "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF985:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1583:
+	.string	"DEF_TIM_OUTPUT__CH4N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF1099:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF3175:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF2493:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF1077:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF3701:
+	.string	"OSD_ATTITUDE_PITCH"
+.LASF3969:
+	.string	"flags"
+.LASF1333:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2018:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF961:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF3816:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF4104:
+	.string	"navConfigMutable"
+.LASF1020:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1102:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF1095:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1721:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF2530:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1352:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2965:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF2916:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF3404:
+	.string	"pgn_t"
+.LASF3182:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF3832:
+	.string	"PID_HEADING"
+.LASF3475:
+	.string	"motorConfig_System"
+.LASF2087:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF2822:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF2150:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF4061:
+	.string	"updateBoardAlignment"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1084:
+	.string	"PG_ID_INVALID 0"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1497:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF4068:
+	.string	"setPreferredBeeperOffMask"
+.LASF1471:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1007:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF3546:
+	.string	"RESOURCE_I2C_SDA"
+.LASF2867:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF3209:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF2105:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF2299:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF2436:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF3854:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF3673:
+	.string	"OSD_GPS_SPEED"
+.LASF3124:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF3396:
+	.string	"char"
+.LASF3081:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF1038:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1393:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF3505:
+	.string	"OWNER_ADC"
+.LASF1798:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF2285:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1141:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1110:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF2550:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF3668:
+	.string	"OSD_CRAFT_NAME"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF2452:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF1140:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1924:
+	.string	"_Mdouble_ long double"
+.LASF1544:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF2851:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF2267:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2233:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF1658:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1685:
+	.string	"__DECL_SIMD_hypotl "
+.LASF2370:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF3921:
+	.string	"BOXHEADFREE"
+.LASF3139:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF2894:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF1852:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2469:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF1814:
+	.string	"__DECL_SIMD_erff "
+.LASF1727:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF3602:
+	.string	"gyro_lpf"
+.LASF1926:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1622:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1522:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2258:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF1587:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF3993:
+	.string	"braking_timeout"
+.LASF1824:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1284:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF3543:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1844:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2371:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF1551:
+	.string	"DEF_TIM_DMAMAP(variant,timch) CONCAT(DEF_TIM_DMAMAP__, PP_CALL(CONCAT(DEF_TIM_DMAMAP_VARIANT__, variant), CONCAT(DEF_TIM_DMA__, DEF_TIM_TCH2BTCH(timch)), DMA_VARIANT_MISSING, DMA_VARIANT_MISSING))"
+.LASF2440:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF2722:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF3132:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF1396:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3162:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2572:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF1282:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2041:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF3152:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF951:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2086:
+	.string	"HDOP_SCALE (100)"
+.LASF3528:
+	.string	"OWNER_COMPASS"
+.LASF1463:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF946:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF936:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF3011:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF3367:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF1813:
+	.string	"__DECL_SIMD_erf "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2911:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF2626:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF3331:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF1128:
+	.string	"IOCFG_IPD 0"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2925:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF2595:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF3902:
+	.string	"PITCH"
+.LASF2455:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF1615:
+	.string	"__DECL_SIMD_sincosl "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1498:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF3632:
+	.string	"accelerometerConfig_System"
+.LASF2496:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF949:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1190:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF4116:
+	.string	"gyroConfig"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2719:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF4108:
+	.string	"systemConfigMutable"
+.LASF1234:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1195:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2103:
+	.string	"OSD_X(x) ((x) & 0x001F)"
+.LASF2548:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF3879:
+	.string	"systemConfig_s"
+.LASF3887:
+	.string	"systemConfig_t"
+.LASF1757:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2992:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2248:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF3809:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1384:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1280:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF3177:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF2787:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF3499:
+	.string	"OWNER_PWMIO"
+.LASF3949:
+	.string	"BOXOSDALT2"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF3285:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2689:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF3232:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF4089:
+	.string	"resetConfigs"
+.LASF2381:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF1297:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3104:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF2375:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF3163:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF1222:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2110:
+	.string	"OSD_HOMING_LIM_V1 5"
+.LASF466:
+	.string	"__PMT"
+.LASF3811:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1772:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF3375:
+	.string	"BRUSHLESS_MOTORS_PWM_RATE 400"
+.LASF3951:
+	.string	"BOXNAVCRUISE"
+.LASF1137:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1403:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2985:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF4023:
+	.string	"cruise_yaw_rate"
+.LASF4106:
+	.string	"beeperConfigMutable"
+.LASF2710:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF3554:
+	.string	"RESOURCE_ADC_CH4"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF3769:
+	.string	"RX_TYPE_NONE"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF3522:
+	.string	"OWNER_LED"
+.LASF1807:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF2243:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2246:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF2007:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF1185:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1221:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1279:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2856:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF3542:
+	.string	"RESOURCE_UART_RX"
+.LASF3826:
+	.string	"PID_YAW"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1638:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1435:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF4056:
+	.string	"suspendRxSignal"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF3242:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF1593:
+	.string	"__DECL_SIMD_cos "
+.LASF3378:
+	.string	"CURRENT_METER_ADC_CHANNEL ADC_CHN_NONE"
+.LASF2235:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3807:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF2956:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF3202:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1964:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1838:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF3336:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1774:
+	.string	"__DECL_SIMD_log2f "
+.LASF3589:
+	.string	"sampleLooptime"
+.LASF1224:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF3057:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF3883:
+	.string	"i2c_speed"
+.LASF1249:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3216:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF2681:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2938:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF2729:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF2290:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF2888:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF2903:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF3639:
+	.string	"SERIAL_PORT_USART6"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF3640:
+	.string	"SERIAL_PORT_USART7"
+.LASF3470:
+	.string	"digitalIdleOffsetValue"
+.LASF1861:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2630:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF2221:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF1270:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF3294:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF3882:
+	.string	"debug_mode"
+.LASF2739:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2466:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF2588:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF4107:
+	.string	"beeperConfig"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1351:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF3789:
+	.string	"sbusSyncInterval"
+.LASF1343:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1486:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2199:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF1139:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF2628:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF990:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF2052:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF3713:
+	.string	"OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF3468:
+	.string	"motorAccelTimeMs"
+.LASF4018:
+	.string	"launch_min_time"
+.LASF3541:
+	.string	"RESOURCE_UART_TX"
+.LASF977:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1815:
+	.string	"__DECL_SIMD_erfl "
+.LASF1266:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1763:
+	.string	"__DECL_SIMD_log10 "
+.LASF2045:
+	.string	"LED_POS_OFFSET 0"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2019:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF3944:
+	.string	"BOXAUTOTUNE"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2294:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF3138:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF2986:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF2866:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF3953:
+	.string	"BOXUSER1"
+.LASF2165:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF3836:
+	.string	"ADC_BATTERY"
+.LASF3961:
+	.string	"user_control_mode"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2671:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2677:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF1031:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1016:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1407:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1810:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1539:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF3301:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF2546:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF1790:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1900:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2038:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF1573:
+	.string	"BTCH_TIM15_CH1N BTCH_TIM15_CH1"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1011:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2480:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF3904:
+	.string	"AUX1"
+.LASF3905:
+	.string	"AUX2"
+.LASF3906:
+	.string	"AUX3"
+.LASF3907:
+	.string	"AUX4"
+.LASF3908:
+	.string	"AUX5"
+.LASF3909:
+	.string	"AUX6"
+.LASF3910:
+	.string	"AUX7"
+.LASF3911:
+	.string	"AUX8"
+.LASF3912:
+	.string	"AUX9"
+.LASF1704:
+	.string	"__DECL_SIMD_exp10f "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF3264:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2097:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF1735:
+	.string	"__DECL_SIMD_sinhl "
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1747:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF3405:
+	.string	"PGR_PGN_MASK"
+.LASF3438:
+	.string	"DEBUG_DYNAMIC_FILTER_FREQUENCY"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF2806:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF4062:
+	.string	"settingsValidate"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2213:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF3561:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3840:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1308:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF3320:
+	.string	"SETTING_STATS_MIN 0"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF2920:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF1118:
+	.string	"MAX_SERVOS 16"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2914:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF1946:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2364:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF3272:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF1935:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1048:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1378:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF2680:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF1220:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2852:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF1604:
+	.string	"__DECL_SIMD_sinf "
+.LASF2232:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF2752:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF1081:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF2865:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF3408:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF4078:
+	.string	"setConfigBatteryProfile"
+.LASF3525:
+	.string	"OWNER_RX_SPI"
+.LASF2834:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF3654:
+	.string	"serialPortConfig_t"
+.LASF3037:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF3346:
+	.string	"SETTING_VTX_POWER 373"
+.LASF2577:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF3515:
+	.string	"OWNER_USB"
+.LASF2737:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF1560:
+	.string	"DEF_TIM_CHNL_CH3N 2"
+.LASF2904:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF3518:
+	.string	"OWNER_BARO"
+.LASF2870:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF2069:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF4055:
+	.string	"loadEEPROM"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2340:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF2366:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF993:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1718:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF717:
+	.string	"__size_t "
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1878:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF2833:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF1262:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2793:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF1611:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF3514:
+	.string	"OWNER_FLASH"
+.LASF3746:
+	.string	"OSD_IMU_TEMPERATURE"
+.LASF4022:
+	.string	"launch_max_angle"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2521:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF2596:
+	.string	"SETTING_RC_EXPO 123"
+.LASF2741:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF979:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3442:
+	.string	"DEBUG_SDCARD"
+.LASF3044:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF2708:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF1986:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF3852:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2957:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF1326:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2871:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF2609:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF2460:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2664:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF1091:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2306:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF4093:
+	.string	"_left2"
+.LASF2704:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF4095:
+	.string	"_left4"
+.LASF3568:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF3745:
+	.string	"OSD_3D_SPEED"
+.LASF1733:
+	.string	"__DECL_SIMD_sinh "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF2656:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF1775:
+	.string	"__DECL_SIMD_log2l "
+.LASF1236:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF3399:
+	.string	"int32_t"
+.LASF3206:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF1304:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2217:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2204:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF513:
+	.string	"__always_inline"
+.LASF1362:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF3465:
+	.string	"mincommand"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1969:
+	.string	"MATH_ERRNO 1"
+.LASF999:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF3112:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF3065:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF1660:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1377:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF3758:
+	.string	"OSD_MAP_SCALE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2360:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF3783:
+	.string	"rx_spi_rf_channel_count"
+.LASF2211:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF3362:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1688:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2827:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF3572:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1771:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF3155:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF1036:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1809:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1898:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF3615:
+	.string	"dynamicGyroNotchCount"
+.LASF3509:
+	.string	"OWNER_RANGEFINDER"
+.LASF1789:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF3341:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF3077:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF3184:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF2373:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF3973:
+	.string	"max_auto_speed"
+.LASF3176:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF1323:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF3119:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF3117:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF2673:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF4013:
+	.string	"launch_time_thresh"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF3666:
+	.string	"OSD_FLYTIME"
+.LASF3488:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2193:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2028:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF3355:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2095:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF1076:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF2394:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF1151:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF947:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF3064:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF2540:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF3384:
+	.string	"unsigned int"
+.LASF3427:
+	.string	"DEBUG_VIBE"
+.LASF1472:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF4090:
+	.string	"createDefaultConfig"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2734:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF3818:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF1232:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1913:
+	.string	"_Mdouble_ double"
+.LASF1462:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF1454:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1130:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF4005:
+	.string	"control_smoothness"
+.LASF3218:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF4047:
+	.string	"failsafeReset"
+.LASF2918:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF3289:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF1148:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF4251:
+	.string	"rx_pwm.h"
+.LASF4222:
+	.string	"pwm_output.h"
+.LASF4234:
+	.string	"libm-simd-decl-stubs.h"
+.LASF4148:
+	.string	"/usr/include"
+.LASF4240:
+	.string	"mathcalls-helper-functions.h"
+.LASF4238:
+	.string	"fp-logb.h"
+.LASF4236:
+	.string	"floatn-common.h"
+.LASF4192:
+	.string	"stdint.h"
+.LASF4161:
+	.string	"pwm_mapping.h"
+.LASF4128:
+	.string	"src/main/build"
+.LASF4145:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF4191:
+	.string	"stdbool.h"
+.LASF4154:
+	.string	"time.h"
+.LASF4196:
+	.string	"wordsize.h"
+.LASF4156:
+	.string	"color.h"
+.LASF4242:
+	.string	"bus.h"
+.LASF4176:
+	.string	"navigation.h"
+.LASF4141:
+	.string	"src/main/target/SITL"
+.LASF4241:
+	.string	"mathcalls.h"
+.LASF4249:
+	.string	"gps.h"
+.LASF4244:
+	.string	"compass.h"
+.LASF4213:
+	.string	"common_post.h"
+.LASF4185:
+	.string	"boardalignment.h"
+.LASF4223:
+	.string	"io.h"
+.LASF4193:
+	.string	"libc-header-start.h"
+.LASF4183:
+	.string	"failsafe.h"
+.LASF4210:
+	.string	"platform.h"
+.LASF4149:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF4162:
+	.string	"resource.h"
+.LASF4160:
+	.string	"servos.h"
+.LASF4136:
+	.string	"src/main/flight"
+.LASF4247:
+	.string	"rangefinder.h"
+.LASF4182:
+	.string	"imu.h"
+.LASF4155:
+	.string	"debug.h"
+.LASF4190:
+	.string	"stdc-predef.h"
+.LASF4245:
+	.string	"accgyro.h"
+.LASF4231:
+	.string	"vector.h"
+.LASF4184:
+	.string	"rc_adjustments.h"
+.LASF4232:
+	.string	"math.h"
+.LASF4144:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF4217:
+	.string	"filter.h"
+.LASF4250:
+	.string	"quaternion.h"
+.LASF4164:
+	.string	"sensors.h"
+.LASF4143:
+	.string	"src/main"
+.LASF4137:
+	.string	"src/main/io"
+.LASF4132:
+	.string	"src/main/drivers/compass"
+.LASF4130:
+	.string	"src/main/config"
+.LASF4195:
+	.string	"features-time64.h"
+.LASF4209:
+	.string	"strings.h"
+.LASF4157:
+	.string	"feature.h"
+.LASF4177:
+	.string	"config.c"
+.LASF4131:
+	.string	"src/main/drivers/accgyro"
+.LASF4180:
+	.string	"beeper.h"
+.LASF4171:
+	.string	"runtime_config.h"
+.LASF4174:
+	.string	"config.h"
+.LASF4200:
+	.string	"stubs.h"
+.LASF4166:
+	.string	"gyro.h"
+.LASF4203:
+	.string	"time64.h"
+.LASF4205:
+	.string	"string.h"
+.LASF4188:
+	.string	"target.h"
+.LASF4224:
+	.string	"io_def.h"
+.LASF4255:
+	.string	"settings_generated.h"
+.LASF4243:
+	.string	"bus_spi.h"
+.LASF4126:
+	.string	"obj/main/SITL"
+.LASF4187:
+	.string	"maths.h"
+.LASF4218:
+	.string	"parameter_group_ids.h"
+.LASF4204:
+	.string	"wchar.h"
+.LASF4197:
+	.string	"timesize.h"
+.LASF4129:
+	.string	"src/main/common"
+.LASF4170:
+	.string	"rx.h"
+.LASF4147:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF4229:
+	.string	"rcc_types.h"
+.LASF4133:
+	.string	"src/main/drivers/rangefinder"
+.LASF4252:
+	.string	"stats.h"
+.LASF4230:
+	.string	"timer_def.h"
+.LASF4221:
+	.string	"logic_condition.h"
+.LASF4167:
+	.string	"acceleration.h"
+.LASF4206:
+	.string	"stddef.h"
+.LASF4239:
+	.string	"fp-fast.h"
+.LASF4248:
+	.string	"ledstrip.h"
+.LASF4135:
+	.string	"src/main/fc"
+.LASF4235:
+	.string	"floatn.h"
+.LASF4237:
+	.string	"flt-eval-method.h"
+.LASF4163:
+	.string	"bus_i2c.h"
+.LASF4194:
+	.string	"features.h"
+.LASF4211:
+	.string	"common.h"
+.LASF4227:
+	.string	"timer.h"
+.LASF4201:
+	.string	"stubs-64.h"
+.LASF4153:
+	.string	"parameter_group.h"
+.LASF4179:
+	.string	"controlrate_profile.h"
+.LASF4172:
+	.string	"pid.h"
+.LASF4226:
+	.string	"io_def_generated.h"
+.LASF0:
+	.string	"./src/main/fc/config.c"
+.LASF4215:
+	.string	"blackbox_io.h"
+.LASF4159:
+	.string	"mixer.h"
+.LASF4246:
+	.string	"exti.h"
+.LASF4219:
+	.string	"rx_spi.h"
+.LASF4233:
+	.string	"math-vector.h"
+.LASF4175:
+	.string	"rc_modes.h"
+.LASF4152:
+	.string	"stdint-uintn.h"
+.LASF4138:
+	.string	"src/main/navigation"
+.LASF4173:
+	.string	"adc.h"
+.LASF4199:
+	.string	"long-double.h"
+.LASF4189:
+	.string	"rc_controls.h"
+.LASF4178:
+	.string	"battery.h"
+.LASF4198:
+	.string	"cdefs.h"
+.LASF4186:
+	.string	"settings.h"
+.LASF4139:
+	.string	"src/main/rx"
+.LASF4202:
+	.string	"typesizes.h"
+.LASF4127:
+	.string	"src/main/blackbox"
+.LASF4165:
+	.string	"sensor.h"
+.LASF4212:
+	.string	"sanity_check.h"
+.LASF4207:
+	.string	"locale_t.h"
+.LASF4142:
+	.string	"src/main/target"
+.LASF4253:
+	.string	"bitarray.h"
+.LASF4216:
+	.string	"axis.h"
+.LASF4158:
+	.string	"system.h"
+.LASF4134:
+	.string	"src/main/drivers"
+.LASF4168:
+	.string	"serial.h"
+.LASF4169:
+	.string	"osd.h"
+.LASF4225:
+	.string	"utils.h"
+.LASF4214:
+	.string	"build_config.h"
+.LASF4228:
+	.string	"dma.h"
+.LASF4140:
+	.string	"src/main/sensors"
+.LASF4151:
+	.string	"stdint-intn.h"
+.LASF4181:
+	.string	"config_eeprom.h"
+.LASF4208:
+	.string	"__locale_t.h"
+.LASF4150:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF4254:
+	.string	"rc_curves.h"
+.LASF4220:
+	.string	"io_types.h"
+.LASF4146:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\035\001U\013"
+	.string	"\304\021\021\002"
+	.string	"-"
+	.string	"\230\237\377\270\006"
+	.string	"\001\274\322\275\255\017\006\002"
+	.string	"\002\001\003\370\363\364\355\t"
+	.string	"\004\005\335\357\277\352\b\002\002\002\002\003\007\365\305\354\243\r\b\353\270\226\354\fB\002"
+	.string	"\002\004\005\002\006\007\b\002\005\002\t"
+	.string	"\005\002\004\002\020\335\350\375\301\017"
+	.string	"\021\360\254\254\226\013"
+	.string	"\022\270\226\330\276\004\002\002\005\002\n\023\240\342\234\212\n\024\263\232\324\315\n\004\025\357\224\360\321\r\002\026\276\247\347\343\007"
+	.string	"\027\215\216\333\250\f"
+	.string	"\030\334\354\243\301\001"
+	.string	"\031\221\200\214\364\032\366\315\332\310\003\033\251\213\217\242\013\004\034\261\264\366\324\b"
+	.string	"\035\311\270\337\376\005"
+	.string	"\036\323\250\266\241\004"
+	.string	"\037 \315\200\221\212\r\013\002\002\002\013!\"\211\270\371\263\013#\230\351\204\211\016$\253\317\367\245\f\013%\356\230\364\220\002\013&\276\201\306\364\005'\013(\360\257\374\323\b\013)\206\234\342\374\r*\225\261\207\265\r+,-\241\234\336\232\007./\245\251\274\350\0170\206\221\223\200\01712\304\315\257\207\0043\240\200\360{45\240\342\234\212\n"
+	.string	"\" p\002se\363tI\352\373g\263\210\\f\247\270\265\303\324M\036\307\263\342\3332\276\214\217\247\031\322\245\305*D\354\200\201[\323Q\212\343\031F\354\216`:x\240#\225;jRm"
+	.ascii	"\347\314\214\306m\315\316\005\332\210\217\330\302\271\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375` "
+	.string	"\365\003"
+	.string	"\242\205\016\020\220\230.\034\300'\021\213\225\225k\306\016^\222)\256zc2\026S\261\211E\354a\r\005\327\372iO\204\201 0\001\032-\364\25435\033fy\225\231Ld\217\335\276.W\001\035"
+	.string	"0\347 \025\003\304\200\340\352Tl\271\201\325\300K"
+	.ascii	"-S\252\006R\007\202@X\fc DS\344FE\005\304\240\204\3132F'\335"
+	.ascii	"\314`F\335d!\f+\352\225k`\330\253\002\220\243Y\003C"
+	.text
+	.section	.gnu.lto_.inline.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`z\005}\r"
+	.ascii	"\302\21502Po\322\001\020^\020\223\"U\206(\261nR\345\215\033\344"
+	.ascii	"\337\241B!\215\230\b20\275\242\252\252\310\303\017\217\037$\220"
+	.ascii	"\240\300\310Z!m\223-\223L\001\265\250\240\230\220H\307\301\""
+	.ascii	"\256f\031\242mz\364\340\320j\371j\350\3212\022\242\332i\365Z"
+	.ascii	"=SF|\003\350?\246\fF19Q\031\350\002\222\240E\024\022Z\002\222"
+	.ascii	"\3422\025\341 \263T\003\354\313\177M\013\2527\365\362\323\210"
+	.ascii	"\231\333\370S\027\263d!\020\b\360\370\001h"
+	.string	"\\\275l\313\221\260\233\004\271\326c\025\321F\bj\204:D\034]\351\204\261\234\255R\313&\346\f\226\243\377S3\330\372\362\377\273\026\343\177F\353\026/\362\343?\325v\352>\001j\250aaWK[J\333\001p\242\221\"\343\r\022\3002r\214\304\214\200)b\214P&\220\260\202\221P4\250\244\003pZ\210\234N\351\331V\334\250\002SFK\305lY\260Ik\234\327\210\316a\221~3Q\307\211\336\332^G\230\031E\352\224u'v2\210\370/\n\224\356Q$( \032eb\267[Trh\250\235\021\264\252f5\252\230\324\230\302r\334@S\277>\221Q\362nI\325Cc)\252`@T\n\001\3543\245\225\270\003\027\244\305\331\n\352\030\006$}\251W\\\234\217UR\031\263\206p\257\350\303\375\304\200~w\020V\030B\231\343\2723\312Z1\365:9c\nd\371`\352\230Y\3119\341W\002\262[\206\200{"
+	.ascii	"e\006D189v\274{\371\230\224wD\017\356<k\272q\337q\216;\365HP"
+	.ascii	"\277\301\324\243\230\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\t\002\325\n"
+	.ascii	"B\31712PU2\034T\227Uf\206\253\337\272\026\364\231\23133\307\205"
+	.ascii	"\004\200\021NT\207\"v\314[<x\270(y\216:\344~\202\306 \231\177"
+	.ascii	"c\307\275\245L\001\177xtp\210\214\204\200\b\214\361\236\213\267"
+	.ascii	"\370\n\016\305\004G\"\242\2635\325\232jQd\253g\006\304\357\034"
+	.ascii	"I\230=0\206\204\241\30370,\374+4\215\017\231}B\313\352\315\352"
+	.ascii	"\225\255\004\265\032\211\360\007\033X%\233\024zZ{]\027E\027l"
+	.ascii	"\310\274\250P\364Z\272\220-\234&\213\241G\206^9J\2516\007\302"
+	.ascii	"@\030Yx\3155\324\210\032q\205\245\213\245\353Fj\244>\363>,[\226"
+	.ascii	"\361\375&u\330t\030\237'\257\375\315\007<\300\273o\317;\017|"
+	.ascii	"i\002C\250\321<\262*\240)1\026\266\003\200\002\241:\343\006\022"
+	.ascii	"\200\003c\002\005\215S\301\324T\330\332\365\f\265!Ph\373\314"
+	.ascii	"\224\210\240!\240K\313`\230\370\306\013\265\201\224 \354\337"
+	.ascii	"X{\243\344\204P-\035\337.\024r\223|\004\206w\242\226\204\201"
+	.ascii	"\362\337M\325\004C\322\225*\366\246\340\221\353\274<F\013\027"
+	.ascii	"FQ\304\017\327r.\325\230\351\327\241\303\003\322N1P\366\367_"
+	.ascii	"$l\003+\003o\333$\336\346w#\373\325\fR\207\243\235S\213\241\326"
+	.ascii	"Qu\006"
+	.text
+	.section	.gnu.lto_.pureconst.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 _]\002"
+	.string	"\362\305\021\033\200I\215\0013J3\260\f\221\021\345\177\340c\377\0270#[V\202e\223\315V\006\256\360\022\216\360\016n\360\202\023|\340\002_\036p\200WNy\223K\0369\344\217;^\343\214/\256x\211\207\270~\270\341\266\314l\021"
+	.text
+	.section	.gnu.lto_.ipa_modref.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\026\001\245\005"
+	.string	"b\306\021\021`^\2316\263\240\271\355\355v\350\342\332\330I\231\002G\376 \217s4f,nJ\305\211k\230EIn\263\327\257\022S\0366\\X\261\036\324\271t*\235Ig+\353\031\234G\345\253\024\034\030\240\230\312\021%\277K\b6 \360\242\262\332\006\213\031\261\233\030\266.\273p\341\002\016\346M\274L,`\f\200\261W\3440\322\260"
+	.ascii	"\303{\037\026oXW3E(\356\301j\312C\001\213O0O\260\006\241z\337"
+	.ascii	")#Z\340q\033\317@\300\024\202\r\bD\307\322'wt\206)\021Z\031\247"
+	.ascii	"@\352\001\3078\3028`\236\240\001\261\\\020\0251\005\246\264b"
+	.ascii	"\271\001"
+	.text
+	.section	.gnu.lto_.lto.cf07173b670378b,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_featureConfig_Registry.138.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \221=\004"
+	.string	"\224\007`"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\354\341\031\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\357\006us\250\307\006uq"
+	.string	"\005\001\006'\001\004\023?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_featureConfig.140.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\020"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006(\001\204\t?\202\210\200\b\177}\273\001"
+	.text
+	.section	.gnu.lto_systemConfig_Registry.144.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \223E\004"
+	.string	"\244\007b"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\357\261\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\346\006us\376\005uq"
+	.string	"\005\001\006'\001\027\222\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_systemConfig.146.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001'\002\002\177\005\001\006\035\001"
+	.string	"?\202\210\2008}{\274\001y\274\001w\274\001u\274\001s\274\001q\274\001o\273\001"
+	.string	"\002"
+	.string	""
+	.text
+	.section	.gnu.lto_beeperConfig_Registry.150.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \204\335\003"
+	.string	"\324\006S"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\375\321\033\005yw\350\306\005yu"
+	.string	"\005\001\006'\001\b\355\0070sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	"\\\005N\271\t4\311\033@\021"
+	.text
+	.section	.gnu.lto_adcChannelConfig_Registry.154.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \222=\004"
+	.string	"\224\007a"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	"\005\001\212\001\206\200\200\374\342\203\376\221\023\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\317\007us\345\006uq"
+	.string	"\005\001\006'\001\004\362\007?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_validateNavConfig.157.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\235\001%\020"
+	.string	"\366\336mF\360\262h8\340\220\317\tf\267w(gjV\210\273\365\301\266\316\013\344J\017\031G\252\320\343j\372[\376\331\303\330\305\037 F\370{\213J:.\016\327y\355\224i\314`\260\310\231\206\254[%\222\265\355\275\267\224)\005S"
+	.string	"T"
+	.string	"]"
+	.string	"\335H\246\204N\366G\337\305q\302\323|\373\316\354c\204z\210"
+	.ascii	"\262\273\t\336\331\300\350\235\351\002\274w\334I\274w\367oB\273"
+	.ascii	"\344\320\016\3728\333\347\204\200\311!\262\273\240\242x\370\f"
+	.ascii	"\375\333\034\200L\246\303\363\203\260\273N\231\314\314\255\267"
+	.ascii	"M\300\366\004;\017\004&\262F\r\217\315!{\214\245\236\260\317"
+	.ascii	"\355\356ZilM\217N\273\277\327"
+	.string	"n/\323\234\246U\323\231\351\223H,v \300\261\373\241\250\310\376t=+N\373kO\373\251\240\323s~\343\217\267\271\224\372a\363_\034F\370Z\213I\034Y\027\0171;\273c\204\321\003D$<\237\236v\223\230C\016G\3347/\365\323\007:^H\3044\3650Dv\206\337h\341n3\235\024N\007\310\306\225\273\245(\371x\372\332I J\210>9\215\226\364\001\262_\237\221\2229f\273.\250\030\227\241\342\253xg\016,y\331;\237\305{\347i\332|\340\210Y\344\333.\241&\nVX+\r&\236Q(\006\250\013\rV\016N\001\026\254`h\271`&\237U\247\226\213\205\362R\201*\026\210\342\262p\002\252`*\340\251\304\257\r+\030\270\362z\301\300\322(^iL\241\305\217\2501s\332\323*0\333]\036W\t\320\356\356\310\202\214\224\323\333|\300\220OUG\372\027!\261,\262\247\252\025n0\001\036"
+	.ascii	"\255IE&4\":\016\217\236\2650Zs\r\262\3730\215e\354\251\340a\020"
+	.ascii	"85nd\214A\256\254\004\344\301&\236\220\272\n\301X\334\241\202"
+	.ascii	"q0\355\337\246\275\025\353\230\313\234R\305\005\361\300\t\255"
+	.ascii	"\252Ap\316-\204\371\004"
+	.text
+	.section	.gnu.lto_validateAndFixTargetConfig.158.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \306\205\005"
+	.string	"\302\311%0`e\323\001"
+	.string	"\324a\301\377\323\270y\345\340F\002\210u\302"
+	.string	"<\231a%h\241x\317\226\306n\017(\"\362\210BK>\003\204\005\234\211zK\231\002\237\025\344\2620:\345\264$v9\"r\326\211\254\020\247\222G\225\024J\253\244>m\243\367\006)\324\342v\016\201\246\346\200\377\3338j\376\025t\364~6\214J\013\260\0333 \320\341@\344\371\277\324\263\377\264\037\247\017\226\316\005\004\320\3352n6[\316\276\373\331\002\327U\226\t\214\356>s]f\037\367\177\342\277\342\177\r\b"
+	.ascii	"2\003\036jF\\\b\256\211d!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_targetConfiguration.159.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \306\235\005"
+	.string	"\264\tr"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\256\205\017\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\377*\341\362\n\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\203\300"
+	.string	""
+	.string	"\373\002\200\342\361\312\002"
+	.string	"\203\003\202\340\363J\244\003\001\202\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\b"
+	.ascii	"3\003\036:\303\022npM$\013\001\277\f\001.\335\242\235O"
+	.text
+	.section	.gnu.lto_getLooptime.160.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\035\007"
+	.string	"\002N24Po\322\001\200\276\221\320 \3468\263\207\035\030\034\200\241W\231S\250D(l\r\265\036\013\001\004\266\352PVUU#\t\352\033\270v/\345!\207\335{K\231R\2464\n\234M\247\242 \265\201\035\016\302\002\244\254\006\250!p\305\220`A\207\252\262\340\024\367mUd\305\204T\302\366\303E.\200\3355\360C\036!\374\321\235#<y\354\316\367\274\273T\001\r\220P\226<Yl\262\330\021\224za\277\255\212l\247S3$GI\331\245(\265\354\2113\341\260\375\261'\277\343\036\037_-fd\21742AZ\331\215\020\363\201w\327\036\360\356\024\343\327\363\362\377\361V2R\3012\320\363r\260\273N,\253\270\365\266\013lglo\004\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_getGyroLooptime.161.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\025\007"
+	.string	"\002\01624Po\322\001\200\276j\276\023_\002\226\300\004\f\016\030\002\350\230uT\"\024\266\206Z\217\205"
+	.string	"\002[u(\253\252\252\221\004\365\r\\\273\227\362\220\201\366\336R\246\024\2362\013\033\r\207\232\340\244\201\234M\002\003\234*\007\230)0\325\240P\301\007\212\252\240\024\367m5d\275\200t\3026\304G\254\200\335=\360E\036#|\216;Kt\362\327\235\337yw\251\003\033!\240\034Y\272\330d\261\343'\025\303~[\r\331N\247bP\256\222\355V\214Z6\305\231t\330\366\330\222\357\361\017\217\255\0265\260\227\235Pd+\273\021^N\360\356\332\005\336\235f\334zZ\376A\336JD$\027\366y\002 \354\256\363\302,n\275m\003\333\030\333\242\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_validateAndFixConfig.162.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\322\020\235F"
+	.string	"\272o\270\030>@\244N\007\033[\377f\207"
+	.ascii	"\001\220b@\300\274\023\021\324\324\245\364f\271A\372\0161:\240"
+	.ascii	"\2353}6\353.\2620+\316O\231\366\203\351\333\341\b\341\232\354"
+	.ascii	"\210\310b\030\201\332\336{\247\224Rz\001Z\001\201\001\275%\005"
+	.ascii	"N\307a\343\326\024g\212;@\273\276\304\022E\256\270\361\270\375"
+	.ascii	"\332\r\033\267\334\376\320\350\200(\266\272\305\344\212\231\333"
+	.ascii	"\330AY\264\241\330*\313\347\317\241\216\306\343\006\314.\334"
+	.ascii	"|}\206\033M\247a#\267\255UZ\336]C\306\251\233\203w\330}\314;"
+	.ascii	"\032\217U\346 &\336\275\227\360\252\371:\f7\2316\263E\310\fw"
+	.ascii	"\231\326\333\321{eVg"
+	.string	"K7\255\007\220\277{\363,\024[]\362-\304+\346&\303-\246\307\354\350<v\366e\273\r\004\321O\\\341\275wA\253|\240\330\252U'\327V\323vZ[\345\016\263\203\331\330\252j\344\226\231\260\363\232\267\315\334Q\2329\274\367b=\224n{J*\n*\371\344\324\304\264\204TJ:\032\221\216\212\354\252\246\357-\267\273\021B\003\224f\315\254\247\244\330\25696/\035\325%\265\262S\263\342Po\311!OGK'6\212\245\211\355J\355\306\004\342A\347\330\2524\023\225)R\242\254\307?Y\222\364\234Z\235\272\324l\344S\255\311\304\225\230\235\224*(t\223\250\355\324\230i\262H\225\345Sm\211\037\225\264QI\234#%\351\243$\004\354\324\340\274H`\216\355\255\331T\001\363\216[?\325\336\322\344\036'\203\224\276\036i\325G\017O\335\372\225\326\322R\253{o\203i\017\262\206\346\316v\335{\331\227kl\315"
+	.ascii	"\232\271\3370\363\016fd\216rP\303\342\323\r\352D`T\210\030\b"
+	.ascii	"\"\252\262d\332a\237\216;lU\177\205\336`\2066,\354B\0328t\350"
+	.ascii	"\260\266\252~r\320h\370\234r\007n\370\344\372\303\312\034b\204"
+	.ascii	"\367\222\255\322\336\214]\r\236\025l\025\004v@\360\336\033H\313"
+	.ascii	"\251\246\377%Z\020P\372\275f\360D\373\t\343\323}P\244P\241bm"
+	.ascii	"\365\177@\235\030W\003\370L\237\256\305\326@\261\252\346\275"
+	.ascii	"W\317U\363\320Q\315\230gG\243\321\303\177:\366\357_\241\247'"
+	.ascii	"\315\021\231y\254\361\334\361\257P\307\354\242\353\224\025\357"
+	.ascii	"M\323\342\236\323t\310\270\247\264\3120dx/e\254\255\366C\r\212"
+	.ascii	"9\363(?\331\t\204\032^_\304\234\207\346O\307\334\037\215F\013"
+	.ascii	"\361?a\376b\2351\364_\263\027\353l\241\235\315]\2543W\352\\\241"
+	.ascii	"\3174S`\235'\244\316Z\254sV\321y@\321\271\252\350LUt\026\260"
+	.ascii	":\007H\235\001\260\316S\254\263T\352\034\225:C\261\316I\326\371"
+	.ascii	")uvJ\235\233Xg&\326y)uF\246\316J\254sR\352|d\235\215\2523\222"
+	.ascii	"\352|\264:\027UgVu^UgUuNU\347O\235=un\017\007\016\231J\350\360"
+	.ascii	"<\240\274[$\312\350\006\252o\2544\232\3563\335\316\356\277N\231"
+	.ascii	"\003\204\251\2319o\205\375\n\023\246{o>\205\235\n\023~b7\325"
+	.ascii	"\332\252Gaf\302g4\347^\263f\372\362&0\312\371\360\304&\024\244"
+	.ascii	"\247*\264D\007V\365$\313\017\020\371t\234v\330z\364+\364\362"
+	.ascii	"\264y\023g\342r\255\021$-\034\334\332\352\021\362\317\352\254"
+	.ascii	"\317t\203i\022\213\256@\013+\374\022\261\002J\332\270\250\270"
+	.ascii	"^\032r}\205\357\276\206BD\341'<\327\267\217C_?\341O8\225\211"
+	.ascii	"Nn(|\237i\253VI\326Sx.<>\230h\036e\255\317\372V&\236yt\211\277"
+	.ascii	"\225\245\316&\222\326I\272F\360\310\247\316:=s_\337h\032\251"
+	.ascii	"M\356\314\0271\023w+s=\202}\3346\361\266\326\211\313i\266\312"
+	.ascii	"\276\346l-\035\224\266\256nm\365\353}oPL\247\351\257\273\271"
+	.ascii	"\276FJs\367\344k\023\200\027j\350i\321\025%\005\236\324\354\\"
+	.ascii	"{\215\023\031B\245\265\322\007\032\b-\354\241\346\350\267\244"
+	.ascii	"\233\210\205j\222n\254\305o2\206\232\030\342\023\b\2017\033\007"
+	.ascii	"\322\336}\200\347\236^\033\274{\317z\311\256\364\037m\226vK{"
+	.ascii	"\327\336\255\255\227\026\214\367\262\370\r\246\213\202\320?h"
+	.ascii	"!\222\311\\\257"
+	.string	"i'6i\330\210x1\344~qGOs4\2776\343\323\261w\330\312\372\r\213\262\356\267\366Dj\004V\305\b\253\331F\321\221\241^\3330\215\030v\330\320v\214\005/\257\265\325\365\243\352\236\024\005\374\342*\206\n2\033c7\260h\220eI\200\020\301\001\216\026c1R\254\254\245\025A\213E\326\330\204\253\246\0078^\270 \263\221\202e\261+\027d-f\320\020\303\022k\2015\203L\205\f,1\0337\260\256\242\230F\2151\033X8h\320\260\201e\314;\353\364\376\023\036\021&\360\354\321\246\006\020\372\260V\375\200o\245\333\240\252#\240\227\247\024\325\007B\352\211F\243\375a\025\360T\337\31274\377\343\200>pOa\036\212x@y@\327V\005|T\335\333X\234\234\337{\315\242\226\035\340W\350]pn\036\215Vf\036\321\326\314{\031\340#\310\245\331=\271\234\271\355\321*\321\336\214\223p\205@|\017\230"
+	.string	"\0174 x\b\356\n\3240\205\302\002 \017\236\251\007\320\210\367\017IME\275\324\0349QL-\3118('\234\344Cq\243\353h\372)\351\364O\177~N\"\336\260<\2751\322\304f\r\3237\275\352\307\271\362\220\177KC\332\"\336K\246\267\362\361K\257\"R&\366\225\361!\277\371\006E\260Uq\212*\355\351Yx%2\235\364\026\272>\351\267\020\321\251\302\003l\243\221\256og\336\230\2568\037\030Ii:\372A\237\037F\f\017\303\037\223~\224\211_\332\370\030\274\336\370[~\224\211\316\017\324\246\215mH\200^\337\177\315fYs/e\276\327\354\342\365=\310M\177\265\265\020?E\317\272\346.3o\304\177\262\300\261a\332\302\316\205\t\323\276\267\324\216=\013\007\201o\250\2014G\025B##\"\"I\222\024\032\003\261\005\304\030$!\263:\021"
+	.string	"9\307\234\241\031M\222\3122\007\233\273`w\371\021K\275\276\365\375#\032\324,C\354j\0375N\332g\034\360\355\270T#;'\355\2704\2033\300z\200@xojZ\236\017jd9\031"
+	.string	"\362\350#\335\311\001u\177\306\270\277j\021\251\261r*\013*\272\365\275\212F\255\251cU\330C\272\024\213b?\224\256\213\260\252\217\b\241\307a\301\243\357"
+	.string	"%m\035\r\217_\260\022\335\352;\272\272\0260\364\335\241#\331[\220>\364\032\3035\230\351\2715M\320&\221,\240a\005\373\302\017\337X\036\346\355p(\350\371\243\261\217\204\206\002\336Fn!\312\352\222\200rK\230s\236\3543\351\206$\017\242a..\007h\302\370\006\360\222\017\250\301\354\236\277B\324K\b6\r\210\256\004u\324\354\205\274z\026\346\203\334\240(\230\367\333l\315\214\315@\212\200X\020&\fRvg4\344\246\362\306\001^\353@u[\332\007\020jNw6Qw\034n\005\333\230I\006\211\337\310y<\347\306\t\371M\013ZBv\212e\315j"
+	.ascii	"\232\271\233\273@\3221\245\242\005(4,v\352~\361l\324\364\344"
+	.ascii	"t^\215\221\240V\210\016\n\033\227\327\0221TZHZ\021\312g\350\373"
+	.ascii	"`\227\207\244b\340.\336YvEMp\340\326(\237g\204\341\305\333\360"
+	.ascii	"\370o\207q\334\324\340{\242\305,\341\341\232\316\2446\370) \002"
+	.ascii	"$\200"
+	.string	"\347\370\302C)\217\351\205\214\323\374\335\222\005\366\3265\200\256z"
+	.string	"\177\374\342[\361\260\250q\006\022\312\204*NI\030\353\244\030\\\221\b\207\366\231pS\325\034A\235\224\220\"\036\375\004\213\2400\357\315@\t\024\242\324\371\372\242F\333n\212\331\347k\345\341\3709\314\205\233\323\345\215dm\320\021\362KK\316U\022\031d\317\361\246\007\216\246\273\rv,\326\003\311\255k#9\342\"\304\373@\364M\017\272\210\253\371\361c\316:g\306_\220\335\324YLm\031 L\225i*u\226\234\233\244\2563\357\017p\231\f\313\031)L\202^f\214\034\007\233\246\036\256U~\034\250\335\220\311\361g\036\257h\031\363\217\373s\016\347\033`~\236\265\242\243\334\b\f\203\353ZO\200\030,*\255.\251!S\247\233A)\244x\301o."
+	.ascii	"/\212b0\315S\341\2363\227^\246\345\001/\206,!\262\027\235;\322"
+	.ascii	"\017\321f4\263\032PN\255\005D+df\245*\331\016\372\017"
+	.text
+	.section	.gnu.lto_applyAndSaveBoardAlignmentDelta.163.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\177"
+	.string	"\325\t"
+	.string	"\306\022E?0\307(\035\005\233\227\274C_\265-n\271:>\0309\200:A\215|\317\252\200*ig\376F\320\001t+\207Q\347\305n\301\025 \322\b\216\364\221\nT\rq\265@h\250\233\321n\"eJ\0010"
+	.string	"3"
+	.string	"/"
+	.string	"\ng\310<\3467\231G\177\366\202\207)\373\227\004)\227\327\356n\212\362\357\371\371o9\202j\005>\017,v\327\251Z\225\334z\333\017\266/\354'\004\017\177\315tf\372\332\206\300\001\f\230]\222\030l]\021\200\212\355kl\317+\204Uh\217\036\005\021\231\366W\316\362\275%\342\270kb fw%\f\241=\006\366G\t\245\2407\003b^Sm\220\220\274\312\016#\n:\323T\275>\325\340\2241g"
+	.string	"\001\b6\031\330!\230zb?\333\335\265\262\354\267\376,\035\234)D\212\356t&:\033\024\037\017gA$\352\274\314\034\207#\004\032u\334\306\201\266QH\303c\343\274\322\306ipG\372x\233\251\353\274M\023\356\263U\2263\n\270N\212\262\226\001\016"
+	.ascii	"\002Td\342E\320hq\241z^AUk\300k\346\3020\013C\201a`\210\0135"
+	.ascii	"\005\334\345E;\311"
+	.text
+	.section	.gnu.lto_createDefaultConfig.164.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`*"
+	.string	"\345\007"
+	.string	"\222\21666@u\032\0030WC\031\350qH\202\035p\2125RC\247q\270\353<\310#u_\026`t\324\253M\326\303/\0314^J\372XN\350n\022\274H\243\246M\244L)eXPH\210\220xp\300\232\221,\264\222i\313fV\232&\215\002cf\334i\222\b\272eTpsc\333\270)\002o\320\345\252\023\254\020D\242*\020[\355\002%\275\216Vl\260\030\377{\013\265\032'\226\360\212v\361\013\307\350\346O\371\353\bH\035 \370j=>\242\277\026\204H\257\003&4<;\217=-\350Ey\322\032t\271j/\263HZ:\0201\377\310\217\317\303\253F\245\255E\355Z\034\203)\267L\216\bL\353\377\224(\356\034\273\332-\306>\225\347\b\320\360\277\361S\225\270\322m\r\332\316\2663\001\f"
+	.ascii	"2C;\025\030\036j\tg\be?\330\330N\215\342\232\350\026\002~\031"
+	.ascii	"\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_resetConfigs.165.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\232"
+	.string	"U\n"
+	.string	"\306\322D=\020\005+\035\020\360\022((f_Yh\326\212\022\334p\373\013\352\022\367\001E|\346\301fh\253~\267\364\317\b\223\202\206Q\"\213"
+	.string	"\224\212P@f[\343.\275\025jJ\253$h\313\224\002/"
+	.string	"3"
+	.string	"5"
+	.string	"\235?C\331\337\273\177N\3317\257\205\354Q<\\6"
+	.string	"\273;%\310S\327\224\377\330\007\306\227\352*\340\260\273\326\361\305q\313\333F\260\235`\377!>hI\225\265%6\263\032\300\256\261T~\330\347\254\204\331R\355\251\372\235\017\214L\204\315\356FN\300\342:\025\022\333\367g\247\241.sW\303R\262\273\337\003`g\267\325\340\233\374D\344\217\2743)\324\217\241\367\316\223\006\"\264\225\346|\332=/\035\327\270\345h>+\036\265K\"+e\341v\305G\346)\303m\214\f\375\030\006A\244pd\022\301\t\216\246)\f\225&x\262\230\240\002\213\024\242\323\274\020\305\323\374j\253sV\302\f\021\203[I\226\t\364\322\226\230\360\344\345cW\270\271\270\0068t[\025"
+	.ascii	"2\241\225h`xX\006S\322Qg\034ZX\027\261&&\236J\264\250\016\202"
+	.ascii	"\026\260.pz'\304\360\024\3165\274\001\023\017\241b\274\\\001"
+	.ascii	".\335\242\235O"
+	.text
+	.section	.gnu.lto_activateConfig.166.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\233"
+	.string	"\305\007"
+	.string	"2L/5PO\323\001\203s!\250\216\326\274Q\274\007=V\031\004\267\006z\236+\333l\272\023@\365\230\0217\037R>V\006Qc\033U\355\300\370\312\317\332o`\233\2242\005\206\226\006\2738\021>x=\016\246\260y0\353<\253rlX\310\336C\214\331\243\272\247\364\r!\210F\024\353\321\200`\037\f\031\033\214x\341P\201:0\020-\021\002+\253\266\304\204&\347\001\317nV\023\025\224\253\213\335m\272\032vJ\377\357\r\331\001\225\310I\002\311o\021\363\362Q\246\304\303vR\326\354\224\3548>u\204T\214\260\374\177\273\221Z\252\346LQ\002p\237-u2\370o\345>\240\364\246m\002\333\005v\036\004\032"
+	.ascii	"3\241\227(0\b\275\002\355@d@\0130\007\n\003F@9`\030(\002\314"
+	.ascii	"\201\302\300n\240\b0\007\n\003F@\2719\027\253\263\r\272`\362"
+	.ascii	"2\004\270t\213v>\001"
+	.text
+	.section	.gnu.lto_readEEPROM.167.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\307\001}\017"
+	.string	"\326\232aF\360\262&\035\002\212\352\337*\241=\316\350\023\272\220[Y\324\372P\365nv=N\256\307\3421p\200\320\037\335\255\257T\321\302k\rJ\377\347\300_\2708w\201b\033\206\241\360\222\267\376\201\365\256-\272u\333[\312\224\002I"
+	.string	"J"
+	.string	"R"
+	.ascii	"&\346\234\362\321?\021c\313G\225&\331;\356\325\314\263p\311\240"
+	.ascii	"\200\3159\265\rq\322\341*\311\177\352!\256+\035z\370\302\221"
+	.ascii	"\035\030<\262C\301\0013$\270\247\256\033\272\223jH\2029\247\225"
+	.ascii	"\3538\334\361\266Kl\033\260\325$\007>d3@j_x\321s.p\332\222\265"
+	.ascii	"%\343\306T \266w\322\005a\037\316\245\261\243ZFu\b\252\027\252"
+	.ascii	"u\325\027\220\005\261!\2015\347L\354\233\257\030\243\204\355"
+	.ascii	"\373\336W0\267q\b\316\007\363`\354\253bn\343\250\363\005\251"
+	.ascii	"\217\270X2A|\362\025\017@s\242\020\370)\256\002\202?\342\321"
+	.ascii	"\021P\242\217\362y\f-\001\021*\223\306|\325Er:\\\003\215\030"
+	.ascii	"\016m\361\200\001\024~\373\330)+\250-\031@+\3475=;/\326\031>"
+	.ascii	"_\n7:P\332c\251v\205\026=\367\r\336HVXT\\D\233\266\251h.,\023"
+	.ascii	"Z\264m\364\242\221d\026YH\031i\030D\242\221&=\323\341\\\032\237"
+	.ascii	"\304^\246=\225|\n`\0132\236]\233\201\334U\234\357&\007ke\223"
+	.ascii	"\273h!W\027\251\321y\007\351\270^?|\364\310T\327n\340 \264\272"
+	.ascii	"\017- \240\002\031\252\353\006#BW\311\030^F\351^2\341\275*|\346"
+	.ascii	"\230\227E\021Qnl\326\355h\261\245\241llE\212\264\216cX=\326\241"
+	.ascii	"EA5%b0\202C\034\016\013w\350\365`t\312\333\020\3445UA\304\305"
+	.ascii	"\327\030\251h\352^lO\214(\261\021\3428\311\272\301\b\210\361"
+	.ascii	"~\205<\335D;S\264\f\005"
+	.text
+	.section	.gnu.lto_writeEEPROM.168.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\205\006"
+	.string	"\344\n\255"
+	.string	""
+	.string	""
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"#"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\212\t\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\200\200\200\370\305\207\211\315\001\200\250\300\001\356"
+	.string	""
+	.string	"\177"
+	.string	"\013\001"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\327h\341\260\032\005"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\342\227\332\002"
+	.string	"\201\003\203 "
+	.string	"\212\001\002}{"
+	.string	""
+	.string	"\002\003\232\032w\236u\203\003\202\340\261Z\244\003\001\200\300\013/root/repo"
+	.string	"\027./src/main/fc/config.c"
+	.string	"\r"
+	.ascii	"3\001{8\303\360\256@;\020\031\320\"\347bu\266\341\302H\026,~"
+	.ascii	"\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_resetEEPROM.169.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \354-\006"
+	.string	"2\313)1pM\322\030\200\306\351C\312G?\273GQ\314\262\203\315\301\361\352\200i\213\304\274-M\376\313 \274\035\347\352\353tC\333\027@\216\345miDJ\231\0027Ia\272`\\c\355\3020\023\302\002kT\003\223\004v\f\t\024sp\216b\320\265\250\233\203\217\216\204f\036\242\016\315\207\210H\264\036\310hu\216p\230l\246\374U\245b<>\253\233\177\"N\311D\262K\261\242\262\035\213\310\306\217\217\234\367\320\357O\360\322X\f\271\230"
+	.string	"A\331]\246\031\3700\337\210\036\030`i*L"
+	.string	"\203\335=-M\005\256\370\023\374\005\277E\n"
+	.ascii	"3\001#8#\306W\240\335\234\020\253S\f\327Dh!\020p\231\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.170.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`7"
+	.string	"\005\b"
+	.string	"\022\31767@\217\322\001@\216V\2373\264"
+	.string	"\003\376T\312\002\324\020\300\202\023C\316\347o\\\311'\220\233\021S\202{\177L\3640\f\277\342\013\035=ndm.s\377\267-eJ\001\276<\013!\220\b\273\342\005\212\242\020BC\274\262Q\364\004\030sP\310\342\003\206e\261\363\221\376!)\0075i\217 \362\235U\267\2634Z \352\211\3145\341C\245\224,\303\264#$\362\335\325 \203\323\315O\235SB\222\262\351b\177\\\352\206}\270\273k=\331O?#p\202\302 \262[\321z\331\025f\244\303\366\355{hv\307\232\275\362\017\265\017A\231T,\273\033\225\343\332\241\246\346s\274\355psq\205\003'\214\026"
+	.string	"\217\203\004&+\323SO\n\257\224\251\371\354\256\263\363,n\314m\037\330.\260\255\n\r"
+	.ascii	"2\003\3020\037\302V\r\244\205\275\200j\037Hu\215\253-\204\002"
+	.ascii	".c\213\313\334T{40\265\007"
+	.text
+	.section	.gnu.lto_saveConfigAndNotify.171.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\003"
+	.string	"\225\006"
+	.string	"\262K,4Pm\222\016@`\247\"\002H9(`\254\241Ai\215B1Y\013\325\021\1774\335\312\314tM=^<\226&\231inL=\231\005\211H=\263\371\177\357\235\002O\032\005\316\246CMm\332\264\016\007\201\241M\225\247i\002\246\032\022\252\346@QU\303d\275\f\035\224F\023\371\371\202\005\367\236\007\n\022D\306$\361#$\360\260\005>y\215!%#\305\322g\027&\306_\245m\317\320[2'\"\013\037\255E\nJG\026\020\321\177\230\255'\271L\243\347\261Q\321Aj\3332\343\254C\353;\216\003\300@\327\341\305\240\355\210\201.\356\274\177\340'\370E\001\f"
+	.string	"3\001\2038\003\342]\005-`\035\320,\3476u6L\027L^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_getConfigProfile.172.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \367\355\006"
+	.string	"RM16@o\222\016@\355\23715^\222\004\270\266'6\212\317\261\013\2153\003\313\205\334\306f\317:ZN;pdU\256(\212k\005\016o\212\341\314\305l\032\177k\204\310\024_\032\007\316\246\203]\361\332\304\016\207\001\"^\231'j\004\306\"\032\262(\201aY\264\272\255\2204,\330`\350\367\3244\021\220y\241pMZ\242\270!\255\256\370\274r\255\356'\323\352A\002\220\322\366N[\034\371`\276\013=\330\361\245\022\222\376\367\203\003\032,\017(\231\242SL\256T*#\177\277%\240\267FH"
+	.string	"\255\265\373\020eDL\030'/\231]\204\036\325\372\264[\222R.-)\334\310\242\017`!3\177\334(\243\303\376\007\277\301\277\021\007"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"]\303\t\206x\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_setConfigProfile.173.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\033\002m\022"
+	.string	"\246\241xH\340\320(\035\362+*X\376]\b\"\333"
+	.string	":\322\237\202/\261\025V\374\366\237\246\311\205\3438\212\366\243s^\355\177mU\242\240\265\272\257\375\214\\\243\024a\b\003c\335\212\320\324\360\242\005\371\2443\366\177\306\207%d\313\235Rb"
+	.string	"`"
+	.string	"d"
+	.ascii	"\261\024\225\027[\326\335\233\316\305\356\210\300\005<\356\331"
+	.ascii	"6\212\212\215]\037yj\317\255\230\001\335\330\035A\355p\327?o"
+	.ascii	"\252t\371&\2269\302F\020\315\366\372\267\341\236\210\r\3034\331"
+	.ascii	"\335\013r\342\\\247\201[\f\034\021\233l\216\314\340pt\237\313"
+	.ascii	"\033[LJ\023\313\356Z\322l\032n\323m\253l\267\330\362A5\362\264"
+	.ascii	"{~\315w\357Jb\244\203\311%\217\f!\375.\315\240\324\003\2239,"
+	.ascii	"`"
+	.string	"\250\206R\322\312\034\366\030\223\212\263?Ww\354\213\377w\335=/\336\252\322rJ\377C\001\317-'\307Bi\214[[\322\261D\236P\210\353~\333\306\3671\310J-\305\326\271L^\343\326P\216\220\304\003\367\334`%*\365\263\0350\271\364\261+Q\244z\361k}\027\017!\334\365(%\311\335}y\212\263)\007c\026\244\007\372\227k1\013\222\037?\365F\276\365}\352\362#\343>w\260\323\231z\335\315\002\233\212c\240\023\262\023Qt\020\264\033\221*\316\237^]~\214d\022\207\355\230\237Xy\354\312N\276\211\377T\360?\334\363L4!K}:\245\234^\022\204+'\003,\204/\252\226\220B\nf\305\222\t1\352DB\nF\265B\201(\030P\225\212\020\003\242X3\340\t\211W2!\013\244Y\255X \310\b\373\\\335\001@b\247\363\216\342\236\363S\235\272@\007\2461\227\b\005@\205r\367BE\213"
+	.ascii	"\317\356\246P\361\220S\"\026\255\224j\247&\310\323l\"\323\227"
+	.ascii	"5+ `\2421\bo\003\242\021\364\265\320`\n\214\341PV\016\331\256"
+	.ascii	"\002/\225\311<A\304\314\274\275\020\3120a\"\220\03516\267\022"
+	.ascii	"\3215\213\\\323\306~w\335\243\275\n!\030\217\300\203\266@e0\253"
+	.ascii	"@\332\351,\275\003\334f\250\026\230u8\005( \225\340\317\343\001"
+	.ascii	"B\213<\235\215\006\221\370\024\2531]\316\030S\n\003\005"
+	.text
+	.section	.gnu.lto_setConfigProfileAndWriteEEPROM.174.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"%\f"
+	.string	"\206\226RA\020O5\035\303\320\326\023\"\207\\d\254\032At\356\224\205$\230\001&\367\336_\355\333\035\324\354\264%\254\363\314\331X\3724\206L\023\001\020\032T\001\031\270w\252\031Q\255Y\256\2010\252\326\332\226R\246?"
+	.string	"<"
+	.string	"A"
+	.string	"\007\177\025Z\246ZY)H!>\272;\343\016\n\352\344\005\257\272R"
+	.string	"#\031\352\344\240<\rx\210pA!Gs@\311\303\250+]\r\244\270\033a\320\335\337\221\334\240\277\364\277\203\377\r~\205\0201\3762\\F\375:\233O\277\252T\261\335\317\271g\336\357\356uR\371(\321\255\350.\205\310\350\216k\304\207\377*\371\025\234\310\354\376\007\022\200\252\n\235\273M\034\255\356\362\362\002\032z\005\0303_$2\230\304\027\223\253\264\b\260\277\307[\035o\0219\374d\203\205\246@<Z\314\250\377\030\260\345\t P\214\026\344\221U\376A\026V\307e\313\210\303c\254\254,\322\f\321\206|78L\364\006\327h2\232\r\202m\001F\300\205m\323=\330(p\034\357\373L\256a:\034\247\363\264L\343d\035'\301\223i\037(\303\020\270\367\331\276\254\202\347}\231\244l\345\323#\300\350\020\261x\312N\376\267\016\363\344\213j\b\013\025"
+	.string	"\242\223\340L\300\317\037BaQZ\304\222\330}'f\036.60\"_1"
+	.ascii	"\342\346,\346a\013\007\352$\033\333\355\232\330\227\t\032L\r"
+	.ascii	"\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_getConfigBatteryProfile.175.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \367\335\006"
+	.string	"R\31505@o\222\016C!=\252\265\270&\351\320\270\314\304\277?\036\271\204fb\271\220\333\330\354YG\313)\273\2261a\212\242\270V\340\360\246\030\334\246\262\304\321\332'D\246[\031\207\215\206\023-hi g\303\360"
+	.string	"\255\253\0033\002G\210\206\013F\304x\301j\313\372H\277\202\354\201\376NI$\0022-\024\356HK\023\327\243\324\024\036W\255\324\365`J\2717\320Q\312\334\351*#\335\312o \3674\276\227|\244\337\355\036\301(%\2362C'\226D\241N@\376~E>_\215\220\360\031\353\306\021\302|\264\\\224\23027\3706\212\325a\267!\275\250\230L4QE\035\300Bf\3564\321\250\277\376\007\277\301\217\021\007"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"]\303\t\206x\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_setConfigBatteryProfile.176.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\003\002\035\022"
+	.string	"\026!wH\320\360(\035\002\371X\361\355e\257\360%N 2|[/\265\371\\Z%\206dx\353\243\230\363'i\363\322\330\336\250\200F\357\352\346\325\333\017\342"
+	.string	"Z<\b,+\003\205t\356\\\220\034\255\270\020\322\005@G#d\313\235R`"
+	.string	"_"
+	.string	"c"
+	.string	"*/\276\254\2738\025+vG\004.\260\361\317\266G\024\274\030\366\361\306v]\f\315\307hw\f5\304a\007\277\251\022\346\227P3\2477\243v\213\035\364\360\357\343\246a\232v7\203\2343\327i"
+	.ascii	"\347b\346\3436\233 /@\310\370\316e\314\rF\312\022jw-k\267\016"
+	.ascii	"w\351\266Y\266Ml\211\n\377|\027\360\3375Dh'\223I\006\031\002"
+	.ascii	"\372a*\323#!\223G\0160\324\242G\264\362\310\036a\244\346\354"
+	.ascii	"\317U\033\373\342\017~w\317\213\267\252\264\234\322\347p\200"
+	.ascii	"\204\243\321mP\030\343\332\222\220\026\350c\241\373\356\267_"
+	.ascii	"\374\035w\224\364\220\330;\230)6\256m\304(\206x\340\237!\224"
+	.ascii	"\344\220\0042\231\004\200\247\023\244z\021|\201\027/AUT\323#"
+	.ascii	"\222\273\033\3734\347\222\316F\373\321\373\034\324q\240\375\310"
+	.ascii	"\217\237\032#\377\002A=\341\341}\347\021\212d\246~w\243dSs\r"
+	.ascii	"j<x\037\202\216S\303\001\251\346\f\352\365\204Gh&i\330VyOkcw"
+	.ascii	"v\362M\234\347\202?\342\237Y\\\344k\001-*\227\372t\"9\241$P-"
+	.ascii	"\020\021\200A\205\3022QYX\245\264\\+\036N\211PX\245\260Z\251"
+	.ascii	"0\225\022\262V\023T\302\224\213%\024\tqkE\345\n[Z-W\3301\312"
+	.ascii	">Wm8t\212p\276\237\270\347\004U\2472\250\221)\214\t\210A+\245"
+	.ascii	"\332\253\n\3625\233f\032\323\323jH^\211\024\257\0017\273\213"
+	.ascii	"\342\201\b\232) P\2421\by\003\242\0214\241\320H\n\214&\224O\227"
+	.ascii	"\300\311*\236\226'\354X\023\270aV{\333I\211\313\304+\025]\262"
+	.ascii	"\3107m\314\273\313\036\315\253\020\300x$\036\204\005\252\007"
+	.ascii	"\263\007\322Ng\351\035\3406C\265\300<\303)`\001\251\004\177\036"
+	.ascii	"\017\020Z\340\351l\033D\343S\250\306x\371cL):\024"
+	.text
+	.section	.gnu.lto_setConfigBatteryProfileAndWriteEEPROM.177.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"\035\f"
+	.string	"\206VR@"
+	.string	"Q5\035s\312*\254n\360kS\361\216\337\364\327%\205\377gh\203\231t\357M(,\304\264%d\355\346&\200\251\020\b\212hU\275\026\213\240\355\322\217\252y"
+	.string	"\370:\264\342\225\314\223\266\245\224)?"
+	.string	"<"
+	.string	"A"
+	.string	"\007\377\030Z\246ZO\204 \225\260\321\335\032\203PP'/x\325\225\006\030\311P\247\007\345y\240\003E\215\t9\232\004J\"F]\351r \305]H\203\356\376\216d\007=\246\377\037\374w\360k\2047\3762\\F\375:\233O\277\252T\263\335\317\271g\336\357\356UB\231\321BC\253\273\364\201\243_X\212\021\3775\362/\370\200\331\375\021("
+	.string	"U\025:w\233`\260\272K\313\r"
+	.string	"P,\0313c*6\230D\031\263\243\260\020\260\177\307[\035_\0219\274\304\265BS\036\035,f\324\377\f\3312\005\022/F\353q\310*\377\240\013\253\343re\304\3413VV\023\244\034\242\375\370\272Z.z\003\317d0\031M\002\216\301e"
+	.string	"\006N\343\201\300U\3506\336\367\221|\273p\272\215\307\333\264m\243y\272\t\035m\373@\332\245\300\275\017\367i\026<\357\323\"e+\237.\201\306K\304\342';\371\3478\314\223-\252\241,\025"
+	.string	"\242\223\340L\300\317\037BaQZ\304\222\330}'f\036.60\"_1"
+	.ascii	"\342\346,\346a\013\007\352$\033\333\355\232\330\227\t\032L\r"
+	.ascii	"\021wy\252&\247hj\017"
+	.text
+	.section	.gnu.lto_beeperOffSet.178.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"\325\t"
+	.string	"\026\323E>0\345(\035p\037?\334\302_\363s\255_\346$Q\323\200\265c8\354\370Np"
+	.string	"u\251p\374#\354\263\301\365\035\371:\263e\2744\024dF,\316\025yH\231\277@\026\352\177D6\3312\2451"
+	.string	"2"
+	.string	"3"
+	.string	"\237\fO\340>\267#p\237\016m\003\037]{\231\225U\f\301\356v\362\344\3415\364\337\362\215\310\002\271\026X\354\256Ud\215\334\362\266\033lW\3307\b\376\266\273k\331\262\017\3737U\253\252\317-\320\004|\020\330\025\251\321V6\001\250\330>\307\236\by\270\332\177\235%<\f\345\315n\311kfw\204\260\203&\027\017l\362R\345,\260\"Qi\315\266\3510(\315\356z\276\313_:\374\224O{\234\364\342\247\177\342>/;(\260\224\326\254\001f\003Vg\366\250Ri\342\366\274\b\017C\002D\3419\3200}F\233?O\206(D\002\277\356\013u$\321g\324}%S\347Q0\270\001*u\034 X\3528c\352\333\312\226/\022\310RRe\2251\250\216+\026\f"
+	.ascii	"\002Td\342E\320h\270\350W\005\002\304\265J\306\360\212\231p\301"
+	.ascii	"\333Z\215\006wy\321N2"
+	.text
+	.section	.gnu.lto_beeperOffSetAll.179.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`x"
+	.string	"-\n"
+	.string	"\366\323HA0\213(\035\203\207l\314\237\314\374Ay\034\351O\331\345#\252\323\346\357H\327\336\247\203\377\337\343D\315o\2456N\237\250D)\200\226B\300"
+	.string	"\212\302\b\205!g#\025\020s\350\033`\272m\"eJ\0014"
+	.string	"3"
+	.string	"6"
+	.string	"\001\254\273\245\006\022v\303\f_T\036\375\331\031\036\236\366\251\b#\b\033v7\323\004\377\236\237\177\006\207"
+	.string	"I\002\236\017\036\273\353\004I\004n\275m\013\333 \366c\02669\330a(\025\201\375kw\327j\262\217\372\243\246\257Lk\2463\323\257T\030\250"
+	.string	" \265;\240\305\332U\234\260\300\366-\266v\341\222i_8\276\243\002\017N(N\273\253\371\016\036r|\005\217\366|\362\340\243\377\241<F\f\240\006\325K\217=UuB%*]1\236z\021+\224-G\275RT\243\016\240l9)\024\b\3264\r\215d\203\353\300\":\032O\367\341q\033\216\033\261x\303J2\030M\267e\033&\323dDL\262\315\343d\230\204\273\r\347e\235\256\3632K\b\372\265j\n9\260\002i\310\227\332\335\003\013"
+	.ascii	"\221\223\340L\350\004\n,\340w\320\305j\245\006\021fx\3512 \230"
+	.ascii	"\232\007\356\334\242\235O"
+	.text
+	.section	.gnu.lto_beeperOffClear.180.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"M\n"
+	.string	"\306\323HB \253(\035\300\322 !\001W\f 3u\360\\f&\246\201\221A\303_\217\375hQ\007g\007\333\020\236Y\024\272\031\354\241\200~\354\t\002\b\006\332:Wa\236$\360\342\372L\203J\337\032\331D\312\224\0023"
+	.string	"3"
+	.string	"5"
+	.string	"\025\230\307\211Cd\217\330\037\262G{\266\205\207\254\275\203\006\251V\206\335\325\024\300\275\247\347\037\3013\237\312\344y\341\330]\347\247B\271\365\266)lo\330\337\004>\266\273k]\331\007\377\230i\315tf\372\027\t\002\023J0\354\236\2746\254+B\030`\373\032{\213`\361\264o\340\007\274\203&gvY\300\007\273\341\205\003\252\032+\244RP\371r\324\324\254\225R\261I_`\302\354\356\346'\270\202\021_\300\243IJ\371\357\321/e\217\327M"
+	.string	"\360\224/\247\204\025\n\233\032\354\020\225\332\342\3366\214\315#\303\243\301q"
+	.string	"!uB\2309\316\007\350#\3528\215\373h\"P'\244q#\222\306\211p\027\342\031i\"]7\3224\341\351\330\352\312\035\005\\'EY\225\201i\303j\375\273\240\017\r"
+	.ascii	"\002Td\342\205\320hx\364!\004\002\342\n!G%\bC\250\002,\227\001"
+	.ascii	"\255\325\024p\227\027\355$\003"
+	.text
+	.section	.gnu.lto_beeperOffClearAll.181.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375 \366\275\006"
+	.string	"\262L/5@o\222\016@\355\224\0051\304\177\020_`P\234\364\203\237\034v\002\013lK\335\306\246\302v\255\242\005^PE\242\242\250:\261\003\207\021\247a\200\357\314\310'D\246S\023\303F\303\251\250Hi\"g\243\320\020)\353!N\002W\016\013V\204\250*+f\266\254\017\224 \"e\317\363\355`>\242!\235\201Pf\036\334\217\202H\334\215\302'.W\255\360^\230\302\tE%s\245\335\250\343$\035\313o\036\3672\276\227|\240\177\004\036&\327(\323\242\324\222$H\302\36173\366)\335B\331\221\222\n\221\225\314\214O\243X\035v+j\200\366\241\250\003@\310\314\235\366\271\350\257\177\301o\360c\004\b"
+	.ascii	"3\001{8#\354\370\032\327D\262\020\360\313\020\340\322-\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_getBeeperOffMask.182.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"5\007"
+	.string	"\002\01635`O\322\001s\030\035\004\210\004\334^\370\302r\234\313VkP\020,\264\352\310\027i;\324?\301\222\232yDFQ\024\024\005n\005\300|?V\036\007\331[\312\224\002\2566\r\035\216\307\252`\305\201\236\316\202\003\254\256\017\334\020\330z`\270 \204e]\220\212\331\335\352\310\252\311Td\373\363\223\210\200]\213\004\337\344Q\302\377\370\363\004(\257\375\371\240\351/\265\300\243$\313\222)\215\315\030;\212R7\354\273\325\221\355t\252\301\212\013E\312.FIf[\236J\210\355\220M\371\"\037\t\031s\261c\233H,\027(0\273\021j>0\375\271\013L\177\312q\354\211\371'\271{\231!i[\305\023@aw\235\332\226q\353m#\330>\260\r\022\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_setBeeperOffMask.183.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`<"
+	.string	"\275\b"
+	.string	"&Q?9@s\322\001@$\"z+t\376%\200\203\306D\277\340\240\341{a\232J3+\311\227\264\366\347\2470\255H\257M\372U\024\335gd\227\337\325g\341\350Y:\215J6\331;\245,"
+	.string	"0"
+	.string	"-"
+	.string	"\331\007\264S\203\366\315G\326\376\305\246\243%gw\353\0349x\t\372O\271GTq\\\002D\354\256\245\250\372\270\347m'\330\206\260\355\nse\277\365\313\354@ff\003g\327#\266\2630\ncb\373\037\233#Y\270\264\177r\024\360-\224=\273!.\256\335\221\301\n\001\247\b'\320N\003r\332\030gA\031\260v\227\363U\276\222\341\227\234Z\343$/\236\372'\355t\253\001\te\314\362\025C\263R\307\036Sr\212\330\317vw\035\346\270\006n\302!\364\260\tT\230@\244\314\335F1\022\225\274\256v\242Z\032\201H\265\373Lu+\260g\021\372\352\205\347}\3653\206\317v\256,\361\202\2053\345\b"
+	.string	"\002Td\342Q_\264"
+	.ascii	"\027b\\F\261V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_getPreferredBeeperOffMask.184.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"%\007"
+	.string	"\002\21624`O\322\0010\345\"H\236#\023>\374@\324\233mQ\035\240\013\026Zu\344#m\017\364H\260\244f\036\221Q\024\005E\201[\0010\337\217\225\307A\366\2262\245\2464\r\234M\247\242 \265\201\035\316\202\003\244,\017\324\020\270z`\260 DUYp\212\330\335\252\310\232\3014d\333s\223\210\200\335\212\004\277\344Q\302\367\370\363\304'\237\375\371\037\351/\265\240\203\004\313\315S\306&\214\035C\251\032\366\335\252\310v:\325`\324r\251\354^l1\313\362R@l\203\354\311\017\271\b\310\227\213\034\232\204\362bq2\332\2150\363\001\351\317]@\372\323\215_\317\313\377\310\235\313\266\222i\024O"
+	.string	"\205\335uf\032\306\255\267\215`\373\300\366G\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_setPreferredBeeperOffMask.185.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`="
+	.string	"\325\b"
+	.string	"6\021@< \0057\035\207lA\213\340+b\313i0`$\013\250\242\326\370s M\002\024BN\006\2657\bLr\263\377\216\346\256\202"
+	.string	"\202\205%\007\024\233\365zx\032\344\326\3666z\223\275S\n,"
+	.string	"/"
+	.string	"-"
+	.string	"\330\007\262S\177v\315\307\325\336%\200G\213\315\356\326I\362\357\362\363\237\362N(r\\\006H\354\256e(\246\356y\333\b\266#l\303\004Se\237\365Kl\"5\363\275v?^"
+	.string	"\266EcLl\337co\035\013\227\366O\216\362\235urgWD\346ewdp\002\347\364\340\004\331ir\332\031g9\031\254vw\363U\276\242\341\227\234z\303$\037\236\372\246\354\364\201&\004\224/+\270D\327\312\033{D\3119b\037\333\335u\336\266\206\215\302\001\004\241\tX\224>#\314\234V!\n\221:\256r\241J\022}F\225\363JU+pw\001\362*F\327y\3253\202\307v\252\314q\201\264\300\211r\b"
+	.ascii	"\002Td\342U_4\001\027b\\F\261V\243\301]^\264\223\f"
+	.text
+	.section	.gnu.lto_ensureEEPROMContainsValidData.part.0.249.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`l"
+	.string	"\205\b"
+	.string	"\262\21645Po\322\001\200\336\201\331\351g|\231<4\013\002eTb\255\036\313\253\316\201:6\324z\006\024\021\330\252CY\315\230\201\2711\361\377f\303T\bN\213\367\2262\245\2664\f\035\216\347\262\240\305\201\236\216B\003\264\260\017\324\f\370rX\300\340\303ua\260\262\235w\253%o$t\244j\262?\004\036/\375\b\021\221\327\\0R\221\037\237IuT\030\034(\337\236I\225\234l\266\244\232\254\356n\265d;\201\003\223]\212\027\227\315x#\033>\352\021t\020'\220\034\005\272\277\205\354\312\3372\273\372\373\207\355P\2053[\345\361\264\0279M\204\260\354.\374S\215g\327t\231\237\032It}|\246\254h$\213g\300\035f\263\273\006\270\270\337m#\3306\260\237\001\031"
+	.ascii	"\026+0~5\026\210\202\301tn\343\263%g\255\203\227\200\205\300"
+	.ascii	"S\200\314e\216\302\230\305\312\236P\203&\330\352i.\315\006:\027"
+	.ascii	"\264\351\262s\001\340\304;j\312\314\363\257-c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`\340\be\031"
+	.string	"6\250\217B`\350\315pp[\244y\374E\362\374HW\361\316'\237<\2627\f\351U#\200Q\021\251\304\363\345mnWi\374\321\230\001\013n2"
+	.string	""
+	.string	"\200\242*"
+	.string	""
+	.string	""
+	.string	"\300D\237\331?\263\240\314\233\211\260\255\334I\006}"
+	.string	"\203"
+	.string	"w"
+	.ascii	"\3751\035\372`8\364\321l\350\237\321\320\027\243\204\246)\227"
+	.ascii	"X\206>\241\022C?\314\205\276\027\013\3752W\313*\374\211I\241"
+	.ascii	"OfB\037LB\377\253\214\3602\bO\023p\264\007?s\360\265\301\315"
+	.ascii	"L\006G\232\234L&\007-\350{)\350w%8\034\023A\237Ky\240\277\245"
+	.ascii	"4\320\327\002U\340c\346\356\226\351qL\251\237\205\207\246\351"
+	.ascii	"Ql\267w\341\216\037BQ\0245\366\277\224\273\013\240.t;\372ut\364"
+	.ascii	"\355\344\350\337\301\321\307s\243\237\307F_O\215\376\236\243"
+	.ascii	"Gt\327\230\244\321\347\363\031g\"\343Kb\274\t\214;yq(.~l\361"
+	.ascii	"(,\316\265\342ST\274\212\231\342T\314]$Y[ZVU(~\305\334\215\332"
+	.ascii	"\212\232\332\242\322\242\312z\252\302\332\253g'\216\3054\321"
+	.ascii	"\027+\321\177\343\324wC\242\337\246\251\317fD\177\215\210~\030"
+	.ascii	"\323\245\230!\372j@\364\323,\365\315|\350w)=\004G"
+	.string	"\264\256\356\276\201\302\254\274m\231\217\t\254?X!Am\213\364\361\200/3\037\367\326]}\fT\227\177\353\362O]\356\255\313=u\231\267.\363\324\245\345\257\313W\227\235\230\226\261\372jW}?F\372pE\372qD\372\200\206\364\353\204\364\333\254\372nA\372\177\252\372o@\372}\250\372rS\375\265\037}6\251~\234\250\276\034\250\376\234\247>\035\037}\262\036\3759\036\375k4\032\221\214\334S\213\314K\317\"\037),\262T\221\230\304\247K\342\257s\304\223\310MB\"\007\370J;\031hw2\320\313w\362\317\016\351\344\236\327\311\277\223\333\270S\356<\031\b\207\304O\377B]I5\243\243\267\243\241\021\037)4\342\013\213\270iX\304\275\224h\030\034\362\325!;\271\r\031\310F\304\2776\242M\023\252\t\327\204|\344P\220\177\026d'\264 +Q\227\314\307I\220\354\343\200\221\2501\fD\342\352\024T\262u"
+	.string	"\003\231\241Qq\021@\024\3102\205\210\200\004\022\211\320\005y6\f!\35311\320\361\033\341\030\225\273\277\305\bBE\305\347\226\302\202Y\241\217"
+	.string	"\016\026\272\302Y\ff\344\267\264\232\345\020\365\201\307G\202\020\rn\001\350O\242\253\203\3732\232\205U\006\001\377\305 \034&\220\321A\314\304\331~[\327E\263->\226YkuT"
+	.string	"C\377O\252m\326\342(\021\275\357\377\373\377\376\277\377\357\377\373\377\376\277\377\375_^\013\004\342\t\273@v\226\005-\037\203\231\344\300\310!\026\202\353xl\266\277q6\242L\025\022+\355\237Y\205\244R\323X\255\225\276\315\027\370hE\2576\224\256)"
+	.ascii	"\212\005\337\006\200\230E\217\313\320\206\335\273\226\212r\034"
+	.ascii	"\304\336\232a\t\026\212\270X\372\3340\202~$L\337'\007|\025"
+	.text
+	.section	.gnu.lto_.refs.cf07173b670378b,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"\035\007"
+	.string	"\342\316-0pM2\034p<\005\345\344\372\013TUUU\341\377\377\377\377g\221\020\214 \210(\200P\204\206\212\203\346\334:X\324v\333\204\254Y\322\332\2262\005[4\243\030\275P\023\255\250+\205\222\350kD\035\n\321P\037T\003\003h\201\n\034\363\351\321c\002\277<\3367\302On\203.\340)\340\222\273\3039\216_\334\234^\367"
+	.string	"\347G\013\313\206\277\262\371U\026?\005\345\304\244\204dD\244\375!\215\017\322\336\243=G\343\033\3555\312%\372\241>H\323\237\246\0370\356aO\300x\207\275\233x\300\364L\342K\372\214\364\321\342j}\327\231\017"
+	.string	"o4\206\267\362\250\257:\325\263#\023"
+	.ascii	" \004\334\27546SD\317\240\317\234\325\022\016\314=\347\r`\002"
+	.ascii	"\260\005v\300\0300\001v\300\0300\371Z\314\030\253\340\001"
+	.text
+	.section	.gnu.lto_.decls.cf07173b670378b,"e",@progbits
+	.ascii	"(\265/\375`\335`\235\220\001z\227\256\221V Ja:\215\001\205C\340"
+	.ascii	"\260\316Og=\215\317)\3069\034M\337x]\031\340;\311\263''\217\026"
+	.ascii	"}\373\207|\337uf{\313\035\231SX\3336\255+p@\333\266I\2326\245"
+	.ascii	"H\232iW\216\367\215\267\236*\236\266DA\020D+\211\3709\324P\331"
+	.ascii	"\366\226R\312\024\377\007\t\t\240\tA<{\213\341\271\300-\354\333"
+	.ascii	"\224\235\203\260\315\225\225\3410|\205\261:T]m\2520&!\\seu,l"
+	.ascii	"Z/\310\233\271\262:\034v\363\360\024v\262UB\334\n(YKSsee8\f\277"
+	.ascii	"\260kf\020'seu8\fWa\024\366m\312\246\352\302@H\330\\Y\335\336"
+	.ascii	"\033\251\264c\242\006GQ\276G{d&Y#\363?Q\364\177\222\350\377\364"
+	.ascii	"\320x\013sYd\022\356:\n\361\314\305\2611\345\346\377\204\351"
+	.ascii	"\333$S(\311\374O\227\376\017\225\276\217\033\215S`\025\026y0"
+	.ascii	"x\305\217BAh\242\264!r\363}\346\364\355\301\230!\260\007c\336"
+	.ascii	"g\213\306V\330\204E~\013>qLe\337\316cu\334h{o!\241.t7\326n\276"
+	.ascii	"\017R\227\330{o\373-f////\317~\213y\037$:\343}<\365_<[\345j\027"
+	.ascii	"l\303u{\363Uw\263\375\262t\274\215\314-\257\343\236\262\367\026"
+	.ascii	"\302k\\N\330\271\371>d\372\307\032\231\377\275\223\004d7WUv\363"
+	.ascii	"\177\355\\;\253\205\313\217\0237_#w.\003[M\256\235}r\251\202"
+	.ascii	"\250\216{\212Dr\377\277un\335\275\263\310kw\351~\347\\:\026\355"
+	.ascii	"\332]\031\227\210}\333Q\232I\221\334{o\260\001\322\0067\215\221"
+	.ascii	"\254\206\316=0{d^\21652\357#\246o\253\234\231\360\202v\344\f"
+	.ascii	"\232Y[\033\2244+\307\344\213\026$nF\264%`\234X\261rhT\356\334"
+	.ascii	"E\336.\370h,A\216Ir\357\035\303\224\344\334\225\322$\231D\fZ"
+	.ascii	"\331\2308\327\3155s\317\\\270\333\346\302\271\311+\347\226\271"
+	.ascii	"q\227\315%s\337\3345W\356\246\271h\256\032\213\274sQL \233\250"
+	.ascii	"\031\217W\320\224\204\231\273O\252$\367>\002\221i\221\026')\377"
+	.ascii	"\322P+3\262a!;\273\222\304\250\345\207Y\332\022\343\026\037m"
+	.ascii	"Y\200\274\255\0051R1\363r\303\\.w\314}\273_\256\333m\273b.\030"
+	.ascii	"\213\274]\376;\305j\271]\352r\255\244\345P\222\334\373(4\347"
+	.ascii	"\013\210\235\206|\037\025\372=s\364{\312\350\367\250i${d\276"
+	.ascii	"\247\211~\217Q\277\347K\277\007K3\331#\363<t\372<`\364y\266\350"
+	.ascii	"\036kd\236\307\211>\217\020}\236\031\372<+\3645\035}=\247\257"
+	.ascii	"\327\364\365\231\276\346\241\257]\350\353)\375\236\034\375\036"
+	.ascii	"\234~\217M\277\307D\277\027\246\337\273\3227\333\350\233s\372"
+	.ascii	"V\213\230\235\221\307\355q\201\334\035\367\307\035ru\334\"\327"
+	.ascii	"\3075\336 W\310%\263\310K\344\2771\256\027\330]\033\fl\2148\334"
+	.ascii	",\345\210\322\306\326Yc\224\263\201\227\274a\302\216q\254.yi"
+	.ascii	"\324\220\3133\316\270\"r\277\242\334!r\303lZ\216:\311\275\217"
+	.ascii	"\033 \365jP!I\322!\337\354\242oF\3217\201\350\233/\364M\023\372"
+	.ascii	"eR\277l\323/\315\364\313/\375r\205~\246\243\223\354\221\371l"
+	.ascii	"F?\227\321\366h\217L\2442s?\222u,\222q\342\030\347\266\352\240"
+	.ascii	"Dy\003\301.+i\345\320\360X\2223\343M\315\r\243\234\031\037\306"
+	.ascii	"682\343\033\033\311\266\337\312\255\261I\024_\3117:\326\315\276"
+	.ascii	"\355\330TTIo\222s[uU\254\3305\373\346\265\247\336\204\240\263"
+	.ascii	"6\267U\267D'\343\355\267hd\202\030\345\316\364H\356}D\333\262"
+	.ascii	"$\2714\307\272\005Q\rm+\024^F40e\377mqS\330\273k\302\332\261"
+	.ascii	"x\267\352\242\270Y\366\316\205qY\334\023\227\353\356\253uW\\"
+	.ascii	"\254;u]\334\255{u\255\256\212\373\342v\331<\213\274T\277=Z'\277"
+	.ascii	"\307\275\255\366\336\267e\376%85\222{\037\255\\\232\035KulZ\320"
+	.ascii	"\324\320\2562\203e4\363b\323\360\321\330\243\242#\t\210Ke\343"
+	.ascii	"\254\033>\256i\025R\200$\271t\261iAS\307\255E\002ln\253l\357"
+	.ascii	"#\332\377\001\204Ke\263\330\265\336~\333(\250\3500\303^\307\270"
+	.ascii	"/u{\0377@\332 \b\r\016\235\026S~\316\241\237_\350\347\023\372"
+	.ascii	"x\216>F\243\217\271\350c\244>6\323\307=\364q\rm\331\3306\026"
+	.ascii	"\211d\335l!\013W\305\242\306\315\307"
+	.string	"/t\b\266E2\237g\221\314c\023\372\267\215\376m\323\277R\364\357\020\375+\246\177\265\364\22052\237\234\243o\347\364m\027M\201=2m\030+\306\"5\260cn\277\330\266\227T\307}\334\373(t}\334AB\271\371\366\212\276\325\300\304yyV\003\363V\211\036\262G\346\265F\346\255\016}\013C\177\212=2oO\350\257\331#\363B}/\366\310\264k\327\252Y\266\3335{\345\037@\370\217\225]\313{SY[A\220\265\025\224[\200PA1\363\233\364W\320\177\263G\246\215\301J\261H\017\226\312?\200p<\365d\233\355}\024\002\302K\202ww\363\035\240\177\230n\247|\003\334\006\341H\372\326\203i\363\254\007\363\245\246\300\032\231?c\217\314_}\223\366\310T\262F\346\217\326\310\374\300\036\231\277e\362\333%\326L\003|\205\005\266\247\354}$\322VY\322\314n\376\321\036\231\332\032\231pJ3\377\225\212"
+	.ascii	"\204\377J!-\375\227\204\206\001\334$\031\004\200\213\314\f\206"
+	.ascii	"*\260]A\036\376K\002\377\\\203\036\363\210\216\t4\206H\307\315"
+	.ascii	"\177\211tj\324p\346\311\202\271d\255f\350/\273\310\275\367\227"
+	.ascii	"i?\306\371\347\277v\027\356\216\316\177\231d\034\346j\327\177"
+	.ascii	"\311$\343\227\177\351\246v\341\242\374\330\n\026\"&\363\337\034"
+	.ascii	"\331\347\307`r\017f{\007\271{\370\3138?\226a#,\007\017\354\343"
+	.ascii	"\354\003\377"
+	.string	"M\223y\376\313\201#x\315\177\231d\314%\353\377\035\256\334\215\376\022\314\177\231d\034\005S\t\313\275\377\2769\271\273y\331\374\317\002\276\315\345\217\311~\353\201\234\377\313$\343\337J\371q\221|\377\213\302\177#\360\337\"\331\342$\371?>\376\327\006\316\303\373/\002\376;\004\337\371\257\207\377\032\261\235\037\363\374\266\353\316\326\371m\336\217\353\374\227\f\333a\371\355\331\177\177\340\272\377\032\250\375\357\200\351\234\001\177\231\343\2677\326\302~\373\365\337\036\030\316\177\253\334\374K\031\377E\266\270\375\313,\213\376V\375\355\357\267/\374\370\315\177u\340\344\177\026\376\007\340XNe\300M\033#?l\016\364\233j\377u\341\277\351\177\205\377\035\376\267\370_\342\1779\360c\016\374\367\374\317\363\233r\327\314\0325&\335\217Q\3748\305{G?\226\300\217+\360c\n\374\230\205\037\253\360\343\t\374\370\002?~\221\346\307\t\370q\n?\216"
+	.ascii	"\232\377B\177/\203\037\237\371\361\334\217\313\374\030\356\307"
+	.ascii	"c~\034\346\307_~\334\345\307Y~\314\366c\265\037[\371q\332\217"
+	.ascii	"\243\374\030\312\217\235\374X\311\217\215\3748\310\217}\374\230"
+	.ascii	"\307\217u\3748\307\217\307~\034\366\343\033?\266\361c\032?\226"
+	.ascii	"\361\343\030?~\361\343\256\037\253\370\261\007~\374\302\217\323"
+	.ascii	"\037\007\177\354\364c\337\2173\360c\f\374x\351\307\021\374\030"
+	.ascii	"\351\307\032~\234\341\307E?\036\372q\320\217\177~\334\363c\363"
+	.ascii	"\307\371\307\377\357\335\177\355\376K\347\277t\377"
+	.string	"\205\363\3378\377u\363_6\377U\363_3\377\225\373/\334\177\337\376;\346\277a\376\333\366_/\377\345\362_-\377\305\362\337\265\377^\371o\225\377\"\377\033\303\177\237\374\367\370\337\263\377&\371o\331\177\217\374\267\310\177\207\374\327\370_\262\377\376\370o\217\377c\376\273\343\277:\376\233\343\277a\377\025\373\357\327o\273~\353\366\237\312\177_\370\257\372_\013\3747\001\377\375\340\277\377\355\226\337j\371m\330o=\360\333\016\3747\373\317\201\377`\376g\220\227\227\227\367\363X\340\337\200\366+@H@L"
+	.string	"\333]!\222\204i\253/1V7\177\002#Z\004\023X\260  J\230$\020\030-\264\261\233?\001\230\026\001mm\255\254\302\223\004\306GGZ[\227\233?\301\226\036Rczy\345\026Y^)}\340+\260\315u"
+	.ascii	"!d\346\31288\361\365\345\346O\260B\213p%\255\254R\264\367\336"
+	.ascii	"\306^\fQ\252$\267\227W\022F\321e\r\335\313*\270\005N\203\344"
+	.ascii	"-H\236\026\301\313\224\227\310)\345\231\336{\352\207\n\r0A\324"
+	.ascii	"h\021\306\240\275\214\001m\313kO\305\371`K\2134ku{\313+\351r"
+	.ascii	"!\241\203\345f\036\315f\247\206\361\346{\230\323\367\220\246"
+	.ascii	"\227p0\275|r\213,\237\224;\222\300v\327\007v`s[u{{q \224E\004"
+	.ascii	"\310\013%Z\2042\307\322\311\261<\323S{O\035\267\026R\026\257"
+	.ascii	"\244\262K\0178\0307\337\303\016\315D\205\251\\R\232\275d\202"
+	.ascii	",\231\224g^{\352\r\bH\252\322\254\325m\257\255\244\377t\026Y"
+	.ascii	"\236\275\315\317\356P\302\025!\243r\363=L\351\337\376\376\346"
+	.ascii	"\356*\217{\255\352\307\374\355my\233\364\003Yl-\370\237\367\276"
+	.ascii	"\224\007\366F\241\006\266\367\266r\3146\261\030rn\376O\301\376"
+	.ascii	"\377\273\367\024\330\026\321\325\336{\037\305\270\210\256\320"
+	.string	"\304\266\256\254\304b\330+41\256+4\261\251{\025\206\212kk\213M\351\r\306\265\255\366\326WT{\243\201q\021]Ym\256+\264\275\345s\024\333\373(6\245\217T[{o*{u\024\003\273\262\022\343\"\272\262\022\343\332hb\\\366\nmom\253\275Ut\2657\327F\023{c\257\266\330\326\025\032\030\027\3216\021g\312\n3Cb\330\032\3071H\234\\Ym\026\021\224Y\201m\275]\035\301\354\332\336SSN\354-{\334[l\357\032`\025\254Y\221M\255U\275\261\350yY\035\367\336{JFV\325\030\030\317\261j\277]\025\001{:\261\367\231\235\025b\312N\035\367\336(v\325\224\335\373\304qk\357*0\rx\355\2757\230-\203bk\003m+*\254\2521\260\237\023U`(v\2210\273\367\336\\Whc`Kl1\240\031w\325q\312^a\201m\343>#\266\245\321\246\216\373j\357m\343"
+	.string	"\321\271\"Ww\3631\203\027\022\0267\227e&\340\310l\334\374\016Vty\304\206\222\031]n~\2073]\026i\363%M\355\346w0\352r\310.\223\003s\363;\210\351\322x\034\003\353\025xjb7\277C\f]\222\375\306\270A*\360\254\020\271\371\035\246t\371#\003q\331B7\343\346K G\227=~\336\300T<\271\371\022\260\321G\237\265/\244\213\233K\035\022\200\323E\005\2312G\017\0253.\316n\276\004YJ\034\345X)\346\344j\016\225\233\377\022\354\245\330_\206Y.?=^\264p\273\231\307\032\231v\311\322K0\24185:\262\2335xaz\266s\213\314v\312/\273e\367N\223K\221\334\333\213\003\237\262\030M\356\334l\243<R\267\302\356\346K\200\246g\224Se\f\354d\013\002Uw\2229\257\234Q\312\300+i\2245,\262\234Qz=\337\311xA1\262x\335\231\371\022\020\321\227"
+	.ascii	"\207\376\313\252\2271\376\234W\356\022\306\345\341\001\345\304"
+	.ascii	"\227\233_\344+\032X]7_\002.\375\277\344*[\224Z%\213\262\253\334"
+	.ascii	"\262\310\322E\211e\245\305\252.\211\242T\201\235li\265*6X\262"
+	.ascii	"J\027\345\2125I.&\334\230\225.\312\023L\342\220\300\251\333\373"
+	.ascii	"\210\264\201\r#'\006\266\240\374\b\310\350GpE?\002'e\n\213&\205"
+	.ascii	"\307\335\315\217\240Gy\365\r\344\223cm\n\325\315\217\340\206"
+	.ascii	"~\004Y\372\034\356\3649\300\351\222j\351e\325\004V\266\260\335"
+	.ascii	"\334\343\242\315m\217\314\277Y#\323,c\215\314sxrggV\246\306\324"
+	.ascii	"\315\267otdur\235E"
+	.string	"f\273L'\037\367A\330\3459\270\005v\262\245\245@\001\"D\206K\315\230\231\317\201\210>\0071}\016(\344\3446ZM\335\224\257\270/\020gd\030\347h\230\221\253\261&\307\311l\262\233\374&'3\034\213\314m2\232\3474Y\315\355qo\253\334&\227\261\321&\207\311p\366\315ko\256$\"qt\234\325\355\2753\026-J\336\206\262-\263G\346\006kd\036\351M\037\211\212>\322\017}\2440}\244\030\372H)\3647\310\351?\213y\206\373s[\006\223\311h`C\320\333\221#s7g\267\374\366L&\217\311dB\200\355M\225\311\b\331\331\233J\310\332\n\254\255 +\031\013B\305\314\337\360\246\255\334\322\263\230\236+\311%Z7\177\003\030m\257\354\221I\224\277\260\365\244p#\243\316\315\267mH2c\024%P\256\026d5\264WT\231e\266\374\344j\330\311\226\206\023qL\222U\320\226$\235\234%\251"
+	.ascii	"\311\222\267d.YK\356\222\325\362Z\276\222\275d,\026\231\331r"
+	.ascii	"\332s\225l\345\231-K)K\232\305\220\304\230\331\362\024\353\006"
+	.ascii	"\002\034\274\255\262\275\217\267N\210Z\226\206l\337\354\221\331"
+	.ascii	"\301\032\231\3370D\177\003\f\372\033h\350o`\241\257\341\216\276"
+	.ascii	"\2065\372\032\300\350k@\323\327\200D_\003\017}\r3\216L~\266\272"
+	.ascii	"\034\2237\037\004\222\025fD\362\222|"
+	.string	"\226\315r\222\254$7\261\310\314$\227\335\263\",\222L\362\220\034^mG\242`\275e&\331\b~\243\232\n\301\206\305\215\035 :kq\346\202\362\217\222\372Gn\372GX\364\217\232\350\037\361\320?\232\241\177t\245\377,$\223\211yr\207\343\346\333\263\024u\306-\334\"\310jh[\215\2411\346\033\271F\356\221\301\362X\336\221\201dc\016\3136\262\216\234#\303\220y\344 Y,\377\31042\216\354#\177Yd&\3133\216c\340+\273\344\336\307.7#\b\231,\277\310^ASC\333j,\214q\357muG+\215\026\024u\222lXqlX\2501f\255Yr!&y\342.\311u\306\250\302M\031\023v\250\362\2142\300\254h\223\314d\271\n/y\226\311r\013\003\300\231\361R\266\367q\003\323\005\217\"g:\310\317\200F?C\030\375\347\030\317^6M\003{\243\001\265\321r\004rs\206\261\364\034\343"
+	.ascii	">p(\271\031[#\363\031\270\350g@\323\3170D?\203\016\375\f1\364"
+	.ascii	"3d\351\033\321\351\033\305\351\033I\3217R\242o4D\337\250\207"
+	.ascii	"\276\221\f}\243-}#\024\372Ew\372En\364\213\304\350\027!\365\213"
+	.ascii	"\230\350?O\341\231g\342\276\234\334\374K\303\013\036\236\243"
+	.ascii	"e\2277\276\303u\370\016\256\203\355\340<\213\304x\230N\216\203"
+	.ascii	"\341\340\343\032\004\342f$\351\274\214o_j\340a92\222x\270K\031"
+	.ascii	"<\f\006\303\261o;\366n\321\001\221!C\344\324\355\275\257\213"
+	.ascii	"\030\232\340(\312/\262\322'\252\243O\304F\237\bN\237\250M\277"
+	.ascii	"\341`\222\311\325\331r\363\211\320"
+	.ascii	"t\034fc\337vd<\265d\022\267\261H\354\006\303\271\301a0\231\240"
+	.ascii	"ro\252+\306\275\367\006\0346\360\271\201\203+\205\231\327 \341"
+	.ascii	"\272/ki7\237\250\207\276m+\2034\232\301oA\345\336`T\2148\rV\203"
+	.ascii	"\317X$F\203\347\320`9\374\026Du\334[=\036T=\312\352\3129I\273"
+	.ascii	"7:\237\350J\177h\215\376\220\031\375!2\372Cm\372Ch\032\267\331"
+	.ascii	"3\374f{]Z\234`\271\031\213\301c,\222\003v\203\263\243\212\353"
+	.ascii	"\346\017\231i\020\354m9\2306/\317r0?T\246?d\324\24652?4\246?"
+	.ascii	"\324\245?\264\365\217\271x\020:\302\310\302q\363\217\267\250"
+	.ascii	"\225[\222@\252\334|k\326\243\314\270d\354\201eG\234\022$3\214"
+	.ascii	":\226\340'\370\nN\303G\274\206\261\340\030\260\026\f\005[\301"
+	.ascii	"g\270\nn\202\263\340(\230\t\226\202\321\260\023\214\304S0\033"
+	.ascii	"\246b\221X\r\233e\034gV\356\007Y\033Y\325\217\034L\222j\270\f"
+	.ascii	"/\301N\266tZ\225\214\244\221\032Gh\030\211\3340j\341\221\304"
+	.ascii	"(\204\007\227\"_I\037A\320\306\232\230\261\2202f#Yef\304j8\b"
+	.ascii	"\n(>\222@\342\200\030\227\260\032\036b\323\214L\0351\031\212"
+	.ascii	"6R>\310\027\212\203\225\330\2709uR\334|\24128\311\363\0230 L"
+	.ascii	"\005C\214\332\315\027\372\242/T\246/\024D_\b\006}!\033\372BX"
+	.ascii	"\372Av\372Al\364\203\334\364\203\254\350\007\035\321\017\262"
+	.ascii	"\241\037\204B\037\210N\037\310M\037H\212>\020\231>\220\227>\220"
+	.ascii	"\226>\320\t\375\037:\375\0373\372\307b\330\312\306\2175\267\006"
+	.ascii	"\226\201\2770\rl"
+	.string	"\003\203\341\033x\206E\3420\f\3438\006\366:\222\231\026n\021\246XO\234\270\344U\233$<]i&P\260)\221\\9ng\222\2541\341\004\r\321\322f\214\232\027YE\225\254\030iz*\324\356\330Q\2719D\2313g\314m\237l-\020d\325)\003\301K\225\234\233\257DG\203X17gZ\301\311\232\203'\024\266\263\330I\321!\262\312\224\231c\273\310\230R\347\346+\231i\020v\336\336zpvF\026\034\274\b\260\214S\310\274\007\347\323%\212\326\223\022\006l\206\353\307\222\233\257\324B\177@3f\214i\205\00465\247\007F\026\022\263\272\257(js7_iJ\203\250\001\006L/\214}\262\2652\310\311JS\243\316HW#\253\027\206G\b\2211\254\233?\2005:\204\220/_z]\204\360\250\3149Q\345\346\017\200\214\016\361\265eK\257\013\f,5uJ\2733\")\270\274\327\345\336\315\241bd"
+	.string	"j\372C\235,YL\253#YKj\340%W\206\320I\242C\304`cS\273\314x\341\031cFG\225\233?"
+	.ascii	"\036\032\004\fjj%\262\322\324\260h^9\334n~\007p4\b:+V\314\314"
+	.ascii	"0\356\355\225\024<\316A\306\351\020Y\244H\351\245\331'[\313\007"
+	.ascii	"\307\214\227\2626\\w[\250\274\227\246\361\320\334\230\203\024"
+	.ascii	"Br\267b\0169e\211\013\030~\034y\330\356\214\274\310\242C<\211"
+	.ascii	"\022\305Tql\265\277\232\030"
+	.string	"-\2304t,n~\007S4\bh\240@1Up\330\302\3023\326\375\260\025QAu\363;X\242AP3\273Y\317\211}\262\265V\200\202\004N\331\217V\0217\344\361='i_\262\\\271\371t\275&\377y\256\03271\3124\351\235\225q\263af\343\377q\357(\242%\343f&\245\327\377\r\343\204\022)7\277\003\035\032\004\"H\220\364\224\024ua\251\251\243\237\244`\"\326K\362\236\022\037(9\356 \271\271Wv6mor\230\2301\324i\362b\311\315\357\200\206\006\301\205\020!=#_Yp[e=q]p\340\212\274gd\313\2115r\340n\356\021\321w\310&en\356\r\351\201\0313vc\313\177\236\374\202m\211\230\233\317\301\034\035\242\016\020 \275 H`St\346\234\254\263\272\24037g:zd\357\005Ys\333a%\314\315\247\273w\376\363\244kZfi\032D\033\037>L%YKj"
+	.string	"\031g\304@\344\346s\200\245A\230\341\301\303+\013\211Y\025\234\232\230.\032\304\233\016\035E\262\210\214\361\221+\213r\343\346o\020\246A|\311\221\243\247+k\310W\017\225\035w\224\334|\001\274i\020X\306\306z\340d\221\271(gl\211As\363\005PD\203H\013\013+\317\354\320\261*\256\211\361N9I\232\271\371\002\250\241A\240\335\270!\002\325\0209=Y\\JV\334|\001di\020Ll\3300\267\262tx\371A\2531\304\205\031\r\342\b\r\032>C\262`0+\333\333+)\343\235XQ\345\346'\305\240A"
+	.ascii	"a\372\337\223\321\223Q\236\331'[\213\003[2\311\346\345\335iR"
+	.ascii	"D/Aaz/F\f5B1\252p\261\270\371Iaz\311\214\351=\027=\027\275\027"
+	.ascii	"yh[\215\331\300Tl\270\334\311\346\017\"K\312n~\022\226^\342\322"
+	.ascii	"\303z\257\253\207e\246\312\213\016\313B&o\356m\365\270zZ=\026"
+	.ascii	"\275,\r\350\364R\030\274\367\254\360z*L\360\242\352:\300\222"
+	.ascii	"1\363,\213\211\267\233Sd\036\030;\356\370\270\371\032\310\351"
+	.ascii	"\036\212\336\t\334\202\213i\f\026\236\261\256we\221=\024=\023"
+	.ascii	"\031"
+	.string	"h\f,\005\225\234\257A\231\276\006;t\217\252W\325\233\352\355<\rT\350\2459L7\355\230vJ$IC{\217\215\321Bx\320I\253\323\037R\310\271YGN\334\330\030\2407fJb\334l\326\231vt\346\320\301\351\017Zjn\2761\325\230pR\320\300N\203r\346.\211\301%\353\346\016I\302\314n6\335\230I\263\215\311\306\\\023\200(\372\203\r\246\233h\320\224I,\321\3368\326\360\200\341Ba\347\346\007\200\210\376`$s\323\f\031\263\255\205\023<0\304\325I\356\255\032\034\b\341X\323\"\315\315\246\2349g\226\211\203\263\241? \231n\272\271\345P\341\323f\034Cs\363\003\200B\177x\302t3\214\031\306\024c\327\366\226\027\007?MX\2348ssX\033\2626^7?\0037\372C\030&\233\304\232Dn21\211\230mKU\233\312\f\203&Pz\342p\324m\335\374\345x\253\304yC\346\346g"
+	.ascii	"\247o\315\316\314#\232\244\023\263I\207\252+\023\314\316$\321"
+	.ascii	"\314\030\354\333\016\005\034\021\363\304l\0224E\2647\0167#\026"
+	.ascii	"\323\213\331\305\334bf1\271X\244\251\305\224\322fj1\241(\300"
+	.ascii	"lLR\2139\305\\\263o^C\333\352J\217\n\2617\033A\371\354l:T]\231"
+	.ascii	"p\246&i\252\231l\026i\256\035\351\270\367\024s\315D\232W\304"
+	.ascii	"D\360\202\245\246\016\207\r\200\340\2249C\303\314\277y\305JP"
+	.ascii	"\225\243\21687\233Uz^1\300\230\270\371\031\b\321\277I\305\"\315"
+	.ascii	"4MW\306vw\363\351\316\246K\21712\375\fv\350g@C\233Q\264\\\322"
+	.ascii	"\306\230\233\237\301\013\375\f\270\3643\300\322\317\300J\037"
+	.ascii	"\203<\375\233G\263\tZ\233\2341f\023\233v\343\304`U\335|\f\356"
+	.ascii	"\264\251\3044\023Jbe\312\304\3157\227\374\347\201@\017\267\264"
+	.ascii	"\233s\222\273C\006\22787\337,\023\332:\263\265\334|\023\311\177"
+	.ascii	"\036'.\255!7\233G\364\t\f\332hP\226\001I\343r\263y\344@5\206"
+	.ascii	"\340\310q\263Yd\351\246\221R\006\2300\0377\373X#\363\030h\321"
+	.ascii	"\037\340\230L1k\342\270)\304\304a\212%yQ\265Hj\022W\203\003|"
+	.ascii	"C\f\025\234"
+	.ascii	"\233M f\020\323\370\363\004ea\201\245\344\346cPE\337$\373\317"
+	.ascii	"\323\263\003\016\210\221\233\257\375\026\323\364q\363\307\317"
+	.ascii	"\343\203&%,\315\315\307@\212\276\311\303\354\361\363X\030\312"
+	.ascii	"\302\340\335|\f\232\350\233;\376\363\370\330\351:\343\344fS\207"
+	.ascii	">\201\201\020\r\\\370\022\262\302\314qS\307o\302`\241\274\220"
+	.ascii	"w\207\316\315@\326\310\274xK7s\370\214\341\222lr\3631\330\322"
+	.ascii	"f\r\023\314\024\323\373\212*\001"
+	.string	"?T\234\214U\2719\354\210V\344\354\356\304\315\277\340\2166o\230_\331\313\276ym*\256\020H\240\3508\2533\301,\322\274a\332\260\307\275\001\322\315aE\314\214\234\177A\032\375\013\272\350\354u/\300\242\001p\213\024+7\203Pg\306\f\274\233e%w\244L\207\320\345\345e\2274#E\256\311\315\277\340K\207\360e\3020a\230*\324\326$\255\362\202\270\270\371\027d\351\020\216\230.L\027jn\31147H\262\330\321!<\351\352*\317\332\316\200\271\263\342\346[\220F\207\2004\267\314-S\205\033+X\206\232\261\030n\276\005`t\bdL\026&\013\323\312\256*\315Z\035\024#w7\337\2024\375\001\006\323M,\2134\261\312$\370jS\211Q\320d,(I\021![n\276\005Ht\bv\346\225ye\252p\263\304\330\343&'+\316LqSE\216k2w\246\305\177\036s\214\226\235:7\337\202\036\232"
+	.string	"\\\346\t\363\204iE\367\223\265E\206\225\233o\201\225&@\030\223\312\2442\255\304@\361\241\031\373\272\3717\253,\322\264*\227`9\306\250@N3\221\271s\307\334\326FU\232\2652\241\2520\025M\362n\356\2360\260$Tn.\361x\234\270\311Xr\363\351\360\333\177\236 \243\234\037SQ4\223\216\273\337\225gz\227\005!\223Z,n~\005B4\023\024;\273%q\322\254\325\365\214\334\031\253\334\374\n`\320\004\340A\207N\251\346\350\rO\230\232\027\222\233_\001\013M\2005&\272r\016])\307\263\2672p\213K\263V\347\003\f\022\0367\237\2029\372o\3128o\3123so{\004\323\332\332^[ILdp\3128pv\030\267\227W\322-3\307\216\316\315\247\300\213>\005D4\223\0217e\322\315\320\256b3\303xfu\005F\207f\312\302\206My\306\201\b\221\036\037fy7\237\202\031\232"
+	.string	"r\320\240)\325\034}\201\022d\246\016yV\246y\251f\rh\213\214#4n>\235M\373\317S\216\315Y\243v\363)H\241\227\3340\2754s\213,\315\224H$\2607\225\214\244%q\034\3507y=\300\3504\023\2152\345\\\231R\256h\203\001i\022A\027\035\"r6\315\007\rW\031\2232\232\311\f\016\316\262\265H\263V\266\275\274\222x\252\304\325)\271\371"
+	.string	"\360\242\231\332\336\376V\236\351\315\301F\234,\304\311\226\215\233\017"
+	.string	"4M\201\024\246\227c\220\345\030\334\302\0040\252.\f\204\304\271\363\252\333\333\013\007@J\202\230\300\272\371"
+	.string	"\360\322\372\007\323\3130\267\3102Li$?\331S\"tyq\320K\003\344\305\234\233\017"
+	.string	"\023\232\007\007\323\313\266[d\331V\022I\002\333]LY\206\270\261\203\231\300"
+	.string	"\302\006GO\340\206\351\245\227\037\307\300^J!&\200\355\256\016\330\304\314x)\237Has\347\346O"
+	.string	"\2473\034az\311\205K\031\304\004\260\335\202\311H\327\0209=]V:\262\244h#\034L/\265h)\003\250\260\205s\215B\341OJ'0=\211\031\376\244\344\0011\250\026Qt\001P\351\006\242\260\347OJ\036\250):\"\230\002}VT%Z\207\250\032\314 \024\216\320\343T$:\002\016\321\242\032\245\n\375I\t\212\230\026Q\324Gd\301Hx\016\235\202+\224P\001\205\212R\3214HU\001U\323\263(\264\242+\364\244'*\374YA\r\032I\025\211\"\376\244\244>\255'\224\007C\"\024\024\3617\f\236\351\252\016\211?\236?)\241\353\3514\f\256+\252\016\375I\t]\317THLW\fT\340\360'%\r\177RRO\337\017]\317u\205u\210B\255j\324\006\200#\034\375II\375q\030\022\203k\0208$\212@\201D\024\200\250:\001t=\201\305\250"
+	.string	"\374I\tm:U\025]\341\367;7\250kpx\302\357w\006\375I)\n*\210\246QQP\301\237?)\001\203E\24458<\001\030,\366T\022NH\001U'@$U$\212(\312\240a\375\223R\007\265\004TH\365\t\245Q\353\2116yP\217:H\025\211\"\210\216\244\212D\021G\033\326?)\025\243\210\251\223\357L\317\242\007\030\374\206Q%\370\f\233n\251\372\234\212?\253o\350T,\207NE\214\276\020T\263\252\242)\020x\366\244\212\304_N\327\"\376\217T\272\252A'T\005\037\007 \332\003\242jTV{?\327\023\350s*\002\371\320\365\024\026\241P\026VTEUp*R\260\226\360\003\236E\"~\300\263\350\377\263\232\302\212:qP\207\\PO\024\026\260\242NCB\341\bD\351\211\nE\004\t\205#\b\255`\264\242+45E\340G\315\240\002\300\341\b\023\254C\024j\350\024\024\216"
+	.string	"LO\342\002\320\021\347\n\300\341\bR\302b\361\004\200TSp%B"
+	.string	"8\034a\304\251\032\001O4\355\331\260\200\r\036>PZ\323\263\250t\256'\t\300\240\360\244\200:\f\236\353\220(\"\215R\207(\006>\352\217:d\224\302\020\n\021P!\005\0060"
+	.string	"]\203)\t\037a\324\331\204\222\200\256'\232\376\214\206Q)"
+	.string	"T\247SX\202O\221\020Q\006b*\325\200\025u\022\"\246RN\331'j5r\341DId\026J\004K"
+	.string	"\016G\210`\b\002\350z\002\203\302s\004\321\321\365\034\021\\\177g\320\177A\375\020!\f \004\246\022\2753\025\340\203\002|`\236\251"
+	.string	"KK\005\baI?\204%\274\256\353\272\256\353\3523W\324\207\002\211("
+	.string	"\255)\272\376\316\364|\372\371V\"\261\0054\035R\203\326?)y@\fJ\245+\n\205\n\321uC\221\013\352\211\3020\252\351\007\365\235\260\246\304\0244\244h\260)\270\016Q`\260\247\250B\251E'\242\022(px\002\272\236)0\352l\301'<S\364\251\030L\321\"\222\272\246\304\242\317\nFAC\276\246&\242/E\213(\332\202\017\210\246)\332\204\246\305\b\376\264\001\n]U)5\350\250\004\n\034\006}\2500\330DL\213>\251\024]\327\263\005\337:D\3234\352\347\301)\252\005\024\330\363\373\020\344q\341G\024\376R\0248\234@T\361\007\364\264:\r\321tU}\352\020-B\005W\337\005\351\371\364\313(\3249\314\177RJ\321\022A\250\b\200J\234P>\300\341\t\005E\374\r\203P=?)@\221H\3417\202\212\002\n\025da\b\215\022\236\024\210"
+	.string	"*\004\236 <\327\240S\020\250\001\025\002O\370A\205\347o\005 THL!\350OJ\252\007\022"
+	.ascii	"\241\2520*\205\024]\207\250\210!t=U\200\"\221\302\017\007\320"
+	.ascii	"\264\251\210\0041E\213\247\260\351(\2108\"EU\037\020\205J\317"
+	.ascii	"a\224/\230\256D\177R*\221zP\"5*\221\366\240E)\026RtD\020\375"
+	.ascii	"\241\351O\361\204\372\245e\212\002\203#\210i\021\210\256):b\030"
+	.ascii	"\364\225H\205g0EU\242\022\250\260\030EB\223\360|\352\021\022"
+	.ascii	"\177\304\225\230\026\205\200A\236u\030E\374\371\232R_\260\250"
+	.ascii	"\372J\244\033"
+	.ascii	"\210VTES\3400\330\202o=U\037TT\272\272\200\026U\t~\276\237a\260"
+	.ascii	"\304\211BPU\323\236\360\034\221\242\353\360\204\337Pj\0055\252"
+	.ascii	"\005uh\030\204\322.\374\320\247_\211\023J\017\203?T\215*\221"
+	.ascii	"\372H\375\206h\024\007\320\264\204\024]\205\301\022~)\221*D\207"
+	.ascii	"\303\363ID\004\212*\224\021\372K\243\210\252/\250\252\251\317"
+	.ascii	"\237\224,H"
+	.string	"\321\025\205\"\246\350\321\357w\362\240\351I\002\230\236O/<\375~g\0171E1\360\373\235\275\265\t\005r\370\223\222\352\201\304)\205U\t\204Bb\232K\025\215\022\236#\314(\237\n\025LYPIX\237\234\202\302\246\243\036\2113\305\303\340\331\200\337\357\354\275\360\364\363\373\235ChQj\375\375N\"b*\345\364\203\372\202\206NA\341\331\323BPx\212X\207(\024:\202\210\0021\225r\242\3407\224Z\201\230J9\tuSQ\350{\341i\250\251(\364\255MD\265\bU\243|\304\325\347\205'\240\246&\342\032\365\363=\375V\342\220\350\205'\rhQj\365\251\352Y$A\024\372>\240N\347\212\204:\rO\025$@\364\202\t\303 \n\033RT\225\022\236\303\021\220\326a\024Q\304\323o%B\200\230J5\340\027\204:\207R\300#\016\220\320\252\212\016\213\351\371\244\372\206\200\250\260\205s\310\200\341\t%<]"
+	.string	"\372\223\0221\225r\362@M\211\352\020U#P}\304T\312\311\004\242/\004\205gp\r\016\203>+\352\224\236k\320\352\373"
+	.ascii	"\002*\270\026\211"
+	.string	"\304\007\004A\021\207(\t\252\212\376\210i\n\300`Q\b\035\021\\\177#\244hSS\324\002\212V\237:\001\275\302\252\236\302\241\325\007\025\\}\324\t\240PA\026\316U\210\222\200\n\213P\247J\324$\202\204\021\210\251\224\223V}\"F\234C\037\240\220\370\264\nO_Jl\362\001\203P>5j\203\324\3524\fB\245\247\357L\327\022\250Q\212\252QD(\220\b\345[\205g\006\241UM\203M>a\360\\}Ok\0324$\0229\r\203\300\341)\364\241)q\350\024\\S\rE\342\252\242\300`\232\242#\210\034T\247S\330T\242i\2240x6\371Tb\321H\bm:U\337:\f\022\213R'\t\rA\3045\312\250\304\tuD\264\n\317ap\025\236%N(\337\220\004\021H\202(T3\254C\364\247\242@\237S\212B\241E?DOk\352\033\006\241\206\326\224\330\302\351{ZS#b\223o\030<\323\024\225"
+	.string	"\375\r\317UE\032\022\203\353\017M\203@\337\212\252MMD\037\nE|\362=\255)\007\341\231\242C\324\251\227\242#\210OAR\247\020\005\372\240\322S\r\002}\3045\352$\332\260A(%\256\277\263)\303\021PHt:\235\206\250\032\004\372V\225H\364\3404\f\272p\246-\024\241PA\026RT\210\376P\022Tb\321\210X,\301"
+	.string	"T\035\022\213*\252\202J,\n\375\240\356\237\224\210\301\365t\n\2168\207\027\234XDS\017V\"1\365\300\307\205\341\331B\211\023J\250\304\t\025\004D\321\242\372\243\252\350\360i%\022\241T\337\257h\030,qB\375\020W\337\323o\r\026\211\324\250 \360L})\272\006\211B \023\035\021\004\372\200\303S($\265\006\177D!:B\303\223\212\242\277\337\371\244\242P\301\265\b\025\002\203\031P\341\272\022\323\2475E\241\202kQ1j\030,\252\276\224\270\022\221\206A\2415\212\210B\005\327\240\325\027\302\322:\fFi\024\030\265\006W\241Q\013PA\341\257\b\025:\rO_\211\023\312\367\364\033F\235\302!t=S\037\211S\312\207\252\301\250\364'\204\252'\232\376\206A_\372\264\372\204g\324\360\204\362\221 \n\205'\007!\221\270"
+	.string	"_y\201\021'\004H\224\200\252QE\253\217i\035\006\243z\017!\004\020!"
+	.string	"C\240LJE\027A\004\021\024L"
+	.string	"\002\r\320?%\247`\323\220\370\363\340\327\344\3010xBy\360KU\017\2244"
+	.string	"\207g\013\300\023%AHL\327!Q\004\211S\252\210D\323\375\257\263L\253\240\2726\271\024Xpj\340\226\b\271\371\026\251W\204Y"
+	.string	"\034\254\034*J5>b\346\222TRt\001\n\"\345\206\333U/\315D\373Z\233Ca\356\036\027A\214YN\340\026\032\331\346m\205\211^\220R\312\226\231\032\253\362,#e\354\030\253\352\361\310\323\022GS\031\301n\\r\256\350\251\236\022\237*+`\304\351]~\241\030\323\366&\257\347\304l\261F\r\027<\"nkw&\356\224Bz/\274\330\030\263c\252@[cw\347\346\343\217\226\226\017\260:Az\306;!H\354\200\334M\325}\335l"
+	.ascii	"\255\236\234^\235\234\036\235\027Q\355]\265\367W\222\016\330"
+	.ascii	"Z \201S\267\275\\$\321\351\315aA\354\b\333\234\036\235\020-\351"
+	.ascii	"\305\206\276\312!\307\353\346{ D\377\2758\245\2178G\264\236\334"
+	.ascii	"l\002\001\343\206\354M\271\243\247mG\225\037I1@S/\330\312\270"
+	.ascii	"\t\206\341\250s\022\365Y\236H)\nA\245\2341D3C\223\346\303\025"
+	.ascii	"@0hL$\225\013\323*\037\023@CJ\0135\212\242\005\235CfDDDD$IJR"
+	.ascii	"\352\362*=ZhB\0046}E_\335A\223\301Rh%\215\371dR]\200\307L\213"
+	.ascii	"Lo\230i%\202\241t6\352f$7\034\327\303\317 j\336\314krwo\3454"
+	.ascii	"\353\253\241\004r\221f\216\364\337\312\205\035(\b\211\267S\334"
+	.ascii	"\236*\006\350\333!;>X\n\r\321}\333\224\370\220\210\210\200\031"
+	.ascii	"\366\023\036c9\207!\370\303"
+	.string	"\214\025\221S\204\300\320Be\252\344q\367\305\345*\016\231\255b\024m\220\226)\310\207dz\034\220\020\263\f\347G\311`\357\356\207\342\273\346\347\260\021\274-\271Sm\245\301\030N\372\033g\374!\223T\n\244D\342L&\221/\302#\032 X\207Z+\330\313%\230\007!@\253\216X\035\350Q(\235:\245\220\360w\216\266\305\276\\*bC1a\270\261\3770\016\366\317\027 \235\230N\2347\341/\321\356i\242*\204V\016W\304\375\3071\340\244\276\357\032\217\333\365\235v\200\030\300\033+q\232Ra\307\004B\036}F[J\345w@^\371\300\310\354\336\223J\344k\023;r\344'T\212L\005\001\203)q\362%\324\312mg[\344\341\244\037\346\277\227:\302u\025S\333\372Y\262\275/\250\031\310K\233\277.\305\321\344\304\314\312A\314B\017\376e!\211\002\355\f\003\344\257\207.\320\222\324E\322v\261\026>V\017"
+	.string	"P\260W3\211_\344\374\241Qi\260\240X\203\246\240\235\226N\320z\033 \t\372\247\214\210\\\t~\fR\251\003\203j\\\"'W\2579\336\223\311\"\314 \212\177\233\033\330\244\272\357Y\367i\370\207F\024[\261Sw\362s\370\207@\345PSJlc\001\210! \360\322\253\020\3021\021i\267\033<T\026gg\300)\217\260\001?\036PR4DG\342\305\2412\234\020\353\"6\227\272\244\"\344\372\311=\211Y\353\361\006\324\235P\336d\264\370\244\te<Mv\357"
+	.ascii	"\225e\177\340\212/\234\314m?\335\234\237SQ~\337\323\320\023k"
+	.ascii	"\326\263\337]\353B\264EV\207p\246c\t\210\345\252\271\373xy\336"
+	.ascii	"~~(\026DT#\252\230\036\316/\247\222\"$\255\301\3576\350\347\220"
+	.ascii	"($Zl\241#\226\005\352\216\263\225\026\355\362\371\267XF\245\021"
+	.ascii	"6\275\241\336\377?\006MYt\311S\203\243\335"
+	.string	"\306\371\226rO\350\243E^\344\r\t[\261d\021u\304*:\230Lg\t\213>\233\3050\023\r0P\013\332\311\276[\305!\256\250\230\221\271u\350*7\243\214\007\356yh\236x\334v[\002\253\f\024."
+	.string	")=6[\200\330\311\024\"G\272\312\313\302\2307\227\001\016N\201#\217+;\351>\3453R\333[\271\f\325\367\2470kk\364\301\277U\221\303A\272\215\222\325p\027y\300\tZPZ\365\251e\256\332Ae"
+	.ascii	"7\226\234\234a\240\013F\300\024\3202fu(V#|\316m\002\237\246\332"
+	.ascii	"\353e\256\205\234\242\332\022\225\b\324s\342}\301\0174\217\\"
+	.ascii	"\017\253\2421\214\016p\245\373M\362\307y\342h|n\207??L\233\323"
+	.ascii	"\365\303v\244\374~\375\036_\035c\033I\2718\260-\233&"
+	.string	"M\rQ\267u\023\254\240\177C\336\t\027\235\017t\356}\257\367\026\200\2328\356\266M\364*2\232\212\361\237\234\264A\350\017\201\252$\351*q\210\312\344\035\366\250\265\312[\350\"\243\375\257V\020\300#v\335\215~\032t\236\033\317\221\263\231\231h\375\377\017\265\341xd&\027x\277\314Y}\017\201x\261\321\376\274R\307\366\247\373\336\244j\356\034i\354mO\212\3759\354D*\030K)\020\020M6\371\347\n)\205\263Sp\347\217\314\352\230\253\306\275W\337Lg\263;\201\200E\343\375\034\251\361Y\261V\016\002\205\027A\0207N\202]P\260\3367\224^t\327\237JD\201~\007\252\352mK\374\336\037p\274\305\265\023\277\353\302\230*O\375\345\256,\3136\3735\300\017nu\324\"K\257\363*4|v\007\274\3264T\343\323\266\372\035\035\212\307\252\241\333\312\231lX\247\340|\227\203\236\263\232\223\303@\\\263\357\005"
+	.string	"2x9\340\337\337\375\007\202NL\330\365dF\235\t\177\357\250|j\004$4\371`w\013\0257\317z?kC\244\224\350X\213\324|\312"
+	.string	"\227j@\371\215\360)\340\366\367\001N\260"
+	.ascii	"\321\0276\250\354T\255\322\220\357V~ \272\333){\261\360Goj\271"
+	.ascii	"4\221\020\tb9\004M\237\243\277\356\365\235\345\276t\336\351\307"
+	.ascii	"\335}\036\022\017"
+	.string	"^\252b\030\313\177\217hw\261\333\031WmA\315\224\210:\261\027\254@-h]\216\334\210WvU@B\352\346\3302d\310\371\\\3039u\250\252\013\326pq#\235cN\375\312\317\342Di\370\235D\036\253\355F\035\024\245>O\254b<u\301[\233H\3275n-\037\311b\276'\371\231C\261[n\004\"\273b\037\335C\372`\313\342\224U\351\272\306\\\025\266\0021\305\242LVWs\244\351\3606r(\261 J\027\fi\032\302\r\347k\b\301k\214Q;\323\003o\351\261fq[q\003\306\351\303\264\244<P\251rD\341\264\204 YL\2036\233\020\276\243.\203scJ\260\201e\320\225\217\177\206x\256j\025\225\340^&k]\220\253\322@\376\255^\242h\371\274\254\337\326\362\354\254\366}\027\304^\263C|\2712\302h\360\030<Z\246\265\244g\306Mo\301\212\0050\206\253KT\226\342\n\177,\202\372"
+	.string	"\262\342\252\271Z!#H.\203XE\201\203\220\3361\220\231\374\333\243g\273\217\200\241\321O\365\376\265n\313\034e\235\321\001x\017U\360\227\366\325)i|\007bb\372\272\376\027\020\372\255Lw\321\036\025\270\006\336\002U\252 \237+V\363pP\337\200.\261\030\256\240\353\036\272"
+	.string	"H\240\246\372\226\r\305e5\001=\213\370\024\322Z82\244r<\310\255+G\324\205\fM\307B#p\231\004\200\243\352G\325\311h\241*\024\367S\223M\211Y\356\310\225=8_S\220\356D\200\352\031oEu\2544$\367V\246\237\357\373x\"@\211g\371\371\315vD;\225\201\345\320\2743\312\253:\205v\204q>\315\310\267S7\203\313\006\261N\263w\204x\226\324\036\302\315\331\002\177\263\332\221\220\312{)\t\365w\030\331T\366\220)\234lK\336\336\351\303\t\253\240i\262\252Y\332\351C\3305\364\361\307\225\205\035k\342C\304\361\023\361F\223l\020\371I\305\204\313SE\226\241\026\312\365\355\020@\223\036\345\002\\\244\030`\321G>\027\237n\204\206+\321\236q\256\271"
+	.string	"|gB\021\314G\325o\316=\214\262o\020_(5\0071,|\373\337\274\221z\354#\201\306TBv\230C-\216\f\353\244_\027\311\240\317V\366=\266\333\2664b\213<\2148\224\262\326=\250\264\030$p\334\025Z\375A\262\b\007\272\017\276\221\330\216\023\274\264\266\227\231\352\371\210\031\221U\247\220\303\271\341UJ\224\r\017\365S\3154\2326\225S\251\252?\252\207Q\013\315k\237\031\001\203w\347\263\343#QYV!-Ki\t2G\327(\247\022\264\026G\370\273C\021c#\235q\366\341SWm\315\261N\243K\002\334\361\321\325\325\316\031\326Cp\221C\235V\306\3409O\214\211(\3076\b%m}KX\rL(\032\\c\276\035\034l\334\027\366\3464`\033\016E\023\314\240\214f\253"
+	.string	"D%\262\276\375\312jq\216\313X\341\317\374/\303T*\265\377w\321B\216\220\240\214\021\215\206\360XO)\2231\316\353\320u\213\305)\367\025\270\006[&\232\324\035\342\035\024\023"
+	.string	"\304\027\323\214\306\177Ze"
+	.string	")\335\177\234\242\227\356\371\224\256\035\260\027\216\250@\274J\351\261\357\004\301<K\372\200\2756\355\242\002\314\275b  \326\252\226\223\366\216 \263\370\367#\fm\036\026Oc\203`\021D9\277_+Fq\276\335\354\203\004,*\343\024\b\327\177\222lny\246\022B\344%\302d\267\203xS|\031T\272w\306\217\232%\263I\034\241x\177\2736\223\343\032\307\227_\263ujs\370|\205\005\255\001X\332\313\362\205\004\3756\222\255\320\f\242\021-\t\261\255\305\224\210E\364Jf\357Q\327\317\212\2428\201\243m\200\367Fp{J\005c\347\207z\217\355\306\334\376\357\326\201\252\354\306e\204\017Oe\376h\nO"
+	.string	"\231\007\306<\216M\301~\200\027\273\210kf\253/\230c\363\334\207\320\007\232e\rt\031D\246\347Q\001\177\214\004\214\025<\224e\337G0\210\244\327\217[Q\200\2248\245Y\005\202"
+	.string	"\003\330\353\302SsA2v\353V\360\374\215ww\314\374\316\264,\325(\225\262\234\003\021)\300\253\3262\017Jg\300\322\026\354a\304#"
+	.string	"\334\374\344\266\017@3\225\316k\\\357\275#\235e\027\030\203N\347\022\353D\212p\021\330\235\271H\332\277\206\375[F\247\263!\316\344\224\352\361\f\266\237i\372V\177\333\214gG0\202b0\3175\037b\245\023|\263\371\017xk\235\f4P\b\016\312ob],9\353\344\035z[\031\023\335\372\357E\220i\317*J\224\006\004\261\252\326\203\177\223\261\250n|"
+	.ascii	"\346\217\3737\250V\217\316\355\340\201k\\\277\211\215\357\365"
+	.ascii	"\033\302\234\220!\313\314\005\322\272N\342PX\336\016\373\320"
+	.ascii	"\234\t\244S\250IuO]S\340\206\224\245\370\231\306\035P\333F\373"
+	.ascii	"\352i6\246\230\203\216[\300\222y{\273\352\361\233\344\202u/\036"
+	.ascii	"A91P\222\312Ix\372B\034\f\037+\333\022J\020\236!w\234Z*\f8\214"
+	.ascii	"\313\334\222n\261\024\376\"\357'\310A\270NZ\030\f\302()\210\316"
+	.ascii	"$6\002[\251\374\260z\323\331\216\247\230R\310H\212\260\210\236"
+	.ascii	"\204\033\316_\225\317\274CB\345\263\306G\321c\225K3+3"
+	.string	"\020\313\2360\312`\263\365\364z\274Z\256\271iM\260\230\326\006/\246\220\030a\322\370s\225&a\"\3571h\325}\330\321\016N<7\374\215\231\315-\026a\351\335>\t\035\246\246\221\260&\255G\023\312\362I\005\215\271A\311n\201\305\217<\366\235\311\201Y1tX\315'\025\216\250\243\207\255d\306\244\t\321\254\316\314\367\350\322\230>\220\214A\\P\021\320\245\226\2026\365\202L\021\271\013\357\306\202\030\027\244\256t2\221=\301\277j\002\227\367\247A\353\017[\320"
+	.string	"\230\024c\307],n\224.1c\214\200 \324s\030\240\342\27657\346],l\030\215 \240\030\324&\007\241M{m1d`H\023\033\250/\315=\341E,\304$\353\244\304\005b&\205\342l\001FX\231X7\326p\272\327\021\310\221F\rF\350\227\233\311\002\256\017J\274@7\007"
+	.string	"\032Gy\177X\316\234\300\222\246a@\tS\343&=v\025\261\265\247\365\236e\207r\t\274`\031\302\275\335\347^\031\236\337D\005\210\315\030\346\256A\202\311!c\370\026\022\230\353\275\337\277=\212Q\"\200\252x\310}\t\307\200@\341j5\300Z\270\214$\344G9>4P\033\304]\233\031\r}\330\202\252\355\200\224\344\372Hn\334P\327\300\212y\264\033\177i\n\321\252\312\031\211\025<\f9\267I\026\r\227^\306c\335\224\275\315\020i\315\254\177.n\260 \356w\0024x)\027\334\231\217r\273\332\001\331Q\221\324\376\021hHD-IK|Eo-\001\216\333\271\" \234)\207\036\246\326\256m\005`\311\335\335\200M.D\253\311G\233\374\266@\026\303\265B\305\343[\202\177\256\247vf\2109Zk\242\361"
+	.string	"z\251\n\220y\371p\254 \202\220Ej^\377u\233\371\367|V>'\204\347\375t>\017\374\236A\003;\b\nS\210\251_\327WSItt\302\265\321;\013\323\203\033\216\232z\212\230\3419\317\030\024O\006E:\265\372CC\013\321\356\365a$\336\211]\210\365\007-'=\310e\302\366\316\355\025\337\203\372\366\006\334\016\336a\234\017\rPAW\333)\022\232@\344>.l0\"\305\202>\203\362\366\321\341\322\036\b\306\250\364\336\314\317\007\366"
+	.string	"u\303\306_\205\2732\177\357V\266\f\342\367 ONz,\277\267a\212>\fn\366k\265\361\233\0259l{\013,\254\211\315Z\265\332\362'p\305'&\355pe\005\332\250=\225\005\203\347(\3335\340+\330\216\200\276\241x\202\337k\245\254I\335N\021\277\343\304s\211\345h<]&z\001\204_4\374Hn\324\202\345/o9\013\377}\3778&3\261\345$\323_\3742"
+	.ascii	"\363_:\315\323\261=,\376\270\020hf\303\226!\375wM\257\360\346"
+	.ascii	"\2563\327\202\356q\b\313\021\r\365]>[\275\034\346)\371g\242\215"
+	.ascii	"\023\026fkI\f\362|\213\314\313e\236\030\216\201W\357<;\n\363"
+	.ascii	"\230\303\301\004?\246\277\312\356o\263\275\366\357\2572'2\244"
+	.ascii	"\2548\224+\326\277\316\206\271b\\\302J\366\250e\243\263\244O"
+	.ascii	"\\\247\272\002"
+	.text
+	.section	.gnu.lto_.symtab.cf07173b670378b,"e",@progbits
+	.string	"validateNavConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"validateAndFixTargetConfig"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"targetConfiguration"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"getLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"getGyroLooptime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"validateAndFixConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"createDefaultConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"getConfigProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"setConfigProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"resetConfigs"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"resetEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\002"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"getConfigBatteryProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"setConfigBatteryProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\002"
+	.string	""
+	.string	"applyAndSaveBoardAlignmentDelta"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"setConfigProfileAndWriteEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"setConfigBatteryProfileAndWriteEEPROM"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\003"
+	.string	""
+	.string	"beeperOffSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"beeperConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\003"
+	.string	""
+	.string	"beeperOffSetAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\003"
+	.string	""
+	.string	"beeperOffClear"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"beeperOffClearAll"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"setBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"setPreferredBeeperOffMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"pgResetTemplate_adcChannelConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\003"
+	.string	""
+	.string	"adcChannelConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"adcChannelConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\003"
+	.string	""
+	.string	"adcChannelConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"beeperConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"beeperConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"i\003"
+	.string	""
+	.string	"pgResetTemplate_systemConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"systemConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"systemConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\003"
+	.string	""
+	.string	"pgResetTemplate_featureConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\003"
+	.string	""
+	.string	"featureConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\003"
+	.string	""
+	.string	"featureConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\003"
+	.string	""
+	.string	"featureConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"navConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"accelerometerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"navigationUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\003"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"accInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\003"
+	.string	""
+	.string	"accSetCalibrationValues"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"updateUsedModeActivationConditionFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\003"
+	.string	""
+	.string	"activateBatteryProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"activateControlRateConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\003"
+	.string	""
+	.string	"settingsValidate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\003"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\003"
+	.string	""
+	.string	"pgResetCopy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"isSerialConfigValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\003"
+	.string	""
+	.string	"featureSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\003"
+	.string	""
+	.string	"parseRcChannels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"resumeRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\003"
+	.string	""
+	.string	"writeConfigToEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\003"
+	.string	""
+	.string	"suspendRxSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"setControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\003"
+	.string	""
+	.string	"pgActivateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"pgResetAll"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\003"
+	.string	""
+	.string	"isEEPROMContentValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"setBatteryProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"loadEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"updateBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.cf07173b670378b,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,24392 @@
+	.file	"fc_core.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/common/color.h"
+	.file 7 "./src/main/common/global_functions.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/serial.h"
+	.file 10 "./src/main/sensors/sensors.h"
+	.file 11 "./src/main/drivers/sensor.h"
+	.file 12 "./src/main/sensors/gyro.h"
+	.file 13 "./src/main/fc/fc_core.h"
+	.file 14 "./src/main/fc/cli.h"
+	.file 15 "./src/main/drivers/adc.h"
+	.file 16 "./src/main/fc/config.h"
+	.file 17 "./src/main/fc/controlrate_profile.h"
+	.file 18 "./src/main/fc/rc_controls.h"
+	.file 19 "./src/main/fc/rc_modes.h"
+	.file 20 "./src/main/fc/runtime_config.h"
+	.file 21 "./src/main/io/beeper.h"
+	.file 22 "./src/main/io/serial.h"
+	.file 23 "./src/main/navigation/navigation.h"
+	.file 24 "./src/main/rx/rx.h"
+	.file 25 "./src/main/scheduler/scheduler.h"
+	.file 26 "./src/main/telemetry/telemetry.h"
+	.file 27 "./src/main/flight/mixer.h"
+	.file 28 "./src/main/flight/pid.h"
+	.file 29 "./src/main/flight/imu.h"
+	.file 30 "./src/main/fc/fc_core.c"
+	.file 31 "./src/main/drivers/system.h"
+	.file 32 "./src/main/common/maths.h"
+	.file 33 "./src/main/drivers/time.h"
+	.file 34 "./src/main/blackbox/blackbox.h"
+	.file 35 "./src/main/flight/servos.h"
+	.file 36 "./src/main/fc/rc_smoothing.h"
+	.file 37 "./src/main/sensors/acceleration.h"
+	.file 38 "./src/main/sensors/opflow.h"
+	.file 39 "./src/main/msp/msp_serial.h"
+	.file 40 "./src/main/flight/failsafe.h"
+	.file 41 "./src/main/fc/rc_adjustments.h"
+	.file 42 "./src/main/fc/stats.h"
+	.file 43 "./src/main/common/logic_condition.h"
+	.file 44 "./src/main/config/feature.h"
+	.file 45 "./src/main/io/statusindicator.h"
+	.file 46 "./src/main/sensors/diagnostics.h"
+	.file 47 "./src/main/fc/rc_curves.h"
+	.file 48 "./src/main/sensors/pitotmeter.h"
+	.file 49 "./src/main/sensors/barometer.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_core.c.9b55060b
+	.weak	fc_core.c.9b55060b
+fc_core.c.9b55060b:
+	.long	0x2464
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF3071
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2248
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2249
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2250
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2251
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2252
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2253
+	.uleb128 0x4
+	.long	.LASF2255
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x5f
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2254
+	.uleb128 0x4
+	.long	.LASF2256
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF2257
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x7e
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2258
+	.uleb128 0x4
+	.long	.LASF2259
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF2260
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2261
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4c
+	.uleb128 0x4
+	.long	.LASF2262
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x22
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2263
+	.uleb128 0x4
+	.long	.LASF2264
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x53
+	.uleb128 0x4
+	.long	.LASF2265
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x72
+	.uleb128 0xe
+	.long	0xca
+	.uleb128 0x4
+	.long	.LASF2266
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x91
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2267
+	.uleb128 0x7
+	.long	0xf3
+	.uleb128 0x29
+	.uleb128 0x4
+	.long	.LASF2268
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x66
+	.uleb128 0xe
+	.long	0xf4
+	.uleb128 0x2a
+	.long	0xf4
+	.uleb128 0x4
+	.long	.LASF2269
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x85
+	.uleb128 0x4
+	.long	.LASF2270
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0x4
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa9
+	.uleb128 0x4
+	.long	.LASF2272
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0xe
+	.long	0x12e
+	.uleb128 0x4
+	.long	.LASF2273
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0x116
+	.uleb128 0x4
+	.long	.LASF2274
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x122
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2275
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2276
+	.uleb128 0xe
+	.long	0x15e
+	.uleb128 0x15
+	.long	0x15e
+	.long	0x17a
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x5
+	.byte	0x1d
+	.long	0x198
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x6
+	.byte	0x15
+	.long	0x1b6
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x2
+	.byte	0
+	.uleb128 0x15
+	.long	0xf4
+	.long	0x1c6
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x7
+	.byte	0x1f
+	.long	0x214
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x7
+	.byte	0x2d
+	.long	0x24a
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x40
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2454
+	.byte	0x7
+	.byte	0x45
+	.byte	0x11
+	.long	0x122
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x8
+	.byte	0x16
+	.long	0x346
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x8
+	.byte	0x43
+	.long	0x3d0
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2342
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2352
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2357
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2358
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0x14
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2363
+	.long	0x4c
+	.byte	0x9
+	.byte	0x1a
+	.long	0x3f2
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2363
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x3d0
+	.uleb128 0x1c
+	.long	.LASF2364
+	.long	0x4c
+	.byte	0x9
+	.byte	0x20
+	.long	0x450
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2364
+	.byte	0x9
+	.byte	0x34
+	.byte	0x3
+	.long	0x3fe
+	.uleb128 0x10
+	.long	.LASF2381
+	.byte	0x10
+	.byte	0x9
+	.byte	0x37
+	.byte	0x10
+	.long	0x484
+	.uleb128 0x2
+	.long	.LASF2376
+	.byte	0x9
+	.byte	0x38
+	.byte	0x14
+	.long	0x484
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2377
+	.byte	0x9
+	.byte	0x39
+	.byte	0x9
+	.long	0x29
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x100
+	.uleb128 0x4
+	.long	.LASF2378
+	.byte	0x9
+	.byte	0x3a
+	.byte	0x3
+	.long	0x45c
+	.uleb128 0xe
+	.long	0x489
+	.uleb128 0x4
+	.long	.LASF2379
+	.byte	0x9
+	.byte	0x3c
+	.byte	0x10
+	.long	0x4a6
+	.uleb128 0x7
+	.long	0x4ab
+	.uleb128 0x17
+	.long	0x4bb
+	.uleb128 0x3
+	.long	0x10a
+	.uleb128 0x3
+	.long	0xb5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2380
+	.byte	0x9
+	.byte	0x3d
+	.byte	0x10
+	.long	0x4c7
+	.uleb128 0x7
+	.long	0x4cc
+	.uleb128 0x17
+	.long	0x4e1
+	.uleb128 0x3
+	.long	0x484
+	.uleb128 0x3
+	.long	0x29
+	.uleb128 0x3
+	.long	0xb5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2382
+	.byte	0x60
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x10
+	.long	0x5cc
+	.uleb128 0x2
+	.long	.LASF2383
+	.byte	0x9
+	.byte	0x41
+	.byte	0x24
+	.long	0x688
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2384
+	.byte	0x9
+	.byte	0x43
+	.byte	0xd
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2385
+	.byte	0x9
+	.byte	0x44
+	.byte	0x10
+	.long	0x3f2
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2386
+	.byte	0x9
+	.byte	0x45
+	.byte	0x13
+	.long	0x450
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2387
+	.byte	0x9
+	.byte	0x47
+	.byte	0xe
+	.long	0x116
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2388
+	.byte	0x9
+	.byte	0x49
+	.byte	0xe
+	.long	0x116
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2389
+	.byte	0x9
+	.byte	0x4a
+	.byte	0xe
+	.long	0x116
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2390
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x17
+	.long	0x68d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2391
+	.byte	0x9
+	.byte	0x4c
+	.byte	0x17
+	.long	0x68d
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2392
+	.byte	0x9
+	.byte	0x4d
+	.byte	0xe
+	.long	0x116
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2393
+	.byte	0x9
+	.byte	0x4e
+	.byte	0xe
+	.long	0x116
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2394
+	.byte	0x9
+	.byte	0x4f
+	.byte	0xe
+	.long	0x116
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2395
+	.byte	0x9
+	.byte	0x50
+	.byte	0xe
+	.long	0x116
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2396
+	.byte	0x9
+	.byte	0x52
+	.byte	0x1e
+	.long	0x49a
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2397
+	.byte	0x9
+	.byte	0x53
+	.byte	0xb
+	.long	0xb5
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2398
+	.byte	0x9
+	.byte	0x55
+	.byte	0x23
+	.long	0x4bb
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2399
+	.byte	0x9
+	.byte	0x58
+	.byte	0xe
+	.long	0x116
+	.byte	0x58
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2400
+	.byte	0x68
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x8
+	.long	0x683
+	.uleb128 0x2
+	.long	.LASF2401
+	.byte	0x9
+	.byte	0x5c
+	.byte	0xc
+	.long	0x6b8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2402
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x10
+	.long	0x6d1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2403
+	.byte	0x9
+	.byte	0x5f
+	.byte	0x10
+	.long	0x6d1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2404
+	.byte	0x9
+	.byte	0x61
+	.byte	0xf
+	.long	0x6e5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2405
+	.byte	0x9
+	.byte	0x64
+	.byte	0xc
+	.long	0x6fa
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2406
+	.byte	0x9
+	.byte	0x66
+	.byte	0xb
+	.long	0x70e
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2407
+	.byte	0x9
+	.byte	0x68
+	.byte	0xc
+	.long	0x723
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2408
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xc
+	.long	0x73d
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2409
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xb
+	.long	0x70e
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2410
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xb
+	.long	0x751
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2411
+	.byte	0x9
+	.byte	0x71
+	.byte	0xc
+	.long	0x761
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2412
+	.byte	0x9
+	.byte	0x72
+	.byte	0xc
+	.long	0x761
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2413
+	.byte	0x9
+	.byte	0x75
+	.byte	0xc
+	.long	0x780
+	.byte	0x60
+	.byte	0
+	.uleb128 0xe
+	.long	0x5cc
+	.uleb128 0x7
+	.long	0x683
+	.uleb128 0x7
+	.long	0x105
+	.uleb128 0x4
+	.long	.LASF2414
+	.byte	0x9
+	.byte	0x59
+	.byte	0x3
+	.long	0x4e1
+	.uleb128 0xe
+	.long	0x692
+	.uleb128 0x17
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0xf4
+	.byte	0
+	.uleb128 0x7
+	.long	0x692
+	.uleb128 0x7
+	.long	0x6a3
+	.uleb128 0x1d
+	.long	0x116
+	.long	0x6cc
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x7
+	.long	0x69e
+	.uleb128 0x7
+	.long	0x6bd
+	.uleb128 0x1d
+	.long	0xf4
+	.long	0x6e5
+	.uleb128 0x3
+	.long	0x6b3
+	.byte	0
+	.uleb128 0x7
+	.long	0x6d6
+	.uleb128 0x17
+	.long	0x6fa
+	.uleb128 0x3
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0x116
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ea
+	.uleb128 0x1d
+	.long	0x157
+	.long	0x70e
+	.uleb128 0x3
+	.long	0x6cc
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ff
+	.uleb128 0x17
+	.long	0x723
+	.uleb128 0x3
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0x3f2
+	.byte	0
+	.uleb128 0x7
+	.long	0x713
+	.uleb128 0x17
+	.long	0x73d
+	.uleb128 0x3
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0xee
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x7
+	.long	0x728
+	.uleb128 0x1d
+	.long	0x157
+	.long	0x751
+	.uleb128 0x3
+	.long	0x6b3
+	.byte	0
+	.uleb128 0x7
+	.long	0x742
+	.uleb128 0x17
+	.long	0x761
+	.uleb128 0x3
+	.long	0x6b3
+	.byte	0
+	.uleb128 0x7
+	.long	0x756
+	.uleb128 0x17
+	.long	0x77b
+	.uleb128 0x3
+	.long	0x6b3
+	.uleb128 0x3
+	.long	0x77b
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0x7
+	.long	0x495
+	.uleb128 0x7
+	.long	0x766
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0xa
+	.byte	0x14
+	.long	0x7c1
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2419
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0x7
+	.byte	0
+	.uleb128 0x15
+	.long	0xca
+	.long	0x7d1
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0xa
+	.byte	0x30
+	.long	0x81b
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2431
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2432
+	.value	0x200
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2433
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0xb
+	.byte	0x1a
+	.long	0x864
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2443
+	.byte	0xb
+	.byte	0x24
+	.byte	0x3
+	.long	0x822
+	.uleb128 0x10
+	.long	.LASF2444
+	.byte	0x28
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x10
+	.long	0x8e6
+	.uleb128 0x2
+	.long	.LASF2445
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x9
+	.long	0x157
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2446
+	.byte	0xc
+	.byte	0x3d
+	.byte	0xe
+	.long	0x116
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2447
+	.byte	0xc
+	.byte	0x3e
+	.byte	0xe
+	.long	0x116
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0xc
+	.byte	0x3f
+	.byte	0xd
+	.long	0xf4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2449
+	.byte	0xc
+	.byte	0x40
+	.byte	0x9
+	.long	0x157
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2450
+	.byte	0xc
+	.byte	0x41
+	.byte	0xe
+	.long	0x14b
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2451
+	.byte	0xc
+	.byte	0x42
+	.byte	0x11
+	.long	0x12e
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2452
+	.byte	0xc
+	.byte	0x43
+	.byte	0xb
+	.long	0x16a
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2453
+	.byte	0xc
+	.byte	0x44
+	.byte	0x3
+	.long	0x870
+	.uleb128 0xd
+	.long	.LASF2455
+	.byte	0xc
+	.byte	0x46
+	.byte	0xf
+	.long	0x8e6
+	.uleb128 0x10
+	.long	.LASF2456
+	.byte	0x28
+	.byte	0xc
+	.byte	0x48
+	.byte	0x10
+	.long	0xa37
+	.uleb128 0x2
+	.long	.LASF2457
+	.byte	0xc
+	.byte	0x49
+	.byte	0x14
+	.long	0x864
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2458
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xd
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2459
+	.byte	0xc
+	.byte	0x4b
+	.byte	0xd
+	.long	0xf4
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2460
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xe
+	.long	0x10a
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2448
+	.byte	0xc
+	.byte	0x4d
+	.byte	0xd
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2461
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xd
+	.long	0xf4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2462
+	.byte	0xc
+	.byte	0x4f
+	.byte	0xd
+	.long	0xf4
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2463
+	.byte	0xc
+	.byte	0x50
+	.byte	0xd
+	.long	0xf4
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2464
+	.byte	0xc
+	.byte	0x51
+	.byte	0xd
+	.long	0xf4
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2465
+	.byte	0xc
+	.byte	0x52
+	.byte	0xe
+	.long	0x10a
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2466
+	.byte	0xc
+	.byte	0x53
+	.byte	0xe
+	.long	0x10a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2467
+	.byte	0xc
+	.byte	0x54
+	.byte	0xe
+	.long	0x10a
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0xc
+	.byte	0x55
+	.byte	0xd
+	.long	0xf4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2469
+	.byte	0xc
+	.byte	0x56
+	.byte	0xd
+	.long	0xf4
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0xc
+	.byte	0x57
+	.byte	0xe
+	.long	0x10a
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0xc
+	.byte	0x58
+	.byte	0xe
+	.long	0x10a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0xc
+	.byte	0x59
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2473
+	.byte	0xc
+	.byte	0x5a
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF2474
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2475
+	.byte	0xc
+	.byte	0x5c
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0xc
+	.byte	0x5d
+	.byte	0xe
+	.long	0x10a
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0xc
+	.byte	0x5e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xd
+	.long	0xf4
+	.byte	0x24
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2479
+	.byte	0xc
+	.byte	0x60
+	.byte	0x3
+	.long	0x8fe
+	.uleb128 0xe
+	.long	0xa37
+	.uleb128 0xd
+	.long	.LASF2480
+	.byte	0xc
+	.byte	0x62
+	.byte	0x15
+	.long	0xa37
+	.uleb128 0x1c
+	.long	.LASF2481
+	.long	0x4c
+	.byte	0xd
+	.byte	0x18
+	.long	0xa9a
+	.uleb128 0x1
+	.long	.LASF2482
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2483
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2484
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2485
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2486
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2488
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2489
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2490
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2491
+	.byte	0xd
+	.byte	0x22
+	.byte	0x3
+	.long	0xa54
+	.uleb128 0xd
+	.long	.LASF2492
+	.byte	0xe
+	.byte	0x14
+	.byte	0x10
+	.long	0xf4
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0xf
+	.byte	0x16
+	.long	0xadc
+	.uleb128 0x1
+	.long	.LASF2493
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2494
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2495
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2496
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2497
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.long	0xf4
+	.long	0xaec
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x10
+	.byte	0x26
+	.long	0xbe7
+	.uleb128 0x1
+	.long	.LASF2498
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2506
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2507
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2508
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2509
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2510
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2511
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2512
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2513
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2514
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2515
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2516
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2517
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2518
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2519
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2520
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2521
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2522
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2523
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2524
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2525
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2526
+	.long	0x10000000
+	.uleb128 0x5
+	.long	.LASF2527
+	.long	0x20000000
+	.uleb128 0x5
+	.long	.LASF2528
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2529
+	.byte	0x17
+	.byte	0x10
+	.byte	0x48
+	.byte	0x10
+	.long	0xc50
+	.uleb128 0x2
+	.long	.LASF2530
+	.byte	0x10
+	.byte	0x49
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2531
+	.byte	0x10
+	.byte	0x4a
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xd
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2533
+	.byte	0x10
+	.byte	0x4c
+	.byte	0xd
+	.long	0xf4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2534
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xd
+	.long	0xf4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x10
+	.byte	0x4e
+	.byte	0xd
+	.long	0xf4
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x10
+	.byte	0x4f
+	.byte	0xa
+	.long	0xc50
+	.byte	0x6
+	.byte	0
+	.uleb128 0x15
+	.long	0xb7
+	.long	0xc60
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x10
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2537
+	.byte	0x10
+	.byte	0x50
+	.byte	0x3
+	.long	0xbe7
+	.uleb128 0xe
+	.long	0xc60
+	.uleb128 0xd
+	.long	.LASF2538
+	.byte	0x10
+	.byte	0x52
+	.byte	0x17
+	.long	0xc60
+	.uleb128 0x1b
+	.byte	0x8
+	.byte	0x11
+	.byte	0x2d
+	.long	0xcc7
+	.uleb128 0x2
+	.long	.LASF2539
+	.byte	0x11
+	.byte	0x2e
+	.byte	0x11
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2540
+	.byte	0x11
+	.byte	0x2f
+	.byte	0x11
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2541
+	.byte	0x11
+	.byte	0x30
+	.byte	0x11
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2542
+	.byte	0x11
+	.byte	0x31
+	.byte	0x12
+	.long	0x10a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2543
+	.byte	0x11
+	.byte	0x32
+	.byte	0x12
+	.long	0x10a
+	.byte	0x6
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x5
+	.byte	0x11
+	.byte	0x35
+	.long	0xcf7
+	.uleb128 0x2
+	.long	.LASF2540
+	.byte	0x11
+	.byte	0x36
+	.byte	0x11
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2544
+	.byte	0x11
+	.byte	0x37
+	.byte	0x11
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x11
+	.byte	0x38
+	.byte	0x11
+	.long	0x1b6
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x5
+	.byte	0x11
+	.byte	0x3b
+	.long	0xd27
+	.uleb128 0x2
+	.long	.LASF2540
+	.byte	0x11
+	.byte	0x3c
+	.byte	0x11
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2544
+	.byte	0x11
+	.byte	0x3d
+	.byte	0x11
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2545
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x11
+	.long	0x1b6
+	.byte	0x2
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x1
+	.byte	0x11
+	.byte	0x41
+	.long	0xd3d
+	.uleb128 0x2
+	.long	.LASF2546
+	.byte	0x11
+	.byte	0x42
+	.byte	0x11
+	.long	0xf4
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2547
+	.byte	0x14
+	.byte	0x11
+	.byte	0x2b
+	.byte	0x10
+	.long	0xd7f
+	.uleb128 0x2
+	.long	.LASF2548
+	.byte	0x11
+	.byte	0x33
+	.byte	0x7
+	.long	0xc7d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2549
+	.byte	0x11
+	.byte	0x39
+	.byte	0x7
+	.long	0xcc7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2550
+	.byte	0x11
+	.byte	0x3f
+	.byte	0x7
+	.long	0xcf7
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2551
+	.byte	0x11
+	.byte	0x43
+	.byte	0x7
+	.long	0xd27
+	.byte	0x12
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2552
+	.byte	0x11
+	.byte	0x45
+	.byte	0x3
+	.long	0xd3d
+	.uleb128 0xe
+	.long	0xd7f
+	.uleb128 0xd
+	.long	.LASF2553
+	.byte	0x11
+	.byte	0x49
+	.byte	0x23
+	.long	0xd9c
+	.uleb128 0x7
+	.long	0xd8b
+	.uleb128 0x1c
+	.long	.LASF2554
+	.long	0x4c
+	.byte	0x12
+	.byte	0x18
+	.long	0xe11
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x1
+	.uleb128 0x2b
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x12
+	.byte	0x2b
+	.long	0xe29
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2572
+	.byte	0x12
+	.byte	0x2e
+	.byte	0x3
+	.long	0xe11
+	.uleb128 0xe
+	.long	0xe29
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x12
+	.byte	0x30
+	.long	0xe52
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2575
+	.byte	0x12
+	.byte	0x33
+	.byte	0x3
+	.long	0xe3a
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x12
+	.byte	0x35
+	.long	0xe76
+	.uleb128 0x1
+	.long	.LASF2576
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2577
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2578
+	.byte	0x12
+	.byte	0x38
+	.byte	0x3
+	.long	0xe5e
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x12
+	.byte	0x3a
+	.long	0xe9a
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0x1
+	.byte	0
+	.uleb128 0x15
+	.long	0xca
+	.long	0xeaa
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x3
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2581
+	.byte	0x12
+	.byte	0x51
+	.byte	0x10
+	.long	0xe9a
+	.uleb128 0x10
+	.long	.LASF2582
+	.byte	0xa
+	.byte	0x12
+	.byte	0x53
+	.byte	0x10
+	.long	0xf1f
+	.uleb128 0x2
+	.long	.LASF2583
+	.byte	0x12
+	.byte	0x54
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2584
+	.byte	0x12
+	.byte	0x55
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2585
+	.byte	0x12
+	.byte	0x56
+	.byte	0xd
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2586
+	.byte	0x12
+	.byte	0x57
+	.byte	0xd
+	.long	0xf4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2587
+	.byte	0x12
+	.byte	0x58
+	.byte	0xe
+	.long	0x10a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2588
+	.byte	0x12
+	.byte	0x59
+	.byte	0xd
+	.long	0xf4
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2589
+	.byte	0x12
+	.byte	0x5a
+	.byte	0xe
+	.long	0x10a
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2590
+	.byte	0x12
+	.byte	0x5b
+	.byte	0x3
+	.long	0xeb6
+	.uleb128 0xe
+	.long	0xf1f
+	.uleb128 0xd
+	.long	.LASF2591
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x1b
+	.long	0xf1f
+	.uleb128 0x10
+	.long	.LASF2592
+	.byte	0x4
+	.byte	0x12
+	.byte	0x5f
+	.byte	0x10
+	.long	0xf71
+	.uleb128 0x2
+	.long	.LASF2593
+	.byte	0x12
+	.byte	0x60
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2594
+	.byte	0x12
+	.byte	0x61
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2595
+	.byte	0x12
+	.byte	0x62
+	.byte	0xe
+	.long	0x10a
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2596
+	.byte	0x12
+	.byte	0x63
+	.byte	0x3
+	.long	0xf3c
+	.uleb128 0xe
+	.long	0xf71
+	.uleb128 0xd
+	.long	.LASF2597
+	.byte	0x12
+	.byte	0x65
+	.byte	0x17
+	.long	0xf71
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x13
+	.byte	0x1c
+	.long	0x109c
+	.uleb128 0x1
+	.long	.LASF2598
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2599
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2600
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2601
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2602
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2604
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2605
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2606
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2607
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2608
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2609
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2610
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2611
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2612
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2613
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2614
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2615
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2616
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2617
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2618
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2619
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2620
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2621
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2622
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2623
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2624
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2625
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2626
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2627
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2641
+	.byte	0x13
+	.byte	0x48
+	.byte	0x3
+	.long	0xf8e
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x14
+	.byte	0x15
+	.long	0x1173
+	.uleb128 0x1
+	.long	.LASF2642
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2643
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2644
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2645
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2646
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2647
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2648
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2649
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2650
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2651
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2652
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2653
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2654
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2655
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2656
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2657
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2658
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2659
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2660
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2661
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2662
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2663
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2664
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2665
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2666
+	.byte	0x14
+	.byte	0x47
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x14
+	.byte	0x54
+	.long	0x11ec
+	.uleb128 0x1
+	.long	.LASF2667
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2669
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2670
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2671
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2672
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2673
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2674
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2675
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2676
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2677
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2678
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2679
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2680
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2681
+	.value	0x4000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2682
+	.byte	0x14
+	.byte	0x64
+	.byte	0x3
+	.long	0x117f
+	.uleb128 0xd
+	.long	.LASF2683
+	.byte	0x14
+	.byte	0x66
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x14
+	.byte	0x6c
+	.long	0x12c9
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2692
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2693
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2694
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2695
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2696
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2697
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2698
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2699
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2700
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2701
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2702
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2703
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2704
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2705
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2706
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2707
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2708
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2709
+	.byte	0x14
+	.byte	0x8c
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x15
+	.byte	0x16
+	.long	0x1377
+	.uleb128 0x1
+	.long	.LASF2710
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2711
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2712
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2713
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2714
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2716
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2717
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2723
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2724
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2725
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2726
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2727
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2728
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2729
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2730
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2731
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2735
+	.byte	0x15
+	.byte	0x34
+	.byte	0x3
+	.long	0x12d5
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x16
+	.byte	0x20
+	.long	0x143c
+	.uleb128 0x1
+	.long	.LASF2736
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2737
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2738
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2739
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2740
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2741
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2742
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2743
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2744
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2745
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2746
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2747
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2748
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2749
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2750
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2751
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2752
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2753
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2754
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2755
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2756
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2757
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2758
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2759
+	.long	0x400000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2760
+	.byte	0x16
+	.byte	0x39
+	.byte	0x3
+	.long	0x1383
+	.uleb128 0x7
+	.long	0x4e1
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x17
+	.byte	0x63
+	.long	0x1477
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2766
+	.byte	0x17
+	.byte	0x69
+	.byte	0x3
+	.long	0x144d
+	.uleb128 0x10
+	.long	.LASF2767
+	.byte	0x28
+	.byte	0x18
+	.byte	0x6a
+	.byte	0x10
+	.long	0x15a2
+	.uleb128 0x2
+	.long	.LASF2768
+	.byte	0x18
+	.byte	0x6b
+	.byte	0xd
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2769
+	.byte	0x18
+	.byte	0x6c
+	.byte	0xd
+	.long	0xadc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2770
+	.byte	0x18
+	.byte	0x6d
+	.byte	0xd
+	.long	0xf4
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2771
+	.byte	0x18
+	.byte	0x6e
+	.byte	0xd
+	.long	0xf4
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2772
+	.byte	0x18
+	.byte	0x6f
+	.byte	0xd
+	.long	0xf4
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2773
+	.byte	0x18
+	.byte	0x70
+	.byte	0xd
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2774
+	.byte	0x18
+	.byte	0x71
+	.byte	0xe
+	.long	0x116
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2775
+	.byte	0x18
+	.byte	0x72
+	.byte	0xd
+	.long	0xf4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2776
+	.byte	0x18
+	.byte	0x73
+	.byte	0xd
+	.long	0xf4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2777
+	.byte	0x18
+	.byte	0x74
+	.byte	0xd
+	.long	0xf4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2778
+	.byte	0x18
+	.byte	0x75
+	.byte	0xd
+	.long	0xf4
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2779
+	.byte	0x18
+	.byte	0x76
+	.byte	0xd
+	.long	0xf4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2780
+	.byte	0x18
+	.byte	0x77
+	.byte	0xd
+	.long	0xf4
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2781
+	.byte	0x18
+	.byte	0x78
+	.byte	0xe
+	.long	0x10a
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2782
+	.byte	0x18
+	.byte	0x79
+	.byte	0xe
+	.long	0x10a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2783
+	.byte	0x18
+	.byte	0x7a
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2784
+	.byte	0x18
+	.byte	0x7b
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2785
+	.byte	0x18
+	.byte	0x7c
+	.byte	0xe
+	.long	0x10a
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2786
+	.byte	0x18
+	.byte	0x7d
+	.byte	0xd
+	.long	0xf4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2787
+	.byte	0x18
+	.byte	0x7e
+	.byte	0xe
+	.long	0x10a
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2788
+	.byte	0x18
+	.byte	0x7f
+	.byte	0xd
+	.long	0xf4
+	.byte	0x24
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2789
+	.byte	0x18
+	.byte	0x80
+	.byte	0x3
+	.long	0x1483
+	.uleb128 0xe
+	.long	0x15a2
+	.uleb128 0xd
+	.long	.LASF2790
+	.byte	0x18
+	.byte	0x82
+	.byte	0x13
+	.long	0x15a2
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x19
+	.byte	0x3a
+	.long	0x1649
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2792
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2797
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2801
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2812
+	.byte	0x19
+	.byte	0x8d
+	.byte	0x3
+	.long	0x15bf
+	.uleb128 0xd
+	.long	.LASF2813
+	.byte	0x19
+	.byte	0xa9
+	.byte	0x11
+	.long	0x10a
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x1a
+	.byte	0x22
+	.long	0x1679
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2816
+	.byte	0x1a
+	.byte	0x25
+	.byte	0x3
+	.long	0x1661
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x1a
+	.byte	0x27
+	.long	0x169d
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2819
+	.byte	0x1a
+	.byte	0x2a
+	.byte	0x3
+	.long	0x1685
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x1a
+	.byte	0x32
+	.long	0x16c7
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2823
+	.byte	0x1a
+	.byte	0x36
+	.byte	0x3
+	.long	0x16a9
+	.uleb128 0x1b
+	.byte	0x5
+	.byte	0x1a
+	.byte	0x4f
+	.long	0x171d
+	.uleb128 0x2
+	.long	.LASF2824
+	.byte	0x1a
+	.byte	0x50
+	.byte	0x11
+	.long	0xf4
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2825
+	.byte	0x1a
+	.byte	0x51
+	.byte	0x11
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2826
+	.byte	0x1a
+	.byte	0x52
+	.byte	0x11
+	.long	0xf4
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2827
+	.byte	0x1a
+	.byte	0x53
+	.byte	0x11
+	.long	0xf4
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2828
+	.byte	0x1a
+	.byte	0x54
+	.byte	0x11
+	.long	0xf4
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2829
+	.byte	0x50
+	.byte	0x1a
+	.byte	0x38
+	.byte	0x10
+	.long	0x1856
+	.uleb128 0x2
+	.long	.LASF2830
+	.byte	0x1a
+	.byte	0x39
+	.byte	0xb
+	.long	0x15e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2831
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0xb
+	.long	0x15e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2832
+	.byte	0x1a
+	.byte	0x3b
+	.byte	0xd
+	.long	0xf4
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2833
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0xd
+	.long	0xf4
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2834
+	.byte	0x1a
+	.byte	0x3d
+	.byte	0x1b
+	.long	0x1679
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2835
+	.byte	0x1a
+	.byte	0x3e
+	.byte	0x11
+	.long	0x169d
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2836
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0xd
+	.long	0xf4
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2837
+	.byte	0x1a
+	.byte	0x40
+	.byte	0xd
+	.long	0xf4
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2838
+	.byte	0x1a
+	.byte	0x41
+	.byte	0xd
+	.long	0xf4
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2839
+	.byte	0x1a
+	.byte	0x42
+	.byte	0xd
+	.long	0xf4
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2772
+	.byte	0x1a
+	.byte	0x43
+	.byte	0xd
+	.long	0xf4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2840
+	.byte	0x1a
+	.byte	0x44
+	.byte	0x19
+	.long	0x16c7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2841
+	.byte	0x1a
+	.byte	0x45
+	.byte	0xd
+	.long	0xf4
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2842
+	.byte	0x1a
+	.byte	0x46
+	.byte	0xd
+	.long	0xf4
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2843
+	.byte	0x1a
+	.byte	0x47
+	.byte	0xe
+	.long	0x10a
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2844
+	.byte	0x1a
+	.byte	0x48
+	.byte	0xd
+	.long	0xadc
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2845
+	.byte	0x1a
+	.byte	0x49
+	.byte	0xe
+	.long	0x10a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2846
+	.byte	0x1a
+	.byte	0x4a
+	.byte	0xe
+	.long	0x10a
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2847
+	.byte	0x1a
+	.byte	0x4b
+	.byte	0xe
+	.long	0x10a
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2848
+	.byte	0x1a
+	.byte	0x4c
+	.byte	0xd
+	.long	0xca
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2849
+	.byte	0x1a
+	.byte	0x4d
+	.byte	0xd
+	.long	0x1856
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2850
+	.byte	0x1a
+	.byte	0x4e
+	.byte	0xd
+	.long	0x1866
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2851
+	.byte	0x1a
+	.byte	0x55
+	.byte	0x7
+	.long	0x16d3
+	.byte	0x48
+	.byte	0
+	.uleb128 0x15
+	.long	0xf4
+	.long	0x1866
+	.uleb128 0x16
+	.long	0x22
+	.byte	0xf
+	.byte	0
+	.uleb128 0x15
+	.long	0xf4
+	.long	0x1876
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2852
+	.byte	0x1a
+	.byte	0x56
+	.byte	0x3
+	.long	0x171d
+	.uleb128 0xe
+	.long	0x1876
+	.uleb128 0xd
+	.long	.LASF2853
+	.byte	0x1a
+	.byte	0x58
+	.byte	0x1a
+	.long	0x1876
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x1b
+	.byte	0x28
+	.long	0x18c9
+	.uleb128 0x1
+	.long	.LASF2854
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x6
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2861
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x41
+	.byte	0x10
+	.long	0x1918
+	.uleb128 0x2
+	.long	.LASF2862
+	.byte	0x1b
+	.byte	0x42
+	.byte	0xc
+	.long	0xbe
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2863
+	.byte	0x1b
+	.byte	0x43
+	.byte	0xd
+	.long	0xf4
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2864
+	.byte	0x1b
+	.byte	0x44
+	.byte	0x9
+	.long	0x157
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2865
+	.byte	0x1b
+	.byte	0x45
+	.byte	0xd
+	.long	0xca
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2866
+	.byte	0x1b
+	.byte	0x46
+	.byte	0xe
+	.long	0x10a
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2867
+	.byte	0x1b
+	.byte	0x47
+	.byte	0x3
+	.long	0x18c9
+	.uleb128 0xe
+	.long	0x1918
+	.uleb128 0xd
+	.long	.LASF2868
+	.byte	0x1b
+	.byte	0x49
+	.byte	0x16
+	.long	0x1918
+	.uleb128 0x10
+	.long	.LASF2869
+	.byte	0x1c
+	.byte	0x1b
+	.byte	0x53
+	.byte	0x10
+	.long	0x19c5
+	.uleb128 0x2
+	.long	.LASF2870
+	.byte	0x1b
+	.byte	0x55
+	.byte	0xe
+	.long	0x10a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2871
+	.byte	0x1b
+	.byte	0x56
+	.byte	0xe
+	.long	0x10a
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2872
+	.byte	0x1b
+	.byte	0x57
+	.byte	0xe
+	.long	0x10a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2873
+	.byte	0x1b
+	.byte	0x58
+	.byte	0xd
+	.long	0xf4
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2874
+	.byte	0x1b
+	.byte	0x59
+	.byte	0xe
+	.long	0x10a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2875
+	.byte	0x1b
+	.byte	0x5a
+	.byte	0xe
+	.long	0x10a
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2876
+	.byte	0x1b
+	.byte	0x5b
+	.byte	0xe
+	.long	0x10a
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2877
+	.byte	0x1b
+	.byte	0x5c
+	.byte	0xb
+	.long	0x15e
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2878
+	.byte	0x1b
+	.byte	0x5d
+	.byte	0xb
+	.long	0x15e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2879
+	.byte	0x1b
+	.byte	0x5e
+	.byte	0xd
+	.long	0xf4
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2880
+	.byte	0x1b
+	.byte	0x5f
+	.byte	0x3
+	.long	0x1935
+	.uleb128 0xe
+	.long	0x19c5
+	.uleb128 0xd
+	.long	.LASF2881
+	.byte	0x1b
+	.byte	0x61
+	.byte	0x16
+	.long	0x19c5
+	.uleb128 0x9
+	.long	0x4c
+	.byte	0x1c
+	.byte	0x39
+	.long	0x1a36
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0xb
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x20
+	.long	0x1a66
+	.uleb128 0x2
+	.long	.LASF2894
+	.byte	0x1d
+	.byte	0x22
+	.byte	0x11
+	.long	0xca
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2895
+	.byte	0x1d
+	.byte	0x23
+	.byte	0x11
+	.long	0xca
+	.byte	0x2
+	.uleb128 0x2c
+	.string	"yaw"
+	.byte	0x1d
+	.byte	0x24
+	.byte	0x11
+	.long	0xca
+	.byte	0x4
+	.byte	0
+	.uleb128 0x2d
+	.byte	0x6
+	.byte	0x1d
+	.byte	0x1e
+	.byte	0x9
+	.long	0x1a88
+	.uleb128 0x2e
+	.string	"raw"
+	.byte	0x1d
+	.byte	0x1f
+	.byte	0xd
+	.long	0x7c1
+	.uleb128 0x2f
+	.long	.LASF2896
+	.byte	0x1d
+	.byte	0x25
+	.byte	0x7
+	.long	0x1a36
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2897
+	.byte	0x1d
+	.byte	0x26
+	.byte	0x3
+	.long	0x1a66
+	.uleb128 0xd
+	.long	.LASF2898
+	.byte	0x1d
+	.byte	0x29
+	.byte	0x1e
+	.long	0x1a88
+	.uleb128 0x10
+	.long	.LASF2899
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x6c
+	.byte	0x10
+	.long	0x1ae2
+	.uleb128 0x2
+	.long	.LASF2900
+	.byte	0x1e
+	.byte	0x6d
+	.byte	0x9
+	.long	0x157
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2901
+	.byte	0x1e
+	.byte	0x73
+	.byte	0xe
+	.long	0x13f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2902
+	.byte	0x1e
+	.byte	0x74
+	.byte	0xd
+	.long	0x1ae2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2903
+	.byte	0x1e
+	.byte	0x75
+	.byte	0xd
+	.long	0xf4
+	.byte	0x11
+	.byte	0
+	.uleb128 0x15
+	.long	0xf4
+	.long	0x1af2
+	.uleb128 0x16
+	.long	0x22
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2904
+	.byte	0x1e
+	.byte	0x76
+	.byte	0x3
+	.long	0x1aa0
+	.uleb128 0x1e
+	.long	.LASF2905
+	.byte	0x78
+	.byte	0xd
+	.long	0x12e
+	.uleb128 0x19
+	.long	.LASF2908
+	.byte	0x79
+	.byte	0x11
+	.long	0x14b
+	.uleb128 0x30
+	.string	"dT"
+	.byte	0x1e
+	.byte	0x7b
+	.byte	0x8
+	.long	0x15e
+	.uleb128 0x1e
+	.long	.LASF2906
+	.byte	0x7d
+	.byte	0x9
+	.long	0xca
+	.uleb128 0x1e
+	.long	.LASF2907
+	.byte	0x7f
+	.byte	0x9
+	.long	0xf4
+	.uleb128 0x19
+	.long	.LASF2909
+	.byte	0x81
+	.byte	0xc
+	.long	0x157
+	.uleb128 0x19
+	.long	.LASF2910
+	.byte	0x82
+	.byte	0x11
+	.long	0x116
+	.uleb128 0x19
+	.long	.LASF2911
+	.byte	0x83
+	.byte	0x17
+	.long	0xa9a
+	.uleb128 0x19
+	.long	.LASF2912
+	.byte	0x84
+	.byte	0x1f
+	.long	0x1af2
+	.uleb128 0x8
+	.long	.LASF2913
+	.byte	0x1f
+	.byte	0x28
+	.uleb128 0x8
+	.long	.LASF2914
+	.byte	0x1f
+	.byte	0x29
+	.uleb128 0xf
+	.long	.LASF2919
+	.byte	0x21
+	.byte	0x19
+	.long	0x1b80
+	.uleb128 0x3
+	.long	0x13f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2915
+	.byte	0x1b
+	.byte	0x81
+	.uleb128 0x8
+	.long	.LASF2916
+	.byte	0x1b
+	.byte	0x80
+	.uleb128 0xc
+	.long	.LASF2917
+	.byte	0x18
+	.byte	0xb8
+	.byte	0x5
+	.long	0x157
+	.long	0x1ba9
+	.uleb128 0x3
+	.long	0x14b
+	.uleb128 0x3
+	.long	0x12e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2918
+	.byte	0x20
+	.byte	0x88
+	.byte	0x7
+	.long	0x15e
+	.long	0x1bc9
+	.uleb128 0x3
+	.long	0x15e
+	.uleb128 0x3
+	.long	0x15e
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2923
+	.byte	0x1d
+	.byte	0x45
+	.byte	0x7
+	.long	0x15e
+	.uleb128 0xf
+	.long	.LASF2920
+	.byte	0x22
+	.byte	0x25
+	.long	0x1be6
+	.uleb128 0x3
+	.long	0x14b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2921
+	.byte	0x1b
+	.byte	0x7e
+	.uleb128 0x8
+	.long	.LASF2922
+	.byte	0x23
+	.byte	0x97
+	.uleb128 0xa
+	.long	.LASF2924
+	.byte	0x23
+	.byte	0x94
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x8
+	.long	.LASF2925
+	.byte	0x1b
+	.byte	0x7f
+	.uleb128 0xf
+	.long	.LASF2926
+	.byte	0x23
+	.byte	0x99
+	.long	0x1c18
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2927
+	.byte	0x23
+	.byte	0x96
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xf
+	.long	.LASF2928
+	.byte	0x1b
+	.byte	0x7d
+	.long	0x1c35
+	.uleb128 0x3
+	.long	0x165
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2929
+	.byte	0x1c
+	.byte	0xb4
+	.long	0x1c46
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2930
+	.byte	0x1c
+	.byte	0xb3
+	.long	0x1c57
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2931
+	.byte	0x1b
+	.byte	0x73
+	.byte	0x5
+	.long	0x29
+	.uleb128 0x1a
+	.long	.LASF2932
+	.value	0x197
+	.long	0x157
+	.uleb128 0x1f
+	.long	.LASF2933
+	.value	0x193
+	.uleb128 0x1f
+	.long	.LASF2934
+	.value	0x192
+	.uleb128 0x1f
+	.long	.LASF2935
+	.value	0x191
+	.uleb128 0xf
+	.long	.LASF2936
+	.byte	0x24
+	.byte	0x1f
+	.long	0x1c94
+	.uleb128 0x3
+	.long	0x157
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2937
+	.byte	0x1d
+	.byte	0x43
+	.long	0x1ca5
+	.uleb128 0x3
+	.long	0x14b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2938
+	.byte	0x1d
+	.byte	0x44
+	.uleb128 0x8
+	.long	.LASF2939
+	.byte	0x25
+	.byte	0x59
+	.uleb128 0x1a
+	.long	.LASF2940
+	.value	0x1f2
+	.long	0x157
+	.uleb128 0x1a
+	.long	.LASF2941
+	.value	0x1f1
+	.long	0x157
+	.uleb128 0xf
+	.long	.LASF2942
+	.byte	0x26
+	.byte	0x45
+	.long	0x1cda
+	.uleb128 0x3
+	.long	0x14b
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2943
+	.byte	0xc
+	.byte	0x7b
+	.uleb128 0x8
+	.long	.LASF2944
+	.byte	0xc
+	.byte	0x82
+	.uleb128 0xa
+	.long	.LASF2945
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xa
+	.long	0x116
+	.uleb128 0xa
+	.long	.LASF2946
+	.byte	0xc
+	.byte	0x81
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF2947
+	.byte	0x21
+	.byte	0x1b
+	.byte	0xa
+	.long	0x14b
+	.uleb128 0xc
+	.long	.LASF2948
+	.byte	0x19
+	.byte	0xaf
+	.byte	0xd
+	.long	0x12e
+	.long	0x1d22
+	.uleb128 0x3
+	.long	0x1649
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2949
+	.byte	0x27
+	.byte	0x6d
+	.uleb128 0x8
+	.long	.LASF2950
+	.byte	0x1a
+	.byte	0x60
+	.uleb128 0x8
+	.long	.LASF2951
+	.byte	0x1c
+	.byte	0xc3
+	.uleb128 0xa
+	.long	.LASF2952
+	.byte	0x12
+	.byte	0x6d
+	.byte	0x13
+	.long	0xe76
+	.uleb128 0xa
+	.long	.LASF2953
+	.byte	0x28
+	.byte	0xa0
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x8
+	.long	.LASF2954
+	.byte	0x1c
+	.byte	0xab
+	.uleb128 0xc
+	.long	.LASF2955
+	.byte	0x14
+	.byte	0xa1
+	.byte	0xa
+	.long	0x116
+	.long	0x1d6c
+	.uleb128 0x3
+	.long	0x11ec
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2956
+	.byte	0x14
+	.byte	0xa0
+	.byte	0xa
+	.long	0x116
+	.long	0x1d82
+	.uleb128 0x3
+	.long	0x11ec
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2957
+	.value	0x196
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF2958
+	.byte	0x28
+	.byte	0xa6
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xf
+	.long	.LASF2959
+	.byte	0x29
+	.byte	0x8d
+	.long	0x1daf
+	.uleb128 0x3
+	.long	0x1daf
+	.uleb128 0x3
+	.long	0x157
+	.byte	0
+	.uleb128 0x7
+	.long	0xd3d
+	.uleb128 0xf
+	.long	.LASF2960
+	.byte	0x29
+	.byte	0x8b
+	.long	0x1dc5
+	.uleb128 0x3
+	.long	0x157
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2961
+	.byte	0x18
+	.byte	0xb9
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x8
+	.long	.LASF2962
+	.byte	0x13
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF2963
+	.byte	0x13
+	.byte	0x7c
+	.uleb128 0xf
+	.long	.LASF2964
+	.byte	0x12
+	.byte	0x6e
+	.long	0x1df0
+	.uleb128 0x3
+	.long	0xe29
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2965
+	.byte	0x15
+	.byte	0x37
+	.uleb128 0x8
+	.long	.LASF2966
+	.byte	0x28
+	.byte	0x9c
+	.uleb128 0x8
+	.long	.LASF2967
+	.byte	0x28
+	.byte	0x9b
+	.uleb128 0xa
+	.long	.LASF2968
+	.byte	0x28
+	.byte	0x9f
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xf
+	.long	.LASF2969
+	.byte	0x18
+	.byte	0xc2
+	.long	0x1e22
+	.uleb128 0x3
+	.long	0x14b
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2970
+	.byte	0x18
+	.byte	0xbb
+	.byte	0x5
+	.long	0x157
+	.long	0x1e38
+	.uleb128 0x3
+	.long	0x14b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2971
+	.byte	0x15
+	.byte	0x39
+	.long	0x1e49
+	.uleb128 0x3
+	.long	0xf4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2972
+	.byte	0x2a
+	.byte	0xf
+	.uleb128 0x1a
+	.long	.LASF2973
+	.value	0x19e
+	.long	0x157
+	.uleb128 0x8
+	.long	.LASF2974
+	.byte	0x22
+	.byte	0x27
+	.uleb128 0xf
+	.long	.LASF2975
+	.byte	0x1c
+	.byte	0xc0
+	.long	0x1e73
+	.uleb128 0x3
+	.long	0xca
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2976
+	.byte	0x16
+	.byte	0x6e
+	.byte	0xf
+	.long	0x6b3
+	.long	0x1e8e
+	.uleb128 0x3
+	.long	0x116
+	.uleb128 0x3
+	.long	0x143c
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2977
+	.byte	0x27
+	.byte	0x6e
+	.long	0x1e9f
+	.uleb128 0x3
+	.long	0x1448
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2978
+	.byte	0x16
+	.byte	0x6d
+	.byte	0xf
+	.long	0x6b3
+	.long	0x1eba
+	.uleb128 0x3
+	.long	0x116
+	.uleb128 0x3
+	.long	0x143c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2979
+	.byte	0x21
+	.byte	0x1d
+	.byte	0xa
+	.long	0x13f
+	.uleb128 0x8
+	.long	.LASF2980
+	.byte	0x2b
+	.byte	0x8d
+	.uleb128 0x8
+	.long	.LASF2981
+	.byte	0x2a
+	.byte	0x10
+	.uleb128 0x8
+	.long	.LASF2982
+	.byte	0x22
+	.byte	0x28
+	.uleb128 0xc
+	.long	.LASF2983
+	.byte	0x2c
+	.byte	0x1e
+	.byte	0x5
+	.long	0x157
+	.long	0x1ef1
+	.uleb128 0x3
+	.long	0x116
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2984
+	.byte	0x2d
+	.byte	0x17
+	.uleb128 0x8
+	.long	.LASF2985
+	.byte	0x2d
+	.byte	0x15
+	.uleb128 0x8
+	.long	.LASF2986
+	.byte	0x2d
+	.byte	0x18
+	.uleb128 0xc
+	.long	.LASF2987
+	.byte	0x13
+	.byte	0x77
+	.byte	0x5
+	.long	0x157
+	.long	0x1f1c
+	.uleb128 0x3
+	.long	0x109c
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2988
+	.byte	0x2e
+	.byte	0x1c
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x31
+	.long	.LASF2989
+	.byte	0x17
+	.value	0x19d
+	.byte	0x14
+	.long	0x1477
+	.long	0x1f3f
+	.uleb128 0x3
+	.long	0x1f3f
+	.byte	0
+	.uleb128 0x7
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF2990
+	.byte	0x12
+	.byte	0x6b
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x1a
+	.long	.LASF2991
+	.value	0x1f0
+	.long	0x157
+	.uleb128 0xc
+	.long	.LASF2992
+	.byte	0x12
+	.byte	0x6c
+	.byte	0x12
+	.long	0xe29
+	.long	0x1f71
+	.uleb128 0x3
+	.long	0xe52
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2993
+	.byte	0x28
+	.byte	0xa1
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xf
+	.long	.LASF2994
+	.byte	0x15
+	.byte	0x36
+	.long	0x1f8e
+	.uleb128 0x3
+	.long	0x1377
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2995
+	.byte	0x20
+	.byte	0x9f
+	.byte	0x7
+	.long	0x15e
+	.long	0x1fa4
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2996
+	.byte	0x20
+	.byte	0xa0
+	.byte	0x7
+	.long	0x15e
+	.long	0x1fba
+	.uleb128 0x3
+	.long	0x15e
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2997
+	.byte	0x20
+	.byte	0x8e
+	.byte	0x7
+	.long	0x15e
+	.long	0x1fd0
+	.uleb128 0x3
+	.long	0xca
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2998
+	.byte	0x28
+	.byte	0xaa
+	.uleb128 0xc
+	.long	.LASF2999
+	.byte	0x2f
+	.byte	0x18
+	.byte	0xa
+	.long	0x10a
+	.long	0x1fed
+	.uleb128 0x3
+	.long	0x10a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3000
+	.byte	0x18
+	.byte	0xd2
+	.byte	0x9
+	.long	0xca
+	.long	0x2003
+	.uleb128 0x3
+	.long	0x4c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF3001
+	.byte	0x28
+	.byte	0xa5
+	.uleb128 0xa
+	.long	.LASF3002
+	.byte	0x28
+	.byte	0xa8
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xc
+	.long	.LASF3003
+	.byte	0x2f
+	.byte	0x17
+	.byte	0x9
+	.long	0xca
+	.long	0x2031
+	.uleb128 0x3
+	.long	0xdb
+	.uleb128 0x3
+	.long	0xf4
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3004
+	.byte	0x20
+	.byte	0x84
+	.byte	0x9
+	.long	0xdb
+	.long	0x204c
+	.uleb128 0x3
+	.long	0xdb
+	.uleb128 0x3
+	.long	0xdb
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3005
+	.byte	0x20
+	.byte	0x87
+	.byte	0x5
+	.long	0x29
+	.long	0x206c
+	.uleb128 0x3
+	.long	0x29
+	.uleb128 0x3
+	.long	0x29
+	.uleb128 0x3
+	.long	0x29
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3006
+	.byte	0xc
+	.byte	0x7d
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF3007
+	.byte	0x25
+	.byte	0x54
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x1a
+	.long	.LASF3008
+	.value	0x19f
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF3009
+	.byte	0x30
+	.byte	0x43
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xa
+	.long	.LASF3010
+	.byte	0x31
+	.byte	0x39
+	.byte	0x5
+	.long	0x157
+	.uleb128 0xc
+	.long	.LASF3011
+	.byte	0x14
+	.byte	0xa3
+	.byte	0x5
+	.long	0x157
+	.long	0x20bd
+	.uleb128 0x3
+	.long	0x116
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3013
+	.value	0x377
+	.long	0x20d5
+	.uleb128 0x13
+	.long	.LASF3015
+	.value	0x377
+	.byte	0x13
+	.long	0x157
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3012
+	.value	0x372
+	.byte	0x7
+	.long	0x15e
+	.uleb128 0x12
+	.long	.LASF3014
+	.value	0x36b
+	.long	0x20f9
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x36b
+	.byte	0x20
+	.long	0x14b
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF3017
+	.byte	0x1e
+	.value	0x364
+	.byte	0x5
+	.long	0x157
+	.long	0x2123
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x364
+	.byte	0x20
+	.long	0x14b
+	.uleb128 0x13
+	.long	.LASF3018
+	.value	0x364
+	.byte	0x3b
+	.long	0x12e
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3019
+	.value	0x353
+	.long	0x213b
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x353
+	.byte	0x28
+	.long	0x14b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3020
+	.value	0x2f4
+	.long	0x2161
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x2f4
+	.byte	0x1f
+	.long	0x14b
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3021
+	.value	0x319
+	.byte	0x11
+	.long	0xca
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3049
+	.value	0x2ea
+	.byte	0xe
+	.long	0x15e
+	.long	0x218c
+	.uleb128 0x13
+	.long	.LASF3022
+	.value	0x2ea
+	.byte	0x3e
+	.long	0xf4
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3023
+	.value	0x2ed
+	.byte	0xf
+	.long	0x15e
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3024
+	.value	0x2c7
+	.long	0x21bc
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x2c7
+	.byte	0x18
+	.long	0x14b
+	.uleb128 0xb
+	.long	.LASF3018
+	.value	0x2ca
+	.byte	0x17
+	.long	0x13a
+	.uleb128 0xb
+	.long	.LASF3025
+	.value	0x2cb
+	.byte	0xe
+	.long	0x14b
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3026
+	.value	0x205
+	.long	0x221e
+	.uleb128 0x13
+	.long	.LASF3016
+	.value	0x205
+	.byte	0x19
+	.long	0x14b
+	.uleb128 0xb
+	.long	.LASF3027
+	.value	0x219
+	.byte	0x1c
+	.long	0xe35
+	.uleb128 0xb
+	.long	.LASF3028
+	.value	0x236
+	.byte	0x9
+	.long	0x157
+	.uleb128 0x23
+	.long	0x21fd
+	.uleb128 0xb
+	.long	.LASF3029
+	.value	0x21d
+	.byte	0x14
+	.long	0x157
+	.byte	0
+	.uleb128 0x23
+	.long	0x220f
+	.uleb128 0xb
+	.long	.LASF3030
+	.value	0x231
+	.byte	0xd
+	.long	0x157
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3031
+	.value	0x294
+	.byte	0x23
+	.long	0xe76
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3032
+	.value	0x1be
+	.long	0x2246
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3033
+	.value	0x1d6
+	.byte	0xd
+	.long	0x157
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3034
+	.value	0x1ea
+	.byte	0x1b
+	.long	0x6b3
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3035
+	.value	0x1b6
+	.long	0x225e
+	.uleb128 0xb
+	.long	.LASF3036
+	.value	0x1b7
+	.byte	0x13
+	.long	0x6b3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3037
+	.value	0x193
+	.long	0x22ad
+	.uleb128 0x13
+	.long	.LASF3038
+	.value	0x193
+	.byte	0x20
+	.long	0x157
+	.uleb128 0x14
+	.uleb128 0x24
+	.string	"now"
+	.value	0x199
+	.byte	0x12
+	.long	0x13f
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3039
+	.value	0x1aa
+	.byte	0x15
+	.long	0xf4
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3039
+	.value	0x1a0
+	.byte	0x1d
+	.long	0xf4
+	.uleb128 0x14
+	.uleb128 0x24
+	.string	"ii"
+	.value	0x1a2
+	.byte	0x1e
+	.long	0x29
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3040
+	.value	0x18e
+	.byte	0x10
+	.long	0xa9a
+	.uleb128 0x12
+	.long	.LASF3041
+	.value	0x17c
+	.long	0x22d1
+	.uleb128 0x13
+	.long	.LASF3042
+	.value	0x17c
+	.byte	0x1c
+	.long	0xa9a
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3043
+	.value	0x152
+	.long	0x231b
+	.uleb128 0xb
+	.long	.LASF3044
+	.value	0x154
+	.byte	0xd
+	.long	0xdb
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF3045
+	.value	0x170
+	.byte	0x19
+	.long	0x165
+	.uleb128 0xb
+	.long	.LASF3046
+	.value	0x171
+	.byte	0x19
+	.long	0x165
+	.uleb128 0xb
+	.long	.LASF3047
+	.value	0x172
+	.byte	0x19
+	.long	0x165
+	.uleb128 0xb
+	.long	.LASF3048
+	.value	0x173
+	.byte	0x1b
+	.long	0xd6
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.long	.LASF3060
+	.byte	0x1e
+	.value	0x14d
+	.byte	0xc
+	.long	0x157
+	.uleb128 0x20
+	.long	.LASF3050
+	.value	0x146
+	.byte	0xc
+	.long	0x157
+	.long	0x2345
+	.uleb128 0xb
+	.long	.LASF3051
+	.value	0x148
+	.byte	0xe
+	.long	0x116
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF3052
+	.value	0x13e
+	.byte	0xc
+	.long	0x157
+	.long	0x2362
+	.uleb128 0xb
+	.long	.LASF3053
+	.value	0x140
+	.byte	0x9
+	.long	0x29
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF3069
+	.byte	0x1e
+	.byte	0xaf
+	.byte	0xd
+	.long	0x237c
+	.uleb128 0x14
+	.uleb128 0x19
+	.long	.LASF3054
+	.byte	0xb5
+	.byte	0x14
+	.long	0x157
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF3055
+	.byte	0x1e
+	.byte	0xa5
+	.byte	0x9
+	.long	0xca
+	.long	0x23b6
+	.uleb128 0x21
+	.long	.LASF3056
+	.byte	0x22
+	.long	0xca
+	.uleb128 0x21
+	.long	.LASF3057
+	.byte	0x33
+	.long	0xca
+	.uleb128 0x21
+	.long	.LASF2583
+	.byte	0x41
+	.long	0xca
+	.uleb128 0x19
+	.long	.LASF3058
+	.byte	0xa7
+	.byte	0xd
+	.long	0xca
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF3059
+	.byte	0x1e
+	.byte	0x86
+	.byte	0x5
+	.long	0x157
+	.uleb128 0x18
+	.long	.LASF3061
+	.byte	0x1b
+	.byte	0x61
+	.byte	0x74
+	.long	0x23ce
+	.uleb128 0x7
+	.long	0x19d1
+	.uleb128 0x18
+	.long	.LASF3062
+	.byte	0x1b
+	.byte	0x49
+	.byte	0x74
+	.long	0x23df
+	.uleb128 0x7
+	.long	0x1924
+	.uleb128 0x18
+	.long	.LASF3063
+	.byte	0x1a
+	.byte	0x58
+	.byte	0x88
+	.long	0x23f0
+	.uleb128 0x7
+	.long	0x1882
+	.uleb128 0x18
+	.long	.LASF3064
+	.byte	0x18
+	.byte	0x82
+	.byte	0x65
+	.long	0x2401
+	.uleb128 0x7
+	.long	0x15ae
+	.uleb128 0x18
+	.long	.LASF3065
+	.byte	0x12
+	.byte	0x65
+	.byte	0x79
+	.long	0x2412
+	.uleb128 0x7
+	.long	0xf7d
+	.uleb128 0x18
+	.long	.LASF3066
+	.byte	0x12
+	.byte	0x5d
+	.byte	0x8d
+	.long	0x2423
+	.uleb128 0x7
+	.long	0xf2b
+	.uleb128 0x18
+	.long	.LASF3067
+	.byte	0x10
+	.byte	0x52
+	.byte	0x79
+	.long	0x2434
+	.uleb128 0x7
+	.long	0xc6c
+	.uleb128 0x18
+	.long	.LASF3068
+	.byte	0xc
+	.byte	0x62
+	.byte	0x6f
+	.long	0x2445
+	.uleb128 0x7
+	.long	0xa43
+	.uleb128 0x37
+	.long	.LASF3070
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1b
+	.long	0x12e
+	.uleb128 0x25
+	.string	"a"
+	.byte	0x2e
+	.long	0x14b
+	.uleb128 0x25
+	.string	"b"
+	.byte	0x3a
+	.long	0x14b
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 165
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 30
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 50 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 51 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 52 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 54 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 55 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 58 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF544
+	.file 60 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x3c
+	.file 61 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF610
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF646
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 67 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF674
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF675
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF735
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF749
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF750
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x48
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF567
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF754
+	.file 74 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF755
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF772
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF785
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x53
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x54
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x55
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF811
+	.file 86 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x56
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF812
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF813
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF825
+	.byte	0x4
+	.file 89 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 90 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x4
+	.file 91 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x5b
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF837
+	.file 92 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x5c
+	.byte	0x4
+	.file 93 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x4
+	.file 94 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5e
+	.file 95 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF905
+	.byte	0x4
+	.file 97 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x61
+	.file 98 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 99 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x63
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 100 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x64
+	.byte	0x4
+	.file 101 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1091
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.file 102 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x66
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.file 103 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x67
+	.file 104 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 105 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x69
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 106 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 107 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1215
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 108 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x9
+	.file 109 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x6d
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1230
+	.byte	0x4
+	.file 110 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.file 111 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x6f
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.file 112 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1621
+	.byte	0x4
+	.file 113 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x71
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1626
+	.byte	0x4
+	.file 114 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x72
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x25
+	.file 115 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x73
+	.file 116 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x75
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x76
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1904
+	.byte	0x4
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x7a
+	.byte	0x4
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x7b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x7a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x7b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x7a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x7b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x7a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.file 124 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7c
+	.file 125 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x7d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.file 126 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7e
+	.file 127 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7f
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1998
+	.file 128 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x80
+	.byte	0x4
+	.byte	0x4
+	.file 129 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x81
+	.file 130 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2011
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x31
+	.file 131 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x83
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x30
+	.file 132 "./src/main/common/calibration.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x84
+	.file 133 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 134 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x86
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2044
+	.file 135 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x87
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2045
+	.byte	0x4
+	.byte	0x4
+	.file 136 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x88
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 137 "./src/main/drivers/pitotmeter.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x89
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.file 138 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x8a
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.file 139 "./src/main/sensors/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x8b
+	.file 140 "./src/main/drivers/rangefinder/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8c
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x26
+	.file 141 "./src/main/drivers/opflow/opflow.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8d
+	.byte	0x4
+	.byte	0x4
+	.file 142 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x8e
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0xe
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2069
+	.byte	0x4
+	.file 143 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x8f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2070
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x29
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2082
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x13
+	.file 144 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x90
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x15
+	.byte	0x4
+	.file 145 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x91
+	.byte	0x4
+	.file 146 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x92
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0x2d
+	.byte	0x4
+	.file 147 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0x93
+	.file 148 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x94
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x4
+	.file 149 "./src/main/io/piniobox.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0x95
+	.file 150 "./src/main/drivers/pinio.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x96
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0x27
+	.file 151 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x97
+	.file 152 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x98
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.file 153 "./src/main/rx/msp.h"
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x99
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2194
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0x1d
+	.file 154 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9a
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF2247
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF464
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF604
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF824
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1125
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1135
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1137
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.10f237ed61a9ae208342a970c4692795,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1142
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1214
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.global_functions.h.29.fb1af0cee01f455e1be8fe7fa6b2a019,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.20.ee45acdfc1bcd9ce748b7901bfda3b6c,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1232
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1240
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1252
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1898
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1903
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1908
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1933
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1936
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1936
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1936
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1936
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1936
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1924
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1925
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1927
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1945
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1946
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1947
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1948
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1955
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1956
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1957
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1958
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1959
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1960
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2010
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2042
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2056
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2062
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.42.85deea106217bb5124375716e7a86067,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2073
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2081
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2086
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.121.1375c5dbbb76305753358dfb80c7f17e,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2099
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2110
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2139
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pinio.h.28.0dab2dfd372b0c89fffb5b699b7b3419,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2141
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2149
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2160
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2188
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.35.d0d785404ac74fe33f68f976f92c394d,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2193
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2203
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2242
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1d
+	.long	.LASF1
+	.long	.LASF3072
+	.long	.LASF3073
+	.long	.LASF3074
+	.long	.LASF3075
+	.long	.LASF3076
+	.long	.LASF3077
+	.long	.LASF3078
+	.long	.LASF3079
+	.long	.LASF3080
+	.long	.LASF3081
+	.long	.LASF3082
+	.long	.LASF3083
+	.long	.LASF3084
+	.long	.LASF3085
+	.long	.LASF3086
+	.long	.LASF3087
+	.long	.LASF3088
+	.long	.LASF3089
+	.long	.LASF3090
+	.long	.LASF3091
+	.long	.LASF3092
+	.long	.LASF3093
+	.long	.LASF3094
+	.long	.LASF3095
+	.long	.LASF3096
+	.long	.LASF3097
+	.long	.LASF3098
+	.long	.LASF3099
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x9b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3100
+	.byte	0x18
+	.long	.LASF3101
+	.byte	0x18
+	.long	.LASF3102
+	.byte	0x18
+	.long	.LASF3103
+	.byte	0x3
+	.long	.LASF3104
+	.byte	0x3
+	.long	.LASF3105
+	.byte	0x3
+	.long	.LASF3106
+	.byte	0x3
+	.long	.LASF3107
+	.byte	0x9
+	.long	.LASF3108
+	.byte	0x9
+	.long	.LASF3109
+	.byte	0x12
+	.long	.LASF3110
+	.byte	0x9
+	.long	.LASF3111
+	.byte	0x12
+	.long	.LASF3112
+	.byte	0xa
+	.long	.LASF3113
+	.byte	0xa
+	.long	.LASF3114
+	.byte	0x9
+	.long	.LASF3115
+	.byte	0xa
+	.long	.LASF3116
+	.byte	0xa
+	.long	.LASF3117
+	.byte	0xa
+	.long	.LASF3118
+	.byte	0xa
+	.long	.LASF3119
+	.byte	0xa
+	.long	.LASF3120
+	.byte	0xd
+	.long	.LASF3108
+	.byte	0xd
+	.long	.LASF3121
+	.byte	0xf
+	.long	.LASF3122
+	.byte	0x10
+	.long	.LASF3123
+	.byte	0x11
+	.long	.LASF3124
+	.byte	0x15
+	.long	.LASF3125
+	.byte	0xb
+	.long	.LASF3126
+	.byte	0xb
+	.long	.LASF3127
+	.byte	0xb
+	.long	.LASF3128
+	.byte	0xa
+	.long	.LASF3129
+	.byte	0x9
+	.long	.LASF3130
+	.byte	0x3
+	.long	.LASF3103
+	.byte	0x9
+	.long	.LASF3131
+	.byte	0x1
+	.long	.LASF3132
+	.byte	0xb
+	.long	.LASF3133
+	.byte	0xa
+	.long	.LASF3134
+	.byte	0x12
+	.long	.LASF3135
+	.byte	0x12
+	.long	.LASF3136
+	.byte	0xe
+	.long	.LASF3137
+	.byte	0xb
+	.long	.LASF3138
+	.byte	0xa
+	.long	.LASF3139
+	.byte	0xa
+	.long	.LASF3140
+	.byte	0x3
+	.long	.LASF3141
+	.byte	0x4
+	.long	.LASF3142
+	.byte	0xd
+	.long	.LASF3143
+	.byte	0x12
+	.long	.LASF3144
+	.byte	0xa
+	.long	.LASF3145
+	.byte	0x12
+	.long	.LASF3146
+	.byte	0x12
+	.long	.LASF3147
+	.byte	0x1b
+	.long	.LASF3148
+	.byte	0x1c
+	.long	.LASF3149
+	.byte	0x1b
+	.long	.LASF3150
+	.byte	0x18
+	.long	.LASF3151
+	.byte	0x1b
+	.long	.LASF3152
+	.byte	0x1b
+	.long	.LASF3153
+	.byte	0x18
+	.long	.LASF3154
+	.byte	0x18
+	.long	.LASF3155
+	.byte	0x1a
+	.long	.LASF3156
+	.byte	0x18
+	.long	.LASF3157
+	.byte	0x19
+	.long	.LASF3158
+	.byte	0x19
+	.long	.LASF3159
+	.byte	0x1c
+	.long	.LASF3160
+	.byte	0x18
+	.long	.LASF3161
+	.byte	0x18
+	.long	.LASF3162
+	.byte	0x18
+	.long	.LASF3163
+	.byte	0x18
+	.long	.LASF3100
+	.byte	0x1a
+	.long	.LASF3164
+	.byte	0x18
+	.long	.LASF3165
+	.byte	0x18
+	.long	.LASF3166
+	.byte	0x17
+	.long	.LASF3167
+	.byte	0x17
+	.long	.LASF3168
+	.byte	0x17
+	.long	.LASF3169
+	.byte	0x17
+	.long	.LASF3170
+	.byte	0x1b
+	.long	.LASF3170
+	.byte	0x18
+	.long	.LASF3171
+	.byte	0x18
+	.long	.LASF3172
+	.byte	0x18
+	.long	.LASF3173
+	.byte	0x18
+	.long	.LASF3174
+	.byte	0x1a
+	.long	.LASF3174
+	.byte	0x18
+	.long	.LASF3175
+	.byte	0x17
+	.long	.LASF3176
+	.byte	0x17
+	.long	.LASF3177
+	.byte	0x17
+	.long	.LASF3178
+	.byte	0x17
+	.long	.LASF3179
+	.byte	0x18
+	.long	.LASF3180
+	.byte	0x18
+	.long	.LASF3181
+	.byte	0x18
+	.long	.LASF3182
+	.byte	0x18
+	.long	.LASF3183
+	.byte	0x18
+	.long	.LASF3184
+	.byte	0x18
+	.long	.LASF3185
+	.byte	0x1b
+	.long	.LASF3186
+	.byte	0x18
+	.long	.LASF3187
+	.byte	0x18
+	.long	.LASF3188
+	.byte	0x1c
+	.long	.LASF3188
+	.byte	0x1b
+	.long	.LASF3189
+	.byte	0x18
+	.long	.LASF3190
+	.byte	0x16
+	.long	.LASF3191
+	.byte	0x14
+	.long	.LASF3192
+	.byte	0x13
+	.long	.LASF3193
+	.byte	0x14
+	.long	.LASF3194
+	.byte	0x14
+	.long	.LASF3195
+	.byte	0x1
+	.long	.LASF3196
+	.byte	0x4
+	.long	.LASF3197
+	.byte	0x2
+	.long	.LASF3198
+	.byte	0x2
+	.long	.LASF3199
+	.byte	0x3
+	.long	.LASF3200
+	.byte	0x3
+	.long	.LASF3201
+	.byte	0x9
+	.long	.LASF3202
+	.byte	0x9
+	.long	.LASF3203
+	.byte	0x9
+	.long	.LASF3204
+	.byte	0x9
+	.long	.LASF3205
+	.byte	0x9
+	.long	.LASF3206
+	.byte	0x9
+	.long	.LASF3207
+	.byte	0x12
+	.long	.LASF3208
+	.byte	0x3
+	.long	.LASF3209
+	.byte	0x1b
+	.long	.LASF3210
+	.byte	0x18
+	.long	.LASF3211
+	.byte	0x18
+	.long	.LASF3212
+	.byte	0x18
+	.long	.LASF3213
+	.byte	0x18
+	.long	.LASF3214
+	.byte	0x18
+	.long	.LASF3215
+	.byte	0x18
+	.long	.LASF3216
+	.byte	0x18
+	.long	.LASF3217
+	.byte	0x5
+	.long	.LASF3218
+	.byte	0x9
+	.long	.LASF3219
+	.byte	0x9
+	.long	.LASF3220
+	.byte	0x9
+	.long	.LASF3221
+	.byte	0x9
+	.long	.LASF3222
+	.byte	0x9
+	.long	.LASF3223
+	.byte	0x9
+	.long	.LASF3146
+	.byte	0x6
+	.long	.LASF3224
+	.byte	0x3
+	.long	.LASF3225
+	.byte	0x1b
+	.long	.LASF3226
+	.byte	0x17
+	.long	.LASF3227
+	.byte	0x17
+	.long	.LASF3228
+	.byte	0x1b
+	.long	.LASF3145
+	.byte	0x9
+	.long	.LASF3229
+	.byte	0x12
+	.long	.LASF3230
+	.byte	0x12
+	.long	.LASF3230
+	.byte	0x8
+	.long	.LASF3135
+	.byte	0x7
+	.long	.LASF3231
+	.byte	0x12
+	.long	.LASF3232
+	.byte	0x9
+	.long	.LASF3233
+	.byte	0x3
+	.long	.LASF3234
+	.byte	0xd
+	.long	.LASF3235
+	.byte	0xd
+	.long	.LASF3236
+	.byte	0xc
+	.long	.LASF3237
+	.byte	0xc
+	.long	.LASF3238
+	.byte	0xd
+	.long	.LASF3239
+	.byte	0x9
+	.long	.LASF3240
+	.byte	0xe
+	.long	.LASF3241
+	.byte	0x3
+	.long	.LASF3240
+	.byte	0x10
+	.long	.LASF3242
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1385:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1738:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2250:
+	.string	"long long int"
+.LASF2241:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1741:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2830:
+	.string	"gpsNoFixLatitude"
+.LASF1904:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF930:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF2672:
+	.string	"NAV_POSHOLD_MODE"
+.LASF868:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1007:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2392:
+	.string	"rxBufferHead"
+.LASF1823:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF2626:
+	.string	"BOXAUTOTUNE"
+.LASF1571:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1279:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2187:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF919:
+	.string	"USE_BLACKBOX "
+.LASF1244:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF1131:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF593:
+	.string	"_T_WCHAR "
+.LASF2398:
+	.string	"rxFrameCallback"
+.LASF1371:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1899:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF936:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1522:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF2586:
+	.string	"alt_hold_deadband"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1805:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1679:
+	.string	"__DECL_SIMD_pow "
+.LASF1449:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF610:
+	.string	"_STDLIB_H 1"
+.LASF2130:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF709:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2281:
+	.string	"RGB_GREEN"
+.LASF1928:
+	.string	"_Mdouble_ float"
+.LASF2239:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF2786:
+	.string	"rcFilterFrequency"
+.LASF2248:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2218:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF2771:
+	.string	"serialrx_inverted"
+.LASF2740:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1642:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1982:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2673:
+	.string	"HEADFREE_MODE"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1053:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1484:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2280:
+	.string	"RGB_RED"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF3062:
+	.string	"mixerConfig"
+.LASF734:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1407:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1530:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2333:
+	.string	"OWNER_1WIRE"
+.LASF1421:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3059:
+	.string	"isCalibrating"
+.LASF1598:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2487:
+	.string	"DISARM_KILLSWITCH"
+.LASF2489:
+	.string	"DISARM_NAVIGATION"
+.LASF1695:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2530:
+	.string	"current_profile_index"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1748:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2114:
+	.string	"LON 1"
+.LASF1632:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF2144:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF757:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF3025:
+	.string	"gyroUpdateUs"
+.LASF374:
+	.string	"__unix 1"
+.LASF2905:
+	.string	"cycleTime"
+.LASF637:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF2334:
+	.string	"OWNER_AIRSPEED"
+.LASF1467:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF515:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF624:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1690:
+	.string	"__DECL_SIMD_acosf "
+.LASF2644:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1062:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1718:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2776:
+	.string	"spektrum_sat_bind"
+.LASF905:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1839:
+	.string	"__DECL_SIMD_acosh "
+.LASF2359:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF3040:
+	.string	"getDisarmReason"
+.LASF3049:
+	.string	"calculateThrottleTiltCompensationFactor"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1699:
+	.string	"__DECL_SIMD_atan "
+.LASF3028:
+	.string	"canUseHorizonMode"
+.LASF1374:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1105:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2452:
+	.string	"gyroADCf"
+.LASF1518:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2107:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF483:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1960:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2342:
+	.string	"RESOURCE_IO"
+.LASF1573:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1477:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF959:
+	.string	"USE_DJI_HD_OSD "
+.LASF2074:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF2892:
+	.string	"PID_POS_HEADING"
+.LASF2705:
+	.string	"ALTITUDE_CONTROL"
+.LASF1209:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF2643:
+	.string	"WAS_EVER_ARMED"
+.LASF1773:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1735:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2183:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF2208:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2129:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF955:
+	.string	"USE_OLED_UG2864 "
+.LASF2747:
+	.string	"FUNCTION_RCDEVICE"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1510:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2179:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF2739:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF2536:
+	.string	"name"
+.LASF1980:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF758:
+	.string	"__BIG_ENDIAN 4321"
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2301:
+	.string	"OWNER_FREE"
+.LASF2675:
+	.string	"MANUAL_MODE"
+.LASF1670:
+	.string	"__DECL_SIMD_expf "
+.LASF550:
+	.string	"__stub_setlogin "
+.LASF2044:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2053:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2338:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF2787:
+	.string	"mspOverrideChannels"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1909:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1997:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2189:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF2611:
+	.string	"BOXLIGHTS"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2871:
+	.string	"mincommand"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF3047:
+	.string	"sinDiff"
+.LASF2180:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1111:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1588:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2010:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF2468:
+	.string	"gyro_stage2_lowpass_type"
+.LASF694:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1868:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1241:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2202:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1148:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1360:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1991:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1708:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1333:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1709:
+	.string	"__DECL_SIMD_asin "
+.LASF776:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2406:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1040:
+	.string	"USE_DASHBOARD"
+.LASF1423:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF2602:
+	.string	"BOXHEADINGHOLD"
+.LASF2874:
+	.string	"motorAccelTimeMs"
+.LASF1691:
+	.string	"__DECL_SIMD_acosl "
+.LASF1194:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1788:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2471:
+	.string	"dynamicGyroNotchMinHz"
+.LASF2295:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE_SCALE"
+.LASF1955:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2801:
+	.string	"TASK_TELEMETRY"
+.LASF1092:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF886:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1595:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2930:
+	.string	"updatePIDCoefficients"
+.LASF1223:
+	.string	"LED0_ON do {} while (0)"
+.LASF517:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1700:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1620:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF2270:
+	.string	"uint32_t"
+.LASF1243:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2191:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF2963:
+	.string	"processAirmode"
+.LASF2478:
+	.string	"kalmanEnabled"
+.LASF725:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2247:
+	.string	"TELEMETRY_FUNCTION_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_HOTT | FUNCTION_TELEMETRY_SMARTPORT | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_MAVLINK | FUNCTION_TELEMETRY_IBUS)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1356:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF522:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1432:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1643:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2175:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1621:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF1782:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2090:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF453:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2233:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF947:
+	.string	"USE_1WIRE "
+.LASF1157:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF489:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2944:
+	.string	"gyroSyncDisable"
+.LASF1601:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2824:
+	.string	"extended_status_rate"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF2075:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF1287:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2683:
+	.string	"flightModeFlags"
+.LASF1614:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1398:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2096:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2799:
+	.string	"TASK_BARO"
+.LASF2972:
+	.string	"statsOnArm"
+.LASF1633:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2161:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1746:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1009:
+	.string	"_GCC_PTRDIFF_T "
+.LASF997:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1394:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF660:
+	.string	"__f32(x) x ##f32"
+.LASF2142:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF2983:
+	.string	"feature"
+.LASF1929:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1500:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1543:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF462:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1347:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1329:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2287:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_ROLL"
+.LASF1202:
+	.string	"BIT(x) (1 << (x))"
+.LASF1316:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2138:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF1538:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1639:
+	.string	"__DECL_SIMD_sin "
+.LASF2343:
+	.string	"RESOURCE_TIMER"
+.LASF799:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1591:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF526:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1911:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2574:
+	.string	"THROTTLE_STATUS_TYPE_COMMAND"
+.LASF2823:
+	.string	"smartportFuelUnit_e"
+.LASF1527:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF615:
+	.string	"WCONTINUED 8"
+.LASF2897:
+	.string	"attitudeEulerAngles_t"
+.LASF1809:
+	.string	"__DECL_SIMD_log2 "
+.LASF2712:
+	.string	"BEEPER_HARDWARE_FAILURE"
+.LASF990:
+	.string	"USE_VTX_CONTROL "
+.LASF1448:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1638:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1463:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2750:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF793:
+	.string	"__timeval_defined 1"
+.LASF2915:
+	.string	"stopPwmAllMotors"
+.LASF2102:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2604:
+	.string	"BOXHEADADJ"
+.LASF2722:
+	.string	"BEEPER_ACTION_SUCCESS"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF966:
+	.string	"USE_LOG "
+.LASF3024:
+	.string	"taskGyro"
+.LASF3026:
+	.string	"processRx"
+.LASF1372:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF553:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF3030:
+	.string	"canUseRxData"
+.LASF1989:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1367:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF3045:
+	.string	"radDiff"
+.LASF1849:
+	.string	"__DECL_SIMD_erf "
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF692:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1827:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1541:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF716:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1599:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF460:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1798:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1514:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"HSV_VALUE_MAX 255"
+.LASF2762:
+	.string	"NAV_ARMING_BLOCKER_MISSING_GPS_FIX"
+.LASF2110:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1475:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2362:
+	.string	"MODE_RXTX"
+.LASF1238:
+	.string	"IOCFG_IPD 0"
+.LASF2939:
+	.string	"updateAccExtremes"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF629:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF2752:
+	.string	"FUNCTION_LOG"
+.LASF1668:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1961:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2851:
+	.string	"mavlink"
+.LASF672:
+	.string	"EXIT_SUCCESS 0"
+.LASF2473:
+	.string	"dynamicGyroNotchAnalyser"
+.LASF856:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2315:
+	.string	"OWNER_I2C"
+.LASF2681:
+	.string	"TURN_ASSISTANT"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF644:
+	.string	"__f128(x) x ##f128"
+.LASF2576:
+	.string	"NOT_CENTERED"
+.LASF732:
+	.string	"__FD_SETSIZE 1024"
+.LASF1616:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1680:
+	.string	"__DECL_SIMD_powf "
+.LASF769:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1498:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2979:
+	.string	"millis"
+.LASF2057:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF2117:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1745:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2420:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF1565:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1201:
+	.string	"UNUSED(x) (void)(x)"
+.LASF780:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1979:
+	.string	"M_E 2.7182818284590452354"
+.LASF2879:
+	.string	"motorPoleCount"
+.LASF2970:
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+.LASF836:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1324:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2734:
+	.string	"BEEPER_PREFERENCE"
+.LASF1076:
+	.string	"FAST_CODE "
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2039:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF680:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2290:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE"
+.LASF3027:
+	.string	"throttleStatus"
+.LASF2597:
+	.string	"armingConfig_System"
+.LASF2858:
+	.string	"PLATFORM_ROVER"
+.LASF700:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1350:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2911:
+	.string	"lastDisarmReason"
+.LASF744:
+	.string	"__pid_t_defined "
+.LASF755:
+	.string	"_ENDIAN_H 1"
+.LASF916:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1664:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1035:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF2956:
+	.string	"enableFlightMode"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF608:
+	.string	"NULL ((void *)0)"
+.LASF2608:
+	.string	"BOXMANUAL"
+.LASF707:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF493:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1233:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2391:
+	.string	"txBuffer"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2058:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF953:
+	.string	"USE_DASHBOARD "
+.LASF2662:
+	.string	"ARMING_DISABLED_OOM"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2627:
+	.string	"BOXCAMERA1"
+.LASF2628:
+	.string	"BOXCAMERA2"
+.LASF2629:
+	.string	"BOXCAMERA3"
+.LASF1629:
+	.string	"__DECL_SIMD_cos "
+.LASF1215:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF448:
+	.string	"_ATFILE_SOURCE"
+.LASF998:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1164:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF2436:
+	.string	"CW90_DEG"
+.LASF617:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF451:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2671:
+	.string	"NAV_RTH_MODE"
+.LASF2783:
+	.string	"maxcheck"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1069:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1262:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2068:
+	.string	"ERPM_PER_LSB 100.0f"
+.LASF2022:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1055:
+	.string	"USE_VCP"
+.LASF2121:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF1312:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF436:
+	.string	"__USE_ISOC95 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1867:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1142:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF765:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF2725:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1139:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2698:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF2772:
+	.string	"halfDuplex"
+.LASF2411:
+	.string	"beginWrite"
+.LASF2578:
+	.string	"rollPitchStatus_e"
+.LASF2761:
+	.string	"NAV_ARMING_BLOCKER_NONE"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF609:
+	.string	"__need_NULL"
+.LASF2984:
+	.string	"warningLedUpdate"
+.LASF1375:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF541:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1818:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF875:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF3010:
+	.string	"baroIsCalibrationComplete"
+.LASF2912:
+	.string	"emergencyArming"
+.LASF1654:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2353:
+	.string	"RESOURCE_SPI_CS"
+.LASF1905:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF627:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2975:
+	.string	"resetHeadingHoldTarget"
+.LASF2140:
+	.string	"PINIO_COUNT 4"
+.LASF929:
+	.string	"USE_PITOT_ADC "
+.LASF2668:
+	.string	"HORIZON_MODE"
+.LASF1712:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF475:
+	.string	"__P(args) args"
+.LASF2667:
+	.string	"ANGLE_MODE"
+.LASF846:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF2853:
+	.string	"telemetryConfig_System"
+.LASF1303:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2348:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1535:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2670:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1803:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1261:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2909:
+	.string	"isRXDataNew"
+.LASF1453:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1832:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF495:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1468:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1954:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2164:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF941:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1254:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF442:
+	.string	"__USE_POSIX 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF500:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1503:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2109:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1692:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2339:
+	.string	"RESOURCE_NONE"
+.LASF2019:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2919:
+	.string	"delay"
+.LASF2279:
+	.string	"FD_YAW"
+.LASF1345:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2210:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2634:
+	.string	"BOXBRAKING"
+.LASF2310:
+	.string	"OWNER_PINDEBUG"
+.LASF2375:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF829:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF1224:
+	.string	"LED1_TOGGLE do {} while (0)"
+.LASF2607:
+	.string	"BOXNAVPOSHOLD"
+.LASF1566:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1037:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF687:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF664:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1889:
+	.string	"__DECL_SIMD_tan "
+.LASF2304:
+	.string	"OWNER_PPMINPUT"
+.LASF1349:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1099:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF534:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF991:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1987:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF983:
+	.string	"USE_SERIALRX_XBUS "
+.LASF653:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1301:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2821:
+	.string	"SMARTPORT_FUEL_UNIT_MAH"
+.LASF1921:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF3019:
+	.string	"taskRunRealtimeCallbacks"
+.LASF830:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2408:
+	.string	"writeBuf"
+.LASF1578:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2593:
+	.string	"fixed_wing_auto_arm"
+.LASF696:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2765:
+	.string	"NAV_ARMING_BLOCKER_JUMP_WAYPOINT_ERROR"
+.LASF1570:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2861:
+	.string	"mixerConfig_s"
+.LASF2867:
+	.string	"mixerConfig_t"
+.LASF2197:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1299:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1509:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1499:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF787:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF987:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF2751:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2200:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1088:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1778:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2484:
+	.string	"DISARM_STICKS"
+.LASF1551:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1403:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF726:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF772:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1531:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2840:
+	.string	"smartportFuelUnit"
+.LASF701:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF642:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF3065:
+	.string	"armingConfig"
+.LASF1094:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1526:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1870:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1416:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1686:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1656:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF979:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2838:
+	.string	"report_cell_voltage"
+.LASF2833:
+	.string	"telemetry_inverted"
+.LASF975:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF697:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF878:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF628:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2236:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF2835:
+	.string	"frsky_unit"
+.LASF516:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1731:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1264:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1083:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF862:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2240:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2405:
+	.string	"serialSetBaudRate"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2742:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1381:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1780:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF741:
+	.string	"__nlink_t_defined "
+.LASF2256:
+	.string	"__uint8_t"
+.LASF2550:
+	.string	"manual"
+.LASF2704:
+	.string	"BOAT"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1602:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2857:
+	.string	"PLATFORM_TRICOPTER"
+.LASF1242:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF461:
+	.string	"__GLIBC__ 2"
+.LASF3069:
+	.string	"updateArmingStatus"
+.LASF1090:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF607:
+	.string	"NULL"
+.LASF2372:
+	.string	"SERIAL_BIDIR"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2622:
+	.string	"BOXSURFACE"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1370:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2994:
+	.string	"beeper"
+.LASF1014:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF794:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF589:
+	.string	"__wchar_t__ "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1872:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF376:
+	.string	"unix 1"
+.LASF1270:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2382:
+	.string	"serialPort_s"
+.LASF2414:
+	.string	"serialPort_t"
+.LASF1862:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF773:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1383:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1162:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF2224:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF2370:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1063:
+	.string	"U_ID_0 0"
+.LASF807:
+	.string	"__blksize_t_defined "
+.LASF1431:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2078:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF2178:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF2060:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1121:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1276:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1036:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF891:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1576:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF788:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF977:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2886:
+	.string	"PID_POS_XY"
+.LASF944:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2455:
+	.string	"gyro"
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF693:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1943:
+	.string	"_Mdouble_ _Float64x"
+.LASF479:
+	.string	"__ptr_t void *"
+.LASF480:
+	.string	"__BEGIN_DECLS "
+.LASF3021:
+	.string	"thrTiltCompStrength"
+.LASF1676:
+	.string	"__DECL_SIMD_expf32x "
+.LASF669:
+	.string	"__lldiv_t_defined 1"
+.LASF1068:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1289:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF3016:
+	.string	"currentTimeUs"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF2733:
+	.string	"BEEPER_ALL"
+.LASF2312:
+	.string	"OWNER_RANGEFINDER"
+.LASF747:
+	.string	"__daddr_t_defined "
+.LASF1546:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2688:
+	.string	"FIXED_WING_LEGACY"
+.LASF616:
+	.string	"WNOWAIT 0x01000000"
+.LASF2756:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF443:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1926:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2156:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF552:
+	.string	"__stub_stty "
+.LASF2531:
+	.string	"current_battery_profile_index"
+.LASF1419:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1486:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF497:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1713:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2717:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1681:
+	.string	"__DECL_SIMD_powl "
+.LASF1833:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1336:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2498:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2139:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2316:
+	.string	"OWNER_SDCARD"
+.LASF2906:
+	.string	"headFreeModeHold"
+.LASF933:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF784:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2600:
+	.string	"BOXHORIZON"
+.LASF1327:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1693:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2023:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2324:
+	.string	"OWNER_LED_STRIP"
+.LASF2118:
+	.string	"HDOP_SCALE (100)"
+.LASF1685:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2584:
+	.string	"yaw_deadband"
+.LASF845:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2980:
+	.string	"logicConditionReset"
+.LASF2515:
+	.string	"FEATURE_DASHBOARD"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1515:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"_SIZE_T_DEFINED "
+.LASF1237:
+	.string	"IOCFG_AF_OD 0"
+.LASF1216:
+	.string	"MAX_GLOBAL_FUNCTIONS 8"
+.LASF2192:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF1719:
+	.string	"__DECL_SIMD_hypot "
+.LASF1417:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF2729:
+	.string	"BEEPER_USB"
+.LASF2246:
+	.string	"EMERGENCY_ARMING_COUNTER_STEP_MS 100"
+.LASF2637:
+	.string	"BOXFPVANGLEMIX"
+.LASF2951:
+	.string	"autotuneUpdateState"
+.LASF1219:
+	.string	"GLOBAL_FUNCTION_FLAG(mask) (globalFunctionsFlags & (mask))"
+.LASF2534:
+	.string	"cpuUnderclock"
+.LASF2222:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1519:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1697:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2071:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2540:
+	.string	"rcExpo8"
+.LASF2699:
+	.string	"AIRMODE_ACTIVE"
+.LASF449:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1597:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2394:
+	.string	"txBufferHead"
+.LASF1758:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2679:
+	.string	"NAV_CRUISE_MODE"
+.LASF2715:
+	.string	"BEEPER_DISARMING"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF481:
+	.string	"__END_DECLS "
+.LASF804:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF873:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1871:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2196:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF1820:
+	.string	"__DECL_SIMD_log1pf "
+.LASF985:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1259:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF602:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2214:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF2660:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF2274:
+	.string	"timeUs_t"
+.LASF2735:
+	.string	"beeperMode_e"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1413:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2780:
+	.string	"rssiMax"
+.LASF2642:
+	.string	"ARMED"
+.LASF551:
+	.string	"__stub_sigreturn "
+.LASF2613:
+	.string	"BOXOSD"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2195:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1619:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1752:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1323:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF3048:
+	.string	"rcCommand_PITCH"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2445:
+	.string	"initialized"
+.LASF1596:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1950:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2745:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF2230:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF771:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF2921:
+	.string	"writeMotors"
+.LASF2113:
+	.string	"LAT 0"
+.LASF2115:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF759:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1402:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1325:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1684:
+	.string	"__DECL_SIMD_powf64 "
+.LASF789:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2433:
+	.string	"double"
+.LASF601:
+	.string	"__INT_WCHAR_T_H "
+.LASF1675:
+	.string	"__DECL_SIMD_expf128 "
+.LASF705:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2791:
+	.string	"TASK_SYSTEM"
+.LASF1208:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF464:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1441:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1617:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2521:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF2036:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2475:
+	.string	"kalman_q"
+.LASF2476:
+	.string	"kalman_w"
+.LASF2427:
+	.string	"SENSOR_RANGEFINDER"
+.LASF1729:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2412:
+	.string	"endWrite"
+.LASF2989:
+	.string	"navigationIsBlockingArming"
+.LASF1737:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF865:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1206:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1722:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2567:
+	.string	"AUX10"
+.LASF2568:
+	.string	"AUX11"
+.LASF2569:
+	.string	"AUX12"
+.LASF972:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1550:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2575:
+	.string	"throttleStatusType_e"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1542:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1673:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1274:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1768:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1357:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2286:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_POWER_LEVEL"
+.LASF783:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2449:
+	.string	"sampleBufferActive"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF999:
+	.string	"_STDDEF_H "
+.LASF2313:
+	.string	"OWNER_SYSTEM"
+.LASF2272:
+	.string	"timeDelta_t"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2418:
+	.string	"SENSOR_INDEX_MAG"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF2736:
+	.string	"FUNCTION_NONE"
+.LASF1873:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1322:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2834:
+	.string	"frsky_coordinate_format"
+.LASF1577:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF437:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2790:
+	.string	"rxConfig_System"
+.LASF2855:
+	.string	"PLATFORM_AIRPLANE"
+.LASF2163:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2020:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1830:
+	.string	"__DECL_SIMD_atanhf "
+.LASF889:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1766:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2402:
+	.string	"serialTotalRxWaiting"
+.LASF2992:
+	.string	"calculateThrottleStatus"
+.LASF1600:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2538:
+	.string	"systemConfig_System"
+.LASF951:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1085:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1887:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF2763:
+	.string	"NAV_ARMING_BLOCKER_NAV_IS_ALREADY_ACTIVE"
+.LASF1945:
+	.string	"__MATHDECL_1_IMPL"
+.LASF840:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1569:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2337:
+	.string	"OWNER_IRLOCK"
+.LASF1170:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2146:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF1587:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1288:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2243:
+	.string	"GYRO_WATCHDOG_DELAY 100"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1490:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF2450:
+	.string	"lastSampleTimeUs"
+.LASF1875:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF3054:
+	.string	"calibratingFinishedBeep"
+.LASF1399:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1572:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF622:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1265:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2306:
+	.string	"OWNER_SERVO"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2554:
+	.string	"rc_alias"
+.LASF1250:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF728:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1930:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1922:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1251:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF766:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1207:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1130:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1726:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1821:
+	.string	"__DECL_SIMD_log1pl "
+.LASF650:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2470:
+	.string	"dynamicGyroNotchQ"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1482:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF3042:
+	.string	"disarmReason"
+.LASF885:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2505:
+	.string	"FEATURE_GPS"
+.LASF1118:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2701:
+	.string	"AIRPLANE"
+.LASF2617:
+	.string	"BOXNAVWP"
+.LASF598:
+	.string	"_WCHAR_T_DEFINED "
+.LASF548:
+	.string	"__stub_gtty "
+.LASF1995:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2719:
+	.string	"BEEPER_BAT_LOW"
+.LASF2706:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2898:
+	.string	"attitude"
+.LASF3002:
+	.string	"failsafeShouldApplyControlInput"
+.LASF2397:
+	.string	"rxCallbackData"
+.LASF2990:
+	.string	"areSticksDeflectedMoreThanPosHoldDeadband"
+.LASF1412:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF459:
+	.string	"__GNU_LIBRARY__"
+.LASF1353:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1659:
+	.string	"__DECL_SIMD_log "
+.LASF722:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1776:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1082:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2490:
+	.string	"DISARM_REASON_COUNT"
+.LASF2226:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2332:
+	.string	"OWNER_TEMPERATURE"
+.LASF1915:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF2817:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2369:
+	.string	"SERIAL_PARITY_NO"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2605:
+	.string	"BOXCAMSTAB"
+.LASF1504:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1704:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1128:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF742:
+	.string	"__uid_t_defined "
+.LASF1005:
+	.string	"__PTRDIFF_T "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1883:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2363:
+	.string	"portMode_t"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1511:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1065:
+	.string	"U_ID_2 2"
+.LASF1395:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2388:
+	.string	"rxBufferSize"
+.LASF1990:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2779:
+	.string	"rssiMin"
+.LASF1258:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1456:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF2003:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF3006:
+	.string	"gyroIsCalibrationComplete"
+.LASF1984:
+	.string	"M_PI 3.14159265358979323846"
+.LASF3046:
+	.string	"cosDiff"
+.LASF2900:
+	.string	"armingSwitchWasOn"
+.LASF1753:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF685:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2499:
+	.string	"FEATURE_VBAT"
+.LASF1369:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2982:
+	.string	"blackboxFinish"
+.LASF1081:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2346:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1856:
+	.string	"__DECL_SIMD_erff32x "
+.LASF2872:
+	.string	"motorPwmRate"
+.LASF1765:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2065:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF1756:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2278:
+	.string	"FD_PITCH"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2085:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1759:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2403:
+	.string	"serialTotalTxFree"
+.LASF2441:
+	.string	"CW180_DEG_FLIP"
+.LASF2171:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF2842:
+	.string	"ltmUpdateRate"
+.LASF2259:
+	.string	"__uint16_t"
+.LASF2585:
+	.string	"pos_hold_deadband"
+.LASF1978:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2882:
+	.string	"PID_ROLL"
+.LASF1474:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1774:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1562:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF3029:
+	.string	"armedBeeperOn"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2495:
+	.string	"ADC_CURRENT"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2646:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF2625:
+	.string	"BOXAUTOTRIM"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF681:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF746:
+	.string	"__ssize_t_defined "
+.LASF2768:
+	.string	"receiverType"
+.LASF877:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF797:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2599:
+	.string	"BOXANGLE"
+.LASF2889:
+	.string	"PID_LEVEL"
+.LASF1507:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF490:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF643:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF861:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF3070:
+	.string	"cmpTimeUs"
+.LASF1075:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2620:
+	.string	"BOXGCSNAV"
+.LASF1723:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1705:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2649:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF2271:
+	.string	"uint64_t"
+.LASF968:
+	.string	"USE_CMS "
+.LASF2154:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1725:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1022:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2456:
+	.string	"gyroConfig_s"
+.LASF2479:
+	.string	"gyroConfig_t"
+.LASF2656:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF533:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF2902:
+	.string	"queue"
+.LASF496:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF736:
+	.string	"__u_char_defined "
+.LASF1716:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1613:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2492:
+	.string	"cliMode"
+.LASF1585:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2957:
+	.string	"navigationRequiresAngleMode"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1177:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2782:
+	.string	"mincheck"
+.LASF2959:
+	.string	"processRcAdjustments"
+.LASF2809:
+	.string	"TASK_COUNT"
+.LASF1257:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF844:
+	.string	"INT8_MIN (-128)"
+.LASF1023:
+	.string	"USE_UART2 "
+.LASF2630:
+	.string	"BOXOSDALT1"
+.LASF2631:
+	.string	"BOXOSDALT2"
+.LASF2632:
+	.string	"BOXOSDALT3"
+.LASF1649:
+	.string	"__DECL_SIMD_sincos "
+.LASF2106:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF887:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1501:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF2516:
+	.string	"FEATURE_UNUSED_7"
+.LASF2383:
+	.string	"vTable"
+.LASF588:
+	.string	"__need_size_t"
+.LASF2727:
+	.string	"BEEPER_ARMED"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2709:
+	.string	"stateFlags"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2469:
+	.string	"dynamicGyroNotchRange"
+.LASF1747:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF511:
+	.string	"__wur "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1750:
+	.string	"__DECL_SIMD_coshf "
+.LASF986:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF638:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2061:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF1843:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2755:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1816:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1593:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2918:
+	.string	"constrainf"
+.LASF1176:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1024:
+	.string	"USE_UART3 "
+.LASF2275:
+	.string	"_Bool"
+.LASF2221:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF612:
+	.string	"WUNTRACED 2"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2282:
+	.string	"RGB_BLUE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF753:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF2011:
+	.string	"SPIDEV_COUNT 4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF890:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1002:
+	.string	"_PTRDIFF_T "
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF595:
+	.string	"_WCHAR_T_ "
+.LASF1626:
+	.string	"HW_SENSOR_IS_HEALTHY(status) (status == HW_SENSOR_NONE || status == HW_SENSOR_OK)"
+.LASF1813:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF2215:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1278:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1112:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1025:
+	.string	"USE_UART4 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2931:
+	.string	"getThrottleIdleValue"
+.LASF1667:
+	.string	"__DECL_SIMD_logf64x "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1847:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF866:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2848:
+	.string	"simLowAltitude"
+.LASF2764:
+	.string	"NAV_ARMING_BLOCKER_FIRST_WAYPOINT_TOO_FAR"
+.LASF1124:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1343:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF691:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF2548:
+	.string	"throttle"
+.LASF2640:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1740:
+	.string	"__DECL_SIMD_exp10f "
+.LASF2687:
+	.string	"SMALL_ANGLE"
+.LASF1235:
+	.string	"IOCFG_OUT_OD 0"
+.LASF2822:
+	.string	"SMARTPORT_FUEL_UNIT_MWH"
+.LASF1373:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2188:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1236:
+	.string	"IOCFG_AF_PP 0"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2047:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF512:
+	.string	"__always_inline"
+.LASF831:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1026:
+	.string	"USE_UART5 "
+.LASF1660:
+	.string	"__DECL_SIMD_logf "
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF980:
+	.string	"USE_RX_MSP "
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF1253:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1248:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2092:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2166:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF3017:
+	.string	"taskUpdateRxCheck"
+.LASF1533:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"__ino_t_defined "
+.LASF1388:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2926:
+	.string	"servoMixer"
+.LASF2804:
+	.string	"TASK_UAV_INTERCONNECT"
+.LASF908:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1056:
+	.string	"USE_RX_PPM"
+.LASF2421:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1992:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1540:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2466:
+	.string	"gyro_notch_cutoff"
+.LASF1906:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1890:
+	.string	"__DECL_SIMD_tanf "
+.LASF2035:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2870:
+	.string	"maxthrottle"
+.LASF537:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF882:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF3052:
+	.string	"emergencyArmingIsTriggered"
+.LASF871:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2961:
+	.string	"rxIsReceivingSignal"
+.LASF934:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF2694:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF494:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF486:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2145:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2651:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF668:
+	.string	"__ldiv_t_defined 1"
+.LASF2850:
+	.string	"simPin"
+.LASF775:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2448:
+	.string	"pidProcessDenom"
+.LASF1454:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2677:
+	.string	"AUTO_TUNE"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2669:
+	.string	"HEADING_MODE"
+.LASF1446:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF452:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2459:
+	.string	"gyroSync"
+.LASF2158:
+	.string	"NAV_BLACKBOX "
+.LASF2025:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF2929:
+	.string	"pidController"
+.LASF1028:
+	.string	"USE_UART7 "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1525:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF435:
+	.string	"__USE_ISOC99 1"
+.LASF1213:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1300:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF883:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2424:
+	.string	"SENSOR_ACC"
+.LASF1908:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF633:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF658:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1852:
+	.string	"__DECL_SIMD_erff16 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2373:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1481:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2002:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1859:
+	.string	"__DECL_SIMD_tanh "
+.LASF1051:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1495:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2964:
+	.string	"processRcStickPositions"
+.LASF1352:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2015:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF1029:
+	.string	"USE_UART8 "
+.LASF2837:
+	.string	"frsky_pitch_roll"
+.LASF2721:
+	.string	"BEEPER_RX_SET"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1814:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2934:
+	.string	"updatePositionEstimator"
+.LASF1283:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1225:
+	.string	"LED1_OFF do {} while (0)"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1342:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF605:
+	.string	"_BSD_WCHAR_T_"
+.LASF2738:
+	.string	"FUNCTION_GPS"
+.LASF2043:
+	.string	"_STRING_H 1"
+.LASF1986:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1586:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1052:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1473:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2374:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1751:
+	.string	"__DECL_SIMD_coshl "
+.LASF2726:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF2037:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF2472:
+	.string	"dynamicGyroNotchEnabled"
+.LASF2588:
+	.string	"airmodeHandlingType"
+.LASF635:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF2844:
+	.string	"simTransmitFlags"
+.LASF2184:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF349:
+	.string	"__amd64 1"
+.LASF2680:
+	.string	"FLAPERON"
+.LASF2177:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1733:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF3041:
+	.string	"disarm"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF634:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1003:
+	.string	"_T_PTRDIFF_ "
+.LASF2794:
+	.string	"TASK_SERIAL"
+.LASF1321:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2615:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF455:
+	.string	"__USE_ATFILE 1"
+.LASF800:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF2865:
+	.string	"appliedMixerPreset"
+.LASF2655:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF2087:
+	.string	"BOXID_NONE 255"
+.LASF2336:
+	.string	"OWNER_PINIO"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF949:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1411:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1461:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1310:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1182:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1817:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1755:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1144:
+	.string	"FAST_MATH "
+.LASF1815:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF501:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1428:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3071:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF2820:
+	.string	"SMARTPORT_FUEL_UNIT_PERCENT"
+.LASF1384:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1641:
+	.string	"__DECL_SIMD_sinl "
+.LASF913:
+	.string	"USE_SERIALRX_SBUS "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF2664:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF2682:
+	.string	"flightModeFlags_e"
+.LASF2255:
+	.string	"__int8_t"
+.LASF786:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1789:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1048:
+	.string	"USE_PITOT_ADC"
+.LASF1919:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2309:
+	.string	"OWNER_SERIAL"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2621:
+	.string	"BOXKILLSWITCH"
+.LASF2826:
+	.string	"position_rate"
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF1661:
+	.string	"__DECL_SIMD_logl "
+.LASF528:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1635:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF667:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2843:
+	.string	"simTransmitInterval"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF2966:
+	.string	"failsafeUpdateState"
+.LASF2849:
+	.string	"simGroundStationNumber"
+.LASF2967:
+	.string	"failsafeStartMonitoring"
+.LASF943:
+	.string	"USE_OPFLOW "
+.LASF619:
+	.string	"__WCLONE 0x80000000"
+.LASF937:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2018:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF641:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1317:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1268:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1891:
+	.string	"__DECL_SIMD_tanl "
+.LASF1109:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF478:
+	.string	"__STRING(x) #x"
+.LASF2358:
+	.string	"RESOURCE_RX_CE"
+.LASF2006:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF989:
+	.string	"USE_RCDEVICE "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1512:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2181:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2827:
+	.string	"extra1_rate"
+.LASF2690:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1165:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF2519:
+	.string	"FEATURE_TRANSPONDER"
+.LASF2927:
+	.string	"isMixerUsingServos"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2710:
+	.string	"BEEPER_SILENCE"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2051:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF639:
+	.string	"_BITS_FLOATN_H "
+.LASF2294:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_ARMING_SAFETY"
+.LASF809:
+	.string	"__fsblkcnt_t_defined "
+.LASF2364:
+	.string	"portOptions_t"
+.LASF1622:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF1013:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF546:
+	.string	"__stub_chflags "
+.LASF958:
+	.string	"USE_FRSKYOSD "
+.LASF581:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2031:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2152:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2038:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF1175:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1563:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1245:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2624:
+	.string	"BOXTURNASSIST"
+.LASF2292:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_CHANNEL"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1942:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2182:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1710:
+	.string	"__DECL_SIMD_asinf "
+.LASF1892:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1652:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1513:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2503:
+	.string	"FEATURE_UNUSED_1"
+.LASF2506:
+	.string	"FEATURE_UNUSED_3"
+.LASF2507:
+	.string	"FEATURE_UNUSED_4"
+.LASF2511:
+	.string	"FEATURE_UNUSED_5"
+.LASF2512:
+	.string	"FEATURE_UNUSED_6"
+.LASF2428:
+	.string	"SENSOR_PITOT"
+.LASF2523:
+	.string	"FEATURE_UNUSED_8"
+.LASF2524:
+	.string	"FEATURE_UNUSED_9"
+.LASF812:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF796:
+	.string	"__NFDBITS"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1387:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2380:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF743:
+	.string	"__off_t_defined "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1249:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF446:
+	.string	"__USE_XOPEN2K 1"
+.LASF1450:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2311:
+	.string	"OWNER_TIMER"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF923:
+	.string	"USE_TELEMETRY "
+.LASF1239:
+	.string	"IOCFG_IPU 0"
+.LASF2446:
+	.string	"targetLooptime"
+.LASF2610:
+	.string	"BOXLEDLOW"
+.LASF2815:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1190:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1465:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1380:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2462:
+	.string	"gyro_soft_lpf_hz"
+.LASF2438:
+	.string	"CW270_DEG"
+.LASF2234:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF2875:
+	.string	"motorDecelTimeMs"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2846:
+	.string	"accEventThresholdLow"
+.LASF835:
+	.string	"alloca"
+.LASF1066:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1884:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1298:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2157:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF2067:
+	.string	"ESC_DATA_INVALID 255"
+.LASF760:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF545:
+	.string	"__stub___compat_bdflush "
+.LASF2186:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF2070:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1592:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1687:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1657:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1970:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1584:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF524:
+	.string	"__attribute_copy__"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1627:
+	.string	"_MATH_H 1"
+.LASF640:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2169:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1010:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1134:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2134:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF1869:
+	.string	"__DECL_SIMD_asinh "
+.LASF1418:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2616:
+	.string	"BOXFAILSAFE"
+.LASF1163:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF445:
+	.string	"__USE_POSIX199506 1"
+.LASF2788:
+	.string	"rssi_source"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2697:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF3018:
+	.string	"currentDeltaTime"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1934:
+	.string	"_Mdouble_ _Float32"
+.LASF2252:
+	.string	"short unsigned int"
+.LASF2708:
+	.string	"FW_HEADING_USE_YAW"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1154:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1328:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2958:
+	.string	"failsafeRequiresAngleMode"
+.LASF3007:
+	.string	"accIsCalibrationComplete"
+.LASF1166:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1583:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1728:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2793:
+	.string	"TASK_RX"
+.LASF1397:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1836:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2477:
+	.string	"kalman_sharpness"
+.LASF2612:
+	.string	"BOXNAVLAUNCH"
+.LASF1084:
+	.string	"__FAST_MATH__ 1"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1497:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF839:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1159:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF2386:
+	.string	"options"
+.LASF2151:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1012:
+	.string	"__need_ptrdiff_t"
+.LASF1058:
+	.string	"USE_RCDEVICE"
+.LASF2209:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF2257:
+	.string	"__int16_t"
+.LASF860:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF471:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF523:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1039:
+	.string	"USE_SERVO_SBUS"
+.LASF2105:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1952:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2797:
+	.string	"TASK_GPS"
+.LASF1528:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1532:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2423:
+	.string	"SENSOR_GYRO"
+.LASF1524:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2510:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2149:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF482:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2063:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1819:
+	.string	"__DECL_SIMD_log1p "
+.LASF2940:
+	.string	"isFixedWingLaunchFinishedOrAborted"
+.LASF710:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF630:
+	.string	"__W_CONTINUED 0xffff"
+.LASF2748:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1655:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF781:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF854:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2104:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF749:
+	.string	"__clock_t_defined 1"
+.LASF1677:
+	.string	"__DECL_SIMD_expf64x "
+.LASF2948:
+	.string	"getTaskDeltaTime"
+.LASF724:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF942:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2805:
+	.string	"TASK_VTXCTRL"
+.LASF1966:
+	.string	"FP_INFINITE 1"
+.LASF851:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1097:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2407:
+	.string	"setMode"
+.LASF1220:
+	.string	"LED_NUMBER 3"
+.LASF2307:
+	.string	"OWNER_SOFTSERIAL"
+.LASF2741:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF1878:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1445:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1937:
+	.string	"_Mdouble_ _Float64"
+.LASF1466:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1437:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1886:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF438:
+	.string	"_POSIX_SOURCE"
+.LASF2335:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF2268:
+	.string	"uint8_t"
+.LASF648:
+	.string	"__HAVE_FLOAT32 1"
+.LASF828:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF973:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1363:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1286:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1072:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2528:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1172:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF834:
+	.string	"_ALLOCA_H 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2415:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF842:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF720:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1457:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF3015:
+	.string	"bootLoader"
+.LASF631:
+	.string	"__WCOREFLAG 0x80"
+.LASF938:
+	.string	"USE_RANGEFINDER "
+.LASF2800:
+	.string	"TASK_PITOT"
+.LASF2802:
+	.string	"TASK_CMS"
+.LASF926:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1231:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1625:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF2030:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2206:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1089:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF849:
+	.string	"INT16_MAX (32767)"
+.LASF2048:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF2100:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF396:
+	.string	"false 0"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF939:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF2434:
+	.string	"ALIGN_DEFAULT"
+.LASF2508:
+	.string	"FEATURE_TELEMETRY"
+.LASF1861:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2273:
+	.string	"timeMs_t"
+.LASF1893:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1021:
+	.string	"USE_BARO "
+.LASF1354:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF618:
+	.string	"__WALL 0x40000000"
+.LASF1443:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"float"
+.LASF1508:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1439:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1483:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF2440:
+	.string	"CW90_DEG_FLIP"
+.LASF1877:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1086:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF1359:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2998:
+	.string	"failsafeUpdateRcCommandValues"
+.LASF1101:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2041:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF2297:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_ROLL"
+.LASF690:
+	.string	"__STD_TYPE typedef"
+.LASF2251:
+	.string	"unsigned char"
+.LASF2124:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2893:
+	.string	"PID_ITEM_COUNT"
+.LASF2227:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF2570:
+	.string	"THROTTLE_LOW"
+.LASF770:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1116:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1422:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1285:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1516:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1948:
+	.string	"__MATHDECL"
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF1214:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1824:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1804:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF748:
+	.string	"__key_t_defined "
+.LASF1838:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2393:
+	.string	"rxBufferTail"
+.LASF2974:
+	.string	"blackboxStart"
+.LASF531:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1340:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1043:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2549:
+	.string	"stabilized"
+.LASF2235:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1313:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2341:
+	.string	"RESOURCE_OUTPUT"
+.LASF927:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1376:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1308:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2638:
+	.string	"BOXLOITERDIRCHN"
+.LASF1910:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1559:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF577:
+	.string	"_SIZE_T_ "
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF567:
+	.string	"__need_size_t "
+.LASF2888:
+	.string	"PID_SURFACE"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1594:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"linux 1"
+.LASF2514:
+	.string	"FEATURE_LED_STRIP"
+.LASF2429:
+	.string	"SENSOR_OPFLOW"
+.LASF2991:
+	.string	"isNavLaunchEnabled"
+.LASF2587:
+	.string	"mid_throttle_deadband"
+.LASF2869:
+	.string	"motorConfig_s"
+.LASF2880:
+	.string	"motorConfig_t"
+.LASF1296:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1854:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1123:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2012:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF2887:
+	.string	"PID_VEL_XY"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2580:
+	.string	"THROTTLE_THRESHOLD"
+.LASF935:
+	.string	"USE_RX_UIB "
+.LASF897:
+	.string	"INT32_C(c) c"
+.LASF1355:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2330:
+	.string	"OWNER_SPI_PREINIT"
+.LASF603:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2749:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF441:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2050:
+	.string	"P0 101325.0f"
+.LASF2120:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF2845:
+	.string	"accEventThresholdHigh"
+.LASF509:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2217:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF838:
+	.string	"_STDINT_H 1"
+.LASF893:
+	.string	"WINT_MIN (0u)"
+.LASF2000:
+	.string	"DMA_NONE (0)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1917:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF2131:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2174:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2199:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2938:
+	.string	"imuUpdateAccelerometer"
+.LASF1767:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2329:
+	.string	"OWNER_VTX"
+.LASF1447:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF718:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1784:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2832:
+	.string	"telemetry_switch"
+.LASF1430:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2137:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF576:
+	.string	"__SIZE_T "
+.LASF970:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1103:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2401:
+	.string	"serialWrite"
+.LASF1438:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2464:
+	.string	"gyro_to_use"
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF2237:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1281:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF492:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF864:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF547:
+	.string	"__stub_fchflags "
+.LASF2017:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1392:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2864:
+	.string	"hasFlaps"
+.LASF2159:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF2283:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_ARMING_SAFETY"
+.LASF1054:
+	.string	"USE_ADC"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF544:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1548:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1969:
+	.string	"FP_NORMAL 4"
+.LASF711:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2973:
+	.string	"navigationPositionEstimateIsHealthy"
+.LASF1030:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2451:
+	.string	"sampleDeltaTimeUs"
+.LASF1191:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1707:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2657:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1831:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1079:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF2389:
+	.string	"txBufferSize"
+.LASF1472:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1727:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2231:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF764:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2193:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= 100)"
+.LASF1575:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2955:
+	.string	"disableFlightMode"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF827:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF1714:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1549:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1230:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2928:
+	.string	"mixTable"
+.LASF2173:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1927:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2526:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2522:
+	.string	"FEATURE_VTX"
+.LASF1496:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2198:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF513:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2818:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF578:
+	.string	"_BSD_SIZE_T_ "
+.LASF2323:
+	.string	"OWNER_INVERTER"
+.LASF2238:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF2049:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF3032:
+	.string	"tryArm"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1406:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF3001:
+	.string	"failsafeApplyControlInput"
+.LASF2785:
+	.string	"rx_max_usec"
+.LASF1096:
+	.string	"UNIT_TESTED "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1764:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF3058:
+	.string	"stickDeflection"
+.LASF1212:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF761:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF670:
+	.string	"RAND_MAX 2147483647"
+.LASF1941:
+	.string	"_Mdouble_ _Float32x"
+.LASF1271:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1280:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF981:
+	.string	"USE_SERIALRX_SUMD "
+.LASF708:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF960:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1018:
+	.string	"USE_FAKE_MAG "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF967:
+	.string	"USE_STATS "
+.LASF2971:
+	.string	"beeperConfirmationBeeps"
+.LASF614:
+	.string	"WEXITED 4"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2693:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1255:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1192:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1033:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1932:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2322:
+	.string	"OWNER_MPU"
+.LASF2261:
+	.string	"__uint32_t"
+.LASF1523:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1211:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1925:
+	.string	"__MATH_PRECNAME"
+.LASF1167:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1996:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1019:
+	.string	"USE_FAKE_GPS "
+.LASF1315:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1305:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2494:
+	.string	"ADC_RSSI"
+.LASF2598:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1757:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF978:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF995:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF2285:
+	.string	"GLOBAL_FUNCTION_ACTION_SWAP_ROLL_YAW"
+.LASF2812:
+	.string	"cfTaskId_e"
+.LASF2689:
+	.string	"ANTI_WINDUP"
+.LASF2204:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1749:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF874:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1260:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF2008:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1935:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1977:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2714:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF1648:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF519:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF599:
+	.string	"_WCHAR_T_H "
+.LASF1133:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2026:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1436:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1311:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2653:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1786:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2467:
+	.string	"gyro_stage2_lowpass_hz"
+.LASF733:
+	.string	"_BITS_TIME64_H 1"
+.LASF1939:
+	.string	"_Mdouble_ _Float128"
+.LASF575:
+	.string	"_T_SIZE "
+.LASF2700:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF806:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1953:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2303:
+	.string	"OWNER_PWMINPUT"
+.LASF808:
+	.string	"__blkcnt_t_defined "
+.LASF1702:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2371:
+	.string	"SERIAL_UNIDIR"
+.LASF884:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF647:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2111:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1689:
+	.string	"__DECL_SIMD_acos "
+.LASF2894:
+	.string	"roll"
+.LASF1844:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2485:
+	.string	"DISARM_SWITCH_3D"
+.LASF1146:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1958:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF636:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1717:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2377:
+	.string	"count"
+.LASF2557:
+	.string	"THROTTLE"
+.LASF2645:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF1070:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2128:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF2001:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF2977:
+	.string	"mspSerialReleasePortIfAllocated"
+.LASF2305:
+	.string	"OWNER_MOTOR"
+.LASF982:
+	.string	"USE_SERIALRX_SUMH "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2866:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF2619:
+	.string	"BOXHOMERESET"
+.LASF2083:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF676:
+	.string	"__S16_TYPE short int"
+.LASF971:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1964:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2581:
+	.string	"rcCommand"
+.LASF2952:
+	.string	"calculateRollPitchCenterStatus"
+.LASF1794:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2962:
+	.string	"updateActivatedModes"
+.LASF1458:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2101:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF870:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1683:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2695:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF582:
+	.string	"_SIZE_T_DECLARED "
+.LASF1149:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF3034:
+	.string	"sharedBlackboxAndMspPort"
+.LASF2444:
+	.string	"gyro_s"
+.LASF2453:
+	.string	"gyro_t"
+.LASF2284:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE_SCALE"
+.LASF1736:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2350:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1171:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2860:
+	.string	"PLATFORM_OTHER"
+.LASF1772:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2993:
+	.string	"failsafeIsReceivingRxData"
+.LASF1903:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF892:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2390:
+	.string	"rxBuffer"
+.LASF767:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1424:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2891:
+	.string	"PID_VEL_Z"
+.LASF2831:
+	.string	"gpsNoFixLongitude"
+.LASF1796:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1653:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1730:
+	.string	"__DECL_SIMD_exp2f "
+.LASF902:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2125:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2758:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF2753:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF2941:
+	.string	"isFixedWingLaunchDetected"
+.LASF1631:
+	.string	"__DECL_SIMD_cosl "
+.LASF2676:
+	.string	"FAILSAFE_MODE"
+.LASF2160:
+	.string	"RADAR_MAX_POIS 5"
+.LASF714:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1247:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1263:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2896:
+	.string	"values"
+.LASF2917:
+	.string	"rxUpdateCheck"
+.LASF3020:
+	.string	"taskMainPidLoop"
+.LASF907:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2572:
+	.string	"throttleStatus_e"
+.LASF956:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1582:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1297:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1898:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF2541:
+	.string	"dynPID"
+.LASF1222:
+	.string	"LED0_OFF do {} while (0)"
+.LASF1739:
+	.string	"__DECL_SIMD_exp10 "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF984:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF940:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1001:
+	.string	"_ANSI_STDDEF_H "
+.LASF2014:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF2985:
+	.string	"warningLedDisable"
+.LASF2352:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1658:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1110:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF591:
+	.string	"_WCHAR_T "
+.LASF1197:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF507:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2299:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_YAW"
+.LASF1974:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1184:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1785:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2988:
+	.string	"isHardwareHealthy"
+.LASF2454:
+	.string	"globalFunctionsFlags"
+.LASF2813:
+	.string	"averageSystemLoadPercent"
+.LASF1469:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF932:
+	.string	"USE_GYRO_KALMAN "
+.LASF2666:
+	.string	"armingFlags"
+.LASF1339:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2212:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF2723:
+	.string	"BEEPER_ACTION_FAIL"
+.LASF1560:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_POSIX_C_SOURCE"
+.LASF2442:
+	.string	"CW270_DEG_FLIP"
+.LASF2746:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2244:
+	.string	"GYRO_SYNC_MAX_CONSECUTIVE_FAILURES 100"
+.LASF1183:
+	.string	"HSV_HUE_MAX 359"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1127:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1724:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF659:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1976:
+	.string	"MATH_ERRNO 1"
+.LASF948:
+	.string	"USE_1WIRE_DS2482 "
+.LASF918:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF503:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF976:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF3067:
+	.string	"systemConfig"
+.LASF1863:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF3053:
+	.string	"threshold"
+.LASF2743:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1113:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1981:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF488:
+	.string	"__flexarr []"
+.LASF2153:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2520:
+	.string	"FEATURE_AIRMODE"
+.LASF579:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2211:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF1246:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2854:
+	.string	"PLATFORM_MULTIROTOR"
+.LASF2639:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF833:
+	.string	"__have_pthread_attr_t 1"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1637:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1760:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1828:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2488:
+	.string	"DISARM_FAILSAFE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2319:
+	.string	"OWNER_BEEPER"
+.LASF1672:
+	.string	"__DECL_SIMD_expf16 "
+.LASF964:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1985:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1651:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1547:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2034:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1125:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF699:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1611:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1382:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2778:
+	.string	"rssi_channel"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1087:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF2201:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2396:
+	.string	"rxCallback"
+.LASF2895:
+	.string	"pitch"
+.LASF785:
+	.string	"_SYS_SELECT_H 1"
+.LASF1761:
+	.string	"__DECL_SIMD_expm1l "
+.LASF596:
+	.string	"_BSD_WCHAR_T_ "
+.LASF888:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF791:
+	.string	"____sigset_t_defined "
+.LASF2829:
+	.string	"telemetryConfig_s"
+.LASF2852:
+	.string	"telemetryConfig_t"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1662:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1795:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2056:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF2009:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1293:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF735:
+	.string	"__STD_TYPE"
+.LASF2076:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF2277:
+	.string	"FD_ROLL"
+.LASF2480:
+	.string	"gyroConfig_System"
+.LASF2847:
+	.string	"accEventThresholdNegX"
+.LASF2703:
+	.string	"ROVER"
+.LASF1452:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1404:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1825:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2223:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1537:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1050:
+	.string	"USE_1WIRE_DS2482"
+.LASF394:
+	.string	"bool _Bool"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1703:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1574:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2692:
+	.string	"COMPASS_CALIBRATED"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1337:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1678:
+	.string	"__DECL_SIMD_expf128x "
+.LASF850:
+	.string	"INT32_MAX (2147483647)"
+.LASF2483:
+	.string	"DISARM_TIMEOUT"
+.LASF1487:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1027:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2859:
+	.string	"PLATFORM_BOAT"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1775:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1000:
+	.string	"_STDDEF_H_ "
+.LASF852:
+	.string	"UINT8_MAX (255)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1855:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1420:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF597:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2007:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1965:
+	.string	"FP_NAN 0"
+.LASF2933:
+	.string	"applyWaypointNavigationAndAltitudeHold"
+.LASF2969:
+	.string	"updateRSSI"
+.LASF1567:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF3068:
+	.string	"gyroConfig"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1610:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1962:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1234:
+	.string	"IOCFG_OUT_PP 0"
+.LASF3031:
+	.string	"rollPitchStatus"
+.LASF1947:
+	.string	"__MATHDECL_ALIAS"
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2914:
+	.string	"systemResetToBootloader"
+.LASF1479:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2080:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF2172:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2724:
+	.string	"BEEPER_READY_BEEP"
+.LASF1221:
+	.string	"LED0_TOGGLE do {} while (0)"
+.LASF1377:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF906:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF527:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2773:
+	.string	"rx_spi_protocol"
+.LASF2945:
+	.string	"getLooptime"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2216:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2024:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2663:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF1267:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2774:
+	.string	"rx_spi_id"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1605:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1307:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF876:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1326:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1440:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2258:
+	.string	"short int"
+.LASF1429:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1949:
+	.string	"__MATHCALL"
+.LASF763:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF3039:
+	.string	"delta"
+.LASF1427:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1071:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF792:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1800:
+	.string	"__DECL_SIMD_log10f "
+.LASF2825:
+	.string	"rc_channels_rate"
+.LASF917:
+	.string	"USE_ADC_AVERAGING "
+.LASF2702:
+	.string	"MULTIROTOR"
+.LASF2868:
+	.string	"mixerConfig_System"
+.LASF2509:
+	.string	"FEATURE_CURRENT_METER"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2767:
+	.string	"rxConfig_s"
+.LASF2789:
+	.string	"rxConfig_t"
+.LASF2077:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1200:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF571:
+	.string	"__SIZE_T__ "
+.LASF1744:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF570:
+	.string	"__size_t__ "
+.LASF2601:
+	.string	"BOXNAVALTHOLD"
+.LASF858:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2288:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_PITCH"
+.LASF1187:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2942:
+	.string	"opflowGyroUpdateCallback"
+.LASF1150:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1266:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF2960:
+	.string	"updateAdjustmentStates"
+.LASF1492:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF727:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1666:
+	.string	"__DECL_SIMD_logf32x "
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF611:
+	.string	"WNOHANG 1"
+.LASF1108:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1122:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2720:
+	.string	"BEEPER_GPS_STATUS"
+.LASF1505:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1790:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2320:
+	.string	"OWNER_OSD"
+.LASF2347:
+	.string	"RESOURCE_EXTI"
+.LASF1848:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1488:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2465:
+	.string	"gyro_notch_hz"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF922:
+	.string	"USE_NAV "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2457:
+	.string	"gyro_align"
+.LASF2108:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF484:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1896:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1074:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1140:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF584:
+	.string	"___int_size_t_h "
+.LASF1227:
+	.string	"LED2_TOGGLE do {} while (0)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF872:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2954:
+	.string	"pidResetErrorAccumulators"
+.LASF2384:
+	.string	"identifier"
+.LASF911:
+	.string	"USE_SERIAL_RX "
+.LASF2122:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1319:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1426:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2949:
+	.string	"mspSerialAllocatePorts"
+.LASF847:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1047:
+	.string	"USE_PITOT_MS4525"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF704:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2086:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF723:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF679:
+	.string	"__U32_TYPE unsigned int"
+.LASF632:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1556:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF2147:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF383:
+	.string	"SITL 1"
+.LASF2571:
+	.string	"THROTTLE_HIGH"
+.LASF439:
+	.string	"_POSIX_SOURCE 1"
+.LASF663:
+	.string	"__f64x(x) x ##f64x"
+.LASF777:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1174:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1181:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2387:
+	.string	"baudRate"
+.LASF790:
+	.string	"__sigset_t_defined 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF594:
+	.string	"__WCHAR_T "
+.LASF674:
+	.string	"_SYS_TYPES_H 1"
+.LASF2885:
+	.string	"PID_POS_Z"
+.LASF1846:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1743:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF779:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1135:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF2614:
+	.string	"BOXTELEMETRY"
+.LASF682:
+	.string	"__SQUAD_TYPE long int"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF671:
+	.string	"EXIT_FAILURE 1"
+.LASF2609:
+	.string	"BOXBEEPERON"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1189:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2527:
+	.string	"FEATURE_OSD"
+.LASF457:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF739:
+	.string	"__gid_t_defined "
+.LASF2249:
+	.string	"long int"
+.LASF2883:
+	.string	"PID_PITCH"
+.LASF2995:
+	.string	"sin_approx"
+.LASF1914:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF2737:
+	.string	"FUNCTION_MSP"
+.LASF1295:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2439:
+	.string	"CW0_DEG_FLIP"
+.LASF2084:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF2260:
+	.string	"__int32_t"
+.LASF832:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1491:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1309:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF969:
+	.string	"CMS_MENU_OSD "
+.LASF689:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2968:
+	.string	"failsafeIsMonitoring"
+.LASF2901:
+	.string	"start"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2606:
+	.string	"BOXNAVRTH"
+.LASF1837:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2618:
+	.string	"BOXAIRMODE"
+.LASF3023:
+	.string	"tiltCompFactor"
+.LASF2416:
+	.string	"SENSOR_INDEX_ACC"
+.LASF899:
+	.string	"UINT8_C(c) c"
+.LASF782:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF646:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF3022:
+	.string	"throttleTiltCompensationStrength"
+.LASF1994:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF945:
+	.string	"USE_OPFLOW_MSP "
+.LASF1462:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1912:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF2413:
+	.string	"writeBufChunks"
+.LASF2463:
+	.string	"gyro_soft_lpf_type"
+.LASF1975:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1963:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF2143:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF1198:
+	.string	"EXPAND_I(x) x"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2923:
+	.string	"calculateCosTiltAngle"
+.LASF1840:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2141:
+	.string	"PINIO_FLAGS_INVERTED 0x80"
+.LASF590:
+	.string	"__WCHAR_T__ "
+.LASF1882:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF2518:
+	.string	"FEATURE_UNUSED_10"
+.LASF2525:
+	.string	"FEATURE_UNUSED_11"
+.LASF1590:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2425:
+	.string	"SENSOR_BARO"
+.LASF2684:
+	.string	"GPS_FIX_HOME"
+.LASF795:
+	.string	"__suseconds_t_defined "
+.LASF1946:
+	.string	"__MATHDECL_1"
+.LASF2641:
+	.string	"boxId_e"
+.LASF2132:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF2367:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2368:
+	.string	"SERIAL_STOPBITS_2"
+.LASF626:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF2795:
+	.string	"TASK_BATTERY"
+.LASF2987:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1646:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF962:
+	.string	"USE_D_BOOST "
+.LASF3014:
+	.string	"taskUpdateRxMain"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF1351:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF1895:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF963:
+	.string	"USE_ANTIGRAVITY "
+.LASF2399:
+	.string	"rxIrqCount"
+.LASF1636:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1284:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF395:
+	.string	"true 1"
+.LASF2185:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF2365:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1897:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1391:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2925:
+	.string	"processServoAutotrim"
+.LASF698:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF2678:
+	.string	"NAV_WP_MODE"
+.LASF3008:
+	.string	"navIsCalibrationComplete"
+.LASF1791:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1282:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1358:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF649:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1998:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF1973:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1218:
+	.string	"GLOBAL_FUNCTION_FLAG_ENABLE(mask) (globalFunctionsFlags |= (mask))"
+.LASF1968:
+	.string	"FP_SUBNORMAL 3"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1393:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF505:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF778:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1972:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF665:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2354:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2355:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2356:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2357:
+	.string	"RESOURCE_ADC_CH4"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1628:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF684:
+	.string	"__SWORD_TYPE long int"
+.LASF1671:
+	.string	"__DECL_SIMD_expl "
+.LASF2828:
+	.string	"extra2_rate"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2225:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF2021:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2417:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1059:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2265:
+	.string	"int16_t"
+.LASF1606:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1520:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2395:
+	.string	"txBufferTail"
+.LASF2207:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF514:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2730:
+	.string	"BEEPER_LAUNCH_MODE_ENABLED"
+.LASF1698:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2229:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1451:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2220:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF903:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2126:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1644:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF422:
+	.string	"__USE_GNU"
+.LASF859:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2190:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF1016:
+	.string	"USE_IMU_FAKE "
+.LASF1188:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF803:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF463:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF894:
+	.string	"WINT_MAX (4294967295u)"
+.LASF625:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF454:
+	.string	"__USE_MISC 1"
+.LASF688:
+	.string	"__S64_TYPE long int"
+.LASF1210:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2400:
+	.string	"serialPortVTable"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2997:
+	.string	"degreesToRadians"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1368:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2500:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1478:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2005:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2094:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2757:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF450:
+	.string	"__WORDSIZE 64"
+.LASF1634:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF2784:
+	.string	"rx_min_usec"
+.LASF2759:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1936:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2072:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF2910:
+	.string	"gyroSyncFailureCount"
+.LASF2054:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1203:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2162:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1701:
+	.string	"__DECL_SIMD_atanl "
+.LASF2935:
+	.string	"updateWaypointsAndNavigationMode"
+.LASF1781:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2170:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2069:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1940:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2862:
+	.string	"motorDirectionInverted"
+.LASF1273:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1378:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF2976:
+	.string	"findNextSharedSerialPort"
+.LASF1038:
+	.string	"USE_USB_MSC"
+.LASF801:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF569:
+	.string	"__need_NULL "
+.LASF762:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF661:
+	.string	"__f64(x) x ##f64"
+.LASF3056:
+	.string	"rawData"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1665:
+	.string	"__DECL_SIMD_logf128 "
+.LASF485:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF717:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1064:
+	.string	"U_ID_1 1"
+.LASF3013:
+	.string	"fcReboot"
+.LASF1645:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1044:
+	.string	"USE_RANGEFINDER"
+.LASF3064:
+	.string	"rxConfig"
+.LASF1031:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF583:
+	.string	"__DEFINED_size_t "
+.LASF2924:
+	.string	"isServoOutputEnabled"
+.LASF2577:
+	.string	"CENTERED"
+.LASF1389:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2731:
+	.string	"BEEPER_CAM_CONNECTION_OPEN"
+.LASF2647:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2167:
+	.string	"MIDRC_MIN 1200"
+.LASF1841:
+	.string	"__DECL_SIMD_acoshl "
+.LASF2460:
+	.string	"looptime"
+.LASF2004:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1663:
+	.string	"__DECL_SIMD_logf32 "
+.LASF993:
+	.string	"USE_VTX_FFPV "
+.LASF2551:
+	.string	"misc"
+.LASF912:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1801:
+	.string	"__DECL_SIMD_log10l "
+.LASF2232:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF954:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2062:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF2665:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF651:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2517:
+	.string	"FEATURE_BLACKBOX"
+.LASF952:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2366:
+	.string	"SERIAL_INVERTED"
+.LASF2040:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF474:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2769:
+	.string	"rcmap"
+.LASF1480:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3066:
+	.string	"rcControlsConfig"
+.LASF491:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2899:
+	.string	"emergencyArmingState_s"
+.LASF2904:
+	.string	"emergencyArmingState_t"
+.LASF2658:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF3055:
+	.string	"getAxisRcCommand"
+.LASF2796:
+	.string	"TASK_TEMPERATURE"
+.LASF1151:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF2340:
+	.string	"RESOURCE_INPUT"
+.LASF2150:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF823:
+	.string	"__LOCK_ALIGNMENT "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2937:
+	.string	"imuUpdateAttitude"
+.LASF855:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1779:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2300:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE"
+.LASF2430:
+	.string	"SENSOR_GPS"
+.LASF1967:
+	.string	"FP_ZERO 2"
+.LASF2595:
+	.string	"switchDisarmDelayMs"
+.LASF1876:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1341:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2777:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF1107:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF498:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF677:
+	.string	"__U16_TYPE unsigned short int"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2089:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF3063:
+	.string	"telemetryConfig"
+.LASF1455:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF518:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1603:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF961:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF686:
+	.string	"__SLONG32_TYPE int"
+.LASF2228:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2326:
+	.string	"OWNER_RX"
+.LASF2674:
+	.string	"NAV_LAUNCH_MODE"
+.LASF444:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1732:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1049:
+	.string	"USE_1WIRE"
+.LASF750:
+	.string	"__clockid_t_defined 1"
+.LASF1334:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1812:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF2203:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2482:
+	.string	"DISARM_NONE"
+.LASF2542:
+	.string	"pa_breakpoint"
+.LASF1229:
+	.string	"LED2_ON do {} while (0)"
+.LASF2555:
+	.string	"ROLL"
+.LASF2539:
+	.string	"rcMid8"
+.LASF1900:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2064:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF2289:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_YAW"
+.LASF869:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2770:
+	.string	"serialrx_provider"
+.LASF2059:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF2431:
+	.string	"SENSOR_GPSMAG"
+.LASF1506:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2409:
+	.string	"isConnected"
+.LASF1269:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2254:
+	.string	"signed char"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2877:
+	.string	"throttleIdle"
+.LASF752:
+	.string	"__timer_t_defined 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF623:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF2839:
+	.string	"hottAlarmSoundInterval"
+.LASF921:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1951:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1120:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF504:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1100:
+	.string	"EXTENDED_FASTRAM "
+.LASF2327:
+	.string	"OWNER_TX"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF810:
+	.string	"__fsfilcnt_t_defined "
+.LASF1256:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF2841:
+	.string	"ibusTelemetryType"
+.LASF510:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF3038:
+	.string	"armingSwitchIsOn"
+.LASF1944:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2543:
+	.string	"fixedWingTauMs"
+.LASF1435:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1145:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF470:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2432:
+	.string	"SENSOR_TEMP"
+.LASF2155:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2116:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF1885:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF896:
+	.string	"INT16_C(c) c"
+.LASF1706:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2696:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1138:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF1557:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1589:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2716:
+	.string	"BEEPER_ARMING"
+.LASF673:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1624:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2045:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2816:
+	.string	"frskyGpsCoordFormat_e"
+.LASF950:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1158:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2458:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF3060:
+	.string	"emergencyArmingIsEnabled"
+.LASF2379:
+	.string	"serialReceiveCallbackPtr"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF857:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2262:
+	.string	"__uint64_t"
+.LASF1618:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1275:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1938:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF3004:
+	.string	"applyDeadband"
+.LASF1581:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2361:
+	.string	"MODE_TX"
+.LASF3012:
+	.string	"getFlightTime"
+.LASF2264:
+	.string	"int8_t"
+.LASF1414:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF539:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1866:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1502:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1093:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1770:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1494:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF538:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1608:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2594:
+	.string	"disarm_kill_switch"
+.LASF2419:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF1923:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1179:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2219:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF529:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF2713:
+	.string	"BEEPER_RX_LOST"
+.LASF1959:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1400:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2978:
+	.string	"findSharedSerialPort"
+.LASF1529:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF1787:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1410:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1924:
+	.string	"_Mdouble_"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2573:
+	.string	"THROTTLE_STATUS_TYPE_RC"
+.LASF1916:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1762:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2088:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2269:
+	.string	"uint16_t"
+.LASF2242:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1330:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF863:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF731:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2029:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF2792:
+	.string	"TASK_GYROPID"
+.LASF1106:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF536:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF487:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1042:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1521:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1711:
+	.string	"__DECL_SIMD_asinl "
+.LASF2028:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF535:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1205:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2920:
+	.string	"blackboxUpdate"
+.LASF521:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2267:
+	.string	"long long unsigned int"
+.LASF2437:
+	.string	"CW180_DEG"
+.LASF1442:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"USE_TELEMETRY_LTM "
+.LASF2136:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF1434:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1156:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1470:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2943:
+	.string	"gyroUpdate"
+.LASF1020:
+	.string	"USE_MAG "
+.LASF1132:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF543:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF957:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1720:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1060:
+	.string	"USE_ITCM_RAM"
+.LASF2513:
+	.string	"FEATURE_RSSI_ADC"
+.LASF530:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2648:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF2496:
+	.string	"ADC_AIRSPEED"
+.LASF1006:
+	.string	"_PTRDIFF_T_ "
+.LASF1320:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF988:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2863:
+	.string	"platformType"
+.LASF1857:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2013:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF2168:
+	.string	"MIDRC_MAX 1700"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2112:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2685:
+	.string	"GPS_FIX"
+.LASF1141:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF994:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2908:
+	.string	"flightTime"
+.LASF920:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF683:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1792:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2314:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1835:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1160:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF910:
+	.string	"USE_RX_PPM "
+.LASF1797:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1829:
+	.string	"__DECL_SIMD_atanh "
+.LASF499:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF472:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1669:
+	.string	"__DECL_SIMD_exp "
+.LASF1956:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1957:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF549:
+	.string	"__stub_revoke "
+.LASF2873:
+	.string	"motorPwmProtocol"
+.LASF1988:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2165:
+	.string	"PWM_PULSE_MIN 750"
+.LASF2435:
+	.string	"CW0_DEG"
+.LASF532:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1853:
+	.string	"__DECL_SIMD_erff32 "
+.LASF898:
+	.string	"INT64_C(c) c ## L"
+.LASF974:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF745:
+	.string	"__id_t_defined "
+.LASF2081:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF3050:
+	.string	"emergencyArmingCanOverrideArmingDisabled"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2878:
+	.string	"throttleScale"
+.LASF1858:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1650:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2691:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF2810:
+	.string	"TASK_NONE"
+.LASF2907:
+	.string	"motorControlEnable"
+.LASF1290:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1865:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1396:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF502:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2095:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2148:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF1842:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF925:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1041:
+	.string	"USE_OLED_UG2864"
+.LASF1401:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2443:
+	.string	"sensor_align_e"
+.LASF3035:
+	.string	"releaseSharedTelemetryPorts"
+.LASF2916:
+	.string	"stopMotors"
+.LASF2545:
+	.string	"rates"
+.LASF572:
+	.string	"_SIZE_T "
+.LASF738:
+	.string	"__dev_t_defined "
+.LASF1777:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1902:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1034:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF3051:
+	.string	"armingPrevention"
+.LASF1126:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF2296:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_SWAP_ROLL_YAW"
+.LASF1913:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1379:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3000:
+	.string	"rxGetChannelValue"
+.LASF2360:
+	.string	"MODE_RX"
+.LASF3061:
+	.string	"motorConfig"
+.LASF1612:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"USE_PITOT_MS4525 "
+.LASF1291:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF805:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF2099:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 12"
+.LASF645:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF620:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1332:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF914:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1879:
+	.string	"__DECL_SIMD_erfc "
+.LASF904:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1147:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1771:
+	.string	"__DECL_SIMD_sinhl "
+.LASF751:
+	.string	"__time_t_defined 1"
+.LASF520:
+	.string	"__restrict_arr __restrict"
+.LASF2098:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF2798:
+	.string	"TASK_COMPASS"
+.LASF1415:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2032:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1129:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2659:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF901:
+	.string	"UINT32_C(c) c ## U"
+.LASF2205:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1078:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2245:
+	.string	"EMERGENCY_ARMING_TIME_WINDOW_MS 10000"
+.LASF3033:
+	.string	"usedBypass"
+.LASF2890:
+	.string	"PID_HEADING"
+.LASF2881:
+	.string	"motorConfig_System"
+.LASF2103:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF600:
+	.string	"___int_wchar_t_h "
+.LASF469:
+	.string	"__LEAF , __leaf__"
+.LASF702:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3036:
+	.string	"sharedPort"
+.LASF1579:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1553:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF2349:
+	.string	"RESOURCE_I2C_SDA"
+.LASF774:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF568:
+	.string	"__need_wchar_t "
+.LASF2504:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF2263:
+	.string	"char"
+.LASF2308:
+	.string	"OWNER_ADC"
+.LASF754:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1834:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1067:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1918:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2213:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF1623:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1196:
+	.string	"STR_HELPER(x) #x"
+.LASF1609:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1931:
+	.string	"_Mdouble_ long double"
+.LASF2766:
+	.string	"navArmingBlocker_e"
+.LASF2986:
+	.string	"warningLedFlash"
+.LASF1471:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF2583:
+	.string	"deadband"
+.LASF1694:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1721:
+	.string	"__DECL_SIMD_hypotl "
+.LASF3037:
+	.string	"emergencyArmingUpdate"
+.LASF2486:
+	.string	"DISARM_SWITCH"
+.LASF2603:
+	.string	"BOXHEADFREE"
+.LASF1888:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF712:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2981:
+	.string	"statsOnDisarm"
+.LASF811:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1850:
+	.string	"__DECL_SIMD_erff "
+.LASF853:
+	.string	"UINT16_MAX (65535)"
+.LASF1061:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF2461:
+	.string	"gyro_lpf"
+.LASF1933:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF613:
+	.string	"WSTOPPED 2"
+.LASF525:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1604:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1860:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1366:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1880:
+	.string	"__DECL_SIMD_erfcf "
+.LASF2553:
+	.string	"currentControlRateProfile"
+.LASF466:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF848:
+	.string	"INT8_MAX (127)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2950:
+	.string	"telemetryCheckState"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2298:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_PITCH"
+.LASF2351:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2814:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF2404:
+	.string	"serialRead"
+.LASF1119:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2331:
+	.string	"OWNER_COMPASS"
+.LASF2410:
+	.string	"isIdle"
+.LASF585:
+	.string	"_GCC_SIZE_T "
+.LASF1114:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1104:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF895:
+	.string	"INT8_C(c) c"
+.LASF606:
+	.string	"__need_wchar_t"
+.LASF2903:
+	.string	"queueCount"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF2546:
+	.string	"fpvCamAngleDegrees"
+.LASF2711:
+	.string	"BEEPER_RUNTIME_CALIBRATION_DONE"
+.LASF1080:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF2754:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2052:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF2591:
+	.string	"rcControlsConfig_System"
+.LASF2556:
+	.string	"PITCH"
+.LASF1077:
+	.string	"NOINLINE "
+.LASF678:
+	.string	"__S32_TYPE int"
+.LASF1464:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2996:
+	.string	"cos_approx"
+.LASF1117:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1217:
+	.string	"GLOBAL_FUNCTION_FLAG_DISABLE(mask) (globalFunctionsFlags &= ~(mask))"
+.LASF2293:
+	.string	"GLOBAL_FUNCTION_ACTION_LAST"
+.LASF573:
+	.string	"_SYS_SIZE_T_H "
+.LASF2856:
+	.string	"PLATFORM_HELICOPTER"
+.LASF2501:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2732:
+	.string	"BEEPER_CAM_CONNECTION_CLOSE"
+.LASF1004:
+	.string	"_T_PTRDIFF "
+.LASF1405:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1894:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF756:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1277:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2808:
+	.string	"TASK_BLACKBOX"
+.LASF1688:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2529:
+	.string	"systemConfig_s"
+.LASF2537:
+	.string	"systemConfig_t"
+.LASF1793:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF2652:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1362:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1682:
+	.string	"__DECL_SIMD_powf16 "
+.LASF992:
+	.string	"USE_VTX_TRAMP "
+.LASF2302:
+	.string	"OWNER_PWMIO"
+.LASF2965:
+	.string	"beeperSilence"
+.LASF1615:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1534:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2381:
+	.string	"serialBufChunk_s"
+.LASF2378:
+	.string	"serialBufChunk_t"
+.LASF1232:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1304:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF465:
+	.string	"__PMT"
+.LASF2654:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1808:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1073:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2932:
+	.string	"navigationRequiresThrottleTiltCompensation"
+.LASF1493:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2633:
+	.string	"BOXNAVCRUISE"
+.LASF1193:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF2686:
+	.string	"CALIBRATE_MAG"
+.LASF1485:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2376:
+	.string	"data"
+.LASF2589:
+	.string	"airmodeThrottleThreshold"
+.LASF2760:
+	.string	"serialPortFunction_e"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF477:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2325:
+	.string	"OWNER_LED"
+.LASF2291:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_BAND"
+.LASF586:
+	.string	"_SIZET_ "
+.LASF1763:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1017:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF662:
+	.string	"__f32x(x) x ##f32x"
+.LASF2027:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF1136:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1361:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2345:
+	.string	"RESOURCE_UART_RX"
+.LASF2884:
+	.string	"PID_YAW"
+.LASF2946:
+	.string	"gyroSyncCheckUpdate"
+.LASF574:
+	.string	"_T_SIZE_ "
+.LASF2127:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF1674:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1517:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2194:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)"
+.LASF3003:
+	.string	"rcLookup"
+.LASF2544:
+	.string	"rcYawExpo8"
+.LASF1630:
+	.string	"__DECL_SIMD_cosf "
+.LASF542:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2650:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF1098:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1971:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1874:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2385:
+	.string	"mode"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1226:
+	.string	"LED1_ON do {} while (0)"
+.LASF540:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1810:
+	.string	"__DECL_SIMD_log2f "
+.LASF2133:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF2447:
+	.string	"sampleLooptime"
+.LASF1306:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2533:
+	.string	"i2c_speed"
+.LASF1331:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1032:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF841:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2936:
+	.string	"rcInterpolationApply"
+.LASF996:
+	.string	"USE_CLI_BATCH "
+.LASF2728:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF2819:
+	.string	"frskyUnit_e"
+.LASF1102:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2876:
+	.string	"digitalIdleOffsetValue"
+.LASF666:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF802:
+	.string	"NFDBITS __NFDBITS"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2532:
+	.string	"debug_mode"
+.LASF2999:
+	.string	"rcLookupThrottle"
+.LASF447:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2046:
+	.string	"_STRINGS_H 1"
+.LASF1433:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2718:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF2781:
+	.string	"sbusSyncInterval"
+.LASF1425:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1568:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2079:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF1195:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1152:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1806:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2426:
+	.string	"SENSOR_MAG"
+.LASF1545:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2344:
+	.string	"RESOURCE_UART_TX"
+.LASF1186:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF2913:
+	.string	"systemReset"
+.LASF1851:
+	.string	"__DECL_SIMD_erfl "
+.LASF1348:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1799:
+	.string	"__DECL_SIMD_log10 "
+.LASF1983:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1822:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2582:
+	.string	"rcControlsConfig_s"
+.LASF2590:
+	.string	"rcControlsConfig_t"
+.LASF508:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1734:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2033:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1715:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF695:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF456:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1008:
+	.string	"___int_ptrdiff_t_h "
+.LASF476:
+	.string	"__PMT(args) args"
+.LASF2635:
+	.string	"BOXUSER1"
+.LASF2636:
+	.string	"BOXUSER2"
+.LASF2493:
+	.string	"ADC_BATTERY"
+.LASF1742:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF880:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1365:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1178:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1489:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2535:
+	.string	"throttle_tilt_compensation_strength"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF730:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1999:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF2135:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF1826:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1409:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1907:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2055:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1173:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2558:
+	.string	"AUX1"
+.LASF2559:
+	.string	"AUX2"
+.LASF2560:
+	.string	"AUX3"
+.LASF2561:
+	.string	"AUX4"
+.LASF2562:
+	.string	"AUX5"
+.LASF2563:
+	.string	"AUX6"
+.LASF2564:
+	.string	"AUX7"
+.LASF2565:
+	.string	"AUX8"
+.LASF2566:
+	.string	"AUX9"
+.LASF2579:
+	.string	"STICK_CENTER"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF719:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1783:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2623:
+	.string	"BOXFLAPERON"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1057:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF931:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2093:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1199:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF867:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2497:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1390:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF604:
+	.string	"__DEFINED_wchar_t "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1137:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF506:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2811:
+	.string	"TASK_SELF"
+.LASF1346:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1460:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF706:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF909:
+	.string	"USE_I2C_PULLUP "
+.LASF1302:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1640:
+	.string	"__DECL_SIMD_sinf "
+.LASF1292:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2807:
+	.string	"TASK_GLOBAL_FUNCTIONS"
+.LASF825:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2922:
+	.string	"writeServos"
+.LASF2328:
+	.string	"OWNER_RX_SPI"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF824:
+	.string	"__ONCE_ALIGNMENT "
+.LASF592:
+	.string	"_T_WCHAR_ "
+.LASF2318:
+	.string	"OWNER_USB"
+.LASF2321:
+	.string	"OWNER_BARO"
+.LASF1011:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1155:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1754:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF587:
+	.string	"__size_t "
+.LASF721:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1344:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1647:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF468:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2317:
+	.string	"OWNER_FLASH"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2836:
+	.string	"frsky_vfas_precision"
+.LASF3057:
+	.string	"rate"
+.LASF768:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2803:
+	.string	"TASK_OPFLOW"
+.LASF1180:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF3011:
+	.string	"sensors"
+.LASF1993:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF2707:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1095:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2502:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1408:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF740:
+	.string	"__mode_t_defined "
+.LASF621:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF2176:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF1364:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1143:
+	.string	"sq(x) ((x)*(x))"
+.LASF3005:
+	.string	"constrain"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2422:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF1769:
+	.string	"__DECL_SIMD_sinh "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1811:
+	.string	"__DECL_SIMD_log2l "
+.LASF1318:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2266:
+	.string	"int32_t"
+.LASF1386:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2097:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2119:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF3044:
+	.string	"throttleValue"
+.LASF1444:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF879:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2592:
+	.string	"armingConfig_s"
+.LASF2596:
+	.string	"armingConfig_t"
+.LASF1161:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1696:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1459:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2775:
+	.string	"rx_spi_rf_channel_count"
+.LASF2091:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF843:
+	.string	"__intptr_t_defined "
+.LASF1168:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2082:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF928:
+	.string	"USE_PITOT "
+.LASF1807:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2806:
+	.string	"TASK_LOGIC_CONDITIONS"
+.LASF1228:
+	.string	"LED2_OFF do {} while (0)"
+.LASF1845:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1539:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2481:
+	.string	"disarmReason_e"
+.LASF2474:
+	.string	"dynamicGyroNotchCount"
+.LASF3043:
+	.string	"annexCode"
+.LASF2491:
+	.string	"disarmReason_t"
+.LASF2066:
+	.string	"ESC_DATA_MAX_AGE 10"
+.LASF1015:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF798:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF675:
+	.string	"_BITS_TYPES_H 1"
+.LASF729:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2073:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1045:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2042:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF1091:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2744:
+	.string	"FUNCTION_BLACKBOX"
+.LASF2953:
+	.string	"failsafeIsActive"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1115:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2947:
+	.string	"micros"
+.LASF2253:
+	.string	"unsigned int"
+.LASF3009:
+	.string	"pitotIsCalibrationComplete"
+.LASF1554:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"UINT16_C(c) c"
+.LASF2661:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF1314:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1920:
+	.string	"_Mdouble_ double"
+.LASF1544:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF1536:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2547:
+	.string	"controlRateConfig_s"
+.LASF2552:
+	.string	"controlRateConfig_t"
+.LASF1204:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF837:
+	.string	"__COMPAR_FN_T "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3232:
+	.string	"rx_pwm.h"
+.LASF3236:
+	.string	"asyncfatfs.h"
+.LASF3180:
+	.string	"thread-shared-types.h"
+.LASF3206:
+	.string	"pwm_output.h"
+.LASF3211:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3098:
+	.string	"/usr/include"
+.LASF3215:
+	.string	"mathcalls-helper-functions.h"
+.LASF3171:
+	.string	"endianness.h"
+.LASF3174:
+	.string	"select.h"
+.LASF3163:
+	.string	"floatn-common.h"
+.LASF3188:
+	.string	"stdint.h"
+.LASF0:
+	.string	"./src/main/fc/fc_core.c"
+.LASF3073:
+	.string	"src/main/build"
+.LASF3095:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3146:
+	.string	"barometer.h"
+.LASF3148:
+	.string	"stdbool.h"
+.LASF3103:
+	.string	"time.h"
+.LASF3153:
+	.string	"wordsize.h"
+.LASF3105:
+	.string	"color.h"
+.LASF3242:
+	.string	"quaternion.h"
+.LASF3219:
+	.string	"bus.h"
+.LASF3128:
+	.string	"fc_core.c"
+.LASF3090:
+	.string	"src/main/target/SITL"
+.LASF3216:
+	.string	"mathcalls.h"
+.LASF3183:
+	.string	"struct_mutex.h"
+.LASF3112:
+	.string	"fc_core.h"
+.LASF3147:
+	.string	"stdc-predef.h"
+.LASF3194:
+	.string	"common_post.h"
+.LASF3237:
+	.string	"fat_standard.h"
+.LASF3207:
+	.string	"boardalignment.h"
+.LASF3202:
+	.string	"io.h"
+.LASF3150:
+	.string	"libc-header-start.h"
+.LASF3169:
+	.string	"timer_t.h"
+.LASF3137:
+	.string	"failsafe.h"
+.LASF3123:
+	.string	"scheduler.h"
+.LASF3114:
+	.string	"adc.h"
+.LASF3099:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3077:
+	.string	"src/main/drivers/barometer"
+.LASF3195:
+	.string	"blackbox_fielddefs.h"
+.LASF3131:
+	.string	"blackbox.h"
+.LASF3107:
+	.string	"resource.h"
+.LASF3182:
+	.string	"atomic_wide_counter.h"
+.LASF3132:
+	.string	"servos.h"
+.LASF3082:
+	.string	"src/main/flight"
+.LASF3230:
+	.string	"rangefinder.h"
+.LASF3127:
+	.string	"imu.h"
+.LASF3083:
+	.string	"src/main/io/asyncfatfs"
+.LASF3198:
+	.string	"debug.h"
+.LASF3113:
+	.string	"cli.h"
+.LASF3217:
+	.string	"accgyro.h"
+.LASF3208:
+	.string	"vector.h"
+.LASF3138:
+	.string	"rc_adjustments.h"
+.LASF3209:
+	.string	"math.h"
+.LASF3094:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3200:
+	.string	"filter.h"
+.LASF3204:
+	.string	"io_def.h"
+.LASF3085:
+	.string	"src/main/msp"
+.LASF3142:
+	.string	"statusindicator.h"
+.LASF3151:
+	.string	"features.h"
+.LASF3093:
+	.string	"src/main"
+.LASF3164:
+	.string	"typesizes.h"
+.LASF3084:
+	.string	"src/main/io"
+.LASF3165:
+	.string	"time64.h"
+.LASF3176:
+	.string	"__sigset_t.h"
+.LASF3152:
+	.string	"features-time64.h"
+.LASF3213:
+	.string	"fp-logb.h"
+.LASF3141:
+	.string	"feature.h"
+.LASF3121:
+	.string	"navigation.h"
+.LASF3120:
+	.string	"beeper.h"
+.LASF3184:
+	.string	"struct_rwlock.h"
+.LASF3119:
+	.string	"runtime_config.h"
+.LASF3115:
+	.string	"config.h"
+.LASF3157:
+	.string	"stubs.h"
+.LASF3111:
+	.string	"gyro.h"
+.LASF3214:
+	.string	"fp-fast.h"
+.LASF3238:
+	.string	"piniobox.h"
+.LASF3190:
+	.string	"platform.h"
+.LASF3241:
+	.string	"streambuf.h"
+.LASF3160:
+	.string	"waitflags.h"
+.LASF3076:
+	.string	"src/main/drivers/accgyro"
+.LASF3179:
+	.string	"pthreadtypes.h"
+.LASF3124:
+	.string	"telemetry.h"
+.LASF3143:
+	.string	"diagnostics.h"
+.LASF3192:
+	.string	"target.h"
+.LASF3130:
+	.string	"maths.h"
+.LASF3225:
+	.string	"string.h"
+.LASF3161:
+	.string	"waitstatus.h"
+.LASF3136:
+	.string	"msp_serial.h"
+.LASF3189:
+	.string	"wchar.h"
+.LASF3154:
+	.string	"timesize.h"
+.LASF3074:
+	.string	"src/main/common"
+.LASF3231:
+	.string	"esc_sensor.h"
+.LASF3122:
+	.string	"rx.h"
+.LASF3097:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3172:
+	.string	"byteswap.h"
+.LASF3221:
+	.string	"rcc_types.h"
+.LASF3079:
+	.string	"src/main/drivers/rangefinder"
+.LASF3139:
+	.string	"stats.h"
+.LASF3235:
+	.string	"gps.h"
+.LASF3140:
+	.string	"logic_condition.h"
+.LASF3134:
+	.string	"acceleration.h"
+.LASF3159:
+	.string	"stddef.h"
+.LASF3145:
+	.string	"pitotmeter.h"
+.LASF3081:
+	.string	"src/main/fc"
+.LASF3162:
+	.string	"floatn.h"
+.LASF3220:
+	.string	"bus_i2c.h"
+.LASF3227:
+	.string	"__locale_t.h"
+.LASF3191:
+	.string	"common.h"
+.LASF3224:
+	.string	"calibration.h"
+.LASF3158:
+	.string	"stubs-64.h"
+.LASF3196:
+	.string	"parameter_group.h"
+.LASF3116:
+	.string	"controlrate_profile.h"
+.LASF3126:
+	.string	"pid.h"
+.LASF3205:
+	.string	"io_def_generated.h"
+.LASF3199:
+	.string	"utils.h"
+.LASF3173:
+	.string	"uintn-identity.h"
+.LASF3078:
+	.string	"src/main/drivers/opflow"
+.LASF3125:
+	.string	"mixer.h"
+.LASF3218:
+	.string	"exti.h"
+.LASF3109:
+	.string	"sensors.h"
+.LASF3167:
+	.string	"clockid_t.h"
+.LASF3135:
+	.string	"opflow.h"
+.LASF3210:
+	.string	"math-vector.h"
+.LASF3118:
+	.string	"rc_modes.h"
+.LASF3102:
+	.string	"stdint-uintn.h"
+.LASF3170:
+	.string	"endian.h"
+.LASF3166:
+	.string	"clock_t.h"
+.LASF3086:
+	.string	"src/main/navigation"
+.LASF3156:
+	.string	"long-double.h"
+.LASF3117:
+	.string	"rc_controls.h"
+.LASF3229:
+	.string	"battery.h"
+.LASF3155:
+	.string	"cdefs.h"
+.LASF3212:
+	.string	"flt-eval-method.h"
+.LASF3087:
+	.string	"src/main/rx"
+.LASF3133:
+	.string	"rc_smoothing.h"
+.LASF3072:
+	.string	"src/main/blackbox"
+.LASF3240:
+	.string	"msp.h"
+.LASF3226:
+	.string	"locale_t.h"
+.LASF3110:
+	.string	"sensor.h"
+.LASF3193:
+	.string	"sanity_check.h"
+.LASF3223:
+	.string	"dma.h"
+.LASF3091:
+	.string	"src/main/target"
+.LASF3233:
+	.string	"bitarray.h"
+.LASF3104:
+	.string	"axis.h"
+.LASF3228:
+	.string	"strings.h"
+.LASF3129:
+	.string	"system.h"
+.LASF3080:
+	.string	"src/main/drivers"
+.LASF3175:
+	.string	"sigset_t.h"
+.LASF3108:
+	.string	"serial.h"
+.LASF3187:
+	.string	"stdlib-float.h"
+.LASF3149:
+	.string	"stdlib.h"
+.LASF3201:
+	.string	"light_led.h"
+.LASF3178:
+	.string	"struct_timespec.h"
+.LASF3197:
+	.string	"build_config.h"
+.LASF3177:
+	.string	"struct_timeval.h"
+.LASF3234:
+	.string	"dashboard.h"
+.LASF3089:
+	.string	"src/main/sensors"
+.LASF3101:
+	.string	"stdint-intn.h"
+.LASF3185:
+	.string	"alloca.h"
+.LASF3168:
+	.string	"time_t.h"
+.LASF3222:
+	.string	"bus_spi.h"
+.LASF3203:
+	.string	"io_types.h"
+.LASF3075:
+	.string	"src/main/config"
+.LASF3100:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3106:
+	.string	"global_functions.h"
+.LASF3186:
+	.string	"stdlib-bsearch.h"
+.LASF3092:
+	.string	"src/main/telemetry"
+.LASF3144:
+	.string	"rc_curves.h"
+.LASF3239:
+	.string	"pinio.h"
+.LASF3181:
+	.string	"pthreadtypes-arch.h"
+.LASF3088:
+	.string	"src/main/scheduler"
+.LASF3096:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`M\003\225\r"
+	.string	"D\020A\004"
+	.string	"\037"
+	.string	"\337\344\236\252\006\006\002"
+	.string	"\002\001\002\002\001\001\240\342\234\212\n\002\237\321\340\236\n"
+	.string	"\003\220\211\341\310\r"
+	.string	"\004\276\357\272\223\t"
+	.string	"\005\256\267\341\367\n\204\001\002\003\002\003\002"
+	.string	"\002\004\005\002\005\007\352\263\360\321\b\013\315\303\256\323\n"
+	.string	"\f\245\351\251\366\017T\002"
+	.string	"\002\006\007\002\007\002"
+	.string	"\002\b\t\002\n\005\002\013\f\002\f\002\t\n\002\002\002\023\024\251\205\376\334\r\002\r\025\026\320\375\270\353\017\027\232\300\315\337\001&\002\003\002\002\002\003\002\001\030\205\366\363\321\001"
+	.string	"\031\345\365\237\227\016$\016\002\016\002\002\002\033\202\373\346\351\rJ"
+	.string	"\002"
+	.string	"\006"
+	.string	"\002\017\002"
+	.string	"\002\020\034 \370\264\327\274\006\021\"#\201\200\345\345\0170\002\022\002\023\002\022\002\022\002\024\002\024"
+	.string	"\002\013\002"
+	.string	"\002\025\002\005\002\026"
+	.string	"%&'(+,\250\320\377\273\f"
+	.string	"-\345\243\251\206\r"
+	.string	".\274\270\340\303\013\002/\307\322\306\260\013\0020\212\321\370\333\t"
+	.string	""
+	.string	"P\250\321\265"
+	.string	"\321\314\202\024\024%\303\030`\002S4\305\016\022\240\304\rG\243\002&\331\214\345\377\035c9\005\220\302\344\251\247s\355J\"\270\0046\r\005\371\356 r"
+	.string	"S}\341R\020v"
+	.ascii	"\272\312#9\324C0\331y\254\245\034\tJ\264T\206\267\034N\332n\344"
+	.ascii	"p\2379\247\330\320n\304\335\034\213Q\312\025\n.E\217\202\263"
+	.ascii	"\227>\026\017Hy@.\321\245\0377\274HmO\304\b3bQ\267\030\230g\324"
+	.ascii	"\307\371\323\n\323\223yn\354X\216\3743\f\237\321\303\257\273"
+	.ascii	"Y\022\216$`\265p\036\222\276;z\231\370\013\360\312\023\252w\036"
+	.ascii	"(N"
+	.text
+	.section	.gnu.lto_.ipa_sra.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`&\001-\005"
+	.string	"\022\205\f\020@\211\r\007\033\260-\200be\004oV\312\224\002\356\205I\030h\022|\340\007\3706\257\214\222\250\310<\364\350\306\226\364\265u\305K\f\313-\235\036\265\004B\250"
+	.ascii	"s\233\306\220\202\2314;\021p\251Q\022\2264w\003\030A\0358M)e"
+	.ascii	"\275\336i\327\325\001\031(\303\241j(P\221y6\307\027\360\313+"
+	.ascii	"I-\346\246y\225\226\266\350\b\223\365\032\315\263\206\350\372"
+	.ascii	"\367\2715\330p\016\353u\330\2169\357N&#\n\332B@x\234\034\336"
+	.ascii	"\350 TQN\001\337\222;\355G\250\005\234\371`}\t\377yi\006\033"
+	.text
+	.section	.gnu.lto_.inline.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`0\b\255\031"
+	.string	"\246YaH\320\224M\032\003R\234x\024\303@\275\202"
+	.string	"\266\332\362\372\222X\354\223\312\337\031\247(\362\3240\346\352(\327\312\214\235\203\203\2744T\f\234vi\006\377@\200A\256f0\b\270\221t\234\240w,?\202]\033\031\322\266\2242\005F"
+	.string	"H"
+	.string	"X"
+	.ascii	"\007@AoHA\215\232~\224\320\3410\246*\216lh\251\275a\354\036C"
+	.ascii	"\214q\366\250\277\245\231\022\272\226\322\254o\214\326@\020\341"
+	.ascii	"TV\251\2560\2151\316\272\217)O\004\202\301\322\317\330\022Y\342"
+	.ascii	"\204\004\345Y\0030\020\331\243\2773js\212C2\347\325\353\373\365"
+	.ascii	"\235\300\177\321\315\025\315\027)\306\230\262*3S"
+	.string	"\2469|rH(\317\314\026\021\352\341!\203F\255\026F9(\311\265hY\035I\271\241\003\231\312_Fqb\214&\357\303_\337\016\017\237\336&\2203F(\231p\371\231\321\214\214#]\371I\214\2368\342s\003\326P\332\200\204\362\312\303T\3114\251\007\347\305\204\275_v\307\210\226\203\361\310\007\220\220\225+B\347J\331\312\300\335n\036\334\202\355\200 D@~T`\366)\t\323\216\224Y\257Ofkj\232j\001\377\247\022z\002\206Ax!F\272\224&\265\203\337\213ml`c\260\264`W\020uI\210\251C\352,\013\021C6R\303\0052\203\006\025\255\b\221@\213h\360\270!\270\345\327\267\013\264IQ\273\321Q\034\213\246\213\017\266\204\320\261\250\205\n\273\203\342)\200\320\2501\256\031\031\031iAQ\n\215\001P\"2T\224<\022\300\303@\205\304\230\221\220\215\204\221\244\245}\3464\213\002\356Z\311ce\274"
+	.string	"2\216\2347m\327\326\324\006\036\305|7\310\2346\255\256\230+\2019\t\177\006%t\272\321\222\330!\223-MJ\032\246\307P\360}\336?\017)K\350\205b\304S\301\272r\2075\301+\362\036\201&;\262 =\222\251\020Z&v<.\030p\360\212A'5\"W\257\2235Bz\024\177\317!\f\030{&\334\261(\3014\251 \240\035\3178\333R\335\375W\355Z\301\256\n\240l\313\367\361s\n"
+	.string	"\271g\255\317\002\301\333\266,\031\331\225!\243^l\210\027\332o=\035\310f\2061\267g\201,\200\035\212\225\317*\224\037\255\241{\245E\017A\016\307/\217VJ\330"
+	.ascii	"]\336uD\232\024\253\3567Y\032\235\260\2225]\205\343r\002\233"
+	.ascii	"$\f\207tCeF)\344\263\233*\2433\006`\372\347B7=6X:\304\360\357"
+	.ascii	"V\005tb\242))\036\210\263!\247\024\rW\361d-m\200e^\310\243\253"
+	.ascii	"OvF\300\270y\354\366\236\326e\030y\215\375\365\272i\032\212="
+	.ascii	"q\031\0244\225\310\311\024\200\236\216\314\335H\333/\325\375"
+	.ascii	"\013\027@\233X\365\\\005\200\363;\026\360aT;\007\352\330!\311"
+	.ascii	"bqfg\367]\201\200\323L9\262s\033\2670\241\234\251\212D\201p\311"
+	.ascii	"i\343OZ\240\003\363\306\211bo\257\352\004\201\202\371m\303h\221"
+	.ascii	"\200\221(\240\0336\214\361m\210&\344d%\344[\212b\323\250'\254"
+	.ascii	"W\037\267\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\004\bE\030"
+	.string	"\346[U>0o\222t"
+	.string	"=/\303\344R\347K\257\226\216\311\324"
+	.string	"gf\205\206\003\206OCo5\n\324\336\204\006CC!\325\306\213C\n\210\377\rp\363\377\330&T{|\324\037\354\265v[\322d\332\001F"
+	.string	"G"
+	.string	"A"
+	.string	"n$\221\275\255\2176\005?\004"
+	.string	"\021;\214\250\321D\321S\266\034\034O\365\334^.S\017*\2028\203\257\254\265\331\264S\013\361UU^\325X\271\223\205\260\023BL\301\244E\345\020\227s\0228\031\265A_\017\274\314\b\233\270\265MC\226d\311Tv!~ \262\bQ\200s\316\r\360@D\374\366\021/\342>K\234e\377\341\004\262\315\234dN\240\367\n\334\241\367\020z\017\003@\037\3503B2B\362\251"
+	.ascii	"\341c!?\274\207\361\367^\004\027\222\364\224/\256\253gJ\361("
+	.ascii	"\336\305-\207\333)Wq&\006\363\344X\334\326\325U\325\315\343\334"
+	.ascii	"\224\206\206\244Al\213\344ck\203\034Y\037\213\314d\226\016.\314"
+	.ascii	"\362\022\267\316M\245\305\222y'dv\342\210\202r\303\220m\002D"
+	.ascii	"\004R\357\037\300\326\326\342t\251c\276\006\244\220e\334\202"
+	.ascii	"\344\203\f\342\3669\035\035\267\f\324fA\266\253\270\341\366\025"
+	.ascii	"\267\033\033w2\357\275\367k\252'%\245\215q\313\330S\302\250\\"
+	.ascii	"\200\341\250!Q\310\212$I\n\313\030\240\002\021\242\032\362\022"
+	.ascii	"\340a\242\n\004\231\203\214\204HR\250l\355\035\013\245\206B+"
+	.ascii	"\030X\210\331\020\271\213{\030\243\007\376T\021uE]x\224\356\005"
+	.ascii	"k\322y\t\306\273mP\365\375^\022y\033\244\264\271f9\t\270\304"
+	.ascii	"_\026\346\262\353T`@>\3414\017BP\217\242\356d\333\032b\271\020"
+	.ascii	"&\005\273\251 9e\352\n\223\324\234U\237Y\266\213\b\251\356a4"
+	.ascii	"\023\245\354\343\034\272\241x\2652\375\366\0035\n\313J\201#*"
+	.ascii	":\260k\264\235a\031\311~QE\3612)\261D\250\314\314!\261\315\253"
+	.ascii	":.6Io=\316\005\"x\240\306\013\277\n\306j\370\016\030\f\261\001"
+	.ascii	"\271\264\212\230\331_\316\036\245j\272#\004\233\003w\342\225"
+	.ascii	"\352G+?\237E\200\276=\220\2141\002\353\350&\201\207\312!\336"
+	.ascii	"\373\216\0364J\364\233\266\357\370\204\222\267\023\305v\025\301"
+	.ascii	"\203\232\021\005\3316\312\214\242\020\272\272V}\201\235\332\023"
+	.ascii	"\240\237b3\223\004\312>\314V\001\357\216\250\177\023\330\n\347"
+	.ascii	"z\216\222\241\342\315\360?\021V[Al\306\304\303\276\331\005`I"
+	.ascii	"\356N\332\b\326\250\022\260\3471U&\f\324\271\235\351\350_\357"
+	.ascii	"\237,p\255Y\226^p\021O\330\241\230\255\315\344\323\360\301J\231"
+	.ascii	"\003\215\254\274.\226-\236[&\231CG\227-\031\311\303Lz\217\343"
+	.ascii	"\267\354\2230\316I\003l\2558\354Z\352;\356I\023\036\351*7\305"
+	.ascii	"\317e\035\b4N\321\251\200,5\375\204\232\bv\316\273\005\246\214"
+	.ascii	"S\2411\0277\332\336Q\027{\336\323\215\247|1\310\003"
+	.text
+	.section	.gnu.lto_.pureconst.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375 A\355\001"
+	.string	"\022D\016\031\240E\215\001`\325<)\265\002"
+	.string	"\200\003m\245e\323H#\343\265\322\260B\006\006\"\027\344\217;N\2153\336\342\212'\036\342\035.\303\225\200\302\t\037\\\027<pSf&\005"
+	.text
+	.section	.gnu.lto_.ipa_modref.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\023\001\365\006"
+	.string	"\002K\033\035\2607s\f\3030\f\303\212\344\026Y3\263e\321\343l\333\"\314(\001em\367N)\005]\365\b)\235\032\037-\266\305\371l\317\311l\314\t\006\362\007\006\345l\316\207ee\200\210\005\004\325\330\032\237\246\234\315\326\234\217\255\341T6\206s\341L\266$\025N\004\002\252K\307\3468\023\316e[N\306\306\030\221\b\321!E\304\023a\033hE0 `\202Aef\007\0169\202\0020\243K\206\241&\327\003\211\204E\2478\302n{.\246\221\307\025m\002\223M\"\034\312aE\300\235\301B\004\346"
+	.string	"\231\302hJ\240\035\201\326"
+	.string	"\304w\rAw\005\3741\301<F\230S\021\n\260\313\2408\006\327\315\n\t\373 \266\230\340n\307S(-0BE>"
+	.ascii	"\372\n\367\004G0S\3334\026\027w\b"
+	.text
+	.section	.gnu.lto_.lto.4a22160a496eb4a0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_isCalibrating.151.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`k\002M\021"
+	.string	"\206\335kH\360\2606\035\362o>\346\216w1V\356\320\324\331\323\346\212\017o\2177\355\023t\271}w\b\253\201\211\326\021\324\022\374\321\323\307\320u\321\233\242\352[\273\234\330$\270\303\023\344\255\022\307\205\275n\214R!\"B\233l)e\nY"
+	.string	"P"
+	.string	"["
+	.string	"\330l\006\277\341v\2521\206[\234\321\324\221\"o\252\321\2043n`m\016@y\340Y\325\250a~n^\243lDG\026\030\333\225\230\235\323@\007\031\030:\222e\n\240\001\302\206\007)r{\220,\363Sk\335\325r\013)b\316Dj\255g\022ya\017`\377\327\374'\360\263I\337\325*\260\031ypT\316\361\263B\356\324\277]\226e\371F\375\347s\347o\347k\347g\347\323\363\261\363'\177?\026\214\330\271Q\240\254\265T\352\250/\254F\304\177\225\277\373\201\020\225\203\313\232)m\352e\244b\247V\226\3272\013n\307mZF\003\031\214S\210\022\034`4\332#\016h\207\234D.X\360\353\346%fX\357\016\024\254\027\246\005\212\0232t~f"
+	.ascii	"\033\235\231\036\035\027\326\251\355\017-\321\214\2714\313\275"
+	.ascii	"=\032\377\021RxI\334\233\341$\352p\267\017\322\355\221\0245D"
+	.ascii	"\3569\306s'\320\237B\005^\3226\202\223\330a\377@HB\240\217\301"
+	.ascii	"W\342}%\336\203\223\006(\336\027J\361@>\016\202@\022\362$\200"
+	.ascii	"@!\257c\325\235\265Q\2479+Z.nivW\233 \307\324r\315]\220r\335"
+	.ascii	"\362\237\353\213\254\264\350\263\326Z\273\315d{\225\\\\18\255"
+	.ascii	"\331\004k\275$Nb\207\373\027\246\027\227-;\t: \360\002\031\031"
+	.ascii	"\255\003\2242\364M\215'\224\355`\326\312r5\332\275\351\222\333"
+	.ascii	"d\017\266l\227\231\232\3502P\"\026CL\300\325\352=\336;kz\213"
+	.ascii	"]w\261\351^-\331\333\272\270\231-\355\313\223\307o\315\310`6"
+	.ascii	"\033\363\004B\212\023\020\354\201\r\232\316\243\247\023\367f"
+	.ascii	"\331\250\275[\323\303>FP]\330#\3577\315\340\321}\002\"\210|\n"
+	.ascii	"#\2130\243\255i\333\225\313"
+	.text
+	.section	.gnu.lto_getAxisRcCommand.152.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\264\001\265\017"
+	.string	"\226\336jF\360r\234\016\212\256\035\035b\t\017X\351\245\336e\024R\b\036\377\3727\273\024W\216\313F\334\351`\b'\252\373I\222K\036\210\033\201\306m\240r(V\004\033\233\321\021\364yP\204\344\320\"\b\360\212MD\210\224)\005X"
+	.string	"Q"
+	.string	"V"
+	.string	"\245v3\003j\303\203\017,\034\016\270g \026O\3650\245\2639]\\\314\3149\025\370"
+	.string	"\367\314\266\317\342-T\\*kD\007m\365\"\345\3521\347\364\272\017\320\236\351;\332\263\025\361\362Z\372w\035KQ\342\206\252\305t\335\032\3149\255\252\026\017\367\336\266\001\333\022l-\020>6\367\305\266\272s\326?\322=\346\027y\353\346\034\346\017Q\265F\325\334\2527Uk\252\316T\215\251zU\255\252\276\200\315\n\032\tx\314\311\341\365c\316\310b\230x\353\267U|\2277 \022\236\335*\2719\303\245V0t\3149\021<3\004\220KL{\033*:m;\215b\233\255-Z\320\253\264\365hX\2239\233\355E\026S\031\024\234}\353\236\223\372\360.g5\207\246\273\003\003\213\256}!E\257\332\365\254\254\311\344\313-C\373\352~\005\004J_\016\331\257\002I\0059\351\313\233\023*\023\242\306T\0376\313\244\273r%\221D\202\341\204Qhr\002\222H\224"
+	.ascii	"\242\322\027\022}\241\210\013\311o\304\034\"Y@RR\022b\360\351"
+	.ascii	"|\344g\222\362\215\233\301O8\212`\004p\344\201#\257D\372(x\340"
+	.ascii	"\210\342}\bX\254\020\216\036)\212\243\267a\315\273\263\236\323"
+	.ascii	"\242\f@\271\325\254M:\321\253:\335j\266\345Fv\013  \320\"\253"
+	.ascii	"9\007\266W\221\241\315\b\f\336\306\030W2 \205\356\313(.\246\005"
+	.ascii	"\337\341\270\312\031\377\002\257\311A\340g\243lwZ&vI\274R\021"
+	.ascii	"G\2730\225\220\025\275\255\211F\b\327\260\037Bl\\\360Ocj\017"
+	.ascii	"\031"
+	.text
+	.section	.gnu.lto_emergencyArmingIsTriggered.154.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\322\001\335\021"
+	.string	"v\"zG\300RN:#\026\006\300,\313\\\264\252\013\365P\252bR4\270M5O\3724\f\240\331}\277Up\315t\353\274l\241u\200PL\235v\270\256B\026\205\3106\003\257KI\345\020\024\306/d\377veB\366\336R\246\024g"
+	.string	"`"
+	.string	"g"
+	.ascii	"UsN\224G'\350\036M>\"\037\341E\344\243\031\254\3408\347\267\242"
+	.ascii	"\037n\303U\017\023\2209o\255%z\316e\204\2539>g\243\006\rZ-vi"
+	.ascii	"2\347\344\321\330\2058\204'U3~\374 \321X"
+	.string	"\265\035]x\002\204\343\303\200\232\016\034\221\022\352q\245\253Om\246\312=\230sZi\265\0167w\333\236m\b\266\212\00457z\332\243\177#\037\277$TI2\375\254O\036v\334N\362Io\020$S+\353SM\307T+\373\026\323\265\331\337\357\373>\357\220m5\013\252\271U\313U\307UCU\253\252/\300\200\b)\t\337\234?\337\220\031\025\233H\330\306\361\225\314\212\340\264\340(\236\002\347Iv\352b\034:\026F\032\002q\017\"h\2661\333\257\313\210\351b\300\345v\230\202\300\226\0235\252\270\266\357\224\220\t\037\2706O\235D\352.\217#\242%\250\026\207\341\225\024\3159\035\3303\177Q\001A\321\243\213\356\276!\037uKF4\311\364\373\221h@Q\2736\007\270'\277\353\343\310h\211JG\205\330\246\371\n\257\233s\262\370*\276\224\301?zt~QaQYYyiI\021\241`\301\223\251y\301dl"
+	.string	"\330\225\362\202y\256\t.\230\226\013\246ua\306\205\246\345\202\325\264R\016\330\303\360\202\265l<\017\326b\335\346\341\334!+D\271F\005\347\326\3076kMd;3\267\254}\317\225L?\t\347\234S\312\2059\b|_\211\252\307\310\270r#\024\017\320L?\027P\333\305\245\247\005  `\002\231\241v1\200\013\002>\364b\214\027\027J\177\036\260\346\026 *E\330\200\255\020\350\303\002\2065\306\205\220\034\t\200~\004\352h\004\202D\026\\>"
+	.ascii	"G\313\244\217\361\273\331E\t\thB\207\217d\322d\311z\310\035\243"
+	.ascii	"\322\034\254\013C\001"
+	.text
+	.section	.gnu.lto_annexCode.157.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`j\022uR"
+	.string	"j\220\254\036O0\224\322\031\016\342\243O\351\212\345\252\352\304'\246F\300\243wQ\024\351\271R\374\r\222a\331\nK\303\261w\031\350\321\330{\020\002\214\306\235)`-\017\r"
+	.string	"\022d?H\342Dbw\312\333\260\340Nk\2366\\\364`P\243M\366\336\335\222\2242\313\001\261\001\344\001\2755\316^\244\263W\201\263\227\206\331\233\300\331\213@\332;#\355=:{\215\316^\031go\221\331\033\243\327\013\343\354= \355%B{_\240\275\006\244\275.|\275\005\370z\tH{\0078{[\244\275A\263\227E\257W"
+	.string	"\2637\200^/"
+	.string	"h\357\n\264W\305\331;d\366\246H{\205\316\336\240\264\027\310\354E\321\353\3751{}z\275=h/\017\332\273s\366\352\230\275\300\264\367w\366\372\322\336\324\354\355\365zQ\263\367\354\365\232ho\211\366\362\316\336\233\275]\3662W\021zCD\2233\353Z%\371\304:D\331\366\002\2571\207a\026\303\314\306|\306\345.+\241AZN[\326\201w`\036\030\271>\245:64S(\227Jp\304\\\020\234\302\263R\241RW\366\224\025\346\0024\313+\310\003-H0A\271\004\322A\016\254\246\362\032\006\350J\006\365 \211$\226P.y\232\177L\006\263\353\333\f8m\223<\021\207\313\345\0332\330\365q\331\214\266>\2458$\256\201mP\371L\0034\313\013\325A\313\026\273u]cp\271/P.\203\fdr\311\343\037\223\313Uw\325p\032\331\312<\260\320\245\026g]\327\243\257\300*\377\370\364\360\354\350"
+	.ascii	"\177\276\264\207\236f\311{\253\313'\217\236\361+\213\177\264"
+	.ascii	"\260\317\234\027\013`\264t\017\017\317y\035\311z\307\004\326"
+	.ascii	"1\241\204\006\376H`\337\bX:m\321\023\201\3219\257+\274 \032\267"
+	.ascii	"0\363\n\353\023\214\315\364\013\214K\235\257\"/\270\256\253\357"
+	.ascii	"\213\253y\214\302\007G>\017\206\235\017K\350|M\341\001Uq\301"
+	.ascii	"\310h\334T\276\266\272O\036\353\272n\033\277>\340E\301\273\354"
+	.ascii	"cw+\330\355\331\022G\032\333\300\350\377\351\276\357\252-\250"
+	.ascii	"/4\033\177\017\026\237\265\351}/z\231\310\334UcPgh6\246\347."
+	.ascii	"Y\246<\213w\366.\205\013\323\t\373\256\013\033\241~\251J\352"
+	.string	"5\275\367\335\034\372^\323\346\371)\325\006\036B\330H\262U\321\370L\0173\303\244V#\333Bery\276\221\3073\2552\034G\245\024$\210\311\245\371Vc-`t\b\242\374\330\362\222Y\236\325\364\312K&\357\345\271+l\213\337\030niy\313\022ab:\303\035\303\372\377\345\272\346\354\026a \204\350\272N\251\261\334\306?\034Y\336\302\345&ij6r\271\334\364\303\035\317\264:\271Aq\032\216\253J\031\357\247w\235@i6n\360\367\306\206\311\234\260#\363\217\355\262\005&\037\n\007$\246\264\023\313\323\273OQ\315F>\215,[\317\332\240\270\271\265\345l\277\t1\267\266\234\335\264-~2\231L\366\307v\371\311d2\271Oa\227\327x\331\310ax\231\003\026\303\313]\314\306\313\\h/\257h\257\312g\274\304\263\027\353\354\275B{\207go\325\331Ku\366N\235\275R\316\336\250\263\027\352\354}J{%"
+	.string	"\366:\001{#"
+	.string	"\366B\001\366>\001\366:\001\3666I{\231"
+	.string	"{\227"
+	.ascii	"{\233\322^%go\222\264\027\211\257\367\210\257\027\202\264W\350"
+	.ascii	"\3535\222\366\026I{\037@{\231\320^\007\322^\"\277\336!g\357\022"
+	.ascii	"\332+\004\355\rr\366\002A{\225\320\336\037go\322\331\353\343"
+	.ascii	"\327\333\343\354\345\221\366\3568{u\374z\033H{\0318{s\234\275"
+	.ascii	"\013\234\2758\314\336\033g\257\2154dt\234\007\025\265\203f"
+	.string	"#q\307y\374\310\3578\203m\003\327\361#\253\364\027\365\013\355.\355E\005\301\212\n\006fr\331\300\031\f;\f\234\013\r9\316\300\002\317\361\323\025\275\340\270\215/\3602M\321\354\306q\310 d\270\030T,\f\204\031\333\2156\027\267q\336]\327\234+5^\366\002\322k\264\030+p\244\037N\321\013\215#p\005n\"\213f\t\234F\013B\226\333\242b\3417-c\0228\313\035\333f\034\201#\331\214\027\325\201\035]\005UL\210l\314\350GF\310\270\321\237\246\350\245\350\007\\\306\313\273\242\331V'7\306\213P\020r\334\215]\365J\237\240ba7\262\316\242\262\220\304\310\030m]\002\2143\222\350\007\234\267\250GP\305P,D/:\266\351\300Y\321\371]\251\361a=\352\305\207\006\374E_1\340,\216ap \270h+\r\026\302\272\231\\\262\261\200\273 \340\005\374j\3056\003\234\200s\327\234\241G\275\305"
+	.string	"\301\267\370\345:x\356\002d\361\253_\216\204\366\352*>Xt\007\002\374\0028\326/gBS\0216\033\2326\002I\352\034\320\004\360f\253\353\r"
+	.ascii	"\270\320\312\231.\276\036\325\231\r\0273h\325\241V\234\325\250"
+	.ascii	"\370\212.\2528\277\325\205\245\370\320\t=\245\267R\374ruwB2:"
+	.ascii	"\253\327\273\351\034\352AB@\017\372\351\030\350\374%Eq\252\237"
+	.ascii	"N\216\260\3478\261$\251\337\240x\317\211\363\363~\323\363y\325"
+	.ascii	"O\267\204\260\307\300\351\361$\251\327|\336c\334\364\\\250f\246"
+	.ascii	"\tF?\266mJ9\247\3412\246\234\372\323\251\b\301<\3476\034\004"
+	.ascii	"\357\234\207\315\3169\016x\235\237n\215\032\340\037w<\373\275"
+	.ascii	"\311\371}w\213X\tU\f\210l]\327\033\313Hp\022\352\230\272\202"
+	.ascii	"zl6\252G\223\313RRS?&x\032^YE\235RRS?\252\246\256N!IH\226\214"
+	.ascii	"8MP\365DEe\225\0245\334Y\250\0315f !A\3410\372\211b\001\005O"
+	.ascii	"J\242P\200\205e5\224\202\005\334(\243(C\253(\247(\251\243(\251"
+	.ascii	"\243\252\251'\252\243\250\341\325\221Q\212\265\252 \312\360\b"
+	.ascii	"\313\312jx\344K\323b\336\372\024\224\320\2624a\247\365\255\037"
+	.ascii	"\006C<\363g\371\250\207\342\361\222\311\353\325#\226\210`Z/t"
+	.ascii	"\f\323\002\303)\017?\240o\312\3305\341\006\215S87\274u]\327\036"
+	.ascii	":UL\210\314\2102\022|\216\b\247K\360\247\211\340P\356\364\023"
+	.ascii	"Y,kz\004\037\242+\232m59\024!\214\347"
+	.string	"\265'g\343/W4\343\344K\376\344Cj\305\022\266:\331\344N\230\274\311W\270\025\355\316\250b\250\031&g\267\272\246/9\027\315\224\274\351'\234\242]\\\031%\267\001\307\3019L\021\034\270u\235\30505s\035A\254\353\322\201\373\201\271\316l\034\034\322I\276KLC\\\303\205\344I\316\223;r$\020\334\310\217\234\213e\302C\320n\375\246\212\021\331\020\335\2701\271\024\276\027V\344FR\0362\037x\021\"\234nS\305x\r\315.\221\211\366\201\330\304\216\356\241\311\020\345\020\357\210\311f#1ir\371\300y\255\356\214\221\314\036\300\371\260lD\310\032\201\347c\313\364\341\246\361\222\351\300\231\330\034\020:S\263\340\276\0201\352\035\302\2441\266\031r\":z\211K\355j6\016yp\370\2453\032\377\334=\231d\"S\310\207\337\356\n\333\232\201\323\210j4@\327u\345\"\237\261S\226 W\272\220\253@\026\275"
+	.ascii	"y\220s\2431\220\257@\026\313N4Ld\376\270\322\207\334\212fI\377"
+	.ascii	"\341\343\304'\335t+\226\365\270\2173\230\033z|G\f\304\363\031"
+	.ascii	"\007\265Z\316\346\350\235\201e\250a,%\031c\210FD$IA\ni\016\301"
+	.ascii	"\005\204 \304 "
+	.string	"+\333\021\340,\210 Ce\222B\2069\036-E\254Py9\205\351\222\327c\263#\367\025\374-\004\377%\302k\323cD\351?\177TU\256\305\216\235\214\204\205|a\205\332ESP\245\324\217)\263*\r0/6)\334\214\036,\350j;\351\b\331F\334<\251\035\022\223!j\237\326B\323o\307\216\307\030\256\034\225;yY\306\241\211\206\260\340;\322\035\314\n\274\375L\n(3\023\007|\365&\016u\252m`K\3240p~\f\274\"\262.\312M+W\216\271\236H\360\341\232\252\242\027\343\004\300\234\202Z\024G\030\025\350\311\003?\220w\003\347@\210\206\3252\017L}\333PL;\230\307\347\227M\262W\265\236R\277\235\332\272\031\360\370\325\177Mj\033\350\222\370!G\005R\2760\223B\240\037\317\372\307\236\005\"\375\375\270"
+	.string	"\005\264\306V&\302\035\327xa\242>\332\nJs\212-gJ+\355|d\216\006\330z\336\226\217</\350l\212\354{2\t=}T\374%\335\305?\234\036\302\261\315/y0\025\222\302\023\244\276\371\241g\222\264B\224v\n\337J\272t!q\364L\024\337^\314\274:Q\rE3\366\177\304q\345b\273\246Z?\260-\331\203q(&j\035l6\036\241v\365!"
+	.string	"\341[9\016\301\304\331\230m\3338J\215ab\364\302n\377S\311\261@'4o\0013p\241\031W\317\32294\3523{\366\370\026\233NH\036\377M\340\023C\272\353\007\234.wg\322\213\247{\275\354Y\330\265\261\355\234\316\376\301\315\2647L\231\301~\230\240(\346\032a\230\306\316\245h\201\304\377rG\272O\231\2120\b\254\021\004<\357\013>k\307\"\254\016\344\366q\2378\225\016\355\246\353\264?5\271\037\034\023w\003\357\366"
+	.ascii	":\273#P\374\264\334\270\371@+g\"\367\255\2403\220\240\317\226"
+	.ascii	"\242\265\230\273<\347p_k\337w\333\360\235&B<\037\240\227[\330"
+	.ascii	"\273\235Q\270%\254\214\210:\033>F?|\202*:i\322\205\2629\271\377"
+	.ascii	"\204\200\245\257\222-\031N{\022w\224H\210E\223,\321c\036\334"
+	.ascii	"\320\222\\u\031Ku\003\334\245\030M\330]\306G\3602\221:\365\t"
+	.ascii	"\267\307\377\342\374\201C\235\340\221cf\226~`\332\330\331\215"
+	.ascii	"\235:\346\237e\361}Lk#4[L\204\265^\004\2547\326\3047\3411)\233"
+	.ascii	"ge\256\376\212\226\321\235F\214E\r"
+	.text
+	.section	.gnu.lto_disarm.158.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\252\001\005\020"
+	.string	"v\336kE\360\322$\035(UM\027\026\236\267\231\315\266\367\376*\254\b\342t\357\362U\032Ie!\336\203/|\033j\n&>\f\3768W\2256\271\331\027\216C\311\342\004&R\363\316\027\220\325\005\0136\250CCdo)S\nV"
+	.string	"Q"
+	.string	"]"
+	.string	"\273\255\004>@z<\271\311\365\b_r=:e\367xKg\177\343\250f\206\220\335\305\364\304S\277\"\324L\371\367\371H\347\251~\tx\fq\310\241\344\261R!\002\"\034AL^\007hb\223\242\273\317\363\203\267\312\024y\260\273\316\316\003q\213\334vf;\202\375\037\0012\371\356\321\227\271\036\257\003vnh\362s\002\r\331\261id\267T\251&\354\353\367}\2375\307~\317O\322t\3144\314tf\372\246\002,t\254\f\355\332|G+\024s\250\260}\373\255\224]\262!\310P\360\274\217\317s\027\251\367\314xd\267\004\317OA#\030\b\r\255\200\033\256\250[)Ov\317]\366\205\227|\027\325\001\016KU&\t\022\001\325\306;\037"
+	.string	"\276\3573\202\232@jnVA\036I}\032\2571\243\305\304\\\217\006vH\220"
+	.string	"}\327)\"\372QsW*K\f\036\254,2<w]S_s\263\312\317\376\213\303\340|\024\326\020fIY\220\242\242\302\322"
+	.ascii	"\245\004F\343N(\t/\333\211s\251@\342\f\005\265i\331J\326\202"
+	.ascii	"e-\030\214\313\351\005\3136\016C!`\r\003j\3032h\332\206\225Z"
+	.ascii	"{\270\2323\241\205\020\215\256\340\356\356\025 m\n+\252*\223"
+	.ascii	"\364\344\231\364\300\302\331\335\224\214\246\264Q\026\362\235"
+	.ascii	"OV\252\262)! \240\002\021\272\362\001\263+8=4\177\201]WnE)6Q"
+	.ascii	"\022\257\234\257\341Z\350\240\037\345\351ap\356\332\226`\214"
+	.ascii	"\007\205\246\303\333,\026\006,|\001[\245\321\216Ta\307\025\007"
+	.ascii	"\024\316k3\021\374^\264\235\277\030\2672\316[\325v("
+	.text
+	.section	.gnu.lto_getDisarmReason.159.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375 \370\275\006"
+	.string	"\362\214/3`m\322\001"
+	.string	"\255\224\220\232Ah\210!:d\273R\016#\210\302O,\370fQ\357\030\345}\227\033\333\346 \210\n\020\024qo\220\312V\257[\262\267\224)\005~\230\314\004\037\302\323\270\247q\013\233\004\005\367\246\006\207!0d\310L\316\001\302\311Iq\257\240\324\313G!\354\217<R~\207\0378\371\352\315\347Do\251\001\034\025\237\274,al\252\330\321\223\232a\237\355\356ZA\266\323\251\005\241\223\315\265;q\255\254I\013y\330\356\330\222\017\362\220\216)\0267,"
+	.string	"\t\213\b\222\224\335\350.\037\210\336\330\005\2427\3258\365\244\374\213\234}\240\224T\226\347i9\330]geQ\334z\003\333\027\001\b"
+	.ascii	"2\001/8\003Z\034 ]\346\305\f3\334\025i6\274\353\336"
+	.text
+	.section	.gnu.lto_emergencyArmingUpdate.160.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`p\t\0352"
+	.string	"\nW\f\023D`\246\326\030Cw=\226\206\226\335\272@U\240~\321\333\350+\220.\221\017=\244\235\327\365\361\232\\\215k`n\323-"
+	.string	"_\364\3769\366m+\b\346\313\3035D7Ab\200\017\037b\026\255d%\221R\246\224R!\001\003\001 \001\314\206t_\"\275(fR\013n\263\020\356\214\334h\334O\030\330,\0048\306v\322iZ\255\226t\267\232n\234\\\022\273\367Mcj\226)\270\315\"\265P\333\354\332\303\266\331\0062C\250\032\335\231\023<i5\223,\242~\223\306D\313\373\246\035\340%\267Y-f5\235\026}[\016\210W\233\234\367}\213\357\303\3555\255\331\307\301\327j\240\037\237\036a\220\007\370\363\271\275\226\035\256\357Z\334?\347V\003\365\240\310\236?\372\307\247\354\254\031\365\036\035@\347\322\205cK\017\266O\261\346\001\266\205\365o\355u}\tij\023\307j\244c7\327q`\356K\352\361\274\321n\\O0\213cC\366\274\321\275\265"
+	.ascii	"\025\306\226\2466s\254Cbn|t\233\227\267=\250$\262gY\263\255\024"
+	.ascii	"\353!\265\tdEz\337\267\237\264\277pv\371\272\032\260\253\002"
+	.ascii	"\247\333:\211\332,[\205\276\2040\201N\026\376k\2028\347\024\241"
+	.ascii	"\223k\r\036Qs\326M:\351\254\371\303\275\007\365\276/;\323\371"
+	.ascii	"l\016j\3466\301\314\031\230\335\260J\307\343\2403\203\250\362"
+	.ascii	"f\022\377\304\016\256\337\342~\322\rC\352\006hM\023\271\265\263"
+	.ascii	"\332\001O\265f\306\245l\032\330\2502\347\037\312\003\276\237"
+	.ascii	"j\255\312\302\3510\363\210\236\222\345\276\357\273\200[J\313"
+	.ascii	"\225\340\016\322,_\235\360f6\313}\342\235\312\320\224\236\307"
+	.ascii	"\335\244\177\322)\365u<\346\264-\177(s3\02434f\370y0\267[3S\263"
+	.ascii	"5/\265Z3\261\231t\017h\270\346\243v6j\347\"\326\231\310\235\001"
+	.ascii	"\270\363\020\353,\324:\007\265\316\303\326\031\250\235\177Zg"
+	.ascii	"\237\326\271\207u\026\272s\320\235yXg \353\374sg_\353\354\266"
+	.ascii	"\316=wn\335\231m\235W\326\371Ygo\347N`t\345\213\b2\357\373\225"
+	.ascii	"W\347\365\302\316\ri\270n\267n\266n\265^\231;*\314\310\r\205"
+	.ascii	";\216\201QbpLGE.\316\356}_\fn\263Q_Fn7\356\267&\0253(QJ#\367"
+	.ascii	"\032w[\024\227\221\003\n\244\256\357{fzL}\364/\216>\370>f\255"
+	.ascii	"\313\n\236\017>\321"
+	.string	"\335r\354\237\347{t\254\021\262\243\207R:^\257\357\373\276>\3377\\#M\231\322\240\002\237\231#4\033d\321N\252iM[\307l\243\374=\360\003\324-\211py\036\211N\203l94R\355v\346\367-W6\327\324G\357\373\242\273\243\251\215\377\267,]O\367\241\314\314\324\r\327Y;\224q\275\336\221\rMi\270_M*E\3134\263M\357\327w\237\255[\216\265\337\373\016\323L\327\262\337~/\317\270<\217\231\236\375V\214\327\0351\3110\353+\225\241\rMe0}\273\265\212\035J\307kj*\362A\364}_#3\207\376\"\265 \332\254\027\246\027P\235{\353\2561u\032\243t\354z\017m-\375\337gk]\272 \335\272\177\245\266\356\031\322\274&\373\262\321\325\022\237y\252\247I)\261\n6\247\033\331fA\n\210bi\212\276\021J\343\214a\037\312\335>$]\310\f\033\331\372c\035\333\nr\316_"
+	.string	"\217\364\216\370\255\326H\001UU>\225\202\204\207\016,\362\312\352\231\n\301\002\004OOT\r\234\206V\025PH\bqLQ\205\274"
+	.ascii	"\302\252\252\004\326\224\017\037\235<`]\035\245\216\037\212\307"
+	.ascii	"\017E\253\252\251\022\305#\026\212\242\023\021_\231\360\200U"
+	.ascii	"Lqu\205U\004\246\275\375<\030J\371\\@F\377\314\032\212\272\323"
+	.ascii	"\016\263M\321\033\375\001/\034\312\021\376\225\345\306(z\007"
+	.ascii	"\325\251\225\037\"\207\201$\340/\204\236h\311\222\005w\201\\"
+	.ascii	"\362\026R\004\334\353\255\n\346\324C\017\340\211\350\226cB?\364"
+	.ascii	"\355uGy\364.$\013\241gP\0264"
+	.string	"M\262N\327\030\361\271\322K\337d\302)\222\245o\266F\n\372\245\3674\311v\370A\337\253[*\001z\342\017\177\245[\022\361-\177\201\376\251\2126=\322\363Pn*\375c&\310\2315l\360f\376|\307i:0J\340\b\037\312>\337\363O]\343\322\223\227W\304\256\223-\361}\276m\253\223t\361z\236XEs\200\303N\003q\273;\023|(\317\234\244\222\234\003U\2606\035\314\3251a3\200\302\207\203\274\353\274F\266\377\302g\355,\307\270r\374\036\312\001\200\277\250a,&\225S\206DDD\202$I\222\016\260\002\021\2412z\021p14f\243 \263q\367\324\013\365*\375\265Z\377\263\371Vm\250x\335q\212\244\331\275r5\3368\275G\031\363Z&\250\003ky\347\233\367\206t~\204\256{0`\332\0164\223.\341\327\2269\246B\202\350\356\200?D\353:\030i\354\030\313\256q\201\b\201\034\340\264"
+	.string	"I\263\320\361@\225\2350)$\212Lb\221\343\211h\330\341\354\310\375\376\340z\321\251L\302(dD\220\362\226\240\353\342\360\216\363\322DU3\321\007\037\236\303a\305@\331\016v\372\247\322\333\252gl\3551\252\201\303\\\327"
+	.string	"0;~x\243{a AI<\301\313\027\254\331\037-j\252b|\023\230\335\263}\371P\241\353\357\363\n\201\320~\360\353y\367\310+\236\242\r\020C\017a\003.t\372!\203\t\202b+\211\226\235\332\324\034y\235\335\353\364B\247Vl\213\267\341$>\016\257\246\027IX\\\031\027d\326c"
+	.string	"\002\264\231\236Q{\333:#\370\303s\022\355<Cd\367F\212\254\303)\226\362h\213\372\\\246\bJ\207\355`\013\203Z\372\207v\n\316\313\tQ\222\332cz\251\327\222\257i\373\250,\272w\304\237\342{\214qA\371\210\240S\017\020\243\016J\021g2\334IrT\354@T-\2075\001\263"
+	.ascii	"6/\335\034\255\3440\362c.6]\r"
+	.text
+	.section	.gnu.lto_releaseSharedTelemetryPorts.161.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`9\001\r\016"
+	.string	"\366\031_E\360\262&\035Bh\327'N\204:\265\220\242\353\266S\\+\321=~\344\224%-\2177xsl\332:\2676c\324\364\304\361\303DM\355\234\237d\261\rrP\362s\325Qg\367\262\304^\210\263j\304\222M\244L)I"
+	.string	"J"
+	.string	"H"
+	.string	"#[\347\341\314\336\205N\207\026;vW\323\022\276r\364xi\216\374\\\321\360>\322\343\3459\301\320\b\370N\027I\213us\360\371\362\271\344u\"\346z\360\027\212\225\215\367\305<=%\273\353\364>\0207v\333(\266\033\3307\005836w\354\220\224\212\262O2\323bYe\354,>u\377\003\002E\304P\321\261\013\363\243\307\346\304\033\023O\375\366\017\032\304\340\005\202\327\\\305\350\251\226/\207\017\037\317\306\212\265\033\036x\264\201\354\321\341\007`\217\331A\260G\007\007\177\017!\356\222\322\265\273{)\312v\306\342_q\233B\246\020\n\344\370\344\325\346.\344=\207\230\224\344"
+	.string	"*\034j\003\343\364\251Su#\352S\017)\345\216\261\3741`X\3153`\266\206\ry/\352\277\021'%9U\001>\021I 22r\242 \004\302\322q\016PD\235\211\204\025"
+	.string	"\336B\242\216\333\"l)\332\226\242\251L0\251\240m\335\212\026\"`\316\202\250\323X8\256\323@\341^e\374\200GNI]\242\242\374\02484\232i\222\220\341#\243^_\334\202]\027\3240e\313\001\032"
+	.ascii	"\221\263\240\314\300:\217,\265\305\326\2529Xwan\035aL\221\245"
+	.ascii	"-\230{a\343\013\r\233*\330\021U\214\020\004\240:\250\245+X!j"
+	.ascii	"\271 \210\211T\241\004\371\342\226*U\313@\275l\022\346\023"
+	.text
+	.section	.gnu.lto_tryArm.162.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`1\nm5"
+	.string	"\332Vt\023DP^R\007k\215\342W\344\036\334\246\2439\037\217\276\177\020\304\217\237\203\314\204\362B\221W\232'\026i[z\030\316I}\324 :_(\307\001\346\301\032\337\347}\030\254\355\222\340\r"
+	.ascii	"\026dk{\357\275\245L)#\001\f\001.\001S\370\351\254\311_\352O"
+	.ascii	"\367\304\244)\211)\3769\254\244\326t\177E\b\254\326}\200_\216"
+	.ascii	"\306K\275\225\222u\241\361p\376q>\364\370\306o\361\023hy\376"
+	.ascii	"\315\306K]\200\024\312\230t\357\255\305\206\373g\2711\374v\003"
+	.ascii	"\225&\367\237\372\273\375\225\033\217%+\2715\335\320\tg\246\322"
+	.ascii	";{O\027|\353\t\340o\223/\344~\313\376\321\375V\017=v\247\363"
+	.ascii	"S\263\375_\366x\301\335\331{\037\351%\037\377\220\020\362h\f"
+	.ascii	"\002\372)"
+	.string	"\372\020\207\302 \374\272-\253s\354/\204j\375\220PZ\233\223\214L\373\343\353\264\341\211\036\276\262\260&o\fb\362@gl\222\316,\377\274NeaF\2768\366>l\001=\274\265\247\202\215\261\b\210\034\231{\273\"\231H\0053B$\017\017\224\205\ry\341\020!9\370T\260 tM2L\005C{\335\"\324\213M\356\275\377\255+\267\\m\177@\nX4\263b\257Y\241\257\264g\021\352d\025T\355\354\274\334\347\034\320\255\234_\247\275\267\347'4\354\035\300\273\277\017w_\272\007\017\004\376o(T\344\177*i\bdN\255\345\377\366\302;,0\237Z]\253\225\370\337}\326\001\244M\336\366\374z\275\356\317r_\3473\257[@8+\031\373\223\375\345\246\224\371\237\256\265\326\233\005V\353t\226\233\244\245\336\340l\345@g?\313E\322I\372\275\242\316|u\3771O&\313\037\315[P\345\177R\271\337\"i"
+	.ascii	"g\321f\276\372\313\275pn\fug<\260\037\232\252\265\316\267=\024"
+	.ascii	"\337\266\366\355\214\307}\352\314Z\211\373\263['q\177\270w\246"
+	.ascii	"7\373R\233]\351\315\236\364fG\372\272\367\2427;\362\315~l\263"
+	.ascii	"\033\333\354A\302\354@\301\354?\301\354\3057\273\317\233\235"
+	.ascii	"\370f\037\276\331\205o\366\340\233\035n\263\277ov\367\315\336"
+	.ascii	"\302\331Y8\273~\263\3477\373C\370-hcD\234\\\265\233\351\376\272"
+	.ascii	"\346\331kZ1O\036\356\277\356\177\356\265\373?Mi\362\377\342o"
+	.ascii	"\347\303'\266\007\363a\342\257\263bwt\272\303f\350\251\233\226"
+	.ascii	"\b\272L\227\025g\276\256\345f\314f\364\306=\256\222\265\342\266"
+	.ascii	"\004f{\357\007\327\274c7\177\264o=\306r\341\202\373mQ\033\355"
+	.ascii	"]!\212z\006%1\017\210O\036\017\354&j\037+Q\017\355E\233>\206"
+	.ascii	"\200-\210\237\345\n"
+	.string	"\365P\314\231\007\365\023^5\270\376\325\347\323\300\241C\007\367\333\002f~D<<\324aP\323\371g\337\206uP\277\227X\034\017\260&P\304\253Cu/N$S\204\357\334\277\272\270\0275P\025\220\377\313\323\205\200\237\356#H$\267\264\226+\377\252\326\2764Wch~Q\177o\254}\373\305\272\342\346\004]\315,\363\255v\335\264\272\300\331\323}\n+JdM=\265\373\323\203\037\312e\365\007\251\332?\224\2535K}=\250\022&L\350\0270\316\032m\346k\333\303l\370\246\326j\323\367\244\021\223\276L:\267\341S\253Z\253\371n\215I?\334'\233\327<;\2264\223\316\177\371N\215\313\243\211\177d\301{\357\027\017\367\024\310\232\031\017\336\2226\332\213{\341]\224-\017\363EY\343d\334\250\230\271X\256\222\316m\336\340\030sW\314\245\b\031V VT]\250\261\224z1\025\005\003\303\n%3\312\205U"
+	.ascii	"+\253(\03160\254PZa\t]\312\301\003\007LLR\020\214\216UK\252\253"
+	.ascii	"*\345\f%SD\213*\252\030\314( \2372R2\227S*\246X\034M\2618\252"
+	.ascii	"\242\212\212q4\305\264:2\n\340K\031J\346\321\325r\311<\032N\233"
+	.ascii	"\317n\235\304\235\232\332\371C\0252\203w\217\271b\257\357B\355"
+	.ascii	"\201\364;\323\023Bj\251\267\275\243F\346\350Q\003\330\213\266"
+	.ascii	"\375\233Q\241\026\322\236cH,v\3572\013?\367_\325\222\257G\242"
+	.ascii	"\300\030\007\240\321%\302\013\212\220\337\217w|\305\320-4@Fc"
+	.ascii	"\017\025\371\237F-\201\314I\367\257#\357\314O\354\243\230\347"
+	.ascii	"V\\\312EA\342!\310\274*\003\276\344t\371\274\225[\244\277\254"
+	.ascii	"\230\307V\244\277\016)\377\307F\334?\022#\311\377,\322\257\206"
+	.ascii	"\214\313\356\237G\336\232\2039f\240\020\203\032\344\244{\274"
+	.ascii	"$>\313\377\f\322\022\310\210\244(\310@\332=v\022?\371\321@\372"
+	.ascii	"\275\3664\213h\317\\\271+f\213\243\304j\371\237\261\232+|\001"
+	.ascii	"nQ\377\350\200\350\250\201(&\025c\210dD\222\244 \225\306\200"
+	.ascii	"\002\221)3z\021`\275ST$J\246\003\367F\305@7\"\204\377?\322\244"
+	.ascii	"\373=\230\212\237\212\221\017r\312(\030\001\345:\006\023-c\356"
+	.ascii	"@\275P\204\335\035\027\207\2007\360\177\021\005c\237T@\32157"
+	.ascii	"\214X\227\260\330 \024\361\316\373\240[+\f\277\201IN\372\232"
+	.ascii	"\340\3739\003\023\273\372J;\272\313\373\t\"s\373\256\177\354"
+	.ascii	"\205^T\356\204\220C\f\016.\021r\007\335I\2531i\006\007\242\013"
+	.ascii	"\273\001\0200G\310_\320\215\001m\231<a\366(\364g\331\335S\357"
+	.ascii	"\275\367\3645\265\334\363St4:\250\351nP*\252\323\260\307\225"
+	.ascii	"\315\303R\220\210Zp\037\307d\331\244\201J\320\256o\035$\0245"
+	.ascii	"\264w\225\337o\223\232\212\224\2733ZeP\317\263pkt\302\246\355"
+	.ascii	"\247\032\013\273k\3537\211\f\004\016J\213\310\032\231\242\242"
+	.ascii	"KQ\206t\371x\376\235VB<\352\005\035\320%S\252A~L\252\327\206"
+	.ascii	"CR!\210l\025\275\211]\212[\026\270D\234n\372\262\215\322\030"
+	.ascii	"\034=1\213;\347\0029\220\006\260\273asH\261\244\310\320\r\242"
+	.ascii	"@0A\326\306\300\301\312\333\373S\244\307\244o\273\255\023\276"
+	.ascii	"\261\004\317\302\264\213~k0\314\177n\317\226\3179\0262\002qn"
+	.ascii	"AU0#\375\337R\205Z\307b\264x\355\216\274\3353\335\215\222\365"
+	.ascii	"\254boaV\357\357\230M'r\340+\343u\f\031\020\332\204\246i\237"
+	.ascii	"{\022\343`\032\020\013\345-\247a\240K\265\326\272\370\032g\324"
+	.ascii	"\367\336E\253\344NM\354@\267\227Q\314\355A\\\363\246\263Y\366"
+	.ascii	"\023y\276\bK7\233\341\023\344av9\320\224\313)\220P\003"
+	.text
+	.section	.gnu.lto_processRx.163.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\347 =\177"
+	.ascii	"z\300\334*G \314\342\351\223\307\314\373\242\006\263\203\331"
+	.ascii	"|\024\033\217&\252d\317.9\351Q\364R\371Y\257\021\240!\261\331"
+	.ascii	"l\300\355\3421\323\3534\355\001\314o\227^\270\007\272`\001\206"
+	.ascii	"\034P\236p\036\013\r\0256\364\332BZJ)\005\260\002C\002\253\002"
+	.ascii	"Yz\311\334(\346\2700\020\n\272-\030\034\241i\342\210\001\236"
+	.ascii	"Fd \024o\323\346\236\217\007z\232Y&\t\306m\310\f\364\215\245"
+	.ascii	"\013\031\250,L\233\320\204\317\316\242\201S\207\264\255#\202"
+	.ascii	"\312M\021\350i\246sY\326\b\326\001\354\331\3226\247\233\264\235"
+	.ascii	"\273{>\334X\251\323\266R\255f2\013.;\004kgn+}\345\331\202\034"
+	.ascii	"\264Q\333&\231\242\330\266\322-\276\352i&K[\3516\263\247\221"
+	.ascii	"n3\371\311\314\246\245L\332&\300\017\340\n\353\264m\333\365K"
+	.ascii	"\372\331\\\206\0319\005&\303(\360\030>\201\027Y\f\207a0\374\205"
+	.ascii	"\025\331\013w\341D\346\302[X\013#\362\224\017\331\220\0139\013"
+	.ascii	"\023\262\t\214\205\245$F\220\215\211\211\b\001\342C\030\230\207"
+	.ascii	"\257\016\034\274\272\270\2666hei\300\272\312`U\205\341\002\225"
+	.ascii	"s\312\202T\024\324\223S\023\323\222R\022\322\221Q\021\321\220"
+	.ascii	"P\020\320\217OO\3632\227\357O\356=)\220qun\315e\030\207\f\033"
+	.ascii	"\005\203\350\355YiN\201L\225)\316(Pq\036#\345\211\363\tV\376"
+	.ascii	"\234\027\375\232\305,\277v\3249\022\245\007\365[\006\331\201"
+	.ascii	"S\301\211s\0300}M\234\277\364\3619+.\263\220\224\t\022\245\007"
+	.ascii	"\355[*=\356\255\320\205L\234\275tIJ\\r\2512\034\343c\213\226"
+	.ascii	"#E\234\021\227SI\360(\243\364\240D\226NFG\270\346b\304yz\267"
+	.ascii	"\244\007\265s>\274\233s6\274\363\341\\\210\344\003\347,x\204"
+	.ascii	"r=\234M\b2\f\223'\210\336^_3\226(=h\334\022K\243\364\240\035"
+	.ascii	",A\320\203z\340$F\260E\351\361F\357\307\265\311\360\370X\236"
+	.ascii	";.V\211\307ET\332\361\020\225\224\016\342Z\307?\264\351\2606"
+	.ascii	"l\034\314\303\232\376Z#\351\035V"
+	.string	"\260:\2076^\221U\357\342j\354\255F3\276\341L\031\327jd\364,\r)4V\n(\370\025\031/\236\301\252KWu\341\342\030\022\267\370\205D-N\345D\354)\304A\2670\025t\251\351\025\217\262\322Pn\245\237\250\264\023\225)\336$\305\231\252,Q\351\376\224\374\236x\222\223F\352\353#(t}n\264tR\351\232 \362y\221\023&N4\204\207\304\205\232%\364~\340u\320\035\024\272#\016d\304\177\234m\333\026q\037\303\246\242\322\341QA\241#\342=Tz?\354\272\t\205\316\016\316oS\351\354x8SH/\201\206\352t\370/\263\334|\2313T\267c\2514\367\027\327\205\355ruP\367f\211\266m\331\343\352~4+\320\314\315#f\346\301\374T\026\317\020B\270\315\224\212\214\223\366\203\312\345F\375\214.y\362\241\251\023\252cdM\220\006\267\355\327\356\0207u&\333\260\215\246\324\312,$e\200"
+	.string	"9\266\317\007\351\021V\233\332=\357\243B_\317\267\030g1W\244(\371i\276+)j~\023\311\323\361n\355cv\357\262\315.\363\3577\234\035\324\257\314m\246\317\230q;\341\247\337\363\t\223\373\371\3446\223\371L|vo~e,*e\333w\226v\276y%_9\3673\3602?\243<K\360\216k\373\256\222\20769\3459\bm\354\271\340\314\317+\317A(\231\346\362\235\r\241u\312\231\313Rx\307-\277\007\363\240\357\326\327\001A\2206\007\267\202G#<\203vB\024\213\026X\324/T\246\223\177\277\270\3141ft$\265\n\365\203c\033(\313\217*\266\377\232\222s\023p\231\r@\300;\316\237\254\247\324)\324fb\307M\342\267\335~4B\253\016\267\303F\356l\333\3542\237\245y\307\365\177\345\241\221@m\275\222\205\274\202gn"
+	.string	"\207w\034;u\274\033\273!\220\226r\262\365Jf)\264\377z\275\322\361\2172\367_\257W:\374I\230{Ks\377u\226\346\266\026\354\256\340\307\331FK\233k\2703\215\353<\343:\313h:\307pg\030M\347\027\327y\200\353\354\342:\013p\235[\\\347"
+	.ascii	"\2563\213\353\274\342:\003p\235U\\\347\024\327\031\205;\227]"
+	.ascii	"\347\023\327\331\204;\227\270\316$\232\316#\2563\331u\036\273"
+	.ascii	"\316b\327Y\304u\016q\235A\270\363\207\353\034v\235\301\334\331"
+	.ascii	"\203;\177\271s\207\353\314\341:{\3718w\3718s\271\363\326u\336"
+	.ascii	"p\235\265\3349\313\2355\2703\326\217\363\225\217s\006\037g\253"
+	.ascii	"\353\\u\2351\270\363\005w\246\272\316\316\353<\345\316\026\256"
+	.ascii	"\263\324u\216\272\316P\327\371\311\235\235\256s\323ufr\347\245"
+	.ascii	"\353\254t\235\223\334\031\311\235\217\334\331\310\235\213z\234"
+	.ascii	"\211\256\363\320u\026r\347\240\2463\220;\377\\g\237\353\334\343"
+	.ascii	"\316\315\353|\2573\323\235\227\356\354\356\334m\005\312\020\212"
+	.ascii	"&\013\240\217\207\224\266s\327;\255#\023\314\223\336\322Loiw"
+	.ascii	"\201\315\365]\377r\016\331F\017\206,\232\255B\256\367P\025\244"
+	.ascii	"\323\203\327+\236\260\255\273%\007L\372\306\003\243\0308\322"
+	.ascii	"8_\033\274Hk\375\006A-2\356\266'\211\245C\0263k\214s\320\360"
+	.ascii	"=\247\247\315\256\206\357\272;^XX\213\324\226\262"
+	.string	"\213\004H\256e\003#\320\360+2,c\206\277\372\206\313\363\323N\327\3523\274'\362\240\302\254\031\207\3026\216E2\263\217\016\310\242\001c\322\266mX3\331\237\270\bl\032n'\315d\026\222\255\262\325\333L\253\037\253\n\372\0242p\253\352\273\2611|\225\037\206\267\002\334\360Q\276\360k\313\013/\226\207\247E\365hpM\005y\227\265\004r\210\206\266\215\204\254\303rv;\365\316$SW\352\225\205'\013x2\340\311q1W\244\354Y\261\264m\004\221\330&VI\375\032a5\352\245\216\310E\375\224\231\3563\341p\021\003\324;\225\320*m\263\373\364PD\372\236\376C\337\205\217\262\223\223\223\032Fj\b1\275\326+\303`\251\271Bm)\251\202\224\360>\322\3441\343\364H5\200V~d\256SM\016\327L\337\364\203\351\247\252\f 1\302o\212\270\031\261\360\321\027=\250\217p\320\364\230\035sM\244>\312\013"
+	.ascii	"\262\201\363\002\265\002\240\0358/O\255\3305^n\311\227\376\253"
+	.ascii	"\231\250\031R\343[\332\\\342-\312{43+9US\347B\346\376x@}\364"
+	.ascii	"\211\205w\263m\336\260p*\023\2614\021\301\351\243J\335f7\351"
+	.ascii	"\225\334\203\244\237\252\006\031\342I\0251\220Cm\253\233/\223"
+	.ascii	"MH?$\350\254\034\244oFa\376\342\343\236\nLG\037D\002\235\243"
+	.ascii	"\277\200\313%\243w*,\245\321w\240_\257\327J\245\242G\353\242"
+	.ascii	"\007\313\303k)'%\273\245\375t\224\"\274y%\217\273\310\244\217"
+	.ascii	"\262\037i5\030\217;$F\033\332\306\3131\237p\033O\364\314,\036"
+	.ascii	"\366\272\343\335\230\373\352\255\232\333\023\n\275\315$z\237"
+	.ascii	"\023\310\334\006\334\323\203)\232E\252\026\026L[\017\217\236"
+	.ascii	"\266X\336\233W^\244\217.\363\224\tB\345\350\223\fU\205~\310\216"
+	.ascii	"\234\320\367a\265\215\202\376\233<?\b\372\246\224R\004(b\253"
+	.ascii	"\270\263\2533Y\364Q~\316]\240G#\254\312\3519\317\271\272'\020"
+	.ascii	" \267\231@\037T\265S\0242\302\2204(_\336\366\314O#\317\273\302"
+	.ascii	"\37614\322RN\022}\324\215\035"
+	.ascii	"\336s\020:\204\352\323G\202t\350\347\373\217\320\272\346\347"
+	.ascii	"\227\370\354\222x\020\311\243\234\214R\"]\"\364\321n\273\334"
+	.ascii	"\325\266\266Y\0209,`;c\233\341@\032\033\016\030\021D"
+	.string	"\240\266Ft\306v\206\"\003\031A9,`;c\233q#\00266\2655\007\330\206n,\240\346b\002\265\rp\254\251\255\270\221\243\306\004giF\214\346\025\346\005\006\206\026\202\013)G\215\033\022\340\240\3016\301\215\2655\013\322\2048\215\353\306\232Z\232Y\032\003]i\ftM\200\343L\202\256\264\265\034]\\M\254F\301\215\265.65\265\265. \351[/\373\223\364\260!\342\370\366P^&\020\315\263\004\202;M\327\266-\002|t\330M\333\266\007\320\370\247RD\343\233SI8\216\354\330\266\255\001Ay\256\005\314\220\3613~N\306wa\265m[\002\320t\214_\353\373\017\344\276\007\353\367\204\005\004\274\315\214\361Uo\2566`<Z\013\343\277\362 8\023(9\346ZC*9\310\220\212\202y4\362\364\213G\213\362;\036\372:\330\022\246\260U\252\334f\276x&>A\311+\327\031\222Q<0\216U\306"
+	.string	"\357\223*\364\330\017\360\3154\335\214v"
+	.string	"\031#\320\305\267.\336\247\222xCZ\352\274\300h\226\260\352(y\367B"
+	.string	"<c/\300\177\242$\221\001|*Y\327\342\355\304\351"
+	.string	"\276E\235"
+	.string	"\336B\325\356\255\360*\346v\246\352\202\305\034\242\353\365\332\330fw\305\263\200\263\202\016e{'"
+	.string	""
+	.string	"\377\306\331fW\305\003\360\r\027\204\215\212\257\252\332EZ\337\374\237\021\311\026)^\350\017\305\247\360\025P|\247\251\266\222\026H"
+	.string	"e\377\177Mm\346\263\262\357\306<\035\316\245U\302\2421\270P\b\253Sk\343\226v\236\r\262X\376\270\364\321\324J\206\271\344\b\334\212\023\037D%\264\232\370\023\016\351g\342\273LQ\034\2222"
+	.ascii	"\224\370WBX\342\233\321\031\344\212\024\025$\276\365\306\236"
+	.ascii	"\304\377\2321,eb\347M\212\217\246\351\305n\277\310yD\321\354"
+	.ascii	"\341\035\361\257\244\320\251\354aO\333\352\bcw\364G\026q\013"
+	.ascii	"\233\230x\2339\342\373\220O\360\315\257\274\370\270'YF\366\027"
+	.ascii	"\214=\331\231\276\261\227\342S\264\206\031s\202\365\362\034\204"
+	.ascii	"Z\007\225\230\020{g#\342\305\030\375D\374\b\276\277\022!\034"
+	.ascii	"\304\207@A\016\304K\361U\241\266xH,>p\204N\344\035)#\274\265"
+	.ascii	"\022\341P\027g\b\331\207wA\366\313\207g*Z\2078B\337\215\275\270"
+	.ascii	"\001S9\026\366b\217b\372\300>\314\301\200}\006E\n)\033\3571:"
+	.ascii	"G\314\303\007\315\241\364\3607\314\037\005\n\t\024\361\365\316"
+	.ascii	"\206\316W`\210\016?\035\236\314*\244\013\b\016^\317\301\271x"
+	.ascii	"\375R\325\016\313\n\244\362C\327\263#\272\026\266\221\r\303."
+	.ascii	".\336fv\334d\202\327\250\022!-TK\210FDD\024$\005I2\034R\013\020"
+	.ascii	"\006\343X\234\267\324\003\022\240RQ\220\253q\247\246\024$\005"
+	.ascii	"Ic$\003\032\361\336\007~M!\240\027\241\303\344*\325\214C\373"
+	.ascii	"H\272A\362I\362\261L\317\023&\340\tO\332\037BI]\221T\256\204"
+	.ascii	"$(i\330\n\016\347\035\262e\017\362\221?S*;,\314\222\313V\235"
+	.ascii	"\226\366\005\035\270Y'\304\320PF4\007\243\376\264c\"_\304\306"
+	.ascii	"\253IJj\027\354\310\202j\234\t\316\n\225(\325\216\332\272\201"
+	.ascii	"T\f.C\220g\245\361[`\036\275R\035\031\222\313@P]N\002\347\b\303"
+	.ascii	"_\277\357\"\331\205\033\331,%\327[i\374g\212\233\316J\252\233"
+	.ascii	"\263I\304\257R\201\351A\362:A\3031\312&h|\013\352\332\322\246"
+	.ascii	"\373*MC\332\201\240\003%b\216TT?\372|\226\271\2706\302\013\340"
+	.ascii	"CD\013\004\301\300\230\270\254\345\253\251D4\317\240\246P)\333"
+	.ascii	"\322B\013B\376\022\241?n\214b\326\377\332c\236\317\2568\220P"
+	.ascii	"6\032t\206\223\340Ik\266\362\350\340\256\324\323\246\261\251"
+	.ascii	"\300\351\3541\277\371\337\375\365\246\034\206\362\257\275\361"
+	.ascii	"\372\274\234\266{\242\216\202\336[\2423|UR\331\346\240\222\223"
+	.ascii	"+\323)w\031Q\230\242VK\271U\022\303\300\005\266\036\202\322\334"
+	.ascii	"\360\343\325\315\327\216\365\246}R!2"
+	.string	"\247\305\315)\320\324\207\272M\267B'\006\337\357&+\2560|\252\343\237\304\255\364\305\341\021\232\240<\272'\240\320R\253D\226\b\032\334\233\311X^\335q\b+o\311\267\376\372\340G\242\223!3G\364h\313\240\276#\275\272\266\325\361\303\362\350\" e\0079\207Q\317\0331$\277\352\245\201\232d\212\257\263\267\352\021\027&\222!X\232X\026\223\b:\222}A\240\023@d\310~Z\352\tMY\005?(AV\366mW\266z\350]D\006e\rY\275\020yO\234b\306\n\240n\211\317\227\235\0376\223\207\330\222JjE;\305\200f\023\314|\213H J\265\220\336\302\353\314\\o{\023\254i\027\230:\tW-\231\034\035h\002a\0305\377&\034\326z\310\336i\230SK\365AI\340T\274c\317\325\222<R\221rn\016\021+\211\240\034\t%\023\234\366\263\265\030nk\206\"c\2249\032ew\224\227\f\222"
+	.ascii	"i\322u\222\272\303w\265\034jv\021\267\225b2\303\244\325\240\230"
+	.ascii	"$\222\004\013\345\227\360G\222:\324 ,W\0346]\177\262Xc\224^h"
+	.ascii	"G\350\277\372\221\252\004t\253\216+L\003W~o\353d\321\300\034"
+	.ascii	";\322\206\210uGE\340`[\276\337\252\227vZqY~k\214\323\355\325"
+	.ascii	"\025\266\337\240j\222\033\314Q\277\341_\224\013c\215u\230$/\371"
+	.ascii	"Z\305\337\006\236\037\261\326<% R\f\264pY`\202#^\354\203\007"
+	.ascii	"J~\3734\310\247\367}\212#Y\237*\304\213\366\271\204\265\370\037"
+	.ascii	"\006\026\320\356\217p\201\376Vc\331T\332\364\317\331\255\343"
+	.ascii	"\304I)\205\212\027\223\035\224l\2566q\245\006\206\025|\257\360"
+	.ascii	"v\235\300$\256M@\233\277\207\234?\205\314\320\377[\346\335\f"
+	.ascii	"9z\304s\230\351\362X\205N7\252|\362\016\002\022\313D\247\230"
+	.ascii	";r\210\357\373!\271\"k=\327\373\35038\024\n\027\370/\350cmd\257"
+	.ascii	"\006\3076\271\222\301\031\304yY\303\301\340>\347+\326\201\263"
+	.ascii	"\310'\306\204\016\252CS\317k\261\177\224\333\232\340\0250UYb"
+	.ascii	"\377\304\026d\261\214\225\204\240\314\332\315%\230Pig\354\237"
+	.ascii	"wQlg\312\366P\032\250\037\250\261$K\017\003\215\301\242\233%"
+	.ascii	"\220\024\347\357\240\370A\337(\323\224\232]\334\""
+	.string	"$'sm\251-d\261bl\355\031I\330I\251\352\206\313\247\372E\347\021\251\265\250\357n\240\217#\001g\302o5\325\237\002\370n\232}\344\304D;\2147\256g~\201Tg\311_\354Is5\230p\371\235\360\375\224\212H\347/Eu\222~\273\222\ti\023\270Tx\267\007%\034\255g\023$\2006\264\021\366\372\030\f\273\276l\006\233\267\254\372\001\223w\251\347`\231V\177\332\221x\344W\367uw\243XE\036\344\017\372\016\325\026\270\240\024A|\0314\306\337\265\211\030\037\370@\244\263]0\3055\247\321}\003\222\017@\332\356\216k9\340\016\024\n\342#\230\367Q\246\320D0. h\257?\202\232\035\t2\n\346\351\320\322\252Y\252A\021%\222\257{\tzX]\267\004\355m\016D\213KLo\003U~B\335\225\301\276\361\"\243=\330\222\241#\365\003\307^\001D\364/\364\001\305\\\20650\357\310\262K\001"
+	.ascii	"]dp\r\347\360\177\316"
+	.string	"\n\273\255s\276\224\"/\266\233\347}\342\255\210\3176\302C\215\243\327sA\203\026\305\324\352\360\316Fq[\016Kt\2251\367\013\332\274\200\254\326\225By\374\236"
+	.ascii	"\\\234\341\321\373\374\310R\033OS`\320[C4\375_b<\367\\\356\016"
+	.ascii	"\245J\260?\004"
+	.text
+	.section	.gnu.lto_taskGyro.164.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\210\006\325("
+	.string	"*H\350\017Fp\\N:y\204\322j\224L\226\370\005\360Nu\257\370\356-+W\363\233\270\206h\274{\025\223\327\312\252\205\277\356\364\013\330\342\213k\310y'\022\332\2143\317\302\362!\215\200VXY\344\277\255\255\031\261\204\020\271\223\f\351"
+	.string	"\337"
+	.string	"\352"
+	.ascii	"\354\3130$\313\311\220/\253\361\233u\217C\214\351\303\355\336"
+	.ascii	"KB=Jtf`\222\304\274F\001\270k\367Wq\314\037n\367\256\017\216"
+	.ascii	"\262\022g\340\221t\313|\261\217!o%\352\001\356\375\n\373r\357"
+	.ascii	"\n\201\217\324\243\274\236@zT\375\200\364(#\231\333\276\026\271"
+	.ascii	"B\246\025U3\356\336;l\"\334\026\371\237\257\307Swi\020=\033h"
+	.ascii	"\221\374s\310\330\331\022\313\306\177\t\274\262\200\334\007\344"
+	.ascii	"\207\355yem\235\367\244\217\253\247\00370z\276v\265u\022\260"
+	.ascii	"Z\262\374\223\253\036v\267\273\240\200\n\\\n\300\211\326\203"
+	.ascii	"_\273\342\362a)-\332\033B\305\314\022\213\307\317\263\302X\230"
+	.ascii	"\221 \326\215\263\263\234\231y\363\266\nk\312\266\252u\340\332"
+	.ascii	"\225\217\223\350\336\373\346\023<\271\nb\355\356\302\275\227"
+	.ascii	"\355\022+\353\374sf\246c\346)ft.\274D\264_\022\323\243\266\201"
+	.ascii	"\350XI\332:f\320V%\250\277\336B\027\2036\346\032P\277\354DI\313"
+	.ascii	"\207\201v\300Y\244\314M.\354\227@\375(]Sm\203\255\031\\\227\334"
+	.ascii	"\333\265|\230W)\333`lM)c\270\277\230\217R\313F<\313E<\313\007"
+	.ascii	"\206x\226\205\204\267\362\007\275\354\f\364\243Z\016\252\226"
+	.ascii	"\201\252\345\037j\331\267\263\334\333Y\346\355,\253\251\345\335"
+	.ascii	"\316r\272\263\214\246\226O\324r\237\226\355\327\363\033(\030"
+	.ascii	"[\305\346\304\230V-g\275Vu}\256\0334\f\223\257\177\031\377\354"
+	.ascii	"]\230}\fu3\276\226\253\371\204\254i\302%v\357\365q\331\302\206"
+	.ascii	"\313\026<\227\342\247\241E\235w\213,,N,\256C\231\244\333\247"
+	.ascii	"A\035-J\270\336\254\213\331\241z\022w\224Y\374\f\212\331w\364"
+	.ascii	"\307\362f"
+	.string	"A\340\322N\013\362u&\330_\274\353\263/\205\254M\332\273.\300FE\227\204s\245\024\355\264\021\250!\260\314\0338\330/\321\336\3610j\240>\033m*\2718\355o\376J\224yV9\267\2426ja\036\241>\320E}e\023)[\307A-\324\037\352\003] \017\025\335\273\034\255\363R;\217\255\214\2168p\\N\224L\263_\332\320\364\033;Y\264\240\r\306\b\224pt=\324\302\256b2|\245\224\237\346j\224\370I\330\303\207\017\351\321\243\"x,Z\233\030\003;\306\302\316\006\343\317H\273\357%\264\314 B\330/\273C|N\033\230!\"\002\226\271\204\t\373\345PCuI\265\r\016\232\301\271\311\275\035\255ml\355\274\367\336n0\376'\254\2519\002d\024\251m&\262:Sv\216\231O|\f\n\365\336\251\t\3740\027\223\202\237\344hL\347\026HE\247\246\247!\f\243\223\223\221(\264\364\245\247\027E\r"
+	.string	"d\214(>-\251\2101\302x\204b\361c\246\b\023\"$%1Q@\032 cD\321\251I\304\023\214\342\3618\203\bd\"R\361h$\246 \256\030\022W\fa4-9\r\211G\031C$!\033c\024\217\303'\243\3618\364\255\311\367\027\253w\234\270I\266\324\217\201\r63\322\t\022\n\260\177\035\354\253)\271\200-\304\246l\002\324\277>\311\3440\223\373\"\367\266@\013\307\322w\252o\032\314\037T^lP\377t\325\231\373\212,\257\214d\"\247\330/}-\301\270U\245\310\035\255\237\276\220$\323K`\231\221W0\330/\231HN"
+	.ascii	"\216\262&\257\301\324\006c\233\036\365)\354w\325\331\274\327"
+	.ascii	"G26Sv.N\257\213\214\354A\262C\207\372h\r\257\337|\371\366+\245"
+	.ascii	"j\363\372n\3246\242\263\225\264uj\nt\t\200\207\250a,\205\234"
+	.ascii	"C\b\321\210\210\2104I\322\001p\002\2219\273\016\021\300\275U"
+	.ascii	"\234\264g\336\377\222>\244D\237\370\353\254\231o\016\200;\257"
+	.ascii	"y\252L\266g\025\027\302\005\255J\322\305XTv\016\332\235\203x"
+	.ascii	"\275\334\345\310\241hr\207\276\217\227\005\362\202a\217\r\025"
+	.ascii	"\241B\352\205\022]\214b&\365=d\020\304\235`t\016\320R\363\030"
+	.ascii	"P(\314 B\322s\301\241J\274\232\3221\216T\304\260\276\020\020"
+	.ascii	"\2321\277\253&|\022\025>J\226C\033\206\322\255ib`\363\355\025"
+	.ascii	"\030\213\2277\336;_\267\003S\240\276\301F\240\205#\027\023>\305"
+	.ascii	"\357\021\332\323\303{3\303\236\272\332a\327\307\227\226\321:"
+	.ascii	"\277'\0227d\312T\357\330o\315k\353\375\356M\"I\2301Rd\020\305"
+	.ascii	"\273\352\016\3606\360[\344\223\346L\302\013ve\2035\242]`q}\034"
+	.ascii	"N\256\370\311\033\252'\237\275j+Ih\311\372o\322#\352\341\375"
+	.ascii	"\310\022&\034\013$\274\351\267\344<\312_\321\005\020\321\036"
+	.ascii	"\253\036\271$t\310X\206?"
+	.text
+	.section	.gnu.lto_calculateThrottleTiltCompensationFactor.165.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`(\002\035\022"
+	.string	"6\343zH\340\320(\035\367R3\332\237Y8t\313|\313\315x\355\355'\001\214\354\001\236\340\235+n7\231\274\002\246\326\372s8\214\314Q\352\235R\177\254\020\350a\336#\375\241\216\352\372\234\020\304\030<I.\020\007\360\033![\312\224\002f"
+	.string	"]"
+	.string	"d"
+	.ascii	"&4R\252\366\002\222\326\177`\274s\342$\r\3159S\340\003\246w\266"
+	.ascii	"\375\236\243h\331\266\224\214\f\255\001\017\321\214\n\034s\316"
+	.ascii	"\017\365\020\357\235<\210\367nE\274u\271\332\362]\227\257}B\216"
+	.ascii	"\317\215\230\354\346+\021\334V\3308\311bdH\315\210\330\201\256"
+	.ascii	"42\230j\251d\316i\215\311l\356\356\266%\330\316`\253J@\377\216"
+	.ascii	"\321\211\027S\221\354\231K7\204}9W\307^\365\307i\367\351?\177"
+	.ascii	"\307\252M\253.\255\332[u\247j\271\352]\265\256\372\002\002\034"
+	.ascii	"\t\311\356\343b\316\232\\\216Y\324\261 q\332o\337\004\227\362"
+	.ascii	"g~\315\036&I\251\323l\373\264\231Z\224\203\247\305m\316\231\340"
+	.ascii	"\235-\230\336\262=\354\245nw\275\375hBn\267\037o\035+\267\303"
+	.ascii	"\315$\2754\347]\211\033K<\310\310\347\264\247\035\365R$\353\236"
+	.ascii	"\366\270\221\b\2469\003P\333\2561\266\335\203\020\214\331\264"
+	.ascii	"\234\363e\340k\203\032\3641]\324\270.{jo\340\240\217}\377\001"
+	.ascii	"\004l]~\355\003\202\214z\276st\033Z\030\257cQR\304\210\321#?"
+	.ascii	"!(\252N\"\210'\243\2140\030!!Aq \002\242\"b`\255B\221\002\013"
+	.ascii	"\\\021O^X+\227\026\020\202\310\262Ra\305\"\212`\250\"\242\254"
+	.ascii	"\022Y\205\240\352\202*\345S\245|\254\225\223\226O\025\276|\""
+	.ascii	"\005\f\272\254\302O\004\301\360\363\230\315\313\271:7#\256\203"
+	.ascii	"\276v\002\373\261\246\245\261mZ\227\274\026&K\373\261:c\304\201"
+	.ascii	"\345\310\250=\310\345jx\033   \002b\220e\345\001p\316\343\261"
+	.ascii	"L\\\213\247'\321\344\\\317\016\275L\002\021)\013\322\377I:\206"
+	.ascii	"LD\f\336\001\320\321\020\346\006\t\323b\021\304\365\225\fH\305"
+	.ascii	"\261u\362f\\\3616\023ZAc,\253z\261=1s D\026\327\2404\207h\251"
+	.ascii	"\301\3522P"
+	.text
+	.section	.gnu.lto_taskMainPidLoop.166.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`=\016\315B"
+	.ascii	"\232m\030\030DP^R\007\177\206\203O\372p&\302d\023\b\367\352,"
+	.ascii	"\307y\274Y\356;\003\377\232wQI\332~}F\341\260\3728r\260\265 "
+	.ascii	"\f5\2000\362\003\203zn\333}\257K\365\037\022\263\250\245\225"
+	.ascii	"\330\275w\222)\005e\001R\001~\001\315ls/\333\334Ann\345\347\006"
+	.ascii	"rs\377\fs'\205\271}\204\271\221\302\334=\237\373\350\3466\272"
+	.ascii	"\271\213nn\242\233{\330\346\026\266\271\3356w\333\346f\331\334"
+	.ascii	"\317\346\316\237\333O Y\251\242\301\223\343{6wq\214k\236"
+	.string	"\330L\233\027\347U\367n\257\312\233j\277k\307kcU\226)_\342L`\257\202)A\357b\262\"\017)P\222\030\360\266+\f\275Mf7vW9\231\362\334\355I\\\t\354u-\374'\216{\330]\211\343;\004\3354\364\266\357|\351z;t\245\353m\303\335q\374\256-\036\222\203#\326\304N\034\307\315\377\341\260'!\035\031\025\021\r\t1\227AJ\240\237\244\017\262\347h,\022\207B\267e?\303\355B\tvN\234\226==\251\316\221\352\224\344\243\272$\331\210\316\213\350\220d\2429\037\232;\222\205\342\234\031'$/\341<(\277\2712H\006\202\003\222\177\334\360\336r\022\256-\373\2549rM-\367\244\3711\315\316\227\210\220\345\310\306\245\0352\320\274H\324#\2731Ds\"dgYh,\023\323#\303\221]d\231\224\b\031\216\334\352\221\241\261Jq\034\273\310,\r\177v\031C\310\024Y\026e\237\374\260"
+	.ascii	"\272\235\347\261\262\260\234\205\022\3428\356<-\223\341\r\300"
+	.ascii	"\2733\203\356\006\321}T\013\355^\\\370\331Gu/\351W\256\373B0"
+	.ascii	"V\356\273\026\264\3019\317q\034?\333g\353\004H\336\352\035\317"
+	.ascii	"\311U-\373S\375\330\225\333~\026\353W.\373\355\273\330Y\324\267"
+	.ascii	"8"
+	.string	"\227\253\n\026,\270\336\262/\344vv\347\277=\317\263\264\225\013]\245\2534\231Z\333\212K\321\372\250qG\270^\301\204\3051T@\376\377\037#%\022\315\327\246\372\374\276E\352\347\324G\207\352\333\253\270\025\256\366\267\316\240A\203\353\255\317\336\0314_Y\226\231\225\336\301\355\306\362\220}j\365\256\0315\354\237\331\333\360\370]y.\327\377\350\243\352&,\343\351\356\017\036\205k\030\3071U\373\023\207\022\242\375\315\333\0261\"\373\324\333\366\021\317\334\253\203\346kwY\365\220\271\352\273\267Jd\237\266R\330?;;\0214s\307\032\347\300\356\273\250\263\361\263u;\033\177\217n,cn+\257s\2572\346\246\022\346\236rs/\030\346\226\032\346V\340\346N\300\346\216rs7\331\334Pln\004l\356\003\305\334\006>\367\323\347.\300\346vbs7\261\271\t|\356\001ln\246\317-\340s\007\370\334K\305\334Jln"
+	.string	"\237;\351s#}\356#bn#\257z\027\265\271\211\332\334C\303\334Bn\016u\336;\331\247Ho\364G\017\204fJ\031\261Ah\277\201y\354\025|\221\247\357\365\tG\243\256\267F\357sr\260\231k\363g\246E,.L\320_\r=\254\227"
+	.ascii	"\315\201-\364X\317R\021\033lc\275\036\371\270\373\241t'\227\350"
+	.ascii	"\217H\336\235\334\241'\332\222]\\\271\2600\364\316\267\327\200"
+	.ascii	"J\\\005\350\331\374\\\350\335\207X\216\346g\206\302/\306`\030"
+	.ascii	"0\\o\205\236\311\255\316\317*\330rp<\323~\230\357\214A!\373\224"
+	.ascii	"\371\017\250u\034\314\365\252o\240B\361\374\007\212\365/\271"
+	.ascii	"\374"
+	.string	"\254\352\236\207\361\240_\n\006\371\225y\231\001\033\211>\2511\344NP\2339X|j\314!\225\237\005\250\374\343\236U\256gA\006\272\001\243\375<\220\325\377\274\322\340\2655\327\333\237'Z\327\2160\0177\371Y\260\016\357\203y\f\3438\214\252\235\317\343\300l\360\017\330\315\315\3656\371\313\275:g\216 \3163\030\316IC/\316\201qN\326\031\306\246\"\260\221\350?\005}\236\215O\255\310\357y\237w\251Z\032W\323\002\226\203\347\3409\327[\344\023\317\216\337\363.6\250w|\246\333\231C\351\013<S\004F\264h\374%\235\361\213\202-;E\r\034\261\370>q`%\305\027^\331\036;h|\303g\033\343\304G\002!\2760\215\032\375\347?\251\211\241!t/w\370\3075J\271{\002\205\354\323\341\273t\324\250\373l\001&\276J\250\330r~mX\221\242\213\302\027\n.\016N\023_\312\316\212\242\212\232\232\312r"
+	.ascii	"\245\364\352\260\225\202\213"
+	.string	"\303\227\212-\247\223\205VOkAm9\273\264Dh\221hj\221h\252\340\032\221\242\251\345\364jB\ru\327\212-g\363\253\253\313\3314\336A\375{\364\020\320\316\f\364\243I\310<U\244\304\226\334;\365s\f\314\364\025AZ\360\016\244\352&++\305\261_\271\335\257\222\327.\373t\301\177\240\206\375\323\217\362\233K\305-y\243H\311\031U\327\212\374m\342*\310@r\220\267\311\373\344\215\022\305\365V\001`\032\321+\005\320l(\001\225\004/E\215\002\326\320\213\205^+^y\242\260\364\210\372\013d6?\353\315\322|)/;z\0352T\227\367\013\025J\270F\265cE\020&\rA\236\206|\240\314{\246=/\3438\360\3043\257$n\347\336\366'\267|\266\026\2329Iv\032\007s\231\236\230\r*\261\276\350\307\272\r\274\031\230P\233\215\2477\200!\037=\322\027P\363\262\311>}z%\351\027\220\222iz"
+	.ascii	"\357\364-\237T\215\3003}\323\033\321\261\220\007|\367\373\346"
+	.ascii	"\345\313>%\360E?\340\217\232\210\r\nx\2467\242#\365\013\360K"
+	.ascii	"/\340\207\324H\207D\003\274\233\246\364K\357\r"
+	.string	"\225\313\300\032t\216\221\311\336\276W\316\373\367\376\271\336*=\204\275\274\244\007\360?\005\215\324\017\232\257I\357tT\253\334\375\006\2012\250q(\206\025C4#\"\222\202\202$i\ra\005\204\030\006\245\274\003\0210\261C\314\325P5\006\304h\035\024c\274\r\027\027\021\300\362\371H\350S5\203o\364A\220\256\232H\026\263T\217\361\305\332\267VFa\241\r/\251q\022\366\003\316=:\003\216Kxi\323\324\261\270[\335\332\360\254\260\301\253\240\322\244G\022&\3621\245\221\221sJ\022\030-Q\333@`\271\021un\2318}Nzz\026\237\300\235\253\360\274\265\236\320\353\257.\300\252$\264\343\030\313\372&^\231s\270\037\035\\\311\320at\033\004\234\270;\2651\204\2463,\247\235\217\201\f\200\321Q{-\300\3373\201\326U}{\331)}Q\027Q4\020\032j\213\213\354\257\336R\233\207\237\t\335\370Pa\201'"
+	.ascii	"\020\267!\017\001\021xI\333\333\016\020\221\200\247h\301\246"
+	.ascii	"\235\273\305\244J\266UY_ \364\273M\017#\374\357\202\007\003\201"
+	.ascii	"k&\263\020#}\233\205\361Ux\240]\223\177d\006\fY#a>\013[\032l"
+	.ascii	"G\314\320|\271\035\002*\363F\270\227CGB;b\227\306+\rXf\205\262"
+	.ascii	"H\366\274fZm\r\317t\344\375a\301\316\031\002\276\300\021\332"
+	.ascii	"\221\377\207GI\326\004\302\303\254\341\376Q\217;\217:\2244\212"
+	.ascii	"\221;vlBB\334\360N\263\217\256:\"\325\255&\305f\330q\223\316"
+	.ascii	"\201\234\273\305\331\"WW\f\243\371\2431M6Y\024>\036 /4HyG\006"
+	.ascii	"P\320\324VL\376m\371;\327\233\374\227OXri\206\232\006N2SH\346"
+	.ascii	"D\215\334\206\243\334\263)nF\350\t)\356\2377\244\2262\201\345"
+	.ascii	"\005\200"
+	.ascii	"\002\035\262\013\031\3236;\317\361|\230\247\374\324\341\236\314"
+	.ascii	"\033\240\303\263\350\244\303\361)\375\221\244\264\016\303I\311"
+	.ascii	"&]\222u\261\230\001\342\271\030\203\240\214\366/4\243x'A^r\034"
+	.ascii	"\233!\240+g\205F\254]\354f\337\211\177\345\324\263\240\016\320"
+	.ascii	"\205O4\202g\177|]I\177\314\347_\374\\\221\376OP\306)\260^\306"
+	.ascii	".\300\203\221\206\256\377\370|\231\374\016\221D\256\250\020\\"
+	.ascii	"\352\0371\003jg\305N#_\321\325\233\301,\377\221\3102\\*\031p"
+	.ascii	"S\236D\r"
+	.text
+	.section	.gnu.lto_taskRunRealtimeCallbacks.167.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\345\007"
+	.string	"\022\21789@\217\322\001\200m\250x\236;\r\232\023\260\rUe\210\023a\321\002\200\200\205\030\243\301\211\325^\001\343E\021/\376\325\243\017!^\234\331fP\261\007\336\322\001\373%\177\357\224\002\036\211\016D\2326B\310@(\207\315TjH\2356J%f\200g\266Qn>L\222\234$y*A\230\344\244(\231\205\314ElT\2468\216\312O\335o6~^\020\331x\301TD\013\303\224\020\327+f\341\214]U0\266\354ovw\035?\033Nh\2600\274\263\270\354\262jh\266\005S\001\261\375\217\255\360\241\035\332'yIw\023\212\013\354~+\256\335j\340\002\3171\327\017p\216y\016\342\034sg\277\274vlh\304\343\002Efwe\344xw\330\371?9\300\312S\035v\022v\327p\345e\334\361\266\tl3\330n\005\b"
+	.ascii	"\304\263\240L\350\324\013\034\027\332]\306\373VS\300]^\264\223"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_taskUpdateRxCheck.168.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`~"
+	.string	"\205\n"
+	.string	"\326SKC \307*\035\200\244nQ\004d\316\225\001\2622)\356\361l\n\236\225\242\363\243\321\005!4q{\341h6%\f#L\361\226\225D\fa\306\001\244\226\001\213\n\354e\232\306\006\005\302\262\016|\253\334h\357\224\0027"
+	.string	"8"
+	.string	"6"
+	.string	"\021\334\253\346\034\356\325\266-\274\321\256\227-1\210\230\003%\004\"\354\226\035e\271\353\323\345\177\3005`\n\n\220\262\327\247\002\306\356z\2222\223\233\336\366\204\355\016\333\016\002\261\t\022vAE\360b{\2647\266\350\304\243\345\005\214\257\205xaW\345f\333]\21774\257\235\214\210\364\346\264\017\340\001\306\323D\376\260;3`\333-=\246\320\274\272|\2643Ba\346&\245\223\332\254\326<Yi(\205\204\276\334\202\251\200\200\302`\347\315._\223\256\330\317\354\356\232\316lO\327\327~z\332?\271\206\007.\262'h\260\033 \3524\"\255>\300\f\007\227@\027 \317+\205>\034\025\007\210:\215V)P\024Y\037\203\277\017(\206\237\307g\352>S\227:\221P\335'\252\272\217\204C\020P\354Va(v\233r\357\032\f"
+	.ascii	"EeO<\013\312\f\b\303N\302\345\2256\307\205[d\254\343\224\r\320"
+	.ascii	"\204yJ\214\351\232d"
+	.text
+	.section	.gnu.lto_taskUpdateRxMain.169.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`["
+	.string	"\215\t"
+	.string	"\246\022E; \261\322\001\360\332SB\036GM\300\221:\363\200\203\003(\004G\np\207\203\270\356\b!c\307\321\371d\212\nR\260$\250\t\241\003\2012\234\"\\\202\260A\252\364\037\334h\357\224\0021"
+	.string	"2"
+	.string	"4"
+	.string	"\345\013\272\327\316?\335\253G[\346\345\307\202f*\032&5\273\353Q\217\217\237\243\377\221\007\2201\327'"
+	.string	"\303\356z\2221\216\233\336\366\201\355\007\333.\001>gw\327Tf\277\366\317\332\252\3016b_y\331\205\345n\226\245\246\204\330\276\307n\210\031}\332\247]d|\355\342\003\2732\024\333n\231`\204\316\253\003/\212\341?\325\371$/I\371 V\261\346\311W\237\325\275\022\300\320\274f\316-Z\013gNjWX\314\2236\310\240.\317\223\231\r7\263\323\306.]\223v8&\211\024D\243\021i!\364QE\200'\023\304\n\005\212\"\353\023\360\027\002\305\360\223\370J\336W\362P\246\211\223\367\211*/\004rH\001\212\336*\fE\317S\356\251\314\016\263\033\356\026\t"
+	.ascii	"\304\263\240L\300!\236q\\\024}\206L\227\241\277\325hp\227\027"
+	.ascii	"\355$\003"
+	.text
+	.section	.gnu.lto_getFlightTime.170.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\035\t"
+	.string	"\346\221?6@\217\322\001\217\364M\317P\352\205\355qj\200>'\t\213?\343Z\3379\202F\332\366\271^\304\320\320\353-\246\031\030C*\375\274)\274j\337\223\273\300\356M\244L)0"
+	.string	","
+	.string	"0"
+	.string	"!\235\315\302\274\216T\201j\2454\342\262\273\331\346\003\361\020\273@<T\216w\317\316\377\352\013&-\024\323)\364\314(\354\256\323t\272\270\365F\260\377\2375\032\233/\333\013\245n\330\307VQ\266\246c\246a\246\365\351|\372\031\200W\352\364V\311\256\305\367\262.H\342a\273\2635\276\352\001\n\025\203!}DU\375\352\001'\244\226\324\250\316RL&\345\237xM=\td\224\237}\221{\037?\345\tP\336t\350\203\342\341\325@\005C\224\001\3268\035n\323\0304O\246y2\b\207\206\207L\343>\031\207\300[D\207\313$\266\215\3134\336\036\273\242\240nD:\262Y\037Ud\270\326\t\337\307B\261+:\320\r"
+	.ascii	"2\203\360\304\320\374\250\376p\326)\233/\026s*\273]\023\0050"
+	.ascii	"\241c\306&\356\2124\033\036sp"
+	.text
+	.section	.gnu.lto_fcReboot.171.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\030\001u\f"
+	.string	"&UPB0O\224\016"
+	.string	"\200\2437\240\022\f$\206`\b\026\b!\325\323]\304Y5\317H\302\250\206f\363\273\327|\254\363okFw\263w\313\310\202\231\004\2528\301\227_\313\275}+\215P\3364\226\220M\266L):"
+	.string	"="
+	.string	"A"
+	.string	"\"\026V\314\330\335-\2160\246\3373L^Q?\337@\207g\036\216\t\270\334\370\245\201\033\217"
+	.string	"\300\323e\331\335w\\1\200&\325L\301\356ZQ\340\206{r\333\037\333\f\354;\b\0329\354\313\013\"\036\216*\373\253_NF&R\031\300\267\370\330M\325(Y\027\222E\t\333\247\330\013@2\252vF\363}E\252|$d\025\262\313*\340\001\223K\177v\214\263Hl\005E\213E\216_FU\204\321\207\313\003\322\342\020\252\307\2110\232\204\311\310\251\200q\322\226G\0324\315^\374\203\331\223\302\251\004$\222\021J\265E\025\364([L\261\344w\\\373H\021\202\306\310*\211\315*\005\3460\0070\032\r\227\340\022\300\343@\330\314\006\24199\315\335\205\343\315\356A\327\331\272\316&\301\263\371l\235\007\332.\025\317\t\034o\013\315\351m\224\314\217*gF \202@\013D\270J\362\377\332\335\037"
+	.ascii	"\221S\320\360B\371\344m\277\r\0023\3463m\200\273G\301\b\216\223"
+	.ascii	"\n\203\313\340`2\220\322\021l\305\304\247\352\0344\003K\200\276"
+	.ascii	"9w\374\323\334ZZy)\314A\273qP\261\b\022T\216\233m<\245c\250\246"
+	.ascii	"7\241\224\001"
+	.text
+	.section	.gnu.lto_updateArmingStatus.part.0.291.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\264\025\355F"
+	.string	"Zm(\030@@\336N\007\327\361)#d\023\340\207w@_\001A6`q\234\3645\336T!\220\036/\260\003\201\250*\030\006\355\007\370\025j\340`\261\274\270\251I/\370\253\370\013\376b\350pom\313-SJ\001{\0014\001\200\001"
+	.ascii	"\2128Jq|\353\256^T|\020E\237`\272\376\341%\033u,\356q|\337+\324"
+	.ascii	"s_=\311\365\254\364#\267\275Q\370\265\245t0\362\220\362\276\357"
+	.ascii	"\262\335\352S\024\324\321r\253W\275\275\232\242{\331^\225v/="
+	.ascii	"{\224\356Nq\327\322\356:~\375{\223~X;+\216\357\373B=\343 .u\264"
+	.ascii	"3\2632\2621\2610\350\023\354\313\253\213kK+\013\353\312\252\212"
+	.ascii	"\3129%\025\005\365\344\324\304\264\244\224\204tdTD4\324\024b"
+	.ascii	".\203\200\224I7\267\370\323\244\355U\257*|3\245\3169\232\035"
+	.ascii	"?3\253\343et\346<\331\230\2348/\206\r\354\303\223\343ap\036\272"
+	.ascii	"\210\375'X\242\177\2419\363^]f\234\253\f\342oi\221\361\254B\302"
+	.ascii	"\307\272\362\342V]\024\357\270|\025\025\320\213\300>\274-\356"
+	.ascii	"\324\222\345\247\264X_**\311\206\005\362N\037\336\024\207\252"
+	.ascii	"J\371\247j\224wj\202\342L\202O~I\351\210'\031)\362HGD\334h\210"
+	.ascii	"\220/\"\002\364\241\277\275o\002\362x!\346\016_*\336\351\310"
+	.ascii	"\361A\256x\267\303\255N\225\344\016\307\003Q)\223l}xz\236Lr\227"
+	.ascii	"\027\203j\367\356O\2516<\267]\214`\366,\251,\332$\031F\246M\352"
+	.ascii	"\212o\203\2506\0347\251u\255\363}_\267\372\273\240\322\375\033"
+	.ascii	"yZ\222\355}\337v\025\216\336j\336\215\215tw\205n#\037\001\371"
+	.ascii	"q\024`\236\212\317v\223\013V\021\373\277\357;\207\261_w\233p"
+	.ascii	"\035G\007\343\324}\237f~\267\207\017\357S\307k|tx\2561\244qT"
+	.ascii	"\262A\363\345\261\361}\310\307~\215\323\274}\361\217\356\374"
+	.ascii	"\375\226\277)\344o\267\374=\241\375\226\220\277#\344o\b\355\367"
+	.ascii	"\203\374\335\226\277\035\344\357\006\371\233A\376^\220\277\025"
+	.ascii	"\264\337\t\3627\202\374} \177\033\310\337\005\332o\266\374M "
+	.ascii	"\177\017\310\337\002\362w\200\366{-\177\003\310\337j\371;-\177"
+	.ascii	"\243\265\337g\371\333,\177\227\345o\262\374=\226\277\305\362"
+	.ascii	"wX\373\r\315\337\317\374\r\226\277\277\362\267W\376\356\312\337"
+	.ascii	"\\\355\367V\376\326\312\337Y\371\033+\177_\001}[\345\357\252"
+	.ascii	"\374M\225\277\235\371{J\371-"
+	.string	"\225\277\243\3627T\376~\312\337N\371\273)\1773\345\357\245\374\255\224\277\223\3627R\373}\324~\033\345\357\242\374M\224\277\207\362w3\371-\344~3\363\3672\177\007\345o\240\374\255l\277\223\355\267\233\277s\376n\3637\316\337\337~\273\327\340\3623\304\343}ed\375\274|\331\360H\225\024}\242}\363\256\177x\001k|u\205`\226\252\370\370P\341\252\035TN\224\2349\224S\330\2317\025\230\264\306\245J\\)\034\035L|\032_C\252\204\211\324\211\324\211\353Y\nk-\026\356!E=^$\024\216\222\001u\343\350\t\306;\341\247\237:\025R\215\340\334&\245\303\271L\270\351YH\005\231\230\204\331\242\245\257\203\314*\341\245\237S\322C\224E\302I~\220p\322\"\216qg\350\bKE9\302b\037\003\3334\302J\322\252\021\026\342\243\213\201F\250\310\021K\204\213\364\020\021\0362\207\3608\233x\210\261\211\247"
+	.string	"\363\b\255K\227Z]\241\251o?\340v'X\360>\025\302o|M\302\252\377\365a\374\022\324\3462qtp\261\033x\2346\345\373\326\235\265\303\361E\b\355D<\267\00477\3273\023K\321\301\310\243:%\250\332wu\227\301F\360\220\016\236\367!\233I(\b\264tc'\033\204\227k\202\002\225@j\210^%\006JT\022\346PL&\337\222X"
+	.ascii	"\223PO\321Mz\367\nn\267\205\013\357\323v\326\341\271\366\037"
+	.ascii	"X\306G7\341\222\371\202\223"
+	.string	"\007\211Kd\207\251>\371\313.\366>1.FZ\314\203\314a\206\262Y\310\254\303\271-\316\330\355\362\300\264%\260H\036\033[\354w\305\333\t\275\320\004\206\f\031\\\317Yp\362\334\301]|\332\330\276\016\347>\306\330\355h\320}\266\333\263\270\026\270v\"\035\267!\267op=\335\341I\002\204\\\264\204\210(Tk\b;\01333\323\240\366<\352\270\347\206\250\\\\\2068\016\3208\016P\021\036\340B@\343\242$\240O\246\226\033\261!\n-!'\027\205.\275}\361\217\252+\017\037\323\250\300thT=g3\216\022\315nH\365\350\016\315\224\275\375\243S\300o\270\005\005D27\314\"\373g\002v\303t\023\016\257\357\373\216I\300n\344!]\002\276\2004\003\214X\004\374\372\013\001G\210\204ph\r{\200\261\233~\200\375\021\332\326\331l\326\001nst\200\243\252\317\006{\370d\031\340\006x\030\354\201-\270\243"
+	.string	"/\250\243"
+	.string	"/1\017\365\276\022<%8\274\341\205 \016\237\003\030\301\233\003\331.\003m\224\005\260\001\305\002\217\\lKl|\266\b$B\016\300\004\314\f\300j\t@l\003`\001b\002 f\255\215\275\221Kw\354I{\274O\327\306`\0010\214\314\252a"
+	.string	"\205j\206\326\2534/h8m\013\232\240\325\031\216\37283tRe\206\305Z\206\315\252\224\031\356a*2*}\035\303d\3261C=\247\230o\3610,V\r\233\202:\234\0135\274!\365\024\304\202\341g\023\260H\034\365\265\304\351\205\277\002\275\370\274\357\373Ba\277o\341]\370\201\f.\276\013\347\302]G\270p\331\342\323\026\330\277]\020)\340\373tK\217\223\026\021;YX\0130\013\261\t+\b\321\025\306\372\037W\221w\217\215LC\\+\256w/\336-=\"\r|\237Z\341\201\357\250qd\206\211\210\210\210\202\202$\005\3112\006Q\006b\314PY\325\001\021\3000\244$bf%\245t"
+	.string	"\020\240\363\247-\275A\317\370\226\222\245&v\362\215\353\320"
+	.ascii	"\366\244D\302v\213\254q\346\t\200\032Q`\377t\263\252\336\251"
+	.ascii	"P\\@\251\304s,\024wW\254A7\344x\340\006\347\374P^t\242\355 \231"
+	.ascii	"-\315\376\375\350\2660\211c\256\t\305\2111M\by6\210\200\354\353"
+	.ascii	"O\324\335Q\340\217\026\263C!\362\2520\353\007\030:\374\235C\201"
+	.ascii	"\314\313\n\376X\275H\366C\316\321Q3\332\211\220\354\343Z\205"
+	.ascii	"\016\341l$\333\250Q\343[\261-\331:\256A\207,\030a=\035Q\200u"
+	.ascii	"f$\021\220\307#J\301\016\253\f\027\n%\227\b\243>\221\240\347"
+	.ascii	"(h\2163\205\226+I\r\3231\300\232D\263W\222\016\376\002\211\335"
+	.ascii	"\002\232M\322Yc\036}S)\206n\350\355\333\\\226\t[S\002\257\247"
+	.ascii	"l\241\336 \230\364>\f\363nF8\221\330'M@\321t\255\\\207\r,\206"
+	.ascii	">&\204\0356V\204\326\021!3\223^N\220w\205f3S\316\005?d\206\311"
+	.ascii	"\343\326\301n\323\230*X\213\t\fL\001Z0~%\245\001\313\203m\341"
+	.ascii	"`\204\253\355\f\003\253\302\335n0\006:\335yK\252\020N\211c\020"
+	.ascii	"\017*\214&B\271\301\033\302ro\225\0313/x\263V\3138\254\342|\003"
+	.ascii	"i\220\3739I\270\301\201{$\206X\332\001\025P\246\004\n\307$@I"
+	.ascii	"&\033\342\362\024 \314\02413\301a\371\236M\336\2539\036c\007"
+	.ascii	"\rd\030|0wj\250\036VN`\243\355\205\265p\334q\261y\345"
+	.string	"\3608\004\217C\t\371\032\355\240F\245\035\320\240\036\350\030\251\270\026\023m\235/\034Bx\313\366a{\356R#\201\217\205\2005U\226\224D\360lF;\021_\030|4r\2626\325\214\020\375E\016\332\376\227q\007[\353cQ3t\202\025\242\020\003\021'\2006t\224\227\210\031\033\272X5\216\032\363e:\037T)\314\226\303\303t)\001\331\307ci[)\241\257\345\034\rq\266\230\bV\0245p\277\2723\205$\377\327\200\377\313\236\360P\305\300p\275\370"
+	.string	"\nf\352\264R\177\b\263"
+	.string	"\tb\231\237[.\031\243\215\270\b\306\377\306=T\306\020\220\212\"\313\320 \226=Um\230\340\224\201}\250\366-2\305\223}\203\241i\300~L\352x\003ml\223\337\375\335\027\204D\340DP2u\304\271\374\362c\303"
+	.ascii	"\246\f\354C\265?b\212%\373\020t\376?\307\024O\366\241\332\307"
+	.ascii	"\362\247\255\305P\2740\005\316\307\017\365\324'B\343\366\342"
+	.ascii	"X\\\225\227M@\272$yM\007\312c(#D*"
+	.text
+	.section	.gnu.lto_disarm.part.0.299.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\357"
+	.string	"\315\013"
+	.string	"F\225ND \213*\035"
+	.string	"]"
+	.string	"\203)\260A#\205\307\226BI\004\271^@\216\267\302\250x (k\310\260\rc\021\301X\352\020\352oEb$<( \270\214\356\320g\277r\b\204E&V8\203z\206\006\331d\313\224\0027"
+	.string	":"
+	.string	"9"
+	.string	"Sm\277\202m\324\001\213\366\207\313\036\3545\334\006d"
+	.string	"\261\273\336\247tp\361R9\321\377\354\227\226+u)\341Bp\2458\027\341\261\273\266$\270\347m{l\207\330?\t#\312\237\031c\033\365\330IEV\245 \343\323\037E\033\363)\300'%\300z\355n\007\204\266\241z\231\177\341\030\304\307N\276\3542\260\260aW\246\341\215\345S\363\212\356\223{\246{\030\022j\2536wj\003\b\240oY\263\222)\177\366\027\350\020\241\266\352\323\376\361\2526?v\177\250\324f\311\311\006\366\271\2250{Zl\026\354\032\bq\333\327\344"
+	.string	"\341\343\355\007\006u8:\036\017\250\203\223)\201\246Oh\204\024~L#\223\t\177\234P\b~%\237\310\373D^i\364!y_h\3628\027\006SB\241\267\002\202\241\247\2270\223P\360\240\222+\211\321y\224\316&\201\254\t*\001\031"
+	.string	"\262S\240\375\300Bf\034.,\020\333\3025h\006\226"
+	.ascii	"}\317\271\035\3545\325Rr@\3065\274\331\004\243\013\037\253<Y"
+	.ascii	"-\203*4c\323e\347\002\300\311\213y\247\245\351'\2241"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\207\025%@"
+	.ascii	"\352k\030\027;0\346J\007Q\367\352\177M2A\032I\361m^6\240\355"
+	.ascii	"\033gx\033\313\376\372\343{2\256T\242\204\322\340\213\033\325"
+	.ascii	"\204Z\200\007wC\330\033\300\313&\300\321\341$b\214M\222L2]\001"
+	.ascii	"W\001m\001`\337\203\250|\027~}\367\361\372\366\323\365\375\207"
+	.ascii	"\375\006\344\372\016t~\243\351\255\357\273^\277\325\374\367\032"
+	.ascii	"\255o6S\276\333H\371v\023\345{\017\312w\335\223o;'\337g\232|"
+	.ascii	"\353a\362\235g\311\367\237\222o<I\276\375\262\276\357 \371\246"
+	.ascii	"s\344{\016\326\267\034#\337q\212|\307\021\371\226\273\372\236"
+	.ascii	"\033\362M'\344\273L\220o3V\337p\200|\363\371\361-\350\3433\227"
+	.ascii	"\036\237\327z]W\214\021T}\0176J%\321\345\361\r\267\343\233\214"
+	.ascii	"\216\35719\276\3372\216o\267|\243\261\330\310j5\362\026\032m"
+	.ascii	"\206\372\336\214\036\223\321d(\346\213\321b02\027\372\342\273"
+	.ascii	"\315E\237\265\310N\024\021\316] \213\3576\257\350F\025M\tM\321"
+	.ascii	"\213\320\025E\033b<\361\375\314&\232\020-\361\315\326|kT$\361"
+	.ascii	"\035&\3439q\214\024\215\370\006#\342\373K\210F\003\361\355%c"
+	.string	">\252.\373\320z\036\272\257C\347qh<tC\247\321\320|h\206\357.\030\276\265\344\013m\307B\327\251\320{\320\265\331.\205~\203N\370\374\314\3165O\302w\032su:\331\b\237\3412r]\327\025\302\267\230\354\0307\273\367\240\263\240\030c\246\325\351\\\325`\374\030\343!k\177|||t\360\255\2261\306\005\270\002\215\003\365\360\336&\240\236|3\240\376\364j@=\312\335\200z\212\367P\277\342C=\313\205\3026Q\177\267\017\365nk\341\330\2717M\333y\r\333\376\006\365v\363\272m\347u]\2670\034\324\333\360m\344\032\007\365$\333=\026\366\367\207\002\322\003\264\215\371\250\211\2055\221\336\364v\2279\263\226V\001\351Ml\347B\302B\326\002\262\003\365\360\334. \275\337\366\267F\305\277&\022\003\322\251\332\233Ho\326\275]\t\356L\254{\267\017\2627\333\375\326\250\230\007Bv\246\266+\250)K\344"
+	.ascii	"\273\373\331\313\233\317_\372>\203\341\373\034f\3573\233\233"
+	.ascii	"\317]\332|f\365>w\261\371\354\265\346\363W\336g"
+	.string	"*j>\203\341}\256\222\346\263\225\273\317ah>_9\363Y\314\356\363X\335g23\237\313\350>c\231\373l&\367\371,\3563Z\231\317Y\340>\247\221\371\254e\314\267\343\333w%\267oKm\337\227\304|?\266\237\327\347\347-\266oBa\276\r\301|\037~\371~\275|\027\352\362}h\355\033\021\227\357Dj\337\212\266|3\322\362\215\230\366\335(\313\267\"\332w\342\331\267#\263\357E,\337\221\312\276!\221}?\032\373\226$\366\315x\345{R\3307 +\337\201\252|\013\nO\366[\255\267s\240\036\336S\253\355\246\337\352\327\344\245\304\244m\027+t)P\222\267\025\304\371y\314\342\202\325\032i;\243\215\311y\341A\251_\275\215\375\370\310\320\341\303\324\255\334vAB\317\267\231\272\025\333\206\013\245\016\304u\304o\352@z\260\206R\257:\224\272T\213(\365\224M\224z\224\253(\365\250E\251\033`\033"
+	.string	"\334\335\036f\224\n\230\304\005qB\352\004\330\244\253!\365$b\352\001\\\334(\365\246\304\324\233\024Sg\352\253\203J\275_?\374&\365f\001S\247\302\216R\307r\033jq\314!\036\\\372U\237\245_\261C\334\306u\270\236w\023\226n\345g\351V\355\237\245\003y;j\214\221\027\026\\z\017\267\247\020\007\3510\237\245W\275\200K\257j\t\227.%a\351On\367\231W\034D\314\267\364\246\276\245\267\341\322\231\330\300\003.g\260\253\f\013\036p*\314\347\200\247}\215\005\017\363$a\003N\211z~\016\fx"
+	.string	"\247Cy\223\333\024\n\023\355\360\036(gz\001\241\274\353\372P\245w\033[G\351\375l\355(\275\331\334\306\216\324\266\326\360\035\245G\361S:\024<J\317j\351(\035\353\225r\246\356\223\341S\233\354K*\363`\327\030\035\376Sz\273y\224\356\243\035\353Qz"
+	.ascii	"WN\322\231\346$\275[:I\257B\242\236l\003\270\211\035\233r&\267"
+	.ascii	"\263\233\306\260\311\246\274\335\262)o\026\313\224S\265\331T"
+	.ascii	"\332\300}\2101\240\244z?_FU\365fkT]\313Qu-\026WR=\212\213-\251"
+	.ascii	"\036\005_R\035\n\213\037Uo\342\256\2523\331R\235\t\353T=\013"
+	.ascii	"\323Q\035\213-\253n\244\275\372\232#l.\325\253^Vu\251.\325\245"
+	.ascii	"\274\324\376R=\212m*\252\027`S\252\376\364\202\251\376\324v\025"
+	.ascii	"\325\235\336nBvW\270\332\212\352\003\334F\336)\024\327a\252\017"
+	.ascii	"`\373\212\272\300\013\240\263\r\252:Iu\017L\325\245\336N`\006"
+	.ascii	"V\005?bz\3326\231\036\365\nbHL7\360\266\023\230\013\007/2\335"
+	.ascii	"\211m?\\\324W\007Gbz\223$&#\323\251\360$\246\3479\026\220\333"
+	.ascii	"M\026(\365,\347l\254\270\256\353\201\3243\\\333\270p]\327\354"
+	.ascii	"\306\002\272\202R\317ml\343Cy\332\200\311log\273EE\216m_\330"
+	.ascii	"\022\224\350\321\333\371\316\332\326\211o\243nk_\230P\352\335"
+	.ascii	"\250m\346\231\036\0366L\275\017\265\235\013S\357C\2661#"
+	.string	"\242Jx\206n;([Lsc\330\370Oq\217#\322m';4\273n\303\366\032\027\317{\3276\276\004\350,\317\356m\034\bio\261\216\355<\327Vz\345\332A\r\327\022\246\336mM\267\003\201N\250Q\020E\271P\215\210HR\220\222\244\003\321\005\204)\006\2138\007\021\260$\b\0251DDD$\022\211\356\001\340\031~\227_\333\0249\354}\377F\241\231\370\376A\245g\350\\\260Q4[\3702q\361\266\250\250\036\255\216@\021\035\246\211H\303r\375\2052\375\370\017\326\267p\372\243|[\b\327\200>\343E\244\324q\224(}\b\307O[\354\0234z)\216\307\\{\354U\022\351\2058\224J\235\f\320\200\240\002\333\331\003:c\300,\310A\227\334\026\363qS\314\336\210\031\325\327\226\332\rm\344\370NX\bJq\024@=4&<\210\203U\256\371\263\002\032\\\320\200)\217\377|\237c\200\\\363\023\345\272"
+	.string	"\221#_\214\037\212@\224\013\226\377\200\307\301\310\226:+\031\302P\306\256\t\327\022\244g\224\330\023G\210\314\267YX\025\375\317m\276\340\335:\245\313\353\376\365A\bB\317\317c\217\240\357\027E\354\361\321\2728>\303WD\031\351\b\321{\031y\321l\365\302\325\273\214~\026\354\215'\221\227\323\233\255\237f\032\364\303\257\006<O~\344\312h\210Y\304\364\347\026\242\202P\3432p\276\214\300[)I\210=kb\023k\245\3325\255\210|ty5I\272\024\035g\244\017\272\352R\261\256\243\347\032\330=\316\340\274\227f\340:2`Q\232\376y\005\206\223G\247U\345\302\211k[\325{"
+	.string	"\202\325\031\352T\357[\025\203\243\217Q\202\022\224\240\004%(A\tJP\202\022\224\240\004%(A\tJP\202\022\224\240\004%(A\tJP\202\022\224\240\004%(A\tJ@:\300!\2363}`Xi\231\227y\231\227y\231\227y\231\227y\231\227y\231\227y\271\354y\032\225\307\300\211@\203\265\340\177\005"
+	.ascii	"}\343\322\224\341+\261\315\332QL\033iBR)\325\354\234\354)P-3"
+	.ascii	"/\024H\006\252\211\216"
+	.ascii	"-\256EBgv\311=]\352\006\\\261#\310\220`\237\265\t\350\264\266"
+	.ascii	"\034\020&%\031\r\336\253\250[W\375\360v\020s\027m\251\310\177"
+	.ascii	"\242\005\3160\274h\367[\236\301\005ts\032B\217X\005"
+	.text
+	.section	.gnu.lto_.refs.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`\314\002\r\022"
+	.string	"\226\351wI\300\322M\322\001BAH;\337\355\ru\323\333\244\1778\274\300,\"\300 \220\250\205\030$\370]\026;\317`\232\004A\020\004A\020\004A\020\004\221\270u\235\202o\250\372\037\\{6.\270O\331\377\244\225\202\247\357\235o\233L\001l"
+	.string	"\\"
+	.string	"_"
+	.string	"\"B\360|\360\320\201\203\006\f;:\027,P\310\221"
+	.ascii	"\001'\277\017\262\267\001\220&\246%\037<v\034\3410\202?\215\031"
+	.ascii	"1`\270 j!\024\264\372W\374\370\244\310\337\004\374\233\3546\371"
+	.ascii	"\t\262\327\344\023\310n\313\217\311\376\222\317\242\372\225\354"
+	.ascii	"\260\374W\366\223|W\252\307\324{\331E\362W\251\256\312\236y\310"
+	.ascii	"=\253\372\331G\365O\177\372\t}V\377k\357\332W}\256\227\270\346"
+	.ascii	"H\006\320a\366$\351\\>r\272\031vtboN\374F\210\177\020\327\337"
+	.ascii	"\324\372\227<#\031\254\277(\306~P"
+	.string	"\214\337\337\023\377\306{\233\330g\276\277}\037\343\375K\367\265\330c\337\303\276G\361\336\244\373\222\330\343\367\335\367+\357U\335\"\261KbD<\256^\020\033\274\3267\307\3732\370\221T\203\310\373Q|\257\300{\232\224\267\275\272\313\353i\257\016\203o\222\243\264\334\270\272M\353k`\247\201o \273L\376\215\244\017\200\035\006\376J>\312\311\267\362a>*7\371\236\005P\177\025m\377D\037A\277@_\246\375\326\316\322.\353\277\332K\372#\001\317\321\276uT\255\266^\007)0\277\022\322\321\354\2771{\021\377\241\227\377\307s\371\005\360\017\324\372L\355m\265\207a}\214\326Uh\237\322\362,\370^\276\310\254\253Z:\212e\001\001\216\221}M\326g\262o\311z*\366J\310\\\205|n\202\312s8\260o\020&\245\244\036H:`o\016\033EC\335W\b\310\247\004\374\006L\2501\260\022IQ\232\224GA\241\003"
+	.string	"##i\036\020\370\034\364\244p\376\376\252\276\007\344\2308\346\237\336q\213\272I\220&\216\245J*\036\263"
+	.ascii	"\n\364\022\f\224\224\337\205d8f2\327\363Q\236\376\357\213\334"
+	.ascii	"\305\204,\231\225r\350@\333vsz\300\0319\210nN\330\316d\233\263"
+	.ascii	"\366\004\250\n"
+	.text
+	.section	.gnu.lto_.decls.4a22160a496eb4a0,"e",@progbits
+	.string	"(\265/\375`Q\213e+\002\352\205\037\310S \nY:\215\001\363\320\272>\312\343\363X\360\301\221\377p\343`2\270p2\bE\255\350\205\236\254=WW\215$\023^\263y\0315fe\2775_\214\367}\377\266\275\356\316|\223\325\232I\361>\006\312gi\275\316\031#\271x@D\260\266\262\355-\267\334)\346\n\225\f,\r_pe\2076"
+	.ascii	"\263N\275@<\r\"\301\224;*Y\023Q\240\365E\035\373\350\234\216"
+	.ascii	",#)\220\224+\335J\265R\037\250[\372c\007\330\006=\210\244?R\036"
+	.ascii	"\200\026(\261\032\343\242\323\316\356\372t\364Y\274}\266n\237"
+	.ascii	"e\333g\225\354\263E\366Y \373\317\024GzC\207I`\224\232\254\377"
+	.ascii	"\2476R\253\364*\255J\251P\267\364F:\325D\204\342%E\003\004\025"
+	.ascii	"0-\2638\216\037\242F\224_z#uJ\245>\220\001\001\323\032\214\343"
+	.ascii	"8\275\2212\305JI#\310\304\200i\r\026\2470\035\312\351\350\357"
+	.ascii	"\301\235>\245P\250[P\032\225\267dC+\353\357\277\335\201\030\r"
+	.ascii	"Z\177\210\006\255\337\\\366\367\224\375\375\266\277\311\3667"
+	.ascii	"\326\376\323\245w\321H\356\230\200d\375\247JiR\231.I\222\262"
+	.ascii	"N\223\322X\267q\355\244C\252\004\375\262\376n\332\177>,\314\221"
+	.ascii	"s\006\322e\r\230\007y\224|\342Xl\212\237a\216\203\272\345\302"
+	.ascii	"\302\f'\023\242xD4\232\023\r\035\264\334\240\027\227U\023f3\224"
+	.ascii	"\213xu\205\255J\326\337J\373h\236\340\234\233\374&\267A\335\362"
+	.ascii	"\340\237\377\320\300\347\271\300l&e0\263\311f<J\317\270\252X"
+	.ascii	"\204\353\020\311`\207\016\357\332\027\341\326'\216\331'\202\331"
+	.ascii	"'r\331'Z\331\253_\037\372\245\2150H\326G\003\177t\355\t\272\307"
+	.ascii	"\243\344\0233-\r:\245d:\036&\237\230\311\353\f\230\334%\237\311"
+	.ascii	"ar^6\223\323\3445\031/{\311e\362\230L&\357e5YLF\223\271d\275"
+	.ascii	"\314\227\277\240n\271/gy\326\222\337\336\370\331\375 \250\204"
+	.ascii	"q\346\276|%\337\361$\371\304L^^\234k\205\350\332\034\037Z\350"
+	.ascii	"\006\307\017\256\317\031\307O94\3168~\306\245\001a\345\013[\033"
+	.ascii	"a\335^~\202\262&;\371\321\265g\234\234\246v\270\001\226.\316"
+	.ascii	"(j\374rZ_nb\350\227\373r\225\244?\016\322\360\b\r;\2548\212$"
+	.ascii	"\331#\200\316O\364\302\312\001\005ZOL\262O\034\262\357\336\342"
+	.ascii	"8\316\260\243\346\312\363H\326'\002\331'R\355\257\205\373+\340"
+	.ascii	"\036\201^X\277\346\345)l\231@\037pY\177\335\262\277\326\355\257"
+	.ascii	"L\366\327\257\375\365i_\215\263\257\n\356\253i\366\325.\373j"
+	.ascii	"\225}5n_m\262\217G\266\357\207^X\257\376\330W\243\366\365\341"
+	.ascii	"\246 \243\235\301\310\312ZK\362|f\206re\340\271\361\304\214G"
+	.ascii	"\326YI^\202\272i\310L\342\036\024\220\310\222U\326\327n6\007"
+	.ascii	"\342\030\325\260\242\207\207\250\2065G\201xN\022\202\221 he\032"
+	.ascii	"\210L\250\374\020\202\204,jM\226\246\254\377L\346,\322A9\242"
+	.ascii	"\225\365\330\223)\216\343\240\025N\241\222\217\254\257\365vX"
+	.ascii	"\346\221\203\360\250q\034\004\215\023+\347x\343\214\343\370\177"
+	.ascii	"\006\313F\362\221,\206\272\345\260\374\225k\374 rX\206\312V\207"
+	.ascii	"Nt-,\013\311DP\274,\021\364\242\374\3428V\243\252\234\211*\352"
+	.ascii	"o@$\017\201r\026A\3352\221_\203\020G\237q\254\026\307q\207\240"
+	.ascii	"\254\205\357\207\020\255\257\355\366\365\334\276f\262\377g\256"
+	.ascii	"\f$w\345\037\331\013u\313A\340\266\300\370\b\241\312\236\337"
+	.ascii	"\234\026\272\307\243\3061\327\031g`\220\334\003\335C\361\210"
+	.ascii	"\034\340\n_\2200\3168~\356|A\023v\246\243\257\235\373\272\310"
+	.ascii	"\276\356\261\257\245\366\365R\21659\006s\344*5\316\254\274#\353"
+	.ascii	"@\335r\216\301\375\020T\350\023\2364\216\267\n\235q\374\004\221"
+	.ascii	"\255\262T\266\301\223\306\261\222\241\323*W\241Ox\222\2361\325"
+	.ascii	"\2128[X\006od\034\371\nu\313V\177v\312OG;t\350\020\224\267\340"
+	.ascii	"\376rl\375tn?}\356?O=\333\370s\024\332\346\035\333\001%kT\017"
+	.ascii	"\304\363Tj\207\245)N\326O\321vZ\2669\240\027V\025\005Z\277\227"
+	.ascii	"\2332\023\017\216\273\030.\353\243sl\314\262R\2163\r\3640/\345"
+	.ascii	"$\324\020u\313L(\341\3218h\341s\336\240\230ZfB\001\321B\2749"
+	.ascii	"\022(x\346l\343f\314\031\307\317\314\204\302A\237\360$\371\304"
+	.ascii	"Kza\3168~v\b\352\240>u\341[\362\321\267C/\254E\024h}\312\265"
+	.ascii	"\237\352\330O\241\366\363\340~.\263\203\354\366\263\332\376\200"
+	.ascii	"^X\237\275\366\217\376]\260\231\254\314\251\371\365\265\305q"
+	.ascii	"\301\312\372!\316\304\345\241}\350\030t/}\332\355\032nrj\320"
+	.ascii	"5h\032\324\r\355C\321\344g\034\277\365\241|\350\023\024/+N\365"
+	.ascii	"\340\256\264\314\326+@\245\263\255\217\272\331G\365\366Q\273"
+	.ascii	"\215\222A\313\240n\027\240f\216\352\241yW\225\236\3613\216\237"
+	.ascii	"=\331Ha\234[\326G\243\354\243\027\254\351\341!z\301z\264lg\024"
+	.ascii	"h\365\021sGL\303\342\005\207\307a\347M\231%\263\254\1774\f\352"
+	.ascii	"e=#\230\365\224\365C\374\350\232\023\364I\372t\022\243x\365\241"
+	.ascii	"s?\210\243^\320)(\225\224\255jGqC\343\027\307\317\377(\030\264"
+	.ascii	"\013\372\005\345\202\272\241^\320,G\265\240[\256\237G\325~\020"
+	.ascii	"^P8T.}:\021\340\225\306/\216\343o\360\203\3705\b\201zA\253\240"
+	.ascii	"w\351\323\031/\351Yu\320\365\005\252\311`\034?;t\b\352\320a\345"
+	.ascii	"*\364\302R\324(\027za\265\200\002\255\217\261\321\273\214^A\261"
+	.ascii	"\034\275C\255\\\203\020\327aB\357t\034+\241h\005<(Z\201zwD\311"
+	.ascii	"m\325\307\300\376\320F\351\320:\324\215\003jwT\n:w\226\351\031"
+	.ascii	"\277\305\361\263\347\370\025\345J\326w\300>\312a\3559<<<D9\254"
+	.ascii	"W\2615\n\264R\200^X\1774\356\250\334\217BA\243\240O,\020\307"
+	.ascii	"Lq\034g\310Ki\006"
+	.string	"\247d\215\246\2018\032\007\264Ve=c\2708\216{z\364\352\330\210e\375\004\354\303\241\027V\026\005Z\321'\312\206\272m@\337\256A\210\247Im\261Z\034?{v\f\317\f\t\263>\t[G\350h\333\201\272\342\020\337\331G7\254\350!\272a}\336>(\320\372\243M~4\rU\333\220:Iq\305pq\374\374\351y\346\230\n\222\365\237\350\205u\243@k\352\200t\305\333\204\350\374j\212<\246b\220\225^\375\351\215\233Q\333\376\214\226t4\035P\331\3764\205\343e\260\264*\355\300\363W\327\376L\366\021\277j\374U\266\302\177\273%y\f\203T\2045\003\177\266@-\373\177B\352A\363\377\225,h\301\367\277\"\377\324\003\222?O\360\201\370\257\355\237-x\376W\026\277\016{\3637\325\312\254mN%c\373\365\225_uf-uLk\371\365\226_\025\373\263\005\322\n\324#)\376t\203\032&\346L_\372"
+	.string	"j\364\253\031\350\277<\246b\240\032\371ua\306\241n@S\250`\271\303\237\372\250ERu\202\017@\002-\262\005/\372W\b\376\024\205J\344OG\250C\376\237\360\366\342\257\202 \225\272\272J\343\320Y\252\220\037M\241\022@\373\320@\324\257?\027\241\324 \277\036\362\347\f\250^\277\312uE\375\361\253Y\251\372\037\203\177\315\301"
+	.string	"\355\362\247Wu\374\272"
+	.ascii	"?J\365\3478j\216_\217\360k\003\374*\326\017"
+	.ascii	"3\230\006\177\226\241\342\370S\242\007\2507\262\336\257)\360"
+	.ascii	"\253W\332\002o\364Q\251V\035/\243\245J\177V\252T\277\206\361"
+	.ascii	"\3471\025\003\315\201\300_+\375\252\215?{\251S\177\352\343\317"
+	.ascii	"G"
+	.string	"\252T\r5\352\177\213\013\264\b\277\ne\301\227\277z\346\327<\277\356\321@\177:\201?_@u\202@S\360\353\n~\265F\007\371Mo\374\307S\233\376\354\244\322\310c*\006-.\201\377\027\374\212\312\364\253\361\217\246\270\001~u\213\326\277V\177U\003\177Z\210\246P3\360\253)<\347W\251\374\031\207\272\341\313\226\333]\371\205_\215\313`\256\177\265\311\237\277T\017\376\267\251I]5\002uD\331\225\374\036\350WQ\224EQ;\370S*\177Z\345WE\250!~\024\306\217n\340Gc\374\271I\345\240\213\272\001\372B\325\340G+\374*\210\037\r\372Q\240\037\375\217v\220\355\262\233\372\341O\305\374i\336\257z\370Q\f?J\200_\025\372\321\237\037\355\360\253\005\240K\241\022\340\177aNR;\374yL\305\340\3178\324\r\037\300\257r\370\037\364\243\037\"P\005\360\253\001\370\263\363O\235g\300\257Z\375)\t\025"
+	.ascii	"\377\275\234\313\377\270\377_6\240V\360\0132\326\177~5\203?E"
+	.ascii	"\242R\360\247g\352\004\177\312\366\247m\277*\301\377\b\376\267"
+	.ascii	"@;x\372S\013,3\016u\303\237\272?\232B\215\340\317`\337\371\325"
+	.ascii	"\006\374*\004\277\232\341W\201~u\347W\331_U\177\025\375u\341"
+	.ascii	"\257\337\374\232\315\257\377~\335\367\3533\277&\363k1\277\376"
+	.ascii	"\362\353-\277\276\362k\273_K\3715\224_\267\375Z\355\327f\277"
+	.ascii	"N\362k\347\257\303~M\344\327]\277\366\361\353\035\277\306\361"
+	.ascii	"\353\252_K\375\332\351\327J\277\346\300\257S\3705\214_\277\277"
+	.ascii	"^\376\332\350\327\307_[\340\327\024\3705\004~\215\302\257\025"
+	.ascii	"\360k\004\374\272\304\257\r\360\353\016~\275\301\257\013\360"
+	.ascii	"k\f~-\200_W\360k\b~\235\341\327@\277\356\3715\373k\365O\r\377"
+	.ascii	"\024\360O\325\374)\337\237\226\371\323\274?\365\362\247X\376"
+	.ascii	"\264\312\237J\371S\270?m\373S\264?-\373S\260?\025\362\247]\177"
+	.ascii	"\272\365\247Y\177\212\343O\243\376\264\306\237.\375i\n\177\n"
+	.ascii	"\343O\337?]\376\351\005\376\224\350O-\360\247\024\370S\007\374"
+	.ascii	"\351\212?=\341O\023\360\247$\374\251"
+	.string	"\b\177\352\301\237r\360\247\037\376\024\203?\025\300\237\002\340O%\370\323\007\3764\350O/\374)\320\237\376\374\351\316\237\262\177J\374S\365O\321?\027\376\371\315\237\335\374Y\360\317j\376\234\346\317{\177\036\363g0\177\336\362\347 \177\306\362\347+\177\256\362g\273?\323\375Y\312\237\345\376\f\367\347\267?\253\375\031\355\317f\177^\362\347\262?\223\375\031\354\317B\376\354\343\317:\376\214\365\377\204?C\375\331\351\317M\177f\372\363\322\217\216\370Q\017\177N\372o\346\317\035\370\363\006\376\333\375y\202?g\340\3172\376\214\364\347\367\317G\177V\376h\212?_\340\317\026\374\277\362\243\035\374\177\373s\321\237O\370\237\342\317\033\374g\361\347\f?\232\367\2437~T\351G\223~\224\003?\312\374Q\017~T\203\037\375\360\243 ~T\375\357\367\177\315\177\274\377a\376\203\371\257\366\377\311\377.\377/\034\036\036\036\376;\013\370#"
+	.ascii	"\341w\201\026aS\342\354\016\212\274}\205\362\266\312E`e\351\360"
+	.ascii	"JgiKW\335\032\367Un/q\353\243\222\365\n\247\262}Q\311\313z\215"
+	.ascii	"\322C\307\266g\344uJ\350\316\344\236`\331\"\240\t\251R\377\352"
+	.ascii	"\344+\233\223\265\rm\213\251\326(V\b\333\f\306q\026\007tO\351"
+	.ascii	"+I\033J\345\315\016\256\302g\222M\242I\332"
+	.string	"\327&i\352\2305~q\226\031\207\235&44\320d\375Um\002#\233\304\335\272\344\253\331\272d=\213 \215O\225+\\\243\267\236e\031\251b\342c\223\020\203\344k\022$\252`\216\3438v\022\265\244u\361\213\263\2628\350\330\355\331\201\225M \265I\274Y\215|=\262\032Y-\244I9\323E\006N\326\377:\366\325\231\326EIA\222\365*\246\277\362\244\244\335\340\372\317\026\225\0041\222$\f\316&\301k\310\327\"C\322\214hq\330\201Z\013\343AD\0021[\004\230\320\352\205\256__\350\023\364\031S\255^\207Z2\320\311\301\203\314\220\254/\001\335>\212>Y7\300\"\364\225\353\250\333\312\265v\231\300\025_\2158#\362\035\301j\223\365\nDU\263e\256.\353K\360\334\227\340\310\016\372\023\372\252u\324m\325Z\267\202\270\342\253\020\224t\245\r\2425\352\232`\311z\365\261}\240\361\310\222\365%\330\332\227"
+	.ascii	"j\213P\"\364\225\307\312\003\275C\2371\025\221\306\223\341\026"
+	.ascii	"\361$\264\346@\327\2545K\177\255U,\224\327\033\277\300}T\177"
+	.ascii	"\255\"p\b}\305\302z\035Z\205\241i\211\320/\256\312\312\200\247"
+	.ascii	"\207\027\260*Y\177\203\337\016a(\224\001\272\336\270\241\271"
+	.ascii	"\3643\266\"z"
+	.string	"\r\246n\234\254\021\313\372\033\312\354\037@\241\257TT\253U\352\304\025[\205@\226\007\346\314\240ik\313Z\205\307\005\325\226\3657\204\331\337\300e\223\220\026\365u**\215\221-}=\244\344\266\210\247\320\327\247\365)\323\351glU\374\202\332\240d[\200\023\372Zc\255\241F\231\300\025_qp\326\005\346\334L[_\230\262\376\006\257]Bj]\372Jc]R\005\203\230Pi\265\245/bY\177e\332\300c\203\250!t\365\360\250\233z\270&\231\300\025\337\340\300$i\214\213\276aD\fS\326k\314n\221R+\313\372\033\234\366#\370\333\032\024\021\272JH\250\026r\340R\352\032Qf\005\246\3253\267\004\313K\215\003\307\346\005e&\353G\240\267\037\201\335\276 D\350\352\0337\365\r\372\004m\213\251\2124\334\364\332\020\361\326\324he\375\b\312v\t\2776lT7\350\235\216\263\342$\300\017dM\"\370\332\217"
+	.string	"k\227P\363\273\n\350\247\n\3568\210ljG\020\fj/\360\252`\316\262\373\013\362\365\237E\t}\334\210\377\"\210\332ZN\350\252\0325\352S\352\304\245\324e\001\231\025'<\212Lvp|d}\b\354\266\211-\276\253i\370T\247O\274\324g\350Lc)fhh\342\266\t(e\256\356\225Q\235i\237\032(A\2638+\213\303~\202\323$f\346\3106\001\006\357j\036\236:F\204)F\374z\302\310D\341\351]\035\243\213\244\301Bs\367\237\325\201\272\262\262%\006\002\035\273\204#]\256~\351\242\2021!.Nm\221Y\t\222&k0:\320\212X\217.^ \250\261E\314\t\251YPu\313\026\035\250\237\261U\016\231\250\007\332\354\243:p\025\361C\350*\026,\331,?\343\252\325\2530+\003\0352<\266\265\254\377"
+	.string	"\231\035\002\207\320\325+\250\233zE\255\221\333\342\244\236\271\252C$;\317\360\251M\326\177\300\313\316\240L\350j\225\243nj\025\225\311\004\256\370\212"
+	.ascii	"T\270\b\r\325\266(}\205R\366\0060\241\253vv\371,\267\305W\305"
+	.ascii	"\245\"<M\340\302\370\262\376\003m\033\202*\241\253tn*]&\013j"
+	.ascii	"\213\257*\350\355\330\3022\230\263\345T(&\353?@d\007`P\350\252"
+	.ascii	"\024)gz\351\230\323\330X\326\177 kK\340\024\272*w\324M\225S\225"
+	.ascii	"r[\234\304\243\327\244\313\311\033\254\254\377@\274K\240\002"
+	.ascii	"\345*\034\024\3259\007\306\022\332u\241\022\245\315>\021g\355"
+	.ascii	"\352s"
+	.string	"M}\333\361\3725%\313-iKr\273\372\226\315z\306\320\370\234d\255\266\245oX_|d\255\262\261lav\244e}6\331\314)\030\226\344D\003\231M\200;\241\253jn\252\032\272\227\333\342\252\t\334\020\313a\026\307Z2\320ye\264\350\310\372\032\300\266"
+	.string	"\342\204\256\242\241Yq\3439\"H\325$\353k\370\261'P\022\272jf\246\306\271-\266\312\321\233r\2455\030\307Y\031\344\257(}[Y_C\324>\261F\b\275CU%\277\006!T2u\tzGA\3223\246\312\241\321\367\314\340A\201\373A[6"
+	.string	"\002\205\256\226\271\251e\231\316\004.\245+\013\310\002\275"
+	.string	"\007\343XK\006;hc4\244\262~\320\2210\225L\035\013S\235'\362\216\250d\352\330\021\325\271\223\276\302@\t\016\242n\252S,\210\307~P\274\021\260\204\310U0\"*\326\216\277l\244lwk_E"
+	.ascii	"\367\177\374P\205\254q\214>\271\250\252\204\250yI\304\344\262"
+	.ascii	".\341\214K\375R\273\270\324 ;\t\235\213\223\305\201\250\224\006"
+	.ascii	"\356-k5\210\232\035,h\006i\350\300\234/&n\330\200\240\331\317"
+	.ascii	"\360e\223 f\307\325\036;T\037h\034\307qV\234\3647\202\t\027U"
+	.ascii	"\353\252\217\327\225hZS\312\372l\320'\377Y\325\253M\232:\036"
+	.ascii	"\317\240d\213\300\"tU\307Q7U\2076\344\360\214\223z\310HA\t\016"
+	.ascii	"\306UU\031<\303\327>\361DH\225R\247\256\332\270\212\343G\335"
+	.ascii	"T\033*\326\216\343\370\311\020Jp0\316\252\342\360\237\315U\254"
+	.ascii	";\2358\002\226\254\314K*\353\253W\352\215\237U\217\304=\001\314"
+	.ascii	"\372\031\264\366Y\236*Ng\230\254\325\252\335\224\001\353\202"
+	.ascii	"-v\004\255)k\265\352\253\023SW\222\254\263\023\210\253T{VT\260"
+	.ascii	"\262>\0068\373?\372\374\257\261RU\034\307W\3523\266[\322Y\177"
+	.ascii	"\364\250\212\242\034\376\0354E\001\360_\377\025\200\2371\r5c"
+	.ascii	"\3428F\005yz$A\"\205\202X\305\253rz\353J:@\227\025S\227\016\247"
+	.ascii	"\267.\253\037\247\267\2568\211I,\351\247*\356Jrz\213\343\037"
+	.ascii	"&\246$\023\\VNoJ\361\217\323[l\025\323\310\263B\343gWR\314\304"
+	.ascii	"\025\377\304L\261R\374\306eE\201\023S\227\225\323\233\222\325"
+	.ascii	"\217\323[\227U\374\326\025\373\304LJUOLq\325O\374\326\365\027"
+	.ascii	"\277qY\3718\275qY9\275u}A\317\240\334\340\300\352\033c\204\013"
+	.ascii	"J\305\211)\2661\245\245T\345\203\347\364\344\212\367\342\030"
+	.ascii	"\205k\212\253b\2748\006@\034kqU\355)\351@\355\226\360l,IQ\342"
+	.ascii	"B\237q\034k\230Z\362\342\212\231\360\222\320\030\317)\tW\034"
+	.ascii	"'Y2\212\247\3428\2169Hz\342\305EP\274\244 Z\261TS\034?\020?\343"
+	.ascii	"x*\216\223\320\030/\216\343\2448\216\211UZ\3178\346\341\343\344"
+	.ascii	"\234\232\212\343\254\240\251X+\211JS\034g8>;+\2477/.\020T\240"
+	.ascii	"\2749\343\032\317$\324I\212+v\306{]U\373-\211-\226\212\343\030"
+	.ascii	"\r\334N\253\033\200Y\253P;X\356\330\360\310\372\030\340T\247"
+	.ascii	"b\020.W\002\263>\006'[m\322P\254\233\313\262\312\372\030\212"
+	.ascii	"<s\354\266\342pd\255.\355(\303\272\256\254\217ak\253I\304\260"
+	.ascii	"4O\246d}\fQ[\037\006i\032P\370\326\262\376\2058[\027\006\351"
+	.ascii	"LA\271\222%\353_ \263\341h\302\030\200`\\\270\300q\243\007u\246"
+	.ascii	"\266D!\003\347FP\263i\023\305&K\231\240\006\364\233\332K\313"
+	.ascii	"\372\027\202\3545\332\217\345\342\341\246\244\265&\215\356\343"
+	.ascii	"\241:\322\306I\326\277P#\215\346\313:\242\220\\e}\013p\364\031"
+	.ascii	"\275\247\361\236\326\354\200\223\365\321<-bW\252\274\216\207"
+	.ascii	"\311'\216ZRs\306q\254\3614\225\327\245lU\030\232\364\232XI\363"
+	.ascii	"\263[\363\333r$O\217\321d\264\236.\243\301\3500\372\2136\243"
+	.ascii	"\305\240n\032Os\271\356\242\275\\\007\342i,f~jwg\032OgQ\362\007"
+	.ascii	"\2465\230\007\311\352\2460h\024\017\275\260F\200\002\255\267"
+	.ascii	"\220f\337\002\336\276\205\273}\013p\373\026\230\354[\020\262"
+	.ascii	"o\001k\037\310p\037\350o\037Ho\037\350\312\376u\235\216C3\b\267"
+	.ascii	"\225\365\363\323\332\226\323m\207\223\255G\033\217\247\2263\212"
+	.ascii	"\246\323pZNK\321sz\n\352\246\343\364"
+	.string	"\333\365\023\r\345h\234v\022\247\231\350&(^V\034[q(\003L\033\034\214\343XW\271\202\206\347\243Q3\364\302\232\001\005Z\017td\037H\307~\2057\373\025\324\354W\030\263_\001\313~\005$[7\371\265\022\275D\253\361\340-YR&k\215\246\323\256\325\364\231V\343\200+\216\225\264ZO\2348V\352A\321\nP\264\002\215\3465&\267\352W8\262\3215\020\327fE:\2774\252\254_\201\310F\235\320\013\353O\222\224\311GX\032-\246\215h\247>\242\3074\022M\246\303P7]\246\301\202\206d:\0366\216\273\f\235D2\035\212\007\027\353\261*`N\2632\rD\177E\260\344\024+\001\031Av\005\346\034L\335\240O\210c\200`\316A]\246y\350\036)[\325\t\275(?! \224\300\234fe\272\bz\267\216\265\2019\007\313\264\226\346J\331\252\266\234\027\224_\034\307A\352\233&h\202T\320\257"
+	.string	"d\277\002\326~\205\246\375\0377\373?c\266\356\322^\250\333\273\350 \177\366\360\234y\242\246,\353\377t\331G\337e\355"
+	.string	"\372.\353\177\344\266\366\241\267P\267\337\351\037Y\330\374\260\313\372?k[F\034\3071\372\273\225\370\273\365?a\272\307\257wd\266\327e\2560\177[\203Y\377\307k\353\240@\353\257\263\364\225z\347wDJ\326G\325\322\2309A"
+	.ascii	"\202\371\241k|hspx8\367\322\3744\rm\245m\350%}Cc\351'\255C7\351"
+	.ascii	"*\235\244\251\264\222\316\241\235t\254\241t\r\315\244\245t\224"
+	.ascii	"\306\241\247P7}\225\036>k\311d\326\324\210\371\205\225i\342\247"
+	.ascii	"\257R\302\3240e\253\332sK;@\fj\371\275\351\001\202\315\017g!"
+	.ascii	"\032\020\201E\242\264\331\352\033\033\343\304\351\306\207\031"
+	.ascii	"5}\225\376\031\361[\223\236\321W\251`\b%0\247Y\034?S\261\032"
+	.ascii	"j\242|\320\367!\214\223\026\242zm\340<e}\2374q|\304\354\373<"
+	.ascii	"\367}\230\354\373\210\355\373l\355\373`\355\3730\355\367\374"
+	.ascii	"\355\367\220\331\357\311\262\337\363d\277Gl\277\007k\237\347"
+	.ascii	"p\237\247o\237'\313>\217\223}\036!\373Z\320\013\353y\252\366"
+	.ascii	"yj\354\357\030\356\357\364\355\357\204\331\177\252\327\204\n"
+	.ascii	"\360*kg\2263\216ct\r\315)\004\022\0339--\233\212\362\306OHZ\227"
+	.ascii	"\022I\215\350\371p>!L;\364SK\235\240xp&\252\234=9\243\374 \336"
+	.ascii	"\320\342\240kIR&)[\325\246\363\222B\327\3522\025\265\261\035"
+	.ascii	"N1\036a\331\314K\313\017\312\353P<8\324\271\004Nf;\322#\305J"
+	.ascii	"\353\322\034\351\017\024/K\325;\342\227\332\245t\351\227\324"
+	.ascii	"JJ%\275\222\336\245y\351\224\024/\r\223fI\261\244R\322-\251\230"
+	.ascii	"\264K\312%\235K\265\244^\322*)\030\324-\255K\341\236\306\245"
+	.ascii	"r\327)V]\332\225~\245O'[\303k\313/\216\343\264.%\243B\327\352"
+	.ascii	"R3(\277\264.}\246n(\036\234\2116\205~q\374\354\220~\031c\222"
+	.ascii	"\373\240\325\030\275\260\336\016\005Z\2773e\177Gm\177\007l\177"
+	.ascii	"g\307\376N\023[\332\246\377"
+	.ascii	"\326\304\242\374\330\2644I\327\212\205KU\262\262\276\216\224"
+	.ascii	"&:l\373:a\373:=\366uj\354\347\370\245Kx\312\222dy\223\365s\274"
+	.ascii	"l%W\312\361\245.\353\347\310\355\347\230\355\347\200\355\347"
+	.ascii	"\344\330\317\241\261_\\\263_\344\262_|\333/*\331\251\221\037"
+	.ascii	"]K\207HI\257\244\270)\311:-\002\342)\330j\370&\n.\353\236\255"
+	.ascii	"\215\306\350\205\365C\220\247\001*\226\tQ6\212\207\035\304\025"
+	.ascii	"n\032)\266\354\002\343\020\rw\270\020yCC\b\347M\234\222\252\254"
+	.ascii	"\t5\027;3\316\254\237\331\256\360\300zR\234\033\321T\305R\271"
+	.ascii	"\201\371\315\321m9\247\374p\022q\316a\241\362\263R\2542\242\251"
+	.ascii	"\212\215\322\353q\267\303/K\221\213\336\024\210\"_1\f\b\274\342"
+	.ascii	"\230\021MU\354\215\245\247\267\367\215h\252b\233\364\214\230"
+	.ascii	"1\213K+\272\215h\252b\257\364\216\370\305\361\263.\323\371(\366"
+	.ascii	"\025\323\024\325\024\007\213l\212m\212n\212h\212{\305\300\342"
+	.ascii	"\233\"`Q\260\370W<S\364+\256A\335\212|\3047/\222)\226y\3203\216"
+	.ascii	"\231\212|\305.E0KR9\215\257hW\254\222>\311\3428\310\330jf\203"
+	.ascii	"\320l0\216\2374\310\300\306X\240\337\001\220\275\342\025\307"
+	.ascii	"\350\301\261\245\341{\"1S7V\314+\212Y\327\364\210p\311\372\035"
+	.ascii	"T\355w\360\264/\302p\353\2628\257\277/E/Ze\322\236\262\276\210"
+	.ascii	"\300}\021jv\361\254\t\231\303\342\226\242\226\250\300 yY_\004"
+	.ascii	"\336\276\b-\373\"\352\366E\264\355\213P\262/\"l\377\305*TT\347"
+	.ascii	"X[_\326x=:\206iz@\262\276\b\257}\0219\366E<\355\207\210\263\037"
+	.ascii	"bM\\Q\016N\323\260b\205\b\226\270\"\\^\223\030J1\312\213pG\350"
+	.ascii	"\304\004\311\272\b\005\335\3139\244\363r7\267\037B\255\330\306"
+	.ascii	"\223\366\345\226\226\365"
+	.string	"Cl\355\243nE\266\342\023\316\326\220g\321\311\213\317$\276$P\262.6)\256\375g7PB\002e\255\030\006\325D\260.\353\242\332\357lL\001|_\0260/0Y?\204\215\375\027\321\204\234\351@=\367\343\307\236\031\\1\356\360/\r\023b\225\374D\213\232\301%_dtiJ\324\032\035\006\205\264%!z\231:s\022)\226\251LXZ|xe]\fc\347\322\222H\221\251o\253\024\275*S\316\274\037a8\306d\315\203\004P\214\360H\246\213S\203\027\225\365S\207\212\312\b\227\021Ui\307\253oM\032\230\352\214\333A\304+\353\342\220\"\221\027\213\274X$\027\213\244\207\207k\2231QV\375\243n\257+~\2619\3438\366\321\341\023\234\002\227\365C8\355\270\207\007\216\036\225\033\257\266\264K\235\022&\305.mXFK\rH\331\316\240\237\333\033.4V\315\f]U\361G[\221C\324\255\270\245b\221"
+	.string	"(\365\345c-\263\307\365%\225u\0075\212;^\354Q\334\241:\235\234N\326\034\002f\375\"\017\016\nw\007q\021\353E\035E,+0-\263-6\206\364\310\221f\213XC\365\242\025U\361F\020Wj\346\006a\0333&vV\342\254\377\342\325\2137\212|4\342\340\250\360pa\263\032\223\365\213U\034\224\331\"\366\212Q/N\025\243T\347\026\247\316\025\\\031%Y\277(\305\001\335\026!\246X\343\305\247b\r\033zU\006\233\260\270\201\312\372E'\016\276v\0076\212K/\322(.\255C1\241\241\031\216\301\263\275\254_d\342@\307\366`\215=|1\211=\234\240\212\024\022\026P\n\030\301\254_\2147(\334\036\224\261\204g\013Y\302+RH\264\006W.X"
+	.string	"\t\263>\033g\003.\333\2030\326\315\3317\254\033\325\t(%\226\304L\b\2302v\203\033\300m\017\276\002\317\262\t\324\223r\256gq\222_\326g\0057 \333\036\340`\327\234\375c\327\250\202\316C$fyi~\033\374\330\036,\2419\333\207F\035\303\001\033hWme@\226\322h\220f\217\210c\346\354\0313\252\263\257\310\230\2516{\032\314\355\021lX\275\263dX\275>0'\321\355\215\233\266\254\317\216\321\240l\217P\303\2069+\206\r\363"
+	.ascii	"\026\226i\353\fH\326g\3614\220\332#\364\330.g\277\260]\300H!"
+	.ascii	"1\244\023\342\005\204\230=\"\013\226\263Z\260\260[,4!\003\323"
+	.ascii	"b\365\236\236\214\331\242\204\257\tY\326g\263\200\220\262G@a"
+	.ascii	"\253\234\275\302Va\333\3208\225\302<\211\223\365Y+ \226\354\021"
+	.ascii	"JX\272\263v,\035\333\226\243%e\233\"H\245\216\310\036\021\004"
+	.ascii	"\356\254\034\034+\205\n\230\326\240\316 \2279\265\271\263R\330"
+	.ascii	"8\020?\366\210,\366\355,\024\366M\305\022\363K\003\243P\001\362"
+	.ascii	"\004\204\324\036Qc\355\354s\215m\003\264\341\325\306\214He\211"
+	.ascii	"T\023\226\355l\233\232\254\3666f\312\t\210\244=\"F;\253\206\246"
+	.ascii	":\235\374\201i\251To\272t\244"
+	.string	"}H\263;\020d\227\2345c\227h\261\341\325fP5c\222\004I\326g\231|\310\262;\350c\221\234M\302\"\001c\303\253\215\236#4\354Q\366alwPF\354\254SL\f\230\326^\022F\026\227\365\331\261\017^\273\203;\026\354l\030\013\246\n\362(1\b\305\212\021\034\373\003\251 g\205\004a\211\004q%\375q\320%P,\007\n\030\345$\302\0169KDsm\351\211\251e}6:\316\1776\303\241\221\032Y\237\375\372\260\264?\210\331\037g\201\260?\330\2562\3026j\234\037O\033]\372k\207a\222\257\254\317ry\210\263=\020d{\234\365\301\366\240r\005\346\314L\224\252\232\262>\253\345ao{\260\307\3468\233\305\346`wX\351J\033\324\201\342\201\206\217\335\301\307\004o,\353\263:<x\331\036\210a\257\316\342`\257Tg\027\230s\347J\227\265\263\254\317\336\360 e{\300\205\265q\266\212\265a"
+	.string	"$`\316\364\212\032,!Y\237\245\362\300\266=\210c\241\316J\261P\252\340\312c\2120\253\330\006\316\323\223\254\317Fy\210\332!t\261Lg\233X&\326\311IhxC+\351\214\255q\326I'\260H\337\036KC\250\314\016\301\212\215\317*\261\261*\030\364\307Eh\230\256\271\263r\227\365\331$\241.;\004\032q\276\r\343\024\r\325'!l\206d\375](\004e\203`\270\007\277\341\354A\325\231\346\234R$\313+\353\3577Bb\033\0047[\360\273\315\026T\235\305A\2514A3\324k\215\216\250\254\277\331\b\361\330 \370m\277o\300\355\247:\301"
+	.string	"i\202\307\344OHj\203\020\206\357;\r\337V\023\304\225\352\201\271\3222[\241\250\300i\351\373V\323\204\216OJ\251\355\251\3140\353o4\005\020\334 h\331e\276\367v\031\3259\2703\325F\212\231\002\220\331 P\331y\337cv^\261J\n\315\025(]\376rd\375]"
+	.string	"\273\r\302\223\r\346{\207\251\"4\034D\335d\311%\tS"
+	.ascii	"\265\rB\022.\337^\270\250c\212K\246\370\210gz5\200t)\300\327"
+	.ascii	"\006a\007\225o+T\266\226 \256\2446E\264)>\036\203\352\337\020"
+	.ascii	" `\262|kY\002EH\220\254\367\225\215\345?\233\363\23686\226}\267"
+	.ascii	"\262\235-\201\333w\371\253\270fd\214lW!\200\337\006AiO\371\256"
+	.ascii	"\333S\036\360\"\205D\313,=\354\302\221\203\356\312\006a*\356"
+	.ascii	"{.NK*Mp0'\016\024S\0339\264\375A\232'\337Q\236\354\262 \256T"
+	.ascii	"\317\313\013P\313\252\203\314\210\\\326\337P"
+	.string	"\bPd\177\340\266\331\276\3356[\325\\\324S^\326\337m\004\310\332\0370\331g\337i\373l;)\352}\271\322\312N\226\326\362\266\223\275\326\024\006IX\326\273\311\316\233%_\326d}\0024m\265\215\226\201\231\375A\335V\362\315d+Y2\305$\307\033\240\222 Y\177/\311`\312\376"
+	.ascii	"\313\036\373&\333c\273l\313\r/\300A\035\"SZ\234H\276\3132\235"
+	.ascii	"\002\202\210\355x\203\246+*\317\231A\332\376\300i\344\373\210"
+	.ascii	"\021\325\231c\212I\016\263\215\306\247c*,\203!\373\203\"C\276"
+	.ascii	"\213\f\361 i\214\213\031V\024'O\"\031\334\330\037ty}\177y\251"
+	.ascii	"N\"\332\224\030\017\nxib\013\022g\207\220\347\343\373\207\217"
+	.ascii	"\r\004m\213\251x\252\246\230\3440\213\242\303\022\270\271\276"
+	.ascii	"\201\250\351Yc7$\315\336\352 e\207\260w|\367\330;T\247\206\255"
+	.ascii	"\251..zX\344xtX\333!\330m\254o\035\033\353\2018RH\264v\244\234"
+	.ascii	"\325\210\263\376\316\321"
+	.string	"\201\307\016!n[}\337\330V#HyU\231\351D\255\365I\311\372\373\252\003\325\016\301lG}O\355\250M\005(5\004\314 Kd\013\213\234\r\324mS\251I\253\362\324\221\265\224\233-\302\217]\343\373i\327@\233\002C\033\214b\005\005\307)o\213`c\307\337J?\352\266\343M#\210+M3%\306C\013\024\034*J6\3237\21534\236\366R\031>B\274\275D\204C\003\016\227\267\254\277\2230\370\332!\004\n\236\330F\220h\370\203\2506\005\206V\224{\003\3307x\242!\2610\007\312\b\221\254Bb\034-6\272\030\311\232P\363\230\273\262%\353c\020\357\303!\276\371\377\255/\036f\262>\207\300Mt\223\351\354\332\302<\265\321\231\"\006\312\0246\034\270l\021\272\370\235\b\350\267\226\2113\345\005g0\203\345p\256\375qP\262E\270\222\346D5i48\247\272\270\f\346\270\321\372q\326\307\241i\037"
+	.string	"j\357D\276\275\034gO\037\0300\2773e\366\001\226\306\234Xf\f\017\2365M\354\220\220\221\262\r\320\007\346D<0\304\274 \256\244?\013\330p\021\032\016\362\334\340\341\034\024sb\236\236X\337U\326g\303\241\007\nJ\233\2450h\333"
+	.string	"Y\264\234\310E\013\321K\020W\322\037\007?\251\300*\2039yvg\260t9\321\013\272G\274\272\243\333\201\356i'eYB\266\\Pd\033\300\356\312\211X\256\250\316 \256\24469I\244\322\004S&Q\206@\335]\020\265\r\200Fw\242\035\035\261\312\226\263GK\235\037\021*'V\301\352\363\321T\007g\033 \210\334\211R\344\210p\250\317s\211\f\234\323K\r\320\310\334\232m"
+	.string	"\033o'By#\302\005\355\270\t\031'~E4n\334"
+	.string	"\211QN\204C\243\360\211\261\362d\314>\200\024\265\023\327\324\210mA;n\362E\3457WF\004\n\221\355\304\266;\265)\215`^\326\304\3477a\234\2231Y\023\235\374\216\330\005\214\327\217\337i,*i_\232p\331\007 Sr\"\023%D4\264-\246b\200\333\341\225\331\2210\032d\210g'\242\021\311\230\224X\365eM4\243z\002\372\021\311\316$\001Rc\311"
+	.string	"\244\354\003\344\b;Q,\214X\206\266\305T\032H\005V\321\242\304\345k\216\210\344\3042\"\217\255(aY\023\307\210dKXeldMt\242E\262$\025\311\372\003(\262\217pm\021\376\210\234\bFd\314\311>\371(\023\245\310"
+	.string	"\250\266\b\203AN\024\022Du\036q\306q\026\207bV!\341\225\254O\374\022@\341\026\341\220\310ub\027\221Ku\006\371I\251\031\314\262E\307'"
+	.string	"){\204&\"\217\023\265\210<\210[D0Rh\256D \013\0251D\037'n\365,)\t\233\362\367\237\3351\353#\323C"
+	.string	"\\{\004-b\216\023\263\2109,\fJ\231\2113\250\204n\211\233\2164{\004\"S'RM\021q<e\212\267\302\036\200#\205$\007p\t\025\rb\325\2118n\360\030\202\t\242dE\274\352\211\033+sf}\013\266X\241b\216<\241\332\330X\333#\274=\235\030\365\244b\005q\245z]\256\264\314\2120\241#\313\372D(\013p\354\021\354\2104N\254A\244\241b\005q%\261\231\300N\n\211\326`O\232\032\323\216\254Ol\262 i\217\320%\316W\3038\304\245\242\233\227+-\267\260\254\307\341\211KD\245\250\300)bY\023\223\016\315\3509\311\372\001\360#\306j\304\242\370\bS\250e\217\3607\370\025\316`\316\225T\232\240\316\226\037kKo\002\300\265I\364\020\374\332F\020\005\224B\253\332\321R&n\214M\231M\202\312\357+\240\337\232Cj\t\017\335\225#\315\322\037"
+	.string	"\3006\t\2464_\325\244y\300P\n\211\026\217\237\222\224\262\276\n\372\366\001\006\367\276\362\355\251XZ\244\304\222\254jF\354\334\234!\333$\206\344}\035\223\267\226A\333b\252\b\224y\001\302\235\241\311B\346k\0316O\360\326\350\376\263+\030\2528p\364*(\262\017\220\006\314W<0*\026\332\026SYpR\005\3149\230\267\020\366\371\205\251\200j\217P\250\345+\027-\253\027\324\213\324\0200fj\215\251+\274._\275\250)\0326\375\315\241\371\317~\3403\"\266\305o\213"
+	.ascii	"\345\312W,WT'\232\224\220%,\231&A\271;\n\230l\021\246\330}\255"
+	.ascii	"b\247:\203\354\244\274\252\330\032\200\204fT(\270\332\035\304"
+	.ascii	"I\371J'e=C\333b*\020v\207H\314\3428\213\303\376B\305\026:GJ#"
+	.ascii	"\333D\021t\\\266%8`\340E!\343-:\300\007\306\372\272H\"$\274t"
+	.ascii	"\217\310\"<\3642\217\212\356\221\251\324\360\020\n\360\313<\332"
+	.ascii	"i.\231H\370\210It\341v\305\021\251u\261\335\024\220,\334\024"
+	.ascii	"\220,6\274_\235c\353\232\220D\266-d\300:/\254\"\250\330\302\255"
+	.ascii	"\t\031/\317\013\253p"
+	.string	"7\264\357\t\031o\017\3342\223D\352\021\023n\026\223I\022\312\030*\216\230p\323gF\233t\217\352\353\036[f\022f2I`\266\310p#\241\234w\007vMh8\272\360\313tA\342E\341D\023\t\200\246\253t_XF\t\306\037\f$\220\224\310\237\033\t\025-\221F0\223\251l\316H\036\035\221H2\217\336\343\222D\223\202\227\231\341\230d\232p\\\2228aF\373\200\001tp\223G\024\260[d\241\t/]\244\021ID\3442K\230@\241\342\302\353&\217\310\243\0357\351\242m!\003\251\334\315\242%\262\331\200&\262BQ\211|a&\214D\002F:\202\221Ph\"-\334H\250\tA\223\t\343uY4_&\314L\341\302\3107F\316\213f\333\002v\213|\232\314\327\210T\256@9=7\022b\2763\020\020\203\231$:b\006\235X\222\220a\001\n\026,V\024\233(,\024-\221/\023F.\231)2"
+	.ascii	"\271\306\245\233D\262\330if \301\323t\217-\f$l\264\220l\227E"
+	.ascii	"H\0262^\240&\206\033\t\265Mx\351*\341&\322\005\216$\214\026 "
+	.ascii	"p\217\314\024M\367E\"a\300]\261t}\232(|\334\241\367\347u\341"
+	.ascii	"\245[\"\231d\256\220\240\3712\3416\211\244D2\032I\274\314\367"
+	.ascii	"-\341\210<\322p\342\370\263D\202\2310R\013\364\302\350\032\001"
+	.ascii	"a\270\221\320\021y\324\342\230d\232P\264D\036[\327\004\f\360"
+	.ascii	"\333\302,v\232(\\\270U\"\341f\t*\002\240|I,Qh6\217\\\227\004"
+	.ascii	"\345"
+	.ascii	"\233\341\270D\022Y\030:j*=\0345\225G\027n\215\314d\222\004\021"
+	.ascii	"\n\370e\252X\301\342\250\251\234\340FB\036\230\310\346\220\016"
+	.ascii	"\013X\206{\302q\211$\n\272\221\220\007\367E\202[\227\210x#!\031"
+	.ascii	"L\027/\214m\322\005\3171\211\3044b1\001\214t\264D1#ytDBC\t\330"
+	.string	"E\200\214\367\307\247\271\241\271l\221\307v\005\263\305\321\247\3114\026e0\337\243\243vh\211l\026\331\031\311\243\243v\007\306\213d$\036!\275`2\027`|\267\217\233t\3216\221&~n$\3642\341\326\210<.\221M$&\322\250\331&O\034\335\005\024-\221\313\267\215\321s#\241\246\361\365`$\322P\202\003P\264(Ab\250\004\023(\244\030*\261b\210\005\212\237\033\t5\215H\270\311\\\026\265\310\243\207\346\f#8\331\272&\270o\033\343\370\266&4\221?\356\320\353\302h\227\025\212\226\310\027Ff\222\204&\212\007L\034\223L\023\232L\025\313\326\250\205\3732S\034]\330\350&\211\\\023\315\027F$\314\302}[\f\226H\355\002`\264'4\221\025\334!\237\f7\022\362\260\241\205[\0232V\024-\221+\232(\\\242\266\231D\266D\314\267u\321\272\200]%\0050\023F\036=p#\241\"$\214v\031"
+	.string	"\030\3552\350FBn\3225\032["
+	.ascii	"\030\215m\020\321\205\335\344\221\222Yb\311D\301|g\024i\270\221"
+	.ascii	"\220\007&r\275\221\220q\bv\233\356\212\343\222Y\302\210,b&\201"
+	.ascii	"n$\344\301H\204a\211B\023n\341\346\016\234D\266h2K\\\270\221"
+	.ascii	"P\323\bn\225DKd\373\302\315%\323\250D\302\036\232\257\013\003"
+	.ascii	"\371\036\221\311$R\271\302L\246\013w\205\221h\237\200\335\242"
+	.ascii	"\235%\262M\341\363\302\350\032\225\220\261\342E\263\205\177\232"
+	.ascii	"/\214\255\213d\262-\341*\221p\262uW,\221V\274h\266pP\222\371"
+	.ascii	"\302\025`\240\030\356\t-\334\232\200\300\212&2\307U\"[\024[\034"
+	.ascii	"\263q\206\221\205\231\357\214\"}\304d.\340\210T\261D\266)^4["
+	.ascii	"\270\347EJ\"\333\023\026~\230\357\f\004\274h\266\360\2061\300"
+	.ascii	"\025n$\204L\032=\030\211,\270Gf\nd\322H\334\371 \264D\341u\225"
+	.ascii	"o\333#c\305\021{#!\242!\017K\246R\3114\n\240\231l]0\223E\026"
+	.ascii	"\224/\211\031/\2746\341\227\251\342\350\276\255\021\013\267\331"
+	.ascii	"\272I\367\205\340\202[\324c\342\230d\232\340\036\231)\\\367="
+	.ascii	"ql]#\237\335\363\262*Jh\350\311\340\036\231%d\270\313e\313\226"
+	.ascii	"0\256h\"e\220\200\335\"\237\033\t"
+	.string	"\275n\022\351\350\032\031\233\360\3225\276\256\212c\313\\\200[\324\276.\2146\bn\341f\221\005P\006\020BG\256K\302\3215j\"\227\310\023F\rC\256\022\t/\221^\017F\242\tr*4\221\2204\024-\233\310\235\365\203\020\374\266GB;/\0236\266'J\300I$\334&\221\214\311\326xA\217\233\002r\037n\266D(\254G\367u\213\212\220o\213&\212\007nD\276\356\322-\332\347@D\001D\214\220A\374\210\017>|\360a\375\210\017@\200\370@\004\210}\021 R\030\036\342@\004<\324|\335$R\tp{\001\206a\330\035:\242x\321l[\020\031\213\356\220{d\246\370q\207\226*,\300\356\320\021\205\f\246\013\242;\344\036\315h\301\302\202;\344\036\231)^\367\310u]\350\354\310h\2259\307e\253T2\215K\244\262\350\302\355\ne\f\025:*\2241T\030I\264H\272F\327\204\217\213\224l\035"
+	.string	"\273M\"\"\024\334\344\021E\262\205\221E\310#\0067yD\241\343&[#\213\235$S\005\317\215\204\214\036\214D\031\224.\334\234\321\344\271 \303=.\221C3^\027\206[\027C\360\322}_$\343\006\367\310T\016\025!\271p\217\305\243\353\0365\207\214\032 \331\027Ff\322\370\272\307e\003\220\216\214;Fp\321\322}\341\346Ps\351\036)\231\306!8\211\204\207\002\360\266FF\355*\333\245n\256-\022F.\2219\260[\364\2660\317\002x\\\030H\330H\342u\211\210\220H\250"
+	.ascii	"\0175\033\260Y\300\3156\351\003\017)\221pN\263\001\256\022\331"
+	.ascii	"\242\205\223\256\t7y\244l\233?D%L\220\270\221\020\363\235Q\344"
+	.ascii	"\241\311|g\024\351\270C/\263\271t\233<\313\"d\262-\276.\220\311"
+	.ascii	"\266\004\274t\225.\ff\n\346;\243\210\002\343r\006\013W\211\204"
+	.ascii	"\217\230\314\344V2\227\256\211f\32352_\025G\344Q\017\321Qr\247"
+	.ascii	"`\344Ct\224\034\202\211\230\315\nn\023i\210\t\347\244`\264CD"
+	.ascii	"\304\204\221\214CFF\230\271\374I\301\b\203{4\003\036j6\333\243"
+	.ascii	"\030\314\344\220\006nQ\0137\207\230\357\214\242 \267h\331\256"
+	.ascii	"`\300O\n&,\221)2\274nsF\262]\222\b22\302\314\023\230\357\f\004"
+	.ascii	"\030\221\312v9\343x\001\0031v\263\351.\217\336\326\2509\344s"
+	.ascii	"t\223.\332e\t\313V\231l_\354\374\264>EK\346\002d O0Oh\036\025"
+	.ascii	"\375\370Tp\207N\034_&\263D\363\b\001\027\340V\3712\211\206\\"
+	.ascii	"\270]\"\217/\223i\034\312\340\016\301\310e\003r`\344\022\251"
+	.ascii	"\270d\"\233H\243\373\036\r5[\"\030\026\206\206f\274h\276D>nQ"
+	.ascii	"\013'\2310\206\222I\3278\004\277\314#\367\005:.\221\230,\224"
+	.ascii	"o\233$\001\303L#\f\356\020\020\214\\6 \351\"\235\200_\346\021"
+	.ascii	"\374\266\312\346\217{4\243E\213&\222\013\344\217\013\267+\\\270"
+	.ascii	"=\0365@\t'w\200\232Em\362\004\214T6\227\355\333B\211l\372\030"
+	.ascii	"\025!M\210\301\\\200\005\b\024\271'\300K\027F\tFc{\301=\"\301"
+	.ascii	"H8I\"\006s\001Jd\223\347u](\221NX2\221p\013\2638.\221\230/\002"
+	.ascii	"\224\310&\206%R\205\022\331\\o$4\343\205]\245\233t\341\n\220"
+	.ascii	"\340\026n\016\035\335\343\322\205e\270\026\232\306\327g\311D"
+	.ascii	"\302\310&\363h\007\204\013\267\357\220\006\355\013\313ps^,\221"
+	.ascii	"I\030\255\222x#\241\007^W\006R\271\263\242X2\221\260\321}\221"
+	.ascii	"&^&\314Tbp\217f\264P\276L\"\270M\036\3514\217\332\344\211fk\264"
+	.ascii	"U\274\256\fd\212\243\213L\036\035\265\025\214\2140R\3052\006"
+	.ascii	"\323\304\022\231\"\006\021\004\356\320\222\331l\335\025<1\332"
+	.ascii	"7\275\221\020\222\022\351\0016*B&\223I\346\253\215\2140\362H"
+	.ascii	"\215\321\316H\233.R\262\205\261\336HH\306\353A\306\013$\343-"
+	.ascii	"\272G3Z\274.\f\244kt_\235\243Vi|\325\327=\"a0\337\243\243\013"
+	.ascii	"\277.\214%rH\306\233l\221\257\333\374\221\341&\217\220L\020%"
+	.ascii	"[\243b\222id\302\314\367\250\007\036\322`\203#\222\205\227HL"
+	.ascii	"\343\020\321;\204<j\016\311x3\374\300n\323}\217K\244\213!\270"
+	.ascii	"m\016)\221^\370\205{\324\204\3008\244\263D\312hS \233\315\227"
+	.ascii	"\230la\274.\274Da\\\316`\321Dr\321\364Y\"\225\373\205\32152\312"
+	.ascii	"h\225{\2114\272M\244!\031\255rH\306\2333\303\270t\2210\340\276"
+	.ascii	"'^\027N\"O\030\337\237f\322].[\243\022\356\021\371\276.\f\024"
+	.ascii	"\216\232J \327\370\"1\233C\310f\363\315!\302M\327}\213\\\023"
+	.ascii	"n\262hIB\331\226\200qDT\301\330D*\265\013\267+\200F\034\221)"
+	.ascii	"\214\357j\002\205\212\345\214\343\n/\221\314\243\027\255\373"
+	.ascii	"\272\030j\217v\232"
+	.string	")\220\332\026EK\344\003x\366\321M\001\231D\272h\341f\361FBn\022I\304|\217\206\\\270}\215\026\030_\342\b\346\221\214\022b\264\0210\276\305\246\013\267\257\232l\221\226\255r-a|+\354\030\355\f\235&\363\350\230d\032\r\301\311\366\347\270l]\034[\3678\004\017\035\221\312\013\356\321\214\026EKd\362\270lM"
+	.ascii	":&\231FM\3675j\341&a\230\371\032\265p\217L\345\213l\203n$\324"
+	.ascii	"L2_x\371F\320\034*B\022-\231%x\224o;\304\204\221\332\241\242"
+	.ascii	"%2\306\320\321\225\201$\002\032J&\221/\206\216\025\340!\021 "
+	.ascii	"\340%\022i7S\314h\223\256\t\345\3336\221&\232@\017:\363\310}"
+	.ascii	"=\300L\346\353!\2479\344\302-Lb\206q\351\026\275\256\322\305"
+	.ascii	"\220d2I\030R\227(4\333\007\030\031ad\f\026EK\244\362m\177\340"
+	.ascii	"\241f\nW\211\2047\374\266pSU\341\241\021\360\022\211D\274\213"
+	.ascii	"\017\">\204\b\341\302\003!\240{\340A\t\n\032p\002\002\266Q\310"
+	.ascii	"}\231\306!#\221\007#\221\207%\262Uz0\276M\017B\031\340%\022\263"
+	.ascii	"\204\213\344\"a\240\370?\307\r\335\323A\203p\256M\215A\350R3"
+	.ascii	"c\313y\n\212\025\316e\375\354Y\323\023\"\227\265\tMf9Nr\320\314"
+	.ascii	"r\326\376F\360\232r\245u6\317Y\313i\002$\320pJ\223\0345\300."
+	.ascii	"<B}\270CCN\311WN\032\212\206\210$P\013\340\331\330\376s\230\024"
+	.ascii	"o<\r\317\320d\235\223$=L\"\201\223\211.+\2477\2568V\312Y\222"
+	.ascii	"\243\3449I\236~}\345\301Y\313V\347N\227\230\\\r$R\310\330\266"
+	.ascii	"\236 Y\204qN\325\0071\257G\024\2641vK\217\227X\223:\261\265+"
+	.ascii	"\214\225 \335\221u+\013\206\331;\013\323_K\316\224\334\031\321"
+	.ascii	"\\Ie\336\214\200Y\361\004.\241j+\262\312"
+	.string	"\025\367\216\230YBd=[\203\313\3622\204\335\321\363\264\245\206P\b\333\265\333\312\no|E\021&\rn\005a\211<\331j\242&\353\034 i\007\016\017\017\017\343\304\261R\016\220\234\343\225\323\365\034 \357!\356\2319)\255\332\0049\0369\\9Z9<r~\240UU\201\005\300B\325\305e0\316\302\301\341\317\331z\316\0178O\206\374e\235\343C\177\331\2501\006JN\217\021Q\317\2678\216{\210]K\272\256\262\326$\355fU\247F\207Z\230cU\006G)\307v\262\243\347\203\315\031\254]FL\263\366\264\004\207\026\225\316\311\034\230\033\352\230\034\246\243\357\307U\326\373\"\265d\265\325l#B\210\364\250Z\022\363\324\301\227C\245\nj\371\241\304\227cC\r\022&\356\317o\212\270\265\363\207\326&L\212u\272 L\252\353\231\355\bm\304\345@m*\236A.d\236r\236V/P\230\240\201\313q\332@\326"
+	.string	"N\311\345\324 \342 N\201\263\026\227\323\244>\321\350\261\346/\353\023=r\224rh\3440\345(\251Xh\\\205\306\007\224\240Y\316\022\340>A\244h\230\223\224\023\027\r\003\211\346\250\344C\316\221E\216\321\3440\230)1\320)\307\020\325\224h"
+	.string	"\203\026"
+	.string	"0X0\032\016\t\373\344\366\024"
+	.string	"\031o\304hn:\036II\214\204\0242\300"
+	.string	"\002@@7\350!"
+	.string	"\247/\216\213%4\257p\230\245\362\236IM\264/a\2350 \\1&\007\225j\266\306\031\325\375\231\370\261\243D\352\247\241\0233\235um\212\025Z\335|\306\355\341[\262"
+	.string	"6\247\263\235\032\226 \332\n\002\305\364\336\366\262\244\345Y\016\364\t\317\227\222\273\242Q\226\330.1\026\345\236\230\373E\022yZ\002H\003^T\367\230]\031\237\001\310o~\271ts\205b\021\305g\302\231\276y\373\340\271\240xp\324^$\004\215\220K\024\226\326c\2247RGyGS\236f\311\350`q\220\305j`\fR\004\004\254\356S\347\346Dz[\017\207B\304i2\216\336C\342\300\310\307\017\311Q\257x\252\306\005\024\355\032\256(B\334\213n\007\306\377\243[\346\004\271\345\327\t5\222\324|\211\274N\245z\004 .[\2478\271_\261\346\013\265\266w\240\231J#E\347%\306\016\364Kx\"\226\210\303\244\013\216\"{/\267B3\212\345M\352\022\\q\034*\372V6\340\374\357\353\025\273\321w\374\033\203q\302\273\322A\362"
+	.string	"+s1\210\033\361BF:8\312\350\334\201e\307\300\035\3052p\353*\026o\316\230h\270\270\374\365z\330,H\350\224\r\035,\277\246B\254\201\301Xr\002\237\001$\321Q\327\222 \263c9\267B\350\026\016gx\374p\315\243\240;\274\257\371\t7\025\030\332\203\246\276\030\360,\312|Dt\205q\200aD\233A\363\374m\2339`\216o#;\252\216X\346\301\373\005(\304^\210\023l/\310\254/k\220\272\036\3261\234\337q\003@\261\016\332~\370\257\367\2543\\\002\021\353\251\207\251\256\255\237F\030r\271w\265\312\027\261\376\224Ax\243=\255\033\303b\313\334\024Va}r\b\323@$,\261\033\302a-\374\210\300\240\215`"
+	.string	"\247J\232\364\355\361|\255S\n)\372\363\027\330X\232\216R\361\300\261\213\027DC\216|\213\206\r\205\202\366$JJz\346\251\002\252\013,3\230m\261\256\365\233\030\362\337\226\237\247j\350y\3672\003\207T\317\225\357\251R\030\027T\264aE\241\373\334\227"
+	.string	"\021trF\221^\372@\264?\357*1\177\021\210c=Q\223\2246\003+\203\224l@\275\3635\"\277\350)~R\314\255)\3363\206\376\3556\377\026B[\022e\330\331\200\243\022\330\376/'\244\375\016\257\017X\233\2474\230\n\367\n\314\334~r\200'O\320\200\005\001\216\007bL\213.\013\260\033\340`\001\3636\320\020i\030\\<uB\f\024E(\220z\345\272\276\333\202R\201\323\321\231{\264(4\216\2663\203\357\331\204\317BcE\333s\301\025{\212C\351\327z\317\221\001."
+	.ascii	"\250\374\263G}\024\352<\220-\223\276\262d\243\244\017>1\210\237"
+	.ascii	"Q\320\246\357Y)(\007kJ\tF\2068\374\353\221\251]\245h\217\350"
+	.ascii	"q\260,S}\350\256\037%i\310Sk\t\025B\210\304K\373\nY\373\234\215"
+	.ascii	"\tZ\207|\337\304i"
+	.string	"\261\022\275V\007\245\340@\355\tP\243\343z)\325\356\b\317H-\356\2179\241\320\336H\037\315\341\354h\340o\373\301\273\005@ (\324)\342\024\267(\332:\026\005S\265\035\351\234sBCM\247\026s:K\007G\036Z\265z\327\226\227-\020p\245E\231\363 \205\320\210\2309\215\r\331\231\352+\02148\320\2367\003LB\337@\356\344\317\207\033/\3612\337=\274s\310|\0271*\265]\315\236\315\020\005,\222\362\005v\002\356\005Q\211A\001\020\230\325t\201\275\217 \016\325\271,\037\215\224\362\237\230\033F\266\262\327\340+4\340EK\205\332\036J\316\347\377zm\320!\345\025\355\344\017\357(\323\326q\334\331\254\364\b\036\033\272\270\220\376\212e|zu\334\336\230r\2363P4\224(\177\by\276\332\r\271\037G\032I\340\364\204\207\367\033iY\301\256N[\256\206\232K\202YG\213\224\320\356\217\233\241\304\354"
+	.string	"\350\267h\177\250*\270ur>e\365n\217D\341\021\030%"
+	.ascii	"y\f\206\3621\006\"\272\313\254+R\020\260\337}\036\275\314\231"
+	.ascii	"\366]\251\025|\337<{GG\334R\236\365\256\204<w_\0374\200~B\202"
+	.ascii	"\321\330m"
+	.string	"\3233\246\341\230(\337K\346\307\\\266\362\005<Go\232*g\322Xz\201e\202\005V\004\235\352~\350\300\344\322\361\245\2545\241\252\005\255* \323\034\324\307)?\002\357D\270\t\023&\313\243;\213T\220!D\264\027\"\353/\200\326\305\304\371\226O;\025\363\377\343\325):\230\245~DC\211\247\314\307)\257\246SYVz\311\224\221\002\264\212\034Pd\362w\004\300\233\227B\351\353\360h\026\332\247\276\337\017\253\224\037\303\f\350\032\252T\241\251\301\366\237\313\342A\r\226x\363\n\352Qm\231t(U'b\035\312l\001?iY\3359L"
+	.string	"t[\275\177\206\201\352J\205\341\034bwA\360\206\326\005\374\352\013-\254\262#\264w\334T49\353Z+>\f'r\325`\210\222ELx3|%\212h\365e\276/J\252\351\321\244\370Ku\220&\301;\216\361\317\263\250\3317\2465\241\0018\267\032]\f#\n|\302\262#\363\234.L\006!m\032\343E\347\365qS\213\301j%#apn\341\307TD-\007-<n\214m\007s3\303\013\204\271\331\204<\251\353\222\306\330\201q\302|\306\337\236\\\006\320\232=\227\240\332N,\177]h\371A\346\324Vy\"j16\216c.\276\340\031\366\326\306#3\344d\316\240\023\230\364\005\306\2634<\262\377\005\363\203\036\240\036#\327;\332\320\211\327O\020ltj`\004m\214\360\326\035\3357\003{\210\322\334\017\315\321g\030\243#\357\324/\t\244\363\224"
+	.ascii	"-b\234H\2262\370\245\253\317\211\022\332\365(\214\t\\X\255\334"
+	.ascii	"E\3667_9\314\320\323e}\350\346\306\317t\013\017-\201sl~\305\226"
+	.ascii	"(r\ba\025\355lk\330\026\354\032\004\243\331uVcz\254:R\357\232"
+	.ascii	"\241\253\373\257lv\377\336\236\001a\220\2253\002^\013\020\325"
+	.ascii	"\244\203G\261\t\r\0056\212\336\225"
+	.string	"\246D\021\326\350\020\340S\327\020a\256\362\306\375\222\266\001a\007\276m\027Oi\201\316\214\254\332*\002r\362\242\255\2659\204\233B\310\302\203\003\0309U:\271g\207\264\227\023\371\371\205. f\272\254`e\325)H\007\273x\237\253\200s\251;\005t\351\177M\313\202\252/7,\0239\214AT\317\300\274\021Ae_\2668\272u\t \351g\024\322\213_\032\034\327x\370\245\213\225!\252G\213\211\356\300\b\357\220G\275\337\220\2504\003\226\306\021\356Y\242D\233\017%}\323W\273\207LTf!\246\200\225\350\243\332\240\302\016\307\023`\312\200G\336Ea\371E\266i\362#>`\307}'\245C\310d\365i\177\300Q9\325\314\262;;\374[S\210D\262\241U\373bQU\374\206\345\001-\327\355\rw\377$\341\234j\205\204\370\266F\210\033\247\326\277E\357\n\341\251x\036H\247%\005\351Jt\313\326\200\007\027\333"
+	.string	"\032\374\373\r)\237\221-r\305\265Pi\327\233H LT\377\241\302\253T\340\311u\261\311\356\374\200\244\262\2240\017\374[\t7\223\3320\2456\361\367\227\026\363\311\262\361p\001\032\r\346"
+	.string	"\207\365\3132"
+	.string	"r\205vIs)\fU|\241e\340\374\241m\370\257Q\366\r T\205\340\264c\266\265\357\004\274p"
+	.ascii	"\366M\225\260k\317%\333\226\321l\216\321iHP\267\212YV\273]+\360"
+	.ascii	"]\201cp\224i\331\222t?\205\020Z\211j\346^\201\353\361\337\234"
+	.ascii	"\303\365\270\365\312\3371\246yf|\260l\257ypHI^%\302\207\037\001"
+	.ascii	"E\363\006_F0\350\212bBr\3362b\341+\2733++S\003\244H\013Y\204"
+	.ascii	"y\243k&%\234\273W(\242\276\346\016\372r\307 \013%\025\202\203"
+	.ascii	"\264\232\224\017\346\277\2454\240\004o\364nQ62\022\007A\353\316"
+	.ascii	"\225\001\227!\255\037=\217\2237\251\247=qi`\\n!s\224\004\261"
+	.ascii	"`\350G>U)Q\"\025rly\016\204Rh\314\300!l\307jE\312qj\203\245\215"
+	.ascii	"\2547\300\251\036\372h\243+\244\252\351J\251\"\026q\t~t\027\255"
+	.ascii	"\214\263Q\345V\227q\025\354\206\207\036?\221/}\307+\3638\227"
+	.ascii	"\013\031<<%\235\261l\374\233\373\372\273g~\3523\236\250^\246"
+	.ascii	"\b\216\232jf\320\220\245\220\032\037\372\352\246\371.\276U\236"
+	.ascii	"\2750\242\231\326\2164\3622J\370\353\230.~V\301\037\200H^\343"
+	.ascii	"\0309\244k/^\\*\r\356\367\217awg\250\345\2777\233\263\024\003"
+	.ascii	"\322NH\267w\270\304\004\336\006\234`\303\346$\315\035\277i7\005"
+	.ascii	"\376\343\252y\"\222\270\305\203\316\274\260\024\343\357:j\030"
+	.ascii	"sD*\264\257u\240"
+	.string	"\3305P\354\034\320\333\376\027.E\2104\b0\tB\226\r\2252\002\257\n!\0056\316X\357d\221\375\243\331\312\221\250\353\333a\330^.\237\341x4\362\032\353\240\327\210\177\234M\" |\253\2765#ysi\0373\204\317\331C\231\200\013h\t\356D\321\016\001\231&\372Q)\003\227\037\0174T\227@0.\317\363\013\246\\~u\267)\307uN\002\230S\211z\007\314=S\202>\230\027j\311\342W\261\375\304\201\023bI\213\371\261\003\212\032\303}zB\3655\264\321C\357jy\360x)\002\205\235b\210\t\n\037q\256\301\246\317\326\230\230\b\306\355Qo\r\370\220\b\360Y)\305\274E\336\232H\001\342\361C\210\310*))\353\275\035;=;js\t\277\334\202\023\242YPm\340Fj=p3\325\255\271-\366.\017\353+\322s\317XS\2051\261?] \367\240L\245\205\242W\264vO\313\221\304J\202"
+	.string	"\272\361\316\222\036\006~\324\213\371D\343Q\200\303)\036\221u\205d\003\254\023XFl\036\275|:\343\377\356\252\305\312L]\032\217l\235oXG\313\257\311b\246\035@xw\"\201\032\fm\326\334U\332\344\342&\330\342\231s\376\231\302\232W\356\030\314\322\244\213\\\240\020\277\316|*\2100\266\325\026`\004\027\005\255-v\211\340\330\210\257\026h\247A\033\376u\271\020\236\2744c\241\304\326$1XJ\246-^\350\273V\340@\326\350\"[\363\237\257:n\001r\247\301\255r\312\240\356;\347\274\212\0160\212b]4P\221\n\226\353\323\024z\206\211\260.\357\222\0244\215\241\206T\030\361\027j(\243N\017\245\225\337\222g\237>\226\007V\276\203Ad\013.\320%M:6.`\260Hl\365\032\302\202\244\374\262\332%\027e\346\326\016`"
+	.string	"\005\345\273Dh\217\226\265-\260E\267\335\351\354"
+	.string	"\214T\037\232\354\321b\006\213\220PU3\303\327N\237=\022!m\\\257PA\003\334\210\204\311\023\273\307/\017UM\352Ykr\367\033\307Bt&SH\276\352\362@Q_\362\372\030\3030?C'\177\002\0328\272\037.S\241\223\033\352\026'\327\347\276\255@nk^\320$?\245\260\357\232V\224vU\021z\277\274\342\2243\271\310\333\0213\262\2533C9\206\177\251\305D\347\251\210\252\333\217\206\0304\326\332\025.\305\205q\to^\256\264\220I\256\n\273+\275S0\201\342\302\323\305$\370\274\022v\262\210\253\177\227\211^\300\235\304\353\214\240\301\213\327\221\203\310H\355\354\353=\346\325\324U\312=ER\031\3116\375=\256\214\r\303\013YL\032\035&e\\B\035\306\302\233] \025S\027a%\276\277"
+	.ascii	"\"\250]\343\255\013\337x\023|'1\033\\\316[~\030\rZ\240\035\242"
+	.ascii	"\315$\003Y\253\237\016\367b\237G2\213\321\025\361\200`\361\\"
+	.ascii	"u"
+	.string	"\036\016\024\031\257wPa\334\206\367\024+\355\261\035\370\213\022\372\0365\327tE\313\3253y\242\274h\327\362\230>\006\363\2327\311\024\007\352'\303\351pc\ry\026\325\356Y+K\320\245\200\322\346\220\235\377\033\230j\037\370'w\353\205\315\n$+\257\260\350]VM\224\300\t\253\351\032J\342b\267\205\223\366\354\273d2P\203\315\314\013\262jov\353\354\236\256\020'\027\241T)\365\027\361\316\242\226W\017\234\035\310\245\206oD-wz\353\244W\nq&\202\235$\356\207m&og\354S\253_\n\266\324s:\264\252\235\327\346\3371qZgw\031p%\006\256\016\322R\370\330\032\355\335\027\213\217\005\364\007\023\337Q\233\225I0>\310\377\355o\020s\271\b\035\275\323\222Dm\324\241{\306S\"\026\341}\263\304\030\256\034\031\2351\316E\315\377\\\220m\004\352?\276\215\344\30085JN\004\340\332n\340"
+	.string	"<[\305n?\361"
+	.string	"\326\237\036\354\321\276\006,\r\275!\027`\201\3359\032\266B\326'd\375i=\257\360\227\247\303\na\243\220-\304\370\030x$b3\220b%m2\037o\340\006\321\221\273R\023\fDY:[.\321q\242\354\303\323\352\231\370rJ p\030m\033\350\323\365"
+	.string	"}\005~\343m\202\036\353\261\366\316\303\270\305\362e\362\201\3653\337\346a\233\212[\315\001\273\211\032\005\272\314Q\345q\207\2343=H\223\255\346s\350\304\314MvQ\brC\234\177\006a\320\307S\212\236\n!m}\207\024x?\220\006\017`\350l\245>Y\307\\\205&RI\316\270_\324y-\250,\032G\r\002\376\335\030\304UI\373\250\323\2237D\304\357Ck`\207Q\3722z\313\271,J\252-\356\342\222\342\001l;U\312\032S\330>{rxFF,\021\273_\rzy\\@\355\r\360\024\323\277\232\226\360\214ql\234Q<XS\005\247e3"
+	.ascii	")\234\334\225\312\026\355'\356\324\212\027Y\375\335A\374~\216"
+	.ascii	"(FI4\203\323\270\007\304\236\211%9G\373\023d1Ns}\212c\303\307"
+	.ascii	"bI\307\326\245\343K\260\201\355\005"
+	.string	"\030\006\203\035\327$\353M\236\206j\230\007\204\235\226\375\200\203_\2516]\037\251\001K\305\203\263\364\375b\302`\241\333\237\366NJn\226\206qm\203\f\037\n\334\177\234\3733\004\322\273\331\037P\260\305\270\353\210(H\201\311~6)\277\333\254\231\267\223\t2\342\346\201A e!I\025c\325\\5$\004HD\017zM\333&\321/\220\024F\217\202\355\205\323\266NB\333\336S\222\334\204\021\024\021\351*x\215\t\2551\201J\354\020\037\374\210\313(\243\242Aj\311\216\370\tyrHy\\\213\217\006*\241`\327\035t\353\343 \346G\207,\330B\331\303\254\321\263\221\343\304\036\361\242\330\004WM\313\242$\023\313\337\260mk\361\334\332\271(\036\331\254\031\373\205\227{\236H\226\224l\223\005,\310g\266\365\002\n\352\247D\246\2126\031{\302v \006\302\326\345E#\rD\346\006\207\334G\367e\331\242\274\334\002\243t"
+	.ascii	"\211\326\356\346*\031\331\341\274\217\002)]\272/\304z\363\330"
+	.ascii	":\361x\235!\365a\fg\273\270\327\372KY\3255\366\375\224\341\323"
+	.ascii	"b\213D<\344\235\fE\233t@'s\204}\356\370\260F\242\366cJIp\001"
+	.ascii	"\254\250y\"\326x'\347\366\365\354\204\375!\002a3hzsX\204\002"
+	.ascii	"7\336}X1\300\345*\221\250\001\206`\242T\004\213\255'\214T\264"
+	.ascii	"\343\346\372p\216\2268t\263\261i\3508\230= \230/\241=\032\230"
+	.ascii	"G;\227D\210\264.\333pe\212\373\023\205W\374\0212G\032//\b6\214"
+	.ascii	"\336\234\276\t=,f\001]\304L\023\025\260\304\241\254\255\217\031"
+	.ascii	"?\270a\257\265\344\302#F\200\264)*\304D\307\325\332)\037Xv)\337"
+	.ascii	">\240\"\017\373o\201\311\241y\006\204\361\202_\225!\024\213\247"
+	.ascii	"\n\356\001j(\212\230\255`\030z<\260\227\250\254\254\341\327w"
+	.ascii	"\241\325\005K!\372\2428\244\346\363Z\357Z\332 \354\206P}S\316"
+	.ascii	"?\347\230\374\030\366ek\276\241\017\216\204D\345\337\251\301"
+	.ascii	"\321#\304\276\254\361\245\365k\2014\327@\"\013\311\320\222\376"
+	.ascii	"\340\311\375\205\267e\305\264\371\234\005\033=\013\354\352\217"
+	.ascii	"\344\307\"\221+(;A\016\035n\200E>\271\272\200\323\211\307\256"
+	.ascii	"\275\333Q\252\033\254\233\277\256\007V\221\250T!C\266\257\323"
+	.ascii	"\300!\006"
+	.string	"Ybk4\276-b\217s\327\230\354\034\261\245\3067,\021\276\361\006\222M\225H\201\037]\013\005\320\027V\221\211U\261M\f\370\337\313\226\221\275\200X\372\365\302\312\367phw\260\033o}\241\347\307\307\312hO\306\344\314\025\326|\305\336\221\343\236^Q\337\325\354\277\0210v\370\247\373\2017q\3678\214\375\302U,\336\201\001\373\210\340#T~\be\\\244\320\203T\330G\365w\3241\257v.\221\006\017w\206i\302\263\315K\230\314,1'\322\367\022\372v\352=2\205\367C\241\017s\337\317\277K _\316\221\203\2702\207\333c8\364\n\247u\t\037\351F/[\271&W\272MX\177+6\031\216\315R\314\273^\356\361\252\205=i\376\323\201:NcR\225\277C\346N\366>D_\035\342\020r\277\006q\246\036\323H\030\030X|\213\n\311\031w\303\250L\2552\3508\255s\341\353\036\030\367\002\316~\200\306"
+	.string	"\301y\006\362\370\374\354W\3062\036`c\331i\013\250u~\013\227Ou\356\321s\374T\334\231\344\030~\247cIy\021\004\257\006\342\034*<\276\013\376\026n\231\030\307H\264d|\213\301\311\253\207\274=v\341\036\367\223\351\274\214\353\202\355:\032\317+\267\370\177\301\362d\016\207\271\357U\210\177e\013{U\034\brSy\037\354\314\365\227\260\253\t\035\"\310&\321\2571\341Rc\347\245>X\275M\324\377W\256\345\327\336\202\334\006\025j\374\337g\272\352\341\317\227\3577\216\363.T\371\003\370W\253\362/\322\247t\220E\334b\276\330\240\375\021\275\227Y\246\210b\240*\\@\325b\342\237\037a\032\223#\225\365\341\344\201\374\357#\322\007G'\b~\252\302)\"\367(\203a\336\203`\032\245\026w'\326Q\257\033\234\003\336\267o\216\275\301\242%D\276\234\020#\275\300{\255\333\257\235S\272\355\331\372j\367"
+	.ascii	"L\371z\355\367\3373\360\254W:\270\255yCU\236\3364\003\340\247"
+	.ascii	"\307O\350\276\360\313\253\016\362\333R\336\330\256wf,\021\211"
+	.ascii	"\233\037[E\237;q\030\262\303=SD\2478\322e\020o\034\374\225F\303"
+	.ascii	"\231\224\025\307\303\004\223\315]\265~\374\007"
+	.text
+	.section	.gnu.lto_.symtab.4a22160a496eb4a0,"e",@progbits
+	.string	"isCalibrating"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"getAxisRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"annexCode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"headFreeModeHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\244\002"
+	.string	""
+	.string	"getDisarmReason"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"emergencyArmingUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"releaseSharedTelemetryPorts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"processRx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"taskGyro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"cycleTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"dT"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"motorControlEnable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"taskRunRealtimeCallbacks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"taskUpdateRxCheck"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"taskUpdateRxMain"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"getFlightTime"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"fcReboot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"averageSystemLoadPercent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"globalFunctionsFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\002"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\003"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"calculateCosTiltAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\003"
+	.string	""
+	.string	"logicConditionReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"V\003"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\003"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"accIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\003"
+	.string	""
+	.string	"navIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"pitotIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"baroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\003"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"isNavLaunchEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"areSticksDeflectedMoreThanPosHoldDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"navigationIsBlockingArming"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\003"
+	.string	""
+	.string	"isHardwareHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\003"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\236\003"
+	.string	""
+	.string	"warningLedFlash"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"warningLedUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\003"
+	.string	""
+	.string	"rcLookup"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\003"
+	.string	""
+	.string	"applyDeadband"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\003"
+	.string	""
+	.string	"failsafeUpdateRcCommandValues"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\003"
+	.string	""
+	.string	"rcLookupThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\003"
+	.string	""
+	.string	"failsafeApplyControlInput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"failsafeShouldApplyControlInput"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"blackboxFinish"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"findNextSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\003"
+	.string	""
+	.string	"mspSerialReleasePortIfAllocated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\004"
+	.string	""
+	.string	"findSharedSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\004"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\004"
+	.string	""
+	.string	"navigationPositionEstimateIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\004"
+	.string	""
+	.string	"blackboxStart"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\004"
+	.string	""
+	.string	"resetHeadingHoldTarget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\004"
+	.string	""
+	.string	"mspSerialAllocatePorts"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\004"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\004"
+	.string	""
+	.string	"autotuneUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\004"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\004"
+	.string	""
+	.string	"pidResetErrorAccumulators"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\004"
+	.string	""
+	.string	"calculateRollPitchCenterStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\004"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\004"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"failsafeRequiresAngleMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\004"
+	.string	""
+	.string	"navigationRequiresAngleMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\004"
+	.string	""
+	.string	"processRcAdjustments"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\004"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\004"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\004"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\004"
+	.string	""
+	.string	"processAirmode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\004"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\004"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\004"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\004"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\004"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\004"
+	.string	""
+	.string	"updateRSSI"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\004"
+	.string	""
+	.string	"calculateRxChannelsAndUpdateFailsafe"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\004"
+	.string	""
+	.string	"opflowGyroUpdateCallback"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\004"
+	.string	""
+	.string	"gyroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\004"
+	.string	""
+	.string	"gyroSyncDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"getLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\004"
+	.string	""
+	.string	"gyroSyncCheckUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\004"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"getTaskDeltaTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\004"
+	.string	""
+	.string	"blackboxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\004"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\004"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\004"
+	.string	""
+	.string	"isServoOutputEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"processServoAutotrim"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\004"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\004"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\004"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\004"
+	.string	""
+	.string	"updatePIDCoefficients"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\004"
+	.string	""
+	.string	"getThrottleIdleValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\004"
+	.string	""
+	.string	"navigationRequiresThrottleTiltCompensation"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"applyWaypointNavigationAndAltitudeHold"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\004"
+	.string	""
+	.string	"updatePositionEstimator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\004"
+	.string	""
+	.string	"updateWaypointsAndNavigationMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\004"
+	.string	""
+	.string	"rcInterpolationApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\004"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\004"
+	.string	""
+	.string	"imuUpdateAccelerometer"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\004"
+	.string	""
+	.string	"updateAccExtremes"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\004"
+	.string	""
+	.string	"isFixedWingLaunchFinishedOrAborted"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\004"
+	.string	""
+	.string	"isFixedWingLaunchDetected"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"rxUpdateCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\005"
+	.string	""
+	.string	"systemReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\005"
+	.string	""
+	.string	"systemResetToBootloader"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\005"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\005"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\005"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4a22160a496eb4a0,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
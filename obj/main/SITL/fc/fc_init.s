@@ -0,0 +1,22317 @@
+	.file	"fc_init.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/common/time.h"
+	.file 4 "./src/main/blackbox/blackbox.h"
+	.file 5 "./src/main/build/debug.h"
+	.file 6 "./src/main/common/color.h"
+	.file 7 "./src/main/common/log.h"
+	.file 8 "./src/main/drivers/resource.h"
+	.file 9 "./src/main/drivers/adc.h"
+	.file 10 "./src/main/drivers/flash.h"
+	.file 11 "./src/main/drivers/persistent.h"
+	.file 12 "./src/main/flight/mixer.h"
+	.file 13 "./src/main/drivers/pwm_mapping.h"
+	.file 14 "./src/main/drivers/system.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/fc/runtime_config.h"
+	.file 17 "./src/main/flight/pid.h"
+	.file 18 "./src/main/io/beeper.h"
+	.file 19 "./src/main/io/osd.h"
+	.file 20 "./src/main/io/serial.h"
+	.file 21 "./src/main/fc/rc_modes.h"
+	.file 22 "./src/main/sensors/sensors.h"
+	.file 23 "./src/main/scheduler/scheduler.h"
+	.file 24 "./src/main/fc/fc_init.c"
+	.file 25 "./src/main/fc/fc_tasks.h"
+	.file 26 "./src/main/sensors/battery.h"
+	.file 27 "./src/main/io/vtx_ffpv24g.h"
+	.file 28 "./src/main/io/vtx_tramp.h"
+	.file 29 "./src/main/io/vtx_smartaudio.h"
+	.file 30 "./src/main/io/vtx.h"
+	.file 31 "./src/main/drivers/vtx_common.h"
+	.file 32 "./src/main/io/vtx_control.h"
+	.file 33 "./src/main/sensors/pitotmeter.h"
+	.file 34 "./src/main/sensors/barometer.h"
+	.file 35 "./src/main/sensors/gyro.h"
+	.file 36 "./src/main/telemetry/telemetry.h"
+	.file 37 "./src/main/navigation/navigation.h"
+	.file 38 "./src/main/io/gps.h"
+	.file 39 "./src/main/uav_interconnect/uav_interconnect.h"
+	.file 40 "./src/main/rx/rx.h"
+	.file 41 "./src/main/flight/failsafe.h"
+	.file 42 "./src/main/fc/cli.h"
+	.file 43 "./src/main/fc/fc_msp.h"
+	.file 44 "./src/main/flight/imu.h"
+	.file 45 "./src/main/sensors/initialisation.h"
+	.file 46 "./src/main/cms/cms.h"
+	.file 47 "./src/main/sensors/boardalignment.h"
+	.file 48 "./src/main/drivers/bus.h"
+	.file 49 "./src/main/config/feature.h"
+	.file 50 "./src/main/flight/servos.h"
+	.file 51 "./src/main/common/global_variables.h"
+	.file 52 "./src/main/io/osd_dji_hd.h"
+	.file 53 "./src/main/msp/msp_serial.h"
+	.file 54 "./src/main/drivers/timer.h"
+	.file 55 "./src/main/drivers/light_led.h"
+	.file 56 "./src/main/drivers/io.h"
+	.file 57 "./src/main/common/printf.h"
+	.file 58 "./src/main/drivers/time.h"
+	.file 59 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_init.c.60aebcf0
+	.weak	fc_init.c.60aebcf0
+fc_init.c.60aebcf0:
+	.long	0x1219
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF3311
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2741
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2742
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2743
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2744
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2745
+	.uleb128 0x7
+	.long	.LASF2747
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2746
+	.uleb128 0x7
+	.long	.LASF2748
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x7
+	.long	.LASF2749
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2750
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2751
+	.uleb128 0x7
+	.long	.LASF2752
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	.LASF2753
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x7
+	.long	.LASF2754
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x7
+	.long	.LASF2755
+	.byte	0x3
+	.byte	0x1e
+	.byte	0x12
+	.long	0x9d
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2756
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2757
+	.uleb128 0xd
+	.long	.LASF2862
+	.byte	0x8
+	.byte	0x4
+	.byte	0x18
+	.long	0x111
+	.uleb128 0x4
+	.long	.LASF2758
+	.byte	0x4
+	.byte	0x19
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2759
+	.byte	0x4
+	.byte	0x1a
+	.byte	0xe
+	.long	0x91
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2760
+	.byte	0x4
+	.byte	0x1b
+	.byte	0xd
+	.long	0x85
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2761
+	.byte	0x4
+	.byte	0x1c
+	.byte	0xd
+	.long	0x85
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2762
+	.byte	0x4
+	.byte	0x1d
+	.byte	0xd
+	.long	0x85
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2763
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x3
+	.long	0xc3
+	.uleb128 0xe
+	.long	0x111
+	.uleb128 0xa
+	.long	.LASF2764
+	.byte	0x4
+	.byte	0x20
+	.byte	0x19
+	.long	0x111
+	.uleb128 0xa
+	.long	.LASF2765
+	.byte	0x5
+	.byte	0x18
+	.byte	0x10
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x15
+	.long	0x159
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x15
+	.long	0x1ae
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0xb
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2781
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2782
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x2ad
+	.uleb128 0x1
+	.long	.LASF2783
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2784
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2785
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2786
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2787
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2788
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2789
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2790
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2792
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2797
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2801
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x43
+	.long	0x338
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x14
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x16
+	.long	0x363
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2847
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x45
+	.long	0x3b3
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2854
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x1e
+	.long	0x3d2
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2861
+	.byte	0xb
+	.byte	0x22
+	.byte	0x3
+	.long	0x3b3
+	.uleb128 0xd
+	.long	.LASF2863
+	.byte	0x1c
+	.byte	0xc
+	.byte	0x53
+	.long	0x46d
+	.uleb128 0x4
+	.long	.LASF2864
+	.byte	0xc
+	.byte	0x55
+	.byte	0xe
+	.long	0x91
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2865
+	.byte	0xc
+	.byte	0x56
+	.byte	0xe
+	.long	0x91
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2866
+	.byte	0xc
+	.byte	0x57
+	.byte	0xe
+	.long	0x91
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2867
+	.byte	0xc
+	.byte	0x58
+	.byte	0xd
+	.long	0x85
+	.byte	0x6
+	.uleb128 0x4
+	.long	.LASF2868
+	.byte	0xc
+	.byte	0x59
+	.byte	0xe
+	.long	0x91
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF2869
+	.byte	0xc
+	.byte	0x5a
+	.byte	0xe
+	.long	0x91
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF2870
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xe
+	.long	0x91
+	.byte	0xc
+	.uleb128 0x4
+	.long	.LASF2871
+	.byte	0xc
+	.byte	0x5c
+	.byte	0xb
+	.long	0xbc
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF2872
+	.byte	0xc
+	.byte	0x5d
+	.byte	0xb
+	.long	0xbc
+	.byte	0x14
+	.uleb128 0x4
+	.long	.LASF2873
+	.byte	0xc
+	.byte	0x5e
+	.byte	0xd
+	.long	0x85
+	.byte	0x18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2874
+	.byte	0xc
+	.byte	0x5f
+	.byte	0x3
+	.long	0x3de
+	.uleb128 0xe
+	.long	0x46d
+	.uleb128 0xa
+	.long	.LASF2875
+	.byte	0xc
+	.byte	0x61
+	.byte	0x16
+	.long	0x46d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x27
+	.long	0x4d3
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2884
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x1a
+	.long	0x50a
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2893
+	.byte	0xe
+	.byte	0x22
+	.byte	0x3
+	.long	0x4d3
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x26
+	.long	0x612
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2895
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2896
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2897
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2898
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2899
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2900
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2901
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF2902
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF2903
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF2904
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF2905
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF2906
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF2907
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF2908
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF2909
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF2910
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF2911
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF2912
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF2913
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF2914
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF2915
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF2916
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF2917
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF2918
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF2919
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF2920
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF2921
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF2922
+	.long	0x10000000
+	.uleb128 0x2
+	.long	.LASF2923
+	.long	0x20000000
+	.uleb128 0x2
+	.long	.LASF2924
+	.long	0x40000000
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2925
+	.byte	0x17
+	.byte	0xf
+	.byte	0x48
+	.long	0x67a
+	.uleb128 0x4
+	.long	.LASF2926
+	.byte	0xf
+	.byte	0x49
+	.byte	0xd
+	.long	0x85
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2927
+	.byte	0xf
+	.byte	0x4a
+	.byte	0xd
+	.long	0x85
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF2928
+	.byte	0xf
+	.byte	0x4b
+	.byte	0xd
+	.long	0x85
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF2929
+	.byte	0xf
+	.byte	0x4c
+	.byte	0xd
+	.long	0x85
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF2930
+	.byte	0xf
+	.byte	0x4d
+	.byte	0xd
+	.long	0x85
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2931
+	.byte	0xf
+	.byte	0x4e
+	.byte	0xd
+	.long	0x85
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF2932
+	.byte	0xf
+	.byte	0x4f
+	.byte	0xa
+	.long	0x67a
+	.byte	0x6
+	.byte	0
+	.uleb128 0x11
+	.long	0x7e
+	.long	0x68a
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2933
+	.byte	0xf
+	.byte	0x50
+	.byte	0x3
+	.long	0x612
+	.uleb128 0xe
+	.long	0x68a
+	.uleb128 0xa
+	.long	.LASF2934
+	.byte	0xf
+	.byte	0x52
+	.byte	0x17
+	.long	0x68a
+	.uleb128 0x18
+	.long	.LASF3312
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x3b
+	.byte	0x18
+	.byte	0xe
+	.long	0x71a
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x1
+	.uleb128 0x19
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2937
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2940
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2941
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2942
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2943
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2944
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2945
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2946
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2947
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2948
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2949
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x15
+	.long	0x7e6
+	.uleb128 0x1
+	.long	.LASF2950
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2951
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2952
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF2953
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF2954
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF2955
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF2956
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF2957
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF2958
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF2959
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF2960
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF2961
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF2962
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF2963
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF2964
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF2965
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF2966
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF2967
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF2968
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF2969
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF2970
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF2971
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF2972
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF2973
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2974
+	.byte	0x10
+	.byte	0x47
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x6c
+	.long	0x8b8
+	.uleb128 0x1
+	.long	.LASF2975
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2976
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2977
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2978
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2979
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2980
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2981
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2982
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF2983
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF2984
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF2985
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF2986
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF2987
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF2988
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF2989
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF2990
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF2991
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF2992
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF2993
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF2994
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF2995
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF2996
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF2997
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF2998
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF2999
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3000
+	.byte	0x10
+	.byte	0x8c
+	.byte	0x11
+	.long	0x9d
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x39
+	.long	0x919
+	.uleb128 0x1
+	.long	.LASF3001
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3002
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3003
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3004
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3005
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3006
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3007
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3008
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3009
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3010
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3011
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3012
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x16
+	.long	0x9bc
+	.uleb128 0x1
+	.long	.LASF3013
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3014
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3015
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3016
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3017
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3018
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3019
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3020
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3021
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3022
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3023
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3024
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3025
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3026
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3027
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3028
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3029
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3030
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3031
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3032
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3033
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3034
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3035
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3036
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3037
+	.byte	0x18
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x2e
+	.long	0xc57
+	.uleb128 0x1
+	.long	.LASF3038
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3039
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3040
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3041
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3042
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3043
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3044
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3045
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3046
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3047
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3048
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3049
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3050
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3051
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3052
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3053
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3054
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3055
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3056
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3057
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3058
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3059
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3060
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3061
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3062
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3063
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3064
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3065
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3066
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3067
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3068
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3069
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3070
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3071
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3072
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3073
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3074
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3075
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3076
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3077
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3078
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3079
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3080
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF3081
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF3082
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF3083
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF3084
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF3085
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF3086
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF3087
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF3088
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF3089
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF3090
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF3091
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF3092
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF3093
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF3094
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF3095
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF3096
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF3097
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF3098
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF3099
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF3100
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF3101
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF3102
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF3103
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF3104
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF3105
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF3106
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF3107
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF3108
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF3109
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF3110
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF3111
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF3112
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF3113
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF3114
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF3115
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF3116
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF3117
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF3118
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF3119
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF3120
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF3121
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF3122
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF3123
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF3124
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF3125
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF3126
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF3127
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF3128
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF3129
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF3130
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF3131
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF3132
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF3133
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF3134
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF3135
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF3136
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF3137
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF3138
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF3139
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF3140
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF3141
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF3142
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF3143
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF3144
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF3145
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF3146
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x6
+	.byte	0x5
+	.long	0x64
+	.byte	0x14
+	.byte	0x52
+	.long	0xcb2
+	.uleb128 0x1a
+	.long	.LASF3147
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF3148
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3149
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3150
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3151
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3152
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3153
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3154
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3155
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3156
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3157
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3158
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3159
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3160
+	.byte	0x14
+	.byte	0x60
+	.byte	0x3
+	.long	0xc57
+	.uleb128 0xd
+	.long	.LASF3161
+	.byte	0xc
+	.byte	0x14
+	.byte	0x73
+	.long	0xd19
+	.uleb128 0x4
+	.long	.LASF3162
+	.byte	0x14
+	.byte	0x74
+	.byte	0xe
+	.long	0x9d
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3163
+	.byte	0x14
+	.byte	0x75
+	.byte	0x1c
+	.long	0xcb2
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF3164
+	.byte	0x14
+	.byte	0x76
+	.byte	0xd
+	.long	0x85
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF3165
+	.byte	0x14
+	.byte	0x77
+	.byte	0xd
+	.long	0x85
+	.byte	0x9
+	.uleb128 0x4
+	.long	.LASF3166
+	.byte	0x14
+	.byte	0x78
+	.byte	0xd
+	.long	0x85
+	.byte	0xa
+	.uleb128 0x4
+	.long	.LASF3167
+	.byte	0x14
+	.byte	0x79
+	.byte	0xd
+	.long	0x85
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3168
+	.byte	0x14
+	.byte	0x7a
+	.byte	0x3
+	.long	0xcbe
+	.uleb128 0xd
+	.long	.LASF3169
+	.byte	0x64
+	.byte	0x14
+	.byte	0x7c
+	.long	0xd4c
+	.uleb128 0x4
+	.long	.LASF3170
+	.byte	0x14
+	.byte	0x7d
+	.byte	0x18
+	.long	0xd51
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF3171
+	.byte	0x14
+	.byte	0x7e
+	.byte	0xd
+	.long	0x85
+	.byte	0x60
+	.byte	0
+	.uleb128 0xe
+	.long	0xd25
+	.uleb128 0x11
+	.long	0xd19
+	.long	0xd61
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF3172
+	.byte	0x14
+	.byte	0x7f
+	.byte	0x3
+	.long	0xd25
+	.uleb128 0xe
+	.long	0xd61
+	.uleb128 0xa
+	.long	.LASF3173
+	.byte	0x14
+	.byte	0x81
+	.byte	0x17
+	.long	0xd61
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x15
+	.byte	0x1c
+	.long	0xe8d
+	.uleb128 0x1
+	.long	.LASF3174
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3175
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3176
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3177
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3178
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3179
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3180
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3181
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3182
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3183
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3184
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3185
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3186
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3187
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3188
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3189
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3190
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3191
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3192
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3193
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3194
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3195
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3196
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3197
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3198
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3199
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3200
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3201
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3202
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3203
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3204
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3205
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3206
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3207
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3208
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3209
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3210
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3211
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3212
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3213
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3214
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3215
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3216
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x16
+	.byte	0x14
+	.long	0xeca
+	.uleb128 0x1
+	.long	.LASF3217
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3218
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3219
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3220
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3221
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3222
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3223
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3224
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x17
+	.byte	0x3a
+	.long	0xf55
+	.uleb128 0x1
+	.long	.LASF3225
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3226
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3227
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3228
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3229
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3230
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3231
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3232
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3233
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3234
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3235
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3236
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3237
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3238
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3239
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3240
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3241
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3242
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3243
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3244
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3245
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF3246
+	.byte	0x18
+	.byte	0x9d
+	.byte	0x10
+	.long	0x85
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x18
+	.byte	0x9f
+	.long	0xf92
+	.uleb128 0x1
+	.long	.LASF3247
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3248
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3249
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3250
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3251
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3252
+	.byte	0x80
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF3313
+	.byte	0x18
+	.byte	0xa8
+	.byte	0x9
+	.long	0x85
+	.uleb128 0xb
+	.long	.LASF3271
+	.byte	0xb
+	.byte	0x2b
+	.long	0xfb4
+	.uleb128 0x9
+	.long	0x3d2
+	.uleb128 0x9
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3253
+	.byte	0x19
+	.byte	0x1f
+	.uleb128 0x3
+	.long	.LASF3254
+	.byte	0x1a
+	.byte	0x82
+	.uleb128 0xc
+	.long	.LASF3255
+	.byte	0x1b
+	.byte	0x29
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0xc
+	.long	.LASF3256
+	.byte	0x1c
+	.byte	0x1f
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0xc
+	.long	.LASF3257
+	.byte	0x1d
+	.byte	0x71
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF3258
+	.byte	0x1e
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF3259
+	.byte	0x1f
+	.byte	0x7e
+	.uleb128 0x3
+	.long	.LASF3260
+	.byte	0x20
+	.byte	0x26
+	.uleb128 0x3
+	.long	.LASF3261
+	.byte	0x21
+	.byte	0x44
+	.uleb128 0x3
+	.long	.LASF3262
+	.byte	0x22
+	.byte	0x3a
+	.uleb128 0x3
+	.long	.LASF3263
+	.byte	0x23
+	.byte	0x7c
+	.uleb128 0x3
+	.long	.LASF3264
+	.byte	0x4
+	.byte	0x24
+	.uleb128 0x3
+	.long	.LASF3265
+	.byte	0x24
+	.byte	0x5d
+	.uleb128 0x13
+	.long	.LASF3266
+	.byte	0x25
+	.value	0x188
+	.uleb128 0x3
+	.long	.LASF3267
+	.byte	0x26
+	.byte	0x9d
+	.uleb128 0x3
+	.long	.LASF3268
+	.byte	0x27
+	.byte	0x35
+	.uleb128 0x3
+	.long	.LASF3269
+	.byte	0x28
+	.byte	0xb6
+	.uleb128 0x3
+	.long	.LASF3270
+	.byte	0x29
+	.byte	0x98
+	.uleb128 0xb
+	.long	.LASF3272
+	.byte	0x2a
+	.byte	0x17
+	.long	0x1053
+	.uleb128 0x9
+	.long	0x1053
+	.byte	0
+	.uleb128 0xf
+	.long	0xd4c
+	.uleb128 0x3
+	.long	.LASF3273
+	.byte	0x2b
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF3274
+	.byte	0x2c
+	.byte	0x4c
+	.uleb128 0xc
+	.long	.LASF3275
+	.byte	0x11
+	.byte	0xaa
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF3276
+	.byte	0xe
+	.byte	0x25
+	.long	0x1083
+	.uleb128 0x9
+	.long	0x50a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF3277
+	.byte	0x2d
+	.byte	0x14
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF3278
+	.byte	0x26
+	.byte	0x9c
+	.uleb128 0x3
+	.long	.LASF3279
+	.byte	0x2e
+	.byte	0x1b
+	.uleb128 0x3
+	.long	.LASF3280
+	.byte	0x2f
+	.byte	0x1e
+	.uleb128 0xc
+	.long	.LASF3281
+	.byte	0xe
+	.byte	0x2b
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0x13
+	.long	.LASF3282
+	.byte	0x30
+	.value	0x128
+	.uleb128 0xc
+	.long	.LASF3283
+	.byte	0xd
+	.byte	0x4e
+	.byte	0x5
+	.long	0xb5
+	.uleb128 0xb
+	.long	.LASF3284
+	.byte	0x31
+	.byte	0x20
+	.long	0x10d5
+	.uleb128 0x9
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3285
+	.byte	0xc
+	.byte	0x7a
+	.uleb128 0x3
+	.long	.LASF3286
+	.byte	0xc
+	.byte	0x7b
+	.uleb128 0x3
+	.long	.LASF3287
+	.byte	0x32
+	.byte	0x9b
+	.uleb128 0x3
+	.long	.LASF3288
+	.byte	0x33
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF3289
+	.byte	0x7
+	.byte	0x2e
+	.uleb128 0x3
+	.long	.LASF3290
+	.byte	0x34
+	.byte	0x3f
+	.uleb128 0x3
+	.long	.LASF3291
+	.byte	0x35
+	.byte	0x69
+	.uleb128 0xb
+	.long	.LASF3292
+	.byte	0x14
+	.byte	0x88
+	.long	0x111c
+	.uleb128 0x9
+	.long	0xb5
+	.uleb128 0x9
+	.long	0xcb2
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF3314
+	.byte	0x31
+	.byte	0x1e
+	.byte	0x5
+	.long	0xb5
+	.long	0x1132
+	.uleb128 0x9
+	.long	0x9d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3293
+	.byte	0x36
+	.byte	0xba
+	.uleb128 0xb
+	.long	.LASF3294
+	.byte	0x37
+	.byte	0x35
+	.long	0x114a
+	.uleb128 0x9
+	.long	0xb5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3295
+	.byte	0x31
+	.byte	0x1c
+	.uleb128 0xb
+	.long	.LASF3296
+	.byte	0xe
+	.byte	0x18
+	.long	0x1162
+	.uleb128 0x9
+	.long	0x85
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF3297
+	.byte	0xf
+	.byte	0x73
+	.uleb128 0x3
+	.long	.LASF3298
+	.byte	0xf
+	.byte	0x75
+	.uleb128 0x3
+	.long	.LASF3299
+	.byte	0xf
+	.byte	0x71
+	.uleb128 0x3
+	.long	.LASF3300
+	.byte	0x38
+	.byte	0x69
+	.uleb128 0x3
+	.long	.LASF3301
+	.byte	0xe
+	.byte	0x17
+	.uleb128 0x3
+	.long	.LASF3302
+	.byte	0x39
+	.byte	0x79
+	.uleb128 0xc
+	.long	.LASF3303
+	.byte	0xf
+	.byte	0x6c
+	.byte	0xa
+	.long	0x9d
+	.uleb128 0xb
+	.long	.LASF3304
+	.byte	0x3a
+	.byte	0x19
+	.long	0x11a9
+	.uleb128 0x9
+	.long	0xa9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3305
+	.byte	0xbb
+	.long	0x11c1
+	.uleb128 0x15
+	.uleb128 0x1d
+	.string	"i"
+	.byte	0x18
+	.value	0x1df
+	.byte	0x12
+	.long	0x64
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3306
+	.byte	0xaa
+	.long	0x11d8
+	.uleb128 0x15
+	.uleb128 0x1e
+	.string	"i"
+	.byte	0x18
+	.byte	0xae
+	.byte	0x12
+	.long	0x85
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF3307
+	.byte	0x14
+	.byte	0x81
+	.byte	0x79
+	.long	0x11e4
+	.uleb128 0xf
+	.long	0xd6d
+	.uleb128 0x10
+	.long	.LASF3308
+	.byte	0xf
+	.byte	0x52
+	.byte	0x79
+	.long	0x11f5
+	.uleb128 0xf
+	.long	0x696
+	.uleb128 0x10
+	.long	.LASF3309
+	.byte	0xc
+	.byte	0x61
+	.byte	0x74
+	.long	0x1206
+	.uleb128 0xf
+	.long	0x479
+	.uleb128 0x10
+	.long	.LASF3310
+	.byte	0x4
+	.byte	0x20
+	.byte	0x83
+	.long	0x1217
+	.uleb128 0xf
+	.long	0x11d
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 60 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 61 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3e
+	.file 63 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x40
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 65 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 66 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x42
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 69 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 71 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x47
+	.file 72 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 77 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 78 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 81 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 82 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x52
+	.file 83 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 84 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x54
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 85 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x55
+	.byte	0x4
+	.file 86 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.file 87 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x57
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3
+	.file 88 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x58
+	.file 89 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 90 "./src/main/blackbox/blackbox_io.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 91 "./src/main/build/assert.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5b
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF970
+	.byte	0x4
+	.file 92 "./src/main/build/atomic.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF971
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 93 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4e
+	.byte	0x4
+	.file 94 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 95 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 96 "./src/main/common/memory.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x60
+	.file 97 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x61
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1066
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x65
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1102
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 102 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x66
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 103 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x67
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1144
+	.byte	0x4
+	.file 104 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x68
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1145
+	.byte	0x4
+	.file 105 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1146
+	.byte	0x4
+	.file 106 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1147
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF698
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1148
+	.file 107 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x6b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1149
+	.file 108 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.file 109 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 110 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 111 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1166
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 112 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x70
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1179
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x71
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x72
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1184
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x73
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x74
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1187
+	.byte	0x4
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x75
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1188
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x76
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1205
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x77
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1206
+	.file 120 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x78
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1207
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 121 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x79
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1219
+	.byte	0x4
+	.file 122 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 123 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x7b
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1226
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1227
+	.byte	0x4
+	.byte	0x4
+	.file 124 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x7c
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1231
+	.file 125 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x7d
+	.byte	0x4
+	.file 126 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x7e
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1232
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1233
+	.file 127 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0x7f
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1248
+	.byte	0x4
+	.file 128 "./src/main/config/config_eeprom.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x80
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1249
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x31
+	.byte	0x4
+	.file 129 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x81
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.file 130 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x82
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 131 "./src/main/cms/cms_types.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x83
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.file 132 "./src/main/drivers/1-wire.h"
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x84
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x30
+	.file 133 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x85
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1377
+	.file 134 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x86
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 135 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x87
+	.byte	0x4
+	.byte	0x4
+	.file 136 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x88
+	.file 137 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x89
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1392
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x4
+	.file 138 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x8a
+	.file 139 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8b
+	.byte	0x4
+	.file 140 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1419
+	.byte	0x4
+	.file 141 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x8d
+	.file 142 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8e
+	.file 143 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8f
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 144 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x90
+	.file 145 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x91
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 146 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x92
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1697
+	.byte	0x4
+	.file 147 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x93
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.file 148 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x94
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.file 149 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x95
+	.byte	0x4
+	.file 150 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x96
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x96
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x95
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x96
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x95
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 151 "./src/main/drivers/flash_m25p16.h"
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x97
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1791
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1792
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.file 152 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x98
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.file 153 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x99
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 154 "./src/main/drivers/io_pca9685.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x9a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.file 155 "./src/main/drivers/nvic.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x9b
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.file 156 "./src/main/drivers/osd.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x9c
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.file 157 "./src/main/drivers/pwm_esc_detect.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x9d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.file 158 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9e
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2225
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x4
+	.file 159 "./src/main/drivers/pwm_output.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x9f
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x4
+	.file 160 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0xa0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2247
+	.byte	0x4
+	.file 161 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0xa1
+	.byte	0x4
+	.file 162 "./src/main/drivers/serial_softserial.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0xa2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2248
+	.byte	0x4
+	.file 163 "./src/main/drivers/serial_uart.h"
+	.byte	0x3
+	.uleb128 0x46
+	.uleb128 0xa3
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x4
+	.file 164 "./src/main/drivers/serial_usb_vcp.h"
+	.byte	0x3
+	.uleb128 0x47
+	.uleb128 0xa4
+	.byte	0x4
+	.file 165 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x48
+	.uleb128 0xa5
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2269
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4b
+	.uleb128 0x36
+	.file 166 "./src/main/drivers/timer_def.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa6
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.file 167 "./src/main/drivers/uart_inverter.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0xa7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x9a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.byte	0x4
+	.file 168 "./src/main/drivers/sdcard/sdcard.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0xa8
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2326
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0xf
+	.file 169 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xa9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2b
+	.file 170 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xaa
+	.file 171 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xab
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5a
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2332
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5c
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5e
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x2c
+	.file 172 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xac
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x61
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.file 173 "./src/main/flight/rpm_filter.h"
+	.byte	0x3
+	.uleb128 0x63
+	.uleb128 0xad
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.file 174 "./src/main/io/asyncfatfs/asyncfatfs.h"
+	.byte	0x3
+	.uleb128 0x65
+	.uleb128 0xae
+	.file 175 "./src/main/io/asyncfatfs/fat_standard.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xaf
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x66
+	.uleb128 0x12
+	.byte	0x4
+	.file 176 "./src/main/io/lights.h"
+	.byte	0x3
+	.uleb128 0x67
+	.uleb128 0xb0
+	.byte	0x4
+	.file 177 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x68
+	.uleb128 0xb1
+	.byte	0x4
+	.file 178 "./src/main/io/displayport_frsky_osd.h"
+	.byte	0x3
+	.uleb128 0x69
+	.uleb128 0xb2
+	.byte	0x4
+	.file 179 "./src/main/io/displayport_msp.h"
+	.byte	0x3
+	.uleb128 0x6a
+	.uleb128 0xb3
+	.byte	0x4
+	.file 180 "./src/main/io/displayport_max7456.h"
+	.byte	0x3
+	.uleb128 0x6b
+	.uleb128 0xb4
+	.byte	0x4
+	.file 181 "./src/main/io/flashfs.h"
+	.byte	0x3
+	.uleb128 0x6c
+	.uleb128 0xb5
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.file 182 "./src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x6e
+	.uleb128 0xb6
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.file 183 "./src/main/io/pwmdriver_i2c.h"
+	.byte	0x3
+	.uleb128 0x6f
+	.uleb128 0xb7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x70
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x71
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.file 184 "./src/main/io/rcdevice_cam.h"
+	.byte	0x3
+	.uleb128 0x72
+	.uleb128 0xb8
+	.file 185 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb9
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2498
+	.file 186 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xba
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2499
+	.file 187 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0xbb
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x4
+	.byte	0x4
+	.file 188 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xbc
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0x4
+	.file 189 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xbd
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0x4
+	.file 190 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xbe
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2503
+	.byte	0x4
+	.file 191 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xbf
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.file 192 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0xc0
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro114
+	.file 193 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0xc1
+	.byte	0x7
+	.long	.Ldebug_macro115
+	.byte	0x4
+	.byte	0x4
+	.file 194 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc2
+	.byte	0x7
+	.long	.Ldebug_macro116
+	.byte	0x4
+	.file 195 "./src/main/io/rcdevice.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc3
+	.byte	0x7
+	.long	.Ldebug_macro117
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.file 196 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xc4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro118
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro119
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro120
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x75
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x76
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2627
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x77
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro121
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro122
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x79
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro123
+	.byte	0x4
+	.file 197 "./src/main/io/piniobox.h"
+	.byte	0x3
+	.uleb128 0x7a
+	.uleb128 0xc5
+	.file 198 "./src/main/drivers/pinio.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xc6
+	.byte	0x7
+	.long	.Ldebug_macro124
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x25
+	.file 199 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc7
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro125
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro126
+	.byte	0x4
+	.file 200 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0xc8
+	.byte	0x7
+	.long	.Ldebug_macro127
+	.byte	0x4
+	.file 201 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x83
+	.uleb128 0xc9
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro128
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro129
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x84
+	.uleb128 0x22
+	.file 202 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xca
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro130
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x86
+	.uleb128 0x2f
+	.byte	0x4
+	.file 203 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x87
+	.uleb128 0xcb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x88
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro131
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x89
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8a
+	.uleb128 0x21
+	.file 204 "./src/main/common/calibration.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xcc
+	.byte	0x4
+	.file 205 "./src/main/drivers/pitotmeter.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xcd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro132
+	.byte	0x4
+	.file 206 "./src/main/sensors/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x8b
+	.uleb128 0xce
+	.file 207 "./src/main/drivers/rangefinder/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xcf
+	.byte	0x7
+	.long	.Ldebug_macro133
+	.byte	0x4
+	.byte	0x4
+	.file 208 "./src/main/sensors/esc_sensor.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0xd0
+	.byte	0x7
+	.long	.Ldebug_macro134
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x8f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro135
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x91
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2734
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x93
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro136
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_io.h.48.d431a1cf6653bca7fad963f04c7375d6,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.10f237ed61a9ae208342a970c4692795,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF984
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1028
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1064
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1129
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1157
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1161
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1178
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1183
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF1186
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1189
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1200
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1204
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1222
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1225
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1235
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1247
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1318
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1376
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1379
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1391
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1409
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1418
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1691
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1696
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1726
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1717
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1718
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1719
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1720
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1738
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1739
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1740
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1741
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1748
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1749
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1750
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1751
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1752
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1753
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1800
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1812
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF2096
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF2097
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF2098
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF2101
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2180
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.20.ee45acdfc1bcd9ce748b7901bfda3b6c,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.nvic.h.9.d6270fc6047e88c0b9bf5c6e1a266829,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2201
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2212
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.persistent.h.37.5d71943596197f41feb5cadd8681802d,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2215
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2224
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2241
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_mapping.h.29.5f2a3671df9c4f1621241af7b58f1e07,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.serial_uart.h.24.0f28fa4eada26eafc53efdd98e73f126,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2268
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timer_def.h.23.cf02736e69c77ad3176d1cefb9272937,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2302
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.timer.h.28.7be56adaa7e0532fcfffd2a29408dca3,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2304
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2325
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2329
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2343
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2351
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rpm_filter.h.46.638ccbdb612f529ec85646b839a0f5ec,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2376
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fat_standard.h.23.98e613171bbc330acb6e09557ea95570,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.flashfs.h.24.874ef25b511654a8375b5076597044fa,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2400
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.23.07e6db349d33c881d752095c9d043f6d,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.cef84115c5f2700d3af586ea6b7bb2c4,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2470
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd_dji_hd.h.34.8e36c80b905d9e2065cf4c2344359f0e,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2496
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2511
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.93.8171f82adf48af92ec67424d5f5b709c,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2524
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2525
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro114:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2530
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF2531
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro115:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2536
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF2537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.23.e4fba624a2c005d3c7022fb9ef0a87ca,comdat
+.Ldebug_macro116:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2553
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2558
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2559
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2561
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2563
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2579
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2580
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2581
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2588
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2591
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2596
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice.h.25.ab71b74eff9152b05356e04bd1f208bf,comdat
+.Ldebug_macro117:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2600
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2601
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2602
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2603
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2608
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro118:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2610
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2611
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2612
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro119:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2613
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2614
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2615
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice_cam.h.29.f99909877ac3f04c1606d791179d7a71,comdat
+.Ldebug_macro120:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2626
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_smartaudio.h.28.85b5c901660a5e59daadbaf4f1d9de33,comdat
+.Ldebug_macro121:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2652
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2653
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_tramp.h.22.0a2ba45823a188c776b8e0bc6ea0c9ca,comdat
+.Ldebug_macro122:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2654
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2655
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2656
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2659
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_ffpv24g.h.37.9acda25633075e4800f829f038c06da9,comdat
+.Ldebug_macro123:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2662
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pinio.h.28.0dab2dfd372b0c89fffb5b699b7b3419,comdat
+.Ldebug_macro124:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2664
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro125:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro126:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2669
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2686
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2692
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2694
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.bf1a22e7b9a2678b107e3bcefbfe40b8,comdat
+.Ldebug_macro127:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro128:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro129:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2703
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2706
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro130:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2707
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro131:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2716
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro132:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2722
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro133:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2725
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.esc_sensor.h.42.85deea106217bb5124375716e7a86067,comdat
+.Ldebug_macro134:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2728
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.35.d0d785404ac74fe33f68f976f92c394d,comdat
+.Ldebug_macro135:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.uav_interconnect.h.38.dae2cc39206b50ac1e1ad20244a99294,comdat
+.Ldebug_macro136:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2740
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x20
+	.long	.LASF1
+	.long	.LASF3315
+	.long	.LASF3316
+	.long	.LASF3317
+	.long	.LASF3318
+	.long	.LASF3319
+	.long	.LASF3320
+	.long	.LASF3321
+	.long	.LASF3322
+	.long	.LASF3323
+	.long	.LASF3324
+	.long	.LASF3325
+	.long	.LASF3326
+	.long	.LASF3327
+	.long	.LASF3328
+	.long	.LASF3329
+	.long	.LASF3330
+	.long	.LASF3331
+	.long	.LASF3332
+	.long	.LASF3333
+	.long	.LASF3334
+	.long	.LASF3335
+	.long	.LASF3336
+	.long	.LASF3337
+	.long	.LASF3338
+	.long	.LASF3339
+	.long	.LASF3340
+	.long	.LASF3341
+	.long	.LASF3342
+	.long	.LASF3343
+	.long	.LASF3344
+	.long	.LASF3345
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0xd1
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3346
+	.byte	0x1b
+	.long	.LASF3347
+	.byte	0x1b
+	.long	.LASF3348
+	.byte	0x4
+	.long	.LASF3349
+	.byte	0x1
+	.long	.LASF3350
+	.byte	0x2
+	.long	.LASF3351
+	.byte	0x4
+	.long	.LASF3352
+	.byte	0x4
+	.long	.LASF3353
+	.byte	0xb
+	.long	.LASF3354
+	.byte	0xb
+	.long	.LASF3355
+	.byte	0xb
+	.long	.LASF3356
+	.byte	0xb
+	.long	.LASF3357
+	.byte	0xd
+	.long	.LASF3358
+	.byte	0xb
+	.long	.LASF3359
+	.byte	0xb
+	.long	.LASF3360
+	.byte	0xc
+	.long	.LASF3361
+	.byte	0xc
+	.long	.LASF3362
+	.byte	0xd
+	.long	.LASF3363
+	.byte	0xf
+	.long	.LASF3364
+	.byte	0xf
+	.long	.LASF3365
+	.byte	0xf
+	.long	.LASF3366
+	.byte	0xc
+	.long	.LASF3367
+	.byte	0x14
+	.long	.LASF3368
+	.byte	0x13
+	.long	.LASF3369
+	.byte	0xc
+	.long	.LASF3370
+	.byte	0xc
+	.long	.LASF3371
+	.byte	0x14
+	.long	.LASF3372
+	.byte	0xf
+	.long	.LASF3373
+	.byte	0xf
+	.long	.LASF3374
+	.byte	0xf
+	.long	.LASF3375
+	.byte	0xf
+	.long	.LASF3376
+	.byte	0xb
+	.long	.LASF3377
+	.byte	0xf
+	.long	.LASF3378
+	.byte	0x14
+	.long	.LASF3379
+	.byte	0x14
+	.long	.LASF3380
+	.byte	0x14
+	.long	.LASF3381
+	.byte	0x17
+	.long	.LASF3382
+	.byte	0x11
+	.long	.LASF3383
+	.byte	0xf
+	.long	.LASF3384
+	.byte	0x18
+	.long	.LASF3385
+	.byte	0x12
+	.long	.LASF3386
+	.byte	0xd
+	.long	.LASF3387
+	.byte	0xc
+	.long	.LASF3388
+	.byte	0xc
+	.long	.LASF3389
+	.byte	0xd
+	.long	.LASF3390
+	.byte	0x14
+	.long	.LASF3391
+	.byte	0x3
+	.long	.LASF3392
+	.byte	0x14
+	.long	.LASF3393
+	.byte	0xb
+	.long	.LASF3394
+	.byte	0x5
+	.long	.LASF3395
+	.byte	0xd
+	.long	.LASF3396
+	.byte	0x4
+	.long	.LASF3397
+	.byte	0xf
+	.long	.LASF3398
+	.byte	0x10
+	.long	.LASF3399
+	.byte	0xb
+	.long	.LASF3400
+	.byte	0xb
+	.long	.LASF3401
+	.byte	0xb
+	.long	.LASF3402
+	.byte	0x4
+	.long	.LASF3348
+	.byte	0xb
+	.long	.LASF3403
+	.byte	0xc
+	.long	.LASF3404
+	.byte	0x1e
+	.long	.LASF3405
+	.byte	0x1f
+	.long	.LASF3406
+	.byte	0x1f
+	.long	.LASF3406
+	.byte	0x1e
+	.long	.LASF3407
+	.byte	0x1b
+	.long	.LASF3408
+	.byte	0x1e
+	.long	.LASF3409
+	.byte	0x1e
+	.long	.LASF3410
+	.byte	0x1b
+	.long	.LASF3411
+	.byte	0x1b
+	.long	.LASF3412
+	.byte	0x1d
+	.long	.LASF3413
+	.byte	0x1b
+	.long	.LASF3414
+	.byte	0x1c
+	.long	.LASF3415
+	.byte	0x1c
+	.long	.LASF3416
+	.byte	0x1b
+	.long	.LASF3417
+	.byte	0x1b
+	.long	.LASF3418
+	.byte	0x1b
+	.long	.LASF3419
+	.byte	0x1b
+	.long	.LASF3420
+	.byte	0x1e
+	.long	.LASF3421
+	.byte	0x1f
+	.long	.LASF3422
+	.byte	0x1a
+	.long	.LASF3423
+	.byte	0x1a
+	.long	.LASF3424
+	.byte	0x1e
+	.long	.LASF3425
+	.byte	0x19
+	.long	.LASF3426
+	.byte	0x16
+	.long	.LASF3427
+	.byte	0x15
+	.long	.LASF3428
+	.byte	0x16
+	.long	.LASF3429
+	.byte	0x16
+	.long	.LASF3430
+	.byte	0x1
+	.long	.LASF3431
+	.byte	0x5
+	.long	.LASF3432
+	.byte	0x2
+	.long	.LASF3433
+	.byte	0x1
+	.long	.LASF3434
+	.byte	0x2
+	.long	.LASF3435
+	.byte	0x2
+	.long	.LASF3436
+	.byte	0x4
+	.long	.LASF3437
+	.byte	0x4
+	.long	.LASF3438
+	.byte	0x4
+	.long	.LASF3439
+	.byte	0x4
+	.long	.LASF3440
+	.byte	0x1e
+	.long	.LASF3441
+	.byte	0x1b
+	.long	.LASF3442
+	.byte	0x1b
+	.long	.LASF3443
+	.byte	0x1b
+	.long	.LASF3444
+	.byte	0x1b
+	.long	.LASF3346
+	.byte	0x1d
+	.long	.LASF3445
+	.byte	0x1a
+	.long	.LASF3446
+	.byte	0x1a
+	.long	.LASF3447
+	.byte	0x1a
+	.long	.LASF3448
+	.byte	0x1a
+	.long	.LASF3449
+	.byte	0x1e
+	.long	.LASF3449
+	.byte	0x1b
+	.long	.LASF3450
+	.byte	0x1b
+	.long	.LASF3451
+	.byte	0x1b
+	.long	.LASF3452
+	.byte	0x1b
+	.long	.LASF3453
+	.byte	0x1d
+	.long	.LASF3453
+	.byte	0x1b
+	.long	.LASF3454
+	.byte	0x1a
+	.long	.LASF3455
+	.byte	0x1a
+	.long	.LASF3456
+	.byte	0x1a
+	.long	.LASF3457
+	.byte	0x1a
+	.long	.LASF3458
+	.byte	0x1b
+	.long	.LASF3459
+	.byte	0x1b
+	.long	.LASF3460
+	.byte	0x1b
+	.long	.LASF3461
+	.byte	0x1b
+	.long	.LASF3462
+	.byte	0x1b
+	.long	.LASF3463
+	.byte	0x1b
+	.long	.LASF3464
+	.byte	0x1e
+	.long	.LASF3465
+	.byte	0x1b
+	.long	.LASF3466
+	.byte	0x1b
+	.long	.LASF3467
+	.byte	0x1f
+	.long	.LASF3468
+	.byte	0x5
+	.long	.LASF3469
+	.byte	0x5
+	.long	.LASF3470
+	.byte	0xb
+	.long	.LASF3471
+	.byte	0x3
+	.long	.LASF3472
+	.byte	0xb
+	.long	.LASF3473
+	.byte	0xb
+	.long	.LASF3474
+	.byte	0xb
+	.long	.LASF3475
+	.byte	0xb
+	.long	.LASF3476
+	.byte	0xb
+	.long	.LASF3477
+	.byte	0xb
+	.long	.LASF3478
+	.byte	0x6
+	.long	.LASF3479
+	.byte	0xb
+	.long	.LASF3480
+	.byte	0xb
+	.long	.LASF3481
+	.byte	0x8
+	.long	.LASF3482
+	.byte	0x4
+	.long	.LASF3483
+	.byte	0x1e
+	.long	.LASF3484
+	.byte	0x1b
+	.long	.LASF3485
+	.byte	0x1b
+	.long	.LASF3486
+	.byte	0x1b
+	.long	.LASF3487
+	.byte	0x1b
+	.long	.LASF3488
+	.byte	0x1b
+	.long	.LASF3489
+	.byte	0x1b
+	.long	.LASF3490
+	.byte	0x1b
+	.long	.LASF3491
+	.byte	0xb
+	.long	.LASF3492
+	.byte	0xb
+	.long	.LASF3493
+	.byte	0xb
+	.long	.LASF3494
+	.byte	0xb
+	.long	.LASF3495
+	.byte	0xb
+	.long	.LASF3364
+	.byte	0xb
+	.long	.LASF3496
+	.byte	0xb
+	.long	.LASF3497
+	.byte	0x4
+	.long	.LASF3498
+	.byte	0xb
+	.long	.LASF3499
+	.byte	0xb
+	.long	.LASF3365
+	.byte	0xb
+	.long	.LASF3500
+	.byte	0xb
+	.long	.LASF3501
+	.byte	0xb
+	.long	.LASF3502
+	.byte	0xb
+	.long	.LASF3503
+	.byte	0xb
+	.long	.LASF3504
+	.byte	0xb
+	.long	.LASF3505
+	.byte	0xb
+	.long	.LASF3506
+	.byte	0xa
+	.long	.LASF3507
+	.byte	0xc
+	.long	.LASF3508
+	.byte	0x10
+	.long	.LASF3509
+	.byte	0x4
+	.long	.LASF3510
+	.byte	0x4
+	.long	.LASF3511
+	.byte	0xd
+	.long	.LASF3512
+	.byte	0xe
+	.long	.LASF3513
+	.byte	0xe
+	.long	.LASF3514
+	.byte	0xf
+	.long	.LASF3515
+	.byte	0xf
+	.long	.LASF3516
+	.byte	0xf
+	.long	.LASF3517
+	.byte	0xf
+	.long	.LASF3518
+	.byte	0xf
+	.long	.LASF3519
+	.byte	0xf
+	.long	.LASF3520
+	.byte	0xf
+	.long	.LASF3521
+	.byte	0xf
+	.long	.LASF3522
+	.byte	0xf
+	.long	.LASF3523
+	.byte	0x1e
+	.long	.LASF3524
+	.byte	0x1a
+	.long	.LASF3525
+	.byte	0x1a
+	.long	.LASF3526
+	.byte	0x1a
+	.long	.LASF3527
+	.byte	0x1a
+	.long	.LASF3528
+	.byte	0x1a
+	.long	.LASF3529
+	.byte	0x1a
+	.long	.LASF3530
+	.byte	0x1b
+	.long	.LASF3523
+	.byte	0x1b
+	.long	.LASF3531
+	.byte	0x1e
+	.long	.LASF3532
+	.byte	0xf
+	.long	.LASF3533
+	.byte	0x4
+	.long	.LASF3534
+	.byte	0xf
+	.long	.LASF3535
+	.byte	0xb
+	.long	.LASF3536
+	.byte	0x4
+	.long	.LASF3537
+	.byte	0x12
+	.long	.LASF3538
+	.byte	0x14
+	.long	.LASF3379
+	.byte	0x7
+	.long	.LASF3481
+	.byte	0x14
+	.long	.LASF3539
+	.byte	0x4
+	.long	.LASF3378
+	.byte	0xb
+	.long	.LASF3540
+	.byte	0x14
+	.long	.LASF3540
+	.byte	0x9
+	.long	.LASF3541
+	.byte	0x14
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1945:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2781:
+	.string	"long long int"
+.LASF2373:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF2419:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1534:
+	.string	"__DECL_SIMD_exp10l "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1616:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF3202:
+	.string	"BOXAUTOTUNE"
+.LASF2131:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1791:
+	.string	"FLASH_PARTITION_SECTOR_COUNT(partition) (partition->endSector + 1 - partition->startSector)"
+.LASF2721:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF2694:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF960:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2178:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF2082:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF979:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1598:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1472:
+	.string	"__DECL_SIMD_pow "
+.LASF1286:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF2009:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2761:
+	.string	"invertedCardDetection"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF1595:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1066:
+	.string	"_STDLIB_H 1"
+.LASF2538:
+	.string	"_CTYPE_H 1"
+.LASF2388:
+	.string	"FAT_FILE_ATTRIBUTE_READ_ONLY 0x01"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2767:
+	.string	"RGB_GREEN"
+.LASF2353:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF2371:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF2744:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2240:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF1923:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1357:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1435:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2593:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF3057:
+	.string	"OSD_POWER"
+.LASF1775:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1296:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF2044:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2036:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2766:
+	.string	"RGB_RED"
+.LASF2375:
+	.string	"RPM_FILTER_UPDATE_RATE_HZ 500"
+.LASF2603:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_RELEASE 0x03"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1967:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2090:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2815:
+	.string	"OWNER_1WIRE"
+.LASF1981:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2158:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2248:
+	.string	"SOFTSERIAL_BUFFER_SIZE 256"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1488:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2926:
+	.string	"current_profile_index"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1541:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2853:
+	.string	"FLASH_PARTITION_TYPE_CONFIG"
+.LASF3034:
+	.string	"BEEPER_CAM_CONNECTION_OPEN"
+.LASF2197:
+	.string	"NVIC_PRIO_GYRO_INT_EXTI 4"
+.LASF1425:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1151:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2449:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF2246:
+	.string	"MAX_INPUTS 8"
+.LASF1183:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2613:
+	.string	"BOXID_NONE 255"
+.LASF2262:
+	.string	"UART7_RX_BUFFER_SIZE 256"
+.LASF1093:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF3252:
+	.string	"SYSTEM_STATE_READY"
+.LASF2971:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF2737:
+	.string	"UIB_DEVICE_ID_GPS 0x13"
+.LASF1338:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF2816:
+	.string	"OWNER_AIRSPEED"
+.LASF2027:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF3161:
+	.string	"serialPortConfig_s"
+.LASF3139:
+	.string	"OSD_GFORCE_X"
+.LASF3140:
+	.string	"OSD_GFORCE_Y"
+.LASF3141:
+	.string	"OSD_GFORCE_Z"
+.LASF1350:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2550:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1080:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF1018:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF2952:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1239:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF3047:
+	.string	"OSD_THROTTLE_POS"
+.LASF2307:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF2437:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF3277:
+	.string	"sensorsAutodetect"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1632:
+	.string	"__DECL_SIMD_acosh "
+.LASF2471:
+	.string	"DJI_API_VERSION_MAJOR 1"
+.LASF2600:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_GET_DEVICE_INFO 0x00"
+.LASF2841:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF2632:
+	.string	"VTX_SMARTAUDIO_BAND_COUNT (VTX_SMARTAUDIO_MAX_BAND - VTX_SMARTAUDIO_MIN_BAND + 1)"
+.LASF3041:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF1212:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2647:
+	.string	"SA_MODE_CLR_PITMODE 4"
+.LASF1492:
+	.string	"__DECL_SIMD_atan "
+.LASF1934:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF934:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2434:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF2078:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2340:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF2321:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF1753:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2484:
+	.string	"DJI_MSP_ATTITUDE 108"
+.LASF2824:
+	.string	"RESOURCE_IO"
+.LASF2037:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF3011:
+	.string	"PID_POS_HEADING"
+.LASF2996:
+	.string	"ALTITUDE_CONTROL"
+.LASF1446:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1076:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF2951:
+	.string	"WAS_EVER_ARMED"
+.LASF1566:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1528:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2690:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF2230:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2387:
+	.string	"FAT16_MAX_CLUSTERS 65524"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF3129:
+	.string	"OSD_TEMP_SENSOR_3_TEMPERATURE"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF2070:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2686:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF2932:
+	.string	"name"
+.LASF1773:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF2294:
+	.string	"DEF_TIM_OUTPUT(ch) DEF_TIM_OUTPUT__ ## ch"
+.LASF1511:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2783:
+	.string	"OWNER_FREE"
+.LASF1007:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1463:
+	.string	"__DECL_SIMD_expf "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF2715:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2820:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1348:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF1702:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1790:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2729:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF3187:
+	.string	"BOXLIGHTS"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2865:
+	.string	"mincommand"
+.LASF3284:
+	.string	"featureClear"
+.LASF2582:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF2567:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1924:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2195:
+	.string	"NVIC_PRIO_TIMER_DMA 3"
+.LASF940:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2148:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2776:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF1391:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF2496:
+	.string	"DJI_MSP_SET_RC_TUNING 204"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1661:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1801:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2574:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF2223:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1034:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1274:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1784:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1202:
+	.string	"__blkcnt_t_defined "
+.LASF1893:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2454:
+	.string	"OSD_POS(x,y) ((x) | ((y) << 5))"
+.LASF1337:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF1170:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF1983:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF3178:
+	.string	"BOXHEADINGHOLD"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1484:
+	.string	"__DECL_SIMD_acosl "
+.LASF3280:
+	.string	"initBoardAlignment"
+.LASF992:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1581:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2213:
+	.string	"RESET_NONE 0"
+.LASF2511:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1370:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF1678:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF2265:
+	.string	"UART8_TX_BUFFER_SIZE 256"
+.LASF3235:
+	.string	"TASK_TELEMETRY"
+.LASF3048:
+	.string	"OSD_VTX_CHANNEL"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2155:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2432:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2435:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1493:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2532:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF2180:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1496:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2754:
+	.string	"uint32_t"
+.LASF1803:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2731:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF2606:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF1386:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2452:
+	.string	"OSD_VISIBLE_FLAG 0x0800"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1916:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1992:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2595:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1436:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2682:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF2269:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF1575:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2616:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1301:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2365:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF2399:
+	.string	"FLASHFS_WRITE_BUFFER_USABLE (FLASHFS_WRITE_BUFFER_SIZE - 1)"
+.LASF1293:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF1043:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2605:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2161:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2381:
+	.string	"FAT_VOLUME_ID_SIGNATURE_1 0x55"
+.LASF2524:
+	.string	"FILENAME_MAX 4096"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1979:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2073:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1254:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1847:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2552:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1697:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1958:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2276:
+	.string	"DEF_TIM_CHNL_CH2 1"
+.LASF2234:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF3122:
+	.string	"OSD_MC_POS_XYZ_P_OUTPUTS"
+.LASF1426:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2658:
+	.string	"VTX_TRAMP_MIN_FREQUENCY_MHZ 5000"
+.LASF2668:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1289:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1539:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1014:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF2587:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1954:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1116:
+	.string	"__f32(x) x ##f32"
+.LASF2330:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF3278:
+	.string	"gpsPreInit"
+.LASF1722:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1972:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2103:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2370:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1907:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1889:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1000:
+	.string	"BIT(x) (1 << (x))"
+.LASF1876:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2396:
+	.string	"FAT_MAKE_DATE(year,month,day) (day | (month << 5) | ((year - 1980) << 9))"
+.LASF2098:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2893:
+	.string	"failureMode_e"
+.LASF1432:
+	.string	"__DECL_SIMD_sin "
+.LASF2825:
+	.string	"RESOURCE_TIMER"
+.LASF1193:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2296:
+	.string	"DEF_TIM_OUTPUT__CH2 (TIMER_OUTPUT_NONE)"
+.LASF2151:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1704:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2087:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF3043:
+	.string	"OSD_ONTIME"
+.LASF1071:
+	.string	"WCONTINUED 8"
+.LASF3015:
+	.string	"BEEPER_HARDWARE_FAILURE"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF1367:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF2008:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1431:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2023:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF3113:
+	.string	"OSD_NAV_FW_CRUISE_THR"
+.LASF2987:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1319:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF2335:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF3180:
+	.string	"BOXHEADADJ"
+.LASF3025:
+	.string	"BEEPER_ACTION_SUCCESS"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1622:
+	.string	"__DECL_SIMD_atanh "
+.LASF1932:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF3038:
+	.string	"OSD_RSSI_VALUE"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1782:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF3142:
+	.string	"OSD_RC_SOURCE"
+.LASF1927:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1642:
+	.string	"__DECL_SIMD_erf "
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1620:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF2101:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2159:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1694:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF2778:
+	.string	"LOG_TOPIC_VTX"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1261:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1591:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF2074:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF983:
+	.string	"HSV_VALUE_MAX 255"
+.LASF3300:
+	.string	"IOInitGlobal"
+.LASF512:
+	.string	"__wur "
+.LASF2343:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2477:
+	.string	"DJI_MSP_OSD_CONFIG 84"
+.LASF2035:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2527:
+	.string	"FOPEN_MAX 16"
+.LASF2284:
+	.string	"BTCH_TIM1_CH2N BTCH_TIM1_CH2"
+.LASF1298:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1085:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1461:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1754:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1128:
+	.string	"EXIT_SUCCESS 0"
+.LASF2548:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1021:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2797:
+	.string	"OWNER_I2C"
+.LASF3255:
+	.string	"vtxFuriousFPVInit"
+.LASF2661:
+	.string	"VTX_FFPV_CHANNEL_COUNT 8"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1100:
+	.string	"__f128(x) x ##f128"
+.LASF2076:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF2176:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2494:
+	.string	"DJI_MSP_SET_PID_ADVANCED 95"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2453:
+	.string	"OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)"
+.LASF1398:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1163:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF2058:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2638:
+	.string	"VTX_SMARTAUDIO_MAX_FREQUENCY_MHZ 5999"
+.LASF3061:
+	.string	"OSD_HOME_DIST"
+.LASF1287:
+	.string	"PG_INAV_START 1000"
+.LASF2707:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF2489:
+	.string	"DJI_MSP_BATTERY_STATE 130"
+.LASF2407:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1538:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF3222:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF2125:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF999:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1174:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1772:
+	.string	"M_E 2.7182818284590452354"
+.LASF2873:
+	.string	"motorPoleCount"
+.LASF2287:
+	.string	"BTCH_TIM8_CH2N BTCH_TIM8_CH2"
+.LASF1666:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1230:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF3313:
+	.string	"systemState"
+.LASF3258:
+	.string	"vtxInit"
+.LASF3037:
+	.string	"BEEPER_PREFERENCE"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2703:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF2316:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1776:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1910:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1794:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1139:
+	.string	"__pid_t_defined "
+.LASF2203:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF1354:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF1149:
+	.string	"_ENDIAN_H 1"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1457:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2436:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF3184:
+	.string	"BOXMANUAL"
+.LASF1356:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1793:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1204:
+	.string	"__fsfilcnt_t_defined "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2850:
+	.string	"FLASH_PARTITION_TYPE_FLASHFS"
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF2536:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF2970:
+	.string	"ARMING_DISABLED_OOM"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF3203:
+	.string	"BOXCAMERA1"
+.LASF3204:
+	.string	"BOXCAMERA2"
+.LASF3205:
+	.string	"BOXCAMERA3"
+.LASF1693:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF2225:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1050:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1073:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1087:
+	.string	"__WCOREFLAG 0x80"
+.LASF2092:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1822:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1844:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2728:
+	.string	"ERPM_PER_LSB 100.0f"
+.LASF1403:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF2503:
+	.string	"__FILE_defined 1"
+.LASF892:
+	.string	"USE_VCP"
+.LASF2379:
+	.string	"MBR_PARTITION_TYPE_FAT32_LBA 0x0C"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF976:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1159:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF3028:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF973:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2989:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF1609:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF721:
+	.string	"__need_NULL"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1611:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1256:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1687:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1447:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2835:
+	.string	"RESOURCE_SPI_CS"
+.LASF2513:
+	.string	"_IOLBF 1"
+.LASF1083:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF2179:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1249:
+	.string	"EEPROM_CONF_VERSION 127"
+.LASF1187:
+	.string	"__timeval_defined 1"
+.LASF2663:
+	.string	"PINIO_COUNT 4"
+.LASF1273:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF2718:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF1505:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF476:
+	.string	"__P(args) args"
+.LASF2184:
+	.string	"LED0_ON do {} while (0)"
+.LASF1267:
+	.string	"PG_RX_CONFIG 24"
+.LASF1334:
+	.string	"DYNAMIC (1 << 2)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1112:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1088:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF3077:
+	.string	"OSD_EFFICIENCY_WH_PER_KM"
+.LASF2830:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2095:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1596:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1821:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2426:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF2013:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1625:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1931:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2268:
+	.string	"BEEP_ON do {} while (0)"
+.LASF2028:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF3261:
+	.string	"pitotStartCalibration"
+.LASF2671:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1814:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2443:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF2214:
+	.string	"RESET_BOOTLOADER_REQUEST_ROM 1"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2342:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1485:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF3270:
+	.string	"failsafeInit"
+.LASF2821:
+	.string	"RESOURCE_NONE"
+.LASF2183:
+	.string	"LED0_OFF do {} while (0)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1251:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1327:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2232:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2298:
+	.string	"DEF_TIM_OUTPUT__CH4 (TIMER_OUTPUT_NONE)"
+.LASF3210:
+	.string	"BOXBRAKING"
+.LASF2792:
+	.string	"OWNER_PINDEBUG"
+.LASF1053:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1223:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF3063:
+	.string	"OSD_VARIO"
+.LASF2185:
+	.string	"LED1_TOGGLE do {} while (0)"
+.LASF3183:
+	.string	"BOXNAVPOSHOLD"
+.LASF2126:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2508:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1859:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1120:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1682:
+	.string	"__DECL_SIMD_tan "
+.LASF2517:
+	.string	"SEEK_SET 0"
+.LASF1009:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF2786:
+	.string	"OWNER_PPMINPUT"
+.LASF1909:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2634:
+	.string	"VTX_SMARTAUDIO_MAX_POWER_COUNT 5"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF2274:
+	.string	"DEF_TIM_CHNL_CH1 0"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1780:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF3045:
+	.string	"OSD_FLYMODE"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2585:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1861:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2439:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1714:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1224:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF3130:
+	.string	"OSD_TEMP_SENSOR_4_TEMPERATURE"
+.LASF3306:
+	.string	"flashLedsAndBeep"
+.LASF2455:
+	.string	"OSD_X(x) ((x) & 0x001F)"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2130:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2218:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF2889:
+	.string	"FAILURE_ACC_INCOMPATIBLE"
+.LASF2338:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF3253:
+	.string	"fcTasksInit"
+.LASF2886:
+	.string	"FAILURE_DEVELOPER"
+.LASF2059:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2693:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF1181:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF2732:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF2758:
+	.string	"rate_num"
+.LASF3301:
+	.string	"systemInit"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF3125:
+	.string	"OSD_BARO_TEMPERATURE"
+.LASF2297:
+	.string	"DEF_TIM_OUTPUT__CH3 (TIMER_OUTPUT_NONE)"
+.LASF2221:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1571:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1122:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1855:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF2111:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2208:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF2857:
+	.string	"FLASH_MAX_PARTITIONS"
+.LASF1963:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1166:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF2091:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF3075:
+	.string	"OSD_BATTERY_REMAINING_CAPACITY"
+.LASF1375:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1098:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1372:
+	.string	"CMS_EXIT (0)"
+.LASF2086:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1663:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1976:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1479:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1449:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1796:
+	.string	"IOCFG_AF_PP 0"
+.LASF1029:
+	.string	"sq(x) ((x)*(x))"
+.LASF1344:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1353:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1810:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2539:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1084:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2368:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2885:
+	.string	"PWM_TYPE_SERIALSHOT"
+.LASF2760:
+	.string	"device"
+.LASF1824:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF3288:
+	.string	"gvInit"
+.LASF1573:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1136:
+	.string	"__nlink_t_defined "
+.LASF2747:
+	.string	"__uint8_t"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2995:
+	.string	"BOAT"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1416:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2558:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF978:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1640:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF719:
+	.string	"NULL"
+.LASF1215:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF3198:
+	.string	"BOXSURFACE"
+.LASF3071:
+	.string	"OSD_THROTTLE_POS_AUTO_THR"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1930:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1213:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF3042:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1188:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF3101:
+	.string	"OSD_BOARD_ALIGN_PITCH"
+.LASF1665:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF376:
+	.string	"unix 1"
+.LASF1830:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2649:
+	.string	"SA_MODE_SET_LOCK 0"
+.LASF1306:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF3275:
+	.string	"pidInitFilters"
+.LASF1655:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1167:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1943:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1048:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF2356:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF1201:
+	.string	"__blksize_t_defined "
+.LASF3056:
+	.string	"OSD_YAW_PIDS"
+.LASF2596:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF2685:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1363:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF950:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1836:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2136:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1182:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF3005:
+	.string	"PID_POS_XY"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1214:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1736:
+	.string	"_Mdouble_ _Float64x"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1469:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1125:
+	.string	"__lldiv_t_defined 1"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF3260:
+	.string	"vtxControlInit"
+.LASF1321:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF3036:
+	.string	"BEEPER_ALL"
+.LASF2794:
+	.string	"OWNER_RANGEFINDER"
+.LASF1142:
+	.string	"__daddr_t_defined "
+.LASF2106:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2979:
+	.string	"FIXED_WING_LEGACY"
+.LASF3314:
+	.string	"feature"
+.LASF2560:
+	.string	"toascii(c) __toascii (c)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1719:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2350:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2927:
+	.string	"current_battery_profile_index"
+.LASF3081:
+	.string	"OSD_MAP_NORTH"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1506:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2636:
+	.string	"VTX_SMARTAUDIO_DEFAULT_POWER 1"
+.LASF2573:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF3020:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1474:
+	.string	"__DECL_SIMD_powl "
+.LASF1626:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2894:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2397:
+	.string	"FAT_MAKE_TIME(hour,minute,second) ((second / 2) | (minute << 5) | (hour << 11))"
+.LASF2652:
+	.string	"SA_FREQ_SETPIT (1 << 15)"
+.LASF2251:
+	.string	"UART1_TX_BUFFER_SIZE 256"
+.LASF3303:
+	.string	"getPreferredBeeperOffMask"
+.LASF3165:
+	.string	"gps_baudrateIndex"
+.LASF2488:
+	.string	"DJI_MSP_PID 112"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2798:
+	.string	"OWNER_SDCARD"
+.LASF1351:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1178:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF3176:
+	.string	"BOXHORIZON"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1486:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1404:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2806:
+	.string	"OWNER_LED_STRIP"
+.LASF2444:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF2408:
+	.string	"HDOP_SCALE (100)"
+.LASF2512:
+	.string	"_IOFBF 0"
+.LASF3294:
+	.string	"ledInit"
+.LASF1448:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2656:
+	.string	"VTX_TRAMP_MAX_POWER_COUNT 5"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2911:
+	.string	"FEATURE_DASHBOARD"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2075:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1797:
+	.string	"IOCFG_AF_OD 0"
+.LASF3111:
+	.string	"OSD_MANUAL_ROLL_RATE"
+.LASF2285:
+	.string	"BTCH_TIM1_CH3N BTCH_TIM1_CH3"
+.LASF1512:
+	.string	"__DECL_SIMD_hypot "
+.LASF1977:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF2445:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF3050:
+	.string	"OSD_MAH_DRAWN"
+.LASF3032:
+	.string	"BEEPER_USB"
+.LASF3213:
+	.string	"BOXFPVANGLEMIX"
+.LASF2930:
+	.string	"cpuUnderclock"
+.LASF2354:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF2079:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1026:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1490:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2327:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2990:
+	.string	"AIRMODE_ACTIVE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2157:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2509:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1551:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2519:
+	.string	"SEEK_END 2"
+.LASF2665:
+	.string	"NAV_BLACKBOX "
+.LASF3018:
+	.string	"BEEPER_DISARMING"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1198:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF2528:
+	.string	"stdin stdin"
+.LASF1664:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2217:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF1613:
+	.string	"__DECL_SIMD_log1pf "
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1819:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2968:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF1501:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2211:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF1973:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2950:
+	.string	"ARMED"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF3189:
+	.string	"BOXOSD"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2216:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2479:
+	.string	"DJI_MSP_PID_ADVANCED 94"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2770:
+	.string	"LOG_TOPIC_GYRO"
+.LASF1721:
+	.string	"_Mdouble_ float"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1545:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1574:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF1849:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2156:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2192:
+	.string	"NVIC_PRIO_I2C_ER 2"
+.LASF2277:
+	.string	"DEF_TIM_CHNL_CH2N 1"
+.LASF2362:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1165:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1360:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF968:
+	.string	"BLACKBOX_TARGET_HEADER_BUDGET_PER_ITERATION 64"
+.LASF2403:
+	.string	"LAT 0"
+.LASF2405:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1153:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1885:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1477:
+	.string	"__DECL_SIMD_powf64 "
+.LASF956:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1323:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1299:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF2847:
+	.string	"double"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1468:
+	.string	"__DECL_SIMD_expf128 "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF3225:
+	.string	"TASK_SYSTEM"
+.LASF1006:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2001:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF3090:
+	.string	"OSD_CRUISE_HEADING_ADJUSTMENT"
+.LASF2177:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF3084:
+	.string	"OSD_WIND_SPEED_HORIZONTAL"
+.LASF2917:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF1417:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1068:
+	.string	"WUNTRACED 2"
+.LASF1522:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1111:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2254:
+	.string	"UART3_RX_BUFFER_SIZE 256"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF1530:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1004:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2324:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1364:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF1515:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2947:
+	.string	"AUX10"
+.LASF2948:
+	.string	"AUX11"
+.LASF2949:
+	.string	"AUX12"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF2110:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2102:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"BTCH_TIM20_CH3N BTCH_TIM20_CH3"
+.LASF1466:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1834:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2413:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1177:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF2779:
+	.string	"LOG_TOPIC_OSD"
+.LASF1939:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1216:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF2795:
+	.string	"OWNER_SYSTEM"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF3220:
+	.string	"SENSOR_INDEX_MAG"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1271:
+	.string	"PG_GPS_CONFIG 30"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1882:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2278:
+	.string	"DEF_TIM_CHNL_CH3 2"
+.LASF1531:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2557:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1462:
+	.string	"__DECL_SIMD_exp "
+.LASF2670:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1401:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1623:
+	.string	"__DECL_SIMD_atanhf "
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1559:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF891:
+	.string	"USE_ADC"
+.LASF2160:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF3112:
+	.string	"OSD_MANUAL_YAW_RATE"
+.LASF1290:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF2934:
+	.string	"systemConfig_System"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1680:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1738:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1314:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF2129:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2819:
+	.string	"OWNER_IRLOCK"
+.LASF1056:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2280:
+	.string	"DEF_TIM_CHNL_CH4 3"
+.LASF2461:
+	.string	"OSD_HOMING_LIM_H3 38"
+.LASF2562:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF2467:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF2147:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1657:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1802:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2050:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1668:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1008:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1275:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2132:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF3296:
+	.string	"systemClockSetup"
+.LASF3049:
+	.string	"OSD_CURRENT_DRAW"
+.LASF3114:
+	.string	"OSD_NAV_FW_PITCH2THR"
+.LASF1078:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1825:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2788:
+	.string	"OWNER_SERVO"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2858:
+	.string	"PERSISTENT_OBJECT_MAGIC"
+.LASF3312:
+	.string	"rc_alias"
+.LASF3148:
+	.string	"SERIAL_PORT_USART1"
+.LASF3149:
+	.string	"SERIAL_PORT_USART2"
+.LASF3150:
+	.string	"SERIAL_PORT_USART3"
+.LASF3151:
+	.string	"SERIAL_PORT_USART4"
+.LASF3152:
+	.string	"SERIAL_PORT_USART5"
+.LASF3153:
+	.string	"SERIAL_PORT_USART6"
+.LASF3154:
+	.string	"SERIAL_PORT_USART7"
+.LASF3155:
+	.string	"SERIAL_PORT_USART8"
+.LASF1160:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1005:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1519:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1614:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1106:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2042:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2901:
+	.string	"FEATURE_GPS"
+.LASF947:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2992:
+	.string	"AIRPLANE"
+.LASF3193:
+	.string	"BOXNAVWP"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF549:
+	.string	"__stub_gtty "
+.LASF3094:
+	.string	"OSD_LEVEL_PIDS"
+.LASF3022:
+	.string	"BEEPER_BAT_LOW"
+.LASF2997:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2448:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF2733:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= 100)"
+.LASF1094:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1913:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1452:
+	.string	"__DECL_SIMD_log "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1569:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2814:
+	.string	"OWNER_TEMPERATURE"
+.LASF1708:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF3181:
+	.string	"BOXCAMSTAB"
+.LASF2064:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2257:
+	.string	"UART4_TX_BUFFER_SIZE 256"
+.LASF1497:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF957:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1137:
+	.string	"__uid_t_defined "
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1297:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2313:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1358:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1208:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF3060:
+	.string	"OSD_HOME_DIR"
+.LASF1266:
+	.string	"PG_IMU_CONFIG 22"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF1955:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2478:
+	.string	"DJI_MSP_FILTER_CONFIG 92"
+.LASF1328:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1783:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1867:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2016:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1384:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF1546:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2895:
+	.string	"FEATURE_VBAT"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1225:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF2198:
+	.string	"NVIC_PRIO_USB 5"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF3259:
+	.string	"vtxCommonInit"
+.LASF2887:
+	.string	"FAILURE_MISSING_ACC"
+.LASF2828:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2866:
+	.string	"motorPwmRate"
+.LASF2510:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1558:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2725:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF1549:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2138:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2678:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2748:
+	.string	"__uint16_t"
+.LASF1771:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF3293:
+	.string	"timerInit"
+.LASF3001:
+	.string	"PID_ROLL"
+.LASF1373:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF3131:
+	.string	"OSD_TEMP_SENSOR_5_TEMPERATURE"
+.LASF1567:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2122:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2844:
+	.string	"ADC_CURRENT"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2954:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF3201:
+	.string	"BOXAUTOTRIM"
+.LASF1282:
+	.string	"PG_VTX_CONFIG 54"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1141:
+	.string	"__ssize_t_defined "
+.LASF2406:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1191:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF3175:
+	.string	"BOXANGLE"
+.LASF3008:
+	.string	"PID_LEVEL"
+.LASF1234:
+	.string	"_STDARG_H "
+.LASF2654:
+	.string	"VTX_TRAMP_5G8_BAND_COUNT 5"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1099:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF3298:
+	.string	"ensureEEPROMContainsValidData"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2492:
+	.string	"DJI_MSP_RTC 247"
+.LASF3196:
+	.string	"BOXGCSNAV"
+.LASF2416:
+	.string	"LED_POS_OFFSET 0"
+.LASF2546:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1335:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1516:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1498:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2957:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF2559:
+	.string	"isascii(c) __isascii (c)"
+.LASF3164:
+	.string	"msp_baudrateIndex"
+.LASF787:
+	.string	"USE_CMS "
+.LASF2441:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF2348:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1518:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF859:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2141:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1925:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2964:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF2765:
+	.string	"debugMode"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1131:
+	.string	"__u_char_defined "
+.LASF1027:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF1509:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2173:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2145:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2883:
+	.string	"PWM_TYPE_DSHOT600"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2577:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF2651:
+	.string	"SA_FREQ_GETPIT (1 << 14)"
+.LASF3243:
+	.string	"TASK_COUNT"
+.LASF2563:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1817:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF3206:
+	.string	"BOXOSDALT1"
+.LASF3207:
+	.string	"BOXOSDALT2"
+.LASF3208:
+	.string	"BOXOSDALT3"
+.LASF1442:
+	.string	"__DECL_SIMD_sincos "
+.LASF2339:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF3069:
+	.string	"OSD_GPS_HDOP"
+.LASF2956:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF718:
+	.string	"__need_size_t"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1347:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF3000:
+	.string	"stateFlags"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1052:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF2438:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF1540:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1673:
+	.string	"__DECL_SIMD_erfcf "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1543:
+	.string	"__DECL_SIMD_coshf "
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1349:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2711:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF1636:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2238:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF2153:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF954:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1062:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF2756:
+	.string	"_Bool"
+.LASF970:
+	.string	"ASSERT(expr) while (0) { }"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2768:
+	.string	"RGB_BLUE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF3167:
+	.string	"telemetry_baudrateIndex"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1392:
+	.string	"SPIDEV_COUNT 4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1376:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF1606:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF2237:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1838:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF941:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1295:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1460:
+	.string	"__DECL_SIMD_logf64x "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF3143:
+	.string	"OSD_VTX_POWER"
+.LASF953:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1483:
+	.string	"__DECL_SIMD_acosf "
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF3216:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2978:
+	.string	"SMALL_ANGLE"
+.LASF1795:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1933:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2695:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1952:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1152:
+	.string	"__BIG_ENDIAN 4321"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2719:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF3119:
+	.string	"OSD_MC_VEL_X_PID_OUTPUTS"
+.LASF513:
+	.string	"__always_inline"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF2242:
+	.string	"MAX_MOTORS 12"
+.LASF1453:
+	.string	"__DECL_SIMD_logf "
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF2592:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1813:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1808:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2618:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2673:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2093:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1132:
+	.string	"__ino_t_defined "
+.LASF1242:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2290:
+	.string	"BTCH_TIM20_CH2N BTCH_TIM20_CH2"
+.LASF1948:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3238:
+	.string	"TASK_UAV_INTERCONNECT"
+.LASF2586:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF3223:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2100:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2318:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF1699:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1683:
+	.string	"__DECL_SIMD_tanf "
+.LASF2055:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF3067:
+	.string	"OSD_RTC_TIME"
+.LASF2864:
+	.string	"maxthrottle"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF3295:
+	.string	"latchActiveFeatures"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF396:
+	.string	"false 0"
+.LASF2588:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF3156:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1508:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF2985:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1245:
+	.string	"_VA_LIST_DEFINED "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2466:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2959:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1124:
+	.string	"__ldiv_t_defined 1"
+.LASF1429:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF1169:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2735:
+	.string	"UIB_MAX_PACKET_SIZE 32"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF2473:
+	.string	"DJI_MSP_API_VERSION 1"
+.LASF2598:
+	.string	"RCDEVICE_PROTOCOL_MAX_PACKET_SIZE 64"
+.LASF3072:
+	.string	"OSD_HEADING_GRAPH"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF2006:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1406:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF2206:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF2263:
+	.string	"UART7_TX_BUFFER_SIZE 256"
+.LASF3273:
+	.string	"mspFcInit"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2085:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1011:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1701:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1089:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1645:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1307:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2041:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1383:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1652:
+	.string	"__DECL_SIMD_tanh "
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF3282:
+	.string	"busInit"
+.LASF1912:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2551:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF2243:
+	.string	"MAX_SERVOS 16"
+.LASF1257:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF1396:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF3024:
+	.string	"BEEPER_RX_SET"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1607:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2458:
+	.string	"OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)"
+.LASF1818:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1022:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF1843:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF2186:
+	.string	"LED1_OFF do {} while (0)"
+.LASF2118:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF1779:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2146:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF2033:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1003:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1544:
+	.string	"__DECL_SIMD_coshl "
+.LASF1310:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF3029:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1418:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF1811:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF1091:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF3107:
+	.string	"OSD_YAW_RATE"
+.LASF358:
+	.string	"__k8 1"
+.LASF2691:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF349:
+	.string	"__amd64 1"
+.LASF3267:
+	.string	"gpsInit"
+.LASF2684:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1526:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2446:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF2534:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF1113:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1090:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF3228:
+	.string	"TASK_SERIAL"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3191:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2319:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF2320:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1194:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2369:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2963:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF2456:
+	.string	"OSD_Y(x) (((x) >> 5) & 0x001F)"
+.LASF2352:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF2818:
+	.string	"OWNER_PINIO"
+.LASF2201:
+	.string	"NVIC_PRIORITY_GROUPING NVIC_PriorityGroup_4"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1248:
+	.string	"MAX_GLOBAL_VARIABLES 4"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1971:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2021:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1870:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF980:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1610:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1548:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1030:
+	.string	"FAST_MATH "
+.LASF1608:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1988:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3311:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF2323:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF1944:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2614:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1434:
+	.string	"__DECL_SIMD_sinl "
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2848:
+	.string	"FLASH_PARTITION_TYPE_UNKNOWN"
+.LASF2972:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF3088:
+	.string	"OSD_HOME_HEADING_ERROR"
+.LASF969:
+	.string	"BLACKBOX_WRITE_BUFFER_SIZE 256"
+.LASF1582:
+	.string	"__DECL_SIMD_atan2 "
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF1712:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2791:
+	.string	"OWNER_SERIAL"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF3197:
+	.string	"BOXKILLSWITCH"
+.LASF1856:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2311:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1454:
+	.string	"__DECL_SIMD_logl "
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1428:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1123:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1692:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1362:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2537:
+	.string	"__STDIO_INLINE"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF1075:
+	.string	"__WCLONE 0x80000000"
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2204:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF1399:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2491:
+	.string	"DJI_MSP_STATUS_EX 150"
+.LASF2849:
+	.string	"FLASH_PARTITION_TYPE_PARTITION_TABLE"
+.LASF1877:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1279:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1684:
+	.string	"__DECL_SIMD_tanl "
+.LASF938:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF2840:
+	.string	"RESOURCE_RX_CE"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2424:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2072:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2464:
+	.string	"OSD_HOMING_LIM_V3 15"
+.LASF2688:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1898:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2981:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1051:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1991:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2501:
+	.string	"_____fpos64_t_defined 1"
+.LASF2915:
+	.string	"FEATURE_TRANSPONDER"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF3013:
+	.string	"BEEPER_SILENCE"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2713:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF3283:
+	.string	"pwmMotorAndServoInit"
+.LASF1095:
+	.string	"_BITS_FLOATN_H "
+.LASF2137:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2566:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF1203:
+	.string	"__fsblkcnt_t_defined "
+.LASF2325:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF1561:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF2196:
+	.string	"NVIC_PRIO_SDIO 3"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1502:
+	.string	"__DECL_SIMD_asin "
+.LASF1412:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF1269:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF2236:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF3276:
+	.string	"failureMode"
+.LASF1061:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2123:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1805:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF3200:
+	.string	"BOXTURNASSIST"
+.LASF2133:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1735:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2689:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2495:
+	.string	"DJI_MSP_SET_PID 202"
+.LASF2301:
+	.string	"DEF_TIM_OUTPUT__CH3N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1503:
+	.string	"__DECL_SIMD_asinf "
+.LASF3292:
+	.string	"serialInit"
+.LASF1685:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1445:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF3078:
+	.string	"OSD_TRIP_DIST"
+.LASF2411:
+	.string	"LED_MODE_COUNT 6"
+.LASF1994:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2899:
+	.string	"FEATURE_UNUSED_1"
+.LASF2902:
+	.string	"FEATURE_UNUSED_3"
+.LASF2903:
+	.string	"FEATURE_UNUSED_4"
+.LASF2907:
+	.string	"FEATURE_UNUSED_5"
+.LASF2908:
+	.string	"FEATURE_UNUSED_6"
+.LASF2912:
+	.string	"FEATURE_UNUSED_7"
+.LASF2919:
+	.string	"FEATURE_UNUSED_8"
+.LASF2920:
+	.string	"FEATURE_UNUSED_9"
+.LASF1206:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF1190:
+	.string	"__NFDBITS"
+.LASF1262:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF2545:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF2026:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2194:
+	.string	"NVIC_PRIO_TIMER 3"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1138:
+	.string	"__off_t_defined "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1809:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF2010:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2793:
+	.string	"OWNER_TIMER"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF1799:
+	.string	"IOCFG_IPU 0"
+.LASF3186:
+	.string	"BOXLEDLOW"
+.LASF988:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2025:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1276:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF2366:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF2869:
+	.string	"motorDecelTimeMs"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1229:
+	.string	"alloca"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1302:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1677:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1300:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF1365:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1858:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2351:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1331:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2727:
+	.string	"ESC_DATA_INVALID 255"
+.LASF2572:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1154:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2530:
+	.string	"stderr stderr"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF2523:
+	.string	"TMP_MAX 238328"
+.LASF2247:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2152:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1480:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1450:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1763:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2144:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2293:
+	.string	"BTCH_TIM16_CH1N BTCH_TIM16_CH1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1420:
+	.string	"_MATH_H 1"
+.LASF1096:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2676:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF3117:
+	.string	"OSD_FW_ALT_PID_OUTPUTS"
+.LASF1727:
+	.string	"_Mdouble_ _Float32"
+.LASF1235:
+	.string	"_ANSI_STDARG_H_ "
+.LASF963:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2392:
+	.string	"FAT_FILE_ATTRIBUTE_DIRECTORY 0x10"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1978:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3192:
+	.string	"BOXFAILSAFE"
+.LASF1049:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1057:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF2988:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2482:
+	.string	"DJI_MSP_RAW_GPS 106"
+.LASF3132:
+	.string	"OSD_TEMP_SENSOR_6_TEMPERATURE"
+.LASF3055:
+	.string	"OSD_PITCH_PIDS"
+.LASF1294:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF2742:
+	.string	"short unsigned int"
+.LASF3062:
+	.string	"OSD_HEADING"
+.LASF2999:
+	.string	"FW_HEADING_USE_YAW"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1040:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1888:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2594:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2143:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2289:
+	.string	"BTCH_TIM20_CH1N BTCH_TIM20_CH1"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1521:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF3227:
+	.string	"TASK_RX"
+.LASF1957:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2522:
+	.string	"L_tmpnam 20"
+.LASF1629:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1599:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2888:
+	.string	"FAILURE_ACC_INIT"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1045:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF2345:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF3263:
+	.string	"gyroStartCalibration"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2428:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF2568:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1304:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1311:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1745:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2169:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF2088:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2514:
+	.string	"_IONBF 2"
+.LASF1016:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF1494:
+	.string	"__DECL_SIMD_atanl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2084:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2906:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2470:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2723:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1612:
+	.string	"__DECL_SIMD_log1p "
+.LASF2708:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1086:
+	.string	"__W_CONTINUED 0xffff"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1175:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2337:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1144:
+	.string	"__clock_t_defined 1"
+.LASF1470:
+	.string	"__DECL_SIMD_expf64x "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF3239:
+	.string	"TASK_VTXCTRL"
+.LASF1759:
+	.string	"FP_INFINITE 1"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2740:
+	.string	"RANGEFINDER_UIB_TASK_PERIOD_MS 100"
+.LASF2181:
+	.string	"LED_NUMBER 3"
+.LASF2789:
+	.string	"OWNER_SOFTSERIAL"
+.LASF3302:
+	.string	"printfSupportInit"
+.LASF3073:
+	.string	"OSD_EFFICIENCY_MAH_PER_KM"
+.LASF1671:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2005:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1730:
+	.string	"_Mdouble_ _Float64"
+.LASF1997:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF3092:
+	.string	"OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2769:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF2752:
+	.string	"uint8_t"
+.LASF2611:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF2427:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF1104:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1222:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1504:
+	.string	"__DECL_SIMD_asinl "
+.LASF1846:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2924:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1058:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1228:
+	.string	"_ALLOCA_H 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF3217:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1320:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF2584:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2017:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF2698:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF3234:
+	.string	"TASK_PITOT"
+.LASF3236:
+	.string	"TASK_CMS"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1378:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2701:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF3250:
+	.string	"SYSTEM_STATE_MOTORS_READY"
+.LASF1411:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1322:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2878:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF2228:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF2720:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF2333:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2422:
+	.string	"LED_POS_BITCNT 8"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF2507:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF2904:
+	.string	"FEATURE_TELEMETRY"
+.LASF1654:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2755:
+	.string	"timeMs_t"
+.LASF1686:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF1217:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1914:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1074:
+	.string	"__WALL 0x40000000"
+.LASF2003:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF3089:
+	.string	"OSD_CRUISE_HEADING_ERROR"
+.LASF2757:
+	.string	"float"
+.LASF2068:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1999:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1670:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1919:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2705:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF1333:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2764:
+	.string	"blackboxConfig_System"
+.LASF2741:
+	.string	"unsigned char"
+.LASF2308:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3012:
+	.string	"PID_ITEM_COUNT"
+.LASF2359:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1552:
+	.string	"__DECL_SIMD_expm1 "
+.LASF3120:
+	.string	"OSD_MC_VEL_Y_PID_OUTPUTS"
+.LASF1315:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF2771:
+	.string	"LOG_TOPIC_BARO"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1374:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF2884:
+	.string	"PWM_TYPE_DSHOT1200"
+.LASF1982:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1747:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1741:
+	.string	"__MATHDECL"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1012:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1143:
+	.string	"__key_t_defined "
+.LASF1631:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF3116:
+	.string	"OSD_DEBUG"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF959:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF3157:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2367:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1873:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2823:
+	.string	"RESOURCE_OUTPUT"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1936:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1868:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF3214:
+	.string	"BOXLOITERDIRCHN"
+.LASF1703:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2119:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF2189:
+	.string	"LED2_OFF do {} while (0)"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF698:
+	.string	"__need_size_t "
+.LASF3007:
+	.string	"PID_SURFACE"
+.LASF2286:
+	.string	"BTCH_TIM8_CH1N BTCH_TIM8_CH1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2154:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"linux 1"
+.LASF2200:
+	.string	"NVIC_PRIO_SONAR_EXTI 7"
+.LASF1072:
+	.string	"WNOWAIT 0x01000000"
+.LASF2910:
+	.string	"FEATURE_LED_STRIP"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2856:
+	.string	"FLASH_PARTITION_TYPE_UPDATE_FIRMWARE"
+.LASF3304:
+	.string	"delay"
+.LASF2863:
+	.string	"motorConfig_s"
+.LASF2874:
+	.string	"motorConfig_t"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF1647:
+	.string	"__DECL_SIMD_erff64 "
+.LASF952:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1393:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF3006:
+	.string	"PID_VEL_XY"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF3135:
+	.string	"OSD_PLUS_CODE"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1305:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF2288:
+	.string	"BTCH_TIM8_CH3N BTCH_TIM8_CH3"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1915:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2812:
+	.string	"OWNER_SPI_PREINIT"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2500:
+	.string	"____mbstate_t_defined 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2599:
+	.string	"RCDEVICE_PROTOCOL_MAX_DATA_SIZE 20"
+.LASF2378:
+	.string	"MBR_PARTITION_TYPE_FAT32 0x0B"
+.LASF1237:
+	.string	"__GNUC_VA_LIST "
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2239:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF2170:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"DEF_TIM_OUTPUT__CH1 (TIMER_OUTPUT_NONE)"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1341:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF1340:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1381:
+	.string	"DMA_NONE (0)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2860:
+	.string	"PERSISTENT_OBJECT_COUNT"
+.LASF2389:
+	.string	"FAT_FILE_ATTRIBUTE_HIDDEN 0x02"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2535:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF2681:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2220:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1560:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2811:
+	.string	"OWNER_VTX"
+.LASF2007:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1277:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2395:
+	.string	"FAT_DELETED_FILE_MARKER 0xE5"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF932:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF3137:
+	.string	"OSD_MAP_REFERENCE"
+.LASF3299:
+	.string	"initEEPROM"
+.LASF1998:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2275:
+	.string	"DEF_TIM_CHNL_CH1N 0"
+.LASF2607:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF1063:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF3285:
+	.string	"mixerInit"
+.LASF3134:
+	.string	"OSD_ALTITUDE_MSL"
+.LASF1841:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF2315:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1482:
+	.string	"__DECL_SIMD_acos "
+.LASF2666:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF2648:
+	.string	"SA_MODE_SET_UNLOCK 8"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2108:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1762:
+	.string	"FP_NORMAL 4"
+.LASF2697:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1241:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF2282:
+	.string	"DEF_TIM_TCH2BTCH(timch) CONCAT(BTCH_, timch)"
+.LASF989:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1816:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1500:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2965:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1624:
+	.string	"__DECL_SIMD_atanhl "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF2032:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1520:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2629:
+	.string	"VTX_SMARTAUDIO_MAX_BAND 5"
+.LASF2363:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1158:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2135:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1507:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2034:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2460:
+	.string	"OSD_HOMING_LIM_H2 16"
+.LASF2109:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1232:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2415:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2680:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1720:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2922:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2918:
+	.string	"FEATURE_VTX"
+.LASF2056:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1265:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1240:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF2805:
+	.string	"OWNER_INVERTER"
+.LASF3102:
+	.string	"OSD_RC_EXPO"
+.LASF2431:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF3305:
+	.string	"init"
+.LASF2306:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1966:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1705:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF3145:
+	.string	"OSD_ESC_TEMPERATURE"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2521:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1557:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1010:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF2664:
+	.string	"PINIO_FLAGS_INVERTED 0x80"
+.LASF1155:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1292:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1126:
+	.string	"RAND_MAX 2147483647"
+.LASF1734:
+	.string	"_Mdouble_ _Float32x"
+.LASF3082:
+	.string	"OSD_MAP_TAKEOFF"
+.LASF1831:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1840:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF3093:
+	.string	"OSD_POWER_SUPPLY_IMPEDANCE"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF786:
+	.string	"USE_STATS "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1070:
+	.string	"WEXITED 4"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2299:
+	.string	"DEF_TIM_OUTPUT__CH1N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF2984:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1815:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2565:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF990:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1725:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1258:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF2804:
+	.string	"OWNER_MPU"
+.LASF2749:
+	.string	"__uint32_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF3095:
+	.string	"OSD_POS_XY_PIDS"
+.LASF2083:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF3262:
+	.string	"baroStartCalibration"
+.LASF1718:
+	.string	"__MATH_PRECNAME"
+.LASF1789:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF1875:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1865:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2542:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF2843:
+	.string	"ADC_RSSI"
+.LASF3174:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1550:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF942:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF2252:
+	.string	"UART2_RX_BUFFER_SIZE 256"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF2980:
+	.string	"ANTI_WINDUP"
+.LASF3070:
+	.string	"OSD_MAIN_BATT_CELL_VOLTAGE"
+.LASF2226:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1542:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2071:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF2404:
+	.string	"LON 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1820:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1389:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1028:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF1728:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1770:
+	.string	"MATH_ERREXCEPT 2"
+.LASF3017:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF1441:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF3310:
+	.string	"blackboxConfig"
+.LASF962:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1407:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1996:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF3264:
+	.string	"blackboxInit"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1871:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2961:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1579:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1732:
+	.string	"_Mdouble_ _Float128"
+.LASF2657:
+	.string	"VTX_TRAMP_DEFAULT_POWER 1"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF3098:
+	.string	"OSD_VEL_Z_PIDS"
+.LASF2624:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MAX 1920"
+.LASF1200:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF2322:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF1746:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2785:
+	.string	"OWNER_PWMINPUT"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF1495:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2625:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_START 1350"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1103:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2447:
+	.string	"LED_XY_MASK 0x0F"
+.LASF1255:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF2401:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1792:
+	.string	"M25P16_PAGESIZE 256"
+.LASF1637:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1019:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF1032:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1751:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1092:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1510:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2937:
+	.string	"THROTTLE"
+.LASF2953:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1804:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1382:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF3064:
+	.string	"OSD_VARIO_NUM"
+.LASF3171:
+	.string	"reboot_character"
+.LASF2787:
+	.string	"OWNER_MOTOR"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF3133:
+	.string	"OSD_TEMP_SENSOR_7_TEMPERATURE"
+.LASF2283:
+	.string	"BTCH_TIM1_CH1N BTCH_TIM1_CH1"
+.LASF3195:
+	.string	"BOXHOMERESET"
+.LASF2602:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_PRESS 0x02"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1757:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1587:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2018:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2334:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1476:
+	.string	"__DECL_SIMD_powf32 "
+.LASF3147:
+	.string	"SERIAL_PORT_NONE"
+.LASF1243:
+	.string	"_VA_LIST_ "
+.LASF2986:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF3233:
+	.string	"TASK_BARO"
+.LASF1529:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2832:
+	.string	"RESOURCE_SPI_SCK"
+.LASF3110:
+	.string	"OSD_MANUAL_PITCH_RATE"
+.LASF1554:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1565:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1696:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2529:
+	.string	"stdout stdout"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1161:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF3274:
+	.string	"imuInit"
+.LASF2451:
+	.string	"OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)"
+.LASF1984:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3010:
+	.string	"PID_VEL_Z"
+.LASF2304:
+	.string	"HARDWARE_TIMER_DEFINITION_COUNT 0"
+.LASF1410:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1589:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1288:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF2410:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1523:
+	.string	"__DECL_SIMD_exp2f "
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2383:
+	.string	"FAT_DIRECTORY_ENTRY_SIZE 32"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1807:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1424:
+	.string	"__DECL_SIMD_cosl "
+.LASF2667:
+	.string	"RADAR_MAX_POIS 5"
+.LASF3065:
+	.string	"OSD_AIR_SPEED"
+.LASF1244:
+	.string	"_VA_LIST "
+.LASF1823:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2597:
+	.string	"RCDEVICE_PROTOCOL_HEADER 0xCC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF2142:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2553:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF2576:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2880:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF1691:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1710:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1532:
+	.string	"__DECL_SIMD_exp10 "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1285:
+	.string	"PG_CF_END 56"
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF2255:
+	.string	"UART3_TX_BUFFER_SIZE 256"
+.LASF1649:
+	.string	"__DECL_SIMD_erff32x "
+.LASF2834:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1451:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF3068:
+	.string	"OSD_MESSAGES"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF2014:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF995:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2604:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_CONNECTION 0x04"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1767:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF982:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1578:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF939:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF2974:
+	.string	"armingFlags"
+.LASF2722:
+	.string	"P0 101325.0f"
+.LASF1577:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF3026:
+	.string	"BEEPER_ACTION_FAIL"
+.LASF3074:
+	.string	"OSD_WH_DRAWN"
+.LASF2504:
+	.string	"__struct_FILE_defined 1"
+.LASF2120:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1785:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF3118:
+	.string	"OSD_FW_POS_PID_OUTPUTS"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2589:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF981:
+	.string	"HSV_HUE_MAX 359"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1517:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1115:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1272:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF3308:
+	.string	"systemConfig"
+.LASF1656:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF3297:
+	.string	"readEEPROM"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2591:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1774:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF489:
+	.string	"__flexarr []"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2219:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF2916:
+	.string	"FEATURE_AIRMODE"
+.LASF2891:
+	.string	"FAILURE_FLASH_WRITE_FAILED"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2233:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF3138:
+	.string	"OSD_GFORCE"
+.LASF1806:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3215:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF1227:
+	.string	"__have_pthread_attr_t 1"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1430:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1553:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1621:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2801:
+	.string	"OWNER_BEEPER"
+.LASF1465:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2774:
+	.string	"LOG_TOPIC_TIMER"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1778:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1444:
+	.string	"__DECL_SIMD_sincosl "
+.LASF2107:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2699:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF1415:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF2067:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2171:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1942:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1209:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2430:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF2578:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1329:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF3105:
+	.string	"OSD_PITCH_RATE"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF3169:
+	.string	"serialConfig_s"
+.LASF3172:
+	.string	"serialConfig_t"
+.LASF2222:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2881:
+	.string	"PWM_TYPE_DSHOT150"
+.LASF2442:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF1179:
+	.string	"_SYS_SELECT_H 1"
+.LASF1330:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1185:
+	.string	"____sigset_t_defined "
+.LASF1366:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF2099:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF2273:
+	.string	"DEF_TIM_DMAMAP_VARIANT__2(_0,_1,_2,...) _2"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2414:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1455:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1588:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2374:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1390:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1853:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1318:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF3121:
+	.string	"OSD_MC_VEL_Z_PID_OUTPUTS"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF2994:
+	.string	"ROVER"
+.LASF2012:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1964:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF3126:
+	.string	"OSD_TEMP_SENSOR_0_TEMPERATURE"
+.LASF2355:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF2097:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF394:
+	.string	"bool _Bool"
+.LASF3052:
+	.string	"OSD_GPS_SATS"
+.LASF2581:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1408:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF2134:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2983:
+	.string	"COMPASS_CALIBRATED"
+.LASF2258:
+	.string	"UART5_RX_BUFFER_SIZE 256"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1897:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1471:
+	.string	"__DECL_SIMD_expf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2626:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_END 1650"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2047:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2057:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1524:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2861:
+	.string	"persistentObjectId_e"
+.LASF1568:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1918:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1648:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1940:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF3086:
+	.string	"OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH"
+.LASF1388:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF2650:
+	.string	"SA_MODE_SET_DEFERRED_FREQ 16"
+.LASF1758:
+	.string	"FP_NAN 0"
+.LASF2127:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1755:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF3268:
+	.string	"uavInterconnectBusInit"
+.LASF2162:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1387:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF3286:
+	.string	"mixerUpdateStateFlags"
+.LASF2039:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1097:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2679:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF3027:
+	.string	"BEEPER_READY_BEEP"
+.LASF1246:
+	.string	"_VA_LIST_T_H "
+.LASF2182:
+	.string	"LED0_TOGGLE do {} while (0)"
+.LASF1937:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF3087:
+	.string	"OSD_REMAINING_DISTANCE_BEFORE_RTH"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1210:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF1180:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF3266:
+	.string	"navigationInit"
+.LASF1405:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2859:
+	.string	"PERSISTENT_OBJECT_RESET_REASON"
+.LASF1827:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2245:
+	.string	"PULSE_1MS (1000)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2165:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2115:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2060:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1284:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1605:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF2543:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1886:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2000:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2746:
+	.string	"short int"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1742:
+	.string	"__MATHCALL"
+.LASF2433:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF1157:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2643:
+	.string	"SA_MODE_GET_UNLOCK 16"
+.LASF1987:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1017:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF1186:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1593:
+	.string	"__DECL_SIMD_log10f "
+.LASF2601:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_CAMERA_CONTROL 0x01"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF2993:
+	.string	"MULTIROTOR"
+.LASF2905:
+	.string	"FEATURE_CURRENT_METER"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF2029:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2309:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF998:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1537:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF700:
+	.string	"__size_t__ "
+.LASF3030:
+	.string	"BEEPER_ARMED"
+.LASF2207:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF985:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF2633:
+	.string	"VTX_SMARTAUDIO_CHANNEL_COUNT (VTX_SMARTAUDIO_MAX_CHANNEL - VTX_SMARTAUDIO_MIN_CHANNEL + 1)"
+.LASF1036:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF3115:
+	.string	"OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1332:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2608:
+	.string	"MAX_WAITING_RESPONSES 2"
+.LASF2641:
+	.string	"SA_MODE_GET_IN_RANGE_PITMODE 4"
+.LASF2394:
+	.string	"FAT_FILENAME_LENGTH 11"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1067:
+	.string	"WNOHANG 1"
+.LASF937:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF951:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF3023:
+	.string	"BEEPER_GPS_STATUS"
+.LASF2065:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1583:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2802:
+	.string	"OWNER_OSD"
+.LASF2829:
+	.string	"RESOURCE_EXTI"
+.LASF1641:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF2048:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1264:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF3097:
+	.string	"OSD_VEL_XY_PIDS"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF2497:
+	.string	"_STDIO_H 1"
+.LASF741:
+	.string	"USE_NAV "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2341:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2326:
+	.string	"SDCARD_WRITE_STALL_US 10000"
+.LASF2271:
+	.string	"DEF_TIM_DMAMAP_VARIANT__0(_0,...) _0"
+.LASF1689:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF974:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2188:
+	.string	"LED2_TOGGLE do {} while (0)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF3163:
+	.string	"identifier"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF2380:
+	.string	"MBR_PARTITION_TYPE_FAT16_LBA 0x0E"
+.LASF2382:
+	.string	"FAT_VOLUME_ID_SIGNATURE_2 0xAA"
+.LASF2261:
+	.string	"UART6_TX_BUFFER_SIZE 256"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1879:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF2281:
+	.string	"DEF_TIM_CHNL_CH4N 3"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF3059:
+	.string	"OSD_GPS_LAT"
+.LASF2882:
+	.string	"PWM_TYPE_DSHOT300"
+.LASF2112:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2612:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF2358:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2116:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF2468:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF3109:
+	.string	"OSD_MANUAL_RC_YAW_EXPO"
+.LASF383:
+	.string	"SITL 1"
+.LASF1140:
+	.string	"__id_t_defined "
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF3173:
+	.string	"serialConfig_System"
+.LASF1119:
+	.string	"__f64x(x) x ##f64x"
+.LASF1171:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1060:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF3166:
+	.string	"peripheral_baudrateIndex"
+.LASF3290:
+	.string	"djiOsdSerialInit"
+.LASF2051:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2569:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1184:
+	.string	"__sigset_t_defined 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF1130:
+	.string	"_SYS_TYPES_H 1"
+.LASF3004:
+	.string	"PID_POS_Z"
+.LASF1639:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1536:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF967:
+	.string	"BLACKBOX_MAX_ACCUMULATED_HEADER_BUDGET 256"
+.LASF1173:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF964:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF3190:
+	.string	"BOXTELEMETRY"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF2121:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"READONLY (1 << 4)"
+.LASF1127:
+	.string	"EXIT_FAILURE 1"
+.LASF3185:
+	.string	"BOXBEEPERON"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF987:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2923:
+	.string	"FEATURE_OSD"
+.LASF2463:
+	.string	"OSD_HOMING_LIM_V2 10"
+.LASF2193:
+	.string	"NVIC_PRIO_I2C_EV 2"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1134:
+	.string	"__gid_t_defined "
+.LASF2750:
+	.string	"long int"
+.LASF3002:
+	.string	"PID_PITCH"
+.LASF3100:
+	.string	"OSD_BOARD_ALIGN_ROLL"
+.LASF1109:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1707:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3231:
+	.string	"TASK_GPS"
+.LASF1400:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1345:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF2544:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2644:
+	.string	"SA_MODE_GET_DEFERRED_FREQ 32"
+.LASF2610:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1226:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2167:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2347:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1035:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF3182:
+	.string	"BOXNAVRTH"
+.LASF1630:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1291:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF2628:
+	.string	"VTX_SMARTAUDIO_MIN_BAND 1"
+.LASF3194:
+	.string	"BOXAIRMODE"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF3218:
+	.string	"SENSOR_INDEX_ACC"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1176:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF1102:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2653:
+	.string	"SA_FREQ_MASK (~(SA_FREQ_GETPIT|SA_FREQ_SETPIT))"
+.LASF3160:
+	.string	"serialPortIdentifier_e"
+.LASF1787:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF2022:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF3103:
+	.string	"OSD_RC_YAW_EXPO"
+.LASF1324:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2063:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF2540:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1768:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1756:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF3099:
+	.string	"OSD_HEADING_P"
+.LASF2331:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF996:
+	.string	"EXPAND_I(x) x"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF3076:
+	.string	"OSD_BATTERY_REMAINING_PERCENT"
+.LASF3162:
+	.string	"functionMask"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF2450:
+	.string	"OSD_ALTERNATE_LAYOUT_COUNT 3"
+.LASF1675:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1278:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2914:
+	.string	"FEATURE_UNUSED_10"
+.LASF2921:
+	.string	"FEATURE_UNUSED_11"
+.LASF2639:
+	.string	"SA_MODE_GET_FREQ_BY_FREQ 1"
+.LASF2150:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2975:
+	.string	"GPS_FIX_HOME"
+.LASF1189:
+	.string	"__suseconds_t_defined "
+.LASF1739:
+	.string	"__MATHDECL_1"
+.LASF2390:
+	.string	"FAT_FILE_ATTRIBUTE_SYSTEM 0x04"
+.LASF1082:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF3229:
+	.string	"TASK_BATTERY"
+.LASF2554:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2264:
+	.string	"UART8_RX_BUFFER_SIZE 256"
+.LASF1439:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1688:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF2759:
+	.string	"rate_denom"
+.LASF1238:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF2655:
+	.string	"VTX_TRAMP_5G8_CHANNEL_COUNT 8"
+.LASF2762:
+	.string	"compression"
+.LASF395:
+	.string	"true 1"
+.LASF2692:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF3188:
+	.string	"BOXNAVLAUNCH"
+.LASF1690:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2620:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1951:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2854:
+	.string	"FLASH_PARTITION_TYPE_FULL_BACKUP"
+.LASF3033:
+	.string	"BEEPER_LAUNCH_MODE_ENABLED"
+.LASF3291:
+	.string	"mspSerialInit"
+.LASF1900:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1584:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1633:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1105:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1377:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF1766:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1761:
+	.string	"FP_SUBNORMAL 3"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1172:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1765:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1121:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2836:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2837:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2838:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2839:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1421:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1464:
+	.string	"__DECL_SIMD_expl "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2357:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1402:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF3219:
+	.string	"SENSOR_INDEX_BARO"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2166:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2080:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2229:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF2851:
+	.string	"FLASH_PARTITION_TYPE_BADBLOCK_MANAGEMENT"
+.LASF1491:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2361:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF2525:
+	.string	"L_ctermid 9"
+.LASF2011:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2312:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2487:
+	.string	"DJI_MSP_RC_TUNING 111"
+.LASF2384:
+	.string	"FAT_SMALLEST_LEGAL_CLUSTER_NUMBER 2"
+.LASF1437:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2730:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF3144:
+	.string	"OSD_ESC_RPM"
+.LASF1359:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF986:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1197:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1081:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2526:
+	.string	"FOPEN_MAX"
+.LASF2627:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1679:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2896:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF3158:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1352:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2892:
+	.string	"FAILURE_GYRO_INIT_FAILED"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1427:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1283:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF3281:
+	.string	"isMPUSoftReset"
+.LASF1716:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1729:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1903:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3146:
+	.string	"OSD_ITEM_COUNT"
+.LASF2328:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF2481:
+	.string	"DJI_MSP_RC 105"
+.LASF2716:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1001:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2669:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2677:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1419:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF2272:
+	.string	"DEF_TIM_DMAMAP_VARIANT__1(_0,_1,...) _1"
+.LASF1733:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1833:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2486:
+	.string	"DJI_MSP_ANALOG 110"
+.LASF1211:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF1195:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1990:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3257:
+	.string	"vtxSmartAudioInit"
+.LASF1361:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF699:
+	.string	"__need_NULL "
+.LASF1156:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1117:
+	.string	"__f64(x) x ##f64"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1458:
+	.string	"__DECL_SIMD_logf128 "
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2502:
+	.string	"____FILE_defined 1"
+.LASF2472:
+	.string	"DJI_API_VERSION_MINOR 42"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF1250:
+	.string	"PG_CF_START 1"
+.LASF1438:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF2069:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1949:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2855:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE_UPDATE_META"
+.LASF2955:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2674:
+	.string	"MIDRC_MIN 1200"
+.LASF1634:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1456:
+	.string	"__DECL_SIMD_logf32 "
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1594:
+	.string	"__DECL_SIMD_log10l "
+.LASF2364:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1260:
+	.string	"PG_PID_PROFILE 14"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1368:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF2314:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2712:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF2973:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1107:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2913:
+	.string	"FEATURE_BLACKBOX"
+.LASF3287:
+	.string	"servosInit"
+.LASF2991:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF2704:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1662:
+	.string	"__DECL_SIMD_asinh "
+.LASF2040:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2310:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2417:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF3127:
+	.string	"OSD_TEMP_SENSOR_1_TEMPERATURE"
+.LASF2966:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF2485:
+	.string	"DJI_MSP_ALTITUDE 109"
+.LASF3230:
+	.string	"TASK_TEMPERATURE"
+.LASF1303:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1037:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF2822:
+	.string	"RESOURCE_INPUT"
+.LASF2344:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2303:
+	.string	"CC_CHANNELS_PER_TIMER 4"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2660:
+	.string	"VTX_FFPV_BAND_COUNT 2"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF1643:
+	.string	"__DECL_SIMD_erff "
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1572:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1760:
+	.string	"FP_ZERO 2"
+.LASF1259:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1669:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1901:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1676:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF936:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2615:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF2015:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2163:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2360:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2808:
+	.string	"OWNER_RX"
+.LASF2580:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1525:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF3251:
+	.string	"SYSTEM_STATE_TRANSPONDER_ENABLED"
+.LASF1145:
+	.string	"__clockid_t_defined 1"
+.LASF1894:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2224:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2646:
+	.string	"SA_MODE_SET_OUT_RANGE_PITMODE 2"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2780:
+	.string	"LOG_TOPIC_COUNT"
+.LASF2190:
+	.string	"LED2_ON do {} while (0)"
+.LASF2935:
+	.string	"ROLL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF3104:
+	.string	"OSD_THROTTLE_EXPO"
+.LASF2724:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2609:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF2474:
+	.string	"DJI_MSP_FC_VARIANT 2"
+.LASF2709:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF3054:
+	.string	"OSD_ROLL_PIDS"
+.LASF2429:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF1478:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2317:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF2066:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"USE_LOG "
+.LASF1829:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2745:
+	.string	"signed char"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2871:
+	.string	"throttleIdle"
+.LASF1147:
+	.string	"__timer_t_defined 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2465:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1744:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF949:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2809:
+	.string	"OWNER_TX"
+.LASF1164:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF3080:
+	.string	"OSD_ATTITUDE_ROLL"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF2205:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF3058:
+	.string	"OSD_GPS_LON"
+.LASF3053:
+	.string	"OSD_ALTITUDE"
+.LASF1221:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1394:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1737:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1031:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF374:
+	.string	"__unix 1"
+.LASF2349:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2372:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF3279:
+	.string	"cmsInit"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2031:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1236:
+	.string	"__need___va_list"
+.LASF1499:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF2877:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF972:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF2117:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF3289:
+	.string	"logInit"
+.LASF2149:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF3019:
+	.string	"BEEPER_ARMING"
+.LASF1129:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2700:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF2564:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1044:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1253:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1118:
+	.string	"__f32x(x) x ##f32x"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2570:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1835:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1731:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1788:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2418:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF1024:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF3083:
+	.string	"OSD_RADAR"
+.LASF3249:
+	.string	"SYSTEM_STATE_SENSORS_READY"
+.LASF1974:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1659:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1013:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF2062:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1563:
+	.string	"__DECL_SIMD_sinhf "
+.LASF2054:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2168:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1247:
+	.string	"__va_list__ "
+.LASF1597:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2038:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3221:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF977:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2241:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF3016:
+	.string	"BEEPER_RX_LOST"
+.LASF1342:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF2061:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1752:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2642:
+	.string	"SA_MODE_GET_OUT_RANGE_PITMODE 8"
+.LASF1960:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2421:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF2631:
+	.string	"VTX_SMARTAUDIO_MAX_CHANNEL 8"
+.LASF2089:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1580:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF3170:
+	.string	"portConfigs"
+.LASF1970:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1717:
+	.string	"_Mdouble_"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1709:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1555:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1828:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2753:
+	.string	"uint16_t"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF3108:
+	.string	"OSD_MANUAL_RC_EXPO"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1108:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF3226:
+	.string	"TASK_GYROPID"
+.LASF1346:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF935:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF2081:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1409:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF2852:
+	.string	"FLASH_PARTITION_TYPE_FIRMWARE"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2876:
+	.string	"PWM_TYPE_STANDARD"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2782:
+	.string	"long long unsigned int"
+.LASF2346:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2002:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF3085:
+	.string	"OSD_WIND_SPEED_VERTICAL"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1397:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1042:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2030:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1660:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF857:
+	.string	"USE_MAG "
+.LASF961:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1513:
+	.string	"__DECL_SIMD_hypotf "
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF2909:
+	.string	"FEATURE_RSSI_ADC"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2845:
+	.string	"ADC_AIRSPEED"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF2710:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF2244:
+	.string	"PWM_TIMER_HZ 1000000"
+.LASF1880:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1650:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2675:
+	.string	"MIDRC_MAX 1700"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2402:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF2976:
+	.string	"GPS_FIX"
+.LASF2630:
+	.string	"VTX_SMARTAUDIO_MIN_CHANNEL 1"
+.LASF975:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF2199:
+	.string	"NVIC_PRIO_SERIALUART 5"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF3096:
+	.string	"OSD_POS_Z_PIDS"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF739:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1585:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2796:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2124:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF2773:
+	.string	"LOG_TOPIC_PWM"
+.LASF1628:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1046:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF1590:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1395:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2549:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1749:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1750:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF2867:
+	.string	"motorPwmProtocol"
+.LASF1781:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2672:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1826:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1646:
+	.string	"__DECL_SIMD_erff32 "
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF3040:
+	.string	"OSD_CROSSHAIRS"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1312:
+	.string	"PG_INAV_END 1023"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF2459:
+	.string	"OSD_HOMING_LIM_H1 6"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1015:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF2872:
+	.string	"throttleScale"
+.LASF1651:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1443:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2982:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF3244:
+	.string	"TASK_NONE"
+.LASF3246:
+	.string	"motorControlEnable"
+.LASF1850:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1658:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF3159:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2621:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2469:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF1635:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF1961:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2736:
+	.string	"UIB_DEVICE_ID_RANGEFINDER 0x12"
+.LASF2531:
+	.string	"__attr_dealloc_fclose"
+.LASF2498:
+	.string	"__need___va_list "
+.LASF702:
+	.string	"_SIZE_T "
+.LASF1020:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF1133:
+	.string	"__dev_t_defined "
+.LASF1570:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2583:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF1695:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2249:
+	.string	"UART_AF(uart,af) CONCAT3(GPIO_AF, af, _ ## uart)"
+.LASF955:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1706:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF3309:
+	.string	"motorConfig"
+.LASF2172:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1851:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1199:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1101:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF3247:
+	.string	"SYSTEM_STATE_INITIALISING"
+.LASF1892:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1672:
+	.string	"__DECL_SIMD_erfc "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1033:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2302:
+	.string	"DEF_TIM_OUTPUT__CH4N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF3066:
+	.string	"OSD_ONTIME_FLYTIME"
+.LASF2533:
+	.string	"_BITS_STDIO_H 1"
+.LASF1146:
+	.string	"__time_t_defined 1"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF3232:
+	.string	"TASK_COMPASS"
+.LASF1309:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF2483:
+	.string	"DJI_MSP_COMP_GPS 107"
+.LASF3079:
+	.string	"OSD_ATTITUDE_PITCH"
+.LASF2696:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF1975:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1413:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF958:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2967:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1252:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF2227:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF2817:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1883:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2398:
+	.string	"FLASHFS_WRITE_BUFFER_SIZE 128"
+.LASF2623:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MIN 1080"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1233:
+	.string	"__TFP_PRINTF__ "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2480:
+	.string	"DJI_MSP_STATUS 101"
+.LASF2250:
+	.string	"UART1_RX_BUFFER_SIZE 256"
+.LASF2687:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2386:
+	.string	"FAT12_MAX_CLUSTERS 4084"
+.LASF3009:
+	.string	"PID_HEADING"
+.LASF2875:
+	.string	"motorConfig_System"
+.LASF2202:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF2336:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF1316:
+	.string	"PG_ID_INVALID 0"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2139:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF2113:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF2831:
+	.string	"RESOURCE_I2C_SDA"
+.LASF1168:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1065:
+	.string	"__need_wchar_t "
+.LASF2457:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1371:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF2900:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF3051:
+	.string	"OSD_GPS_SPEED"
+.LASF1723:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1715:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2751:
+	.string	"char"
+.LASF1270:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2790:
+	.string	"OWNER_ADC"
+.LASF2505:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF1148:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1627:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1711:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2235:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF3046:
+	.string	"OSD_CRAFT_NAME"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1473:
+	.string	"__DECL_SIMD_powf "
+.LASF994:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1724:
+	.string	"_Mdouble_ long double"
+.LASF1385:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1459:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1487:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1514:
+	.string	"__DECL_SIMD_hypotl "
+.LASF3179:
+	.string	"BOXHEADFREE"
+.LASF1681:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2518:
+	.string	"SEEK_CUR 1"
+.LASF1205:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF2862:
+	.string	"blackboxConfig_s"
+.LASF2763:
+	.string	"blackboxConfig_t"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF3039:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1764:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1726:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1069:
+	.string	"WSTOPPED 2"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2164:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1653:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1023:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2717:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF2270:
+	.string	"DEF_TIM_DMAMAP(variant,timch) CONCAT(DEF_TIM_DMAMAP__, PP_CALL(CONCAT(DEF_TIM_DMAMAP_VARIANT__, variant), CONCAT(DEF_TIM_DMA__, DEF_TIM_TCH2BTCH(timch)), DMA_VARIANT_MISSING, DMA_VARIANT_MISSING))"
+.LASF2640:
+	.string	"SA_MODE_GET_PITMODE 2"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2833:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2590:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF2412:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF948:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2813:
+	.string	"OWNER_COMPASS"
+.LASF2105:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF943:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF933:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF2890:
+	.string	"FAILURE_INVALID_EEPROM_CONTENTS"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF3014:
+	.string	"BEEPER_RUNTIME_CALIBRATION_DONE"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1339:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1959:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1798:
+	.string	"IOCFG_IPD 0"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2714:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF2936:
+	.string	"PITCH"
+.LASF914:
+	.string	"NOINLINE "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF2024:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2140:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF946:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1832:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2897:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF3035:
+	.string	"BEEPER_CAM_CONNECTION_CLOSE"
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF3128:
+	.string	"OSD_TEMP_SENSOR_2_TEMPERATURE"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1150:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1837:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF3242:
+	.string	"TASK_BLACKBOX"
+.LASF1481:
+	.string	"__DECL_SIMD_powf128x "
+.LASF2925:
+	.string	"systemConfig_s"
+.LASF2933:
+	.string	"systemConfig_t"
+.LASF1586:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2960:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1922:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1475:
+	.string	"__DECL_SIMD_powf16 "
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF2475:
+	.string	"DJI_MSP_FC_VERSION 3"
+.LASF2784:
+	.string	"OWNER_PWMIO"
+.LASF2547:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF2175:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2094:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1379:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1864:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2462:
+	.string	"OSD_HOMING_LIM_V1 5"
+.LASF466:
+	.string	"__PMT"
+.LASF2962:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1601:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2253:
+	.string	"UART2_TX_BUFFER_SIZE 256"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2053:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF3209:
+	.string	"BOXNAVCRUISE"
+.LASF991:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF2977:
+	.string	"CALIBRATE_MAG"
+.LASF2045:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1079:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF2561:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF2191:
+	.string	"NVIC_PRIO_MAX 1"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2807:
+	.string	"OWNER_LED"
+.LASF2637:
+	.string	"VTX_SMARTAUDIO_MIN_FREQUENCY_MHZ 5000"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1556:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF3307:
+	.string	"serialConfig"
+.LASF3248:
+	.string	"SYSTEM_STATE_CONFIG_LOADED"
+.LASF965:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1921:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2827:
+	.string	"RESOURCE_UART_RX"
+.LASF3003:
+	.string	"PID_YAW"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF2385:
+	.string	"FAT_MAXIMUM_FILESIZE 0xFFFFFFFF"
+.LASF1369:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF1467:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2077:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2734:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1325:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2209:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF1422:
+	.string	"__DECL_SIMD_cos "
+.LASF2266:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF1423:
+	.string	"__DECL_SIMD_cosf "
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2958:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF2645:
+	.string	"SA_MODE_SET_IN_RANGE_PITMODE 1"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1667:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2400:
+	.string	"FLASHFS_WRITE_BUFFER_AUTO_FLUSH_LEN 64"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2187:
+	.string	"LED1_ON do {} while (0)"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1603:
+	.string	"__DECL_SIMD_log2f "
+.LASF2702:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF2391:
+	.string	"FAT_FILE_ATTRIBUTE_VOLUME_ID 0x08"
+.LASF2775:
+	.string	"LOG_TOPIC_IMU"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2929:
+	.string	"i2c_speed"
+.LASF1891:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF3031:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF2870:
+	.string	"digitalIdleOffsetValue"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF1196:
+	.string	"NFDBITS __NFDBITS"
+.LASF1602:
+	.string	"__DECL_SIMD_log2 "
+.LASF2928:
+	.string	"debug_mode"
+.LASF2772:
+	.string	"LOG_TOPIC_PITOT"
+.LASF1281:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF3254:
+	.string	"batteryInit"
+.LASF1993:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF3021:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1231:
+	.string	"__COMPAR_FN_T "
+.LASF1985:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1812:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2128:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2377:
+	.string	"MBR_PARTITION_TYPE_FAT16 0x06"
+.LASF993:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1038:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF2423:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF3091:
+	.string	"OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2868:
+	.string	"motorAccelTimeMs"
+.LASF2826:
+	.string	"RESOURCE_UART_TX"
+.LASF2541:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF984:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1644:
+	.string	"__DECL_SIMD_erfl "
+.LASF1908:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1592:
+	.string	"__DECL_SIMD_log10 "
+.LASF1615:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2499:
+	.string	"_____fpos_t_defined 1"
+.LASF1527:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1414:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2516:
+	.string	"EOF (-1)"
+.LASF2174:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF3211:
+	.string	"BOXUSER1"
+.LASF3212:
+	.string	"BOXUSER2"
+.LASF2842:
+	.string	"ADC_BATTERY"
+.LASF2575:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF1535:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1025:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1263:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1064:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2931:
+	.string	"throttle_tilt_compensation_strength"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF3265:
+	.string	"telemetryInit"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1380:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF2393:
+	.string	"FAT_FILE_ATTRIBUTE_ARCHIVE 0x20"
+.LASF1619:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1969:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1700:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2409:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF2292:
+	.string	"BTCH_TIM15_CH1N BTCH_TIM15_CH1"
+.LASF3272:
+	.string	"cliInit"
+.LASF2256:
+	.string	"UART4_RX_BUFFER_SIZE 256"
+.LASF1748:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2571:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF3271:
+	.string	"persistentObjectWrite"
+.LASF1059:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2938:
+	.string	"AUX1"
+.LASF2939:
+	.string	"AUX2"
+.LASF2940:
+	.string	"AUX3"
+.LASF2941:
+	.string	"AUX4"
+.LASF2942:
+	.string	"AUX5"
+.LASF2943:
+	.string	"AUX6"
+.LASF2944:
+	.string	"AUX7"
+.LASF2945:
+	.string	"AUX8"
+.LASF2946:
+	.string	"AUX9"
+.LASF1533:
+	.string	"__DECL_SIMD_exp10f "
+.LASF2506:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2212:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF1564:
+	.string	"__DECL_SIMD_sinhl "
+.LASF2425:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2739:
+	.string	"UIB_DEVICE_ID_RC_RECEIVER 0x80"
+.LASF1576:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF3199:
+	.string	"BOXFLAPERON"
+.LASF2556:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2619:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF997:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2846:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF971:
+	.string	"ATOMIC_BLOCK(prio) for ( uint8_t __basepri_save __attribute__((__cleanup__(__basepriRestoreMem))) = __get_BASEPRI(), __ToDo = __basepriSetMemRetVal((prio) << (8U - __NVIC_PRIO_BITS)); __ToDo ; __ToDo = 0 )"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1317:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF966:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2777:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF2260:
+	.string	"UART6_RX_BUFFER_SIZE 256"
+.LASF3245:
+	.string	"TASK_SELF"
+.LASF1906:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1280:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF2020:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF1862:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1433:
+	.string	"__DECL_SIMD_sinf "
+.LASF1852:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF3241:
+	.string	"TASK_GLOBAL_FUNCTIONS"
+.LASF1313:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1219:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2810:
+	.string	"OWNER_RX_SPI"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1218:
+	.string	"__ONCE_ALIGNMENT "
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF3168:
+	.string	"serialPortConfig_t"
+.LASF2267:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF2800:
+	.string	"OWNER_USB"
+.LASF2279:
+	.string	"DEF_TIM_CHNL_CH3N 2"
+.LASF2803:
+	.string	"OWNER_BARO"
+.LASF2440:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF2490:
+	.string	"DJI_MSP_ESC_SENSOR_DATA 134"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2659:
+	.string	"VTX_TRAMP_MAX_FREQUENCY_MHZ 5999"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF1041:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1547:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF717:
+	.string	"__size_t "
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1110:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1904:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1440:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2799:
+	.string	"OWNER_FLASH"
+.LASF3124:
+	.string	"OSD_IMU_TEMPERATURE"
+.LASF2635:
+	.string	"VTX_SMARTAUDIO_DEFAULT_POWER_COUNT 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF3269:
+	.string	"rxInit"
+.LASF2493:
+	.string	"DJI_MSP_SET_FILTER_CONFIG 93"
+.LASF1162:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF3237:
+	.string	"TASK_OPFLOW"
+.LASF3106:
+	.string	"OSD_ROLL_RATE"
+.LASF1343:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2476:
+	.string	"DJI_MSP_NAME 10"
+.LASF1786:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF2998:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2898:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1968:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1135:
+	.string	"__mode_t_defined "
+.LASF3177:
+	.string	"BOXNAVALTHOLD"
+.LASF1077:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF2683:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF1740:
+	.string	"__MATHDECL_ALIAS"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2622:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1928:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF3224:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF3123:
+	.string	"OSD_3D_SPEED"
+.LASF1562:
+	.string	"__DECL_SIMD_sinh "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1604:
+	.string	"__DECL_SIMD_log2l "
+.LASF1878:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1326:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1946:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2515:
+	.string	"BUFSIZ 8192"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF2004:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1355:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3256:
+	.string	"vtxTrampInit"
+.LASF1769:
+	.string	"MATH_ERRNO 1"
+.LASF1047:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1489:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF2019:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF3136:
+	.string	"OSD_MAP_SCALE"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2617:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1054:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2332:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2215:
+	.string	"RESET_MSC_REQUEST 2"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF1600:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF3240:
+	.string	"TASK_LOGIC_CONDITIONS"
+.LASF2420:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1268:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1638:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1698:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1618:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2300:
+	.string	"DEF_TIM_OUTPUT__CH2N (TIMER_OUTPUT_N_CHANNEL)"
+.LASF2726:
+	.string	"ESC_DATA_MAX_AGE 10"
+.LASF1965:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2579:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1192:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2520:
+	.string	"P_tmpdir \"/tmp\""
+.LASF3044:
+	.string	"OSD_FLYTIME"
+.LASF2879:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF2329:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2662:
+	.string	"VTX_FFPV_POWER_COUNT 4"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2706:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF1777:
+	.string	"M_PI 3.14159265358979323846"
+.LASF2259:
+	.string	"UART5_TX_BUFFER_SIZE 256"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2210:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF1308:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF944:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2555:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1207:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2743:
+	.string	"unsigned int"
+.LASF1839:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF2114:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2969:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF2738:
+	.string	"UIB_DEVICE_ID_COMPASS 0x14"
+.LASF1874:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1713:
+	.string	"_Mdouble_ double"
+.LASF2104:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF2096:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2376:
+	.string	"RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)"
+.LASF1002:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3351:
+	.string	"color.h"
+.LASF3479:
+	.string	"exti.h"
+.LASF3329:
+	.string	"src/main/io"
+.LASF3380:
+	.string	"gyro.h"
+.LASF3417:
+	.string	"time64.h"
+.LASF3477:
+	.string	"dma.h"
+.LASF3419:
+	.string	"stdint-intn.h"
+.LASF3520:
+	.string	"ledstrip.h"
+.LASF3509:
+	.string	"streambuf.h"
+.LASF3424:
+	.string	"strings.h"
+.LASF3384:
+	.string	"uav_interconnect.h"
+.LASF3497:
+	.string	"logic_condition.h"
+.LASF3320:
+	.string	"src/main/drivers/accgyro"
+.LASF3437:
+	.string	"utils.h"
+.LASF3478:
+	.string	"accgyro.h"
+.LASF3493:
+	.string	"io_def_generated.h"
+.LASF3397:
+	.string	"osd_dji_hd.h"
+.LASF3407:
+	.string	"libc-header-start.h"
+.LASF3406:
+	.string	"stdint.h"
+.LASF3361:
+	.string	"runtime_config.h"
+.LASF3318:
+	.string	"src/main/common"
+.LASF3458:
+	.string	"pthreadtypes.h"
+.LASF3504:
+	.string	"timer_def.h"
+.LASF3368:
+	.string	"scheduler.h"
+.LASF3405:
+	.string	"stdbool.h"
+.LASF3519:
+	.string	"flashfs.h"
+.LASF3404:
+	.string	"stdc-predef.h"
+.LASF3460:
+	.string	"pthreadtypes-arch.h"
+.LASF3401:
+	.string	"io.h"
+.LASF3411:
+	.string	"timesize.h"
+.LASF3498:
+	.string	"pwm_output.h"
+.LASF3466:
+	.string	"stdlib-float.h"
+.LASF3385:
+	.string	"rx.h"
+.LASF3388:
+	.string	"fc_msp.h"
+.LASF3344:
+	.string	"/usr/include"
+.LASF3535:
+	.string	"pinio.h"
+.LASF3449:
+	.string	"endian.h"
+.LASF3340:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3455:
+	.string	"__sigset_t.h"
+.LASF3391:
+	.string	"cms.h"
+.LASF3386:
+	.string	"failsafe.h"
+.LASF3369:
+	.string	"fc_init.c"
+.LASF3472:
+	.string	"1-wire.h"
+.LASF3359:
+	.string	"system.h"
+.LASF3342:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF3377:
+	.string	"vtx_control.h"
+.LASF3473:
+	.string	"bus_i2c.h"
+.LASF3392:
+	.string	"boardalignment.h"
+.LASF3482:
+	.string	"vector.h"
+.LASF3398:
+	.string	"msp_serial.h"
+.LASF3463:
+	.string	"struct_rwlock.h"
+.LASF3536:
+	.string	"filter.h"
+.LASF3337:
+	.string	"src/main/telemetry"
+.LASF3465:
+	.string	"stdlib-bsearch.h"
+.LASF3395:
+	.string	"servos.h"
+.LASF3332:
+	.string	"src/main/rx"
+.LASF3379:
+	.string	"barometer.h"
+.LASF3501:
+	.string	"serial_uart.h"
+.LASF3537:
+	.string	"spektrum.h"
+.LASF3488:
+	.string	"fp-fast.h"
+.LASF3502:
+	.string	"serial_usb_vcp.h"
+.LASF3394:
+	.string	"feature.h"
+.LASF3490:
+	.string	"mathcalls.h"
+.LASF3522:
+	.string	"rcdevice_cam.h"
+.LASF3471:
+	.string	"cms_types.h"
+.LASF3533:
+	.string	"bitarray.h"
+.LASF3462:
+	.string	"struct_mutex.h"
+.LASF3371:
+	.string	"battery.h"
+.LASF3422:
+	.string	"locale_t.h"
+.LASF3403:
+	.string	"rc_controls.h"
+.LASF3446:
+	.string	"clockid_t.h"
+.LASF3435:
+	.string	"atomic.h"
+.LASF3474:
+	.string	"io_types.h"
+.LASF3508:
+	.string	"msp.h"
+.LASF3483:
+	.string	"math.h"
+.LASF3315:
+	.string	"src/main/blackbox"
+.LASF3453:
+	.string	"select.h"
+.LASF3383:
+	.string	"gps.h"
+.LASF3427:
+	.string	"target.h"
+.LASF3355:
+	.string	"flash.h"
+.LASF3333:
+	.string	"src/main/scheduler"
+.LASF3426:
+	.string	"common.h"
+.LASF3507:
+	.string	"stats.h"
+.LASF3538:
+	.string	"acceleration.h"
+.LASF3442:
+	.string	"waitstatus.h"
+.LASF3444:
+	.string	"floatn-common.h"
+.LASF3485:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3523:
+	.string	"stdio.h"
+.LASF3322:
+	.string	"src/main/drivers/compass"
+.LASF3524:
+	.string	"__fpos_t.h"
+.LASF3433:
+	.string	"blackbox_io.h"
+.LASF3513:
+	.string	"fat_standard.h"
+.LASF3540:
+	.string	"rangefinder.h"
+.LASF3492:
+	.string	"io_def.h"
+.LASF3454:
+	.string	"sigset_t.h"
+.LASF3324:
+	.string	"src/main/drivers/sdcard"
+.LASF3534:
+	.string	"piniobox.h"
+.LASF3495:
+	.string	"nvic.h"
+.LASF3415:
+	.string	"stubs-64.h"
+.LASF3441:
+	.string	"waitflags.h"
+.LASF3378:
+	.string	"pitotmeter.h"
+.LASF3374:
+	.string	"vtx_smartaudio.h"
+.LASF3325:
+	.string	"src/main/drivers"
+.LASF3484:
+	.string	"math-vector.h"
+.LASF3319:
+	.string	"src/main/config"
+.LASF3503:
+	.string	"sound_beeper.h"
+.LASF3376:
+	.string	"vtx_common.h"
+.LASF3350:
+	.string	"debug.h"
+.LASF3521:
+	.string	"pwmdriver_i2c.h"
+.LASF3421:
+	.string	"stddef.h"
+.LASF3399:
+	.string	"timer.h"
+.LASF3339:
+	.string	"src/main"
+.LASF3317:
+	.string	"src/main/cms"
+.LASF3363:
+	.string	"beeper.h"
+.LASF3367:
+	.string	"sensors.h"
+.LASF3362:
+	.string	"pid.h"
+.LASF3372:
+	.string	"vtx_ffpv24g.h"
+.LASF3430:
+	.string	"blackbox_fielddefs.h"
+.LASF3327:
+	.string	"src/main/flight"
+.LASF3451:
+	.string	"byteswap.h"
+.LASF3434:
+	.string	"assert.h"
+.LASF3334:
+	.string	"src/main/sensors"
+.LASF3416:
+	.string	"typesizes.h"
+.LASF3316:
+	.string	"src/main/build"
+.LASF3364:
+	.string	"osd.h"
+.LASF3331:
+	.string	"src/main/navigation"
+.LASF3382:
+	.string	"navigation.h"
+.LASF3475:
+	.string	"rcc_types.h"
+.LASF3338:
+	.string	"src/main/uav_interconnect"
+.LASF3345:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3370:
+	.string	"fc_tasks.h"
+.LASF3448:
+	.string	"timer_t.h"
+.LASF3506:
+	.string	"sdcard.h"
+.LASF3514:
+	.string	"lights.h"
+.LASF3389:
+	.string	"imu.h"
+.LASF3481:
+	.string	"compass.h"
+.LASF3505:
+	.string	"uart_inverter.h"
+.LASF3528:
+	.string	"FILE.h"
+.LASF3500:
+	.string	"serial_softserial.h"
+.LASF3343:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3428:
+	.string	"sanity_check.h"
+.LASF3356:
+	.string	"persistent.h"
+.LASF3349:
+	.string	"blackbox.h"
+.LASF3494:
+	.string	"io_pca9685.h"
+.LASF3400:
+	.string	"light_led.h"
+.LASF3390:
+	.string	"initialisation.h"
+.LASF3336:
+	.string	"src/main/target"
+.LASF3326:
+	.string	"src/main/fc"
+.LASF3328:
+	.string	"src/main/io/asyncfatfs"
+.LASF3517:
+	.string	"displayport_msp.h"
+.LASF3323:
+	.string	"src/main/drivers/rangefinder"
+.LASF3468:
+	.string	"config_eeprom.h"
+.LASF3436:
+	.string	"axis.h"
+.LASF3393:
+	.string	"bus.h"
+.LASF3346:
+	.string	"types.h"
+.LASF3512:
+	.string	"asyncfatfs.h"
+.LASF3469:
+	.string	"parameter_group_ids.h"
+.LASF3461:
+	.string	"atomic_wide_counter.h"
+.LASF3348:
+	.string	"time.h"
+.LASF3347:
+	.string	"stdint-uintn.h"
+.LASF3414:
+	.string	"stubs.h"
+.LASF3530:
+	.string	"stdio_lim.h"
+.LASF3459:
+	.string	"thread-shared-types.h"
+.LASF3423:
+	.string	"__locale_t.h"
+.LASF3476:
+	.string	"bus_spi.h"
+.LASF3486:
+	.string	"flt-eval-method.h"
+.LASF3541:
+	.string	"esc_sensor.h"
+.LASF3450:
+	.string	"endianness.h"
+.LASF3529:
+	.string	"struct_FILE.h"
+.LASF3452:
+	.string	"uintn-identity.h"
+.LASF3515:
+	.string	"dashboard.h"
+.LASF3445:
+	.string	"clock_t.h"
+.LASF3480:
+	.string	"sensor.h"
+.LASF3335:
+	.string	"src/main/target/SITL"
+.LASF3375:
+	.string	"vtx.h"
+.LASF3330:
+	.string	"src/main/msp"
+.LASF3413:
+	.string	"long-double.h"
+.LASF3525:
+	.string	"__mbstate_t.h"
+.LASF3491:
+	.string	"flash_m25p16.h"
+.LASF3352:
+	.string	"log.h"
+.LASF3358:
+	.string	"pwm_mapping.h"
+.LASF3341:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3440:
+	.string	"stdlib.h"
+.LASF3354:
+	.string	"adc.h"
+.LASF3420:
+	.string	"string.h"
+.LASF3432:
+	.string	"build_config.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3409:
+	.string	"features-time64.h"
+.LASF3456:
+	.string	"struct_timeval.h"
+.LASF3408:
+	.string	"features.h"
+.LASF0:
+	.string	"./src/main/fc/fc_init.c"
+.LASF3511:
+	.string	"rpm_filter.h"
+.LASF3366:
+	.string	"rc_modes.h"
+.LASF3531:
+	.string	"ctype.h"
+.LASF3431:
+	.string	"parameter_group.h"
+.LASF3526:
+	.string	"__fpos64_t.h"
+.LASF3532:
+	.string	"rcdevice.h"
+.LASF3373:
+	.string	"vtx_tramp.h"
+.LASF3365:
+	.string	"serial.h"
+.LASF3527:
+	.string	"__FILE.h"
+.LASF3516:
+	.string	"displayport_frsky_osd.h"
+.LASF3510:
+	.string	"quaternion.h"
+.LASF3438:
+	.string	"maths.h"
+.LASF3412:
+	.string	"cdefs.h"
+.LASF3457:
+	.string	"struct_timespec.h"
+.LASF3353:
+	.string	"resource.h"
+.LASF3402:
+	.string	"printf.h"
+.LASF3496:
+	.string	"pwm_esc_detect.h"
+.LASF3499:
+	.string	"rx_pwm.h"
+.LASF3357:
+	.string	"mixer.h"
+.LASF3489:
+	.string	"mathcalls-helper-functions.h"
+.LASF3443:
+	.string	"floatn.h"
+.LASF3387:
+	.string	"cli.h"
+.LASF3518:
+	.string	"displayport_max7456.h"
+.LASF3464:
+	.string	"alloca.h"
+.LASF3321:
+	.string	"src/main/drivers/barometer"
+.LASF3447:
+	.string	"time_t.h"
+.LASF3429:
+	.string	"common_post.h"
+.LASF3381:
+	.string	"telemetry.h"
+.LASF3467:
+	.string	"stdarg.h"
+.LASF3487:
+	.string	"fp-logb.h"
+.LASF3418:
+	.string	"wchar.h"
+.LASF3396:
+	.string	"global_variables.h"
+.LASF3410:
+	.string	"wordsize.h"
+.LASF3439:
+	.string	"memory.h"
+.LASF3470:
+	.string	"display.h"
+.LASF3539:
+	.string	"calibration.h"
+.LASF3360:
+	.string	"config.h"
+.LASF3425:
+	.string	"platform.h"
+	.text
+	.section	.gnu.lto_.profile.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 n\205\001"
+	.string	"\360b"
+	.string	"\003"
+	.string	"\223\374\220\312\006"
+	.string	"\001\362\336\253\322\013&\002"
+	.string	"\001\002\002\003"
+	.string	"\352\263\360\321\b"
+	.string	"\007"
+	.ascii	" \024\2714/\004\300@\312\335\271\266`\200\005"
+	.text
+	.section	.gnu.lto_.ipa_sra.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 \2225\001"
+	.string	"`\206"
+	.string	"\002"
+	.string	""
+	.string	"\001\001"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"9\n\034X\301\n\001P\\P\013\347\272\305Y\206\205\334\334 \033"
+	.ascii	"\300\002"
+	.text
+	.section	.gnu.lto_.inline.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\371"
+	.string	"\345\004"
+	.ascii	"\002\005\023!\240'\351s\347\260\374\277\265\326Q\3139\361\314"
+	.ascii	"\303s\036\365\221g\207\300\240\252\252\217\346\024G\244L\001"
+	.ascii	"\263F\326\272\312\025\371\037\b\001\032\003\001\322'SD\341@\340"
+	.ascii	"\263z\256~\223\336\335\245Wz\215!\221\372\\\252p\030\201\365"
+	.ascii	"\235\213  @\002b,\274\r\216z\030\031\3418\347\263\300\334yT\207"
+	.ascii	"\340\227\341\222!K\302\252\030\030\" 2\n8X\0130\220A\013\360"
+	.ascii	"\t\213\223\206&\032\226$\244\036\\\362\376Ed\f\210a\006\002\334"
+	.ascii	"3#T\353\314\230\331~\320\272\342\016\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\335\005"
+	.string	"\"\207\026\037\260%\351\024\201\204\201\300\3650\034\271\365\303\320l\326Z\032\206\001,\n \2127;\020\"\223\f'\030\270\345\342Rj\201\225#\004\351\335iN\263bd\030\304\003ub\237Xg\241\200\236~_q\305\235h,\306r2\362d}\202\025\221\177\270E\353\030\255y\254XK\262\334\020+ \220\002\221;\272\001#\021\214\024\307\n\326Z\b\203yQ\277\254\243m\236"
+	.ascii	"\003\263\037\033\026\016\003L\017\270\001m;\n\035\366\276Z\033"
+	.ascii	"A\322\207\261\275\354\241F\323\212\206\235kA\376\236\204Lx\207"
+	.ascii	"\366\026p8 H\343TQh\003#O\365-\220{8\265\261\013\216\244=\200"
+	.ascii	"`\013\347\006"
+	.text
+	.section	.gnu.lto_.pureconst.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 \013Y"
+	.string	""
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\002"
+	.ascii	"\230\004\001\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 \030e"
+	.string	""
+	.string	" \f"
+	.string	"\001"
+	.string	"\002"
+	.ascii	"`\343\r`\001"
+	.text
+	.section	.gnu.lto_.lto.23582b31fec1c283,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_flashLedsAndBeep.180.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\344\001\365\017"
+	.string	"\246\232dH\320TQ:\220\204\364[\202=\367l\025\304\223\231"
+	.string	"\027J\031%\246hk\244F\256:\006\305vac-\256moa\364\306\275\025\212\254a\013\327f1R3\312\202+\004\207\342\"\230\204\022*'8\330\361\244\221-wJ\001M"
+	.string	"O"
+	.string	"S"
+	.string	"\027Q\354g=!fEv\327\323\023\036}\212\367\224\251oSe\312\217}"
+	.string	"\216\215\026\250\37267\037<2L\300\017\323\001\211\0249\227]\272@\226\234,h\256\227]E\005P\013\244\271\344Xv\327\262\005\216\270C\267\215\262\r\301\226*\001a\214\206@\301K\2169\264\2255[TI\205\331'\315J\270\260\332\330\334\303\373\242n\b\217\003>\273\"\202\216\354\317v\003\347\341o\037eL\361a\3702w(5R\022,H=\224\021\355\n\216\306lG\220]\321\3007\027\020}{\347\224\r$\237\273\273\223\323\207?QN\017\302\004K\006\231\200+\354z\036\343:h\024*\274L\306\034\"io\200\211P\303R\225;\034\264M\n8\207\220\335\301\203|\313'3\252r\311\310\263\323\340A\311\250\243;/z\314P\205]&\364\360\026jV\262\346\313>[\004^)}\030\\ZV\030\220"
+	.string	"\230\356\217\024cz1]\370J\336W\362^L-\031\274\017\005\343\221\002\370\244\301\005\345\305\234N(\257\023\367j\343\tD~V\312\022\362\330G\243\317\2460\223\334(\247\333\215\274\316\257.\333\036I\3701#\215"
+	.string	"\275VYV\262\026. `\0029V\325\003"
+	.ascii	"\253\b\243\025\271<\205-\275\020@v\245d.\307r\255\363\364\277"
+	.ascii	"=\207{\211\266\332\2538+\025\355\001\304Z\337\306\304\b\334\221"
+	.ascii	"\240\021c\261\333\260\234B\240/$\305@\234)\277\2531\n\227\251"
+	.ascii	"\342\311\003p&\316\304\007K\327\246\315E\327\301\253M/\374\013"
+	.ascii	"\021df\343F\366B}\274\017\221\316\005\237"
+	.text
+	.section	.gnu.lto_init.181.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\035\016\2059"
+	.string	"\252X\364\023GP\234R\007\373\215\005'\273\200\261\033\2704\n\017\021\001\227\013\263\357\276\203l\275r\031c\2073-\310\330)"
+	.string	"\240\266`\300\311\2165@D\003"
+	.string	"\264\343i\005\020\003\016\016D\302\333\030\006Z`6\214l\263{o)S\n\"\001\024\0012\001\332a\255\375\325\332]\255}o\355Zk\177\026_%/\353\252\252f\203\261\312P[52\336;%\354\255\357C\266\300\037\315\237\315\213>H\026\274\332\257\305o\365\272\236&\253L\375"
+	.ascii	"\250Ek\360\257'\020\376\333\363L\370_\367\225\360\277>\343\321"
+	.ascii	"|\317\271qe\241\311\262\\\324E\217\335\311\274\225K~7\300'7\255"
+	.ascii	",\313\316M\304\337w\255\357E\035\177\016s\251L\342\334 \2176"
+	.ascii	"\306\"\2619\024\006\341\327\335:\366\017\n\r\247T\246\3171\362"
+	.ascii	"L#`z\371\365\312\257\":\351\3658^]\372\206\353\221cQ\\?\3641"
+	.ascii	"\353m~\216\312\302\322F\227X\007\027\367s\324\225\033\3445v\304"
+	.ascii	"\207.\006\205\206HY=\361\243V\337d\373\002cQWn\317\331\027\230"
+	.ascii	"\243\302\364\260\2000(\024D\252\307\007\347\250*\267G\226\345"
+	.ascii	"'\r\357\370\327e\200\235Cs\244\322p\231PF\246N\332\245\372\355"
+	.string	"\0029i\257\216\324&\327\370\367\224\367g\257mP\245Z\007\205dYv=\245J\275\353\274\373\233\271\373\007w\2337\361\307dpp\273\307e\261\022\247\315\344\360\016\372h\267~|\006\273\307i\361\232\376)\274;h5M\341i\263\026\236:@7xw\f\031\220f\032\342\312\336+\033\002\247Y\016og\345\335\004\364\324t\334\217\331\335u?\315\376\363\300{\273\373\237\250\244z\353S\366^\352U\311\220\323fu\264\336\356\035<4m&\377\255\367\203\2475\356 >.\204P\226\233\"\370\303\275\024\021\376_\377\372\b\022$\340\177\177#\350R;\242\231K`\211\266\314F0\360\264\331#\263\023\307\261\271\250\335U$\351\237z\217t3\271\226\2025\377\023\366o\373&O\377/w\261\244\177\372\257\377\022\374\3572L_To}\311'\347\227\2255\240\273U\252w\325\375\337\353\356\016\353{\313}\350\255\357;Z\273"
+	.string	"\255=\200\253\035\200\253]\307\325\336\324\332s\264v\246\253}\351jW\272\332\223Z;\216\326~\363jG\276\332\217\257v\233W\273\321\325^|\265\023_\355C\255]\270\265\007\335~\004\230\314P\300k\331\204\n\306+\326\204\ng\3777\256V\306]\365\241\017\342\320~\275\232\r~g\333\360:xg_\330k\322\177n\232\035\027\212j\300weY\226\213C\373\255\337\023\325\200\356\340w\366\320~\032Y\007\266l=\357x\325q\274N\315\035<\004y\266\377\034W\352\336^tS5\210\273\352\337\334[\332OB\003\223;Hk"
+	.ascii	"\032!\275\373>f\202\335ci\354\224F\326f\237\230J\304\374\262"
+	.ascii	"8\372\311}\036\370f\343\350\246\233\275\324K3D\352\250[eY>n\344"
+	.ascii	"\366\310'\264\331\201\310\265\355vk\3346\1775\342)\243\221\016"
+	.ascii	"\213\327}\215\321\006c\300\305]\324\266G\001G\f\245\177Z\334"
+	.ascii	"@Ztw\260\226\3459\t^de\357\256:\361eY\036n\342\376\247*\351\363"
+	.ascii	"}6>\213\251\361\324\024\374\357p7\273\252\350\326f7H\367\310"
+	.ascii	"<\342\036F\272\263\331\300\233\030\334\336Uw?\004,\334EmzM\372"
+	.ascii	"\317\352\307\354\275\230\030+\376\021\003\211\201\300\377\nw"
+	.ascii	"\263KMi&d\254*F$\253KIUD\rX\022\033\207%\355\022\350\216\342"
+	.ascii	"g\005\021\222\322\321\222\363\211\324t\b&\214\212\216\210 D\370"
+	.ascii	"Q\"\275\033\375\274@b\201T\302\310\204\323\310\204\223\005\022"
+	.ascii	"Q\222\323Hi\311\371\243\343\317\026GJ\316\027\317\247\222\263"
+	.ascii	"h\215\276P\f\031^tK]\200~\223\237\007\016\260\005\264\005P!6"
+	.ascii	"\247\320\337\367\377P\2600\350\221;<m\226\254N\316/\373O8\355"
+	.ascii	"\t-[\332\341\352Ka\267\227\243d\217\t\340&\n \311\022\037g1T"
+	.ascii	"\n\251\264\030\352o\255\217-\333\206u\263sr\002J\322\t&Q\300"
+	.ascii	"\224\315oK\260~Y\005_\254,\341\276,Q\352\bu\310\304\264\331\270"
+	.ascii	".\333\344\334\223.fp\232Z\352\233\033H\313\bK\007cY\353\212\262"
+	.ascii	"Xy\323a\365\313\352O\323[\320\353\013F\265\025\210&\313\321\237"
+	.ascii	"\272\016\242\205@\261@\265@\257\320\253C\271@\273\350\237\022"
+	.ascii	"\337th\371a\211ih\377PysSg\314\024Q\231\275\024\311\201I2\323"
+	.ascii	"\213\241\212\220\2109\222\243\255\364\363\300\314\235\243\253"
+	.ascii	"\230\nf\254\033\r\372\037Z\006v\207\362A\315<\231y wuyf\271\203"
+	.ascii	"\264\024\314S\3074I\322+\237\315\256*}\364\313\312\r\244\025"
+	.ascii	"\210\325f\003\2014\250A<i\031\032\031\021\021\221$I!\215\001"
+	.ascii	"\301\005\304(\244\234;\017\021\300$\206\224\263\2146\205Bc\222"
+	.ascii	"a\002\264\037\2350\243\030p\031\310+\222\250j2s\034P*\32206H"
+	.ascii	"\237\263\354\031r\314\245\212s\206\033c\377\240\266q\327=\266"
+	.ascii	"/\365Q\357\017\210\310\355\r-Jc\025WX\322\252\236\0235\251\264"
+	.ascii	"\254\337\320ru\265\363~\347\254\341\225\377*E@%$`k\357\343R\022"
+	.ascii	"\230S1\352 }l+_\352\336\350\344>>\\\201\264\375%\204\207\373"
+	.ascii	"\207P\270\251\347\314C\023Y%\005\327\261m4\367zX\352\003\224"
+	.ascii	"R\334\367\210\364.k\007\201EPo\273\022H[1\362#\252\334b\317\251"
+	.ascii	"\315?\233\037\204\270\277r\t}R\344\005\250\310\n\202\021\352"
+	.ascii	"\247\241\374-\2202\306%\304\3330dj\240\323C\206\341s\256\225"
+	.ascii	"\\\363h\336]\235n&f\237w \273<\227\201\203G\221,\b\336k\235]"
+	.ascii	"\301\241\263\t\r\344\310\237.\200f4\347A\346\327"
+	.string	"\341\316\t\315\210\340}M\226o\004\303m\377D\222\300\361t\356\2121r{\n\251\256\321\177\366+\227M\334l\022\003r\203\241m\026\346\275K\2344\216\020E+\024\347*\355\256\213u\363JBoG\366%\375\223m\313\327f\266\274DM\013\202h\023\304ykpl\371C k8\241h\323\3730\235\366\205\210\013\376VR*(\264\025Ofp\313\227\343\322\221\367\022\300KfXFpeca\314\331T\222u;M\326\312\004\006\025\257\326_\354\241\214lH\371G\007\3377H\352\234\273\243GAF7\026\360\300\2559\323m\2261Pc\324\371\350PV\232\251\020\374\353\343aAH\327\201\256\031\fLi\036d&\322\245H\343\212\244\036\177\001n\t\233\0277h\035\343\317?}\002\277b\341\237\0224J\003\213CY\301'\215\025G\232\267l\243\024\355\035\032\327XK\311%\362\306\244\275\357d\255\2706~AC"
+	.ascii	"\025l?LO\305@!\334\251\245\013\252\211\343\351\177\216\337b\201"
+	.ascii	"-\001\2470\241\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\f\bM\024"
+	.string	"6%|G\240\224J\032\003\300\3530\257\024\274\307w(\376;\214\307Gb8d{\335\275u\213\307z\274N\237\016\254\n\346\242\242\216\227g\327K\220\343\345x9\342\f-\022\021\021\021\021\021\021\253\210X-\306\212\261\202\321\377\221:\355o"
+	.string	"k"
+	.string	"f"
+	.string	"<\273\216\235}\207\316\316\226\263\267\341\354\363f\347\341\333{\330\354>j\366\0374;\220\231=\210\314n\"f\027\002\263\223\350\355Dx{\221\227\335\353,\255\254\030}I\\\366\256w\017A\031\211n\026-\237\261|$\367\b\006\270\215\230\304\030\007\307V\3362\371\267\266vDe\347*\221\240\005\026\343\306\210\246u\021Y\205\257\224\375CI\2141"
+	.string	"\200k\032X\233\331-\352\202\375K\301\016\"\301\016\206`\017;\260\2070\260\213(\260\213\021\330\307\006\354%\004\354a\325NF\265\227M\355'\244v\024Q\273\031\324\236\342iW\341\264\257h\332\321\230\366\026K{\232\322\356\"iWC\332_\034\3550\214\366\030E\273\f\242}\306\320\276&\264\323\b\332k"
+	.ascii	"\3556~\366\033>;\216\236=G?5\n\023nk\003\031\264Z\315\333j%\205"
+	.ascii	"V\337\320\352\003\177\372mq\021\2553\3419e\035\316\210V\031Y"
+	.ascii	"\264\366\246\321\332\223G+o\"\255<\231\264\356\246\322\272\223"
+	.ascii	"K\253n2\255:\311\262\346f\323\232\223N+n\342\326\333\323\212"
+	.ascii	"\022B\255(`\324z\022J\255'\340\324zH\265\016V\2558\3606S\242"
+	.ascii	"\336dq\261Pe]\f\\Y\017\003\007\013s\323K\266L\335z\227\334M\227"
+	.ascii	"\365-\3712y\353\036d\017f\235\203\214Y\3370e\346\314\272\006"
+	.ascii	"\360\027\322\254\377\300\232\365\f\222e\332\254c\220\276y\263"
+	.ascii	"~\001g\335\202\314Yw\352\254+w\326\blq\205 yV\254\236\025\313"
+	.ascii	"g}p\365\263^I\240\325A\270\006\200\203\250!$\203l\356\222\032"
+	.ascii	"i\016`\2036i\341\021p\030\026\t\210\021#\361\310\007@\006\362"
+	.ascii	"u\034\022\254\355r\265A\322Hf7\372\372b\t\303\272\0066\367\312"
+	.ascii	"\330\333`\326\272\261\273\267*\273\272Y\032\336>6\026N!\013s"
+	.ascii	"\206\333\257\262\343\216\367qR\272\336\256k\205,\034\034C'\276"
+	.ascii	"K\244\334qd\222\371\362\304\\?,B2\232$\216Q\3240\251\fc\211a"
+	.ascii	"\025\031M\022\307(jX\371\221\256\267Ll\255\231\274'\322i\257"
+	.ascii	"\211\226M\255\237_R\027\370U"
+	.text
+	.section	.gnu.lto_.refs.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375 c}\002"
+	.string	"r\005\021\034\240)\303\030\253*\177\277\037\277QU\255\377\337\252N\006\270\367\267\350\255\373\255\021)S\3531\225c\253AP1\006\373b\251LS\366\211\344<r4\344\254\020\234\b\214"
+	.string	"\350\201\3310mv\201y\223\232/\002\003\004\001@"
+	.ascii	"?-P"
+	.text
+	.section	.gnu.lto_.decls.23582b31fec1c283,"e",@progbits
+	.string	"(\265/\375`\222&\205\257"
+	.ascii	"Z\025\205>X \fIJ\035\317\027;\317\"\030\236\1779+\200\"\316\320"
+	.ascii	"H\364%\005t\013\216\304\0346\207\037\357\031)eV7\377\255\t\230"
+	.ascii	"\216:\315\335-\334\322\312Qm!\357\005\336\341\327\342\207\255"
+	.ascii	"\022\036\327\231\2773\022\231L\364?L\236\210\207\202Oq\215\212"
+	.ascii	"\352 Z$uo\231Ra\003\325\003*\004\332\301T\246\366\263\307\361"
+	.ascii	"e\031!<+\t@I\023\262\254\306x\321\276\3758\031|>'\025+\332\205"
+	.ascii	"L[\226\032`Q\362\321\317\227\305H\364\210\316(\270\312\345\374"
+	.ascii	"\245K\031-\210e5\257\310\314\207z\310,\\\246(\336^B\251/&Y\365"
+	.ascii	"tK\373{\360]x\017>\367l\344\341\307\245\215\310*\253z3,\346f"
+	.ascii	"\3445\321\302\343IWwe\305\305l\212n6\nDC\236O\366z\357\346b\351"
+	.ascii	"V\263\002#\266,\272+pX\317UE\213\016\357\347\322xL\257\350\232"
+	.ascii	"\242\373\222\225y\231w&\372.\357\345\363r\321\357=\364\365~\213"
+	.ascii	"\177\364\271\270\252\245\367Y\254\350\206\330\335\354\"\"!O\262"
+	.ascii	"\327\373\273\237\263Y\306\273\031\323E\325D#\272w\374\341\303"
+	.ascii	"\207\034\355!\226B\005\352\257=\216\357\202tI{z\244=Uj\317w\332"
+	.ascii	"3\233\366\\\246=oi\037\303\362q\017\305\340\345\374\337\276\211"
+	.ascii	"\303,\343\035g\035za]Y\365l\245\3751\360\245_\276<\006>\317O"
+	.ascii	":\257e\030\332\263\221V\267\350W\323pQ0\247\254\372\207\035q"
+	.ascii	"\332\340lF\023'M\035\2301=\2270\3711\033\345\315&b\243\361\334"
+	.ascii	";N{\266o\341\243\274\224_\373)\017}\265\177\342"
+	.string	"\217\366P\374c\1772\r:x\265/\373\2614~\306|E\325\240\333;\366\327r\017\241\366[\017\226\306\317\275\243\2360`\213\0025\213\356\275?\344|\370\240\2261\271Z\273Q\337\352q|\026\274\227\366\347\241\375\233\332_\205\276\t\201\316)\352\235\307\361=\222O\362\320\r/\026_\370\355\t\331\353\222Ugu\315\217\277\022\037.w\007\016B\373o\360\375\227\337\340\363\032\355\341\301>\376/\016\354]\264\367\266\300f\r\b\220\266\254~\2217\342\377\365^\256A\007\236*\271\366\220\275\367\177q\340\334{\371_\027\274\354\275\274\360\317\363\317\243^EQ\035\361\251\036\243\237+\204\177W\006_s)\336\027f\240tXHY\275\311\372\231\217\343\303\360\031| \036'\353\207lH\231G\316\r\266w\214\341B,#\005\025\262\352\361\343\370\364g\360\271?\007\354\266\f\367\027Q\347\244\363\300\234\234\373W\305\271{\027\367\237"
+	.string	"\026,\"E\340\334\337\370\206\344\212\257\271\277\230\025wws\177\b\26419c@\025*\356\216\201\373\023\335\235\004w\277\300\375\331\334\004\367\254\302\3753\240\346\376\027h\301\335\305\\\306=+\335?\315\375\321\334\377\314\375\235\270?\023\367/s\3771\367O\342\376`\356o\304\375\267\334\237\210\373g\271?\226\373\013q\377 \356\317\202\373\373p\177*\367\237r\177\035\356\217\303\375o\270\277\224\373G\271\377\223\373\327p\377&\367\237\341\376J\356\337t\177\027\356\177\344\376-\334\237\351\376F\356_\344\376K\367\337\356?\002\367\027\201\373\203\300\375S\270\377\220\373\303\356\377\272\277\353\376A\356\317\272\177\320\375W\367\327\200\373c\300\375Kp\177\024\356\377\343\376&\334?\002\356_\302\375Cp\177\020\334\277\001\356\317\343\376\tp\177\017\334\377"
+	.ascii	"\356o\343\3765\356/\343\3760\356\257\272;\233\273\017q\367\022"
+	.ascii	"\356\016\305\335\323/_\276|qOo\334i\244\334s\224\004Q^\210%\275"
+	.ascii	"y\236"
+	.string	"\313q?-E\326\264\262\232\343r\306\222\345<\307e\270\232\2428\307\251\317c\363\317\003\323dj\331\345S}\006\206\2369\322:Xnn9\376y\242\032b\243\005\225\203\233\2429\034\251Re\213\007\023\215s*\215E\017\255\363\203\215-\3079\316\324\255.\207\232\325\002\232\340\224\262\3522(h\035'5\265,\005I\217\033?~^XI\226k\236\245\330\030\3051pd5G\311)\344\250W\330\016$\237\032\222\227<&\272\303\021\024(9\315\327\225\346\342\227eN\312\207\347\264\214\224\276\005Y\243\272\322\035\226~\314\314\362\223\377J\202\362`sEN\215\351\314\363\223\2317\025aZr\013w\227\261A\333J\2422C\013\240\311\217\347&M~,\307\251\264\3331\033\313\222W\200\267\256\254\254\2726\322\027\332~</Y\222\221\324\233\270(\n\351\371\273\242Rq\224\2471X\375x&\203f\262\214\004\001\347\362\305"
+	.string	"\226\304{w6SwHYbZ\357\375xV\342\017\315J\262\230\332\025\326D#\346m*\006^V3T\356\t\022\261-\3551<t\346\361\343\031\t\222\037{\256\2154\263b\347\235E\367>\313@\325\233k\303\221U\217i\241\177M?\236\277\374\241\371+\207=\327V\322\260\345p\261\027\335{)\203_!\226\345$\253\031L\327\270b2\353\242\335\347\246u^\374\344\256\317E\240\271\310\217\201\2101\"uF\267\233g\031\324\2649aA\013\212\366\3771_\007\034\\\\U\272<}]\200\030\261p\242;l\375\344\254\254\345\231\b4\023\311\261\2167R\016\024g\226\274\350^Z\362\240q09\341iyh\216]\256f_"
+	.ascii	"3\345\007\217#Yu\337\016\355\236\335}\373\005L\274\307\210j\336"
+	.ascii	"\203\373\357\323\347\340\356\352\336l\274\225U\260\334\371\320"
+	.ascii	"\240\224\356\362\316\366\275\225\316&\006f\354\005\325d\026A"
+	.ascii	")=\323\013*\211\351\005\245\314\314\264eRsC)\365v&i\346ro/\347"
+	.ascii	"N\242\211\241\366\216\241\224:^673\206rb`\026A%=\323k7w\321n"
+	.ascii	"N\300\334;i{A\325=sC5\231^\316$\f\273HH\023\323\356,\351\303"
+	.ascii	"\316\276\222\352\230E\333\205\006\253\"gs\215\031;\177lo%\230"
+	.ascii	"\321n~\2747\324\3364\234<cE<\224cDk.b\226\212b\345\317H\201("
+	.ascii	"\312)\023\023\3555\346\017\247\220\321\336Vv\n\034(_\031\357"
+	.ascii	"\275Wl\"\345\357m\0247\367&rr`\311\371TV4\367o\027-\217\210\242"
+	.ascii	"\2345FD\316\025\373\307\323'1\275\242\234!\310\214x=7Q\254\374"
+	.ascii	"\347\266\002\325\324^\312x3\263\374\266@\253D\263z\225\261f\216"
+	.ascii	"\270\301\320\342r%$\007Y\241\206V\227U\rv?\236\233\376\320\334"
+	.ascii	"\314A\276\371{#\251\302\202n\357\245\fh\254\224\210\350e\025"
+	.ascii	"\b\f\220(\n\\\336\264\217\034#?\323\255\346\004\210\3646\310"
+	.ascii	">r\325\336\217\314\302C\263\217\334\303sR~\221c\243\264d\251"
+	.ascii	"\213Ou\230'\332a\216h\317O\367L\202\f#Se\247\f\216.\243'Y\345"
+	.ascii	"\221\2432\233\216^d\325a\202hw\3179\362\216\\\202|#\353\3108"
+	.ascii	"\036\232\247\262\n\236\245\376\212\253\361\336EO7#JW#C\211\021"
+	.ascii	"\305\321\345\245\025\270\204\310S9*#\245[M\375\325\205\205.3"
+	.ascii	"5\315=\363T\246\361c\277\266\264\225u\034d\255\275\355\345|\370"
+	.ascii	"\360iwF\310lT\207Y\241k\324;\355\252[~z\257/\034\352\230\316"
+	.ascii	"N\331\306C\263\323\367\217Fj\fl\231\325\0241\336\304\347j\021"
+	.ascii	"\355\252\017\355\352SJ[n\307\263.}\202\201\233\202\325\203\316"
+	.ascii	"\016\004\273#\251\271\214\244\303\344\326P\220K}\250^X\270\350"
+	.ascii	"\305e\2614J\322\035\024Kj\344"
+	.ascii	"I\260\202R\023n\316\212S\352\350-M\262C)\316\306\225t\314&\212"
+	.ascii	"V\205EV\343!5HH:\234n9\354.\212\025!Ym\213\325\260\031%\210\252"
+	.ascii	"\362c\231\255\205#\242\254v8K\327R*k)\233O\260\334\233ho'\033"
+	.ascii	"\003 k.\301\360\220\262\245S.@\301\212\267L\221\362\243\022\245"
+	.ascii	"\306\020 \272\004?\220fd\325-\230\241\335\323(i\027X8\311uI\325"
+	.ascii	"\236\304{B\340\262\332AEZ\332\213-y1`\320\035:\3404\207=44\273"
+	.ascii	"\034LV0Uf\313\2555\315a\313\331\031\236\223\225\214[\220)\036"
+	.ascii	"W\232\003\235\023'W\322\034ayXT\232\303\025&L\342\2364Uff\321"
+	.ascii	"$\315aJY\031\033\234\213\275\232\262\242\254(Y\365\n\2144\007"
+	.ascii	"2(4\035[\346`\212\321\246\205\213\330C\3231\030\254\262X\351"
+	.ascii	"\307\242\360\260\210i\321\034\204\0349\222&\311q\246qerhV\027"
+	.ascii	"\236\276`e!\3614\t\016,1\340jZ\274X\342\244Ds\250\002\003\313"
+	.ascii	"1\020\n\256\314J\354n\205\263\033\232\203QWWj\004\305~\333\263"
+	.ascii	"\201\367\224\026\361\324\210\230\225\226YVS\257\034\007s$\211"
+	.ascii	"\r/(\f*\224TYu\034\032\232\347\313\326V\216\023\360\302m\317"
+	.ascii	"\267T\302\002\263N\363D\211\020\231\263kC\313\320\"\313$^\232"
+	.ascii	"\247.+k\n\033\020\025\252"
+	.string	"\307\224\226U\247 J\363\274\245X)V\216\227D\362j\366\\V\025\236\346a\023\"\244J\353\316\nFYE\005NL\363\244\005\t\222\343\277\211\211\330\272<g\316X\250x\n\321<MX`\201-\257\211\206\212)7\026T\232\307\253G\217\324G\230\222\007\331\217\026\313*O}\250lD\332\254d5\003\224\346\261\242\242\3621\345\252\031\225\361\266\004N\363<\247\246r\f\200\246%\2202\233\273h\020(a\232G\005\035:tT\345`\212\326\034\021Ibv\245yj\2448R\034S\252\320|D\244\364\200d\325'Xj\036\031\351\215\364F\025\225\225\325'9\253bFE\363 II\3458\307l\013O+\246K\013\211\326\023\315C\024\025\225\355\244\270t\234E\323'-b)d\3251@\351\035;\0336\322\247\260\262\034LQ\rGO0\247\247O4fE\220\270\362\220\324-i\007\026\027\275\323V\243F\266\243"
+	.string	"\n\324\215fT\275:zV\221\351\235(MM\033pE\301p\362\322\342\251w\316f\314\310\361\024(:\037s\212\016+\253~\343B\357p\275\360\027\251R\2163\255R\367\305\316\352\365\204D]Iex\252\364\332\375@Kc\250eL2\2654F\nC]\001\307\326\022\226\030Z4\262J\202\334\303\335\367O\206\321\325W\235\336\301j6-\240\334s\022\363vd\031eD\357\374p\341b\003R\2720\371\261\021\275\305\310\252_\320\241w\246\216\216\342\310\266\340\375\236V\2109\251\350\235\025Z\264\260"
+	.string	"\031\236\226M\364\3123\307\227\336qJ\231)s\2112\213\214\013w6V\300\222U\267\201\241w\224R\243\324\350"
+	.string	"dsLR\246;\026O*z\247\231\026\245E[rK6r0\264\250\b\242wX\244\313t\271\365\026\315\3233\342\222U\377\255\320;\313t\247{\356\311\315I\215~\221\021\243L\353t\331\333\013\261\305Vf\265s\243+\316\252\3274i\235;/^\256H!\342\305\n\006O\205\036fsZ'.//\307\f\220\2425\304\352\275x<\257b\255\323\026\215\346X\211\022\013HT;\2211-\311\252\323Di\0354<\274l\247\200\244+\0316M\321\245\214:\255\003\275\273\313v@\322\254d\242\230\322\270\204i\035\256\272\272l\227\343L\341\222|XY\245SZ@\343b'\323\303G\324\021\223\346@\343\312\225<wC\n\017\246\307$\212!ll\337#\206\231\007\230(Q3\263\302\253\003\204-q\255"
+	.string	"\322\330\256\260\321%\301\276I\244\221\3350\202\t\n\234\b!\004\341\312\2763\307$\314\242 q\303\022\201:B\226\370\312\314"
+	.string	"\217\310\342\005Gd\361'\004l; \004\n\221\256\217\333\022\327\026i\242\355\200\360\306%\006\271\304\230\366]\207\200\304\025\310%\006\371\020`(("
+	.string	"\310\031\024,\274\n\217%\340\310\274+K$al\217\307\265\b,~\340\350\016\275,\n\241q\304\b\305\017\034)H\002%\201b`\026\311R"
+	.string	"\036\272(J81\002\262]\201\214l\321\030\324\022G\b\337\325\005\001Y\f\342\024\2031\357\t\3441h\306\205zZ\342\332\016"
+	.ascii	"\016\2620"
+	.string	"+t\341\344\ba{D\276,LlE\020\266\307d\261\315I\026\333\030d\321\202\240\bGdQ\306\205zZb\320'8l\211Av\270\"k^\237\024o\206\327\347B=-phM\372$A\200\203\254\321\350\006_\0266\226\030Z\223\025\034\203\220\307\240\016A\355\320j\344\321q\201L\b\256D\240\032\027\352\321pB\220\216\373\256@\024\300l\361\005j\211+\t\370]a\024\260\013\267G\034\027\352\t\032\335\035\243[,\272$R\300C?\027\352\241 \005<\264\"u\334V\230\034\001\277k\021\205\013\365\300\032\216\305\365%!\005<T\303\201\006C\307\341\020\230\002\036\362q\333\013*pB\004d\322m\337\244\b)\340!\fD\327\005\001\b\023\343B=>\310\327E\032Y\344\206\241\317\005H\366M\302++\002;\324\302\301\021BAx%fp\241\036\030n\215%\220& W\022\202C\032\027\352\331a\341\366\265"
+	.string	"\316ph\342e\331\367e\207\354{\002f\203"
+	.string	"\340B=>\310\227\035j_\241\206\023V\"+\204a\211@\2531\004\242\373\302\023\004\031\333\342\273\322"
+	.string	"\215\311\327'8\324A\006\255D\021\2203\260\217\220\330&\201"
+	.string	" \003g`\341\025FA\243z\316\221eA\020\032G \205\254\004\204\220+qx\343\301\366e\215l\220v\016D\030@\204\007)b\334\203\017@|"
+	.string	"\302\347\036|\020\"\304\007\"Bh\027\021\"e\201\254\320\035\201}\223\304v\035\376\340\227\205\203+\020v] \366\275A\332\300.\324\343\343\266'\2740[d\211,l\301\004& \327\021\202\306\344\260\206\005\226\200_\367D\005/\333\016[\330\310\n\333\231#\262\210<\006a(\301\302\353+L\256@@\342\372\262B\307\366e\2179H\370u\2174(\210k\373\262\310\f0P\203\r\200\302\022p\220\355"
+	.string	"\220\t\330\310\302\310\026\371\262G\n` \254]\250\347eS\264E\037X(\250%j\370\245X\2134B\343Z,\272Ac[\234a\341\225\0025D7\350\302\356{\242\370\201\023\301\021\310\021\330bK\002\221\r\262\016\270\201\201\"Bh6I\\+"
+	.string	"\263\310\341\320\004q\205\333\240VX\001K\024\226\250a\211k\020\305\0176&]\022,\321=\361\272\260[\264q\241\236\240\273G\366\365\201]\367\365\241A\002\203\332\241\321%Qda\344\tH\033\234\024\254\320\330\002Yb;t\337#\360\204\227\205\341\025\b\b\033\331\367M\0067\260B\267\b\fJ\002\261\302\031!\313\036\221\300\240\006\255\214\tA\227\030|Y\241\261\204\3441\370\203\201\036\300\3066\031\343 \206A v\005!\242'\203#"
+	.ascii	"\001$vJ\230\300\003t\260\007n\215-08\364\t\016}\214\355Z\364"
+	.ascii	"\t\276H\237\036\013\204\340 #\373\302H\240\321m\341\025id\217"
+	.ascii	"E7\b\204\211-\fd\2110\354\276Bp\207w\025"
+	.string	"\n\252lq5\252Y\262\224\275+$9\354\002\203m\250r\361,\312\363\310\020\231\241\031\031I\222\fc\362\n\020\204\342a\232\347\326\003\022@\2455\021\032\305HF\223$\303\034\262\270\224\343\367\311\256\372\351\347}\330\313\277\351\270\377\003\027j=C\352>43u\372\363a"
+	.string	"FL%@O\0247\030\177\016\357\247B=&\273\361o\275`G\232\317}\206x\342\376\227\310A\377\255\366\254\250\006\206\375\215\324\347y\225\255\344\027\341\256\275\007\371\"\301\270&p#\020:Y\002\204\224\216\356\212Wpe\355\3709\276\235\326\022\353\357q&\036\205\013\3372\0063\022Pk\305a\327}&\b\333\013.\266P^h\303\222\272\367w\225\260\\X\027\2727\241\240\016Y\234\240\313\263\2410R:I\323Bsl\220(\353\nk\256=\036\354\271\346I\265\225\204"
+	.ascii	"\002\255Zi9\333\361P\330"
+	.string	"\301\372\021q\b\362\317\203\226\356\242\031\214(\016\335rh|\3134\273\3425A\302\206A\372\203\236\326\026+E?\225\300\335\t\333\372\252\213\323Q\250\342\355xL>5\022\030>' \352\354\3022N\211\203\322\304a\336!>\254\317(d\016\034%|v\230\221\315\230|W\203^\204\024\254\212\252\036\224\032\357S\"\243O\265\353l\026\004\231\212k\303T\r\344KP\204\347L+\364+\214K#\270\247p\262\t\\\210\247\2020\322\327\336\004\243}vw\033\203d\022'=b\027\030\331\340\020VN\207\332L$f\243\3658\366\210\370\034\245+k\034)\215\247K\203!Z\364a\023)\343*`\241|\342\245\fcz\021\366qj\023\222\334\020.TWh\301b\207\251N5-`\004i\210\034|#TB\303\364\334\032\217\345&c\334\3157\177X\266\362\342\233\374\314\223\"\023\230\035\355\324\332W\375^\301\025\273\203\025"
+	.ascii	"\315\341R\366\030\225"
+	.string	"\333\345\330\252\374\304\312]\253\314\372A\325\274)(!6\310\263>^\357\257\002\223\275\2772L,-{B3\371\244B\230\265\220\301~\224\361\350\236\330N\371\273.\212\205\253\304\240:\023h?\241A\017\262\300\036\262\013@/\331\007\331\036A)\323\214\220k0\f\315\333\217\245\242\326\372\030\\+\034\313\320\342\213<D\206\f]\017\344:\223\030\325BS\225\030\004\204\337+\032\0072\t\260\016\324\313\302\254hq6\323\3401\300\266\330\277\017\307&$I\334\016n\213\031\354\307\204\301\324\272\274\362\277rl\313\251\246v\345\bY(\177\026\226\212\236\t\355\0160\204T\334\325y\026\017\254;\232q\271\2546\037\253m\371E\302=f\201t\020@\001\300\336|\321\366\260\261\333\254d\245\270\016\232)\235\345\320N\300c\353\275\020\016G\300h\222\212Os\265\266\221\221o\320P\224BM\260\315[r\347Md\027q7*\275"
+	.ascii	"\243U5\004\036\334\304^V\232\301\355q1\354\370\200\377\236\274"
+	.ascii	"\201{7`\363\032\275\231\2703\370u\031V\354\325o\3000*F\332\004"
+	.ascii	"N\214\311\261\366]\377\3741\025\312E\347\340\314\322\216N \013"
+	.ascii	"V\211\241\332\220\244Z\321V;]\\\314\242;\274\364\371a(\017?\006"
+	.ascii	"\371\030*\2570hzz\314\300\332\217\253v8=\003\303\275\341\334"
+	.ascii	"\203^\201\003\343={\352PY*dRC\330\341\354\n\277-7\032^W\177m"
+	.ascii	"\370\013\210\223\224\f\013\240p\220\257\256P\177\027\n\377\225"
+	.ascii	"J\243\331U\207P\250YJ\333\312J\034U\315C\332\305\213Tt-\216\261"
+	.ascii	"\t\027U\245\002R\002\022r\367^TKcL\275#V-\311\241\256\325\223"
+	.ascii	"Mm@\276\f`\365:\211|&C\334\037\004bV\376\252\306\nnD\245So)e"
+	.ascii	"e\373\003\300FR#\362\267n\341Zc\360\307\275\037n8g_\026v\344"
+	.ascii	"\331f\261D\222\231\337#U^\214\220\325\222\350*\302\366\003\231"
+	.ascii	"\022\2174\227\022\266\230\316s\224\017\031e\013\307\364!4\022"
+	.ascii	"\373\272D\002j\342\220\"c\205jqK\360QU\211\205\305\016\275\273"
+	.ascii	"\225J\213\314\201\2100\216\003\352\276:L$\021\361\340\240;#\230"
+	.ascii	"\251\246\220hk!\337\023\025\032\007M\256\323L\262\002\241\255"
+	.ascii	"!^.66mF\303\211\314\036\331\031Qv\245m\3059;\216x\350&\323S\303"
+	.ascii	"\031\t\255)\013O\300\220\206\250\032^]\326({\001rm\204\257\355"
+	.ascii	"EAQ\030\203|\221D\275\267\003mC\227\276\n\202\246P\234\365C7"
+	.ascii	"\273^\236+>\"p\332\"\357\032\315\0311i,\243\027\007\363\216U"
+	.ascii	"#\337\243Z\260E4\264Q\225%\206\222\320\345P\235\335j\035z\374"
+	.ascii	"\177\033~8gN`\005\253\t\352\030ZD\271\303I\361\275L\025\214\361"
+	.ascii	"Z{\230 u\373\235\246\237\"\201\330\"c\312\023M\002sJBf+\377\346"
+	.ascii	"\210\243\r\247\326e\343c\311M\253$\202\030\365e]G%l\316\356\363"
+	.ascii	"\332\311\333\265\324\377&\006\025\333\344}\207\246\262\213\026"
+	.ascii	"af*U\220I\b\371b\020\246\230\002pf\346wn\352P\177\262\ba\021"
+	.ascii	":\231\247\335\274\f\230\232H\265\0270\264\211\352\356j\bJ\214"
+	.ascii	"d}\253H\b\023E'N67\r<XU\222\006\303\215\006\002\002\\+|L\226"
+	.ascii	"\250\n\342d\300)\233\242\320|_\214\311\262\f_d\025\023'i\304"
+	.ascii	"3t\325\310\r\274\212\027l9\nb\301b^\355\003\037\034\027\270\267"
+	.ascii	"\256\371\220\267\265\rn\362ai\253r;\367\034M\360h\224\327\327"
+	.ascii	"\302\253\035\241f\356\314\004p\006\272\203\261\013\240\232T/"
+	.ascii	"\242\317\347a6\332\033\001\021\256\303\031UpizTp\310\357\036"
+	.ascii	"\376\034\345\232\3131D[\004Sn,\241\354P\317\270X\301:B\337pq"
+	.ascii	"\002s\201 \003\016\203(\367H\255;\277w\327Z\317\030\316\225\306"
+	.ascii	"\273\252\327\323\351\345\223\377r\340Q\2377\376\273\317\177\312"
+	.ascii	"\263\231\316\213\201\247\213\355\277\031je\364\210\242\211\313"
+	.ascii	"\201\177\361\274o\271\340\216\303\325a\2718\033\337C-\277\272"
+	.ascii	"\357|\315\346\003\374\217\362\322\2146\226\341v\310AWV\276_\275"
+	.ascii	"\300_K\232F\003\262@+"
+	.text
+	.section	.gnu.lto_.symtab.23582b31fec1c283,"e",@progbits
+	.string	"flashLedsAndBeep"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\001"
+	.string	""
+	.string	"init"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\001"
+	.string	""
+	.string	"systemState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\001"
+	.string	""
+	.string	"systemConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\001"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\001"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"motorControlEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"getPreferredBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\001"
+	.string	""
+	.string	"persistentObjectWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"latchActiveFeatures"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"batteryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"vtxFuriousFPVInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"vtxTrampInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"vtxSmartAudioInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"vtxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"vtxCommonInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"vtxControlInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"pitotStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"baroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\001"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"blackboxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\001"
+	.string	""
+	.string	"telemetryInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"navigationInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"uavInterconnectBusInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"rxInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"cliInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"mspFcInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"failureMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"sensorsAutodetect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"gpsPreInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"cmsInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"initBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"isMPUSoftReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"busInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"pwmMotorAndServoInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"mixerUpdateStateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\001"
+	.string	""
+	.string	"gvInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"logInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"djiOsdSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"mspSerialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"serialInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"timerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\001"
+	.string	""
+	.string	"ledInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"systemClockSetup"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"readEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"ensureEEPROMContainsValidData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"initEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"IOInitGlobal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"systemInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"printfSupportInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.23582b31fec1c283,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,16019 @@
+	.file	"fc_msp_box.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/streambuf.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/common/bitarray.h"
+	.file 9 "./src/main/fc/rc_modes.h"
+	.file 10 "./src/main/fc/fc_msp_box.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/flight/mixer.h"
+	.file 13 "./src/main/io/osd.h"
+	.file 14 "./src/main/sensors/diagnostics.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/navigation/navigation.h"
+	.file 17 "./src/main/drivers/resource.h"
+	.file 18 "./src/main/telemetry/telemetry.h"
+	.file 19 "./src/main/fc/fc_msp_box.c"
+	.file 20 "./src/main/config/feature.h"
+	.file 21 "/usr/include/string.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_msp_box.c.691c410f
+	.weak	fc_msp_box.c.691c410f
+fc_msp_box.c.691c410f:
+	.long	0x123f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF2405
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1918
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1919
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1920
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1921
+	.uleb128 0x5
+	.long	.LASF1923
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1922
+	.uleb128 0x5
+	.long	.LASF1924
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1925
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1926
+	.uleb128 0x5
+	.long	.LASF1927
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xc
+	.long	0x7c
+	.uleb128 0x5
+	.long	.LASF1928
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1929
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1930
+	.uleb128 0xc
+	.long	0x9d
+	.uleb128 0x5
+	.long	.LASF1931
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1932
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x5
+	.long	.LASF1933
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xc
+	.long	0xc1
+	.uleb128 0x5
+	.long	.LASF1934
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1935
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x5
+	.long	.LASF1936
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x9
+	.long	0xa4
+	.uleb128 0xe
+	.long	.LASF2019
+	.byte	0x10
+	.byte	0x5
+	.byte	0x1a
+	.long	0x11e
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x1b
+	.long	0x11e
+	.byte	0
+	.uleb128 0x16
+	.string	"end"
+	.byte	0x1c
+	.long	0x11e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0xc1
+	.uleb128 0x5
+	.long	.LASF1937
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x3
+	.long	0xfb
+	.uleb128 0xc
+	.long	0x123
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x15e
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xc1
+	.long	0x16e
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x26
+	.long	0x269
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1951
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1952
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1953
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1954
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1955
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1956
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1957
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1958
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF1959
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF1960
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF1961
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF1962
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF1963
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF1964
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF1965
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF1966
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF1967
+	.long	0x1000000
+	.uleb128 0x3
+	.long	.LASF1968
+	.long	0x2000000
+	.uleb128 0x3
+	.long	.LASF1969
+	.long	0x4000000
+	.uleb128 0x3
+	.long	.LASF1970
+	.long	0x8000000
+	.uleb128 0x3
+	.long	.LASF1971
+	.long	0x10000000
+	.uleb128 0x3
+	.long	.LASF1972
+	.long	0x20000000
+	.uleb128 0x3
+	.long	.LASF1973
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1974
+	.byte	0x8
+	.byte	0x1d
+	.byte	0x12
+	.long	0xde
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x9
+	.byte	0x1c
+	.long	0x383
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2018
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x275
+	.uleb128 0xe
+	.long	.LASF2020
+	.byte	0x8
+	.byte	0x9
+	.byte	0x4b
+	.long	0x3a9
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x31
+	.long	0x3a9
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0x269
+	.long	0x3b9
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2022
+	.byte	0x9
+	.byte	0x4b
+	.byte	0x5a
+	.long	0x38f
+	.uleb128 0xe
+	.long	.LASF2023
+	.byte	0x18
+	.byte	0xa
+	.byte	0x18
+	.long	0x3f9
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0xa
+	.byte	0x19
+	.byte	0x13
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0xa
+	.byte	0x1a
+	.byte	0x11
+	.long	0xf6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0xa
+	.byte	0x1b
+	.byte	0x13
+	.long	0xcd
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2027
+	.byte	0xa
+	.byte	0x1c
+	.byte	0x3
+	.long	0x3c5
+	.uleb128 0xc
+	.long	0x3f9
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.long	0x4d5
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2031
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF2032
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF2033
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF2034
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF2035
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF2036
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF2037
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF2038
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF2039
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF2040
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF2041
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF2042
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF2043
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF2044
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF2045
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF2046
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF2047
+	.long	0x1000000
+	.uleb128 0x3
+	.long	.LASF2048
+	.long	0x2000000
+	.uleb128 0x3
+	.long	.LASF2049
+	.long	0x4000000
+	.uleb128 0x3
+	.long	.LASF2050
+	.long	0x8000000
+	.uleb128 0x3
+	.long	.LASF2051
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2067
+	.byte	0xb
+	.byte	0x47
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x54
+	.long	0x54e
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2060
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF2061
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF2062
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF2063
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF2064
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF2065
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF2066
+	.value	0x4000
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2068
+	.byte	0xb
+	.byte	0x66
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x6c
+	.long	0x61f
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2077
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF2078
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF2079
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF2080
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF2081
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF2082
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF2083
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF2084
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF2085
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF2086
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF2087
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF2088
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF2089
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF2090
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF2091
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF2092
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF2093
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2094
+	.byte	0xb
+	.byte	0x8c
+	.byte	0x11
+	.long	0xde
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xc
+	.byte	0x28
+	.long	0x661
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2102
+	.uleb128 0xe
+	.long	.LASF2103
+	.byte	0x8
+	.byte	0xc
+	.byte	0x41
+	.long	0x6b6
+	.uleb128 0x2
+	.long	.LASF2104
+	.byte	0xc
+	.byte	0x42
+	.byte	0xc
+	.long	0xa9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2105
+	.byte	0xc
+	.byte	0x43
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2106
+	.byte	0xc
+	.byte	0x44
+	.byte	0x9
+	.long	0x6b6
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0xc
+	.byte	0x45
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2108
+	.byte	0xc
+	.byte	0x46
+	.byte	0xe
+	.long	0xd2
+	.byte	0x6
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2109
+	.uleb128 0xc
+	.long	0x6b6
+	.uleb128 0x5
+	.long	.LASF2110
+	.byte	0xc
+	.byte	0x47
+	.byte	0x3
+	.long	0x668
+	.uleb128 0xc
+	.long	0x6c2
+	.uleb128 0x11
+	.long	.LASF2111
+	.byte	0xc
+	.byte	0x49
+	.byte	0x16
+	.long	0x6c2
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x2e
+	.long	0x979
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2159
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xe
+	.byte	0x8
+	.long	0x99d
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2224
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2225
+	.byte	0xe
+	.byte	0xd
+	.byte	0x3
+	.long	0x979
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0x9e5
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x30
+	.long	0xa2f
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2239
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2240
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2241
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF2242
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF2243
+	.value	0x200
+	.byte	0
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2244
+	.uleb128 0xe
+	.long	.LASF2245
+	.byte	0x44
+	.byte	0x10
+	.byte	0x6b
+	.long	0xb61
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0x10
+	.byte	0x6c
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x10
+	.byte	0x6e
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0x10
+	.byte	0x6f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0x10
+	.byte	0x70
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0x10
+	.byte	0x71
+	.byte	0xd
+	.long	0xc1
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0x10
+	.byte	0x73
+	.byte	0xe
+	.long	0xd2
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x10
+	.byte	0x75
+	.byte	0xb
+	.long	0x661
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0x10
+	.byte	0x77
+	.byte	0xb
+	.long	0x661
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0x10
+	.byte	0x78
+	.byte	0xb
+	.long	0x661
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0x10
+	.byte	0x7a
+	.byte	0xb
+	.long	0x661
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2257
+	.byte	0x10
+	.byte	0x7b
+	.byte	0xb
+	.long	0x661
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2258
+	.byte	0x10
+	.byte	0x7d
+	.byte	0xb
+	.long	0x661
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xb
+	.long	0x661
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0x10
+	.byte	0x80
+	.byte	0xb
+	.long	0x661
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x10
+	.byte	0x81
+	.byte	0xb
+	.long	0x661
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0x10
+	.byte	0x83
+	.byte	0xb
+	.long	0x661
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0x10
+	.byte	0x84
+	.byte	0xb
+	.long	0x661
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0x10
+	.byte	0x86
+	.byte	0xb
+	.long	0x661
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2265
+	.byte	0x10
+	.byte	0x87
+	.byte	0xb
+	.long	0x661
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2266
+	.byte	0x10
+	.byte	0x89
+	.byte	0xb
+	.long	0x661
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xb
+	.long	0x661
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2268
+	.byte	0x10
+	.byte	0x8b
+	.byte	0x3
+	.long	0xa36
+	.uleb128 0xc
+	.long	0xb61
+	.uleb128 0x11
+	.long	.LASF2269
+	.byte	0x10
+	.byte	0x8d
+	.byte	0x23
+	.long	0xb61
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x11
+	.byte	0x16
+	.long	0xc6e
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2276
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2277
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2283
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2284
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2287
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2288
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2289
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2290
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2291
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2292
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2293
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2294
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2295
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2296
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2297
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2298
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2299
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2300
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2301
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x11
+	.byte	0x43
+	.long	0xcf8
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2314
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2315
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2316
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2317
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2318
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2319
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2320
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2321
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2322
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2323
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2324
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	0xcfd
+	.uleb128 0x1f
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x22
+	.long	0xd16
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2331
+	.byte	0x12
+	.byte	0x25
+	.byte	0x3
+	.long	0xcfe
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x27
+	.long	0xd3a
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2334
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x3
+	.long	0xd22
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x32
+	.long	0xd64
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2338
+	.byte	0x12
+	.byte	0x36
+	.byte	0x3
+	.long	0xd46
+	.uleb128 0x20
+	.byte	0x5
+	.byte	0x12
+	.byte	0x4f
+	.byte	0x5
+	.long	0xdbb
+	.uleb128 0x2
+	.long	.LASF2339
+	.byte	0x12
+	.byte	0x50
+	.byte	0x11
+	.long	0xc1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2340
+	.byte	0x12
+	.byte	0x51
+	.byte	0x11
+	.long	0xc1
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2341
+	.byte	0x12
+	.byte	0x52
+	.byte	0x11
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2342
+	.byte	0x12
+	.byte	0x53
+	.byte	0x11
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2343
+	.byte	0x12
+	.byte	0x54
+	.byte	0x11
+	.long	0xc1
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2344
+	.byte	0x50
+	.byte	0x12
+	.byte	0x38
+	.long	0xef3
+	.uleb128 0x2
+	.long	.LASF2345
+	.byte	0x12
+	.byte	0x39
+	.byte	0xb
+	.long	0x661
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2346
+	.byte	0x12
+	.byte	0x3a
+	.byte	0xb
+	.long	0x661
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2347
+	.byte	0x12
+	.byte	0x3b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2348
+	.byte	0x12
+	.byte	0x3c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2349
+	.byte	0x12
+	.byte	0x3d
+	.byte	0x1b
+	.long	0xd16
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2350
+	.byte	0x12
+	.byte	0x3e
+	.byte	0x11
+	.long	0xd3a
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2351
+	.byte	0x12
+	.byte	0x3f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2352
+	.byte	0x12
+	.byte	0x40
+	.byte	0xd
+	.long	0xc1
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2353
+	.byte	0x12
+	.byte	0x41
+	.byte	0xd
+	.long	0xc1
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2354
+	.byte	0x12
+	.byte	0x42
+	.byte	0xd
+	.long	0xc1
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2355
+	.byte	0x12
+	.byte	0x43
+	.byte	0xd
+	.long	0xc1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2356
+	.byte	0x12
+	.byte	0x44
+	.byte	0x19
+	.long	0xd64
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2357
+	.byte	0x12
+	.byte	0x45
+	.byte	0xd
+	.long	0xc1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2358
+	.byte	0x12
+	.byte	0x46
+	.byte	0xd
+	.long	0xc1
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2359
+	.byte	0x12
+	.byte	0x47
+	.byte	0xe
+	.long	0xd2
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2360
+	.byte	0x12
+	.byte	0x48
+	.byte	0xd
+	.long	0x15e
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0x12
+	.byte	0x49
+	.byte	0xe
+	.long	0xd2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0x12
+	.byte	0x4a
+	.byte	0xe
+	.long	0xd2
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0x12
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd2
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2364
+	.byte	0x12
+	.byte	0x4c
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2365
+	.byte	0x12
+	.byte	0x4d
+	.byte	0xd
+	.long	0xef3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2366
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xd
+	.long	0xf03
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2367
+	.byte	0x12
+	.byte	0x55
+	.byte	0x7
+	.long	0xd70
+	.byte	0x48
+	.byte	0
+	.uleb128 0xf
+	.long	0xc1
+	.long	0xf03
+	.uleb128 0x10
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	0xc1
+	.long	0xf13
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2368
+	.byte	0x12
+	.byte	0x56
+	.byte	0x3
+	.long	0xdbb
+	.uleb128 0xc
+	.long	0xf13
+	.uleb128 0x11
+	.long	.LASF2369
+	.byte	0x12
+	.byte	0x58
+	.byte	0x1a
+	.long	0xf13
+	.uleb128 0xf
+	.long	0x405
+	.long	0xf40
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x2a
+	.byte	0
+	.uleb128 0xc
+	.long	0xf30
+	.uleb128 0xa
+	.long	.LASF2370
+	.byte	0x2e
+	.byte	0x14
+	.long	0xf40
+	.uleb128 0xf
+	.long	0xc1
+	.long	0xf60
+	.uleb128 0x10
+	.long	0x37
+	.byte	0x29
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2371
+	.byte	0x5d
+	.byte	0x10
+	.long	0xf50
+	.uleb128 0x21
+	.long	.LASF2406
+	.byte	0x13
+	.byte	0x5f
+	.byte	0x9
+	.long	0xc1
+	.uleb128 0x17
+	.long	.LASF2372
+	.byte	0x1c
+	.byte	0x5
+	.long	0x6b6
+	.uleb128 0x13
+	.long	.LASF2379
+	.byte	0x8
+	.byte	0x22
+	.long	0xf98
+	.uleb128 0x7
+	.long	0xf98
+	.uleb128 0x7
+	.long	0x30
+	.byte	0
+	.uleb128 0x9
+	.long	0x269
+	.uleb128 0x22
+	.long	.LASF2373
+	.byte	0x10
+	.value	0x1a0
+	.byte	0x5
+	.long	0x6b6
+	.uleb128 0x12
+	.long	.LASF2375
+	.byte	0x9
+	.byte	0x77
+	.byte	0x5
+	.long	0x6b6
+	.long	0xfc0
+	.uleb128 0x7
+	.long	0x383
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2374
+	.byte	0x15
+	.byte	0x18
+	.long	0x99d
+	.uleb128 0x12
+	.long	.LASF2376
+	.byte	0x14
+	.byte	0x1e
+	.byte	0x5
+	.long	0x6b6
+	.long	0xfe1
+	.uleb128 0x7
+	.long	0xde
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2377
+	.byte	0xb
+	.byte	0xa3
+	.byte	0x5
+	.long	0x6b6
+	.long	0xff7
+	.uleb128 0x7
+	.long	0xde
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2378
+	.byte	0x15
+	.byte	0x3d
+	.byte	0xe
+	.long	0x9b
+	.long	0x1017
+	.uleb128 0x7
+	.long	0x9b
+	.uleb128 0x7
+	.long	0x7c
+	.uleb128 0x7
+	.long	0xea
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2380
+	.byte	0x5
+	.byte	0x21
+	.long	0x102d
+	.uleb128 0x7
+	.long	0x102d
+	.uleb128 0x7
+	.long	0xc1
+	.byte	0
+	.uleb128 0x9
+	.long	0x123
+	.uleb128 0x13
+	.long	.LASF2381
+	.byte	0x5
+	.byte	0x25
+	.long	0x104d
+	.uleb128 0x7
+	.long	0x102d
+	.uleb128 0x7
+	.long	0xcf8
+	.uleb128 0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2382
+	.byte	0x5
+	.byte	0x39
+	.byte	0x5
+	.long	0x7c
+	.long	0x1063
+	.uleb128 0x7
+	.long	0x1063
+	.byte	0
+	.uleb128 0x9
+	.long	0x12f
+	.uleb128 0x23
+	.long	.LASF2383
+	.byte	0x15
+	.value	0x197
+	.byte	0xf
+	.long	0xea
+	.long	0x107f
+	.uleb128 0x7
+	.long	0xf6
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2384
+	.byte	0x13
+	.value	0x177
+	.byte	0xa
+	.long	0xd2
+	.long	0x109d
+	.uleb128 0x18
+	.long	.LASF2385
+	.value	0x17a
+	.byte	0xe
+	.long	0xd2
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2387
+	.byte	0x13
+	.value	0x138
+	.byte	0x6
+	.long	0x10d1
+	.uleb128 0x26
+	.long	.LASF2393
+	.byte	0x13
+	.value	0x138
+	.byte	0x26
+	.long	0x10d1
+	.uleb128 0x18
+	.long	.LASF2386
+	.value	0x13a
+	.byte	0xd
+	.long	0xf50
+	.uleb128 0xb
+	.uleb128 0x27
+	.string	"i"
+	.byte	0x13
+	.value	0x170
+	.byte	0x13
+	.long	0xde
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x3b9
+	.uleb128 0x19
+	.long	.LASF2388
+	.byte	0x9f
+	.long	0x1102
+	.uleb128 0xa
+	.long	.LASF2389
+	.byte	0xc5
+	.byte	0xf
+	.long	0x6bd
+	.uleb128 0xa
+	.long	.LASF2390
+	.byte	0xc6
+	.byte	0xf
+	.long	0x6bd
+	.uleb128 0xa
+	.long	.LASF2391
+	.byte	0xc7
+	.byte	0xf
+	.long	0x6bd
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2392
+	.byte	0x94
+	.long	0x1130
+	.uleb128 0x1a
+	.string	"dst"
+	.byte	0x94
+	.byte	0x20
+	.long	0x102d
+	.uleb128 0xb
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x96
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xb
+	.uleb128 0xd
+	.string	"box"
+	.byte	0x97
+	.byte	0x16
+	.long	0x1130
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x405
+	.uleb128 0x14
+	.long	.LASF2394
+	.byte	0x77
+	.byte	0x5
+	.long	0x6b6
+	.long	0x11a7
+	.uleb128 0x1a
+	.string	"dst"
+	.byte	0x77
+	.byte	0x24
+	.long	0x102d
+	.uleb128 0xa
+	.long	.LASF2395
+	.byte	0x7a
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x28
+	.long	0x1176
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x7b
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xb
+	.uleb128 0xd
+	.string	"box"
+	.byte	0x7c
+	.byte	0x16
+	.long	0x1130
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.string	"i"
+	.byte	0x87
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF2396
+	.byte	0x88
+	.byte	0x13
+	.long	0x83
+	.uleb128 0xd
+	.string	"box"
+	.byte	0x89
+	.byte	0x16
+	.long	0x1130
+	.uleb128 0xb
+	.uleb128 0xd
+	.string	"len"
+	.byte	0x8b
+	.byte	0x17
+	.long	0x83
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2397
+	.byte	0x6c
+	.byte	0xe
+	.long	0x1130
+	.long	0x11db
+	.uleb128 0x1b
+	.long	.LASF2398
+	.byte	0x6c
+	.long	0xc1
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF2399
+	.byte	0x6e
+	.byte	0x12
+	.long	0xc1
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF2400
+	.byte	0x6f
+	.byte	0x16
+	.long	0x1130
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2401
+	.byte	0x61
+	.byte	0xe
+	.long	0x1130
+	.long	0x120f
+	.uleb128 0x1b
+	.long	.LASF2396
+	.byte	0x61
+	.long	0xc1
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF2399
+	.byte	0x63
+	.byte	0x12
+	.long	0xc1
+	.uleb128 0xb
+	.uleb128 0xa
+	.long	.LASF2400
+	.byte	0x64
+	.byte	0x16
+	.long	0x1130
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2402
+	.byte	0x12
+	.byte	0x58
+	.byte	0x88
+	.long	0x121b
+	.uleb128 0x9
+	.long	0xf1f
+	.uleb128 0x15
+	.long	.LASF2403
+	.byte	0x10
+	.byte	0x8d
+	.byte	0xb5
+	.long	0x122c
+	.uleb128 0x9
+	.long	0xb6d
+	.uleb128 0x15
+	.long	.LASF2404
+	.byte	0xc
+	.byte	0x49
+	.byte	0x74
+	.long	0x123d
+	.uleb128 0x9
+	.long	0x6ce
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 43
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 22 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.file 25 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 27 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 28 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x21
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 41 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.file 42 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 43 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 44 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0x4
+	.file 46 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.file 47 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2f
+	.file 48 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.file 49 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 50 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF995
+	.byte	0x4
+	.file 51 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF996
+	.byte	0x4
+	.file 52 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1014
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xd
+	.file 53 "./src/main/drivers/osd.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1061
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x10
+	.file 54 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 55 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 57 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x39
+	.file 58 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x3b
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1384
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1411
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x42
+	.byte	0x4
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x43
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.file 68 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 69 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x12
+	.file 70 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x47
+	.file 72 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x48
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1524
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.file 73 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.file 74 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1913
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1917
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF994
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF999
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.cef84115c5f2700d3af586ea6b7bb2c4,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1065
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1104
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1376
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1410
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1413
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1415
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1430
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1430
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1440
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1443
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1443
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1443
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1443
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1443
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1431
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1432
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1433
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1434
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1452
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1453
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1454
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1455
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1462
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1463
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1464
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1465
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1466
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1467
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1512
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1520
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1523
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1912
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2407
+	.long	.LASF2408
+	.long	.LASF2409
+	.long	.LASF2410
+	.long	.LASF2411
+	.long	.LASF2412
+	.long	.LASF2413
+	.long	.LASF2414
+	.long	.LASF2415
+	.long	.LASF2416
+	.long	.LASF2417
+	.long	.LASF2418
+	.long	.LASF2419
+	.long	.LASF2420
+	.long	.LASF2421
+	.long	.LASF2422
+	.long	.LASF2423
+	.long	.LASF2424
+	.long	.LASF2425
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2426
+	.byte	0xf
+	.long	.LASF2427
+	.byte	0xf
+	.long	.LASF2428
+	.byte	0xf
+	.long	.LASF2429
+	.byte	0x13
+	.long	.LASF2430
+	.byte	0x2
+	.long	.LASF2431
+	.byte	0x4
+	.long	.LASF2432
+	.byte	0x5
+	.long	.LASF2433
+	.byte	0x2
+	.long	.LASF2434
+	.byte	0x5
+	.long	.LASF2435
+	.byte	0x5
+	.long	.LASF2436
+	.byte	0x5
+	.long	.LASF2437
+	.byte	0x6
+	.long	.LASF2438
+	.byte	0x7
+	.long	.LASF2439
+	.byte	0x9
+	.long	.LASF2440
+	.byte	0x9
+	.long	.LASF2441
+	.byte	0x8
+	.long	.LASF2442
+	.byte	0x4
+	.long	.LASF2443
+	.byte	0xc
+	.long	.LASF2444
+	.byte	0x5
+	.long	.LASF2445
+	.byte	0x3
+	.long	.LASF2446
+	.byte	0x12
+	.long	.LASF2447
+	.byte	0x12
+	.long	.LASF2448
+	.byte	0x13
+	.long	.LASF2449
+	.byte	0x13
+	.long	.LASF2449
+	.byte	0x12
+	.long	.LASF2450
+	.byte	0xf
+	.long	.LASF2451
+	.byte	0x12
+	.long	.LASF2452
+	.byte	0x12
+	.long	.LASF2453
+	.byte	0xf
+	.long	.LASF2454
+	.byte	0xf
+	.long	.LASF2455
+	.byte	0x11
+	.long	.LASF2456
+	.byte	0xf
+	.long	.LASF2457
+	.byte	0x10
+	.long	.LASF2458
+	.byte	0x10
+	.long	.LASF2459
+	.byte	0xf
+	.long	.LASF2460
+	.byte	0xf
+	.long	.LASF2461
+	.byte	0xf
+	.long	.LASF2462
+	.byte	0xe
+	.long	.LASF2463
+	.byte	0xe
+	.long	.LASF2464
+	.byte	0x12
+	.long	.LASF2465
+	.byte	0xd
+	.long	.LASF2466
+	.byte	0xb
+	.long	.LASF2467
+	.byte	0xa
+	.long	.LASF2468
+	.byte	0xb
+	.long	.LASF2469
+	.byte	0xb
+	.long	.LASF2470
+	.byte	0x2
+	.long	.LASF2471
+	.byte	0x3
+	.long	.LASF2472
+	.byte	0x1
+	.long	.LASF2473
+	.byte	0x2
+	.long	.LASF2474
+	.byte	0x4
+	.long	.LASF2475
+	.byte	0x4
+	.long	.LASF2476
+	.byte	0x5
+	.long	.LASF2438
+	.byte	0x4
+	.long	.LASF2477
+	.byte	0x2
+	.long	.LASF2478
+	.byte	0x2
+	.long	.LASF2479
+	.byte	0x2
+	.long	.LASF2480
+	.byte	0x2
+	.long	.LASF2481
+	.byte	0x12
+	.long	.LASF2482
+	.byte	0xf
+	.long	.LASF2483
+	.byte	0xf
+	.long	.LASF2484
+	.byte	0xf
+	.long	.LASF2485
+	.byte	0xf
+	.long	.LASF2486
+	.byte	0xf
+	.long	.LASF2487
+	.byte	0xf
+	.long	.LASF2488
+	.byte	0xf
+	.long	.LASF2489
+	.byte	0xf
+	.long	.LASF2490
+	.byte	0xf
+	.long	.LASF2491
+	.byte	0x6
+	.long	.LASF2492
+	.byte	0x7
+	.long	.LASF2493
+	.byte	0x7
+	.long	.LASF2493
+	.byte	0x4
+	.long	.LASF2494
+	.byte	0x4
+	.long	.LASF2495
+	.byte	0x4
+	.long	.LASF2496
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1255:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1904:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1138:
+	.string	"__DECL_SIMD_logf "
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1596:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1343:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF966:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF938:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2150:
+	.string	"OSD_BATTERY_REMAINING_PERCENT"
+.LASF1149:
+	.string	"__DECL_SIMD_expl "
+.LASF1634:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF858:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1354:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1256:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1605:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1964:
+	.string	"FEATURE_TRANSPONDER"
+.LASF2152:
+	.string	"OSD_TRIP_DIST"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF1111:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2130:
+	.string	"OSD_YAW_PIDS"
+.LASF2162:
+	.string	"OSD_HOME_HEADING_ERROR"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1034:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1985:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF2336:
+	.string	"SMARTPORT_FUEL_UNIT_MAH"
+.LASF2187:
+	.string	"OSD_NAV_FW_CRUISE_THR"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1938:
+	.string	"ADC_BATTERY"
+.LASF998:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1033:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1754:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1476:
+	.string	"FP_NORMAL 4"
+.LASF1311:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1291:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1148:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2297:
+	.string	"OWNER_RX_SPI"
+.LASF1724:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF960:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1251:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1546:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1367:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1352:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF2020:
+	.string	"boxBitmask_s"
+.LASF2004:
+	.string	"BOXCAMERA1"
+.LASF2074:
+	.string	"ANTI_WINDUP"
+.LASF1924:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1997:
+	.string	"BOXGCSNAV"
+.LASF1070:
+	.string	"FAST_MATH "
+.LASF2034:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2109:
+	.string	"_Bool"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1106:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1423:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1753:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF1912:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1525:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1416:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1315:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1157:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1243:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1295:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1895:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF993:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2010:
+	.string	"BOXNAVCRUISE"
+.LASF2040:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF2106:
+	.string	"hasFlaps"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF1547:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1212:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF914:
+	.string	"NOINLINE "
+.LASF1731:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1777:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1400:
+	.string	"__f32x(x) x ##f32x"
+.LASF1796:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2012:
+	.string	"BOXUSER1"
+.LASF2013:
+	.string	"BOXUSER2"
+.LASF2339:
+	.string	"extended_status_rate"
+.LASF1020:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1244:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1152:
+	.string	"__DECL_SIMD_expf64 "
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF1629:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1691:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1084:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1900:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1012:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF1419:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF2201:
+	.string	"OSD_TEMP_SENSOR_1_TEMPERATURE"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1123:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF787:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1739:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF987:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1872:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1249:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1394:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1480:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF984:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF2294:
+	.string	"OWNER_LED"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1571:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1876:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF1004:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1953:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1481:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1934:
+	.string	"uint16_t"
+.LASF2155:
+	.string	"OSD_MAP_NORTH"
+.LASF1398:
+	.string	"__f32(x) x ##f32"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF2156:
+	.string	"OSD_MAP_TAKEOFF"
+.LASF2276:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF2355:
+	.string	"halfDuplex"
+.LASF2210:
+	.string	"OSD_MAP_SCALE"
+.LASF1417:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1375:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1670:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1485:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2049:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF1818:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1355:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF972:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1038:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF1479:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1831:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1119:
+	.string	"__DECL_SIMD_sinl "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1782:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1121:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1686:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2296:
+	.string	"OWNER_TX"
+.LASF2248:
+	.string	"reset_home_type"
+.LASF1665:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1099:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1358:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2367:
+	.string	"mavlink"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2154:
+	.string	"OSD_ATTITUDE_ROLL"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF941:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2071:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2360:
+	.string	"simTransmitFlags"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1140:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1559:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1581:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1750:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1704:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1378:
+	.string	"__HAVE_FLOAT128 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1263:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1401:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2398:
+	.string	"permenantId"
+.LASF2105:
+	.string	"platformType"
+.LASF2199:
+	.string	"OSD_BARO_TEMPERATURE"
+.LASF1798:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1871:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2308:
+	.string	"RESOURCE_NONE"
+.LASF1602:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1764:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1827:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1139:
+	.string	"__DECL_SIMD_logl "
+.LASF1413:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1899:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2393:
+	.string	"mspBoxModeFlags"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1376:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1567:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1532:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2031:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2165:
+	.string	"OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF937:
+	.string	"BIT(x) (1 << (x))"
+.LASF2288:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF996:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1575:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1357:
+	.string	"__DECL_SIMD_erfc "
+.LASF1592:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1496:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1431:
+	.string	"_Mdouble_"
+.LASF1728:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1379:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2317:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2088:
+	.string	"ROVER"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF1477:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1770:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2097:
+	.string	"PLATFORM_HELICOPTER"
+.LASF1331:
+	.string	"__DECL_SIMD_erff32 "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1885:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF2299:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1002:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1821:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1538:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2309:
+	.string	"RESOURCE_INPUT"
+.LASF1642:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2364:
+	.string	"simLowAltitude"
+.LASF1387:
+	.string	"__HAVE_FLOAT64 1"
+.LASF2172:
+	.string	"OSD_VEL_Z_PIDS"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1274:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF2318:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1332:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2111:
+	.string	"mixerConfig_System"
+.LASF1963:
+	.string	"FEATURE_UNUSED_10"
+.LASF1970:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2388:
+	.string	"initActiveBoxIds"
+.LASF1245:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2086:
+	.string	"AIRPLANE"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1917:
+	.string	"CHECK_ACTIVE_BOX(condition,index) do { if (IS_ENABLED(condition)) { activeBoxes[index] = 1; } } while(0)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1658:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1641:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1432:
+	.string	"__MATH_PRECNAME"
+.LASF1282:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1048:
+	.string	"OSD_VISIBLE_FLAG 0x0800"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1462:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF1870:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2063:
+	.string	"NAV_WP_MODE"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1464:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1214:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1465:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF1435:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1717:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1042:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1036:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1638:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1098:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1319:
+	.string	"__DECL_SIMD_acoshl "
+.LASF931:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2225:
+	.string	"hardwareSensorStatus_e"
+.LASF1356:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1615:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1175:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1105:
+	.string	"_MATH_H 1"
+.LASF1801:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1453:
+	.string	"__MATHDECL_1"
+.LASF1687:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2372:
+	.string	"isHardwareHealthy"
+.LASF1612:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1774:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2287:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1911:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF396:
+	.string	"false 0"
+.LASF2307:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF974:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1814:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1864:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1389:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1086:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1566:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1528:
+	.string	"IOCFG_AF_PP 0"
+.LASF1977:
+	.string	"BOXHORIZON"
+.LASF1271:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2052:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1659:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF976:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1300:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1018:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1207:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2047:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1035:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF1745:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF1783:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2142:
+	.string	"OSD_MESSAGES"
+.LASF1729:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1530:
+	.string	"IOCFG_IPD 0"
+.LASF2135:
+	.string	"OSD_HOME_DIST"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF1427:
+	.string	"_Mdouble_ double"
+.LASF2362:
+	.string	"accEventThresholdLow"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1590:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2107:
+	.string	"appliedMixerPreset"
+.LASF2236:
+	.string	"SENSOR_BARO"
+.LASF1526:
+	.string	"IOCFG_OUT_PP 0"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1907:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1520:
+	.string	"HDOP_SCALE (100)"
+.LASF1535:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1824:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1694:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1888:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2163:
+	.string	"OSD_CRUISE_HEADING_ERROR"
+.LASF963:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1944:
+	.string	"FEATURE_VBAT"
+.LASF2032:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF2275:
+	.string	"OWNER_SERVO"
+.LASF940:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1384:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2129:
+	.string	"OSD_PITCH_PIDS"
+.LASF1617:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1095:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF985:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1264:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1495:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1865:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1232:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2319:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1104:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF999:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1055:
+	.string	"OSD_HOMING_LIM_H1 6"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2306:
+	.string	"OWNER_IRLOCK"
+.LASF1045:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF1650:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1599:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2198:
+	.string	"OSD_IMU_TEMPERATURE"
+.LASF1557:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1680:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1568:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2380:
+	.string	"sbufWriteU8"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1795:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1867:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1606:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2365:
+	.string	"simGroundStationNumber"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1266:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1925:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1927:
+	.string	"__uint16_t"
+.LASF1404:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1059:
+	.string	"OSD_HOMING_LIM_V2 10"
+.LASF2366:
+	.string	"simPin"
+.LASF2274:
+	.string	"OWNER_MOTOR"
+.LASF1233:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2403:
+	.string	"positionEstimationConfig"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2036:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF1541:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1988:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1278:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1962:
+	.string	"FEATURE_BLACKBOX"
+.LASF1690:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1203:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF2345:
+	.string	"gpsNoFixLatitude"
+.LASF1490:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1120:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1545:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1091:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF2189:
+	.string	"OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1965:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1234:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1875:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1576:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1330:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2331:
+	.string	"frskyGpsCoordFormat_e"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2209:
+	.string	"OSD_PLUS_CODE"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1135:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1163:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1204:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1281:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2224:
+	.string	"HW_SENSOR_UNHEALTHY"
+.LASF2228:
+	.string	"SENSOR_INDEX_BARO"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2227:
+	.string	"SENSOR_INDEX_ACC"
+.LASF2241:
+	.string	"SENSOR_GPS"
+.LASF2271:
+	.string	"OWNER_PWMIO"
+.LASF1066:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1221:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1884:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2354:
+	.string	"hottAlarmSoundInterval"
+.LASF1497:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1693:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF925:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1732:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1698:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1700:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF2053:
+	.string	"HORIZON_MODE"
+.LASF2338:
+	.string	"smartportFuelUnit_e"
+.LASF1918:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1947:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1213:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1660:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2178:
+	.string	"OSD_THROTTLE_EXPO"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1719:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1083:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1756:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF2131:
+	.string	"OSD_POWER"
+.LASF2340:
+	.string	"rc_channels_rate"
+.LASF741:
+	.string	"USE_NAV "
+.LASF1199:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF2260:
+	.string	"w_xy_flow_p"
+.LASF2149:
+	.string	"OSD_BATTERY_REMAINING_CAPACITY"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF2261:
+	.string	"w_xy_flow_v"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF2102:
+	.string	"float"
+.LASF2258:
+	.string	"w_xy_gps_p"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2259:
+	.string	"w_xy_gps_v"
+.LASF1572:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1975:
+	.string	"BOXARM"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1720:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1662:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2061:
+	.string	"FAILSAFE_MODE"
+.LASF1455:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2011:
+	.string	"BOXBRAKING"
+.LASF1329:
+	.string	"__DECL_SIMD_erfl "
+.LASF1521:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1527:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1597:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1190:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF2134:
+	.string	"OSD_HOME_DIR"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2148:
+	.string	"OSD_WH_DRAWN"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2033:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1614:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1949:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1092:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1582:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1682:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1494:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2232:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF2406:
+	.string	"activeBoxIdCount"
+.LASF1286:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1211:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2192:
+	.string	"OSD_FW_POS_PID_OUTPUTS"
+.LASF1067:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1986:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF374:
+	.string	"__unix 1"
+.LASF739:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1324:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1880:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2298:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1849:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF1723:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1180:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1483:
+	.string	"MATH_ERRNO 1"
+.LASF1948:
+	.string	"FEATURE_UNUSED_1"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1951:
+	.string	"FEATURE_UNUSED_3"
+.LASF1952:
+	.string	"FEATURE_UNUSED_4"
+.LASF1956:
+	.string	"FEATURE_UNUSED_5"
+.LASF1957:
+	.string	"FEATURE_UNUSED_6"
+.LASF1961:
+	.string	"FEATURE_UNUSED_7"
+.LASF1968:
+	.string	"FEATURE_UNUSED_8"
+.LASF1969:
+	.string	"FEATURE_UNUSED_9"
+.LASF2208:
+	.string	"OSD_ALTITUDE_MSL"
+.LASF2023:
+	.string	"box_s"
+.LASF2027:
+	.string	"box_t"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1668:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2037:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1685:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2361:
+	.string	"accEventThresholdHigh"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1738:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1703:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2281:
+	.string	"OWNER_RANGEFINDER"
+.LASF1202:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1007:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1564:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1237:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2081:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1309:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1737:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2188:
+	.string	"OSD_NAV_FW_PITCH2THR"
+.LASF2175:
+	.string	"OSD_BOARD_ALIGN_PITCH"
+.LASF1651:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1301:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1755:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1569:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1129:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1360:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1967:
+	.string	"FEATURE_VTX"
+.LASF1206:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1061:
+	.string	"HW_SENSOR_IS_HEALTHY(status) (status == HW_SENSOR_NONE || status == HW_SENSOR_OK)"
+.LASF1449:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF1621:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1688:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2128:
+	.string	"OSD_ROLL_PIDS"
+.LASF2018:
+	.string	"boxId_e"
+.LASF995:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF2358:
+	.string	"ltmUpdateRate"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1100:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1506:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1429:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1890:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2387:
+	.string	"packBoxModeFlags"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1819:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF994:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1077:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF2322:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1279:
+	.string	"__DECL_SIMD_log10l "
+.LASF2333:
+	.string	"FRSKY_UNIT_IMPERIALS"
+.LASF1304:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1022:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1983:
+	.string	"BOXNAVRTH"
+.LASF2344:
+	.string	"telemetryConfig_s"
+.LASF2368:
+	.string	"telemetryConfig_t"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF1156:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2044:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF2250:
+	.string	"use_gps_velned"
+.LASF2213:
+	.string	"OSD_GFORCE_X"
+.LASF2214:
+	.string	"OSD_GFORCE_Y"
+.LASF2215:
+	.string	"OSD_GFORCE_Z"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF2147:
+	.string	"OSD_EFFICIENCY_MAH_PER_KM"
+.LASF1624:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1302:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2391:
+	.string	"navFlowDeadReckoning"
+.LASF1392:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1107:
+	.string	"__DECL_SIMD_cos "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1707:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF2159:
+	.string	"OSD_WIND_SPEED_VERTICAL"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF959:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1285:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1851:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1585:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1188:
+	.string	"__DECL_SIMD_asinf "
+.LASF1883:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1705:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF2321:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2291:
+	.string	"OWNER_MPU"
+.LASF1151:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2386:
+	.string	"activeBoxes"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF948:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1459:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1057:
+	.string	"OSD_HOMING_LIM_H3 38"
+.LASF1430:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1424:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF2151:
+	.string	"OSD_EFFICIENCY_WH_PER_KM"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1710:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1312:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1940:
+	.string	"ADC_CURRENT"
+.LASF2353:
+	.string	"report_cell_voltage"
+.LASF2120:
+	.string	"OSD_CRAFT_NAME"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1715:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2016:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF2301:
+	.string	"OWNER_TEMPERATURE"
+.LASF1894:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1252:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1960:
+	.string	"FEATURE_DASHBOARD"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1579:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2292:
+	.string	"OWNER_INVERTER"
+.LASF1493:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1936:
+	.string	"size_t"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1873:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1133:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1933:
+	.string	"uint8_t"
+.LASF2179:
+	.string	"OSD_PITCH_RATE"
+.LASF1418:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1618:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF2116:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF2332:
+	.string	"FRSKY_UNIT_METRICS"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1444:
+	.string	"_Mdouble_ _Float64"
+.LASF1833:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1433:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1185:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2043:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1015:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2229:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2051:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF2028:
+	.string	"ARMED"
+.LASF1173:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1365:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1327:
+	.string	"__DECL_SIMD_erf "
+.LASF1239:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1984:
+	.string	"BOXNAVPOSHOLD"
+.LASF891:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2351:
+	.string	"frsky_vfas_precision"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1802:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2311:
+	.string	"RESOURCE_IO"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1699:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF2223:
+	.string	"HW_SENSOR_UNAVAILABLE"
+.LASF2167:
+	.string	"OSD_POWER_SUPPLY_IMPEDANCE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1812:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1174:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1839:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1916:
+	.string	"IS_ENABLED(mask) (mask == 0 ? 0 : 1)"
+.LASF1725:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF2337:
+	.string	"SMARTPORT_FUEL_UNIT_MWH"
+.LASF1463:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1227:
+	.string	"__DECL_SIMD_cosh "
+.LASF1108:
+	.string	"__DECL_SIMD_cosf "
+.LASF1117:
+	.string	"__DECL_SIMD_sin "
+.LASF2269:
+	.string	"positionEstimationConfig_System"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1225:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF2238:
+	.string	"SENSOR_RANGEFINDER"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2370:
+	.string	"boxes"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF1130:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1636:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1383:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF892:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1539:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF718:
+	.string	"__need_size_t"
+.LASF2273:
+	.string	"OWNER_PPMINPUT"
+.LASF1551:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF2352:
+	.string	"frsky_pitch_roll"
+.LASF2079:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1160:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2143:
+	.string	"OSD_GPS_HDOP"
+.LASF1191:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1408:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF2140:
+	.string	"OSD_ONTIME_FLYTIME"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF2374:
+	.string	"getHwCompassStatus"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2356:
+	.string	"smartportFuelUnit"
+.LASF1434:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1447:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF2263:
+	.string	"w_xy_res_v"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF1829:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF2397:
+	.string	"findBoxByPermanentId"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF947:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1570:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF2030:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1210:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1669:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1145:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2239:
+	.string	"SENSOR_PITOT"
+.LASF1766:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1436:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1681:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF971:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2001:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1087:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF2371:
+	.string	"activeBoxIds"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1608:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1280:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1945:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF2330:
+	.string	"FRSKY_FORMAT_NMEA"
+.LASF1351:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1654:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1240:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF946:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF1632:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1554:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2183:
+	.string	"OSD_MANUAL_RC_YAW_EXPO"
+.LASF1439:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1474:
+	.string	"FP_ZERO 2"
+.LASF1908:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1768:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1803:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2405:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1047:
+	.string	"OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)"
+.LASF1382:
+	.string	"__f128(x) x ##f128"
+.LASF2218:
+	.string	"OSD_ESC_RPM"
+.LASF1438:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1903:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1648:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1848:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1588:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2186:
+	.string	"OSD_MANUAL_YAW_RATE"
+.LASF2389:
+	.string	"navReadyMultirotor"
+.LASF1696:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1361:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1863:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1116:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1097:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1032:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1714:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1272:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2138:
+	.string	"OSD_VARIO_NUM"
+.LASF1189:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1371:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1543:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1368:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2235:
+	.string	"SENSOR_ACC"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1028:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1472:
+	.string	"FP_NAN 0"
+.LASF1261:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2379:
+	.string	"bitArraySet"
+.LASF1103:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1445:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1089:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1701:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1788:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1692:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1695:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2125:
+	.string	"OSD_GPS_SPEED"
+.LASF1267:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1109:
+	.string	"__DECL_SIMD_cosl "
+.LASF2314:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF2098:
+	.string	"PLATFORM_TRICOPTER"
+.LASF1591:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2267:
+	.string	"baro_epv"
+.LASF1979:
+	.string	"BOXHEADINGHOLD"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF2115:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF2057:
+	.string	"NAV_POSHOLD_MODE"
+.LASF980:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF719:
+	.string	"NULL"
+.LASF1224:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF2069:
+	.string	"GPS_FIX_HOME"
+.LASF1195:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1014:
+	.string	"PERMANENT_ID_NONE 255"
+.LASF2002:
+	.string	"BOXAUTOTRIM"
+.LASF1896:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1709:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2282:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1142:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2191:
+	.string	"OSD_FW_ALT_PID_OUTPUTS"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2382:
+	.string	"sbufBytesRemaining"
+.LASF1553:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF928:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2341:
+	.string	"position_rate"
+.LASF2146:
+	.string	"OSD_HEADING_GRAPH"
+.LASF2284:
+	.string	"OWNER_I2C"
+.LASF2182:
+	.string	"OSD_MANUAL_RC_EXPO"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1051:
+	.string	"OSD_X(x) ((x) & 0x001F)"
+.LASF921:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1887:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2168:
+	.string	"OSD_LEVEL_PIDS"
+.LASF1489:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1364:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1288:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2181:
+	.string	"OSD_YAW_RATE"
+.LASF2076:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF2067:
+	.string	"armingFlags"
+.LASF1666:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2117:
+	.string	"OSD_ONTIME"
+.LASF1450:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1337:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1025:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2343:
+	.string	"extra2_rate"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2173:
+	.string	"OSD_HEADING_P"
+.LASF1689:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1475:
+	.string	"FP_SUBNORMAL 3"
+.LASF2035:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1380:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1834:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1616:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1313:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1976:
+	.string	"BOXANGLE"
+.LASF2000:
+	.string	"BOXFLAPERON"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2038:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF2313:
+	.string	"RESOURCE_UART_TX"
+.LASF1846:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF927:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF2121:
+	.string	"OSD_THROTTLE_POS"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF2376:
+	.string	"feature"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2342:
+	.string	"extra1_rate"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1771:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1186:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF2176:
+	.string	"OSD_RC_EXPO"
+.LASF2264:
+	.string	"w_acc_bias"
+.LASF982:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2126:
+	.string	"OSD_GPS_SATS"
+.LASF1231:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1006:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1396:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2084:
+	.string	"AIRMODE_ACTIVE"
+.LASF2039:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF968:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1866:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF961:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF997:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2378:
+	.string	"memset"
+.LASF1446:
+	.string	"_Mdouble_ _Float128"
+.LASF1050:
+	.string	"OSD_POS(x,y) ((x) | ((y) << 5))"
+.LASF1410:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1517:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2212:
+	.string	"OSD_GFORCE"
+.LASF1549:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2026:
+	.string	"permanentId"
+.LASF1860:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1303:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1320:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF2082:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1678:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1931:
+	.string	"int8_t"
+.LASF1242:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1633:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2099:
+	.string	"PLATFORM_ROVER"
+.LASF1791:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2083:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1165:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1584:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2092:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1299:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1181:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2070:
+	.string	"GPS_FIX"
+.LASF1131:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2195:
+	.string	"OSD_MC_VEL_Z_PID_OUTPUTS"
+.LASF721:
+	.string	"__need_NULL"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1044:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1467:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1253:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2231:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1939:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1248:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1411:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1193:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1562:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1161:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2373:
+	.string	"navigationTerrainFollowingEnabled"
+.LASF1523:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1177:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1671:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1454:
+	.string	"__MATHDECL_ALIAS"
+.LASF2402:
+	.string	"telemetryConfig"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2029:
+	.string	"WAS_EVER_ARMED"
+.LASF1019:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1623:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF1093:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1072:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2118:
+	.string	"OSD_FLYTIME"
+.LASF1200:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1647:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2219:
+	.string	"OSD_ESC_TEMPERATURE"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF922:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2058:
+	.string	"HEADFREE_MODE"
+.LASF1194:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2285:
+	.string	"OWNER_SDCARD"
+.LASF1500:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF989:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1369:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1891:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF785:
+	.string	"USE_LOG "
+.LASF1484:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2177:
+	.string	"OSD_RC_YAW_EXPO"
+.LASF1054:
+	.string	"OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)"
+.LASF1932:
+	.string	"int16_t"
+.LASF1323:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1919:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2087:
+	.string	"MULTIROTOR"
+.LASF2335:
+	.string	"SMARTPORT_FUEL_UNIT_PERCENT"
+.LASF1922:
+	.string	"signed char"
+.LASF1397:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2104:
+	.string	"motorDirectionInverted"
+.LASF1125:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1241:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1470:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF1246:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1073:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2059:
+	.string	"NAV_LAUNCH_MODE"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF1966:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1958:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2077:
+	.string	"COMPASS_CALIBRATED"
+.LASF1325:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1069:
+	.string	"sq(x) ((x)*(x))"
+.LASF2401:
+	.string	"findBoxByActiveBoxId"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1041:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1458:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1146:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1797:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1716:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2055:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF2017:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1399:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1815:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1226:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1501:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1548:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1663:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1982:
+	.string	"BOXCAMSTAB"
+.LASF1565:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1289:
+	.string	"__DECL_SIMD_log2l "
+.LASF2230:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF2359:
+	.string	"simTransmitInterval"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1913:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2237:
+	.string	"SENSOR_MAG"
+.LASF1842:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1388:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF1794:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1995:
+	.string	"BOXAIRMODE"
+.LASF1314:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1440:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2048:
+	.string	"ARMING_DISABLED_OOM"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1656:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2278:
+	.string	"OWNER_SERIAL"
+.LASF2216:
+	.string	"OSD_RC_SOURCE"
+.LASF2256:
+	.string	"w_z_gps_p"
+.LASF1780:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2257:
+	.string	"w_z_gps_v"
+.LASF2289:
+	.string	"OWNER_OSD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF2305:
+	.string	"OWNER_PINIO"
+.LASF1182:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1775:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1806:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1639:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1143:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1855:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1265:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2119:
+	.string	"OSD_FLYMODE"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1980:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1587:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1492:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF986:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2171:
+	.string	"OSD_VEL_XY_PIDS"
+.LASF1023:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1409:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1594:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1631:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1537:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1134:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1437:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2145:
+	.string	"OSD_THROTTLE_POS_AUTO_THR"
+.LASF1293:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1137:
+	.string	"__DECL_SIMD_log "
+.LASF943:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF2160:
+	.string	"OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH"
+.LASF964:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1993:
+	.string	"BOXFAILSAFE"
+.LASF2290:
+	.string	"OWNER_BARO"
+.LASF1954:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1260:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1296:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1758:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1529:
+	.string	"IOCFG_AF_OD 0"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1127:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1150:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1013:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1563:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF933:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1972:
+	.string	"FEATURE_OSD"
+.LASF965:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2312:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2021:
+	.string	"bits"
+.LASF2381:
+	.string	"sbufWriteData"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2348:
+	.string	"telemetry_inverted"
+.LASF2015:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF2094:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1544:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1837:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF991:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1929:
+	.string	"long int"
+.LASF2005:
+	.string	"BOXCAMERA2"
+.LASF2006:
+	.string	"BOXCAMERA3"
+.LASF1141:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1767:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1290:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1555:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF2392:
+	.string	"serializeBoxReply"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF2139:
+	.string	"OSD_AIR_SPEED"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1684:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2279:
+	.string	"OWNER_PINDEBUG"
+.LASF1611:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF1878:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2101:
+	.string	"PLATFORM_OTHER"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1075:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1498:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1990:
+	.string	"BOXOSD"
+.LASF2349:
+	.string	"frsky_coordinate_format"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1513:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF935:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2242:
+	.string	"SENSOR_GPSMAG"
+.LASF1166:
+	.string	"__DECL_SIMD_powf128x "
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF2203:
+	.string	"OSD_TEMP_SENSOR_3_TEMPERATURE"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1254:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1132:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1711:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2222:
+	.string	"HW_SENSOR_OK"
+.LASF1422:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1512:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1508:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1743:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2054:
+	.string	"HEADING_MODE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2328:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF923:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1257:
+	.string	"__DECL_SIMD_cbrt "
+.LASF932:
+	.string	"EXPAND_I(x) x"
+.LASF2060:
+	.string	"MANUAL_MODE"
+.LASF1854:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1172:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1223:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1428:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1935:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2133:
+	.string	"OSD_GPS_LAT"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF2124:
+	.string	"OSD_MAH_DRAWN"
+.LASF1561:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2205:
+	.string	"OSD_TEMP_SENSOR_5_TEMPERATURE"
+.LASF2062:
+	.string	"AUTO_TUNE"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1402:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2141:
+	.string	"OSD_RTC_TIME"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1064:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1752:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1816:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1287:
+	.string	"__DECL_SIMD_log2 "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1609:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2395:
+	.string	"replyLengthTotal"
+.LASF1102:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF2245:
+	.string	"positionEstimationConfig_s"
+.LASF2268:
+	.string	"positionEstimationConfig_t"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1751:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2310:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1275:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1861:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1306:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1222:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1978:
+	.string	"BOXNAVALTHOLD"
+.LASF1403:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1457:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1316:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2025:
+	.string	"boxName"
+.LASF2207:
+	.string	"OSD_TEMP_SENSOR_7_TEMPERATURE"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1822:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1405:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1992:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1921:
+	.string	"long unsigned int"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1761:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1491:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1981:
+	.string	"BOXHEADADJ"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF2170:
+	.string	"OSD_POS_Z_PIDS"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF1627:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2095:
+	.string	"PLATFORM_MULTIROTOR"
+.LASF1126:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2065:
+	.string	"FLAPERON"
+.LASF1999:
+	.string	"BOXSURFACE"
+.LASF1702:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF2280:
+	.string	"OWNER_TIMER"
+.LASF1473:
+	.string	"FP_INFINITE 1"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1734:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1511:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1613:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1810:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1840:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1786:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1845:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1515:
+	.string	"LAT 0"
+.LASF1144:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1915:
+	.string	"BOX_SUFFIX_LEN 1"
+.LASF1318:
+	.string	"__DECL_SIMD_acoshf "
+.LASF2197:
+	.string	"OSD_3D_SPEED"
+.LASF1930:
+	.string	"char"
+.LASF1460:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2249:
+	.string	"gravity_calibration_tolerance"
+.LASF1283:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1683:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1197:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1345:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1989:
+	.string	"BOXNAVLAUNCH"
+.LASF1391:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1620:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1946:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1630:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1540:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1082:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2100:
+	.string	"PLATFORM_BOAT"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF2164:
+	.string	"OSD_CRUISE_HEADING_ADJUSTMENT"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1973:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1017:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2240:
+	.string	"SENSOR_OPFLOW"
+.LASF1071:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1153:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1112:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1284:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1176:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF958:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1060:
+	.string	"OSD_HOMING_LIM_V3 15"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1746:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF1443:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1114:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1011:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2377:
+	.string	"sensors"
+.LASF2196:
+	.string	"OSD_MC_POS_XYZ_P_OUTPUTS"
+.LASF1168:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1162:
+	.string	"__DECL_SIMD_powf64 "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2346:
+	.string	"gpsNoFixLongitude"
+.LASF1721:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1154:
+	.string	"__DECL_SIMD_expf32x "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF2114:
+	.string	"OSD_CROSSHAIRS"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1088:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1386:
+	.string	"__HAVE_FLOAT32 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2399:
+	.string	"boxIndex"
+.LASF1310:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF2304:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1068:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1259:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1598:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1155:
+	.string	"__DECL_SIMD_expf64x "
+.LASF2383:
+	.string	"strlen"
+.LASF975:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1043:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF1363:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1192:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2369:
+	.string	"telemetryConfig_System"
+.LASF1385:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2390:
+	.string	"navReadyOther"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1740:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1712:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF2404:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1348:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1003:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2262:
+	.string	"w_z_res_v"
+.LASF930:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1056:
+	.string	"OSD_HOMING_LIM_H2 16"
+.LASF1914:
+	.string	"BOX_SUFFIX ';'"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2243:
+	.string	"SENSOR_TEMP"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2194:
+	.string	"OSD_MC_VEL_Y_PID_OUTPUTS"
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1809:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF983:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1122:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF1218:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1603:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1024:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1626:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1747:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1482:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2316:
+	.string	"RESOURCE_EXTI"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1273:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF2122:
+	.string	"OSD_VTX_CHANNEL"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1374:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1317:
+	.string	"__DECL_SIMD_acosh "
+.LASF1373:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1823:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2158:
+	.string	"OSD_WIND_SPEED_HORIZONTAL"
+.LASF1350:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1469:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1853:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1294:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1789:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1502:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1735:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1593:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF2184:
+	.string	"OSD_MANUAL_PITCH_RATE"
+.LASF1040:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF1230:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1488:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1053:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1412:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1079:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1008:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF2127:
+	.string	"OSD_ALTITUDE"
+.LASF1420:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1830:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1550:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1892:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1906:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1362:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1468:
+	.string	"__MATHCALL_NARROW"
+.LASF1510:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF990:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF2180:
+	.string	"OSD_ROLL_RATE"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF962:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1167:
+	.string	"__DECL_SIMD_acos "
+.LASF1991:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1718:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2078:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1238:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1262:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2068:
+	.string	"flightModeFlags"
+.LASF969:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1030:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1759:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1486:
+	.string	"M_E 2.7182818284590452354"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1407:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1080:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1499:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1757:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1800:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2244:
+	.string	"double"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF2075:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1349:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1170:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2329:
+	.string	"FRSKY_FORMAT_DMS"
+.LASF1881:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF939:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1406:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1031:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2045:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1426:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2385:
+	.string	"sensorStatus"
+.LASF1090:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1507:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF942:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF2247:
+	.string	"reset_altitude_type"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1340:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1344:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1661:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1215:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1950:
+	.string	"FEATURE_GPS"
+.LASF2072:
+	.string	"SMALL_ANGLE"
+.LASF2295:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2085:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1902:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1009:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2064:
+	.string	"NAV_CRUISE_MODE"
+.LASF1852:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1998:
+	.string	"BOXKILLSWITCH"
+.LASF1414:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1928:
+	.string	"__uint32_t"
+.LASF2022:
+	.string	"boxBitmask_t"
+.LASF1178:
+	.string	"__DECL_SIMD_atanf "
+.LASF2112:
+	.string	"OSD_RSSI_VALUE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2363:
+	.string	"accEventThresholdNegX"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1813:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1959:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2050:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF2375:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1858:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2080:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2286:
+	.string	"OWNER_FLASH"
+.LASF1169:
+	.string	"__DECL_SIMD_acosl "
+.LASF1487:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1893:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1442:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1505:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1879:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1347:
+	.string	"__DECL_SIMD_asinh "
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1305:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1158:
+	.string	"__DECL_SIMD_powf "
+.LASF2211:
+	.string	"OSD_MAP_REFERENCE"
+.LASF1425:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF934:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1164:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2157:
+	.string	"OSD_RADAR"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1804:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2108:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF1542:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1187:
+	.string	"__DECL_SIMD_asin "
+.LASF1909:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1578:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2334:
+	.string	"frskyUnit_e"
+.LASF1779:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2089:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1456:
+	.string	"__MATHCALL"
+.LASF2400:
+	.string	"candidate"
+.LASF1787:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1955:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2073:
+	.string	"FIXED_WING_LEGACY"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1229:
+	.string	"__DECL_SIMD_coshl "
+.LASF1622:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF786:
+	.string	"USE_STATS "
+.LASF857:
+	.string	"USE_MAG "
+.LASF2303:
+	.string	"OWNER_AIRSPEED"
+.LASF1448:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2003:
+	.string	"BOXAUTOTUNE"
+.LASF1503:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1727:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF2174:
+	.string	"OSD_BOARD_ALIGN_ROLL"
+.LASF1334:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1307:
+	.string	"__DECL_SIMD_atanh "
+.LASF2251:
+	.string	"allow_dead_reckoning"
+.LASF1113:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1987:
+	.string	"BOXLEDLOW"
+.LASF1415:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1026:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1974:
+	.string	"bitarrayElement_t"
+.LASF992:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1269:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1760:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2255:
+	.string	"w_z_surface_v"
+.LASF2200:
+	.string	"OSD_TEMP_SENSOR_0_TEMPERATURE"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF1504:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1065:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1573:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2014:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1236:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1708:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1198:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2220:
+	.string	"OSD_ITEM_COUNT"
+.LASF1652:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1372:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2246:
+	.string	"automatic_mag_declination"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1183:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1905:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF945:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1478:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1335:
+	.string	"__DECL_SIMD_erff64x "
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1276:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2202:
+	.string	"OSD_TEMP_SENSOR_2_TEMPERATURE"
+.LASF1744:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1128:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1533:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2019:
+	.string	"sbuf_s"
+.LASF1937:
+	.string	"sbuf_t"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1522:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1941:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF988:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1857:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1184:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1516:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1208:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1124:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1942:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF944:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1029:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2103:
+	.string	"mixerConfig_s"
+.LASF2110:
+	.string	"mixerConfig_t"
+.LASF1377:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2204:
+	.string	"OSD_TEMP_SENSOR_4_TEMPERATURE"
+.LASF1996:
+	.string	"BOXHOMERESET"
+.LASF2350:
+	.string	"frsky_unit"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1509:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1037:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1441:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF2096:
+	.string	"PLATFORM_AIRPLANE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1560:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF956:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1298:
+	.string	"__DECL_SIMD_log1pf "
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2323:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2324:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2325:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2326:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1235:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1722:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1741:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1292:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1742:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2042:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF2206:
+	.string	"OSD_TEMP_SENSOR_6_TEMPERATURE"
+.LASF1346:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2270:
+	.string	"OWNER_FREE"
+.LASF2132:
+	.string	"OSD_GPS_LON"
+.LASF1217:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1205:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1322:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2357:
+	.string	"ibusTelemetryType"
+.LASF1094:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2252:
+	.string	"max_surface_altitude"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF1338:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1836:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1010:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1049:
+	.string	"OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1370:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2396:
+	.string	"activeBoxId"
+.LASF1730:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1039:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF2272:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1395:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2169:
+	.string	"OSD_POS_XY_PIDS"
+.LASF1677:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1898:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1390:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2302:
+	.string	"OWNER_1WIRE"
+.LASF1115:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1005:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF929:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1308:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1763:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1179:
+	.string	"__DECL_SIMD_atanl "
+.LASF866:
+	.string	"USE_UART8 "
+.LASF1250:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1519:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1421:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1219:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1101:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1277:
+	.string	"__DECL_SIMD_log10 "
+.LASF1577:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF2190:
+	.string	"OSD_DEBUG"
+.LASF2090:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1333:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1216:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1118:
+	.string	"__DECL_SIMD_sinf "
+.LASF949:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1600:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1021:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1897:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1171:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2093:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1052:
+	.string	"OSD_Y(x) (((x) >> 5) & 0x001F)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1258:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF2091:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF1159:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1653:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1524:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1136:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1341:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1943:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2144:
+	.string	"OSD_MAIN_BATT_CELL_VOLTAGE"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF977:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1001:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1994:
+	.string	"BOXNAVWP"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1063:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF1748:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1820:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2123:
+	.string	"OSD_CURRENT_DRAW"
+.LASF371:
+	.string	"__linux 1"
+.LASF2234:
+	.string	"SENSOR_GYRO"
+.LASF1451:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1096:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1558:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1556:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1971:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2221:
+	.string	"HW_SENSOR_NONE"
+.LASF2320:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2283:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1076:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1765:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1825:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF2024:
+	.string	"boxId"
+.LASF1674:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF466:
+	.string	"__PMT"
+.LASF1697:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1328:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1046:
+	.string	"OSD_ALTERNATE_LAYOUT_COUNT 3"
+.LASF1776:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1657:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2041:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1110:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1518:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2113:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1534:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2293:
+	.string	"OWNER_LED_STRIP"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2193:
+	.string	"OSD_MC_VEL_X_PID_OUTPUTS"
+.LASF2265:
+	.string	"w_xyz_acc_p"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF2300:
+	.string	"OWNER_COMPASS"
+.LASF1645:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1733:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF1078:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1910:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1785:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2347:
+	.string	"telemetry_switch"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1901:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1000:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF2233:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2046:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1773:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1228:
+	.string	"__DECL_SIMD_coshf "
+.LASF1085:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2161:
+	.string	"OSD_REMAINING_DISTANCE_BEFORE_RTH"
+.LASF1706:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1209:
+	.string	"__DECL_SIMD_exp2l "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1058:
+	.string	"OSD_HOMING_LIM_V1 5"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF1081:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2007:
+	.string	"BOXOSDALT1"
+.LASF2008:
+	.string	"BOXOSDALT2"
+.LASF2009:
+	.string	"BOXOSDALT3"
+.LASF1781:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1923:
+	.string	"__int8_t"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1552:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF926:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF970:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF2137:
+	.string	"OSD_VARIO"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF1514:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2056:
+	.string	"NAV_RTH_MODE"
+.LASF2217:
+	.string	"OSD_VTX_POWER"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF2136:
+	.string	"OSD_HEADING"
+.LASF1635:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1074:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1321:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1920:
+	.string	"unsigned int"
+.LASF2226:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF1762:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1201:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2166:
+	.string	"OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE"
+.LASF1366:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1713:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1471:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1016:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF1536:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2384:
+	.string	"packSensorStatus"
+.LASF2185:
+	.string	"OSD_MANUAL_ROLL_RATE"
+.LASF1268:
+	.string	"__DECL_SIMD_atan2f "
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1843:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1339:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1326:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2394:
+	.string	"serializeBoxNamesReply"
+.LASF2253:
+	.string	"w_z_baro_p"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF978:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2277:
+	.string	"OWNER_ADC"
+.LASF1926:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1270:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1644:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1672:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1882:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1828:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1147:
+	.string	"__DECL_SIMD_exp "
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1452:
+	.string	"__MATHDECL_1_IMPL"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2315:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2066:
+	.string	"TURN_ASSISTANT"
+.LASF1359:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1726:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF957:
+	.string	"EXTENDED_FASTRAM "
+.LASF1297:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1062:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF2254:
+	.string	"w_z_surface_p"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1869:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF967:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1749:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1247:
+	.string	"__DECL_SIMD_sinh "
+.LASF1531:
+	.string	"IOCFG_IPU 0"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2327:
+	.string	"RESOURCE_RX_CE"
+.LASF1736:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1353:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2153:
+	.string	"OSD_ATTITUDE_PITCH"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF2266:
+	.string	"max_eph_epv"
+.LASF1675:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2430:
+	.string	"streambuf.h"
+.LASF2489:
+	.string	"mathcalls-helper-functions.h"
+.LASF2452:
+	.string	"features-time64.h"
+.LASF2456:
+	.string	"long-double.h"
+.LASF2463:
+	.string	"__locale_t.h"
+.LASF2465:
+	.string	"platform.h"
+.LASF2490:
+	.string	"mathcalls.h"
+.LASF2410:
+	.string	"src/main/drivers"
+.LASF2487:
+	.string	"fp-logb.h"
+.LASF2475:
+	.string	"rx_pwm.h"
+.LASF2450:
+	.string	"libc-header-start.h"
+.LASF2423:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2485:
+	.string	"floatn-common.h"
+.LASF2414:
+	.string	"src/main/navigation"
+.LASF2438:
+	.string	"osd.h"
+.LASF2427:
+	.string	"stdint-intn.h"
+.LASF2467:
+	.string	"target.h"
+.LASF2477:
+	.string	"axis.h"
+.LASF2422:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2425:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2431:
+	.string	"adc.h"
+.LASF2461:
+	.string	"wchar.h"
+.LASF2453:
+	.string	"wordsize.h"
+.LASF2440:
+	.string	"sensors.h"
+.LASF2416:
+	.string	"src/main/target/SITL"
+.LASF2413:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2455:
+	.string	"cdefs.h"
+.LASF2421:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2491:
+	.string	"failsafe.h"
+.LASF2432:
+	.string	"config.h"
+.LASF2435:
+	.string	"fc_msp_box.h"
+.LASF2464:
+	.string	"strings.h"
+.LASF2443:
+	.string	"telemetry.h"
+.LASF2426:
+	.string	"types.h"
+.LASF2482:
+	.string	"math-vector.h"
+.LASF2474:
+	.string	"io_types.h"
+.LASF2459:
+	.string	"typesizes.h"
+.LASF2484:
+	.string	"floatn.h"
+.LASF2436:
+	.string	"runtime_config.h"
+.LASF2460:
+	.string	"time64.h"
+.LASF2448:
+	.string	"stdbool.h"
+.LASF2424:
+	.string	"/usr/include"
+.LASF2483:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2407:
+	.string	"src/main/build"
+.LASF2445:
+	.string	"feature.h"
+.LASF2451:
+	.string	"features.h"
+.LASF2412:
+	.string	"src/main/flight"
+.LASF2437:
+	.string	"mixer.h"
+.LASF2444:
+	.string	"fc_msp_box.c"
+.LASF2408:
+	.string	"src/main/common"
+.LASF2493:
+	.string	"serial.h"
+.LASF2409:
+	.string	"src/main/config"
+.LASF2495:
+	.string	"io_def.h"
+.LASF2441:
+	.string	"navigation.h"
+.LASF2434:
+	.string	"rc_modes.h"
+.LASF2428:
+	.string	"stdint-uintn.h"
+.LASF2417:
+	.string	"src/main/target"
+.LASF2470:
+	.string	"utils.h"
+.LASF2419:
+	.string	"src/main"
+.LASF2415:
+	.string	"src/main/sensors"
+.LASF2486:
+	.string	"flt-eval-method.h"
+.LASF2442:
+	.string	"resource.h"
+.LASF2433:
+	.string	"bitarray.h"
+.LASF2473:
+	.string	"time.h"
+.LASF2439:
+	.string	"diagnostics.h"
+.LASF2418:
+	.string	"src/main/telemetry"
+.LASF2488:
+	.string	"fp-fast.h"
+.LASF2476:
+	.string	"stats.h"
+.LASF2492:
+	.string	"gps.h"
+.LASF2411:
+	.string	"src/main/fc"
+.LASF2466:
+	.string	"common.h"
+.LASF2481:
+	.string	"math.h"
+.LASF2457:
+	.string	"stubs.h"
+.LASF2479:
+	.string	"maths.h"
+.LASF2454:
+	.string	"timesize.h"
+.LASF2446:
+	.string	"string.h"
+.LASF2468:
+	.string	"sanity_check.h"
+.LASF2420:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2462:
+	.string	"locale_t.h"
+.LASF2449:
+	.string	"stdint.h"
+.LASF2472:
+	.string	"build_config.h"
+.LASF2429:
+	.string	"stddef.h"
+.LASF2458:
+	.string	"stubs-64.h"
+.LASF2480:
+	.string	"vector.h"
+.LASF0:
+	.string	"./src/main/fc/fc_msp_box.c"
+.LASF2494:
+	.string	"io.h"
+.LASF2496:
+	.string	"io_def_generated.h"
+.LASF2469:
+	.string	"common_post.h"
+.LASF2471:
+	.string	"parameter_group.h"
+.LASF2447:
+	.string	"stdc-predef.h"
+.LASF2478:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\244\001M\006"
+	.string	"4\006\230\002"
+	.string	"\n"
+	.string	"\323\330\327\374\016\002\002"
+	.string	"\002"
+	.string	"\001\330\225\255P\002\275\357\264\306\f\003\205\203\306\242\005\020\002\001\002\002\003\002"
+	.string	"\002\001\004\240\342\234\212\n\005\352\263\360\321\b\006\220\320\245\025\b\001\007\300\362\224\302\016\254\001\004\002\004\001\002\002\001\005\002\006\001\002\007\f\346\261\273\315\003b\002\002\017\330\333\221\323\t"
+	.string	""
+	.string	"1 \340\002!\263\016Q"
+	.string	"\317\204'\t (\001\007\207;\340"
+	.string	"H\350\316\340\370\002\006`\301\227\004\b\222mY\340\b\024`\267A\327ef\331\340\001\230\025n<\314\007h\305\r\006\272;p\361\301a\334\334r\210\t\t\313`\370|"
+	.ascii	"\007\315\255;\264\214C\031\201\302\036LAa3n\265\203r\353'\321"
+	.ascii	"\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375 \361\315\002"
+	.string	"\244\002\345"
+	.string	"\007"
+	.string	"\001\003\002\003\001"
+	.string	"\020"
+	.string	"\007\003\002\001\200\004"
+	.string	""
+	.string	"\001\003\001\001"
+	.string	"\001\001\006\001\001\f\001\001\002\001\003\001\001\001\017"
+	.string	"\003\024"
+	.string	"K%4\367"
+	.string	"8\027\230\001\025\215\244\002T\001\001\016\260\340"
+	.string	"\304\273J\030\270\202s.\210\301\005\340RDg\360*\203_\302\330"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.inline.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\031\002\375\007"
+	.string	"B\313)2Pm\222\016@\211\r\200\351vsfK\3160\357R;<\277:#\320m\260\244\302Q\265\353\345\342\2311kU\030QN9\005-=\030~h\253m\271S3`Df\"\224\223\231\226\t\376R5\203\020!\217\252\026"
+	.ascii	"\275\357\243*\201\3611:\221\003\3123\351\005\332\200m\023\332"
+	.ascii	"@\215\f\202tX$\355<a\027\205\016\235\212\313\200\302\013\212"
+	.ascii	"\222\221\202\247\373.\325\225\017\3761\351\257|\372GQ\300\326"
+	.ascii	"\332\303\364\232fp\2008\t\232\216@\233\t\313\330\377\336\205"
+	.ascii	"ffN\217\351eyD\003\375\3034\304\362\210\002~2\262\" p\002\031"
+	.ascii	"9\253\007\223\035\005\022\241\221\366Pa\026\254\032\240\226("
+	.ascii	"\\\t[\345\004\246y\2100\342\307\271\231_\241\022\344\371\212"
+	.ascii	"\350\r\213\r\360\221Gt\003\202\025\030\200\257u3t\206\234-\314"
+	.ascii	"Y\3157\334\306\0011\206\223~\r\352b\376\213\365\330\231<\355"
+	.ascii	"\016\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\340\003\035\f"
+	.string	"\022\316-.pGI\007\374\377q\b\003\b\021\252\243\r\250\252\252\360\241\2533\\\bTA\255\177\330T{\344G?\244\3773Q\3637\306Hn@\332N2e\b'\\\345\326\215\030\316\314\347\311d\020\b\bJ$\242H\241X,\030\f\207\003\002y<\032\215HD\"\231L$\211B\251T,\226\313\005\203\231\246\013\022\2615\201\221z\312>%>\360\013\2570^\207\2155\210\242\356\303u\2717\371\233\304K\200\020:\211\217]\345\007\033\\\313B\374\261\367^k\322{\322{W\211\330>\375z\374\274\216a\335Y\215\346:$\266\016\231\325\231u[\307X"
+	.ascii	":\370\016\002\240s\276OYC{\250\001}U$%\005\311\260\033\360\""
+	.ascii	"\251\332v\021PLh\220\322Ff\223B\373\031\372\"\236\244FL\337\310"
+	.ascii	"\245f\377\tU\023\351\307~\265\3024\0136\346E22KdQ\320=\267\247"
+	.ascii	" .f\235O\346g\276\231\237\371f~\346\233\371\231o\3463\334\347"
+	.ascii	"\213q,D\350\321\267.\022/)e\241;\241\272\310\230\030F\324yH\300"
+	.ascii	":\205IVLN6\344n\274\243\351\376\016\201j\2723\333\303>\004\364"
+	.ascii	"%\212\351\244m\345w\217\365\321\021\213\324\211*_\311\305\232"
+	.ascii	"j.\375\224\362%\256\271o\274\303>\254\022\371\324\236w/\236\376"
+	.ascii	"\204\366\006.b\233\035\370\021]^m\243\\&\332\243\020\213\324"
+	.ascii	"\031E9\255c\371V\222\316\030>"
+	.text
+	.section	.gnu.lto_.pureconst.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375 \032\321"
+	.string	""
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\007"
+	.ascii	"\200\004\002\200\004\003\231\004\006\231\004\007\230\004\f\230"
+	.ascii	"\004\017\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375 a\035\002"
+	.string	"\324\002I"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	"\006"
+	.string	"\001@"
+	.string	"\002\003"
+	.string	""
+	.string	""
+	.string	"\001\200\200\203\200\003\006\001\200<"
+	.string	"\200\200\036\017"
+	.string	""
+	.string	"\005.cR "
+	.string	"\0051cO3"
+	.string	"\b"
+	.string	"S\221!\025\247\325\r1\251\200\240.\233\201\374\006"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_.lto.3a4211d24d4b5297,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_boxes.61.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`D\n-0"
+	.ascii	"*W\\\02390\252M\007\201\231\231\225\350\254\022\013!Rdff\031"
+	.ascii	"\202\304\3608\367\312\025\204{oT\316\275\206\266v\316\266\233"
+	.ascii	"\222~,\232(\303\357\370\227\305\227\230\323\210XT\216\235\222"
+	.ascii	"\f%\001$\001(\001P\366G\341jC\363\272I\252\347\007y\372\231\354"
+	.ascii	"o\342\340\331`x]\ft\351\210T\317\300;\375\313\375I\024<\0224"
+	.ascii	"\267s9\3253\204>\375E\366\257\001_\355\314\355\232tT\317j\204"
+	.ascii	"9\355\253\266\363APu\346wL1\252\3474\220vS\333OE(u\346wM\031"
+	.ascii	"\350\322\243\250\236%\270i\017\265]T\nJ\351x\276T=O\320\244\235"
+	.ascii	"\323\366N\0226)\035\257"
+	.string	")D\365\274\201\002%\355\226\266_\232PI\351y\314\032\350r\207\352\231C\005G\332!m\217D\341\021\232\3475i\250\236;XhjW\264}Q\205Dh\256\307\274\201.[\250\236=\\8\244\035o{\236\005D8\\\257\311B\365\334\245\322i\267\333~w\241\016\207\3571s\240\313\025\252\347\017\030\342\264\013\332>\207A.\315\367\232<\320e\t\325\263W\006?\332\001m\017\224\341\217\217,-~Z\251\341SS[:\233g \350\362U\317_\016\374!\320\243}\317v7!C\026\250)YK\341Y\203\023\371y\366>\007\376<cG\2051\226\212$\230lT\317_I\277\247\375\237\320N-\211s\214\352\031\013\222\376L\3735aa23\301<\257\250\236\263\026\351\247\264\277R\326$\242\211\246\226\236\376G\373!i9\"\236`\236IT\317[\206\364+\332\277h+\021\361D\263O\365\034\200N\177\336~\275"
+	.string	"xD\024\314S\252g.<\372\013\3557\004\374\335\021Q4\005\274\034\375\204\366\323\001\177\203\224)\230\224T\317\003\276\215~\271\375u\342\224)\232\237H\365L\300\212~@\373\003\021\370\363\372\033\363N\365\\\240\211~\267\375|\n\354y\375\rN\365l\340\353\350\277\263\037\217\001;D\2073\242\313w;\360k\372\343\354\227s"
+	.ascii	"\316\353p\315\227\243zF\300\247\237\315\3766\b\326\240y\334\233"
+	.ascii	"Q='8\245\377\314~4\t\314\264\036\327E\365\254@\224\3761\333\373"
+	.ascii	"\304\244\271\034\363\333T\317\013:\351\367\262\377\313\202\357"
+	.ascii	"\322\272\\\223\005\272|\006\227\364g\331\257\205\001\226\327"
+	.ascii	"\351\222\350\322\371T\317\r\"\351\257\262\337"
+	.string	"J\003*fN\347\002]\372'\325\263\203E\372\003J\033]:n\310\310\321\245\354\341\243\313\203\003\234\266\243F\217\256\037ii=\272\2640\0336t]\266\254M\203nJ\366\032\007`\347\343}\374\315\341|\220\023\362Bn\310\365|\317\031y#\227\344\223\034\223grO\376\311G9)G\345\251\234\225\267z#\177\344\225\374\222w\362O^\312O\371+\317\374-\317\345\301|\230'\363e>\315\253y7\377\346\347<\235\317\363z\276\317\373\371\267\207{A?\367uo\367\207\036\321\357}\363\031}\243\217\364\222\336\322_\372M\317\351A\211xR_\352S\275\252o\365}\247\221\363\310\251\344\\r:9\237\234RB\234V@\254\271yN\321g\225}N\241\022\354b\321\345IJ\005\266\3513\312>\333\240\340\bqvR=\273\003\331\364\331d\237lL\332\020MJ\016<\221\3503\311>\221\234K3\021{\252\347\023"
+	.string	"+}\026\331\347\032\200SmL\304\020]\236s\252\347\214J?\337~Vy\325;\342\354\243z\376\215\322\177j?\252\237\251vD\263\216\352\371\352\223~Q\373G]\205j\003\330\350\256"
+	.ascii	"\360\017\037\333\027C\267\025\242\310\342\272\225\216\035\207"
+	.ascii	"\0010\313\272bXxE\330\032\266\262B\024\203\255\310\327\270\006"
+	.ascii	"Q,D\272(\016+\266\302\267%\333\302\3055y\\\215W\330e\311X\026"
+	.ascii	"\354\n\233\265\3050\266x\205_\244plX\274\302f\357\025v\341\""
+	.ascii	"Y#[d\221Y\230=&\221i\026n\321\202\021\203k\021\f\013\263b\353"
+	.ascii	"[\034\256bX\230\314\354\n\263a\2551u\207+\026F\262/\353\246\254"
+	.ascii	"\261\025j\341\262\365\230\276\3011\024\267\030\032S\2668v\\\323"
+	.ascii	"221.\314\006W17\371\242\370\330\272,\331Z\024\303\302\310w\370"
+	.ascii	"\276kzt\223\310-"
+	.string	",\f\036\223k\3218t\221-2\271\246m\231\313\276\002\2600\210\034\232\275\305\342\220\250\205\275\276@\244\305\326E\036\333`\272\272\254q\r\022\300^_ RdqM\303\3366\013\263\3570\351\006\323\262\365\250\205\307\216C\342\352\202\245A\243\026\366\372r\3317\371\303\354\330q\025\006S\227E\016\333\"\027Vz\b\2226\343l\207\217\034gJ\033]\001\200\312\250A4b U\030\215\202\242\024$Y\016P\223\210\244m\020(\344\234\330j3]+\t\034\317\026I\312z'\203\207\001\236\335\307\357n11\260H\255\356\243&\360X\251]96\226f\377\367b\2270\301~\250\301^\251\277\261GG\215\205\237_|\224W\005\226\r\220W\330\204\367\220|_*\005<F\364\003\373s\316\350\211i\241,+boEnd\023\347\361\320\213T\375\026[\326\202\372\346\235\365S%o\350\034\315\034\221\347\210\242_\027\320\025"
+	.ascii	"\275\"Y>\320\360\343\364V\277l\373E&\321\352(\342\247\0258gD"
+	.ascii	"\314\226\223\242\321\254j\021\345\177K\255\246\245)\330l\306"
+	.ascii	"\214\2576u\213\317\037aI^\366\022.\257\2610\371\375\235-\226"
+	.ascii	"*f\202\320x\203\272dP\356z\031\025]\237#(\232\326k\362\201V\225"
+	.ascii	"S\252\020\354^\302ksML\327\226\\\264B%\224\333^\364?\205J\266"
+	.ascii	"\233\244H\356g\240\310\353\276\232Th`1b\372\215z$c5\b\352\275"
+	.ascii	"\255\355i\227\256$\2674}|t\020\202\b\n/\307b"
+	.text
+	.section	.gnu.lto_findBoxByActiveBoxId.64.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\275\002\035\027"
+	.string	"\206\253\233L\240\022V:\342\203\r\021\341\220\220!\255N\223\235\247\314\375\035\235q;\024W\203\325\276\337\303M80N\004\211\007\265\377\007\032\276k3XWk]k4b<HK\232F\366\0257\257\t\275)\r\f\231\253\340\273\232X\262\211\334I\006\205"
+	.string	"\177"
+	.string	"\210"
+	.string	"H\374`\005\347G;\356{\177rD\335\2336\340\005\350\355_\034\006\016\363\f\244C<\257\344\022P\251uo*\343\364\003\316[\364\002\316\333N\301(7\323\363Yy\177\235\326\354\312\343\367\3762o\2645E2\004\232\025\224t\212G\346\324\223E\317-\207\023C\202C\237\233&\205\030F\"\222\241\216\331\310%\325\225\257\302\341\257\366\221\2574z$}0\r{^_,\367^\256\301!\317\031=3\017\231\331\205\271\036\003\327"
+	.string	"\344C\336t\021t\244\217,}\252n\345bN{\265\211\314W\300C$\305-\304\f\373\321\217\236\\\331\376x6\237tn\263r\355\312\037\231"
+	.string	"\244%\344"
+	.ascii	"\325\275#\272\210\\\035Vj\305\223\376\343+\363O\356\354JO\306"
+	.ascii	"Nz\312'\361~wH\300\204I\247\r\350\255\t\326\354\311\247\261["
+	.ascii	"\223\254\031\363\221\307\035z\213^L\311\246 \367\246(\267\234"
+	.ascii	"\001\275=?\305a\2161\233\\\315\272>9\265+\200\r\240O\355\033"
+	.ascii	"@\246\212l\023\371F\243\247>\273[\310L\262DQ\202\254\021d6\221"
+	.ascii	"\321\256\235K\376\370\325-f\366\360(\031\273\303J\353\336\337"
+	.ascii	"\f\n\027\353Y\031g\374\211w\336\326.@t\004`i\242\352\354'\275"
+	.ascii	"\003\220\357M\274\004\0172s\2103\341\030\f\335\373\213 \343K"
+	.ascii	"\037\314\253\270\345\232\233\363\301[\376\315y{v\315\n\366\230"
+	.ascii	"\375\266J`\021_\355\342+\177\021\313\022\215UT\224\352&\356\316"
+	.ascii	"\037\0037\033\232-\3066C\253\301t7\333L\213\016\367\2022\214"
+	.ascii	"\003\025\b5\025\t\263\024\002\266\026\035\316\302\rD\214M\215"
+	.ascii	"\026\343Z\212\016\367\342BS#\343R\203\221\325`d314\031Y-W#K)"
+	.ascii	"a\034\315-'\263\301\341r\262Xz\337B\030x\340XB\235w\372\225\207"
+	.ascii	"\031\215\236\314n\333Bf\266\315,\276\316y5\221W\212\026\326\266"
+	.ascii	"X\257t\263\205(\027\256~u\313\2660\233\305W\271n\336{\357\t\353"
+	.ascii	"\037\217\340\273\323lX\177\347'0 @\002\302P\332\016\3252\204"
+	.ascii	"4<\323\003\245]\017#i@h\242Wk\026n\222\340\266\204~\024\216\\"
+	.ascii	"\361A\177\210]b/D\3268Z\335\222\rJ\033\344uRPN\210|\301\023\037"
+	.ascii	"D8j\366\310_\260\324\212\006\272X\331\353L)v5/\314\370n\266\256"
+	.ascii	"\272\204\036\366\222\344m\240v\037$[\366)o\260\005&j%\254#\240"
+	.ascii	"\254\331\271W\333\237"
+	.text
+	.section	.gnu.lto_findBoxByPermanentId.65.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\267\002\305\026"
+	.string	"\246k\232J\240\226U:\205\310\365\373\370\345\317\370\201WC\332\320vlen\n\300\013m\307L9\307\233\2621\344^\233h\333x\303\340\fx\240\342F\327\r\2534+\3742|q."
+	.string	"{Jl\313\370\020|\001/L\"tI\333{\313\235d\203"
+	.string	"\200"
+	.string	"\210"
+	.ascii	"\223\371\001\f\317\213l\334\367\006\005I\272\267l\300\013\310"
+	.ascii	"\327\013\037\203\207o\006\312\024?\250\242\220\235\221\351\336"
+	.ascii	"\222\305\345\007\330W\362\002\354k\243\340\226\323\362l\347\355"
+	.ascii	"([i\317\033\277\347(z\030M>V|;Za\206\017\360\304\334\264,\200"
+	.ascii	"^7\004!\361|$N\351\004\242\240\320\212\317\2076\361\370\343\306"
+	.ascii	"\317\236O7\373\304O\035K\271$G>\240OT\314\275\227'\317\367s&"
+	.ascii	"\317\314>f\236a\236\302\317P\002G<ua\3422\256r$:r\247\024\346"
+	.ascii	"\262g\366\217\371\n~\204\224\270O0\247^\364\223\226'\327\017"
+	.ascii	"\317\364F\347\246\223gO\276\n\205$\246'\007\226\356\025\3614"
+	.ascii	"\345\026\251J+n\364\017?\231\277\272\321\342\027\371FV\255p\264"
+	.ascii	"nt\373\0051\"\325+\022\321@\276\256\312\026\277\344\023Y\365"
+	.ascii	"\272\032\266\230\2076\362\016\241\216\212C\234\334[\266\2742"
+	.ascii	"\006\362\365\314<\314*\346\325\213V\007A\271\371\024\240\307"
+	.ascii	"\216h6\220&>\206j\377\370A\241S\333\356\3561\257\034w\260\020"
+	.ascii	"y\230\240\375c\262g\327\212Jt\263\211\231;<IV\215@\t\336\253"
+	.ascii	"k!\321T=KL8\236\343f_g\027\020*\002p\324q\304\366\215\316\241"
+	.ascii	"\004\3566n\t\316c\346\017?\2421Hq\257.\002\215\327\360@\257\342"
+	.ascii	"\225qt\354y\257|\035\373j{F\341\001\321~W\343\316\t7\237\370"
+	.ascii	"\306?\304QFC\031\002*u\377l\366\303\261\034\027\314\0066s\275"
+	.ascii	"R;1\330Lf\207FCr\215\203\027\b\257\027\t-\027\0020\231\234\231"
+	.ascii	"k\026\223\325b7*~\271\354\320hfnpd3\257\032\326\253\2065\263"
+	.ascii	"q\311X\257\032\016\313\205\205i7\261\032+\207F\253\261T\345}"
+	.ascii	"\237\270\200\204\311\021\311\376\306o|*(t\242\335\265{\314\\"
+	.ascii	"\233cp\235C\365\217a\2005\325\0258?\343\264{-\026\226\350fSm"
+	.ascii	"A9\0067\245\234\336{\257M\365\207Gp\233\245\235\352\203\b- P"
+	.ascii	"\202Q\352l\007\3252\204dx\336\003\245[\017ck@\330DWk\0266IX3"
+	.ascii	"\240\003rp\360\307\372Ct\251\275\220Z\343\370\272\2056(6\330"
+	.ascii	"\353$\241\234\030\271\202'\034D0j\306\310\177\260\324\025\001"
+	.ascii	"z\261\262\3272\245\352j[\b\304V\264\327\036\004i\353@2\017\017"
+	.ascii	"\363\006Z`\242V\332:\002\312\032\237{\265\375\t"
+	.text
+	.section	.gnu.lto_serializeBoxNamesReply.66.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`3\r\rC"
+	.string	"Zs<\031A@\244Nc/\022F\342\035}\246\355\275\353\225\2248J\343\376\2710\"\354\332[Q\346\337>\007\276TH\373'w\250\260s\322\307N\247\337{Q\322P\311\320vH4"
+	.string	"B\221\226\364&{o)\223\f\202\001k\001\201\001\360\330\2043\330\312=["
+	.ascii	"v~\315\323\344S\013tQy\\M\216\303@\240\304!R\271A\026\356Y&B"
+	.ascii	"\347\323\374L\376\224)\2203\347O\363\002\007<\216Fk\331\025\205"
+	.ascii	"\305F8\311{+\3613<r~\317\356\234\267\362\245\371e\3169\037}\231"
+	.ascii	"\255\307\345;\267\013\352\242\211Bh\020\206\341\346\331\254\301"
+	.ascii	"=\273\\\231f\234Z\347\374\267\217\331:\231\036G\202a)rt0\034"
+	.ascii	"\215\312O\356\331\034\275\262=\353>\331\236]\340`+s=\272&\366"
+	.ascii	"(}\300\316Ta8*\265\251\0305\233m2?}\215>\027Y\256'%\221HGF\307"
+	.ascii	"\"\243\362-\022\335a\313\256[s\345w=\311\212\034':Y\345\310\266"
+	.ascii	"#\255J~{]\036C\333V\246\023(k\276\307\246\217\036C\327\374\236"
+	.ascii	"h\243\245)dg?>\206\232\001\256\351\"\277\177,\215\354\354\306"
+	.ascii	"?\253\\\271>\231\3159\362\030zeU\366E\321s\251\025\375\256\303"
+	.ascii	"\037bn\217\241MV\b\204\006\353\316\306K\027\247\22019q)\215l"
+	.ascii	"\311\3355\271D\316\316c\350\222\025\312\016\027&\247\373\322"
+	.ascii	"\026h\231\036\256\007C\b\3578\006\266V@\363\243\355p\276t\253"
+	.ascii	"%\311\331u\302\230/l\307\261\037\353\216\233\302y\234\353!c`"
+	.ascii	"z\205s$@\251\037u,\311\367\331\374\351,\357\2550\215\214\311"
+	.ascii	"\365\320\002\f\303Y\207\215\221=\003x\316\177\223s\366\221\363"
+	.ascii	"{\027\317\026\236\272\320\211\353\321ra\030\206\220/\370<T\371"
+	.ascii	"V\316\346*\030\372a0\332\263\337\025\360\324=u\242|\272\237\310"
+	.ascii	"\2640n\"c\253\333[\215\002\233\257]\322\364tP\334d\200\366\324"
+	.ascii	"\205\362\245_\341\320\252\177`](\347\250\227\336j9\177\315\203"
+	.ascii	"6&o)9\263:;\243\\\235\241\376\367\334lu~z\374\354\304\352\214"
+	.ascii	"\240\311\325\371\300\363\236\r\264:\027`b\036\357yi\371\300g"
+	.ascii	"\245\223\371\007d\235\225\327{N\272\334s\022\211\324\352|\344"
+	.ascii	"\352lT\324\371H\324\271\350q\317FW\347\267\325\271\330\352Lt"
+	.ascii	"uv_\235\207\257\316\355\2533\373\352\274\026u\336D\235\265\253"
+	.ascii	"\363\245\224kfN\242Tw`\024\026Kd\b\256\303\326ay\374\377\375"
+	.ascii	"x\177\336\037\370\353\375r\177\334\335\234\317\244\304\231\357"
+	.ascii	"\344\227\251,\360\306\n\266\274\036\356_>`\234\357\327\307\227"
+	.ascii	"_g\302\221?\2637\330\231?'\237\316\367\230\272\352nP\001\313"
+	.ascii	"\210\314\235Y\302\024$g\320Zu\315\363\362\343\3447o\2459^>\234"
+	.ascii	"\255\337\345\314\343n\362\337\f\313 \372\002\303\360{\326\356"
+	.ascii	"uZ+\\\006oA\263*\223\240\263\325\267\253\323z\024\026\273\027"
+	.ascii	"'i\336\252g\363\325\035g~\233|:<\316\234\347\f\311p\3172\365"
+	.ascii	"\234\371f\362\3310\371\344\362\335\362+\032\f.}\221\252$~{\267"
+	.ascii	"Z~\251D\246}6w\253pdt\363\311=$\257D\244}\351\335?87\335<2\271"
+	.ascii	"\211;\303\236\273\211\371\2114\254\225o%w\360\240=lb\331S\311"
+	.ascii	"\024\251u\241\234\334\227{\363\020U\254\270\325r\025\216\217"
+	.ascii	"\313\334y\035\"7\022\323\276\034\324\223\233\351n`\203b\244\375"
+	.ascii	"8Md\356\307\r7\363\267j\333=d\367\272[\344f\367\367^\367\016"
+	.ascii	"\004\206H\200\326;g\020!\364\303\366\276\021\264\257\335\225"
+	.ascii	"s\026\361B$\334|B.\267\024zG\341!\343\022\302\325)\3743\200\313"
+	.ascii	"\023#\356V\333\340\027g:\327\036\320\037\347\036\244r`s\253\201"
+	.ascii	"\215\340\200\216`cI\215\323B\b\366\347\360\362~\272\023\007\341"
+	.ascii	"\242\205\203\317\341V\313\016\332\330\246\315\266\355\357\371"
+	.ascii	"\322\036\322\314 \370\245\t\261\\\322\226\366\361V\030\206\341"
+	.ascii	"\266i\037\357\313k\265K\273i\037\210\231\227N\224\357\300\224"
+	.ascii	"\344\355"
+	.string	"\301sc\267Z>\260\277\261\244x\2764\241\374\273l\342\203P\260}v\2520\374\365@P\212\267\313\316\027\302\007\372]\216\366\354\201\035\200\215\214q\332$6\260\237w\025h\317?9\f<\214\313\313\375\244\200Z\203\341/\b}>\250be1\325N\265g\rl\035(,\311\322.\260\3313`\210\342,\331\204Y\332\350\326\255\226\265\332\343\235\004\234\337\2758U\022\277\271[\005\003-\004\004\357\333\0055\252fl\027\035v\\a\250\322a\225E5\365\356\270j\261\255^\2255\345\302\312E\215)*\342\216*\0275:\354\270j\341\316\230\312\272\032\021#\013F\215\252\017<f\330\250\302:\312/\022(h@\245 \302\003'\200,\034.v\246r\356\270j\301\302\006\016\032,\250^HQ\275\220\252a5EC\212\n\013\207\224s@\276\262Q\205%\225uu\205%\365F\237\337Rr\013\3106\235K\376\\\355\245\347"
+	.string	"Hd:\367\346s\265J\345\316\026\236\333+\t\271\334[P\331|R\322>2\332GH\214V\276\264\244}=%\257\270\300\344r_/i/\345\374nag\032Y@Kx\276k\301p\211\371\261\273r1L\254\225v\321\346\202\273\240\037\226\227@vW>R\301(\355\007\036\267\322\326\207\212\216\273\207\026K+\332Mw\356\022\332e)\272c\004\017\251\317\b\260\250\271\235Nj\227\330\271?'\376\343\373\367N\034\264\203\026\016>\217\216Q\233m3~\317\235\n\357\344\347\264\037\273\tT\007\221Q\324~\374\345\263z\247\035\345\247\277\204U\351\034\241\366\333\227M\350\"D\364\220>\250\346\376_\237\026\322\2273W\233\016\242\301\232N\373\tPS\317\376\370)\332j{\376\330\257\257\316\273\317\367l\301H\345\022\303|1n"
+	.string	"9\235\233@+\241\277\264\327\273\235x\352\236{w\377\354\340B\001\202w\240\030\277\313\364\320(\327\"r\033\215\273\270[H\347\020\320\003v\316\0328\350\207\025w\201\f\250a0\005\031SjFDD\222$Ica\005\304 \347\234\325\003\022\340EA+\246\241\205\005)\264\377\006-\324)8\314\371?\035\260n\330>h\235Z\250\315\033\234>\2413@\032\345\335-\216\266z\035\3744\330\032\261\020\224\351\0202"
+	.string	"\035\203\224\2616$\310L\t-\374<\375\231\025p]\363\346\244D\346\032\237\303\360\337RI\031z\312\230/7>p%\2173\345\007\202|\320\340k\267["
+	.string	"\347\325\255\317i\"\2457\372:?\237\247X\205\324\355yQ\363\263\021[\321\377\306\252\022\355W4B'\002@\031\352\0312\340\306\251-\373\332\362Y4@\021\017+\366X\320\003\270\344\247\234S:\371\360\371\037KT;\216\031M$\336\315m\346\311\262v<\342\246f:OD\324\227\217\267\302\264|\261\242\217\230\016F\036qR\365X\201\017"
+	.ascii	"\276l\330\253~aK\230\270\r\331\200$\033#\321\341:\223\340$\023"
+	.ascii	"oaH'\221\r\262\027\360\211\256\251X#\265\262;4'\360L\034\340"
+	.ascii	"\276j#!?kU\344\263t\025\270\211\321y\317\332\231J\002k\211a\361"
+	.ascii	"\001\317c\267\300\235\231\221\305M\232\375.<{\206T@\353\241\032"
+	.ascii	"\270\035\030\fO\310)\233\336\223\237b5dt\031/\002\340&WQ\361"
+	.ascii	"O6\255\204.\354\277_F=M6\005R\242F\250\004\255\333K"
+	.string	"[\320"
+	.string	"\035\203\330z*\002~\202"
+	.ascii	"\274\220#*AgW\243:\t\340J\n\333\325}\246Kr\302u\251Q\252\243"
+	.ascii	"Pw\221\227\220\035~\207\030\221G#\333\016\274\350.3SId\203\205"
+	.ascii	"R\362Y\250\237ze\3470*L\334)g\352\3726j\241\320X<\005\316/\034"
+	.ascii	"B\213\343U\nS\335\323z\031\263z\202\371}.\252\361\346\2033!h"
+	.ascii	"\377\227\f\316\314\204\030T\356!\230\331\350\262\222\341\270"
+	.ascii	"W6n\254\224\002\3202B\0179E\206\366\244\033H\016T\222YDhJ\230"
+	.ascii	"\371\032{\177"
+	.text
+	.section	.gnu.lto_serializeBoxReply.67.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`D\006E("
+	.string	"\352H\340\017Hp\334Q:\2338\302\322@\210+\352\364\355\242&\213>\364\367\206/<\t\204\345]Y\260\345\343\365\314%\3326kd\"\346~S\247\274\270Z\353EM6v\351[\220\357\257\214\277Z\271d,V\001\377-\242\311&{'\031\352"
+	.string	"\334"
+	.string	"\356"
+	.ascii	"Z\rA\002\323\255\004\205\232\224yJ\304"
+	.string	"U\227\244Z\316J\242\343\356\360*L\335\271\343\347\272\207\244x\267\335O^\212\360Sj|\227s\020.\260\234\225\rz\201z\334\312\007H\217\325\007\245\307\302n6W\022\311\337:B\334R\3139\367\356\020\"\242\264\027\034U\276sWx]\016wSyR\214^+\354S\371\220\2216Ec\323u(\017\324T\326\313\250\256P\nlia\357r\2629!U<\2163p\263`\204+\271v\254\332q\025ep\326d\307\313\250t\240A:\274\316\376u\003L\250\254,\017\372(lN\037#\021\315\200\005\n\353\315'\233.\301q\214^\220\002\245\210\217\021\n\275V\226\317?o\243\214D\2136\2773\243e\266\032q\374\276\353\030\231\345\346X\305\343\226GC\316\271m\321X\365\356y\367qw#u\3435\030~\fm[\277\353\250\223\243]\305\224e\333\326\255t\262\027\331}4\315\017)}\203t\243\266\201v\251m"
+	.ascii	"w\276\177\260m\2373\337=\272O\371q_\337)\266\215S\333(\266}S"
+	.ascii	"\3336\265\375 ;\246\013\022\311=\243\314Sw\350d2\034\226\344"
+	.ascii	"\314\337\371\257\277\335\357/\357\354?;\327\302+g\366\233\302"
+	.ascii	"\213u3}K?\214\307\3123'<X\020\315V\371\252\301\";\200\306\303"
+	.ascii	"\366\\\300\202W\346\251?\271\342J\252\035w\n \274\276W\377\353"
+	.ascii	"\310\353\326\262\225\304\204z<\224\203\327W\366\273\206\254x"
+	.ascii	"\347z\026\341\327n\n=)\263\361\002VZ\262\204z,\204\"\310\274"
+	.ascii	"/\177\245\217\005A\023\026\246o\321x\266Au\213\322\362J\013\241"
+	.ascii	"\036\037\210\303\373\225W\351k\035\220\303\353~@\272\325\r\320"
+	.ascii	"\275\026\246\363B\347\362\177\375\226\326L[K\033\362\\dK\300"
+	.ascii	"\302\273\213\261\356\303\274\347F\021q@{\262l\270\311\261\347"
+	.ascii	"\236\211\346\234s\272\273g^\350\301\264\347\356\356m\370pj~\327"
+	.ascii	"$\346\350\262\306\231\205/\262\001\334\337$-4O\226\255/\326E"
+	.ascii	"?\363a2gj9?M0\363\3135\235A1{\231\213\321H\217\001\334\001E\246"
+	.ascii	"\350\226<\312~\356\235G\361cH\206F\202\027\215N\366c@$\347'\n"
+	.ascii	"c>\306\002Ej\221\266H\217\177\256\225S\304\321s}.\336\"\332y"
+	.ascii	"\376RK\0357\216\022,0\364\";\230\236\371\021\315\213\035\267"
+	.ascii	"\314Q\026vU-\n\325\032\234|\317\345\255ah\333\222\016&\250\346"
+	.ascii	"\234)\364\275\374\213\213\376\221\343\006\306\260/\306H\217\177"
+	.ascii	"3\240\t\033\332;\375\257_j\035SPU$\354^dG\037\226\200\033~3\220"
+	.ascii	"\224|E\271%\240\321E\372O\251"
+	.string	"\350\b\351\350E\221\357\266\364;z\361a\th\244\366\n\007\017\"\370\036T\230\300\023\240$\343\350\266\217\267\0044R\001C\206\013\025\276\025=\337\212\336\013\244\"\027=_\222\214\036\217@\003a\374\222zJ@`R/\247\034&O\345\352\332F6\274NI\335Evn\305\351\356E\263DOoTwwz\361\3450\006\275\370\376k\316&\330?\322#HX\022\367f5\264w\306\216\351\375z\242:\353TNw\2772xzu\317*\212\261\270 {/\356v\237@a_l!\250\333\324\366\336{-D;\335*\216\346S\373f&~\366\026@\263\316!\320\244\307\215\333E\222\311\272\362\221\357\261\377u5\316\223j\355M\266m\317\215IQQ/\322\203\231\227\345\226\364e\377\363 \264\274\210[\320\237\013t\243^\366}\250a(\305\230R\212\224\314\210\244\231&\351`\002\031\252\262z\020hW\243\244\315-\373q"
+	.string	"\360XX\202uD-\315\021\004\255,\003 kSR\034\3345\360i\212\025\035\346\274\252-h\3156\254p\321\272\033\345\335\361\237\323+\034d^"
+	.ascii	"\266\325WA\263\003\220Uk\"y\f9\312\262p\325\215\f\261&\2501\334"
+	.ascii	"\211\242\356\204\200`\203R\221\241\b\300!2z`M\346\316\356Wh>"
+	.ascii	"W\360J\345T&Y\270\021\020YL\023FoP\206<\231\236\027~\231\201"
+	.ascii	"S\2604\236\203\242\301x\370Nc\230\310\303\342\264n\004[\260\275"
+	.ascii	"\230\336\340\353\361I\353}\033\210e\027\211D\252\332SP\\\212"
+	.ascii	"\023\356\023\036\035\022\004\005\362\272Q\t\016\nAq\372fkT-\346"
+	.ascii	"3\372\017\251\3363\"\b\344\005\322\374U\351\233\206LZ#\274&\332"
+	.ascii	"\307\357\316\347z\251>\016\013L\036\220\274j\335\2029A~\001\210"
+	.ascii	"\371B\370Z4\307cL\2464eC\005"
+	.text
+	.section	.gnu.lto_initActiveBoxIds.68.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`o\036\305c"
+	.ascii	"\212\235X\"H \320RI\007\016+N\177\034|\347\264~\002\255\251\363"
+	.ascii	"\272MF\377q)\270\320\203\007\217\240\270h)\336\314\n}\212\300"
+	.ascii	"K_u\210\f4\244\271\205-l\360\005o\221\250\004\200\004\324\313"
+	.ascii	"3kED\304j\225l\"\223\224\001\372\001\307\001.\002_3\364[v~\311"
+	.ascii	"\316\357\362\337\261\372\025\3737\254~\301\352\367\253\277\037"
+	.ascii	"\316\257\327\371\355\352/\327\277\036\352w\253~\265\376\355P"
+	.ascii	"\277Y\365\213u~9\234\337\253\1777\324\257\325\277U\365KU\277"
+	.ascii	"S\375\225\352o\324\277P\365\373T\277\312\177\235\352\267\251"
+	.ascii	"~\231\316\357\322\371U\352o\322\277H\365{\364\257Q\375\026\375"
+	.ascii	"K\364o\262~\207\376E\353\267\236\337\363\374v\177\377/3c\227"
+	.ascii	"\226)\031\f\262\351=\210\351\222&\r)c]\354\262\273\314\206|\310"
+	.ascii	"h\326(\213\021\221\317\233\013g\256\310<\232!s@\222k\026\244"
+	.ascii	"\t\2634=6s\004\013\tb\272\244\004\231Af\006\245)\"\030\327\375"
+	.ascii	"Jr]\275]?\214H\230\362\232C\2775\203\3224]v\007\254\307kjihg"
+	.ascii	"fed\3131\2610\260\257\017^]"
+	.string	"\\\036\266\264:daq\270\332`UE5%\025\005\365\244tjbZRJB:2*\"J\016\241\365\354\353-\017\235 \372\003D\302k1\260Z\f~\236\006\003\243\275\3603\030\\\270Y\037.\353\343x\262\241\023U*\340\303K=<\246'\205\213\361\311\3630<\f\206\347\316\277\354\360\007;u\356E\207\273\350(\236\213N\342=\320)\341[oX\353\215\233wh\303YmH8\326\0336\347`x\370\253C\336`x\346V\206f^UX\346Tex\252\020\204K\025\222yT\227Cq\371\023\357ua\245\226-w\322\222\345MX\230\t\313\022\030&\204W\242r\345I\215L\260L9\222\024>\222\222\301\215\242pQ\024\242\363i\t\227?nd\002\345\374z\204\003\311h8\013\f\023\f\236\314\252RA \01752\t\364;\n\206I \005\200I^\237\360i\004\330\367N\002\204\340\304J\323\224\321\360\225"
+	.ascii	"\362\375C'\3224\335\377\001V\300\013\202w\317\250\335\275\333"
+	.ascii	"\245B!i:#\251\323\3124V\2527\336\323BQ#\035\365\n\374\007\250"
+	.ascii	"\217\304\244\360\203U`\034j\2433\023\255]\324\247\fI\246\360"
+	.ascii	"\205\3417t\234\207\t\205G\214PP\355d\263_\2417\\{\2509\311\024"
+	.ascii	";\265\273\256\004\036\271\371\322\270\315f\263\320\331\203\313"
+	.ascii	"9\320\263\031\222s\240\335g\263_ \337\233\273,\207Q\310Q\303"
+	.ascii	"\206\r\224k\367\330\225\300\2757\231\233\315&\r\275x\350\273"
+	.ascii	"MM\237\276\317\260N?\347@wu\3608\377\275\317\004\373\032\311"
+	.ascii	"\336\r\225\306\3350Vd*\371\244i\n\"\261\213P\0203\023]n\303n"
+	.ascii	"\230\313Z\326\r\016\016\345z\312\371\003"
+	.string	"\264\367\346\032ap7P\032\217\376\305{\007\345&\257\034\224\323\260\bsI\204i\272\307\177\313!\360\232\270e-\\Wn\356\374\307uy\016\345\272['\344\374\267XI\032\311*\353\bF\002JOh\027\221\357=\270\313\335l6#\267\255\354\246\377\352\375\233\367\357\221\372}\340_\007\352\267\201\372\305\373\227\201\3725R\277w\375-\362/\221\372\035R\277v\365+\244\277A\376\255\253_\272\177\347\352\027H\375\312\375\273@\375\306\325\357\217\363\353\343\374\366\370\027\256~\337\376u\253\337\266\372e\376\253@\375\362\250\337\035\375\325q~\023\3707G\375\"P\2778\316\357\215\363k\343\337\003\352\267F\375\322\250\337\031\377\312\250\337\030\347\327\200\363\013\343\337\002\352\367E\375\272\350o\213\177\t\250_\026\377\016P\277+\376\025\240~U\324/\333\277)\3527\200\372Eq~O\374k\242~K\324/\211\363;\342\374\212\250_"
+	.string	"\372\033\242\277 \372\273\326_\265\363\233v~\321\372{\326\001,\242Ot\227\340\027\310W\330\201(\275\tL\253+.I\264\211\022/\201D\227\270\033\022-\226\224(\246\231\345\205\216h;5\216\214i\312^\250\210\0361\202\210\346rL\fS\003\326\0060F\362\362\247\320U\030s\332J\300\030mF\303\311F\275\346F{\310\t_\332y\315\275\367s\302\367\345H!3I\016)P"
+	.ascii	"vQ\\M\212d\232\366\251\355\321<\215\212\025,X\240\\\001h\026"
+	.ascii	"\344x\346J\216\n\033\354\331\020\242\0332D\037\t\376y\264\232"
+	.ascii	"\002\343\005\366P\340\247H\025\306z\255\004D#\201YD\020M\304"
+	.ascii	"\030\351%\221Jz&Y\265\326Hk\215\346\241Za\t\033\r\246\324\272"
+	.ascii	"\325\272i\370\303\030\371\330'\325\203{%\030s\225=\023\370)B"
+	.ascii	"\205q^+Ik$.j\034\3010Z\247\025\242\365\037\245\244\311\333;\222"
+	.ascii	"L\302\210lBp\357\204\212\bE\235\265\222\313\255\360\356\214\263"
+	.ascii	".\222R\233\302<\t\003e\326I\200\314z\350p"
+	.string	"\2151\2060O=\310\r\331\202\030Ae\017n\013\264\254\217\252L}\027F\214\363_Y\243P\004\371\234\310Z\311ei\331d_\226\335\202S\266$Fi\222b&Z\345\\\266\200\365\230X\226\257\026K|\322\310\034\374\n\341W\207}5\030\007_\211M\266Q\314\tM\230>t\022\226t\306\207\036\212\322U\217c\352,y\365\021\230dW{]\203\256f\024\276'\030\222\351@\211\253\357\347\344j>Lz\"\340\220\007\317\340Q\264\332\303\326\241h\365\326/\320\"\204\324\305L\024\204;y\023\254\356\220u@\254\316\372\022\254@G\034\272\355\2529|\202\253\206r\374c\204\262\375\357\022P\365\006\253\373M\265\325\235:\300\373\3167\325USMu$Su:K\232\021\026\213\244\232!\223R\315\200\2043<&\022E\361\"G\3159e0!\246r\206.eC=\rR\366\023\244\262=\\\tt\023'\251\274\301\201"
+	.string	"1\265S\323#S7\371a2\034\352A:\274\324\3472\207\225z\351\005\245NC{0\016'\245\001vuD\352\354\342\210"
+	.ascii	")\362\242\311\016\356\007\021\030xoL8\031wL:\244\355AV\206\346"
+	.ascii	"V\026Bm\f\312\007]\034]\235\234\033\234\2147&\034\233\221: \002"
+	.ascii	"\3341\351\224\3536\306@]\033\217 C\346x\270\365X\272\365X\322"
+	.ascii	"\3051\347\226"
+	.string	"nvC\226cU[\027\004\316nI\244\256\316ni\204\270\307me\253\024/\221\217{\315\267M}\315\250\247\201>\362@\036\274~ OcT\004m\247\016^;\200\327\r\314\301[\274\263\306DA\237\020\347\256\0310\002\347\256\215(\336-\306A\242V\004+-\002\347L[\262\240\333\220`\327D\206\214`\327C\326\330-\026\246i\232\242\t\351\203Q\323\347K\253i4\235F/\214\030\2751cP\256Bz\304Y\220n\013\322g\202\213c\224\004\333\fSY\246\013H\327\321\025\3125]\237r\222L\341k\222F\0022\262\322\0370\225b\272\344zN\256\201t\030\271\310\246\331\024\226\366\322\345G/\020\267\345G\307e\371\021\250Y\346\343\f\367h\037Wz4\224\243\342\237&\231U\236\007\315A\017\2665\334[o\300\3547E8UdZ\260\2510\333\215\331mR\230\206\313\2443\215\001\323\212\020\312\030\237\035\255"
+	.ascii	"\217\013v4\217';:L\211\314\230\216\266KS\035MBq\214X\002\335"
+	.ascii	"f\243\023\350\303\340\027\310'&\254\210M3Y\202\243s 0\001\216"
+	.ascii	"F@\t\016*"
+	.string	"`=x\022\370\006\037\033}\243#\260\321%\034\003\025\245|m-6\004L\250\356\023\243\321\007\324\350=\032]\243S\032\212\200\205>\364\340C\340\031\335V\370B4\274\006\2752z\206z\207z\207(\327\031\035u\345\314^\263\006/-;\217d^}P\032\241 \0311 ]t\214\256\211\201\276\246\340q\322e@s\025\030m\200 \030}\345\370\007*\257\361\177\036]t\001/\374\270\350\027/\270\320C\310\325\242\355Z\264\b\301\243\304<O}\316g\317\212&\200\005\013l\315\242\216\223\2377^\005\025="
+	.string	"[\257\230\223\004\364\024\362\260\265"
+	.string	"l\255\342\016\233\034E\017=\270DyM\024\247\267\274\362\006\235\316\034\024\235\""
+	.string	"9(:\2008(\312h\235h;5}\252\004\202x\250\302H5 :$\301\210\210H\222\202\202\2445\322\f\b!\nJ\212\235\007\022"
+	.ascii	"\202i\224HQI\215M\222B\017\205\252\303\315\320\217Z\020t3\334"
+	.ascii	"\375\223\263\fE\366+W\026\252AZ\372\241\311I\244. ?a\3376\033"
+	.ascii	"\202Q7\264w%\241\f\277\314\301]B\345 \374(kz\230"
+	.string	"p&I\275\321\fGT\217\005Y\274x\213-\r\301\244\026H1\301<\321\301J@\264D\357\267\366\262\210\035\256\312RU\230V\263p\177\313\3524q\263.\225\347\214}\205\325\f\352r\2103\267u\272\215+\0326We|\374R\017\271\377\346\3000H\334\025dh\232\035\377\005V\273\215;us\346\031\225\236;E\035\342@q\217\216\004\253\256}{yy\266\035w\200U\261M\004+W\321\264\350^-\031\372j\244I\244u\344\230\235\265\177\341^\323\026\006\272\251,\016\031\313\326\236\340D\205\305\275&\\\357(\207'\225\001x{\301\244\226\276>z\341\270\034\214\277\337yA@\314\231\207P8y\367\246mPM\210\324\324t\034\360\202\263^8\366yz2\315\320\266)\006s\231\364\001\257\263\361\250\213\223\225\320\335@;G\\\330.\276W\204\374\366\326\234\r\365\363\325\270H\340-\240\377\241\276\272\274\221\320~"
+	.string	"\236\254&\203\025\331@\243B\345J8\032\020qu\024:\036\271\0300\020\202\245\226\363\3426\357l\341\204\370D\206\254\007\325\b\210\270g\332\357\256\254\230j\235\363P\177V\3039\002\303W\321\317\236\005NYX\277\006'\376\0240\007\fe \371yL\204t\323A\245Qy\222Y\224\264\034\261\330\373\213\026\344\343u\365\231\260\337\025-\231\356W\335\252\202\034k\352\220\323\002K\203c{\256\321\225\004\357\201\026\025\254~\261\262\371\361\201\b\327\001\321!\224\003"
+	.ascii	"\200\254\b\306\256a\354\"\017>R\231\357!T\206~\2679\256\272\376"
+	.ascii	"\301I\006s\035\304I\254\305\r\037K\365\"\223;\025\030G\275\343"
+	.ascii	"sh\361\315R\267j.F\310\365R\316r\356\3652\212\346\214b\221\t"
+	.ascii	"G\307\252L#\262\024S\244\205\242G\f\202\200"
+	.string	"\262\236$\367\320@s\024\303=\032+\327\263&><0+@\217\202\026\2343\213\236\2757(\bk\346X\032\356\034\001KW\212\007'|]\211\206W\233\265/\325\027\344n\210B\005F\240\305\306\267\034\206\334\262;\265\250:\244\n@*-\264\212f\226 \302\306\221R\315wol\354%\302\222\032\244\267\337q\021p\247\0022V\222\fk\025\243b\2409|)\354-r)\214$\241\247\224\313\240\343\226H\211\370[H\212<\3700p\325/U\362\373\302y0R\226o\305\303\021\220\027\277\202\271G\260\004:\264\202\253+.\270\013P\345p\271\252\213v\237\300\324\240\346R\225\001a\370\242\362\275\212\272\234\007\204\206^Nb\004r\"\244\353 5\333S\325@\260\340\377\007\003Ex2h\350ctB(V\021\350\257i\02075N \024\230\004\252\305\344\256\312\242<'\246\247\302\324|\273\237Y\026\004\264|\255T"
+	.string	"\020m\335}\270l\2366\030\035%\305J\365\260\3101a\265B\235\326\t\020E\264\235\332\317\206\265\370"
+	.string	"|\035@\021(\252\346\262;\321\362\212\252\001\272:\212\374jL\340\376u\254Dj~F\202/\303\360v|"
+	.string	"\262p\233u\346Z\371\316\324\274\202W\346\254\372\226\221g\361\340J|\242#+\234\246\3631\013\003\260\346c\246\345>\265S\312\020\245p\360z3\006x\211\207\035B\346\003\324\013\340\377u\376P1\332.\242e\030T\307\265\342gj\303\363"
+	.ascii	"\312 \272C%\225\262\222\rv\247\005"
+	.text
+	.section	.gnu.lto_packBoxModeFlags.69.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`G\035mM"
+	.ascii	"Jx\370\032<0\340J:3\324a\032GGy\344\257\034\315\0318\005V\230"
+	.ascii	"\203\371\215\003$ns"
+	.string	"\032\201\230\305f\342|\214\n@\215H\300\210\232,n\212\233\006\253\277\340/\370\253\254\265F\310\2262\005\243\001d\001\263\001edcba`_^Qh\027\327\226V\026\326\225U\025\325\224T\024\324\223S\023\323\222R\022\322\321\323\331d\327\333xgg\002\257\312@R\276<~uu\356 \"\2505\325\313\262\306%\302|dE^\223L\365\256\364%\245\356Db\341\277Y\3150\035\013iM\365\260\254SD\004\245TS\275\300>\2443\201\"{ \034rd\032E\220\377h\205\357X\305J\277\221\312w\363G\3553\372\361\333<\361\353\263q\302_\323\304I\177\221\t_\315\022&}\305>~\"\221\276~\232!|4B\206\364\317\004\341#\002\t\322?\224\362\315PM\365~H\373\206\353\221i\024\037\214 su2\325\363\321\007\032\261\001F\215\272\300\"&\240hQ\313%\342\001\210\022u\334!\026\020\350P\007"
+	.string	"\304"
+	.string	""
+	.ascii	"\375i\270K~\273\364\323n}\270\255\017\237f\263\3445:\226\255"
+	.ascii	"V\311i\224\225\2156\207\317\346L\266\231\034.\223\023\247\311"
+	.ascii	"\340\360\030\0347-\306\310a\214m\032\214\r\177\261Y\323^\213"
+	.ascii	"\034]T\323PE\356*Tl\2562\274U\206\260\265\310p\326 \231\306\032"
+	.ascii	"\303Wb\306\264U\030\256\312\022\246\251\004y\n\213`K\005r\324"
+	.ascii	"\225\300\206\262\302OV\252\264\023\225\233\376\250\315\344\307"
+	.ascii	"KO\374Z\311\t'q\331krg\317I#1\341#&Q.{K\372\031\235\026\351c"
+	.ascii	"\347\235\275\276\036\335L\302,\217\035\275\036\341\313\304\247"
+	.ascii	"c\205\266m\313\210\334@\370\364\272\235\t\332\266}K\371\212\360"
+	.ascii	"C\360\337\364\373O\342\257B\020\255\3507\314\353\013\370s\034"
+	.ascii	"5\021\346\257\224\237\247p\031f\236r\"\037n\355\2775\373n\317"
+	.ascii	"~[\263\317\346\354\2575\373jl?\215\355\243\261\3753\266o\306"
+	.ascii	"\366\313\330>\031\333\037c\373bl?\214\355\203\261\375/\266\357"
+	.ascii	"\305\366\243l\037\272\366\273\326>\327\332\337Z\373Z"
+	.string	"l?\213\355c\255\375\253\265o\265\366\253\326>\325\332\237Z\373Rk?\212\355C\255\375\247\265\357\304\366\233\330>\023\333_b\373Jl?i\355#\255\375#\266\377d\373N\266\337\\\373\354\332_\327\376]\373\275\366\231\251T\311\261\203\301M\333\022\311\\\324\326a\037\263p\"\363a\024Q\356|\346\254\370\244\350\0314\234\006\217\023k<\363\366\236\213~,1\333\326p\304\223Y\350\312\214\370\244(\03096d3x|x\343\331j\201P%\021f\333\356\2351{\rOf\273\321,jE\216\373g2L\210\307ep\360S\333Jall[\303\264\233=\231\275!O5\231}rT\223\331\343\375\200\330\220\332\262\232C=\320\034j\333v\355R\271\031\257\206\374K6\036\277z\311G\376\315!\377x\3077\336\315\031\337\346l\276\346\213Ws\305'>\315\321\374\314\021\177x37Dp\300@\001\002r\003\342\004\004"
+	.string	""
+	.string	"\367\346\326\306\266\246\226\206vf\026YPE\001\004\265\250\205"
+	.ascii	"\272\236]\210\340\2560M\276qq\031r\243\322\261\304\212\323\266"
+	.ascii	"\325j\335-@-Bl\035\205*\217\230\265,\252,J\265\376\223\3223\230"
+	.ascii	"\206%\2055\211\326\204\032\265\007\362\354\252\275\212c\326}"
+	.ascii	"\317\313\3102+'\253*\031\022\352W\240\311\261\252\266*R\254\310"
+	.ascii	"Q\030\025\224\n\022L\r\217\345 \312\257\251\347\224\243W\013"
+	.ascii	"\241\003\005\250\032\225Z\243\256\224\224.\352\202\025B\333\307"
+	.ascii	"\323\036\302.\250'(\302\313\205\026I\245\264\374\333z\222d\247"
+	.ascii	"\373\324z \234.\327\240V\347QR\235.\013\263\232\234\232\304`"
+	.ascii	"1\222\2446Uv\271bjb\002c\205\250\272\224GL\325\322\322\222\027"
+	.ascii	"*BUK\245<b\246"
+	.string	"\224\224\224\272H\t\262L\332C\030\225\224\224\264\005\352\017\025\351\022\362\t\251\345\032\315\243\213\324\347\350\317\311\262r\f\020d\323s\354\371\204\t\217s\351\002V\262\323\351l\342T\2523\207\332\324c9\370\244\013x\031\315\346\265\021\325M\026\321\374G\224h\2266\257\006(:n\336\022\244I:T\026P\365\210\275!\253\344\tg\r\344\\\327\025I\363\002>rde\363#\377D\262\027\260\221o\337\273\266\351\321\247g\244\355\256\027\220\347\232\377\323\030q\216)-\333\266\215\343=\324AMG\326:B\030\346\326h\366\235\201\330GG':s\215&\337\276\334\243O\2573\177n\303\2145\316\201\247\253k\2262{\256\273`|\372rt\346\001L%\371\224\332\214?\331<c>\303\210vLT\351\257\202E\263\364P\0367\357Q\205\032\222\320\2356v\f\243\216\306\335\202\272\031v1\350\346\222\216\202\255\r\216\256m@"
+	.string	"5*\030)\346V<\250;qg\201\306\335\002\0270X4\235N\215\306\235\211\022.`\260(A\207b\215\016\305Z\013\2739\026kt/`\254\251e\375\316E\335\213\265\030ww/\326\222\f[\276R\016b\262N\216\253\367\033k\333N\021\360!3\"?a\036v\346A\\\300/1\361\300S.;f\00372\334\005\002w\337.\203J\267\373\326\203\232\320\034^\241\202f\251\202&\263n\367\b\021\334M\220\243\025\361\332\266m\373!\221\241n\030\356\362\224\313<\374\340\252\216\355\201\253\341n\333\375\035@ "
+	.string	"e\307\315\373[\320\335SBcRx\266m\033\200\331w \034c,<\003q4\231m\273,\032i\022\246j$'\311R\350H\207\013\370\271&\333}\001\205\021\331\256V\225G\265\273v\271G\243\034\235\231\244\375\314=\337|\272\317\215s \263\307`g\327dV\355\212\361yT\252B\336\304\352\016>\016\027\220\023\031\004\224\034\255\350^\252\032\237\323\333\325\302\ry\310\002EjH#K\363\222\301NU\f\017\030\fhbh].PV\303\360\200\261p\026v\266\245B\2349`z\006)\230\201\231\375M\210\244c\365\247*\241\254\252\177\016\036\232\245eW\003\024\275'\021\036\275 \220y\2215y\300\030u0\026\035[\322`\021\312@\f*\246dA\232.\005a]aH\022\034r\351\031D"
+	.string	"\306\005V5r\240\314\226\236A\003_[_U\276\002c\246.\013\txMye\312}\241\254\372\3438 Z\025e\024\307\3052k\017\241"
+	.string	"h\202w\250\202\200\036XFDDDD$)H\222\016B\016\b!\344Tq\033\022 \262 \016\263d)\235PP\3400\354\006\031$;\371\342\254\264\244-\315.\b5T\3400\224\333 \302~\233b\275\324D\370@\272\311H\205X\347\325sP\036k \212\343\347\347iA"
+	.ascii	"J\310\212e{\224\306e\320Bj1\322FmSQ_\240\007\024\333|\367\\\335"
+	.ascii	"\366\2261\003\202K\314lA\307\245\311K:\372\234\324i\354\006T"
+	.ascii	"\001\360\321B5P:i\254-\336\216\362\341\301i\277\031G\301\215"
+	.ascii	"\276liJIBe\237\203\"\234\315\244\242\214\204\277\204\361?\263"
+	.ascii	"\372*c\3659\346x]\324\374\211m\345\256{T'\274\261\240-K\032f"
+	.ascii	"\204w-\0322\nw\025\0172\202\373\024\0079!\250>\320\033e\377\370"
+	.ascii	"c7$\351A\375\320\377\007\230\177S\n\244ke\022\226\264!\257*\n"
+	.ascii	"|\030&_\316rc\223\225C\203kx\272"
+	.string	"\317\374Tz\224%\372;\221@\232\326\301\275N/\272CQ\232\022\245_\335u\337n\243\262\362NEL~5P\371;:z\354\303\2339\310-\341\022\224\335\024\312O&Bk\222\350\210\332\233\252\224D\003\2107<=\002j\321\327\273\024\277\013\226\221\303D^Oo7>|9\241\256\301>\324\235\373*\3165\364LW\247\317,\346`\230\022\360[~>\201:Q\004\366\033i]\325\376\365\\l\177\220J\r\026\002\236\323\340\225\220\004\312>\3017\202\236\255\206\225\022\304\320'\224\376\312\032pT\223\364U'z\211\210%a\351\346\320\313\364f\337\2759\026\202\331fD\342\347\371\035\213\224\376\320\3737\215\212>\261\346\302\240D\367B\t\227m\221\004\312\273\303\013[!gC\027\227\340d\022\025a\024|\237\337\224Q\251\037\270fP\314\023-(\310\326\313\0021~5\335T)\313\203\360!"
+	.ascii	"L\237\036~\225}I\236\362mNp\204\311,%\230{\023M\260\310c`\320"
+	.ascii	"9\2330$\343d\341\366\372dV\021\262B*\032\240\30214\265\2470m"
+	.ascii	"2\031He>0<!;h\b\307\376Q\331z\277\317\336\352\027O\322\270U\256"
+	.ascii	"d\320\210a\365\276\302}\361\235\261i)\214\214\225>\030\327j\374"
+	.ascii	"5\214\276\206\345\006\303q\356\024\265\253\234\361\022\177Y\345"
+	.ascii	"\030\227x\227*\347\270\210\277Tr\306U\274\276\250*\360\226$I"
+	.ascii	"\031\b\235\245\223\314\256\354dXSIn\"\257+\253\262d(\233\233"
+	.ascii	"\203\330x\037\005:\230\310MC\204\275\217\002\035L\344&\342n\n"
+	.ascii	"t\200%L\3164\"\271\233\002\035(\211\252\334 \334\007\024\360"
+	.ascii	"\350`\"7\021\367Q\240\003%\361\310\033\304\335\024\350\300W\273"
+	.ascii	"\2404S\202HP7\b\035L\374#+\212\304]\233\210M\013"
+	.text
+	.section	.gnu.lto_packSensorStatus.70.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\240\005\265\034"
+	.string	"\366t\264I\260\226Q:LdX\306\335\365\257\340UF\034'\350jnCa\020\363c\241\312\b\226Ii\002\034d\003\216\017\224\230+f\253\311\366\236i?\340\314\240\267\261\326\347\317]`:\210aj\306j\337\312\267\366?i\204\220$\223\f\251"
+	.string	"\212"
+	.string	"\240"
+	.ascii	"j\237\266f\212\022\270\347C\316\037\344\020\017)'s\376\006XT"
+	.ascii	"\001\244E\265\r\337\350Q\237\375-\025\215<\240\206\200Q\346\374"
+	.ascii	"\331b^\031-\256i\243\305\257\260\217k\264\231,V\302^\256\026"
+	.ascii	"kE\252F1\374\372\250U\013B\032K|\020\031\375\270\366\302\264"
+	.ascii	"\027.v\326\3022\026-6\266\344\022\305\322\302\220\374:\201\264"
+	.ascii	".\023n\2250\261\254#\257`\024\2218Zr&\205\207\021V\r\315 )\032"
+	.ascii	"\261\243\b\213\0314l\b\302o\031\005\2052sN\373\274\034\214\204"
+	.ascii	"vU\013\346\234\272DF\036\254+Vu\216\2526P\r\207\0047\036T\370"
+	.ascii	"\227:)a\370\335\356\234\363\347W\2720\372\237\241\203\211\320"
+	.ascii	"J\251j\327\271Q\225B\2055\221_\352\240<\t\375GwH\024\222\271"
+	.ascii	"S\252\277\237\375N\325\341\274\222\352Wc\276\n\363\325\227\257"
+	.ascii	"\272|\265\345\253,_]\371j\355\2534\367\254\263]\225}5\266\253"
+	.ascii	"\345Wa\273\372"
+	.string	"\372\252kW[_e\355\352\352\253\344\256\252\276:\356\252\370\325pW\377\325\335U\007\200a:R\263c\316\016\301)\363I\f\302s\317\252\332\023!^\356:\354v\242dG\254|\311D\371\252\270\f\264\313\353\026\230T\310\274^\036}p9\353\256[\312)\b{\265bMX\006\272\245\365\036^P\177\255\227GF-'\317z\315\023WkE\232g\264O\bi\240YV\277\361\246b\253\227\272 \313\307\223w\223\023\024k\245\nk\370z\214\006zE\365\033\017\212\247\352\245\216\312\312\303\2177\021\247$!\371\335\252\3045\317x\031\276^h\240k\342qxOH\361\245n\252v\332\303{\bD\320\006\311\361\273Q\274\222\356m\236\221g\244}\203s\370\017zC\240\200\001\233\002\n\020\320\260\344(\354@\330q\240\203\313\341H\310\271\324\206\306\002.BMN\356Vcsc\263\271\261\341L\200p\263\331\350\344l4"
+	.string	"\024\227#A\307\266\203\303\351\330Z\277iZ\3145\234\305\276\263+H\002z\220\332gVS\214\331\335\363\356\224\356gU\2006\250\265\357~\f\212$a\230\261\307\\W]M'h\337\351\312<q"
+	.string	"A\212\031h\030\331#\260V\365\206[\023\311~ )\250\251\204\177\017|H\r\356\271\324E=\001\355\224\302\034\366\330mD\211\217\231\254\324\337\021 \034`\006\372\245<\216i\305,_\036\005o\250!D\207\r5\201\t\005i\215Rc"
+	.ascii	"\003\021\021\333<\020@e\204p[\r\346GsS\tA>\311\265\n>\306\200"
+	.ascii	"\355\f+\347\222r|\004\226\304\351c\271\374\332\031\267\027\025"
+	.ascii	"\323`=\006\242\224|\035x\243,'\302B\272\bS\013m\225Vx\334\343"
+	.ascii	"Dv\210s=\232<\343\036/\336\003\242K\304\257\374\310$K\272\\K"
+	.ascii	"N\321Y\200\314\224A\\\005ZU\005B\300\317~\332\235L\362\210u\022"
+	.ascii	"\201S\342\024\241\232$\220\205\303\377\215\311N\217\200U\344"
+	.ascii	">\3327P\022\216\020+\345\006\212\370SO\206\352\003\362\020\210"
+	.ascii	"E\311X\224\214E\311X\224\2040.\310\273\006t\357\211\030Y\204"
+	.ascii	"(\276\340\366\340\037"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\330\003\215\020"
+	.string	"F\230\\E\020\223\222\016\021|2\247\032'4\021HC\037\305\b\250\212\035\212~\345\246\330"
+	.string	"\336g&(H;A\231\006x\237/w\264\346D\001"
+	.string	""
+	.string	"V\310\300"
+	.string	"\200D\304p`\214\264\2264BHl\371\263r\267\350\313-SI"
+	.string	"I"
+	.string	"H"
+	.ascii	"9\032\310\234L)}\027\020\3457\332q\204~#Bv\033\374}\037\021\254"
+	.ascii	"O\341\325o\001_cA \241\036\214\350\210Xq\322g\001A\375\032\310"
+	.ascii	"\377J\232\312"
+	.string	"\001\311\177\310a\224\342\357\2774Z\226\016&nL\3724\360\377\bN/r\003\b\211\311\261\230U\250\212\213\371\222\313y!b,\346\005}\036,\375\034\005}\234\004\375\035\b\3724\016\364m\f\364k\024\350\227\b\364c\254\364a\250\364el7\352\376\225o@\177\306v]\327\t\350\277\200\334ul\017\313A\326\263\301\"o\220\032hO\0269\003\206\nS\327\362>xXd\230\271\f|\354xYdQ\rE\256P\2273\315\364\300\"\273\320M\356\312\234L\245,\262F+,\362Gf\221[\264\310\327\004}XDA\314\242\023\346\267*Wqe\002\240$~v\266d\025\303\231\271\013\202\304\343\001\205b\210\202\222\344\211Y\202\222\250)r\243x\213\314\023\345\251C\344\316\324\241@\344\217\351\311%\315\013\365EZ\230.tB\225 \267\031\242V\245\230\202F1\0341{hW\250Q$\223aUiJ\322\3020\007"
+	.string	"\003\251\241\315\001\021\220$g hq\224\026\365\314\272\246\245\245\024?\365T+g\277\305hq~\032\245\006yq\376\373\250\n5ZE_\305\003i\024\251\313\252D\367\344\234\222:)\021_2\355\240\024\234\273\337\353\232\267\201\265\326\b\002\027G\354\006\325"
+	.ascii	"\251\341%\311\031\322\326\373\200\f*Th\205P\027\260\206\374\354"
+	.ascii	"d\377{\376\277G\376\347\300\2476\261:\3116\247l\205\353\332("
+	.ascii	"U\220\355\200\003Yc\030\307\206\236\272\261\302q\244\221^W\001"
+	.text
+	.section	.gnu.lto_.refs.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`\024\001\325\n"
+	.string	"FS>9"
+	.string	"E'\351r\030\235\013\267\020\302\314{`\245~<\204`\273/-!\245\355\203\376\277\3272v\351\377\377\377\377\377\377\037\3156\202\020\200\205P\007\370\365\n\277\265\337\336\221\310\024'"
+	.string	"("
+	.string	"3"
+	.string	"\017\237i\237W\371\252~\327w\342\033\376Q\376\260\376\257\276Y\370\022\371\007\375\202\276M\270"
+	.string	"\367\336\247\376\326\367\373\247\n[`\257\310>\201=\"\177\205\035\"\373C\276\003\366\206\354\f\371\013\334+`O\310\216\200\335"
+	.string	"{*\037\305\375\206=\263\00710/\250\257K\313\n\367UI9)!\031\021\t\001q\265<\260\227#{5\362{\001\340\364\323f2!\240\330\016\367\353\344\274l\260_\223\375\231|\026w\377X\362\237\t~Qj\335O\224z\212\356\267n\002\323\317\325\372\350\310\177\033\330_\006\306"
+	.ascii	"\001\001\226\006\276J\265$\032\222Q\321\320L\026\364\023\353"
+	.ascii	"\341\201\341\334\320\310\0047 0\243\261\3521\330q7\301Zc\376"
+	.ascii	"\r\211\023L\bQ\343\022l\t\211\023L\210\342\364`BB\034;\330\220"
+	.ascii	"q\005\023!\343\026\354\026b\304\005\303!\234Q\213\033D\215\033"
+	.ascii	",$q\353\203\301!,N\260\220\304%\034\253\215\n\342\006;\204\025"
+	.ascii	"\027\036\354\0044Dt\334\r@\202T\302/\001"
+	.text
+	.section	.gnu.lto_.decls.3a4211d24d4b5297,"e",@progbits
+	.string	"(\265/\375`}/}\327"
+	.string	"\252X\251LT \nY9\351>\370\250\345\212\303\306\251\3070A\003\372\bU\0163\036hh]\034\0364j|\202\002z\330\366\013\313\3538\310]\230\351=\243t\277\331\b\226e\021\314@\235\272cNY_9\336\235\2247\031][\353\251x\232\357\334\035\007\252\266Z\277\267\334)-\004\272\004\335\004Ra\235\244\227T9\254\354\204GbIsM\337^X\013\251~U\316H^:\235X\"\267\246\357\207\r\352o-\350\236\247\n\267\222\366\252O\016\375u\346\251\206\217\276\347\221\201W\310\177\225\003\3607\017\377\322\341\346\352>\322H\336\\m$\b*7\327\255\037\206j\375\300\363\226d9\005x\177\313\340_/\270\265zH}J\320Dj\236\221'\253\276\277Yp\br\256\022"
+	.string	"\353\337_\225"
+	.string	"\370K\206\177\203\340\277\233=\365\202\313\214I_3hx\264S/\313|\315e\2732\274'\276\2429n\330\274\201\3014\273{\362\313\263s\007#\256\215\024\03372\276\312\354\350\250\356\324\277\0327\344d!?\315\251\3712\0015\206\r\234;w{\177QO\365S\215\263\316\257\036+Zd\212\344<\301\241\253\333\3615\247\306B\226\202Q\343\353\357 ]\243o4\215\226\3219\032G\363h\253\336\321>\032\253\245\232\252{\364\214\266\321?\032HW\365U\353\250\317\236\352\030\357\250f\376:\315\342\274\315\236Um\2101\267wW\365z\252\326\251~\326\351\206\243\246\260\271\313\331Y\323\374\365L\235\353\251\272\346mCP\316\334\005\244\233\n\242\267\227s\016\341\003w\004\212\227\210{\233iV\016\337V\301\267L\360m\026\276\205\302\034\346\340\267\034\006Q5"
+	.string	"\253\235\312W\237\030\324\276W:u\357<Kgv6\022\277\347\224\276\357/\370\025\003\240\375\373\253\030"
+	.string	"\337h\330B\325"
+	.string	"\354\232\001H\242\241\340\367\021\374\356\201\337V\370\035\205_\373\360+\036~\245\303\257a\360k\033\366P\323\360\253\030~M\202_\205`\022rU\003\360\025\013{\250\032\200W\016\204P\2354Oae\322\354\276~\304\365\035S\351\204\021\223\323\367uL\205\253q\033\310\031"
+	.string	"6J\f\037<\372f\241;bw\370\372\266[\325"
+	.string	"\fQ3"
+	.string	"+\230\242\3270\031\200UX\316\254\3063\243\371\264\322\327"
+	.string	"\257_(p\346\2401\244\357\333PZ\0332+}\27389\b\211\361\273\201\325\367\365\nk\251nuK}V.\025\313+[\315r\016\316\234\241r\316\327\340/\242R\257\f\331\234\201\210}iP\302D\345R\333\352\225*\207\265"
+	.string	"/dw9\247\025q\251Qj\232u.\311y\310\221\2413:QN\366rvr\b\021\"\204\220\334\016\262\036\370^\003\270r\250"
+	.string	"\256U\252\225\372\244\240\2569\211\202\250\250\2204\373\336\004\034\204\342U\355\023,\263\211k\300\257\024"
+	.string	"\353_\245"
+	.string	"x\"\374\327\264\277\222\325\262:\3052\247\232Y-g\347\005\"\262\033[]N\"\037-|Np\364\255\316z\366\212V\245\274\204\211['\264\\\226s\256h\0334s^V4\242\276\234\227D\265~\250\365\303\035\323\362Z\003\336\377\3407\266\340\254\032\200\270f"
+	.string	"\232\350\025\336\027&\203\020\374\025\353\2579\376\312\243K\200\240G|\300\003\377\360\333+\177\225\361\3271\255\302_7\370k\230~\361W\f\365\255\233\376\226\340\357\t\\t\213\27710\021 \375\033"
+	.string	"\030\264\362\257 ~+\344\033~{\327\311\277\352u\007\376\036Z\372\3617nd\037\343\232\305\377\0134\007\b\360[\032RVXk\244\377\002\370\277\002\350\267,\376Z\3667\372\367\321\337\303\277\215\376\016\376\255\201\2773\3607\006\376\276\300\337\026\370\233\002\177O\340o\024\376>\341o\t\374]\302\337\020\370[\305\337\"\374\035\302\337\016\370\273\001\177/\340o\005\374\235\200\2779\370\357\366\277\355\277\226\377]\376O\371\357\341\267\036\370\333\304\337\032\374M\342\357\003\374]\200\277\003\360\267\206\2773\374M\364\267\317_\351\374\025\357\257m\376\252\346\257u\177\245\373+\231\277\212\371\253\227\277n\371\253\333_\331\376\372\374k\225\277J\371\253\331_\235\374\265\353\257G\376Z\344\257Dj\217\277V\375\365\304_;\374/\363\237\314\3771\377\275\374\177\373o\200\377p\377}\376\376\376\376\376{\177|\344\267\300\0315\0168"
+	.string	"'g?\263U\2603SE`\206\207\005\342\302\255\005iR\271\255\322\\w\031%\b\016\233\266\202nM\231\264)_<\342\370\r\311=9\236\354|A\263A\352\217\253.)}\037d\205-(\"\345R\254\223z\202\354l\354n\217GK\230\324\223>\\\001\025\024U\254Z(O\013\305\232\215\340\314N@RfndP\337:_\361#\353{[\366\3330+f\311\202\2329C\371l9\231\351\353\333\305.\351!\325\244o\025St;v\263b`\201\322\367N&\220\036\266"
+	.ascii	"\016\205Ub\275n\277\354\223/\353\244s3\347\257\036+S\236w\031"
+	.ascii	"\313\007\b\037\275\034S\274,\271ub\233\004e\001"
+	.string	"4\233<\2639\335\004\f_\355I9\351\342\354\030K\250\212\364\275eR\261\364,\205\360\255\351\37395\216GK\257M\233\031\374\367\017\314W<\316\354\366\024\364\312\363\n\342\027\252\266\016\340\377\315\371\037\221\201\234\227~M9@1Y:\344\364\315\317\331\251Yu\201\351L\313\252bBe\351\250\314\264,+fZ\226S3\343\226VU9\313\t\347\246\025f.sNkf+ gV\316\316,'\354\\Ve\2463\253y\201\t\225eU\231i\271*C\345*\f\314\234\255rZ\026^e\346\254*fZ\323\352B\206*\303\224\021\205\311U\335s^)s\306\204\3125&\b\203jV\3111\235\315\352\226\263\223Z\214\\U\2359g\345\354\243\371\301\rJ\211\223\333\223\\\215\036,(\247S\335A\343I\253\351\343|\312r\314&M\245\0309\333e\032\0338U'g\3169*?9\325\234c8\253r~jn"
+	.string	"\253Y\321DUe\241\f\265\234z\322j\006\305xjF\345&B\252\0253M\253Y\244\245J\332W~r:\325\257l\227U\205\323\234\234\231\031G\210N\026\272\275\276\266K\310\247\311c\312\262\211ER\201\034\212\333#O{\244\216\361a\346|\345\001\212\226\261\273\275\\U\225\301\201\244p\021\2374q~\250\365=\320r\313\022\021J\002\206\366\324wH\2153\\\374\370p\226\025R\237V\313\006\301\322\264@\206\234.\344<\244L\313\376\260@\252\034\2263_\365XY\362d\357>MQ\023\007\006\377G\013\220\236\0333\365\304\346\303\366"
+	.string	"\232\233\243\222\321\227\007\207\212D\210\016<'\276\006\026\313\332\260:\252\234Z^n]"
+	.ascii	"\266\004\314\307\236\335Q\237\026\313^\205\340\360\023EFY\221"
+	.ascii	"{ou\330\034\335\344\261\302\246%K_\020\026\207\017\2243\247\001"
+	.ascii	"\241\331\271\325\335\300%\212no\204u\021\362C\205\377\263\304"
+	.ascii	"\277\265\362\003\232Q\345]\315y\3510ZX_uL\023p5\276\342h\334"
+	.ascii	"\315\251s\227\246\375\032K\267A\315\375\210S\343\370\276\354"
+	.ascii	"\376\314\324t\233-w\364\322\310\300\373\213\362j\334X\337\230"
+	.ascii	">c\317\252p\226\2629\251\267\3527\264\264\220\241\236v|q\351"
+	.ascii	"\302\303MKoi\371\270\223\363\266*\247V\277\236\330\241\333\322"
+	.ascii	"\303L\3735Y\247U9,\236\271$w\272\317JY\247\376"
+	.ascii	"\263K\373d\253\232\317\326\2604,\f\013\325vl\224\245\2622,\263"
+	.ascii	"\353\330\030v\206\315v\252>\333\257\365\336tz\317\257\255\364"
+	.ascii	"\232u~\371Di\001\271\333\363k1Twh\374\232n\206_\273\351\273*"
+	.ascii	"\247\006\202\236_\b;\306\013j\215\304\345\311n>w\370>e\360}\330"
+	.ascii	"\360}\312\360}\216\340\253U\r\3007\r\347\342EQ\"\325\367>6\336"
+	.ascii	"\3605\233\037\277\247-Xp\326`4\370\270\r\037G\301\307\\\370\330"
+	.ascii	"\006>\201\231mf\b\254\311\227:}\337#\0077\231.S\237-\367\213"
+	.ascii	"\326\314i9;\205\3542\307\2306\020@\242\n\002\370\2363\370=n\370"
+	.ascii	"=h\370=J\360;L\232\320\233.\316$}\373K\321\033\314\002\220\f"
+	.ascii	"\031\353k{~\340\367D\341\003\363\360\335\200q\370@6\374\273n"
+	.ascii	"\373\253Y_\301b\257\260Lq\322\267\331\212\336Y\200w\352H\251"
+	.ascii	"\365%z\202k\3565\265\036\260\277\032y}[\255\350\375\254\200\355"
+	.ascii	"MK\337\036\240\027~\235+\353j'3$U\232JO\351\263F\253\317N\373"
+	.ascii	"{\254\336y\215\302\245\201\323\310\227\211\264\226R\343\362."
+	.ascii	"p"
+	.string	"R\2257\026\"\304%\023{s\263\207\317S\207\317\023\006\237\207\r\237\347\f\237G\f\363\264XX\020\2248Ro\372\202\365\223\206\322N\272I}vX3y;sV+\322\\U\264\246\356\262zkh\351\314UEnk\372\302Lt\005[T\326\356\334\177\305\356\031\025\376\374\350\364\275\235\227\242_3d\274\334I\271r\267\314\0344cl\364\375-\363\267Z\243\241\313\222g\244\357\225R\364K\306l\213\3115&.h\265\204\256\357\215C\033\362K\"U\006N\f\317\031So\255\357\257\230\377\2525\036\027\016\033e\372\3260Dsms\224\\0\367K\016\030g;\372\376~\371\257\227J'\344\203\311\020\"}\203\322\212~\337v\300\tA\322\205\213V\225\232\313\345o\266\273%\b.\314\034_\337\357\221\025\375j\301\177\177\\\216\270\265\235\031\262\205\256\357o\333\177\331n\226!\271'O\322\364\255\314\252\001x\241f"
+	.string	"V\263\242_,?Y\356\310\250\356\225\273\006\243*\016F\337\337\265\377\2425\227?/9S}\257Z\321\357\023\b\352\306\232\222\276>V\252\234Q\331h\322\367\267\312\177\323.\225\022SG\300T\r@ \264\242\337)L\276\261\276?g\3279g\215VT\337_\347\177\245T= \023*\253I_`\315"
+	.string	"\354\261\242\337(\326\316J\013\016\263[\226\345\266\316\214\375\226\375\227\254\335*\332\006\246z`\301\351;T3"
+	.string	"\257X\321o{\251\301\301\365\025\272a\027\nQ\232\255(d\372^(hAn\3648\323\267\002:N\234\\0\264\254\2610`\025\263\262e\337_\270\201;\374`\302\344\202qhZ7jA\364\302:\317\214\306\037\230\317\0220\255\251<\334\201K\211\222\373U\321\300|\354\r\315m\315\220\362\372\375\"zr\322\305\226D(\314\r\335\0169\334ay\215\\#\267+k\353\306^O\2228T\260\\$\277]@eu[\216\\.,$\313"
+	.ascii	"\273\\9H\240\303\347\0041\243\212\336\323\023\334\201\316\217"
+	.ascii	"\337 ?\356\226M\023\224\235\3202UO[\030\2403\25133Y\277[\277"
+	.ascii	"DJ\230\270\033\034\366$\315\262\357\035\242u\205\334M7q3\205"
+	.ascii	"\327\3676\377\026\204U\267W\3442-\031\255\271\247\276\027\210"
+	.ascii	"\317\026 D\262\372\326\322\364\370\352{\013^\270\203S\207\216"
+	.ascii	"\333c\b\306\226\254\261=\265*Ohn\217\313c\310\257\017\nH\337"
+	.ascii	"\273#\350\251\f\215\232\336\305\232\303\035\314\340\300qmX`I"
+	.ascii	"\035\220\2601\031i\202\300\341\016W\254\254\256\r\016M[g\206"
+	.ascii	"\257/L\250\314U\233\325\275\372\265\321\\Bs\250\310E1B\206\252"
+	.ascii	"\317\316\023\354\201\355J]\251K\345\305s\203\211\016\264["
+	.string	"\343\227\352\315\206q\342\024\344\322\350\331j\303%\314\245q\247~\306\236\310\361 \2023g\203L\013{\260\253s\373W\347\312\260y\030\253\351\204\307\200\267:v\302\3662\023\013\204\020\033\017\261f\337_\031\277P%L\\\246P\215\267,\275\276\027\306\215Q\237\207\273Q\037\332\022\365\204\353{\"\030\370+\324\303\001\357\323\207\260\306l\271s\272\313\337\347\007\214H\032\024?|\004`\264\034VVDP\370\244\322\364\265~\267w\242\274\305\230\233\203-\337m\337\357S\267j\310\235\271\263\363\373\004\341u\345\340b\203?\204\006{`\022'\216\245s\013\225\201\260}Y9pvz\267t\352Z\0207$}\355\034 \233\03269\207\0034\347Ns\357o\027\207\026\2621^\260\007\035\366\315\033\213W\3212U}Z=\331\003Q\363\262\304d\330\273[\274\036$d\210\\\365\265p.\f\260\276\346\320\032\366\360\307\206\215mc"
+	.string	"3\340\324\031\021!m\252\337\017\222\263\030B\304\260\317\033\212[5j\254\221k\301\t\245E\365%4\346\005c*\t\376\311\202\342\266\256N\314\214\365bzy\375\300\037~\310\311Y:\t\2028\215\335\355Y-|W\264,\232[:\340\224\036:\346\354\034\020\264&\225\2713\027\310\2273]<\200|E\270@\231\261WAUR\272\214\365\375\320\024\256`\b\212\333\270\327\247\215\263dFhf\033 \240\344\274\261k\003\211\031\250\276v\214O\230\25120;\370BsX\210\013\212[0O\013\306\212\001\321\\f\235"
+	.ascii	"\253Z\323Gt\345\t\016-\033\346LkF\335\033\276\020\032\336\220"
+	.ascii	"\207\342\266\313\353\323v\261^.Zv\302@\367\003+\003\026\\\362"
+	.ascii	"\235\276\366\255\307\306\233\336^\337\013\025\301\027\212\302"
+	.ascii	"AAP\334ny\332-\326\310\b\315\345\325\005\\\316\352\200\354\345"
+	.ascii	"\f&\203\241$r\250\314\342\360\007/mm\326\r\347\234\351\244|\005"
+	.ascii	"Y\351\242#\3629\267n<g\232(Y\273\202\007\260\274r\305\262qx;"
+	.ascii	"\253nQw:\260\334\262\375\r\321^\0252[\202\304p\005lPX+\325>\237"
+	.ascii	"\366Y\3438d'\274\013\240\340\201\311\240\347\352\212]\f#\370"
+	.ascii	"5\351\221h_(\245E!:\302\bJ\342\205#\264h$<\206\220t$\"E8\022"
+	.ascii	"\205\311$\272\342C\b\023P\261\342\003\017\202!\200 \001\022\202"
+	.ascii	"\037\234\020DA\305\205+\211\240 EQ\360 %\032\001\245\250\322"
+	.ascii	"\210\032\201Cb\252D\036\223\204\304\243\021A4)tq\224\024*mP*"
+	.ascii	"\205KF\344\007.FH\321$\fJ\345\b\001\240I\246T\210\"\365$\035"
+	.ascii	"\211\351\213\024\030\216D\364\210\2518<\022G$\225L#6\244AT\005"
+	.ascii	"\242\022X,2\035\217\310c\217\013dR)E\036{\220\204h\361\242I\246"
+	.ascii	"\245{D\213\311T\t\024\246B\020\204N\244\200\246\304$\005\200"
+	.ascii	"\224LI\244\362\210\242\220t$\032\223B \242#$\tM\310\024,\206"
+	.ascii	"\302%\013\351\206\024CjDS\345\013\024:\\I\3040\210\032\211\351"
+	.ascii	"\221)\331\001\375Q\246\304#\361BzdB~`\341Eq\t=A\211\032\205%"
+	.ascii	"\250@,\n\211IT\271\301\004%\352\301\213\024M\310\024GG\"R\004"
+	.ascii	"\037\022\223\350\021M\302\337\200\003\004pp\242\251\347': \321"
+	.ascii	"\001\t\340OtPT\324\001\007E\370\034\024Y4x\244b\250L\201\266"
+	.ascii	" \246CaP\032,\241A\212\304dd\024\242\311T9\342\2104\032\221\303"
+	.ascii	"\n\216\216\250U\006\221\230\214\224\300d\272d\323+\211P\242G"
+	.ascii	"Hcp\230\0341D"
+	.string	"\222 \r\246\307\020^\b\223IaJ4\272\240L\211FW\031d\241\024\032Sb\212&\244Q\320\005\241\205\244#2\002MD\021\220%(\227\222.\270PZ \0061\240A\021>P.=@C*\f\242GI$r\030\004"
+	.ascii	"\032\004J\211G\246\237#\222\250$\016\321\344RP)Dj\021A\261\210"
+	.ascii	"L\006\227\202/X(\223H\026\320$aZD\266\b\026\213\3500\230&3\240"
+	.ascii	"`L\n\213\036\244)RiC\023Z\\b\002\001\251(T\372A\203\031R\342"
+	.ascii	"1\205\"\312$B\232D.\245I\241Qya\205"
+	.string	"\222\311\210x\001M\205'\240\251\360h)\005cZ\024*\n[$\321\364\250\"\2032IX\024!%\032\225Gar\205\221\250\264\240\224D\034\301\0052\002\021T \t-\341\250\210TR\242I\245\025\351\021m\021\302p(\324\340\201\013d\004\214D\345P\022522\225\220\242ptdB&\037`$*7\034\211&\030\211J\340\225D\274H\246\250\021-\242\351\007\246T\230*\203G\350\321\021M\233\320\b\224E\364x\024*\r\203\303\244\005\241\"4\025&\203%\204\311\264\t\005bq$\026[\b\215=W\0221\"UJ\"\026\221&0\n\001\217\3204\211\2668\252\030\242I\"\bId\2124n@\227^\2540&\221H\251\260\270\024TD\"S\004y\224K\302\242\bJ\241\022\3561!\2116\021I8B\211\305\245%!\006\264\230t\364@i\230\022M8\272@\202\200\026\323\024\231TZq$\222\340\002)"
+	.string	"W\022\221Dl!<Z\240\f&\021\221\216\310\017\216Hb\252\f\201\250D.Mp$\026\207\350Q0Ih\f\016\211\251\320\210L\231\204\022d@\227^\244A\324\210T\n\246\250\022M\022\241\303\2430\211\026\221i\360\210$\246\302\244\021\261(\034\006_\244\304\026\302d\022\005G\350\261\210\242J\246\241\244#\361\210d1D\223\301#!zT\024F\220\0069(\302\350\021SJL\213\302\b\226\202*\264\b\242C!R\222I)\264\324b\251EP\271\224\024|\321\344\002YD\n\252\020t\341\323\"\250D\223\301\037\245\220h\344\342g)8\034\n\203*\274h\n\272PZB\203MB#P\213%4\210L\n\215pz\245"
+	.string	"\034\271\204&G\244Hdr\004\320\221\212\364\210\036\205\306$\272\004\244\f\246\301\023\351\221\310\324s$\022E\033\f\213Pp b\303Q\240\370\300C\n%<"
+	.ascii	"\017E4!\215\202KJcp\2104b\2104\342H\024\032G\f\223\312\021\""
+	.ascii	"&8R\321\2044\342I\n\225\206\0275\nKhB\032\365\234'\327\277\277"
+	.ascii	"\276L\304Lk\346\274\344Y\3628\235'\177\003SZS\300\277\333\025"
+	.ascii	"4\003\210\032!w\300R\344M\021\361\273_Bxcz]}:l\337\235\272)>"
+	.ascii	"2w\212U\333\033;"
+	.string	"b\200\254\300\354,\353X/B[|\317\347\336\355\021\224D\317\013\025:\326\b~\276\221\223\322\263a\327$2u\347\334-9)\177G\372\016\001\237tEi\211c\361\364~x\345\321\361a\022\343\r\357R\tE\321\263\273s'\003\350F%\245J_'\026\223-J\337\333\306\256p\333\364}s\335\374\2669Q\217]\030s\t\274\327\356\252\251\317\277\3355\316\264!2ui\354\266pS\317\337\352\254Y\320\327\236\021,i\350x\b!2\243\357\245K\313b\204\353\016\315\\\203\324\250B\021AF\322J)43#\"I\222\2441b\n\020\bcY\242\346\326y\022\240D9\2162\311\314\210\310HR\220${\354\006\243NN\206] S\214\241\276\246\333}\314\220%'$\017{@+\003UeD\323\3732\n9,)\3416\367D\007he\260<\303F\021\004\372#O\322\005\320\347X\244\315?\300HX\302\352"
+	.string	"\214\365\035\315\237s\247\r\222!\335\303\376\366\221\270~\374\0205\2200\225\001\372\252\210'\266\323\035\221\032\251 \257z^\205\207R\305\264\006W\250\001\321\213\301Z\265kq\253\263\032"
+	.string	"$\336\257m<\226D\214\302\340\270\240\326t\223'\320\337\263\226w`J\016j"
+	.string	"\327\362\f\327\257\263\314\202.\n4\ff\250b\363\333\320+\212\346.bMPkh\302\351X3\316{\210u\0333\002\3118\231\323\013\216\336C_\317GY\311\273\3454\307\371P\033\346@.#\247^\331d\320\b\306I9V\320J\273\002\223\300e\216\274\3508\374a\322\324\227\320 \303m2\032\301\325\216\271x\344/\377\203\233\271-]\207J\361\210\207\0269\312\023_B\272oZ\332)\rv\020\205A\f\005\361\225')!\323`\022"
+	.string	"+v\310\316[m\013k\317\346\356\004\373\"\274\007\246\230(\221t\005\273#\324[Z\235T;\314F\204\237\304\007,\276_5\241>t\313\251\306\224\251\324`\323\363\356&\205\374V\3246\037\271BTdMZ\271CQ\266\003\003\342\276\036\300\007l\203\026c\361\322\006#C\205\002\312\251\256"
+	.string	"\r\350L`3\034X\245\001\206\337fC\241\241\221p/+x8\272\013M\247\021\241\201\302Wh#\311\241\245+\341-Q:\366\002\313\356|\224\307\316)2n\005\023@BZGO\253i\247T\237\004\030\177\237\244Q\254\375\327\2111\260e\325\003\276\f\367\201\rH\321fFXia\254_r'\276\332\233>\333?\353\316M=\345\"9te\256\363\265>hdF\303\205+\230\003) \301\201\266\361\213\375\007\342\277\007\"8\260\352E\323?\004\272\"+\200\022\031\240\201\260\223\007\214\353\247\304\214A;\323\030\364\261\005\214\210\277h\201\302\320\177.(\nsEX\221\250\037fp\344_\bH\007'yxk\376\340X\277\233\037\334\fbE\325\335b\3106q\243I\025\202OK\\Z%#zT\rlf\276\207\240\242t\305"
+	.ascii	"\277W\307\222\316R\214\304)\0207\242\344I&\374\017yY4J\301\004"
+	.ascii	"\005K\211M\236\205\r\306\376\251\035\"\337}\244\355\255\272\346"
+	.ascii	"Z\b\365\272\236\202\0241Q#\366\342\300\233C?\336\221`Z\201\\"
+	.ascii	"N\375\"\2441\217D\334\244\253p\306\021\254I\324\371\320\311\272"
+	.ascii	"aU\306S6\260f\374S\243:K\027\ns2-OmI7\266\202\247\3409P\220\006"
+	.ascii	"\032'`[\007\313\213R6\251O%\337\032\3676\351\344#\355\026\211"
+	.ascii	"|1\214^\2108\030\300\257\265vs\274\002\003\201\021\223\342\364"
+	.ascii	"\351\245\323<\201\315\345\200\025\355\022B\346_\207\n\216*\306"
+	.ascii	"\362\356(a\271>^rU\326u0\345k\374\f\216\036kq\212\330\243\261"
+	.ascii	"\030o\363u:HZ:a\360;\306\275\006\241p<Pz;.\204\252\030B\032\372"
+	.ascii	"\270)\222\366=\240\271\256\347\203\247\226\254\330\267\215\203"
+	.ascii	"_V\355\373H\205\005)YY\n\316\261!\245\356b\204\355\264v\377\007"
+	.ascii	"\006%\022\351\n\211k\335\301\022G%P \030d\312\375\024\bl\022"
+	.ascii	"b\313\360?|\304\212@\031\213\022\275g\333\204J\263\312\215K\246"
+	.ascii	"\230\273\"\265\317\237\355\274\320\264\311\241\215\320]I\020"
+	.ascii	"\247\351\024V\330Z\331\006s%X\304\260l\254I\201\256\265U\341"
+	.ascii	"%\351\252\237\222\027\3523\020\304a\250BK\b3\216\241cW\343)\333"
+	.ascii	"\021\245\252\331\21297v\331Wu\367\211V\r\035\034@\300\027\330"
+	.ascii	"\216\256\231Dhg\342\243\371\304\234j\0378\031\330\314\374\230"
+	.ascii	"\314\261\223mVTtv\"\270%1\313p\224Py\354"
+	.ascii	"7{\022\305O\204$T\347q\342[\370\3444\236\373\233a{g9tQ}\007o"
+	.ascii	"\300.LE\343\312"
+	.string	"o\271\025\324\177\200\245\240.\272#p#\247\323DA\327\3555\003\277n\0027Fb\333(\246\276\205m\271;Hw\266\027)\bU\243\241Rm![]\345Qd\233\363M\353\007:\357b\016\361\276\302\375\352g\3626Hj\200H|\257;*\210\005\327\326\306t\324\315\031\373\317i\025'\224\272\203\0138\005\007\024\305}NB\350\374\343`\332\217\3004\277\273\202k\332\365\340\030|\224\220\202\202-\247\217[6\331\001\001t\020\215u\324\027\301\243\242b`3\025l$h\\\347\f\"G)\240\027\211\300\344\372\004\261\340\344\206\313\0044f\325>u\001H\274\b\234\201\313\301\210,\026\320F\004\022\254+\274 \326\023\026K_\352\366k\035\241\372\311a\255\200\215\025\370H\2035I\200\324\202C\215\016\361o\305\336\027F\34505qjU\2674\264\313+>fZ\217\024\037\021j\225\214\266y3YK5rz\037e"
+	.ascii	"\243Kd\177d\b\265\212\233O\276[\254\377\004\003=\017\254w.'\256"
+	.ascii	"\201\350C\216\022\221\002\250\213\3010$\320xS;\021\344\256\307"
+	.ascii	"\234M\230\200\321\334\255j\310\307\270\315\034\262\205\316\273"
+	.ascii	"\220\311/\203\025\376\2323\254\006\300\356\276*\034\3760\025"
+	.ascii	"\315\313y\352}c[\272A\234\332\234\347\264\353\325d\302\316\345"
+	.ascii	"\026\370_|\335;\242\334w\356\277b\307\234*6\334\034\031\002\251"
+	.ascii	"\021Y&\310\313\2742\233\243dE\033\235O\035}4K\300Vh\013\b=m\036"
+	.ascii	"\206O\246<\322\274_z\340\302\217E\275i\007\327\3007p\363\327"
+	.ascii	"\313\337s\361\376\022\370\341\204U\360\315G\343yD\374\035\n\223"
+	.ascii	"&\027\324w\246\251\355\341\253\333\377\253\335\257f\310Wy\355"
+	.ascii	"\r.\372\373qE\226\215\005\350\224\257\223>\220\266\222J=\307"
+	.ascii	"s2\tf\330\271^#7'\232\275\246(+\256\266q\357\022\342\357\007"
+	.ascii	"\206.\262\037\01609\265LZ\227\276\277\270\236\206\f5\272\236"
+	.ascii	"\273N&\017\223\021\350\323\363\303+\223[\363\027\022\257J\346"
+	.ascii	"\016\261c>(P*O\006\257\017d-{\301\002\307k\257\314aG\245\263"
+	.ascii	"n\356\311AIs\334\215\360\021\320\016\312\016Aec\03354\310\272"
+	.ascii	"z-\312Y^_\307z\323c\036\221\277}\311\244\323\006\342\252\310"
+	.ascii	"\\\207\020b\030\210\223\346\3347\303N\223\360#\341o\302\021\277"
+	.ascii	"\030\004\361\203\326I\254\002\324\344St{\246V0V\313\301\320\340"
+	.ascii	"g\034bn\256\277\224\321\204\006B*\304\205M\200\342\2155\2503"
+	.ascii	"\340h\350\307\340\367!sn\217?\312(\301^\210\253\310\024)\225"
+	.ascii	"\274$\237\001\340\255\2112\266\301\352\203\355\301\217\307n\237"
+	.ascii	"\201l\276\225#\267\215\257\376\227\346\244\301\325\341\357\342"
+	.ascii	"V\234\211\345G\304\n\323f\237\337\327\002\342\214y\305~\033\337"
+	.ascii	"}\234\204#\337\030\3113U\034\366u7\301\315Bq|\023\251M\356\267"
+	.ascii	"F\257\244oR\277\234ek\350\025\315\327\222\026.\274W~o><\277\r"
+	.ascii	"\272\326\372\027\221\313\202\336h\361\036\232\200\234[*}\212"
+	.ascii	"9i\325\360\276\007\261\374\030\370D3*\256\216\357/\334\333\307"
+	.ascii	"7\241\377\3069\372\217\360\027\264Q\303U$\240\277\n+\214\323"
+	.ascii	"\345U`\023)\033\247\003\376-\341f\277\345o\362:\004"
+	.text
+	.section	.gnu.lto_.symtab.3a4211d24d4b5297,"e",@progbits
+	.string	"findBoxByActiveBoxId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"findBoxByPermanentId"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"serializeBoxNamesReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"activeBoxIdCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"serializeBoxReply"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"initActiveBoxIds"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.string	"packBoxModeFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"packSensorStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"positionEstimationConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"telemetryConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"sbufWriteU8"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"sbufWriteData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\001"
+	.string	""
+	.string	"sbufBytesRemaining"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"getHwCompassStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\002"
+	.string	""
+	.string	"navigationTerrainFollowingEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"isHardwareHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3a4211d24d4b5297,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,20870 @@
+	.file	"fc_tasks.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/color.h"
+	.file 6 "./src/main/common/global_functions.h"
+	.file 7 "./src/main/drivers/resource.h"
+	.file 8 "./src/main/drivers/serial.h"
+	.file 9 "./src/main/drivers/adc.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/common/streambuf.h"
+	.file 12 "./src/main/msp/msp.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/runtime_config.h"
+	.file 15 "./src/main/fc/cli.h"
+	.file 16 "./src/main/flight/pid.h"
+	.file 17 "./src/main/io/osd.h"
+	.file 18 "./src/main/fc/rc_modes.h"
+	.file 19 "./src/main/msp/msp_serial.h"
+	.file 20 "./src/main/scheduler/scheduler.h"
+	.file 21 "./src/main/sensors/sensors.h"
+	.file 22 "./src/main/common/logic_condition.h"
+	.file 23 "./src/main/io/vtx.h"
+	.file 24 "./src/main/uav_interconnect/uav_interconnect.h"
+	.file 25 "./src/main/cms/cms.h"
+	.file 26 "./src/main/fc/fc_tasks.h"
+	.file 27 "./src/main/blackbox/blackbox.h"
+	.file 28 "./src/main/telemetry/telemetry.h"
+	.file 29 "./src/main/navigation/navigation.h"
+	.file 30 "./src/main/sensors/opflow.h"
+	.file 31 "./src/main/sensors/pitotmeter.h"
+	.file 32 "./src/main/sensors/barometer.h"
+	.file 33 "./src/main/sensors/compass.h"
+	.file 34 "./src/main/io/gps.h"
+	.file 35 "./src/main/flight/wind_estimator.h"
+	.file 36 "./src/main/config/feature.h"
+	.file 37 "./src/main/sensors/temperature.h"
+	.file 38 "./src/main/sensors/battery.h"
+	.file 39 "./src/main/io/osd_dji_hd.h"
+	.file 40 "./src/main/fc/fc_msp.h"
+	.file 41 "./src/main/fc/fc_tasks.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	fc_tasks.c.487a3eca
+	.weak	fc_tasks.c.487a3eca
+fc_tasks.c.487a3eca:
+	.long	0x149a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1e
+	.long	.LASF3000
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2473
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2474
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2475
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2476
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2477
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2478
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2479
+	.uleb128 0x4
+	.long	.LASF2480
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF2481
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x72
+	.uleb128 0xa
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2482
+	.uleb128 0x4
+	.long	.LASF2483
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF2484
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF2485
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4c
+	.uleb128 0x4
+	.long	.LASF2486
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x22
+	.uleb128 0x20
+	.byte	0x8
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2487
+	.uleb128 0xe
+	.long	0xab
+	.uleb128 0x4
+	.long	.LASF2488
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x66
+	.uleb128 0x4
+	.long	.LASF2489
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x85
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2490
+	.uleb128 0x5
+	.long	0xdb
+	.uleb128 0x21
+	.uleb128 0x4
+	.long	.LASF2491
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5a
+	.uleb128 0xe
+	.long	0xdc
+	.uleb128 0x22
+	.long	0xdc
+	.uleb128 0x4
+	.long	.LASF2492
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x4
+	.long	.LASF2493
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x91
+	.uleb128 0xe
+	.long	0xfe
+	.uleb128 0x4
+	.long	.LASF2494
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0x5
+	.long	0xdc
+	.uleb128 0x4
+	.long	.LASF2495
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x4
+	.long	.LASF2496
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x10f
+	.uleb128 0xa
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2497
+	.uleb128 0xa
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2498
+	.uleb128 0x5
+	.long	0xb2
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x5
+	.byte	0x15
+	.long	0x16a
+	.uleb128 0x1
+	.long	.LASF2499
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2500
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2501
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x6
+	.byte	0x1f
+	.long	0x1b9
+	.uleb128 0x1
+	.long	.LASF2502
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2503
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2504
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2505
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2506
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2508
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2509
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2510
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2511
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2512
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x7
+	.byte	0x16
+	.long	0x2aa
+	.uleb128 0x1
+	.long	.LASF2513
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2514
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2515
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2516
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2517
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2519
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2524
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2525
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2526
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2527
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2528
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2529
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2530
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2531
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2532
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2533
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2534
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2535
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2536
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2537
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2538
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2539
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x7
+	.byte	0x43
+	.long	0x335
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2553
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2554
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2555
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2557
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2558
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2559
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2560
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2561
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2562
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2563
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2564
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2565
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2566
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2567
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2568
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2569
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2570
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2571
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.long	0xe8
+	.uleb128 0xa
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2572
+	.uleb128 0x15
+	.long	.LASF2576
+	.long	0x4c
+	.byte	0x8
+	.byte	0x1a
+	.long	0x363
+	.uleb128 0x1
+	.long	.LASF2573
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2574
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2575
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2576
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x341
+	.uleb128 0x15
+	.long	.LASF2577
+	.long	0x4c
+	.byte	0x8
+	.byte	0x20
+	.long	0x3c1
+	.uleb128 0x1
+	.long	.LASF2578
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2579
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2580
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2581
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2582
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2583
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2584
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2585
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2586
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2587
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2588
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2577
+	.byte	0x8
+	.byte	0x34
+	.byte	0x3
+	.long	0x36f
+	.uleb128 0x11
+	.long	.LASF2594
+	.byte	0x10
+	.byte	0x8
+	.byte	0x37
+	.byte	0x10
+	.long	0x3f5
+	.uleb128 0x3
+	.long	.LASF2589
+	.byte	0x8
+	.byte	0x38
+	.byte	0x14
+	.long	0x335
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2590
+	.byte	0x8
+	.byte	0x39
+	.byte	0x9
+	.long	0x29
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2591
+	.byte	0x8
+	.byte	0x3a
+	.byte	0x3
+	.long	0x3cd
+	.uleb128 0xe
+	.long	0x3f5
+	.uleb128 0x4
+	.long	.LASF2592
+	.byte	0x8
+	.byte	0x3c
+	.byte	0x10
+	.long	0x412
+	.uleb128 0x5
+	.long	0x417
+	.uleb128 0xb
+	.long	0x427
+	.uleb128 0x2
+	.long	0xf2
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2593
+	.byte	0x8
+	.byte	0x3d
+	.byte	0x10
+	.long	0x433
+	.uleb128 0x5
+	.long	0x438
+	.uleb128 0xb
+	.long	0x44d
+	.uleb128 0x2
+	.long	0x335
+	.uleb128 0x2
+	.long	0x29
+	.uleb128 0x2
+	.long	0xa9
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2595
+	.byte	0x60
+	.byte	0x8
+	.byte	0x3f
+	.byte	0x10
+	.long	0x538
+	.uleb128 0x3
+	.long	.LASF2596
+	.byte	0x8
+	.byte	0x41
+	.byte	0x24
+	.long	0x5f4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2597
+	.byte	0x8
+	.byte	0x43
+	.byte	0xd
+	.long	0xdc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2598
+	.byte	0x8
+	.byte	0x44
+	.byte	0x10
+	.long	0x363
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF2599
+	.byte	0x8
+	.byte	0x45
+	.byte	0x13
+	.long	0x3c1
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2600
+	.byte	0x8
+	.byte	0x47
+	.byte	0xe
+	.long	0xfe
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF2601
+	.byte	0x8
+	.byte	0x49
+	.byte	0xe
+	.long	0xfe
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2602
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfe
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF2603
+	.byte	0x8
+	.byte	0x4b
+	.byte	0x17
+	.long	0x5f9
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2604
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x17
+	.long	0x5f9
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF2605
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xe
+	.long	0xfe
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF2606
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xe
+	.long	0xfe
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF2607
+	.byte	0x8
+	.byte	0x4f
+	.byte	0xe
+	.long	0xfe
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF2608
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0xfe
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF2609
+	.byte	0x8
+	.byte	0x52
+	.byte	0x1e
+	.long	0x406
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF2610
+	.byte	0x8
+	.byte	0x53
+	.byte	0xb
+	.long	0xa9
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF2611
+	.byte	0x8
+	.byte	0x55
+	.byte	0x23
+	.long	0x427
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF2612
+	.byte	0x8
+	.byte	0x58
+	.byte	0xe
+	.long	0xfe
+	.byte	0x58
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2613
+	.byte	0x68
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5ef
+	.uleb128 0x3
+	.long	.LASF2614
+	.byte	0x8
+	.byte	0x5c
+	.byte	0xc
+	.long	0x624
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2615
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x10
+	.long	0x63d
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2616
+	.byte	0x8
+	.byte	0x5f
+	.byte	0x10
+	.long	0x63d
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2617
+	.byte	0x8
+	.byte	0x61
+	.byte	0xf
+	.long	0x651
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2618
+	.byte	0x8
+	.byte	0x64
+	.byte	0xc
+	.long	0x666
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2619
+	.byte	0x8
+	.byte	0x66
+	.byte	0xb
+	.long	0x67a
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF2620
+	.byte	0x8
+	.byte	0x68
+	.byte	0xc
+	.long	0x68f
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF2621
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xc
+	.long	0x6a9
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF2622
+	.byte	0x8
+	.byte	0x6c
+	.byte	0xb
+	.long	0x67a
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF2623
+	.byte	0x8
+	.byte	0x6e
+	.byte	0xb
+	.long	0x6bd
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF2624
+	.byte	0x8
+	.byte	0x71
+	.byte	0xc
+	.long	0x6cd
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF2625
+	.byte	0x8
+	.byte	0x72
+	.byte	0xc
+	.long	0x6cd
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF2626
+	.byte	0x8
+	.byte	0x75
+	.byte	0xc
+	.long	0x6ec
+	.byte	0x60
+	.byte	0
+	.uleb128 0xe
+	.long	0x538
+	.uleb128 0x5
+	.long	0x5ef
+	.uleb128 0x5
+	.long	0xed
+	.uleb128 0x4
+	.long	.LASF2627
+	.byte	0x8
+	.byte	0x59
+	.byte	0x3
+	.long	0x44d
+	.uleb128 0xe
+	.long	0x5fe
+	.uleb128 0xb
+	.long	0x61f
+	.uleb128 0x2
+	.long	0x61f
+	.uleb128 0x2
+	.long	0xdc
+	.byte	0
+	.uleb128 0x5
+	.long	0x5fe
+	.uleb128 0x5
+	.long	0x60f
+	.uleb128 0xf
+	.long	0xfe
+	.long	0x638
+	.uleb128 0x2
+	.long	0x638
+	.byte	0
+	.uleb128 0x5
+	.long	0x60a
+	.uleb128 0x5
+	.long	0x629
+	.uleb128 0xf
+	.long	0xdc
+	.long	0x651
+	.uleb128 0x2
+	.long	0x61f
+	.byte	0
+	.uleb128 0x5
+	.long	0x642
+	.uleb128 0xb
+	.long	0x666
+	.uleb128 0x2
+	.long	0x61f
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x5
+	.long	0x656
+	.uleb128 0xf
+	.long	0x138
+	.long	0x67a
+	.uleb128 0x2
+	.long	0x638
+	.byte	0
+	.uleb128 0x5
+	.long	0x66b
+	.uleb128 0xb
+	.long	0x68f
+	.uleb128 0x2
+	.long	0x61f
+	.uleb128 0x2
+	.long	0x363
+	.byte	0
+	.uleb128 0x5
+	.long	0x67f
+	.uleb128 0xb
+	.long	0x6a9
+	.uleb128 0x2
+	.long	0x61f
+	.uleb128 0x2
+	.long	0xd6
+	.uleb128 0x2
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0x694
+	.uleb128 0xf
+	.long	0x138
+	.long	0x6bd
+	.uleb128 0x2
+	.long	0x61f
+	.byte	0
+	.uleb128 0x5
+	.long	0x6ae
+	.uleb128 0xb
+	.long	0x6cd
+	.uleb128 0x2
+	.long	0x61f
+	.byte	0
+	.uleb128 0x5
+	.long	0x6c2
+	.uleb128 0xb
+	.long	0x6e7
+	.uleb128 0x2
+	.long	0x61f
+	.uleb128 0x2
+	.long	0x6e7
+	.uleb128 0x2
+	.long	0x29
+	.byte	0
+	.uleb128 0x5
+	.long	0x401
+	.uleb128 0x5
+	.long	0x6d2
+	.uleb128 0x16
+	.long	.LASF2716
+	.byte	0xf
+	.byte	0x14
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x9
+	.byte	0x16
+	.long	0x728
+	.uleb128 0x1
+	.long	.LASF2628
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2629
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2630
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2631
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2632
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x26
+	.long	0x824
+	.uleb128 0x1
+	.long	.LASF2633
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2634
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2635
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2636
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2637
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2638
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2639
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2640
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF2641
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF2642
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF2643
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF2644
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF2645
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF2646
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF2647
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF2648
+	.value	0x8000
+	.uleb128 0x6
+	.long	.LASF2649
+	.long	0x10000
+	.uleb128 0x6
+	.long	.LASF2650
+	.long	0x20000
+	.uleb128 0x6
+	.long	.LASF2651
+	.long	0x40000
+	.uleb128 0x6
+	.long	.LASF2652
+	.long	0x80000
+	.uleb128 0x6
+	.long	.LASF2653
+	.long	0x100000
+	.uleb128 0x6
+	.long	.LASF2654
+	.long	0x200000
+	.uleb128 0x6
+	.long	.LASF2655
+	.long	0x400000
+	.uleb128 0x6
+	.long	.LASF2656
+	.long	0x800000
+	.uleb128 0x6
+	.long	.LASF2657
+	.long	0x1000000
+	.uleb128 0x6
+	.long	.LASF2658
+	.long	0x2000000
+	.uleb128 0x6
+	.long	.LASF2659
+	.long	0x4000000
+	.uleb128 0x6
+	.long	.LASF2660
+	.long	0x8000000
+	.uleb128 0x6
+	.long	.LASF2661
+	.long	0x10000000
+	.uleb128 0x6
+	.long	.LASF2662
+	.long	0x20000000
+	.uleb128 0x6
+	.long	.LASF2663
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2664
+	.byte	0x10
+	.byte	0xb
+	.byte	0x1a
+	.byte	0x10
+	.long	0x84c
+	.uleb128 0x13
+	.string	"ptr"
+	.byte	0xb
+	.byte	0x1b
+	.byte	0xe
+	.long	0x11b
+	.byte	0
+	.uleb128 0x13
+	.string	"end"
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xe
+	.long	0x11b
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2665
+	.byte	0xb
+	.byte	0x1d
+	.byte	0x3
+	.long	0x824
+	.uleb128 0x9
+	.byte	0x5
+	.long	0x29
+	.byte	0xc
+	.byte	0x22
+	.long	0x877
+	.uleb128 0x1
+	.long	.LASF2666
+	.byte	0x1
+	.uleb128 0x23
+	.long	.LASF2667
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2668
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2669
+	.byte	0xc
+	.byte	0x26
+	.byte	0x3
+	.long	0x858
+	.uleb128 0x11
+	.long	.LASF2670
+	.byte	0x18
+	.byte	0xc
+	.byte	0x28
+	.byte	0x10
+	.long	0x8c5
+	.uleb128 0x13
+	.string	"buf"
+	.byte	0xc
+	.byte	0x29
+	.byte	0xc
+	.long	0x84c
+	.byte	0
+	.uleb128 0x13
+	.string	"cmd"
+	.byte	0xc
+	.byte	0x2a
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2671
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xd
+	.long	0xdc
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF2672
+	.byte	0xc
+	.byte	0x2c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2673
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x3
+	.long	0x883
+	.uleb128 0x4
+	.long	.LASF2674
+	.byte	0xc
+	.byte	0x34
+	.byte	0x10
+	.long	0x8dd
+	.uleb128 0x5
+	.long	0x8e2
+	.uleb128 0xb
+	.long	0x8ed
+	.uleb128 0x2
+	.long	0x8ed
+	.byte	0
+	.uleb128 0x5
+	.long	0x44d
+	.uleb128 0x4
+	.long	.LASF2675
+	.byte	0xc
+	.byte	0x35
+	.byte	0x17
+	.long	0x8fe
+	.uleb128 0x5
+	.long	0x903
+	.uleb128 0xf
+	.long	0x877
+	.long	0x91c
+	.uleb128 0x2
+	.long	0x91c
+	.uleb128 0x2
+	.long	0x91c
+	.uleb128 0x2
+	.long	0x921
+	.byte	0
+	.uleb128 0x5
+	.long	0x8c5
+	.uleb128 0x5
+	.long	0x8d1
+	.uleb128 0x15
+	.long	.LASF2676
+	.long	0x4c
+	.byte	0xd
+	.byte	0x18
+	.long	0x996
+	.uleb128 0x1
+	.long	.LASF2677
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2678
+	.byte	0x1
+	.uleb128 0x24
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2679
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2680
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2682
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2683
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2684
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2685
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2686
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2687
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2688
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2689
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2690
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2691
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xe
+	.byte	0x15
+	.long	0xa62
+	.uleb128 0x1
+	.long	.LASF2692
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2693
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2694
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF2695
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF2696
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF2697
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF2698
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF2699
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF2700
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF2701
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF2702
+	.value	0x8000
+	.uleb128 0x6
+	.long	.LASF2703
+	.long	0x10000
+	.uleb128 0x6
+	.long	.LASF2704
+	.long	0x20000
+	.uleb128 0x6
+	.long	.LASF2705
+	.long	0x40000
+	.uleb128 0x6
+	.long	.LASF2706
+	.long	0x80000
+	.uleb128 0x6
+	.long	.LASF2707
+	.long	0x100000
+	.uleb128 0x6
+	.long	.LASF2708
+	.long	0x200000
+	.uleb128 0x6
+	.long	.LASF2709
+	.long	0x400000
+	.uleb128 0x6
+	.long	.LASF2710
+	.long	0x800000
+	.uleb128 0x6
+	.long	.LASF2711
+	.long	0x1000000
+	.uleb128 0x6
+	.long	.LASF2712
+	.long	0x2000000
+	.uleb128 0x6
+	.long	.LASF2713
+	.long	0x4000000
+	.uleb128 0x6
+	.long	.LASF2714
+	.long	0x8000000
+	.uleb128 0x6
+	.long	.LASF2715
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2717
+	.byte	0xe
+	.byte	0x47
+	.byte	0x11
+	.long	0xfe
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x10
+	.byte	0x39
+	.long	0xac3
+	.uleb128 0x1
+	.long	.LASF2718
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2719
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2720
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2721
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2722
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2724
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2725
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2726
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2727
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2728
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2729
+	.byte	0xb
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x11
+	.byte	0x2e
+	.long	0xd5e
+	.uleb128 0x1
+	.long	.LASF2730
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2731
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2732
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2733
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2734
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2736
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2737
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2738
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2739
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2740
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2741
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2742
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2743
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2744
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2745
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2746
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2747
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2748
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2749
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2750
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2751
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2752
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2753
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2754
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2755
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2756
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2757
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2758
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2759
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2760
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2761
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2762
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2763
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2764
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2765
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2766
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2767
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2768
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2769
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2770
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2771
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2772
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2773
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2774
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2775
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2776
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2777
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2778
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2779
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF2780
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF2781
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF2782
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2783
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF2784
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF2785
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF2786
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2787
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF2788
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF2789
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF2790
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF2791
+	.byte	0x3d
+	.uleb128 0x1
+	.long	.LASF2792
+	.byte	0x3e
+	.uleb128 0x1
+	.long	.LASF2793
+	.byte	0x3f
+	.uleb128 0x1
+	.long	.LASF2794
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2795
+	.byte	0x41
+	.uleb128 0x1
+	.long	.LASF2796
+	.byte	0x42
+	.uleb128 0x1
+	.long	.LASF2797
+	.byte	0x43
+	.uleb128 0x1
+	.long	.LASF2798
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF2799
+	.byte	0x45
+	.uleb128 0x1
+	.long	.LASF2800
+	.byte	0x46
+	.uleb128 0x1
+	.long	.LASF2801
+	.byte	0x47
+	.uleb128 0x1
+	.long	.LASF2802
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2803
+	.byte	0x49
+	.uleb128 0x1
+	.long	.LASF2804
+	.byte	0x4a
+	.uleb128 0x1
+	.long	.LASF2805
+	.byte	0x4b
+	.uleb128 0x1
+	.long	.LASF2806
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF2807
+	.byte	0x4d
+	.uleb128 0x1
+	.long	.LASF2808
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF2809
+	.byte	0x4f
+	.uleb128 0x1
+	.long	.LASF2810
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2811
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF2812
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF2813
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF2814
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF2815
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF2816
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF2817
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF2818
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2819
+	.byte	0x59
+	.uleb128 0x1
+	.long	.LASF2820
+	.byte	0x5a
+	.uleb128 0x1
+	.long	.LASF2821
+	.byte	0x5b
+	.uleb128 0x1
+	.long	.LASF2822
+	.byte	0x5c
+	.uleb128 0x1
+	.long	.LASF2823
+	.byte	0x5d
+	.uleb128 0x1
+	.long	.LASF2824
+	.byte	0x5e
+	.uleb128 0x1
+	.long	.LASF2825
+	.byte	0x5f
+	.uleb128 0x1
+	.long	.LASF2826
+	.byte	0x60
+	.uleb128 0x1
+	.long	.LASF2827
+	.byte	0x61
+	.uleb128 0x1
+	.long	.LASF2828
+	.byte	0x62
+	.uleb128 0x1
+	.long	.LASF2829
+	.byte	0x63
+	.uleb128 0x1
+	.long	.LASF2830
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF2831
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF2832
+	.byte	0x66
+	.uleb128 0x1
+	.long	.LASF2833
+	.byte	0x67
+	.uleb128 0x1
+	.long	.LASF2834
+	.byte	0x68
+	.uleb128 0x1
+	.long	.LASF2835
+	.byte	0x69
+	.uleb128 0x1
+	.long	.LASF2836
+	.byte	0x6a
+	.uleb128 0x1
+	.long	.LASF2837
+	.byte	0x6b
+	.uleb128 0x1
+	.long	.LASF2838
+	.byte	0x6c
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x12
+	.byte	0x1c
+	.long	0xe6d
+	.uleb128 0x1
+	.long	.LASF2839
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2840
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2841
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2842
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2843
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2845
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2846
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2847
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2848
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2849
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2850
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2851
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2852
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2853
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2854
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2855
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2856
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2857
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2858
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2859
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2860
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2861
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2862
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2863
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2864
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2865
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2866
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2867
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2868
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2869
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2870
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2871
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2872
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2873
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2874
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2875
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2876
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2877
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2878
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2879
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2880
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2881
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x13
+	.byte	0x30
+	.long	0xe86
+	.uleb128 0x1
+	.long	.LASF2882
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2883
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2884
+	.byte	0x13
+	.byte	0x33
+	.byte	0x3
+	.long	0xe6d
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x14
+	.byte	0x18
+	.long	0xec9
+	.uleb128 0x1
+	.long	.LASF2885
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2886
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2887
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2888
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2890
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2891
+	.byte	0xff
+	.byte	0
+	.uleb128 0x19
+	.long	0xf2
+	.long	0xed9
+	.uleb128 0x1a
+	.long	0x22
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x14
+	.byte	0x3a
+	.long	0xf64
+	.uleb128 0x1
+	.long	.LASF2892
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2893
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2894
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2895
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2896
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2898
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2899
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2900
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2901
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2902
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2903
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2904
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2905
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2906
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2907
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2908
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2909
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2910
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2911
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2912
+	.byte	0x13
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2913
+	.byte	0x14
+	.byte	0x8d
+	.byte	0x3
+	.long	0xed9
+	.uleb128 0x25
+	.byte	0x98
+	.byte	0x14
+	.byte	0x8f
+	.byte	0x9
+	.long	0x103d
+	.uleb128 0x3
+	.long	.LASF2914
+	.byte	0x14
+	.byte	0x91
+	.byte	0x12
+	.long	0x146
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2915
+	.byte	0x14
+	.byte	0x92
+	.byte	0xb
+	.long	0x1051
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF2916
+	.byte	0x14
+	.byte	0x93
+	.byte	0xc
+	.long	0x1061
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF2917
+	.byte	0x14
+	.byte	0x94
+	.byte	0x11
+	.long	0x120
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF2918
+	.byte	0x14
+	.byte	0x95
+	.byte	0x13
+	.long	0xe8
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF2919
+	.byte	0x14
+	.byte	0x98
+	.byte	0xe
+	.long	0xf2
+	.byte	0x1e
+	.uleb128 0x3
+	.long	.LASF2920
+	.byte	0x14
+	.byte	0x99
+	.byte	0xe
+	.long	0xf2
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF2921
+	.byte	0x14
+	.byte	0x9a
+	.byte	0xe
+	.long	0x12c
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF2922
+	.byte	0x14
+	.byte	0x9b
+	.byte	0xe
+	.long	0x12c
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF2923
+	.byte	0x14
+	.byte	0x9c
+	.byte	0x11
+	.long	0x120
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF2924
+	.byte	0x14
+	.byte	0x9f
+	.byte	0xe
+	.long	0x12c
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF2925
+	.byte	0x14
+	.byte	0xa1
+	.byte	0xe
+	.long	0x12c
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF2926
+	.byte	0x14
+	.byte	0xa2
+	.byte	0xe
+	.long	0x12c
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF2927
+	.byte	0x14
+	.byte	0xa3
+	.byte	0xe
+	.long	0xec9
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF2928
+	.byte	0x14
+	.byte	0xa4
+	.byte	0xe
+	.long	0xec9
+	.byte	0x78
+	.byte	0
+	.uleb128 0xf
+	.long	0x138
+	.long	0x1051
+	.uleb128 0x2
+	.long	0x12c
+	.uleb128 0x2
+	.long	0x120
+	.byte	0
+	.uleb128 0x5
+	.long	0x103d
+	.uleb128 0xb
+	.long	0x1061
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x5
+	.long	0x1056
+	.uleb128 0x4
+	.long	.LASF2929
+	.byte	0x14
+	.byte	0xa6
+	.byte	0x3
+	.long	0xf70
+	.uleb128 0x19
+	.long	0x1066
+	.long	0x1082
+	.uleb128 0x1a
+	.long	0x22
+	.byte	0x11
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2930
+	.byte	0x14
+	.byte	0xa8
+	.byte	0x11
+	.long	0x1072
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x15
+	.byte	0x14
+	.long	0x10cb
+	.uleb128 0x1
+	.long	.LASF2931
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2932
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2933
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2934
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2935
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2936
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2937
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2938
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x15
+	.byte	0x30
+	.long	0x1116
+	.uleb128 0x1
+	.long	.LASF2939
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2940
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2941
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2942
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2943
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2944
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2945
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2946
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF2947
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF2948
+	.value	0x200
+	.byte	0
+	.uleb128 0x26
+	.long	0x1082
+	.byte	0x29
+	.value	0x181
+	.byte	0xa
+	.uleb128 0x8
+	.long	.LASF2949
+	.byte	0x6
+	.byte	0x4e
+	.long	0x1130
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2950
+	.byte	0x16
+	.byte	0x8c
+	.long	0x1141
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2951
+	.byte	0x17
+	.byte	0x31
+	.long	0x1152
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2952
+	.byte	0x18
+	.byte	0x34
+	.long	0x1163
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2953
+	.byte	0x19
+	.byte	0x1c
+	.long	0x1174
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2954
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x1185
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2973
+	.byte	0x1a
+	.byte	0x19
+	.byte	0x5
+	.long	0x138
+	.long	0x11a0
+	.uleb128 0x2
+	.long	0x12c
+	.uleb128 0x2
+	.long	0x120
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2955
+	.byte	0x1a
+	.byte	0x1c
+	.long	0x11b1
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2956
+	.byte	0x14
+	.byte	0xb6
+	.long	0x11c2
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2958
+	.byte	0x18
+	.byte	0x36
+	.byte	0x5
+	.long	0x138
+	.uleb128 0x8
+	.long	.LASF2957
+	.byte	0x14
+	.byte	0xae
+	.long	0x11e4
+	.uleb128 0x2
+	.long	0xf64
+	.uleb128 0x2
+	.long	0x138
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2959
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xa
+	.long	0xfe
+	.uleb128 0x10
+	.long	.LASF2962
+	.byte	0x14
+	.byte	0xb4
+	.uleb128 0x8
+	.long	.LASF2960
+	.byte	0x1b
+	.byte	0x26
+	.long	0x1208
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2961
+	.byte	0x1c
+	.byte	0x61
+	.long	0x1219
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2963
+	.byte	0x1c
+	.byte	0x60
+	.uleb128 0x17
+	.long	.LASF2964
+	.value	0x18c
+	.long	0x1231
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2965
+	.byte	0x1e
+	.byte	0x47
+	.long	0x1242
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2966
+	.value	0x18e
+	.long	0x1253
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2967
+	.byte	0x1f
+	.byte	0x45
+	.uleb128 0x17
+	.long	.LASF2968
+	.value	0x18b
+	.long	0x126b
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2969
+	.byte	0x14
+	.byte	0xad
+	.long	0x1281
+	.uleb128 0x2
+	.long	0xf64
+	.uleb128 0x2
+	.long	0x120
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2970
+	.byte	0x20
+	.byte	0x3b
+	.byte	0xa
+	.long	0xfe
+	.uleb128 0x8
+	.long	.LASF2971
+	.byte	0x21
+	.byte	0x48
+	.long	0x129e
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2972
+	.byte	0x22
+	.byte	0xa1
+	.long	0x12af
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2974
+	.byte	0xe
+	.byte	0xa3
+	.byte	0x5
+	.long	0x138
+	.long	0x12c5
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2975
+	.byte	0x23
+	.byte	0x23
+	.long	0x12d6
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2976
+	.byte	0x22
+	.byte	0xa0
+	.byte	0x5
+	.long	0x138
+	.uleb128 0x14
+	.long	.LASF2977
+	.byte	0x24
+	.byte	0x1e
+	.byte	0x5
+	.long	0x138
+	.long	0x12f8
+	.uleb128 0x2
+	.long	0xfe
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2978
+	.byte	0x25
+	.byte	0x2f
+	.uleb128 0x8
+	.long	.LASF2979
+	.byte	0x26
+	.byte	0x9b
+	.long	0x1310
+	.uleb128 0x2
+	.long	0x12c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2980
+	.byte	0x26
+	.byte	0x94
+	.byte	0x5
+	.long	0x138
+	.uleb128 0x10
+	.long	.LASF2981
+	.byte	0x27
+	.byte	0x40
+	.uleb128 0x14
+	.long	.LASF2982
+	.byte	0x28
+	.byte	0x17
+	.byte	0xd
+	.long	0x877
+	.long	0x1343
+	.uleb128 0x2
+	.long	0x91c
+	.uleb128 0x2
+	.long	0x91c
+	.uleb128 0x2
+	.long	0x921
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2983
+	.byte	0x13
+	.byte	0x6b
+	.long	0x1359
+	.uleb128 0x2
+	.long	0xe86
+	.uleb128 0x2
+	.long	0x8f2
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2984
+	.byte	0xf
+	.byte	0x18
+	.uleb128 0x27
+	.long	.LASF3001
+	.byte	0x29
+	.value	0x129
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF2985
+	.value	0x118
+	.long	0x1381
+	.uleb128 0x1c
+	.long	.LASF2987
+	.value	0x118
+	.byte	0x1c
+	.long	0x12c
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2986
+	.value	0x10a
+	.long	0x1399
+	.uleb128 0x1c
+	.long	.LASF2987
+	.value	0x10a
+	.byte	0x23
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2988
+	.byte	0xf7
+	.long	0x13af
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0xf7
+	.byte	0x1d
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2989
+	.byte	0xe3
+	.long	0x13c5
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0xe3
+	.byte	0x25
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2990
+	.byte	0xb8
+	.long	0x13db
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0xb8
+	.byte	0x1f
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2991
+	.byte	0xa8
+	.long	0x13fc
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0xa8
+	.byte	0x1e
+	.long	0x12c
+	.uleb128 0x18
+	.long	.LASF2996
+	.byte	0xae
+	.byte	0x14
+	.long	0x10a
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2992
+	.byte	0x9f
+	.long	0x1412
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0x9f
+	.byte	0x21
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2993
+	.byte	0x8b
+	.long	0x1428
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0x8b
+	.byte	0x1e
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2994
+	.byte	0x84
+	.long	0x143e
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0x84
+	.byte	0x25
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2995
+	.byte	0x72
+	.long	0x146a
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0x72
+	.byte	0x21
+	.long	0x12c
+	.uleb128 0x18
+	.long	.LASF2997
+	.byte	0x74
+	.byte	0x15
+	.long	0x12c
+	.uleb128 0x18
+	.long	.LASF2998
+	.byte	0x75
+	.byte	0xe
+	.long	0x12c
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2999
+	.byte	0x61
+	.long	0x1480
+	.uleb128 0xd
+	.long	.LASF2987
+	.byte	0x61
+	.byte	0x20
+	.long	0x12c
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF3002
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1b
+	.long	0x120
+	.uleb128 0x1d
+	.string	"a"
+	.byte	0x2e
+	.long	0x12c
+	.uleb128 0x1d
+	.string	"b"
+	.byte	0x3a
+	.long	0x12c
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 41
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 42 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 43 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 44 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 46 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 47 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x2f
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 50 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF544
+	.file 52 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x34
+	.file 53 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 54 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF610
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF646
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 59 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF674
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF675
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF735
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x3e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF749
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF750
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF567
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF754
+	.file 66 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF755
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF772
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF785
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x49
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF811
+	.file 78 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF812
+	.file 79 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF813
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 80 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x50
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF825
+	.byte	0x4
+	.file 81 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 82 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x52
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x4
+	.file 83 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF837
+	.file 84 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x54
+	.byte	0x4
+	.file 85 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x4
+	.file 86 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x56
+	.file 87 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF905
+	.byte	0x4
+	.file 89 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x59
+	.file 90 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 91 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 92 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x5c
+	.byte	0x4
+	.file 93 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.file 94 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5e
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.file 95 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5f
+	.file 96 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x19
+	.file 97 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 98 "./src/main/cms/cms_types.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x62
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 99 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 100 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x64
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x16
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1224
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 101 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x65
+	.file 102 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x66
+	.file 103 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x67
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x4
+	.file 104 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x68
+	.file 105 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x69
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1231
+	.byte	0x4
+	.file 106 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1232
+	.file 107 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6b
+	.byte	0x4
+	.byte	0x4
+	.file 108 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6c
+	.file 109 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1245
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 110 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x6e
+	.file 111 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6f
+	.file 112 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x70
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 113 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x71
+	.file 114 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.file 115 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1549
+	.byte	0x4
+	.file 116 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.file 117 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 118 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x76
+	.byte	0x4
+	.file 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x76
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.file 120 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x78
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x8
+	.file 121 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x79
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 122 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x7a
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.file 123 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x7b
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 124 "./src/main/drivers/stack_check.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x7c
+	.byte	0x4
+	.file 125 "./src/main/drivers/pwm_mapping.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7d
+	.file 126 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7e
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 127 "./src/main/flight/servos.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7f
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2097
+	.byte	0x4
+	.file 128 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x80
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2098
+	.byte	0x4
+	.file 129 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x81
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.file 130 "./src/main/fc/fc_core.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2104
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.file 131 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x83
+	.file 132 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x84
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x23
+	.byte	0x4
+	.file 133 "./src/main/flight/rpm_filter.h"
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x85
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1d
+	.file 134 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x86
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x4
+	.file 135 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x87
+	.byte	0x7
+	.long	.Ldebug_macro84
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro85
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro86
+	.byte	0x4
+	.file 136 "./src/main/io/beeper.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x88
+	.byte	0x4
+	.file 137 "./src/main/io/lights.h"
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x89
+	.byte	0x4
+	.file 138 "./src/main/io/dashboard.h"
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x8a
+	.byte	0x4
+	.file 139 "./src/main/io/ledstrip.h"
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x8b
+	.byte	0x7
+	.long	.Ldebug_macro87
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x11
+	.file 140 "./src/main/drivers/osd.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8c
+	.byte	0x7
+	.long	.Ldebug_macro88
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro89
+	.byte	0x4
+	.file 141 "./src/main/io/pwmdriver_i2c.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x8d
+	.byte	0x4
+	.file 142 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x8e
+	.byte	0x4
+	.file 143 "./src/main/io/rcdevice_cam.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x8f
+	.file 144 "/usr/include/stdio.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x90
+	.byte	0x7
+	.long	.Ldebug_macro90
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro91
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2228
+	.file 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x91
+	.byte	0x7
+	.long	.Ldebug_macro93
+	.byte	0x4
+	.file 146 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x92
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2231
+	.file 147 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x93
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0x4
+	.byte	0x4
+	.file 148 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x94
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0x4
+	.file 149 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x95
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0x4
+	.file 150 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x96
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0x4
+	.file 151 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x97
+	.byte	0x7
+	.long	.Ldebug_macro94
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro95
+	.file 152 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h"
+	.byte	0x3
+	.uleb128 0x85
+	.uleb128 0x98
+	.byte	0x7
+	.long	.Ldebug_macro96
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro97
+	.file 153 "/usr/include/x86_64-linux-gnu/bits/stdio.h"
+	.byte	0x3
+	.uleb128 0x386
+	.uleb128 0x99
+	.byte	0x7
+	.long	.Ldebug_macro98
+	.byte	0x4
+	.byte	0x4
+	.file 154 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x9a
+	.byte	0x7
+	.long	.Ldebug_macro99
+	.file 155 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x9b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2296
+	.file 156 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2297
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro100
+	.byte	0x4
+	.file 157 "./src/main/io/rcdevice.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x9d
+	.byte	0x7
+	.long	.Ldebug_macro101
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.file 158 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9e
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro102
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro103
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro104
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x43
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x44
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x13
+	.file 159 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro105
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro106
+	.byte	0x4
+	.file 160 "./src/main/io/servo_sbus.h"
+	.byte	0x3
+	.uleb128 0x45
+	.uleb128 0xa0
+	.byte	0x4
+	.file 161 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x49
+	.uleb128 0xa1
+	.byte	0x7
+	.long	.Ldebug_macro107
+	.byte	0x4
+	.file 162 "./src/main/rx/eleres.h"
+	.byte	0x3
+	.uleb128 0x4a
+	.uleb128 0xa2
+	.file 163 "./src/main/rx/rx_spi.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0xa3
+	.byte	0x7
+	.long	.Ldebug_macro108
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro109
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4f
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro110
+	.byte	0x4
+	.file 164 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x50
+	.uleb128 0xa4
+	.byte	0x7
+	.long	.Ldebug_macro111
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x51
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro112
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x52
+	.uleb128 0x20
+	.file 165 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa5
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x53
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro113
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x54
+	.uleb128 0x21
+	.byte	0x4
+	.file 166 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x55
+	.uleb128 0xa6
+	.byte	0x7
+	.long	.Ldebug_macro114
+	.byte	0x4
+	.file 167 "./src/main/sensors/irlock.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0xa7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x57
+	.uleb128 0x1f
+	.file 168 "./src/main/common/calibration.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xa8
+	.file 169 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa9
+	.byte	0x7
+	.long	.Ldebug_macro115
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro116
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.file 170 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0xaa
+	.byte	0x7
+	.long	.Ldebug_macro117
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro92
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 171 "./src/main/drivers/pitotmeter.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xab
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro118
+	.byte	0x4
+	.file 172 "./src/main/sensors/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x58
+	.uleb128 0xac
+	.file 173 "./src/main/drivers/rangefinder/rangefinder.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xad
+	.byte	0x7
+	.long	.Ldebug_macro119
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x1e
+	.file 174 "./src/main/drivers/opflow/opflow.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xae
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5b
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2466
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x5f
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro120
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF464
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF604
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF824
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1094
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1129
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1142
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1179
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1187
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.color.h.27.7f3f9859268ea7cdcf62d89e4d78a795,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.global_functions.h.29.fb1af0cee01f455e1be8fe7fa6b2a019,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1262
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1271
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1551
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1581
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1581
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1569
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1570
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1571
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1572
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1590
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1591
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1592
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1593
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1600
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1601
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1602
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1603
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1604
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1605
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1642
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1678
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2089
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_mapping.h.29.5f2a3671df9c4f1621241af7b58f1e07,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2093
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2094
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2095
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2099
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2100
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2102
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2103
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2106
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2108
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2115
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2124
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2132
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rpm_filter.h.46.638ccbdb612f529ec85646b839a0f5ec,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2140
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro84:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2142
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2144
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2148
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro85:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2156
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro86:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2159
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ledstrip.h.23.07e6db349d33c881d752095c9d043f6d,comdat
+.Ldebug_macro87:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2200
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro88:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2211
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.cef84115c5f2700d3af586ea6b7bb2c4,comdat
+.Ldebug_macro89:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2213
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2216
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.24.5c1b97eef3c86b7a2549420f69f4f128,comdat
+.Ldebug_macro90:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro91:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro92:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.34.3a23a216c0c293b3d2ea2e89281481e6,comdat
+.Ldebug_macro93:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_FILE.h.19.0888ac70396abe1031c03d393554032f,comdat
+.Ldebug_macro94:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2243
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.53.139e45cf040c0964b2932c0c1bdaf6b2,comdat
+.Ldebug_macro95:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2252
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio_lim.h.19.e4b00b560d878dcfbc6635b3406640c5,comdat
+.Ldebug_macro96:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2258
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2260
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.147.dbd603e98db8f3e1583090fab2abd54e,comdat
+.Ldebug_macro97:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2263
+	.byte	0x6
+	.uleb128 0xb4
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdio.h.20.b0caa08e5723aa5941367be0e5d2ec59,comdat
+.Ldebug_macro98:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2269
+	.byte	0x6
+	.uleb128 0xc1
+	.long	.LASF2270
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.23.c805eb1c9d1e071571a14d314e366ed6,comdat
+.Ldebug_macro99:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2295
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro100:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice.h.25.ab71b74eff9152b05356e04bd1f208bf,comdat
+.Ldebug_macro101:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2343
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro102:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2347
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro103:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rcdevice_cam.h.29.f99909877ac3f04c1606d791179d7a71,comdat
+.Ldebug_macro104:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2361
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro105:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd_dji_hd.h.34.8e36c80b905d9e2065cf4c2344359f0e,comdat
+.Ldebug_macro106:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2393
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro107:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2421
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx_spi.h.65.71b730210566b56bcb0ed42c8dce3508,comdat
+.Ldebug_macro108:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2427
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.35.d0d785404ac74fe33f68f976f92c394d,comdat
+.Ldebug_macro109:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF2432
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro110:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro111:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2441
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.temperature.h.22.e3be097e37ed0a45eba857cc18097eab,comdat
+.Ldebug_macro112:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2444
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro113:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro114:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro115:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro116:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro117:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro118:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rangefinder.h.24.2f81a392db601e53aad014e91c62b2b6,comdat
+.Ldebug_macro119:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.uav_interconnect.h.38.dae2cc39206b50ac1e1ad20244a99294,comdat
+.Ldebug_macro120:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2472
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1f
+	.long	.LASF1
+	.long	.LASF3003
+	.long	.LASF3004
+	.long	.LASF3005
+	.long	.LASF3006
+	.long	.LASF3007
+	.long	.LASF3008
+	.long	.LASF3009
+	.long	.LASF3010
+	.long	.LASF3011
+	.long	.LASF3012
+	.long	.LASF3013
+	.long	.LASF3014
+	.long	.LASF3015
+	.long	.LASF3016
+	.long	.LASF3017
+	.long	.LASF3018
+	.long	.LASF3019
+	.long	.LASF3020
+	.long	.LASF3021
+	.long	.LASF3022
+	.long	.LASF3023
+	.long	.LASF3024
+	.long	.LASF3025
+	.long	.LASF3026
+	.long	.LASF3027
+	.long	.LASF3028
+	.long	.LASF3029
+	.long	.LASF3030
+	.long	.LASF3031
+	.long	.LASF3032
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0xaf
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3033
+	.byte	0x1a
+	.long	.LASF3034
+	.byte	0x1a
+	.long	.LASF3035
+	.byte	0x1a
+	.long	.LASF3036
+	.byte	0x4
+	.long	.LASF3037
+	.byte	0x4
+	.long	.LASF3038
+	.byte	0x4
+	.long	.LASF3039
+	.byte	0xb
+	.long	.LASF3040
+	.byte	0xb
+	.long	.LASF3041
+	.byte	0xb
+	.long	.LASF3042
+	.byte	0xc
+	.long	.LASF3043
+	.byte	0x4
+	.long	.LASF3044
+	.byte	0xf
+	.long	.LASF3045
+	.byte	0xc
+	.long	.LASF3046
+	.byte	0xc
+	.long	.LASF3047
+	.byte	0xc
+	.long	.LASF3048
+	.byte	0xd
+	.long	.LASF3049
+	.byte	0xe
+	.long	.LASF3050
+	.byte	0xc
+	.long	.LASF3051
+	.byte	0xf
+	.long	.LASF3052
+	.byte	0x12
+	.long	.LASF3053
+	.byte	0x13
+	.long	.LASF3054
+	.byte	0x4
+	.long	.LASF3055
+	.byte	0xe
+	.long	.LASF3056
+	.byte	0x17
+	.long	.LASF3057
+	.byte	0x3
+	.long	.LASF3058
+	.byte	0xc
+	.long	.LASF3059
+	.byte	0x1
+	.long	.LASF3060
+	.byte	0x16
+	.long	.LASF3061
+	.byte	0x10
+	.long	.LASF3062
+	.byte	0x13
+	.long	.LASF3063
+	.byte	0x13
+	.long	.LASF3064
+	.byte	0x13
+	.long	.LASF3065
+	.byte	0x13
+	.long	.LASF3066
+	.byte	0xe
+	.long	.LASF3067
+	.byte	0xd
+	.long	.LASF3068
+	.byte	0x5
+	.long	.LASF3069
+	.byte	0x13
+	.long	.LASF3070
+	.byte	0x13
+	.long	.LASF3071
+	.byte	0xe
+	.long	.LASF3072
+	.byte	0xc
+	.long	.LASF3073
+	.byte	0xc
+	.long	.LASF3074
+	.byte	0x1d
+	.long	.LASF3075
+	.byte	0x1e
+	.long	.LASF3076
+	.byte	0x1d
+	.long	.LASF3077
+	.byte	0x1a
+	.long	.LASF3078
+	.byte	0x1d
+	.long	.LASF3079
+	.byte	0x1d
+	.long	.LASF3080
+	.byte	0x1a
+	.long	.LASF3081
+	.byte	0x1a
+	.long	.LASF3082
+	.byte	0x1c
+	.long	.LASF3083
+	.byte	0x1a
+	.long	.LASF3084
+	.byte	0x1b
+	.long	.LASF3085
+	.byte	0x1b
+	.long	.LASF3086
+	.byte	0x1e
+	.long	.LASF3087
+	.byte	0x1a
+	.long	.LASF3088
+	.byte	0x1a
+	.long	.LASF3089
+	.byte	0x1a
+	.long	.LASF3090
+	.byte	0x1a
+	.long	.LASF3033
+	.byte	0x1c
+	.long	.LASF3091
+	.byte	0x1a
+	.long	.LASF3092
+	.byte	0x1a
+	.long	.LASF3093
+	.byte	0x19
+	.long	.LASF3094
+	.byte	0x19
+	.long	.LASF3095
+	.byte	0x19
+	.long	.LASF3096
+	.byte	0x19
+	.long	.LASF3097
+	.byte	0x1d
+	.long	.LASF3097
+	.byte	0x1a
+	.long	.LASF3098
+	.byte	0x1a
+	.long	.LASF3099
+	.byte	0x1a
+	.long	.LASF3100
+	.byte	0x1a
+	.long	.LASF3101
+	.byte	0x1c
+	.long	.LASF3101
+	.byte	0x1a
+	.long	.LASF3102
+	.byte	0x19
+	.long	.LASF3103
+	.byte	0x19
+	.long	.LASF3104
+	.byte	0x19
+	.long	.LASF3105
+	.byte	0x19
+	.long	.LASF3106
+	.byte	0x1a
+	.long	.LASF3107
+	.byte	0x1a
+	.long	.LASF3108
+	.byte	0x1a
+	.long	.LASF3109
+	.byte	0x1a
+	.long	.LASF3110
+	.byte	0x1a
+	.long	.LASF3111
+	.byte	0x1a
+	.long	.LASF3112
+	.byte	0x1d
+	.long	.LASF3113
+	.byte	0x1a
+	.long	.LASF3114
+	.byte	0x1a
+	.long	.LASF3115
+	.byte	0x1e
+	.long	.LASF3115
+	.byte	0x1d
+	.long	.LASF3116
+	.byte	0x1a
+	.long	.LASF3117
+	.byte	0x18
+	.long	.LASF3118
+	.byte	0x15
+	.long	.LASF3119
+	.byte	0x14
+	.long	.LASF3120
+	.byte	0x15
+	.long	.LASF3121
+	.byte	0x15
+	.long	.LASF3122
+	.byte	0x1
+	.long	.LASF3123
+	.byte	0x5
+	.long	.LASF3124
+	.byte	0x2
+	.long	.LASF3125
+	.byte	0xb
+	.long	.LASF3126
+	.byte	0x3
+	.long	.LASF3127
+	.byte	0x4
+	.long	.LASF3128
+	.byte	0x4
+	.long	.LASF3129
+	.byte	0x6
+	.long	.LASF3130
+	.byte	0xb
+	.long	.LASF3131
+	.byte	0xb
+	.long	.LASF3132
+	.byte	0xb
+	.long	.LASF3133
+	.byte	0xb
+	.long	.LASF3134
+	.byte	0xb
+	.long	.LASF3135
+	.byte	0xb
+	.long	.LASF3136
+	.byte	0xb
+	.long	.LASF3137
+	.byte	0xb
+	.long	.LASF3065
+	.byte	0x8
+	.long	.LASF3138
+	.byte	0x4
+	.long	.LASF3139
+	.byte	0x1d
+	.long	.LASF3140
+	.byte	0x1a
+	.long	.LASF3141
+	.byte	0x1a
+	.long	.LASF3142
+	.byte	0x1a
+	.long	.LASF3143
+	.byte	0x1a
+	.long	.LASF3144
+	.byte	0x1a
+	.long	.LASF3145
+	.byte	0x1a
+	.long	.LASF3146
+	.byte	0x1a
+	.long	.LASF3147
+	.byte	0x4
+	.long	.LASF3148
+	.byte	0xb
+	.long	.LASF3149
+	.byte	0xb
+	.long	.LASF3150
+	.byte	0xb
+	.long	.LASF3151
+	.byte	0xb
+	.long	.LASF3152
+	.byte	0xb
+	.long	.LASF3153
+	.byte	0xd
+	.long	.LASF3154
+	.byte	0xd
+	.long	.LASF3155
+	.byte	0xb
+	.long	.LASF3156
+	.byte	0xc
+	.long	.LASF3157
+	.byte	0xc
+	.long	.LASF3158
+	.byte	0xd
+	.long	.LASF3159
+	.byte	0x4
+	.long	.LASF3160
+	.byte	0xd
+	.long	.LASF3161
+	.byte	0x4
+	.long	.LASF3162
+	.byte	0xd
+	.long	.LASF3163
+	.byte	0xe
+	.long	.LASF3164
+	.byte	0xe
+	.long	.LASF3165
+	.byte	0xe
+	.long	.LASF3166
+	.byte	0xe
+	.long	.LASF3049
+	.byte	0xb
+	.long	.LASF3167
+	.byte	0xe
+	.long	.LASF3040
+	.byte	0xe
+	.long	.LASF3168
+	.byte	0xe
+	.long	.LASF3169
+	.byte	0x1d
+	.long	.LASF3170
+	.byte	0x1e
+	.long	.LASF3171
+	.byte	0x19
+	.long	.LASF3172
+	.byte	0x19
+	.long	.LASF3173
+	.byte	0x19
+	.long	.LASF3174
+	.byte	0x19
+	.long	.LASF3175
+	.byte	0x19
+	.long	.LASF3176
+	.byte	0x19
+	.long	.LASF3177
+	.byte	0x1a
+	.long	.LASF3169
+	.byte	0x1a
+	.long	.LASF3178
+	.byte	0x1d
+	.long	.LASF3179
+	.byte	0x19
+	.long	.LASF3180
+	.byte	0x19
+	.long	.LASF3181
+	.byte	0xe
+	.long	.LASF3182
+	.byte	0x4
+	.long	.LASF3036
+	.byte	0xb
+	.long	.LASF3183
+	.byte	0xe
+	.long	.LASF3184
+	.byte	0x11
+	.long	.LASF3185
+	.byte	0x11
+	.long	.LASF3186
+	.byte	0x11
+	.long	.LASF3187
+	.byte	0x13
+	.long	.LASF3064
+	.byte	0x7
+	.long	.LASF3188
+	.byte	0x13
+	.long	.LASF3189
+	.byte	0x13
+	.long	.LASF3190
+	.byte	0x4
+	.long	.LASF3191
+	.byte	0x1d
+	.long	.LASF3192
+	.byte	0x1d
+	.long	.LASF3063
+	.byte	0xb
+	.long	.LASF3193
+	.byte	0x13
+	.long	.LASF3193
+	.byte	0xa
+	.long	.LASF3062
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1831:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2475:
+	.string	"long long int"
+.LASF2137:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF2170:
+	.string	"LED_COLOR_OFFSET 18"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1386:
+	.string	"__DECL_SIMD_exp10l "
+.LASF2297:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF930:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF868:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1007:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF2605:
+	.string	"rxBufferHead"
+.LASF1468:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF2867:
+	.string	"BOXAUTOTUNE"
+.LASF2017:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1725:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF919:
+	.string	"USE_BLACKBOX "
+.LASF1381:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1123:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF593:
+	.string	"_T_WCHAR "
+.LASF2611:
+	.string	"rxFrameCallback"
+.LASF936:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1968:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1450:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1324:
+	.string	"__DECL_SIMD_pow "
+.LASF2969:
+	.string	"rescheduleTask"
+.LASF2422:
+	.string	"RC_CHANNEL_RATE RC_SPI_AUX1"
+.LASF1895:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF610:
+	.string	"_STDLIB_H 1"
+.LASF1464:
+	.string	"__DECL_SIMD_log1p "
+.LASF2271:
+	.string	"_CTYPE_H 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2500:
+	.string	"RGB_GREEN"
+.LASF2923:
+	.string	"taskLatestDeltaTime"
+.LASF2135:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF2473:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2090:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF589:
+	.string	"__wchar_t__ "
+.LASF1809:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1168:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1287:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2749:
+	.string	"OSD_POWER"
+.LASF1627:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1053:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1930:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1922:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"__DECL_SIMD_acosf "
+.LASF2499:
+	.string	"RGB_RED"
+.LASF2139:
+	.string	"RPM_FILTER_UPDATE_RATE_HZ 500"
+.LASF2338:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_RELEASE 0x03"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1061:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF2664:
+	.string	"sbuf_s"
+.LASF2665:
+	.string	"sbuf_t"
+.LASF1853:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1976:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2545:
+	.string	"OWNER_1WIRE"
+.LASF1867:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2044:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1657:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1340:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1393:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2152:
+	.string	"LON 1"
+.LASF1277:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF757:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF374:
+	.string	"__unix 1"
+.LASF2200:
+	.string	"DEFINE_LED(x,y,col,dir,func,ol,params) (LED_MOV_POS(CALCULATE_LED_XY(x, y)) | LED_MOV_COLOR(col) | LED_MOV_DIRECTION(dir) | LED_MOV_FUNCTION(func) | LED_MOV_OVERLAY(ol) | LED_MOV_PARAMS(params))"
+.LASF637:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF2469:
+	.string	"UIB_DEVICE_ID_GPS 0x13"
+.LASF1149:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF2546:
+	.string	"OWNER_AIRSPEED"
+.LASF1913:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2831:
+	.string	"OSD_GFORCE_X"
+.LASF2832:
+	.string	"OSD_GFORCE_Y"
+.LASF2833:
+	.string	"OSD_GFORCE_Z"
+.LASF1161:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2283:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF515:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF624:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF2694:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1062:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF2096:
+	.string	"MAX_INPUTS 8"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2739:
+	.string	"OSD_THROTTLE_POS"
+.LASF2188:
+	.string	"LED_POS_MASK LED_MOV_POS(((1 << LED_POS_BITCNT) - 1))"
+.LASF905:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1484:
+	.string	"__DECL_SIMD_acosh "
+.LASF2368:
+	.string	"DJI_API_VERSION_MAJOR 1"
+.LASF2335:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_GET_DEVICE_INFO 0x00"
+.LASF2571:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF2733:
+	.string	"OSD_ARTIFICIAL_HORIZON"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1344:
+	.string	"__DECL_SIMD_atan "
+.LASF1820:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1097:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2185:
+	.string	"LED_MOV_DIRECTION(direction) ((direction) << LED_DIRECTION_OFFSET)"
+.LASF1964:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2112:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF483:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1605:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF2381:
+	.string	"DJI_MSP_ATTITUDE 108"
+.LASF2554:
+	.string	"RESOURCE_IO"
+.LASF2019:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF959:
+	.string	"USE_DJI_HD_OSD "
+.LASF2728:
+	.string	"PID_POS_HEADING"
+.LASF1619:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1298:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF2693:
+	.string	"WAS_EVER_ARMED"
+.LASF1418:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1380:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF2416:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF2921:
+	.string	"lastExecutedAt"
+.LASF955:
+	.string	"USE_OLED_UG2864 "
+.LASF2821:
+	.string	"OSD_TEMP_SENSOR_3_TEMPERATURE"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2412:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1625:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF758:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1363:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2513:
+	.string	"OWNER_FREE"
+.LASF1218:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1315:
+	.string	"__DECL_SIMD_expf "
+.LASF550:
+	.string	"__stub_setlogin "
+.LASF2296:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2453:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2550:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1159:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF1554:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1642:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2428:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF2852:
+	.string	"BOXLIGHTS"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF489:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2317:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF2302:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2672:
+	.string	"result"
+.LASF1810:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2413:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1103:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF2034:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF2393:
+	.string	"DJI_MSP_SET_RC_TUNING 204"
+.LASF694:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1513:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1687:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2074:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1648:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1806:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1636:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1353:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1779:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1148:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF776:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF2619:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1040:
+	.string	"USE_DASHBOARD"
+.LASF1869:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF2843:
+	.string	"BOXHEADINGHOLD"
+.LASF725:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1336:
+	.string	"__DECL_SIMD_acosl "
+.LASF1203:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1433:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2243:
+	.string	"_IO_USER_LOCK 0x8000"
+.LASF1181:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF1600:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2983:
+	.string	"mspSerialProcess"
+.LASF2902:
+	.string	"TASK_TELEMETRY"
+.LASF2740:
+	.string	"OSD_VTX_CHANNEL"
+.LASF886:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2041:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2183:
+	.string	"LED_MOV_OVERLAY(overlay) ((overlay) << LED_OVERLAY_OFFSET)"
+.LASF517:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF2186:
+	.string	"LED_MOV_PARAMS(param) ((param) << LED_PARAMS_OFFSET)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1345:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF2265:
+	.string	"__attr_dealloc_fclose __attr_dealloc (fclose, 1)"
+.LASF2066:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1348:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2493:
+	.string	"uint32_t"
+.LASF1689:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2430:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF2341:
+	.string	"RCSPLIT_PACKET_CMD_CTRL 0x01"
+.LASF1239:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2214:
+	.string	"OSD_VISIBLE_FLAG 0x0800"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1802:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF522:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF2330:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1288:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF2408:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1427:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF2351:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1136:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF453:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2129:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF2924:
+	.string	"movingSumExecutionTime"
+.LASF947:
+	.string	"USE_1WIRE "
+.LASF2340:
+	.string	"RCSPLIT_PACKET_HEADER 0x55"
+.LASF2954:
+	.string	"taskUpdateRxMain"
+.LASF2047:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF2889:
+	.string	"TASK_PRIORITY_HIGH"
+.LASF2257:
+	.string	"FILENAME_MAX 4096"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1865:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1959:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1733:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2285:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF1549:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1844:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2084:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF2900:
+	.string	"TASK_BARO"
+.LASF2814:
+	.string	"OSD_MC_POS_XYZ_P_OUTPUTS"
+.LASF1278:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2394:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1391:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1009:
+	.string	"_GCC_PTRDIFF_T "
+.LASF2322:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF997:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1840:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF660:
+	.string	"__f32(x) x ##f32"
+.LASF2102:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF2977:
+	.string	"feature"
+.LASF1574:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF1946:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF2134:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF462:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1793:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1775:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2506:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_ROLL"
+.LASF1211:
+	.string	"BIT(x) (1 << (x))"
+.LASF1762:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF1984:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2989:
+	.string	"taskUpdateOpticalFlow"
+.LASF1284:
+	.string	"__DECL_SIMD_sin "
+.LASF2555:
+	.string	"RESOURCE_TIMER"
+.LASF799:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2037:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF526:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1556:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1973:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2735:
+	.string	"OSD_ONTIME"
+.LASF615:
+	.string	"WCONTINUED 8"
+.LASF1311:
+	.string	"__DECL_SIMD_logf32x "
+.LASF990:
+	.string	"USE_VTX_CONTROL "
+.LASF1178:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF1894:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1283:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2885:
+	.string	"TASK_PRIORITY_IDLE"
+.LASF2805:
+	.string	"OSD_NAV_FW_CRUISE_THR"
+.LASF793:
+	.string	"__timeval_defined 1"
+.LASF1130:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF2107:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF2845:
+	.string	"BOXHEADADJ"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF966:
+	.string	"USE_LOG "
+.LASF1474:
+	.string	"__DECL_SIMD_atanh "
+.LASF1818:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2730:
+	.string	"OSD_RSSI_VALUE"
+.LASF553:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1634:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF2834:
+	.string	"OSD_RC_SOURCE"
+.LASF1813:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1494:
+	.string	"__DECL_SIMD_erf "
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF692:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF2922:
+	.string	"lastSignaledAt"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1472:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1987:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF716:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF2045:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1546:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF460:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1443:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1960:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1194:
+	.string	"HSV_VALUE_MAX 255"
+.LASF511:
+	.string	"__wur "
+.LASF2115:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2374:
+	.string	"DJI_MSP_OSD_CONFIG 84"
+.LASF1921:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2260:
+	.string	"FOPEN_MAX 16"
+.LASF2575:
+	.string	"MODE_RXTX"
+.LASF1684:
+	.string	"IOCFG_IPD 0"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF629:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF2950:
+	.string	"logicConditionUpdateTask"
+.LASF1606:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF672:
+	.string	"EXIT_SUCCESS 0"
+.LASF856:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2527:
+	.string	"OWNER_I2C"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF644:
+	.string	"__f128(x) x ##f128"
+.LASF732:
+	.string	"__FD_SETSIZE 1024"
+.LASF2062:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF2391:
+	.string	"DJI_MSP_SET_PID_ADVANCED 95"
+.LASF538:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2215:
+	.string	"OSD_VISIBLE(x) ((x) & OSD_VISIBLE_FLAG)"
+.LASF1251:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF2753:
+	.string	"OSD_HOME_DIST"
+.LASF2445:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF2386:
+	.string	"DJI_MSP_BATTERY_STATE 130"
+.LASF2155:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1390:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2936:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF2011:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1046:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1210:
+	.string	"UNUSED(x) (void)(x)"
+.LASF780:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1624:
+	.string	"M_E 2.7182818284590452354"
+.LASF836:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1076:
+	.string	"FAST_CODE "
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2438:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF680:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2509:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE"
+.LASF1628:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2918:
+	.string	"staticPriority"
+.LASF700:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1796:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1680:
+	.string	"IOCFG_OUT_PP 0"
+.LASF744:
+	.string	"__pid_t_defined "
+.LASF2202:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF1165:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF755:
+	.string	"_ENDIAN_H 1"
+.LASF916:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1309:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2187:
+	.string	"LED_BIT_MASK(len) ((1 << (len)) - 1)"
+.LASF1035:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF608:
+	.string	"NULL ((void *)0)"
+.LASF2849:
+	.string	"BOXMANUAL"
+.LASF2944:
+	.string	"SENSOR_PITOT"
+.LASF707:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2986:
+	.string	"taskSyncServoDriver"
+.LASF493:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1679:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2604:
+	.string	"txBuffer"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2446:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF953:
+	.string	"USE_DASHBOARD "
+.LASF2269:
+	.ascii	"fwrite_unlocked(ptr,size,n,stream) (__extension__ ((__builti"
+	.ascii	"n_constant_p (size) && __builtin_constant_p (n) && (size_t) "
+	.ascii	"(size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ con"
+	.ascii	"st char *__ptr = (const char *) (ptr); FILE *__stream = (str"
+	.ascii	"eam); size_t __cnt; for (__cnt = (size_t) (size) * (size_t) "
+	.ascii	"(n); __cnt > 0; --__cnt) if (putc_unlocked (*__ptr++, __stre"
+	.ascii	"am) == EOF) break; ((size_t) (size) * (size_t) (n) -"
+	.string	" __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fwrite_unlocked (ptr, size, n, stream))))"
+.LASF2712:
+	.string	"ARMING_DISABLED_OOM"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2425:
+	.string	"RC_CHANNEL_VIDEO RC_SPI_AUX4"
+.LASF2868:
+	.string	"BOXCAMERA1"
+.LASF2869:
+	.string	"BOXCAMERA2"
+.LASF2870:
+	.string	"BOXCAMERA3"
+.LASF1545:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1224:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF448:
+	.string	"_ATFILE_SOURCE"
+.LASF998:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1664:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF617:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF451:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF631:
+	.string	"__WCOREFLAG 0x80"
+.LASF1978:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1069:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1708:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1256:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF2235:
+	.string	"__FILE_defined 1"
+.LASF1055:
+	.string	"USE_VCP"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF436:
+	.string	"__USE_ISOC95 1"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1785:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF765:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1263:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1193:
+	.string	"HSV_SATURATION_MAX 255"
+.LASF1461:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2624:
+	.string	"beginWrite"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF609:
+	.string	"__need_NULL"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF541:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1463:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF875:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1539:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1299:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF2565:
+	.string	"RESOURCE_SPI_CS"
+.LASF2246:
+	.string	"_IOLBF 1"
+.LASF627:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2065:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF929:
+	.string	"USE_PITOT_ADC "
+.LASF2456:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF1357:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF475:
+	.string	"__P(args) args"
+.LASF1145:
+	.string	"DYNAMIC (1 << 2)"
+.LASF846:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF632:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1745:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2560:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1981:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1448:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1707:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2979:
+	.string	"currentMeterUpdate"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1477:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1817:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2916:
+	.string	"taskFunc"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF1599:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2397:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF941:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1700:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF500:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF2194:
+	.string	"LED_FLAG_OVERLAY(id) (1 << (id))"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF2114:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1337:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2551:
+	.string	"RESOURCE_NONE"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1185:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF1138:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1791:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2082:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF2875:
+	.string	"BOXBRAKING"
+.LASF2522:
+	.string	"OWNER_PINDEBUG"
+.LASF2588:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF829:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2755:
+	.string	"OSD_VARIO"
+.LASF2848:
+	.string	"BOXNAVPOSHOLD"
+.LASF2012:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2240:
+	.string	"__feof_unlocked_body(_fp) (((_fp)->_flags & _IO_EOF_SEEN) != 0)"
+.LASF1037:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF664:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1534:
+	.string	"__DECL_SIMD_tan "
+.LASF2250:
+	.string	"SEEK_SET 0"
+.LASF2516:
+	.string	"OWNER_PPMINPUT"
+.LASF1795:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2920:
+	.string	"taskAgeCycles"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1091:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF534:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF991:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1632:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2737:
+	.string	"OSD_FLYMODE"
+.LASF983:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2320:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF1833:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1747:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2190:
+	.string	"LED_OVERLAY_MASK LED_MOV_OVERLAY(LED_FLAG_OVERLAY_MASK)"
+.LASF1566:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF830:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF2822:
+	.string	"OSD_TEMP_SENSOR_4_TEMPERATURE"
+.LASF2621:
+	.string	"writeBuf"
+.LASF2024:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2217:
+	.string	"OSD_X(x) ((x) & 0x001F)"
+.LASF1047:
+	.string	"USE_PITOT_MS4525"
+.LASF696:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF2016:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2069:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF2278:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF3001:
+	.string	"fcTasksInit"
+.LASF1955:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1945:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2419:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF787:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF987:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2817:
+	.string	"OSD_BARO_TEMPERATURE"
+.LASF2072:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF1423:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1741:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1997:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2207:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF1849:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF772:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1977:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF2767:
+	.string	"OSD_BATTERY_REMAINING_CAPACITY"
+.LASF1186:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF701:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF642:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1084:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1183:
+	.string	"CMS_EXIT (0)"
+.LASF1972:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1515:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1937:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1331:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1301:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF979:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1643:
+	.string	"sq(x) ((x)*(x))"
+.LASF1155:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF1164:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF975:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF2216:
+	.string	"OSD_POS(x,y) ((x) | ((y) << 5))"
+.LASF697:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF878:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2272:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF628:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF2132:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF516:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1710:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF862:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2618:
+	.string	"serialSetBaudRate"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1425:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF741:
+	.string	"__nlink_t_defined "
+.LASF2480:
+	.string	"__uint8_t"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1787:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1269:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2291:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF461:
+	.string	"__GLIBC__ 2"
+.LASF1189:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1492:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF607:
+	.string	"NULL"
+.LASF2585:
+	.string	"SERIAL_BIDIR"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2863:
+	.string	"BOXSURFACE"
+.LASF2763:
+	.string	"OSD_THROTTLE_POS_AUTO_THR"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1816:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1014:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF2734:
+	.string	"OSD_HORIZON_SIDEBARS"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF794:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF2793:
+	.string	"OSD_BOARD_ALIGN_PITCH"
+.LASF1517:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF376:
+	.string	"unix 1"
+.LASF1716:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2595:
+	.string	"serialPort_s"
+.LASF2627:
+	.string	"serialPort_t"
+.LASF1507:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF773:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1829:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1662:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF2120:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF2583:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1063:
+	.string	"U_ID_0 0"
+.LASF807:
+	.string	"__blksize_t_defined "
+.LASF2748:
+	.string	"OSD_YAW_PIDS"
+.LASF2331:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF2411:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF2448:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1174:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF1113:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1722:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF891:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2022:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF788:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF977:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2722:
+	.string	"PID_POS_XY"
+.LASF944:
+	.string	"USE_OPFLOW_CXOF "
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF693:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1588:
+	.string	"_Mdouble_ _Float64x"
+.LASF479:
+	.string	"__ptr_t void *"
+.LASF480:
+	.string	"__BEGIN_DECLS "
+.LASF1321:
+	.string	"__DECL_SIMD_expf32x "
+.LASF669:
+	.string	"__lldiv_t_defined 1"
+.LASF1792:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2965:
+	.string	"opflowUpdate"
+.LASF2919:
+	.string	"dynamicPriority"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1735:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2987:
+	.string	"currentTimeUs"
+.LASF1132:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF2524:
+	.string	"OWNER_RANGEFINDER"
+.LASF747:
+	.string	"__daddr_t_defined "
+.LASF1992:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF940:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF616:
+	.string	"WNOWAIT 0x01000000"
+.LASF2293:
+	.string	"toascii(c) __toascii (c)"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF443:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1571:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF2147:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF552:
+	.string	"__stub_stty "
+.LASF2773:
+	.string	"OSD_MAP_NORTH"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF965:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF497:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1358:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2308:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1326:
+	.string	"__DECL_SIMD_powl "
+.LASF1478:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2633:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2193:
+	.string	"LED_PARAMS_MASK LED_MOV_PARAMS(((1 << LED_PARAMS_BITCNT) - 1))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2528:
+	.string	"OWNER_SDCARD"
+.LASF1162:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF933:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF784:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2841:
+	.string	"BOXHORIZON"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1338:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1257:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2536:
+	.string	"OWNER_LED_STRIP"
+.LASF2195:
+	.string	"LED_FLAG_DIRECTION(id) (1 << (id))"
+.LASF2156:
+	.string	"HDOP_SCALE (100)"
+.LASF2245:
+	.string	"_IOFBF 0"
+.LASF1330:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1300:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF845:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2668:
+	.string	"MSP_RESULT_NO_REPLY"
+.LASF2650:
+	.string	"FEATURE_DASHBOARD"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1961:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"_SIZE_T_DEFINED "
+.LASF1683:
+	.string	"IOCFG_AF_OD 0"
+.LASF2803:
+	.string	"OSD_MANUAL_ROLL_RATE"
+.LASF1225:
+	.string	"MAX_GLOBAL_FUNCTIONS 8"
+.LASF2431:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF1364:
+	.string	"__DECL_SIMD_hypot "
+.LASF1863:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF371:
+	.string	"__linux 1"
+.LASF2196:
+	.string	"LED_X_BIT_OFFSET 4"
+.LASF2742:
+	.string	"OSD_MAH_DRAWN"
+.LASF2878:
+	.string	"BOXFPVANGLEMIX"
+.LASF1228:
+	.string	"GLOBAL_FUNCTION_FLAG(mask) (globalFunctionsFlags & (mask))"
+.LASF2971:
+	.string	"compassUpdate"
+.LASF2118:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1965:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1342:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF2099:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2094:
+	.string	"PWM_TIMER_HZ 1000000"
+.LASF449:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2043:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF2607:
+	.string	"txBufferHead"
+.LASF2241:
+	.string	"_IO_ERR_SEEN 0x0020"
+.LASF1403:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2252:
+	.string	"SEEK_END 2"
+.LASF2157:
+	.string	"NAV_BLACKBOX "
+.LASF1675:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF481:
+	.string	"__END_DECLS "
+.LASF804:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF873:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1516:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2068:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF1465:
+	.string	"__DECL_SIMD_log1pf "
+.LASF985:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1705:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF602:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2710:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF2496:
+	.string	"timeUs_t"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2210:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF2958:
+	.string	"uavInterconnectBusIsInitialized"
+.LASF1859:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2692:
+	.string	"ARMED"
+.LASF551:
+	.string	"__stub_sigreturn "
+.LASF2854:
+	.string	"BOXOSD"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2067:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2376:
+	.string	"DJI_MSP_PID_ADVANCED 94"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1573:
+	.string	"_Mdouble_ float"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1397:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1426:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2042:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1595:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2126:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF771:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1171:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF2151:
+	.string	"LAT 0"
+.LASF2153:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF759:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1771:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1329:
+	.string	"__DECL_SIMD_powf64 "
+.LASF789:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1134:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2572:
+	.string	"double"
+.LASF601:
+	.string	"__INT_WCHAR_T_H "
+.LASF1320:
+	.string	"__DECL_SIMD_expf128 "
+.LASF705:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2892:
+	.string	"TASK_SYSTEM"
+.LASF1217:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF464:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF2782:
+	.string	"OSD_CRUISE_HEADING_ADJUSTMENT"
+.LASF2063:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2776:
+	.string	"OSD_WIND_SPEED_HORIZONTAL"
+.LASF2656:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF1270:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF2943:
+	.string	"SENSOR_RANGEFINDER"
+.LASF1374:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2625:
+	.string	"endWrite"
+.LASF584:
+	.string	"___int_size_t_h "
+.LASF1382:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF865:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1215:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1175:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF1367:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2956:
+	.string	"taskSystem"
+.LASF2689:
+	.string	"AUX10"
+.LASF2690:
+	.string	"AUX11"
+.LASF2691:
+	.string	"AUX12"
+.LASF972:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1996:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1988:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1318:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1720:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2505:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_POWER_LEVEL"
+.LASF783:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1825:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2525:
+	.string	"OWNER_SYSTEM"
+.LASF2495:
+	.string	"timeDelta_t"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2934:
+	.string	"SENSOR_INDEX_MAG"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1518:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1768:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1383:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2290:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1314:
+	.string	"__DECL_SIMD_exp "
+.LASF2396:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1254:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1475:
+	.string	"__DECL_SIMD_atanhf "
+.LASF889:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1411:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF2615:
+	.string	"serialTotalRxWaiting"
+.LASF1054:
+	.string	"USE_ADC"
+.LASF2046:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2804:
+	.string	"OSD_MANUAL_YAW_RATE"
+.LASF2105:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF951:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1532:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1590:
+	.string	"__MATHDECL_1_IMPL"
+.LASF840:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF2015:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2549:
+	.string	"OWNER_IRLOCK"
+.LASF1670:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF2223:
+	.string	"OSD_HOMING_LIM_H3 38"
+.LASF2295:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF2364:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF2033:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1509:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1688:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1936:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1520:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1219:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2675:
+	.string	"mspProcessCommandFnPtr"
+.LASF2741:
+	.string	"OSD_CURRENT_DRAW"
+.LASF2806:
+	.string	"OSD_NAV_FW_PITCH2THR"
+.LASF622:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1711:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2518:
+	.string	"OWNER_SERVO"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2676:
+	.string	"rc_alias"
+.LASF1696:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1351:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1575:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1567:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2951:
+	.string	"vtxUpdate"
+.LASF766:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1216:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1122:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1371:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1466:
+	.string	"__DECL_SIMD_log1pl "
+.LASF650:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1928:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1776:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF885:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2640:
+	.string	"FEATURE_GPS"
+.LASF1110:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF769:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF2858:
+	.string	"BOXNAVWP"
+.LASF598:
+	.string	"_WCHAR_T_DEFINED "
+.LASF548:
+	.string	"__stub_gtty "
+.LASF2786:
+	.string	"OSD_LEVEL_PIDS"
+.LASF687:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2610:
+	.string	"rxCallbackData"
+.LASF2432:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= 100)"
+.LASF1858:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF459:
+	.string	"__GNU_LIBRARY__"
+.LASF1799:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1304:
+	.string	"__DECL_SIMD_log "
+.LASF722:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1421:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1082:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2544:
+	.string	"OWNER_TEMPERATURE"
+.LASF1560:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2582:
+	.string	"SERIAL_PARITY_NO"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2846:
+	.string	"BOXCAMSTAB"
+.LASF1349:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1120:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF742:
+	.string	"__uid_t_defined "
+.LASF1005:
+	.string	"__PTRDIFF_T "
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF2928:
+	.string	"startLatenessHistogram"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2576:
+	.string	"portMode_t"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1169:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF2752:
+	.string	"OSD_HOME_DIR"
+.LASF1065:
+	.string	"U_ID_2 2"
+.LASF1841:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2375:
+	.string	"DJI_MSP_FILTER_CONFIG 92"
+.LASF1139:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2601:
+	.string	"rxBufferSize"
+.LASF1635:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2968:
+	.string	"updatePositionEstimator_BaroTopic"
+.LASF1753:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1237:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF1398:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF685:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF2634:
+	.string	"FEATURE_VBAT"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF831:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1081:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF2769:
+	.string	"OSD_EFFICIENCY_WH_PER_KM"
+.LASF2558:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2242:
+	.string	"__ferror_unlocked_body(_fp) (((_fp)->_flags & _IO_ERR_SEEN) != 0)"
+.LASF1410:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF2465:
+	.string	"RANGEFINDER_NO_NEW_DATA (-3)"
+.LASF1401:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2346:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF2616:
+	.string	"serialTotalTxFree"
+.LASF2404:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF881:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2483:
+	.string	"__uint16_t"
+.LASF1623:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2718:
+	.string	"PID_ROLL"
+.LASF1184:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF2823:
+	.string	"OSD_TEMP_SENSOR_5_TEMPERATURE"
+.LASF1419:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2008:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2081:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2630:
+	.string	"ADC_CURRENT"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF2696:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF2866:
+	.string	"BOXAUTOTRIM"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF681:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF746:
+	.string	"__ssize_t_defined "
+.LASF1734:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2154:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF877:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF797:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF2840:
+	.string	"BOXANGLE"
+.LASF2725:
+	.string	"PID_LEVEL"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF490:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF643:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF861:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF3002:
+	.string	"cmpTimeUs"
+.LASF1075:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF2389:
+	.string	"DJI_MSP_RTC 247"
+.LASF2861:
+	.string	"BOXGCSNAV"
+.LASF2167:
+	.string	"LED_POS_OFFSET 0"
+.LASF2279:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1146:
+	.string	"OPTSTRING (1 << 3)"
+.LASF1368:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1350:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF2699:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF2292:
+	.string	"isascii(c) __isascii (c)"
+.LASF2494:
+	.string	"uint64_t"
+.LASF968:
+	.string	"USE_CMS "
+.LASF2192:
+	.string	"LED_DIRECTION_MASK LED_MOV_DIRECTION(LED_FLAG_DIRECTION_MASK)"
+.LASF2145:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1370:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1022:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2027:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1811:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2706:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF533:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF496:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF736:
+	.string	"__u_char_defined "
+.LASF1361:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2059:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2716:
+	.string	"cliMode"
+.LASF2031:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1068:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2312:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF2910:
+	.string	"TASK_COUNT"
+.LASF2298:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1703:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF844:
+	.string	"INT8_MIN (-128)"
+.LASF1023:
+	.string	"USE_UART2 "
+.LASF2871:
+	.string	"BOXOSDALT1"
+.LASF2872:
+	.string	"BOXOSDALT2"
+.LASF2873:
+	.string	"BOXOSDALT3"
+.LASF1294:
+	.string	"__DECL_SIMD_sincos "
+.LASF2111:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF887:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF2761:
+	.string	"OSD_GPS_HDOP"
+.LASF2596:
+	.string	"vTable"
+.LASF588:
+	.string	"__need_size_t"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1158:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF435:
+	.string	"__USE_ISOC99 1"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1666:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF2189:
+	.string	"LED_FUNCTION_MASK LED_MOV_FUNCTION(((1 << LED_FUNCTION_BITCNT) - 1))"
+.LASF1392:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1525:
+	.string	"__DECL_SIMD_erfcf "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1395:
+	.string	"__DECL_SIMD_coshf "
+.LASF986:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1160:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF638:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2449:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF1488:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1056:
+	.string	"USE_RX_PPM"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF2039:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1676:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1024:
+	.string	"USE_UART3 "
+.LASF2497:
+	.string	"_Bool"
+.LASF2117:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF612:
+	.string	"WUNTRACED 2"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF2501:
+	.string	"RGB_BLUE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF753:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1245:
+	.string	"SPIDEV_COUNT 4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF890:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1002:
+	.string	"_PTRDIFF_T "
+.LASF2978:
+	.string	"temperatureUpdate"
+.LASF1187:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF595:
+	.string	"_WCHAR_T_ "
+.LASF1458:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF2087:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF1875:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1724:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1104:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1025:
+	.string	"USE_UART4 "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF469:
+	.string	"__LEAF , __leaf__"
+.LASF734:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1312:
+	.string	"__DECL_SIMD_logf64x "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF866:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2835:
+	.string	"OSD_VTX_POWER"
+.LASF1116:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1789:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF691:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2881:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1681:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1819:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2421:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1838:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1682:
+	.string	"IOCFG_AF_PP 0"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2459:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF2811:
+	.string	"OSD_MC_VEL_X_PID_OUTPUTS"
+.LASF512:
+	.string	"__always_inline"
+.LASF1026:
+	.string	"USE_UART5 "
+.LASF2092:
+	.string	"MAX_MOTORS 12"
+.LASF1305:
+	.string	"__DECL_SIMD_logf "
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF2883:
+	.string	"MSP_SKIP_NON_MSP_DATA"
+.LASF980:
+	.string	"USE_RX_MSP "
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF2327:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1699:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1694:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF2353:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2399:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF2973:
+	.string	"taskUpdateRxCheck"
+.LASF1979:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF737:
+	.string	"__ino_t_defined "
+.LASF1834:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2905:
+	.string	"TASK_UAV_INTERCONNECT"
+.LASF2321:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF908:
+	.string	"I2C2_OVERCLOCK false"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2937:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1637:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1551:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1535:
+	.string	"__DECL_SIMD_tanf "
+.LASF2759:
+	.string	"OSD_RTC_TIME"
+.LASF349:
+	.string	"__amd64 1"
+.LASF537:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF882:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2925:
+	.string	"maxExecutionTime"
+.LASF871:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF396:
+	.string	"false 0"
+.LASF2323:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1360:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF730:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2244:
+	.string	"_VA_LIST_DEFINED "
+.LASF494:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF486:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2363:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF2701:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF668:
+	.string	"__ldiv_t_defined 1"
+.LASF1281:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF775:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF2467:
+	.string	"UIB_MAX_PACKET_SIZE 32"
+.LASF583:
+	.string	"__DEFINED_size_t "
+.LASF2370:
+	.string	"DJI_MSP_API_VERSION 1"
+.LASF2333:
+	.string	"RCDEVICE_PROTOCOL_MAX_PACKET_SIZE 64"
+.LASF2764:
+	.string	"OSD_HEADING_GRAPH"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1892:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF452:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1259:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF2205:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF1028:
+	.string	"USE_UART7 "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1971:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF960:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1222:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2890:
+	.string	"TASK_PRIORITY_REALTIME"
+.LASF2940:
+	.string	"SENSOR_ACC"
+.LASF1553:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF633:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1497:
+	.string	"__DECL_SIMD_erff16 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2586:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1927:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1504:
+	.string	"__DECL_SIMD_tanh "
+.LASF1051:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1798:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2284:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1249:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF1029:
+	.string	"USE_UART8 "
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1459:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2220:
+	.string	"OSD_POS_MAX_CLI (OSD_POS_MAX | OSD_VISIBLE_FLAG)"
+.LASF1704:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1909:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1729:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF2004:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1788:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF605:
+	.string	"_BSD_WCHAR_T_"
+.LASF2457:
+	.string	"_STRING_H 1"
+.LASF1631:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF2032:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1052:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1919:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1526:
+	.string	"__DECL_SIMD_erfcl "
+.LASF2587:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1396:
+	.string	"__DECL_SIMD_coshl "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1271:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF1697:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF635:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF2799:
+	.string	"OSD_YAW_RATE"
+.LASF358:
+	.string	"__k8 1"
+.LASF2888:
+	.string	"TASK_PRIORITY_MEDIUM_HIGH"
+.LASF2417:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF898:
+	.string	"INT64_C(c) c ## L"
+.LASF2410:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2197:
+	.string	"LED_Y_BIT_OFFSET 0"
+.LASF2267:
+	.string	"__STDIO_INLINE __extern_inline"
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF634:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF1003:
+	.string	"_T_PTRDIFF_ "
+.LASF2895:
+	.string	"TASK_SERIAL"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2856:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF455:
+	.string	"__USE_ATFILE 1"
+.LASF800:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2705:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF2218:
+	.string	"OSD_Y(x) (((x) >> 5) & 0x001F)"
+.LASF2348:
+	.string	"BOXID_NONE 255"
+.LASF2548:
+	.string	"OWNER_PINIO"
+.LASF2287:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF949:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1857:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1907:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1756:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1191:
+	.string	"RGB_COLOR_COMPONENT_COUNT (RGB_BLUE + 1)"
+.LASF1462:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1400:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF1644:
+	.string	"FAST_MATH "
+.LASF1460:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF501:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1874:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3000:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF578:
+	.string	"_BSD_SIZE_T_ "
+.LASF1830:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1286:
+	.string	"__DECL_SIMD_sinl "
+.LASF913:
+	.string	"USE_SERIALRX_SBUS "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF2714:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF2780:
+	.string	"OSD_HOME_HEADING_ERROR"
+.LASF786:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF1434:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1048:
+	.string	"USE_PITOT_ADC"
+.LASF1564:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF2521:
+	.string	"OWNER_SERIAL"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2862:
+	.string	"BOXKILLSWITCH"
+.LASF1742:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF1306:
+	.string	"__DECL_SIMD_logl "
+.LASF528:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1280:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF667:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1544:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1173:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF1036:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2270:
+	.string	"__STDIO_INLINE"
+.LASF943:
+	.string	"USE_OPFLOW "
+.LASF619:
+	.string	"__WCLONE 0x80000000"
+.LASF937:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2203:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF1252:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2388:
+	.string	"DJI_MSP_STATUS_EX 150"
+.LASF641:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1763:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1714:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1536:
+	.string	"__DECL_SIMD_tanl "
+.LASF1101:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF478:
+	.string	"__STRING(x) #x"
+.LASF2570:
+	.string	"RESOURCE_RX_CE"
+.LASF989:
+	.string	"USE_RCDEVICE "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1669:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1958:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2226:
+	.string	"OSD_HOMING_LIM_V3 15"
+.LASF2414:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1784:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2991:
+	.string	"taskUpdateBaro"
+.LASF1665:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1877:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF2233:
+	.string	"_____fpos64_t_defined 1"
+.LASF2654:
+	.string	"FEATURE_TRANSPONDER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2451:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF639:
+	.string	"_BITS_FLOATN_H "
+.LASF2023:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2301:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF809:
+	.string	"__fsblkcnt_t_defined "
+.LASF2577:
+	.string	"portOptions_t"
+.LASF1413:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1013:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF546:
+	.string	"__stub_chflags "
+.LASF958:
+	.string	"USE_FRSKYOSD "
+.LASF581:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1354:
+	.string	"__DECL_SIMD_asin "
+.LASF1265:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2143:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF2086:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF2972:
+	.string	"updateGpsIndicator"
+.LASF2886:
+	.string	"TASK_PRIORITY_LOW"
+.LASF2009:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF915:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1691:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2865:
+	.string	"BOXTURNASSIST"
+.LASF2511:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_CHANNEL"
+.LASF2443:
+	.string	"MAX_TEMP_SENSORS 8"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1587:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2415:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF2392:
+	.string	"DJI_MSP_SET_PID 202"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1355:
+	.string	"__DECL_SIMD_asinf "
+.LASF1537:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1297:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2770:
+	.string	"OSD_TRIP_DIST"
+.LASF2162:
+	.string	"LED_MODE_COUNT 6"
+.LASF1718:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2638:
+	.string	"FEATURE_UNUSED_1"
+.LASF2980:
+	.string	"isAmperageConfigured"
+.LASF2641:
+	.string	"FEATURE_UNUSED_3"
+.LASF2642:
+	.string	"FEATURE_UNUSED_4"
+.LASF2646:
+	.string	"FEATURE_UNUSED_5"
+.LASF2647:
+	.string	"FEATURE_UNUSED_6"
+.LASF2651:
+	.string	"FEATURE_UNUSED_7"
+.LASF2658:
+	.string	"FEATURE_UNUSED_8"
+.LASF2659:
+	.string	"FEATURE_UNUSED_9"
+.LASF812:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF796:
+	.string	"__NFDBITS"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1912:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2593:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF743:
+	.string	"__off_t_defined "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1695:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF446:
+	.string	"__USE_XOPEN2K 1"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2523:
+	.string	"OWNER_TIMER"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF923:
+	.string	"USE_TELEMETRY "
+.LASF1685:
+	.string	"IOCFG_IPU 0"
+.LASF2851:
+	.string	"BOXLEDLOW"
+.LASF1199:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1911:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1826:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2130:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1949:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"alloca"
+.LASF1066:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1529:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1176:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1744:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2148:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1142:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2307:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF760:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF2263:
+	.string	"stderr stderr"
+.LASF545:
+	.string	"__stub___compat_bdflush "
+.LASF2256:
+	.string	"TMP_MAX 238328"
+.LASF2098:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2038:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1302:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1615:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF2030:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF524:
+	.string	"__attribute_copy__"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1272:
+	.string	"_MATH_H 1"
+.LASF640:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2402:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1010:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF2809:
+	.string	"OSD_FW_ALT_PID_OUTPUTS"
+.LASF1126:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1514:
+	.string	"__DECL_SIMD_asinh "
+.LASF1864:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2857:
+	.string	"BOXFAILSAFE"
+.LASF1663:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1671:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF445:
+	.string	"__USE_POSIX199506 1"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2379:
+	.string	"DJI_MSP_RAW_GPS 106"
+.LASF2824:
+	.string	"OSD_TEMP_SENSOR_6_TEMPERATURE"
+.LASF2747:
+	.string	"OSD_PITCH_PIDS"
+.LASF1579:
+	.string	"_Mdouble_ _Float32"
+.LASF2477:
+	.string	"short unsigned int"
+.LASF2754:
+	.string	"OSD_HEADING"
+.LASF1584:
+	.string	"_Mdouble_ _Float128"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1654:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1774:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2329:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2029:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1373:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2894:
+	.string	"TASK_RX"
+.LASF1843:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2255:
+	.string	"L_tmpnam 20"
+.LASF1481:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF2674:
+	.string	"mspPostProcessFnPtr"
+.LASF2853:
+	.string	"BOXNAVLAUNCH"
+.LASF1451:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1943:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF839:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1659:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF2599:
+	.string	"options"
+.LASF2142:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1058:
+	.string	"USE_RCDEVICE"
+.LASF2481:
+	.string	"__int16_t"
+.LASF860:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF471:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF523:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF2179:
+	.string	"LED_FLAG_OVERLAY_MASK ((1 << LED_OVERLAY_BITCNT) - 1)"
+.LASF1039:
+	.string	"USE_SERVO_SBUS"
+.LASF2303:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF2110:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1597:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2055:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1974:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF729:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2247:
+	.string	"_IONBF 2"
+.LASF1346:
+	.string	"__DECL_SIMD_atanl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2939:
+	.string	"SENSOR_GYRO"
+.LASF1970:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2645:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2367:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF482:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2463:
+	.string	"RANGEFINDER_OUT_OF_RANGE (-1)"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2667:
+	.string	"MSP_RESULT_ERROR"
+.LASF630:
+	.string	"__W_CONTINUED 0xffff"
+.LASF710:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2988:
+	.string	"taskTelemetry"
+.LASF781:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF2982:
+	.string	"mspFcProcessCommand"
+.LASF854:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2109:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF749:
+	.string	"__clock_t_defined 1"
+.LASF1322:
+	.string	"__DECL_SIMD_expf64x "
+.LASF724:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF942:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1611:
+	.string	"FP_INFINITE 1"
+.LASF851:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF1089:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2472:
+	.string	"RANGEFINDER_UIB_TASK_PERIOD_MS 100"
+.LASF2620:
+	.string	"setMode"
+.LASF2519:
+	.string	"OWNER_SOFTSERIAL"
+.LASF2765:
+	.string	"OSD_EFFICIENCY_MAH_PER_KM"
+.LASF1523:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF1891:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1582:
+	.string	"_Mdouble_ _Float64"
+.LASF1883:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2784:
+	.string	"OSD_MAIN_BATT_SAG_COMPENSATED_CELL_VOLTAGE"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2547:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF2491:
+	.string	"uint8_t"
+.LASF2178:
+	.string	"LED_PARAMS_BITCNT 4"
+.LASF648:
+	.string	"__HAVE_FLOAT32 1"
+.LASF828:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF973:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1356:
+	.string	"__DECL_SIMD_asinl "
+.LASF1732:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF1072:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2663:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1672:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF834:
+	.string	"_ALLOCA_H 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF2931:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF842:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1131:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF2319:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF720:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1903:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF658:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF938:
+	.string	"USE_RANGEFINDER "
+.LASF2433:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF2901:
+	.string	"TASK_PITOT"
+.LASF2903:
+	.string	"TASK_CMS"
+.LASF926:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1229:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2436:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1264:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1133:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2078:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF849:
+	.string	"INT16_MAX (32767)"
+.LASF2460:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF2173:
+	.string	"LED_POS_BITCNT 8"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF939:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF2239:
+	.string	"_IO_EOF_SEEN 0x0010"
+.LASF2643:
+	.string	"FEATURE_TELEMETRY"
+.LASF1506:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1480:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1538:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1021:
+	.string	"USE_BARO "
+.LASF1800:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF618:
+	.string	"__WALL 0x40000000"
+.LASF1889:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2781:
+	.string	"OSD_CRUISE_HEADING_ERROR"
+.LASF2498:
+	.string	"float"
+.LASF1954:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1522:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1805:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1093:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2440:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF1144:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF690:
+	.string	"__STD_TYPE typedef"
+.LASF2476:
+	.string	"unsigned char"
+.LASF2887:
+	.string	"TASK_PRIORITY_MEDIUM"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2729:
+	.string	"PID_ITEM_COUNT"
+.LASF2123:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF1404:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2812:
+	.string	"OSD_MC_VEL_Y_PID_OUTPUTS"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1108:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1917:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1868:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2976:
+	.string	"gpsUpdate"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1593:
+	.string	"__MATHDECL"
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF1223:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF748:
+	.string	"__key_t_defined "
+.LASF1483:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2808:
+	.string	"OSD_DEBUG"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2606:
+	.string	"rxBufferTail"
+.LASF531:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1786:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1043:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2131:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1759:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2553:
+	.string	"RESOURCE_OUTPUT"
+.LASF927:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1822:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1754:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2879:
+	.string	"BOXLOITERDIRCHN"
+.LASF1555:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2005:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2306:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF567:
+	.string	"__need_size_t "
+.LASF2724:
+	.string	"PID_SURFACE"
+.LASF2423:
+	.string	"RC_CHANNEL_FLIP RC_SPI_AUX2"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2040:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF373:
+	.string	"linux 1"
+.LASF2649:
+	.string	"FEATURE_LED_STRIP"
+.LASF2945:
+	.string	"SENSOR_OPFLOW"
+.LASF709:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2917:
+	.string	"desiredPeriod"
+.LASF1499:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1115:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1246:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF2723:
+	.string	"PID_VEL_XY"
+.LASF2952:
+	.string	"uavInterconnectBusTask"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2827:
+	.string	"OSD_PLUS_CODE"
+.LASF935:
+	.string	"USE_RX_UIB "
+.LASF897:
+	.string	"INT32_C(c) c"
+.LASF1801:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2542:
+	.string	"OWNER_SPI_PREINIT"
+.LASF603:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2232:
+	.string	"____mbstate_t_defined 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF441:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2462:
+	.string	"P0 101325.0f"
+.LASF2230:
+	.string	"__GNUC_VA_LIST "
+.LASF509:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2089:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF838:
+	.string	"_STDINT_H 1"
+.LASF893:
+	.string	"WINT_MIN (0u)"
+.LASF1152:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF1151:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1234:
+	.string	"DMA_NONE (0)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF2268:
+	.ascii	"fread_unlocked(ptr,size,n,stream) (__extension__ ((__builtin"
+	.ascii	"_constant_p (size) && __builtin_constant_p (n) && (size_t) ("
+	.ascii	"size) * (size_t) (n) <= 8 && (size_t) (size) != 0) ? ({ char"
+	.ascii	" *__ptr = (char *) (ptr); FILE *__stream = (stream); size_t "
+	.ascii	"__cnt; for (__cnt = (size_t) (size) * (size_t) (n); __cnt > "
+	.ascii	"0; --__cnt) { int __c = getc_unlocked (__stream); if (__c =="
+	.ascii	" EOF) break; *__ptr++ = __c; } ((size_t) (size) * (size_t) ("
+	.ascii	"n) "
+	.string	"- __cnt) / (size_t) (size); }) : (((__builtin_constant_p (size) && (size_t) (size) == 0) || (__builtin_constant_p (n) && (size_t) (n) == 0)) ? ((void) (ptr), (void) (stream), (void) (size), (void) (n), (size_t) 0) : fread_unlocked (ptr, size, n, stream))))"
+.LASF2407:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF2071:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1412:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF2541:
+	.string	"OWNER_VTX"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF718:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1327:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2199:
+	.string	"CALCULATE_LED_XY(x,y) ((((x) & LED_XY_MASK) << LED_X_BIT_OFFSET) | (((y) & LED_XY_MASK) << LED_Y_BIT_OFFSET))"
+.LASF576:
+	.string	"__SIZE_T "
+.LASF970:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1095:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF2829:
+	.string	"OSD_MAP_REFERENCE"
+.LASF2614:
+	.string	"serialWrite"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2342:
+	.string	"RCSPLIT_PACKET_TAIL 0xaa"
+.LASF1677:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2133:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2826:
+	.string	"OSD_ALTITUDE_MSL"
+.LASF1727:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF492:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF864:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF547:
+	.string	"__stub_fchflags "
+.LASF1334:
+	.string	"__DECL_SIMD_acos "
+.LASF2502:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_ARMING_SAFETY"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF544:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1994:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1614:
+	.string	"FP_NORMAL 4"
+.LASF711:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1200:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1702:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1352:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2707:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1476:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1079:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF2602:
+	.string	"txBufferSize"
+.LASF1918:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1372:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF2127:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF764:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF2021:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2222:
+	.string	"OSD_HOMING_LIM_H2 16"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2166:
+	.string	"LED_SPECIAL_COLOR_COUNT 11"
+.LASF2406:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1572:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF2661:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2657:
+	.string	"FEATURE_VTX"
+.LASF1942:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF999:
+	.string	"_STDDEF_H "
+.LASF513:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2535:
+	.string	"OWNER_INVERTER"
+.LASF2794:
+	.string	"OSD_RC_EXPO"
+.LASF2182:
+	.string	"LED_MOV_FUNCTION(func) ((func) << LED_FUNCTION_OFFSET)"
+.LASF495:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1852:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1557:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2837:
+	.string	"OSD_ESC_TEMPERATURE"
+.LASF1088:
+	.string	"UNIT_TESTED "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2254:
+	.string	"_BITS_STDIO_LIM_H 1"
+.LASF1409:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1221:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF761:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF670:
+	.string	"RAND_MAX 2147483647"
+.LASF1586:
+	.string	"_Mdouble_ _Float32x"
+.LASF2774:
+	.string	"OSD_MAP_TAKEOFF"
+.LASF1717:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1726:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF981:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2785:
+	.string	"OSD_POWER_SUPPLY_IMPEDANCE"
+.LASF708:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1018:
+	.string	"USE_FAKE_MAG "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF967:
+	.string	"USE_STATS "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF614:
+	.string	"WEXITED 4"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2906:
+	.string	"TASK_VTXCTRL"
+.LASF1701:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2300:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF1201:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1033:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1577:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2534:
+	.string	"OWNER_MPU"
+.LASF2485:
+	.string	"__uint32_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF2787:
+	.string	"OSD_POS_XY_PIDS"
+.LASF1969:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1220:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1570:
+	.string	"__MATH_PRECNAME"
+.LASF1667:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1641:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1019:
+	.string	"USE_FAKE_GPS "
+.LASF1761:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1751:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2275:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF2629:
+	.string	"ADC_RSSI"
+.LASF2839:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1402:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF978:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF995:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF2504:
+	.string	"GLOBAL_FUNCTION_ACTION_SWAP_ROLL_YAW"
+.LASF2913:
+	.string	"cfTaskId_e"
+.LASF2762:
+	.string	"OSD_MAIN_BATT_CELL_VOLTAGE"
+.LASF2076:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1394:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF874:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1706:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1242:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1580:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1622:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2963:
+	.string	"telemetryCheckState"
+.LASF1293:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF519:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF599:
+	.string	"_WCHAR_T_H "
+.LASF1125:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1260:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1882:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1757:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2703:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1431:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF733:
+	.string	"_BITS_TIME64_H 1"
+.LASF575:
+	.string	"_T_SIZE "
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF2790:
+	.string	"OSD_VEL_Z_PIDS"
+.LASF2359:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MAX 1920"
+.LASF806:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1598:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF2515:
+	.string	"OWNER_PWMINPUT"
+.LASF808:
+	.string	"__blkcnt_t_defined "
+.LASF1347:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2360:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_START 1350"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2584:
+	.string	"SERIAL_UNIDIR"
+.LASF884:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF647:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2198:
+	.string	"LED_XY_MASK 0x0F"
+.LASF2149:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1489:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1646:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1603:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF636:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1362:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2590:
+	.string	"count"
+.LASF2679:
+	.string	"THROTTLE"
+.LASF2695:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF2444:
+	.string	"TEMPERATURE_INVALID_VALUE -1250"
+.LASF1070:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1690:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF2929:
+	.string	"cfTask_t"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1235:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF2756:
+	.string	"OSD_VARIO_NUM"
+.LASF2517:
+	.string	"OWNER_MOTOR"
+.LASF982:
+	.string	"USE_SERIALRX_SUMH "
+.LASF2825:
+	.string	"OSD_TEMP_SENSOR_7_TEMPERATURE"
+.LASF2860:
+	.string	"BOXHOMERESET"
+.LASF2337:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_SIMULATION_PRESS 0x02"
+.LASF676:
+	.string	"__S16_TYPE short int"
+.LASF971:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1609:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1439:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1904:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2106:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF870:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1328:
+	.string	"__DECL_SIMD_powf32 "
+.LASF582:
+	.string	"_SIZE_T_DECLARED "
+.LASF2503:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE_SCALE"
+.LASF2562:
+	.string	"RESOURCE_SPI_SCK"
+.LASF2802:
+	.string	"OSD_MANUAL_PITCH_RATE"
+.LASF1417:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1548:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF892:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF2262:
+	.string	"stdout stdout"
+.LASF2603:
+	.string	"rxBuffer"
+.LASF767:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF2669:
+	.string	"mspResult_e"
+.LASF2213:
+	.string	"OSD_LAYOUT_COUNT (OSD_ALTERNATE_LAYOUT_COUNT + 1)"
+.LASF1870:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2727:
+	.string	"PID_VEL_Z"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1441:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1141:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2161:
+	.string	"LED_CONFIGURABLE_COLOR_COUNT 16"
+.LASF1375:
+	.string	"__DECL_SIMD_exp2f "
+.LASF902:
+	.string	"UINT64_C(c) c ## UL"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1693:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1276:
+	.string	"__DECL_SIMD_cosl "
+.LASF2159:
+	.string	"RADAR_MAX_POIS 5"
+.LASF2757:
+	.string	"OSD_AIR_SPEED"
+.LASF1709:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF2955:
+	.string	"taskMainPidLoop"
+.LASF907:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2332:
+	.string	"RCDEVICE_PROTOCOL_HEADER 0xCC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2966:
+	.string	"updatePositionEstimator_PitotTopic"
+.LASF956:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF2028:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2286:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF2311:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1543:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1562:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1384:
+	.string	"__DECL_SIMD_exp10 "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF984:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1001:
+	.string	"_ANSI_STDDEF_H "
+.LASF1501:
+	.string	"__DECL_SIMD_erff32x "
+.LASF2564:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1303:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2760:
+	.string	"OSD_MESSAGES"
+.LASF591:
+	.string	"_WCHAR_T "
+.LASF1900:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2339:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_5KEY_CONNECTION 0x04"
+.LASF507:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1430:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1102:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF932:
+	.string	"USE_GYRO_KALMAN "
+.LASF2717:
+	.string	"armingFlags"
+.LASF1429:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF2766:
+	.string	"OSD_WH_DRAWN"
+.LASF2236:
+	.string	"__struct_FILE_defined 1"
+.LASF2006:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF440:
+	.string	"_POSIX_C_SOURCE"
+.LASF2810:
+	.string	"OSD_FW_POS_PID_OUTPUTS"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2324:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1192:
+	.string	"HSV_HUE_MAX 359"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1119:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1369:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF659:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF948:
+	.string	"USE_1WIRE_DS2482 "
+.LASF918:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF503:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF976:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1378:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1508:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1105:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2326:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF1626:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF488:
+	.string	"__flexarr []"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2070:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF2655:
+	.string	"FEATURE_AIRMODE"
+.LASF579:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2083:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2830:
+	.string	"OSD_GFORCE"
+.LASF1692:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2880:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF833:
+	.string	"__have_pthread_attr_t 1"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1282:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1405:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1473:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF2531:
+	.string	"OWNER_BEEPER"
+.LASF1317:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1861:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF964:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1630:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1296:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1993:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2970:
+	.string	"baroUpdate"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2434:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF1268:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF699:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2057:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1828:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF2181:
+	.string	"LED_MOV_POS(pos) ((pos) << LED_POS_OFFSET)"
+.LASF2313:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1140:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2797:
+	.string	"OSD_PITCH_RATE"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF2073:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2609:
+	.string	"rxCallback"
+.LASF2962:
+	.string	"schedulerInit"
+.LASF785:
+	.string	"_SYS_SELECT_H 1"
+.LASF1406:
+	.string	"__DECL_SIMD_expm1l "
+.LASF596:
+	.string	"_BSD_WCHAR_T_ "
+.LASF888:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF791:
+	.string	"____sigset_t_defined "
+.LASF1177:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF1985:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2165:
+	.string	"LED_OVERLAY_COUNT 6"
+.LASF1307:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1440:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2138:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1243:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1739:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF735:
+	.string	"__STD_TYPE"
+.LASF2385:
+	.string	"DJI_MSP_PID 112"
+.LASF2813:
+	.string	"OSD_MC_VEL_Z_PID_OUTPUTS"
+.LASF1050:
+	.string	"USE_1WIRE_DS2482"
+.LASF1898:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1850:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF2818:
+	.string	"OSD_TEMP_SENSOR_0_TEMPERATURE"
+.LASF2119:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1983:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF394:
+	.string	"bool _Bool"
+.LASF2744:
+	.string	"OSD_GPS_SATS"
+.LASF2316:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1261:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF2020:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1783:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1323:
+	.string	"__DECL_SIMD_expf128x "
+.LASF850:
+	.string	"INT32_MAX (2147483647)"
+.LASF2361:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MID_END 1650"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1933:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1781:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1027:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1376:
+	.string	"__DECL_SIMD_exp2l "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1420:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1000:
+	.string	"_STDDEF_H_ "
+.LASF852:
+	.string	"UINT8_MAX (255)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1500:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1866:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF597:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF2778:
+	.string	"OSD_REMAINING_FLIGHT_TIME_BEFORE_RTH"
+.LASF1241:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1610:
+	.string	"FP_NAN 0"
+.LASF2013:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF2056:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2048:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1240:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1925:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF2405:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2315:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF1823:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2779:
+	.string	"OSD_REMAINING_DISTANCE_BEFORE_RTH"
+.LASF906:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2426:
+	.string	"RC_CHANNEL_HEADLESS RC_SPI_AUX5"
+.LASF527:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2959:
+	.string	"getLooptime"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2088:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF1258:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2713:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF2018:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1713:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2095:
+	.string	"PULSE_1MS (1000)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2051:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2001:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1457:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF2276:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF876:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1772:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1886:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF2482:
+	.string	"short int"
+.LASF1594:
+	.string	"__MATHCALL"
+.LASF2184:
+	.string	"LED_MOV_COLOR(colorId) ((colorId) << LED_COLOR_OFFSET)"
+.LASF763:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2666:
+	.string	"MSP_RESULT_ACK"
+.LASF1873:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1071:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF792:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF1445:
+	.string	"__DECL_SIMD_log10f "
+.LASF2336:
+	.string	"RCDEVICE_PROTOCOL_COMMAND_CAMERA_CONTROL 0x01"
+.LASF917:
+	.string	"USE_ADC_AVERAGING "
+.LASF1862:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF2644:
+	.string	"FEATURE_CURRENT_METER"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1915:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1209:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF2261:
+	.string	"stdin stdin"
+.LASF571:
+	.string	"__SIZE_T__ "
+.LASF1389:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF570:
+	.string	"__size_t__ "
+.LASF2842:
+	.string	"BOXNAVALTHOLD"
+.LASF2206:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF858:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF2507:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_PITCH"
+.LASF1196:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1650:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2807:
+	.string	"OSD_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF623:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1143:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF727:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2343:
+	.string	"MAX_WAITING_RESPONSES 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF611:
+	.string	"WNOHANG 1"
+.LASF1100:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1114:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1629:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1951:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1435:
+	.string	"__DECL_SIMD_atan2f "
+.LASF2532:
+	.string	"OWNER_OSD"
+.LASF2559:
+	.string	"RESOURCE_EXTI"
+.LASF1493:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1934:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2789:
+	.string	"OSD_VEL_XY_PIDS"
+.LASF2884:
+	.string	"mspEvaluateNonMspData_e"
+.LASF2227:
+	.string	"_STDIO_H 1"
+.LASF922:
+	.string	"USE_NAV "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2113:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF484:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1541:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1074:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF872:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF728:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2597:
+	.string	"identifier"
+.LASF911:
+	.string	"USE_SERIAL_RX "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2999:
+	.string	"taskHandleSerial"
+.LASF1765:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF2309:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF847:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2751:
+	.string	"OSD_GPS_LAT"
+.LASF1998:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF704:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2347:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF723:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF679:
+	.string	"__U32_TYPE unsigned int"
+.LASF2122:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2002:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF2365:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF2801:
+	.string	"OSD_MANUAL_RC_YAW_EXPO"
+.LASF2926:
+	.string	"totalExecutionTime"
+.LASF383:
+	.string	"SITL 1"
+.LASF439:
+	.string	"_POSIX_SOURCE 1"
+.LASF663:
+	.string	"__f64x(x) x ##f64x"
+.LASF777:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1674:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1190:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF883:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2600:
+	.string	"baudRate"
+.LASF2304:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF790:
+	.string	"__sigset_t_defined 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF594:
+	.string	"__WCHAR_T "
+.LASF674:
+	.string	"_SYS_TYPES_H 1"
+.LASF2721:
+	.string	"PID_POS_Z"
+.LASF1388:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF779:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF1127:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF2855:
+	.string	"BOXTELEMETRY"
+.LASF682:
+	.string	"__SQUAD_TYPE long int"
+.LASF2007:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1147:
+	.string	"READONLY (1 << 4)"
+.LASF671:
+	.string	"EXIT_FAILURE 1"
+.LASF2850:
+	.string	"BOXBEEPERON"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1198:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2662:
+	.string	"FEATURE_OSD"
+.LASF2225:
+	.string	"OSD_HOMING_LIM_V2 10"
+.LASF457:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF739:
+	.string	"__gid_t_defined "
+.LASF2474:
+	.string	"long int"
+.LASF2719:
+	.string	"PID_PITCH"
+.LASF2792:
+	.string	"OSD_BOARD_ALIGN_ROLL"
+.LASF653:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1559:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1835:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2898:
+	.string	"TASK_GPS"
+.LASF1253:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1156:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF2277:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2345:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF2484:
+	.string	"__int32_t"
+.LASF832:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF2325:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF2053:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2144:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF969:
+	.string	"CMS_MENU_OSD "
+.LASF689:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1649:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF2847:
+	.string	"BOXNAVRTH"
+.LASF1482:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2859:
+	.string	"BOXAIRMODE"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF2932:
+	.string	"SENSOR_INDEX_ACC"
+.LASF899:
+	.string	"UINT8_C(c) c"
+.LASF782:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF646:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1639:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF945:
+	.string	"USE_OPFLOW_MSP "
+.LASF1908:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2795:
+	.string	"OSD_RC_YAW_EXPO"
+.LASF1135:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2626:
+	.string	"writeBufChunks"
+.LASF2273:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1620:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1608:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF2791:
+	.string	"OSD_HEADING_P"
+.LASF2103:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF1207:
+	.string	"EXPAND_I(x) x"
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2768:
+	.string	"OSD_BATTERY_REMAINING_PERCENT"
+.LASF590:
+	.string	"__WCHAR_T__ "
+.LASF2212:
+	.string	"OSD_ALTERNATE_LAYOUT_COUNT 3"
+.LASF1527:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF2653:
+	.string	"FEATURE_UNUSED_10"
+.LASF2660:
+	.string	"FEATURE_UNUSED_11"
+.LASF2036:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2941:
+	.string	"SENSOR_BARO"
+.LASF795:
+	.string	"__suseconds_t_defined "
+.LASF1591:
+	.string	"__MATHDECL_1"
+.LASF2580:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2581:
+	.string	"SERIAL_STOPBITS_2"
+.LASF626:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF2896:
+	.string	"TASK_BATTERY"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1291:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF962:
+	.string	"USE_D_BOOST "
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF1797:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF1540:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF963:
+	.string	"USE_ANTIGRAVITY "
+.LASF2612:
+	.string	"rxIrqCount"
+.LASF1730:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF395:
+	.string	"true 1"
+.LASF2418:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF2578:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF1542:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF2355:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1837:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF714:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF698:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1436:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1485:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1167:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF1804:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF649:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1232:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF1618:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1227:
+	.string	"GLOBAL_FUNCTION_FLAG_ENABLE(mask) (globalFunctionsFlags |= (mask))"
+.LASF1613:
+	.string	"FP_SUBNORMAL 3"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF505:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF778:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1617:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF665:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2566:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2567:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2568:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2569:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1273:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF684:
+	.string	"__SWORD_TYPE long int"
+.LASF2996:
+	.string	"newDeadline"
+.LASF1316:
+	.string	"__DECL_SIMD_expl "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2427:
+	.string	"RC_CHANNEL_RTH RC_SPI_AUX6"
+.LASF2121:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1255:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2933:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1059:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF2488:
+	.string	"int16_t"
+.LASF2052:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2461:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF1966:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2608:
+	.string	"txBufferTail"
+.LASF2079:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF514:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1343:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2125:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF2258:
+	.string	"L_ctermid 9"
+.LASF1897:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1653:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2116:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF903:
+	.string	"INTMAX_C(c) c ## L"
+.LASF2384:
+	.string	"DJI_MSP_RC_TUNING 111"
+.LASF1289:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF422:
+	.string	"__USE_GNU"
+.LASF859:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2429:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF1016:
+	.string	"USE_IMU_FAKE "
+.LASF2836:
+	.string	"OSD_ESC_RPM"
+.LASF1170:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF1197:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF803:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF463:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF894:
+	.string	"WINT_MAX (4294967295u)"
+.LASF625:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF454:
+	.string	"__USE_MISC 1"
+.LASF688:
+	.string	"__S64_TYPE long int"
+.LASF2613:
+	.string	"serialPortVTable"
+.LASF2259:
+	.string	"FOPEN_MAX"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1531:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2635:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1325:
+	.string	"__DECL_SIMD_powf "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1163:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1749:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF450:
+	.string	"__WORDSIZE 64"
+.LASF1279:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1568:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1581:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2838:
+	.string	"OSD_ITEM_COUNT"
+.LASF2100:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF934:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF2378:
+	.string	"DJI_MSP_RC 105"
+.LASF2454:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1212:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2395:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF2403:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF2097:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1585:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1719:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2383:
+	.string	"DJI_MSP_ANALOG 110"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1038:
+	.string	"USE_USB_MSC"
+.LASF801:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF1876:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1172:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF569:
+	.string	"__need_NULL "
+.LASF762:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF661:
+	.string	"__f64(x) x ##f64"
+.LASF683:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1310:
+	.string	"__DECL_SIMD_logf128 "
+.LASF485:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF717:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2234:
+	.string	"____FILE_defined 1"
+.LASF2369:
+	.string	"DJI_API_VERSION_MINOR 42"
+.LASF1064:
+	.string	"U_ID_1 1"
+.LASF1290:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2953:
+	.string	"cmsHandler"
+.LASF1031:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1060:
+	.string	"USE_ITCM_RAM"
+.LASF2697:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2400:
+	.string	"MIDRC_MIN 1200"
+.LASF1486:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1308:
+	.string	"__DECL_SIMD_logf32 "
+.LASF993:
+	.string	"USE_VTX_FFPV "
+.LASF912:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1446:
+	.string	"__DECL_SIMD_log10l "
+.LASF2128:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1179:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF1083:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2450:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF2715:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF651:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2652:
+	.string	"FEATURE_BLACKBOX"
+.LASF952:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2579:
+	.string	"SERIAL_INVERTED"
+.LASF2439:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF1313:
+	.string	"__DECL_SIMD_logf128x "
+.LASF474:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF491:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2168:
+	.string	"LED_FUNCTION_OFFSET 8"
+.LASF2819:
+	.string	"OSD_TEMP_SENSOR_1_TEMPERATURE"
+.LASF2708:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF2382:
+	.string	"DJI_MSP_ALTITUDE 109"
+.LASF2897:
+	.string	"TASK_TEMPERATURE"
+.LASF2281:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1651:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF2552:
+	.string	"RESOURCE_INPUT"
+.LASF2141:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF823:
+	.string	"__LOCK_ALIGNMENT "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1044:
+	.string	"USE_RANGEFINDER"
+.LASF855:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1424:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2946:
+	.string	"SENSOR_GPS"
+.LASF1612:
+	.string	"FP_ZERO 2"
+.LASF1521:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1528:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1099:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2964:
+	.string	"updatePositionEstimator_OpticalFlowTopic"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF498:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF677:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2350:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1901:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF518:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2049:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF961:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2124:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2538:
+	.string	"OWNER_RX"
+.LASF444:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1377:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1049:
+	.string	"USE_1WIRE"
+.LASF750:
+	.string	"__clockid_t_defined 1"
+.LASF1780:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF2075:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2677:
+	.string	"ROLL"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2080:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF2796:
+	.string	"OSD_THROTTLE_EXPO"
+.LASF2464:
+	.string	"RANGEFINDER_HARDWARE_FAILURE (-2)"
+.LASF2508:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_YAW"
+.LASF869:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2344:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF2371:
+	.string	"DJI_MSP_FC_VARIANT 2"
+.LASF2447:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF2746:
+	.string	"OSD_ROLL_PIDS"
+.LASF2180:
+	.string	"LED_FLAG_DIRECTION_MASK ((1 << LED_DIRECTION_BITCNT) - 1)"
+.LASF2947:
+	.string	"SENSOR_GPSMAG"
+.LASF1952:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2622:
+	.string	"isConnected"
+.LASF1715:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF2479:
+	.string	"signed char"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF686:
+	.string	"__SLONG32_TYPE int"
+.LASF752:
+	.string	"__timer_t_defined 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF2981:
+	.string	"djiOsdSerialProcess"
+.LASF2362:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF921:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1596:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1112:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF504:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2539:
+	.string	"OWNER_TX"
+.LASF770:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF2772:
+	.string	"OSD_ATTITUDE_ROLL"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF810:
+	.string	"__fsfilcnt_t_defined "
+.LASF2204:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF2750:
+	.string	"OSD_GPS_LON"
+.LASF2745:
+	.string	"OSD_ALTITUDE"
+.LASF827:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF510:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1247:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1589:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1645:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF470:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2948:
+	.string	"SENSOR_TEMP"
+.LASF2993:
+	.string	"taskProcessGPS"
+.LASF2136:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF1530:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF896:
+	.string	"INT16_C(c) c"
+.LASF2997:
+	.string	"batMonitoringLastServiced"
+.LASF2229:
+	.string	"__need___va_list"
+.LASF2003:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF2035:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF673:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF2435:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF2299:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF950:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1658:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1770:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2592:
+	.string	"serialReceiveCallbackPtr"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF857:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2486:
+	.string	"__uint64_t"
+.LASF2064:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1721:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1583:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1640:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF2574:
+	.string	"MODE_TX"
+.LASF2169:
+	.string	"LED_OVERLAY_OFFSET 12"
+.LASF2328:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF2775:
+	.string	"OSD_RADAR"
+.LASF2957:
+	.string	"setTaskEnabled"
+.LASF539:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2424:
+	.string	"RC_CHANNEL_PICTURE RC_SPI_AUX3"
+.LASF1511:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1948:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1085:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1415:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1940:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF2054:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1449:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2670:
+	.string	"mspPacket_s"
+.LASF2673:
+	.string	"mspPacket_t"
+.LASF1924:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2935:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF1188:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF2091:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF529:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1153:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1604:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1846:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2967:
+	.string	"pitotUpdate"
+.LASF2172:
+	.string	"LED_PARAMS_OFFSET 28"
+.LASF2915:
+	.string	"checkFunc"
+.LASF1975:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF1432:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1856:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1569:
+	.string	"_Mdouble_"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1561:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1407:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF2349:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2492:
+	.string	"uint16_t"
+.LASF2014:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF863:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2800:
+	.string	"OSD_MANUAL_RC_EXPO"
+.LASF731:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF2893:
+	.string	"TASK_GYROPID"
+.LASF1157:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF1098:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF536:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF487:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1042:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF2164:
+	.string	"LED_BASEFUNCTION_COUNT 7"
+.LASF1967:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1262:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF535:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1214:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF521:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF2490:
+	.string	"long long unsigned int"
+.LASF1888:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF924:
+	.string	"USE_TELEMETRY_LTM "
+.LASF2777:
+	.string	"OSD_WIND_SPEED_VERTICAL"
+.LASF1880:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1656:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1916:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2960:
+	.string	"blackboxProcess"
+.LASF1512:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1020:
+	.string	"USE_MAG "
+.LASF1124:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF543:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF957:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1365:
+	.string	"__DECL_SIMD_hypotf "
+.LASF2995:
+	.string	"taskUpdateBattery"
+.LASF2648:
+	.string	"FEATURE_RSSI_ADC"
+.LASF530:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF2698:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF2631:
+	.string	"ADC_AIRSPEED"
+.LASF1006:
+	.string	"_PTRDIFF_T_ "
+.LASF1766:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF988:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF1502:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2401:
+	.string	"MIDRC_MAX 1700"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2150:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF442:
+	.string	"__USE_POSIX 1"
+.LASF994:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF2788:
+	.string	"OSD_POS_Z_PIDS"
+.LASF1092:
+	.string	"EXTENDED_FASTRAM "
+.LASF920:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1437:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF2526:
+	.string	"OWNER_SPI"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2010:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1660:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF910:
+	.string	"USE_RX_PPM "
+.LASF1442:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1248:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF499:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF472:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2282:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1601:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1602:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF549:
+	.string	"__stub_revoke "
+.LASF2930:
+	.string	"cfTasks"
+.LASF1633:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF2398:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1712:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF532:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1498:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2420:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF2732:
+	.string	"OSD_CROSSHAIRS"
+.LASF974:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF745:
+	.string	"__id_t_defined "
+.LASF2221:
+	.string	"OSD_HOMING_LIM_H1 6"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1503:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1295:
+	.string	"__DECL_SIMD_sincosf "
+.LASF473:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF2911:
+	.string	"TASK_NONE"
+.LASF2158:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1736:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1510:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1842:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF502:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2356:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2366:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF1487:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF925:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1041:
+	.string	"USE_OLED_UG2864"
+.LASF1847:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2264:
+	.string	"__attr_dealloc_fclose"
+.LASF2228:
+	.string	"__need___va_list "
+.LASF2891:
+	.string	"TASK_PRIORITY_MAX"
+.LASF738:
+	.string	"__dev_t_defined "
+.LASF1422:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2318:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF1547:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1034:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1118:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1558:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2961:
+	.string	"telemetryProcess"
+.LASF2573:
+	.string	"MODE_RX"
+.LASF2058:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF946:
+	.string	"USE_PITOT_MS4525 "
+.LASF1737:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF805:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF645:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF620:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1778:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF914:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1524:
+	.string	"__DECL_SIMD_erfc "
+.LASF904:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1647:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2758:
+	.string	"OSD_ONTIME_FLYTIME"
+.LASF2266:
+	.string	"_BITS_STDIO_H 1"
+.LASF751:
+	.string	"__time_t_defined 1"
+.LASF520:
+	.string	"__restrict_arr __restrict"
+.LASF2899:
+	.string	"TASK_COMPASS"
+.LASF438:
+	.string	"_POSIX_SOURCE"
+.LASF2380:
+	.string	"DJI_MSP_COMP_GPS 107"
+.LASF2771:
+	.string	"OSD_ATTITUDE_PITCH"
+.LASF2671:
+	.string	"flags"
+.LASF2985:
+	.string	"taskBlackbox"
+.LASF1266:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1121:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2709:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF901:
+	.string	"UINT32_C(c) c ## U"
+.LASF2077:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF1769:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2358:
+	.string	"FIVE_KEY_CABLE_JOYSTICK_MIN 1080"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF1078:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2377:
+	.string	"DJI_MSP_STATUS 101"
+.LASF2726:
+	.string	"PID_HEADING"
+.LASF2201:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF2108:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF600:
+	.string	"___int_wchar_t_h "
+.LASF2442:
+	.string	"TEMPERATURE_LABEL_LEN 4"
+.LASF702:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF954:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF2025:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1999:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1359:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2561:
+	.string	"RESOURCE_I2C_SDA"
+.LASF774:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF568:
+	.string	"__need_wchar_t "
+.LASF2219:
+	.string	"OSD_POS_MAX 0x3FF"
+.LASF1182:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF2639:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF2743:
+	.string	"OSD_GPS_SPEED"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2487:
+	.string	"char"
+.LASF2520:
+	.string	"OWNER_ADC"
+.LASF2237:
+	.string	"__getc_unlocked_body(_fp) (__glibc_unlikely ((_fp)->_IO_read_ptr >= (_fp)->_IO_read_end) ? __uflow (_fp) : *(unsigned char *) (_fp)->_IO_read_ptr++)"
+.LASF754:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1479:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1067:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1563:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2085:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF2738:
+	.string	"OSD_CRAFT_NAME"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1205:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1576:
+	.string	"_Mdouble_ long double"
+.LASF1238:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1339:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1366:
+	.string	"__DECL_SIMD_hypotl "
+.LASF2844:
+	.string	"BOXHEADFREE"
+.LASF1533:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF712:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2251:
+	.string	"SEEK_CUR 1"
+.LASF811:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1495:
+	.string	"__DECL_SIMD_erff "
+.LASF2334:
+	.string	"RCDEVICE_PROTOCOL_MAX_DATA_SIZE 20"
+.LASF853:
+	.string	"UINT16_MAX (65535)"
+.LASF2731:
+	.string	"OSD_MAIN_BATT_VOLTAGE"
+.LASF1616:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF2177:
+	.string	"LED_DIRECTION_BITCNT 6"
+.LASF1578:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF613:
+	.string	"WSTOPPED 2"
+.LASF525:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2050:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1505:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1812:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2455:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF466:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF848:
+	.string	"INT8_MAX (127)"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2563:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2617:
+	.string	"serialRead"
+.LASF572:
+	.string	"_SIZE_T "
+.LASF2163:
+	.string	"LED_DIRECTION_COUNT 6"
+.LASF1111:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2543:
+	.string	"OWNER_COMPASS"
+.LASF2623:
+	.string	"isIdle"
+.LASF585:
+	.string	"_GCC_SIZE_T "
+.LASF1106:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1096:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF895:
+	.string	"INT8_C(c) c"
+.LASF606:
+	.string	"__need_wchar_t"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1080:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1150:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF2452:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF2678:
+	.string	"PITCH"
+.LASF1077:
+	.string	"NOINLINE "
+.LASF678:
+	.string	"__S32_TYPE int"
+.LASF2305:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1910:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2026:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1109:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1226:
+	.string	"GLOBAL_FUNCTION_FLAG_DISABLE(mask) (globalFunctionsFlags &= ~(mask))"
+.LASF2512:
+	.string	"GLOBAL_FUNCTION_ACTION_LAST"
+.LASF573:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF2636:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF726:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1004:
+	.string	"_T_PTRDIFF "
+.LASF2820:
+	.string	"OSD_TEMP_SENSOR_2_TEMPERATURE"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF756:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1723:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF2909:
+	.string	"TASK_BLACKBOX"
+.LASF2927:
+	.string	"executionTimeHistogram"
+.LASF1333:
+	.string	"__DECL_SIMD_powf128x "
+.LASF577:
+	.string	"_SIZE_T_ "
+.LASF1438:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2702:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1808:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF992:
+	.string	"USE_VTX_TRAMP "
+.LASF2372:
+	.string	"DJI_MSP_FC_VERSION 3"
+.LASF2514:
+	.string	"OWNER_PWMIO"
+.LASF2280:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF2061:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2882:
+	.string	"MSP_EVALUATE_NON_MSP_DATA"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF2594:
+	.string	"serialBufChunk_s"
+.LASF2591:
+	.string	"serialBufChunk_t"
+.LASF1230:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1750:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF2224:
+	.string	"OSD_HOMING_LIM_V1 5"
+.LASF465:
+	.string	"__PMT"
+.LASF2704:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1453:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1073:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1939:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2874:
+	.string	"BOXNAVCRUISE"
+.LASF1202:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1931:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2589:
+	.string	"data"
+.LASF2294:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF477:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2537:
+	.string	"OWNER_LED"
+.LASF2510:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_BAND"
+.LASF586:
+	.string	"_SIZET_ "
+.LASF1408:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1017:
+	.string	"USE_FAKE_BARO "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF662:
+	.string	"__f32x(x) x ##f32x"
+.LASF1128:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1807:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2557:
+	.string	"RESOURCE_UART_RX"
+.LASF2720:
+	.string	"PID_YAW"
+.LASF574:
+	.string	"_T_SIZE_ "
+.LASF1180:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF1319:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1963:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF2466:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)"
+.LASF1086:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2208:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF1274:
+	.string	"__DECL_SIMD_cos "
+.LASF1275:
+	.string	"__DECL_SIMD_cosf "
+.LASF542:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF2700:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF1090:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1519:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2598:
+	.string	"mode"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF540:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1455:
+	.string	"__DECL_SIMD_log2f "
+.LASF2437:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2949:
+	.string	"globalFunctionsUpdateTask"
+.LASF1777:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1032:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF841:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF996:
+	.string	"USE_CLI_BATCH "
+.LASF1012:
+	.string	"__need_ptrdiff_t"
+.LASF1094:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF666:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF802:
+	.string	"NFDBITS __NFDBITS"
+.LASF1454:
+	.string	"__DECL_SIMD_log2 "
+.LASF447:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1957:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2458:
+	.string	"_STRINGS_H 1"
+.LASF1879:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"__COMPAR_FN_T "
+.LASF1871:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2984:
+	.string	"cliProcess"
+.LASF1204:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1652:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF2174:
+	.string	"LED_FUNCTION_BITCNT 4"
+.LASF2783:
+	.string	"OSD_SAG_COMPENSATED_MAIN_BATT_VOLTAGE"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2942:
+	.string	"SENSOR_MAG"
+.LASF1991:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2556:
+	.string	"RESOURCE_UART_TX"
+.LASF2274:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF1195:
+	.string	"HSV_COLOR_COMPONENT_COUNT (HSV_VALUE + 1)"
+.LASF1496:
+	.string	"__DECL_SIMD_erfl "
+.LASF1794:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1444:
+	.string	"__DECL_SIMD_log10 "
+.LASF1467:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF508:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2231:
+	.string	"_____fpos_t_defined 1"
+.LASF1379:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1267:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF2914:
+	.string	"taskName"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF695:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF456:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2249:
+	.string	"EOF (-1)"
+.LASF2060:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1008:
+	.string	"___int_ptrdiff_t_h "
+.LASF476:
+	.string	"__PMT(args) args"
+.LASF2876:
+	.string	"BOXUSER1"
+.LASF2877:
+	.string	"BOXUSER2"
+.LASF2628:
+	.string	"ADC_BATTERY"
+.LASF2310:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF1387:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF880:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1678:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1491:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1233:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1471:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1855:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1552:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2160:
+	.string	"LED_MAX_STRIP_LENGTH 32"
+.LASF2176:
+	.string	"LED_COLOR_BITCNT 4"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1673:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2680:
+	.string	"AUX1"
+.LASF2681:
+	.string	"AUX2"
+.LASF2682:
+	.string	"AUX3"
+.LASF2683:
+	.string	"AUX4"
+.LASF2684:
+	.string	"AUX5"
+.LASF2685:
+	.string	"AUX6"
+.LASF2686:
+	.string	"AUX7"
+.LASF2687:
+	.string	"AUX8"
+.LASF2688:
+	.string	"AUX9"
+.LASF1385:
+	.string	"__DECL_SIMD_exp10f "
+.LASF2238:
+	.string	"__putc_unlocked_body(_ch,_fp) (__glibc_unlikely ((_fp)->_IO_write_ptr >= (_fp)->_IO_write_end) ? __overflow (_fp, (unsigned char) (_ch)) : (unsigned char) (*(_fp)->_IO_write_ptr++ = (_ch)))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF719:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF2211:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF1416:
+	.string	"__DECL_SIMD_sinhl "
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2471:
+	.string	"UIB_DEVICE_ID_RC_RECEIVER 0x80"
+.LASF1428:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2864:
+	.string	"BOXFLAPERON"
+.LASF2289:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2990:
+	.string	"taskUpdatePitot"
+.LASF1057:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF931:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2354:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1208:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF867:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2632:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF604:
+	.string	"__DEFINED_wchar_t "
+.LASF2093:
+	.string	"MAX_SERVOS 16"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1129:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF506:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2912:
+	.string	"TASK_SELF"
+.LASF1906:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF706:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF909:
+	.string	"USE_I2C_PULLUP "
+.LASF1748:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1285:
+	.string	"__DECL_SIMD_sinf "
+.LASF1738:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF2908:
+	.string	"TASK_GLOBAL_FUNCTIONS"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF825:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF2540:
+	.string	"OWNER_RX_SPI"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF824:
+	.string	"__ONCE_ALIGNMENT "
+.LASF592:
+	.string	"_T_WCHAR_ "
+.LASF2975:
+	.string	"updateWindEstimator"
+.LASF2530:
+	.string	"OWNER_USB"
+.LASF2533:
+	.string	"OWNER_BARO"
+.LASF2191:
+	.string	"LED_COLOR_MASK LED_MOV_COLOR(((1 << LED_COLOR_BITCNT) - 1))"
+.LASF2387:
+	.string	"DJI_MSP_ESC_SENSOR_DATA 134"
+.LASF1011:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1655:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1399:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF587:
+	.string	"__size_t "
+.LASF721:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1790:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1292:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF468:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF2529:
+	.string	"OWNER_FLASH"
+.LASF2816:
+	.string	"OSD_IMU_TEMPERATURE"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF2390:
+	.string	"DJI_MSP_SET_FILTER_CONFIG 93"
+.LASF768:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF2904:
+	.string	"TASK_OPFLOW"
+.LASF2798:
+	.string	"OSD_ROLL_RATE"
+.LASF2974:
+	.string	"sensors"
+.LASF2146:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1154:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF2373:
+	.string	"DJI_MSP_NAME 10"
+.LASF1638:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1087:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2637:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF740:
+	.string	"__mode_t_defined "
+.LASF621:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF2409:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF1592:
+	.string	"__MATHDECL_ALIAS"
+.LASF1030:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2357:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1814:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF2938:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF2815:
+	.string	"OSD_3D_SPEED"
+.LASF1414:
+	.string	"__DECL_SIMD_sinh "
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1456:
+	.string	"__DECL_SIMD_log2l "
+.LASF1764:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2489:
+	.string	"int32_t"
+.LASF1137:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1832:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2248:
+	.string	"BUFSIZ 8192"
+.LASF437:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1166:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF879:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1621:
+	.string	"MATH_ERRNO 1"
+.LASF1661:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1341:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1905:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2828:
+	.string	"OSD_MAP_SCALE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF2352:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF843:
+	.string	"__intptr_t_defined "
+.LASF2992:
+	.string	"taskUpdateCompass"
+.LASF1668:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2104:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF928:
+	.string	"USE_PITOT "
+.LASF1452:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2907:
+	.string	"TASK_LOGIC_CONDITIONS"
+.LASF2171:
+	.string	"LED_DIRECTION_OFFSET 22"
+.LASF1490:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1550:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2998:
+	.string	"BatMonitoringTimeSinceLastServiced"
+.LASF1470:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2468:
+	.string	"UIB_DEVICE_ID_RANGEFINDER 0x12"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1015:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2314:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF798:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF675:
+	.string	"_BITS_TYPES_H 1"
+.LASF2253:
+	.string	"P_tmpdir \"/tmp\""
+.LASF2736:
+	.string	"OSD_FLYTIME"
+.LASF2175:
+	.string	"LED_OVERLAY_BITCNT 6"
+.LASF2101:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1045:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2441:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF2994:
+	.string	"taskUpdateTemperature"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2209:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1107:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2288:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2478:
+	.string	"unsigned int"
+.LASF2000:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF900:
+	.string	"UINT16_C(c) c"
+.LASF2711:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF2470:
+	.string	"UIB_DEVICE_ID_COMPASS 0x14"
+.LASF1760:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1565:
+	.string	"_Mdouble_ double"
+.LASF1990:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF1982:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1686:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2140:
+	.string	"RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)"
+.LASF1213:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3037:
+	.string	"color.h"
+.LASF3130:
+	.string	"exti.h"
+.LASF3016:
+	.string	"src/main/io"
+.LASF3188:
+	.string	"gyro.h"
+.LASF3092:
+	.string	"time64.h"
+.LASF3137:
+	.string	"dma.h"
+.LASF3034:
+	.string	"stdint-intn.h"
+.LASF3166:
+	.string	"ledstrip.h"
+.LASF3043:
+	.string	"streambuf.h"
+.LASF3100:
+	.string	"uintn-identity.h"
+.LASF3056:
+	.string	"uav_interconnect.h"
+.LASF3054:
+	.string	"logic_condition.h"
+.LASF3008:
+	.string	"src/main/drivers/accgyro"
+.LASF3128:
+	.string	"utils.h"
+.LASF3129:
+	.string	"accgyro.h"
+.LASF3176:
+	.string	"struct_FILE.h"
+.LASF3071:
+	.string	"osd_dji_hd.h"
+.LASF3077:
+	.string	"libc-header-start.h"
+.LASF3115:
+	.string	"stdint.h"
+.LASF3038:
+	.string	"global_functions.h"
+.LASF3112:
+	.string	"alloca.h"
+.LASF3006:
+	.string	"src/main/common"
+.LASF3106:
+	.string	"pthreadtypes.h"
+.LASF3052:
+	.string	"scheduler.h"
+.LASF3075:
+	.string	"stdbool.h"
+.LASF3123:
+	.string	"parameter_group.h"
+.LASF3074:
+	.string	"stdc-predef.h"
+.LASF3108:
+	.string	"pthreadtypes-arch.h"
+.LASF3148:
+	.string	"io.h"
+.LASF3081:
+	.string	"timesize.h"
+.LASF3036:
+	.string	"time.h"
+.LASF3184:
+	.string	"rx.h"
+.LASF3072:
+	.string	"fc_msp.h"
+.LASF3031:
+	.string	"/usr/include"
+.LASF3097:
+	.string	"endian.h"
+.LASF3027:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3103:
+	.string	"__sigset_t.h"
+.LASF3057:
+	.string	"cms.h"
+.LASF3162:
+	.string	"failsafe.h"
+.LASF3025:
+	.string	"src/main/uav_interconnect"
+.LASF3114:
+	.string	"stdlib-float.h"
+.LASF3134:
+	.string	"bus_i2c.h"
+.LASF3138:
+	.string	"vector.h"
+.LASF3051:
+	.string	"msp_serial.h"
+.LASF3111:
+	.string	"struct_rwlock.h"
+.LASF3024:
+	.string	"src/main/telemetry"
+.LASF3113:
+	.string	"stdlib-bsearch.h"
+.LASF3154:
+	.string	"servos.h"
+.LASF3019:
+	.string	"src/main/rx"
+.LASF3064:
+	.string	"barometer.h"
+.LASF3144:
+	.string	"fp-fast.h"
+.LASF3068:
+	.string	"feature.h"
+.LASF3146:
+	.string	"mathcalls.h"
+.LASF0:
+	.string	"./src/main/fc/fc_tasks.c"
+.LASF3126:
+	.string	"cms_types.h"
+.LASF3110:
+	.string	"struct_mutex.h"
+.LASF3186:
+	.string	"rx_spi.h"
+.LASF3070:
+	.string	"battery.h"
+.LASF3179:
+	.string	"locale_t.h"
+.LASF3045:
+	.string	"rc_controls.h"
+.LASF3168:
+	.string	"rcdevice_cam.h"
+.LASF3094:
+	.string	"clockid_t.h"
+.LASF3029:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF3044:
+	.string	"msp.h"
+.LASF3139:
+	.string	"math.h"
+.LASF3003:
+	.string	"src/main/blackbox"
+.LASF3101:
+	.string	"select.h"
+.LASF3066:
+	.string	"gps.h"
+.LASF3119:
+	.string	"target.h"
+.LASF3191:
+	.string	"string.h"
+.LASF3020:
+	.string	"src/main/scheduler"
+.LASF3118:
+	.string	"common.h"
+.LASF3095:
+	.string	"time_t.h"
+.LASF3088:
+	.string	"waitstatus.h"
+.LASF3090:
+	.string	"floatn-common.h"
+.LASF3141:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3010:
+	.string	"src/main/drivers/compass"
+.LASF3171:
+	.string	"__fpos_t.h"
+.LASF3021:
+	.string	"src/main/sensors"
+.LASF3149:
+	.string	"io_def.h"
+.LASF3102:
+	.string	"sigset_t.h"
+.LASF3085:
+	.string	"stubs-64.h"
+.LASF3087:
+	.string	"waitflags.h"
+.LASF3063:
+	.string	"pitotmeter.h"
+.LASF3140:
+	.string	"math-vector.h"
+.LASF3007:
+	.string	"src/main/config"
+.LASF3131:
+	.string	"io_types.h"
+.LASF3167:
+	.string	"pwmdriver_i2c.h"
+.LASF3157:
+	.string	"fc_core.h"
+.LASF3086:
+	.string	"stddef.h"
+.LASF3026:
+	.string	"src/main"
+.LASF3163:
+	.string	"beeper.h"
+.LASF3053:
+	.string	"sensors.h"
+.LASF3048:
+	.string	"pid.h"
+.LASF3011:
+	.string	"src/main/drivers/opflow"
+.LASF3122:
+	.string	"blackbox_fielddefs.h"
+.LASF3015:
+	.string	"src/main/flight"
+.LASF3099:
+	.string	"byteswap.h"
+.LASF3164:
+	.string	"lights.h"
+.LASF3091:
+	.string	"typesizes.h"
+.LASF3004:
+	.string	"src/main/build"
+.LASF3049:
+	.string	"osd.h"
+.LASF3018:
+	.string	"src/main/navigation"
+.LASF3061:
+	.string	"navigation.h"
+.LASF3135:
+	.string	"rcc_types.h"
+.LASF3187:
+	.string	"acceleration.h"
+.LASF3073:
+	.string	"fc_tasks.c"
+.LASF3032:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3058:
+	.string	"fc_tasks.h"
+.LASF3096:
+	.string	"timer_t.h"
+.LASF3185:
+	.string	"eleres.h"
+.LASF3136:
+	.string	"bus_spi.h"
+.LASF3065:
+	.string	"compass.h"
+.LASF3175:
+	.string	"FILE.h"
+.LASF3030:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3120:
+	.string	"sanity_check.h"
+.LASF3059:
+	.string	"blackbox.h"
+.LASF3192:
+	.string	"strings.h"
+.LASF3161:
+	.string	"filter.h"
+.LASF3013:
+	.string	"src/main/drivers"
+.LASF3023:
+	.string	"src/main/target"
+.LASF3014:
+	.string	"src/main/fc"
+.LASF3046:
+	.string	"runtime_config.h"
+.LASF3012:
+	.string	"src/main/drivers/rangefinder"
+.LASF3127:
+	.string	"axis.h"
+.LASF3133:
+	.string	"bus.h"
+.LASF3178:
+	.string	"ctype.h"
+.LASF3040:
+	.string	"serial.h"
+.LASF3033:
+	.string	"types.h"
+.LASF3109:
+	.string	"atomic_wide_counter.h"
+.LASF3105:
+	.string	"struct_timespec.h"
+.LASF3035:
+	.string	"stdint-uintn.h"
+.LASF3084:
+	.string	"stubs.h"
+.LASF3177:
+	.string	"stdio_lim.h"
+.LASF3107:
+	.string	"thread-shared-types.h"
+.LASF3180:
+	.string	"__locale_t.h"
+.LASF3142:
+	.string	"flt-eval-method.h"
+.LASF3098:
+	.string	"endianness.h"
+.LASF3158:
+	.string	"imu.h"
+.LASF3062:
+	.string	"opflow.h"
+.LASF3165:
+	.string	"dashboard.h"
+.LASF3093:
+	.string	"clock_t.h"
+.LASF3132:
+	.string	"sensor.h"
+.LASF3022:
+	.string	"src/main/target/SITL"
+.LASF3055:
+	.string	"vtx.h"
+.LASF3017:
+	.string	"src/main/msp"
+.LASF3083:
+	.string	"long-double.h"
+.LASF3005:
+	.string	"src/main/cms"
+.LASF3152:
+	.string	"pwm_mapping.h"
+.LASF3028:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3076:
+	.string	"stdlib.h"
+.LASF3041:
+	.string	"adc.h"
+.LASF3124:
+	.string	"build_config.h"
+.LASF3067:
+	.string	"wind_estimator.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3079:
+	.string	"features-time64.h"
+.LASF3172:
+	.string	"__mbstate_t.h"
+.LASF3078:
+	.string	"features.h"
+.LASF3160:
+	.string	"rpm_filter.h"
+.LASF3050:
+	.string	"rc_modes.h"
+.LASF3150:
+	.string	"io_def_generated.h"
+.LASF3183:
+	.string	"servo_sbus.h"
+.LASF3156:
+	.string	"stats.h"
+.LASF3173:
+	.string	"__fpos64_t.h"
+.LASF3181:
+	.string	"rcdevice.h"
+.LASF3182:
+	.string	"bitarray.h"
+.LASF3151:
+	.string	"stack_check.h"
+.LASF3174:
+	.string	"__FILE.h"
+.LASF3159:
+	.string	"quaternion.h"
+.LASF3147:
+	.string	"maths.h"
+.LASF3082:
+	.string	"cdefs.h"
+.LASF3039:
+	.string	"resource.h"
+.LASF3155:
+	.string	"rx_pwm.h"
+.LASF3153:
+	.string	"mixer.h"
+.LASF3145:
+	.string	"mathcalls-helper-functions.h"
+.LASF3104:
+	.string	"struct_timeval.h"
+.LASF3089:
+	.string	"floatn.h"
+.LASF3047:
+	.string	"cli.h"
+.LASF3169:
+	.string	"stdio.h"
+.LASF3009:
+	.string	"src/main/drivers/barometer"
+.LASF3069:
+	.string	"temperature.h"
+.LASF3121:
+	.string	"common_post.h"
+.LASF3060:
+	.string	"telemetry.h"
+.LASF3170:
+	.string	"stdarg.h"
+.LASF3189:
+	.string	"irlock.h"
+.LASF3143:
+	.string	"fp-logb.h"
+.LASF3116:
+	.string	"wchar.h"
+.LASF3193:
+	.string	"rangefinder.h"
+.LASF3080:
+	.string	"wordsize.h"
+.LASF3125:
+	.string	"display.h"
+.LASF3190:
+	.string	"calibration.h"
+.LASF3042:
+	.string	"config.h"
+.LASF3117:
+	.string	"platform.h"
+	.text
+	.section	.gnu.lto_.profile.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375 \250\365\004"
+	.string	"$\t\234"
+	.string	"\023"
+	.string	"\374\217\230\241\n\004\002"
+	.string	"\002"
+	.string	"\002\001\002\001\004\337\352\261\311\016\004\002\005\352\263\360\321\b\006\327\260\254\202\003"
+	.string	"\007\321\375\256\322\017"
+	.string	"\b\330\204\210\316\017"
+	.string	"\t\354\261\241\353\001"
+	.string	"\n\316\226\320\341\017"
+	.string	"\013\352\244\250\317\002"
+	.string	"\f\342\353\321\202\013"
+	.string	"\r\222\305\364\230\001"
+	.string	"\016\321\221\262\266\002"
+	.string	"\017\266\351\371\272\004"
+	.string	"\020\367\311\225\354\002\002\002"
+	.string	"\002"
+	.string	"\021\332\377\212\341\002"
+	.string	"\022\270\374\226N\023\263\373\315\215\002"
+	.string	"\024\263\373\237\355\004"
+	.string	"\025\255\204\257\311\r"
+	.string	"\003"
+	.ascii	"#M\021\001yl\240\r"
+	.text
+	.section	.gnu.lto_.ipa_sra.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\265\003"
+	.string	"\264\0023\001"
+	.string	"\021"
+	.string	"\001\001"
+	.string	"\004"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\006\007\001\b\t\001\n\013\f\r\016\017"
+	.string	"\020\001\021\022\023\001\024"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"$ \320\0021c\007\210\214"
+	.string	"\224{\221\3106L\202\302\001X\032X\213 u\261\271$\300\200\034v\310\354*\3630\267\016,DJ\243\203\2707\"\331!\224\204c\t\0333K\360\232\0307\330OY\210\001\0267\336"
+	.ascii	"\026\027|\b"
+	.text
+	.section	.gnu.lto_.inline.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\256\003}\n"
+	.string	"B\313(0`k\222\016\225\007\2379~3\036\202w\003\212\345\267E\214\022\026\374\224\017.4\204j\376\202\360\266(\212\242\320m\346\211\r\362\344\273}\215\310\235\002\377/\3046\243\303\221\200\024*\022\341\260\371\343\0025A\246\323\324\251\200\036\270(Ms\217\262@\200e2"
+	.string	"\013\251h4l\200\254W$}\225\307\24696\005\323n\321\334[CX\215{\023g\244c\302\340\311Bf2|F=K\306H\252\264\027\231\271Tq\034\021\312\321\334c?\221\324\237\251\205\275\230J\376@ef\262>&\264Q<`X\376\362\003\021C\250\341)SBc\223\2359P\"B\225\305\003\022\240\3020\003\002!J`\214\3008\241\021(\341\230\251\260\202\212\0137\320\202N\317\371t\201\025l\330\344\324\332gT\360\325Z<,\367\310\256&\260r\336+\315\320\373oddK/\214\020\231\203R\322C\371\351cV\372\251\2250K\006\005\256UR\355\205\237\371\261\352\322/\357"
+	.ascii	"NbIi\255;Bz\343\325\r\326\261]\031\202\277\232\022p*\037\313"
+	.ascii	"\204\023g\337\032\327_\021\2724\b\032\340]\020\311\313\t\236"
+	.ascii	"\032\262\274(2\277Dqx\302Vtz\030\301z\b\212U-d"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`:\004E\013"
+	.string	"R\016*'\220\247\351\377\277\361[GD\304\372\314\314\214\021r\201\3327\377\377\177\374J\341\324\013\t\211\210\210\210\320&I\344N)\005m\313\034l+ug\030\1776\304up\034\207\240\300\004\377\b\262\340?I\024\305\n\376\227\245i\030\306q\004\374\347an\360\217\301\020\324\200\b@\312L\250\317ZN\333Z\303H\322\242\334%\t'\254\314\034EV\340\257H\327\362\355\325\374\267\3514\001\376-\273\253\377\366\201-\230\246iZ\231\231\356\003*\227\375\352L\331W\346\005\332\013\274k\360\273\262\021X#\360\266\257\325\327\334^\325[\273P\215\201n\250\341\3044Z\220Jec\r\340\"\0212\326\001\021@X\310\214\031)\td(HAj\016\357\006\002d\305\r\004\242 o\t\301\347\217\020Q\222\017_4g9\272\341\261\257\020\3720\037\332\341,x \201\250\342\220\235\033\217\335\r\276S\337\026"
+	.ascii	"\305F\005\247\221\265\213\222\212\017\rPY%86A'N\275\224\003\227"
+	.ascii	"\374\361\365X\360^.\n\316\003\203(\210\004\013HI8\351\324b\355"
+	.ascii	"\304G\351\332&\2610\266\210\205X\307\365u\277\372\312\006\262"
+	.ascii	"\212\360\252\310\025\364\247\212|\212\007\301If\3253\370:\fm"
+	.ascii	":R\n\231\027\007\276\346\244z\351\235\250\321\003\237\003\277"
+	.ascii	"\234\233*\305j\243\244"
+	.text
+	.section	.gnu.lto_.pureconst.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375 8\301\001"
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"\021"
+	.ascii	"\230\004\004\230\004\006\230\004\007\230\004\b\230\004\t\230"
+	.ascii	"\004\n\230\004\013\230\004\f\230\004\r\230\004\016\230\004\017"
+	.ascii	"\230\004\020\230\004\021\230\004\022\230\004\023\200\004\024"
+	.ascii	"\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375 \315\255\002"
+	.string	"D\002\301"
+	.string	"\021"
+	.string	"\001\002"
+	.string	""
+	.string	"\001"
+	.string	"\004\001\002\003\001"
+	.string	"\006"
+	.string	"\007\b\t\n\013\f\r\016\017\020"
+	.string	"\021\022\023\024"
+	.string	""
+	.string	""
+	.string	"\027"
+	.string	"P\304`\366\335,\006g`\031\303\220\006\212\200r\2400P\004\224\003\205\201\"\240\016\\"
+	.string	";\320\f\251\265\265\260\330\331\244\330\005\226o"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.lto.a49650cda4f01e5e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_taskHandleSerial.172.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`4\001\265\r"
+	.string	"F\232]B"
+	.string	"\223[8\263Ih@\215\315P\377\342\363\223\353$\237\222\237\034\234\255C\325\364\243\006\006\356{\2545\032 "
+	.string	"\033\356\375\215\227\326\265\264>3@)\201~'\302\r"
+	.string	"H\225m\241\343\272\310h\311\2262\245I"
+	.string	"H"
+	.string	"H"
+	.string	"\267,^\344\272\265\371\200\353\226Gv\216\213/\373\230\030*.x\354\256\246$>z\2459\362\177z\026\232H\257>\\+\00442;\004\230R*\221\225\023\341O\317\016&0\023\203\260\273\316\320\344\341\266n;\202m\t\366Y\002\nr\243\245\224)c rd\261\261\331\303\026I\251#\354W\273\273V\027[\323\231\246U\323\231\351\003\300P5\f\320\330]I\371\330\031K\006\n\333\347\330\035\035\r\236\366a\256b\364\025\032\036\262\353\002\003\265+*pg\023\252\231:UZ\300{\306\225\252z\016?\300L\331\177\361\361\302\007\004\272n\245~,\221c\212*K;\224!\037\372"
+	.string	"\250$\203\214!\376RC\203R\177\327\325B\f\216\224\254\261\317\342->\337\204OP\362\341-\037\345\272\365\336\270n\301\346\340\001\003\017\201\217BW\362\231 2\351<\357\204\013`\316\363\201\276M4\302\221h\034\211f\362\331J4\316\3734O\001\2070t\236&\n\205<\215#\356efJ\nV\300`B\362\342\310\266\331-=\314\324\346\272\237\236@\304\006%\371\357\\\001\030"
+	.ascii	"\325s\241L\2130|\261a\243W(\\\006\261m\254\326\226\033V\244j"
+	.ascii	"/\254\006\207\223o\b\316\016RHJ\004(\bE\210\352!\312\312\235"
+	.ascii	"\3442\366\267\032-\356\362TMN\321\324\036"
+	.text
+	.section	.gnu.lto_taskUpdateBattery.173.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\251\002]\025"
+	.string	"\266\347\214J\340\360\2501\362k\316XU\031\247\317\022\f\307\306\340G7Q\334\251\020\327^\201\377\227P\304\\vSr\035\260\201\365@i\351|!\200\221\335\215"
+	.string	"G-\323\216\320\034\267\217+\034\275\003<A\215\377\222F\356\030v\357-eJ\001s"
+	.string	"r"
+	.string	"x"
+	.string	"%2N\354t\366+S\363q\333)\001\357M\023\\\264\004\227\370N^\355\363\274\207v\237\331\001\334\233\003\364\2737U\340\022\217\213N/2^\364x\200\361\242i6\215\247:\367\273\244\033/x\357-\355\211\323\036\332J\363\257\373\007.\007\363\360\3466D"
+	.ascii	"\034j\002\311\305\204\"4(p\327\275\316\344l\265\242P\356\275"
+	.ascii	"\256\270\234\315-\3366\004\3333vu\021\266jM\330\017\357\275\327"
+	.ascii	"6\307FU\253\306\352\324XM>\275Qc\365x\237_\024\253kX}\220\n8"
+	.ascii	"\301%\002E\367\322<\351\270F\"Q\212\247\267\265\332\367w\017"
+	.ascii	"\262I\277\234\205\337\342@\252\025M\244\257w\343\353\3358\316"
+	.ascii	"\343\274\237\031\212\315\303"
+	.string	"\r\205F\374x\202\007>\234\274\236\367\362\237\331Hzm\3163\343\366\013^\364\353\273\027\233\274\370\353L\006\327\301\001\374Y\273\214\325\252\354\222b*\016\223\325nq\325\343\2525\301\261Y\030\327^\321\021\312>=\211\312\242\354y\277\356\344N\317\317\t\230\262*;\302D\332\321\246\354eT\330,i/\332\321\016`\272\355x\320\305\247\022@\377P\202AC\302\306\355}\242=\357$\265\013\375\305\314\337q\007\264\036w\321G\307\213\267\f\220B\324\352\223Q1\216BzR\247\032\267\346\260\323*\267\206\325\351j\311\312\027\352r\241&\353\031N\263\305\001v\246\310b\254\t\247\371j\245\260\274Z0T\326z\241\024d\254\007\006\3142O\023V\003\007\013V!\261\013\247\253eA\366:a0\027Ses\025k\211\261d\030\314\225\322\\)_-\226\2534a\261r%\300\350\206\023V\312P\024V\222i\355\341\2659\216"
+	.ascii	"\302\250fm\026-Q\001$\021!C5!HEY\373d\251\307\231$\306\3028\325"
+	.ascii	"[:\n2 p\002!\302\233\007\3139\300nq5\355\036c/Z\346J\231\254"
+	.ascii	"%\034\204G\300\254\351\240\357uc\367U\267\275\320d\237\236-,"
+	.ascii	"M\307\320\220\005\357\344)\206\262=H\035\310\037\356|\024\360"
+	.ascii	"\270\237%\305\030M\305\343C\202\3061\007\004\33182\246\013\355"
+	.ascii	"\225\331\2068\306F\252\213\263\347\2041F\306\251m#x;`\366D\241"
+	.ascii	"P\"B\213\227'MN\321\362\036"
+	.text
+	.section	.gnu.lto_taskUpdateTemperature.174.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\r\b"
+	.string	"b\31788@s\322\001@$B:.\2273\312\020\216\353\363\264\371\311\267cy\025\030\213\b\3201\237\254\017\255 \207\330\020\376\026\206b\362\bs\315\232m\022\205_\373=\232\264\275S\n\316\246\266\2209<0`\005\334\204F\032It%\215\322\213)\340\211q\025\\\326QL\221\234\"Y\032e$9)'\261\003o\026\032\225\335\266Q\031\252\373\223\325F4\271\003m\214\f\370\223\021L\3613(\004\272\200\314,\274\261\353\007\243\210\375\316\356\256c\312\216 \023\231\253f\327#\007gWVL\211\355\207\354\013\245\341\320\276\312W\274\263h|`7\365\002\263[\025|}n\271\336\300s\353s\002\317-{6\315+\311^\325\301\241\262\331]\031G\356\035z\376[\036pB}\207"
+	.string	"\020\273kxB}\334\361\266\023lG\330N\t\n"
+	.ascii	"\325s\241L\2130LD\330N\023m\345z\272\214\367\255\246\200\273"
+	.ascii	"\274h'\031"
+	.text
+	.section	.gnu.lto_taskProcessGPS.175.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`u\001\235\r"
+	.string	"F\030YD"
+	.string	"\2216\035\360\231\250YSE\031\322?\277\246\267\352;e\341\335\244_\203b)\214\236\332\342`\360\375\3733V\240\021\027\005l\250K\001\265\007X\377O\372\017\364\001\356avw\215V\004^\373\323\222&eJ\001E"
+	.string	"B"
+	.string	"E"
+	.ascii	"{\031\020+28v\027\323\021\017\335\212\025\245\031\362\037\363"
+	.ascii	"\353\003E\267><\256l\310\312\303\251\016HJ\245\f\324\320\330"
+	.ascii	"\204\200\032(\021\026\022\337c\236\034\300Q\246\305`w\235\037"
+	.ascii	"\330\341\346\3346\006\333\r\354\213\bV\027\373\245\377\312\264"
+	.ascii	"f:3}\020\017\233\027\005b\354\262\354\320\261\247\212E\t\333"
+	.ascii	"\357\330#!\022<\355\2378\212\320K\027\016`\327\2454\263\033\036"
+	.ascii	"\360\b\347\225\303\213\304W\234\007\210\257\034\262g<\204\t!"
+	.ascii	"&\027%'\032&(}Q\361\324\356J\233\233\220\377R\027\264\214T\344"
+	.ascii	"\017S\213\303\334\324\314\250-\304k\204\0252Hy\343\230\337\253"
+	.ascii	"D\233B\205\374w%i!\251\310i\242\201\261\231\303\016E\251/\366"
+	.ascii	"\251\335\335\316\264\215$+Q\200\300#\300{\260\241|\034\200R\266"
+	.ascii	"\256S\321@\254y\274\023/\003A\320L0\315\004K\371d(\230\326y\230"
+	.ascii	"g\2009\t[\207\2018\256\303:\341\376\306)\203\216,\315F\324\024"
+	.ascii	"\2677\255Q}\344\245\366\347$\377\231@  \300\002\221\271\253\003"
+	.ascii	"\325\262PX|\303 2\254\205A\331L#\244\tm/\223d\343C\241\021:c"
+	.ascii	"\321\204\223\274\300\313\247\t\003W\214C\323\rV\325o\\\252#\224"
+	.ascii	"2\307\376>\243C\217\2344Y\322N\0267\343^1\252\016\001\005"
+	.text
+	.section	.gnu.lto_taskUpdateCompass.176.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\r\013"
+	.string	"f\224MD\020mj:\320F%P\b\022\254\352\342\013\314\216\237\201#\210\303\364<\"]6\350\356\245\326g\257\357\310\205\265w\202'C\022\022\220\f\356\307\002\n\2009\251\201\360\034H\024P"
+	.string	"\317\020\263H\320\250\221-S\n8"
+	.string	"9"
+	.string	"9"
+	.string	"{U\252\201\312\304\356n\363\302\305cSE\377\251[FRt,\302'\326\341\372P\342\202$a\230\022\206\361\251\253\003r\244J!\331]\353H>\270\263\333.\261mb_\003\177\246\352S.\023Bxt\330-\245@\261\255\fD\006\333\277\330\031\006!W\373\032\276A<J\3011vM\036X\273\345\2073\225g.\217\321\236U\236\241=\263h\223xy\n\331\264?\003\372\321\034\025+\t?\275\\\254\351\004\332\347"
+	.string	"\016#H\372\262\246\225\2074\373"
+	.string	"\002\375\370\271\251@\232\"\353\n\202\210\325\023v)\322i\301>\266\273\353i\262\217\n\346:o\303\211\214\200h4\302"
+	.string	"\236\247\003"
+	.string	"\364\361@0\324Y\270\323\204\004B\016$\240\343l\035g\373t8\317\326\201\341\246\331\360W\300\0037\320\367\201\333\245\334c;M>\241\320Z0G\230E\003\017"
+	.ascii	"\325s\341\214i\004\262!\240-\023\357\265T\177\260\006\320\362"
+	.ascii	"jwa\260\245.C\177\253\321\342.O\325\344\024M\355\001"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.177.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"-\f"
+	.string	"6\227UB\020S\233\0160\246\241\200\021\215%V!\363@\226pf\332#\205\002\247k\007 \210mC\230\215\236\360\2776\377[\240T{\333Q\024\241\003\024\204\036\340\277\203\251K\216\302i[tH^\332\222\275\367N)@"
+	.string	"C"
+	.string	"@"
+	.ascii	"\324\003L\257\376\354\035\027Q\354GJDF"
+	.string	"x\354\3565O\374;\235\362\363-!xJ\211\370\244\005H#zTa\b\275\3240\021\371x\351!\024IY\331\354\256\345(\fq\327\333n`[\202}+)?\326\244\322Ha\373\366a|\025\346Dc\177\364\305\273\370\376B\003\005\202\240H:\3308\331\025\017\274\372\001\365z\241\230\034\232\313\267\360W\234\305\367\322\206\003\330%\225f\354\212\031\033\240^-~\300\364\032\037\231N\360(%RbLg\230>)\214:D\022\305\025I\357M6($?\372T@B4A\177\274\205D\005\216\225>l\021\224\323\204}\272\273\353I\262_\372\353\224~\245*\271\221\221\261\373!\332\326\271P\001\323\034\204\264\2552\226i\b\260\005\f\022X\002\274\b\232\247\003\341\263i]\007\312@\234Y\236\005\017\373L\3108W\306\271\266\016\346\271\262\316\273,\002\3460h\335\365\341\270\356\252\304\375\206\303\f\241\026Y\247\355\341d\021"
+	.ascii	"\325s\241L\2130,0a\257\006\002\303^B\265\n\002\203\ba2\204\""
+	.ascii	".\263\313\022\004\\Q\251\262\210k\271)\361h\fj\017"
+	.text
+	.section	.gnu.lto_taskUpdatePitot.178.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\335\n"
+	.string	"f\324LD\020\2538\035\370o\325\311\252\b\336\372\276\"\227\022@_\276\t\2400\336\325\177\006\016\347_\322\035\020\022\336\335\215a\311#\217\316\220)\027"
+	.string	"\017\240"
+	.string	"\264\216,{\360\232`\020\030\fT!50\342S#{\247\0249"
+	.string	"8"
+	.string	"8"
+	.string	"/\027\354U-\223\252\265\273\225*xx\214\316\320\317\214\3421L\201S\354\002e@\203f$a\033\n,\323\311\317"
+	.string	"ci\316Kgw=O#\201;\273\355\020\333\"\266;\004\376%b@\205\272\332\025\360\342\260\254l\002\003\333\267_\206\266\306\306Xy|\236\364\033\334A\370T\313%vQ\244\204\335R\303\031\230g._\241=\303|B{\346\320\306\020?\031\243\342]\b^\020\250Y\264S\223\007\027J\323emn>\322l\225\225\371\323i\307\201\022\025}\362\231\b\031,\354\334`\227\342\244\t\354c\273\273\246(\373\251?\2333\336\270nc\373"
+	.string	"\341\340P\200$\035\3503\"\nu\3377\342 \314q\300\023p\023\225p\236\312yj\350\263\201*\367\201\225ca\017\245\373\252\310\363\276\252)\367\035"
+	.string	"\224\204=\314\214\332^\312\f\016"
+	.ascii	"\325s\241L\2130,0a\257\006\002\303^B\265\n\002\203\ba2\204B\272"
+	.ascii	"L\024w\256\251\246i`\n\n"
+	.text
+	.section	.gnu.lto_taskUpdateOpticalFlow.179.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\225"
+	.string	"\355\n"
+	.string	"vTMD"
+	.string	"\3518\035\007"
+	.string	"\006\nF\243\t\302\335\223\374@\033<7\345\224n\267k&\215\35158m\n\303##\350\205\301\254\334\353\370\301\004e\003\360\f\340\373\343a\342\270P\002~e_\317\345\320\330[7\262wJ\0019"
+	.string	"9"
+	.string	"8"
+	.string	"?m\366\002\b\260\002<\330\335\256\326\234\274V)\351\203\314\362\332\347\345U\223p\305@\b\231*m\"A\214u\330)\213\271\242\3243\332]\323\226\351ro\267\355a\373\303\366\204\276\207\001GA\007\203\335\226\231\204\215m\bnl\337\376I\332!\233\"G\343\3640_\347;\344_*o\330u\0258\260{Z\270\342\363\315\347!\270o\237;p\337L\332\016\002-k\265\274lf6\240:\205{\035\001\320`Ee\346\250\317\2478\373\004\205\276\365\232!\263\252\245\017;\310"
+	.string	"\314\202\245\021\354\263\244\225\306\276\266\273\353\352\262\377\3727J\003\366>\360\302\333\340\300\020=\214!\240\251\004\202:\201\242\230\372\026\374\211F\222\321C\211|\244\356#u\247\222g\352>q\354D\021\016K@\261C\205\241\330\205\316\375h\245\2524\005\272U;4\241\017\016"
+	.ascii	"\325s\241L\2130<0a\257\006\n\303^B\265\n\002\205\b\3612\204B"
+	.ascii	"\272L\024w\256\251\246i`\n\n"
+	.text
+	.section	.gnu.lto_taskTelemetry.180.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\267"
+	.string	"\225\013"
+	.string	"\266VRA\020Q\234\016\340\270\332v\305J\201c\001H\365\003\344*\327\256\021\360\2547\022\241@\253\322\255\276\241FO\315 0\331Bn-!\201\262\242\200\320!?\256\250\267I\341HP%\200:\020\221\275\267L)?"
+	.string	"="
+	.string	">"
+	.string	"\356l\032\017I\373T\215\020.n\354\256\025Q\274\273\214\332\371?\275\343\003\275K\n\211G\271 \004\206\210"
+	.string	"0$/\"\025\337OW\021 Hu2aw\255\0378\342\236\267M\301v\005\373\007\002\273\216#\373\246_\252\372\023\013\211\f\t\251]Q\t\311~\314\030+l\337~\330\331\025;\201\211\007\327\237|\026/u7\201\370\200\335Q\311c7d`\005\224O\207\277T\237\224\023\250>\0032z?i$\304#Z\253\0365\240@B:b\277\305Q\232\237\302\0348\375\367\351s\325\347#"
+	.string	"\220\022\037-\261Ed\252\355\341\203\3763\002P\364\254/l\314X\305a\207\236\306\023\366\345n\276\260\254\301\005!\202\003L\001\016C\306\321\\\360t\262m\353\200\0050\206\3416\334\345\311\200e,,cu4\027\307\3026\316\302\030\260\266!\333,\217\246mV%\334\313\215#[\310\361\361\211 YQ\031\355\rG\3779\016"
+	.ascii	"\325s\341\214i\021j#\253-?\354%T/\330\372bo\005f\025u\nL\272"
+	.ascii	"L\024w.f;40\005\005"
+	.text
+	.section	.gnu.lto_taskSyncServoDriver.181.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"\305\007"
+	.string	"\002\21777@s\322\001"
+	.string	"c\346\370\301\262\367R#\3405\032\003x\330\224\343\337\205K\340o\240\230O\326\207V\220Cl\b\177\213\204u\363(s=\310<\351\347\231\325\277w\333;\245\276&\266p9<0X\005\032\0056\022Ml$\214R\214)\340ii\026\332\265U\314\220\234!I\022]#9\251&-\003g\027\030\225[\226Q\371\251{\316\302\316\021\225Z\311h\300\r\203@\352\212f_\215]K\017\216\330\347\354\356\032v\366;*\245\232\211x\331\365\270\261Y\230\350bb\373\037\033\241\243\341\317\376\311Q\270\247d|`\267kI\355V\005'x\036]\017\352<zN\320y4g\307\274\226\354YB8VT\273+!\311\271?\316\277\312\003L\247\322\037"
+	.string	"\304\356\372\231N\0377\274\355\003\333\022\266E\002\b"
+	.ascii	"\325s\241\214\351\3233\fg\233]\306\373VS\300]^\264\223\f"
+	.text
+	.section	.gnu.lto_taskBlackbox.182.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\025\013"
+	.string	"\246\025OA\020O5\035\200\342`]\355 \035\200\231\271\355\217\031\301F \237\223;@\324\254\333\251)\020C\355\377\320\bv\037\264TJ\006AB\276\fB{:D\267\021@\324\35759k\371\251[I\333[\246\024="
+	.string	":"
+	.string	"9"
+	.string	".>\212\366)Fd@!cw5\371\341\340\247T\320\177\351\033\241\310\371\3148\\N\002\252\0251<\304\317\224\200B\204/]5\210\036U\215\005\273k\r\305\r\367u\333\fl7\260\217\005\244_\252\372\030\310\212\205\003\025\273\240\326\214E]'\021\266o\177\004\355\210-\340\005\202\353K\376\350$\300\2230\374c742\355\216\005< \373\345\361\022\354W\366\020\354\227A;\237>\364\224\234_\264R\231\2445\330\345\204\023\251\217\256\354\227\270\t\215\017\302\0276\372\360\227\277\301~]r\244:t\264e=\301h\261\312\262G\216J\017\366\347\356\256e\310~\336\270\316\300\226@\301\201\t\200/Bg\251@\310\\:\317\323p\035\346&\037\205o\313H\340(\032G\321.\225\315\242q\336\247M\002\030S\241\363\264\f\006\343i\221q?W\206\374\200\205\352H\317\314TJ\333B\r"
+	.ascii	"\325s\341\214i\006j#\253-4\354%T/\330Jb\257\261a\001\351\202"
+	.ascii	"G\\\3131\205\2441\250="
+	.text
+	.section	.gnu.lto_fcTasksInit.183.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`T\004\365\025"
+	.string	"6\346\201E\360\260j8\362\007\261\274\034\035[\256\337\234\324\365\2335\b*\024\037n\363\230\007\234\362wR\346\3362rp\270\224\317= \304S\026\351E\235>\223\3056\317\211))\237\242*W\226]Y\226eIw\333)\311\024m"
+	.string	"]"
+	.string	"r"
+	.string	"#\273\242\273\342\335\360\356\355:\3354\220:\277`\215\221\030\343\b\023\244c\374\t\275 \3216M\265\2653\262g3&\217\217\313Np\034G\331C\244-C\341mkfN\222t\273[\206F2\031\246v-!\3108\216\246]\316\017_0#t\251\035.\034\360sa#s\322/\273\234-:0\216c\255\333i\310\212\331vA[\001m\310\023%3\024(\373\2314\261=Ai\371\255y\277\200\313\016\026\007\225\344\266F\301\251\313\247\f\257u\302'\272\255`\301\251+\b\356\267\276>\334\340"
+	.string	"\216\316\321\366n~M\233\341x\232\326\356\207\335\330]\230\335W\272.\273\255\273\036vYwWvUwSvQwOvMwKvIw\003\250\223NG\201\234\236\273\033\323G\245\233\302\322m0\017\244\213F'\215HF:|\242\213\342E.\347(\036\303\314\215\223&\316\304\204Z?\337\307\303\244\211&^\313ob\3505y\021*X\370\204\257\331\3110\346\026A\002\247.|\336\340\341~s\332"
+	.ascii	"\375z\336\013\342\177\337\n\0319"
+	.string	"\003%\003\261m\340\300\251{\356\367\244\211 \306 p\345\220L\235l\003\235\211\250\240\250\224\254<\230\231\310f&2\t'%\021d\263\024\025\231\b\200\326&@H\221\255\324j)2So\314\323\324'\220\0012\320pi\021\206\344\307_\024\004\375\260\034\327\225cO`\302\036\033a9\240\327Y\256\277\\O\016<\234No\225\242G\005\243u\224\307[#\036O\034\036.'\025\273\361\261~Z\235\325\036\311\352\271\301D\317\204\363\023\004\252^J]5\246\236\035J\304\004\201\001`\250aH&b@A\nSPR\311r\360\002\021!\"\017\020Hd$b\n*\017\342 /Ji\305W7X\315\032&\316\375\361\2267\262f\317T\377\235\020\220\030h\362\270]\035D\212\267\013\r\211\004\004\373\203{d\341\237\\\216\024\037b\"I\306c\0309\314KBO@\270pq\377\037\301\207\212\200\257c\276\300\227\247F\320"
+	.ascii	"&\026#+M\020[\347+\3272\2066\fJ\312/\023C\r\301h\206\322\242"
+	.ascii	"A\223\330\226\250\fY\b\013\272\305\370B\235\340\230W\213\303"
+	.ascii	"\367\333\253\301\377)[9\341\370\013G9?m\035\252\3476F\377\007"
+	.ascii	"^\325\253\354\275\254\006"
+	.text
+	.section	.gnu.lto_cfTasks.184.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\350\004\365\033"
+	.string	"\226\356\262H\200^U\007\331I\373\340\300r\rK\301\3412\303\020\203P\253DL\037\321\032\0226JK\024/H\037YJ#\335\026\272y\222\354\032\330\353>\372t\344\375\353_K\362zW\0245\2223\203\267v\300\367\331&\223\177\247$\003\240"
+	.string	"\242"
+	.string	"\236"
+	.ascii	"\002"
+	.string	"\224@\237\n:\225\366-UCi1\217\006\364\275\021\355,5eI \312\034\360\024t(\355RQ\276\324\b\365C\337\t\033\266\220Q\351\203\203\t\201*\332\257X1J\215U\0218l!\343\027d\001'@\177\022t(\332\245D1J\215b:\240oz\264\263\324\323\3221\351\272\302\023\306\0226\340\007N\317\256\004\350\311\2403io\n!b\201\233$\224\340\031\373\222\021\251\361\315\322u_\022\350\373\303\30036\261?\2011\013\005\031.\327\025z\013\317\260+\307S\247\347\227+8=c#\030\347\237C,\217\221dg*\254l\365'\364\243x\341Vb\0167\023\372\372\211\335\2643U\026\362Tri\317\203g\310\034v\225\230\355\\\005\005\246\334\322^g\3513\211NH]\333\271\312i)'\350s\264\323\311RM\242riC\337\243\333\316USH\363\215\352i\243\375\215\033#\223\b\006Y\004\264cLX"
+	.string	"\256\264\257Q\2233\211]\310\025}\207.\354X\023W"
+	.ascii	"+\240\223\tz\031\355g\314\f\245\3056\030v[\250\350\306u,\271"
+	.ascii	"\217\227\240\177\321\036\006\f/-j!3\240\257\205\336\026*j-\361"
+	.ascii	"\223R>\305\251\270\223c\361,\256\305\271x\027\027\343c\034\215"
+	.ascii	"\247q6\216\345p<\216kAp;~\307\273\336\375\024\257\342Y|\213\217"
+	.ascii	"\3612\376\306\017?\307\203\347\341`\373\370(7I(\341\225^\207"
+	.ascii	"\376\343\016\2369\214"
+	.string	"\"\344\307\316TR\236\370E\3758\3368\302\034:y\017 ;f\344\352\230T\360J3\364\323\330A\336F\b\021?5\266\020s\270\205\034\202\276\316\203\001\221]$\243\331\332Gv\f\311\230c\322\264z\027\372a\374\013\2369\204Z:\021\311\216\035Y:&_\377\352O\372\025>38\247\266\273\336\016\206)\334t\262\225\355\331zp\020kb\334\354\306\252;\030\356\261j\333\316h(VY^;cU]Nm}\360Ng{\341\335n\246\313\2555\024\257\354\214\226q\273\2667\335\211{l\253\346T\234\332\002\300\273\\\355\2053\254\270\n\272\025\206i7\336\013\343\330\266\026\324b@q\355f[q'\006\262P\201\310v\342\240\225\006T\233\341h=\370\327@w\320>\020D\277\"\331\257H\346\301\310w$\373!iY\003\004\030\370a\003\222\f\004\020\210$\013\200\235\2117\ti\2501H\205 \266L1\373\031"
+	.ascii	"#\021\241\333\006\020@\305\2106\017\bd\255a\035\366sw\303f\367"
+	.ascii	"\261E\304\220\277)-\222\007\376\b\261\312uu\0170/j\232\024\266"
+	.ascii	"\032\303,\216\023\001\023\254\240p\017\3040\310\202\034\234@"
+	.ascii	"4\263,\nYs\326m6aH\037\361\364\0258\003\221,\336\033<\310@++"
+	.ascii	"\277\013\326W@\347\024 \205\036\354\013\306\345\260\316\266t"
+	.ascii	"k\251\327\303\354\321\345\036r9Q0\021\240\b\224\315(\003\314"
+	.ascii	"\023\244\345\253\326:n_\233\245\032Q\354J/;[\2165\203\302\003"
+	.ascii	"`#\363$\222_\355\307\023*U+/U\314'"
+	.text
+	.section	.gnu.lto_taskUpdateBaro.part.0.224.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\220\001}\017"
+	.string	"\366\234gF"
+	.string	"\257(\035\243c\205\"P>\227\200\034'\021Q7\216\370\002\325\312,\366y\202\351U\336~[f\326Zf\261\216\332\354_\205\207M@\242@t@\304\235\306\367\353K\254m\351Fc\313\263\274\202X\244\221M\244L)P"
+	.string	"S"
+	.string	"Q"
+	.string	"\035\333%w\216\355\322\376\b\333\247\226E\273\305\307\226y\330\211\023\330\2139\247w\271 .^j\253\233\350\243.3\\)\327\224\345\352\360\325\020\314h\\h\270VZ\007J\b\326e\256\033\\*\325\215o\034\2209\2479\0177\347\266ClO\260\217\"\"\036\273\375\330\311\227q\347\323cL\356\254\306\351j=&v\227\036\263\017\3730\237\304a\304\307\2308T\213\223\231\244\230\3159&\270t\004\356\262\243\371\364WI\201qrhy\254\370P\375\350\273\374E\374\253\344\003\346\\y\231\231sTp\351\003\334\245\307\007\253\373\223\030)\275q"
+	.string	"\031\315\376-5\263\231]\026\337\264}+\300\260Xi\215U\366\372>\366NJm\314Q\233D\242g}\237\242\242Z\224/\363\f\231\213\212\2516\272,\336M\233\273b\177\374WS\353c\367\001l<\3700'\312\r\214\251\"K\004a\350\203\301\302\027B\320\020\206:\177`\270\340k\340\200\201\207"
+	.string	")$\004}$\224B\341hD\002\n0\350!\215\220\276\022\005P\304\003E\274\320\347\003y\340\210\344y\fX\224!\034y%\221h\344u\007I\255Jj\350\256\035^X-\312*3\241u\252\313\361\221\315\006\211\364,wL\002! p\202\251J\356\325Z(\223\r\230\2432B\354@\320M\037o\323\332"
+	.ascii	"\276\360;\264\\\377\224xC]\265\242\021\276W\024v\343\231\310"
+	.ascii	">]~\241=C\216\033\366m\267\3301\246\312s\332mLY2 l\357n\024\241"
+	.ascii	"i\032\367\256>\006"
+	.text
+	.section	.gnu.lto_taskUpdatePitot.part.0.225.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"\005\n"
+	.string	"\366\222C90\221\322\001\217\250\031\016Dr\020\370\260A6\034H\327v|p1\005jC\r\333b\030\r\310\337\372\006I\"\006\226\342\024\3030b\231\300\364a_\335\252\366!\262\233\354\235R/"
+	.string	"1"
+	.string	"4"
+	.string	"\366Ul\243V\026m\231\217({X\314\003\026\333\335z:O.~\312L\364S\237\235\220\221\313\201g"
+	.string	"\240\335\265Fr\323\333f\260-a\377\023\266o\377\205\2627\377%\332\233Qw\235>\343\212\254\022\\\036\244\374\350\257\234E\274\353t\201]\226\353ew\\8\265\202v\352\361\005\234S\355\036\316is\266lk\362\323\306\b;f\312\233\r\225\266\306\206\374\207\017T3\345\277\336i\251\211Y9#g\3133\313v\262\354\217\377\251\007\241d\027\344\206fM(LJ\356\274\257\241\203\210p\340\bB\212o$\2320\221>\020\314\360\002\354q\241E\330\231*\274P\365B\225$\352F\325\003\303\312\031\270t\361\201\325T*\201u\263-?Y\006qLU\023"
+	.ascii	"\331sC\2343\360\253\t\201T\316+\365l\003\274\007P\270\032Kj["
+	.ascii	"\226\260\004O=\347\323\202\315\344\235f\201k\017\270\321\"\372"
+	.ascii	"]e\f"
+	.text
+	.section	.gnu.lto_taskUpdateOpticalFlow.part.0.226.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\241"
+	.string	"\365\t"
+	.string	"\026\022B90\221\322\001\200@\247AOp\020\246i\211\304\243\343\230}kXhY\243\023}l\213a4\200\266\365\rrG\f,\305)\206Q\214\337'\257dVi|`g\265\233\354\235R/"
+	.string	"1"
+	.string	"1"
+	.string	"-\266[/\203v\316C\224}\214\314\007\214\316\356\322Oyr\3602j\240\357\272\004\211\220<\022\\\003(\355\256\267\222{\336\266\203\355\t\373\t\001\237\265\354\220?\003\355\220[\227\261\016\302\035y-\260\220b|\350\273\374\005\274\214\365\201]\330L\315n\330\360i\206\355\323\341\r>\237\333E\237O\373\001\035R\306\354O`e\306K[c#\036\304\n\036\322\345\317\016\242Q\301\331\270\023e\314R\323V\302\354\207\377\247\210t\263\033\322\303\263&\323&\305\366\355\346j\367\300EH@\214\n\276\212\016u\242X\245:\317\313\250\001\256\243\357\342\343V\026\325D\253\211\246N\034\212V\357\243#\004\2530:\217\256T*\217\206.a.q\310\025"
+	.ascii	"\325\263`z6\340\234\201_M\004\242 \263\235\333\376\3310x\017"
+	.ascii	"\240p5\226\324\266,a\t\236z\316\247\005\233\311;\315\002\327"
+	.ascii	"\036p\243E\364\273\312\030"
+	.text
+	.section	.gnu.lto_taskTelemetry.part.0.227.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"5\f"
+	.string	"\306VSB"
+	.string	"s\233\016<3\211l\013d \250\205)\017\200t\304\024 \247\323(\300\372\363L\303\305j\214\034\232\2358\274\315\201V>"
+	.string	"!\260j\243S\200\016\375;\023\204\032\022\364\266}\345\331I\372\264\211\224)\005@"
+	.string	";"
+	.string	"A"
+	.string	"\240\311^F\216\0211x\354\256\365\250*\336}\322\214\235\377\360"
+	.string	"\274/\344Sz\237\211\353\344\200e\206\016\002\037i\322\214\260\360\036>I|\"\231\006\036/\027v\327\325\211\233\272\355\f\2661\330\257\020\266o?\034\331\030?\354l\214GG\021%"
+	.string	"\267\004\t\203\024\0222\017\372'\177\321\035E\364\002\273\245\023\225]\360\301\243\033T\217\006\257\241\036\253g\250G\373.l\217H\334\3318\036\002Rz\330\330\364a\375MZXTTKl\207\240\256_\001\343\006)[|\311j\317Qv\bD\336\273\"H\331\261B\322\220\324\022k\234VK\366\301?5\375K\306B\215\335\221 ?\026E\244\321\"\276\260\f\3025\201B\204\315\001\216C\346\351l"
+	.string	"}\262m\013a\003\214m8\017\334\005\352\200q,\214c}:\227\307\3026\316\332(\260\366!\333,\220\246m\026\346\323j\311\032\200\254\210P\021\353\024 Sm\217\226\367\274 \025"
+	.ascii	"\325\263\260\3706\204\226\r\257\226\3510l\322\373\201062\330"
+	.ascii	"\007\210\202a\256kN\232\351%X\301\263\316\371\f`3y\247\331\340"
+	.ascii	"\332\213)\016M\215{W\031\003"
+	.text
+	.section	.gnu.lto_taskBlackbox.part.0.228.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"=\f"
+	.string	"\326\226SC\020q\233\016\300A\320\002X"
+	.string	"W"
+	.string	"\2169Tv\264\300`\002\354\212\3678\003\370:\202\305\304\213\036Q[\235\301\227\024\265\353\217R\272:/\205@\244\364i\227y[\t\312]\243\266}\033\207\375\336D\312\224\002@"
+	.string	">"
+	.string	"@"
+	.string	"\367P\3660T\200x\221cw\343\241\232\370\366I\023n\376\277{p\335\310\247\344\272\021\327\211AK\214\033\003\272\321\304)A\301\375{\206\350H2\013\034b(\354\2563$n\352\266-\330\256`\177B\245\024\266o\377\023\331\032\377\333l\215EW\021A\340\255\b\023\0055 d\336\363Y\274\305v\025\221\023\330%\245\254\354z\r\016\275 sh\357\034\3520s\003\324\241\375\025\266E&\336l\032\001\356\004(\341\220\261\371b\375Q\\ZVTOl{\240\256?\341b\306(]\214\311\316\3565\312\016\351\220\347\256\007J6XF:\222zb\205\323*\311\276\367\247\246\217\331\304\224\335\222\035:\266\004\f\256\254\313A\025A\302\003\317F\313p\201>0\204@\256,\013\261\004\330\362h\033\264*\244\301\372D\353\023A>*P\2642-z\022\030\343pe1\204aY\324|Z%\371\302\013\313\007%\261N"
+	.string	"2\325\006ay.\025"
+	.ascii	"\325\263\320\3706\206\226\r\257\226\3530l\322\373\2030\3062\330"
+	.ascii	"\007\210\202a\256kN\232\351%X\301\263\316\371\f`3y\247\331\340"
+	.ascii	"\332\213)\016M\215{W\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\212\007U\023"
+	.string	"&^mI\320\2628\035\b\350\241\016\003\361\177www\355\233{\323=G\244\032Sg&\205\217\242\031D{p\016\2612;\310\325\f\376\305\025^p\205\257T\265\013\242(\212J\220\247^\001\362\303\367\362Q4C$\315\272\364\354x\331\322\016W"
+	.string	"W"
+	.string	"["
+	.string	"\001\356T\344\326\220\272\177"
+	.ascii	"\270o\306\333\007\352\316p\272{l\246\033\003\253\234\315 \340"
+	.ascii	"\224\356\037\361\276\020\336\0266\322]a\333Zm\352\214<\002\274"
+	.ascii	")le\255\254\225\f\n\335!\374\371\003\003\3178!\265\326mV\313"
+	.ascii	"\251\365\265\372\320\034*\313\262\024\335\023\266Z\253\350A+"
+	.ascii	"dn\0251w\n\230\033\305\313\335\343r\223h\271Q\226\273\304\312"
+	.ascii	"m\"v\237P\271yRn\035\330\275\203r\347\234\334 h\257[\204\311"
+	.ascii	"\315\303u\357h\335:J\356\034$7\016\326}\203\274m\254\356\032"
+	.ascii	"&p\323p\335\031`\017!#w\207\215\226\243\2727\b\2709\004\337\247"
+	.ascii	"\342-g\306\274\025/E\364\022mg\322-\207\276\272\345L\313~\200"
+	.ascii	"\334\234t\353\023\245[\033X\267\016\\\334\202fIh\277Vh\273\223"
+	.ascii	"\254\313\245\254\272Fm\t@Aj$u\027\3340\024\3343\022\3341\020"
+	.ascii	"\3342\016\334/\f\334\265\002\267\213\232"
+	.string	"\273\205\354\366\241\271Y\314\334\001\265\001I\236\253tu\246#\252T6\256\352LE\316T\232B\241N'Q\f_\343\206`\n\236\351wvhk\334\316\204\215\313\241\334\314\270Fc#\315\27065\343zf:\231dLk\036\261\024SZ\027L\\\2330\")\f]H/$p4b\001\327f\013\270\236\331@\021\202z\274|\250!(\214\330v\255\264\0350\003\2311i\f\021@\b\n!\013E#\224H*\240\017@\035~\023X\f\327\315\303\224\255\3713Oi\302\340\334\344%\321/\256@\313\2676\2765'A\345\203\200af\363\350\020\b\217\241bD+\022\020\232) \253\225\304\236\020\243\245;b2\304\321\303\321\021m\330\260c\221V\034\\.\177pr\231\001\032 M\367~\377\346\177\336\355\337\274\337\273\371\337\225\310\334\275\353\370qd\263\3748\212M\254\037\354}CW\220u)\314\317'\340}\255\"\305"
+	.ascii	"\032E\333\262\365\363Ndl\037\301\377n\t\306\020\320\364\326\261"
+	.ascii	"\001\265\n"
+	.text
+	.section	.gnu.lto_.refs.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375 Q\005\002"
+	.string	"\022\005\017\025P\2135\006033\323&I\022\211\304z\341\017a\233\310$S\252\021\0376\\X\231p:\371\030m\\l\366\301\202\003\257\001\213\233\3124f2\3271\357h\026\271E\353\231\236\232\b"
+	.text
+	.section	.gnu.lto_.decls.a49650cda4f01e5e,"e",@progbits
+	.string	"(\265/\375`\331'e\261"
+	.string	"j\0251>X JI:\351\\\232\230\212\366\350n2Q\321\336\27134\236\317:\2721\214tg\266##\242\"b\233\215\0210\216n\303\225d\343\211\004\330\335\252\215\244[\025"
+	.string	"\303\305p\315\nkC\3214)9\024\240mQ\323\254\345\t\304\312R\200"
+	.string	"A\241\004\321D\257\266\222\275e\nR\003\305\003\024\004Ke\333S\022H\271\246\225T\2561\257\200\224M\255\253\034\225\2238*-\347(\346\025\020YS++\327\236\256~\224k\314$\215\263\034mAS\326\370\302\224QY\005"
+	.ascii	"\220E1\227t\312&\263\2359'\333\246\362R+\347\031L\f\316\250\037"
+	.ascii	"I'\024\235\n7YQ\315d\303\250\202\332b\3424\2412\2352\b\223i*"
+	.ascii	"g/\271j\203d'\2339\347\023\031*\3319O5\2279C13\220\305l\273\023"
+	.ascii	"\313\314\223\243\236\250\240\266\230;SP\314\0239\310\215"
+	.string	"\276R\256m1\217\234 Y\003\313P\315d\203e/ZK\274\226lfe\031\0364L\356\236\026\355.)\354\361\250\322\206\233\313\233<\367\311\305\225&\026\355\272\336\322jDm\207\023\325\314k8\\\312\320h;\202\337D@\037\"\240\226\316\3426\343\314\013\213r\330\032B\362\037Ig\371\215\3125h\350\324uyC\363\3149\213\350\352\020K\303\263hgi,=`uTI,\332Wz\226H\215Y\301\n7\225\226k\265\266\362w\225\236;\232\306\314k9g\036\235.g\333\223E-h! \332A\300\0227})\300\216k)_aKT\260h;[\n\216S\r\026\036R\242\224\315\231\231aQ('l\201\271b\3217\024~\322N0\226]VZ\364)\340\363u\223\233\2700qjM\230\340\300\341\326f\321^\202UP35\305\242\027b%p$\324p\226\261h\303\375\0050\300\305\354\344|\226s\236"
+	.string	"\375\"\205b\205E\317\327n9\\\360\322\320Y\264\333n\244\372\252\254Y\364\335\326I\376|a\247FW\214.\026\375\004\360?\340n6Z\253}\256\327\200\313\254\246O\317\02761@,\372\016\360\316\320\377\236\272l\200[\374\016\364\347\200\177\037\371\034*&%\352\206\021\"\236\025\270@\221\331\"\177\023\3513\n\256\222\212\231\333rn\002\3714]TqY\364\315\026\002\342\016\002\216\ta\020&C\203\217\337\3746"
+	.string	"^;\202\230V\347\357%\n\374\355\347\200~\376\215\246\367\304\340\375\375\205\313\337wu\177k\301\362\367\225\f\374=\201\2771\360\267\360\357\021\177S\371{\312\213~\353\344o#UeP\376\346z\362\267\r'\315\003\340\267\006\020:\316o\007p\373[#  \337\371-\006\236\035\tp0\220M;\257\363[\034\032-r~{_\300`\321\344\357\317*\314\007\177S1\371{\311\377\022\376~\373[\204\377\026h7\237\277\307H\255\265\332\337\022\244\375\337k\264\377\035\376O\020\364\367\334\337\315\277\215\374}\366\267\331\337c\177\003\371;\354\357\257\277}\374\355\365\367\216\277s\374\335\3657\363o\032\177\313\370\033\306\337/\376n\361\367\325\337V\177W\375\235\342o\345\337S\177o\340o\r\374]\342o\022\177\257\177#\377n\372\333\3707\361\357\023\376f\372\033"
+	.ascii	"\177G\360\267\205\277\205\376\376\371\033\350\357\235\277y\376"
+	.ascii	"\306\177\343\374\215\376m\363w\377\377\373\257\346\177\232\377"
+	.ascii	"h\376\363\375/\363?\357\177\227\377v\377\351\376g\371\277\366"
+	.ascii	"\337\310\377\"\377\317\376/\340\377\334\377\240\277\277\277\277"
+	.ascii	"\337\206\351\307A\341\227\340LM\247#?%=L\311GJ\354\023-\")\313"
+	.ascii	"?\3473\314\rL\213\254\331\330\314l\0219k\304\036\271M\260\233"
+	.ascii	"\267;\037z9\257\201\211\035\001\323\272\225\263e\326\307m:\361"
+	.ascii	"\t\2662\"h6\355\204\224\227\236\006C\232\255\351\262~r\024\033"
+	.ascii	"\021\260\234\233\\]\366G\317\323O\316]p`7\344\254\024\373\343"
+	.ascii	"6\235\"\260)\001\022\344l\316Z\261qv\213\245\263U\354\025[g\263"
+	.ascii	"\330;\253\305N\261X,\025k\327jV\356\267Pl\224_h\036\251Y8\017"
+	.ascii	"SK\234\251;\036z97-\021+g\233V\310E[\342\267\256\036z9\347k\360"
+	.ascii	"[.9\373\325l\023@)\363"
+	.string	"\323\r\017r\314?\3473\347\346\005\027.\270\340\002\0350;72\013\320\337\310a\234\316\272}\342\304\207\b\013\034=p\234\244\031kaQ\313\3046\271u\332%\331:7`\346\374d\235>~9?\371tc\350\306\200\232m}\275E\301\277\201\203\263oZ?\336NX\266\3337\333v\233\250P\"fQ\333fm\022\353v\333f\221\354D5m\033\232\363S7\206\236n\f6R|<\251\001\321\337\260a\273\326S\247\204\310\n+d\214\313+\b\221\264\274K\305\306\023\236\030\376\r\027n\236\355XYy1-\372\233\026\370t7R\370G\bx \032|\240\027|\240\034\276\024;\3463\205\317\206\323\242\007.\301\007\226\341\f\200Z\370\300+\374\346\032|\373\343\267Zv\313\372hf\316Q9\347\b\032m\307Z\236E\255\016\273\243\325:X\036\267^\266\307m\236\232\271i\275\324\270\251Y\364\247\205\200\226\017\277;"
+	.string	"\357\337_w"
+	.ascii	"Z\034G\2679\200kVP\321fQ\037,\370N\013\364:\bhm\034\3352\037"
+	.ascii	"\224}z\256\312\330\336,\n\324A\300\366\312-\004\024\002\263\211"
+	.ascii	"\303\034\350`\300\2601\344\260\304\310\234@\320\236X\324\306"
+	.ascii	"\260\251\013\362\343\355\rwH\276\370\213\374%\306\f\"\340\231"
+	.ascii	"\270\261\"BV\330\026+8|aa[\260\370B\226\223\331\330\262v\340"
+	.ascii	"\333\264\260\262WV0\226\366j9\346-\r\016"
+	.string	"\233\023\370\350\236\n[\245\342k\210\312VQu^\347e\316Y\371v\201\303\022#\363A!e\315\317\n>z\344\204Eq\202MiQ(\2379x\\E\240|\341\243Y\370PP\235\007\314\271\233L\253e\316Z\022u\230\213\262R6\252\363p\222\n\030\260\210[\025\032\026=\212\002\377\226\301\035\374l\322&\217\370d\251\250\261E\013&\302\372\373\373\311Pw2\300x^\300\201\351x\202\211t\250Q\303F\225\323\343\305\221*\213\376\236a\"(C\375\354\356{v\232f\353<\265\304Q\261\025F//\233\030\374j\341\337)\374n6 \221\0214h\360n\224\036K/3\330B\335\320\233\257\325\232\257\357\320\264|\225\263e\345\202\n\217\331\227\024U\033\346!3\364\036\243\326c\272L\247e+\244\036+\342\2369S\301\340\206\316\210\230\031\026m\275&\323j\024\364\336M\246\3453\2365ek\322X\364\326\013\277)"
+	.string	"\366_S"
+	.ascii	"\274\335\302DxC\375\245\361\336`\376\203\351<\334\314V\255\346"
+	.ascii	"\206%\366\314YYD;M\304p\231\021\346\235g\263\234d\270\330:\r"
+	.ascii	"\215\025\371\211\017\314O\313\2343\226M3;\241v\232\350\347\351"
+	.ascii	"\333\031\376\243\371\n\300/\347\032gf\200U\264^\230\261 ?g$e"
+	.ascii	"\224\326\022H\271\366\224\004R\321\324\272R\256i]\001\345f\332"
+	.ascii	"\213\274\306\225\2632\212\231\264O\271\231\257~r\224\326\025"
+	.ascii	"\316Oz\312f^\002\345\346\323\262\263VvG\277w\t\360\3422\263\350"
+	.ascii	"\335R\227t\025vg\321\337\272\266\0365>Td\261\350\245;\372\325"
+	.ascii	"\"\200%R\234X\364&\313\305\302\207\267u\261\374\327\312\275\002"
+	.ascii	"TFi\005\261h\006-\004\004v\020\360V9\372\235\273^\256\234\264"
+	.ascii	"\260\250"
+	.ascii	"\315\225\243b\203\246<s\251\3747\356N\261\316\f\354\360h\261"
+	.ascii	"\"\213E\337\326B@\034\"G\277R|\2664\341\373\021\305,'H\231\257"
+	.ascii	"\025\240tu\256\001\344\314\023&\212\032b\3224\327,d\rQ\301y["
+	.ascii	"xavQY\264\311\255\372\260G\325\305\244\331r\204\224\215I\261"
+	.ascii	"\350\205\273\035\360\313\371\351\302\331\273\344*\371\205\273"
+	.ascii	"\317\215\0272\345\023\020\035@\276H\356\333Er\335p\222=ybB\242"
+	.ascii	"<s\026\013\242\377\266\375\272\t\331\351c\313A\306\2427I\263"
+	.ascii	"\371\250p\302\016\311\003m\370\277lw\n\370\366\205%c\255\357"
+	.ascii	"\260\233\030:\025j6\006\f\035[i]\306n\271B\005eQ\rz\267y\233"
+	.ascii	"6F\363\317\211\365\346\340\262\031\326\220f\304\310\255\362\241"
+	.ascii	"\305K\310\323\006\310\013\256\024\026\375\0031\260\006\273\263"
+	.ascii	"\263\313\274\300L\222!\202\242%\306B\n,\013\2303X\003\223!C\256"
+	.ascii	"\331\005\350\376\234d=\006H\237\\\331\257YN\227\273\037m\026"
+	.ascii	"\275d\355\345\317\007\n\031\266-\005\026\224\032]\260\0064w\354"
+	.ascii	"\216}\251\373Q\203\003Q\262l\031\202\207`\\ \027\210\215\261"
+	.ascii	"\245\r\354\026\211\232\242\304\242\007\332\302C\312\260\260\016"
+	.ascii	"\260x`\365<\205\254\211\242\207\207\230__hi\304n\276\376\202"
+	.ascii	"\224%\301Ca>|t\336\336V\0202(c}?4\360P\232\227\227\2264b:Xb\270"
+	.ascii	"\230}x\b\312\335qw8Y\263\267c\243\357\213\305\022<T%G\016(ai"
+	.ascii	"\304t\230@Y\201f\321\373\234\300C`\264\264n\327\234\363\317\371"
+	.ascii	"\274M\240\242\214p\375v\365\2245,p\026\275[\355\345\216\351H"
+	.ascii	"\"\327\363\304\033\2226l\\&\260I\330\031\275\347\305\222\204"
+	.ascii	"\206\025f\337\341\r\241\373Z\2027T]\032\227\006\220d\031#O!h"
+	.ascii	"Qzn\340\ruW\306\225q[h\331\313\"\343\311\202\325\344\312\017"
+	.ascii	"o\210\203\001\343VY\220K\342\365\331\270\365\320\262\265\207"
+	.ascii	"7\260\275x\321ynab\316\236>0\202<Q\230\341\r_+V\334\026]p.\250"
+	.ascii	"<\257\031\n.6.\213\337\026<|ltF\372\016\210\305\312\257O\fo\250"
+	.ascii	"qu\325y\025\270\302\353\313\311r\227\203'\005\336\360\264\262"
+	.ascii	"\2621\032\216L\027\260g\n\031cvq\230\303\222\212\352V]\300\271"
+	.ascii	"HW\017\275\206\243\203[\336*\2340 [Thx\303\337MqSt\036\005\302"
+	.ascii	"\266\270\260an\224\361-1\007\271\253\274J\033\243\323\004@\266"
+	.ascii	"\"\216\254g+"
+	.string	"\310\n;R\230\203\332\2325w\n\001aG\300\310|\240hQ\352]\251\337\251\235\031a\360xX\364&o\224\002\236A\234X\364B\ro\f\261s\336\247\233w\246\\I1\265\330\277,==\246\240t\312\360ut`\0163\374\374l\214\243\244\031\331\216\237\232&i\2368\203\215\276>\r\264\b\211\262|\302\227C\2063\200=\237!\320\304\342x\224P)\362\326\2073\240\2359s\365\025\003Mv\341\3421\2073<1c&\017\315K\b\331\016\230&\020-\213\036\207\005\316\260eo/\207\037\331u\213\212\243Q\006g0\243\247\327ya\314\200f\242\230\221\325a\rRb\304\330\267\376iB\341\225\351\215\331\2351\343\304\032\230a\302t\336\005\346\355\202\266e\205\314&\305\326W\036\016\254!l\b\357x\235w\341\n\335\237s\207\013\031\031?\0318\203\213\241.k;\243\325\354\f\353\245\001\315\234\004.A\261\314\302"
+	.string	"M^\311\213\263\350\255\227\337\322\2605l\227\035\273t\2169\261\250\345r\241\257~\244\371\260\3501\026\2765;\263>\002g*J\213\303U5\241\251(\304A\362(\245\032\030\022\203\303\021*X\323%\035\245\224(\"h\004aM\325\nD\370\244kp\r\261\376\020\235\251h\202\024\216\304\021M\307\235\f\0264\005\227\206$\202F\341\260\351XB\222zD\302\220\"{\316TT\254\340\210\f\212\020\362\234\251\310(\035q\2436-\245IJ\306a\nF+\323\322\2208BCq\270\252 (\031\207\024\b\272iZB\036\327\240p\250d\034Am\022\301\351\2013\025aX\201\224R\244\023\210t\351\003uh\341LE\"\214T\344Q5\246*\005\310tMIX\215)\022\351$|`H\024\346\234\251(\251I-N\220&\005\327 \003\232T\022\214G\b\244k\320\211\030$\001B\223Z\214"
+	.string	"\202&\265\370s\246\"%\246\244\341\tJIJ\3521"
+	.string	"Jj\004\206'(\005\235\251hD\322\006\225\030\024q$.Ip\246\"#\343\261X<\n\207\206J\306#\b\341p\351H\274p\246\242\022+\t\243\343\260\304J\002\347LE\303$\022A'#\325\351\303*L\215\306\243\020\231\256\306\021H\004\235 8S\221Z\024\n!\325\2420\247\204\004~@\224\220@\323\361\370"
+	.ascii	"\245!\222q\030$\241\230\256\252\211\0209k\0222%:)\245LB\025\203"
+	.ascii	"\252\246\306"
+	.string	"\025\031\\U\b\220A&!\232\026\203\020 \036\217\037\222l\204)\223\020Ght\n\001+\035\207\310\024I)E\016\325T\211g\r\256j\217\211u\210<\016\221H\302a1h4\241\344\243\246D\241\t\020\351\322\007\037(\245\304\240qiH\354Y\223t\202+1e\300\252\246k\360\001E\247\020K\306!\211c\021\202\022\301\342\017\b\304\340z\\\037X\22388*\006\221K\307U\0356 -\016K0\036\207\253\2230-\221B\240\336\254C\343\b\252p\204\0162%1D2\340(4\232\b\261S\342(\002\005a\220\370!\210\307\004rM\213)1-\301\202P\nGb\b\304\240p\2706E`\002\237\365\270\016\221 8\"3(Z\221\301\246\242#2\370AU\203M\305#\210\020H\"\364\244H\2475\210L\233\212i\tB\022dP\244\224\n\207$\220i\210U\r>`\3118D\036\327\241\361H\302\032\024\021"
+	.string	"\023\310t]\203\037\3225\250\324d\002\320\231\212\226\206#\214Ga\222\321\tY\201\272\024$\206\260d\034\026\221A\2353\025\r\211B\013k\222\207\233T\351H\302\220(\274\271\260H\225 DJT2\006\033\360s\341\020\231\032\323%\374\r8 "
+	.string	"\007\036J\334\334\203\007\031x\220\001\360\036<8:\362\200\203#|\016\216n\232\2444\002\nj\260\204\021\302\2345\251"
+	.string	"\032\254\306\241\023>SQ\223Z\214\340\307\246\024i\264\036\217H#\2354i%:\251\251\004V5iMQ\020\006\221\232\324\242\016rE2\206\260\252G$5iE\036\221\210\301!2Uw\224\214\301b\361\bBUS\341\021\211$\f\241I-\006\255I\252\tiq\270\342\007\205\251\006\301\003x\330\240\310\302;\350"
+	.ascii	"\204\005&@@\004,,RQP\203k\222p\204\221p\204\221q\030,\032\t\221"
+	.ascii	"\252Q\321\0055\327o\b\032\327\224E\177\375\376kw\323\240]5\360"
+	.ascii	"lX\364\202\327\321o\2373n\312o\205\373t!\205\006\303\242\277"
+	.ascii	"\317\377\242\261Exf\210quYt\207\357\350\367\214\r\214\271\033"
+	.ascii	"^\026\3251S\246\013\022+n\026\375-\363\337*w\217\311\0256\034"
+	.ascii	"\026%\"\203r\235\261\022\323\033\243#\265\264\"e\321\3371\377"
+	.ascii	"\315\273b\376\276\3148[\b\230\023w\364\033F'\212\305\333\017"
+	.ascii	"0\027\217\317\356\312\305\373/\335\375r\307dO\207E=\264\020\360"
+	.ascii	"Z9\372\365b\213\340P\362\350\302%\306\215\256\313e\r\207\211"
+	.ascii	"\016\036z\026\275\001\203y\250r\3510"
+	.string	"\t\363\030BdHFd$I\222\306\342\n\020\006\002b\226\346\326\003\022 EA\223)\346DDd\244\240 \311\306fB4\200\217\0363P\254\316\315\036&\002\346\332J\204\025\251\333\314\275@1\033\365\313\230[\373\227\243\212T\r\335\365.\341\344\020\321M!\300\002\3562\256l\307\376\030\305a"
+	.string	"\035\345@\257\260\205\t\177\033s\250ilW8)\262;\\\356\366\265\335\240\202\272\340%"
+	.string	"\004\243k_\020\025^\353l\317R\366&\227&\006\324\372 !\202\332\334I?^G[\210\320\240P\214\321\022\n\231\313\017\366\3454\270\307EM\n\373\b\262&\254h\r\240\211\254\251q:?\205\207S{\316\024\354R\272\242=h/\205\221\240i\222\005\220C\353?L\277]\302\373\212\207\345\214\247$j\320\373\033\243\0173\256\3662^\334\242\f"
+	.string	"\206\032]%.\366\366\374\001\343p\333\203\235WB\311\362\353\342\304O&\236\220n\355l\335h\337\207\304\301\252MX\324\362\027\371\325@\001]\210J\007\374m\013\006}\231\037\241MTH\332\r\337x\244`.J\277"
+	.string	"\266\367\307\325\352\005\237\352\377i\335\376\374K\032\222\030\202\261\265"
+	.string	"\321OR\001\234\343\374\b\277\223\200\222\r \300\353V\223\374\ri\025S8\n\362\250 @E\016\366\216\260\300\002\022*s\244]=\373}i\030N\007\371\257s\265e\026D\314\r<Q\275\251+\005'D\\f\305\314NF\364\372\303\250\274!\2034\331\245\340(z\203v}/>\037\223\333\245\335\356\365.\372V\246\332\313\374"
+	.string	"4\030\332(-Z\366{\232\363%\342\340a\207r\323w\246\265\250\261GL\202_`\205\256\t\323q\243+\375\261\376\271.Ik\261c\254j\335\245o\020\376\323P\nG%\330\244]\371\204p\246\313T\262;\311K\273\024\216\327eAzL\004\371\306\322\355Jw^\022\276\365x\343\032T\272\233\3548x\204\022\226\007\226'\364\313\177/\036el$\301\251\376y9N\021\321o\307\025\332\251\325j\203\213n\251\251\027V\020\b\273@\204\026\360\317@T\275\370yX?\035\256\317\246\372'\023\013\222\250\bx\201\002m\232\277/\017\346\243\032\026\216\022\3513;?"
+	.ascii	"\347z\207Bi\222[PYO\213\222ri\026\201\354\032\020\225\362\230"
+	.ascii	"\037\276n\264Mf\bK\234\021\226Q,\023>\200\200\b\305\002FIa\364"
+	.ascii	"=\233"
+	.string	"\005\370\351\324\327\215\260\235\276\253\033\340\013\317S\277\036\256oc9\257\274\272p\034+\336mY\004\330P\225\304\221\025k\\\264\375\245\315S\210,\366\033-\325\234\341\251\0077\363\313\317\030\fc\251\035\021/\300\204=\020\207\335Hg\215\032\354-\323L1#\277\255\210u\nn:Y`\035H[k\363\222*\3473!\316\3213\f\376\003\311\230\252\222k\033\3160\022\257\016\351x\377\324\242 \300\315H\254\331j\221z\216\261N\270gx\017\203n\207\370\274\037\250\007\022|\033^\215\237L4$z\033O7\2309\227D\273\037y\324\332\023\211\260\035;\233\377(@\233\204\233\271\201h\277\215TX\373\372\370pwd\337\231`\257\353\251\037\364\310\315\314\350e\320$\030\003\250W\2443\225\210\217*2\006Z\202Y5LU\215G#\f\246\333\n\002\227^j\033\326\302\225\327\2678\032\"W\276\335n,'\207\307\206I"
+	.ascii	"\377\020\360g\rx\252v0S\350mi\270$\2552#\337i{\300\027\236\334"
+	.ascii	"\307\020X\314h\230axK\201 \021\220WD\025\b\2432Wj\241Za\004Y"
+	.ascii	"\"\273\261\303\231Wdy\354f\361\301\226\3437\231\273fh\200\316"
+	.ascii	"-;\253\221\031EK\263\334>\003\2724\312="
+	.string	"@\023B/\351\341\260cU\270\232\\\324\200\fxv\2443\22040i\220M\021\031\230c\016\003h\274\370=\263*\371U9\002Mw\037U\016\345\025\363\024\177\177\366>\360n\204}\240\204\300\231/\264\367\224\253\241\366<\242\003\330\316\373\206\034\264\022s\223'\325\242\241\030\241@8\241\220|\021\021\372l\264\024\243$%\240\316\300x\317\032\006\364\033\265*\002$\305\341\234\267\021\031\316\232v?\357\233!\004\216\353\360G\300\251\350\372\237W\177\002J3\221I4\302\023\354\3044\315\254~\256Wr\177\0043\004()U\bDx\372\264\002VM\257L\207!M |\235\266\315\244\343%5|\225\006\310jR\203\f\r\242d\013^S\250\240\226l\365\325J\370\262I\004\266\237\212\216\374M\211$.\323b\024\005\235\033>j*\0247\244#\241\212\26406\225\242\350\214\305\304\340\n\222\261LV\212HD\242{,`"
+	.string	"\201za\001%\255du!\350\026\302:\222Ym,U\017\2247\274\255\003\205\tf\332\b\302\235\355\246\001\312\3669\001\272\t,6\354\240\250\214\275_\364\375\370\005-\202\313\222Np\036\320:FGy\222\222!0\230h"
+	.string	"RyZ\270Rh\305P\223)\267W\204\301\226q\204\0256\177\372\272\262\274\264\250c\352^\320\312\264b\006|\f\202\251x\272\260\374\n\260\277f\263xA#\337\201\354\335\357'h\\\334*g}\003\320\f\255"
+	.ascii	"P4\322$\253\346\203\220\362\353\247gn\240%\263\021\346P\335G"
+	.ascii	"\227\274\223\225\254\243`\b\256\320\nC"
+	.string	"FFer.\214\250\307g\277\2661\354[\275\200\322`\350%?\314\362\005\300$\003\005/\204\337{\236EO@\202\016\212'Y\021\373C\034\320\207\326~\242\366\213\313\207jT\371C\371\363\210\271\242\006+\300\235^\375p\260\201\270r\377\260\340\374\270\337\245Y'\227s\374\016n`\222\013d\357\367\255\221>\0372\320s\216\366Z\260\313\333\020\202\277\352\243/\036\313\236\032\313R\214hg\271\3218|`\262\210\234\345[\310C\227O\213\333\264~F-\335\325\013\203\227\357\025\257\177\226\251\262\037\374\342\352W\211l]\362b?\273\3518\204\260b\374;\324\276\246\333u\313\371\356\372\365izW\257\266\343\335kfb\265\333\203c\264q\214>\"\377\203\0255mq\033\322\0075\227\371u\204\177\016\332\007\317\267\362k\322\332\021\357\373\364\233\351\016\3642`\006\344\356a\247\233\231\177R3\022\301\007\037\026w\275O\031\200"
+	.ascii	"B\326\342G+"
+	.text
+	.section	.gnu.lto_.symtab.a49650cda4f01e5e,"e",@progbits
+	.string	"taskHandleSerial"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355"
+	.string	""
+	.string	""
+	.string	"taskUpdateBattery"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367"
+	.string	""
+	.string	""
+	.string	"taskUpdateTemperature"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375"
+	.string	""
+	.string	""
+	.string	"taskProcessGPS"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377"
+	.string	""
+	.string	""
+	.string	"taskUpdateCompass"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"taskUpdateBaro"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\001"
+	.string	""
+	.string	"taskUpdatePitot"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\001"
+	.string	""
+	.string	"taskUpdateOpticalFlow"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"taskTelemetry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\001"
+	.string	""
+	.string	"taskBlackbox"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\001"
+	.string	""
+	.string	"taskSyncServoDriver"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\001"
+	.string	""
+	.string	"fcTasksInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\001"
+	.string	""
+	.string	"cfTasks"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363"
+	.string	""
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365"
+	.string	""
+	.string	""
+	.string	"mspFcProcessCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337"
+	.string	""
+	.string	""
+	.string	"taskSystem"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"taskMainPidLoop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"taskUpdateRxCheck"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"taskUpdateRxMain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"cmsHandler"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\001"
+	.string	""
+	.string	"uavInterconnectBusTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\001"
+	.string	""
+	.string	"vtxUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\001"
+	.string	""
+	.string	"logicConditionUpdateTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"globalFunctionsUpdateTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"djiOsdSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\001"
+	.string	""
+	.string	"mspSerialProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"cliProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\210\001"
+	.string	""
+	.string	"currentMeterUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\001"
+	.string	""
+	.string	"temperatureUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\001"
+	.string	""
+	.string	"updateGpsIndicator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\001"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\001"
+	.string	""
+	.string	"updateWindEstimator"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\001"
+	.string	""
+	.string	"compassUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"baroUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\240\001"
+	.string	""
+	.string	"rescheduleTask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"updatePositionEstimator_BaroTopic"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\001"
+	.string	""
+	.string	"pitotUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"updatePositionEstimator_PitotTopic"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"opflowUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\001"
+	.string	""
+	.string	"updatePositionEstimator_OpticalFlowTopic"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"telemetryProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"telemetryCheckState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"blackboxProcess"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\001"
+	.string	""
+	.string	"setTaskEnabled"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"getLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"uavInterconnectBusIsInitialized"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"schedulerInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a49650cda4f01e5e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
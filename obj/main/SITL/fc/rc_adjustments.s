@@ -0,0 +1,15951 @@
+	.file	"rc_adjustments.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 8 "./src/main/common/axis.h"
+	.file 9 "./src/main/drivers/vtx_common.h"
+	.file 10 "./src/main/drivers/adc.h"
+	.file 11 "./src/main/fc/config.h"
+	.file 12 "./src/main/fc/controlrate_profile.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/rc_modes.h"
+	.file 15 "./src/main/fc/rc_adjustments.h"
+	.file 16 "./src/main/navigation/navigation.h"
+	.file 17 "./src/main/flight/mixer.h"
+	.file 18 "./src/main/flight/pid.h"
+	.file 19 "./src/main/io/vtx.h"
+	.file 20 "./src/main/sensors/boardalignment.h"
+	.file 21 "./src/main/fc/rc_adjustments.c"
+	.file 22 "/usr/include/string.h"
+	.file 23 "./src/main/common/maths.h"
+	.file 24 "./src/main/config/feature.h"
+	.file 25 "./src/main/blackbox/blackbox.h"
+	.file 26 "./src/main/io/beeper.h"
+	.file 27 "./src/main/rx/rx.h"
+	.file 28 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_adjustments.c.f39b754d
+	.weak	rc_adjustments.c.f39b754d
+rc_adjustments.c.f39b754d:
+	.long	0x192e
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF2129
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1658
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1659
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1660
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1661
+	.uleb128 0x3
+	.long	.LASF1663
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1662
+	.uleb128 0x3
+	.long	.LASF1664
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1666
+	.uleb128 0x3
+	.long	.LASF1667
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1668
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1669
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1670
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xb5
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1672
+	.uleb128 0x9
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF1673
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF1674
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x3
+	.long	.LASF1675
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x9
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x9
+	.long	0xea
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1678
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x9
+	.long	0x107
+	.uleb128 0x3
+	.long	.LASF1679
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x3
+	.long	.LASF1680
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.long	0xbc
+	.uleb128 0x3
+	.long	.LASF1681
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xfb
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x16f
+	.uleb128 0xb
+	.long	.LASF1682
+	.value	0xfff
+	.uleb128 0xb
+	.long	.LASF1683
+	.value	0xf000
+	.uleb128 0xb
+	.long	.LASF1684
+	.value	0xfff
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1686
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x17b
+	.uleb128 0x19
+	.long	0x186
+	.uleb128 0x4
+	.long	0xae
+	.byte	0
+	.uleb128 0x26
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x1a5
+	.uleb128 0x1d
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xae
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x1a5
+	.byte	0
+	.uleb128 0x5
+	.long	0x16f
+	.uleb128 0x7
+	.long	.LASF1702
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x205
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xb
+	.long	0x135
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x205
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x205
+	.byte	0x10
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xf
+	.long	0x20a
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x186
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0xea
+	.uleb128 0x5
+	.long	0x205
+	.uleb128 0x3
+	.long	.LASF1692
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x1aa
+	.uleb128 0x9
+	.long	0x20f
+	.uleb128 0x3
+	.long	.LASF1693
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0x107
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x118
+	.uleb128 0x1e
+	.long	.LASF1701
+	.long	0x30
+	.byte	0x7
+	.byte	0x78
+	.long	0x26c
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1698
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x7
+	.byte	0x7f
+	.byte	0x3
+	.long	0x238
+	.uleb128 0x7
+	.long	.LASF1703
+	.byte	0x4
+	.byte	0x7
+	.byte	0x81
+	.long	0x292
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x7
+	.byte	0x82
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1705
+	.byte	0x7
+	.byte	0x83
+	.byte	0x3
+	.long	0x278
+	.uleb128 0x7
+	.long	.LASF1706
+	.byte	0x8
+	.byte	0x7
+	.byte	0x85
+	.long	0x2c5
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x7
+	.byte	0x86
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x7
+	.byte	0x87
+	.byte	0xe
+	.long	0x107
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1709
+	.byte	0x7
+	.byte	0x88
+	.byte	0x3
+	.long	0x29e
+	.uleb128 0x7
+	.long	.LASF1710
+	.byte	0xc
+	.byte	0x7
+	.byte	0x8a
+	.long	0x312
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x7
+	.byte	0x8b
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x9
+	.long	0x312
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x7
+	.byte	0x8d
+	.byte	0xd
+	.long	0xd9
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x7
+	.byte	0x8e
+	.byte	0xb
+	.long	0x31e
+	.byte	0x8
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1715
+	.uleb128 0x9
+	.long	0x312
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1716
+	.uleb128 0x3
+	.long	.LASF1717
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x3
+	.long	0x2d1
+	.uleb128 0x7
+	.long	.LASF1718
+	.byte	0x10
+	.byte	0x7
+	.byte	0x91
+	.long	0x358
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x7
+	.byte	0x92
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x7
+	.byte	0x93
+	.byte	0xe
+	.long	0x22c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0x7
+	.byte	0x94
+	.byte	0x3
+	.long	0x331
+	.uleb128 0x7
+	.long	.LASF1722
+	.byte	0x4
+	.byte	0x7
+	.byte	0x96
+	.long	0x37e
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x7
+	.byte	0x97
+	.byte	0xe
+	.long	0x107
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1724
+	.byte	0x7
+	.byte	0x98
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x1f
+	.long	.LASF1951
+	.byte	0x10
+	.byte	0x7
+	.byte	0x9c
+	.long	0x3d3
+	.uleb128 0x12
+	.long	.LASF1725
+	.byte	0x7
+	.byte	0x9d
+	.byte	0x1f
+	.long	0x292
+	.uleb128 0x12
+	.long	.LASF1726
+	.byte	0x7
+	.byte	0x9e
+	.byte	0x21
+	.long	0x2c5
+	.uleb128 0x12
+	.long	.LASF1727
+	.byte	0x7
+	.byte	0x9f
+	.byte	0x29
+	.long	0x325
+	.uleb128 0x12
+	.long	.LASF1728
+	.byte	0x7
+	.byte	0xa0
+	.byte	0x24
+	.long	0x358
+	.uleb128 0x12
+	.long	.LASF1729
+	.byte	0x7
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x37e
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1730
+	.byte	0x7
+	.byte	0xa2
+	.byte	0x3
+	.long	0x38a
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x8
+	.byte	0x1d
+	.long	0x3fd
+	.uleb128 0x2
+	.long	.LASF1731
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1732
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1733
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x37
+	.long	0x42d
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1735
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1736
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1737
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1739
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1740
+	.byte	0x9
+	.byte	0x3f
+	.byte	0x3
+	.long	0x3fd
+	.uleb128 0x7
+	.long	.LASF1741
+	.byte	0x20
+	.byte	0x9
+	.byte	0x43
+	.long	0x494
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x9
+	.byte	0x44
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x9
+	.byte	0x45
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x9
+	.byte	0x46
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x9
+	.byte	0x47
+	.byte	0xc
+	.long	0x494
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x9
+	.byte	0x48
+	.byte	0xc
+	.long	0x494
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x9
+	.byte	0x49
+	.byte	0xc
+	.long	0x494
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x3
+	.long	.LASF1748
+	.byte	0x9
+	.byte	0x4a
+	.byte	0x3
+	.long	0x439
+	.uleb128 0x7
+	.long	.LASF1749
+	.byte	0x30
+	.byte	0x9
+	.byte	0x4c
+	.long	0x527
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x9
+	.long	0x88
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x9
+	.long	0x88
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x9
+	.byte	0x50
+	.byte	0x9
+	.long	0x88
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x9
+	.byte	0x51
+	.byte	0x9
+	.long	0x88
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x9
+	.byte	0x52
+	.byte	0xa
+	.long	0xb5
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x9
+	.byte	0x53
+	.byte	0x12
+	.long	0x130
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x9
+	.byte	0x54
+	.byte	0x12
+	.long	0x130
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x9
+	.byte	0x55
+	.byte	0xa
+	.long	0xb5
+	.byte	0x28
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1759
+	.byte	0x9
+	.byte	0x56
+	.byte	0x3
+	.long	0x4a5
+	.uleb128 0x7
+	.long	.LASF1760
+	.byte	0x30
+	.byte	0x9
+	.byte	0x58
+	.long	0x58e
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x9
+	.byte	0x59
+	.byte	0x26
+	.long	0x641
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x1b
+	.long	0x499
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x9
+	.byte	0x5d
+	.byte	0xd
+	.long	0xea
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x9
+	.byte	0x5e
+	.byte	0xd
+	.long	0xea
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xd
+	.long	0xea
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x9
+	.byte	0x60
+	.byte	0xd
+	.long	0xea
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1764
+	.byte	0x60
+	.byte	0x9
+	.byte	0x67
+	.long	0x637
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x9
+	.byte	0x68
+	.byte	0xc
+	.long	0x66c
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x9
+	.byte	0x69
+	.byte	0x14
+	.long	0x685
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xb
+	.long	0x699
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xc
+	.long	0x6b3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xc
+	.long	0x6c8
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x9
+	.byte	0x6e
+	.byte	0xc
+	.long	0x6c8
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x9
+	.byte	0x70
+	.byte	0xb
+	.long	0x6e6
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x9
+	.byte	0x71
+	.byte	0xb
+	.long	0x6ff
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x9
+	.byte	0x72
+	.byte	0xb
+	.long	0x6ff
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x9
+	.byte	0x73
+	.byte	0xb
+	.long	0x71d
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x9
+	.byte	0x75
+	.byte	0xb
+	.long	0x73b
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x9
+	.byte	0x76
+	.byte	0xb
+	.long	0x759
+	.byte	0x58
+	.byte	0
+	.uleb128 0x9
+	.long	0x58e
+	.uleb128 0x5
+	.long	0x637
+	.uleb128 0x9
+	.long	0x63c
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0x9
+	.byte	0x61
+	.byte	0x3
+	.long	0x533
+	.uleb128 0x9
+	.long	0x646
+	.uleb128 0x19
+	.long	0x667
+	.uleb128 0x4
+	.long	0x667
+	.uleb128 0x4
+	.long	0x22c
+	.byte	0
+	.uleb128 0x5
+	.long	0x646
+	.uleb128 0x5
+	.long	0x657
+	.uleb128 0x13
+	.long	0x42d
+	.long	0x680
+	.uleb128 0x4
+	.long	0x680
+	.byte	0
+	.uleb128 0x5
+	.long	0x652
+	.uleb128 0x5
+	.long	0x671
+	.uleb128 0x13
+	.long	0x312
+	.long	0x699
+	.uleb128 0x4
+	.long	0x680
+	.byte	0
+	.uleb128 0x5
+	.long	0x68a
+	.uleb128 0x19
+	.long	0x6b3
+	.uleb128 0x4
+	.long	0x667
+	.uleb128 0x4
+	.long	0xea
+	.uleb128 0x4
+	.long	0xea
+	.byte	0
+	.uleb128 0x5
+	.long	0x69e
+	.uleb128 0x19
+	.long	0x6c8
+	.uleb128 0x4
+	.long	0x667
+	.uleb128 0x4
+	.long	0xea
+	.byte	0
+	.uleb128 0x5
+	.long	0x6b8
+	.uleb128 0x13
+	.long	0x312
+	.long	0x6e6
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x4
+	.long	0x205
+	.uleb128 0x4
+	.long	0x205
+	.byte	0
+	.uleb128 0x5
+	.long	0x6cd
+	.uleb128 0x13
+	.long	0x312
+	.long	0x6ff
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x4
+	.long	0x205
+	.byte	0
+	.uleb128 0x5
+	.long	0x6eb
+	.uleb128 0x13
+	.long	0x312
+	.long	0x718
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x4
+	.long	0x718
+	.byte	0
+	.uleb128 0x5
+	.long	0xfb
+	.uleb128 0x5
+	.long	0x704
+	.uleb128 0x13
+	.long	0x312
+	.long	0x73b
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x4
+	.long	0x205
+	.uleb128 0x4
+	.long	0x718
+	.byte	0
+	.uleb128 0x5
+	.long	0x722
+	.uleb128 0x13
+	.long	0x312
+	.long	0x754
+	.uleb128 0x4
+	.long	0x680
+	.uleb128 0x4
+	.long	0x754
+	.byte	0
+	.uleb128 0x5
+	.long	0x527
+	.uleb128 0x5
+	.long	0x740
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xa
+	.byte	0x16
+	.long	0x788
+	.uleb128 0x2
+	.long	.LASF1778
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1779
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1781
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1782
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xb
+	.byte	0x26
+	.long	0x883
+	.uleb128 0x2
+	.long	.LASF1783
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1784
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1785
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1786
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1787
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1788
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1789
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1790
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF1791
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF1792
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF1793
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF1794
+	.value	0x800
+	.uleb128 0xb
+	.long	.LASF1795
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF1796
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF1797
+	.value	0x4000
+	.uleb128 0xb
+	.long	.LASF1798
+	.value	0x8000
+	.uleb128 0xa
+	.long	.LASF1799
+	.long	0x10000
+	.uleb128 0xa
+	.long	.LASF1800
+	.long	0x20000
+	.uleb128 0xa
+	.long	.LASF1801
+	.long	0x40000
+	.uleb128 0xa
+	.long	.LASF1802
+	.long	0x80000
+	.uleb128 0xa
+	.long	.LASF1803
+	.long	0x100000
+	.uleb128 0xa
+	.long	.LASF1804
+	.long	0x200000
+	.uleb128 0xa
+	.long	.LASF1805
+	.long	0x400000
+	.uleb128 0xa
+	.long	.LASF1806
+	.long	0x800000
+	.uleb128 0xa
+	.long	.LASF1807
+	.long	0x1000000
+	.uleb128 0xa
+	.long	.LASF1808
+	.long	0x2000000
+	.uleb128 0xa
+	.long	.LASF1809
+	.long	0x4000000
+	.uleb128 0xa
+	.long	.LASF1810
+	.long	0x8000000
+	.uleb128 0xa
+	.long	.LASF1811
+	.long	0x10000000
+	.uleb128 0xa
+	.long	.LASF1812
+	.long	0x20000000
+	.uleb128 0xa
+	.long	.LASF1813
+	.long	0x40000000
+	.byte	0
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x5
+	.long	0x8ce
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x11
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0xc
+	.byte	0x30
+	.byte	0x11
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0xc
+	.byte	0x31
+	.byte	0x12
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0xc
+	.byte	0x32
+	.byte	0x12
+	.long	0xfb
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.byte	0x5
+	.byte	0xc
+	.byte	0x35
+	.byte	0x5
+	.long	0x8ff
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x36
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0xc
+	.byte	0x37
+	.byte	0x11
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0xc
+	.byte	0x38
+	.byte	0x11
+	.long	0x8ff
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	0xea
+	.long	0x90f
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.byte	0x5
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x5
+	.long	0x940
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x11
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0xc
+	.byte	0x3e
+	.byte	0x11
+	.long	0x8ff
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0xc
+	.byte	0x41
+	.byte	0x5
+	.long	0x957
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0xc
+	.byte	0x42
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1822
+	.byte	0x14
+	.byte	0xc
+	.byte	0x2b
+	.long	0x998
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x883
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0xc
+	.byte	0x39
+	.byte	0x7
+	.long	0x8ce
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0xc
+	.byte	0x3f
+	.byte	0x7
+	.long	0x90f
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0xc
+	.byte	0x43
+	.byte	0x7
+	.long	0x940
+	.byte	0x12
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1827
+	.byte	0xc
+	.byte	0x45
+	.byte	0x3
+	.long	0x957
+	.uleb128 0x1e
+	.long	.LASF1828
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.long	0xa14
+	.uleb128 0x2
+	.long	.LASF1829
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1830
+	.byte	0x1
+	.uleb128 0x27
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1831
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1832
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1834
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1835
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1836
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1838
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1839
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1840
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1841
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0xf
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xe
+	.byte	0x1c
+	.long	0xb22
+	.uleb128 0x2
+	.long	.LASF1844
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1846
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1847
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1848
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1850
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1851
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1852
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1853
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1854
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1855
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1856
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1857
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1858
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1859
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1862
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1863
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1864
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1865
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1866
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1867
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1868
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1869
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF1870
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1871
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF1872
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1873
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1874
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1875
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1876
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1877
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1878
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1883
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF1884
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1887
+	.byte	0x2
+	.byte	0xe
+	.byte	0x60
+	.long	0xb49
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0xe
+	.byte	0x61
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0xe
+	.byte	0x62
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1890
+	.byte	0xe
+	.byte	0x63
+	.byte	0x3
+	.long	0xb22
+	.uleb128 0x9
+	.long	0xb49
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x1b
+	.long	0xc98
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1895
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1916
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF1919
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1920
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF1921
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1922
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF1923
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1924
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF1925
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1926
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF1927
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1928
+	.byte	0x25
+	.uleb128 0x2
+	.long	.LASF1929
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF1930
+	.byte	0x27
+	.uleb128 0x2
+	.long	.LASF1931
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1932
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF1934
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x2f
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1942
+	.byte	0xf
+	.byte	0x52
+	.byte	0x3
+	.long	0xb5a
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x54
+	.long	0xcbc
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1945
+	.byte	0x1
+	.byte	0xf
+	.byte	0x59
+	.long	0xcd6
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0xf
+	.byte	0x5a
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1947
+	.byte	0xf
+	.byte	0x5b
+	.byte	0x3
+	.long	0xcbc
+	.uleb128 0x7
+	.long	.LASF1948
+	.byte	0x1
+	.byte	0xf
+	.byte	0x5d
+	.long	0xcfc
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0xf
+	.byte	0x5e
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1950
+	.byte	0xf
+	.byte	0x5f
+	.byte	0x3
+	.long	0xce2
+	.uleb128 0x1f
+	.long	.LASF1952
+	.byte	0x1
+	.byte	0xf
+	.byte	0x61
+	.long	0xd2d
+	.uleb128 0x12
+	.long	.LASF1953
+	.byte	0xf
+	.byte	0x62
+	.byte	0x1c
+	.long	0xcd6
+	.uleb128 0x12
+	.long	.LASF1954
+	.byte	0xf
+	.byte	0x63
+	.byte	0x1e
+	.long	0xcfc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1955
+	.byte	0xf
+	.byte	0x64
+	.byte	0x3
+	.long	0xd08
+	.uleb128 0x7
+	.long	.LASF1956
+	.byte	0x3
+	.byte	0xf
+	.byte	0x66
+	.long	0xd6d
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0xf
+	.byte	0x67
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0xf
+	.byte	0x68
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0xf
+	.byte	0x69
+	.byte	0x16
+	.long	0xd2d
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1959
+	.byte	0xf
+	.byte	0x6a
+	.byte	0x3
+	.long	0xd39
+	.uleb128 0x9
+	.long	0xd6d
+	.uleb128 0x7
+	.long	.LASF1960
+	.byte	0x6
+	.byte	0xf
+	.byte	0x6c
+	.long	0xdcc
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0xf
+	.byte	0x6e
+	.byte	0x14
+	.long	0xb49
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0xf
+	.byte	0x6f
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0xf
+	.byte	0x72
+	.byte	0xd
+	.long	0xea
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0xf
+	.byte	0x73
+	.byte	0xd
+	.long	0xea
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0xf
+	.byte	0x76
+	.byte	0xd
+	.long	0xea
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0xf
+	.byte	0x77
+	.byte	0x3
+	.long	0xd7e
+	.uleb128 0x9
+	.long	0xdcc
+	.uleb128 0x7
+	.long	.LASF1966
+	.byte	0x10
+	.byte	0xf
+	.byte	0x7b
+	.long	0xe11
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0xf
+	.byte	0x7c
+	.byte	0x1f
+	.long	0xe11
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0xf
+	.byte	0x7d
+	.byte	0xe
+	.long	0x107
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0xf
+	.byte	0x7e
+	.byte	0xd
+	.long	0xea
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	0xd79
+	.uleb128 0x3
+	.long	.LASF1969
+	.byte	0xf
+	.byte	0x7f
+	.byte	0x3
+	.long	0xddd
+	.uleb128 0x17
+	.long	0xdcc
+	.long	0xe32
+	.uleb128 0x18
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1970
+	.byte	0xf
+	.byte	0x88
+	.byte	0x1a
+	.long	0xe22
+	.uleb128 0x14
+	.long	.LASF1971
+	.byte	0xf
+	.byte	0x88
+	.byte	0x55
+	.long	0xe22
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1972
+	.uleb128 0xf
+	.byte	0xa
+	.byte	0x10
+	.byte	0x92
+	.byte	0x9
+	.long	0xedd
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x10
+	.byte	0x93
+	.byte	0x15
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x10
+	.byte	0x94
+	.byte	0x15
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x10
+	.byte	0x95
+	.byte	0x15
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x10
+	.byte	0x96
+	.byte	0x15
+	.long	0xea
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x10
+	.byte	0x97
+	.byte	0x15
+	.long	0xea
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0x10
+	.byte	0x98
+	.byte	0x15
+	.long	0xea
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x10
+	.byte	0x99
+	.byte	0x15
+	.long	0xea
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0x10
+	.byte	0x9a
+	.byte	0x15
+	.long	0xea
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x10
+	.byte	0x9b
+	.byte	0x15
+	.long	0xea
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x10
+	.byte	0x9c
+	.byte	0x15
+	.long	0xea
+	.byte	0x9
+	.byte	0
+	.uleb128 0xf
+	.byte	0x2e
+	.byte	0x10
+	.byte	0x91
+	.byte	0x5
+	.long	0xfde
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x10
+	.byte	0x9d
+	.byte	0xb
+	.long	0xe51
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x10
+	.byte	0x9f
+	.byte	0x11
+	.long	0xea
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x10
+	.byte	0xa0
+	.byte	0x12
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x10
+	.byte	0xa1
+	.byte	0x12
+	.long	0xfb
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x10
+	.byte	0xa2
+	.byte	0x12
+	.long	0xfb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x10
+	.byte	0xa3
+	.byte	0x12
+	.long	0xfb
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x10
+	.byte	0xa4
+	.byte	0x12
+	.long	0xfb
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x10
+	.byte	0xa5
+	.byte	0x12
+	.long	0xfb
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x10
+	.byte	0xa6
+	.byte	0x12
+	.long	0xfb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x10
+	.byte	0xa8
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x10
+	.byte	0xa9
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x10
+	.byte	0xaa
+	.byte	0x12
+	.long	0xfb
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0x10
+	.byte	0xab
+	.byte	0x12
+	.long	0xfb
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0x10
+	.byte	0xac
+	.byte	0x12
+	.long	0xfb
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x10
+	.byte	0xad
+	.byte	0x12
+	.long	0xfb
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x10
+	.byte	0xae
+	.byte	0x12
+	.long	0xfb
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x10
+	.byte	0xaf
+	.byte	0x12
+	.long	0xfb
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x10
+	.byte	0xb0
+	.byte	0x12
+	.long	0xfb
+	.byte	0x2c
+	.byte	0
+	.uleb128 0xf
+	.byte	0x18
+	.byte	0x10
+	.byte	0xb3
+	.byte	0x5
+	.long	0x1091
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x10
+	.byte	0xb4
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x10
+	.byte	0xb5
+	.byte	0x12
+	.long	0xfb
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x10
+	.byte	0xb6
+	.byte	0x12
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x12
+	.long	0xfb
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x10
+	.byte	0xb8
+	.byte	0x12
+	.long	0xfb
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x10
+	.byte	0xb9
+	.byte	0x12
+	.long	0xfb
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x10
+	.byte	0xba
+	.byte	0x11
+	.long	0xea
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x10
+	.byte	0xbb
+	.byte	0x12
+	.long	0xfb
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x10
+	.byte	0xbc
+	.byte	0x12
+	.long	0xfb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x10
+	.byte	0xbd
+	.byte	0x12
+	.long	0xfb
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x10
+	.byte	0xbe
+	.byte	0x11
+	.long	0xea
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x10
+	.byte	0xbf
+	.byte	0x11
+	.long	0xea
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x10
+	.byte	0xc0
+	.byte	0x11
+	.long	0xea
+	.byte	0x16
+	.byte	0
+	.uleb128 0xf
+	.byte	0x2e
+	.byte	0x10
+	.byte	0xc3
+	.byte	0x5
+	.long	0x11fa
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x10
+	.byte	0xc4
+	.byte	0x11
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x10
+	.byte	0xc5
+	.byte	0x11
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x10
+	.byte	0xc6
+	.byte	0x11
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x10
+	.byte	0xc7
+	.byte	0x12
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x10
+	.byte	0xc8
+	.byte	0x12
+	.long	0xfb
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x10
+	.byte	0xc9
+	.byte	0x11
+	.long	0xea
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x10
+	.byte	0xca
+	.byte	0x12
+	.long	0xfb
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x10
+	.byte	0xcb
+	.byte	0x12
+	.long	0xfb
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x10
+	.byte	0xcc
+	.byte	0x11
+	.long	0xea
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x10
+	.byte	0xcd
+	.byte	0x12
+	.long	0xfb
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x10
+	.byte	0xce
+	.byte	0x10
+	.long	0xc1
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x10
+	.byte	0xcf
+	.byte	0x12
+	.long	0xfb
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x10
+	.byte	0xd0
+	.byte	0x12
+	.long	0xfb
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x10
+	.byte	0xd1
+	.byte	0x12
+	.long	0xfb
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x10
+	.byte	0xd2
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x10
+	.byte	0xd3
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x10
+	.byte	0xd4
+	.byte	0x12
+	.long	0xfb
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0x10
+	.byte	0xd5
+	.byte	0x12
+	.long	0xfb
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0x10
+	.byte	0xd6
+	.byte	0x12
+	.long	0xfb
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x10
+	.byte	0xd7
+	.byte	0x12
+	.long	0xfb
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x10
+	.byte	0xd8
+	.byte	0x12
+	.long	0xfb
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x10
+	.byte	0xd9
+	.byte	0x11
+	.long	0xea
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x10
+	.byte	0xda
+	.byte	0x11
+	.long	0xea
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x10
+	.byte	0xdb
+	.byte	0x11
+	.long	0xea
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x10
+	.byte	0xdc
+	.byte	0x11
+	.long	0x312
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x10
+	.byte	0xdd
+	.byte	0xd
+	.long	0x312
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x10
+	.byte	0xde
+	.byte	0x11
+	.long	0xea
+	.byte	0x2d
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2040
+	.byte	0x74
+	.byte	0x10
+	.byte	0x8f
+	.long	0x122c
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x10
+	.byte	0xb1
+	.byte	0x7
+	.long	0xedd
+	.byte	0
+	.uleb128 0xe
+	.string	"mc"
+	.byte	0x10
+	.byte	0xc1
+	.byte	0x7
+	.long	0xfde
+	.byte	0x2e
+	.uleb128 0xe
+	.string	"fw"
+	.byte	0x10
+	.byte	0xdf
+	.byte	0x7
+	.long	0x1091
+	.byte	0x46
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2042
+	.byte	0x10
+	.byte	0xe0
+	.byte	0x3
+	.long	0x11fa
+	.uleb128 0x14
+	.long	.LASF2043
+	.byte	0x10
+	.byte	0xe2
+	.byte	0x14
+	.long	0x122c
+	.uleb128 0x7
+	.long	.LASF2044
+	.byte	0x8
+	.byte	0x11
+	.byte	0x41
+	.long	0x1292
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x11
+	.byte	0x42
+	.byte	0xc
+	.long	0xc1
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x11
+	.byte	0x43
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x11
+	.byte	0x44
+	.byte	0x9
+	.long	0x312
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x11
+	.byte	0x45
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x11
+	.byte	0x46
+	.byte	0xe
+	.long	0xfb
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2050
+	.byte	0x11
+	.byte	0x47
+	.byte	0x3
+	.long	0x1244
+	.uleb128 0x14
+	.long	.LASF2051
+	.byte	0x11
+	.byte	0x49
+	.byte	0x16
+	.long	0x1292
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x12
+	.byte	0x39
+	.long	0x12fe
+	.uleb128 0x2
+	.long	.LASF2052
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2053
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2059
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2063
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2064
+	.byte	0x4
+	.byte	0x12
+	.byte	0x51
+	.long	0x1338
+	.uleb128 0xe
+	.string	"P"
+	.byte	0x12
+	.byte	0x52
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0xe
+	.string	"I"
+	.byte	0x12
+	.byte	0x53
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.uleb128 0xe
+	.string	"D"
+	.byte	0x12
+	.byte	0x54
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0xe
+	.string	"FF"
+	.byte	0x12
+	.byte	0x55
+	.byte	0xd
+	.long	0xea
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2065
+	.byte	0x12
+	.byte	0x56
+	.byte	0x3
+	.long	0x12fe
+	.uleb128 0x7
+	.long	.LASF2066
+	.byte	0x2c
+	.byte	0x12
+	.byte	0x58
+	.long	0x135e
+	.uleb128 0xe
+	.string	"pid"
+	.byte	0x12
+	.byte	0x59
+	.byte	0xc
+	.long	0x135e
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	0x1338
+	.long	0x136e
+	.uleb128 0x18
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2067
+	.byte	0x12
+	.byte	0x5a
+	.byte	0x3
+	.long	0x1344
+	.uleb128 0x7
+	.long	.LASF2068
+	.byte	0xa
+	.byte	0x13
+	.byte	0x25
+	.long	0x13d5
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x13
+	.byte	0x26
+	.byte	0xd
+	.long	0xea
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x13
+	.byte	0x27
+	.byte	0xd
+	.long	0xea
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x13
+	.byte	0x28
+	.byte	0xd
+	.long	0xea
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x13
+	.byte	0x29
+	.byte	0xe
+	.long	0xfb
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0x13
+	.byte	0x2a
+	.byte	0xd
+	.long	0xea
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x13
+	.byte	0x2b
+	.byte	0xe
+	.long	0xfb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2073
+	.byte	0x13
+	.byte	0x2c
+	.byte	0x3
+	.long	0x137a
+	.uleb128 0x14
+	.long	.LASF2074
+	.byte	0x13
+	.byte	0x2e
+	.byte	0x1c
+	.long	0x13d5
+	.uleb128 0x7
+	.long	.LASF2075
+	.byte	0x6
+	.byte	0x14
+	.byte	0x16
+	.long	0x1421
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x14
+	.byte	0x17
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x14
+	.byte	0x18
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x14
+	.byte	0x19
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2079
+	.byte	0x14
+	.byte	0x1a
+	.byte	0x3
+	.long	0x13ed
+	.uleb128 0x9
+	.long	0x1421
+	.uleb128 0x14
+	.long	.LASF2080
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x19
+	.long	0x1421
+	.uleb128 0x20
+	.long	0xe32
+	.byte	0x13
+	.uleb128 0x20
+	.long	0xe3e
+	.byte	0x47
+	.uleb128 0x14
+	.long	.LASF2081
+	.byte	0x15
+	.byte	0x37
+	.byte	0x81
+	.long	0x21b
+	.uleb128 0x28
+	.long	0x144a
+	.byte	0xaf
+	.uleb128 0x21
+	.long	.LASF2082
+	.byte	0x39
+	.byte	0x10
+	.long	0xea
+	.uleb128 0x17
+	.long	0xd79
+	.long	0x1477
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x30
+	.byte	0
+	.uleb128 0x9
+	.long	0x1467
+	.uleb128 0x21
+	.long	.LASF2083
+	.byte	0x4a
+	.byte	0x21
+	.long	0x1477
+	.uleb128 0x17
+	.long	0xe16
+	.long	0x1497
+	.uleb128 0x18
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2084
+	.value	0x11a
+	.byte	0x1a
+	.long	0x1487
+	.uleb128 0x16
+	.long	.LASF2085
+	.byte	0xe
+	.byte	0x7e
+	.byte	0x5
+	.long	0x312
+	.long	0x14be
+	.uleb128 0x4
+	.long	0xea
+	.uleb128 0x4
+	.long	0x14be
+	.byte	0
+	.uleb128 0x5
+	.long	0xb55
+	.uleb128 0x16
+	.long	.LASF2086
+	.byte	0x16
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0x14e3
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x124
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2087
+	.byte	0x17
+	.byte	0x87
+	.byte	0x5
+	.long	0x88
+	.long	0x1503
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2090
+	.byte	0x19
+	.byte	0x22
+	.long	0x1519
+	.uleb128 0x4
+	.long	0x26c
+	.uleb128 0x4
+	.long	0x1519
+	.byte	0
+	.uleb128 0x5
+	.long	0x3d3
+	.uleb128 0x16
+	.long	.LASF2088
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x5
+	.long	0x312
+	.long	0x1534
+	.uleb128 0x4
+	.long	0x107
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2089
+	.byte	0x9
+	.byte	0x8d
+	.byte	0x5
+	.long	0x312
+	.long	0x154f
+	.uleb128 0x4
+	.long	0x667
+	.uleb128 0x4
+	.long	0x154f
+	.byte	0
+	.uleb128 0x5
+	.long	0x499
+	.uleb128 0x1c
+	.long	.LASF2092
+	.byte	0x9
+	.byte	0x80
+	.byte	0xe
+	.long	0x667
+	.uleb128 0x29
+	.long	.LASF2094
+	.byte	0x10
+	.value	0x187
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF2091
+	.byte	0x14
+	.byte	0x1f
+	.long	0x157f
+	.uleb128 0x4
+	.long	0xcd
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2093
+	.byte	0x12
+	.byte	0xa4
+	.byte	0xd
+	.long	0x158b
+	.uleb128 0x5
+	.long	0x136e
+	.uleb128 0x2a
+	.long	.LASF2095
+	.byte	0x12
+	.byte	0xb2
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF2096
+	.byte	0x1a
+	.byte	0x39
+	.long	0x15a9
+	.uleb128 0x4
+	.long	0xea
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2097
+	.byte	0x1b
+	.byte	0xd2
+	.byte	0x9
+	.long	0xcd
+	.long	0x15bf
+	.uleb128 0x4
+	.long	0x30
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2098
+	.byte	0x1c
+	.byte	0x1d
+	.byte	0xa
+	.long	0x220
+	.uleb128 0x2b
+	.long	.LASF2099
+	.byte	0x15
+	.value	0x2a2
+	.byte	0x5
+	.long	0x312
+	.long	0x15f7
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x2a2
+	.byte	0x2a
+	.long	0xea
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2100
+	.value	0x2a3
+	.byte	0x12
+	.long	0xea
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2105
+	.value	0x28b
+	.long	0x1643
+	.uleb128 0x6
+	.long	.LASF2101
+	.value	0x28b
+	.byte	0x21
+	.long	0x312
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2100
+	.value	0x28d
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2102
+	.value	0x28e
+	.byte	0x29
+	.long	0x1648
+	.uleb128 0x8
+	.long	.LASF2103
+	.value	0x293
+	.byte	0x23
+	.long	0xe11
+	.uleb128 0x8
+	.long	.LASF2104
+	.value	0x294
+	.byte	0x23
+	.long	0x1652
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xdd8
+	.uleb128 0x9
+	.long	0x1643
+	.uleb128 0x5
+	.long	0xe16
+	.uleb128 0x9
+	.long	0x164d
+	.uleb128 0x2c
+	.long	.LASF2130
+	.byte	0x15
+	.value	0x286
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF2106
+	.value	0x24b
+	.long	0x16eb
+	.uleb128 0x6
+	.long	.LASF2107
+	.value	0x24b
+	.byte	0x30
+	.long	0x16eb
+	.uleb128 0x6
+	.long	.LASF2101
+	.value	0x24b
+	.byte	0x47
+	.long	0x312
+	.uleb128 0x2d
+	.string	"now"
+	.byte	0x15
+	.value	0x24d
+	.byte	0x14
+	.long	0x113
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF1964
+	.value	0x24f
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2104
+	.value	0x250
+	.byte	0x23
+	.long	0x1652
+	.uleb128 0x8
+	.long	.LASF1711
+	.value	0x255
+	.byte	0x17
+	.long	0xf6
+	.uleb128 0x8
+	.long	.LASF2108
+	.value	0x25a
+	.byte	0x17
+	.long	0xe5
+	.uleb128 0x8
+	.long	.LASF2109
+	.value	0x25b
+	.byte	0x13
+	.long	0x319
+	.uleb128 0x8
+	.long	.LASF2110
+	.value	0x266
+	.byte	0x17
+	.long	0xf6
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2111
+	.value	0x269
+	.byte	0x11
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0x998
+	.uleb128 0x11
+	.long	.LASF2113
+	.value	0x16a
+	.long	0x172e
+	.uleb128 0x6
+	.long	.LASF2107
+	.value	0x16a
+	.byte	0x36
+	.long	0x16eb
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x16a
+	.byte	0x51
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x16a
+	.byte	0x69
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2112
+	.value	0x229
+	.byte	0x27
+	.long	0x499
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2114
+	.value	0x165
+	.long	0x175e
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x165
+	.byte	0x35
+	.long	0xc98
+	.uleb128 0x15
+	.string	"val"
+	.value	0x165
+	.byte	0x52
+	.long	0x205
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x165
+	.byte	0x5b
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2115
+	.value	0x160
+	.long	0x178e
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x160
+	.byte	0x3c
+	.long	0xc98
+	.uleb128 0x15
+	.string	"val"
+	.value	0x160
+	.byte	0x59
+	.long	0x205
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x160
+	.byte	0x62
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2116
+	.value	0x15b
+	.long	0x17be
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x15b
+	.byte	0x36
+	.long	0xc98
+	.uleb128 0x15
+	.string	"val"
+	.value	0x15b
+	.byte	0x53
+	.long	0x205
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x15b
+	.byte	0x5c
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2117
+	.value	0x154
+	.long	0x1812
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x154
+	.byte	0x35
+	.long	0xc98
+	.uleb128 0x15
+	.string	"val"
+	.value	0x154
+	.byte	0x53
+	.long	0x718
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x154
+	.byte	0x5c
+	.long	0x88
+	.uleb128 0x15
+	.string	"low"
+	.value	0x154
+	.byte	0x67
+	.long	0x88
+	.uleb128 0x6
+	.long	.LASF2118
+	.value	0x154
+	.byte	0x70
+	.long	0x88
+	.uleb128 0x8
+	.long	.LASF1713
+	.value	0x156
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2119
+	.value	0x14d
+	.long	0x1866
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x14d
+	.byte	0x34
+	.long	0xc98
+	.uleb128 0x15
+	.string	"val"
+	.value	0x14d
+	.byte	0x51
+	.long	0x205
+	.uleb128 0x6
+	.long	.LASF2111
+	.value	0x14d
+	.byte	0x5a
+	.long	0x88
+	.uleb128 0x15
+	.string	"low"
+	.value	0x14d
+	.byte	0x65
+	.long	0x88
+	.uleb128 0x6
+	.long	.LASF2118
+	.value	0x14d
+	.byte	0x6e
+	.long	0x88
+	.uleb128 0x8
+	.long	.LASF1713
+	.value	0x14f
+	.byte	0x9
+	.long	0x88
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2120
+	.value	0x12b
+	.long	0x1898
+	.uleb128 0x6
+	.long	.LASF1711
+	.value	0x12b
+	.byte	0x45
+	.long	0xc98
+	.uleb128 0x6
+	.long	.LASF1713
+	.value	0x12b
+	.byte	0x61
+	.long	0xd9
+	.uleb128 0x10
+	.uleb128 0x8
+	.long	.LASF2121
+	.value	0x132
+	.byte	0x2d
+	.long	0x325
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2122
+	.value	0x11c
+	.long	0x18d4
+	.uleb128 0x6
+	.long	.LASF2100
+	.value	0x11c
+	.byte	0x29
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF1963
+	.value	0x11c
+	.byte	0x38
+	.long	0xea
+	.uleb128 0x6
+	.long	.LASF2103
+	.value	0x11c
+	.byte	0x69
+	.long	0xe11
+	.uleb128 0x8
+	.long	.LASF2104
+	.value	0x11e
+	.byte	0x1f
+	.long	0x1652
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2123
+	.byte	0x14
+	.byte	0x1c
+	.byte	0x83
+	.long	0x18e0
+	.uleb128 0x5
+	.long	0x142d
+	.uleb128 0x1a
+	.long	.LASF2124
+	.byte	0x13
+	.byte	0x2e
+	.byte	0xf3
+	.long	0x18f1
+	.uleb128 0x5
+	.long	0x13d5
+	.uleb128 0x1a
+	.long	.LASF2125
+	.byte	0x11
+	.byte	0x49
+	.byte	0xc3
+	.long	0x1902
+	.uleb128 0x5
+	.long	0x1292
+	.uleb128 0x1a
+	.long	.LASF2126
+	.byte	0x10
+	.byte	0xe2
+	.byte	0xb3
+	.long	0x1913
+	.uleb128 0x5
+	.long	0x122c
+	.uleb128 0x2e
+	.long	.LASF2127
+	.byte	0xf
+	.byte	0x88
+	.byte	0x9c
+	.long	0x1643
+	.uleb128 0x2f
+	.long	.LASF2128
+	.byte	0xf
+	.byte	0x88
+	.byte	0xb1
+	.long	0x88
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 55
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 29 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.file 32 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 34 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 35 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 38 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 47 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 48 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x30
+	.file 49 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 50 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x32
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 51 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.file 53 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 54 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x18
+	.byte	0x4
+	.file 55 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.file 56 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1126
+	.byte	0x4
+	.file 57 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1127
+	.byte	0x4
+	.file 58 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1139
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.file 59 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 60 "./src/main/fc/rc_curves.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x3c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.file 61 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x4
+	.file 62 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3e
+	.file 63 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1436
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1463
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.file 73 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 74 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x12
+	.file 75 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1657
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1123
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1125
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1138
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1143
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1153
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.121.1375c5dbbb76305753358dfb80c7f17e,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1156
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1428
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1435
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1462
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1467
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1482
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1482
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1492
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1495
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1495
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1504
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1505
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1506
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1507
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1514
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1556
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1572
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1584
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1595
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1646
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x15
+	.long	.LASF1
+	.long	.LASF2131
+	.long	.LASF2132
+	.long	.LASF2133
+	.long	.LASF2134
+	.long	.LASF2135
+	.long	.LASF2136
+	.long	.LASF2137
+	.long	.LASF2138
+	.long	.LASF2139
+	.long	.LASF2140
+	.long	.LASF2141
+	.long	.LASF2142
+	.long	.LASF2143
+	.long	.LASF2144
+	.long	.LASF2145
+	.long	.LASF2146
+	.long	.LASF2147
+	.long	.LASF2148
+	.long	.LASF2149
+	.long	.LASF2150
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2151
+	.byte	0x10
+	.long	.LASF2152
+	.byte	0x10
+	.long	.LASF2153
+	.byte	0x10
+	.long	.LASF2154
+	.byte	0x14
+	.long	.LASF2155
+	.byte	0x4
+	.long	.LASF2156
+	.byte	0x3
+	.long	.LASF2157
+	.byte	0x1
+	.long	.LASF2158
+	.byte	0x3
+	.long	.LASF2159
+	.byte	0x5
+	.long	.LASF2160
+	.byte	0x5
+	.long	.LASF2161
+	.byte	0x6
+	.long	.LASF2162
+	.byte	0x6
+	.long	.LASF2163
+	.byte	0x6
+	.long	.LASF2164
+	.byte	0x6
+	.long	.LASF2165
+	.byte	0x6
+	.long	.LASF2166
+	.byte	0x9
+	.long	.LASF2167
+	.byte	0x7
+	.long	.LASF2168
+	.byte	0x7
+	.long	.LASF2169
+	.byte	0x8
+	.long	.LASF2170
+	.byte	0xb
+	.long	.LASF2171
+	.byte	0x6
+	.long	.LASF2172
+	.byte	0x13
+	.long	.LASF2173
+	.byte	0x3
+	.long	.LASF2174
+	.byte	0x4
+	.long	.LASF2175
+	.byte	0x1
+	.long	.LASF2176
+	.byte	0x8
+	.long	.LASF2177
+	.byte	0xa
+	.long	.LASF2156
+	.byte	0x5
+	.long	.LASF2178
+	.byte	0x13
+	.long	.LASF2179
+	.byte	0x14
+	.long	.LASF2180
+	.byte	0x14
+	.long	.LASF2180
+	.byte	0x13
+	.long	.LASF2181
+	.byte	0x10
+	.long	.LASF2182
+	.byte	0x13
+	.long	.LASF2183
+	.byte	0x13
+	.long	.LASF2184
+	.byte	0x10
+	.long	.LASF2185
+	.byte	0x10
+	.long	.LASF2186
+	.byte	0x12
+	.long	.LASF2187
+	.byte	0x10
+	.long	.LASF2188
+	.byte	0x11
+	.long	.LASF2189
+	.byte	0x11
+	.long	.LASF2190
+	.byte	0x10
+	.long	.LASF2191
+	.byte	0x10
+	.long	.LASF2192
+	.byte	0x10
+	.long	.LASF2193
+	.byte	0xf
+	.long	.LASF2194
+	.byte	0xf
+	.long	.LASF2195
+	.byte	0x13
+	.long	.LASF2196
+	.byte	0xe
+	.long	.LASF2197
+	.byte	0xd
+	.long	.LASF2198
+	.byte	0xc
+	.long	.LASF2199
+	.byte	0xd
+	.long	.LASF2200
+	.byte	0xd
+	.long	.LASF2201
+	.byte	0x2
+	.long	.LASF2202
+	.byte	0x3
+	.long	.LASF2203
+	.byte	0x4
+	.long	.LASF2204
+	.byte	0x5
+	.long	.LASF2205
+	.byte	0x5
+	.long	.LASF2206
+	.byte	0x6
+	.long	.LASF2207
+	.byte	0x3
+	.long	.LASF2208
+	.byte	0x6
+	.long	.LASF2209
+	.byte	0x3
+	.long	.LASF2210
+	.byte	0x3
+	.long	.LASF2211
+	.byte	0x13
+	.long	.LASF2212
+	.byte	0x10
+	.long	.LASF2213
+	.byte	0x10
+	.long	.LASF2214
+	.byte	0x10
+	.long	.LASF2215
+	.byte	0x10
+	.long	.LASF2216
+	.byte	0x10
+	.long	.LASF2217
+	.byte	0x10
+	.long	.LASF2218
+	.byte	0x10
+	.long	.LASF2219
+	.byte	0x10
+	.long	.LASF2220
+	.byte	0x10
+	.long	.LASF2221
+	.byte	0x7
+	.long	.LASF2222
+	.byte	0x8
+	.long	.LASF2223
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2003:
+	.string	"auto_disarm_delay"
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1190:
+	.string	"__DECL_SIMD_logf "
+.LASF1914:
+	.string	"ADJUSTMENT_MANUAL_RC_YAW_EXPO"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1022:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1966:
+	.string	"adjustmentState_s"
+.LASF1969:
+	.string	"adjustmentState_t"
+.LASF1526:
+	.string	"FP_ZERO 2"
+.LASF858:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2061:
+	.string	"PID_VEL_Z"
+.LASF1625:
+	.string	"MIDRC_MIN 1200"
+.LASF1831:
+	.string	"THROTTLE"
+.LASF1139:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2004:
+	.string	"braking_speed_threshold"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1804:
+	.string	"FEATURE_TRANSPONDER"
+.LASF972:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF1163:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1135:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF1854:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1778:
+	.string	"ADC_BATTERY"
+.LASF1129:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1583:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1363:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2020:
+	.string	"max_throttle"
+.LASF1078:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1258:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF932:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1303:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1419:
+	.string	"__DECL_SIMD_tan "
+.LASF1992:
+	.string	"land_slowdown_maxalt"
+.LASF1404:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1873:
+	.string	"BOXCAMERA1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1664:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2057:
+	.string	"PID_VEL_XY"
+.LASF1866:
+	.string	"BOXGCSNAV"
+.LASF1761:
+	.string	"vTable"
+.LASF971:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1715:
+	.string	"_Bool"
+.LASF1970:
+	.string	"adjustmentRanges_SystemArray"
+.LASF1325:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2130:
+	.string	"resetAdjustmentStates"
+.LASF1158:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1475:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1720:
+	.string	"currentTimeUs"
+.LASF1468:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1367:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1209:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1295:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1347:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1124:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1935:
+	.string	"ADJUSTMENT_VEL_XY_D"
+.LASF1570:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1879:
+	.string	"BOXNAVCRUISE"
+.LASF1934:
+	.string	"ADJUSTMENT_VEL_XY_I"
+.LASF1046:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1933:
+	.string	"ADJUSTMENT_VEL_XY_P"
+.LASF1752:
+	.string	"frequency"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1634:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1264:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1452:
+	.string	"__f32x(x) x ##f32x"
+.LASF1881:
+	.string	"BOXUSER1"
+.LASF1882:
+	.string	"BOXUSER2"
+.LASF1296:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1204:
+	.string	"__DECL_SIMD_expf64 "
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF985:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1618:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1152:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF1370:
+	.string	"__DECL_SIMD_acoshf "
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1945:
+	.string	"adjustmentStepConfig_s"
+.LASF1947:
+	.string	"adjustmentStepConfig_t"
+.LASF1175:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1742:
+	.string	"bandCount"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF959:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1301:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1532:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1036:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1946:
+	.string	"step"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1757:
+	.string	"channelName"
+.LASF1144:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1793:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1677:
+	.string	"uint16_t"
+.LASF1201:
+	.string	"__DECL_SIMD_expl "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1536:
+	.string	"MATH_ERREXCEPT 2"
+.LASF373:
+	.string	"linux 1"
+.LASF981:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1912:
+	.string	"ADJUSTMENT_RC_YAW_EXPO"
+.LASF2019:
+	.string	"min_throttle"
+.LASF2070:
+	.string	"pitModeChan"
+.LASF2078:
+	.string	"yawDeciDegrees"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1107:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF2092:
+	.string	"vtxCommonDevice"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF944:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF1531:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2047:
+	.string	"hasFlaps"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1994:
+	.string	"rth_altitude"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2037:
+	.string	"allow_manual_thr_increase"
+.LASF2043:
+	.string	"navConfig_System"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1629:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF2017:
+	.string	"cruise_speed"
+.LASF1057:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1039:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1141:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1424:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF1999:
+	.string	"rth_home_offset_distance"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2035:
+	.string	"launch_max_angle"
+.LASF2068:
+	.string	"vtxSettingsConfig_s"
+.LASF2073:
+	.string	"vtxSettingsConfig_t"
+.LASF1603:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1818:
+	.string	"fixedWingTauMs"
+.LASF1410:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1123:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1223:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2008:
+	.string	"braking_boost_timeout"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1971:
+	.string	"adjustmentRanges_CopyArray"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF1822:
+	.string	"controlRateConfig_s"
+.LASF1827:
+	.string	"controlRateConfig_t"
+.LASF1192:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1582:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1442:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1453:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1651:
+	.string	"RC_ADJUSTMENT_EXPO_MAX 100"
+.LASF2046:
+	.string	"platformType"
+.LASF1248:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2038:
+	.string	"useFwNavYawControl"
+.LASF2054:
+	.string	"PID_YAW"
+.LASF1878:
+	.string	"BOXOSDALT3"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1191:
+	.string	"__DECL_SIMD_logl "
+.LASF1465:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1624:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1428:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1021:
+	.string	"BIT(x) (1 << (x))"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2058:
+	.string	"PID_SURFACE"
+.LASF1949:
+	.string	"switchPositions"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1409:
+	.string	"__DECL_SIMD_erfc "
+.LASF1998:
+	.string	"max_terrain_follow_altitude"
+.LASF1274:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1041:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1483:
+	.string	"_Mdouble_"
+.LASF1675:
+	.string	"int32_t"
+.LASF1653:
+	.string	"RC_ADJUSTMENT_MANUAL_RATE_MAX 100"
+.LASF1431:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1621:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF1747:
+	.string	"powerNames"
+.LASF1529:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1887:
+	.string	"channelRange_s"
+.LASF1890:
+	.string	"channelRange_t"
+.LASF2023:
+	.string	"land_dive_angle"
+.LASF1383:
+	.string	"__DECL_SIMD_erff32 "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1142:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1127:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF984:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1048:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1265:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1384:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2051:
+	.string	"mixerConfig_System"
+.LASF1803:
+	.string	"FEATURE_UNUSED_10"
+.LASF1810:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1297:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1640:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1657:
+	.string	"RESET_FREQUENCY_2HZ (1000 / 2)"
+.LASF2096:
+	.string	"beeperConfirmationBeeps"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1171:
+	.string	"__DECL_SIMD_sinl "
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1060:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1484:
+	.string	"__MATH_PRECNAME"
+.LASF1334:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2105:
+	.string	"updateAdjustmentStates"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF1684:
+	.string	"PGR_SIZE_MASK"
+.LASF1961:
+	.string	"range"
+.LASF1494:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1516:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1266:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1938:
+	.string	"ADJUSTMENT_VEL_Z_D"
+.LASF1487:
+	.string	"_Mdouble_ float"
+.LASF1937:
+	.string	"ADJUSTMENT_VEL_Z_I"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1936:
+	.string	"ADJUSTMENT_VEL_Z_P"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1471:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF999:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1771:
+	.string	"getBandAndChannel"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1371:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1981:
+	.string	"rth_climb_ignore_emerg"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1227:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1918:
+	.string	"ADJUSTMENT_MANUAL_YAW_RATE"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1157:
+	.string	"_MATH_H 1"
+.LASF1922:
+	.string	"ADJUSTMENT_PITCH_BOARD_ALIGNMENT"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1505:
+	.string	"__MATHDECL_1"
+.LASF1577:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2100:
+	.string	"index"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF396:
+	.string	"false 0"
+.LASF1380:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1823:
+	.string	"throttle"
+.LASF946:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1441:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF987:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1541:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1846:
+	.string	"BOXHORIZON"
+.LASF1323:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1889:
+	.string	"endStep"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2027:
+	.string	"launch_idle_throttle"
+.LASF948:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1916:
+	.string	"ADJUSTMENT_MANUAL_ROLL_RATE"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1984:
+	.string	"waypoint_radius"
+.LASF1369:
+	.string	"__DECL_SIMD_acosh "
+.LASF1588:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1259:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1277:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1607:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1514:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF1479:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2048:
+	.string	"appliedMixerPreset"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2015:
+	.string	"max_dive_angle"
+.LASF1016:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1694:
+	.string	"timeUs_t"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF935:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1784:
+	.string	"FEATURE_VBAT"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1436:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1115:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF996:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1902:
+	.string	"ADJUSTMENT_YAW_D"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1901:
+	.string	"ADJUSTMENT_YAW_I"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1766:
+	.string	"getDeviceType"
+.LASF1284:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1072:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1005:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1130:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1591:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2009:
+	.string	"braking_boost_speed_threshold"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1087:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1218:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1816:
+	.string	"dynPID"
+.LASF2021:
+	.string	"pitch_to_throttle"
+.LASF1608:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1642:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1635:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF938:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF892:
+	.string	"USE_VCP"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1619:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1665:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1772:
+	.string	"getPowerIndex"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1605:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1667:
+	.string	"__uint16_t"
+.LASF1456:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1988:
+	.string	"max_manual_speed"
+.LASF1711:
+	.string	"adjustmentFunction"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1820:
+	.string	"rates"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1438:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1330:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1802:
+	.string	"FEATURE_BLACKBOX"
+.LASF1077:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1255:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1427:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1616:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1232:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1931:
+	.string	"ADJUSTMENT_POS_Z_D"
+.LASF992:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1056:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1734:
+	.string	"VTXDEV_UNSUPPORTED"
+.LASF1930:
+	.string	"ADJUSTMENT_POS_Z_I"
+.LASF1957:
+	.string	"mode"
+.LASF1735:
+	.string	"VTXDEV_RTC6705"
+.LASF1522:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1382:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1360:
+	.string	"__DECL_SIMD_atanhf "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1089:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1215:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1256:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2128:
+	.string	"_index"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1638:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF967:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1273:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF1549:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1814:
+	.string	"rcMid8"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1010:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1729:
+	.string	"imuError"
+.LASF1510:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1518:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF1658:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1612:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1787:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1462:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1098:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1125:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1726:
+	.string	"flightMode"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1960:
+	.string	"adjustmentRange_s"
+.LASF1965:
+	.string	"adjustmentRange_t"
+.LASF1819:
+	.string	"rcYawExpo8"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF741:
+	.string	"USE_NAV "
+.LASF2091:
+	.string	"updateBoardAlignment"
+.LASF358:
+	.string	"__k8 1"
+.LASF1617:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1045:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1716:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1040:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1844:
+	.string	"BOXARM"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1821:
+	.string	"fpvCamAngleDegrees"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1507:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1880:
+	.string	"BOXBRAKING"
+.LASF1381:
+	.string	"__DECL_SIMD_erfl "
+.LASF1573:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1242:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2036:
+	.string	"cruise_yaw_rate"
+.LASF2085:
+	.string	"isRangeActive"
+.LASF1702:
+	.string	"pgRegistry_s"
+.LASF1692:
+	.string	"pgRegistry_t"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2111:
+	.string	"delta"
+.LASF1789:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1765:
+	.string	"process"
+.LASF2120:
+	.string	"blackboxLogInflightAdjustmentEvent"
+.LASF1546:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1080:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1338:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1263:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1978:
+	.string	"rth_tail_first"
+.LASF968:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1307:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1855:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF374:
+	.string	"__unix 1"
+.LASF1686:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF739:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1413:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF956:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1832:
+	.string	"AUX1"
+.LASF1833:
+	.string	"AUX2"
+.LASF1834:
+	.string	"AUX3"
+.LASF1835:
+	.string	"AUX4"
+.LASF1788:
+	.string	"FEATURE_UNUSED_1"
+.LASF1837:
+	.string	"AUX6"
+.LASF1679:
+	.string	"uint64_t"
+.LASF1792:
+	.string	"FEATURE_UNUSED_4"
+.LASF1796:
+	.string	"FEATURE_UNUSED_5"
+.LASF1797:
+	.string	"FEATURE_UNUSED_6"
+.LASF1801:
+	.string	"FEATURE_UNUSED_7"
+.LASF1808:
+	.string	"FEATURE_UNUSED_8"
+.LASF1809:
+	.string	"FEATURE_UNUSED_9"
+.LASF2118:
+	.string	"high"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1491:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1528:
+	.string	"FP_NORMAL 4"
+.LASF1071:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2007:
+	.string	"braking_boost_factor"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1722:
+	.string	"flightLogEvent_IMUError_s"
+.LASF1637:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1254:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1147:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1954:
+	.string	"selectConfig"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2108:
+	.string	"signedDiff"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1289:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1361:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1378:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1632:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1353:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2107:
+	.string	"controlRateConfig"
+.LASF1891:
+	.string	"ADJUSTMENT_NONE"
+.LASF1181:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1412:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1807:
+	.string	"FEATURE_VTX"
+.LASF1097:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1329:
+	.string	"__DECL_SIMD_log10 "
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF1654:
+	.string	"RC_ADJUSTMENT_PID_MIN 0"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1682:
+	.string	"PGR_PGN_MASK"
+.LASF1001:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1481:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1740:
+	.string	"vtxDevType_e"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2005:
+	.string	"braking_disengage_speed"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF978:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1168:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1331:
+	.string	"__DECL_SIMD_log10l "
+.LASF1572:
+	.string	"HDOP_SCALE (100)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1592:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1852:
+	.string	"BOXNAVRTH"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF2084:
+	.string	"adjustmentStates"
+.LASF1208:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1980:
+	.string	"rth_allow_landing"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF991:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1354:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1444:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1159:
+	.string	"__DECL_SIMD_cos "
+.LASF1693:
+	.string	"timeMs_t"
+.LASF1535:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1626:
+	.string	"MIDRC_MAX 1700"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1589:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2011:
+	.string	"braking_bank_angle"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1318:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2026:
+	.string	"launch_time_thresh"
+.LASF2095:
+	.string	"schedulePidGainsUpdate"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1337:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1120:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF1240:
+	.string	"__DECL_SIMD_asinf "
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF1688:
+	.string	"size"
+.LASF1737:
+	.string	"VTXDEV_TRAMP"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1899:
+	.string	"ADJUSTMENT_PITCH_ROLL_D"
+.LASF1118:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1278:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1898:
+	.string	"ADJUSTMENT_PITCH_ROLL_I"
+.LASF1754:
+	.string	"powerMilliwatt"
+.LASF1032:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1511:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1897:
+	.string	"ADJUSTMENT_PITCH_ROLL_P"
+.LASF1482:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1495:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1079:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1136:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1364:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1744:
+	.string	"powerCount"
+.LASF1160:
+	.string	"__DECL_SIMD_cosf "
+.LASF1631:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1885:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1111:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF1304:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1800:
+	.string	"FEATURE_DASHBOARD"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1718:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF1721:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF997:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1545:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1680:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1630:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1648:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_READY(adjustmentIndex) adjustmentStateMask &= ~(1 << adjustmentIndex)"
+.LASF1929:
+	.string	"ADJUSTMENT_POS_Z_P"
+.LASF1687:
+	.string	"pgResetFunc"
+.LASF1724:
+	.string	"flightLogEvent_IMUError_t"
+.LASF1185:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1676:
+	.string	"uint8_t"
+.LASF1390:
+	.string	"__DECL_SIMD_tanhf "
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1610:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1496:
+	.string	"_Mdouble_ _Float64"
+.LASF1485:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1237:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1018:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1973:
+	.string	"use_thr_mid_for_althold"
+.LASF1585:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1065:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1614:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1417:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1379:
+	.string	"__DECL_SIMD_erf "
+.LASF1830:
+	.string	"PITCH"
+.LASF1853:
+	.string	"BOXNAVPOSHOLD"
+.LASF891:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2053:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1286:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1948:
+	.string	"adjustmentSelectConfig_s"
+.LASF1950:
+	.string	"adjustmentSelectConfig_t"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1226:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1869:
+	.string	"BOXFLAPERON"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF376:
+	.string	"unix 1"
+.LASF1525:
+	.string	"FP_INFINITE 1"
+.LASF1515:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1279:
+	.string	"__DECL_SIMD_cosh "
+.LASF1517:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1169:
+	.string	"__DECL_SIMD_sin "
+.LASF2071:
+	.string	"lowPowerDisarm"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF1182:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1435:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF1775:
+	.string	"getPower"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1133:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1990:
+	.string	"land_descent_rate"
+.LASF939:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF1212:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1732:
+	.string	"FD_PITCH"
+.LASF1243:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1460:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1641:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1486:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1499:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1565:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF2127:
+	.string	"adjustmentRanges"
+.LASF1366:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1762:
+	.string	"capability"
+.LASF1031:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1646:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1165:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1262:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1894:
+	.string	"ADJUSTMENT_THROTTLE_EXPO"
+.LASF1446:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1406:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1706:
+	.string	"flightLogEvent_flightMode_s"
+.LASF1709:
+	.string	"flightLogEvent_flightMode_t"
+.LASF1197:
+	.string	"__DECL_SIMD_logf64x "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1613:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2000:
+	.string	"rth_home_offset_direction"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1094:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1615:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF953:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF943:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1870:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1315:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2062:
+	.string	"PID_POS_HEADING"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1195:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1785:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1403:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1356:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2059:
+	.string	"PID_LEVEL"
+.LASF1030:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF1563:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1294:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1121:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF1063:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1199:
+	.string	"__DECL_SIMD_exp "
+.LASF2129:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1090:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1372:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1490:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1602:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1697:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2121:
+	.string	"eventData"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1671:
+	.string	"__uint64_t"
+.LASF998:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2102:
+	.string	"adjustmentRange"
+.LASF1324:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1470:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1069:
+	.string	"PG_CF_END 56"
+.LASF2089:
+	.string	"vtxCommonGetDeviceCapability"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1423:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1623:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1420:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1904:
+	.string	"ADJUSTMENT_PITCH_RATE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1578:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1524:
+	.string	"FP_NAN 0"
+.LASF1313:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1689:
+	.string	"address"
+.LASF1004:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1497:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1941:
+	.string	"ADJUSTMENT_FUNCTION_COUNT"
+.LASF1319:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1161:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1848:
+	.string	"BOXHEADINGHOLD"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1473:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF952:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1650:
+	.string	"RC_ADJUSTMENT_EXPO_MIN 0"
+.LASF719:
+	.string	"NULL"
+.LASF966:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1101:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1321:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1247:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1911:
+	.string	"ADJUSTMENT_ROLL_D"
+.LASF1871:
+	.string	"BOXAUTOTRIM"
+.LASF1921:
+	.string	"ADJUSTMENT_ROLL_BOARD_ALIGNMENT"
+.LASF1910:
+	.string	"ADJUSTMENT_ROLL_I"
+.LASF1909:
+	.string	"ADJUSTMENT_ROLL_P"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1751:
+	.string	"channel"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1905:
+	.string	"ADJUSTMENT_ROLL_RATE"
+.LASF466:
+	.string	"__PMT"
+.LASF1357:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1013:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1000:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1701:
+	.string	"FlightLogEvent"
+.LASF1239:
+	.string	"__DECL_SIMD_asin "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1769:
+	.string	"setPowerByIndex"
+.LASF1006:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1086:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2001:
+	.string	"max_bank_angle"
+.LASF1770:
+	.string	"setPitMode"
+.LASF1416:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1340:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2013:
+	.string	"posResponseExpo"
+.LASF1502:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1389:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1595:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1730:
+	.string	"flightLogEventData_t"
+.LASF1951:
+	.string	"flightLogEventData_u"
+.LASF1633:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1685:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1527:
+	.string	"FP_SUBNORMAL 3"
+.LASF1963:
+	.string	"auxSwitchChannelIndex"
+.LASF1432:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1394:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1365:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1845:
+	.string	"BOXANGLE"
+.LASF1703:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF1705:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2110:
+	.string	"channelIndex"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2028:
+	.string	"launch_throttle"
+.LASF2014:
+	.string	"max_climb_angle"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1012:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1774:
+	.string	"getFrequency"
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF2088:
+	.string	"feature"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1987:
+	.string	"max_auto_climb_rate"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2022:
+	.string	"loiter_radius"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1104:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1780:
+	.string	"ADC_CURRENT"
+.LASF1241:
+	.string	"__DECL_SIMD_asinl "
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF1584:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1137:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF1728:
+	.string	"loggingResume"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1283:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1067:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1755:
+	.string	"bandLetter"
+.LASF1448:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1986:
+	.string	"max_auto_speed"
+.LASF960:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF940:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF933:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1712:
+	.string	"floatFlag"
+.LASF2086:
+	.string	"memset"
+.LASF1498:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1408:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1355:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2010:
+	.string	"braking_boost_disengage_speed"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF1673:
+	.string	"int8_t"
+.LASF1908:
+	.string	"ADJUSTMENT_PITCH_D"
+.LASF1076:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1566:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1907:
+	.string	"ADJUSTMENT_PITCH_I"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1906:
+	.string	"ADJUSTMENT_PITCH_P"
+.LASF1351:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1736:
+	.string	"VTXDEV_SMARTAUDIO"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1035:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1183:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1519:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1128:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1305:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1723:
+	.string	"errorCode"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1779:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1300:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1074:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1245:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1975:
+	.string	"user_control_mode"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1344:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1575:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1229:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1506:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2016:
+	.string	"cruise_throttle"
+.LASF1580:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1691:
+	.string	"reset"
+.LASF1285:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF994:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1252:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1007:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1996:
+	.string	"min_rth_distance"
+.LASF1246:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1552:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF961:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1433:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1421:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF785:
+	.string	"USE_LOG "
+.LASF787:
+	.string	"USE_CMS "
+.LASF1976:
+	.string	"rth_alt_control_mode"
+.LASF1674:
+	.string	"int16_t"
+.LASF1375:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1542:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1659:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2077:
+	.string	"pitchDeciDegrees"
+.LASF1662:
+	.string	"signed char"
+.LASF1449:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2045:
+	.string	"motorDirectionInverted"
+.LASF1177:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF1841:
+	.string	"AUX10"
+.LASF1842:
+	.string	"AUX11"
+.LASF1843:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1154:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF2113:
+	.string	"applyStepAdjustment"
+.LASF1476:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1708:
+	.string	"lastFlags"
+.LASF1298:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF974:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2025:
+	.string	"launch_accel_thresh"
+.LASF1806:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1798:
+	.string	"FEATURE_RSSI_ADC"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1377:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF970:
+	.string	"sq(x) ((x)*(x))"
+.LASF1173:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1345:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1824:
+	.string	"stabilized"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1198:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1886:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1451:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2075:
+	.string	"boardAlignment_s"
+.LASF2079:
+	.string	"boardAlignment_t"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1567:
+	.string	"LAT 0"
+.LASF1553:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1628:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1851:
+	.string	"BOXCAMSTAB"
+.LASF1388:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1739:
+	.string	"VTXDEV_UNKNOWN"
+.LASF1341:
+	.string	"__DECL_SIMD_log2l "
+.LASF1105:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2072:
+	.string	"maxPowerOverride"
+.LASF1731:
+	.string	"FD_ROLL"
+.LASF1052:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1597:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1440:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF2119:
+	.string	"applyAdjustmentU8"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF1251:
+	.string	"__DECL_SIMD_hypotl "
+.LASF1942:
+	.string	"adjustmentFunction_e"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1864:
+	.string	"BOXAIRMODE"
+.LASF2076:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1492:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1358:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1767:
+	.string	"isReady"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF934:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1402:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1977:
+	.string	"rth_climb_first"
+.LASF1537:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2122:
+	.string	"configureAdjustment"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1234:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1683:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1044:
+	.string	"PG_PID_PROFILE 14"
+.LASF1317:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2039:
+	.string	"yawControlDeadband"
+.LASF1791:
+	.string	"FEATURE_UNUSED_3"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1849:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1544:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1066:
+	.string	"PG_VTX_CONFIG 54"
+.LASF958:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1593:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1461:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1073:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2115:
+	.string	"applyAdjustmentManualRate"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1186:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1489:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1096:
+	.string	"PG_INAV_END 1023"
+.LASF1995:
+	.string	"rth_home_altitude"
+.LASF1189:
+	.string	"__DECL_SIMD_log "
+.LASF1027:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF936:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1862:
+	.string	"BOXFAILSAFE"
+.LASF1430:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1794:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1312:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1179:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1202:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1292:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1153:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1746:
+	.string	"channelNames"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1558:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1812:
+	.string	"FEATURE_OSD"
+.LASF1690:
+	.string	"copy"
+.LASF1576:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF1943:
+	.string	"ADJUSTMENT_MODE_STEP"
+.LASF1704:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF2074:
+	.string	"vtxSettingsConfig_System"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1439:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1884:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1233:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1644:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF954:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1108:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1956:
+	.string	"adjustmentConfig_s"
+.LASF1959:
+	.string	"adjustmentConfig_t"
+.LASF1952:
+	.string	"adjustmentConfig_u"
+.LASF1733:
+	.string	"FD_YAW"
+.LASF1670:
+	.string	"long int"
+.LASF1874:
+	.string	"BOXCAMERA2"
+.LASF1875:
+	.string	"BOXCAMERA3"
+.LASF1193:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1049:
+	.string	"PG_SERVO_MIXER 21"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1342:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1106:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF957:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1768:
+	.string	"setBandAndChannel"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF1805:
+	.string	"FEATURE_AIRMODE"
+.LASF1291:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2083:
+	.string	"defaultAdjustmentConfigs"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2034:
+	.string	"launch_climb_angle"
+.LASF976:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1562:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1859:
+	.string	"BOXOSD"
+.LASF1213:
+	.string	"__DECL_SIMD_powf32 "
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1155:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF1955:
+	.string	"adjustmentData_t"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1020:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2055:
+	.string	"PID_POS_Z"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1306:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1184:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1474:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1564:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1560:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1008:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1993:
+	.string	"emerg_descent_rate"
+.LASF1309:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1939:
+	.string	"ADJUSTMENT_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1017:
+	.string	"EXPAND_I(x) x"
+.LASF1548:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1224:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1480:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1678:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1434:
+	.string	"__f128(x) x ##f128"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF1138:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF1656:
+	.string	"ADJUSTMENT_FUNCTION_CONFIG_INDEX_OFFSET 1"
+.LASF2097:
+	.string	"rxGetChannelValue"
+.LASF1454:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1547:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1339:
+	.string	"__DECL_SIMD_log2 "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1003:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF914:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1327:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1895:
+	.string	"ADJUSTMENT_PITCH_ROLL_RATE"
+.LASF1738:
+	.string	"VTXDEV_FFPV"
+.LASF2098:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1847:
+	.string	"BOXNAVALTHOLD"
+.LASF1455:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1509:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1146:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1047:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1368:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2123:
+	.string	"boardAlignment"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1270:
+	.string	"__DECL_SIMD_exp10f "
+.LASF2106:
+	.string	"processRcAdjustments"
+.LASF1053:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1457:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1861:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1661:
+	.string	"long unsigned int"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1543:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1850:
+	.string	"BOXHEADADJ"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1896:
+	.string	"ADJUSTMENT_YAW_RATE"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF951:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF1281:
+	.string	"__DECL_SIMD_coshl "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF1760:
+	.string	"vtxDevice_s"
+.LASF1777:
+	.string	"vtxDevice_t"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1178:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2109:
+	.string	"canResetReadyStates"
+.LASF1868:
+	.string	"BOXSURFACE"
+.LASF2069:
+	.string	"power"
+.LASF1350:
+	.string	"__DECL_SIMD_log1pf "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1112:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF2126:
+	.string	"navConfigMutable"
+.LASF1034:
+	.string	"PG_CF_START 1"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1645:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1857:
+	.string	"BOXLIGHTS"
+.LASF1672:
+	.string	"char"
+.LASF1512:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1335:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1815:
+	.string	"rcExpo8"
+.LASF1917:
+	.string	"ADJUSTMENT_MANUAL_PITCH_RATE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1397:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1858:
+	.string	"BOXNAVLAUNCH"
+.LASF1395:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1443:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1786:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF983:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1332:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1913:
+	.string	"ADJUSTMENT_MANUAL_RC_EXPO"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1249:
+	.string	"__DECL_SIMD_hypot "
+.LASF1813:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1587:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1205:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1776:
+	.string	"getOsdInfo"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1164:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1336:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1228:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1099:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1203:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1713:
+	.string	"newValue"
+.LASF993:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1009:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1116:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF395:
+	.string	"true 1"
+.LASF1091:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1166:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1082:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1151:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1647:
+	.string	"MARK_ADJUSTMENT_FUNCTION_AS_BUSY(adjustmentIndex) adjustmentStateMask |= (1 << adjustmentIndex)"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1220:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1206:
+	.string	"__DECL_SIMD_expf32x "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF989:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1023:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1829:
+	.string	"ROLL"
+.LASF1362:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF1991:
+	.string	"land_slowdown_minalt"
+.LASF2117:
+	.string	"applyAdjustmentU16"
+.LASF1308:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF969:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2101:
+	.string	"canUseRxData"
+.LASF1200:
+	.string	"__DECL_SIMD_expf "
+.LASF1652:
+	.string	"RC_ADJUSTMENT_MANUAL_RATE_MIN 0"
+.LASF1207:
+	.string	"__DECL_SIMD_expf64x "
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1058:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2052:
+	.string	"PID_ROLL"
+.LASF1415:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1244:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1764:
+	.string	"vtxVTable_s"
+.LASF1437:
+	.string	"__HAVE_FLOAT16 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1400:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1143:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1376:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1015:
+	.string	"STR_HELPER(x) #x"
+.LASF1710:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF1717:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1989:
+	.string	"max_manual_climb_rate"
+.LASF1062:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF955:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2006:
+	.string	"braking_timeout"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1594:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1750:
+	.string	"band"
+.LASF1534:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1267:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1426:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1932:
+	.string	"ADJUSTMENT_HEADING_P"
+.LASF1425:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1126:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1521:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1346:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1554:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1773:
+	.string	"getPitMode"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF1749:
+	.string	"vtxDeviceOsdInfo_s"
+.LASF1759:
+	.string	"vtxDeviceOsdInfo_t"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1326:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF1282:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1540:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2024:
+	.string	"launch_velocity_thresh"
+.LASF1967:
+	.string	"config"
+.LASF1464:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2124:
+	.string	"vtxSettingsConfigMutable"
+.LASF980:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1148:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF1472:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1903:
+	.string	"ADJUSTMENT_RATE_PROFILE"
+.LASF2056:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1997:
+	.string	"rth_abort_threshold"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1109:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF1414:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1520:
+	.string	"__MATHCALL_NARROW"
+.LASF962:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1102:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1219:
+	.string	"__DECL_SIMD_acos "
+.LASF1860:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1763:
+	.string	"pitMode"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1655:
+	.string	"RC_ADJUSTMENT_PID_MAX 200"
+.LASF1290:
+	.string	"__DECL_SIMD_expm1f "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF941:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1196:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2018:
+	.string	"control_smoothness"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1699:
+	.string	"FLIGHT_LOG_EVENT_IMU_FAILURE"
+.LASF1982:
+	.string	"auto_overrides_motor_stop"
+.LASF1714:
+	.string	"newFloatValue"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1538:
+	.string	"M_E 2.7182818284590452354"
+.LASF1501:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2040:
+	.string	"navConfig_s"
+.LASF2042:
+	.string	"navConfig_t"
+.LASF2112:
+	.string	"vtxDeviceCapability"
+.LASF1551:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1972:
+	.string	"double"
+.LASF1238:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF1401:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1222:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1968:
+	.string	"timeoutAt"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1458:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1581:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1979:
+	.string	"disarm_on_landing"
+.LASF1478:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2103:
+	.string	"adjustmentConfig"
+.LASF1559:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1026:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1888:
+	.string	"startStep"
+.LASF1392:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1600:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1037:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1396:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1110:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1828:
+	.string	"rc_alias"
+.LASF1134:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1132:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1790:
+	.string	"FEATURE_GPS"
+.LASF947:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2116:
+	.string	"applyAdjustmentExpo"
+.LASF1598:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1149:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF1867:
+	.string	"BOXKILLSWITCH"
+.LASF1668:
+	.string	"__int32_t"
+.LASF1466:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1533:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1669:
+	.string	"__uint32_t"
+.LASF1230:
+	.string	"__DECL_SIMD_atanf "
+.LASF2080:
+	.string	"boardAlignment_System"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1407:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1958:
+	.string	"data"
+.LASF1983:
+	.string	"pos_failure_timeout"
+.LASF1799:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1050:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1373:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1698:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF1985:
+	.string	"waypoint_safe_distance"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1268:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1293:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1221:
+	.string	"__DECL_SIMD_acosl "
+.LASF1051:
+	.string	"PG_RX_CONFIG 24"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1557:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1459:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1399:
+	.string	"__DECL_SIMD_asinh "
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF963:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1210:
+	.string	"__DECL_SIMD_powf "
+.LASF1477:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF1019:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1216:
+	.string	"__DECL_SIMD_powf32x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF2049:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF1928:
+	.string	"ADJUSTMENT_POS_XY_D"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1927:
+	.string	"ADJUSTMENT_POS_XY_I"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1926:
+	.string	"ADJUSTMENT_POS_XY_P"
+.LASF1925:
+	.string	"ADJUSTMENT_LEVEL_D"
+.LASF1611:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1924:
+	.string	"ADJUSTMENT_LEVEL_I"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1508:
+	.string	"__MATHCALL"
+.LASF1333:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1092:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1923:
+	.string	"ADJUSTMENT_LEVEL_P"
+.LASF1795:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1054:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF786:
+	.string	"USE_STATS "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1083:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1500:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1872:
+	.string	"BOXAUTOTUNE"
+.LASF2029:
+	.string	"launch_motor_timer"
+.LASF2090:
+	.string	"blackboxLogEvent"
+.LASF1386:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1359:
+	.string	"__DECL_SIMD_atanh "
+.LASF1172:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1856:
+	.string	"BOXLEDLOW"
+.LASF1836:
+	.string	"AUX5"
+.LASF1467:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1838:
+	.string	"AUX7"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1839:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1840:
+	.string	"AUX9"
+.LASF1095:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1348:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF964:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1745:
+	.string	"bandNames"
+.LASF1450:
+	.string	"__f32(x) x ##f32"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF1556:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1743:
+	.string	"channelCount"
+.LASF975:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1064:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1639:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1883:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1288:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1250:
+	.string	"__DECL_SIMD_hypotf "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2030:
+	.string	"launch_motor_spinup_time"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1235:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1445:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1530:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1387:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1920:
+	.string	"ADJUSTMENT_NAV_FW_PITCH2THR"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1328:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1463:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2033:
+	.string	"launch_max_altitude"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1214:
+	.string	"__DECL_SIMD_powf64 "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1180:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1681:
+	.string	"pgn_t"
+.LASF1488:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1574:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1781:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1620:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1953:
+	.string	"stepConfig"
+.LASF1236:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1568:
+	.string	"LON 1"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF1825:
+	.string	"manual"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1260:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1085:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1176:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1782:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1028:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1579:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF1817:
+	.string	"pa_breakpoint"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2044:
+	.string	"mixerConfig_s"
+.LASF2050:
+	.string	"mixerConfig_t"
+.LASF1429:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1609:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1865:
+	.string	"BOXHOMERESET"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1893:
+	.string	"ADJUSTMENT_RC_EXPO"
+.LASF1561:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1314:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1493:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1038:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2002:
+	.string	"hover_throttle"
+.LASF2104:
+	.string	"adjustmentState"
+.LASF1604:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF2125:
+	.string	"mixerConfigMutable"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1029:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1962:
+	.string	"auxChannelIndex"
+.LASF1287:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2082:
+	.string	"adjustmentStateMask"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1398:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1269:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1343:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1257:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1374:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF995:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1174:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF1024:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1150:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1422:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2114:
+	.string	"applyAdjustmentPID"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1447:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1695:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF1727:
+	.string	"inflightAdjustment"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF1599:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1217:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1167:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1145:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1014:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1964:
+	.string	"adjustmentIndex"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1231:
+	.string	"__DECL_SIMD_atanl "
+.LASF866:
+	.string	"USE_UART8 "
+.LASF1302:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1271:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1002:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1826:
+	.string	"misc"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1915:
+	.string	"ADJUSTMENT_MANUAL_PITCH_ROLL_RATE"
+.LASF394:
+	.string	"bool _Bool"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1275:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1385:
+	.string	"__DECL_SIMD_erff128 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1719:
+	.string	"logIteration"
+.LASF1170:
+	.string	"__DECL_SIMD_sinf "
+.LASF1033:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1103:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF973:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF965:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1310:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1059:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF1211:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1188:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF2094:
+	.string	"navigationUsePIDs"
+.LASF1393:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1783:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF949:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1322:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF988:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1863:
+	.string	"BOXNAVWP"
+.LASF2099:
+	.string	"isAdjustmentFunctionSelected"
+.LASF1596:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1075:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1352:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1122:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF1503:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF2081:
+	.string	"adjustmentRanges_Registry"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1606:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1811:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1571:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF977:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1068:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1974:
+	.string	"extra_arming_safety"
+.LASF1900:
+	.string	"ADJUSTMENT_YAW_P"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF1741:
+	.string	"vtxDeviceCapability_s"
+.LASF1748:
+	.string	"vtxDeviceCapability_t"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1084:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1550:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1272:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1513:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1162:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1590:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1114:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1100:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1569:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF937:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2063:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF979:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF2031:
+	.string	"launch_min_time"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2032:
+	.string	"launch_timeout"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1944:
+	.string	"ADJUSTMENT_MODE_SELECT"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1140:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2093:
+	.string	"pidBankMutable"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1043:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1725:
+	.string	"syncBeep"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1627:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1280:
+	.string	"__DECL_SIMD_coshf "
+.LASF1061:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF986:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1700:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF1113:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF1643:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF982:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1876:
+	.string	"BOXOSDALT1"
+.LASF1877:
+	.string	"BOXOSDALT2"
+.LASF1753:
+	.string	"powerIndex"
+.LASF1119:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1663:
+	.string	"__int8_t"
+.LASF1093:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF1187:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1622:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2012:
+	.string	"posDecelerationTime"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1011:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF942:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF1919:
+	.string	"ADJUSTMENT_NAV_FW_CRUISE_THR"
+.LASF990:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1025:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2066:
+	.string	"pidBank_s"
+.LASF2067:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1316:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2041:
+	.string	"general"
+.LASF1892:
+	.string	"ADJUSTMENT_RC_RATE"
+.LASF1070:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1660:
+	.string	"unsigned int"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF1253:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1081:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1418:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1555:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1523:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1225:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1586:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1320:
+	.string	"__DECL_SIMD_atan2f "
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1391:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1261:
+	.string	"__DECL_SIMD_exp2l "
+.LASF950:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1469:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1666:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2060:
+	.string	"PID_HEADING"
+.LASF1117:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1756:
+	.string	"bandName"
+.LASF1940:
+	.string	"ADJUSTMENT_VTX_POWER_LEVEL"
+.LASF23:
+	.string	"_LP64 1"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1042:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1504:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1649:
+	.string	"IS_ADJUSTMENT_FUNCTION_BUSY(adjustmentIndex) (adjustmentStateMask & (1 << adjustmentIndex))"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1156:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 12"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1411:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1758:
+	.string	"powerIndexLetter"
+.LASF1539:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF1349:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1601:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1276:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1131:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1636:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2087:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF2064:
+	.string	"pid8_s"
+.LASF2065:
+	.string	"pid8_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1299:
+	.string	"__DECL_SIMD_sinh "
+.LASF1707:
+	.string	"flags"
+.LASF1088:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1696:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1194:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1405:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1055:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1311:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2204:
+	.string	"io_types.h"
+.LASF2208:
+	.string	"rc_curves.h"
+.LASF2207:
+	.string	"bitarray.h"
+.LASF2187:
+	.string	"long-double.h"
+.LASF2194:
+	.string	"__locale_t.h"
+.LASF2196:
+	.string	"platform.h"
+.LASF2140:
+	.string	"src/main/rx"
+.LASF2198:
+	.string	"target.h"
+.LASF2205:
+	.string	"rx_pwm.h"
+.LASF2181:
+	.string	"libc-header-start.h"
+.LASF2179:
+	.string	"stdbool.h"
+.LASF2148:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2139:
+	.string	"src/main/navigation"
+.LASF2152:
+	.string	"stdint-intn.h"
+.LASF2163:
+	.string	"rc_controls.h"
+.LASF2158:
+	.string	"axis.h"
+.LASF2147:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2150:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2160:
+	.string	"adc.h"
+.LASF2192:
+	.string	"wchar.h"
+.LASF2131:
+	.string	"src/main/blackbox"
+.LASF2142:
+	.string	"src/main/target/SITL"
+.LASF2176:
+	.string	"beeper.h"
+.LASF2138:
+	.string	"src/main/io"
+.LASF2167:
+	.string	"mixer.h"
+.LASF2168:
+	.string	"pid.h"
+.LASF2146:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2221:
+	.string	"failsafe.h"
+.LASF2161:
+	.string	"config.h"
+.LASF2195:
+	.string	"strings.h"
+.LASF2183:
+	.string	"features-time64.h"
+.LASF2151:
+	.string	"types.h"
+.LASF2212:
+	.string	"math-vector.h"
+.LASF2215:
+	.string	"floatn-common.h"
+.LASF2159:
+	.string	"vtx_common.h"
+.LASF2214:
+	.string	"floatn.h"
+.LASF2185:
+	.string	"timesize.h"
+.LASF2191:
+	.string	"time64.h"
+.LASF2135:
+	.string	"src/main/drivers"
+.LASF2149:
+	.string	"/usr/include"
+.LASF2213:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2132:
+	.string	"src/main/build"
+.LASF2174:
+	.string	"feature.h"
+.LASF2180:
+	.string	"stdint.h"
+.LASF2182:
+	.string	"features.h"
+.LASF2137:
+	.string	"src/main/flight"
+.LASF2190:
+	.string	"typesizes.h"
+.LASF2133:
+	.string	"src/main/common"
+.LASF2175:
+	.string	"blackbox.h"
+.LASF2134:
+	.string	"src/main/config"
+.LASF2166:
+	.string	"navigation.h"
+.LASF2164:
+	.string	"rc_modes.h"
+.LASF2153:
+	.string	"stdint-uintn.h"
+.LASF2143:
+	.string	"src/main/target"
+.LASF2202:
+	.string	"utils.h"
+.LASF2220:
+	.string	"mathcalls.h"
+.LASF2141:
+	.string	"src/main/sensors"
+.LASF1:
+	.string	"/root/repo"
+.LASF2216:
+	.string	"flt-eval-method.h"
+.LASF2144:
+	.string	"src/main"
+.LASF2184:
+	.string	"wordsize.h"
+.LASF2156:
+	.string	"time.h"
+.LASF2203:
+	.string	"parameter_group_ids.h"
+.LASF0:
+	.string	"./src/main/fc/rc_adjustments.c"
+.LASF2171:
+	.string	"rc_adjustments.c"
+.LASF2177:
+	.string	"rx.h"
+.LASF2218:
+	.string	"fp-fast.h"
+.LASF2206:
+	.string	"stats.h"
+.LASF2222:
+	.string	"gps.h"
+.LASF2165:
+	.string	"rc_adjustments.h"
+.LASF2197:
+	.string	"common.h"
+.LASF2219:
+	.string	"mathcalls-helper-functions.h"
+.LASF2211:
+	.string	"math.h"
+.LASF2188:
+	.string	"stubs.h"
+.LASF2170:
+	.string	"boardalignment.h"
+.LASF2173:
+	.string	"maths.h"
+.LASF2217:
+	.string	"fp-logb.h"
+.LASF2172:
+	.string	"string.h"
+.LASF2199:
+	.string	"sanity_check.h"
+.LASF2145:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2193:
+	.string	"locale_t.h"
+.LASF2169:
+	.string	"vtx.h"
+.LASF2201:
+	.string	"build_config.h"
+.LASF2154:
+	.string	"stddef.h"
+.LASF2189:
+	.string	"stubs-64.h"
+.LASF2157:
+	.string	"blackbox_fielddefs.h"
+.LASF2210:
+	.string	"vector.h"
+.LASF2162:
+	.string	"controlrate_profile.h"
+.LASF2223:
+	.string	"runtime_config.h"
+.LASF2136:
+	.string	"src/main/fc"
+.LASF2200:
+	.string	"common_post.h"
+.LASF2186:
+	.string	"cdefs.h"
+.LASF2155:
+	.string	"parameter_group.h"
+.LASF2178:
+	.string	"stdc-predef.h"
+.LASF2209:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\005\006"
+	.string	"\344\b#\001"
+	.string	"\020"
+	.string	"\213\305\305\225\016\f\002"
+	.string	"\001\001\240\342\234\212\n\002\352\263\360\321\b\003\325\311\252\322\006\b\002\001\002\002\002\003\002\002\002\004\002\002\004\264\330\225j"
+	.string	"\005\346\316\313\252\001\004\002\005\006\350\351\374\361\006\004\002\006\007\310\305\203\260\002\b\002\007\001\002\t\f\240\231\272\376\b$\001\002\n\013\001\r\247\265\210\303\b"
+	.string	"\016\361\201\340\331\r\020\002\f"
+	.string	""
+	.string	"\017\020\366\215\366\204\001\021\274\310\212\304\003\004\002\r\002\016\022\312\317\272\227\016\023\240\342\234\212\n"
+	.string	"\025"
+	.string	"\031\026\313k\016A\343\230\267\016\2570\0277\346\013@`\205\301P\356\355<\002\340"
+	.ascii	"\23039;v\371\200q\200\251\203\220\301 r\035\025`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\337\003E\005"
+	.string	"\222\004\r\026\260%\351\f\3030\200\3030\f\203+lhM\023\215\264M\244L)N\365\300\2071\250/x\027\001\252\320<k\237]\021V\275g\364\352dW\333IH\006\0012 \240\002\241\253q\016\222\024r\271\013\265\325u\244\202_\211\221\374\217\372`"
+	.ascii	"\313\024*\202r\0236\025v\2760\344\202\025\034k\3116vk\035\024"
+	.ascii	"\003\bnl\016\243\266\361\2150/\205\026\f\317\205\366\b\200\360"
+	.ascii	"I\341#\360J\241bC\273\202P\007\235j0\271\214\033\270,cm\254\213"
+	.ascii	"\331\344k\030\036P\0240\007\312o\020\307\200@\310dC\n7\004"
+	.text
+	.section	.gnu.lto_.inline.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`W\b\215\027"
+	.string	"\266\235dD\360\222(\215\001-\330\031tm\363\b>\307.\n\341\025r\f\306\033\266\345\215\275\003\24602\2465\023e-\246WS\331\327`\217\217\214\242\341\307\201l\302q\251\001\222\b\342G|+\337\332\377\335O\332\336R\246J"
+	.string	"X"
+	.string	"N"
+	.string	"\277IS\377]\322L=U\217\307\356\216\346|\242\272Q\035\324Y\2744|"
+	.string	"\r\363\017\235<\3755\225v\273\353\t=xJk:\310p\241u=\321\335\335\354S\317\207\213\0243L\357'i\236'\312\263A\302\304\b\323\177\366,\b\373"
+	.string	"\036\035h\214\213\375\320\032\331\243<n\346eG\276\210?b\240"
+	.string	"\201\001\002T\362E,\344\007"
+	.ascii	"\020\002r2\2254\322H\004\372xb'\343\300\247\031!#)+U\364\021"
+	.ascii	"\244I+\350\310\271z*B\304\254x-\266\016)\033\325\2158O\320\341"
+	.ascii	"p\205\355n\347%$'6y\322\013\331 ;)+\337I\341\241\200i\275\216"
+	.ascii	"q\bF\205\260\267\260d\260\273\020\336]\b\227\204#\341b\214k\322"
+	.ascii	"2i\271\\\235K\323\264m\333JJ\366?\2320\327O\220\246\b\242:N\366"
+	.ascii	"\237\013\203\334\016\271ck\315\265\266\273\333n\377\234fh\241"
+	.ascii	"q\001Y\351K\013\215\213\350\222B\250R\0162z\344\020Y[\245+\257"
+	.ascii	"\032\026\230\2420\033nhl\254\177g\312+\021\3031s\340\321?\f\273"
+	.ascii	"\273\"\372\320\213\247\b\306\243JO\264nb\024\254\235R\017 n\210"
+	.ascii	"\200,\331\257\236\016\031\0306\t\340\177\322\f\200\264\250QM"
+	.ascii	"\246\204D$)J\222e\f\260\002\231\"\332\266\001\022\340\263<K\203"
+	.ascii	"\225\021\222\221`\210\244\240N\275\2461\320Q`\215|\021\305\017"
+	.ascii	"\302\353W\254\2015\002SF\203WH\331\321\230\202\215\036\317\332"
+	.ascii	"\177\367\201\204\242\204$\"g\211\227h\004\266\303\314\306f\201"
+	.ascii	"\376Z0E\003\024\277\366t@\023}G\214\035\005\331\345\261.\247"
+	.ascii	"\372\333\305\236\2115\351&\032\224\376~\036\307\003LV\021\276"
+	.ascii	"\361Lb3xNw\227\271x\375\320^P\352\300\207Y\360i0M\234Q_\027\002"
+	.ascii	"Jx\277\037\203 8\241\220|b\225/\324\226\023\201\244\324\036)"
+	.ascii	"\306U\336\306>\222j\310\306E'\r\247\362\0209FO\375h\270a\311"
+	.ascii	"\251\223B\"\220Z\0079b)O\f\224#\264K\334![\223\"e\243i\306\320"
+	.ascii	"v\330\260\240\265\212\241\345$x\313\363\312\310a\\\005\3233\376"
+	.ascii	"\315=\204HG\022\220\266ER6\312EI{\302\216\"\212\035Y\220\221"
+	.ascii	"\310 \223\206\250\376\363H\225\365r\340|K<\206\320\345;1\204"
+	.ascii	"c\336\220#<\222-\035C\r)\341\274<\357\265s\254\317^J\302*\313"
+	.ascii	"\323068\255T\257\273(3N(\n\252?A,C7\037\\\002\216\020\203a\347"
+	.ascii	"x\027\204+\222\364T\215\223\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\357\017\345\027"
+	.string	"\366\033`D\020\257&\215\001"
+	.string	"\223PU\006\356\023I\023\301\275\255\033\206\003 \021"
+	.string	""
+	.string	""
+	.string	"\250\212^\220\226*\250\b\201\216\304\n\342\205\203\217'"
+	.string	"\362\372\177S\341H\377\277M\276\376\037\277\255m\223\350A\321\254${\313$\003A"
+	.string	"K"
+	.string	"^"
+	.ascii	"\333\fV5\343\021f\326u]7\34423BH\322A\372\365\n\3430\3730\253"
+	.ascii	"'\005\205\\\036\365D\322\374\301\356\031\351\232\231C\016\033"
+	.ascii	"r'v\203UH\322\b\322\230\275\276+\323(\340\177y%\bE,\327\\\023"
+	.ascii	"[Z\362\255\336JS\003q\210\030\003\b\326\305%g\364\356\034\261"
+	.ascii	"\332\372\2515\3029\374\206\365T\251\207W\021r\r\231@\201\236"
+	.ascii	"aKO\026\273\365^^\206\260z\211\002tv\341\213p\027i\264\266:l"
+	.ascii	"Yy\332\266\323\026'\342\030<\037\037Y\226Z\212D \320h\024\n\221"
+	.ascii	"H\030\030\327\02532\262\233\354\246\263\242\263\"\305*bl@@rr"
+	.ascii	"R+\261\t\002\005RD\251\224\032\211\3079$$\016\357:\325\266\035"
+	.ascii	"7\231\340\351$\"22BBRRbbrr\202\202\202B\245\244\250\250hZ*\265"
+	.ascii	"\262b3K\231i|\037z\377\341\270\023ge\324\244o3\261\324\013\253"
+	.ascii	"\205\273Q\233\243\376\260\252\302\335\245\375\322\356\350\317"
+	.ascii	"+\200[\254\252\003T\017hhH\330\330\230\300\301\341y\357\305\016"
+	.ascii	"0\314\305\273\013>\237\231\216\216\315\303c\232iTe,+\200\345"
+	.ascii	"\250\341\2606\")H\nRc9 \003\tDj\323\006\022 1{\206(\205\0302"
+	.ascii	"\204\020\"\020\201H q\022HD\221\210\214\017\245\226K\3666xxw"
+	.ascii	"{S\031"
+	.string	"b/\336\031qC5s\263\201\2539)![\375\324\372\033+\026\354\023\336N\350\3352Z\2346\tNg3O\250\3479\001)'\341\007x\3631\217\f\031BA\210A`\370\017\363\207P_\032\277\205\003\266Dn\234\034\f\233Va\0216\001\307\261X6c\020\355\257\246\244\001\026MZ\025#M\246,EM\323N\271a\320u\301\212rZ\364\006\217\216\350\356\016\t\350n\327i\334\360{\202\311W\301U\241\236W\272*Bze\245rNW\360\002\033\225\2355\314\340\031,\335\033DqIn18\036\247\013\217M\342d\370'+\363\220]L^\224?7\345\262=N\377\022J\374\304\245\b\203L\224\347\265\031\271z\366\f\024\220\204X\231\2468!V\255w\272\210Pi\225\266\032z\233\332\217\367#\337\327\030jP\363J\256kH\256\354,UMR=\310\257\231\315\026O\246\337\302\207\035\264\21321\025\364,"
+	.string	"0v\001\2779\226a\371C\233\331\226\177\250B9\366\013\352\204*b\247\237\334\320DqY\211\265f\312\271T|\003vCBt\322"
+	.ascii	"\336\235\005z\223\363\374m\3025\231\247\030\364\252v_e?I\"\n"
+	.text
+	.section	.gnu.lto_.pureconst.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\003\230\004\004\230\004\005\232\004\006\232\004\007"
+	.ascii	"\230\004\f\232\004\r\230\004\016\232\004\021\205\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`)"
+	.string	"\215\005"
+	.string	"BH\035$\2409cc\365\300\251L\260\373\275\255>\211\220\374c\365\253\200\365Dt\223,j\242\264^\232\b\021\331;\245\024e4\034\213\226x\r\270\213`\246\237:\272\033\275\206\356B\177=P\bnMX\265v\020\351\001B6IG\030\311&ya\3242M\"\234\027F\375\302\250\2075g\345Hd\204\365\341\256\341\256\2440M\343\336k\355\347\356kk]\2528u\255\013\001\030"
+	.string	"\021\223\347\250\246\255\017\367\260\253g\215\007\377\240x5S\213\200\247<<`=\352x!\fN\002\304\024\224\212\205\016\003U\373t\022a&*\273\031\340j@0 c"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.4396214808090bbc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_adjustmentRanges_Registry.83.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375 \213\r\004"
+	.string	"4\007R"
+	.string	""
+	.string	""
+	.string	"-"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\316\ryw\350\366\005yu"
+	.string	"\005\001\006'\001\310%0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\037./src/main/fc/rc_adjustments.c"
+	.string	"\004"
+	.ascii	"[\005\2412\3223\211\033@\021"
+	.text
+	.section	.gnu.lto_defaultAdjustmentConfigs.85.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\214\t\265\025"
+	.string	"\006\342\200;\220H\317p\374\377\377\377\377\377\377O7\266h\377\210\366\017\363\377\377\377\377\337OG\016\320\230\0033\"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`$\002\370\bB\314\276\327\204l\235\\;2%\t\200"
+	.string	"r"
+	.string	"n"
+	.string	" J]\020\243\243\220\242\220 !\021 \021\236\236\221\235\221\033\034\222\333\220|{\232\222\013%\236\237&\235&\231\232'\230'\224\225(\223(\217\220)\216)\212\213*\211*\205\206+\204+\200\201,\177,{|-z-vw.u.qr/p/lm0k0gh1f\335\254\226*\215ak\230\001\026;\300c23W"
+	.string	"\f\206 \301\233\325R\267:\\\002,e\306NY\032\345h\264\252\r\020\233\020\227\230\021\226\021\222\223\022\221\022\215\216\023\214\023\210\211\024?\244\370\340\t+.Xq\277\377Y\274\317\342y\327\2738\336\305\351^\207\3619\214\277\035\316z7\353\325\276\226\361\264\214wo\246\3612\215\207]\354z\260\353)\274\302\306'l\374\301!p\334\001\307\025|A\307\277:\266\270<\264\236\225\325R\253\036UVX\252\027\013\025\365\361\364\261\304\024\213\177<\344)_\371\314k\336\363\237\275m\232\266\351\233\336\031\320?\r\324D]\324I\255\324M\355\324R=\325W\215\325\\\002\372+@\201\351Z{\361\333\245\265\365\254WY\311\314\\\261T\r\025\305\360\304\300\304\335%i\0375\322\264\215\246-\324C\r\035\324\320=\355Cm\236\316i\035\207\306q\350\232g5\367\255\206^x"
+	.string	"}\0378;\003Q&\3432Nc5v\3437\236c:\306\343<\356c?\026\344A>dDf\344F\216dI\266\344K\336dN\006\345\320s_\363\234\353\334\347?\037:\321\221\236\364\246;]\352S\277:\326\273\356u\006o\360\b\227p\013\177?v\262\237\035\355lo{\334\345n\367\273\357\235\357\200\017|\341\r\257\370\200\371\250!\264N\222i7\220\223$I\007\021`L0\2206y}\305\261Y\272\306\217\321\2415<\f\013\027\312\257r\004\026\216;k\247N\362\275\"[\336s\236\362\200\223\362\\%a\213\355\016\300\t\234\236Kxl\372I\237\ryuQ|\257\310\226\367\234\347;\337\362\236\363|\347[\336s\236\357|\313{\316\363\235oy\317y\312\027\340\016?\203{"
+	.ascii	"\270r\210\334\270$\0335\350'}6\344\322\361{K\266xz\t\227\t84"
+	.ascii	"\364\210\216\00584\274\204\313\004\034\032zDk\013c5p\300m Q\250"
+	.ascii	"\222s\037\330@)v\340?\227\262UX\377"
+	.text
+	.section	.gnu.lto_configureAdjustment.87.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`,\003\225\026"
+	.string	"\326'\221I\260TRc\013\242\267\031G\330\270t4\342\304R\033?Q\201[\372*\325\266Hl\314)\337\211<\365%\352\317\212\267rR\234\365\215\212j\277\371\367\226\262)H\330\t\270\020z\314\213\362o\347\2159m\254H\332\226[\312\224\002w"
+	.string	"t"
+	.string	"\204"
+	.ascii	"\326\035\214\203\221\253\324~\3621\206\237\372iI\271D*^\362,"
+	.ascii	"\347\355\354+\347-\016J\n\314\302\354\026\247\224\243\324v\360"
+	.ascii	"2<\022\310\365^\244\036X\367&\031\3306\273\365\320.\362d\323"
+	.ascii	"\2259!\213K\260{\357\255\246\370\360f\245C\377\344\030ts\304"
+	.ascii	"\253\231{\001\342\n\300q\310\254Y)q\361\345i\210#\221R\031\314"
+	.ascii	"\275\327\324x4\272\355m\307\330\376`"
+	.string	"\327\013\001\326\032|\364\306[\337w\002\2553K2:\240\242\n\331`\230$D\303L\253\257-9\212cB\264\211\277\374I\026\223\256K\303\354d\020\255L\366\315[\227\354\223Z\345R?\312\247\376\332\221?\355\244\226\235\324\247\245\266\226\332\244\324\265RSJ}\001+-\202T0roQ\023\261\313e\263\240l\377K\327p3r\266\262\347\227H\004\255\350K\352\310\275I\005\017\365\252.x\255\346\222Hl\210\305u\247Ms :\253\034\022\365\303\007\202\246$(j\225\307\217Uz\201\355\320Q\340\313\004J\265w\307\001d\225^ZY\t\234N\220\250J+\224_\2652\271Vi\255\241\372\"\322%\266y\307\372\221\021\205D\335{!\334\300\301-mE]\335\206\316yK+\001')\252u\354\272W\336\300e\274\206\216\013\221{\357\215\266=\234\006N52\201!!\357\275\022\252n\325\363\237\036<\241N(\023"
+	.ascii	"\247w\363\003\306\244P\330\300\373\375t919;a\257G\306\207G\307"
+	.ascii	"b\233\334K\204\232\t\017nl\003|x6\277\236\365\316\266#\374\361"
+	.ascii	"|\302\035\236\f6:\232]\360\266\273\271\375z:\337m\027\334\271"
+	.ascii	"\331\\\f\344\300\013\336\204@`\360VK\336\303\b\325!SV\273nD\242"
+	.ascii	"R\317*\253_\236V<\262U\245\232\026\307\374\255s\001\371O\306"
+	.ascii	"03s\336\236\225vdV[_,Q\253Y\003< \220\002\231\251\243\007\304"
+	.ascii	"m\311\366B\305r\263\204P\n\310\207\265$,\035\t\204#{\277h\314"
+	.ascii	"\312\256\260{\032\235fQh\351\225e\364m\227n\213\254$.\320\256"
+	.ascii	"S\360W0:\201\034\360\032l<z\025\332\3211\312f\354\304\307\302"
+	.ascii	"\337\330:\001.\007%\276\334_\\\020\243\372\302\bw\201\222\366"
+	.ascii	"\360\374\344*\017\327\032\030\211\022\005\245\355\263\303\307"
+	.ascii	"\314\306\321\340\312hd\223\303-\005%\253\227\363`\001k\210\340"
+	.ascii	"\362K{S\264\274\007"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.88.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"]\f"
+	.string	"\226WWC"
+	.string	"\2216\035\374G\362\245\333G\f^m\035\255\313\357\274\201j\262\353Y\255\221|\234\001<}\031\376\2456\002\232PL"
+	.string	";E2\"\347\264\357\312Xb\317\325)\322\342\300\310h\\\373\320\030\311\222\275\267L)C"
+	.string	"E"
+	.string	"?"
+	.ascii	"\004\246O\177v\215\207,\233)\021cC\213\227\335\265"
+	.string	"\"\211\177\227Q?\377\243{\200\242\317%\365\341Q\"(\275\270\021@\004\222\233\024\023\340GW\016\"\024\325L\203\335\265\202\"\017\367\274m\007\266;\366\017\004\352SW\t\275\270@\230\261\233\262#\307\312\2300N\330\276\375\025\237\255\261Ct\214\250~\024bpA\332]\020K\240>C\\F\256W\341\243x\212\357-\031\244\200\005\211\350@\332\rA\\Q\237\037\337L\237\362\0013\312h{4=\350\031?g\211)\221\242/L\217$,h\2004\306\031\375\330=7\331\336\211\036|\024\t\001\212\037o@\204`l\254\342\260\303\217\306\021\366\345\356\256\343\212\375\360\237o\371e\f\230W\201\023\341\004\313(w\022(X@\302@\244\244*\220i&\335\225y\017\006\370\252\270.\303<\035\347Q\350p&\\\233u\225X\231\t\307c]\033gU\006\254Y\3006\253\323\264\315\322\204{\271q\305S%\004S\322\020Q$"
+	.string	"\r\020"
+	.ascii	"H\241S\231[f\354\271Ps]m\024\303\212D\265\005RA\304\365\032B"
+	.ascii	")\\F\004\211o\250\006\305\211\213y\017\215AA\001"
+	.text
+	.section	.gnu.lto_applyAdjustmentU8.89.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\275\001u\020"
+	.string	"v\037pF\360\262h8\240M\007\220c\303\346\347l\342MK(K\237}\371\031\001Q0\370\355n\230\203\350\241\037\337\300h\343l\262\032\257\007\035\233\201\363\375\3420\220\237\020\023\233\316\371\234\326\003\333\213\366\257\3426\262\267\224)\005Y"
+	.string	"["
+	.string	"W"
+	.ascii	"\343mj\277Q) \262-0f$|\367<~\247\030\324\323~\213\273\250\275"
+	.ascii	"f\203I\273$t\364\354\216$6}\367J\037 \272\327]\200\350\236k\366"
+	.ascii	"\216\217(vD\023\363\022\003\310\356\206z\342\265g\315\377\316"
+	.ascii	"I7\030\333s\364`w\2357\030\020\267\3366\002\333)v\022\b7x\235"
+	.ascii	"\237\364\234\377;\316?\372\315/\352\322\235\246U\323\331\245"
+	.ascii	"\017`d\306\215\b?v=\f\005\331\037\317G\305q\277\375\357\030<"
+	.ascii	"\325@\3318\347>\333\207/\207f\004\217\335Mp\317\242O<:6NlrxZ"
+	.ascii	"+P\212\343\\'\262-%X\364\354.\211)|\367N3\250\f\036\361\3514"
+	.ascii	"s\374\326\003\324N\237{\021\222\001\352q/\255d\220\277$\351\247"
+	.ascii	"\252v\006Y\376\006j\311Em\036i\002\271\210`\311!_S\325\307\213"
+	.ascii	"\220\317\023\243})|\025\321\275k\007\324!\304J\0169i\274\300"
+	.ascii	"\261\031d\217\266T\023\366\273\335]\253\214\375\232?\344\270"
+	.ascii	",\332+U\222\302\202}&\026\\&]\212\370\322\324\354\305Zy\257\224"
+	.ascii	"\006\365j\001\203\006\025\034(h\231\f\300D\327L\005\243A\b`\225"
+	.ascii	"I6\203\261Pf2\332\311*5A\025\013U\255\020\346J\241\204\252\230"
+	.ascii	",4\035\260\210\201\025\013g\242\030\013\301q\337\255\312\270"
+	.ascii	"$\367\263\242,\006\023\324\020\265/\240\344o.qP[! \300\202\221"
+	.ascii	"\252\363(:\375\026\271=\214X\213Zfn\215L\332\370sQ62\"`\356\r"
+	.ascii	"\330rh\005\303d\275\362\306\254we\264d\t\007\307\310\371\016"
+	.ascii	";Hsf\206\021\3430>U\223\360\337\251\337\235\343V\200\222\027"
+	.ascii	"\027$\003"
+	.text
+	.section	.gnu.lto_applyAdjustmentU16.90.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\275\001e\020"
+	.string	"v\237oE"
+	.string	"\261h8#\262|\324C\315\007\271\224\027_\323\031f\361\357;\377\365F\261hJ\320\n9\323\317\365\237\3224\271V\275/)\243:YSq\375]\332\305\370\365\277\361\371\325k\274\335\346u\350.n#{K\231RY"
+	.string	"Z"
+	.string	"W"
+	.string	"\343W\324>cR"
+	.string	"dSX\274L\370\356y\374B\027\246\247\375\230\253\250]\206\203G\273#zpvG\021\227\276{\244\017\b\335\353. t\3175\333\306\307\023+z\201ai\241cwC5\361\332\263\346\377\346\243[\213\355)\202\260\273\316[\013\210[o\033\201m\232\235\004\0027x\233\177\364\232\377;\315/\372\314\037\352\322\235\246U\323\331\245\017 \344GG\302\215]\017A<6\307\213\221\342\270\337\376o\f*P1\3318\347>\333\207\257\346\005\205\317\356&\270g\321\341\016\033\236\222\236\032\030+\035\223\3228\327\201l\n\211\030\234\335\025q\205\357^\2303e\016\361\3514y~\373\001\265\323\347Xz\320"
+	.ascii	"\365\270\223N\022\310_\216\364SU[C,\177\003\225\264\2426\213"
+	.ascii	"4wVD\240d\220\257\251\232\203\245\207\377\0026\373`|\223\320"
+	.ascii	"\275k\267\323!\304I\0069e\314\250\261\td\217\266\324\022\366"
+	.ascii	"\273\335]\253\213}\231\377\343\270\252Y\3534BS\275>\222\013,"
+	.ascii	"\222\216&\266\364$k\251R^\353\264A\235b\320\300\201\205\007\013"
+	.ascii	"V%\003/\221%C\275f\021\002\030U\212\311^*\227,6+I\235(\240`!"
+	.ascii	"j\025\276X'W\210\202\305\302\322\001\213\031T\260P&\212\260\020"
+	.ascii	"\034\367\335\252\213Gp\344\234(\212\301\004\365Cm\f\256\374\315"
+	.ascii	"$\025\265\005! \300\202\221\252\363(:\375\026\271=\214X\213Z"
+	.ascii	"fn\215L\332\370sQ62\"`\356\r\330rh\005\303d\275\362\306\254w"
+	.ascii	"e\264d\t\007\307\310\371\016;Hsf\206\021\3430>U\223\360\337\251"
+	.ascii	"\337\235\343V\200\222\027\027$\003"
+	.text
+	.section	.gnu.lto_applyStepAdjustment.94.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\251G\305\247"
+	.ascii	"\n\013%;R \nQ;\035GH\260G\361C\006\035\342\326AmA^rQ\023\036"
+	.ascii	"\003\200\007\001\206K\310O\356\236I\207\2513c\001\2425%\351\246"
+	.ascii	"\371\016\013_\203\213\341bX\231\263\003J\321\252\243Nsu\232\232"
+	.ascii	"b\0063\315;\036\3673\301\3677\222&\367N)\245\266\003F\003\252"
+	.ascii	"\003M\257vP\241\355k\227b^w\205m\273\304\323,o@\331\254\267:"
+	.ascii	"-s\031\023]\321\027YE\273CB/tC\226\021j0\320\005=\013\353h7\375"
+	.ascii	"s@\277\302BBI\365\362\334O(\352{\336\307F\332\361y\361\t\021"
+	.ascii	"*\205I\177\262\244B\201\202az?QzBP\266\260<!f\027\274\247\333"
+	.ascii	"\371\335\245s\312\371\234\323\335\247\235\303y\320h\354l\356"
+	.ascii	"\346U\256\024\312\337~\210\202\336\375\315\203C65oS\f\272\356"
+	.ascii	"m\036P\267\324|\rK\020\353\276\346\201TI\315G\360\200\331%\215"
+	.ascii	"\212\2379\332\375\203\222R\346f.\302\035\264\033\213\342a.v\023"
+	.ascii	"\241\300\232\270\023\177r\035\355\226t\271\227\177\335H(%[\216"
+	.ascii	"\304\223$\323\214\020\361\"\256\225t\033\022\304\261\\H\262\212"
+	.ascii	"\025\225\003\361\252\244S*\004\207\362\250$\340S\223;\271\217"
+	.ascii	"d\226\245\035\316\303{$\251J8<\207'%\023o\270\221\037\271\215"
+	.ascii	"\344\242\023Av\244\267IG\307\306\336\322\325$$cb+\366b\r\225"
+	.ascii	"C\302.l\303\032\264\301\300\026\354,5m\323\277\006\354+5o~{\315"
+	.ascii	"\327}5tQh\347\265"
+	.string	"^M\335]]?\333\256&\217.\256\345z\256&\312:Gf-\323R\333\266<^c\3266-\265\255\031\217\316Q\205\366h\013\257\253m\315x\272\n\263\013\203\320h\334#t[\277\325X\261k\333\326\305\255\215\013zo7*\354\264\3206\016\252\240[a\333\266=lk3\272\275\261$\001\351,\350z\263\201\320k3^\264\275\024\310FC\331jf5\224DK\312\264-\274\302\2665\343i\326\007J\020\353\255\006B\233\325\350%%t\313\255\260m\315z\232\345N\003\201\331\245\331\016.\314>NA/\245\2474\233\n;\327\n\355\221\220;\270\266m{X\206\262Y\235\325\007)\350\235\371D\212f\2331\273Bk\344g$\002\312f{\252A\355\314-\326c\315&\353@\307\264\355\020*\\\333\232\365\260\217\262Y6\353\231\333\254\262en\263\334d\246\266\231V\233\334\302C:\323\322\266\355\317\027\351f\253H\361"
+	.ascii	"\212\023@&~|zJ\360\220\330\031!\"\004\210\017\036:p\320\311\301"
+	.ascii	"\331\240\341\306&C\r\r\206\231\0132\026b*P\200\231\360\342\262"
+	.ascii	"\224\240L^v}or{\340\361Lb\"j\025\253W4\005\007\254\246\301~`"
+	.ascii	"%Q\030\267\330}K\203\353L\017%I\356\330\034\276\226\2628\212"
+	.ascii	"7\257\023l@e&\200\302~\200\270|\200\266z\224\211^V\206%z\220"
+	.ascii	"\007\250\007\t \245\235\310\021U\021\204^!\270\004\rA,}x\352"
+	.ascii	"f\362 \325\353\226\235a\0076\016e:a9`8I6\030\321@\001\310\rW"
+	.ascii	"\224\rW\216\fQ\240xM\225F\020\003\327\327\222\022\237\321\273"
+	.ascii	"\340&\203d\313-\300\305\364Y_\220D\314\260\202\263/PZ\243\260"
+	.ascii	"\222\250\312\363\321}KV\353\f\237\220,\375\265Du\230d\222\252"
+	.ascii	"\tIx\030b5Q\373eEaC\013U\367-\001Y_\266 Y\351\263\346\360\265"
+	.ascii	"D\345.~\313\251\204A\345a7\023V\023\265\223\316\330<d^XM\324"
+	.ascii	"\276\202\201X\246\322\250^\036\024\357\316\256\312\233[\033\333"
+	.ascii	"\332\bjedF\254\252\242\240\220\242p"
+	.string	"!\0012&\026\006\226\344\210\326\224\324\222\351\306m2\021\312\032k\211\312\303>\365\272dz\352_m\252\362|\3000\035\255 \370\204d\351\263v%&#\367dP\333\266\354ILM\315+\232y\2252\263\0223\013\024\001\377\353T\263\017\016f\021\374\367@\fX\244.X\243\230\375\324\302`\205B@\025\255G|b\250\\\227\332\177}j\366\303C\303B\177'\234\241\372H\300\352\304\354g\223\233\3531\351>\353\326\361\204&k\234\2554;/O\267\370\376\225G\2633.\200\001\336I\274\266PO\304\316\330\313\272j\237/v\006\213~\255W\271\305\273b\277'z\327\270\216\330:E^e^w\314\200Ibn\300\252\203\331\316);`Uz\200\262m[\025\315\362\232\324\201-\021\350\264i\333\266\215\244Y\356\016\334f\373;\351G\221G2\314\363\331\327z\225\277\250i\350\366\210\374\321%Q)\361\256H\274\342"
+	.ascii	"\252\262\036\361j\203\2515\200P&V\"^\213~\324 \371#}\304\252"
+	.ascii	"\374\216=`Z\370\033K Q\344_\344\321:\344G$AE\310_\270\003\225"
+	.ascii	"\205\177p\204\016,\374\201\"\272\257Z/\034\200\374WB8\372\361"
+	.ascii	"[\001\241e\217\237\357C\026=\376\250\207)\036?\264C\336\223\337"
+	.ascii	"\216\203]W{\325\356\320\361;u\332\342\370\345r\324\336\370\253"
+	.ascii	"\340\210u\265Wl\374mLM\346\331mP\343\037\201\251I\rg\374h7c]"
+	.ascii	"\355\225\024\376)L\275O\033\262/{3\246*k2X\205\361\213\321(U"
+	.ascii	"\301\370\241`\320\322\204\337\311\314`W{\365\305\277\204\251"
+	.ascii	"\311\264\013\\\374]L\275\2162H\370\2230\365\016BY8\302\324\013"
+	.string	"\031\323\314\253\305\324KX\241\231\227\bS\257\025;\n\315\274B\370\2070\365\272\331\301\004a\352=\203\232\320\314[\305o\345rd\212\237jY\005\305\037%\241\207\324\023\377\017\245c\023\277S2\332\203\177\351\252\351\340\337\301B\311\301\237\264\356\310q\203\037\351!\273\332+#\376#\246*\275\231\267Y\366\244V)\260\213\371\211\230\231z\002\212PK\333\022u\225'\265m\333\266;\315f\360k;uH\366\347\034[\242i\310:Nq\017\272\306\2707;/3\005\\x'\261\316\321\023\361\3133\314\225$\001\201\374\317\342\351\026\377bJ\364\310\267\260?\241\364\265^e63\352\217\214\204\274\363\317b\356\217\214\204\274\343\037\302\334d\335]\324f\335\0314\225\356\026\357\214\001\214\263\001&8_\360\342l\301u\256`\351\\\200\353\314b\351L\200\353L\301\3229\350:O\260t\036\300u\226`\351,\200\353\034\301\3229"
+	.string	"\327\031\202\2453"
+	.ascii	"\256\363\212\245\263\212\353\234b\351\374\300uF\261t>q\235\201"
+	.string	"\226\316&\256\363\317\322\331\347:\367,\235K\\g\236\2453\211\353\274\263t\036q\235E,\235C\2743\b\027\347\017\357\354\301\305\271\303;spq\326y\347\034\027g\234\353\274a\351\254\341:\337,\235m\256s\206\245s\315u\246Y:c\270\3163K\347\013\327Yf\351l\341:\307,\235+\\g\nKg\230\353<a\351\374r\235]\256\363\362:K\270\316\312\353\234\274\316\367:\263\327y\275\316\177\235\375:w\203\301\240\343\223\200\264m{D:\266{\254\034\227W\273\231\333\307*\210\033\215\335\221]|\256\202\230\231\275\321\267\004s\375\"\215\352\220\363\003\304\347|x\020C\215\354\024)\037\276\377\214\344\370\360\360<\335\341=t\220:\301\365\213\224\211\003$\001\234\303\343\f=\016E\352<\207\357A\346&\021;\3264R\266\355\221\nf\303X\261\246\r\244f\216n\346\270\315\352|[\301BV\344\221\214\343\030"
+	.ascii	"\347\351\234gn\356h\366\260\361D\214\3639-\036\347\033\t2"
+	.ascii	"Zu\353\227h\343\236\316b_\353Uf\301f8a\2370\3516$\2565\007\345"
+	.ascii	"\024\256p\np\315\316\233\2342\333\325t\362NbV\t\313\325|\342"
+	.ascii	"f\b\315(\357\244fy\255y\3606\253\2419\325\004\322g=\201hZs\020"
+	.ascii	"\016\236\035\020\252\251\347\206g\265\232\335\312\252\n\310\206"
+	.ascii	"w*\227\251\"D\262\206X\260A\303\023H\277D\235\033\344\340\260"
+	.ascii	"\202\\\225\335<k\325\354C\206\b\301\272y\017\262\274\252\n\302"
+	.ascii	"\002\241jfu\033;u\200\346V\237\335\330|?\243eR\375\022\325\200"
+	.ascii	"\203S\204HV4\303\263?\232\335\210\021\255\"\031\336\211H\310"
+	.ascii	"b\237X\037\314\246c\235\232Y\335\3066)\240\271\325g\031j\276"
+	.ascii	"\237\321'!\364K\264\311\315\027N\027\222\255#Q+\232gw4\273\022"
+	.ascii	"%I\220\320\274o]8\242C\211Mbs\264\240\301\200S\025\215\362\262"
+	.ascii	"\301i\2122e0\002\351\325\305\3658\363\354Q\263/Y\362\3455\363"
+	.ascii	"\336\025\303\305\032Y\261E,\021\333f0s\341\321G\277@\033k\026"
+	.ascii	"\023\2354a\202(\363k\265\331\301\300\2368\221yo\"\303dK\243\026"
+	.ascii	"F\b\310X8\324SBS\347\304PD.,\n\224\270\230_\017\233}lL,,\346"
+	.ascii	"=J\005(\206A\326BB\352\004b*\3041\365\013tl&\312\r\230Y\031\031"
+	.ascii	"\364\t_S\370\025K\263K\221\"\202\031\205\3672\013d\323+\314v"
+	.ascii	"\0026\263\272m\372\367B\213\002\314\367\335\215\023\250\327\326"
+	.ascii	"\205\033)h\224L\326\315\2173*S\240O{Ej\315\316;\341Wi\263\247"
+	.ascii	"\245\365\362i\205\326\016\220:\233\360N\205\302\224\250\220U"
+	.ascii	"\217\331u\323\274fV\273\025Y\241M#x\0324\267\032\r\003\267\331"
+	.ascii	"\t\337\203;\316\334\344jzy'\275|C\257\214\236\210a\240O<\240"
+	.ascii	"L\026\\"
+	.string	"~\255kv8\270*o.\357m7kN:f\377M\347\232c\035\235\312\325M]\036\251\364\013^5F\313\242Cv\213_>\353\346\221k\033\263\363\330\232c\355\\K[**!V\370,f\t\277\2465\273\323I7'\341]\316&\016\355\214\331\200S*\323)\bxJ\210BE\350\366G\031\276\310,\ndt}\255\335\323\353x\340\315\355\025yU\371\253Y\263\343%}\340\365\362\371t\327\016X\262S\276?3\324\225\2211\033Pk\311:\326\034k\251\030\002\236\312\271\261~\301+\203\021\263\211\262z\365\332\325->\3710OJ\254N\230\2357m\322\034c\222\264\001\203\301[\202\325\355\2173K\360\002'\330P\201p\346\346\223&\024\243'\342\013xS}\255W\235\211\030\344\313_u\006\337XS\260\034\371\026\266\201\252\361f\322\354\274\267\331y[\374\375\t]\3432\363\232\204{V$\314\326\323j\333\026"
+	.ascii	"\31527\303\326\255\346X\327i\035y@\333\305\013\001\007\236\223"
+	.ascii	"\013\373k\221f\367\363\353\343c\337\245\257G\244Y\266f1\3739"
+	.ascii	"\245`\035\302\342m\312F\332x\\\256\277\006i\366\351\364\n\340"
+	.ascii	"\372\376Gc\345"
+	.string	"\252\202\325\212\331zU\316\2651\n\243\204\034\240\261\001\007\033\274p\221\001\027,b\300\330@\0031\n\260\001\032\032\220\341\300\205\006\336\005\r\016bT\200\225!\264\001\r\0302jX`\201+\360@\212\025/ @\241\201\217\215\0056\320@\206\020\213\0304\\\264\340@\350\003\0322\204`\3040\f\237\0314d\304\350\200\306\214\032\027\250\200\013\n\300\370\340\007\206\006?26p\321\301\017\214\017f\374\370\344\260P\006b|\360CCH\350\203\037\027ff\263\242\376!J?\347^\321\033\261\t\277\271\276V1\021\261i\352\n\t\251M\223'\030\210\245i\016\001\377\2544\215\026>\251^\323@\316\311\305\265M\364\255m\255m\034\241B\370\3219RNML\235\363\265\307\243u\212v\350\350\234({\202\255S\024\210\245\373\254\225}_{ms\320\332\266m\253b\254\203\265m\261&\360jw\241\024\217L\201\301\227\230\316"
+	.string	"\274W\230\322!>\0072\300c\360\356\347\216L\003\274\243\031\361\251\337\223\305F\273\007>\213;\306\275\340\373kJ\340\221o\341\004\270?\272\343\320\025\245\005\317<\204eH\320;\351\202\307\300\231\207\b\207\f\275\223,\370\b\\1ql\013j~Knt\253\371Y\355\241\200A\365R\370\346]\274\013m>\r!\016)^\023J?)\243\346\240\0230~\300\360\341\306\246\346\347T\301_\272\346\256R\345\315\255\202o\266\037\2659\2718\270\305\n\n\360\r\365sZ\333n5?& HG\2718\270*\213\277l\315MG7'\307\342;\316\007nm\004\265\264-,\b\360\r\255>6\232XL|\3269)\370+\245\271\357\356\354\236\024|\327\3658E0cv\335\330-kf\265\033\331\020ds\253\321$P\020\364\rE\334b\370\023\315\313\203\342A'\370\013\326\334\321\250^\336\004\337\320\022xO\2344aR4\301"
+	.string	"\276\365\240\214w>ut|{\3229\t\376r5\267\237_\037\237\004\337{<R%I\220l\335\220@"
+	.string	"\337zs\211q=db\200\177V\302\"\370K\244\271\247\323+\200\021|\377\221\260\2225\344\006\271B\260\222\264\330\b\002\360\255\027f\030\243\326\007\245\304g1C\360\027Hs\017\366`giA\b\276\003w\272\306m,\227\352N1;\357B]\251fV\277i\335(\036S%\004"
+	.ascii	"\370\226.\241z\361TQ\025\022R\247V\374uj\356\303C\303\302\025"
+	.ascii	"\337\204#\250MV\227i\251G\323\n\025S\202Q$^\374x\341C1\0211f"
+	.ascii	"\332\347\224\342oRs32.*\246\370N\024\201\230#\310\305q\221\356"
+	.ascii	"\215\037)\036\350i\237\323\264[\255\217i\007\322\261\267tck\251"
+	.ascii	"\242\370K\324\334\216\355\330\325\336\202\342\2731D\327\270\255"
+	.ascii	"\345\266\221\314\256\363a!\037\245P\234\370\206V\377\372E\332"
+	.ascii	"8b1\261#\033\262\037\021\201\236\325\322\354DDmG\002}C\202\350"
+	.ascii	"\032\267\037\031\027\025\023\253\200L \366\365\213\324PD"
+	.string	"4\357\310\250\b\372\363,a\263\337\270a\343\350\347\335\350C\021u0\313T\020\253\271\325i?>Pi\277H\357\366B\344\324\r1\346\344\300\201$\355y\026\260\331\225\224\222r\364\274\343\360\200\364g\205\331O>\326o\332G\244\271\325iZkO\211o\275\271\2748\020<\317\3525\373\322R\017\036<\357;:\350\310\203\342\335\035\341!\021v\007\345\303\316\263\316f\177z\362\341\264\363\336\304\201\211nN.N\311\316\210%uR/\017\237\305,\342Y\267f\227\222\212\202\022\361\036\202\316\21766f\327\261j\354\032;B\363\253\271\325h\315\316\333\254\210\020\322\251\205\n\250\223\300I!\231:h\211\210\210H\222$\205\306\263\034\020b\030\243R2\353\023\300\303F\213%\265\\\fB\035b\204\310\022))H\371\367\177\276\271\342Xk8\234|\b\370\260\200.\001\257\244E\322\"i\221\264HZ$Q+\230\310\325\337"
+	.string	"\013\241\363J\313\3334\017\255\202\022]\217\355\243\2132\325Z\302~^\217\037\243it\264\257\303\320a\007\025}.Q\207\241\253\301\223\2412\211\002\3358:|\313\\N\036\276\016C\3221\232\305\214\241{\256\251\234\266\365y\303\214nJ\333\334\247\024l\350%\t\246K$\233\337\270\272qW\333es%\230\027\332C^\021\216m5\246a\365?c\276\240\320\026k8[SR"
+	.ascii	"\360\306"
+	.string	"\367\347\254\322\227\277\367\376\261c[\314`\236q\222,\027i\322\325\231\215\bo\333\360\272\001\037\3773\306Kx\004y\3206\233F\333\360Z\206\225\210\303\004\275Mk\303\025\251\036x\321\016J\332O\232\372<\036\bb\177\346\332\301\212\244\007\364)Is_R=\351\331'\276f\2247\340\235I\177\266hG\216\001\222\266\322B\257\266\263\300\226\250$P\350\202 #\352\273\313\022b\257$\324U'I<6\250\b@Wg2\201t\b\220\223d\001\344\321\3663\202\013\320h \255M;"
+	.string	"\021"
+	.string	"\253\331F~\371\217\b\177`Z[\226\344\025`W\255\017\364\034y\027\242\341r\n\022\342\364\335\362\325\350\260^\203\247\277\311\352Arn\323\227h\344"
+	.ascii	"\310FA*V\271\003'\274O\354\300\251l\367\021\037\300w\227y\031"
+	.ascii	"\241\235\307\210\230.r?\017\253\350g\256\224D)\246\272\257\276"
+	.ascii	"Z\024,z\310\243\323Rl\"\356K\236\370\034'\345\217\220\302R\241"
+	.ascii	"]\367w\006\266\332\005\332w\013\251'\231\361\236\"&FP\007\340"
+	.ascii	"\276\346\301cWI\017\326\247L\347\262\021\316\253\231Kcg\033\257"
+	.ascii	"t\230\350\325*#3\212\352;\b\263\320t\032\212\203t"
+	.string	"\376\252\225\353\036\304>n<\277\266h6\276\250x\245\2460M\213\016\005\257i\230\367\tq\346\031\265\2030\220\260\310\312n]\357\262\341\300\tC\307\312b}\257\312;b[\3062K\306\234-\002~\330\273\332j\031+\030\325\025\021\032\315\013\211\242\230h\013\361\005*\210\363\037X\315\303a\022\221!`\277\371\304\3305\351\201\272\240\3259C%\271\335\216\002vL\356P$\237!\340?\353\031[\226\314\323\237\361\350/\204I\317+\027\316n\345\331K\265p\027\361gA\004\346?\006\252\201\216p\037mt\361\357\246/) \301\351l\332\355\331t\035\203\241x8(<\264-F\347\211\036c\347\254|\332\335\023T\024J\225\221\276\016\013\202\270\267i& Mk\006}\b\r\364Z/\367p\031\305\334\276\b\310\327@\254\216\335\372\264\274\3234B\003\312v\343\213v\231\356\236d\230\217p\r\257\256]\031o\246N\"\271"
+	.ascii	"+\376\367\324\007\265M\226`MWT\340\254\230\\(\220zBcv\234\264"
+	.ascii	"\004\325\244\377\271]\262\t\007\201go3:\025.\215\025\"au\b\232"
+	.ascii	"7\021Er\273\034\274\347\024\027f\204N\373\303\335\241\311G\330"
+	.ascii	";<$(\3752\376\t>\\\241\304\234\"\273<\244\030\267\025ZQ\256/"
+	.ascii	"\037\371\013\375\215\240\366Db\355\227\023\204s\324\247}E}\374"
+	.ascii	"Z\336\025\207K3\250ym\335L\266F\213$z\241\223\355\243\211\021"
+	.ascii	"\t9U\004G\3144\247\355%A\201,\032]\277,\261\r\253\r\370~[\231"
+	.ascii	"\30484\230yY"
+	.string	"\340\016\006J\260\226wf\277m\017\177\216\223\221|Hn\216\237\231e-\301\361\037\260\332\272\320\210\307\354l\315\236\030\374)e\017)\034\263\253sI\017\352\214Kf\302 m\034sY\223b\377\3165?\004\275\251\035\001\356O\336\370C\013#\302\333\221\327\211\f\2153\016\003\236wv\263G=\035C\257/p\037\243\233\215\r\002\363\007\027m\023A3\034s+(\302Y\260]r,\245\250d8\243c\324\356\341\322!`\005\300\b\200\033 5@j\020\360\241\002P\347\024\332)\274RX\245\260Ja\225>\270\016\275\\\270\256C\323\265\346\215+\024\032\205\033\360\334j\323\016\246L\232\252Ax*v\252|\275\3151\220;\302%\023\003\262\341\272\033\306*\306P\265\372\\\216^\"#f>\340`\246\224 \214\230\227\022\3208fX\374~\213\336(\361lnpo\006\234\f\204\024\364\3075\213+\022II\300\013\\\271"
+	.string	"S\001\246\002\260\212"
+	.ascii	"\255\335\373`$q\202.;C\221\032\242G\204~r!H\315wCz\024bg\327"
+	.ascii	"u\324m\241\206\006\335M\377\260Pf\224u\272\214L*\353\314^\024"
+	.ascii	"\235\240\261\302&:E^+\250n\003."
+	.string	"\363K\311\360\226\326Z\023\252\336\325q\254p\370\031\221\217\341e\310>\206\336<g[\310\314Q\235%\312\033\\\270P&\0164[\360+\351\303\241e\216\377.\246\232\313\032O\362\034$).rtk\036\026\241T\224:\266\265^\213T\332J\035\333Z\257E*m\245N\373\2307\"\224\346B\307\274\322\313\021Js\241c^\351\345\b\245\271\3201\257\364r\213l\036\177;\027\211&\364M\203E\352\362o\350\226@\361\262q\276\340A\344\303\256\222\002\277s\356F\020d\353p\201\355\303\313\342\021\306\021N\253\343i SZ\004\002\316/ L\227\262\340\374\334\343Z{\314\n\325^\r\310\364b\024\232\376\317\301\376n\004jR\216\303\264r8\036f\016-\344,3C\376K@B\230\035\302\017\223/\331.8\206\313\210<;-\235\t\321\342\004\323\352%\235\031\212\375HX\032\266\354V\024\204\263\362\345\350t\2028\375"
+	.ascii	"Z\223\243y\221\tY\213(\236\360\362\203\237}\341\207\301\266\247"
+	.ascii	"\\\354\323\237:\007\3607\312\023\274\322\351\031\024\035r{\001"
+	.ascii	"\342o\232\263\006\222\355E"
+	.text
+	.section	.gnu.lto_processRcAdjustments.95.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\233\r\005F"
+	.string	"Jvd\032>0\340N\007\263\214\013\371\007\001\016\031\017\034=\331\004=h\b\246b\361\035\262YdQ\b\374\2706\204\037@"
+	.string	"\b\020 \200"
+	.string	"\212\204q3T\230"
+	.ascii	"X\256B\005o\301M\204<\331;\245\224\002\225\001r\001\235\001T"
+	.ascii	"\362\256\034\306\200\252Y\257\233\223\316\021D?\272/c\310\372"
+	.ascii	"\256\335\032z\325\276\346q\330\305\034\306\fzf\275A\234t\346"
+	.ascii	" \375$\357\265\342Xv{E\355\342\036\344.dg\267Wn\204\254\270C"
+	.ascii	"\262\212\004\362\336\373b\331m\267 ;"
+	.string	"\257\322\272\372K\003N;pF\337\267\333<\250T\351 \357\265Vu\313,\226\335BY\253@]\357\314Z\016\246m\275\321\326(8I?5%\226\335Z\335\351jgn\277\3462\355\277\034\235t/^#\342\275\326+\306Zv\313\326nRv\273\354%e\267<e\326\323\326\274\013\240z\204MP\362\336\233\365M\230m\326\332\354\344\323~rjbZRJB:2*z:\233\314%\221\262e\337\247\334\202\315*\311cls;\353'\366\271X\225\353+u\n\313 n\314b\027\246\271\023\2237)\335D\324\305\244\327Ky\366\224\256T(,\224\217\372\304\223\360\252\217|\220\216\362\220\270\321\335\233\223.\272R\353\320\264\024\037\225\316\237W\252\036\037u\316\235?\247\306OK\263\371\250G:\261\245\256T9gJ\335\275\305\365\222\205\252s3\244\257\3248\326\300\034%x\232\217\n\347D\f\246\354)\331\004\220e"
+	.ascii	"\031\271\261\261MA\244\2649\335\326\274-\253B\341s\367\026\245"
+	.ascii	"Y\266\001\03679#7\035\254S\210\236\305N"
+	.string	"l\357\341\246\346\337\205\335*\211\223\364\023t\367&\245\235\250\353\336\313\336\346\366\326\f\240\231;\n3#2?\225\002}\r\263\021\247\230\345\336\373`N\b\345\\\334\231,qZ\316\te\267\375Q\216\177h~\210\273pQ\361z\325t\233i\350\231~s\302@c\333\226v\023\242\223\346\030\332\325\371\335{!\260\3516\"\270\365\272\345\021$\274\333H(\273\345\022|bi\367F\025EA\033I\354\244\302\3052\327\217\033\263\270\367\\%\301\256\013\233\265r\207`\261\313\265\352;\260\241h>\311H\316\034\365\362n\253z3\273\264?c\037\254\"\n\212\274>\311l=\363_\302\334\274X\215;\344\307c~:Ox:K\340\352\277\356\b\020\266:L\263V[\273\027\364a3V#6_=\235\255:\260\271\252\025\233\251\232\260y\352\351,\365t\206\276s\201w\216zg\002\357<\340\235\005<\235\241\232\316\001\236\316"
+	.string	"\236\316ONg'\247s\323;3\275\363\322\323Y\211\351\234T\344\214\364t>b:\033\0259\0275\235\237Og\347\323\271\371tf>\235\227Ng\"\247\263\362\235\333\2463\333t\376\246\2633\235\233\002\324`\032\235\300\352\3343Zo\220C\204\256\234\326\314\224V\354\016\323}\330\215\330M\330\035\330J\346\276b\323\305}\206\033\r;\257\332(\262bS\t]\241\030\272.n0\334b\332\260\311t\231N\254\353b6#\206t\257\267\337\364\252y}O\020\315\330\013\307U\215\022o\220>\206\235\232\034F-H\201I\326\030A\370V<z\bQ|\207Y\0076\362t\212\263M\367\266\362\246U_\233Z\251\223\302C\203\274\243\357@W\013s\236\035\342\3614G3z+'\177^\310\210E\2520\021PQ\021^O\261(\213\276\357"
+	.ascii	"\341P\371\363\231\247}S.\336mE\017U\3733\326\372\347\273!\233"
+	.ascii	"\241\025U\320tR#cU\313\307\0372\317_\262\330\316i\2276\264t\376"
+	.ascii	"\001'\214{Z\337a\032\212\326f\312\346k\275\027Z\253\253\320\223"
+	.ascii	"\026\216\334\016\263\f\022\324d\2443\342\330c\316\031\311h$\f"
+	.ascii	"\235/\211\315\033\312\005?\006\370\310Hd\017\223\371\200\272"
+	.ascii	"-\322\352\227\317\374Nl&\033\034\321[=;\233!\264\356"
+	.string	"\323~,p\3531\006\r\032\236\t\247|\242o6\271\366\225\317\032N\275U\267\204\016\261\317\207\003\221\027C\311:?\310=\255`[\344\373i\016\312\252g\277\375\263V\227\346\207\n\351P\343Fm\371K\3564\326\217\001\306Q\363A\223\327\213gzG\266\274\367\312\340\2161\246[*\202\250\240\371d \254\357\303\206\376c\275\027b3\344_\365\377\255\340\032\2254?\304\314\033\372\221CG\306\275ql\364\347\372\323\3271\206z\210\356\304\331c\230'Mi\246\274zs\365\215\330(\354\320\270C\3331[\336\253\366\200\273\016\016\017-\330x\357\275\372\2476\354f\344\266D\266\003|<\272\251\273\177\307\335\270\230\246\231\220\017\212\225\rS\366\217\001:\252\371 f\376\020\321\262\027`_\255T\254E\231\227\324,\203\222\n\025-.|\201IW\264 k\222\201\225E\313B\324\370\212\202\201(\003#\003\003!\215z-\275"
+	.string	"\223J\243,\274\2364\300\276\244\033\216f\210I?Z\026\275@\003\004\030\231\bi\324\353\311_\r\034l\245\210\300@\005\026\324\212\026*\244b\026\300\312\242 ^\210\215\225I\305\274\222\330\013\213\254L\n\026VFf\346\342+\212\302k,\313KE\226\264E4,\313k\214,\013\253"
+	.string	"\213\301"
+	.string	"\033\313*\023\023\033\313rZo?\236`/\007\313X\005A\242}\032\342\323/\341\005\203\232\270\376\037\275\252\247\276\007+*\247\336B\232\273\251oB\366\336{\235\270\276\t\255z\352\271\276\223\b\007\253\220\316\327$\345I&<\364\245\206\024\370\t\317\216\004\372Q\216p\005\236}\363H\344JHG\226@LVN\365Q\037\301\311\024\212w\033C\327\376\214\257>\352\273\017/!\3601\331\306\311\211\222'J\277\204\225}h\216\266\376i\260\357\257\b\302S}\017&\360h\325\003\236\3007\033\\\232\200\037\360\275f\b\352\005|\317A=\223\343\032\252\357B\26323x&)\313G\2409\305"
+	.string	"\317\274\301\34580\317\310\340\305\301\265v\332\"\363t\325\007x\245\342Z]\""
+	.ascii	"/\"\341\237\036\3007\032\247\227\340C\236\232\336\211\351\233"
+	.ascii	"\236\315\303\364\255\2355Bie\272\335\"e\022ik\351\267\"\225~"
+	.ascii	"\351\373\315\254\007\335\246{\022\250&<<P\372\036\004\022\346"
+	.ascii	"\364r\350\347\207\217\244\307\352s\362\210\204s\324\024\202\364"
+	.ascii	"\375\007\030\201\022\250a8\346\030SjDD\024$)H\322\030a\005\304"
+	.ascii	"\030\350\240\323\016\021`-T\252j\223B:2\007H\022\b\237\232\202"
+	.ascii	"\311\023\210Q\372\307\243\002<8;b?DH\242\024\275\247\317\022"
+	.ascii	"<[\315\200g,\005\005*\244\004\t\364\306\337\016\241\b,\224\346"
+	.ascii	"\027\324\034\227\245&*\315mzL\361\303]\331\205l>\335\271A!\321"
+	.ascii	"0/\331\327\305\204j\334\261\016\324\250\222\257\233\022i\336"
+	.ascii	"\033\201\353\343f,*3c\343<\271l\374\342\301'G\211\307y\314\017"
+	.ascii	"\261\026\205a\335\272$\243L\275\036\034\005\233T\300B\262XW\\"
+	.ascii	"\245\007\302<\005\325,i\223+\306/\313\270%\374\377\035B\016\377"
+	.ascii	"p\"\325,\362\b\251\036\210R\275\271:\327\302\302L'\337Yd\320"
+	.ascii	"\263\311\017\204\322\261\214\220\315\217+Ss\205\0306\316\300"
+	.ascii	"$\276\337r\bl\337\233I\234\337'\2261\326\037\030\313\344\001"
+	.ascii	"\311\224\321\235\005U\273\336o\275\347\242\321 8MQ&^\271~\023"
+	.ascii	"\306y/@M\231\340l\236\347gg)<\211&|-\214\n\373\004\246bW"
+	.string	";\357\370\027\271s"
+	.string	"\"\202\2128*\271\024}\370\305\316\375\233\264\372\330<\005\255#\267D_DR6\320/\253\005&\335\370\331\2026\241GR\023\257\347ad#\215\036@di\214D\250\037\224\243\303\006{;\207\026\002 !\264@\237\331\2256\007\206\212\033\342\r\216Y\323j\353\301\261\240M&\265\005\272\fv_[\336\261h\311\246d\221Txv\263\314\004\374)ed(\302\217x\275\006\002\371\261\360\234\004\212\030\027\254\022\350\300?"
+	.string	"x\241\213\033\210\367\365D\270?\265\276\222u\217\305\360\265\023{\0305\245-"
+	.ascii	"3\340\233\0344\371\375\352\213\021\241\005\250Y\361\217\273\314"
+	.ascii	"P\340\244\t\004T_\235S\332P\246^\320g`\323\375\007L\036\220\256"
+	.ascii	"h\347\323\370\035;\272\276\210_q\206)\200:\215-\274qx\236\002"
+	.ascii	"\314\306hI\274\371\217x1&\273\271vA'G\214~\374)LF\376"
+	.text
+	.section	.gnu.lto_resetAdjustmentStates.96.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\r"
+	.string	"U\007"
+	.string	"B\01646Po\322\001\200~\310\236ZS\"\004]&\0356\264\f\3012u\230\030\307 K\020#\341-!\007\271,o(\315\314\254\210\017\f\025\033fQM\377@\264\333\226)\005\2462\027\326\331p\260\313\023\341\240i\240\254H=\304\016\204\206\023)\353\212\031\003W\022\033+bUeE\314\334_\366\201\002H \243\317\263\360\244\2367\312\244\360\217|f\004\335\356\347\322'y\211\307\017\035z\"\323\313C?\233\016m\212\n\275\364\301\305\333\234@\022\245\254\262\330s\323\307a\377\262\017d\277\201\216\020\367\256\264\253Qj\331\021<\371\260}\2145[\345\263\333\202\220\f\f\223\225\335\215\317\343\332U\363/r\001\311mW"
+	.string	"\206\335\265Jn\343~\267\215`{\301\266(\b"
+	.ascii	"3\241k\037\370(\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_updateAdjustmentStates.97.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\241\b\265."
+	.string	"\032P\340\021CP\\R:3w0\221\212e\314\025\335\310\036,\262\336|\023\005\022~PCup\3103\031u\373\377|\254\327MF\301\232EI\346\313w\032\361\305C\204\021\350sV\205I\371}q\013+\266O\b\331;\311\004\001"
+	.string	"\001\r\001@\22225\377\211\226\206\346\227\263T\206t\270t\304\251\277\326wk\342\331\245/\247\263]\252|[\337=?\363\275"
+	.ascii	"\323\234\370\345\234%\234m\027\303\263\307\033\333\263\353\005"
+	.ascii	"\264gO\354"
+	.string	"^Z:\335\333]\001\203\362\321 \005\036h\032\315\313Y:\241\231\206g[\331\335w\351Y.\220&\326U\0060\347\334\204\253t\361\253\364]\274\312\033\025\211EDCa\313\256\370*\373j_\020Vg\013\017\032\247\326\215\326U\220 \333\251`NV\247&\263\355n[\267(|\242\362\034;\261h]\272\343E@\023\271;\217\273\202.`a\227H\301p\275\260\307\031v*\230\330JD\322w\347]\300\230\\\3411\347Ltv\335\366T\260&D'\327e\223iP?eO\261\257k\004\2775\203\216\234BV\343W\226\346\343~\2118\231\027\337\355\254\024(_4\260\3549\366+|\3129\367m:\237\357\243w\277\330\335^\272\205m\002B\320\2429\347\rl^'\325G;\3338\246\356\233S\355\331\336\321TC(O\006X\246Q\300\2343\205F\221\204\370W\226\347\036 NsK\022.\200\222\360\325\374\030w"
+	.string	"\323\252\032\025\347\321M\031\202[\202\007(\313+\330w\373\232Vv\341\352\350\002\377\344+\330-\335\272\330\254\373\020\264\300\001l<\245[\351\321\177\300\247o\343\333\336I\353m\244{\373Hx\333\350\336.\no\023\327\333E\277Mto\017\205\267\205\303\333\355\275\315\no\257\3676\276\267\257\360\366\r\354"
+	.string	"\373:\342<\024O\316_\203\205\362\036\313F\313\247\177\333o\367\033\353r\3759$.v\200d\321\356V\036\231\322\354\374\0334/\nXa\212\323\275W\203\3654}G\"/\237\035\314\2304\363&\234\355\033\021s\352\277\365\315\374\314\343\306\320\370\250\223F\346\027\344l\232\365\264\345E\"\355\312\026\036\303\263K_\310\274\214\362p\001O\372\342\204\327s\"\374\252\202\333\342!\356V\262}\270o\022\341\243\020\254\325B<\304\230\017\210\007\202B\212\002\350\217\020{\200\256\335\317\n\001\237\210\367\031q\002k\356\302\260}|Z\214\3714\037\233^\2226H;"
+	.string	"_\275U\231\227\220\0365\333\371\341~\\\312\275\252\302\001_\3169\371<%\016"
+	.ascii	"\317\371L\234H\221B\305\212Y\374\256C\335,^\007\352\3069w[\350"
+	.ascii	"PW|<\350\232\033#\376\364_\002e/K\303Y\316\3147\273\373\307\345"
+	.ascii	"\264\370\034_\316L\275\307y\261\302\210\321\306h\317\032\361"
+	.ascii	"\252\327T\302\364\2131F`\207\213l\013_l\300P\327!\274\276Q\273"
+	.ascii	"\266'{\300H\225Bd\031\227\365\371\252u\277\230 \365o\205j\217"
+	.ascii	"\257\336\3620/\241\356\236\3617P\3026\273B\314\fn\360\236\207"
+	.ascii	"\304\b\240k\313;\330\237V\331\250t?\232\037\325\374q\277\032"
+	.ascii	"\\\335^\240\337\362wT\270\314Y\363t\3354n\027\205\t\374\221\013"
+	.ascii	"\235\003\252\225\302Q\205\\\201c\352F\225\025\210$\251$2\311"
+	.ascii	"\002\351\207\224\215\252)\266m\\\300\240\241\006\007\0137\230"
+	.ascii	"\224\220Id\210\037+\244\260ZT!\243\212\035\305\204\225\254\222"
+	.ascii	"\242Jb\371\320a\003\t\025u\325\024u\243\251j\nI\325\024u\205"
+	.ascii	"\325"
+	.string	"\304\224\240\255zH]5%\255\254\256\232\210\322\345\325>\204s\223\003\375\226x\313\b\2335\321\nQ\t\343\352\225\360$L\244\370\276k\2230\210\301\262\247\345\025\374\232s\316E%\374\266\037\227\236\204\225\360\215t\3251\267I\304f\202/\022'\f\221\346\022_\240\300\236\203v\301R\204\315\332\210\221\256W\326\301\302\364n\327\345B\302\r\240\177^_\330L\211\036\\#.\342\2434%\230\373f\037\271\260V\033\341#|\323\260\270[PFmw{wy\265\214p\006\".\342\233F)\346\203{\207\f\021\357\264\352\247\211\214\344\r\032b\263~V[\204_\246\034sBY\177\206\341e\b,\321\216\205\265\t\363w@\025\355\331\"\334 \217\234\013\001\200\251\250a,\206\224r\314\214\214\214H\232\244\320\001\240\002\221\241\252n\021@\271S\210fD\244i\375\r\211\205\275x$\r\247;\f\370\226T\210\032\254\333\001\206"
+	.ascii	"\341\201jW28%\2319\313[\254dw\353ScL\216%c\001\331\302\312\306"
+	.ascii	"\315N\t\214\231D\030\272\363WV4c\201\317v\001t\320\263\230\242"
+	.ascii	"yGg\347\307O\375\306\324%\331\\P\031\2759\231-/\273\206\374_"
+	.ascii	"\3504\254u\345\031\342\222\030\025\311\251\204M\350\r9O\320\013"
+	.ascii	"\236=h.)%\f\376t\233% \2030\r\317\027\351&y\237x C7o\035J\256"
+	.ascii	"\023*\314\231\213\033\326&\315\355\257*\244\034[\005\262\352"
+	.ascii	"9Z\007\035\262\031f\271\231\264\312\311o}\231:\330\224\363\213"
+	.ascii	"/\325\034-\242YL\335+\311a_\0271\250\017\017.\0346C\352\022\264"
+	.ascii	"\372\331\263\t\342\326\237\254\"\221\205\352\326\216Z=\252\373"
+	.ascii	"\250\237\215\370\271\225\016\177I\021\343$\214\270\343{j\326"
+	.ascii	":m!\345\357\310\341\022\200W4=\301\r\217\311\374\f\252\\\n\311"
+	.ascii	"\020W_\262\370\211\004\201C0\237\305K\023\2244\253\376\277Ls"
+	.ascii	"\216w\205\340Ma\2036\244\021+e\311d\001(q\361\r\r`\264'\002\307"
+	.ascii	"J>9\n\206\364?"
+	.text
+	.section	.gnu.lto_isAdjustmentFunctionSelected.98.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`E\002M\024"
+	.string	"\306&\212J\300\322Q:\"\006\306\365\021\324EF\204&lf\250\035\353B8?\314\343\217\344\367Zn\2041~\317\027I\304\337\350\203k\274\276"
+	.string	"JZ\203\312C\tH"
+	.string	""
+	.string	"$\277~J\005\304\325\254h(;\024\024k\310f\304\022\262\367N)w"
+	.string	"k"
+	.string	"v"
+	.string	"\273<M7v\313\005~\221\027\031\230\304X\367\362\347f@0\251g$d\267\204\321\023\256\257\345=N\335Y\243X\351\324\3712gU"
+	.ascii	"\303\240\035\022_\257\226\374\224\206/?m|3s\\\221s\261F\030r"
+	.ascii	"\201\202\3028bj\371z\263V\001?\245!\211\017DU0\f\332i\371x\223"
+	.ascii	"\276|\202\235\250\242\035I\276\234O\026\312\356z\326\370pn\362"
+	.ascii	"\266ql\257\330S%\024\370\334x\341'\224\330\225\257\301\017}\232"
+	.ascii	"\3309\304.e&\005\332w\020\022MO\246>6y\241\237\345i\361\302\273"
+	.ascii	"\212\323\264NO:\375\221\213h\321\003\244\007\324\201\230vo\256"
+	.ascii	"\210\354\223\210C\305\205\277}\227T\212O\344\227n\271\246Rla"
+	.ascii	"\356K\263\035~\2024|\354\226\256\213\246@^\274\035c\267l\227"
+	.ascii	"S\n\235\027\312\231\006\007\236\033+%\351ixf\346\225\305\262"
+	.ascii	"Jg\206\240\002\366\210\024\310\242\224\316\037ES\262\317\270"
+	.ascii	"@\356\362N|$\0173rw)\275\215)\242\335\274\372\344q\032!\2540"
+	.ascii	"\343\244\266\"*\336\264\262\235\3412`\020\374\354\356\211\355"
+	.ascii	"\0177r) \265\273\017\212\036\243\346\003]\364\206\333|\315E\377"
+	.ascii	"6^\234t\204\250\322\323\032\325+\262\233W>R\325O\007\375)\rY"
+	.ascii	"\320\034d,\264\231h\226\006&\016,@(iy\021\240\325f\270\030\355"
+	.ascii	"E%\200c\257\033\216&s\301\335^0\260\254T\210\331`\261\026\030"
+	.ascii	"m\266\342\002\213\331n\260\227\001\3274\310l0\\\255f\203\265"
+	.ascii	"l\273\334S\037\222G0\307\321\322\350\353\306\227\037\001\n\326"
+	.ascii	"8Z\252\277n\024Ej\224\035\235\201bQ\240[5\"I\305\024\363/^\251"
+	.ascii	"\215\004*\336\264\022u\252QvsH\335\335\035Iz\341\003' `\002)"
+	.ascii	"V\307\003htF\272\241\366\f\345\026#\371\356Q\253\310\337\331"
+	.ascii	"\356\326\023[\3101a\275x\034\234\331\240\362\305:D\354gl\334"
+	.ascii	" \f\021\254c%c\200\260\372m\333\361Z@\302GfWV+S\"\261f\217P0"
+	.ascii	"l\017\311\263{\331\313R\304-tJ\343\002$'\360\353\242d"
+	.text
+	.section	.gnu.lto_blackboxLogInflightAdjustmentEvent.part.0.117.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\352\001=\021"
+	.string	"\026`rI\320\2628\035JF\020g\004\033\032P/X \341\264q\321\337"
+	.string	"\211\334\030i\246\226>\321CY\233Z\236Q4k\016\372\003\327\013\215Cv4\251\n\307\205\027\371?\326\334\2776\201\177\243s\366\266)\006\3000$\033i{\247\024Y"
+	.string	"\\"
+	.string	"^"
+	.string	"\262\225\036%J_\372-\356\202\374\013\017\\\200\215I!Bg\267<\360\316$\357\335\350*\241w\334SB\357\354\263\260\375\222\231\264w\274\274\331\021\032\217\214\031dw\277wU\305\311W\312\221\376\315\223\304f\260\327\222\031\211S\224s#\017v\327^\211\273\273\355\026\333\242M\033\004/)"
+	.ascii	"trbwD\320\220\245\351h\254\370\355\267\357\337\016\303?-\362"
+	.ascii	"\353\266\226G1\345\302d,!J\277\335\364sXb%\3739~\214\313 oky"
+	.ascii	"0\331\004\232\016\036\2732\003\357\034\366\230\3347_\266\310"
+	.ascii	"7I[\344\232k\205H\251\322\343\324\\6\235\335\245\340\275\363"
+	.ascii	"\253\334Y?\301\333\360\211\001x\030\262/\234\350c\036\201\250"
+	.ascii	"0\2073=@?>*dg\370\211\362\371\301S\253\235\372\351\032@3a\262"
+	.ascii	"s\203V\233\303\317\225\312\315\356*x\354\347\225V\016\210L\021"
+	.ascii	"\030\032\344\224\0328~\336\3131C\003\364\263T\b\2556\256\034"
+	.ascii	"\267\273\353Zc\037\347\257\0355}\371\007\246\321\004a\024\303"
+	.ascii	"\016!I\310\322`\222\320\nE\317.\tZ\026X`\200\340\205$@L\235F"
+	.ascii	"PdE@1HZ\215b\210\032W,\f.\246\n\240\352\003_>\361dB}\240j\365"
+	.ascii	"\221\b8\265!T}c*\245\372D\266\351\271\2555\276yo\307G\017L\375"
+	.ascii	"\340Z\253\215\355\026\267\213\302\001\217\032\r\362\t\375\214"
+	.ascii	"* \240\202!\2649\006htH^\370\3370n\377s')\223\250\017$\304\037"
+	.ascii	":\031\037\346\215\215\003\017w\305\201\337*`\251\344eD\232\013"
+	.ascii	"]\274\233A\017\035\316\025\327c)\322u\300\n\263@\016\221\340"
+	.ascii	"\007#1Z\363\226\252\214\261l\036\013f\362\236Y`{A9\355\323\257"
+	.ascii	"]c"
+	.text
+	.section	.gnu.lto_.symbol_nodes.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375`\247\006\255\027"
+	.string	"V\345\212J\260\226Q:Q\275M<\001K\017?[i (\301\3574\350\320\226\215T\bX\224^,\325\177_\333\2704w\261\314\331p\223\344\250*\376N\b\201\377\007\375\007m]4&\274(\306\343\353\263\241'Y)!\321z\233\304J\"Su"
+	.string	"t"
+	.string	"y"
+	.string	"0\0246.\316%\021\f7\"\376\207s\224t\241\376\2349\022\361C,|H\224\331A\242R\241^\211B}R(\233\371\234\227\303!4\241\276I\350r\250\326\237$<\212\370?\205\353P\304\016\006\201F\021\352\231@\2507\032\037\324\037\205\016\352\213b\032\324O\2052?\"\366\317\245\220\327\223\210\377\307\230L6\003\362\327_h\306\253X,\026cP\257$\374Oi\001\001,\013\220\252!5\322\346\313L4\225\204\004C\233K\016q4r"
+	.ascii	"ah\217\347jl\256\261\306\036\317\225\330\\c\211\3152f\036TOC"
+	.ascii	"\275j\032\226U\217\027A\367\211z)\023\365Q%\352u$\352w#\352\235"
+	.ascii	"\210\250\347\205\250g\002Q\277\364\241\376\211\207\372^\207z"
+	.ascii	"\037\207z)\033\352\23386\213\375\257\240\206z'\316p\"\361\217"
+	.ascii	"\001{q\303\302fE\367\347\364){\302\\\310c\356\\\234lE;\324)_"
+	.ascii	"h\2079fh3E\332!-\264\300**\373\273Q\027\3126]\337\355Y\336\325"
+	.ascii	"\325\202\314\237\235\317\256\307\314\355\230\3472\356\324)\371"
+	.ascii	"V\262\215i\245\013\355\272\233!\223Qs\241\r\303\274)[\264af\013"
+	.ascii	"\223\017(\005w\214\264mN\025\265\026\355\232\223YrG\275\221\366"
+	.ascii	"\253\306\241\217 \300\026m\327\213m\221\0318W\314gY\006p\243"
+	.ascii	"\350\367\225&\260\3433\005-\301Y\260\0223\240a\226Y=h7JvM\311"
+	.ascii	"\005\256\016#\027\331\256\222glL\025q\221M\363\"\233\304Y\356"
+	.ascii	"_\225\242\2216\331B\233\274\355\022\320&sH\033I\013\002\253\354"
+	.ascii	"\224\373\273Q\326\3516]\237]\272\274\253\263A\027\350\376\330"
+	.ascii	"\236\373#\307\203\323\271\265\255im\201UT\277(\250&_O\001\355"
+	.ascii	"\220w\352\312\323\002\005\200\211\2501,YA\270 )\250\324\030\016"
+	.ascii	"@\003\021\251\246\003\021P\030f$+\223\202\202\024\245\0032$Y"
+	.ascii	"-\264\243*\314\024n\204\311\342!\272\277\016\367\260\227\256"
+	.ascii	"\315[s\035\326M\356\332a9\366:\204\205\0031\001@Y\243,~fh\344"
+	.ascii	"\023\222)\2404\005MXb\340\004EK\334V\201\3135\256YV\340G\204"
+	.ascii	"\263]\n\211\331\201\314e}\266\363\037<4\"\261)\033\364n\3240"
+	.ascii	"Q\261\306\336aF\023\207\323\214f\200+\236\351\265\224\310\264"
+	.ascii	"\224\310h\224\311\216\366C\313a\300\"\026\250J\025\036\037\321"
+	.ascii	"\225\231)#l`\247\204`[\243\235\362\330\311\256\317M\276\347J"
+	.ascii	"\373q\322u\031\032\f\033\033Lj\214\\\202U\001"
+	.text
+	.section	.gnu.lto_.refs.4396214808090bbc,"e",@progbits
+	.string	"(\265/\375 \274E\004"
+	.string	"\202\312\035%pk\322\001\260\030\346\007\001\353\377\013r\205"
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\340\002\230\"\177q\375\037\221\266\326533[\324\272\224)c\275"
+	.ascii	"^\025\360\007\271\203\317\270W\334'\370\207{\303u\302=\026\350"
+	.ascii	"\324mI\227\255\370\035\316FC~\246|L\377\013?\302\207\360\033"
+	.ascii	"\345\213>\202\274\300\2378e\375P\246\376dRoe\022}3\250W\002\025"
+	.ascii	"\320\036\224_\375\212|\"\217\310\033\277\375\226\005\004\001"
+	.ascii	"\3452p\223\241\210\226\t\213R\006"
+	.text
+	.section	.gnu.lto_.decls.4396214808090bbc,"e",@progbits
+	.ascii	"(\265/\375`\274M\365O\001\0327\266{T \016-\235\306\024\310DS"
+	.ascii	"J\303\205\217\301\261\017\017\005\006\327B\222\215\225h\f\026"
+	.string	"]\fH\247\345%\004}\252\377@\257]l\306.5\032\370dgF\327\316\334k&]\260]\003\313\241\034sn\265\373\330\272<\220\373\212\306\361\223\343\237\304\221Dn\271\245L\001\326\006\254\007\355\007\271hL\356\262\275\267\320\002\204\250\340DM\f\310GY\324\235\233v\231D\211Qr\261\227s\007\r\251\030\027\237\327D\337\322q)s\223Y\340 \317\256\331\325r\273\334-Vy\271\\,\226\313\215\342\346\003.W\312\275b&\221\272*\212\355zq\261l,\232m3n\023\315[\025\335\327\336I\243\037\037[\2528\371\301\347\371\320\347\325\260\222\374\321\222\022\247u\361ySU.\025\253\274eW\231\234r\005\271w\362\226]2\020\212u__F'\331\327\214\273\214\237\323\350\3474\375\214E?O\321\317Ft\bK\224\377;\246\304\0043\232u\271\370\277bP,q\214\233\222\213\257$\245\310 y\201u\361?"
+	.ascii	"\263l\314x\254\321\201]\025\356\027\02620N\356\223\033f\225\027"
+	.ascii	"\314\226\375v]/) \260\242\330\025\215\233p\020\262JJ1^\374\314"
+	.ascii	"\245\211\334$dX\226Jn\217+\304L\"yf"
+	.string	"QW\376\313\344.\261\312\253\344\016\341\340#\306\266\366\2241\022\037\256\244\230\272\213\237] \255\362\036\271E\216\\#bH\240\033n:\3260\3769G\377\034\243\177\232\351\237aA\212\204\300t\\\331\027\377\354\241\377\337\037Vy\201\334\025\356\301\211\333\344\336a\027\310\365\341\345\244\212\316n\357d\221\321\017\032\330\206\202\361\317\243\376\tC\037\347\321\307tt\221%\312\346q+\f\324\230\213\355\026\252[D1U\354y\021ecyw\\\033\367\306\325qs\\\034Vy\271\256\326\357\3265J\315\270:A\303\242\005=]\330Qhb\\\256[\203W\305\313J\306-\3326\343\205-E\206\205\334;\371\017~\273\205\353f\335\242\207(\342\206\342\321A\222\355Vdddddt\332\361\240\261\203\360\335\226(\177\260C\371\030\212>N\242\217W\320\3078\364q\226>\226\322\377-b\001\341\240\322\365\346\342[\345\305\272\222"
+	.ascii	"\023\034n.\276V7\306\357\325\255\332\367\312\304qo\250{%tgo("
+	.ascii	"!kAX\013\002;\3612r%\343\233w\372\246\034\375_\030\227\370S\026"
+	.ascii	"%\027\345\342\377\367\305\235\272.\254\362\022/\324o\324\225"
+	.ascii	"\372M\356-5f\355\200Y\272m\357\202\316\275\217_\310\275\367%"
+	.ascii	"\336'{\027\004\225\374`\204K\354k\357]ddd\024\344\304\216\214"
+	.ascii	"Q\343\016,Q\316v(\337\024\3237\213\350\233:\264\275c\361X%\007"
+	.ascii	"\233G\356GT\326\3057kh\026\354m9d{wg9\344\233S\372\267u849\333"
+	.ascii	"\261\002\035\264\213\206\214U\224]]\336ra\007\313\305V\316\316"
+	.ascii	"Y\345\006V\316\355\034K\367\023*\271\223{'\205\256\020<V\310"
+	.ascii	".\276`\211\362\305\243o7\310\346\335\235\335 \3776\316\215\367"
+	.ascii	"D\315\253l\371F\013A\002v\343\342\33316{\246\207\216\345\336"
+	.ascii	"\373\215%s\263 \251\344\036\222\325pi\251\331}\300\306\242\361"
+	.ascii	"z\340\320R\203c\343X7\026\316*\355\033\333\346\366\315B9N\356"
+	.ascii	"-\265\367\376\2117\026\215u\013zJn\254\334#\207\226\232\335\336"
+	.ascii	"I##\243\"\243\323M\0343 >\370\307\016\345_#\3727\207\266n\327"
+	.ascii	"\252\261kn\335l\232{p\342?R\326\r\357\re-\210 kA\234iD\240\310"
+	.ascii	"2\376\325\322\277V\332\226\261mV\3714kf\013Y _\236\200\\\374"
+	.ascii	"+\245\235\366\336\333>-\363\236\226o\355\350[8\375\3331\031\b"
+	.ascii	"%\265b\250p\361o\305\204\271n\204\f\211s1\230\"\263\006\f\262"
+	.ascii	"\270\213o\305\350\177\360\227H\263Ul\026\024S\305\036,4w\302"
+	.ascii	"\376\022\267i6i\251\230Q\212\272\n\031\236\245\205\362\227\370"
+	.ascii	"=8a\323,\027\213f&\221;\n\315\231\003\244\340\3012f\267w\362"
+	.ascii	"\277U\263_\354\232U\3324\253\345v\2135{Qr\357,{o##\243\242\237"
+	.ascii	")wF0\032\3333\333\305*3\260^\356\301\211\233ORv\330\336I!\240"
+	.ascii	"<`y\354\\|\353C\337f\220\355\235\315 \337ni\273-Q\276`\207\362"
+	.ascii	"\255\013\375\333,\277}b\303,\026\223hu\334e{'1\004\235I+\302"
+	.ascii	"]|%\211\257H\241\271\271\370C\375\337*\255\025[\226\334E?t\313"
+	.ascii	"*H.~O\277\003\332F\261R\2542\204\235r+f\307\336#\225\334\312"
+	.ascii	"\275\223B=ns:\312.>\006\364\217\211[\262o8\263O\374G\337\206"
+	.ascii	"\310Bwwww6D\376\325\037,Q\306v(\277\315\022\345'-Q\326v(\377"
+	.ascii	"W\215i\374\377\006\347\377\033\253B\275\360\3435\346\376\027"
+	.ascii	"\313\200k$\350?{\377U2\267~{\001\023\205\326o3\360\333\022~\263"
+	.ascii	"\306\1770\326\204\033\304\244\361[\013\330\024\376{\374/\017"
+	.ascii	"3\004s\306o\312(\376&\214{\343<\361\233\035\020\317\373\317\003"
+	.ascii	"\374\267\312|\361\333\r\314)\323\305\377<\277\311A\352\267!x"
+	.ascii	"1\001\020\365\277\350\033\374\326\204\372\315\247\337\334\277"
+	.ascii	"\331\202\377)\330\253\037\340?7\360\360_<\277\311\002s\005\277"
+	.ascii	"yS\005\366\264\330L\301o\n\241\340\277(\2403[\374\246\007~\363"
+	.ascii	"\003\277\331\201\337\f\301o\366~S\004\277I\202\337\364q\372m"
+	.ascii	"\360\2775X\374V\375\355\357\267(\370m\325o[\360[\341o\227~K\374"
+	.ascii	"-\360\267\353\177\241\314\025\277\035\376\226\352\267'\370m\214"
+	.ascii	"\337$j\372\357\301\\\377\027\375&\372\233\026\370\315\n\374&"
+	.ascii	"\t\346\004\3543\360\237\034^\200\272\024\340\272a\034\023\002"
+	.ascii	"\377\275<\005+\202\377\374'\357\277'0\037\360\3376\377\247\230"
+	.ascii	"\016\370\257\306\212\340\026~\254\346\277@\265\247\375\377\362"
+	.ascii	"\037\314\035\301\311<\374&\003~S\001\277e\200\227\017\375\330"
+	.ascii	"\313\177\203\374\026\204\337\206\360[\005\230\370m\002~\273\301"
+	.ascii	"o\215\376\367\374'\007\376{\366\337/\377U\373/\332\177\273\374"
+	.ascii	"7\355\277`\376\333e\206\360\337\261\377r\371\257\331\177\240"
+	.ascii	"\377\\\362\233 \374f\211\337\324\3407;\374\346\206\337\314\360"
+	.ascii	"\233\027~\323\302o\232\277i\377\233\347\277\313\377\276\375"
+	.string	"\327\355\277c\376\033\346\277F\376+\344\277]\377\275\361_\255\377\316\370\357\325\177\255\376\033\365\337\024\374w\370_\365\277\300\377\376~\273\200\337z\340?\230\337\242\360_\364\277$\370\357\b\376\033\202\377~\340\267_\277e\362[\257\337\362\370\355\325\377)\277=\372-\t\376\233\371\257\346\177\n\377\351~+\202\377^~\373\201\337j\340\267)\374\266\001\277e\300o5\370\255\376O\347\277\335\377\272\377\313\377(\374\217\023\346\177\212\377b\376\003\335\335\335\335\375'\332\177\001\316\237\200\267\313]L\212\370\005y\364\255E\313%\214&0\032\234\346X\315\261\032\334\346\356\2757\222W\005H\330r\033\213!~\314\346\270\r\234\037\017\347\222d[\225\213\361\032\213\246D\3128v1v\263h\377{\262\026\035XL.\376\034\233\345\177\217\005\037O\316\260]\374\013\336\364\177\373\373\347-\343Ln.Q?\371\267\267\347m\210\037\310\2326"
+	.ascii	"\377\361\336\357\371\222\333\005\2364{o+'\207\351\332\222\363"
+	.ascii	"a\377\377\335\373\351X\304@\334{\357dW\026\006\242\262"
+	.ascii	"\253H\224\352\332\262DeW\026Q\331\365t\211c\240\262\212\273\353"
+	.ascii	"I\357c\326\226\332[\023\241\366V\036\2630\020\245v\026Q\271\213"
+	.string	"\026\222]{'\273\236t\022\252\270\367\206\262\304d\327\221(\325\225\205\201(\325\225\265\225]Y\226\250\334\305-\265\213\031\210{gmeW\234%\356\256\"Qy\314\302\260]\214\331\240\312\203V\303\322)\373\022wF\224\332W\035\276\244\216\3056b\362h\271\354\375T6\265\2136\271w\327\3369\216 \270H\025y\342\022\325v\3053J=\331\210\021\345u\354IF\3556\242\222\243\322\324\336lv\f\023O\366)\271\367~\261\243\236\354\336S\311\342\336QG\022\030\367\336\373h\323\274(n\240-\005e\025\345u\374\231\212:\276\330Jx\330\275\367\316\"*\275\216%\316\250(\221;*\371d\211V\307\215\334l\272\212Z\371\224\334\304\275\267\235\003\252\333\242\306\356\342dr\357-\024T\007\rV\035n\003c\267\213\027\377\002%\232\203-\023\307lJ\314v\303\364\020\367\236\301\301VW\2355\273],\212\370\005Qz"
+	.string	"_&\216\307\334*\361\030\034&\304q\313\350\200\016\2179\244]\214$Dj\\\374\rr\372\307bp\030\2370?\262\f\271\030L\006\344\276P]\374\rn\332\024\203\253D\220\265\327\260\032\326\201\223AP\311\375\304\"n\016\371\205\277\3404\274f\225X\r\3378\306\201s\334-\254f\216\231`l\333\217s\r\214\373\206,\222C\343\233a@\206,\233\\-\221\314\035\231C\332]5\\f\346\220__1\226aC\200 \223\334\030+\262#\210\020$\235\217\"H\244\216%\235\021s\310\013\256%\023\250\020qqsH;(;\254\233\211\272\2639\244\235\022\033\313\025^\030\331\022\022d\331\365d\271\344\205\021\331\343ky\206\253`0L\206\235\3400\034\005O\301X\360\023\214\206\263`%6\303bX\013\266\202\257\3401\334\005o\301T\260\024\\\206\275`.\030\212U\342\344\221\034K\"U~$\327X\251"
+	.ascii	"\266\274[I\374\243\n\221\245\027\013\036s\310\257\275\223\307"
+	.ascii	"\307\377n\341$\346a\335\352\242\314!\355\202\224rs\260P\340o"
+	.ascii	"P\323\337PE\177C\023\375\rA\3647l\351o\240\322'\302\243O\344"
+	.ascii	"F\237\210\214>\221\026}\"&\372D]\372DX\372\032\352\350kx\323"
+	.ascii	"\327\360E_\203\230\276\206\"\372\032v\350k\250\322\037\262\323"
+	.ascii	"\037Z\243?\364E\177\b\212\376\232%\312\037\n\242?\264\245?DC"
+	.ascii	"\363\216\226(_\216\035\312\037\"\352[(i\326\220wk\f\2333a\332"
+	.ascii	"`A\003\006I\246\314\3352#f\215\226\267+\270\312\204c\3361\223"
+	.ascii	"\310\021\324@Y\356\275\337\224-K\340*\023nly\267\312\220\tcc"
+	.ascii	"\303FL\003[\341\030\370\005\236\201\267p\rl\003\303\300D,\003"
+	.ascii	"Oa-\234\205\2510\026\276\302E\253\304U\277\351\304|\342\306\212"
+	.ascii	"\271\245\306\314m\313\335j\033c\267\340*\223M\226\245\231\031"
+	.ascii	"X\346B\340\337\344\234\257\353UWD\016\330\t:C\302\342\236 \353"
+	.ascii	"\b\241\263#Bg\304\214\263\f\303\203\237L;8\n\2730\363`)\363\016"
+	.ascii	"C\341m\225\346\235[9\363\2169g\321z8Y\n\321q\021\241\263\001"
+	.ascii	"?\303R?\303\030\375\fW\3643,\321\317\320C?\203\226~\006)}\fr"
+	.ascii	"\032\205\030}\fQ\364\313,Q>\206'\372\030|\350c\330\322\307\260"
+	.ascii	"\365/\304\351_ \243\177!\213\376\005&\372\027T\320\277\200\245"
+	.ascii	"/TG_h\215\276P\030}\2412}\241&\372B^\372B/\364\203\340\350\007"
+	.ascii	"\241\351\007e\3217\267\252\32013\271\230^\314-f\027s\315\324"
+	.ascii	"b\2061\317L53\315\374b\242Y\245\t\3467\241\230bf\330\024;X\340"
+	.ascii	"JX\2113v\005N\211,o\220R\256\364\310\243\264uAP\027\266\224\213"
+	.ascii	";\3102\273e2\212\232;\273%y\305\007q\271w\022\214If\353\314$"
+	.ascii	"\027M5\005\214I\305\242\311\r\240\f\2179\244\021/\007T\0230\017"
+	.ascii	"\370A6\364\203\250\364\201\354\364\201\332\364\201\312\364\201"
+	.ascii	"\276\364\201\274\364\201b\350\377\304\321\3779\323\377\021\323"
+	.ascii	"\377\t\242\377sC\377gK\333\244%\312Ev(\177i\211\362]Z\242<\302"
+	.ascii	"\016e\002p\231\270\371\2454\277L&&\330\r\243\212\314\206\020"
+	.ascii	"\026&5\274.\376\217T\023&\026\262\222\324\201\272xI\021/\212"
+	.ascii	"\027\325\232\213o\201N\3777\215\230H\314$\346\021\023i\225\246"
+	.ascii	"\022\223\310\n\326\315L\"yT\274\254z\330\273\022gbt_>\252\226"
+	.ascii	"J\314\037\346\020\333f\334Oq\035\034\341!Fg\267\367Vb\026\331"
+	.ascii	"PO(\216\230\021\243\263\363\321\"uw\345\007\337\302\230\276\205"
+	.ascii	"#\332\004b\006\261\312\"S\310\231\250\253\034\027\337B\020\335"
+	.ascii	"\202m\213\362\357lQ\276\205\031\372\026\246\364}\360\350\373"
+	.ascii	"\274\351\r\314\230\270\351u\2534\275L\036!\364\226\262c[\356"
+	.ascii	"m\024qb}\275\351\270\370>g]<VP\323v\345\342#\020\035+3j.\276"
+	.ascii	"\017\024\375\0233\314d\254\025\303 o\2304\234l\t3\212\301a\352"
+	.ascii	"0m\230\\\346\0163\207U\2327\314\0327\265\314\255\033f\226\255"
+	.ascii	"\013\202J\356\"\017KV\022\244\335\217\230\2213n\202\360}\266"
+	.ascii	"\364\271X\242\354c\207\362}\242\364{\362\350\367\320\351\367"
+	.ascii	",\365{\322\350\367\244\351\337\3042\257\232\310=\371rq\f_\031"
+	.ascii	"6/\027\277'\212Iu\351\314\035t\356\255\202\033\244\r\213\273"
+	.ascii	"rt\220&\321\204aV\231VViR\231O7\241\314(5\177\t\223\352\256\271"
+	.ascii	"pwH\273\205\312\2242\247l\233\221\001h\252\226EFFgU\2276U>\370"
+	.ascii	"\037\230S\246\013*\363\205U\232S/\272ko;V\300\370=E\364{\200"
+	.ascii	"h{\264DY\203\035\312\357\251q\347\342\271y\256\235{g\225\346"
+	.ascii	".\253\303Fg\001]\330,\355\230\235\255k#e\356[g\353l\333\217\007"
+	.ascii	"\240\275-\315]\006\271w\022\210\214\233!`?\370=W\372=/\3645\035"
+	.ascii	"}\375\246\257\315\310\305\221\263C\312\3357p\220r\356\234;g\225"
+	.ascii	"WNM\377\204\033\213\026d\356\315\205\007y\341.\233\373\026d\356"
+	.ascii	"\r\225\007\271\367\206\273o|\214D\361\352b\027\347./\034\253"
+	.ascii	"\274p\377u\273\311\313U\026\247\245\3615\020}\315\245\357\333"
+	.ascii	"-\032\t\206FlP\271\330\316)\361\333\306\344\2426u\347\342k\243"
+	.ascii	"\276\316\322\247\035\312g\223\006\315\0314&r\027\3373E9\356\214"
+	.ascii	"\221%\027\237\007\247-\340I\032\271.n\273e|\264\242\2426\333"
+	.ascii	"%\203\207\230)C\347\342\363\254\3341\307R\216@&\224\026\0313"
+	.ascii	"1a,\232'C\246|Y\273`l\230\237\343\005?h4f|]\214\367P\276]%~\277"
+	.ascii	"\f\0053\316\312d.\231\315L\"'\020\005\266\314mV\231\313\344)"
+	.ascii	")le#\207\034\214\377|\366\314\366\347-\331,\223\321\262\006\306"
+	.ascii	"\335\305c\314\252\302\\\\|\020+\350\237\360\322e\b\022\rM\220"
+	.ascii	"\374%\253\235\360B\247\365\225\327r\230,&\203\261\312\374%\247"
+	.ascii	")\201h\324qa\345\203\017\302K\037D\016}\0207\364A\030\365Ahi"
+	.ascii	"S\253\304\363Y\376\"\332qr\361A\310\320\267\315\022e\003\330"
+	.ascii	"\241|\3121\301\252\207\324\305$\256\260\344,X\236\344\321#\330"
+	.ascii	"\254\344+\331J\256\242\237\312>\244\321#\212d\262\\\226\311r"
+	.ascii	"\025\273\213q'\300\272\324Y\263\313T\236\253\300"
+	.string	"\361\0313\304.\307\305y\312ek\003\346\354\353\342\254\264t\200b\034\201\252\362\341L\377Y\312\2714\201\334\241\315\345(X\256\215\b\246-\371\306\346\330\303\352\342,f\342\2707T\206\222\307\236\305\236\314bBw\204\254\005q\223d\231\221'\207I\202 \007\024\271'g\327\0212k\356.\346\300+\311\223d0+eci\030k\253\373\262\303uT_\313\374\365\f\006\207F\235\361\342\334\304\242\345\260\"i\2320\021\302\332ri2\223\274D\310\022\344\321JO\036<\\0\224\\\345\351\205\203n_\374\017d\232\0032\036\317=x\344#\246\233Mn\343\361)\016\004;V^_v\233h\fa!JU\0243C\236\217<#=8q\270/&nP\027g#\0172\222\351\262\274\370\231H.\362\367\370$\351\241lr\361?\250\240\177"
+	.ascii	")ZYY\027g!W\t\234U\334\3059\310\323\214k\354|\\\3749\031\b\233"
+	.ascii	"\027\232\250\213\363\n\331\207U^L\376\361\244PP\227\027V\304"
+	.ascii	"\\\374\017:"
+	.string	"\364\355\305\344\026\330\213\311\331\353Y\205\277\247\247\013W\217\256\213\377\241\206\376s\327\337\303\273\342\206\003y\361?\024\365?\300\320\"\306r\344\310;\254\224\215\225\253x\271\013\303>\352@y\333\221\271\350\3308\342\2718\353\360\365\250\202v\3615P\243\257\001\233\026\001\304h\3147\212\216Oq\003\230\343\225G\211\035\215\244\033*6\236o\330;\213\246\b\234\214\213?'\304\377\036!**tQ\027_\203/-\302H\203F\326*:\232qf\330)\n\361\330^\350\324x\326:\237tIni@\324\"\2122d\210\300\213N\353\213\347c\215\322N\2346j\023\3431r\261\350h\276\031\343\022;\261\026%\007\353\271\350\303\343\bv\345\342|e\357\242\224\261\361\344\356\177O\020R\316\220\2471\332\350\316\205\213\\e\002\f\031\235\026\026#eF\245*S\t1\362u$Se\030l\356\322\210\027\023{\344\300\324i\273\370"
+	.string	""
+	.string	"\323\371E\236jC\364\342\343\342\003\300\210>"
+	.ascii	"\216\332\250-*\352\324\262R6\026\207\263\2709\244\275\273\303"
+	.ascii	"3v\361\001p\245\215\320\362\316;?\025\035\237\342P\234m75m\354"
+	.ascii	"B\343+?\235wz\324\340yA\225G\033)\221\223;\363\240\300\305M-"
+	.ascii	"\bI\334R\202\347g\236\274V\205\316\234\213\317\272\363\216\013"
+	.ascii	"\032l\254\234wN;pmR\304\213\353\230WT@\270.~\006r'\235\323NF"
+	.ascii	"\332\335\305\317\300M\177\316IgVd\214\213\223\356\234\263f\346"
+	.ascii	"\210\226\213O9\267\214\310\216\273\370\031p\321sW\313\355\b\031"
+	.ascii	"\232\213\237A"
+	.string	"\022\315\001\2327o\316\245\225\262\26120\367\266\374\332\333\030\302\007\215\f\2713g\234\237\313\264\2517r\316\\|\3029\3412\270\322F\\l\330\234o>\320\254\351\002TF\206YV\233\237os\246\264\211Qa\303\272S\347\342{h\243\215\242L\374?\331\330N7+ecY+^nH\354\3666\206\300k\330\2705Q\363\323\355@\346\274\306\\|\246\271f\254\314\322\214\271\370sN4\377{,\254\301\002\373\202\346<C$\311\033\030\027\233\321?rX\321\272\370\036\224\350\266\263\f\007\f\207\203\307\330\305\367\260C\337\303\225\016\2414\361s\314\230\263\213\002\027\366\366\302\342\262\213F\021v\312\352\210\345\342c0\247C\250\035\371\031vB9\305\254\362<r\2061\211\306-#\0019D\234d0\200\230]\f\346f\231\2133s\3611p\323\267acg\262\3152\212\245\343!\212H\20106K\345I\305\266\375x"
+	.ascii	"\0232K)\226N\320\023\206\275U(\203<\273\234k\347\2273\355\364"
+	.ascii	"r\252Y\345\211vV\371\t\345\024\243;\321N\262\007\204\261\235"
+	.ascii	"hg\331\311e\013\334r\357m\344C\325\325\246#\b\217\035\316C\024"
+	.ascii	"\221\002bn\226\247\331yf\225'\227\262\223\313i\345\334b\333\214"
+	.ascii	"\311-\303\202\02621\031\034\214\200\344\322\260\301\221\361\177"
+	.ascii	"n9\265\004eI\372\230\273\370\314b\334\022\343\342\342c\260D\377"
+	.ascii	"\347\025\253<\261\314\371:\263\003\367%\210\027\022}\f\206\350"
+	.ascii	"c\260C\237S\264\232\245\016\266\213\217\201\r}\fj\350cP\324\307"
+	.ascii	"\200\250\217A\224\376\317\244\245s*\303\310a\273\370\035\356"
+	.ascii	"\364MZ\242\034\302\016\345\363\353tr>\371{\204\300\264<\271\270"
+	.ascii	"\370\035\352\364O\260\377=\027\bR\006\313\305\330>-\237L~6\371"
+	.ascii	"{\356\017\033js\027\277\203\234\376\251\344\\\362\367\b\025\331"
+	.ascii	"l\264\213\337\341M\377L\362\277')\013\013\311\305'\022=\325\201"
+	.ascii	"\314\006\347\027\021,jH~\373f\241\334+\240\034HT\350q\361;\220"
+	.ascii	"i\021X\210\0209\215\364\314\311`\272\352\254\331\3758y#F\256"
+	.ascii	"\310O#\326\r(\315\006\023\034\027\177\316\351E\367\306\354\342"
+	.ascii	"wXA\207\270c\302\202\331S\005\253<U8\205d(\236\340uc\271\213"
+	.ascii	"4D\\(Ao\342\332\200\374\370\031\344?{\234+\234@H\300c\223\221"
+	.ascii	"\273\370\n\020\222:ZT\027\237>J\374\374\241\2674\251*sq\007v"
+	.ascii	"(\367\030-Q\2663\354P~\207\030:\204\230\211\2379\254\362\314"
+	.ascii	"qvQ \271\237|\340\344\214\"t\023\037S\240\034\177v\375\247\216"
+	.ascii	"\223\353\344\221\275\364X\"\355\t\203\b\035\214\213\317\035%"
+	.ascii	"~\036O\033bx\b\271\330\202\035\3128i\211\362\313\354P>\207\245"
+	.ascii	"\026Qg4\2367\026\260\004\007\322\214k;\223:m\374\274\201\201"
+	.ascii	"\274\251\341\006\2146\300\227\263\306Y\343\324\312gg\352\254"
+	.ascii	"}m\2431\204\005\033Uf\030\347\374\324:\243\244\310\0252m\200"
+	.ascii	"\266b\361\234a\334Ot9\t\222:kv\333h\fq\221x\335X\"\343\347\f"
+	.ascii	"\235&\013\036\036\027\237Y'\325\017\035\331Z\224\333\377\236"
+	.ascii	"\037*\031^\270.>\207\":\004\022\023?\257n\225\347\0256s\245\354"
+	.ascii	"\247a\030\227X\366\221e\2243"
+	.string	"\352\003,O\027\247\213\323*\f\362\254\372i\025\004\345\t\026\345\305\347\213\223j\311\365C\352\244:a\344 \362b*\206\005\027Rsn\027\237D\363\311GL\210\221#\027\237S\026\315\307l\307^\302AJw \003\017\2363\352\302\216r\243\003yB\375\2142\205\f\261\203\343\342\363I\313\t\022\006\352\342s[:\032\355.\007\214\213\361]\0369MB\314\304\234\317\301v\364\336\373)\271\261\354\022)u\326\276\352\034\333\tr+c\346x1\246s\331L\"d\216\305\213\261\235\265\353!\366\270\341\346b\\\247\355X\031Ks1\246\343\211a\363\332q\361\347\364\340\032gO\310\\\374\2422\372p\360\034\034,\227\367\266\311#Vq\033\213!:p\213\203\347\342`\271\273\217b\342\216\345xj\313'U.\306\313\313\006$g\n\226\326\2316Jx\274\270\370Ea\372E2t\2101&\360\233\305o\224\370\215E+Z"
+	.ascii	"\027:\001j\232\024DO\340\251\275\r8\255+,\244@\025h\n+\362\221"
+	.ascii	"\317:\302\bW\355\241\360\375\230\262\t\226\004\233\302\372~L"
+	.ascii	"\346P\272\242'\224\300!\005\t&\244+~\353\021\004\324\037\320"
+	.ascii	"\225F$\005\177\303U%\221\372\232\200G\301\037\211\241\332Db\003"
+	.ascii	"\020\330\024\f\n\203\274\265\227\242\340\247f\026\302\241\322"
+	.ascii	"*\f\362\220\320\024\210\327T]J\323\245\337\272\366\324\022\322"
+	.ascii	"\245\337\252\325\037\020\370[\312W\032\3414$\3414\034Z\323\t"
+	.ascii	"8\r1\\i\004\t\341\357\002\225)M#\260"
+	.string	"4dJS\025\027h@\r\376\320\t\370~&\244\300&_\252t\244n\210\200\206+\215\360\375\230H\024\255j\257'\005\252@\327\246\022L\020D#\340\3731\005\251)H0!U5\200AhU{\026\3265\235\200\bN\353\n\017W\032\241*\255\350\022\211\340\017\035\256jPx\324s\245\021\036\322a\323\212\246H\274+\215X\2334\\h\301$\024\241\303z\245\021LM\302aRo\230\256\351\022:D\231H\244jzB\022\223\205 \322=\325^\022\323\317\332\013&1\235\301$&3E\301O\305\252\232\016}>\224\327\202Ix\204\207+\223\351Ky\276Tm\302*\357\303^\022\323O\213\341\252\376\222\322\0238\370R\365\347A]\201M(R\352+j\201\016\207\020P=\254\250\217\251i\003\221zt\202\252\246G\302!\223\006\"\246tEa\b\005\006\004\224\320@\213"
+	.string	"t0b\035\242L#HH\022Z\200\003\023\250h\tC\351\260i\350G?}\023\b8"
+	.ascii	"\002P8\361\216\"\204\016B\350 \037E\b%J\204\200\200\022\372\b"
+	.ascii	"(a\256?R\323\025]Q\270\260:\241KB?\252\232\006\225V\241pI\315"
+	.ascii	"\020\374\375\b\327\036\206a\272\376\204@\240t\305\317'\324b\375"
+	.ascii	"\035\t\201\351\212\r\300\364\350\bUR\323\245\337\232\002}?\r"
+	.ascii	"\303t\351\267f`j\n\376\230\212\202?\241\240\241\f)0)\330S:\n"
+	.ascii	"6\241@\026h\213^\252\376\232\206GB\251\212\246\303\243\340\257"
+	.ascii	"7TZ9x`\005z\001\026#\244jS\006_\020U\341C\323\024\"\260@[d`\201"
+	.ascii	"tW\240A\013>\240Pi\005\242\275\241\020\251\347\373-\365\206J"
+	.ascii	"k/U\233.h\261&\005\177KC\264\207\016W\247th\230\252M\030z+\020"
+	.ascii	"\325 \264\252\303\037R\017\370C\327\236\322:\f\n\n1$\005\177"
+	.ascii	"\276 \nD{\351P\030L\372)\255\303\rL\302U\355\365T!\0075\t\005"
+	.ascii	"\"\235\351\260\t\370C\221z\252\220iHm\372\371\320\241P\212\204"
+	.ascii	"\252\275\026(\213\rA='ti\350\202\212\245\037\360\250\327sB\227"
+	.ascii	"\2100\254@4\370[\201\250\023\272\324\013\262\020\372X\b\201j"
+	.ascii	"\317\027D\201\032\322\025\035\366\326`z\244\246\276^\3220]J3"
+	.ascii	"\374`PZ\207\275\340o\351\302:\024\252@{J\353p(\3655\255\277\025"
+	.ascii	"\210\366X\b\201@!R/\370C\207\303t\3559\241K\030\244GAtU\213|"
+	.ascii	"\2755U\221\220\204\275tI\250\324SZ\207\034\200\3500\r\246I\274"
+	.ascii	"+\215H\372\255@\203\002pB\227z\303t\205P)\250\005\nL}=_O\270"
+	.ascii	"6\241\030.\270@h(\\\217P$\rD>\240PIM\207Jk\317\227\246Lj/MB\223"
+	.ascii	"\202\251\372\363\365VU(\314 \005&\005\321\236\t\202\250\212^"
+	.ascii	"R\360g\002t\250\"C\272\364K!(\374\255\3500\005\246Gi\nU\3104"
+	.ascii	"$dr\222@\252\006\205Ljz\202*d\022:Z\272\031\326+\215 \321A\351"
+	.ascii	"h\375\231\020d!L\221B\360W\002\013$\f\206\251\323o\t(\373\322"
+	.ascii	"u\230\256\b\222\220\016\177)\206\302U\270\264!ej\221\302\322"
+	.ascii	"P\210\264\242@\246\037\225\t\005\216\240\242JzM\325th\3020u\372"
+	.ascii	"\225\340K\177@&&4\303R\272\252-P(Z\2574\302i]AB\370\323\220\372"
+	.ascii	"~\303a\272\002\003N\350\322\0055)\370[\327\024\005\247u\305\220"
+	.ascii	"/\210\252\300\2743\210*\211\220\372\204%\254?&\013KCT\375\245"
+	.ascii	"\030\246,\204&\260\020\002\203\326\024\230\024\204\300\022*\302"
+	.ascii	"\n&\244\fG\352o\t\247+z\302\020\n\337\257\204\243aNA\202\t\301"
+	.ascii	"\026\276\274\006\177B&\023\240\351PE\017e\002RKhBS"
+	.string	"H\n\3768\340K\235~HA)p]\205C\245U\373R\024\254j\n\374!\t\207L\275tE\207@\341p\r\n\217H\034!\035\ry(\204LN\022`\201z\340h\350\243\246+:<\201hS\020]\312\353\bAiO\303*t\245\021j\352\023.q`JW\024|\301\224\247\366\322\244 zB\320\020]\325\2364)\210\016O\024\234\232P\242\265\207\256h\212\013\253\032\024\376\326\237*4A\351h\375\261P\205\324\036\nEG)0U\177\232z+S\272\252X\355\241\260\201)]U\037tE}8\365\t\227\360\225F\004\205KK\302\243\236\323\272\202\204:LW\374\206\276\017j\257\305\372\003\376T\240L\250\b\351\321oE\232\302i]A\264\006\233\204\"\370\202\250\212\236\243\237!\252t\204\325t\t\275\3000e!d\362\271\322\b\224\204:\024\252\301T\035\200\332[\203\351R0\351\007\204\200o\210\nU\\"
+	.string	"\002\205C!\245\243\365\307t\201\247\246\3510)M\361;JS\260@[\004\255=\004\224P\032\241\"\245>\0370\375!\365\234\204*Lp\204\002Up\240\366 \020\374\365\326`\272B\002IB\013\254JI? \222"
+	.string	"\202\302\337z\024l\032\001(\024F\240w&\241\300\021VT\bD\352\341\261H\203:m\002\242\033XQ!p\004\026i\020h\275\222\006\0272\245C\022\253P8$aa\355\241X\203\277&\236S\352\013\222"
+	.string	"L\203ATI\004\247&TH\355\245+\272\242\200aU{\"dH\372!\005\205Gy\355y\360\301\032\3745\351\373L\234H\200\n\020>@\032\321\341 \200 \302\007\r\\`\002\372h\204\272\006\323\245Um*\201\017\355\035\rI\034!\221\b\376\320%\022GC\225\304\b"
+	.ascii	"\254\020X\233\204\351\322o\355\371\317\263q\272\255}\225)\032"
+	.ascii	"q\033\223\312\2243\037[\031,\317\350J\003\246\fBR}m\325\020\222"
+	.ascii	"\246d\20504N\036\274\256;Rn\314\340\311\330G'l.N&\303\236\202"
+	.ascii	"\024\271\330\003#\257\212\227\305\253\342\025mQ\216\204\013c"
+	.ascii	"\025\235\3356\322\b\361\363\254\316+\362\260T`s\004\303\342]"
+	.ascii	"\251U9\216\361b\006\345c\007/\306\305b\207\246F\b\b6\375\337"
+	.ascii	"\264\213\226\344\201i\263\254\343\3018\3226v\007\204G<\255\300"
+	.ascii	"\356\252\266\\|GI\231\227\233\f\302\"c\355\007\317E\276\261c"
+	.ascii	"\b\2154\027\377<\251\274C\214\331\222&\027o\241\237\267+e\346"
+	.ascii	"\\\234\f\333;\031\224\231\fyqv\223?XXB\216vJR\203\261\311\325"
+	.ascii	"]\326\222\347\242\342@\311s\3469q,\221\202\003O~\312mpo\\\356"
+	.ascii	"`3=]\314\314\234\261\223\213>4\214 \275\324\301v\256\016\262"
+	.ascii	",Qtr\225%\262\025\207\212\235\026\266b\343\207W\335\031\265\205"
+	.ascii	"\246\212\324\025\351\264v\220]\03050\346\310\371\020$K\307\305"
+	.ascii	"un\220\035c\244\\|s\013\315\030\222\006\224\f\227\323d-(\246"
+	.ascii	"\212\027@\363d\271\367\316pYM~C1U\354\231A\006\266\334[\t\227"
+	.ascii	"\337\224!3\2349\303\2425isS\263\213\223\3472\234,\227\343\362"
+	.ascii	"\322*3\334i\367\323Gv\243\335\302\344@\005\341\203P\323\346\266"
+	.ascii	"D9O\261\001\306Fn\223\331\210\321q\"C\213i\325\211[\223\335l"
+	.ascii	"\310\305Qr\361A\\\321\007A\246\017\342K\037\004\021\375\3473"
+	.ascii	"\331\314\024* T.&\356 \253:\001\205c\250\2232$Z@\323b\024\346"
+	.ascii	"\230R\306044\264M\007C\025@0pL$\024\rW\315<\023\200CMj\344\221"
+	.ascii	"*\347 S3#IAQ2\035^mP\277\263Y\371Rg\022\004eU\351J\b\r\245"
+	.string	"X@\2172\262\255\211U?\213\327\251?\\\366\2365i\220\265\267\226'\331\016\202\3103\244\216\r\302\004\303\252\267\323Z\253\034mVw\r\245\225Y\217k\227\353?/\265\247\327m!\303\2417\317\246\034N-\251h\"\310\305\364\211\375x\330"
+	.string	""
+	.ascii	"\306\221\372\360\254\373,\276\3443h\002\030\\\202B\274\2100;"
+	.ascii	"\326\350\276\275\246j]\t\234\314\f-\261\342a\371\001\223\261"
+	.ascii	"?\215d\330CX!\005M\316\355\007\336\312\237u\332B\273\322\260"
+	.ascii	"b\341\274\363g\231\236\341\242\335\237^\241\255\023\257\366\354"
+	.ascii	"=\034I/\205\376\364\353\267\253.9q\026u\006\255V\343\f0M\002"
+	.ascii	"\337\267~\333I}M\301\304\305NW\225\271\277BX\031\271r\b%&@}~"
+	.ascii	"\bzr\213\257hh\374\326-\234\225\3411\333\253#\274H6l\023\371"
+	.ascii	"\230\236\256dj\345\275le\016\320\311\313\361\261KT\326\363\310"
+	.ascii	"\032\252bk\"\241\036\370\022\027\214\235\206:h\325\016f\336\232"
+	.ascii	"\037\200l\277\3776F\262]\274\b\203\301\\*\323\322\"VHw\224\035"
+	.ascii	"r<3\347\214.B\034e\003\364\024\200\021\247\364Cr\230\357\360"
+	.string	"5\261\307\334\230:\224\271\313\251\271Jk\315\214\365\032\207\025\024)\210\224ml\361\002B\201\341\245\201\026\252\226\372\247\222\2627I\215E\272\270\200\366\f\231\263-\003U\306\346*WJ\356\260\0025\013\342\371\227\373\267\004\002;`\231\365s\335\240J\360o\266\324\330\336\367z~\274|\357\200=\224\026\326jaY\362=\"C\270H\324\323\023jh\352\341\261g\327\234\256\252CB\347\005@\210V\254\331\201-\326h\215\020\214\237\223J[6\260J\002\016\263\035\260\332\261\240\0269\355\370A.\270\212N\302\323\313Wd\342q6\251\310\364/\221\177\"\347\313{uh\t03\"A+\"\256\214\276*\343/\005\343>\262\224`\031\223\273e\375D\324e\201\021\325\211\035\307\3649\226\230\211\003\233je\200;\nU\006@\252,\314\\\314\034\rp\020\200\002y0:Z+\323\257\005A\3015 rh+\036\246\242\253\222"
+	.ascii	"paR\261\200\362\324\330\264\315w\256S\245\346\377\241\031y\f"
+	.ascii	"\027S\343\214I\232C\306\272a\270i\225\222\277\325b\270\325I%"
+	.ascii	"G\230a\256\216\262d\f\224\001\221\335\346\"\260\026\354G\003"
+	.ascii	"\354\371\303$\215\330\003\263\205\355+w\211\202\266\314\016C"
+	.ascii	"-\310R\246\022\r\027/b]\326\226b\340\036\022i\205\237\335\365"
+	.ascii	"\236\264\001\371\256\ftMM\035\007\027\237\372`$\003@\307\321"
+	.ascii	"\214m\221\243\210x\\K\257\367\004\257I:\254\207\036r\200\264"
+	.ascii	"\b\330Bl`\347\313\300\260\251 \331\256$\210\230\025\233\251\021"
+	.ascii	"\335\210\233T\007\332O\314\036X\340\352\356%F_\370\234\272c\245"
+	.ascii	"\345$\374\221\343\023\340\240\177\337\272\245\006''\370\033\036"
+	.ascii	"\233"
+	.string	"2\314\213\266.e\022\f\233\273\b\007\353\315\003L\013\032U \243m~\315e\235O(p\251\351E\375\215\331\245\213\354\370-\346\177\361\270m\261\325\314T\022\200\333/\343>a\347\232\240\021\260\022\005J-S\0333s\3456\200`\341\233\340R\221\236n\246\260\032\353\026\003\201\257\340t\210S\3478\312\032kT\353v\230\006\346\302u\320\336\326\366\375\024\031\367\b\363v_\360\311\244\r\331VX5\326d(\021\357\274\203\2466\320\334\271\305\253H\252\302\266M\023\216\342!\326\276&\333\333\3153\370\332\326\275\030\331fX\351\317\260P\320\3140\004\261\t\242*d\201\324\257\304@\260Q\022#\233\016\245\334Q\206\007\355\2379\017k\\0\216}3z0\316\003X\236\377\257t\342\034\264\016\227\203\217\335\032U\235\340i \247\364+\324\025 HOnHd\362 \221\366\360\005\247\3519\r-\022\203\343\0019\271~z\230"
+	.string	"N\3218\244-\254\365\223IxM\256\007)\223\267\337\345xW\306\327\310\224\370\300\276\266\235beo=\375&i`\217_\342Y\300\224\330;\371~Q\241\206q#l\333\260Uwd\203\"\204Aj\331NP.\355\325\325\263\352\206\255\247\361+\250\223\35558\336U\004\275\f`F\311\343\352\230\035|LmuB5\n\260M\350\005\216or\006r\321\026\351\261B\376\335\240\203S\364\353\020\314\243_\377/w\nr\032\034\320R\347\246u\t\214fN\363\264'c\312\226O\242\004A\203\003\315\352\220I4\265[f\275\001\317\021\0071H[\330Y\207\334\356\003TrZb\205\224w\353^\376\370\020\262(cf"
+	.string	"3\354\217c\351\314\311\210\275\rI\341\346\2470,\244\332J\377\266\317fD\362B\354\255\343\265v\361\271\004\250\244\356\r\306!\346\207\361/\247\315\257\021y:\007\223\013\003\360\241\025\346.\250\323\032!\242k\223\212\037\016i:`\265\376\204\236\032p\234A@\265F\306\006\035\364\325:\242\330\247{2atv\343-\357Q\340\3239c\275\365\213(B\243\362\364\344\213\005\220 \337u\265\223\342\370\254"
+	.ascii	"\225@\345x\356\245$\370\247\260\2053\354\354\366\325\\`A\214"
+	.ascii	"&kWr\323\264C\231\177\335\375\255\2021\262\027\330WH*\227B\013"
+	.ascii	"\023\311k\372\273\336T\323}PP*\263\335?\334\002^\231\206\336"
+	.ascii	"\333A0\002\b{\355DR\032g\016r'\321\310)I\370\r\233\322\0165'"
+	.ascii	"\266\226\002\241C\003B9\\\306!("
+	.string	"\211\344k5\316[BI\037\004v\273\026\203@\004\034.*\316\2219\252\327\373\371L\207\320\244\364J\220\320\211\256j\023\333\363\343\327\207{\210\326\341\027\234\227\244\323\026\266\032\n\317(&\f\f\213=7\341\202!\207\312\233\305hg}d\347\016F&\236PsV\216\357\327ds\030\\\215]\316\301\005\362\247\330\244~\244\326\216\221\271I\231kKjbI\033x\bT\027\312'\232d\033\006\327U#\016p\032\255\321,\233Y\204b\343\331\232\241s\351\007\214\274V\360U0\226ss\321D\023_\252\236\002\261;frN\276\024&\024T\370)\337\206\246\227\232G\252[xh\r8\b=\301\320\007\236d\021g\037;\257\205\236\030\3116lX\355C\334\336A\016\002r\035\277\342@\304\202`\302*\250\363Y\270\206J\216\217\346\007\231l\353\375\360ES\357\245't\322v8\365\256\\J\276\3314M=\220\301:*"
+	.string	"\n\3211i5\3651*\362\345\265\252D\024+\001<\273\207\211G\346\312\344\203\037\220\253\030\030F\275\207"
+	.string	"\002\360\360\002\376R\246\350m\032\247\030\263r\241eL\350K\225}64\306\233\3374\327\237\032\331w\317.'\374\002\350\351V;t\227\211\374\b\253\273\303\370\023\252\370L\377\352\353\200\006\243N\321~L\004\330O\262\237\267\025\211\347\025\370\263\354\f\\\177\"\314\302\253\213\200m\253\020\360\t\223\230,\271\031\224\260\273\360\227\375\361\271eh\320\021\021\335;\2403\250\322\206z\205'<`bR\367\300\215M{;\300\267!4\343^\035\303\020=j\331F\276\024\367\324V\243u:5\235\020b\266~N\360]ML\373\233,\275\213^\240z\262\301Tz\321\203\307\226\320\"_\027~"
+	.ascii	"\252Wz0\337\302\027\304!=\222\314\022'\t\332Yn\336\201\254\037"
+	.ascii	"\302\003\223\3457\360\217\235\330\007\202\247+\373,\n\372C\203"
+	.ascii	"\304'\274\tr\251g\364\002\242MI\371\277\027\226\375\3276\250"
+	.ascii	"\223[\342\256#u\021\271h(\022\303yy\035\232\263\336\234\212"
+	.ascii	"\240\223\027z\036\236\216\2730\243\205!We?\236\236D\350\350)"
+	.ascii	"\350\227AP%\274olOd\357\230m\364\316\211\\\327\026\321O\310#"
+	.ascii	"\340r\241\275\313C\027\336\001\222\004\272L\017TFrn\n\210Z>\260"
+	.ascii	"*W\013\n+\230\266 \340\346\226'\231\325\2565\314\226\367\002"
+	.ascii	"\031\317\b\bp\252\370E\362=\317\020\216k\242g\032{>B\301\365"
+	.ascii	"\2702\212\033#\306\025\336r\207?\340#!\273&`T2\202\225+\315f"
+	.ascii	"r\246\3109\262#\200=9\n\273vvbP\310\301\024k\376{K:\177\322\f"
+	.ascii	"\233\251\356$u\253w\322C\222\3333\013\037#\351\303\254\374\310"
+	.ascii	"d&\1778\250\305\235\003`\304\370\354\036\224&\226\267\324P\251"
+	.ascii	"\264&)\022 \024\311\357(\337\017l\236\271\234\217\314nF\260\347"
+	.ascii	"\353*~(p\037%Q\3075B\2561\367\304_\233U:1\025%\341\242\3302_"
+	.ascii	"k\354sC\373\355T\244&\371\036<\202\025G\202\007\203M\332\230"
+	.ascii	"\230u/`\343\221T\004AD\277\263\264\306\350\334d\230Pw\372~\267"
+	.ascii	"a#\367;\023\375WK;\204\260W$_\251\236d\r\226\327\252hMf\205\024"
+	.ascii	"\260\351xnx\210\354\245\r\227/\330\030\210\027\242\020%\203\275"
+	.ascii	"\201\361Q.\230w\037\013wX,\b\366\364\265\331\030 \024\307\224"
+	.ascii	"\230N\255*v\034=\265\260\313L\347y\375\242\233\303\330A\214\334"
+	.ascii	"\034\205\033n\303\t\"\260\004\315\212\345\233\005b\003a\246\310"
+	.ascii	"q\2706\252\302V\244\361\301\304\370\341\333R\016I2\302j\022\236"
+	.ascii	"!\221\270==\020\263\373\330\243\240y\001\311\004U\366\200:\023"
+	.ascii	"\353\204\200\3136"
+	.string	"\200\220<\375\260\325D\306\343\033w\377\021G\031\337\310=\036\306m\335\342\006\251\034NF\327\354\356\370\236\260<\324\\\023\025\3359\031q\342\333\001\377\200-7\321z\361\021\320@Y\201Z#\203\315\370w\363Q\277A\211\250\213\360\250\253\306\321}\365\226\263\225\267{P]_\005\r}\313\027\242\225O$@\360\005\216\371\347e\305\224#C0\333\260tI\224I\273\326\245\216#\257s\362alv{z;\373\225/\277\220\3738}\020\235\246\275\377\234\317\356\360{\315\320\rh\265/\333#>#\206W\030\357\303\350\t\244\366R\272\363\363\231_\254\337\226u]\305\340\304?~\362\276\222\203\351\365\356\347\323\316E\302eN@\303\334\3007\365\377\027\325\027\327w\245\221\021\363>\314]S\2550L\314\254\364\221\026?\325\363'\024\357,\334*tM\366\237\367\2475Gm\222\026+\222`'\370\256\3472\277beL.\006"
+	.ascii	"\375\023\266\274\202c& n\216\026\364\326\353\250\346A\361\017"
+	.ascii	"\225_\225\275%\234\007\270\307\211\230Q\372\352\364\261\222\017"
+	.ascii	"M\336l\350\263bH\227X\313Z5\025\323y\\:w]\347\343?"
+	.text
+	.section	.gnu.lto_.symtab.4396214808090bbc,"e",@progbits
+	.string	"processRcAdjustments"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"resetAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\002"
+	.string	""
+	.string	"updateAdjustmentStates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"adjustmentRanges_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"isAdjustmentFunctionSelected"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"adjustmentRanges_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"adjustmentRanges_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"navConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"boardAlignment_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"vtxSettingsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\001"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\002"
+	.string	""
+	.string	"vtxCommonGetDeviceCapability"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"vtxCommonDevice"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"navigationUsePIDs"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\003"
+	.string	""
+	.string	"pidBankMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"updateBoardAlignment"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\003"
+	.string	""
+	.string	"schedulePidGainsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\003"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\003"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.4396214808090bbc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,14915 @@
+	.file	"rc_controls.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/fc/fc_core.h"
+	.file 9 "./src/main/fc/rc_controls.h"
+	.file 10 "./src/main/fc/rc_modes.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/flight/pid.h"
+	.file 13 "./src/main/io/beeper.h"
+	.file 14 "./src/main/rx/rx.h"
+	.file 15 "./src/main/drivers/resource.h"
+	.file 16 "./src/main/sensors/sensors.h"
+	.file 17 "./src/main/fc/rc_controls.c"
+	.file 18 "./src/main/sensors/acceleration.h"
+	.file 19 "./src/main/sensors/battery.h"
+	.file 20 "./src/main/navigation/navigation.h"
+	.file 21 "./src/main/sensors/gyro.h"
+	.file 22 "./src/main/flight/failsafe.h"
+	.file 23 "./src/main/drivers/time.h"
+	.file 24 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_controls.c.bcccb138
+	.weak	rc_controls.c.bcccb138
+rc_controls.c.bcccb138:
+	.long	0x103a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF2106
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1684
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1685
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1686
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1687
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1688
+	.uleb128 0x5
+	.long	.LASF1689
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1690
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1691
+	.uleb128 0x5
+	.long	.LASF1692
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1693
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1694
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1695
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1696
+	.uleb128 0x5
+	.long	.LASF1697
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1698
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1699
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1700
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xb
+	.long	0xc8
+	.uleb128 0x5
+	.long	.LASF1701
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1702
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1703
+	.uleb128 0x5
+	.long	.LASF1704
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xc8
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x12d
+	.uleb128 0x4
+	.long	.LASF1705
+	.value	0xfff
+	.uleb128 0x4
+	.long	.LASF1706
+	.value	0xf000
+	.uleb128 0x4
+	.long	.LASF1707
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1709
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1710
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x139
+	.uleb128 0x26
+	.long	0x144
+	.uleb128 0xa
+	.long	0x96
+	.byte	0
+	.uleb128 0x27
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x163
+	.uleb128 0x1a
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x96
+	.uleb128 0x1a
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x163
+	.byte	0
+	.uleb128 0xc
+	.long	0x12d
+	.uleb128 0x12
+	.long	.LASF1805
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1c1
+	.uleb128 0x1b
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0xf3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1711
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1712
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1713
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1c1
+	.byte	0x10
+	.uleb128 0x1b
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x1c6
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1714
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x144
+	.byte	0x20
+	.byte	0
+	.uleb128 0xc
+	.long	0xb7
+	.uleb128 0xc
+	.long	0x1c1
+	.uleb128 0x5
+	.long	.LASF1715
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x168
+	.uleb128 0xb
+	.long	0x1cb
+	.uleb128 0x5
+	.long	.LASF1716
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0xb
+	.long	0x1dc
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1717
+	.uleb128 0xb
+	.long	0x1ed
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x223
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x4
+	.byte	0
+	.uleb128 0x15
+	.long	0xb7
+	.long	0x232
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x26
+	.long	0x32d
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1731
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1732
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1733
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1734
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1735
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1736
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1737
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1738
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1739
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1740
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1741
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1742
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1743
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1744
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1745
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1746
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1747
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF1748
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF1749
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF1750
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF1751
+	.long	0x10000000
+	.uleb128 0x2
+	.long	.LASF1752
+	.long	0x20000000
+	.uleb128 0x2
+	.long	.LASF1753
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1764
+	.long	0x30
+	.byte	0x8
+	.long	0x372
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1763
+	.byte	0x8
+	.byte	0x22
+	.byte	0x3
+	.long	0x32d
+	.uleb128 0x1c
+	.long	.LASF1765
+	.long	0x30
+	.byte	0x9
+	.long	0x3ed
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x1
+	.uleb128 0x28
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0xf
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x2b
+	.long	0x405
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1783
+	.byte	0x9
+	.byte	0x2e
+	.byte	0x3
+	.long	0x3ed
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x30
+	.long	0x429
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1786
+	.byte	0x9
+	.byte	0x33
+	.byte	0x3
+	.long	0x411
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x35
+	.long	0x44d
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1789
+	.byte	0x9
+	.byte	0x38
+	.byte	0x3
+	.long	0x435
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x3a
+	.long	0x471
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x1
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x3f
+	.long	0x4c5
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0xc0
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x80
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1804
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x3
+	.long	0x471
+	.uleb128 0x15
+	.long	0x9f
+	.long	0x4e0
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1815
+	.byte	0x9
+	.byte	0x51
+	.byte	0x10
+	.long	0x4d1
+	.uleb128 0x12
+	.long	.LASF1806
+	.byte	0xa
+	.byte	0x9
+	.byte	0x53
+	.long	0x554
+	.uleb128 0x3
+	.long	.LASF1807
+	.byte	0x9
+	.byte	0x54
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1808
+	.byte	0x9
+	.byte	0x55
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1809
+	.byte	0x9
+	.byte	0x56
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x9
+	.byte	0x57
+	.byte	0xd
+	.long	0xb7
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1811
+	.byte	0x9
+	.byte	0x58
+	.byte	0xe
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0x9
+	.byte	0x59
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1813
+	.byte	0x9
+	.byte	0x5a
+	.byte	0xe
+	.long	0xc8
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1814
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x3
+	.long	0x4ec
+	.uleb128 0xb
+	.long	0x554
+	.uleb128 0x8
+	.long	.LASF1816
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x554
+	.uleb128 0x8
+	.long	.LASF1817
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x4e
+	.long	0x554
+	.uleb128 0x12
+	.long	.LASF1818
+	.byte	0x4
+	.byte	0x9
+	.byte	0x5f
+	.long	0x5b1
+	.uleb128 0x3
+	.long	.LASF1819
+	.byte	0x9
+	.byte	0x60
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1820
+	.byte	0x9
+	.byte	0x61
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1821
+	.byte	0x9
+	.byte	0x62
+	.byte	0xe
+	.long	0xc8
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1822
+	.byte	0x9
+	.byte	0x63
+	.byte	0x3
+	.long	0x57d
+	.uleb128 0xb
+	.long	0x5b1
+	.uleb128 0x8
+	.long	.LASF1823
+	.byte	0x9
+	.byte	0x65
+	.byte	0x17
+	.long	0x5b1
+	.uleb128 0x8
+	.long	.LASF1824
+	.byte	0x9
+	.byte	0x65
+	.byte	0x42
+	.long	0x5b1
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x1c
+	.long	0x6e8
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1840
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1868
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x5da
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.long	0x7bf
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1872
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1873
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1874
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1875
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1876
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1877
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1878
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1879
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1880
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1881
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1882
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1883
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1884
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1885
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1886
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1887
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1888
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF1889
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF1890
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF1891
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF1892
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1893
+	.byte	0xb
+	.byte	0x47
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x6c
+	.long	0x890
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1898
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1899
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1900
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1902
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1903
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1904
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1905
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1906
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1907
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1908
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1909
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1910
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1911
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1912
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1913
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1914
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1915
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1916
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1917
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1918
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1919
+	.byte	0xb
+	.byte	0x8c
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x39
+	.long	0x8f0
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0xb
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xd
+	.byte	0x16
+	.long	0x992
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1957
+	.byte	0xd
+	.byte	0x34
+	.byte	0x3
+	.long	0x8f0
+	.uleb128 0x12
+	.long	.LASF1958
+	.byte	0x28
+	.byte	0xe
+	.byte	0x6a
+	.long	0xabc
+	.uleb128 0x3
+	.long	.LASF1959
+	.byte	0xe
+	.byte	0x6b
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1960
+	.byte	0xe
+	.byte	0x6c
+	.byte	0xd
+	.long	0x223
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1961
+	.byte	0xe
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1962
+	.byte	0xe
+	.byte	0x6e
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1963
+	.byte	0xe
+	.byte	0x6f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1964
+	.byte	0xe
+	.byte	0x70
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0xe
+	.byte	0x71
+	.byte	0xe
+	.long	0xd9
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1966
+	.byte	0xe
+	.byte	0x72
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1967
+	.byte	0xe
+	.byte	0x73
+	.byte	0xd
+	.long	0xb7
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1968
+	.byte	0xe
+	.byte	0x74
+	.byte	0xd
+	.long	0xb7
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1969
+	.byte	0xe
+	.byte	0x75
+	.byte	0xd
+	.long	0xb7
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1970
+	.byte	0xe
+	.byte	0x76
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1971
+	.byte	0xe
+	.byte	0x77
+	.byte	0xd
+	.long	0xb7
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1972
+	.byte	0xe
+	.byte	0x78
+	.byte	0xe
+	.long	0xc8
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1973
+	.byte	0xe
+	.byte	0x79
+	.byte	0xe
+	.long	0xc8
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1974
+	.byte	0xe
+	.byte	0x7a
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1a
+	.uleb128 0x3
+	.long	.LASF1975
+	.byte	0xe
+	.byte	0x7b
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1976
+	.byte	0xe
+	.byte	0x7c
+	.byte	0xe
+	.long	0xc8
+	.byte	0x1e
+	.uleb128 0x3
+	.long	.LASF1977
+	.byte	0xe
+	.byte	0x7d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1978
+	.byte	0xe
+	.byte	0x7e
+	.byte	0xe
+	.long	0xc8
+	.byte	0x22
+	.uleb128 0x3
+	.long	.LASF1979
+	.byte	0xe
+	.byte	0x7f
+	.byte	0xd
+	.long	0xb7
+	.byte	0x24
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1980
+	.byte	0xe
+	.byte	0x80
+	.byte	0x3
+	.long	0x99e
+	.uleb128 0xb
+	.long	0xabc
+	.uleb128 0x8
+	.long	.LASF1981
+	.byte	0xe
+	.byte	0x82
+	.byte	0x13
+	.long	0xabc
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x16
+	.long	0xbc9
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x25
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x43
+	.long	0xc53
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x14
+	.byte	0
+	.uleb128 0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x14
+	.long	0xc8f
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x7
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF2107
+	.byte	0x11
+	.byte	0x44
+	.byte	0x12
+	.long	0x4c5
+	.uleb128 0x10
+	.long	0x4e0
+	.byte	0x46
+	.byte	0x3f
+	.uleb128 0x8
+	.long	.LASF2049
+	.byte	0x11
+	.byte	0x48
+	.byte	0x21
+	.long	0x560
+	.uleb128 0x10
+	.long	0x565
+	.byte	0x48
+	.byte	0x56
+	.uleb128 0x10
+	.long	0x571
+	.byte	0x48
+	.byte	0x82
+	.uleb128 0x8
+	.long	.LASF2050
+	.byte	0x11
+	.byte	0x48
+	.byte	0xb3
+	.long	0x1d7
+	.uleb128 0x1d
+	.long	0xcbc
+	.byte	0xe1
+	.uleb128 0x1e
+	.long	0xca2
+	.byte	0x4a
+	.byte	0x1a
+	.uleb128 0x8
+	.long	.LASF2051
+	.byte	0x11
+	.byte	0x54
+	.byte	0x1d
+	.long	0x5bd
+	.uleb128 0x10
+	.long	0x5c2
+	.byte	0x54
+	.byte	0x4a
+	.uleb128 0x10
+	.long	0x5ce
+	.byte	0x54
+	.byte	0x6e
+	.uleb128 0x8
+	.long	.LASF2052
+	.byte	0x11
+	.byte	0x54
+	.byte	0x9b
+	.long	0x1d7
+	.uleb128 0x1d
+	.long	0xcef
+	.byte	0xc5
+	.uleb128 0x1e
+	.long	0xcd5
+	.byte	0x56
+	.byte	0x16
+	.uleb128 0xd
+	.long	.LASF2057
+	.byte	0x7
+	.byte	0x84
+	.long	0xd1e
+	.uleb128 0xa
+	.long	0x9f
+	.uleb128 0xa
+	.long	0x9f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2053
+	.byte	0x12
+	.byte	0x55
+	.uleb128 0xe
+	.long	.LASF2054
+	.byte	0x7
+	.byte	0x77
+	.uleb128 0xe
+	.long	.LASF2055
+	.byte	0x13
+	.byte	0x84
+	.uleb128 0xe
+	.long	.LASF2056
+	.byte	0x13
+	.byte	0x85
+	.uleb128 0xd
+	.long	.LASF2058
+	.byte	0x7
+	.byte	0x81
+	.long	0xd4b
+	.uleb128 0xa
+	.long	0xb7
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2059
+	.byte	0x7
+	.byte	0x7d
+	.long	0xd5c
+	.uleb128 0xa
+	.long	0xb7
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2061
+	.value	0x1b8
+	.long	0x1ed
+	.uleb128 0xd
+	.long	.LASF2060
+	.byte	0xd
+	.byte	0x36
+	.long	0xd78
+	.uleb128 0xa
+	.long	0x992
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2062
+	.value	0x1b9
+	.long	0x1ed
+	.uleb128 0xe
+	.long	.LASF2063
+	.byte	0x15
+	.byte	0x7c
+	.uleb128 0xd
+	.long	.LASF2064
+	.byte	0x8
+	.byte	0x27
+	.long	0xd9b
+	.uleb128 0xa
+	.long	0x372
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2065
+	.byte	0x16
+	.byte	0xa0
+	.byte	0x5
+	.long	0x1ed
+	.uleb128 0x17
+	.long	.LASF2066
+	.byte	0xe
+	.byte	0xb9
+	.byte	0x5
+	.long	0x1ed
+	.uleb128 0xe
+	.long	.LASF2067
+	.byte	0x8
+	.byte	0x28
+	.uleb128 0xd
+	.long	.LASF2068
+	.byte	0x8
+	.byte	0x2b
+	.long	0xdcb
+	.uleb128 0xa
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2070
+	.byte	0xa
+	.byte	0x77
+	.byte	0x5
+	.long	0x1ed
+	.long	0xde1
+	.uleb128 0xa
+	.long	0x6e8
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2069
+	.byte	0x17
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1dc
+	.uleb128 0x18
+	.long	.LASF2071
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x5
+	.long	0x1ed
+	.long	0xe03
+	.uleb128 0xa
+	.long	0xd9
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2072
+	.byte	0xe
+	.byte	0xd2
+	.byte	0x9
+	.long	0x9f
+	.long	0xe19
+	.uleb128 0xa
+	.long	0x30
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2073
+	.byte	0x11
+	.value	0x14c
+	.byte	0x9
+	.long	0xab
+	.long	0xe5f
+	.uleb128 0x2b
+	.long	.LASF2077
+	.byte	0x11
+	.value	0x14c
+	.byte	0x26
+	.long	0xab
+	.uleb128 0xf
+	.uleb128 0x2c
+	.long	.LASF2074
+	.byte	0x11
+	.value	0x14d
+	.byte	0xe3
+	.long	0x7c
+	.uleb128 0x20
+	.long	.LASF2075
+	.value	0x1b7
+	.long	0x7c
+	.uleb128 0xf
+	.uleb128 0x20
+	.long	.LASF2076
+	.value	0x143
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2108
+	.byte	0x11
+	.byte	0xa5
+	.byte	0x6
+	.long	0xf04
+	.uleb128 0x13
+	.long	.LASF2078
+	.byte	0xa5
+	.byte	0x2f
+	.long	0x405
+	.uleb128 0x6
+	.long	.LASF2079
+	.byte	0xa7
+	.byte	0x15
+	.long	0x1dc
+	.uleb128 0x6
+	.long	.LASF2080
+	.byte	0xa8
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x6
+	.long	.LASF2081
+	.byte	0xa9
+	.byte	0x15
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF2082
+	.byte	0xaa
+	.byte	0x15
+	.long	0x1dc
+	.uleb128 0x6
+	.long	.LASF2083
+	.byte	0xab
+	.byte	0x14
+	.long	0x1e8
+	.uleb128 0x6
+	.long	.LASF2084
+	.byte	0xaf
+	.byte	0xe
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF2085
+	.byte	0xbe
+	.byte	0x9
+	.long	0x1ed
+	.uleb128 0x11
+	.long	0xed4
+	.uleb128 0x6
+	.long	.LASF2086
+	.byte	0xd1
+	.byte	0x20
+	.long	0x1e8
+	.byte	0
+	.uleb128 0x11
+	.long	0xee5
+	.uleb128 0x6
+	.long	.LASF2087
+	.byte	0xf8
+	.byte	0x13
+	.long	0x1f4
+	.byte	0
+	.uleb128 0x11
+	.long	0xef6
+	.uleb128 0x6
+	.long	.LASF2087
+	.byte	0xfe
+	.byte	0x13
+	.long	0x1f4
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.string	"i"
+	.byte	0x11
+	.value	0x106
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2109
+	.byte	0x11
+	.byte	0x92
+	.byte	0xd
+	.long	0xf1c
+	.uleb128 0x21
+	.string	"tmp"
+	.byte	0x94
+	.byte	0x16
+	.long	0x4c5
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2088
+	.byte	0x86
+	.byte	0x5
+	.long	0x1ed
+	.long	0xf4d
+	.uleb128 0x13
+	.long	.LASF2089
+	.byte	0x86
+	.byte	0x29
+	.long	0x4c5
+	.uleb128 0x6
+	.long	.LASF2090
+	.byte	0x88
+	.byte	0x13
+	.long	0xf4d
+	.uleb128 0xf
+	.uleb128 0x21
+	.string	"i"
+	.byte	0x89
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	0xc3
+	.long	0xf5c
+	.uleb128 0x16
+	.long	0x37
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2091
+	.byte	0x81
+	.byte	0x12
+	.long	0x4c5
+	.uleb128 0x22
+	.long	.LASF2092
+	.byte	0x78
+	.byte	0x13
+	.long	0x44d
+	.uleb128 0x14
+	.long	.LASF2093
+	.byte	0x66
+	.byte	0x12
+	.long	0x405
+	.long	0xfa3
+	.uleb128 0x13
+	.long	.LASF2094
+	.byte	0x66
+	.byte	0x3f
+	.long	0x429
+	.uleb128 0x6
+	.long	.LASF2095
+	.byte	0x68
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x6
+	.long	.LASF1811
+	.byte	0x6f
+	.byte	0x14
+	.long	0xd4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2096
+	.byte	0x61
+	.byte	0x5
+	.long	0x1ed
+	.long	0xfd1
+	.uleb128 0x11
+	.long	0xfc3
+	.uleb128 0x6
+	.long	.LASF2097
+	.byte	0x63
+	.byte	0x3c
+	.long	0x9f
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x6
+	.long	.LASF2098
+	.byte	0x63
+	.byte	0xd4
+	.long	0x9f
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2099
+	.byte	0x5c
+	.byte	0x5
+	.long	0x1ed
+	.long	0x100a
+	.uleb128 0x13
+	.long	.LASF2100
+	.byte	0x5c
+	.byte	0x28
+	.long	0xc8
+	.uleb128 0x11
+	.long	0xffc
+	.uleb128 0x6
+	.long	.LASF2101
+	.byte	0x5e
+	.byte	0x3b
+	.long	0x9f
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x6
+	.long	.LASF2102
+	.byte	0x5e
+	.byte	0xb3
+	.long	0x9f
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2103
+	.byte	0xe
+	.byte	0x82
+	.byte	0x65
+	.long	0x1016
+	.uleb128 0xc
+	.long	0xac8
+	.uleb128 0x19
+	.long	.LASF2104
+	.byte	0x9
+	.byte	0x65
+	.byte	0x79
+	.long	0x1027
+	.uleb128 0xc
+	.long	0x5bd
+	.uleb128 0x19
+	.long	.LASF2105
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x8d
+	.long	0x1038
+	.uleb128 0xc
+	.long	0x560
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 3
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 333
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 25 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 27 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1b
+	.file 28 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 30 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 31 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1f
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 34 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 36 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 41 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 42 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2f
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1004
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x36
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 56 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x38
+	.file 57 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 58 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 59 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3b
+	.byte	0x4
+	.file 60 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 61 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3d
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 62 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 63 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3f
+	.file 64 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 65 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 66 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 67 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x43
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x18
+	.byte	0x4
+	.file 68 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 69 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1510
+	.byte	0x4
+	.file 70 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1511
+	.byte	0x4
+	.file 71 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 72 "./src/main/fc/controlrate_profile.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1523
+	.byte	0x4
+	.file 73 "./src/main/fc/rc_curves.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xa
+	.file 74 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4a
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 75 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x14
+	.file 76 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4c
+	.byte	0x4
+	.file 77 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 78 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4f
+	.file 80 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x50
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1619
+	.byte	0x4
+	.file 81 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x51
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1620
+	.file 82 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x52
+	.byte	0x4
+	.byte	0x4
+	.file 83 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x53
+	.file 84 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x54
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3d
+	.uleb128 0x15
+	.file 85 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3e
+	.uleb128 0x12
+	.file 86 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x56
+	.file 87 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1683
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1323
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1371
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1410
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1438
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1522
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1579
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1587
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1590
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1618
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1656
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1660
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1666
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1680
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x17
+	.long	.LASF1
+	.long	.LASF2110
+	.long	.LASF2111
+	.long	.LASF2112
+	.long	.LASF2113
+	.long	.LASF2114
+	.long	.LASF2115
+	.long	.LASF2116
+	.long	.LASF2117
+	.long	.LASF2118
+	.long	.LASF2119
+	.long	.LASF2120
+	.long	.LASF2121
+	.long	.LASF2122
+	.long	.LASF2123
+	.long	.LASF2124
+	.long	.LASF2125
+	.long	.LASF2126
+	.long	.LASF2127
+	.long	.LASF2128
+	.long	.LASF2129
+	.long	.LASF2130
+	.long	.LASF2131
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x58
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2132
+	.byte	0x12
+	.long	.LASF2133
+	.byte	0x12
+	.long	.LASF2134
+	.byte	0x12
+	.long	.LASF2135
+	.byte	0x4
+	.long	.LASF2136
+	.byte	0x3
+	.long	.LASF2137
+	.byte	0x7
+	.long	.LASF2138
+	.byte	0x8
+	.long	.LASF2139
+	.byte	0x8
+	.long	.LASF2140
+	.byte	0x8
+	.long	.LASF2141
+	.byte	0x8
+	.long	.LASF2142
+	.byte	0x8
+	.long	.LASF2143
+	.byte	0x9
+	.long	.LASF2144
+	.byte	0xa
+	.long	.LASF2145
+	.byte	0xc
+	.long	.LASF2146
+	.byte	0x7
+	.long	.LASF2147
+	.byte	0xd
+	.long	.LASF2148
+	.byte	0x8
+	.long	.LASF2149
+	.byte	0xd
+	.long	.LASF2150
+	.byte	0xd
+	.long	.LASF2151
+	.byte	0xb
+	.long	.LASF2152
+	.byte	0xd
+	.long	.LASF2153
+	.byte	0x9
+	.long	.LASF2136
+	.byte	0x7
+	.long	.LASF2154
+	.byte	0x4
+	.long	.LASF2155
+	.byte	0x15
+	.long	.LASF2156
+	.byte	0x16
+	.long	.LASF2157
+	.byte	0x16
+	.long	.LASF2157
+	.byte	0x15
+	.long	.LASF2158
+	.byte	0x12
+	.long	.LASF2159
+	.byte	0x15
+	.long	.LASF2160
+	.byte	0x15
+	.long	.LASF2161
+	.byte	0x12
+	.long	.LASF2162
+	.byte	0x12
+	.long	.LASF2163
+	.byte	0x14
+	.long	.LASF2164
+	.byte	0x12
+	.long	.LASF2165
+	.byte	0x13
+	.long	.LASF2166
+	.byte	0x13
+	.long	.LASF2167
+	.byte	0x12
+	.long	.LASF2168
+	.byte	0x12
+	.long	.LASF2169
+	.byte	0x12
+	.long	.LASF2170
+	.byte	0x15
+	.long	.LASF2171
+	.byte	0x16
+	.long	.LASF2172
+	.byte	0x11
+	.long	.LASF2173
+	.byte	0x11
+	.long	.LASF2174
+	.byte	0x15
+	.long	.LASF2175
+	.byte	0x15
+	.long	.LASF2176
+	.byte	0x12
+	.long	.LASF2177
+	.byte	0x12
+	.long	.LASF2178
+	.byte	0x12
+	.long	.LASF2179
+	.byte	0x12
+	.long	.LASF2180
+	.byte	0x12
+	.long	.LASF2181
+	.byte	0x12
+	.long	.LASF2182
+	.byte	0x12
+	.long	.LASF2183
+	.byte	0x12
+	.long	.LASF2184
+	.byte	0x12
+	.long	.LASF2185
+	.byte	0x10
+	.long	.LASF2186
+	.byte	0xf
+	.long	.LASF2187
+	.byte	0xe
+	.long	.LASF2188
+	.byte	0xf
+	.long	.LASF2189
+	.byte	0xf
+	.long	.LASF2190
+	.byte	0x2
+	.long	.LASF2191
+	.byte	0x2
+	.long	.LASF2192
+	.byte	0x1
+	.long	.LASF2193
+	.byte	0x1
+	.long	.LASF2194
+	.byte	0x3
+	.long	.LASF2195
+	.byte	0x3
+	.long	.LASF2196
+	.byte	0x3
+	.long	.LASF2197
+	.byte	0x4
+	.long	.LASF2198
+	.byte	0x7
+	.long	.LASF2199
+	.byte	0x7
+	.long	.LASF2200
+	.byte	0x8
+	.long	.LASF2201
+	.byte	0x8
+	.long	.LASF2202
+	.byte	0x8
+	.long	.LASF2203
+	.byte	0x3
+	.long	.LASF2204
+	.byte	0xa
+	.long	.LASF2205
+	.byte	0x3
+	.long	.LASF2206
+	.byte	0x3
+	.long	.LASF2207
+	.byte	0xd
+	.long	.LASF2207
+	.byte	0x6
+	.long	.LASF2208
+	.byte	0x7
+	.long	.LASF2209
+	.byte	0x7
+	.long	.LASF2210
+	.byte	0x7
+	.long	.LASF2211
+	.byte	0x7
+	.long	.LASF2212
+	.byte	0x7
+	.long	.LASF2213
+	.byte	0x7
+	.long	.LASF2214
+	.byte	0x5
+	.long	.LASF2215
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1180:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF732:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1280:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF758:
+	.string	"__DECL_SIMD_logf "
+.LASF1153:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF991:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1129:
+	.string	"USE_RX_PPM "
+.LASF1254:
+	.string	"USE_FAKE_BARO "
+.LASF769:
+	.string	"__DECL_SIMD_expl "
+.LASF1258:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1929:
+	.string	"PID_VEL_Z"
+.LASF1597:
+	.string	"MIDRC_MIN 1200"
+.LASF1768:
+	.string	"THROTTLE"
+.LASF876:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1523:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF1241:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1203:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF867:
+	.string	"__DECL_SIMD_sinh "
+.LASF1744:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1377:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1265:
+	.string	"USE_UART7 "
+.LASF731:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1785:
+	.string	"THROTTLE_STATUS_TYPE_COMMAND"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF795:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1835:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1718:
+	.string	"ADC_BATTERY"
+.LASF1513:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1204:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1096:
+	.string	"FP_NORMAL 4"
+.LASF931:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF911:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF768:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2009:
+	.string	"OWNER_RX_SPI"
+.LASF1466:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1335:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF987:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1184:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1854:
+	.string	"BOXCAMERA1"
+.LASF1899:
+	.string	"ANTI_WINDUP"
+.LASF1689:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1925:
+	.string	"PID_VEL_XY"
+.LASF1847:
+	.string	"BOXGCSNAV"
+.LASF1376:
+	.string	"FAST_MATH "
+.LASF1875:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1717:
+	.string	"_Bool"
+.LASF1967:
+	.string	"spektrum_sat_bind"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF726:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1273:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1302:
+	.string	"U_ID_2 2"
+.LASF1622:
+	.string	"DMA_NONE (0)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1036:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF777:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1508:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1928:
+	.string	"PID_HEADING"
+.LASF1585:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1860:
+	.string	"BOXNAVCRUISE"
+.LASF1881:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1451:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1606:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1275:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1809:
+	.string	"pos_hold_deadband"
+.LASF1647:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1820:
+	.string	"disarm_kill_switch"
+.LASF1981:
+	.string	"rxConfig_System"
+.LASF1791:
+	.string	"THROTTLE_THRESHOLD"
+.LASF1862:
+	.string	"BOXUSER1"
+.LASF1863:
+	.string	"BOXUSER2"
+.LASF1543:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF864:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF772:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1233:
+	.string	"__WCHAR_T__ "
+.LASF1683:
+	.string	"DEFAULT_RC_SWITCH_DISARM_DELAY_MS 250"
+.LASF1390:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1305:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1536:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1130:
+	.string	"USE_SERIAL_RX "
+.LASF2045:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF1152:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF743:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2033:
+	.string	"RESOURCE_SPI_MISO"
+.LASF1187:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1362:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF869:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1979:
+	.string	"rssi_source"
+.LASF1100:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1441:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2006:
+	.string	"OWNER_LED"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1528:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1733:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1213:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1700:
+	.string	"uint16_t"
+.LASF2031:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1386:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1988:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF1963:
+	.string	"halfDuplex"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1037:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1890:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF975:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1298:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF889:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2073:
+	.string	"getRcStickDeflection"
+.LASF1099:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1308:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1207:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1222:
+	.string	"_T_PTRDIFF_ "
+.LASF1125:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1793:
+	.string	"ROL_CE"
+.LASF1601:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF739:
+	.string	"__DECL_SIMD_sinl "
+.LASF1462:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1269:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1444:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1479:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF2008:
+	.string	"OWNER_TX"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1808:
+	.string	"yaw_deadband"
+.LASF1556:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1629:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1405:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1978:
+	.string	"mspOverrideChannels"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1270:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1430:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1896:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1232:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1946:
+	.string	"BEEPER_READY_BEEP"
+.LASF760:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2082:
+	.string	"rcDisarmTimeMs"
+.LASF1459:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1676:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1021:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2063:
+	.string	"gyroStartCalibration"
+.LASF816:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2020:
+	.string	"RESOURCE_NONE"
+.LASF1922:
+	.string	"PID_YAW"
+.LASF1762:
+	.string	"DISARM_REASON_COUNT"
+.LASF759:
+	.string	"__DECL_SIMD_logl "
+.LASF1082:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1033:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1786:
+	.string	"throttleStatusType_e"
+.LASF1175:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF996:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1872:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1426:
+	.string	"BIT(x) (1 << (x))"
+.LASF2000:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1926:
+	.string	"PID_SURFACE"
+.LASF1758:
+	.string	"DISARM_SWITCH"
+.LASF977:
+	.string	"__DECL_SIMD_erfc "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1446:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1698:
+	.string	"int32_t"
+.LASF999:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2029:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1913:
+	.string	"ROVER"
+.LASF1593:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1253:
+	.string	"USE_IMU_FAKE "
+.LASF1097:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1501:
+	.string	"PG_INAV_END 1023"
+.LASF2090:
+	.string	"mask"
+.LASF951:
+	.string	"__DECL_SIMD_erff32 "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2011:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1526:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2021:
+	.string	"RESOURCE_INPUT"
+.LASF1511:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1542:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1274:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1453:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1942:
+	.string	"BEEPER_GPS_STATUS"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1293:
+	.string	"USE_RX_PPM"
+.LASF1918:
+	.string	"FW_HEADING_USE_YAW"
+.LASF513:
+	.string	"__always_inline"
+.LASF2030:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF952:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1743:
+	.string	"FEATURE_UNUSED_10"
+.LASF1750:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1612:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1911:
+	.string	"AIRPLANE"
+.LASF1666:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1465:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1052:
+	.string	"__MATH_PRECNAME"
+.LASF902:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF2085:
+	.string	"armingSwitchIsActive"
+.LASF2086:
+	.string	"disarmDelay"
+.LASF1313:
+	.string	"FAST_CODE "
+.LASF1162:
+	.string	"USE_OPFLOW "
+.LASF1707:
+	.string	"PGR_SIZE_MASK"
+.LASF1259:
+	.string	"USE_UART1 "
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1084:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1287:
+	.string	"USE_1WIRE_DS2482"
+.LASF1055:
+	.string	"_Mdouble_ float"
+.LASF1521:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1284:
+	.string	"USE_PITOT_MS4525"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1039:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1171:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1256:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1404:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF939:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1088:
+	.string	"__MATHCALL_NARROW"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1172:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF725:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1073:
+	.string	"__MATHDECL_1"
+.LASF1956:
+	.string	"BEEPER_PREFERENCE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1958:
+	.string	"rxConfig_s"
+.LASF1980:
+	.string	"rxConfig_t"
+.LASF1999:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2054:
+	.string	"saveConfigAndNotify"
+.LASF1794:
+	.string	"ROL_HI"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF396:
+	.string	"false 0"
+.LASF2019:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1349:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF827:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1392:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1827:
+	.string	"BOXHORIZON"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1421:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1351:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1541:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1969:
+	.string	"rssi_channel"
+.LASF1754:
+	.string	"DISARM_NONE"
+.LASF1888:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1197:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF845:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1231:
+	.string	"__need_ptrdiff_t"
+.LASF1169:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1449:
+	.string	"PG_PID_PROFILE 14"
+.LASF990:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1136:
+	.string	"USE_ADC_AVERAGING "
+.LASF1047:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1001:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1587:
+	.string	"HDOP_SCALE (100)"
+.LASF1369:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1494:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1648:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1338:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1724:
+	.string	"FEATURE_VBAT"
+.LASF1873:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF1987:
+	.string	"OWNER_SERVO"
+.LASF1286:
+	.string	"USE_1WIRE"
+.LASF1824:
+	.string	"armingConfig_Copy"
+.LASF1401:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1360:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1633:
+	.string	"SPIDEV_COUNT 4"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2060:
+	.string	"beeper"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF852:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF785:
+	.string	"__DECL_SIMD_powf64x "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1477:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1948:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1410:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF928:
+	.string	"__DECL_SIMD_atanhf "
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1437:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2018:
+	.string	"OWNER_IRLOCK"
+.LASF1654:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1492:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF786:
+	.string	"__DECL_SIMD_powf128x "
+.LASF984:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2094:
+	.string	"type"
+.LASF2084:
+	.string	"stTmp"
+.LASF1427:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1614:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1607:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1228:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1341:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1591:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1690:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1971:
+	.string	"rssiMax"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1558:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1692:
+	.string	"__uint16_t"
+.LASF1024:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2052:
+	.string	"armingConfig_Registry"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1986:
+	.string	"OWNER_MOTOR"
+.LASF853:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2096:
+	.string	"areSticksDeflectedMoreThanPosHoldDeadband"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1304:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1838:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1244:
+	.string	"__INT_WCHAR_T_H "
+.LASF1634:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF898:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1742:
+	.string	"FEATURE_BLACKBOX"
+.LASF1482:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF995:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1569:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF800:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1524:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1756:
+	.string	"DISARM_STICKS"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1397:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1461:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1745:
+	.string	"FEATURE_AIRMODE"
+.LASF1964:
+	.string	"rx_spi_protocol"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1792:
+	.string	"ROL_LO"
+.LASF950:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF962:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1781:
+	.string	"THROTTLE_LOW"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF783:
+	.string	"__DECL_SIMD_powf128 "
+.LASF824:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2043:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1102:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2042:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1625:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1983:
+	.string	"OWNER_PWMIO"
+.LASF1020:
+	.string	"__f32x(x) x ##f32x"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1072:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1641:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1174:
+	.string	"USE_OLED_UG2864 "
+.LASF1945:
+	.string	"BEEPER_ACTION_FAIL"
+.LASF1054:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1191:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1214:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1415:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1086:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1684:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1565:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1727:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1503:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1509:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1229:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1389:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1429:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1144:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1141:
+	.string	"USE_NAV "
+.LASF819:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1965:
+	.string	"rx_spi_id"
+.LASF1570:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1450:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1702:
+	.string	"float"
+.LASF1953:
+	.string	"BEEPER_CAM_CONNECTION_OPEN"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1445:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2104:
+	.string	"armingConfig"
+.LASF2074:
+	.string	"_left5"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1825:
+	.string	"BOXARM"
+.LASF1312:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1243:
+	.string	"___int_wchar_t_h "
+.LASF1075:
+	.string	"__MATHDECL"
+.LASF1973:
+	.string	"mincheck"
+.LASF1861:
+	.string	"BOXBRAKING"
+.LASF949:
+	.string	"__DECL_SIMD_erfl "
+.LASF1588:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1812:
+	.string	"airmodeHandlingType"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1483:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF810:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1221:
+	.string	"_PTRDIFF_T "
+.LASF1805:
+	.string	"pgRegistry_s"
+.LASF1715:
+	.string	"pgRegistry_t"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1874:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1729:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1651:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF1325:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1114:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2047:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1485:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF906:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF831:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1371:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1836:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF374:
+	.string	"__unix 1"
+.LASF1709:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1139:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2010:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1134:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1769:
+	.string	"AUX1"
+.LASF1770:
+	.string	"AUX2"
+.LASF1771:
+	.string	"AUX3"
+.LASF1772:
+	.string	"AUX4"
+.LASF1728:
+	.string	"FEATURE_UNUSED_1"
+.LASF1774:
+	.string	"AUX6"
+.LASF1731:
+	.string	"FEATURE_UNUSED_3"
+.LASF1732:
+	.string	"FEATURE_UNUSED_4"
+.LASF1736:
+	.string	"FEATURE_UNUSED_5"
+.LASF1737:
+	.string	"FEATURE_UNUSED_6"
+.LASF1741:
+	.string	"FEATURE_UNUSED_7"
+.LASF1748:
+	.string	"FEATURE_UNUSED_8"
+.LASF1749:
+	.string	"FEATURE_UNUSED_9"
+.LASF1299:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1974:
+	.string	"maxcheck"
+.LASF1943:
+	.string	"BEEPER_RX_SET"
+.LASF1878:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1476:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1939:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF1408:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1367:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1202:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1319:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1993:
+	.string	"OWNER_RANGEFINDER"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1804:
+	.string	"stickPositions_e"
+.LASF1531:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF2059:
+	.string	"setConfigProfileAndWriteEEPROM"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1642:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1932:
+	.string	"BEEPER_SILENCE"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF2081:
+	.string	"rcSticks"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF857:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1906:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF929:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1604:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF749:
+	.string	"__DECL_SIMD_sincosl "
+.LASF980:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1747:
+	.string	"FEATURE_VTX"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1069:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1297:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1868:
+	.string	"boxId_e"
+.LASF1705:
+	.string	"PGR_PGN_MASK"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1573:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1954:
+	.string	"BEEPER_CAM_CONNECTION_CLOSE"
+.LASF1251:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1383:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF736:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2034:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF899:
+	.string	"__DECL_SIMD_log10l "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF1290:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1545:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1833:
+	.string	"BOXNAVRTH"
+.LASF2091:
+	.string	"getRcStickPositions"
+.LASF1285:
+	.string	"USE_PITOT_ADC"
+.LASF1669:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF776:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1885:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1788:
+	.string	"CENTERED"
+.LASF1178:
+	.string	"USE_DJI_HD_OSD "
+.LASF1396:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1012:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF727:
+	.string	"__DECL_SIMD_cos "
+.LASF1716:
+	.string	"timeMs_t"
+.LASF1103:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1598:
+	.string	"MIDRC_MAX 1700"
+.LASF1784:
+	.string	"THROTTLE_STATUS_TYPE_RC"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1550:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1783:
+	.string	"throttleStatus_e"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1334:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF905:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF808:
+	.string	"__DECL_SIMD_asinf "
+.LASF1164:
+	.string	"USE_OPFLOW_MSP "
+.LASF1711:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF1968:
+	.string	"spektrum_sat_bind_autoreset"
+.LASF1970:
+	.string	"rssiMin"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1976:
+	.string	"rx_max_usec"
+.LASF1330:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1957:
+	.string	"beeperMode_e"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF699:
+	.string	"__need_NULL "
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1063:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1484:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1520:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1720:
+	.string	"ADC_CURRENT"
+.LASF728:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1866:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF2013:
+	.string	"OWNER_TEMPERATURE"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1740:
+	.string	"FEATURE_DASHBOARD"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1116:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2004:
+	.string	"OWNER_INVERTER"
+.LASF1113:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1602:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1004:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1710:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF753:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1699:
+	.string	"uint8_t"
+.LASF1038:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1640:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1154:
+	.string	"USE_RX_UIB "
+.LASF1563:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1423:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1884:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1538:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2044:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1892:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1869:
+	.string	"ARMED"
+.LASF793:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1635:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1627:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1567:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF947:
+	.string	"__DECL_SIMD_erf "
+.LASF1767:
+	.string	"PITCH"
+.LASF1834:
+	.string	"BOXNAVPOSHOLD"
+.LASF1291:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1921:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1245:
+	.string	"_GCC_WCHAR_T "
+.LASF1240:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2023:
+	.string	"RESOURCE_IO"
+.LASF854:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1760:
+	.string	"DISARM_FAILSAFE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1317:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1311:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF794:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF376:
+	.string	"unix 1"
+.LASF1093:
+	.string	"FP_INFINITE 1"
+.LASF1083:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF847:
+	.string	"__DECL_SIMD_cosh "
+.LASF1085:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF737:
+	.string	"__DECL_SIMD_sin "
+.LASF1159:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1248:
+	.string	"_BSD_WCHAR_T_"
+.LASF1681:
+	.string	"AIRMODE_DEADBAND 25"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1347:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1003:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1276:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1972:
+	.string	"sbusSyncInterval"
+.LASF1533:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1292:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1517:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1985:
+	.string	"OWNER_PPMINPUT"
+.LASF1904:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF780:
+	.string	"__DECL_SIMD_powf16 "
+.LASF811:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1028:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1160:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1613:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1324:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2077:
+	.string	"axis"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1580:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1218:
+	.string	"_STDDEF_H "
+.LASF2108:
+	.string	"processRcStickPositions"
+.LASF1255:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1674:
+	.string	"GYRO_LPF_NONE 7"
+.LASF2109:
+	.string	"updateRcStickPositions"
+.LASF1436:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1618:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1871:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1014:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF974:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF765:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1566:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1056:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1568:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1306:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1645:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1346:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1851:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1149:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1930:
+	.string	"PID_POS_HEADING"
+.LASF1393:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1660:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1725:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF2055:
+	.string	"activateBatteryProfile"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1927:
+	.string	"PID_LEVEL"
+.LASF1811:
+	.string	"mid_throttle_deadband"
+.LASF1435:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1148:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1059:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1094:
+	.string	"FP_ZERO 2"
+.LASF1499:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1564:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF2106:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1002:
+	.string	"__f128(x) x ##f128"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1058:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1519:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF2057:
+	.string	"applyAndSaveBoardAlignmentDelta"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1813:
+	.string	"airmodeThrottleThreshold"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2095:
+	.string	"value"
+.LASF1403:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1673:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2012:
+	.string	"OWNER_COMPASS"
+.LASF1364:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF809:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1595:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF988:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1322:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1092:
+	.string	"FP_NAN 0"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1712:
+	.string	"address"
+.LASF1409:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1309:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1294:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF729:
+	.string	"__DECL_SIMD_cosl "
+.LASF2026:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1615:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1829:
+	.string	"BOXHEADINGHOLD"
+.LASF1041:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1355:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF719:
+	.string	"NULL"
+.LASF1155:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1506:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1894:
+	.string	"GPS_FIX_HOME"
+.LASF1176:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1852:
+	.string	"BOXAUTOTRIM"
+.LASF1755:
+	.string	"DISARM_TIMEOUT"
+.LASF1994:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2067:
+	.string	"tryArm"
+.LASF466:
+	.string	"__PMT"
+.LASF1418:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1246:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1163:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2039:
+	.string	"RESOURCE_RX_CE"
+.LASF1962:
+	.string	"serialrx_inverted"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1150:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF807:
+	.string	"__DECL_SIMD_asin "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1411:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1491:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1665:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2093:
+	.string	"calculateThrottleStatus"
+.LASF1109:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1816:
+	.string	"rcControlsConfig_System"
+.LASF908:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1901:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1893:
+	.string	"armingFlags"
+.LASF1070:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF957:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1548:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1133:
+	.string	"USE_SERIALRX_IBUS "
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1605:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1708:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1095:
+	.string	"FP_SUBNORMAL 3"
+.LASF1876:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1000:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1034:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1826:
+	.string	"BOXANGLE"
+.LASF1850:
+	.string	"BOXFLAPERON"
+.LASF1211:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1879:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF798:
+	.string	"__DECL_SIMD_atanf "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1236:
+	.string	"_T_WCHAR "
+.LASF2025:
+	.string	"RESOURCE_UART_TX"
+.LASF1555:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1417:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1947:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1234:
+	.string	"_WCHAR_T "
+.LASF1787:
+	.string	"NOT_CENTERED"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1146:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1328:
+	.string	"UNIT_TESTED "
+.LASF2071:
+	.string	"feature"
+.LASF761:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF2062:
+	.string	"saveNonVolatileWaypointList"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF806:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1626:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1949:
+	.string	"BEEPER_ARMED"
+.LASF1357:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF805:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF851:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1655:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1472:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF2079:
+	.string	"lastTickTimeMs"
+.LASF1016:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1440:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1909:
+	.string	"AIRMODE_ACTIVE"
+.LASF1880:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1343:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1336:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1512:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1066:
+	.string	"_Mdouble_ _Float128"
+.LASF1525:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1030:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF2061:
+	.string	"loadNonVolatileWaypointList"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2058:
+	.string	"setConfigBatteryProfileAndWriteEEPROM"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1907:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1131:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1481:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1679:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF1467:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1581:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1908:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1917:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF919:
+	.string	"__DECL_SIMD_log1pl "
+.LASF801:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2099:
+	.string	"areSticksInApModePosition"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1895:
+	.string	"GPS_FIX"
+.LASF1532:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF1682:
+	.string	"MIN_RC_TICK_INTERVAL_MS 20"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1815:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1087:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF873:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2046:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF1372:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1719:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1955:
+	.string	"BEEPER_ALL"
+.LASF1031:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF813:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF781:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF2051:
+	.string	"pgResetTemplate_armingConfig"
+.LASF912:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1590:
+	.string	"RADAR_MAX_POIS 5"
+.LASF797:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1165:
+	.string	"USE_PITOT_MS4525 "
+.LASF1074:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1870:
+	.string	"WAS_EVER_ARMED"
+.LASF1714:
+	.string	"reset"
+.LASF1157:
+	.string	"USE_RANGEFINDER "
+.LASF1399:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1378:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1475:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1941:
+	.string	"BEEPER_BAT_LOW"
+.LASF1412:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1649:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF814:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1997:
+	.string	"OWNER_SDCARD"
+.LASF1120:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF917:
+	.string	"__DECL_SIMD_log1p "
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1764:
+	.string	"disarmReason_e"
+.LASF989:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1185:
+	.string	"USE_LOG "
+.LASF1104:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1323:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1763:
+	.string	"disarmReason_t"
+.LASF1697:
+	.string	"int16_t"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1110:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1315:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1685:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1912:
+	.string	"MULTIROTOR"
+.LASF1688:
+	.string	"signed char"
+.LASF1017:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF745:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF2087:
+	.string	"success"
+.LASF1778:
+	.string	"AUX10"
+.LASF1779:
+	.string	"AUX11"
+.LASF1780:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1090:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1636:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1379:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1242:
+	.string	"_WCHAR_T_H "
+.LASF1746:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2075:
+	.string	"_right6"
+.LASF1738:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1902:
+	.string	"COMPASS_CALIBRATED"
+.LASF945:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1375:
+	.string	"sq(x) ((x)*(x))"
+.LASF741:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1158:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF766:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1656:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF1867:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1019:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1937:
+	.string	"BEEPER_DISARMING"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1277:
+	.string	"USE_DASHBOARD"
+.LASF1212:
+	.string	"USE_VTX_FFPV "
+.LASF1621:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1121:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1600:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1832:
+	.string	"BOXCAMSTAB"
+.LASF909:
+	.string	"__DECL_SIMD_log2l "
+.LASF1561:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1951:
+	.string	"BEEPER_USB"
+.LASF1977:
+	.string	"rcFilterFrequency"
+.LASF1959:
+	.string	"receiverType"
+.LASF1457:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1008:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1182:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1845:
+	.string	"BOXAIRMODE"
+.LASF934:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1961:
+	.string	"serialrx_provider"
+.LASF1060:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1889:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1210:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1990:
+	.string	"OWNER_SERIAL"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1220:
+	.string	"_ANSI_STDDEF_H "
+.LASF1105:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2001:
+	.string	"OWNER_OSD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF2017:
+	.string	"OWNER_PINIO"
+.LASF802:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1168:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1706:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF763:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1668:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1142:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1252:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1830:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1112:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1471:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1361:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1546:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1029:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1478:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2078:
+	.string	"throttleStatus"
+.LASF775:
+	.string	"__DECL_SIMD_expf64x "
+.LASF2068:
+	.string	"emergencyArmingUpdate"
+.LASF754:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1057:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1510:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF913:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF2050:
+	.string	"rcControlsConfig_Registry"
+.LASF1018:
+	.string	"__f32(x) x ##f32"
+.LASF1339:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1843:
+	.string	"BOXFAILSAFE"
+.LASF2002:
+	.string	"OWNER_BARO"
+.LASF1734:
+	.string	"FEATURE_CURRENT_METER"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1321:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1630:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF771:
+	.string	"__DECL_SIMD_expf32 "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF770:
+	.string	"__DECL_SIMD_expf16 "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1537:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1288:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1167:
+	.string	"USE_1WIRE_DS2482 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1752:
+	.string	"FEATURE_OSD"
+.LASF1713:
+	.string	"copy"
+.LASF2024:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1877:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1007:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1865:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1919:
+	.string	"stateFlags"
+.LASF1616:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1882:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1366:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1695:
+	.string	"long int"
+.LASF1855:
+	.string	"BOXCAMERA2"
+.LASF1856:
+	.string	"BOXCAMERA3"
+.LASF1454:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1650:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF910:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1639:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1628:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1193:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1672:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1991:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF848:
+	.string	"__DECL_SIMD_coshf "
+.LASF859:
+	.string	"__DECL_SIMD_expm1l "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1381:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1577:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1840:
+	.string	"BOXOSD"
+.LASF1544:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1225:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1425:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1923:
+	.string	"PID_POS_Z"
+.LASF1224:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF752:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1042:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1759:
+	.string	"DISARM_KILLSWITCH"
+.LASF1575:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF2040:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1413:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF877:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1422:
+	.string	"EXPAND_I(x) x"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1670:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF792:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1048:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1701:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1301:
+	.string	"U_ID_1 1"
+.LASF1522:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1428:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1572:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF2072:
+	.string	"rxGetChannelValue"
+.LASF1022:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1115:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1659:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1675:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF907:
+	.string	"__DECL_SIMD_log2 "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1796:
+	.string	"PIT_CE"
+.LASF1282:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF914:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1314:
+	.string	"NOINLINE "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF2053:
+	.string	"accStartCalibration"
+.LASF1823:
+	.string	"armingConfig_System"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2022:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF926:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2069:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1828:
+	.string	"BOXNAVALTHOLD"
+.LASF1023:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1530:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1452:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1818:
+	.string	"armingConfig_s"
+.LASF1822:
+	.string	"armingConfig_t"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1458:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1790:
+	.string	"STICK_CENTER"
+.LASF1025:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1842:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1687:
+	.string	"long unsigned int"
+.LASF1662:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1217:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1111:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1831:
+	.string	"BOXHEADADJ"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1468:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1354:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1235:
+	.string	"_T_WCHAR_ "
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1188:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1359:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF746:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1318:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1849:
+	.string	"BOXSURFACE"
+.LASF1247:
+	.string	"__DEFINED_wchar_t "
+.LASF1992:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1578:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1439:
+	.string	"PG_CF_START 1"
+.LASF757:
+	.string	"__DECL_SIMD_log "
+.LASF1817:
+	.string	"rcControlsConfig_Copy"
+.LASF1143:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1617:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF1137:
+	.string	"USE_64BIT_TIME "
+.LASF1051:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1582:
+	.string	"LAT 0"
+.LASF938:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1696:
+	.string	"char"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF835:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF903:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1551:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1839:
+	.string	"BOXNAVLAUNCH"
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1726:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1388:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF900:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF817:
+	.string	"__DECL_SIMD_hypot "
+.LASF1753:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1540:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1195:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1819:
+	.string	"fixed_wing_auto_arm"
+.LASF904:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF796:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1333:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1504:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1663:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1638:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1653:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1398:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1199:
+	.string	"USE_RX_MSP "
+.LASF1414:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1406:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1496:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF734:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1487:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1535:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1161:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF788:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1179:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF774:
+	.string	"__DECL_SIMD_expf32x "
+.LASF971:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1183:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1147:
+	.string	"USE_PITOT "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1394:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1368:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF1603:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1006:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1766:
+	.string	"ROLL"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF1761:
+	.string	"DISARM_NAVIGATION"
+.LASF2003:
+	.string	"OWNER_MPU"
+.LASF2016:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1374:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1643:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1350:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1463:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1920:
+	.string	"PID_ROLL"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF812:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1658:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1527:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1420:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2065:
+	.string	"failsafeIsActive"
+.LASF1132:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1559:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1326:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1358:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF838:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1547:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2028:
+	.string	"RESOURCE_EXTI"
+.LASF1249:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1797:
+	.string	"PIT_HI"
+.LASF1223:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF994:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF937:
+	.string	"__DECL_SIMD_acosh "
+.LASF1950:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF993:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1189:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1637:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1140:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1192:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF371:
+	.string	"__linux 1"
+.LASF1089:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1935:
+	.string	"BEEPER_RX_LOST"
+.LASF1122:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1194:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1495:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1151:
+	.string	"USE_GYRO_KALMAN "
+.LASF850:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1108:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1385:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1044:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1040:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1924:
+	.string	"PID_POS_XY"
+.LASF1802:
+	.string	"THR_CE"
+.LASF1373:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1434:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1365:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1952:
+	.string	"BEEPER_LAUNCH_MODE_ENABLED"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2100:
+	.string	"ap_mode"
+.LASF1337:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1507:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1624:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF787:
+	.string	"__DECL_SIMD_acos "
+.LASF1841:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1984:
+	.string	"OWNER_PWMINPUT"
+.LASF1903:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1344:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF764:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1348:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1432:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1571:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1145:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1027:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1119:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1200:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1215:
+	.string	"USE_CLI_BATCH "
+.LASF1703:
+	.string	"double"
+.LASF1664:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1281:
+	.string	"USE_RANGEFINDER"
+.LASF1900:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1799:
+	.string	"YAW_CE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF790:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF887:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1026:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1886:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF2101:
+	.string	"_abs0"
+.LASF2102:
+	.string	"_abs1"
+.LASF2097:
+	.string	"_abs2"
+.LASF2098:
+	.string	"_abs3"
+.LASF2076:
+	.string	"_abs4"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1238:
+	.string	"_WCHAR_T_ "
+.LASF1574:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1431:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1553:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1442:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1239:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1765:
+	.string	"rc_alias"
+.LASF1518:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1384:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1127:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1730:
+	.string	"FEATURE_GPS"
+.LASF1897:
+	.string	"SMALL_ANGLE"
+.LASF2007:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1910:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF1310:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1250:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1806:
+	.string	"rcControlsConfig_s"
+.LASF1814:
+	.string	"rcControlsConfig_t"
+.LASF1107:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1848:
+	.string	"BOXKILLSWITCH"
+.LASF1693:
+	.string	"__int32_t"
+.LASF2103:
+	.string	"rxConfig"
+.LASF1101:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1694:
+	.string	"__uint32_t"
+.LASF1810:
+	.string	"alt_hold_deadband"
+.LASF1631:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1739:
+	.string	"FEATURE_LED_STRIP"
+.LASF1620:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1455:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1891:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF2070:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1289:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1905:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF1190:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1795:
+	.string	"PIT_LO"
+.LASF1998:
+	.string	"OWNER_FLASH"
+.LASF789:
+	.string	"__DECL_SIMD_acosl "
+.LASF1456:
+	.string	"PG_RX_CONFIG 24"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF967:
+	.string	"__DECL_SIMD_asinh "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1205:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1043:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1173:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF778:
+	.string	"__DECL_SIMD_powf "
+.LASF1045:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1209:
+	.string	"USE_VTX_CONTROL "
+.LASF1424:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF784:
+	.string	"__DECL_SIMD_powf32x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF2088:
+	.string	"checkStickPosition"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF815:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1219:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1914:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1076:
+	.string	"__MATHCALL"
+.LASF901:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1497:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF969:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1735:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF1898:
+	.string	"FIXED_WING_LEGACY"
+.LASF1940:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF849:
+	.string	"__DECL_SIMD_coshl "
+.LASF1186:
+	.string	"USE_STATS "
+.LASF1257:
+	.string	"USE_MAG "
+.LASF2015:
+	.string	"OWNER_AIRSPEED"
+.LASF1488:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1068:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1853:
+	.string	"BOXAUTOTUNE"
+.LASF1123:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF954:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF927:
+	.string	"__DECL_SIMD_atanh "
+.LASF740:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF733:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1837:
+	.string	"BOXLEDLOW"
+.LASF1773:
+	.string	"AUX5"
+.LASF1035:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1775:
+	.string	"AUX7"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1776:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1777:
+	.string	"AUX9"
+.LASF1500:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF916:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1757:
+	.string	"DISARM_SWITCH_3D"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1226:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1237:
+	.string	"__WCHAR_T "
+.LASF1124:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1596:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1469:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1611:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1864:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF856:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1644:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF818:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1803:
+	.string	"THR_HI"
+.LASF992:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF803:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1013:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1098:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1678:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF955:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1300:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1046:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF782:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1704:
+	.string	"pgn_t"
+.LASF998:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1589:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1721:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1363:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1592:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF804:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1126:
+	.string	"I2C1_OVERCLOCK false"
+.LASF2049:
+	.string	"pgResetTemplate_rcControlsConfig"
+.LASF1583:
+	.string	"LON 1"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1936:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF828:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1490:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF744:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1722:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1433:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1117:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1800:
+	.string	"YAW_HI"
+.LASF1156:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF997:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1562:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1846:
+	.string	"BOXHOMERESET"
+.LASF1181:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1576:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2105:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1303:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1061:
+	.string	"_Mdouble_ _Float32"
+.LASF1821:
+	.string	"switchDisarmDelayMs"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1443:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1278:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1331:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1356:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1557:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1216:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1316:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1271:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2035:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2036:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2037:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2038:
+	.string	"RESOURCE_ADC_CH4"
+.LASF855:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1610:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1883:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1982:
+	.string	"OWNER_FREE"
+.LASF837:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF825:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF942:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF2066:
+	.string	"rxIsReceivingSignal"
+.LASF1400:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF742:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1206:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1166:
+	.string	"USE_1WIRE "
+.LASF958:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1534:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1632:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF1975:
+	.string	"rx_min_usec"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1502:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1966:
+	.string	"rx_spi_rf_channel_count"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1015:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1667:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1552:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF2014:
+	.string	"OWNER_1WIRE"
+.LASF735:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1529:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1419:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1327:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1272:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF799:
+	.string	"__DECL_SIMD_atanl "
+.LASF1266:
+	.string	"USE_UART8 "
+.LASF1586:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF839:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1407:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1579:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1227:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF897:
+	.string	"__DECL_SIMD_log10 "
+.LASF843:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1915:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF953:
+	.string	"__DECL_SIMD_erff128 "
+.LASF836:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1516:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF738:
+	.string	"__DECL_SIMD_sinf "
+.LASF870:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1138:
+	.string	"USE_BLACKBOX "
+.LASF791:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1801:
+	.string	"THR_LO"
+.LASF1370:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF1652:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1464:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1916:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF779:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2083:
+	.string	"currentTimeMs"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1619:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF756:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF961:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1723:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1135:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1170:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1352:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF2080:
+	.string	"rcDelayCommand"
+.LASF1064:
+	.string	"_Mdouble_ _Float64"
+.LASF1844:
+	.string	"BOXNAVWP"
+.LASF1296:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1480:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1329:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1960:
+	.string	"rcmap"
+.LASF1071:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1402:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1677:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1661:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1751:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2032:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1995:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1382:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1473:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1798:
+	.string	"YAW_LO"
+.LASF1671:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1177:
+	.string	"USE_FRSKYOSD "
+.LASF1438:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF948:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1307:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1489:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1118:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2064:
+	.string	"disarm"
+.LASF1267:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1646:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1782:
+	.string	"THROTTLE_HIGH"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1201:
+	.string	"USE_SERIALRX_SUMH "
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2005:
+	.string	"OWNER_LED_STRIP"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1260:
+	.string	"USE_UART2 "
+.LASF1623:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1944:
+	.string	"BEEPER_ACTION_SUCCESS"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1505:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1584:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1340:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1931:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1934:
+	.string	"BEEPER_HARDWARE_FAILURE"
+.LASF1609:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1493:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1474:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1996:
+	.string	"OWNER_I2C"
+.LASF956:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1032:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2048:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1887:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1448:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1599:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1391:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF829:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2056:
+	.string	"batteryDisableProfileAutoswitch"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1261:
+	.string	"USE_UART3 "
+.LASF1387:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1857:
+	.string	"BOXOSDALT1"
+.LASF1858:
+	.string	"BOXOSDALT2"
+.LASF1859:
+	.string	"BOXOSDALT3"
+.LASF1470:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1320:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1498:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1128:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1594:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1416:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1345:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1208:
+	.string	"USE_RCDEVICE "
+.LASF1295:
+	.string	"USE_RCDEVICE"
+.LASF1560:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1395:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1938:
+	.string	"BEEPER_ARMING"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1283:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1380:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2107:
+	.string	"rcStickPositions"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1686:
+	.string	"unsigned int"
+.LASF2041:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1262:
+	.string	"USE_UART4 "
+.LASF1447:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF821:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1486:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2092:
+	.string	"calculateRollPitchCenterStatus"
+.LASF1091:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1549:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1539:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1009:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f "
+.LASF747:
+	.string	"__DECL_SIMD_sincos "
+.LASF959:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1196:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1680:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF1353:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1989:
+	.string	"OWNER_ADC"
+.LASF1691:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1807:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1198:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF890:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF773:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1263:
+	.string	"USE_UART5 "
+.LASF767:
+	.string	"__DECL_SIMD_exp "
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2089:
+	.string	"stickPos"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2027:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF979:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1279:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1332:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1657:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF1554:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF844:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1515:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1608:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF1005:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1933:
+	.string	"BEEPER_RUNTIME_CALIBRATION_DONE"
+.LASF1230:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1342:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1789:
+	.string	"rollPitchStatus_e"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1106:
+	.string	"M_E 2.7182818284590452354"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF762:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1268:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1264:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1460:
+	.string	"PG_GPS_CONFIG 30"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1514:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2199:
+	.string	"rx_pwm.h"
+.LASF2177:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2130:
+	.string	"/usr/include"
+.LASF2183:
+	.string	"mathcalls-helper-functions.h"
+.LASF2179:
+	.string	"floatn-common.h"
+.LASF2157:
+	.string	"stdint.h"
+.LASF2111:
+	.string	"src/main/build"
+.LASF2127:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2207:
+	.string	"barometer.h"
+.LASF2156:
+	.string	"stdbool.h"
+.LASF2136:
+	.string	"time.h"
+.LASF2161:
+	.string	"wordsize.h"
+.LASF2208:
+	.string	"bus.h"
+.LASF2151:
+	.string	"navigation.h"
+.LASF2123:
+	.string	"src/main/target/SITL"
+.LASF2184:
+	.string	"mathcalls.h"
+.LASF2139:
+	.string	"fc_core.h"
+.LASF2189:
+	.string	"common_post.h"
+.LASF2158:
+	.string	"libc-header-start.h"
+.LASF2153:
+	.string	"failsafe.h"
+.LASF2185:
+	.string	"platform.h"
+.LASF2131:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2115:
+	.string	"src/main/drivers/barometer"
+.LASF2193:
+	.string	"blackbox_fielddefs.h"
+.LASF2192:
+	.string	"blackbox.h"
+.LASF2146:
+	.string	"resource.h"
+.LASF2118:
+	.string	"src/main/flight"
+.LASF2190:
+	.string	"debug.h"
+.LASF2155:
+	.string	"stdc-predef.h"
+.LASF2214:
+	.string	"accgyro.h"
+.LASF2206:
+	.string	"vector.h"
+.LASF2175:
+	.string	"math.h"
+.LASF2126:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2205:
+	.string	"filter.h"
+.LASF2159:
+	.string	"features.h"
+.LASF2125:
+	.string	"src/main"
+.LASF2119:
+	.string	"src/main/io"
+.LASF2176:
+	.string	"math-vector.h"
+.LASF2113:
+	.string	"src/main/config"
+.LASF2160:
+	.string	"features-time64.h"
+.LASF2174:
+	.string	"strings.h"
+.LASF2154:
+	.string	"feature.h"
+.LASF2114:
+	.string	"src/main/drivers/accgyro"
+.LASF2144:
+	.string	"beeper.h"
+.LASF2142:
+	.string	"runtime_config.h"
+.LASF2138:
+	.string	"config.h"
+.LASF2181:
+	.string	"fp-logb.h"
+.LASF2152:
+	.string	"gyro.h"
+.LASF2168:
+	.string	"time64.h"
+.LASF2170:
+	.string	"string.h"
+.LASF2187:
+	.string	"target.h"
+.LASF2211:
+	.string	"bus_spi.h"
+.LASF2195:
+	.string	"maths.h"
+.LASF2197:
+	.string	"parameter_group_ids.h"
+.LASF2169:
+	.string	"wchar.h"
+.LASF2162:
+	.string	"timesize.h"
+.LASF2112:
+	.string	"src/main/common"
+.LASF2145:
+	.string	"rx.h"
+.LASF2129:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2210:
+	.string	"rcc_types.h"
+.LASF2200:
+	.string	"stats.h"
+.LASF2204:
+	.string	"gps.h"
+.LASF2149:
+	.string	"acceleration.h"
+.LASF2171:
+	.string	"stddef.h"
+.LASF2182:
+	.string	"fp-fast.h"
+.LASF2117:
+	.string	"src/main/fc"
+.LASF2178:
+	.string	"floatn.h"
+.LASF2209:
+	.string	"bus_i2c.h"
+.LASF2186:
+	.string	"common.h"
+.LASF2166:
+	.string	"stubs-64.h"
+.LASF2165:
+	.string	"stubs.h"
+.LASF2135:
+	.string	"parameter_group.h"
+.LASF2201:
+	.string	"controlrate_profile.h"
+.LASF2143:
+	.string	"pid.h"
+.LASF2215:
+	.string	"exti.h"
+.LASF2147:
+	.string	"sensors.h"
+.LASF2141:
+	.string	"rc_modes.h"
+.LASF2134:
+	.string	"stdint-uintn.h"
+.LASF2163:
+	.string	"cdefs.h"
+.LASF2148:
+	.string	"rc_controls.c"
+.LASF2120:
+	.string	"src/main/navigation"
+.LASF2137:
+	.string	"adc.h"
+.LASF2164:
+	.string	"long-double.h"
+.LASF2140:
+	.string	"rc_controls.h"
+.LASF2150:
+	.string	"battery.h"
+.LASF0:
+	.string	"./src/main/fc/rc_controls.c"
+.LASF2180:
+	.string	"flt-eval-method.h"
+.LASF2121:
+	.string	"src/main/rx"
+.LASF2167:
+	.string	"typesizes.h"
+.LASF2110:
+	.string	"src/main/blackbox"
+.LASF2213:
+	.string	"sensor.h"
+.LASF2188:
+	.string	"sanity_check.h"
+.LASF2172:
+	.string	"locale_t.h"
+.LASF2124:
+	.string	"src/main/target"
+.LASF2194:
+	.string	"axis.h"
+.LASF2116:
+	.string	"src/main/drivers"
+.LASF2203:
+	.string	"bitarray.h"
+.LASF2196:
+	.string	"utils.h"
+.LASF2191:
+	.string	"build_config.h"
+.LASF2212:
+	.string	"dma.h"
+.LASF2122:
+	.string	"src/main/sensors"
+.LASF2133:
+	.string	"stdint-intn.h"
+.LASF2173:
+	.string	"__locale_t.h"
+.LASF2132:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2202:
+	.string	"rc_curves.h"
+.LASF2198:
+	.string	"io_types.h"
+.LASF2128:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`k"
+	.string	"\235\006"
+	.string	"T\t_\001"
+	.string	"\027"
+	.string	"\264\206\300\253\n\022\002"
+	.string	"\002\001\240\342\234\212\n\003\273\370\256\300\003\004\002\003\002\004\005\303\213\356\346\n\006\005\002\006\007\230\207\326\342"
+	.string	"\002\006\b\263\276\237\323\006"
+	.string	"\t\345\322\317\302\r\002\n\367\252\372&\b\002\007\002\007\002\005\002\007\002\007\002\007\013\246\273\327w:\002\b\002\b\002\005\002\005\t"
+	.string	"\002\t\005\f\r\016\352\263\360\321\b\020\021\023\252\240\276\313\b"
+	.string	"\024\337\265\223\231\t\025\332\355\272\322\002\026\027\316\274\261\243\n\030\272\377\332\221\002\031\240\342\234\212\n"
+	.string	"\033"
+	.ascii	"x\n\247\334}i\226\222\363\231\213\001Yr ,\305\301\315\032\020"
+	.ascii	"\340gq3e\274<\260\"\006\004\002\242\306C\231!\f\220\312\263\261"
+	.ascii	"\025i\340\026gcwR X\273K5\340\006"
+	.text
+	.section	.gnu.lto_.ipa_sra.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \233M\002"
+	.string	"D\002\217"
+	.string	"\t"
+	.string	""
+	.string	"\001"
+	.string	"\003\003\005"
+	.string	"\003\007\001\003\b"
+	.string	""
+	.string	"\t"
+	.string	"\003\n\001\003\013\001"
+	.string	"\023\003\001\001"
+	.string	""
+	.string	""
+	.string	"\002"
+	.string	"\017"
+	.ascii	"+\002w\222\210\212@\013\201}\200\027\006\310\375Ui\f\226\261"
+	.ascii	"\274\023\n\0310X\263\025\240\353\r`\001"
+	.text
+	.section	.gnu.lto_.inline.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\f\002u\n"
+	.ascii	"\002\31724Pm\222\016p\3630\260\206\255\273h\300\262\355\203\025"
+	.ascii	"\260s\355,\020\332>\032\016\207\r\277\225\277\365\337\257\252"
+	.ascii	"\317\034lf\306\366\370FK\267\255\265\335b#r\247o\341^\213\343"
+	.ascii	"\270\225\313Lk\202qB\013\207\330\354\204\202L\210\200*\023\214"
+	.ascii	"\212\016\374x?\266\201X5\031\n\353&\363F!\035\022j\214a:\342"
+	.ascii	"\204\272J\3578\241N\340k\241\325\236\265\326\023\322\247\264"
+	.ascii	"u$C\344)\270\232\252+\205zHPxz\266\326\351\201\372K/J\034%\225"
+	.ascii	"\351\277\212\037\274\272\371G\007\352\252\3467b*\212\350:\006"
+	.ascii	"\007\2002s\300\"3)\0030\274\254\217\027l\304\237\362\376{\265"
+	.ascii	"ffR\277=\222\314D\350cC!2\363\340\255\337\0018 `\2423\204\267"
+	.ascii	"\001\274Reir-\207\3356\227s\013\032t\377\354x*`\305\300\260o"
+	.ascii	"5\305\275\3200\001\r\306\0208\002\250\027\270\020\001|gU\013"
+	.ascii	"\261\004&\305uc\027\002\032\303\255\r5\353\312Q;\303\352\276"
+	.ascii	"\321<\315\207\205N\360\\\t\314\001D\027\35484\235C n\312\030"
+	.ascii	"[\003a\271\345\356\215uy\203\232k\tI4\320Y\271\376\235\207}\002"
+	.ascii	"\261\2132}\221\005\2333\352\202\273\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\247\001\005\b"
+	.string	"\022\n!(p'J\007\374\377\377U\211!\032\255\003;T%WU\304FUi\273\377\377\377\037*\344\371_\r\265\357\216\261\033!;\311\255\362\336{\210@\373\262,1\314P\3244C\211\004q\224\310\360\013'\273DN\332\332\n\2370\356dw\022g\305\351B\030\247i\3406$\266\343P\214\266\330\352!\240:x\250\207ZJD\003\240%\022$`\317\016\355.\255\337\345\006#\356\362\352\333\305n\327e\273Dl[\024\013\002A\250\301p\007\251\026\252u\003\300\002\221+\362\021`X\255\320\bIQ\261\034j\254)\303Mi\221\207\341\262\fJxm\354\210\320\3041\300\013$\030\365\034a\002D+r\253w\215&\245\320\007Q%!\372\203R\343ILr\220\327\340\217\374-"
+	.ascii	"R\027\355\004\367Uu>P\364\031\332\331\300\220~FcFS\321R\325@"
+	.ascii	"h\221\310c,\222\323S\274G\326g\321S\240\217)\003"
+	.text
+	.section	.gnu.lto_.pureconst.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\003\204\004\005\204\004\007\230\004\b\230\004\t\204"
+	.ascii	"\004\n\204\004\013\230\004\023\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \276U\003"
+	.string	"\304\003\262"
+	.string	"\t"
+	.string	"\001\002\022"
+	.string	"\001\002\023\001"
+	.string	""
+	.string	"\001\002\017\001"
+	.string	""
+	.string	""
+	.string	"\003\001\300\007\024"
+	.string	"\001\002\025"
+	.string	""
+	.string	"\005\002\002\026\007\001\374\003\002\026"
+	.string	""
+	.string	""
+	.string	"\b"
+	.string	""
+	.string	"\n\013\001\274\006"
+	.string	""
+	.string	"\001"
+	.string	"\023"
+	.string	""
+	.string	"\022"
+	.ascii	"@\020Q\206\3017&\264HfE\003\330()C\r\"<\020\020k*\270\234\243"
+	.ascii	"\325$\201\022\243f\350\237\307\355\354\003\2137\200\005"
+	.text
+	.section	.gnu.lto_.lto.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_rcControlsConfig_Registry.81.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \227e\004"
+	.string	"\344\007a"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\314\361\021\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\316\007us\344\006uq"
+	.string	"\005\001\006'\001\n\231 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_rcControlsConfig.83.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 M\005\002"
+	.string	"\024\003@"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\224\n\005\001\006\035\0012\n\005?\202\210\2008\177}\300\001{\300\001y\277\001w\276\001u\275\001s\274\001q\273\001"
+	.string	"\005"
+	.ascii	"@H\312\300\313\2750G\032@\021"
+	.text
+	.section	.gnu.lto_armingConfig_Registry.87.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007b"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\206\200\200\374\342\203\326\261\027\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\346\006us\376\005uq"
+	.string	"\005\001\006'\001\004\220\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/fc/rc_controls.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_armingConfig.89.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 /e\001"
+	.string	"4\002\""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\372\001\005\001\006\035\001"
+	.string	"?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\002"
+	.ascii	")#\r\240\b"
+	.text
+	.section	.gnu.lto_areSticksInApModePosition.90.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\351\001\315\020"
+	.string	"F!sF\360\320&\035\252\255]\217\263\240\263\375\341\222\004\205\227U\231\366\333\260\320\214\177\230\332\214^{\377\0243h\023)\3709\224\215\226\217\221\244\353\370\370\350\267\2604\311k\035\363\267\332\353\214c,nAa\204\220M\244L)_"
+	.string	"["
+	.string	"^"
+	.ascii	"\337\371\210\226\363Xp\334\275y\001\264\353\0221\b\367\350q\001"
+	.ascii	"\332c>\200\366h\333\t\024\264\330\345.\0206\367\2603\363cc\327"
+	.ascii	"\345\351\207\273<f\232.\376fr\202\201\303\021M\353\345q\303\263"
+	.ascii	"\256%\223\332\321\212\311>v\367=\317\232\026L\346f\262\273N\232"
+	.ascii	"V\206[\273m\b\266\037\330y k\315\261\235\346\016\273\267\363"
+	.ascii	"\374\332_w\324\264\306t\306\364\001h9b\020\240\261k\023K\332"
+	.ascii	"\241\030$\342\260\377\365R\322\217\273\022\016\330\352\203\345"
+	.ascii	"\26112E@\016\270\307R\221\311w\371>\356JF&\373\265\342\026\210"
+	.ascii	"\353 \203\307hwA\036\335\200{L\273\305\356\354\322\220I\323\016"
+	.ascii	"\357\\\210\\\305JK\244\3304k\020\005\375\347'B\317\335}Q\325"
+	.ascii	"\261\246\327\367\374\032pH\300\210I$5\260\342\002\222&\024\365"
+	.ascii	"\257\377\350\206e\207\034\305\352,f\354n\211o\342'@?\304\243"
+	.ascii	"+\204y\232G?\324\036\2432 \nbe\314\367y\026\353p6o\330\256\227"
+	.ascii	"T\035\373\331\356\006$a\nu\212\b\302\024\352\024]b\"I}\337\227"
+	.ascii	"\032\031\200\022\001L9\255\2406\177#!\005P\305\242\002~\247O"
+	.ascii	"\345}\022<\225\t\250\024\357S\205\336H\001\203+(*\217\005\004"
+	.ascii	"U^\347\332g\2539\316\f\344\251!W\255\261\315\351\007Ka\254\312"
+	.ascii	"\351gr\2602\246E\325\3114\323\234\3344uA\213\216\236M\017\013"
+	.ascii	"  \320\"\232\2639\242pP\270C/F\n\257\300\"q\205!\273O9\270k\220"
+	.ascii	"Zq\361\244hYm\331\200\225km\265\3543\262ZR\2214 v\350\312\302"
+	.ascii	"Nt\r\370\320\032\004*\263\353&Fw\310;\205+\270\267]B\017"
+	.text
+	.section	.gnu.lto_areSticksDeflectedMoreThanPosHoldDeadband.91.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\027\002\275\021"
+	.string	"\326\241uG\360\320&\035\362'zL\223\t\310\r\365S\n\370\363\311\332b\237\227\341>q'\264\013\321\350\330\206N\272m\"\230/C\254pV\245\215\237\271\211X-\236\243\363;\034r^O\\\375B\233\222\005B\215H\333D\312\224\002b"
+	.string	"["
+	.string	"d"
+	.string	"\027\2429l\305\355\021\347\241U\204cwI\036M\302=\206\234\300\007\230\036\323\246\261;\243$\240q\315c>:\007At3\224c7\346i\210\327<j\2325\376\266\302\202\241C\022\316\313\346\221\323p\315B\367r\245\202\274Z\332\310\356>\350\231\363ren+\273\353\304ye\270M\267\375\300\266\003;S\001~\354\361\325\355l\356\260c\255\324\036\373\332\356\256\225\307v\272\213\351\217\313\356SLs\207\335[LGMk1\255Z:5}"
+	.string	"\033\207\032\"0vu\226x,\215\210$\342\262\037\366\264\217\232\315\334\241N\310V#\254\220u\335"
+	.string	"\0355\340\036Q#N\374\022~\314\035\212\304\311M\0046\214N\252/~\220fgI\312\334]\033\325\036s\252Z`g&\303\225JNU\373\345E\021\270]\227\002\237\350*`$\304\304\350\203.\300\350\206\220r\372\233\036\254\\\322\003..(\231\2226=\354\327\361\201e\227<\305\352,|vW\305\037:\n\320\007zt\2050\217\363\350\207\246\307M\027\374 \261r))a\312\245%Z%\345$\365}_\312\304"
+	.ascii	"J\230ri\211\376L\302\t\240jF\006\374Z>\225\367A\360d`\\b\274"
+	.ascii	"O\025z&\"\006)\274\250\274\031\020Ty]\214u\345q*\311S+y\324\034"
+	.ascii	"\333\235\216\260\264\345\250\235)j\217\177\325\224\347C\365\033"
+	.ascii	"4\3758\251\246\ff\004hq\322\313\016\022\003\301W\2544) \220\002"
+	.ascii	"\2511\355\200\036\\\0200\360\341\332\363\215\262\214c\f\366\006"
+	.ascii	"\017\213\177\362\220\224\006w\r\244P\334]\262\230\nM\\#q\340"
+	.ascii	"\f\365\237\200F\0131\305M\306\273\350c\2576Z8\221\034\032\026"
+	.ascii	"0\276g\331a\032\017\323\301d\320\326r\250Q\201Fp\261\2540\262"
+	.ascii	"\226\254oo\023\236\036"
+	.text
+	.section	.gnu.lto_calculateThrottleStatus.92.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\364\003\355\033"
+	.string	"V\263\264J\260XQ:@\363\202<\202\317\340\310\345\tr@\267w\033\2055\214\""
+	.string	"\212\226?\203\2511=\033\204\272\233[\\\351\322\225K\227Z\232\215\257Q \337(=\361\271\251i<\021\200\360\323-\274\264\27627\022#m\023\"e\222\001\237"
+	.string	"\226"
+	.string	"\241"
+	.ascii	"D\270(S\265\372\026|\334\t\344\307\001\374\026\235\t\262a>S\211"
+	.ascii	"]\325\032\343t\252\325\307`\027\220\037ww\277t @k\023}I\274\022"
+	.ascii	"\210D\027\324R\253\317Es\031\372Q|\213~l\032\267\335,W\244\212"
+	.ascii	"\216b\263m\037t\323\250T\332\031\005\217@j\367\202W\277\031\235"
+	.ascii	"\024\025\034\rU\310L\221q\345J\273\026\254\242\251\265\232<\035"
+	.ascii	"S\251\235\013!\036W\\,y+\336\242\202)%Y\002\360r\242LQ\216\241"
+	.ascii	"\007\317D<\034\263\352\246\326\272<\304K\361e}w\213\354nl\267"
+	.ascii	"\227\002\272/7>\267\344~\002\272\3133\343\017\2751 \345:hY\302"
+	.ascii	"\036O\3322\345\324%\250\200\206\001\251\344x\313\252\224\036"
+	.ascii	"|)\344!U\231\313\256\017\307\335\333}\237\347yn\317\330\375\357"
+	.ascii	"\033\323\2029\323/`yYo\372\232\224\267T\361\256F^\025\345\245"
+	.ascii	"\224w\244"
+	.string	"\274\342\310\333\"/\213\274/\240\032N1p\326Ztv\251R\306'\035\377\375M\347]\240=\360\3015gP\330\3546-\024\031\264#\211\310\210\232\252\265z ?\316\260\260\361}\b\320\177?du\"\003Q\314'b\323\236\t\n\035\341\370\344\033?a\224\252{f\217\315X\200C\261\315\341\027\212\216}\241\0358>7\246\305\246\303#\341i\3676\002\021\021\246M,\345\350V\233M4\202v\303\200Ur\274e\t0M}\006\272\253a\003\177\250\333\001\013\225\304\364\177\337\200t[\016w\372\221\220Tk\356\301\036\311\223t\300y\275\350\307\230&P\203\351\306\247\020\263on#\f7L\315\217\304\310Z+\204}\221\033\221\355q|\\\020:\343^\247\017\324xb\t\1770\223\023E;\304V\277\3514\267n\365\275\004\262\021;/\022cN\317\013\226\363\222\345\340\310vj\265\031-D\r'G\207Gf!8h"
+	.string	"\213\305b\260\232\0022\237\237\232\270\261\032\021;3Z\255g\026\303\211\321\\\261\017\256\036\235\027\217+F\023\341\2521\2603\037\031\315U\233\315h.\323w\273X{\306r\371\341}\202@Y\3756\372\340WHA\216\310\275\215\262\232hwY\2757\267\306\211\265\354\266\001\204\262\352\262O\341N~\310\2507\251`\341\302\005\372q\325?\"ee(Uvo\311UM\342OW\265\004"
+	.ascii	":\250 \223\037M\253\356\375:\037M`\220\264\003|\001\006K\250"
+	.ascii	"a\034F\221B\f\311\0043\023D\322$9\200\242\031;\363\020P\3116"
+	.ascii	"\032\016?\243\003\376\202>(\253q~f9a\263\202\202\n}g\021\316"
+	.ascii	"47#\370\027\r\207\300\026\021b\013\035\336\205\301\264\001\251"
+	.ascii	"BC\325\255\246\221\3031\b\020\334\301\311J\365\233\240sRt\336"
+	.ascii	"e\366Tk{\365n@h~(\211\275\001&\276;'\241\330\260B\204\002\232"
+	.ascii	"Ev\302\315\310\224\276\371fc\001iL|\025\227o\313Xa\355g'\241"
+	.ascii	"!\302UyU\203\023A\236s\022\214\220;|zg\234\001k2\270\303A\323"
+	.ascii	"\177D\256a\326\037"
+	.text
+	.section	.gnu.lto_calculateRollPitchCenterStatus.93.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`>\001M\r"
+	.string	"FXXC"
+	.string	"s\233\0163\343L\306\230\002\231A\302\222\370\007\355lP\347@"
+	.string	"\r\213aT\t\375\261\024e\253z\036\276S\230\314`r\204t\335|@UU\025\240V\tK|{\255`t\204m2\370m\357-eJ\001E"
+	.string	"C"
+	.string	"D"
+	.string	"\021\236\200|\\\020\327>\311\bW5\177\373\0049\034^dX\361P\203\342@*-h\304l8\244\270\n\272\220\323\302\"\207"
+	.string	"\356\0037'!B\037]M\270\022\325\td\316i\rq\030n\314mO\333\034\373\027\002\031\0248fL\345a\177\233ng\037\3169\2477\305\266:\252\032\252zU\255\252\276f\362\261b@\305\234'?z\314Rl!\3026\211M\371#N\202\304\032\374T\270\f\r\027\320\t\2279\277\352\3007\362\001\337w#xw\003\322Q\362\224l\210\342v\337\0352:pp;S\244gR7"
+	.string	"\013)\206w]\351\335\337\366\253\274\264\254\330\355\250\033\317\344w\001\t\306G_\034\365G m\t\023\364\241\257\007\345\263\233?z\266:\331\203\013\033\t\271\254\004\026VY\r\252\020\007\n T\026\226U\235\002\276D\030`\325\310ua\025\365\315o\212E<\026\350k\362\243\003@\361R\310_\223qMl\3075\b\205-\231J\034\256\346\203\t\270\322\305"
+	.string	"\221\006\221\f\034"
+	.string	"A\b\270R\307\247\315\276U\221\002\345\002\321\035\016"
+	.ascii	"S\253,Pe\025\b\323c\001\017[D\330\256\031C\300\372\2532\306*"
+	.ascii	"\211\253\366\303\017\r\236\013\341\314\030\001\274\3014(\007"
+	.ascii	"-\007iT5\220\252cB\001"
+	.text
+	.section	.gnu.lto_getRcStickPositions.94.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \375\365\006"
+	.string	"r\r14`m\322\001"
+	.string	"\255 \324LF\030\213)\351x\264%\332No\350\n\037\302\264\206z\207\263\027b\336\376\270\020"
+	.string	"\300\b\304.\315\275\220zV\271Bd\023)S\nv\030\215\303\203\233\314s\t\0166\307\3202\r\n\017\315AM\303\020\370A,\300\266y\017\266*\356U\224z\371\250\204\375\221G\313\347p\004'\177\235\371\034\352,5`#\364\311\222+\214M\025;zR3\354O\253\"\333\351TK\b\305\240d\267\242\264\262'\214\244\303\276H\307\256\374\217\203tlMq\004\262\220(&H)\273\261]>@\235M\027\240\316T\343\326\323\362\037\362\311cdr\201<O"
+	.string	"\204\335u^ \213[o\273\300\366\201\355\213\b"
+	.ascii	"2\001\0038\003\\\034\240k8n\210!3\342p\247M\355$\003"
+	.text
+	.section	.gnu.lto_checkStickPosition.95.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\233\002\235\025"
+	.string	"\006\352\220I\320TQ:\340\020\006\344\231\305%\375O\030\245\371\230k\337\202,Hz9\246\023\212&d{\023\303\255\fh\333\337\210x\t\013(\2109X\316x\002\004\332\f\240\032BL\232z\331\314\230a"
+	.string	")\027-\341\202\020\262\267\334)\005~"
+	.string	"v"
+	.string	"x"
+	.string	"\237q\0329\257\201c"
+	.string	"\265\002\361\300Q\353\210\300%\360\364\344&\336\351\274"
+	.string	"\357t\001\203\034\253>\252\370\360\240\036\227\315H\255\243iSx~\216\267'U\377<:W\252\374\325\2779\322\305D\224\274\\S\345'\247\343y\265\244\367\302\347t6\240!Chg\267\035\341\313%g\311\253\303<\251\265\206/\035\271\257]\016\345hAp/\237\313\257\245\326j\271\363\nq\203\267\035\302\366\005[\242\b\037o\"\004\004K\356|\331]\\"
+	.string	"\251\262\310\036Wr\203\354\273H\216]\365\236\260G\257\361\207\226\006O\273?*\355Qi\352IO*\275TZN\351\227X\250F\212\240\354j\375\260CR\177\320\241\026\247\375\343I\262\025\177\346\327\034\222f4\353"
+	.string	"W \300\233\355\207\002xz;\307\2279$\305X\261\307\033\260\272"
+	.ascii	"qD0\"\265\326\322\251%\200\244\025+R\332\001\264\237\034\370"
+	.ascii	"\267\243\275\007\022$\\Ln\317\212\325\212\376vo\245\216\256\\"
+	.ascii	"o\037\356\\\272w\371\264n\3438\034\237\205gN\362;\247\376\311"
+	.ascii	";\235{\233\020\214%w\177N\027\203\315\243x\273(\332\020\035y"
+	.ascii	"\304\341\312\335]\233\013\326\222;\177\345\336\225\304v\315e"
+	.ascii	"\034\300ZuX\276\005\204\206F8\030\373\223\323\275X\227~\332\035"
+	.ascii	"\230`\311\"\277\366\t\003H\342b7\262\202\201c\202\321\316\230"
+	.ascii	"\313\244^f\246YT\024\300\210\242\b\2232 u\232 #\306\330\244@"
+	.ascii	"\213)\251\r'\224\r\315I\304 \242L\242\006\023M\314\313\214ID"
+	.ascii	"\245L)\004|\252\311\2002\331\234N(S8\326\357\211\bD%n7\274_\345"
+	.ascii	"\275v\027\242\021\267\033\323Wy \270nam\3137\263V\240\007\037"
+	.ascii	"\177\331\003\020\231\311\335\267A\376z\320\321\356\020Y\372\267"
+	.ascii	"<\363\326\341}\013\301\307\267-,Y4k\255\325\033\355\003. `\002"
+	.ascii	"!e\330\003\263>x$`\2053\220\\\214\364..\266\005\266\350\325\026"
+	.ascii	"\232h\020\301D\t\202+\nv\371\262\307f\207\376\275^\005g8\260"
+	.ascii	"\351\032\204M\361\214\272\032 \353\361\242\261\n\206A\025\007"
+	.ascii	"\"\f\341\336\276\2303\300\303\330M\206\3774\210\003\t\317d\007"
+	.ascii	"\023z\367p\231\024Q\013N\024\004\331W\210du\310\313\375Wk\236"
+	.text
+	.section	.gnu.lto_updateRcStickPositions.96.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\302\007\205!"
+	.string	"\266\275\320G\240\230\316p@\023\035\250\3064\361\001\367\016\365\003c\230yrN\344\366X\354\316~?\240\240\030\255\313\361\352P\\\356\316|\022\216\207o\201\335\312=\304^%\346\376\260k\006R\177(\3514\021Zj\"d\357\235\244L\001\300"
+	.string	"\237"
+	.string	"\301"
+	.ascii	"_\337\304\265\355\353\332\256\311q=~-\212\353\177\275\273\326"
+	.ascii	"\002\2711'IL\316SC\232\230\263\311(\004\206\236\251\326p\356"
+	.ascii	"',\2503\224F\226\236a\331\264\302l=r\270\300r\236h\246\2166m"
+	.ascii	":\372\324\206\324QT\032RGg\331W\024m\305YC\301\302+\207\227\363"
+	.ascii	"<\203W\241Y\332\343\355te\016w\263\325\310Q\374fYk\302\333\227"
+	.ascii	"\230\226\366V(\257\304\212\335\221P\335\b\022[\212\320\\\b\021"
+	.ascii	"\213\003\241\267'a\037@\254-\350\304\0062\255y\005\305\b#[rL"
+	.ascii	"\307\013\030V\344\240\337\211q\211\276\363<\265\206.\230X\327"
+	.ascii	"nMx\236\247\367Kl\203ZFm\035\262m\300\256!\b\n\201\324\361\027"
+	.ascii	"`v\246\337\253\327\230\255M\363m\255?\322\256\252\260\372\245"
+	.ascii	"'`\242\353Z^\036J\024\213\3243M`bk\303xy\034yrn\030\033\215k"
+	.ascii	"\217\302V\361|\231-\224\212\202zr\3223u\323\327L_\007\277\006"
+	.ascii	"~\275\364\265\322\327\346\327I\343\032\351\353\237\270>\372\332"
+	.ascii	"h\327"
+	.string	"E\343\232\350\353!q-\364u\320\256}\343\032\350\353\037q\355\363u\317\256y\306\365\316\327:\342:\347k\234]\337\214k\233\257k\3045\315\3273\273\226\031\327\275\257y\342z\367\265n\327\345\270\316\221k\\\3379)\243\205\024\334\255fj\351\305\310\013RT\3229\316\313,9\327Ar$\347M7\307Y\375\2217_\236\234n\363'\245\333\334\034b\253\215\246N\215\2116\263\3463Ih^Cd\b\215\314g|\250\f\027\247\336\235\314\367N\316h\021\204\034_\346\275\251\345\226\"Wv\325E\310\244\203\361\256{\tfw^\020 \273\013\230R^\247?\262\324\322\344\313}|\323\365\207\027\007\334s\257\035w\035+^2\2706\315\266\337\024(\217\0356\3625\265\241$\223\361z\246\001\222>\212\342Q\354\236\347\251\365\227Y\374\276\354rcI\327\202\361/\332C\325\301\300v\236]NV\034\232\303\201\325\205\216~"
+	.string	"at~\n"
+	.string	"`\301p8\\"
+	.ascii	"\304\241 \341\352\036\002-D\250\262\272\232P5\244\032Z\005\207"
+	.ascii	"\r\202"
+	.string	"\023\036(\220\020\034ZY\b\002{\\E\201\201U\360\252\252\312*\230C\333R\361\344\231\252+;\222ag4u\021\222\351`\007<4\331:\227\205\267Z\321+XV\027N@EE\352\210cF\266=:\b\245\216t!\323\221\256t\243\307\323\231:\325\245\3243\370\273\321u)\216\376\2432\345\350\003\314\212n\364\244\250\207\230\024\321\245\202':)\244E\332N\2273\265\304bd\t\256\007\034z\320u)\204>\024\005\212\320\007\230\371\036t_Z\024\324\201\036\005<\320\315*e\356f\352\224\016\233o\351\347=/\263\370\374\207\311\022\2377\361\274\307\bO\030\250\235C-\005\200\240\2501`\342\315\330\214\024\224\244 )\264\006@\003\021M\325\001\020@T3\266M\007\266\231*\221,~Z\033\232S\242\222\373\257\222\213\246\234\357\332\311\260\3151\367\270\247\320\225\007,\320\34016\264_\243\fE\367\256\033\212tY"
+	.ascii	"\303\351\306\326N\330\324\273l(\262B\370\220\202qCk\325g(\274"
+	.ascii	"w\231\215.\205\254@T\027\214UR\312\\e\036xGy\277G$|\217H\033"
+	.ascii	"\244\004\220\364\376\261\210\224\247\361\3267\350i\305\211\023"
+	.ascii	"g;I!]F\320a\347Ri4\315\321\224\207?\216\031\007\312)\023\020"
+	.ascii	"\t\234\243\226\342\232K\375\342\030D\326X\261\234\247[h[\247"
+	.ascii	"\230\266\237\231\3778\226\314\346o\210=\r\223\226\005\263\362"
+	.ascii	"\255\301W\230\177\032~RZ\374\320\257B\257\002\f\307\304*#O\232"
+	.ascii	"9\210+\273)\221\336\206\231\032"
+	.text
+	.section	.gnu.lto_processRcStickPositions.97.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\216\026e^"
+	.string	"*\222\320 O0\320J\032\016\207\363\206|\373\206HJo\376:6\344kB'\272\350\216\276\013\233\322NO\271\201\216\375\364\017\252[3"
+	.string	"f\345B\350\20247"
+	.string	"T\252\034\035#\001>\237;\3070\342\364k\230?\024\003\354\025Jzh\266\220\315\226\020)\223\f\006\002\313\001\375\001\037ck\261\367\262\177\333\241\361\213\233\007_^\371\362A\360_v\207\273\343^\366\027\215s\347\277=\f;v\207\377\375\376\302\331\336\266Cc\222.\036\004\277\226\3017\036d\356\260Zh\261\313\245\353(\326\\\313\\\264p'\203\340\177\306*-\246T$\337\374\340\370\325\\\311\246\236\334e\271\263\256\315\250\377\226\201\340\177\273GnZ\234w\237\345Z\222_\003a{\3265I\035\230um\232\330\250\340\177\307\023\245\377\371.\224\376\267\311]8o6Y\337\0067\326vg]W\251f\362\344\003X\241\"\005\325\024\n"
+	.string	"\244N\230(\021E\002j\204\210'\247&\246%\245c\022\222\361(\004\210\017\036\214\212\210\206\204\202\200~|\212Du(\354\t\002\323\237\2579\271\377z"
+	.string	"AV\370P1\f!EO\036\252\266C\275I\233\312\322\201\225c\2036)\n\264:"
+	.ascii	"\354\330\260T\335O\324\235a\023Pni%\312<\352`eN\002\370\302w"
+	.ascii	"\305\355K\026<(\246\373\210\n&\220\200\002\bR\241\234\nr\373"
+	.ascii	"\225.\025\021G\307O\320+E\227f\234\354\004\367&\031\316\364\006"
+	.ascii	"F\006^\202sc\245\030~\374\362\244-\316/\214\024\303\032\033S"
+	.ascii	"&vr\216|\002\300\255q\217.\265\370\200j{iW[f\341\020\217.\261"
+	.ascii	"\200\270\022\207?X\271\007+U\330\250H\211h\210\205"
+	.string	"\026X\350\311\333\n\034\244\002\003\241\361\217Zt\331\204}\234\034\341\"\360E\222\037ON<S[\032a\265E\0256Y\360\222\374\210\363\241\217\212\307\235\"\217.\255\370T<c5\\mI\204\205C\270\347jK!\034\364\221\270\013\243\303\243\313\">\"2'\312\267]Im\031\204\201\3022 O\201\374\307\203}\305\2621\337q]\327a\231\030\267\217\304Y\031\263bY\017\037Q\032%8\274\355,BY\0303\360\305\272\256\313\312\262\037_\001\276\353\373\331\335\345nP4=+\036\024\261\376\332\237:6xs\336\370\240\331\211\002\233\251\225\2669jRG\016\207\311!\r\n\351\257\331\\9\347\327\255\327\343,\214\316\206\241\267\271(.0\214\371\t=F\352\353'a;\323=\325\276~\017(a\274\267\3734\217\306\310:\340\200\364\277\356\246\342\233\334\316\361 \203\342k\346\036\357Z)7\222\315\214\231\237\321\302B"
+	.string	"\201\364?n$4\365\r\032\275\023\345\031\232nf\343`\263\023c<\273\247\341d\2726\220!#\375\357\355c\307oa\n\350s\371\333\336S\205\314\035\336\335~\356ch\354YX\005\026\340+\027H\377+\240\213hA\300xo\377\345B7 \321\225\363z\232\204Y\342\321Y3\342]\033\016\360\225{\3447,S\375.?\202q\336\016\361n\004\023\360\225S}!H\302\372k\207S\\P\033B\211\276\355\r\320\335\341\315Y9o\267\031v\337\332\314\335\373\326^\262\373\270o\r\032\207\373\316"
+	.string	"\342-\340n_\030_\373]\274\371e\361.\337\251\037\336\247\037^'\225\267I\345eRy\227T^\245\"\357\221\310\233T\344E\"\362\032U\336#\346\r\241\362\202Py?\250\274\036T^#\"o\021\363\022\021y\207\376\374\n\251\274A>\274@*\357\017\363\3720o\221y\211*\257\252\362\016\211\274B\346\355Qy\203*/\260\310\233\022y\177*\257O\345m\"/\253\274\277Q\202\315Y\021\246\263oh\256d{yV4\277\347\223?\377\270\037\356w\373\233\177\227\017Y\310=\034d\341\356\215:@wh\264\363\324\n\256P\200nh$\334\221\331"
+	.string	"f\207\3066H[\356\262T1\212q\356\320H\007\267\365\300\226f \320@4\2210.O\251\231\313I\304[\2202\222z\013R\247\026a\367\005;}%\303|\307fr1\016\223\274\244^\262[\351\214\216\021GgF\037\216\307\214\006\202\301\203r\347\357#N\216\361L\234\035$<\216\253\373\017;T\254\030}\236cj\\\030\241!h$\034\315\275+\375\300G\2726\370\320D[\236B\031\032/!<\260\330\215\332\203\021\2436:\222W\306\r\033\210\241k\245E<\244\250\217\320\342\200\264\035+s=>\374\304\366j\360@\324H#\242\036"
+	.string	"\211\352\324\213c\324\3146kj\243#Ei\306\254h"
+	.string	"\366=)\302\bI\262#'\335\335\230(\221\336]t\317\371\3474]\030\312\363\241~\264\214\227I&\331P\213\260[+r\316\331\335\311#\324\314\205\321A}5\2662@\035T\002\217\2204\201}"
+	.string	"u\n\273\265!\247\034\214\276\333OO5\214\366\265\365\200\242\374i\002\320\202\274\375fN\350\017*\307N\220O\027\247"
+	.string	"\361i`\224\0362Q\003\007\250\330\352\034*\"I#|e\261\323-\274\244\204H\221\037b\363\232%\016\"\366\261\334"
+	.string	"\307\315\214O3\367u\256\366\223\370\336\225\016[\345\260#2\206\235\004\346\312\2318e\221\n\2571\256\016@BsJ9\02101j\210\315\264s\026QZ.\215\2227jqH\022\205\242SH\320K\023\275!\b\251\213F\252Na3\367If*lU\005%\317K2\203\353*\266\002O\222\311\236\205\3776\211\226\\!\271B\372\237\260/g\267\006\306{b\264Ti\322\323\314\375\007iO\263\023(\376y\327\223d\032_\331\3237\202D\254\277\376&x\356\300\004\273\322`\343`k\023\\\327w\245\300\016\366\307\202\314IF\001v\221\335\017'N{7I%i\205E\247\375\261\035\366\242,\372\315\037\227x\237\324\222\356&\267\300\340+YtW\337\332\262\252\252\332\261\005\354\272\221\303\312"
+	.string	",\344\215\255\253\013\206[\nXa]5\300\245\303\n\211\334QE\344"
+	.string	"\253\001\256\255\237U\007W\\U0\266dhP\305u\345\201\215\ft\\a!o\f\255"
+	.string	"T(pTUU\3418a\264\265\203\353\006\227\r\253\034\\\\YH\r\270\212[ub+G\026\222KGV\225\005UH\251*\f\244t\\\335\300\222\252BnI\2358\332,\016\254\220R\\YYH\251a\023\354\276\265\303\226\303\004\220V\347\f\207\"eV\b\221StB\324\371\206\007\314\352T\314P\326\346pv\340<3\244\300\023\262\235\220\016\t\260\327W.\215\372\256\227\235\227\033\036m\267Q'\272\322}_|Q\251P2Mm\003S7\365\307\314X\rS\027\331\371\200\322EW\250:E\212\232)4\313i\326\314,\237\321B\3032\031,s\313cNE\314\262\334\231<\227\030:\267n^\270@Q\b\255y\275\201j\351\251K!\016"
+	.ascii	"\007\362\256t\311\271\004\305\"\345\025\007\032\005h\fN\331\211"
+	.ascii	"\031\336\225*\271)A\323\322V\f\323\216\315\004\t\356\362\215"
+	.ascii	"\342\266\2579\r!39^t\204\226\307\034\222\372\310\\N\243\223:"
+	.ascii	"}\263\227\345\270\206\026\245\304\226(+$|#\372Z\351\241\017\352"
+	.ascii	"\225p\366\3645_\237\b\016z\032\300H\275\353\205\347\225gl\244"
+	.ascii	"\376\233\261\035\366\256\225\n\265\261\1779\220\360\f\023]\237"
+	.ascii	"g\316[\216\202T\302\222\027\240\2329\345g\275\375\205mFX3\242"
+	.ascii	"\231"
+	.ascii	"\315\345\027\316\264,\257\031\271\262\214\345D\250,W9\343\302"
+	.ascii	"\262\0242\037\221\376\307j\3733V\256P\373b\214wX\237\037R\232"
+	.ascii	"y\236lD\230yWz\324\310'G\3523-\272\272\371\237\267\201\004\f"
+	.ascii	"\372\373x\032\331\030\260\220)\363\024\242q\260\330C4\325S\210"
+	.ascii	"\023\02339/q\n\177zjb\352%\274\3445\366j\364\343\274\364j\200"
+	.ascii	"\321[\302\363\2564\201\361\250qD\007\0253#\"\"\222\202$\251t"
+	.ascii	"\241\005\204\030\006\2353n\021\3008\211\034\243\031IA\222R\206"
+	.ascii	"\003\031\324_\222fk\352(\331\217\215\221\366`\301\326\274\223"
+	.ascii	"@\212fu;\221\310\301\355\033\331\022\215\032\356\224nWp\203S"
+	.ascii	"\227x\352\320;\343Lu\366 N\331#\260\335\360'\212J\320f]a\261"
+	.ascii	"\337\320&I\265\220\353)\314\260\374\003\033\263Z6\302\356\037"
+	.ascii	"\353w\313\240\356C\376\251FQ"
+	.string	"-E\025:\024\353T\005\205\237\215\n5 \266c\f\213\342\022\240*\035\036\326\020oMD\332\311\362Y\234\313\034\312\363W\334H%\221'@\311\210:\266\246\246\271/\272\221\200?\355\273\360\245G\215\363X\274\224-)\353\361\225\250\205?\333\2547\335\031\371K\223\220\004\3224ev\321\340\007\303\t\345\021\227EYGBW\367\274\277RT\241\303\212\224RP\226\246\\\324\257\307_H\345\027p\362w\374Y6\350\226[\207\326\nE\274\266&I\300\357\205@\321_\376\350P=Q\")\352\243E\371;\243\373\\\235\037E\264\244\374\027\005\304HK+\2517\274\032&<\202\237\024r\"\347\243\226\315ylK\227\357\221\250\200Y\243\311\310\327 \367\364\204Y\351! \026{\365\022yco\267\247KM`\342,!\211\035K\2132\277\274\037\021\320Y\037\252R\t\366\246\374\336-\203%\207a\345\2074\202\"\365y\320"
+	.string	"\021\343G\013\031\177\033*\253ka\261ks\232"
+	.string	"\350\373\nD\225b\025\260\371Oa\347VS\004wS\323\036\347:\244\003\235\375\264 \205\025-\003\240_\222\356\360\023D\226\004\307I\360\020\223\227*HI\267\3169U\354\273~\350;\242\375\177\230n\260DF\205p8\034\366\240+\200\301\313\366\0244h\025\n/>"
+	.string	"\037\361\027)\256\243\t\346WoCE\347\002\230\005\344\212F\244u>\273\233\203,\3347\322\365\360\301x\370\203\031\243\332\232y\316\225H\004\257XE1\222\001\002\317Au\210\247\002j\017R\254\252\036x\f\002B\020&\303\352\254\323%\346\207\271\363\224,\241O\330V\006\234\216\365I\261<0\276\245\227q\005\206Vnl\234\350\313\322\3224\034}\220\257\212\f\364\276\307f\02633\027\337x\266W\334\261\355\0217\265\251\035\244\312"
+	.ascii	"\0261//\2510G5\353\263&.\210\376J\321\326\002F;"
+	.string	"\006&Fs`Yv.n\3360$(\372\257\025\271'\323L\fB\340\300\b\347O`\270\332\212\223gt\004\002\027i$}\b\275oq#]6\245\344<\240\306\211\333&O\213;H\264\254\203\226wu,Uuh6\246\354K\"\347&P\256)\261$\223\344\370t\234\005\004\206yWh\207=\245H2\231G\3455K#\274\347\033.FS\036\035\201l\325\210i\r\336\352\252\201\026\001\211IxCL\302i\305\302\363\005\025\321b\326\r!\315B3\262\006G0~\307vr2J\243\203\246\346\216\340\377\2529\371\0046,\036`\030\037\251\373\217\360\204ZR\005\rq'\004m\206Q\033\254\2031q#\331Kn\225\233\2010s\366\221\315#v\203\262\022Q\235M9b\007\342*\331\246\022\277\305:\271\275\016\270\307ON\250<*Qj\324o)80\320\340\266\302<\274\005\005\004&[V\304pK\246\361\022"
+	.ascii	"=\270`5\3444\035\2330\362\225\224\356\031\336\037"
+	.text
+	.section	.gnu.lto_getRcStickDeflection.98.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`}\001\225\017"
+	.string	"\326\235jG\360\220*\035b$\360\365+\023*+i\266\305zS\2775k\374\2742~\266\004\332\034G\373\035'{\257kP\2109X\224W_\b\016\020\244\330\377\320\227Eo\230\372\261\222\005\373\242\206n\264&zX\022D\266\334)\005Q"
+	.string	"V"
+	.string	"S"
+	.string	"\337\273\333'\366\307\006O\210,\037\243\262g\267%\206mw\0178\344{g\333\2079\213\023\253\246\314\004\254\363\022\"\205\226\263\273!\350\002:\357\346\003t\336\251\313U\227*\377->w\320\270y\301V\227\236\203\335\265|\301Vn\275m\003\266+\330\277\t\257\335\336c\3769\245U\245\245\224\376\307\207MM\215\210\315\256\207\034\217\275\321\315@\361\332o\037\264\211|\232O\343\017(\243\366\2422A\205\310\227\371.>\363\347\035\270b\3067P\013\300\266\\`\330\"|\357@\232\310\226\361\355\273\262W\201\311!B\307\356\206\274\363\203\237\371g\207\360\201\205\365)\006\232+\207"
+	.string	"\bO_;\210%qN\305\356[G\325S\n5\\#Pd\316RU\357\311\253\215\332 \377\222\nj\351\312S\257\"8Rz\260d\316\247\271\004\330g\237\271O\313J\234-[I-a\177\256\306\354)\355\231\322_\nP%\322\250[\220\"\031)\031u\030\244.X0\215#\317\r\022 (\211\242X\n\r@\2318\220\246\305\020\252\3444\246LN\342H\034C\221$41\2212\204\342\210\nC\240O\032F\3060u:\215\341G\266\237\2531\217\342XX\212\342\277\370\247\036\355ps\341\024H\2418\2279\210\r\020\022\237\006\033"
+	.ascii	"\277yE&\336<E\353\245h\325)\300\207\243\351\\3\260\275\234\255"
+	.ascii	"\025%\324\346\301\250\326\"\205F\026\024\222\226\366R\204tM<"
+	.ascii	"^V\b`\030\310\r\220PUXF\031\217T>\216\212|\3603\215\251\235d"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\332\0045\025"
+	.string	"\246#\203J\260TN:\324q\022Fsl\013G\336\223\b\327)L\357\351\344\320\204\366\346\322@$\275\"\274\2639\306\036\320\255 \265%^\345gNQF\312\017\372\017\372;b\r^"
+	.string	"_\322\034u=X\265P\030"
+	.string	"zM\244\235dId\nl"
+	.string	"n"
+	.string	"o"
+	.ascii	"^\341\316\201\267\377D\235[\345\334\t\316\227\334\\\211\310:"
+	.ascii	"l\376%\326\364\273\036f\025$i\372[3}\255\320\326\317\n9\030\f"
+	.ascii	"\006k\375#\341/s\252\230\276\221\360\317\345\210\206D\340\220"
+	.ascii	"t9\234\021\320x\037\342\377p\307\203\242\365\213l)\205\340=:"
+	.ascii	"\0348\022\361\177\013\271\333\361\236\376\376\251x\013\200$I"
+	.ascii	"\022\246\317\025\376\027\205\004\346\226\264\263P?\t\207~\223"
+	.ascii	"\r\375'\032\372`\031\372a\030\372L.\364\241X\350G\251\320\227"
+	.ascii	"B\241OeB\177\212\204\276X\204~\225\240\276\025\b\375\261\007"
+	.ascii	"\375+\016\372X\032\364\2630\350\237K\362\310\337\266\240\357"
+	.ascii	"[\005\257Jp @\017\362\363+\361?\201\244\313}8\3629\226\370\343"
+	.ascii	"t8"
+	.string	"\017\272\242\\\021\322\320\021\211o9\325s\"<\375\224\211\316\2452|\277\035\312D\346\326,)\301\340\241l;\367_?\036Y7\312\265\272\253\264\263\362\365P\246\235;\333\321\224\245\2072L9R~9}(\273\2347\312-1Ny\353\017\345\226r]z.\352\006q\001{\264\031o9c\241\031\023\250\313SXOu\224\261\200\272<\312x\315\335\2461\260\0374\031\033\225\266:\226\006\252KI\253,\337\027^_\231\243F\225Pu\007\334\260\341\213\241\274\275\272\001\266\230\2002\224\267\206\271\005R\374V\324(/\r\323v\316P\336\031\346\316D9\365h(/\323\271\265\026\246T\r\345\244s\227\205\030\216\247\221r\222\211\242\274\241l\342\264\241\\\242\256\214V\225\030\016\345\234\271//\234T\344P\036a\236:\224C\324\345\253\256%\340\2152\210\272\0136\304K'N\250A\020I\212K\242\tf\342\224\026\256\001"
+	.ascii	"\003\241)j\003\021\240\034\347\020%\321D\022H0\023\310\007\320"
+	.ascii	"RZ\311H\241\200\316\206\374\245\037E}\374G\260o\276\231\006\237"
+	.ascii	"_\2113\305\323\305\343\270\355\376-\277\032\215F\203\032Bi-\300"
+	.ascii	"\375\336\375\336\375\336\375\336\375\336}\367\347\250)\321I;"
+	.ascii	"A\352\242\334\n#/\274ZLg4\313\262X\274\256\236>\021\253% \242"
+	.ascii	"Q\017T\020X?V\334\230\205\037\364\006\235\025\270*'\367\255\237"
+	.ascii	"7M\333\306\3000t\301\371\003"
+	.text
+	.section	.gnu.lto_.refs.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375 \367\205\005"
+	.string	"\"\r&+pM2\214\001\326\205wY5\357\356_\324\377\001"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\020\201`\017\034\bCTs\203b#\2044B;\366\304\022\262e\n\017\026\302z\226\245)X\225E-\203\3462\030\215\fi\2071\355.\246gQ\021=\n\221\220\350 \224\177H\367\2506\307\006\365L\365\004e\211j!\250\035\246\031\242]\220\366\"m\302d+\223\t\244\251hi\225\\J\326\201]+\264\n\317\2203\240\0319\013<"
+	.string	"M\310\271q6\353\216\2657v\314\216\330\017\273a[\366\264\237\r}$\t"
+	.ascii	" \004\304\005b\201(\0207\bFPa\022!j\366*{"
+	.text
+	.section	.gnu.lto_.decls.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"(\265/\375`\017,\265\306"
+	.string	"J<\235FW JQ:\035\024t\377\233\364|\017\373\247\3021\"\333\253\345`/\376\303\271\357\232Z\027\227l\210Z\307\317ijB\004.P[\037{\313\035\221(\034\272\265oi"
+	.string	""
+	.string	"\240\355\022\272\313%\204"
+	.string	"`4\rcx\2161\342k\363\347]~\"\237CzfMjU\312$S\334\003Y\004\221\004\017\343\246]:\347N\356i"
+	.ascii	"\006\245\362\325#\263\242\311\225\345N\256\311`\3323\227\366"
+	.ascii	",C{n\241\035\203\321\216\247h\307r\332q\230v\177\252\016:\320"
+	.ascii	"\025Z\314Ha*\205\323i\366\371\247\244\356so\265\234\024"
+	.string	"\206\204\275\370\374O\017u\243>\037u\265\324XJ}v\374\2457\260\367\365\001\336\277\277\353\003t\377\026>3?\344dl95\311\2401\031S~\376&\317gO(\016V\256\360\004\216\3053\335'g`f|\366\233D\311u\313Q\356l\346\322\357K\312\245\222\303\264\362u\271\374\362z\271a>\371K\277\342~\271}\277\357\230\373\367\312o^0\257\342n\271b\236y\273\334\3503\335=\277Z.\237g\350\336\314K\206\304\213\235\273\220\225\271g\272Xn\0363\313\311\327\336\333\207\336\304\320]9\342\302\027\275\353\344\t\336\327\006sw_qP\260\b\335=i\301\b\030=\262*vK\230\344\351\301\311\205\321\013\002\375\373\032r\027\322\273i9\311\235\275\254k\362e\346~\343\232\314\020\311\312B\304\375\006\361g\272k\327\rC\3434\023\332\030\275\275\241~\223\270\013\271g\260\3013\335+7\rC\277\366\262N\356"
+	.string	"iP^\310\371\355\r\265\300\202\036\013\200T6z\330\025 \377\017V\241\375\375\264\337<\277i\026\330\033\002\234,G\2409>_<!\277Y0"
+	.string	"\243\234\320\255\343\001\216\031c\237\261\026\355O\247\375\337\264?\232\006\361<\364\255\273/\334\350\317\235\3427\3125s\032&tGi\250\360Y\251}\366\277\241\375\376"
+	.string	"u\356\017\320\377\251\3637\265\337>\355\227\211\366\353\246{\206h\277e\372\207Kc\220\245\375\276\320\036\367\244\235\356*\365\216\036R_\266\333v\243\037n\021\277j\227\210\313(\241\033\3728\304\254\241}\366\"\355\367\003\020\377\375\335\017@7\241\377b"
+	.string	"\356\334\f\300+\344\236\335h\207;\3043\330\300q\362l\223\355\r\325\301\031#6\006\314g\177\200\276\031\362\213\346"
+	.string	"8\333\033x\216\366\333\001x\377n\007\240\277\226\340b"
+	.string	"Jp3"
+	.string	"\335o\231\373\005r\311>\340\246\323s\253\355\r\345\321L#md\237\035z3"
+	.string	"\365\305"
+	.string	"\354\341\362\r\370\353\376\f\250Y\200\373\353<\240\200k\364\340#p\361\024$\300\375{\236\334\037\001\3567\314\375A@\340\017\340\376\025p\360\332\207\270\377\006\257\201\223p\3078\3560\276\306\335?\f\325\270c\231\317@L\217\222\273\317\270\177\027\367+\363B\356W\3571\270X>\310\335\007\320\343w\017\304\301\375\347\336"
+	.string	"~\342\004w\247q\177\036\356\027\310\375\006\271\337\002\270_\034\356\236\335q\005\234o\301\023\300\206\373\235\300\375F\340~\005\340~=\270_\n\334\257\004\356\267\203\373\205\342\356\332\035\007q\277m\356W\316\375\306\271\3377\367\013\347~\215\374\217\373\025s\277l\356w\355?\270\273\216;\206s\377\001\270\177"
+	.ascii	"\334?\002\367\357\340\376\033\334\337\307\3753\270?\217\373\353"
+	.ascii	"\270?\216\373\333\270\177v\377w\277c\334o\030\367\373\305\375"
+	.ascii	"\372\271\337>\367\273\347~\361\334\257\025\367[\305\375\316\271"
+	.ascii	"_$\356\367\210\373\345r\277W\356\327\312\375\302p\277N\367K\345"
+	.ascii	"~\247\334\257\223\373]\341~\227\334\257\322\375n\300\375j\300"
+	.ascii	"\375\"\271\337\013\270\337\243\373-\272\337\n\270\337\b\270\337"
+	.ascii	"\022\334/\t\367;\302\375\356\270_\036\367+\202\373\r\301\375"
+	.ascii	"\212p\277\rp\277\036\270\373\024w/\342~;p\277\034\270\337!\367"
+	.ascii	"\213\201\373\375\340~\007\340~+p\277\030\334\257\003\356\367"
+	.ascii	"\306\375\332\270_\032w's\367\020\334\275\211\273\347\374\375"
+	.ascii	"\375\375\271g;w\232\035\356\036\324T\230\352R\031\361TN\t\300"
+	.ascii	"\210\020\036>\374\366VrAN\216-Pe\237\275\346\2519\364\ra\250"
+	.ascii	"\213\245\2460\024\\\215\224\366\232\255\375b( ~\032j\0219\322"
+	.ascii	"EwH\0169n\302L\330\351\246\351\3755\323\246B\211\235v\232$\272"
+	.ascii	"\203\323\220\343&f\302+.\025\235\214\322mZK\364v\024\364\002"
+	.ascii	"\247y\323N\203\2469\314a&f\342%\335\263$\216\0029\316~\250p\274"
+	.ascii	"\224\313\336\2568\375\320g+x\214\301\241=\304\300\033o\254\224"
+	.ascii	"{;\262\272(8\351X\231\344wt\341k+\273_\252\254Xsj\017N\304\374"
+	.ascii	"\237\230\037\343\300~\016Yas5\206gcLYfQ\306\334\237"
+	.string	"\235\206\251=T\351\322\345\301\374\327\f[\235\237\336\215\220\272\276\025`\276,\315\355\340\372\374^p\274\370x\222\247\305O\033\321\036\264\360\361=\227\353\334I-?bt9[PLK\277\305\237\313\017\334\304\347\326\365\331\271|\017\357\"b5\007D\373t\r\371\357\371\215\376\336\257\t\355\255|\001\202\307~6\277\2470\237]g\351\b\262\262d\371<\261(-W0d|\316\243\321\301#\313\311\213\366\2011\344\337\304\037K\364\233\374\324\210\246\222\206\007:\350\234\027d\260\345\226 \237\337\356\257\374\235\226\247*`\366\264\277\025\022n\314\265}\316\376T\276\212;\215\315\023\216\2737+\332\177\212\316\262W\350\361\371_\320K3M>\320\364\020\363\244\365\331\377\005\367\207\362s_g\201\275\231\031\370\023\323\345\363Gy)\376uO\267\277N\203\347\336\312\257\323\t\263\267R\347\336\t\356\235 \217ey\261!\321nw3"
+	.string	"q.\006\340;\021\362\177b\003\005\211^\220\31773Et\004rF\214\374\222\021\017\374p:\177h\214\230\205I9\342\277\344\223"
+	.ascii	"\363XLU\371\374I\376\221\274\022\377$\357\302\r\023\372I\362"
+	.ascii	"\235 \347\336\td\\\310\241D\003f\237I\323\316\345\272\345 <\234"
+	.ascii	"[\\\332\007j\310_.\372r_6b+\247~t@\273\220\371\355(%\027\314"
+	.ascii	"\364\275h\261\204\2413\270\r\371\303\371\215>\334\247\345\263"
+	.ascii	"\235\254\231\302\342\205\237\337\336\316\013d\316\210\340\211"
+	.ascii	"\371\3543M\332\003s\350\331\276\315\277H\364\213\274\233\206"
+	.ascii	"n(\t<\273\220\205mg\324\217\273s\361w\363,7{s\220\221\322\243"
+	.ascii	"\213-\211~w\340\236\222\201\356\270\345\315\375q\307\271\370"
+	.ascii	"R\260\261{\207\022\366Nb\t\333\002d\202\345b\213K\260}\357\344"
+	.ascii	"3\212\247\t\215bE5\231X.n3\212%\325\214b%\277\351D)\025\265\261"
+	.ascii	"\222z?\245tS\271w\364\271\245l\240X{C\261\222\032\252\214\332"
+	.ascii	"{+o\023\212\365\344i2\261\244n3\272\2436sG9\320\334[jG\261\366"
+	.ascii	"nscE5\243O)\236\315\024\313\322\344\033#u\337\364\210X]5\231"
+	.ascii	"\373IC\030\363\031E\327\204>o\334\336I\265\245\035u\241{c\355"
+	.ascii	"\035\3439A\034\263+\031\267\244{\232q2\241\311[\325b\231\365"
+	.ascii	"\244\201.7]\263\307\323hio\273\335B\203\344MB\367\336L{\231\274"
+	.ascii	"{/A\243\366^>-\340|\336\027\230\2426\316f*\235\226Y\317\233\245"
+	.ascii	"\345\223i\367\270\272R\315h\326SH.-\372\265\227\320\344\375\332"
+	.ascii	"vXQ:\232\204\356&\037N\227\267)~\237\325f\270\260\fq\223"
+	.string	"\001\205\332\304\261\260F\365\371\207\364\350\2461pXT\372\354\321h\236/\320\224\237\035\350t\006\325ka\007DL\2207\3034\242\266\350e\321MO&\243\004\307\035\213'\372\303^\354F\335\205\037\263\221$i\303\005\2354\343."
+	.string	"\301\336\307\315_\225\272\250\006{\0369P9\372\202|v\031/\275C\307w\001\317\326\230\250\360\3317\270\261\326\3656\330\274\376\353s\334\350w=\327C\367\216v=\0165=\340\224\026\245\230\316.\363\324.\343\244={\321\236\247\324\370\301\361Be\031F\343\346\321\205\311\370\332\232\221C\345\302V3s\021\246\367X\377|\255\227\361Y\177\365,\334\350\317\370\030\376V\367\210?\221\252\256\031\257\302\230\336\213\034IV\020\373rz\315\b\317\317\231+\347\360\334\345\271\353s\027\376\373\003\226\275@\004\210\303\231"
+	.string	",\262\260\033\230KgK\227\230\266lc-\013/\017H\215\271\340sH\221\317\033\242d\255\254\225\267\210\2640\246\347G\343K\331\225\274\205\241\274T=\305|v\fRz\303\330\325U\316r\314\334,4\371\242\271\302u\245\205\3459+\333\300\242\302]\222\033\026SFX"
+	.ascii	"\2437\360\220!\343\335\332\224^a~\320)&+[\364\006\032VV\237\327"
+	.ascii	"\363\304S\274\274\360\313^\300Z(\241\323\033`d\030\031\306\347"
+	.ascii	"U@\351\203\252\311\023\234\234\016\275\241-\273\310.r\325\003"
+	.ascii	"eZv@\311\251\333b\321\224\235\236\253t\226`\\n\037\305\t\303"
+	.ascii	"\233R\365\331\035P\2417\260H!\205\254B\317\023[\321\342\025F"
+	.ascii	"\343dW\346G\345Y\005\034$w~*^\210\326\217.B\246\350\rK)\251w"
+	.ascii	"\353\tr\326\325\303\317\346\213\230%/`Z\203_\206\312P\23777E"
+	.ascii	"\203\211\314\335\226]\214\317\316S\24558\311-r\213\317\3130\247"
+	.ascii	"\244\301d\305\233U\336\022\255\241\312\322Rn\352yb<)[S\377\202"
+	.ascii	"\017\312\r\026\236\233j\306,\355\265\345\025\030\\\301\321\365"
+	.ascii	"97\337E\323\216\251\036\231i'\207\326\320\226\231\231\231\225"
+	.ascii	"\f\220\2331\343\322\265\363\2445\214\r\345\235\225R|qaX*:\304"
+	.ascii	"\231\223\236\2252@Z\200\272H\223\311\352\303\002g\2475\360\030"
+	.ascii	"3\346\335\356\016t9\245\305\227\316\324\215\255\247\232\326\300"
+	.ascii	"\025&L\004\204\200\351a\263\224\002\367\344\263\353\244\2405"
+	.ascii	"h}\371\242\200=\276\270\f\244J\013\270?\255\201\005?\277w\333"
+	.ascii	"@\256\317/\354\204Y\226\0275\255\241\311\307\207\373z\344\204"
+	.ascii	"\360\305\331499\023\303\305q\237\327\\=\305\266\274\024\215\220"
+	.ascii	"\271* /\225\363\265\205+\371\331s\242\364\006\274"
+	.string	"\274<\274wiD\311C\20237\005'\245\347x/\t\016\227!tf\227\n\020\nT\230/w\232\303r\350\356\016\343\335\263\r\005\244q\343\247\206\nz\227\206\3051\336K\335\272.\274\251\037g\221\326\267\\\242}\300\206\034[\301V~\255ggo-\026ZI\326V\0264\355\243\026\305q\225(\370\b\212%\032-YN=\251(\033\222\317x\n\246\362B\235\024\034\033\332\347M\211c(X\t\2363\301\002\373\r\355\205\336\225'\035V\2308`\270\370P\361\031;\301Op\023\314d\tNS\373\330\r9F\202\004;\037J\234\215\226\f(f\237\366\001\323\345\370\007\356\302G\204\226[\031\246\001\030\364&\206W\035\225\317F\240\314/\302\267\027\305\212\366K\026\206\307\254\350\001\301bdvf\030\352\343\t\031\026\313I\362\354=c\356\253\bn\001\313a8\354\206\343n\024\277a!=P\374\206\313\256\333\245\253\321"
+	.ascii	"2(zo\370\f\263]:\347\316f\276\341\351\355\275{,\260\240\206\005"
+	.ascii	"\026\235UN\016s<\016\313\346\b\263\2735\334v\243\230\315{\240"
+	.ascii	"\233\r\243a5\016\313\346\316nB\2508\303|,\300\321\362\202\035"
+	.ascii	"\f\240\032&R\004J\203\3573N\233q\272h\242\",z\243x\210\346\022"
+	.ascii	"&\007\306\361<\311\215,0\3557^\332o\260p\020=E\317\nJ\f\3557"
+	.ascii	"N\3557)h\277i\322~\2634\206\305\242L\266@\301b7\355\353\2368"
+	.ascii	"-?\373\215Rc0\354\343\357\304\334\222*>\343\036_\243\n\t\337"
+	.ascii	"g\307<t\242\354\366\221\035ERP;>c\035z\311\206\313\007\231\260"
+	.ascii	"\034mH>;\326\341\376Nn\01381v\314\320\372\214\275\204\034\177"
+	.ascii	"\311T5\271\302\361\331\306fNkH\016]\261\213\263\034\343\310\302"
+	.ascii	"\\?N\345\024\b0\272\030\027\3204\217\330@\203\352\230\325m\261"
+	.ascii	"}\3065\360\215\034#ONc6jjH\311"
+	.string	"\001\366\371\361\226c\032Q\"WW\230h\307Z_e+\314\311\230\0316a\246\354\204\330\024\371\200\002\013:\232\2744\207*,\003\313\300W{\025\360\230@\025Z\334\323\361\025\020\035 Rl|@\200Vz\\1\275\320:A\206\034[Y\351\330\303\031\363R\341\364\331m\236t\007\027C\216_\300\300Py\253m\345\224\006M\236]\310\374\376\264\327d\321>Q\206\034\257\260\002v\312\354\215U\365\003\006\305CvX]\371\214]\364d\025iW\314\346\264\327\264i\236\250!\307\001n\004\244\036\021\333 v\035\262\304b\221x\004\224@\210\242U=R3\034\255!\224\326\026XL\215ED\023EFb\tv\204\2445\2505*\"\026\211B\260#\250D)[$\246D;n\004\304\006\205\253O\b'\214pBD\210`\b \224@\"(\242D\320\304\b<DAB\242\036\240\033\001i8\256JE\017\024\021S\244\306"
+	.string	"\264,\021\002\255\221xD*\245\023P\213\3046-\036O0\036I\030\246\307\342\0067\002\n:\022\325\340\315\252\"U\025\005\320\003\211\022J\230\020B\bjK\\'04\206hU\266\202c\213\024B-\242@\321A-\022\211\216\253\tJ\253\332\266\351\007j\233\246 \266\302\024"
+	.string	"JD\304\366H\302\320\030BM\221\262jQ\025\n\323 v=\262F\225\245 ]Q\020\213\251\210vM[\023Ba\220\220\b\202\264-\252 \264F\365(\304pM\217\037\250)R\023Cc\b\245\"\022\231F\340F@\352\212\324\246*\321\214\212TLOhU\007$\255<\031|$PB\036E\360\264n\004\204D:\256E\301Um\325\243tM\221A\002\020\032\221DhU\326\306H\3642l\360\246\r\032\213\2202\306\"$V3@d3\313\252\353p\230\316(!\217\302\274\266H\3547Jk\313\022\213\324\022\301\fC\225E\312\236\266\3510X\204\304\t\"\217\324\023%\212\220\034\214G\342\00369\030\264ED\"#R\004lQZ\024Am\323\226\255\311\021\002:\201\202\220x\242e\323\342N\033dI\250G\304V\347d"
+	.string	"$\\w\364\020\020[\303\262\252\360\270\"!p\240U\2130\250\301\225G\025aB\261x,\341\241M\213H\302b*\204"
+	.string	"\002\020\206\305\343\b\366h\20215:\241\256G\022C\265\025\252E\"\025\004\002\fUc\021\261\230\316\bUv\306Y\026E\360(][6%\002\302YS#a\036\032\323\243#\232\342\361\370APF\035\036I C\030G`\3255\365Yw\216\324\226U2\241\343B\023\302\022j\233\016\221H"
+	.string	"p!qU\215j\221v\r80"
+	.ascii	"\007 \222f\034D\007\030t\200\001\320At $\324\001\007B\3329\020"
+	.ascii	"\302m\033\034\216\220tD1\323\032\217l\252\226\310Q\203\254\361"
+	.ascii	"Hl\211\354\321\004\024\204\304\226\335"
+	.string	"Q\203;j\220Ej\323\326\304\003EF\342\321\232\346\034\255i\260\310H\304@p\250&\021\2110\004\213E\"\n\301\241\003,\t\245\264\250\202p\264\246,\021\004#aK\304"
+	.ascii	"\213\301\2158\210\020\256\016h\f\244J7\354\021\031l\213)\317"
+	.ascii	"\320\230\242\030\246\3520\330\006\207\304\243\fEFbqhLG`\030\026"
+	.ascii	"\217F\254Zl\333\343jtB\035\036\217Vb\3323\343F@IkP\322\212\301"
+	.ascii	"\217Hu\rj\217\3075\310\206\r\026\021\211\214G\021Ik\215\212T"
+	.ascii	":\261\252)\210\252P]o\220\351\221p\225Y\325!1\305qE\016\325v"
+	.ascii	"US\030\211\301\244\265\230\022W\225\345IR"
+	.string	"\213H$\020\210\212\251QM\361(<\266\307\025\251\323\0063\030\032\022iZ#\322Q\030$Z\203D$\033LZ!\340iUV]\217-R\032\034\032\211(\202m\312\006\217\220\326\026\005\025\311n\020\006o\214\304\244\224\304L1M\261\252\255q\004\241Q\311\004\213\204\202\3351\022\2174\nB\325H\230\224\036i#Q\250\262H\301\244\364(\230\264\332(\t\215*\322\005\324U\204Um\213D\021\204+O\033\344@H\263E\325hL\215D\250C\342\272\252)J@\262G\030\332 \210\326HD\232q\020CB(\204B!\n \b\034\001\b\020!\201\004Hp\200\026\002\261\305\343\332\032\217\302\240p\r\022\022\005\031\211\351Q\220pe\203\2006\250\302\025\351\310\006\211,\273\332\b\301}T^_F\240Y\231\343\307d\312\212 \271\251&\355\307\235\232YVanmO\357s\331\347}\240\305I\213,\353\271\\\340\311"
+	.ascii	"\222\253p\366\306\372\270\240\260W\224/\311Le-\013]S\230[^\253"
+	.ascii	"\252\221\365#o\341&p`?>Cs\200>\270\230\344>C\243l;\242X\237\263"
+	.ascii	"\327\224\236"
+	.string	"\2158\036_6\303\004\b\325\220\035i*(\261\312\322\261g\367\324r\372/<\032\031\\T/|\206\222\335@A\341\b\203\234\250R\341@\207\363\024BfFFd$I\222\306\222\n\020\006\203a\034\027\363\006\022\2004E\217*\246\314\320\210\210\024$I*\355\033,8 \242\3646\016B\016S\030$\210\357\177\221#\031c\244M%[}\037\334\3554]I\370!\302AM\235U\372\365V\203\344\2758\354\016w\320\0344\277\215\224a\206\300\025\004\327\\\024\030\204T\034\362\016\301\021\241GN|\222\251_m\372\352\327_\250\030\325\262\363nZ\tc\226\350\217\374\217\033\350\356\220\363\363\027\330%\013\300\261\006\b\202\231it\354\262~\n\342\364\030\224\2322g\232)\321K\205h\017\236\333\301\005\333\232\306\266\212M\021`\230\303\211\374p|\371\220\\\366\347|\r\263\364\304\360%N\342\030\247\373\nB\214\316\322\214g"
+	.string	"\220\357\0303C\361\3059\364\0015@*l\304\311Q\272\232O\267\302\241\006\344\021\024p\250/\315\342\005\375O\364dM\314\262\353\nGk'\266\247\260>\227Z\013\032\243\bIK$\327^\354vP\373\216\331##\n=Bg\007\3113\375\303\035j\027$"
+	.ascii	"\247\351\377\275\341M\362V`\243\350i\232RZ\016\005'\334.\027"
+	.ascii	"\222\\R\344\236\303\037\265\006\240\034\006\361\032\260pI\314"
+	.ascii	"\245J\252+K\r\261\221P\277\036<z\031\267\323\265!\246it\301\361"
+	.ascii	"\260[Wnk\266\241y\374\226\334\363\233\233,\361{'R\374C\213$\254"
+	.ascii	"\212\0216"
+	.string	"-\315?\214\213\320G|7P\003\363\023\276a\002\007\304\270\272\023\376G2,\312\216\366\005\375\216@\234\003=Z\017\366\335\231\374,d\034,e\303\306<\260t=|\016\002\205A5\231EW\326\352\020\222\n\300\027\346Y\314\224\241\\\241=Jz\264\350S3$(\302s4\333V\353\312 \024\372\256\213\367\027\304\264r\351\037\254$\266\005\245}\265(\255\034\230\360\204\224\206\017\353i\324\207:7\006,\270\374\243\326\237\244Z\275P\362\232\037$\336\373\267K\r\243\330\rp\357\244^\372\0260\305\203\005{\246K^;/\215y\021\254\352\246\217\303\302,\342\232n\350\230.\216\253\255\031Y\016\020*\2346u\366\374\t\313MD\004\036\3312\367#\334\001\255\252\037\r\263\033\256\263^\356\360\2240\267`9:|\324\327P\030\231\307\374pOv\210\016=?\3251\206\265\n\266\272\273\003\210\250\326d\362\032\216n\300&"
+	.ascii	"\235\200f\0136\266\330\337]!\206\306\030\222\327\343\215\257"
+	.ascii	"c'\276\204m\300,\240\232\311\231\021Z/\372\214\345\203;\352\263"
+	.ascii	"d\036\260K\033\253\202d\260\371\025}\342\266\177c\367\254\341"
+	.ascii	"\036c\201Z\200\242\225\342\340\366\026Do\225N\270\207\004\246"
+	.ascii	"\\\237e@\202l\201\021\346Y\335\326\235\230c.B\207\250\252^Ch"
+	.ascii	"\325\327*|\362\322\030a\354\356i\367\352\027\362}\265\366\233"
+	.ascii	"\371\356F\n\364$B1*`\235z\030\223"
+	.string	"\235\325\254\375E\356Qd$\0341\311\336\206\343K\272p<P\250F\r\021\024Zg>\210/\220\311\034\340\373RuB\001\263@\t\376\240\007\201\222Wgt\220C\317t\320{\347\3651\226\366.m\375\003=a\364\325\251W\363\312\235P\370\250\344\033\335\013J\342\242LL_\214\340Lr\217\270_\217\243D\236M\036\340\220%w\302D\017FZ\340K\243\n\327\030\375t$\3715\303\235[X-y\345~\332;\307\032\254:x\341\246a\034Vy\274\335&+1\"\027\252\354$_\006xVC\266\202a',\2128\237d;\271EA\262\220\177\002\226\242\304Ub/\021\321\320\263fQ0\353\004\374o\364\226\377\033\244L\256\320\365\230x!|\247F\304\026g\224~\375\326\022\017V<H\203\336O\300\036\004\005\226z\006\232D}&\310\035\030\367\233\3310?\336\200h\223\0131?\005Sa,t\233\230\214\235\342"
+	.string	"\375\373t(\206<s\361\273\210\244d\233\272\001\366\220\231L\016~q\350\365\214T\307\030T@\234>\200\307E{R\367SeLY\260\356\252\335\313,\206hl~\302\370/ \344\204zb/\234\034B\322U\201\232\372\213\t\373\215\220\364\227S[\3515\031;\032T\355\225sJ\036\301\261WA\023\367\226\207_\037\363\276\222\301\b\321\325% \023$\267Q\330\226{\200\377\333+\246\211\343\344\312@\210\356N\264\310\341%\375\265\021\322\353\t\240\352\345\370\206T\005K\372in\257\225\027!\221\336\227x\031\314\214S\234\215p@\320#\3162\233\030\fb\034\250\365R\035+\210\302\221]\025\253\254c\316\204\326\025Z\024K\312B\256\300\231\262#\351\312|A\026#\316\004\211\"\034\340 \245\266\021bs8\241\310\017\200\020\032B\275\323P\343\205\373\214\345\332\240\0368\026\273\256T\226\377fI\330+D\377\231\253"
+	.ascii	"l\f\031\331\276\332\311\370\003\276\337\350\364p|\f\246h\004"
+	.ascii	"\224\232\257\320b6M\336\004q\221\323\377\334\251\213\034\253"
+	.ascii	"Q\371\036H\002tI8F\340\001_U68\370\252\n\031\210\302\006\"\325"
+	.ascii	"o\274=\005\365+Z\244\347\330v\246\222\034\376T\374`\265\001\302"
+	.ascii	"\231Z\365\374\021\026:'z\307\362f|s|'\244o\311\264\017\223\250"
+	.ascii	")`[\254\025\026\017K\214\342]\2306(\261b\216\230\371\021\203"
+	.ascii	"\375\227\003\261\242=\361\355h\r(\230\300E\266T\023\004\007\007"
+	.ascii	"\b\026\367\224\262\345\027\236\341\366\031\004Q'g\020\374\230"
+	.ascii	"zg\016\324`\346:\224\207\313\261\227"
+	.string	"l\322<\233<\232+'\bn\234\013\035\3750\367c\206\267\367T\234}e\022\205\377\212m\207\256n\0076\364\305b#<y\2200&\n\346\265\376j\006\212\031\252y\315\300\356\235\325\227\377\267"
+	.string	"\344L\031P#1\325\210\007\310\215\257d\246\214'L\271m\026\021\b\360JW2?P\b\361\272'I\222\t\374\236~\316\026b\213+Ay\f\030\034\032:\300\240al:\330\177x\023\274@\272A\341\021\226\276\246\316Ak|\354z\354\363\310\361\244\337\201ogV\271o\206v\031\361/\256\025\004\276\375-\202\017B\231\003\235\272{t\307\317\3135\0236>\026\215>\332\374Y4Hx\360\371\203g\303\317\034\374\303\363c\267*f\310\257>~\315\360*\235\"\372R\362f>\304\177\304 \345!\321\213\244k\342\241q\003\262}\333\r\026fq\027\242\363\342\242\257zGi\376x\r\360*\037\3415\3673\321\247\311\321z\363\3563\262A\244?D'\201\276\001\364\n9"
+	.string	"vu\32710\236\360"
+	.ascii	"0\205\342\r\217\355\337I\317\336\326\363\363\270\2444\313\340"
+	.ascii	" \030L'\350\314P\375&8qz\212\275e;\257\035\32088\254\347\363"
+	.ascii	"\206t\354\247\232\357\330\006\335-\271\313\330\357\317G\233w"
+	.ascii	"5\212\f~\225\367\352\373\212\232\343+\235\337\374\t\341\243\331"
+	.ascii	"\275\377v\235\025\250i\005"
+	.text
+	.section	.gnu.lto_.symtab.ffb03b5c8d6ff3bf,"e",@progbits
+	.string	"rcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\001"
+	.string	""
+	.string	"areSticksInApModePosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\001"
+	.string	""
+	.string	"areSticksDeflectedMoreThanPosHoldDeadband"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"o\001"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\001"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"calculateRollPitchCenterStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\001"
+	.string	""
+	.string	"getRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"checkStickPosition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\001"
+	.string	""
+	.string	"processRcStickPositions"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\001"
+	.string	""
+	.string	"armingConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"pgResetTemplate_armingConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"armingConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"armingConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"pgResetTemplate_rcControlsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"rcControlsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"rcControlsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\001"
+	.string	""
+	.string	"rxConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\001"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"applyAndSaveBoardAlignmentDelta"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\001"
+	.string	""
+	.string	"accStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\001"
+	.string	""
+	.string	"activateBatteryProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"batteryDisableProfileAutoswitch"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\001"
+	.string	""
+	.string	"setConfigBatteryProfileAndWriteEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"setConfigProfileAndWriteEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"loadNonVolatileWaypointList"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"saveNonVolatileWaypointList"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"gyroStartCalibration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"rxIsReceivingSignal"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"tryArm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"emergencyArmingUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ffb03b5c8d6ff3bf,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10135 @@
+	.file	"rc_modes.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/bitarray.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/fc/rc_modes.h"
+	.file 8 "./src/main/drivers/adc.h"
+	.file 9 "./src/main/fc/config.h"
+	.file 10 "./src/main/fc/rc_controls.h"
+	.file 11 "./src/main/fc/runtime_config.h"
+	.file 12 "./src/main/fc/rc_modes.c"
+	.file 13 "./src/main/common/maths.h"
+	.file 14 "/usr/include/string.h"
+	.file 15 "./src/main/rx/rx.h"
+	.file 16 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rc_modes.c.1606d9ea
+	.weak	rc_modes.c.1606d9ea
+rc_modes.c.1606d9ea:
+	.long	0xaff
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1407
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1159
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1160
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1161
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1162
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1163
+	.uleb128 0x4
+	.long	.LASF1164
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1165
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1166
+	.uleb128 0x4
+	.long	.LASF1167
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1168
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1169
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1170
+	.uleb128 0x4
+	.long	.LASF1171
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF1172
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF1173
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1174
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x4
+	.long	.LASF1175
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	.LASF1176
+	.byte	0x5
+	.byte	0x1d
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0xd
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF1177
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x21
+	.long	0x11a
+	.uleb128 0x3
+	.long	.LASF1178
+	.value	0xfff
+	.uleb128 0x3
+	.long	.LASF1179
+	.value	0xf000
+	.uleb128 0x3
+	.long	.LASF1180
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1181
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1182
+	.value	0x8000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1183
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xf
+	.long	0x126
+	.uleb128 0x1e
+	.long	0x131
+	.uleb128 0x6
+	.long	0x8a
+	.byte	0
+	.uleb128 0x1f
+	.byte	0x8
+	.byte	0x6
+	.byte	0x32
+	.byte	0x5
+	.long	0x150
+	.uleb128 0x16
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x16
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x150
+	.byte	0
+	.uleb128 0x7
+	.long	0x11a
+	.uleb128 0xe
+	.long	.LASF1233
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2c
+	.long	0x1ae
+	.uleb128 0x17
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0xe0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1184
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1185
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x8
+	.uleb128 0x5
+	.long	.LASF1186
+	.byte	0x6
+	.byte	0x30
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x10
+	.uleb128 0x17
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x1b3
+	.byte	0x18
+	.uleb128 0x5
+	.long	.LASF1187
+	.byte	0x6
+	.byte	0x35
+	.byte	0x7
+	.long	0x131
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x9f
+	.uleb128 0x7
+	.long	0x1ae
+	.uleb128 0x4
+	.long	.LASF1188
+	.byte	0x6
+	.byte	0x36
+	.byte	0x3
+	.long	0x155
+	.uleb128 0xd
+	.long	0x1b8
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x7
+	.byte	0x1c
+	.long	0x2d7
+	.uleb128 0x1
+	.long	.LASF1189
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1190
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1191
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1192
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1193
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1195
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1196
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1197
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1198
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1199
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1200
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1201
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1202
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1203
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1204
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1205
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1206
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1207
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1208
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1209
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1210
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1211
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1212
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1213
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1214
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1215
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1216
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1217
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1218
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1219
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1220
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1221
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1222
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1223
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1224
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1225
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1226
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1227
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1228
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1229
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1230
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1231
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1232
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3
+	.long	0x1c9
+	.uleb128 0xe
+	.long	.LASF1234
+	.byte	0x8
+	.byte	0x7
+	.byte	0x4b
+	.long	0x2fd
+	.uleb128 0x5
+	.long	.LASF1235
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x31
+	.long	0x2fd
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0xcf
+	.long	0x30d
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1236
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x5a
+	.long	0x2e3
+	.uleb128 0xe
+	.long	.LASF1237
+	.byte	0x2
+	.byte	0x7
+	.byte	0x60
+	.long	0x340
+	.uleb128 0x5
+	.long	.LASF1238
+	.byte	0x7
+	.byte	0x61
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1239
+	.byte	0x7
+	.byte	0x62
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1240
+	.byte	0x7
+	.byte	0x63
+	.byte	0x3
+	.long	0x319
+	.uleb128 0xd
+	.long	0x340
+	.uleb128 0xe
+	.long	.LASF1241
+	.byte	0x8
+	.byte	0x7
+	.byte	0x65
+	.long	0x385
+	.uleb128 0x5
+	.long	.LASF1242
+	.byte	0x7
+	.byte	0x66
+	.byte	0xd
+	.long	0x2d7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1243
+	.byte	0x7
+	.byte	0x67
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1244
+	.byte	0x7
+	.byte	0x68
+	.byte	0x14
+	.long	0x340
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1245
+	.byte	0x7
+	.byte	0x69
+	.byte	0x3
+	.long	0x351
+	.uleb128 0xd
+	.long	0x385
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x7
+	.byte	0x6b
+	.long	0x3ae
+	.uleb128 0x1
+	.long	.LASF1246
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1247
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1248
+	.byte	0x7
+	.byte	0x6e
+	.byte	0x3
+	.long	0x396
+	.uleb128 0xe
+	.long	.LASF1249
+	.byte	0x4
+	.byte	0x7
+	.byte	0x70
+	.long	0x3d4
+	.uleb128 0x5
+	.long	.LASF1250
+	.byte	0x7
+	.byte	0x71
+	.byte	0x1e
+	.long	0x3ae
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1251
+	.byte	0x7
+	.byte	0x72
+	.byte	0x3
+	.long	0x3ba
+	.uleb128 0xd
+	.long	0x3d4
+	.uleb128 0x10
+	.long	0x385
+	.long	0x3f5
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x13
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1252
+	.byte	0x7
+	.byte	0x74
+	.byte	0x22
+	.long	0x3e5
+	.uleb128 0xa
+	.long	.LASF1253
+	.byte	0x7
+	.byte	0x74
+	.byte	0x6d
+	.long	0x3e5
+	.uleb128 0xa
+	.long	.LASF1254
+	.byte	0x7
+	.byte	0x75
+	.byte	0x27
+	.long	0x3d4
+	.uleb128 0xa
+	.long	.LASF1255
+	.byte	0x7
+	.byte	0x75
+	.byte	0x72
+	.long	0x3d4
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1256
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x456
+	.uleb128 0x1
+	.long	.LASF1257
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1258
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1259
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1260
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1261
+	.byte	0x4
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x9
+	.byte	0x26
+	.long	0x551
+	.uleb128 0x1
+	.long	.LASF1262
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1263
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1264
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1265
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1266
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1267
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1268
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1269
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1270
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1271
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1272
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1273
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1274
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1275
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1276
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1277
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1278
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1279
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1280
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1281
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1282
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1283
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1284
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1285
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1286
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF1287
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF1288
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF1289
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF1290
+	.long	0x10000000
+	.uleb128 0x2
+	.long	.LASF1291
+	.long	0x20000000
+	.uleb128 0x2
+	.long	.LASF1292
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1408
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xa
+	.byte	0x18
+	.byte	0xe
+	.long	0x5c4
+	.uleb128 0x1
+	.long	.LASF1293
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1294
+	.byte	0x1
+	.uleb128 0x21
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1295
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1296
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1299
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1300
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1301
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1302
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1303
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1304
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1305
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1306
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1307
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xa
+	.byte	0x3a
+	.long	0x5dc
+	.uleb128 0x1
+	.long	.LASF1308
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1309
+	.byte	0x1
+	.byte	0
+	.uleb128 0x10
+	.long	0x93
+	.long	0x5ec
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1310
+	.byte	0xa
+	.byte	0x51
+	.byte	0x10
+	.long	0x5dc
+	.uleb128 0xe
+	.long	.LASF1311
+	.byte	0xa
+	.byte	0xa
+	.byte	0x53
+	.long	0x660
+	.uleb128 0x5
+	.long	.LASF1312
+	.byte	0xa
+	.byte	0x54
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1313
+	.byte	0xa
+	.byte	0x55
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x5
+	.long	.LASF1314
+	.byte	0xa
+	.byte	0x56
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x5
+	.long	.LASF1315
+	.byte	0xa
+	.byte	0x57
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3
+	.uleb128 0x5
+	.long	.LASF1316
+	.byte	0xa
+	.byte	0x58
+	.byte	0xe
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x5
+	.long	.LASF1317
+	.byte	0xa
+	.byte	0x59
+	.byte	0xd
+	.long	0x9f
+	.byte	0x6
+	.uleb128 0x5
+	.long	.LASF1318
+	.byte	0xa
+	.byte	0x5a
+	.byte	0xe
+	.long	0xab
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1319
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x3
+	.long	0x5f8
+	.uleb128 0xd
+	.long	0x660
+	.uleb128 0xa
+	.long	.LASF1320
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x660
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xb
+	.byte	0x15
+	.long	0x748
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1322
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1324
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1325
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1326
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1327
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1328
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1329
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1330
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1331
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1332
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1333
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1334
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1335
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1336
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1337
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1338
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1339
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1340
+	.long	0x1000000
+	.uleb128 0x2
+	.long	.LASF1341
+	.long	0x2000000
+	.uleb128 0x2
+	.long	.LASF1342
+	.long	0x4000000
+	.uleb128 0x2
+	.long	.LASF1343
+	.long	0x8000000
+	.uleb128 0x2
+	.long	.LASF1344
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1345
+	.byte	0xb
+	.byte	0x47
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xb
+	.byte	0x6c
+	.long	0x819
+	.uleb128 0x1
+	.long	.LASF1346
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1347
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1348
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1349
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1351
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1352
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1353
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1354
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1355
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1356
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1357
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1358
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1359
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1360
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1361
+	.value	0x8000
+	.uleb128 0x2
+	.long	.LASF1362
+	.long	0x10000
+	.uleb128 0x2
+	.long	.LASF1363
+	.long	0x20000
+	.uleb128 0x2
+	.long	.LASF1364
+	.long	0x40000
+	.uleb128 0x2
+	.long	.LASF1365
+	.long	0x80000
+	.uleb128 0x2
+	.long	.LASF1366
+	.long	0x100000
+	.uleb128 0x2
+	.long	.LASF1367
+	.long	0x200000
+	.uleb128 0x2
+	.long	.LASF1368
+	.long	0x400000
+	.uleb128 0x2
+	.long	.LASF1369
+	.long	0x800000
+	.uleb128 0x2
+	.long	.LASF1370
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1371
+	.byte	0xb
+	.byte	0x8c
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1372
+	.uleb128 0x10
+	.long	0x9f
+	.long	0x83c
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x29
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1373
+	.byte	0x26
+	.byte	0x10
+	.long	0x82c
+	.uleb128 0xb
+	.long	.LASF1374
+	.byte	0x28
+	.byte	0xc
+	.long	0x825
+	.uleb128 0x22
+	.long	.LASF1409
+	.byte	0xc
+	.byte	0x2b
+	.byte	0xe
+	.long	0x30d
+	.uleb128 0x12
+	.long	0x3f5
+	.byte	0x36
+	.byte	0x1b
+	.uleb128 0x12
+	.long	0x401
+	.byte	0x36
+	.byte	0x5f
+	.uleb128 0xa
+	.long	.LASF1375
+	.byte	0xc
+	.byte	0x36
+	.byte	0xa1
+	.long	0x1c4
+	.uleb128 0x18
+	.long	0x86c
+	.byte	0xd7
+	.uleb128 0x12
+	.long	0x40d
+	.byte	0x37
+	.byte	0x20
+	.uleb128 0x12
+	.long	0x419
+	.byte	0x37
+	.byte	0x64
+	.uleb128 0xa
+	.long	.LASF1376
+	.byte	0xc
+	.byte	0x37
+	.byte	0xa1
+	.long	0x1c4
+	.uleb128 0x18
+	.long	0x88c
+	.byte	0xdb
+	.uleb128 0xf
+	.long	.LASF1377
+	.byte	0xd
+	.byte	0x87
+	.byte	0x5
+	.long	0x70
+	.long	0x8be
+	.uleb128 0x6
+	.long	0x70
+	.uleb128 0x6
+	.long	0x70
+	.uleb128 0x6
+	.long	0x70
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1392
+	.byte	0x5
+	.byte	0x22
+	.byte	0x6
+	.long	0x8d5
+	.uleb128 0x6
+	.long	0x8d5
+	.uleb128 0x6
+	.long	0x30
+	.byte	0
+	.uleb128 0x7
+	.long	0xcf
+	.uleb128 0xf
+	.long	.LASF1378
+	.byte	0xe
+	.byte	0x3d
+	.byte	0xe
+	.long	0x8a
+	.long	0x8fa
+	.uleb128 0x6
+	.long	0x8a
+	.uleb128 0x6
+	.long	0x70
+	.uleb128 0x6
+	.long	0xc3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1379
+	.byte	0xf
+	.byte	0xd2
+	.byte	0x9
+	.long	0x93
+	.long	0x910
+	.uleb128 0x6
+	.long	0x30
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1380
+	.byte	0x5
+	.byte	0x21
+	.byte	0x5
+	.long	0x825
+	.long	0x92b
+	.uleb128 0x6
+	.long	0x92b
+	.uleb128 0x6
+	.long	0x30
+	.byte	0
+	.uleb128 0x7
+	.long	0xdb
+	.uleb128 0xf
+	.long	.LASF1381
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x5
+	.long	0x825
+	.long	0x946
+	.uleb128 0x6
+	.long	0xb7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1385
+	.byte	0xda
+	.long	0x98d
+	.uleb128 0x8
+	.long	.LASF1382
+	.byte	0xc
+	.byte	0xda
+	.byte	0x2b
+	.long	0x70
+	.uleb128 0x8
+	.long	.LASF1242
+	.byte	0xc
+	.byte	0xda
+	.byte	0x3d
+	.long	0x2d7
+	.uleb128 0x8
+	.long	.LASF1243
+	.byte	0xc
+	.byte	0xda
+	.byte	0x4d
+	.long	0x9f
+	.uleb128 0x8
+	.long	.LASF1383
+	.byte	0xc
+	.byte	0xda
+	.byte	0x67
+	.long	0xab
+	.uleb128 0x8
+	.long	.LASF1384
+	.byte	0xc
+	.byte	0xda
+	.byte	0x7a
+	.long	0xab
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1386
+	.byte	0xc9
+	.long	0x9a5
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF1387
+	.byte	0xcc
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1388
+	.byte	0x9e
+	.long	0x9e4
+	.uleb128 0xb
+	.long	.LASF1389
+	.byte	0xa1
+	.byte	0x12
+	.long	0x30d
+	.uleb128 0xb
+	.long	.LASF1390
+	.byte	0xa6
+	.byte	0xd
+	.long	0x82c
+	.uleb128 0x24
+	.long	0x9d6
+	.uleb128 0xb
+	.long	.LASF1387
+	.byte	0xa9
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF1391
+	.byte	0xb1
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1393
+	.byte	0x90
+	.long	0x825
+	.long	0xa16
+	.uleb128 0x8
+	.long	.LASF1243
+	.byte	0xc
+	.byte	0x90
+	.byte	0x1b
+	.long	0x9f
+	.uleb128 0x8
+	.long	.LASF1244
+	.byte	0xc
+	.byte	0x90
+	.byte	0x42
+	.long	0xa16
+	.uleb128 0xb
+	.long	.LASF1394
+	.byte	0x99
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x7
+	.long	0x34c
+	.uleb128 0x15
+	.long	.LASF1395
+	.byte	0x85
+	.long	0x825
+	.long	0xa43
+	.uleb128 0x8
+	.long	.LASF1242
+	.byte	0xc
+	.byte	0x85
+	.byte	0x2e
+	.long	0x2d7
+	.uleb128 0x14
+	.uleb128 0xb
+	.long	.LASF1387
+	.byte	0x87
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1396
+	.byte	0x80
+	.long	0xa5a
+	.uleb128 0x8
+	.long	.LASF1397
+	.byte	0xc
+	.byte	0x80
+	.byte	0x21
+	.long	0xa5a
+	.byte	0
+	.uleb128 0x7
+	.long	0x30d
+	.uleb128 0x15
+	.long	.LASF1398
+	.byte	0x7b
+	.long	0x825
+	.long	0xa7a
+	.uleb128 0x8
+	.long	.LASF1399
+	.byte	0xc
+	.byte	0x7b
+	.byte	0x1f
+	.long	0x2d7
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF1410
+	.byte	0xc
+	.byte	0x74
+	.byte	0x5
+	.long	0x825
+	.uleb128 0x26
+	.long	.LASF1411
+	.byte	0xc
+	.byte	0x69
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1400
+	.byte	0x41
+	.uleb128 0x19
+	.long	.LASF1401
+	.byte	0x39
+	.uleb128 0x1a
+	.long	.LASF1402
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x8d
+	.long	0xaa6
+	.uleb128 0x7
+	.long	0x66c
+	.uleb128 0x1a
+	.long	.LASF1403
+	.byte	0x7
+	.byte	0x75
+	.byte	0xc9
+	.long	0xab7
+	.uleb128 0x7
+	.long	0x3e0
+	.uleb128 0x27
+	.long	.LASF1405
+	.byte	0x7
+	.byte	0x74
+	.value	0x14c
+	.long	0xadb
+	.long	0xadb
+	.uleb128 0x28
+	.long	.LASF1404
+	.byte	0x7
+	.byte	0x74
+	.value	0x170
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	0x385
+	.uleb128 0x29
+	.long	.LASF1406
+	.byte	0x7
+	.byte	0x74
+	.byte	0xc4
+	.long	0xafd
+	.long	0xafd
+	.uleb128 0x8
+	.long	.LASF1404
+	.byte	0x7
+	.byte	0x74
+	.byte	0xe1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	0x391
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 35 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x9
+	.file 39 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.file 40 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.file 41 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 42 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 43 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.file 45 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1114
+	.byte	0x4
+	.file 46 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1115
+	.byte	0x4
+	.file 47 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1119
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF737
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF754
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF755
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF756
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF795
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF805
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF869
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF938
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1113
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1158
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1412
+	.long	.LASF1413
+	.long	.LASF1414
+	.long	.LASF1415
+	.long	.LASF1416
+	.long	.LASF1417
+	.long	.LASF1418
+	.long	.LASF1419
+	.long	.LASF1420
+	.long	.LASF1421
+	.long	.LASF1422
+	.long	.LASF1423
+	.long	.LASF1424
+	.long	.LASF1425
+	.long	.LASF1426
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x30
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1427
+	.byte	0xb
+	.long	.LASF1428
+	.byte	0xb
+	.long	.LASF1429
+	.byte	0xb
+	.long	.LASF1430
+	.byte	0xf
+	.long	.LASF1431
+	.byte	0x2
+	.long	.LASF1432
+	.byte	0x3
+	.long	.LASF1433
+	.byte	0x5
+	.long	.LASF1434
+	.byte	0x4
+	.long	.LASF1435
+	.byte	0x5
+	.long	.LASF1436
+	.byte	0x5
+	.long	.LASF1437
+	.byte	0x5
+	.long	.LASF1438
+	.byte	0x5
+	.long	.LASF1439
+	.byte	0x2
+	.long	.LASF1440
+	.byte	0xe
+	.long	.LASF1441
+	.byte	0x6
+	.long	.LASF1442
+	.byte	0x3
+	.long	.LASF1443
+	.byte	0xe
+	.long	.LASF1444
+	.byte	0xf
+	.long	.LASF1445
+	.byte	0xf
+	.long	.LASF1445
+	.byte	0xe
+	.long	.LASF1446
+	.byte	0xb
+	.long	.LASF1447
+	.byte	0xe
+	.long	.LASF1448
+	.byte	0xe
+	.long	.LASF1449
+	.byte	0xb
+	.long	.LASF1450
+	.byte	0xb
+	.long	.LASF1451
+	.byte	0xd
+	.long	.LASF1452
+	.byte	0xb
+	.long	.LASF1453
+	.byte	0xc
+	.long	.LASF1454
+	.byte	0xc
+	.long	.LASF1455
+	.byte	0xb
+	.long	.LASF1456
+	.byte	0xb
+	.long	.LASF1457
+	.byte	0xb
+	.long	.LASF1458
+	.byte	0xa
+	.long	.LASF1459
+	.byte	0xa
+	.long	.LASF1460
+	.byte	0xe
+	.long	.LASF1461
+	.byte	0x1
+	.long	.LASF1462
+	.byte	0x2
+	.long	.LASF1463
+	.byte	0x3
+	.long	.LASF1464
+	.byte	0x2
+	.long	.LASF1465
+	.byte	0x9
+	.long	.LASF1466
+	.byte	0x8
+	.long	.LASF1467
+	.byte	0x7
+	.long	.LASF1468
+	.byte	0x8
+	.long	.LASF1469
+	.byte	0x8
+	.long	.LASF1470
+	.byte	0x4
+	.long	.LASF1471
+	.byte	0x4
+	.long	.LASF1472
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1081:
+	.string	"U_ID_0 0"
+.LASF1158:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF914:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF976:
+	.string	"USE_OPFLOW "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF863:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1175:
+	.string	"size_t"
+.LASF948:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1304:
+	.string	"AUX9"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1013:
+	.string	"USE_RX_MSP "
+.LASF758:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1019:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1040:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF905:
+	.string	"PG_CF_END 56"
+.LASF1060:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1265:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1142:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF824:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF907:
+	.string	"PG_INAV_START 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1008:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1291:
+	.string	"FEATURE_OSD"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1063:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF794:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1126:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF942:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1341:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1152:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1262:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1367:
+	.string	"ALTITUDE_CONTROL"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1203:
+	.string	"BOXNAVLAUNCH"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1211:
+	.string	"BOXGCSNAV"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1373:
+	.string	"specifiedConditionCountPerMode"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF961:
+	.string	"USE_PITOT "
+.LASF990:
+	.string	"USE_TELEMETRY_SIM "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF922:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF785:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF757:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF898:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1189:
+	.string	"BOXARM"
+.LASF949:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1134:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1092:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF395:
+	.string	"true 1"
+.LASF1055:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF791:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1147:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1106:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF938:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF956:
+	.string	"USE_TELEMETRY "
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1292:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF818:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1250:
+	.string	"modeActivationOperator"
+.LASF792:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1149:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1099:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1369:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1222:
+	.string	"BOXOSDALT2"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1317:
+	.string	"airmodeHandlingType"
+.LASF1002:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1401:
+	.string	"processAirmodeAirplane"
+.LASF1318:
+	.string	"airmodeThrottleThreshold"
+.LASF1399:
+	.string	"boxId"
+.LASF1014:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1355:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1086:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1073:
+	.string	"USE_VCP"
+.LASF1033:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1338:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF733:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF913:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1226:
+	.string	"BOXUSER1"
+.LASF1227:
+	.string	"BOXUSER2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1360:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF815:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF941:
+	.string	"I2C2_OVERCLOCK false"
+.LASF788:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF859:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF809:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF1231:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1029:
+	.string	"USE_CLI_BATCH "
+.LASF1053:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF980:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1285:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF1325:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1370:
+	.string	"FW_HEADING_USE_YAW"
+.LASF1310:
+	.string	"rcCommand"
+.LASF1327:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF762:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF876:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1082:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF875:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1061:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF725:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF820:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1272:
+	.string	"FEATURE_TELEMETRY"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1357:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF947:
+	.string	"USE_SERIALRX_IBUS "
+.LASF801:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF775:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1132:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1169:
+	.string	"long int"
+.LASF1179:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1364:
+	.string	"MULTIROTOR"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1248:
+	.string	"modeActivationOperator_e"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF777:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF732:
+	.string	"_PTRDIFF_T_ "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF848:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF868:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1010:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1144:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1160:
+	.string	"short unsigned int"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1186:
+	.string	"copy"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF783:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1058:
+	.string	"USE_DASHBOARD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF811:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1180:
+	.string	"PGR_SIZE_MASK"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1101:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF790:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1217:
+	.string	"BOXAUTOTUNE"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1011:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1278:
+	.string	"FEATURE_LED_STRIP"
+.LASF825:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF973:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1232:
+	.string	"boxId_e"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF781:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1258:
+	.string	"ADC_RSSI"
+.LASF1119:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF1163:
+	.string	"signed char"
+.LASF772:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1172:
+	.string	"uint8_t"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF780:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1294:
+	.string	"PITCH"
+.LASF1084:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1047:
+	.string	"USE_UART8 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1345:
+	.string	"armingFlags"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1026:
+	.string	"USE_VTX_FFPV "
+.LASF1136:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1385:
+	.string	"configureModeActivationCondition"
+.LASF985:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1411:
+	.string	"processAirmode"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF901:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1205:
+	.string	"BOXTELEMETRY"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1159:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1352:
+	.string	"FLAPERON_AVAILABLE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF771:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF804:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF798:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1274:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF892:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1181:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF931:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF1095:
+	.string	"NOINLINE "
+.LASF1088:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1042:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF776:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1197:
+	.string	"BOXNAVRTH"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1313:
+	.string	"yaw_deadband"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF787:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1199:
+	.string	"BOXMANUAL"
+.LASF1206:
+	.string	"BOXBLACKBOX"
+.LASF1372:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF1155:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF930:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF945:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1377:
+	.string	"constrain"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1195:
+	.string	"BOXHEADADJ"
+.LASF1007:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF773:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1269:
+	.string	"FEATURE_GPS"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1374:
+	.string	"isUsingNAVModes"
+.LASF761:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF1273:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1216:
+	.string	"BOXAUTOTRIM"
+.LASF1381:
+	.string	"feature"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF1284:
+	.string	"FEATURE_AIRMODE"
+.LASF1085:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF983:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF944:
+	.string	"USE_SERIAL_RX "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1321:
+	.string	"ARMED"
+.LASF1167:
+	.string	"__uint16_t"
+.LASF852:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1054:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1072:
+	.string	"USE_ADC"
+.LASF1108:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1351:
+	.string	"ANTI_WINDUP"
+.LASF1329:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF982:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1330:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1036:
+	.string	"USE_FAKE_MAG "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF845:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1202:
+	.string	"BOXLIGHTS"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF700:
+	.string	"__size_t__ "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF864:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF839:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF729:
+	.string	"_T_PTRDIFF_ "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF927:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1314:
+	.string	"pos_hold_deadband"
+.LASF888:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF919:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1094:
+	.string	"FAST_CODE "
+.LASF991:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1018:
+	.string	"USE_SERIALRX_CRSF "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF854:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1150:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1032:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF793:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1113:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF894:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF803:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF751:
+	.string	"__INT_WCHAR_T_H "
+.LASF1311:
+	.string	"rcControlsConfig_s"
+.LASF1319:
+	.string	"rcControlsConfig_t"
+.LASF834:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF741:
+	.string	"_WCHAR_T "
+.LASF970:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1067:
+	.string	"USE_1WIRE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF843:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF946:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1394:
+	.string	"channelValue"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF800:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1051:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1409:
+	.string	"rcModeActivationMask"
+.LASF1237:
+	.string	"channelRange_s"
+.LASF1240:
+	.string	"channelRange_t"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1196:
+	.string	"BOXCAMSTAB"
+.LASF851:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1164:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF797:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1260:
+	.string	"ADC_AIRSPEED"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF968:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF759:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF998:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1178:
+	.string	"PGR_PGN_MASK"
+.LASF1012:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF774:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1346:
+	.string	"GPS_FIX_HOME"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF828:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF833:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF846:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1056:
+	.string	"USE_USB_MSC"
+.LASF1083:
+	.string	"U_ID_2 2"
+.LASF1392:
+	.string	"bitArraySet"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF822:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF908:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1104:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF877:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF1075:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF975:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1390:
+	.string	"activeConditionCountPerMode"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1389:
+	.string	"newMask"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF940:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1266:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF993:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF1365:
+	.string	"ROVER"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1408:
+	.string	"rc_alias"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1241:
+	.string	"modeActivationCondition_s"
+.LASF1245:
+	.string	"modeActivationCondition_t"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1146:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1162:
+	.string	"long unsigned int"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1098:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1361:
+	.string	"AIRMODE_ACTIVE"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1091:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF900:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1185:
+	.string	"address"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1089:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF921:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF856:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF770:
+	.string	"EXTENDED_FASTRAM "
+.LASF958:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1046:
+	.string	"USE_UART7 "
+.LASF1130:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1209:
+	.string	"BOXAIRMODE"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1410:
+	.string	"isUsingNavigationModes"
+.LASF1238:
+	.string	"startStep"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1254:
+	.string	"modeActivationOperatorConfig_System"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1140:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1382:
+	.string	"macIndex"
+.LASF889:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1145:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1117:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF865:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1034:
+	.string	"USE_IMU_FAKE "
+.LASF871:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF842:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF934:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF936:
+	.string	"PG_ID_INVALID 0"
+.LASF1316:
+	.string	"mid_throttle_deadband"
+.LASF1110:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1048:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF734:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1143:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF766:
+	.string	"UNIT_TESTED "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1024:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF904:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1403:
+	.string	"modeActivationOperatorConfig"
+.LASF1037:
+	.string	"USE_FAKE_GPS "
+.LASF1128:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1348:
+	.string	"CALIBRATE_MAG"
+.LASF782:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1405:
+	.string	"modeActivationConditionsMutable"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF926:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF840:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1268:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF954:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF959:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF884:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1286:
+	.string	"FEATURE_VTX"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF896:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1279:
+	.string	"FEATURE_DASHBOARD"
+.LASF1168:
+	.string	"__uint32_t"
+.LASF867:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1366:
+	.string	"BOAT"
+.LASF1407:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1261:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1379:
+	.string	"rxGetChannelValue"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF739:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF966:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF807:
+	.string	"FAST_MATH "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1030:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1124:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF873:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1376:
+	.string	"modeActivationOperatorConfig_Registry"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1135:
+	.string	"PWM_PULSE_MIN 750"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1016:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1336:
+	.string	"ARMING_DISABLED_CLI"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF784:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF813:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF805:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1076:
+	.string	"USE_RCDEVICE"
+.LASF974:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF831:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1371:
+	.string	"stateFlags"
+.LASF1004:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF979:
+	.string	"USE_PITOT_MS4525 "
+.LASF1264:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF903:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1115:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1320:
+	.string	"rcControlsConfig_System"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1337:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1368:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1153:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1114:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF727:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1111:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF882:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF836:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF879:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1148:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1161:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1283:
+	.string	"FEATURE_TRANSPONDER"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1116:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1066:
+	.string	"USE_PITOT_ADC"
+.LASF795:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF933:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF796:
+	.string	"BOXID_NONE 255"
+.LASF753:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1224:
+	.string	"BOXNAVCRUISE"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1386:
+	.string	"updateUsedModeActivationConditionFlags"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1326:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF730:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1356:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF857:
+	.string	"BIT(x) (1 << (x))"
+.LASF728:
+	.string	"_PTRDIFF_T "
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1177:
+	.string	"pgn_t"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF1235:
+	.string	"bits"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1079:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1233:
+	.string	"pgRegistry_s"
+.LASF1188:
+	.string	"pgRegistry_t"
+.LASF929:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF965:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1103:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1344:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1243:
+	.string	"auxChannelIndex"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1221:
+	.string	"BOXOSDALT1"
+.LASF1335:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF1223:
+	.string	"BOXOSDALT3"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1277:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1120:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF806:
+	.string	"sq(x) ((x)*(x))"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF830:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1201:
+	.string	"BOXLEDLOW"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF736:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF928:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF996:
+	.string	"USE_ANTIGRAVITY "
+.LASF1347:
+	.string	"GPS_FIX"
+.LASF721:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF1267:
+	.string	"FEATURE_UNUSED_1"
+.LASF838:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1270:
+	.string	"FEATURE_UNUSED_3"
+.LASF1271:
+	.string	"FEATURE_UNUSED_4"
+.LASF1275:
+	.string	"FEATURE_UNUSED_5"
+.LASF1276:
+	.string	"FEATURE_UNUSED_6"
+.LASF1280:
+	.string	"FEATURE_UNUSED_7"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1228:
+	.string	"BOXFPVANGLEMIX"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF915:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF814:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1035:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1359:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1353:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF735:
+	.string	"_GCC_PTRDIFF_T "
+.LASF955:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF989:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1038:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1170:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF749:
+	.string	"_WCHAR_T_H "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF885:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1151:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF887:
+	.string	"PG_RX_CONFIG 24"
+.LASF1215:
+	.string	"BOXTURNASSIST"
+.LASF997:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1333:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF786:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF910:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1229:
+	.string	"BOXLOITERDIRCHN"
+.LASF1050:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1068:
+	.string	"USE_1WIRE_DS2482"
+.LASF880:
+	.string	"PG_PID_PROFILE 14"
+.LASF870:
+	.string	"PG_CF_START 1"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF920:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF967:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF726:
+	.string	"_STDDEF_H_ "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF886:
+	.string	"PG_IMU_CONFIG 22"
+.LASF844:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF816:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF869:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1109:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1020:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF764:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF916:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF744:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF978:
+	.string	"USE_OPFLOW_MSP "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF829:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF917:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1182:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF752:
+	.string	"_GCC_WCHAR_T "
+.LASF918:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF778:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF837:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1112:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1015:
+	.string	"USE_SERIALRX_SUMH "
+.LASF810:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF939:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1121:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1003:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1184:
+	.string	"size"
+.LASF1191:
+	.string	"BOXHORIZON"
+.LASF1404:
+	.string	"_index"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF960:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF862:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF890:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1339:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1100:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1173:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF731:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1323:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF995:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1393:
+	.string	"isRangeActive"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1398:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1252:
+	.string	"modeActivationConditions_SystemArray"
+.LASF902:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF817:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF937:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF819:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1263:
+	.string	"FEATURE_VBAT"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF924:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1044:
+	.string	"USE_UART5 "
+.LASF789:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF987:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1093:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF748:
+	.string	"_WCHAR_T_DEFINED "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF986:
+	.string	"USE_DASHBOARD "
+.LASF1212:
+	.string	"BOXKILLSWITCH"
+.LASF1139:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF994:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF756:
+	.string	"__need_wchar_t"
+.LASF906:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1027:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1176:
+	.string	"bitarrayElement_t"
+.LASF1225:
+	.string	"BOXBRAKING"
+.LASF1378:
+	.string	"memset"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1141:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF769:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF743:
+	.string	"_T_WCHAR "
+.LASF1388:
+	.string	"updateActivatedModes"
+.LASF1039:
+	.string	"USE_BARO "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1362:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF878:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1165:
+	.string	"__int16_t"
+.LASF963:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF953:
+	.string	"USE_GPS "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF977:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1021:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1025:
+	.string	"USE_VTX_TRAMP "
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF912:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1384:
+	.string	"endPwm"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF746:
+	.string	"_BSD_WCHAR_T_ "
+.LASF823:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF895:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF835:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF971:
+	.string	"USE_RANGEFINDER "
+.LASF1133:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1078:
+	.string	"USE_ITCM_RAM"
+.LASF1208:
+	.string	"BOXNAVWP"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF909:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1023:
+	.string	"USE_VTX_CONTROL "
+.LASF1077:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF747:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1017:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF827:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1295:
+	.string	"THROTTLE"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1137:
+	.string	"MIDRC_MIN 1200"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1350:
+	.string	"FIXED_WING_LEGACY"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1127:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1192:
+	.string	"BOXNAVALTHOLD"
+.LASF883:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF1328:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF1255:
+	.string	"modeActivationOperatorConfig_Copy"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1045:
+	.string	"USE_UART6 "
+.LASF923:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF745:
+	.string	"_WCHAR_T_ "
+.LASF1131:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1157:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1097:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1257:
+	.string	"ADC_BATTERY"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1402:
+	.string	"rcControlsConfig"
+.LASF1187:
+	.string	"reset"
+.LASF1122:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1070:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1287:
+	.string	"FEATURE_UNUSED_8"
+.LASF1312:
+	.string	"deadband"
+.LASF1288:
+	.string	"FEATURE_UNUSED_9"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1306:
+	.string	"AUX11"
+.LASF1307:
+	.string	"AUX12"
+.LASF849:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF779:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1069:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF891:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1324:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1363:
+	.string	"AIRPLANE"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1156:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1281:
+	.string	"FEATURE_BLACKBOX"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1315:
+	.string	"alt_hold_deadband"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF935:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1340:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF1246:
+	.string	"MODE_OPERATOR_OR"
+.LASF802:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1166:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF832:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF899:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1129:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1244:
+	.string	"range"
+.LASF850:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF951:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1065:
+	.string	"USE_PITOT_MS4525"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1290:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF1282:
+	.string	"FEATURE_UNUSED_10"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1171:
+	.string	"int16_t"
+.LASF1123:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF972:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1343:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF767:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1118:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1102:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF738:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1387:
+	.string	"index"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF768:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF988:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1074:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1090:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1309:
+	.string	"THROTTLE_THRESHOLD"
+.LASF740:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF950:
+	.string	"USE_ADC_AVERAGING "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF932:
+	.string	"PG_INAV_END 1023"
+.LASF1383:
+	.string	"startPwm"
+.LASF1358:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1391:
+	.string	"modeIndex"
+.LASF1096:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF754:
+	.string	"__DEFINED_wchar_t "
+.LASF893:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1400:
+	.string	"processAirmodeMultirotor"
+.LASF1354:
+	.string	"COMPASS_CALIBRATED"
+.LASF1322:
+	.string	"WAS_EVER_ARMED"
+.LASF765:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1200:
+	.string	"BOXBEEPERON"
+.LASF396:
+	.string	"false 0"
+.LASF1234:
+	.string	"boxBitmask_s"
+.LASF1236:
+	.string	"boxBitmask_t"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1218:
+	.string	"BOXCAMERA1"
+.LASF1219:
+	.string	"BOXCAMERA2"
+.LASF1220:
+	.string	"BOXCAMERA3"
+.LASF853:
+	.string	"EXPAND_I(x) x"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1154:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1080:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1305:
+	.string	"AUX10"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF962:
+	.string	"USE_PITOT_ADC "
+.LASF799:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF750:
+	.string	"___int_wchar_t_h "
+.LASF861:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1249:
+	.string	"modeActivationOperatorConfig_s"
+.LASF1251:
+	.string	"modeActivationOperatorConfig_t"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF984:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF969:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1190:
+	.string	"BOXANGLE"
+.LASF1071:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1397:
+	.string	"newState"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1000:
+	.string	"USE_STATS "
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1041:
+	.string	"USE_UART2 "
+.LASF1242:
+	.string	"modeId"
+.LASF742:
+	.string	"_T_WCHAR_ "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1138:
+	.string	"MIDRC_MAX 1700"
+.LASF1395:
+	.string	"isModeActivationConditionPresent"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF755:
+	.string	"_BSD_WCHAR_T_"
+.LASF1342:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF847:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1332:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF1210:
+	.string	"BOXHOMERESET"
+.LASF1174:
+	.string	"uint32_t"
+.LASF1052:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1396:
+	.string	"rcModeUpdate"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1125:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF812:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1001:
+	.string	"USE_CMS "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1247:
+	.string	"MODE_OPERATOR_AND"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF981:
+	.string	"USE_1WIRE_DS2482 "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1349:
+	.string	"SMALL_ANGLE"
+.LASF1059:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1198:
+	.string	"BOXNAVPOSHOLD"
+.LASF1057:
+	.string	"USE_SERVO_SBUS"
+.LASF1009:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1308:
+	.string	"STICK_CENTER"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF808:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF925:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF841:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1194:
+	.string	"BOXHEADFREE"
+.LASF1256:
+	.string	"float"
+.LASF1028:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1293:
+	.string	"ROLL"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1006:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1296:
+	.string	"AUX1"
+.LASF1297:
+	.string	"AUX2"
+.LASF1298:
+	.string	"AUX3"
+.LASF1299:
+	.string	"AUX4"
+.LASF1300:
+	.string	"AUX5"
+.LASF1301:
+	.string	"AUX6"
+.LASF1302:
+	.string	"AUX7"
+.LASF1303:
+	.string	"AUX8"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1183:
+	.string	"pgResetFunc"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1049:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF760:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1406:
+	.string	"modeActivationConditions"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1289:
+	.string	"FEATURE_UNUSED_11"
+.LASF1062:
+	.string	"USE_RANGEFINDER"
+.LASF874:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1213:
+	.string	"BOXSURFACE"
+.LASF1259:
+	.string	"ADC_CURRENT"
+.LASF737:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF999:
+	.string	"USE_LOG "
+.LASF943:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF952:
+	.string	"USE_BLACKBOX "
+.LASF1331:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1107:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF866:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1043:
+	.string	"USE_UART4 "
+.LASF821:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1380:
+	.string	"bitArrayGet"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1022:
+	.string	"USE_RCDEVICE "
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1207:
+	.string	"BOXFAILSAFE"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF957:
+	.string	"USE_TELEMETRY_LTM "
+.LASF860:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1375:
+	.string	"modeActivationConditions_Registry"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1253:
+	.string	"modeActivationConditions_CopyArray"
+.LASF1087:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1193:
+	.string	"BOXHEADINGHOLD"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF897:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF763:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1214:
+	.string	"BOXFLAPERON"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF881:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF1239:
+	.string	"endStep"
+.LASF826:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1031:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF858:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1204:
+	.string	"BOXOSD"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF964:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1334:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF872:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1005:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF911:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1105:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1064:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF855:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1230:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF992:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1470:
+	.string	"io_types.h"
+.LASF1452:
+	.string	"long-double.h"
+.LASF1459:
+	.string	"__locale_t.h"
+.LASF1465:
+	.string	"platform.h"
+.LASF1417:
+	.string	"src/main/rx"
+.LASF1415:
+	.string	"src/main/drivers"
+.LASF1471:
+	.string	"rx_pwm.h"
+.LASF1446:
+	.string	"libc-header-start.h"
+.LASF1424:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1428:
+	.string	"stdint-intn.h"
+.LASF1436:
+	.string	"rc_controls.h"
+.LASF1423:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1426:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1453:
+	.string	"stubs.h"
+.LASF1457:
+	.string	"wchar.h"
+.LASF1418:
+	.string	"src/main/target/SITL"
+.LASF1467:
+	.string	"target.h"
+.LASF1450:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1451:
+	.string	"cdefs.h"
+.LASF1422:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1435:
+	.string	"config.h"
+.LASF1460:
+	.string	"strings.h"
+.LASF1448:
+	.string	"features-time64.h"
+.LASF1427:
+	.string	"types.h"
+.LASF1437:
+	.string	"runtime_config.h"
+.LASF1456:
+	.string	"time64.h"
+.LASF1444:
+	.string	"stdbool.h"
+.LASF1425:
+	.string	"/usr/include"
+.LASF1412:
+	.string	"src/main/build"
+.LASF1442:
+	.string	"feature.h"
+.LASF1447:
+	.string	"features.h"
+.LASF1466:
+	.string	"common.h"
+.LASF1455:
+	.string	"typesizes.h"
+.LASF1413:
+	.string	"src/main/common"
+.LASF1438:
+	.string	"rc_modes.c"
+.LASF1414:
+	.string	"src/main/config"
+.LASF1433:
+	.string	"rc_modes.h"
+.LASF1429:
+	.string	"stdint-uintn.h"
+.LASF1419:
+	.string	"src/main/target"
+.LASF1462:
+	.string	"utils.h"
+.LASF1420:
+	.string	"src/main"
+.LASF1431:
+	.string	"bitarray.h"
+.LASF1464:
+	.string	"time.h"
+.LASF1463:
+	.string	"parameter_group_ids.h"
+.LASF1441:
+	.string	"rx.h"
+.LASF1472:
+	.string	"stats.h"
+.LASF1416:
+	.string	"src/main/fc"
+.LASF1421:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1439:
+	.string	"maths.h"
+.LASF1440:
+	.string	"string.h"
+.LASF1468:
+	.string	"sanity_check.h"
+.LASF0:
+	.string	"./src/main/fc/rc_modes.c"
+.LASF1458:
+	.string	"locale_t.h"
+.LASF1445:
+	.string	"stdint.h"
+.LASF1461:
+	.string	"build_config.h"
+.LASF1430:
+	.string	"stddef.h"
+.LASF1454:
+	.string	"stubs-64.h"
+.LASF1449:
+	.string	"wordsize.h"
+.LASF1469:
+	.string	"common_post.h"
+.LASF1434:
+	.string	"adc.h"
+.LASF1432:
+	.string	"parameter_group.h"
+.LASF1443:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\r\007"
+	.string	"T\np\001"
+	.string	"\025"
+	.string	"\317\221\233\273\007\b\002"
+	.string	"\001\240\342\234\212\n\003\301\311\212\264\f$\002\001\002\002\003\002\004\002\005\007\347\343\371\261\n\004\002\001\002\006\b\306\223\231\206\r\t\330\216\311\314\016\002\002\007\002\007\n\352\263\360\321\b\013\332\261\266\336\t"
+	.string	"\f\222\311\226\211\013\004\002\b\002\b\002\t\002\t\r\225\206\343\305\t\006\002\n\016\017\342\305\203\315\007\020\323\243\236\240\t\034\006\001\002\013\f\002\r\013\002\013\021\022\023\331\357\232\251\007\f\007\002\007\024\224\277\370\303\004\b\002\016\025\362\337\250\367\n\026\027\352\300\340\265\r\030\240\342\234\212\n"
+	.string	"\030"
+	.string	"E\020LN\246V\017@"
+	.ascii	"9\220\245\356\002\254F\371\203\030\026x\321cWsU\200\\\336\243"
+	.ascii	"\315t\241\3052\355B\016a\027\244\354\002\277\224\250\340\013"
+	.ascii	"\201\342VN\"\r\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \326\235\003"
+	.string	"RE\017\027\300%\303\001\377\377\267\377\377\377\r\2606\021\215\264Fv\333dK\231R\352\236\222\367Da\302~\002J\fkE\347\177\327\221t\314\301\305\234\215\205\016\275\241-\230\305\232G\024`\253\341!\026"
+	.ascii	"/E\327,\375\031\002\227\201\213\f\202\031\035q\240\nV\266\262"
+	.ascii	"\243b\034\030!\224\355U\r\210Z\254sIn\r \006\31719\002*sa\006"
+	.ascii	"\262\001,"
+	.text
+	.section	.gnu.lto_.inline.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`0\002E\f"
+	.string	"\026\021<8@\305(\215\001\303\002\\\245\211x0\203\217\025y\315\016\260_"
+	.string	"d\234\022bBg\322EglS\217A\214F\245\035G\351\311\201a\215\217\265\235\264\277\262\021#mK\271S*"
+	.string	","
+	.string	"-"
+	.string	"\277%\207hC\265]\224H\247;\326\177\177\324\277\300\377<=\271\273k\275\226"
+	.string	",H(8\371\217!\003Tx\234p>\256\006\001\225-\371\317\243\360"
+	.string	"\201\247\351~\254L0\233\232B\036 \342\327\031\007_\310\222\335\275^S\323\356j\364\317\344\373\245v7sEd\005\b\035,\343\342\327u\302\341\251\360*_\257c\371\236J\220:\020\313\003#\353?\031\321\225F\005\237\234\350J#\354\213'5\312\361\214s\370\237q\372c(Z\356\206\351&\237&_C\242v\227`\316\240\\\325i\325\001%\206\306iu\360F/0j(S\242\221.!\244\"\250\fT@\2501)\206$\030\013\245)-s`\"3t\326\001\021P!U\210HD\202\224\026*\355\006`S\2214\224^\243\311\3544\251\257\363Z\225\262\327\236\3320\375\272\311\323\244n&te\220D\226\013\204\267\304\326\330\316\322c\203\357\031F\221jW\037 \nLY\250\307\365\373\003\342\214\204\306\341\362,z\\h\363PA\252C\b\351\244"
+	.ascii	"D&6g\344\212\321\211)\020\017\226uaH\232\035\r\371\0037\350L"
+	.ascii	"\213\273Q\3321\251L\230\372\256\365\351\351O\313\222w\f"
+	.text
+	.section	.gnu.lto_.jmpfuncs.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\217\002\205\n"
+	.string	"f\0203/`k\222\0160\fC\201`\3746\236\022\314\007A\020$\350\025\215$\n\020#3NX\033\200\314\374\261\230\367\347\216\366!Z\265\326\215\b\221I\006&"
+	.string	"#"
+	.string	"%"
+	.ascii	"\023/q\217x\210U3\231\314\n\3272\022\331re_\356/\327\371\320"
+	.ascii	"\325\341\2533\311\005\206\006\036\250E\322A\245\t\017I\231z\201"
+	.ascii	"\250T\357\340\243\265\326fK\322\373\001dD\222P5SnM\271\256\332"
+	.ascii	"\275\022R\366\370>\007\0204\231L\323\226\211\020470\225\312\t"
+	.ascii	"Wr\203{\254\267\257x\212\013\246\034\021\306\224\224H\326g\213"
+	.ascii	"l]\017$_\035\211\223\361\030\367\213%\216\304\341\263y6\245\306"
+	.ascii	"\251\326\236\312\2462H\231\244l\240\354i\003D\266\330\201\240"
+	.ascii	"\352\242(: \200\002\231+\353\006\243\001\357\017\023\344\200"
+	.ascii	"\206\0234\036\203a-@\267\341\nc\307\375\213T~X\204\r\031\361"
+	.ascii	"\b\\@J\267[0\256\320.\310\024\241\034\320\356-\031Or\270\314"
+	.ascii	"\230\272M-\266\230\375\330\330b\376:\f\025\"5fu\217\205\255\264"
+	.ascii	"\272.\371\342I\tP*xt\033\221\2246!knN\333p\261g.aE\346\200) "
+	.ascii	"\226\007\222\003\027\300iJ\020\001\316\207a\273o\332\323\370"
+	.ascii	"\020"
+	.text
+	.section	.gnu.lto_.pureconst.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\230\004\003\230\004\007\231\004\b\230\004\t\204\004\013\230"
+	.ascii	"\004\f\231\004\r\205\004\017\231\004\020\231\004\023\231\004"
+	.ascii	"\024\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\265\004"
+	.string	"2E\023 \2405\351\377`U\337\255\252j\254\017\256~\325\371^4Y[\223\231\017\312\326\242\021B\034\3312\005\003\002\202'\275\354o\220\034\202\004\b{{g\305\032\361\330\\\2136\331\341g\007\373v&\025\316\265dW\362&\211\320E\262\023\253\257\n\036"
+	.string	"J\020\305\032\302\336\b\006\202\231`\226\375\001\0038\252i\260\263{T\223T\013\324\350<\330\302>7\t7`A`\354\356b\240\002\352\202\\\257\270\364,l`A'%KP\257}\256\330\302lg\016\3306"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_.lto.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_modeActivationConditions_Registry.46.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006R"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\203\267\316\017yw\350\356\006yu"
+	.string	"\005\001\006'\001\240\001)0sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"[\205\240r\3773\211\033@\021"
+	.text
+	.section	.gnu.lto_modeActivationOperatorConfig_Registry.50.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \205\345\003"
+	.string	"\344\006R"
+	.string	""
+	.string	""
+	.string	"'"
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\267\335\017yw\350\366\006yu"
+	.string	"\005\001\006'\001\004\353\0070sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/fc/rc_modes.c"
+	.string	"\004"
+	.ascii	"[\005N\271\351\231\304\r\240\b"
+	.text
+	.section	.gnu.lto_processAirmodeAirplane.51.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`=\002\325\022"
+	.string	"\306\342zH\300\324M:,|\232{T\253_3\254868\374f\214\307\347\212\204\031q\267\312\344e\001\0053\210+\260E^s\034\222\250\230\031\337\255\0340\377b\b\r#\202\202\2559\211\022\001$\314\026e\2008\2451\262\367\226)\005b"
+	.string	"a"
+	.string	"i"
+	.string	"\b>] \365\231r\024\356S^"
+	.string	"\367\351\323nl\325\347U\206\331?^\233-\203'\035\027Ev\267\213>\207\235\2332*\314\037\021~ \316\2719\227t|\240\210K\0230G\246\354\256\n\224i\224(;*>\0230&\r8\321\030r\241\353\007P\246J\302\262\273\326\017\004q\223\334\266\005\333\rl\315\t\256\331\240\377\036\027\364\310\"\216Q\204\334V\243\354ZL\343\t\373rw\327\321\204\035\325%R=\245ZJu\224j\215\352\233\314p\307}\222vwB#\3334k"
+	.string	"\371\264\333n>\344\033A\240\005}\332\206-\322\312\022KH\007>O|\254T_\344\2638\321\315k6\262\266\240\007\022LCEvk\001Dn\033S\030\035\345\220\177\361\222\250(\374\242_\350\021\200z\236\234<\215r"
+	.string	"\375\321\337\3423\\R\273\336\277\333\374r\031\254\325lwU`<F\313\377\371t\005\031\375'c\2730\243\377J\342JON\304\361mw"
+	.ascii	"u\273\321%\020\255x\nrr\033\356E7\213\367\031\224\223Rt\007\356"
+	.ascii	"\021\306\326C\246PN\251\322p\016~i\255\304\250$PQ\260:\211y\300"
+	.ascii	"\301\0053\315Z\325\264b\\3.\254W\307\242\320a\220y\231\351X\257"
+	.ascii	"\232nE\300\256\f\255W\247\301\345zu\252\232\367\260\311\2131"
+	.ascii	"n2\001\b\217\204\341i8\031g\274\016\017\016\031u[\337\240\005"
+	.ascii	"\315f\2146\376\001Q\2151^'DLC\373IW\242\361\177<\241E\377\265"
+	.ascii	"p\237\032\007\360\340\3614t+/ \200\002\241\252\344\001-m\021"
+	.ascii	"m\353\210\256\002$\005\275l\231M\026.PY\336\261\032H\235_\222"
+	.ascii	"2&K\237F\255\214\201\035M\023\326\351\321d\201\035<\267\313!"
+	.ascii	"\226&\253\271\t\037\333\354.oXh/@{\315[\365\200\254\2216\356"
+	.ascii	"\327^\f\223@\355c\212a3-\274\301\215`\223\314\261\227\301Z\""
+	.ascii	"\036\300uq\n\357]\006\n"
+	.text
+	.section	.gnu.lto_processAirmodeMultirotor.52.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\363\b\r+"
+	.string	"\332G\004\020E`\246U\007k\322\226\256\211\327|\"\241\n\250\007\306 >t\325\245\326\231\274\320\237\216\031\364\363aEv\222Be\213a6\354\352\r\341|\311\314\313|\224\376\374\026\224\220)\341\221$I\222$d\357-\267L)\005\352"
+	.string	"\325"
+	.string	"\363"
+	.string	"c[\216\273\373\350N\030\303\24437#TiA\3408H\207\370\357W\332\275\374+\206;a\244\316\334\224a\205\246JZ\316\316\004\216\333"
+	.string	"\353x\350B\325q\352@\325q\273\225\030\3358\307\027\327\307\356:\356\304\312\353\325\214)\260\264\234s\361\036\361\243\007\201?_\217\267\323\345p7\033\273\2528\275\177l_\217\272\234\300\217V\331|\362 \360\227\225\344}YH\276\227\205\365\274\273\345dg\245\2132\201h1\203|N\213\371\343qV>\376\266\036\331\242\314\036\256\305\344\361lz \310\032\034\036e*I\205eWs\274\313\213\264\230U\277\026\251\353\321U\215;Dld9\3365\245\322a\3169\3355\223\270f\324\337\364"
+	.string	"Z\030>\273\346T*\244Z\242\364.\177\032M\250\377\365(\347\334\257l\332\360\026z\267\257\350n\n\335l\203a\336GH\007dv\236\244.\324\277N\3173\337\277Q\355\026\241\364\256\374+AH\362>u\016\272\303\261\326\320\300\3346\241\372\035\3614K\376Zw/\271\027\023l\316I\243v.\336\345D{\226\343F\301\364\256dR\035\373\035`\346\205\374\266\037\232#\232\337O\267\023\352\257\221n\277m\333\266}\213t\247\337\005\322\357\242\364{\210\277\211\360\367\020\376\026\302\337"
+	.string	"\322\357 \374-\304\337A\374\r\304\337\277\364\333\267~\367\330o\336\372\275S\277u\370;\207\277q\370\373\206\277m\370\233\305\337+\376V\3617\306\337)\376\276\351\367\337o/\262y\376\254\021\372\2223U\373'\223a1L\304\264\340\232`iP0\334\2202\354\023\223\r\273\232\201\346\317\030^\245\035\313-\0139?hG\363;\307\257\t\025\336\225\025T\307\272\213\313\310\250\211A~;"
+	.string	"\307U\020\3345\322\036\307s\027A\215\326\3278\356\346\352\340\356:\204\fWP\352\353v\233\343en\273\2673\233\225\bX\320.\233Qe\257S\352Fu\275\354\033\013\353\035`V\225\203Fi=aj\360a]\306\323l'\345\344\317DQ5Y\3256\274\026P\333\272Q\305W\275>UE\206\201\004@\233\222FM\357\230+\361\334\233^\237\302\001\365m\267\247q5\306\366\254F\272pAu|\257"
+	.string	"\263\252\035\224\307R\271\305\007{\030/p\237\312\363\314\303\334\273\374\346\306I\02354\344\373i\242w1\356[\034\r\0066g\244+]\254\223\374L\006\"V\316\331\250\214\233\321\300\241\303\273\262\203*\346\341\303\273\262\300\205 $\352>\265\2139\322Z\324\265\370\206\257&jy\202\016C\365-b\t\002\t#\005F\013\210A\022\027^4\215\300\255Dd\261D\242\211\311\250\344TT*QLqB\004SQ\311\211E\2218\324M*\226\234\212-\232\232\234\2128'\322\323|\2134\222\025\031\362B\2459\347\034$\242\032\272D\277D\032\272Aa>\242P\220\\@\241\247\001\340\n\375\f"
+	.string	"a7\242\371\307\270x\374\2067ii\347\n\2336\305\231\345\247\236\235\364R\037\365\034>\261\\\301U\360h\371\202.\210\245\234\240\313\223\352\323\343\262\347MOx\021,\341<\317\202W\370O\301\2736\331\344aP\204\n\f\017\330\376.\020\320\357\016\233\2242gWt\337+K\234(B\302\334\017\264\223|M\rZ\004\005\313\242c\253\217\316w/\326\362\210\203q\337\345I\225!K\336'\333\2271Gr\327H\367\356\356\206X^=\307x\267w\344\362=\307.=\274kd\346\245\273\273\353S\201\220\337\022\035\317\321\n\233\003\200\271\250a@$\rE32A\202\244 I\322\030\320\002\031\231\252y\022\200\244%\211\263\024\251\024\024\244\320\376\031\255\374\222\261 \246\017\374\013B\366\234\332\303\031 \247\005I\226nx\311\215o\245\035\304\202\203H-\367\300\215e\245\275"
+	.string	"\215\233\021\265Kb\354\035\270\306\305\215\233\234d\t%>\2327d\355\013R"
+	.string	" \331\324PKb\036l<"
+	.string	"AP\n\272\260\210\033\227&\350\341\374\314t\322\275\t\276\223\017\313E\200(\3369%\223\236\374\216@\277%\352~\371"
+	.string	"\344M\371z\232\003R\241\254v\017zV.\337\242RmY7\232\350\006bv&\024\345cUy\033\357\273\366\016\350C\232\262\225\017\367\232?\235\263\177-\004\2722l6%^\220\210G8\256\324\330\344\354\362d\03624\222\362^&\320.L\305Z\202\324\350\357\325\"\276eZ\373G\366\360\n\321g\001%<1BU\260i-\024\302Z\313x\031\247h\354\367+\226\245\200\371\315\353\210\201\212ai4\324\306\345*\2666\314\200\370\026\200_\354\002\204\232(g\212y\177W\306=\347\225\247A\310\026\263\252f\217!\2751\227<"
+	.ascii	"\006\257\253D\371\322y\336\326\210s,BFG\001\351\177\273b\307"
+	.ascii	"\217$\334Be\277S\245\352\\j"
+	.text
+	.section	.gnu.lto_processAirmode.53.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\350"
+	.string	"u\013"
+	.string	"6\325L= O]8@\261"
+	.string	"\340*\305\343\006\301\007\031\222\216\315\003p f\026\030U:\266\017\231\326m\323\271\203\232dw\204\306\262\001\344\220B\005\006"
+	.string	"\r\231\002i\272i\027[\302v\367\2262\245:"
+	.string	"8"
+	.string	":"
+	.string	"\307.K3\343\237t\r0\364\216}~U\200\204\234\264\262\311\356n\204\237\253e@E\002F$\334X"
+	.string	"<\034\300\223\236\026\302/3\233\354\256\023\f/\334\331mSl\027\260\217 \243\363\364A\305\246\f[\364RE\366u\034\307\321\032\262\237\326\247\363\351?\b\244\276\"\305\256g\234\261\250\253D\007\333\2078c\273\2708\332\233PtD\304\330]M5<\023\036\254,m\213\204<\350\001\237z\3468\201\370h\245\032\241\276`\251\013L-6\271\362c\367\027\354\232\372\016\350\313\321~\351!.\376\006O\300\344\301_>\006\373u\r\220\002i2\336$\026\n\003\256\222`\353\264\255\201\366\300\201\202\212\266u\026M\"\300\034\004J\247E\340\270N\203\210{k5t\300\004J\243\237\265\273\213q%\277\300\340e\270T$^\225B\207\252\262\210tHy\202\343\t\027"
+	.string	"3\241\261(p\200\257\200V\240\035\0308\323\252D0\036\f\021F&`\030\003T\221\324\rPP\213\220\003`\202\001\227\261_\206"
+	.ascii	".\337\323v\202\240\007\344\375o'\024"
+	.text
+	.section	.gnu.lto_isUsingNavigationModes.54.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \353\225\006"
+	.string	"R\f.4@o\222\016@\375\323mE#\242\206\031`_\364\363\303\260"
+	.string	"\3367\261D\361\377f\257\250G\325\310\240\217HUQ D\370PRg1>\273\264\325>\3312\005\277\fG\303Pm\024\236\345^\203{pX\330\270gq\\F\340\nBc\271\210\252\262\034\225e\033\t\033\001\250M|C*r\335\216%:X\254\323\355"
+	.string	"t\302\026\300Q\001\302\322\324E\"\313g\037l\031\337K6\322\217c\303\224\234\f\244d\206J-i2\221x\374\236\247>@\360|5\333\b\025\003\205bd%3sM\243W\361\272\005\351\345\303B\005\023}\212\230\204\314\0341\321\250\267\376\005\277\301?\n\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_IS_RC_MODE_ACTIVE.55.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`^"
+	.string	"m\t"
+	.string	"\346\022D:0\221\322\001"
+	.string	"\337\024\207G39\020\026\365\266\346\346p\2103\235\217\260\016\032\201\267\372\r\233\206\242\302\362\032\3554}\030\030\330\020Mau\302d\006\217\235\013\260\377o\262wJ\0012"
+	.string	"3"
+	.string	"1"
+	.string	"\333\0038\237\266\275\300\200r\352\025\306\372\b\355cf\263[\251,y\3521\345_\366\r%\244&l\251\036;\r\273\353\030\266@ny\333\006\266\035l\317\004\321\333c\177\234\235Z\f\201\314.\353\246\2660\363\345\304\366\355W\224\315\331\037\232.\306\313\374\224\253\240\036\3430\300\256K\346\262[\021|\340\371,\270"
+	.string	"\3473\273\253\207v\351-_\007\333]\320\312Y.|\223O\233N\361\341\247\177\312\330\210\0177\031\022\361\220*s\256\2154\273\252\242$\261\277\355\356Z\276l\007\026\221B#P\002H\241\373\214\0364\276\210i\2573\221F_\t\302\003\251'A+&D%\352\201&\332\r\370\263 \201\024\343\373@\312\325\275|\255d\207\271\030\345\353g\024\236\t"
+	.ascii	"\255\271E\3066\023\307\215\037v$\204c\023\f\341\3356p\031i\272"
+	.ascii	"\346\023"
+	.text
+	.section	.gnu.lto_rcModeUpdate.56.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`D"
+	.string	"\005\t"
+	.string	"\226QA< \345*\035"
+	.string	"\254\2042\300\240\"\210\372\330B\243\353\004Rb\323P\025 \362\324\270Y\254\305,o\262Q%{(\222A\227A\b\341@\262G^\0219Gk\243\t\363\026\311&{\247\024-"
+	.string	"0"
+	.string	"/"
+	.string	"\237\231\027p\237\016m\230\327\326^\246\221!\213\331]*G\036>\206\376a\027P\255P\217\001\r\273\353\250Zu\334\362\266\023l;\330\236\005\257?n\003\037.\234\225]\216Z\200\245M\026\022\333\267_C[coT<\217\207\371%7\t\377:\235`\227\2052\333\255\n\346d>]o\300\005)\211a?faBh\271\374\330OL\276\313\027\247x\325\247\177\342>e\313FH*\326\034S<^6\002\260+*J\021\373\333\356\256%\313~\006y\f\241\317\302\307\323\331x%P\t\242\302\033e\334uH^\350\023Et \355$\350h\002$\242\035H\242\235\003\177\024\036HK\337\007RM\335o+Y\017 \264\b"
+	.ascii	"\200s\341L\323<\206\255\276\325vf\025\320\005#\270\346\026\302"
+	.ascii	"|\002"
+	.text
+	.section	.gnu.lto_isModeActivationConditionPresent.57.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\005\004\305\031"
+	.string	"V\357\245F\260\232Mc\0202>1\221]\375\1772\352\031\231\230\255\002W\203\317\002c\301\314),r^\t\357r\256\321\3356\322\243Z\234\317M\342{\334\235A\177$A\307A<\231\236\261\357\234\262\2719\326\235\375\267\224R\246\024\220"
+	.string	"\214"
+	.string	"\225"
+	.string	"\226\332C\366\313\206-\205s\332gz\222\241\347V\330u\257\022\026(\367\352t|"
+	.string	"\274\305\371\315w[O\340\273e\320`\310\265\353~\034}4\272\361\262\356\325\205\324\207a\257\272\373\233\265\333|\266\322Y\363Y\334\246\322\026Y6\004\340n\025\202\326m\313\013\234m~Ch\334V\bI\220,Q\262\254\362\302\335f\255\b\222\250\220\004\340Z\324\233,;\256^8\242IO~\366\312&.Q8\032\2376=\367^\317\"\234\214\033\274m\031\266C\330TM\257E\256\344S\351N4\266\3166\351h\337@\356\312\225)\017\333\365\334\017z\332~w\327o\232~\323\323N\037\200\206\252,1\007\314\334{\264\225\346V\331\236\220\357~\373Q\264\367$\201\2540\032\251x\223\357\264\240\327\004\311\275\367e{\250\336\247[\201\374\350\302\224u\203\025\326y\236\212/\361\324\205+\316`\260\343\312E/\353\336\253s\353\f\340-\254H\350\353|\322\257[\230\221\320\336y\nd\021\003,yGX\367\336\234[S"
+	.string	"\037U\250P:\255\274\224GXO\345qDw\370\024\037\320\376\271\224\030\245\262/{Q&}\030\336a\020q\342\335=\342G+'d\245\243AzJk\362B4\265l\313.\365\201\003RU\022\323\275D<gb\243\370\223\240z#\246\214m\211\351\336\353\240\311\235\210\360\203\334Zh6_t\353\227\370nOw\226r\342\334\262\017\365\223\007\311H\271g\260\006\034Q\272Q'\340t\263b4\216\251\364P\307\021'\032\007\210\032\242\205r\201\222\323A\235\363\357\036!\207H\006\006\341\363\245\220\001\215\b\262\376\221="
+	.ascii	"\342Q\300\263`\007\006\204\341sl\307\204\fh&\344\023\243\205"
+	.ascii	"1\017\341\210\240\037\2410F3\021\356\024\360\214\204\214\026"
+	.ascii	"\236\230\315h\341K'\236\362\360\225\334\202\325\215R\352\363"
+	.ascii	"k\337\311g\260\252QJ\325\277\366YK\335#R\033\030\033:\372\005"
+	.ascii	"\304\272(\3752s^\351\013O}\225N\370B4\265\266\224v\257\367\336"
+	.ascii	"\373\271\350w\307I\360J]\364.\222ls\313:E8&\226]\017$KGS:)]\323"
+	.ascii	"D\265\341W\254\304,\023\250C\250!4\344\030R\006)\023H B\244 "
+	.ascii	"\255\016\300\002\241\261u\003\022\340\205)\212\2252QU\205v\353"
+	.ascii	"wF\f$\371\f\230S\314\f\275\337\217N\305\252\"\035k\213\004\203"
+	.ascii	"TY\030\200'\nH\225\321\332\035\333\n\b\351%\275X\210\331\021"
+	.ascii	"\252\217\252\001\226%RI\370\244\024\323\016\222\324\202]\324"
+	.ascii	"\361\232\345\226\235\267\233A\244Z\"\301\330\267\311\275\302"
+	.ascii	"\251\347\261\222\307\361\224.'\222\362\375\332\334)\026\bh\021"
+	.ascii	"\226L\005\313\272Q\312\363\325\316+\255\025\302\302\031w\240"
+	.ascii	"\223\205\232\r\375\245\201~"
+	.text
+	.section	.gnu.lto_isRangeActive.58.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`l\001\245\017"
+	.string	"6\236lG\340\222*\035#\025\254\020\007\344\243\032H\263\220/\357^\032U\302\372\351]\362)#@-(,m\307\032\356\370\271 $?\326\233Q\004%aP\t\203RN\214\374\327\327\343[\007] \021\234\213bp\004\021B\244L)W"
+	.string	"X"
+	.string	"S"
+	.string	"\237\357\336\307f\264z\027\257\205\360\316\371\322\302\306\234\345\002'"
+	.string	"\357\331\266\203\007+\263^\302\270\234\006\003\273\375\230\263\fW\305Y\357VY>"
+	.string	"Y\353\035X\342\333\035\230\235\270\031 c\351Hr\324\300~\273\266\310^\252\035\322\234\323\032\223\221\270\275\333\226`\273\304~\031\340k\177\347\345\377Y\335}j\375\324\367\200|\274\230\240\305,\217r\272\344\202\314\032\357\006\013\333\267?c\345\031\211\215\354\337\374\030\267\255.CE\342*\347\210\b2\270\232\202{\276"
+	.string	"\336\023\321\177\276O\316\250\323\303\360g\376b\365R\245\200\310|\331b\026\312\203\276{\340\003\277\235$b[\356l\310Za9.\315\035'E\016\267K\263\356W\203M\307Kqlw8\r]\004=\354\323q)p\316\227\310\247!?\200s\316\257\270\347\253|\367\276\240\230\031\227\346\374\3331\340@qc3\025\210]\266ti\366\273\2713{\325!V\007\243\nE\314P\n0\232\240D\322\2638B0\211\030\210\032\204FVF\023\252\002\312\210B\211\034&\254\250D\002.\205RFS\352TR\"\303\322\206\020u\"\236\302\022\231\022\206\f8\345a$C\020\251\024\031z\312\371n\356\214\302\016\031\232\032\352\263\276n[lwk\222kY:\001\372\331\344D\037\0037\030"
+	.string	"\226\032\341~v\313hO\365\254u\232\315\265u\311\300[\225\214qb\314x\022\017\265"
+	.ascii	"Q\231M\251\013]\303\335n\002\312\212\241\207\220R/\203\202m0"
+	.ascii	"\267S\021\252g\354\246\356\2431\250="
+	.text
+	.section	.gnu.lto_updateActivatedModes.59.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\255\013=<"
+	.string	":e\210\026?@\346M:6\260\001\207zf\303\336Gh\013\234\037\375\374\377ODtq\316d\306\226-\320%K4\326\314\313\301x\207\316OD\271\3341\326\234\t\340N\277~\210x\354\261A,!d\357$\003O\001H\001[\001\201\2369g\033\353\323+\364C\365w\272\331\376q:};)\342\330\344\234\331\247qu\3108\230\025\311h\236/\317\254\247Tr]\350}\334\217\327!\023\320\314iOck\276\341\313\271\331\340i\023\017\367\243\233}\252>\316\337\232\035\216i^N\3739A\326\262\245\223\022\356\316\213\365i7\327\241\233\256\2779\234\366nB\326L\346\003s\356\231\3632\353i/X\237\336=\257R\237b}\250>m\273\037\275\311\226\017\347\226\204\343\3139k\341.XXXRMu\264\371^q{"
+	.ascii	"RQB\250'6\3504\265\002\325\024\337\266\377\366\004l\376\224h"
+	.ascii	"e\007\200\336\r\322\336\365\226m\250\0069K(R\256\024\333\243"
+	.ascii	"\204(\326\223\316R\325\0221J\265\013\205`-\355\312\237P\tC\370"
+	.ascii	"\252<\231YV\271,\212\2456\250\311\365\226V\320\252<-\215nfI\345"
+	.ascii	"\006\365\226W\320+EG`f9\345:\035\311\366)\024\017\341\253r\275"
+	.ascii	"\245\027\024\203_\022\321\347\314\356\312%-\312\201P\256\n\321"
+	.ascii	"\222\350\025\221\233\242\007\266\\\351\023\242\rA\257\356\360"
+	.ascii	"\222G\364{\004-y\361\347\2362\003EZK\213\362\013\344\220s\356"
+	.ascii	"\253DK{\017\337}\033\335\r\247;\b$I@K\340L\202\302\347\363\253"
+	.ascii	"'g\232?\002$G\207;+\003\026\344\305\324\237;\232f\355\f\326["
+	.ascii	"\304y\241fe\352\256\357;5\353\247\36372!\233\262\033F\214{e_"
+	.ascii	"\021\301e\3156\271N&z\371b\352n\232]\314\354>ki\223\235\306["
+	.ascii	"\272\243n\0370\300\336.\300\336&`\365Do\341\345\336P\302\333"
+	.ascii	"O\354mVx;\310\336v\202\272\275\262\267\201\354m\225\275\235>"
+	.ascii	"\335F\325\333\230\275}\203\267\237@\250\226\227\365\227\363\222"
+	.ascii	"\277L\031/\255\033\363D\277\334\357\366\3179\332\375\241\037"
+	.ascii	"E\315\016\377$j\273\2533\251|\306\334#\203\346\207\372\210\232"
+	.ascii	"\355\366h\350z\270\316Q\036\336\215\341\246\256\340}\336\361"
+	.ascii	"x7\324&b\326\366\204\302\320\034%\343FCI\205:\002\205\343\t\205"
+	.ascii	"\275"
+	.string	"\231\227\364\360r\265u\320\261\177G\245\354\352\376]\037\320\003\035/H\307\232\367\254I\2706O\264\365\251\324\375P\365\0034\323G\202\236#\017pn<\256\247_\307\246=\352\356\026\315v2\n\346\313\363\r_\325\263K\275\247\343\361=m\007\"#\231D\320\322(Y(\307\372t\b\327\325sC<]\355|\236\366rm\267\226-\3278\270X\354M\306]\366Ur\227\bi\323\274x\241>\005\342\006{u\212~$\316?\230\222\221\2626N\230\331\237\302[\232\365\0024\2001\243\233u(|\204\352m\247Ba.Fg\327\357oM\356~z\362HY\r\340\31318\0246\200\337\340\310\031\2413\r\036\362b\272@\0253`SJz\230\232b\025[\311\021Q3\273\177=\036'lM1\203\266\272v\315-\322\266\301Q\236<\371$!]\"(~\23667\272 \242\273f\035\235\320\331\346\302\227$\027\365D\365"
+	.string	"\026{c\324\317+\264RJp\2171\356\037j\341\264q\356\225\007p\212\313\232\222\037%\316\0243\273"
+	.string	"&\200e\274\021:\273~\035.\362\203\211[v\363\037\001\254`\357Ps]\323\007,'l\2310\365\335\357\206\372\264"
+	.string	"\256js;\242\213\350\243\247w\025v\271o\022~\336\357\013\2759 1\306w\224\334\324\036~\351\003\220?\226*]\234\241\315\315\316\251\221\037\273_!?\351\206pQ\316g!.i\004&\364d\221\332\233\234\317\266\236\336\256\373\353\221H\240U\221,\231Az\223s\256"
+	.string	"\351O\023}0O\033E\212{\345\n\365\351\361\035)\237 \357_\367\371\374s?\022\276;,}\317\2505k\271\317\207u\002>\212_\306\020NE\032F\242X\032\202\313\007\017bT\221\007\016\"\013\034E\243\221X\303\353\251k\304P}\024\277\214`iq\2148\226\202\254h\\o\354 \222 +\032\201M,Z\370\332z\260\005\301\001U\361\353HB\254xb\314\310\343\310e<\202\215\201}\031\217\\\305\036`c^D\002\355\345`G\361\353\030\026\303KL\313k\206\226\021\214\030\246\345%\266C\313\301\200>\346(\212i\215\035\217bZl\023y\274\245K\\\301Cb\263\026\342\026\004\315ym\303\347\374\3179q\377\333UD\302\353{\"\347\274\357\332\325\022\244\017\246[+dd\352Slwd\n\362\316\203x\234\350\331\271\013\272\3347\351q\277B\276=8g\005"
+	.ascii	"f6\004\277(+\214\031Me]\210%L\257\b\361\023\2419\347,e\205\237"
+	.ascii	"H\210\255\036\347\344s\335D"
+	.string	"=\251=\005\230C\333r\203\347\214\0203\373\242\235e\304\3761\221\231\366@=\270A\374EwJ\233e\3159\267Z\376\3262\267\332.m\333\020\\\326B\034\304On\n\340\254\004`\212\032\263'\314l'\f\3047#\303\tOh\253\243rNj\2732:IX\314|\033F]\361\327\336\366\316\256\337\227\353\244\r\263^&\267I;\246L{\246=\203\265\366\334\204NC~g\315A\3010\025\030\200\355\250a,\006\031c\206fD$I\222\264\006\240\002\021\251\252z\022\240\245E\351\234\"\tH(LA!\373u\23018~M\207\316\372\255\311H\035\226X\322\2548\242^\344\240\257t|o\032EYg\240\325\211\022\367\204&gYFpi\343\226\024\n\201\355e\340\346\022\340\006\211\317)\031.\262\346\234\331\323Mz(GF\235=\276\312#\365\306\210\242\3072\035\262C\320o\363n&*\035%g\203\362x"
+	.ascii	"\367\245\226\232\035{\210\376\325\271\231$\025O\332Q\262s\203"
+	.ascii	"\217\331\251b\374\243\271\036\234\345\243\001,\225K\344wD\b&"
+	.ascii	"\233\225\305\034BDA\214\to\r\031\371\022\241b\006\\3\314\254"
+	.ascii	"\372\373\335\326>\322\022\351#\227>\022,\211\033\230I(\336\034"
+	.ascii	"\302*\203v\334$\r\025\370\005KT\206\355L:\036\324L\324\2420\367"
+	.ascii	"\007CL;4\037\334\335\362\377V\231-\266\001z\217B(ZX\342:hP\004"
+	.ascii	"(7\b\250\277\340\037i7\016@\232\355\210\2019\300\355\017Z-z\201"
+	.ascii	"\233\035a\356*\235\b\365\360\344\356\221j]\217\001\376B~\227"
+	.ascii	"\020\\\213\030C\246\217\031\347\233\244\314\356[R\224n\0276\250"
+	.ascii	"\363\373\350\214\321\232S\273P\007\263\246\221K\212j$\326\337"
+	.ascii	"\022q\n\225\255*\202\274\21722\252\337+V0\272\367V\310\333\276"
+	.ascii	"\337\312b\002|\315bA-)\346\260\027#\255h#\2276n\304\005\0244"
+	.ascii	"hk\020\315PO^UX0h\210\005\242%\351F\037g\332\263\326\325\036"
+	.ascii	"6o\315\fz\267)e^\340\356\221\220\270\372\243\232\357P\b\214V"
+	.ascii	"z\200\266w\336\320\202\363\243D\362\037\365\f\270\321\242:\017"
+	.ascii	"\247g1\241\246\232h;%r\376\216\3358\2079\224y8\242\240\354R&"
+	.ascii	"TW\003"
+	.text
+	.section	.gnu.lto_updateUsedModeActivationConditionFlags.60.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\373\005\265!"
+	.string	"\266\273\320I\200\234Q:]\230\360\f\242)9uL\215\360Y\337\321\266E\007\370\235\371\0240\331\365C\221\254=\035F\267\222\227\206B%\351\335MU\271FPd\265\370\356T\016\231bA\017q\374K6\224SG\033,\277\221F6\331;\311\267"
+	.string	"\257"
+	.string	"\304"
+	.string	"H\027g\322^\030\362Z\303\201\2172IFv\216\273'=\306\341\330\365\213\375c\253\307\270\246\335\225\034\353\350\306\366J\221\230\322dr\310\3149\353\216;Az\234{\016z|\036\207\036_\265\217\272\315\374\b$?\351\244\2245\226s\346\335\037\215\363\363\370F\355\321mj\215\226\316P|^{\324\267W\311\240\020\351\266\241\252\243\366uxZ\216\364\013S\323\231\273\372\001\"LNvv\336\027c\303\233P\351\224@\246\024\346\307\333%\341\317\242\265!7\216m\374\274\t_\234\271\234\263*\004\332\373\343\025X\215\t\no\334\316(\344\234\333\006\2054\336"
+	.string	"\336\335\315\356\356uc\247M\365>\353\271Uyu\307pa\365\270\255\373\215\237"
+	.ascii	"\265\3326\375\343\317#QVie\263\n>\204\352\376\342\243\370n@r"
+	.ascii	"^\037\354?9\224\023\375\251\343&\362\331\007\217\373>\364\270"
+	.ascii	"[\205\221}\260sI\027\251\255\262\352K\266m\272\217?{\211\335"
+	.ascii	"\037@\265d\331W\252\373\3067\316\332\266\335\370V\261\355\032"
+	.ascii	"\266M\303\266Sl{\206m\243\3276\276\266\317\323\366\275\266\355"
+	.ascii	"\265}\234\033\323K\204\257\234g\224\271\311K\334Eu\343\337\375"
+	.ascii	"\255\006M-\374S\216YH:\271\370\222~\023\025)\005Iw\037\235y+"
+	.ascii	"\237SV[\305\261\034\346\316\332\007w\t\347\355\205\252\267\207"
+	.ascii	"\f\320\222\225EQXm\233\2379\347\214\342\356\215\317-\270zq\367"
+	.ascii	";2\254,\3067\214\317\016\030\230\007\321\374>\350y\361- &i\307"
+	.ascii	"\317\226\265\370\322'\355r\336\235\260\256\346\360-\035\256\216"
+	.ascii	"\341X\226\226,\367>\n\262\306l.\233 oJ%o\202\361`:/\261\355\375"
+	.ascii	"-Bj\001Z\262\356\366p,WF\\.N\276\254\330\3733A\222\207Q\334J"
+	.ascii	">\267\366\207W\001\221v\2078\225\021\276a\232\035\305\234\201"
+	.ascii	"<\307Ov\233x\027\2113Gl\315/G1\347\f\201\353S~\200zB\350\361"
+	.ascii	"\357\2030\254\325\226u?\353?\236\006\325\344b\303\fP\025\225"
+	.ascii	"\265\216\323R\272\002#,m\342\007m \241\bA<\fx\032\354pZ\b\005"
+	.ascii	"\241\030\302\335\333\031\t\005\371\210~zE\274^\t\036\212! \""
+	.ascii	"^\257\310\210\267#\320\276\024BE\274\025>_\021O=\256\277RmU\335"
+	.ascii	"mK5\\"
+	.string	"h\013n\273K\033\304\226\353\375u\355\366\231\027c\321\237\352\n=\366\301\036\364XD\222.\266[\273Wz\263\3322l\273D\032\216vu\224[\254z\211\351\2751\236\212 H\257\2162\013\272\304DR\273\304\376\005\224\311\352\242])\260\317\356\235\361D\225\316\256\216\022\313\022x\221l8\226\314\224\005\212\336\333\364T\2054`i\277\200vg\320`\037D\357\017\024\360\"\365\257^S~\315.\261U!\030w/\031\253\273\032p\250AD\344\224CfFDDd\244@i\f\240\002\231\261\252m\022\240e9\307\235$\301\334\024\226\206\375\016_\004\374\342\336\032\005\224C5:=<[\312\235\317:\336\271yo0\027?\2012\347kZ\203#\220\351=\304G\326=\355R\315\312\203\300\252_\177\243\\\372n\234\236\177\307Y=\212fhnEGQ\bPf\n\374\313AA\263~\006\221\323\231\264Y\0263Y,`"
+	.string	"\002\024\325\034\351\235 \260\t2gXP\344`\244B&\271\336 \002f\035\020\013\266\377\016\236\263\203\206\374|\203S\2107X-g'$Qh\237\316v\\\350\305]\004\227^\231\024\205ZqM;C\272E\247{\002Tx88\220\\\241\304XQp\226\037|\363\332\026"
+	.ascii	"\374,p\277u\353\026!d\217\017\037\037e\334T\022\263A\037\231"
+	.ascii	"\013a\361\230\314lv\022\353\017"
+	.text
+	.section	.gnu.lto_configureModeActivationCondition.61.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\220\004\375\031"
+	.string	"\246m\243I\260\226Q:^\257\207\3006\3168|\255\307\364\364SJ"
+	.string	"\242k\002a\0326b9\005u\177\006\024\033Yy\243\363\016$A\262\331\262\200\376\227\031\352\267\263N\214w\036\374\274\272\363\362\215\273\366s 7\271\306\222O\b\221;\245\212"
+	.string	"\206"
+	.string	"\223"
+	.string	"0$\374\246\200M\307\227\316\235/I\031{@E\002\303\303Ev!?\352}\b\n\n\253+~K:\347K\030\025P\245\201\203\336\203\b\035V\177Q\204\032\236\310\3500\005V\261\326\341\002_8_\n(\312N\355\033\375G\357@l\264\253\326\031N\212\265\326\005Np\276\304y\215\371\222\374"
+	.ascii	"\363\245{v\226\017o\324\023)\002\036\035k\255\261\265\361\336"
+	.ascii	"i\317\177\221\273\202D*N[\024j\255\246A\242\027\367\3366\002"
+	.ascii	"\333,lRI\257!\002\233Z\354\3302\263O:\216\217Z\231\022\277HU"
+	.ascii	"je\017\177tk\330'\353\322\260\217\364\323|\310\037\340A\376\327"
+	.ascii	"\207?\200\003\371gL\352\230S\273N}\236\272uj\323\244.OM\236z"
+	.ascii	"OMO}\002/\027Q\023\236jm\221uU\241J&\035IhOG$\264\247\036K4\247"
+	.ascii	"\243\005\"ET\006\272\021_\211\346\324\243\326*c\273GV\244J\346"
+	.ascii	"\360Q4R\360\262FIv\372$\240\037\261\021C\365\005\302cy&)Q\202"
+	.ascii	"Z\310-\327\346\b\030\246\b\205\244"
+	.string	"x\263K\356\001\343PQ\320\025\335]\003P\206d\374h\226a\024\306\243\265\3426\232_\273f\243\017\322\305\031Z\025\016\260_\233)\3000\224\210\365Z\033\367'B;B.E'M.\004\007\261\270D\264\222\002\260\266\2107\245\330\021R\311\230\235h\363\234I\217y\023\325\3457eTk\205`\374\022\022~\216\227\316\355\350\203/\375\023\346\313\007Vb\370h\226\375\244\277\310;x\031~\241\"P5\343J\001\036\321\023\342\246\303\2319\024\034~x\265\037\237\263\004N\247\253\215\250\020\004T{\3352\230\256\341\"\334f\ff\262\034\232 \334M\227\301V\313\235\266\345\370\340n\273\\\b\033/f\343\211\351zj\271\230\215\347\023\313\271\361\316\004\216\027\373\331\355x1\231\241\357d]\032\033\210\240|\373s\314\332\036>\205EgGx\245\344\212\025\327\306l\253\212\211*\t\323\243~\256k\rT\r\025\035\352\255=\267"
+	.ascii	"\326\237~\247\233-\2325\327\306\230%U\256\375\341T\204fUl\020"
+	.ascii	"\237\242\263\023V\250!L\247\0202\204\314\314\214\310\204\245"
+	.ascii	"I\033\340\002\021\252\231\016\022\340\025U\007\221A\242sQ\245"
+	.ascii	"-\254\277\003i\200\241\341\022\314\233\255\366k@\360\3171l\022"
+	.ascii	"\273W\036QZ\217q\217\352U\306h\266\326'ig\033\237\3153lvZ\b\271"
+	.ascii	"\311i\332\245\246N\237\027\311\231\002\277#\231\216\225!wH#\223"
+	.ascii	"T^\256\\|\271\273.C\024\275\200\316\301!\016\225\035\211\351"
+	.ascii	"\003\220u\326-h\252\016RM\030\352_\253\253i\333~X\025\203\260"
+	.ascii	"\363s\022s\234\326w\320\216U\250y\246y/5'\253\300\277\247q\021"
+	.ascii	"A\364\033\f\nv\177\361\312i"
+	.text
+	.section	.gnu.lto_isRangeActive.part.0.81.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\376\002m\026"
+	.string	"\246*\220H\320\322(\035\253R\b\321.N\261\216\225\334\215j\304K\030\f\253\205\205 \273"
+	.string	"\247\334\314\272Sw\250\376\370\261\315\354\225\203\347E\255\277C="
+	.string	"\265\365 \023C\322A\363\206%\\\342R\017?\372g\3777B\310\336R\246\024{"
+	.string	"u"
+	.string	"y"
+	.string	"\323\266\2731\320\035\300w\031\236\365]\372#p\256\233?@,\034,QO\364\0218\3369\205B\260\230SW\340\322\004\302K\373!\234\2422\003\262\355\024\225\034\353\\\307\341\3479\016=&x\314\251k]\356\206\353\374\223q\025\324\361w\376\201-rG\007\0307\334\205K\275\341\202\036M\270\n\272(\234-\226\3149\337\273\372\340j\252\253\203`\313\234\323!\206;\274\355\t\266]\354\035\020Q-\022\325\252\250NE5\212\244\016\211\352ST\233\242\272\024\325$\222:\374\356\007\317\273\277P-Au\214\352\215j=\321\377"
+	.ascii	"\253V\2069\177\216\200L\r\322\305\207\363n\2377\363{6yv\0245"
+	.ascii	"\006:/\307t9rc\261\237\3027\361\0239GQSB\323M\240\004\035R\210"
+	.ascii	"0\271t\203\360R\245g}\236\351\246\005#\026\251\337\371\272\223"
+	.ascii	"\310y\t\033\001\252s\316\235\335\234O7v1l\352\303\337\236\300"
+	.ascii	"ZiM\273E<B$\244-\355g\203\007DM\217\034.i\337cd\273\276\342\025"
+	.ascii	"\316i[\361U\320\300|\0176{B\203H{:\276=\357%4\375a\271\337^\307"
+	.ascii	"I\343\3320\022\3647\271%\266\335\361n\334\265\021\357\242Ow\367"
+	.ascii	"<B\265\325\005\203\364\030\321\364\310"
+	.string	"\357\275\324\3131c\352\017\335\234\027|\234;d[\315\262z\0250\233\030\227\203\327\t\006!\346\222I\273`\b^V\f\254\034@\031\271\201\275\304\026\304\300b1W\004\00576\256\224_(5\260\227\031\031\227\227\254\365z\320\212\301\270dZ/YM\013\205\304340Y\213\302\314\214\254ez\234;\264\222\253e\231\265n\241m\355\333\2345\232\\\367\344\"\353c\213\354j/7\347\375\306\035\262jO;\013\252\261\223\361\026O\255\352,\216\332\324~E!\213r\371\213\2205\321d\364 \332k< `\002\031\223&\017\226#\334c7\3556\2273\326\366\262G\260\221!\311P\257u*\031\364 \217s\"\224\372r>F\333\270G\223|\270\222\202\201C\217#L0!\330\277\260\017\302\202(\004\246A\002b\360\270\213\2601\276\315\377\002;\321\032\346\204#MID\017~Q\252\270\314A:\254,\367lrA\235"
+	.ascii	"/\226\n\256\035\217\f\216\256\342\361J\204\333\340|\230$\203"
+	.ascii	"\227s\257\205\007,Z;\316\367P\212\247\327\255\327\2061"
+	.text
+	.section	.gnu.lto_.symbol_nodes.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`X\002E\017"
+	.string	"\024\027T\003"
+	.string	""
+	.string	""
+	.string	"\0023\177\"\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005*\025\301\204\001>#`4\177$\377\377\377\377\003\302"
+	.string	"%\005\300"
+	.string	"&\301"
+	.string	"'\002\321"
+	.string	"\177(\224\202\202\200 5\177)\272\220\202\0026\177*\005)+\300\003\0027\177,\0028\177-9\177.\354\331\276!+/\301"
+	.string	"\002:\1770;\1771\310\376\366\013(\032\300\003\005/2<\1773\340\301\257\030\002=\1774\00525\305\204\001"
+	.string	"pg_registry"
+	.string	""
+	.string	"\00506\005.7,8\001\303"
+	.string	"\1779\037"
+	.string	""
+	.string	"\200\220\200\001?\177:\304"
+	.string	"\177;\306"
+	.string	"\177<\305"
+	.string	"\177=\307"
+	.string	"\177>\003"
+	.string	"\032D\003"
+	.string	"\031\320\360\372\250\001\001\344\001\003\003\032\244\001\003\003\031\263\357\3407\001\304\006\003\003\032\247\323\317\t\001\204\026\003\003\031\367\270\226\003\001\244\027\003\003\032\346\365\313\020\001\204\036\003\003\031\262\362\274\005\001\244\037\003\007\033\244\001\003\b"
+	.string	"\302\001\003\b\003\234\201\232\361"
+	.string	"\001\342\006\003\013\031\017\007\310\377\241\372\020\035d\304\001\003\020\007\313\216\326\364"
+	.string	"\001\242\017\003\020\034\203\266\232\021\001\304\037\003\020\034\263\312\2726\001\204c\003\023\035D\003\023\r\342\022\003\023\r\360\340\227\f\001\242\023\003\023\r\270\360\213\006\001\342\234\370\205\003\001\242\026\003\024\036\344\007\304\016"
+	.ascii	"3 p\002)t\307\003\256\340\235\203\326\301\230#dV{\376\335\341"
+	.ascii	"\t\036\337\302\016Y\313C_\305\001\331\243\356\033\034\353\\\220"
+	.ascii	"\236\023\340\222\306\004p\211\023\020\235\226\312Z\030\205\275"
+	.ascii	"Y\320\r\030\324\217\317\2066\211&\314\335\020$\2715\266\210\361"
+	.ascii	"5\355L @l\204\331?B\2224\004FsA\325\215e@\240\335p\006\032\\"
+	.ascii	"\264\331\230BJ\203\201\363\006\033\245\365\236"
+	.text
+	.section	.gnu.lto_.refs.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375 \3725\005"
+	.string	"\362\316&(\2009\205\01630\315\005<\223\030\211\221\030\211\221\370~\305\303\310F\002\276\260q\351\227|B\244\267Y\242\356nMZ\222)V\256\247\003\216\246\254A\315\251f\244f\243&1^\232i\201f\005\322\251\364)uJ\207\006p(\305\246C\244\f\220&\224\n\224Z\312\237\207R\351\244\024RJ\026\276E\346\333\2317B\346\373\230NH\254F<\205X\037\266\r\353\302Sa\275l\021\030=hh\301J\360\034X+\f\225\236\321\372<km\2663.(B\317\311*y:\253c\313P+\002\002"
+	.ascii	"\004Y\332Z%\n"
+	.text
+	.section	.gnu.lto_.decls.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"(\265/\375`\312%\r\251"
+	.string	"\372\013M;X LI9\351\246L\327\337\271\352\353\353\272\253\272\272\372\373r'B#\022"
+	.string	"\220 \"B\326\212Uf\244\276\263eFk\336s\023\236\324\0059\217\214\374\212 &\034`P\340\367\245D\223\323P\035W\371\364\276\022\257e\361\201\332:\213\366_\t\311\251\0333\276\333O\266\224)\030\003\247\003\273\003IV|\3510\315\267\235}\337\274\266Y\222\246\326\244MN\303jx9\3041\234\327p\223\343@\245wLG\211\334\223\2706\315v\263\347\241\036\017\365>\020\235\321\364\272\244\334\200\201\315\342\035\231\242U\326&\3435\227a3g<&\343\203b<\363\336'\346\rx\2307\260Y\003\362$\266f\355\352Uz\311\265Y\227\n\365W\261G\0202\373\002\217\341%\323\261\030\376`\216\t\035\207I\357\324\215\226\231U\227\320\206\r6b]Vy=\363\215\303\276_\330w\013\253\301BE9\373\372\"'\202d2I\233g9\216c\345\005"
+	.ascii	"\217\325\262kF\233\f\307]xi\001{a\273\035F\2526\337Fk\202{\363"
+	.ascii	"\362\330\202\036s!:\277\001\365\220\311\364\3664\300\007\016"
+	.ascii	"\2576\353\026\013n\\PS!\207\033g\341\271Z\273em\236\2338\351"
+	.ascii	"\342+\254\205\255p\033\263q\025^r\026^;Oa*"
+	.string	"\357\364^\250{\3579\205r\263D+\b\177q\026\016\343%5}bU\210y\321}\020\005H\231\231\021~\242\306i<E\237k|[\201\353\336\364\013\370\211\376\017\037p\026\226\302i5\345\272\30675\016\3068\027e\316\334\233n\020\332`\263\202\r\214\321\307\374\023\016\352\345\360\022{Nb\317B\354Y\005{\226\262B\034\324\373\b\254\006L\370\214\227\0310\332?|\360ZTr\277v\326\030Y\223\246\315\013\3559\203\036\347q\006\275w\300v\300A=V\302b\274\324\300dg0No\363\224\336\364\336\264\247}\304`&\326\346K\260\276\013\236\356\007\277\300\2365\364j^\036k\350\275\255\017\007\365\232\201\222d\320\223\302\220\302\321\346\317H~>\302_C\365\030\245\274e\367\246?;0x1v\265\371\224\203z\226\201z\\\326=\342\347o\032=?si\326\320\177\320\337u\033`4\327\340\357-M`\370\271"
+	.string	"?\237\371\231\351\207\315`\301\313\340\202\177\370{\355\347\n\224\261"
+	.string	"\317\3372\376\217\371?\347\303@?\223I\202{\316\377\273\037\320\337b`\276\277\205\230\177o\201 \3468\177\253\300aDX\001\363\377"
+	.string	"B\307\340\034\374]\202/?\247?\313\215\375\234"
+	.string	"\r\317\36071\330\305\003?o\375\354\343\347\036?\357\3709\307\317<~\006\002\367\263\325\3178~\326\372\277\363\327\020\374\374\366s\333\317N~6\373y\371s\330\317^?w\375\314\365s\220\237M\374\334\364s\360\347\017\374l\201\237\225~\376\375l\3643\007~>\341\347\022~\306\300\317#~\026\361s\210\237\035\360s\321\317\f\3709\204\237\017\360s\320\3772\377\353\376{\371\037\367\263\007?\177\370\271\203\237\023\360\263\357\347\376y\303\377\274\377d\377O\370\217\366\363\320\3176?k\370\331"
+	.string	"?\013\340g\f~\256\340\347\336\317\365\277\231\377v\377\277\374\227\373\357\366_\313\177$\377\277\376;\340?\333\377\236\274\274\274\274\337&\371\367\300\374\001"
+	.ascii	"!\\V\005\020\027TM\345]\245\307\330\302\2174\251\235\256\271"
+	.ascii	".2~X\237%E\214\307-e\331R\030\217[\334\224\303oj\330\fh\324\324"
+	.ascii	"\032\312\b\031\220\2446sm8\352\332\204\202#\204\005\255\2506"
+	.ascii	"\177\203\302\006\245p\342D\350\b\322\222\255\261\022\003\317"
+	.ascii	"~\331i\313F\353\335\313\251r\n\t\004G\326id\215f\213\031\326"
+	.ascii	"nr\350&J\316\213\222\2637\032\343\361\214\2712\223l\263\231p"
+	.ascii	"Z\357+\b\234\013m\276L\233\365L];8\2632\037-p)\353R\23451`\255"
+	.ascii	"hs\t\213\261\321\242\201w\345\354{Q\254\216\230\242\267\230\030"
+	.ascii	"\313\265\222[\225c\344\301\203\244\354\007\0303\313SV\364\016"
+	.ascii	"\013\023B\267\343\265\002\212($\326WW\304\313\006\353\026Z\311"
+	.ascii	"-\362\274!\231\252q\346\336$\207\316\002\203\341E\233\357m\331"
+	.ascii	" \027H\220\264\021N\336b\235\007BzQ\326GF\321\373\310y\331G\032"
+	.ascii	"\310\b\312\247*\016\242\244/t\235\271\267\n\007\036 d\246\220"
+	.ascii	"l\261AWE]\244]xw}\331]m\304\336{W@&\221Cm\344c|\367b`\303\205"
+	.ascii	"H\020&L\354\377s\357V\331\244\367\211\321w\266\331\341\312\004"
+	.ascii	"\270\027D \275E*pdzW\262b\220i\363\376\336\242\022\371sL\307"
+	.ascii	"\262\220G\250\254\030|\034\313\242:\216e\025\373\210\345\211"
+	.ascii	"\ny\263\212\366*\251\354\361\351\3361\345\245\322I\263\356M\263"
+	.ascii	"\2126}B\336c\232\245\3749BeQ\361q\354\"/\324ERp\274\227\352\216"
+	.ascii	"e\325\361\361f!\217cJ\252\237\013\325\202\225c\030)T\f\244\214"
+	.ascii	"\314\212\332\021\352\272\b@\027\224\022\351vL\225\374\344\336"
+	.ascii	"bY\212\213\344\364\336\254{k(7x\002\025\244\370\304\350\346\342"
+	.ascii	"&\t\225\026Y\206\224QK\211\223\032\257\333\221\210R)\305\275"
+	.ascii	"rW\312\203\"\027\323{\257\212k,\362\275)R\344\275Fe\nI%\303"
+	.string	"\251@\336\235\013\365\024e\324R\372R\030\225*.\221\033Lu\034\323R\022\251\221\215q]cZd\256+\227\205\264c\305\364\036\357\275|\267c\246I\2273m6\021\241\233\037b\226im\336\246\312\372|\025\275\207,{H\327\030!\275\305\234\025nH\0167\357l\007\351\025xy\266\346:\017\024\025flb\354O\300g\353\365\017\034/w6\312\336\254\017\224\242w\217e\367\350\024B\351\255\2729\343\3622\344\314E&9\364\220a\245\360j\363&\021\233~\371\246\246|(w\350\260\221\022#\005\346\243\353\n\323\312\261e\264\312Q\326&\016^\366Vk\335\255VvV\rCZ'b_\350\370\nK\032\3064o\276\260}cL\2324\034j\354k\027\213e#v\305\353\251M,\0335\330\214\025#d\332|\327\370{F\323\340\264\024\356\205\252IR\324\230\321fo`\240^'\211\3362lX(\315\226\264\211"
+	.string	"\006\212\3210\210La\261h\363EZ\226\003F\305\324\324\231m\253f\321R<P>\027J\253\tWSuU_\361\262\255\332E\223\266\352\025N\372\330V=\325\310\232r\331\026\306*t\0336\330\027l\020aa\315:!\037\f%u0\226\366\325GG\341(g\210=i\331nqS\211r\247>\301hs\322\346k\r\373\032e\207\336*R\350\274\275M\255h\023\205\020\373\270\021\243.\317\376\r\345\263s\001\353I\233_@?1\f}k\030\022g\206\026\r\272\277\215\274\354\247.\336L7\b\345\004\037|\256\253\210\227\2476+\333y\222mP\350\254\324+?N\016\013[c.\214\261W\200U\002\203\212\252\315J\345sMd.\252\256\315:\345k\276d\334\031\035-\244f\321z3\266Y\243\274J\371qp\240`mey\201\362\343\3340\361B\203k\213\275\357\212\375IrvV\235\230\335"
+	.ascii	"r\267D\253M^\235\350|\305A\301k\263\242\325\264\033w\005\013"
+	.ascii	"i#\314\244I\233\330\0374K\226T3!e\261\216\20327\336\310\344\\"
+	.ascii	"\245a\310\312^\315\342\370-\310\\\325\016K\001\227\230X]\n)k"
+	.ascii	"\334\026.E"
+	.ascii	"\272v\264T9\251c\257\313\2352K\267$@\262L\251A\323\346}FK\001"
+	.ascii	"\262\350\253~\3250Vr\247\230\007\025\330\2143\367&\207n\312\222"
+	.ascii	"\230q\251\351k\230iU\365\202X\233\025I\005\243\373q6\325`Ir\246"
+	.ascii	"\232H\251I\307t\326h\301\2222t\026dxF+\326\247K\321\253W\365"
+	.ascii	"j\271\021|\356\325\002\303\321\362\201vV\304\372\234\251C^\273"
+	.ascii	"\352\220\032\244\207L\3416\3112\206\256\267&\312\217e\233\265"
+	.ascii	"Hu\241\266P\211T\026t\256\354\017\212\242W\256\312\325cL\264"
+	.ascii	"'6iV\252\342\354\354O\262\210\215p\243y\225\342e\243\251A\352"
+	.ascii	"1y\255:\314\325\340\340\233+\202\306\325&\220\024\n\355\256n"
+	.ascii	"K\027{\376\252\252W_\250^T\253/\271d\235Q\244\rF\265\342)\376"
+	.ascii	"\334\213C\013W\216\372\243\372\250<\252\216\332\203\227uG\245"
+	.ascii	"\361\352\242N]\250\356\2501x\t\273\355x\300W\026\272\212\334"
+	.ascii	"QkT\034\354\226\364\271PM\346\3506l\310a\221\345f\203\307\254"
+	.ascii	"\372\034\006\306\343\bI\302h\325-^V\034\027Jo\305Qm\324,vK\246"
+	.ascii	"\267J'-\254\b\322\202\r;vpr4zY\365\006Z\252\343\256\315\252\274"
+	.ascii	"I\306`CA\004\213\227U\005[\246K-\315\347t\250\364\320\022b\237"
+	.ascii	"\343\303>\007\313V\031\266\013\235\215\234\244}\316\225}\316"
+	.ascii	"\224}\216\n\373\234'\373\327\253j5v\205L\226j\305i\375\326\026"
+	.ascii	"e\\c}\030\250\247A\312A\275!\006\352\325\025\265E\2152\222VD"
+	.ascii	"\201g_Y\\\240\207\226\263\257\365\252\212\327\343\217\323;dL"
+	.ascii	"\271\253\263\257(j\n\244\334\225\362\305\276B%QM\ri\263\032m"
+	.ascii	"\n\034,\032l\272\200\234Mi\363\325\370w\f\275\246>\355\324\030"
+	.ascii	"\202c\253\315zk\361\365\251\363n}\362@y\357S}\352Qs\357S\017"
+	.ascii	"\363\006\314\033\230^Z+0\351\231\307\241b\357\306A=_\032\242"
+	.ascii	"\267\032\031l7|\264\251\203#\304R@fg\327g"
+	.string	"\342\274\270l\242ta\331\231y\237\251a,\344\260\332l\274\257\355`u9\3366\273LK\365\24041c\244\315&\303i\026\314\306\323]\nU\336\262x\211\t\306B2G\233\307AZ ):\272;_\033\230\214\027_\254\317\232\242\267\0301=\306L/\025\005Rt\214&\007\217\031s\365\b\222\271!L\354m\016\013\264\005\006\f\225\036UU\310\332\274\245\262>Y\212\336o\274\354\267\226\343\231s\273A\343\321r\177\303u\227\326\321\312\020\254\361\232\322f{!z\307\351\234\261\305\260B\233@\f\324\313\271\312\03316\003\215-[\272\212\332\023\234/N\246\270\235\331\fbW\332\355Jk\341\213\2747Y\264<\322\345 \251\352\002%\313[KO\214F\214\2676\033,%\312e\033\026\023\213\n\227\037(n/\215\216(Pl]\364!\301\244x%\261\031\264\024Mi+S\272\212-\202\005\347\022\211\037\3524b"
+	.string	"J\350\217)"
+	.ascii	"A\340o\210\022\203\302#\234 p\210\022=\234HNKGA\240\207!\321"
+	.ascii	"\311C\005KKN\301\2400x3\002a\360\246\304\357\\2"
+	.string	"\321\223\310t2\365\320\323\204+u01\364`b\bt:-\3754\200\236\02401\374\271R\207s\350\204\376\316\022\036\202B&\246\f\320\223\002(\220\204\016\001N4\tEl\200^\251C\223\223p\230d4<\321\223\3517\3745y\340\340(\3504\001\364$\352\004K4z\022\317\244&\037j\024Lj\262\t&5U\223H<\207HH\277\233\023M\302#s\2106U\2443\230\004\\\372\335 \235D'\363\350$\336|h\224\324\344\033\376\224\216\314\023C\224\bL:K0\3009t\322\200\210\302\001\320\002\020\221N\364\347\224!\004\221\0034x\022\317a\006\210@\rN\364\207\324\204\202O\002\032 \341\004\021!\214$\020\001\f\2140\022Q\202\221\t$\374h D\0171\t(\202\337\005\222\202@\"\nD`\005<;\035t@\207\277\246\016'\021\230\001)\370cb\302I\n\002\231\206?\035\246\023%\2360\001"
+	.string	"C!*\034\002\321%\247\021BW\352\220\004,q2\001\321\240\323"
+	.string	"\210I\277\245\t\234\350\017%\346\234\301\337R\323\020\030\"\004\221x\036\t\207M\025\374\b8<\203g\222\275\007 \024"
+	.string	"\002\004\0237\007A\204\016D\350\240w\020D \"\022\001\004\221=\b\242\212\016\317\f\240A'\241\b\244\023X\002xt6\021\005\200\032\235$"
+	.string	"\022{\250\321\207\005\034\201\200\370\0331\342h\230A"
+	.string	"\247\221\320P\210\376\206g\023\006*@\2076D# RP(\"(\004\242?\021"
+	.string	"\321\243\020\026\234FH$\230\020\222\270A\"\241g\342D\n\222 \302\204\323\257\007%\032\201\200\370cB\201\0200!$\341C\215\320\340\311t.I\340\304o8\374\241@\022?D\024H\302\\\022\n!`d\203^\311\002\244\340yC4:\223\202\277\022\226\316`\360\247t\304\323t\242&\240\303\037J\304\271\271R\207#\f.l:\207\036P\241p\350A\207h\224\004,\021\024\212 .\t\207hP(\342hH\201\035\301\357\204\217(lBZ\022*\031\241K\277\037\244\340\217\004\322\357D2B\215\220\200LA\250\021\b7g\323\211\023\222\202\300%\244\340o\004 \324\b\004\021\032\004:\331\377\316\020\220@t"
+	.string	"\202\250C\206\207\020\202\b\rP\270"
+	.ascii	"\005\354Q\007\242\321\321\320\303Q\t\017A\340\217\311\303\321"
+	.ascii	"\220\350\241\203\020\322\222P\211x.\241\250p\250t\302\211$d\032"
+	.ascii	"\002\177B\306j\206\243\302\217+8\363\251\276\361\310\223r\327"
+	.ascii	"f\320\227\032\263X\325\230\027\247\030\246\306\223\030n\336\274"
+	.ascii	"\236\215\245\327\013yu\rX\0205\266\027\365\255mG\331Y\232*;u"
+	.ascii	"^x?\3208a\201\365\345F\233\346\021O\007\231\030\036.\026]1\332"
+	.ascii	"L\233\033X\036\017\274F\353Ye\301\031i3\345\001\342\202\207\215"
+	.ascii	"6\203\334\352\230J\246\216\251w\214D\336\025\300(&y5\364\327"
+	.ascii	"\027^\357\252]\016\025\230\235\224jW\353f,)\302\344E\312[TTT"
+	.ascii	"U\272v\301H3V]\206\314\0311\223\261C\253\3154}\202ev\025\246"
+	.ascii	"\205\035\255\271\027\216\200\001b\315\306\270\265\370\322\267"
+	.ascii	"\252Y\023\027%\027\346c\022\346"
+	.string	"\b\\\\]\366\310)\267\242\274\214I\366\210\222\243\213\\\336\0262\3126\177\260\264h\251o\031\324\352\300dy\253\262\343\302\345\365m-\205\0302\\\332\254[\276\226\306\f\f\256\315\352\366\265\263e\321R\341k\346\013\265#mm~G\312\376\\Q{]S\253m\325\213\357\026\225\334\251\033'V\342\260\234\271\307\344\220NX\213\260-U^\333^\261|\b\203\005\250\202\3218\207\362\224R\310\220\320\210$I\222\306\"\n\020\004ci\236\t*\037\022\240$1\022*\310\314\320\210\210H\222\024%\323v\3345\344\324\271t,\333\003\265b\f\276\030\204\221\003|r\002\347md\307\205\242\326.wfaQ\322\033h\2525\331\303\250\\\226\222\345\254CD.p 3\255\232\265\022}\022\031\242*F\371\"\343J)\247(m\335T\345\321\246\222c~vP\031\252\025\306\251h$\001\245\227\\&\332\272\236M\250pL\206"
+	.ascii	"\241\300\013\221\275\354*Xa\300\340\320\302U\004\351.E\266\241"
+	.ascii	"M\222X\303\244YI6\34249\2222\f&\003\236\370\366\021\0226\272"
+	.ascii	"\236\214\207"
+	.ascii	"\362D~\020\220a\001\373\0262\035l\2452\251+\227\206\027\316\217"
+	.ascii	"k\236\354\306 \nu\022\310\354B\034w\341pq\256he\025]\252\rx\326"
+	.ascii	"\212\002\r.I\0243\207\261\302iP\213\024\"E\366$Od\332x\226q\274"
+	.ascii	"\262\004\347"
+	.string	"\312\206~'\016\325\025\250X\241f$h\240\270M\365$(\252\367nf\352 M\337?\006\206\212*2gpN\342M\031\202\265:\326h\255\fT\311`\211\025\206XV\363\332r\246\377\300V\223\203\004\030\242\021\272\271b\225\227D8\n\214\305\tK\217t\004N\310\332\343\"\f\311%\b\r\2461\242\245[\340\266\306)\033\250s?0O\032\241\271'\254\261\375B6V\247\374\247j\211\350\332\306Z\311|\234\266\3038g\275\f\326z\032\235\335bhK\225\346\001M\226\305\021\027\216\007\376Ac\362mW\374IE\323*\246\313\017d\354]\351\255\216\f\256.+u\364\017\303\322\313f2]\024\365$\202\370\252\016\252<\027M\231\313\227c\336\225H \002%L\215\240\232\376\263\234\312\021\240\267B\262\304_M\306%\312\317bJl\331\340(Bk\230!eA\344>w\377\300K0;\267\337\377\362y\235*\322\036"
+	.string	"\245\356\f\367h\005\321\013|\276!\205w3\\\300\230\004\240#\221\027\233j\257\351Z\323\277d\367ZM\027R\220\2455\024l\324'b\311E\307s\354U \355\025$\331q\306\271s\305R\343\266]\200\262zc\007\004\305\373H\366\213\227\354;z\177s7\354\026D\245\333\202H\351\241\276\375\275\0327(\360_p%\241k\201\320\007\304r\001\020\227\004\347\246\265\304\216\244 :vv\213f\371\353\317\030\023\376\3770kZ\371\026\241S\t\316\325\356]\330\213\037\303\243L}n\246S\273\301\316r\314\r\217\260\342\240\373\246"
+	.ascii	"6\312V\322\003z\377\252Gs\316^JKX\267\033V\034\005\317\0305f"
+	.ascii	"\203\346\357\013N\025b]8\316\376\373:\267p&\222\214\202\357\343"
+	.ascii	"U\304\255\270\031H\fR8\366\256\330WO\311\247\314Na\345\001\215"
+	.ascii	"\252\352\025\b\263y\344\311\377\327\350F\340Nx\226\267\222J\035"
+	.ascii	"\317\002\034\305R\255\344\315\273\366\277E\323\017\023Si\356"
+	.ascii	"\375\n\006\203P]\237w\025~Z\222F\275\376p*R\205\313\256\237\314"
+	.ascii	"\364mJ\363\362\255y\355|o\nP]E!9\220\300"
+	.string	":0%\374\210\234\025\354\024@=\300h\313)\f\244`\332BPJ\033\037\017FS\255l,\327\003\\\231\220\204\033\023RH\r\225\212\257\222\036\005\250\f1\304\253u:\307\005\017e[\304\030\320\265\356\300\310\021\231\316(\365\235\376\230B\\\203L\265\226\r\320\200F\255\022\267AF\027\301\345\241\2525X\346\273s\305\300,a\275\203\033+\315\032\206\370\230\227\355\262\346\n0oQ\326\273\223\265_\370\245\241\357\367)2Vr\r\264=\200\3369VzG\330I\251\232gf\006\241\3649\371\262\331\304d\271\323\247\322\247Q`g\325\344(c\223\322 \352^(J\347\250k\234\343D\030\376\253\262kL\3009\244u\031-\003$g\031\024\241\204\004Q\213\220|\255\222\227O\237N\346@H,\370\002c\365u\235\202-\001\207\365\264\030\211\253\027\005Wy\242[l\230Z5\032h>\232L\343\360V\030\241\207\325\227\207"
+	.string	"1"
+	.ascii	"F\244at\303\354\315{N!P\375\240u\312T\021\330!$u\ff\255\n\220"
+	.ascii	"uj\021oJ\364OI\204\367\t\371T\"\022\264\311\374+_9Z\331\315k"
+	.ascii	"\323\316\247\367\006W\226s\017l\216\022\271B\210\321k\351\216"
+	.ascii	"\001\201\033\024\225\331k\272\333C@\353\215\212l\233\206\316"
+	.ascii	"BW5=p\310\352\327\035\233!\334>\272y\003N\3129\326]\007d\323"
+	.ascii	"\267\233\352\3370\337\362B\226G\253L\244\022R\264q\256\013\215"
+	.ascii	"\3326\350\270\t\23566r]\346\245\324\022\253\260\252\313\262\n"
+	.ascii	"\006\367RD\323_\2160\335\374?8\376v\032\213\f\361\031Q6k\n\320"
+	.ascii	"j\226\n\235)\300$\205\216\317\355\305\0307\211C?\331\217\223"
+	.ascii	"\342\331u\365\354b\302K\363P\360\313\300L\273\205\345z\212\262"
+	.ascii	"`\352\215;|\326\235\372\r\026\271Ss\236\315\366f\221f'\377\304"
+	.ascii	"\273\263\177w=\227\300\276\025\234qc\2305+B=\374\032\371 \222"
+	.ascii	"\027\221\256\304_\232MM\3337\303\275\031\303\3357\322\235\341"
+	.ascii	"\273QX\357&\263\331#\347'\357\f=\027\031\317\302\017\356\376"
+	.ascii	"\321\314\347\321C\002\214<\314\335\336\315\376v\276/\274\275"
+	.ascii	"W\306\337\t\271\325s\036sg}\017g\2609m\r\n\227\004\371j\374\033"
+	.ascii	"\356\270`\370\335\346xtq\224#A|\352\016\306\\\246\237\263\360"
+	.ascii	"\227_\336\314D\227\353\246\341\367^\370\376\270h\307s\254jL\313"
+	.ascii	"?\007\251\213\231K\354!W\3661\357\351\231\033-\322\245=p\224"
+	.ascii	"\303dW\005_\203\374^\320\273\357\031\251\300&\363\216\2247\246"
+	.ascii	"M0\343\207\365\357\212\267c\377yH\360>\373\355\025\375\377}m"
+	.ascii	"\326\235\307l9\367\232w\317\341~`g32\377\304\361\350\362z\215"
+	.ascii	"f\265\260>\00260;\262\356\247;\246>[\276{m\r\017o\207\354\231"
+	.ascii	"\313^\304\307\305\003u\245=M\202{\277\3724\273\374\347\376\340"
+	.ascii	"\027*\266\334\002\244\025"
+	.text
+	.section	.gnu.lto_.symtab.9b7fc4ae1ccfad2c,"e",@progbits
+	.string	"rcModeActivationMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\001"
+	.string	""
+	.string	"processAirmode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"isUsingNavigationModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"R\001"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\001"
+	.string	""
+	.string	"rcModeUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"isModeActivationConditionPresent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"modeActivationConditions_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\001"
+	.string	""
+	.string	"isRangeActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\001"
+	.string	""
+	.string	"updateActivatedModes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"modeActivationOperatorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\001"
+	.string	""
+	.string	"updateUsedModeActivationConditionFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\001"
+	.string	""
+	.string	"configureModeActivationCondition"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"modeActivationOperatorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\001"
+	.string	""
+	.string	"modeActivationOperatorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"modeActivationConditions_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\001"
+	.string	""
+	.string	"modeActivationConditions_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\001"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\001"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\001"
+	.string	""
+	.string	"bitArrayGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\001"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\001"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"bitArraySet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\317\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.9b7fc4ae1ccfad2c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19857 @@
+# 0 "./src/main/fc/settings.c"
+# 1 "/root/repo//"
+# 0 "<built-in>"
+#define __STDC__ 1
+# 0 "<built-in>"
+#define __STDC_VERSION__ 199901L
+# 0 "<built-in>"
+#define __STDC_UTF_16__ 1
+# 0 "<built-in>"
+#define __STDC_UTF_32__ 1
+# 0 "<built-in>"
+#define __STDC_HOSTED__ 1
+# 0 "<built-in>"
+#define __GNUC__ 12
+# 0 "<built-in>"
+#define __GNUC_MINOR__ 2
+# 0 "<built-in>"
+#define __GNUC_PATCHLEVEL__ 0
+# 0 "<built-in>"
+#define __VERSION__ "12.2.0"
+# 0 "<built-in>"
+#define __ATOMIC_RELAXED 0
+# 0 "<built-in>"
+#define __ATOMIC_SEQ_CST 5
+# 0 "<built-in>"
+#define __ATOMIC_ACQUIRE 2
+# 0 "<built-in>"
+#define __ATOMIC_RELEASE 3
+# 0 "<built-in>"
+#define __ATOMIC_ACQ_REL 4
+# 0 "<built-in>"
+#define __ATOMIC_CONSUME 1
+# 0 "<built-in>"
+#define __pic__ 2
+# 0 "<built-in>"
+#define __PIC__ 2
+# 0 "<built-in>"
+#define __pie__ 2
+# 0 "<built-in>"
+#define __PIE__ 2
+# 0 "<built-in>"
+#define __OPTIMIZE__ 1
+# 0 "<built-in>"
+#define __FINITE_MATH_ONLY__ 0
+# 0 "<built-in>"
+#define _LP64 1
+# 0 "<built-in>"
+#define __LP64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_INT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_LONG__ 8
+# 0 "<built-in>"
+#define __SIZEOF_SHORT__ 2
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT__ 4
+# 0 "<built-in>"
+#define __SIZEOF_DOUBLE__ 8
+# 0 "<built-in>"
+#define __SIZEOF_LONG_DOUBLE__ 16
+# 0 "<built-in>"
+#define __SIZEOF_SIZE_T__ 8
+# 0 "<built-in>"
+#define __CHAR_BIT__ 8
+# 0 "<built-in>"
+#define __BIGGEST_ALIGNMENT__ 16
+# 0 "<built-in>"
+#define __ORDER_LITTLE_ENDIAN__ 1234
+# 0 "<built-in>"
+#define __ORDER_BIG_ENDIAN__ 4321
+# 0 "<built-in>"
+#define __ORDER_PDP_ENDIAN__ 3412
+# 0 "<built-in>"
+#define __BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__
+# 0 "<built-in>"
+#define __SIZEOF_POINTER__ 8
+# 0 "<built-in>"
+#define __GNUC_EXECUTION_CHARSET_NAME "UTF-8"
+# 0 "<built-in>"
+#define __GNUC_WIDE_EXECUTION_CHARSET_NAME "UTF-32LE"
+# 0 "<built-in>"
+#define __SIZE_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __PTRDIFF_TYPE__ long int
+# 0 "<built-in>"
+#define __WCHAR_TYPE__ int
+# 0 "<built-in>"
+#define __WINT_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __INTMAX_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTMAX_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __CHAR16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __CHAR32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __SIG_ATOMIC_TYPE__ int
+# 0 "<built-in>"
+#define __INT8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT32_TYPE__ int
+# 0 "<built-in>"
+#define __INT64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_LEAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_LEAST16_TYPE__ short int
+# 0 "<built-in>"
+#define __INT_LEAST32_TYPE__ int
+# 0 "<built-in>"
+#define __INT_LEAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_LEAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_LEAST16_TYPE__ short unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST32_TYPE__ unsigned int
+# 0 "<built-in>"
+#define __UINT_LEAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INT_FAST8_TYPE__ signed char
+# 0 "<built-in>"
+#define __INT_FAST16_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST32_TYPE__ long int
+# 0 "<built-in>"
+#define __INT_FAST64_TYPE__ long int
+# 0 "<built-in>"
+#define __UINT_FAST8_TYPE__ unsigned char
+# 0 "<built-in>"
+#define __UINT_FAST16_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST32_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __UINT_FAST64_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __INTPTR_TYPE__ long int
+# 0 "<built-in>"
+#define __UINTPTR_TYPE__ long unsigned int
+# 0 "<built-in>"
+#define __GXX_ABI_VERSION 1017
+# 0 "<built-in>"
+#define __SCHAR_MAX__ 0x7f
+# 0 "<built-in>"
+#define __SHRT_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __LONG_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __LONG_LONG_MAX__ 0x7fffffffffffffffLL
+# 0 "<built-in>"
+#define __WCHAR_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __WCHAR_MIN__ (-__WCHAR_MAX__ - 1)
+# 0 "<built-in>"
+#define __WINT_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __WINT_MIN__ 0U
+# 0 "<built-in>"
+#define __PTRDIFF_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __SIZE_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __SCHAR_WIDTH__ 8
+# 0 "<built-in>"
+#define __SHRT_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_WIDTH__ 32
+# 0 "<built-in>"
+#define __LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __LONG_LONG_WIDTH__ 64
+# 0 "<built-in>"
+#define __WCHAR_WIDTH__ 32
+# 0 "<built-in>"
+#define __WINT_WIDTH__ 32
+# 0 "<built-in>"
+#define __PTRDIFF_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIZE_WIDTH__ 64
+# 0 "<built-in>"
+#define __INTMAX_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTMAX_C(c) c ## L
+# 0 "<built-in>"
+#define __UINTMAX_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINTMAX_C(c) c ## UL
+# 0 "<built-in>"
+#define __INTMAX_WIDTH__ 64
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)
+# 0 "<built-in>"
+#define __SIG_ATOMIC_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __UINT8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INT_LEAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT8_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_LEAST16_MAX__ 0x7fff
+# 0 "<built-in>"
+#define __INT16_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST16_WIDTH__ 16
+# 0 "<built-in>"
+#define __INT_LEAST32_MAX__ 0x7fffffff
+# 0 "<built-in>"
+#define __INT32_C(c) c
+# 0 "<built-in>"
+#define __INT_LEAST32_WIDTH__ 32
+# 0 "<built-in>"
+#define __INT_LEAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT64_C(c) c ## L
+# 0 "<built-in>"
+#define __INT_LEAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_LEAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT8_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST16_MAX__ 0xffff
+# 0 "<built-in>"
+#define __UINT16_C(c) c
+# 0 "<built-in>"
+#define __UINT_LEAST32_MAX__ 0xffffffffU
+# 0 "<built-in>"
+#define __UINT32_C(c) c ## U
+# 0 "<built-in>"
+#define __UINT_LEAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT64_C(c) c ## UL
+# 0 "<built-in>"
+#define __INT_FAST8_MAX__ 0x7f
+# 0 "<built-in>"
+#define __INT_FAST8_WIDTH__ 8
+# 0 "<built-in>"
+#define __INT_FAST16_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST16_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST32_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST32_WIDTH__ 64
+# 0 "<built-in>"
+#define __INT_FAST64_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INT_FAST64_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINT_FAST8_MAX__ 0xff
+# 0 "<built-in>"
+#define __UINT_FAST16_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST32_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __UINT_FAST64_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __INTPTR_MAX__ 0x7fffffffffffffffL
+# 0 "<built-in>"
+#define __INTPTR_WIDTH__ 64
+# 0 "<built-in>"
+#define __UINTPTR_MAX__ 0xffffffffffffffffUL
+# 0 "<built-in>"
+#define __GCC_IEC_559 2
+# 0 "<built-in>"
+#define __GCC_IEC_559_COMPLEX 2
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD__ 0
+# 0 "<built-in>"
+#define __FLT_EVAL_METHOD_TS_18661_3__ 0
+# 0 "<built-in>"
+#define __DEC_EVAL_METHOD__ 2
+# 0 "<built-in>"
+#define __FLT_RADIX__ 2
+# 0 "<built-in>"
+#define __FLT_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT_DIG__ 6
+# 0 "<built-in>"
+#define __FLT_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F
+# 0 "<built-in>"
+#define __FLT_MIN__ 1.17549435082228750796873653722224568e-38F
+# 0 "<built-in>"
+#define __FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F
+# 0 "<built-in>"
+#define __FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F
+# 0 "<built-in>"
+#define __FLT_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DBL_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __DBL_DIG__ 15
+# 0 "<built-in>"
+#define __DBL_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __DBL_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __DBL_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __DBL_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __DBL_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)
+# 0 "<built-in>"
+#define __DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)
+# 0 "<built-in>"
+#define __DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)
+# 0 "<built-in>"
+#define __DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)
+# 0 "<built-in>"
+#define __DBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __DBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __DBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __LDBL_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __LDBL_DIG__ 18
+# 0 "<built-in>"
+#define __LDBL_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __LDBL_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __LDBL_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __LDBL_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L
+# 0 "<built-in>"
+#define __LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L
+# 0 "<built-in>"
+#define __LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L
+# 0 "<built-in>"
+#define __LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L
+# 0 "<built-in>"
+#define __LDBL_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __LDBL_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __LDBL_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT16_MANT_DIG__ 11
+# 0 "<built-in>"
+#define __FLT16_DIG__ 3
+# 0 "<built-in>"
+#define __FLT16_MIN_EXP__ (-13)
+# 0 "<built-in>"
+#define __FLT16_MIN_10_EXP__ (-4)
+# 0 "<built-in>"
+#define __FLT16_MAX_EXP__ 16
+# 0 "<built-in>"
+#define __FLT16_MAX_10_EXP__ 4
+# 0 "<built-in>"
+#define __FLT16_DECIMAL_DIG__ 5
+# 0 "<built-in>"
+#define __FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16
+# 0 "<built-in>"
+#define __FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16
+# 0 "<built-in>"
+#define __FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16
+# 0 "<built-in>"
+#define __FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16
+# 0 "<built-in>"
+#define __FLT16_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT16_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT16_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32_MANT_DIG__ 24
+# 0 "<built-in>"
+#define __FLT32_DIG__ 6
+# 0 "<built-in>"
+#define __FLT32_MIN_EXP__ (-125)
+# 0 "<built-in>"
+#define __FLT32_MIN_10_EXP__ (-37)
+# 0 "<built-in>"
+#define __FLT32_MAX_EXP__ 128
+# 0 "<built-in>"
+#define __FLT32_MAX_10_EXP__ 38
+# 0 "<built-in>"
+#define __FLT32_DECIMAL_DIG__ 9
+# 0 "<built-in>"
+#define __FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32
+# 0 "<built-in>"
+#define __FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32
+# 0 "<built-in>"
+#define __FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32
+# 0 "<built-in>"
+#define __FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32
+# 0 "<built-in>"
+#define __FLT32_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT64_DIG__ 15
+# 0 "<built-in>"
+#define __FLT64_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT64_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT64_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT64_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT64_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64
+# 0 "<built-in>"
+#define __FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64
+# 0 "<built-in>"
+#define __FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64
+# 0 "<built-in>"
+#define __FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64
+# 0 "<built-in>"
+#define __FLT64_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT128_MANT_DIG__ 113
+# 0 "<built-in>"
+#define __FLT128_DIG__ 33
+# 0 "<built-in>"
+#define __FLT128_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT128_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT128_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT128_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT128_DECIMAL_DIG__ 36
+# 0 "<built-in>"
+#define __FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128
+# 0 "<built-in>"
+#define __FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128
+# 0 "<built-in>"
+#define __FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128
+# 0 "<built-in>"
+#define __FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128
+# 0 "<built-in>"
+#define __FLT128_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT128_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT128_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT32X_MANT_DIG__ 53
+# 0 "<built-in>"
+#define __FLT32X_DIG__ 15
+# 0 "<built-in>"
+#define __FLT32X_MIN_EXP__ (-1021)
+# 0 "<built-in>"
+#define __FLT32X_MIN_10_EXP__ (-307)
+# 0 "<built-in>"
+#define __FLT32X_MAX_EXP__ 1024
+# 0 "<built-in>"
+#define __FLT32X_MAX_10_EXP__ 308
+# 0 "<built-in>"
+#define __FLT32X_DECIMAL_DIG__ 17
+# 0 "<built-in>"
+#define __FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x
+# 0 "<built-in>"
+#define __FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x
+# 0 "<built-in>"
+#define __FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x
+# 0 "<built-in>"
+#define __FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x
+# 0 "<built-in>"
+#define __FLT32X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT32X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT32X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __FLT64X_MANT_DIG__ 64
+# 0 "<built-in>"
+#define __FLT64X_DIG__ 18
+# 0 "<built-in>"
+#define __FLT64X_MIN_EXP__ (-16381)
+# 0 "<built-in>"
+#define __FLT64X_MIN_10_EXP__ (-4931)
+# 0 "<built-in>"
+#define __FLT64X_MAX_EXP__ 16384
+# 0 "<built-in>"
+#define __FLT64X_MAX_10_EXP__ 4932
+# 0 "<built-in>"
+#define __FLT64X_DECIMAL_DIG__ 21
+# 0 "<built-in>"
+#define __FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x
+# 0 "<built-in>"
+#define __FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x
+# 0 "<built-in>"
+#define __FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x
+# 0 "<built-in>"
+#define __FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x
+# 0 "<built-in>"
+#define __FLT64X_HAS_DENORM__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_INFINITY__ 1
+# 0 "<built-in>"
+#define __FLT64X_HAS_QUIET_NAN__ 1
+# 0 "<built-in>"
+#define __FLT64X_IS_IEC_60559__ 2
+# 0 "<built-in>"
+#define __DEC32_MANT_DIG__ 7
+# 0 "<built-in>"
+#define __DEC32_MIN_EXP__ (-94)
+# 0 "<built-in>"
+#define __DEC32_MAX_EXP__ 97
+# 0 "<built-in>"
+#define __DEC32_MIN__ 1E-95DF
+# 0 "<built-in>"
+#define __DEC32_MAX__ 9.999999E96DF
+# 0 "<built-in>"
+#define __DEC32_EPSILON__ 1E-6DF
+# 0 "<built-in>"
+#define __DEC32_SUBNORMAL_MIN__ 0.000001E-95DF
+# 0 "<built-in>"
+#define __DEC64_MANT_DIG__ 16
+# 0 "<built-in>"
+#define __DEC64_MIN_EXP__ (-382)
+# 0 "<built-in>"
+#define __DEC64_MAX_EXP__ 385
+# 0 "<built-in>"
+#define __DEC64_MIN__ 1E-383DD
+# 0 "<built-in>"
+#define __DEC64_MAX__ 9.999999999999999E384DD
+# 0 "<built-in>"
+#define __DEC64_EPSILON__ 1E-15DD
+# 0 "<built-in>"
+#define __DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD
+# 0 "<built-in>"
+#define __DEC128_MANT_DIG__ 34
+# 0 "<built-in>"
+#define __DEC128_MIN_EXP__ (-6142)
+# 0 "<built-in>"
+#define __DEC128_MAX_EXP__ 6145
+# 0 "<built-in>"
+#define __DEC128_MIN__ 1E-6143DL
+# 0 "<built-in>"
+#define __DEC128_MAX__ 9.999999999999999999999999999999999E6144DL
+# 0 "<built-in>"
+#define __DEC128_EPSILON__ 1E-33DL
+# 0 "<built-in>"
+#define __DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL
+# 0 "<built-in>"
+#define __REGISTER_PREFIX__ 
+# 0 "<built-in>"
+#define __USER_LABEL_PREFIX__ 
+# 0 "<built-in>"
+#define __GNUC_STDC_INLINE__ 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1
+# 0 "<built-in>"
+#define __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1
+# 0 "<built-in>"
+#define __GCC_ATOMIC_BOOL_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR16_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_CHAR32_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_WCHAR_T_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_SHORT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_INT_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_LLONG_LOCK_FREE 2
+# 0 "<built-in>"
+#define __GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1
+# 0 "<built-in>"
+#define __GCC_DESTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_CONSTRUCTIVE_SIZE 64
+# 0 "<built-in>"
+#define __GCC_ATOMIC_POINTER_LOCK_FREE 2
+# 0 "<built-in>"
+#define __HAVE_SPECULATION_SAFE_VALUE 1
+# 0 "<built-in>"
+#define __GCC_HAVE_DWARF2_CFI_ASM 1
+# 0 "<built-in>"
+#define __PRAGMA_REDEFINE_EXTNAME 1
+# 0 "<built-in>"
+#define __SIZEOF_INT128__ 16
+# 0 "<built-in>"
+#define __SIZEOF_WCHAR_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_WINT_T__ 4
+# 0 "<built-in>"
+#define __SIZEOF_PTRDIFF_T__ 8
+# 0 "<built-in>"
+#define __amd64 1
+# 0 "<built-in>"
+#define __amd64__ 1
+# 0 "<built-in>"
+#define __x86_64 1
+# 0 "<built-in>"
+#define __x86_64__ 1
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT80__ 16
+# 0 "<built-in>"
+#define __SIZEOF_FLOAT128__ 16
+# 0 "<built-in>"
+#define __ATOMIC_HLE_ACQUIRE 65536
+# 0 "<built-in>"
+#define __ATOMIC_HLE_RELEASE 131072
+# 0 "<built-in>"
+#define __GCC_ASM_FLAG_OUTPUTS__ 1
+# 0 "<built-in>"
+#define __k8 1
+# 0 "<built-in>"
+#define __k8__ 1
+# 0 "<built-in>"
+#define __code_model_small__ 1
+# 0 "<built-in>"
+#define __MMX__ 1
+# 0 "<built-in>"
+#define __SSE__ 1
+# 0 "<built-in>"
+#define __SSE2__ 1
+# 0 "<built-in>"
+#define __FXSR__ 1
+# 0 "<built-in>"
+#define __SSE_MATH__ 1
+# 0 "<built-in>"
+#define __SSE2_MATH__ 1
+# 0 "<built-in>"
+#define __MMX_WITH_SSE__ 1
+# 0 "<built-in>"
+#define __SEG_FS 1
+# 0 "<built-in>"
+#define __SEG_GS 1
+# 0 "<built-in>"
+#define __gnu_linux__ 1
+# 0 "<built-in>"
+#define __linux 1
+# 0 "<built-in>"
+#define __linux__ 1
+# 0 "<built-in>"
+#define linux 1
+# 0 "<built-in>"
+#define __unix 1
+# 0 "<built-in>"
+#define __unix__ 1
+# 0 "<built-in>"
+#define unix 1
+# 0 "<built-in>"
+#define __ELF__ 1
+# 0 "<built-in>"
+#define __DECIMAL_BID_FORMAT__ 1
+# 0 "<command-line>"
+#define DEBUG 1
+# 0 "<command-line>"
+#define SIMULATOR_BUILD 1
+# 0 "<command-line>"
+#define FLASH_SIZE 2048
+# 0 "<command-line>"
+#define USE_STDPERIPH_DRIVER 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define SITL 1
+# 0 "<command-line>"
+#define __FORKNAME__ "inav"
+# 0 "<command-line>"
+#define __TARGET__ "SITL"
+# 0 "<command-line>"
+#define __REVISION__ "80b64cf"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 19 "/usr/include/stdc-predef.h" 3 4
+#define _STDC_PREDEF_H 1
+# 38 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559__ 1
+#define __STDC_IEC_60559_BFP__ 201404L
+# 48 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_IEC_559_COMPLEX__ 1
+#define __STDC_IEC_60559_COMPLEX__ 201404L
+# 62 "/usr/include/stdc-predef.h" 3 4
+#define __STDC_ISO_10646__ 201706L
+# 0 "<command-line>" 2
+# 1 "./src/main/fc/settings.c"
+# 1 "/usr/include/string.h" 1 3 4
+# 23 "/usr/include/string.h" 3 4
+#define _STRING_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+# 1 "/usr/include/features.h" 1 3 4
+# 19 "/usr/include/features.h" 3 4
+#define _FEATURES_H 1
+# 126 "/usr/include/features.h" 3 4
+#undef __USE_ISOC11
+#undef __USE_ISOC99
+#undef __USE_ISOC95
+#undef __USE_ISOCXX11
+#undef __USE_POSIX
+#undef __USE_POSIX2
+#undef __USE_POSIX199309
+#undef __USE_POSIX199506
+#undef __USE_XOPEN
+#undef __USE_XOPEN_EXTENDED
+#undef __USE_UNIX98
+#undef __USE_XOPEN2K
+#undef __USE_XOPEN2KXSI
+#undef __USE_XOPEN2K8
+#undef __USE_XOPEN2K8XSI
+#undef __USE_LARGEFILE
+#undef __USE_LARGEFILE64
+#undef __USE_FILE_OFFSET64
+#undef __USE_MISC
+#undef __USE_ATFILE
+#undef __USE_DYNAMIC_STACK_SIZE
+#undef __USE_GNU
+#undef __USE_FORTIFY_LEVEL
+#undef __KERNEL_STRICT_NAMES
+#undef __GLIBC_USE_ISOC2X
+#undef __GLIBC_USE_DEPRECATED_GETS
+#undef __GLIBC_USE_DEPRECATED_SCANF
+
+
+
+
+#define __KERNEL_STRICT_NAMES 
+# 168 "/usr/include/features.h" 3 4
+#define __GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))
+# 182 "/usr/include/features.h" 3 4
+#define __glibc_clang_prereq(maj,min) 0
+
+
+
+#define __GLIBC_USE(F) __GLIBC_USE_ ## F
+# 235 "/usr/include/features.h" 3 4
+#undef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE 1
+
+
+
+
+
+
+
+#define __GLIBC_USE_ISOC2X 0
+# 257 "/usr/include/features.h" 3 4
+#define __USE_ISOC99 1
+
+
+
+
+
+
+#define __USE_ISOC95 1
+# 285 "/usr/include/features.h" 3 4
+#define __USE_POSIX_IMPLICITLY 1
+
+#undef _POSIX_SOURCE
+#define _POSIX_SOURCE 1
+#undef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+# 325 "/usr/include/features.h" 3 4
+#define __USE_POSIX 1
+
+
+
+#define __USE_POSIX2 1
+
+
+
+#define __USE_POSIX199309 1
+
+
+
+#define __USE_POSIX199506 1
+
+
+
+#define __USE_XOPEN2K 1
+#undef __USE_ISOC95
+#define __USE_ISOC95 1
+#undef __USE_ISOC99
+#define __USE_ISOC99 1
+
+
+
+#define __USE_XOPEN2K8 1
+#undef _ATFILE_SOURCE
+#define _ATFILE_SOURCE 1
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+
+
+#define __USE_MISC 1
+
+
+
+#define __USE_ATFILE 1
+# 431 "/usr/include/features.h" 3 4
+#define __USE_FORTIFY_LEVEL 0
+# 441 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_GETS 1
+# 462 "/usr/include/features.h" 3 4
+#define __GLIBC_USE_DEPRECATED_SCANF 0
+# 475 "/usr/include/features.h" 3 4
+#undef __GNU_LIBRARY__
+#define __GNU_LIBRARY__ 6
+
+
+
+#define __GLIBC__ 2
+#define __GLIBC_MINOR__ 36
+
+#define __GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define _SYS_CDEFS_H 1
+# 35 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#undef __P
+#undef __PMT
+# 45 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_has_attribute(attr) __has_attribute (attr)
+
+
+
+
+#define __glibc_has_builtin(name) __has_builtin (name)
+
+
+
+
+
+
+#define __glibc_has_extension(ext) 0
+
+
+
+
+
+
+
+#define __LEAF , __leaf__
+#define __LEAF_ATTR __attribute__ ((__leaf__))
+# 79 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __THROW __attribute__ ((__nothrow__ __LEAF))
+#define __THROWNL __attribute__ ((__nothrow__))
+#define __NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct
+#define __NTHNL(fct) __attribute__ ((__nothrow__)) fct
+# 118 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __P(args) args
+#define __PMT(args) args
+
+
+
+
+#define __CONCAT(x,y) x ## y
+#define __STRING(x) #x
+
+
+#define __ptr_t void *
+
+
+
+
+
+
+
+#define __BEGIN_DECLS 
+#define __END_DECLS 
+
+
+
+
+#define __bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)
+#define __bos0(ptr) __builtin_object_size (ptr, 0)
+
+
+
+
+
+
+
+#define __glibc_objsize0(__o) __bos0 (__o)
+#define __glibc_objsize(__o) __bos (__o)
+# 205 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __warnattr(msg) __attribute__((__warning__ (msg)))
+#define __errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))
+# 218 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __flexarr []
+#define __glibc_c99_flexarr_available 1
+# 249 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))
+
+
+
+
+
+
+#define __REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW
+
+#define __REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL
+
+
+#define __ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)
+#define __ASMNAME2(prefix,cname) __STRING (prefix) cname
+# 283 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_malloc__ __attribute__ ((__malloc__))
+
+
+
+
+
+
+
+#define __attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))
+# 300 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))
+# 310 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_pure__ __attribute__ ((__pure__))
+
+
+
+
+
+
+#define __attribute_const__ __attribute__ ((__const__))
+
+
+
+
+
+#define __attribute_maybe_unused__ __attribute__ ((__unused__))
+# 332 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_used__ __attribute__ ((__used__))
+#define __attribute_noinline__ __attribute__ ((__noinline__))
+
+
+
+
+
+
+
+#define __attribute_deprecated__ __attribute__ ((__deprecated__))
+# 351 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))
+# 364 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))
+# 374 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))
+# 386 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonnull__(params) __attribute__ ((__nonnull__ params))
+
+
+
+
+
+#define __nonnull(params) __attribute_nonnull__ (params)
+
+
+
+
+
+
+#define __returns_nonnull __attribute__ ((__returns_nonnull__))
+# 408 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))
+# 417 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __wur 
+
+
+
+
+
+
+
+#undef __always_inline
+#define __always_inline __inline __attribute__ ((__always_inline__))
+# 435 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_artificial__ __attribute__ ((__artificial__))
+# 453 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __extern_inline extern __inline __attribute__ ((__gnu_inline__))
+#define __extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))
+# 463 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __fortify_function __extern_always_inline __attribute_artificial__
+
+
+
+
+
+#define __va_arg_pack() __builtin_va_arg_pack ()
+#define __va_arg_pack_len() __builtin_va_arg_pack_len ()
+# 497 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __restrict_arr __restrict
+# 512 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_unlikely(cond) __builtin_expect ((cond), 0)
+#define __glibc_likely(cond) __builtin_expect ((cond), 1)
+# 534 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_nonstring__ __attribute__ ((__nonstring__))
+
+
+
+
+
+#undef __attribute_copy__
+
+
+
+#define __attribute_copy__(arg) __attribute__ ((__copy__ (arg)))
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 618 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __LDBL_REDIR1(name,proto,alias) name proto
+#define __LDBL_REDIR(name,proto) name proto
+#define __LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW
+#define __LDBL_REDIR_NTH(name,proto) name proto __THROW
+#define __LDBL_REDIR2_DECL(name) 
+#define __LDBL_REDIR_DECL(name) 
+
+#define __REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)
+#define __REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)
+# 637 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __glibc_macro_warning1(message) _Pragma (#message)
+#define __glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)
+# 656 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __HAVE_GENERIC_SELECTION 1
+# 667 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_access(x) __attribute__ ((__access__ x))
+
+
+
+
+
+
+
+#define __fortified_attr_access(a,o,s) __attr_access ((a, o, s))
+
+
+#define __attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))
+# 691 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))
+
+#define __attr_dealloc_free __attr_dealloc (__builtin_free, 1)
+# 702 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+#define __attribute_returns_twice__ __attribute__ ((__returns_twice__))
+# 490 "/usr/include/features.h" 2 3 4
+# 505 "/usr/include/features.h" 3 4
+#define __USE_EXTERN_INLINES 1
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 3 4
+#define __stub___compat_bdflush 
+#define __stub_chflags 
+#define __stub_fchflags 
+#define __stub_gtty 
+#define __stub_revoke 
+#define __stub_setlogin 
+#define __stub_sigreturn 
+#define __stub_stty 
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+#define __need_size_t 
+#define __need_NULL 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 185 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __size_t__ 
+#define __SIZE_T__ 
+#define _SIZE_T 
+#define _SYS_SIZE_T_H 
+#define _T_SIZE_ 
+#define _T_SIZE 
+#define __SIZE_T 
+#define _SIZE_T_ 
+#define _BSD_SIZE_T_ 
+#define _SIZE_T_DEFINED_ 
+#define _SIZE_T_DEFINED 
+#define _BSD_SIZE_T_DEFINED_ 
+#define _SIZE_T_DECLARED 
+#define __DEFINED_size_t 
+#define ___int_size_t_h 
+#define _GCC_SIZE_T 
+#define _SIZET_ 
+
+
+
+
+
+
+#define __size_t 
+
+
+
+
+
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+#define _BITS_TYPES_LOCALE_T_H 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+#define _BITS_TYPES___LOCALE_T_H 1
+
+
+
+
+
+
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 19 "/usr/include/strings.h" 3 4
+#define _STRINGS_H 1
+
+
+#define __need_size_t 
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 410 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_NULL
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 2 "./src/main/fc/settings.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 23 "/usr/include/stdint.h" 3 4
+#define _STDINT_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define _BITS_TYPES_H 1
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+
+
+
+
+
+
+#define __TIMESIZE __WORDSIZE
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 109 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __S16_TYPE short int
+#define __U16_TYPE unsigned short int
+#define __S32_TYPE int
+#define __U32_TYPE unsigned int
+#define __SLONGWORD_TYPE long int
+#define __ULONGWORD_TYPE unsigned long int
+# 128 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#define __SQUAD_TYPE long int
+#define __UQUAD_TYPE unsigned long int
+#define __SWORD_TYPE long int
+#define __UWORD_TYPE unsigned long int
+#define __SLONG32_TYPE int
+#define __ULONG32_TYPE unsigned int
+#define __S64_TYPE long int
+#define __U64_TYPE unsigned long int
+
+#define __STD_TYPE typedef
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define _BITS_TYPESIZES_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __SYSCALL_SLONG_TYPE __SLONGWORD_TYPE
+#define __SYSCALL_ULONG_TYPE __ULONGWORD_TYPE
+
+
+#define __DEV_T_TYPE __UQUAD_TYPE
+#define __UID_T_TYPE __U32_TYPE
+#define __GID_T_TYPE __U32_TYPE
+#define __INO_T_TYPE __SYSCALL_ULONG_TYPE
+#define __INO64_T_TYPE __UQUAD_TYPE
+#define __MODE_T_TYPE __U32_TYPE
+
+#define __NLINK_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSWORD_T_TYPE __SYSCALL_SLONG_TYPE
+
+
+
+
+#define __OFF_T_TYPE __SYSCALL_SLONG_TYPE
+#define __OFF64_T_TYPE __SQUAD_TYPE
+#define __PID_T_TYPE __S32_TYPE
+#define __RLIM_T_TYPE __SYSCALL_ULONG_TYPE
+#define __RLIM64_T_TYPE __UQUAD_TYPE
+#define __BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE
+#define __BLKCNT64_T_TYPE __SQUAD_TYPE
+#define __FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSBLKCNT64_T_TYPE __UQUAD_TYPE
+#define __FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE
+#define __FSFILCNT64_T_TYPE __UQUAD_TYPE
+#define __ID_T_TYPE __U32_TYPE
+#define __CLOCK_T_TYPE __SYSCALL_SLONG_TYPE
+#define __TIME_T_TYPE __SYSCALL_SLONG_TYPE
+#define __USECONDS_T_TYPE __U32_TYPE
+#define __SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE
+#define __SUSECONDS64_T_TYPE __SQUAD_TYPE
+#define __DADDR_T_TYPE __S32_TYPE
+#define __KEY_T_TYPE __S32_TYPE
+#define __CLOCKID_T_TYPE __S32_TYPE
+#define __TIMER_T_TYPE void *
+#define __BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE
+#define __FSID_T_TYPE struct { int __val[2]; }
+#define __SSIZE_T_TYPE __SWORD_TYPE
+#define __CPU_MASK_TYPE __SYSCALL_ULONG_TYPE
+
+
+
+
+
+#define __OFF_T_MATCHES_OFF64_T 1
+
+
+#define __INO_T_MATCHES_INO64_T 1
+
+
+#define __RLIM_T_MATCHES_RLIM64_T 1
+
+
+#define __STATFS_MATCHES_STATFS64 1
+
+
+#define __KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1
+# 103 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 3 4
+#define __FD_SETSIZE 1024
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/time64.h" 3 4
+#define _BITS_TIME64_H 1
+
+
+
+
+
+#define __TIME64_T_TYPE __TIME_T_TYPE
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 226 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+#undef __STD_TYPE
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define _BITS_WCHAR_H 1
+# 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 3 4
+#define __WCHAR_MAX __WCHAR_MAX__
+
+
+
+
+
+
+
+#define __WCHAR_MIN __WCHAR_MIN__
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+
+
+
+#define __WORDSIZE 64
+
+
+
+
+
+
+#define __WORDSIZE_TIME64_COMPAT32 1
+
+
+
+#define __SYSCALL_WORDSIZE 64
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+#define _BITS_STDINT_INTN_H 1
+
+
+
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+#define _BITS_STDINT_UINTN_H 1
+
+
+
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+#define __intptr_t_defined 
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+
+
+
+#define __INT64_C(c) c ## L
+#define __UINT64_C(c) c ## UL
+# 116 "/usr/include/stdint.h" 3 4
+#define INT8_MIN (-128)
+#define INT16_MIN (-32767-1)
+#define INT32_MIN (-2147483647-1)
+#define INT64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT8_MAX (127)
+#define INT16_MAX (32767)
+#define INT32_MAX (2147483647)
+#define INT64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT8_MAX (255)
+#define UINT16_MAX (65535)
+#define UINT32_MAX (4294967295U)
+#define UINT64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_LEAST8_MIN (-128)
+#define INT_LEAST16_MIN (-32767-1)
+#define INT_LEAST32_MIN (-2147483647-1)
+#define INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_LEAST8_MAX (127)
+#define INT_LEAST16_MAX (32767)
+#define INT_LEAST32_MAX (2147483647)
+#define INT_LEAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_LEAST8_MAX (255)
+#define UINT_LEAST16_MAX (65535)
+#define UINT_LEAST32_MAX (4294967295U)
+#define UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+#define INT_FAST8_MIN (-128)
+
+#define INT_FAST16_MIN (-9223372036854775807L-1)
+#define INT_FAST32_MIN (-9223372036854775807L-1)
+
+
+
+
+#define INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INT_FAST8_MAX (127)
+
+#define INT_FAST16_MAX (9223372036854775807L)
+#define INT_FAST32_MAX (9223372036854775807L)
+
+
+
+
+#define INT_FAST64_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINT_FAST8_MAX (255)
+
+#define UINT_FAST16_MAX (18446744073709551615UL)
+#define UINT_FAST32_MAX (18446744073709551615UL)
+
+
+
+
+#define UINT_FAST64_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+#define INTPTR_MIN (-9223372036854775807L-1)
+#define INTPTR_MAX (9223372036854775807L)
+#define UINTPTR_MAX (18446744073709551615UL)
+# 197 "/usr/include/stdint.h" 3 4
+#define INTMAX_MIN (-__INT64_C(9223372036854775807)-1)
+
+#define INTMAX_MAX (__INT64_C(9223372036854775807))
+
+
+#define UINTMAX_MAX (__UINT64_C(18446744073709551615))
+
+
+
+
+
+
+#define PTRDIFF_MIN (-9223372036854775807L-1)
+#define PTRDIFF_MAX (9223372036854775807L)
+# 222 "/usr/include/stdint.h" 3 4
+#define SIG_ATOMIC_MIN (-2147483647-1)
+#define SIG_ATOMIC_MAX (2147483647)
+
+
+
+#define SIZE_MAX (18446744073709551615UL)
+# 239 "/usr/include/stdint.h" 3 4
+#define WCHAR_MIN __WCHAR_MIN
+#define WCHAR_MAX __WCHAR_MAX
+
+
+
+#define WINT_MIN (0u)
+#define WINT_MAX (4294967295u)
+
+
+#define INT8_C(c) c
+#define INT16_C(c) c
+#define INT32_C(c) c
+
+#define INT64_C(c) c ## L
+
+
+
+
+
+#define UINT8_C(c) c
+#define UINT16_C(c) c
+#define UINT32_C(c) c ## U
+
+#define UINT64_C(c) c ## UL
+
+
+
+
+
+
+#define INTMAX_C(c) c ## L
+#define UINTMAX_C(c) c ## UL
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+
+
+
+#define _GCC_WRAP_STDINT_H 
+# 3 "./src/main/fc/settings.c" 2
+
+# 1 "./src/main/common/string_light.h" 1
+# 18 "./src/main/common/string_light.h"
+       
+
+
+# 20 "./src/main/common/string_light.h"
+int sl_isalnum(int c);
+int sl_isdigit(int c);
+int sl_isupper(int c);
+int sl_islower(int c);
+int sl_tolower(int c);
+int sl_toupper(int c);
+
+int sl_strcasecmp(const char * s1, const char * s2);
+int sl_strncasecmp(const char * s1, const char * s2, int n);
+# 5 "./src/main/fc/settings.c" 2
+# 1 "./src/main/common/utils.h" 1
+# 18 "./src/main/common/utils.h"
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _STDDEF_H 
+#define _STDDEF_H_ 
+
+#define _ANSI_STDDEF_H 
+# 132 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define _PTRDIFF_T 
+#define _T_PTRDIFF_ 
+#define _T_PTRDIFF 
+#define __PTRDIFF_T 
+#define _PTRDIFF_T_ 
+#define _BSD_PTRDIFF_T_ 
+#define ___int_ptrdiff_t_h 
+#define _GCC_PTRDIFF_T 
+#define _PTRDIFF_T_DECLARED 
+#define __DEFINED_ptrdiff_t 
+
+
+
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 158 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_ptrdiff_t
+# 237 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_size_t
+# 267 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#define __wchar_t__ 
+#define __WCHAR_T__ 
+#define _WCHAR_T 
+#define _T_WCHAR_ 
+#define _T_WCHAR 
+#define __WCHAR_T 
+#define _WCHAR_T_ 
+#define _BSD_WCHAR_T_ 
+#define _WCHAR_T_DEFINED_ 
+#define _WCHAR_T_DEFINED 
+#define _WCHAR_T_H 
+#define ___int_wchar_t_h 
+#define __INT_WCHAR_T_H 
+#define _GCC_WCHAR_T 
+#define _WCHAR_T_DECLARED 
+#define __DEFINED_wchar_t 
+# 295 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef _BSD_WCHAR_T_
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 349 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef __need_wchar_t
+# 399 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+#undef NULL
+
+
+
+
+#define NULL ((void *)0)
+
+
+
+
+
+#undef __need_NULL
+
+
+
+
+#define offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)
+# 21 "./src/main/common/utils.h" 2
+
+
+#define ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))
+#define ARRAYEND(x) (&(x)[ARRAYLEN(x)])
+
+#define CONST_CAST(type,value) ((type)(value))
+
+#define CONCAT_HELPER(x,y) x ## y
+#define CONCAT(x,y) CONCAT_HELPER(x, y)
+
+#define CONCAT3_HELPER(x,y,z) x ## y ## z
+#define CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)
+
+#define CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w
+#define CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)
+
+#define STR_HELPER(x) #x
+#define STR(x) STR_HELPER(x)
+
+#define EXPAND_I(x) x
+#define EXPAND(x) EXPAND_I(x)
+
+
+
+
+
+#define PP_CALL(macro,...) macro(__VA_ARGS__)
+
+
+#define UNUSED(x) (void)(x)
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+
+#define BIT(x) (1 << (x))
+
+#define STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))
+
+
+
+
+
+#define BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)
+#define BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))
+
+
+
+
+
+
+
+#define LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))
+#define LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))
+#define LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))
+#define LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))
+# 86 "./src/main/common/utils.h"
+#define container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))
+
+
+
+
+# 90 "./src/main/common/utils.h"
+static inline int16_t cmp16(uint16_t a, uint16_t b) { return a-b; }
+static inline int32_t cmp32(uint32_t a, uint32_t b) { return a-b; }
+# 100 "./src/main/common/utils.h"
+void * memcpy_fn ( void * destination, const void * source, size_t num ) asm("memcpy");
+
+
+
+
+
+
+#define FALLTHROUGH __attribute__ ((fallthrough))
+
+
+
+
+#define UNREACHABLE() __builtin_unreachable()
+
+#define ALIGNED(x) __attribute__ ((aligned(x)))
+#define ALWAYS_INLINE inline __attribute__ ((always_inline))
+# 6 "./src/main/fc/settings.c" 2
+
+# 1 "./obj/main/SITL/settings_generated.h" 1
+
+
+
+       
+#define SETTING_MAX_NAME_LENGTH 37
+#define SETTING_MAX_WORD_LENGTH 37
+#define SETTING_ENCODED_NAME_MAX_BYTES 5
+#define SETTINGS_WORDS_BITS_PER_CHAR 5
+#define SETTINGS_TABLE_COUNT 379
+typedef uint8_t setting_offset_t;
+#define SETTINGS_PGN_COUNT 36
+typedef int16_t setting_min_t;
+typedef uint32_t setting_max_t;
+#define SETTING_MIN_MAX_INDEX_BYTES 2
+enum {
+ TABLE_ACC_HARDWARE,
+ TABLE_AIRMODEHANDLINGTYPE,
+ TABLE_ALIGNMENT,
+ TABLE_AUX_OPERATOR,
+ TABLE_BARO_HARDWARE,
+ TABLE_BAT_CAPACITY_UNIT,
+ TABLE_BAT_VOLTAGE_SOURCE,
+ TABLE_BLACKBOX_COMPRESSION,
+ TABLE_BLACKBOX_DEVICE,
+ TABLE_CURRENT_SENSOR,
+ TABLE_DEBUG_MODES,
+ TABLE_DIRECTION,
+ TABLE_FAILSAFE_PROCEDURE,
+ TABLE_FILTER_TYPE,
+ TABLE_FRSKY_UNIT,
+ TABLE_GPS_DYN_MODEL,
+ TABLE_GPS_PROVIDER,
+ TABLE_GPS_SBAS_MODE,
+ TABLE_GYRO_LPF,
+ TABLE_ITERM_RELAX,
+ TABLE_ITERM_RELAX_TYPE,
+ TABLE_LOG_LEVEL,
+ TABLE_LTM_RATES,
+ TABLE_MAG_HARDWARE,
+ TABLE_MOTOR_PWM_PROTOCOL,
+ TABLE_NAV_EXTRA_ARMING_SAFETY,
+ TABLE_NAV_RTH_ALLOW_LANDING,
+ TABLE_NAV_RTH_ALT_MODE,
+ TABLE_NAV_USER_CONTROL_MODE,
+ TABLE_OFF_ON,
+ TABLE_OPFLOW_HARDWARE,
+ TABLE_PIDTYPETABLE,
+ TABLE_PITOT_HARDWARE,
+ TABLE_PLATFORM_TYPE,
+ TABLE_RECEIVER_TYPE,
+ TABLE_RESET_TYPE,
+ TABLE_RSSI_SOURCE,
+ TABLE_SERIAL_RX,
+ TABLE_SERVO_PROTOCOL,
+ TABLE_SMARTPORT_FUEL_UNIT,
+ TABLE_TZ_AUTOMATIC_DST,
+ TABLE_VOLTAGE_SENSOR,
+ TABLE_VTX_LOW_POWER_DISARM,
+ LOOKUP_TABLE_COUNT,
+};
+extern const char * const table_acc_hardware[];
+extern const char * const table_airmodeHandlingType[];
+extern const char * const table_alignment[];
+extern const char * const table_aux_operator[];
+extern const char * const table_baro_hardware[];
+extern const char * const table_bat_capacity_unit[];
+extern const char * const table_bat_voltage_source[];
+extern const char * const table_blackbox_compression[];
+extern const char * const table_blackbox_device[];
+extern const char * const table_current_sensor[];
+extern const char * const table_debug_modes[];
+extern const char * const table_direction[];
+extern const char * const table_failsafe_procedure[];
+extern const char * const table_filter_type[];
+extern const char * const table_frsky_unit[];
+extern const char * const table_gps_dyn_model[];
+extern const char * const table_gps_provider[];
+extern const char * const table_gps_sbas_mode[];
+extern const char * const table_gyro_lpf[];
+extern const char * const table_iterm_relax[];
+extern const char * const table_iterm_relax_type[];
+extern const char * const table_log_level[];
+extern const char * const table_ltm_rates[];
+extern const char * const table_mag_hardware[];
+extern const char * const table_motor_pwm_protocol[];
+extern const char * const table_nav_extra_arming_safety[];
+extern const char * const table_nav_rth_allow_landing[];
+extern const char * const table_nav_rth_alt_mode[];
+extern const char * const table_nav_user_control_mode[];
+extern const char * const table_off_on[];
+extern const char * const table_opflow_hardware[];
+extern const char * const table_pidTypeTable[];
+extern const char * const table_pitot_hardware[];
+extern const char * const table_platform_type[];
+extern const char * const table_receiver_type[];
+extern const char * const table_reset_type[];
+extern const char * const table_rssi_source[];
+extern const char * const table_serial_rx[];
+extern const char * const table_servo_protocol[];
+extern const char * const table_smartport_fuel_unit[];
+extern const char * const table_tz_automatic_dst[];
+extern const char * const table_voltage_sensor[];
+extern const char * const table_vtx_low_power_disarm[];
+#define SETTING_LOOPTIME 0
+#define SETTING_LOOPTIME_MIN 0
+#define SETTING_LOOPTIME_MAX 9000
+#define SETTING_GYRO_SYNC 1
+#define SETTING_GYRO_SYNC_MIN 0
+#define SETTING_GYRO_SYNC_MAX 0
+#define SETTING_PID_PROCESS_DENOM 2
+#define SETTING_PID_PROCESS_DENOM_MIN 1
+#define SETTING_PID_PROCESS_DENOM_MAX 8
+#define SETTING_ALIGN_GYRO 3
+#define SETTING_ALIGN_GYRO_MIN 0
+#define SETTING_ALIGN_GYRO_MAX 0
+#define SETTING_GYRO_HARDWARE_LPF 4
+#define SETTING_GYRO_HARDWARE_LPF_MIN 0
+#define SETTING_GYRO_HARDWARE_LPF_MAX 0
+#define SETTING_GYRO_LPF_HZ 5
+#define SETTING_GYRO_LPF_HZ_MIN 0
+#define SETTING_GYRO_LPF_HZ_MAX 200
+#define SETTING_GYRO_LPF_TYPE 6
+#define SETTING_GYRO_LPF_TYPE_MIN 0
+#define SETTING_GYRO_LPF_TYPE_MAX 0
+#define SETTING_MORON_THRESHOLD 7
+#define SETTING_MORON_THRESHOLD_MIN 0
+#define SETTING_MORON_THRESHOLD_MAX 128
+#define SETTING_GYRO_NOTCH_HZ 8
+#define SETTING_GYRO_NOTCH_HZ_MIN 0
+#define SETTING_GYRO_NOTCH_HZ_MAX 500
+#define SETTING_GYRO_NOTCH_CUTOFF 9
+#define SETTING_GYRO_NOTCH_CUTOFF_MIN 1
+#define SETTING_GYRO_NOTCH_CUTOFF_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ 10
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE 11
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0
+#define SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0
+#define SETTING_GYRO_KALMAN_ENABLED 12
+#define SETTING_GYRO_KALMAN_ENABLED_MIN 0
+#define SETTING_GYRO_KALMAN_ENABLED_MAX 0
+#define SETTING_GYRO_KALMAN_Q 13
+#define SETTING_GYRO_KALMAN_Q_MIN 1
+#define SETTING_GYRO_KALMAN_Q_MAX 16000
+#define SETTING_GYRO_KALMAN_W 14
+#define SETTING_GYRO_KALMAN_W_MIN 1
+#define SETTING_GYRO_KALMAN_W_MAX 40
+#define SETTING_GYRO_KALMAN_SHARPNESS 15
+#define SETTING_GYRO_KALMAN_SHARPNESS_MIN 1
+#define SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000
+#define SETTING_ACC_NOTCH_HZ 16
+#define SETTING_ACC_NOTCH_HZ_MIN 0
+#define SETTING_ACC_NOTCH_HZ_MAX 255
+#define SETTING_ACC_NOTCH_CUTOFF 17
+#define SETTING_ACC_NOTCH_CUTOFF_MIN 1
+#define SETTING_ACC_NOTCH_CUTOFF_MAX 255
+#define SETTING_ALIGN_ACC 18
+#define SETTING_ALIGN_ACC_MIN 0
+#define SETTING_ALIGN_ACC_MAX 0
+#define SETTING_ACC_HARDWARE 19
+#define SETTING_ACC_HARDWARE_MIN 0
+#define SETTING_ACC_HARDWARE_MAX 0
+#define SETTING_ACC_LPF_HZ 20
+#define SETTING_ACC_LPF_HZ_MIN 0
+#define SETTING_ACC_LPF_HZ_MAX 200
+#define SETTING_ACC_LPF_TYPE 21
+#define SETTING_ACC_LPF_TYPE_MIN 0
+#define SETTING_ACC_LPF_TYPE_MAX 0
+#define SETTING_ACCZERO_X 22
+#define SETTING_ACCZERO_X_MIN -32768
+#define SETTING_ACCZERO_X_MAX 32767
+#define SETTING_ACCZERO_Y 23
+#define SETTING_ACCZERO_Y_MIN -32768
+#define SETTING_ACCZERO_Y_MAX 32767
+#define SETTING_ACCZERO_Z 24
+#define SETTING_ACCZERO_Z_MIN -32768
+#define SETTING_ACCZERO_Z_MAX 32767
+#define SETTING_ACCGAIN_X 25
+#define SETTING_ACCGAIN_X_MIN 1
+#define SETTING_ACCGAIN_X_MAX 8192
+#define SETTING_ACCGAIN_Y 26
+#define SETTING_ACCGAIN_Y_MIN 1
+#define SETTING_ACCGAIN_Y_MAX 8192
+#define SETTING_ACCGAIN_Z 27
+#define SETTING_ACCGAIN_Z_MIN 1
+#define SETTING_ACCGAIN_Z_MAX 8192
+#define SETTING_OPFLOW_HARDWARE 28
+#define SETTING_OPFLOW_HARDWARE_MIN 0
+#define SETTING_OPFLOW_HARDWARE_MAX 0
+#define SETTING_OPFLOW_SCALE 29
+#define SETTING_OPFLOW_SCALE_MIN 0
+#define SETTING_OPFLOW_SCALE_MAX 10000
+#define SETTING_ALIGN_OPFLOW 30
+#define SETTING_ALIGN_OPFLOW_MIN 0
+#define SETTING_ALIGN_OPFLOW_MAX 0
+#define SETTING_ALIGN_MAG 31
+#define SETTING_ALIGN_MAG_MIN 0
+#define SETTING_ALIGN_MAG_MAX 0
+#define SETTING_MAG_HARDWARE 32
+#define SETTING_MAG_HARDWARE_MIN 0
+#define SETTING_MAG_HARDWARE_MAX 0
+#define SETTING_MAG_DECLINATION 33
+#define SETTING_MAG_DECLINATION_MIN -18000
+#define SETTING_MAG_DECLINATION_MAX 18000
+#define SETTING_MAGZERO_X 34
+#define SETTING_MAGZERO_X_MIN -32768
+#define SETTING_MAGZERO_X_MAX 32767
+#define SETTING_MAGZERO_Y 35
+#define SETTING_MAGZERO_Y_MIN -32768
+#define SETTING_MAGZERO_Y_MAX 32767
+#define SETTING_MAGZERO_Z 36
+#define SETTING_MAGZERO_Z_MIN -32768
+#define SETTING_MAGZERO_Z_MAX 32767
+#define SETTING_MAG_CALIBRATION_TIME 37
+#define SETTING_MAG_CALIBRATION_TIME_MIN 30
+#define SETTING_MAG_CALIBRATION_TIME_MAX 120
+#define SETTING_ALIGN_MAG_ROLL 38
+#define SETTING_ALIGN_MAG_ROLL_MIN -1800
+#define SETTING_ALIGN_MAG_ROLL_MAX 3600
+#define SETTING_ALIGN_MAG_PITCH 39
+#define SETTING_ALIGN_MAG_PITCH_MIN -1800
+#define SETTING_ALIGN_MAG_PITCH_MAX 3600
+#define SETTING_ALIGN_MAG_YAW 40
+#define SETTING_ALIGN_MAG_YAW_MIN -1800
+#define SETTING_ALIGN_MAG_YAW_MAX 3600
+#define SETTING_BARO_HARDWARE 41
+#define SETTING_BARO_HARDWARE_MIN 0
+#define SETTING_BARO_HARDWARE_MAX 0
+#define SETTING_BARO_MEDIAN_FILTER 42
+#define SETTING_BARO_MEDIAN_FILTER_MIN 0
+#define SETTING_BARO_MEDIAN_FILTER_MAX 0
+#define SETTING_BARO_CAL_TOLERANCE 43
+#define SETTING_BARO_CAL_TOLERANCE_MIN 0
+#define SETTING_BARO_CAL_TOLERANCE_MAX 1000
+#define SETTING_PITOT_HARDWARE 44
+#define SETTING_PITOT_HARDWARE_MIN 0
+#define SETTING_PITOT_HARDWARE_MAX 0
+#define SETTING_PITOT_LPF_MILLI_HZ 45
+#define SETTING_PITOT_LPF_MILLI_HZ_MIN 0
+#define SETTING_PITOT_LPF_MILLI_HZ_MAX 10000
+#define SETTING_PITOT_SCALE 46
+#define SETTING_PITOT_SCALE_MIN 0
+#define SETTING_PITOT_SCALE_MAX 100
+#define SETTING_RECEIVER_TYPE 47
+#define SETTING_RECEIVER_TYPE_MIN 0
+#define SETTING_RECEIVER_TYPE_MAX 0
+#define SETTING_MIN_CHECK 48
+#define SETTING_MIN_CHECK_MIN 1000
+#define SETTING_MIN_CHECK_MAX 2000
+#define SETTING_MAX_CHECK 49
+#define SETTING_MAX_CHECK_MIN 1000
+#define SETTING_MAX_CHECK_MAX 2000
+#define SETTING_RSSI_SOURCE 50
+#define SETTING_RSSI_SOURCE_MIN 0
+#define SETTING_RSSI_SOURCE_MAX 0
+#define SETTING_RSSI_CHANNEL 51
+#define SETTING_RSSI_CHANNEL_MIN 0
+#define SETTING_RSSI_CHANNEL_MAX 18
+#define SETTING_RSSI_MIN 52
+#define SETTING_RSSI_MIN_MIN 0
+#define SETTING_RSSI_MIN_MAX 100
+#define SETTING_RSSI_MAX 53
+#define SETTING_RSSI_MAX_MIN 0
+#define SETTING_RSSI_MAX_MAX 100
+#define SETTING_SBUS_SYNC_INTERVAL 54
+#define SETTING_SBUS_SYNC_INTERVAL_MIN 500
+#define SETTING_SBUS_SYNC_INTERVAL_MAX 10000
+#define SETTING_RC_FILTER_FREQUENCY 55
+#define SETTING_RC_FILTER_FREQUENCY_MIN 0
+#define SETTING_RC_FILTER_FREQUENCY_MAX 100
+#define SETTING_SERIALRX_PROVIDER 56
+#define SETTING_SERIALRX_PROVIDER_MIN 0
+#define SETTING_SERIALRX_PROVIDER_MAX 0
+#define SETTING_SERIALRX_INVERTED 57
+#define SETTING_SERIALRX_INVERTED_MIN 0
+#define SETTING_SERIALRX_INVERTED_MAX 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT 58
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0
+#define SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8
+#define SETTING_RX_MIN_USEC 59
+#define SETTING_RX_MIN_USEC_MIN 750
+#define SETTING_RX_MIN_USEC_MAX 2250
+#define SETTING_RX_MAX_USEC 60
+#define SETTING_RX_MAX_USEC_MIN 750
+#define SETTING_RX_MAX_USEC_MAX 2250
+#define SETTING_SERIALRX_HALFDUPLEX 61
+#define SETTING_SERIALRX_HALFDUPLEX_MIN 0
+#define SETTING_SERIALRX_HALFDUPLEX_MAX 0
+#define SETTING_BLACKBOX_RATE_NUM 62
+#define SETTING_BLACKBOX_RATE_NUM_MIN 1
+#define SETTING_BLACKBOX_RATE_NUM_MAX 65535
+#define SETTING_BLACKBOX_RATE_DENOM 63
+#define SETTING_BLACKBOX_RATE_DENOM_MIN 1
+#define SETTING_BLACKBOX_RATE_DENOM_MAX 65535
+#define SETTING_BLACKBOX_DEVICE 64
+#define SETTING_BLACKBOX_DEVICE_MIN 0
+#define SETTING_BLACKBOX_DEVICE_MAX 0
+#define SETTING_BLACKBOX_COMPRESSION 65
+#define SETTING_BLACKBOX_COMPRESSION_MIN 0
+#define SETTING_BLACKBOX_COMPRESSION_MAX 0
+#define SETTING_MAX_THROTTLE 66
+#define SETTING_MAX_THROTTLE_MIN 1000
+#define SETTING_MAX_THROTTLE_MAX 2000
+#define SETTING_MIN_COMMAND 67
+#define SETTING_MIN_COMMAND_MIN 0
+#define SETTING_MIN_COMMAND_MAX 2000
+#define SETTING_MOTOR_PWM_RATE 68
+#define SETTING_MOTOR_PWM_RATE_MIN 50
+#define SETTING_MOTOR_PWM_RATE_MAX 32000
+#define SETTING_MOTOR_ACCEL_TIME 69
+#define SETTING_MOTOR_ACCEL_TIME_MIN 0
+#define SETTING_MOTOR_ACCEL_TIME_MAX 1000
+#define SETTING_MOTOR_DECEL_TIME 70
+#define SETTING_MOTOR_DECEL_TIME_MIN 0
+#define SETTING_MOTOR_DECEL_TIME_MAX 1000
+#define SETTING_MOTOR_PWM_PROTOCOL 71
+#define SETTING_MOTOR_PWM_PROTOCOL_MIN 0
+#define SETTING_MOTOR_PWM_PROTOCOL_MAX 0
+#define SETTING_THROTTLE_SCALE 72
+#define SETTING_THROTTLE_SCALE_MIN 0
+#define SETTING_THROTTLE_SCALE_MAX 1
+#define SETTING_THROTTLE_IDLE 73
+#define SETTING_THROTTLE_IDLE_MIN 4
+#define SETTING_THROTTLE_IDLE_MAX 30
+#define SETTING_MOTOR_POLES 74
+#define SETTING_MOTOR_POLES_MIN 4
+#define SETTING_MOTOR_POLES_MAX 255
+#define SETTING_FAILSAFE_DELAY 75
+#define SETTING_FAILSAFE_DELAY_MIN 0
+#define SETTING_FAILSAFE_DELAY_MAX 200
+#define SETTING_FAILSAFE_RECOVERY_DELAY 76
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0
+#define SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200
+#define SETTING_FAILSAFE_OFF_DELAY 77
+#define SETTING_FAILSAFE_OFF_DELAY_MIN 0
+#define SETTING_FAILSAFE_OFF_DELAY_MAX 200
+#define SETTING_FAILSAFE_THROTTLE 78
+#define SETTING_FAILSAFE_THROTTLE_MIN 1000
+#define SETTING_FAILSAFE_THROTTLE_MAX 2000
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0
+#define SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300
+#define SETTING_FAILSAFE_PROCEDURE 80
+#define SETTING_FAILSAFE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD 81
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0
+#define SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE 82
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE 83
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800
+#define SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800
+#define SETTING_FAILSAFE_FW_YAW_RATE 84
+#define SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000
+#define SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000
+#define SETTING_FAILSAFE_MIN_DISTANCE 85
+#define SETTING_FAILSAFE_MIN_DISTANCE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0
+#define SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0
+#define SETTING_FAILSAFE_MISSION 87
+#define SETTING_FAILSAFE_MISSION_MIN 0
+#define SETTING_FAILSAFE_MISSION_MAX 0
+#define SETTING_ALIGN_BOARD_ROLL 88
+#define SETTING_ALIGN_BOARD_ROLL_MIN -1800
+#define SETTING_ALIGN_BOARD_ROLL_MAX 3600
+#define SETTING_ALIGN_BOARD_PITCH 89
+#define SETTING_ALIGN_BOARD_PITCH_MIN -1800
+#define SETTING_ALIGN_BOARD_PITCH_MAX 3600
+#define SETTING_ALIGN_BOARD_YAW 90
+#define SETTING_ALIGN_BOARD_YAW_MIN -1800
+#define SETTING_ALIGN_BOARD_YAW_MAX 3600
+#define SETTING_VBAT_METER_TYPE 91
+#define SETTING_VBAT_METER_TYPE_MIN 0
+#define SETTING_VBAT_METER_TYPE_MAX 0
+#define SETTING_CURRENT_METER_SCALE 92
+#define SETTING_CURRENT_METER_SCALE_MIN -10000
+#define SETTING_CURRENT_METER_SCALE_MAX 10000
+#define SETTING_CURRENT_METER_OFFSET 93
+#define SETTING_CURRENT_METER_OFFSET_MIN -32768
+#define SETTING_CURRENT_METER_OFFSET_MAX 32767
+#define SETTING_CURRENT_METER_TYPE 94
+#define SETTING_CURRENT_METER_TYPE_MIN 0
+#define SETTING_CURRENT_METER_TYPE_MAX 0
+#define SETTING_BAT_VOLTAGE_SRC 95
+#define SETTING_BAT_VOLTAGE_SRC_MIN 0
+#define SETTING_BAT_VOLTAGE_SRC_MAX 0
+#define SETTING_CRUISE_POWER 96
+#define SETTING_CRUISE_POWER_MIN 0
+#define SETTING_CRUISE_POWER_MAX 4294967295
+#define SETTING_IDLE_POWER 97
+#define SETTING_IDLE_POWER_MIN 0
+#define SETTING_IDLE_POWER_MAX 65535
+#define SETTING_RTH_ENERGY_MARGIN 98
+#define SETTING_RTH_ENERGY_MARGIN_MIN 0
+#define SETTING_RTH_ENERGY_MARGIN_MAX 100
+#define SETTING_THR_COMP_WEIGHT 99
+#define SETTING_THR_COMP_WEIGHT_MIN 0
+#define SETTING_THR_COMP_WEIGHT_MAX 2
+#define SETTING_BATTERY_CAPACITY 100
+#define SETTING_BATTERY_CAPACITY_MIN 0
+#define SETTING_BATTERY_CAPACITY_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_WARNING 101
+#define SETTING_BATTERY_CAPACITY_WARNING_MIN 0
+#define SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_CRITICAL 102
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0
+#define SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295
+#define SETTING_BATTERY_CAPACITY_UNIT 103
+#define SETTING_BATTERY_CAPACITY_UNIT_MIN 0
+#define SETTING_BATTERY_CAPACITY_UNIT_MAX 0
+#define SETTING_MOTOR_DIRECTION_INVERTED 104
+#define SETTING_MOTOR_DIRECTION_INVERTED_MIN 0
+#define SETTING_MOTOR_DIRECTION_INVERTED_MAX 0
+#define SETTING_PLATFORM_TYPE 105
+#define SETTING_PLATFORM_TYPE_MIN 0
+#define SETTING_PLATFORM_TYPE_MAX 0
+#define SETTING_HAS_FLAPS 106
+#define SETTING_HAS_FLAPS_MIN 0
+#define SETTING_HAS_FLAPS_MAX 0
+#define SETTING_MODEL_PREVIEW_TYPE 107
+#define SETTING_MODEL_PREVIEW_TYPE_MIN -1
+#define SETTING_MODEL_PREVIEW_TYPE_MAX 32767
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0
+#define SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450
+#define SETTING_3D_DEADBAND_LOW 109
+#define SETTING_3D_DEADBAND_LOW_MIN 1000
+#define SETTING_3D_DEADBAND_LOW_MAX 2000
+#define SETTING_3D_DEADBAND_HIGH 110
+#define SETTING_3D_DEADBAND_HIGH_MIN 1000
+#define SETTING_3D_DEADBAND_HIGH_MAX 2000
+#define SETTING_3D_NEUTRAL 111
+#define SETTING_3D_NEUTRAL_MIN 1000
+#define SETTING_3D_NEUTRAL_MAX 2000
+#define SETTING_SERVO_PROTOCOL 112
+#define SETTING_SERVO_PROTOCOL_MIN 0
+#define SETTING_SERVO_PROTOCOL_MAX 0
+#define SETTING_SERVO_CENTER_PULSE 113
+#define SETTING_SERVO_CENTER_PULSE_MIN 1000
+#define SETTING_SERVO_CENTER_PULSE_MAX 2000
+#define SETTING_SERVO_PWM_RATE 114
+#define SETTING_SERVO_PWM_RATE_MIN 50
+#define SETTING_SERVO_PWM_RATE_MAX 498
+#define SETTING_SERVO_LPF_HZ 115
+#define SETTING_SERVO_LPF_HZ_MIN 0
+#define SETTING_SERVO_LPF_HZ_MAX 400
+#define SETTING_FLAPERON_THROW_OFFSET 116
+#define SETTING_FLAPERON_THROW_OFFSET_MIN 50
+#define SETTING_FLAPERON_THROW_OFFSET_MAX 450
+#define SETTING_TRI_UNARMED_SERVO 117
+#define SETTING_TRI_UNARMED_SERVO_MIN 0
+#define SETTING_TRI_UNARMED_SERVO_MAX 0
+#define SETTING_THR_MID 118
+#define SETTING_THR_MID_MIN 0
+#define SETTING_THR_MID_MAX 100
+#define SETTING_THR_EXPO 119
+#define SETTING_THR_EXPO_MIN 0
+#define SETTING_THR_EXPO_MAX 100
+#define SETTING_TPA_RATE 120
+#define SETTING_TPA_RATE_MIN 0
+#define SETTING_TPA_RATE_MAX 100
+#define SETTING_TPA_BREAKPOINT 121
+#define SETTING_TPA_BREAKPOINT_MIN 1000
+#define SETTING_TPA_BREAKPOINT_MAX 2000
+#define SETTING_FW_TPA_TIME_CONSTANT 122
+#define SETTING_FW_TPA_TIME_CONSTANT_MIN 0
+#define SETTING_FW_TPA_TIME_CONSTANT_MAX 5000
+#define SETTING_RC_EXPO 123
+#define SETTING_RC_EXPO_MIN 0
+#define SETTING_RC_EXPO_MAX 100
+#define SETTING_RC_YAW_EXPO 124
+#define SETTING_RC_YAW_EXPO_MIN 0
+#define SETTING_RC_YAW_EXPO_MAX 100
+#define SETTING_ROLL_RATE 125
+#define SETTING_ROLL_RATE_MIN 6
+#define SETTING_ROLL_RATE_MAX 180
+#define SETTING_PITCH_RATE 126
+#define SETTING_PITCH_RATE_MIN 6
+#define SETTING_PITCH_RATE_MAX 180
+#define SETTING_YAW_RATE 127
+#define SETTING_YAW_RATE_MIN 2
+#define SETTING_YAW_RATE_MAX 180
+#define SETTING_MANUAL_RC_EXPO 128
+#define SETTING_MANUAL_RC_EXPO_MIN 0
+#define SETTING_MANUAL_RC_EXPO_MAX 100
+#define SETTING_MANUAL_RC_YAW_EXPO 129
+#define SETTING_MANUAL_RC_YAW_EXPO_MIN 0
+#define SETTING_MANUAL_RC_YAW_EXPO_MAX 100
+#define SETTING_MANUAL_ROLL_RATE 130
+#define SETTING_MANUAL_ROLL_RATE_MIN 0
+#define SETTING_MANUAL_ROLL_RATE_MAX 100
+#define SETTING_MANUAL_PITCH_RATE 131
+#define SETTING_MANUAL_PITCH_RATE_MIN 0
+#define SETTING_MANUAL_PITCH_RATE_MAX 100
+#define SETTING_MANUAL_YAW_RATE 132
+#define SETTING_MANUAL_YAW_RATE_MIN 0
+#define SETTING_MANUAL_YAW_RATE_MAX 100
+#define SETTING_FPV_MIX_DEGREES 133
+#define SETTING_FPV_MIX_DEGREES_MIN 0
+#define SETTING_FPV_MIX_DEGREES_MAX 50
+#define SETTING_REBOOT_CHARACTER 134
+#define SETTING_REBOOT_CHARACTER_MIN 48
+#define SETTING_REBOOT_CHARACTER_MAX 126
+#define SETTING_IMU_DCM_KP 135
+#define SETTING_IMU_DCM_KP_MIN 0
+#define SETTING_IMU_DCM_KP_MAX 65535
+#define SETTING_IMU_DCM_KI 136
+#define SETTING_IMU_DCM_KI_MIN 0
+#define SETTING_IMU_DCM_KI_MAX 65535
+#define SETTING_IMU_DCM_KP_MAG 137
+#define SETTING_IMU_DCM_KP_MAG_MIN 0
+#define SETTING_IMU_DCM_KP_MAG_MAX 65535
+#define SETTING_IMU_DCM_KI_MAG 138
+#define SETTING_IMU_DCM_KI_MAG_MIN 0
+#define SETTING_IMU_DCM_KI_MAG_MAX 65535
+#define SETTING_SMALL_ANGLE 139
+#define SETTING_SMALL_ANGLE_MIN 0
+#define SETTING_SMALL_ANGLE_MAX 180
+#define SETTING_IMU_ACC_IGNORE_RATE 140
+#define SETTING_IMU_ACC_IGNORE_RATE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_RATE_MAX 20
+#define SETTING_IMU_ACC_IGNORE_SLOPE 141
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0
+#define SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5
+#define SETTING_FIXED_WING_AUTO_ARM 142
+#define SETTING_FIXED_WING_AUTO_ARM_MIN 0
+#define SETTING_FIXED_WING_AUTO_ARM_MAX 0
+#define SETTING_DISARM_KILL_SWITCH 143
+#define SETTING_DISARM_KILL_SWITCH_MIN 0
+#define SETTING_DISARM_KILL_SWITCH_MAX 0
+#define SETTING_SWITCH_DISARM_DELAY 144
+#define SETTING_SWITCH_DISARM_DELAY_MIN 0
+#define SETTING_SWITCH_DISARM_DELAY_MAX 1000
+#define SETTING_APPLIED_DEFAULTS 145
+#define SETTING_APPLIED_DEFAULTS_MIN 0
+#define SETTING_APPLIED_DEFAULTS_MAX 3
+#define SETTING_GPS_PROVIDER 146
+#define SETTING_GPS_PROVIDER_MIN 0
+#define SETTING_GPS_PROVIDER_MAX 0
+#define SETTING_GPS_SBAS_MODE 147
+#define SETTING_GPS_SBAS_MODE_MIN 0
+#define SETTING_GPS_SBAS_MODE_MAX 0
+#define SETTING_GPS_DYN_MODEL 148
+#define SETTING_GPS_DYN_MODEL_MIN 0
+#define SETTING_GPS_DYN_MODEL_MAX 0
+#define SETTING_GPS_AUTO_CONFIG 149
+#define SETTING_GPS_AUTO_CONFIG_MIN 0
+#define SETTING_GPS_AUTO_CONFIG_MAX 0
+#define SETTING_GPS_AUTO_BAUD 150
+#define SETTING_GPS_AUTO_BAUD_MIN 0
+#define SETTING_GPS_AUTO_BAUD_MAX 0
+#define SETTING_GPS_UBLOX_USE_GALILEO 151
+#define SETTING_GPS_UBLOX_USE_GALILEO_MIN 0
+#define SETTING_GPS_UBLOX_USE_GALILEO_MAX 0
+#define SETTING_GPS_MIN_SATS 152
+#define SETTING_GPS_MIN_SATS_MIN 5
+#define SETTING_GPS_MIN_SATS_MAX 10
+#define SETTING_DEADBAND 153
+#define SETTING_DEADBAND_MIN 0
+#define SETTING_DEADBAND_MAX 32
+#define SETTING_YAW_DEADBAND 154
+#define SETTING_YAW_DEADBAND_MIN 0
+#define SETTING_YAW_DEADBAND_MAX 100
+#define SETTING_POS_HOLD_DEADBAND 155
+#define SETTING_POS_HOLD_DEADBAND_MIN 2
+#define SETTING_POS_HOLD_DEADBAND_MAX 250
+#define SETTING_ALT_HOLD_DEADBAND 156
+#define SETTING_ALT_HOLD_DEADBAND_MIN 10
+#define SETTING_ALT_HOLD_DEADBAND_MAX 250
+#define SETTING_3D_DEADBAND_THROTTLE 157
+#define SETTING_3D_DEADBAND_THROTTLE_MIN 0
+#define SETTING_3D_DEADBAND_THROTTLE_MAX 200
+#define SETTING_MC_AIRMODE_TYPE 158
+#define SETTING_MC_AIRMODE_TYPE_MIN 0
+#define SETTING_MC_AIRMODE_TYPE_MAX 0
+#define SETTING_MC_AIRMODE_THRESHOLD 159
+#define SETTING_MC_AIRMODE_THRESHOLD_MIN 1000
+#define SETTING_MC_AIRMODE_THRESHOLD_MAX 2000
+#define SETTING_MC_P_PITCH 160
+#define SETTING_MC_P_PITCH_MIN 0
+#define SETTING_MC_P_PITCH_MAX 200
+#define SETTING_MC_I_PITCH 161
+#define SETTING_MC_I_PITCH_MIN 0
+#define SETTING_MC_I_PITCH_MAX 200
+#define SETTING_MC_D_PITCH 162
+#define SETTING_MC_D_PITCH_MIN 0
+#define SETTING_MC_D_PITCH_MAX 200
+#define SETTING_MC_CD_PITCH 163
+#define SETTING_MC_CD_PITCH_MIN 0
+#define SETTING_MC_CD_PITCH_MAX 200
+#define SETTING_MC_P_ROLL 164
+#define SETTING_MC_P_ROLL_MIN 0
+#define SETTING_MC_P_ROLL_MAX 200
+#define SETTING_MC_I_ROLL 165
+#define SETTING_MC_I_ROLL_MIN 0
+#define SETTING_MC_I_ROLL_MAX 200
+#define SETTING_MC_D_ROLL 166
+#define SETTING_MC_D_ROLL_MIN 0
+#define SETTING_MC_D_ROLL_MAX 200
+#define SETTING_MC_CD_ROLL 167
+#define SETTING_MC_CD_ROLL_MIN 0
+#define SETTING_MC_CD_ROLL_MAX 200
+#define SETTING_MC_P_YAW 168
+#define SETTING_MC_P_YAW_MIN 0
+#define SETTING_MC_P_YAW_MAX 200
+#define SETTING_MC_I_YAW 169
+#define SETTING_MC_I_YAW_MIN 0
+#define SETTING_MC_I_YAW_MAX 200
+#define SETTING_MC_D_YAW 170
+#define SETTING_MC_D_YAW_MIN 0
+#define SETTING_MC_D_YAW_MAX 200
+#define SETTING_MC_CD_YAW 171
+#define SETTING_MC_CD_YAW_MIN 0
+#define SETTING_MC_CD_YAW_MAX 200
+#define SETTING_MC_P_LEVEL 172
+#define SETTING_MC_P_LEVEL_MIN 0
+#define SETTING_MC_P_LEVEL_MAX 200
+#define SETTING_MC_I_LEVEL 173
+#define SETTING_MC_I_LEVEL_MIN 0
+#define SETTING_MC_I_LEVEL_MAX 200
+#define SETTING_MC_D_LEVEL 174
+#define SETTING_MC_D_LEVEL_MIN 0
+#define SETTING_MC_D_LEVEL_MAX 200
+#define SETTING_FW_P_PITCH 175
+#define SETTING_FW_P_PITCH_MIN 0
+#define SETTING_FW_P_PITCH_MAX 200
+#define SETTING_FW_I_PITCH 176
+#define SETTING_FW_I_PITCH_MIN 0
+#define SETTING_FW_I_PITCH_MAX 200
+#define SETTING_FW_FF_PITCH 177
+#define SETTING_FW_FF_PITCH_MIN 0
+#define SETTING_FW_FF_PITCH_MAX 200
+#define SETTING_FW_P_ROLL 178
+#define SETTING_FW_P_ROLL_MIN 0
+#define SETTING_FW_P_ROLL_MAX 200
+#define SETTING_FW_I_ROLL 179
+#define SETTING_FW_I_ROLL_MIN 0
+#define SETTING_FW_I_ROLL_MAX 200
+#define SETTING_FW_FF_ROLL 180
+#define SETTING_FW_FF_ROLL_MIN 0
+#define SETTING_FW_FF_ROLL_MAX 200
+#define SETTING_FW_P_YAW 181
+#define SETTING_FW_P_YAW_MIN 0
+#define SETTING_FW_P_YAW_MAX 200
+#define SETTING_FW_I_YAW 182
+#define SETTING_FW_I_YAW_MIN 0
+#define SETTING_FW_I_YAW_MAX 200
+#define SETTING_FW_FF_YAW 183
+#define SETTING_FW_FF_YAW_MIN 0
+#define SETTING_FW_FF_YAW_MAX 200
+#define SETTING_FW_P_LEVEL 184
+#define SETTING_FW_P_LEVEL_MIN 0
+#define SETTING_FW_P_LEVEL_MAX 200
+#define SETTING_FW_I_LEVEL 185
+#define SETTING_FW_I_LEVEL_MIN 0
+#define SETTING_FW_I_LEVEL_MAX 200
+#define SETTING_FW_D_LEVEL 186
+#define SETTING_FW_D_LEVEL_MIN 0
+#define SETTING_FW_D_LEVEL_MAX 200
+#define SETTING_MAX_ANGLE_INCLINATION_RLL 187
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900
+#define SETTING_MAX_ANGLE_INCLINATION_PIT 188
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100
+#define SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900
+#define SETTING_DTERM_LPF_HZ 189
+#define SETTING_DTERM_LPF_HZ_MIN 0
+#define SETTING_DTERM_LPF_HZ_MAX 500
+#define SETTING_DTERM_LPF_TYPE 190
+#define SETTING_DTERM_LPF_TYPE_MIN 0
+#define SETTING_DTERM_LPF_TYPE_MAX 0
+#define SETTING_DTERM_LPF2_HZ 191
+#define SETTING_DTERM_LPF2_HZ_MIN 0
+#define SETTING_DTERM_LPF2_HZ_MAX 500
+#define SETTING_DTERM_LPF2_TYPE 192
+#define SETTING_DTERM_LPF2_TYPE_MIN 0
+#define SETTING_DTERM_LPF2_TYPE_MAX 0
+#define SETTING_YAW_LPF_HZ 193
+#define SETTING_YAW_LPF_HZ_MIN 0
+#define SETTING_YAW_LPF_HZ_MAX 200
+#define SETTING_FW_ITERM_THROW_LIMIT 194
+#define SETTING_FW_ITERM_THROW_LIMIT_MIN 0
+#define SETTING_FW_ITERM_THROW_LIMIT_MAX 500
+#define SETTING_FW_LOITER_DIRECTION 195
+#define SETTING_FW_LOITER_DIRECTION_MIN 0
+#define SETTING_FW_LOITER_DIRECTION_MAX 0
+#define SETTING_FW_REFERENCE_AIRSPEED 196
+#define SETTING_FW_REFERENCE_AIRSPEED_MIN 1
+#define SETTING_FW_REFERENCE_AIRSPEED_MAX 5000
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN 197
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0
+#define SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION 198
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0
+#define SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1
+#define SETTING_PIDSUM_LIMIT 199
+#define SETTING_PIDSUM_LIMIT_MIN 100
+#define SETTING_PIDSUM_LIMIT_MAX 1000
+#define SETTING_PIDSUM_LIMIT_YAW 200
+#define SETTING_PIDSUM_LIMIT_YAW_MIN 100
+#define SETTING_PIDSUM_LIMIT_YAW_MAX 1000
+#define SETTING_ITERM_WINDUP 201
+#define SETTING_ITERM_WINDUP_MIN 0
+#define SETTING_ITERM_WINDUP_MAX 90
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000
+#define SETTING_RATE_ACCEL_LIMIT_YAW 203
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0
+#define SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000
+#define SETTING_HEADING_HOLD_RATE_LIMIT 204
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10
+#define SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250
+#define SETTING_NAV_MC_POS_Z_P 205
+#define SETTING_NAV_MC_POS_Z_P_MIN 0
+#define SETTING_NAV_MC_POS_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_P 206
+#define SETTING_NAV_MC_VEL_Z_P_MIN 0
+#define SETTING_NAV_MC_VEL_Z_P_MAX 255
+#define SETTING_NAV_MC_VEL_Z_I 207
+#define SETTING_NAV_MC_VEL_Z_I_MIN 0
+#define SETTING_NAV_MC_VEL_Z_I_MAX 255
+#define SETTING_NAV_MC_VEL_Z_D 208
+#define SETTING_NAV_MC_VEL_Z_D_MIN 0
+#define SETTING_NAV_MC_VEL_Z_D_MAX 255
+#define SETTING_NAV_MC_POS_XY_P 209
+#define SETTING_NAV_MC_POS_XY_P_MIN 0
+#define SETTING_NAV_MC_POS_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_P 210
+#define SETTING_NAV_MC_VEL_XY_P_MIN 0
+#define SETTING_NAV_MC_VEL_XY_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_I 211
+#define SETTING_NAV_MC_VEL_XY_I_MIN 0
+#define SETTING_NAV_MC_VEL_XY_I_MAX 255
+#define SETTING_NAV_MC_VEL_XY_D 212
+#define SETTING_NAV_MC_VEL_XY_D_MIN 0
+#define SETTING_NAV_MC_VEL_XY_D_MAX 255
+#define SETTING_NAV_MC_VEL_XY_FF 213
+#define SETTING_NAV_MC_VEL_XY_FF_MIN 0
+#define SETTING_NAV_MC_VEL_XY_FF_MAX 255
+#define SETTING_NAV_MC_HEADING_P 214
+#define SETTING_NAV_MC_HEADING_P_MIN 0
+#define SETTING_NAV_MC_HEADING_P_MAX 255
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0
+#define SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100
+#define SETTING_NAV_FW_POS_Z_P 216
+#define SETTING_NAV_FW_POS_Z_P_MIN 0
+#define SETTING_NAV_FW_POS_Z_P_MAX 255
+#define SETTING_NAV_FW_POS_Z_I 217
+#define SETTING_NAV_FW_POS_Z_I_MIN 0
+#define SETTING_NAV_FW_POS_Z_I_MAX 255
+#define SETTING_NAV_FW_POS_Z_D 218
+#define SETTING_NAV_FW_POS_Z_D_MIN 0
+#define SETTING_NAV_FW_POS_Z_D_MAX 255
+#define SETTING_NAV_FW_POS_XY_P 219
+#define SETTING_NAV_FW_POS_XY_P_MIN 0
+#define SETTING_NAV_FW_POS_XY_P_MAX 255
+#define SETTING_NAV_FW_POS_XY_I 220
+#define SETTING_NAV_FW_POS_XY_I_MIN 0
+#define SETTING_NAV_FW_POS_XY_I_MAX 255
+#define SETTING_NAV_FW_POS_XY_D 221
+#define SETTING_NAV_FW_POS_XY_D_MIN 0
+#define SETTING_NAV_FW_POS_XY_D_MAX 255
+#define SETTING_NAV_FW_HEADING_P 222
+#define SETTING_NAV_FW_HEADING_P_MIN 0
+#define SETTING_NAV_FW_HEADING_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_P 223
+#define SETTING_NAV_FW_POS_HDG_P_MIN 0
+#define SETTING_NAV_FW_POS_HDG_P_MAX 255
+#define SETTING_NAV_FW_POS_HDG_I 224
+#define SETTING_NAV_FW_POS_HDG_I_MIN 0
+#define SETTING_NAV_FW_POS_HDG_I_MAX 255
+#define SETTING_NAV_FW_POS_HDG_D 225
+#define SETTING_NAV_FW_POS_HDG_D_MIN 0
+#define SETTING_NAV_FW_POS_HDG_D_MAX 255
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100
+#define SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000
+#define SETTING_MC_ITERM_RELAX_TYPE 227
+#define SETTING_MC_ITERM_RELAX_TYPE_MIN 0
+#define SETTING_MC_ITERM_RELAX_TYPE_MAX 0
+#define SETTING_MC_ITERM_RELAX 228
+#define SETTING_MC_ITERM_RELAX_MIN 0
+#define SETTING_MC_ITERM_RELAX_MAX 0
+#define SETTING_MC_ITERM_RELAX_CUTOFF 229
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1
+#define SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100
+#define SETTING_D_BOOST_FACTOR 230
+#define SETTING_D_BOOST_FACTOR_MIN 1
+#define SETTING_D_BOOST_FACTOR_MAX 3
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION 231
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000
+#define SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10
+#define SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250
+#define SETTING_ANTIGRAVITY_GAIN 233
+#define SETTING_ANTIGRAVITY_GAIN_MIN 1
+#define SETTING_ANTIGRAVITY_GAIN_MAX 20
+#define SETTING_ANTIGRAVITY_ACCELERATOR 234
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1
+#define SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1
+#define SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30
+#define SETTING_PID_TYPE 236
+#define SETTING_PID_TYPE_MIN 0
+#define SETTING_PID_TYPE_MAX 0
+#define SETTING_MC_CD_LPF_HZ 237
+#define SETTING_MC_CD_LPF_HZ_MIN 0
+#define SETTING_MC_CD_LPF_HZ_MAX 200
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50
+#define SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500
+#define SETTING_FW_AUTOTUNE_THRESHOLD 240
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0
+#define SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0
+#define SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC 242
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100
+#define SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000
+#define SETTING_INAV_AUTO_MAG_DECL 243
+#define SETTING_INAV_AUTO_MAG_DECL_MIN 0
+#define SETTING_INAV_AUTO_MAG_DECL_MAX 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE 244
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0
+#define SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255
+#define SETTING_INAV_USE_GPS_VELNED 245
+#define SETTING_INAV_USE_GPS_VELNED_MIN 0
+#define SETTING_INAV_USE_GPS_VELNED_MAX 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING 246
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0
+#define SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0
+#define SETTING_INAV_RESET_ALTITUDE 247
+#define SETTING_INAV_RESET_ALTITUDE_MIN 0
+#define SETTING_INAV_RESET_ALTITUDE_MAX 0
+#define SETTING_INAV_RESET_HOME 248
+#define SETTING_INAV_RESET_HOME_MIN 0
+#define SETTING_INAV_RESET_HOME_MAX 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE 249
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0
+#define SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000
+#define SETTING_INAV_W_Z_SURFACE_P 250
+#define SETTING_INAV_W_Z_SURFACE_P_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_P_MAX 100
+#define SETTING_INAV_W_Z_SURFACE_V 251
+#define SETTING_INAV_W_Z_SURFACE_V_MIN 0
+#define SETTING_INAV_W_Z_SURFACE_V_MAX 100
+#define SETTING_INAV_W_XY_FLOW_P 252
+#define SETTING_INAV_W_XY_FLOW_P_MIN 0
+#define SETTING_INAV_W_XY_FLOW_P_MAX 100
+#define SETTING_INAV_W_XY_FLOW_V 253
+#define SETTING_INAV_W_XY_FLOW_V_MIN 0
+#define SETTING_INAV_W_XY_FLOW_V_MAX 100
+#define SETTING_INAV_W_Z_BARO_P 254
+#define SETTING_INAV_W_Z_BARO_P_MIN 0
+#define SETTING_INAV_W_Z_BARO_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_P 255
+#define SETTING_INAV_W_Z_GPS_P_MIN 0
+#define SETTING_INAV_W_Z_GPS_P_MAX 10
+#define SETTING_INAV_W_Z_GPS_V 256
+#define SETTING_INAV_W_Z_GPS_V_MIN 0
+#define SETTING_INAV_W_Z_GPS_V_MAX 10
+#define SETTING_INAV_W_XY_GPS_P 257
+#define SETTING_INAV_W_XY_GPS_P_MIN 0
+#define SETTING_INAV_W_XY_GPS_P_MAX 10
+#define SETTING_INAV_W_XY_GPS_V 258
+#define SETTING_INAV_W_XY_GPS_V_MIN 0
+#define SETTING_INAV_W_XY_GPS_V_MAX 10
+#define SETTING_INAV_W_Z_RES_V 259
+#define SETTING_INAV_W_Z_RES_V_MIN 0
+#define SETTING_INAV_W_Z_RES_V_MAX 10
+#define SETTING_INAV_W_XY_RES_V 260
+#define SETTING_INAV_W_XY_RES_V_MIN 0
+#define SETTING_INAV_W_XY_RES_V_MAX 10
+#define SETTING_INAV_W_XYZ_ACC_P 261
+#define SETTING_INAV_W_XYZ_ACC_P_MIN 0
+#define SETTING_INAV_W_XYZ_ACC_P_MAX 1
+#define SETTING_INAV_W_ACC_BIAS 262
+#define SETTING_INAV_W_ACC_BIAS_MIN 0
+#define SETTING_INAV_W_ACC_BIAS_MAX 1
+#define SETTING_INAV_MAX_EPH_EPV 263
+#define SETTING_INAV_MAX_EPH_EPV_MIN 0
+#define SETTING_INAV_MAX_EPH_EPV_MAX 9999
+#define SETTING_INAV_BARO_EPV 264
+#define SETTING_INAV_BARO_EPV_MIN 0
+#define SETTING_INAV_BARO_EPV_MAX 9999
+#define SETTING_NAV_DISARM_ON_LANDING 265
+#define SETTING_NAV_DISARM_ON_LANDING_MIN 0
+#define SETTING_NAV_DISARM_ON_LANDING_MAX 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0
+#define SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY 267
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0
+#define SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0
+#define SETTING_NAV_USER_CONTROL_MODE 268
+#define SETTING_NAV_USER_CONTROL_MODE_MIN 0
+#define SETTING_NAV_USER_CONTROL_MODE_MAX 0
+#define SETTING_NAV_POSITION_TIMEOUT 269
+#define SETTING_NAV_POSITION_TIMEOUT_MIN 0
+#define SETTING_NAV_POSITION_TIMEOUT_MAX 10
+#define SETTING_NAV_WP_RADIUS 270
+#define SETTING_NAV_WP_RADIUS_MIN 10
+#define SETTING_NAV_WP_RADIUS_MAX 10000
+#define SETTING_NAV_WP_SAFE_DISTANCE 271
+#define SETTING_NAV_WP_SAFE_DISTANCE_MIN 0
+#define SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000
+#define SETTING_NAV_AUTO_SPEED 272
+#define SETTING_NAV_AUTO_SPEED_MIN 10
+#define SETTING_NAV_AUTO_SPEED_MAX 2000
+#define SETTING_NAV_AUTO_CLIMB_RATE 273
+#define SETTING_NAV_AUTO_CLIMB_RATE_MIN 10
+#define SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_MANUAL_SPEED 274
+#define SETTING_NAV_MANUAL_SPEED_MIN 10
+#define SETTING_NAV_MANUAL_SPEED_MAX 2000
+#define SETTING_NAV_MANUAL_CLIMB_RATE 275
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10
+#define SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000
+#define SETTING_NAV_LANDING_SPEED 276
+#define SETTING_NAV_LANDING_SPEED_MIN 100
+#define SETTING_NAV_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT 277
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50
+#define SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT 278
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500
+#define SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000
+#define SETTING_NAV_EMERG_LANDING_SPEED 279
+#define SETTING_NAV_EMERG_LANDING_SPEED_MIN 100
+#define SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000
+#define SETTING_NAV_MIN_RTH_DISTANCE 280
+#define SETTING_NAV_MIN_RTH_DISTANCE_MIN 0
+#define SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP 281
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0
+#define SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0
+#define SETTING_NAV_RTH_CLIMB_FIRST 282
+#define SETTING_NAV_RTH_CLIMB_FIRST_MIN 0
+#define SETTING_NAV_RTH_CLIMB_FIRST_MAX 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0
+#define SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0
+#define SETTING_NAV_RTH_TAIL_FIRST 284
+#define SETTING_NAV_RTH_TAIL_FIRST_MIN 0
+#define SETTING_NAV_RTH_TAIL_FIRST_MAX 0
+#define SETTING_NAV_RTH_ALLOW_LANDING 285
+#define SETTING_NAV_RTH_ALLOW_LANDING_MIN 0
+#define SETTING_NAV_RTH_ALLOW_LANDING_MAX 0
+#define SETTING_NAV_RTH_ALT_MODE 286
+#define SETTING_NAV_RTH_ALT_MODE_MIN 0
+#define SETTING_NAV_RTH_ALT_MODE_MAX 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD 287
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0
+#define SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0
+#define SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000
+#define SETTING_NAV_RTH_ALTITUDE 289
+#define SETTING_NAV_RTH_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_ALTITUDE 290
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0
+#define SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0
+#define SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359
+#define SETTING_NAV_MC_BANK_ANGLE 293
+#define SETTING_NAV_MC_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BANK_ANGLE_MAX 45
+#define SETTING_NAV_MC_HOVER_THR 294
+#define SETTING_NAV_MC_HOVER_THR_MIN 1000
+#define SETTING_NAV_MC_HOVER_THR_MAX 2000
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY 295
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100
+#define SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0
+#define SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_TIMEOUT 298
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100
+#define SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100
+#define SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0
+#define SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE 303
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15
+#define SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60
+#define SETTING_NAV_MC_POS_DECELERATION_TIME 304
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0
+#define SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255
+#define SETTING_NAV_MC_POS_EXPO 305
+#define SETTING_NAV_MC_POS_EXPO_MIN 0
+#define SETTING_NAV_MC_POS_EXPO_MAX 255
+#define SETTING_NAV_FW_CRUISE_THR 306
+#define SETTING_NAV_FW_CRUISE_THR_MIN 1000
+#define SETTING_NAV_FW_CRUISE_THR_MAX 2000
+#define SETTING_NAV_FW_MIN_THR 307
+#define SETTING_NAV_FW_MIN_THR_MIN 1000
+#define SETTING_NAV_FW_MIN_THR_MAX 2000
+#define SETTING_NAV_FW_MAX_THR 308
+#define SETTING_NAV_FW_MAX_THR_MIN 1000
+#define SETTING_NAV_FW_MAX_THR_MAX 2000
+#define SETTING_NAV_FW_BANK_ANGLE 309
+#define SETTING_NAV_FW_BANK_ANGLE_MIN 5
+#define SETTING_NAV_FW_BANK_ANGLE_MAX 80
+#define SETTING_NAV_FW_CLIMB_ANGLE 310
+#define SETTING_NAV_FW_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_CLIMB_ANGLE_MAX 80
+#define SETTING_NAV_FW_DIVE_ANGLE 311
+#define SETTING_NAV_FW_DIVE_ANGLE_MIN 5
+#define SETTING_NAV_FW_DIVE_ANGLE_MAX 80
+#define SETTING_NAV_FW_PITCH2THR 312
+#define SETTING_NAV_FW_PITCH2THR_MIN 0
+#define SETTING_NAV_FW_PITCH2THR_MAX 100
+#define SETTING_NAV_FW_LOITER_RADIUS 313
+#define SETTING_NAV_FW_LOITER_RADIUS_MIN 0
+#define SETTING_NAV_FW_LOITER_RADIUS_MAX 10000
+#define SETTING_NAV_FW_CRUISE_SPEED 314
+#define SETTING_NAV_FW_CRUISE_SPEED_MIN 0
+#define SETTING_NAV_FW_CRUISE_SPEED_MAX 65535
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS 315
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0
+#define SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE 316
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20
+#define SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20
+#define SETTING_NAV_FW_LAUNCH_VELOCITY 317
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100
+#define SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000
+#define SETTING_NAV_FW_LAUNCH_ACCEL 318
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME 320
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10
+#define SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_THR 321
+#define SETTING_NAV_FW_LAUNCH_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR 322
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000
+#define SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME 325
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT 326
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0
+#define SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0
+#define SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5
+#define SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45
+#define SETTING_NAV_FW_CRUISE_YAW_RATE 329
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0
+#define SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0
+#define SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL 331
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0
+#define SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0
+#define SETTING_NAV_FW_YAW_DEADBAND 332
+#define SETTING_NAV_FW_YAW_DEADBAND_MIN 0
+#define SETTING_NAV_FW_YAW_DEADBAND_MAX 90
+#define SETTING_TELEMETRY_SWITCH 333
+#define SETTING_TELEMETRY_SWITCH_MIN 0
+#define SETTING_TELEMETRY_SWITCH_MAX 0
+#define SETTING_TELEMETRY_INVERTED 334
+#define SETTING_TELEMETRY_INVERTED_MIN 0
+#define SETTING_TELEMETRY_INVERTED_MAX 0
+#define SETTING_FRSKY_DEFAULT_LATITUDE 335
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90
+#define SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90
+#define SETTING_FRSKY_DEFAULT_LONGITUDE 336
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180
+#define SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180
+#define SETTING_FRSKY_COORDINATES_FORMAT 337
+#define SETTING_FRSKY_COORDINATES_FORMAT_MIN 0
+#define SETTING_FRSKY_COORDINATES_FORMAT_MAX 1
+#define SETTING_FRSKY_UNIT 338
+#define SETTING_FRSKY_UNIT_MIN 0
+#define SETTING_FRSKY_UNIT_MAX 0
+#define SETTING_FRSKY_VFAS_PRECISION 339
+#define SETTING_FRSKY_VFAS_PRECISION_MIN 0
+#define SETTING_FRSKY_VFAS_PRECISION_MAX 1
+#define SETTING_FRSKY_PITCH_ROLL 340
+#define SETTING_FRSKY_PITCH_ROLL_MIN 0
+#define SETTING_FRSKY_PITCH_ROLL_MAX 0
+#define SETTING_REPORT_CELL_VOLTAGE 341
+#define SETTING_REPORT_CELL_VOLTAGE_MIN 0
+#define SETTING_REPORT_CELL_VOLTAGE_MAX 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL 342
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0
+#define SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120
+#define SETTING_TELEMETRY_HALFDUPLEX 343
+#define SETTING_TELEMETRY_HALFDUPLEX_MIN 0
+#define SETTING_TELEMETRY_HALFDUPLEX_MAX 0
+#define SETTING_SMARTPORT_FUEL_UNIT 344
+#define SETTING_SMARTPORT_FUEL_UNIT_MIN 0
+#define SETTING_SMARTPORT_FUEL_UNIT_MAX 0
+#define SETTING_IBUS_TELEMETRY_TYPE 345
+#define SETTING_IBUS_TELEMETRY_TYPE_MIN 0
+#define SETTING_IBUS_TELEMETRY_TYPE_MAX 255
+#define SETTING_LTM_UPDATE_RATE 346
+#define SETTING_LTM_UPDATE_RATE_MIN 0
+#define SETTING_LTM_UPDATE_RATE_MAX 0
+#define SETTING_SIM_GROUND_STATION_NUMBER 347
+#define SETTING_SIM_GROUND_STATION_NUMBER_MIN 0
+#define SETTING_SIM_GROUND_STATION_NUMBER_MAX 16
+#define SETTING_SIM_PIN 348
+#define SETTING_SIM_PIN_MIN 0
+#define SETTING_SIM_PIN_MAX 8
+#define SETTING_SIM_TRANSMIT_INTERVAL 349
+#define SETTING_SIM_TRANSMIT_INTERVAL_MIN 10
+#define SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535
+#define SETTING_SIM_TRANSMIT_FLAGS 350
+#define SETTING_SIM_TRANSMIT_FLAGS_MIN 0
+#define SETTING_SIM_TRANSMIT_FLAGS_MAX 5
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH 351
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535
+#define SETTING_ACC_EVENT_THRESHOLD_LOW 352
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X 353
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0
+#define SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535
+#define SETTING_SIM_LOW_ALTITUDE 354
+#define SETTING_SIM_LOW_ALTITUDE_MIN -32768
+#define SETTING_SIM_LOW_ALTITUDE_MAX 32767
+#define SETTING_MAVLINK_EXT_STATUS_RATE 355
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0
+#define SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255
+#define SETTING_MAVLINK_RC_CHAN_RATE 356
+#define SETTING_MAVLINK_RC_CHAN_RATE_MIN 0
+#define SETTING_MAVLINK_RC_CHAN_RATE_MAX 255
+#define SETTING_MAVLINK_POS_RATE 357
+#define SETTING_MAVLINK_POS_RATE_MIN 0
+#define SETTING_MAVLINK_POS_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA1_RATE 358
+#define SETTING_MAVLINK_EXTRA1_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA1_RATE_MAX 255
+#define SETTING_MAVLINK_EXTRA2_RATE 359
+#define SETTING_MAVLINK_EXTRA2_RATE_MIN 0
+#define SETTING_MAVLINK_EXTRA2_RATE_MAX 255
+#define SETTING_DEBUG_MODE 360
+#define SETTING_DEBUG_MODE_MIN 0
+#define SETTING_DEBUG_MODE_MAX 0
+#define SETTING_THROTTLE_TILT_COMP_STR 361
+#define SETTING_THROTTLE_TILT_COMP_STR_MIN 0
+#define SETTING_THROTTLE_TILT_COMP_STR_MAX 100
+#define SETTING_NAME 362
+#define SETTING_NAME_MIN 0
+#define SETTING_NAME_MAX 16
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR 363
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0
+#define SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0
+#define SETTING_STATS 364
+#define SETTING_STATS_MIN 0
+#define SETTING_STATS_MAX 0
+#define SETTING_STATS_TOTAL_TIME 365
+#define SETTING_STATS_TOTAL_TIME_MIN 0
+#define SETTING_STATS_TOTAL_TIME_MAX 2147483647
+#define SETTING_STATS_TOTAL_DIST 366
+#define SETTING_STATS_TOTAL_DIST_MIN 0
+#define SETTING_STATS_TOTAL_DIST_MAX 2147483647
+#define SETTING_TZ_OFFSET 367
+#define SETTING_TZ_OFFSET_MIN -1440
+#define SETTING_TZ_OFFSET_MAX 1440
+#define SETTING_TZ_AUTOMATIC_DST 368
+#define SETTING_TZ_AUTOMATIC_DST_MIN 0
+#define SETTING_TZ_AUTOMATIC_DST_MAX 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK 369
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0
+#define SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0
+#define SETTING_VTX_HALFDUPLEX 370
+#define SETTING_VTX_HALFDUPLEX_MIN 0
+#define SETTING_VTX_HALFDUPLEX_MAX 0
+#define SETTING_VTX_BAND 371
+#define SETTING_VTX_BAND_MIN 0
+#define SETTING_VTX_BAND_MAX 5
+#define SETTING_VTX_CHANNEL 372
+#define SETTING_VTX_CHANNEL_MIN 1
+#define SETTING_VTX_CHANNEL_MAX 8
+#define SETTING_VTX_POWER 373
+#define SETTING_VTX_POWER_MIN 1
+#define SETTING_VTX_POWER_MAX 5
+#define SETTING_VTX_LOW_POWER_DISARM 374
+#define SETTING_VTX_LOW_POWER_DISARM_MIN 0
+#define SETTING_VTX_LOW_POWER_DISARM_MAX 0
+#define SETTING_VTX_PIT_MODE_CHAN 375
+#define SETTING_VTX_PIT_MODE_CHAN_MIN 1
+#define SETTING_VTX_PIT_MODE_CHAN_MAX 8
+#define SETTING_VTX_MAX_POWER_OVERRIDE 376
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0
+#define SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000
+#define SETTING_LOG_LEVEL 377
+#define SETTING_LOG_LEVEL_MIN 0
+#define SETTING_LOG_LEVEL_MAX 0
+#define SETTING_LOG_TOPICS 378
+#define SETTING_LOG_TOPICS_MIN 0
+#define SETTING_LOG_TOPICS_MAX 4294967295
+# 8 "./src/main/fc/settings.c" 2
+
+# 1 "./src/main/fc/settings.h" 1
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define _STDBOOL_H 
+
+
+
+#define bool _Bool
+
+
+
+
+#define true 1
+#define false 0
+# 50 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 3 4
+#define __bool_true_false_are_defined 1
+# 4 "./src/main/fc/settings.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 5 "./src/main/fc/settings.h" 2
+
+
+# 1 "./src/main/config/parameter_group.h" 1
+# 18 "./src/main/config/parameter_group.h"
+       
+
+
+
+
+# 1 "./src/main/build/build_config.h" 1
+# 18 "./src/main/build/build_config.h"
+       
+
+#define BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))
+# 29 "./src/main/build/build_config.h"
+#define STATIC_UNIT_TESTED static
+#define STATIC_INLINE_UNIT_TESTED static inline
+#define INLINE_UNIT_TESTED inline
+#define UNIT_TESTED 
+
+
+
+
+
+#define REQUIRE_CC_ARM_PRINTF_SUPPORT 
+#define REQUIRE_PRINTF_LONG_SUPPORT 
+
+
+
+
+
+#define FASTRAM __attribute__ ((section(".fastram_bss"), aligned(4)))
+
+
+
+
+
+#define EXTENDED_FASTRAM 
+
+
+#define STATIC_FASTRAM static FASTRAM
+#define STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM
+# 24 "./src/main/config/parameter_group.h" 2
+
+typedef uint16_t pgn_t;
+
+
+typedef enum {
+    PGRF_NONE = 0,
+    PGRF_CLASSIFICATON_BIT = (1 << 0)
+} pgRegistryFlags_e;
+
+typedef enum {
+    PGR_PGN_MASK = 0x0fff,
+    PGR_PGN_VERSION_MASK = 0xf000,
+    PGR_SIZE_MASK = 0x0fff,
+    PGR_SIZE_SYSTEM_FLAG = 0x0000,
+    PGR_SIZE_PROFILE_FLAG = 0x8000
+} pgRegistryInternal_e;
+
+
+typedef void (pgResetFunc)(void * );
+
+typedef struct pgRegistry_s {
+    pgn_t pgn;
+    uint16_t size;
+    uint8_t *address;
+    uint8_t *copy;
+    uint8_t **ptr;
+    union {
+        void *ptr;
+        pgResetFunc *fn;
+    } reset;
+} pgRegistry_t;
+
+static inline uint16_t pgN(const pgRegistry_t* reg) {return reg->pgn & PGR_PGN_MASK;}
+static inline uint8_t pgVersion(const pgRegistry_t* reg) {return (uint8_t)(reg->pgn >> 12);}
+static inline uint16_t pgSize(const pgRegistry_t* reg) {return reg->size & PGR_SIZE_MASK;}
+static inline uint16_t pgIsSystem(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == 0;}
+static inline uint16_t pgIsProfile(const pgRegistry_t* reg) {return (reg->size & PGR_SIZE_PROFILE_FLAG) == PGR_SIZE_PROFILE_FLAG;}
+
+#define PG_PACKED __attribute__((packed))
+# 75 "./src/main/config/parameter_group.h"
+extern const pgRegistry_t __pg_registry_start[] __asm("__start_pg_registry");
+extern const pgRegistry_t __pg_registry_end[] __asm("__stop_pg_registry");
+#define PG_REGISTER_ATTRIBUTES __attribute__ ((section("pg_registry"), used, aligned(4)))
+
+extern const uint8_t __pg_resetdata_start[] __asm("__start_pg_resetdata");
+extern const uint8_t __pg_resetdata_end[] __asm("__stop_pg_resetdata");
+#define PG_RESETDATA_ATTRIBUTES __attribute__ ((section("pg_resetdata"), used, aligned(2)))
+# 92 "./src/main/config/parameter_group.h"
+#define PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)
+
+
+#define PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)
+
+
+#define PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else
+# 107 "./src/main/config/parameter_group.h"
+#define PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)
+
+
+
+
+
+
+
+#define PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy
+# 124 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _SystemArray[_size]; extern _type _name ## _CopyArray[_size]; static inline const _type* _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy
+# 134 "./src/main/config/parameter_group.h"
+#define PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy
+# 143 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name ## _System; _type _name ## _Copy; extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }
+# 158 "./src/main/config/parameter_group.h"
+#define PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })
+
+
+
+
+#define PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+#define PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) _type _name ## _SystemArray[_size]; _type _name ## _CopyArray[_size]; extern const pgRegistry_t _name ##_Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }
+# 187 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+# 208 "./src/main/config/parameter_group.h"
+#define _PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;
+
+
+
+
+#define PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STATIC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; STATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_COUNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pgRegistry_t _name ## _Registry; const pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }
+# 228 "./src/main/config/parameter_group.h"
+#define PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})
+
+
+
+
+#define PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})
+
+
+
+
+
+
+
+#define PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }
+
+
+
+
+
+const pgRegistry_t* pgFind(pgn_t pgn);
+
+void pgLoad(const pgRegistry_t* reg, int profileIndex, const void *from, int size, int version);
+int pgStore(const pgRegistry_t* reg, void *to, int size, uint8_t profileIndex);
+void pgResetAll(int profileCount);
+void pgResetCurrent(const pgRegistry_t *reg);
+
+# 257 "./src/main/config/parameter_group.h" 3 4
+_Bool 
+# 257 "./src/main/config/parameter_group.h"
+    pgResetCopy(void *copy, pgn_t pgn);
+void pgReset(const pgRegistry_t* reg, int profileIndex);
+void pgActivateProfile(int profileIndex);
+# 8 "./src/main/fc/settings.h" 2
+
+
+
+typedef struct lookupTableEntry_s {
+    const char * const *values;
+    const uint8_t valueCount;
+} lookupTableEntry_t;
+
+#define SETTING_TYPE_OFFSET 0
+#define SETTING_SECTION_OFFSET 4
+#define SETTING_MODE_OFFSET 6
+
+typedef enum {
+
+    VAR_UINT8 = (0 << 0),
+    VAR_INT8 = (1 << 0),
+    VAR_UINT16 = (2 << 0),
+    VAR_INT16 = (3 << 0),
+    VAR_UINT32 = (4 << 0),
+    VAR_FLOAT = (5 << 0),
+    VAR_STRING = (6 << 0)
+} setting_type_e;
+
+typedef enum {
+
+    MASTER_VALUE = (0 << 4),
+    PROFILE_VALUE = (1 << 4),
+    CONTROL_RATE_VALUE = (2 << 4),
+    BATTERY_CONFIG_VALUE = (3 << 4),
+} setting_section_e;
+
+typedef enum {
+
+    MODE_DIRECT = (0 << 6),
+    MODE_LOOKUP = (1 << 6),
+} setting_mode_e;
+
+#define SETTING_TYPE_MASK (0x0F)
+#define SETTING_SECTION_MASK (0x30)
+#define SETTING_MODE_MASK (0xC0)
+
+typedef struct settingMinMaxConfig_s {
+    const uint8_t indexes[2];
+} settingMinMaxConfig_t;
+
+typedef struct settingLookupTableConfig_s {
+    const uint8_t tableIndex;
+} settingLookupTableConfig_t;
+
+typedef union {
+    settingLookupTableConfig_t lookup;
+    settingMinMaxConfig_t minmax;
+} settingConfig_t;
+
+typedef struct {
+    const uint8_t encoded_name[5];
+    const uint8_t type;
+    const settingConfig_t config;
+    const setting_offset_t offset;
+
+} __attribute__((packed)) setting_t;
+
+static inline setting_type_e SETTING_TYPE(const setting_t *s) { return s->type & (0x0F); }
+static inline setting_section_e SETTING_SECTION(const setting_t *s) { return s->type & (0x30); }
+static inline setting_mode_e SETTING_MODE(const setting_t *s) { return s->type & (0xC0); }
+
+void settingGetName(const setting_t *val, char *buf);
+
+# 75 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 75 "./src/main/fc/settings.h"
+    settingNameContains(const setting_t *val, char *buf, const char *cmdline);
+
+# 76 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 76 "./src/main/fc/settings.h"
+    settingNameIsExactMatch(const setting_t *val, char *buf, const char *cmdline, uint8_t var_name_length);
+
+
+const setting_t *settingFind(const char *name);
+
+
+const setting_t *settingFindIgnoringCase(const char *name, size_t length, char *buf);
+
+
+const setting_t *settingGet(unsigned index);
+
+unsigned settingGetIndex(const setting_t *val);
+
+
+
+
+# 91 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 91 "./src/main/fc/settings.h"
+    settingsValidate(unsigned *invalidIndex);
+
+size_t settingGetValueSize(const setting_t *val);
+pgn_t settingGetPgn(const setting_t *val);
+
+
+void * settingGetValuePointer(const setting_t *val);
+
+
+
+
+const void * settingGetCopyValuePointer(const setting_t *val);
+
+
+
+setting_min_t settingGetMin(const setting_t *val);
+
+
+
+setting_max_t settingGetMax(const setting_t *val);
+
+
+const lookupTableEntry_t * settingLookupTable(const setting_t *val);
+
+
+
+const char * settingLookupValueName(const setting_t *val, unsigned v);
+
+
+size_t settingGetValueNameMaxSize(const setting_t *val);
+
+
+const char * settingGetString(const setting_t *val);
+
+
+
+void settingSetString(const setting_t *val, const char *s, size_t size);
+
+
+setting_max_t settingGetStringMaxLength(const setting_t *val);
+
+
+
+
+# 134 "./src/main/fc/settings.h" 3 4
+_Bool 
+# 134 "./src/main/fc/settings.h"
+    settingsGetParameterGroupIndexes(pgn_t pg, uint16_t *start, uint16_t *end);
+# 10 "./src/main/fc/settings.c" 2
+
+# 1 "./src/main/config/general_settings.h" 1
+# 25 "./src/main/config/general_settings.h"
+       
+
+
+
+typedef enum {
+    APPLIED_DEFAULTS_NONE = 0,
+    APPLIED_DEFAULTS_CUSTOM,
+    APPLIED_DEFAULTS_MINIQUAD,
+    APPLIED_DEFAULTS_AIRPLANE
+} appliedDefaults_e;
+
+typedef struct generalSettings_s {
+    int8_t appliedDefaults;
+} generalSettings_t;
+
+extern generalSettings_t generalSettings_System; extern generalSettings_t generalSettings_Copy; static inline const generalSettings_t* generalSettings(void) { return &generalSettings_System; } static inline generalSettings_t* generalSettingsMutable(void) { return &generalSettings_System; } struct _dummy;
+# 12 "./src/main/fc/settings.c" 2
+# 1 "./src/main/flight/rpm_filter.h" 1
+# 25 "./src/main/flight/rpm_filter.h"
+       
+
+
+# 1 "./src/main/common/time.h" 1
+# 18 "./src/main/common/time.h"
+       
+
+
+
+
+# 1 "./src/main/platform.h" 1
+# 18 "./src/main/platform.h"
+       
+# 63 "./src/main/platform.h"
+# 1 "./src/main/target/common.h" 1
+# 18 "./src/main/target/common.h"
+       
+
+
+
+
+#define DYNAMIC_HEAP_SIZE 2048
+
+
+#define I2C1_OVERCLOCK false
+#define I2C2_OVERCLOCK false
+#define USE_I2C_PULLUP 
+
+#define USE_RX_PPM 
+#define USE_SERIAL_RX 
+#define USE_SERIALRX_SPEKTRUM 
+#define USE_SERIALRX_SBUS 
+#define USE_SERIALRX_IBUS 
+#define USE_SERIALRX_FPORT 
+
+#define COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)
+# 56 "./src/main/target/common.h"
+#define USE_ADC_AVERAGING 
+#define USE_64BIT_TIME 
+#define USE_BLACKBOX 
+#define USE_GPS 
+#define USE_GPS_PROTO_UBLOX 
+#define USE_NAV 
+#define USE_TELEMETRY 
+#define USE_TELEMETRY_LTM 
+#define USE_TELEMETRY_FRSKY 
+
+
+
+
+#define SCHEDULER_DELAY_LIMIT 100
+
+
+
+#define USE_MR_BRAKING_MODE 
+#define USE_PITOT 
+#define USE_PITOT_ADC 
+#define USE_PITOT_VIRTUAL 
+
+#define USE_DYNAMIC_FILTERS 
+#define USE_GYRO_KALMAN 
+#define USE_EXTENDED_CMS_MENUS 
+#define USE_UAV_INTERCONNECT 
+#define USE_RX_UIB 
+#define USE_HOTT_TEXTMODE 
+
+
+#define USE_GPS_PROTO_NAZA 
+
+
+#define USE_RANGEFINDER 
+#define USE_RANGEFINDER_MSP 
+#define USE_RANGEFINDER_BENEWAKE 
+#define USE_RANGEFINDER_VL53L0X 
+#define USE_RANGEFINDER_HCSR04_I2C 
+
+
+#define USE_OPFLOW 
+#define USE_OPFLOW_CXOF 
+#define USE_OPFLOW_MSP 
+
+#define USE_PITOT 
+#define USE_PITOT_MS4525 
+
+#define USE_1WIRE 
+#define USE_1WIRE_DS2482 
+
+#define USE_TEMPERATURE_SENSOR 
+#define USE_TEMPERATURE_LM75 
+#define USE_TEMPERATURE_DS18B20 
+
+#define USE_MSP_DISPLAYPORT 
+#define USE_DASHBOARD 
+#define DASHBOARD_ARMED_BITMAP 
+#define USE_OLED_UG2864 
+
+#define USE_PWM_DRIVER_PCA9685 
+
+#define USE_TELEMETRY_SIM 
+#define USE_FRSKYOSD 
+#define USE_DJI_HD_OSD 
+
+#define NAV_NON_VOLATILE_WAYPOINT_CLI 
+
+#define NAV_AUTO_MAG_DECLINATION_PRECISE 
+
+#define USE_D_BOOST 
+#define USE_ANTIGRAVITY 
+
+
+
+
+
+
+#define NAV_FIXED_WING_LANDING 
+#define USE_AUTOTUNE_FIXED_WING 
+#define USE_LOG 
+#define USE_STATS 
+#define USE_CMS 
+#define CMS_MENU_OSD 
+#define USE_GPS_PROTO_NMEA 
+#define USE_GPS_PROTO_MTK 
+#define NAV_GPS_GLITCH_DETECTION 
+#define NAV_NON_VOLATILE_WAYPOINT_STORAGE 
+#define USE_TELEMETRY_HOTT 
+#define USE_TELEMETRY_IBUS 
+#define USE_TELEMETRY_MAVLINK 
+#define USE_TELEMETRY_SMARTPORT 
+#define USE_TELEMETRY_CRSF 
+#define USE_MSP_OVER_TELEMETRY 
+
+#define USE_RX_MSP 
+
+#define USE_SERIALRX_SUMD 
+#define USE_SERIALRX_SUMH 
+#define USE_SERIALRX_XBUS 
+#define USE_SERIALRX_JETIEXBUS 
+#define USE_SERIALRX_CRSF 
+#define USE_PWM_SERVO_DRIVER 
+#define USE_SERIAL_PASSTHROUGH 
+#define NAV_MAX_WAYPOINTS 60
+#define USE_RCDEVICE 
+
+
+#define USE_VTX_CONTROL 
+#define USE_VTX_SMARTAUDIO 
+#define USE_VTX_TRAMP 
+#define USE_VTX_FFPV 
+
+
+#define USE_LOGIC_CONDITIONS 
+#define USE_GLOBAL_FUNCTIONS 
+#define USE_CLI_BATCH 
+
+
+
+#define RTC_AUTOMATIC_DST 
+
+#define USE_WIND_ESTIMATOR 
+# 64 "./src/main/platform.h" 2
+# 1 "./src/main/target/SITL/target.h" 1
+# 25 "./src/main/target/SITL/target.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 29 "./src/main/target/SITL/target.h" 2
+
+
+
+
+
+#define TARGET_BOARD_IDENTIFIER "SITL"
+#define USBD_PRODUCT_STRING "SITL"
+
+#define USE_IMU_FAKE 
+#define USE_FAKE_BARO 
+#define USE_FAKE_MAG 
+#define USE_FAKE_GPS 
+
+#define USE_MAG 
+#define USE_BARO 
+
+#define USE_UART1 
+#define USE_UART2 
+#define USE_UART3 
+#define USE_UART4 
+#define USE_UART5 
+#define USE_UART6 
+#define USE_UART7 
+#define USE_UART8 
+#define SERIAL_PORT_COUNT 8
+
+#define DEFAULT_RX_TYPE RX_TYPE_MSP
+#define DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)
+
+#define MAX_PWM_OUTPUT_PORTS 16
+
+#define TARGET_IO_PORTA 0xffff
+#define TARGET_IO_PORTB 0xffff
+#define TARGET_IO_PORTC 0xffff
+
+
+#undef USE_DYNAMIC_FILTERS
+#undef USE_USB_MSC
+#undef USE_SERVO_SBUS
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+#undef USE_PWM_DRIVER_PCA9685
+#undef USE_PWM_SERVO_DRIVER
+#undef USE_RANGEFINDER
+#undef USE_RANGEFINDER_VL53L0X
+#undef USE_RANGEFINDER_HCSR04_I2C
+#undef USE_PITOT_MS4525
+#undef USE_PITOT_ADC
+#undef USE_1WIRE
+#undef USE_1WIRE_DS2482
+#undef USE_TEMPERATURE_SENSOR
+#undef USE_TEMPERATURE_LM75
+#undef USE_TEMPERATURE_DS18B20
+#undef USE_ADC
+#undef USE_VCP
+#undef USE_RX_PPM
+#undef USE_SERIALRX_SPEKTRUM
+#undef USE_RCDEVICE
+#undef USE_SERIAL_PASSTHROUGH
+#undef USE_ITCM_RAM
+
+#define SKIP_CLI_RESOURCES 
+
+
+#define USE_GYRO_STAGE_PROBE 
+
+
+#define U_ID_0 0
+#define U_ID_1 1
+#define U_ID_2 2
+
+
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { TEST_IRQ = 0 } IRQn_Type;
+typedef enum {
+    EXTI_Trigger_Rising = 0x08,
+    EXTI_Trigger_Falling = 0x0C,
+    EXTI_Trigger_Rising_Falling = 0x10
+} EXTITrigger_TypeDef;
+
+typedef struct { void *test; } GPIO_TypeDef;
+typedef struct { void *test; } TIM_TypeDef;
+typedef struct { void *test; } SPI_TypeDef;
+typedef struct { void *test; } I2C_TypeDef;
+typedef struct { void *test; } USART_TypeDef;
+typedef struct { void *test; } DMA_Stream_TypeDef;
+typedef struct { void *test; } DMA_Channel_TypeDef;
+typedef uint32_t DMA_TypeDef;
+
+#define USART1 ((USART_TypeDef *)0x0001)
+#define USART2 ((USART_TypeDef *)0x0002)
+#define USART3 ((USART_TypeDef *)0x0003)
+#define UART4 ((USART_TypeDef *)0x0004)
+#define UART5 ((USART_TypeDef *)0x0005)
+#define USART6 ((USART_TypeDef *)0x0006)
+#define UART7 ((USART_TypeDef *)0x0007)
+#define UART8 ((USART_TypeDef *)0x0008)
+
+#define __NVIC_PRIO_BITS 4
+static inline void __set_BASEPRI(uint32_t basePri) { (void)basePri; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri) { (void)basePri; }
+static inline uint32_t __get_BASEPRI(void) { return 0; }
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline void __NOP(void) {}
+#define __NOINLINE __attribute__((noinline))
+
+extern uint32_t SystemCoreClock;
+
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PG,
+    FLASH_ERROR_WRP,
+    FLASH_COMPLETE,
+    FLASH_TIMEOUT
+} FLASH_Status;
+
+void FLASH_Unlock(void);
+void FLASH_Lock(void);
+FLASH_Status FLASH_ErasePage(uintptr_t pageAddress);
+FLASH_Status FLASH_ProgramWord(uintptr_t address, uint32_t data);
+# 65 "./src/main/platform.h" 2
+# 1 "./src/main/target/sanity_check.h" 1
+# 25 "./src/main/target/sanity_check.h"
+       
+# 66 "./src/main/platform.h" 2
+# 1 "./src/main/target/common_post.h" 1
+# 20 "./src/main/target/common_post.h"
+       
+
+
+
+#undef USE_DASHBOARD
+#undef USE_OLED_UG2864
+# 46 "./src/main/target/common_post.h"
+#define FAST_CODE 
+#define NOINLINE 
+# 61 "./src/main/target/common_post.h"
+#undef USE_DYNAMIC_FILTERS
+
+
+
+
+#define FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize("-Os")))
+#define FUNCTION_COMPILE_NORMAL __attribute__((optimize("-O2")))
+#define FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize("-Ofast")))
+#define FILE_COMPILE_FOR_SIZE _Pragma("GCC optimize(\"Os\")")
+#define FILE_COMPILE_NORMAL _Pragma("GCC optimize(\"O2\")")
+#define FILE_COMPILE_FOR_SPEED _Pragma("GCC optimize(\"Ofast\")")
+# 67 "./src/main/platform.h" 2
+
+
+
+
+
+#pragma GCC diagnostic ignored "-Waddress-of-packed-member"
+# 24 "./src/main/common/time.h" 2
+
+
+
+
+typedef int32_t timeDelta_t;
+
+typedef uint32_t timeMs_t ;
+
+
+typedef uint64_t timeUs_t;
+#define TIMEUS_MAX UINT64_MAX
+
+
+
+
+
+
+#define MILLISECS_PER_SEC 1000
+#define USECS_PER_SEC (1000 * 1000)
+
+#define HZ2US(hz) (1000000 / (hz))
+#define US2S(us) ((us) * 1e-6f)
+#define US2MS(us) ((us) * 1e-3f)
+#define MS2US(ms) ((ms) * 1000)
+#define MS2S(ms) ((ms) * 1e-3f)
+#define HZ2S(hz) US2S(HZ2US(hz))
+
+static inline timeDelta_t cmpTimeUs(timeUs_t a, timeUs_t b) { return (timeDelta_t)(a - b); }
+
+typedef enum {
+    TZ_AUTO_DST_OFF,
+    TZ_AUTO_DST_EU,
+    TZ_AUTO_DST_USA,
+} tz_automatic_dst_e;
+
+typedef struct timeConfig_s {
+    int16_t tz_offset;
+    uint8_t tz_automatic_dst;
+} timeConfig_t;
+
+extern timeConfig_t timeConfig_System; extern timeConfig_t timeConfig_Copy; static inline const timeConfig_t* timeConfig(void) { return &timeConfig_System; } static inline timeConfig_t* timeConfigMutable(void) { return &timeConfig_System; } struct _dummy;
+
+
+typedef int64_t rtcTime_t;
+
+rtcTime_t rtcTimeMake(int32_t secs, uint16_t millis);
+int32_t rtcTimeGetSeconds(rtcTime_t *t);
+uint16_t rtcTimeGetMillis(rtcTime_t *t);
+
+typedef struct _dateTime_s {
+
+    uint16_t year;
+
+    uint8_t month;
+
+    uint8_t day;
+
+    uint8_t hours;
+
+    uint8_t minutes;
+
+    uint8_t seconds;
+
+    uint16_t millis;
+} dateTime_t;
+
+#define FORMATTED_DATE_TIME_BUFSIZE 30
+
+
+
+# 93 "./src/main/common/time.h" 3 4
+_Bool 
+# 93 "./src/main/common/time.h"
+    dateTimeFormatUTC(char *buf, dateTime_t *dt);
+
+# 94 "./src/main/common/time.h" 3 4
+_Bool 
+# 94 "./src/main/common/time.h"
+    dateTimeFormatLocal(char *buf, dateTime_t *dt);
+
+void dateTimeUTCToLocal(dateTime_t *localDateTime, const dateTime_t *utcDateTime);
+
+
+
+
+# 100 "./src/main/common/time.h" 3 4
+_Bool 
+# 100 "./src/main/common/time.h"
+    dateTimeSplitFormatted(char *formatted, char **date, char **time);
+
+
+# 102 "./src/main/common/time.h" 3 4
+_Bool 
+# 102 "./src/main/common/time.h"
+    rtcHasTime(void);
+
+
+# 104 "./src/main/common/time.h" 3 4
+_Bool 
+# 104 "./src/main/common/time.h"
+    rtcGet(rtcTime_t *t);
+
+# 105 "./src/main/common/time.h" 3 4
+_Bool 
+# 105 "./src/main/common/time.h"
+    rtcSet(rtcTime_t *t);
+
+
+# 107 "./src/main/common/time.h" 3 4
+_Bool 
+# 107 "./src/main/common/time.h"
+    rtcGetDateTime(dateTime_t *dt);
+
+# 108 "./src/main/common/time.h" 3 4
+_Bool 
+# 108 "./src/main/common/time.h"
+    rtcGetDateTimeLocal(dateTime_t *dt);
+
+# 109 "./src/main/common/time.h" 3 4
+_Bool 
+# 109 "./src/main/common/time.h"
+    rtcSetDateTime(dateTime_t *dt);
+# 29 "./src/main/flight/rpm_filter.h" 2
+
+typedef struct rpmFilterConfig_s {
+    uint8_t gyro_filter_enabled;
+    uint8_t dterm_filter_enabled;
+
+    uint8_t gyro_harmonics;
+    uint8_t gyro_min_hz;
+    uint16_t gyro_q;
+
+    uint8_t dterm_harmonics;
+    uint8_t dterm_min_hz;
+    uint16_t dterm_q;
+
+} rpmFilterConfig_t;
+
+extern rpmFilterConfig_t rpmFilterConfig_System; extern rpmFilterConfig_t rpmFilterConfig_Copy; static inline const rpmFilterConfig_t* rpmFilterConfig(void) { return &rpmFilterConfig_System; } static inline rpmFilterConfig_t* rpmFilterConfigMutable(void) { return &rpmFilterConfig_System; } struct _dummy;
+
+#define RPM_FILTER_UPDATE_RATE_HZ 500
+#define RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)
+
+void disableRpmFilters(void);
+void rpmFiltersInit(void);
+void rpmFilterUpdateTask(timeUs_t currentTimeUs);
+void rpmFilterGyroApply(float *values);
+# 13 "./src/main/fc/settings.c" 2
+# 1 "./obj/main/SITL/settings_generated.c" 1
+
+
+
+
+# 1 "./src/main/config/parameter_group_ids.h" 1
+# 19 "./src/main/config/parameter_group_ids.h"
+#define PG_CF_START 1
+#define PG_FAILSAFE_CONFIG 1
+#define PG_BOARD_ALIGNMENT 2
+
+#define PG_MOTOR_MIXER 4
+#define PG_BLACKBOX_CONFIG 5
+#define PG_MOTOR_CONFIG 6
+
+
+
+#define PG_GYRO_CONFIG 10
+#define PG_BATTERY_PROFILES 11
+#define PG_CONTROL_RATE_PROFILES 12
+#define PG_SERIAL_CONFIG 13
+#define PG_PID_PROFILE 14
+
+#define PG_ARMING_CONFIG 16
+
+#define PG_SYSTEM_CONFIG 18
+#define PG_FEATURE_CONFIG 19
+#define PG_MIXER_CONFIG 20
+#define PG_SERVO_MIXER 21
+#define PG_IMU_CONFIG 22
+
+#define PG_RX_CONFIG 24
+#define PG_RC_CONTROLS_CONFIG 25
+#define PG_REVERSIBLE_MOTORS_CONFIG 26
+#define PG_LED_STRIP_CONFIG 27
+
+
+#define PG_GPS_CONFIG 30
+#define PG_TELEMETRY_CONFIG 31
+
+
+
+#define PG_ACCELEROMETER_CONFIG 35
+
+
+#define PG_ADJUSTMENT_RANGE_CONFIG 37
+#define PG_BAROMETER_CONFIG 38
+
+#define PG_COMPASS_CONFIG 40
+#define PG_MODE_ACTIVATION_PROFILE 41
+
+#define PG_SERVO_PARAMS 42
+
+#define PG_RX_CHANNEL_RANGE_CONFIG 44
+#define PG_BATTERY_METERS_CONFIG 45
+
+
+
+
+
+
+
+#define PG_SERVO_CONFIG 52
+
+#define PG_VTX_CONFIG 54
+#define PG_ELERES_CONFIG 55
+#define PG_TEMP_SENSOR_CONFIG 56
+#define PG_CF_END 56
+
+
+
+
+
+
+#define PG_VTX_SETTINGS_CONFIG 259
+
+
+#define PG_INAV_START 1000
+#define PG_PITOTMETER_CONFIG 1000
+#define PG_POSITION_ESTIMATION_CONFIG 1001
+#define PG_NAV_CONFIG 1002
+#define PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003
+#define PG_OSD_CONFIG 1004
+#define PG_BEEPER_CONFIG 1005
+#define PG_RANGEFINDER_CONFIG 1006
+#define PG_WAYPOINT_MISSION_STORAGE 1007
+#define PG_PID_AUTOTUNE_CONFIG 1008
+#define PG_STATS_CONFIG 1009
+#define PG_ADC_CHANNEL_CONFIG 1010
+#define PG_TIME_CONFIG 1011
+#define PG_OPFLOW_CONFIG 1012
+#define PG_DISPLAY_CONFIG 1013
+#define PG_LIGHTS_CONFIG 1014
+#define PG_PINIOBOX_CONFIG 1015
+#define PG_LOGIC_CONDITIONS 1016
+#define PG_LOG_CONFIG 1017
+#define PG_RCDEVICE_CONFIG 1018
+#define PG_GENERAL_SETTINGS 1019
+#define PG_GLOBAL_FUNCTIONS 1020
+#define PG_ESC_SENSOR_CONFIG 1021
+#define PG_RPM_FILTER_CONFIG 1022
+#define PG_GLOBAL_VARIABLE_CONFIG 1023
+#define PG_INAV_END 1023
+
+
+
+
+
+
+
+#define PG_RESERVED_FOR_TESTING_1 4095
+#define PG_RESERVED_FOR_TESTING_2 4094
+#define PG_RESERVED_FOR_TESTING_3 4093
+
+#define PG_ID_INVALID 0
+#define PG_ID_FIRST PG_CF_START
+#define PG_ID_LAST PG_INAV_END
+# 6 "./obj/main/SITL/settings_generated.c" 2
+
+# 1 "./src/main/sensors/gyro.h" 1
+# 18 "./src/main/sensors/gyro.h"
+       
+
+# 1 "./src/main/common/axis.h" 1
+# 18 "./src/main/common/axis.h"
+       
+
+typedef enum {
+    X = 0,
+    Y,
+    Z
+} axis_e;
+
+#define XYZ_AXIS_COUNT 3
+
+
+typedef enum {
+    FD_ROLL = 0,
+    FD_PITCH,
+    FD_YAW
+} flight_dynamics_index_t;
+
+#define FLIGHT_DYNAMICS_INDEX_COUNT 3
+
+typedef enum {
+    AI_ROLL = 0,
+    AI_PITCH,
+} angle_index_t;
+
+#define ANGLE_INDEX_COUNT 2
+# 21 "./src/main/sensors/gyro.h" 2
+# 1 "./src/main/common/maths.h" 1
+# 18 "./src/main/common/maths.h"
+       
+
+
+
+
+
+#define sq(x) ((x)*(x))
+
+
+
+#define FAST_MATH 
+
+
+
+#define M_PIf 3.14159265358979323846f
+#define M_LN2f 0.69314718055994530942f
+#define M_Ef 2.71828182845904523536f
+
+#define RAD (M_PIf / 180.0f)
+
+#define DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)
+#define CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)
+
+#define CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)
+#define DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)
+
+#define DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)
+#define DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)
+
+#define DEGREES_PER_DEKADEGREE 10
+#define DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)
+#define DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)
+
+#define DEGREES_TO_RADIANS(angle) ((angle) * RAD)
+#define RADIANS_TO_DEGREES(angle) ((angle) / RAD)
+#define DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)
+#define RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)
+
+#define RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)
+#define CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)
+
+#define CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))
+#define CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))
+#define CENTIMETERS_TO_METERS(cm) (cm / 100)
+
+#define METERS_TO_CENTIMETERS(m) (m * 100)
+
+
+#define _CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))
+
+
+
+
+
+#define _CHOOSE_VAR2(prefix,unique) prefix ##unique
+#define _CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)
+#define _CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )
+
+
+
+
+
+#define MIN(a,b) _CHOOSE(<, a, b)
+#define MAX(a,b) _CHOOSE(>, a, b)
+
+#define _ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))
+
+
+
+
+#define _ABS_I(x,var) _ABS_II(x, var)
+#define ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))
+
+
+typedef struct fp_angles {
+    float roll;
+    float pitch;
+    float yaw;
+} fp_angles_def;
+
+typedef union {
+    float raw[3];
+    fp_angles_def angles;
+} fp_angles_t;
+
+typedef struct stdev_s
+{
+    float m_oldM, m_newM, m_oldS, m_newS;
+    int m_n;
+} stdev_t;
+
+typedef struct filterWithBufferSample_s {
+    float value;
+    uint32_t timestamp;
+} filterWithBufferSample_t;
+
+typedef struct filterWithBufferState_s {
+    uint16_t filter_size;
+    uint16_t sample_index;
+    filterWithBufferSample_t * samples;
+} filterWithBufferState_t;
+
+typedef struct {
+    float XtY[4];
+    float XtX[4][4];
+} sensorCalibrationState_t;
+
+void sensorCalibrationResetState(sensorCalibrationState_t * state);
+void sensorCalibrationPushSampleForOffsetCalculation(sensorCalibrationState_t * state, int32_t sample[3]);
+void sensorCalibrationPushSampleForScaleCalculation(sensorCalibrationState_t * state, int axis, int32_t sample[3], int target);
+
+# 128 "./src/main/common/maths.h" 3 4
+_Bool 
+# 128 "./src/main/common/maths.h"
+    sensorCalibrationSolveForOffset(sensorCalibrationState_t * state, float result[3]);
+
+# 129 "./src/main/common/maths.h" 3 4
+_Bool 
+# 129 "./src/main/common/maths.h"
+    sensorCalibrationSolveForScale(sensorCalibrationState_t * state, float result[3]);
+
+int gcd(int num, int denom);
+int32_t applyDeadband(int32_t value, int32_t deadband);
+float fapplyDeadbandf(float value, float deadband);
+
+int constrain(int amt, int low, int high);
+float constrainf(float amt, float low, float high);
+
+void devClear(stdev_t *dev);
+void devPush(stdev_t *dev, float x);
+float devVariance(stdev_t *dev);
+float devStandardDeviation(stdev_t *dev);
+float degreesToRadians(int16_t degrees);
+
+int scaleRange(int x, int srcMin, int srcMax, int destMin, int destMax);
+float scaleRangef(float x, float srcMin, float srcMax, float destMin, float destMax);
+
+int32_t wrap_18000(int32_t angle);
+int32_t wrap_36000(int32_t angle);
+
+int32_t quickMedianFilter3(int32_t * v);
+int32_t quickMedianFilter5(int32_t * v);
+int32_t quickMedianFilter7(int32_t * v);
+int32_t quickMedianFilter9(int32_t * v);
+
+int16_t quickMedianFilter3_16(int16_t * v);
+int16_t quickMedianFilter5_16(int16_t * v);
+
+
+float sin_approx(float x);
+float cos_approx(float x);
+float atan2_approx(float y, float x);
+float acos_approx(float x);
+#define tan_approx(x) (sin_approx(x) / cos_approx(x))
+#define asin_approx(x) (M_PIf / 2 - acos_approx(x))
+# 174 "./src/main/common/maths.h"
+void arraySubInt32(int32_t *dest, int32_t *array1, int32_t *array2, int count);
+
+float bellCurve(const float x, const float curveWidth);
+# 22 "./src/main/sensors/gyro.h" 2
+# 1 "./src/main/common/vector.h" 1
+# 18 "./src/main/common/vector.h"
+       
+
+
+# 1 "/usr/include/math.h" 1 3 4
+# 24 "/usr/include/math.h" 3 4
+#define _MATH_H 1
+
+#define __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION 
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION
+
+
+
+
+
+#undef __GLIBC_USE_LIB_EXT2
+
+
+
+
+#define __GLIBC_USE_LIB_EXT2 0
+# 67 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+#undef __GLIBC_USE_IEC_60559_BFP_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_BFP_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_BFP_EXT_C2X 0
+
+#undef __GLIBC_USE_IEC_60559_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_EXT 0
+
+
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT 0
+
+#undef __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X
+
+
+
+#define __GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0
+
+
+
+
+#undef __GLIBC_USE_IEC_60559_TYPES_EXT
+
+
+
+#define __GLIBC_USE_IEC_60559_TYPES_EXT 0
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 3 4
+#define _BITS_LIBM_SIMD_DECL_STUBS_H 1
+
+#define __DECL_SIMD_cos 
+#define __DECL_SIMD_cosf 
+#define __DECL_SIMD_cosl 
+#define __DECL_SIMD_cosf16 
+#define __DECL_SIMD_cosf32 
+#define __DECL_SIMD_cosf64 
+#define __DECL_SIMD_cosf128 
+#define __DECL_SIMD_cosf32x 
+#define __DECL_SIMD_cosf64x 
+#define __DECL_SIMD_cosf128x 
+
+#define __DECL_SIMD_sin 
+#define __DECL_SIMD_sinf 
+#define __DECL_SIMD_sinl 
+#define __DECL_SIMD_sinf16 
+#define __DECL_SIMD_sinf32 
+#define __DECL_SIMD_sinf64 
+#define __DECL_SIMD_sinf128 
+#define __DECL_SIMD_sinf32x 
+#define __DECL_SIMD_sinf64x 
+#define __DECL_SIMD_sinf128x 
+
+#define __DECL_SIMD_sincos 
+#define __DECL_SIMD_sincosf 
+#define __DECL_SIMD_sincosl 
+#define __DECL_SIMD_sincosf16 
+#define __DECL_SIMD_sincosf32 
+#define __DECL_SIMD_sincosf64 
+#define __DECL_SIMD_sincosf128 
+#define __DECL_SIMD_sincosf32x 
+#define __DECL_SIMD_sincosf64x 
+#define __DECL_SIMD_sincosf128x 
+
+#define __DECL_SIMD_log 
+#define __DECL_SIMD_logf 
+#define __DECL_SIMD_logl 
+#define __DECL_SIMD_logf16 
+#define __DECL_SIMD_logf32 
+#define __DECL_SIMD_logf64 
+#define __DECL_SIMD_logf128 
+#define __DECL_SIMD_logf32x 
+#define __DECL_SIMD_logf64x 
+#define __DECL_SIMD_logf128x 
+
+#define __DECL_SIMD_exp 
+#define __DECL_SIMD_expf 
+#define __DECL_SIMD_expl 
+#define __DECL_SIMD_expf16 
+#define __DECL_SIMD_expf32 
+#define __DECL_SIMD_expf64 
+#define __DECL_SIMD_expf128 
+#define __DECL_SIMD_expf32x 
+#define __DECL_SIMD_expf64x 
+#define __DECL_SIMD_expf128x 
+
+#define __DECL_SIMD_pow 
+#define __DECL_SIMD_powf 
+#define __DECL_SIMD_powl 
+#define __DECL_SIMD_powf16 
+#define __DECL_SIMD_powf32 
+#define __DECL_SIMD_powf64 
+#define __DECL_SIMD_powf128 
+#define __DECL_SIMD_powf32x 
+#define __DECL_SIMD_powf64x 
+#define __DECL_SIMD_powf128x 
+
+#define __DECL_SIMD_acos 
+#define __DECL_SIMD_acosf 
+#define __DECL_SIMD_acosl 
+#define __DECL_SIMD_acosf16 
+#define __DECL_SIMD_acosf32 
+#define __DECL_SIMD_acosf64 
+#define __DECL_SIMD_acosf128 
+#define __DECL_SIMD_acosf32x 
+#define __DECL_SIMD_acosf64x 
+#define __DECL_SIMD_acosf128x 
+
+#define __DECL_SIMD_atan 
+#define __DECL_SIMD_atanf 
+#define __DECL_SIMD_atanl 
+#define __DECL_SIMD_atanf16 
+#define __DECL_SIMD_atanf32 
+#define __DECL_SIMD_atanf64 
+#define __DECL_SIMD_atanf128 
+#define __DECL_SIMD_atanf32x 
+#define __DECL_SIMD_atanf64x 
+#define __DECL_SIMD_atanf128x 
+
+#define __DECL_SIMD_asin 
+#define __DECL_SIMD_asinf 
+#define __DECL_SIMD_asinl 
+#define __DECL_SIMD_asinf16 
+#define __DECL_SIMD_asinf32 
+#define __DECL_SIMD_asinf64 
+#define __DECL_SIMD_asinf128 
+#define __DECL_SIMD_asinf32x 
+#define __DECL_SIMD_asinf64x 
+#define __DECL_SIMD_asinf128x 
+
+#define __DECL_SIMD_hypot 
+#define __DECL_SIMD_hypotf 
+#define __DECL_SIMD_hypotl 
+#define __DECL_SIMD_hypotf16 
+#define __DECL_SIMD_hypotf32 
+#define __DECL_SIMD_hypotf64 
+#define __DECL_SIMD_hypotf128 
+#define __DECL_SIMD_hypotf32x 
+#define __DECL_SIMD_hypotf64x 
+#define __DECL_SIMD_hypotf128x 
+
+#define __DECL_SIMD_exp2 
+#define __DECL_SIMD_exp2f 
+#define __DECL_SIMD_exp2l 
+#define __DECL_SIMD_exp2f16 
+#define __DECL_SIMD_exp2f32 
+#define __DECL_SIMD_exp2f64 
+#define __DECL_SIMD_exp2f128 
+#define __DECL_SIMD_exp2f32x 
+#define __DECL_SIMD_exp2f64x 
+#define __DECL_SIMD_exp2f128x 
+
+#define __DECL_SIMD_exp10 
+#define __DECL_SIMD_exp10f 
+#define __DECL_SIMD_exp10l 
+#define __DECL_SIMD_exp10f16 
+#define __DECL_SIMD_exp10f32 
+#define __DECL_SIMD_exp10f64 
+#define __DECL_SIMD_exp10f128 
+#define __DECL_SIMD_exp10f32x 
+#define __DECL_SIMD_exp10f64x 
+#define __DECL_SIMD_exp10f128x 
+
+#define __DECL_SIMD_cosh 
+#define __DECL_SIMD_coshf 
+#define __DECL_SIMD_coshl 
+#define __DECL_SIMD_coshf16 
+#define __DECL_SIMD_coshf32 
+#define __DECL_SIMD_coshf64 
+#define __DECL_SIMD_coshf128 
+#define __DECL_SIMD_coshf32x 
+#define __DECL_SIMD_coshf64x 
+#define __DECL_SIMD_coshf128x 
+
+#define __DECL_SIMD_expm1 
+#define __DECL_SIMD_expm1f 
+#define __DECL_SIMD_expm1l 
+#define __DECL_SIMD_expm1f16 
+#define __DECL_SIMD_expm1f32 
+#define __DECL_SIMD_expm1f64 
+#define __DECL_SIMD_expm1f128 
+#define __DECL_SIMD_expm1f32x 
+#define __DECL_SIMD_expm1f64x 
+#define __DECL_SIMD_expm1f128x 
+
+#define __DECL_SIMD_sinh 
+#define __DECL_SIMD_sinhf 
+#define __DECL_SIMD_sinhl 
+#define __DECL_SIMD_sinhf16 
+#define __DECL_SIMD_sinhf32 
+#define __DECL_SIMD_sinhf64 
+#define __DECL_SIMD_sinhf128 
+#define __DECL_SIMD_sinhf32x 
+#define __DECL_SIMD_sinhf64x 
+#define __DECL_SIMD_sinhf128x 
+
+#define __DECL_SIMD_cbrt 
+#define __DECL_SIMD_cbrtf 
+#define __DECL_SIMD_cbrtl 
+#define __DECL_SIMD_cbrtf16 
+#define __DECL_SIMD_cbrtf32 
+#define __DECL_SIMD_cbrtf64 
+#define __DECL_SIMD_cbrtf128 
+#define __DECL_SIMD_cbrtf32x 
+#define __DECL_SIMD_cbrtf64x 
+#define __DECL_SIMD_cbrtf128x 
+
+#define __DECL_SIMD_atan2 
+#define __DECL_SIMD_atan2f 
+#define __DECL_SIMD_atan2l 
+#define __DECL_SIMD_atan2f16 
+#define __DECL_SIMD_atan2f32 
+#define __DECL_SIMD_atan2f64 
+#define __DECL_SIMD_atan2f128 
+#define __DECL_SIMD_atan2f32x 
+#define __DECL_SIMD_atan2f64x 
+#define __DECL_SIMD_atan2f128x 
+
+#define __DECL_SIMD_log10 
+#define __DECL_SIMD_log10f 
+#define __DECL_SIMD_log10l 
+#define __DECL_SIMD_log10f16 
+#define __DECL_SIMD_log10f32 
+#define __DECL_SIMD_log10f64 
+#define __DECL_SIMD_log10f128 
+#define __DECL_SIMD_log10f32x 
+#define __DECL_SIMD_log10f64x 
+#define __DECL_SIMD_log10f128x 
+
+#define __DECL_SIMD_log2 
+#define __DECL_SIMD_log2f 
+#define __DECL_SIMD_log2l 
+#define __DECL_SIMD_log2f16 
+#define __DECL_SIMD_log2f32 
+#define __DECL_SIMD_log2f64 
+#define __DECL_SIMD_log2f128 
+#define __DECL_SIMD_log2f32x 
+#define __DECL_SIMD_log2f64x 
+#define __DECL_SIMD_log2f128x 
+
+#define __DECL_SIMD_log1p 
+#define __DECL_SIMD_log1pf 
+#define __DECL_SIMD_log1pl 
+#define __DECL_SIMD_log1pf16 
+#define __DECL_SIMD_log1pf32 
+#define __DECL_SIMD_log1pf64 
+#define __DECL_SIMD_log1pf128 
+#define __DECL_SIMD_log1pf32x 
+#define __DECL_SIMD_log1pf64x 
+#define __DECL_SIMD_log1pf128x 
+
+#define __DECL_SIMD_atanh 
+#define __DECL_SIMD_atanhf 
+#define __DECL_SIMD_atanhl 
+#define __DECL_SIMD_atanhf16 
+#define __DECL_SIMD_atanhf32 
+#define __DECL_SIMD_atanhf64 
+#define __DECL_SIMD_atanhf128 
+#define __DECL_SIMD_atanhf32x 
+#define __DECL_SIMD_atanhf64x 
+#define __DECL_SIMD_atanhf128x 
+
+#define __DECL_SIMD_acosh 
+#define __DECL_SIMD_acoshf 
+#define __DECL_SIMD_acoshl 
+#define __DECL_SIMD_acoshf16 
+#define __DECL_SIMD_acoshf32 
+#define __DECL_SIMD_acoshf64 
+#define __DECL_SIMD_acoshf128 
+#define __DECL_SIMD_acoshf32x 
+#define __DECL_SIMD_acoshf64x 
+#define __DECL_SIMD_acoshf128x 
+
+#define __DECL_SIMD_erf 
+#define __DECL_SIMD_erff 
+#define __DECL_SIMD_erfl 
+#define __DECL_SIMD_erff16 
+#define __DECL_SIMD_erff32 
+#define __DECL_SIMD_erff64 
+#define __DECL_SIMD_erff128 
+#define __DECL_SIMD_erff32x 
+#define __DECL_SIMD_erff64x 
+#define __DECL_SIMD_erff128x 
+
+#define __DECL_SIMD_tanh 
+#define __DECL_SIMD_tanhf 
+#define __DECL_SIMD_tanhl 
+#define __DECL_SIMD_tanhf16 
+#define __DECL_SIMD_tanhf32 
+#define __DECL_SIMD_tanhf64 
+#define __DECL_SIMD_tanhf128 
+#define __DECL_SIMD_tanhf32x 
+#define __DECL_SIMD_tanhf64x 
+#define __DECL_SIMD_tanhf128x 
+
+#define __DECL_SIMD_asinh 
+#define __DECL_SIMD_asinhf 
+#define __DECL_SIMD_asinhl 
+#define __DECL_SIMD_asinhf16 
+#define __DECL_SIMD_asinhf32 
+#define __DECL_SIMD_asinhf64 
+#define __DECL_SIMD_asinhf128 
+#define __DECL_SIMD_asinhf32x 
+#define __DECL_SIMD_asinhf64x 
+#define __DECL_SIMD_asinhf128x 
+
+#define __DECL_SIMD_erfc 
+#define __DECL_SIMD_erfcf 
+#define __DECL_SIMD_erfcl 
+#define __DECL_SIMD_erfcf16 
+#define __DECL_SIMD_erfcf32 
+#define __DECL_SIMD_erfcf64 
+#define __DECL_SIMD_erfcf128 
+#define __DECL_SIMD_erfcf32x 
+#define __DECL_SIMD_erfcf64x 
+#define __DECL_SIMD_erfcf128x 
+
+#define __DECL_SIMD_tan 
+#define __DECL_SIMD_tanf 
+#define __DECL_SIMD_tanl 
+#define __DECL_SIMD_tanf16 
+#define __DECL_SIMD_tanf32 
+#define __DECL_SIMD_tanf64 
+#define __DECL_SIMD_tanf128 
+#define __DECL_SIMD_tanf32x 
+#define __DECL_SIMD_tanf64x 
+#define __DECL_SIMD_tanf128x 
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define _BITS_FLOATN_H 
+# 33 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __HAVE_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_DISTINCT_FLOAT128 1
+
+
+
+
+
+
+
+#define __HAVE_FLOAT64X 1
+
+
+
+
+
+#define __HAVE_FLOAT64X_LONG_DOUBLE 1
+# 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __f128(x) x ##f128
+# 78 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+#define __CFLOAT128 _Complex _Float128
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define _BITS_FLOATN_COMMON_H 
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 3 4
+#define __LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_FLOAT16 0
+#define __HAVE_FLOAT32 1
+#define __HAVE_FLOAT64 1
+#define __HAVE_FLOAT32X 1
+#define __HAVE_FLOAT128X 0
+# 52 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16
+#define __HAVE_DISTINCT_FLOAT32 0
+#define __HAVE_DISTINCT_FLOAT64 0
+#define __HAVE_DISTINCT_FLOAT32X 0
+#define __HAVE_DISTINCT_FLOAT64X 0
+#define __HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X
+
+
+
+
+
+#define __HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)
+
+
+
+
+
+
+#define __HAVE_FLOATN_NOT_TYPEDEF 1
+# 93 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f32(x) x ##f32
+# 105 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64(x) x ##f64
+
+
+
+
+
+
+
+#define __f32x(x) x ##f32x
+# 125 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __f64x(x) x ##f64x
+# 151 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT32 _Complex _Float32
+# 163 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64 _Complex _Float64
+
+
+
+
+
+
+
+#define __CFLOAT32X _Complex _Float32x
+# 183 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+#define __CFLOAT64X _Complex _Float64x
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 44 "/usr/include/math.h" 2 3 4
+
+
+
+
+#define HUGE_VAL (__builtin_huge_val ())
+# 59 "/usr/include/math.h" 3 4
+#define HUGE_VALF (__builtin_huge_valf ())
+#define HUGE_VALL (__builtin_huge_vall ())
+# 91 "/usr/include/math.h" 3 4
+#define INFINITY (__builtin_inff ())
+
+
+
+
+
+
+#define NAN (__builtin_nanf (""))
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 3 4
+#define __GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 3 4
+#define __FP_LOGB0_IS_MIN 1
+#define __FP_LOGBNAN_IS_MIN 1
+# 205 "/usr/include/math.h" 2 3 4
+
+
+#define FP_ILOGB0 (-2147483647 - 1)
+
+
+
+
+#define FP_ILOGBNAN (-2147483647 - 1)
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+# 276 "/usr/include/math.h" 3 4
+#define __SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)
+
+#define __MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)
+
+
+
+#define __MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)
+
+
+
+#define __MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)
+
+#define __MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)
+
+
+#define __MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)
+
+#define __MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)
+
+
+#define __MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW
+
+#define __MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)
+
+
+
+#define __MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)
+
+
+#define __MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)
+
+
+#define _Mdouble_ double
+#define __MATH_PRECNAME(name,r) __CONCAT(name,r)
+#define __MATH_DECLARING_DOUBLE 1
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+
+
+
+
+#define _Mdouble_ float
+#define __MATH_PRECNAME(name,r) name ##f ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 393 "/usr/include/math.h" 3 4
+#define _Mdouble_ long double
+#define __MATH_PRECNAME(name,r) name ##l ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 0
+#define __MATH_DECLARE_LDOUBLE 1
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 442 "/usr/include/math.h" 3 4
+#define _Mdouble_ _Float32
+#define __MATH_PRECNAME(name,r) name ##f32 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64
+#define __MATH_PRECNAME(name,r) name ##f64 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float128
+#define __MATH_PRECNAME(name,r) name ##f128 ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float32x
+#define __MATH_PRECNAME(name,r) name ##f32x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+
+
+
+#define _Mdouble_ _Float64x
+#define __MATH_PRECNAME(name,r) name ##f64x ##r
+#define __MATH_DECLARING_DOUBLE 0
+#define __MATH_DECLARING_FLOATN 1
+
+
+
+
+
+
+#undef _Mdouble_
+#undef __MATH_PRECNAME
+#undef __MATH_DECLARING_DOUBLE
+#undef __MATH_DECLARING_FLOATN
+# 543 "/usr/include/math.h" 3 4
+#undef __MATHDECL_1_IMPL
+#undef __MATHDECL_1
+#undef __MATHDECL_ALIAS
+#undef __MATHDECL
+#undef __MATHCALL
+
+
+#define __MATHCALL_NARROW_ARGS_1 (_Marg_ __x)
+#define __MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)
+#define __MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)
+#define __MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW
+
+#define __MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)
+
+
+#define __MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)
+# 845 "/usr/include/math.h" 3 4
+#undef __MATHCALL_NARROW_ARGS_1
+#undef __MATHCALL_NARROW_ARGS_2
+#undef __MATHCALL_NARROW_ARGS_3
+#undef __MATHCALL_NARROW_NORMAL
+#undef __MATHCALL_NARROW_REDIR
+#undef __MATHCALL_NARROW
+
+
+
+extern int signgam;
+# 884 "/usr/include/math.h" 3 4
+#define __MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,
+
+
+
+
+
+#define __MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,
+
+
+
+
+
+
+#define __MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+#define FP_NAN 0
+      0,
+    FP_INFINITE =
+#define FP_INFINITE 1
+      1,
+    FP_ZERO =
+#define FP_ZERO 2
+      2,
+    FP_SUBNORMAL =
+#define FP_SUBNORMAL 3
+      3,
+    FP_NORMAL =
+#define FP_NORMAL 4
+      4
+  };
+# 967 "/usr/include/math.h" 3 4
+#define fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)
+
+
+
+
+
+
+
+#define signbit(x) __builtin_signbit (x)
+# 994 "/usr/include/math.h" 3 4
+#define isfinite(x) __builtin_isfinite (x)
+
+
+
+
+
+
+
+#define isnormal(x) __builtin_isnormal (x)
+# 1011 "/usr/include/math.h" 3 4
+#define isnan(x) __builtin_isnan (x)
+# 1029 "/usr/include/math.h" 3 4
+#define isinf(x) __builtin_isinf_sign (x)
+
+
+
+
+
+#define MATH_ERRNO 1
+#define MATH_ERREXCEPT 2
+# 1048 "/usr/include/math.h" 3 4
+#define math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)
+# 1146 "/usr/include/math.h" 3 4
+#define M_E 2.7182818284590452354
+#define M_LOG2E 1.4426950408889634074
+#define M_LOG10E 0.43429448190325182765
+#define M_LN2 0.69314718055994530942
+#define M_LN10 2.30258509299404568402
+#define M_PI 3.14159265358979323846
+#define M_PI_2 1.57079632679489661923
+#define M_PI_4 0.78539816339744830962
+#define M_1_PI 0.31830988618379067154
+#define M_2_PI 0.63661977236758134308
+#define M_2_SQRTPI 1.12837916709551257390
+#define M_SQRT2 1.41421356237309504880
+#define M_SQRT1_2 0.70710678118654752440
+# 1305 "/usr/include/math.h" 3 4
+#define isgreater(x,y) __builtin_isgreater(x, y)
+#define isgreaterequal(x,y) __builtin_isgreaterequal(x, y)
+#define isless(x,y) __builtin_isless(x, y)
+#define islessequal(x,y) __builtin_islessequal(x, y)
+#define islessgreater(x,y) __builtin_islessgreater(x, y)
+#define isunordered(x,y) __builtin_isunordered(x, y)
+# 1471 "/usr/include/math.h" 3 4
+
+# 22 "./src/main/common/vector.h" 2
+
+
+
+
+# 25 "./src/main/common/vector.h"
+typedef union {
+    float v[3];
+    struct {
+       float x,y,z;
+    };
+} fpVector3_t;
+
+typedef struct {
+    float m[3][3];
+} fpMat3_t;
+
+typedef struct {
+    fpVector3_t axis;
+    float angle;
+} fpAxisAngle_t;
+
+void rotationMatrixFromAngles(fpMat3_t * rmat, const fp_angles_t * angles);
+void rotationMatrixFromAxisAngle(fpMat3_t * rmat, const fpAxisAngle_t * a);
+
+static inline void vectorZero(fpVector3_t * v)
+{
+    v->x = 0.0f;
+    v->y = 0.0f;
+    v->z = 0.0f;
+}
+
+static inline fpVector3_t * rotationMatrixRotateVector(fpVector3_t * result, const fpVector3_t * a, const fpMat3_t * rmat)
+{
+    fpVector3_t r;
+
+    r.x = rmat->m[0][0] * a->x + rmat->m[1][0] * a->y + rmat->m[2][0] * a->z;
+    r.y = rmat->m[0][1] * a->x + rmat->m[1][1] * a->y + rmat->m[2][1] * a->z;
+    r.z = rmat->m[0][2] * a->x + rmat->m[1][2] * a->y + rmat->m[2][2] * a->z;
+
+    *result = r;
+    return result;
+}
+
+static inline float vectorNormSquared(const fpVector3_t * v)
+{
+    return ((v->x)*(v->x)) + ((v->y)*(v->y)) + ((v->z)*(v->z));
+}
+
+static inline fpVector3_t * vectorNormalize(fpVector3_t * result, const fpVector3_t * v)
+{
+    float length = sqrtf(vectorNormSquared(v));
+    if (length != 0) {
+        result->x = v->x / length;
+        result->y = v->y / length;
+        result->z = v->z / length;
+    }
+    else {
+        result->x = 0;
+        result->y = 0;
+        result->z = 0;
+    }
+    return result;
+}
+
+static inline fpVector3_t * vectorCrossProduct(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->y * b->z - a->z * b->y;
+    ab.y = a->z * b->x - a->x * b->z;
+    ab.z = a->x * b->y - a->y * b->x;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorAdd(fpVector3_t * result, const fpVector3_t * a, const fpVector3_t * b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x + b->x;
+    ab.y = a->y + b->y;
+    ab.z = a->z + b->z;
+
+    *result = ab;
+    return result;
+}
+
+static inline fpVector3_t * vectorScale(fpVector3_t * result, const fpVector3_t * a, const float b)
+{
+    fpVector3_t ab;
+
+    ab.x = a->x * b;
+    ab.y = a->y * b;
+    ab.z = a->z * b;
+
+    *result = ab;
+    return result;
+}
+# 23 "./src/main/sensors/gyro.h" 2
+
+
+# 1 "./src/main/drivers/sensor.h" 1
+# 18 "./src/main/drivers/sensor.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/io_types.h" 1
+       
+
+
+
+
+
+typedef uint8_t ioTag_t;
+typedef void* IO_t;
+
+
+#define IOTAG_NONE ((ioTag_t)0)
+
+
+#define IO_NONE ((IO_t)0)
+# 28 "./src/main/drivers/io_types.h"
+typedef uint8_t ioConfig_t;
+# 24 "./src/main/drivers/sensor.h" 2
+# 1 "./src/main/drivers/bus.h" 1
+# 25 "./src/main/drivers/bus.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/resource.h" 1
+# 18 "./src/main/drivers/resource.h"
+       
+
+#define RESOURCE_INDEX(x) (x + 1)
+
+typedef enum {
+    OWNER_FREE = 0,
+    OWNER_PWMIO,
+    OWNER_PWMINPUT,
+    OWNER_PPMINPUT,
+    OWNER_MOTOR,
+    OWNER_SERVO,
+    OWNER_SOFTSERIAL,
+    OWNER_ADC,
+    OWNER_SERIAL,
+    OWNER_PINDEBUG,
+    OWNER_TIMER,
+    OWNER_RANGEFINDER,
+    OWNER_SYSTEM,
+    OWNER_SPI,
+    OWNER_I2C,
+    OWNER_SDCARD,
+    OWNER_FLASH,
+    OWNER_USB,
+    OWNER_BEEPER,
+    OWNER_OSD,
+    OWNER_BARO,
+    OWNER_MPU,
+    OWNER_INVERTER,
+    OWNER_LED_STRIP,
+    OWNER_LED,
+    OWNER_RX,
+    OWNER_TX,
+    OWNER_RX_SPI,
+    OWNER_VTX,
+    OWNER_SPI_PREINIT,
+    OWNER_COMPASS,
+    OWNER_TEMPERATURE,
+    OWNER_1WIRE,
+    OWNER_AIRSPEED,
+    OWNER_OLED_DISPLAY,
+    OWNER_PINIO,
+    OWNER_IRLOCK,
+    OWNER_TOTAL_COUNT
+} resourceOwner_e;
+
+extern const char * const ownerNames[OWNER_TOTAL_COUNT];
+
+
+
+typedef enum {
+    RESOURCE_NONE = 0,
+    RESOURCE_INPUT, RESOURCE_OUTPUT, RESOURCE_IO,
+    RESOURCE_TIMER,
+    RESOURCE_UART_TX, RESOURCE_UART_RX, RESOURCE_UART_TXRX,
+    RESOURCE_EXTI,
+    RESOURCE_I2C_SCL, RESOURCE_I2C_SDA,
+    RESOURCE_SPI_SCK, RESOURCE_SPI_MOSI, RESOURCE_SPI_MISO, RESOURCE_SPI_CS,
+    RESOURCE_ADC_CH1, RESOURCE_ADC_CH2, RESOURCE_ADC_CH3, RESOURCE_ADC_CH4,
+    RESOURCE_RX_CE,
+    RESOURCE_TOTAL_COUNT
+} resourceType_e;
+
+extern const char * const resourceNames[RESOURCE_TOTAL_COUNT];
+# 33 "./src/main/drivers/bus.h" 2
+# 1 "./src/main/drivers/bus_i2c.h" 1
+# 18 "./src/main/drivers/bus_i2c.h"
+       
+
+
+
+
+
+
+#define I2C_TIMEOUT (10000)
+
+
+# 1 "./src/main/drivers/rcc_types.h" 1
+       
+
+typedef uint8_t rccPeriphTag_t;
+# 29 "./src/main/drivers/bus_i2c.h" 2
+
+typedef enum {
+    I2C_SPEED_100KHZ = 2,
+    I2C_SPEED_200KHZ = 3,
+    I2C_SPEED_400KHZ = 0,
+    I2C_SPEED_800KHZ = 1,
+} I2CSpeed;
+
+typedef enum I2CDevice {
+    I2CINVALID = -1,
+    I2CDEV_EMULATED = -1,
+    I2CDEV_1 = 0,
+    I2CDEV_2,
+    I2CDEV_3,
+
+
+
+    I2CDEV_COUNT
+} I2CDevice;
+
+typedef struct i2cDevice_s {
+    I2C_TypeDef *dev;
+    ioTag_t scl;
+    ioTag_t sda;
+    rccPeriphTag_t rcc;
+    I2CSpeed speed;
+
+
+
+
+
+} i2cDevice_t;
+
+void i2cSetSpeed(uint8_t speed);
+void i2cInit(I2CDevice device);
+
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+    i2cWriteBuffer(I2CDevice device, uint8_t addr_, uint8_t reg_, uint8_t len_, const uint8_t *data, 
+# 64 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                                     _Bool 
+# 64 "./src/main/drivers/bus_i2c.h"
+                                                                                                          allowRawAccess);
+
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+    i2cWrite(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t data, 
+# 65 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                         _Bool 
+# 65 "./src/main/drivers/bus_i2c.h"
+                                                                              allowRawAccess);
+
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+_Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+    i2cRead(I2CDevice device, uint8_t addr_, uint8_t reg, uint8_t len, uint8_t* buf, 
+# 66 "./src/main/drivers/bus_i2c.h" 3 4
+                                                                                     _Bool 
+# 66 "./src/main/drivers/bus_i2c.h"
+                                                                                          allowRawAccess);
+
+uint16_t i2cGetErrorCounter(void);
+# 34 "./src/main/drivers/bus.h" 2
+# 1 "./src/main/drivers/bus_spi.h" 1
+# 18 "./src/main/drivers/bus_spi.h"
+       
+
+
+
+# 1 "./src/main/drivers/dma.h" 1
+# 18 "./src/main/drivers/dma.h"
+       
+
+
+
+struct dmaChannelDescriptor_s;
+
+typedef uint16_t dmaTag_t;
+typedef struct dmaChannelDescriptor_s * DMA_t;
+
+
+
+
+
+#define DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )
+#define DMA_NONE (0)
+
+#define DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )
+#define DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )
+#define DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )
+
+typedef void (*dmaCallbackHandlerFuncPtr)(DMA_t channelDescriptor);
+
+typedef struct dmaChannelDescriptor_s {
+    dmaTag_t tag;
+    DMA_TypeDef* dma;
+
+
+
+    DMA_Channel_TypeDef* ref;
+
+    dmaCallbackHandlerFuncPtr irqHandlerCallback;
+    uint32_t flagsShift;
+    IRQn_Type irqNumber;
+    uint32_t userParam;
+    resourceOwner_e owner;
+    uint8_t resourceIndex;
+} dmaChannelDescriptor_t;
+# 87 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }
+# 97 "./src/main/drivers/dma.h"
+#define DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }
+
+
+
+
+#define DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)
+#define DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))
+
+#define DMA_IT_TCIF ((uint32_t)0x00000002)
+#define DMA_IT_HTIF ((uint32_t)0x00000004)
+#define DMA_IT_TEIF ((uint32_t)0x00000008)
+
+DMA_t dmaGetByRef(const DMA_Channel_TypeDef * ref);
+
+
+
+DMA_t dmaGetByTag(dmaTag_t tag);
+uint32_t dmaGetChannelByTag(dmaTag_t tag);
+resourceOwner_e dmaGetOwner(DMA_t dma);
+void dmaInit(DMA_t dma, resourceOwner_e owner, uint8_t resourceIndex);
+void dmaEnableClock(DMA_t dma);
+void dmaSetHandler(DMA_t dma, dmaCallbackHandlerFuncPtr callback, uint32_t priority, uint32_t userParam);
+void dmaCleanInterrupts(DMA_t dma);
+# 23 "./src/main/drivers/bus_spi.h" 2
+# 41 "./src/main/drivers/bus_spi.h"
+typedef enum {
+    SPI_CLOCK_INITIALIZATON = 0,
+    SPI_CLOCK_SLOW = 1,
+    SPI_CLOCK_STANDARD = 2,
+    SPI_CLOCK_FAST = 3,
+    SPI_CLOCK_ULTRAFAST = 4
+} SPIClockSpeed_e;
+
+typedef enum SPIDevice {
+    SPIINVALID = -1,
+    SPIDEV_1 = 0,
+    SPIDEV_2,
+    SPIDEV_3,
+    SPIDEV_4
+} SPIDevice;
+
+
+
+
+
+
+#define SPIDEV_COUNT 4
+
+
+typedef struct SPIDevice_s {
+    SPI_TypeDef *dev;
+    ioTag_t nss;
+    ioTag_t sck;
+    ioTag_t mosi;
+    ioTag_t miso;
+    rccPeriphTag_t rcc;
+    uint8_t af;
+    const uint16_t * divisorMap;
+    volatile uint16_t errorCount;
+    
+# 75 "./src/main/drivers/bus_spi.h" 3 4
+   _Bool 
+# 75 "./src/main/drivers/bus_spi.h"
+        initDone;
+} spiDevice_t;
+
+
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+    spiInitDevice(SPIDevice device, 
+# 78 "./src/main/drivers/bus_spi.h" 3 4
+                                    _Bool 
+# 78 "./src/main/drivers/bus_spi.h"
+                                         leadingEdge);
+
+# 79 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 79 "./src/main/drivers/bus_spi.h"
+    spiIsBusBusy(SPI_TypeDef *instance);
+void spiSetSpeed(SPI_TypeDef *instance, SPIClockSpeed_e speed);
+uint8_t spiTransferByte(SPI_TypeDef *instance, uint8_t in);
+
+# 82 "./src/main/drivers/bus_spi.h" 3 4
+_Bool 
+# 82 "./src/main/drivers/bus_spi.h"
+    spiTransfer(SPI_TypeDef *instance, uint8_t *rxData, const uint8_t *txData, int len);
+
+uint16_t spiGetErrorCounter(SPI_TypeDef *instance);
+void spiResetErrorCounter(SPI_TypeDef *instance);
+SPIDevice spiDeviceByInstance(SPI_TypeDef *instance);
+SPI_TypeDef * spiInstanceByDevice(SPIDevice device);
+# 35 "./src/main/drivers/bus.h" 2
+
+
+#define BUS_SPI1 SPIDEV_1
+#define BUS_SPI2 SPIDEV_2
+#define BUS_SPI3 SPIDEV_3
+#define BUS_SPI4 SPIDEV_4
+
+#define BUS_I2C1 I2CDEV_1
+#define BUS_I2C2 I2CDEV_2
+#define BUS_I2C3 I2CDEV_3
+#define BUS_I2C4 I2CDEV_4
+#define BUS_I2C_EMULATED I2CINVALID
+
+#define BUS_SCRATCHPAD_MEMORY_SIZE (20)
+
+typedef enum {
+    BUS_SPEED_INITIALIZATION = 0,
+    BUS_SPEED_SLOW = 1,
+    BUS_SPEED_STANDARD = 2,
+    BUS_SPEED_FAST = 3,
+    BUS_SPEED_ULTRAFAST = 4
+} busSpeed_e;
+
+typedef enum {
+    BUSTYPE_ANY = 0,
+    BUSTYPE_NONE = 0,
+    BUSTYPE_I2C = 1,
+    BUSTYPE_SPI = 2,
+    BUSTYPE_SDIO = 3,
+} busType_e;
+
+typedef enum {
+    BUSINDEX_1 = 0,
+    BUSINDEX_2 = 1,
+    BUSINDEX_3 = 2,
+    BUSINDEX_4 = 3
+} busIndex_e;
+
+
+
+typedef enum {
+    DEVHW_NONE = 0,
+
+
+    DEVHW_BMA280,
+    DEVHW_ADXL345,
+    DEVHW_MMA8452,
+    DEVHW_LSM303DLHC,
+
+
+    DEVHW_L3GD20,
+    DEVHW_L3G4200,
+
+
+    DEVHW_MPU3050,
+    DEVHW_MPU6000,
+    DEVHW_MPU6050,
+    DEVHW_MPU6500,
+    DEVHW_BMI160,
+    DEVHW_ICM20689,
+
+
+    DEVHW_MPU9250,
+
+
+    DEVHW_BMP085,
+    DEVHW_BMP280,
+    DEVHW_MS5611,
+    DEVHW_MS5607,
+    DEVHW_LPS25H,
+    DEVHW_SPL06,
+    DEVHW_BMP388,
+    DEVHW_DPS310,
+
+
+    DEVHW_HMC5883,
+    DEVHW_AK8963,
+    DEVHW_AK8975,
+    DEVHW_IST8310_0,
+    DEVHW_IST8310_1,
+    DEVHW_IST8308,
+    DEVHW_QMC5883,
+    DEVHW_MAG3110,
+    DEVHW_LIS3MDL,
+
+
+    DEVHW_LM75_0,
+    DEVHW_LM75_1,
+    DEVHW_LM75_2,
+    DEVHW_LM75_3,
+    DEVHW_LM75_4,
+    DEVHW_LM75_5,
+    DEVHW_LM75_6,
+    DEVHW_LM75_7,
+
+
+    DEVHW_DS2482,
+
+
+    DEVHW_MAX7456,
+
+
+    DEVHW_SRF10,
+    DEVHW_HCSR04_I2C,
+    DEVHW_VL53L0X,
+
+
+    DEVHW_MS4525,
+    DEVHW_PCA9685,
+    DEVHW_M25P16,
+    DEVHW_UG2864,
+    DEVHW_SDCARD,
+    DEVHW_IRLOCK,
+} devHardwareType_e;
+
+typedef enum {
+    DEVFLAGS_NONE = 0,
+    DEVFLAGS_USE_RAW_REGISTERS = (1 << 0),
+
+
+    DEVFLAGS_USE_MANUAL_DEVICE_SELECT = (1 << 1),
+    DEVFLAGS_SPI_MODE_0 = (1 << 2),
+} deviceFlags_e;
+
+typedef struct busDeviceDescriptor_s {
+    void * devicePtr;
+    busType_e busType;
+    devHardwareType_e devHwType;
+    uint8_t flags;
+    uint8_t tag;
+    uint8_t param;
+    union {
+# 179 "./src/main/drivers/bus.h"
+    } busdev;
+    ioTag_t irqPin;
+} busDeviceDescriptor_t;
+
+typedef struct busDevice_s {
+    const busDeviceDescriptor_t * descriptorPtr;
+    busType_e busType;
+    uint32_t flags;
+    uint32_t param;
+    union {
+# 201 "./src/main/drivers/bus.h"
+    } busdev;
+    IO_t irqPin;
+    uint32_t * scratchpad;
+
+
+} busDevice_t;
+
+
+
+
+
+
+extern const busDeviceDescriptor_t __busdev_registry_start[];
+extern const busDeviceDescriptor_t __busdev_registry_end[];
+#define BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(".busdev_registry"), used, aligned(4)))
+
+
+#define BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 237 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) extern const busDeviceDescriptor_t _name ## _registry; static busDevice_t _name ## _memory; const busDeviceDescriptor_t _name ## _registry BUSDEV_REGISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy
+# 256 "./src/main/drivers/bus.h"
+#define BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)
+
+
+#define BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)
+
+
+
+
+typedef struct busTransferDescriptor_s {
+    uint8_t * rxBuf;
+    const uint8_t * txBuf;
+    uint32_t length;
+} busTransferDescriptor_t;
+
+
+
+# 277 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 277 "./src/main/drivers/bus.h"
+    i2cBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 278 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 278 "./src/main/drivers/bus.h"
+    i2cBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 279 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 279 "./src/main/drivers/bus.h"
+    i2cBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 280 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 280 "./src/main/drivers/bus.h"
+    i2cBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+
+
+# 282 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 282 "./src/main/drivers/bus.h"
+    spiBusInitHost(const busDevice_t * dev);
+
+# 283 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 283 "./src/main/drivers/bus.h"
+    spiBusIsBusy(const busDevice_t * dev);
+void spiBusSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+# 285 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 285 "./src/main/drivers/bus.h"
+    spiBusTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 286 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 286 "./src/main/drivers/bus.h"
+    spiBusTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * dsc, int count);
+
+# 287 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 287 "./src/main/drivers/bus.h"
+    spiBusWriteBuffer(const busDevice_t * dev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 288 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 288 "./src/main/drivers/bus.h"
+    spiBusWriteRegister(const busDevice_t * dev, uint8_t reg, uint8_t data);
+
+# 289 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 289 "./src/main/drivers/bus.h"
+    spiBusReadBuffer(const busDevice_t * dev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 290 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 290 "./src/main/drivers/bus.h"
+    spiBusReadRegister(const busDevice_t * dev, uint8_t reg, uint8_t * data);
+void spiBusSelectDevice(const busDevice_t * dev);
+void spiBusDeselectDevice(const busDevice_t * dev);
+
+
+
+void busInit(void);
+
+
+busDevice_t * busDeviceInit(busType_e bus, devHardwareType_e hw, uint8_t tag, resourceOwner_e owner);
+busDevice_t * busDeviceOpen(busType_e bus, devHardwareType_e hw, uint8_t tag);
+void busDeviceDeInit(busDevice_t * dev);
+
+uint32_t busDeviceReadScratchpad(const busDevice_t * dev);
+void busDeviceWriteScratchpad(busDevice_t * dev, uint32_t value);
+void * busDeviceGetScratchpadMemory(const busDevice_t * dev);
+
+void busSetSpeed(const busDevice_t * dev, busSpeed_e speed);
+
+
+void busSelectDevice(const busDevice_t * dev);
+void busDeselectDevice(const busDevice_t * dev);
+
+
+# 313 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 313 "./src/main/drivers/bus.h"
+    busWriteBuf(const busDevice_t * busdev, uint8_t reg, const uint8_t * data, uint8_t length);
+
+# 314 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 314 "./src/main/drivers/bus.h"
+    busReadBuf(const busDevice_t * busdev, uint8_t reg, uint8_t * data, uint8_t length);
+
+# 315 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 315 "./src/main/drivers/bus.h"
+    busRead(const busDevice_t * busdev, uint8_t reg, uint8_t * data);
+
+# 316 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 316 "./src/main/drivers/bus.h"
+    busWrite(const busDevice_t * busdev, uint8_t reg, uint8_t data);
+
+
+# 318 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 318 "./src/main/drivers/bus.h"
+    busTransfer(const busDevice_t * dev, uint8_t * rxBuf, const uint8_t * txBuf, int length);
+
+# 319 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 319 "./src/main/drivers/bus.h"
+    busTransferMultiple(const busDevice_t * dev, busTransferDescriptor_t * buffers, int count);
+
+
+# 321 "./src/main/drivers/bus.h" 3 4
+_Bool 
+# 321 "./src/main/drivers/bus.h"
+    busIsBusy(const busDevice_t * dev);
+# 25 "./src/main/drivers/sensor.h" 2
+
+typedef enum {
+    ALIGN_DEFAULT = 0,
+    CW0_DEG = 1,
+    CW90_DEG = 2,
+    CW180_DEG = 3,
+    CW270_DEG = 4,
+    CW0_DEG_FLIP = 5,
+    CW90_DEG_FLIP = 6,
+    CW180_DEG_FLIP = 7,
+    CW270_DEG_FLIP = 8
+} sensor_align_e;
+
+typedef 
+# 38 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 38 "./src/main/drivers/sensor.h"
+            (*sensorInitFuncPtr)(void);
+typedef 
+# 39 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 39 "./src/main/drivers/sensor.h"
+            (*sensorReadFuncPtr)(int16_t *data);
+typedef 
+# 40 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 40 "./src/main/drivers/sensor.h"
+            (*sensorInterruptFuncPtr)(void);
+struct accDev_s;
+typedef void (*sensorAccInitFuncPtr)(struct accDev_s *acc);
+typedef 
+# 43 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 43 "./src/main/drivers/sensor.h"
+            (*sensorAccReadFuncPtr)(struct accDev_s *acc);
+struct gyroDev_s;
+typedef void (*sensorGyroInitFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 46 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 46 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 47 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 47 "./src/main/drivers/sensor.h"
+            (*sensorGyroUpdateFuncPtr)(struct gyroDev_s *gyro);
+typedef 
+# 48 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 48 "./src/main/drivers/sensor.h"
+            (*sensorGyroReadDataFuncPtr)(struct gyroDev_s *gyro, int16_t *data);
+typedef 
+# 49 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 49 "./src/main/drivers/sensor.h"
+            (*sensorGyroInterruptStatusFuncPtr)(struct gyroDev_s *gyro);
+struct magDev_s;
+typedef 
+# 51 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 51 "./src/main/drivers/sensor.h"
+            (*sensorMagInitFuncPtr)(struct magDev_s *mag);
+typedef 
+# 52 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 52 "./src/main/drivers/sensor.h"
+            (*sensorMagReadFuncPtr)(struct magDev_s *mag);
+struct temperatureDev_s;
+typedef 
+# 54 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 54 "./src/main/drivers/sensor.h"
+            (*sensorTempReadFuncPtr)(struct temperatureDev_s *tempDev, int16_t *temperature);
+struct opflowDev_s;
+typedef 
+# 56 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 56 "./src/main/drivers/sensor.h"
+            (*sensorOpflowInitFuncPtr)(struct opflowDev_s *mag);
+typedef 
+# 57 "./src/main/drivers/sensor.h" 3 4
+       _Bool 
+# 57 "./src/main/drivers/sensor.h"
+            (*sensorOpflowUpdateFuncPtr)(struct opflowDev_s *mag);
+# 26 "./src/main/sensors/gyro.h" 2
+
+typedef enum {
+    GYRO_NONE = 0,
+    GYRO_AUTODETECT,
+    GYRO_MPU6050,
+    GYRO_L3G4200D,
+    GYRO_MPU3050,
+    GYRO_L3GD20,
+    GYRO_MPU6000,
+    GYRO_MPU6500,
+    GYRO_MPU9250,
+    GYRO_BMI160,
+    GYRO_ICM20689,
+    GYRO_FAKE
+} gyroSensor_e;
+
+typedef enum {
+    DYN_NOTCH_RANGE_HIGH = 0,
+    DYN_NOTCH_RANGE_MEDIUM,
+    DYN_NOTCH_RANGE_LOW
+} dynamicFilterRange_e;
+
+typedef enum {
+    DYN_NOTCH_ANALYSER_FFT = 0,
+    DYN_NOTCH_ANALYSER_SDFT
+} dynamicFilterAnalyser_e;
+
+#define DYN_NOTCH_RANGE_HZ_HIGH 2000
+#define DYN_NOTCH_RANGE_HZ_MEDIUM 1333
+#define DYN_NOTCH_RANGE_HZ_LOW 1000
+
+#define GYRO_PID_PROCESS_DENOM_MAX 8
+
+typedef struct gyro_s {
+    
+# 60 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 60 "./src/main/sensors/gyro.h"
+        initialized;
+    uint32_t targetLooptime;
+    uint32_t sampleLooptime;
+    uint8_t pidProcessDenom;
+    
+# 64 "./src/main/sensors/gyro.h" 3 4
+   _Bool 
+# 64 "./src/main/sensors/gyro.h"
+        sampleBufferActive;
+    timeUs_t lastSampleTimeUs;
+    timeDelta_t sampleDeltaTimeUs;
+    float gyroADCf[3];
+} gyro_t;
+
+extern gyro_t gyro;
+
+typedef struct gyroConfig_s {
+    sensor_align_e gyro_align;
+    uint8_t gyroMovementCalibrationThreshold;
+    uint8_t gyroSync;
+    uint16_t looptime;
+    uint8_t pidProcessDenom;
+    uint8_t gyro_lpf;
+    uint8_t gyro_soft_lpf_hz;
+    uint8_t gyro_soft_lpf_type;
+    uint8_t gyro_to_use;
+    uint16_t gyro_notch_hz;
+    uint16_t gyro_notch_cutoff;
+    uint16_t gyro_stage2_lowpass_hz;
+    uint8_t gyro_stage2_lowpass_type;
+    uint8_t dynamicGyroNotchRange;
+    uint16_t dynamicGyroNotchQ;
+    uint16_t dynamicGyroNotchMinHz;
+    uint8_t dynamicGyroNotchEnabled;
+    uint8_t dynamicGyroNotchAnalyser;
+    uint8_t dynamicGyroNotchCount;
+    uint16_t kalman_q;
+    uint16_t kalman_w;
+    uint16_t kalman_sharpness;
+    uint8_t kalmanEnabled;
+} gyroConfig_t;
+
+extern gyroConfig_t gyroConfig_System; extern gyroConfig_t gyroConfig_Copy; static inline const gyroConfig_t* gyroConfig(void) { return &gyroConfig_System; } static inline gyroConfig_t* gyroConfigMutable(void) { return &gyroConfig_System; } struct _dummy;
+
+typedef enum {
+    GYRO_STAGE_RAW = 0,
+    GYRO_STAGE_RPM_FILTER,
+    GYRO_STAGE_LPF2,
+    GYRO_STAGE_LPF,
+    GYRO_STAGE_NOTCH,
+    GYRO_STAGE_DYN_NOTCH,
+    GYRO_STAGE_KALMAN,
+    GYRO_STAGE_COUNT
+} gyroFilterStage_e;
+
+
+
+void gyroStageProbe(gyroFilterStage_e stage, int axis, float value);
+#define GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)
+#define GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)
+
+
+
+
+
+
+# 121 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 121 "./src/main/sensors/gyro.h"
+    gyroInit(void);
+void gyroGetMeasuredRotationRate(fpVector3_t *imuMeasuredRotationBF);
+void gyroUpdate(void);
+void gyroStartCalibration(void);
+
+# 125 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 125 "./src/main/sensors/gyro.h"
+    gyroIsCalibrationComplete(void);
+
+# 126 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 126 "./src/main/sensors/gyro.h"
+    gyroReadTemperature(void);
+int16_t gyroGetTemperature(void);
+int16_t gyroRateDps(int axis);
+
+# 129 "./src/main/sensors/gyro.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/gyro.h"
+    gyroSyncCheckUpdate(void);
+void gyroSyncDisable(void);
+uint32_t gyroGetSampleBufferOverflowCount(void);
+# 8 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/flight/dynamic_gyro_notch.h" 1
+# 25 "./src/main/flight/dynamic_gyro_notch.h"
+       
+
+
+
+# 1 "./src/main/common/filter.h" 1
+# 18 "./src/main/common/filter.h"
+       
+
+
+
+typedef struct rateLimitFilter_s {
+    float state;
+} rateLimitFilter_t;
+
+typedef struct pt1Filter_s {
+    float state;
+    float RC;
+    float dT;
+} pt1Filter_t;
+
+
+typedef struct biquadFilter_s {
+    float b0, b1, b2, a1, a2;
+    float x1, x2, y1, y2;
+} biquadFilter_t;
+
+typedef union {
+    biquadFilter_t biquad;
+    pt1Filter_t pt1;
+} filter_t;
+
+
+typedef struct pt1Filter3_s {
+    float state[3];
+    float k;
+} pt1Filter3_t;
+
+typedef struct biquadFilter3_s {
+    float b0[3], b1[3], b2[3], a1[3], a2[3];
+    float x1[3], x2[3], y1[3], y2[3];
+} biquadFilter3_t;
+
+typedef union {
+    biquadFilter3_t biquad;
+    pt1Filter3_t pt1;
+} filter3_t;
+
+typedef enum {
+    FILTER_PT1 = 0,
+    FILTER_BIQUAD
+} filterType_e;
+
+typedef enum {
+    FILTER_LPF,
+    FILTER_NOTCH
+} biquadFilterType_e;
+
+typedef struct firFilter_s {
+    float *buf;
+    const float *coeffs;
+    uint8_t bufLength;
+    uint8_t coeffsLength;
+} firFilter_t;
+
+typedef float (*filterApplyFnPtr)(void *filter, float input);
+typedef float (*filterApply4FnPtr)(void *filter, float input, float f_cut, float dt);
+typedef void (*filter3ApplyFnPtr)(void *filter, float *values);
+
+float nullFilterApply(void *filter, float input);
+float nullFilterApply4(void *filter, float input, float f_cut, float dt);
+
+void pt1FilterInit(pt1Filter_t *filter, float f_cut, float dT);
+void pt1FilterInitRC(pt1Filter_t *filter, float tau, float dT);
+void pt1FilterSetTimeConstant(pt1Filter_t *filter, float tau);
+float pt1FilterGetLastOutput(pt1Filter_t *filter);
+float pt1FilterApply(pt1Filter_t *filter, float input);
+float pt1FilterApply3(pt1Filter_t *filter, float input, float dT);
+float pt1FilterApply4(pt1Filter_t *filter, float input, float f_cut, float dt);
+void pt1FilterReset(pt1Filter_t *filter, float input);
+
+void rateLimitFilterInit(rateLimitFilter_t *filter);
+float rateLimitFilterApply4(rateLimitFilter_t *filter, float input, float rate_limit, float dT);
+
+void biquadFilterInitNotch(biquadFilter_t *filter, uint32_t samplingIntervalUs, uint16_t filterFreq, uint16_t cutoffHz);
+void biquadFilterInitLPF(biquadFilter_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs);
+void biquadFilterInit(biquadFilter_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs, float Q, biquadFilterType_e filterType);
+float biquadFilterApply(biquadFilter_t *filter, float sample);
+float biquadFilterReset(biquadFilter_t *filter, float value);
+float biquadFilterApplyDF1(biquadFilter_t *filter, float input);
+float filterGetNotchQ(float centerFrequencyHz, float cutoffFrequencyHz);
+void biquadFilterUpdate(biquadFilter_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+
+void nullFilter3Apply(void *filter, float *values);
+
+void pt1Filter3Init(pt1Filter3_t *filter, float f_cut, float dT);
+void pt1Filter3Apply(pt1Filter3_t *filter, float *values);
+
+void biquadFilter3InitNotch(biquadFilter3_t *filter, uint32_t samplingIntervalUs, uint16_t filterFreq, uint16_t cutoffHz);
+void biquadFilter3InitLPF(biquadFilter3_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs);
+void biquadFilter3Init(biquadFilter3_t *filter, uint16_t filterFreq, uint32_t samplingIntervalUs, float Q, biquadFilterType_e filterType);
+void biquadFilter3Update(biquadFilter3_t *filter, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilter3UpdateAxis(biquadFilter3_t *filter, int axis, float filterFreq, uint32_t refreshRate, float Q, biquadFilterType_e filterType);
+void biquadFilter3Apply(biquadFilter3_t *filter, float *values);
+void biquadFilter3ApplyDF1(biquadFilter3_t *filter, float *values);
+# 30 "./src/main/flight/dynamic_gyro_notch.h" 2
+
+#define DYNAMIC_NOTCH_DEFAULT_CENTER_HZ 350
+
+#define DYN_NOTCH_PEAK_COUNT 3
+
+typedef struct dynamicGyroNotchState_s {
+    uint16_t frequency[3][3];
+    float dynNotchQ;
+    float dynNotch1Ctr;
+    float dynNotch2Ctr;
+    uint32_t looptime;
+    uint8_t enabled;
+    uint8_t notchCount;
+
+
+
+
+    biquadFilter3_t filters[3];
+    filter3ApplyFnPtr filtersApplyFn;
+
+    uint32_t costTicks;
+    uint32_t costTicksAverage;
+    uint32_t costTicksMax;
+} dynamicGyroNotchState_t;
+
+extern dynamicGyroNotchState_t dynamicGyroNotchState;
+
+void dynamicGyroNotchFiltersInit(dynamicGyroNotchState_t *state);
+void dynamicGyroNotchFiltersUpdate(dynamicGyroNotchState_t *state, int axis, const uint16_t *frequencies);
+void dynamicGyroNotchFiltersApply(dynamicGyroNotchState_t *state, float *values);
+void dynamicGyroNotchUpdateCost(dynamicGyroNotchState_t *state, uint32_t costTicks);
+# 9 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/acceleration.h" 1
+# 18 "./src/main/sensors/acceleration.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/accgyro/accgyro.h" 1
+# 18 "./src/main/drivers/accgyro/accgyro.h"
+       
+
+
+
+
+# 1 "./src/main/drivers/exti.h" 1
+# 19 "./src/main/drivers/exti.h"
+       
+
+
+
+
+typedef struct extiConfig_s {
+    ioTag_t tag;
+} extiConfig_t;
+
+typedef struct extiCallbackRec_s extiCallbackRec_t;
+typedef void extiHandlerCallback(extiCallbackRec_t *self);
+
+struct extiCallbackRec_s {
+    extiHandlerCallback *fn;
+};
+
+void EXTIInit(void);
+
+void EXTIHandlerInit(extiCallbackRec_t *cb, extiHandlerCallback *fn);
+
+
+
+void EXTIConfig(IO_t io, extiCallbackRec_t *cb, int irqPriority, EXTITrigger_TypeDef trigger);
+
+void EXTIRelease(IO_t io);
+void EXTIEnable(IO_t io, 
+# 44 "./src/main/drivers/exti.h" 3 4
+                        _Bool 
+# 44 "./src/main/drivers/exti.h"
+                             enable);
+# 24 "./src/main/drivers/accgyro/accgyro.h" 2
+
+
+#define GYRO_LPF_256HZ 0
+#define GYRO_LPF_188HZ 1
+#define GYRO_LPF_98HZ 2
+#define GYRO_LPF_42HZ 3
+#define GYRO_LPF_20HZ 4
+#define GYRO_LPF_10HZ 5
+#define GYRO_LPF_5HZ 6
+#define GYRO_LPF_NONE 7
+
+typedef struct {
+    uint8_t gyroLpf;
+    uint16_t gyroRateHz;
+    uint8_t gyroConfigValues[2];
+} gyroFilterAndRateConfig_t;
+
+#define GYRO_SAMPLE_BUFFER_SIZE 16
+
+typedef struct gyroSample_s {
+    timeUs_t timeUs;
+    int16_t gyroADCRaw[3];
+} gyroSample_t;
+
+
+typedef struct gyroSampleBuffer_s {
+    gyroSample_t samples[16];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint32_t overflowCount;
+    volatile 
+# 54 "./src/main/drivers/accgyro/accgyro.h" 3 4
+            _Bool 
+# 54 "./src/main/drivers/accgyro/accgyro.h"
+                 enabled;
+} gyroSampleBuffer_t;
+
+typedef struct gyroDev_s {
+    busDevice_t * busDev;
+    sensorGyroInitFuncPtr initFn;
+    sensorGyroReadFuncPtr readFn;
+    sensorGyroReadDataFuncPtr temperatureFn;
+    sensorGyroInterruptStatusFuncPtr intStatusFn;
+    sensorGyroUpdateFuncPtr updateFn;
+    extiCallbackRec_t exti;
+    float scale;
+    int16_t gyroADCRaw[3];
+    int16_t gyroZero[3];
+    uint8_t imuSensorToUse;
+    uint8_t lpf;
+    uint32_t requestedSampleIntervalUs;
+    volatile 
+# 71 "./src/main/drivers/accgyro/accgyro.h" 3 4
+            _Bool 
+# 71 "./src/main/drivers/accgyro/accgyro.h"
+                 dataReady;
+    uint32_t sampleRateIntervalUs;
+    sensor_align_e gyroAlign;
+    gyroSampleBuffer_t sampleBuffer;
+} gyroDev_t;
+
+typedef struct accDev_s {
+    busDevice_t * busDev;
+    sensorAccInitFuncPtr initFn;
+    sensorAccReadFuncPtr readFn;
+    uint16_t acc_1G;
+    int16_t ADCRaw[3];
+    uint8_t imuSensorToUse;
+    sensor_align_e accAlign;
+} accDev_t;
+
+const gyroFilterAndRateConfig_t * chooseGyroConfig(uint8_t desiredLpf, uint16_t desiredRateHz, const gyroFilterAndRateConfig_t * configs, int count);
+void gyroIntExtiInit(struct gyroDev_s *gyro);
+
+# 89 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 89 "./src/main/drivers/accgyro/accgyro.h"
+    gyroCheckDataReady(struct gyroDev_s *gyro);
+
+# 90 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 90 "./src/main/drivers/accgyro/accgyro.h"
+    gyroSampleBufferIsSupported(const struct gyroDev_s *gyro, 
+# 90 "./src/main/drivers/accgyro/accgyro.h" 3 4
+                                                              _Bool 
+# 90 "./src/main/drivers/accgyro/accgyro.h"
+                                                                   slaveMagEnabled);
+void gyroSampleBufferStart(struct gyroDev_s *gyro);
+void gyroSampleBufferStop(struct gyroDev_s *gyro);
+
+# 93 "./src/main/drivers/accgyro/accgyro.h" 3 4
+_Bool 
+# 93 "./src/main/drivers/accgyro/accgyro.h"
+    gyroSampleBufferPop(struct gyroDev_s *gyro, gyroSample_t *sample);
+uint8_t gyroSampleBufferCount(const struct gyroDev_s *gyro);
+# 25 "./src/main/sensors/acceleration.h" 2
+# 1 "./src/main/sensors/sensors.h" 1
+# 18 "./src/main/sensors/sensors.h"
+       
+
+typedef enum {
+    SENSOR_INDEX_GYRO = 0,
+    SENSOR_INDEX_ACC,
+    SENSOR_INDEX_BARO,
+    SENSOR_INDEX_MAG,
+    SENSOR_INDEX_RANGEFINDER,
+    SENSOR_INDEX_PITOT,
+    SENSOR_INDEX_OPFLOW,
+    SENSOR_INDEX_COUNT
+} sensorIndex_e;
+
+typedef struct int16_flightDynamicsTrims_s {
+    int16_t roll;
+    int16_t pitch;
+    int16_t yaw;
+} flightDynamicsTrims_def_t;
+
+typedef union flightDynamicsTrims_u {
+    int16_t raw[3];
+    flightDynamicsTrims_def_t values;
+} flightDynamicsTrims_t;
+
+#define CALIBRATING_BARO_TIME_MS 2000
+#define CALIBRATING_PITOT_TIME_MS 2000
+#define CALIBRATING_GYRO_TIME_MS 2000
+#define CALIBRATING_ACC_TIME_MS 500
+
+
+typedef enum {
+    SENSOR_GYRO = 1 << 0,
+    SENSOR_ACC = 1 << 1,
+    SENSOR_BARO = 1 << 2,
+    SENSOR_MAG = 1 << 3,
+    SENSOR_RANGEFINDER = 1 << 4,
+    SENSOR_PITOT = 1 << 5,
+    SENSOR_OPFLOW = 1 << 6,
+    SENSOR_GPS = 1 << 7,
+    SENSOR_GPSMAG = 1 << 8,
+    SENSOR_TEMP = 1 << 9
+} sensors_e;
+
+extern uint8_t requestedSensors[SENSOR_INDEX_COUNT];
+extern uint8_t detectedSensors[SENSOR_INDEX_COUNT];
+# 26 "./src/main/sensors/acceleration.h" 2
+
+#define GRAVITY_CMSS 980.665f
+#define GRAVITY_MSS 9.80665f
+
+#define ACC_CLIPPING_THRESHOLD_G 7.9f
+#define ACC_VIBE_FLOOR_FILT_HZ 5.0f
+#define ACC_VIBE_FILT_HZ 2.0f
+
+
+typedef enum {
+    ACC_NONE = 0,
+    ACC_AUTODETECT = 1,
+    ACC_ADXL345 = 2,
+    ACC_MPU6050 = 3,
+    ACC_MMA8452 = 4,
+    ACC_BMA280 = 5,
+    ACC_LSM303DLHC = 6,
+    ACC_MPU6000 = 7,
+    ACC_MPU6500 = 8,
+    ACC_MPU9250 = 9,
+    ACC_BMI160 = 10,
+    ACC_ICM20689 = 11,
+    ACC_FAKE = 12,
+    ACC_MAX = ACC_FAKE
+} accelerationSensor_e;
+
+typedef struct {
+    float min;
+    float max;
+} acc_extremes_t;
+
+typedef struct acc_s {
+    accDev_t dev;
+    uint32_t accTargetLooptime;
+    float accADCf[3];
+    float accVibeSq[3];
+    uint32_t accClipCount;
+    
+# 63 "./src/main/sensors/acceleration.h" 3 4
+   _Bool 
+# 63 "./src/main/sensors/acceleration.h"
+        isClipped;
+    acc_extremes_t extremes[3];
+    float maxG;
+} acc_t;
+
+extern acc_t acc;
+
+typedef struct accelerometerConfig_s {
+    sensor_align_e acc_align;
+    uint8_t acc_hardware;
+    uint16_t acc_lpf_hz;
+    flightDynamicsTrims_t accZero;
+    flightDynamicsTrims_t accGain;
+    uint8_t acc_notch_hz;
+    uint8_t acc_notch_cutoff;
+    uint8_t acc_soft_lpf_type;
+} accelerometerConfig_t;
+
+extern accelerometerConfig_t accelerometerConfig_System; extern accelerometerConfig_t accelerometerConfig_Copy; static inline const accelerometerConfig_t* accelerometerConfig(void) { return &accelerometerConfig_System; } static inline accelerometerConfig_t* accelerometerConfigMutable(void) { return &accelerometerConfig_System; } struct _dummy;
+
+
+# 83 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 83 "./src/main/sensors/acceleration.h"
+    accInit(uint32_t accTargetLooptime);
+
+# 84 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 84 "./src/main/sensors/acceleration.h"
+    accIsCalibrationComplete(void);
+void accStartCalibration(void);
+void accGetMeasuredAcceleration(fpVector3_t *measuredAcc);
+const acc_extremes_t* accGetMeasuredExtremes(void);
+float accGetMeasuredMaxG(void);
+void updateAccExtremes(void);
+void accGetVibrationLevels(fpVector3_t *accVibeLevels);
+float accGetVibrationLevel(void);
+uint32_t accGetClipCount(void);
+
+# 93 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 93 "./src/main/sensors/acceleration.h"
+    accIsClipped(void);
+void accUpdate(void);
+void accSetCalibrationValues(void);
+void accInitFilters(void);
+
+# 97 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 97 "./src/main/sensors/acceleration.h"
+    accIsHealthy(void);
+
+# 98 "./src/main/sensors/acceleration.h" 3 4
+_Bool 
+# 98 "./src/main/sensors/acceleration.h"
+    accGetCalibrationAxisStatus(int axis);
+uint8_t accGetCalibrationAxisFlags(void);
+# 10 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/opflow.h" 1
+# 25 "./src/main/sensors/opflow.h"
+       
+
+
+
+# 1 "./src/main/drivers/opflow/opflow.h" 1
+# 25 "./src/main/drivers/opflow/opflow.h"
+       
+
+
+
+
+struct opflowDev_s;
+
+typedef struct opflowData_s {
+    timeDelta_t deltaTime;
+    int32_t flowRateRaw[3];
+    int16_t quality;
+} opflowData_t;
+
+typedef struct opflowDev_s {
+    sensorOpflowInitFuncPtr initFn;
+    sensorOpflowUpdateFuncPtr updateFn;
+    opflowData_t rawData;
+} opflowDev_t;
+# 30 "./src/main/sensors/opflow.h" 2
+
+typedef enum {
+    OPFLOW_NONE = 0,
+    OPFLOW_PMW3901 = 1,
+    OPFLOW_CXOF = 2,
+    OPFLOW_MSP = 3,
+    OPFLOW_FAKE = 4,
+} opticalFlowSensor_e;
+
+typedef enum {
+    OPFLOW_QUALITY_INVALID,
+    OPFLOW_QUALITY_VALID
+} opflowQuality_e;
+
+typedef struct opticalFlowConfig_s {
+    uint8_t opflow_hardware;
+    uint8_t opflow_align;
+    float opflow_scale;
+} opticalFlowConfig_t;
+
+extern opticalFlowConfig_t opticalFlowConfig_System; extern opticalFlowConfig_t opticalFlowConfig_Copy; static inline const opticalFlowConfig_t* opticalFlowConfig(void) { return &opticalFlowConfig_System; } static inline opticalFlowConfig_t* opticalFlowConfigMutable(void) { return &opticalFlowConfig_System; } struct _dummy;
+
+typedef struct opflow_s {
+    opflowDev_t dev;
+
+    opflowQuality_e flowQuality;
+    timeUs_t lastValidUpdate;
+    
+# 57 "./src/main/sensors/opflow.h" 3 4
+   _Bool 
+# 57 "./src/main/sensors/opflow.h"
+                   isHwHealty;
+    float flowRate[2];
+    float bodyRate[2];
+
+    float gyroBodyRateAcc[2];
+    timeUs_t gyroBodyRateTimeUs;
+
+    uint8_t rawQuality;
+} opflow_t;
+
+extern opflow_t opflow;
+
+void opflowGyroUpdateCallback(timeUs_t gyroUpdateDeltaUs);
+
+# 70 "./src/main/sensors/opflow.h" 3 4
+_Bool 
+# 70 "./src/main/sensors/opflow.h"
+    opflowInit(void);
+void opflowUpdate(timeUs_t currentTimeUs);
+
+# 72 "./src/main/sensors/opflow.h" 3 4
+_Bool 
+# 72 "./src/main/sensors/opflow.h"
+    opflowIsHealthy(void);
+void opflowStartCalibration(void);
+# 11 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/compass.h" 1
+# 18 "./src/main/sensors/compass.h"
+       
+
+
+
+
+
+
+# 1 "./src/main/drivers/compass/compass.h" 1
+# 18 "./src/main/drivers/compass/compass.h"
+       
+
+
+
+
+
+typedef struct magDev_s {
+    busDevice_t * busDev;
+    sensorMagInitFuncPtr init;
+    sensorMagReadFuncPtr read;
+    struct {
+        
+# 29 "./src/main/drivers/compass/compass.h" 3 4
+       _Bool 
+# 29 "./src/main/drivers/compass/compass.h"
+            useExternal;
+        union {
+            fpMat3_t externalRotation;
+            sensor_align_e onBoard;
+        };
+    } magAlign;
+    uint8_t magSensorToUse;
+    int16_t magADCRaw[3];
+} magDev_t;
+# 26 "./src/main/sensors/compass.h" 2
+
+
+
+
+
+typedef enum {
+    MAG_NONE = 0,
+    MAG_AUTODETECT = 1,
+    MAG_HMC5883 = 2,
+    MAG_AK8975 = 3,
+    MAG_GPS = 4,
+    MAG_MAG3110 = 5,
+    MAG_AK8963 = 6,
+    MAG_IST8310 = 7,
+    MAG_QMC5883 = 8,
+    MAG_MPU9250 = 9,
+    MAG_IST8308 = 10,
+    MAG_LIS3MDL = 11,
+    MAG_FAKE = 12,
+    MAG_MAX = MAG_FAKE
+} magSensor_e;
+
+typedef struct mag_s {
+    magDev_t dev;
+    int32_t magADC[3];
+} mag_t;
+
+extern mag_t mag;
+
+typedef struct compassConfig_s {
+    int16_t mag_declination;
+
+    sensor_align_e mag_align;
+    uint8_t mag_hardware;
+    flightDynamicsTrims_t magZero;
+    uint8_t mag_to_use;
+    uint8_t magCalibrationTimeLimit;
+    int16_t rollDeciDegrees;
+    int16_t pitchDeciDegrees;
+    int16_t yawDeciDegrees;
+} compassConfig_t;
+
+extern compassConfig_t compassConfig_System; extern compassConfig_t compassConfig_Copy; static inline const compassConfig_t* compassConfig(void) { return &compassConfig_System; } static inline compassConfig_t* compassConfigMutable(void) { return &compassConfig_System; } struct _dummy;
+
+
+# 70 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 70 "./src/main/sensors/compass.h"
+    compassDetect(magDev_t *dev, magSensor_e magHardwareToUse);
+
+# 71 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 71 "./src/main/sensors/compass.h"
+    compassInit(void);
+void compassUpdate(timeUs_t currentTimeUs);
+
+# 73 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 73 "./src/main/sensors/compass.h"
+    compassIsReady(void);
+
+# 74 "./src/main/sensors/compass.h" 3 4
+_Bool 
+# 74 "./src/main/sensors/compass.h"
+    compassIsHealthy(void);
+# 12 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/barometer.h" 1
+# 18 "./src/main/sensors/barometer.h"
+       
+
+
+
+# 1 "./src/main/drivers/barometer/barometer.h" 1
+# 18 "./src/main/drivers/barometer/barometer.h"
+       
+
+
+
+struct baroDev_s;
+typedef 
+# 23 "./src/main/drivers/barometer/barometer.h" 3 4
+       _Bool 
+# 23 "./src/main/drivers/barometer/barometer.h"
+            (*baroOpFuncPtr)(struct baroDev_s * baro);
+typedef 
+# 24 "./src/main/drivers/barometer/barometer.h" 3 4
+       _Bool 
+# 24 "./src/main/drivers/barometer/barometer.h"
+            (*baroCalculateFuncPtr)(struct baroDev_s * baro, int32_t *pressure, int32_t *temperature);
+
+typedef struct baroDev_s {
+    busDevice_t * busDev;
+    uint16_t ut_delay;
+    uint16_t up_delay;
+    baroOpFuncPtr start_ut;
+    baroOpFuncPtr get_ut;
+    baroOpFuncPtr start_up;
+    baroOpFuncPtr get_up;
+    baroCalculateFuncPtr calculate;
+} baroDev_t;
+# 23 "./src/main/sensors/barometer.h" 2
+
+typedef enum {
+    BARO_NONE = 0,
+    BARO_AUTODETECT = 1,
+    BARO_BMP085 = 2,
+    BARO_MS5611 = 3,
+    BARO_BMP280 = 4,
+    BARO_MS5607 = 5,
+    BARO_LPS25H = 6,
+    BARO_SPL06 = 7,
+    BARO_BMP388 = 8,
+    BARO_DPS310 = 9,
+    BARO_FAKE = 10,
+    BARO_MAX = BARO_FAKE
+} baroSensor_e;
+
+typedef struct barometerConfig_s {
+    uint8_t baro_hardware;
+    uint8_t use_median_filtering;
+    uint16_t baro_calibration_tolerance;
+} barometerConfig_t;
+
+extern barometerConfig_t barometerConfig_System; extern barometerConfig_t barometerConfig_Copy; static inline const barometerConfig_t* barometerConfig(void) { return &barometerConfig_System; } static inline barometerConfig_t* barometerConfigMutable(void) { return &barometerConfig_System; } struct _dummy;
+
+typedef struct baro_s {
+    baroDev_t dev;
+    int32_t BaroAlt;
+    int32_t baroTemperature;
+    int32_t baroPressure;
+} baro_t;
+
+extern baro_t baro;
+
+
+# 56 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 56 "./src/main/sensors/barometer.h"
+    baroInit(void);
+
+# 57 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 57 "./src/main/sensors/barometer.h"
+    baroIsCalibrationComplete(void);
+void baroStartCalibration(void);
+uint32_t baroUpdate(void);
+int32_t baroCalculateAltitude(void);
+int32_t baroGetLatestAltitude(void);
+int16_t baroGetTemperature(void);
+
+# 63 "./src/main/sensors/barometer.h" 3 4
+_Bool 
+# 63 "./src/main/sensors/barometer.h"
+    baroIsHealthy(void);
+# 13 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/pitotmeter.h" 1
+# 18 "./src/main/sensors/pitotmeter.h"
+       
+
+
+
+# 1 "./src/main/common/calibration.h" 1
+# 25 "./src/main/common/calibration.h"
+       
+# 35 "./src/main/common/calibration.h"
+typedef enum {
+    ZERO_CALIBRATION_NONE = 0,
+    ZERO_CALIBRATION_IN_PROGRESS,
+    ZERO_CALIBRATION_DONE,
+    ZERO_CALIBRATION_FAIL,
+} zeroCalibrationState_e;
+
+typedef struct {
+    zeroCalibrationState_e state;
+    timeMs_t startTimeMs;
+    timeMs_t windowSizeMs;
+    
+# 46 "./src/main/common/calibration.h" 3 4
+   _Bool 
+# 46 "./src/main/common/calibration.h"
+                           allowFailure;
+    unsigned sampleCount;
+    float stdDevThreshold;
+} zeroCalibrationParams_t;
+
+typedef struct {
+    float accumulatedValue;
+    stdev_t stdDev;
+} zeroCalibrationValue_t;
+
+typedef struct {
+    zeroCalibrationParams_t params;
+    zeroCalibrationValue_t val;
+} zeroCalibrationScalar_t;
+
+typedef struct {
+    zeroCalibrationParams_t params;
+    zeroCalibrationValue_t val[3];
+} zeroCalibrationVector_t;
+
+void zeroCalibrationStartS(zeroCalibrationScalar_t * s, timeMs_t window, float threshold, 
+# 66 "./src/main/common/calibration.h" 3 4
+                                                                                         _Bool 
+# 66 "./src/main/common/calibration.h"
+                                                                                              allowFailure);
+
+# 67 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 67 "./src/main/common/calibration.h"
+    zeroCalibrationIsCompleteS(zeroCalibrationScalar_t * s);
+
+# 68 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 68 "./src/main/common/calibration.h"
+    zeroCalibrationIsSuccessfulS(zeroCalibrationScalar_t * s);
+void zeroCalibrationAddValueS(zeroCalibrationScalar_t * s, const float v);
+void zeroCalibrationGetZeroS(zeroCalibrationScalar_t * s, float * v);
+
+void zeroCalibrationStartV(zeroCalibrationVector_t * s, timeMs_t window, float threshold, 
+# 72 "./src/main/common/calibration.h" 3 4
+                                                                                         _Bool 
+# 72 "./src/main/common/calibration.h"
+                                                                                              allowFailure);
+
+# 73 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 73 "./src/main/common/calibration.h"
+    zeroCalibrationIsCompleteV(zeroCalibrationVector_t * s);
+
+# 74 "./src/main/common/calibration.h" 3 4
+_Bool 
+# 74 "./src/main/common/calibration.h"
+    zeroCalibrationIsSuccessfulV(zeroCalibrationVector_t * s);
+void zeroCalibrationAddValueV(zeroCalibrationVector_t * s, const fpVector3_t * v);
+void zeroCalibrationGetZeroV(zeroCalibrationVector_t * s, fpVector3_t * v);
+# 23 "./src/main/sensors/pitotmeter.h" 2
+
+# 1 "./src/main/drivers/pitotmeter.h" 1
+# 18 "./src/main/drivers/pitotmeter.h"
+       
+
+
+struct pitotDev_s;
+
+typedef 
+# 23 "./src/main/drivers/pitotmeter.h" 3 4
+       _Bool 
+# 23 "./src/main/drivers/pitotmeter.h"
+            (*pitotOpFuncPtr)(struct pitotDev_s * pitot);
+typedef void (*pitotCalculateFuncPtr)(struct pitotDev_s * pitot, float *pressure, float *temperature);
+
+typedef struct pitotDev_s {
+    busDevice_t * busDev;
+    uint16_t delay;
+    pitotOpFuncPtr start;
+    pitotOpFuncPtr get;
+    pitotCalculateFuncPtr calculate;
+} pitotDev_t;
+# 25 "./src/main/sensors/pitotmeter.h" 2
+
+typedef enum {
+    PITOT_NONE = 0,
+    PITOT_AUTODETECT = 1,
+    PITOT_MS4525 = 2,
+    PITOT_ADC = 3,
+    PITOT_VIRTUAL = 4,
+    PITOT_FAKE = 5,
+} pitotSensor_e;
+
+#define PITOT_MAX PITOT_FAKE
+#define PITOT_SAMPLE_COUNT_MAX 48
+
+typedef struct pitotmeterConfig_s {
+    uint8_t pitot_hardware;
+    uint16_t pitot_lpf_milli_hz;
+    float pitot_scale;
+} pitotmeterConfig_t;
+
+extern pitotmeterConfig_t pitotmeterConfig_System; extern pitotmeterConfig_t pitotmeterConfig_Copy; static inline const pitotmeterConfig_t* pitotmeterConfig(void) { return &pitotmeterConfig_System; } static inline pitotmeterConfig_t* pitotmeterConfigMutable(void) { return &pitotmeterConfig_System; } struct _dummy;
+
+typedef struct pito_s {
+    pitotDev_t dev;
+    float airSpeed;
+
+    zeroCalibrationScalar_t zeroCalibration;
+    pt1Filter_t lpfState;
+    timeUs_t lastMeasurementUs;
+    timeMs_t lastSeenHealthyMs;
+
+    float pressureZero;
+    float pressure;
+} pitot_t;
+
+
+
+#define AIR_DENSITY_SEA_LEVEL_15C 1.225f
+#define P0 101325.0f
+
+extern pitot_t pitot;
+
+
+# 66 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 66 "./src/main/sensors/pitotmeter.h"
+    pitotInit(void);
+
+# 67 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 67 "./src/main/sensors/pitotmeter.h"
+    pitotIsCalibrationComplete(void);
+void pitotStartCalibration(void);
+void pitotUpdate(void);
+int32_t pitotCalculateAirSpeed(void);
+
+# 71 "./src/main/sensors/pitotmeter.h" 3 4
+_Bool 
+# 71 "./src/main/sensors/pitotmeter.h"
+    pitotIsHealthy(void);
+# 14 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/rx/rx.h" 1
+# 18 "./src/main/rx/rx.h"
+       
+
+
+
+
+
+
+
+#define STICK_CHANNEL_COUNT 4
+
+#define PWM_RANGE_MIN 1000
+#define PWM_RANGE_MAX 2000
+#define PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))
+
+#define PWM_PULSE_MIN 750
+#define PWM_PULSE_MAX 2250
+
+#define MIDRC_MIN 1200
+#define MIDRC_MAX 1700
+
+#define RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)
+#define CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)
+#define MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)
+
+#define DEFAULT_SERVO_MIN 1000
+#define DEFAULT_SERVO_MIDDLE 1500
+#define DEFAULT_SERVO_MAX 2000
+
+#define DELAY_50_HZ (1000000 / 50)
+#define DELAY_10_HZ (1000000 / 10)
+#define DELAY_5_HZ (1000000 / 5)
+
+#define RSSI_MAX_VALUE 1023
+
+typedef enum {
+    RX_FRAME_PENDING = 0,
+    RX_FRAME_COMPLETE = (1 << 0),
+    RX_FRAME_FAILSAFE = (1 << 1),
+    RX_FRAME_PROCESSING_REQUIRED = (1 << 2),
+    RX_FRAME_DROPPED = (1 << 3),
+} rxFrameState_e;
+
+typedef enum {
+    RX_TYPE_NONE = 0,
+    RX_TYPE_PPM = 1,
+    RX_TYPE_SERIAL = 2,
+    RX_TYPE_MSP = 3,
+    RX_TYPE_SPI = 4,
+    RX_TYPE_UIB = 5
+} rxReceiverType_e;
+
+typedef enum {
+    SERIALRX_SPEKTRUM1024 = 0,
+    SERIALRX_SPEKTRUM2048 = 1,
+    SERIALRX_SBUS = 2,
+    SERIALRX_SUMD = 3,
+    SERIALRX_SUMH = 4,
+    SERIALRX_XBUS_MODE_B = 5,
+    SERIALRX_XBUS_MODE_B_RJ01 = 6,
+    SERIALRX_IBUS = 7,
+    SERIALRX_JETIEXBUS = 8,
+    SERIALRX_CRSF = 9,
+    SERIALRX_FPORT = 10,
+    SERIALRX_SBUS_FAST = 11,
+} rxSerialReceiverType_e;
+
+#define MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16
+#define MAX_SUPPORTED_RC_CHANNEL_COUNT 18
+
+#define NON_AUX_CHANNEL_COUNT 4
+#define MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)
+
+extern const char rcChannelLetters[];
+
+#define MAX_MAPPABLE_RX_INPUTS 4
+
+#define MAX_INVALID_RX_PULSE_TIME 300
+
+#define RSSI_VISIBLE_VALUE_MIN 0
+#define RSSI_VISIBLE_VALUE_MAX 100
+#define RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)
+
+typedef struct rxChannelRangeConfig_s {
+    uint16_t min;
+    uint16_t max;
+} rxChannelRangeConfig_t;
+extern rxChannelRangeConfig_t rxChannelRangeConfigs_SystemArray[4]; extern rxChannelRangeConfig_t rxChannelRangeConfigs_CopyArray[4]; static inline const rxChannelRangeConfig_t* rxChannelRangeConfigs(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t* rxChannelRangeConfigsMutable(int _index) { return &rxChannelRangeConfigs_SystemArray[_index]; } static inline rxChannelRangeConfig_t (* rxChannelRangeConfigs_array(void))[4] { return &rxChannelRangeConfigs_SystemArray; } struct _dummy;
+
+typedef struct rxConfig_s {
+    uint8_t receiverType;
+    uint8_t rcmap[4];
+    uint8_t serialrx_provider;
+    uint8_t serialrx_inverted;
+    uint8_t halfDuplex;
+    uint8_t rx_spi_protocol;
+    uint32_t rx_spi_id;
+    uint8_t rx_spi_rf_channel_count;
+    uint8_t spektrum_sat_bind;
+    uint8_t spektrum_sat_bind_autoreset;
+    uint8_t rssi_channel;
+    uint8_t rssiMin;
+    uint8_t rssiMax;
+    uint16_t sbusSyncInterval;
+    uint16_t mincheck;
+    uint16_t maxcheck;
+    uint16_t rx_min_usec;
+    uint16_t rx_max_usec;
+    uint8_t rcFilterFrequency;
+    uint16_t mspOverrideChannels;
+    uint8_t rssi_source;
+} rxConfig_t;
+
+extern rxConfig_t rxConfig_System; extern rxConfig_t rxConfig_Copy; static inline const rxConfig_t* rxConfig(void) { return &rxConfig_System; } static inline rxConfig_t* rxConfigMutable(void) { return &rxConfig_System; } struct _dummy;
+
+#define REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))
+
+typedef struct rxRuntimeConfig_s rxRuntimeConfig_t;
+typedef uint16_t (*rcReadRawDataFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig, uint8_t chan);
+typedef uint8_t (*rcFrameStatusFnPtr)(rxRuntimeConfig_t *rxRuntimeConfig);
+typedef 
+# 137 "./src/main/rx/rx.h" 3 4
+       _Bool 
+# 137 "./src/main/rx/rx.h"
+            (*rcProcessFrameFnPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+typedef uint16_t (*rcGetLinkQualityPtr)(const rxRuntimeConfig_t *rxRuntimeConfig);
+
+typedef struct rxLinkQualityTracker_s {
+    timeMs_t lastUpdatedMs;
+    uint32_t lqAccumulator;
+    uint32_t lqCount;
+    uint32_t lqValue;
+} rxLinkQualityTracker_e;
+
+typedef struct rxRuntimeConfig_s {
+    uint8_t channelCount;
+    timeUs_t rxRefreshRate;
+    timeUs_t rxSignalTimeout;
+    
+# 151 "./src/main/rx/rx.h" 3 4
+   _Bool 
+# 151 "./src/main/rx/rx.h"
+        requireFiltering;
+    rcReadRawDataFnPtr rcReadRawFn;
+    rcFrameStatusFnPtr rcFrameStatusFn;
+    rcProcessFrameFnPtr rcProcessFrameFn;
+    rxLinkQualityTracker_e * lqTracker;
+    uint16_t *channelData;
+    void *frameData;
+} rxRuntimeConfig_t;
+
+typedef struct rcChannel_s {
+    int16_t raw;
+    int16_t data;
+    timeMs_t expiresAt;
+} rcChannel_t;
+
+typedef enum {
+    RSSI_SOURCE_NONE = 0,
+    RSSI_SOURCE_AUTO,
+    RSSI_SOURCE_ADC,
+    RSSI_SOURCE_RX_CHANNEL,
+    RSSI_SOURCE_RX_PROTOCOL,
+    RSSI_SOURCE_MSP,
+} rssiSource_e;
+
+extern rxRuntimeConfig_t rxRuntimeConfig;
+
+void lqTrackerReset(rxLinkQualityTracker_e * lqTracker);
+void lqTrackerAccumulate(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+void lqTrackerSet(rxLinkQualityTracker_e * lqTracker, uint16_t rawValue);
+uint16_t lqTrackerGet(rxLinkQualityTracker_e * lqTracker);
+
+void rxInit(void);
+void rxUpdateRSSISource(void);
+
+# 184 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 184 "./src/main/rx/rx.h"
+    rxUpdateCheck(timeUs_t currentTimeUs, timeDelta_t currentDeltaTime);
+
+# 185 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 185 "./src/main/rx/rx.h"
+    rxIsReceivingSignal(void);
+
+# 186 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 186 "./src/main/rx/rx.h"
+    rxAreFlightChannelsValid(void);
+
+# 187 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 187 "./src/main/rx/rx.h"
+    calculateRxChannelsAndUpdateFailsafe(timeUs_t currentTimeUs);
+
+# 188 "./src/main/rx/rx.h" 3 4
+_Bool 
+# 188 "./src/main/rx/rx.h"
+    isRxPulseValid(uint16_t pulseDuration);
+
+uint8_t calculateChannelRemapping(const uint8_t *channelMap, uint8_t channelMapEntryCount, uint8_t channelToRemap);
+void parseRcChannels(const char *input);
+
+void setRSSIFromMSP(uint8_t newMspRssi);
+void updateRSSI(timeUs_t currentTimeUs);
+
+uint16_t getRSSI(void);
+rssiSource_e getRSSISource(void);
+
+void resetAllRxChannelRangeConfigurations(void);
+
+void suspendRxSignal(void);
+void resumeRxSignal(void);
+
+uint16_t rxGetRefreshRate(void);
+
+
+
+
+
+int16_t rxGetChannelValue(unsigned channelNumber);
+
+
+
+int16_t rxGetRawChannelValue(unsigned channelNumber);
+# 15 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/rx/spektrum.h" 1
+# 18 "./src/main/rx/spektrum.h"
+       
+
+#define SPEKTRUM_SAT_BIND_DISABLED 0
+#define SPEKTRUM_SAT_BIND_MAX 10
+
+void spektrumBind(rxConfig_t *rxConfig);
+
+# 24 "./src/main/rx/spektrum.h" 3 4
+_Bool 
+# 24 "./src/main/rx/spektrum.h"
+    spektrumInit(const rxConfig_t *rxConfig, rxRuntimeConfig_t *rxRuntimeConfig);
+# 16 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/blackbox/blackbox.h" 1
+# 18 "./src/main/blackbox/blackbox.h"
+       
+
+# 1 "./src/main/blackbox/blackbox_fielddefs.h" 1
+# 18 "./src/main/blackbox/blackbox_fielddefs.h"
+       
+
+
+
+
+
+
+typedef enum FlightLogFieldCondition {
+    FLIGHT_LOG_FIELD_CONDITION_ALWAYS = 0,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_1,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_2,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_3,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_4,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_5,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_6,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_7,
+    FLIGHT_LOG_FIELD_CONDITION_AT_LEAST_MOTORS_8,
+    FLIGHT_LOG_FIELD_CONDITION_SERVOS,
+
+    FLIGHT_LOG_FIELD_CONDITION_MAG,
+    FLIGHT_LOG_FIELD_CONDITION_BARO,
+    FLIGHT_LOG_FIELD_CONDITION_PITOT,
+    FLIGHT_LOG_FIELD_CONDITION_VBAT,
+    FLIGHT_LOG_FIELD_CONDITION_AMPERAGE,
+    FLIGHT_LOG_FIELD_CONDITION_SURFACE,
+    FLIGHT_LOG_FIELD_CONDITION_FIXED_WING_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_MC_NAV,
+    FLIGHT_LOG_FIELD_CONDITION_RSSI,
+
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_0,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_1,
+    FLIGHT_LOG_FIELD_CONDITION_NONZERO_PID_D_2,
+
+    FLIGHT_LOG_FIELD_CONDITION_NOT_LOGGING_EVERY_FRAME,
+
+    FLIGHT_LOG_FIELD_CONDITION_DEBUG,
+
+    FLIGHT_LOG_FIELD_CONDITION_NEVER,
+
+    FLIGHT_LOG_FIELD_CONDITION_FIRST = FLIGHT_LOG_FIELD_CONDITION_ALWAYS,
+    FLIGHT_LOG_FIELD_CONDITION_LAST = FLIGHT_LOG_FIELD_CONDITION_NEVER
+} FlightLogFieldCondition;
+
+typedef enum FlightLogFieldPredictor {
+
+    FLIGHT_LOG_FIELD_PREDICTOR_0 = 0,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_PREVIOUS = 1,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_STRAIGHT_LINE = 2,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_AVERAGE_2 = 3,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MINTHROTTLE = 4,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_MOTOR_0 = 5,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_INC = 6,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_HOME_COORD = 7,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_1500 = 8,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_VBATREF = 9,
+
+
+    FLIGHT_LOG_FIELD_PREDICTOR_LAST_MAIN_FRAME_TIME = 10
+
+} FlightLogFieldPredictor;
+
+typedef enum FlightLogFieldEncoding {
+    FLIGHT_LOG_FIELD_ENCODING_SIGNED_VB = 0,
+    FLIGHT_LOG_FIELD_ENCODING_UNSIGNED_VB = 1,
+    FLIGHT_LOG_FIELD_ENCODING_NEG_14BIT = 3,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_8SVB = 6,
+    FLIGHT_LOG_FIELD_ENCODING_TAG2_3S32 = 7,
+    FLIGHT_LOG_FIELD_ENCODING_TAG8_4S16 = 8,
+    FLIGHT_LOG_FIELD_ENCODING_NULL = 9
+} FlightLogFieldEncoding;
+
+typedef enum FlightLogFieldSign {
+    FLIGHT_LOG_FIELD_UNSIGNED = 0,
+    FLIGHT_LOG_FIELD_SIGNED = 1
+} FlightLogFieldSign;
+
+typedef enum FlightLogCompression {
+    FLIGHT_LOG_COMPRESSION_NONE = 0,
+    FLIGHT_LOG_COMPRESSION_HUFFMAN = 1
+} FlightLogCompression;
+
+
+#define FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'
+
+typedef enum FlightLogEvent {
+    FLIGHT_LOG_EVENT_SYNC_BEEP = 0,
+    FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT = 13,
+    FLIGHT_LOG_EVENT_LOGGING_RESUME = 14,
+    FLIGHT_LOG_EVENT_FLIGHTMODE = 30,
+    FLIGHT_LOG_EVENT_IMU_FAILURE = 40,
+    FLIGHT_LOG_EVENT_LOG_END = 255
+} FlightLogEvent;
+
+typedef struct flightLogEvent_syncBeep_s {
+    uint32_t time;
+} flightLogEvent_syncBeep_t;
+
+typedef struct flightLogEvent_flightMode_s {
+    uint32_t flags;
+    uint32_t lastFlags;
+} flightLogEvent_flightMode_t;
+
+typedef struct flightLogEvent_inflightAdjustment_s {
+    uint8_t adjustmentFunction;
+    
+# 140 "./src/main/blackbox/blackbox_fielddefs.h" 3 4
+   _Bool 
+# 140 "./src/main/blackbox/blackbox_fielddefs.h"
+        floatFlag;
+    int32_t newValue;
+    float newFloatValue;
+} flightLogEvent_inflightAdjustment_t;
+
+typedef struct flightLogEvent_loggingResume_s {
+    uint32_t logIteration;
+    timeUs_t currentTimeUs;
+} flightLogEvent_loggingResume_t;
+
+typedef struct flightLogEvent_IMUError_s {
+    uint32_t errorCode;
+} flightLogEvent_IMUError_t;
+
+#define FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128
+
+typedef union flightLogEventData_u {
+    flightLogEvent_syncBeep_t syncBeep;
+    flightLogEvent_flightMode_t flightMode;
+    flightLogEvent_inflightAdjustment_t inflightAdjustment;
+    flightLogEvent_loggingResume_t loggingResume;
+    flightLogEvent_IMUError_t imuError;
+} flightLogEventData_t;
+
+typedef struct flightLogEvent_s {
+    FlightLogEvent event;
+    flightLogEventData_t data;
+} flightLogEvent_t;
+# 21 "./src/main/blackbox/blackbox.h" 2
+
+
+
+typedef struct blackboxConfig_s {
+    uint16_t rate_num;
+    uint16_t rate_denom;
+    uint8_t device;
+    uint8_t invertedCardDetection;
+    uint8_t compression;
+} blackboxConfig_t;
+
+extern blackboxConfig_t blackboxConfig_System; extern blackboxConfig_t blackboxConfig_Copy; static inline const blackboxConfig_t* blackboxConfig(void) { return &blackboxConfig_System; } static inline blackboxConfig_t* blackboxConfigMutable(void) { return &blackboxConfig_System; } struct _dummy;
+
+void blackboxLogEvent(FlightLogEvent event, flightLogEventData_t *data);
+
+void blackboxInit(void);
+void blackboxUpdate(timeUs_t currentTimeUs);
+void blackboxProcess(timeUs_t currentTimeUs);
+void blackboxStart(void);
+void blackboxFinish(void);
+
+# 41 "./src/main/blackbox/blackbox.h" 3 4
+_Bool 
+# 41 "./src/main/blackbox/blackbox.h"
+    blackboxMayEditConfig(void);
+uint32_t blackboxGetSnapshotsDropped(void);
+# 17 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/flight/mixer.h" 1
+# 18 "./src/main/flight/mixer.h"
+       
+
+
+
+
+
+
+#define MAX_SUPPORTED_MOTORS 12
+
+
+#define YAW_JUMP_PREVENTION_LIMIT_LOW 80
+#define YAW_JUMP_PREVENTION_LIMIT_HIGH 500
+
+#define FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450
+
+
+#define DSHOT_DISARM_COMMAND 0
+#define DSHOT_MIN_THROTTLE 48
+#define DSHOT_MAX_THROTTLE 2047
+#define DSHOT_3D_DEADBAND_LOW 1047
+#define DSHOT_3D_DEADBAND_HIGH 1048
+
+typedef enum {
+    PLATFORM_MULTIROTOR = 0,
+    PLATFORM_AIRPLANE = 1,
+    PLATFORM_HELICOPTER = 2,
+    PLATFORM_TRICOPTER = 3,
+    PLATFORM_ROVER = 4,
+    PLATFORM_BOAT = 5,
+    PLATFORM_OTHER = 6
+} flyingPlatformType_e;
+
+typedef struct motorAxisCorrectionLimits_s {
+    int16_t min;
+    int16_t max;
+} motorAxisCorrectionLimits_t;
+
+
+typedef struct motorMixer_s {
+    float throttle;
+    float roll;
+    float pitch;
+    float yaw;
+} motorMixer_t;
+
+extern motorMixer_t primaryMotorMixer_SystemArray[12]; extern motorMixer_t primaryMotorMixer_CopyArray[12]; static inline const motorMixer_t* primaryMotorMixer(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t* primaryMotorMixerMutable(int _index) { return &primaryMotorMixer_SystemArray[_index]; } static inline motorMixer_t (* primaryMotorMixer_array(void))[12] { return &primaryMotorMixer_SystemArray; } struct _dummy;
+
+typedef struct mixerConfig_s {
+    int8_t motorDirectionInverted;
+    uint8_t platformType;
+    
+# 68 "./src/main/flight/mixer.h" 3 4
+   _Bool 
+# 68 "./src/main/flight/mixer.h"
+        hasFlaps;
+    int16_t appliedMixerPreset;
+    uint16_t fwMinThrottleDownPitchAngle;
+} mixerConfig_t;
+
+extern mixerConfig_t mixerConfig_System; extern mixerConfig_t mixerConfig_Copy; static inline const mixerConfig_t* mixerConfig(void) { return &mixerConfig_System; } static inline mixerConfig_t* mixerConfigMutable(void) { return &mixerConfig_System; } struct _dummy;
+
+typedef struct reversibleMotorsConfig_s {
+    uint16_t deadband_low;
+    uint16_t deadband_high;
+    uint16_t neutral;
+} reversibleMotorsConfig_t;
+
+extern reversibleMotorsConfig_t reversibleMotorsConfig_System; extern reversibleMotorsConfig_t reversibleMotorsConfig_Copy; static inline const reversibleMotorsConfig_t* reversibleMotorsConfig(void) { return &reversibleMotorsConfig_System; } static inline reversibleMotorsConfig_t* reversibleMotorsConfigMutable(void) { return &reversibleMotorsConfig_System; } struct _dummy;
+
+typedef struct motorConfig_s {
+
+    uint16_t maxthrottle;
+    uint16_t mincommand;
+    uint16_t motorPwmRate;
+    uint8_t motorPwmProtocol;
+    uint16_t motorAccelTimeMs;
+    uint16_t motorDecelTimeMs;
+    uint16_t digitalIdleOffsetValue;
+    float throttleIdle;
+    float throttleScale;
+    uint8_t motorPoleCount;
+} motorConfig_t;
+
+extern motorConfig_t motorConfig_System; extern motorConfig_t motorConfig_Copy; static inline const motorConfig_t* motorConfig(void) { return &motorConfig_System; } static inline motorConfig_t* motorConfigMutable(void) { return &motorConfig_System; } struct _dummy;
+
+typedef enum {
+    MOTOR_STOPPED_USER,
+    MOTOR_STOPPED_AUTO,
+    MOTOR_RUNNING
+} motorStatus_e;
+
+typedef enum {
+    MOTOR_DIRECTION_FORWARD,
+    MOTOR_DIRECTION_BACKWARD,
+    MOTOR_DIRECTION_DEADBAND
+} reversibleMotorsThrottleState_e;
+
+extern int16_t motor[12];
+extern int16_t motor_disarmed[12];
+extern int mixerThrottleCommand;
+
+int getThrottleIdleValue(void);
+uint8_t getMotorCount(void);
+float getMotorMixRange(void);
+
+# 118 "./src/main/flight/mixer.h" 3 4
+_Bool 
+# 118 "./src/main/flight/mixer.h"
+    mixerIsOutputSaturated(void);
+motorStatus_e getMotorStatus(void);
+
+void writeAllMotors(int16_t mc);
+void mixerInit(void);
+void mixerUpdateStateFlags(void);
+void mixerResetDisarmedMotors(void);
+void mixTable(const float dT);
+void writeMotors(void);
+void processServoAutotrim(void);
+void stopMotors(void);
+void stopPwmAllMotors(void);
+
+void loadPrimaryMotorMixer(void);
+# 18 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/flight/failsafe.h" 1
+# 18 "./src/main/flight/failsafe.h"
+       
+
+
+
+#define FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)
+#define MILLIS_PER_TENTH_SECOND 100
+#define MILLIS_PER_SECOND 1000
+#define PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND
+#define PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND
+#define PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND
+#define PERIOD_RXDATA_FAILURE 200
+#define PERIOD_RXDATA_RECOVERY 200
+
+
+typedef struct failsafeConfig_s {
+    uint16_t failsafe_throttle;
+    uint16_t failsafe_throttle_low_delay;
+    uint8_t failsafe_delay;
+    uint8_t failsafe_recovery_delay;
+    uint8_t failsafe_off_delay;
+    uint8_t failsafe_procedure;
+
+    int16_t failsafe_fw_roll_angle;
+    int16_t failsafe_fw_pitch_angle;
+    int16_t failsafe_fw_yaw_rate;
+    uint16_t failsafe_stick_motion_threshold;
+    uint16_t failsafe_min_distance;
+    uint8_t failsafe_min_distance_procedure;
+    
+# 46 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 46 "./src/main/flight/failsafe.h"
+        failsafe_mission;
+} failsafeConfig_t;
+
+extern failsafeConfig_t failsafeConfig_System; extern failsafeConfig_t failsafeConfig_Copy; static inline const failsafeConfig_t* failsafeConfig(void) { return &failsafeConfig_System; } static inline failsafeConfig_t* failsafeConfigMutable(void) { return &failsafeConfig_System; } struct _dummy;
+
+typedef enum {
+
+
+
+
+    FAILSAFE_IDLE = 0,
+# 65 "./src/main/flight/failsafe.h"
+    FAILSAFE_RX_LOSS_DETECTED,
+
+
+
+
+
+
+
+    FAILSAFE_RX_LOSS_IDLE,
+# 82 "./src/main/flight/failsafe.h"
+    FAILSAFE_RETURN_TO_HOME,
+# 93 "./src/main/flight/failsafe.h"
+    FAILSAFE_LANDING,
+
+
+
+
+
+
+    FAILSAFE_LANDED,
+
+
+
+
+
+    FAILSAFE_RX_LOSS_MONITORING,
+
+
+
+
+    FAILSAFE_RX_LOSS_RECOVERED
+} failsafePhase_e;
+
+typedef enum {
+    FAILSAFE_RXLINK_DOWN = 0,
+    FAILSAFE_RXLINK_UP
+} failsafeRxLinkState_e;
+
+typedef enum {
+    FAILSAFE_PROCEDURE_AUTO_LANDING = 0,
+    FAILSAFE_PROCEDURE_DROP_IT,
+    FAILSAFE_PROCEDURE_RTH,
+    FAILSAFE_PROCEDURE_NONE
+} failsafeProcedure_e;
+
+typedef enum {
+    RTH_IDLE = 0,
+    RTH_IN_PROGRESS,
+    RTH_HAS_LANDED
+} rthState_e;
+
+typedef struct failsafeState_s {
+    int16_t events;
+    
+# 134 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 134 "./src/main/flight/failsafe.h"
+        monitoring;
+    
+# 135 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 135 "./src/main/flight/failsafe.h"
+        suspended;
+    
+# 136 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 136 "./src/main/flight/failsafe.h"
+        active;
+    
+# 137 "./src/main/flight/failsafe.h" 3 4
+   _Bool 
+# 137 "./src/main/flight/failsafe.h"
+        controlling;
+    timeMs_t rxDataFailurePeriod;
+    timeMs_t rxDataRecoveryPeriod;
+    timeMs_t validRxDataReceivedAt;
+    timeMs_t validRxDataFailedAt;
+    timeMs_t throttleLowPeriod;
+    timeMs_t landingShouldBeFinishedAt;
+    timeMs_t receivingRxDataPeriod;
+    timeMs_t receivingRxDataPeriodPreset;
+    failsafeProcedure_e activeProcedure;
+    failsafePhase_e phase;
+    failsafeRxLinkState_e rxLinkState;
+    int16_t lastGoodRcCommand[4];
+} failsafeState_t;
+
+void failsafeInit(void);
+void failsafeReset(void);
+
+void failsafeStartMonitoring(void);
+void failsafeUpdateState(void);
+
+failsafePhase_e failsafePhase(void);
+
+# 159 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 159 "./src/main/flight/failsafe.h"
+    failsafeIsMonitoring(void);
+
+# 160 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 160 "./src/main/flight/failsafe.h"
+    failsafeIsActive(void);
+
+# 161 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 161 "./src/main/flight/failsafe.h"
+    failsafeIsReceivingRxData(void);
+void failsafeOnRxSuspend(void);
+void failsafeOnRxResume(void);
+
+# 164 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 164 "./src/main/flight/failsafe.h"
+    failsafeMayRequireNavigationMode(void);
+void failsafeApplyControlInput(void);
+
+# 166 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 166 "./src/main/flight/failsafe.h"
+    failsafeRequiresAngleMode(void);
+
+# 167 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 167 "./src/main/flight/failsafe.h"
+    failsafeRequiresMotorStop(void);
+
+# 168 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 168 "./src/main/flight/failsafe.h"
+    failsafeShouldApplyControlInput(void);
+
+# 169 "./src/main/flight/failsafe.h" 3 4
+_Bool 
+# 169 "./src/main/flight/failsafe.h"
+    failsafeBypassNavigation(void);
+void failsafeUpdateRcCommandValues(void);
+
+void failsafeOnValidDataReceived(void);
+void failsafeOnValidDataFailed(void);
+# 19 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/boardalignment.h" 1
+# 18 "./src/main/sensors/boardalignment.h"
+       
+
+
+
+typedef struct boardAlignment_s {
+    int16_t rollDeciDegrees;
+    int16_t pitchDeciDegrees;
+    int16_t yawDeciDegrees;
+} boardAlignment_t;
+
+extern boardAlignment_t boardAlignment_System; extern boardAlignment_t boardAlignment_Copy; static inline const boardAlignment_t* boardAlignment(void) { return &boardAlignment_System; } static inline boardAlignment_t* boardAlignmentMutable(void) { return &boardAlignment_System; } struct _dummy;
+
+void initBoardAlignment(void);
+void updateBoardAlignment(int16_t roll, int16_t pitch);
+void applySensorAlignment(int32_t * dest, int32_t * src, uint8_t rotation);
+void applyBoardAlignment(int32_t *vec);
+# 20 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/sensors/battery.h" 1
+# 18 "./src/main/sensors/battery.h"
+       
+
+
+# 1 "./src/main/drivers/time.h" 1
+# 18 "./src/main/drivers/time.h"
+       
+
+
+
+
+
+void delayMicroseconds(timeUs_t us);
+void delay(timeMs_t ms);
+
+timeUs_t micros(void);
+timeUs_t microsISR(void);
+timeMs_t millis(void);
+
+uint32_t ticks(void);
+timeDelta_t ticks_diff_us(uint32_t begin, uint32_t end);
+# 22 "./src/main/sensors/battery.h" 2
+
+
+#define VBAT_SCALE_DEFAULT 1100
+
+#define VBAT_SCALE_MIN 0
+#define VBAT_SCALE_MAX 65535
+
+
+#define CURRENT_METER_SCALE 400
+
+
+
+#define CURRENT_METER_OFFSET 0
+
+
+
+#define MAX_BATTERY_PROFILE_COUNT 3
+
+
+typedef enum {
+    CURRENT_SENSOR_NONE = 0,
+    CURRENT_SENSOR_ADC,
+    CURRENT_SENSOR_VIRTUAL,
+    CURRENT_SENSOR_ESC,
+    CURRENT_SENSOR_MAX = CURRENT_SENSOR_VIRTUAL
+} currentSensor_e;
+
+typedef enum {
+    VOLTAGE_SENSOR_NONE = 0,
+    VOLTAGE_SENSOR_ADC,
+    VOLTAGE_SENSOR_ESC
+} voltageSensor_e;
+
+typedef enum {
+    BAT_CAPACITY_UNIT_MAH,
+    BAT_CAPACITY_UNIT_MWH,
+} batCapacityUnit_e;
+
+typedef struct {
+  uint8_t profile_index;
+  uint16_t max_voltage;
+} profile_comp_t;
+
+typedef enum {
+    BAT_VOLTAGE_RAW,
+    BAT_VOLTAGE_SAG_COMP
+} batVoltageSource_e;
+
+typedef struct batteryMetersConfig_s {
+
+    struct {
+        uint16_t scale;
+        voltageSensor_e type;
+    } voltage;
+
+    struct {
+        int16_t scale;
+        int16_t offset;
+        currentSensor_e type;
+    } current;
+
+    batVoltageSource_e voltageSource;
+
+    uint32_t cruise_power;
+    uint16_t idle_power;
+    uint8_t rth_energy_margin;
+
+    float throttle_compensation_weight;
+
+} batteryMetersConfig_t;
+
+typedef struct batteryProfile_s {
+
+    uint8_t cells;
+
+    struct {
+        uint16_t cellDetect;
+        uint16_t cellMax;
+        uint16_t cellMin;
+        uint16_t cellWarning;
+    } voltage;
+
+    struct {
+        uint32_t value;
+        uint32_t warning;
+        uint32_t critical;
+        batCapacityUnit_e unit;
+    } capacity;
+
+} batteryProfile_t;
+
+extern batteryMetersConfig_t batteryMetersConfig_System; extern batteryMetersConfig_t batteryMetersConfig_Copy; static inline const batteryMetersConfig_t* batteryMetersConfig(void) { return &batteryMetersConfig_System; } static inline batteryMetersConfig_t* batteryMetersConfigMutable(void) { return &batteryMetersConfig_System; } struct _dummy;
+extern batteryProfile_t batteryProfiles_SystemArray[3]; extern batteryProfile_t batteryProfiles_CopyArray[3]; static inline const batteryProfile_t* batteryProfiles(int _index) { return &batteryProfiles_SystemArray[_index]; } static inline batteryProfile_t* batteryProfilesMutable(int _index) { return &batteryProfiles_SystemArray[_index]; } static inline batteryProfile_t (* batteryProfiles_array(void))[3] { return &batteryProfiles_SystemArray; } struct _dummy;
+
+extern const batteryProfile_t *currentBatteryProfile;
+
+typedef enum {
+    BATTERY_OK = 0,
+    BATTERY_WARNING,
+    BATTERY_CRITICAL,
+    BATTERY_NOT_PRESENT
+} batteryState_e;
+
+
+uint16_t batteryAdcToVoltage(uint16_t src);
+batteryState_e getBatteryState(void);
+
+# 128 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 128 "./src/main/sensors/battery.h"
+    batteryWasFullWhenPluggedIn(void);
+
+# 129 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 129 "./src/main/sensors/battery.h"
+    batteryUsesCapacityThresholds(void);
+void batteryInit(void);
+void setBatteryProfile(uint8_t profileIndex);
+void activateBatteryProfile(void);
+void batteryDisableProfileAutoswitch(void);
+
+
+# 135 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 135 "./src/main/sensors/battery.h"
+    isBatteryVoltageConfigured(void);
+
+# 136 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 136 "./src/main/sensors/battery.h"
+    isPowerSupplyImpedanceValid(void);
+uint16_t getBatteryVoltage(void);
+uint16_t getBatteryRawVoltage(void);
+uint16_t getBatterySagCompensatedVoltage(void);
+uint16_t getBatteryWarningVoltage(void);
+uint8_t getBatteryCellCount(void);
+uint16_t getBatteryRawAverageCellVoltage(void);
+uint16_t getBatteryAverageCellVoltage(void);
+uint16_t getBatterySagCompensatedAverageCellVoltage(void);
+uint32_t getBatteryRemainingCapacity(void);
+uint16_t getPowerSupplyImpedance(void);
+
+
+# 148 "./src/main/sensors/battery.h" 3 4
+_Bool 
+# 148 "./src/main/sensors/battery.h"
+    isAmperageConfigured(void);
+int16_t getAmperage(void);
+int32_t getPower(void);
+int32_t getMAhDrawn(void);
+int32_t getMWhDrawn(void);
+
+void batteryUpdate(timeUs_t timeDelta);
+void currentMeterUpdate(timeUs_t timeDelta);
+void sagCompensatedVBatUpdate(timeUs_t currentTime, timeUs_t timeDelta);
+void powerMeterUpdate(timeUs_t timeDelta);
+
+uint8_t calculateBatteryPercentage(void);
+float calculateThrottleCompensationFactor(void);
+int32_t calculateAveragePower(void);
+int32_t calculateAverageEfficiency(void);
+int32_t heatLossesCompensatedPower(int32_t power);
+# 21 "./obj/main/SITL/settings_generated.c" 2
+
+# 1 "./src/main/flight/servos.h" 1
+# 18 "./src/main/flight/servos.h"
+       
+
+
+# 1 "./src/main/common/logic_condition.h" 1
+# 24 "./src/main/common/logic_condition.h"
+       
+
+
+
+
+#define MAX_LOGIC_CONDITIONS 16
+
+typedef enum {
+    LOGIC_CONDITION_TRUE = 0,
+    LOGIC_CONDITION_EQUAL,
+    LOGIC_CONDITION_GREATER_THAN,
+    LOGIC_CONDITION_LOWER_THAN,
+    LOGIC_CONDITION_LOW,
+    LOGIC_CONDITION_MID,
+    LOGIC_CONDITION_HIGH,
+    LOGIC_CONDITION_AND,
+    LOGIC_CONDITION_OR,
+    LOGIC_CONDITION_XOR,
+    LOGIC_CONDITION_NAND,
+    LOGIC_CONDITION_NOR,
+    LOGIC_CONDITION_NOT,
+    LOGIC_CONDITION_STICKY,
+    LOGIC_CONDITION_ADD,
+    LOGIC_CONDITION_SUB,
+    LOGIC_CONDITION_MUL,
+    LOGIC_CONDITION_DIV,
+    LOGIC_CONDITION_GVAR_SET,
+    LOGIC_CONDITION_GVAR_INC,
+    LOGIC_CONDITION_GVAR_DEC,
+    LOGIC_CONDITION_LAST
+} logicOperation_e;
+
+typedef enum logicOperandType_s {
+    LOGIC_CONDITION_OPERAND_TYPE_VALUE = 0,
+    LOGIC_CONDITION_OPERAND_TYPE_RC_CHANNEL,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT,
+    LOGIC_CONDITION_OPERAND_TYPE_FLIGHT_MODE,
+    LOGIC_CONDITION_OPERAND_TYPE_LC,
+    LOGIC_CONDITION_OPERAND_TYPE_GVAR,
+    LOGIC_CONDITION_OPERAND_TYPE_LAST
+} logicOperandType_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_ARM_TIMER = 0,
+    LOGIC_CONDITION_OPERAND_FLIGHT_HOME_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TRIP_DISTANCE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_RSSI,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VBAT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CELL_VOLTAGE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_CURRENT,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MAH_DRAWN,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GPS_SATS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_GROUD_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_3D_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_AIR_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ALTITUDE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_VERTICAL_SPEED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_TROTTLE_POS,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_ATTITUDE_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ARMED,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_AUTOLAUNCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_ALTITUDE_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_POSITION_CONTROL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_EMERGENCY_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_WP,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_LANDING,
+    LOGIC_CONDITION_OPERAND_FLIGHT_IS_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_ROLL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_PITCH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_STABILIZED_YAW,
+} logicFlightOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_FAILSAFE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_MANUAL,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_RTH,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_POSHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_CRUISE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ALTHOLD,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_ANGLE,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_HORIZON,
+    LOGIC_CONDITION_OPERAND_FLIGHT_MODE_AIR,
+} logicFlightModeOperands_e;
+
+typedef enum {
+    LOGIC_CONDITION_FLAG_LATCH = 1 << 0,
+} logicConditionFlags_e;
+
+typedef struct logicOperand_s {
+    logicOperandType_e type;
+    int32_t value;
+} logicOperand_t;
+
+typedef struct logicCondition_s {
+    uint8_t enabled;
+    int8_t activatorId;
+    logicOperation_e operation;
+    logicOperand_t operandA;
+    logicOperand_t operandB;
+    uint8_t flags;
+} logicCondition_t;
+
+extern logicCondition_t logicConditions_SystemArray[16]; extern logicCondition_t logicConditions_CopyArray[16]; static inline const logicCondition_t* logicConditions(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t* logicConditionsMutable(int _index) { return &logicConditions_SystemArray[_index]; } static inline logicCondition_t (* logicConditions_array(void))[16] { return &logicConditions_SystemArray; } struct _dummy;
+
+typedef struct logicConditionState_s {
+    int value;
+    uint8_t flags;
+} logicConditionState_t;
+
+void logicConditionProcess(uint8_t i);
+
+int logicConditionGetOperandValue(logicOperandType_e type, int operand);
+
+int logicConditionGetValue(int8_t conditionId);
+void logicConditionUpdateTask(timeUs_t currentTimeUs);
+void logicConditionReset(void);
+# 22 "./src/main/flight/servos.h" 2
+
+#define MAX_SUPPORTED_SERVOS 16
+
+
+typedef enum {
+    INPUT_STABILIZED_ROLL = 0,
+    INPUT_STABILIZED_PITCH = 1,
+    INPUT_STABILIZED_YAW = 2,
+    INPUT_STABILIZED_THROTTLE = 3,
+    INPUT_RC_ROLL = 4,
+    INPUT_RC_PITCH = 5,
+    INPUT_RC_YAW = 6,
+    INPUT_RC_THROTTLE = 7,
+    INPUT_RC_CH5 = 8,
+    INPUT_RC_CH6 = 9,
+    INPUT_RC_CH7 = 10,
+    INPUT_RC_CH8 = 11,
+    INPUT_GIMBAL_PITCH = 12,
+    INPUT_GIMBAL_ROLL = 13,
+    INPUT_FEATURE_FLAPS = 14,
+    INPUT_RC_CH9 = 15,
+    INPUT_RC_CH10 = 16,
+    INPUT_RC_CH11 = 17,
+    INPUT_RC_CH12 = 18,
+    INPUT_RC_CH13 = 19,
+    INPUT_RC_CH14 = 20,
+    INPUT_RC_CH15 = 21,
+    INPUT_RC_CH16 = 22,
+    INPUT_STABILIZED_ROLL_PLUS = 23,
+    INPUT_STABILIZED_ROLL_MINUS = 24,
+    INPUT_STABILIZED_PITCH_PLUS = 25,
+    INPUT_STABILIZED_PITCH_MINUS = 26,
+    INPUT_STABILIZED_YAW_PLUS = 27,
+    INPUT_STABILIZED_YAW_MINUS = 28,
+    INPUT_MAX = 29,
+    INPUT_GVAR_0 = 30,
+    INPUT_GVAR_1 = 31,
+    INPUT_GVAR_2 = 32,
+    INPUT_GVAR_3 = 33,
+
+    INPUT_SOURCE_COUNT
+} inputSource_e;
+
+
+typedef enum {
+    SERVO_GIMBAL_PITCH = 0,
+    SERVO_GIMBAL_ROLL = 1,
+    SERVO_ELEVATOR = 2,
+    SERVO_FLAPPERON_1 = 3,
+    SERVO_FLAPPERON_2 = 4,
+    SERVO_RUDDER = 5,
+
+    SERVO_BICOPTER_LEFT = 4,
+    SERVO_BICOPTER_RIGHT = 5,
+
+    SERVO_DUALCOPTER_LEFT = 4,
+    SERVO_DUALCOPTER_RIGHT = 5,
+
+    SERVO_SINGLECOPTER_1 = 3,
+    SERVO_SINGLECOPTER_2 = 4,
+    SERVO_SINGLECOPTER_3 = 5,
+    SERVO_SINGLECOPTER_4 = 6,
+
+} servoIndex_e;
+
+#define SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR
+#define SERVO_PLANE_INDEX_MAX SERVO_RUDDER
+
+#define SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT
+#define SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT
+
+#define SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1
+#define SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4
+
+#define SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1
+#define SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2
+
+#define FLAPERON_THROW_DEFAULT 200
+#define FLAPERON_THROW_MIN 50
+#define FLAPERON_THROW_MAX 450
+
+typedef struct servoMixer_s {
+    uint8_t targetChannel;
+    uint8_t inputSource;
+    int16_t rate;
+    uint8_t speed;
+
+    int8_t conditionId;
+
+} servoMixer_t;
+
+#define MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)
+#define MAX_SERVO_SPEED UINT8_MAX
+#define SERVO_OUTPUT_MAX 2500
+#define SERVO_OUTPUT_MIN 500
+
+extern servoMixer_t customServoMixers_SystemArray[(2 * 16)]; extern servoMixer_t customServoMixers_CopyArray[(2 * 16)]; static inline const servoMixer_t* customServoMixers(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t* customServoMixersMutable(int _index) { return &customServoMixers_SystemArray[_index]; } static inline servoMixer_t (* customServoMixers_array(void))[(2 * 16)] { return &customServoMixers_SystemArray; } struct _dummy;
+
+typedef struct servoParam_s {
+    int16_t min;
+    int16_t max;
+    int16_t middle;
+    int8_t rate;
+} servoParam_t;
+
+extern servoParam_t servoParams_SystemArray[16]; extern servoParam_t servoParams_CopyArray[16]; static inline const servoParam_t* servoParams(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t* servoParamsMutable(int _index) { return &servoParams_SystemArray[_index]; } static inline servoParam_t (* servoParams_array(void))[16] { return &servoParams_SystemArray; } struct _dummy;
+
+typedef struct servoConfig_s {
+
+    uint16_t servoCenterPulse;
+    uint16_t servoPwmRate;
+    int16_t servo_lowpass_freq;
+    uint16_t flaperon_throw_offset;
+    uint8_t servo_protocol;
+    uint8_t tri_unarmed_servo;
+} servoConfig_t;
+
+extern servoConfig_t servoConfig_System; extern servoConfig_t servoConfig_Copy; static inline const servoConfig_t* servoConfig(void) { return &servoConfig_System; } static inline servoConfig_t* servoConfigMutable(void) { return &servoConfig_System; } struct _dummy;
+
+typedef struct servoMetadata_s {
+    float scaleMax;
+    float scaleMin;
+} servoMetadata_t;
+
+extern int16_t servo[16];
+
+
+# 148 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 148 "./src/main/flight/servos.h"
+    isServoOutputEnabled(void);
+void setServoOutputEnabled(
+# 149 "./src/main/flight/servos.h" 3 4
+                          _Bool 
+# 149 "./src/main/flight/servos.h"
+                               flag);
+
+# 150 "./src/main/flight/servos.h" 3 4
+_Bool 
+# 150 "./src/main/flight/servos.h"
+    isMixerUsingServos(void);
+void writeServos(void);
+void loadCustomServoMixer(void);
+void servoMixer(float dT);
+void servoComputeScalingFactors(uint8_t servoIndex);
+void servosInit(void);
+int getServoCount(void);
+# 23 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/fc/controlrate_profile.h" 1
+# 18 "./src/main/fc/controlrate_profile.h"
+       
+
+
+
+
+
+#define MAX_CONTROL_RATE_PROFILE_COUNT 3
+# 34 "./src/main/fc/controlrate_profile.h"
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6
+#define CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20
+#define CONTROL_RATE_CONFIG_YAW_RATE_MAX 180
+#define CONTROL_RATE_CONFIG_YAW_RATE_MIN 2
+#define CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20
+
+#define CONTROL_RATE_CONFIG_TPA_MAX 100
+
+typedef struct controlRateConfig_s {
+
+    struct {
+        uint8_t rcMid8;
+        uint8_t rcExpo8;
+        uint8_t dynPID;
+        uint16_t pa_breakpoint;
+        uint16_t fixedWingTauMs;
+    } throttle;
+
+    struct {
+        uint8_t rcExpo8;
+        uint8_t rcYawExpo8;
+        uint8_t rates[3];
+    } stabilized;
+
+    struct {
+        uint8_t rcExpo8;
+        uint8_t rcYawExpo8;
+        uint8_t rates[3];
+    } manual;
+
+    struct {
+        uint8_t fpvCamAngleDegrees;
+    } misc;
+
+} controlRateConfig_t;
+
+extern controlRateConfig_t controlRateProfiles_SystemArray[3]; extern controlRateConfig_t controlRateProfiles_CopyArray[3]; static inline const controlRateConfig_t* controlRateProfiles(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t* controlRateProfilesMutable(int _index) { return &controlRateProfiles_SystemArray[_index]; } static inline controlRateConfig_t (* controlRateProfiles_array(void))[3] { return &controlRateProfiles_SystemArray; } struct _dummy;
+
+extern const controlRateConfig_t *currentControlRateProfile;
+
+void setControlRateProfile(uint8_t profileIndex);
+void changeControlRateProfile(uint8_t profileIndex);
+void activateControlRateConfig(void);
+uint8_t getCurrentControlRateProfile(void);
+# 24 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/io/serial.h" 1
+# 18 "./src/main/io/serial.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/serial.h" 1
+# 18 "./src/main/drivers/serial.h"
+       
+# 1 "./src/main/drivers/io.h" 1
+# 18 "./src/main/drivers/io.h"
+       
+# 34 "./src/main/drivers/io.h"
+#define IO_TAG(pinid) DEFIO_TAG(pinid)
+# 73 "./src/main/drivers/io.h"
+#define IOCFG_OUT_PP 0
+#define IOCFG_OUT_OD 0
+#define IOCFG_AF_PP 0
+#define IOCFG_AF_OD 0
+#define IOCFG_IPD 0
+#define IOCFG_IPU 0
+#define IOCFG_IN_FLOATING 0
+
+
+
+
+
+
+# 1 "./src/main/drivers/io_def.h" 1
+       
+
+
+
+
+
+#define DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)
+#define DEFIO_TAG__NONE 0
+#define DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)
+#define DEFIO_TAG_E__NONE 0
+
+
+
+
+
+#define DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)
+#define DEFIO_REC__NONE NULL
+
+#define DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)
+
+
+
+#define DEFIO_REC_INDEXED(idx) (ioRecs + (idx))
+
+
+#define DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))
+#define DEFIO_TAG_ISEMPTY(tag) (!(tag))
+#define DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)
+#define DEFIO_TAG_PIN(tag) ((tag) & 0x0f)
+
+
+
+
+# 1 "./src/main/drivers/io_def_generated.h" 1
+       
+
+
+
+
+
+
+
+#define DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA
+#define DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_A_OFFSET (0)
+
+
+#define DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB
+#define DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)
+
+
+#define DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC
+#define DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)
+
+
+
+
+#define DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_D_USED_MASK 0
+#define DEFIO_PORT_D_USED_COUNT 0
+
+#define DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_E_USED_MASK 0
+#define DEFIO_PORT_E_USED_COUNT 0
+
+#define DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_F_USED_MASK 0
+#define DEFIO_PORT_F_USED_COUNT 0
+
+#define DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)
+
+
+
+
+
+#define DEFIO_PORT_G_USED_MASK 0
+#define DEFIO_PORT_G_USED_COUNT 0
+
+#define DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)
+
+
+
+
+#define DEFIO_GPIOID__A 0
+#define DEFIO_GPIOID__B 1
+#define DEFIO_GPIOID__C 2
+#define DEFIO_GPIOID__D 3
+#define DEFIO_GPIOID__E 4
+#define DEFIO_GPIOID__F 5
+#define DEFIO_GPIOID__G 6
+
+
+
+
+
+#define DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)
+#define DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)
+#define DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)
+#define DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)
+#define DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)
+#define DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)
+#define DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)
+#define DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)
+#define DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)
+#define DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)
+#define DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)
+#define DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)
+#define DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)
+#define DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)
+#define DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)
+#define DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)
+#define DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)
+
+
+
+
+
+
+#define DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)
+#define DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)
+#define DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)
+#define DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)
+#define DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)
+#define DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)
+#define DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)
+#define DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)
+#define DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)
+#define DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)
+#define DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)
+#define DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)
+#define DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)
+#define DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)
+#define DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)
+#define DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)
+#define DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)
+#define DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)
+#define DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)
+#define DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)
+#define DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)
+#define DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)
+#define DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)
+#define DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)
+#define DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)
+#define DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)
+#define DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)
+#define DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)
+#define DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)
+#define DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)
+#define DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)
+#define DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+
+
+
+
+
+
+#define DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)
+#define DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)
+# 522 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET
+
+
+
+
+
+
+#define DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET
+#define DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE
+#define DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET
+
+
+
+#define DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)
+# 1121 "./src/main/drivers/io_def_generated.h"
+#define DEFIO_PORT_USED_COUNT 3
+#define DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK
+#define DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET
+# 35 "./src/main/drivers/io_def.h" 2
+# 87 "./src/main/drivers/io.h" 2
+
+
+# 88 "./src/main/drivers/io.h" 3 4
+_Bool 
+# 88 "./src/main/drivers/io.h"
+    IORead(IO_t io);
+void IOWrite(IO_t io, 
+# 89 "./src/main/drivers/io.h" 3 4
+                     _Bool 
+# 89 "./src/main/drivers/io.h"
+                          value);
+void IOHi(IO_t io);
+void IOLo(IO_t io);
+void IOToggle(IO_t io);
+
+void IOInit(IO_t io, resourceOwner_e owner, resourceType_e resource, uint8_t index);
+void IORelease(IO_t io);
+resourceOwner_e IOGetOwner(IO_t io);
+resourceType_e IOGetResources(IO_t io);
+IO_t IOGetByTag(ioTag_t tag);
+
+void IOConfigGPIO(IO_t io, ioConfig_t cfg);
+
+
+
+
+void IOInitGlobal(void);
+# 20 "./src/main/drivers/serial.h" 2
+
+typedef struct {
+    ioTag_t rxPin;
+    ioTag_t txPin;
+} serialPortPins_t;
+
+typedef enum portMode_t {
+    MODE_RX = 1 << 0,
+    MODE_TX = 1 << 1,
+    MODE_RXTX = MODE_RX | MODE_TX
+} portMode_t;
+
+typedef enum portOptions_t {
+    SERIAL_NOT_INVERTED = 0 << 0,
+    SERIAL_INVERTED = 1 << 0,
+    SERIAL_STOPBITS_1 = 0 << 1,
+    SERIAL_STOPBITS_2 = 1 << 1,
+    SERIAL_PARITY_NO = 0 << 2,
+    SERIAL_PARITY_EVEN = 1 << 2,
+    SERIAL_UNIDIR = 0 << 3,
+    SERIAL_BIDIR = 1 << 3,
+# 49 "./src/main/drivers/serial.h"
+    SERIAL_BIDIR_OD = 0 << 4,
+    SERIAL_BIDIR_PP = 1 << 4,
+    SERIAL_BIDIR_NOPULL = 1 << 5,
+} portOptions_t;
+
+
+typedef struct serialBufChunk_s {
+    const uint8_t *data;
+    int count;
+} serialBufChunk_t;
+
+typedef void (*serialReceiveCallbackPtr)(uint16_t data, void *rxCallbackData);
+typedef void (*serialReceiveFrameCallbackPtr)(const uint8_t *data, int count, void *rxCallbackData);
+
+typedef struct serialPort_s {
+
+    const struct serialPortVTable *vTable;
+
+    uint8_t identifier;
+    portMode_t mode;
+    portOptions_t options;
+
+    uint32_t baudRate;
+
+    uint32_t rxBufferSize;
+    uint32_t txBufferSize;
+    volatile uint8_t *rxBuffer;
+    volatile uint8_t *txBuffer;
+    uint32_t rxBufferHead;
+    uint32_t rxBufferTail;
+    uint32_t txBufferHead;
+    uint32_t txBufferTail;
+
+    serialReceiveCallbackPtr rxCallback;
+    void *rxCallbackData;
+
+    serialReceiveFrameCallbackPtr rxFrameCallback;
+
+
+    uint32_t rxIrqCount;
+} serialPort_t;
+
+struct serialPortVTable {
+    void (*serialWrite)(serialPort_t *instance, uint8_t ch);
+
+    uint32_t (*serialTotalRxWaiting)(const serialPort_t *instance);
+    uint32_t (*serialTotalTxFree)(const serialPort_t *instance);
+
+    uint8_t (*serialRead)(serialPort_t *instance);
+
+
+    void (*serialSetBaudRate)(serialPort_t *instance, uint32_t baudRate);
+
+    
+# 102 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 102 "./src/main/drivers/serial.h"
+        (*isSerialTransmitBufferEmpty)(const serialPort_t *instance);
+
+    void (*setMode)(serialPort_t *instance, portMode_t mode);
+
+    void (*writeBuf)(serialPort_t *instance, const void *data, int count);
+
+    
+# 108 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 108 "./src/main/drivers/serial.h"
+        (*isConnected)(const serialPort_t *instance);
+
+    
+# 110 "./src/main/drivers/serial.h" 3 4
+   _Bool 
+# 110 "./src/main/drivers/serial.h"
+        (*isIdle)(serialPort_t *instance);
+
+
+    void (*beginWrite)(serialPort_t *instance);
+    void (*endWrite)(serialPort_t *instance);
+
+
+    void (*writeBufChunks)(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+};
+
+void serialWrite(serialPort_t *instance, uint8_t ch);
+uint32_t serialRxBytesWaiting(const serialPort_t *instance);
+uint32_t serialTxBytesFree(const serialPort_t *instance);
+void serialWriteBuf(serialPort_t *instance, const uint8_t *data, int count);
+void serialSetReceiveFrameCallback(serialPort_t *instance, serialReceiveFrameCallbackPtr rxFrameCallback);
+void serialWriteBufChunks(serialPort_t *instance, const serialBufChunk_t *chunks, int chunkCount);
+uint8_t serialRead(serialPort_t *instance);
+void serialSetBaudRate(serialPort_t *instance, uint32_t baudRate);
+void serialSetMode(serialPort_t *instance, portMode_t mode);
+
+# 129 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/serial.h"
+    isSerialTransmitBufferEmpty(const serialPort_t *instance);
+void serialPrint(serialPort_t *instance, const char *str);
+uint32_t serialGetBaudRate(serialPort_t *instance);
+
+# 132 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 132 "./src/main/drivers/serial.h"
+    serialIsConnected(const serialPort_t *instance);
+
+# 133 "./src/main/drivers/serial.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/serial.h"
+    serialIsIdle(serialPort_t *instance);
+
+
+void serialWriteBufShim(void *instance, const uint8_t *data, int count);
+void serialBeginWrite(serialPort_t *instance);
+void serialEndWrite(serialPort_t *instance);
+# 25 "./src/main/io/serial.h" 2
+
+typedef enum {
+    PORTSHARING_UNUSED = 0,
+    PORTSHARING_NOT_SHARED,
+    PORTSHARING_SHARED
+} portSharing_e;
+
+typedef enum {
+    FUNCTION_NONE = 0,
+    FUNCTION_MSP = (1 << 0),
+    FUNCTION_GPS = (1 << 1),
+    FUNCTION_TELEMETRY_FRSKY = (1 << 2),
+    FUNCTION_TELEMETRY_HOTT = (1 << 3),
+    FUNCTION_TELEMETRY_LTM = (1 << 4),
+    FUNCTION_TELEMETRY_SMARTPORT = (1 << 5),
+    FUNCTION_RX_SERIAL = (1 << 6),
+    FUNCTION_BLACKBOX = (1 << 7),
+    FUNCTION_TELEMETRY_MAVLINK = (1 << 8),
+    FUNCTION_TELEMETRY_IBUS = (1 << 9),
+    FUNCTION_RCDEVICE = (1 << 10),
+    FUNCTION_VTX_SMARTAUDIO = (1 << 11),
+    FUNCTION_VTX_TRAMP = (1 << 12),
+    FUNCTION_UAV_INTERCONNECT = (1 << 13),
+    FUNCTION_OPTICAL_FLOW = (1 << 14),
+    FUNCTION_LOG = (1 << 15),
+    FUNCTION_RANGEFINDER = (1 << 16),
+    FUNCTION_VTX_FFPV = (1 << 17),
+    FUNCTION_ESCSERIAL = (1 << 18),
+    FUNCTION_TELEMETRY_SIM = (1 << 19),
+    FUNCTION_FRSKY_OSD = (1 << 20),
+    FUNCTION_DJI_HD_OSD = (1 << 21),
+    FUNCTION_SERVO_SERIAL = (1 << 22),
+} serialPortFunction_e;
+
+typedef enum {
+    BAUD_AUTO = 0,
+    BAUD_1200,
+    BAUD_2400,
+    BAUD_4800,
+    BAUD_9600,
+    BAUD_19200,
+    BAUD_38400,
+    BAUD_57600,
+    BAUD_115200,
+    BAUD_230400,
+    BAUD_250000,
+    BAUD_460800,
+    BAUD_921600,
+    BAUD_1000000,
+    BAUD_1500000,
+    BAUD_2000000,
+    BAUD_2470000
+} baudRate_e;
+
+extern const uint32_t baudRates[];
+
+
+typedef enum {
+    SERIAL_PORT_NONE = -1,
+    SERIAL_PORT_USART1 = 0,
+    SERIAL_PORT_USART2,
+    SERIAL_PORT_USART3,
+    SERIAL_PORT_USART4,
+    SERIAL_PORT_USART5,
+    SERIAL_PORT_USART6,
+    SERIAL_PORT_USART7,
+    SERIAL_PORT_USART8,
+    SERIAL_PORT_USB_VCP = 20,
+    SERIAL_PORT_SOFTSERIAL1 = 30,
+    SERIAL_PORT_SOFTSERIAL2,
+    SERIAL_PORT_IDENTIFIER_MAX = SERIAL_PORT_SOFTSERIAL2
+} serialPortIdentifier_e;
+
+extern const serialPortIdentifier_e serialPortIdentifiers[8];
+
+
+
+
+typedef struct serialPortUsage_s {
+    serialPortIdentifier_e identifier;
+    serialPort_t *serialPort;
+    serialPortFunction_e function;
+} serialPortUsage_t;
+
+serialPort_t *findSharedSerialPort(uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+serialPort_t *findNextSharedSerialPort(uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+
+
+
+
+typedef struct serialPortConfig_s {
+    uint32_t functionMask;
+    serialPortIdentifier_e identifier;
+    uint8_t msp_baudrateIndex;
+    uint8_t gps_baudrateIndex;
+    uint8_t peripheral_baudrateIndex;
+    uint8_t telemetry_baudrateIndex;
+} serialPortConfig_t;
+
+typedef struct serialConfig_s {
+    serialPortConfig_t portConfigs[8];
+    uint8_t reboot_character;
+} serialConfig_t;
+
+extern serialConfig_t serialConfig_System; extern serialConfig_t serialConfig_Copy; static inline const serialConfig_t* serialConfig(void) { return &serialConfig_System; } static inline serialConfig_t* serialConfigMutable(void) { return &serialConfig_System; } struct _dummy;
+
+typedef void serialConsumer(uint8_t);
+
+
+
+
+void serialInit(
+# 136 "./src/main/io/serial.h" 3 4
+               _Bool 
+# 136 "./src/main/io/serial.h"
+                    softserialEnabled, serialPortIdentifier_e serialPortToDisable);
+void serialRemovePort(serialPortIdentifier_e identifier);
+uint8_t serialGetAvailablePortCount(void);
+
+# 139 "./src/main/io/serial.h" 3 4
+_Bool 
+# 139 "./src/main/io/serial.h"
+    serialIsPortAvailable(serialPortIdentifier_e identifier);
+
+# 140 "./src/main/io/serial.h" 3 4
+_Bool 
+# 140 "./src/main/io/serial.h"
+    isSerialConfigValid(const serialConfig_t *serialConfig);
+serialPortConfig_t *serialFindPortConfiguration(serialPortIdentifier_e identifier);
+
+# 142 "./src/main/io/serial.h" 3 4
+_Bool 
+# 142 "./src/main/io/serial.h"
+    doesConfigurationUsePort(serialPortIdentifier_e portIdentifier);
+serialPortConfig_t *findSerialPortConfig(serialPortFunction_e function);
+serialPortConfig_t *findNextSerialPortConfig(serialPortFunction_e function);
+
+portSharing_e determinePortSharing(const serialPortConfig_t *portConfig, serialPortFunction_e function);
+
+# 147 "./src/main/io/serial.h" 3 4
+_Bool 
+# 147 "./src/main/io/serial.h"
+    isSerialPortShared(const serialPortConfig_t *portConfig, uint32_t functionMask, serialPortFunction_e sharedWithFunction);
+
+serialPortUsage_t *findSerialPortUsageByIdentifier(serialPortIdentifier_e identifier);
+int findSerialPortIndexByIdentifier(serialPortIdentifier_e identifier);
+
+
+
+serialPort_t *openSerialPort(
+    serialPortIdentifier_e identifier,
+    serialPortFunction_e function,
+    serialReceiveCallbackPtr callback,
+    void *rxCallbackData,
+    uint32_t baudrate,
+    portMode_t mode,
+    portOptions_t options
+);
+void closeSerialPort(serialPort_t *serialPort);
+
+void waitForSerialPortToFinishTransmitting(serialPort_t *serialPort);
+
+baudRate_e lookupBaudRateIndex(uint32_t baudRate);
+
+
+
+
+
+void serialPassthrough(serialPort_t *left, serialPort_t *right, serialConsumer *leftC, serialConsumer *rightC);
+# 25 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/flight/imu.h" 1
+# 18 "./src/main/flight/imu.h"
+       
+
+
+
+
+# 1 "./src/main/common/quaternion.h" 1
+# 21 "./src/main/common/quaternion.h"
+       
+
+
+
+
+
+
+
+typedef struct {
+    float q0, q1, q2, q3;
+} fpQuaternion_t;
+
+static inline fpQuaternion_t * quaternionInitUnit(fpQuaternion_t * result)
+{
+    result->q0 = 1.0f;
+    result->q1 = 0.0f;
+    result->q2 = 0.0f;
+    result->q3 = 0.0f;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionInitFromVector(fpQuaternion_t * result, const fpVector3_t * v)
+{
+    result->q0 = 0.0f;
+    result->q1 = v->x;
+    result->q2 = v->y;
+    result->q3 = v->z;
+    return result;
+}
+
+static inline void quaternionToAxisAngle(fpAxisAngle_t * result, const fpQuaternion_t * q)
+{
+    fpAxisAngle_t a = {.axis = {{1.0f, 0.0f, 0.0f}}};
+
+    a.angle = 2.0f * acos_approx(constrainf(q->q0, -1.0f, 1.0f));
+
+    if (a.angle > 3.14159265358979323846f) {
+        a.angle -= 2.0f * 3.14159265358979323846f;
+    }
+
+    const float sinVal = sqrt(1.0f - q->q0 * q->q0);
+
+
+    if (sinVal > 1e-4f) {
+        a.axis.x = q->q1 / sinVal;
+        a.axis.y = q->q2 / sinVal;
+        a.axis.z = q->q3 / sinVal;
+    } else {
+        a.angle = 0;
+    }
+
+    *result = a;
+}
+
+static inline fpQuaternion_t * axisAngleToQuaternion(fpQuaternion_t * result, const fpAxisAngle_t * a)
+{
+  fpQuaternion_t q;
+  const float s = sin_approx(a->angle / 2.0f);
+
+  q.q0 = cos_approx(a->angle / 2.0f);
+  q.q1 = -a->axis.x * s;
+  q.q2 = -a->axis.y * s;
+  q.q3 = -a->axis.z * s;
+
+  *result = q;
+  return result;
+}
+
+static inline float quaternionNormSqared(const fpQuaternion_t * q)
+{
+    return ((q->q0)*(q->q0)) + ((q->q1)*(q->q1)) + ((q->q2)*(q->q2)) + ((q->q3)*(q->q3));
+}
+
+static inline fpQuaternion_t * quaternionMultiply(fpQuaternion_t * result, const fpQuaternion_t * a, const fpQuaternion_t * b)
+{
+  fpQuaternion_t p;
+
+  p.q0 = a->q0 * b->q0 - a->q1 * b->q1 - a->q2 * b->q2 - a->q3 * b->q3;
+  p.q1 = a->q0 * b->q1 + a->q1 * b->q0 + a->q2 * b->q3 - a->q3 * b->q2;
+  p.q2 = a->q0 * b->q2 - a->q1 * b->q3 + a->q2 * b->q0 + a->q3 * b->q1;
+  p.q3 = a->q0 * b->q3 + a->q1 * b->q2 - a->q2 * b->q1 + a->q3 * b->q0;
+
+  *result = p;
+  return result;
+}
+
+static inline fpQuaternion_t * quaternionScale(fpQuaternion_t * result, const fpQuaternion_t * a, const float b)
+{
+    fpQuaternion_t p;
+
+    p.q0 = a->q0 * b;
+    p.q1 = a->q1 * b;
+    p.q2 = a->q2 * b;
+    p.q3 = a->q3 * b;
+
+    *result = p;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionAdd(fpQuaternion_t * result, const fpQuaternion_t * a, const fpQuaternion_t * b)
+{
+    fpQuaternion_t p;
+
+    p.q0 = a->q0 + b->q0;
+    p.q1 = a->q1 + b->q1;
+    p.q2 = a->q2 + b->q2;
+    p.q3 = a->q3 + b->q3;
+
+    *result = p;
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionConjugate(fpQuaternion_t * result, const fpQuaternion_t * q)
+{
+    result->q0 = q->q0;
+    result->q1 = -q->q1;
+    result->q2 = -q->q2;
+    result->q3 = -q->q3;
+
+    return result;
+}
+
+static inline fpQuaternion_t * quaternionNormalize(fpQuaternion_t * result, const fpQuaternion_t * q)
+{
+    float mod = sqrtf(quaternionNormSqared(q));
+    if (mod < 1e-6f) {
+
+        result->q0 = 1;
+        result->q1 = 0;
+        result->q2 = 0;
+        result->q3 = 0;
+    }
+    else {
+        result->q0 = q->q0 / mod;
+        result->q1 = q->q1 / mod;
+        result->q2 = q->q2 / mod;
+        result->q3 = q->q3 / mod;
+    }
+
+    return result;
+}
+
+static inline fpVector3_t * quaternionRotateVector(fpVector3_t * result, const fpVector3_t * vect, const fpQuaternion_t * ref)
+{
+    fpQuaternion_t vectQuat, refConj;
+
+    vectQuat.q0 = 0;
+    vectQuat.q1 = vect->x;
+    vectQuat.q2 = vect->y;
+    vectQuat.q3 = vect->z;
+
+    quaternionConjugate(&refConj, ref);
+    quaternionMultiply(&vectQuat, &refConj, &vectQuat);
+    quaternionMultiply(&vectQuat, &vectQuat, ref);
+
+    result->x = vectQuat.q1;
+    result->y = vectQuat.q2;
+    result->z = vectQuat.q3;
+    return result;
+}
+
+static inline fpVector3_t * quaternionRotateVectorInv(fpVector3_t * result, const fpVector3_t * vect, const fpQuaternion_t * ref)
+{
+    fpQuaternion_t vectQuat, refConj;
+
+    vectQuat.q0 = 0;
+    vectQuat.q1 = vect->x;
+    vectQuat.q2 = vect->y;
+    vectQuat.q3 = vect->z;
+
+    quaternionConjugate(&refConj, ref);
+    quaternionMultiply(&vectQuat, ref, &vectQuat);
+    quaternionMultiply(&vectQuat, &vectQuat, &refConj);
+
+    result->x = vectQuat.q1;
+    result->y = vectQuat.q2;
+    result->z = vectQuat.q3;
+    return result;
+}
+# 24 "./src/main/flight/imu.h" 2
+
+
+
+extern fpVector3_t imuMeasuredAccelBF;
+extern fpVector3_t imuMeasuredRotationBF;
+
+typedef union {
+    int16_t raw[3];
+    struct {
+
+        int16_t roll;
+        int16_t pitch;
+        int16_t yaw;
+    } values;
+} attitudeEulerAngles_t;
+
+extern fpQuaternion_t orientation;
+extern attitudeEulerAngles_t attitude;
+extern float rMat[3][3];
+
+typedef struct imuConfig_s {
+    uint16_t dcm_kp_acc;
+    uint16_t dcm_ki_acc;
+    uint16_t dcm_kp_mag;
+    uint16_t dcm_ki_mag;
+    uint8_t small_angle;
+    uint8_t acc_ignore_rate;
+    uint8_t acc_ignore_slope;
+} imuConfig_t;
+
+extern imuConfig_t imuConfig_System; extern imuConfig_t imuConfig_Copy; static inline const imuConfig_t* imuConfig(void) { return &imuConfig_System; } static inline imuConfig_t* imuConfigMutable(void) { return &imuConfig_System; } struct _dummy;
+
+typedef struct imuRuntimeConfig_s {
+    float dcm_kp_acc;
+    float dcm_ki_acc;
+    float dcm_kp_mag;
+    float dcm_ki_mag;
+    uint8_t small_angle;
+} imuRuntimeConfig_t;
+
+void imuConfigure(void);
+
+void imuSetMagneticDeclination(float declinationDeg);
+void imuUpdateAttitude(timeUs_t currentTimeUs);
+void imuUpdateAccelerometer(void);
+float calculateCosTiltAngle(void);
+
+# 70 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 70 "./src/main/flight/imu.h"
+    isImuReady(void);
+
+# 71 "./src/main/flight/imu.h" 3 4
+_Bool 
+# 71 "./src/main/flight/imu.h"
+    isImuHeadingValid(void);
+
+void imuTransformVectorBodyToEarth(fpVector3_t * v);
+void imuTransformVectorEarthToBody(fpVector3_t * v);
+
+void imuInit(void);
+# 26 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/fc/rc_controls.h" 1
+# 18 "./src/main/fc/rc_controls.h"
+       
+
+
+
+#define AIRMODE_THROTTLE_THRESHOLD 1300
+
+typedef enum rc_alias {
+    ROLL = 0,
+    PITCH,
+    YAW,
+    THROTTLE,
+    AUX1,
+    AUX2,
+    AUX3,
+    AUX4,
+    AUX5,
+    AUX6,
+    AUX7,
+    AUX8,
+    AUX9,
+    AUX10,
+    AUX11,
+    AUX12
+} rc_alias_e;
+
+typedef enum {
+    THROTTLE_LOW = 0,
+    THROTTLE_HIGH
+} throttleStatus_e;
+
+typedef enum {
+    THROTTLE_STATUS_TYPE_RC = 0,
+    THROTTLE_STATUS_TYPE_COMMAND
+} throttleStatusType_e;
+
+typedef enum {
+    NOT_CENTERED = 0,
+    CENTERED
+} rollPitchStatus_e;
+
+typedef enum {
+    STICK_CENTER = 0,
+    THROTTLE_THRESHOLD
+} airmodeAndAntiWindupHandlingType_e;
+
+typedef enum {
+    ROL_LO = (1 << (2 * ROLL)),
+    ROL_CE = (3 << (2 * ROLL)),
+    ROL_HI = (2 << (2 * ROLL)),
+
+    PIT_LO = (1 << (2 * PITCH)),
+    PIT_CE = (3 << (2 * PITCH)),
+    PIT_HI = (2 << (2 * PITCH)),
+
+    YAW_LO = (1 << (2 * YAW)),
+    YAW_CE = (3 << (2 * YAW)),
+    YAW_HI = (2 << (2 * YAW)),
+
+    THR_LO = (1 << (2 * THROTTLE)),
+    THR_CE = (3 << (2 * THROTTLE)),
+    THR_HI = (2 << (2 * THROTTLE))
+} stickPositions_e;
+
+extern int16_t rcCommand[4];
+
+typedef struct rcControlsConfig_s {
+    uint8_t deadband;
+    uint8_t yaw_deadband;
+    uint8_t pos_hold_deadband;
+    uint8_t alt_hold_deadband;
+    uint16_t mid_throttle_deadband;
+    uint8_t airmodeHandlingType;
+    uint16_t airmodeThrottleThreshold;
+} rcControlsConfig_t;
+
+extern rcControlsConfig_t rcControlsConfig_System; extern rcControlsConfig_t rcControlsConfig_Copy; static inline const rcControlsConfig_t* rcControlsConfig(void) { return &rcControlsConfig_System; } static inline rcControlsConfig_t* rcControlsConfigMutable(void) { return &rcControlsConfig_System; } struct _dummy;
+
+typedef struct armingConfig_s {
+    uint8_t fixed_wing_auto_arm;
+    uint8_t disarm_kill_switch;
+    uint16_t switchDisarmDelayMs;
+} armingConfig_t;
+
+extern armingConfig_t armingConfig_System; extern armingConfig_t armingConfig_Copy; static inline const armingConfig_t* armingConfig(void) { return &armingConfig_System; } static inline armingConfig_t* armingConfigMutable(void) { return &armingConfig_System; } struct _dummy;
+
+stickPositions_e getRcStickPositions(void);
+
+# 104 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 104 "./src/main/fc/rc_controls.h"
+    checkStickPosition(stickPositions_e stickPos);
+
+
+# 106 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 106 "./src/main/fc/rc_controls.h"
+    areSticksInApModePosition(uint16_t ap_mode);
+
+# 107 "./src/main/fc/rc_controls.h" 3 4
+_Bool 
+# 107 "./src/main/fc/rc_controls.h"
+    areSticksDeflectedMoreThanPosHoldDeadband(void);
+throttleStatus_e calculateThrottleStatus(throttleStatusType_e type);
+rollPitchStatus_e calculateRollPitchCenterStatus(void);
+void processRcStickPositions(throttleStatus_e throttleStatus);
+
+int32_t getRcStickDeflection(int32_t axis);
+# 27 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/flight/pid.h" 1
+# 18 "./src/main/flight/pid.h"
+       
+
+
+# 1 "./src/main/fc/runtime_config.h" 1
+# 18 "./src/main/fc/runtime_config.h"
+       
+
+
+typedef enum {
+    ARMED = (1 << 2),
+    WAS_EVER_ARMED = (1 << 3),
+
+    ARMING_DISABLED_FAILSAFE_SYSTEM = (1 << 7),
+
+    ARMING_DISABLED_NOT_LEVEL = (1 << 8),
+    ARMING_DISABLED_SENSORS_CALIBRATING = (1 << 9),
+    ARMING_DISABLED_SYSTEM_OVERLOADED = (1 << 10),
+    ARMING_DISABLED_NAVIGATION_UNSAFE = (1 << 11),
+    ARMING_DISABLED_COMPASS_NOT_CALIBRATED = (1 << 12),
+    ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED = (1 << 13),
+    ARMING_DISABLED_ARM_SWITCH = (1 << 14),
+    ARMING_DISABLED_HARDWARE_FAILURE = (1 << 15),
+    ARMING_DISABLED_BOXFAILSAFE = (1 << 16),
+    ARMING_DISABLED_BOXKILLSWITCH = (1 << 17),
+    ARMING_DISABLED_RC_LINK = (1 << 18),
+    ARMING_DISABLED_THROTTLE = (1 << 19),
+    ARMING_DISABLED_CLI = (1 << 20),
+    ARMING_DISABLED_CMS_MENU = (1 << 21),
+    ARMING_DISABLED_OSD_MENU = (1 << 22),
+    ARMING_DISABLED_ROLLPITCH_NOT_CENTERED = (1 << 23),
+    ARMING_DISABLED_SERVO_AUTOTRIM = (1 << 24),
+    ARMING_DISABLED_OOM = (1 << 25),
+    ARMING_DISABLED_INVALID_SETTING = (1 << 26),
+    ARMING_DISABLED_PWM_OUTPUT_ERROR = (1 << 27),
+
+    ARMING_DISABLED_ALL_FLAGS = (ARMING_DISABLED_FAILSAFE_SYSTEM | ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_SENSORS_CALIBRATING |
+                                                       ARMING_DISABLED_SYSTEM_OVERLOADED | ARMING_DISABLED_NAVIGATION_UNSAFE |
+                                                       ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED |
+                                                       ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE | ARMING_DISABLED_BOXFAILSAFE |
+                                                       ARMING_DISABLED_BOXKILLSWITCH | ARMING_DISABLED_RC_LINK | ARMING_DISABLED_THROTTLE | ARMING_DISABLED_CLI |
+                                                       ARMING_DISABLED_CMS_MENU | ARMING_DISABLED_OSD_MENU | ARMING_DISABLED_ROLLPITCH_NOT_CENTERED |
+                                                       ARMING_DISABLED_SERVO_AUTOTRIM | ARMING_DISABLED_OOM | ARMING_DISABLED_INVALID_SETTING |
+                                                       ARMING_DISABLED_PWM_OUTPUT_ERROR),
+} armingFlag_e;
+
+
+
+
+
+
+#define ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)
+
+
+
+
+
+
+
+extern uint32_t armingFlags;
+
+extern const char *armingDisableFlagNames[];
+
+#define isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))
+#define DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))
+#define ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))
+#define ARMING_FLAG(mask) (armingFlags & (mask))
+
+
+
+armingFlag_e isArmingDisabledReason(void);
+
+typedef enum {
+    ANGLE_MODE = (1 << 0),
+    HORIZON_MODE = (1 << 1),
+    HEADING_MODE = (1 << 2),
+    NAV_ALTHOLD_MODE= (1 << 3),
+    NAV_RTH_MODE = (1 << 4),
+    NAV_POSHOLD_MODE= (1 << 5),
+    HEADFREE_MODE = (1 << 6),
+    NAV_LAUNCH_MODE = (1 << 7),
+    MANUAL_MODE = (1 << 8),
+    FAILSAFE_MODE = (1 << 9),
+    AUTO_TUNE = (1 << 10),
+    NAV_WP_MODE = (1 << 11),
+    NAV_CRUISE_MODE = (1 << 12),
+    FLAPERON = (1 << 13),
+    TURN_ASSISTANT = (1 << 14),
+} flightModeFlags_e;
+
+extern uint32_t flightModeFlags;
+
+#define DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)
+#define ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)
+#define FLIGHT_MODE(mask) (flightModeFlags & (mask))
+
+typedef enum {
+    GPS_FIX_HOME = (1 << 0),
+    GPS_FIX = (1 << 1),
+    CALIBRATE_MAG = (1 << 2),
+    SMALL_ANGLE = (1 << 3),
+    FIXED_WING_LEGACY = (1 << 4),
+    ANTI_WINDUP = (1 << 5),
+    FLAPERON_AVAILABLE = (1 << 6),
+    NAV_MOTOR_STOP_OR_IDLE = (1 << 7),
+    COMPASS_CALIBRATED = (1 << 8),
+    ACCELEROMETER_CALIBRATED = (1 << 9),
+    PWM_DRIVER_AVAILABLE = (1 << 10),
+    NAV_CRUISE_BRAKING = (1 << 11),
+    NAV_CRUISE_BRAKING_BOOST = (1 << 12),
+    NAV_CRUISE_BRAKING_LOCKED = (1 << 13),
+    NAV_EXTRA_ARMING_SAFETY_BYPASSED = (1 << 14),
+    AIRMODE_ACTIVE = (1 << 15),
+    ESC_SENSOR_ENABLED = (1 << 16),
+    AIRPLANE = (1 << 17),
+    MULTIROTOR = (1 << 18),
+    ROVER = (1 << 19),
+    BOAT = (1 << 20),
+    ALTITUDE_CONTROL = (1 << 21),
+    MOVE_FORWARD_ONLY = (1 << 22),
+    SET_REVERSIBLE_MOTORS_FORWARD = (1 << 23),
+    FW_HEADING_USE_YAW = (1 << 24),
+} stateFlags_t;
+
+#define DISABLE_STATE(mask) (stateFlags &= ~(mask))
+#define ENABLE_STATE(mask) (stateFlags |= (mask))
+#define STATE(mask) (stateFlags & (mask))
+
+extern uint32_t stateFlags;
+
+typedef enum {
+    FLM_MANUAL,
+    FLM_ACRO,
+    FLM_ACRO_AIR,
+    FLM_ANGLE,
+    FLM_HORIZON,
+    FLM_ALTITUDE_HOLD,
+    FLM_POSITION_HOLD,
+    FLM_RTH,
+    FLM_MISSION,
+    FLM_CRUISE,
+    FLM_LAUNCH,
+    FLM_FAILSAFE,
+    FLM_COUNT
+} flightModeForTelemetry_e;
+
+flightModeForTelemetry_e getFlightModeForTelemetry(void);
+
+uint32_t enableFlightMode(flightModeFlags_e mask);
+uint32_t disableFlightMode(flightModeFlags_e mask);
+
+
+# 163 "./src/main/fc/runtime_config.h" 3 4
+_Bool 
+# 163 "./src/main/fc/runtime_config.h"
+    sensors(uint32_t mask);
+void sensorsSet(uint32_t mask);
+void sensorsClear(uint32_t mask);
+uint32_t sensorsMask(void);
+# 22 "./src/main/flight/pid.h" 2
+
+#define GYRO_SATURATION_LIMIT 1800
+#define PID_SUM_LIMIT_MIN 100
+#define PID_SUM_LIMIT_MAX 1000
+#define PID_SUM_LIMIT_DEFAULT 500
+#define PID_SUM_LIMIT_YAW_DEFAULT 350
+
+#define HEADING_HOLD_RATE_LIMIT_MIN 10
+#define HEADING_HOLD_RATE_LIMIT_MAX 250
+#define HEADING_HOLD_RATE_LIMIT_DEFAULT 90
+
+#define FW_ITERM_THROW_LIMIT_DEFAULT 165
+#define FW_ITERM_THROW_LIMIT_MIN 0
+#define FW_ITERM_THROW_LIMIT_MAX 500
+
+#define AXIS_ACCEL_MIN_LIMIT 50
+
+#define HEADING_HOLD_ERROR_LPF_FREQ 2
+
+
+
+
+#define FP_PID_RATE_FF_MULTIPLIER 31.0f
+#define FP_PID_RATE_P_MULTIPLIER 31.0f
+#define FP_PID_RATE_I_MULTIPLIER 4.0f
+#define FP_PID_RATE_D_MULTIPLIER 1905.0f
+#define FP_PID_RATE_D_FF_MULTIPLIER 7270.0f
+#define FP_PID_LEVEL_P_MULTIPLIER 6.56f
+#define FP_PID_YAWHOLD_P_MULTIPLIER 80.0f
+
+#define MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f
+#define MC_ITERM_RELAX_CUTOFF_DEFAULT 15
+
+#define ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15
+
+typedef enum {
+
+    PID_ROLL,
+    PID_PITCH,
+    PID_YAW,
+    PID_POS_Z,
+    PID_POS_XY,
+    PID_VEL_XY,
+    PID_SURFACE,
+    PID_LEVEL,
+    PID_HEADING,
+    PID_VEL_Z,
+    PID_POS_HEADING,
+    PID_ITEM_COUNT
+} pidIndex_e;
+
+
+typedef enum {
+    PID_TYPE_NONE = 0,
+    PID_TYPE_PID,
+    PID_TYPE_PIFF,
+    PID_TYPE_AUTO,
+} pidType_e;
+
+typedef struct pid8_s {
+    uint8_t P;
+    uint8_t I;
+    uint8_t D;
+    uint8_t FF;
+} pid8_t;
+
+typedef struct pidBank_s {
+    pid8_t pid[PID_ITEM_COUNT];
+} pidBank_t;
+
+typedef enum {
+    ITERM_RELAX_OFF = 0,
+    ITERM_RELAX_RP,
+    ITERM_RELAX_RPY
+} itermRelax_e;
+
+typedef enum {
+    ITERM_RELAX_GYRO = 0,
+    ITERM_RELAX_SETPOINT
+} itermRelaxType_e;
+
+typedef struct pidProfile_s {
+    uint8_t pidControllerType;
+    pidBank_t bank_fw;
+    pidBank_t bank_mc;
+
+    uint8_t dterm_lpf_type;
+    uint16_t dterm_lpf_hz;
+
+    uint8_t dterm_lpf2_type;
+    uint16_t dterm_lpf2_hz;
+
+    uint8_t yaw_lpf_hz;
+
+    uint8_t heading_hold_rate_limit;
+
+    uint8_t itermWindupPointPercent;
+
+    uint32_t axisAccelerationLimitYaw;
+    uint32_t axisAccelerationLimitRollPitch;
+
+    int16_t max_angle_inclination[2];
+
+    uint16_t pidSumLimit;
+    uint16_t pidSumLimitYaw;
+
+
+    uint16_t fixedWingItermThrowLimit;
+    float fixedWingReferenceAirspeed;
+    float fixedWingCoordinatedYawGain;
+    float fixedWingItermLimitOnStickPosition;
+
+    uint8_t loiter_direction;
+    float navVelXyDTermLpfHz;
+
+    uint8_t iterm_relax_type;
+    uint8_t iterm_relax_cutoff;
+    uint8_t iterm_relax;
+
+    float dBoostFactor;
+    float dBoostMaxAtAlleceleration;
+    uint8_t dBoostGyroDeltaLpfHz;
+    float antigravityGain;
+    float antigravityAccelerator;
+    uint8_t antigravityCutoff;
+
+    uint16_t navFwPosHdgPidsumLimit;
+    uint8_t controlDerivativeLpfHz;
+} pidProfile_t;
+
+typedef struct pidAutotuneConfig_s {
+    uint16_t fw_overshoot_time;
+    uint16_t fw_undershoot_time;
+    uint8_t fw_max_rate_threshold;
+    uint8_t fw_ff_to_p_gain;
+    uint16_t fw_ff_to_i_time_constant;
+} pidAutotuneConfig_t;
+
+extern pidProfile_t *pidProfile_ProfileCurrent; static inline const pidProfile_t* pidProfile(void) { return pidProfile_ProfileCurrent; } static inline pidProfile_t* pidProfileMutable(void) { return pidProfile_ProfileCurrent; } struct _dummy;
+extern pidAutotuneConfig_t pidAutotuneConfig_System; extern pidAutotuneConfig_t pidAutotuneConfig_Copy; static inline const pidAutotuneConfig_t* pidAutotuneConfig(void) { return &pidAutotuneConfig_System; } static inline pidAutotuneConfig_t* pidAutotuneConfigMutable(void) { return &pidAutotuneConfig_System; } struct _dummy;
+
+const pidBank_t * pidBank(void);
+pidBank_t * pidBankMutable(void);
+
+extern int16_t axisPID[];
+extern int32_t axisPID_P[], axisPID_I[], axisPID_D[], axisPID_Setpoint[];
+
+void pidInit(void);
+
+# 170 "./src/main/flight/pid.h" 3 4
+_Bool 
+# 170 "./src/main/flight/pid.h"
+    pidInitFilters(void);
+void pidResetErrorAccumulators(void);
+void pidResetTPAFilter(void);
+
+struct controlRateConfig_s;
+struct motorConfig_s;
+struct rxConfig_s;
+
+void schedulePidGainsUpdate(void);
+void updatePIDCoefficients(float dT);
+void pidController(float dT);
+
+float pidRateToRcCommand(float rateDPS, uint8_t rate);
+int16_t pidAngleToRcCommand(float angleDeciDegrees, int16_t maxInclination);
+
+enum {
+    HEADING_HOLD_DISABLED = 0,
+    HEADING_HOLD_UPDATE_HEADING,
+    HEADING_HOLD_ENABLED
+};
+
+void updateHeadingHoldTarget(int16_t heading);
+void resetHeadingHoldTarget(int16_t heading);
+int16_t getHeadingHoldTarget(void);
+
+void autotuneUpdateState(void);
+void autotuneFixedWingUpdate(const flight_dynamics_index_t axis, float desiredRateDps, float reachedRateDps, float pidOutput);
+
+pidType_e pidIndexGetType(pidIndex_e pidIndex);
+# 28 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/navigation/navigation.h" 1
+# 18 "./src/main/navigation/navigation.h"
+       
+# 27 "./src/main/navigation/navigation.h"
+# 1 "./src/main/config/feature.h" 1
+# 18 "./src/main/config/feature.h"
+       
+
+
+
+typedef struct featureConfig_s {
+    uint32_t enabledFeatures;
+} featureConfig_t;
+
+extern featureConfig_t featureConfig_System; extern featureConfig_t featureConfig_Copy; static inline const featureConfig_t* featureConfig(void) { return &featureConfig_System; } static inline featureConfig_t* featureConfigMutable(void) { return &featureConfig_System; } struct _dummy;
+
+void latchActiveFeatures(void);
+
+# 29 "./src/main/config/feature.h" 3 4
+_Bool 
+# 29 "./src/main/config/feature.h"
+    featureConfigured(uint32_t mask);
+
+# 30 "./src/main/config/feature.h" 3 4
+_Bool 
+# 30 "./src/main/config/feature.h"
+    feature(uint32_t mask);
+void featureSet(uint32_t mask);
+void featureClear(uint32_t mask);
+void featureClearAll(void);
+uint32_t featureMask(void);
+# 28 "./src/main/navigation/navigation.h" 2
+
+
+
+# 1 "./src/main/io/gps.h" 1
+# 18 "./src/main/io/gps.h"
+       
+
+
+
+
+
+
+
+#define GPS_DBHZ_MIN 0
+#define GPS_DBHZ_MAX 55
+
+#define LAT 0
+#define LON 1
+
+#define GPS_DEGREES_DIVIDER 10000000L
+
+typedef enum {
+    GPS_NMEA = 0,
+    GPS_UBLOX,
+    GPS_I2CNAV,
+    GPS_NAZA,
+    GPS_UBLOX7PLUS,
+    GPS_MTK,
+    GPS_PROVIDER_COUNT
+} gpsProvider_e;
+
+typedef enum {
+    SBAS_AUTO = 0,
+    SBAS_EGNOS,
+    SBAS_WAAS,
+    SBAS_MSAS,
+    SBAS_GAGAN,
+    SBAS_NONE
+} sbasMode_e;
+
+#define SBAS_MODE_MAX SBAS_GAGAN
+
+typedef enum {
+    GPS_BAUDRATE_115200 = 0,
+    GPS_BAUDRATE_57600,
+    GPS_BAUDRATE_38400,
+    GPS_BAUDRATE_19200,
+    GPS_BAUDRATE_9600,
+    GPS_BAUDRATE_COUNT
+} gpsBaudRate_e;
+
+typedef enum {
+    GPS_AUTOCONFIG_OFF = 0,
+    GPS_AUTOCONFIG_ON,
+} gpsAutoConfig_e;
+
+typedef enum {
+    GPS_AUTOBAUD_OFF = 0,
+    GPS_AUTOBAUD_ON
+} gpsAutoBaud_e;
+
+typedef enum {
+    GPS_DYNMODEL_PEDESTRIAN = 0,
+    GPS_DYNMODEL_AIR_1G,
+    GPS_DYNMODEL_AIR_4G,
+} gpsDynModel_e;
+
+typedef enum {
+    GPS_NO_FIX = 0,
+    GPS_FIX_2D,
+    GPS_FIX_3D
+} gpsFixType_e;
+
+#define GPS_BAUDRATE_MAX GPS_BAUDRATE_9600
+
+typedef struct gpsConfig_s {
+    gpsProvider_e provider;
+    sbasMode_e sbasMode;
+    gpsAutoConfig_e autoConfig;
+    gpsAutoBaud_e autoBaud;
+    gpsDynModel_e dynModel;
+    
+# 94 "./src/main/io/gps.h" 3 4
+   _Bool 
+# 94 "./src/main/io/gps.h"
+        ubloxUseGalileo;
+    uint8_t gpsMinSats;
+} gpsConfig_t;
+
+extern gpsConfig_t gpsConfig_System; extern gpsConfig_t gpsConfig_Copy; static inline const gpsConfig_t* gpsConfig(void) { return &gpsConfig_System; } static inline gpsConfig_t* gpsConfigMutable(void) { return &gpsConfig_System; } struct _dummy;
+
+typedef struct gpsCoordinateDDDMMmmmm_s {
+    int16_t dddmm;
+    int16_t mmmm;
+} gpsCoordinateDDDMMmmmm_t;
+
+
+typedef struct gpsLocation_s {
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+} gpsLocation_t;
+
+#define HDOP_SCALE (100)
+
+typedef struct gpsSolutionData_s {
+    struct {
+        
+# 116 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 116 "./src/main/io/gps.h"
+            hasNewData;
+        
+# 117 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 117 "./src/main/io/gps.h"
+            gpsHeartbeat;
+        
+# 118 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 118 "./src/main/io/gps.h"
+            validVelNE;
+        
+# 119 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 119 "./src/main/io/gps.h"
+            validVelD;
+        
+# 120 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 120 "./src/main/io/gps.h"
+            validMag;
+        
+# 121 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 121 "./src/main/io/gps.h"
+            validEPE;
+        
+# 122 "./src/main/io/gps.h" 3 4
+       _Bool 
+# 122 "./src/main/io/gps.h"
+            validTime;
+    } flags;
+
+    gpsFixType_e fixType;
+    uint8_t numSat;
+
+    gpsLocation_t llh;
+    int16_t magData[3];
+    int16_t velNED[3];
+
+    int16_t groundSpeed;
+    int16_t groundCourse;
+
+    uint16_t eph;
+    uint16_t epv;
+
+    uint16_t hdop;
+
+    dateTime_t time;
+
+} gpsSolutionData_t;
+
+typedef struct {
+    uint16_t lastMessageDt;
+    uint32_t errors;
+    uint32_t timeouts;
+    uint32_t packetCount;
+} gpsStatistics_t;
+
+extern gpsSolutionData_t gpsSol;
+extern gpsStatistics_t gpsStats;
+
+struct magDev_s;
+
+# 155 "./src/main/io/gps.h" 3 4
+_Bool 
+# 155 "./src/main/io/gps.h"
+    gpsMagDetect(struct magDev_s *mag);
+void gpsPreInit(void);
+void gpsInit(void);
+
+
+
+# 160 "./src/main/io/gps.h" 3 4
+_Bool 
+# 160 "./src/main/io/gps.h"
+    gpsUpdate(void);
+void updateGpsIndicator(timeUs_t currentTimeUs);
+
+# 162 "./src/main/io/gps.h" 3 4
+_Bool 
+# 162 "./src/main/io/gps.h"
+    isGPSHealthy(void);
+
+# 163 "./src/main/io/gps.h" 3 4
+_Bool 
+# 163 "./src/main/io/gps.h"
+    isGPSHeadingValid(void);
+struct serialPort_s;
+void gpsEnablePassthrough(struct serialPort_s *gpsPassthroughPort);
+# 32 "./src/main/navigation/navigation.h" 2
+
+
+extern gpsLocation_t GPS_home;
+extern uint32_t GPS_distanceToHome;
+extern int16_t GPS_directionToHome;
+
+extern 
+# 38 "./src/main/navigation/navigation.h" 3 4
+      _Bool 
+# 38 "./src/main/navigation/navigation.h"
+           autoThrottleManuallyIncreased;
+
+
+void onNewGPSData(void);
+
+
+
+#define NAV_BLACKBOX 
+
+
+
+
+
+
+#define NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2
+
+enum {
+    NAV_GPS_ATTI = 0,
+    NAV_GPS_CRUISE = 1
+};
+
+enum {
+    NAV_LOITER_RIGHT = 0,
+    NAV_LOITER_LEFT = 1,
+    NAV_LOITER_YAW = 2
+};
+
+enum {
+    NAV_RTH_NO_ALT = 0,
+    NAV_RTH_EXTRA_ALT = 1,
+    NAV_RTH_CONST_ALT = 2,
+    NAV_RTH_MAX_ALT = 3,
+    NAV_RTH_AT_LEAST_ALT = 4,
+    NAV_RTH_AT_LEAST_ALT_LINEAR_DESCENT = 5,
+
+};
+
+enum {
+    NAV_HEADING_CONTROL_NONE = 0,
+    NAV_HEADING_CONTROL_AUTO,
+    NAV_HEADING_CONTROL_MANUAL
+};
+
+typedef enum {
+    NAV_RESET_NEVER = 0,
+    NAV_RESET_ON_FIRST_ARM,
+    NAV_RESET_ON_EACH_ARM,
+} nav_reset_type_e;
+
+typedef enum {
+    NAV_RTH_ALLOW_LANDING_NEVER = 0,
+    NAV_RTH_ALLOW_LANDING_ALWAYS = 1,
+    NAV_RTH_ALLOW_LANDING_FS_ONLY = 2,
+} navRTHAllowLanding_e;
+
+typedef enum {
+    NAV_EXTRA_ARMING_SAFETY_OFF = 0,
+    NAV_EXTRA_ARMING_SAFETY_ON = 1,
+    NAV_EXTRA_ARMING_SAFETY_ALLOW_BYPASS = 2,
+} navExtraArmingSafety_e;
+
+typedef enum {
+    NAV_ARMING_BLOCKER_NONE = 0,
+    NAV_ARMING_BLOCKER_MISSING_GPS_FIX = 1,
+    NAV_ARMING_BLOCKER_NAV_IS_ALREADY_ACTIVE = 2,
+    NAV_ARMING_BLOCKER_FIRST_WAYPOINT_TOO_FAR = 3,
+    NAV_ARMING_BLOCKER_JUMP_WAYPOINT_ERROR = 4,
+} navArmingBlocker_e;
+
+typedef struct positionEstimationConfig_s {
+    uint8_t automatic_mag_declination;
+    uint8_t reset_altitude_type;
+    uint8_t reset_home_type;
+    uint8_t gravity_calibration_tolerance;
+    uint8_t use_gps_velned;
+    uint8_t allow_dead_reckoning;
+
+    uint16_t max_surface_altitude;
+
+    float w_z_baro_p;
+
+    float w_z_surface_p;
+    float w_z_surface_v;
+
+    float w_z_gps_p;
+    float w_z_gps_v;
+
+    float w_xy_gps_p;
+    float w_xy_gps_v;
+
+    float w_xy_flow_p;
+    float w_xy_flow_v;
+
+    float w_z_res_v;
+    float w_xy_res_v;
+
+    float w_acc_bias;
+    float w_xyz_acc_p;
+
+    float max_eph_epv;
+    float baro_epv;
+} positionEstimationConfig_t;
+
+extern positionEstimationConfig_t positionEstimationConfig_System; extern positionEstimationConfig_t positionEstimationConfig_Copy; static inline const positionEstimationConfig_t* positionEstimationConfig(void) { return &positionEstimationConfig_System; } static inline positionEstimationConfig_t* positionEstimationConfigMutable(void) { return &positionEstimationConfig_System; } struct _dummy;
+
+typedef struct navConfig_s {
+
+    struct {
+        struct {
+            uint8_t use_thr_mid_for_althold;
+            uint8_t extra_arming_safety;
+            uint8_t user_control_mode;
+            uint8_t rth_alt_control_mode;
+            uint8_t rth_climb_first;
+            uint8_t rth_tail_first;
+            uint8_t disarm_on_landing;
+            uint8_t rth_allow_landing;
+            uint8_t rth_climb_ignore_emerg;
+            uint8_t auto_overrides_motor_stop;
+        } flags;
+
+        uint8_t pos_failure_timeout;
+        uint16_t waypoint_radius;
+        uint16_t waypoint_safe_distance;
+        uint16_t max_auto_speed;
+        uint16_t max_auto_climb_rate;
+        uint16_t max_manual_speed;
+        uint16_t max_manual_climb_rate;
+        uint16_t land_descent_rate;
+        uint16_t land_slowdown_minalt;
+        uint16_t land_slowdown_maxalt;
+        uint16_t emerg_descent_rate;
+        uint16_t rth_altitude;
+        uint16_t rth_home_altitude;
+        uint16_t min_rth_distance;
+        uint16_t rth_abort_threshold;
+        uint16_t max_terrain_follow_altitude;
+        uint16_t rth_home_offset_distance;
+        uint16_t rth_home_offset_direction;
+    } general;
+
+    struct {
+        uint8_t max_bank_angle;
+        uint16_t hover_throttle;
+        uint16_t auto_disarm_delay;
+        uint16_t braking_speed_threshold;
+        uint16_t braking_disengage_speed;
+        uint16_t braking_timeout;
+        uint8_t braking_boost_factor;
+        uint16_t braking_boost_timeout;
+        uint16_t braking_boost_speed_threshold;
+        uint16_t braking_boost_disengage_speed;
+        uint8_t braking_bank_angle;
+        uint8_t posDecelerationTime;
+        uint8_t posResponseExpo;
+    } mc;
+
+    struct {
+        uint8_t max_bank_angle;
+        uint8_t max_climb_angle;
+        uint8_t max_dive_angle;
+        uint16_t cruise_throttle;
+        uint16_t cruise_speed;
+        uint8_t control_smoothness;
+        uint16_t min_throttle;
+        uint16_t max_throttle;
+        uint8_t pitch_to_throttle;
+        uint16_t loiter_radius;
+        int8_t land_dive_angle;
+        uint16_t launch_velocity_thresh;
+        uint16_t launch_accel_thresh;
+        uint16_t launch_time_thresh;
+        uint16_t launch_idle_throttle;
+        uint16_t launch_throttle;
+        uint16_t launch_motor_timer;
+        uint16_t launch_motor_spinup_time;
+        uint16_t launch_min_time;
+        uint16_t launch_timeout;
+        uint16_t launch_max_altitude;
+        uint8_t launch_climb_angle;
+        uint8_t launch_max_angle;
+        uint8_t cruise_yaw_rate;
+        
+# 220 "./src/main/navigation/navigation.h" 3 4
+       _Bool 
+# 220 "./src/main/navigation/navigation.h"
+                allow_manual_thr_increase;
+        
+# 221 "./src/main/navigation/navigation.h" 3 4
+       _Bool 
+# 221 "./src/main/navigation/navigation.h"
+            useFwNavYawControl;
+        uint8_t yawControlDeadband;
+    } fw;
+} navConfig_t;
+
+extern navConfig_t navConfig_System; extern navConfig_t navConfig_Copy; static inline const navConfig_t* navConfig(void) { return &navConfig_System; } static inline navConfig_t* navConfigMutable(void) { return &navConfig_System; } struct _dummy;
+
+typedef struct gpsOrigin_s {
+    
+# 229 "./src/main/navigation/navigation.h" 3 4
+   _Bool 
+# 229 "./src/main/navigation/navigation.h"
+           valid;
+    float scale;
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+} gpsOrigin_t;
+
+typedef enum {
+    NAV_WP_ACTION_WAYPOINT = 0x01,
+    NAV_WP_ACTION_HOLD_TIME = 0x03,
+    NAV_WP_ACTION_RTH = 0x04,
+    NAV_WP_ACTION_SET_POI = 0x05,
+    NAV_WP_ACTION_JUMP = 0x06,
+    NAV_WP_ACTION_SET_HEAD = 0x07,
+    NAV_WP_ACTION_LAND = 0x08
+} navWaypointActions_e;
+
+typedef enum {
+    NAV_WP_HEAD_MODE_NONE = 0,
+    NAV_WP_HEAD_MODE_POI = 1,
+    NAV_WP_HEAD_MODE_FIXED = 2
+} navWaypointHeadings_e;
+
+typedef enum {
+    NAV_WP_FLAG_LAST = 0xA5
+} navWaypointFlags_e;
+
+typedef struct {
+    uint8_t action;
+    int32_t lat;
+    int32_t lon;
+    int32_t alt;
+    int16_t p1, p2, p3;
+    uint8_t flag;
+} navWaypoint_t;
+
+typedef struct {
+    navWaypointHeadings_e mode;
+    uint32_t heading;
+    fpVector3_t poi_pos;
+} navWapointHeading_t;
+
+typedef struct radar_pois_s {
+    gpsLocation_t gps;
+    uint8_t state;
+    uint16_t heading;
+    uint16_t speed;
+    uint8_t lq;
+    uint16_t distance;
+    int16_t altitude;
+    int16_t direction;
+} radar_pois_t;
+
+#define RADAR_MAX_POIS 5
+
+extern radar_pois_t radar_pois[5];
+
+typedef struct {
+    fpVector3_t pos;
+    int32_t yaw;
+} navWaypointPosition_t;
+
+typedef struct navDestinationPath_s {
+    uint32_t distance;
+    int32_t bearing;
+} navDestinationPath_t;
+
+typedef struct {
+    float kP;
+    float kI;
+    float kD;
+    float kT;
+    float kFF;
+} pidControllerParam_t;
+
+typedef struct {
+    float kP;
+} pControllerParam_t;
+
+typedef struct {
+    
+# 309 "./src/main/navigation/navigation.h" 3 4
+   _Bool 
+# 309 "./src/main/navigation/navigation.h"
+        reset;
+    pidControllerParam_t param;
+    pt1Filter_t dterm_filter_state;
+    float dTermLpfHz;
+    float integrator;
+    float last_input;
+
+    float integral;
+    float proportional;
+    float derivative;
+    float feedForward;
+    float output_constrained;
+} pidController_t;
+
+typedef struct navigationPIDControllers_s {
+
+    pidController_t pos[3];
+    pidController_t vel[3];
+    pidController_t surface;
+
+
+    pidController_t fw_alt;
+    pidController_t fw_nav;
+    pidController_t fw_heading;
+} navigationPIDControllers_t;
+
+
+typedef enum {
+    MW_GPS_MODE_NONE = 0,
+    MW_GPS_MODE_HOLD,
+    MW_GPS_MODE_RTH,
+    MW_GPS_MODE_NAV,
+    MW_GPS_MODE_EMERG = 15
+} navSystemStatus_Mode_e;
+
+typedef enum {
+    MW_NAV_STATE_NONE = 0,
+    MW_NAV_STATE_RTH_START,
+    MW_NAV_STATE_RTH_ENROUTE,
+    MW_NAV_STATE_HOLD_INFINIT,
+    MW_NAV_STATE_HOLD_TIMED,
+    MW_NAV_STATE_WP_ENROUTE,
+    MW_NAV_STATE_PROCESS_NEXT,
+    MW_NAV_STATE_DO_JUMP,
+    MW_NAV_STATE_LAND_START,
+    MW_NAV_STATE_LAND_IN_PROGRESS,
+    MW_NAV_STATE_LANDED,
+    MW_NAV_STATE_LAND_SETTLE,
+    MW_NAV_STATE_LAND_START_DESCENT,
+    MW_NAV_STATE_HOVER_ABOVE_HOME,
+    MW_NAV_STATE_EMERGENCY_LANDING,
+} navSystemStatus_State_e;
+
+typedef enum {
+    MW_NAV_ERROR_NONE = 0,
+    MW_NAV_ERROR_TOOFAR,
+    MW_NAV_ERROR_SPOILED_GPS,
+    MW_NAV_ERROR_WP_CRC,
+    MW_NAV_ERROR_FINISH,
+    MW_NAV_ERROR_TIMEWAIT,
+    MW_NAV_ERROR_INVALID_JUMP,
+    MW_NAV_ERROR_INVALID_DATA,
+    MW_NAV_ERROR_WAIT_FOR_RTH_ALT,
+    MW_NAV_ERROR_GPS_FIX_LOST,
+    MW_NAV_ERROR_DISARMED,
+    MW_NAV_ERROR_LANDING
+} navSystemStatus_Error_e;
+
+typedef enum {
+    MW_NAV_FLAG_ADJUSTING_POSITION = 1 << 0,
+    MW_NAV_FLAG_ADJUSTING_ALTITUDE = 1 << 1,
+} navSystemStatus_Flags_e;
+
+typedef struct {
+    navSystemStatus_Mode_e mode;
+    navSystemStatus_State_e state;
+    navSystemStatus_Error_e error;
+    navSystemStatus_Flags_e flags;
+    uint8_t activeWpNumber;
+    navWaypointActions_e activeWpAction;
+} navSystemStatus_t;
+
+void navigationUsePIDs(void);
+void navigationInit(void);
+
+
+void updatePositionEstimator_BaroTopic(timeUs_t currentTimeUs);
+void updatePositionEstimator_OpticalFlowTopic(timeUs_t currentTimeUs);
+void updatePositionEstimator_SurfaceTopic(timeUs_t currentTimeUs, float newSurfaceAlt);
+void updatePositionEstimator_PitotTopic(timeUs_t currentTimeUs);
+
+
+void updateWaypointsAndNavigationMode(void);
+void updatePositionEstimator(void);
+void applyWaypointNavigationAndAltitudeHold(void);
+
+
+
+# 406 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 406 "./src/main/navigation/navigation.h"
+    navigationRequiresAngleMode(void);
+
+# 407 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 407 "./src/main/navigation/navigation.h"
+    navigationRequiresThrottleTiltCompensation(void);
+
+# 408 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 408 "./src/main/navigation/navigation.h"
+    navigationRequiresTurnAssistance(void);
+int8_t navigationGetHeadingControlState(void);
+
+
+
+navArmingBlocker_e navigationIsBlockingArming(
+# 413 "./src/main/navigation/navigation.h" 3 4
+                                             _Bool 
+# 413 "./src/main/navigation/navigation.h"
+                                                  *usedBypass);
+
+# 414 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 414 "./src/main/navigation/navigation.h"
+    navigationPositionEstimateIsHealthy(void);
+
+# 415 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 415 "./src/main/navigation/navigation.h"
+    navIsCalibrationComplete(void);
+
+# 416 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 416 "./src/main/navigation/navigation.h"
+    navigationTerrainFollowingEnabled(void);
+
+
+typedef struct {
+    uint8_t altStatus;
+    uint8_t posStatus;
+    uint8_t velStatus;
+    uint8_t aglStatus;
+    fpVector3_t pos;
+    fpVector3_t vel;
+    float agl;
+} navPositionAndVelocity_t;
+
+float getEstimatedActualVelocity(int axis);
+float getEstimatedActualPosition(int axis);
+uint32_t getTotalTravelDistance(void);
+void getEstimatedPositionAndVelocity(navPositionAndVelocity_t * pos);
+
+
+int getWaypointCount(void);
+
+# 436 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 436 "./src/main/navigation/navigation.h"
+    isWaypointListValid(void);
+void getWaypoint(uint8_t wpNumber, navWaypoint_t * wpData);
+void setWaypoint(uint8_t wpNumber, const navWaypoint_t * wpData);
+void resetWaypointList(void);
+
+# 440 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 440 "./src/main/navigation/navigation.h"
+    loadNonVolatileWaypointList(void);
+
+# 441 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 441 "./src/main/navigation/navigation.h"
+    saveNonVolatileWaypointList(void);
+
+float getFinalRTHAltitude(void);
+int16_t fixedWingPitchToThrottleCorrection(int16_t pitch);
+
+
+typedef enum {
+    GEO_ALT_ABSOLUTE,
+    GEO_ALT_RELATIVE
+} geoAltitudeConversionMode_e;
+
+typedef enum {
+    GEO_ORIGIN_SET,
+    GEO_ORIGIN_RESET_ALTITUDE
+} geoOriginResetMode_e;
+
+
+
+
+
+void geoSetOrigin(gpsOrigin_t *origin, const gpsLocation_t *llh, geoOriginResetMode_e resetMode);
+
+
+
+
+
+
+
+# 468 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 468 "./src/main/navigation/navigation.h"
+    geoConvertGeodeticToLocal(fpVector3_t *pos, const gpsOrigin_t *origin, const gpsLocation_t *llh, geoAltitudeConversionMode_e altConv);
+
+
+
+# 471 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 471 "./src/main/navigation/navigation.h"
+    geoConvertGeodeticToLocalOrigin(fpVector3_t * pos, const gpsLocation_t *llh, geoAltitudeConversionMode_e altConv);
+
+
+
+
+# 475 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 475 "./src/main/navigation/navigation.h"
+    geoConvertLocalToGeodetic(gpsLocation_t *llh, const gpsOrigin_t *origin, const fpVector3_t *pos);
+float geoCalculateMagDeclination(const gpsLocation_t * llh);
+
+
+
+# 479 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 479 "./src/main/navigation/navigation.h"
+    navCalculatePathToDestination(navDestinationPath_t *result, const fpVector3_t * destinationPos);
+
+
+void activateForcedRTH(void);
+void abortForcedRTH(void);
+rthState_e getStateOfForcedRTH(void);
+
+
+
+# 487 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 487 "./src/main/navigation/navigation.h"
+    navigationIsControllingThrottle(void);
+
+# 488 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 488 "./src/main/navigation/navigation.h"
+    isFixedWingAutoThrottleManuallyIncreased(void);
+
+# 489 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 489 "./src/main/navigation/navigation.h"
+    navigationIsFlyingAutonomousMode(void);
+
+# 490 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 490 "./src/main/navigation/navigation.h"
+    navigationIsExecutingAnEmergencyLanding(void);
+
+
+
+
+# 494 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 494 "./src/main/navigation/navigation.h"
+    navigationRTHAllowsLanding(void);
+
+
+# 496 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 496 "./src/main/navigation/navigation.h"
+    isNavLaunchEnabled(void);
+
+# 497 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 497 "./src/main/navigation/navigation.h"
+    isFixedWingLaunchDetected(void);
+
+# 498 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 498 "./src/main/navigation/navigation.h"
+    isFixedWingLaunchFinishedOrAborted(void);
+
+float calculateAverageSpeed(void);
+
+const navigationPIDControllers_t* getNavigationPIDControllers(void);
+
+int32_t navigationGetHeadingError(void);
+int32_t getCruiseHeadingAdjustment(void);
+
+# 506 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 506 "./src/main/navigation/navigation.h"
+    isAdjustingPosition(void);
+
+# 507 "./src/main/navigation/navigation.h" 3 4
+_Bool 
+# 507 "./src/main/navigation/navigation.h"
+    isAdjustingHeading(void);
+
+
+
+
+
+int32_t navigationGetHomeHeading(void);
+
+
+extern navSystemStatus_t NAV_Status;
+
+extern int16_t navCurrentState;
+extern int16_t navActualVelocity[3];
+extern int16_t navDesiredVelocity[3];
+extern int32_t navTargetPosition[3];
+extern int32_t navLatestActualPosition[3];
+extern int16_t navActualSurface;
+extern uint16_t navFlags;
+extern uint16_t navEPH;
+extern uint16_t navEPV;
+extern int16_t navAccNEU[3];
+# 29 "./obj/main/SITL/settings_generated.c" 2
+
+# 1 "./src/main/telemetry/telemetry.h" 1
+# 25 "./src/main/telemetry/telemetry.h"
+       
+# 34 "./src/main/telemetry/telemetry.h"
+typedef enum {
+    FRSKY_FORMAT_DMS = 0,
+    FRSKY_FORMAT_NMEA
+} frskyGpsCoordFormat_e;
+
+typedef enum {
+    FRSKY_UNIT_METRICS = 0,
+    FRSKY_UNIT_IMPERIALS
+} frskyUnit_e;
+
+typedef enum {
+    LTM_RATE_NORMAL,
+    LTM_RATE_MEDIUM,
+    LTM_RATE_SLOW
+} ltmUpdateRate_e;
+
+typedef enum {
+    SMARTPORT_FUEL_UNIT_PERCENT,
+    SMARTPORT_FUEL_UNIT_MAH,
+    SMARTPORT_FUEL_UNIT_MWH
+} smartportFuelUnit_e;
+
+typedef struct telemetryConfig_s {
+    float gpsNoFixLatitude;
+    float gpsNoFixLongitude;
+    uint8_t telemetry_switch;
+    uint8_t telemetry_inverted;
+    frskyGpsCoordFormat_e frsky_coordinate_format;
+    frskyUnit_e frsky_unit;
+    uint8_t frsky_vfas_precision;
+    uint8_t frsky_pitch_roll;
+    uint8_t report_cell_voltage;
+    uint8_t hottAlarmSoundInterval;
+    uint8_t halfDuplex;
+    smartportFuelUnit_e smartportFuelUnit;
+    uint8_t ibusTelemetryType;
+    uint8_t ltmUpdateRate;
+    uint16_t simTransmitInterval;
+    uint8_t simTransmitFlags[4];
+    uint16_t accEventThresholdHigh;
+    uint16_t accEventThresholdLow;
+    uint16_t accEventThresholdNegX;
+    int16_t simLowAltitude;
+    uint8_t simGroundStationNumber[16];
+    uint8_t simPin[8];
+    struct {
+        uint8_t extended_status_rate;
+        uint8_t rc_channels_rate;
+        uint8_t position_rate;
+        uint8_t extra1_rate;
+        uint8_t extra2_rate;
+    } mavlink;
+} telemetryConfig_t;
+
+extern telemetryConfig_t telemetryConfig_System; extern telemetryConfig_t telemetryConfig_Copy; static inline const telemetryConfig_t* telemetryConfig(void) { return &telemetryConfig_System; } static inline telemetryConfig_t* telemetryConfigMutable(void) { return &telemetryConfig_System; } struct _dummy;
+
+#define TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)
+extern serialPort_t *telemetrySharedPort;
+
+void telemetryInit(void);
+
+# 94 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 94 "./src/main/telemetry/telemetry.h"
+    telemetryCheckRxPortShared(const serialPortConfig_t *portConfig);
+
+void telemetryCheckState(void);
+void telemetryProcess(timeUs_t currentTimeUs);
+
+
+# 99 "./src/main/telemetry/telemetry.h" 3 4
+_Bool 
+# 99 "./src/main/telemetry/telemetry.h"
+    telemetryDetermineEnabledState(portSharing_e portSharing);
+# 31 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/telemetry/frsky_d.h" 1
+# 18 "./src/main/telemetry/frsky_d.h"
+       
+
+typedef enum {
+    FRSKY_VFAS_PRECISION_LOW = 0,
+    FRSKY_VFAS_PRECISION_HIGH
+} frskyVFasPrecision_e;
+
+void handleFrSkyTelemetry(void);
+void checkFrSkyTelemetryState(void);
+
+void initFrSkyTelemetry(void);
+void configureFrSkyTelemetryPort(void);
+void freeFrSkyTelemetryPort(void);
+# 32 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/telemetry/sim.h" 1
+# 18 "./src/main/telemetry/sim.h"
+       
+
+#define SIM_MIN_TRANSMIT_INTERVAL 10
+#define SIM_DEFAULT_TRANSMIT_INTERVAL 60
+#define SIM_N_TX_FLAGS 5
+#define SIM_DEFAULT_TX_FLAGS "f"
+#define SIM_PIN "0000"
+
+
+void handleSimTelemetry(void);
+void initSimTelemetry(void);
+void checkSimTelemetryState(void);
+# 33 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/fc/config.h" 1
+# 18 "./src/main/fc/config.h"
+       
+
+
+
+
+
+# 1 "./src/main/drivers/adc.h" 1
+# 18 "./src/main/drivers/adc.h"
+       
+
+
+
+typedef enum {
+    ADC_BATTERY = 0,
+    ADC_RSSI = 1,
+    ADC_CURRENT = 2,
+    ADC_AIRSPEED = 3,
+    ADC_FUNCTION_COUNT
+} adcFunction_e;
+
+typedef enum {
+    ADC_CHN_NONE = 0,
+    ADC_CHN_1 = 1,
+    ADC_CHN_2,
+    ADC_CHN_3,
+    ADC_CHN_4,
+    ADC_CHN_MAX = ADC_CHN_4,
+    ADC_CHN_COUNT
+} adcChannel_e;
+
+typedef struct drv_adc_config_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} drv_adc_config_t;
+
+void adcInit(drv_adc_config_t *init);
+uint16_t adcGetChannel(uint8_t channel);
+
+# 46 "./src/main/drivers/adc.h" 3 4
+_Bool 
+# 46 "./src/main/drivers/adc.h"
+    adcIsFunctionAssigned(uint8_t function);
+int adcGetFunctionChannelAllocation(uint8_t function);
+
+
+
+#define ADC_AVERAGE_N_SAMPLES 20
+# 25 "./src/main/fc/config.h" 2
+# 1 "./src/main/drivers/rx_pwm.h" 1
+# 18 "./src/main/drivers/rx_pwm.h"
+       
+
+#define PPM_RCVR_TIMEOUT 0
+
+struct timerHardware_s;
+
+# 23 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 23 "./src/main/drivers/rx_pwm.h"
+    ppmInConfig(const struct timerHardware_s *timerHardwarePtr);
+
+void pwmInConfig(const struct timerHardware_s *timerHardwarePtr, uint8_t channel);
+uint16_t pwmRead(uint8_t channel);
+uint16_t ppmRead(uint8_t channel);
+
+
+# 29 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 29 "./src/main/drivers/rx_pwm.h"
+    isPPMDataBeingReceived(void);
+void resetPPMDataReceivedState(void);
+
+
+# 32 "./src/main/drivers/rx_pwm.h" 3 4
+_Bool 
+# 32 "./src/main/drivers/rx_pwm.h"
+    isPWMDataBeingReceived(void);
+# 26 "./src/main/fc/config.h" 2
+# 1 "./src/main/fc/stats.h" 1
+
+       
+
+
+typedef struct statsConfig_s {
+    uint32_t stats_total_time;
+    uint32_t stats_total_dist;
+
+
+
+    uint8_t stats_enabled;
+} statsConfig_t;
+
+uint32_t getFlyingEnergy(void);
+void statsOnArm(void);
+void statsOnDisarm(void);
+# 27 "./src/main/fc/config.h" 2
+
+#define MAX_PROFILE_COUNT 3
+#define ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500
+#define MAX_NAME_LENGTH 16
+
+typedef enum {
+    ASYNC_MODE_NONE,
+    ASYNC_MODE_GYRO,
+    ASYNC_MODE_ALL
+} asyncMode_e;
+
+typedef enum {
+    FEATURE_THR_VBAT_COMP = 1 << 0,
+    FEATURE_VBAT = 1 << 1,
+    FEATURE_TX_PROF_SEL = 1 << 2,
+    FEATURE_BAT_PROFILE_AUTOSWITCH = 1 << 3,
+    FEATURE_MOTOR_STOP = 1 << 4,
+    FEATURE_UNUSED_1 = 1 << 5,
+    FEATURE_SOFTSERIAL = 1 << 6,
+    FEATURE_GPS = 1 << 7,
+    FEATURE_UNUSED_3 = 1 << 8,
+    FEATURE_UNUSED_4 = 1 << 9,
+    FEATURE_TELEMETRY = 1 << 10,
+    FEATURE_CURRENT_METER = 1 << 11,
+    FEATURE_REVERSIBLE_MOTORS = 1 << 12,
+    FEATURE_UNUSED_5 = 1 << 13,
+    FEATURE_UNUSED_6 = 1 << 14,
+    FEATURE_RSSI_ADC = 1 << 15,
+    FEATURE_LED_STRIP = 1 << 16,
+    FEATURE_DASHBOARD = 1 << 17,
+    FEATURE_UNUSED_7 = 1 << 18,
+    FEATURE_BLACKBOX = 1 << 19,
+    FEATURE_UNUSED_10 = 1 << 20,
+    FEATURE_TRANSPONDER = 1 << 21,
+    FEATURE_AIRMODE = 1 << 22,
+    FEATURE_SUPEREXPO_RATES = 1 << 23,
+    FEATURE_VTX = 1 << 24,
+    FEATURE_UNUSED_8 = 1 << 25,
+    FEATURE_UNUSED_9 = 1 << 26,
+    FEATURE_UNUSED_11 = 1 << 27,
+    FEATURE_PWM_OUTPUT_ENABLE = 1 << 28,
+    FEATURE_OSD = 1 << 29,
+    FEATURE_FW_LAUNCH = 1 << 30,
+} features_e;
+
+typedef struct systemConfig_s {
+    uint8_t current_profile_index;
+    uint8_t current_battery_profile_index;
+    uint8_t debug_mode;
+    uint8_t i2c_speed;
+    uint8_t cpuUnderclock;
+    uint8_t throttle_tilt_compensation_strength;
+    char name[16 + 1];
+} systemConfig_t;
+
+extern systemConfig_t systemConfig_System; extern systemConfig_t systemConfig_Copy; static inline const systemConfig_t* systemConfig(void) { return &systemConfig_System; } static inline systemConfig_t* systemConfigMutable(void) { return &systemConfig_System; } struct _dummy;
+
+typedef struct beeperConfig_s {
+    uint32_t beeper_off_flags;
+    uint32_t preferred_beeper_off_flags;
+} beeperConfig_t;
+
+extern beeperConfig_t beeperConfig_System; extern beeperConfig_t beeperConfig_Copy; static inline const beeperConfig_t* beeperConfig(void) { return &beeperConfig_System; } static inline beeperConfig_t* beeperConfigMutable(void) { return &beeperConfig_System; } struct _dummy;
+
+typedef struct adcChannelConfig_s {
+    uint8_t adcFunctionChannel[ADC_FUNCTION_COUNT];
+} adcChannelConfig_t;
+
+extern adcChannelConfig_t adcChannelConfig_System; extern adcChannelConfig_t adcChannelConfig_Copy; static inline const adcChannelConfig_t* adcChannelConfig(void) { return &adcChannelConfig_System; } static inline adcChannelConfig_t* adcChannelConfigMutable(void) { return &adcChannelConfig_System; } struct _dummy;
+
+
+
+extern statsConfig_t statsConfig_System; extern statsConfig_t statsConfig_Copy; static inline const statsConfig_t* statsConfig(void) { return &statsConfig_System; } static inline statsConfig_t* statsConfigMutable(void) { return &statsConfig_System; } struct _dummy;
+
+
+void beeperOffSet(uint32_t mask);
+void beeperOffSetAll(uint8_t beeperCount);
+void beeperOffClear(uint32_t mask);
+void beeperOffClearAll(void);
+uint32_t getBeeperOffMask(void);
+void setBeeperOffMask(uint32_t mask);
+uint32_t getPreferredBeeperOffMask(void);
+void setPreferredBeeperOffMask(uint32_t mask);
+
+void copyCurrentProfileToProfileSlot(uint8_t profileSlotIndex);
+
+void initEEPROM(void);
+void resetEEPROM(void);
+void readEEPROM(void);
+void writeEEPROM(void);
+void ensureEEPROMContainsValidData(void);
+
+void saveConfigAndNotify(void);
+void validateAndFixConfig(void);
+void validateAndFixTargetConfig(void);
+
+uint8_t getConfigProfile(void);
+
+# 124 "./src/main/fc/config.h" 3 4
+_Bool 
+# 124 "./src/main/fc/config.h"
+    setConfigProfile(uint8_t profileIndex);
+void setConfigProfileAndWriteEEPROM(uint8_t profileIndex);
+
+uint8_t getConfigBatteryProfile(void);
+
+# 128 "./src/main/fc/config.h" 3 4
+_Bool 
+# 128 "./src/main/fc/config.h"
+    setConfigBatteryProfile(uint8_t profileIndex);
+void setConfigBatteryProfileAndWriteEEPROM(uint8_t profileIndex);
+
+
+# 131 "./src/main/fc/config.h" 3 4
+_Bool 
+# 131 "./src/main/fc/config.h"
+    canSoftwareSerialBeUsed(void);
+void applyAndSaveBoardAlignmentDelta(int16_t roll, int16_t pitch);
+
+void createDefaultConfig(void);
+void resetConfigs(void);
+void targetConfiguration(void);
+
+uint32_t getLooptime(void);
+uint32_t getGyroLooptime(void);
+# 34 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/fc/rc_modes.h" 1
+# 18 "./src/main/fc/rc_modes.h"
+       
+
+
+
+# 1 "./src/main/common/bitarray.h" 1
+# 18 "./src/main/common/bitarray.h"
+       
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 22 "./src/main/common/bitarray.h" 2
+
+
+
+
+
+
+
+typedef uint32_t bitarrayElement_t;
+
+#define BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]
+
+
+# 33 "./src/main/common/bitarray.h" 3 4
+_Bool 
+# 33 "./src/main/common/bitarray.h"
+    bitArrayGet(const bitarrayElement_t *array, unsigned bit);
+void bitArraySet(bitarrayElement_t *array, unsigned bit);
+void bitArrayClr(bitarrayElement_t *array, unsigned bit);
+
+void bitArraySetAll(bitarrayElement_t *array, size_t size);
+void bitArrayClrAll(bitarrayElement_t *array, size_t size);
+
+#define BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))
+#define BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))
+
+
+
+
+
+int bitArrayFindFirstSet(const bitarrayElement_t *array, unsigned start_bit, size_t size);
+
+#define BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))
+# 23 "./src/main/fc/rc_modes.h" 2
+
+
+
+#define BOXID_NONE 255
+
+typedef enum {
+    BOXARM = 0,
+    BOXANGLE = 1,
+    BOXHORIZON = 2,
+    BOXNAVALTHOLD = 3,
+    BOXHEADINGHOLD = 4,
+    BOXHEADFREE = 5,
+    BOXHEADADJ = 6,
+    BOXCAMSTAB = 7,
+    BOXNAVRTH = 8,
+    BOXNAVPOSHOLD = 9,
+    BOXMANUAL = 10,
+    BOXBEEPERON = 11,
+    BOXLEDLOW = 12,
+    BOXLIGHTS = 13,
+    BOXNAVLAUNCH = 14,
+    BOXOSD = 15,
+    BOXTELEMETRY = 16,
+    BOXBLACKBOX = 17,
+    BOXFAILSAFE = 18,
+    BOXNAVWP = 19,
+    BOXAIRMODE = 20,
+    BOXHOMERESET = 21,
+    BOXGCSNAV = 22,
+    BOXKILLSWITCH = 23,
+    BOXSURFACE = 24,
+    BOXFLAPERON = 25,
+    BOXTURNASSIST = 26,
+    BOXAUTOTRIM = 27,
+    BOXAUTOTUNE = 28,
+    BOXCAMERA1 = 29,
+    BOXCAMERA2 = 30,
+    BOXCAMERA3 = 31,
+    BOXOSDALT1 = 32,
+    BOXOSDALT2 = 33,
+    BOXOSDALT3 = 34,
+    BOXNAVCRUISE = 35,
+    BOXBRAKING = 36,
+    BOXUSER1 = 37,
+    BOXUSER2 = 38,
+    BOXFPVANGLEMIX = 39,
+    BOXLOITERDIRCHN = 40,
+    BOXMSPRCOVERRIDE = 41,
+    CHECKBOX_ITEM_COUNT
+} boxId_e;
+
+
+typedef struct boxBitmask_s { bitarrayElement_t bits[(CHECKBOX_ITEM_COUNT + 31) / 32]; } boxBitmask_t;
+
+#define MAX_MODE_ACTIVATION_CONDITION_COUNT 20
+
+#define CHANNEL_RANGE_MIN 900
+#define CHANNEL_RANGE_MAX 2100
+
+#define CHANNEL_RANGE_STEP_WIDTH 25
+
+#define MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)
+#define CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define MIN_MODE_RANGE_STEP 0
+#define MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)
+
+#define IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)
+
+
+
+
+
+typedef struct channelRange_s {
+    uint8_t startStep;
+    uint8_t endStep;
+} channelRange_t;
+
+typedef struct modeActivationCondition_s {
+    boxId_e modeId;
+    uint8_t auxChannelIndex;
+    channelRange_t range;
+} modeActivationCondition_t;
+
+typedef enum {
+    MODE_OPERATOR_OR,
+    MODE_OPERATOR_AND
+} modeActivationOperator_e;
+
+typedef struct modeActivationOperatorConfig_s {
+    modeActivationOperator_e modeActivationOperator;
+} modeActivationOperatorConfig_t;
+
+extern modeActivationCondition_t modeActivationConditions_SystemArray[20]; extern modeActivationCondition_t modeActivationConditions_CopyArray[20]; static inline const modeActivationCondition_t* modeActivationConditions(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t* modeActivationConditionsMutable(int _index) { return &modeActivationConditions_SystemArray[_index]; } static inline modeActivationCondition_t (* modeActivationConditions_array(void))[20] { return &modeActivationConditions_SystemArray; } struct _dummy;
+extern modeActivationOperatorConfig_t modeActivationOperatorConfig_System; extern modeActivationOperatorConfig_t modeActivationOperatorConfig_Copy; static inline const modeActivationOperatorConfig_t* modeActivationOperatorConfig(void) { return &modeActivationOperatorConfig_System; } static inline modeActivationOperatorConfig_t* modeActivationOperatorConfigMutable(void) { return &modeActivationOperatorConfig_System; } struct _dummy;
+
+
+# 119 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 119 "./src/main/fc/rc_modes.h"
+    IS_RC_MODE_ACTIVE(boxId_e boxId);
+void rcModeUpdate(boxBitmask_t *newState);
+
+
+# 122 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 122 "./src/main/fc/rc_modes.h"
+    isModeActivationConditionPresent(boxId_e modeId);
+
+void processAirmode(void);
+
+# 125 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 125 "./src/main/fc/rc_modes.h"
+    isUsingNavigationModes(void);
+
+# 126 "./src/main/fc/rc_modes.h" 3 4
+_Bool 
+# 126 "./src/main/fc/rc_modes.h"
+    isRangeActive(uint8_t auxChannelIndex, const channelRange_t *range);
+
+void updateActivatedModes(void);
+void updateUsedModeActivationConditionFlags(void);
+void configureModeActivationCondition(int macIndex, boxId_e modeId, uint8_t auxChannelIndex, uint16_t startPwm, uint16_t endPwm);
+# 35 "./obj/main/SITL/settings_generated.c" 2
+
+
+# 1 "./src/main/drivers/display.h" 1
+# 18 "./src/main/drivers/display.h"
+       
+
+
+
+
+
+
+typedef struct osdCharacter_s osdCharacter_t;
+
+typedef struct displayConfig_s {
+    
+# 28 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 28 "./src/main/drivers/display.h"
+        force_sw_blink;
+} displayConfig_t;
+
+extern displayConfig_t displayConfig_System; extern displayConfig_t displayConfig_Copy; static inline const displayConfig_t* displayConfig(void) { return &displayConfig_System; } static inline displayConfig_t* displayConfigMutable(void) { return &displayConfig_System; } struct _dummy;
+
+typedef enum {
+    DISPLAY_TRANSACTION_OPT_NONE = 0,
+    DISPLAY_TRANSACTION_OPT_PROFILED = 1 << 0,
+    DISPLAY_TRANSACTION_OPT_RESET_DRAWING = 1 << 1,
+} displayTransactionOption_e;
+
+
+
+
+
+typedef uint8_t textAttributes_t;
+
+
+#define _TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)
+#define _TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)
+#define _TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)
+
+#define TEXT_ATTRIBUTES_NONE 0
+#define TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+#define TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+#define TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)
+#define TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)
+#define TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)
+
+static inline void TEXT_ATTRIBUTES_COPY(textAttributes_t *dst, textAttributes_t *src) { *dst = *src; }
+
+typedef struct displayCanvas_s displayCanvas_t;
+typedef struct displayFontMetadata_s displayFontMetadata_t;
+typedef struct displayPortVTable_s displayPortVTable_t;
+
+typedef struct displayPort_s {
+    const displayPortVTable_t *vTable;
+    void *device;
+    uint8_t rows;
+    uint8_t cols;
+    uint8_t posX;
+    uint8_t posY;
+
+
+    
+# 78 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 78 "./src/main/drivers/display.h"
+        useFullscreen;
+    
+# 79 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 79 "./src/main/drivers/display.h"
+        cleared;
+    int8_t cursorRow;
+    int8_t grabCount;
+    textAttributes_t cachedSupportedTextAttributes;
+    uint16_t maxChar;
+} displayPort_t;
+
+typedef struct displayPortVTable_s {
+    int (*grab)(displayPort_t *displayPort);
+    int (*release)(displayPort_t *displayPort);
+    int (*clearScreen)(displayPort_t *displayPort);
+    int (*drawScreen)(displayPort_t *displayPort);
+    int (*screenSize)(const displayPort_t *displayPort);
+    int (*writeString)(displayPort_t *displayPort, uint8_t x, uint8_t y, const char *text, textAttributes_t attr);
+    int (*writeChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint16_t c, textAttributes_t attr);
+    
+# 94 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 94 "./src/main/drivers/display.h"
+        (*readChar)(displayPort_t *displayPort, uint8_t x, uint8_t y, uint16_t *c, textAttributes_t *attr);
+    
+# 95 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 95 "./src/main/drivers/display.h"
+        (*isTransferInProgress)(const displayPort_t *displayPort);
+    int (*heartbeat)(displayPort_t *displayPort);
+    void (*resync)(displayPort_t *displayPort);
+    uint32_t (*txBytesFree)(const displayPort_t *displayPort);
+    textAttributes_t (*supportedTextAttributes)(const displayPort_t *displayPort);
+    
+# 100 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 100 "./src/main/drivers/display.h"
+        (*getFontMetadata)(displayFontMetadata_t *metadata, const displayPort_t *displayPort);
+    int (*writeFontCharacter)(displayPort_t *instance, uint16_t addr, const osdCharacter_t *chr);
+    
+# 102 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 102 "./src/main/drivers/display.h"
+        (*isReady)(displayPort_t *displayPort);
+    void (*beginTransaction)(displayPort_t *displayPort, displayTransactionOption_e opts);
+    void (*commitTransaction)(displayPort_t *displayPort);
+    
+# 105 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 105 "./src/main/drivers/display.h"
+        (*getCanvas)(displayCanvas_t *canvas, const displayPort_t *displayPort);
+} displayPortVTable_t;
+
+typedef struct displayPortProfile_s {
+    int8_t colAdjust;
+    int8_t rowAdjust;
+    
+# 111 "./src/main/drivers/display.h" 3 4
+   _Bool 
+# 111 "./src/main/drivers/display.h"
+        invert;
+    uint8_t blackBrightness;
+    uint8_t whiteBrightness;
+} displayPortProfile_t;
+
+void displayGrab(displayPort_t *instance);
+void displayRelease(displayPort_t *instance);
+void displayReleaseAll(displayPort_t *instance);
+
+# 119 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 119 "./src/main/drivers/display.h"
+    displayIsGrabbed(const displayPort_t *instance);
+void displayClearScreen(displayPort_t *instance);
+void displayDrawScreen(displayPort_t *instance);
+int displayScreenSize(const displayPort_t *instance);
+void displaySetXY(displayPort_t *instance, uint8_t x, uint8_t y);
+int displayWrite(displayPort_t *instance, uint8_t x, uint8_t y, const char *s);
+int displayWriteWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, const char *s, textAttributes_t attr);
+int displayWriteChar(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t c);
+int displayWriteCharWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t c, textAttributes_t attr);
+
+# 128 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 128 "./src/main/drivers/display.h"
+    displayReadCharWithAttr(displayPort_t *instance, uint8_t x, uint8_t y, uint16_t *c, textAttributes_t *attr);
+
+# 129 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 129 "./src/main/drivers/display.h"
+    displayIsTransferInProgress(const displayPort_t *instance);
+void displayHeartbeat(displayPort_t *instance);
+void displayResync(displayPort_t *instance);
+uint16_t displayTxBytesFree(const displayPort_t *instance);
+
+# 133 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/display.h"
+    displayGetFontMetadata(displayFontMetadata_t *metadata, const displayPort_t *instance);
+int displayWriteFontCharacter(displayPort_t *instance, uint16_t addr, const osdCharacter_t *chr);
+
+# 135 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 135 "./src/main/drivers/display.h"
+    displayIsReady(displayPort_t *instance);
+void displayBeginTransaction(displayPort_t *instance, displayTransactionOption_e opts);
+void displayCommitTransaction(displayPort_t *instance);
+
+# 138 "./src/main/drivers/display.h" 3 4
+_Bool 
+# 138 "./src/main/drivers/display.h"
+    displayGetCanvas(displayCanvas_t *canvas, const displayPort_t *instance);
+void displayInit(displayPort_t *instance, const displayPortVTable_t *vTable);
+# 38 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/io/vtx_control.h" 1
+# 18 "./src/main/io/vtx_control.h"
+       
+
+
+
+#define MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10
+
+typedef struct vtxChannelActivationCondition_s {
+    uint8_t auxChannelIndex;
+    uint8_t band;
+    uint8_t channel;
+    channelRange_t range;
+} vtxChannelActivationCondition_t;
+
+typedef struct vtxConfig_s {
+    vtxChannelActivationCondition_t vtxChannelActivationConditions[10];
+    uint8_t halfDuplex;
+} vtxConfig_t;
+
+extern vtxConfig_t vtxConfig_System; extern vtxConfig_t vtxConfig_Copy; static inline const vtxConfig_t* vtxConfig(void) { return &vtxConfig_System; } static inline vtxConfig_t* vtxConfigMutable(void) { return &vtxConfig_System; } struct _dummy;
+
+void vtxControlInit(void);
+void vtxControlInputPoll(void);
+
+void vtxIncrementBand(void);
+void vtxDecrementBand(void);
+void vtxIncrementChannel(void);
+void vtxDecrementChannel(void);
+
+void vtxCyclePower(const uint8_t powerStep);
+void vtxCycleBandOrChannel(const uint8_t bandStep, const uint8_t channelStep);
+
+void vtxUpdateActivatedChannel(void);
+
+void handleVTXControlButton(void);
+# 39 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/drivers/vtx_common.h" 1
+# 22 "./src/main/drivers/vtx_common.h"
+#define VTX_SETTINGS_NO_BAND 0
+#define VTX_SETTINGS_MIN_BAND 1
+#define VTX_SETTINGS_MAX_BAND 5
+#define VTX_SETTINGS_MIN_CHANNEL 1
+#define VTX_SETTINGS_MAX_CHANNEL 8
+
+#define VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)
+#define VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)
+
+#define VTX_SETTINGS_DEFAULT_BAND 4
+#define VTX_SETTINGS_DEFAULT_CHANNEL 1
+#define VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1
+#define VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0
+
+#define VTX_SETTINGS_MIN_FREQUENCY_MHZ 0
+#define VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999
+
+
+
+#define VTX_SETTINGS_POWER_COUNT 5
+#define VTX_SETTINGS_DEFAULT_POWER 1
+#define VTX_SETTINGS_MIN_POWER 1
+#define VTX_SETTINGS_MIN_USER_FREQ 5000
+#define VTX_SETTINGS_MAX_USER_FREQ 5999
+#define VTX_SETTINGS_FREQCMD 
+#define VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)
+
+
+
+
+
+#define VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))
+
+typedef enum {
+    VTXDEV_UNSUPPORTED = 0,
+    VTXDEV_RTC6705 = 1,
+
+    VTXDEV_SMARTAUDIO = 3,
+    VTXDEV_TRAMP = 4,
+    VTXDEV_FFPV = 5,
+    VTXDEV_UNKNOWN = 0xFF,
+} vtxDevType_e;
+
+struct vtxVTable_s;
+
+typedef struct vtxDeviceCapability_s {
+    uint8_t bandCount;
+    uint8_t channelCount;
+    uint8_t powerCount;
+    char **bandNames;
+    char **channelNames;
+    char **powerNames;
+} vtxDeviceCapability_t;
+
+typedef struct vtxDeviceOsdInfo_s {
+    int band;
+    int channel;
+    int frequency;
+    int powerIndex;
+    int powerMilliwatt;
+    char bandLetter;
+    const char * bandName;
+    const char * channelName;
+    char powerIndexLetter;
+} vtxDeviceOsdInfo_t;
+
+typedef struct vtxDevice_s {
+    const struct vtxVTable_s * const vTable;
+
+    vtxDeviceCapability_t capability;
+
+    uint8_t band;
+    uint8_t channel;
+    uint8_t powerIndex;
+    uint8_t pitMode;
+} vtxDevice_t;
+
+
+
+
+
+typedef struct vtxVTable_s {
+    void (*process)(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+    vtxDevType_e (*getDeviceType)(const vtxDevice_t *vtxDevice);
+    
+# 106 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 106 "./src/main/drivers/vtx_common.h"
+        (*isReady)(const vtxDevice_t *vtxDevice);
+
+    void (*setBandAndChannel)(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+    void (*setPowerByIndex)(vtxDevice_t *vtxDevice, uint8_t level);
+    void (*setPitMode)(vtxDevice_t *vtxDevice, uint8_t onoff);
+
+    
+# 112 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 112 "./src/main/drivers/vtx_common.h"
+        (*getBandAndChannel)(const vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+    
+# 113 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 113 "./src/main/drivers/vtx_common.h"
+        (*getPowerIndex)(const vtxDevice_t *vtxDevice, uint8_t *pIndex);
+    
+# 114 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 114 "./src/main/drivers/vtx_common.h"
+        (*getPitMode)(const vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+    
+# 115 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 115 "./src/main/drivers/vtx_common.h"
+        (*getFrequency)(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+
+    
+# 117 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 117 "./src/main/drivers/vtx_common.h"
+        (*getPower)(const vtxDevice_t *vtxDevice, uint8_t *pIndex, uint16_t *pPowerMw);
+    
+# 118 "./src/main/drivers/vtx_common.h" 3 4
+   _Bool 
+# 118 "./src/main/drivers/vtx_common.h"
+        (*getOsdInfo)(const vtxDevice_t *vtxDevice, vtxDeviceOsdInfo_t * pOsdInfo);
+} vtxVTable_t;
+
+
+
+
+
+
+void vtxCommonInit(void);
+void vtxCommonSetDevice(vtxDevice_t *vtxDevice);
+vtxDevice_t *vtxCommonDevice(void);
+
+
+void vtxCommonProcess(vtxDevice_t *vtxDevice, timeUs_t currentTimeUs);
+vtxDevType_e vtxCommonGetDeviceType(vtxDevice_t *vtxDevice);
+
+# 133 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 133 "./src/main/drivers/vtx_common.h"
+    vtxCommonDeviceIsReady(vtxDevice_t *vtxDevice);
+void vtxCommonSetBandAndChannel(vtxDevice_t *vtxDevice, uint8_t band, uint8_t channel);
+void vtxCommonSetPowerByIndex(vtxDevice_t *vtxDevice, uint8_t index);
+void vtxCommonSetPitMode(vtxDevice_t *vtxDevice, uint8_t onoff);
+
+# 137 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 137 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetBandAndChannel(vtxDevice_t *vtxDevice, uint8_t *pBand, uint8_t *pChannel);
+
+# 138 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 138 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPowerIndex(vtxDevice_t *vtxDevice, uint8_t *pIndex);
+
+# 139 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 139 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPitMode(vtxDevice_t *vtxDevice, uint8_t *pOnOff);
+
+# 140 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 140 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetFrequency(const vtxDevice_t *vtxDevice, uint16_t *pFreq);
+
+# 141 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 141 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetDeviceCapability(vtxDevice_t *vtxDevice, vtxDeviceCapability_t *pDeviceCapability);
+
+# 142 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 142 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetPower(const vtxDevice_t *vtxDevice, uint8_t *pIndex, uint16_t *pPowerMw);
+
+# 143 "./src/main/drivers/vtx_common.h" 3 4
+_Bool 
+# 143 "./src/main/drivers/vtx_common.h"
+    vtxCommonGetOsdInfo(vtxDevice_t *vtxDevice, vtxDeviceOsdInfo_t * pOsdInfo);
+# 40 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/io/vtx.h" 1
+# 21 "./src/main/io/vtx.h"
+       
+# 31 "./src/main/io/vtx.h"
+typedef enum {
+    VTX_LOW_POWER_DISARM_OFF = 0,
+    VTX_LOW_POWER_DISARM_ALWAYS = 1,
+    VTX_LOW_POWER_DISARM_UNTIL_FIRST_ARM = 2,
+} vtxLowerPowerDisarm_e;
+
+typedef struct vtxSettingsConfig_s {
+    uint8_t band;
+    uint8_t channel;
+    uint8_t power;
+    uint16_t pitModeChan;
+    uint8_t lowPowerDisarm;
+    uint16_t maxPowerOverride;
+} vtxSettingsConfig_t;
+
+extern vtxSettingsConfig_t vtxSettingsConfig_System; extern vtxSettingsConfig_t vtxSettingsConfig_Copy; static inline const vtxSettingsConfig_t* vtxSettingsConfig(void) { return &vtxSettingsConfig_System; } static inline vtxSettingsConfig_t* vtxSettingsConfigMutable(void) { return &vtxSettingsConfig_System; } struct _dummy;
+
+void vtxInit(void);
+void vtxUpdate(timeUs_t currentTimeUs);
+# 41 "./obj/main/SITL/settings_generated.c" 2
+# 1 "./src/main/common/log.h" 1
+       
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 4 "./src/main/common/log.h" 2
+# 15 "./src/main/common/log.h"
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARNING 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_VERBOSE 3
+#define LOG_LEVEL_DEBUG 4
+
+typedef enum {
+    LOG_TOPIC_SYSTEM,
+    LOG_TOPIC_GYRO,
+    LOG_TOPIC_BARO,
+    LOG_TOPIC_PITOT,
+    LOG_TOPIC_PWM,
+    LOG_TOPIC_TIMER,
+    LOG_TOPIC_IMU,
+    LOG_TOPIC_TEMPERATURE,
+    LOG_TOPIC_POS_ESTIMATOR,
+    LOG_TOPIC_VTX,
+    LOG_TOPIC_OSD,
+
+    LOG_TOPIC_COUNT,
+} logTopic_e;
+
+typedef char assert_failed_too_many_log_topics [(LOG_TOPIC_COUNT < 32) ? 1 : -1 ] __attribute__((unused));
+
+typedef struct logConfig_s {
+    uint8_t level;
+    uint32_t topics;
+} logConfig_t;
+
+extern logConfig_t logConfig_System; extern logConfig_t logConfig_Copy; static inline const logConfig_t* logConfig(void) { return &logConfig_System; } static inline logConfig_t* logConfigMutable(void) { return &logConfig_System; } struct _dummy;
+
+void logInit(void);
+void _logf(logTopic_e topic, unsigned level, const char *fmt, ...) __attribute__ ((format (printf, 3, 4)));
+void _logBufferHex(logTopic_e topic, unsigned level, const void *buffer, size_t size);
+
+
+
+
+#define LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG
+
+
+
+#define LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)
+
+
+
+
+
+
+#define LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
+#define LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)
+
+
+
+
+
+
+#define LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)
+
+
+
+
+
+
+#define LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)
+#define LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)
+
+
+
+
+
+
+#define LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#define LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)
+# 42 "./obj/main/SITL/settings_generated.c" 2
+const pgn_t settingsPgn[] = {
+ 10,
+ 35,
+ 1012,
+ 40,
+ 38,
+ 1000,
+ 24,
+ 5,
+ 6,
+ 1,
+ 2,
+ 45,
+ 11,
+ 20,
+ 26,
+ 52,
+ 12,
+ 13,
+ 22,
+ 16,
+ 1019,
+ 30,
+ 25,
+ 14,
+ 1008,
+ 1001,
+ 1002,
+ 31,
+ 18,
+ 1003,
+ 1009,
+ 1011,
+ 1013,
+ 54,
+ 259,
+ 1017,
+};
+const uint8_t settingsPgnCounts[] = {
+ 16,
+ 12,
+ 3,
+ 10,
+ 3,
+ 3,
+ 15,
+ 4,
+ 9,
+ 13,
+ 3,
+ 9,
+ 4,
+ 5,
+ 3,
+ 6,
+ 16,
+ 1,
+ 7,
+ 3,
+ 1,
+ 7,
+ 7,
+ 78,
+ 5,
+ 22,
+ 68,
+ 27,
+ 3,
+ 1,
+ 3,
+ 2,
+ 1,
+ 1,
+ 6,
+ 2,
+};
+static const uint8_t settingNamesWords[] = {
+ 0x70,0x6c,
+ 0x3,0x5c,
+ 0xd,0x18,
+ 0x24,0x1a,0x14,
+ 0x10,
+ 0x6,0x43,0x70,
+ 0x68,
+ 0x10,0x4d,0x6,0x80,
+ 0x41,0xf3,
+ 0x4,0x9e,0xc6,
+ 0x0,0xc1,0x4b,0x26,0x13,0x14,
+ 0x9,
+ 0x2,0x5c,0x1b,
+ 0x2,0x99,0x81,
+ 0x40,0xc8,0x18,
+ 0x1,0x18,
+ 0xc0,0x40,
+ 0x1f,0x32,0x78,
+ 0x11,0xa0,
+ 0x4a,0x88,
+ 0x0,0x58,0x93,0xb8,
+ 0x1,0x71,0xd8,0x50,
+ 0x1e,0x13,
+ 0x3,0x3,0x57,0xd,0x0,
+ 0x68,0x4e,
+ 0x6,0xa5,0xc0,
+ 0xc6,
+ 0x40,0xd0,0xe0,
+ 0x14,0x44,
+ 0x81,0x70,
+ 0x10,0xa1,0x20,0x82,0xe2,
+ 0x2,0x88,0x91,0x66,0x87,0xb0,0x80,
+ 0xa2,0x5a,0x50,
+ 0x10,0xac,0xe,
+ 0x40,0xc2,0xd8,0xac,
+ 0x3,0x42,0xea,0x85,0x80,
+ 0x6b,0xe8,0xf9,
+ 0x2,0xc5,0x60,
+ 0x2d,0x4c,
+ 0x0,0x2c,0xa2,0x69,0x52,0x14,
+ 0x1,0xad,0x1e,
+ 0x1,0xb1,0x2d,0x10,
+ 0xb,0x88,0x3c,
+ 0x6,0x94,0xd7,0x90,
+ 0x20,0x32,0x25,0xc3,0x22,
+ 0x81,0x2d,0xa8,
+ 0x18,0x96,0xa6,0x80,
+ 0x90,
+ 0xc1,0x38,0x14,0xa4,
+ 0x5,0x11,0x27,0xd2,0x8c,0x28,
+ 0x4,0x19,0x3c,
+ 0x2,0x90,0x56,0x97,0x1c,
+ 0x4,0x4c,0xc3,0x26,
+ 0x81,0x34,0x2c,0x9a,
+ 0x6,0x3e,0xe0,
+ 0x6b,0xc8,0x50,
+ 0x3c,0xc6,0x99,0x68,
+ 0x8,0x3e,0xe5,0x90,
+ 0x26,0x59,0x59,0xe0,
+ 0xd9,
+ 0x0,0x11,0x8c,0xac,
+ 0x0,0x83,0x4a,0x16,0x59,
+ 0x0,0x98,0x11,0xac,0x4f,0xc0,
+ 0x6,0x18,0x4,0x69,0xa6,
+ 0x40,0x32,
+ 0x0,0x72,0xaa,0x66,0x50,
+ 0xe,0xb4,0x79,0x8c,
+ 0x2,0xd,0xa0,
+ 0x22,0x67,0x40,0xb8,0x65,
+ 0x1,0x28,0x59,0x34,
+ 0x6,0x30,
+ 0x10,0xf6,0x94,
+ 0xb,0xb,0x1a,0x17,
+ 0x1,0x81,0x71,0x12,0xe3,
+ 0x81,0xa1,0xb3,0x12,0xe5,
+ 0x81,0xa5,0xa1,0x64,
+ 0x7,0x3e,0x83,0x40,
+ 0x25,0x39,0xa4,
+ 0x13,0x18,0x58,0x50,
+ 0x4d,0x2d,
+ 0x5,0xa,0xc2,0xb4,0xb4,0x96,
+ 0x41,0x44,0xb4,0xaf,0xad,
+ 0x0,0x11,0x8c,0xe1,0x4b,
+ 0x80,0x11,0x8f,0x45,0x93,
+ 0xc0,0x17,0x51,0x27,0x90,0x6c,0x9a,0x64,
+ 0x1,0xad,0x1f,0x4a,0xb8,0xa0,
+ 0x10,0x5c,0xb0,
+ 0x9,0xe1,0x91,
+ 0x0,0x27,0xbe,0x74,
+ 0x0,0xeb,0x29,0x15,0xd4,
+ 0x1,0x13,0x22,0x8e,0x89,0x7b,
+ 0x80,0x80,0xb0,0xc4,0xac,0x18,0x5c,
+ 0x1,0x4,0x38,
+ 0x10,0x50,0x91,0x2e,0x38,
+ 0x10,0xf6,0x10,
+ 0x9,0x23,0xa,
+ 0x4,0x9d,0xcf,0x91,
+ 0x40,0x97,0x58,0xb2,0xa1,0x48,
+ 0x6,0x84,0xfa,0x2c,0x9e,
+ 0x7,0xc0,0xcc,0x7d,
+ 0xc1,0x4,0xd1,0xf4,
+ 0x4,0x2e,0xd0,
+ 0x48,0xac,0xe,
+ 0x1,0x32,0xc9,0x21,0x64,0xb0,
+ 0x9,0xd0,0x34,0x98,
+ 0x27,0x59,0x18,0x23,0x28,
+ 0x27,0x74,0xd0,0x68,
+ 0x5,0x20,0x10,
+ 0x55,0xc9,0xa0,
+ 0x2c,
+ 0xc,
+ 0x3,0x20,
+ 0xa,0x64,0xd7,0x90,0xa0,
+ 0xb,0x28,
+ 0x1,0xa0,0x2e,
+ 0x0,0xd0,0x17,0x38,0xac,
+ 0x0,0xd0,0x51,0xac,
+ 0x3,0x7b,0xa9,0x27,0xb0,
+ 0x4,0x29,0x83,0x56,0x50,
+ 0x5,0x69,0x64,0x70,
+ 0x16,0xc5,0x75,
+ 0x0,0x60,0x8e,0x8f,0x90,
+ 0xc,0x96,0x50,0xb2,
+ 0x2,0x12,0x74,
+ 0x1,0x2e,0xa1,0x65,0x60,0xb0,
+ 0xb,0x48,
+ 0x17,0x0,
+ 0x31,0xe7,
+ 0x3,0x20,0x6e,
+ 0x1,0xaf,0x21,0x58,
+ 0x8,0x24,0x93,0xab,
+ 0x41,0x9,0x3c,0x65,0x25,0x64,0x50,
+ 0x42,0x4f,0xa3,0xc6,0xf6,
+ 0x2,0x12,0x7d,0x92,0x42,0xc8,
+ 0x12,0x2c,0xcb,0x40,
+ 0x4b,0x0,
+ 0x9e,0x5c,0x30,
+ 0x51,0x12,0x7d,
+ 0xc1,0x47,0xd0,0x2c,
+ 0x5,0x24,0x17,0x4d,0xa9,0xa0,
+ 0x2b,0x32,0x8c,
+ 0x1,0x13,0xe5,0x40,
+ 0x4,0x63,0xe9,0x6c,0x57,0x53,0xb4,0x44,0x8b,0x34,0x3d,0x84,0xeb,0x8a,0x7e,0xe0,
+ 0x1,0x18,0xca,0xc2,0xc8,0x34,0x7c,
+ 0x80,0x14,0xca,0x70,0x29,0x48,
+ 0x0,0xb1,0x8f,0xb8,
+ 0x3,0x8,0x31,0x25,0x20,
+ 0x4,0x17,0x10,
+ 0x2,0xd,0x3b,0x67,0xb2,0x81,0x39,0x7b,0x39,0xc,
+ 0x2,0xd,0x48,
+ 0x1,0x24,0x33,
+ 0x0,0xa4,0x50,0xae,0xf,0x4b,0xa8,
+ 0x1,0x85,0x80,
+ 0x18,0x58,0x91,0x48,0x34,0x4b,0xdc,
+ 0x1,0x95,0xd4,0x2c,
+ 0x80,0x34,0x6,0x41,0x1d,0xb,0x20,
+ 0xd,0xed,0x68,0x5c,0x40,
+ 0xd,0xed,0x80,
+ 0x6,0xf6,0xc2,0x45,0x9c,0xd2,0xf7,
+ 0x0,0x6f,0x71,0x92,0x70,
+ 0xd,0xee,0x9d,0x2,0xea,
+ 0x0,0x6f,0x7c,0x88,0x97,0x6,0x85,0x98,
+ 0x7,0x24,0xd1,0x23,0xb,
+ 0x0,0x4e,0x89,0xef,0x9d,0x3a,0x7c,0xc9,0xfd,0x21,0x59,0x40,0xf5,0x90,0x37,0x51,0xa0,
+ 0x13,0xa2,0x7b,0xe7,0x4e,0xb4,0x38,0xe8,0x69,0xd0,0x8c,0x65,0x61,0x64,0x1a,0x25,0xee,
+ 0x1,0xa,0x2a,0x9c,
+ 0x4,0x28,0xca,0xc0,
+ 0x10,0xa3,0x60,
+ 0x8,0x51,0xb1,0x2e,0xd,0x12,0xf7,
+ 0x0,0x85,0x30,0x6a,0xca,0x4c,
+ 0x4,0x2b,0x9e,0xd0,
+ 0x10,0xb6,0x48,0xca,
+ 0x2,0x26,0x70,0x60,0x73,0xd3,0x3e,0x43,0x2f,0x67,0x7e,0x89,0x89,0x72,
+ 0xc0,0x44,0xce,0x80,
+ 0x22,0x6c,0x50,
+ 0x13,0x2e,
+ 0x1,0x5c,0x11,0x30,0xa4,
+ 0x1,0x5c,0x59,0x1f,0x20,
+ 0x2c,0x2c,
+ 0x2,0xe2,0x92,0xf,
+ 0x80,0x5c,0x52,0x41,0xe0,
+ 0xc,0x99,0x4e,0x80,
+ 0x32,0x70,0x52,0x76,0xe9,0x71,0xfa,0x1a,0xd1,0xfd,0xc,0x9a,
+ 0x3,0x30,0x27,0x98,
+ 0xc,0xc0,0xc0,0xb2,0x7b,
+ 0x80,0x66,0x6,0x13,
+ 0x1,0x9f,0x26,0x86,0x80,
+ 0x34,0x2d,0xd6,0xa7,0x1d,0x21,0x4f,0x22,0x96,0x60,
+ 0x34,0x8b,0x1a,0x95,0xc3,0xc8,
+ 0xd,0x52,0xb0,
+ 0x6,0xbf,0x43,0x5a,0x3e,0x95,0x71,0x7a,0x63,0x76,0x8f,0xea,0x7b,0x41,
+ 0x80,0xd7,0xe8,0x6b,0x47,0xd2,0xae,0x2f,0x4c,0x6e,0xd1,0xfd,0x87,0x4e,0x14,0xb8,
+ 0x6,0xbf,0x53,0x42,0xc9,0xbd,0x62,0x5a,0x9a,0x76,0x74,0x48,0xd7,0xd8,0x3e,0x69,0xa2,0x5e,0xe0,
+ 0x1a,0xfd,0x6a,0x5d,0xda,0x22,0x4f,0xa5,0x18,0x5e,0x91,0xf7,0x77,0x60,0x9a,0xd,0x0,
+ 0x35,0xfb,0x4a,0xc9,0xdd,0xc,0xe6,0x99,0xd3,0xb9,0xd,0xfa,0x70,0xa5,0xc0,
+ 0x38,0x52,0xe0,
+ 0x1e,0x13,0xed,0x44,0xc7,0xe3,0xb5,0x99,0x7a,0x70,0xb1,0x2c,0x2b,
+ 0xc0,0x7c,0xc9,0xfd,0x9d,0x2,0x72,0xf3,0xac,0x7d,0xe0,0x19,0xcf,0xa8,0xd0,
+ 0xf,0x99,0x3f,0xb3,0xa0,0x4e,0x5e,0x75,0x8f,0xbc,0x3,0x39,0xf6,0x99,0x81,
+ 0x40,0x80,0xcc,
+ 0x8,0x7d,0x29,0xd0,0xb0,0x32,0x6f,0x66,0xfa,0xb8,0x9d,0x4b,0xa8,0x59,0x58,0x2c,
+ 0x2,0x1f,0x62,0xc8,
+ 0x9,0x15,0x66,
+ 0x4,0xb8,0x36,0xe8,0x58,0xc7,0xdf,0xa4,0x28,0x49,0xd9,0x14,0x6b,0x7b,0x92,0xe3,
+ 0x81,0x2e,0xd,0xba,0x79,0x6,0xc9,0xa6,0x7a,0x30,0xb3,0xb4,0x7b,0xb,0x20,0xb8,0x65,
+ 0x2,0x5c,0x1b,0x75,0xa1,0xc7,0x4b,0x4,0x74,0xb0,0xb0,
+ 0x12,0xe0,0xdb,0xb5,0x99,0x7a,0x78,0x4f,0xb6,0x2b,0x1c,0x52,
+ 0x1,0x2e,0xd,0xbb,0x7e,0xe3,0x3d,0x33,0x1f,0x7e,0xc0,
+ 0x9,0x70,0x6d,0xdb,0xf7,0x19,0xe9,0x98,0xfb,0xf6,0xc0,
+ 0x4b,0x83,0x6e,0xdf,0xb8,0xcf,0x64,0x59,0xf6,0xc0,
+ 0x4b,0x83,0x6e,0xdf,0xb8,0xce,0xba,0x11,0x8f,0xb0,
+ 0x2,0x5c,0x1b,0x76,0xfd,0xd7,0x64,0x59,0xf6,0xc0,
+ 0x5a,0x58,0xc0,
+ 0x30,0x34,0x4d,0x2a,0x42,
+ 0x81,0x8f,0x4d,0xb,0x20,
+ 0x31,0xee,0x3a,0x69,0x52,0x14,
+ 0xc,0x7b,0xe1,0x44,0xb4,0xa0,
+ 0x65,0x1a,
+ 0x6,0x86,0x47,0x4b,
+ 0x80,0xd0,0xd9,0x89,0x72,0xfa,0x5c,0x53,0xb3,0xa0,0x69,0x59,0xf6,0x41,0xa1,
+ 0x40,0xd0,0xe3,0xa1,0x71,0xd8,0x5e,0xa5,0xc3,0x62,0x5c,0x1a,0x25,0xee,0xec,0x13,0x40,
+ 0x34,0x38,0xe8,0x5c,0x76,0x17,0xa9,0x70,0xd8,0x97,0x6,0x89,0x7b,0xbb,0x26,0x30,
+ 0xd,0x29,0x12,0x17,
+ 0x1,0xa9,0x20,
+ 0x1a,0x96,0x31,0x20,
+ 0x6a,0x67,0x34,0xbd,0xc0,
+ 0x6b,0xc8,0x5e,0xc8,0x2e,0x39,0x7a,0xc7,0x9d,0x23,0xeb,0xe0,0x59,0x6,0x8f,0x90,
+ 0x1a,0xf9,0x3d,0xc0,
+ 0x70,0x5a,0x50,
+ 0x38,0x36,0xe9,0x71,0x49,0x7,0xa1,0x93,0x52,0xe3,0xf6,0x61,0x31,0x69,0x90,
+ 0x38,0x36,0xe9,0xaf,0xd0,0xb1,0x8f,0xbf,0x5a,0x17,0x54,0x2c,0xed,0x11,0x2e,0xa5,0xc3,0x91,0x43,0x32,
+ 0x81,0xc1,0xb7,0x4d,0x7e,0xb0,0x2e,0x27,0x48,0x9b,0x17,0xa1,0x71,0xd8,0x50,
+ 0x38,0x36,0xe9,0xaf,0xd6,0x6,0xae,0x1a,0x3a,0x42,0xd0,0xa3,0xa7,0x68,0x96,0x94,
+ 0xe,0xd,0xba,0x6b,0xf5,0x81,0xab,0x86,0x8e,0xce,0x9,0x75,0x61,0xda,0x25,0xa5,
+ 0x3,0x83,0x6e,0x9a,0xfd,0x63,0xd3,0x42,0xcb,0xb2,0x9,0x13,0x59,
+ 0x81,0xc1,0xb7,0x4d,0x7e,0xc1,0xf3,0xea,0x8,0x7e,0xc1,0x24,0x9d,0x5b,0xd6,0x25,0xa9,0xa0,
+ 0x1c,0x1b,0x75,0x81,0x71,0x3b,0x36,0x3e,0xe4,0x7d,0xdd,0xd6,0x87,0x1,0x65,
+ 0x0,0xe0,0xdb,0xac,0xb,0x89,0xd9,0xb1,0xf7,0x23,0xee,0xee,0xb5,0x2e,0xb,0x28,
+ 0x7,0x6,0xdd,0x68,0x71,0xda,0x16,0x52,0xa,0x5d,0xd3,0x3d,0x8c,0x7d,0xfa,0x16,0x50,
+ 0xe,0xd,0xba,0xd1,0xf4,0x52,0xa,0xd2,0xe3,0xf4,0x4f,0x7c,0xe9,0xd2,0x26,0x65,0x71,0xc2,0x72,0xf6,0x70,0x29,0x48,
+ 0x7,0x6,0xdd,0x68,0xfa,0x29,0x5,0x69,0x71,0xfa,0x27,0xbe,0x74,0xec,0xe0,0x52,0x93,0xb4,0x44,0x8b,0x34,0x3d,0x84,
+ 0x3,0x83,0x6e,0xb4,0x7d,0x14,0x82,0xb4,0xb8,0xfd,0x22,0x66,0x57,0x1c,0x27,0x2f,0x67,0x2,0x94,0x80,
+ 0x70,0x6d,0xd6,0x8f,0xb0,0x7c,0xfa,0x42,0x8c,0xac,0x2c,0x83,0x44,0xbd,0xdd,0xa2,0x5a,0x50,
+ 0x38,0x36,0xeb,0x47,0xdb,0x15,0x9d,0xc6,0x7a,0x4a,0x16,0x4d,0xeb,0x20,0x6e,0xa3,0x40,
+ 0x70,0x6d,0xd7,0xd8,0xb2,0x92,0x48,0x59,0xf5,0xaf,0xa3,0xe5,0xd9,0xd1,0xf0,
+ 0x3,0x83,0x6e,0xca,0x88,0xed,0x2,0x96,0x74,0xc9,0x94,0xe8,
+ 0x7,0x6,0xdd,0xac,0xcb,0xd3,0x5f,0xb9,0xd,0xfa,0x37,0xba,0x92,0x7b,
+ 0x0,0xe0,0xdb,0xb5,0x99,0x7a,0xd4,0x92,0x88,0x97,0x4c,0xf9,0x74,0x2c,0xa2,0x1e,0xc2,
+ 0x1,0xc1,0xb7,0x6f,0xe,0xcc,0x26,0x2f,0x48,0x99,0xd0,0x2e,0x19,
+ 0x40,0xe2,0xd6,0x92,0xb,
+ 0x0,0xea,0xb4,
+ 0xf,0x31,
+ 0x80,0xf7,
+ 0x1,0xf6,0x2c,0xa4,0x92,0x14,
+ 0xf,0xb1,0x65,0x34,0x3d,0xf4,
+ 0x4,0x12,0x40,
+ 0x41,0x24,0xec,0x24,0xf1,0x96,0x73,0xe9,0xa,0xe7,0xb4,
+ 0x10,0x4b,
+ 0x81,0x4,0xd0,
+ 0x10,0x4d,0x6,0x8e,0x51,0x12,
+ 0x4,0x18,0x1a,0x19,0xf2,0x68,
+ 0x20,0xf6,0x16,0x60,
+ 0x83,0xe6,0x9a,0x25,0xee,
+ 0x4,0x24,0x51,0xa6,0x69,0x7b,
+ 0x81,0x9,0x16,0xc9,0x2d,
+ 0xc1,0xa,0xb2,0x65,
+ 0x4,
+ 0x41,0x20,0x91,0x35,0x98,
+ 0x24,0x51,0x3d,0xf4,
+ 0x4,0x8a,0x32,0xa6,0xc5,0x90,
+ 0x24,0x51,0xbe,0xc5,0x96,
+ 0x41,0x22,0x98,0xb2,0x2b,0x86,0x50,
+ 0x48,0xb0,0x7c,0xa9,0xd1,0x95,0x8c,0xed,0x9e,0xca,0x4,0xe5,
+ 0x4,0xb1,0xd9,0xc1,0x3d,0x91,0xba,0x34,0x5,0xce,0x2b,0x3a,0x37,0xd5,0xd4,
+ 0x4,0xc3,0x49,
+ 0x82,0x62,0xc,
+ 0xc1,0x31,0x56,0x60,
+ 0x9a,0x3,0x28,0x38,0xb3,0x98,
+ 0x26,0x96,0xf4,0xf2,0x7d,0x5c,0x4e,0xce,0x81,0xa2,0x5e,0xee,0xba,0xad,0x11,0x64,
+ 0x9,0xb1,0xf0,0x28,
+ 0x26,0xd0,0xb1,0x80,
+ 0x9b,0x43,0x2a,0x41,0xf2,0xa0,
+ 0x26,0xd7,0xbe,0x88,0x71,0x67,0x30,
+ 0x4d,0xf5,0x90,0xca,
+ 0x9,0xd1,0x23,0x58,
+ 0x28,0x89,0x3e,0x94,0x61,0x7b,0x44,0xb2,0x9d,0x1b,0xdb,0xe,0xce,0x92,
+ 0x5,0x1e,0xc2,0xc8,0x2e,0x19,
+ 0x41,0x47,0xc1,0x23,0x98,
+ 0x29,0x24,
+ 0x82,0x9a,
+ 0x5,0x35,0xd0,0xd6,0x8f,0x68,0x68,0x91,0xf4,0x93,0xa0,
+ 0x2a,0xe0,0xc9,0xa5,0x20,
+ 0x2a,0xe2,0x16,0x53,0x43,0xdf,0x40,
+ 0x56,0x4,0xd,0xa,
+ 0xa,0xcc,0xb2,
+ 0x5,0x84,0x1a,
+ 0x2,0xc5,0x63,0xc6,0x9a,0x64,
+ 0x16,0x30,0x66,
+ 0xb,0x86,0x4e,0x4b,0x8e,
+ 0xb,0x95,0x27,0x45,
+ 0x1,0x74,0xb8,0x95,0x80,
+ 0x2f,0x0,
+ 0x0,
+};
+static const char wordSymbols[] = {'3','2','_','1',};
+const char * const table_acc_hardware[] = {
+ "NONE",
+ "AUTO",
+ "ADXL345",
+ "MPU6050",
+ "MMA845x",
+ "BMA280",
+ "LSM303DLHC",
+ "MPU6000",
+ "MPU6500",
+ "MPU9250",
+ "BMI160",
+ "ICM20689",
+ "FAKE",
+};
+const char * const table_airmodeHandlingType[] = {
+ "STICK_CENTER",
+ "THROTTLE_THRESHOLD",
+};
+const char * const table_alignment[] = {
+ "DEFAULT",
+ "CW0",
+ "CW90",
+ "CW180",
+ "CW270",
+ "CW0FLIP",
+ "CW90FLIP",
+ "CW180FLIP",
+ "CW270FLIP",
+};
+const char * const table_aux_operator[] = {
+ "OR",
+ "AND",
+};
+const char * const table_baro_hardware[] = {
+ "NONE",
+ "AUTO",
+ "BMP085",
+ "MS5611",
+ "BMP280",
+ "MS5607",
+ "LPS25H",
+ "SPL06",
+ "BMP388",
+ "DPS310",
+ "FAKE",
+};
+const char * const table_bat_capacity_unit[] = {
+ "MAH",
+ "MWH",
+};
+const char * const table_bat_voltage_source[] = {
+ "RAW",
+ "SAG_COMP",
+};
+const char * const table_blackbox_compression[] = {
+ "NONE",
+ "HUFFMAN",
+};
+const char * const table_blackbox_device[] = {
+ "SERIAL",
+ "SPIFLASH",
+ "SDCARD",
+};
+const char * const table_current_sensor[] = {
+ "NONE",
+ "ADC",
+ "VIRTUAL",
+ "ESC",
+};
+const char * const table_debug_modes[] = {
+ "NONE",
+ "GYRO",
+ "AGL",
+ "FLOW_RAW",
+ "FLOW",
+ "SBUS",
+ "FPORT",
+ "ALWAYS",
+ "SAG_COMP_VOLTAGE",
+ "VIBE",
+ "CRUISE",
+ "REM_FLIGHT_TIME",
+ "SMARTAUDIO",
+ "ACC",
+ "ITERM_RELAX",
+ "ERPM",
+ "RPM_FILTER",
+ "RPM_FREQ",
+ "NAV_YAW",
+ "DYNAMIC_FILTER",
+ "DYNAMIC_FILTER_FREQUENCY",
+ "IRLOCK",
+ "CD",
+ "KALMAN",
+ "SDCARD",
+};
+const char * const table_direction[] = {
+ "RIGHT",
+ "LEFT",
+ "YAW",
+};
+const char * const table_failsafe_procedure[] = {
+ "SET-THR",
+ "DROP",
+ "RTH",
+ "NONE",
+};
+const char * const table_filter_type[] = {
+ "PT1",
+ "BIQUAD",
+};
+const char * const table_frsky_unit[] = {
+ "METRIC",
+ "IMPERIAL",
+};
+const char * const table_gps_dyn_model[] = {
+ "PEDESTRIAN",
+ "AIR_1G",
+ "AIR_4G",
+};
+const char * const table_gps_provider[] = {
+ "NMEA",
+ "UBLOX",
+ "UNUSED",
+ "NAZA",
+ "UBLOX7",
+ "MTK",
+};
+const char * const table_gps_sbas_mode[] = {
+ "AUTO",
+ "EGNOS",
+ "WAAS",
+ "MSAS",
+ "GAGAN",
+ "NONE",
+};
+const char * const table_gyro_lpf[] = {
+ "256HZ",
+ "188HZ",
+ "98HZ",
+ "42HZ",
+ "20HZ",
+ "10HZ",
+};
+const char * const table_iterm_relax[] = {
+ "OFF",
+ "RP",
+ "RPY",
+};
+const char * const table_iterm_relax_type[] = {
+ "GYRO",
+ "SETPOINT",
+};
+const char * const table_log_level[] = {
+ "ERROR",
+ "WARNING",
+ "INFO",
+ "VERBOSE",
+ "DEBUG",
+};
+const char * const table_ltm_rates[] = {
+ "NORMAL",
+ "MEDIUM",
+ "SLOW",
+};
+const char * const table_mag_hardware[] = {
+ "NONE",
+ "AUTO",
+ "HMC5883",
+ "AK8975",
+ "GPSMAG",
+ "MAG3110",
+ "AK8963",
+ "IST8310",
+ "QMC5883",
+ "MPU9250",
+ "IST8308",
+ "LIS3MDL",
+ "FAKE",
+};
+const char * const table_motor_pwm_protocol[] = {
+ "STANDARD",
+ "ONESHOT125",
+ "ONESHOT42",
+ "MULTISHOT",
+ "BRUSHED",
+ "DSHOT150",
+ "DSHOT300",
+ "DSHOT600",
+ "DSHOT1200",
+ "SERIALSHOT",
+};
+const char * const table_nav_extra_arming_safety[] = {
+ "OFF",
+ "ON",
+ "ALLOW_BYPASS",
+};
+const char * const table_nav_rth_allow_landing[] = {
+ "NEVER",
+ "ALWAYS",
+ "FS_ONLY",
+};
+const char * const table_nav_rth_alt_mode[] = {
+ "CURRENT",
+ "EXTRA",
+ "FIXED",
+ "MAX",
+ "AT_LEAST",
+ "AT_LEAST_LINEAR_DESCENT",
+};
+const char * const table_nav_user_control_mode[] = {
+ "ATTI",
+ "CRUISE",
+};
+const char * const table_off_on[] = {
+ "OFF",
+ "ON",
+};
+const char * const table_opflow_hardware[] = {
+ "NONE",
+ "PMW3901",
+ "CXOF",
+ "MSP",
+ "FAKE",
+};
+const char * const table_pidTypeTable[] = {
+ "NONE",
+ "PID",
+ "PIFF",
+ "AUTO",
+};
+const char * const table_pitot_hardware[] = {
+ "NONE",
+ "AUTO",
+ "MS4525",
+ "ADC",
+ "VIRTUAL",
+ "FAKE",
+};
+const char * const table_platform_type[] = {
+ "MULTIROTOR",
+ "AIRPLANE",
+ "HELICOPTER",
+ "TRICOPTER",
+ "ROVER",
+ "BOAT",
+};
+const char * const table_receiver_type[] = {
+ "NONE",
+ "PPM",
+ "SERIAL",
+ "MSP",
+ "SPI",
+ "UIB",
+};
+const char * const table_reset_type[] = {
+ "NEVER",
+ "FIRST_ARM",
+ "EACH_ARM",
+};
+const char * const table_rssi_source[] = {
+ "NONE",
+ "AUTO",
+ "ADC",
+ "CHANNEL",
+ "PROTOCOL",
+ "MSP",
+};
+const char * const table_serial_rx[] = {
+ "SPEK1024",
+ "SPEK2048",
+ "SBUS",
+ "SUMD",
+ "SUMH",
+ "XB-B",
+ "XB-B-RJ01",
+ "IBUS",
+ "JETIEXBUS",
+ "CRSF",
+ "FPORT",
+ "SBUS_FAST",
+};
+const char * const table_servo_protocol[] = {
+ "PWM",
+ "SERVO_DRIVER",
+ "SBUS",
+};
+const char * const table_smartport_fuel_unit[] = {
+ "PERCENT",
+ "MAH",
+ "MWH",
+};
+const char * const table_tz_automatic_dst[] = {
+ "OFF",
+ "EU",
+ "USA",
+};
+const char * const table_voltage_sensor[] = {
+ "NONE",
+ "ADC",
+ "ESC",
+};
+const char * const table_vtx_low_power_disarm[] = {
+ "OFF",
+ "ON",
+ "UNTIL_FIRST_ARM",
+};
+static const lookupTableEntry_t settingLookupTables[] = {
+ { table_acc_hardware, sizeof(table_acc_hardware) / sizeof(char*) },
+ { table_airmodeHandlingType, sizeof(table_airmodeHandlingType) / sizeof(char*) },
+ { table_alignment, sizeof(table_alignment) / sizeof(char*) },
+ { table_aux_operator, sizeof(table_aux_operator) / sizeof(char*) },
+ { table_baro_hardware, sizeof(table_baro_hardware) / sizeof(char*) },
+ { table_bat_capacity_unit, sizeof(table_bat_capacity_unit) / sizeof(char*) },
+ { table_bat_voltage_source, sizeof(table_bat_voltage_source) / sizeof(char*) },
+ { table_blackbox_compression, sizeof(table_blackbox_compression) / sizeof(char*) },
+ { table_blackbox_device, sizeof(table_blackbox_device) / sizeof(char*) },
+ { table_current_sensor, sizeof(table_current_sensor) / sizeof(char*) },
+ { table_debug_modes, sizeof(table_debug_modes) / sizeof(char*) },
+ { table_direction, sizeof(table_direction) / sizeof(char*) },
+ { table_failsafe_procedure, sizeof(table_failsafe_procedure) / sizeof(char*) },
+ { table_filter_type, sizeof(table_filter_type) / sizeof(char*) },
+ { table_frsky_unit, sizeof(table_frsky_unit) / sizeof(char*) },
+ { table_gps_dyn_model, sizeof(table_gps_dyn_model) / sizeof(char*) },
+ { table_gps_provider, sizeof(table_gps_provider) / sizeof(char*) },
+ { table_gps_sbas_mode, sizeof(table_gps_sbas_mode) / sizeof(char*) },
+ { table_gyro_lpf, sizeof(table_gyro_lpf) / sizeof(char*) },
+ { table_iterm_relax, sizeof(table_iterm_relax) / sizeof(char*) },
+ { table_iterm_relax_type, sizeof(table_iterm_relax_type) / sizeof(char*) },
+ { table_log_level, sizeof(table_log_level) / sizeof(char*) },
+ { table_ltm_rates, sizeof(table_ltm_rates) / sizeof(char*) },
+ { table_mag_hardware, sizeof(table_mag_hardware) / sizeof(char*) },
+ { table_motor_pwm_protocol, sizeof(table_motor_pwm_protocol) / sizeof(char*) },
+ { table_nav_extra_arming_safety, sizeof(table_nav_extra_arming_safety) / sizeof(char*) },
+ { table_nav_rth_allow_landing, sizeof(table_nav_rth_allow_landing) / sizeof(char*) },
+ { table_nav_rth_alt_mode, sizeof(table_nav_rth_alt_mode) / sizeof(char*) },
+ { table_nav_user_control_mode, sizeof(table_nav_user_control_mode) / sizeof(char*) },
+ { table_off_on, sizeof(table_off_on) / sizeof(char*) },
+ { table_opflow_hardware, sizeof(table_opflow_hardware) / sizeof(char*) },
+ { table_pidTypeTable, sizeof(table_pidTypeTable) / sizeof(char*) },
+ { table_pitot_hardware, sizeof(table_pitot_hardware) / sizeof(char*) },
+ { table_platform_type, sizeof(table_platform_type) / sizeof(char*) },
+ { table_receiver_type, sizeof(table_receiver_type) / sizeof(char*) },
+ { table_reset_type, sizeof(table_reset_type) / sizeof(char*) },
+ { table_rssi_source, sizeof(table_rssi_source) / sizeof(char*) },
+ { table_serial_rx, sizeof(table_serial_rx) / sizeof(char*) },
+ { table_servo_protocol, sizeof(table_servo_protocol) / sizeof(char*) },
+ { table_smartport_fuel_unit, sizeof(table_smartport_fuel_unit) / sizeof(char*) },
+ { table_tz_automatic_dst, sizeof(table_tz_automatic_dst) / sizeof(char*) },
+ { table_voltage_sensor, sizeof(table_voltage_sensor) / sizeof(char*) },
+ { table_vtx_low_power_disarm, sizeof(table_vtx_low_power_disarm) / sizeof(char*) },
+};
+static const uint32_t settingMinMaxTable[] = {
+ 0,
+ 100,
+ 200,
+ 1000,
+ 255,
+ 1,
+ 2000,
+ 10,
+ 500,
+ 65535,
+ 5,
+ 10000,
+ 32767,
+ -32768,
+ 50,
+ 5000,
+ -1800,
+ 180,
+ 3600,
+ 65000,
+ 8,
+ 4294967295,
+ 2,
+ 20,
+ 250,
+ 30,
+ 80,
+ 90,
+ 900,
+ 8192,
+ 16000,
+ 60000,
+ -800,
+ 3,
+ 4,
+ 6,
+ 15,
+ 16,
+ 45,
+ 60,
+ 120,
+ 450,
+ 750,
+ 800,
+ 2250,
+ 9999,
+ 500000,
+ 2147483647,
+ -18000,
+ -10000,
+ -1440,
+ -1000,
+ -180,
+ -90,
+ -20,
+ -1,
+ 9,
+ 18,
+ 32,
+ 40,
+ 48,
+ 126,
+ 128,
+ 300,
+ 359,
+ 400,
+ 498,
+ 1440,
+ 4000,
+ 9000,
+ 18000,
+ 20000,
+ 32000,
+};
+typedef uint8_t setting_min_max_idx_t;
+#define SETTING_INDEXES_GET_MIN(val) (val->config.minmax.indexes[0])
+#define SETTING_INDEXES_GET_MAX(val) (val->config.minmax.indexes[1])
+static const setting_t settingsTable[] = {
+
+ { {217, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 69}, 
+# 857 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 857 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyroConfig_t
+# 857 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 857 "./obj/main/SITL/settings_generated.c"
+                                                                                  looptime
+# 857 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 857 "./obj/main/SITL/settings_generated.c"
+                                                                                                                   },
+ { {18, 137, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 858 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 858 "./obj/main/SITL/settings_generated.c"
+                                                                                                 gyroConfig_t
+# 858 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 858 "./obj/main/SITL/settings_generated.c"
+                                                                                                 gyroSync
+# 858 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 858 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {129, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 20}, 
+# 859 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 859 "./obj/main/SITL/settings_generated.c"
+                                                                                 gyroConfig_t
+# 859 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 859 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProcessDenom
+# 859 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 859 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {21, 18, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 
+# 860 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 860 "./obj/main/SITL/settings_generated.c"
+                                                                                                   gyroConfig_t
+# 860 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 860 "./obj/main/SITL/settings_generated.c"
+                                                                                                   gyro_align
+# 860 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 860 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {18, 45, 15, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GYRO_LPF }, 
+# 861 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 861 "./obj/main/SITL/settings_generated.c"
+                                                                                                   gyroConfig_t
+# 861 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 861 "./obj/main/SITL/settings_generated.c"
+                                                                                                   gyro_lpf
+# 861 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 861 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {18, 15, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 862 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 862 "./obj/main/SITL/settings_generated.c"
+                                                                                 gyroConfig_t
+# 862 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 862 "./obj/main/SITL/settings_generated.c"
+                                                                                 gyro_soft_lpf_hz
+# 862 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 862 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {18, 15, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, 
+# 863 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 863 "./obj/main/SITL/settings_generated.c"
+                                                                                                      gyroConfig_t
+# 863 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 863 "./obj/main/SITL/settings_generated.c"
+                                                                                                      gyro_soft_lpf_type
+# 863 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 863 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                 },
+ { {228, 1, 32, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 62}, 
+# 864 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 864 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyroConfig_t
+# 864 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 864 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyroMovementCalibrationThreshold
+# 864 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 864 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {18, 77, 19, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, 
+# 865 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 865 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyroConfig_t
+# 865 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 865 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyro_notch_hz
+# 865 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 865 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {18, 77, 67, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 8}, 
+# 866 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 866 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyroConfig_t
+# 866 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 866 "./obj/main/SITL/settings_generated.c"
+                                                                                  gyro_notch_cutoff
+# 866 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 866 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {198, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, 
+# 867 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 867 "./obj/main/SITL/settings_generated.c"
+                                                                                 gyroConfig_t
+# 867 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 867 "./obj/main/SITL/settings_generated.c"
+                                                                                 gyro_stage2_lowpass_hz
+# 867 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 867 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {199, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, 
+# 868 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     __builtin_offsetof (
+# 868 "./obj/main/SITL/settings_generated.c"
+                                                                                                     gyroConfig_t
+# 868 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     , 
+# 868 "./obj/main/SITL/settings_generated.c"
+                                                                                                     gyro_stage2_lowpass_type
+# 868 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     ) 
+# 868 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                      },
+ { {18, 73, 177, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 869 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 869 "./obj/main/SITL/settings_generated.c"
+                                                                                                  gyroConfig_t
+# 869 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 869 "./obj/main/SITL/settings_generated.c"
+                                                                                                  kalmanEnabled
+# 869 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 869 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {18, 73, 139, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 30}, 
+# 870 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 870 "./obj/main/SITL/settings_generated.c"
+                                                                                    gyroConfig_t
+# 870 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 870 "./obj/main/SITL/settings_generated.c"
+                                                                                    kalman_q
+# 870 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 870 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {18, 73, 30, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 59}, 
+# 871 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 871 "./obj/main/SITL/settings_generated.c"
+                                                                                   gyroConfig_t
+# 871 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 871 "./obj/main/SITL/settings_generated.c"
+                                                                                   kalman_w
+# 871 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 871 "./obj/main/SITL/settings_generated.c"
+                                                                                                                    },
+ { {18, 73, 150, 2, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 30}, 
+# 872 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 872 "./obj/main/SITL/settings_generated.c"
+                                                                                    gyroConfig_t
+# 872 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 872 "./obj/main/SITL/settings_generated.c"
+                                                                                    kalman_sharpness
+# 872 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 872 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+
+ { {16, 77, 19, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 874 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 874 "./obj/main/SITL/settings_generated.c"
+                                                                                 accelerometerConfig_t
+# 874 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 874 "./obj/main/SITL/settings_generated.c"
+                                                                                 acc_notch_hz
+# 874 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 874 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {16, 77, 67, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 4}, 
+# 875 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 875 "./obj/main/SITL/settings_generated.c"
+                                                                                 accelerometerConfig_t
+# 875 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 875 "./obj/main/SITL/settings_generated.c"
+                                                                                 acc_notch_cutoff
+# 875 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 875 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {21, 16, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 
+# 876 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 876 "./obj/main/SITL/settings_generated.c"
+                                                                                                   accelerometerConfig_t
+# 876 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 876 "./obj/main/SITL/settings_generated.c"
+                                                                                                   acc_align
+# 876 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 876 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {16, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ACC_HARDWARE }, 
+# 877 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 877 "./obj/main/SITL/settings_generated.c"
+                                                                                                      accelerometerConfig_t
+# 877 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 877 "./obj/main/SITL/settings_generated.c"
+                                                                                                      acc_hardware
+# 877 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 877 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                    },
+ { {16, 15, 19, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 878 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 878 "./obj/main/SITL/settings_generated.c"
+                                                                                  accelerometerConfig_t
+# 878 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 878 "./obj/main/SITL/settings_generated.c"
+                                                                                  acc_lpf_hz
+# 878 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 878 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {16, 15, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, 
+# 879 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 879 "./obj/main/SITL/settings_generated.c"
+                                                                                                      accelerometerConfig_t
+# 879 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 879 "./obj/main/SITL/settings_generated.c"
+                                                                                                      acc_soft_lpf_type
+# 879 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 879 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                         },
+ { {84, 111, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 880 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 880 "./obj/main/SITL/settings_generated.c"
+                                                                                   accelerometerConfig_t
+# 880 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 880 "./obj/main/SITL/settings_generated.c"
+                                                                                   accZero.raw[X]
+# 880 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 880 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {84, 112, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 881 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 881 "./obj/main/SITL/settings_generated.c"
+                                                                                   accelerometerConfig_t
+# 881 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 881 "./obj/main/SITL/settings_generated.c"
+                                                                                   accZero.raw[Y]
+# 881 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 881 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {84, 7, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 882 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 882 "./obj/main/SITL/settings_generated.c"
+                                                                                 accelerometerConfig_t
+# 882 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 882 "./obj/main/SITL/settings_generated.c"
+                                                                                 accZero.raw[Z]
+# 882 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 882 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {83, 111, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 29}, 
+# 883 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 883 "./obj/main/SITL/settings_generated.c"
+                                                                                  accelerometerConfig_t
+# 883 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 883 "./obj/main/SITL/settings_generated.c"
+                                                                                  accGain.raw[X]
+# 883 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 883 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {83, 112, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 29}, 
+# 884 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 884 "./obj/main/SITL/settings_generated.c"
+                                                                                  accelerometerConfig_t
+# 884 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 884 "./obj/main/SITL/settings_generated.c"
+                                                                                  accGain.raw[Y]
+# 884 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 884 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {83, 7, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {5, 29}, 
+# 885 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 885 "./obj/main/SITL/settings_generated.c"
+                                                                                accelerometerConfig_t
+# 885 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 885 "./obj/main/SITL/settings_generated.c"
+                                                                                accGain.raw[Z]
+# 885 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 885 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+
+ { {100, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OPFLOW_HARDWARE }, 
+# 887 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 887 "./obj/main/SITL/settings_generated.c"
+                                                                                                          opticalFlowConfig_t
+# 887 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          , 
+# 887 "./obj/main/SITL/settings_generated.c"
+                                                                                                          opflow_hardware
+# 887 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          ) 
+# 887 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                         },
+ { {100, 79, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 11}, 
+# 888 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 888 "./obj/main/SITL/settings_generated.c"
+                                                                                  opticalFlowConfig_t
+# 888 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 888 "./obj/main/SITL/settings_generated.c"
+                                                                                  opflow_scale
+# 888 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 888 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {21, 100, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 
+# 889 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    __builtin_offsetof (
+# 889 "./obj/main/SITL/settings_generated.c"
+                                                                                                    opticalFlowConfig_t
+# 889 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    , 
+# 889 "./obj/main/SITL/settings_generated.c"
+                                                                                                    opflow_align
+# 889 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    ) 
+# 889 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+
+ { {21, 25, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ALIGNMENT }, 
+# 891 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 891 "./obj/main/SITL/settings_generated.c"
+                                                                                                   compassConfig_t
+# 891 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 891 "./obj/main/SITL/settings_generated.c"
+                                                                                                   mag_align
+# 891 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 891 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {25, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MAG_HARDWARE }, 
+# 892 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 892 "./obj/main/SITL/settings_generated.c"
+                                                                                                      compassConfig_t
+# 892 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 892 "./obj/main/SITL/settings_generated.c"
+                                                                                                      mag_hardware
+# 892 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 892 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {25, 169, 1, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {48, 70}, 
+# 893 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 893 "./obj/main/SITL/settings_generated.c"
+                                                                                   compassConfig_t
+# 893 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 893 "./obj/main/SITL/settings_generated.c"
+                                                                                   mag_declination
+# 893 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 893 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {99, 111, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 894 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 894 "./obj/main/SITL/settings_generated.c"
+                                                                                   compassConfig_t
+# 894 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 894 "./obj/main/SITL/settings_generated.c"
+                                                                                   magZero.raw[X]
+# 894 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 894 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {99, 112, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 895 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 895 "./obj/main/SITL/settings_generated.c"
+                                                                                   compassConfig_t
+# 895 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 895 "./obj/main/SITL/settings_generated.c"
+                                                                                   magZero.raw[Y]
+# 895 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 895 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {99, 7, 0, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 896 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 896 "./obj/main/SITL/settings_generated.c"
+                                                                                 compassConfig_t
+# 896 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 896 "./obj/main/SITL/settings_generated.c"
+                                                                                 magZero.raw[Z]
+# 896 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 896 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {25, 154, 1, 33, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {25, 40}, 
+# 897 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 897 "./obj/main/SITL/settings_generated.c"
+                                                                                    compassConfig_t
+# 897 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 897 "./obj/main/SITL/settings_generated.c"
+                                                                                    magCalibrationTimeLimit
+# 897 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 897 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {21, 25, 10, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 898 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 898 "./obj/main/SITL/settings_generated.c"
+                                                                                   compassConfig_t
+# 898 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 898 "./obj/main/SITL/settings_generated.c"
+                                                                                   rollDeciDegrees
+# 898 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 898 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {21, 25, 8, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 899 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 899 "./obj/main/SITL/settings_generated.c"
+                                                                                  compassConfig_t
+# 899 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 899 "./obj/main/SITL/settings_generated.c"
+                                                                                  pitchDeciDegrees
+# 899 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 899 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {21, 25, 6, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 900 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 900 "./obj/main/SITL/settings_generated.c"
+                                                                                  compassConfig_t
+# 900 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 900 "./obj/main/SITL/settings_generated.c"
+                                                                                  yawDeciDegrees
+# 900 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 900 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+
+ { {51, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BARO_HARDWARE }, 
+# 902 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       __builtin_offsetof (
+# 902 "./obj/main/SITL/settings_generated.c"
+                                                                                                       barometerConfig_t
+# 902 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       , 
+# 902 "./obj/main/SITL/settings_generated.c"
+                                                                                                       baro_hardware
+# 902 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       ) 
+# 902 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                  },
+ { {51, 223, 1, 123, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 903 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 903 "./obj/main/SITL/settings_generated.c"
+                                                                                                   barometerConfig_t
+# 903 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 903 "./obj/main/SITL/settings_generated.c"
+                                                                                                   use_median_filtering
+# 903 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 903 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                     },
+ { {51, 153, 1, 159, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 904 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 904 "./obj/main/SITL/settings_generated.c"
+                                                                                    barometerConfig_t
+# 904 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 904 "./obj/main/SITL/settings_generated.c"
+                                                                                    baro_calibration_tolerance
+# 904 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 904 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                            },
+
+ { {101, 45, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PITOT_HARDWARE }, 
+# 906 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         __builtin_offsetof (
+# 906 "./obj/main/SITL/settings_generated.c"
+                                                                                                         pitotmeterConfig_t
+# 906 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         , 
+# 906 "./obj/main/SITL/settings_generated.c"
+                                                                                                         pitot_hardware
+# 906 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         ) 
+# 906 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                      },
+ { {101, 15, 225, 1, 19}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, 
+# 907 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 907 "./obj/main/SITL/settings_generated.c"
+                                                                                      pitotmeterConfig_t
+# 907 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 907 "./obj/main/SITL/settings_generated.c"
+                                                                                      pitot_lpf_milli_hz
+# 907 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 907 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {101, 79, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 908 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 908 "./obj/main/SITL/settings_generated.c"
+                                                                                 pitotmeterConfig_t
+# 908 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 908 "./obj/main/SITL/settings_generated.c"
+                                                                                 pitot_scale
+# 908 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 908 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+
+ { {142, 2, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RECEIVER_TYPE }, 
+# 910 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 910 "./obj/main/SITL/settings_generated.c"
+                                                                                                        rxConfig_t
+# 910 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        , 
+# 910 "./obj/main/SITL/settings_generated.c"
+                                                                                                        receiverType
+# 910 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        ) 
+# 910 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {26, 117, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 911 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 911 "./obj/main/SITL/settings_generated.c"
+                                                                                  rxConfig_t
+# 911 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 911 "./obj/main/SITL/settings_generated.c"
+                                                                                  mincheck
+# 911 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 911 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 },
+ { {28, 117, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 912 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 912 "./obj/main/SITL/settings_generated.c"
+                                                                                  rxConfig_t
+# 912 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 912 "./obj/main/SITL/settings_generated.c"
+                                                                                  maxcheck
+# 912 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 912 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 },
+ { {78, 156, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RSSI_SOURCE }, 
+# 913 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 913 "./obj/main/SITL/settings_generated.c"
+                                                                                                      rxConfig_t
+# 913 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 913 "./obj/main/SITL/settings_generated.c"
+                                                                                                      rssi_source
+# 913 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 913 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {78, 116, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 57}, 
+# 914 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 914 "./obj/main/SITL/settings_generated.c"
+                                                                                  rxConfig_t
+# 914 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 914 "./obj/main/SITL/settings_generated.c"
+                                                                                  rssi_channel
+# 914 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 914 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {78, 26, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 915 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 915 "./obj/main/SITL/settings_generated.c"
+                                                                                rxConfig_t
+# 915 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 915 "./obj/main/SITL/settings_generated.c"
+                                                                                rssiMin
+# 915 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 915 "./obj/main/SITL/settings_generated.c"
+                                                                                                              },
+ { {78, 28, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 916 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 916 "./obj/main/SITL/settings_generated.c"
+                                                                                rxConfig_t
+# 916 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 916 "./obj/main/SITL/settings_generated.c"
+                                                                                rssiMax
+# 916 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 916 "./obj/main/SITL/settings_generated.c"
+                                                                                                              },
+ { {149, 2, 137, 1, 125}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 11}, 
+# 917 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 917 "./obj/main/SITL/settings_generated.c"
+                                                                                      rxConfig_t
+# 917 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 917 "./obj/main/SITL/settings_generated.c"
+                                                                                      sbusSyncInterval
+# 917 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 917 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {48, 123, 189, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 918 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 918 "./obj/main/SITL/settings_generated.c"
+                                                                                   rxConfig_t
+# 918 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 918 "./obj/main/SITL/settings_generated.c"
+                                                                                   rcFilterFrequency
+# 918 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 918 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {104, 134, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERIAL_RX }, 
+# 919 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     __builtin_offsetof (
+# 919 "./obj/main/SITL/settings_generated.c"
+                                                                                                     rxConfig_t
+# 919 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     , 
+# 919 "./obj/main/SITL/settings_generated.c"
+                                                                                                     serialrx_provider
+# 919 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     ) 
+# 919 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                             },
+ { {104, 98, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 920 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 920 "./obj/main/SITL/settings_generated.c"
+                                                                                                 rxConfig_t
+# 920 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 920 "./obj/main/SITL/settings_generated.c"
+                                                                                                 serialrx_inverted
+# 920 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 920 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {146, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 20}, 
+# 921 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 921 "./obj/main/SITL/settings_generated.c"
+                                                                                 rxConfig_t
+# 921 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 921 "./obj/main/SITL/settings_generated.c"
+                                                                                 rx_spi_rf_channel_count
+# 921 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 921 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {136, 1, 26, 141, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {42, 44}, 
+# 922 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 922 "./obj/main/SITL/settings_generated.c"
+                                                                                      rxConfig_t
+# 922 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 922 "./obj/main/SITL/settings_generated.c"
+                                                                                      rx_min_usec
+# 922 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 922 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {136, 1, 28, 141, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {42, 44}, 
+# 923 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 923 "./obj/main/SITL/settings_generated.c"
+                                                                                      rxConfig_t
+# 923 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 923 "./obj/main/SITL/settings_generated.c"
+                                                                                      rx_max_usec
+# 923 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 923 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {104, 92, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 924 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 924 "./obj/main/SITL/settings_generated.c"
+                                                                                                 rxConfig_t
+# 924 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 924 "./obj/main/SITL/settings_generated.c"
+                                                                                                 halfDuplex
+# 924 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 924 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+
+ { {63, 4, 251, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, 
+# 926 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 926 "./obj/main/SITL/settings_generated.c"
+                                                                                  blackboxConfig_t
+# 926 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 926 "./obj/main/SITL/settings_generated.c"
+                                                                                  rate_num
+# 926 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 926 "./obj/main/SITL/settings_generated.c"
+                                                                                                                       },
+ { {63, 4, 171, 1, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 9}, 
+# 927 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 927 "./obj/main/SITL/settings_generated.c"
+                                                                                  blackboxConfig_t
+# 927 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 927 "./obj/main/SITL/settings_generated.c"
+                                                                                  rate_denom
+# 927 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 927 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {63, 172, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_DEVICE }, 
+# 928 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 928 "./obj/main/SITL/settings_generated.c"
+                                                                                                          blackboxConfig_t
+# 928 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          , 
+# 928 "./obj/main/SITL/settings_generated.c"
+                                                                                                          device
+# 928 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          ) 
+# 928 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                             },
+ { {63, 159, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BLACKBOX_COMPRESSION }, 
+# 929 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 929 "./obj/main/SITL/settings_generated.c"
+                                                                                                               blackboxConfig_t
+# 929 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               , 
+# 929 "./obj/main/SITL/settings_generated.c"
+                                                                                                               compression
+# 929 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               ) 
+# 929 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                       },
+
+ { {28, 50, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 931 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 931 "./obj/main/SITL/settings_generated.c"
+                                                                                 motorConfig_t
+# 931 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 931 "./obj/main/SITL/settings_generated.c"
+                                                                                 maxthrottle
+# 931 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 931 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {26, 157, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 6}, 
+# 932 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 932 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorConfig_t
+# 932 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 932 "./obj/main/SITL/settings_generated.c"
+                                                                                  mincommand
+# 932 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 932 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {37, 102, 4, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 72}, 
+# 933 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 933 "./obj/main/SITL/settings_generated.c"
+                                                                                    motorConfig_t
+# 933 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 933 "./obj/main/SITL/settings_generated.c"
+                                                                                    motorPwmRate
+# 933 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 933 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {37, 61, 33, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 934 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 934 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorConfig_t
+# 934 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 934 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorAccelTimeMs
+# 934 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 934 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {37, 167, 1, 33, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 935 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 935 "./obj/main/SITL/settings_generated.c"
+                                                                                   motorConfig_t
+# 935 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 935 "./obj/main/SITL/settings_generated.c"
+                                                                                   motorDecelTimeMs
+# 935 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 935 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {37, 102, 133, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_MOTOR_PWM_PROTOCOL }, 
+# 936 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 936 "./obj/main/SITL/settings_generated.c"
+                                                                                                               motorConfig_t
+# 936 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               , 
+# 936 "./obj/main/SITL/settings_generated.c"
+                                                                                                               motorPwmProtocol
+# 936 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               ) 
+# 936 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                         },
+ { {50, 79, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, 
+# 937 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 937 "./obj/main/SITL/settings_generated.c"
+                                                                                motorConfig_t
+# 937 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 937 "./obj/main/SITL/settings_generated.c"
+                                                                                throttleScale
+# 937 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 937 "./obj/main/SITL/settings_generated.c"
+                                                                                                                       },
+ { {50, 96, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {34, 25}, 
+# 938 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 938 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorConfig_t
+# 938 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 938 "./obj/main/SITL/settings_generated.c"
+                                                                                  throttleIdle
+# 938 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 938 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {37, 134, 2, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {34, 4}, 
+# 939 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 939 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorConfig_t
+# 939 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 939 "./obj/main/SITL/settings_generated.c"
+                                                                                  motorPoleCount
+# 939 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 939 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+
+ { {11, 34, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 941 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 941 "./obj/main/SITL/settings_generated.c"
+                                                                                failsafeConfig_t
+# 941 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 941 "./obj/main/SITL/settings_generated.c"
+                                                                                failsafe_delay
+# 941 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 941 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {11, 143, 2, 34, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 942 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 942 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafeConfig_t
+# 942 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 942 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafe_recovery_delay
+# 942 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 942 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {11, 252, 1, 34, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 943 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 943 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafeConfig_t
+# 943 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 943 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafe_off_delay
+# 943 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 943 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {11, 50, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 944 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 944 "./obj/main/SITL/settings_generated.c"
+                                                                                 failsafeConfig_t
+# 944 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 944 "./obj/main/SITL/settings_generated.c"
+                                                                                 failsafe_throttle
+# 944 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 944 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {11, 50, 55, 34, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 63}, 
+# 945 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 945 "./obj/main/SITL/settings_generated.c"
+                                                                                    failsafeConfig_t
+# 945 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 945 "./obj/main/SITL/settings_generated.c"
+                                                                                    failsafe_throttle_low_delay
+# 945 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 945 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                            },
+ { {11, 132, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, 
+# 946 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 946 "./obj/main/SITL/settings_generated.c"
+                                                                                                             failsafeConfig_t
+# 946 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             , 
+# 946 "./obj/main/SITL/settings_generated.c"
+                                                                                                             failsafe_procedure
+# 946 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             ) 
+# 946 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                            },
+ { {11, 157, 2, 32, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 8}, 
+# 947 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 947 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafeConfig_t
+# 947 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 947 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafe_stick_motion_threshold
+# 947 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 947 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                               },
+ { {11, 2, 10, 22, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {32, 43}, 
+# 948 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 948 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafeConfig_t
+# 948 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 948 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafe_fw_roll_angle
+# 948 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 948 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {11, 2, 8, 22, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {32, 43}, 
+# 949 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 949 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafeConfig_t
+# 949 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 949 "./obj/main/SITL/settings_generated.c"
+                                                                                  failsafe_fw_pitch_angle
+# 949 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 949 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {11, 2, 6, 4, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {51, 3}, 
+# 950 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 950 "./obj/main/SITL/settings_generated.c"
+                                                                                failsafeConfig_t
+# 950 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 950 "./obj/main/SITL/settings_generated.c"
+                                                                                failsafe_fw_yaw_rate
+# 950 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 950 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {11, 26, 69, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 951 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 951 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafeConfig_t
+# 951 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 951 "./obj/main/SITL/settings_generated.c"
+                                                                                   failsafe_min_distance
+# 951 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 951 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {11, 26, 69, 132, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FAILSAFE_PROCEDURE }, 
+# 952 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               __builtin_offsetof (
+# 952 "./obj/main/SITL/settings_generated.c"
+                                                                                                               failsafeConfig_t
+# 952 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               , 
+# 952 "./obj/main/SITL/settings_generated.c"
+                                                                                                               failsafe_min_distance_procedure
+# 952 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                               ) 
+# 952 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                           },
+ { {11, 226, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 953 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 953 "./obj/main/SITL/settings_generated.c"
+                                                                                                 failsafeConfig_t
+# 953 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 953 "./obj/main/SITL/settings_generated.c"
+                                                                                                 failsafe_mission
+# 953 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 953 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+
+ { {21, 88, 10, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 955 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 955 "./obj/main/SITL/settings_generated.c"
+                                                                                   boardAlignment_t
+# 955 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 955 "./obj/main/SITL/settings_generated.c"
+                                                                                   rollDeciDegrees
+# 955 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 955 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {21, 88, 8, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 956 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 956 "./obj/main/SITL/settings_generated.c"
+                                                                                  boardAlignment_t
+# 956 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 956 "./obj/main/SITL/settings_generated.c"
+                                                                                  pitchDeciDegrees
+# 956 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 956 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {21, 88, 6, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {16, 18}, 
+# 957 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 957 "./obj/main/SITL/settings_generated.c"
+                                                                                  boardAlignment_t
+# 957 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 957 "./obj/main/SITL/settings_generated.c"
+                                                                                  yawDeciDegrees
+# 957 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 957 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+
+ { {168, 2, 76, 14, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VOLTAGE_SENSOR }, 
+# 959 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 959 "./obj/main/SITL/settings_generated.c"
+                                                                                                          batteryMetersConfig_t
+# 959 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          , 
+# 959 "./obj/main/SITL/settings_generated.c"
+                                                                                                          voltage.type
+# 959 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          ) 
+# 959 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                        },
+ { {90, 76, 79, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {49, 11}, 
+# 960 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 960 "./obj/main/SITL/settings_generated.c"
+                                                                                   batteryMetersConfig_t
+# 960 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 960 "./obj/main/SITL/settings_generated.c"
+                                                                                   current.scale
+# 960 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 960 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {90, 76, 57, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 961 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 961 "./obj/main/SITL/settings_generated.c"
+                                                                                   batteryMetersConfig_t
+# 961 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 961 "./obj/main/SITL/settings_generated.c"
+                                                                                   current.offset
+# 961 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 961 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {90, 76, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_CURRENT_SENSOR }, 
+# 962 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         __builtin_offsetof (
+# 962 "./obj/main/SITL/settings_generated.c"
+                                                                                                         batteryMetersConfig_t
+# 962 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         , 
+# 962 "./obj/main/SITL/settings_generated.c"
+                                                                                                         current.type
+# 962 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         ) 
+# 962 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                       },
+ { {149, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_VOLTAGE_SOURCE }, 
+# 963 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 963 "./obj/main/SITL/settings_generated.c"
+                                                                                                            batteryMetersConfig_t
+# 963 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            , 
+# 963 "./obj/main/SITL/settings_generated.c"
+                                                                                                            voltageSource
+# 963 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            ) 
+# 963 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                           },
+ { {66, 58, 0, 0, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, 
+# 964 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 964 "./obj/main/SITL/settings_generated.c"
+                                                                                  batteryMetersConfig_t
+# 964 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 964 "./obj/main/SITL/settings_generated.c"
+                                                                                  cruise_power
+# 964 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 964 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {96, 58, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 965 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 965 "./obj/main/SITL/settings_generated.c"
+                                                                                 batteryMetersConfig_t
+# 965 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 965 "./obj/main/SITL/settings_generated.c"
+                                                                                 idle_power
+# 965 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 965 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {20, 178, 1, 219, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 966 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 966 "./obj/main/SITL/settings_generated.c"
+                                                                                   batteryMetersConfig_t
+# 966 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 966 "./obj/main/SITL/settings_generated.c"
+                                                                                   rth_energy_margin
+# 966 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 966 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {29, 158, 1, 172, 2}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 22}, 
+# 967 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 967 "./obj/main/SITL/settings_generated.c"
+                                                                                    batteryMetersConfig_t
+# 967 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 967 "./obj/main/SITL/settings_generated.c"
+                                                                                    throttle_compensation_weight
+# 967 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 967 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                  },
+
+ { {62, 64, 0, 0, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 21}, 
+# 969 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                          __builtin_offsetof (
+# 969 "./obj/main/SITL/settings_generated.c"
+                                                                                          batteryProfile_t
+# 969 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                          , 
+# 969 "./obj/main/SITL/settings_generated.c"
+                                                                                          capacity.value
+# 969 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                          ) 
+# 969 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {62, 64, 171, 2, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 21}, 
+# 970 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            __builtin_offsetof (
+# 970 "./obj/main/SITL/settings_generated.c"
+                                                                                            batteryProfile_t
+# 970 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            , 
+# 970 "./obj/main/SITL/settings_generated.c"
+                                                                                            capacity.warning
+# 970 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            ) 
+# 970 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {62, 64, 163, 1, 0}, VAR_UINT32 | BATTERY_CONFIG_VALUE, .config.minmax.indexes = {0, 21}, 
+# 971 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            __builtin_offsetof (
+# 971 "./obj/main/SITL/settings_generated.c"
+                                                                                            batteryProfile_t
+# 971 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            , 
+# 971 "./obj/main/SITL/settings_generated.c"
+                                                                                            capacity.critical
+# 971 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                            ) 
+# 971 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+ { {62, 64, 109, 0, 0}, VAR_UINT8 | BATTERY_CONFIG_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_BAT_CAPACITY_UNIT }, 
+# 972 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                     __builtin_offsetof (
+# 972 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     batteryProfile_t
+# 972 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                     , 
+# 972 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     capacity.unit
+# 972 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                     ) 
+# 972 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                               },
+
+ { {37, 91, 98, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 974 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 974 "./obj/main/SITL/settings_generated.c"
+                                                                                                 mixerConfig_t
+# 974 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 974 "./obj/main/SITL/settings_generated.c"
+                                                                                                 motorDirectionInverted
+# 974 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 974 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                 },
+ { {133, 2, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PLATFORM_TYPE }, 
+# 975 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 975 "./obj/main/SITL/settings_generated.c"
+                                                                                                        mixerConfig_t
+# 975 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        , 
+# 975 "./obj/main/SITL/settings_generated.c"
+                                                                                                        platformType
+# 975 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        ) 
+# 975 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {200, 1, 186, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 976 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 976 "./obj/main/SITL/settings_generated.c"
+                                                                                                  mixerConfig_t
+# 976 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 976 "./obj/main/SITL/settings_generated.c"
+                                                                                                  hasFlaps
+# 976 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 976 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {130, 1, 137, 2, 14}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {55, 12}, 
+# 977 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 977 "./obj/main/SITL/settings_generated.c"
+                                                                                     mixerConfig_t
+# 977 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 977 "./obj/main/SITL/settings_generated.c"
+                                                                                     appliedMixerPreset
+# 977 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 977 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {194, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 41}, 
+# 978 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 978 "./obj/main/SITL/settings_generated.c"
+                                                                                  mixerConfig_t
+# 978 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 978 "./obj/main/SITL/settings_generated.c"
+                                                                                  fwMinThrottleDownPitchAngle
+# 978 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 978 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+
+ { {60, 31, 55, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 980 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 980 "./obj/main/SITL/settings_generated.c"
+                                                                                  reversibleMotorsConfig_t
+# 980 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 980 "./obj/main/SITL/settings_generated.c"
+                                                                                  deadband_low
+# 980 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 980 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {60, 31, 124, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 981 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 981 "./obj/main/SITL/settings_generated.c"
+                                                                                   reversibleMotorsConfig_t
+# 981 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 981 "./obj/main/SITL/settings_generated.c"
+                                                                                   deadband_high
+# 981 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 981 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {60, 250, 1, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 982 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 982 "./obj/main/SITL/settings_generated.c"
+                                                                                  reversibleMotorsConfig_t
+# 982 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 982 "./obj/main/SITL/settings_generated.c"
+                                                                                  neutral
+# 982 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 982 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+
+ { {59, 133, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SERVO_PROTOCOL }, 
+# 984 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         __builtin_offsetof (
+# 984 "./obj/main/SITL/settings_generated.c"
+                                                                                                         servoConfig_t
+# 984 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         , 
+# 984 "./obj/main/SITL/settings_generated.c"
+                                                                                                         servo_protocol
+# 984 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         ) 
+# 984 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                 },
+ { {59, 155, 1, 138, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 985 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 985 "./obj/main/SITL/settings_generated.c"
+                                                                                    servoConfig_t
+# 985 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 985 "./obj/main/SITL/settings_generated.c"
+                                                                                    servoCenterPulse
+# 985 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 985 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {59, 102, 4, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 66}, 
+# 986 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 986 "./obj/main/SITL/settings_generated.c"
+                                                                                    servoConfig_t
+# 986 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 986 "./obj/main/SITL/settings_generated.c"
+                                                                                    servoPwmRate
+# 986 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 986 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {59, 15, 19, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {0, 65}, 
+# 987 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 987 "./obj/main/SITL/settings_generated.c"
+                                                                                  servoConfig_t
+# 987 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 987 "./obj/main/SITL/settings_generated.c"
+                                                                                  servo_lowpass_freq
+# 987 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 987 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {185, 1, 138, 1, 57}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 41}, 
+# 988 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 988 "./obj/main/SITL/settings_generated.c"
+                                                                                      servoConfig_t
+# 988 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 988 "./obj/main/SITL/settings_generated.c"
+                                                                                      flaperon_throw_offset
+# 988 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 988 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {161, 2, 164, 2, 59}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 989 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 989 "./obj/main/SITL/settings_generated.c"
+                                                                                                   servoConfig_t
+# 989 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 989 "./obj/main/SITL/settings_generated.c"
+                                                                                                   tri_unarmed_servo
+# 989 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 989 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+
+ { {29, 224, 1, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 991 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       __builtin_offsetof (
+# 991 "./obj/main/SITL/settings_generated.c"
+                                                                                       controlRateConfig_t
+# 991 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       , 
+# 991 "./obj/main/SITL/settings_generated.c"
+                                                                                       throttle.rcMid8
+# 991 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       ) 
+# 991 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {29, 43, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 992 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 992 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 992 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 992 "./obj/main/SITL/settings_generated.c"
+                                                                                      throttle.rcExpo8
+# 992 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 992 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {108, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 993 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 993 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 993 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 993 "./obj/main/SITL/settings_generated.c"
+                                                                                      throttle.dynPID
+# 993 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 993 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {108, 152, 1, 0, 0}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {3, 6}, 
+# 994 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                         __builtin_offsetof (
+# 994 "./obj/main/SITL/settings_generated.c"
+                                                                                         controlRateConfig_t
+# 994 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                         , 
+# 994 "./obj/main/SITL/settings_generated.c"
+                                                                                         throttle.pa_breakpoint
+# 994 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                         ) 
+# 994 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                               },
+ { {2, 108, 33, 161, 1}, VAR_UINT16 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 15}, 
+# 995 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                           __builtin_offsetof (
+# 995 "./obj/main/SITL/settings_generated.c"
+                                                                                           controlRateConfig_t
+# 995 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                           , 
+# 995 "./obj/main/SITL/settings_generated.c"
+                                                                                           throttle.fixedWingTauMs
+# 995 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                           ) 
+# 995 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                  },
+ { {48, 43, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 996 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 996 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 996 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 996 "./obj/main/SITL/settings_generated.c"
+                                                                                      stabilized.rcExpo8
+# 996 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 996 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {48, 6, 43, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 997 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 997 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 997 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 997 "./obj/main/SITL/settings_generated.c"
+                                                                                      stabilized.rcYawExpo8
+# 997 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 997 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {10, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {35, 17}, 
+# 998 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       __builtin_offsetof (
+# 998 "./obj/main/SITL/settings_generated.c"
+                                                                                       controlRateConfig_t
+# 998 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       , 
+# 998 "./obj/main/SITL/settings_generated.c"
+                                                                                       stabilized.rates[FD_ROLL]
+# 998 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       ) 
+# 998 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {8, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {35, 17}, 
+# 999 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 999 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 999 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 999 "./obj/main/SITL/settings_generated.c"
+                                                                                      stabilized.rates[FD_PITCH]
+# 999 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 999 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {6, 4, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {22, 17}, 
+# 1000 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 1000 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 1000 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 1000 "./obj/main/SITL/settings_generated.c"
+                                                                                      stabilized.rates[FD_YAW]
+# 1000 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 1000 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {36, 48, 43, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1001 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       __builtin_offsetof (
+# 1001 "./obj/main/SITL/settings_generated.c"
+                                                                                       controlRateConfig_t
+# 1001 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       , 
+# 1001 "./obj/main/SITL/settings_generated.c"
+                                                                                       manual.rcExpo8
+# 1001 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       ) 
+# 1001 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {36, 48, 6, 43, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1002 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       __builtin_offsetof (
+# 1002 "./obj/main/SITL/settings_generated.c"
+                                                                                       controlRateConfig_t
+# 1002 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       , 
+# 1002 "./obj/main/SITL/settings_generated.c"
+                                                                                       manual.rcYawExpo8
+# 1002 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       ) 
+# 1002 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {36, 10, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1003 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 1003 "./obj/main/SITL/settings_generated.c"
+                                                                                      controlRateConfig_t
+# 1003 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 1003 "./obj/main/SITL/settings_generated.c"
+                                                                                      manual.rates[FD_ROLL]
+# 1003 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 1003 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {36, 8, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1004 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1004 "./obj/main/SITL/settings_generated.c"
+                                                                                     controlRateConfig_t
+# 1004 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1004 "./obj/main/SITL/settings_generated.c"
+                                                                                     manual.rates[FD_PITCH]
+# 1004 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1004 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {36, 6, 4, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1005 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1005 "./obj/main/SITL/settings_generated.c"
+                                                                                     controlRateConfig_t
+# 1005 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1005 "./obj/main/SITL/settings_generated.c"
+                                                                                     manual.rates[FD_YAW]
+# 1005 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1005 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {188, 1, 0, 0, 0}, VAR_UINT8 | CONTROL_RATE_VALUE, .config.minmax.indexes = {0, 14}, 
+# 1006 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       __builtin_offsetof (
+# 1006 "./obj/main/SITL/settings_generated.c"
+                                                                                       controlRateConfig_t
+# 1006 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       , 
+# 1006 "./obj/main/SITL/settings_generated.c"
+                                                                                       misc.fpvCamAngleDegrees
+# 1006 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                       ) 
+# 1006 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+
+ { {141, 2, 156, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {60, 61}, 
+# 1008 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1008 "./obj/main/SITL/settings_generated.c"
+                                                                                    serialConfig_t
+# 1008 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1008 "./obj/main/SITL/settings_generated.c"
+                                                                                    reboot_character
+# 1008 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1008 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+
+ { {46, 68, 127, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1010 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1010 "./obj/main/SITL/settings_generated.c"
+                                                                                   imuConfig_t
+# 1010 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1010 "./obj/main/SITL/settings_generated.c"
+                                                                                   dcm_kp_acc
+# 1010 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1010 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {46, 68, 126, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1011 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1011 "./obj/main/SITL/settings_generated.c"
+                                                                                   imuConfig_t
+# 1011 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1011 "./obj/main/SITL/settings_generated.c"
+                                                                                   dcm_ki_acc
+# 1011 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1011 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {46, 68, 127, 25, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1012 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1012 "./obj/main/SITL/settings_generated.c"
+                                                                                    imuConfig_t
+# 1012 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1012 "./obj/main/SITL/settings_generated.c"
+                                                                                    dcm_kp_mag
+# 1012 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1012 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {46, 68, 126, 25, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1013 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1013 "./obj/main/SITL/settings_generated.c"
+                                                                                    imuConfig_t
+# 1013 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1013 "./obj/main/SITL/settings_generated.c"
+                                                                                    dcm_ki_mag
+# 1013 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1013 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {153, 2, 22, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 17}, 
+# 1014 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1014 "./obj/main/SITL/settings_generated.c"
+                                                                                  imuConfig_t
+# 1014 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1014 "./obj/main/SITL/settings_generated.c"
+                                                                                  small_angle
+# 1014 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1014 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {46, 16, 97, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 23}, 
+# 1015 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1015 "./obj/main/SITL/settings_generated.c"
+                                                                                  imuConfig_t
+# 1015 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1015 "./obj/main/SITL/settings_generated.c"
+                                                                                  acc_ignore_rate
+# 1015 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1015 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {46, 16, 97, 152, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, 
+# 1016 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1016 "./obj/main/SITL/settings_generated.c"
+                                                                                    imuConfig_t
+# 1016 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1016 "./obj/main/SITL/settings_generated.c"
+                                                                                    acc_ignore_slope
+# 1016 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1016 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+
+ { {183, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1018 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1018 "./obj/main/SITL/settings_generated.c"
+                                                                                                armingConfig_t
+# 1018 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1018 "./obj/main/SITL/settings_generated.c"
+                                                                                                fixed_wing_auto_arm
+# 1018 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1018 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {53, 213, 1, 107, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1019 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 1019 "./obj/main/SITL/settings_generated.c"
+                                                                                                   armingConfig_t
+# 1019 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 1019 "./obj/main/SITL/settings_generated.c"
+                                                                                                   disarm_kill_switch
+# 1019 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 1019 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {107, 53, 34, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1020 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1020 "./obj/main/SITL/settings_generated.c"
+                                                                                   armingConfig_t
+# 1020 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1020 "./obj/main/SITL/settings_generated.c"
+                                                                                   switchDisarmDelayMs
+# 1020 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1020 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+
+ { {147, 1, 170, 1, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 33}, 
+# 1022 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1022 "./obj/main/SITL/settings_generated.c"
+                                                                                   generalSettings_t
+# 1022 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1022 "./obj/main/SITL/settings_generated.c"
+                                                                                   appliedDefaults
+# 1022 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1022 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+
+ { {23, 134, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_PROVIDER }, 
+# 1024 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       __builtin_offsetof (
+# 1024 "./obj/main/SITL/settings_generated.c"
+                                                                                                       gpsConfig_t
+# 1024 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       , 
+# 1024 "./obj/main/SITL/settings_generated.c"
+                                                                                                       provider
+# 1024 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       ) 
+# 1024 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {23, 148, 2, 56, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_SBAS_MODE }, 
+# 1025 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         __builtin_offsetof (
+# 1025 "./obj/main/SITL/settings_generated.c"
+                                                                                                         gpsConfig_t
+# 1025 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         , 
+# 1025 "./obj/main/SITL/settings_generated.c"
+                                                                                                         sbasMode
+# 1025 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                         ) 
+# 1025 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {23, 176, 1, 130, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_GPS_DYN_MODEL }, 
+# 1026 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 1026 "./obj/main/SITL/settings_generated.c"
+                                                                                                          gpsConfig_t
+# 1026 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          , 
+# 1026 "./obj/main/SITL/settings_generated.c"
+                                                                                                          dynModel
+# 1026 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          ) 
+# 1026 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+ { {23, 41, 160, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1027 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 1027 "./obj/main/SITL/settings_generated.c"
+                                                                                                  gpsConfig_t
+# 1027 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 1027 "./obj/main/SITL/settings_generated.c"
+                                                                                                  autoConfig
+# 1027 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 1027 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {23, 41, 150, 1, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1028 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 1028 "./obj/main/SITL/settings_generated.c"
+                                                                                                  gpsConfig_t
+# 1028 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 1028 "./obj/main/SITL/settings_generated.c"
+                                                                                                  autoBaud
+# 1028 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 1028 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {197, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1029 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1029 "./obj/main/SITL/settings_generated.c"
+                                                                                                gpsConfig_t
+# 1029 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1029 "./obj/main/SITL/settings_generated.c"
+                                                                                                ubloxUseGalileo
+# 1029 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1029 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {23, 26, 147, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 7}, 
+# 1030 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1030 "./obj/main/SITL/settings_generated.c"
+                                                                                   gpsConfig_t
+# 1030 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1030 "./obj/main/SITL/settings_generated.c"
+                                                                                   gpsMinSats
+# 1030 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1030 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+
+ { {31, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 58}, 
+# 1032 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1032 "./obj/main/SITL/settings_generated.c"
+                                                                                rcControlsConfig_t
+# 1032 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1032 "./obj/main/SITL/settings_generated.c"
+                                                                                deadband
+# 1032 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1032 "./obj/main/SITL/settings_generated.c"
+                                                                                                                       },
+ { {6, 31, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1033 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1033 "./obj/main/SITL/settings_generated.c"
+                                                                               rcControlsConfig_t
+# 1033 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1033 "./obj/main/SITL/settings_generated.c"
+                                                                               yaw_deadband
+# 1033 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1033 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {9, 95, 31, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {22, 24}, 
+# 1034 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1034 "./obj/main/SITL/settings_generated.c"
+                                                                                  rcControlsConfig_t
+# 1034 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1034 "./obj/main/SITL/settings_generated.c"
+                                                                                  pos_hold_deadband
+# 1034 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1034 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {114, 95, 31, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {7, 24}, 
+# 1035 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1035 "./obj/main/SITL/settings_generated.c"
+                                                                                   rcControlsConfig_t
+# 1035 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1035 "./obj/main/SITL/settings_generated.c"
+                                                                                   alt_hold_deadband
+# 1035 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1035 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {60, 31, 50, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1036 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1036 "./obj/main/SITL/settings_generated.c"
+                                                                                  rcControlsConfig_t
+# 1036 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1036 "./obj/main/SITL/settings_generated.c"
+                                                                                  mid_throttle_deadband
+# 1036 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1036 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {3, 113, 14, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AIRMODEHANDLINGTYPE }, 
+# 1037 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                              __builtin_offsetof (
+# 1037 "./obj/main/SITL/settings_generated.c"
+                                                                                                              rcControlsConfig_t
+# 1037 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                              , 
+# 1037 "./obj/main/SITL/settings_generated.c"
+                                                                                                              airmodeHandlingType
+# 1037 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                              ) 
+# 1037 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                },
+ { {3, 113, 32, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1038 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1038 "./obj/main/SITL/settings_generated.c"
+                                                                                  rcControlsConfig_t
+# 1038 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1038 "./obj/main/SITL/settings_generated.c"
+                                                                                  airmodeThrottleThreshold
+# 1038 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1038 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+
+ { {3, 5, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1040 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1040 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1040 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1040 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_mc.pid[PID_PITCH].P
+# 1040 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1040 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {3, 12, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1041 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1041 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1041 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1041 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_PITCH].I
+# 1041 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1041 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 17, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1042 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1042 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1042 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1042 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_PITCH].D
+# 1042 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1042 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 65, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1043 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1043 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1043 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1043 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_PITCH].FF
+# 1043 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1043 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {3, 5, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1044 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1044 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1044 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1044 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_ROLL].P
+# 1044 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1044 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {3, 12, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1045 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1045 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1045 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1045 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_ROLL].I
+# 1045 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1045 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 17, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1046 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1046 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1046 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1046 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_ROLL].D
+# 1046 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1046 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 65, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1047 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1047 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1047 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1047 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_ROLL].FF
+# 1047 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1047 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {3, 5, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1048 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1048 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1048 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1048 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_mc.pid[PID_YAW].P
+# 1048 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1048 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {3, 12, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1049 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1049 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1049 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1049 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_YAW].I
+# 1049 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1049 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {3, 17, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1050 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1050 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1050 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1050 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_YAW].D
+# 1050 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1050 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {3, 65, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1051 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1051 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1051 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1051 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_YAW].FF
+# 1051 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1051 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {3, 5, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1052 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1052 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1052 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1052 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_LEVEL].P
+# 1052 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1052 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 12, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1053 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1053 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1053 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1053 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_LEVEL].I
+# 1053 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1053 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {3, 17, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1054 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1054 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1054 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1054 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_LEVEL].D
+# 1054 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1054 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {2, 5, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1055 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1055 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1055 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1055 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_fw.pid[PID_PITCH].P
+# 1055 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1055 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {2, 12, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1056 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1056 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1056 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1056 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_PITCH].I
+# 1056 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1056 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {2, 71, 8, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1057 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1057 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1057 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1057 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_PITCH].FF
+# 1057 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1057 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {2, 5, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1058 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1058 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1058 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1058 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_ROLL].P
+# 1058 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1058 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {2, 12, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1059 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1059 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1059 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1059 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_ROLL].I
+# 1059 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1059 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {2, 71, 10, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1060 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1060 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1060 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1060 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_ROLL].FF
+# 1060 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1060 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {2, 5, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1061 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1061 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1061 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1061 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_fw.pid[PID_YAW].P
+# 1061 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1061 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {2, 12, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1062 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1062 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1062 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1062 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_YAW].I
+# 1062 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1062 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {2, 71, 6, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1063 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1063 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1063 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1063 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_YAW].FF
+# 1063 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1063 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {2, 5, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1064 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1064 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1064 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1064 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_LEVEL].P
+# 1064 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1064 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {2, 12, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1065 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1065 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1065 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1065 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_LEVEL].I
+# 1065 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1065 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {2, 17, 35, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1066 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1066 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1066 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1066 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_LEVEL].D
+# 1066 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1066 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {222, 1, 0, 0, 0}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 28}, 
+# 1067 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1067 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1067 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1067 "./obj/main/SITL/settings_generated.c"
+                                                                                  max_angle_inclination[FD_ROLL]
+# 1067 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1067 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {221, 1, 0, 0, 0}, VAR_INT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 28}, 
+# 1068 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1068 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1068 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1068 "./obj/main/SITL/settings_generated.c"
+                                                                                  max_angle_inclination[FD_PITCH]
+# 1068 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1068 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+ { {70, 15, 19, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, 
+# 1069 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1069 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1069 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1069 "./obj/main/SITL/settings_generated.c"
+                                                                                   dterm_lpf_hz
+# 1069 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1069 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {70, 15, 14, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, 
+# 1070 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       __builtin_offsetof (
+# 1070 "./obj/main/SITL/settings_generated.c"
+                                                                                                       pidProfile_t
+# 1070 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       , 
+# 1070 "./obj/main/SITL/settings_generated.c"
+                                                                                                       dterm_lpf_type
+# 1070 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       ) 
+# 1070 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {70, 129, 1, 19, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, 
+# 1071 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1071 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1071 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1071 "./obj/main/SITL/settings_generated.c"
+                                                                                    dterm_lpf2_hz
+# 1071 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1071 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {70, 129, 1, 14, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FILTER_TYPE }, 
+# 1072 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 1072 "./obj/main/SITL/settings_generated.c"
+                                                                                                        pidProfile_t
+# 1072 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        , 
+# 1072 "./obj/main/SITL/settings_generated.c"
+                                                                                                        dterm_lpf2_type
+# 1072 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        ) 
+# 1072 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {6, 15, 19, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1073 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1073 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1073 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1073 "./obj/main/SITL/settings_generated.c"
+                                                                                 yaw_lpf_hz
+# 1073 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1073 "./obj/main/SITL/settings_generated.c"
+                                                                                                                    },
+ { {2, 54, 138, 1, 47}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {0, 8}, 
+# 1074 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1074 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1074 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1074 "./obj/main/SITL/settings_generated.c"
+                                                                                    fixedWingItermThrowLimit
+# 1074 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1074 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {2, 215, 1, 91, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DIRECTION }, 
+# 1075 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     __builtin_offsetof (
+# 1075 "./obj/main/SITL/settings_generated.c"
+                                                                                                     pidProfile_t
+# 1075 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     , 
+# 1075 "./obj/main/SITL/settings_generated.c"
+                                                                                                     loiter_direction
+# 1075 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     ) 
+# 1075 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {2, 144, 2, 145, 1}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 15}, 
+# 1076 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1076 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1076 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1076 "./obj/main/SITL/settings_generated.c"
+                                                                                    fixedWingReferenceAirspeed
+# 1076 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1076 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {195, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 22}, 
+# 1077 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1077 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1077 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1077 "./obj/main/SITL/settings_generated.c"
+                                                                                  fixedWingCoordinatedYawGain
+# 1077 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1077 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {193, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 5}, 
+# 1078 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1078 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1078 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1078 "./obj/main/SITL/settings_generated.c"
+                                                                                 fixedWingItermLimitOnStickPosition
+# 1078 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1078 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                            },
+ { {131, 1, 47, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, 
+# 1079 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1079 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1079 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1079 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidSumLimit
+# 1079 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1079 "./obj/main/SITL/settings_generated.c"
+                                                                                                                       },
+ { {131, 1, 47, 6, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, 
+# 1080 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1080 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1080 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1080 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidSumLimitYaw
+# 1080 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1080 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {54, 173, 2, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 27}, 
+# 1081 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1081 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1081 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1081 "./obj/main/SITL/settings_generated.c"
+                                                                                   itermWindupPointPercent
+# 1081 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1081 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {4, 61, 47, 10, 8}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 46}, 
+# 1082 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1082 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1082 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1082 "./obj/main/SITL/settings_generated.c"
+                                                                                    axisAccelerationLimitRollPitch
+# 1082 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1082 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {4, 61, 47, 6, 0}, VAR_UINT32 | PROFILE_VALUE, .config.minmax.indexes = {0, 46}, 
+# 1083 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1083 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1083 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1083 "./obj/main/SITL/settings_generated.c"
+                                                                                   axisAccelerationLimitYaw
+# 1083 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1083 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {94, 95, 4, 47, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 24}, 
+# 1084 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1084 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1084 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1084 "./obj/main/SITL/settings_generated.c"
+                                                                                   heading_hold_rate_limit
+# 1084 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1084 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 3, 9, 7, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1085 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1085 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1085 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1085 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_mc.pid[PID_POS_Z].P
+# 1085 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1085 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {1, 3, 38, 7, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1086 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1086 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1086 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1086 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_VEL_Z].P
+# 1086 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1086 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 3, 38, 7, 12}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1087 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1087 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1087 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1087 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_VEL_Z].I
+# 1087 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1087 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {1, 3, 38, 7, 17}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1088 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1088 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1088 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1088 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_VEL_Z].D
+# 1088 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1088 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {1, 3, 9, 27, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1089 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1089 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1089 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1089 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_POS_XY].P
+# 1089 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1089 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {1, 3, 38, 27, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1090 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1090 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1090 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1090 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_mc.pid[PID_VEL_XY].P
+# 1090 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1090 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 3, 38, 27, 12}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1091 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1091 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1091 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1091 "./obj/main/SITL/settings_generated.c"
+                                                                                  bank_mc.pid[PID_VEL_XY].I
+# 1091 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1091 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 3, 38, 27, 17}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1092 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1092 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1092 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1092 "./obj/main/SITL/settings_generated.c"
+                                                                                  bank_mc.pid[PID_VEL_XY].D
+# 1092 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1092 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 3, 38, 27, 71}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1093 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1093 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1093 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1093 "./obj/main/SITL/settings_generated.c"
+                                                                                  bank_mc.pid[PID_VEL_XY].FF
+# 1093 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1093 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {1, 3, 94, 5, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1094 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1094 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1094 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1094 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_mc.pid[PID_HEADING].P
+# 1094 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1094 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {244, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1095 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1095 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1095 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1095 "./obj/main/SITL/settings_generated.c"
+                                                                                 navVelXyDTermLpfHz
+# 1095 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1095 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {1, 2, 9, 7, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1096 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1096 "./obj/main/SITL/settings_generated.c"
+                                                                               pidProfile_t
+# 1096 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1096 "./obj/main/SITL/settings_generated.c"
+                                                                               bank_fw.pid[PID_POS_Z].P
+# 1096 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1096 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {1, 2, 9, 7, 12}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1097 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1097 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1097 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1097 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_POS_Z].I
+# 1097 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1097 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 2, 9, 7, 17}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1098 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1098 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1098 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1098 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_POS_Z].D
+# 1098 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1098 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 2, 9, 27, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1099 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1099 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1099 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1099 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_POS_XY].P
+# 1099 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1099 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {1, 2, 9, 27, 12}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1100 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1100 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1100 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1100 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_POS_XY].I
+# 1100 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1100 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 2, 9, 27, 17}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1101 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1101 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1101 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1101 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_POS_XY].D
+# 1101 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1101 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 2, 94, 5, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1102 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1102 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1102 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1102 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_HEADING].P
+# 1102 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1102 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 2, 9, 93, 5}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1103 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1103 "./obj/main/SITL/settings_generated.c"
+                                                                                pidProfile_t
+# 1103 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1103 "./obj/main/SITL/settings_generated.c"
+                                                                                bank_fw.pid[PID_POS_HEADING].P
+# 1103 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1103 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {1, 2, 9, 93, 12}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1104 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1104 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1104 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1104 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_POS_HEADING].I
+# 1104 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1104 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {1, 2, 9, 93, 17}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1105 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1105 "./obj/main/SITL/settings_generated.c"
+                                                                                 pidProfile_t
+# 1105 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1105 "./obj/main/SITL/settings_generated.c"
+                                                                                 bank_fw.pid[PID_POS_HEADING].D
+# 1105 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1105 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {236, 1, 0, 0, 0}, VAR_UINT16 | PROFILE_VALUE, .config.minmax.indexes = {1, 3}, 
+# 1106 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1106 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1106 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1106 "./obj/main/SITL/settings_generated.c"
+                                                                                  navFwPosHdgPidsumLimit
+# 1106 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1106 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {3, 54, 103, 14, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX_TYPE }, 
+# 1107 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             __builtin_offsetof (
+# 1107 "./obj/main/SITL/settings_generated.c"
+                                                                                                             pidProfile_t
+# 1107 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             , 
+# 1107 "./obj/main/SITL/settings_generated.c"
+                                                                                                             iterm_relax_type
+# 1107 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                             ) 
+# 1107 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                      },
+ { {3, 54, 103, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_ITERM_RELAX }, 
+# 1108 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       __builtin_offsetof (
+# 1108 "./obj/main/SITL/settings_generated.c"
+                                                                                                       pidProfile_t
+# 1108 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       , 
+# 1108 "./obj/main/SITL/settings_generated.c"
+                                                                                                       iterm_relax
+# 1108 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                       ) 
+# 1108 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {3, 54, 103, 67, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 1}, 
+# 1109 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1109 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1109 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1109 "./obj/main/SITL/settings_generated.c"
+                                                                                   iterm_relax_cutoff
+# 1109 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1109 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {17, 89, 122, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 33}, 
+# 1110 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1110 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1110 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1110 "./obj/main/SITL/settings_generated.c"
+                                                                                    dBoostFactor
+# 1110 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1110 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {165, 1, 0, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {3, 30}, 
+# 1111 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1111 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1111 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1111 "./obj/main/SITL/settings_generated.c"
+                                                                                  dBoostMaxAtAlleceleration
+# 1111 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1111 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {164, 1, 0, 0, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {7, 24}, 
+# 1112 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1112 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1112 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1112 "./obj/main/SITL/settings_generated.c"
+                                                                                  dBoostGyroDeltaLpfHz
+# 1112 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1112 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {85, 196, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 23}, 
+# 1113 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1113 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1113 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1113 "./obj/main/SITL/settings_generated.c"
+                                                                                   antigravityGain
+# 1113 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1113 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {85, 144, 1, 0, 0}, VAR_FLOAT | PROFILE_VALUE, .config.minmax.indexes = {5, 23}, 
+# 1114 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1114 "./obj/main/SITL/settings_generated.c"
+                                                                                   pidProfile_t
+# 1114 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1114 "./obj/main/SITL/settings_generated.c"
+                                                                                   antigravityAccelerator
+# 1114 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1114 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {85, 67, 15, 19, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {5, 25}, 
+# 1115 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1115 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidProfile_t
+# 1115 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1115 "./obj/main/SITL/settings_generated.c"
+                                                                                    antigravityCutoff
+# 1115 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1115 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {128, 2, 14, 0, 0}, VAR_UINT8 | PROFILE_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_PIDTYPETABLE }, 
+# 1116 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        __builtin_offsetof (
+# 1116 "./obj/main/SITL/settings_generated.c"
+                                                                                                        pidProfile_t
+# 1116 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        , 
+# 1116 "./obj/main/SITL/settings_generated.c"
+                                                                                                        pidControllerType
+# 1116 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                        ) 
+# 1116 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                  },
+ { {3, 65, 15, 19, 0}, VAR_UINT8 | PROFILE_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1117 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1117 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidProfile_t
+# 1117 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1117 "./obj/main/SITL/settings_generated.c"
+                                                                                  controlDerivativeLpfHz
+# 1117 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1117 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+
+ { {2, 86, 255, 1, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 8}, 
+# 1119 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1119 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidAutotuneConfig_t
+# 1119 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1119 "./obj/main/SITL/settings_generated.c"
+                                                                                    fw_overshoot_time
+# 1119 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1119 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {2, 86, 165, 2, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 8}, 
+# 1120 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1120 "./obj/main/SITL/settings_generated.c"
+                                                                                    pidAutotuneConfig_t
+# 1120 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1120 "./obj/main/SITL/settings_generated.c"
+                                                                                    fw_undershoot_time
+# 1120 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1120 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {2, 86, 32, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1121 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1121 "./obj/main/SITL/settings_generated.c"
+                                                                                pidAutotuneConfig_t
+# 1121 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1121 "./obj/main/SITL/settings_generated.c"
+                                                                                fw_max_rate_threshold
+# 1121 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1121 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {192, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1122 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1122 "./obj/main/SITL/settings_generated.c"
+                                                                                pidAutotuneConfig_t
+# 1122 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1122 "./obj/main/SITL/settings_generated.c"
+                                                                                fw_ff_to_p_gain
+# 1122 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1122 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {191, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 15}, 
+# 1123 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1123 "./obj/main/SITL/settings_generated.c"
+                                                                                  pidAutotuneConfig_t
+# 1123 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1123 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw_ff_to_i_time_constant
+# 1123 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1123 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+
+ { {13, 41, 25, 168, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1125 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 1125 "./obj/main/SITL/settings_generated.c"
+                                                                                                   positionEstimationConfig_t
+# 1125 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 1125 "./obj/main/SITL/settings_generated.c"
+                                                                                                   automatic_mag_declination
+# 1125 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 1125 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                   },
+ { {205, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1126 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1126 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1126 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1126 "./obj/main/SITL/settings_generated.c"
+                                                                                gravity_calibration_tolerance
+# 1126 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1126 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                    },
+ { {207, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1127 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1127 "./obj/main/SITL/settings_generated.c"
+                                                                                                positionEstimationConfig_t
+# 1127 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1127 "./obj/main/SITL/settings_generated.c"
+                                                                                                use_gps_velned
+# 1127 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1127 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                     },
+ { {204, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1128 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1128 "./obj/main/SITL/settings_generated.c"
+                                                                                                positionEstimationConfig_t
+# 1128 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1128 "./obj/main/SITL/settings_generated.c"
+                                                                                                allow_dead_reckoning
+# 1128 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1128 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                           },
+ { {13, 135, 1, 40, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, 
+# 1129 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 1129 "./obj/main/SITL/settings_generated.c"
+                                                                                                      positionEstimationConfig_t
+# 1129 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 1129 "./obj/main/SITL/settings_generated.c"
+                                                                                                      reset_altitude_type
+# 1129 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 1129 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                },
+ { {13, 135, 1, 72, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_RESET_TYPE }, 
+# 1130 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 1130 "./obj/main/SITL/settings_generated.c"
+                                                                                                      positionEstimationConfig_t
+# 1130 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 1130 "./obj/main/SITL/settings_generated.c"
+                                                                                                      reset_home_type
+# 1130 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 1130 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                            },
+ { {13, 28, 106, 40, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1131 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1131 "./obj/main/SITL/settings_generated.c"
+                                                                                    positionEstimationConfig_t
+# 1131 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1131 "./obj/main/SITL/settings_generated.c"
+                                                                                    max_surface_altitude
+# 1131 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1131 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                               },
+ { {13, 30, 7, 106, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1132 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1132 "./obj/main/SITL/settings_generated.c"
+                                                                                  positionEstimationConfig_t
+# 1132 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1132 "./obj/main/SITL/settings_generated.c"
+                                                                                  w_z_surface_p
+# 1132 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1132 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {13, 30, 7, 106, 110}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1133 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1133 "./obj/main/SITL/settings_generated.c"
+                                                                                    positionEstimationConfig_t
+# 1133 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1133 "./obj/main/SITL/settings_generated.c"
+                                                                                    w_z_surface_v
+# 1133 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1133 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {208, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1134 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1134 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1134 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1134 "./obj/main/SITL/settings_generated.c"
+                                                                                w_xy_flow_p
+# 1134 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1134 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {209, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1135 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1135 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1135 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1135 "./obj/main/SITL/settings_generated.c"
+                                                                                w_xy_flow_v
+# 1135 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1135 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {13, 30, 7, 51, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1136 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1136 "./obj/main/SITL/settings_generated.c"
+                                                                                 positionEstimationConfig_t
+# 1136 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1136 "./obj/main/SITL/settings_generated.c"
+                                                                                 w_z_baro_p
+# 1136 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1136 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {13, 30, 7, 23, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1137 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1137 "./obj/main/SITL/settings_generated.c"
+                                                                                 positionEstimationConfig_t
+# 1137 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1137 "./obj/main/SITL/settings_generated.c"
+                                                                                 w_z_gps_p
+# 1137 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1137 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {13, 30, 7, 23, 110}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1138 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1138 "./obj/main/SITL/settings_generated.c"
+                                                                                   positionEstimationConfig_t
+# 1138 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1138 "./obj/main/SITL/settings_generated.c"
+                                                                                   w_z_gps_v
+# 1138 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1138 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {13, 30, 27, 23, 5}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1139 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1139 "./obj/main/SITL/settings_generated.c"
+                                                                                  positionEstimationConfig_t
+# 1139 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1139 "./obj/main/SITL/settings_generated.c"
+                                                                                  w_xy_gps_p
+# 1139 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1139 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {13, 30, 27, 23, 110}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1140 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1140 "./obj/main/SITL/settings_generated.c"
+                                                                                    positionEstimationConfig_t
+# 1140 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1140 "./obj/main/SITL/settings_generated.c"
+                                                                                    w_xy_gps_v
+# 1140 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1140 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {212, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1141 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1141 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1141 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1141 "./obj/main/SITL/settings_generated.c"
+                                                                                w_z_res_v
+# 1141 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1141 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {210, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1142 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1142 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1142 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1142 "./obj/main/SITL/settings_generated.c"
+                                                                                w_xy_res_v
+# 1142 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1142 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {211, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, 
+# 1143 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1143 "./obj/main/SITL/settings_generated.c"
+                                                                                positionEstimationConfig_t
+# 1143 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1143 "./obj/main/SITL/settings_generated.c"
+                                                                                w_xyz_acc_p
+# 1143 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1143 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {13, 30, 16, 151, 1}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 5}, 
+# 1144 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1144 "./obj/main/SITL/settings_generated.c"
+                                                                                   positionEstimationConfig_t
+# 1144 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1144 "./obj/main/SITL/settings_generated.c"
+                                                                                   w_acc_bias
+# 1144 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1144 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {206, 1, 0, 0, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 45}, 
+# 1145 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1145 "./obj/main/SITL/settings_generated.c"
+                                                                                 positionEstimationConfig_t
+# 1145 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1145 "./obj/main/SITL/settings_generated.c"
+                                                                                 max_eph_epv
+# 1145 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1145 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {13, 51, 179, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {0, 45}, 
+# 1146 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1146 "./obj/main/SITL/settings_generated.c"
+                                                                                   positionEstimationConfig_t
+# 1146 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1146 "./obj/main/SITL/settings_generated.c"
+                                                                                   baro_epv
+# 1146 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1146 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+
+ { {1, 53, 253, 1, 74}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1148 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 1148 "./obj/main/SITL/settings_generated.c"
+                                                                                                  navConfig_t
+# 1148 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 1148 "./obj/main/SITL/settings_generated.c"
+                                                                                                  general.flags.disarm_on_landing
+# 1148 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 1148 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                         },
+ { {248, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1149 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1149 "./obj/main/SITL/settings_generated.c"
+                                                                                                navConfig_t
+# 1149 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1149 "./obj/main/SITL/settings_generated.c"
+                                                                                                general.flags.use_thr_mid_for_althold
+# 1149 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1149 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                             },
+ { {230, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_EXTRA_ARMING_SAFETY }, 
+# 1150 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1150 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 navConfig_t
+# 1150 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 , 
+# 1150 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 general.flags.extra_arming_safety
+# 1150 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 ) 
+# 1150 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                          },
+ { {1, 167, 2, 118, 56}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_USER_CONTROL_MODE }, 
+# 1151 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                  __builtin_offsetof (
+# 1151 "./obj/main/SITL/settings_generated.c"
+                                                                                                                  navConfig_t
+# 1151 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                  , 
+# 1151 "./obj/main/SITL/settings_generated.c"
+                                                                                                                  general.flags.user_control_mode
+# 1151 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                  ) 
+# 1151 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                         },
+ { {1, 135, 2, 82, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 7}, 
+# 1152 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1152 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1152 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1152 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.pos_failure_timeout
+# 1152 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1152 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 174, 2, 140, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 11}, 
+# 1153 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1153 "./obj/main/SITL/settings_generated.c"
+                                                                                    navConfig_t
+# 1153 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1153 "./obj/main/SITL/settings_generated.c"
+                                                                                    general.waypoint_radius
+# 1153 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1153 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {249, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 1154 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1154 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1154 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1154 "./obj/main/SITL/settings_generated.c"
+                                                                                  general.waypoint_safe_distance
+# 1154 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1154 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {1, 41, 49, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, 
+# 1155 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1155 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1155 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1155 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.max_auto_speed
+# 1155 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1155 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {1, 41, 42, 4, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, 
+# 1156 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1156 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1156 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1156 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.max_auto_climb_rate
+# 1156 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1156 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 36, 49, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, 
+# 1157 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1157 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1157 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1157 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.max_manual_speed
+# 1157 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1157 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 36, 42, 4, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 6}, 
+# 1158 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1158 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1158 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1158 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.max_manual_climb_rate
+# 1158 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1158 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {1, 74, 49, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, 
+# 1159 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1159 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1159 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1159 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.land_descent_rate
+# 1159 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1159 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {238, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {14, 3}, 
+# 1160 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1160 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1160 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1160 "./obj/main/SITL/settings_generated.c"
+                                                                                  general.land_slowdown_minalt
+# 1160 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1160 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {237, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {8, 68}, 
+# 1161 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1161 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1161 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1161 "./obj/main/SITL/settings_generated.c"
+                                                                                  general.land_slowdown_maxalt
+# 1161 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1161 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {1, 120, 74, 49, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 6}, 
+# 1162 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1162 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1162 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1162 "./obj/main/SITL/settings_generated.c"
+                                                                                   general.emerg_descent_rate
+# 1162 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1162 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {1, 26, 20, 69, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, 
+# 1163 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1163 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1163 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1163 "./obj/main/SITL/settings_generated.c"
+                                                                                   general.min_rth_distance
+# 1163 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1163 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {245, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1164 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1164 "./obj/main/SITL/settings_generated.c"
+                                                                                                navConfig_t
+# 1164 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1164 "./obj/main/SITL/settings_generated.c"
+                                                                                                general.flags.auto_overrides_motor_stop
+# 1164 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1164 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                               },
+ { {1, 20, 42, 182, 1}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1165 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  __builtin_offsetof (
+# 1165 "./obj/main/SITL/settings_generated.c"
+                                                                                                  navConfig_t
+# 1165 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  , 
+# 1165 "./obj/main/SITL/settings_generated.c"
+                                                                                                  general.flags.rth_climb_first
+# 1165 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                  ) 
+# 1165 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                       },
+ { {1, 20, 42, 97, 120}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1166 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   __builtin_offsetof (
+# 1166 "./obj/main/SITL/settings_generated.c"
+                                                                                                   navConfig_t
+# 1166 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   , 
+# 1166 "./obj/main/SITL/settings_generated.c"
+                                                                                                   general.flags.rth_climb_ignore_emerg
+# 1166 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                   ) 
+# 1166 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                               },
+ { {246, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1167 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1167 "./obj/main/SITL/settings_generated.c"
+                                                                                                navConfig_t
+# 1167 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1167 "./obj/main/SITL/settings_generated.c"
+                                                                                                general.flags.rth_tail_first
+# 1167 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1167 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                    },
+ { {1, 20, 146, 1, 74}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALLOW_LANDING }, 
+# 1168 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1168 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 navConfig_t
+# 1168 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 , 
+# 1168 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 general.flags.rth_allow_landing
+# 1168 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 ) 
+# 1168 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                        },
+ { {1, 20, 114, 56, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_NAV_RTH_ALT_MODE }, 
+# 1169 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            __builtin_offsetof (
+# 1169 "./obj/main/SITL/settings_generated.c"
+                                                                                                            navConfig_t
+# 1169 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            , 
+# 1169 "./obj/main/SITL/settings_generated.c"
+                                                                                                            general.flags.rth_alt_control_mode
+# 1169 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                            ) 
+# 1169 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                      },
+ { {1, 20, 142, 1, 32}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 1170 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1170 "./obj/main/SITL/settings_generated.c"
+                                                                                    navConfig_t
+# 1170 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1170 "./obj/main/SITL/settings_generated.c"
+                                                                                    general.rth_abort_threshold
+# 1170 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1170 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {239, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1171 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1171 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1171 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1171 "./obj/main/SITL/settings_generated.c"
+                                                                                 general.max_terrain_follow_altitude
+# 1171 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1171 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                            },
+ { {1, 20, 40, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 1172 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1172 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1172 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1172 "./obj/main/SITL/settings_generated.c"
+                                                                                  general.rth_altitude
+# 1172 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1172 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {1, 20, 72, 40, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 1173 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1173 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1173 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1173 "./obj/main/SITL/settings_generated.c"
+                                                                                   general.rth_home_altitude
+# 1173 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1173 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 20, 72, 57, 69}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 19}, 
+# 1174 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1174 "./obj/main/SITL/settings_generated.c"
+                                                                                    navConfig_t
+# 1174 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1174 "./obj/main/SITL/settings_generated.c"
+                                                                                    general.rth_home_offset_distance
+# 1174 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1174 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                            },
+ { {1, 20, 72, 57, 91}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 64}, 
+# 1175 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1175 "./obj/main/SITL/settings_generated.c"
+                                                                                    navConfig_t
+# 1175 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1175 "./obj/main/SITL/settings_generated.c"
+                                                                                    general.rth_home_offset_direction
+# 1175 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1175 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                             },
+ { {1, 3, 87, 22, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {36, 38}, 
+# 1176 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1176 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1176 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1176 "./obj/main/SITL/settings_generated.c"
+                                                                                  mc.max_bank_angle
+# 1176 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1176 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 3, 202, 1, 29}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1177 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1177 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1177 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1177 "./obj/main/SITL/settings_generated.c"
+                                                                                  mc.hover_throttle
+# 1177 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1177 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 3, 41, 53, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 11}, 
+# 1178 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1178 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1178 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1178 "./obj/main/SITL/settings_generated.c"
+                                                                                   mc.auto_disarm_delay
+# 1178 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1178 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {1, 3, 52, 49, 32}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1179 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1179 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1179 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1179 "./obj/main/SITL/settings_generated.c"
+                                                                                  mc.braking_speed_threshold
+# 1179 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1179 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {242, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1180 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1180 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1180 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1180 "./obj/main/SITL/settings_generated.c"
+                                                                                 mc.braking_disengage_speed
+# 1180 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1180 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {1, 3, 52, 82, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 15}, 
+# 1181 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1181 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1181 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1181 "./obj/main/SITL/settings_generated.c"
+                                                                                  mc.braking_timeout
+# 1181 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1181 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {1, 3, 52, 89, 122}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 2}, 
+# 1182 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1182 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1182 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1182 "./obj/main/SITL/settings_generated.c"
+                                                                                  mc.braking_boost_factor
+# 1182 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1182 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 3, 52, 89, 82}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, 
+# 1183 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1183 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1183 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1183 "./obj/main/SITL/settings_generated.c"
+                                                                                   mc.braking_boost_timeout
+# 1183 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1183 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {241, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 3}, 
+# 1184 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1184 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1184 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1184 "./obj/main/SITL/settings_generated.c"
+                                                                                 mc.braking_boost_speed_threshold
+# 1184 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1184 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {240, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1185 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1185 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1185 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1185 "./obj/main/SITL/settings_generated.c"
+                                                                                 mc.braking_boost_disengage_speed
+# 1185 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1185 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                         },
+ { {1, 3, 52, 87, 22}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {36, 39}, 
+# 1186 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1186 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1186 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1186 "./obj/main/SITL/settings_generated.c"
+                                                                                   mc.braking_bank_angle
+# 1186 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1186 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {243, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1187 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1187 "./obj/main/SITL/settings_generated.c"
+                                                                                navConfig_t
+# 1187 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1187 "./obj/main/SITL/settings_generated.c"
+                                                                                mc.posDecelerationTime
+# 1187 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1187 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {1, 3, 9, 43, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1188 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1188 "./obj/main/SITL/settings_generated.c"
+                                                                               navConfig_t
+# 1188 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1188 "./obj/main/SITL/settings_generated.c"
+                                                                               mc.posResponseExpo
+# 1188 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1188 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {1, 2, 66, 29, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1189 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1189 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1189 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1189 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.cruise_throttle
+# 1189 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1189 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 2, 26, 29, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1190 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1190 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1190 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1190 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.min_throttle
+# 1190 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1190 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {1, 2, 28, 29, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1191 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1191 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1191 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1191 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.max_throttle
+# 1191 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1191 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {1, 2, 87, 22, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 26}, 
+# 1192 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1192 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1192 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1192 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.max_bank_angle
+# 1192 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1192 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 2, 42, 22, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 26}, 
+# 1193 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1193 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1193 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1193 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.max_climb_angle
+# 1193 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1193 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {1, 2, 175, 1, 22}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 26}, 
+# 1194 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1194 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1194 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1194 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.max_dive_angle
+# 1194 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1194 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {1, 2, 132, 2, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1195 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1195 "./obj/main/SITL/settings_generated.c"
+                                                                                navConfig_t
+# 1195 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1195 "./obj/main/SITL/settings_generated.c"
+                                                                                fw.pitch_to_throttle
+# 1195 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1195 "./obj/main/SITL/settings_generated.c"
+                                                                                                                            },
+ { {235, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, 
+# 1196 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1196 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1196 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1196 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.loiter_radius
+# 1196 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1196 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {1, 2, 66, 49, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1197 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1197 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1197 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1197 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.cruise_speed
+# 1197 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1197 "./obj/main/SITL/settings_generated.c"
+                                                                                                                        },
+ { {1, 2, 118, 155, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 56}, 
+# 1198 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1198 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1198 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1198 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.control_smoothness
+# 1198 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1198 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {232, 1, 0, 0, 0}, VAR_INT8 | MASTER_VALUE, .config.minmax.indexes = {54, 23}, 
+# 1199 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1199 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1199 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1199 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.land_dive_angle
+# 1199 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1199 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 2, 24, 169, 2}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {1, 11}, 
+# 1200 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1200 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1200 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1200 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_velocity_thresh
+# 1200 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1200 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 2, 24, 61, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 71}, 
+# 1201 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1201 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1201 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1201 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.launch_accel_thresh
+# 1201 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1201 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {1, 2, 24, 28, 22}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 17}, 
+# 1202 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1202 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1202 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1202 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_max_angle
+# 1202 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1202 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {233, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 3}, 
+# 1203 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1203 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1203 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1203 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.launch_time_thresh
+# 1203 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1203 "./obj/main/SITL/settings_generated.c"
+                                                                                                                              },
+ { {1, 2, 24, 29, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1204 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1204 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1204 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1204 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.launch_throttle
+# 1204 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1204 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 2, 24, 96, 29}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {3, 6}, 
+# 1205 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1205 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1205 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1205 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.launch_idle_throttle
+# 1205 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1205 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 2, 24, 37, 34}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 15}, 
+# 1206 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1206 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1206 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1206 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_motor_timer
+# 1206 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1206 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {234, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 3}, 
+# 1207 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1207 "./obj/main/SITL/settings_generated.c"
+                                                                                 navConfig_t
+# 1207 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1207 "./obj/main/SITL/settings_generated.c"
+                                                                                 fw.launch_motor_spinup_time
+# 1207 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1207 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {1, 2, 24, 26, 33}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 31}, 
+# 1208 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1208 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1208 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1208 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_min_time
+# 1208 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1208 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+ { {1, 2, 24, 82, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 31}, 
+# 1209 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1209 "./obj/main/SITL/settings_generated.c"
+                                                                                  navConfig_t
+# 1209 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1209 "./obj/main/SITL/settings_generated.c"
+                                                                                  fw.launch_timeout
+# 1209 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1209 "./obj/main/SITL/settings_generated.c"
+                                                                                                                           },
+ { {1, 2, 24, 28, 40}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 31}, 
+# 1210 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1210 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1210 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1210 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_max_altitude
+# 1210 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1210 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {1, 2, 24, 42, 22}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {10, 38}, 
+# 1211 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1211 "./obj/main/SITL/settings_generated.c"
+                                                                                   navConfig_t
+# 1211 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1211 "./obj/main/SITL/settings_generated.c"
+                                                                                   fw.launch_climb_angle
+# 1211 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1211 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+ { {1, 2, 66, 6, 4}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 39}, 
+# 1212 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1212 "./obj/main/SITL/settings_generated.c"
+                                                                                navConfig_t
+# 1212 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1212 "./obj/main/SITL/settings_generated.c"
+                                                                                fw.cruise_yaw_rate
+# 1212 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1212 "./obj/main/SITL/settings_generated.c"
+                                                                                                                          },
+ { {231, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1213 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1213 "./obj/main/SITL/settings_generated.c"
+                                                                                                navConfig_t
+# 1213 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1213 "./obj/main/SITL/settings_generated.c"
+                                                                                                fw.allow_manual_thr_increase
+# 1213 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1213 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                    },
+ { {247, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1214 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1214 "./obj/main/SITL/settings_generated.c"
+                                                                                                navConfig_t
+# 1214 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1214 "./obj/main/SITL/settings_generated.c"
+                                                                                                fw.useFwNavYawControl
+# 1214 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1214 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                             },
+ { {1, 2, 6, 31, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 27}, 
+# 1215 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1215 "./obj/main/SITL/settings_generated.c"
+                                                                                navConfig_t
+# 1215 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1215 "./obj/main/SITL/settings_generated.c"
+                                                                                fw.yawControlDeadband
+# 1215 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1215 "./obj/main/SITL/settings_generated.c"
+                                                                                                                             },
+
+ { {81, 107, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1217 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 __builtin_offsetof (
+# 1217 "./obj/main/SITL/settings_generated.c"
+                                                                                                 telemetryConfig_t
+# 1217 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 , 
+# 1217 "./obj/main/SITL/settings_generated.c"
+                                                                                                 telemetry_switch
+# 1217 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                 ) 
+# 1217 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                               },
+ { {81, 98, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1218 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1218 "./obj/main/SITL/settings_generated.c"
+                                                                                                telemetryConfig_t
+# 1218 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1218 "./obj/main/SITL/settings_generated.c"
+                                                                                                telemetry_inverted
+# 1218 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1218 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {44, 119, 214, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {53, 27}, 
+# 1219 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1219 "./obj/main/SITL/settings_generated.c"
+                                                                                     telemetryConfig_t
+# 1219 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1219 "./obj/main/SITL/settings_generated.c"
+                                                                                     gpsNoFixLatitude
+# 1219 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1219 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {44, 119, 216, 1, 0}, VAR_FLOAT | MASTER_VALUE, .config.minmax.indexes = {52, 17}, 
+# 1220 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1220 "./obj/main/SITL/settings_generated.c"
+                                                                                     telemetryConfig_t
+# 1220 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1220 "./obj/main/SITL/settings_generated.c"
+                                                                                     gpsNoFixLongitude
+# 1220 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1220 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {44, 162, 1, 187, 1}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, 
+# 1221 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1221 "./obj/main/SITL/settings_generated.c"
+                                                                                   telemetryConfig_t
+# 1221 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1221 "./obj/main/SITL/settings_generated.c"
+                                                                                   frsky_coordinate_format
+# 1221 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1221 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {44, 109, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_FRSKY_UNIT }, 
+# 1222 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     __builtin_offsetof (
+# 1222 "./obj/main/SITL/settings_generated.c"
+                                                                                                     telemetryConfig_t
+# 1222 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     , 
+# 1222 "./obj/main/SITL/settings_generated.c"
+                                                                                                     frsky_unit
+# 1222 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     ) 
+# 1222 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                             },
+ { {44, 170, 2, 136, 2}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 5}, 
+# 1223 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1223 "./obj/main/SITL/settings_generated.c"
+                                                                                   telemetryConfig_t
+# 1223 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1223 "./obj/main/SITL/settings_generated.c"
+                                                                                   frsky_vfas_precision
+# 1223 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1223 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {44, 8, 10, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1224 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1224 "./obj/main/SITL/settings_generated.c"
+                                                                                                telemetryConfig_t
+# 1224 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1224 "./obj/main/SITL/settings_generated.c"
+                                                                                                frsky_pitch_roll
+# 1224 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1224 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {145, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1225 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1225 "./obj/main/SITL/settings_generated.c"
+                                                                                                telemetryConfig_t
+# 1225 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1225 "./obj/main/SITL/settings_generated.c"
+                                                                                                report_cell_voltage
+# 1225 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1225 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                 },
+ { {201, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 40}, 
+# 1226 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1226 "./obj/main/SITL/settings_generated.c"
+                                                                                 telemetryConfig_t
+# 1226 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1226 "./obj/main/SITL/settings_generated.c"
+                                                                                 hottAlarmSoundInterval
+# 1226 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1226 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {81, 92, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1227 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1227 "./obj/main/SITL/settings_generated.c"
+                                                                                                telemetryConfig_t
+# 1227 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1227 "./obj/main/SITL/settings_generated.c"
+                                                                                                halfDuplex
+# 1227 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1227 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {154, 2, 190, 1, 109}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_SMARTPORT_FUEL_UNIT }, 
+# 1228 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 __builtin_offsetof (
+# 1228 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 telemetryConfig_t
+# 1228 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 , 
+# 1228 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 smartportFuelUnit
+# 1228 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                 ) 
+# 1228 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                },
+ { {203, 1, 81, 14, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1229 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1229 "./obj/main/SITL/settings_generated.c"
+                                                                                  telemetryConfig_t
+# 1229 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1229 "./obj/main/SITL/settings_generated.c"
+                                                                                  ibusTelemetryType
+# 1229 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1229 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {218, 1, 166, 2, 4}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LTM_RATES }, 
+# 1230 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     __builtin_offsetof (
+# 1230 "./obj/main/SITL/settings_generated.c"
+                                                                                                     telemetryConfig_t
+# 1230 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     , 
+# 1230 "./obj/main/SITL/settings_generated.c"
+                                                                                                     ltmUpdateRate
+# 1230 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                     ) 
+# 1230 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                },
+ { {151, 2, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 37}, 
+# 1231 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1231 "./obj/main/SITL/settings_generated.c"
+                                                                                  telemetryConfig_t
+# 1231 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1231 "./obj/main/SITL/settings_generated.c"
+                                                                                  simGroundStationNumber
+# 1231 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1231 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                      },
+ { {80, 130, 2, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 20}, 
+# 1232 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1232 "./obj/main/SITL/settings_generated.c"
+                                                                                   telemetryConfig_t
+# 1232 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1232 "./obj/main/SITL/settings_generated.c"
+                                                                                   simPin
+# 1232 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1232 "./obj/main/SITL/settings_generated.c"
+                                                                                                                       },
+ { {80, 140, 1, 125, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {7, 9}, 
+# 1233 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1233 "./obj/main/SITL/settings_generated.c"
+                                                                                    telemetryConfig_t
+# 1233 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1233 "./obj/main/SITL/settings_generated.c"
+                                                                                    simTransmitInterval
+# 1233 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1233 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+ { {80, 140, 1, 184, 1}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 10}, 
+# 1234 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1234 "./obj/main/SITL/settings_generated.c"
+                                                                                     telemetryConfig_t
+# 1234 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1234 "./obj/main/SITL/settings_generated.c"
+                                                                                     simTransmitFlags
+# 1234 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1234 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                   },
+ { {16, 121, 32, 124, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1235 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1235 "./obj/main/SITL/settings_generated.c"
+                                                                                     telemetryConfig_t
+# 1235 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1235 "./obj/main/SITL/settings_generated.c"
+                                                                                     accEventThresholdHigh
+# 1235 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1235 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {16, 121, 32, 55, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 28}, 
+# 1236 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1236 "./obj/main/SITL/settings_generated.c"
+                                                                                     telemetryConfig_t
+# 1236 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1236 "./obj/main/SITL/settings_generated.c"
+                                                                                     accEventThresholdLow
+# 1236 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1236 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {143, 1, 0, 0, 0}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 9}, 
+# 1237 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1237 "./obj/main/SITL/settings_generated.c"
+                                                                                 telemetryConfig_t
+# 1237 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1237 "./obj/main/SITL/settings_generated.c"
+                                                                                 accEventThresholdNegX
+# 1237 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1237 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                    },
+ { {80, 55, 40, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {13, 12}, 
+# 1238 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1238 "./obj/main/SITL/settings_generated.c"
+                                                                                   telemetryConfig_t
+# 1238 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1238 "./obj/main/SITL/settings_generated.c"
+                                                                                   simLowAltitude
+# 1238 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1238 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {220, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1239 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1239 "./obj/main/SITL/settings_generated.c"
+                                                                                telemetryConfig_t
+# 1239 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1239 "./obj/main/SITL/settings_generated.c"
+                                                                                mavlink.extended_status_rate
+# 1239 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1239 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+ { {75, 48, 115, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1240 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1240 "./obj/main/SITL/settings_generated.c"
+                                                                                  telemetryConfig_t
+# 1240 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1240 "./obj/main/SITL/settings_generated.c"
+                                                                                  mavlink.rc_channels_rate
+# 1240 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1240 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                        },
+ { {75, 9, 4, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1241 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               __builtin_offsetof (
+# 1241 "./obj/main/SITL/settings_generated.c"
+                                                                               telemetryConfig_t
+# 1241 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               , 
+# 1241 "./obj/main/SITL/settings_generated.c"
+                                                                               mavlink.position_rate
+# 1241 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                               ) 
+# 1241 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {75, 180, 1, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1242 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1242 "./obj/main/SITL/settings_generated.c"
+                                                                                 telemetryConfig_t
+# 1242 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1242 "./obj/main/SITL/settings_generated.c"
+                                                                                 mavlink.extra1_rate
+# 1242 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1242 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+ { {75, 181, 1, 4, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 4}, 
+# 1243 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1243 "./obj/main/SITL/settings_generated.c"
+                                                                                 telemetryConfig_t
+# 1243 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1243 "./obj/main/SITL/settings_generated.c"
+                                                                                 mavlink.extra2_rate
+# 1243 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1243 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+
+ { {166, 1, 56, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_DEBUG_MODES }, 
+# 1245 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 1245 "./obj/main/SITL/settings_generated.c"
+                                                                                                      systemConfig_t
+# 1245 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 1245 "./obj/main/SITL/settings_generated.c"
+                                                                                                      debug_mode
+# 1245 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 1245 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                           },
+ { {158, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 1}, 
+# 1246 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                __builtin_offsetof (
+# 1246 "./obj/main/SITL/settings_generated.c"
+                                                                                systemConfig_t
+# 1246 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                , 
+# 1246 "./obj/main/SITL/settings_generated.c"
+                                                                                throttle_tilt_compensation_strength
+# 1246 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                ) 
+# 1246 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                              },
+ { {229, 1, 0, 0, 0}, VAR_STRING | MASTER_VALUE, .config.minmax.indexes = {0, 37}, 
+# 1247 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1247 "./obj/main/SITL/settings_generated.c"
+                                                                                  systemConfig_t
+# 1247 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1247 "./obj/main/SITL/settings_generated.c"
+                                                                                  name
+# 1247 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1247 "./obj/main/SITL/settings_generated.c"
+                                                                                                                 },
+
+ { {227, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_AUX_OPERATOR }, 
+# 1249 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      __builtin_offsetof (
+# 1249 "./obj/main/SITL/settings_generated.c"
+                                                                                                      modeActivationOperatorConfig_t
+# 1249 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      , 
+# 1249 "./obj/main/SITL/settings_generated.c"
+                                                                                                      modeActivationOperator
+# 1249 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                      ) 
+# 1249 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                                       },
+
+ { {105, 0, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1251 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1251 "./obj/main/SITL/settings_generated.c"
+                                                                                                statsConfig_t
+# 1251 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1251 "./obj/main/SITL/settings_generated.c"
+                                                                                                stats_enabled
+# 1251 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1251 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                       },
+ { {105, 139, 1, 33, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 47}, 
+# 1252 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1252 "./obj/main/SITL/settings_generated.c"
+                                                                                     statsConfig_t
+# 1252 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1252 "./obj/main/SITL/settings_generated.c"
+                                                                                     stats_total_time
+# 1252 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1252 "./obj/main/SITL/settings_generated.c"
+                                                                                                                               },
+ { {105, 139, 1, 174, 1}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 47}, 
+# 1253 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 1253 "./obj/main/SITL/settings_generated.c"
+                                                                                      statsConfig_t
+# 1253 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 1253 "./obj/main/SITL/settings_generated.c"
+                                                                                      stats_total_dist
+# 1253 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 1253 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                },
+
+ { {162, 2, 57, 0, 0}, VAR_INT16 | MASTER_VALUE, .config.minmax.indexes = {50, 67}, 
+# 1255 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   __builtin_offsetof (
+# 1255 "./obj/main/SITL/settings_generated.c"
+                                                                                   timeConfig_t
+# 1255 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   , 
+# 1255 "./obj/main/SITL/settings_generated.c"
+                                                                                   tz_offset
+# 1255 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                   ) 
+# 1255 "./obj/main/SITL/settings_generated.c"
+                                                                                                                     },
+ { {163, 2, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_TZ_AUTOMATIC_DST }, 
+# 1256 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          __builtin_offsetof (
+# 1256 "./obj/main/SITL/settings_generated.c"
+                                                                                                          timeConfig_t
+# 1256 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          , 
+# 1256 "./obj/main/SITL/settings_generated.c"
+                                                                                                          tz_automatic_dst
+# 1256 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                          ) 
+# 1256 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                   },
+
+ { {173, 1, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1258 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1258 "./obj/main/SITL/settings_generated.c"
+                                                                                                displayConfig_t
+# 1258 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1258 "./obj/main/SITL/settings_generated.c"
+                                                                                                force_sw_blink
+# 1258 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1258 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                          },
+
+ { {39, 92, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_OFF_ON }, 
+# 1260 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                __builtin_offsetof (
+# 1260 "./obj/main/SITL/settings_generated.c"
+                                                                                                vtxConfig_t
+# 1260 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                , 
+# 1260 "./obj/main/SITL/settings_generated.c"
+                                                                                                halfDuplex
+# 1260 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                ) 
+# 1260 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                  },
+
+ { {39, 148, 1, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {0, 10}, 
+# 1262 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1262 "./obj/main/SITL/settings_generated.c"
+                                                                                  vtxSettingsConfig_t
+# 1262 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1262 "./obj/main/SITL/settings_generated.c"
+                                                                                  band
+# 1262 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1262 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {39, 116, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 20}, 
+# 1263 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  __builtin_offsetof (
+# 1263 "./obj/main/SITL/settings_generated.c"
+                                                                                  vtxSettingsConfig_t
+# 1263 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  , 
+# 1263 "./obj/main/SITL/settings_generated.c"
+                                                                                  channel
+# 1263 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                  ) 
+# 1263 "./obj/main/SITL/settings_generated.c"
+                                                                                                                         },
+ { {39, 58, 0, 0, 0}, VAR_UINT8 | MASTER_VALUE, .config.minmax.indexes = {5, 10}, 
+# 1264 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 __builtin_offsetof (
+# 1264 "./obj/main/SITL/settings_generated.c"
+                                                                                 vtxSettingsConfig_t
+# 1264 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 , 
+# 1264 "./obj/main/SITL/settings_generated.c"
+                                                                                 power
+# 1264 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                 ) 
+# 1264 "./obj/main/SITL/settings_generated.c"
+                                                                                                                      },
+ { {39, 55, 58, 53, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_VTX_LOW_POWER_DISARM }, 
+# 1265 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                __builtin_offsetof (
+# 1265 "./obj/main/SITL/settings_generated.c"
+                                                                                                                vtxSettingsConfig_t
+# 1265 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                , 
+# 1265 "./obj/main/SITL/settings_generated.c"
+                                                                                                                lowPowerDisarm
+# 1265 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                                ) 
+# 1265 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                                              },
+ { {39, 131, 2, 56, 115}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {5, 20}, 
+# 1266 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      __builtin_offsetof (
+# 1266 "./obj/main/SITL/settings_generated.c"
+                                                                                      vtxSettingsConfig_t
+# 1266 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      , 
+# 1266 "./obj/main/SITL/settings_generated.c"
+                                                                                      pitModeChan
+# 1266 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                      ) 
+# 1266 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {39, 28, 58, 254, 1}, VAR_UINT16 | MASTER_VALUE, .config.minmax.indexes = {0, 11}, 
+# 1267 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     __builtin_offsetof (
+# 1267 "./obj/main/SITL/settings_generated.c"
+                                                                                     vtxSettingsConfig_t
+# 1267 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     , 
+# 1267 "./obj/main/SITL/settings_generated.c"
+                                                                                     maxPowerOverride
+# 1267 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                     ) 
+# 1267 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                     },
+
+ { {128, 1, 35, 0, 0}, VAR_UINT8 | MASTER_VALUE | MODE_LOOKUP, .config.lookup = { TABLE_LOG_LEVEL }, 
+# 1269 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    __builtin_offsetof (
+# 1269 "./obj/main/SITL/settings_generated.c"
+                                                                                                    logConfig_t
+# 1269 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    , 
+# 1269 "./obj/main/SITL/settings_generated.c"
+                                                                                                    level
+# 1269 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                                    ) 
+# 1269 "./obj/main/SITL/settings_generated.c"
+                                                                                                                                 },
+ { {128, 1, 160, 2, 0}, VAR_UINT32 | MASTER_VALUE, .config.minmax.indexes = {0, 21}, 
+# 1270 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    __builtin_offsetof (
+# 1270 "./obj/main/SITL/settings_generated.c"
+                                                                                    logConfig_t
+# 1270 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    , 
+# 1270 "./obj/main/SITL/settings_generated.c"
+                                                                                    topics
+# 1270 "./obj/main/SITL/settings_generated.c" 3 4
+                                                                                    ) 
+# 1270 "./obj/main/SITL/settings_generated.c"
+                                                                                                                  },
+};
+#define SETTING_NAME_HASH_BUCKETS 147
+static const uint8_t settingNameHashSeeds[] = {
+ 26, 7, 1, 3, 1, 20, 11, 61, 7, 6, 11, 1, 11, 2, 0, 1,
+ 17, 15, 2, 5, 3, 0, 4, 16, 1, 4, 1, 11, 17, 10, 28, 1,
+ 5, 14, 3, 5, 5, 35, 9, 5, 3, 6, 9, 2, 35, 2, 6, 0,
+ 10, 0, 20, 0, 7, 1, 18, 1, 74, 6, 12, 1, 6, 53, 39, 38,
+ 6, 3, 1, 0, 3, 42, 33, 8, 18, 75, 15, 25, 65, 89, 45, 59,
+ 1, 10, 2, 13, 7, 0, 124, 12, 115, 3, 15, 14, 76, 52, 48, 6,
+ 90, 45, 1, 10, 0, 132, 110, 73, 2, 29, 14, 11, 0, 0, 166, 83,
+ 0, 14, 32, 1, 0, 36, 17, 2, 58, 1, 0, 1, 13, 4, 108, 9,
+ 17, 15, 28, 130, 4, 37, 137, 16, 25, 122, 1, 116, 1, 1, 52, 20,
+ 14, 11, 74,
+};
+static const uint16_t settingNameHashIndexes[] = {
+ 83, 87, 223, 234, 50, 148, 328, 254, 156, 42, 303, 84, 292, 21, 210, 95,
+ 70, 256, 48, 322, 245, 111, 106, 125, 307, 309, 115, 212, 157, 117, 191, 243,
+ 100, 297, 17, 103, 310, 54, 343, 364, 183, 319, 130, 43, 25, 65, 28, 31,
+ 180, 72, 153, 36, 108, 296, 190, 376, 204, 35, 224, 113, 179, 181, 192, 314,
+ 4, 239, 154, 12, 253, 267, 375, 247, 13, 20, 165, 358, 331, 206, 5, 24,
+ 306, 266, 186, 73, 151, 137, 152, 149, 360, 58, 347, 49, 332, 356, 369, 241,
+ 325, 341, 143, 127, 287, 283, 57, 285, 229, 105, 342, 323, 320, 344, 252, 76,
+ 164, 114, 278, 340, 27, 96, 311, 44, 140, 0, 195, 9, 334, 198, 6, 178,
+ 102, 168, 16, 354, 339, 242, 269, 132, 226, 218, 231, 225, 363, 62, 150, 91,
+ 207, 59, 281, 235, 263, 15, 337, 367, 273, 294, 250, 335, 52, 155, 33, 284,
+ 216, 321, 346, 348, 209, 22, 196, 163, 118, 61, 166, 133, 219, 86, 312, 227,
+ 122, 41, 372, 249, 316, 202, 293, 34, 313, 26, 276, 258, 81, 213, 279, 107,
+ 11, 228, 214, 333, 200, 99, 244, 145, 240, 128, 371, 14, 300, 265, 221, 47,
+ 104, 261, 67, 237, 8, 158, 101, 290, 378, 377, 366, 32, 268, 177, 355, 135,
+ 299, 112, 187, 246, 66, 131, 259, 142, 272, 349, 188, 64, 30, 160, 94, 56,
+ 170, 146, 315, 23, 295, 257, 184, 71, 136, 359, 90, 194, 205, 362, 238, 288,
+ 327, 291, 338, 2, 10, 353, 336, 185, 351, 176, 159, 345, 19, 233, 236, 93,
+ 123, 330, 162, 275, 29, 161, 255, 174, 373, 232, 167, 317, 109, 39, 302, 88,
+ 277, 173, 318, 251, 110, 304, 217, 40, 85, 1, 326, 69, 324, 301, 51, 201,
+ 141, 46, 63, 305, 74, 172, 116, 120, 352, 357, 286, 169, 329, 248, 208, 211,
+ 144, 7, 220, 3, 38, 199, 119, 189, 264, 121, 139, 75, 45, 60, 350, 230,
+ 280, 126, 55, 98, 124, 222, 80, 175, 53, 129, 361, 282, 368, 262, 37, 138,
+ 374, 215, 203, 193, 298, 78, 134, 171, 308, 274, 77, 197, 271, 82, 270, 182,
+ 92, 147, 89, 79, 365, 18, 260, 370, 68, 97, 289,
+};
+# 14 "./src/main/fc/settings.c" 2
+
+static 
+# 15 "./src/main/fc/settings.c" 3 4
+      _Bool 
+# 15 "./src/main/fc/settings.c"
+           settingGetWord(char *buf, int idx)
+{
+ if (idx == 0) {
+  return 
+# 18 "./src/main/fc/settings.c" 3 4
+        0
+# 18 "./src/main/fc/settings.c"
+             ;
+ }
+ const uint8_t *ptr = settingNamesWords;
+ char *bufPtr = buf;
+ int used_bits = 0;
+ int word = 1;
+ for(;;) {
+  int shift = 8 - 5 - used_bits;
+  char chr;
+  if (shift > 0) {
+   chr = (*ptr >> shift) & (0xff >> (8 - 5));
+  } else {
+   chr = (*ptr & (0xff >> (8 - (5 + shift)))) << -shift;
+   ptr++;
+   chr |= (*ptr) >> (8 + shift);
+  }
+  if (word == idx) {
+   if (chr == 0) {
+
+    *bufPtr++ = '\0';
+    break;
+   }
+   char c;
+   if (chr < 27) {
+    c = 'a' + (chr - 1);
+   } else {
+    c = wordSymbols[chr - 27];
+   }
+   *bufPtr++ = c;
+  } else {
+   if (chr == 0) {
+
+    word++;
+   }
+  }
+  used_bits = (used_bits + 5) % 8;
+ }
+ return 
+# 55 "./src/main/fc/settings.c" 3 4
+       1
+# 55 "./src/main/fc/settings.c"
+           ;
+}
+
+void settingGetName(const setting_t *val, char *buf)
+{
+ uint8_t bpos = 0;
+ uint16_t n = 0;
+ char word[37];
+
+ uint8_t shift = 0;
+
+ for (uint8_t ii = 0; ii < 5; ii++) {
+
+
+
+
+  uint16_t b = val->encoded_name[ii];
+  if (b >= 0x80) {
+
+   n |= (b&0x7f) << shift;
+   shift += 7;
+   continue;
+  }
+
+  n |= b << shift;
+
+  if (!settingGetWord(word, n)) {
+
+   break;
+  }
+  if (bpos > 0) {
+
+   buf[bpos++] = '_';
+  }
+  strcpy(&buf[bpos], word);
+  bpos += strlen(word);
+
+
+  shift = 0;
+  n = 0;
+
+ }
+ buf[bpos] = '\0';
+}
+
+
+# 100 "./src/main/fc/settings.c" 3 4
+_Bool 
+# 100 "./src/main/fc/settings.c"
+    settingNameContains(const setting_t *val, char *buf, const char *cmdline)
+{
+ settingGetName(val, buf);
+ return strstr(buf, cmdline) != 
+# 103 "./src/main/fc/settings.c" 3 4
+                               ((void *)0)
+# 103 "./src/main/fc/settings.c"
+                                   ;
+}
+
+
+# 106 "./src/main/fc/settings.c" 3 4
+_Bool 
+# 106 "./src/main/fc/settings.c"
+    settingNameIsExactMatch(const setting_t *val, char *buf, const char *cmdline, uint8_t var_name_length)
+{
+ settingGetName(val, buf);
+ return sl_strncasecmp(cmdline, buf, strlen(buf)) == 0 && var_name_length == strlen(buf);
+}
+
+
+static uint32_t settingNameHash(const char *name, size_t length, uint32_t seed)
+{
+ uint32_t hash = 2166136261U ^ seed;
+ for (size_t ii = 0; ii < length; ii++) {
+  hash ^= (uint8_t)sl_tolower(name[ii]);
+  hash *= 16777619U;
+ }
+ return hash;
+}
+
+
+
+static const setting_t *settingFindCandidate(const char *name, size_t length)
+{
+ const uint8_t seed = settingNameHashSeeds[settingNameHash(name, length, 0) % 147];
+ return &settingsTable[settingNameHashIndexes[settingNameHash(name, length, seed) % 379]];
+}
+
+const setting_t *settingFind(const char *name)
+{
+ char buf[37];
+ const setting_t *setting = settingFindCandidate(name, strlen(name));
+ settingGetName(setting, buf);
+ return strcmp(buf, name) == 0 ? setting : 
+# 136 "./src/main/fc/settings.c" 3 4
+                                          ((void *)0)
+# 136 "./src/main/fc/settings.c"
+                                              ;
+}
+
+const setting_t *settingFindIgnoringCase(const char *name, size_t length, char *buf)
+{
+ const setting_t *setting = settingFindCandidate(name, length);
+ return settingNameIsExactMatch(setting, buf, name, length) ? setting : 
+# 142 "./src/main/fc/settings.c" 3 4
+                                                                       ((void *)0)
+# 142 "./src/main/fc/settings.c"
+                                                                           ;
+}
+
+const setting_t *settingGet(unsigned index)
+{
+ return index < 379 ? &settingsTable[index] : 
+# 147 "./src/main/fc/settings.c" 3 4
+                                                              ((void *)0)
+# 147 "./src/main/fc/settings.c"
+                                                                  ;
+}
+
+unsigned settingGetIndex(const setting_t *val)
+{
+ return val - settingsTable;
+}
+
+
+# 155 "./src/main/fc/settings.c" 3 4
+_Bool 
+# 155 "./src/main/fc/settings.c"
+    settingsValidate(unsigned *invalidIndex)
+{
+ for (unsigned ii = 0; ii < 379; ii++) {
+  const setting_t *setting = settingGet(ii);
+  setting_min_t min = settingGetMin(setting);
+  setting_max_t max = settingGetMax(setting);
+  void *ptr = settingGetValuePointer(setting);
+  
+# 162 "./src/main/fc/settings.c" 3 4
+ _Bool 
+# 162 "./src/main/fc/settings.c"
+      isValid = 
+# 162 "./src/main/fc/settings.c" 3 4
+                0
+# 162 "./src/main/fc/settings.c"
+                     ;
+  switch (SETTING_TYPE(setting)) {
+  case VAR_UINT8:
+  {
+   uint8_t *value = ptr;
+   isValid = *value >= min && *value <= max;
+   break;
+  }
+  case VAR_INT8:
+  {
+   int8_t *value = ptr;
+   isValid = *value >= min && *value <= (int8_t)max;
+   break;
+  }
+  case VAR_UINT16:
+  {
+   uint16_t *value = ptr;
+   isValid = *value >= min && *value <= max;
+   break;
+  }
+  case VAR_INT16:
+  {
+   int16_t *value = ptr;
+   isValid = *value >= min && *value <= (int16_t)max;
+   break;
+  }
+  case VAR_UINT32:
+  {
+   uint32_t *value = ptr;
+   isValid = *value >= (uint32_t)min && *value <= max;
+   break;
+  }
+  case VAR_FLOAT:
+  {
+   float *value = ptr;
+   isValid = *value >= min && *value <= max;
+   break;
+  }
+  case VAR_STRING:
+
+   isValid = 
+# 202 "./src/main/fc/settings.c" 3 4
+            1
+# 202 "./src/main/fc/settings.c"
+                ;
+   break;
+  }
+  if (!isValid) {
+   if (invalidIndex) {
+    *invalidIndex = ii;
+   }
+   return 
+# 209 "./src/main/fc/settings.c" 3 4
+         0
+# 209 "./src/main/fc/settings.c"
+              ;
+  }
+ }
+ return 
+# 212 "./src/main/fc/settings.c" 3 4
+       1
+# 212 "./src/main/fc/settings.c"
+           ;
+}
+
+size_t settingGetValueSize(const setting_t *val)
+{
+ switch (SETTING_TYPE(val)) {
+  case VAR_UINT8:
+   __attribute__ ((fallthrough));
+  case VAR_INT8:
+   return 1;
+  case VAR_UINT16:
+   __attribute__ ((fallthrough));
+  case VAR_INT16:
+   return 2;
+  case VAR_UINT32:
+   __attribute__ ((fallthrough));
+  case VAR_FLOAT:
+   return 4;
+  case VAR_STRING:
+   return settingGetMax(val);
+ }
+ return 0;
+}
+
+pgn_t settingGetPgn(const setting_t *val)
+{
+ uint16_t pos = val - (const setting_t *)settingsTable;
+ uint16_t acc = 0;
+ for (uint8_t ii = 0; ii < 36; ii++) {
+  acc += settingsPgnCounts[ii];
+  if (acc > pos) {
+   return settingsPgn[ii];
+  }
+ }
+ return -1;
+}
+
+static uint16_t getValueOffset(const setting_t *value)
+{
+    switch (SETTING_SECTION(value)) {
+    case MASTER_VALUE:
+        return value->offset;
+    case PROFILE_VALUE:
+        return value->offset + sizeof(pidProfile_t) * getConfigProfile();
+    case CONTROL_RATE_VALUE:
+        return value->offset + sizeof(controlRateConfig_t) * getConfigProfile();
+    case BATTERY_CONFIG_VALUE:
+        return value->offset + sizeof(batteryProfile_t) * getConfigBatteryProfile();
+    }
+    return 0;
+}
+
+void *settingGetValuePointer(const setting_t *val)
+{
+    const pgRegistry_t *pg = pgFind(settingGetPgn(val));
+    return pg->address + getValueOffset(val);
+}
+
+const void * settingGetCopyValuePointer(const setting_t *val)
+{
+    const pgRegistry_t *pg = pgFind(settingGetPgn(val));
+    return pg->copy + getValueOffset(val);
+}
+
+setting_min_t settingGetMin(const setting_t *val)
+{
+ if (SETTING_MODE(val) == MODE_LOOKUP) {
+  return 0;
+ }
+ return settingMinMaxTable[(val->config.minmax.indexes[0])];
+}
+
+setting_max_t settingGetMax(const setting_t *val)
+{
+ if (SETTING_MODE(val) == MODE_LOOKUP) {
+  return settingLookupTables[val->config.lookup.tableIndex].valueCount - 1;
+ }
+ return settingMinMaxTable[(val->config.minmax.indexes[1])];
+}
+
+const lookupTableEntry_t * settingLookupTable(const setting_t *val)
+{
+ if (SETTING_MODE(val) == MODE_LOOKUP && val->config.lookup.tableIndex < LOOKUP_TABLE_COUNT) {
+  return &settingLookupTables[val->config.lookup.tableIndex];
+ }
+ return 
+# 297 "./src/main/fc/settings.c" 3 4
+       ((void *)0)
+# 297 "./src/main/fc/settings.c"
+           ;
+}
+
+const char * settingLookupValueName(const setting_t *val, unsigned v)
+{
+ const lookupTableEntry_t *table = settingLookupTable(val);
+ if (table && v < table->valueCount) {
+  return table->values[v];
+ }
+ return 
+# 306 "./src/main/fc/settings.c" 3 4
+       ((void *)0)
+# 306 "./src/main/fc/settings.c"
+           ;
+}
+
+size_t settingGetValueNameMaxSize(const setting_t *val)
+{
+ size_t maxSize = 0;
+ const lookupTableEntry_t *table = settingLookupTable(val);
+ if (table) {
+  for (unsigned ii = 0; ii < table->valueCount; ii++) {
+   maxSize = ( __extension__ ({ __typeof__(maxSize) _left0 = (maxSize); __typeof__(strlen(table->values[ii])) _right1 = (strlen(table->values[ii])); _left0 > _right1 ? _left0 : _right1; }));
+  }
+ }
+ return maxSize;
+}
+
+const char * settingGetString(const setting_t *val)
+{
+ if (SETTING_TYPE(val) == VAR_STRING) {
+  return settingGetValuePointer(val);
+ }
+ return 
+# 326 "./src/main/fc/settings.c" 3 4
+       ((void *)0)
+# 326 "./src/main/fc/settings.c"
+           ;
+}
+
+void settingSetString(const setting_t *val, const char *s, size_t size)
+{
+ if (SETTING_TYPE(val) == VAR_STRING) {
+  char *p = settingGetValuePointer(val);
+  size_t copySize = ( __extension__ ({ __typeof__(size) _left2 = (size); __typeof__(settingGetMax(val)) _right3 = (settingGetMax(val)); _left2 < _right3 ? _left2 : _right3; }));
+  memcpy(p, s, copySize);
+  p[copySize] = '\0';
+ }
+}
+
+setting_max_t settingGetStringMaxLength(const setting_t *val)
+{
+ if (SETTING_TYPE(val) == VAR_STRING) {
+
+  return settingGetMax(val);
+ }
+ return 0;
+}
+
+
+# 348 "./src/main/fc/settings.c" 3 4
+_Bool 
+# 348 "./src/main/fc/settings.c"
+    settingsGetParameterGroupIndexes(pgn_t pg, uint16_t *start, uint16_t *end)
+{
+ unsigned acc = 0;
+ for (int ii = 0; ii < 36; ii++) {
+  if (settingsPgn[ii] == pg) {
+   if (start) {
+    *start = acc;
+   }
+   if (end) {
+    *end = acc + settingsPgnCounts[ii] - 1;
+   }
+   return 
+# 359 "./src/main/fc/settings.c" 3 4
+         1
+# 359 "./src/main/fc/settings.c"
+             ;
+  }
+  acc += settingsPgnCounts[ii];
+ }
+ return 
+# 363 "./src/main/fc/settings.c" 3 4
+       0
+# 363 "./src/main/fc/settings.c"
+            ;
+}
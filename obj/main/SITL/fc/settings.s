@@ -0,0 +1,26266 @@
+	.file	"settings.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 4 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 5 "./obj/main/SITL/settings_generated.h"
+	.file 6 "./src/main/config/parameter_group.h"
+	.file 7 "./src/main/fc/settings.h"
+	.file 8 "./src/main/common/axis.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/sensors/sensors.h"
+	.file 11 "./src/main/flight/pid.h"
+	.file 12 "./src/main/drivers/adc.h"
+	.file 13 "./src/main/fc/rc_modes.h"
+	.file 14 "./src/main/common/log.h"
+	.file 15 "./obj/main/SITL/settings_generated.c"
+	.file 16 "./src/main/fc/config.h"
+	.file 17 "/usr/include/string.h"
+	.file 18 "./src/main/common/string_light.h"
+	.file 19 "./src/main/fc/settings.c"
+	.file 20 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	settings.c.1bf1ef21
+	.weak	settings.c.1bf1ef21
+settings.c.1bf1ef21:
+	.long	0x1639
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF3691
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.long	.LASF3315
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x2e
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF3310
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF3311
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x9
+	.long	0x54
+	.uleb128 0x4
+	.long	0x43
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3312
+	.uleb128 0x4
+	.long	0x4d
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF3313
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF3314
+	.uleb128 0x5
+	.long	.LASF3316
+	.byte	0x2
+	.byte	0x25
+	.byte	0x15
+	.long	0x73
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF3317
+	.uleb128 0x5
+	.long	.LASF3318
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x59
+	.uleb128 0x5
+	.long	.LASF3319
+	.byte	0x2
+	.byte	0x27
+	.byte	0x1a
+	.long	0x92
+	.uleb128 0x13
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF3320
+	.uleb128 0x5
+	.long	.LASF3321
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x35
+	.uleb128 0x5
+	.long	.LASF3322
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x60
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF3323
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x9
+	.long	0x4d
+	.uleb128 0x5
+	.long	.LASF3324
+	.byte	0x3
+	.byte	0x18
+	.byte	0x12
+	.long	0x67
+	.uleb128 0x5
+	.long	.LASF3325
+	.byte	0x3
+	.byte	0x19
+	.byte	0x13
+	.long	0x86
+	.uleb128 0x5
+	.long	.LASF3326
+	.byte	0x4
+	.byte	0x18
+	.byte	0x13
+	.long	0x7a
+	.uleb128 0x4
+	.long	0xd7
+	.uleb128 0x5
+	.long	.LASF3327
+	.byte	0x4
+	.byte	0x19
+	.byte	0x14
+	.long	0x99
+	.uleb128 0x4
+	.long	0xe8
+	.uleb128 0x5
+	.long	.LASF3328
+	.byte	0x4
+	.byte	0x1a
+	.byte	0x14
+	.long	0xa5
+	.uleb128 0x4
+	.long	0xf9
+	.uleb128 0x5
+	.long	.LASF3329
+	.byte	0x5
+	.byte	0xa
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x4
+	.long	0x10a
+	.uleb128 0x5
+	.long	.LASF3330
+	.byte	0x5
+	.byte	0xc
+	.byte	0x11
+	.long	0xcb
+	.uleb128 0x5
+	.long	.LASF3331
+	.byte	0x5
+	.byte	0xd
+	.byte	0x12
+	.long	0xf9
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x5
+	.byte	0xf
+	.byte	0x6
+	.long	0x248
+	.uleb128 0x1
+	.long	.LASF3332
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3333
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3334
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3335
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3336
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3337
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3338
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3339
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3340
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3341
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3342
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3343
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3344
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3345
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3346
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3347
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3348
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3349
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3350
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3351
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3352
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3353
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3354
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3355
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3356
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3357
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3358
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3359
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3360
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3361
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3362
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3363
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3364
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3365
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3366
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3367
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3368
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3369
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3370
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3371
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3372
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3373
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3374
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF3375
+	.byte	0x2b
+	.byte	0
+	.uleb128 0x6
+	.long	0x48
+	.long	0x253
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x4
+	.long	0x248
+	.uleb128 0x2
+	.long	.LASF3376
+	.byte	0x3d
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3377
+	.byte	0x3e
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3378
+	.byte	0x3f
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3379
+	.byte	0x40
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3380
+	.byte	0x41
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3381
+	.byte	0x42
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3382
+	.byte	0x43
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3383
+	.byte	0x44
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3384
+	.byte	0x45
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3385
+	.byte	0x46
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3386
+	.byte	0x47
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3387
+	.byte	0x48
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3388
+	.byte	0x49
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3389
+	.byte	0x4a
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3390
+	.byte	0x4b
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3391
+	.byte	0x4c
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3392
+	.byte	0x4d
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3393
+	.byte	0x4e
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3394
+	.byte	0x4f
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3395
+	.byte	0x50
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3396
+	.byte	0x51
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3397
+	.byte	0x52
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3398
+	.byte	0x53
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3399
+	.byte	0x54
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3400
+	.byte	0x55
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3401
+	.byte	0x56
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3402
+	.byte	0x57
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3403
+	.byte	0x58
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3404
+	.byte	0x59
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3405
+	.byte	0x5a
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3406
+	.byte	0x5b
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3407
+	.byte	0x5c
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3408
+	.byte	0x5d
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3409
+	.byte	0x5e
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3410
+	.byte	0x5f
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3411
+	.byte	0x60
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3412
+	.byte	0x61
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3413
+	.byte	0x62
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3414
+	.byte	0x63
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3415
+	.byte	0x64
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3416
+	.byte	0x65
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3417
+	.byte	0x66
+	.long	0x253
+	.uleb128 0x2
+	.long	.LASF3418
+	.byte	0x67
+	.long	0x253
+	.uleb128 0x5
+	.long	.LASF3419
+	.byte	0x6
+	.byte	0x19
+	.byte	0x12
+	.long	0xe8
+	.uleb128 0x4
+	.long	0x406
+	.uleb128 0x5
+	.long	.LASF3420
+	.byte	0x6
+	.byte	0x2a
+	.byte	0xf
+	.long	0x423
+	.uleb128 0x29
+	.long	0x42e
+	.uleb128 0xa
+	.long	0xb8
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x6
+	.byte	0x32
+	.byte	0x5
+	.long	0x44d
+	.uleb128 0x1e
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xb8
+	.uleb128 0x1e
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x44d
+	.byte	0
+	.uleb128 0x9
+	.long	0x417
+	.uleb128 0x1a
+	.long	.LASF3426
+	.byte	0x28
+	.byte	0x6
+	.byte	0x2c
+	.long	0x4ab
+	.uleb128 0x1f
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0x406
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3421
+	.byte	0x6
+	.byte	0x2e
+	.byte	0xe
+	.long	0xe8
+	.byte	0x2
+	.uleb128 0x12
+	.long	.LASF3422
+	.byte	0x6
+	.byte	0x2f
+	.byte	0xe
+	.long	0x4ab
+	.byte	0x8
+	.uleb128 0x12
+	.long	.LASF3423
+	.byte	0x6
+	.byte	0x30
+	.byte	0xe
+	.long	0x4ab
+	.byte	0x10
+	.uleb128 0x1f
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x4b0
+	.byte	0x18
+	.uleb128 0x12
+	.long	.LASF3424
+	.byte	0x6
+	.byte	0x35
+	.byte	0x7
+	.long	0x42e
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0xd7
+	.uleb128 0x9
+	.long	0x4ab
+	.uleb128 0x5
+	.long	.LASF3425
+	.byte	0x6
+	.byte	0x36
+	.byte	0x3
+	.long	0x452
+	.uleb128 0x4
+	.long	0x4b5
+	.uleb128 0x1a
+	.long	.LASF3427
+	.byte	0x10
+	.byte	0x7
+	.byte	0xb
+	.long	0x4ed
+	.uleb128 0x12
+	.long	.LASF3428
+	.byte	0x7
+	.byte	0xc
+	.byte	0x19
+	.long	0x4ed
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3429
+	.byte	0x7
+	.byte	0xd
+	.byte	0x13
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x48
+	.uleb128 0x5
+	.long	.LASF3430
+	.byte	0x7
+	.byte	0xe
+	.byte	0x3
+	.long	0x4c6
+	.uleb128 0x4
+	.long	0x4f2
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x7
+	.byte	0x14
+	.byte	0xe
+	.long	0x53a
+	.uleb128 0x1
+	.long	.LASF3431
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3432
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3433
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3434
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3435
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3436
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3437
+	.byte	0x6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3438
+	.byte	0x7
+	.byte	0x1d
+	.byte	0x3
+	.long	0x503
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xe
+	.long	0x56b
+	.uleb128 0x1
+	.long	.LASF3439
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3440
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3441
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3442
+	.byte	0x30
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3443
+	.byte	0x7
+	.byte	0x25
+	.byte	0x3
+	.long	0x546
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x7
+	.byte	0x27
+	.byte	0xe
+	.long	0x590
+	.uleb128 0x1
+	.long	.LASF3444
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3445
+	.byte	0x40
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3446
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x3
+	.long	0x577
+	.uleb128 0x1a
+	.long	.LASF3447
+	.byte	0x2
+	.byte	0x7
+	.byte	0x31
+	.long	0x5b6
+	.uleb128 0x12
+	.long	.LASF3448
+	.byte	0x7
+	.byte	0x32
+	.byte	0x13
+	.long	0x5c6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x5c6
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0x5b6
+	.uleb128 0x5
+	.long	.LASF3449
+	.byte	0x7
+	.byte	0x33
+	.byte	0x3
+	.long	0x59c
+	.uleb128 0x1a
+	.long	.LASF3450
+	.byte	0x1
+	.byte	0x7
+	.byte	0x35
+	.long	0x5f1
+	.uleb128 0x12
+	.long	.LASF3451
+	.byte	0x7
+	.byte	0x36
+	.byte	0x13
+	.long	0xe3
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3452
+	.byte	0x7
+	.byte	0x37
+	.byte	0x3
+	.long	0x5d7
+	.uleb128 0x1d
+	.byte	0x2
+	.byte	0x7
+	.byte	0x39
+	.byte	0x9
+	.long	0x61d
+	.uleb128 0x20
+	.long	.LASF3453
+	.byte	0x3a
+	.byte	0x20
+	.long	0x5f1
+	.uleb128 0x20
+	.long	.LASF3454
+	.byte	0x3b
+	.byte	0x1b
+	.long	0x5cb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF3455
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x3
+	.long	0x5fd
+	.uleb128 0x4
+	.long	0x61d
+	.uleb128 0x2a
+	.byte	0x9
+	.byte	0x7
+	.byte	0x3e
+	.byte	0x9
+	.long	0x66c
+	.uleb128 0x12
+	.long	.LASF3456
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x13
+	.long	0x67c
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF3457
+	.byte	0x7
+	.byte	0x40
+	.byte	0x13
+	.long	0xe3
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF3458
+	.byte	0x7
+	.byte	0x41
+	.byte	0x1b
+	.long	0x629
+	.byte	0x6
+	.uleb128 0x12
+	.long	.LASF3459
+	.byte	0x7
+	.byte	0x42
+	.byte	0x1c
+	.long	0x116
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x67c
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	0x66c
+	.uleb128 0x5
+	.long	.LASF3460
+	.byte	0x7
+	.byte	0x44
+	.byte	0x1b
+	.long	0x62e
+	.uleb128 0x4
+	.long	0x681
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x8
+	.byte	0x14
+	.byte	0xe
+	.long	0x6ab
+	.uleb128 0x1b
+	.string	"X"
+	.byte	0
+	.uleb128 0x1b
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1b
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xe
+	.long	0x6ca
+	.uleb128 0x1
+	.long	.LASF3461
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3462
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3463
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF3464
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF3465
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x9
+	.byte	0x16
+	.byte	0xe
+	.long	0x7c9
+	.uleb128 0x1
+	.long	.LASF3466
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3467
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3468
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3469
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3470
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3471
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3472
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3473
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3474
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3475
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3476
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3477
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3478
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3479
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3480
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3481
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3482
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3483
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3484
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3485
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3486
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3487
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3488
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3489
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3490
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3491
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3492
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3493
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3494
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3495
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3496
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3497
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3498
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3499
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3500
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3501
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3502
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3503
+	.byte	0x25
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0x854
+	.uleb128 0x1
+	.long	.LASF3504
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3505
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3506
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3507
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3508
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3509
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3510
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3511
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3512
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3513
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3514
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3515
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3516
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3517
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3518
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3519
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3520
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3521
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3522
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3523
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3524
+	.byte	0x14
+	.byte	0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF3525
+	.uleb128 0x9
+	.long	0xf9
+	.uleb128 0x9
+	.long	0xe3
+	.uleb128 0x9
+	.long	0xcb
+	.uleb128 0x9
+	.long	0x6ca
+	.uleb128 0x11
+	.long	0x60
+	.byte	0xa
+	.byte	0x14
+	.byte	0xe
+	.long	0x8ac
+	.uleb128 0x1
+	.long	.LASF3526
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3527
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3528
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3529
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3530
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3531
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3532
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3533
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0xe8
+	.uleb128 0x9
+	.long	0x8b6
+	.uleb128 0x2b
+	.uleb128 0x2c
+	.long	.LASF3692
+	.byte	0x7
+	.byte	0x4
+	.long	0x60
+	.byte	0x14
+	.byte	0x18
+	.byte	0xe
+	.long	0x92a
+	.uleb128 0x1
+	.long	.LASF3534
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3535
+	.byte	0x1
+	.uleb128 0x1b
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3536
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3537
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3538
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3539
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3540
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3541
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3542
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3543
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3544
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3545
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3546
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3547
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3548
+	.byte	0xf
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0xb
+	.byte	0x39
+	.byte	0xe
+	.long	0x97f
+	.uleb128 0x1
+	.long	.LASF3549
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3550
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3551
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3552
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3553
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3554
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3555
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3556
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3557
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3558
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3559
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3560
+	.byte	0xb
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0xc
+	.byte	0x16
+	.byte	0xe
+	.long	0x9aa
+	.uleb128 0x1
+	.long	.LASF3561
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3562
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3563
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3564
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3565
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0xd
+	.byte	0x1c
+	.byte	0xe
+	.long	0xab9
+	.uleb128 0x1
+	.long	.LASF3566
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3567
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3568
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3569
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3570
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3571
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3572
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3573
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3574
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3575
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3576
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3577
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF3578
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF3579
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF3580
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF3581
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF3582
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF3583
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF3584
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF3585
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF3586
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF3587
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF3588
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF3589
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF3590
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF3591
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF3592
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF3593
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF3594
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF3595
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF3596
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF3597
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF3598
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF3599
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF3600
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF3601
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF3602
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF3603
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF3604
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF3605
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF3606
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF3607
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF3608
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x11
+	.long	0x60
+	.byte	0xe
+	.byte	0x15
+	.byte	0xe
+	.long	0xb0e
+	.uleb128 0x1
+	.long	.LASF3609
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF3610
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF3611
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF3612
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF3613
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF3614
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF3615
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF3616
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF3617
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF3618
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF3619
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF3620
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	0x412
+	.long	0xb1e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x23
+	.byte	0
+	.uleb128 0x4
+	.long	0xb0e
+	.uleb128 0x21
+	.long	.LASF3621
+	.byte	0x2a
+	.byte	0xd
+	.long	0xb1e
+	.uleb128 0x6
+	.long	0xe3
+	.long	0xb3e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x23
+	.byte	0
+	.uleb128 0x4
+	.long	0xb2e
+	.uleb128 0x21
+	.long	.LASF3622
+	.byte	0x50
+	.byte	0xf
+	.long	0xb3e
+	.uleb128 0x6
+	.long	0xe3
+	.long	0xb5f
+	.uleb128 0x1c
+	.long	0x2e
+	.value	0x70b
+	.byte	0
+	.uleb128 0x4
+	.long	0xb4e
+	.uleb128 0x8
+	.long	.LASF3623
+	.byte	0xf
+	.byte	0x76
+	.byte	0x16
+	.long	0xb5f
+	.uleb128 0x6
+	.long	0x54
+	.long	0xb80
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	0xb70
+	.uleb128 0xd
+	.long	.LASF3624
+	.byte	0xf
+	.value	0x1a7
+	.byte	0x13
+	.long	0xb80
+	.uleb128 0x6
+	.long	0x48
+	.long	0xba2
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0xc
+	.byte	0
+	.uleb128 0x4
+	.long	0xb92
+	.uleb128 0x3
+	.long	0x258
+	.value	0x1a8
+	.long	0xba2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xbc2
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x1
+	.byte	0
+	.uleb128 0x4
+	.long	0xbb2
+	.uleb128 0x3
+	.long	0x262
+	.value	0x1b7
+	.long	0xbc2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xbe2
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	0xbd2
+	.uleb128 0x3
+	.long	0x26c
+	.value	0x1bb
+	.long	0xbe2
+	.uleb128 0x3
+	.long	0x276
+	.value	0x1c6
+	.long	0xbc2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xc0d
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0xa
+	.byte	0
+	.uleb128 0x4
+	.long	0xbfd
+	.uleb128 0x3
+	.long	0x280
+	.value	0x1ca
+	.long	0xc0d
+	.uleb128 0x3
+	.long	0x28a
+	.value	0x1d7
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x294
+	.value	0x1db
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x29e
+	.value	0x1df
+	.long	0xbc2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xc4e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	0xc3e
+	.uleb128 0x3
+	.long	0x2a8
+	.value	0x1e3
+	.long	0xc4e
+	.uleb128 0x6
+	.long	0x48
+	.long	0xc6e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	0xc5e
+	.uleb128 0x3
+	.long	0x2b2
+	.value	0x1e8
+	.long	0xc6e
+	.uleb128 0x6
+	.long	0x48
+	.long	0xc8e
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x18
+	.byte	0
+	.uleb128 0x4
+	.long	0xc7e
+	.uleb128 0x3
+	.long	0x2bc
+	.value	0x1ee
+	.long	0xc8e
+	.uleb128 0x3
+	.long	0x2c6
+	.value	0x209
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x2d0
+	.value	0x20e
+	.long	0xc6e
+	.uleb128 0x3
+	.long	0x2da
+	.value	0x214
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x2e4
+	.value	0x218
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x2ee
+	.value	0x21c
+	.long	0xc4e
+	.uleb128 0x6
+	.long	0x48
+	.long	0xce5
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	0xcd5
+	.uleb128 0x3
+	.long	0x2f8
+	.value	0x221
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x302
+	.value	0x229
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x30c
+	.value	0x231
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x316
+	.value	0x239
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x320
+	.value	0x23e
+	.long	0xbc2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xd31
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	0xd21
+	.uleb128 0x3
+	.long	0x32a
+	.value	0x242
+	.long	0xd31
+	.uleb128 0x3
+	.long	0x334
+	.value	0x249
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x33e
+	.value	0x24e
+	.long	0xba2
+	.uleb128 0x6
+	.long	0x48
+	.long	0xd67
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	0xd57
+	.uleb128 0x3
+	.long	0x348
+	.value	0x25d
+	.long	0xd67
+	.uleb128 0x3
+	.long	0x352
+	.value	0x269
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x35c
+	.value	0x26e
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x366
+	.value	0x273
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x370
+	.value	0x27b
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x37a
+	.value	0x27f
+	.long	0xbc2
+	.uleb128 0x3
+	.long	0x384
+	.value	0x283
+	.long	0xd31
+	.uleb128 0x3
+	.long	0x38e
+	.value	0x28a
+	.long	0xc6e
+	.uleb128 0x3
+	.long	0x398
+	.value	0x290
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x3a2
+	.value	0x298
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x3ac
+	.value	0x2a0
+	.long	0xce5
+	.uleb128 0x3
+	.long	0x3b6
+	.value	0x2a8
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x3c0
+	.value	0x2ad
+	.long	0xce5
+	.uleb128 0x6
+	.long	0x48
+	.long	0xe0b
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	0xdfb
+	.uleb128 0x3
+	.long	0x3ca
+	.value	0x2b5
+	.long	0xe0b
+	.uleb128 0x3
+	.long	0x3d4
+	.value	0x2c3
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x3de
+	.value	0x2c8
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x3e8
+	.value	0x2cd
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x3f2
+	.value	0x2d2
+	.long	0xc4e
+	.uleb128 0x3
+	.long	0x3fc
+	.value	0x2d7
+	.long	0xc4e
+	.uleb128 0x6
+	.long	0x4fe
+	.long	0xe62
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	0xe52
+	.uleb128 0xd
+	.long	.LASF3625
+	.byte	0xf
+	.value	0x2dc
+	.byte	0x21
+	.long	0xe62
+	.uleb128 0x6
+	.long	0x105
+	.long	0xe84
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x48
+	.byte	0
+	.uleb128 0x4
+	.long	0xe74
+	.uleb128 0xd
+	.long	.LASF3626
+	.byte	0xf
+	.value	0x309
+	.byte	0x17
+	.long	0xe84
+	.uleb128 0x6
+	.long	0x68d
+	.long	0xea7
+	.uleb128 0x1c
+	.long	0x2e
+	.value	0x17a
+	.byte	0
+	.uleb128 0x4
+	.long	0xe96
+	.uleb128 0xd
+	.long	.LASF3627
+	.byte	0xf
+	.value	0x357
+	.byte	0x18
+	.long	0xea7
+	.uleb128 0x6
+	.long	0xe3
+	.long	0xec9
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x92
+	.byte	0
+	.uleb128 0x4
+	.long	0xeb9
+	.uleb128 0xd
+	.long	.LASF3628
+	.byte	0xf
+	.value	0x4f9
+	.byte	0x16
+	.long	0xec9
+	.uleb128 0x6
+	.long	0xf4
+	.long	0xeec
+	.uleb128 0x1c
+	.long	0x2e
+	.value	0x17a
+	.byte	0
+	.uleb128 0x4
+	.long	0xedb
+	.uleb128 0xd
+	.long	.LASF3629
+	.byte	0xf
+	.value	0x505
+	.byte	0x17
+	.long	0xeec
+	.uleb128 0x16
+	.long	.LASF3632
+	.byte	0x11
+	.byte	0x2b
+	.byte	0xe
+	.long	0xb8
+	.long	0xf1e
+	.uleb128 0xa
+	.long	0xb8
+	.uleb128 0xa
+	.long	0x8b1
+	.uleb128 0xa
+	.long	0x22
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF3630
+	.byte	0x7f
+	.long	0xd7
+	.uleb128 0x22
+	.long	.LASF3631
+	.byte	0x7b
+	.long	0xd7
+	.uleb128 0x16
+	.long	.LASF3633
+	.byte	0x6
+	.byte	0xfb
+	.byte	0x15
+	.long	0xf48
+	.long	0xf48
+	.uleb128 0xa
+	.long	0x406
+	.byte	0
+	.uleb128 0x9
+	.long	0x4c1
+	.uleb128 0x16
+	.long	.LASF3634
+	.byte	0x12
+	.byte	0x18
+	.byte	0x5
+	.long	0x3c
+	.long	0xf63
+	.uleb128 0xa
+	.long	0x3c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3635
+	.byte	0x11
+	.byte	0x9c
+	.byte	0xc
+	.long	0x3c
+	.long	0xf7e
+	.uleb128 0xa
+	.long	0x43
+	.uleb128 0xa
+	.long	0x43
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3636
+	.byte	0x12
+	.byte	0x1c
+	.byte	0x5
+	.long	0x3c
+	.long	0xf9e
+	.uleb128 0xa
+	.long	0x43
+	.uleb128 0xa
+	.long	0x43
+	.uleb128 0xa
+	.long	0x3c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3637
+	.value	0x15e
+	.byte	0xe
+	.long	0xba
+	.long	0xfb9
+	.uleb128 0xa
+	.long	0x43
+	.uleb128 0xa
+	.long	0x43
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF3638
+	.value	0x197
+	.byte	0xf
+	.long	0x22
+	.long	0xfcf
+	.uleb128 0xa
+	.long	0x43
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF3639
+	.byte	0x11
+	.byte	0x8d
+	.byte	0xe
+	.long	0xba
+	.long	0xfea
+	.uleb128 0xa
+	.long	0xba
+	.uleb128 0xa
+	.long	0x43
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3641
+	.value	0x15c
+	.byte	0x5
+	.long	0x854
+	.long	0x1037
+	.uleb128 0xe
+	.string	"pg"
+	.value	0x15c
+	.byte	0x2c
+	.long	0x406
+	.uleb128 0x24
+	.long	.LASF3640
+	.value	0x15c
+	.byte	0x3a
+	.long	0x8ac
+	.uleb128 0xe
+	.string	"end"
+	.value	0x15c
+	.byte	0x4b
+	.long	0x8ac
+	.uleb128 0x17
+	.string	"acc"
+	.value	0x15e
+	.byte	0xb
+	.long	0x60
+	.uleb128 0xf
+	.uleb128 0x17
+	.string	"ii"
+	.value	0x15f
+	.byte	0xb
+	.long	0x3c
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3642
+	.value	0x153
+	.byte	0xf
+	.long	0x127
+	.long	0x1054
+	.uleb128 0xe
+	.string	"val"
+	.value	0x153
+	.byte	0x3a
+	.long	0x1054
+	.byte	0
+	.uleb128 0x9
+	.long	0x68d
+	.uleb128 0x2d
+	.long	.LASF3681
+	.byte	0x13
+	.value	0x149
+	.byte	0x6
+	.long	0x10be
+	.uleb128 0xe
+	.string	"val"
+	.value	0x149
+	.byte	0x28
+	.long	0x1054
+	.uleb128 0xe
+	.string	"s"
+	.value	0x149
+	.byte	0x39
+	.long	0x43
+	.uleb128 0x24
+	.long	.LASF3421
+	.value	0x149
+	.byte	0x43
+	.long	0x22
+	.uleb128 0xf
+	.uleb128 0x17
+	.string	"p"
+	.value	0x14c
+	.byte	0x9
+	.long	0xba
+	.uleb128 0xd
+	.long	.LASF3643
+	.byte	0x13
+	.value	0x14d
+	.byte	0xa
+	.long	0x22
+	.uleb128 0xf
+	.uleb128 0xd
+	.long	.LASF3644
+	.byte	0x13
+	.value	0x14d
+	.byte	0x39
+	.long	0x22
+	.uleb128 0xd
+	.long	.LASF3645
+	.byte	0x13
+	.value	0x14d
+	.byte	0x69
+	.long	0x127
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3646
+	.value	0x141
+	.byte	0xe
+	.long	0x43
+	.long	0x10db
+	.uleb128 0xe
+	.string	"val"
+	.value	0x141
+	.byte	0x30
+	.long	0x1054
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3647
+	.value	0x135
+	.byte	0x8
+	.long	0x22
+	.long	0x113b
+	.uleb128 0xe
+	.string	"val"
+	.value	0x135
+	.byte	0x34
+	.long	0x1054
+	.uleb128 0xd
+	.long	.LASF3648
+	.byte	0x13
+	.value	0x137
+	.byte	0x9
+	.long	0x22
+	.uleb128 0xd
+	.long	.LASF3649
+	.byte	0x13
+	.value	0x138
+	.byte	0x1c
+	.long	0x113b
+	.uleb128 0xf
+	.uleb128 0x17
+	.string	"ii"
+	.value	0x13a
+	.byte	0x11
+	.long	0x60
+	.uleb128 0xf
+	.uleb128 0xd
+	.long	.LASF3650
+	.byte	0x13
+	.value	0x13b
+	.byte	0x35
+	.long	0x22
+	.uleb128 0xd
+	.long	.LASF3651
+	.byte	0x13
+	.value	0x13b
+	.byte	0x6f
+	.long	0x22
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x4fe
+	.uleb128 0x14
+	.long	.LASF3652
+	.value	0x12c
+	.byte	0xe
+	.long	0x43
+	.long	0x1174
+	.uleb128 0xe
+	.string	"val"
+	.value	0x12c
+	.byte	0x36
+	.long	0x1054
+	.uleb128 0xe
+	.string	"v"
+	.value	0x12c
+	.byte	0x44
+	.long	0x60
+	.uleb128 0xd
+	.long	.LASF3649
+	.byte	0x13
+	.value	0x12e
+	.byte	0x1c
+	.long	0x113b
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3653
+	.value	0x124
+	.byte	0x1c
+	.long	0x113b
+	.long	0x1191
+	.uleb128 0xe
+	.string	"val"
+	.value	0x124
+	.byte	0x40
+	.long	0x1054
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3654
+	.value	0x11c
+	.byte	0xf
+	.long	0x127
+	.long	0x11ae
+	.uleb128 0xe
+	.string	"val"
+	.value	0x11c
+	.byte	0x2e
+	.long	0x1054
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3655
+	.value	0x114
+	.byte	0xf
+	.long	0x11b
+	.long	0x11cb
+	.uleb128 0xe
+	.string	"val"
+	.value	0x114
+	.byte	0x2e
+	.long	0x1054
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3656
+	.value	0x10e
+	.byte	0xe
+	.long	0x8b1
+	.long	0x11f3
+	.uleb128 0xe
+	.string	"val"
+	.value	0x10e
+	.byte	0x3a
+	.long	0x1054
+	.uleb128 0x17
+	.string	"pg"
+	.value	0x110
+	.byte	0x19
+	.long	0xf48
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF3657
+	.value	0x108
+	.byte	0x7
+	.long	0xb8
+	.long	0x121b
+	.uleb128 0xe
+	.string	"val"
+	.value	0x108
+	.byte	0x2f
+	.long	0x1054
+	.uleb128 0x17
+	.string	"pg"
+	.value	0x10a
+	.byte	0x19
+	.long	0xf48
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3672
+	.byte	0x13
+	.byte	0xf9
+	.byte	0x11
+	.long	0xe8
+	.long	0x1237
+	.uleb128 0x10
+	.long	.LASF3658
+	.byte	0xf9
+	.byte	0x31
+	.long	0x1054
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3659
+	.byte	0xec
+	.byte	0x7
+	.long	0x406
+	.long	0x1275
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0xec
+	.byte	0x26
+	.long	0x1054
+	.uleb128 0xc
+	.string	"pos"
+	.byte	0xee
+	.byte	0xb
+	.long	0xe8
+	.uleb128 0xc
+	.string	"acc"
+	.byte	0xef
+	.byte	0xb
+	.long	0xe8
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"ii"
+	.byte	0xf0
+	.byte	0xf
+	.long	0xd7
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3660
+	.byte	0xd7
+	.byte	0x8
+	.long	0x22
+	.long	0x1291
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0xd7
+	.byte	0x2d
+	.long	0x1054
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3661
+	.byte	0x9b
+	.byte	0x5
+	.long	0x854
+	.long	0x135b
+	.uleb128 0x10
+	.long	.LASF3662
+	.byte	0x9b
+	.byte	0x20
+	.long	0x135b
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"ii"
+	.byte	0x9d
+	.byte	0x10
+	.long	0x60
+	.uleb128 0xf
+	.uleb128 0x8
+	.long	.LASF3663
+	.byte	0x13
+	.byte	0x9e
+	.byte	0x14
+	.long	0x1054
+	.uleb128 0xc
+	.string	"min"
+	.byte	0x9f
+	.byte	0x11
+	.long	0x11b
+	.uleb128 0xc
+	.string	"max"
+	.byte	0xa0
+	.byte	0x11
+	.long	0x127
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0xa1
+	.byte	0x9
+	.long	0xb8
+	.uleb128 0x8
+	.long	.LASF3664
+	.byte	0x13
+	.byte	0xa2
+	.byte	0x7
+	.long	0x854
+	.uleb128 0x19
+	.long	0x1302
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xa6
+	.byte	0xd
+	.long	0x4ab
+	.byte	0
+	.uleb128 0x19
+	.long	0x1314
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xac
+	.byte	0xc
+	.long	0x1360
+	.byte	0
+	.uleb128 0x19
+	.long	0x1326
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xb2
+	.byte	0xe
+	.long	0x8ac
+	.byte	0
+	.uleb128 0x19
+	.long	0x1338
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xb8
+	.byte	0xd
+	.long	0x865
+	.byte	0
+	.uleb128 0x19
+	.long	0x134a
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xbe
+	.byte	0xe
+	.long	0x85b
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x8
+	.long	.LASF3658
+	.byte	0x13
+	.byte	0xc4
+	.byte	0xb
+	.long	0x86a
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x60
+	.uleb128 0x9
+	.long	0xbf
+	.uleb128 0x15
+	.long	.LASF3665
+	.byte	0x96
+	.byte	0xa
+	.long	0x60
+	.long	0x1381
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0x96
+	.byte	0x2b
+	.long	0x1054
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3666
+	.byte	0x91
+	.byte	0x12
+	.long	0x1054
+	.long	0x139c
+	.uleb128 0x10
+	.long	.LASF3667
+	.byte	0x91
+	.byte	0x26
+	.long	0x60
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3668
+	.byte	0x8b
+	.byte	0x12
+	.long	0x1054
+	.long	0x13da
+	.uleb128 0x10
+	.long	.LASF3669
+	.byte	0x8b
+	.byte	0x36
+	.long	0x43
+	.uleb128 0x10
+	.long	.LASF3670
+	.byte	0x8b
+	.byte	0x43
+	.long	0x22
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x13
+	.byte	0x8b
+	.byte	0x51
+	.long	0xba
+	.uleb128 0x8
+	.long	.LASF3663
+	.byte	0x13
+	.byte	0x8d
+	.byte	0x13
+	.long	0x1054
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3671
+	.byte	0x83
+	.byte	0x12
+	.long	0x1054
+	.long	0x140c
+	.uleb128 0x10
+	.long	.LASF3669
+	.byte	0x83
+	.byte	0x2a
+	.long	0x43
+	.uleb128 0xc
+	.string	"buf"
+	.byte	0x85
+	.byte	0x7
+	.long	0x140c
+	.uleb128 0x8
+	.long	.LASF3663
+	.byte	0x13
+	.byte	0x86
+	.byte	0x13
+	.long	0x1054
+	.byte	0
+	.uleb128 0x6
+	.long	0x4d
+	.long	0x141c
+	.uleb128 0x7
+	.long	0x2e
+	.byte	0x24
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3673
+	.byte	0x13
+	.byte	0x7d
+	.byte	0x19
+	.long	0x1054
+	.long	0x144f
+	.uleb128 0x10
+	.long	.LASF3669
+	.byte	0x7d
+	.byte	0x3a
+	.long	0x43
+	.uleb128 0x10
+	.long	.LASF3670
+	.byte	0x7d
+	.byte	0x47
+	.long	0x22
+	.uleb128 0x8
+	.long	.LASF3674
+	.byte	0x13
+	.byte	0x7f
+	.byte	0x10
+	.long	0xe3
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3675
+	.byte	0x13
+	.byte	0x71
+	.byte	0x11
+	.long	0xf9
+	.long	0x1499
+	.uleb128 0x10
+	.long	.LASF3669
+	.byte	0x71
+	.byte	0x2d
+	.long	0x43
+	.uleb128 0x10
+	.long	.LASF3670
+	.byte	0x71
+	.byte	0x3a
+	.long	0x22
+	.uleb128 0x10
+	.long	.LASF3674
+	.byte	0x71
+	.byte	0x4b
+	.long	0xf9
+	.uleb128 0x8
+	.long	.LASF3676
+	.byte	0x13
+	.byte	0x73
+	.byte	0xb
+	.long	0xf9
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"ii"
+	.byte	0x74
+	.byte	0xe
+	.long	0x22
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3677
+	.byte	0x6a
+	.byte	0x5
+	.long	0x854
+	.long	0x14d7
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0x6a
+	.byte	0x2e
+	.long	0x1054
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x13
+	.byte	0x6a
+	.byte	0x39
+	.long	0xba
+	.uleb128 0x10
+	.long	.LASF3678
+	.byte	0x6a
+	.byte	0x4a
+	.long	0x43
+	.uleb128 0x10
+	.long	.LASF3679
+	.byte	0x6a
+	.byte	0x5b
+	.long	0xd7
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF3680
+	.byte	0x64
+	.byte	0x5
+	.long	0x854
+	.long	0x150a
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0x64
+	.byte	0x2a
+	.long	0x1054
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x13
+	.byte	0x64
+	.byte	0x35
+	.long	0xba
+	.uleb128 0x10
+	.long	.LASF3678
+	.byte	0x64
+	.byte	0x46
+	.long	0x43
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF3682
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x6
+	.long	0x1573
+	.uleb128 0xb
+	.string	"val"
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x26
+	.long	0x1054
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x13
+	.byte	0x3a
+	.byte	0x31
+	.long	0xba
+	.uleb128 0x8
+	.long	.LASF3683
+	.byte	0x13
+	.byte	0x3c
+	.byte	0xa
+	.long	0xd7
+	.uleb128 0xc
+	.string	"n"
+	.byte	0x3d
+	.byte	0xb
+	.long	0xe8
+	.uleb128 0x8
+	.long	.LASF3684
+	.byte	0x13
+	.byte	0x3e
+	.byte	0x7
+	.long	0x140c
+	.uleb128 0x8
+	.long	.LASF3685
+	.byte	0x13
+	.byte	0x40
+	.byte	0xa
+	.long	0xd7
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"ii"
+	.byte	0x42
+	.byte	0xf
+	.long	0xd7
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"b"
+	.byte	0x47
+	.byte	0xc
+	.long	0xe8
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3686
+	.byte	0x13
+	.byte	0xf
+	.byte	0xc
+	.long	0x854
+	.long	0x15ef
+	.uleb128 0xb
+	.string	"buf"
+	.byte	0x13
+	.byte	0xf
+	.byte	0x21
+	.long	0xba
+	.uleb128 0xb
+	.string	"idx"
+	.byte	0x13
+	.byte	0xf
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x14
+	.byte	0x11
+	.long	0x860
+	.uleb128 0x8
+	.long	.LASF3687
+	.byte	0x13
+	.byte	0x15
+	.byte	0x8
+	.long	0xba
+	.uleb128 0x8
+	.long	.LASF3688
+	.byte	0x13
+	.byte	0x16
+	.byte	0x6
+	.long	0x3c
+	.uleb128 0x8
+	.long	.LASF3684
+	.byte	0x13
+	.byte	0x17
+	.byte	0x6
+	.long	0x3c
+	.uleb128 0xf
+	.uleb128 0x8
+	.long	.LASF3685
+	.byte	0x13
+	.byte	0x19
+	.byte	0x7
+	.long	0x3c
+	.uleb128 0xc
+	.string	"chr"
+	.byte	0x1a
+	.byte	0x8
+	.long	0x4d
+	.uleb128 0xf
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x28
+	.byte	0x9
+	.long	0x4d
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3689
+	.byte	0x7
+	.byte	0x48
+	.byte	0x1e
+	.long	0x590
+	.long	0x160a
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x7
+	.byte	0x48
+	.byte	0x3c
+	.long	0x1054
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF3690
+	.byte	0x7
+	.byte	0x47
+	.byte	0x21
+	.long	0x56b
+	.long	0x1625
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x7
+	.byte	0x47
+	.byte	0x42
+	.long	0x1054
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF3693
+	.byte	0x7
+	.byte	0x46
+	.byte	0x1e
+	.long	0x53a
+	.uleb128 0xb
+	.string	"s"
+	.byte	0x7
+	.byte	0x46
+	.byte	0x3c
+	.long	0x1054
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 27
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 21 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.file 23 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 24 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF540
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF587
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF588
+	.byte	0x4
+	.byte	0x4
+	.file 33 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x22
+	.file 35 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF591
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF651
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF655
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF656
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF719
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x12
+	.byte	0x4
+	.file 39 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x27
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x7
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x6
+	.file 41 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 42 "./src/main/config/general_settings.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x2a
+	.byte	0x4
+	.file 43 "./src/main/flight/rpm_filter.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x2b
+	.file 44 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2c
+	.file 45 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2d
+	.file 46 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 47 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 48 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x30
+	.byte	0x4
+	.file 49 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0xf
+	.file 50 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 51 "./src/main/sensors/gyro.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 52 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.file 53 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x35
+	.file 54 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x37
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2532
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF522
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2559
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.file 64 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 66 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2655
+	.byte	0x4
+	.file 67 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2656
+	.file 68 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x4
+	.file 69 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x45
+	.file 70 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2669
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.file 71 "./src/main/flight/dynamic_gyro_notch.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x47
+	.file 72 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 73 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x49
+	.file 74 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4a
+	.file 75 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 76 "./src/main/sensors/opflow.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x4c
+	.file 77 "./src/main/drivers/opflow/opflow.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x4
+	.file 78 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x4
+	.file 80 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x50
+	.file 81 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x51
+	.byte	0x4
+	.byte	0x4
+	.file 82 "./src/main/sensors/pitotmeter.h"
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x52
+	.file 83 "./src/main/common/calibration.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x53
+	.byte	0x4
+	.file 84 "./src/main/drivers/pitotmeter.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 85 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 86 "./src/main/rx/spektrum.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 87 "./src/main/blackbox/blackbox.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x57
+	.file 88 "./src/main/blackbox/blackbox_fielddefs.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x4
+	.file 89 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 90 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 91 "./src/main/sensors/boardalignment.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x5b
+	.byte	0x4
+	.file 92 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5c
+	.file 93 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 94 "./src/main/flight/servos.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.file 95 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5f
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2772
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.file 96 "./src/main/fc/controlrate_profile.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x60
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 97 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x61
+	.file 98 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x62
+	.file 99 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.file 100 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x64
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.file 101 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x65
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 102 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x66
+	.file 103 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x67
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF3185
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xb
+	.file 104 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x68
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.file 105 "./src/main/navigation/navigation.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x69
+	.file 106 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6a
+	.byte	0x4
+	.file 107 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6b
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.file 108 "./src/main/telemetry/telemetry.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x6c
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF3231
+	.byte	0x4
+	.file 109 "./src/main/telemetry/frsky_d.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6d
+	.byte	0x4
+	.file 110 "./src/main/telemetry/sim.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6e
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF3237
+	.byte	0x4
+	.file 111 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF3238
+	.byte	0x4
+	.file 112 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x70
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xd
+	.file 113 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x71
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.file 114 "./src/main/drivers/display.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x72
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.file 115 "./src/main/io/vtx_control.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x73
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF3269
+	.byte	0x4
+	.file 116 "./src/main/drivers/vtx_common.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x74
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.file 117 "./src/main/io/vtx.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x75
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF396
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF397
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF398
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF433
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF435
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF459
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF460
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF519
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF521
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF539
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF582
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF395
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF550
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF552
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF562
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF648
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF650
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF654
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF718
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF732
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF733
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF749
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF750
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF751
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF585
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF752
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF781
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.h.5.95ec26d3adfb4cfd6960efdee0b2ba1c,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x5
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x6
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xd3
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xe9
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xff
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x14e
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x14f
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x150
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x156
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x158
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x15a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x15e
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x160
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x161
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x162
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x163
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x167
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x168
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x169
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x16a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x16b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x170
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x171
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x172
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x173
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x174
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x175
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x179
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x17a
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x17b
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x17c
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x17d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x17e
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x183
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x184
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x185
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x186
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x187
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x18e
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x190
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x195
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x196
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x197
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x199
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x19d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x19e
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1a0
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1a2
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1a6
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1a7
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1a8
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1a9
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1ab
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1b0
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1b1
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1b2
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x1b4
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1b8
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1c1
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1c2
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1c3
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1c4
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x1ca
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x1d3
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x1d4
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x1d7
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1d8
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e5
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1e6
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x1e7
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1e8
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1e9
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1ea
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x1f2
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x1f3
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x1f7
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1f8
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1fa
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x1fb
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1fc
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x202
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x203
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x204
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x205
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x206
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x207
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x208
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x209
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x20d
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x20e
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x20f
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x210
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x211
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x212
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x217
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x218
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x219
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x21a
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x21b
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x21f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x221
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x222
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x223
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x224
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x22a
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x22c
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x22d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x231
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x232
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x233
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x234
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x235
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x236
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x23a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x23b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x23c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x23e
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x23f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x243
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x244
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x245
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x246
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x247
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x248
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x24c
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x24d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x24e
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x24f
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x250
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x251
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x255
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x256
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x257
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x258
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x259
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x25a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x25e
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x25f
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x260
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x261
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x262
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x263
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x267
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x268
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x269
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x270
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x273
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x274
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x275
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x279
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x27a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x27b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x27c
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x282
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x283
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x284
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x285
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x286
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x287
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x28b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x28c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x28d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x28e
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x28f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x294
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x295
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x296
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x297
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x298
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x299
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x29d
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x29e
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x29f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2a0
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2a1
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2a2
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2a7
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2a8
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2a9
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x2aa
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x2ab
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2af
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x2b0
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2b1
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2b2
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2b4
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2b8
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2b9
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2ba
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2bb
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2bc
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2bd
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x2c1
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2c2
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x2c3
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x2c4
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x2c5
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2c6
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x2ca
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x2cb
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x2cc
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x2cd
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x2ce
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2cf
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2d3
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x2d4
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x2d5
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x2d6
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x2d7
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x2d8
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x2dc
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x2dd
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2de
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x2df
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x2e0
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x2e1
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2e5
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2e6
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2e7
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2e8
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x2e9
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2ea
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2ee
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2ef
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x2f0
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x2f1
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2f2
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x2f3
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2f7
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2f8
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x2f9
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2fa
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2fb
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2fc
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x300
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x301
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x302
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x303
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x304
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x305
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x309
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x30a
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x30b
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x30c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x30d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x30e
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x312
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x313
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x314
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x315
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x316
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x317
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x31b
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x31c
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x31d
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x31e
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x31f
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x320
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x324
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x325
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x326
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x327
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x328
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x329
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x32d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x32e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x32f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x330
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x331
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x332
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x336
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x337
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x338
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x339
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x33a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x33b
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x33f
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x340
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x341
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x342
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x343
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x344
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x348
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x349
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x34a
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x34b
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x34c
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x34d
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x351
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x352
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x353
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x354
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x35a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x35b
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x35c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x35d
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x35e
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x35f
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x363
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x364
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x365
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x366
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x367
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x368
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x36c
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x36d
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x36e
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x36f
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x370
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x371
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x375
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x376
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x377
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x378
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x379
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x37e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x37f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x380
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x382
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x383
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x387
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x388
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x389
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x38a
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x38b
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x38c
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x390
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x391
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x392
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x393
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x394
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x395
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x399
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x39a
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x39b
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x39c
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x39d
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x39e
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x3a2
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x3a3
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x3a4
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x3a5
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x3a6
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x3a7
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3ab
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x3ad
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x3ae
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x3b0
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x3b4
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x3b6
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x3b7
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x3b8
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x3b9
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x3bd
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x3be
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x3bf
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x3c0
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x3c1
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x3c2
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x3c6
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x3c8
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x3c9
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x3ca
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x3cb
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x3d0
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x3d1
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x3d2
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x3d3
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x3d4
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x3d8
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3d9
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x3da
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x3db
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x3dc
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3dd
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x3e1
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x3e3
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x3e4
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x3e5
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x3e6
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x3eb
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x3ec
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x3ed
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x3ee
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x3ef
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x3f4
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x3f5
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x3f6
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x3f7
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x3f8
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x3fc
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x3fd
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x3fe
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x3ff
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x400
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x401
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x406
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x407
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x408
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x409
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x40a
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x40e
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x40f
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x410
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x411
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x412
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x413
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x417
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x419
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x41a
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x41b
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x41c
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x420
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x421
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x422
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x423
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x424
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x425
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x429
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x42a
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x42b
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x42c
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x42d
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x42e
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x432
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x433
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x434
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x435
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x436
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x437
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x43b
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x43c
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x43d
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x43e
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x43f
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x440
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x444
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x445
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x446
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x448
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x449
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x44a
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x44b
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x44c
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x44d
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x44e
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x44f
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x450
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x451
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x452
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x453
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x454
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x455
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x456
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x457
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x458
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x459
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x45a
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x45b
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x45c
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x45d
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x45e
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x45f
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x460
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x464
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x465
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x466
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x467
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x468
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x469
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x46a
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x46b
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x46c
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x46d
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x46e
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x46f
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x470
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x471
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x472
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x473
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x474
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x475
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x476
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x477
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x478
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x479
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x487
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x488
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x489
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x48a
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x48b
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x48c
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x48d
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x48e
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x48f
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x490
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x491
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x492
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x493
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x494
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x495
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x496
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x497
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x498
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x499
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x49a
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x49b
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x49c
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x49d
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x49e
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x49f
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x4a0
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x4a1
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x4a2
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x4a3
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x4a4
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x4a5
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x4a6
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x4a7
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x4a8
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x4a9
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x4aa
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x4ab
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x4ac
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x4ad
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x4ae
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x4af
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x4b0
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x4b1
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x4b2
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x4b3
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x4b4
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x4b5
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x4b6
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x4b7
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x4b8
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x4b9
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x4ba
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x4bb
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x4bc
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x4bd
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x4be
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x4bf
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x4c0
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x4c1
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x4c2
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x4c3
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x4c4
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x4c5
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x4c6
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x4c7
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x4c8
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x4c9
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x4ca
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x4cb
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x4cc
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x4cd
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x4ce
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x4cf
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x4d0
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x4d1
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x4d2
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x4d3
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x4d4
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x4d5
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x4d6
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x4d7
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x4d8
+	.long	.LASF1925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1930
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1940
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings.h.16.1637a02f3a7633a7e8826a2412c67a99,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1969
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2030
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2041
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2055
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2062
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2075
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2085
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF2086
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF2087
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF2088
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF2089
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF2090
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF2091
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF2092
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF2093
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF2094
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF2095
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF2096
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF2097
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF2098
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF2099
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF2100
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF2101
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF2102
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF2103
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF2104
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF2105
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF2106
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF2107
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF2108
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2110
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2111
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2112
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2113
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2114
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2115
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2116
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2117
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2118
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2119
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2120
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2121
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2122
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2123
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF2089
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF2090
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2125
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2126
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2127
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2128
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2131
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2132
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2133
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2134
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2135
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2136
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2137
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2138
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2139
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2140
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2141
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2142
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rpm_filter.h.46.638ccbdb612f529ec85646b839a0f5ec,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2144
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2145
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2146
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2147
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2148
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2149
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2151
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2152
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2153
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2154
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2155
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2156
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2157
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2158
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2159
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2160
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2161
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2162
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2163
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2164
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2165
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2166
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2168
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2169
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2170
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2172
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2173
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2174
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2175
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2177
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2178
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2179
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2180
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2181
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2182
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2183
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2184
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2185
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2186
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2187
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2188
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2189
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2190
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2191
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2192
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2193
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2194
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2195
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2197
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2198
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2199
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2200
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2201
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2202
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2203
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2204
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2205
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2206
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2207
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2208
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2209
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2210
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2211
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2212
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2213
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2214
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2215
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2216
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2217
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2218
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2219
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2220
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2221
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2222
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2223
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2224
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2225
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2226
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2227
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2228
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2229
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2230
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2231
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2232
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2233
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2234
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2236
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2237
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2238
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2239
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2240
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2241
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2242
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2243
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2244
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2245
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2246
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2247
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2248
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2249
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2251
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2252
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2253
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2254
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2256
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2257
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2258
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2259
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2260
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2261
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2262
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2263
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2264
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2265
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2266
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2267
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2268
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2270
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2271
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2272
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2273
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2274
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2275
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2276
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2277
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2278
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2279
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2280
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF2281
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2282
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2283
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2284
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2285
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2286
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF2287
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2288
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2289
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2290
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2291
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2292
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2294
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2295
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2296
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF2297
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF2298
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2299
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2300
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2301
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2302
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2303
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2304
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2305
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2306
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2308
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2309
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2310
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2311
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2312
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2313
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2314
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2315
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2316
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2317
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2318
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2319
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2320
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF2321
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF2322
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF2323
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF2324
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2325
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2326
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2327
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2328
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF2329
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2330
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF2331
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF2332
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF2333
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2334
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2335
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2336
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF2337
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF2338
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF2339
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF2340
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF2341
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2342
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2343
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2344
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF2345
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2346
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2347
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2348
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF2349
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2350
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2351
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2352
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2353
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF2354
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF2355
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF2356
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF2357
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2358
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2359
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2360
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF2361
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF2362
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2363
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF2365
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2366
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2367
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2368
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF2369
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF2370
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2371
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF2372
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF2373
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF2374
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2375
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2376
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF2377
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2378
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF2379
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF2380
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2381
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF2382
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2383
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2384
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF2385
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF2386
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF2387
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF2388
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2389
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2390
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2391
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2392
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2393
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF2394
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF2395
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF2396
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2397
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF2398
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2399
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2400
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2401
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF2402
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF2403
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF2404
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF2405
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF2406
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2408
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2409
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF2410
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2411
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF2412
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF2413
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF2414
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2415
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2416
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2417
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2418
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF2419
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF2420
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2421
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF2422
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF2423
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2424
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2425
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF2426
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF2428
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF2429
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF2430
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF2431
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2432
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2433
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2434
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF2435
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF2436
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF2437
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2438
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF2439
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2440
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2441
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2442
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF2443
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF2444
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF2445
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF2446
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF2447
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2448
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2449
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2450
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF2451
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF2453
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF2454
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2455
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2456
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2457
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2458
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2459
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2460
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2461
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF2462
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF2463
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2464
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2465
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2466
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF2467
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF2468
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF2469
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF2470
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF2472
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2473
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2474
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2475
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF2476
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF2477
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF2478
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2479
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF2480
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2481
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2482
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2483
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF2485
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF2486
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2487
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF2488
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2489
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2490
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2491
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2492
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF2493
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2494
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF2495
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF2496
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2497
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2498
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2499
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2500
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF2501
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF2502
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2503
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2504
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2505
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2506
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2507
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF2508
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF2509
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF2510
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF2511
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF2512
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF2513
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2514
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2515
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF2516
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF2517
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2518
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2519
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2520
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2521
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2522
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2523
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2524
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2525
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2526
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2527
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2528
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2529
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2530
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2531
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2533
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2534
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2535
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2536
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2537
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2538
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2539
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2540
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2541
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF2542
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2543
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2544
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF2545
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2546
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2547
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2548
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF2549
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2550
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2551
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF2552
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF2553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2554
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2555
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2556
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2557
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2558
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2560
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2561
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF2562
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2564
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF2565
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2566
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2567
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF2568
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF2569
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2570
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF2571
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF2572
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2573
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF2574
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF2575
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF2576
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF2577
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF2583
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF2584
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF2578
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2586
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2587
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF2578
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF2588
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF2589
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF2590
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF2591
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF2592
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF2593
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF2591
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF2594
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF2595
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF2591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2596
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF2597
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF2591
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF2582
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2598
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2599
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF2585
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF2591
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF2579
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF2580
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF2581
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF2582
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF2600
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF2601
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF2602
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF2603
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF2604
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2605
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF2606
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF2607
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF2608
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF2609
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF2610
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF2611
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF2612
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF2613
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF2614
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF2615
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF2616
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF2617
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF2618
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF2619
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF2620
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF2621
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF2622
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF2623
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF2624
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF2625
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF2626
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF2627
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF2628
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF2629
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF2630
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2631
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2632
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF2633
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF2634
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF2635
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF2636
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF2637
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF2638
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF2639
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF2640
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF2641
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF2642
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF2643
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF2644
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF2645
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF2646
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF2647
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF2648
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF2649
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF2650
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF2651
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF2652
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF2653
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF2654
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2657
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2658
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2659
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2660
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2661
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2662
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2663
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2664
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF2665
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2666
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2667
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF2668
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2670
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2671
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2672
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2673
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2674
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2675
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2676
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2677
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2678
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2679
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF2680
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF2681
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF2682
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF2683
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2684
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF2685
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF2686
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2687
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2688
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2689
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2690
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2691
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2692
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dynamic_gyro_notch.h.31.50c3813220153a671121a0c9126722b8,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2693
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2694
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2695
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2696
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2697
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2701
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2702
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2704
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2705
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2706
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2707
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2708
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2709
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2710
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2711
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2712
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2713
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2714
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2715
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2717
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2718
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2719
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2720
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2721
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2722
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2723
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2730
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF2731
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF2732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2733
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF2734
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF2735
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF2736
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2737
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2738
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2739
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2740
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2741
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2742
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF2743
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.spektrum.h.20.bf1a22e7b9a2678b107e3bcefbfe40b8,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2745
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF2746
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF2747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF2748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2749
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2750
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2751
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2752
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2753
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2754
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2755
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2756
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2757
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2758
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2759
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2760
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2761
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2762
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2763
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2764
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2766
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2767
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2769
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2770
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2775
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF2776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF2777
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF2778
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF2779
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2780
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2781
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2782
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF2783
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF2784
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2785
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2786
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2787
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF2788
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2789
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2790
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF2791
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF2792
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF2793
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF2794
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2795
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF2796
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF2797
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF2798
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2799
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2800
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2801
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2802
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2803
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2804
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF2805
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF2806
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2807
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2808
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF2809
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF2810
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2811
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2812
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2813
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2814
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2815
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2816
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF2817
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF2818
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF2819
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF2820
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF2821
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2822
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2823
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2824
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF2825
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF2826
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF2827
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2828
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF2829
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF2830
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2831
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2832
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2833
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2834
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2835
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2836
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF2837
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF2838
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2839
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2840
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2841
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2842
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF2843
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF2844
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2845
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF2846
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF2847
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF2848
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF2849
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF2850
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2851
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2852
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2853
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF2854
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2855
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF2856
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2857
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF2858
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF2859
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF2860
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF2861
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF2863
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF2864
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF2865
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF2866
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF2867
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2868
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF2869
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF2870
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF2871
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF2872
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF2873
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF2874
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF2875
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF2876
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF2877
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF2878
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF2879
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF2880
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF2881
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF2882
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF2883
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2884
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2885
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2886
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF2887
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF2888
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF2889
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF2890
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF2891
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF2892
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF2893
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF2894
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF2895
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF2896
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF2897
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF2898
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF2899
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF2900
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF2901
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2902
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2903
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2904
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF2905
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF2906
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF2907
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF2908
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF2909
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF2910
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF2911
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF2912
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF2913
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF2914
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF2915
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF2916
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF2917
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF2918
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF2919
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF2920
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF2921
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF2922
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF2923
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF2924
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF2925
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF2926
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF2927
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF2928
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF2929
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF2930
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF2931
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF2932
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF2933
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF2934
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF2935
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF2936
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF2937
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF2938
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF2939
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF2940
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF2941
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF2942
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF2943
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF2944
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF2945
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF2946
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF2947
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF2948
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF2949
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF2950
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF2951
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF2952
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF2953
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF2954
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF2955
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF2956
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF2957
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF2958
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF2959
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF2960
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF2961
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF2962
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF2963
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF2964
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF2965
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF2966
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF2967
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF2968
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF2969
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF2970
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF2971
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF2972
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF2973
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF2974
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF2975
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF2976
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF2977
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF2978
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF2979
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF2980
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF2981
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF2982
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF2983
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF2984
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF2985
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF2986
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF2987
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF2988
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF2989
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF2990
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF2991
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF2992
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF2993
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF2994
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF2995
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF2996
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF2997
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF2998
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF2999
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF3000
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF3001
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF3002
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF3003
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF3004
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF3005
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF3006
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF3007
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF3008
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF3009
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF3010
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF3011
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF3012
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF3013
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF3014
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF3015
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF3016
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF3017
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF3018
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF3019
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF3020
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF3021
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF3022
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF3023
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF3024
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF3025
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF3026
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF3027
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF3028
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF3029
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF3030
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF3031
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF3032
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF3033
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF3034
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF3035
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF3036
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF3037
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF3038
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF3039
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF3040
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF3041
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF3042
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF3043
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF3044
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF3045
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF3046
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF3047
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF3048
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF3049
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF3050
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF3051
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF3052
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF3053
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF3054
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF3055
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF3056
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF3057
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF3058
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF3059
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF3060
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF3061
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF3062
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF3063
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF3064
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF3065
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF3066
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF3067
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF3068
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF3069
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF3070
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF3071
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF3072
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF3073
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF3074
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF3075
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF3076
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF3077
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF3078
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF3079
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF3080
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF3081
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF3082
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF3083
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF3084
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF3085
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF3086
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF3087
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF3088
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF3089
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF3090
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF3091
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF3092
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF3093
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF3094
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF3095
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF3096
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF3097
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF3098
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF3099
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF3100
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF3101
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF3102
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF3103
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF3104
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF3105
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF3106
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF3107
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF3108
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF3109
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF3110
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF3111
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF3112
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF3113
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF3114
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF3115
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF3116
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF3117
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF3118
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF3119
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF3120
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF3121
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF3122
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF3123
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF3124
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF3125
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF3126
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF3127
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF3128
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF3129
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF3130
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF3131
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF3132
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF3133
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF3134
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF3135
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF3136
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF3137
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF3138
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF3139
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF3140
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF3141
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF3142
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF3143
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF3144
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF3145
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF3146
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF3147
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF3148
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF3149
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF3150
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF3151
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF3152
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF3153
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF3154
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF3155
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF3156
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF3157
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF3158
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF3159
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF3160
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF3161
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF3162
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF3163
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF3164
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF3165
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF3166
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF3167
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF3168
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF3169
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF3170
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF3171
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF3172
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF3173
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF3174
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF3175
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF3176
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF3177
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF3178
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF3179
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF3180
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF3181
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF3182
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF3183
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF3184
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF3186
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF3187
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF3188
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF3189
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF3190
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF3191
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF3192
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF3193
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF3194
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF3195
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF3196
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF3197
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF3198
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF3199
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF3200
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF3201
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF3202
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF3203
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3204
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF3205
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF3206
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF3207
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF3208
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF3209
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF3210
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF3211
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF3212
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF3213
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF3214
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF3215
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF3216
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF3217
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF3218
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF3219
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF3220
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF3221
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF3222
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF3223
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF3224
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF3225
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF3226
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF3227
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF3228
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF3229
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF3230
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sim.h.20.d798e0f87cd08d59e6edd46e560cd6fd,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF3232
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF3233
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF3234
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF3235
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF3236
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF3239
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF3240
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF3241
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3242
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF3243
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF3244
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF3245
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF3246
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF3247
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF3248
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF3249
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF3250
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF3251
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF3252
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF3253
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF3254
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF3255
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF3256
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF3257
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF3258
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF3259
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF3260
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF3261
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF3262
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF3263
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF3264
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF3265
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF3266
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF3267
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF3268
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.vtx_common.h.22.2c48dc42435dc79364a36588e37a4855,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF3270
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF3271
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF3272
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF3273
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF3274
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF3275
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF3276
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF3277
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF3278
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF3279
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF3280
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF3281
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF3282
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF3283
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF3284
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF3285
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF3286
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF3287
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF3288
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF3289
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF3290
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF3291
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF3292
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF3293
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF3294
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF3295
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF3296
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF3297
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF3298
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF3299
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF3300
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF3301
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF3302
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF3303
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF3304
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF3305
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF3306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.settings_generated.c.853.023a02db3009b66f749d74719c7aca88,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x355
+	.long	.LASF3307
+	.byte	0x5
+	.uleb128 0x356
+	.long	.LASF3308
+	.byte	0x5
+	.uleb128 0x4f8
+	.long	.LASF3309
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.long	.LASF1
+	.long	.LASF3694
+	.long	.LASF3695
+	.long	.LASF3696
+	.long	.LASF3697
+	.long	.LASF3698
+	.long	.LASF3699
+	.long	.LASF3700
+	.long	.LASF3701
+	.long	.LASF3702
+	.long	.LASF3703
+	.long	.LASF3704
+	.long	.LASF3705
+	.long	.LASF3706
+	.long	.LASF3707
+	.long	.LASF3708
+	.long	.LASF3709
+	.long	.LASF3710
+	.long	.LASF3711
+	.long	.LASF3712
+	.long	.LASF3713
+	.long	.LASF3714
+	.long	.LASF3715
+	.long	.LASF3716
+	.long	.LASF3717
+	.long	.LASF3718
+	.long	.LASF3719
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x76
+	.long	.LASF0
+	.byte	0
+	.long	.LASF3720
+	.byte	0x1a
+	.long	.LASF3721
+	.byte	0x16
+	.long	.LASF3722
+	.byte	0x16
+	.long	.LASF3723
+	.byte	0x16
+	.long	.LASF3724
+	.byte	0x1
+	.long	.LASF3725
+	.byte	0x5
+	.long	.LASF3726
+	.byte	0xb
+	.long	.LASF3727
+	.byte	0x4
+	.long	.LASF3728
+	.byte	0xa
+	.long	.LASF3729
+	.byte	0x10
+	.long	.LASF3730
+	.byte	0xc
+	.long	.LASF3731
+	.byte	0xa
+	.long	.LASF3732
+	.byte	0xb
+	.long	.LASF3733
+	.byte	0x4
+	.long	.LASF3734
+	.byte	0x1
+	.long	.LASF3735
+	.byte	0xb
+	.long	.LASF3736
+	.byte	0x19
+	.long	.LASF3737
+	.byte	0x4
+	.long	.LASF3738
+	.byte	0xb
+	.long	.LASF3739
+	.byte	0xb
+	.long	.LASF3740
+	.byte	0x19
+	.long	.LASF3741
+	.byte	0x16
+	.long	.LASF3742
+	.byte	0x19
+	.long	.LASF3743
+	.byte	0x19
+	.long	.LASF3744
+	.byte	0x16
+	.long	.LASF3745
+	.byte	0x16
+	.long	.LASF3746
+	.byte	0x18
+	.long	.LASF3747
+	.byte	0x16
+	.long	.LASF3748
+	.byte	0x17
+	.long	.LASF3749
+	.byte	0x17
+	.long	.LASF3750
+	.byte	0x15
+	.long	.LASF3751
+	.byte	0x15
+	.long	.LASF3752
+	.byte	0x19
+	.long	.LASF3753
+	.byte	0x1a
+	.long	.LASF3753
+	.byte	0x19
+	.long	.LASF3754
+	.byte	0x16
+	.long	.LASF3755
+	.byte	0x16
+	.long	.LASF3756
+	.byte	0x16
+	.long	.LASF3757
+	.byte	0x4
+	.long	.LASF3758
+	.byte	0x1a
+	.long	.LASF3759
+	.byte	0x3
+	.long	.LASF3760
+	.byte	0x5
+	.long	.LASF3761
+	.byte	0xc
+	.long	.LASF3762
+	.byte	0x4
+	.long	.LASF3763
+	.byte	0x14
+	.long	.LASF3764
+	.byte	0x12
+	.long	.LASF3765
+	.byte	0x11
+	.long	.LASF3766
+	.byte	0x12
+	.long	.LASF3767
+	.byte	0x12
+	.long	.LASF3768
+	.byte	0x5
+	.long	.LASF3769
+	.byte	0x10
+	.long	.LASF3770
+	.byte	0x4
+	.long	.LASF3771
+	.byte	0x4
+	.long	.LASF3772
+	.byte	0x19
+	.long	.LASF3773
+	.byte	0x16
+	.long	.LASF3774
+	.byte	0x16
+	.long	.LASF3775
+	.byte	0x16
+	.long	.LASF3776
+	.byte	0x16
+	.long	.LASF3777
+	.byte	0x16
+	.long	.LASF3778
+	.byte	0x16
+	.long	.LASF3779
+	.byte	0x16
+	.long	.LASF3780
+	.byte	0x16
+	.long	.LASF3781
+	.byte	0x16
+	.long	.LASF3782
+	.byte	0xa
+	.long	.LASF3783
+	.byte	0xa
+	.long	.LASF3784
+	.byte	0xa
+	.long	.LASF3785
+	.byte	0xa
+	.long	.LASF3786
+	.byte	0xa
+	.long	.LASF3787
+	.byte	0xa
+	.long	.LASF3788
+	.byte	0xa
+	.long	.LASF3789
+	.byte	0xc
+	.long	.LASF3790
+	.byte	0x4
+	.long	.LASF3791
+	.byte	0x10
+	.long	.LASF3792
+	.byte	0x6
+	.long	.LASF3793
+	.byte	0xa
+	.long	.LASF3794
+	.byte	0x10
+	.long	.LASF3794
+	.byte	0x9
+	.long	.LASF3795
+	.byte	0x10
+	.long	.LASF3795
+	.byte	0x8
+	.long	.LASF3796
+	.byte	0x10
+	.long	.LASF3796
+	.byte	0x7
+	.long	.LASF3797
+	.byte	0x10
+	.long	.LASF3798
+	.byte	0x4
+	.long	.LASF3797
+	.byte	0xa
+	.long	.LASF3799
+	.byte	0xf
+	.long	.LASF3800
+	.byte	0xf
+	.long	.LASF3801
+	.byte	0x2
+	.long	.LASF3802
+	.byte	0x2
+	.long	.LASF3803
+	.byte	0xc
+	.long	.LASF3804
+	.byte	0xc
+	.long	.LASF3805
+	.byte	0x10
+	.long	.LASF3806
+	.byte	0x10
+	.long	.LASF3762
+	.byte	0xa
+	.long	.LASF3807
+	.byte	0xc
+	.long	.LASF3808
+	.byte	0x4
+	.long	.LASF3809
+	.byte	0xb
+	.long	.LASF3810
+	.byte	0xd
+	.long	.LASF3810
+	.byte	0xa
+	.long	.LASF3811
+	.byte	0xa
+	.long	.LASF3812
+	.byte	0xa
+	.long	.LASF3813
+	.byte	0xa
+	.long	.LASF3814
+	.byte	0xc
+	.long	.LASF3815
+	.byte	0x4
+	.long	.LASF3816
+	.byte	0xb
+	.long	.LASF3817
+	.byte	0xe
+	.long	.LASF3818
+	.byte	0x5
+	.long	.LASF3819
+	.byte	0xd
+	.long	.LASF3820
+	.byte	0x13
+	.long	.LASF3821
+	.byte	0x13
+	.long	.LASF3822
+	.byte	0x13
+	.long	.LASF3823
+	.byte	0xa
+	.long	.LASF3824
+	.byte	0xb
+	.long	.LASF3825
+	.byte	0x4
+	.long	.LASF3826
+	.byte	0xa
+	.long	.LASF3827
+	.byte	0xd
+	.long	.LASF3828
+	.byte	0xa
+	.long	.LASF3829
+	.byte	0xd
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF3630:
+	.string	"getConfigBatteryProfile"
+.LASF3666:
+	.string	"settingGet"
+.LASF2719:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF3366:
+	.string	"TABLE_RECEIVER_TYPE"
+.LASF2367:
+	.string	"__DECL_SIMD_exp10l "
+.LASF588:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1805:
+	.string	"SETTING_FRSKY_UNIT_MAX 0"
+.LASF1994:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF682:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF728:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF3233:
+	.string	"SIM_DEFAULT_TRANSMIT_INTERVAL 60"
+.LASF1463:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MAX 255"
+.LASF2449:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF486:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF2952:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1310:
+	.string	"SETTING_MC_I_LEVEL_MAX 200"
+.LASF3135:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2843:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF3446:
+	.string	"setting_mode_e"
+.LASF1983:
+	.string	"USE_BLACKBOX "
+.LASF2362:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2138:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1506:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME 239"
+.LASF2000:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF3086:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2431:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1388:
+	.string	"SETTING_PIDSUM_LIMIT_MAX 1000"
+.LASF2181:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF3013:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1760:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MAX 5000"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2267:
+	.string	"__DECL_SIMD_sinl "
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1110:
+	.string	"SETTING_MODEL_PREVIEW_TYPE 107"
+.LASF422:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2704:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF3198:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF3216:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF383:
+	.string	"SITL 1"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF3310:
+	.string	"long unsigned int"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1170:
+	.string	"SETTING_YAW_RATE 127"
+.LASF734:
+	.string	"__wchar_t__ "
+.LASF2927:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1664:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MAX 65000"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2268:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF908:
+	.string	"SETTING_ALIGN_MAG_PITCH_MAX 3600"
+.LASF1950:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF901:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MIN 30"
+.LASF1174:
+	.string	"SETTING_MANUAL_RC_EXPO_MIN 0"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF3350:
+	.string	"TABLE_GYRO_LPF"
+.LASF1902:
+	.string	"SETTING_VTX_BAND 371"
+.LASF1456:
+	.string	"SETTING_NAV_FW_HEADING_P_MIN 0"
+.LASF3048:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2783:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF2316:
+	.string	"__DECL_SIMD_acosf "
+.LASF630:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2143:
+	.string	"RPM_FILTER_UPDATE_RATE_HZ 500"
+.LASF1273:
+	.string	"SETTING_MC_I_PITCH_MIN 0"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1995:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF581:
+	.string	"_SIZET_ "
+.LASF650:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1769:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MAX 60000"
+.LASF1890:
+	.string	"SETTING_TZ_OFFSET 367"
+.LASF2971:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF3094:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"SETTING_ACCZERO_X_MAX 32767"
+.LASF3498:
+	.string	"OWNER_1WIRE"
+.LASF566:
+	.string	"__SIZE_T__ "
+.LASF3162:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2231:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2737:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF2321:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF2374:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF3672:
+	.string	"getValueOffset"
+.LASF1049:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MAX 0"
+.LASF3223:
+	.string	"LON 1"
+.LASF2258:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF533:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1021:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MIN 0"
+.LASF2754:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF837:
+	.string	"SETTING_ACC_NOTCH_HZ 16"
+.LASF1173:
+	.string	"SETTING_MANUAL_RC_EXPO 128"
+.LASF999:
+	.string	"SETTING_MOTOR_DECEL_TIME 70"
+.LASF3308:
+	.string	"SETTING_INDEXES_GET_MAX(val) (val->config.minmax.indexes[1])"
+.LASF3647:
+	.string	"settingGetValueNameMaxSize"
+.LASF1644:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING 285"
+.LASF3499:
+	.string	"OWNER_AIRSPEED"
+.LASF3031:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1828:
+	.string	"SETTING_LTM_UPDATE_RATE_MIN 0"
+.LASF1814:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MAX 0"
+.LASF1269:
+	.string	"SETTING_MC_P_PITCH 160"
+.LASF511:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF410:
+	.string	"__USE_XOPEN2K8"
+.LASF2404:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF3296:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF2111:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1861:
+	.string	"SETTING_MAVLINK_POS_RATE_MIN 0"
+.LASF2344:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2760:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1449:
+	.string	"SETTING_NAV_FW_POS_XY_I 220"
+.LASF787:
+	.string	"SETTINGS_PGN_COUNT 36"
+.LASF719:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2465:
+	.string	"__DECL_SIMD_acosh "
+.LASF3302:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF2246:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1589:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MAX 0"
+.LASF1714:
+	.string	"SETTING_NAV_FW_MAX_THR_MIN 1000"
+.LASF1212:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE 141"
+.LASF1288:
+	.string	"SETTING_MC_D_ROLL_MIN 0"
+.LASF3090:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2727:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF2325:
+	.string	"__DECL_SIMD_atan "
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2938:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1059:
+	.string	"SETTING_ALIGN_BOARD_YAW 90"
+.LASF1677:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD 296"
+.LASF1943:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF792:
+	.string	"SETTING_GYRO_SYNC 1"
+.LASF987:
+	.string	"SETTING_MAX_THROTTLE 66"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1324:
+	.string	"SETTING_FW_P_ROLL_MIN 0"
+.LASF1434:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ 215"
+.LASF3082:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF3628:
+	.string	"settingNameHashSeeds"
+.LASF920:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MAX 1000"
+.LASF3193:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF479:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF3286:
+	.string	"VTX_SETTINGS_MIN_USER_FREQ 5000"
+.LASF2615:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF3507:
+	.string	"RESOURCE_IO"
+.LASF3041:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF970:
+	.string	"SETTING_RX_MAX_USEC_MIN 750"
+.LASF3029:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF405:
+	.string	"__USE_XOPEN"
+.LASF2023:
+	.string	"USE_DJI_HD_OSD "
+.LASF3590:
+	.string	"BOXSURFACE"
+.LASF3559:
+	.string	"PID_POS_HEADING"
+.LASF2629:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF2284:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF791:
+	.string	"SETTING_LOOPTIME_MAX 9000"
+.LASF2361:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF2019:
+	.string	"USE_OLED_UG2864 "
+.LASF1375:
+	.string	"SETTING_FW_LOITER_DIRECTION_MIN 0"
+.LASF3454:
+	.string	"minmax"
+.LASF1694:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MAX 1000"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1709:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MAX 2000"
+.LASF3074:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2735:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF3669:
+	.string	"name"
+.LASF2635:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF2298:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2081:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF883:
+	.string	"SETTING_ALIGN_MAG_MIN 0"
+.LASF991:
+	.string	"SETTING_MIN_COMMAND_MIN 0"
+.LASF3204:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1007:
+	.string	"SETTING_THROTTLE_SCALE_MAX 1"
+.LASF2974:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1792:
+	.string	"SETTING_TELEMETRY_INVERTED_MIN 0"
+.LASF3466:
+	.string	"OWNER_FREE"
+.LASF776:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF546:
+	.string	"__stub_setlogin "
+.LASF587:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2689:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF1253:
+	.string	"SETTING_YAW_DEADBAND_MAX 100"
+.LASF3085:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF3503:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF2869:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2564:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF844:
+	.string	"SETTING_ALIGN_ACC_MIN 0"
+.LASF2975:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1363:
+	.string	"SETTING_DTERM_LPF2_HZ_MIN 0"
+.LASF3579:
+	.string	"BOXLIGHTS"
+.LASF425:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF485:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1419:
+	.string	"SETTING_NAV_MC_VEL_XY_P 210"
+.LASF800:
+	.string	"SETTING_ALIGN_GYRO_MAX 0"
+.LASF917:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MAX 0"
+.LASF3649:
+	.string	"table"
+.LASF3242:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF2314:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1949:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF3152:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1175:
+	.string	"SETTING_MANUAL_RC_EXPO_MAX 100"
+.LASF3616:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF2668:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF948:
+	.string	"SETTING_RSSI_MAX 53"
+.LASF3626:
+	.string	"settingMinMaxTable"
+.LASF610:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1461:
+	.string	"SETTING_NAV_FW_POS_HDG_I 224"
+.LASF2494:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF2805:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1556:
+	.string	"SETTING_INAV_W_Z_GPS_P_MAX 10"
+.LASF864:
+	.string	"SETTING_ACCGAIN_X 25"
+.LASF2222:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF2169:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1186:
+	.string	"SETTING_MANUAL_YAW_RATE_MIN 0"
+.LASF1346:
+	.string	"SETTING_FW_I_LEVEL_MAX 200"
+.LASF1866:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE 359"
+.LASF1551:
+	.string	"SETTING_INAV_W_Z_BARO_P 254"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1166:
+	.string	"SETTING_ROLL_RATE_MAX 180"
+.LASF1358:
+	.string	"SETTING_DTERM_LPF_HZ_MAX 500"
+.LASF865:
+	.string	"SETTING_ACCGAIN_X_MIN 1"
+.LASF899:
+	.string	"SETTING_MAGZERO_Z_MAX 32767"
+.LASF1880:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MAX 0"
+.LASF1842:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH 351"
+.LASF3289:
+	.string	"VTX_SETTINGS_MAX_POWER (VTX_SETTINGS_POWER_COUNT - VTX_SETTINGS_MIN_POWER + 1)"
+.LASF1406:
+	.string	"SETTING_NAV_MC_POS_Z_P_MAX 255"
+.LASF2318:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1611:
+	.string	"SETTING_NAV_MANUAL_SPEED 274"
+.LASF1802:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MAX 1"
+.LASF2089:
+	.string	"USE_DASHBOARD"
+.LASF2987:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF903:
+	.string	"SETTING_ALIGN_MAG_ROLL 38"
+.LASF3570:
+	.string	"BOXHEADINGHOLD"
+.LASF641:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2317:
+	.string	"__DECL_SIMD_acosl "
+.LASF760:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1491:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR 234"
+.LASF944:
+	.string	"SETTING_RSSI_CHANNEL_MAX 18"
+.LASF2610:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2744:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1219:
+	.string	"SETTING_DISARM_KILL_SWITCH_MIN 0"
+.LASF1862:
+	.string	"SETTING_MAVLINK_POS_RATE_MAX 255"
+.LASF1195:
+	.string	"SETTING_IMU_DCM_KP_MIN 0"
+.LASF1339:
+	.string	"SETTING_FW_FF_YAW_MIN 0"
+.LASF768:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF3432:
+	.string	"VAR_INT8"
+.LASF2115:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF700:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF3159:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1278:
+	.string	"SETTING_MC_CD_PITCH 163"
+.LASF1877:
+	.string	"SETTING_NAME_MAX 16"
+.LASF983:
+	.string	"SETTING_BLACKBOX_DEVICE_MAX 0"
+.LASF894:
+	.string	"SETTING_MAGZERO_Y 35"
+.LASF1703:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MAX 255"
+.LASF1646:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MAX 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF2326:
+	.string	"__DECL_SIMD_atanf "
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1054:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MIN -1800"
+.LASF1208:
+	.string	"SETTING_SMALL_ANGLE_MAX 180"
+.LASF3328:
+	.string	"uint32_t"
+.LASF2807:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2650:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF3458:
+	.string	"config"
+.LASF2933:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1409:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MAX 255"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF2920:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF518:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2996:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1352:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MAX 900"
+.LASF3665:
+	.string	"settingGetIndex"
+.LASF1654:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MIN 0"
+.LASF2269:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF786:
+	.string	"SETTINGS_TABLE_COUNT 379"
+.LASF2408:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF3249:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1740:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY 317"
+.LASF2196:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF449:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF3210:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1088:
+	.string	"SETTING_THR_COMP_WEIGHT_MAX 2"
+.LASF2188:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF2011:
+	.string	"USE_1WIRE "
+.LASF1876:
+	.string	"SETTING_NAME_MIN 0"
+.LASF3429:
+	.string	"valueCount"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2983:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF3077:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1408:
+	.string	"SETTING_NAV_MC_VEL_Z_P_MIN 0"
+.LASF2851:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1874:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MAX 100"
+.LASF1386:
+	.string	"SETTING_PIDSUM_LIMIT 199"
+.LASF3564:
+	.string	"ADC_AIRSPEED"
+.LASF2559:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF2962:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3377:
+	.string	"table_airmodeHandlingType"
+.LASF2781:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF1763:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MAX 1000"
+.LASF3148:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF3230:
+	.string	"RADAR_MAX_POIS 5"
+.LASF2717:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF2184:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF2372:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF3292:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF730:
+	.string	"_GCC_PTRDIFF_T "
+.LASF3660:
+	.string	"settingGetValueSize"
+.LASF2061:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1864:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MIN 0"
+.LASF2546:
+	.string	"__f32(x) x ##f32"
+.LASF2661:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF3064:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1920:
+	.string	"SETTING_LOG_LEVEL 377"
+.LASF1570:
+	.string	"SETTING_INAV_W_XY_RES_V_MIN 0"
+.LASF3333:
+	.string	"TABLE_AIRMODEHANDLINGTYPE"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1891:
+	.string	"SETTING_TZ_OFFSET_MIN -1440"
+.LASF1899:
+	.string	"SETTING_VTX_HALFDUPLEX 370"
+.LASF2911:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1616:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MAX 2000"
+.LASF971:
+	.string	"SETTING_RX_MAX_USEC_MAX 2250"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF769:
+	.string	"BIT(x) (1 << (x))"
+.LASF2880:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF3391:
+	.string	"table_gps_dyn_model"
+.LASF3102:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2428:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2265:
+	.string	"__DECL_SIMD_sin "
+.LASF3508:
+	.string	"RESOURCE_TIMER"
+.LASF3069:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1098:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT 103"
+.LASF1882:
+	.string	"SETTING_STATS_MIN 0"
+.LASF2566:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF2868:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1031:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MAX 0"
+.LASF3671:
+	.string	"settingFind"
+.LASF2292:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2054:
+	.string	"USE_VTX_CONTROL "
+.LASF2125:
+	.string	"FAST_CODE "
+.LASF3012:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2264:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF3381:
+	.string	"table_bat_capacity_unit"
+.LASF3027:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"SETTING_MIN_COMMAND 67"
+.LASF3168:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF3256:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF984:
+	.string	"SETTING_BLACKBOX_COMPRESSION 65"
+.LASF1922:
+	.string	"SETTING_LOG_LEVEL_MAX 0"
+.LASF2444:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF3572:
+	.string	"BOXHEADADJ"
+.LASF1446:
+	.string	"SETTING_NAV_FW_POS_XY_P 219"
+.LASF817:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MIN 1"
+.LASF1497:
+	.string	"SETTING_PID_TYPE 236"
+.LASF3635:
+	.string	"strcmp"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF827:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MAX 0"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2623:
+	.string	"FP_SUBNORMAL 3"
+.LASF1280:
+	.string	"SETTING_MC_CD_PITCH_MAX 200"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1200:
+	.string	"SETTING_IMU_DCM_KP_MAG 137"
+.LASF1285:
+	.string	"SETTING_MC_I_ROLL_MIN 0"
+.LASF1546:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MIN 0"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2644:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF3371:
+	.string	"TABLE_SMARTPORT_FUEL_UNIT"
+.LASF882:
+	.string	"SETTING_ALIGN_MAG 31"
+.LASF2931:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF2475:
+	.string	"__DECL_SIMD_erf "
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF608:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF3367:
+	.string	"TABLE_RESET_TYPE"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF3105:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1367:
+	.string	"SETTING_DTERM_LPF2_TYPE_MAX 0"
+.LASF888:
+	.string	"SETTING_MAG_DECLINATION 33"
+.LASF3163:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF497:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1744:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MIN 1000"
+.LASF2556:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF3618:
+	.string	"LOG_TOPIC_VTX"
+.LASF456:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF2424:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF1774:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MIN 5"
+.LASF3078:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF3434:
+	.string	"VAR_INT16"
+.LASF849:
+	.string	"SETTING_ACC_LPF_HZ 20"
+.LASF1810:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MIN 0"
+.LASF507:
+	.string	"__wur "
+.LASF1124:
+	.string	"SETTING_3D_NEUTRAL_MAX 2000"
+.LASF1797:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE 336"
+.LASF1157:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MAX 5000"
+.LASF1070:
+	.string	"SETTING_CURRENT_METER_OFFSET_MAX 32767"
+.LASF1361:
+	.string	"SETTING_DTERM_LPF_TYPE_MAX 0"
+.LASF2365:
+	.string	"__DECL_SIMD_exp10 "
+.LASF664:
+	.string	"INT32_MAX (2147483647)"
+.LASF3236:
+	.string	"SIM_PIN \"0000\""
+.LASF1000:
+	.string	"SETTING_MOTOR_DECEL_TIME_MIN 0"
+.LASF2193:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1650:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD 287"
+.LASF1888:
+	.string	"SETTING_STATS_TOTAL_DIST_MIN 0"
+.LASF1197:
+	.string	"SETTING_IMU_DCM_KI 136"
+.LASF2616:
+	.string	"__MATHCALL_NARROW"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF931:
+	.string	"SETTING_RECEIVER_TYPE_MIN 0"
+.LASF3299:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF670:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1329:
+	.string	"SETTING_FW_FF_ROLL 180"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF3480:
+	.string	"OWNER_I2C"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1752:
+	.string	"SETTING_NAV_FW_LAUNCH_THR 321"
+.LASF1435:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MIN 0"
+.LASF2530:
+	.string	"__f128(x) x ##f128"
+.LASF648:
+	.string	"__FD_SETSIZE 1024"
+.LASF3419:
+	.string	"pgn_t"
+.LASF3180:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL 318"
+.LASF534:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF394:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF841:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MIN 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF3421:
+	.string	"size"
+.LASF2675:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1010:
+	.string	"SETTING_THROTTLE_IDLE_MAX 30"
+.LASF3062:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1704:
+	.string	"SETTING_NAV_MC_POS_EXPO 305"
+.LASF3461:
+	.string	"FD_ROLL"
+.LASF2182:
+	.string	"PG_INAV_START 1000"
+.LASF2766:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF913:
+	.string	"SETTING_BARO_HARDWARE_MIN 0"
+.LASF3226:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1662:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE 291"
+.LASF3531:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF3129:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2095:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF767:
+	.string	"UNUSED(x) (void)(x)"
+.LASF811:
+	.string	"SETTING_MORON_THRESHOLD_MIN 0"
+.LASF2634:
+	.string	"M_E 2.7182818284590452354"
+.LASF1011:
+	.string	"SETTING_MOTOR_POLES 74"
+.LASF872:
+	.string	"SETTING_ACCGAIN_Z_MAX 8192"
+.LASF875:
+	.string	"SETTING_OPFLOW_HARDWARE_MAX 0"
+.LASF3639:
+	.string	"strcpy"
+.LASF2888:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1057:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MIN -1800"
+.LASF1766:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MAX 60000"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2709:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF3281:
+	.string	"VTX_SETTINGS_MIN_FREQUENCY_MHZ 0"
+.LASF596:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF3370:
+	.string	"TABLE_SERVO_PROTOCOL"
+.LASF614:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF3354:
+	.string	"TABLE_LTM_RATES"
+.LASF1513:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MIN 0"
+.LASF616:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1840:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MIN 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1980:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF2290:
+	.string	"__DECL_SIMD_logf64 "
+.LASF2084:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1458:
+	.string	"SETTING_NAV_FW_POS_HDG_P 223"
+.LASF3576:
+	.string	"BOXMANUAL"
+.LASF623:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF489:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2797:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF905:
+	.string	"SETTING_ALIGN_MAG_ROLL_MAX 3600"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1134:
+	.string	"SETTING_SERVO_LPF_HZ 115"
+.LASF2017:
+	.string	"USE_DASHBOARD "
+.LASF1672:
+	.string	"SETTING_NAV_MC_HOVER_THR_MIN 1000"
+.LASF2291:
+	.string	"__DECL_SIMD_logf128 "
+.LASF416:
+	.string	"__USE_ATFILE"
+.LASF3175:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1274:
+	.string	"SETTING_MC_I_PITCH_MAX 200"
+.LASF3595:
+	.string	"BOXCAMERA1"
+.LASF548:
+	.string	"__stub_stty "
+.LASF3597:
+	.string	"BOXCAMERA3"
+.LASF1377:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED 196"
+.LASF1574:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MAX 1"
+.LASF2772:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF1749:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME 320"
+.LASF444:
+	.string	"_ATFILE_SOURCE"
+.LASF2062:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF2238:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF3315:
+	.string	"size_t"
+.LASF447:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1016:
+	.string	"SETTING_FAILSAFE_DELAY_MAX 200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2118:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2826:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF2680:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF2714:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF2104:
+	.string	"USE_VCP"
+.LASF2876:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF432:
+	.string	"__USE_ISOC95 1"
+.LASF3336:
+	.string	"TABLE_BARO_HARDWARE"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1758:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY 323"
+.LASF1302:
+	.string	"SETTING_MC_CD_YAW 171"
+.LASF2695:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF3360:
+	.string	"TABLE_NAV_USER_CONTROL_MODE"
+.LASF2442:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF916:
+	.string	"SETTING_BARO_MEDIAN_FILTER_MIN 0"
+.LASF877:
+	.string	"SETTING_OPFLOW_SCALE_MIN 0"
+.LASF3440:
+	.string	"PROFILE_VALUE"
+.LASF2939:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF537:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1165:
+	.string	"SETTING_ROLL_RATE_MIN 6"
+.LASF1214:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MAX 5"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF689:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1642:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MIN 0"
+.LASF2520:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF2280:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF3518:
+	.string	"RESOURCE_SPI_CS"
+.LASF2560:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1169:
+	.string	"SETTING_PITCH_RATE_MAX 180"
+.LASF1176:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO 129"
+.LASF1207:
+	.string	"SETTING_SMALL_ANGLE_MIN 0"
+.LASF1462:
+	.string	"SETTING_NAV_FW_POS_HDG_I_MIN 0"
+.LASF3183:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1630:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MIN 0"
+.LASF1853:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MAX 32767"
+.LASF3396:
+	.string	"table_iterm_relax_type"
+.LASF2261:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1993:
+	.string	"USE_PITOT_ADC "
+.LASF2168:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF2692:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF2338:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF993:
+	.string	"SETTING_MOTOR_PWM_RATE 68"
+.LASF3347:
+	.string	"TABLE_GPS_DYN_MODEL"
+.LASF1756:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MIN 1000"
+.LASF2162:
+	.string	"PG_RX_CONFIG 24"
+.LASF660:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF2542:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1858:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MIN 0"
+.LASF2867:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF3513:
+	.string	"RESOURCE_I2C_SCL"
+.LASF3099:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1344:
+	.string	"SETTING_FW_I_LEVEL 185"
+.LASF895:
+	.string	"SETTING_MAGZERO_Y_MIN -32768"
+.LASF2825:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1030:
+	.string	"SETTING_FAILSAFE_PROCEDURE_MIN 0"
+.LASF3017:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1717:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MIN 5"
+.LASF3104:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2935:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2808:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF1558:
+	.string	"SETTING_INAV_W_Z_GPS_V_MIN 0"
+.LASF3032:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF2609:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF2720:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2005:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF2818:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF480:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1747:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MIN 5"
+.LASF1238:
+	.string	"SETTING_GPS_AUTO_CONFIG_MAX 0"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF496:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF3067:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1338:
+	.string	"SETTING_FW_FF_YAW 183"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF3195:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1889:
+	.string	"SETTING_STATS_TOTAL_DIST_MAX 2147483647"
+.LASF3504:
+	.string	"RESOURCE_NONE"
+.LASF1480:
+	.string	"SETTING_D_BOOST_FACTOR_MIN 1"
+.LASF1637:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MAX 0"
+.LASF2630:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2146:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF3300:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF3463:
+	.string	"FD_YAW"
+.LASF2909:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF3602:
+	.string	"BOXBRAKING"
+.LASF3475:
+	.string	"OWNER_PINDEBUG"
+.LASF2241:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF3415:
+	.string	"table_smartport_fuel_unit"
+.LASF3575:
+	.string	"BOXNAVPOSHOLD"
+.LASF3130:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF667:
+	.string	"UINT16_MAX (65535)"
+.LASF603:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2550:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1340:
+	.string	"SETTING_FW_FF_YAW_MAX 200"
+.LASF3469:
+	.string	"OWNER_PPMINPUT"
+.LASF2913:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1937:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1440:
+	.string	"SETTING_NAV_FW_POS_Z_I 217"
+.LASF530:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF3682:
+	.string	"settingGetName"
+.LASF2252:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1067:
+	.string	"SETTING_CURRENT_METER_SCALE_MAX 10000"
+.LASF2642:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2047:
+	.string	"USE_SERIALRX_XBUS "
+.LASF2160:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1631:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE_MAX 5000"
+.LASF1320:
+	.string	"SETTING_FW_FF_PITCH 177"
+.LASF1665:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION 292"
+.LASF1736:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MAX 9"
+.LASF2740:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1587:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD 266"
+.LASF2951:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2865:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2576:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF3677:
+	.string	"settingNameIsExactMatch"
+.LASF3142:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2096:
+	.string	"USE_PITOT_MS4525"
+.LASF612:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF963:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT 58"
+.LASF3134:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF2751:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF825:
+	.string	"SETTING_GYRO_KALMAN_ENABLED 12"
+.LASF2429:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2863:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF3073:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1232:
+	.string	"SETTING_GPS_SBAS_MODE_MAX 0"
+.LASF3063:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MAX 4000"
+.LASF2666:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF2051:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF904:
+	.string	"SETTING_ALIGN_MAG_ROLL_MIN -1800"
+.LASF2956:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF3395:
+	.string	"table_iterm_relax"
+.LASF1569:
+	.string	"SETTING_INAV_W_XY_RES_V 260"
+.LASF3441:
+	.string	"CONTROL_RATE_VALUE"
+.LASF1686:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR 299"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2859:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1413:
+	.string	"SETTING_NAV_MC_VEL_Z_D 208"
+.LASF1726:
+	.string	"SETTING_NAV_FW_PITCH2THR_MIN 0"
+.LASF915:
+	.string	"SETTING_BARO_MEDIAN_FILTER 42"
+.LASF949:
+	.string	"SETTING_RSSI_MAX_MIN 0"
+.LASF2967:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3176:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF2698:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF3095:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF909:
+	.string	"SETTING_ALIGN_MAG_YAW 40"
+.LASF617:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3460:
+	.string	"setting_t"
+.LASF1415:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MAX 255"
+.LASF1096:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MIN 0"
+.LASF1215:
+	.string	"SETTING_FIXED_WING_AUTO_ARM 142"
+.LASF1851:
+	.string	"SETTING_SIM_LOW_ALTITUDE 354"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF2496:
+	.string	"__DECL_SIMD_asinhf "
+.LASF3055:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2312:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2282:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF2043:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1992:
+	.string	"USE_PITOT "
+.LASF2217:
+	.string	"sq(x) ((x)*(x))"
+.LASF2039:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF613:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF692:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF3035:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1503:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME 238"
+.LASF512:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2712:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF2357:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2828:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1652:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MAX 65000"
+.LASF3388:
+	.string	"table_failsafe_procedure"
+.LASF3413:
+	.string	"table_serial_rx"
+.LASF3414:
+	.string	"table_servo_protocol"
+.LASF1004:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MAX 0"
+.LASF1545:
+	.string	"SETTING_INAV_W_XY_FLOW_P 252"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2945:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF3355:
+	.string	"TABLE_MAG_HARDWARE"
+.LASF2406:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF3335:
+	.string	"TABLE_AUX_OPERATOR"
+.LASF3318:
+	.string	"__uint8_t"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2905:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF705:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF1114:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MIN 0"
+.LASF2806:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF457:
+	.string	"__GLIBC__ 2"
+.LASF1832:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MAX 16"
+.LASF3452:
+	.string	"settingLookupTableConfig_t"
+.LASF2473:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF584:
+	.string	"NULL"
+.LASF3003:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF2453:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF822:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE 11"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2934:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2063:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1687:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MIN 0"
+.LASF1623:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT 278"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1585:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MIN 0"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1258:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MIN 10"
+.LASF376:
+	.string	"unix 1"
+.LASF2834:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF2069:
+	.string	"USE_MAG "
+.LASF1382:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MAX 2"
+.LASF1231:
+	.string	"SETTING_GPS_SBAS_MODE_MIN 0"
+.LASF2201:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF967:
+	.string	"SETTING_RX_MIN_USEC_MIN 750"
+.LASF2947:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1425:
+	.string	"SETTING_NAV_MC_VEL_XY_D 212"
+.LASF816:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF 9"
+.LASF3201:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF3439:
+	.string	"MASTER_VALUE"
+.LASF2112:
+	.string	"U_ID_0 0"
+.LASF2995:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1641:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST 284"
+.LASF2793:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF2734:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF2769:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1959:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2840:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF922:
+	.string	"SETTING_PITOT_HARDWARE_MIN 0"
+.LASF1508:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MAX 500"
+.LASF1072:
+	.string	"SETTING_CURRENT_METER_TYPE_MIN 0"
+.LASF2156:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF3140:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF3389:
+	.string	"table_filter_type"
+.LASF3553:
+	.string	"PID_POS_XY"
+.LASF2008:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2458:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF395:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF2598:
+	.string	"_Mdouble_ _Float64x"
+.LASF475:
+	.string	"__ptr_t void *"
+.LASF1549:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MIN 0"
+.LASF2302:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1309:
+	.string	"SETTING_MC_I_LEVEL_MIN 0"
+.LASF1149:
+	.string	"SETTING_TPA_RATE 120"
+.LASF2910:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3182:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1816:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MIN 0"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2853:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF1199:
+	.string	"SETTING_IMU_DCM_KI_MAX 65535"
+.LASF3258:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF3477:
+	.string	"OWNER_RANGEFINDER"
+.LASF1148:
+	.string	"SETTING_THR_EXPO_MAX 100"
+.LASF3110:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2004:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1627:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MIN 100"
+.LASF3028:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1357:
+	.string	"SETTING_DTERM_LPF_HZ_MIN 0"
+.LASF3392:
+	.string	"table_gps_provider"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF439:
+	.string	"__USE_POSIX2 1"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF3433:
+	.string	"VAR_UINT16"
+.LASF2764:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1045:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MIN 0"
+.LASF1064:
+	.string	"SETTING_VBAT_METER_TYPE_MAX 0"
+.LASF3050:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2029:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1279:
+	.string	"SETTING_MC_CD_PITCH_MIN 0"
+.LASF493:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2872:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2339:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF3684:
+	.string	"word"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2438:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF2459:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1412:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MAX 255"
+.LASF788:
+	.string	"SETTING_MIN_MAX_INDEX_BYTES 2"
+.LASF1719:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE 310"
+.LASF1529:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MAX 0"
+.LASF2439:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1308:
+	.string	"SETTING_MC_I_LEVEL 173"
+.LASF3481:
+	.string	"OWNER_SDCARD"
+.LASF3178:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1326:
+	.string	"SETTING_FW_I_ROLL 179"
+.LASF862:
+	.string	"SETTING_ACCZERO_Z_MIN -32768"
+.LASF1997:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF860:
+	.string	"SETTING_ACCZERO_Y_MAX 32767"
+.LASF2619:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1441:
+	.string	"SETTING_NAV_FW_POS_Z_I_MIN 0"
+.LASF3568:
+	.string	"BOXHORIZON"
+.LASF1423:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MIN 0"
+.LASF2319:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2681:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF3489:
+	.string	"OWNER_LED_STRIP"
+.LASF3227:
+	.string	"HDOP_SCALE (100)"
+.LASF1194:
+	.string	"SETTING_IMU_DCM_KP 135"
+.LASF2311:
+	.string	"__DECL_SIMD_powf128 "
+.LASF2281:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1475:
+	.string	"SETTING_MC_ITERM_RELAX_MAX 0"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF3079:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT 300"
+.LASF2801:
+	.string	"IOCFG_AF_OD 0"
+.LASF793:
+	.string	"SETTING_GYRO_SYNC_MIN 0"
+.LASF1210:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MIN 0"
+.LASF1250:
+	.string	"SETTING_DEADBAND_MAX 32"
+.LASF782:
+	.string	"SETTING_MAX_NAME_LENGTH 37"
+.LASF2345:
+	.string	"__DECL_SIMD_hypot "
+.LASF2981:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1541:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MAX 100"
+.LASF3368:
+	.string	"TABLE_RSSI_SOURCE"
+.LASF785:
+	.string	"SETTINGS_WORDS_BITS_PER_CHAR 5"
+.LASF3605:
+	.string	"BOXFPVANGLEMIX"
+.LASF1319:
+	.string	"SETTING_FW_I_PITCH_MAX 200"
+.LASF2992:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF3199:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF3083:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF2323:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF3435:
+	.string	"VAR_UINT32"
+.LASF1439:
+	.string	"SETTING_NAV_FW_POS_Z_P_MAX 255"
+.LASF1653:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT 288"
+.LASF445:
+	.string	"_ATFILE_SOURCE 1"
+.LASF3161:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1315:
+	.string	"SETTING_FW_P_PITCH_MIN 0"
+.LASF2384:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1252:
+	.string	"SETTING_YAW_DEADBAND_MIN 0"
+.LASF3228:
+	.string	"NAV_BLACKBOX "
+.LASF3196:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1820:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MAX 0"
+.LASF1869:
+	.string	"SETTING_DEBUG_MODE 360"
+.LASF3688:
+	.string	"used_bits"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1254:
+	.string	"SETTING_POS_HOLD_DEADBAND 155"
+.LASF2736:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF2497:
+	.string	"__DECL_SIMD_asinhl "
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1029:
+	.string	"SETTING_FAILSAFE_PROCEDURE 80"
+.LASF1707:
+	.string	"SETTING_NAV_FW_CRUISE_THR 306"
+.LASF2049:
+	.string	"USE_SERIALRX_CRSF "
+.LASF2823:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF747:
+	.string	"_GCC_WCHAR_T "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF3107:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF458:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF3631:
+	.string	"getConfigProfile"
+.LASF946:
+	.string	"SETTING_RSSI_MIN_MIN 0"
+.LASF2334:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1300:
+	.string	"SETTING_MC_D_YAW_MIN 0"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF3675:
+	.string	"settingNameHash"
+.LASF1578:
+	.string	"SETTING_INAV_MAX_EPH_EPV 263"
+.LASF2977:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1397:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MAX 500000"
+.LASF2502:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF547:
+	.string	"__stub_sigreturn "
+.LASF1289:
+	.string	"SETTING_MC_D_ROLL_MAX 200"
+.LASF3581:
+	.string	"BOXOSD"
+.LASF622:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF2749:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF3610:
+	.string	"LOG_TOPIC_GYRO"
+.LASF2583:
+	.string	"_Mdouble_ float"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2378:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2570:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1225:
+	.string	"SETTING_APPLIED_DEFAULTS_MIN 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2999:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1323:
+	.string	"SETTING_FW_P_ROLL 178"
+.LASF3160:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF2605:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1837:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MIN 10"
+.LASF2022:
+	.string	"USE_FRSKYOSD "
+.LASF3207:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF3485:
+	.string	"OWNER_OSD"
+.LASF3222:
+	.string	"LAT 0"
+.LASF3224:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2791:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF1121:
+	.string	"SETTING_3D_DEADBAND_HIGH_MAX 2000"
+.LASF1437:
+	.string	"SETTING_NAV_FW_POS_Z_P 216"
+.LASF2889:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1133:
+	.string	"SETTING_SERVO_PWM_RATE_MAX 498"
+.LASF2310:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2687:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF1824:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE 345"
+.LASF1018:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MIN 0"
+.LASF821:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MAX 500"
+.LASF2134:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF3385:
+	.string	"table_current_sensor"
+.LASF2194:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF724:
+	.string	"_T_PTRDIFF_ "
+.LASF746:
+	.string	"__INT_WCHAR_T_H "
+.LASF2301:
+	.string	"__DECL_SIMD_expf128 "
+.LASF621:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF775:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF460:
+	.string	"_SYS_CDEFS_H 1"
+.LASF3005:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF992:
+	.string	"SETTING_MIN_COMMAND_MAX 2000"
+.LASF1052:
+	.string	"SETTING_FAILSAFE_MISSION_MAX 0"
+.LASF1203:
+	.string	"SETTING_IMU_DCM_KI_MAG 138"
+.LASF1276:
+	.string	"SETTING_MC_D_PITCH_MIN 0"
+.LASF3411:
+	.string	"table_reset_type"
+.LASF3020:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF2702:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1586:
+	.string	"SETTING_NAV_DISARM_ON_LANDING_MAX 0"
+.LASF2355:
+	.string	"__DECL_SIMD_exp2 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF2541:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF579:
+	.string	"___int_size_t_h "
+.LASF2363:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF679:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1618:
+	.string	"SETTING_NAV_LANDING_SPEED_MIN 100"
+.LASF773:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1245:
+	.string	"SETTING_GPS_MIN_SATS 152"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2348:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF3349:
+	.string	"TABLE_GPS_SBAS_MODE"
+.LASF3364:
+	.string	"TABLE_PITOT_HARDWARE"
+.LASF3548:
+	.string	"AUX12"
+.LASF2036:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF3114:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF3106:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"SETTING_NAV_FW_POS_XY_D 221"
+.LASF2299:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1113:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH 108"
+.LASF2748:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF2838:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF2394:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2921:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1123:
+	.string	"SETTING_3D_NEUTRAL_MIN 1000"
+.LASF2180:
+	.string	"PG_CF_END 56"
+.LASF1140:
+	.string	"SETTING_TRI_UNARMED_SERVO 117"
+.LASF2943:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF3478:
+	.string	"OWNER_SYSTEM"
+.LASF2236:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF3529:
+	.string	"SENSOR_INDEX_MAG"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF2349:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF2499:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2886:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF1418:
+	.string	"SETTING_NAV_MC_POS_XY_P_MAX 255"
+.LASF2364:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1122:
+	.string	"SETTING_3D_NEUTRAL 111"
+.LASF417:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1786:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MIN 0"
+.LASF3444:
+	.string	"MODE_DIRECT"
+.LASF2295:
+	.string	"__DECL_SIMD_exp "
+.LASF1688:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_FACTOR_MAX 200"
+.LASF1522:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MIN 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2678:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF2637:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1584:
+	.string	"SETTING_NAV_DISARM_ON_LANDING 265"
+.LASF703:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF2392:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1391:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MAX 1000"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF3164:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2185:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1095:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL 102"
+.LASF3186:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2015:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1841:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS_MAX 5"
+.LASF997:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MIN 0"
+.LASF2016:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1693:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD_MIN 100"
+.LASF1107:
+	.string	"SETTING_HAS_FLAPS 106"
+.LASF2600:
+	.string	"__MATHDECL_1_IMPL"
+.LASF2209:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF653:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF3133:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MIN 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF2244:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF942:
+	.string	"SETTING_RSSI_CHANNEL 51"
+.LASF3151:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2490:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1833:
+	.string	"SETTING_SIM_PIN 348"
+.LASF1179:
+	.string	"SETTING_MANUAL_ROLL_RATE 130"
+.LASF3054:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"SETTING_D_BOOST_FACTOR 230"
+.LASF2501:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF777:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF2170:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF3136:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1844:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MAX 65535"
+.LASF3471:
+	.string	"OWNER_SERVO"
+.LASF1907:
+	.string	"SETTING_VTX_CHANNEL_MAX 8"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF3692:
+	.string	"rc_alias"
+.LASF2814:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF2332:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF911:
+	.string	"SETTING_ALIGN_MAG_YAW_MAX 3600"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1779:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE 330"
+.LASF2577:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1159:
+	.string	"SETTING_RC_EXPO_MIN 0"
+.LASF575:
+	.string	"_SIZE_T_DEFINED "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF774:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1510:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MIN 0"
+.LASF2352:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2447:
+	.string	"__DECL_SIMD_log1pl "
+.LASF2536:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1755:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR 322"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF3046:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1464:
+	.string	"SETTING_NAV_FW_POS_HDG_D 225"
+.LASF2894:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF699:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1956:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1511:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD_MAX 100"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2779:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF3585:
+	.string	"BOXNAVWP"
+.LASF743:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1524:
+	.string	"SETTING_INAV_USE_GPS_VELNED 245"
+.LASF1048:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE_MIN 0"
+.LASF544:
+	.string	"__stub_gtty "
+.LASF1537:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MIN 0"
+.LASF3663:
+	.string	"setting"
+.LASF3407:
+	.string	"table_pidTypeTable"
+.LASF2937:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1484:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MAX 16000"
+.LASF397:
+	.string	"__USE_ISOC11"
+.LASF1713:
+	.string	"SETTING_NAV_FW_MAX_THR 308"
+.LASF3332:
+	.string	"TABLE_ACC_HARDWARE"
+.LASF976:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MIN 1"
+.LASF3399:
+	.string	"table_mag_hardware"
+.LASF2976:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF455:
+	.string	"__GNU_LIBRARY__"
+.LASF2917:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2285:
+	.string	"__DECL_SIMD_log "
+.LASF1663:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DISTANCE_MIN 0"
+.LASF1530:
+	.string	"SETTING_INAV_RESET_ALTITUDE 247"
+.LASF2131:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1566:
+	.string	"SETTING_INAV_W_Z_RES_V 259"
+.LASF1765:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME_MIN 0"
+.LASF1813:
+	.string	"SETTING_REPORT_CELL_VOLTAGE_MIN 0"
+.LASF3497:
+	.string	"OWNER_TEMPERATURE"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2646:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF3573:
+	.string	"BOXCAMSTAB"
+.LASF1859:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE_MAX 255"
+.LASF2852:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF2330:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2135:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1327:
+	.string	"SETTING_FW_I_ROLL_MIN 0"
+.LASF3596:
+	.string	"BOXCAMERA2"
+.LASF2305:
+	.string	"__DECL_SIMD_pow "
+.LASF1162:
+	.string	"SETTING_RC_YAW_EXPO_MIN 0"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2192:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2724:
+	.string	"MIDRC_MAX 1700"
+.LASF1130:
+	.string	"SETTING_SERVO_CENTER_PULSE_MAX 2000"
+.LASF1588:
+	.string	"SETTING_NAV_USE_MIDTHR_FOR_ALTHOLD_MIN 0"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2161:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2114:
+	.string	"U_ID_2 2"
+.LASF2959:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1593:
+	.string	"SETTING_NAV_USER_CONTROL_MODE 268"
+.LASF935:
+	.string	"SETTING_MIN_CHECK_MAX 2000"
+.LASF3265:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF824:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MAX 0"
+.LASF3384:
+	.string	"table_blackbox_device"
+.LASF1725:
+	.string	"SETTING_NAV_FW_PITCH2THR 312"
+.LASF2645:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF2871:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2688:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF3288:
+	.string	"VTX_SETTINGS_FREQCMD "
+.LASF1459:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MIN 0"
+.LASF3098:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2379:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF601:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1101:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED 104"
+.LASF929:
+	.string	"SETTING_PITOT_SCALE_MAX 100"
+.LASF2275:
+	.string	"__DECL_SIMD_sincos "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF3511:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2391:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1772:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MAX 60000"
+.LASF2382:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF3462:
+	.string	"FD_PITCH"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF3244:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1341:
+	.string	"SETTING_FW_P_LEVEL 184"
+.LASF1860:
+	.string	"SETTING_MAVLINK_POS_RATE 357"
+.LASF586:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF3321:
+	.string	"__uint16_t"
+.LASF1972:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2633:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2636:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF3465:
+	.string	"double"
+.LASF3549:
+	.string	"PID_ROLL"
+.LASF3038:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2070:
+	.string	"USE_BARO "
+.LASF2400:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF3408:
+	.string	"table_pitot_hardware"
+.LASF2778:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1438:
+	.string	"SETTING_NAV_FW_POS_Z_P_MIN 0"
+.LASF1404:
+	.string	"SETTING_NAV_MC_POS_Z_P 205"
+.LASF371:
+	.string	"__linux 1"
+.LASF1733:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MAX 65535"
+.LASF3563:
+	.string	"ADC_CURRENT"
+.LASF1012:
+	.string	"SETTING_MOTOR_POLES_MIN 4"
+.LASF1914:
+	.string	"SETTING_VTX_PIT_MODE_CHAN 375"
+.LASF1006:
+	.string	"SETTING_THROTTLE_SCALE_MIN 0"
+.LASF3191:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF3593:
+	.string	"BOXAUTOTRIM"
+.LASF2177:
+	.string	"PG_VTX_CONFIG 54"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF597:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1855:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MIN 0"
+.LASF1168:
+	.string	"SETTING_PITCH_RATE_MIN 6"
+.LASF1718:
+	.string	"SETTING_NAV_FW_BANK_ANGLE_MAX 80"
+.LASF691:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF3567:
+	.string	"BOXANGLE"
+.LASF3556:
+	.string	"PID_LEVEL"
+.LASF3071:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF2529:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF675:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2124:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF3588:
+	.string	"BOXGCSNAV"
+.LASF1753:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MIN 1000"
+.LASF1607:
+	.string	"SETTING_NAV_AUTO_SPEED_MAX 2000"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2662:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF799:
+	.string	"SETTING_ALIGN_GYRO_MIN 0"
+.LASF1521:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE 244"
+.LASF1691:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MAX 5000"
+.LASF1136:
+	.string	"SETTING_SERVO_LPF_HZ_MAX 400"
+.LASF1020:
+	.string	"SETTING_FAILSAFE_OFF_DELAY 77"
+.LASF2032:
+	.string	"USE_CMS "
+.LASF2762:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1334:
+	.string	"SETTING_FW_P_YAW_MAX 200"
+.LASF2071:
+	.string	"USE_UART1 "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2809:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF2065:
+	.string	"USE_IMU_FAKE "
+.LASF1608:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE 273"
+.LASF828:
+	.string	"SETTING_GYRO_KALMAN_Q 13"
+.LASF529:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1964:
+	.string	"SETTING_TYPE_OFFSET 0"
+.LASF3451:
+	.string	"tableIndex"
+.LASF492:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1817:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL_MAX 120"
+.LASF1796:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MAX 90"
+.LASF3305:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF2342:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF3177:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1447:
+	.string	"SETTING_NAV_FW_POS_XY_P_MIN 0"
+.LASF1657:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MIN 0"
+.LASF3149:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF2117:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF426:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF3271:
+	.string	"VTX_SETTINGS_MIN_BAND 1"
+.LASF1825:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MIN 0"
+.LASF3689:
+	.string	"SETTING_MODE"
+.LASF1879:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR_MIN 0"
+.LASF1603:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MIN 0"
+.LASF1079:
+	.string	"SETTING_CRUISE_POWER_MAX 4294967295"
+.LASF1912:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MIN 0"
+.LASF2821:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF658:
+	.string	"INT8_MIN (-128)"
+.LASF3668:
+	.string	"settingFindIgnoringCase"
+.LASF2072:
+	.string	"USE_UART2 "
+.LASF3598:
+	.string	"BOXOSDALT1"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1465:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MIN 0"
+.LASF1803:
+	.string	"SETTING_FRSKY_UNIT 338"
+.LASF1040:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MAX 800"
+.LASF1517:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MAX 5000"
+.LASF978:
+	.string	"SETTING_BLACKBOX_RATE_DENOM 63"
+.LASF701:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF3065:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF502:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1697:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MAX 1000"
+.LASF583:
+	.string	"__need_size_t"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__USE_ISOC99 1"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2240:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF2395:
+	.string	"__DECL_SIMD_sinh "
+.LASF1275:
+	.string	"SETTING_MC_D_PITCH 162"
+.LASF3455:
+	.string	"settingConfig_t"
+.LASF2506:
+	.string	"__DECL_SIMD_erfcf "
+.LASF349:
+	.string	"__amd64 1"
+.LASF2376:
+	.string	"__DECL_SIMD_coshf "
+.LASF952:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MIN 500"
+.LASF1356:
+	.string	"SETTING_DTERM_LPF_HZ 189"
+.LASF982:
+	.string	"SETTING_BLACKBOX_DEVICE_MIN 0"
+.LASF2035:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF2770:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF473:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF3334:
+	.string	"TABLE_ALIGNMENT"
+.LASF3260:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1645:
+	.string	"SETTING_NAV_RTH_ALLOW_LANDING_MIN 0"
+.LASF2105:
+	.string	"USE_RX_PPM"
+.LASF423:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF3157:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1325:
+	.string	"SETTING_FW_P_ROLL_MAX 200"
+.LASF1963:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2250:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF2073:
+	.string	"USE_UART3 "
+.LASF3525:
+	.string	"_Bool"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1690:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_TIMEOUT_MIN 0"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1390:
+	.string	"SETTING_PIDSUM_LIMIT_YAW_MIN 100"
+.LASF1444:
+	.string	"SETTING_NAV_FW_POS_Z_D_MIN 0"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF655:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2669:
+	.string	"SPIDEV_COUNT 4"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF402:
+	.string	"__USE_POSIX2"
+.LASF1445:
+	.string	"SETTING_NAV_FW_POS_Z_D_MAX 255"
+.LASF704:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF723:
+	.string	"_PTRDIFF_T "
+.LASF1846:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MIN 0"
+.LASF3438:
+	.string	"setting_type_e"
+.LASF3262:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF740:
+	.string	"_WCHAR_T_ "
+.LASF1087:
+	.string	"SETTING_THR_COMP_WEIGHT_MIN 0"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF2784:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF2993:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2842:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1499:
+	.string	"SETTING_PID_TYPE_MAX 0"
+.LASF2381:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2190:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF2074:
+	.string	"USE_UART4 "
+.LASF2369:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1939:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF2293:
+	.string	"__DECL_SIMD_logf64x "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1576:
+	.string	"SETTING_INAV_W_ACC_BIAS_MIN 0"
+.LASF891:
+	.string	"SETTING_MAGZERO_X 34"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF3307:
+	.string	"SETTING_INDEXES_GET_MIN(val) (val->config.minmax.indexes[0])"
+.LASF3092:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF2581:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF3632:
+	.string	"memcpy"
+.LASF871:
+	.string	"SETTING_ACCGAIN_Z_MIN 1"
+.LASF607:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1683:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT 298"
+.LASF3608:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1467:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT 226"
+.LASF1838:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL_MAX 65535"
+.LASF2799:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1699:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MIN 15"
+.LASF1350:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL 187"
+.LASF1050:
+	.string	"SETTING_FAILSAFE_MISSION 87"
+.LASF1453:
+	.string	"SETTING_NAV_FW_POS_XY_D_MIN 0"
+.LASF3272:
+	.string	"VTX_SETTINGS_MAX_BAND 5"
+.LASF1787:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND_MAX 90"
+.LASF2800:
+	.string	"IOCFG_AF_PP 0"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2713:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF2373:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF770:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2075:
+	.string	"USE_UART5 "
+.LASF2286:
+	.string	"__DECL_SIMD_logf "
+.LASF399:
+	.string	"__USE_ISOC95"
+.LASF1322:
+	.string	"SETTING_FW_FF_PITCH_MAX 200"
+.LASF2044:
+	.string	"USE_RX_MSP "
+.LASF398:
+	.string	"__USE_ISOC99"
+.LASF2817:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF2812:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF3251:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2722:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF3097:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1885:
+	.string	"SETTING_STATS_TOTAL_TIME_MIN 0"
+.LASF2055:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1509:
+	.string	"SETTING_FW_AUTOTUNE_THRESHOLD 240"
+.LASF1292:
+	.string	"SETTING_MC_CD_ROLL_MAX 200"
+.LASF1117:
+	.string	"SETTING_3D_DEADBAND_LOW_MIN 1000"
+.LASF2908:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF3420:
+	.string	"pgResetFunc"
+.LASF1798:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MIN -180"
+.LASF1331:
+	.string	"SETTING_FW_FF_ROLL_MAX 200"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1246:
+	.string	"SETTING_GPS_MIN_SATS_MIN 5"
+.LASF1053:
+	.string	"SETTING_ALIGN_BOARD_ROLL 88"
+.LASF3532:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF3685:
+	.string	"shift"
+.LASF3375:
+	.string	"LOOKUP_TABLE_COUNT"
+.LASF3283:
+	.string	"VTX_SETTINGS_POWER_COUNT 5"
+.LASF1483:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION_MIN 1000"
+.LASF2561:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1228:
+	.string	"SETTING_GPS_PROVIDER_MIN 0"
+.LASF2516:
+	.string	"__DECL_SIMD_tanf "
+.LASF2701:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1783:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MIN 0"
+.LASF3431:
+	.string	"VAR_UINT8"
+.LASF1342:
+	.string	"SETTING_FW_P_LEVEL_MIN 0"
+.LASF1685:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MAX 5000"
+.LASF696:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF1815:
+	.string	"SETTING_HOTT_ALARM_SOUND_INTERVAL 342"
+.LASF685:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1929:
+	.string	"false 0"
+.LASF2341:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF646:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1550:
+	.string	"SETTING_INAV_W_XY_FLOW_V_MAX 100"
+.LASF2048:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF490:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1041:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE 84"
+.LASF482:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF832:
+	.string	"SETTING_GYRO_KALMAN_W_MIN 1"
+.LASF1196:
+	.string	"SETTING_IMU_DCM_KP_MAX 65535"
+.LASF2262:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF2481:
+	.string	"__DECL_SIMD_erff128 "
+.LASF959:
+	.string	"SETTING_SERIALRX_PROVIDER_MAX 0"
+.LASF1790:
+	.string	"SETTING_TELEMETRY_SWITCH_MAX 0"
+.LASF1365:
+	.string	"SETTING_DTERM_LPF2_TYPE 192"
+.LASF1190:
+	.string	"SETTING_FPV_MIX_DEGREES_MAX 50"
+.LASF3018:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF3010:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF826:
+	.string	"SETTING_GYRO_KALMAN_ENABLED_MIN 0"
+.LASF448:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2683:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF744:
+	.string	"_WCHAR_T_H "
+.LASF2077:
+	.string	"USE_UART7 "
+.LASF3437:
+	.string	"VAR_STRING"
+.LASF912:
+	.string	"SETTING_BARO_HARDWARE 41"
+.LASF3643:
+	.string	"copySize"
+.LASF2024:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF780:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2864:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF697:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1567:
+	.string	"SETTING_INAV_W_Z_RES_V_MIN 0"
+.LASF2563:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1337:
+	.string	"SETTING_FW_I_YAW_MAX 200"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1640:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MAX 0"
+.LASF2202:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1366:
+	.string	"SETTING_DTERM_LPF2_TYPE_MIN 0"
+.LASF3045:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF918:
+	.string	"SETTING_BARO_CAL_TOLERANCE 43"
+.LASF1305:
+	.string	"SETTING_MC_P_LEVEL 172"
+.LASF585:
+	.string	"NULL ((void *)0)"
+.LASF2660:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF2485:
+	.string	"__DECL_SIMD_tanh "
+.LASF1848:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X 353"
+.LASF2100:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF3059:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF2916:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1132:
+	.string	"SETTING_SERVO_PWM_RATE_MIN 50"
+.LASF1871:
+	.string	"SETTING_DEBUG_MODE_MAX 0"
+.LASF2673:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF2078:
+	.string	"USE_UART8 "
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1360:
+	.string	"SETTING_DTERM_LPF_TYPE_MIN 0"
+.LASF2440:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF996:
+	.string	"SETTING_MOTOR_ACCEL_TIME 69"
+.LASF2822:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF3401:
+	.string	"table_nav_extra_arming_safety"
+.LASF1486:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MIN 10"
+.LASF1904:
+	.string	"SETTING_VTX_BAND_MAX 5"
+.LASF955:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MIN 0"
+.LASF2906:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF750:
+	.string	"_BSD_WCHAR_T_"
+.LASF974:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MAX 0"
+.LASF2641:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF3150:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2101:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF3037:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF2507:
+	.string	"__DECL_SIMD_erfcl "
+.LASF772:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF2377:
+	.string	"__DECL_SIMD_coshl "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2205:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF2703:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF1014:
+	.string	"SETTING_FAILSAFE_DELAY 75"
+.LASF2815:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF2091:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1561:
+	.string	"SETTING_INAV_W_XY_GPS_P_MIN 0"
+.LASF1595:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MAX 0"
+.LASF1076:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MAX 0"
+.LASF712:
+	.string	"INT64_C(c) c ## L"
+.LASF2733:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1373:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF937:
+	.string	"SETTING_MAX_CHECK_MIN 1000"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2543:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1046:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_MAX 65000"
+.LASF2041:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2885:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF3583:
+	.string	"BOXBLACKBOX"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1926:
+	.string	"_STDBOOL_H "
+.LASF3285:
+	.string	"VTX_SETTINGS_MIN_POWER 1"
+.LASF451:
+	.string	"__USE_ATFILE 1"
+.LASF2087:
+	.string	"USE_USB_MSC"
+.LASF3459:
+	.string	"offset"
+.LASF1857:
+	.string	"SETTING_MAVLINK_RC_CHAN_RATE 356"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1696:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED_MIN 0"
+.LASF1667:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MAX 359"
+.LASF3667:
+	.string	"index"
+.LASF3246:
+	.string	"BOXID_NONE 255"
+.LASF3501:
+	.string	"OWNER_PINIO"
+.LASF1477:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MIN 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1911:
+	.string	"SETTING_VTX_LOW_POWER_DISARM 374"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2013:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF924:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ 45"
+.LASF3025:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1919:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MAX 10000"
+.LASF3362:
+	.string	"TABLE_OPFLOW_HARDWARE"
+.LASF1282:
+	.string	"SETTING_MC_P_ROLL_MIN 0"
+.LASF2443:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF1043:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MAX 1000"
+.LASF2218:
+	.string	"FAST_MATH "
+.LASF3491:
+	.string	"OWNER_RX"
+.LASF3194:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF2441:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1443:
+	.string	"SETTING_NAV_FW_POS_Z_D 218"
+.LASF665:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF2901:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3691:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF573:
+	.string	"_BSD_SIZE_T_ "
+.LASF1146:
+	.string	"SETTING_THR_EXPO 119"
+.LASF2948:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF23:
+	.string	"_LP64 1"
+.LASF846:
+	.string	"SETTING_ACC_HARDWARE 19"
+.LASF2210:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1977:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1241:
+	.string	"SETTING_GPS_AUTO_BAUD_MAX 0"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF933:
+	.string	"SETTING_MIN_CHECK 48"
+.LASF436:
+	.string	"_POSIX_C_SOURCE"
+.LASF3316:
+	.string	"__int8_t"
+.LASF2415:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2097:
+	.string	"USE_PITOT_ADC"
+.LASF2228:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1957:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF3589:
+	.string	"BOXKILLSWITCH"
+.LASF3641:
+	.string	"settingsGetParameterGroupIndexes"
+.LASF2860:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1191:
+	.string	"SETTING_REBOOT_CHARACTER 134"
+.LASF412:
+	.string	"__USE_LARGEFILE"
+.LASF2287:
+	.string	"__DECL_SIMD_logl "
+.LASF3049:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1863:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE 358"
+.LASF524:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1573:
+	.string	"SETTING_INAV_W_XYZ_ACC_P_MIN 0"
+.LASF2553:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF3397:
+	.string	"table_log_level"
+.LASF2554:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1267:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MIN 1000"
+.LASF2288:
+	.string	"__DECL_SIMD_logf16 "
+.LASF3417:
+	.string	"table_voltage_sensor"
+.LASF2007:
+	.string	"USE_OPFLOW "
+.LASF2001:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF2676:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2527:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1330:
+	.string	"SETTING_FW_FF_ROLL_MIN 0"
+.LASF2174:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF2903:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1599:
+	.string	"SETTING_NAV_WP_RADIUS 270"
+.LASF2517:
+	.string	"__DECL_SIMD_tanl "
+.LASF1947:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1905:
+	.string	"SETTING_VTX_CHANNEL 372"
+.LASF474:
+	.string	"__STRING(x) #x"
+.LASF3523:
+	.string	"RESOURCE_RX_CE"
+.LASF1085:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MAX 100"
+.LASF2053:
+	.string	"USE_RCDEVICE "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3076:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1080:
+	.string	"SETTING_IDLE_POWER 97"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1001:
+	.string	"SETTING_MOTOR_DECEL_TIME_MAX 1000"
+.LASF2902:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF2239:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1345:
+	.string	"SETTING_FW_I_LEVEL_MIN 0"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1213:
+	.string	"SETTING_IMU_ACC_IGNORE_SLOPE_MIN 0"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF3331:
+	.string	"setting_max_t"
+.LASF2525:
+	.string	"_BITS_FLOATN_H "
+.LASF2873:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF3141:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF3341:
+	.string	"TABLE_CURRENT_SENSOR"
+.LASF3290:
+	.string	"VTXCOMMON_MSP_BANDCHAN_CHKVAL ((uint16_t)((7 << 3) + 7))"
+.LASF1875:
+	.string	"SETTING_NAME 362"
+.LASF752:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF542:
+	.string	"__stub_chflags "
+.LASF3345:
+	.string	"TABLE_FILTER_TYPE"
+.LASF1493:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MAX 20"
+.LASF576:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1638:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG 283"
+.LASF2788:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF2697:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF2164:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1115:
+	.string	"SETTING_FW_MIN_THROTTLE_DOWN_PITCH_MAX 450"
+.LASF2708:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF2215:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF2249:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1895:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MAX 0"
+.LASF3127:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1979:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1247:
+	.string	"SETTING_GPS_MIN_SATS_MAX 10"
+.LASF3592:
+	.string	"BOXTURNASSIST"
+.LASF3137:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF3270:
+	.string	"VTX_SETTINGS_NO_BAND 0"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2597:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF2738:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF2336:
+	.string	"__DECL_SIMD_asinf "
+.LASF2518:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2278:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1778:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MAX 60"
+.LASF2836:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF2874:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF854:
+	.string	"SETTING_ACC_LPF_TYPE_MAX 0"
+.LASF2283:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF1354:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MIN 100"
+.LASF2515:
+	.string	"__DECL_SIMD_tan "
+.LASF2638:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2157:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1393:
+	.string	"SETTING_ITERM_WINDUP_MIN 0"
+.LASF1237:
+	.string	"SETTING_GPS_AUTO_CONFIG_MIN 0"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF3030:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF3380:
+	.string	"table_baro_hardware"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF2813:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF442:
+	.string	"__USE_XOPEN2K 1"
+.LASF3014:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF3476:
+	.string	"OWNER_TIMER"
+.LASF1184:
+	.string	"SETTING_MANUAL_PITCH_RATE_MAX 100"
+.LASF1987:
+	.string	"USE_TELEMETRY "
+.LASF2803:
+	.string	"IOCFG_IPU 0"
+.LASF1734:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS 315"
+.LASF3578:
+	.string	"BOXLEDLOW"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF756:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF2994:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF2171:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF3211:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF1263:
+	.string	"SETTING_MC_AIRMODE_TYPE 158"
+.LASF1062:
+	.string	"SETTING_VBAT_METER_TYPE 91"
+.LASF1407:
+	.string	"SETTING_NAV_MC_VEL_Z_P 206"
+.LASF2197:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF3022:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF783:
+	.string	"SETTING_MAX_WORD_LENGTH 37"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2510:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1668:
+	.string	"SETTING_NAV_MC_BANK_ANGLE 293"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF2862:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1374:
+	.string	"SETTING_FW_LOITER_DIRECTION 195"
+.LASF2765:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF798:
+	.string	"SETTING_ALIGN_GYRO 3"
+.LASF3268:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF2914:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2589:
+	.string	"_Mdouble_ _Float32"
+.LASF2456:
+	.string	"__DECL_SIMD_atanhf "
+.LASF541:
+	.string	"__stub___compat_bdflush "
+.LASF1240:
+	.string	"SETTING_GPS_AUTO_BAUD_MIN 0"
+.LASF3453:
+	.string	"lookup"
+.LASF3238:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF3156:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1750:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MIN 10"
+.LASF2313:
+	.string	"__DECL_SIMD_powf64x "
+.LASF2472:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2625:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1488:
+	.string	"SETTING_ANTIGRAVITY_GAIN 233"
+.LASF520:
+	.string	"__attribute_copy__"
+.LASF855:
+	.string	"SETTING_ACCZERO_X 22"
+.LASF2253:
+	.string	"_MATH_H 1"
+.LASF2526:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2725:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF731:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF945:
+	.string	"SETTING_RSSI_MIN 52"
+.LASF2141:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1161:
+	.string	"SETTING_RC_YAW_EXPO 124"
+.LASF393:
+	.string	"_STRING_H 1"
+.LASF1735:
+	.string	"SETTING_NAV_FW_CONTROL_SMOOTHNESS_MIN 0"
+.LASF1809:
+	.string	"SETTING_FRSKY_PITCH_ROLL 340"
+.LASF941:
+	.string	"SETTING_RSSI_SOURCE_MAX 0"
+.LASF3584:
+	.string	"BOXFAILSAFE"
+.LASF2237:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF2966:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF441:
+	.string	"__USE_POSIX199506 1"
+.LASF2454:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF801:
+	.string	"SETTING_GYRO_HARDWARE_LPF 4"
+.LASF1526:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MAX 0"
+.LASF2189:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF3311:
+	.string	"short unsigned int"
+.LASF2594:
+	.string	"_Mdouble_ _Float128"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF2892:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1287:
+	.string	"SETTING_MC_D_ROLL 166"
+.LASF893:
+	.string	"SETTING_MAGZERO_X_MAX 32767"
+.LASF1474:
+	.string	"SETTING_MC_ITERM_RELAX_MIN 0"
+.LASF3387:
+	.string	"table_direction"
+.LASF3147:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"SETTING_NAV_RTH_ALTITUDE 289"
+.LASF619:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2354:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2961:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1131:
+	.string	"SETTING_SERVO_PWM_RATE 114"
+.LASF2462:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF3338:
+	.string	"TABLE_BAT_VOLTAGE_SOURCE"
+.LASF879:
+	.string	"SETTING_ALIGN_OPFLOW 30"
+.LASF2195:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF2432:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF3061:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF652:
+	.string	"_BITS_WCHAR_H 1"
+.LASF2233:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF2759:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF3652:
+	.string	"settingLookupValueName"
+.LASF1470:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE 227"
+.LASF842:
+	.string	"SETTING_ACC_NOTCH_CUTOFF_MAX 255"
+.LASF1773:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE 328"
+.LASF2107:
+	.string	"USE_RCDEVICE"
+.LASF1416:
+	.string	"SETTING_NAV_MC_POS_XY_P 209"
+.LASF3319:
+	.string	"__int16_t"
+.LASF3656:
+	.string	"settingGetCopyValuePointer"
+.LASF467:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF519:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF3264:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF2088:
+	.string	"USE_SERVO_SBUS"
+.LASF819:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ 10"
+.LASF1711:
+	.string	"SETTING_NAV_FW_MIN_THR_MIN 1000"
+.LASF2199:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF2206:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1580:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MAX 9999"
+.LASF2607:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF986:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MAX 0"
+.LASF1532:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MAX 0"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF3173:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF981:
+	.string	"SETTING_BLACKBOX_DEVICE 64"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF3294:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF3096:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF3088:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1659:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE 290"
+.LASF478:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF414:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2445:
+	.string	"__DECL_SIMD_log1p "
+.LASF626:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF3340:
+	.string	"TABLE_BLACKBOX_DEVICE"
+.LASF668:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF3351:
+	.string	"TABLE_ITERM_RELAX"
+.LASF3190:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF2303:
+	.string	"__DECL_SIMD_expf64x "
+.LASF640:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1378:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MIN 1"
+.LASF934:
+	.string	"SETTING_MIN_CHECK_MIN 1000"
+.LASF2006:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1137:
+	.string	"SETTING_FLAPERON_THROW_OFFSET 116"
+.LASF2621:
+	.string	"FP_INFINITE 1"
+.LASF1935:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF3447:
+	.string	"settingMinMaxConfig_s"
+.LASF3449:
+	.string	"settingMinMaxConfig_t"
+.LASF1013:
+	.string	"SETTING_MOTOR_POLES_MAX 255"
+.LASF2752:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF807:
+	.string	"SETTING_GYRO_LPF_TYPE 6"
+.LASF3472:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1264:
+	.string	"SETTING_MC_AIRMODE_TYPE_MIN 0"
+.LASF3426:
+	.string	"pgRegistry_s"
+.LASF3425:
+	.string	"pgRegistry_t"
+.LASF2504:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF3009:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2296:
+	.string	"__DECL_SIMD_expf "
+.LASF2592:
+	.string	"_Mdouble_ _Float64"
+.LASF1896:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK 369"
+.LASF3001:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF3406:
+	.string	"table_opflow_hardware"
+.LASF3422:
+	.string	"address"
+.LASF1671:
+	.string	"SETTING_NAV_MC_HOVER_THR 294"
+.LASF1251:
+	.string	"SETTING_YAW_DEADBAND 154"
+.LASF1381:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN_MIN 0"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF434:
+	.string	"_POSIX_SOURCE"
+.LASF3609:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF1565:
+	.string	"SETTING_INAV_W_XY_GPS_V_MAX 10"
+.LASF1695:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_DISENGAGE_SPEED 302"
+.LASF2534:
+	.string	"__HAVE_FLOAT32 1"
+.LASF3015:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2037:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF2337:
+	.string	"__DECL_SIMD_asinl "
+.LASF2850:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF2121:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1854:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE 355"
+.LASF3126:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"SETTING_YAW_LPF_HZ_MAX 200"
+.LASF1089:
+	.string	"SETTING_BATTERY_CAPACITY 100"
+.LASF968:
+	.string	"SETTING_RX_MIN_USEC_MAX 2250"
+.LASF1147:
+	.string	"SETTING_THR_EXPO_MIN 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF3526:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF656:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF3257:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF636:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF3021:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2544:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2002:
+	.string	"USE_RANGEFINDER "
+.LASF1234:
+	.string	"SETTING_GPS_DYN_MODEL_MIN 0"
+.LASF1990:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2653:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF969:
+	.string	"SETTING_RX_MAX_USEC 60"
+.LASF2707:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF886:
+	.string	"SETTING_MAG_HARDWARE_MIN 0"
+.LASF2696:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1830:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER 347"
+.LASF620:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF923:
+	.string	"SETTING_PITOT_HARDWARE_MAX 0"
+.LASF809:
+	.string	"SETTING_GYRO_LPF_TYPE_MAX 0"
+.LASF2172:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF2775:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF2897:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF663:
+	.string	"INT16_MAX (32767)"
+.LASF980:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MAX 65535"
+.LASF1187:
+	.string	"SETTING_MANUAL_YAW_RATE_MAX 100"
+.LASF401:
+	.string	"__USE_POSIX"
+.LASF3600:
+	.string	"BOXOSDALT3"
+.LASF1063:
+	.string	"SETTING_VBAT_METER_TYPE_MIN 0"
+.LASF2985:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1027:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MIN 0"
+.LASF2003:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF3546:
+	.string	"AUX10"
+.LASF3547:
+	.string	"AUX11"
+.LASF2487:
+	.string	"__DECL_SIMD_tanhl "
+.LASF3353:
+	.string	"TABLE_LOG_LEVEL"
+.LASF2152:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF2519:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2279:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2918:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2555:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF3007:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1111:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MIN -1"
+.LASF3464:
+	.string	"float"
+.LASF1898:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MAX 0"
+.LASF3072:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MIN 0"
+.LASF3047:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1181:
+	.string	"SETTING_MANUAL_ROLL_RATE_MAX 100"
+.LASF1528:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING_MIN 0"
+.LASF2503:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2923:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF2711:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF606:
+	.string	"__STD_TYPE typedef"
+.LASF3313:
+	.string	"unsigned char"
+.LASF3273:
+	.string	"VTX_SETTINGS_MIN_CHANNEL 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1788:
+	.string	"SETTING_TELEMETRY_SWITCH 333"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF3560:
+	.string	"PID_ITEM_COUNT"
+.LASF1916:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MAX 8"
+.LASF408:
+	.string	"__USE_XOPEN2K"
+.LASF2385:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2058:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF870:
+	.string	"SETTING_ACCGAIN_Z 27"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF3611:
+	.string	"LOG_TOPIC_BARO"
+.LASF1954:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF2986:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF3659:
+	.string	"settingGetPgn"
+.LASF2849:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF3080:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2603:
+	.string	"__MATHDECL"
+.LASF3386:
+	.string	"table_debug_modes"
+.LASF396:
+	.string	"_FEATURES_H 1"
+.LASF2512:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF454:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2450:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2464:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1141:
+	.string	"SETTING_TRI_UNARMED_SERVO_MIN 0"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2137:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF527:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1543:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MIN 0"
+.LASF1775:
+	.string	"SETTING_NAV_FW_LAUNCH_CLIMB_ANGLE_MAX 45"
+.LASF1410:
+	.string	"SETTING_NAV_MC_VEL_Z_I 207"
+.LASF2904:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2092:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF2353:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1033:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MIN 0"
+.LASF2877:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF3506:
+	.string	"RESOURCE_OUTPUT"
+.LASF1991:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF476:
+	.string	"__BEGIN_DECLS "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF3115:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2940:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1819:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX_MIN 0"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF2360:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1255:
+	.string	"SETTING_POS_HOLD_DEADBAND_MIN 2"
+.LASF3123:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1675:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MIN 100"
+.LASF563:
+	.string	"__need_size_t "
+.LASF3555:
+	.string	"PID_SURFACE"
+.LASF1757:
+	.string	"SETTING_NAV_FW_LAUNCH_IDLE_THR_MAX 2000"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF3409:
+	.string	"table_platform_type"
+.LASF373:
+	.string	"linux 1"
+.LASF2272:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF625:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1402:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF2031:
+	.string	"USE_STATS "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF2480:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1961:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1923:
+	.string	"SETTING_LOG_TOPICS 378"
+.LASF1472:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MAX 0"
+.LASF2670:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF3554:
+	.string	"PID_VEL_XY"
+.LASF1782:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL 331"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF3337:
+	.string	"TABLE_BAT_CAPACITY_UNIT"
+.LASF1999:
+	.string	"USE_RX_UIB "
+.LASF2200:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1426:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MIN 0"
+.LASF711:
+	.string	"INT32_C(c) c"
+.LASF2919:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3495:
+	.string	"OWNER_SPI_PREINIT"
+.LASF748:
+	.string	"_WCHAR_T_DECLARED "
+.LASF3651:
+	.string	"_right1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF3645:
+	.string	"_right3"
+.LASF437:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1490:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MAX 20"
+.LASF1019:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY_MAX 200"
+.LASF1636:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST_MIN 0"
+.LASF1708:
+	.string	"SETTING_NAV_FW_CRUISE_THR_MIN 1000"
+.LASF505:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1127:
+	.string	"SETTING_SERVO_PROTOCOL_MAX 0"
+.LASF1892:
+	.string	"SETTING_TZ_OFFSET_MAX 1440"
+.LASF1728:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS 313"
+.LASF707:
+	.string	"WINT_MIN (0u)"
+.LASF1552:
+	.string	"SETTING_INAV_W_Z_BARO_P_MIN 0"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1818:
+	.string	"SETTING_TELEMETRY_HALFDUPLEX 343"
+.LASF3394:
+	.string	"table_gyro_lpf"
+.LASF1395:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH 202"
+.LASF1061:
+	.string	"SETTING_ALIGN_BOARD_YAW_MAX 3600"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1451:
+	.string	"SETTING_NAV_FW_POS_XY_I_MAX 255"
+.LASF2730:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1051:
+	.string	"SETTING_FAILSAFE_MISSION_MIN 0"
+.LASF2753:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF2393:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF927:
+	.string	"SETTING_PITOT_SCALE 46"
+.LASF3011:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF634:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1634:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MAX 0"
+.LASF2308:
+	.string	"__DECL_SIMD_powf16 "
+.LASF3424:
+	.string	"reset"
+.LASF1125:
+	.string	"SETTING_SERVO_PROTOCOL 112"
+.LASF571:
+	.string	"__SIZE_T "
+.LASF2034:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1941:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF3456:
+	.string	"encoded_name"
+.LASF874:
+	.string	"SETTING_OPFLOW_HARDWARE_MIN 0"
+.LASF3002:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF2251:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF2214:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF3214:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF3457:
+	.string	"type"
+.LASF2845:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF488:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1514:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN_MAX 100"
+.LASF957:
+	.string	"SETTING_SERIALRX_PROVIDER 56"
+.LASF407:
+	.string	"__USE_UNIX98"
+.LASF3280:
+	.string	"VTX_SETTINGS_DEFAULT_LOW_POWER_DISARM 0"
+.LASF543:
+	.string	"__stub_fchflags "
+.LASF2315:
+	.string	"__DECL_SIMD_acos "
+.LASF3229:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1602:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE 271"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF540:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF3112:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF2746:
+	.string	"SPEKTRUM_SAT_BIND_MAX 10"
+.LASF1536:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE 249"
+.LASF1262:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MAX 200"
+.LASF627:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF878:
+	.string	"SETTING_OPFLOW_SCALE_MAX 10000"
+.LASF757:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF2333:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2457:
+	.string	"__DECL_SIMD_atanhl "
+.LASF2128:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1430:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MAX 255"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1512:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_P_GAIN 241"
+.LASF3036:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF631:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2511:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1372:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF3208:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1823:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MAX 0"
+.LASF818:
+	.string	"SETTING_GYRO_NOTCH_CUTOFF_MAX 500"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF3000:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF3139:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1109:
+	.string	"SETTING_HAS_FLAPS_MAX 0"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2340:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF3113:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1164:
+	.string	"SETTING_ROLL_RATE 125"
+.LASF2655:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF2729:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1966:
+	.string	"SETTING_MODE_OFFSET 6"
+.LASF3527:
+	.string	"SENSOR_INDEX_ACC"
+.LASF609:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1249:
+	.string	"SETTING_DEADBAND_MIN 0"
+.LASF3060:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF720:
+	.string	"_STDDEF_H "
+.LASF1328:
+	.string	"SETTING_FW_I_ROLL_MAX 200"
+.LASF509:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1852:
+	.string	"SETTING_SIM_LOW_ALTITUDE_MIN -32768"
+.LASF900:
+	.string	"SETTING_MAG_CALIBRATION_TIME 37"
+.LASF3181:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF892:
+	.string	"SETTING_MAGZERO_X_MIN -32768"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF3474:
+	.string	"OWNER_SERIAL"
+.LASF1722:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE 311"
+.LASF3488:
+	.string	"OWNER_INVERTER"
+.LASF3215:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF2715:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF2856:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF491:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2970:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1047:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE_PROCEDURE 86"
+.LASF1655:
+	.string	"SETTING_NAV_MAX_TERRAIN_FOLLOW_ALT_MAX 1000"
+.LASF2351:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF1934:
+	.string	"UNIT_TESTED "
+.LASF2256:
+	.string	"__DECL_SIMD_cosf "
+.LASF2390:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF779:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF2187:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF2596:
+	.string	"_Mdouble_ _Float32x"
+.LASF850:
+	.string	"SETTING_ACC_LPF_HZ_MIN 0"
+.LASF3690:
+	.string	"SETTING_SECTION"
+.LASF2835:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF2844:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF2045:
+	.string	"USE_SERIALRX_SUMD "
+.LASF866:
+	.string	"SETTING_ACCGAIN_X_MAX 8192"
+.LASF624:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2574:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF975:
+	.string	"SETTING_BLACKBOX_RATE_NUM 62"
+.LASF1026:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY 79"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF545:
+	.string	"__stub_revoke "
+.LASF1715:
+	.string	"SETTING_NAV_FW_MAX_THR_MAX 2000"
+.LASF2488:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF3648:
+	.string	"maxSize"
+.LASF2624:
+	.string	"FP_NORMAL 4"
+.LASF1571:
+	.string	"SETTING_INAV_W_XY_RES_V_MAX 10"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2982:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3202:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF2819:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF1008:
+	.string	"SETTING_THROTTLE_IDLE 73"
+.LASF758:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF3357:
+	.string	"TABLE_NAV_EXTRA_ARMING_SAFETY"
+.LASF2587:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2153:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF3487:
+	.string	"OWNER_MPU"
+.LASF3322:
+	.string	"__uint32_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF3638:
+	.string	"strlen"
+.LASF3087:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1229:
+	.string	"SETTING_GPS_PROVIDER_MAX 0"
+.LASF3658:
+	.string	"value"
+.LASF1163:
+	.string	"SETTING_RC_YAW_EXPO_MAX 100"
+.LASF778:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF2580:
+	.string	"__MATH_PRECNAME"
+.LASF2130:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF2651:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2068:
+	.string	"USE_FAKE_GPS "
+.LASF1003:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL_MIN 0"
+.LASF420:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF2067:
+	.string	"USE_FAKE_MAG "
+.LASF3562:
+	.string	"ADC_RSSI"
+.LASF3566:
+	.string	"BOXARM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2929:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2383:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1706:
+	.string	"SETTING_NAV_MC_POS_EXPO_MAX 255"
+.LASF2042:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF954:
+	.string	"SETTING_RC_FILTER_FREQUENCY 55"
+.LASF513:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1951:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF2059:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF960:
+	.string	"SETTING_SERIALRX_INVERTED 57"
+.LASF1925:
+	.string	"SETTING_LOG_TOPICS_MAX 4294967295"
+.LASF3361:
+	.string	"TABLE_OFF_ON"
+.LASF2773:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF2375:
+	.string	"__DECL_SIMD_cosh "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF1321:
+	.string	"SETTING_FW_FF_PITCH_MIN 0"
+.LASF3075:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1702:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME_MIN 0"
+.LASF3450:
+	.string	"settingLookupTableConfig_s"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF688:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF421:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1209:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE 140"
+.LASF3369:
+	.string	"TABLE_SERIAL_RX"
+.LASF2590:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1839:
+	.string	"SETTING_SIM_TRANSMIT_FLAGS 350"
+.LASF3165:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1821:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT 344"
+.LASF2632:
+	.string	"MATH_ERREXCEPT 2"
+.LASF453:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1730:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MAX 10000"
+.LASF2274:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF515:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF3622:
+	.string	"settingsPgnCounts"
+.LASF2140:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF2684:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1387:
+	.string	"SETTING_PIDSUM_LIMIT_MIN 100"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF2875:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2412:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF430:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF649:
+	.string	"_BITS_TIME64_H 1"
+.LASF570:
+	.string	"_T_SIZE "
+.LASF823:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_TYPE_MIN 0"
+.LASF428:
+	.string	"_DEFAULT_SOURCE"
+.LASF1151:
+	.string	"SETTING_TPA_RATE_MAX 100"
+.LASF815:
+	.string	"SETTING_GYRO_NOTCH_HZ_MAX 500"
+.LASF1723:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MIN 5"
+.LASF3468:
+	.string	"OWNER_PWMINPUT"
+.LASF2787:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF721:
+	.string	"_STDDEF_H_ "
+.LASF2328:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF726:
+	.string	"__PTRDIFF_T "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2380:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF2452:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF698:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF2533:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2150:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF3220:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1504:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MIN 50"
+.LASF2470:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF3297:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF1128:
+	.string	"SETTING_SERVO_CENTER_PULSE 113"
+.LASF2220:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1632:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP 281"
+.LASF1090:
+	.string	"SETTING_BATTERY_CAPACITY_MIN 0"
+.LASF2343:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1516:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC_MIN 100"
+.LASF3536:
+	.string	"THROTTLE"
+.LASF549:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2119:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1604:
+	.string	"SETTING_NAV_WP_SAFE_DISTANCE_MAX 65000"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1745:
+	.string	"SETTING_NAV_FW_LAUNCH_ACCEL_MAX 20000"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF2659:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1781:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MAX 0"
+.LASF1015:
+	.string	"SETTING_FAILSAFE_DELAY_MIN 0"
+.LASF1236:
+	.string	"SETTING_GPS_AUTO_CONFIG 149"
+.LASF2656:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF3470:
+	.string	"OWNER_MOTOR"
+.LASF1624:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MAXALT_MIN 500"
+.LASF1260:
+	.string	"SETTING_3D_DEADBAND_THROTTLE 157"
+.LASF1622:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MAX 1000"
+.LASF3587:
+	.string	"BOXHOMERESET"
+.LASF3383:
+	.string	"table_blackbox_compression"
+.LASF1119:
+	.string	"SETTING_3D_DEADBAND_HIGH 110"
+.LASF592:
+	.string	"__S16_TYPE short int"
+.LASF3373:
+	.string	"TABLE_VOLTAGE_SENSOR"
+.LASF2829:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF2420:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1189:
+	.string	"SETTING_FPV_MIX_DEGREES_MIN 0"
+.LASF1094:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MAX 4294967295"
+.LASF3187:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF684:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF3410:
+	.string	"table_receiver_type"
+.LASF2309:
+	.string	"__DECL_SIMD_powf32 "
+.LASF784:
+	.string	"SETTING_ENCODED_NAME_MAX_BYTES 5"
+.LASF1106:
+	.string	"SETTING_PLATFORM_TYPE_MAX 0"
+.LASF577:
+	.string	"_SIZE_T_DECLARED "
+.LASF2790:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF1969:
+	.string	"SETTING_MODE_MASK (0xC0)"
+.LASF2963:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF3515:
+	.string	"RESOURCE_SPI_SCK"
+.LASF2245:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF565:
+	.string	"__size_t__ "
+.LASF2558:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1217:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MAX 0"
+.LASF706:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1670:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MAX 45"
+.LASF1592:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY_MAX 0"
+.LASF590:
+	.string	"_STDINT_H 1"
+.LASF2988:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3558:
+	.string	"PID_VEL_Z"
+.LASF693:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3068:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF3309:
+	.string	"SETTING_NAME_HASH_BUCKETS 147"
+.LASF1682:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MAX 1000"
+.LASF2422:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2183:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF2356:
+	.string	"__DECL_SIMD_exp2f "
+.LASF1436:
+	.string	"SETTING_NAV_MC_VEL_XY_DTERM_LPF_HZ_MAX 100"
+.LASF1081:
+	.string	"SETTING_IDLE_POWER_MIN 0"
+.LASF716:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1538:
+	.string	"SETTING_INAV_MAX_SURFACE_ALTITUDE_MAX 1000"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1485:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ 232"
+.LASF906:
+	.string	"SETTING_ALIGN_MAG_PITCH 39"
+.LASF1369:
+	.string	"SETTING_YAW_LPF_HZ_MIN 0"
+.LASF1417:
+	.string	"SETTING_NAV_MC_POS_XY_P_MIN 0"
+.LASF3644:
+	.string	"_left2"
+.LASF2257:
+	.string	"__DECL_SIMD_cosl "
+.LASF2958:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1801:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT_MIN 0"
+.LASF2649:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1539:
+	.string	"SETTING_INAV_W_Z_SURFACE_P 250"
+.LASF2811:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF925:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MIN 0"
+.LASF2827:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF3428:
+	.string	"values"
+.LASF1971:
+	.string	"I2C1_OVERCLOCK false"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1023:
+	.string	"SETTING_FAILSAFE_THROTTLE 78"
+.LASF951:
+	.string	"SETTING_SBUS_SYNC_INTERVAL 54"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1420:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MIN 0"
+.LASF1731:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED 314"
+.LASF2020:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1660:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MIN 0"
+.LASF3146:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2861:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2524:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1138:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MIN 50"
+.LASF2572:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1542:
+	.string	"SETTING_INAV_W_Z_SURFACE_V 251"
+.LASF2402:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1385:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MAX 1"
+.LASF2672:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF2482:
+	.string	"__DECL_SIMD_erff32x "
+.LASF3517:
+	.string	"RESOURCE_SPI_MISO"
+.LASF3436:
+	.string	"VAR_FLOAT"
+.LASF1759:
+	.string	"SETTING_NAV_FW_LAUNCH_MOTOR_DELAY_MIN 0"
+.LASF1948:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2756:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF890:
+	.string	"SETTING_MAG_DECLINATION_MAX 18000"
+.LASF1394:
+	.string	"SETTING_ITERM_WINDUP_MAX 90"
+.LASF503:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF2085:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2411:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1283:
+	.string	"SETTING_MC_P_ROLL_MAX 200"
+.LASF1248:
+	.string	"SETTING_DEADBAND 153"
+.LASF2033:
+	.string	"CMS_MENU_OSD "
+.LASF1598:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MAX 10"
+.LASF1669:
+	.string	"SETTING_NAV_MC_BANK_ANGLE_MIN 15"
+.LASF1996:
+	.string	"USE_GYRO_KALMAN "
+.LASF859:
+	.string	"SETTING_ACCZERO_Y_MIN -32768"
+.LASF2716:
+	.string	"P0 101325.0f"
+.LASF2410:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1077:
+	.string	"SETTING_CRUISE_POWER 96"
+.LASF3124:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2647:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1224:
+	.string	"SETTING_APPLIED_DEFAULTS 145"
+.LASF1347:
+	.string	"SETTING_FW_D_LEVEL 186"
+.LASF3416:
+	.string	"table_tz_automatic_dst"
+.LASF1901:
+	.string	"SETTING_VTX_HALFDUPLEX_MAX 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2798:
+	.string	"IOCFG_OUT_PP 0"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF2545:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF2167:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF966:
+	.string	"SETTING_RX_MIN_USEC 59"
+.LASF1610:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MAX 2000"
+.LASF1982:
+	.string	"USE_64BIT_TIME "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF499:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF2040:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1306:
+	.string	"SETTING_MC_P_LEVEL_MIN 0"
+.LASF2489:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1097:
+	.string	"SETTING_BATTERY_CAPACITY_CRITICAL_MAX 4294967295"
+.LASF1498:
+	.string	"SETTING_PID_TYPE_MIN 0"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1038:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE 83"
+.LASF484:
+	.string	"__flexarr []"
+.LASF2832:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF3686:
+	.string	"settingGetWord"
+.LASF1298:
+	.string	"SETTING_MC_I_YAW_MAX 200"
+.LASF2694:
+	.string	"DYN_NOTCH_PEAK_COUNT 3"
+.LASF2780:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF2810:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF3607:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF1913:
+	.string	"SETTING_VTX_LOW_POWER_DISARM_MAX 0"
+.LASF964:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MIN 0"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2263:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2386:
+	.string	"__DECL_SIMD_expm1f "
+.LASF2602:
+	.string	"__MATHDECL_ALIAS"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF3484:
+	.string	"OWNER_BEEPER"
+.LASF1401:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT 204"
+.LASF3614:
+	.string	"LOG_TOPIC_TIMER"
+.LASF2028:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF2640:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF3111:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF802:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MIN 0"
+.LASF2700:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1156:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT_MIN 0"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1383:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION 198"
+.LASF1093:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING_MIN 0"
+.LASF615:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF848:
+	.string	"SETTING_ACC_HARDWARE_MAX 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2050:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF2946:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1091:
+	.string	"SETTING_BATTERY_CAPACITY_MAX 4294967295"
+.LASF2771:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF3266:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF2750:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF1930:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1034:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD_MAX 500"
+.LASF3213:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF2755:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1784:
+	.string	"SETTING_NAV_USE_FW_YAW_CONTROL_MAX 0"
+.LASF1400:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MAX 500000"
+.LASF1811:
+	.string	"SETTING_FRSKY_PITCH_ROLL_MAX 0"
+.LASF2739:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF741:
+	.string	"_BSD_WCHAR_T_ "
+.LASF702:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF989:
+	.string	"SETTING_MAX_THROTTLE_MAX 2000"
+.LASF3624:
+	.string	"wordSymbols"
+.LASF1648:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MIN 0"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF3673:
+	.string	"settingFindCandidate"
+.LASF1628:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED_MAX 2000"
+.LASF1794:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE 335"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1555:
+	.string	"SETTING_INAV_W_Z_GPS_P_MIN 0"
+.LASF1223:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MAX 1000"
+.LASF2421:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF3219:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF2667:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF876:
+	.string	"SETTING_OPFLOW_SCALE 29"
+.LASF2584:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF2857:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF651:
+	.string	"__STD_TYPE"
+.LASF2213:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF3346:
+	.string	"TABLE_FRSKY_UNIT"
+.LASF1494:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ 235"
+.LASF3374:
+	.string	"TABLE_VTX_LOW_POWER_DISARM"
+.LASF3679:
+	.string	"var_name_length"
+.LASF2099:
+	.string	"USE_1WIRE_DS2482"
+.LASF3016:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2968:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF3304:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF3158:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF3200:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF3101:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF3306:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF3382:
+	.string	"table_bat_voltage_source"
+.LASF1489:
+	.string	"SETTING_ANTIGRAVITY_GAIN_MIN 1"
+.LASF863:
+	.string	"SETTING_ACCZERO_Z_MAX 32767"
+.LASF2329:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF3234:
+	.string	"SIM_N_TX_FLAGS 5"
+.LASF958:
+	.string	"SETTING_SERIALRX_PROVIDER_MIN 0"
+.LASF1789:
+	.string	"SETTING_TELEMETRY_SWITCH_MIN 0"
+.LASF831:
+	.string	"SETTING_GYRO_KALMAN_W 14"
+.LASF3122:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1116:
+	.string	"SETTING_3D_DEADBAND_LOW 109"
+.LASF3348:
+	.string	"TABLE_GPS_PROVIDER"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF3221:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1613:
+	.string	"SETTING_NAV_MANUAL_SPEED_MAX 2000"
+.LASF1721:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MAX 80"
+.LASF2304:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2103:
+	.string	"USE_ADC"
+.LASF1222:
+	.string	"SETTING_SWITCH_DISARM_DELAY_MIN 0"
+.LASF2718:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF939:
+	.string	"SETTING_RSSI_SOURCE 50"
+.LASF1886:
+	.string	"SETTING_STATS_TOTAL_TIME_MAX 2147483647"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF3051:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2899:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2076:
+	.string	"USE_UART6 "
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1612:
+	.string	"SETTING_NAV_MANUAL_SPEED_MIN 10"
+.LASF2414:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF2401:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2922:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1351:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_RLL_MIN 100"
+.LASF666:
+	.string	"UINT8_MAX (255)"
+.LASF1845:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW 352"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF3612:
+	.string	"LOG_TOPIC_PITOT"
+.LASF1469:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MAX 1000"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1614:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE 275"
+.LASF803:
+	.string	"SETTING_GYRO_HARDWARE_LPF_MAX 0"
+.LASF2944:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2984:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF742:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1227:
+	.string	"SETTING_GPS_PROVIDER 146"
+.LASF1142:
+	.string	"SETTING_TRI_UNARMED_SERVO_MAX 0"
+.LASF2665:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF3039:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1035:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE 82"
+.LASF2620:
+	.string	"FP_NAN 0"
+.LASF3131:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF3443:
+	.string	"setting_section_e"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF3174:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2617:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF3166:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF2664:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF2307:
+	.string	"__DECL_SIMD_powl "
+.LASF411:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1307:
+	.string	"SETTING_MC_P_LEVEL_MAX 200"
+.LASF2942:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1870:
+	.string	"SETTING_DEBUG_MODE_MIN 0"
+.LASF2795:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF2728:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2941:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1970:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1903:
+	.string	"SETTING_VTX_BAND_MIN 0"
+.LASF523:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1770:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE 327"
+.LASF2399:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1968:
+	.string	"SETTING_SECTION_MASK (0x30)"
+.LASF973:
+	.string	"SETTING_SERIALRX_HALFDUPLEX_MIN 0"
+.LASF1144:
+	.string	"SETTING_THR_MID_MIN 0"
+.LASF1661:
+	.string	"SETTING_NAV_RTH_HOME_ALTITUDE_MAX 65000"
+.LASF2126:
+	.string	"NOINLINE "
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF2785:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF3494:
+	.string	"OWNER_VTX"
+.LASF1649:
+	.string	"SETTING_NAV_RTH_ALT_MODE_MAX 0"
+.LASF2831:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF2777:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF1582:
+	.string	"SETTING_INAV_BARO_EPV_MIN 0"
+.LASF1680:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED 297"
+.LASF1673:
+	.string	"SETTING_NAV_MC_HOVER_THR_MAX 2000"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF749:
+	.string	"__DEFINED_wchar_t "
+.LASF3169:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF3119:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1594:
+	.string	"SETTING_NAV_USER_CONTROL_MODE_MIN 0"
+.LASF1075:
+	.string	"SETTING_BAT_VOLTAGE_SRC_MIN 0"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1910:
+	.string	"SETTING_VTX_POWER_MAX 5"
+.LASF690:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1244:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MAX 0"
+.LASF3004:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF3683:
+	.string	"bpos"
+.LASF3320:
+	.string	"short int"
+.LASF3089:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2604:
+	.string	"__MATHCALL"
+.LASF2742:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF3393:
+	.string	"table_gps_sbas_mode"
+.LASF1198:
+	.string	"SETTING_IMU_DCM_KI_MIN 0"
+.LASF2991:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF2120:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF3295:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF2426:
+	.string	"__DECL_SIMD_log10f "
+.LASF1568:
+	.string	"SETTING_INAV_W_Z_RES_V_MAX 10"
+.LASF1981:
+	.string	"USE_ADC_AVERAGING "
+.LASF2980:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF804:
+	.string	"SETTING_GYRO_LPF_HZ 5"
+.LASF961:
+	.string	"SETTING_SERIALRX_INVERTED_MIN 0"
+.LASF2149:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF3033:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2949:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3274:
+	.string	"VTX_SETTINGS_MAX_CHANNEL 8"
+.LASF1812:
+	.string	"SETTING_REPORT_CELL_VOLTAGE 341"
+.LASF766:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF3502:
+	.string	"OWNER_IRLOCK"
+.LASF737:
+	.string	"_T_WCHAR_ "
+.LASF2370:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1100:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MAX 0"
+.LASF3569:
+	.string	"BOXNAVALTHOLD"
+.LASF1873:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR_MIN 0"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF672:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1265:
+	.string	"SETTING_MC_AIRMODE_TYPE_MAX 0"
+.LASF1256:
+	.string	"SETTING_POS_HOLD_DEADBAND_MAX 250"
+.LASF1202:
+	.string	"SETTING_IMU_DCM_KP_MAG_MAX 65535"
+.LASF753:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1032:
+	.string	"SETTING_FAILSAFE_STICK_THRESHOLD 81"
+.LASF1044:
+	.string	"SETTING_FAILSAFE_MIN_DISTANCE 85"
+.LASF2224:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1767:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT 326"
+.LASF2387:
+	.string	"__DECL_SIMD_expm1l "
+.LASF3056:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1553:
+	.string	"SETTING_INAV_W_Z_BARO_P_MAX 10"
+.LASF889:
+	.string	"SETTING_MAG_DECLINATION_MIN -18000"
+.LASF2151:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF3412:
+	.string	"table_rssi_source"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF1564:
+	.string	"SETTING_INAV_W_XY_GPS_V_MIN 0"
+.LASF1946:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1960:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF921:
+	.string	"SETTING_PITOT_HARDWARE 44"
+.LASF2639:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1544:
+	.string	"SETTING_INAV_W_Z_SURFACE_V_MAX 100"
+.LASF1579:
+	.string	"SETTING_INAV_MAX_EPH_EPV_MIN 0"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2893:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2416:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1068:
+	.string	"SETTING_CURRENT_METER_OFFSET 93"
+.LASF471:
+	.string	"__P(args) args"
+.LASF3512:
+	.string	"RESOURCE_EXTI"
+.LASF2474:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF3052:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF2159:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1705:
+	.string	"SETTING_NAV_MC_POS_EXPO_MIN 0"
+.LASF1986:
+	.string	"USE_NAV "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF2847:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF678:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF2652:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1448:
+	.string	"SETTING_NAV_FW_POS_XY_P_MAX 255"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1313:
+	.string	"SETTING_MC_D_LEVEL_MAX 200"
+.LASF2552:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF686:
+	.string	"INT_FAST8_MAX (127)"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF644:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF2686:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1975:
+	.string	"USE_SERIAL_RX "
+.LASF477:
+	.string	"__END_DECLS "
+.LASF3621:
+	.string	"settingsPgn"
+.LASF1492:
+	.string	"SETTING_ANTIGRAVITY_ACCELERATOR_MIN 1"
+.LASF1590:
+	.string	"SETTING_NAV_EXTRA_ARMING_SAFETY 267"
+.LASF2883:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF953:
+	.string	"SETTING_SBUS_SYNC_INTERVAL_MAX 10000"
+.LASF1411:
+	.string	"SETTING_NAV_MC_VEL_Z_I_MIN 0"
+.LASF1039:
+	.string	"SETTING_FAILSAFE_FW_PITCH_ANGLE_MIN -800"
+.LASF661:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF3116:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1145:
+	.string	"SETTING_THR_MID_MAX 100"
+.LASF1651:
+	.string	"SETTING_NAV_RTH_ABORT_THRESHOLD_MIN 0"
+.LASF3245:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF639:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1523:
+	.string	"SETTING_INAV_GRAVITY_CAL_TOLERANCE_MAX 255"
+.LASF595:
+	.string	"__U32_TYPE unsigned int"
+.LASF3203:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF3120:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"SETTING_NAV_LANDING_SPEED 276"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF3330:
+	.string	"setting_min_t"
+.LASF3363:
+	.string	"TABLE_PIDTYPETABLE"
+.LASF1392:
+	.string	"SETTING_ITERM_WINDUP 201"
+.LASF988:
+	.string	"SETTING_MAX_THROTTLE_MIN 1000"
+.LASF1290:
+	.string	"SETTING_MC_CD_ROLL 167"
+.LASF1311:
+	.string	"SETTING_MC_D_LEVEL 174"
+.LASF1835:
+	.string	"SETTING_SIM_PIN_MAX 8"
+.LASF435:
+	.string	"_POSIX_SOURCE 1"
+.LASF1843:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_HIGH_MIN 0"
+.LASF2549:
+	.string	"__f64x(x) x ##f64x"
+.LASF2732:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF2824:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF2248:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF2216:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF2046:
+	.string	"USE_SERIALRX_SUMH "
+.LASF880:
+	.string	"SETTING_ALIGN_OPFLOW_MIN 0"
+.LASF3218:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF739:
+	.string	"__WCHAR_T "
+.LASF1894:
+	.string	"SETTING_TZ_AUTOMATIC_DST_MIN 0"
+.LASF3552:
+	.string	"PID_POS_Z"
+.LASF1183:
+	.string	"SETTING_MANUAL_PITCH_RATE_MIN 0"
+.LASF2142:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF3582:
+	.string	"BOXTELEMETRY"
+.LASF598:
+	.string	"__SQUAD_TYPE long int"
+.LASF3040:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3125:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF3577:
+	.string	"BOXBEEPERON"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF755:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF2743:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF1362:
+	.string	"SETTING_DTERM_LPF2_HZ 191"
+.LASF3634:
+	.string	"sl_tolower"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF853:
+	.string	"SETTING_ACC_LPF_TYPE_MIN 0"
+.LASF3323:
+	.string	"long int"
+.LASF1371:
+	.string	"SETTING_FW_ITERM_THROW_LIMIT 194"
+.LASF3550:
+	.string	"PID_PITCH"
+.LASF2539:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF2569:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF3405:
+	.string	"table_off_on"
+.LASF2677:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF1336:
+	.string	"SETTING_FW_I_YAW_MIN 0"
+.LASF1230:
+	.string	"SETTING_GPS_SBAS_MODE 147"
+.LASF3606:
+	.string	"BOXLOITERDIRCHN"
+.LASF3212:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1867:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MIN 0"
+.LASF3243:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF3171:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF3344:
+	.string	"TABLE_FAILSAFE_PROCEDURE"
+.LASF1808:
+	.string	"SETTING_FRSKY_VFAS_PRECISION_MAX 1"
+.LASF2757:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF3687:
+	.string	"bufPtr"
+.LASF2335:
+	.string	"__DECL_SIMD_asin "
+.LASF1849:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MIN 0"
+.LASF605:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2223:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF3640:
+	.string	"start"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1762:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME_MIN 0"
+.LASF3574:
+	.string	"BOXNAVRTH"
+.LASF885:
+	.string	"SETTING_MAG_HARDWARE 32"
+.LASF2463:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF2186:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF3267:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF3586:
+	.string	"BOXAIRMODE"
+.LASF1520:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MAX 0"
+.LASF1559:
+	.string	"SETTING_INAV_W_Z_GPS_V_MAX 10"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1178:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MAX 100"
+.LASF713:
+	.string	"UINT8_C(c) c"
+.LASF789:
+	.string	"SETTING_LOOPTIME 0"
+.LASF2532:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF3276:
+	.string	"VTX_SETTINGS_CHANNEL_COUNT (VTX_SETTINGS_MAX_CHANNEL - VTX_SETTINGS_MIN_CHANNEL + 1)"
+.LASF3681:
+	.string	"settingSetString"
+.LASF2009:
+	.string	"USE_OPFLOW_MSP "
+.LASF3026:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF2567:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF3261:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1160:
+	.string	"SETTING_RC_EXPO_MAX 100"
+.LASF1906:
+	.string	"SETTING_VTX_CHANNEL_MIN 1"
+.LASF1343:
+	.string	"SETTING_FW_P_LEVEL_MAX 200"
+.LASF1082:
+	.string	"SETTING_IDLE_POWER_MAX 65535"
+.LASF2618:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1605:
+	.string	"SETTING_NAV_AUTO_SPEED 272"
+.LASF1172:
+	.string	"SETTING_YAW_RATE_MAX 180"
+.LASF1921:
+	.string	"SETTING_LOG_LEVEL_MIN 0"
+.LASF1364:
+	.string	"SETTING_DTERM_LPF2_HZ_MAX 500"
+.LASF2466:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1795:
+	.string	"SETTING_FRSKY_DEFAULT_LATITUDE_MIN -90"
+.LASF722:
+	.string	"_ANSI_STDDEF_H "
+.LASF735:
+	.string	"__WCHAR_T__ "
+.LASF884:
+	.string	"SETTING_ALIGN_MAG_MAX 0"
+.LASF2508:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF2173:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF972:
+	.string	"SETTING_SERIALRX_HALFDUPLEX 61"
+.LASF680:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF940:
+	.string	"SETTING_RSSI_SOURCE_MIN 0"
+.LASF3154:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF2601:
+	.string	"__MATHDECL_1"
+.LASF1525:
+	.string	"SETTING_INAV_USE_GPS_VELNED_MIN 0"
+.LASF1025:
+	.string	"SETTING_FAILSAFE_THROTTLE_MAX 2000"
+.LASF1884:
+	.string	"SETTING_STATS_TOTAL_TIME 365"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF965:
+	.string	"SETTING_RX_SPI_RF_CHANNEL_COUNT_MAX 8"
+.LASF995:
+	.string	"SETTING_MOTOR_PWM_RATE_MAX 32000"
+.LASF2026:
+	.string	"USE_D_BOOST "
+.LASF1751:
+	.string	"SETTING_NAV_FW_LAUNCH_DETECT_TIME_MAX 1000"
+.LASF413:
+	.string	"__USE_LARGEFILE64"
+.LASF1577:
+	.string	"SETTING_INAV_W_ACC_BIAS_MAX 1"
+.LASF2915:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2582:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF403:
+	.string	"__USE_POSIX199309"
+.LASF1621:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT_MIN 50"
+.LASF3404:
+	.string	"table_nav_user_control_mode"
+.LASF1078:
+	.string	"SETTING_CRUISE_POWER_MIN 0"
+.LASF2521:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1120:
+	.string	"SETTING_3D_DEADBAND_HIGH_MIN 1000"
+.LASF1563:
+	.string	"SETTING_INAV_W_XY_GPS_V 258"
+.LASF2027:
+	.string	"USE_ANTIGRAVITY "
+.LASF1060:
+	.string	"SETTING_ALIGN_BOARD_YAW_MIN -1800"
+.LASF1575:
+	.string	"SETTING_INAV_W_ACC_BIAS 262"
+.LASF1332:
+	.string	"SETTING_FW_P_YAW 181"
+.LASF2848:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1221:
+	.string	"SETTING_SWITCH_DISARM_DELAY 144"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1777:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE_MIN 0"
+.LASF1928:
+	.string	"true 1"
+.LASF3655:
+	.string	"settingGetMin"
+.LASF3580:
+	.string	"BOXNAVLAUNCH"
+.LASF2955:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2936:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1086:
+	.string	"SETTING_THR_COMP_WEIGHT 99"
+.LASF1535:
+	.string	"SETTING_INAV_RESET_HOME_MAX 0"
+.LASF1380:
+	.string	"SETTING_FW_TURN_ASSIST_YAW_GAIN 197"
+.LASF2417:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2846:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2535:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1712:
+	.string	"SETTING_NAV_FW_MIN_THR_MAX 2000"
+.LASF2628:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF985:
+	.string	"SETTING_BLACKBOX_COMPRESSION_MIN 0"
+.LASF1531:
+	.string	"SETTING_INAV_RESET_ALTITUDE_MIN 0"
+.LASF887:
+	.string	"SETTING_MAG_HARDWARE_MAX 0"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2957:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF3693:
+	.string	"SETTING_TYPE"
+.LASF1481:
+	.string	"SETTING_D_BOOST_FACTOR_MAX 3"
+.LASF2191:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF2627:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF2551:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF3519:
+	.string	"RESOURCE_ADC_CH1"
+.LASF3520:
+	.string	"RESOURCE_ADC_CH2"
+.LASF3521:
+	.string	"RESOURCE_ADC_CH3"
+.LASF574:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF851:
+	.string	"SETTING_ACC_LPF_HZ_MAX 200"
+.LASF2254:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF600:
+	.string	"__SWORD_TYPE long int"
+.LASF2297:
+	.string	"__DECL_SIMD_expl "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF835:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MIN 1"
+.LASF2679:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF3528:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2108:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF3325:
+	.string	"int16_t"
+.LASF1180:
+	.string	"SETTING_MANUAL_ROLL_RATE_MIN 0"
+.LASF3084:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1732:
+	.string	"SETTING_NAV_FW_CRUISE_SPEED_MIN 0"
+.LASF2776:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF510:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF1056:
+	.string	"SETTING_ALIGN_BOARD_PITCH 89"
+.LASF2324:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF3206:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1827:
+	.string	"SETTING_LTM_UPDATE_RATE 346"
+.LASF2227:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF3197:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF717:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1505:
+	.string	"SETTING_FW_AUTOTUNE_OVERSHOOT_TIME_MAX 500"
+.LASF2270:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF418:
+	.string	"__USE_GNU"
+.LASF673:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1349:
+	.string	"SETTING_FW_D_LEVEL_MAX 200"
+.LASF1872:
+	.string	"SETTING_THROTTLE_TILT_COMP_STR 361"
+.LASF1348:
+	.string	"SETTING_FW_D_LEVEL_MIN 0"
+.LASF459:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF708:
+	.string	"WINT_MAX (4294967295u)"
+.LASF450:
+	.string	"__USE_MISC 1"
+.LASF604:
+	.string	"__S64_TYPE long int"
+.LASF1710:
+	.string	"SETTING_NAV_FW_MIN_THR 307"
+.LASF3269:
+	.string	"MAX_CHANNEL_ACTIVATION_CONDITION_COUNT 10"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF427:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF3636:
+	.string	"sl_strncasecmp"
+.LASF2932:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF2306:
+	.string	"__DECL_SIMD_powf "
+.LASF1455:
+	.string	"SETTING_NAV_FW_HEADING_P 222"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2663:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF3253:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF400:
+	.string	"__USE_ISOCXX11"
+.LASF446:
+	.string	"__WORDSIZE 64"
+.LASF2260:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF2178:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF2990:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2578:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF2591:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1597:
+	.string	"SETTING_NAV_POSITION_TIMEOUT_MIN 0"
+.LASF2907:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3240:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1998:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1155:
+	.string	"SETTING_FW_TPA_TIME_CONSTANT 122"
+.LASF2690:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF3232:
+	.string	"SIM_MIN_TRANSMIT_INTERVAL 10"
+.LASF1620:
+	.string	"SETTING_NAV_LAND_SLOWDOWN_MINALT 277"
+.LASF2407:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2726:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF676:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1403:
+	.string	"SETTING_HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF2595:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1635:
+	.string	"SETTING_NAV_RTH_CLIMB_FIRST 282"
+.LASF2837:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1583:
+	.string	"SETTING_INAV_BARO_EPV_MAX 9999"
+.LASF1005:
+	.string	"SETTING_THROTTLE_SCALE 72"
+.LASF2513:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF834:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS 15"
+.LASF3479:
+	.string	"OWNER_SPI"
+.LASF564:
+	.string	"__need_NULL "
+.LASF2547:
+	.string	"__f64(x) x ##f64"
+.LASF599:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF643:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF481:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF633:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF3629:
+	.string	"settingNameHashIndexes"
+.LASF2113:
+	.string	"U_ID_1 1"
+.LASF2145:
+	.string	"PG_CF_START 1"
+.LASF962:
+	.string	"SETTING_SERIALRX_INVERTED_MAX 0"
+.LASF2271:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1829:
+	.string	"SETTING_LTM_UPDATE_RATE_MAX 0"
+.LASF2080:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF578:
+	.string	"__DEFINED_size_t "
+.LASF1069:
+	.string	"SETTING_CURRENT_METER_OFFSET_MIN -32768"
+.LASF2953:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF3674:
+	.string	"seed"
+.LASF2723:
+	.string	"MIDRC_MIN 1200"
+.LASF2467:
+	.string	"__DECL_SIMD_acoshl "
+.LASF2289:
+	.string	"__DECL_SIMD_logf32 "
+.LASF3623:
+	.string	"settingNamesWords"
+.LASF3259:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF2057:
+	.string	"USE_VTX_FFPV "
+.LASF1976:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2427:
+	.string	"__DECL_SIMD_log10l "
+.LASF3209:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1897:
+	.string	"SETTING_DISPLAY_FORCE_SW_BLINK_MIN 0"
+.LASF2155:
+	.string	"PG_PID_PROFILE 14"
+.LASF3291:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF2166:
+	.string	"PG_GPS_CONFIG 30"
+.LASF2132:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1185:
+	.string	"SETTING_MANUAL_YAW_RATE 132"
+.LASF1647:
+	.string	"SETTING_NAV_RTH_ALT_MODE 286"
+.LASF2537:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2528:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF838:
+	.string	"SETTING_ACC_NOTCH_HZ_MIN 0"
+.LASF1495:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MIN 1"
+.LASF2710:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF470:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2495:
+	.string	"__DECL_SIMD_asinh "
+.LASF3044:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF3275:
+	.string	"VTX_SETTINGS_BAND_COUNT (VTX_SETTINGS_MAX_BAND - VTX_SETTINGS_MIN_BAND + 1)"
+.LASF1615:
+	.string	"SETTING_NAV_MANUAL_CLIMB_RATE_MIN 10"
+.LASF487:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2855:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2654:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF3043:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF881:
+	.string	"SETTING_ALIGN_OPFLOW_MAX 0"
+.LASF2198:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF2225:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF3505:
+	.string	"RESOURCE_INPUT"
+.LASF2758:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1102:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MIN 0"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF3379:
+	.string	"table_aux_operator"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1359:
+	.string	"SETTING_DTERM_LPF_TYPE 190"
+.LASF1965:
+	.string	"SETTING_SECTION_OFFSET 4"
+.LASF2093:
+	.string	"USE_RANGEFINDER"
+.LASF2476:
+	.string	"__DECL_SIMD_erff "
+.LASF669:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2405:
+	.string	"__DECL_SIMD_cbrt "
+.LASF796:
+	.string	"SETTING_PID_PROCESS_DENOM_MIN 1"
+.LASF790:
+	.string	"SETTING_LOOPTIME_MIN 0"
+.LASF1129:
+	.string	"SETTING_SERVO_CENTER_PULSE_MIN 1000"
+.LASF3390:
+	.string	"table_frsky_unit"
+.LASF1318:
+	.string	"SETTING_FW_I_PITCH_MIN 0"
+.LASF2891:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2622:
+	.string	"FP_ZERO 2"
+.LASF1601:
+	.string	"SETTING_NAV_WP_RADIUS_MAX 10000"
+.LASF1177:
+	.string	"SETTING_MANUAL_RC_YAW_EXPO_MIN 0"
+.LASF3524:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF2509:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1945:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1376:
+	.string	"SETTING_FW_LOITER_DIRECTION_MAX 0"
+.LASF494:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1379:
+	.string	"SETTING_FW_REFERENCE_AIRSPEED_MAX 5000"
+.LASF593:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1768:
+	.string	"SETTING_NAV_FW_LAUNCH_TIMEOUT_MIN 0"
+.LASF2745:
+	.string	"SPEKTRUM_SAT_BIND_DISABLED 0"
+.LASF1761:
+	.string	"SETTING_NAV_FW_LAUNCH_SPINUP_TIME 324"
+.LASF867:
+	.string	"SETTING_ACCGAIN_Y 26"
+.LASF3248:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF3019:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF514:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF3167:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF994:
+	.string	"SETTING_MOTOR_PWM_RATE_MIN 50"
+.LASF2025:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF602:
+	.string	"__SLONG32_TYPE int"
+.LASF1793:
+	.string	"SETTING_TELEMETRY_INVERTED_MAX 0"
+.LASF843:
+	.string	"SETTING_ALIGN_ACC 18"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF629:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1471:
+	.string	"SETTING_MC_ITERM_RELAX_TYPE_MIN 0"
+.LASF440:
+	.string	"__USE_POSIX199309 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF638:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1398:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW 203"
+.LASF2358:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF2098:
+	.string	"USE_1WIRE"
+.LASF3155:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2898:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2761:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF552:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF845:
+	.string	"SETTING_ALIGN_ACC_MAX 0"
+.LASF1297:
+	.string	"SETTING_MC_I_YAW_MIN 0"
+.LASF3066:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1581:
+	.string	"SETTING_INAV_BARO_EPV 264"
+.LASF3676:
+	.string	"hash"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF3620:
+	.string	"LOG_TOPIC_COUNT"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF3534:
+	.string	"ROLL"
+.LASF1233:
+	.string	"SETTING_GPS_DYN_MODEL 148"
+.LASF1915:
+	.string	"SETTING_VTX_PIT_MODE_CHAN_MIN 1"
+.LASF907:
+	.string	"SETTING_ALIGN_MAG_PITCH_MIN -1800"
+.LASF1500:
+	.string	"SETTING_MC_CD_LPF_HZ 237"
+.LASF3427:
+	.string	"lookupTableEntry_s"
+.LASF3430:
+	.string	"lookupTableEntry_t"
+.LASF1126:
+	.string	"SETTING_SERVO_PROTOCOL_MIN 0"
+.LASF2731:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF659:
+	.string	"INT16_MIN (-32767-1)"
+.LASF683:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1257:
+	.string	"SETTING_ALT_HOLD_DEADBAND 156"
+.LASF2768:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF897:
+	.string	"SETTING_MAGZERO_Z 36"
+.LASF1865:
+	.string	"SETTING_MAVLINK_EXTRA1_RATE_MAX 255"
+.LASF1684:
+	.string	"SETTING_NAV_MC_BRAKING_TIMEOUT_MIN 100"
+.LASF3282:
+	.string	"VTX_SETTINGS_MAX_FREQUENCY_MHZ 5999"
+.LASF3070:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2030:
+	.string	"USE_LOG "
+.LASF2833:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF3317:
+	.string	"signed char"
+.LASF1927:
+	.string	"bool _Bool"
+.LASF2294:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1454:
+	.string	"SETTING_NAV_FW_POS_XY_D_MAX 255"
+.LASF764:
+	.string	"EXPAND_I(x) x"
+.LASF1836:
+	.string	"SETTING_SIM_TRANSMIT_INTERVAL 349"
+.LASF3205:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF3442:
+	.string	"BATTERY_CONFIG_VALUE"
+.LASF1633:
+	.string	"SETTING_NAV_OVERRIDES_MOTOR_STOP_MIN 0"
+.LASF1985:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF2606:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1958:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1560:
+	.string	"SETTING_INAV_W_XY_GPS_P 257"
+.LASF500:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1938:
+	.string	"EXTENDED_FASTRAM "
+.LASF3326:
+	.string	"uint8_t"
+.LASF2522:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF3492:
+	.string	"OWNER_TX"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1205:
+	.string	"SETTING_IMU_DCM_KI_MAG_MAX 65535"
+.LASF1220:
+	.string	"SETTING_DISARM_KILL_SWITCH_MAX 0"
+.LASF687:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1609:
+	.string	"SETTING_NAV_AUTO_CLIMB_RATE_MIN 10"
+.LASF2820:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1204:
+	.string	"SETTING_IMU_DCM_KI_MAG_MIN 0"
+.LASF506:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2671:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF2498:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF3352:
+	.string	"TABLE_ITERM_RELAX_TYPE"
+.LASF1154:
+	.string	"SETTING_TPA_BREAKPOINT_MAX 2000"
+.LASF1741:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MIN 100"
+.LASF3339:
+	.string	"TABLE_BLACKBOX_COMPRESSION"
+.LASF919:
+	.string	"SETTING_BARO_CAL_TOLERANCE_MIN 0"
+.LASF2219:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF466:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF374:
+	.string	"__unix 1"
+.LASF2763:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF3217:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF415:
+	.string	"__USE_MISC"
+.LASF3372:
+	.string	"TABLE_TZ_AUTOMATIC_DST"
+.LASF710:
+	.string	"INT16_C(c) c"
+.LASF3403:
+	.string	"table_nav_rth_alt_mode"
+.LASF910:
+	.string	"SETTING_ALIGN_MAG_YAW_MIN -1800"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2792:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF3121:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF3153:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1206:
+	.string	"SETTING_SMALL_ANGLE 139"
+.LASF2706:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1421:
+	.string	"SETTING_NAV_MC_VEL_XY_P_MAX 255"
+.LASF1317:
+	.string	"SETTING_FW_I_PITCH 176"
+.LASF3654:
+	.string	"settingGetMax"
+.LASF1800:
+	.string	"SETTING_FRSKY_COORDINATES_FORMAT 337"
+.LASF1572:
+	.string	"SETTING_INAV_W_XYZ_ACC_P 261"
+.LASF1962:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF836:
+	.string	"SETTING_GYRO_KALMAN_SHARPNESS_MAX 16000"
+.LASF2014:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF2179:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF2232:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1822:
+	.string	"SETTING_SMARTPORT_FUEL_UNIT_MIN 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2148:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF2881:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF463:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1108:
+	.string	"SETTING_HAS_FLAPS_MIN 0"
+.LASF3642:
+	.string	"settingGetStringMaxLength"
+.LASF3298:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF550:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF671:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF2767:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2839:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2593:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF3662:
+	.string	"invalidIndex"
+.LASF833:
+	.string	"SETTING_GYRO_KALMAN_W_MAX 40"
+.LASF3145:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE_MAX 180"
+.LASF950:
+	.string	"SETTING_RSSI_MAX_MAX 100"
+.LASF1286:
+	.string	"SETTING_MC_I_ROLL_MAX 200"
+.LASF3324:
+	.string	"int8_t"
+.LASF813:
+	.string	"SETTING_GYRO_NOTCH_HZ 8"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2978:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF535:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF2492:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF3057:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"SETTING_TPA_BREAKPOINT_MIN 1000"
+.LASF1931:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2396:
+	.string	"__DECL_SIMD_sinhf "
+.LASF3058:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF3172:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF2430:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF3278:
+	.string	"VTX_SETTINGS_DEFAULT_CHANNEL 1"
+.LASF3042:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF3530:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF3646:
+	.string	"settingGetString"
+.LASF2599:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1562:
+	.string	"SETTING_INAV_W_XY_GPS_P_MAX 10"
+.LASF979:
+	.string	"SETTING_BLACKBOX_RATE_DENOM_MIN 1"
+.LASF1742:
+	.string	"SETTING_NAV_FW_LAUNCH_VELOCITY_MAX 10000"
+.LASF525:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF814:
+	.string	"SETTING_GYRO_NOTCH_HZ_MIN 0"
+.LASF2614:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF2446:
+	.string	"__DECL_SIMD_log1pf "
+.LASF2964:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1242:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO 151"
+.LASF1304:
+	.string	"SETTING_MC_CD_YAW_MAX 200"
+.LASF3093:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF2858:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1037:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MAX 800"
+.LASF404:
+	.string	"__USE_POSIX199506"
+.LASF2413:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF858:
+	.string	"SETTING_ACCZERO_Y 23"
+.LASF2579:
+	.string	"_Mdouble_"
+.LASF553:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF2571:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF765:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2388:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1442:
+	.string	"SETTING_NAV_FW_POS_Z_I_MAX 255"
+.LASF1883:
+	.string	"SETTING_STATS_MAX 0"
+.LASF3247:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF930:
+	.string	"SETTING_RECEIVER_TYPE 47"
+.LASF1135:
+	.string	"SETTING_SERVO_LPF_HZ_MIN 0"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF3327:
+	.string	"uint16_t"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF840:
+	.string	"SETTING_ACC_NOTCH_CUTOFF 17"
+.LASF677:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF647:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2538:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF936:
+	.string	"SETTING_MAX_CHECK 49"
+.LASF2674:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1944:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF532:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF483:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1540:
+	.string	"SETTING_INAV_W_Z_SURFACE_P_MIN 0"
+.LASF1167:
+	.string	"SETTING_PITCH_RATE 126"
+.LASF1271:
+	.string	"SETTING_MC_P_PITCH_MAX 200"
+.LASF1399:
+	.string	"SETTING_RATE_ACCEL_LIMIT_YAW_MIN 0"
+.LASF2682:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF531:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1557:
+	.string	"SETTING_INAV_W_Z_GPS_V 256"
+.LASF517:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF812:
+	.string	"SETTING_MORON_THRESHOLD_MAX 128"
+.LASF1104:
+	.string	"SETTING_PLATFORM_TYPE 105"
+.LASF1720:
+	.string	"SETTING_NAV_FW_CLIMB_ANGLE_MIN 5"
+.LASF2565:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF3006:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1988:
+	.string	"USE_TELEMETRY_LTM "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1727:
+	.string	"SETTING_NAV_FW_PITCH2THR_MAX 100"
+.LASF2230:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF3034:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF3633:
+	.string	"pgFind"
+.LASF3225:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF2493:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF830:
+	.string	"SETTING_GYRO_KALMAN_Q_MAX 16000"
+.LASF2139:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF539:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2021:
+	.string	"USE_TELEMETRY_SIM "
+.LASF2346:
+	.string	"__DECL_SIMD_hypotf "
+.LASF781:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF2109:
+	.string	"USE_ITCM_RAM"
+.LASF526:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF873:
+	.string	"SETTING_OPFLOW_HARDWARE 28"
+.LASF3680:
+	.string	"settingNameContains"
+.LASF727:
+	.string	"_PTRDIFF_T_ "
+.LASF3423:
+	.string	"copy"
+.LASF2052:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2900:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF2483:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1799:
+	.string	"SETTING_FRSKY_DEFAULT_LONGITUDE_MAX 180"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF3625:
+	.string	"settingLookupTables"
+.LASF438:
+	.string	"__USE_POSIX 1"
+.LASF1259:
+	.string	"SETTING_ALT_HOLD_DEADBAND_MAX 250"
+.LASF1502:
+	.string	"SETTING_MC_CD_LPF_HZ_MAX 200"
+.LASF1754:
+	.string	"SETTING_NAV_FW_LAUNCH_THR_MAX 2000"
+.LASF2082:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF3664:
+	.string	"isValid"
+.LASF1984:
+	.string	"USE_GPS "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2359:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2418:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1293:
+	.string	"SETTING_MC_P_YAW 168"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF3128:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF3613:
+	.string	"LOG_TOPIC_PWM"
+.LASF2461:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2234:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1918:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE_MIN 0"
+.LASF1974:
+	.string	"USE_RX_PPM "
+.LASF2423:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2455:
+	.string	"__DECL_SIMD_atanh "
+.LASF495:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF468:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2611:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF2612:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF2613:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1791:
+	.string	"SETTING_TELEMETRY_INVERTED 334"
+.LASF2721:
+	.string	"PWM_PULSE_MIN 750"
+.LASF1084:
+	.string	"SETTING_RTH_ENERGY_MARGIN_MIN 0"
+.LASF2830:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF528:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF2479:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2434:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1629:
+	.string	"SETTING_NAV_MIN_RTH_DISTANCE 280"
+.LASF1355:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT_MAX 900"
+.LASF2038:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF2207:
+	.string	"PG_INAV_END 1023"
+.LASF2086:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF2796:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1692:
+	.string	"SETTING_NAV_MC_BRAKING_BOOST_SPEED_THRESHOLD 301"
+.LASF3293:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF1460:
+	.string	"SETTING_NAV_FW_POS_HDG_P_MAX 255"
+.LASF2884:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF2484:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2276:
+	.string	"__DECL_SIMD_sincosf "
+.LASF469:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF839:
+	.string	"SETTING_ACC_NOTCH_HZ_MAX 255"
+.LASF3138:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1333:
+	.string	"SETTING_FW_P_YAW_MIN 0"
+.LASF2854:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF2491:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2960:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF498:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1118:
+	.string	"SETTING_3D_DEADBAND_LOW_MAX 2000"
+.LASF1353:
+	.string	"SETTING_MAX_ANGLE_INCLINATION_PIT 188"
+.LASF2468:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1989:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF914:
+	.string	"SETTING_BARO_HARDWARE_MAX 0"
+.LASF2090:
+	.string	"USE_OLED_UG2864"
+.LASF2965:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF567:
+	.string	"_SIZE_T "
+.LASF1009:
+	.string	"SETTING_THROTTLE_IDLE_MIN 4"
+.LASF2403:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1596:
+	.string	"SETTING_NAV_POSITION_TIMEOUT 269"
+.LASF2557:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF2083:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1105:
+	.string	"SETTING_PLATFORM_TYPE_MIN 0"
+.LASF2133:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF2568:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF674:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF3376:
+	.string	"table_acc_hardware"
+.LASF1277:
+	.string	"SETTING_MC_D_PITCH_MAX 200"
+.LASF1729:
+	.string	"SETTING_NAV_FW_LOITER_RADIUS_MIN 0"
+.LASF3448:
+	.string	"indexes"
+.LASF1218:
+	.string	"SETTING_DISARM_KILL_SWITCH 143"
+.LASF2531:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF3627:
+	.string	"settingsTable"
+.LASF2331:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1917:
+	.string	"SETTING_VTX_MAX_POWER_OVERRIDE 376"
+.LASF2896:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1978:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2505:
+	.string	"__DECL_SIMD_erfc "
+.LASF718:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF2221:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF898:
+	.string	"SETTING_MAGZERO_Z_MIN -32768"
+.LASF2397:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1737:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE 316"
+.LASF516:
+	.string	"__restrict_arr __restrict"
+.LASF1295:
+	.string	"SETTING_MC_P_YAW_MAX 200"
+.LASF1055:
+	.string	"SETTING_ALIGN_BOARD_ROLL_MAX 3600"
+.LASF2204:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF2643:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF3188:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1024:
+	.string	"SETTING_FAILSAFE_THROTTLE_MIN 1000"
+.LASF2979:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1074:
+	.string	"SETTING_BAT_VOLTAGE_SRC 95"
+.LASF406:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF3418:
+	.string	"table_vtx_low_power_disarm"
+.LASF2136:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1335:
+	.string	"SETTING_FW_I_YAW 182"
+.LASF2147:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF715:
+	.string	"UINT32_C(c) c ## U"
+.LASF2774:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF3500:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF2887:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1507:
+	.string	"SETTING_FW_AUTOTUNE_UNDERSHOOT_TIME_MIN 50"
+.LASF1092:
+	.string	"SETTING_BATTERY_CAPACITY_WARNING 101"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF2127:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2998:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1527:
+	.string	"SETTING_INAV_ALLOW_DEAD_RECKONING 246"
+.LASF1478:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF_MAX 100"
+.LASF1193:
+	.string	"SETTING_REBOOT_CHARACTER_MAX 126"
+.LASF3619:
+	.string	"LOG_TOPIC_OSD"
+.LASF3557:
+	.string	"PID_HEADING"
+.LASF1384:
+	.string	"SETTING_FW_ITERM_LIMIT_STICK_POSITION_MIN 0"
+.LASF3189:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF2870:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF745:
+	.string	"___int_wchar_t_h "
+.LASF465:
+	.string	"__LEAF , __leaf__"
+.LASF2211:
+	.string	"PG_ID_INVALID 0"
+.LASF618:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2018:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF3143:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2879:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF3117:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2243:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF3514:
+	.string	"RESOURCE_I2C_SDA"
+.LASF754:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF3594:
+	.string	"BOXAUTOTUNE"
+.LASF1429:
+	.string	"SETTING_NAV_MC_VEL_XY_FF_MIN 0"
+.LASF1771:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ALTITUDE_MIN 0"
+.LASF1658:
+	.string	"SETTING_NAV_RTH_ALTITUDE_MAX 65000"
+.LASF861:
+	.string	"SETTING_ACCZERO_Z 24"
+.LASF998:
+	.string	"SETTING_MOTOR_ACCEL_TIME_MAX 1000"
+.LASF2327:
+	.string	"__DECL_SIMD_atanl "
+.LASF2585:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF3312:
+	.string	"char"
+.LASF1643:
+	.string	"SETTING_NAV_RTH_TAIL_FIRST_MAX 0"
+.LASF3329:
+	.string	"setting_offset_t"
+.LASF2165:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF3365:
+	.string	"TABLE_PLATFORM_TYPE"
+.LASF3473:
+	.string	"OWNER_ADC"
+.LASF3237:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF3402:
+	.string	"table_nav_rth_allow_landing"
+.LASF2460:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF2116:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2573:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF763:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2782:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF1112:
+	.string	"SETTING_MODEL_PREVIEW_TYPE_MAX 32767"
+.LASF2705:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF736:
+	.string	"_WCHAR_T "
+.LASF1900:
+	.string	"SETTING_VTX_HALFDUPLEX_MIN 0"
+.LASF762:
+	.string	"STR_HELPER(x) #x"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2586:
+	.string	"_Mdouble_ long double"
+.LASF3398:
+	.string	"table_ltm_rates"
+.LASF3343:
+	.string	"TABLE_DIRECTION"
+.LASF829:
+	.string	"SETTING_GYRO_KALMAN_Q_MIN 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF795:
+	.string	"SETTING_PID_PROCESS_DENOM 2"
+.LASF2320:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF2347:
+	.string	"__DECL_SIMD_hypotl "
+.LASF932:
+	.string	"SETTING_RECEIVER_TYPE_MAX 0"
+.LASF3571:
+	.string	"BOXHEADFREE"
+.LASF1701:
+	.string	"SETTING_NAV_MC_POS_DECELERATION_TIME 304"
+.LASF1515:
+	.string	"SETTING_FW_AUTOTUNE_FF_TO_I_TC 242"
+.LASF2514:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF628:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1316:
+	.string	"SETTING_FW_P_PITCH_MAX 200"
+.LASF3359:
+	.string	"TABLE_NAV_RTH_ALT_MODE"
+.LASF1831:
+	.string	"SETTING_SIM_GROUND_STATION_NUMBER_MIN 0"
+.LASF2110:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF2626:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF2588:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF521:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1103:
+	.string	"SETTING_MOTOR_DIRECTION_INVERTED_MAX 0"
+.LASF820:
+	.string	"SETTING_GYRO_STAGE2_LOWPASS_HZ_MIN 0"
+.LASF409:
+	.string	"__USE_XOPEN2KXSI"
+.LASF3239:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2486:
+	.string	"__DECL_SIMD_tanhf "
+.LASF3301:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF2930:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2691:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF1002:
+	.string	"SETTING_MOTOR_PWM_PROTOCOL 71"
+.LASF462:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF662:
+	.string	"INT8_MAX (127)"
+.LASF1284:
+	.string	"SETTING_MC_I_ROLL 165"
+.LASF2012:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1724:
+	.string	"SETTING_NAV_FW_DIVE_ANGLE_MAX 80"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1496:
+	.string	"SETTING_ANTIGRAVITY_CUTOFF_LPF_HZ_MAX 30"
+.LASF3516:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF3235:
+	.string	"SIM_DEFAULT_TX_FLAGS \"f\""
+.LASF1268:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD_MAX 2000"
+.LASF847:
+	.string	"SETTING_ACC_HARDWARE_MIN 0"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF3496:
+	.string	"OWNER_COMPASS"
+.LASF3109:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF580:
+	.string	"_GCC_SIZE_T "
+.LASF1952:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1942:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF709:
+	.string	"INT8_C(c) c"
+.LASF1967:
+	.string	"SETTING_TYPE_MASK (0x0F)"
+.LASF3287:
+	.string	"VTX_SETTINGS_MAX_USER_FREQ 5999"
+.LASF751:
+	.string	"__need_wchar_t"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1473:
+	.string	"SETTING_MC_ITERM_RELAX 228"
+.LASF2129:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1188:
+	.string	"SETTING_FPV_MIX_DEGREES 133"
+.LASF1893:
+	.string	"SETTING_TZ_AUTOMATIC_DST 368"
+.LASF2802:
+	.string	"IOCFG_IPD 0"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1487:
+	.string	"SETTING_D_BOOST_GYRO_DELTA_LPF_HZ_MAX 250"
+.LASF2890:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF3535:
+	.string	"PITCH"
+.LASF1017:
+	.string	"SETTING_FAILSAFE_RECOVERY_DELAY 76"
+.LASF2277:
+	.string	"__DECL_SIMD_sincosl "
+.LASF594:
+	.string	"__S32_TYPE int"
+.LASF2924:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF3144:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"SETTING_ALIGN_BOARD_PITCH_MAX 3600"
+.LASF1955:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1152:
+	.string	"SETTING_TPA_BREAKPOINT 121"
+.LASF568:
+	.string	"_SYS_SIZE_T_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF642:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1281:
+	.string	"SETTING_MC_P_ROLL 164"
+.LASF725:
+	.string	"_T_PTRDIFF "
+.LASF2741:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF2969:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1887:
+	.string	"SETTING_STATS_TOTAL_DIST 366"
+.LASF2102:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF2841:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF3170:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF572:
+	.string	"_SIZE_T_ "
+.LASF2419:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1554:
+	.string	"SETTING_INAV_W_Z_GPS_P 255"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF810:
+	.string	"SETTING_MORON_THRESHOLD 7"
+.LASF3091:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2926:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1739:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MAX 20"
+.LASF2056:
+	.string	"USE_VTX_TRAMP "
+.LASF1868:
+	.string	"SETTING_MAVLINK_EXTRA2_RATE_MAX 255"
+.LASF3467:
+	.string	"OWNER_PWMIO"
+.LASF3599:
+	.string	"BOXOSDALT2"
+.LASF3179:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1847:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_LOW_MAX 900"
+.LASF3378:
+	.string	"table_alignment"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF943:
+	.string	"SETTING_RSSI_CHANNEL_MIN 0"
+.LASF1666:
+	.string	"SETTING_NAV_RTH_HOME_OFFSET_DIRECTION_MIN 0"
+.LASF2950:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1501:
+	.string	"SETTING_MC_CD_LPF_HZ_MIN 0"
+.LASF461:
+	.string	"__PMT"
+.LASF1716:
+	.string	"SETTING_NAV_FW_BANK_ANGLE 309"
+.LASF2122:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF3601:
+	.string	"BOXNAVCRUISE"
+.LASF759:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1182:
+	.string	"SETTING_MANUAL_PITCH_RATE 131"
+.LASF1547:
+	.string	"SETTING_INAV_W_XY_FLOW_P_MAX 100"
+.LASF2398:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1272:
+	.string	"SETTING_MC_I_PITCH 161"
+.LASF1600:
+	.string	"SETTING_NAV_WP_RADIUS_MIN 10"
+.LASF3522:
+	.string	"RESOURCE_ADC_CH4"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF3279:
+	.string	"VTX_SETTINGS_DEFAULT_PITMODE_CHANNEL 1"
+.LASF3657:
+	.string	"settingGetValuePointer"
+.LASF3490:
+	.string	"OWNER_LED"
+.LASF2469:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2389:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF2066:
+	.string	"USE_FAKE_BARO "
+.LASF805:
+	.string	"SETTING_GYRO_LPF_HZ_MIN 0"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF808:
+	.string	"SETTING_GYRO_LPF_TYPE_MIN 0"
+.LASF2548:
+	.string	"__f32x(x) x ##f32x"
+.LASF2685:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF2747:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF3342:
+	.string	"TABLE_DEBUG_MODES"
+.LASF938:
+	.string	"SETTING_MAX_CHECK_MAX 2000"
+.LASF2925:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF3277:
+	.string	"VTX_SETTINGS_DEFAULT_BAND 4"
+.LASF3510:
+	.string	"RESOURCE_UART_RX"
+.LASF3551:
+	.string	"PID_YAW"
+.LASF569:
+	.string	"_T_SIZE_ "
+.LASF2300:
+	.string	"__DECL_SIMD_expf64 "
+.LASF3081:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF3231:
+	.string	"TELEMETRY_SHAREABLE_PORT_FUNCTIONS_MASK (FUNCTION_TELEMETRY_FRSKY | FUNCTION_TELEMETRY_LTM | FUNCTION_TELEMETRY_IBUS)"
+.LASF1932:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1804:
+	.string	"SETTING_FRSKY_UNIT_MIN 0"
+.LASF2255:
+	.string	"__DECL_SIMD_cos "
+.LASF797:
+	.string	"SETTING_PID_PROCESS_DENOM_MAX 8"
+.LASF538:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF3653:
+	.string	"settingLookupTable"
+.LASF1518:
+	.string	"SETTING_INAV_AUTO_MAG_DECL 243"
+.LASF1764:
+	.string	"SETTING_NAV_FW_LAUNCH_MIN_TIME 325"
+.LASF1936:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2500:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF2371:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF896:
+	.string	"SETTING_MAGZERO_Y_MAX 32767"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF536:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1850:
+	.string	"SETTING_ACC_EVENT_THRESHOLD_NEG_X_MAX 65535"
+.LASF3637:
+	.string	"strstr"
+.LASF3615:
+	.string	"LOG_TOPIC_IMU"
+.LASF1909:
+	.string	"SETTING_VTX_POWER_MIN 1"
+.LASF1216:
+	.string	"SETTING_FIXED_WING_AUTO_ARM_MIN 0"
+.LASF1619:
+	.string	"SETTING_NAV_LANDING_SPEED_MAX 2000"
+.LASF2895:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1243:
+	.string	"SETTING_GPS_UBLOX_USE_GALILEO_MIN 0"
+.LASF654:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1291:
+	.string	"SETTING_MC_CD_ROLL_MIN 0"
+.LASF2060:
+	.string	"USE_CLI_BATCH "
+.LASF852:
+	.string	"SETTING_ACC_LPF_TYPE 21"
+.LASF1450:
+	.string	"SETTING_NAV_FW_POS_XY_I_MIN 0"
+.LASF733:
+	.string	"__need_ptrdiff_t"
+.LASF1940:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF2523:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1192:
+	.string	"SETTING_REBOOT_CHARACTER_MIN 48"
+.LASF1143:
+	.string	"SETTING_THR_MID 118"
+.LASF1457:
+	.string	"SETTING_NAV_FW_HEADING_P_MAX 255"
+.LASF2435:
+	.string	"__DECL_SIMD_log2 "
+.LASF1856:
+	.string	"SETTING_MAVLINK_EXT_STATUS_RATE_MAX 255"
+.LASF1301:
+	.string	"SETTING_MC_D_YAW_MAX 200"
+.LASF443:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1028:
+	.string	"SETTING_FAILSAFE_THROTTLE_LOW_DELAY_MAX 300"
+.LASF1150:
+	.string	"SETTING_TPA_RATE_MIN 0"
+.LASF2176:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF589:
+	.string	"_STRINGS_H 1"
+.LASF2997:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF522:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1639:
+	.string	"SETTING_NAV_RTH_CLIMB_IGNORE_EMERG_MIN 0"
+.LASF2989:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2816:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF3132:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2794:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF761:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF2226:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1099:
+	.string	"SETTING_BATTERY_CAPACITY_UNIT_MIN 0"
+.LASF3509:
+	.string	"RESOURCE_UART_TX"
+.LASF1405:
+	.string	"SETTING_NAV_MC_POS_Z_P_MIN 0"
+.LASF2477:
+	.string	"__DECL_SIMD_erfl "
+.LASF2912:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2425:
+	.string	"__DECL_SIMD_log10 "
+.LASF2448:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF504:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF2699:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF1073:
+	.string	"SETTING_CURRENT_METER_TYPE_MAX 0"
+.LASF429:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF611:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2789:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1700:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE_MAX 60"
+.LASF1548:
+	.string	"SETTING_INAV_W_XY_FLOW_V 253"
+.LASF1428:
+	.string	"SETTING_NAV_MC_VEL_XY_FF 213"
+.LASF729:
+	.string	"___int_ptrdiff_t_h "
+.LASF3184:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF472:
+	.string	"__PMT(args) args"
+.LASF3603:
+	.string	"BOXUSER1"
+.LASF3604:
+	.string	"BOXUSER2"
+.LASF3561:
+	.string	"ADC_BATTERY"
+.LASF2368:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF694:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF3303:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2010:
+	.string	"USE_PITOT_MS4525 "
+.LASF1239:
+	.string	"SETTING_GPS_AUTO_BAUD 150"
+.LASF2158:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1065:
+	.string	"SETTING_CURRENT_METER_SCALE 92"
+.LASF3053:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF771:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1201:
+	.string	"SETTING_IMU_DCM_KP_MAG_MIN 0"
+.LASF3284:
+	.string	"VTX_SETTINGS_DEFAULT_POWER 1"
+.LASF2657:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1776:
+	.string	"SETTING_NAV_FW_CRUISE_YAW_RATE 329"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2973:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF3678:
+	.string	"cmdline"
+.LASF2562:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1878:
+	.string	"SETTING_MODE_RANGE_LOGIC_OPERATOR 363"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF2247:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1042:
+	.string	"SETTING_FAILSAFE_FW_YAW_RATE_MIN -1000"
+.LASF3537:
+	.string	"AUX1"
+.LASF3538:
+	.string	"AUX2"
+.LASF3539:
+	.string	"AUX3"
+.LASF3540:
+	.string	"AUX4"
+.LASF3541:
+	.string	"AUX5"
+.LASF3542:
+	.string	"AUX6"
+.LASF3543:
+	.string	"AUX7"
+.LASF3544:
+	.string	"AUX8"
+.LASF3545:
+	.string	"AUX9"
+.LASF2366:
+	.string	"__DECL_SIMD_exp10f "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF1826:
+	.string	"SETTING_IBUS_TELEMETRY_TYPE_MAX 255"
+.LASF635:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"80b64cf\""
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2409:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF3591:
+	.string	"BOXFLAPERON"
+.LASF1036:
+	.string	"SETTING_FAILSAFE_FW_ROLL_ANGLE_MIN -800"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF1468:
+	.string	"SETTING_NAV_FW_POS_HDG_PIDSUM_LIMIT_MIN 100"
+.LASF2106:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1368:
+	.string	"SETTING_YAW_LPF_HZ 193"
+.LASF3661:
+	.string	"settingsValidate"
+.LASF1533:
+	.string	"SETTING_INAV_RESET_HOME 248"
+.LASF3252:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF681:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF3565:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF2954:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF2436:
+	.string	"__DECL_SIMD_log2f "
+.LASF1482:
+	.string	"SETTING_D_BOOST_MAX_AT_ACCELERATION 231"
+.LASF2212:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1476:
+	.string	"SETTING_MC_ITERM_RELAX_CUTOFF 229"
+.LASF2608:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF3617:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF2123:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF926:
+	.string	"SETTING_PITOT_LPF_MILLI_HZ_MAX 10000"
+.LASF501:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF2693:
+	.string	"DYNAMIC_NOTCH_DEFAULT_CENTER_HZ 350"
+.LASF1834:
+	.string	"SETTING_SIM_PIN_MIN 0"
+.LASF2175:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF3024:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF452:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1973:
+	.string	"USE_I2C_PULLUP "
+.LASF2866:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1414:
+	.string	"SETTING_NAV_MC_VEL_Z_D_MIN 0"
+.LASF2266:
+	.string	"__DECL_SIMD_sinf "
+.LASF794:
+	.string	"SETTING_GYRO_SYNC_MAX 0"
+.LASF1314:
+	.string	"SETTING_FW_P_PITCH 175"
+.LASF2208:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1427:
+	.string	"SETTING_NAV_MC_VEL_XY_D_MAX 255"
+.LASF1022:
+	.string	"SETTING_FAILSAFE_OFF_DELAY_MAX 200"
+.LASF3493:
+	.string	"OWNER_RX_SPI"
+.LASF1396:
+	.string	"SETTING_RATE_ACCEL_LIMIT_ROLL_PITCH_MIN 0"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2658:
+	.string	"DMA_NONE (0)"
+.LASF869:
+	.string	"SETTING_ACCGAIN_Y_MAX 8192"
+.LASF1908:
+	.string	"SETTING_VTX_POWER 373"
+.LASF1139:
+	.string	"SETTING_FLAPERON_THROW_OFFSET_MAX 450"
+.LASF3483:
+	.string	"OWNER_USB"
+.LASF1299:
+	.string	"SETTING_MC_D_YAW 170"
+.LASF1466:
+	.string	"SETTING_NAV_FW_POS_HDG_D_MAX 255"
+.LASF3486:
+	.string	"OWNER_BARO"
+.LASF1432:
+	.string	"SETTING_NAV_MC_HEADING_P_MIN 0"
+.LASF1066:
+	.string	"SETTING_CURRENT_METER_SCALE_MIN -10000"
+.LASF732:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF902:
+	.string	"SETTING_MAG_CALIBRATION_TIME_MAX 120"
+.LASF928:
+	.string	"SETTING_PITOT_SCALE_MIN 0"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF738:
+	.string	"_T_WCHAR "
+.LASF2478:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2229:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF977:
+	.string	"SETTING_BLACKBOX_RATE_NUM_MAX 65535"
+.LASF582:
+	.string	"__size_t "
+.LASF637:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2540:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF947:
+	.string	"SETTING_RSSI_MIN_MAX 100"
+.LASF2273:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF464:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF3482:
+	.string	"OWNER_FLASH"
+.LASF3400:
+	.string	"table_motor_pwm_protocol"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1083:
+	.string	"SETTING_RTH_ENERGY_MARGIN 98"
+.LASF1158:
+	.string	"SETTING_RC_EXPO 123"
+.LASF1303:
+	.string	"SETTING_MC_CD_YAW_MIN 0"
+.LASF1698:
+	.string	"SETTING_NAV_MC_BRAKING_BANK_ANGLE 303"
+.LASF1606:
+	.string	"SETTING_NAV_AUTO_SPEED_MIN 10"
+.LASF1270:
+	.string	"SETTING_MC_P_PITCH_MIN 0"
+.LASF3445:
+	.string	"MODE_LOOKUP"
+.LASF2648:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1933:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1519:
+	.string	"SETTING_INAV_AUTO_MAG_DECL_MIN 0"
+.LASF2972:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1433:
+	.string	"SETTING_NAV_MC_HEADING_P_MAX 255"
+.LASF1171:
+	.string	"SETTING_YAW_RATE_MIN 2"
+.LASF2928:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2079:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF3255:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1226:
+	.string	"SETTING_APPLIED_DEFAULTS_MAX 3"
+.LASF3650:
+	.string	"_left0"
+.LASF868:
+	.string	"SETTING_ACCGAIN_Y_MIN 1"
+.LASF1422:
+	.string	"SETTING_NAV_MC_VEL_XY_I 211"
+.LASF1266:
+	.string	"SETTING_MC_AIRMODE_THRESHOLD 159"
+.LASF1785:
+	.string	"SETTING_NAV_FW_YAW_DEADBAND 332"
+.LASF3533:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF3192:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF806:
+	.string	"SETTING_GYRO_LPF_HZ_MAX 200"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2437:
+	.string	"__DECL_SIMD_log2l "
+.LASF2882:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF3358:
+	.string	"TABLE_NAV_RTH_ALLOW_LANDING"
+.LASF3263:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1431:
+	.string	"SETTING_NAV_MC_HEADING_P 214"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF433:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF508:
+	.string	"__always_inline"
+.LASF3008:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF3670:
+	.string	"length"
+.LASF2631:
+	.string	"MATH_ERRNO 1"
+.LASF2235:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1674:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY 295"
+.LASF1678:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MIN 0"
+.LASF2322:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF3023:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1312:
+	.string	"SETTING_MC_D_LEVEL_MIN 0"
+.LASF2786:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF3250:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF657:
+	.string	"__intptr_t_defined "
+.LASF2242:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF3185:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF1924:
+	.string	"SETTING_LOG_TOPICS_MIN 0"
+.LASF554:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2350:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1389:
+	.string	"SETTING_PIDSUM_LIMIT_YAW 200"
+.LASF2433:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2163:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2471:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF3103:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1294:
+	.string	"SETTING_MC_P_YAW_MIN 0"
+.LASF2451:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1071:
+	.string	"SETTING_CURRENT_METER_TYPE 94"
+.LASF1746:
+	.string	"SETTING_NAV_FW_LAUNCH_MAX_ANGLE 319"
+.LASF1211:
+	.string	"SETTING_IMU_ACC_IGNORE_RATE_MAX 20"
+.LASF1261:
+	.string	"SETTING_3D_DEADBAND_THROTTLE_MIN 0"
+.LASF1738:
+	.string	"SETTING_NAV_FW_LAND_DIVE_ANGLE_MIN -20"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2064:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1681:
+	.string	"SETTING_NAV_MC_BRAKING_DISENGAGE_SPEED_MIN 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1679:
+	.string	"SETTING_NAV_MC_BRAKING_SPEED_THRESHOLD_MAX 1000"
+.LASF1235:
+	.string	"SETTING_GPS_DYN_MODEL_MAX 0"
+.LASF591:
+	.string	"_BITS_TYPES_H 1"
+.LASF645:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3241:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2094:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF3356:
+	.string	"TABLE_MOTOR_PWM_PROTOCOL"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1676:
+	.string	"SETTING_NAV_MC_AUTO_DISARM_DELAY_MAX 10000"
+.LASF551:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2203:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF956:
+	.string	"SETTING_RC_FILTER_FREQUENCY_MAX 100"
+.LASF856:
+	.string	"SETTING_ACCZERO_X_MIN -32768"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1953:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1626:
+	.string	"SETTING_NAV_EMERG_LANDING_SPEED 279"
+.LASF1806:
+	.string	"SETTING_FRSKY_VFAS_PRECISION 339"
+.LASF3314:
+	.string	"unsigned int"
+.LASF3118:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1534:
+	.string	"SETTING_INAV_RESET_HOME_MIN 0"
+.LASF714:
+	.string	"UINT16_C(c) c"
+.LASF1296:
+	.string	"SETTING_MC_I_YAW 169"
+.LASF3254:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF2878:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2575:
+	.string	"_Mdouble_ double"
+.LASF3108:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF3100:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2804:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1780:
+	.string	"SETTING_NAV_FW_ALLOW_MANUAL_THR_INCREASE_MIN 0"
+.LASF2154:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2144:
+	.string	"RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)"
+.LASF1881:
+	.string	"SETTING_STATS 364"
+.LASF1424:
+	.string	"SETTING_NAV_MC_VEL_XY_I_MAX 255"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF3823:
+	.string	"rx_pwm.h"
+.LASF3736:
+	.string	"string.h"
+.LASF3774:
+	.string	"libm-simd-decl-stubs.h"
+.LASF3718:
+	.string	"/usr/include"
+.LASF3780:
+	.string	"mathcalls-helper-functions.h"
+.LASF3776:
+	.string	"floatn-common.h"
+.LASF3753:
+	.string	"stdint.h"
+.LASF3763:
+	.string	"platform.h"
+.LASF3696:
+	.string	"src/main/build"
+.LASF3715:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF3796:
+	.string	"barometer.h"
+.LASF3758:
+	.string	"stdbool.h"
+.LASF3762:
+	.string	"time.h"
+.LASF3744:
+	.string	"wordsize.h"
+.LASF3789:
+	.string	"dynamic_gyro_notch.h"
+.LASF3784:
+	.string	"bus.h"
+.LASF3817:
+	.string	"navigation.h"
+.LASF3710:
+	.string	"src/main/target/SITL"
+.LASF3781:
+	.string	"mathcalls.h"
+.LASF3800:
+	.string	"spektrum.h"
+.LASF3767:
+	.string	"common_post.h"
+.LASF3822:
+	.string	"sim.h"
+.LASF3827:
+	.string	"vtx_control.h"
+.LASF3797:
+	.string	"pitotmeter.h"
+.LASF3741:
+	.string	"libc-header-start.h"
+.LASF3761:
+	.string	"rpm_filter.h"
+.LASF3738:
+	.string	"settings.c"
+.LASF3731:
+	.string	"adc.h"
+.LASF3719:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF3700:
+	.string	"src/main/drivers/barometer"
+.LASF3802:
+	.string	"blackbox_fielddefs.h"
+.LASF3801:
+	.string	"blackbox.h"
+.LASF3728:
+	.string	"resource.h"
+.LASF3771:
+	.string	"vector.h"
+.LASF3726:
+	.string	"settings.h"
+.LASF3805:
+	.string	"boardalignment.h"
+.LASF3705:
+	.string	"src/main/flight"
+.LASF3814:
+	.string	"imu.h"
+.LASF3740:
+	.string	"stdc-predef.h"
+.LASF3792:
+	.string	"accgyro.h"
+.LASF3737:
+	.string	"string_light.h"
+.LASF3772:
+	.string	"math.h"
+.LASF3714:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF3790:
+	.string	"filter.h"
+.LASF3815:
+	.string	"quaternion.h"
+.LASF3742:
+	.string	"features.h"
+.LASF3713:
+	.string	"src/main"
+.LASF3706:
+	.string	"src/main/io"
+.LASF3701:
+	.string	"src/main/drivers/compass"
+.LASF3698:
+	.string	"src/main/config"
+.LASF3743:
+	.string	"features-time64.h"
+.LASF3778:
+	.string	"fp-logb.h"
+.LASF3795:
+	.string	"compass.h"
+.LASF3699:
+	.string	"src/main/drivers/accgyro"
+.LASF3821:
+	.string	"frsky_d.h"
+.LASF3816:
+	.string	"runtime_config.h"
+.LASF3735:
+	.string	"config.h"
+.LASF3748:
+	.string	"stubs.h"
+.LASF3769:
+	.string	"gyro.h"
+.LASF3755:
+	.string	"time64.h"
+.LASF3733:
+	.string	"log.h"
+.LASF3734:
+	.string	"settings_generated.c"
+.LASF3812:
+	.string	"io_def.h"
+.LASF3724:
+	.string	"settings_generated.h"
+.LASF3765:
+	.string	"target.h"
+.LASF3694:
+	.string	"obj/main/SITL"
+.LASF3770:
+	.string	"maths.h"
+.LASF3768:
+	.string	"parameter_group_ids.h"
+.LASF3756:
+	.string	"wchar.h"
+.LASF3745:
+	.string	"timesize.h"
+.LASF3697:
+	.string	"src/main/common"
+.LASF0:
+	.string	"./src/main/fc/settings.c"
+.LASF3799:
+	.string	"rx.h"
+.LASF3717:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF3786:
+	.string	"rcc_types.h"
+.LASF3824:
+	.string	"stats.h"
+.LASF3819:
+	.string	"gps.h"
+.LASF3808:
+	.string	"logic_condition.h"
+.LASF3791:
+	.string	"acceleration.h"
+.LASF3720:
+	.string	"stddef.h"
+.LASF3779:
+	.string	"fp-fast.h"
+.LASF3760:
+	.string	"general_settings.h"
+.LASF3704:
+	.string	"src/main/fc"
+.LASF3775:
+	.string	"floatn.h"
+.LASF3785:
+	.string	"bus_i2c.h"
+.LASF3764:
+	.string	"common.h"
+.LASF3798:
+	.string	"calibration.h"
+.LASF3749:
+	.string	"stubs-64.h"
+.LASF3811:
+	.string	"io.h"
+.LASF3725:
+	.string	"parameter_group.h"
+.LASF3809:
+	.string	"controlrate_profile.h"
+.LASF3730:
+	.string	"pid.h"
+.LASF3813:
+	.string	"io_def_generated.h"
+.LASF3818:
+	.string	"feature.h"
+.LASF3828:
+	.string	"vtx_common.h"
+.LASF3702:
+	.string	"src/main/drivers/opflow"
+.LASF3803:
+	.string	"mixer.h"
+.LASF3793:
+	.string	"exti.h"
+.LASF3729:
+	.string	"sensors.h"
+.LASF3826:
+	.string	"display.h"
+.LASF3773:
+	.string	"math-vector.h"
+.LASF3820:
+	.string	"telemetry.h"
+.LASF3732:
+	.string	"rc_modes.h"
+.LASF3723:
+	.string	"stdint-uintn.h"
+.LASF3707:
+	.string	"src/main/navigation"
+.LASF3747:
+	.string	"long-double.h"
+.LASF3739:
+	.string	"rc_controls.h"
+.LASF3806:
+	.string	"battery.h"
+.LASF3746:
+	.string	"cdefs.h"
+.LASF3777:
+	.string	"flt-eval-method.h"
+.LASF3708:
+	.string	"src/main/rx"
+.LASF3754:
+	.string	"typesizes.h"
+.LASF3695:
+	.string	"src/main/blackbox"
+.LASF3829:
+	.string	"vtx.h"
+.LASF3782:
+	.string	"sensor.h"
+.LASF3766:
+	.string	"sanity_check.h"
+.LASF3750:
+	.string	"locale_t.h"
+.LASF3711:
+	.string	"src/main/target"
+.LASF3727:
+	.string	"axis.h"
+.LASF3752:
+	.string	"strings.h"
+.LASF3804:
+	.string	"failsafe.h"
+.LASF3703:
+	.string	"src/main/drivers"
+.LASF3810:
+	.string	"serial.h"
+.LASF3825:
+	.string	"bitarray.h"
+.LASF3757:
+	.string	"utils.h"
+.LASF3759:
+	.string	"build_config.h"
+.LASF3788:
+	.string	"dma.h"
+.LASF3709:
+	.string	"src/main/sensors"
+.LASF3722:
+	.string	"stdint-intn.h"
+.LASF3807:
+	.string	"servos.h"
+.LASF3751:
+	.string	"__locale_t.h"
+.LASF3721:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF3794:
+	.string	"opflow.h"
+.LASF3712:
+	.string	"src/main/telemetry"
+.LASF3787:
+	.string	"bus_spi.h"
+.LASF3783:
+	.string	"io_types.h"
+.LASF3716:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\006\002]\024"
+	.string	"\344#\372\002"
+	.string	"P"
+	.string	"\227\326\313\372\t\f\002"
+	.string	"\001\002\001\305\261\264\230\013\002\231\350\262\236\b\003\361\236\211\341\007\002\002\003\002\003\004\260\276\311\b\004\002\004\002\005\002\006\002\007\005\302\346\240\373\001\006\321\210\254\266\005\007\366\261\322\300\f\b\231\347\312:\n\002\004\002\b\t\244\220\244\324\r\b\002\t\n\002\013\002\n\002\f\002\f\n\324\277\350\320\f\013\247\217\251\272\t\f\324\314\376\364\f\r\002\r\r\346\342\207\375\006"
+	.string	"\016\366\256\255\240\003"
+	.string	"\017\214\331\236\375\007\002\020\231\323\320\213\006"
+	.string	"\021\337\333\323\341\005"
+	.string	"\022\264\361\225\227\003"
+	.ascii	"\023\362\227\315\333\n\016\002\006\002\017\024\323\314\275\215"
+	.ascii	"\b\025\274\304\372\353\007\026\200\341\244\365\r\002\002\020"
+	.ascii	"\002\021\027\242\272\311\350\005\030\300\311\377\263\b\006\022"
+	.ascii	"\002\023\031\363\372\337\315\n\032\200\355\207\255\007\n\004"
+	.ascii	"\002\024\033\321\265\375\374\002\026\022\002\023\002\025\002"
+	.ascii	"\025\002\026\002\026\002\027\030\002\030\002\031\002\031\002"
+	.ascii	"\032\002\032\002\022\002\022\034\275\274\275\345\t\002\035\324"
+	.ascii	"\203\313\314\f\002\036\222\277\230\265\013\004\037\274\200\344"
+	.ascii	"\375 \270\342\217\357\007!\264\342\235\366\b\"\306\220\362\350"
+	.ascii	"\001#$\336\327\255\323\017\n\004\002\016"
+	.string	"%\221\211\303\366\t&\374\302\274\254\017'\330\264\373\207\t(\332\373\240\271\013)\233\311\255\214\b*\207\260\277\333\017+\260\325\317\n,\245\215\243\372\b-\207\357\344\303\013.\371\270\213\276\f/\366\220\215\360\f0\356\330\300\231\0131\223\256\266\337\n2\302\223\266\246\0033\272\342\344\306\0064\217\223\354\0335\204\225\341\331\t6\376\322\360\376\0137\340\270\334\231\0138\216\260\354\310\0049\342\335\275\264\003:\361\300\304\262\b;\223\373\237\244\t<\253\206\371\360\002=\245\301\335\306\004>\210\321\277\215\002?\372\263\333\372\007@\334\274\326\212\006A\331\273\323\345\017B\376\367\260\205\006C\375\245\366\205\nD\300\256\375\375\007E\246\355\345\274\004F\205\310\256\377\007G\276\235\377\317\tH\225\345\311\263\007I\245\345\314\226\fJ\256\363\205\264\nK\310\254\307\351\004L\201\331\216\264\bM\360\312\323\232\bN\225\254\310\321\004O\242\355\211\326\007"
+	.ascii	"  @\002\205\320\361\013\215\237\003s\254\345\366^+N\312\344\026"
+	.ascii	"\344C3\220\031;\f\273\320T\376~1Dd`k)\005 \356\031\271~\337\332"
+	.ascii	"\001s\261\355v\270\254\023,\264\0056\203\240a\332\353\202\031"
+	.ascii	"\315\022\342{\223A\305\035\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\323\001\275\b"
+	.string	"r\n\036#\220'I\007\377\377\377WA0333\343\215\217\217\217~#c-\364m\263\3266\333\bi\315n)e\n\367\277\r\f\351\271uA!!a\211p\260Z\r\222\206A\272\002\202\201\2239\201"
+	.string	"\200\336@l\0274\264;F_-\322+\017\371\345\360\214\255\342W\n\357\022=\266lG\"\3031\361\026*6\334\020E\206\034B\212\263\362\377r\326\"/\263\270\376\376\2667\363!N\250\201Ae\244\321\306\032`\002\021cG\017\021\200!FTD\013\352\334\r\255|\363q\254\034\323d\004\306K$\234`\373\213\240+t\313\034\r"
+	.string	"R\207\222\316\325\340\231\r-\211\007\274\024\3004Z\353\242\007\276\261\177\203\261\374l\032\340\"\222\267\302\211S\031~\005D\311-o\250\020\310(S\216\022\265?3X=\317\2575\375\300\357\315\373\307\263\300Sq\231s)\350\310\021\274\373*\356\367G>3o\256\376\341,z\"\221K\345\317\252F\262f%\345\257G\034zKB\033"
+	.ascii	"X\2722"
+	.text
+	.section	.gnu.lto_.inline.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\031\n\025#"
+	.string	"&\357\240J\260VU:%1|\275!\210\232q\266\330R \266\020\366\020$g\260\331\202\323\332\312\022\236\022\341\321\307U\370\0303\360lc\234\027\2706L\341_\247\037f'\366~f\002PY\031\232t\305\263\365\207\307\373\246}\362\367\2262\005~"
+	.string	"\207"
+	.string	"\223"
+	.ascii	">\330k\3633\315?m^\246\231\207ly\310d\016\317\306\333\3261m\236"
+	.ascii	"g\243\355\237\217\347\235\376\025\235\2065\267\225\257\324\377"
+	.ascii	"\335l\365\317\274&q\357\2059\275\255\344\237[\363\317\275\362"
+	.ascii	"\351s\315\323BVX \2215\247i\356>K\350\244\245\033D\260\317\237"
+	.ascii	"\366\264\212 M]\030\274\236\276\337\272\276\367\336\361\267p"
+	.ascii	"\357\005\372\351\377Y3\377\tx\326=\356sO\267\b\322\324"
+	.string	"\345\300?s\226+\374\333\312>\377\273\376-\005\221T?oR\271\021\345\247\240o\203\004\214\02588\255\333Jn\361\232)\2050C\354\246X\007\367\231gv\200\262\004G\354,\362\364\326:\222\236\312\326u\222\221\017\033Z\304{o\352]\3378\036\377\333\344\314\313\344L\004\334`\264\355\363y\336M\250&PB\327_\376J\332\237\325\224\322\372Zk%O\222|O\222\244\275\275\321\267\345\373\266\020f\210\242\023\221_\373\256\233\356\275\262w\355\215\343B\206L<\005\213I*\304\232\371\301\030\353\336\373\263\2479\020s\270\370\321en\364\264V\004<\"\254\005\207\305j_\253}W\222\\-`\036DN\231@\202E\304\353\004p\235\353\0268\244\024\231oJ\276\351m\016-\001\253\360T\261\212H\354\351\264\006*\"d\254>@\366\272\200\240\351\013b*\212\001\021\304T\004;\fm>\307\376\323\t\305\264\321f\327\027"
+	.string	"l\204\235d]\323)\304\201\261n\326\233f\336\364\335\013\024\340\257\326\274\255\274kg\262\356r\321\377_u\255!\312\t\224\227[\372\bS\311\f$%rM\344\304oH\022\032O>b\252\254\371\007\313\272\327\016FY\367\230f\031\021\324\"\273\201\227=<\254X\275"
+	.ascii	"\035\n\361\002\b\3537lt\324DB5\256\254nC=\200\210\372\260\272"
+	.ascii	"\245\\u&\n\fL.\260^c\237Dm\321\222zSK\204\304\345\307H\243S\200"
+	.ascii	";\200\253\323\260\255\234}\245{/\371Y\355\366}\343\330gt\304"
+	.ascii	"\266'\214?)\037\312F\223g#\254)\\Ut\2021\"\366\231V\242\021C"
+	.ascii	")7\233\002\200\345\250!=\246\020M\311H\212\222Bkp\002\021\032"
+	.ascii	"\"2\017\022`E%\tj\246\f\215\214\214\026\225"
+	.string	"\024\324\2530\006\266Hq\020`\206\204\224\276\301\r\324\177\361b\200\246nGE\363\212\302\357W\342\266\310i\206\343x\b5`\311\3707\262\244S\303\371\353\017\334HX\3364\005r\\\303lu\262\027c\356\214\214\200\311\020\3368\201\003c\354\\\037\247\245\223\310Q\300|\003\304\021W(\025\030\361\260+sx\233\2734GD\352\037j\353\205\350mn\235|\275\232N!d\327$\017\261b\335\007!z\263\301\322\033\001j\261?\313c8we\374\265\364\312\026L\211E\217Yba\360\221\204\032\210\311\233\216\240\217\342bL\261 \370t\177\374C\033\364\266X0\250l\006\261{\216\347\026\323\3767\345\261t\2111\n\237\231B;\016\337\365\306\334\17720x\221\373\225\254\320\005\2730v\361\250\217\225~C\352\317E\255$Y\203yUx\300\253\225\266C\315\376LJQ\034[\211G\276Z\202);3<\254)\230'"
+	.ascii	"\255\241\206\331\200\244\031+\313\367\337\252\017\321\265\225"
+	.ascii	"?[\266e6T\345\226\364\203\275\037\362\342\236\302\223~Y\323\235"
+	.ascii	"\310\231GTg\336\031M\032\3541H\315C\027\372f\026\353\213~7\314"
+	.ascii	"t\036\363\316D\0317\224\327Z\277e\213\t\272\020\230\243\313t"
+	.ascii	"\352\244\230\263\234V\212\306\2223\220\207:s\342c\3006\265]\214"
+	.ascii	"\233\230\006\357}G\221\2027\3759\2001\273\341%O\211!&`\346\311"
+	.ascii	"s3\003G]*\2275\214T\207\2557\360\004\342\245x\227\241\032D\230"
+	.ascii	"\235 \275j\365\302\273e\336k@\202\267\024\376\322\"A\200\n\342"
+	.ascii	"[b\206\247d\264\345*{\272(\243\342TM\327\004"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`?\004\035\r"
+	.string	"\226\0213/`E\223t\022,\001*!\2003\022I\222$IV\344\007\210\242(FF\203\003i\210@\3777l\263G\353\267>BU\361\2324Ad\313$\003$"
+	.string	"#"
+	.string	"%"
+	.ascii	"\344\225\207\222\323ZK\360E\\g1\003\244~#\fG\230\311FzN\317z"
+	.ascii	"\226\337\f\322\273\327|\371\240\300D\225\273\255\365\230\277"
+	.ascii	"\270\243\373\222\376\222\372\005\214\247\247\312\001\222\252"
+	.ascii	"\264W\344\025\251\277\246$NI\375\365\207\002\215\247g\237\300"
+	.ascii	"\027\325\335\351Y+\201\320\001\234\231\265\265\341\235*"
+	.string	"Q}\001\377\350`\304C\310\372\255\352\021\006\266\002t\364\034\275I\317\0021\371\257H\236\007>3\276N\244Y+\223\006po\222\243Z\n\210\375\243\341\320\300\340 U\333_PP\001[\250aQ\207(\3100\261\f\333\001P\002!\245\312n\003\022\200\204(\001\304s\b%\005HJ\"A\205\213\222i\317\200\233l/\364\233,j'\031PVM\027\242zu\003\361\375\330\253-\376\323C\344h\027u\301Q\f\021\322O\331\\\212\321*q\337\216\3634\033\221\004\r^x\376\360\254\34687\b\334\355\243M\304p>\342\310\r\351\n\270\2668\272\370\324\035]\320\377\3346`\034\335n\006\203\303\224\224X\204\0315\312\301S\200\256\022M\357\255\304\300\333\215t\220N\220\007\240\221\036ZtY\200\222\310\315\313\360\376\207\\\210\337\200\323\216\023\"\250.t\230\214b tJ\0011\244Q\013u\265H\203J\252\255\177F\005"
+	.ascii	"\262\255!\220'\225.\243\372LUuz"
+	.text
+	.section	.gnu.lto_.pureconst.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 W\235\002"
+	.string	"r\305\023\037\220G\215\001\3779K\242\021\206ffl33\365\307\307\307\217\013Z\301\330\232\221e\203u\207\f/b<\254\006\253\260\202p\fF\301\033\030\331\013\030\257\261Z\251u\272I\267\350\006\235\317\351\234\315\311\274\313\013eLV\344|5\336cw\227\b"
+	.text
+	.section	.gnu.lto_.ipa_modref.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\342\001\345\013"
+	.string	"\026\320:6P\215\322\030@6\315\203\224\"\222\261\005\367\347v\335\364\256\344FH)\265O\263\252\326\251%X\313yP\371}\243\177\212\361e\267\f"
+	.string	"\331D\260\210[\326\310\2262\005'"
+	.string	"1"
+	.string	"-"
+	.string	"\363\263\001\020>\327!\344\254\257fA\n7P\244\310I&M\242\275\326_\352m \347\366u\375\267=m\277\214\371E\005\362$OW\001\\a\225V\2559*]h$\253\326\f\001a\375os\004\007)\031\251d\236^9\020"
+	.string	"u\245v \343\243\002\233\3257\013!\306\304nr!\256\251\030\017\222\206{\370\325\341c\314\254\3764\275`\r\273\3062\225a\201\263:\205B\002\302;LUL\344\207\024\251\201\216\264\344({:\236w\354D\216P\347\035;B\026\226\1771l+~\332\333\234F%>b3\253\312\244I\343\252\262\225*\223\363Wy\005? P\002\"\224\350\016\343\004\342YH\332\305s\311\2233X\376"
+	.ascii	"\347\260^\304\037\033v\320\bb\341\361\t\226\026\212Q\365\027"
+	.ascii	"\206B\274F\033`\213\305;[[\310GH\006\212[\005d\205\205$\250\221"
+	.ascii	"\326\031\2163\2315\bF\211\004\320\020\343\360\"\323\337\247\207"
+	.ascii	"\372Qf\316\nk\300\204\030\352\315\357%\311\005\202Eg\025@\006"
+	.ascii	"\365\021\341\2517\244m\206\344\035\332\360\2144\022X\266\274"
+	.ascii	"\331r\025r\261\322r$\034\305`\016\311\026\316m\033J\021"
+	.text
+	.section	.gnu.lto_.lto.d64b4e6a8ee3f75,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_settingsPgn.137.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`K\001\355\b"
+	.string	"2\31778\020\227Z\003g\021\316\342\353\177\262\376\0025`\005X\001V\200\225\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\315"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\300G\253F\271x\316\2107\274\006\232\240?\314R\356&2\311\362"
+	.ascii	"\217A\016Y\344\221I.\331\344\223QNY\345\225Yn\331\345\227a\216"
+	.ascii	"Y\346\231i\256\331\346\233q\316Y\347\235y\356\331\347\237\201"
+	.ascii	"\016Z\350\241i\023]\264\321G#\235\264\322\265m\337\306\2754\323"
+	.ascii	"M;\235[g\361\323\273y\367\206:j\251}O\375\233\352\252\255f_U"
+	.ascii	"h\200\264\r\017\216\fq\362X\023\240\304\327\326\350\253\206\024"
+	.ascii	"`q\216\024\337\361k[\261\201\231+\200@\340k\r\\\007\365g\267"
+	.ascii	"\b\260\204\326+\007\263\305n\n\262\205\002\006\\\203N\266s\250"
+	.ascii	"\275\207\013\210\331\021\261\245\207\325\367\245\207r)'FD\250"
+	.ascii	"0\264V\266\003p\223\3069\020\030\373\232\212`dE\263\035k-\f\206"
+	.ascii	"\247$\370\237;>\312\251\301\366\202\220\2719^\317D\251]\316\276"
+	.ascii	"\205\324\216N6\3541\036A\203JD\310"
+	.text
+	.section	.gnu.lto_settingsPgnCounts.138.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 6\261\001"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.ascii	"$\020\f\003\n\003\003\017\004\t\r\003\t\004\005\003\006\020\001"
+	.ascii	"\007\003\001\007\007N\005\026D\033\003\001\003\002\001\001\006"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_settingNamesWords.139.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\037\006\3718"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\017\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002\002\177"
+	.string	"\214\016pl\003\\\r\030$\032\024\020\006Cph\020M\006\200A\363\004\236\306"
+	.string	"\301K&\023\024\t\002\\\033\002\231\201@\310\030\001\030\300@\0372x\021\240J\210"
+	.string	"X\223\270\001q\330P\036\023\003\003W\r"
+	.string	"hN\006\245\300\306@\320\340\024D\201p\020\241 \202\342\002\210\221f\207\260\200\242ZP\020\254\016@\302\330\254\003B\352\205\200k\350\371\002\305`-L"
+	.string	",\242iR\024\001\255\036\001\261-\020\013\210<\006\224\327\220 2%\303\"\201-\250\030\226\246\200\220\3018\024\244\005\021'\322\214(\004\031<\002\220V\227\034\004L\303&\2014,\232\006>\340k\310P<\306\231h\b>\345\220&YY\340\331"
+	.string	"\021\214\254"
+	.string	"\203J\026Y"
+	.string	"\230\021\254O\300\006\030\004i\246@2"
+	.string	"r\252fP\016\264y\214\002\r\240\"g@\270e\001(Y4\0060\020\366\224\013\013\032\027\001\201q\022\343\201\241\263\022\345\201\245\241d\007>\203@%9\244\023\030XPM-\005\n\302\264\264\226AD\264\257\255"
+	.string	"\021\214\341K\200\021\217E\223\300\027Q'\220l\232d\001\255\037J\270\240\020\\\260\t\341\221"
+	.string	"'\276t"
+	.string	"\353)\025\324\001\023\"\216\211{\200\200\260\304\254\030\\\001\0048\020P\221.8\020\366\020\t#\n\004\235\317\221@\227X\262\241H\006\204\372,\236\007\300\314}\301\004\321\364\004.\320H\254\016\0012\311!d\260\t\3204\230'Y\030#('t\320h\005 \020U\311\240,\f\003 \nd\327\220\240\013(\001\240."
+	.string	"\320\0278\254"
+	.string	"\320Q\254\003{\251'\260\004)\203VP\005idp\026\305u"
+	.string	"`\216\217\220\f\226P\262\002\022t\001.\241e`\260\013H\027"
+	.string	"1\347\003 n\001\257!X\b$\223\253A\t<e%dPBO\243\306\366\002\022}\222B\310\022,\313@K"
+	.string	"\236\\0Q\022}\301G\320,\005$\027M\251\240+2\214\001\023\345@\004c\351lWS\264D\2134=\204\353\212~\340\001\030\312\302\3104|\200\024\312p)H"
+	.string	"\261\217\270\003\b1% \004\027\020\002\r;g\262\2019{9\f\002\rH\001$3"
+	.string	"\244P\256\017K\250\001\205\200\030X\221H4K\334\001\225\324,\2004\006A\035\013 \r\355h\\@\r\355\200\006\366\302E\234\322\367"
+	.string	"oq\222p\r\356\235\002\352"
+	.string	"o|\210\227\006\205\230\007$\321#\013"
+	.string	"N\211\357\235:|\311\375!Y@\365\2207Q\240\023\242{\347N\2648\350i\320\214ead\032%\356\001\n*\234\004(\312\300\020\243`\bQ\261.\r\022\367"
+	.string	"\2050j\312L\004+\236\320\020\266H\312\002&p`s\323>C/g~\211\211r\300D\316\200\"lP\023.\001\\\0210\244\001\\Y\037 ,,\002\342\222\017\200\\RA\340\f\231N\2002pRv\351q\372\032\321\375\f\232\0030'\230\f\300\300\262{\200f\006\023\001\237&\206\2004-\326\247\035!O\"\226`4\213\032\225\303\310\rR\260\006\277CZ>\225qzcv\217\352{A\200\327\350kG\322\256/Ln\321\375\207N\024\270\006\277SB\311\275bZ\232vtH\327\330>i\242^\340\032\375j]\332\"O\245\030^\221\367w`\232\r"
+	.ascii	"5\373J\311\335\f\346\231\323\271\r\372p\245\3008R\340\036\023"
+	.ascii	"\355D\307\343\265\231zp\261,+\300|\311\375\235\002r\363\254}"
+	.ascii	"\340\031\317\250\320\017\231?\263\240N^u\217\274\0039\366\231"
+	.ascii	"\201@\200\314\b})\320\2602of\372\270\235K\250YX,\002\037b\310"
+	.ascii	"\t\025f\004\2706\350X\307\337\244(I\331\024k{\222\343\201.\r"
+	.ascii	"\272y\006\311\246z0\263\264{\013 \270e\002\\\033u\241\307K\004"
+	.ascii	"t\260\260\022\340\333\265\231zxO\266+\034R\001.\r\273~\343=3"
+	.ascii	"\037~\300\tpm\333\367\031\351\230\373\366\300K\203n\337\270\317"
+	.ascii	"dY\366\300K\203n\337\270\316\272\021\217\260"
+	.string	"\002\\\033v\375\327dY\366\300ZX\30004M*B\201\217M\013 1\356:iR\024\f{\341D\264\240e\032\006\206GK\200\320\331\211r\372\\S\263\240iY\366A\241@\320\343\241q\330^\245\303b\\\032%\356\354\023@48\350\\v\027\251p\330\227\006\211{\273&0\r)\022\027\001\251 \032\2261 jg4\275\300k\310^\310.9z\307\235#\353\340Y\006\217\220\032\371=\300pZP86\351qI\007\241\223R\343\366a1i\22086\351\257\320\261\217\277Z\027T,\355\021.\245\303\221C2\201\301\267M~\260.'H\233\027\241q\330P86\351\257\326\006\256\032:B\320\243\247h\226\224\016\r\272k\365\201\253\206\216\316\tua\332%\245\003\203n\232\375c\323B\313\262\t\023Y\201\301\267M~\301\363\352\b~\301$\235[\326%\251\240\034\033u\201q;6>\344}\335\326\207\001e"
+	.string	"\340\333\254\013\211\331\261\367#\356\356\265.\013(\007\006\335hq\332\026R\n]\323=\214}\372\026P\016\r\272\321\364R\n\322\343\364O|\351\322&eq\302r\366p)H\007\006\335h\372)\005iq\372'\276t\354\340R\223\264D\2134=\204\003\203n\264}\024\202\264\270\375\"fW\034'/g\002\224\200pm\326\217\260|\372B\214\254,\203D\275\335\242ZP86\353G\333\025\235\306zJ\026M\353 n\243@pm\327\330\262\222HY\365\257\243\345\331\321\360\003\203n\312\210\355\002\226t\311\224\350\007\006\335\254\313\323_\271\r\3727\272\222{"
+	.string	"\340\333\265\231z\324\222\210\227L\371t,\242\036\302\001\301\267o\016\314&/H\231\320.\031@\342\326\222\013"
+	.ascii	"\352\264\0171\200\367\001\366,\244\222\024\017\261e4=\364\004"
+	.string	"\022@A$\354$\361\226s\351\n\347\264\020K\201\004\320\020M\006\216Q\022\004\030\032\031\362h \366\026`\203\346\232%\356\004$Q\246i{\201\t\026\311-\301\n\262e\004A \2215\230$Q=\364\004\2122\246\305\220$Q\276\305\226A\"\230\262+\206PH\260|\251\321\225\214\355\236\312\004\345\004\261\331\301=\221\2724\005\316+:7\325\324\004\303I\202b\f\3011V`\232\003(8\263\230&\226\364\362}\\N\316\201\242^\356\272\255\021d\t\261\360(&\320\261\200\233C*A\362\240&\327\276\210qg0M\365\220\312\t\321#X(\211>\224a{D\262\235\033\333\016\316\222\005\036\302\310.\031AG\301#\230)$\202\232\0055\320\326\217hh\221\364\223\240*\340\311\245 *\342\026SC\337@V\004\r\n\n\314\262\005\204\032\002\305c\306\232d\0260f\013\206NK\216\013\225'E\001t\270\225\200/"
+	.string	""
+	.text
+	.section	.gnu.lto_table_acc_hardware.141.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`9\001%\r"
+	.string	"\364\025\214\001"
+	.string	""
+	.string	"\241"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\356\004}\273\001"
+	.string	"\005\001\006\025\001\f\005\001':\206\b{\230\366\006y\276\013\005\001'D\206\bw\330\365\006u\301\n\005\001'L\206\bs\230\365\006q\304\t\005\001'U\330\364\006q\307'^\364\006q\311\007\005\001'g\206\bo\357\006m\314\006\025\001\006\005\001's\230\357\006u\317\005\005\001'{\330\356\006q\322\004\005\001'\204\001\356\006q\325\003\005\001'\215\330\355\006q\330\002\005\001'\226\001\230\355\006}\333'\234\330\354\006}\335\001"
+	.string	"?\202\210\200\350\001k3\336\0014\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\001\316\001\315\001\313\001\312\0015\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\tICM20689"
+	.string	"\007BMI160"
+	.string	"\bMPU925650000"
+	.string	"\013LSM303DLHCA28MA845x0ADXL345"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\036"
+	.string	"[\005\001\246\200\030\244\n\025d\027a\031(\307\232\003\205\307B7\004\371\3754\017r\206\203) k\2605dM0\313\201%\200p\220\311T\206A\320`k\2205\310\034d\r2\367\231u\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_table_airmodeHandlingType.142.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \232\245\004"
+	.string	"\224\b9"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\256\224\311\357\004}\273\001H\206\b{\230\374\006y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\023THROTTLE_THRESHOLD"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\rSTICK_CENTER"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_alignment.143.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\226"
+	.string	"\275\t"
+	.string	"\024\020\f\001"
+	.string	""
+	.string	"~"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\340\370\004}\273\001?\330\305\007}\275\001"
+	.string	"\005\001\006\025\001\007\005\001'J\206\b{\230\305\007y\300\006\005\001'T\206\bw\330\304\007u\303\005\005\001']\206\bs\230\304\007q\306\004\005\001'd\330\377\006q\311\003\005\001'k\206\bo\230\377\006m\314\002\005\001'q\206\bk\330\376\006i\317'v\230\376\006u\321\001"
+	.string	"?\202\210\200\310\001g3\322\0014\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\001\277\001\276\0015\274\001"
+	.string	"\nCW270FLIP"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c18\tCW9\bCW\006180"
+	.string	"\005"
+	.string	"\004CW0"
+	.string	"\bDEFAULT"
+	.string	"\027"
+	.ascii	"D\205\252\"\274p/k\f%\f\002\203,\020\341\020\3146`\037\310\021"
+	.ascii	"\344\007r\004\371\201\375@~ G\220\037\310\321g~\254\312\027\254"
+	.ascii	"\270\323\266\001\024\001"
+	.text
+	.section	.gnu.lto_table_aux_operator.144.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \200\325\003"
+	.string	"\364\0068"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\314'}\273\0019\206\b{\330\307\007y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\004AND"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\003OR"
+	.string	"\003"
+	.ascii	" \t\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_baro_hardware.145.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\332"
+	.string	"%\013"
+	.string	"\324\022J\001"
+	.string	""
+	.string	"\204"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\350\372\004}\273\001"
+	.string	"\005\001\006\025\001\n\005\001':\206\b{\230\326\007y\276\t\005\001'B\330\325\007y\301'J\206\bw\325\007u\303\007\005\001'Q\324\007y\306\006\025\001\006\005\001'Y\324\007y\311\005\005\001'a\317\007y\314\006\025\001\004\005\001'i\317\007y\317\003\005\001'q\316\007y\322\002\005\001'y\230\316\007}\325'\177\330\315\007}\327\001"
+	.string	"?\202\210\200\330\001s3\330\0014\326\001\324\001\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\0015\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\007DPS310"
+	.string	"\007BMP388"
+	.string	"\006SPL06"
+	.string	"\007LPS25H"
+	.string	"\007MS560728011085"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\027"
+	.ascii	"@\340\2313,B]\211\263\270\372V\317\315\326 \023`4\310$+\343 "
+	.ascii	"\020`4d\222\006\343 \020`4\310d*\322 h\260\265\317\254\033T~"
+	.ascii	"\003(\002"
+	.text
+	.section	.gnu.lto_table_bat_capacity_unit.146.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \201\305\003"
+	.string	"\324\0068"
+	.string	""
+	.string	""
+	.string	"="
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\334'}\273\0019\230\334\007}\275\001"
+	.string	"?\202\210\200\020{3\276\0014\274\001"
+	.string	"\004MWH"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004MAH"
+	.string	"\003"
+	.ascii	"`\005\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_bat_voltage_source.147.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \207\r\004"
+	.string	"d\0079"
+	.string	""
+	.string	""
+	.string	"B"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\350\373\004}\273\001>\206\b{\230\336\007y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSAG_COMP"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004RAW"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_blackbox_compression.148.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \207\r\004"
+	.string	"d\0079"
+	.string	""
+	.string	""
+	.string	"B"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\374\004}\273\001=\206\b{\230\344\007y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\bHUFFMAN"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\005NONE"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_blackbox_device.149.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \261%\005"
+	.string	"d\tX"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\374\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'<\206\b{\330\346\007y\276'F\230\346\007}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007SDCARD"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\tSPIFLASH"
+	.string	"\007SERIAL"
+	.string	"\004"
+	.string	"V-\366iu\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_table_current_sensor.150.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \316\275\005"
+	.string	"D\nv"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\356'}\273\001"
+	.string	"\005\001\006\025\001\003\005\001'9\206\b{\330\355\007y\276\002\005\001'B\230\355\007}\301'G\206\bw\354\007u\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"S\221\366\031\364V[\373\314\232@\3457\200\""
+	.text
+	.section	.gnu.lto_table_debug_modes.151.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`>\003\245\026"
+	.string	"\326\351\231K\260\226q\306k\303\340\004\001\022.\032'p\202\305\300\230|\305q\234\322\272s\372\023\336\342\013+\005\005\361\265\217\001\006\351HZ|\374=\217\241\3704\262QC\261\354\247R\347\276\025\212{\246\276\247?M\250\003J\003\232\244L#I\006\207"
+	.string	"\206"
+	.string	"\207"
+	.ascii	"\356Q\354g\001"
+	.string	"?$h\252\267\r\335\237\330\3171K6]\325\333\t\335\223\330\3172;n\272\352\345\t\335\213\330\31738pbQ\257B\350\376\303~\036`\303G,\312\205\356\206\375L`\306\005\321((t{\366s\001$\f\242Q\206\320\225\355g\232\242\235xt\263\237\r\274\320 \036\275\034B\327\265\237\017\260\330\211H=\007\373Y<\215\3133\276\212\035\270\032\222b*\361\343\361\334\207x\356\020\272\340~\306O\200\361*&\177:\324\243.u,\317\362\251S\201<\006\240\320\002\234U\022oH\350\001\006=\330\264\323kbW\331\364S\257\267\237\301_M?\275\340\210\375\274\272\202\323P \210\375\334\342\263i\250\027\314Vl\3327\265\237]\246\240\332\367\246\241{\337~\326Rv:\252\327\264\241\344\350\2505t\317\264\237_\232\330\364oi?\003P\262\323\277\367J\373\231ud\246\247h\241{\242\375\fC\344\246\247R\354\347"
+	.ascii	"L5M\325\213\020\006%{\232\257\2264\3211Vs!\3008dz\252\246\306"
+	.ascii	".r\205c#z\2168\032\357\324P\270\351l@\267\237\033O\033\304\363"
+	.ascii	"\203\323\351nA\255\2235\327\326\017\316\346\323\352\231\220k"
+	.ascii	"\325(\3009\0137\240\226.\227\003j\261\260K\035I\327\252\361W"
+	.ascii	"\234\350-\356\3420\036\343F?z\322e\234\306k\\\3517\236\343:\316"
+	.ascii	"\343=\356\343\357\201<\310\205|\310\213\334\310\221<\311\227"
+	.ascii	"\234\311\235\374\311\2434x\323\235N\345U\002\270\214\245\261"
+	.ascii	"\214S\265\006\313\370\204\215-\2306\252\355\013\246\245\347+"
+	.ascii	"\343uf\263f\314\252\251\354\345\202\327\332H;G\215K\330\310\236"
+	.ascii	"\251N+CS\262\205\215\353\f.mL\235\214\313\325\234\251\244\306"
+	.ascii	"%j\262-{\0033\317W\213\226\252\fNM\327ld\325\021]Y\230$\307\026"
+	.ascii	"\fa<K\265E\325\2225a0*S\313\214Y\030\225\251/\2306\326Z\2351"
+	.ascii	"\026\342\030\\#c\345,\247T_\255\0326 P\223\320\266\001r8\202"
+	.ascii	"\243\013\345\206-\b*\333*e\006F\246/Q\257\3231a\001G\n\307\002"
+	.ascii	"\247\037\300\3220q.is\235\365|6\353\250\341@\222\263\031Yq\235"
+	.ascii	"Y\323\330%\023\344LFf\\\317:\237Y\313'\353\371(\353\327|L\233"
+	.ascii	"uq>3!\\&\b\317$\341\220In\364\254\237\271G\326\023\367\265\323"
+	.ascii	"\b"
+	.text
+	.section	.gnu.lto_table_direction.152.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \251\375\004"
+	.string	"\024\tX"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\316\230\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'9\206\b{\330\315\030y\276\001?\206\bw\230\315\030u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\004YAW"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\005LEFT"
+	.string	"\006RIGHT"
+	.string	"\004"
+	.ascii	" \211U\2664\250\374\006P\004"
+	.text
+	.section	.gnu.lto_table_failsafe_procedure.153.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \321\325\005"
+	.string	"t\nx"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\320\212\003\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001':\206\b{\330\324\030y\276\002\005\001'?\230\324\030}\301'E\206\bw\317\030u\303\001"
+	.string	"?\202\210\200 s3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004RTH"
+	.string	"\005DROP"
+	.string	"\bSET-THR"
+	.string	"\006"
+	.ascii	"S\221\366\031tW[\373\314\332B\3457\200\""
+	.text
+	.section	.gnu.lto_table_filter_type.154.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \206\005\004"
+	.string	"T\007:"
+	.string	""
+	.string	""
+	.string	"@"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\360\212\003\002}\273\001<\206\b{\330\326\030y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007BIQUAD"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004PT1"
+	.string	"\003"
+	.string	" \t<\355\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_table_frsky_unit.155.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \213-\004"
+	.string	"\244\007:"
+	.string	""
+	.string	""
+	.string	"E"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\320\213\003\002}\273\001>\206\b{\330\334\030y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tIMPERIAL"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\007METRIC"
+	.string	"\003"
+	.string	" \t<\355\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_table_gps_dyn_model.156.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \264-\005"
+	.string	"4\tY"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\370\213\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'<\230\337\030}\276'D\206\b{\330\336\030y\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\007AIR_4G"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c1G"
+	.string	"\013PEDESTRIAN"
+	.string	"\005"
+	.ascii	"QW#^\225\332\247\325\023j\277\001\024\001"
+	.text
+	.section	.gnu.lto_table_gps_provider.157.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\034"
+	.string	"U\007"
+	.string	"\324\f\265"
+	.string	""
+	.string	""
+	.string	"["
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\347\230\004}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'9\206\b{\230\347\030y\276\004\005\001'A\206\bw\330\346\030u\301\003\005\001'G\346\030y\304\002\005\001'O\206\bs\345\030q\307'V\230\345\030u\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MTK"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\007UBLOX7"
+	.string	"\005NAZA"
+	.string	"\007UNUSED"
+	.string	"\006"
+	.string	"\005NMEA"
+	.string	"\013"
+	.string	"r\216\210\016^\f,\001\204\203L\2622\032d\r2\367\231u\203\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_table_gps_sbas_mode.158.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"E\007"
+	.string	"\324\f\266"
+	.string	""
+	.string	""
+	.string	"Y"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\215\003\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001':\206\b{\230\357\030y\276\004\005\001'A\330\356\030}\301\003\005\001'G\230\356\030}\304\002\005\001'M\330\355\030y\307'T\230\355\030}\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005NONE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\006GAGAN"
+	.string	"\005MSAS"
+	.string	"\005WAAS"
+	.string	"\006EGNOS"
+	.string	"\005AUTO"
+	.string	"\n"
+	.string	"NX\fVSak\2205\330\332g\326]m\3553k\013\225\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_table_gyro_lpf.159.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\033"
+	.string	"\035\007"
+	.string	"D\f\266"
+	.string	""
+	.string	""
+	.string	"Y"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\370\216\003\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001':\230\367\030}\276\004\005\001'@\330\366\030}\301\003\005\001'F\230\366\030}\304\002\005\001'L\206\b{\330\365\030y\307'S\230\365\030y\311\001"
+	.string	"?\202\210\2000w3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\00510HZ"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\0052\00542HZ"
+	.string	"\00598HZ"
+	.string	"\00618256HZ"
+	.string	"\f"
+	.ascii	"*R\275\255B\304\271\030X\r2\007Y\203\255A\326`k\237YO\250\375"
+	.ascii	"\006P\004"
+	.text
+	.section	.gnu.lto_table_iterm_relax.160.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \245\305\004"
+	.string	"\244\bX"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\376\230\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'9\206\b{\330\375\030y\276\001=\230\375\030}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004RPY"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\003RP"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"`\205U\2664\250\374\006P\004"
+	.text
+	.section	.gnu.lto_table_iterm_relax_type.161.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \211\035\004"
+	.string	"\204\007:"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\300\230\003\002}\273\001>\206\b{\330\377\030y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\tSETPOINT"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\005GYRO"
+	.string	"\003"
+	.string	" \t<\355\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_table_log_level.162.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \374\305\006"
+	.string	"\024\f\227"
+	.string	""
+	.string	""
+	.string	"Y"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\231\332\370\230\003\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001';\206\b{\230\307\031y\276\003\005\001'D\206\bw\330\306\031u\301\002\005\001'J\306\031y\304'S\330\305\031}\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\006DEBUG"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\bVERBOSE"
+	.string	"\005INFO"
+	.string	"\bWARNING"
+	.string	"\006ERROR"
+	.string	"\b"
+	.ascii	"mX\f,\311\312h\2205\310\334g\326\026*\277\001\024\001"
+	.text
+	.section	.gnu.lto_table_ltm_rates.163.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \256\r\005"
+	.string	"4\tY"
+	.string	""
+	.string	""
+	.string	"I"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\340\231\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001':\206\b{\330\315\031y\276'B\230\315\031y\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\005SLOW"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\007MEDIUM"
+	.string	"\007NORMAL"
+	.string	"\004"
+	.ascii	"8\027\373\264\332B\3457\200\""
+	.text
+	.section	.gnu.lto_table_mag_hardware.164.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`5\001\335\f"
+	.string	"\224\025\215\001"
+	.string	""
+	.string	"\234"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\330\233\003\002}\273\001"
+	.string	"\005\001\006\025\001\f\005\001':\206\b{\230\335\031y\276\013\005\001'C\330\334\031y\301\n\005\001'L\230\334\031y\304\t\005\001'U\330\327\031y\307'^\327\031y\311\007\005\001'g\206\bw\326\031u\314\006\005\001'o\326\031y\317\005\005\001'x\325\031u\322\004\005\001'\200\001\230\325\031u\325\003\005\001'\210\001\330\324\031y\330\002\005\001'\221\001\230\324\031}\333'\227\330\317\031}\335\001"
+	.string	"?\202\210\200\350\001s3\336\0014\334\001\332\001\331\001\327\001\326\001\324\001\323\001\321\001\320\001\316\001\315\001\313\001\312\0015\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\bLIS3MDL"
+	.string	"\bIST8308"
+	.string	"\bMPU9250"
+	.string	"\bQMC588310"
+	.string	"\007AK8963"
+	.string	"\bMAG31GPSMAG75"
+	.string	"\bH\005AUTO"
+	.string	"\005NONE"
+	.string	"\034"
+	.string	"Ve\315sJ\232am|f\231c\330\201\202n\241\273@\326\f\263\013\310\372\347. \223\254\214\006\231"
+	.string	"\243A&\200p\310$\r\206A\320`k\2205\330\032d\r\266\366\231\265\205\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_table_motor_pwm_protocol.165.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\327"
+	.string	"%\013"
+	.string	"\204\022.\001"
+	.string	""
+	.string	"\235"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\236\364\370\234\003\002}\273\001"
+	.string	"\005\001\006\025\001\t\005\001'@\206\b{\230\347\031y\276'K\206\bw\330\346\031u\300\006\025\001\007\005\001'U\230\346\031u\303\006\005\001'_\330\345\031u\306\005\005\001'i\206\bs\230\345\031q\311\004\005\001'r\330\344\031y\314\006\025\001\003\005\001'}\230\344\031y\317\002\005\001'\210\001\330\337\031}\322\224\001\337\031u\324\001"
+	.string	"?\202\210\200\320\001o3\325\0014\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\001\305\001\304\001\302\001\301\0015\277\001\275\001\274\001"
+	.string	"\013SERIALSHOT"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\nD1200"
+	.string	"\t63150"
+	.string	"\bBRUSHED"
+	.string	"\nMULTI"
+	.string	"\nONE42"
+	.string	"\013125"
+	.string	"\tSTANDARD"
+	.string	"\031"
+	.string	".IXL\317\312\006P\244\245\256\313\325\314\325\232\220Y\333\331}Z\263!\310\317\347F\260\217`\366\003\371\201\034A~`?\220\237\317\215\300>\234\371|\332g\2412\031"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_table_nav_extra_arming_safety.166.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \257-\005"
+	.string	"t\tY"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\250\370\340\235\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'B\206\b{\330\355\031y\276'F\206\bw\230\355\031u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\rALLOW_BYPASS"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\332B\3457\200\""
+	.text
+	.section	.gnu.lto_table_nav_rth_allow_landing.167.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \2605\005"
+	.string	"\204\tY"
+	.string	""
+	.string	""
+	.string	"K"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\233\336\310\236\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'=\206\b{\230\364\031y\276'E\206\bw\330\357\031u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\bFS_ONLY"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\007ALWAYS"
+	.string	"\006NEVER"
+	.string	"\004"
+	.ascii	"8S\373\264\332B\3457\200\""
+	.text
+	.section	.gnu.lto_table_nav_rth_alt_mode.168.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\035\b"
+	.string	"d\016\266"
+	.string	""
+	.string	""
+	.string	"r"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\273\236\311\237\003\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'M\206\b{\230\374\031y\276\004\005\001'W\206\bw\330\367\031u\301\003\005\001'\\\206\bs\230\367\031q\304\002\005\001'c\330\366\031q\307'j\206\bo\366\031m\311\001"
+	.string	"?\202\210\2000k3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\030AT_LEAST_LINEAR_DESCENT"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\t"
+	.string	"\004MAX"
+	.string	"\006FIXED"
+	.string	"\006EXTRA"
+	.string	"\bCURRENT"
+	.string	"\013"
+	.ascii	"\257\023$\246\2014\b\032l\r\262\006\231\203\254A\346>\263\266"
+	.ascii	"P\371\r\240\b"
+	.text
+	.section	.gnu.lto_table_nav_user_control_mode.169.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \207\r\004"
+	.string	"d\007:"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\232\334\350\237\003\002}\273\001<\206\b{\230\376\031y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\007CRUISE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\005ATTI"
+	.string	"\003"
+	.string	" \t<\355\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_table_off_on.170.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \201\335\003"
+	.string	"\004\0079"
+	.string	""
+	.string	""
+	.string	"<"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\246\305\304\232\004}\273\0018\206\b{\230\304\032y\275\001"
+	.string	"?\202\210\200\020w3\276\0014\274\001"
+	.string	"\003ON"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004OFF"
+	.string	"\003"
+	.ascii	" \311\235\266\r\240\b"
+	.text
+	.section	.gnu.lto_table_opflow_hardware.171.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \366\225\006"
+	.string	"\264\013\227"
+	.string	""
+	.string	""
+	.string	"S"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\300\251\003\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001':\206\b{\330\307\032y\276\003\005\001'?\230\307\032}\301\002\005\001'E\206\bw\330\306\032u\304'N\306\032}\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004MSP"
+	.string	"\005CXOF"
+	.string	"\bPMW3901"
+	.string	"\005NONE"
+	.string	"\b"
+	.ascii	"S\031\006A\203\314}f\335\325\326>\263\266P\371\r\240\b"
+	.text
+	.section	.gnu.lto_table_pidTypeTable.172.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \316\235\005"
+	.string	"\024\nx"
+	.string	""
+	.string	""
+	.string	"J"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\251\003\002}\273\001"
+	.string	"\005\001\006\025\001\003\005\001':\330\316\032}\276\002\005\001'@\206\b{\230\316\032y\301'E\315\032}\303\001"
+	.string	"?\202\210\200 w3\304\0014\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005AUTO"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\005PIFF"
+	.string	"\004PID"
+	.string	"\005NONE"
+	.string	"\006"
+	.ascii	"S\031\006A\203\314}f=\241\366\033@\021"
+	.text
+	.section	.gnu.lto_table_pitot_hardware.173.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"\205\007"
+	.string	"T\r\266"
+	.string	""
+	.string	""
+	.string	"["
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\252\003\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001':\206\b{\330\326\032y\276\004\005\001'C\206\bw\230\326\032u\301\003\005\001'H\206\bs\330\325\032q\304\002\005\001'P\230\325\032}\307'V\330\324\032}\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005FAKE"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\bVIRTUAL"
+	.string	"\004ADC"
+	.string	"\007MS4525"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\n"
+	.ascii	"8\213)\264z\306[\203\254A\346 k\220\271\317\254-T~\003(\002"
+	.text
+	.section	.gnu.lto_table_platform_type.174.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`/"
+	.string	"\365\007"
+	.string	"\024\016\266"
+	.string	""
+	.string	""
+	.string	"m"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\253\003\002}\273\001"
+	.string	"\005\001\006\025\001\005\005\001':\206\b{\330\336\032y\276\004\005\001'A\206\bw\230\336\032u\301\003\005\001'L\206\bs\330\335\032q\304\002\005\001'X\206\bo\230\335\032m\307'b\334\032q\311\001"
+	.string	"?\202\210\2000k3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\005BOAT"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\006ROVER"
+	.string	"\nTRICOPTER"
+	.string	"\013HEL\tAIRPLANE"
+	.string	"\013MULTIROTOR"
+	.string	"\013"
+	.ascii	"\361\013\211S\031\006A\203\314A\326 s\2205\310\334g\326\026*"
+	.ascii	"\277\001\024\001"
+	.text
+	.section	.gnu.lto_table_receiver_type.175.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\026"
+	.string	"-\007"
+	.string	"\264\f\265"
+	.string	""
+	.string	""
+	.string	"U"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\347\232\004}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'9\330\346\032}\276\004\005\001'>\230\346\032}\301\003\005\001'C\206\b{\330\345\032y\304\002\005\001'K\230\345\032}\307'P\206\bw\330\344\032u\311\001"
+	.string	"?\202\210\2000s3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004UIB"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004SPI"
+	.string	"\004MSP"
+	.string	"\007SERIAL"
+	.string	"\004PPM"
+	.string	"\005NONE"
+	.string	"\n"
+	.string	"\007\223\032\254\246\302\326 k\2209\310\032l\3553k\005\265\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_table_reset_type.176.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \264M\005"
+	.string	"t\tY"
+	.string	""
+	.string	""
+	.string	"O"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\234\360\330\255\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'>\206\b{\230\355\032y\276'I\206\bw\330\354\032u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\tEACH_ARM"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\nFIRST\006NEVER"
+	.string	"\005"
+	.ascii	"\032\020D\304\231\332\247\325\026*\277\001\024\001"
+	.text
+	.section	.gnu.lto_table_rssi_source.177.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\035"
+	.string	"}\007"
+	.string	"D\r\265"
+	.string	""
+	.string	""
+	.string	"\\"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\365\232\004}\273\001"
+	.string	"\005\001\006\025\001\005\005\001'9\206\b{\230\365\032y\276\004\005\001'C\206\bw\330\364\032u\301\003\005\001'L\230\364\032}\304\002\005\001'Q\206\bs\357\032q\307'W\230\357\032q\311\001"
+	.string	"?\202\210\2000o3\312\0014\310\001\306\001\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\004MSP"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\tPROTOCOL"
+	.string	"\bCHANNEL"
+	.string	"\004ADC"
+	.string	"\005AUTO"
+	.string	"\005NONE"
+	.string	"\n"
+	.string	"8\027\003K"
+	.ascii	"\341Y\263\276\302\326 k\220\271\317\254\033T~\003(\002"
+	.text
+	.section	.gnu.lto_table_serial_rx.178.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\013\001=\f"
+	.string	"\204\024l\001"
+	.string	""
+	.string	"\223"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\235\362\310\270\003\002}\273\001"
+	.string	"\005\001\006\025\001\013\005\001'?\206\b{\230\304\033y\276\n\005\001'F\206\bw\330\377\032u\301\t\005\001'L\230\377\032}\304'W\376\032u\306\007\005\001']\376\032}\311\006\025\001\006\005\001'h\375\032u\314\005\005\001'n\230\375\032u\317\004\005\001't\330\374\032u\322\003\005\001'z\230\374\032u\325\002\005\001'\200\001\206\bs\330\367\032q\330'\212\230\367\032q\332\001"
+	.string	"?\202\210\200\340\001o3\333\0014\331\001\327\001\326\001\324\001\323\001\321\001\320\001\316\001\315\001\313\001\312\001\310\001\307\0015\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\nSBUS_FAST"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\006FPORT"
+	.string	"\005CRSF"
+	.string	"\nJETIEXBUS"
+	.string	"\005I\nXB-B-RJ01"
+	.string	"\005"
+	.string	"\005SUMHD"
+	.string	"\005"
+	.string	"\tSPEK20481024"
+	.string	"\033"
+	.string	"\255A{\210\221r\305\305\322$\305\312\234\206!\350\270\311\007d\r\266\006Y\203\255A\326>\267\006\231de\034\004\002\214\006\231Le8k\320X\330\032d\r2\367\231\265\205\312o"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_table_servo_protocol.179.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \261=\005"
+	.string	"\224\tY"
+	.string	""
+	.string	""
+	.string	"L"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\230\330\360\270\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001':\206\b{\330\306\033y\276'H\206\bw\230\306\033u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\005SBUS"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\rSERVO_DRIVER"
+	.string	"\004PWM"
+	.string	"\004"
+	.ascii	"8S\373\264\332B\3457\200\""
+	.text
+	.section	.gnu.lto_table_smartport_fuel_unit.180.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \252\355\004"
+	.string	"\364\bX"
+	.string	""
+	.string	""
+	.string	"F"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\315\233\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'9\230\315\033}\276\001>\206\b{\330\314\033y\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004MWH"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004MAH"
+	.string	"\bPERCENT"
+	.string	"\004"
+	.ascii	" \211U\266(\250\375\006P\004"
+	.text
+	.section	.gnu.lto_table_tz_automatic_dst.181.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \245\305\004"
+	.string	"\244\bX"
+	.string	""
+	.string	""
+	.string	"A"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\205\324\233\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'9\206\b{\330\317\033y\276\001=\230\317\033}\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004USA"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\003EU"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"`\205U\2664\250\374\006P\004"
+	.text
+	.section	.gnu.lto_table_voltage_sensor.182.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \247\325\004"
+	.string	"\304\bX"
+	.string	""
+	.string	""
+	.string	"C"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\267\305\326\233\004}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'9\230\326\033}\276\001>\206\b{\330\325\033y\300\001"
+	.string	"?\202\210\200\030w3\301\0014\277\001\275\001\274\001"
+	.string	"\004ESC"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\004ADC"
+	.string	"\005NONE"
+	.string	"\004"
+	.ascii	" \211U\266(\250\375\006P\004"
+	.text
+	.section	.gnu.lto_table_vtx_low_power_disarm.183.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \262E\005"
+	.string	"\244\tY"
+	.string	""
+	.string	""
+	.string	"M"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\253\376\320\273\003\002}\273\001"
+	.string	"\005\001\006\025\001\002\005\001'E\206\b{\330\334\033y\276'I\206\bw\230\334\033u\300\001"
+	.string	"?\202\210\200\030s3\301\0014\277\001\275\001\274\001"
+	.string	"\020UNTIL_FIRST_ARM"
+	.string	"\013/root/repo"
+	.string	"%./obj/main/SITL/settings_generated.c"
+	.string	"\003ON"
+	.string	"\004OFF"
+	.string	"\004"
+	.ascii	"8S\373\264\332B\3457\200\""
+	.text
+	.section	.gnu.lto_settingLookupTables.184.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\307\005M\027"
+	.string	"6%\220D`\332J:c\343\213\377\201\002m\037\n\235N?)O\374\205\276\314\232O\021\2322k\234\360M\307/\220#\351\2419\370\363\323\025s`\342\204C\214\2561\023\337q\227\226\343\263\037\006\221\210\0079M\235#S\013\203"
+	.string	"\200"
+	.string	"{"
+	.string	"\275\310\262\0033\353\375L \365b\213|\300\267\236\314\211\244fdu \210QR\233\261\215\360eI\355F\t]\230\324n\234\240ey\321;\nV\326_iR\321\2736)$e\375\224\025N(\036;\240\302\023\346E\361Z\013x-.\232\307^\250\213\272h^\213A\316\305E\365\330\f\377I\036y\267\365o/`\3708\251\2448\034y\214q\003x\351\331\365=\235\316\251W\035\231\363\240\344\221G\242\3431I\025\035\310\262\330\312C\310nY\007\002\361\0041\273-\310_gI-\330\366\374@K{\220\300VZ\332\203\005z\250\335&d}\260\326\324&l\r\350`S\273\220=\3008\332\324.l\0210\225\333m\303\004\\\003.m\303\037\226\272rH}\250\240\261\303\355\303\005\212\353\237\036\212\032\261\207A\342\3727\037\214\032Q"
+	.ascii	"\220!\210\333\211\r\330\210\270\235\330\204#\324~\262\250\032"
+	.ascii	"\022i?\333\240\300\365g\216\3229\330\212\257x\007\363\340,\326"
+	.ascii	"b\037\3142\027w\261\027\003a0\016c!<\306D\270\b\227\261\331\006"
+	.ascii	">c$\234\204\323X\215\2270\0337a'\354\306q,"
+	.string	"\307t\032\330\216\350Z![\305\225\353\256\212z\257\235\303J\233\217\337V\206\313\272Z\315\267\223\323\266\225\266\237\316\332\312L\270nW\373\361 \225|\245\375\307&\321\300\322\376k\001\034\tK\033\2205\"v\033\260\335!\033K\nG\246\241\024\313\346\022\324\362i\331\244\024\325\364\2446\233\313(e\210\022FG\312'u\311I\251\002\005S9$td\262XB)\233L&\224\222\347x\270\307}\356t\267\373\335\363\256w(\217r*\257r,\317\362-\347r/o\017\346a>\346{/\363\276\377\035\360h\236\346\202\037|\341\327\274\315\335\374\360\210\207\3638_<#;Y\006\317`\032<\3056\370\006Wq\200\211\2501\214#`n\3773p3\244:\020\"\304\330\331\001\342\210\202\362q\236\312\220\342\344\364\2652\362\002\255\n\337\255<C\230~\243/lc\004~^\020tA\303\3004\017\272~\341\363\264j\213\323"
+	.ascii	"SPk\301\321z>SZ\\i,\330\242\371\021\f\211\007\211YO?\224\312"
+	.ascii	"\276\f\311\013*\f\351\371\221\001\207\361\223=\016\204\333\203"
+	.ascii	"\274\323j008\006\203\3236E\207`\002\376hH\357\251\036S=g2\227"
+	.ascii	"x/\023d\234\025\253\234\232\250\016\210\227+\037\252\321e\261"
+	.ascii	"\332Lq4\036>&\032J\307\325\314j"
+	.text
+	.section	.gnu.lto_settingMinMaxTable.185.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\366\003u\023"
+	.string	"f_sC\220\334\312r\036[ow\210\036H\200#\300X\224?\250-\224|\241\202\022\360\006\347\314\220\fN&\3368\273f\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002\340@"
+	.string	"\233,\013\220a\222\022=\035\322\210L;r"
+	.string	"f"
+	.string	"Z"
+	.string	"\020v\021r$\364&\360P\350\2510ia\262\034\211\027v@\f<\266\f\275\237\006\237\260\rcL\034\200\200\277\016"
+	.ascii	"\206\212pR\036\246\332>\304\r\211\210MEE1\243'\020k!x\316\363"
+	.ascii	"<E\350\2140@B\250Dib\350\304XD\261y\024\245U\264-\037p\367\306"
+	.ascii	"\265\323\025\3445\t\365\265$\004s\372\005'{\363\2363/{\363\306"
+	.ascii	"\3071G-P\032\245R:\245T\214ZU\253^\025\253Y\325\352V\201\345"
+	.ascii	"jW\275\372U\260\242\006\211R\374\004M%\244\243\361\362\254\301"
+	.ascii	"K2-\207\327\023^N\226q:\347)"
+	.string	"`\3077\200\200i\026\230,I\245\0367\242\017\325%\351;@\227v\031\200LP\005\b\026\374L2\0206(s\220\364`\322\004\2523\203\310\206Br\303\304\345\236\233\3568\327]\374\254Y\025E\352\212&\225E[\324E\225\372\2420\032\243K\225\321\031e\252\2574Z\2436z\2438\232\243:\332\324\035\345\321\036u\252\217\376(\220\3766k\220\n\351\220\022i\221>\325H\241z\244H\232\244QU\322%eR\251N\265I\235\224\252O\032\343U[}5\326Yk\2755p\256\273\366\372k\260\203W9l+\213}\345\261\261,<\313Z\3362\331\\\356\262\227\277\f\346\262\303,f\263\307L\346\341e6\363\231\317Fs\232\321N[m5\257ym6\263\335\346\266\335~\033\356\270\335\374f8\007\200\216\2500\246Q\33230#\241m\036\020\030\364\266\001=\240\254\242\"q\270z\223J\341\242\b\031\242\020\333\347"
+	.ascii	"\353\030\231\345\311d\356SW\342Q\222\t\336\237&\013\361.\002"
+	.ascii	"\3273\263gIVHX+\366K?\235\331\013\204\356aDW\312\263\321\355"
+	.ascii	"\035\303M\213\241\275Q\376\266\005o\260\321!\361$K\003rp\337"
+	.ascii	"\317\254?)V\233X6\244\032\300\351\262Z\317Pd\006\311`\236\367"
+	.ascii	"\002\034$@\205\2430\367\273\336C\253\347\225\324>\004\021KHQ"
+	.ascii	"\246\032\325\005\365\343\366gy\210\244ad"
+	.text
+	.section	.gnu.lto_settingsTable.186.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\221sMC\001J\331\245iQ\020@\305Xs-\0208\222\037 JC\t\206\207\033\306\024E$p$kA\207#\371\260\205PJ%\034\201\355\224\242\352>\331\350\250\3660L\3679\f\323}\016\303t\277\337F\017\200 \b\002\304]\036\323\020"
+	.string	"\300\324KKK\266\227\226l.\331I\006\210\006\243\006\207\006/\236\266\177\352\"=\362K\213R\026'\323\366OW\244D\016$\005\nJ\332\376\351\017\311\211\377\245)\322\236\323h\373\247<\351\216\007IO\2449\247\320\366Oq\0340\245Ik\316\236\355\237\316\244/09.\202\351J\321\265\214)\013\315\366OK\220\244*%&)"
+	.ascii	"\\H!Z\344t\331\376(\021\224\320\007\005\205\234*\201\200>\004"
+	.ascii	"\365\003B\370\243\217\020\325\333\003\354\221\347DP;\036\337"
+	.ascii	"\267\375\321:\224\256\020\205\213\313\333\361V\004]c\243SKCA"
+	.ascii	"\217gofe)\250\330XZ\030\230\n\312\325U\266\245U\002\275\302\002"
+	.ascii	"\263\252ZA\245\246\264\242\240XP\247\032U4\232Z\320%\031\017"
+	.ascii	"\265\375\321\030\250\222\t\024\351E\223\213#\264\250\350G#\312"
+	.ascii	"Bi\005\021:\024\303\013\372\203\002\375\321\366G}`P\0364\305"
+	.ascii	"\243;1\350\211\034\037\034\364f\004\031t\246\350ZF\224Fg\373"
+	.ascii	"\2432$'%&\351\214\313\315\250K\321\247\214\350\313\333l\177\324"
+	.ascii	"\004\332R\252\214\370\024\r\252\202\226x\230\355\217\246"
+	.string	"\240(_5%\327|\022\022\371\225!\2036'``a\220\277so>\373~\b\372\340\223qN\274<\277;\036'\3169:=\271\270R%\347t{\263kcC\361+\363\251\343L3\341\266\377\211v\236q\351\2349\312\326\310\306F\220H\032q/\021=\300'\327|~\235`\346q\373\237^g\227\343\231\300sf\2358L\261\355\177b\235W)N\252\033\\S=\247\r\250\253'\025g\323I\303\224\332\376\347\f\2373\306\271d:m\377S\351\247T\231O\244\027K\333\377tArRb\222\002\311\314'\213\242k\031O#\244\355\177\026\221\234\224\230\244A\346\313|\n\r\025\005\001\t\235=\247\n\023h\373\237)N\236\2413\007\005\317\t\034\242\223\246\006gFf\305\351r\276\2302\333\3774q\266\234,\304\2423\245\350c\306S\245e\373\237(E\\k\304\247X\374\220'4Q\266\377\017\276\020r\320\350\203"
+	.string	"\016\376\001i\361>\276\257\374\333\376\317\367{G\345\331\374xy|w<\\\230q\363\317\321\335\311\305!\231x\363\273\275\311\265\261\341\2758\316\257#\255\r\355\314\307tH\372\260\371\311>G\211\266\375\177\354\305\n"
+	.ascii	"\343\265\346\357\362\"\343\332\302;\200\322_=V\351\265\375\337"
+	.ascii	"\352\253b\274\215\371\245~\252\314\332\376\037\365P\344\340\325"
+	.ascii	"\022\3512?\r'\252\355\377M?C\306'\315\037\343\227\312\247\355"
+	.ascii	"\377J\017#\213\351\217\\0\2650\232\0214?\321\212\244!!\262\246"
+	.ascii	"\347\231_\305\373\224F\333\377{>E\031\215\277\231?\007\205\320"
+	.ascii	"\t\034-'\263l"
+	.string	"\376\031\232\036\231\230\032o\302%g\373\177\313\263\374\312\210\313\201x\"2?J\321\247\214\237BS\244\020\357h\303\004\234M!\203.\333\337\0244\003\277\320\240L?\023H\251\262\375\315\037f_\324\335l\352\355\021\366\3103\361F|\n\0071)\270\331\244+:\236\321\254\003\234\223+\227F\3148\002\244M\251\315f\233[\337\3667\331\3145\2745\252\034\263y\206\226w43\313FH\231\255\266\033^\263\031&F\322m\177\023\314\374r9\037UX\263\251\265\365\206#\253Ty\263\222\232\315\033UiTSrW4f\363\311FY\r'g\033!e\340\260`\314\246\f&\260\245\030J#>\365\322e\031\315\246\013$\255\355o\036\361p\322b\004\t;\034A\263I\264\242jH\350N\213g6U\370@\365\244\310\333\262\231\315\234\242\217\031M\024M'pnF|\352\004=.\227\331\224\231Q\212\2011_F\\N"
+	.string	"|]f\312l\256\230,G\333\337,a\252\024\365y\225C\346\222H!\021\341\217\2572\310\\\006\n\372"
+	.string	"j?\260\222o.\177\370\351\364\371"
+	.string	"\022V\346\365 m\360H1\377`.\353\354H\030\272\022.ne\373\227;x8y\033A\242m\244t\023\321\003l\003\tdeZ\321\217\306R\255p\373\227:x8A\033A\3428R\236\211\350\001\036\211s\220nsI\226CpL\354X\2665\227^_~]$\\%&\251\013\233\271\331\\be\351]Y\371\361\350Rs9Ee'u\2663\227O6\340j,\315\345\214\2465&\036d\214 \021\202\216\022i.\223`\034\267\177\371B\2044ro.\215Z\210\261 )*1I\267\332\317\\\n\025}\312X\016qm\3772\250\004BaMg.S\024]\313X\366\\m\377\222\247\334\001!\005\266\262f.qNHm\377\362\246\264\241\241\315\265\3462\246\224q\332\376%L\371R\246\314%K\331\262\264\375\313\225\262D\251\202\252\360F\016\316$\221B\244\355O\022\362p2d\004\211"
+	.ascii	"\354"
+	.string	"P\231I\300\300\242 \177p\3366\223}?\200|\360\355\225\020W7\223xE\0373\222y<w<\354F|J\205A\216l\233\31189\034\270\035\244\333\b\371\326\2622\314\235\315d\232\232\214\0164.:\261\231\314Q\326B6\326U\2675\223^_\216\322\305\345eW5\223XY;\270\262\372\342A\332\230I\251\251\033l\1772\n\312\243F|\n\354\216\206\223\f\266?\331DrRb\202w\234\311%R\306\013\266?\031\203T\302\313#\221\212\316f$_\254\300\305Q\213\025z\254(*\001\021)\243G\002\221A\037\330\376\344\317^\212\236\f\360\354\360\221'\310\234\tl\177\022\207\274!mf\360A\306\024I\031#9\323\200\355_\302\220/\244\313\210\003b\365\221+$\313\001\266?Y\202Ta\341Ga\021\034\266\277\023\t\364\003\234]\310`\r\202\201%&i\210\032\200\370\001\201\341G\337\024\371\2077\273\336\236"
+	.string	"z\344\231y\220\261\331\353\212>et;\024\266\277\323\315\311\215\370q\005d\233\375m\007\210\355\357nm%&\251\013g\240\216\264\017\333\337\321\316\314F\374\370\037\004\275f\027+\372\230\321\311\334\355O\206\201}\rSR\310\324\3548\212\256e\364\255t\373\353*\317\"9)1I\311A\377\340\364\367\250\331\253\212\036et+\032\330"
+	.string	"\005\034\220\344\366\367\033<\234P\215 \221\272\324\210O\211\350\001FqQA\200\277\376\300\364\020\247\277N\347\264\236\211\002\257\220W\360\rD"
+	.ascii	"\331\013\344\257\320\357\345\363\321\nn\377w\357\325+\273\303"
+	.ascii	"\363\343ag&7\247\027\007\247\332\214\224?\3076\267\326n\373\277"
+	.ascii	"l\357\032\313#\242\007\370\fM\007\334\331q\004\211\227,\307\332"
+	.ascii	"\366\177\307HNJLR\255\343\375\002k\217\333\377\365\nL{\265\266"
+	.ascii	"\304pd\251\275UV\\7\250\326\240\242\256l<\215 \2617Rn\211\350"
+	.ascii	"\001f{\233hHm\377w\006\311I\211I\332\366\306Xj\235\266\377\253"
+	.ascii	"\364\302`Y\270\275.^\244vi\373\277Go\213\267\025EH\333\377%\""
+	.ascii	"9)1Iw\274@E\3272\276AE\333\377\375!9IKLR\270\367\355i\201\266"
+	.ascii	"\377\313\363\356\304\275'\336\234\366\305yo\336\227\246\305\331"
+	.ascii	"\376\257\314\033\243\347^\023E?\032_\227Vf\373\277-/\013\335"
+	.ascii	"\233\362\252\264l\377\027\245\210\256s\207\020\266(\203B\354"
+	.ascii	"\334 \305\362\314\350\002\016\376\001\031A\"\325<\\\037E3\305"
+	.ascii	"\350\366\375m\177\227\217\344$\275\313\353\301\207\207Wgw\267"
+	.ascii	"\375]:\222\223\022\2234\017.NnG\0176\267\215m\333\376\356\232"
+	.ascii	"\2536\344\241w\206\206v4\333\033##\023\013\343\353\362\362\342"
+	.ascii	"\332\362\201\225\225ue\325\347NQQm\177W\212\344\344\307\223\215"
+	.ascii	"\247\032N~L3\230d,\275\215\221\222\013HR\221\2241\2720\222^ "
+	.ascii	"\251|#>\365gT\3641\243\333\2025\332\376.\013\267H\375\031)\271"
+	.ascii	"\202\270B\356\020+\264\375\335 \r\350\252\360\351\351I\241\003"
+	.ascii	"]\024:l\316\366ws\334\023n\215k\303\322l\177\227\306\235\321"
+	.ascii	"B\334\027\030\326e\373\273.\256\t=\350\226(\226)Fw\205U\331\376"
+	.ascii	"\256\n\017')#H\350!D\n\t\t\207\004\n\002\002\006\321D~\370\365"
+	.ascii	"\365\371(\364\257\271\355\241\227\227\207\227\252\210\350\001"
+	.ascii	"\326E\332:\273!\335\366o\351\332\271\235v\007\334\333\233[J\253"
+	.ascii	"\266\226\226\246C\2455;\226\225\345(\321\206\211\201\201}\255"
+	.ascii	"\264[\\C\255\355\337j\2658\360XZ\253b\371cl\257\252\252np\265"
+	.ascii	"\264QRPP6\324 #\037f\202\206SS\323\f"
+	.string	"\227\030KJJ0^Z\027HGG-`\332\025m\321\220h\373\267D\355PL\373\003\344\343\243b\004\t\231v\207g\250\263\375[\235\026\305L{S\364)c\2133\264\331\376\255M[C\323\306\310\300\300\324\264-\255\211\341\312\366oYl\332V\245p\373\267(EF\220\220\271\031B\270\nn\177v\220\0252\205\023\004\320\357o\253\304$=\321\367Co\373\263>HNJL\322\034\266\207\236\335\366g\363HNP\330\361\200\253\323a\343\344\326\340v\3306\326m=n\177\226\215\325\221\266\212m\177\026\215=\223K\301\346([\271\266?K\306\216\375\261\207\375\002[\257\266?\353\305v\341\251`qhIea\355\210\350\001\366ao\024}\312\310V\255N\333\237\245b\247~X\033P\353\322\366g\237\330\032@\354\214\242k\031\331&\244\355\3172\221\234\224\230\244A\254\022\033c-\332\376,\f6I\210\305\314\036\271"
+	.ascii	"ja4\200!v\210%Zy\266?+\304\006\021\261<3\253\202\365Yq\266?\333"
+	.ascii	"\303\246\020\261\202\315A!s\002\247\b\035\232Y\232\232\225\235"
+	.ascii	"ae\306\234ua_V\224\355\317\232`[\214lfV\205-1\270\375\331\024"
+	.ascii	"\026\305[\f\t\211\374\r\031<*\335\346!` _\220?\037\366\375\270"
+	.ascii	"\363\301\2074\3441\017\363z\310\341\335\335\360b8G\327&\027\227"
+	.ascii	"4t{Ckc\2031\324\221F\206v\2464\314Q\346E6\026c\370\005\226\345"
+	.ascii	"\325\2654\304\241E\225\205%cx\243\352\211j\212ih\003\212\351"
+	.ascii	"\251\306\214\341\214\246$&\031MC\030JFI/\234\306\260\305\221"
+	.ascii	"\220\021\013w\032\016\021\365\b\005\325\030\252\360\311\351I"
+	.ascii	"\361\344\201\363\020\205\016M\316\t\2671\254\261q\241\231\201"
+	.ascii	"\272\231\207/C\030Ue\373\017]\206&\206%\206+\204\333\177\250"
+	.ascii	"2L\221Z\211\024O\026\343Z\230\002n\377\225p\035\202\267\006\n"
+	.ascii	"\366\001\006\241Z}\314\353\017\277\274>5\277\261\366\320\243"
+	.ascii	"\313\303\363\252Z\353\354\336\350H\310\267\022\023\253\025n\215"
+	.ascii	"K\323\266\377\272c}\273Zu\314\353\032[\231Z\332\b\022\251\376"
+	.ascii	"\303\3121\257f\305\0172\256G\260\355\277\226\221\234\244%&\251"
+	.ascii	"\257dy\315k\230X\252\265\375W\260\365\353(\210\003k^\265\266"
+	.ascii	"\252pd\215 A\350!V\251y\275Qt)\343Z\225Bm\377\225j\235B\361\255"
+	.ascii	"\365\311FS\r'\256\225\251x\356\031\327\031\251\322\366_e\254"
+	.ascii	"K]k\022\214\243\027H\345j\324\202\210E\321*Tt3\343:\344\023\004"
+	.ascii	"D\266\201\255;\363\332\263\252Hu\266\377\232b\345\211\013[m\346"
+	.ascii	"\365D\216\r\316M\016b\353\313\274\312\2543)\314\366_cV\030\235"
+	.ascii	"\303C\254,kK\272\262\375\327\225\265\004\031\341\254\026YQ\n"
+	.ascii	"\013\211\230\345\b2\253\202B\004\003\001\rP\3067\253?\374\374"
+	.ascii	"\372|Xy\b5\257\207\036\336\235JW\207\332m\177uN\225S\337v\300"
+	.ascii	"\271\265\241\251g\263\232\246\266\246\003-J\207\351P\305f5G\321"
+	.ascii	"\245\214j\331\221l\f\317%\315?\230U\257/\261..WS\263ppa]\255"
+	.ascii	"\231J\263Ju\343jJ\212\255<\316\352\223\rTj\373\2535T'\225i\206"
+	.ascii	"\223\214%\267\223eV\223`,\275@zS\215Z \261(\332\241\376\314\252"
+	.ascii	"\320PQ\020P\013j\212\036 \236\2358\325fVO\024\313-\243\232\203"
+	.ascii	"\362l\177\025G\275y\301C\250/\263*S<\367\214\352\f\212\263\375"
+	.ascii	"\325\030\025\306hN-1\253,-2\333_]!9\221\241#2\247E\212\037dT"
+	.ascii	"QZ\266\177ZHrRb\222\322\324\001\316\251\220A\024E0\3608c\347"
+	.ascii	"cN\375\200\f\376\350\323\261\341q7\247=\364\376\362\360N\256"
+	.ascii	"\021R&\347.nN\351\352\370\346\344\220FJ\025\036\274\2659u{\273"
+	.ascii	"kc\363\361\274\324lN\321\212.eLu\234r\333?=K\217~\024\352\001"
+	.ascii	"6\247cdmba#H\214\370\261H\217\253\370A\306\264\013m\373\247["
+	.ascii	"$'%&\351^Z5\247X\305r\313\230f\221]Y\215\035\361IMyEA\371p\252"
+	.ascii	"\221E\243\311k\244\344\352[\222A\025C\351\007R\351_\032$\035"
+	.ascii	"\222\022\252)\252\212jBuQi\324\032\025\205\252\243\252P}T\"u"
+	.ascii	"\205z\244\272P\225\324\030j\223JC\205R\243\324*\325J\325R\267"
+	.ascii	"T05L5S\217\352\232\312\246\302\251q\252\235\312C\325S\367T \352"
+	.ascii	"\237:\250\016YSV\225\325\304\352\262\322\2545+\212Ug\365Y\177"
+	.ascii	"V\242u\305z\264\272X\225\326\030k\323Jc\205Z\243V\253\365j\345"
+	.ascii	"Z\273\326\261\225l=[\321\326\266\325m\225[\347V\036\353\335\272"
+	.ascii	"\267\362\255@\326\277U\310:\270\026\031\242\fY\206-\303\230\241"
+	.ascii	"\314\360f\2103\334\031\362\f\177\206@\303\025\303\242\241\213"
+	.ascii	"!\3220\306piHc\3504\214\032J\r\255\206W\303\255!\3270l(64\033"
+	.ascii	"\036\207j\303\265\341\216!\334\260nh7\324\033\356\r\375\206@"
+	.ascii	"\206\202C!\303\302a\021v\205eaa\330\030\326\206\275au\330\035"
+	.ascii	"\366\207\005bW\260E,\022\373\202]be\2604X'6\212\225b\255\330"
+	.ascii	"+v\213\345b\303X1\326\214=\262j\354\032\373\306\356`\347X:\366"
+	.ascii	"\216\305c\367X>\326\217\005\302\006\262\202,\021\266\260-\321"
+	.ascii	"\256\264.\355K;\323\322\264'\332\2346E\333\323\006\265B-\213"
+	.ascii	"\326\250}\321&\2652Z\246\266F\373\324N\265T-V\233\325v\265^\355"
+	.ascii	"XK\326\236\265h-[\333\326\306\265r-\217\366\256\335k\371Z \355"
+	.ascii	"_+\244\035l\213\270(.\213\333\342\306\2702\356\215\213\343\356"
+	.ascii	"\270<\356\217\013\344\022\271+\334#\327\205\253\344\306p\233"
+	.ascii	"\\\032.\224\033\345\336p\253\\\034\256\226\373\345\202\2719\334"
+	.ascii	"2W\207\233\346\272\271o\256\234;\347\362p\357\\=w\317\375\341"
+	.ascii	"\372\271\201\256\240K\304-|K\274+\357\313\013\363\326\2746/\212"
+	.ascii	"W\347U\361\372\274B\357\320\313\3425z_\274I\257\214\227\351u"
+	.ascii	"zk\274R\357\324{\365b\275\\o\327\033\366\212\275e\257\331\233"
+	.ascii	"\366\252\275o\357"
+	.ascii	"\216\227\356\255{\363\336\036o\337\373\343\r\362\002\276\204"
+	.ascii	"/\021X\005.\001\273\300/0\r\\\003\347\300(\340\036X\005,\004"
+	.ascii	"\017\301Fp\013\370\005\234\004\313\200\231\340\032\360\023<\005"
+	.ascii	"S\301Xp\026\334\005{\301b\360\030l\006\037a5x\r\336\001\303\301"
+	.ascii	"tp\035\234\007\367\200\373\340\0370 \034\b\017\201\tc\2248%n"
+	.ascii	"\211M\3042\361L\214\023\237\210y\342\0241P\034\024\257\210\213"
+	.ascii	"b\0271R\034#^\212\233b\0321T\034\025W\305V1\216X+\376\212\301"
+	.ascii	"b\2628G|\026\243\305lq[\034\027\313\305<\342\273x/\346\213\201"
+	.ascii	"\304\177\261\220x0.\"\243\310,r\213\f#\307\3105\262\215\234#"
+	.ascii	"\243\220{d\025r\220,$\263"
+	.string	"\220\215\344\027r\222,Cf\222k\310O\362\224L%c\311Y2\227\334%\213\311c\262\231|\224\323d5\371M\336!\323\311ur\236\334C\376!\373\311\201\262\240L(\023!\246\020U\210&\210.\304\031\"\r\361\204\rD\036b\n\342\017\021\210\270\202XD<\"\272 \302 *\021g\020\233\210O#D*\021,@A\032\333L\224\"N\305o\333\237\030E\204\"\332\030\361\251\020D\247\032i\333\237H\203\344\204$\312 2\305e\333\237\270D\214aV\022_\020\223b\260\355OD\"\032\265\320\332\376D\026$'%&\351\023\207\210\342\252\355O\024\"\006\235D\025D\237\030j\373\023{P\"q'n\332\376D\024\304\234\327\232\21178J65*1F&>\332\376D\030\342\213\327Jd)\372\230\221\330\022\023m\177\342\n\261\304\260H\321\265\214D\224\330g\373\313\205\254<(\017\211u\266\277,\244\225\203"
+	.string	"\332\374\001qe\037}1\314\366\227\371\344=Yo\304\217\257|\207\027\257l\177\231\207l\347GX\226\223\347\340\302\355/\307\311pQ\261\334V\364)\243\354&\310\266\026%\243\351\360;#\346(\323\333\3762\031\311\311\324\007\031\254\350cF9\f\266\333\376\362\227\354\365\201\254\265\005\303m\177\031\007\bVWkU7B\220\243d\251\343\366\227\241d\033\"\3104d'\261\355/7\3113F\220c,q)\301"
+	.ascii	"!\273@\272:jA\202\274\242H\212hh\004\211\021?\212\350\001.\341"
+	.ascii	"\007\310i\373\313>$'!x\212~4\312)\340\245\355/\357\310:&\310"
+	.ascii	"8'\220nN\220gd\032\270h\373\3132c(\310.E\3272\312/@\333_6ArR"
+	.ascii	"b\222\246 \227\220Wx\266\277\254\""
+	.string	"\247\374\315HY\243BL\244\020\207pH\034((\003\030$\376\021\373\301-\333?\356\213}\304=\364`\224<\274\021$\322\021\364&\256\263\033\244\233\333;\340\376\336\334XP\213\327^\276\355\037\247\305:Z0;\336m\377\270,*\026\213\307^\271\355\037\207\275\320\025{\275m\333?\346\212\267`\300\312B\273\372)1Ic\210\251n\220MIM\311\020?\025\375h\214m\274^\333?\256\021;\315\0203\315\310\222Q\246\320\020\303P\242Jz\021\267\210\217\336\247\355\037\033\305,j\210\207b\"\246\355\037\013\r\212\210}~\336\244\355\037\253\210{V\233\021\237\212uv\214P\344\30467\257\320\366\217kb\232\030&\216y{\266\177\374\022\273x\305+1\313\233\263\375\343\022\261\212\027\026\241\331\3760\021\222\2234\007!\203\257\213\240\016\177A^\225\355\017\003\201\375v\200\371|\020\356\351\301wx\200<\354\352F\274\315"
+	.ascii	"\260\334"
+	.string	"\\_\\\340\001\334\336\362\332\330t\300i.\335\366\207\321\340\263cU\216\262\267\355\017\223\221\234\224\230\244V`ai\333\037\376\"9)1I\257\266\270\312\266?\254\005\343\300\202\255\340+\027l\373\303U\360\215\251\254()Wk\373\303P<\3006F\220\030)\271p\3004\234\252\232fh\3011\226\\\250\355\017+\3010\266\\\024]\313\b#5m\177\370\210\344\204\013.b\341*m\177x\005L\324\005\003\025\375h\204\203\334\243\355\017\377\300>e\212\027\314\223\302%\332\376\360\016\254S\246|\3018'\\\237\355\017\337\3006\260\314\214\253\263\375\341\030\030&\fn)\372\224\0216\341\332l\177\230\005^\021\203Q\340\024\027f\373\277E\336\302\261\301!\356\312\366\017ZkW{\255\375EN\221\337\030dY~\255Qp:Y\326\332z\3552\310\030m\002\251#\001\371\265&2\300\0020\374A\f0\fw\240\003\035\340"
+	.string	"\312\201\0300\320\202\026\270\213\021\2143`\301k\255Q\026\274N\301{F\030a\204\021>\020\361z\204\357\020\361d\220\247\020\361Z\353\030H\236\350q/\t\t\r\b\034\224\360Z\223>7\270"
+	.string	"\210\013\274\326\272\204\013<\t\177!Q\274\366\251\0214\274\340\0058\3573 \334\345}\246\004wy\301k\037\342/\314$\004\274\326\036\204\200\022^k\377\001\361Z\233)\030`\205\327)x\213\025^;\213\0130P\303k\255SP\303kM\266\254\360Zk\025\206\257U k\206\257UpB]\303\360\265\n7\324\2602|\215\002\371\263\202\220\232'9|\255}\305\001 \\n\370Z\257\251>C\360\301k\267\002\344\321k\215\201\034\334\n\214\300Q,\340\265\326:\244\340\235\315\231><\231\344@!\310\027\276\242\230\200\003\274\326+ \301\n,\257\035\312\271\336%_\\\345\352\265\276\201\007'\f\026\340\265v\226\035\236\204q\025;\274\326\246\013v\330\341sp\030\267\361;\220E\344\320k\355p!^\b\021\203\327\332yb\360>\224B\f\310\327Z\277\360\302I\303\232\276\326\332<_\353\027^8iX\323"
+	.string	"\274\326\346\031"
+	.string	"\251\327\356C\316\274\326=\350\036\364\320"
+	.string	"\031^\217\320\203\006\310\360Z\203@\246xm\252"
+	.string	"\226\341I\036\025\3002\324x=\373\231\r\257\265\n6\314\257\035\311O\274\326\336\022\302k\034\310\234\020\336U|)\204\327.\324B\b\257]\247\205\020p\274&O\200\bA\237\360Z\353\023N\365\265>\001\0055x\255k8\241"
+	.string	"\257\265K\003\024h\300\226q\251\200\262d\313\270T@Y\262e\\*\240,\313\362\331\024\002\317\256\020x\366\204\300\263"
+	.string	"\210\3117\267\327\232\250\335\367\001\257\211\256\247<\340\265&\276\347\317\3400\004 _\223\300u\220\3577\244\r\211e\365Z\2373x\211\327\232\204A\200O\327s\006\003\230\257g0Qp\202\177\224\215Q\001\250\245\377\2631\t\002(\375!@\202"
+	.string	"\312\362\357\237\215\321gc\022T\322_\377\tH\377gc\023\250\244\353\275v5\003J\bP\276\326;\020A\314\242(\313\003\257\265\333x\3405\361e\200\007^k\227DyM|\025P~\n^\344\003\344\247@\262@\341\003d\325\215\367\243\021Zh\303\306\300^\263\020\0017\321\276f\001\006%\264\3770@a\200\222\345\370\027\201\242&\264\3772\b\201\004\023\332c\231\331\373\016lB+\366\332g\210h\177\002N\304\006\027\264{\034r@\266\360\327\033 M\370\2232\244\222\220\026Z\b\200\2776]\b\200\277\326\003\230"
+	.string	"\337\336\353\001L@\007\376\332\001\037@\004ywr\341\203\277\016T\340\302\007\300\237\200\343|\360\3278\324\340\203?\nN\363\301\307k\315\302\007\177\315B\004>\370; \207\b|\360'A\016\021\370P\372\207p\257\322_\005\033Z(\375Q\030\200\337\353\r\214\224\376;\020\301H\351\277\001\021\374\350{\020@0R\002y\375\202Z."
+	.ascii	"\004\351\257C"
+	.string	"\224"
+	.string	"\002\bH\177\r\202\013\244?\b\036\203\364\327\344J\217\327\003X"
+	.string	"\351O\252\310\301\335\223.\264\001@(\001\357u\210\020)Pa\005\021\362>\005\020z\003\"\220\376,\224 \002\351\017\202\013\"\220\376\346\271"
+	.string	"\347\341\201\257O8I\177\255\365\254\201\327Z\257@\003\257\035\215\007\030^{\032\0170\274G9Q\021\206']H$\030^\3535\205\341\246K\003_t*\262\347\265\253\001\377z\2234\362\265\235\327\232T\311\300k\022.\223\201\367'\227\311\300k\036\240p\002\277\276\001\205\023\270\346\265f\341\206\f\264\2756m@\003\005^kSm\242\300k\323iP\340\265\306\301\215^kM\002y\235\317\275\326Z\233\274N\301cL\336\225<\306\344\265\316\201$z\2555\271\342\265\326\016\343\265\326%\330\257\265\347\354\327Z\337`\277\326Z\207\375\332\006\035n\330o\003\034\310\022\373\275P\207\022\366k\r"
+	.ascii	"GyM\n9\312k\277r,\347\362.\317\341e\256\346k\016\347q\316\303"
+	.ascii	"\357\234\317}\370\237\007\361!NH\242\220)d\013i\202\244!kH\024"
+	.ascii	"\244\016\251\202\364!\205\310!\222\005iD&\2210H&r\006Y\203|\""
+	.ascii	"\251\310\033$\016R\213\004#\303H3\362H\256\221l\344\034IG\366"
+	.ascii	" \365H?\022\b)H\n!\213\224(\245\211\322\245\234)i\312\234\022"
+	.ascii	"E\251\242\364)\211\312\025\345Q\351\242T*c\2244J\247\022\252"
+	.ascii	"\214*o\224U%\216R\253\004+\303\312\262\322\254\\+\331J\271r\256"
+	.ascii	"\344Q\336\225z\345^\t\244\374+\205\224\203e\021\023\305l1M\230"
+	.ascii	"4f\215\251c\356\230?&\220Yd\2620_\230I\346\f\263\311\2042\243"
+	.ascii	"L+\363\312\3442\273\3141\223\314\324a\246\231o\346\016\323\316"
+	.ascii	"\344a\362\231>\314?3\2109\304$|\225/\361/\017\3635o\363:\277"
+	.ascii	"\363?\017\364E\317\342\221\376\305\313x\246\257\361OO\3657>\353"
+	.ascii	"q\374\327\203}\331\233\275\332\257\375\216\207"
+	.string	"\373\272\267\373\036\257\367?\336\357\003_\360\211|\341Y\342\\9a\316\230\323\346\2749u\316\235\323\347\3749\211\316\025g\213\363\350L:a\2342N\246\323\351\254qF\235Rg\325iuj\235[g\330)v\232\235\307S\355\\;w\234pg\335iw\3668\365N\277\023\310)x\n9\013\317\"\350\n\312\202\302\2401h\rj\203\242@u\320\036T\005\032\204\n\241Fh\0134\t\205\2012\2413\320'\324\006J\205\336@\263P\034\250\027\372\205\222\2419P4T\007\332\206\272\241r\350\034z\207\342\241|\250\017\364\017\r\202\016\242CR\2244%mIM\2441\251Lj\223\336\244(R\235TE\352\223\n\245C\251Q\332\"MJa\244L\351\214\364)\265\221R\2457R\034\251V\352\225~\2459\322\2624-UKw\244p\251]\312#\335K\371\002\2128\250\024\203\247\327\362D\310\306\204\006\002 \005 h"
+	.ascii	"\303\032T\f\306\243(\225R\366\024\200 aP\026`zxN\267\026\243"
+	.ascii	"K@\330\003S\213\205c\352\274\302\264.\344\266o8o\224\377\300"
+	.ascii	"\b\347\345\027g\245\202\356:\233\344g:3\251\260O\203\252\202"
+	.ascii	"\227\303o\252\366\017\366/\225y\227\351\235\231\330\017\013\201"
+	.ascii	"\216\352IVr?m\032\316\317a\265\224\036\300\376/\352\224\324\350"
+	.ascii	"`\262ag\013^.\374YN\214\324\3012@$\240T\305\373\315\030\264\377"
+	.ascii	"\344\330\353ou\311\213f:\251s4\340\322\234+\345\013\316\241C"
+	.ascii	"d\177d;\336\246r\211\225\024\205\273\254\001\236W\311\362T\021"
+	.ascii	"?ZK}\013\243\024\254\334\3551\fs\344\214s\003s@\206\334\203\364"
+	.ascii	"\034\200o\344\324/\030@r\343q\bN\213\240PW\027\022\231\240\347"
+	.ascii	"\274\206f[\346\234\317\255\2158y\b\257\246\205?y\335\254\233"
+	.ascii	"G\255V\235\315\007H\2176\277sr?YcA\314\311\016\026\232s){\336"
+	.ascii	"\303s\337a\201\377\013\374\277(z\331\333\177\214\230\277\205"
+	.ascii	"\200\202&\376@\233\037\336E\306\371Eo\013\251~\200\327l\356\351"
+	.ascii	"\241\365\031\002\251\361.\211\371k\362\001y\351\327\373\325U"
+	.ascii	"_\241N\343\374_\260\360V\222\356>\306\203`Y\362F\374\374^\276"
+	.ascii	"\177\024\221\316\273\244W\367{Zl.\301\247\340YK#/\253\360\376"
+	.ascii	"\2259\377\376\310\272\316\025\377ko\t\351\354\377\302\245\362"
+	.ascii	"\310\357\002\211Ai\257\341$\033\271\227\\\321-\330\356\032\007"
+	.ascii	"#\352\f\300\270\003\234\357\r\307\215\262\004\013`$}\241\273"
+	.ascii	"\027\307\202g\277\"J\236x\273\321\262\2627"
+	.string	"\324\021\317\371L;\035/b\336\006\037~\255\013\037\254\023\266\223\233bN:U\353\030\206,H\336\241mVD\007\350\311\263\264Hf~\371\263\242\355j=$\317\310\316\345\242YS\220\016\n\256E\272\337\260\325\266k@\237A,\350\3122\203d\271-n\022\2619\264\017S\246\201\027\221cd\250/\277s]A\005!\237i\b\025\302\362\216G\361c9\001U\214\034\004\344\001+\314=-\235s\361\207\375\336\271A\222\\[pL\377\336\272V\300\371\035\317d\346\177\363\202\203\001S\301\320\017\363\310\243\n\3030\223sE\3131\224`M\264\360\207\210\025\243\234\304\310\006\322E2\351y\233cC\320G8.\324UN\335^Bd\374\221\246t\242\034\254\177\222Fd\255\240\0370\335\234b\336\301\365\2100\322g\213S/\216&G\253\320(\362N\3327\314g\241k\007B\202\247\301\215\320\311\314\265\371W\273\313\205[3"
+	.string	"\304x\326\221\f\200+~\320\231\033\366\357\021\226\315\331\224\356`\323V\"h\270\227\224\200\261\032\025\324\304\307\031\223\336\027\213\bR>\222\220\233\030\341*\"\246\256:5\037v\210\256%\372_\253T\356z%]\340O\177\274\234\327\374\023}\235\264\262\262\3407lF\247\236\244>\323)G8\240\307HD\237\2141Z,\315\214\006\377\367\310?\004t\351h\350\275`\323"
+	.ascii	"\270\306Q\003h\262\222\347\nd\261\344\274\037]\216-z\200\304"
+	.ascii	"\334\224\350\031\365\373\250jN\231-.\fI\002\177\340oL\030\027"
+	.ascii	"\333\027\322\034mDSi\302I\353\212!n\201\013\350:t \362;\261\316"
+	.ascii	"\357\350\200\376\232\267V\254\304\241\231"
+	.string	"-\210\034\001\205\037\362\376\324\215r\223\327\200\034\377\311\270\367\204\222\030\340}6\263\335\016T*\252\226\336\275[\236\035\201\236\220\231L4\fX\266|C{\350\234\331\307\207\234\314\331\366\262\302\213\372Il\365^\224\022l\275G\b\216wP\346w\332\266\273y\331\361\213dK\016\255\234],|qj\350\267(N\323\005`\372\2577\221\035&Uc\370\313\363\273$H/\2250T\252\321\335\201\246%\334\251{\377f\335\217Y\034c7i\321\377M\230\b\366\302\356\001\t\335D~\250\340\364\372\252\276_pe\313\355\232\263\314Y\373\005gK$\321\306\356\254vpn\342\271JzQ\240\377\304c\243\004oC\257\022R\002\b\277O\253\365'\367CN\013\262a\027E\307\356d\"\n\247~\331!6\353\270-\b\247\204\356*\037\256\032\214\327\017\264\202\277\343\235\021\361\273\n2s\250\256\311\245Zm\002d\tCY\366*"
+	.ascii	"\340\337K\265-\023R\260\034q\022')\203s\tf\277\220L!\277\276"
+	.ascii	"\033\234\035\2166\270\370\222\256\375\353\200\315\372\204g~\371"
+	.ascii	"\260mJ\223\200\370\375\264\271d\211\255\304R\021\247ul\211\311"
+	.ascii	"/p\241\343\300\034}4\360\252"
+	.string	"\223\274[\260\232\331,'\212S\331?LV\200\332\261G,\3062\372e\265\307\247\204\312\375'\335\317,wQ<)?|4\330\236\342\223J\304\346\2222\264i#\b\350\223\3059X\355\263\226h\365;\337\035U\225H4\\4+\221.\330m\243\3149<W\307!J\337\370\311_\002\001F\001G\327\340\334\032\r\335\221\225cR3F\275F\346f\004\304\365\351P\247\240`C\276\354B\377\177\252\231hX\221\253\004\034\2229x\304^\302\277\207Y_io#3\301\247[\033\367-\004\250\235\313\202\3340\225\257\353\2414NX(\220\004\376\235dX\301\t \251\3751(Z\037\303TA\203\033#\225\\\216\350Vz\260\275m\214db\311\322e\315\276\032\267\354\317\030\007\314G\333\004H\024\017\2771\020X\307\340\306\017n\2143\301-C.\261E\341\311\300\361\374\336a\221\273\343D\223oW_,\321}"
+	.ascii	"8\272\251\214v_R\361y\001\306w\237B\253\236\346Z\034\307\261"
+	.ascii	"\363\fB\322^^:\241Y\243\346\202yy\t\354V5\035&\3753\363\215\346"
+	.ascii	"O{\264\353M\026\333\277\020\207\240\247S\206+Y#.\214\244\026"
+	.ascii	"\265\013Q\340\2509\336>Sn\022\363<\261v4I\236?\177\321fE\222"
+	.ascii	"X\337\243\235\232A\307\321\254\242\r\302\270d\332\256rm\246\234"
+	.ascii	"\332+\254\216J?\n\301\267~\254X\216\027?\t\226I\"\"\230\220="
+	.ascii	"\tEf\236|\26137\321f\372LKw#\314\347\tv\327\266l\006\036\372"
+	.ascii	"M\036\f\355\277z\r\345T\302\016EVrHl\342a\307\313\362-\r~Gf\244"
+	.ascii	"\2451\303l\373>k\032\374\254'\315\217B@p\256\244\361*\271\251"
+	.ascii	"\004}\264\262\323\270\224\355#\237\320\355\026\\\312\253)\304"
+	.ascii	"\235\240\344\0047\3749\312\321'\315\332G96\240 B15\363\260\346"
+	.ascii	"v\346\271>j\017\002\212\214\t\273\331\226\030\034"
+	.string	"\300\321\217\311\250\"I5\"\006R\357\037\260{\244j^9\350\003\264\342\346\331\247\331\311>\322\356j\004,\256\356\301\b\25574\035\003\313\001g\316\372\032r\205s~m[+\345\300b \202a\250L\273\006\326\033\217\303t%\0321r\274\235\271\004\335\365\022\255\375q&\013\211Ct\276\273Q\273\212\007&\270\312Qr\252\350\344\375>\343\342P\350\304\004n\235\321Y\233\302r%\n\247\007s\2141\355\214\231q\320\320\343\354Xb\t4\200\255\tL\332\nl\315\315o{t\227\361i+\236<{\261\236\310V\026\277\204{\257e{\231m*\252\033\033M\376d\026~E\023\204\315\345\305\367!\256\361I6\245=\211O\305\006x\3006\251F1'\316v\f\356\333\002st7\274 z3T\206#\3261\317\327\311\2657\367\24788\303\024+A\300\257EGde\274\254\375\250\237\026\2745\326\343\303\263A\320\202"
+	.ascii	"\246\212\204\323"
+	.string	"\225\002bI\001\346\362\311t\032\370t\233\335\274|V\005e\r\231YI\212g\240\204*\275\024x\246\305\365N\213\t\210n\262\005Q^<\310\211\276\235\213l\356\322\200l\373%7\206\b\224U\260\337\215\233d\004\276\362/\201\330\204\335'\223r\t\245mC\341\276x\004*\215G\351\345/mX\325f\373s@\207\203\340\032\345\254\257\222\345\324\306\241C%\336Fjqm\243\373\244P_6\201c]\355p,;\261\254f\250'0/\032\024\256HH\213\374llD\213\031\345Z\211`\022\300\366\354\236\246\221\347Q\311\001\2139\2053\207\246q\021\364\343<\2677\311;\231\0035\302*\302\027\032\273r\334\353m\002\370|'-\247\212\246\\J\224\037eD\316\322]\001[\237\267\375O}\323\325TEL\344\223\200\215\205|\344\r\231dq\026\242\322|W\250\214\031\205u\315\017@\n\267\230\3178d~z\222\305\224"
+	.string	"\302Q\333\346b\252\243\236k\033\334\203\222"
+	.string	"\\\266\001e\370\373\367+B\341\201\302\261\317\275\\\005\312\1778\214J.Y-`\273\272\272\035\346\303k\277\367"
+	.ascii	"\322\006F\202\034\207\032\255Zi\227Q\351\231\300[,\n\212\024"
+	.ascii	"\241t\356\364\270\322\303\034\300j\346\346\210\200\005\276\323"
+	.ascii	"|)\206s\036\001\002\327\203\252M\244\250V!\275+N,\002i1\201a"
+	.ascii	"\275\312*\236\2445\027\204\272\272'\243\021)\247z\337H\201\022"
+	.ascii	"kO\321\251\343\256\t\314\313\241\222\230\264Ury*.J\315\376\263"
+	.ascii	"@s\001\306w\363\t\261b\343\271X\355\202\304A\376\357\021\203"
+	.ascii	"C\206\270\200\375\313\017h5\275\021\374R\177"
+	.string	"O\365\330\355}\363Z\202\016\253:\021h\016\215CL\243\330\334\231\277\302\355\277\247\002I\346\377`geg\357\2113Y\344\342t\236\315p\362\002 $\345S\272A\255-\377\n\t\210\377\027\317\242\023M\306\217\nn~\b\301\370\026\345\336\2524\223\332r\337\274\231\346\231)\2173\022\020\325h\"=\330\262\361\307&b\2221y\020M\242\"\025\216\352#\264\"\267&i\255\315\306\333zwI\326\267\303Q\375(W\344\3268\3316\001<7I\305\0377\031P\211t\200\233\377\217\005\341\f\275\31353H\251:\205%z\272[\274\227\001\332\351\"\322G\317-bZ\222.\356\301\372\202\300\323&\333\023\215\335M\023R( \327\264\372\330o)\"\355\024q\017)\363K\311|\327\006\363OeJ\226y\311[\205$l\264cL5\311\374)\365-\t\271\373m\235>hP\234\251\321\021\023\244\006\213\004]+\277\212\237X"
+	.ascii	"?s]\370w0A\2619!\300\0173A6\260\323}\204;\360p\345\350"
+	.string	"\236\005\036i\254\311\301\232t\034s3\375O\251\267\352KG\333\337;:\277k\304\366\224a\347\267:\360z<^\316\332\037l\262\324\376\375pg\236\244\217\004G\307\0056\305\261\342\257;8]\257G\320\222R\007\204\3039\202\213\321+\t\231j\377]\321\350\032\230\233\rY\215\304\254\2661\265\367\235\241#\356B2x\364\236\320\354`LG\256\344cI\255\372\330\224\233\030d\211[\353\013DVe\036\233\307\242\3463@\266\244\320\211\244mt\277\235\023i\371FS\025\254\b\276%T&\242\237\263\321\310p\222\314\266\325\214n\314\310E\237l\037\231\3518ugl\\\261\337\362\205\033+[\333=y\035\376\263J>\331\267\210\3511[`\231)\205\341{\222c\367\235p`I1\030p\232\003\021\021\031\236\204\363\363\007\374 *\225\243]\301!\213O.7\025\305\031\321d\304\213U\351R\306\335\266&?CN\323H"
+	.string	"\351\307\270t\241\251(\254\r\017Z\240\3549\253\237J\203\266\366\253R\305\276\365\375Z\372e\206Lg\002\326\n\036\332\007\242\005H\004J\245\002J\224\236\027\205\245`9\327\007\032\033.\246b\325\037Oo\265\313#\315|k\364d\2528\302\350\342\202\240\037\326"
+	.ascii	"\203\331\243\236\375`\325\312\265\226sB\220\253\377\n\265\017"
+	.ascii	"\200J\343G\205\231\276\266\3323\206?\001O\n\333u\345\f\031\025"
+	.ascii	"L\272\350P\371\215\211;c\23122\022+I\361\232\304\303q\346b\b"
+	.ascii	"\2241\333Z\316f^\017\tNh\\r\364\347O\310\242\255\027\003\206"
+	.ascii	"\253\323\322.\362\030\023\335\n\310M1\315\260\324|\263\346\274"
+	.ascii	"\031%\032/\376\356\n\271\343\037\261\311d\251\\\3056'b)\234p"
+	.ascii	"\0309\223\t\244\031\264\215!\206\241\212\315\240\344\334&\243"
+	.ascii	"I\005u\203\276\354\376\352\245\032A\266\322y"
+	.string	"NC\016\217j<\267\037\2734\230\037\036\204\376\375N\313L\023\372\006[\2426I\247^\253\316\202f\373\027\240\204\327*\254d\303\354\363\031\254\2707\242\356\203+l\f\300'L\277\316\327C\250\020\003\3701J\262\267\037\236a\323\020\372\350\331;\202\266\241C,\255,o\315\b\365\0227\261.j\317\224h\225\212\257m\\\303\032\003[M\324n\342oi\0079\221\223\331\212\034z\177 \"\364\214\217x\013E\320\f\177\0259\036\327\323g\025\204\303a\353_\343\030\177TT\374\244\"\035h\276\0039\244,\303\021hk\260\264T\201\227\037j3\021-B\004\f\344\370\347\257\276\240X\203\200"
+	.string	"e\005y8\333\362>\031"
+	.ascii	"\311\006S3Mb0\314\345E\227\344aFQ\211\337\020\330$m;\241\325"
+	.ascii	">\353E\226>}aB\210\225\350\216\374)\202\253\373\314\232\267*"
+	.ascii	"\354\2308\221\3243 ,\211\243\220\023P\251\347f`\003\210f}\031"
+	.ascii	"\013\272\265\341\307\224\320U\242a\257\020J\241t\362\2304#\236"
+	.ascii	"Nv\240\230\240\362\307(7\264cA\027\242\t\364\243\356\242mh%u"
+	.ascii	"\260\265VL\244\303\230\242\206\217\323\216d\344KK\331\256\340"
+	.ascii	"!\301\036\002-U\203q\203|\252\307Pah\252\336\226\336CE}\"\016"
+	.ascii	"\261T\304\240\231G\261\n"
+	.text
+	.section	.gnu.lto_settingNameHashSeeds.187.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \246\345\004"
+	.string	"\002\n%*@k\234\003\303\f0\315G\246\253`{\216\276I#e\340\313cW\005\250\3170t\020a)0(=\327z\251\221\210\b\221)\005\227\234\220\365;\374!r($MB\242uYh\315\375\200\255\021\3771\215pa\313\351\330\002\206\t\307W\n\257b\035L\312\032\030\b\303f\343\005\252\004\202\210\032<\f\b\205\371\354M(\200w\346]\177\016\r9\372\355\264\313cn\231\234c\323]\212U\276\335ifni\275W^>8 \241\263\303\306+\034\261K\331\302v\013\001"
+	.ascii	"\003(\002"
+	.text
+	.section	.gnu.lto_settingNameHashIndexes.188.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`%\031%^"
+	.string	"\032\237\030 J\200\020\261tB)]h]h]h]h]h]\350*\001H\200\016\230 '\300\013\023\256R\256R\256Q\3679\f\323}\016\303\364\237\3030\335\3470L\367\211\322\177hK\377\241\255\345\036\366\226\336C[\372z;%\231R\"\001\002\002\332\001\367\001\376\376\376\376!\035D\003\371\276\343AD\220\217g\206\236\f\341\223\037?a@\\\371\376^\"\b\030\364A\276\211\364?\221\376(\322?E\372\373\212\f\362\275E\004.\322\2058\206\256\362\375\213\322_\304\031\r\220\357j\371\236\224\376J\351Ki\371L\351\357+\371N\351\357\032PyQ\006H\245\277S\245W\225`\345v\225\216\225\224\357Z"
+	.ascii	"l%\016Wp\255K\307+\375\035,=\354\202|\377\261\364\240|/K\017"
+	.ascii	"\3117K?\013\332\241\245P\032\237\032R\376ZzG\276\177[:J\276\277"
+	.ascii	"\303\r\305\031\311U0\327\201\216\254\316\205|\273\364\236\374"
+	.ascii	"\273t\026<\241<\007\362\365\322\177/\235/Y\3645\345\273H\376"
+	.ascii	"_:`\020,\020\tF\372T~\214\364\227\221N\227\357\257\221\376\033"
+	.ascii	"\351\317\221\336\241\036\002\344\177\244\203X\205\264\310"
+	.string	"\367\221,A\222\034J\322M\0268\3117\224\224K\t\216\251\004\003W\322Yt\362\275\305\205\202\227\034\230\234\0213\"\337g\322\215f\247\206\310f\356\346\363\235C\320\253\203\276\344$\220N\221\207\300\017t \322C|\355x b\213'\337}\226\362\177\322\201\024hD\n$\236J\234\004\221`\242\206\023\032\204\002*\305\217\212\240\336\n\277|\026\351\337\"\335\205\342\b\361\344\017\245\023\371\025Y\275\3102R9\n\221\304\222V\251\203\245lb\352k\"r\022y\n\376AeIT\224\324\bS2\344S\245W\261Y\251\314UP\006V\013YA4\255 \214\255$\343\nZu%\t\257\025\2766\362\301\322?,\235&_,}LA\3108(#\3117K?\353B\213J\313#5\355Y\013R\261\201\264\245\217\033\2127e\201\013N\305\345\222\234\246\314\005\261\350\024\245.U\330\005\305\356\262\005\357+/X\2457\267\247"
+	.ascii	"\237G\237\342\371)\345\377\245\237\345\003\246w\262\346\344w"
+	.ascii	"r0\203\301\b\036\b\255\242W4\213n\321"
+	.string	".Z\250\207\232\250\213\372E\033\365Q#uR+\365R3uS;\365SCuTK\365TSuU[\365UcuVk\365VsuW{\365W\203uX\213\365X\223uY\233\365Y\243uZ\253\365Z\263u[\273\365[\303u\\\313\365\\\323u]\333\365]\343u^\353\365^\363u_\373\365_\003v`\303\350\030-\243g\204\032\341F\310\021v\204\036\341G\b\022\206\204\"\341HH\022\226\204&\341I\210\022\246\204*\341J\310\022\266\204.\341K\b\023\306\2042\341LH\023\326\2046\341M\210\023rX!\354\020\346\204:\241\207\360C\b\"\f\021\356\204\"B\236\260'\364\t\177T\b\201R\270\301\006/\r\021\216\032\202Y\357\357\357\357\357\357\357\357\357Z\371\376\376\376\376\376\376\376\376\356\351\357\357\357\357\357\022\244\326\0047\371\376\376~\201\032\006<\031$\220\357\357\357\357]\371\376\376\016Bz\b!\210"
+	.string	"A\276\2230A\t\026\230\220\376\216Bz\n\033\344\373;\013\351\357\357/h\220\357f\371\376\376\376\376j\024\363\217\322\337\223\b\310\367\245\022\246\364w\247\002\236\030\310\367\367\367w*\256z \337\337\337\263\202OZ1[#\\2]\351\357_0\344{\330\tbRcjdZ\226\376\376\376\376\256\226\276V\303\366B\333M\276\277\005\337\340\270\342\222\344\322\337\337\277.]*\337\377.\375\361\322?/]O\202\374\275t\263|\357\023!\337\337\363=0\200|\377\030\351\337\301\031&4\330\362\235\003\201\374\216\364\367\367\367w\217|\377\221\364\367w\223\364\023\032P`R\302\362}%\206|\177wI\1779"
+	.ascii	"\346*\246Nfe&\375i\322\337mT\270\311\032\034\f\362\375\003}\353"
+	.ascii	"\267\177\013\270\201\013cc\254\214\235\0215\342F\344\210\035"
+	.ascii	"\321#~D\220\030\022E\342H$\211%\321$\236D\224\230\022U\342Jd"
+	.ascii	"\211-\321%\276D\230\030\023e\342L\244\2115\321&\336D\234\310"
+	.ascii	"!v\2109Q'z\210\037\"\210\030\"\356D\021\221'\366D\237\370\023"
+	.ascii	"\201\342\210H\"\226\210A\321D<\021Q\304\024QE\\\021Y\304\026"
+	.ascii	"\321E\024\212C\221(\026\305\027\321(\036E\244\230\024\225\342"
+	.ascii	"Rd\212M\321)>E\250\030\025\245\342T\244\212U\321*^E\254\230\025"
+	.ascii	"\265\342V\344\212]\321+~E\260\030\026\305\342X$\213e\321,\236"
+	.ascii	"E\264\230\026\325\342Zd\213m\321-\276E\270\030\027\345\342\\"
+	.ascii	"\244\213u\321.\336E\274\230\027\365\342^\344\213}\321/\376E\300"
+	.ascii	"\030\030a\304\030QF\234\301\032\274\301\034\334\301\036\374\301"
+	.ascii	" \034\302\"<\302$\\\302&|\302(\234\302*\274\302,\334\302.\374"
+	.ascii	"\3020\034\3032<\3034\\\3036|\3038\314\201;p\016\353\260\007\376"
+	.ascii	"\300 8\004\357\260\b\346\341\036\366\341\037\006\342\021L\202"
+	.ascii	"Kp\020\233\340\023\214\202S\260\n^\301,\270\005\273`!\036b\""
+	.ascii	".\342\027l\304G\214\304I\254\304K\314\304M\354\304O\f\305Q,\305"
+	.ascii	"SL\305Ul\305W\214\305Y\254\305[\314\305]\354\305_\f\306a,\306"
+	.ascii	"cL\306el\306g\214\306i\254\306k\314\306m\354\306o\f\307q,\307"
+	.ascii	"sL\307ul\307w\214\307y\254\307{\314\307}\354\307\177\f\310\201"
+	.ascii	"\f\203c\260\f\236\321\032\275\321\034\335\321\036\375\321 \035"
+	.ascii	"\322\"=\322$]\322&}\322(\235\322*\275\322,\335\322.\375\3220"
+	.ascii	"\035\3232=\3234]\3236}\3238\315\241;tN\353\264\207\376\320 :"
+	.ascii	"D\357\264\210\346\351\236\366\351\237\006\352\021M\242KtP\233"
+	.ascii	"\350\023\215\242S\004\301\024\312\241$\312\242|\221Fy\224H\231"
+	.ascii	"\224J\271\224L\331\224N\371\224P\031\225R9\225TY\225Vy\225X\231"
+	.ascii	"\225Z\271\225\\\331\225^\371\225`\031\226b9\226dY\226fy\226h"
+	.ascii	"\231\226j\271\226l\331\226n\371\226p\031\227r9\227tY\227vy\227"
+	.ascii	"x\231\227z\271\227|\331\227~\371\227\200\031\23002F\312\310\031"
+	.ascii	"\252\241\033\312\241\035\352\241\037\n\242!*\242#J\242%j\242"
+	.ascii	"'\212\242)\252\242+\312\242-\352\242/\n\2431*\2433J\2435j\243"
+	.ascii	"7\212\243\034\264\203\346\250\216z\320\017\nBC\350\216\212P\036"
+	.ascii	"\355Q\037\375Q \035\241$\264\204\006\251\t=\241(4\205\252\320"
+	.ascii	"\025\312B[\250\013\025\322!%\322\"}\241Fz\244H\232\244J\272\244"
+	.ascii	"L\332\244N\372\244P\032\245R:\245TZ\245Vz\245X\232\245Z\272\245"
+	.ascii	"\\\332\245^\372\245`\032\246b:\246dZ\246fz\246h\232\246j\272"
+	.ascii	"\246l\332\246n\372\246p\032\247r:\247tZ\247vz\247x\232\247z\272"
+	.ascii	"\247|\332\247~\372\247\200\032\25004\206\312\320\031\253\261"
+	.ascii	"\033\313\261\035\353\261\037\013\262!+\262#K\262%k\262'\213\262"
+	.ascii	")\253\262+\313\262-\353\262/\013\2631+\2633K\2635k\2637\213\263"
+	.ascii	"\034\266\303\346\254\316z\330\017\013bC\354\316\212X\236\355"
+	.ascii	"Y\237\375Y\240\035\261$\266\304\006\255\211=\261(6\305\252\330"
+	.ascii	"\025\313b[\254\213\025\332\241%\332\242}\261F{\264H\233\264J"
+	.ascii	"\273\264L\333\264N\373\264"
+	.ascii	"P\033\265R;\265T[\265V{\265X\233\265Z\273\265\\\333\265^\373"
+	.ascii	"\265`\033\266b;\266d[\266f{\266h\233\266j\273\266l\333\266n\373"
+	.ascii	"\266p\033\267r;\267t[\267v{\267x\233\267z\273\267|\033\202\362"
+	.ascii	"\250\302\360\252^\266\003\362\013\"\226CHA\357\r\022\200\261"
+	.ascii	"\352;Z\260\323V\351F\036"
+	.string	"\242\310P 8\033\022\302\r\2711!/AB\033\fb)j=\340W\374\262\245\230\252\\\363\214\231\257\247\331L\267\267 8&\026t\274T\023\313\r\336\177\227-\275\362\333\222\243\3024|6T\005\\@\345R\310~n\370V\332\226\217\0261x4\225\345\332\304q\267\317W\016\354\360\224\024\346\231\266\331\323\203\2114\330F\304\216*\204i\tB\205\004\r\331\210\365\217g\325\\\324\320\240J\303\036h:\345\210\213\306\255\320\334\037\3359\335\236\221~\224\024\2018z\3670\364C?\"\274\003\3030\321\007X\026O\334\321\027\320\330o\266\337\003\267_\244(d\330\244\277\322!M\241\221\307Z\374\203\355 ll\245r\217\323\024\333\311\f\332\345\234\316\022\356oCS\312 [\035\350E,$\031\314\273\350\003\223\260\320\334\017*\214\025<\350b4\364e\005\250\246\257W\2729\t^r\364\344\275\0207\343\216q^%\350"
+	.ascii	"c3\0364DtL\177\376\352\2353\303\220gR\205\250J\314z\373\325\311"
+	.ascii	"\340`a\327w!\300\313Y\227\343\202\337\273,.\232.\367J\351C\211"
+	.ascii	"\032B\025+~;\272!\206<\226\037\233\214\323,{-V\2633\234\334,"
+	.ascii	"`\330\225\024\236\204z\330}\244#\306\311H\\it\0066J\270E\b\336"
+	.ascii	"\231\343#}\327[\232Nr5\227\250\020~4\001\020\225\336i\366\017"
+	.ascii	"\204\265\235\254Z\246l\037\027\267\227\223\311T\332\356\372\013"
+	.ascii	"\314G\352B\201\036U\226!.dxb\302\2254.\323l\f\333l\026#\344\302"
+	.ascii	"1\316\0164\273\304\b%F\237\244@(\260\006r\241\307\260\034;\266"
+	.ascii	"\267\226\264\322\302@\245_\274 \306i\004\003\027\377?"
+	.string	"\332s\251\013\266\344\227Z\333\240w\212{\202Lu\026l_\303\036\210\242\204R\240\206\254{\316`\224?A\227^\215\334\260\n\022\331\354j\2203\312\342\224%M\347V\347&\037\251gVsm\221\204\240\3704\364\214W6\326\321\320\0072\210\337\177\317\003/\013\364^B\030l\301n8\2104\005^F\n\314vF\251\265\r\214f\004\341\220\355G\024\3325\367\005\032\235\205\333#\004\362\214\332&p+\300\304xl\243\350\001\027\b~)\263t\213g\013\353\341R\021\306\177\2575\313D\313xE\227}\300hL\343\256X\301\230\033PK\001\350c\377s\2325\310\342%\035gH\362\f\337\262!\332\310\230\b\006\2343\256q-\367\026/i[\364(a\201\332\261b\023 \277\035\220\335\225]\204U\364\177\005j\230/\023\360\271z\355G\036\f\026\226\222d\307\351\326\030?E\245\323p\257\346T\306\220\n\036xU\242("
+	.string	"\251*v\251\032\321\253\3214Pxo\"\215\004B\017\321\303\017\336\374\233\325\025"
+	.string	"\375\223\255d1 A\276\241\"\034\246\366\021C\024X+I\177\360\002f\337~_\037b%\310\217\017\222\2362\322@\336\350\260\226\221\364\300`}\313\322\235\216\301M\"Y\026\253\304\220\177e\257<\316Ok\032\341(\225#9_^<\305\375,\005\206\254)\316\027\217t\0227g\\\026\004|\023\222x9S\027@\216\304\254\tH\350\277-CS#\364\"\254^R`\034\252\326\233\252\312X{`^3z"
+	.ascii	"\234\226\257\257ie1\306\271L\330\3658\3436!\204\344\276|@%\016"
+	.ascii	"\025\367k#\216\324K~2\370\300\366\007s\306\235JF\022\036\323"
+	.ascii	"\374\361\200\017\331\036DK\202\324\006"
+	.text
+	.section	.gnu.lto_settingGetWord.189.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\355\b\r3"
+	.ascii	"\212Z|\023D`^N:7D8!gh.\306X\036\006\255\215\227\0204\"\222\336"
+	.ascii	"\205\313\005\265\031\336\235\377\344\034\025\006{\013\307\221"
+	.ascii	"-xCg\244\311}\310\t\250y\234\366\335\227\364P\252\241#+3k\304"
+	.ascii	"\022B\344N2-\001\016\001%\001\314b|\271\323}\313\357Xx\354a\327"
+	.ascii	"\202\251\344\203\021$s\335\013\2542\031\024\340\226\360\335\273"
+	.ascii	"\354\020\207d\236\343&\324\033\234\205\365\351\321\n\222Y\013"
+	.ascii	"7\241\314\226\002\234|\250\360\271\367\036\237r\204\365X\003"
+	.ascii	"\331\313_\021;\026n2\360\336!d\364\356\275T\fa}\n\205\036\313"
+	.ascii	"\220\3262\237\312\253\210\335\312\213\033\357-\262E\357\336%"
+	.ascii	"\025K\255Oy\371\"\365\351z\"\365i\002\005b<\366\245[\r\006@\316"
+	.ascii	"\344\370\334\273\264\352#\334v\354BEb\320P\030\004\256?5E\333"
+	.ascii	"h"
+	.string	"\307\3700.d\327|\224\271\261kr\343E\"\020\024*\016\215\315\006\351=\300\020\033@>\f \374a\r\261\341\343A'Z\017\024\352\336\273f\201\277\373\200$ *}\206\330p\373\2122\360\303\307\274\023\215\007\372\213Q\343\355_\324\354\357\007ZtfU\035O\203i:\216\242Jlfp\020\323b\240\005\364n\225if\266\327\0337\242Slfp\334\211\206\004-\332#\"\347w\017\020\207\346f\355\017\353\336\313\226F\232\215\363\320\231\277\200\231M0\257X\001JY\320\260\030\352\211\352\347\035\212\214\352Q\375 \tWf\237|\275_\300\343\274\366\017\3355\352\333!\365\353\224\372s\267\366\017/5\026Y?\237\317gw\033\377D7b\3601v\021>~@\033e\201cf\375\360\357\216\312\241\365\271s\355\037\346%\f\333m\314o\202AF\nw\021\346\253**\344q\352\200\224\201\347\235\243n\345'p,\377"
+	.string	"\266\374t\346\331\351x\347&\246k9/}\356\254\224\204tt\273\263Q[.j\313"
+	.ascii	"\3322\321\317\362\320\317\2621\265,\324\226\213m\231\330\226"
+	.ascii	"\203T\313\303\266,l\313\301\266\fl\313\353\353\316\277\266\254"
+	.ascii	"\252\226\323\3242\332\226\273-[\325\362\0238\301\260\343tk7\313"
+	.ascii	"[\343\t\350\252I\231L\316\374\361\376\274_\313?\367\327\375v"
+	.ascii	"\3771\377\350D\362\275\360\277\260\360\270\206\0317\206\313\016"
+	.ascii	"\311\347\302\357r=\026>=\336\345\t]\263\267(|\367\336,1\310\343"
+	.ascii	"\205\241W\315\001\234\024>\020\353\323\007\2147\205\213\223\240"
+	.ascii	"\322\231\270&_\333\243\366\006\370C\352_+\271B\032\037Gs\376"
+	.ascii	"\236\2120\373\346\205\372\264\370&\317\301$P\361b\303\353\336"
+	.ascii	" HQ\217\365ajS;}\371\206\035\377u\033\003\223\351\201V\317\272"
+	.ascii	"\240S\335\224\272\351K\245\232Q\324\250\217Z9\240\227Z\tC\216"
+	.ascii	"\243\276]S\037\017\275\367^\365\200P\037\350\237\341(\266\020"
+	.ascii	"\261\203\272\330\266\231\354\023\022\273\345\222p\303\0162\363"
+	.ascii	"a\237\215r\315\230&\325\267\273\272QK\365\203\244\223\262\247"
+	.ascii	"\001a\033\350\0136\260\205\235\006J\002\022S\352`\253\315$\333"
+	.ascii	"\332j\003\333>\317Mu\355N[M\205\002\335\213\236= )O\365\361\236"
+	.ascii	"\036\246\242=\325\227;S\353F\273\233Qm\273\333\312%\373\312\332"
+	.ascii	"\366\317\372\310\354\223\371a8\234X\225\360[\250O\337?\243\\"
+	.ascii	"#\323\320\307y\355\033\r65(Zd\3523\"\277\324\312\353}\302\022"
+	.ascii	"4\305\253T\216\216\361x\245$\t1\320\030\t4R+\031-\036\365\357"
+	.ascii	"^`\315\310(\272\254t@\2717y\032F\255\214\352Y\007\333\342*\361"
+	.ascii	"\225z\225\310j/0\025\355\005\246a+L\204\372"
+	.string	"\005\306%\002\304\b\255\2570\340\b\257\256\026\250\213\021\\\315W\t\266\264\256\266D\\U\001\330\n\023\321\234U\365E\"\005\027\030\230\326\227U\326\226U\n\256\020(\254\262\274\276\254\252\222\270K\205\226\227\025XW\227\227\225\220\231yy\337E\030A\035\272\274\365\037S\177w\233\204\216\316\362\307\324\247\247f,\262.\023\3526\tK\336\210\307\346\240\245\346\341R3\265\222\211H\315h\020R\377\313%\304\2413\254\352$\nv\234\267?\267\026\365U\177N\222\231\026u7\313$\365\353\230\344\310\3613\243\330m}-\307>^\222\255\254y7?|z\304n\333\340\305\213\236=!A\335\306\3029!\262\037\347-H\325NN\315\337\313\020f\335\212H\324\252\372uH]\325?S\305\251\261\310\206\310b\0202\373\307\303\337d\031\271\335k\306\200\337\346n\264\320+y\312$\270\324\323x\312\347R\237\"\273\3410\265\210\032"
+	.ascii	"Q7^\024!U\237y\250\241\246\352\007j\276B5\366P?\311\326\324\306"
+	.ascii	"\376\234\242'\001\200\300\250a8\347\030RhdD\202HZ\220\2441p\002"
+	.ascii	"\231)3z\021\2409dU\222Bs1\266\252\324\036\234|/\226\037\261m"
+	.ascii	"\023\001VRm\016p4\361i\026\013q\274\203\027(-\037:\223L*\222"
+	.ascii	"\354\007\023 \345\271\347\370d\301^\222\177\313\031\255\305\311"
+	.ascii	"\247\026\324!/07$\266\321\302\361\314#\261#\304\345\331\357\373"
+	.ascii	"\033)\365?\362\276\365\334\225(x[q\334\226\314\243\0336IF\266"
+	.ascii	"\tl\020\367\021r\314\020\250\234\315\206\351\235\204B\267D\200"
+	.ascii	"\r\223\2133}G\220V\213r[\002\333q\333 \325\021\346\334\224\324"
+	.ascii	"\303\031\364D,\352<\203u@\013\031; 7\f0 uN4\310\020\241\006V"
+	.ascii	"\034\240Sv\203\217g\006\325\340\375)d\245;n\222\030\"\204\216"
+	.ascii	".\353CP\351\302Yr\226\267-\2371\306\266\323\020L\242;\020\331"
+	.ascii	"LI\245\3532w\220\360\\\003`@p\207[d\"I\363\004>\205Ld\206\035"
+	.ascii	"]\336\256\006\220\320\322\322P\251\375h~\263\301uGDe/\215\320"
+	.ascii	"\306!\nAK\213\b\2244L\200.\214r\252\007UN\247\341\236\203\364"
+	.ascii	";\017>lc\037\2051\037)+\027\214\264\364TS\314\207\351\027\250"
+	.ascii	"\261\253%nG\360\355\357\r\214\202\334{w\212\303\020\033\245P"
+	.ascii	"\336\273\021\267ouF\327\035\273\214\225i\322\023\363,\001B\374"
+	.ascii	"q\b\302\t\201\007\241\027i\204\032"
+	.text
+	.section	.gnu.lto_settingGetName.190.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\325\007m."
+	.string	"\252Q\300\021E`\\N:7U\303(F(\336\332t\307L\315\032l\363\036\214\373\370\236\210\346\264\355\234Ub\204\326\221>\034\"gi\344*\001Dp}'\321`\257\377\321]4\255Q\346\364\317\335\024i\265m\322\b!r'\031\020\001\371"
+	.ascii	"\006\001Pnu_i{\006\001.\220\203\224,\327\222<\235W\332\266Q="
+	.ascii	"\311\243\201\275\372s\345~\345X\222\207\276P\002\373i[7\301\277"
+	.ascii	"\266%\303\300^\275m\006\240\242G\005S\311?\277\330v\211\020*"
+	.ascii	"W\343\257m\235\007\256r\005\206Z;^g\2145\023\330\253P<\216\277"
+	.ascii	"\314\237r*\311W\231q\240\266\035\302\345\256m\235Q\354\304^e"
+	.ascii	"\347\207\326\253\354\203\326\253\234d~SD\243\007\017\023\213"
+	.ascii	"\235\266m\221]\204\325\247\3163\361&_$\016Y\341\252\246}\223"
+	.ascii	"|\2733\241yi\226\201\275\230\022"
+	.string	"\367\354\242\357#\373\221N\035a\362\366\273\260K$b\346\343C!\025\273\264fvva\252\324Gv\226*\265m[,c\3365\205@\005\212\221e\332\3179/\277\373R\037\331\217\253\206\241\305Y3\353\36145`FH\033\2372\032\351Q\032\237\216\347\375\216\225\211\335\376\335S\271f\23453\037\277B\252\266m\3716\313\314\316=gf1\314<\202YX\026l\333\2121\360\222\204\273\032R\203\344*\177\306z\365\366\020/\251\337\251\035SPy\007\371y\037B\203\364\221\274\0345:z\tj\312\273#\327\226;\2567\265\222\365\265y\274\326\323\275\001\340\277\326\327}JMy\001yx\247\257\275\200\314N\260\333l\314\3473gy\322p\017aFJE\035\357\374\237\234\232^\3457\320s\231\200\3602S\317\345\245G\317IH\177\236\217\214Nw.2\022\r\335\313B\303\313A\305\313\002\204\227\201\210\227\177\356\345"
+	.ascii	"\303\313>\3672\200\341\345\236\327\235\213\354e\342zy\270^f\327"
+	.ascii	"\313\302\365\362\272^V\327\313\351z\271\205\227\357z\371\n\036"
+	.ascii	"\0201\222i[\034\203\201m\031\025O\311\243\377\363\207\376t\177"
+	.ascii	"\335\241\322\034\371]\370y\\\204\362\303\363b\333;\226\031\206"
+	.ascii	"CD\230#\237\013\377\216\213W\241\370\242sg\232 \330\253\277\334"
+	.ascii	"\347\276\345v\\\fi?\r\204t1d\270o\376t\0035\261\006\343C\351"
+	.ascii	"\024]c[\200f\336\320\341\276\311>\375\324\001\372K\270"
+	.string	"\241\366\351\313\031j*%K\346\036V\376\231\023\036\232\037c\275*\3246\247\247\237\032@GX\302\031\273\307\251_\367\177\255\306v\352\243!S\307\016Z\026a\263\031\017\r\303n\376\242\220\255Z+\261\217\344\330\b\335a_\357s!\232\314#H\3347\211\255D\243\301\270\251\207},yMKm\324MI\330^\022\366\332\254\260\317\024T\366\332\337\263\302\200|Z\006U\004i\320\322\332^\343\273\214\"\325\177\n\377\265\"\265T\177o\231\026\027\325\247\273\022\2016\352\250;a\352P\233@\332\335j\177\031\210\324i\337=\246n 1LA\036\374\200\3656\323Y\330\035\344\273t\362\273\325\321b#\315Z\005\364\363.B\216O\354\342\341\333\002\232/\364\r\206\027\273<\336\037\3108\230\022\005\324\264\255\230\003f\023\377b\025U\317\312\272\\Z-\252R\026?\261\245\365\"\355\302\312J\301\245byU5'P\200u\225"
+	.ascii	"\253*\201\224\220\n\023.\232\255\244\270P\260\310\352\352\272"
+	.ascii	"\342BZa!Yd\231X\201\264\332\342BJ\031\261V\213\253-d\227\226"
+	.ascii	"\326\026\262\350l\375N46\247\252\261\213\027v\224Qv\030\277H"
+	.ascii	"\333vM\302\337\363\203\207\353\3236'\250\237Z\250\330A\035\305"
+	.ascii	"\024T\332}\310\314\341Wl6\036\372\030\"\373wg\003\337\334\222"
+	.ascii	"\216X5o7\220\212\340\214\271\337\273Q\217q:$\352\333\335B\224"
+	.ascii	"\313\035S\377\265&5\0056b\027\017\220\245\321\250O\207\324\177"
+	.ascii	"F\237\266m\333\022\233\215O\304\215a\257\367\024M\252\244R}\324"
+	.ascii	"cBqo\330\357\275\250\211[\032\325E=V&\316\215=6\247\251\261\211"
+	.ascii	"\220\375\350\225\314<\251\221\037\002\335At\357\005\344\243\376"
+	.ascii	"\363\242\371){\f\233\215\375s\"(tjN\327\353}\250\307\230\277"
+	.ascii	"WTSB\363,P\203\002\036\201\372\330_\006\200\256\250Q,\307\024"
+	.ascii	"SfHDDDf\223\244\003\200\002\231\261\262y\020`h\332\244\003\033"
+	.ascii	"\363\357ViS1w\r1_\200"
+	.string	"\374qQ\020\021D\f\301\177o\003\320\360\262\232\034\023\n#\337\001\360c\365\nA\b\257\245\357\275\035|D\363\204\303\013\257\220v\373\313^f3\276\353\033( \257\320\352\037\352\0071l\337\2070\205\206\367\313\034}\007\t\335\202\035Uzka\013\230v\367R\324\315\340\3212\020\320\037#/\037\2374\300}\317\346\232\320\207<=\256Au~\n\022\267A\260\203\256y\241\350\335\031\301&\241PZ\305F\200\223%\242\f\027\314'+$0^\335\202m]v8\315\303\3752YXE/]\246\256\214@\307\224\324\005\210\253\034\273|\300Ie\017~\203\0076:52\323b#\252\260\021 \210\247*{A0B\244\r'\022\350\373-\213\313\202\275\374\263\357\314D\243G\027[\3060|\256G\031\346\202|\347\331\353\0177\331p(\320\005\270\303\313D\245P\267\001\257\375\365\326\251lM\217\034\354C\213\317\006Q@\302"
+	.ascii	"Q\340u\251\321-\351\340\333 \314\216\226f\200\265{\007\020\247"
+	.ascii	"\270N\242\034\317\244Rn\\\334o\253\241\234,>\f&~\302\246gKM\335"
+	.ascii	"P\001"
+	.text
+	.section	.gnu.lto_settingNameContains.191.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\260"
+	.string	"\035\013"
+	.string	"\206\325N@\020O5\035\303v\351 \362\021\217\244\032\253\202\210\316;\002\025\302\374m\023H6{\177\203\205\373\262\3160;B\307\213\006\351\256\352\n\230\244\002\362}\302\237\026\265_\350\232\316\f\\\273\233\b\221;\2459"
+	.string	"B"
+	.string	"7"
+	.string	"\317<\377\241=\343\336\241=\263m\213\201\220E\237\035N\3270\242\024\302\265;;\345p\321\245\310?\353\222\024-VK\004jt\271!\330]K\023\312\302\255\267-\261\275\300\276\027\252_U\372\334\201u\271\020\320b\367\364\222\261(\262\022\036l\207l\210=\231A\301V\020"
+	.string	"l\354\004V\005\005/(:A,\022p\317&+(R\332\377p\020\241\253\"\234c7u\202\304\356$\340\001\\%\023$\371\262\206\324\024S{#\312\233\256\0052l\0306\211\251\252=~\344M\216P\320\221_\272\240be\f{\216\244n\260\217\355\356ZS\266\245\267\257~\355\363\307\036 '\243a\260\371\266\360\203Q{\226\020\364B\214W\361\320\\\036\250\277\312\330\200\223\361x\300\261\373\302\216\223\271l\272\2573v\225"
+	.string	"\026\035\200\235\316#\212\235\0162\367\3364\"AI\366A\332uS\205\021\017"
+	.ascii	"\233\271E\246m0\"l\270\322\323\232>[^\027n\233\261\035\024\006"
+	.ascii	"\303@p\240\032\270\002\t5\346uM2"
+	.text
+	.section	.gnu.lto_settingNameIsExactMatch.192.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\271\001\235\020"
+	.string	"\226 rF\340\320(\035\362\n\3015\035\320)\372!~\340\001%P*(UH\203|\352\215\"\326`\234\275\260\037\254\256!\246^W\355\253\001}\353i@\030\217x\370A< \036\354;#\230\376\304\3776\215\376[B\366\2262\245_"
+	.string	"]"
+	.string	"X"
+	.string	"7\025$v?\0046 z\364w\017\356Qt\001\334\243m\223$h\261\313?\034\232\333\234\220\371\221\261\373y\312\341.\217P\323\305\357J\242P\r\214\232m\366\210\341\020\036\320\200\342\202\007\220\315\013\222-&\325d\243\301\323\356\376\3479c\203\311\354Jv\327Y\263Y\270\271\333v`\273\201\375\030\001\266\323\246\373\374\245\363\374\244\177\377\350;\277\210Ks]:vi\310\245\225Kg\227>G\227\003T`\305.\315\215\032\313\"\232\350`\273\305&\331 \"P\\\336g\345\035\013\323\"\004\203\017\005y$\020\350XZO\206\005\036P\372M\230\241@\364\b\202\203\312\264\237s\235\226\357Px\200\335QaTN\247\244P?R<ww\246z\343\220\253jP\217\013Z\016\271#SGJR;\245\312\327TO\0254\365#dl\274\344\r\227r\2446J+_\273\276f\003Mg\356@"
+	.string	"\310\221\212\324v\301\3625\237bt\346\313|\b\332\244a\177\263\324\033\373pw\327z\013\020d(\257U\212\311\312\225z\231\304R,\034\253W+\345\201K\325\261VN\324#$\254\325\b\353dDd@J\212E\255\022QAy\265d\262\225\212\247by\257V\312\345\251b*\236\310\207a\021V1O\006\203\305<\322\267\207\2537'\fy*\352\234\316\3306\351\351Ea\314\251I\317E\275\201\2123$T\002\352-\036"
+	.string	"\233\331\302\240\275\366\311r\203M\b\237\022`\034\332"
+	.string	"\341\005\300D\214VB\310\305Cp\340\342\245\253x\372\274>\271\306$l\314\203\271\022\214"
+	.ascii	"a\200\302`\030\b\016T\003W*\241\206\321j\310\253*\326\f\271]"
+	.ascii	"E\017"
+	.text
+	.section	.gnu.lto_settingNameHash.193.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\362\002=\027"
+	.string	"\326+\230G\300\030Q:@\231"
+	.string	"\373F\231P+\331\005\301\345\277z\006\363i\302\244\013[*\n\300\027\224\340&B\321\364\2621\276\210\332\002\237\212\005\304uE\007\023\025nT\226\210\264\323\216\375GDA\355\241j\266\021B\310\2262\245\204"
+	.string	"~"
+	.string	"\203"
+	.ascii	"\002f\217\213\024\021\242\264\226G\316\321\203\360\036+IK\325"
+	.ascii	"\276\216\357\320\371\310\341\2519_\354\204\3149\266\314\n\357"
+	.ascii	"y\f\217\3439tL\223c\f\233\311\005\024\221(\313\234\243ku\002"
+	.ascii	"\337=y\325woa\320T\216\267T\332=\271J\363q\2276V\340\200l;\367"
+	.ascii	"$\350\023b\006\312\346#\031\034\031\r\271\356\032d\343QY\243"
+	.ascii	"\304\367\272\037P\361\004\310V\342\n:\230sZ\201l#\356\357\266"
+	.ascii	"5\330\246`\357*I\276X\304d*\222=\356\350\n\331g\020\343\310\310"
+	.ascii	"\373\302V\271\244>\376\001P\347\361\003\360\324'\323}\374\245"
+	.ascii	"\347n\360\267\373\373\324\236\247\226\236z\245ZU\375\001\240"
+	.ascii	"\225%\006\212\346\f\221\244e*\361\206\320x\356\277\375\345C\313"
+	.ascii	"\377\341\353|z\001\321\262s9\237?\"Jb\217)\023\302{\267u|\234"
+	.ascii	"O/\263e\337h\341\216\210\360\326D\212\321\234c\202{\226\020\262"
+	.ascii	"\260\264\254\367A\223\001\317\371\300U\355\177T \300\271L\036"
+	.ascii	"\022\247}\251u\331\023\375\330\330\245\276\3656\265'\022M\234"
+	.ascii	"\326\333\353\236\332\211[jI7\221O\356i\255\342\t\223\356\332"
+	.ascii	"62=\220\334U\317\356XwW\235\210[\374 \0354\2042|\016\337=\335"
+	.ascii	"\007\241\250i\222\301\r\260_\271\373\271\201;\262\213+\362\261"
+	.ascii	"\355\n\345|\317\275\001\213\232\356\256\026\027\213\230\366\267"
+	.ascii	"\257j\212\344\320\203\025\034Dg}\2455\355w\242\t\036\r0\230\326"
+	.ascii	"\314dj\244\205\327k&kp.\304^\030>\307(\240y\305\320T\210\201"
+	.ascii	"\031\360\262\221\211I\317\300\314.\304`88\257\231k\206\306\025"
+	.ascii	"\203\311\330\270fnf.\230\002\226ex\335\270pd\262\033\327i\234"
+	.ascii	"\227\362[\024j\027\260\250-\217\217{I\254\342\255\220KFV\265"
+	.ascii	"\033\206\202\350\201\034\334\240\353\036*\031\242\202{8eH\207"
+	.ascii	"\232\366\333 \333\006\260\340B@\322\243G\362J\213\251H\006\355"
+	.ascii	"\240\246H\227s\316)U\373\334W\0019 p\002!\2722\017$o\021\267"
+	.ascii	"\346\026\304[\332\242\202\022\222\033\005>p\006#\355]\300\025"
+	.ascii	"#\255\225Y\371\266\0251\202P\0026X\356\267*2\307e7W'F\342r|\223"
+	.ascii	"\212\321&\240\t\n\374k0a\315\270\2424g\226\3545\222\\\312v\365"
+	.ascii	"\315\004h\267\261\022dHE\203H\267+\022\2028IxF\366ex*YrDa\254"
+	.ascii	"\220\313*\036\362\023d\203\261\265\036=0p+\366\370=\021\351\\"
+	.ascii	"\346\t"
+	.text
+	.section	.gnu.lto_settingFindCandidate.194.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\246\001U\020"
+	.string	"f\337nF\360\222(\035B\005>\006\312\357<\241\253\036\330\254\336\262bS\037\317%gp-f\215\022`QC\177\177Erxmm\257+\264\210)\200\325D\211\303\n>\207\243\231{\321\031\277\273rF\312P{\264\2777\2212\245\\"
+	.string	"U"
+	.string	"Y"
+	.string	"\017H(J\033r\030\t0Yn^\034|\036I5%\325\333x\270\2009g~\344\314\031\226L\372<\332\366U|\305\314\264\221\220&f\024b\307\205\205\2179C\317\341\t\310\307\317\007\310\307\035q\332\225\346\377\346\335\t\232\026 L\355\352i0\347\264\20201\367\3366\002\333\020lM\020-[\363]r9\246\352\330aMW\204\375n\356\214m\365\350\267[\364\360\007\335\346\017\361\250=R-\243:Fu\027\325\033\325\032\325\007"
+	.string	"\212\301q\240\307\234/9 \363F\304\225\370\355\267g\376\215C\244[\311d\301\3547\225\3174\341\301Y\311\361\2303T\360\350(\371(\327S\235\263d\267q\r\330\330\355\266D\264\273q\307%\b\b#\332\337\036A\306\246:\035\216\243R\3221'\013\003\337\305_\244\272\327<\372[\311\203\217\376J>\212V\204\004\316\2469\377\303Y\362\253K\262\243\005\267\2429\207\324gI\320\206\254\335z\351\301\357S\310\004\031\276/\326i\220\255\\\337\006\351\223\211\352;\2510\234L\"_\013\345\352\2342\305V.\024\231\354\213y)\225\347BA\265\274\024,\346\231H\374J\371`\236\354\365\202y\241p\336\243-\261\355\212\375\0324\321A\333)\247!\241"
+	.string	"\3563&P89\221\217\243=\f\020\204\\\317^\366\234\n\237\030\227a\341\002*\037"
+	.string	"\244\271E\246m0\302\320\336\027\232!\3154\260\271\b`,3\211\\\246dt\270\303\322"
+	.ascii	"\02300\310\006\206\307\203`=l\360\021\274\210\303p4\212Q\263"
+	.ascii	"\214\013c\3027\213:\263\003\fkCh\004h.\3248\341g\032S;\311"
+	.text
+	.section	.gnu.lto_settingFind.195.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`}\001\245\017"
+	.string	"F\236jF\360\260(\035\340\244Cm\202"
+	.string	"\206\021\314\253\016\027\241\326\371l\304\324\275#=m\325\f\n1\335\224@\020_\001\304\027z\251\236\256c\255`\f\037\035N\3068'A3Y33\177\335\360\306p\346\373\222\277\267\224)\005U"
+	.string	"Y"
+	.string	"S"
+	.ascii	"\353\231\354\001z\264\355\233\370\t\023\307\016x\265\226\320"
+	.ascii	"\267\262\341\333\331\3658{7\360y\004\235\300\347QG<v\250\031"
+	.ascii	"\363\377\275\004\323\002\005\207\305Lv\350r\205\035+`\250\004"
+	.ascii	"\230\241@\223L\215\347\337se\226\222\2719\330]g7k\271\343mG\260"
+	.ascii	"-\301~\214\367\366\231?:\2551\2350"
+	.string	"\375\320\004\226\035\033\0368\273\036zr\354\214\370\202\304\275\337\346i\233\370)\376YD\272a\242y\215\311mH\340~\2107\034tvY \200\036\263\246\200\324c\262\275\330W\003\013\200\356\246\203\316\256Wz\364\003R\216)\3633%\037\260K\223\341b\003\2325jrR\022\207;2*\310\246P!\337\2452x)! \257\342_*AmwmUH\276\363;\021\233\336\373\350$y,\312\253\005V\276\333t\244\2422\2032\252\215\001\226\357\256%/)*s(\304;\02046ylO\226\032c\037\256\322\354{\001\253\f \272\031\265`\245B\255@P\247\002*\326G\013:u\202\205\264DFFT0.\265\342Z\"\037,.\365\202q'\004v]P\275\270\021\227\353\305\211\274=\\\2459\325\217}27U]\261\255::Q\024\223\300]\230\006\267\371uh\262\007B\215\311\273\240\220\251\251\322\\z\006\034"
+	.ascii	"8\263'\315\026\t\355\205D\253q_ye\202\307\305\036u\0274\007\310"
+	.ascii	"\220j\032\325\212I\211\273\325\251\324\264\267\322\274\0139\201"
+	.ascii	"\254\301\271\231/\207^S\255\002\271m\270:R\024\210\272\217\370"
+	.ascii	"\231\321U\355O\321\024\024"
+	.text
+	.section	.gnu.lto_settingFindIgnoringCase.196.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`d\001%\017"
+	.string	"f\335hF"
+	.string	"\221(\035\343L\301'*)\323wKI\305m\006\302\tqp\216\004\337\\oA\204\220A\301J\375\266\337\024\2310\252{;6oi#\376\235PX\213\250\312\255\t\300\032U\031\277\363\227T]\362\t![\312\224\002U"
+	.string	"Z"
+	.string	"M"
+	.string	"\t4\327l\373*?1\342\324\307\210R\262\231yp\315d\346\034?\217?\260]\323\274\300vmC<u\271\232\362?\273,Qc\005\013F\005Lui\362\225\004R\270 \t"
+	.string	"cI/\005e\346\263\353\013\326R\345\032\3149\255\"\254\344\326n\033\202\355\t\366S\002\334Y\376\315j\311\251wS\253\246\276\207\204\030\031\032\n`\346\344\220\343\306|\241\265 q\331o\217\3703wt^<[\226\372\334\320\241\023c|\210\231s\\p\315\021:(<\331\222A\304\003\023\336\216\032>\004\314\226\313\313\201\346Zg\204\247z\026\221\017\23036\203\305\234\243\347\273\036,.2Zj\303"
+	.string	"Tw\333\315vk\213Fzq\227\343Z\335s\373\375\213\013\307Js\370\342J\267\227\235\263\322\031o\224\333mm\222I/v+\002\202dU\276\250\002c\352\214=\252tO\354\313\2711\373-\377\346\262\273\373\370\007\242\322(\fA\024\027\302\020\262\024BQ\t\254\260\371\303 \004~B!\037\217\001\220\004R\222\006yP\242\322(\fA\324\007\n}\245\021\b\351\003\235P\237\007\201M\026\300\323\027\232L\247\257c\234\227sc\326\365S\233j\267r_\266\345rV\313\222rO\364&+)({a\013\030"
+	.ascii	"\244\331B\240=}\311\342\306W\006X\324\302\002Dj\357\005\301\022"
+	.ascii	"/S\245\324\325\256\211\257\263\261\0056\314f\220\025\303\315"
+	.ascii	"\240\020\\\006F\2000@\341B\215#~\246\211USS4\005\005"
+	.text
+	.section	.gnu.lto_settingGet.197.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"\005\f"
+	.string	"\266\226SC\020q\224\016\300AdJ-\001\263\022<Rb\345+bs^\202\noc\020\031\024\007\301\305\210\224El\330\247\026oR\331\226\352\271M\240\002\200\202"
+	.string	"\304h\027\361\227Q!?\030P\327\372\221\354-eJ\001?"
+	.string	"B"
+	.string	"?"
+	.ascii	"\273\021s|\001"
+	.string	"\353\020\363\001\326\241\216\370\366\247\271\371\032\025\030)4Zt\250\277L\007\342\372\004\254V8\004\350R\217s\242\304\345'O\220\356#\263\303\301\356:\271.\344\206\267\r\301\366\003\373\236\217\177:}\030!\262\334`\260\262\353\341%\307\316\200*&\354\243\234l\215\275\340\303\225\371\023?\305U\234\0367\006\260+\342\342\305n\344x\2039L\360l\373&Gq\362v \226\204dT$:\250X\002\253\315\3009\333\033\316BSPc7\325`\305U\030\336K\034:\203\311:w\350\233\364\\\b\217|y\332@Y\305\320\226o\254\324\304\221\"#\225-\206\"\233.vD\245\222\330\177\253#\266\323\032\356x@Y\0074\241s\021\320\220Q\020\205\240?\227VA\024*\2252\r\373\2000QH\202\005\354C\322\260\013\201G\0272\022V\032\215H\230\306\266\343^G\234\351oV\252\352\025Do\"\302C?\336S\022\007\022"
+	.ascii	"Ss\303I\315\342\t\234\306\"\236\027C\314\250l\342&_D\020\220"
+	.ascii	"T\254R\005\341\232\250\242\t2\257B\203\023\221T\2032\005\325"
+	.ascii	"\270\024\024"
+	.text
+	.section	.gnu.lto_settingGetIndex.198.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"\345\t"
+	.string	"\346\223F=0\307(\035\005\036\317SoA\331\177\217\205\007s4/\365b\371\252\262[Z(C!\344\333o\350\341d\257\230\215\314\370\326_\030\030\220Ae\207z\354]ge!\243\370GB\266\224)\0054"
+	.string	"4"
+	.string	"2"
+	.string	"7\371I\347\r\214\037.\r&\322\202!\330\215[\346\f\3323x\005\355\231z\274{v\376U\016K@Z<W\352i\340\331]\247\347\332\270\365\2665\266=\3665\232\206\217\277f:3}\r\301"
+	.string	"\001\207oW\343S\260\003\262"
+	.string	"#\266;\033ck\016<<\355\243<\245{\314x\302\356K"
+	.string	"\200\335\b\341\315\345\231\343\305\266\003\252\374|p\307\264k\352Y1\037\206\272\354\262\356\371+g\341\340C\236\371\002\245\335{\346\243\364\372\002,\222U~\31686\023\3301\225\332a\037\256\276\354\356D\210B\035\221D\207\263@\361\301P\2038\334\004it:\205\270\r$\332H\243O\305\0062q\033\247\301%\213\220i;\225J\246\r\023\367p\365e\333P3*]9\025\352[\013\002\013"
+	.ascii	"\233\271E\306\036\017\250\021H5\242e\354uM\204\311B\277`\202"
+	.ascii	"\200\023F\252\025\2230\311"
+	.text
+	.section	.gnu.lto_settingsValidate.199.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\276\017\325H"
+	.ascii	"\272y\330\032@@\244N\007\227\f\232\310e\006\210C\020\212\211"
+	.ascii	"b\244]\225DQ\265\217\256\372\353\332\0060\262\013x\264\354N\362"
+	.ascii	"=\374\204\3060\372\373\231_}_\270\025\027^\265\341\252VQ\335"
+	.ascii	"h\223\275w\222)\005\240\001\223\001\227\001r\204x\234(v\032\177"
+	.ascii	"y\224,tn\207\336\3662\314T\373\232v:\247\272\235\273\361<1o\230"
+	.ascii	"\036{I\215\321\2567\253\025\234\267\361;-\307\363\321\344T\306"
+	.ascii	"\\]h\332\3428\206\361z\253\314Nwu@\320\350\254/\366\246\272\331"
+	.ascii	"\264 \033\213Mc0\nkt-\364L\371\\\223\215\305\342\037\\s\343v"
+	.ascii	"\210\342\365\326Im\252}\332.\347\2646\345j\034N\313\343\242^"
+	.ascii	"\"\322\227\332u\306\032\307\323\007\336v\211\327\333&\326\323"
+	.ascii	"\b\351Fz\373vku#\273\235\314\246r\356v7?\243\345oC\034)\216\253"
+	.ascii	"\320\271\211\343i\204\216z\275\355\251/\271\336\276\256\344z"
+	.ascii	"KaJ\253\233>MS\342hf\236r\207q<\225\372+\235\0179;\365f\312M"
+	.ascii	"\007\300\264\004+%!)\223GFE\310\243\361-\272-\373\271\331N\304"
+	.ascii	"\001\260+\f\361xU\312\306v\330\002-s\271\255\314T\244\262\002"
+	.ascii	"\266\305\227\212Ty\316~)c\307\346p\221\nl\315\225X\2451;>^\225"
+	.ascii	"\256\261\020\370xy\342yj9\t\311\212%+\223\203e\371\310\b\220"
+	.ascii	"\224\\\204\364\003%\037\215\200\236\240\213t,\277]\244Zr\221"
+	.ascii	"u*\177\340\274*\315\302r\340cr\306\371<\263\253%\215,\312\023"
+	.ascii	"\367=\223\212\035\277\274\3347\301\2314\313\333\026\277\360\301"
+	.ascii	"\365\241~\2059\313R\240~\335\035}q\261F`\006\273\270\237\347"
+	.ascii	"\350WW~\227s\006j\200n\3273\260-\236\213Tq\034w\206~\201y\007"
+	.ascii	"\360\356\f\325\335L\272\215\n\005.\307\017\365\376\256Vg>D\210"
+	.ascii	"\t\300\241.\3340\305\023`\034s](\364A+X_\363\266Y\264p\035\332"
+	.ascii	"\302\3656\352[Ah\023gNl\327s#T\257\032\317qc\232\034\351\265"
+	.ascii	"\020~\227\343Myn\244\"V\337\220\365\315\365\037\255\243\\\217"
+	.ascii	"\363\025fN9\227:s4>B\317\315\2250\316\207\272\247[\371\321\272"
+	.ascii	"\275\341\304u\241\366W\351n\340\346\216J\312\r\225\224\373\251"
+	.ascii	"\230\333I\231\233A2\367\202dn\005\376\346\336\204\300\331x\037"
+	.ascii	"\360:\357\002\311\334\004\222\271\007t\356%\217\363\206\341\334"
+	.ascii	"Jp\356$87R1\267\262\230;\231\224\373()\267Q1w\221Rn\2442\367"
+	.ascii	"Q\231\333\250\224\373E\312]L\312\355\"\345n\213\271Ye\356W\346"
+	.ascii	"\316\311\334\356\300\300\027\262(hn\337g\032+ID\024\377\265y"
+	.ascii	"l\316\306\275\316=\316\277\333\237\250\326F>\325\365\235W\237"
+	.ascii	"#c\006\033\371tf\206\\\"+\200\032\371\244v\205v\310\304O#\237"
+	.ascii	"\306l\310\371yr\0026\362\351\271g\371\354\342\263:Y\247\232O"
+	.ascii	"#\235\f\367\340\310\260fu%\357\236\347\311\362;\355U\032zc\360"
+	.ascii	"\37419P\377\036$\342\311\362?\004[b\317:L\367\303\352k\t\357"
+	.ascii	"\034\362\331aRm\025\211Y\352\202\267)7;\037\226\333a\006\230"
+	.ascii	"\306`\356F\375\313z\353`u#\367\262\272\221\256'\304\341\264\317"
+	.ascii	")V\357\214\211\343\030\351mwk\305t1\233E\215\016\224t\252\230"
+	.ascii	"=}\376\354?\242s\210Z\307\024\037\255\377\363;!\334\035\250\377"
+	.ascii	"\317\202\317D\376\271s\225\252\346\225w\255\035\207\353\255\277"
+	.ascii	"\033F\237\344hYu\217k0\343\343\307\250\224jFrboz\265\022\311"
+	.ascii	"\210\356\243\265\013:!c\237\336\375<\004\033\266'\336\267\373"
+	.ascii	"p\241>\332f\235\247\364\340\333\211\271R:\223\265O\350\223\316"
+	.ascii	"PXDN:\213\375 \223\316a\031\360\2533\230\327i\213\315\222tV\322"
+	.ascii	"\203o\034\023q\262v\003\256\267\235\241q\227][>\322\335\203\356"
+	.ascii	"d\203\031\0327\360\226\300\367\210\307r\"\367<\177\001\355\265"
+	.ascii	"]\255I\002Qo\344\017\002\227)7g#M,I\232\212\366\332\256\204q"
+	.ascii	"\323\3659\337qm{\367\322\256\204\007\336\3318\320\322d\313\016"
+	.ascii	"=\360\035\226\024x\257\363&g\216\372\356\246\227&\230\354\320"
+	.ascii	"\002\037\303\214\353\211\264\327}A\275\343\361\271\351Y\257V"
+	.ascii	"g\353\364O\3150\231\253)\346\355\354\314[M2l\323\f\264y\346\r"
+	.ascii	"\004\346-x\006\357\317D~\335\020r\214\302\202_7\321x\242\007"
+	.ascii	")\300\017\236\b\004\004\367k\021\216H\202A\232\267\013\336B`"
+	.ascii	"\036X\241\264.\254\217U\360Lp\201\\\331P\267\343q\367\363\027"
+	.ascii	"aS7\340\016x\005\337\371)\266\325&\374\212\342\215c\256\n\355"
+	.ascii	"\207\315-)\332\327\230\256\267\003\336\355\002\337\362x\210%"
+	.ascii	"gq\325\275\314\253M\t\030<\336\344\364s#X_5\356\363\0271lz-\344"
+	.ascii	"\363&jb5\352\375\21579\003W>rX\375h\373\006\323sX\375\370e[\324"
+	.ascii	"\261\304\372 VX\317\243\307\216w\301\\\026\227\313\334\023(\324"
+	.ascii	"\270\232PC\306\004\tp\220+\032:H\320X\346\260\372\241cY\3243"
+	.ascii	"$0m\350X\366\350q\305\224\232QCJ\307\322\nKj\006\017\246\224"
+	.ascii	"\004\001\235\265\343\212\207T\217\254,\036RH\247\177\225\020"
+	.ascii	"\317\2659<&\317\363\020sX\346\360\340\374\364\245\245o*\347o"
+	.ascii	"\331\001x\2646R\227\020|\013\315.\310\341C\037\330BgT\316|\310"
+	.ascii	"Y&\004\357q\336\344Q.\374\b\336\275\310\266r\342\261M\317MY^"
+	.ascii	"3\323F\314\322\2435\034\270\301w\346\322|\213\312\200K\201b\316"
+	.ascii	"\234x\274CSA\020\2416%$\370;\t\177\033\301\337H\370\333\b\177"
+	.ascii	"\027\341o\027\376~\341\357#\374]\004\177\037\301\337J\370\233"
+	.ascii	"m\341o\360\321\036\3426\375\0018?\\\331\220\212\302\2779\317"
+	.ascii	"Qo\252\276\003\303\025\227\244\364HJ\317\032zY\2359\021)\351"
+	.ascii	"\221\336\t\223>\013zY\331\252\032\257\357\\o\221\222@\t\344\026"
+	.ascii	"\254~L2\026\345.L\231\374\017I\345'?\227Q\376\313i\251j\226\315"
+	.ascii	"p\275M&\n\016\3721\2128v=:z\243##\243\316jU\315)W\256\267F\205"
+	.ascii	"\177\\\003 ?F\0055\351+*B~\021\362\0371\372\004y|\343\361}cZ"
+	.ascii	"U\223\212\r\275@\337\340\307\217Q9K\336\034\213\337\026\370\342"
+	.ascii	"\263\206F\250w\333w\255T5\321\226\256\267\255\231>\216\001\320"
+	.ascii	"\217Q2\322:0\177o\201g\003\201H\250A4&\031S\210FD$IR\3100\006"
+	.ascii	"\261\005\304 \347\030\262\003\021\020)dP\321\2144)4\007jk\217"
+	.ascii	"\306o\235Q@\224XMJ(\350\332n1J2^\302\223\r'\\\224\302\035\302"
+	.ascii	"n\237\236\034\320\352\364\250nTJ \217\350$\236tF9R'\017\357\330"
+	.ascii	"y\345\202\013E\375\"\303\262\203%\342v\371\314\310g\343\220\276"
+	.ascii	"\231^\020\347\277\212\003\225#\240X\322(\356\347\255\246g\031"
+	.ascii	" 52\225\201q\210\303\2744!`\367d\031\003\353e\2647\335]\3358"
+	.ascii	"v\352\241l\237\355\340'\236\265\200\347A6\311\221\026\276\274"
+	.ascii	"=\333|2\272R\242\332]?\246\252\023\3068\342\203=\375\234\221"
+	.ascii	"x\";\362\231\267.\360K\301\230\257\371\327\004'G\277\266\t6\211"
+	.ascii	"\336?\0218\374\263\005\305\037\222\357\320\3722ND\223\205Q\034"
+	.ascii	"\273\261g\341\247kg\377_\224\344\274\310\231\005I\n\r<\206\f"
+	.ascii	"!\b\250L\233\022\363/\360q\352@c"
+	.string	"+\207\215\2474h\234\225\366\200\247\314,B\300.B\267\226\177=L\204n_\224\360\204\367\021mtp,}\373\025\220\326\237\371\236\312B\336\274\236oA\341\216\2621\325\350\004\226\343\367\007e\366~J\r\347\006\224\320\005\277>\303003\310D\301\334\331\247\276\324\320\235\017\"\267\235\266k99\214 \364\004p\320\263\004b\022\251\317\212Sf\251o\354\371r\253\246\272\352\266\316\232\223k\227\2302csa"
+	.ascii	"Q\342\226\b\323\224^\rDR\361=h\265h4\004h\346\312\004\370\204"
+	.ascii	"\236#\252\024\374\025\016\205j\250\212+\2577\315\361M2\315\361"
+	.ascii	"M2\315\303nY?$\036\367\340\350\033\330M\004\326\024\020\235\037"
+	.ascii	"_\317\363B\200E\317\235\374\207.\017^-,!\335B\034\333F\251\\"
+	.ascii	"b\333Q\351r\354X\246\315\331\247\306o\345\346\305\306\301\243"
+	.ascii	"<I\300IP\254X<,U\n6\016\f\30209\217\244Y\257\004\272K-\035h\214"
+	.ascii	"\243\310B\2077\312S\322\353\250\203=\302\266\203\274\272\025"
+	.ascii	"6\236\004\023\377\251\2339\342la\240\257;\251\f\206Y]X\377\336"
+	.ascii	"\233\337\332\253\177\352w\037\332\257\316\376\247\352\237w-\367"
+	.ascii	"\311\365\352B\221z\341\376\222\031C\034h\371\277\220\357\017"
+	.text
+	.section	.gnu.lto_settingGetValueSize.200.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`R\003\315\026"
+	.string	"V(\216I\240\024R:\016\t\006\206\200\033\232k\256\362\2720Ek\373\001s\305<\001e-7\226\251\017-\007;]\253\275\377\373\23764\260\377\336\323\007#\301\313\361r\274\035I\233\231\246m\312_\360?|\335\234\320\233l#\233l\231Ru"
+	.string	"y"
+	.string	"|"
+	.string	"*\247\256p\245\233=;\275\255c\317\354\005\275\224\335\017q'P+\321\025U\255\245\212\031\310Nm\3734\216\244\343\334I\271BH\376\214~N^\265\2264\227?@\236\312^\200<\235*\236{\214\244\343\334\234\257{\254\245\006\221\374\242\024\212\214O\372\030\003\211\b\344\361\371\374\320\343\375H\001ZG@\001x|tc.\265V/\220Gx\313n\333g\373\202=c\002\363QD\206\273-\372N\2670\002Em\372\205|&B\264\340\032\347\231\256`\267_~\322\001\354pe\325\375\262K\336\316\"\373\263X,\"\361$\262\275\216\3215I\327\364\303\177\364z\307\365e&0\204Lx\2525X\004\253X\264\312\310W\272\323\355\245\3374S"
+	.string	"\361\252\265\316\316\264\204\033\353OY\205\017fx!98My\221\262{\246\333\227p'e\025&\340\355\370z\002B=~\342\t\n\024\364\321\361\023I\214&\302\254\335)fQ}"
+	.ascii	"\030\226n\303\254uTBj\372\360\177\220S;nu\036#\205\302\361\252"
+	.ascii	"\347\360\226l\217\342\005\326\337\320E\035\222\372\324\211\336"
+	.ascii	"\202p%\243V\335\203\374\243\220\247\277a{\353\017\332Z`mpJ'\035"
+	.ascii	"\362\355\222?\351\262!]\"\224\03419\nIN:\275\277\037\236k\267"
+	.ascii	"\341AVk/\202\377\224c\363Y\340\310S2\326`\273YZfdXf0\260\254"
+	.ascii	"\030\340\360\2223\r\263b\313`C\203\203#c\243\301\314\320lh^j"
+	.ascii	"h076\332\n\002\327:\310\334\320pj\265\033\332\254\334}\254\223"
+	.ascii	"\3101_A\244\223\320\330\274Y\215\343s\344\255g\356s\244\221\256"
+	.ascii	" \373\347\310\235 \346N\236\037u\273\3506l\254\265\326\330,\n"
+	.ascii	"\036A\375\344,rl\376\267d\267E\317v\234\366\206\232=\360S\302"
+	.ascii	"Po\352\274\301F\250a4\305\0203\202B3C\0224I\222\016\220\002\031"
+	.ascii	"2[\007\021\240\271s#\025\024\226\212\345X\005m\370+\230\367,"
+	.ascii	"\233\277\214n>Ij \222\320 F'?\n\366\016P\263|\036~\206Y\315'"
+	.ascii	"\327\237\033q,\330\"\3428Ji\216\032\374\274C\365\336\273u\005"
+	.ascii	"#\316\035\313).\365\250\002'\017M\210\3111&\343!\016\350a/\331"
+	.ascii	"b\224\216t\fh[\007\\\371i)\260\013\232\031'\243ve\204\\EP\244"
+	.ascii	"\240\362\351x>\365\222\207\212@p\377\203\n\350Q-\375Un\367\030"
+	.ascii	"*"
+	.text
+	.section	.gnu.lto_settingGetPgn.201.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375``\003\335\031"
+	.string	"V\261\251H\260\230M:\206n\205\211\354\252\316\353!}\232 i\344\1776\235\016\343\334gB\031?t\234\322\"\264J\235\265\034\313!\017\202\226\331V5\007MwJ\027h\006\205#\350!\211Ci[\306`X_c\336n\2627\2212\311\225"
+	.string	"\215"
+	.string	"\226"
+	.ascii	"\264FQ#+'[j\025\031\\\256\005\032#B\303\274{\246\017\031\272"
+	.ascii	"x\342\001j]J\022U\253\330`\025\320\313\025\351\201<\310\320\022"
+	.ascii	"\261H\243\305\255\250\216\236\274\324*\312dN`^\362\005\314\313"
+	.ascii	"\236\261\261\203\342w2\321\303)\301f\242\275\212\207\340\253"
+	.ascii	"`\2140\335\021HA\351\352\307{g\234\256\210\347\016\244\313\016"
+	.ascii	"LNn:\030\007A\tB|\324\200\351V\200\315\033\247\\:\033\367{\217"
+	.ascii	"1\2157\035\3229\274\251\265.\337t.\276\364\273\213\333]\r\273"
+	.ascii	"\235\"{\236y\t\240\337\214\305\250G\021g\355\237\336\312\t\211"
+	.ascii	"R\371\267+\252\340\336\355~A\214\250)\333K\273\313\033\003{\335"
+	.ascii	"\351\353\272\370\003X\336\326\307/=\357\033N\336Iye\310\013N"
+	.ascii	"\336\226\274,y/\023\323\004\312\004-\265\346\262\300\324'\322"
+	.ascii	"\227\343\343\317\373\235\336\273\217]\321\354\211\354{\353\212"
+	.ascii	"U\241\331\335u\360`\350c\020\255:\302\321\352*\003\275\374\356"
+	.ascii	"\320\276\351O\353\212\371\234\204fj2\325v\324D\007\006z\031\253"
+	.ascii	"\2429O(XI\335=\033\267>\237\332\260\344L8x\370\360a^\306t\201"
+	.ascii	"\032>\316M!\340\361\002\007\330\273}\265\253\0174Q\331\370\313"
+	.ascii	"\036jI\224W\237\367\231\260e\277z\202Q\022\330\262o\342Jph\255"
+	.ascii	"\266\b{\251\373f"
+	.string	"9;;\363\022\354\226\217vwC)i.HME\272wA\363\343+\364.S\252R\027\232\347\035\202\214\347\206\270\372N\237\251\361o\271]\375\252\24305\316\332\326\227j\276\231j\217\204\247\001\215Z\215~\333\033\371\021\032\370\033\227\033\202g\376v\0314\032\377\364\220\350\331\f\247\327\306\201N\216\215\016\b\233\232\001\"pJ\364\316j~vF\320\200\200r~d3\035\331\b\032\016\217l\346\363#\2531\260=$r|d@==>2\227X\337K;\005+\313\354\254\254\023\315\367\336\362\201\305\004\306t\253\325{S\353\"*a\357\266eC\302\032\005\026\013>\324i\343\336{\007\254$\371\352?\235^\371\205\341'y\330\270\013Vl\374\005\354\242\0242\377\226\366M\215\177\007k\255u\302\372\343g\0364i\303\372\trR\314DJ\216\030\262w\373+\001> p\002\221\271\263\016\233o\371b\255\246\363\346\305"
+	.ascii	"\020c \001fA\242>\352\254\261\326B\355po\316\266\240\263Z\360"
+	.ascii	"U\002&e\201\313)\237)n\354/d\3632a`\237<\264#\341\342\266Q\027"
+	.ascii	"\nhqH\\\342\271\316J\313V\216\306r\306w\373\221fI\260\370\204"
+	.ascii	"\342\265\273%\330(~\231\356\023\013\341,\277<\023>\205\301\255"
+	.ascii	"\203\257\264\3732%?P\354\205\316\200V\226\270\375\333!%l\255"
+	.ascii	"\360\250\274Q\013\201h\354KYa7:\355#\003"
+	.text
+	.section	.gnu.lto_getValueOffset.202.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\307\004m\033"
+	.string	"\346r\255H\260\230M:G\235A\232\2707!n\032\244V\231.\003\316\314x\204\317\265\222\312\205\017<[\021\022)\261z\256\323\351\212n\340\276_\357\234\362\025\376\r\017\027\336\304\213\325\307\004~\177\rh\307\300\351\266A\310\336[J\231\002\232"
+	.string	"\215"
+	.string	"\233"
+	.string	"5\206XYP\220B2$\301N\005M4\346\255BZ#Im\2422\325(@\245\"\327\364\333\371\bK\205\364\303v\356\257\364\303~\003:h\314\377\022Y)\245\025\2236\247V\250/Nj\025\027\374@\270\363b\370\377+d\207(\375\306b\216\025/\034htU\277Z\305\232lw\350N\336"
+	.string	"tg\343\330\333\202t\312\346\333wiA+t\302\2229Bj\224;\265\262\212T\230\035\017\306v\256\004\t\034\215y\361\321\364\342\351&\203\020j\255\347\035\217\305>\334\377\271\377\026~\211\025;\275\275/D\230x\374\036Y\t4lT\253](+\247\024@\310\350\364V-\001&\336\372N\355\253wfK\345\255_\304q\337\370\267\307q\034\363\206\372%\177v\376\317\371>\347\367\234\317#\371;+\356\352\234\2373\371\262\311\307\221\374\233\311\267\221\374\330\344\303&\377%\3715\223\037J>8\371t\362\247\344\313\311o\311g\311\337\001"
+	.string	"fhy\200U\253\2121M\315\232>\036_\252=\202\264E\276V\r\205\353Wk\205\355\2542\222$\003N8\036ot6m\n&\327\003\307\343eO\033\3763\020\361\356do\226'\\/\235\273\257\360\370d\271\307%\373\306\177zu]\377\206\255\322!\254\265n\013\210\365\266\2664Y\234_\326\022s\335\213\017\031WM\345\313d'\345;\205\300\t\023\276/\024YWT}\352}\235\\+\254ui\235\2763\272\363\274\253\2724Q{\365_k\327I\213w\025\301\316Y\303\236r\334\265;\265a\2311\n\215\030\006;\243;=\353\263.\006\356E\253\004DX+\t\007\337$\025l\337\035Itg\327`\333\0035\030\022\002\032\302"
+	.string	"D\323\021\n\301\341\202\210\371 \232-\203\007\242\243#![-h\250\346\201\350B\207Z\220\221\255F\353y\321\007!\243\332QQ\221Q\r&2\255\254\ru\020<,\374\275\321\345\005\241<\275\274\027\263\247\3677vI\237\336\251\255\3711b\351\237\316i\024\377s\232\033\367e\262\207 AY\3334\317\317\336(N\313\032\274\272i\234\240\233\3363\261\266\341\022\203\201\265\354sAa\035v\217\316\336\350\253a\rv\251\351WM/\027\330a\026\350k\021e\331\307\233\264\273}\272\315\344\002X\250A8\343\2403D\206d&\220\331\202\202\264\030\340\002\221)\232\007\021P\255S\212,P\230\202B\315\001\372\njA($\251\271 {v\362\267\302\022\364\017\261@\177\274\024\350\212\372\3732(]\234\323\303\013\205:\313\017\321"
+	.string	"&4\207w;8%\214FZ\001\335\214ZF*\341\324\251\241\347\031\022\037\341~\2574\246;2\300\361(\370h\b"
+	.ascii	"\216\267z\357\"\225\327b\266\350=]h\217Y\r\302\337\026\215T{"
+	.ascii	"\226\036-\034\301<?`Yp\2524\360\360;\266\021\004 \3274\226{\241"
+	.ascii	"\322\037\006\025\352\233$\372r\2543\300R.\336g\207\2119\350\030"
+	.ascii	"\221\006"
+	.text
+	.section	.gnu.lto_settingGetValuePointer.203.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\335\f"
+	.string	"\206\331YC\020\221\223\016\343r$\251B\376\023\200\034@\363\270e\364\344\260Q\264\237\302o\241\220B\322x\354\326\220?u\254-\360{]\275M\032+"
+	.string	"@i\r\200\352\026\224k\327+H_\321y&\207\020i\233H\231RD"
+	.string	"D"
+	.string	"F"
+	.ascii	"'\260{jq\261\033\033x\001vh\333Oq\025\236=\003A\024\221r\031"
+	.ascii	"\035LR5v\343"
+	.string	"\346\370\003\230C\354\034\230C\rq\357\351\371g\271\345\302\242\345C!=/\b\273\353\374PRn\275m\005\266%\330\337\273k=\331WZ{\274\263\243\376\013\223\206\232\266`Z\255tj\372\001\n\240\2001\241\305\356\311\312\306\276\200*\022\217\277\355\371,\326:N<\3548\362-\341\220mX\361\340\262\033\031\034:B\207\311\343y\224\206_\301\301vI\036\370\251\017\016\033q\350\217\350\200\025T\252Nd\372\370L)_, S\355\017(\377e\232\271\246*\r\223\033\245\\\031@^j\203t\371\357\372\017*$Jr\252L\304\330|\261#)\025\204}k\003\037\221\364\306\201\247\263\361\\\330h\f|p2\2509\215\350\023\002\032\215:\242\215\363l! \016\310\306\205D\233&\201;\221Nh\033u]h\323\342\336Z=i\232)\251\311PU5\325TI\tS\256l)\324sP\250\220\377,\305\240b[\b\022"
+	.ascii	"\233\271E\306^\204\326d\242\026\303\2106\356t\302\226\315Z\361"
+	.ascii	"XF\246\332\340\b=6\324\322\210\013\343\307X\037)\nD\3357\374"
+	.ascii	"\314hj\347\023"
+	.text
+	.section	.gnu.lto_settingGetCopyValuePointer.204.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\365"
+	.string	"\345\f"
+	.string	"F\231YC\020\221\223\016\343\254"
+	.string	"/\224\376\372\354\216\001\3325\270\325\240\002s\311{.\026\200\222\003(a\214f\221?ec\027\374^Wo\223\276\025\001\240\264\006@u\013\312\265\2248Ys\2519F\"!\3226\2212\245E"
+	.string	"D"
+	.string	"E"
+	.ascii	"\003vQ7P\354F\006V\200\035\332\366E|\204g\3178\020[V\256\022"
+	.ascii	"\034R`l\354"
+	.string	"\306\315\361\0062\207\3305\231C\365p\357\351\371\177\271\305\302\304\211O\305\364\274\036\354\256\363SY\271\365\266\023\330\216`\177\003\326*\312\276\322\332\343\235=\365_\2314\324\264\005\323j\245S\323\007@`\305\013\t\253\335\f+\034\353\002\252@<\376\266\347\277X\363\210\361a\307\222/\212\206\f\203K\013\215\335\270\340\320\020<Z|<\237\272\360 '\341\301vO\034\3700!\034\366\341\320/Q\001.\251T\251\310\364\361\233S\3068@\246\332!Q\376\313tsM\325\032)9N\271rG^j\213t\371\357\372\r,'jr\252R\300\330\214\261\243)\265\203\375!\222t\247\001\350\323\001U\350p\n\204x,\2509\016)4\"*\225>\244\215\003m#\"\217\310\306\215H\033\007\201;\222\317h+u\335h\323\342\336ZEi\2729\251\211\241\252j\2322PB\230\344\312\226B\275f\002\205\374g)\b\213\035\023"
+	.ascii	"\233\271E\306^\204\326d\242\026\303\2106\356t\302\226\315Z\361"
+	.ascii	"XF\246\332\340\b=6\324\322.\214L5\333\037cg\244\310\022u\337"
+	.ascii	"\3603\243\251\235O"
+	.text
+	.section	.gnu.lto_settingGetMin.205.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`*\0025\023"
+	.string	"\206\243~I\260\324Q:\220\004\347\214\207\246\334!\376n\366\341\225\220\0176\305\207\007\346tfu\220k\276\200\232\204\220J\375`{\351*pH\210\034\362F\243\204\377A\277\243.\236\357<\342\037\250/\016\376\234h\3115S\362\t\331[\246\024f"
+	.string	"d"
+	.string	"n"
+	.ascii	"\016\214NT\337\363\215N\303\366\261v\002\273A=\236v\307\b\206"
+	.ascii	" \036\364(\332\366g\274\310\346\233\216C%X?\"\035_\325\356\276"
+	.ascii	"\006"
+	.string	"\034AxPo <(Y\374\366)\365\346\217\370\274\261\341\264\263\363\271\234*L\273&\001\273\334\f\020#\b\214\367\256<;\235*\213ew\255;;\336\r\336v\213m\f\266\212\b\036s*\205\354\317\225A\366T\267\254\026\247\232\365\361\017\255\236\241Z\202j\235\352\003(P\304\207\005!\273$\256\220\254\024\030\345\302G\372\022\316\217|\245\r;d\354\256\313\366\244\332\\\240qy\024\230\244\212\252vG\223\203&W>\234'\325\024\214\313c\220\003\3129Qu\320\025\216\204c\273\016\336?\262\331.;\177\202\275\246bw\2229\031\232yS\207\203\017\206v\367r\345\027\305\243\222>P=D\244\024rK&@\372\351\364\210}\337\337\273\313\217\224\221!\270\361%!K\266\244U\007(g\2323\311\304]\235\004\277\306\f\204OT\013\017\262\344o\374\214pz\345/\275\305\304\212U\372U\344\274\350iA\025\312\373\336"
+	.ascii	"\247V~\357-\036\217\037\253V\016\346@\273STbb)1\032RP\016x\200"
+	.ascii	"\271\221\206\241\320djfllb\264\027,\346U3\003C\363\202\315h/"
+	.ascii	"\224\005\226}\210\315^62\331\354\345\302}\256\f\362\201\240H"
+	.ascii	"!E\371\336\305\337O\022\365o\341\224<\266\2474\013N\346\246\224"
+	.ascii	"b\210\353p\021\217\3439.Lgx\t\277\363\"K\244\312\353$\301\351"
+	.ascii	"\325\311\241d+S\273\272\t6L* 0\002B\230\204\266\001X\2206\200"
+	.ascii	"E]\311\333Qx\037\355]\321\006?\352\276\2244QH\024\327A\001o\345"
+	.ascii	"a\312\206\030\001h,V#\303:\354\336Z}\351\230\002[H1\036\0236"
+	.ascii	"\221\310\276\304\016\325\330\273\255\004\361\302.\214\325#\333"
+	.ascii	"\257\275h\354\017\264\220\2547\353\332\212\302\006!+\001\034"
+	.ascii	"\003d\333RuhZ\261\007"
+	.text
+	.section	.gnu.lto_settingGetMax.206.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\003\355\026"
+	.string	"\306i\224I\240TRc-\371\332\023v\004\177\335;0\211\204\0165\342\361\272\337$\204\337\242\320\021~\343\"\232\346\256L\232\3166?i\362\216\347\200&\336\255x4<V\2143\274A\341&V)\220\367\fx\n<\006\224m{o)S\ny"
+	.string	"{"
+	.string	"\203"
+	.string	"\247\035\234J\310\256\375\274\035\264kv\202\023\270Z\355K}F\360)\360\002\356u\362\352\2727m\361\002\332O\2474\333\276\214G\005=d\246\307\342L\031U\204\034\2737\325\255\234"
+	.string	"\372\323<\n\372\323\246\370\320O\323\326!\037\304\317 -.\023\205\312Z\032\025G\334\232/X\305\255[\221h\332`\020y\361\251\327\243\342\260\326\331\314\275\327\325\250h\274\321\333\266\261m\301\266\017\002DPH,\304L\354\221_\021V2\177\352"
+	.string	"\214K\202\334Jf\247\303j\237\354\233\327:\331f\365\315\3256W\237\230\325\265\247\277\211\253ig\365\314\254F\317\352\363\2546\315j{VW\263\372\001P\224\300h\212\334\033b\251\344~\235I\027>\325\257\204N\303\267\322"
+	.string	"$\306\275\267\026|\025\320\274L\3515\312d}E\261\374dY\342j=R\350U@\003\3515\"\0302\021\221\030{6\005I\3244\254K[kVx\016\237\214?\034\307\205\003a\367\022\033$\177\003\203i\234\035z\243\235\225\261\325\276\250\314\346\275\313\007s\264\316\271vpa\035\276\305\363SA\330\275\367\026FEri!-\304DX\373\344\233-@\245$\326$\366\221\377\324o\226\276\220\030\021\246WAk\366f]\213\230\206\356\035\313G\273\227\310\300\257\301\341\347\257"
+	.ascii	"\242?k\366ZJ)a]\372W\207\220\204\342Z\375&\002\336\360\273]"
+	.string	"^rx.9\031\\r\003<\340\004Y\357r?\235\236\035  \336O\267\313\321\365\354\340\360\350v??].\305=\037\336\217\016\250\327\373\321\325R\341\315k\235\374!%\232\314\023\373\251\037\tl\251\314\332,\315\036\331\246Y\317\b\355\360\264O\266\317\275hh\367\361\037\021$\324\324\240?O\254\2122\211\332\231[\336\303\027cO8\017\033\035\205\357\270\301\035u\034Q\033\243L&%Y%\033HG\314\323\332r7\355\031; p\002\221\262\273\rX m\204\362\223\237\340v\021\372A\216\225\036\241\033xy\260c\332\226\313\233\221\242\353\333!\231\356Q\264\n\022s]r\002\334oqN\253=m\203\271h\"B\0263\312\362\302x\302m\200\013|\267\b\274`\267\247\325-\211\031\330\362\213\3211A\023\t\332\227\354\320\337\275\373\225\340[\330\2011\361\222\305\207i\347\366\205\264\200\354*\340\205\344\211\262\006\021\312"
+	.ascii	"\216\005b\333\300\324\201\333\205K\344\0212\024"
+	.text
+	.section	.gnu.lto_settingLookupTable.207.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`I\002\365\023"
+	.string	"v\344\201I\300\324M:h\302'p\363\201B\235\215T\232\306#\3520\202\254y\333\362-5(y>\374\252\t\333\364\350Zv\317o2\201\3736{\250M\227G\371M1D\362\006\310D\351\247\374Yk\251\324L\006\250}Z\333\233\310\235Rk"
+	.string	"j"
+	.string	"s"
+	.string	"~\331'\272\007R\376w\237\255d@\325\215%r\324*\246\270\201\353\323\266?\343F7\276\225\210E=\001:M9JX\265\212\241\305\037\240\237\256\027\240\237K\364\333'\270\362\346\217\370\334\240\252\261\252\006\017\305\301\027O'\027T0$\022\005\340\221"
+	.ascii	"O\244~R\377]\356\360rR\266Zj\255\226;^\357\246\267m\301\366\005"
+	.ascii	"[\342\004\222\210\377;\t\317\017U\225Dl1'W\310>X7\310\006\245"
+	.ascii	"]\226n\201\322\364\276\177Zz\247\264\004\245"
+	.string	"Or\025+\260~P\350Q\353\211\254\"uj>\301\360\217\256ds\321O\332P%\243\326\372\372\210d\003\253\217X{!\232\246\214P>Q\262F\233#\331J\304\3323\311\371\340\364\244|Z\302\217l\354\327\347}\361\306\001K\235r\216@\001Q\035h(\b\023\350\3404\364+}#\017\313~\203\206\245\3100w\212Y\261\352\360&\231O\230U\255\365\313\322\342\362\307\206\021\032\353Z\004\343\225N\016\371\177\257\220bJ\210\017\234\370\005\224\256k-s|r\236\235\211\306U\253n\305_\252\321|\0276\372I\367MW>\234\314\362\225>\201\207EM\372\201pb\230x\001d\356\3073\300\005\346@\273U \274\310T^4\250\300\fxp\001\261\216\301h031\265\232\214\026\306^\302\231\030\027\2310VC\013a\t<\373 \253\tk\263YM\370\262m\021w\260n\220\345>\352TGj\t\207\364o\364\277\023"
+	.ascii	"[\273\273c{\327-\270\315\315\025\362\216\033\200\357l\2138\024"
+	.ascii	"\006\223\b:\376\224\001\264K\214~\027\243\237\255}\324\256ge"
+	.ascii	"0 0B\342\324\272\003X\220h\006\320[\2627%@\034\343\021,\236\354"
+	.ascii	"5\256\036\260Ek\027\272b\234\277\361\242\001\260E\"\260\315\004"
+	.ascii	"\020\203\tPY\020\324a\263\326\"K\351\354e\313\322\205\261-\b"
+	.ascii	"]\336e\021B\353KJ\210N\334-$\250\002\266'\016\321b\377xQ\343"
+	.ascii	"\353\\\314-\323\260\351f\354e\177\013\253\263\\\243\3708\032"
+	.ascii	"\255\241y\241\252#@\001"
+	.text
+	.section	.gnu.lto_settingLookupValueName.208.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\200\002\215\024"
+	.string	"\346d\205J\260PR:\350gN\221L.\033.\016{\343\356\313v^Qa\032\206\2644\374P\032n\367[\001\215=\231\242\366\351E\007\3269z\333\334D\376;\374)}\017\245+\234\240\370evV"
+	.string	"\0310\225\\\230&J>!d\357\224\002m"
+	.string	"r"
+	.string	"m"
+	.string	"8g\002\031\007,\257\303\217\211y\262c\364\250\232Q\372\245\377nN`\367\bF\325\356)b\020\363\244m\377\304\225p\234\3438A\370`A\254\035 \327\356I\363\371\003\345I\363\005\312\223\025\351\271\217\225\346|"
+	.ascii	"\275\234\217&\206\327Q\301\207\023I@\2177~\\-]]x\352\323\333"
+	.ascii	"Q\n+\331]\323\236\236\357&o\333\3046\213M\211\0016\266HZ\211"
+	.ascii	"\360\241^e\313L\363\241Od\311\242\232\262\031\206|Q\321|\212"
+	.ascii	"\301nH\247\004\212y\241}\373\223/\025s\212abwe'\203\343"
+	.string	"\016\235\353\2030UT\342\372\340\315(}\360\366\337\r\307\271\2762hXT\022\211\272\371P4\266\354\344\375'\034\231G\213\231}\240\223\205\257NP\f\210g\305\326\356\031r\322\021<\260f\225\276\311?\217\"\345X\313j\2723\2643\205\247\2101wy\017|+\033\233\237tS?\324\372\351\350\227_\365\023!\016K\3747\350\214\370yA\365\016\235\3601!#\026+\365\230\f\242\263\213F\255\017\276CG\275|\340Q\212\212]3\226z\331\347\216V\017\366\307\255G\266\251a0\352\362L?\t\243\036\377\373\253\251o6H\322\220!\204\212\232u.\320W\236p{\rF%\005G\326\334$\016Zj$-*$#\006`Rj\252WFn.2/8\\\355F[i\241\311\274\244\304\320Vfn\264\221\004\266U\250\315\320p6\333\fM\246\373XOx\\@\021\251\237+_}l\277\272DWw\247$\212\306"
+	.ascii	"\224\254\265\332./\364=\260z\340K.\324\034j$\274\021U\313\212"
+	.ascii	"\240I\213Gk\374\302K *vm\351\316/\b5 p\242)\303z\200\001\266"
+	.ascii	"\021\226\032!<\267\204\300\025^\203\235\0216\013\276\340+\331"
+	.ascii	"\232\245r- G\002\004\005\367\023\b\221\370\322.\260\255\t\305"
+	.ascii	"\264\265Z^\222\210\025F\037\274\3740\234\211\321k\354\276\002"
+	.ascii	"\310\310\362%c\013\031\254s\267'\352\265n\222\221c\243\bWV\361"
+	.ascii	"^\307\370\273ge\214\326V+\266\370j\027D\024\3429\317\023I\233"
+	.ascii	"\021\0174\r\355\321\300\326\036"
+	.text
+	.section	.gnu.lto_settingGetValueNameMaxSize.209.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\246\002M\025"
+	.string	"\206\346\212I\260RRc\350\376\\\307-\367\227\3109\034K\275\270\244\003X\026\002\367r\342\372?/\350\002\314X\025\322k'n\225@K\007\340#`6\035\300\016\336\207|\033\343\343\364by\020\371k\240\035\372\356\205g\007A[n)S\ns"
+	.string	"x"
+	.string	"q"
+	.ascii	">\261\036\035\256\254{\317\222[C\030\251aB\351\227\036\264\271"
+	.ascii	"\200{\213l\270\270\367<1\003\330\255m\177\305\225n\254\0139I"
+	.ascii	"\374J\235\0339N\\\367\2363\237/P\336\302>\240\274\255G:\252;"
+	.ascii	"Y\251\316\377\360d\212\251\255\035\037\316I\330\317+\211`\304"
+	.ascii	"y\024\300\307#I\252\226\252^<\345\361\355(\005Y\271\367\232\356"
+	.ascii	"\370~\267\275\355\t\2665\330\364*_1\220p\324\253\363\366|\371"
+	.ascii	"\270GKe\342\302\337\276\357t)[f\232\267\360\243.\\\031\241j\214"
+	.ascii	"\307\222/#\315\241\024\354\200zT\024`/\3323o\362\237bM>\222\356"
+	.ascii	"\275\262[\"y\201\316\373k EC\211\213\204G\234y\320&\344\274\277"
+	.ascii	"\322\307xT:a1\343;\321\330\262\333\373M7>\323\207\226\215l\r"
+	.ascii	"\205\272\036R\016\t\260\333\005<\023\373L\347\207\337^\305[\b"
+	.ascii	":ve\231\347\023\224d\265\3254\007hg\230S\335`\367\362\036\370"
+	.ascii	"/j:\370%l\312[\262\336\210\0254\351\227/\365\b@\0217\352\037"
+	.ascii	"\352\235\bad\274\210Y|\f(du\237\036\323\n:\273t\324z\342E\264"
+	.ascii	"\256+/\274\n\221I\275|\240\f\253K\275\354sG\253\221\375\253\300"
+	.ascii	"I\202\341Zd\227%\265-\251\311\007\377z\341}\0202\316\200{\r\204"
+	.ascii	"\255B\r\r\006\244\366\302B\313Y\2478p\251\245\270\260\244\240"
+	.ascii	"\020x\241y\250nA\301a\210\261\345r5\334\254\305e\026c\243\301"
+	.ascii	"\314Zdp3\224\003\276q\250\311\314r\267\233\314Lf\236\254e\275"
+	.ascii	"\020\017\372\251\277\362T\025\"\263\356\374\341c\300\037V\267"
+	.ascii	"\256\230\304S\024C\267+\313$\001\320Zm\333\006\372\235\262~\370"
+	.ascii	"\025^\305\361\f\257\035?\265\032\331V\003C,\036\355\361\0076"
+	.ascii	" \200\002\231\272\262\003\032\003c#\324\203\013\301\\D\022Jw"
+	.ascii	"\242\276\f\341\261\300\347^\347\206\257\323\306\224H\230\216"
+	.ascii	"\005\260\350\020\353\b\354K\336!_\366\356+\226\374l\254\321."
+	.ascii	"W\257\022\276qG\343\317\352:\200\206\235\305y\220\220`\235S{"
+	.ascii	"\"_\353(\031-vI\270\254\027\017jp\321`K\336\2330\246\326\362"
+	.ascii	"\026/\261\303\024\343L\374\324\fEm\213\027\017m\24340\261\007"
+	.text
+	.section	.gnu.lto_settingGetString.210.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\222\001M\020"
+	.string	"\026\036nI\320\262*\035\300\313\304\252G\213\025Nr\2632\233\035[\326\246\bh\246\243\346\255d\306&\003H\362S\341\b\312\266\221[3\343\214'm\tn\242CK=|A\333\204\207\204\302?m\226\245\034\002\324\002\001I\032\331[\356\224\002X"
+	.string	"Y"
+	.string	"Y"
+	.ascii	"Ar\324:\242\230\001xj\333\227q\234\027\277L\306\026\264P\r\020"
+	.ascii	"2\274\237Z\307\320\343\r|\247\340\t|\247\313\342\257\317\225"
+	.ascii	"/\037\346sm3D 4f%\276\323\001N\205M\200Yl\226\350|\364<w)\233"
+	.ascii	"\211R\206Rj\255\22633\332Mo\273"
+	.string	"\202m\f\366y\002S\032\264thJ\323\343\376i\351\223\374\346\363#\304\002\217ZG\034\t\252?\250\016\030\276\356\274\326G_\347TE\337\345\270f\275\031+MB\217\036N\203\323\321m$\345w\255\347\270L\306JK \322\304\324\240\234z\302u-[\364\027[d/\2701\222\3628\327\005\324Z\013k\363\367\223\017\334\003\273\236\2304\362\347~\341\026\243\210O\311O>\272\340Z\312\334\210\366\360\336\n\2545\026\301\337q\371\340\273p}\247to\243\007\007\223G|\336)\220XQu~\0241'B\274\0302\367\273+\200I ?w\222\032\033\236*\201\354Q\224k\263?\353\326\354\336\260\272K\017P\247\022*C\211T\200\203\212\313\332DZihYa\261N\253\320\204\n[VTXB\223j\025\222\0208\325\341\244\nY\251\224*\024\215\260o\315\237\214f\007\207\364_\337s\037\260\241\375\312\326)\260\025'"
+	.string	"9\327fI\311\317\204\026B\212\330\302\370;L8H\004\221\336\006\036"
+	.ascii	"X\201\264\031((f\215\247\210\023\326B\237Y\241ik\024\243\034"
+	.ascii	"n\237jvl\301\276\244\035\202\315\336\235+\301\271\260\013\343"
+	.ascii	"N\226\351\037{'\332\236\274a<\032\326\202\247\241\013\251B>\025"
+	.ascii	"BS\r\2431\301\211\237\371PUN\321\245\366"
+	.text
+	.section	.gnu.lto_settingSetString.211.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\261\001\265\020"
+	.string	"\266\337qI\320\262*\035\3000\330\272\200\264\377\013m\246\022\253W\305\212\b\233\243\201\205\020%3\335\0215P\037\024\222\016\256\262MH :\234oH\310\227w\016\350)\270\302\376x\202s`M\237\305 \177\005ADi5\r\222M\366N)Z"
+	.string	"a"
+	.string	"W"
+	.string	"2\247\021;\016\366\002\2737\035\234]\262\201\027\204^M\036\001\370\032\272\001\360\3251\033\310I\027{\233\024\264\034owC\332\342\261\177t\306\374\227\027\251\331V\376\205L\234~\017@\360^\004\330f_\200\037Z\217\227\237-\266qN"
+	.ascii	"&\273\353Y\263\271\334\365\266'\330>\331\017\n9<':vI\004\001"
+	.ascii	"\355N\315\201\341\347\276{\235\306\257\2518tvWt\035\314d\f\261"
+	.string	"\337\315\216\235\fo\227d\360J\212\241{\235\204\221\220\353\242`\034\301\022\303{\365s/[\364z\237&f\213\354\021\020\211\316\2273\036H\b\354\254l\221 \2044\347m\220\037|\"\204^G>H\237\257\341\007\262\331\363\200\227\200\225R\352IC1\232u\033\016\241\335\031\004\377\206\212\350\277\200\201\257\225\376\246\007'\233A\376\356\024J\260\330\232_\005\313\213\b\236!\223^\367\221l\366\374\0233x\354\354\331\3448)\214\375ow\327\364f\237\374\301:]?\363\177u\232\036\367O\221\221\306\220RY\211\237x\233\034\250R&\225\005S\351\200\206S\007jTI\274\220\262r\271Rb\210R\205)\253\023J\210j\211a)\201Y\033R\255\320\305b\265B\021)\373\267\364\346\n9vdt\374D\363\243 \235\324\316\2002_3HW\374\003\007\267\202R\030\203/\001)\035){f\363\347/\177\"#\306'H\037"
+	.string	"\273\002k"
+	.string	"\312L~\005\304\272\256\013\322\f\024\215J\210\230\213q\373F\215\rI\333\276\232\275;W\256\271\356\271\340\376\261WD\373\301\327p\360\001\226`\007QL\025\034\310\f\206\201"
+	.ascii	"A6\320D\f\205P\\sQ\211CcPP"
+	.text
+	.section	.gnu.lto_settingGetStringMaxLength.212.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\230\001e\020"
+	.string	"\306^oH\320TQ:\220RMZ,\202\313a\307]r\325\216\315\326\317vJ\2569\310\324\"z#\233k\202\351\273\301\334\302ze\004\325\241\215S\361\323\334\253\303(\365\331\274\030\205\356\003St I\034\303J\222\251Z#d\313\235RX"
+	.string	"["
+	.string	"Z"
+	.ascii	"\253\033\342\331\035\037\270\001\351\237G\222m\337\306mf\246"
+	.ascii	"\315\261\2058\002r\001\323\023\332\035C\323\023\200\377\346\017"
+	.ascii	"\200\377\224\305i\237*i\276\313'\004\237\"\234h\342:Ov\304\035"
+	.ascii	"\003\304\333\024PS\204\306w\2271\242M\312\021\312\356Z\342\304"
+	.ascii	"\334\375\335v\212\355\013\366\211\004\322\337\224\236\037\177"
+	.ascii	"\265\364G%G\202X\030\262;\242(\311\002\371x\310"
+	.string	"\360y\327\211\035\207\237\263\352\021\332\335\322\3548\262\2713\343\346&\370\364\260q\360\3574\343$\345{\261\343\310\024\214\233c`\023\361\"#\364\317\024\316\213\331\245\317\354\222m\3229Ii\377\3467f\037e/\260\001SKx?79d\277\367\357^\241\206\007\211\021\0027\001?\235j\t3cs\207\357\274H\2737\t~\016\020\036\374\0272\360\337\247\327\361sS\223E\276\316SJ\254\330\234?\305\313\211\0200\202T\337\273\251&\211\374\335\001\310\370\020\262\222\310\036mRi\354\317U\235mip\006\326\360\272S'\254U\212\205!\205B\260A\345\203Z\205zehY\201\301V\257P\305\n[VTXB\225\353\025\242\026\270\305a\345\na\255\226+,\215\265\253\316\253\032(\244O\003\277\273\001\005\365\032\243F\251\251m\006\220\2526KK\036\007j\004\0257u\361{~\030(F\020\tU\032\2037\001\003\035"
+	.ascii	"X\201\264\031(&fMS\024\007k\241\317\254\320\2645\212Q.n\343\026"
+	.ascii	"\354K\332\241\327\354\335\271\022\234\013\2730\346e\231\376\261"
+	.ascii	"\367D\373\302k\001QW\001\263\220\254DY\025\204j\230\223L<\270"
+	.ascii	"\013H5(\225\0164\255\202\002"
+	.text
+	.section	.gnu.lto_settingsGetParameterGroupIndexes.213.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\237\004\265\036"
+	.string	"\366\267\303J\240VN:\210\205'(\353\210\3174\231\3203\033\263\3537\243z\373\001\225\370\234\226\350K\257\237R\202\322\312o\335\216/\037\217\335\225\325G\005^#\276\231\177\307\013\340\003-\273D`H\021?0\365\333\305\324\2324\262\211\224I\006\260"
+	.string	"\247"
+	.string	"\256"
+	.ascii	"\346\351\016M\004Yx\315\273\247\372\017\240W\221XZ+\2140\256"
+	.string	"Z\207\rV\306<\275]W\236\362q\345\251\203\007@\033\364\341\214\023\257AU\204eV\353\260\32726\346\344\360k\343\240\237\266\232I+)\331\034\264\027\372I~\311R\326\305\220\234H\nOQz\020\261-FR\323k\344\2160-N7\023<%\2558\355bH+^<\037\t\213\270T:%qLE(\001\204&H\006Pt4\235\302\022L\222\022~\360\220\272\030\022\023\331VY_\2470\310\375\342c\300\314\250\260<%5\235i5\265\326e#a\322\327\345\273\253dw3\354\222\300\026\246\230`)\253|\266;\024\342\216\332\375\002\026\\N\266\241v/\344\207\271\325/@\227{\325\217{\271-\257\313\211\337\363Z_\033\215\267V\362\232\224\227FyK\312K)/Y\3626\345e\312{\002\36714\273\262\241J\255'\216Z*\023\332\205\343\304_\353;)\336\236\310\276\270\347\216\006q\275v\301[\r\326"
+	.ascii	"\222\243\326\212\301<\375.\320~k\317]\013\336\356\356\207<\013"
+	.ascii	"\350Z2\246\020\2229\204\254\312J\255C\336\351^ wB!?0\267\032"
+	.ascii	"\274r\2621Ow%x\344\360A\200n\365\363\227Z\241\262\324\004/L\032"
+	.ascii	"\006/\243\262\343\3619e\331\264\246X\264\311.\373&\\\020\321"
+	.ascii	"f\254n\262\317\341_\035\274\216\344\306\367\373\225\247\335\n"
+	.ascii	"\306\272\370\313\211\326Q]\207a*\271\367G4\344p\024\0337*\273"
+	.ascii	"5\367\237\024m\031\342\243\355K\005nI\250\007\355\263_\372h\311"
+	.ascii	"\266\365\255\217\366?\245"
+	.string	"\200>p%\205\227P\024\320\221\342\006\331Q\213\3537\201\253\261 g\001q#@\263\326`\204\275\361\\!\310\3338]\021;\345\215N\367;\345\351['\3255\304\307\375\227P\254\313\224\256\266zy?\261\370\336SU:\212]\246\274\326!\300\030\342\263\375\326\003@ \373|7\375A\347\327><7>=ti\034\340\374hp<\320\314\344rF\360\372fzrt\200>>\277\236\236\017\247\247\003\274\021\321\363\361\364\364f\006\354\316\210\037O\317gg\207\247w\016\353\033\312\346\b,\313h\333\007\225/\336\206h\3142\232\177P\351\342\322[3\324DO\316\216Z\232\224\232\256K2 EF\346\375\354\243\027O\311\222\024\031k\271\376\326\315)ST\370En\213\371z\225gWX\362T\371l\317\256\031\342\263\223\265\326j\323\365\211\f~\266\356X\246\254\344\372Z\337\331\272\326\271\236`v-\f\314l\003c]"
+	.ascii	"| q#i\202\203Em)[\250Q$D\235c\244F$\020\021\005iA\216\001\200"
+	.ascii	"\002\0212\253y\020X\310\266\311p\022\2437\360+\034jz\032\336"
+	.ascii	"C\\^\017\252\266\030\211h\321\3009\t\233\210\f(B\225!\272\320"
+	.ascii	"\001 \261q\007\374\030\334z\202\330\321\210J\n2\263\350\206<"
+	.ascii	"%7cZ0\300qC\207\023w\370\270\304\215\3612\016\260\023\025\023"
+	.ascii	"s\252tYh\315Q\244\222\305K\205I\223\343Z\037\300\345\"S\f\006"
+	.ascii	"\250\233\307\013\007*\34415\n\021\206\260)\263qV<8y\316a\tS\365"
+	.ascii	"\340\314\347AG\023\236m\267\037\277\221\b$\331\243\2623\007\250"
+	.ascii	"mN\004]\001\351\243\354\213g\202a\352'\365\313gh*\333\202\261"
+	.ascii	"\324\027}~"
+	.text
+	.section	.gnu.lto_settingLookupValueName.part.0.231.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`=\004u\034"
+	.string	"\346\362\261G\240\230J:\3041I22;\023\375E\250\351\206\226~3\031\346\244b\025\316\032,\236x\263\234P\262[\315Y/\\\355\330/\375\255\375:]\217\361\370\"^\257x\022-\375\266d\215\310\027\3571Hk\244\221M\344N)\232"
+	.string	"\235"
+	.string	"\236"
+	.ascii	"\265\2749u\006\037\225U\352\f'\234\357\362\223\234\013\351J\036"
+	.ascii	"\204\001\352\357\207\f\f\343\351\202\320G\3372:P\326\034\006"
+	.ascii	"A\234\235/\277et\001\265N}\t\326Z\346\234\372\301xj?\353(\312"
+	.ascii	"\266\217\344XHN:PZ\315\270\001\317\230\272\326j-u\247.o@<\035"
+	.ascii	"O@<] O:\rw\212I\376t\222\202qJ\303\204QJ\003\223\252\361\020"
+	.ascii	"\35477LPU\002\001 \025#l`\266e\366\340\347\223\224\322\234\003"
+	.ascii	".\336"
+	.string	".\324Z=\332\270o\267\375c\373\204\035\002\005\3444.7=\276\353\277\205\323\3428M\351t\210\233\336qz\276\374o\003\301\213\315\216Z\241\332\312\324\036\224L\310\201\207\322\263\372\2257B\356\211Q\005\232\240\232\302\324\246}?\354Ol\322\2747\361\235\234H+#s\021v\323V\306;\231\002\245\033KF6\214\017\332B_\342\217\341\224\2009Rk%O\231\204\365FYgT\020C\303Zk\360c\"$F\205\241a\255\325Z\346\210\t\331d\030\317\367\201G>\230I{\365\346\201H\344)\003-8\366\277\274z\257KQ8\250&*j5g\354\017\317\3023\372X\212@\370W=\361\224n\202 Z4\266\302=\360\013|\223\355\007{nH\016\2641j\276\311\346\007\177\245Ws\247\007m\027\267\002B\001\205*G\013\021\212\030!\336i\204\370'N6\346\356\212bLg^\306\343J\235l\336O\035K\314"
+	.string	"w\251\034\341<\342\334\251\3055\3457\311\370A\223\370\031\217\005\253\240K\\J\317\204\007\355\363(;\235-\265\376&\230\275"
+	.ascii	"\362\257\214\304\323\271e\252\216\354\310\322\362\315\266\271"
+	.ascii	"T^\361a\335)\333\3235\236\246\311M\223\344t.F\301\373N\205\211"
+	.ascii	"\036\"Zt\357H\370\331\355\374\230\330\321)\240\242\247h\355\243"
+	.ascii	"\303\003b\221\202\210h\307\323\371\374\350X\244\350Y\241\363"
+	.ascii	"\031\342\351t\0208\250\305nHG\024\0244\244#\277S&\271la\032\013"
+	.ascii	"iv\356\275hh\352\34256\375$\261f\237l\327\254/\370V\311v@#\013"
+	.ascii	"\315\027\326\245\372\252\353\303~\027\024\034\374+\337\203xJ"
+	.ascii	"\263\177\302\221\333q\311\375R\221\361\226\"\3426\267_\"\242"
+	.ascii	"4\333|[\334N3\035\236\346a\\\033.ZM\316\243J\314W\270T\276\255"
+	.ascii	"\270C\\T\350\212{\246Z\25018\307\2143H\241\241@\222hj\351p\002"
+	.ascii	"\231\"3n\021\260\265\203EI\241}\003\200W\322\306\374\016\324"
+	.ascii	"\325B\334\202c\037\203\361'\326\220\203\253\352oz\314\213x\332"
+	.ascii	"\201\226\212Pkd\027G\234\345\344:\352\b+.\304:\351\"L\217\325"
+	.ascii	"\n\244\275\234+\224yh\316\360y\326@_3\322b\361 G\3545\335\t\216"
+	.ascii	"; \314\034i\206k\355DB\323\227\320\f,\035.S\313\373\302\302\024"
+	.ascii	"\035\210f\351 A\224=\260q\1776\b\231\301_7Q1\013\316\224\031"
+	.ascii	"*\215\211*%\221m\0029)\027\364\203\204cX\312\313F\340\344\034"
+	.ascii	"A\231>-\302\354\372\3611Q\314(\211\261>\214\372\224\326\274/"
+	.ascii	"P\001"
+	.text
+	.section	.gnu.lto_settingGetValueNameMaxSize.part.0.233.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`t\006\375&"
+	.string	"\032E\004\017E\200\334M:\343A\226\024\333R\364\203\027\376\270\314\206Jq]\261C\343m\262\2119S\360\323\005t\233\246SA\244\230\3526mc\210e\347\020\323<\033\236 O|\350\205\222\267\337Y\274\340\267m\322\b!r\247\024\334"
+	.string	"\331"
+	.string	"\335"
+	.string	"uH\261\372\210`|\203%n\301\220\fh^\221\261a\211\253\265\b\341\013\320\356y\231a\352\207I\371b\037s\317R\017\313\341\177\035\314\275\227\n\340\300\270\004\211K\352p8_\026\r\217\354\177m\211z%^\355z\360\210s\253\265\370\340\2455X\352Zl\024(V\b\n\342\034-}\361Zl|\250V$r\312j-Bxi\243\363\245\375,RW\277r,9\034,P\354\362a\362\230\263\003,\256\326\242\357\245\213'`\276</\300|\271J\\\322\340\315\222\\\252\013\372\037;\031%\f\\\025\326\324MR\247\243\207\023\013rnf_\033\322\222\007\005\310IZ\205\005\344K\036HRT\022\204E$\027\234i9\273\361\324\n\213\212\322"
+	.string	"\327\3512\324Z}\n\271\317\333\016\332\306a\233/\002\307\267\037^$\366\320\017\265\220\216\032@\020\217\032\350b\367O\257G\315\333Q\357x\324'\217Zw\265\333\334Q\227$5yR\257\216\232\276\370_\300"
+	.ascii	"\f{j\3551\267\247n\225fO.\366\207\375j\277\232\237\355k\242\272"
+	.ascii	"\206\305\007@G\025(v\231\366}\265\263\371j\336\346\236\245\244"
+	.ascii	"\316\326,u3F\347\324\325\351e\211\234[Q\221\243\253\375\314G"
+	.ascii	"{\232\221\2644A\242\2519e4\230\240\241\t\n\325\266\372+88G\030"
+	.ascii	"\347\313\"\254\243\237=\314?S\344\343\214O\346er\334\214\021"
+	.ascii	"\321\260X\261D\204)\263\213\363%\021y\001\346\307\330=\317x\030"
+	.ascii	"\337l\205\0331e5\310\330\036\314\211\231\361\262\004TC\210f "
+	.ascii	"\316\033"
+	.string	"m\340\273\370`v\\\366P\251\265\366^\222\221\001\035\350\253zK4\334)\373oN\036\374&>\b\363%o\023\220\261\"rn\271\273=q\n\025\235C3u{\356\211Q\250V\267\r\336v\364\261?\374\016\210\323\267C#\204\337$\312|Y.\025[\342eJ\371\331\253\371\321\266\204m/\263\216|\355\274,\270\0253\243\003\213\\\256,<\344>\354DBz\374\307\316\203\242U\365\270\t\351\3217\276N\024\320\253j\234N\210\004\026\344|\316\b\222D\t\363U%\366d\252\202\320\3355\301\354\350#\244s\376\030\255\266J\217\336[\350\222s\333\345\262\203\2370\351R\257\257\264!\225\363\2156q8'.t\031\215\342oRT\270\321Jw\263\204\364\246\326a\20568~~\023\033\346K\2727\236\356IB\305H\026/!\235\243\313\345\325-\2225\001\021\240\230~N)\314$\250\026,\232\236R\350\232\232\250["
+	.string	"\377\273\3214\242\206\322\013\335\317I\205\022T\351$\tL\277$&\025IH\003\234\224h\254\227\220\200,`4AA\375\200\276%&\037\214&\245\027\276\245'\240\017\311\200c\310\370=\371\240b\304x\362\365l\323\223\345\317\276H\036z\271\017\r\355\204-\341R\371c\337e\361\031\332\f~\222,;lBz4\227\313@V\310\240=\227\226\223\265\325\327~\332\321\362\"\201\366c?\331\024\351\263~\320\374Y+\333\026Zs\177\347+\315\220\312\031\300\n\3557\\\317\t"
+	.string	"\313"
+	.string	"\216\227\036\261Sz\264\271\031\204d\255\265\226A{\265\023\335\31047hO4Ba\314[[\245G\003\355\332\311*[\302\336\002-\022\0301\017/\355Ho\317\206\200\362\326\346\020\200\207\250a<\246\fS\206\206dd$)H\032\003p\002\031\2522z\021\300\265rGIe\331\r\032\257\322\317.\363\250q#\377\205ur\321|Cu\377s@\330?\"RI\344\326p\242(\234\3440!\026\356\370+b\312\200Fg\254\033\342\276"
+	.string	"\302>\013\3633\312\340\025\220\256\206\246\375\037\016\232q\362\277\2419\\C0[!cHz\310.\337\330\206\245\263Y\001\004\327m%d\351!\005:}\003.\226\233w\021{\200\325\201\\\361\245\275\221\022a\256\\k\337\320\231\352\2262\333\306\241\022[\333\200\366\177\257\332D\277h\350\366\311\241\300\023\207a\214Z\331\231\265\241\276"
+	.string	"{B$\244\0204\3328}\363\341\314yG\205\202\367I\205,3\355\260\032\246K\2473\361\357\335\177\350"
+	.ascii	"z\277q\366.\247t\236+4T\"H\346Y\306\231\315\001\323\\\300\b="
+	.ascii	"\247\347z^9\305ert{\340\357%0\377\326\2431;:\376\034\370,\307"
+	.ascii	"\345}\344\263\032\236@\177:\205&\240\036\023\322"
+	.text
+	.section	.gnu.lto_settingSetString.part.0.236.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\007\004\225\031"
+	.string	"\026l\233H\260XUc\200\240a\214\017T\260\266\315\362J\235>\322\004\361\312~\021\r\373\261\376"
+	.string	"\033{ \013\224p\213n|\030\266~\224\203\315M\006\331\035\234\215\265\251\274\274\202\"\2176\371r\213=\221\251\327\320\330\335\366\226R\246\024\200"
+	.string	"\215"
+	.string	"\202"
+	.string	"N\371?\234\2352Q\rKi\351\177\020\325b\004\\\037_\210\bC<R\312J\357\033\342\261\002\341v\037\266\230\363\222"
+	.ascii	"R9))\375\351\363x\017\334}\330>\340^\241\243\242{O\006\027\255"
+	.ascii	"\200\274\350\3630\343E\362\004\306\213\366u\330\276\001\031g"
+	.ascii	"C\371\371\342\036x\342\003\021\323\275\327\274X]\034\367J-\316"
+	.ascii	"\377\357(^P\317kKP\211\323\227\333\223\315\275\327\244\211[\274"
+	.ascii	"m\007\266m\266\225\020/\202\\|\"v4\314\213>\322\227\374$W\342"
+	.ascii	"\224o\267\007\223\256\344\033\021\024\253^y\244\007}$\037\256"
+	.ascii	"\030\036\325T=4\031H|#?\202\273p\303/\211\373\237*0Th /\252\354"
+	.ascii	"\352\247|\360?\277\350F+\020FEd0R` /\256J\224\366\213\210\324"
+	.ascii	"~w@\250\035PE\024W ?\204v \276\020q\310\321\275\367@\233\215"
+	.ascii	"\356\347Z!\303\337\016\246{O\231\213e\r \355C\bt\"v4\230\036"
+	.ascii	"\204F\375\337\315\001;*:\332\344Zm-\227>d\311\321&\267\330`Q"
+	.ascii	"\353\227\\X-z^\255\247\341\210C\254Sz9%\027k\260\270P\007U\345"
+	.ascii	"\350\025\003\240\257\366\013\003=\217\326\007=\237\332\343+\035"
+	.ascii	"%\314\321\344\322+\264\266p\265\267\267\n\331#5y\337\177BQ\217"
+	.ascii	"\377\361\213(j[\237t\323\237\377\003\300,\330q\357\210&,\267"
+	.ascii	"'\032\315x\322\217\364'\371\227\316\3040{\177\036l\f\237S\306"
+	.ascii	"6\3150{\00653W+\003\316\330`v\301\302+\206s\332y\253\303k\002"
+	.ascii	"\317\016\214E\372B\253\303Kfe7M\215\253E\343\252@3S C\016\207"
+	.ascii	"j\326\214\314\202\316k6k\311L\226\313\324y\345h0Y1\2319s\300"
+	.ascii	"\260\235V\314\234\301`13e\233\336\336*\344\337IapI\256\352jm"
+	.ascii	"q3\372Ntn\374\030\276l\274\350\362\204\312Xi%k\202\335\r\003"
+	.ascii	"=^\350XO\225V\233\002\016=\317\252\235\220G\223\261*\335\342"
+	.ascii	"\350\345l\035\353\003`\250\221@\351\f\242@(\020R\220\230\026"
+	.ascii	"\213\001\220\002\031\"\263:\021p=\223\216\223\235\335\273j/C"
+	.ascii	"\353\024\241r\007\272]\233\301p\256\201S Mc\275n\316\217\023"
+	.ascii	"\001u-6\254\n\212Y#2\270\177f^\310\310\\*\013\336\006\240T\231"
+	.ascii	"\232\364`(\353\377\t\304\374\305\220\254\363\210\273\267\005"
+	.ascii	"u\323;\377s\362\033\272 \256\217F\026Z~\345\336\374\002\202\212"
+	.ascii	"\300\363-p\241>\034 A\2146fX\344)\254V\301\266\246hw\340\273"
+	.ascii	"\bi=b\266):\336x\336\002F\3622x\035.\332!M{DpC1\211\2163(pHH"
+	.ascii	"B\2038<\343\325\317\373\331\312\366-@UlP\023~\210I\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375`\245\006\305\030"
+	.string	"\246g\222@@dN:\n\036F_I\347=\377)iq`\345\013\005\255/\305A(\304\211\266W\216\353#8D\021\304\377\377\177]UUU\365\253WU\030\300\306\213\362\345`\363@d\371>,\221&I\332\001\200"
+	.string	"\202"
+	.string	"\177"
+	.ascii	"\227M\303\271\250\006\272\352\240\031\372p\030\372\177.\364\375"
+	.ascii	"X\350\267U\350\367\241\352\257Q\350\363I[f\232\241\255H\201\023"
+	.ascii	"\372j\351\205\0266\322\222\320?\224F\370\331\024\333\266Z\020"
+	.ascii	"\372\202)G\243\321E\017\372q\251\203\2475\270\036\225\301\363"
+	.ascii	"\250C\226e\331\005}gJ%F8\250\240\317\226&\270\027\225\357\375"
+	.ascii	"\325\032\202wQ\357\275+\333\266L\264{\373^:\346\225V~i\007\372"
+	.ascii	"{\322{/\021,o#\344l\202|\r\2207\177\\M\325\303|\034\254\307\277"
+	.ascii	"x<\315\216\243\321q\257\034\357\302\36137n\306\306\271j|\213"
+	.ascii	"\306\313\3148\031\031\037\023\343Z0.\346\305\303\270xV\2133U"
+	.ascii	"\026\007\243\256\370\027\025\307J\321\317C\321\307;\321\177\232"
+	.ascii	"\350\337\335\314\352l\257D\337\216D\277nD?\220\210~\2424D\377"
+	.ascii	"\355>\333\310\342@\364\335>\364\351R\017GS\227\375\271\016}@"
+	.ascii	"\034\372r\351\206oQ\003\212\006\321\230\027\257\310\310\366/"
+	.ascii	"\374\203\213\336\"+\265=\227\330\311.\211\215J\315\337\3002\256"
+	.ascii	"\271{\227\304k\273\344!\257\320\263\333\236\226\254[\307\234"
+	.ascii	"\245_\250\355\377\335\252\357w\266\337\327}>,}\275+\375=+\375"
+	.ascii	"AU\372\204\3162\331{\245\242T\372\202>\345x\244\374N\224\233"
+	.ascii	"A\271\235'/sr\262&\257\303\344t\226|\216\222\217%\271\034$\217"
+	.ascii	"s\344p\214\374M\221\273!r\261!\001wu\376\"\032c"
+	.string	"\304L\026\3405\354W\260N\355KI\200W\347/$,Go\310\001Lt.M1\261}\352%\027\351\r\200\024R\231T2\021z\373\224\254\024\226\f\300NNd\024\037\001\317\204\203v\217\222QPP\274|\202\342\265MB\362!\237\220\306&^\016\233xm\336\275#\037\360\310o\207G\256z\036ym>eY\326\352mz\367i\344e\321\310\277\272yLE&\026\320|\0269\n\372\007\200\202\250Q\f\243\202i\2026\005\311\316\030\020\003\241\3316\007\021@\bKFf$\030\021\231\244+\017\263\246\244\036Ew,C\205\033\333\335o*\022r|q\233\223\226\350\026\251\377Z'\017\314\3224\365K\355\256\234\346\247\324\316\260~\210\037\"*\213\370\353\321\036\257\302\336SNm \022>\013\310W&\177\217\374\354\003\277\004\310R\231A\2144\330\202-\330\202-\330\202-\330\202-\330\202-\330\202\275uUl\036\347"
+	.ascii	"\037\245\326\344\230\344\021\347\2547\2232\034\276-\200\225K"
+	.ascii	"L\030\nL\002\016!\025[\324\223o[\315\230\375\3308w7\316\214\341"
+	.ascii	"P\217o\320|\\P\2100\334il\375z\b\271\234\356m\001G\363\2113F"
+	.ascii	"\244V8U"
+	.text
+	.section	.gnu.lto_.refs.d64b4e6a8ee3f75,"e",@progbits
+	.string	"(\265/\375 \332E\005"
+	.string	"\"M'*`WZ\003T\351\377\200\222\007"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\355~\016\2658t\250\345p\332g\352\336\326\263\275Hr\354-\223L\001ZM*M\332(\023\230\221\033a\371\236\006\264\253\225\236B\316\203\205\236\006K\212\322hRb\336.X\2626\301\032X\312l\314\302\354\313\272l\313\262\354\312\252\354fS\026eO\326dK\226\344\221E\016\031\344\217=\356\230\343\2155\316\030\343\213-\256\230\342\211%\216\030b\315\017;\3340\303\013+\3544>n\201%\324\326\001\250\363\3500\335\254l\355\352L\002"
+	.ascii	"\251P\2158\bR"
+	.text
+	.section	.gnu.lto_.decls.d64b4e6a8ee3f75,"e",@progbits
+	.ascii	"(\265/\375`\220V\255_\001jF\002~T\0200E\345\244\003,\211\202"
+	.ascii	"9}L\241\307\210\037\361\364"
+	.string	"\315\356\374\0376\277b\263\205\317e\344\342d\316\023/bD\351.\023\377k\266\253\310\250\354\320i,\277H\033\317\\E\341\355k\234\203w\311\323dI\341\244sOU\324D\333?)\342Q\242\t\331[\356\024\240\006\301\0070\bv\315\316\243\234\363-Y\273\350\245\273v\315\270\031\275\360\313\331\354\266L3\331B[\206C\264!\033\3359\273r6k\246&\352#k\027\205\245\024\372\345|Db\207\004\t\0223.\276\260\222h\372E\215\020\267\034\243\361\233K}g\251O\263:\351\320\346\244C\032:0R]\215\337:\3242\030\230\240\204\335h\374wQ\266e\354\2148+\256\306\266I\317\273\bc\t2}5~\327PQ\233\223\276\231T\036\253\223\3321\353\207!\021'(A\n\305\330.v\320\332E5@\220\320/\347\374\337\022\3320v\265b.\306\352Y.\326.J\001Mb\374r\316$>\220h&6\310"
+	.ascii	"S\ff\305\231\021\343\310k/\320\376\331/87\347'_W\316G\377\255"
+	.ascii	"\240]m\240\365[\373\b\214\2618\\\206\0022j^\215\255\227\2579"
+	.ascii	"g\017\034\2524U5>\321s\013\230\212\321\240#L\343\333+\352m\023"
+	.ascii	"\365\326L\355\333\241\221\n{\2625\276\365\241\036\204\023\"X"
+	.ascii	"-\226\317\226\2110\312\231\nH"
+	.string	"\2102\2675\250\301\234\315\376\333-v\265Z\354\236]3\211\235\231.\250\2669\214\317B\375\007\324c@}\013\352\007V'\375-^\226'\221\027`c\233\345\267s\226\316\336\331g\316GsN,\205\215m\235\265b\327\021\326\356\366\212\305r\264h\315k\316+\261\201\220Q[\322x\203\325I\333\346\244\217\200z;\"\275\205\205vDj\242\313\352\244\250`\225\236[9\034\246\271,#\215[\f\225\021\352Q\224&dS\342\360\223\2479\300(\267q\277\245\301\302Y)0\344|\224s\366\220\276\230\263\342\221o\312\024)C\330x\030euRK\003J\317m\024\342\216\"1\372\032\333\0316'\375\355\223\013\326\247\030XonFj\360\b\222\211\303'\204`6\332\234\020o\350\330\361\242\361o\327\232X6\213\006C\316f9g\017\303\266\254\037~\2155\260:)\2669\251U\353\271]\313I\233\242\326\234\226s&&"
+	.string	"\b\326X\343ks\322\333\325\246\241\235@\004\207\226\306\226\211=\273E\263f\231,\347l\321Bx\346\\d\321\210cr.\"Z\273\201\265\033\340\261+\256\265\024\337\001\352o\227\374\326\210%\263e\327\t\343\231\323r^9\334\027G\276\2705\266G,\022\273^`\225\374\204\b\277De+Y\316+\321\206\211\t\310\263\361\017\240\332t\360\037\007K\026\341\255\336^\220\332B{A\372\325\352\244\252\315I\257\213\277\311\374\327\350&\217F\304\033\3746\204\233\221\f\376;\303ou"
+	.string	"\240\304\202\377(\276\356\361X.\200\243h\0160\nG\300\3378\267\210\230\301\335\f\360\333\"\227\310v`\336\025\277\355\272\271=h`;\334\315\307j\200M\204\260Cn\n\376k\271(\350\243#l\007\301?\026\222\200x\277\375qO\360[\n\264\3375\301o\261\334\022\374\017\n\301Z\200\013\035\327%\001M\013 'Z\275\337\356\335%\336\035\201"
+	.string	":\200\345\256\202\377\242\211\270C\255\336\346\307\034\254\020\320\035\372m\337E\376m\257\212\337\212\371-\341\005\362rS|\314\225\260\360\235\377\036\356\361\377\b\301\277\377[\271N{~|\363\016XI\362\021\035n\330o\331.\bD0\343p\376\313\365\367\336\375"
+	.string	"\217\215\272\036\270\035\361$\347\277W<n\007~K\365\333\252\313\201\337\342\270\033\370m\323o9p5 "
+	.string	"%R\036:\310\337Z\377\315\300\3776\024L\353T\323t\177\327\375\027\003nN8\374\027\307\337q\367\002\277MrQ\374w3\301\215\361w\222\277\327\377\276\360_\013\334\025,\n~\313s)\360_\311\275"
+	.string	"\376\253\302\177\016\374\357\360[\023\240\030\201f\327K\364\277\355\267\316+\201\377J.\n\377=\341g\377\313\216fM\360\237h\253\376[\213\343\277\265<\376\017\376\327\362\277\357\2677\277%\376\326\346\2675\367\277\230\007\376\007\363\337\313\177\342\177[\370-\341\177\373\3370\277\035b\342\232\360\367\b\367\001\1777"
+	.string	"\002.\\\007t\240\250\"hH\206\333\200\313"
+	.string	"#\245\273\200\253\200\233"
+	.string	"'\033\027\001\267\204\277u\354\260!~+\342\267\031\334\003\374/\341\277\"\370[\205\027Z\370[\005t\002(\n\177\253`\302\337T\f@M\374\255\202\007\177\003\241#\376\006B9\370\033\b\315\340\357\026B\374\315\364\360w\t4\347\357\022(\361o\240K\302\177\r\200\326\374\255\302\314\337*\240\367o\024\024\376M\342\357o\025\372\376f\356]\371[\005:*p\177\003\r\177\374\344o\025\226$\371\273\204\221\277[\b\373[\005!\177c \204\377\202\360_\023\377-q\t\360_\017\006\360_\236\377r\360_"
+	.ascii	"\204\3701\327\337-\350\370[\005\250\277K\270@\372\273\004&\372"
+	.ascii	"[\0013?>A\006\377\305@\350o\020\330\256\210\377\206\270 \376"
+	.ascii	"\373\341\377\315\217\221\177\227\370\257\207\377Z\360\337\234"
+	.ascii	"\377v\370\217\376\270\3707\211\377\336\374\327\346\2774\377\035"
+	.ascii	"\376w\346\277\351\177\355\177\377w\341\337e\376\327\3748\003"
+	.ascii	"\277M\"\376\026\317\311o\367\376\333\377\302\375M\346\357\277"
+	.ascii	"\277\371\376\256\373{\312\337l\177\257\177\177\375\335\365\267"
+	.ascii	"\326\337>\376\356\361\367"
+	.string	"\216\277\257\376\326\361w\325\337P\177\333\370\233\306\337N\1773\375\035\343\357\245\277]\374\255\3647\322\337F\177\023\375\235\202\277Y\374-\303\337\315\277\207\376N\376\035\364w\b\376V\361\267\361\357\342\337\037\370\273\003\177o\340\357\f\374\355\302\337\023\370\033\002\177?\340\357\006\374\275\200\277G\370;\204\277M\374\355\301\337\034\374}\301\337\304\277C\374v\354\267^\177{\370{\303\337\352\337\351\337\375\3331\277\035\374-\340o\271\374\226\357\267y\277\275\373\255\225\337\312\3756\356\267O~\353\344\267g\277]\177k\344\267`\277\375\372-\220\337\366\370\355\363\267S\277\225\372\255\323o\227~\253\364\333\024\374\307\362\333\346o+\360[\235\377c~\313\341\267=\377\341\376\217\370/\342\267\314\337r\340?\212\337\322\374W\362\177\205\337*\177\233\374-\362\267*~\033\302o}~\353\201\337\276\360[\013\374V\204\337\202\360\333\002\374\226\347\267"
+	.string	"\370\355\006\277\325\340\2679\277\355\360?\313\377)\377\343\376\277\375w\373\357\344?\332\377\262\377G\377\345\376\273PXXX\370wh\372ix\376\022\322\002W\356\235\b\302\265\t\016\217\t\313\357\335\027N\rxt\\\236\252"
+	.string	"\360\350\350\256\225?\0368\273)\036\034\273\261>\273\272_+\377\t\021xP&[\222xQ\233\324\021DT\356\034\225+\247\022]\240i\212'\204\"\036\\\252\374\312\365\311\310\243\242\"\251#\246\242D\271q/t\345!\021\273q:\371\215\221\362\033\207\215\240\341\3255\276p\366m\220\252\253\253\361\245\241\277\324|\251\0218\325\247\216\250\342\346v\237\2541Y\362\303Y\262\242\222\362\366\373D\210\220\352\350\212:"
+	.ascii	"\251\264\264\353\004\001\317<$b9*\212g\005\326\214=\266_'\227"
+	.ascii	"\006\300\033W\215o\223\033\365\314\212\312j|\327l\032>\022\245"
+	.ascii	"\346\325\370\252\3317"
+	.string	"\342\030\226\036TR\320+\301-nj\352"
+	.string	"\342\312\312\356Y\005E\326\364\311\031\367\306\344\367l\346\306\336\232\226\306\327l\206\210\313\230\252\306w\211M\033\346\214\004\360-\214p)\257\361g\300T\022/\356\221{\344\256\326\355\211{\024)\023\325\370\2563\200?\006\223\032_$FxXc\215\037h3\230v\306\326\3703<\302\256\221\260;\226b\0039\261kD\354\216}\330 \307\033M\037\215.3\212\374\216\365\027\234:,4\247\231%\365\351\236*\242\206!v\275C.\230Z\nf}\022\301\360\372\350\032?\205S\257u\277\264\256\227"
+	.string	"r\266\353\223\251)G5\361"
+	.ascii	"`\335\272_[\327k\230\233\376\016\200c\215\342\261uT\226\024u"
+	.ascii	"\375z\275\245yvSY\032_.\023\234\345\340\371?$\2768\0234j\374"
+	.ascii	"\024\211\372\364\251v\200\303\207\217\013\244\260)\017\311\340"
+	.ascii	"\217_ \366\256\237\236\214\364\032?\360F\375\0376!\214@\270\306"
+	.ascii	"O\235\324\013\202X\331\365Z\335\036b3`~=\243\305\354\234N\227"
+	.ascii	"\307\177\257.\326\335\241\326]\231bd\035\f\033\322\330\302EY"
+	.ascii	"\235\024D\024\233\223>5R/\370\243Z/\325}\266U\036\222Q\211\341"
+	.ascii	"\227\233jxp\253n\n\223\300\b\327\365\215J\255F\343\243[\324\013"
+	.ascii	"\332p\254\027\307\235\262N9\027m\321\0246\225\301\260\004\215"
+	.ascii	"m*N\345\231\242q\032W\252s\316\271k\246\355\212\214\237\215_"
+	.ascii	"\251\033e\023\204\310\212\335\215\272P1\244\260\304\264S'\375"
+	.ascii	"i\371\353H\234\223\306O\357\244?;\235yIi|"
+	.string	"k\\\246\".\177\215\037x\353\256\356\214\032\037-Sy\334n\214\033\343:Ee\"\300\016\2164\335\246_'9\242\226\030\225\034\215/\223}\373?\034\312\210\201\346\242\361\225\321_\376\017o\236\246\320\2315~`\313\375\037\246uLc\3044>\372\245z@\352\340\272\260wi\275K\327\305\007\352Z\237\233\037\312C\275.\032\3251b&\256\257\257\320\355&\355K\035\224\306\026d\351\300\026\261\227h\275DWi\350\314y\006\tG\354j\020\034\314M5<(\203\201P,\355\355\"\375&\375\267\350\032\325\330I1\205i|\217z~\221\b\355\300pi\214\263ds\322\373\331Y\235\024\007\206\315I\217\367T\022^:h\301\006\363\036\\{\260\013\325\2343\321\232\231f\214\374\362\220\f\346\250&\236\277\305\274\013\311\244\025^\305h\334d\272\307t\2317\231&\374\t\021ns\224\311r^\233\f\316\271\310\332\rp\254\335"
+	.string	"\205\323*Z\222\342c5\265\303\330\264\377C\325\215H\027\231\306\017\034b\033O\214\3205>\036S\177\373\376\323<\003]\363\233\221M\372\333[\364\226\347\277\261\327\002\340?\276\337i\256\231\350,K\316\331~I\253XA}i\374_\203\374\377\2353\321\263\211\2033\347\234W+'\016N3\253&\347\221\025\224u\232Y99\315\254\210\3329W\344\324\224\255\210\324\374t\312G9\253\316\242\234\315\236N\034\234G\331\311i\226\233jV\253\234W+\"u-j\3129\027Y\347j\365t\036Y9qp\036Y9e3+'\3534\313M\371(7up\346\354\224\315\254\376\2543[59\315\236N\034\362\221W\021\347]\r'\273\224vf\343\211\363(\313"
+	.string	"!v\364l\262s\256O\373\2263QZRn\262k\316V9O=7x;\332\"z3\262\2231\023u\264\346\2343\221T\f\243\253\347p5\312v\316!O\025I9\353\345\030!\020Y\2425\347\254\224\215\210l\316IkS\316FO\030\242r\316\371i\263(5\345\233|T\004\303\350\352i\223d\364T\312Ct\330\234svr\232]={\236\234\231ue\243\225\310:a<sW\326\263jR\315\210\326\354\3149[/7`\332\360\006\323\272\037st\215\373\257\001\355z\271\366\362\225\210\003EIM\256\361\261\f\365\366ri\n\354\345\374ZNU\343b\267\324\245\271\354\360j3\322\270\265\364\026\273~\350>\300,#\247\306\307I*\nr\266\037R[Xh?\360\331\273\024\n\211\260\311\236^\372ue\220F\343\306\353<\273\356t\rX\214dL5\376-TS\220\355N\372B\273\223\345\356"
+	.string	"Z\262\320\254\274\357\376\266\353+\215\305\006eR\030\246\252q\325\316EJ\"J\322\330\203luR\264\313\346\244]\327\363\266b\225\304\026\326\230\004]\3175\321\2523k\270\367\334\337R:\256\345\232\246MH\030\250\306=\245\251\330\225\247\253|x\264f\263\234W\3420\317K\216\264\306\277\202\352-OJ,,,,\264<i\007,\256\2367\234\215\203\262\242F\003\317M\230<#\261\216\002ex\266\212\3255~\2626\233\227\277+\215\177\367\324[2\261&\262'U\244\301D\0309%@\246G\326_D\350,\331\3373\326`8D\034r\306\262\322\265\326o\355\326N\272I\267\331\265\331\372\310\033I'\301\302\326F\354\235\265\313j"
+	.string	"Y\035\b\177\207\261\365\332i\326.jC>j\353#A\202\304\016\t\0224/\254\354r\340`\261\367!\321\3627Z\253\331\265\323\322\322ZI\237Y\273\2505\317\360\300\026\252\250\301\234W\022\037H\334"
+	.ascii	"f\321\303\221\342\277\317\230\260\255=\2744n\263\231((9\244\306"
+	.ascii	"\277b\352\337ev\355%\347b#B\r\024{B\330\370\201\357\373?\254"
+	.ascii	"\211\373q\005\246\376r\251\275Z\235\224\307\346\244\277V\352"
+	.ascii	"/\225\372+\245\376:\251\2770\324_\247\252\001\221\006C\315\252"
+	.ascii	"|\251\003\263R\372\216\016\206\321\020!6\200\\\\\\\t\371\233"
+	.ascii	"\253\273\372\013w\201\272\252j/\025\317/G]\343\337\"\025\257"
+	.ascii	"V'}\332\226\026M\335\016\256' X\035\304J\261\200\335S\343~Z\235"
+	.ascii	"\264\177\364\274\201\f\225\234b\232\032s\340#\313\246H\255\216"
+	.ascii	"L\343\316\372\233G\367\260h+\224 )l\334YV'\r\200\315I\033\253"
+	.ascii	"\347\275\203\306\371\302\031\244q\007PO+_\026\0200V\rE\263F\227"
+	.ascii	"\223\350\350g\215\r')8\032W\255l9\347\035\224L\241W`\343w\027"
+	.ascii	"\365\177Ou\016\2736UG\275\245\372\306w\326\234\331r\316M\325"
+	.ascii	"6\032J\204\221S\002\200S~9\257T\215\303\226Y\273\250\004H\311"
+	.ascii	"\341\227\263\331\016\t\022C\0339\332\226R\374\316\242\332lu\322"
+	.ascii	"\rO\324\277\241\236p\362\374\3068q[k\242\234N\2204~\257\251\177"
+	.ascii	"\327\260bf\260\246\200\200\241\3213\254\222\235\221\226\306\355"
+	.ascii	"\224v\224s\336\301\\GR}\215\337\253z\233\327L\266\006K\346\256"
+	.ascii	"]\252\214;\027~-\243\233:F\303\260k3\275\223Z\251\235\017gsj"
+	.ascii	"\215\321B4\030\332\350\230\360h|A\031/G\003\275\240d\356\235"
+	.ascii	"\315L\2231\234\245.V;\006\217\2229:\346\204\b\357K\3628;k\214"
+	.ascii	"\022\212\t\003\346}1\240\200\345h\214\n\276\313\r\233\222\254"
+	.ascii	")\364K\232\212\301\327\226-\350_M\017B\252\250t-\314\316K\337"
+	.ascii	"\321\277\377\204\b\250_\325T\216,\324\017\355\342\302\007\240"
+	.ascii	"\337\223\026\234\"\026\005\345\322Gp\002\321\264T}\211Ib\303"
+	.ascii	"\210\022\025\203;\273\243wv(\337\355\373 nmljp\246\256\215J\f"
+	.ascii	"\357(\337\321\275\023\"\034nFm\357\305\226\306\250^\ryY\260\\"
+	.ascii	"\031S1(S\245\nZWF\343%\306\026\021\335\321\272\241\213&(c\215"
+	.ascii	"\3219\373\206\325\366\234\f6F\345\354\033^\031\035\033"
+	.ascii	"\0205\003\252\266\243O\332\320)\227\260\001\031F&*\313L6\214"
+	.ascii	"olJ\21487\303-G\224\243S\216\306\3258}\021\262\326\030\225\002"
+	.ascii	"G\003\n\305\276\325\370`\022"
+	.string	"%\352\ru\303R3p+;jV\206\262].\226\204(Ul\376\220\204\231\235\035e;\332\344\204\b6\r\357\031U\2115F\327n}x9s6>\2526\364\332\302V\2461\232V\200\034bt\214i|\024\355\377\220&\013\213\026X\343\266\207KQ&K\206P\250vX5\376\314Z\036\216\256\306\317\311\241fPd\310\321\261!\350z\001\325L\264\346\250'\321\237\002\340\304\214M\rfg\024\317\215\223\033E\236F\216\256G\223\234\020\241\277\310\200\263\022l\214\"9N\024\035\024\277\306G\311\320#\377\220F\310\016\263\260\306\357PF}\001\324\262'''T\354h\221\177X\203\004.\351\256\361;\b\252(\221\243a\377\320\362\220a\207\245\361;\374\251?\n\366\017m\376\202<\375h\374\016[\324w\300S1\310\372\372B\273lYfb\300\227\220A\261\277\244+E4\250\030Pqq\241];O\242\277\016\222"
+	.ascii	"\n\031$\"F\207\226\306h\227\225R\263\347$v\244\361;`\251\030"
+	.ascii	"8\351\340?\n\004\005\202j\331\262\314d{\024}\325\030\3149\212"
+	.ascii	"\207H\246\266\307\206\0069\252\005\207c\207\323\021\030U\004"
+	.ascii	"\232\017\037\\\351\223;\027js\252\b\262\036=~\320 \231\262\204"
+	.ascii	"\bM\025\341\265cG\216\016\243z\362u\251\"x\\]E\245N\364\250p"
+	.ascii	"4>\207'U\004\016\035:\302\226R\032RHQ\215\317\201H\025\321$\265"
+	.ascii	"\242Rh\325\320\211\301\372\202\020\361c\023|:\211As\034\245\372"
+	.ascii	"\321\033(\216\033 i[[\215\321\251\236\2439P)9\035@\032\327\330"
+	.ascii	"\2344\265\2639\3517\374\251!\374\240\240\350hj\360\251\3515\376"
+	.ascii	"\006+j\b<\0336\300\246(\263\234Omj\210*4h\244\255\225U\361\032"
+	.ascii	"SC\27099\211\335<\031\343\247\325\370\033x\250!\314\230\230\300"
+	.ascii	"\262,\030\214\255\302\306\337\340\244\206(\202\306@c\200\335"
+	.ascii	"\300KEmZ\215O,\243\206\330B\227\320%\260%TI\r6\266\306'\352\251"
+	.ascii	"!\256P\027\250\013!\205V\216\220nJ\343\023\345\324\020Q\250\022"
+	.ascii	"\252$\204\220\246\255\211_\227\306'&QC\304@\221P$\254\247\245"
+	.ascii	"f\310\227\261\252\306'f\251!\212P#\324\250\0165\253\362\346\327"
+	.ascii	"\370D\030*\b0(\021JD\345\322\b\324\002\307E\005\261E\314\212"
+	.ascii	"\305\340\302\241\023\0139rW\260 v\375d\314B\003\027\231\3432"
+	.ascii	"?&\304cZ\317\206\263\257q+\365\034\2239\252\261\266\325\030}"
+	.ascii	"\2639\351q\340T\020l\203\203\030\310\320\211\205\334\204\311"
+	.ascii	"\222\342\326\3708e*\b%\202\202B\244\272\211\0271l\215\217\363"
+	.ascii	"\245\202 \002\270b@\374e\350\304B^\374\305e\231\365\223\315\323"
+	.ascii	"\246\313\226\235\025\354\345\366\315\346\371\305E\214\301\306"
+	.ascii	"\307\261RA<\371\371\225\321\302rkj|\234%\025\304\022\027.al\214"
+	.ascii	"\336\004\337\302\250 \362\226-{D\2610-(>\365C \037\037\225!\r"
+	.ascii	"\317\276\262\306\277\221\242~\340\273[\361\035\326\033:\261\227"
+	.ascii	"\232\232E\210\337\224t\016F\r\271\274\343\032~\234\005\343\331"
+	.ascii	"7\033%'EG\215;\367\034\347\3519=\261\321\370f\253\223~`s\322"
+	.ascii	"\337,Q?\254]\271B6cV\005j\t\227\372!\211\025+bQxID\032\377\206"
+	.ascii	"J\3750\204\216\016s\241N\nx\005\001+\004\342\327\37070\324\017"
+	.ascii	">\344\344\360\333\320\211\275\250\366\326\252\245\306\267\361"
+	.ascii	"\242~\240\242B\0057A"
+	.string	"\235\330K\ng\311\013l\255\361m\356\324\0174\240\254\030\n\216\223@\335p\251\r\013\251\237p\202\340U\331\321\030K\371q\024L\203}\263\261q\326#\2561F\3539\206\263\2112\243,\256\261\315juR\233\366D\335\361\342d\305N\360\333\024(z\201Q\372\311\346\271\245\204\344\005\273\375\035\206\333\354[\036S\330Y\343\316V'\275\r\231\272\023\345l\305g\270\t\317\206\234\271\2328\240\251\212W\2202LPj\307k?F\303i\366\215\304\237\324\224\306\366J\317\261\332}\223\2224\246\261]\255N\272cs\322\333\360Pw\204\230\231%\261\001\333\222\322\322\3706K\352NVYY\027#SXK\203\215_\003\250\356\344XW\256\013,\321\002\244\212\2723Cl\305b\030\t\327\rT\351i\345\257\237v\\\251#;>\362\343\"x,\212L.Gcl\244\347\230\314I8\326\230\306\346\244\350\024\233\223\276\346L\365"
+	.string	"H\204H\027\031]O\260$Qj\374\032!\252\207\032\260\027\366\302C$\260!g-BK&\207U\217\341\227\225\340\230\257c!o6O8\037O\274\306\326H\317\361\327\235[\340\326\225\352\001Mk\305Z\230\213gC>\352\353\322\225\233\246<\350\2576\035P\372)]KS:\303[g{\252\325 \323\3705.T\017=:\260E,\336\261\342\035\030\310\214\036\271\232\"X\362\340\372\351J\371\270a\344\343\370\307\217y\340\036\366\315\3469ceG$\2601\316\3529\366QS'\305/Ic\033\233\223\246z6'=\215\240\232\001_U\025\276\322\t[{\212\213\006:\253\343+\245\276\031\\\215\261\216\376B\275Lyui\214\237\315\34778\305\250\371\256\f\016\321k|\0328U\2030\234\003\347"
+	.string	"\353\372\203\232+cD\335"
+	.ascii	"\211\324\261\024\306as\366j\332\272\301C\013\3378\306q#\366\344"
+	.ascii	"*\373\241\002\340\013\236\201\243\360\f\f\345\245Gj\265KbY]4"
+	.ascii	"\216\241\360S\315\221\347\322\363\t\333x\372\002\227\245j\235"
+	.ascii	"\321\002\344a\327\270FG\345\035U\313\033 Qc\032(\374\0027\341"
+	.ascii	"\027\230)\325\200\312\022n\302K\230I%\372 \244)\235\262\245\006"
+	.ascii	"7,\343\230\251\335\222\246\0205\3061F\\\275 j\214a\320$\251\037"
+	.ascii	"rQ;\b\304N\354\274c\032\004\372"
+	.string	"\345!\031\374\253Q\006G\343\017\253\250\001p\302G\370\b'\305u\275\251\371hj\214\223\254d9\231k\374\300\246\341\377p\371\306D\326\370C5\225\003\2472ep\321P\001PD\253\032\314\262\n\217\2130\221\025\226^\034\3164K\372\266t5\376\320\210:\324R/p!\306\256W\314\035\3035C\343\022\332\340!Qrc\255 *LF\343\017o\250\034l}\271a\276\334\301\016\371\271\027\304o\210\364F\244#\360w\020L\r\205;\252\256\240\315\226g\016&\215?\204\241\226Q9h\342\347w\001\321\324\250\374rT\024\217M\026\030\022\\\343\013\370.\251\r'\244\247;\225\003/[\266\\.\027\320\310C,Z\342\356\372~\271\274\217\270e\306\335\031\233j\301\225\236]\257\336\345\033:\361X\025\277\3344\345Aj\325\265\306\344\356\251\2047\276p\240ZW\205`\032_]U\013\226\340\255\027\357\346\r\2359;%"
+	.string	",Oy@\034r$e\316\n\334JfK\355 \354J\307bR\211l\372\034\231E\026ZH\001\205\t'\274@<\026\217C-\232.l"
+	.ascii	"\305\261x\002\004ZX\241\210\002\013)\240@q\302\0136-\206|\204"
+	.ascii	"\216B\351O\022\031\001\240\241tHhH\310\347\3104\372$\227Mf1\210"
+	.ascii	"\211\263l2\227Mf\332b\310g\331d\246WQ\342\370\263\"\310'\211"
+	.ascii	"4\261d\2560aAP\320\212dR\231\234\231A\271T\321T&g"
+	.string	"R\030\217A\370\270\\1\204\223\307\240e\223\231n\270\212\022>)<\034\203\220)\224K\027Z,\217\315\246\361\001\315#\220\207\253(\321T\001\204\f*2M$\225BBJ\237\r\226\307\031\224A\312f1\210I#\26442\221?\305\345q\006\345Pq\006eP\221ES\206&\363\247\350\203l\032\205\224\315\025\306\"\t\232\026\004\035W\244(6\227\312\241\346\322(\304\374\240\224ayd\262X\026\203\214\310\345\221ID2\231\034d@\036}\216\313\034\241\2452E\323\030\224\323T6\221C\307\241\026(~\220C\035fP\006\245\030R\026S\244P\332\004)\227\315\244\322\247\270<2W\024e0&C4-"
+	.string	"J\"\177\222\306\240\342\f\312\240 cQEs\031\242E\363\230\302\310,\002%\221BKc\321\270l\2628\026e0&/\bR\372(\233\312\345PQh\206\241\342R\331T\n\355"
+	.string	"\031\205\232\306eQ\250\031t\224\341\030T\004R\006\021-`a\f:.\213B\313c\023\231b(\250\250\\\266\300a\032c`\026\231C@\307\037\244\f\312\345P\2219\004\324!(\331\342\247\310\034\002\312\021\001s\231b\303q\250E\263\270<6\203\220)\216\313\025?G\037\345r\250xLad\006!\215)v\222Jd\323\347\270D\3760\217?J\241\"\320\212\030\216?\034\226Jf\362\310,6\223\307\345r\205O\005G\037\244\f\307\037\235\244\022\311d\036\227CBJ\237\"\013e\f\"\3601\006\2018\372,W(\231\305#\220\261\031\244\224a\247\211L\256(\266h\"}\214CF\237b\323\030\203\007\345\322\030C\316R\3314.\217C\312\"\213\025\315\344Q(\t\204\f\"\036\207Z\240"
+	.string	"J\"\203~\222F\t\034\177\224BK\344\207\343\3228\303\317\322\250\242\350\343c,v`\036\207V(\227(\270\320<\242\240\201\212&P\362H\001\026\306\025>\240\260\001(\211\\6_h\036_8\222"
+	.string	"\371BN\220\021\003\314\"\013\243P\221\205q\205\346\021\205\016\315b\022)TL\"W\270i1\2444ayl&\221J\027,H\002\271\300d&\201\\`&\201\\h\036Qh\036Q8\242@sd\032M"
+	.string	"J\"\227\312$P\n?Id\004jT\3704\215+4}\214,N`\246p\0242\262\340\201\231D\032\233I\245\tG!#\013 H\200|\201\205q\205\r\2309\037\224h.\215C%\216BF\026.h\341\270\"\310\210\201\346\021\b\347\206y\264\200\371s<\276pl\032\177\220?I\243\t?Id\004T0\215\0228\n\031Y`\006)c\020j\361\302\317R9CMO\361\004\b\370>%~\216Mc\221\002(Rx!\0041(M\224\b"
+	.string	"\363g\251\314"
+	.string	"\363(dd\201\303}\202\224\312\007\024\321\237\2452\003\315#\n8\367A.\217\311#\220\372\020F(\300\b$\260\2309\t%|P\302\007\351I(\241\247\247\204\021z\324\217\320s\233\305#\t\220\314\231\264Y<\001B\363*J\f\255P.\201\212\313c\363(d\\\032\207Lt\340\223\\\021\201\346\221y\264"
+	.string	"\320PM2E7\217\314\343\022e\"\201\216\026"
+	.string	"\032\262I\002\r\335#\t\220L\314d\036\227??\306\231\026CJ\037\274l\016\335f1\t4\2046\233\311\025J\023h\230\305\026\313f\362\204\240\016\314\343\212 \243\fis\330,\02674\217\314\024)\224\351\317Q\004>\306\241\364(dL\026\177\216?J\237\344\321\3468\324\242\211\233\304&\363\310\342\370\223D\316\2600\256\220D\256\240\303\302(\224D\n\245\315\253\370p\345\320qi\242\251T.M\324\2608\376$S8\006\305`l\3220\213&\034\203b0\242\240"
+	.string	"\210\241\025\"P*\203R d\212\244\322'm\026G\350i&\221+\324\245Q\205\017n\026Ih&\221+f\336s\"\305\261'E\f=%*\370\001\016`\202\006\027`\001\005\325\247\004\023(\211l6\217L\023>)L$\221F!\023>K\246\211\022;\377g\\|\346\005\021\360I\007\216\3063J3\316\033\326\265\266\367>.B\266@A\322x\006i&)\253K-J\227\373\021\007\207\f\362\035\241dfd\030!\344a\204\231\322+[\204sEc3/\226\274\330#\362\272a\373qF8\223\301f \221\221\322x\235csr*s\201\340pe\341RH\006\375C\353\232\220\230\214\271C\277r\264\365\021\242]5[+\024\244\306\004x\361%\025\363%\r\323\341\371\314\271k\006\312\025\223_\340\3230\203C9\2462>\301\024\f1j\212\310G\343W"
+	.string	"%X\201\222\372\247^.\337\0131U"
+	.string	"o^\021\262 O\215\t\260CK\372\247%\365K\201(g\031][\236\372u!v\t#\204\322\227rQ\221\346\314\306\006\373\264\250\177\312w\271\334\3449am\355\341\"\0339\273%T\364\356\230*H\250\300\350\035\"\024\037H\2564\366\240Kj\227\346\245v)^\nD\304%Q/\322+O\361\322,[\306"
+	.ascii	"\312h\234\336\241U[9sj\212\345\270\354ys\213\236\350\334r\334"
+	.ascii	"\324?\265\342D\305\242\345\225\353\370\210f[>\244\350\256\324"
+	.ascii	"\225\341e\2651w{\334\330\0302\006F\356\231\364,\254r\247\372"
+	.ascii	"\244\224}Q\271N\203zkQSP-\033\2622A\2528\264\216\030\307\027"
+	.ascii	"EP\n:\205N\013\313J\303\255C\316\372\234\320\200\256oLI\316R"
+	.ascii	"(O\243\270\251\345\260\306\351[\372\244\256\214I\215\306hmG\266"
+	.ascii	"\225\325\370\201\251\333\377\241\315\016\"U\266\232\364n(\201"
+	.ascii	"\3516\224\r\r\003\005\017\210\223.\264\203\333\202\3258m\022"
+	.ascii	"\3023\347\242t-e{\332$\247M\210-\204\215F\231T\355\272@\371\320"
+	.ascii	"\346\216\244]%\032Y\300H5N\317:e\222\242==\373\232\311r^\323"
+	.ascii	"\263\f\306\020\255\335\200x\243\311\224\257\324\f\017\261\311"
+	.ascii	"\361wGe\t\222\033\2764<\3002\034WA\223)(J\200\334\032OXWk\241"
+	.ascii	"\3651f\243G\022.\232)GR\304 \371R\003Cl\316\356\310[{\361\310"
+	.ascii	"\200dX\017g\317\305\216?#h\025\261\312\005\330\2221\334$e\243"
+	.ascii	"\243\253RD\254\271\\A\031\023\366T\f\r\0066\273.N\215S\"=O\303"
+	.ascii	"\236D\302\256\032{\2609`C\260`A\301\363z:\344O\277R!\026\r\006"
+	.ascii	";\"D\362\032[\247\325I9H\365<\365j\3633\302\224v\245\\y<\220"
+	.ascii	"\324\245[O\271\330\206U5p`i\234\366\350y\272U&\314R\232V\032"
+	.ascii	"\344\tI\211T\032\344\307Y)\020\213\006\303\324\027\326\216\306"
+	.ascii	"\267\263:?|\330\\5\355\355Hy<\365\361\247=\322,9*w\204\215?h"
+	.ascii	"uR\242\315I\323\035=Oy\250\205\205Q|4\306\301J\257\236U5\244"
+	.ascii	"W\177\252#\265\302R\364\343Gc\233fu\322\017\317\264*L\tVRZ\365"
+	.ascii	"[\265\224\312\242\301\260\203\212\257\252\361N\216\251@\276+"
+	.ascii	"\245t\352O\215l\236\363\310j\b\216\033HMsH\351\215\037\033I\245"
+	.ascii	",\032\f\205\\_`4\376[T\n\305\203\311\232\215\024\352Om\244O$"
+	.ascii	"($\003\246\361\365\254NzS#\245\341\244\225%K\332\364\224\306"
+	.ascii	"\237:\2453,\232\215l\225\324\330FY\2354\207\251\347i\323PM\f"
+	.ascii	"\217\270\306\035d\2441\2240\321\030\222\306\370\321\251\024\306"
+	.ascii	"\t\030>z4\376\224t\351E\321\311\013\317\305\323\027"
+	.ascii	"id\264\226\2544N\221z\236\272\300\300\t\334\223\324\231*\005"
+	.ascii	"f\241\243"
+	.string	"q\364T\351O\221\322$\213\006C\033`Vc\022\254N:cs\322\324\250\347\351Q\037\341\341\374\3218M\213R\"%N\301\265\224\350o\245v\376\260A\303J\232\013k\b\206b\250#\322\023Z`\266\3060\005\031sH\210F\323$\215\0013\026@ 8D0\026\214\222\250\036\023\200\204\214K\365q\034f\006AC$R\220\202\024\244\306\260\031\354\265lUx\375\017\021\262F\345H\241\001\226E\013\362\260\237<\221\371\255\025\247\003\b\tx\374\003\332\003l\335\005v\004\355\324\302!\261\007C0\026\331W\246\320\214E\235\006\366\017\341Eu\3276+E}\343\"XK\035\233\214\317\256\226z\302t\212\003\230\320K\237\330o\240\370'(!\026=\260\307]\277\347\bt\362\255\207A,V\003\020\036\343\330rY\007\023\245\262F\314/\240L\337\2017\264\023\206=\ndK$\366\022\316\216\213q\023\226\300pj\250e"
+	.string	"T\202-\007j\377\016H\363J\337\306\207\337\303\274\210\203\221s\316\321\213:"
+	.string	"w\265\341z,[#H*b\275`\3009;\343t\354GJ!}(\235d(\016\003W:S\337\312\272\005\213\3501-\0069M\364\310\202\200\370\024!<Ej\r\364\f\317\212\\1\256cbo1\241\002W\035\364\206\204\005\031\346\2651Sy<XD5p\346f\354\272\017}\201\244\264\264;\b\364B\241@h\206\024\337,T\274\307V\324\324p?\322\216\317U\023\321\303\203D\366\227\204\203\216\354\233\r\233\251\b\f\206\347\205\343\377\343t\030\241\310\351\357\016\277!\350\025Y9\232\005G\"\227\350A mv"
+	.string	"bH\323\243E\221\020\250\006g\342\253>\317\030\275\343\245\240\314'\213\356\257\312W>\364\222*7\356\343X\357\251\336o\240\377\331\314i\214_\f+\357\201\245\n\223\t\220f\370\301\326\322\022\251\337\355\001\330\301\f\370X$\030\307\204f_\271\355\227~z\247\366\2441]2\273\257\366eq;\2239HGpp_f\021\233}{5\212$6\245 l\202\233\302\374\325\310\352\344^f\003gt3\004\223\362\033\252\310d\247\\\310r\244t4\204\250\314\216\271b\376\304\032\017\232\310\214]Q6.\252\r\361\330\327\347bs{\n\267\036\262Hl\273\b\017\221\334\003\353&\334\350\340\032\305\035\312\202\201\001\306l\r\225o\320q\002Dd\355\322-\026\222\246)\261\215\376"
+	.string	">\217\250%\331a\264\007l`\021,\303`\337t\204\322\232\316P\361\365\021\237\326\266x\323\234z\021Q\211\242\375tBT\017\007\033p\310\250\331\302\257\244BF%\365P\311,i\342c\003k\fW\230\205\301\002\n\220\026@\312\321\236\200\272\304\312\201L3\361\352\034\367\220\024F\020n\233\332\325\312\374\262Tr\b\221\303.\220\240s\021\272\336\"\213\027\324\303\\\363DKD5pF\225\245%\3719m5e\231+\242uT\251\360\276\034\225\005\177,\t$\003`\234c\226\2206\317\203_N\032\302U\374\b\013m\371D\274\300\327W\216x\236\030\224dw\265\223X\220\353\255X\213W\213\236l\335\215J*vc\352\006\343Z'"
+	.string	"\313\310\235\234\366/\312\250\202\023\231\204\200e\317$u\036\243\nS\013\353\241l]pp\312\351\3339i\324\325\0023-\202V\206\022\317\027\305K\213\373\250\310q\241\213b\"\377h<\007\013\220\243frd\224t\341K\343\216\001h\n6\224\r0\303\037:Iq\023m\250"
+	.ascii	"\025\313\316\001\270\242\037\202\223\207\346\311e\215>a\225\271"
+	.ascii	"K\036W\3224\266\302Qz!\004 \023,\204\262!\370\222\3172\217\355"
+	.ascii	"\004,_\346\232=s\016=\362\036\"\027D/\313\225\016Sl\335\347_"
+	.ascii	"\322\303\213\352\316T\274,\323\256$\360\330\367V\265\261P\251"
+	.ascii	"\376\2252\244\352\033<,\327B\200\220( \032\251`\363]\026l\262"
+	.ascii	"\202\323&W\026\346\373\372\345Y\213\037}\324B\310\351\032\217"
+	.ascii	"\231Y\035N0$Ge\b\304\026\235\250 &\336\243\307\351\b\200 z-G"
+	.ascii	"\n\272\275\216\362\222\026\356\f\331\252\254\026o\226\337\216"
+	.ascii	"\241\367StZ\262\235\367\257f\204\204\320Z\n\206\346+\020|uG`"
+	.ascii	"\002\bGL\350z\0241\3372J\322\247\f\004o\213\345\264\201S\b\006"
+	.ascii	"\b\352\371\324\253\305\336\362\334Z\221\023\317\332\243\362\221"
+	.ascii	"\032\340t:\035\263\350\371b\202\356\016\261+j\201:\366/e\366"
+	.ascii	"%.A\221\205!\367D\345\256\267\357\353\202FX\007\036\n\0033\226"
+	.ascii	"/\216\206\tq\\\361\002\216\273\177"
+	.string	"\005\005\027\2402 ;U\201\345\332\273\271a\334\344\232\3726\225\246\267\317\3010\006\200\035\334H\330\341\\\335E[5?\323\377\350Q\245\027\226#\223\206}ex\0308\r\323\222\261yO\307\212\306y\375\336@Rs\\\242\237\343}A+'C\241\303ZN\313\322I\320<J\217\3024\300\245\201\361\223\353Gu\222\224\345u\020O\3177)\310\320\"\023\234=JR\001*j\360\005\232Tw\217\273%\260\324\374\233\367\2570l\307\340NO\336\004\227\003\t\007U\372\234\266\013\305\032$k\250\016\001N\301\333\035\002\263h\357-\207<\324\253\212\260/5\232\337\261\232\327J\020H\r\006\271\027\254\364\240\236\024\fU\321\001J\223m\231\005\213\326\030^\362g}\357\356\233\331\353\203U\037\021\345\237\220\030\341e\327:\373\020\251K)\310\330\355\262D(\353d>\270\314\027\261\340\202Z\250\233[\177\333l\243\325\266\b\312\233"
+	.string	"'F\314\327\205\036\223eC\202*~7L\234:\271=\277\0079\202\224\356#\344\037\267\241\351\226^5\"#\316\005+\324\307\016\f4\244\353I\002\024\221\204\224=.\022\270Hq\030\337\357\375\024\256\352\224\323^*8\227g\001n\355\230^y\243\334\372\236G\223>C;@\032\201\230Mo\347Ww}\017\247\202<\203=J\323\250d\206<\235\032G\310\275\310\226\3546\336\251QB\211\030?I\355r\312\334v\232\002\263\311\021ip\266~\307\325\364\t\317\327;\n\302\336\031\355\214\317W\331\031\240\236\367\375_Z\275L\354k\251\350\224d\312\344@5\265\216=\306Dd\034\200@\224\033z\254\257#\373\217\337\"f\034il\313H\325\260\020\3750\256\260#\361c2C\376}\200\366\314\227A"
+	.ascii	"\256\340\217O\217`\374.\352V,\005\336\211\3145\372\340~\210\221"
+	.ascii	"\332Lp&E\225\344\302#\215/\242\374\205Kez\213\265\025u\260\t"
+	.ascii	"\013-\311\3132\033R\277\213E\023]q\326\222\236\256\307\222\221"
+	.ascii	"\265e\021C\270\274\346*\0228M\0201J;\002\341\005\306n\f\006Z"
+	.ascii	"\217R\004lF\013\021\376n\243V\334\037\271\316`4\034=\223\353"
+	.ascii	"\312$p\35519d\375\351\325\251Z\225\233\335\bhM_\220\354\253\304"
+	.ascii	"\320\222\373\236\311U\263\226\320\256\375+\031\257K\270\f\264"
+	.ascii	"@\227#\322|\330\007C6\300\023}\037x\023%N\300\020h\270\340B\301"
+	.ascii	"\031U|E!\370\030\363\243\030.MgP.\240aD\204\313\363\367V0A0\254"
+	.ascii	"\277\300\313\204jb9U\322\341MS_\026\214V\007\255\363\352\304"
+	.ascii	"\315{N\223\036\303}\2379&\214\314\025\217Ic\304\271\344\215\270"
+	.ascii	"<\001\033\016\220\225y}[\206<\211\r\033Q\016t\357\215\323\321"
+	.ascii	"\024\035>\"K\rJ\346T\005\263v\033J"
+	.string	"\2370@\025\336\212\003\267*\370e\331\271\305D\005\031\206K\262\020\337wT\035\310O\322\361.\332`\361\210\002\004\306~\223+wJB\352[\260\320x<\351\374\004]\254\356\354\320\343\221\024\007\271sQS\374\340\3139\350X0\217\031~fx!\037VM\f|\301\220\343\301\303\262\255\303\035v\027E4\225\215^\361\307\221;o|\n\032\266\340w\023\332\367\201\223\t6\275H\316\212\321t\320`3z\350u\211\177T0\324\252\243D)\335o\264\274\225\321\245\375\013\272[X\376d-NW\303>\025\002\377\3468\t\354B\017\221#\234\330"
+	.string	"\234\302\206NK\332\232\367\360\234\353\350\023\375c\227\276\024\253\227\f\2730J*E\b 2J;\220\013\305\236\001p\222\245`l\256\235\030_pLv\033j\212\020\333\314\267`\361\221\3159\3546F\223\315\r].\220h\264\032\006\212?\226\367\3711\324W\210\214\202\r0\341k7\210\032[\370\200\2452\2526i(\317\353\334\032\006\352\346\262\036O\t\334\220\b\022\004\322\f\r\370\032R\002TD\361\300\030\216Z&\034\033\331\177toh\316\267V9\302K\354+D\377\221\003\031\277\020u\016\027\234\031H\030-\326\n\255\355i\342\245P/,\257\352\027\214<\340\207~\031X\0164\330\303F\004\336\310h;\374P\211\327?G\021S\201RG\334\320}\277 \343\244\230\253\355\327#\224\2204R\226\250\223\021\306"
+	.string	"\361\232W\240hD\201\345;\fk\202\"\t\315\203\257\223P8(M\005u\315N]s%\371~%\237\225\001mQP\017w\b`/\347\001\323\210\216\306S\324)\253\313\341\2658M:\221I\365\367\366\366\205\330\377\277\305\350Q(\336\355\3725\303vas\253b\342G\260\357\2576\337\223\324w\334b/Z\267\3728\361\340\347Rl\224\212\370L\277\t"
+	.string	"6\244\235~\340\3267\354z.Z\177\203\271Vg\265$\374\342X~v'-\2023N\201\2377\330\311\222\261\347\3608\f|\274\344/\373\344?\030\233\376\223\331\315\356S?\322ZP4\033\375xj\3454\271\260\357\267\003\002~\221y'\273X*wn\317\253f\235\030\371\244\362\326.\367\2538\275\265\256\271\260\261F\206As\336u\357?'\231-\246\213\033\236H\353V\264K\324\337\b\255\017\242\267O\347\304\275\037G\335V=\240b.\006\265\255d\261\3279mxg(\337\257\366"
+	.ascii	"\\^\233k\220\372xL\360\265\003f\254\021\331\244\323k\225\337"
+	.ascii	"+o:FZ\352\252\361\267\214\361\366\337*\033x\315r\356\275a\007"
+	.ascii	"w\023\306\371\202\277\t\007\250\037\375\017s\231\237Rw\351\373"
+	.ascii	",Q&Zg\222\364x\240\t\346\007\375|J\017\337\271\253t\353\336\253"
+	.ascii	"\305\332d\b\213\004\231\345C~\230\227\303Q\257\235j\205\245\336"
+	.ascii	"\330\273|o\002\236\035\263K\333\331>}\226af\2444\271p\245\256"
+	.ascii	"\236\023\320v\321\366\034\344;\226\335\320\361\2571\2326\333"
+	.ascii	"\342\237\316\323\0170u+\206\257\312\007\243B~S\223\203\340\346"
+	.ascii	"\"\256fao\370\315\326\213\032w+4\257\263?\005\344\321\377{\357"
+	.ascii	"j@\310\371\244T\267\251g\366?O\341\023+}\033\026\277\217\317"
+	.ascii	"\310\211/\200\030\303\324\007[.D\207.\305hn\027\271o\341\035"
+	.ascii	"\214\227\361`\337^\306\277\223Y\314\204>\333T*\277\210/\347."
+	.ascii	"\315\206\213p'\305s`{\272\306\354\001\346v\277\324\307\227\364"
+	.string	"\274\274\337%\275.}t\331\311e\r.jn\251\261eL-\302\320\022o\226\261\262\324\306r,,\357_\341\346\225v\256\270k\0058V\324]\345\237*\222K\205\266A\345-\326o*\2660\272\233\033\005\324\257\365\364\372\231\031\244\342\026G\306)\037\220\370\337\n\206\250\374\375\036\363}\031~\261=a2c\351i&\313\224\037sOU\354\241\316\214s\354\251\252\373X\306\253\346\235\305\275*{i\325\337B\333SyK\233[\271_\331\b\334\352x.\372\221?YHK\1772o\372@\303u|\352\200\347u\267`\236\304\357\201\217V\355\233\374\234i\373o\231\356Vh\247\"\254\221\216\271\2703\300\375\371`\340\255O\335\017\351\374\342\332\221\372@\373Z\275#\r\316\227V\273\207w\004\317|\202\256N\277\241\347dy\302tA\367\203?>\003z\262\344\224s<\331\231\362\374\034\202\377\313c\336\333\360\237\002\3113\367"
+	.ascii	"\377\215\245<\300S\357\340\007\326k\347G\340p\314\313\223\267"
+	.ascii	"\347\324\360\227\207\352\201\375\260|\205g\267x)\375aO\311\317"
+	.ascii	"\314\242\353\202\303A\270\020\262I\266\221'\255\322o\243z\274"
+	.ascii	"7\326Y\032jN\261\224\312\020\247\235\232V9\376\227\320\025"
+	.text
+	.section	.gnu.lto_.symtab.d64b4e6a8ee3f75,"e",@progbits
+	.string	"settingGetName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\001"
+	.string	""
+	.string	"settingNameContains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\001"
+	.string	""
+	.string	"settingNameIsExactMatch"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\001"
+	.string	""
+	.string	"settingFind"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\001"
+	.string	""
+	.string	"settingFindIgnoringCase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\001"
+	.string	""
+	.string	"settingGet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\001"
+	.string	""
+	.string	"settingGetIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"settingGetPgn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\001"
+	.string	""
+	.string	"settingsPgnCounts"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\001"
+	.string	""
+	.string	"settingsPgn"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\001"
+	.string	""
+	.string	"settingGetValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"settingGetCopyValuePointer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\001"
+	.string	""
+	.string	"settingGetMin"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"settingGetMax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"settingsValidate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\006\002"
+	.string	""
+	.string	"settingGetValueSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\002"
+	.string	""
+	.string	"settingLookupTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"settingLookupValueName"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\261\001"
+	.string	""
+	.string	"settingGetValueNameMaxSize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.string	"settingGetString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"settingSetString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\002"
+	.string	""
+	.string	"settingGetStringMaxLength"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.string	"settingsGetParameterGroupIndexes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\002"
+	.string	""
+	.string	"table_acc_hardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"table_airmodeHandlingType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"table_alignment"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"table_aux_operator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\002"
+	.string	""
+	.string	"table_baro_hardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"table_bat_capacity_unit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\002"
+	.string	""
+	.string	"table_bat_voltage_source"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"B\002"
+	.string	""
+	.string	"table_blackbox_compression"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\002"
+	.string	""
+	.string	"table_blackbox_device"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\002"
+	.string	""
+	.string	"table_current_sensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"table_debug_modes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\002"
+	.string	""
+	.string	"table_direction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"table_failsafe_procedure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"table_filter_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"]\002"
+	.string	""
+	.string	"table_frsky_unit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\002"
+	.string	""
+	.string	"table_gps_dyn_model"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"table_gps_provider"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"table_gps_sbas_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\002"
+	.string	""
+	.string	"table_gyro_lpf"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"table_iterm_relax"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"table_iterm_relax_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\002"
+	.string	""
+	.string	"table_log_level"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\002"
+	.string	""
+	.string	"table_ltm_rates"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"v\002"
+	.string	""
+	.string	"table_mag_hardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.string	"table_motor_pwm_protocol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"table_nav_extra_arming_safety"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"table_nav_rth_allow_landing"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\002"
+	.string	""
+	.string	"table_nav_rth_alt_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\002"
+	.string	""
+	.string	"table_nav_user_control_mode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"table_off_on"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"table_opflow_hardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\002"
+	.string	""
+	.string	"table_pidTypeTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"table_pitot_hardware"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"table_platform_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\221\002"
+	.string	""
+	.string	"table_receiver_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"table_reset_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\225\002"
+	.string	""
+	.string	"table_rssi_source"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"table_serial_rx"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\237\002"
+	.string	""
+	.string	"table_servo_protocol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"table_smartport_fuel_unit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"table_tz_automatic_dst"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"table_voltage_sensor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"table_vtx_low_power_disarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"sl_tolower"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"getConfigBatteryProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"getConfigProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"sl_strncasecmp"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"pgFind"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.d64b4e6a8ee3f75,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
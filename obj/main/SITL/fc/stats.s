@@ -0,0 +1,10069 @@
+	.file	"stats.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 3 "./src/main/fc/stats.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/config.h"
+	.file 8 "./src/main/fc/stats.c"
+	.file 9 "./src/main/navigation/navigation.h"
+	.file 10 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	stats.c.4de58c1a
+	.weak	stats.c.4de58c1a
+stats.c.4de58c1a:
+	.long	0x2e1
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x10
+	.long	.LASF1551
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1500
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1501
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1502
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1503
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1504
+	.uleb128 0x2
+	.long	.LASF1506
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1505
+	.uleb128 0x2
+	.long	.LASF1507
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x2
+	.long	.LASF1508
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1509
+	.uleb128 0x12
+	.byte	0x8
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1510
+	.uleb128 0x2
+	.long	.LASF1511
+	.byte	0x2
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x2
+	.long	.LASF1512
+	.byte	0x2
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x2
+	.long	.LASF1513
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x14
+	.long	0x6b
+	.uleb128 0x8
+	.long	.LASF1525
+	.byte	0xc
+	.byte	0x3
+	.byte	0x5
+	.long	0xdf
+	.uleb128 0x3
+	.long	.LASF1514
+	.byte	0x3
+	.byte	0x6
+	.byte	0xe
+	.long	0x9f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1515
+	.byte	0x3
+	.byte	0x7
+	.byte	0xe
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1516
+	.byte	0x3
+	.byte	0xb
+	.byte	0xd
+	.long	0x87
+	.byte	0x8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1517
+	.byte	0x3
+	.byte	0xc
+	.byte	0x3
+	.long	0xab
+	.uleb128 0x9
+	.long	0xdf
+	.uleb128 0x2
+	.long	.LASF1518
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0x93
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x12a
+	.uleb128 0x6
+	.long	.LASF1519
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1520
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1521
+	.value	0xfff
+	.uleb128 0x4
+	.long	.LASF1522
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1523
+	.value	0x8000
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1524
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x136
+	.uleb128 0x13
+	.long	0x141
+	.uleb128 0x14
+	.long	0x7e
+	.byte	0
+	.uleb128 0x15
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x160
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x7e
+	.uleb128 0xb
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x160
+	.byte	0
+	.uleb128 0x5
+	.long	0x12a
+	.uleb128 0x8
+	.long	.LASF1526
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1be
+	.uleb128 0xc
+	.string	"pgn"
+	.byte	0x2d
+	.byte	0xb
+	.long	0xf0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1527
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0x93
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1528
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1be
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1529
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1be
+	.byte	0x10
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x31
+	.byte	0xf
+	.long	0x1c3
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1530
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x141
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	0x87
+	.uleb128 0x5
+	.long	0x1be
+	.uleb128 0x2
+	.long	.LASF1531
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x165
+	.uleb128 0x9
+	.long	0x1c8
+	.uleb128 0x2
+	.long	.LASF1532
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0x9f
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1533
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1534
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1535
+	.uleb128 0xa
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x224
+	.uleb128 0x4
+	.long	.LASF1536
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1537
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1538
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1539
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1540
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1541
+	.byte	0x7
+	.byte	0x63
+	.byte	0x16
+	.long	0xdf
+	.uleb128 0x7
+	.long	.LASF1542
+	.byte	0x7
+	.byte	0x63
+	.byte	0x3f
+	.long	0xdf
+	.uleb128 0x7
+	.long	.LASF1543
+	.byte	0x8
+	.byte	0x14
+	.byte	0x1c
+	.long	0xeb
+	.uleb128 0xd
+	.long	0x224
+	.byte	0x47
+	.uleb128 0xd
+	.long	0x230
+	.byte	0x69
+	.uleb128 0x7
+	.long	.LASF1544
+	.byte	0x8
+	.byte	0x14
+	.byte	0x95
+	.long	0x1d4
+	.uleb128 0x16
+	.long	0x254
+	.byte	0xbe
+	.uleb128 0x17
+	.long	0x23c
+	.byte	0x16
+	.byte	0x15
+	.uleb128 0xe
+	.long	.LASF1545
+	.byte	0x1f
+	.long	0x9f
+	.uleb128 0xe
+	.long	.LASF1546
+	.byte	0x20
+	.long	0x9f
+	.uleb128 0x18
+	.long	.LASF1552
+	.byte	0x7
+	.byte	0x74
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1547
+	.byte	0x9
+	.value	0x1af
+	.byte	0xa
+	.long	0x9f
+	.uleb128 0x1a
+	.long	.LASF1548
+	.byte	0xa
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1d9
+	.uleb128 0x1b
+	.long	.LASF1553
+	.byte	0x8
+	.byte	0x34
+	.byte	0x6
+	.long	0x2bc
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.string	"dt"
+	.byte	0x8
+	.byte	0x37
+	.byte	0x12
+	.long	0x9f
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1554
+	.byte	0x8
+	.byte	0x2b
+	.byte	0x6
+	.uleb128 0xf
+	.long	.LASF1549
+	.byte	0x63
+	.byte	0xc3
+	.long	0x2cf
+	.uleb128 0x5
+	.long	0xdf
+	.uleb128 0xf
+	.long	.LASF1550
+	.byte	0x63
+	.byte	0x74
+	.long	0x2df
+	.uleb128 0x5
+	.long	0xeb
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 11 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 12 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0xc
+	.file 13 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 14 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0xe
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.file 16 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.file 18 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 19 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 22 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 24 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x18
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF784
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 31 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1f
+	.byte	0x4
+	.file 32 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x3
+	.byte	0x4
+	.file 33 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x9
+	.file 36 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 37 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x4
+	.file 38 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 39 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.file 40 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1283
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1310
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x30
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x4
+	.file 50 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 52 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 53 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1425
+	.byte	0x4
+	.file 54 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1426
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 55 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1499
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF948
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF958
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF964
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF967
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1282
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1304
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1309
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1329
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1329
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1339
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1342
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1330
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1331
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1332
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1333
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1361
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1362
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1363
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1364
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1365
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1366
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1403
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1411
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1419
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1422
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1429
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1498
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1555
+	.long	.LASF1556
+	.long	.LASF1557
+	.long	.LASF1558
+	.long	.LASF1559
+	.long	.LASF1560
+	.long	.LASF1561
+	.long	.LASF1562
+	.long	.LASF1563
+	.long	.LASF1564
+	.long	.LASF1565
+	.long	.LASF1566
+	.long	.LASF1567
+	.long	.LASF1568
+	.long	.LASF1569
+	.long	.LASF1570
+	.long	.LASF1571
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x38
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1572
+	.byte	0xd
+	.long	.LASF1573
+	.byte	0xd
+	.long	.LASF1574
+	.byte	0x5
+	.long	.LASF1575
+	.byte	0x3
+	.long	.LASF1576
+	.byte	0x2
+	.long	.LASF1577
+	.byte	0x4
+	.long	.LASF1578
+	.byte	0x5
+	.long	.LASF1579
+	.byte	0x5
+	.long	.LASF1580
+	.byte	0x8
+	.long	.LASF1576
+	.byte	0x4
+	.long	.LASF1581
+	.byte	0x10
+	.long	.LASF1582
+	.byte	0xc
+	.long	.LASF1583
+	.byte	0xb
+	.long	.LASF1584
+	.byte	0xa
+	.long	.LASF1585
+	.byte	0x11
+	.long	.LASF1585
+	.byte	0x10
+	.long	.LASF1586
+	.byte	0xd
+	.long	.LASF1587
+	.byte	0x10
+	.long	.LASF1588
+	.byte	0x10
+	.long	.LASF1589
+	.byte	0xd
+	.long	.LASF1590
+	.byte	0xd
+	.long	.LASF1591
+	.byte	0xf
+	.long	.LASF1592
+	.byte	0xd
+	.long	.LASF1593
+	.byte	0xe
+	.long	.LASF1594
+	.byte	0xe
+	.long	.LASF1595
+	.byte	0xd
+	.long	.LASF1596
+	.byte	0xd
+	.long	.LASF1597
+	.byte	0xd
+	.long	.LASF1598
+	.byte	0xd
+	.long	.LASF1599
+	.byte	0x11
+	.long	.LASF1600
+	.byte	0xb
+	.long	.LASF1601
+	.byte	0xb
+	.long	.LASF1602
+	.byte	0x9
+	.long	.LASF1603
+	.byte	0x11
+	.long	.LASF1604
+	.byte	0x1
+	.long	.LASF1605
+	.byte	0x2
+	.long	.LASF1606
+	.byte	0x2
+	.long	.LASF1607
+	.byte	0x2
+	.long	.LASF1608
+	.byte	0x2
+	.long	.LASF1609
+	.byte	0x10
+	.long	.LASF1610
+	.byte	0xd
+	.long	.LASF1611
+	.byte	0xd
+	.long	.LASF1612
+	.byte	0xd
+	.long	.LASF1613
+	.byte	0xd
+	.long	.LASF1614
+	.byte	0xd
+	.long	.LASF1615
+	.byte	0xd
+	.long	.LASF1616
+	.byte	0xd
+	.long	.LASF1617
+	.byte	0xd
+	.long	.LASF1618
+	.byte	0xd
+	.long	.LASF1619
+	.byte	0x3
+	.long	.LASF1620
+	.byte	0x6
+	.long	.LASF1621
+	.byte	0x7
+	.long	.LASF1622
+	.byte	0x4
+	.long	.LASF1623
+	.byte	0x4
+	.long	.LASF1624
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1154:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF448:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF869:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1037:
+	.string	"__DECL_SIMD_logf "
+.LASF421:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1383:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1270:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF397:
+	.string	"USE_RX_PPM "
+.LASF847:
+	.string	"USE_BARO "
+.LASF451:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1253:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF827:
+	.string	"_WCHAR_T_DEFINED "
+.LASF471:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1146:
+	.string	"__DECL_SIMD_sinh "
+.LASF970:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF854:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF487:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1074:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF1536:
+	.string	"ADC_BATTERY"
+.LASF1428:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF543:
+	.string	"__USE_MISC 1"
+.LASF1554:
+	.string	"statsOnArm"
+.LASF472:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1210:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1449:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1047:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF403:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF926:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1150:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1266:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1251:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF452:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1506:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF969:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1535:
+	.string	"_Bool"
+.LASF1172:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1005:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF855:
+	.string	"USE_UART8 "
+.LASF891:
+	.string	"U_ID_2 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1315:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1214:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF943:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1423:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1229:
+	.string	"__DECL_SIMD_erff16 "
+.LASF864:
+	.string	"USE_USB_MSC"
+.LASF510:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF908:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1299:
+	.string	"__f32x(x) x ##f32x"
+.LASF1419:
+	.string	"HDOP_SCALE (100)"
+.LASF1143:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1051:
+	.string	"__DECL_SIMD_expf64 "
+.LASF819:
+	.string	"__WCHAR_T__ "
+.LASF983:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF398:
+	.string	"USE_SERIAL_RX "
+.LASF1217:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1022:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF455:
+	.string	"USE_CMS "
+.LASF1195:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1148:
+	.string	"__DECL_SIMD_sinhl "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1010:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1553:
+	.string	"statsOnDisarm"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1035:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1512:
+	.string	"uint16_t"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF979:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF1316:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF953:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1029:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF483:
+	.string	"USE_CLI_BATCH "
+.LASF938:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1378:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF1004:
+	.string	"_MATH_H 1"
+.LASF897:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF789:
+	.string	"_T_PTRDIFF_ "
+.LASF393:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF1018:
+	.string	"__DECL_SIMD_sinl "
+.LASF1549:
+	.string	"statsConfigMutable"
+.LASF858:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1470:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1393:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF998:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF508:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF859:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF818:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1039:
+	.string	"__DECL_SIMD_logf16 "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF499:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF984:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1095:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1038:
+	.string	"__DECL_SIMD_logl "
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF443:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1275:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF810:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF871:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1426:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1046:
+	.string	"__DECL_SIMD_exp "
+.LASF1256:
+	.string	"__DECL_SIMD_erfc "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1138:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1437:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1330:
+	.string	"_Mdouble_"
+.LASF1278:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF842:
+	.string	"USE_IMU_FAKE "
+.LASF1492:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1230:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1125:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1048:
+	.string	"__DECL_SIMD_expl "
+.LASF490:
+	.string	"__USE_ISOC11"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF863:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF437:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1444:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1514:
+	.string	"stats_total_time"
+.LASF882:
+	.string	"USE_RX_PPM"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF601:
+	.string	"__always_inline"
+.LASF1112:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1284:
+	.string	"__HAVE_FLOAT16 0"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1145:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1144:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1456:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1331:
+	.string	"__MATH_PRECNAME"
+.LASF1181:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF902:
+	.string	"FAST_CODE "
+.LASF1521:
+	.string	"PGR_SIZE_MASK"
+.LASF1341:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1363:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1113:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF876:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1334:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1318:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF439:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF803:
+	.string	"_T_SIZE_ "
+.LASF845:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF997:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1218:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1367:
+	.string	"__MATHCALL_NARROW"
+.LASF1517:
+	.string	"statsConfig_t"
+.LASF1186:
+	.string	"__DECL_SIMD_log2 "
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF440:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF1352:
+	.string	"__MATHDECL_1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1344:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1227:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF940:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF814:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1288:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF985:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1170:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF942:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1199:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1094:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1106:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF465:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1124:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1440:
+	.string	"PG_PID_PROFILE 14"
+.LASF404:
+	.string	"USE_ADC_AVERAGING "
+.LASF1379:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1235:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1280:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF1485:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1376:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF475:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF929:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF430:
+	.string	"USE_OPFLOW "
+.LASF637:
+	.string	"__stub_gtty "
+.LASF875:
+	.string	"USE_1WIRE"
+.LASF994:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF951:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1439:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1131:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF887:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF820:
+	.string	"_WCHAR_T "
+.LASF1003:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1207:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1483:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1065:
+	.string	"__DECL_SIMD_powf128x "
+.LASF933:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF795:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF932:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1160:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1507:
+	.string	"__uint16_t"
+.LASF1303:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF913:
+	.string	"false 0"
+.LASF1132:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1099:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF893:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF531:
+	.string	"__USE_POSIX 1"
+.LASF494:
+	.string	"__USE_POSIX"
+.LASF830:
+	.string	"__INT_WCHAR_T_H "
+.LASF1177:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1473:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1102:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1541:
+	.string	"statsConfig_System"
+.LASF1389:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1071:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1133:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF910:
+	.string	"_STDBOOL_H "
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1241:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1388:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1034:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1062:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1103:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1381:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF965:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF442:
+	.string	"USE_OLED_UG2864 "
+.LASF1396:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF459:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF482:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1365:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF993:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1500:
+	.string	"unsigned char"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF895:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1063:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1194:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1309:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1494:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1424:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF930:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF796:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF982:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF409:
+	.string	"USE_NAV "
+.LASF358:
+	.string	"__k8 1"
+.LASF1441:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF903:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1533:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1436:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF492:
+	.string	"__USE_ISOC95"
+.LASF491:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF901:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF829:
+	.string	"___int_wchar_t_h "
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1228:
+	.string	"__DECL_SIMD_erfl "
+.LASF1420:
+	.string	"NAV_BLACKBOX "
+.LASF1168:
+	.string	"__DECL_SIMD_atan2l "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1474:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1089:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF788:
+	.string	"_PTRDIFF_T "
+.LASF1526:
+	.string	"pgRegistry_s"
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF501:
+	.string	"__USE_XOPEN2K"
+.LASF497:
+	.string	"__USE_POSIX199506"
+.LASF916:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF420:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1476:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1185:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF966:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF411:
+	.string	"USE_TELEMETRY_LTM "
+.LASF521:
+	.string	"_DEFAULT_SOURCE"
+.LASF1523:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF407:
+	.string	"USE_GPS "
+.LASF1468:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF950:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF600:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF402:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1079:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1382:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF888:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1338:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1375:
+	.string	"FP_NORMAL 4"
+.LASF1467:
+	.string	"PG_INAV_START 1000"
+.LASF522:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF826:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1430:
+	.string	"PG_CF_START 1"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1326:
+	.string	"_Mdouble_ double"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1101:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1127:
+	.string	"__DECL_SIMD_coshf "
+.LASF1208:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1200:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1259:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF504:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1105:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1348:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF886:
+	.string	"USE_ITCM_RAM"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1519:
+	.string	"PGR_PGN_MASK"
+.LASF1289:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF542:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1328:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1159:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF466:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF840:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1455:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1550:
+	.string	"statsConfig"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF1178:
+	.string	"__DECL_SIMD_log10l "
+.LASF511:
+	.string	"__USE_GNU"
+.LASF879:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF874:
+	.string	"USE_PITOT_ADC"
+.LASF1055:
+	.string	"__DECL_SIMD_expf128x "
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF446:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1201:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1291:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF1361:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1532:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF513:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF428:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1271:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1165:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF925:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1184:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1087:
+	.string	"__DECL_SIMD_asinf "
+.LASF432:
+	.string	"USE_OPFLOW_MSP "
+.LASF1527:
+	.string	"size"
+.LASF506:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF801:
+	.string	"_SIZE_T "
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF921:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1358:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1329:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1342:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1475:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1054:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1211:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1007:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF517:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF914:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1286:
+	.string	"__HAVE_FLOAT64 1"
+.LASF813:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1395:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF808:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1300:
+	.string	"__f64x(x) x ##f64x"
+.LASF995:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF412:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1524:
+	.string	"pgResetFunc"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1511:
+	.string	"uint8_t"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF422:
+	.string	"USE_RX_UIB "
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1351:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1343:
+	.string	"_Mdouble_ _Float64"
+.LASF1332:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF498:
+	.string	"__USE_XOPEN"
+.LASF1461:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF520:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1264:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1246:
+	.string	"__DECL_SIMD_asinh "
+.LASF880:
+	.string	"USE_ADC"
+.LASF540:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF831:
+	.string	"_GCC_WCHAR_T "
+.LASF1399:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1274:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF900:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1073:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF376:
+	.string	"unix 1"
+.LASF1372:
+	.string	"FP_INFINITE 1"
+.LASF1362:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1126:
+	.string	"__DECL_SIMD_cosh "
+.LASF1364:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1016:
+	.string	"__DECL_SIMD_sin "
+.LASF427:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF787:
+	.string	"_ANSI_STDDEF_H "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF524:
+	.string	"__USE_ISOC99 1"
+.LASF834:
+	.string	"_BSD_WCHAR_T_"
+.LASF1212:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1174:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1282:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF865:
+	.string	"USE_SERVO_SBUS"
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF806:
+	.string	"_SIZE_T_ "
+.LASF881:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF817:
+	.string	"__need_size_t"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF798:
+	.string	"__need_ptrdiff_t"
+.LASF1059:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1090:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1307:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1128:
+	.string	"__DECL_SIMD_coshl "
+.LASF915:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1333:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1346:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1412:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF785:
+	.string	"_STDDEF_H "
+.LASF1213:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF844:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1360:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1109:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF784:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF959:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF1442:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1044:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1415:
+	.string	"LON 1"
+.LASF1335:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF947:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1544:
+	.string	"statsConfig_Registry"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1080:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF417:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1162:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF811:
+	.string	"_SIZE_T_DECLARED "
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF1250:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1203:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1139:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF416:
+	.string	"USE_PITOT_ADC "
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1163:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1281:
+	.string	"__f128(x) x ##f128"
+.LASF1219:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1337:
+	.string	"_Mdouble_ long double"
+.LASF1019:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1490:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1260:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1015:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF996:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1171:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1088:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1267:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF533:
+	.string	"__USE_POSIX199309 1"
+.LASF1528:
+	.string	"address"
+.LASF1002:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1008:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF843:
+	.string	"USE_FAKE_BARO "
+.LASF1320:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF946:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF836:
+	.string	"NULL"
+.LASF1405:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1497:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1336:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF473:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF935:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF554:
+	.string	"__PMT"
+.LASF832:
+	.string	"_WCHAR_T_DECLARED "
+.LASF431:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF418:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1482:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF1234:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1187:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF904:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1236:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1522:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1279:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF989:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF479:
+	.string	"USE_VTX_TRAMP "
+.LASF1427:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF414:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF919:
+	.string	"UNIT_TESTED "
+.LASF1435:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF1176:
+	.string	"__DECL_SIMD_log10 "
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1085:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF1538:
+	.string	"ADC_CURRENT"
+.LASF824:
+	.string	"_WCHAR_T_ "
+.LASF948:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1084:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF963:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF564:
+	.string	"__P(args) args"
+.LASF1463:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1295:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF954:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF934:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF802:
+	.string	"_SYS_SIZE_T_H "
+.LASF1136:
+	.string	"__DECL_SIMD_expm1 "
+.LASF867:
+	.string	"USE_OLED_UG2864"
+.LASF1345:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1255:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1202:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF512:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1499:
+	.string	"MIN_FLIGHT_TIME_TO_RECORD_STATS_S 10"
+.LASF399:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1141:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1413:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF1198:
+	.string	"__DECL_SIMD_log1pl "
+.LASF503:
+	.string	"__USE_XOPEN2K8"
+.LASF1036:
+	.string	"__DECL_SIMD_log "
+.LASF1431:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1030:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF838:
+	.string	"__need_NULL"
+.LASF839:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1366:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1515:
+	.string	"stats_total_dist"
+.LASF433:
+	.string	"USE_PITOT_MS4525 "
+.LASF1347:
+	.string	"_Mdouble_ _Float32x"
+.LASF541:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1537:
+	.string	"ADC_RSSI"
+.LASF505:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1147:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1310:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1092:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1060:
+	.string	"__DECL_SIMD_powf32 "
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1191:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1422:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1076:
+	.string	"__DECL_SIMD_atan "
+.LASF1122:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1353:
+	.string	"__MATHDECL_ALIAS"
+.LASF1448:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1530:
+	.string	"reset"
+.LASF425:
+	.string	"USE_RANGEFINDER "
+.LASF992:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1110:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1093:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1196:
+	.string	"__DECL_SIMD_log1p "
+.LASF1268:
+	.string	"__DECL_SIMD_tanl "
+.LASF1123:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF453:
+	.string	"USE_LOG "
+.LASF1354:
+	.string	"__MATHDECL"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF835:
+	.string	"__need_wchar_t"
+.LASF1501:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1504:
+	.string	"signed char"
+.LASF1296:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1041:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1024:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF460:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1140:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF799:
+	.string	"__size_t__ "
+.LASF535:
+	.string	"__USE_XOPEN2K 1"
+.LASF1369:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF972:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF828:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1220:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1224:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF968:
+	.string	"sq(x) ((x)*(x))"
+.LASF1020:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1192:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF426:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1357:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF964:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF489:
+	.string	"_FEATURES_H 1"
+.LASF1298:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF807:
+	.string	"_BSD_SIZE_T_ "
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF866:
+	.string	"USE_DASHBOARD"
+.LASF480:
+	.string	"USE_VTX_FFPV "
+.LASF1400:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1188:
+	.string	"__DECL_SIMD_log2l "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1287:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF450:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF894:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1339:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF478:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF928:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1249:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF906:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1384:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF396:
+	.string	"USE_I2C_PULLUP "
+.LASF1032:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1520:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1042:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1164:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1453:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF841:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1403:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1391:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1462:
+	.string	"PG_VTX_CONFIG 54"
+.LASF952:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1317:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1469:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF401:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1033:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1493:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1425:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1222:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1297:
+	.string	"__f32(x) x ##f32"
+.LASF1452:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1373:
+	.string	"FP_ZERO 2"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1049:
+	.string	"__DECL_SIMD_expf16 "
+.LASF877:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF873:
+	.string	"USE_PITOT_MS4525"
+.LASF1529:
+	.string	"copy"
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF962:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF526:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF457:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF493:
+	.string	"__USE_ISOCXX11"
+.LASF957:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1509:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1040:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1445:
+	.string	"PG_SERVO_MIXER 21"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1189:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF519:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF461:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF1225:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1152:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF884:
+	.string	"USE_RCDEVICE"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF974:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1409:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF792:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF937:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF791:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1153:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1321:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1411:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1407:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1156:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1327:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1513:
+	.string	"uint32_t"
+.LASF805:
+	.string	"__SIZE_T "
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1404:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1301:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1394:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1142:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1193:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF956:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1205:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1548:
+	.string	"millis"
+.LASF804:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1302:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1356:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1215:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF532:
+	.string	"__USE_POSIX2 1"
+.LASF1244:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF577:
+	.string	"__flexarr []"
+.LASF1304:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF518:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1056:
+	.string	"__DECL_SIMD_pow "
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF485:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1390:
+	.string	"M_PI 3.14159265358979323846"
+.LASF920:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1459:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF945:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF821:
+	.string	"_T_WCHAR_ "
+.LASF1552:
+	.string	"writeEEPROM"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF456:
+	.string	"CMS_MENU_OSD "
+.LASF1072:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1551:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF529:
+	.string	"_POSIX_C_SOURCE"
+.LASF1025:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF833:
+	.string	"__DEFINED_wchar_t "
+.LASF927:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1402:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1410:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF415:
+	.string	"USE_PITOT "
+.LASF405:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1414:
+	.string	"LAT 0"
+.LASF477:
+	.string	"USE_VTX_CONTROL "
+.LASF1510:
+	.string	"char"
+.LASF1359:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1182:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1242:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1290:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1012:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF981:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1179:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF1096:
+	.string	"__DECL_SIMD_hypot "
+.LASF1312:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1052:
+	.string	"__DECL_SIMD_expf128 "
+.LASF530:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF463:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1011:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1183:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1075:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF924:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1495:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1432:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF544:
+	.string	"__USE_ATFILE 1"
+.LASF991:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF467:
+	.string	"USE_RX_MSP "
+.LASF999:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF912:
+	.string	"true 1"
+.LASF1487:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1013:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1478:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF429:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1067:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1053:
+	.string	"__DECL_SIMD_expf32x "
+.LASF435:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1392:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF987:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1285:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF816:
+	.string	"__size_t "
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1155:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF967:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1454:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1262:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1091:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF837:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1247:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1223:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1190:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1458:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF400:
+	.string	"USE_SERIALRX_SBUS "
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF917:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF949:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1263:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1117:
+	.string	"__DECL_SIMD_exp10f "
+.LASF1050:
+	.string	"__DECL_SIMD_expf32 "
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF955:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1306:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF790:
+	.string	"_T_PTRDIFF "
+.LASF1081:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1273:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1216:
+	.string	"__DECL_SIMD_acosh "
+.LASF1272:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF408:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1525:
+	.string	"statsConfig_s"
+.LASF371:
+	.string	"__linux 1"
+.LASF1368:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1401:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1371:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1293:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF462:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1486:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1173:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF419:
+	.string	"USE_GYRO_KALMAN "
+.LASF1129:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1226:
+	.string	"__DECL_SIMD_erf "
+.LASF1387:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF978:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF538:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1319:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF961:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1261:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1443:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1547:
+	.string	"getTotalTravelDistance"
+.LASF1498:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1066:
+	.string	"__DECL_SIMD_acos "
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1137:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1161:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1043:
+	.string	"__DECL_SIMD_logf32x "
+.LASF939:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF507:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF413:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1231:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1398:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1534:
+	.string	"double"
+.LASF870:
+	.string	"USE_RANGEFINDER"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1069:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1325:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1406:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1239:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1433:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1243:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF825:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1114:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF395:
+	.string	"I2C2_OVERCLOCK false"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF899:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1386:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1313:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1380:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1508:
+	.string	"__uint32_t"
+.LASF1077:
+	.string	"__DECL_SIMD_atanf "
+.LASF488:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1120:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1254:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF495:
+	.string	"__USE_POSIX2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1151:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1446:
+	.string	"PG_IMU_CONFIG 22"
+.LASF878:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF458:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1068:
+	.string	"__DECL_SIMD_acosl "
+.LASF1447:
+	.string	"PG_RX_CONFIG 24"
+.LASF1451:
+	.string	"PG_GPS_CONFIG 30"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF502:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1283:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1322:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF441:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1204:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1057:
+	.string	"__DECL_SIMD_powf "
+.LASF1324:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF822:
+	.string	"_T_WCHAR "
+.LASF815:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1232:
+	.string	"__DECL_SIMD_erff128 "
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF786:
+	.string	"_STDDEF_H_ "
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1086:
+	.string	"__DECL_SIMD_asin "
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1355:
+	.string	"__MATHCALL"
+.LASF1180:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1488:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1248:
+	.string	"__DECL_SIMD_asinhl "
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF1450:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF454:
+	.string	"USE_STATS "
+.LASF846:
+	.string	"USE_MAG "
+.LASF1479:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1233:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1206:
+	.string	"__DECL_SIMD_atanh "
+.LASF1417:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1314:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF496:
+	.string	"__USE_POSIX199309"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1118:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1491:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF958:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF793:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF823:
+	.string	"__WCHAR_T "
+.LASF1472:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1460:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1135:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1097:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1031:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF794:
+	.string	"___int_ptrdiff_t_h "
+.LASF1082:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1374:
+	.string	"FP_SUBNORMAL 3"
+.LASF1292:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1377:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1349:
+	.string	"_Mdouble_ _Float64x"
+.LASF890:
+	.string	"U_ID_1 1"
+.LASF889:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1175:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1061:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1027:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1518:
+	.string	"pgn_t"
+.LASF1277:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1421:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1539:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1083:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF394:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1546:
+	.string	"arm_distance_cm"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF527:
+	.string	"_POSIX_SOURCE"
+.LASF1111:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF1107:
+	.string	"__DECL_SIMD_exp2f "
+.LASF481:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1481:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1023:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1540:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF486:
+	.string	"_STDINT_H 1"
+.LASF523:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1305:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF424:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1276:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF449:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF534:
+	.string	"__USE_POSIX199506 1"
+.LASF1408:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF892:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1340:
+	.string	"_Mdouble_ _Float32"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1434:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1001:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF922:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1197:
+	.string	"__DECL_SIMD_log1pf "
+.LASF484:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF905:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF860:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF536:
+	.string	"__USE_XOPEN2K8 1"
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1134:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF1245:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1116:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1545:
+	.string	"arm_millis"
+.LASF539:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1130:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1104:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1221:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1021:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1543:
+	.string	"pgResetTemplate_statsConfig"
+.LASF474:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF434:
+	.string	"USE_1WIRE "
+.LASF1237:
+	.string	"__DECL_SIMD_tanhf "
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1269:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1294:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1121:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1064:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1014:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF918:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF861:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF528:
+	.string	"_POSIX_SOURCE 1"
+.LASF1078:
+	.string	"__DECL_SIMD_atanl "
+.LASF976:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1257:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1000:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF911:
+	.string	"bool _Bool"
+.LASF907:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1209:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1516:
+	.string	"stats_enabled"
+.LASF1115:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1149:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1006:
+	.string	"__DECL_SIMD_cos "
+.LASF406:
+	.string	"USE_BLACKBOX "
+.LASF1070:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF971:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF960:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1157:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF410:
+	.string	"USE_TELEMETRY "
+.LASF1058:
+	.string	"__DECL_SIMD_powl "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF1240:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF438:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF862:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF986:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF885:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1471:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1350:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF812:
+	.string	"__DEFINED_size_t "
+.LASF447:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1418:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF848:
+	.string	"USE_UART1 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF975:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1464:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF445:
+	.string	"USE_FRSKYOSD "
+.LASF1465:
+	.string	"PG_CF_END 56"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF896:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1480:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF509:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1397:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF856:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1098:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1009:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1503:
+	.string	"long unsigned int"
+.LASF436:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF849:
+	.string	"USE_UART2 "
+.LASF514:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1496:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1416:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF931:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1166:
+	.string	"__DECL_SIMD_atan2 "
+.LASF977:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1484:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1028:
+	.string	"__DECL_SIMD_sincosl "
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1311:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1308:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1505:
+	.string	"short int"
+.LASF1457:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF990:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1108:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1045:
+	.string	"__DECL_SIMD_logf128x "
+.LASF850:
+	.string	"USE_UART3 "
+.LASF980:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1323:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF909:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1489:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF800:
+	.string	"__SIZE_T__ "
+.LASF936:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF476:
+	.string	"USE_RCDEVICE "
+.LASF988:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF872:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF973:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1466:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1502:
+	.string	"unsigned int"
+.LASF500:
+	.string	"__USE_UNIX98"
+.LASF851:
+	.string	"USE_UART4 "
+.LASF1100:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1477:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1265:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1370:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1167:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1026:
+	.string	"__DECL_SIMD_sincos "
+.LASF1238:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF464:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF944:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1119:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF423:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1017:
+	.string	"__DECL_SIMD_sinf "
+.LASF1531:
+	.string	"pgRegistry_t"
+.LASF1169:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF852:
+	.string	"USE_UART5 "
+.LASF1438:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF444:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1258:
+	.string	"__DECL_SIMD_erfcl "
+.LASF868:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF923:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF537:
+	.string	"_ATFILE_SOURCE"
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF898:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF797:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF941:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF525:
+	.string	"__USE_ISOC95 1"
+.LASF1385:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF857:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1252:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1542:
+	.string	"statsConfig_Copy"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF853:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1158:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1429:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1622:
+	.string	"io_types.h"
+.LASF1617:
+	.string	"mathcalls-helper-functions.h"
+.LASF1609:
+	.string	"math.h"
+.LASF1592:
+	.string	"long-double.h"
+.LASF1582:
+	.string	"platform.h"
+.LASF1614:
+	.string	"flt-eval-method.h"
+.LASF1584:
+	.string	"target.h"
+.LASF1602:
+	.string	"battery.h"
+.LASF1586:
+	.string	"libc-header-start.h"
+.LASF1603:
+	.string	"stdbool.h"
+.LASF1569:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1562:
+	.string	"src/main/navigation"
+.LASF1598:
+	.string	"stdint-intn.h"
+.LASF1605:
+	.string	"axis.h"
+.LASF1568:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1571:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1593:
+	.string	"stubs.h"
+.LASF1564:
+	.string	"src/main/target/SITL"
+.LASF1561:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1574:
+	.string	"stats.h"
+.LASF1567:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1620:
+	.string	"failsafe.h"
+.LASF1578:
+	.string	"config.h"
+.LASF1588:
+	.string	"features-time64.h"
+.LASF1572:
+	.string	"types.h"
+.LASF1610:
+	.string	"math-vector.h"
+.LASF1613:
+	.string	"floatn-common.h"
+.LASF0:
+	.string	"./src/main/fc/stats.c"
+.LASF1590:
+	.string	"timesize.h"
+.LASF1558:
+	.string	"src/main/drivers"
+.LASF1570:
+	.string	"/usr/include"
+.LASF1611:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1555:
+	.string	"src/main/build"
+.LASF1600:
+	.string	"sanity_check.h"
+.LASF1587:
+	.string	"features.h"
+.LASF1583:
+	.string	"common.h"
+.LASF1595:
+	.string	"typesizes.h"
+.LASF1556:
+	.string	"src/main/common"
+.LASF1557:
+	.string	"src/main/config"
+.LASF1580:
+	.string	"navigation.h"
+.LASF1596:
+	.string	"time64.h"
+.LASF1573:
+	.string	"stdint-uintn.h"
+.LASF1565:
+	.string	"src/main/target"
+.LASF1623:
+	.string	"rx_pwm.h"
+.LASF1618:
+	.string	"mathcalls.h"
+.LASF1563:
+	.string	"src/main/sensors"
+.LASF1579:
+	.string	"stats.c"
+.LASF1566:
+	.string	"src/main"
+.LASF1576:
+	.string	"time.h"
+.LASF1624:
+	.string	"parameter_group_ids.h"
+.LASF1616:
+	.string	"fp-fast.h"
+.LASF1597:
+	.string	"wchar.h"
+.LASF1612:
+	.string	"floatn.h"
+.LASF1621:
+	.string	"gps.h"
+.LASF1559:
+	.string	"src/main/fc"
+.LASF1607:
+	.string	"maths.h"
+.LASF1615:
+	.string	"fp-logb.h"
+.LASF1619:
+	.string	"feature.h"
+.LASF1560:
+	.string	"src/main/flight"
+.LASF1591:
+	.string	"cdefs.h"
+.LASF1585:
+	.string	"stdint.h"
+.LASF1604:
+	.string	"build_config.h"
+.LASF1599:
+	.string	"stddef.h"
+.LASF1594:
+	.string	"stubs-64.h"
+.LASF1608:
+	.string	"vector.h"
+.LASF1589:
+	.string	"wordsize.h"
+.LASF1601:
+	.string	"common_post.h"
+.LASF1577:
+	.string	"adc.h"
+.LASF1575:
+	.string	"parameter_group.h"
+.LASF1581:
+	.string	"stdc-predef.h"
+.LASF1606:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 k\225\002"
+	.string	"\324\003_"
+	.string	"\t"
+	.string	"\264\211\320\230\n\f\002"
+	.string	"\001\001\240\342\234\212\n\002\003\004\331\236\356\335\b\004"
+	.string	"\002"
+	.string	"\005\366\270\215\240\t\002\002\002\002\001\006\244\277\370\313\f\007\310\241\354\333\007\b\240\342\234\212\n"
+	.string	"\b"
+	.ascii	"F\211\201\273)\315^\004@\200]\336\\C0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 #\315"
+	.string	""
+	.string	"x\027"
+	.string	"\003"
+	.string	""
+	.string	"\001"
+	.string	"\001\004\005"
+	.string	"\001"
+	.string	"\001"
+	.string	"\003"
+	.ascii	",\203A\320\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 \236\355\002"
+	.string	"T\004\222"
+	.string	"\003"
+	.string	""
+	.string	"\026\314\231\263\276\003g\001"
+	.string	""
+	.string	"\002\034\332\236\212\376\003e"
+	.string	""
+	.string	"\006\200\200\200\200\002d\002"
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\013\001\n\004"
+	.string	"\t\200\200\200\240\004\005"
+	.string	"\007\262\346\314\211\002f\006\003\001\n"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t"
+	.string	"`\004\360\235j=\300"
+	.ascii	"\252q\263\032\003\002~\312~\033\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 \035\245"
+	.string	""
+	.string	"P\021"
+	.string	"\003"
+	.string	"\004\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"(!\300\305\033\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\230\004\004\230\004\005\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 P\235\001"
+	.string	"\360D"
+	.string	"\003"
+	.string	"\002\002\003"
+	.string	"\001\002\003\001"
+	.string	"\002\004"
+	.string	"\001"
+	.string	"\004\005\001\002\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	" HM\202\230\001\214\272\270\245\340\225\361 \340\r`\001"
+	.text
+	.section	.gnu.lto_.lto.a11d11f593c50964,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_statsConfig_Registry.47.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 \2205\004"
+	.string	"\204\007`"
+	.string	""
+	.string	""
+	.string	"$"
+	.string	"\005\001\212\001\206\200\200\374\342\203\226\252\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\336\006us\250\367\005uq"
+	.string	"\005\001\006'\001\f\361'?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\026./src/main/fc/stats.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_statsConfig.49.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 (A\001"
+	.string	"\033"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\035\001"
+	.string	"\005\001\006(\001"
+	.string	"?\202\210\200\030\177}\274\001{\274\001y\273\001"
+	.text
+	.section	.gnu.lto_statsOnArm.52.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375`-"
+	.string	"\215\007"
+	.string	"\362M25@o\222\016@E\245\210b\330\026RO\352c\220E\007\030f\252wwk\310\376\217\267\334\332\322j\234\245u'\006s\\\303\353\312C\nw;\313\\6Z#[\246_\032\315\263\361h\357zx\020\234M\347]\231\3664\007c\021\016\331\363`X\3660\247l\225\256d\221\244Dn4\212p0\205"
+	.string	"\277\203a7t\r\037u\027\244!\022\267c\355c\335\017@-Dm+\"|\271\302\237\240\300nu\f\031#\027:c:Il\371S\b\235\306\267JW\372\342X\274\002\006\033\031\224\314\213\027\227LY#\036\1771\203^\005\241\242\300\304\002\305\222\231\317q\024T\004\335\232:\260\221B\305\200\205\314\0347\022Fw\375\023~\205\277$\017"
+	.ascii	"3\241\275\037\330f\216Ac@\b\253\006\006#\301\\\\\235\022O[\\"
+	.ascii	"\023\357B\310/C\204\313\261h'\031"
+	.text
+	.section	.gnu.lto_statsOnDisarm.53.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"%\013"
+	.string	"v\325NA\020Q\225\016\360\204\001\2673\002|\267\271)\374\360PX\211 \031\250\016Th\220\341bDx\373\350\266\351\t\fR\2605H\""
+	.string	"@\307*\360p\032\361\336\245\003\360 ;\256sl\2116\222\275\267L)<"
+	.string	"<"
+	.string	"9"
+	.string	"\027>d`@Qcw\263\370\341\336eT\317\377\351\035\037\370\271\224px\224\003Z+h<\274j"
+	.string	"E\2222*}?]3\200!U\016\005\273k\375\300\r\367\274\355\006\266\023\330\027\t\030\027\025\326\356\350ucW\223\205\311\366g\311\362\022GM\246\311b?\364G<\345\235\204\005\271)\026\264`\265vC\002\237\026 \371\fp\n\366)\037\202}\336Gy\366\304\236=\003@\230F\007\252\030\"u\331\236\360\023\234dWt\3007q\025\005_\304\247+x\364\337\247\357\301>5\216\204H\201\364e\312\013\030\2536\3540\244\321\203}\271\273\353H\262U\2553\316`4\004\0066\232\002\027\220N\243\326.\\\227\351\270L{\220E\200\220\341dZ\207\313.\025o\0226\235\254\333\266N6\tA\227\033If\320a\005\212!\351\2416g\323\177\216\361s\020\256\226\212h.\016"
+	.ascii	"\177\3117cZ\203\332\270jK\016{\001\325>HU\021'\310!\034\273\214"
+	.ascii	">\226\260\307%\216\331$\036L\355\001"
+	.text
+	.section	.gnu.lto_statsOnDisarm.part.0.58.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375`\201\003\375\027"
+	.string	"\346+\230G\300\330*\035\300\354\341V\\\231MQv\204\302r\222\206.\221\036)6m\276Y\3047\362\003rX\233\002\231\321\375\236[\001JP]\201\275f\327T\240I\030\026\001\333\035L \0350\030\241\274\276n\226\020\262\211\334)\005}"
+	.string	"\204"
+	.string	"\203"
+	.string	"~\371 \267\013\251\205\225H\005&[\206j-\033\234Z\001y\232\272"
+	.ascii	"\3614<\215xj\024\347q\001\036=j\255\245\365}6\273\344\373nv\351"
+	.ascii	"\364@l\333l-/{\025\3077[\013J\205)\313\n Q\255uu\2727~{\270\223"
+	.ascii	"\336\374\373>\322\355R<\234\272\235\213o\310`HI\230\323.\027"
+	.ascii	"\n\270\301\241;\360\223\305\0167'\200\323\221B\255\325\344\213"
+	.ascii	"[\274m\013\2661\330\353$\364a\335\034{\2346\215\323\245q\232"
+	.ascii	"4N\217\306ir\234\036\307iq\234\246\3418\275\343\364\034\247\037"
+	.ascii	"`\006\301N\2557Ed*\r\272$\307\177G\"Ca\331\be\242\312^\013\234"
+	.ascii	"#6\323\302\312+/\344`\261\262CTse\203\"7r\3024T\331kq\202!#\312"
+	.ascii	"\027\242Z\313\325\251K\3624\366'\360N<\350\003;D\376\357<"
+	.string	">\320v!5\247re\335\341P\034\013\376\273\317\357\2419\026\330\357\t63l\017\207R#k\255\021|'\177\302\362uN\335\242\321\304S\272\007>\300\221\237\031>\236S\231\032\017\3762t|\354\020\362B\363\262\177O\314P\222]\0336\222\233X\017\225\334\024c\027\227p\377{\252f\216\361\030t\227\270\033\356lb\363c\356w\3676:p\263\310\276\222/\251\371:\016\361\242\376K<\235\233@\210W3\213L\232\366\b\330\274\356k\202\006nS\370\300\223@U|\352\0343\327\2067\026\241\n\361\002A\002\326\"`\226\203\226\004\b\256\017\017T3\263\017\323-\225l\306\232\311V-\020+\022/\326\210U+&[\251\006\030V\302\025[\315`\260\330\252d{>\254\233\343\373N\006cX\251Y\2347DM\033C\206y\235S\247\340\013\037\323\002\375\224\226\264&\r\367\251\221WJAC\374\363\2328Z\322\032"
+	.string	"\"w\334\021\225\r/r\317D\210G3m\016\035\346u\343\236\013\r\214\217\270Sj\t\202\244\\\327\205n\270\342\212@\001E\250Q0\350\2142\204\f\221\214\210$)j1\200\002!+\353\006\021\260A#\022m\232\235\003\357\364\374\247\276'\221\200V\310\214\235\022\247S\213\273"
+	.ascii	"-\t\2256\337E\244\006BG\3762\r\351\207{\t\323\034\034\210\241"
+	.ascii	"\0324f<\227\373\215lk\002\230\255\227\2641*\206L\037F\260>\b"
+	.ascii	"E\200\346\t\034X_G\036k\337Of\260\"EM\003\245Zu\f}\006\215\341"
+	.ascii	"\354\2177\213\300\310.@\354\232m\270\037#\337\335\335\353\374"
+	.ascii	"\256\307\305A\225j1\277\244g\204M\363\344K\f\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375`."
+	.string	"\005\006"
+	.string	"D\t*\001"
+	.string	""
+	.string	""
+	.string	"\002:\177\005\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\224\202\202\200 "
+	.string	""
+	.string	""
+	.string	"\0052\006\300\204\001"
+	.string	""
+	.string	"\003\005,\007\301"
+	.string	"\0053\b\300\003\0024\177\t\272\220\202\0025\177\n\0051\013\305\204\001"
+	.string	"pg_resetdata"
+	.string	""
+	.string	"\005/\fgistry"
+	.string	""
+	.string	"\005-\r\0016\177\016\377\037"
+	.string	""
+	.string	"\200\220\200\002"
+	.string	""
+	.string	""
+	.string	"\0017\177\0178\177\020\003"
+	.string	"\013\320\360\372\250\001\001\304\016\003"
+	.string	"\n\204\n\003"
+	.string	"D\003\004\n\244\001\003\005"
+	.string	"\202\001"
+	.string	"\021"
+	.ascii	"M\r\005\203\265\266[\232\234\271\f\n\324\203\017x\317\023\f\317"
+	.ascii	"\317\rc\202\263\340\316l\3019(\004\031\253\323 4\031\2242"
+	.text
+	.section	.gnu.lto_.refs.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375 7\271\001"
+	.string	"3"
+	.string	""
+	.string	""
+	.string	"\006"
+	.string	""
+	.string	"\001\003"
+	.string	""
+	.string	"\002\f"
+	.string	"\001\002\016"
+	.string	""
+	.string	"\003\021"
+	.string	""
+	.string	"\002\026"
+	.string	"\001\002\030"
+	.string	"\002\004\001\001\003"
+	.string	"\001\003\006"
+	.string	"\001\005"
+	.string	"\002\002"
+	.string	"\003\007\002\002\002\b\002\006"
+	.text
+	.section	.gnu.lto_.decls.a11d11f593c50964,"e",@progbits
+	.string	"(\265/\375`\030\017\365P"
+	.ascii	"j\2154\037T@\220:J\007rH\232\251\300\203\330d\315&\320\003\212"
+	.ascii	"\340\207o6\241\271\306\221\362\004.\362\273\306u\341a\f\334M"
+	.ascii	"m\355W\016\320\207\261Y(I\303\215\020\273\363P\345\033\026m\341"
+	.ascii	"\242\364?X\245\275\221@<\024x\242T_o^;V\300\356\021\333m\313"
+	.ascii	"\024\242\001\316\001\360\001}\243\211B\356nJ\217\335\304d\013"
+	.ascii	"\310$\023q\343\330<]\034:\021\251\222;M\304\344\215\276\022\302"
+	.ascii	"PF&U\322\350\313\n\323\252\211\251\220\255\332Ly\274La\332\306"
+	.ascii	"\356f4<l\262\224Y\253\266K\020.\207\017\266$\325\236\207pQ\321"
+	.ascii	"\223\376\330QU\303\370kg\0072Sc\325\236\305\025n\342\200\320"
+	.ascii	"\303\037V\\\205\277X\213\233'\212>]\244*S\353N\275\030\214\267"
+	.ascii	"\360\222\277\030\3139\013k\271M\273\213\335}\316\372\215\376"
+	.ascii	"\025.\370\213\24503\005\261;\310\3249\204\226\0346\254u\247D"
+	.ascii	"DAD9I\034\222\310\341\332\2231\212s\207\201\316\007\357y\227"
+	.ascii	"\267\230\213\227C\334u\266\302U\236SL\233\231c\006\315\324V\265"
+	.ascii	"W\341\236\207\316\036\036:\037\302\265\ft\036\300(N\236\302)"
+	.ascii	"/U0\020_\341\3427\341\262\263\272\323\036\2367P\336(Q\3555\270"
+	.ascii	";\2713\225\003-\333\305}\356Y\305\311m\254\342|\275?G\341\254"
+	.ascii	"\241\233\321)\331[\335\351\017O\0333D\254j\2372\212\3632\320"
+	.ascii	"\t\266B\004\366\200\200\237\177\340\f\030\203\247\320\371\031"
+	.ascii	"\n\277\270\200-\370\231E\005\377\205\232\377\265\374\377\372"
+	.ascii	"\017\366\277\315\177\373\263\232\237\027\370\231\350\347\006"
+	.ascii	"~\026\372\231\201\237\207~~\200\202\237w~V\340\347\0048\306\377"
+	.ascii	"\236\277\256\360\363\004?K\360s\213\237s?C\360\237\355\377\330"
+	.ascii	"\3772\377\311\374\037\363_\314\1770\377\273\374\357\372\037\366"
+	.ascii	"\177\313\377\254\377?\377\305\376\237mmmm?\027\377Z\366\353L"
+	.ascii	"\005E\206H\322C\265\225\317\345d4\3474L-!g\325\3766\274g$8\211"
+	.ascii	"?\207u\300\032{\303v\317j\377st\334\3640\243R-\037q\233\352\031"
+	.ascii	"\241\027\2020\321Q\355\371\210\237\213\3403Nka\200\031\332\226"
+	.ascii	"`S-\237a\264s\032\033\221\326\"\331=\344\264\0367\335\303\036"
+	.ascii	"f\004\230\021\260>P-\351:\355k\331\275\031\2438y\030\350\344"
+	.ascii	",Fg3\240\363\210L\273G'L\027\265)\315\213\313*\3632-\306m\300"
+	.ascii	"\226L\322k\331\344\316d\310p\023\004\016\300\266\324\254\256"
+	.ascii	"\335\312\235\307\234\227<\206\275\234G\017\202 Q\353#\322\201"
+	.ascii	"[\327\2322V\325\276N]\213\226;\213Y\262\030n\332\264\241dL9\246"
+	.ascii	"\016\274\366\270\377\362\205\307\316nN\223O\307F\036\207p\312"
+	.ascii	"\034\007\301B\234\305\030\314\222\305x\214\373\330\215\354\333"
+	.ascii	"\2313Ok\326\032\211\034\302q\361\201\243L\315y\354i;\335)pC\\"
+	.ascii	")\351B\273\347 \356_\377\263\207\307\356\356\201K\333\213\270"
+	.ascii	"s\376|\306\361\360\215\023\350\233\233n Yi\316/\312\2504\325"
+	.ascii	"\376?\240\377?\203n\023\214E\345\361\307\310\034\n\177t\244J"
+	.ascii	"(#S\t\365\323\3512\252\231U\335\306bRX\207\2356\224O\027\225"
+	.ascii	"P\267\207j\306\264\217?\235\016\217\334\312\243qk(\37412\225"
+	.ascii	"B#3\t\365cL\225P]l\341-.\273\213I\250\037\254T\331F\346\020\312"
+	.ascii	"\307\310L\n\243\262\210\030\001`\303\004\303\304Xl\036\005`\025"
+	.ascii	"\223G2c\232d\257n\341VS\0379\355Vv\003I\"\340UT\"\364\"\222\361"
+	.ascii	"\300A\026S!K\355 R%sRb\223\031\257\2224\232\272\315zG\013!\013"
+	.string	"\323\356\366\270!\027\207\303\211\223\372\204\305\324\316z`\341\230n\326\306\236p\363v\366\204l\311\331\305\375\3101\251L\352\025/\373\351\324\3622#e\255\0339d\211\260E9\253W\225\207\2346R\311%\252\255M\216\206h\205Y\271\267S\256\315\222{]R\227\260\227 \237n*!\274v\226h!\001\246\344Z27\257M\274d75I\020\225T\250\343\006I\316\225\031\2265\325\"\251W\320 1\246\332[!\367\234\245\243\356(\"\007\217\352\224e\026U\245\234\200y\252N'\204?\335Ub\254\206\324#\325H-Ru\250;\360\262\022\2517\274\336\250\306\007\325c%R{\324\037LV$\203\2540\025\007\221\212C\245b2\244O\027\263\240\251u7\021\021\021Q\020\021\221\211\034J\262\251\023V\307\321R\020\215 H1\242*k\025/+\325\203\322\356-\026\277\021U\005R\2050\0312\355\036,\234\311a\215"
+	.ascii	"\"\236$\2100\303\341\024R\223'\256\244D\320T[s\300AF\211\321"
+	.ascii	"\2406\305\313\032\344\252\301\372Rs\264{1B\205v\177+\273\277"
+	.ascii	"}A\3362jSa\302\356o^\267\326P}\360R\250\332\360\nU\217\307\r"
+	.ascii	"\323N\353\221%\270\200\320\272g\241\363\326\326\306B\347o\313"
+	.ascii	"[\031\350\364a\024\347o>\334\337z\270\177\335Q\235p\314/i\302"
+	.ascii	"T'f%\003\306\211\310\344\372\f1\320Y\211\225\006"
+	.string	"^\203\202EHC\221\004#b\232\325\332:\254E\244\272\240\021\366\034\315:\254\221\240\236\232T\313m\267\351V%\204\303J\322\354R\355\271\215\007H\223\252!\325\362\022F\34778)1!G\252\325\271=]k&\307P\230\313\316m\312\230\315RI\205*(\001\342\200Eb\364\002K\317\033\252\324\374P-\253a6\274\366\347\234\330\302\303\311\207\033\367\274\306Dh\222\013\273`\215\021x3\006\030\241\004\031&t\320\001\032\354\375b\3209\215\242\035R\017\206\235O\001\016\222P\030v?\024P\b\242H\002\234FQ\016\370Ca\350\375\216\n\b\352\200#\334\323\006\323\322\006\247Q\304Tc\351\207\244\373\241ATi\367\3331\345x\013\360|5<\b\242@\035\337\214\212\003\352v\202:\037\022\023\316\207\304t\013\352^\030\2413\364\200\026\bD\177GG;\034\033LK<\373\0132\335\276c\343\027\004\366\220P\031\272"
+	.string	"\216P\037R/i\207s\204\002kX\337R/\310C\2018\337\005wG?\035\022\023\317oG\203guhp\227\304\244\204\242\020D\201\250\f$&\003\224~\032\370J0\241\304\323\241<\337\256G\t\r\002m\234"
+	.string	""
+	.string	"\260\227\224\324S\322)\375v&\316\343\211\240(\370\3331\025)\375v\300\036\007\276\022\0028\257\367C}(\322}\213\027\020\274\200!\003\316a\304\210 F\004\347a\30402\212\361\302\350\376\205\321-x\032\002|\211\t\375\345\202KK\277\234\016P\207\324\233\341[\332"
+	.ascii	"U\352\005W\260\270A`\357H\227\264\013.\005u>A\035\214\240\257"
+	.ascii	"W\003\347;#\036\f\027\350Q\213\242\237O0\301\006\007\244@\302"
+	.ascii	"\007\227W\224\343\315\310\371z;\245\034\357\007\314\025\2418"
+	.ascii	"B\223\\\330\371P\0350\270\013\002y\216cn\325+[\265\231#\354\026"
+	.ascii	"\3724\261L\207W\263\313\310\r\033\202tq\335&\351\260\031tSri"
+	.ascii	"3\\..,W\227UkY\255,P\354nj\031\224 6\325\032\351c\310J\255\242"
+	.ascii	"s\204+J\254J\375b\305\306C\227\364\204\250\035\336T\013\004c"
+	.ascii	"\371\005^QD.*c\226K\252\bU\265i\326\316\323\323\221\344\224\372"
+	.ascii	"\244\007G\2204%\244p\363r\245\221\351\210R\257nbZzx\222\305^"
+	.ascii	"NH\241m9\373\201\331\216:<\371\250\026'\204\002\205\307"
+	.string	"\202\242\244F\200\355\204\031\235L\325\201\032\250\2210h\0244C\"\"\"\"I\223t\001\005\204(\n)4\017\021`\245\204FhD\222$\3112\006\273\340\360X\234\211]\034b\312\361\206\027\003\260\n\273\243b\204\030\376\027h\245\265\027fA\261\327\r\372\212@E4\262\364\021\254\237A\265\353\301\013$Y>\034$\034]\367g\371F\277\234\224\202\005\231_\034B\020\303\331\305\007\346_\200\376\274\245G\372\263\0338\273f\246\332:\330\262o\253D\366\035\357P\233\264\325\347U2Z\275J\006\340"
+	.string	"\345\340\201r\205\006;\377\266\251$\307\3137\271\230\013\026\033owZ\254\216)yE\r)\324\274\335\350f<\307\360\322\005*D\263\372DQ\221\331\243!\262\212\002\300\260\005\026\2625\355ceCC6\037Xs{\202\304\305\200\304\203\022\200\026o\001\215)q\334S\036\335\363\301\333\0229\r\355{\310{C\037\f\351\340\3144\366k\3343b\315gr\344\001pm2~^\227\336,\322\207\256\t\036\324\371,\304\230\270fW\204O\nI\264\255\336/n%\305)\260d1\357\356\2448\322u\376\236\007\320xr\312\2029\2367ta\376\001W\364\b\371\317\330\250\234\240n$\250\252\351\264\347L\244\216&T\236\253\307\013?\020\307\351\313jH\234\274.&X\005\023\316TC"
+	.string	"\350\247EV3\355\210\365_\242h\362\330M\374\036\347\221\365@\377v\243\003\237\\\030\221\240\253S\207\f%\216\306Nf\311\343\214\036u\223SP\204t\354\377\020\364\313\236\304\343\022\207<\267\265\303\3744\315x\303\302H\022=MY\317\272\033\212\320\002\203\243\200'a\256\220\273\031\270\357\206\336\313\360\304\271$o\002P\331.\030d\242\031.\004\200\270\307\3565\302~\374\276\304\263d/7\260\343\374\177\237\250\241\346S\242\301R\3011\210*\177\326\002\242\034\r\243\240\316'\006\351N\024\244\367\007\210\357i\332z\245\237\007"
+	.ascii	"\240X\341i\037#\0077\023\366\302\246\3326Q\352\253\251\003\365"
+	.ascii	"Xu)\347b\347R\336\367\t\201\363\373\214\372\347\302\242\303\243"
+	.ascii	"c\254\354b\336>N\350v\032XI\375+\034\310UK\241GY\3476\325\263"
+	.ascii	"\320U"
+	.text
+	.section	.gnu.lto_.symtab.a11d11f593c50964,"e",@progbits
+	.string	"statsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341"
+	.string	""
+	.string	""
+	.string	"statsOnArm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345"
+	.string	""
+	.string	""
+	.string	"statsOnDisarm"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334"
+	.string	""
+	.string	""
+	.string	"pgResetTemplate_statsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372"
+	.string	""
+	.string	""
+	.string	"statsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\001"
+	.string	""
+	.string	"statsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\001"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\001"
+	.string	""
+	.string	"getTotalTravelDistance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\001"
+	.string	""
+	.string	"writeEEPROM"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a11d11f593c50964,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15034 @@
+	.file	"failsafe.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/io/beeper.h"
+	.file 8 "./src/main/fc/fc_core.h"
+	.file 9 "./src/main/drivers/adc.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/fc/rc_controls.h"
+	.file 12 "./src/main/fc/rc_modes.h"
+	.file 13 "./src/main/fc/runtime_config.h"
+	.file 14 "./src/main/fc/controlrate_profile.h"
+	.file 15 "./src/main/flight/failsafe.h"
+	.file 16 "./src/main/flight/pid.h"
+	.file 17 "./src/main/navigation/navigation.h"
+	.file 18 "./src/main/sensors/sensors.h"
+	.file 19 "./src/main/flight/failsafe.c"
+	.file 20 "./src/main/rx/rx.h"
+	.file 21 "./src/main/drivers/time.h"
+	.file 22 "./src/main/config/feature.h"
+	.file 23 "./src/main/flight/mixer.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	failsafe.c.09438b5d
+	.weak	failsafe.c.09438b5d
+failsafe.c.09438b5d:
+	.long	0x133b
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x25
+	.long	.LASF2049
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1596
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1597
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1598
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1599
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1600
+	.uleb128 0x5
+	.long	.LASF1601
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1602
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1603
+	.uleb128 0x5
+	.long	.LASF1604
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1605
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1606
+	.uleb128 0x27
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1607
+	.uleb128 0x5
+	.long	.LASF1608
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1609
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x5
+	.long	.LASF1610
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1611
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1612
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xab
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0xfd
+	.uleb128 0x3
+	.long	.LASF1613
+	.value	0xfff
+	.uleb128 0x3
+	.long	.LASF1614
+	.value	0xf000
+	.uleb128 0x3
+	.long	.LASF1615
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1617
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1618
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x109
+	.uleb128 0x28
+	.long	0x114
+	.uleb128 0x7
+	.long	0x8a
+	.byte	0
+	.uleb128 0x29
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x133
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0x8a
+	.uleb128 0x19
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x133
+	.byte	0
+	.uleb128 0xd
+	.long	0xfd
+	.uleb128 0xe
+	.long	.LASF1844
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x193
+	.uleb128 0xf
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1619
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1620
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x193
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1621
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x193
+	.byte	0x10
+	.uleb128 0xf
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x198
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1622
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x114
+	.byte	0x20
+	.byte	0
+	.uleb128 0xd
+	.long	0x9f
+	.uleb128 0xd
+	.long	0x193
+	.uleb128 0x5
+	.long	.LASF1623
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x138
+	.uleb128 0x10
+	.long	0x19d
+	.uleb128 0x5
+	.long	.LASF1624
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x6
+	.byte	0x1d
+	.long	0x1d8
+	.uleb128 0x1
+	.long	.LASF1625
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1626
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1627
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x27a
+	.uleb128 0x1
+	.long	.LASF1628
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1629
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1630
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1631
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1632
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1634
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1635
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1636
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1637
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1638
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1639
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1640
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1641
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1642
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1643
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1644
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1645
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1653
+	.byte	0x7
+	.byte	0x34
+	.byte	0x3
+	.long	0x1d8
+	.uleb128 0x1a
+	.long	.LASF1700
+	.long	0x30
+	.byte	0x8
+	.long	0x2cb
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1663
+	.byte	0x8
+	.byte	0x22
+	.byte	0x3
+	.long	0x286
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x9
+	.byte	0x16
+	.long	0x301
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1667
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1668
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xa
+	.byte	0x26
+	.long	0x3fc
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1670
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1671
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1677
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1678
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1679
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1680
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1681
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1682
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1683
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1684
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1685
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1686
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1687
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1688
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1689
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1690
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1691
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1692
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1693
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF1694
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF1695
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF1696
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF1697
+	.long	0x10000000
+	.uleb128 0x4
+	.long	.LASF1698
+	.long	0x20000000
+	.uleb128 0x4
+	.long	.LASF1699
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1701
+	.long	0x30
+	.byte	0xb
+	.long	0x46b
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x1
+	.uleb128 0x2a
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0xf
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x2b
+	.long	0x483
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1719
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x3
+	.long	0x46b
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xb
+	.byte	0x30
+	.long	0x4a7
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1722
+	.byte	0xb
+	.byte	0x33
+	.byte	0x3
+	.long	0x48f
+	.uleb128 0x11
+	.long	0x93
+	.long	0x4c3
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1791
+	.byte	0xb
+	.byte	0x51
+	.byte	0x10
+	.long	0x4b3
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xc
+	.byte	0x1c
+	.long	0x5dd
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1766
+	.byte	0xc
+	.byte	0x48
+	.byte	0x3
+	.long	0x4cf
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x15
+	.long	0x6b4
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1770
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1771
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1772
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1773
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1774
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1775
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1776
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1777
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1778
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1779
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1780
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1781
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1782
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1783
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1784
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1785
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1786
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF1787
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF1788
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF1789
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF1790
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1792
+	.byte	0xd
+	.byte	0x47
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x54
+	.long	0x72d
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1801
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1802
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1803
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1804
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1805
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1806
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1807
+	.value	0x4000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1808
+	.byte	0xd
+	.byte	0x64
+	.byte	0x3
+	.long	0x6c0
+	.uleb128 0x9
+	.long	.LASF1809
+	.byte	0xd
+	.byte	0x66
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xd
+	.byte	0x6c
+	.long	0x80a
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1818
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1819
+	.value	0x200
+	.uleb128 0x3
+	.long	.LASF1820
+	.value	0x400
+	.uleb128 0x3
+	.long	.LASF1821
+	.value	0x800
+	.uleb128 0x3
+	.long	.LASF1822
+	.value	0x1000
+	.uleb128 0x3
+	.long	.LASF1823
+	.value	0x2000
+	.uleb128 0x3
+	.long	.LASF1824
+	.value	0x4000
+	.uleb128 0x3
+	.long	.LASF1825
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1826
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1827
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1828
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1829
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1830
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1831
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1832
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1833
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1834
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1835
+	.byte	0xd
+	.byte	0x8c
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x13
+	.byte	0x8
+	.byte	0xe
+	.byte	0x2d
+	.byte	0x5
+	.long	0x861
+	.uleb128 0x2
+	.long	.LASF1836
+	.byte	0xe
+	.byte	0x2e
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0xe
+	.byte	0x2f
+	.byte	0x11
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1838
+	.byte	0xe
+	.byte	0x30
+	.byte	0x11
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1839
+	.byte	0xe
+	.byte	0x31
+	.byte	0x12
+	.long	0xab
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1840
+	.byte	0xe
+	.byte	0x32
+	.byte	0x12
+	.long	0xab
+	.byte	0x6
+	.byte	0
+	.uleb128 0x13
+	.byte	0x5
+	.byte	0xe
+	.byte	0x35
+	.byte	0x5
+	.long	0x892
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0xe
+	.byte	0x36
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1841
+	.byte	0xe
+	.byte	0x37
+	.byte	0x11
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0xe
+	.byte	0x38
+	.byte	0x11
+	.long	0x892
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.long	0x9f
+	.long	0x8a2
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.byte	0x5
+	.byte	0xe
+	.byte	0x3b
+	.byte	0x5
+	.long	0x8d3
+	.uleb128 0x2
+	.long	.LASF1837
+	.byte	0xe
+	.byte	0x3c
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1841
+	.byte	0xe
+	.byte	0x3d
+	.byte	0x11
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0xe
+	.byte	0x3e
+	.byte	0x11
+	.long	0x892
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.byte	0x1
+	.byte	0xe
+	.byte	0x41
+	.byte	0x5
+	.long	0x8ea
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0xe
+	.byte	0x42
+	.byte	0x11
+	.long	0x9f
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1845
+	.byte	0x14
+	.byte	0xe
+	.byte	0x2b
+	.long	0x92b
+	.uleb128 0x2
+	.long	.LASF1846
+	.byte	0xe
+	.byte	0x33
+	.byte	0x7
+	.long	0x816
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1847
+	.byte	0xe
+	.byte	0x39
+	.byte	0x7
+	.long	0x861
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1848
+	.byte	0xe
+	.byte	0x3f
+	.byte	0x7
+	.long	0x8a2
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1849
+	.byte	0xe
+	.byte	0x43
+	.byte	0x7
+	.long	0x8d3
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1850
+	.byte	0xe
+	.byte	0x45
+	.byte	0x3
+	.long	0x8ea
+	.uleb128 0x10
+	.long	0x92b
+	.uleb128 0x9
+	.long	.LASF1851
+	.byte	0xe
+	.byte	0x49
+	.byte	0x23
+	.long	0x948
+	.uleb128 0xd
+	.long	0x937
+	.uleb128 0xe
+	.long	.LASF1852
+	.byte	0x14
+	.byte	0xf
+	.byte	0x20
+	.long	0xa03
+	.uleb128 0x2
+	.long	.LASF1853
+	.byte	0xf
+	.byte	0x21
+	.byte	0xe
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1854
+	.byte	0xf
+	.byte	0x22
+	.byte	0xe
+	.long	0xab
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1855
+	.byte	0xf
+	.byte	0x23
+	.byte	0xd
+	.long	0x9f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1856
+	.byte	0xf
+	.byte	0x24
+	.byte	0xd
+	.long	0x9f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1857
+	.byte	0xf
+	.byte	0x25
+	.byte	0xd
+	.long	0x9f
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1858
+	.byte	0xf
+	.byte	0x26
+	.byte	0xd
+	.long	0x9f
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1859
+	.byte	0xf
+	.byte	0x28
+	.byte	0xd
+	.long	0x93
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0xf
+	.byte	0x29
+	.byte	0xd
+	.long	0x93
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0xf
+	.byte	0x2a
+	.byte	0xd
+	.long	0x93
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1862
+	.byte	0xf
+	.byte	0x2b
+	.byte	0xe
+	.long	0xab
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1863
+	.byte	0xf
+	.byte	0x2c
+	.byte	0xe
+	.long	0xab
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1864
+	.byte	0xf
+	.byte	0x2d
+	.byte	0xd
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1865
+	.byte	0xf
+	.byte	0x2e
+	.byte	0x9
+	.long	0xa03
+	.byte	0x13
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1866
+	.uleb128 0x10
+	.long	0xa03
+	.uleb128 0x5
+	.long	.LASF1867
+	.byte	0xf
+	.byte	0x2f
+	.byte	0x3
+	.long	0x94d
+	.uleb128 0x10
+	.long	0xa0f
+	.uleb128 0x9
+	.long	.LASF1868
+	.byte	0xf
+	.byte	0x31
+	.byte	0x19
+	.long	0xa0f
+	.uleb128 0x9
+	.long	.LASF1869
+	.byte	0xf
+	.byte	0x31
+	.byte	0x48
+	.long	0xa0f
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x33
+	.long	0xa74
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x7
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1878
+	.byte	0xf
+	.byte	0x70
+	.byte	0x3
+	.long	0xa38
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x72
+	.long	0xa98
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1881
+	.byte	0xf
+	.byte	0x75
+	.byte	0x3
+	.long	0xa80
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x77
+	.long	0xac8
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1886
+	.byte	0xf
+	.byte	0x7c
+	.byte	0x3
+	.long	0xaa4
+	.uleb128 0x6
+	.long	0x30
+	.byte	0xf
+	.byte	0x7e
+	.long	0xaf2
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1890
+	.byte	0xf
+	.byte	0x82
+	.byte	0x3
+	.long	0xad4
+	.uleb128 0xe
+	.long	.LASF1891
+	.byte	0x3c
+	.byte	0xf
+	.byte	0x84
+	.long	0xbe8
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0xf
+	.byte	0x85
+	.byte	0xd
+	.long	0x93
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0xf
+	.byte	0x86
+	.byte	0x9
+	.long	0xa03
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0xf
+	.byte	0x87
+	.byte	0x9
+	.long	0xa03
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1895
+	.byte	0xf
+	.byte	0x88
+	.byte	0x9
+	.long	0xa03
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0xf
+	.byte	0x89
+	.byte	0x9
+	.long	0xa03
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0xf
+	.byte	0x8a
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0xf
+	.byte	0x8b
+	.byte	0xe
+	.long	0x1ae
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0xf
+	.byte	0x8c
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0xf
+	.byte	0x8d
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0xf
+	.byte	0x8e
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0xf
+	.byte	0x8f
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0xf
+	.byte	0x90
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0xf
+	.byte	0x91
+	.byte	0xe
+	.long	0x1ae
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0xf
+	.byte	0x92
+	.byte	0x19
+	.long	0xac8
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0xf
+	.byte	0x93
+	.byte	0x15
+	.long	0xa74
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0xf
+	.byte	0x94
+	.byte	0x1b
+	.long	0xa98
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0xf
+	.byte	0x95
+	.byte	0xd
+	.long	0x4b3
+	.byte	0x34
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1909
+	.byte	0xf
+	.byte	0x96
+	.byte	0x3
+	.long	0xafe
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1910
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x10
+	.byte	0x39
+	.long	0xc4f
+	.uleb128 0x1
+	.long	.LASF1911
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1912
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1913
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1914
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1915
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0xb
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1923
+	.byte	0x4
+	.byte	0x10
+	.byte	0x51
+	.long	0xc89
+	.uleb128 0xf
+	.string	"P"
+	.byte	0x10
+	.byte	0x52
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0xf
+	.string	"I"
+	.byte	0x10
+	.byte	0x53
+	.byte	0xd
+	.long	0x9f
+	.byte	0x1
+	.uleb128 0xf
+	.string	"D"
+	.byte	0x10
+	.byte	0x54
+	.byte	0xd
+	.long	0x9f
+	.byte	0x2
+	.uleb128 0xf
+	.string	"FF"
+	.byte	0x10
+	.byte	0x55
+	.byte	0xd
+	.long	0x9f
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1924
+	.byte	0x10
+	.byte	0x56
+	.byte	0x3
+	.long	0xc4f
+	.uleb128 0xe
+	.long	.LASF1925
+	.byte	0x2c
+	.byte	0x10
+	.byte	0x58
+	.long	0xcaf
+	.uleb128 0xf
+	.string	"pid"
+	.byte	0x10
+	.byte	0x59
+	.byte	0xc
+	.long	0xcaf
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	0xc89
+	.long	0xcbf
+	.uleb128 0x12
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1926
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x3
+	.long	0xc95
+	.uleb128 0xe
+	.long	.LASF1927
+	.byte	0xac
+	.byte	0x10
+	.byte	0x67
+	.long	0xe78
+	.uleb128 0x2
+	.long	.LASF1928
+	.byte	0x10
+	.byte	0x68
+	.byte	0xd
+	.long	0x9f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1929
+	.byte	0x10
+	.byte	0x69
+	.byte	0xf
+	.long	0xcbf
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1930
+	.byte	0x10
+	.byte	0x6a
+	.byte	0xf
+	.long	0xcbf
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF1931
+	.byte	0x10
+	.byte	0x6c
+	.byte	0xd
+	.long	0x9f
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF1932
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xe
+	.long	0xab
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1933
+	.byte	0x10
+	.byte	0x6f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1934
+	.byte	0x10
+	.byte	0x70
+	.byte	0xe
+	.long	0xab
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1935
+	.byte	0x10
+	.byte	0x72
+	.byte	0xd
+	.long	0x9f
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1936
+	.byte	0x10
+	.byte	0x74
+	.byte	0xd
+	.long	0x9f
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF1937
+	.byte	0x10
+	.byte	0x76
+	.byte	0xd
+	.long	0x9f
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF1938
+	.byte	0x10
+	.byte	0x78
+	.byte	0xe
+	.long	0xb7
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1939
+	.byte	0x10
+	.byte	0x79
+	.byte	0xe
+	.long	0xb7
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1940
+	.byte	0x10
+	.byte	0x7b
+	.byte	0xd
+	.long	0xe78
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1941
+	.byte	0x10
+	.byte	0x7d
+	.byte	0xe
+	.long	0xab
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1942
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xe
+	.long	0xab
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF1943
+	.byte	0x10
+	.byte	0x81
+	.byte	0xe
+	.long	0xab
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF1944
+	.byte	0x10
+	.byte	0x82
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1945
+	.byte	0x10
+	.byte	0x83
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF1946
+	.byte	0x10
+	.byte	0x84
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1947
+	.byte	0x10
+	.byte	0x86
+	.byte	0xd
+	.long	0x9f
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF1948
+	.byte	0x10
+	.byte	0x87
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1949
+	.byte	0x10
+	.byte	0x89
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF1950
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF1951
+	.byte	0x10
+	.byte	0x8b
+	.byte	0xd
+	.long	0x9f
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF1952
+	.byte	0x10
+	.byte	0x8d
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF1953
+	.byte	0x10
+	.byte	0x8e
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF1954
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xd
+	.long	0x9f
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF1955
+	.byte	0x10
+	.byte	0x90
+	.byte	0xb
+	.long	0xbf4
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF1956
+	.byte	0x10
+	.byte	0x91
+	.byte	0xb
+	.long	0xbf4
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF1957
+	.byte	0x10
+	.byte	0x92
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF1958
+	.byte	0x10
+	.byte	0x94
+	.byte	0xe
+	.long	0xab
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF1959
+	.byte	0x10
+	.byte	0x95
+	.byte	0xd
+	.long	0x9f
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x11
+	.long	0x93
+	.long	0xe88
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1960
+	.byte	0x10
+	.byte	0x96
+	.byte	0x3
+	.long	0xccb
+	.uleb128 0x10
+	.long	0xe88
+	.uleb128 0x9
+	.long	.LASF1961
+	.byte	0x10
+	.byte	0xa0
+	.byte	0x16
+	.long	0xea5
+	.uleb128 0xd
+	.long	0xe88
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1962
+	.uleb128 0x9
+	.long	.LASF1963
+	.byte	0x11
+	.byte	0x23
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x14
+	.long	0xef9
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x7
+	.byte	0
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x12
+	.byte	0x30
+	.long	0xf43
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1980
+	.value	0x100
+	.uleb128 0x3
+	.long	.LASF1981
+	.value	0x200
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1992
+	.byte	0x41
+	.byte	0x18
+	.long	0xbe8
+	.uleb128 0x9
+	.long	.LASF1982
+	.byte	0x13
+	.byte	0x43
+	.byte	0x1f
+	.long	0xa1b
+	.uleb128 0x1c
+	.long	0xa20
+	.byte	0x43
+	.byte	0x50
+	.uleb128 0x1c
+	.long	0xa2c
+	.byte	0x43
+	.byte	0x78
+	.uleb128 0x9
+	.long	.LASF1983
+	.byte	0x13
+	.byte	0x43
+	.byte	0xa7
+	.long	0x1a9
+	.uleb128 0x2b
+	.long	0xf68
+	.byte	0xd3
+	.uleb128 0x2c
+	.long	0xf4e
+	.byte	0x45
+	.byte	0x18
+	.uleb128 0x6
+	.long	0x30
+	.byte	0x13
+	.byte	0x55
+	.long	0xf9f
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1987
+	.byte	0x13
+	.byte	0x59
+	.byte	0x3
+	.long	0xf81
+	.uleb128 0x13
+	.byte	0x14
+	.byte	0x13
+	.byte	0x5b
+	.byte	0x9
+	.long	0xfdc
+	.uleb128 0x2
+	.long	.LASF1988
+	.byte	0x13
+	.byte	0x5c
+	.byte	0x20
+	.long	0xa03
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0x13
+	.byte	0x5d
+	.byte	0x20
+	.long	0xa03
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1990
+	.byte	0x13
+	.byte	0x5e
+	.byte	0x1f
+	.long	0xfdc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x11
+	.long	0xf9f
+	.long	0xfec
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1991
+	.byte	0x13
+	.byte	0x5f
+	.byte	0x3
+	.long	0xfab
+	.uleb128 0x10
+	.long	0xfec
+	.uleb128 0x11
+	.long	0xff8
+	.long	0x100d
+	.uleb128 0x12
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x10
+	.long	0xffd
+	.uleb128 0x1b
+	.long	.LASF1993
+	.byte	0x61
+	.byte	0x27
+	.long	0x100d
+	.uleb128 0xb
+	.long	.LASF1994
+	.byte	0xd
+	.byte	0xa3
+	.byte	0x5
+	.long	0xa03
+	.long	0x1033
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1995
+	.byte	0x14
+	.byte	0xd2
+	.byte	0x9
+	.long	0x93
+	.long	0x1049
+	.uleb128 0x7
+	.long	0x30
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1996
+	.byte	0x7
+	.byte	0x36
+	.long	0x105a
+	.uleb128 0x7
+	.long	0x27a
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1997
+	.byte	0x8
+	.byte	0x27
+	.long	0x106b
+	.uleb128 0x7
+	.long	0x2cb
+	.byte	0
+	.uleb128 0x2d
+	.long	.LASF2004
+	.byte	0x11
+	.value	0x1e4
+	.byte	0xc
+	.long	0xaf2
+	.uleb128 0x1e
+	.long	.LASF1998
+	.value	0x1e3
+	.uleb128 0x1e
+	.long	.LASF1999
+	.value	0x1e2
+	.uleb128 0xb
+	.long	.LASF2000
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xa
+	.long	0xb7
+	.long	0x109c
+	.uleb128 0x7
+	.long	0x72d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2001
+	.byte	0xd
+	.byte	0xa0
+	.byte	0xa
+	.long	0xb7
+	.long	0x10b2
+	.uleb128 0x7
+	.long	0x72d
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2002
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x12
+	.long	0x483
+	.long	0x10c8
+	.uleb128 0x7
+	.long	0x4a7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2003
+	.byte	0xc
+	.byte	0x77
+	.byte	0x5
+	.long	0xa03
+	.long	0x10de
+	.uleb128 0x7
+	.long	0x5dd
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2005
+	.byte	0x15
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1ae
+	.uleb128 0xb
+	.long	.LASF2006
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x5
+	.long	0xa03
+	.long	0x1100
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2007
+	.byte	0x10
+	.byte	0xb6
+	.byte	0x7
+	.long	0xbf4
+	.long	0x111b
+	.uleb128 0x7
+	.long	0xbf4
+	.uleb128 0x7
+	.long	0x9f
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2008
+	.byte	0x10
+	.byte	0xb7
+	.byte	0x9
+	.long	0x93
+	.long	0x1136
+	.uleb128 0x7
+	.long	0xbf4
+	.uleb128 0x7
+	.long	0x93
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2009
+	.byte	0x17
+	.byte	0x73
+	.byte	0x5
+	.long	0x70
+	.uleb128 0x20
+	.long	.LASF2026
+	.value	0x177
+	.long	0x1198
+	.uleb128 0xa
+	.long	.LASF2010
+	.value	0x17d
+	.byte	0xf
+	.long	0xa0a
+	.uleb128 0xa
+	.long	.LASF2011
+	.value	0x17e
+	.byte	0xf
+	.long	0xa0a
+	.uleb128 0xa
+	.long	.LASF2012
+	.value	0x17f
+	.byte	0xf
+	.long	0xa0a
+	.uleb128 0xa
+	.long	.LASF2013
+	.value	0x180
+	.byte	0x12
+	.long	0x27a
+	.uleb128 0xa
+	.long	.LASF2014
+	.value	0x187
+	.byte	0x9
+	.long	0xa03
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF2015
+	.value	0x1e2
+	.byte	0x19
+	.long	0xa03
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2034
+	.byte	0x13
+	.value	0x164
+	.byte	0x1c
+	.long	0xac8
+	.uleb128 0x2f
+	.long	.LASF2050
+	.byte	0x13
+	.value	0x154
+	.byte	0xc
+	.long	0xa03
+	.long	0x11f7
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF2016
+	.value	0x157
+	.byte	0x12
+	.long	0xb7
+	.uleb128 0x16
+	.long	0x11d5
+	.uleb128 0xa
+	.long	.LASF2017
+	.value	0x159
+	.byte	0x6f
+	.long	0x70
+	.byte	0
+	.uleb128 0x16
+	.long	0x11e7
+	.uleb128 0xa
+	.long	.LASF2018
+	.value	0x15a
+	.byte	0x70
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xa
+	.long	.LASF2019
+	.value	0x15b
+	.byte	0x6e
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2020
+	.value	0x14c
+	.uleb128 0x15
+	.long	.LASF2021
+	.value	0x144
+	.uleb128 0x15
+	.long	.LASF2022
+	.value	0x13d
+	.uleb128 0x21
+	.long	.LASF2023
+	.value	0x138
+	.long	0xa03
+	.uleb128 0x15
+	.long	.LASF2024
+	.value	0x133
+	.uleb128 0x21
+	.long	.LASF2025
+	.value	0x12e
+	.long	0xa03
+	.uleb128 0x20
+	.long	.LASF2027
+	.value	0x101
+	.long	0x125f
+	.uleb128 0xa
+	.long	.LASF2028
+	.value	0x104
+	.byte	0xd
+	.long	0x4b3
+	.uleb128 0x16
+	.long	0x1250
+	.uleb128 0x22
+	.string	"i"
+	.value	0x10c
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x22
+	.string	"idx"
+	.value	0x113
+	.byte	0xe
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2029
+	.byte	0x13
+	.byte	0xf8
+	.byte	0x6
+	.long	0x127a
+	.uleb128 0x14
+	.uleb128 0x31
+	.string	"idx"
+	.byte	0x13
+	.byte	0xfb
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2030
+	.byte	0xed
+	.long	0x1290
+	.uleb128 0x24
+	.long	.LASF2032
+	.byte	0xed
+	.byte	0x2e
+	.long	0xa74
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2031
+	.byte	0xe8
+	.long	0x12a6
+	.uleb128 0x24
+	.long	.LASF2033
+	.byte	0xe8
+	.byte	0x3c
+	.long	0xac8
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2035
+	.byte	0x13
+	.byte	0xe3
+	.byte	0xc
+	.long	0xa03
+	.uleb128 0x18
+	.long	.LASF2036
+	.byte	0xde
+	.uleb128 0xc
+	.long	.LASF2037
+	.byte	0xd7
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2038
+	.byte	0xd0
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2039
+	.byte	0xcb
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2040
+	.byte	0xc6
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2041
+	.byte	0xc1
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2042
+	.byte	0xbc
+	.byte	0x11
+	.long	0xa74
+	.uleb128 0xc
+	.long	.LASF2043
+	.byte	0xb5
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0xc
+	.long	.LASF2044
+	.byte	0xae
+	.byte	0x5
+	.long	0xa03
+	.uleb128 0x18
+	.long	.LASF2045
+	.byte	0xa6
+	.uleb128 0x18
+	.long	.LASF2046
+	.byte	0x92
+	.uleb128 0x17
+	.long	.LASF2047
+	.byte	0x10
+	.byte	0xa0
+	.byte	0x53
+	.long	0x1328
+	.uleb128 0xd
+	.long	0xe94
+	.uleb128 0x17
+	.long	.LASF2048
+	.byte	0xf
+	.byte	0x31
+	.byte	0x83
+	.long	0x1339
+	.uleb128 0xd
+	.long	0xa1b
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 24
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 19
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 24 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 26 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.file 27 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1c
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 29 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 30 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x23
+	.file 36 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 40 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.file 41 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 42 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2a
+	.file 43 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 44 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 46 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 47 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2f
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x4
+	.file 48 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.file 49 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1038
+	.byte	0x4
+	.file 50 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1039
+	.byte	0x4
+	.file 51 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1043
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xc
+	.file 52 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x11
+	.file 53 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x4
+	.file 54 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 55 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.file 56 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x39
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1432
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1459
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF925
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1042
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1047
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1057
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1084
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1116
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1152
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1431
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1478
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1478
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1488
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1491
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1482
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1500
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1501
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1502
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1503
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1510
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1511
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1512
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1513
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1514
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1515
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1560
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1563
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1591
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1595
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x13
+	.long	.LASF1
+	.long	.LASF2051
+	.long	.LASF2052
+	.long	.LASF2053
+	.long	.LASF2054
+	.long	.LASF2055
+	.long	.LASF2056
+	.long	.LASF2057
+	.long	.LASF2058
+	.long	.LASF2059
+	.long	.LASF2060
+	.long	.LASF2061
+	.long	.LASF2062
+	.long	.LASF2063
+	.long	.LASF2064
+	.long	.LASF2065
+	.long	.LASF2066
+	.long	.LASF2067
+	.long	.LASF2068
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x43
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2069
+	.byte	0xe
+	.long	.LASF2070
+	.byte	0xe
+	.long	.LASF2071
+	.byte	0xe
+	.long	.LASF2072
+	.byte	0x3
+	.long	.LASF2073
+	.byte	0x2
+	.long	.LASF2074
+	.byte	0x2
+	.long	.LASF2075
+	.byte	0x7
+	.long	.LASF2076
+	.byte	0x5
+	.long	.LASF2077
+	.byte	0x4
+	.long	.LASF2078
+	.byte	0x5
+	.long	.LASF2079
+	.byte	0x5
+	.long	.LASF2080
+	.byte	0x5
+	.long	.LASF2081
+	.byte	0x5
+	.long	.LASF2082
+	.byte	0x5
+	.long	.LASF2083
+	.byte	0x6
+	.long	.LASF2084
+	.byte	0x6
+	.long	.LASF2085
+	.byte	0x8
+	.long	.LASF2086
+	.byte	0xa
+	.long	.LASF2087
+	.byte	0x6
+	.long	.LASF2088
+	.byte	0x9
+	.long	.LASF2073
+	.byte	0x4
+	.long	.LASF2089
+	.byte	0x3
+	.long	.LASF2090
+	.byte	0x6
+	.long	.LASF2091
+	.byte	0x11
+	.long	.LASF2092
+	.byte	0x12
+	.long	.LASF2093
+	.byte	0x12
+	.long	.LASF2093
+	.byte	0x11
+	.long	.LASF2094
+	.byte	0xe
+	.long	.LASF2095
+	.byte	0x11
+	.long	.LASF2096
+	.byte	0x11
+	.long	.LASF2097
+	.byte	0xe
+	.long	.LASF2098
+	.byte	0xe
+	.long	.LASF2099
+	.byte	0x10
+	.long	.LASF2100
+	.byte	0xe
+	.long	.LASF2101
+	.byte	0xf
+	.long	.LASF2102
+	.byte	0xf
+	.long	.LASF2103
+	.byte	0xe
+	.long	.LASF2104
+	.byte	0xe
+	.long	.LASF2105
+	.byte	0xe
+	.long	.LASF2106
+	.byte	0xd
+	.long	.LASF2107
+	.byte	0xc
+	.long	.LASF2108
+	.byte	0xb
+	.long	.LASF2109
+	.byte	0x12
+	.long	.LASF2110
+	.byte	0xc
+	.long	.LASF2111
+	.byte	0xc
+	.long	.LASF2112
+	.byte	0x1
+	.long	.LASF2113
+	.byte	0x1
+	.long	.LASF2114
+	.byte	0x3
+	.long	.LASF2115
+	.byte	0x4
+	.long	.LASF2116
+	.byte	0x4
+	.long	.LASF2117
+	.byte	0x5
+	.long	.LASF2118
+	.byte	0x2
+	.long	.LASF2119
+	.byte	0x2
+	.long	.LASF2120
+	.byte	0x2
+	.long	.LASF2121
+	.byte	0x2
+	.long	.LASF2122
+	.byte	0x11
+	.long	.LASF2123
+	.byte	0xe
+	.long	.LASF2124
+	.byte	0xe
+	.long	.LASF2125
+	.byte	0xe
+	.long	.LASF2126
+	.byte	0xe
+	.long	.LASF2127
+	.byte	0xe
+	.long	.LASF2128
+	.byte	0xe
+	.long	.LASF2129
+	.byte	0xe
+	.long	.LASF2130
+	.byte	0xe
+	.long	.LASF2131
+	.byte	0xe
+	.long	.LASF2132
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1303:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1186:
+	.string	"__DECL_SIMD_logf "
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1391:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1419:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1197:
+	.string	"__DECL_SIMD_expl "
+.LASF852:
+	.string	"USE_BARO "
+.LASF1920:
+	.string	"PID_VEL_Z"
+.LASF1570:
+	.string	"MIDRC_MIN 1200"
+.LASF1704:
+	.string	"THROTTLE"
+.LASF1858:
+	.string	"failsafe_procedure"
+.LASF1043:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF2043:
+	.string	"failsafeMayRequireNavigationMode"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF1690:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1119:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1317:
+	.string	"__DECL_SIMD_atan2l "
+.LASF859:
+	.string	"USE_UART7 "
+.LASF1159:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1721:
+	.string	"THROTTLE_STATUS_TYPE_COMMAND"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1073:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF1733:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1991:
+	.string	"failsafeProcedureLogic_t"
+.LASF1664:
+	.string	"ADC_BATTERY"
+.LASF1041:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1092:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1524:
+	.string	"FP_NORMAL 4"
+.LASF1359:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF986:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1011:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF929:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1299:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1415:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1400:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1752:
+	.string	"BOXCAMERA1"
+.LASF1815:
+	.string	"ANTI_WINDUP"
+.LASF1601:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1745:
+	.string	"BOXGCSNAV"
+.LASF1118:
+	.string	"FAST_MATH "
+.LASF1773:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1866:
+	.string	"_Bool"
+.LASF1321:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1154:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF1471:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1464:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1363:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1205:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1879:
+	.string	"FAILSAFE_RXLINK_DOWN"
+.LASF1291:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1343:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF946:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1036:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1919:
+	.string	"PID_HEADING"
+.LASF1910:
+	.string	"float"
+.LASF1969:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF1643:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1853:
+	.string	"failsafe_throttle"
+.LASF1884:
+	.string	"FAILSAFE_PROCEDURE_RTH"
+.LASF1638:
+	.string	"BEEPER_GPS_STATUS"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1579:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1260:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1448:
+	.string	"__f32x(x) x ##f32x"
+.LASF951:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1760:
+	.string	"BOXUSER1"
+.LASF1761:
+	.string	"BOXUSER2"
+.LASF1769:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1200:
+	.string	"__DECL_SIMD_expf64 "
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF1899:
+	.string	"validRxDataReceivedAt"
+.LASF1132:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1116:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1337:
+	.string	"__DECL_SIMD_log2l "
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF1968:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1171:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF759:
+	.string	"USE_CMS "
+.LASF1051:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1856:
+	.string	"failsafe_recovery_delay"
+.LASF1297:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1220:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1528:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF969:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2050:
+	.string	"failsafeCheckStickMotion"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1811:
+	.string	"GPS_FIX"
+.LASF1048:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1889:
+	.string	"RTH_HAS_LANDED"
+.LASF1679:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1529:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1610:
+	.string	"uint16_t"
+.LASF1873:
+	.string	"FAILSAFE_RETURN_TO_HOME"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1532:
+	.string	"MATH_ERREXCEPT 2"
+.LASF373:
+	.string	"linux 1"
+.LASF1128:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF984:
+	.string	"PG_RX_CONFIG 24"
+.LASF956:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1788:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF941:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1527:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF2037:
+	.string	"failsafeRequiresMotorStop"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1861:
+	.string	"failsafe_fw_yaw_rate"
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1574:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1167:
+	.string	"__DECL_SIMD_sinl "
+.LASF1025:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1169:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1111:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1267:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1545:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1101:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1840:
+	.string	"fixedWingTauMs"
+.LASF1406:
+	.string	"__DECL_SIMD_erfcf "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1567:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1812:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1642:
+	.string	"BEEPER_READY_BEEP"
+.LASF1188:
+	.string	"__DECL_SIMD_logf16 "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1426:
+	.string	"__HAVE_FLOAT128 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF2032:
+	.string	"newPhase"
+.LASF1438:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1449:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1109:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1913:
+	.string	"PID_YAW"
+.LASF2020:
+	.string	"failsafeOnValidDataFailed"
+.LASF1757:
+	.string	"BOXOSDALT3"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1187:
+	.string	"__DECL_SIMD_logl "
+.LASF1908:
+	.string	"lastGoodRcCommand"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1722:
+	.string	"throttleStatusType_e"
+.LASF2046:
+	.string	"failsafeReset"
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1424:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1770:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1917:
+	.string	"PID_SURFACE"
+.LASF1658:
+	.string	"DISARM_SWITCH"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF927:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF974:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1479:
+	.string	"_Mdouble_"
+.LASF1818:
+	.string	"COMPASS_CALIBRATED"
+.LASF1427:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1829:
+	.string	"ROVER"
+.LASF1566:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1379:
+	.string	"__DECL_SIMD_erff32 "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1046:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1985:
+	.string	"FAILSAFE_CHANNEL_NEUTRAL"
+.LASF1039:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1862:
+	.string	"failsafe_stick_motion_threshold"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1062:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1938:
+	.string	"axisAccelerationLimitYaw"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF981:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1322:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1261:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1380:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1689:
+	.string	"FEATURE_UNUSED_10"
+.LASF1696:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1293:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1585:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1827:
+	.string	"AIRPLANE"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF993:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1898:
+	.string	"rxDataRecoveryPeriod"
+.LASF1480:
+	.string	"__MATH_PRECNAME"
+.LASF1330:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1510:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF1615:
+	.string	"PGR_SIZE_MASK"
+.LASF1804:
+	.string	"NAV_WP_MODE"
+.LASF1931:
+	.string	"dterm_lpf_type"
+.LASF1512:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1262:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF1483:
+	.string	"_Mdouble_ float"
+.LASF1075:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1962:
+	.string	"double"
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1467:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF1473:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1146:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1367:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1516:
+	.string	"__MATHCALL_NARROW"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1223:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1992:
+	.string	"failsafeState"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1153:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1009:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1944:
+	.string	"fixedWingReferenceAirspeed"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1501:
+	.string	"__MATHDECL_1"
+.LASF1652:
+	.string	"BEEPER_PREFERENCE"
+.LASF1086:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1586:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF1453:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF396:
+	.string	"false 0"
+.LASF1376:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1846:
+	.string	"throttle"
+.LASF943:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1437:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1134:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1725:
+	.string	"BOXHORIZON"
+.LASF1319:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1793:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF945:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1941:
+	.string	"pidSumLimit"
+.LASF1289:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1061:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1255:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1786:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1273:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF1932:
+	.string	"dterm_lpf_hz"
+.LASF1857:
+	.string	"failsafe_off_delay"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF1475:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1974:
+	.string	"SENSOR_BARO"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1429:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1560:
+	.string	"HDOP_SCALE (100)"
+.LASF963:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1525:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1688:
+	.string	"FEATURE_BLACKBOX"
+.LASF932:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1670:
+	.string	"FEATURE_VBAT"
+.LASF1771:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF1432:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1535:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1143:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF954:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1312:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1996:
+	.string	"beeper"
+.LASF1808:
+	.string	"flightModeFlags_e"
+.LASF1280:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF2030:
+	.string	"failsafeActivate"
+.LASF1644:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1936:
+	.string	"heading_hold_rate_limit"
+.LASF1042:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1064:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1963:
+	.string	"GPS_distanceToHome"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1020:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1214:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1838:
+	.string	"dynPID"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1982:
+	.string	"pgResetTemplate_failsafeConfig"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1147:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1587:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1580:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1897:
+	.string	"rxDataFailurePeriod"
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF935:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1564:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1602:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1103:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1604:
+	.string	"__uint16_t"
+.LASF1452:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1281:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF358:
+	.string	"__k8 1"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1736:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF1890:
+	.string	"rthState_e"
+.LASF1326:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1251:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1423:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1114:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1228:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF2036:
+	.string	"failsafeStartMonitoring"
+.LASF2045:
+	.string	"failsafeInit"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF821:
+	.string	"__size_t "
+.LASF1656:
+	.string	"DISARM_STICKS"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1139:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1691:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1282:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1378:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1390:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1717:
+	.string	"THROTTLE_LOW"
+.LASF1022:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1211:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1252:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF921:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1965:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1979:
+	.string	"SENSOR_GPS"
+.LASF964:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1269:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF1641:
+	.string	"BEEPER_ACTION_FAIL"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1836:
+	.string	"rcMid8"
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1506:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1514:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1904:
+	.string	"receivingRxDataPeriodPreset"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1277:
+	.string	"__DECL_SIMD_coshl "
+.LASF1794:
+	.string	"HORIZON_MODE"
+.LASF1596:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1110:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF1181:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1673:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF2022:
+	.string	"failsafeOnRxResume"
+.LASF1458:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1031:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1037:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF933:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1888:
+	.string	"RTH_IN_PROGRESS"
+.LASF1131:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF1841:
+	.string	"rcYawExpo8"
+.LASF713:
+	.string	"USE_NAV "
+.LASF1247:
+	.string	"__DECL_SIMD_hypotl "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1115:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF978:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF908:
+	.string	"NOINLINE "
+.LASF2024:
+	.string	"failsafeOnRxSuspend"
+.LASF1649:
+	.string	"BEEPER_CAM_CONNECTION_OPEN"
+.LASF1951:
+	.string	"iterm_relax"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF973:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1723:
+	.string	"BOXARM"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1843:
+	.string	"fpvCamAngleDegrees"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1481:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1802:
+	.string	"FAILSAFE_MODE"
+.LASF1503:
+	.string	"__MATHDECL"
+.LASF2001:
+	.string	"enableFlightMode"
+.LASF1759:
+	.string	"BOXBRAKING"
+.LASF1377:
+	.string	"__DECL_SIMD_erfl "
+.LASF1561:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1355:
+	.string	"__DECL_SIMD_atanh "
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1997:
+	.string	"disarm"
+.LASF1238:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF1844:
+	.string	"pgRegistry_s"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1903:
+	.string	"receivingRxDataPeriod"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1772:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1675:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF916:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1542:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF1970:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1013:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1334:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1259:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF965:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1734:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1617:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF711:
+	.string	"USE_GPS "
+.LASF1005:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF953:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1705:
+	.string	"AUX1"
+.LASF1706:
+	.string	"AUX2"
+.LASF1707:
+	.string	"AUX3"
+.LASF1708:
+	.string	"AUX4"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1710:
+	.string	"AUX6"
+.LASF1677:
+	.string	"FEATURE_UNUSED_3"
+.LASF1678:
+	.string	"FEATURE_UNUSED_4"
+.LASF1682:
+	.string	"FEATURE_UNUSED_5"
+.LASF1683:
+	.string	"FEATURE_UNUSED_6"
+.LASF1687:
+	.string	"FEATURE_UNUSED_7"
+.LASF1694:
+	.string	"FEATURE_UNUSED_8"
+.LASF1695:
+	.string	"FEATURE_UNUSED_9"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1487:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2007:
+	.string	"pidRateToRcCommand"
+.LASF1639:
+	.string	"BEEPER_RX_SET"
+.LASF1776:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1004:
+	.string	"PG_INAV_START 1000"
+.LASF1702:
+	.string	"ROLL"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1635:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF967:
+	.string	"PG_CF_START 1"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2021:
+	.string	"failsafeOnValidDataReceived"
+.LASF1582:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1250:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1285:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1822:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1357:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1374:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1577:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1983:
+	.string	"failsafeConfig_Registry"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1177:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1408:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1254:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1497:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1401:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1613:
+	.string	"PGR_PGN_MASK"
+.LASF1148:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1474:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1477:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1461:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1304:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1122:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1650:
+	.string	"BEEPER_CAM_CONNECTION_CLOSE"
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1948:
+	.string	"navVelXyDTermLpfHz"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF992:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1164:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1327:
+	.string	"__DECL_SIMD_log10l "
+.LASF1120:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1065:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1731:
+	.string	"BOXNAVRTH"
+.LASF1881:
+	.string	"failsafeRxLinkState_e"
+.LASF1204:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1783:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+.LASF1138:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1864:
+	.string	"failsafe_min_distance_procedure"
+.LASF1350:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1440:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1155:
+	.string	"__DECL_SIMD_cos "
+.LASF1624:
+	.string	"timeMs_t"
+.LASF1531:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1825:
+	.string	"AIRMODE_ACTIVE"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1314:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1469:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF925:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1333:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1236:
+	.string	"__DECL_SIMD_asinf "
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF1619:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1966:
+	.string	"SENSOR_INDEX_BARO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1274:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1199:
+	.string	"__DECL_SIMD_expf32 "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1653:
+	.string	"beeperMode_e"
+.LASF1507:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1860:
+	.string	"failsafe_fw_pitch_angle"
+.LASF1491:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1012:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1074:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF1203:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1360:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1156:
+	.string	"__DECL_SIMD_cosf "
+.LASF1576:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1764:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1300:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1686:
+	.string	"FEATURE_DASHBOARD"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1544:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1758:
+	.string	"BOXNAVCRUISE"
+.LASF1541:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1575:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1618:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1953:
+	.string	"dBoostMaxAtAlleceleration"
+.LASF1609:
+	.string	"uint8_t"
+.LASF1466:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF1108:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1492:
+	.string	"_Mdouble_ _Float64"
+.LASF1126:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1946:
+	.string	"fixedWingItermLimitOnStickPosition"
+.LASF1233:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1782:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1058:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1967:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2040:
+	.string	"failsafeIsActive"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF998:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1709:
+	.string	"AUX5"
+.LASF1470:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1112:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1413:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1375:
+	.string	"__DECL_SIMD_erf "
+.LASF1703:
+	.string	"PITCH"
+.LASF1732:
+	.string	"BOXNAVPOSHOLD"
+.LASF885:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1912:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1739:
+	.string	"BOXTELEMETRY"
+.LASF1720:
+	.string	"THROTTLE_STATUS_TYPE_RC"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1660:
+	.string	"DISARM_FAILSAFE"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1222:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1766:
+	.string	"boxId_e"
+.LASF376:
+	.string	"unix 1"
+.LASF1521:
+	.string	"FP_INFINITE 1"
+.LASF1511:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1275:
+	.string	"__DECL_SIMD_cosh "
+.LASF1513:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1165:
+	.string	"__DECL_SIMD_sin "
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF1957:
+	.string	"antigravityCutoff"
+.LASF1976:
+	.string	"SENSOR_RANGEFINDER"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF1178:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1431:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF886:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2044:
+	.string	"failsafeBypassNavigation"
+.LASF822:
+	.string	"__need_size_t"
+.LASF936:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1820:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1208:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1626:
+	.string	"FD_PITCH"
+.LASF1239:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1906:
+	.string	"phase"
+.LASF1456:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF915:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1482:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1495:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1553:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF1870:
+	.string	"FAILSAFE_IDLE"
+.LASF1362:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1591:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1161:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1795:
+	.string	"HEADING_MODE"
+.LASF1258:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1459:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1442:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1402:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF979:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1193:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1977:
+	.string	"SENSOR_PITOT"
+.LASF1484:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1113:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF950:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF940:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1478:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1749:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1311:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1921:
+	.string	"PID_POS_HEADING"
+.LASF1135:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF2042:
+	.string	"failsafePhase"
+.LASF2025:
+	.string	"failsafeIsReceivingRxData"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1814:
+	.string	"FIXED_WING_LEGACY"
+.LASF1191:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1595:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1010:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1399:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1352:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1882:
+	.string	"FAILSAFE_PROCEDURE_AUTO_LANDING"
+.LASF1918:
+	.string	"PID_LEVEL"
+.LASF2048:
+	.string	"failsafeConfig"
+.LASF1578:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF1049:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1290:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1348:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1522:
+	.string	"FP_ZERO 2"
+.LASF1195:
+	.string	"__DECL_SIMD_exp "
+.LASF2049:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1928:
+	.string	"pidControllerType"
+.LASF1023:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1368:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1486:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1027:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1230:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1409:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1145:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1091:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1320:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1237:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1568:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1416:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1056:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1973:
+	.string	"SENSOR_ACC"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1087:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1309:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1807:
+	.string	"TURN_ASSISTANT"
+.LASF1620:
+	.string	"address"
+.LASF1151:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1493:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1213:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1137:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1315:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1157:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1947:
+	.string	"loiter_direction"
+.LASF1727:
+	.string	"BOXHEADINGHOLD"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1798:
+	.string	"NAV_POSHOLD_MODE"
+.LASF949:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF2011:
+	.string	"armed"
+.LASF841:
+	.string	"NULL"
+.LASF1078:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1034:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1810:
+	.string	"GPS_FIX_HOME"
+.LASF1750:
+	.string	"BOXAUTOTRIM"
+.LASF2027:
+	.string	"failsafeApplyControlInput"
+.LASF1655:
+	.string	"DISARM_TIMEOUT"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1190:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1588:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF938:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1905:
+	.string	"activeProcedure"
+.LASF466:
+	.string	"__PMT"
+.LASF1353:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1900:
+	.string	"validRxDataFailedAt"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1235:
+	.string	"__DECL_SIMD_asin "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1927:
+	.string	"pidProfile_s"
+.LASF1960:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1019:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1654:
+	.string	"DISARM_NONE"
+.LASF2002:
+	.string	"calculateThrottleStatus"
+.LASF1537:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1865:
+	.string	"failsafe_mission"
+.LASF1336:
+	.string	"__DECL_SIMD_log2f "
+.LASF1767:
+	.string	"ARMED"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1817:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1792:
+	.string	"armingFlags"
+.LASF1498:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1385:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1068:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2031:
+	.string	"failsafeSetActiveProcedure"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1616:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1523:
+	.string	"FP_SUBNORMAL 3"
+.LASF1774:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1428:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1361:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1748:
+	.string	"BOXFLAPERON"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF1040:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1777:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF2010:
+	.string	"receivingRxDataAndNotFailsafeMode"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1852:
+	.string	"failsafeConfig_s"
+.LASF1867:
+	.string	"failsafeConfig_t"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2008:
+	.string	"pidAngleToRcCommand"
+.LASF1859:
+	.string	"failsafe_fw_roll_angle"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF919:
+	.string	"UNIT_TESTED "
+.LASF2006:
+	.string	"feature"
+.LASF972:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1069:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1989:
+	.string	"forceAngleMode"
+.LASF1590:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1234:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1666:
+	.string	"ADC_CURRENT"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1645:
+	.string	"BEEPER_ARMED"
+.LASF2000:
+	.string	"disableFlightMode"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1050:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1893:
+	.string	"monitoring"
+.LASF1444:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1778:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2029:
+	.string	"failsafeUpdateRcCommandValues"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF937:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF930:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1494:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1404:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1351:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1823:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1554:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1824:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1142:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1833:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1347:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1229:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1851:
+	.string	"currentControlRateProfile"
+.LASF1697:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF968:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1179:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF843:
+	.string	"__need_NULL"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1887:
+	.string	"RTH_IDLE"
+.LASF1791:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1515:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1715:
+	.string	"AUX11"
+.LASF1301:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1496:
+	.string	"_Mdouble_ _Float32x"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1665:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1296:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1651:
+	.string	"BEEPER_ALL"
+.LASF1007:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1628:
+	.string	"BEEPER_SILENCE"
+.LASF1241:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1209:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1340:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1671:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1225:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1502:
+	.string	"__MATHDECL_ALIAS"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF985:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1768:
+	.string	"WAS_EVER_ARMED"
+.LASF1622:
+	.string	"reset"
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF1141:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1248:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1998:
+	.string	"abortForcedRTH"
+.LASF1637:
+	.string	"BEEPER_BAT_LOW"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1799:
+	.string	"HEADFREE_MODE"
+.LASF1242:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1934:
+	.string	"dterm_lpf2_hz"
+.LASF1548:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1100:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1954:
+	.string	"dBoostGyroDeltaLpfHz"
+.LASF1902:
+	.string	"landingShouldBeFinishedAt"
+.LASF1700:
+	.string	"disarmReason_e"
+.LASF1417:
+	.string	"__DECL_SIMD_tanl "
+.LASF1272:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF757:
+	.string	"USE_LOG "
+.LASF1244:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF928:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2028:
+	.string	"autoRcCommand"
+.LASF1663:
+	.string	"disarmReason_t"
+.LASF1608:
+	.string	"int16_t"
+.LASF1371:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1538:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1597:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1828:
+	.string	"MULTIROTOR"
+.LASF1405:
+	.string	"__DECL_SIMD_erfc "
+.LASF1600:
+	.string	"signed char"
+.LASF1445:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1959:
+	.string	"controlDerivativeLpfHz"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF1714:
+	.string	"AUX10"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1716:
+	.string	"AUX12"
+.LASF804:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1518:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1294:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1121:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1800:
+	.string	"NAV_LAUNCH_MODE"
+.LASF1692:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1684:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1813:
+	.string	"SMALL_ANGLE"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1373:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1117:
+	.string	"sq(x) ((x)*(x))"
+.LASF2035:
+	.string	"failsafeShouldHaveCausedLandingByNow"
+.LASF1341:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1847:
+	.string	"stabilized"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF2004:
+	.string	"getStateOfForcedRTH"
+.LASF1796:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1765:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1447:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1633:
+	.string	"BEEPER_DISARMING"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF1876:
+	.string	"FAILSAFE_RX_LOSS_MONITORING"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF1555:
+	.string	"LAT 0"
+.LASF1549:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1573:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1730:
+	.string	"BOXCAMSTAB"
+.LASF1526:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1901:
+	.string	"throttleLowPeriod"
+.LASF1106:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1016:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1975:
+	.string	"SENSOR_MAG"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1436:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF1950:
+	.string	"iterm_relax_cutoff"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1743:
+	.string	"BOXAIRMODE"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1488:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1787:
+	.string	"ARMING_DISABLED_OOM"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF931:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1398:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1533:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1614:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF977:
+	.string	"PG_PID_PROFILE 14"
+.LASF1313:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1674:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1728:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1540:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF999:
+	.string	"PG_VTX_CONFIG 54"
+.LASF955:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1066:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1457:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1182:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1485:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1038:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1029:
+	.string	"PG_INAV_END 1023"
+.LASF1185:
+	.string	"__DECL_SIMD_log "
+.LASF1446:
+	.string	"__f32(x) x ##f32"
+.LASF1383:
+	.string	"__DECL_SIMD_erff64x "
+.LASF989:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF990:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1680:
+	.string	"FEATURE_CURRENT_METER"
+.LASF926:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1344:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1175:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1198:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1288:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1057:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2014:
+	.string	"reprocessState"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1698:
+	.string	"FEATURE_OSD"
+.LASF1621:
+	.string	"copy"
+.LASF1085:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1775:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1986:
+	.string	"FAILSAFE_CHANNEL_AUTO"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1435:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1763:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1835:
+	.string	"stateFlags"
+.LASF1589:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1268:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1627:
+	.string	"FD_YAW"
+.LASF1606:
+	.string	"long int"
+.LASF1753:
+	.string	"BOXCAMERA2"
+.LASF1754:
+	.string	"BOXCAMERA3"
+.LASF1189:
+	.string	"__DECL_SIMD_logf32 "
+.LASF982:
+	.string	"PG_SERVO_MIXER 21"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1885:
+	.string	"FAILSAFE_PROCEDURE_NONE"
+.LASF1338:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1174:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF1287:
+	.string	"__DECL_SIMD_expm1l "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1123:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1082:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2039:
+	.string	"failsafeShouldApplyControlInput"
+.LASF1738:
+	.string	"BOXOSD"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1980:
+	.string	"SENSOR_GPSMAG"
+.LASF1914:
+	.string	"PID_POS_Z"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1625:
+	.string	"FD_ROLL"
+.LASF1302:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF1855:
+	.string	"failsafe_delay"
+.LASF1659:
+	.string	"DISARM_KILLSWITCH"
+.LASF1080:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1059:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1305:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1801:
+	.string	"MANUAL_MODE"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1916:
+	.string	"PID_VEL_XY"
+.LASF1173:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1476:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1611:
+	.string	"uint32_t"
+.LASF1961:
+	.string	"pidProfile_ProfileCurrent"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1430:
+	.string	"__f128(x) x ##f128"
+.LASF1076:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1868:
+	.string	"failsafeConfig_System"
+.LASF1803:
+	.string	"AUTO_TUNE"
+.LASF1995:
+	.string	"rxGetChannelValue"
+.LASF1450:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1543:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1594:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1335:
+	.string	"__DECL_SIMD_log2 "
+.LASF1150:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF959:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF2023:
+	.string	"failsafeIsSuspended"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1323:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1956:
+	.string	"antigravityAccelerator"
+.LASF1354:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2005:
+	.string	"millis"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1726:
+	.string	"BOXNAVALTHOLD"
+.LASF1451:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1505:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1993:
+	.string	"failsafeProcedureLogic"
+.LASF1364:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1779:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1850:
+	.string	"controlRateConfig_t"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1929:
+	.string	"bank_fw"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF2009:
+	.string	"getThrottleIdleValue"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1539:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1729:
+	.string	"BOXHEADADJ"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF996:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF948:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF1221:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1987:
+	.string	"failsafeChannelBehavior_e"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1909:
+	.string	"failsafeState_t"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1806:
+	.string	"FLAPERON"
+.LASF1747:
+	.string	"BOXSURFACE"
+.LASF1942:
+	.string	"pidSumLimitYaw"
+.LASF1878:
+	.string	"failsafePhase_e"
+.LASF1907:
+	.string	"rxLinkState"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1083:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1952:
+	.string	"dBoostFactor"
+.LASF1071:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1636:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF719:
+	.string	"USE_PITOT "
+.LASF1349:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF1192:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1366:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1607:
+	.string	"char"
+.LASF1508:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1331:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1837:
+	.string	"rcExpo8"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1393:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1737:
+	.string	"BOXNAVLAUNCH"
+.LASF1439:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1672:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1630:
+	.string	"BEEPER_HARDWARE_FAILURE"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1130:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1328:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1245:
+	.string	"__DECL_SIMD_hypot "
+.LASF1718:
+	.string	"THROTTLE_HIGH"
+.LASF1699:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1060:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF1740:
+	.string	"BOXBLACKBOX"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1842:
+	.string	"rates"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1006:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1160:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1332:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1224:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF924:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1032:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1875:
+	.string	"FAILSAFE_LANDED"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1741:
+	.string	"BOXFAILSAFE"
+.LASF1140:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF395:
+	.string	"true 1"
+.LASF1024:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1162:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1015:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1055:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1994:
+	.string	"sensors"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1216:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1202:
+	.string	"__DECL_SIMD_expf32x "
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1571:
+	.string	"MIDRC_MAX 1700"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1136:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1943:
+	.string	"fixedWingItermThrowLimit"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF962:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1434:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1358:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1661:
+	.string	"DISARM_NAVIGATION"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1095:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF966:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1307:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1958:
+	.string	"navFwPosHdgPidsumLimit"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF991:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1911:
+	.string	"PID_ROLL"
+.LASF1411:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1240:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF1593:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1396:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1047:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1372:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1339:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF995:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1981:
+	.string	"SENSOR_TEMP"
+.LASF1030:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1104:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF917:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1854:
+	.string	"failsafe_throttle_low_delay"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF952:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1412:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1266:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1978:
+	.string	"SENSOR_OPFLOW"
+.LASF1984:
+	.string	"FAILSAFE_CHANNEL_HOLD"
+.LASF1067:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1724:
+	.string	"BOXANGLE"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1530:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF958:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1263:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1422:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1365:
+	.string	"__DECL_SIMD_acosh "
+.LASF1646:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1096:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1657:
+	.string	"DISARM_SWITCH_3D"
+.LASF371:
+	.string	"__linux 1"
+.LASF1517:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1342:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1631:
+	.string	"BEEPER_RX_LOST"
+.LASF1550:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1520:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1292:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF1278:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1536:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1460:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1693:
+	.string	"FEATURE_VTX"
+.LASF1127:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1472:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1421:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1468:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1915:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2013:
+	.string	"beeperMode"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1410:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF980:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1648:
+	.string	"BEEPER_LAUNCH_MODE_ENABLED"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1035:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1215:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1819:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1286:
+	.string	"__DECL_SIMD_expm1f "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF942:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2016:
+	.string	"totalRcDelta"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1534:
+	.string	"M_E 2.7182818284590452354"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1455:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1547:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1896:
+	.string	"controlling"
+.LASF1930:
+	.string	"bank_mc"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF1816:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1397:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1218:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1883:
+	.string	"FAILSAFE_PROCEDURE_DROP_IT"
+.LASF1090:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1784:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF2017:
+	.string	"_abs0"
+.LASF2018:
+	.string	"_abs1"
+.LASF2019:
+	.string	"_abs2"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1079:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1388:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1098:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF970:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1392:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1701:
+	.string	"rc_alias"
+.LASF1072:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1676:
+	.string	"FEATURE_GPS"
+.LASF1937:
+	.string	"itermWindupPointPercent"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1826:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2038:
+	.string	"failsafeRequiresAngleMode"
+.LASF1053:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1805:
+	.string	"NAV_CRUISE_MODE"
+.LASF1746:
+	.string	"BOXKILLSWITCH"
+.LASF1462:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1605:
+	.string	"__uint32_t"
+.LASF1226:
+	.string	"__DECL_SIMD_atanf "
+.LASF857:
+	.string	"USE_UART5 "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1403:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1685:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF983:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1369:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1789:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF2003:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1869:
+	.string	"failsafeConfig_Copy"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1821:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1217:
+	.string	"__DECL_SIMD_acosl "
+.LASF988:
+	.string	"PG_GPS_CONFIG 30"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1490:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1077:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1395:
+	.string	"__DECL_SIMD_asinh "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF960:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1206:
+	.string	"__DECL_SIMD_powf "
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF1212:
+	.string	"__DECL_SIMD_powf32x "
+.LASF820:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1243:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF2041:
+	.string	"failsafeIsMonitoring"
+.LASF2026:
+	.string	"failsafeUpdateState"
+.LASF1830:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1504:
+	.string	"__MATHCALL"
+.LASF1329:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1945:
+	.string	"fixedWingCoordinatedYawGain"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1681:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF987:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF758:
+	.string	"USE_STATS "
+.LASF851:
+	.string	"USE_MAG "
+.LASF2012:
+	.string	"sticksAreMoving"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1751:
+	.string	"BOXAUTOTUNE"
+.LASF1551:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1382:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1877:
+	.string	"FAILSAFE_RX_LOSS_RECOVERED"
+.LASF1168:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1735:
+	.string	"BOXLEDLOW"
+.LASF1886:
+	.string	"failsafeProcedure_e"
+.LASF1463:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1711:
+	.string	"AUX7"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1712:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1713:
+	.string	"AUX9"
+.LASF1028:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1719:
+	.string	"throttleStatus_e"
+.LASF1809:
+	.string	"flightModeFlags"
+.LASF961:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1988:
+	.string	"bypassNavigation"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF1552:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1569:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF997:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1762:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1284:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1246:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1420:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1180:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF1939:
+	.string	"axisAccelerationLimitRollPitch"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1441:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF1999:
+	.string	"activateForcedRTH"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1324:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1940:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1210:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1176:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1612:
+	.string	"pgn_t"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1562:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1667:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF957:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1565:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1232:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1647:
+	.string	"BEEPER_USB"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1556:
+	.string	"LON 1"
+.LASF1848:
+	.string	"manual"
+.LASF1632:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1256:
+	.string	"__DECL_SIMD_exp2f "
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1018:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1172:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1668:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1088:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF1839:
+	.string	"pa_breakpoint"
+.LASF1454:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1433:
+	.string	"__HAVE_FLOAT16 0"
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1425:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1107:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1744:
+	.string	"BOXHOMERESET"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1081:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1152:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1489:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF971:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF922:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1346:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1102:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1283:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1583:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1196:
+	.string	"__DECL_SIMD_expf "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1781:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1394:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1265:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1279:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1253:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1370:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1845:
+	.string	"controlRateConfig_s"
+.LASF1170:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF1231:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1386:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1054:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1662:
+	.string	"DISARM_REASON_COUNT"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1418:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1443:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1270:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF1097:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1093:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1163:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1356:
+	.string	"__DECL_SIMD_atanhf "
+.LASF918:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1227:
+	.string	"__DECL_SIMD_atanl "
+.LASF1874:
+	.string	"FAILSAFE_LANDING"
+.LASF1125:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1933:
+	.string	"dterm_lpf2_type"
+.LASF1149:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1849:
+	.string	"misc"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1084:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF394:
+	.string	"bool _Bool"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1325:
+	.string	"__DECL_SIMD_log10 "
+.LASF1271:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1831:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1381:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1264:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1070:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF1166:
+	.string	"__DECL_SIMD_sinf "
+.LASF1298:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1219:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1834:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1306:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1832:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF1207:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1184:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1389:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1669:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1790:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1045:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1742:
+	.string	"BOXNAVWP"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1008:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF920:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1972:
+	.string	"SENSOR_GYRO"
+.LASF1499:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF1144:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1559:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF853:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1124:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1001:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF2034:
+	.string	"failsafeChooseFailsafeProcedure"
+.LASF2047:
+	.string	"pidProfile"
+.LASF1002:
+	.string	"PG_CF_END 56"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1017:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1546:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1509:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1780:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1158:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1558:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1599:
+	.string	"long unsigned int"
+.LASF1063:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1640:
+	.string	"BEEPER_ACTION_SUCCESS"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1033:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1557:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF934:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1922:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1021:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2015:
+	.string	"rthLanded"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1384:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1044:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF1971:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1785:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1955:
+	.string	"antigravityGain"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF976:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1572:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1276:
+	.string	"__DECL_SIMD_coshf "
+.LASF994:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1133:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1871:
+	.string	"FAILSAFE_RX_LOSS_DETECTED"
+.LASF1194:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1563:
+	.string	"RADAR_MAX_POIS 5"
+.LASF855:
+	.string	"USE_UART3 "
+.LASF1129:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1755:
+	.string	"BOXOSDALT1"
+.LASF1756:
+	.string	"BOXOSDALT2"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1880:
+	.string	"FAILSAFE_RXLINK_UP"
+.LASF1872:
+	.string	"FAILSAFE_RX_LOSS_IDLE"
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1308:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1026:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1183:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1310:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1935:
+	.string	"yaw_lpf_hz"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF939:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1105:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1634:
+	.string	"BEEPER_ARMING"
+.LASF1797:
+	.string	"NAV_RTH_MODE"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1925:
+	.string	"pidBank_s"
+.LASF1926:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1892:
+	.string	"events"
+.LASF1003:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1891:
+	.string	"failsafeState_s"
+.LASF1598:
+	.string	"unsigned int"
+.LASF1964:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF1249:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1014:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1414:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1519:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1094:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1584:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1000:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1316:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1924:
+	.string	"pid8_t"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1387:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1863:
+	.string	"failsafe_min_distance"
+.LASF1895:
+	.string	"active"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1257:
+	.string	"__DECL_SIMD_exp2l "
+.LASF947:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1465:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1603:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1623:
+	.string	"pgRegistry_t"
+.LASF1318:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1201:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF23:
+	.string	"_LP64 1"
+.LASF2033:
+	.string	"procedure"
+.LASF975:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1052:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF1500:
+	.string	"__MATHDECL_1_IMPL"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1407:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1894:
+	.string	"suspended"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF923:
+	.string	"EXTENDED_FASTRAM "
+.LASF1345:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1592:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1581:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1629:
+	.string	"BEEPER_RUNTIME_CALIBRATION_DONE"
+.LASF1923:
+	.string	"pid8_s"
+.LASF944:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1949:
+	.string	"iterm_relax_type"
+.LASF1295:
+	.string	"__DECL_SIMD_sinh "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1099:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1089:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1990:
+	.string	"channelBehavior"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2115:
+	.string	"io_types.h"
+.LASF2130:
+	.string	"mathcalls-helper-functions.h"
+.LASF2122:
+	.string	"math.h"
+.LASF2100:
+	.string	"long-double.h"
+.LASF2106:
+	.string	"platform.h"
+.LASF2059:
+	.string	"src/main/rx"
+.LASF2054:
+	.string	"src/main/drivers"
+.LASF2128:
+	.string	"fp-logb.h"
+.LASF2116:
+	.string	"rx_pwm.h"
+.LASF2094:
+	.string	"libc-header-start.h"
+.LASF2099:
+	.string	"cdefs.h"
+.LASF2066:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF0:
+	.string	"./src/main/flight/failsafe.c"
+.LASF2058:
+	.string	"src/main/navigation"
+.LASF2070:
+	.string	"stdint-intn.h"
+.LASF2079:
+	.string	"rc_controls.h"
+.LASF2074:
+	.string	"axis.h"
+.LASF2065:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2068:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2077:
+	.string	"adc.h"
+.LASF2097:
+	.string	"wordsize.h"
+.LASF2086:
+	.string	"sensors.h"
+.LASF2061:
+	.string	"src/main/target/SITL"
+.LASF2075:
+	.string	"beeper.h"
+.LASF2087:
+	.string	"failsafe.c"
+.LASF2057:
+	.string	"src/main/io"
+.LASF2090:
+	.string	"mixer.h"
+.LASF2084:
+	.string	"pid.h"
+.LASF2064:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2083:
+	.string	"failsafe.h"
+.LASF2078:
+	.string	"config.h"
+.LASF2096:
+	.string	"features-time64.h"
+.LASF2069:
+	.string	"types.h"
+.LASF2123:
+	.string	"math-vector.h"
+.LASF2126:
+	.string	"floatn-common.h"
+.LASF2125:
+	.string	"floatn.h"
+.LASF2081:
+	.string	"runtime_config.h"
+.LASF2108:
+	.string	"target.h"
+.LASF2092:
+	.string	"stdbool.h"
+.LASF2067:
+	.string	"/usr/include"
+.LASF2124:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2051:
+	.string	"src/main/build"
+.LASF2089:
+	.string	"feature.h"
+.LASF2095:
+	.string	"features.h"
+.LASF2056:
+	.string	"src/main/flight"
+.LASF2103:
+	.string	"typesizes.h"
+.LASF2104:
+	.string	"time64.h"
+.LASF2053:
+	.string	"src/main/config"
+.LASF2085:
+	.string	"navigation.h"
+.LASF2080:
+	.string	"rc_modes.h"
+.LASF2071:
+	.string	"stdint-uintn.h"
+.LASF2062:
+	.string	"src/main/target"
+.LASF2131:
+	.string	"mathcalls.h"
+.LASF2060:
+	.string	"src/main/sensors"
+.LASF1:
+	.string	"/root/repo"
+.LASF2127:
+	.string	"flt-eval-method.h"
+.LASF2063:
+	.string	"src/main"
+.LASF2076:
+	.string	"fc_core.h"
+.LASF2073:
+	.string	"time.h"
+.LASF2114:
+	.string	"parameter_group_ids.h"
+.LASF2113:
+	.string	"debug.h"
+.LASF2088:
+	.string	"rx.h"
+.LASF2129:
+	.string	"fp-fast.h"
+.LASF2117:
+	.string	"stats.h"
+.LASF2132:
+	.string	"gps.h"
+.LASF2055:
+	.string	"src/main/fc"
+.LASF2107:
+	.string	"common.h"
+.LASF2101:
+	.string	"stubs.h"
+.LASF2118:
+	.string	"bitarray.h"
+.LASF2120:
+	.string	"maths.h"
+.LASF2098:
+	.string	"timesize.h"
+.LASF2110:
+	.string	"sanity_check.h"
+.LASF2052:
+	.string	"src/main/common"
+.LASF2093:
+	.string	"stdint.h"
+.LASF2112:
+	.string	"build_config.h"
+.LASF2105:
+	.string	"wchar.h"
+.LASF2102:
+	.string	"stubs-64.h"
+.LASF2121:
+	.string	"vector.h"
+.LASF2082:
+	.string	"controlrate_profile.h"
+.LASF2109:
+	.string	"stddef.h"
+.LASF2111:
+	.string	"common_post.h"
+.LASF2072:
+	.string	"parameter_group.h"
+.LASF2091:
+	.string	"stdc-predef.h"
+.LASF2119:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`%\002\305\r"
+	.string	"\004\022\031\003"
+	.string	" "
+	.string	"\361\236\240\375\t\004\002"
+	.string	"\002\001\002\002\002\003\001\240\342\234\212\n\002\003\316\272\372\206\b\016\002\004\002\003\005\002\003\002\006\004\245\206\207\251\003\004\002\007\002\001\005\375\354\346\204\006\016\002\004\002"
+	.string	"\002\001\t\264\274\317\272\004\004\002\006\002\b\013\254\317\315\205\016R\002\t\002\003\007\n\003\002\004\004\002\003\r\202\363\222\212\013$\n\016\260\232\300\330\004\006\017\356\322\367\320\002\b\004\002\013\020\270\301\313\260\t\021\367\263\204\226\016"
+	.string	"\002\001\022\261\314\343\264\013\023\246\345\375\355\003\003\024\362\213\226\257\007\025\202\343\337\347\005\026\247\344\265n\027\203\312\307\300\017\006\007\002\001\030\323\373\233\264\016\031\242\260\301\323\003\032\211\230\346\326\0026\002\f\002\f\002\006\002\r\002\006\002\001\016\002\016\002"
+	.string	"\002\017\020\002\013\b\002\b\035\256\271\235\355\n\002\036\352\315\270\302\t\037\317\365\207\232\t \365\231\226\261\001\t\002\003!\330\335\306C\b\t\002\003\"\317\341\304\252\t#\263\333\267\206\n\004$\232\213\307\245\005%\221\342\203\b&\240\342\234\212\n"
+	.string	"L\250\341!A\0021\033\032Ks`\002Bd\306\003\020Ph\304&\311r\007Na\255K\242\310\361\355\b\b\b\371\305\362P\270!\177\222\375W\013\376\260\356\305\022jF\316\fc\226\320L\206P\265\024\211"
+	.ascii	"\322\032\366\361\251:|\230\321\311Zd\025\350\204\224\264K\355"
+	.ascii	"\323Z\033t\271\264\250\027\270Z\344a\212A\271\324\021w\006\335"
+	.ascii	"z\344\255}\206\355\353\326\353!\215\240^s\252\303\356\200\t\366"
+	.ascii	"j|\255\213\035\205\310\311HDg\304'\343\302\277Y\245\304\221\232"
+	.ascii	"[!p\007"
+	.text
+	.section	.gnu.lto_.ipa_sra.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \272E\003"
+	.string	"\242\004\017\031\240E\303\001\377\377\377\377\377?\347\377\377\337y\215l\315\3502N\221&+S\316I\030\b\002\013\230\325Rk\232R\264\320>\353l\263\314.\253\314d\"\356\230F1\270\304\266\256\313B\022"
+	.string	" \004%n\316"
+	.ascii	"\271\362-\302\b_\260|)t1G\200\001+\004\340^\216\302\316#\236"
+	.ascii	"vsV(\006hZ\276\001,"
+	.text
+	.section	.gnu.lto_.inline.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\002\004]\016"
+	.string	"vQC> \3458\035'\301(\300v\265\226\302$F\032\213\350\001\236d\240\300\236P\036\033p\016\352\302\b\224\257\020\300b\003:\002\004\020\001\022"
+	.string	"\346\200\361\304\031\240\212?PJH\3045\264dK\231\002/"
+	.string	"3"
+	.string	"5"
+	.string	")\023\031X\342\026\212\022\363]\373wdVw\207\"\230\354\356\317+\307|\026\271\273\233\363\2135"
+	.ascii	"\254\034\351\370\337\221U/\255\022\356\007\257\321\004\273\313"
+	.ascii	"\361nW/\302\371%\270\303\364@1\306\004g\250^\257u\235+U\2254"
+	.ascii	"E\275\232\246)\272\275\003\003\240\245\034U\226\220\213\031\302"
+	.ascii	"7\273\377\273J\252\250c\300\277\203UJ\005\t\03295\263\302\341"
+	.ascii	"\335@T\020\"\200`\026\265\203N'\254$\351NXyv\376aQE\273O\336"
+	.ascii	"\007H\314\3628\326\335\243\357\236\207\344\026\377\377m5\\b\346"
+	.ascii	"l\373\203\203\331\335\036Hwwo\0208\303\202\002k\233'\204\344"
+	.ascii	"C\322\243\335\304\256U\315\007\005\377\325T-d2\033?9\270mR\250"
+	.ascii	"Q=b\246\3066\305:s\240\"\022\033\353\006\022\2003I\001\0061\306"
+	.ascii	"!#p\216\231h(\230`\302\t\273\006\320\224$\324\315Th\303a:H\336"
+	.ascii	"\004|(\351Eb\376\354Xg\013S\361\251\225/\217Z*\177\013\2130>"
+	.ascii	"\230\021a>\025i\361r\234!=$\"\204\335\276`lKQ\016\357\200\330"
+	.ascii	"\305\311*\372Is}\341\007\225\274\026v\353\244\241?\255\337>\213"
+	.ascii	"\034\001Y\314\3003/\220\323\344\301|\320(pz\017x\357\n\326|\033"
+	.ascii	"\024\256\234\311<.\241\344\317\257\030\272\312#\332\214\202\314"
+	.ascii	"\311\313\325\237\273\300\342\376m\300sQ8\261.P\301\247M\237\306"
+	.ascii	"\204\355\026#4\001"
+	.text
+	.section	.gnu.lto_.jmpfuncs.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\376"
+	.string	"\025\007"
+	.ascii	"RJ\036&\200K\322\001\363\204\031X\375l&dB\247\312\004\275i\263"
+	.ascii	"\300\f 9\3104\334\"\261\255\355\302\346a\t\331d\313\024\377\222"
+	.ascii	"?\362C~\367\217w|Cj'\235\033\372\031\277\370\025\237x\304\037"
+	.ascii	"\336\360\355\237/<\341\007\003\360\031+%7ET\252\021\323\0241"
+	.ascii	"\263Q3E\\\253Q\245\265Z\004\037\370\367zY\337\"vr~s\312\327\234"
+	.ascii	"z\276b\030\342\017J\252U\320\345\0043 \320\"\261:\017\244'\n"
+	.ascii	"\b#lh\266\333\330\303B;!ep\223\311\036\316\375\370x\263\216]"
+	.ascii	"\034\t\343e\331\323\3763\032SD\365Bs\327\\:@\3005\304]{\024\257"
+	.ascii	"@\237\001GV\215I\334\274L\310\361$\354\307$4\307B \030D\352L"
+	.ascii	"\356nc\204\260Wc\212\330\355\030\332\256\204\233\311\022Z\030"
+	.ascii	"\002"
+	.text
+	.section	.gnu.lto_.pureconst.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 S-\002"
+	.string	"2E\020\031\220+\035\377'\202\231\272\273\273\315\314\224\357;5\002m\333\262[\214\177\325\016\327\272\325\245\3564\245\033Mh\254\335\347:\267\231\314\\\2462\223\211\314c\032\267\270\304\331p\205\033\334/p\257\335\335\025"
+	.text
+	.section	.gnu.lto_.ipa_modref.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\304\001\365\007"
+	.string	"2J\033\036\220\247\031\016\377\377\377\377\377\377\377\227b\315\366&\326\266\265\335\377\357\244\204\021\261I\333I\246\252:\225@|8\215.\3050\006O\354\216\347\261+,\342y\3305\317\006@I*\032\341\300@%+P\021]\207n\"X\006z\003\272j\355\224\231\217\351#\240\341\005\270\344\231\030\205'z\205\016\331\251\013\323\323-\307)\317\264C\357\342\t\001K\250Aeu\263\300\3165\240\002\221\"\244\007\021\220\035S\214\341\222\026\353o\242\330\341IX<\223\272OC\300!\203h\345\350\200\233\333\r\302qvTX\b\311\346K\320\234,\212\330!\355,a\310^W\316\225\355\237f\373\334\022/\314\301\370\376\205\265\200\313*\355\271WQ\367\262\030\307$~\305b\345\231\263 \013\347\227\224W\233\245fq)\203A\270\213\017\326\027\016o!kU\304"
+	.string	"\206\034\272</\177\232\355\006\332\005y\3424\225\364"
+	.ascii	"("
+	.text
+	.section	.gnu.lto_.lto.5fff017c599303dd,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_failsafeConfig_Registry.73.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \230m\004"
+	.string	"\364\007a"
+	.string	""
+	.string	""
+	.string	"+"
+	.string	"\005\001\212\001\206\200\200\374\342\303\305\201\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\374\006us\317\006uq"
+	.string	"\005\001\006'\001\024\201 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\035./src/main/flight/failsafe.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_failsafeConfig.75.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \201e\003"
+	.string	"T\005t"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\001\005\001\006\035'\001"
+	.string	"2\005\001\006\031\001S\344\031\001\270~\035\001\310\001\005\350\007?\202\210\200\350\001}{\305\001y\275\001w\304\001u\304\001s\303\001q\302\001o\301\001m\300\001k\277\001i\276\001g\275\001e\274\001c\273\001"
+	.string	"\t"
+	.string	"V\211"
+	.ascii	"G0\r$\325ds] \006\334Hi\b\003E"
+	.text
+	.section	.gnu.lto_failsafeProcedureLogic.76.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \347E\004"
+	.string	"\222F\027\"\240)\215\001\017\374\337\266'\225O\232\314\377\337\356\021I\253oDUu\301\303\236g\030\003oGH\222\0017c\266c\035\202K\326@E\332\354\266\336\360\246<\242\275\321\034\275\353\213\357r\324?\213f\2100T0\004\016\314\351\234\235\353\211\347r\024B\221\020\234\224e\300\017s\272\357n\022\021"
+	.string	"2\005\001\025J(\327\205a\340\212R\373\240\2320\206B\001gV\355\t\306\351\214\376\031\341\245b\200s)\366\r"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_failsafeReset.77.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\036\004\025\024"
+	.string	"\026!wI\320\362&\035\016x\234`\257H\340;\303\203U\362EJ\037yq\3662\301\321\210\324\204\025\330\250\344\320\347\330i\330\013-\217\020\037\r\337\2460\022m\233cb\233\312C\2407dI\204\200\005\201\305\325\336\324\335\032\331D\312\224\002U"
+	.string	"_"
+	.string	"l"
+	.string	"\366\324\255\253\301U\263T\275R\265J\325\251\253\277UKU{\252^U\353\325\037\001I\020\035\020\232\363C\324\323\034\222>+l\037t\315>z\0167\257KQ\243c\232s\206{\342\265k\315\177\213\257n6\035\256\251\005sN\353\315\006\304\275\267]\3006\002\333\333\tv\312u2"
+	.ascii	"\2709g\211\017\343;+3\026\226\357\322\203\272\r\361V\236g\327"
+	.ascii	"[\t\204\346\306Vt\377|\272\273\001t4,l\032\345\257\356k\212\330"
+	.ascii	".\327\241\251\346\364P\342\273x\016\007_\305\245ad\364\267K_"
+	.ascii	"\346\273\374*0\312\231\321(kO\016\036S\235\354\234M\327\204}"
+	.ascii	"o.\216\003\333\202p#\021\334\022\243\034\250\223\3176y\217\223"
+	.ascii	"\"\002N(\237\035\341D(C\003\232$|G"
+	.string	"P\2704\341@:\\J\024\216\343\006,\251\302\177l\220\210#\322i\334\266p\237\032\006\304Q\350\262\317\276\360\0312\\\342\030\304Z\033\303w=R\267Z\326\213\253v\265R\211\346\306\226{jU+\340\347\333T\354<1\276\375\016\n \271\001N\201\311Tb0-\263\230J\030\223ae\326\242\022j\230\305\\\302\224\027\230\0206b\332\006\331K\030C\243\275\204`n\346\336\\\034\223\022C3ksJ\204\275\b\324\323\210/\235H\023\223^\276p;\021H\257+\215I\270q\027\242\246\363\331v]HM\207\0047\347L`3x\220\006\227G/q\334\331\264\326v\360\037\017|xA`[\2501l\210\211\004r\n\312J\222\341\020\003\021\241U\033\020(\304\314H\221T\007\343Qd\022\352N2\205\246\207`#^. K\262\203\251\215\372/\261k\352kJ\302.\200x\031\312Fx\356\240d\322o\n\347\260\304"
+	.string	"3\031s\263x\032\215Nh\370\361\231\206\314\226\232\026\023\244T\220\336\n\234\211\022Nd\005\316D\t\207\210\362Y\363\303fM\332"
+	.ascii	"s\022\247\371\f\323\006\t\327\037K\201\207n\340u\230\223n\262"
+	.ascii	"Pn\037\322X}\205\222I)G\017\030R\204\f\365\021!\t\364?\326\001"
+	.ascii	"\034\265\340\376\017"
+	.text
+	.section	.gnu.lto_failsafeInit.78.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`d"
+	.string	"m\b"
+	.string	"\"O880q\323\001"
+	.string	"E\210\374\320*\376q\274\005\317\333\261A\345\034\006\227\207U\206F\340o\272=\004\377\252\362}\234\233\237\b\034\f\214!\310\337*\303V\203\216<\2437\331;\245\366t>\031\326\2014,\253!\207\006\r\224U\b\r{\250\036\256\253\035\216\267\210\017WC\333\306\325M\270\267v\236,\025J\204)M\013\337\344\366v\224\223\002\027\rq\325]\266\304K:\022\003\231\362\321r\321eO|DD"
+	.string	"\356\256\202\037r\021\n\277\343\324\025#\371\357\324\037]\247\034P\246$G\017\250V\\\255\244\261C\222\234\033\366\255\235'\2332\240fb\022\306]\214\261fY\350\212\207\355o\354\331/\017\301}J\345\"5\263\273ur\334\273\364\374\203<\3403\221.\001\026v\327\3623e\334\363\266\017l#\330\027\b\020"
+	.ascii	"3\241\035(\360\361\273\013\214kUb7\270\0010\203\215U%\305VH\226"
+	.ascii	"\253\006]\310\323\202\035/C\200K\267h\347\023"
+	.text
+	.section	.gnu.lto_failsafeBypassNavigation.79.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`l\001m\r"
+	.string	"\226\030WB\020\221\232\016sV\021\360\2433\001\345\031?\241\f`Y+\200_3^\326HT\225{\250\307\241\221\020\376\366\034Hs\n7\222E\266\355\252j\004\201A:\177 \240\243Z\372\004\340I\234m{o)S\nE"
+	.string	"@"
+	.string	"H"
+	.ascii	"\032\037@`\342\353]\213\312\271\024(\242\030\273\335\244,\277"
+	.ascii	"\036\341\323\274|\351\003^\320P\002\264a\217\026\016)\344\323"
+	.ascii	"lZj\200m\302\333\330\335wx\246l'\231\322\307\356:A[\205[\272"
+	.ascii	"\355\021\333\034\366E\001\036\276\207\273|\374\f\207\216P\222"
+	.ascii	"\007\035\372%\361\360*\300\205K\226#g\214\t\026\2333\354\016"
+	.ascii	"K\345\354\277\325\220\355\264\244i\350\364\313\264\246\237\321"
+	.ascii	"\240Xa`\264\2532\242\261*\340\211\r\266M\3541\324aZ\354j\036"
+	.ascii	"\266%\234\304\206@\313\256\226@\304Gp\036H\025\253x\370\3640"
+	.ascii	"\266\203\207\020\021\251\002\310`px\177\312uOU\260\202\301\372"
+	.ascii	"\013\210|\356.\246\276\342u\301\n\313\313\013-e\330\206\360\017"
+	.ascii	"Wfw\003\336tp:\324'\244\242:\023I\003\220*\2443=\250(\221i\343"
+	.ascii	"\371L\035\003l\215p<\023\211ey\246n\377VCN\310\361|\005\0165"
+	.ascii	"\305\266\244\033\231\236\030\252\244G\251\221\345(F\345R\273"
+	.ascii	"]\fj\3501x! \240\202\231\t\260\007\256)z\315\031\236LE\n\254"
+	.ascii	"\200`D\221\261\261Gs\300q\374=\340\205X,\225\344c\231\347\345"
+	.ascii	"\306[2m\247 \031\224\013\267\260\366\n\205\256\3430\352\275]"
+	.ascii	"\335\242\022+\217\305c\032'\261\030\327\215\332\323\333E\313"
+	.text
+	.section	.gnu.lto_failsafeMayRequireNavigationMode.80.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\306"
+	.string	"e\013"
+	.string	"\326\025O? O\225\016\003r\r\311E\312\003\004\222\240[+\241>\210\242\271u\312\t\025\007\211\316\302\210\234<\256c\341}\3634*\377G\001\030"
+	.string	"\205i\215\221\342m\204\bgFbQ\3444D6\2212\245@"
+	.string	":"
+	.string	"="
+	.string	" TH\031r{\341\240\307l\025\344?u\003\0364\314\021\330\340\021\022\341\231\203\r\374t\263\016\n\" `\200\241,\343e\201\304SW\022\370\251>\nH)\255#\360\301\255\335\366\001\333\021\373\002\002\361\273\001Sy:\275U\220\312\302\016C\272(\373;\347\234\336\223mu\\\365\252ZU}m3\361\222\244\220\2624crDtm\260\375\2617\007\030\3601\350!\206\322Q%D\001qQ\376\325\024cq\310\366\344\207\327\335\t\022V\231\267X\272\017W\254\203\2068\3612\3555\332\367\002E\013\366\351\n\333\335W\032\210\224\037\001\377\303U\034?\303\243\031x\364\243G\337\243=\246H*\226\t\007s\231X\270N\002\004\027\214\205Sp\231d8\312\206\303I4\334-\250l\270N\327m\270-\364\276'\353F\256\031\200\357\222l\307\345\3606\344\335\270\027\265\360tj\231\224R\006\022"
+	.string	"J\b\230P\347I\231` \034@\006\266\273\204\324\023\030"
+	.string	"\251*\002\006/\0043\256\331"
+	.ascii	"\023\031\370=#\264T\025&\220\267\252\235P"
+	.text
+	.section	.gnu.lto_failsafePhase.81.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\n"
+	.string	"U\007"
+	.string	"b\01645`m\322\001C\221\241q\303\200\021\326\372\022\f\242\336\277Y\210\013\347\254\020\315\242\336\013\302B\235\350\211\361\326\nI\022R\207\024\205\034?J,u\321\222\275\267L)\306\\2\227\265\321`\326%9\013\n\230\346\222\r\230\305 1\332F^\n\2349d4\311\3112MRs\017\367\205\374*\320\223\260\375p\220\r`w\021\374\217O\b?\343\321\021\035=\367\350w\246G}\004%\036 -\231\262XU\261\347G\237\310>\334\027\262\255\326G\255\220H\223]\212\022iG\242\310\310\266\307\246\374\215sx\274\301\211\321\005\210H\023!)\273SV\037\230\036\341\005\246\307w\361\355\272\371\3578<\031\241p\335\347jI\330]+\327U\334\357\266\rl\037\330\326\b\b"
+	.string	"\t\013\035\263\030|\205"
+	.ascii	"]\303o#F\026\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_failsafeIsMonitoring.82.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \375\035\007"
+	.string	"\262\31527@o\222\016@E\345\277W\202h\324\270qI\006\350\373\354\310\354\336t\205\200\326n\366\254\217\225S\b4\255\377+w\024\235\251 \037\n\310\036\361"
+	.string	"\"b\265O\210L\001o4\034\354\362t\262\013\213\237\007\207\254\203\305\210\354\202\210\233\315\0235\005k\022\234-~4m\213V\227\205\247\241\301\bZ\374\023-\341\0042s\341\2224Eq?Z]\001z%\265\272 \200V\017\022\260\244F/f\213#\337\313w\242\007;\276\231\204\247\377\375\340\200\306\n\003Jf)\006&U\252\023\220\277\337\221\320['(\204\346\332y\224\212\302\2700q\311\354\"D\225\353\343nE\232i\tI!\231D}\001\r\231\371#\2312:\354\177\360#\374\033\001\007"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"]\303\t\206x\341\316\231\332\371\004"
+	.text
+	.section	.gnu.lto_failsafeIsActive.83.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \374\r\007"
+	.string	"b\31516@o\222\016@E\345\277\255B\be.F\326\355\265\317&\335o\357,Q\374\277\331\263>VN!\320\264\376\257\334Qt\246\202|( {\304\003\210\210\325>!2\005k2\233\313\352p0\353\212\236\007\007\214s\305\b\314\202\210\032\255\0233\005g\022\033-z\262L\213U\227\205\245\241\201\bZ\374\023-\331\0042s\341\216\224\204\342z\224\272\342\363\312\225\272\037\200R\017\022\254\220\210\336\351j#\237\313w\241\0079\276\230\204\245\377\375\340"
+	.string	"\210\n\303)stz\311\024\n\345\343\007}u\202\002\350\255]\307\250&\214\013\223\226\314.BS\267\276\355V\244\030\226\220\023\216\024\352\013h\310\314\037G\312\350\260\377\301\217\360k\004\b"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeShouldApplyControlInput.84.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \374\r\007"
+	.string	"b\31516@o\222\016@E\302y5\223H\324\270q'\276\237\177\fF\271m\267L\302\376\315\236\365\261r\n\201\246\365\177\345\216\242\263\b9O\001\331#\036@D\254\366\t\221)k2\033\354\352p\262\013\213\236\007\207\214\203\305\210\354\202\210\232\255\0233\005k\022\233-z4m\213V\227\205\246\241\201\bZ\374\023%\341\0042s\341\216\024Eq=Z]\361y\035\265\272\037\200V\017\022\250\240D/\265\265\221\317\345\273\320\203\034_LB\323\377~p@\004\205!%\223\224z\311\223\312\344\343\007\275u\202\002h\256]\007\251\247\214\213\222\226\314.\302S\271>\3566\244\030\026\220\225Q)\324\027\320\220\231\277Q\t\243\303\376\007?\302\257\021\b"
+	.string	"\t\013\270\211!|\205"
+	.ascii	"]\303\377\"\306\022\"\207;gj\347\023"
+	.text
+	.section	.gnu.lto_failsafeRequiresAngleMode.85.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`l\001u\r"
+	.string	"\326\230WB\020\221\223\016s&"
+	.string	"\370\321\263\330\310N>Q%,\377\f \220\236?\376\306t \367\270\007\002\331F\360\267\347`\255\347\252g\005k\323U5\212\300 (\025:\327S \033"
+	.string	"\242\371\226%{o)S\nD"
+	.string	"A"
+	.string	"H"
+	.string	"\316\270\200\001\023g\357J)_)\235\230b\354v\225\256<{\204O3\363\251\017hA\203\n\021\247=V8\234\220/\303m\251\032N\302\333\330\335ox\242p\241L\352cw\235\"\216\302M\335\366\210m\016\373\246\347\360\226\217\217\341\320\020J\362\242C\277$\036^\003\274h\001\345\311I\342D\213\315\031v\247\245\222\354\277\335]\353\310v\232\3224t\372eZ\323\307hR\260@Pb7\345DcW@\023,\266M\034\326_\\\354n\036\266#\\\304f@iw;"
+	.ascii	"\342!8\017\344\212W<|\372\027\273\301?\210\230T\001\204Pdx\177"
+	.ascii	"J\352\236\232@\345\002v\027\017\371\334]M\235\305\253\002\025"
+	.ascii	"\026\027\030[\312\260\375\340\0352\314\356z8\336tp:\326'\344"
+	.ascii	"\262:\025\t\003\220+\244S9\270,\221j\343\371T\035\002\214\215"
+	.ascii	"p<\025\t\206y\252n\377VGN\310\361|\004\016\025\3056\245\033 "
+	.ascii	"\r\031*\245?\251\001\312S\214JJ\355v5\250\243\267\340#\002  "
+	.ascii	"\260\202\231\t\260\007\256)z\315\031\236LE\b\254\200`D\203\261"
+	.ascii	"e\317\346\200\342\370{\300\013\261$\225\310\3672\217\313\211"
+	.ascii	"72o\247H2\250\213\2670\357\025\nZ\007^$\262E\245W\036\212\307"
+	.ascii	"0NR1\264\033%\247\267k\225\001"
+	.text
+	.section	.gnu.lto_failsafeRequiresMotorStop.86.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`U\001\325\r"
+	.string	"6\231ZC\020\221\223\016\363\364\215\235\236\314\327\033w[\005\r\030l\016f\200\341\347\342\273R\312\273hS\265\034\2645\213_\317\243\371\310S%Gk\001\001"
+	.string	"\200 R\315]D\322\003\350\003\220\006^\213m{o)S\nH"
+	.string	"C"
+	.string	"K"
+	.string	"\333U*\246\247\244L<\310\354\252.M\371\366\b\237\346\346\307\r+%\270N\3648!\341\246\302\337#\340B\004\214"
+	.ascii	"\246\f\234\325IH\345\350J\257cw\277\362<\351H\231\232\004\273"
+	.ascii	"\353\344:\n\267\346\2665\333\036\366S\001\030\016\035\"\311s"
+	.ascii	"\207>I<\274\n\210i\031\345\2143\304\213\024\2333l\025)\025e\377"
+	.ascii	"\255\242\330N[/\035_\032\276\364\323\264f\372\033\03420\b\\v"
+	.ascii	"M34\026\005\034\221\262]b[6p\240\304\001\372\364&5\214\035\004"
+	.ascii	"g\263[\002\361?\334\245\023\222e\361PU\263:\021\303$X4\250@E"
+	.ascii	"]_`.\264x\237\230\252\340\244b\025\343\340\253O\207|\356\256"
+	.ascii	"H\275\305\253\236N,V+J)\343\034\266\315\356\202\370,o\211\340"
+	.ascii	"\007\346|t<XH$\303<\327H\203\220L\304s=\310\260\317\305\001\205"
+	.ascii	"\256\217\001\326 t@\327\210\246\201.K5\272\2428\237\307\023\026"
+	.ascii	"x\324\023\333\226v\214\224\344\250V\214\2122\324g\002@\332\013"
+	.ascii	"\030\3449\250\177\261@R\2215  \220\202\231\251\273\001\300\002"
+	.ascii	"\006j\370\227|1\252Q\240\346Fl\f\362\013\032\355T\366e\013-l"
+	.ascii	">/\243\250\317\203V\334\262dQ.\334\312\274\327\003\367\327D."
+	.ascii	"h\221\3470\033\202\t\nZ\016\267\227)\034\246QsNQ\234\355\352"
+	.ascii	"e"
+	.text
+	.section	.gnu.lto_failsafeStartMonitoring.87.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\365\006"
+	.string	"R\r14`\215\032\003@\023}\312\200\"*$)6(\030\260\r1\020V\257\024\316H[|\352\327.d\250h#R\333K\022\206\224#}\256\230\240\326q\243lR\246\024\315`4\025\305\331XT%;\013\n\326\246\222\r\026\305 3\030Gb\006z9h0\331\271.L^\270\033\226(s4ED0\242\266\247\322>\230\303#\260\375?\2507l\372\324\030\216\205"
+	.string	"=k\2165\250\342H\260\225\210^\327\200\371I\362g\322r\241\007+ZS\016K-\374\214N#\b\335?\321\235\034$~d\264\365\245Y\033bn\273=L\022\035\247\377\022^8\363\313jk\030@#\205\374,\t\377\3734\022\205\013\335\266\240\255A[\213\b"
+	.ascii	"3\001[8S\374\370\032\327\304\264\020\360\313\020\340\322-\332"
+	.ascii	"\371\004"
+	.text
+	.section	.gnu.lto_failsafeShouldHaveCausedLandingByNow.88.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"U\f"
+	.string	"\306WUB\020q\233\016s\tC^\217\204w\b\220\304\302\300\235\004\345"
+	.string	"\035\334w\252z\337\321;\027=\303\255\033\262\257\017\206\367\373"
+	.string	"\306\245\333\326_5\002\240R\202'\355\262w\350\f*\370\232\330\354\267\275\245L)D"
+	.string	">"
+	.string	"B"
+	.string	"\027\222\n\222\n\216\335\317R\017\027=BM\221\377\223\307\025\0226:o\344\021\223\341P\263\273\225w!\025\036`iqC\2007\202\004J\"\272\237<I<.\363\302`w\235\235\207\341\246n\333\201\355\215\375\006\001!\324\343\325\300\007\224-O\2568l\346\260?.\325d\037\356\356ZKl\24730\r5\255\232\316L\037\300"
+	.string	"\r2\026\314\330-\235tl\214\2702\302\366m\213\330\225\023(\020\261\350\237I)\017\256\002\001\263\273\035?\345(.\017\206Q\217\252_A#@\332\331\204|\227\372\027\0338\035\371MZXX\2505\352\252\035Rj\214\262\305\366\307Mh\230\335Q\307/q\024\013~\210G\207B\362\335\243\037\366p\260\317\025\362\310\256\217\005\"!B\346\361\261(d\327\207\345\001\205,N\001k\0250\220\005\242i \253\372\266\303\325\022'\334<\025\301\241\222\330\316\250fS\316P3z\322\216-OTT\323\025\304\211\024.\240\232`\004\024"
+	.string	"L\204^\325\206\367\263\032p\210\203\200\242\t"
+	.ascii	"\341\002\243\302hb\244\024\206\266\260\260\212\025a`\226y\027"
+	.ascii	"\334\300\0331\202\240UM\256\\\310\262&\024"
+	.text
+	.section	.gnu.lto_failsafeActivate.90.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\026\002-\021"
+	.string	"\026\240qG\320\224M:T\031\251\031\260\007\373\236K$ZJe0h\n\001+5\305%\305\330\232ea\023%\210\332\261B{\\\207\305\325\036-C\002\222\304"
+	.string	"s\t\210\t3\205!\004\342(\253a}we\230\326\b\331\233H\231RZ"
+	.string	"S"
+	.string	"a"
+	.string	";MOA\036\f\331\365\020Ud\233\340\f\023\266Ob\037\350Qy\332G\361\024\261\333v\234\332\035\221#i\367\226\300\b\274C\224\257\342!w\001\361\3201\373\307o\265\355\206\230~\214\236v\367\323\241\307\2361\377EO\321\200x\236\035\204\335u\322\200@\334z\333\006l\267\330\031\024\177\341\242"
+	.string	"\017#\373\323D\333u\0264\253\332\356\256\370*\276\302\306/q\350\027N\236v\350\343\304\303\223\232\020YF\331\004\n\b\021\247M(\3736K%a\237\333\335\265\n\331\267\375%0\255\212\351TL{0\335e:f\032ri\216K\253\2463\3237\t\022h@\0374'\250\327\250\235\221O\020\247p\307\255\024U9\035`\304\347\304,\243\234\252\372\237#\366\204\313p\361v{V|\244'U\260\360\362\022\017S\177DdK\373\002\006}\221\210\231\362\030@\215"
+	.string	"\311\3553D\233\005\223\247\031\245Gy\234HJ:J\324n=\306\016\f\002=B|hq[&\336\240\242\241\301\002\006\016\024\244\230\264`\254\031\n\035Z7\236aRZ1,X\215\213\025\363\351\314\310\270jb\276\033\027\313\346\203\311\201})'~qh\345|:\257W\316Gr\223]\205\354\302\324$\323\231U\212\203eU[:\315)\245\252\037\026=M\351}\202:\365T\217\"\374\006\213g\243\323\025\221M\206\264\024\325n\271R' \200\202\031:\273\001\204[(\335b\373\234A\201\236\002\235\270\016\312\260l<\374^\302*\021\237\362eu\201\237XK%\3426qGH\216\021\327"
+	.ascii	"\254#P\0138\232\263\331\301[;\261\020?\031\346!\266\t\345\210"
+	.ascii	"ou6\214k\221\370\0303\227\001\222\035\307\272F\003^^\264\213"
+	.ascii	"\f"
+	.text
+	.section	.gnu.lto_failsafeUpdateRcCommandValues.91.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\316"
+	.string	"\025\f"
+	.string	"\346\327VD\020q\224\016\303\230X\303\2407\352\001t\242\377\246\036Sf\365p\210#\303WD\024N\354\026$\026\021\"(f(\027\346\345\323)\366\277\017"
+	.string	"\200H\021\037&\345\321\227R\372>\321\274\343\036\224\337n\"eJ\001?"
+	.string	"D"
+	.string	"B"
+	.string	"~\ngo\314\3314\016\232\354W\\2\240p\331]MCp\311\035\323\344\374\214H\343}\335\261\314\303\025|\222|#\030gw\217\362\324\360\211dfD\273\353\364\276\016w\274m\007\266\033\330\017\005' \254%\366]\267>\375\f\200\034.\030\274v7\2048\226%\262\030q\327o\277#\003\364\022O\331tf\200\354\203>\211\267\270\273\334\"\3538d)V^j\354\256\347\321\006\262G\316\007`\036\261\007\300<>\024Vy\317\252\335\rvw\313\311\207\025\252,\037\004s%\251\304\030\311\033\266+\374\004H\266\273\t|\023W\261\340\213x4\206\217\274\367\350\177(\001\030\255\220\f\235/\033/6_l\260Ke\331\277\212\2266! )8\020Z"
+	.string	"\372\b\270`\332\324\245\317\t5Zul#\224\346\001\341\301\326\201\322$l\243\bZI\265\322>\005\234\232pRi\036\251\224J\333\200{-Ay\366\nYBT\004S\226\017^c\022\266\322sU\022;K;\r"
+	.ascii	"\237\271E\246m?\303)8d\001o\265\361\326\023f\331s\301\235,v\007"
+	.ascii	"\227\t\030\360\250\221\375\241\224\001"
+	.text
+	.section	.gnu.lto_failsafeApplyControlInput.92.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\356\013\025="
+	.ascii	"\352i\350\026>@\246N\007\321;\275\177gX,\027\252\322\013\316"
+	.ascii	"\275U\244\204\254b\004\023G\tC[\001\nfG\355\361\211\321/\332"
+	.ascii	"i\277\271\023\207\237\350G0\204\034\276\037\220\333\215\020C"
+	.ascii	"\330\3362\245\224\002\\\001L\001Y\001\326:\377;\373;\267\205"
+	.ascii	"\250/{:\004\336k\244P\322\325\223B\261\264_7\232n\274~\346\316"
+	.ascii	"j\363\307\305,7~|}TJ\f;\315\312\243\300\235\307\335\307\305\254"
+	.ascii	"\2753\315\2676\032\2063$[\016\323\3641!1\354\364\312v\224\252"
+	.ascii	"\247\210\317Q\227a.r\217\316\343\bo\370\276\334{\213\235r\223"
+	.ascii	"\351\301\\\354\324\366\223\213Y[(\364\230\276[\033\317\307\360"
+	.ascii	"\266!\2469\207\030\272\367.\350\224\267\206\235r^K\251\235\016"
+	.ascii	";J\355te\036\354\274\346\355>!i{\216\356\275]/\305Z\033\305\337"
+	.ascii	"6\2579\375\265\241\242\234\232\216L\306\342\022q\250\246\366"
+	.ascii	"\351\221\276r\033P\363G\271F\326P\326\350\307NIG\227S\254\027"
+	.ascii	"\334\237\237\376k,-\3137\217\212\302F\245\235\234s\0165\021\375"
+	.ascii	"\352"
+	.string	"\216J_lr\315\244e)\027]\306\271q\204\363Y\264\022.\240\301\216.\227X\245B76\306\322\262d\342KJ_\177\375\301\211\345\020\035[\263\211M\224\300\251Nt\313\246\035\252\326\351\336{\\C\263\r\372\316<]\252kk\333eT\372\251\237\215E\307\346\354\037\2665\322*0\344\206QG\227U\254\224\221+\312~\266\253\255\231\271+}\335{\331\225kl\315R\315\334h\314L\203y\251P}\3069|\342\333=\006\315\207\204\357E\253\240hBC%\2241z\264\364\3144\211*\3753\t\240y\357\225\360\204\224\210\254\334\276\372\314\0316x+\225\376\n\310\223q\372\352?!\232!\016m\207\0047\235\256\343\201A\210\360V\212P;M\277\367\004\361\376\355?a\332\2442/\334j9$\\\257y\357\231\004\346\022\035xbx\357\031\2048\353\033\212\036\004\250\312\013\265\323\377~6\202 P\276\310\335A\313"
+	.string	"\373M\n\025+V\250\235z}\017v\231\346\020Gw=\322\023\034\277%\021.\211\214\3208\254>Y\326\376\231\334\315zj\004\237H\026\252\277\0133\201\316\034\022;5\013\265\337\277\323\336\314\274\220\271\3274\033\026\334U\270\005\230\267\022L\355\264\177J\360\255\314\013\031J\211C\341\242\327#1\347\231\3713\231\233\375\330\301\265\341\207\302\\\201\311y\302\321\331k\353\350\254u\200\311\031\253\375\232\257\032M\263\225u.\220:W\031\235\251\2543\201\242\363\200%g\001\3269"
+	.string	"\321\031\200u\236\":KYg\244\352\034\245:C\251\316O\326\331)un\032:\037\225\234\231\254\263Qu.Z\347\245\324\231h\235\207\326YIuV\255s\232:\007\227\254\345\270W!j\247\216\274iN+Z>\204\231\007\273\345\206\315\273\274yW\313k\016\210OZ\361\\\271\252u`\223\210\013Y\2154_\223Cx\220u-A\247\354h\236\266\036\261m\253\233\352\246v:\340;\320\t\205\363\263u\311\360\336\013\201\275\314\315\3268^\233\254N\234\250\235\nx\b\177s\242\017\367\347\247n\030"
+	.string	"\300\007(\234\004\240\237\335C\240O\365\231LTb\267>\235\202\\\320V\257\306V\237\3016\242\263\372\2572\217\324\316\346\205I\230>\363\033M_\225y$\336j\253\337\372F\223\313\202\202\341N\252\314\374\325\317d\225USQ\367u\027\201\212\371V#8\346\316>\223\375\027t\377\365\360Q\033\236\272\240\017\274\032\367\3233\231y\212\313\252Q\"\222\372\251\357\365I?Z\231\216\244\376\201 \236]\024\371\255\214z\344\177\0374<\037\365\277\b\r\321\2267\375\3233\257\316\225\212\267\022\312\351\237\376\t\255\264\242DN\337{\316\34375\241>\264b\3613\200\326\2726\264\332u! ^\271t\241\325\313`\330\n\246\027\335P;\365f8j\247\307\3673\202\320\262@-\350\306*f\275[\357\324N\231\276\027\031\241uF\006\213\210_4.}\361\355\336\372l?}\226>,\203+L\314F"
+	.ascii	"\036ab/\326\034\366\300\205\004/\007\023\032p!\303j\200\321\240"
+	.ascii	"1\226\341\205\2111\035;\300\230\370\005W\022\006X\216\031b`0"
+	.ascii	"\272t\310\210!6"
+	.string	"\003FW\r10\032]/p\344\350\342\252\3421\033I\034]:\306\306pt\025\363\312\372\241\360\t0z\312\336\214}\330{\351.4^\367\263\237\f\225\361B\206z\246V\030\247\n\317\366\351\300_\275\332\325\337\325\267_\267\275\367\336\250\n\337~W_\001\0014P\255\333\t\335\t\320\256\300\225d\225\225~&\207\005\276K\020\212\004\254;\322G\300&M\306\242\235N\252\276\007\356\n\323\204\307z5f*@7,w6\211\366X\365\023>\335K\233\244\301\231\177<\372\021\311[Y\365JwsfO\326\226\211\034 S\f\225\352=j&\020\006\277\272\315Be\376Q\270\222y+\251\276\271\314\235=\031S\001\266\315]\255)\300#\306>j]\214T\320\302\250\244v\222D0\267\325TD\005%\234\2026\232\263\246H\222\3423\371\352_\020\t]\264\354#4\321\022\022\232\207\300\307%\253\232\276\304\231\3700[\201"
+	.string	"Q;\265{p\311\326K\3637\037]\200\356\275\020:u#\360\255\207\204\336q\"\rEG\017\231\023\362\037\361\231\354H\330\333\234\315\032;[\263+\257\0200Y\356\\\021v#<8\274\001\200\357\250a4$\231C4#\"\022$IZh\f\200\002\221\2412r\003\021"
+	.string	"5\251\034#I\223B\241\003\025!)\333\250\306pctY\236\255\022\315d\301\254\312\035S\370\034;\re(FeG\221\231\005a9+\275\357\334\247l"
+	.string	"(j\343\260d\217\004\225\276!]\201M\234b\342_\031-v\314y\2466\356\343\025\225\213S7[\310\311\204\nkfj|\271\211_4\225K\365\256\216\341\325C\213\277l\263\207\262\370\215\303xh\320\231;0\324>v\022\223\217\023,\217\300}>\352\002\333\036\0025\243i\206\007\342#\270Vi\211\261\276\202\311f`oV\016\213/\033\232\034)\235Ku\304\360\254\204\302\026\275la,\365\002\007C\036\237\005A\224R_*\035<v9\301;\336!>m\206\006\206J\267\24686d\027\033e5=\235\013\007\343K\362\311"
+	.string	"\377\242\004\254\221O\355\251\344\324\224X\267\312t'Y\215\2679\265C\311\254\224M0\266M\251M,X/\230\356\310\272gA\021|\201\001\033\366\337C-,\340{\355W\354\244\352\226\b\2269R\376)\334\263C\360\032\027Df\355\006\361k"
+	.ascii	";\352\177\352B3\304B\236\315.q\200e\0323\"\203\260{\035K!\252"
+	.ascii	"\005\202\334\t\334r\370\312\331M\004\227\206\f#\021\210\372\322"
+	.ascii	"\345\221\244\027M\335\217L\235j\346e\233UTWT'{\007\237\016\202"
+	.ascii	"5\307\231\245\227\250\002\bY\374;\"\316a\231\214\311\374\241"
+	.ascii	"&\333D\264\320\356\024\034c+\311\321\305\341\344\264\204\265"
+	.ascii	"Gu\004\350\034\017\236Yh\344\272\3435\232P\357\300\320\t\200"
+	.ascii	"4}\363\224\340\004\275|\366\250\313\360\263AH\204o\236\035gO"
+	.ascii	"$b\223\327\f\370\266\251:\262\343/\330/I\203\212\324K\r"
+	.text
+	.section	.gnu.lto_failsafeIsReceivingRxData.93.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\021"
+	.string	"u\007"
+	.string	"\022\21755`m\322\001\f\255 \004\253\024R/P\212)\231ho\326\033\252'\332\002\2725t\354\240-\374\023=1\336Z!a\b(?\256(d\n2\224G\3246\2212\245\306\\2\227\265i0\353\212\033\206\005LsE\007\314j\210\030m\213\027\213\263\207\214\0267Y\246\305\312\333S\253$\325\201\217\202\374o\225\253*\225\022:\201\362\263\r\361\217-`w\021|\217\233\"\374\214CKp\362\335\241\317\251\034^-%\323'?W\025\233'\266\347I\265\260O\255\222l\2475\323\247\004N%\n\337\256\350CY\022x\322\260}\373\035\035\273\262\301A\307\334=\f\321K#!\020\223]/\352\305\271'\347\237\343\220B$\244\033y\236"
+	.string	"\t\273\353\354F\023\267\3366\201\355\002\333\033\001\007"
+	.ascii	"2\241q\037\330<L8\256\211 C\350p\227M\355$\003"
+	.text
+	.section	.gnu.lto_failsafeOnRxSuspend.94.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\r\007"
+	.string	"\202\31514`m3\006@Y\tA\277GQ\033\270\007\220\030\210zXW\216j\247\264yk\3131z\323\211\023\275\230\267&\035Tt|\205\320h\314\254T\275\232$\2212\245\305\\2\227\265\321`\32659\n\t\230\346\232\f\230\26501\332f^\004\2325d\264\311\3112mV\274\233z\024\311\3563\221\200bD\355N\325:x\243c!\3757\2503\254\361P[X\026\302\003\315Y\326\236\312r \344\004\004O\265t\036&\223C\224\326\373\300X\321\232z\024\265\321\335W*A"
+	.string	"\371'N)\377\344\307E[W\272\265#\366Hw\207\210\004G\351\377\214#o\206[m\f\007p\241\217!\300\301\377B.D\341F\267%h[\320v\024\b"
+	.string	"3\241W\037X"
+	.ascii	"\314=\256\211n!\340\227!\300\245[\264\363\t"
+	.text
+	.section	.gnu.lto_failsafeIsSuspended.95.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375 \375\r\007"
+	.string	"\362\31526@o\222\016@\031\326\272\333\n\24085h\\f2f\317\216\226\363\371D\020\366o\366\254\217\225S\b4\255\377+wuxT\311s\n\310\036a\245\022Q\333'D\246k2\033\354\352p\262\013\213\236\007\207\214\203\305\210\354\202\210\232\255\0233\005k\022\233-z4m\213V\227\205\246\241\201\bZ\374\023%\341\0042s\341\216\364Dq?Z]\361y\035\265\272\037\200V\017\022\250\234D\357eK#_\313w\241\0077\276\230\314\314\241\351\177?8\300\222\322\200\312$\275\270$Je\002\362\367+\002z\353\004\005\320\\\273\016R=R\027%\251\314.B\216r}\334mH1+\250\223Q)\324\027\300\220\231\277Q\t\243\303\376\007?\302\237\021\006"
+	.string	"\n\013\270\211!|\205"
+	.ascii	"\301e`\270s\246v>\001"
+	.text
+	.section	.gnu.lto_failsafeOnRxResume.96.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`y"
+	.string	"]\t"
+	.string	"\246P?< \3458\035\340\325\016|tJ\005\022\"YK\352\240\025\002\314\033"
+	.string	"\345\320B#B|\244`\337zp\240Q9:\207\230\320\006\214\342"
+	.string	"8\240p\330\017 O\020\n\201',\371{\247\024*"
+	.string	"0"
+	.string	"0"
+	.string	"\3667&m\225\257R\373\222"
+	.string	"\021\"\260\335\255\024\343\344'\351\237\343\232\3224\372\314\030\354\256gi\232\270\351m\017\330&\260\317\t\020\242\371\362\231/\322\236\t\264^\244\031\363f\261\342\342\332\371b\257F\223^\330\307,E\331\237~\346\252\023\214\345\240eW\"\006`Y\331\211\206\003$\337\b\247\365\232(\024)\2476\370\020\005\220\314\244ti\246\035:\320o\234Jt\344M\265\017i\366\370\217\320\226\332\335\002\277\343\036\017~\3063\007\366t:\217\033? \347UP\302\007~\274\312"
+	.string	"r\013\325#\216\265\023\340\260\241\023+(\f\305\272Y\3551KQF\250`\221h\311\377\247\331\335\003\021"
+	.ascii	"2\241Gh`\270\020\300&\246\222A\225\t\300,\006\230%!\331\t\\\254"
+	.ascii	"Z~\271r\320\205\334/X\177\031\027\\\272E;\237"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataReceived.97.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\003\001\345\013"
+	.string	"FUNC o\224\016"
+	.string	"\253\301\030\t\264\324\005I|/43\311O4xP\376\264\363M\245I\234\b\372'\215\334!\274\2257oc\030\266\372&\f\021\"\310_d\t\264\201\202\270\315\nr\017\214\016\304odK\231R8"
+	.string	"8"
+	.string	"<"
+	.string	"\030\233\354\024\017W{\020\n\020\270\\\354\256\246\021nz\3244\371\027\215\306\007v\217\r\256\035 *\212\354\3565<\023\200^\346E\263\273\316\017dpg\267}b\233\304\276\201Y\210o\305)c\216i\023(\220\377\256\317"
+	.string	"\301\323\316\371rPb\023\206\035v\251*\373q5e?\035\237\326\247\363\351o|\\ \221\242bwA,\306\3022\021\024l?\252\252\322\032\201\312\027\266\267wpE\275\t\tzU\315Z\034\250\340e\3146\200\267\270\f\016\251&(X\371zp\265C\0179\217\325\356\226\370\254o\030\340Ox\346Q)\363K\226g\001\346d:\236\315\b\264m<\032i\345\263\201<Z\200m\023\3228\242\221\226\t1'\240#\322H\034'\3220\341>\256\246P0\300N\352EU\375c\261;\377\360\001Yy\0309\301\202\343e!w\267SU\305\031"
+	.string	"3\241[)0\207\2678\320\216\035j\035\b\306\2048\2021\3274\215\nV\003"
+	.ascii	"\026YI\r+\314\200\270U\211\326\312\006L\020G\236\241\270&\242"
+	.ascii	"a\202~\031\002\270\374\300(E\325\330\256R\006"
+	.text
+	.section	.gnu.lto_failsafeOnValidDataFailed.98.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\003\001\335\013"
+	.string	"F\025NB\020o\225\016\f/\320\222\036\3500\240v\235P\373e\345\315\024\352K\370\275B\250<\031P',i\244\361\f\316~\222u\026\372>\024\004\200\020\211\211*\330\312rU}\271G\343\002\372*\375O\266\224)\0058"
+	.string	"8"
+	.string	";"
+	.string	"\026\223\354\024\017S\373\017\021\030\264Z\354\256\246\023Nz\324$\371\025\214\306\007v\217\020\256\035\240)\212\354\3563<\033\200^f\005\263\273\316\017|pg\267}b\233\304\276\2021\306\267\242\2241\307\264\021$\310\177\327c\220\340i\347ti0\261\371\302\016\273T\224\375\270z\262\237\216O\353\323\371\3647>D\224\b\240b\327A\f\306\276\262\020\026l?\252*\200E\302\224.lo\347\320\212z\030\005\275\252f\260\005\027\274\214\331&p\026\227\261!\325\004\205*]\253\253\375y\310y\244v\267\304W}u\300\257\360\314\241Q\346\217(\317\002\326\\6\234L\310\263e8\232h@g\363p\264\002[\346\243i@!\355\022b\316\300\006\244\2118\016\244Y\302}\\=\001\030\361*\251\027\025\345\016\305\336\334C\007$\325a\344\004\013\016\027\210\334\335N\025\025\003\031"
+	.string	"3\241[)0\207\2678\320\022\035j\021\210\313\204\f\202\261\3214\345\nV["
+	.ascii	"\337\254\244\206\025f@\334\252Dke\003&\210#\317P\\\023\3210A"
+	.ascii	"\277\f\001\\~`\224\242jlW)\003"
+	.text
+	.section	.gnu.lto_failsafeCheckStickMotion.99.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\272\003\365\030"
+	.string	"v/\244I\240\330M:$G\204\037\367\031\372\214\321\250\270\300\3525CB\211~\003\336\2702\t\214\227g\305I)J\372\263>\314<\341\013.\252xX\003\352yb\350s<\371In\022\277h\005~8\270\2347\321\356\321\b\331D\312\224\002\216"
+	.string	"\202"
+	.string	"\217"
+	.string	"5|\236c5\037\225\177\237%\346Ed=\211\272\232sJx]\326`\350\3703\374\321\261\313Z\f\235\323\370T\321w ^G$^9\252^\\\3159\032\270\364\201\327\345\315i\341%x"
+	.ascii	"\341\345\332Ev\314\n\032\024\331\350\343\212&\221\251\205ROk"
+	.ascii	"\316\321\266*ntp\325\310?:(\356\3149?~\300\317\boI\016'\023_"
+	.ascii	"\260\300\225\017*.NI \255\311\305\322\245\256LN:Uqg\316i]r*q"
+	.ascii	"\313\333\216`\233\307\006\301\362\033\240\311\024\222v\371R\207"
+	.ascii	"Y\025I2\225\313\036u\272)\354\203s\316\351\205\262\255\256\241"
+	.ascii	"\221\352\231\373n\231\357\356\030\251\246\275w\317\244\032\346"
+	.ascii	"T\367\213\325-\241Z\266\352X\250\206I5\013\250~\205jQ\252CP-"
+	.ascii	"C5(\325\013\252u\325\017\360\250'-)\026\242\314\331\324Ue\"\221"
+	.ascii	"?^\334\367\367~\252\177w\320~m\t\016\307jL|YUR\026~6\034\253"
+	.ascii	"\021\351m1\311\240\300\323\361\003\233\203\025d\266\357\375\346"
+	.ascii	"\307\303\235\255\200\236\334\360r\305)6\260\222\200\373\335/"
+	.ascii	"<\301,\270\037O\373)]yY\230\315Q\022B+\006\344eO\365\233\034"
+	.ascii	"\324\375\013w_\326\306J\210\023:\355\262\356\356\225\256\270"
+	.ascii	"\250O \264\1772\350\227tE)OI{\344\363.\243P\310\254\246\034D"
+	.ascii	"\370\335+<!)\227?\376#\254\216|\305\326U\217\335\020~{xN\222"
+	.ascii	"t\313v\320wlx\315\231\344\300\257\272\016\016~\213K\343>\350"
+	.ascii	"\227.\375\017\341\003\n\210zn<2\001\002\242\236\033\2174\206"
+	.ascii	"\006=9\013\030\350 \300\231\335rB?\017|&\b\335r\270\234\314>"
+	.ascii	"8?@7\"\241\240\033\220-\247!C\220\020\220\255C\320\215\203\315"
+	.ascii	"g\210\310\206cc\234\207\237![\016\207\033\262\215H_(\bO|7x\350"
+	.ascii	"o\024~<\314\326l\3132\331nY\357 \255\016\244Y\331\326\354BQ\222"
+	.ascii	"\241[\331~\210\220\3302`1%\263\342\242\201-\315\314\302dvfs~"
+	.ascii	";\231\275\217ee\326\006\353\265,\372Z\361\b\216\254\230\033q"
+	.ascii	"\301\215Y\305\242\2558[ZD\250ADD\025r\204\242\221Pd\202\030\244"
+	.ascii	"\003\360\002\0211\253\003\020P\307dV\215\001\222\025\035C\250"
+	.ascii	"}\0369~\321$\030%\001\367\345\265\223\315\236\255\374\210W\361"
+	.ascii	"\353\360\357\367\206D\016\271a\n\364\360\340\256J\224P\354\253"
+	.ascii	"\003+\031\017\376@\333\271\345\036\2357\177\030\303%\257\266"
+	.ascii	"\037\037\t*0\257\202\316cL\367\222r\340\347Y\324\214A\311\317"
+	.ascii	"\231\223\007\325s\353j\261\013\267FMlv\232\352G\322K\266\314"
+	.ascii	"4\322\0247\326?"
+	.text
+	.section	.gnu.lto_failsafeChooseFailsafeProcedure.100.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\030\003\315\026"
+	.string	"\006\351\221K\260\022R:\253*\017\246_\322\2501\210nn@\270\270A\325k\376\207\215p\026z\005\001_\326\322\267Cg\213\332\257\263>\370\323gP\031NYGg\313\f\372\017R\356\027tV?\357\360\303\035+T\343\337X\373\311&DJ\231\002\202"
+	.string	"k"
+	.string	"\177"
+	.string	"1\317\221E\237`\310oE\317\210G\255\305\031\311\212\320-\311\225\321-\273gs\353j\261LZ\222\315\271\257\314\272B~S\255\330/\312\312\203\215\316\262H\023\244`\022,\004\325p\207@\0346{L\311\0047Z\350\020\251\t\362\235\301\031.\235\2009gp\003\223\244\t\r\223\360\f\362HX\216\0173\326\t\250\303\r \310#Ij\255K\\\376\005w\314\346I\255\365\354\013\332\354\317\375?\364_\301\337\007\002>\036\240\356\215nso\017g\307\307\177Kl\361\366\005z\006\034\257o\313/\216n\271=\362\203\243\343\343\227\270.#\007\247\312?\376\342\216[\370/Y\233\347?_v~\354|X\311\177\225\374\223\371.\346\267\232\317b\276\311|\312\374\222\344\223\315o\3463\363W\300"
+	.ascii	"\0316$T\325Zs\004R\233J%\020\377c\376\363;\264$\002\355\023\264"
+	.ascii	"\243HJ\306[\367F\377\b\023x}\254~\031\211M\274\226\271\212\036"
+	.ascii	"\232)\332\302\233M\273\304\252\210\006\331f\323 \275+\335\323"
+	.ascii	"\336h\331\264wf\310\202\002\256l\023\212\252\307\356S\316\020"
+	.ascii	"\251\254Q\262Sh\213TKA\366\310\017\033\205\032\305\020\352\206"
+	.ascii	"l\341W\003\355f\252_e\217XX\265\362\026|M\254\221\355\013\264"
+	.ascii	"\345-\270\2704\203(\"\035\037\271\326*\323\277Q\356\224\")\036"
+	.ascii	"\007\257\225\250\254\320p-6\332\312\f\246\002\213\255eev\301"
+	.ascii	"Fs\231\325^p\263\222\221\3370\250\274\314`n\267\227\331Y\324"
+	.ascii	"-Y\233\347kELj\311\232w\210\035X\261^\342\266v\204\256\2727G"
+	.ascii	"a\375\373\017\353\237\350z\347z\265\314\3012\241\304x5\001\246"
+	.ascii	".\026\2015Zg\307z\377`a\240\2748\273\300\017\321\313\270d\342"
+	.ascii	"p1\202\265\264\256n\020\325\213\200\266\332\245\004\241\325!"
+	.ascii	"7UB\006\226\216D\230-<\261\254\016? \240\002\021\241[\017\330"
+	.ascii	"\021Z\224S(YZQ\033\f\220\324n\344\254\351\217y\005\244$\271\032"
+	.ascii	"[V\025Ld\362\"\262\037\277\354\204N\246\322T\230\034\001\320"
+	.ascii	"q\331\003\017\215\245\275;\202A1\321J\037\337\316\351v\354\255"
+	.ascii	"\223\230\371k\n\r\325\256\330*\320Z#\204\342FHrY\f\324:\274&"
+	.ascii	"\2071\"\247\3407\303.\216\275Df\327\2611N:Ztk#\303\r\206\324"
+	.ascii	"\341\332D\345:\354\224Z\213\022En}O\324\f\300\272\261\265F\017"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.101.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`Z\0025\024"
+	.string	"\026\244\206I\320R\2471\252\310\0074\246VA\252\032\241'\212\020\210\220\377\307\304@isk\022\364\034\272\035s\212\037Xl\001P'j/?\016!\t\n\rz$e\363J\330U\364E\307.\236\220\263\r\fpY\243\354\266D\356-S\nm"
+	.string	"r"
+	.string	"q"
+	.string	"uv\024\330\253x\001\260\327\024\"\017\3547y\205e\367\236\317\214w^\242\225\254`/x\357\211\340\325\tb\257\336\331>~.\335\267\370\321a*x\357\245\205%vt\367*\206t\347\223\230\274\327\030\210\213&f\220\314\024\242\241x\340h\306\007\231\t$\242\330 \321\343\276S\017\246\020\245#.\367^\323!\323\350\206\335\366\214m#\233\342\002\026a0\2443\270u\301w/\321\327\220[\243Z1\331\276_u\340\316\251\\\262T\265c\377g\313\314s*K`\302q\324\273\367\312^}\026<\266\354\225\372T;\277\351P\227\372\324}\226\245"
+	.ascii	"}+\2622\310\230R\3213\343\235\005hh\365R\330\344\220\212\352"
+	.ascii	"\211]\024#>\036_Z\026b\257)[P\276\323\237v?9\314\202\316kV\310"
+	.ascii	":'\304\036\364C\016C^\313\222\027\226\030*Y\275\236\374~\266"
+	.ascii	"\371U\214\372\273L\220\031\244\333\305\345+\023W\"B\373\300\304"
+	.ascii	"\360\276\007\210*2"
+	.string	"\202\013kG\020\365\362\201\3069\f\237\330\275\267\201\357\342/F\377DI?T\302\006\350p\372\241_>\3601!n\\*D\334*\nr\335\367\231\247\242. \227\n\261O \032*\331?O\351\311t\230d\237\272\236\006\3666\302D\320\2151\267\234\227\232\256\006a\003\205\234\265Y\322\300\315\342\220\265\212\313\311i\030a,\371R\332\330r\272\022\200\275\2150\244\325\261\226\206\3047\026\232\226\005\f\034(P9\261\272\232N\246,\255m$u,ib\233\212\255\251\2257\271Z\rM\207\001\227\273\251\241\345\344j84\033Y\322T\bx\324\261$M7\216$Mv\376<L\262\313O\btTK\250\215\313\0050 \300\002\221:z)\362\307\314B\365-\224Y\254\017\251\272\304\256\302\002\275\237\325\3148Z\354Vl\314L\212(\2611\240\315jP\341\211{N\343\201\t\002\330\2019&\326\364C;\ru\314\331\341"
+	.ascii	"\tI\226=@0W\030\247\030!\342r\321<\2421\233\250\322\020\332\013"
+	.ascii	"\312\n#\275\336\240I\376\355\3250\267\215*A@\001"
+	.text
+	.section	.gnu.lto_failsafeUpdateRcCommandValues.part.0.140.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\236\001\005\020"
+	.string	"\366\236kG\340\260*\035\300\030\023.\267=\302C\f\316\275Wi\030\036}\220\004\n\245\001\036H\2110\035\340U\355\314\353\313\273\272s\302i\317*l)\037\230a\206\371\002?@\212\317\253\346\351\2119\b\216\344\n\203\204\221M\344N)T"
+	.string	"T"
+	.string	"Y"
+	.string	")\273\343\323Tv\347\363$l\247\\V\3313^\233\355o7\027P\334\354\256\370\251 \374\375\253\335*U\377TN\225\177\332;Z/\227\177\037\200\235\f\207"
+	.string	"/\3267\002\303\355n\273\204y\255\244z\304h\270\364|r\224\354\256\303\r7x\333#\333\f\354\333\004Sc;\031X\013k\314\376(-?\336\347\360(\310\331\315\320\313Y\017\263f\304\307\337\276?\276\204os\307)\177X\265}\271@b\204>\236\346\317\200\310\b\331\237\361M\274\246\372\t\353B\027WHs\343\321\330\335\220O\213\204\237\237\017"
+	.string	"?\277{\300\317\373\264\343?+\311\263\310\257\252\267\320\341E\366L gC*\013\024hf\b\307\261|\314v\367"
+	.string	"\315W\244\230TT\300OP\327\252a\273\302U\240\302\335%\361S\374\306\342\213\370\364\204\026\371\326\247\337\002~JM"
+	.string	"\243f%{\276\355\307\220\273\361b%\317z\205\341v1Re\326\036\031h@2R"
+	.ascii	"A\b$\200\302\250\2446\001\235\220D(\224\222\210$\256<pPB!\211"
+	.ascii	"\021J\242\024\321\344\204\022A\0376I89\211+&\323I\354\330\226"
+	.ascii	"\327\230O{\230\353\271X\351\313\2472\317\0203\344\0358R\365\n"
+	.ascii	"c\035x]`\303\2228_\357\303\265d\365\355\356\252\312l\253>  @"
+	.ascii	"\002\242\230\265\0333n\330\035\222+\240\360O\026o\203`\307\320"
+	.ascii	"\004\226>pO}o\247\341O\210\317y#K\f\fK6\342\354\261\343\2401"
+	.ascii	"\001\226\240\225x\005\003w0 \020&\r\320\232\262d hM\361\215\273"
+	.ascii	">m\256\023\375\2569\006"
+	.text
+	.section	.gnu.lto_failsafeUpdateState.part.0.154.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\001$U\216"
+	.string	"\272\321 /L0\216\342\031\003V6\301r"
+	.string	"\370X\f\007\334E\212'\337\025\223\314\255\360\217@\302\217\364\370j\202\207\202o\030\344\365}\346\233\373\b\200\357w\001"
+	.string	"P"
+	.string	"\335J\267\322\331Ke\224\251\rVi\361\362]\240qA:\235MBvJ)\005\365\002\233\002\351\002\335N\272\2734\031\026rz\212-\244wb8\006\362E\033{\030\244\250\2668\006\320\330{\211R\245s'\030\031\274\"+L\2041$\024A\261\273\246/\215\b\203W"
+	.ascii	"\335\265\335\240\331aX\266\026\325I\276[\3320\367\241!\267\027"
+	.ascii	"\022v\216]\250\\\303\2450\006;9\320\300\352.\355\204\233\013"
+	.ascii	"\0072.\205\\\216S|,\247M"
+	.string	"\310\242\245|\3236e1\330[Z\264\224\0250\362\302`\013\346\232,\255e\253\245\314\302\310\2305\272,[!\270TYTr\261\"w\345\217D\034]\3731\327pWK\271\253<!y\366\275z/r\210\340b\022\017,\245w_WSq\201\274{\317z\261\356\356\t\307\222\257\213\031FK\031\307\005\274\352\032\335\f\267\023\031\334{\375\244\241t\224\226\3025zyT\0312d\264\023\227\333\256[h&\215\327z\\\323I\244(zyT\027X\360\232xp\364uW4X\245\223cQ\310d\211\007\3137\252\314;\274V-Xv\022)L\013\334J\372\316m\026@8\022\273{\317$\240\3369\260\354\344Q\367\260\235D\366\016\333I\244G,\346\266c)*\267\353b\034}\335\275fR\324E\272\305\367\275k\352$;-;\331I\230Y\206\223]f\304\276k{\373\t\230f\223\305\367}\243:\371'\360\214\273\035"
+	.string	"\t"
+	.string	"\260F\\YU1\251\246DH\205"
+	.string	"\021\005\365\344\324\304\264\364A\311CR\007\016H\033\216\214\212\210\206\204\2024"
+	.string	"\375\370\364\360\354\350\344d\300ioljhf\226J6\211|/\341r\323\234}u"
+	.string	"e\232D\231G\007\300g\334Hk,\244r\314\254HO\235\216H+\306*\225\206s6\372\b\0166\246\320\315]YU1\202q&#\242S-~\361)\004\200\220]\241\263\212\220\na\350\305AP;\212:\350P\202\375$\250\305\235\232\030\003\235\311k\312\2222\313\037\365\350\346~\334"
+	.string	"\354\017W"
+	.ascii	"\331\036\024\374\204\364\017'\226W\222\266\007)\362\210*\305"
+	.ascii	"\223:D\201\342\034\220\326\340\234{\276!\355\b\247\314\350\311"
+	.ascii	"\361\255\210H\231\205dD\254\326\365\220\022;:6\203S\017)\024"
+	.ascii	"\244a\352L2\347@?>\312\254\0377\214tO\021\"\316\303\330;\354"
+	.ascii	"\332\241\036\235\365\307\215\025ZGH\016\n\236\301\255\315q\030"
+	.ascii	"\273\205s\256M\235l~\263\341\307\r\037m\323S\247\0178g\017\257"
+	.ascii	"A2U\371b\350\251s\b\262\307\254\bYK\351\rpN5\247\261\302p\230"
+	.ascii	"\345\211\0239\036\254\322F\217\271\376\341d\234\231\361\264^"
+	.ascii	"\242\265\262\205s\2429\333\264q6\303\223K\035\215\2549\023C\036"
+	.ascii	"\275\357\333\236\215\371#E\214-\366h\317\304\2206\214\315\027"
+	.ascii	"ZJ{\331Y\230\273N\227Pf\275\357\313\rvm\316jf\344\021ff\302l"
+	.ascii	"\344\025\\\212T\261q\211\2605\337\323%\206\037\234\333}c\231"
+	.ascii	"\335#n\2347Y\315w\234\017 \337\364\325\231\226\201\326<\224\375"
+	.ascii	"\206\343\001\254\233\2768\272\245t\262o\312b\365\313\037\371"
+	.ascii	"\333*\fa\036\rV\3253rI\365\314/\213\262\277)\215\324\270\033"
+	.ascii	"\302N\204\025B"
+	.string	"FmcwK\236\320cOcK\020v(\022\310\225\372d/\341\331\032{\260\373p5\306;4\366\264&\341\371\345\n\235\334\373|\227r\260\353`\304e\273s,\216e\333\353\\:\360\032R\351\344\374\214\231\021\237//\372\325k\314\356t\262w\211M\341\345\341e\220\270\rw\316k\320\274\221\233\235V\337\335\325\205\r`\334\264\247\317iM|\200o\321\232\310\374\254\376\353\365Jf\346\241\334n|6\224\336lg\277A`\251|x\244m\001[2\255e!S~\020v\261\236yO\\\266\tv\37134\226\037B\nC\326\352\320\206r\324\275\261\017eG65\006\207\217M\351;\365\177YS\377\243p@\022\270A`{\257'x:\340\231\362\373\t\2223\273u\256\022o2\345\3178\255\321\260\377b\377\273J}\214\313\003\020\270M@\351\022O\2606\301&\237\375n\242\205\371\225\331\277\034\314\004\367\020\026\200"
+	.string	"\002\330N&\337\243kD\320\374\357\021\371\035\245\217\300\274\221\377\221\337\217\3152\237\374\226\222\246\300\005\371P\216\301\372\333\224Y\342e\310u\372"
+	.ascii	"\2269\201\005\274\311\374\331\277\247\330\177\361w\315\2212\353"
+	.ascii	"?\224\271\037`\373[J{\032\343\265\0041\204\206b\316\310\255\205"
+	.ascii	"\033\350\306\007\226\357\3732\271\255\315\030\001\367\220N\362"
+	.ascii	"\004\025x\223U\300v\262\237\310\315\016\314\257\334Z:\202)\323"
+	.ascii	"\327\033\223j[\026\305\264\224\236@\311\024k\342\353\215\376"
+	.ascii	"P\376\022Vm\214\204\374A\230\261F\\YU1\251z\257y\252\2354\213"
+	.ascii	"h\235\245Z\347\0207\316 n\234\243r\234\241Z\347\247\326\331\251"
+	.ascii	"unj\235\231Z\347\245\326\371\203;+\265\316\036Z\347\244\326\271"
+	.ascii	"C\353\314\241uFj\2357\264\316G\356l\344\316E\356L4\344\316B;"
+	.ascii	"\316A\356\254\301\235\201t\234\177Zg\237\326\271\247u\346i\235"
+	.ascii	"wr\234uZ\347\234\3269\303\2153\316\215s\233\343|\323:\333dp\256"
+	.ascii	"\301q\246i\235gZ\347e?iV\266\316l\353\234\354(\315\310\033\347"
+	.ascii	"wg\267q\356\376B\2769\342\254\275\257\331\325\361}&\251\030\351"
+	.ascii	"(\335P\272\237t\357\005f\206M\351\222;\266\177\350\353\023\217"
+	.ascii	"f\236R_\373\352\313\210\206^\350\211\036\251\245\231#\314\257"
+	.ascii	"B\217TlR\t\363k\357\030\304r\365\355\244\375\273K{\2639\353\313"
+	.ascii	"\037\231\036\237sO*A\214\246\030\266b\343!\273:\376\354\235\207"
+	.ascii	"^\234\332m\330GFv\212\203ub=4\210d\313\322C\033\235\356\330l"
+	.ascii	"\317\301\267\262\356Bk\325\nX\202\013\037\036\032\201\231^S\352"
+	.ascii	"\341\277\232\221I\314\267\372\262\037\201\277\206\327\227/3\223"
+	.ascii	"F_\004~\032\214\030@t\255\207\327\027\266\371c\210/\306\\\217"
+	.ascii	"W\350\026\203\036\351e\330\2000^b\274\311\202>\306\263\343\254"
+	.ascii	"Q\245\323\032\005\363\3067k\233\225\022rh\360\314\003\265g\342"
+	.ascii	"\310T\255\211I\017ul\353\277\327\242\030\024\005\025;h\320 \206"
+	.ascii	"\255a\220\341\360\320\030l\332\323G\360\257\221Q\320\017\351"
+	.ascii	"\241@\312G>\320\263\217M4\036\301>\265\206\241\370Z\253\033\340"
+	.ascii	"z\274\275\320C\202jG;\006\260z5\206\345x\n\342@\354\241\300\253"
+	.ascii	"QQ\240\225\257\025\307\b\305\320\246x\330C\201a\212\230\020K"
+	.ascii	"\033\034\221P\226 E\201\201]Z\310\312\226/\177\2742\350d\b\f"
+	.ascii	"{\325\005\213x\215\302\300\276\307\210\313\303\305(\225\335\320"
+	.ascii	"E\027v\262\267\306a\264\220\231\021\225yh/<\235\347\265a\244"
+	.ascii	"F\365}\376|\322\313\260P\225\2768-\257\265\n\3467u\301\257\312"
+	.ascii	"\317w\237\tg\366\272\272_\336d?\177\024\026\310'\204\325\302"
+	.ascii	"\227*AQAwN\213S\022\r\201s\323\227\204n\003\221l\001z(\240\253"
+	.ascii	"\226\204\205\351\023\3106\375q+aBh>$\034\371\266\333\244\341"
+	.ascii	"\226\r\005\352\230\3564\341\370z:\016\213\323\232\350\301F\341"
+	.ascii	"\017\236\207rWq\347\372\246\212"
+	.string	""
+	.string	"\311$\237;V\330\371\221kW\255\206Oq\325\236\244\235G\035\023\224h\345\336\326\314\356\231\213\303\233\214\217\202\252Vf\024\375\252\326*\230\223\356+\354\352p(.z\332\236$\031\366\270\3224\322\270\351_/\3074\276V1\355\202m+E\200\203J7\303?\235\207\372<N\fK\274\274m\202\355y\237<\227\004\002z\336\245\270\321\334\rQ\314\341\371\235\267I\\\"\330\304U[2\341\371\206a\347Y\276g\030\022\207\ts\031\\6V\347;\361N\211\216\013\306E\261\f\001b\261\331{\317p\200\032\035\347\332\207\262\027\037\300\277\233\234gv\323\274\316USj\243SF!K\314\3606\237\363@\2053\326p>\303\013\315~l\3738_T8\003\356\346\333o\037>\347\262-\337W\214\311\216\304\345\334\022\\ .\324\205\262\235\274\371\"qA\326\352h\024\177"
+	.string	"v\347 BeG\235\030'gv\335\\!\336d6\337d\236C\200}\3237\234\201\n-\025\033\234P \203\027\\3Z\\0T\314\024\360b\213\001\025\033\2308\361\342\304"
+	.ascii	"\037@\260B+\205\026\327\006\025Z-\270N$1\330`E\007[\013hq\231"
+	.ascii	"\350b\221b\305\213.\034-\025[\013piq\240\245\205\202\206UP\241"
+	.ascii	"\260\0221u\005\002\212G\353\305\211\027\021tui\245\330\342\342"
+	.ascii	"@\213\253\345\024PZ\027\234\350\322`\305\211\013\242^d\200\301"
+	.ascii	"\n\r.\210\332`\305\211\026Q)\270\272\242\240\210x\213\003-\256"
+	.ascii	"\250\027[[\\Q5\375A8\013\354\303\002`\t|\n\213W\240\036\241\342"
+	.ascii	"t\217\221\216\004rD\325O}\2317{\352Q8\036[\025\200\317\373\033"
+	.ascii	"\273\201\365A\330\237o\206M\351\225U_\333\253ozMi\025\263\257"
+	.ascii	"T4\3217\264\246T*\304\210ojS`\006\246)mr\307f$\323\325\357\230"
+	.ascii	"\3215\245\035\210\334\261u\314z4\245A?}m\237\032uM\351N\333W"
+	.ascii	"\006f\312\370\212\371l\305|\256b>3\231\317T\314g)\254\347\020"
+	.ascii	"X\317MV\317LV\317\035\230\317D\314\347 \346\363\017\363y\207"
+	.ascii	"\371\3342\237\2213\314\257\022\361\002\344T\t\007\253\276\367"
+	.ascii	"D\270\2639k\204\217g\n*<x>\336@@<\265\252\226\277\022\343O\251"
+	.ascii	"\255.\207\237;W\305\003a\222\251\324Sq\325\214\236\217\r\361"
+	.ascii	"O/\365J\020\037\302W\350\250\007\361D\2053\340\240>\352\245/"
+	.ascii	"\005\352\217\270\200W\225>}\377\351\021\316\031\351\246\022\276"
+	.ascii	"]9\375\023W-\351\367\232\236\351\235\036\250P\357\363\232\276"
+	.ascii	"\375\f\231|\360\322\356\254\211VO%<\213>\223_r]b\001\347z-sm"
+	.ascii	"\023\354\207_\262\373\360Onh\324\351c\216\2152\271*\245\357D"
+	.ascii	"Vz\031zSE\rL\n\235\314\207\262\207O\022\\\301U[\316\375T\322"
+	.ascii	"w\205\241\032\024\322M\235\006n\231\212\362\340\351x2{\r\276"
+	.ascii	"\n1\342\236\372\206\034q\347\214\340<\360uxf/\027>\352\252\031"
+	.ascii	"\031a\277px\244\357\360@Mf\254\021\371!\034\276\245\206H\337"
+	.ascii	"\203(\354\030p\266\275\nYf\257.^\206u\033\376\204&K\354\243\337"
+	.ascii	"\360\335\314\361\320\2437rC\323\233&\361\023\272\305\303q'\342"
+	.ascii	"\r\210;\367\303\211mG?]5\266\022>\230\374P\360\223\302a\201\t"
+	.ascii	"\222%!\036\032d\306\231]\024\024\363\261\214\274"
+	.string	"\016\215\336\202g\330\177\351\350M\325\246X\337{ \036\372u\206w\026\265&FE\337DhJ\237j\360hJ\235\372\332#\276\254s\340\235=G|;\201\232\236}\217W\033\274\016\311\205!|**\032|\234\002Y*^\2478\275\r\266\245\271sJhP\3241C\203Z\242\257\303US\372\034M\250c\300\036\247,&6=\224\227\372\332;`\2564\245\037\334\261[#{M\351\320\2275\265+\b\203\024\250\00215\320J\305\220\314\210\210$IR\350\362\n\020\006Ca\234\345\326\016\022`S=\n\204\020*)\021\221\202\024%\205\264\006\234\007\024\314\006E\322v2\306\326\203z:\006\326\375\345\224n\032fw\202IV)=\271|\231\253b]\035\313\271\304\336\203.\366\224\2027@\3276\022\201*H$\316\031\0275\342\261\030a\225\373\343\275\342\306\020\361T\343\333j\225U\302\230\360\330\005T\345\352\256\3712"
+	.string	"\214\300^\216\334\337\203\247\025\027\350M\202\312~\310\252\270a'\201\213\272\257X\266\354\3032\264\244p\270\247\217\202\027d\205\324\213\231\207\300\302Z\3544\207$\034:\344\027\223\255#\341\362\333M\320\206\002X\277o\210\374{\002u\341\2360\214\207B\311=\321=\340=\371\300u8\215!1\213\215\365\242M\241&H\020\367\336\232\237@o\235\273\244\024r)\360@\020%\375\246\211\036\b\037&\2442N\007#\247f\004\232\326\347\274\332"
+	.string	"\037\304l\032\270\370\263=\373\213JZyt\257,A\354v\337\311n\266\250\352c\005\233~\001\227V\004\341\345\226\302\201P\275\352\331N\006!=\013VA\2562\320\316W\252\334\361\240]\333\n\303"
+	.string	"4\034z\376\304@\315{\024r\234\277;\275\325\203\270N\332\267\b\246\371\304\241\\3\0227\033Rb"
+	.string	"\347J\013|\326\330!\354*E\320\036D\205g\033a\372\232p\332\315\201D\305\377\026\323\354\2179T\330\034"
+	.string	"9\210T\242\256[i}\260=\246\013\263\246\345\252T!\032j\216\3603\274\356\222\030\370\255\202-\037\2348\222\357\236aq\017\034\316\351\352\277\3723X\023\340~\203\260\335\315\333\225\212\226R}\326\314@!\3534\017\033\033^'\317Nc\340\032\037\206\227\214\340\264L\013\032\364\004\022-o\237Vl\2458V\264 \236\324\263Q\213LjJoG\351\243\224`\034"
+	.string	"\375\247\221\201\024\322r\2177\004,\213V.\0026L#\213\200P6\322)"
+	.ascii	"\304\306\024'\035\217\0174\267.:\257gW['d;\223\202\265\373\023"
+	.ascii	"m\316\026`"
+	.string	"\344\025]\004\354`,\005\355\035D\303\273\317sU\332\336fd\373<\370\375\263\241\254\275 aw\206\320\351B6\032m\001\3051|\r\303by\033As_\fm\352\354\305\321l\330\305\200\307\321v \037J\017Y\220\371\2348\035\240\031 ?H\223G`\313\n~\034\236\270\233)\006\374\316\320\202W\376\225\376\360\005oRY\360\374sX\364\"Q]8\024?i\346M-\351U)\277.\022\225\326\315w\177'`V\362nr\031\263\212A:d\372\037|q\017R\240=\002\245\026\372\267'eR\2029\245\017+~\273\211u#w\2102 \205\027\215\377\326\313\345\246^-\353O\217\366\023@\367\347\025\004\362X\237\247J<t\tz\276\321\367!\206\177\221\035BN\021\377E\344]v\264\341F\222\032\022\377\r\321\004\367\270\205z%L\354\013\232.\306\265\016\314\f\017]\222\253\037 x\r\034\351\201q`c\037"
+	.ascii	"n\324\234A\265\345\226`\013\324\311Sz\367x\215\310\313\223\375"
+	.ascii	"\036bb\005\322H\377\317S\266\266\310\226\321(\222\330\017\241"
+	.ascii	"\261[\031\364\3426u\300\311\237\350:\266\246\032\335\216\270"
+	.ascii	"f\244\272o\260?v\222\205\017\375g!\025\234\037.\237\261\306\270"
+	.ascii	"+\223\177\217E\035\250\301\2304lM\274\305\325\266;\256uduLq\013"
+	.ascii	"|$\344\256PR\236X\216\255\033kQ\332\325\307\371\b p\326\2142"
+	.ascii	"jZ\200,3\332\215[-yK\275v\371\305\236\003\"\231\3515\240"
+	.ascii	"4\275tD\300\312\330+\203E;3\235\201\231\247\177\325-\322\202"
+	.ascii	"\255\215\352-\324XW\277\212\236h\033\341"
+	.string	"\324\231<\341v\347**\203\006\177\250\351\bO\221E\025\177\222\036\266\230:\034\327j\217\204\207!\006\035[\207\213\310\2610by\211\002@\371\377\244\373\004\314\221\013\230e\335\025p\363\360\257On\016\367\013U\350\232\271\351\375\201<gX\271\343\035\204\322:9\276!:\343\201\237\334\231E\370\322\021\360\016\213\360\002t\323\366c\326\332k8V\251\225\336X\261U\207\261uN\242z\345W;\364b/\200q\222\023\206\233\362rGv\027\3262\262\236D\217t\306@\242\247\021!\\\322b\3149XU\334\224\313\356\371\354\r \205\017B\004l\340\353\204\321\215\200\265\022\313\344\263\333\372\330o\320\317\031\362q\006c#\314N\246\253\034\362\214\376\340\363\231\371\032\312sJ\203o\365\211\376\367'\226\004\030NQFN@\205D\313\256\310\366D\035\274\337\037$N\330A\002\023fh\367o\b1\034\231\275\370=\305\341\275\245"
+	.string	"B^\214LOO\360\272\321\377q=\254\245\030k\b\370\247ZDA\005\f\264@\325\306\372\273\214\324\327\365>$Q\307\341\351\2464z:\\\237\211\252}\362q7B\n\3112\202M\300+t/\0345b\005i\205\244\320aD1+#\265\223\2433\213\267\024\203\2643\320i\231\211c;\314)j\302\301Q\340n\211\031\202-\303\262\332\363\035\004\270@\025Ue\362\006t\201y\371\200a4\264\372.\217\317\356\321\350\177)e\316t\006{h\363\260 \254\262\257\307\252\207B$C\020\005{Z\253\327`s\rR\204H\336?\274\003\033\352q0m\005>\331;G\267\302\201C\330\017\253\234~T\366[f\"2]\242_\223c9\025\027\237\251y\217v\304-\255\033\377\f\201\305c"
+	.ascii	"5\367\313!\275\264\022h\270Sm\337\360\271Wq'\007\360\"\202Z\007"
+	.ascii	"\026\331\264^\013\331.\341\f\353}\262\210\305\226\311-\343$\020"
+	.ascii	"\fr\377\220\261R\240\007\304\256h\354\f\t\007"
+	.text
+	.section	.gnu.lto_.symbol_nodes.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\277\005E\027"
+	.string	"\306%\214G\200XN:\371\033e\007[@\333m/T\206\025}\017\207\323\367\313p\233\374\025\r\025\026Q\304\027\003\275\033\351\236?q\316\277\304\227\202\177\037\b\202 \030\022\004\211\351\376\377\277K\376\372\265\241\347g7##V\022\231\002s"
+	.string	"y"
+	.string	"w"
+	.ascii	"\267\302\240\237&\354\243\231\013\372U\230\372g\274\267\267\267"
+	.ascii	"\267\3247S:\331\231\324\247\202\324/3\211E%G\375)F\257\023\""
+	.ascii	"\227\311\242^\037&\321\273\354\f\211D\036\217\353\352a6\324{"
+	.ascii	"e\n\335K\320\365\316\377.\200\276<\177\372p>\375\244\031\354"
+	.ascii	"\263\231\374\244\347`\347\377E\241(x\224sH$\026\275\376\376\313"
+	.ascii	"\212\353\033\016\207\303\004\3755\363\377oI}\274\022\3752$\372"
+	.ascii	"dF\364\357D\364\355B\364\305\200\350\243"
+	.string	"\371\320\317\363\320\037\263\303\342\3607\320\241\037f9<\354\374kLUQ\301\210\332p\261\363w\252rzQ\365D\3654\325\"J\306\027\005\323\360\261sqd9\301\312\320Wb\350\277]\350\2735\365\271X\350\267U\350o\241\320\327bN\370\227S\302\301\234\021\372Y\226,\256+\b\204>\226\007}5\007\375+f\203\016CP#F\225w+-\252\274\\_{\303&\304\215+o\362\353\307\243\312;\267w\351\366\350P\032\361\322\325I\225\305\240\312\253w\\\234\2674Y\301\312\233&X\331\324\202[\241]2l\250\262\271\225.\216\224%\023\244\3125\351~\214\310\025\035\320\311\002\2166\351\217\217\177)\363\017e^t\027\271\2543\013\236Y\364\345V\364\347T\364\351R\364\343P\364\317\234\350\2331\021\377}\255\020\271LV\004\007\270\211\207\027\335a\250t}?\200\240%\001\031\n\335\033\245\025\022% \343,\0019"
+	.ascii	"\312\243<\202\305\004\3445\002\320yZ\223$\310$\002\274\351\326"
+	.ascii	".\253\274\240\3126D_\345\034T\250r\016\334r\334VZ\260r\001\270"
+	.ascii	"\365\355\320\362\nV\206\"nM\02195\256,\205\372T\226Jw@\016\256"
+	.ascii	"\263\241\3121\336\316\312T3\2144\336l\034\211*\3370\256o\255"
+	.ascii	"M,[\250Q\020\305\340\222\004R\nR\220\202\244\003\320\002)\"\252"
+	.ascii	"\016\021\340\244rH\221H\002\221@\202I\351\001\025Ygv&R\246\251"
+	.ascii	"\371\020\263 B\013l;zE\370\276V5\027\260\377\200\205\305;\260"
+	.ascii	"\ny$\232\377\310\303Ut\250z%\036_|\215o\354\263\243\034K\fz\022"
+	.ascii	"\242\003\231\364N\224\264e\306P\222b4A\030JN\277\307Id\276\215"
+	.ascii	"\374\240%\236\200\343O\25673?\300\by\315&\357\363\322|\006\367"
+	.ascii	"\372\335\334q\307\331\224\223\030\311\033\342\212\275ah0\201"
+	.ascii	"Y\\\335\026\313cP\241\3219K:\033\223)1o>\343.=rC\225'\034\250"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_.refs.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`x\001\005\f"
+	.string	"\326\025A:@\305(\303\001/\325\267\256\253k\345\273\256\23004\273\017\3439\242\352\242\242\003O\311\3068\212\242(\372\333Arz\200\275\213\277y\364\317v\322\336\310m\220\222Ob\t\331R\246*"
+	.string	":"
+	.string	"0"
+	.string	"\337m\277mg\"~\332\230\356\341w\370\\\366\032\366\031\377\272|a?\360\357\3127}\256<\303\277\224[\345-\037\366\305\357W#\030>\306\r6\367\303\203cc\001\237\t\020\0340P`@"
+	.string	""
+	.ascii	"-+}\246l\234'\333s\245\032\021\t\001)g\207\002\002\002XTV\252"
+	.ascii	"\222\362\214\354/\372\026\374T\371\004\277\324\230\320\277l\020"
+	.ascii	"\247\360\341\027z^g%t8\334p\213#t\214\273\375\300\322\274%\312"
+	.ascii	"!\312Q\345\246\362R9\211?*\027\225\203\312?e\207\232\362\233"
+	.ascii	"\212*{zg\016-Yk\345X\177e\203u\225\364\0308\342\002\037\305D"
+	.ascii	"\343\223h\034Cc\005\367\024\375\024\377\304\017\211\276\343s"
+	.ascii	"B\277\361\003; \300\242*\242y4\017\2702\" 9m\321\206_\220\203"
+	.ascii	"\031>\234\203xX\320\221}\237\223\315/\355\226h:Q\ro\016\0332"
+	.ascii	"\346&2\301\017QZ\204\3065BI\257\242\261r\351\250\t\344f\360\316"
+	.ascii	"4\273\035\310\230o\023\262\352\354\016\214\205&\26735v\231\260"
+	.ascii	";c`\003\233\260\323\030\023Z\261\323\030\023\355\030\263\t\326"
+	.ascii	"\356\nf\017\317\210Il\224&\241i\242\265\307\001"
+	.text
+	.section	.gnu.lto_.decls.5fff017c599303dd,"e",@progbits
+	.string	"(\265/\375`\347E\005'\001Z\355UlT Ha9\351\301\017\316\334\304q\371\261L\347\370\340$\376\241\2052\2732p\302\253|\320\363\002\217\265<\227\376m\3555o\250}m\277|\316\206\332\352\333"
+	.string	"g\234\273\225\347>\0038\366\250\030\362\215\023$\247\226\031<\353\350\361\200,'\352\370\255\266d\023\271S\327\005\277\006"
+	.ascii	"\007h\332\032*SPl\032P\2253b\\V\260fYhd\365\275\215\343\303+"
+	.ascii	"\003@\310\230z|5m\237.b\375\330\275\223\311\026t5\246\244\t\367"
+	.ascii	"e\323N&\031\220\226\261\036f\260:kh\f\211\025\260\255/=<\257"
+	.ascii	"\356\002\312\342\343K\017\257\2134\020\240\261\033\366\312\216"
+	.ascii	"\037d}\2454B\326d=\326KZ\254\215\364\220&\322N\372H\253\320I"
+	.ascii	"\272I3\351'\255\244\303\032\211]\353\"\035\344\275l!\277ftt\327"
+	.ascii	"\257\352B\256\032\013Bv\205\007\230\355#\325V'\026%\016\023\227"
+	.ascii	"$Gw\235X\224xK\226\"\315.\322Z\275\365\253bf\256\337\330\221"
+	.ascii	"/=\274.\322?|c8\230Aw\304\316Py\270\347\233M\362\021\300\"\371"
+	.ascii	"\356\323\201\357\273\201\357\233\302G\361\360Q:|4\016\037\035"
+	.ascii	"\203\217\232\341\243*\340\243]\370h\306\277-\340_\266\020\315"
+	.ascii	"\025T\3054\032\216m)\323\367w\013\376Er\243q\264\035*[=\372\376"
+	.ascii	"\362\270q\257p\215\266a\202\223(\371\256\306I\2079X$_\323(\332"
+	.ascii	"b\203u\327\367'\033\334SMe\327\262\215\363\213\266\314j93\213"
+	.ascii	"\316\251\035m\304\364\275\r\3413\332\333\333\333\263!|?\305\340"
+	.ascii	"k\221|v\317\256\261\313\254\364\313\221\245\354\253\257\375\303"
+	.ascii	"t\253\207\344Sz13\227\234\263\021\001\220\f\241\322\367<\303"
+	.ascii	"$l^\210\">-P\225\365\375-\037k7\324\006M\234\272\276\267oo\300"
+	.ascii	"h\3603\311\351\022'\316K\226\237\251\205\265\3376m\235\275c\353"
+	.ascii	"X:\233\307\342\261v,\236\235\263{\254\036{g\327\254\235\225\273"
+	.ascii	"\235c\351"
+	.string	"\274\2319W\261i\263k~h\316K5dY\264\330/\2773g m\310\314\234\261k~S\314\254\364`\315\227\036^\316\371\326\312o\2570m\332O\212\231\2672p\363\245\207g\326\306\256\261oE\f@%M3\347|\r~{%L\233\0337\373\305\276y\021\200J\030\026~\246[;[\306\222\261oE\f`\306\246\2313\223\351\317\240\204\265\263p\354\227\rT9\003\371\201d\345\266\006\r^\316\314\n*\250\240\202\245\n~L\320\300\3606\\\273\264I\276\f\026\311\367s\n\277\233\370]\006\277\263`\016Jp\210/L\302&\371\336W\330D\023\337\246\301gCc\323\3305\rVM6\262uE\250\270\372\336\262\341\013\344l5\370\354\336\236\325\340\273\255\202\377f\223|\267>\360\2336\311g\305X6\273\006\302\216\271\005c\263\034\235bff\316L\243F\362\247KZ\337\333.|\013\302w\356\355Y\020\276W"
+	.string	"\267E\362\331-\226\213]\203\300zy\006%~J\241\031\025\351M\321\353\323\367+&\002\336v9\nh\271\304;\300\267\020\370\354\236\205\300w\r\370\202M\362\331\264\266hV\3556\315by\006%NT\225\315rf\332\264\233\363\224\265\035~\326v@\315(\231J\363\335#\3417\276`\221|K6\311\367\333\263\337V\261f\020\234XZ\313\314%g\346\221\021s\307\215!}\317\264I>l\221|\177O\301\263\"\332\311o\361\334\265\222\277\227\354\371\333\b\221\366\351\371{\254m\333\375V\002\313d\355\204\374\035\366\333\271<|\352\034h\037\277\225\243C\322A~\213\327>\350\346\337u\226\024\360_\246\337\216\320k\fC\377\375\260tA\237\220\2424\202\256\213\274\206\254]\213\221@\233\203\260\277k\364w\216\026\254\335AP\3207\210D"
+	.ascii	"H\330\262\001\020!\353\350h \376\373\357\325o/8A\365\333\013"
+	.ascii	"\n\200\001{\036\215\002\315#\316\232\260(\376\206\323q:\r\356"
+	.ascii	"\177s\313\337o~\333\366\367\333o\335\354\233\346\342\366\377"
+	.ascii	"\216\223\277\335t\007\022h\363\333\262\243Y\242o8\002\226\272"
+	.ascii	"\355\277\336E\370\257\361\357\013g~\233A\037M\320[\277\2153\363"
+	.ascii	"[\f\216V\346\377\222\025z\004\377E\217\262\306\364\027\0206\017"
+	.ascii	"\303\177\352)\201\302\337fl\326\356\024h\200\364_\247\337\212"
+	.ascii	"\300$\374\255"
+	.string	"\210\021\300\337f\200\301\003~\333\341h\f\370-\006\035\200\373\376\353\242\016\005B\377]!\246'\bcE\3746\203\277h\016G\377=\361\333\013~\333\241\202\377j\036\364\337\017FH\360\333\237\365`1\b\361\333\t~K\301o\231~\033\200\337~\370\255\005\226D\203\351/~,\321\177\020\377_\374\337\360\016\377\355\340\357\t~\233\342\267\"\374\226\204\277%\260!\374\366\304\177\374_\025\377\361\374\247\373o\347\377\334\377\346\377\272\377w\376\327\371\177\367\237\316\177=\377\355\376\357\371\373\001\377\321\356\224\277/\360w\325\337T\177K\375\215\201\277\247\376\266\372\255\037/\177\023\377\266\300\337\025X\373o\364\243F\177w\371[\355\357+\177\237\375M\345\357'\1773\371\333\310\337D\376\036\373[\354o\260\277\275\376\326\361\267\362o\255\277k\374}\3657\004\376V\372\233\204\277E\370\033\305\337'\376.\300\337\037\374=\200\277;\370["
+	.ascii	"\177\037\375]\342o\r\376f\372{\304\337\030\374m\301\337\001\370"
+	.ascii	"\233\202\277=\374\315\341\357\b\376\336\360\267\003\177/\375"
+	.ascii	"\235\341o\f\177\027\375=\364w\320\337@\177\337\277\373\267z\277"
+	.ascii	"\365\363\333\274"
+	.string	"\337\272\375V\317o\245\374\026\312o\177\277E\377\353\375\326\356?\332\1775\277=\372m\236\337\322\375\026\317o\347~+\367[\t\3746\356\267B\277\205\373\355\333o\337\374\266\354\267Q~[\302o=\370m\007\2775\361[\001\374\226\203\337\226\370\355\006\277\325\340?\237\377x\377\315\376?\340?\233\377\021\354\355\355\355\375B\r\370\177\r\370E\200\b^0\004M\200\277YY=\227by\2158A\002\244,\3474\026`%k\\\232\364\375\221\016\374\233\002\374\255\261vk\364\\\212\345T\227\207)pD\322\340\345\234\306\202\223\t\026\023&}\177!\016\236\300\353Z]\253{\225\207i\n\363^\365\226U\332\250\033\322\367\027\324\360\004cUUg\036\023\024\346\005$\330C\336\3157\337\251\r\372\260]\251\337\251\337)b2\206\006\216\276\327\323Y\377\203\202\244\310@a\353\373\013_8\2024\340O\275\333\265S\357\264\303\240D"
+	.string	"U\215fV*-\370\005-\034\301\032\340O?\267k\247\237\263.\0019O}qh\242\364\262\300\202\031\303BY\337\033\355\301\037T"
+	.string	"\236w'\336O>k'\2373\317+K\321\221\340Cvg\206\227\275\224!\316<\233F\264!\250\311\0231\255\2767\032\203\177\373\376}\271\013ef6*\"\337oo\321\"{Z\t\376\337\277"
+	.ascii	"%\344L\345g\231s\266v\2765a<\354\372\376\347\220\377\277s\226"
+	.ascii	"Z*\217\260r\316\231\031\306u\204\245\026\246\304\252\n\343a\261"
+	.ascii	"\324\302\270\260\324\302\244\032\253m\212K\231\303\244p^r\345"
+	.ascii	"\252\2341\326T\316jK\256#\254\252\314\205\245\226\225C\314\260"
+	.ascii	"\234\231aR\2309\245\3149OY,f\330\022\253*\214\353\b\253*\214"
+	.ascii	"+\253\205qY,\265\254\314UY\211\001+g\256\254\026Fg\261r\230\022"
+	.ascii	"Km\311u\224\253\376\310\325\350S\227\303\336a\212a\203"
+	.ascii	"\005\253*\343p\240\254j\251|\303b.-[\316R\\\254\262\3222s\016"
+	.ascii	"\313\031l\331\201\255j\211\024\033\325\033\016 \257*f\3169K\365"
+	.ascii	"\270A%\266\f"
+	.string	"bR\3457\254\025\226OV9\313\345\033\033HY)f\316\371*SI\331\234\255\230\312\234\251\226\021\360\3129\347\245\215s\245\314E\271jJ\213JlIdE\265\274\312+\b\2619\347\314\205\245&\266d\032\243E\215,S1\245,\226\3262\223e\2710%V\223bf\254\234\263\315St\027&\016\257/\363\227\007g\353\256/s\210\rH\027\035}\317<n`>\200\364\275\021\030>\351\210\264\204\335\320\321\367FYx\316\346\r\271*~\356\234v\210(\355\232}\377\263\203\351\234s\277-%{\256\244\241#\347\224\013Z~\245M\261\3119\343\210n\250\331\022\327\367?+g\0348hpo\262\360\240\261zs\276\205\321\242\004\254\257\233/\357\317\324\217\276\377\035\301m\347\332Y\346\207\346<d\216\314\232e9\265\360![s\2629\333\234n\354\332\331v\232a:\333\316*'\226=\262\266\363\314\231\306\276y}"
+	.ascii	"\007\315\"3'K\350\2469\321\330 Sc\327\3164\177\006%\314:\r\235"
+	.ascii	" *\334\373\037\017\374_\027~\221\036\376\177\262\235cN2\247\230"
+	.ascii	"\223\005\273v\226\341\022\306\r\0302r\3158_,\2319dog\231\323"
+	.ascii	"K\031:\3152nd93\227\212\332\314%\231Bt_t\207_\324\304/\202\303"
+	.ascii	"/b\001\277hM\013\036-xdZN\346\0352.g\227s\213];\265\\\301/q\345"
+	.ascii	"\017\331\211\3454;\255\374\316\234\247\364\310N,'\323~\021b\202"
+	.ascii	"\205\216]\332\251v\242\331\265\023\313\177R\261pUK\r\204\013"
+	.ascii	"\335\016|_\324\205_t\205\377\363\354\247\225\337\376\261V\354"
+	.ascii	"\027$\223\036Z\372Z0L?\317N\2663V~\372\276H\n\237(\017\243\026"
+	.ascii	"\311\367\237S\312P/3A\2440\201\242dI\362\344\224rF1\242\023E"
+	.ascii	"Y\346\214rBQ\313\362\201\326w\205s\005$d\272\364=\221\035\034"
+	.ascii	"\327B\313\211\365!c\023\327\003M\033\034a\306\030\211\303\003"
+	.ascii	"\207N\230\263KI\211\277\343\356\324i\266\033\2344=4n\264\232"
+	.ascii	"\035g\347\016\031\026.\346Wu!g\321(BF\306\f\220V\263\346\213"
+	.ascii	"\214L\231\261 fol4\333\254\256MS\315\337W}\267\246\031'\355O"
+	.ascii	"\023M\247\211\363AFg\277l\021ss{\313j\346\234;\214\230$M\346"
+	.ascii	"\314\217f\3169nN\317\245\3619q\244\351<\177\233\331\265\205"
+	.string	"\331\321l\366\313\311$\003\3322v\004M\333\305\234X\224\rX\305m5w\2347N-8j\226\234@\316\036'\331i\344T\341,r\3768\205\234DN'\247\327\331\344Dr\0069\307\316\034g\2223\354|r\202\235\0318\217\234JN&\247\216sy\0169\277N\261\223\307\351\303\256\235;\316\255\237\312\223+\356\334\321uzN\f\217\254\315\232\226\314o\352B\256\242\222s;w4\234%s2\331\360U\226\032\315\234\231B8\262\274\230 \334\023\235\301Bo6\311g\223X$\337\211\272\340\023I\301'b\202\317\254\237V^\2161}O4\206k4\237\023\353d\222\221@5\345?m\330\265\263F\343\3352+X\272Z=\300\354\356\375\273\317O\254\277\365\364\236\363*\002>0rj\354\365=\255\226\256\230,3\032}O\004\004\277\304\037$d~\222\220\265\236\375\362\223\272\220\251\340\034!;\245\316l\277\320m"
+	.ascii	"e\f\334\027\336"
+	.string	"9uV\2354N*\273vJ\365\236e\026\351\310\243\241%tO4\205?\324\007\177\210\017\376\320\035\376\220\036\334yL\357>X}\250\364\025\242\303\037\222\203?\344\206\373\315&\371.\260H\276\017\261\341s\261I\276\017\245\341\017=\301\037\032\303\037\372\302\037\232\302\027\242\203/4\206NP\013y~p\351{!.\370BF\360\337r\336rj9g\245\241\034osz\364\315\200\351-\307WVF\b\237\276\027\312\201\377f\221|\027\272\302\017\302\303\017r\303\017R\303\017*\202\337\264H\276\007\321\300\307v\370\370\r>f\303\307g\370r6\311w\334\004\333l\221|\307C\360\261\r| =\370@q\330*-\222\357@a\360\201\314\360\201\306\260]\202\371\"T%\355\213\215\236Y\237\265\227^*\031A\321\352\372\352\333kK]\027G\310\231\276\007\322\302L[\032Kg\261o\\\362\324\023\002Hy\2733\303\323@"
+	.string	"\314;\263\262.\255\245\271\330\265\336\362\022\275\245\257\3304\373\346\225\245\3548Ha\2733[\252\340\306a!\t\027|;\313o\257\264\225V\353e\316_r\316JAqH\334\210\364E\353\264 :)US\372\336W\006\315\247\206\357{\202\357\033\202m\266I>4\333$\337\331\252\334\240R5e\017\206\227\227\2252\020\270\212\005/fR4"
+	.ascii	"I\031\023D\205(]#>2\250\026\0331P\244\240c\3203\261%gb\372\376"
+	.ascii	"|Q\222\\\215\021s\207\330\034tG\352\302\234v]l\344\311\353\313"
+	.ascii	"$\332\332B\262\374r\326\021\261\251\335\310^\332\316\264\266"
+	.ascii	"\034\315\276\022\370\320\242\005\355B\302\346+-cx\232>\033<\304"
+	.ascii	"hp9\332\205\b\213\232\033z\372\242[n^\225\037k~dvI\244\372~\203"
+	.ascii	"\022K\220\261`A\325,Z\336\332\320\346\r\334\027^\222%V\220\264"
+	.ascii	"\243jb\364X1q\322\027E\273\230\377A@g\324\020\001\322\367z\354"
+	.ascii	"\227\377A\250\330\236:b\376\340\016t\256\\A\275\226\226\247\034"
+	.ascii	"8W\224e9{\205(r\353\022\303\325\367\017\244\301\022D13C\317\316"
+	.ascii	"\236T\311\3033\352jS\007wf\346B\241s\326\244\357\037(\2029t\201"
+	.ascii	"\002\005\245\262\264<\355\300\241\302V\326_y\334\034\231r\224"
+	.ascii	"\212\220\236\025\235\227\276\327\203\226\375\017\"A\007\311\222"
+	.ascii	"(\250\224\346\221\345\244\253\357\037\240\212\342\007sX\323\244"
+	.ascii	"\t\372\304v\311#eG\220\226\334\031\236\223\243O\316\314\341\321"
+	.ascii	"h\216I\271\303\322\2069\314!A\2022!a\363\325\226\255/M\264\331"
+	.ascii	"B\030/&K\274<\251\013\322\027Ub\363\340\342X\365\275\003c\320"
+	.ascii	"$\016\234a\016xF\214\\.{\201I\205\307\013Y\030\224?K0\207=\""
+	.ascii	"D.\227E\313[\032\370\204!\001b\355\320\226L\365\275\003`\270"
+	.ascii	"\203\325\330\030\252\\ZJ\321\205P\323e4\344\017\034\216\276w"
+	.ascii	"\300\006\356\340\004\b\020Tli)U\027\242\n\332\223\035mge,K\220"
+	.ascii	"\243bh\330\231\225\007\314\222\276\250\020\242=9p\256\364\275"
+	.ascii	"\006>\350\262\316\320\222-?\334\336\340\016\\\276\276P0\213\226"
+	.ascii	"\267>\310\263\004H\331\017\216\n6\262|\034\0053\242\202\222\004"
+	.ascii	"\3149\247\250\314N\\\017(\230\303\217\035;P/\213\226\2672\250"
+	.ascii	"qB$\r\036\225\032-\004\341q\324\313\246\351\311\362fe\316\347"
+	.ascii	"f\313O\236\022\314\341IW\027\252ci)E\347A\217\330\221:<!\035"
+	.ascii	"\3149-9\216\352\260k,\234%v\272\372^O\b#\033Z\366P\365\275\206"
+	.ascii	"+\334\001\f\007\016Ti\321\362\226\003\246\210\244);\321\252\234"
+	.ascii	"\351B\267\216*\347\0160dI\217\276\327s\022\315\205e\301\365\375"
+	.ascii	"\322\036\334\301\r\360?\232\205f\241Z\026-o\371\266\260\240\302"
+	.ascii	"\036\274\234\275B\\\"ygt\372\242Z\335\305\247\307\362O\337/\225"
+	.ascii	"\301\021\274\001\036\255\201\3268\353B\\\310"
+	.ascii	"Y\f\217-+\275,h)f\340\234\365\375\022\023G`\347\346W\356\316"
+	.ascii	"\271t\354\332u\203^1Q\345)*\0274!\01323\206\nX_\324\252\277\344"
+	.ascii	"\241{\323\367KO\360\255\331\334\235\323\274s\353l\240\302Ja&"
+	.ascii	"Gw\363\330\267\"\006\210\322\246\211\347\326\371I\035\345<\304"
+	.ascii	"\215l\017\245\201V\241ShF\251\354\032*u\355~\347\\:_\312\202"
+	.ascii	"J\335\246\233+T\352\352\271\177\354\233"
+	.string	"\327\205\\\025\306\216\220\215\260\267\037\277;w;\033\250\260RX\231k^?W\317\256\335?K\367\317\335s\373\3307/f\356\032\002\223\026f\246\241\202\242\2728r>|\367\277}\362~_\230D\362\364\275|\200\274x\260\241\321\367KS\370\277wv\355\342\351)\033\323\247\357\365\334\016\232#b{\370J|\360\225\352\340[\207\343\232?\334\364\275R\013\370Jp\370Jm\360\225\314\340+\261\341\377\332\271u\324\326\330\271\271u\354\227\206\323F\213\252\357\225\276\340f\332$_\b\213\344\273qW\216\321\0240R4\372\376\266\360?\b\001G\334\274\364\275q\272H\2173y\372\376\3021R\312\3452}\177\341\234\270\266\234\364\275o\260\225\322\025\020h\231\022/g\336~\337\374w\315\232)\002s2d\254\357uc\372}C{\260\021\202\244\357\220E\362]\211\b\216 \257\313/\233\333\345\266\205\360\312984a\003\263"
+	.ascii	"\b\212\022/S\372"
+	.string	"\266m\003\273\343\247\357Es\325\3345\177\320\217\005\034ZT\372^)\b\376M\363?H\250\b\234\022(}\333\336\214\357\232\371=\363\007\r\251m\021B\247\357\225\276\360/\013\267\314\037dU(k\323\353{\245.\374K\346\177\320\220\237.9,}\357\030l\245T\005\002\005 M\262\372\376\327\313\357\230\377~i5\227-\205\275?w}o\230+\346\227\355\202\311\227m\203e\316S\227\315\310O\316SF\326v\260\266\303\245\"\306d\315w\337\300\036.\262H\276\273\306\364\353e\310\315\231\346\225\276D\026\311\367\006\336\360\004w[\266\314\201\221\021\211Y\242e\321\202'\320\313\362,\227\013g\333\204ygV\206\2665\261\362\344\b\366@#-\355O\023\333\321\340a\244\357\033\340\201=ha\271hX\316\274\024RIA\362\235\031\236\221U\033\032g\372\276\001*\354\201\307\225+]\346\232>;)\2722}\237\204\007{"
+	.string	"rv\255\234%\371xC\n\223\003\215\031\214\301\f\370[\245\312\371f\310\005O\270\350\330\r\001\301\372\363\246\357\223\252`\bz"
+	.string	"\177\247L9\243\234X\313\2510\023j\244\340\276|pJ\346\214\364}\222\020\354\301\210\024)\227\313r)\267D\t\253\323\367IW\370\203\223\013\345B\271\\\037l\261\322<\341\314\264d\341\301\037\312\236<9\363p\323w\206\214\311\233\031\374!\255I\223\250\334lc\244\314U\301\037\3020a\222$\2733+CC\273\342\321\367\031|\340\017j\224(\231\300\333\235Y\031\220\235-01}\237\301\006\376\020\007\311M\202\344\314K!E\247\3046n\2401\323\203?\340)\362\"\327\b\206\234s&\003Z\033\363\323\374\271\355\315\3212\322Y\270\315M\233\233\276G\222\203?\250p\025\316\274\0249C\033\266\241&F\266\226}\217\244\005s\350\002\332)\366\206\331\265\033v\207\004a\345\254\203"
+	.string	"S\224:,\270b(\\\0311a.QW\234\036iL0\0054\226_\236y)r\0066owfxEp\312\342h\355\300\024(\201"
+	.ascii	"\tC\346E\215\031\257\276G\252\201)\330\001v\260\313\205\363\222"
+	.ascii	"\231%\223L\0357}\217\241\017.Z\001\370\373\365\325\244\256\210"
+	.ascii	"\n\023\032Zxv\\\257\035\022\240\361\270"
+	.string	"^<4\2345\205\254\372\324A\351{\fl\36010qP\032\360W\307\332\325a\367B,\247\3028@\351z\262\003/g/\013~g\\\222\320\351{\f=\360\267\266.\227/g\313\\n)\263\2272\204\0077\345\355R^.,\225\263\0243o-\355e\257\020vnG\336[_.\024n\205%k}\177\324\007\377\350\f\276`\003\370{\343F\317]\264\314\345\002\215H\232\237\022\273\255\263'\326\324\205\320P=\"\031_\244k\260\305P=b\370\223\2105\2306\001\375I\0042\225\241B\215hr %\016U\254\251S\206?\211\030aT\225R`:4\256 B\246\3074=!E\032\205@a\323\b\241/\005>\255H\241&\023\326\324\tiE\032O\b\376R\274h1L\205H\343\b\351\032L\252\303\243\024x\341E\272\006\211QBbP\250\364'\021\311th\204\322 \302\002T\274@q\002(B\b&\254"
+	.string	"\242h\001t\241\342(\2114&\213i\022\350O\"d G\310@\"\255)\t2\220G#\244\304\023\202\305\364\302\237D\244P\352:\"\211La\250\310\241\003I\225HT\241|3\216F\024\353\237D\034\243\214H' 2]S\250 2x\034!,F\2150Tlj4\tt:\022\255\300\242\323\021-:\035\3174\0055y\223\311\0249\034\006\201f\034\215\302\213\\\217\347\211f \327\244\352\224\266"
+	.string	"\016\323\242\223J\f\002\r\323d\324M\002=\270\006\207@\247c\0212\370$\274\300t\r\022\217P\351\013\247c\004C\225\030\\@\321\204\007R\250\250d\332BF\213\242\t.\222*\\\310hQ4\241ER\005\n\241\206\265\230\"\221Q(4\254\310\340\352B\351h\\] \215\253qEr\215:\026U\314 \036\217'\322\244\212\025I\025\351\320\270\"E\252Q\023H[\314\b\256\340"
+	.string	"\302\252\026U\020\255i2m\341TT\241\220\301!$\007\376$\"\t\024\"G\b\221A\020\220\020\261\"\203G\021\3114\212\030\\@\272\006\207G\005\254\305\tR(c\n\343\013\027,H\300\360'\021B`\n\245\256\305($"
+	.ascii	"\214FH\223F\343\023\212\025(\b\323'\024K\351\032\204\241\256"
+	.ascii	"\302\023EP\351\232\234\341\"\206\021\0013@(a\230&\243\202(R\030"
+	.ascii	"\301\024\036.T"
+	.string	"\221i1u\302\337\200\003\f80!\003\350&< \341\001\t\337Mx\300\304\344\001\007L\370\0340\235\353\272\026\215\311`\332\002\n\031L\252\303_\nL\2173^$\243\326\340\352\"C\n\034\252\220a<\001(\005&\235\202\304\021\322\241q\305\321\232LS\244S\032\002T\020\005\214c\023\006aR\205\272k\260\005\222\211\241\272B\210\364\205\240\202Eq\306\320\267\026U\343\021\205`\212<\001\030<\026%WD\005_\374\3600MA%\252'\004\327\244\320\237D\244D\265i\r\"G\b=\b\221@&\214G\031\"\304\b:@\210\024J\246k\020\211\022\203Q\305 \224oMa\250k\020\206\212LCh \tL\211j\223\021\311b\250\036\211\322\343\214\027\310\024\305P=\036\305hZ\327?\211\030\252\307\245\021F\350$\320\304P=\372XX\0256\004;T\217g\022\210B1\b\302P=\006\t\241\200(\024\203'"
+	.string	"\245\307\031\353/\205' Qz\234\261\032\245\360\004\314\240\351H\034\026\245\360\004l:\022\2011\2023\204V\025J%\002\207D\343\023\320\251\250\016\203\351\223\322ZL\205\310\224\305ZT\215,\216Q\303\242\312"
+	.ascii	"\245\030A\007,\255\300\f4x\022\256*\013\"\321\330\242hT\223\252"
+	.ascii	"\214`\004E\225(,\252@\031A\250\244\241\030A\007\270\030\252\307"
+	.ascii	"_\f#\362\351\305\3220M\217I\244z"
+	.ascii	"\"\025\026Sd\332\224\266p\240\250\006I\210\021t\3000]\203Eu\210"
+	.ascii	"4\032Q<P4\252\253\2324\262@A\250\256.\212& \323U\205SQe\3000"
+	.ascii	"\225\2416IP4\252\2530E\252C 2]U#\361\002\0242}\021\302\214\006"
+	.ascii	"\020\323\005\300\b\0261\244\307\031\353\005!\020\203\214 1E\002"
+	.ascii	"\241\220\351\252\016!\215\25308\002Q\321\250\246D\342\211\365"
+	.ascii	"\204\214\340\n\r)\244h:\226\020\\\211i\bF\344\f\022\326\244\321"
+	.ascii	"\b\3020CQ\r\222`\2044\256AdJL\205\302\023\r45\031\327(\0243V"
+	.ascii	"\025F\020\351\244\256\305\340\321\252B\251%@E%\207*\013\247a"
+	.ascii	"\212\244\221E\214\021`\004\213\r\254@\241\352d,a\351\302\024"
+	.ascii	"\210B\003\322\250\302\b>\245 \020\323b1\370$4*\032\3255\350\244"
+	.ascii	"\302\b\" \231\f\036g\234p!\035\032W\244D\247\342\211T\21046\375"
+	.ascii	"\222\300\344ZLa\244>\247\242\2124\256j\321\b%4L\207\305\364\230"
+	.ascii	"\214J\006\371\234\212*\221hD\256E\243p(EF![ 3\254'\206i\213\244"
+	.ascii	"\365\3040%\252\301\021\206"
+	.string	"*1\b\003)\206\261\204\243\365\3040}J\252Eu\204\024\204!1\312\370\344\302\251\250\016\213A\242\206\244\025\230\\\221B\251+^\323d\212d14\252\310\224Ep\r\206 \243\205SQ\205\241\246\302\024\371@\nDb\221\302PWa\320(\005\246\311\340\023\013\2434\031|:\242)\260E\272\006W\027(\024\325\022d \207\206\305 \024\224\021\205\260\305\320h$aM\006\211G\177\202\340\306c\212\034\261\032\215\310\021CI\240\223\332T4\2428\212a$\002S\342\272\032\221O\353\003\277\031\310\024\206Q\230\"\225f\004\211\351\020\330\324d\304@$\032\221\r\244D\247b\020\370$\\\325#0F\223\022P\272\006\221\300\030\301\031\300\030M\300!\321\370\224L\221O+\260hTW#\024\020\005\241\272&W \007LkQ\215\302I+\320\304ZT\243\200>,q\202\t\r6\350\200\204\210\f\357\240\003\024\034\024\200"
+	.string	"\022\260P\304\210\365\311I%6\215(\252A\250\021Bdr\204\210\r)2j\230\n\215\310#0\025\026\203kR\035\002\213"
+	.string	" \032\215 "
+	.ascii	"\321\242QM&U(`\332\024L\022\325`\323\205\377(\037*BZ\244\314"
+	.ascii	"q\301{\342\326\205\256\211\336\241L\210\210\2001r\205\356\271"
+	.ascii	"WC\234h\321\241z\356\224\223\035V\230vbEo\230<\350\3449\363@"
+	.ascii	"\250\323\032\253C\301\212\350\250\354I\322\367\203\362\016J\207"
+	.ascii	"\336A\2336+3\212\347h3\350\213\314\234\233-\033X\212\270\365"
+	.ascii	"\375\006+\230\002%r"
+	.string	"\250\0359\264N\220T\316;\346|\351\341e/\035u\3460]\020\035z\346\350\2344r\310A2\347\244Cs`\021Bg\216\2253\n\302\247N\225\276\337\300\004\377\250\034\035AA\222\350\210\323\202\227\334rL\253\3218\27778a\364\230%\244\244\2164\03457\037B\254\372\242`\202\274TYA\253\357\317I\335\222>oh\027\037\236(W{\372\236{n\033\025\231,\324M\317u\271\363\226\325\227\00204\r\332&\r\332v\3335\2253U\316@\276.P#\005\367\205\266\241l\242\314\301\242\307\006]#\227\001\034KVXRa\347\fM_5\347\0263\347\274FI\232<}\277a\b\376Q4\227\353v\351QD\254\317(\353X\251\021\245/\312\002Z\346\250\231\243f\0325s\356\355\371\316\342l\t\204\335\250\003RT\202<Wr\f\203J9E\250Dh(\315\001\303\025@ XD(\222\315\325\325\036\023"
+	.string	"\204\211\252\305\321\236\305\024\203fDDDDA\222\222\202J\251\003E\354\034\220(\371u\332\231\3250`\271 -\367JI\255h\303\352a\244j\357>ml\366\004\"\020{\342l\033Z\332\020-s8\354e\3443\037\353\261\271\366\247Cd\353\242\332\017S\006i\351\345\225\211{Z\306\273\030= :\365\343\317D\272\272\201\273\031\002\303\231\013\2240\254\300)\031\326\356\322J\211\215\365\246\316\255\260\2360\276v\335\215;\250\201\361\252N\n\221\276R\243\361T\374\340/\310\314'\240\213\203\217P\006\b"
+	.string	"Rl\f`\343\336k"
+	.string	"\362\227\322\206$n\213\220 5oN\301\034\347\030\357u\303T\226\252\311\013\200j\354\275\317K\006\266\336N\3350\356\3135)\255\235\267\336\203y\001\001&TO\212\316/g/!\212\032\216&\203\211\241\b\203t7\363\302\355;3r2\f\003\374~V\315\250\274G\245\0215s\350\264\355\250\024\307\361\203\204L\344\030\b2\027\341\036t\022\230\200\257\017\335\322_\035\034\f\241\317\273\245KI9KfQ\326\305\226')4\243qJ\002\355\323\264\246\317\235\257{H\317\206)xK\3238\206\330\"\250\314\240\013u\2119\227\310D\277\030|\275\257t_\"\301\244]\031\347\373\336\334\004B\210z\252\200\023\263\206\017#E\247#\374(?\272_\bkh2<"
+	.string	"\212\371\324\210i\022u\030\3141\207\017p\177W\234?\006\376;\036\246K\223s\211\205\317\364J}\350\371g\260KE\313\245\263?m\3544"
+	.string	"\227\332\376~\313\270C\203\225_\253\353&H\301[UO\327\276 \301r\020\231\263\364\035\212\250$xE\332"
+	.string	"\267t,\336_\344\fT\224\032* \241\277\235\253w\255c\024\266\037\013j\301:AsOM\314\253\246\324f\223\330\341\002js\215\247\034"
+	.string	"G\374uv\036\031b\343\2638\r\202A\020.\375\213\375S\320T\3746.u\203\036\331\271~\005\203\214=0\005\b\206|\203\347\202S\231\3057 \335\236\235z=q\221\352)\212\275\273\177\327>/+\316Z)\335\265\333I\211\026\306g+\274s\327\t\371\260\033|(\004\306\352r\351\226!N\224\311\331\321[\303\303\336k\354v\320\257\b\032\240\306W?5\r4r\300\"\345\201$\020$\304\303\361\245\317\277\343X\333\361\304O-F\217\035\275Z\237\263t<yz\177\002\371H\352|"
+	.string	"U1\240`@4r\033k\322&\037\240l_nm\\^v\227\fc\346\312\277L\0021\236!\365\231}\034\317e\254V\212\344U\240N\371\240\273&,Z=W1}Y\325e\356%\315C\230[i&\2139\200\251p\313+eK\203\273V\344\362\203y\341\350)e\f\b\256@\371 \235Y\201l.\373\261'\207\002\3565\230\332\240D\023"
+	.ascii	"\320\034\210\254\305\nb\212y\035t[J\330{\032\324\247BN(y\307"
+	.ascii	"\2520eyS\035\345\037p\2000\367\267\313F7L\320\272lV_\f\345\306"
+	.ascii	"X\356\305\271\344{O1+p}\312:\300u\376\035P\001d\320\246\311\205"
+	.ascii	"\267\001F\307#\206\234\034\325\233\036\016@\333,^\372\221h\002"
+	.ascii	"\266|%\334\317\232r\\\214q\216E8\346/]=R\232\375\311K+@\233\260"
+	.ascii	"\021\202\274<\027\033\206m\261\222\213\264\275\233\362\205\222"
+	.ascii	"-\007\331X\315\253\361+\002\207\331D|1\236\346\226\251\241\242"
+	.ascii	"P\242\363\244g\324<\352\235\232\364\326\277\337-\223j\273j-6"
+	.ascii	"Z9\030_\00530&\360\341+\211`\250\330\327\203\205\b]hM\231yX\246"
+	.ascii	"\333\366\316\335\237\301\342&\t\300\205_\034\224:\303\337\233"
+	.ascii	"\245\271\274A\253\220\"\202\222\350e>}\210E`~\317\356\353\034"
+	.ascii	",\027\203=E\244\232v,\206IX,0\356\245"
+	.string	"0\362\016\305\204\233$\224\360\265_\251\334D\240a"
+	.ascii	"0$\021\262\2132\215\344\314o\244\300E\214k\343\016\337\317\346"
+	.ascii	"\306\357\207k\216w\001\037\362\foTF\"~\337\312\025\203\225\223"
+	.ascii	"\203\301~\020\310\255yj\314\253\3220\271\250z&y\313\215\031}"
+	.ascii	"IX\2275\350\255\027\307\032\362\032\210\"RUFA\036XUD\203\254"
+	.ascii	"\006\237\004\\\375\345\353\364\371`\301\212c\331\022(\256Z7\346"
+	.ascii	"A\374\240hh\2665\302\024\212\272_\034qy\347\030\305\305\327#"
+	.ascii	"\267\005\346\327U\375\325\311\204\0021\352\366\306>\342\267\023"
+	.ascii	"yQ\020a]\214cbR[\273\024\276\337~A`\367g\255\032r\030\367&\250"
+	.ascii	"{\363\214]\357\203\025t\216\241\213\260\211\260S+\220\272\345"
+	.string	"\363\253Lo>\325\214L\036\324\254\004\266\027\003\213\240\261w\356\004\322}\273\210\271\215\272\031M\351>w\312\231\004\"]\226\244t^\274\350\266\2504\t\352\304\201\277==(W\020?\251\372\242\210\031\317\243j\334k\026^v\337C\343R\335VW;\361\240\nb\225\022F*aU\322g\275@&M'\344\337j\302Z\376\351dy?\322X\316\025-\032\\\035\334\245\2325\331\327\265\220\262\220\324\270\344\251\201\224\277\032!hv\207\006iRo\005\036I\232\361\253\263L\004\277NE\211\243\341\330\303gq\343\330W\254\203T\022\362\227K\370s\205\305\240@~%\342zZd\002=\253e\305|*\362\\\340\377\226\345P/\374\355k\326\227\3222\207\177\217\337\260\\\360\240k>r\247\205\0372\265;9\300\227a\377>C(\270\003\346\276v\376\233A\335\320.\337\221\200*d\3751\224\037)\202\200\006\217\245/v"
+	.string	"V\230\234\334{x\234\365e\345\235\256\351\030\332\274\r\374\224\303e\177\3744u\036m|\003\211\321\r\016\320\212HY\017\3361\026p\324J\246%x\013\331\277\037\350\342nw\246\020\265_3-yz\017\234\217\0052\233\227\037\013\247\365\333-\366\226\317|\363l\210[rk6\267\215\251\267\246\334\244[2x\374\300\200\3516L\017\006]\217QZ\272\020\004\336\212\26192p\037NW\316 6P\353!U\211\220w\277!\333\002\016\366\301\233\033\330\363\032\251\246\352\333\373\034M\b\tz\324z\234\246\221\001i\346\025\213`\220A]\320\243f\376\037\302nk\260H\004\320\374\342\340D\013\n\246I\212\226b\363\350\363k\240\334]j,\253\213\202\314-\263\223\254\232\263Y\361\275\304\252\241\3660\225\304\230"
+	.string	"\207\323\bnt\035@\213\265\336\027\314\002\031\3777\235c\332\306?\256\2031y]\330\233\013\267\377\0302\254\341\216\024\006\240\336-\236\334\3538\002\025{,\244\356\325!\352u\025j\323\330Q\366G\375\363\273\220\3629\263\252\227'\b\343\004\274\214\227B\300 ]\214\2434*~D\303\253\250{\365\260\245\320^\033$\311\234h\225\310_\231>(\220Zw\033\241\tv\377\361\t<\361\213\234{\334\205\213Fk\017>t`2\263]z\\g\346\256\002\2146\3609\357\201\004\330\354`\2537\321m\274\325\257\203qmj\b\305zgY\204\bI~\252\321\344\250\301^\2275^#\340\331|\013\177\357\246\332\"\200p"
+	.ascii	"H\211\362\220\032%\324f\332\3129PCq\202\270\341\240\236\333\003"
+	.ascii	"\277\016\274\331\213p@\b\273Iz\225\317\357\f.U\026\335@>\274"
+	.ascii	"\266\375\201\350\200\301\357\036op\362\026\327\344\312\"\307"
+	.ascii	"\220\004f}\032E\244\251\312y\346\230V\232B(\300\230pP\207\266"
+	.ascii	"\"de\n\246\177UI\323\276\322\007\326C\bS\007\377\356\226\344"
+	.ascii	"\344\371\215Clw\263\b=\325\275\340\267\331M\256k\tS\237?\363"
+	.ascii	"\005\342\023{\300b+\2704\003?\231<o\206a\247\33377\007\221\b"
+	.ascii	"\345Tu$!B\261\205a_\342\270\213J\325\352\334\304\362\216\236"
+	.ascii	"\225\224\374\273\224kDr2@\034c\0031\310SWI\027\303\264?\366\242"
+	.ascii	"\336\321\332\310\331(\373s\317\235C\325\024v\036l\354"
+	.string	"\033\307l\237\007=A\365gS\216@\351\207Q\034X=g\001\013Oo\342aw\317\271a\351.\375\342\225K\224n\236\371\352\260\316\204T?\212\367r\377\361\376\022~*\363\037[\334i\346\234 \307\364\372\202\273\3111\323\201\032\373{'\246`\333\\#\306\377\177\346#\277/\3073b5\006\004\277\205\024/\036\230F\nw\347\252\031->\005\334 \361\200\360M\030? t\fQo\320\354\202\036\3000x\362\2551\373\016\261\233\257\341\263\355o\021\307\035\002o\322_\247\230\363\333\2351D\277Vz\001l\216\213|/\363\033\340\371w\345\2430;H\235b\330~q\336\"\355\263\344\257\251?)r,G\216_[\f\335\005\007\375l\240\237@<\215\247\316\373]j\337\025\352\2466v\341\301\204!8\017\270o\227\017\370z+>ngX\272\236\020\255\221\177\302\2709\371]\001\370\022\334\302\002s?\016w\370\b\344"
+	.string	"\364a\367\243\"n\343\251j=\321\2262Z$\324\351o\343\312\215\0246\022l\024\002\003\210\337C\272H7\006\356\006\354/\304\363\tN$\377`\376\240\376\336\224\332g\316\246\352$\3301\201\254R\255\007\374\001\334\n\321?\344&\274\244\037J^\\\270?\262\333}\260>\017\373\263(;\226\317)\233nZ\307B\317\262V\344\306"
+	.ascii	"\330\025"
+	.text
+	.section	.gnu.lto_.symtab.5fff017c599303dd,"e",@progbits
+	.string	"failsafeConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"failsafeReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\002"
+	.string	""
+	.string	"failsafeInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\002"
+	.string	""
+	.string	"failsafeBypassNavigation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \002"
+	.string	""
+	.string	"failsafeMayRequireNavigationMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"failsafePhase"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\002"
+	.string	""
+	.string	"failsafeIsMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"failsafeShouldApplyControlInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\002"
+	.string	""
+	.string	"failsafeRequiresAngleMode"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"1\002"
+	.string	""
+	.string	"failsafeRequiresMotorStop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"3\002"
+	.string	""
+	.string	"failsafeStartMonitoring"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\002"
+	.string	""
+	.string	"failsafeUpdateRcCommandValues"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"failsafeApplyControlInput"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"7\002"
+	.string	""
+	.string	"failsafeIsReceivingRxData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\002"
+	.string	""
+	.string	"failsafeOnRxSuspend"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\002"
+	.string	""
+	.string	"failsafeIsSuspended"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\002"
+	.string	""
+	.string	"failsafeOnRxResume"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\002"
+	.string	""
+	.string	"failsafeOnValidDataReceived"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\002"
+	.string	""
+	.string	"failsafeOnValidDataFailed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"failsafeUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"pgResetTemplate_failsafeConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\\\002"
+	.string	""
+	.string	"failsafeConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\002"
+	.string	""
+	.string	"failsafeConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\002"
+	.string	""
+	.string	"GPS_distanceToHome"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\002"
+	.string	""
+	.string	"pidProfile_ProfileCurrent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\002"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\002"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"activateForcedRTH"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"abortForcedRTH"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"getStateOfForcedRTH"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"disarm"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"getThrottleIdleValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"pidRateToRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"pidAngleToRcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.5fff017c599303dd,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
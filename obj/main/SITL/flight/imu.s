@@ -0,0 +1,18181 @@
+	.file	"imu.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 7 "./src/main/build/debug.h"
+	.file 8 "./src/main/common/axis.h"
+	.file 9 "./src/main/common/filter.h"
+	.file 10 "./src/main/common/log.h"
+	.file 11 "./src/main/common/vector.h"
+	.file 12 "./src/main/common/quaternion.h"
+	.file 13 "./src/main/drivers/io_types.h"
+	.file 14 "./src/main/drivers/adc.h"
+	.file 15 "./src/main/fc/config.h"
+	.file 16 "./src/main/fc/runtime_config.h"
+	.file 17 "./src/main/flight/imu.h"
+	.file 18 "./src/main/flight/pid.h"
+	.file 19 "./src/main/io/gps.h"
+	.file 20 "./src/main/drivers/resource.h"
+	.file 21 "./src/main/drivers/bus.h"
+	.file 22 "./src/main/drivers/sensor.h"
+	.file 23 "./src/main/drivers/accgyro/accgyro.h"
+	.file 24 "./src/main/drivers/compass/compass.h"
+	.file 25 "./src/main/sensors/sensors.h"
+	.file 26 "./src/main/sensors/acceleration.h"
+	.file 27 "./src/main/sensors/compass.h"
+	.file 28 "./src/main/flight/imu.c"
+	.file 29 "./src/main/common/maths.h"
+	.file 30 "./src/main/config/feature.h"
+	.file 31 "./src/main/blackbox/blackbox.h"
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 33 "./src/main/sensors/gyro.h"
+	.file 34 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	imu.c.afe75dae
+	.weak	imu.c.afe75dae
+imu.c.afe75dae:
+	.long	0x2054
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2f
+	.long	.LASF2265
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1643
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1644
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1645
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1646
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1647
+	.uleb128 0x3
+	.long	.LASF1648
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x11
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1650
+	.uleb128 0x3
+	.long	.LASF1651
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1652
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x12
+	.long	0x7c
+	.uleb128 0x3
+	.long	.LASF1653
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1654
+	.uleb128 0x3
+	.long	.LASF1655
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x31
+	.byte	0x8
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1656
+	.uleb128 0x12
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF1657
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1658
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1659
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1660
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1661
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x12
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF1662
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x9b
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1663
+	.uleb128 0x12
+	.long	0x102
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1664
+	.uleb128 0x3
+	.long	.LASF1665
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x14f
+	.uleb128 0x7
+	.long	.LASF1666
+	.value	0xfff
+	.uleb128 0x7
+	.long	.LASF1667
+	.value	0xf000
+	.uleb128 0x7
+	.long	.LASF1668
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1669
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1670
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1671
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x15b
+	.uleb128 0x29
+	.long	0x166
+	.uleb128 0x6
+	.long	0xa7
+	.byte	0
+	.uleb128 0x21
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x187
+	.uleb128 0x1f
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x33
+	.byte	0xf
+	.long	0xa7
+	.uleb128 0x1f
+	.string	"fn"
+	.byte	0x4
+	.byte	0x34
+	.byte	0x16
+	.long	0x187
+	.byte	0
+	.uleb128 0xa
+	.long	0x14f
+	.uleb128 0xb
+	.long	.LASF1679
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1e7
+	.uleb128 0x8
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x115
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1672
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1673
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1e7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1674
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1e7
+	.byte	0x10
+	.uleb128 0x8
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1ec
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1675
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x166
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0xa
+	.long	0x1e7
+	.uleb128 0x3
+	.long	.LASF1676
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x18c
+	.uleb128 0x12
+	.long	0x1f1
+	.uleb128 0x3
+	.long	.LASF1677
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF1678
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xf6
+	.uleb128 0xb
+	.long	.LASF1680
+	.byte	0xa
+	.byte	0x5
+	.byte	0x49
+	.long	0x282
+	.uleb128 0x2
+	.long	.LASF1681
+	.byte	0x5
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1682
+	.byte	0x5
+	.byte	0x4d
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0x8
+	.string	"day"
+	.byte	0x5
+	.byte	0x4f
+	.byte	0xd
+	.long	0xcd
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1683
+	.byte	0x5
+	.byte	0x51
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1684
+	.byte	0x5
+	.byte	0x53
+	.byte	0xd
+	.long	0xcd
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1685
+	.byte	0x5
+	.byte	0x55
+	.byte	0xd
+	.long	0xcd
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1686
+	.byte	0x5
+	.byte	0x57
+	.byte	0xe
+	.long	0xd9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0x5
+	.byte	0x58
+	.byte	0x3
+	.long	0x21a
+	.uleb128 0x32
+	.long	.LASF1694
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x6
+	.byte	0x78
+	.byte	0xe
+	.long	0x2c5
+	.uleb128 0x1
+	.long	.LASF1688
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1689
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1690
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1691
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1694
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x3
+	.long	0x28e
+	.uleb128 0xb
+	.long	.LASF1695
+	.byte	0x4
+	.byte	0x6
+	.byte	0x81
+	.long	0x2eb
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x6
+	.byte	0x82
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1697
+	.byte	0x6
+	.byte	0x83
+	.byte	0x3
+	.long	0x2d1
+	.uleb128 0xb
+	.long	.LASF1698
+	.byte	0x8
+	.byte	0x6
+	.byte	0x85
+	.long	0x31e
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x6
+	.byte	0x86
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0x6
+	.byte	0x87
+	.byte	0xe
+	.long	0xe5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1701
+	.byte	0x6
+	.byte	0x88
+	.byte	0x3
+	.long	0x2f7
+	.uleb128 0xb
+	.long	.LASF1702
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8a
+	.long	0x36b
+	.uleb128 0x2
+	.long	.LASF1703
+	.byte	0x6
+	.byte	0x8b
+	.byte	0xd
+	.long	0xcd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1704
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x9
+	.long	0x36b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1705
+	.byte	0x6
+	.byte	0x8d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1706
+	.byte	0x6
+	.byte	0x8e
+	.byte	0xb
+	.long	0x102
+	.byte	0x8
+	.byte	0
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1707
+	.uleb128 0x12
+	.long	0x36b
+	.uleb128 0x3
+	.long	.LASF1708
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x3
+	.long	0x32a
+	.uleb128 0xb
+	.long	.LASF1709
+	.byte	0x10
+	.byte	0x6
+	.byte	0x91
+	.long	0x3aa
+	.uleb128 0x2
+	.long	.LASF1710
+	.byte	0x6
+	.byte	0x92
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1711
+	.byte	0x6
+	.byte	0x93
+	.byte	0xe
+	.long	0x20e
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1712
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x383
+	.uleb128 0xb
+	.long	.LASF1713
+	.byte	0x4
+	.byte	0x6
+	.byte	0x96
+	.long	0x3d0
+	.uleb128 0x2
+	.long	.LASF1714
+	.byte	0x6
+	.byte	0x97
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1715
+	.byte	0x6
+	.byte	0x98
+	.byte	0x3
+	.long	0x3b6
+	.uleb128 0x2a
+	.long	.LASF2082
+	.byte	0x10
+	.byte	0x6
+	.byte	0x9c
+	.long	0x425
+	.uleb128 0x15
+	.long	.LASF1716
+	.byte	0x6
+	.byte	0x9d
+	.byte	0x1f
+	.long	0x2eb
+	.uleb128 0x15
+	.long	.LASF1717
+	.byte	0x6
+	.byte	0x9e
+	.byte	0x21
+	.long	0x31e
+	.uleb128 0x15
+	.long	.LASF1718
+	.byte	0x6
+	.byte	0x9f
+	.byte	0x29
+	.long	0x377
+	.uleb128 0x15
+	.long	.LASF1719
+	.byte	0x6
+	.byte	0xa0
+	.byte	0x24
+	.long	0x3aa
+	.uleb128 0x15
+	.long	.LASF1720
+	.byte	0x6
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x3d0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1721
+	.byte	0x6
+	.byte	0xa2
+	.byte	0x3
+	.long	0x3dc
+	.uleb128 0x1c
+	.long	0xc1
+	.long	0x441
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1722
+	.byte	0x7
+	.byte	0x17
+	.byte	0x10
+	.long	0x431
+	.uleb128 0xf
+	.long	.LASF1723
+	.byte	0x7
+	.byte	0x18
+	.byte	0x10
+	.long	0xcd
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x7
+	.byte	0x33
+	.long	0x501
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x19
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x8
+	.byte	0x14
+	.long	0x519
+	.uleb128 0x24
+	.string	"X"
+	.byte	0
+	.uleb128 0x24
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x24
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1750
+	.byte	0xc
+	.byte	0x9
+	.byte	0x1a
+	.long	0x54b
+	.uleb128 0x2
+	.long	.LASF1751
+	.byte	0x9
+	.byte	0x1b
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x8
+	.string	"RC"
+	.byte	0x9
+	.byte	0x1c
+	.byte	0xb
+	.long	0x102
+	.byte	0x4
+	.uleb128 0x8
+	.string	"dT"
+	.byte	0x9
+	.byte	0x1d
+	.byte	0xb
+	.long	0x102
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1752
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x3
+	.long	0x519
+	.uleb128 0x1c
+	.long	0x102
+	.long	0x567
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xa
+	.byte	0x15
+	.long	0x5bb
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0xa
+	.byte	0x23
+	.byte	0x3
+	.long	0x567
+	.uleb128 0x18
+	.byte	0xc
+	.byte	0xb
+	.byte	0x1b
+	.byte	0x5
+	.long	0x5f2
+	.uleb128 0x8
+	.string	"x"
+	.byte	0xb
+	.byte	0x1c
+	.byte	0xe
+	.long	0x102
+	.byte	0
+	.uleb128 0x8
+	.string	"y"
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x10
+	.long	0x102
+	.byte	0x4
+	.uleb128 0x8
+	.string	"z"
+	.byte	0xb
+	.byte	0x1c
+	.byte	0x12
+	.long	0x102
+	.byte	0x8
+	.byte	0
+	.uleb128 0x21
+	.byte	0xc
+	.byte	0xb
+	.byte	0x19
+	.byte	0x9
+	.long	0x60b
+	.uleb128 0x1f
+	.string	"v"
+	.byte	0xb
+	.byte	0x1a
+	.byte	0xb
+	.long	0x557
+	.uleb128 0x33
+	.long	0x5c7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1766
+	.byte	0xb
+	.byte	0x1e
+	.byte	0x3
+	.long	0x5f2
+	.uleb128 0x12
+	.long	0x60b
+	.uleb128 0x18
+	.byte	0x24
+	.byte	0xb
+	.byte	0x20
+	.byte	0x9
+	.long	0x631
+	.uleb128 0x8
+	.string	"m"
+	.byte	0xb
+	.byte	0x21
+	.byte	0xb
+	.long	0x631
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	0x102
+	.long	0x647
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0xb
+	.byte	0x22
+	.byte	0x3
+	.long	0x61c
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0xc
+	.byte	0x1d
+	.byte	0x9
+	.long	0x68d
+	.uleb128 0x8
+	.string	"q0"
+	.byte	0xc
+	.byte	0x1e
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x8
+	.string	"q1"
+	.byte	0xc
+	.byte	0x1e
+	.byte	0xf
+	.long	0x102
+	.byte	0x4
+	.uleb128 0x8
+	.string	"q2"
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x13
+	.long	0x102
+	.byte	0x8
+	.uleb128 0x8
+	.string	"q3"
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x17
+	.long	0x102
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0xc
+	.byte	0x1f
+	.byte	0x3
+	.long	0x653
+	.uleb128 0x12
+	.long	0x68d
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0xd
+	.byte	0x7
+	.byte	0x11
+	.long	0xcd
+	.uleb128 0x3
+	.long	.LASF1770
+	.byte	0xd
+	.byte	0x8
+	.byte	0xf
+	.long	0xa7
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xe
+	.byte	0x16
+	.long	0x6e0
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x4
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0xf
+	.byte	0x26
+	.long	0x7db
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF1784
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1785
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF1786
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF1787
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF1788
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF1789
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF1791
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1792
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1793
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1794
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1795
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1796
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1797
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1798
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1799
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1800
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1801
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1802
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1803
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1804
+	.long	0x10000000
+	.uleb128 0x5
+	.long	.LASF1805
+	.long	0x20000000
+	.uleb128 0x5
+	.long	.LASF1806
+	.long	0x40000000
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x10
+	.byte	0x15
+	.long	0x8a6
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF1810
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1811
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF1812
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF1813
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF1814
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF1815
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF1816
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF1817
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1818
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1819
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1820
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1821
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1822
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1823
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1824
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1825
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1826
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1827
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1828
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1829
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1830
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1831
+	.byte	0x10
+	.byte	0x47
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0xa
+	.long	0xb0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x10
+	.byte	0x6c
+	.long	0x97c
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF1840
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1841
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF1842
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF1843
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF1844
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF1845
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF1846
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF1847
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1848
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1849
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1850
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1851
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1852
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1853
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1854
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1855
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1856
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1857
+	.byte	0x10
+	.byte	0x8c
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0xf
+	.long	.LASF1858
+	.byte	0x11
+	.byte	0x1b
+	.byte	0x14
+	.long	0x60b
+	.uleb128 0xf
+	.long	.LASF1859
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x14
+	.long	0x60b
+	.uleb128 0x18
+	.byte	0x6
+	.byte	0x11
+	.byte	0x20
+	.byte	0x5
+	.long	0x9d1
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0x11
+	.byte	0x22
+	.byte	0x11
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x11
+	.byte	0x23
+	.byte	0x11
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0x11
+	.byte	0x24
+	.byte	0x11
+	.long	0xb5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x21
+	.byte	0x6
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x9
+	.long	0x9f3
+	.uleb128 0x1f
+	.string	"raw"
+	.byte	0x11
+	.byte	0x1f
+	.byte	0xd
+	.long	0x9f3
+	.uleb128 0x15
+	.long	.LASF1862
+	.byte	0x11
+	.byte	0x25
+	.byte	0x7
+	.long	0x9a0
+	.byte	0
+	.uleb128 0x1c
+	.long	0xb5
+	.long	0xa03
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1863
+	.byte	0x11
+	.byte	0x26
+	.byte	0x3
+	.long	0x9d1
+	.uleb128 0xf
+	.long	.LASF1864
+	.byte	0x11
+	.byte	0x28
+	.byte	0x17
+	.long	0x68d
+	.uleb128 0xf
+	.long	.LASF1865
+	.byte	0x11
+	.byte	0x29
+	.byte	0x1e
+	.long	0xa03
+	.uleb128 0xf
+	.long	.LASF1866
+	.byte	0x11
+	.byte	0x2a
+	.byte	0xe
+	.long	0x631
+	.uleb128 0xb
+	.long	.LASF1867
+	.byte	0xc
+	.byte	0x11
+	.byte	0x2c
+	.long	0xa9b
+	.uleb128 0x2
+	.long	.LASF1868
+	.byte	0x11
+	.byte	0x2d
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1869
+	.byte	0x11
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1870
+	.byte	0x11
+	.byte	0x2f
+	.byte	0xe
+	.long	0xd9
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1871
+	.byte	0x11
+	.byte	0x30
+	.byte	0xe
+	.long	0xd9
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1872
+	.byte	0x11
+	.byte	0x31
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1873
+	.byte	0x11
+	.byte	0x32
+	.byte	0xd
+	.long	0xcd
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1874
+	.byte	0x11
+	.byte	0x33
+	.byte	0xd
+	.long	0xcd
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1875
+	.byte	0x11
+	.byte	0x34
+	.byte	0x3
+	.long	0xa33
+	.uleb128 0x12
+	.long	0xa9b
+	.uleb128 0xf
+	.long	.LASF1876
+	.byte	0x11
+	.byte	0x36
+	.byte	0x14
+	.long	0xa9b
+	.uleb128 0xf
+	.long	.LASF1877
+	.byte	0x11
+	.byte	0x36
+	.byte	0x39
+	.long	0xa9b
+	.uleb128 0xb
+	.long	.LASF1878
+	.byte	0x14
+	.byte	0x11
+	.byte	0x38
+	.long	0xb12
+	.uleb128 0x2
+	.long	.LASF1868
+	.byte	0x11
+	.byte	0x39
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1869
+	.byte	0x11
+	.byte	0x3a
+	.byte	0xb
+	.long	0x102
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1870
+	.byte	0x11
+	.byte	0x3b
+	.byte	0xb
+	.long	0x102
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1871
+	.byte	0x11
+	.byte	0x3c
+	.byte	0xb
+	.long	0x102
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1872
+	.byte	0x11
+	.byte	0x3d
+	.byte	0xd
+	.long	0xcd
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1879
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x3
+	.long	0xac4
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x12
+	.byte	0x39
+	.long	0xb72
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0xb
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x13
+	.byte	0x50
+	.long	0xb90
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1895
+	.byte	0x13
+	.byte	0x54
+	.byte	0x3
+	.long	0xb72
+	.uleb128 0xb
+	.long	.LASF1896
+	.byte	0xc
+	.byte	0x13
+	.byte	0x6a
+	.long	0xbd0
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0x13
+	.byte	0x6b
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0x13
+	.byte	0x6c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0x13
+	.byte	0x6d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1897
+	.byte	0x13
+	.byte	0x6e
+	.byte	0x3
+	.long	0xb9c
+	.uleb128 0x18
+	.byte	0x7
+	.byte	0x13
+	.byte	0x73
+	.byte	0x5
+	.long	0xc41
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0x13
+	.byte	0x74
+	.byte	0xd
+	.long	0x36b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0x13
+	.byte	0x75
+	.byte	0xd
+	.long	0x36b
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x13
+	.byte	0x76
+	.byte	0xd
+	.long	0x36b
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0x13
+	.byte	0x77
+	.byte	0xd
+	.long	0x36b
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0x13
+	.byte	0x78
+	.byte	0xd
+	.long	0x36b
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0x13
+	.byte	0x79
+	.byte	0xd
+	.long	0x36b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0x13
+	.byte	0x7a
+	.byte	0xd
+	.long	0x36b
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1905
+	.byte	0x3c
+	.byte	0x13
+	.byte	0x72
+	.long	0xcea
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x13
+	.byte	0x7b
+	.byte	0x7
+	.long	0xbdc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0x13
+	.byte	0x7d
+	.byte	0x12
+	.long	0xb90
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0x13
+	.byte	0x7e
+	.byte	0xd
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0x13
+	.byte	0x80
+	.byte	0x13
+	.long	0xbd0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1908
+	.byte	0x13
+	.byte	0x81
+	.byte	0xd
+	.long	0x9f3
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x13
+	.byte	0x82
+	.byte	0xd
+	.long	0x9f3
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0x13
+	.byte	0x84
+	.byte	0xd
+	.long	0xb5
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0x13
+	.byte	0x85
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2a
+	.uleb128 0x8
+	.string	"eph"
+	.byte	0x13
+	.byte	0x87
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2c
+	.uleb128 0x8
+	.string	"epv"
+	.byte	0x13
+	.byte	0x88
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0x13
+	.byte	0x8a
+	.byte	0xe
+	.long	0xd9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0x13
+	.byte	0x8c
+	.byte	0x10
+	.long	0x282
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1913
+	.byte	0x13
+	.byte	0x8e
+	.byte	0x3
+	.long	0xc41
+	.uleb128 0xf
+	.long	.LASF1914
+	.byte	0x13
+	.byte	0x97
+	.byte	0x1a
+	.long	0xcea
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x14
+	.byte	0x16
+	.long	0xdf2
+	.uleb128 0x1
+	.long	.LASF1915
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1916
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1917
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1918
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1944
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1945
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x25
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x14
+	.byte	0x43
+	.long	0xe7c
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x14
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x15
+	.byte	0x3a
+	.long	0xea6
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1979
+	.byte	0x15
+	.byte	0x40
+	.byte	0x3
+	.long	0xe7c
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x15
+	.byte	0x4b
+	.long	0xfea
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2030
+	.byte	0x15
+	.byte	0x94
+	.byte	0x3
+	.long	0xeb2
+	.uleb128 0x2b
+	.byte	0xa6
+	.uleb128 0xb
+	.long	.LASF2031
+	.byte	0x18
+	.byte	0x15
+	.byte	0x9f
+	.long	0x106d
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0x15
+	.byte	0xa0
+	.byte	0xc
+	.long	0xa7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0x15
+	.byte	0xa1
+	.byte	0xf
+	.long	0xea6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2034
+	.byte	0x15
+	.byte	0xa2
+	.byte	0x17
+	.long	0xfea
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x15
+	.byte	0xa3
+	.byte	0xd
+	.long	0xcd
+	.byte	0x10
+	.uleb128 0x8
+	.string	"tag"
+	.byte	0x15
+	.byte	0xa4
+	.byte	0xd
+	.long	0xcd
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2035
+	.byte	0x15
+	.byte	0xa5
+	.byte	0xd
+	.long	0xcd
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0x15
+	.byte	0xb3
+	.byte	0x7
+	.long	0xff6
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2037
+	.byte	0x15
+	.byte	0xb4
+	.byte	0xd
+	.long	0x69e
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2038
+	.byte	0x15
+	.byte	0xb5
+	.byte	0x3
+	.long	0xff8
+	.uleb128 0x12
+	.long	0x106d
+	.uleb128 0x2b
+	.byte	0xbc
+	.uleb128 0xb
+	.long	.LASF2039
+	.byte	0x28
+	.byte	0x15
+	.byte	0xb7
+	.long	0x10e8
+	.uleb128 0x2
+	.long	.LASF2040
+	.byte	0x15
+	.byte	0xb8
+	.byte	0x23
+	.long	0x10e8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0x15
+	.byte	0xb9
+	.byte	0xf
+	.long	0xea6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0x15
+	.byte	0xba
+	.byte	0xe
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2035
+	.byte	0x15
+	.byte	0xbb
+	.byte	0xe
+	.long	0xe5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0x15
+	.byte	0xc9
+	.byte	0x7
+	.long	0x107e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2037
+	.byte	0x15
+	.byte	0xca
+	.byte	0xa
+	.long	0x6aa
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0x15
+	.byte	0xcb
+	.byte	0x10
+	.long	0x10ed
+	.byte	0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0x1079
+	.uleb128 0xa
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2042
+	.byte	0x15
+	.byte	0xce
+	.byte	0x3
+	.long	0x1080
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x16
+	.byte	0x1a
+	.long	0x1140
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2052
+	.byte	0x16
+	.byte	0x24
+	.byte	0x3
+	.long	0x10fe
+	.uleb128 0x3
+	.long	.LASF2053
+	.byte	0x16
+	.byte	0x2a
+	.byte	0x10
+	.long	0x1158
+	.uleb128 0xa
+	.long	0x115d
+	.uleb128 0x29
+	.long	0x1168
+	.uleb128 0x6
+	.long	0x1168
+	.byte	0
+	.uleb128 0xa
+	.long	0x116d
+	.uleb128 0xb
+	.long	.LASF2054
+	.byte	0x28
+	.byte	0x17
+	.byte	0x4d
+	.long	0x11d5
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x17
+	.byte	0x4e
+	.byte	0x13
+	.long	0x1281
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0x17
+	.byte	0x4f
+	.byte	0x1a
+	.long	0x114c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2057
+	.byte	0x17
+	.byte	0x50
+	.byte	0x1a
+	.long	0x11d5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0x17
+	.byte	0x51
+	.byte	0xe
+	.long	0xd9
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2059
+	.byte	0x17
+	.byte	0x52
+	.byte	0xd
+	.long	0x9f3
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2060
+	.byte	0x17
+	.byte	0x53
+	.byte	0xd
+	.long	0xcd
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x17
+	.byte	0x54
+	.byte	0x14
+	.long	0x1140
+	.byte	0x24
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2062
+	.byte	0x16
+	.byte	0x2b
+	.byte	0xf
+	.long	0x11e1
+	.uleb128 0xa
+	.long	0x11e6
+	.uleb128 0x2c
+	.long	0x36b
+	.long	0x11f5
+	.uleb128 0x6
+	.long	0x1168
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2063
+	.byte	0x16
+	.byte	0x33
+	.byte	0xf
+	.long	0x1201
+	.uleb128 0xa
+	.long	0x1206
+	.uleb128 0x2c
+	.long	0x36b
+	.long	0x1215
+	.uleb128 0x6
+	.long	0x1215
+	.byte	0
+	.uleb128 0xa
+	.long	0x121a
+	.uleb128 0xb
+	.long	.LASF2064
+	.byte	0x48
+	.byte	0x18
+	.byte	0x18
+	.long	0x1275
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x18
+	.byte	0x19
+	.byte	0x13
+	.long	0x1281
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x18
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x11f5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0x18
+	.byte	0x1b
+	.byte	0x1a
+	.long	0x1275
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x18
+	.byte	0x22
+	.byte	0x7
+	.long	0x1477
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x18
+	.byte	0x23
+	.byte	0xd
+	.long	0xcd
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x18
+	.byte	0x24
+	.byte	0xd
+	.long	0x9f3
+	.byte	0x42
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2070
+	.byte	0x16
+	.byte	0x34
+	.byte	0xf
+	.long	0x1201
+	.uleb128 0xa
+	.long	0x10f2
+	.uleb128 0x3
+	.long	.LASF2071
+	.byte	0x17
+	.byte	0x55
+	.byte	0x3
+	.long	0x116d
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x19
+	.byte	0x14
+	.long	0x12ce
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF2080
+	.byte	0x6
+	.byte	0x19
+	.byte	0x1f
+	.long	0x1302
+	.uleb128 0x2
+	.long	.LASF1860
+	.byte	0x19
+	.byte	0x20
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1861
+	.byte	0x19
+	.byte	0x21
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2
+	.uleb128 0x8
+	.string	"yaw"
+	.byte	0x19
+	.byte	0x22
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2081
+	.byte	0x19
+	.byte	0x23
+	.byte	0x3
+	.long	0x12ce
+	.uleb128 0x2a
+	.long	.LASF2083
+	.byte	0x6
+	.byte	0x19
+	.byte	0x25
+	.long	0x1333
+	.uleb128 0x1f
+	.string	"raw"
+	.byte	0x19
+	.byte	0x26
+	.byte	0xd
+	.long	0x9f3
+	.uleb128 0x15
+	.long	.LASF1862
+	.byte	0x19
+	.byte	0x27
+	.byte	0x1f
+	.long	0x1302
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2084
+	.byte	0x19
+	.byte	0x28
+	.byte	0x3
+	.long	0x130e
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x19
+	.byte	0x30
+	.long	0x1389
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF2093
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF2094
+	.value	0x200
+	.byte	0
+	.uleb128 0x18
+	.byte	0x8
+	.byte	0x1a
+	.byte	0x34
+	.byte	0x9
+	.long	0x13ad
+	.uleb128 0x8
+	.string	"min"
+	.byte	0x1a
+	.byte	0x35
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x8
+	.string	"max"
+	.byte	0x1a
+	.byte	0x36
+	.byte	0xb
+	.long	0x102
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2095
+	.byte	0x1a
+	.byte	0x37
+	.byte	0x3
+	.long	0x1389
+	.uleb128 0xb
+	.long	.LASF2096
+	.byte	0x68
+	.byte	0x1a
+	.byte	0x39
+	.long	0x142e
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x1a
+	.byte	0x3a
+	.byte	0xe
+	.long	0x1286
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2097
+	.byte	0x1a
+	.byte	0x3b
+	.byte	0xe
+	.long	0xe5
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2098
+	.byte	0x1a
+	.byte	0x3c
+	.byte	0xb
+	.long	0x557
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2099
+	.byte	0x1a
+	.byte	0x3d
+	.byte	0xb
+	.long	0x557
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2100
+	.byte	0x1a
+	.byte	0x3e
+	.byte	0xe
+	.long	0xe5
+	.byte	0x44
+	.uleb128 0x2
+	.long	.LASF2101
+	.byte	0x1a
+	.byte	0x3f
+	.byte	0x9
+	.long	0x36b
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2102
+	.byte	0x1a
+	.byte	0x40
+	.byte	0x14
+	.long	0x142e
+	.byte	0x4c
+	.uleb128 0x2
+	.long	.LASF2103
+	.byte	0x1a
+	.byte	0x41
+	.byte	0xb
+	.long	0x102
+	.byte	0x64
+	.byte	0
+	.uleb128 0x1c
+	.long	0x13ad
+	.long	0x143e
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2104
+	.byte	0x1a
+	.byte	0x42
+	.byte	0x3
+	.long	0x13b9
+	.uleb128 0x2d
+	.string	"acc"
+	.byte	0x1a
+	.byte	0x44
+	.long	0x143e
+	.uleb128 0x21
+	.byte	0x24
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x9
+	.long	0x1477
+	.uleb128 0x15
+	.long	.LASF2105
+	.byte	0x18
+	.byte	0x1f
+	.byte	0x16
+	.long	0x647
+	.uleb128 0x15
+	.long	.LASF2106
+	.byte	0x18
+	.byte	0x20
+	.byte	0x1c
+	.long	0x1140
+	.byte	0
+	.uleb128 0x18
+	.byte	0x28
+	.byte	0x18
+	.byte	0x1c
+	.byte	0x5
+	.long	0x1494
+	.uleb128 0x2
+	.long	.LASF2107
+	.byte	0x18
+	.byte	0x1d
+	.byte	0xd
+	.long	0x36b
+	.byte	0
+	.uleb128 0x34
+	.long	0x1455
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2108
+	.byte	0x18
+	.byte	0x25
+	.byte	0x3
+	.long	0x121a
+	.uleb128 0xb
+	.long	.LASF2109
+	.byte	0x58
+	.byte	0x1b
+	.byte	0x30
+	.long	0x14c7
+	.uleb128 0x8
+	.string	"dev"
+	.byte	0x1b
+	.byte	0x31
+	.byte	0xe
+	.long	0x1494
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2110
+	.byte	0x1b
+	.byte	0x32
+	.byte	0xd
+	.long	0x14c7
+	.byte	0x48
+	.byte	0
+	.uleb128 0x1c
+	.long	0xc1
+	.long	0x14d7
+	.uleb128 0x17
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2111
+	.byte	0x1b
+	.byte	0x33
+	.byte	0x3
+	.long	0x14a0
+	.uleb128 0x2d
+	.string	"mag"
+	.byte	0x1b
+	.byte	0x35
+	.long	0x14d7
+	.uleb128 0xb
+	.long	.LASF2112
+	.byte	0x18
+	.byte	0x1b
+	.byte	0x37
+	.long	0x1570
+	.uleb128 0x2
+	.long	.LASF2113
+	.byte	0x1b
+	.byte	0x38
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2114
+	.byte	0x1b
+	.byte	0x3a
+	.byte	0x14
+	.long	0x1140
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2115
+	.byte	0x1b
+	.byte	0x3b
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2116
+	.byte	0x1b
+	.byte	0x3c
+	.byte	0x1b
+	.long	0x1333
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2117
+	.byte	0x1b
+	.byte	0x3d
+	.byte	0xd
+	.long	0xcd
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x1b
+	.byte	0x3e
+	.byte	0xd
+	.long	0xcd
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x1b
+	.byte	0x3f
+	.byte	0xd
+	.long	0xb5
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x1b
+	.byte	0x40
+	.byte	0xd
+	.long	0xb5
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0x1b
+	.byte	0x41
+	.byte	0xd
+	.long	0xb5
+	.byte	0x16
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2122
+	.byte	0x1b
+	.byte	0x42
+	.byte	0x3
+	.long	0x14ee
+	.uleb128 0x12
+	.long	0x1570
+	.uleb128 0xf
+	.long	.LASF2123
+	.byte	0x1b
+	.byte	0x44
+	.byte	0x18
+	.long	0x1570
+	.uleb128 0x19
+	.long	0x988
+	.byte	0x53
+	.byte	0x43
+	.uleb128 0x19
+	.long	0x994
+	.byte	0x54
+	.byte	0x43
+	.uleb128 0x1d
+	.long	.LASF2124
+	.byte	0x55
+	.byte	0x44
+	.long	0x102
+	.uleb128 0x1d
+	.long	.LASF2125
+	.byte	0x57
+	.byte	0x14
+	.long	0x36b
+	.uleb128 0x1d
+	.long	.LASF2126
+	.byte	0x58
+	.byte	0x4a
+	.long	0x60b
+	.uleb128 0x19
+	.long	0xa0f
+	.byte	0x5a
+	.byte	0x46
+	.uleb128 0x19
+	.long	0xa1b
+	.byte	0x5b
+	.byte	0x4d
+	.uleb128 0x19
+	.long	0xa27
+	.byte	0x5c
+	.byte	0x3d
+	.uleb128 0x1d
+	.long	.LASF2127
+	.byte	0x5e
+	.byte	0x51
+	.long	0xb12
+	.uleb128 0x1d
+	.long	.LASF2128
+	.byte	0x5f
+	.byte	0x4a
+	.long	0x54b
+	.uleb128 0x1d
+	.long	.LASF2129
+	.byte	0x61
+	.byte	0x14
+	.long	0x36b
+	.uleb128 0xf
+	.long	.LASF2130
+	.byte	0x1c
+	.byte	0x63
+	.byte	0x1a
+	.long	0xaa7
+	.uleb128 0x19
+	.long	0xaac
+	.byte	0x63
+	.byte	0x41
+	.uleb128 0x19
+	.long	0xab8
+	.byte	0x63
+	.byte	0x5f
+	.uleb128 0xf
+	.long	.LASF2131
+	.byte	0x1c
+	.byte	0x63
+	.byte	0x89
+	.long	0x1fd
+	.uleb128 0x35
+	.long	0x160c
+	.byte	0xb0
+	.uleb128 0x36
+	.long	0x15f2
+	.byte	0x65
+	.byte	0x13
+	.uleb128 0x20
+	.long	.LASF2141
+	.byte	0x21
+	.byte	0x7d
+	.byte	0x5
+	.long	0x36b
+	.uleb128 0x13
+	.long	.LASF2132
+	.byte	0x1d
+	.byte	0xa2
+	.byte	0x7
+	.long	0x102
+	.long	0x1647
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2133
+	.byte	0x1d
+	.byte	0xa1
+	.byte	0x7
+	.long	0x102
+	.long	0x1662
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2135
+	.byte	0x1f
+	.byte	0x22
+	.long	0x1678
+	.uleb128 0x6
+	.long	0x2c5
+	.uleb128 0x6
+	.long	0x1678
+	.byte	0
+	.uleb128 0xa
+	.long	0x425
+	.uleb128 0x13
+	.long	.LASF2134
+	.byte	0x1e
+	.byte	0x1e
+	.byte	0x5
+	.long	0x36b
+	.long	0x1693
+	.uleb128 0x6
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2136
+	.byte	0xa
+	.byte	0x2f
+	.long	0x16af
+	.uleb128 0x6
+	.long	0x5bb
+	.uleb128 0x6
+	.long	0x30
+	.uleb128 0x6
+	.long	0x8b2
+	.uleb128 0x37
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2137
+	.byte	0x1d
+	.byte	0x91
+	.byte	0x7
+	.long	0x102
+	.long	0x16d9
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2138
+	.byte	0x1d
+	.byte	0x88
+	.byte	0x7
+	.long	0x102
+	.long	0x16f9
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2139
+	.byte	0x9
+	.byte	0x59
+	.byte	0x7
+	.long	0x102
+	.long	0x171e
+	.uleb128 0x6
+	.long	0x171e
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0xa
+	.long	0x54b
+	.uleb128 0x13
+	.long	.LASF2140
+	.byte	0x20
+	.byte	0x8f
+	.byte	0xe
+	.long	0x102
+	.long	0x1739
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1686
+	.byte	0x22
+	.byte	0x1d
+	.byte	0xa
+	.long	0x202
+	.uleb128 0x1a
+	.long	.LASF2142
+	.byte	0x12
+	.byte	0xc0
+	.long	0x1756
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2143
+	.byte	0x13
+	.byte	0xa3
+	.byte	0x5
+	.long	0x36b
+	.uleb128 0x20
+	.long	.LASF2144
+	.byte	0x1b
+	.byte	0x4a
+	.byte	0x5
+	.long	0x36b
+	.uleb128 0x1a
+	.long	.LASF2145
+	.byte	0x1a
+	.byte	0x56
+	.long	0x177f
+	.uleb128 0x6
+	.long	0x177f
+	.byte	0
+	.uleb128 0xa
+	.long	0x60b
+	.uleb128 0x1a
+	.long	.LASF2146
+	.byte	0x21
+	.byte	0x7a
+	.long	0x1795
+	.uleb128 0x6
+	.long	0x177f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2147
+	.byte	0x1a
+	.byte	0x5c
+	.byte	0xa
+	.long	0xe5
+	.uleb128 0x1a
+	.long	.LASF2148
+	.byte	0x1a
+	.byte	0x5a
+	.long	0x17b2
+	.uleb128 0x6
+	.long	0x177f
+	.byte	0
+	.uleb128 0x38
+	.long	.LASF2154
+	.byte	0x1a
+	.byte	0x5e
+	.byte	0x6
+	.uleb128 0x13
+	.long	.LASF2149
+	.byte	0x10
+	.byte	0xa3
+	.byte	0x5
+	.long	0x36b
+	.long	0x17d0
+	.uleb128 0x6
+	.long	0xe5
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2150
+	.byte	0x1d
+	.byte	0x9f
+	.byte	0x7
+	.long	0x102
+	.long	0x17e6
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2151
+	.byte	0x9
+	.byte	0x5a
+	.long	0x17fc
+	.uleb128 0x6
+	.long	0x171e
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2152
+	.byte	0x1d
+	.byte	0xa0
+	.byte	0x7
+	.long	0x102
+	.long	0x1812
+	.uleb128 0x6
+	.long	0x102
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2153
+	.byte	0x1d
+	.byte	0x8e
+	.byte	0x7
+	.long	0x102
+	.long	0x1828
+	.uleb128 0x6
+	.long	0xb5
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2155
+	.value	0x2a6
+	.byte	0x7
+	.long	0x102
+	.uleb128 0x25
+	.long	.LASF2156
+	.value	0x2a1
+	.byte	0x5
+	.long	0x36b
+	.uleb128 0x25
+	.long	.LASF2157
+	.value	0x29c
+	.byte	0x5
+	.long	0x36b
+	.uleb128 0x2e
+	.long	.LASF2159
+	.value	0x27c
+	.long	0x187c
+	.uleb128 0x14
+	.long	.LASF1711
+	.value	0x27c
+	.byte	0x21
+	.long	0x20e
+	.uleb128 0x4
+	.long	.LASF2158
+	.value	0x27f
+	.byte	0x15
+	.long	0x20e
+	.uleb128 0x39
+	.string	"dT"
+	.byte	0x1c
+	.value	0x280
+	.byte	0x11
+	.long	0x109
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2160
+	.value	0x26e
+	.long	0x18a0
+	.uleb128 0x4
+	.long	.LASF2161
+	.value	0x270
+	.byte	0x11
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2100
+	.value	0x273
+	.byte	0x14
+	.long	0xf1
+	.byte	0
+	.uleb128 0x3a
+	.long	.LASF2232
+	.byte	0x1c
+	.value	0x25f
+	.byte	0x6
+	.uleb128 0x26
+	.long	.LASF2181
+	.value	0x20c
+	.long	0x192e
+	.uleb128 0x27
+	.string	"dT"
+	.value	0x20c
+	.byte	0x31
+	.long	0x102
+	.uleb128 0x4
+	.long	.LASF2162
+	.value	0x20f
+	.byte	0xf
+	.long	0x372
+	.uleb128 0x4
+	.long	.LASF2163
+	.value	0x214
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x4
+	.long	.LASF2164
+	.value	0x215
+	.byte	0x9
+	.long	0x36b
+	.uleb128 0x4
+	.long	.LASF2165
+	.value	0x216
+	.byte	0x9
+	.long	0x36b
+	.uleb128 0x4
+	.long	.LASF2166
+	.value	0x23d
+	.byte	0x11
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2167
+	.value	0x23f
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2168
+	.value	0x240
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2169
+	.value	0x241
+	.byte	0xf
+	.long	0x372
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2170
+	.value	0x21a
+	.byte	0xd
+	.long	0x36b
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.long	.LASF2208
+	.byte	0x1c
+	.value	0x1d9
+	.byte	0xe
+	.long	0x102
+	.long	0x19d3
+	.uleb128 0x27
+	.string	"dT"
+	.value	0x1d9
+	.byte	0x3a
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2171
+	.value	0x1dc
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x4
+	.long	.LASF2172
+	.value	0x1e3
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2173
+	.value	0x1e4
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2174
+	.value	0x1f6
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x1e
+	.long	0x198c
+	.uleb128 0x4
+	.long	.LASF2175
+	.value	0x1de
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1e
+	.long	0x199e
+	.uleb128 0x4
+	.long	.LASF2176
+	.value	0x1e3
+	.byte	0x58
+	.long	0x102
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2177
+	.value	0x1f9
+	.byte	0x15
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2178
+	.value	0x1fa
+	.byte	0x15
+	.long	0x109
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2179
+	.value	0x1fd
+	.byte	0x19
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2180
+	.value	0x1fe
+	.byte	0x19
+	.long	0x109
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.long	.LASF2266
+	.byte	0x1c
+	.value	0x1c7
+	.byte	0xd
+	.uleb128 0x26
+	.long	.LASF2182
+	.value	0x126
+	.long	0x1b4b
+	.uleb128 0x27
+	.string	"dt"
+	.value	0x126
+	.byte	0x27
+	.long	0x102
+	.uleb128 0x14
+	.long	.LASF2183
+	.value	0x126
+	.byte	0x3f
+	.long	0x1b4b
+	.uleb128 0x14
+	.long	.LASF2184
+	.value	0x126
+	.byte	0x5b
+	.long	0x1b4b
+	.uleb128 0x14
+	.long	.LASF2185
+	.value	0x126
+	.byte	0x76
+	.long	0x1b4b
+	.uleb128 0x14
+	.long	.LASF2165
+	.value	0x126
+	.byte	0x81
+	.long	0x36b
+	.uleb128 0x14
+	.long	.LASF2163
+	.value	0x126
+	.byte	0x8f
+	.long	0x102
+	.uleb128 0x14
+	.long	.LASF2186
+	.value	0x126
+	.byte	0xa7
+	.long	0x102
+	.uleb128 0x14
+	.long	.LASF2187
+	.value	0x126
+	.byte	0xb9
+	.long	0x102
+	.uleb128 0x3d
+	.long	.LASF2188
+	.byte	0x1c
+	.value	0x128
+	.byte	0x4e
+	.long	0x60b
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF2189
+	.value	0x12a
+	.byte	0x14
+	.long	0x68d
+	.uleb128 0x4
+	.long	.LASF2190
+	.value	0x12b
+	.byte	0x11
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2191
+	.value	0x12e
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2192
+	.value	0x1a3
+	.byte	0x11
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2193
+	.value	0x1a4
+	.byte	0x14
+	.long	0x68d
+	.uleb128 0x4
+	.long	.LASF2194
+	.value	0x1a8
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x1e
+	.long	0x1af8
+	.uleb128 0x4
+	.long	.LASF2195
+	.value	0x133
+	.byte	0x22
+	.long	0x617
+	.uleb128 0x4
+	.long	.LASF2196
+	.value	0x135
+	.byte	0x15
+	.long	0x60b
+	.uleb128 0x1e
+	.long	0x1acb
+	.uleb128 0x4
+	.long	.LASF2197
+	.value	0x138
+	.byte	0x19
+	.long	0x60b
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1ae9
+	.uleb128 0x4
+	.long	.LASF2198
+	.value	0x152
+	.byte	0x19
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2199
+	.value	0x15d
+	.byte	0x19
+	.long	0x60b
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2200
+	.value	0x174
+	.byte	0x1d
+	.long	0x60b
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	0x1b3c
+	.uleb128 0x4
+	.long	.LASF2201
+	.value	0x184
+	.byte	0x22
+	.long	0x617
+	.uleb128 0x4
+	.long	.LASF2202
+	.value	0x185
+	.byte	0x15
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2203
+	.value	0x185
+	.byte	0x22
+	.long	0x60b
+	.uleb128 0x4
+	.long	.LASF2196
+	.value	0x185
+	.byte	0x28
+	.long	0x60b
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2200
+	.value	0x192
+	.byte	0x1d
+	.long	0x60b
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x4
+	.long	.LASF2204
+	.value	0x1b6
+	.byte	0x19
+	.long	0x109
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	0x617
+	.uleb128 0x26
+	.long	.LASF2205
+	.value	0x108
+	.long	0x1b80
+	.uleb128 0x14
+	.long	.LASF2206
+	.value	0x108
+	.byte	0x4a
+	.long	0x1b80
+	.uleb128 0x14
+	.long	.LASF2184
+	.value	0x108
+	.byte	0x64
+	.long	0x1b4b
+	.uleb128 0x4
+	.long	.LASF2207
+	.value	0x10f
+	.byte	0x1f
+	.long	0x3d0
+	.byte	0
+	.uleb128 0xa
+	.long	0x699
+	.uleb128 0x10
+	.long	.LASF2209
+	.byte	0x1c
+	.byte	0xf8
+	.byte	0xc
+	.long	0x36b
+	.long	0x1bba
+	.uleb128 0xc
+	.long	.LASF2206
+	.byte	0x1c
+	.byte	0xf8
+	.byte	0x39
+	.long	0x1b80
+	.uleb128 0x9
+	.long	.LASF2210
+	.byte	0x1c
+	.byte	0xfa
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x4
+	.long	.LASF2211
+	.value	0x100
+	.byte	0x11
+	.long	0x109
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2212
+	.byte	0xec
+	.long	0x1bdd
+	.uleb128 0xc
+	.long	.LASF2184
+	.byte	0x1c
+	.byte	0xec
+	.byte	0x3f
+	.long	0x1b4b
+	.uleb128 0x9
+	.long	.LASF2213
+	.byte	0x1c
+	.byte	0xee
+	.byte	0x11
+	.long	0x109
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2214
+	.byte	0x1c
+	.byte	0xe2
+	.byte	0xe
+	.long	0x102
+	.uleb128 0x22
+	.long	.LASF2215
+	.byte	0x1c
+	.byte	0xdd
+	.byte	0xc
+	.long	0x36b
+	.uleb128 0x28
+	.long	.LASF2216
+	.byte	0xc5
+	.long	0x1c6c
+	.uleb128 0xc
+	.long	.LASF2217
+	.byte	0x1c
+	.byte	0xc5
+	.byte	0x31
+	.long	0xb5
+	.uleb128 0xc
+	.long	.LASF2218
+	.byte	0x1c
+	.byte	0xc5
+	.byte	0x46
+	.long	0xb5
+	.uleb128 0xc
+	.long	.LASF2219
+	.byte	0x1c
+	.byte	0xc5
+	.byte	0x5c
+	.long	0xb5
+	.uleb128 0x9
+	.long	.LASF2220
+	.byte	0x1c
+	.byte	0xcb
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.long	.LASF2221
+	.byte	0x1c
+	.byte	0xcc
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.long	.LASF2222
+	.byte	0x1c
+	.byte	0xce
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.long	.LASF2223
+	.byte	0x1c
+	.byte	0xcf
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.long	.LASF2224
+	.byte	0x1c
+	.byte	0xd1
+	.byte	0x11
+	.long	0x109
+	.uleb128 0x9
+	.long	.LASF2225
+	.byte	0x1c
+	.byte	0xd2
+	.byte	0x11
+	.long	0x109
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2226
+	.byte	0xbb
+	.long	0x1c81
+	.uleb128 0xd
+	.string	"v"
+	.byte	0x1c
+	.byte	0xbb
+	.byte	0x32
+	.long	0x177f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2227
+	.byte	0xb2
+	.long	0x1c96
+	.uleb128 0xd
+	.string	"v"
+	.byte	0x1c
+	.byte	0xb2
+	.byte	0x32
+	.long	0x177f
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2228
+	.byte	0xaa
+	.long	0x1cb9
+	.uleb128 0xc
+	.long	.LASF2229
+	.byte	0x1c
+	.byte	0xaa
+	.byte	0x26
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2230
+	.byte	0x1c
+	.byte	0xac
+	.byte	0x11
+	.long	0x109
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2231
+	.byte	0x92
+	.long	0x1cea
+	.uleb128 0x16
+	.string	"deg"
+	.byte	0x1c
+	.byte	0x9f
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x16
+	.string	"min"
+	.byte	0x1c
+	.byte	0xa0
+	.byte	0xf
+	.long	0x83
+	.uleb128 0x1b
+	.uleb128 0x9
+	.long	.LASF2175
+	.byte	0x1c
+	.byte	0x96
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.long	.LASF2233
+	.byte	0x1c
+	.byte	0x89
+	.byte	0x6
+	.uleb128 0x28
+	.long	.LASF2234
+	.byte	0x6f
+	.long	0x1d69
+	.uleb128 0x9
+	.long	.LASF2235
+	.byte	0x1c
+	.byte	0x71
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2236
+	.byte	0x1c
+	.byte	0x72
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2237
+	.byte	0x1c
+	.byte	0x73
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2238
+	.byte	0x1c
+	.byte	0x75
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2239
+	.byte	0x1c
+	.byte	0x76
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2240
+	.byte	0x1c
+	.byte	0x77
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2241
+	.byte	0x1c
+	.byte	0x78
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2242
+	.byte	0x1c
+	.byte	0x79
+	.byte	0xb
+	.long	0x102
+	.uleb128 0x9
+	.long	.LASF2243
+	.byte	0x1c
+	.byte	0x7a
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF2244
+	.byte	0x1b
+	.byte	0x44
+	.byte	0x7e
+	.long	0x1d75
+	.uleb128 0xa
+	.long	0x157c
+	.uleb128 0x22
+	.long	.LASF2245
+	.byte	0x11
+	.byte	0x36
+	.byte	0x6a
+	.long	0x1d86
+	.uleb128 0xa
+	.long	0xaa7
+	.uleb128 0x10
+	.long	.LASF2246
+	.byte	0xc
+	.byte	0xb6
+	.byte	0x1d
+	.long	0x177f
+	.long	0x1dd8
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0xb6
+	.byte	0x45
+	.long	0x177f
+	.uleb128 0xc
+	.long	.LASF2248
+	.byte	0xc
+	.byte	0xb6
+	.byte	0x61
+	.long	0x1b4b
+	.uleb128 0xd
+	.string	"ref"
+	.byte	0xc
+	.byte	0xb6
+	.byte	0x7e
+	.long	0x1b80
+	.uleb128 0x9
+	.long	.LASF2249
+	.byte	0xc
+	.byte	0xb8
+	.byte	0x14
+	.long	0x68d
+	.uleb128 0x9
+	.long	.LASF2250
+	.byte	0xc
+	.byte	0xb8
+	.byte	0x1e
+	.long	0x68d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2251
+	.byte	0xc
+	.byte	0xa3
+	.byte	0x1d
+	.long	0x177f
+	.long	0x1e25
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0xa3
+	.byte	0x42
+	.long	0x177f
+	.uleb128 0xc
+	.long	.LASF2248
+	.byte	0xc
+	.byte	0xa3
+	.byte	0x5e
+	.long	0x1b4b
+	.uleb128 0xd
+	.string	"ref"
+	.byte	0xc
+	.byte	0xa3
+	.byte	0x7b
+	.long	0x1b80
+	.uleb128 0x9
+	.long	.LASF2249
+	.byte	0xc
+	.byte	0xa5
+	.byte	0x14
+	.long	0x68d
+	.uleb128 0x9
+	.long	.LASF2250
+	.byte	0xc
+	.byte	0xa5
+	.byte	0x1e
+	.long	0x68d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2252
+	.byte	0xc
+	.byte	0x8f
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1e58
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x8f
+	.byte	0x45
+	.long	0x1e58
+	.uleb128 0xd
+	.string	"q"
+	.byte	0xc
+	.byte	0x8f
+	.byte	0x64
+	.long	0x1b80
+	.uleb128 0x16
+	.string	"mod"
+	.byte	0xc
+	.byte	0x91
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0xa
+	.long	0x68d
+	.uleb128 0x10
+	.long	.LASF2253
+	.byte	0xc
+	.byte	0x85
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1e84
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x85
+	.byte	0x45
+	.long	0x1e58
+	.uleb128 0xd
+	.string	"q"
+	.byte	0xc
+	.byte	0x85
+	.byte	0x64
+	.long	0x1b80
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2254
+	.byte	0xc
+	.byte	0x6b
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1ebf
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x6b
+	.byte	0x41
+	.long	0x1e58
+	.uleb128 0xd
+	.string	"a"
+	.byte	0xc
+	.byte	0x6b
+	.byte	0x60
+	.long	0x1b80
+	.uleb128 0xd
+	.string	"b"
+	.byte	0xc
+	.byte	0x6b
+	.byte	0x6f
+	.long	0x109
+	.uleb128 0x16
+	.string	"p"
+	.byte	0xc
+	.byte	0x6d
+	.byte	0x14
+	.long	0x68d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2255
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1efa
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x44
+	.long	0x1e58
+	.uleb128 0xd
+	.string	"a"
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x63
+	.long	0x1b80
+	.uleb128 0xd
+	.string	"b"
+	.byte	0xc
+	.byte	0x5e
+	.byte	0x7d
+	.long	0x1b80
+	.uleb128 0x16
+	.string	"p"
+	.byte	0xc
+	.byte	0x60
+	.byte	0x12
+	.long	0x68d
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2256
+	.byte	0xc
+	.byte	0x59
+	.byte	0x15
+	.long	0x102
+	.long	0x1f15
+	.uleb128 0xd
+	.string	"q"
+	.byte	0xc
+	.byte	0x59
+	.byte	0x41
+	.long	0x1b80
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2257
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1f3c
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x4a
+	.long	0x1e58
+	.uleb128 0xd
+	.string	"v"
+	.byte	0xc
+	.byte	0x2a
+	.byte	0x66
+	.long	0x1b4b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2258
+	.byte	0xc
+	.byte	0x21
+	.byte	0x20
+	.long	0x1e58
+	.long	0x1f59
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x21
+	.byte	0x44
+	.long	0x1e58
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2259
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x1d
+	.long	0x177f
+	.long	0x1f95
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x37
+	.long	0x177f
+	.uleb128 0xd
+	.string	"a"
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x53
+	.long	0x1b4b
+	.uleb128 0xd
+	.string	"b"
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x62
+	.long	0x109
+	.uleb128 0x16
+	.string	"ab"
+	.byte	0xb
+	.byte	0x6e
+	.byte	0x11
+	.long	0x60b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2260
+	.byte	0xb
+	.byte	0x60
+	.byte	0x1d
+	.long	0x177f
+	.long	0x1fd1
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xb
+	.byte	0x60
+	.byte	0x35
+	.long	0x177f
+	.uleb128 0xd
+	.string	"a"
+	.byte	0xb
+	.byte	0x60
+	.byte	0x51
+	.long	0x1b4b
+	.uleb128 0xd
+	.string	"b"
+	.byte	0xb
+	.byte	0x60
+	.byte	0x68
+	.long	0x1b4b
+	.uleb128 0x16
+	.string	"ab"
+	.byte	0xb
+	.byte	0x62
+	.byte	0x11
+	.long	0x60b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2261
+	.byte	0xb
+	.byte	0x54
+	.byte	0x1d
+	.long	0x177f
+	.long	0x200d
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xb
+	.byte	0x54
+	.byte	0x3e
+	.long	0x177f
+	.uleb128 0xd
+	.string	"a"
+	.byte	0xb
+	.byte	0x54
+	.byte	0x5a
+	.long	0x1b4b
+	.uleb128 0xd
+	.string	"b"
+	.byte	0xb
+	.byte	0x54
+	.byte	0x71
+	.long	0x1b4b
+	.uleb128 0x16
+	.string	"ab"
+	.byte	0xb
+	.byte	0x56
+	.byte	0x11
+	.long	0x60b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2262
+	.byte	0xb
+	.byte	0x44
+	.byte	0x1d
+	.long	0x177f
+	.long	0x2040
+	.uleb128 0xc
+	.long	.LASF2247
+	.byte	0xb
+	.byte	0x44
+	.byte	0x3b
+	.long	0x177f
+	.uleb128 0xd
+	.string	"v"
+	.byte	0xb
+	.byte	0x44
+	.byte	0x57
+	.long	0x1b4b
+	.uleb128 0x9
+	.long	.LASF2263
+	.byte	0xb
+	.byte	0x46
+	.byte	0xb
+	.long	0x102
+	.byte	0
+	.uleb128 0x3f
+	.long	.LASF2264
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x15
+	.long	0x102
+	.uleb128 0xd
+	.string	"v"
+	.byte	0xb
+	.byte	0x3f
+	.byte	0x3b
+	.long	0x1b4b
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 4
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 28
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x39
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 35 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.file 38 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x27
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 40 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 41 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 44 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 46 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2e
+	.file 47 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 51 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x34
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF976
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1003
+	.byte	0x4
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 60 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3c
+	.file 61 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 62 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3e
+	.file 63 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 64 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x1b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1322
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 66 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x3f
+	.byte	0x4
+	.file 67 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x43
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1e
+	.byte	0x4
+	.file 68 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x22
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1528
+	.byte	0x4
+	.file 69 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1529
+	.byte	0x4
+	.file 70 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 71 "./src/main/flight/hil.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x11
+	.byte	0x4
+	.file 72 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x36
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x17
+	.file 73 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1584
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1585
+	.file 75 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4c
+	.file 77 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1598
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.file 78 "./src/main/sensors/barometer.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x4e
+	.file 79 "./src/main/drivers/barometer/barometer.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4f
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1642
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF968
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1007
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1333
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1356
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1366
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1368
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.10f237ed61a9ae208342a970c4692795,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1373
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1376
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1456
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1575
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1597
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1615
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1624
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1628
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1639
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x15
+	.long	.LASF1
+	.long	.LASF2267
+	.long	.LASF2268
+	.long	.LASF2269
+	.long	.LASF2270
+	.long	.LASF2271
+	.long	.LASF2272
+	.long	.LASF2273
+	.long	.LASF2274
+	.long	.LASF2275
+	.long	.LASF2276
+	.long	.LASF2277
+	.long	.LASF2278
+	.long	.LASF2279
+	.long	.LASF2280
+	.long	.LASF2281
+	.long	.LASF2282
+	.long	.LASF2283
+	.long	.LASF2284
+	.long	.LASF2285
+	.long	.LASF2286
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x50
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2287
+	.byte	0x10
+	.long	.LASF2288
+	.byte	0x10
+	.long	.LASF2289
+	.byte	0x10
+	.long	.LASF2290
+	.byte	0x4
+	.long	.LASF2291
+	.byte	0x3
+	.long	.LASF2292
+	.byte	0x1
+	.long	.LASF2293
+	.byte	0x2
+	.long	.LASF2294
+	.byte	0x3
+	.long	.LASF2295
+	.byte	0x3
+	.long	.LASF2296
+	.byte	0x3
+	.long	.LASF2297
+	.byte	0x3
+	.long	.LASF2298
+	.byte	0x3
+	.long	.LASF2299
+	.byte	0x8
+	.long	.LASF2300
+	.byte	0x8
+	.long	.LASF2301
+	.byte	0x9
+	.long	.LASF2302
+	.byte	0x9
+	.long	.LASF2303
+	.byte	0xa
+	.long	.LASF2304
+	.byte	0xa
+	.long	.LASF2305
+	.byte	0xb
+	.long	.LASF2306
+	.byte	0x8
+	.long	.LASF2307
+	.byte	0x8
+	.long	.LASF2308
+	.byte	0x8
+	.long	.LASF2309
+	.byte	0x5
+	.long	.LASF2310
+	.byte	0x7
+	.long	.LASF2311
+	.byte	0xc
+	.long	.LASF2312
+	.byte	0xc
+	.long	.LASF2310
+	.byte	0xc
+	.long	.LASF2313
+	.byte	0xa
+	.long	.LASF2314
+	.byte	0x3
+	.long	.LASF2315
+	.byte	0x4
+	.long	.LASF2316
+	.byte	0x1
+	.long	.LASF2317
+	.byte	0x10
+	.long	.LASF2318
+	.byte	0xc
+	.long	.LASF2291
+	.byte	0x8
+	.long	.LASF2319
+	.byte	0x13
+	.long	.LASF2320
+	.byte	0x14
+	.long	.LASF2321
+	.byte	0x14
+	.long	.LASF2321
+	.byte	0x13
+	.long	.LASF2322
+	.byte	0x10
+	.long	.LASF2323
+	.byte	0x13
+	.long	.LASF2324
+	.byte	0x13
+	.long	.LASF2325
+	.byte	0x10
+	.long	.LASF2326
+	.byte	0x10
+	.long	.LASF2327
+	.byte	0x12
+	.long	.LASF2328
+	.byte	0x10
+	.long	.LASF2329
+	.byte	0x11
+	.long	.LASF2330
+	.byte	0x11
+	.long	.LASF2331
+	.byte	0x10
+	.long	.LASF2332
+	.byte	0x10
+	.long	.LASF2333
+	.byte	0x10
+	.long	.LASF2334
+	.byte	0x13
+	.long	.LASF2335
+	.byte	0x10
+	.long	.LASF2336
+	.byte	0x10
+	.long	.LASF2337
+	.byte	0x10
+	.long	.LASF2338
+	.byte	0x10
+	.long	.LASF2339
+	.byte	0x10
+	.long	.LASF2340
+	.byte	0x10
+	.long	.LASF2341
+	.byte	0x10
+	.long	.LASF2342
+	.byte	0x10
+	.long	.LASF2343
+	.byte	0xf
+	.long	.LASF2344
+	.byte	0xe
+	.long	.LASF2345
+	.byte	0xd
+	.long	.LASF2346
+	.byte	0x14
+	.long	.LASF2347
+	.byte	0xe
+	.long	.LASF2348
+	.byte	0xe
+	.long	.LASF2349
+	.byte	0x2
+	.long	.LASF2350
+	.byte	0x3
+	.long	.LASF2351
+	.byte	0x4
+	.long	.LASF2352
+	.byte	0x8
+	.long	.LASF2353
+	.byte	0x9
+	.long	.LASF2354
+	.byte	0xa
+	.long	.LASF2355
+	.byte	0xa
+	.long	.LASF2356
+	.byte	0x8
+	.long	.LASF2357
+	.byte	0x8
+	.long	.LASF2358
+	.byte	0x8
+	.long	.LASF2359
+	.byte	0x8
+	.long	.LASF2360
+	.byte	0x8
+	.long	.LASF2361
+	.byte	0xc
+	.long	.LASF2361
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1152:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1274:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF730:
+	.string	"__DECL_SIMD_logf "
+.LASF1125:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF963:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1101:
+	.string	"USE_RX_PPM "
+.LASF1248:
+	.string	"USE_FAKE_BARO "
+.LASF741:
+	.string	"__DECL_SIMD_expl "
+.LASF1252:
+	.string	"USE_BARO "
+.LASF1889:
+	.string	"PID_VEL_Z"
+.LASF946:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1232:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1175:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF839:
+	.string	"__DECL_SIMD_sinh "
+.LASF1797:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1159:
+	.string	"USE_CMS "
+.LASF1600:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1259:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF767:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1771:
+	.string	"ADC_BATTERY"
+.LASF1531:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1551:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF2231:
+	.string	"imuInit"
+.LASF1068:
+	.string	"FP_NORMAL 4"
+.LASF903:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF883:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF740:
+	.string	"__DECL_SIMD_expf "
+.LASF2248:
+	.string	"vect"
+.LASF971:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1942:
+	.string	"OWNER_RX_SPI"
+.LASF2115:
+	.string	"mag_hardware"
+.LASF1334:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF843:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF959:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF944:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1156:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1837:
+	.string	"ANTI_WINDUP"
+.LASF1648:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1553:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1642:
+	.string	"IMU_CENTRIFUGAL_LPF 1"
+.LASF1422:
+	.string	"FAST_MATH "
+.LASF1813:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1707:
+	.string	"_Bool"
+.LASF1633:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF698:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2084:
+	.string	"flightDynamicsTrims_t"
+.LASF1296:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1587:
+	.string	"DMA_NONE (0)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1711:
+	.string	"currentTimeUs"
+.LASF1761:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF749:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1684:
+	.string	"minutes"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2026:
+	.string	"DEVHW_M25P16"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF887:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2209:
+	.string	"imuValidateQuaternion"
+.LASF2143:
+	.string	"isGPSHeadingValid"
+.LASF1479:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1526:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1888:
+	.string	"PID_HEADING"
+.LASF2077:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF2252:
+	.string	"quaternionNormalize"
+.LASF1819:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1469:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF2049:
+	.string	"CW90_DEG_FLIP"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF2025:
+	.string	"DEVHW_PCA9685"
+.LASF1749:
+	.string	"DEBUG_COUNT"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1612:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1644:
+	.string	"short unsigned int"
+.LASF1313:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1356:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1583:
+	.string	"HDOP_SCALE (100)"
+.LASF2051:
+	.string	"CW270_DEG_FLIP"
+.LASF1538:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF836:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF744:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1224:
+	.string	"__WCHAR_T__ "
+.LASF1436:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1753:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF881:
+	.string	"__DECL_SIMD_log2l "
+.LASF1102:
+	.string	"USE_SERIAL_RX "
+.LASF1762:
+	.string	"LOG_TOPIC_VTX"
+.LASF1740:
+	.string	"DEBUG_RPM_FILTER"
+.LASF2076:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF715:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2124:
+	.string	"smallAngleCosZ"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1361:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2066:
+	.string	"read"
+.LASF841:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1412:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF986:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1072:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1459:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2214:
+	.string	"imuGetPGainScaleFactor"
+.LASF1939:
+	.string	"OWNER_LED"
+.LASF703:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1833:
+	.string	"GPS_FIX"
+.LASF1742:
+	.string	"DEBUG_NAV_YAW"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1786:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1185:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1660:
+	.string	"uint16_t"
+.LASF2221:
+	.string	"sinRoll"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1298:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF373:
+	.string	"linux 1"
+.LASF1432:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF2100:
+	.string	"accClipCount"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1009:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2121:
+	.string	"yawDeciDegrees"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1872:
+	.string	"small_angle"
+.LASF1828:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF861:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1988:
+	.string	"DEVHW_MPU6000"
+.LASF2177:
+	.string	"rotRateMagnitude"
+.LASF1346:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2263:
+	.string	"length"
+.LASF1071:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF697:
+	.string	"_MATH_H 1"
+.LASF1302:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1146:
+	.string	"USE_OLED_UG2864 "
+.LASF1194:
+	.string	"_T_PTRDIFF_ "
+.LASF1097:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2067:
+	.string	"magAlign"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF711:
+	.string	"__DECL_SIMD_sinl "
+.LASF1909:
+	.string	"velNED"
+.LASF1480:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1263:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF713:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1462:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1497:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF964:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2218:
+	.string	"initialPitch"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2118:
+	.string	"magCalibrationTimeLimit"
+.LASF1560:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1594:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1451:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF2256:
+	.string	"quaternionNormSqared"
+.LASF1471:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1791:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1623:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1264:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF2060:
+	.string	"imuSensorToUse"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1396:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1834:
+	.string	"CALIBRATE_MAG"
+.LASF1405:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1223:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF732:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1629:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF2228:
+	.string	"imuSetMagneticDeclination"
+.LASF993:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1905:
+	.string	"gpsSolutionData_s"
+.LASF2219:
+	.string	"initialYaw"
+.LASF788:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2068:
+	.string	"magSensorToUse"
+.LASF1953:
+	.string	"RESOURCE_NONE"
+.LASF1882:
+	.string	"PID_YAW"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF731:
+	.string	"__DECL_SIMD_logl "
+.LASF2137:
+	.string	"scaleRangef"
+.LASF1682:
+	.string	"month"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2158:
+	.string	"previousIMUUpdateTimeUs"
+.LASF1147:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF968:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1502:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF1810:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF863:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1392:
+	.string	"BIT(x) (1 << (x))"
+.LASF1933:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1886:
+	.string	"PID_SURFACE"
+.LASF739:
+	.string	"__DECL_SIMD_exp "
+.LASF1914:
+	.string	"gpsSol"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF831:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1088:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1023:
+	.string	"_Mdouble_"
+.LASF1658:
+	.string	"int32_t"
+.LASF1354:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1840:
+	.string	"COMPASS_CALIBRATED"
+.LASF2130:
+	.string	"pgResetTemplate_imuConfig"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1962:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1851:
+	.string	"ROVER"
+.LASF1247:
+	.string	"USE_IMU_FAKE "
+.LASF1519:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2123:
+	.string	"compassConfig_System"
+.LASF2031:
+	.string	"busDeviceDescriptor_s"
+.LASF2038:
+	.string	"busDeviceDescriptor_t"
+.LASF923:
+	.string	"__DECL_SIMD_erff32 "
+.LASF2007:
+	.string	"DEVHW_IST8308"
+.LASF2162:
+	.string	"canUseMAG"
+.LASF1234:
+	.string	"___int_wchar_t_h "
+.LASF1944:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1873:
+	.string	"acc_ignore_rate"
+.LASF1320:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1901:
+	.string	"validVelD"
+.LASF1954:
+	.string	"RESOURCE_INPUT"
+.LASF1529:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1537:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1268:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF2206:
+	.string	"quat"
+.LASF2171:
+	.string	"accMagnitudeSq"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2182:
+	.string	"imuMahonyAHRSupdate"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1287:
+	.string	"USE_RX_PPM"
+.LASF1897:
+	.string	"gpsLocation_t"
+.LASF513:
+	.string	"__always_inline"
+.LASF1963:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF924:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1859:
+	.string	"imuMeasuredRotationBF"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1371:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1849:
+	.string	"AIRPLANE"
+.LASF1862:
+	.string	"values"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1755:
+	.string	"LOG_TOPIC_BARO"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF1995:
+	.string	"DEVHW_BMP280"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1483:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1024:
+	.string	"__MATH_PRECNAME"
+.LASF874:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1054:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1307:
+	.string	"FAST_CODE "
+.LASF1134:
+	.string	"USE_OPFLOW "
+.LASF1668:
+	.string	"PGR_SIZE_MASK"
+.LASF1056:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2033:
+	.string	"busType"
+.LASF1027:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1278:
+	.string	"USE_PITOT_MS4525"
+.LASF738:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1011:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1143:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1765:
+	.string	"logTopic_e"
+.LASF1208:
+	.string	"_T_SIZE_ "
+.LASF2019:
+	.string	"DEVHW_DS2482"
+.LASF1250:
+	.string	"USE_FAKE_GPS "
+.LASF1017:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1450:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF2096:
+	.string	"acc_s"
+.LASF2104:
+	.string	"acc_t"
+.LASF1060:
+	.string	"__MATHCALL_NARROW"
+.LASF1654:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1989:
+	.string	"DEVHW_MPU6050"
+.LASF1144:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2136:
+	.string	"_logf"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1045:
+	.string	"__MATHDECL_1"
+.LASF1864:
+	.string	"orientation"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1932:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2059:
+	.string	"ADCRaw"
+.LASF396:
+	.string	"false 0"
+.LASF1952:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1348:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1187:
+	.string	"USE_CLI_BATCH "
+.LASF1219:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF981:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF2190:
+	.string	"vRotation"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2094:
+	.string	"SENSOR_TEMP"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2234:
+	.string	"imuComputeRotationMatrix"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1387:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1350:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1737:
+	.string	"DEBUG_ACC"
+.LASF1495:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2048:
+	.string	"CW0_DEG_FLIP"
+.LASF787:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1536:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF799:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1169:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF817:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1203:
+	.string	"__need_ptrdiff_t"
+.LASF2011:
+	.string	"DEVHW_LM75_0"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2013:
+	.string	"DEVHW_LM75_2"
+.LASF2014:
+	.string	"DEVHW_LM75_3"
+.LASF2015:
+	.string	"DEVHW_LM75_4"
+.LASF2016:
+	.string	"DEVHW_LM75_5"
+.LASF2017:
+	.string	"DEVHW_LM75_6"
+.LASF2018:
+	.string	"DEVHW_LM75_7"
+.LASF1019:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF2087:
+	.string	"SENSOR_BARO"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF973:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1865:
+	.string	"attitude"
+.LASF1373:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1683:
+	.string	"hours"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1512:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1069:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1795:
+	.string	"FEATURE_BLACKBOX"
+.LASF1337:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1777:
+	.string	"FEATURE_VBAT"
+.LASF1811:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF1920:
+	.string	"OWNER_SERVO"
+.LASF1395:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF976:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF2103:
+	.string	"maxG"
+.LASF1447:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1359:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1598:
+	.string	"SPIDEV_COUNT 4"
+.LASF1466:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1087:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF824:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1292:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1964:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1456:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF2208:
+	.string	"imuCalculateAccelerometerWeight"
+.LASF900:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1406:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF1951:
+	.string	"OWNER_IRLOCK"
+.LASF1506:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1725:
+	.string	"DEBUG_GYRO"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1510:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF758:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1341:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF2156:
+	.string	"isImuHeadingValid"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1817:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF2249:
+	.string	"vectQuat"
+.LASF2204:
+	.string	"thetaMagnitude"
+.LASF2044:
+	.string	"CW0_DEG"
+.LASF1860:
+	.string	"roll"
+.LASF1200:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1340:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1286:
+	.string	"USE_VCP"
+.LASF849:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2217:
+	.string	"initialRoll"
+.LASF2081:
+	.string	"flightDynamicsTrims_def_t"
+.LASF1649:
+	.string	"__int16_t"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2039:
+	.string	"busDevice_s"
+.LASF2160:
+	.string	"imuCheckVibrationLevels"
+.LASF1651:
+	.string	"__uint16_t"
+.LASF996:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1919:
+	.string	"OWNER_MOTOR"
+.LASF825:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2181:
+	.string	"imuCalculateEstimatedAttitude"
+.LASF1976:
+	.string	"BUSTYPE_I2C"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1899:
+	.string	"gpsHeartbeat"
+.LASF1876:
+	.string	"imuConfig_System"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1878:
+	.string	"imuRuntimeConfig_s"
+.LASF1879:
+	.string	"imuRuntimeConfig_t"
+.LASF1235:
+	.string	"__INT_WCHAR_T_H "
+.LASF978:
+	.string	"__HAVE_FLOAT32 1"
+.LASF870:
+	.string	"__DECL_SIMD_log10f "
+.LASF2047:
+	.string	"CW270_DEG"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF2194:
+	.string	"thetaMagnitudeSq"
+.LASF1500:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF795:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF967:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1573:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1082:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2222:
+	.string	"cosPitch"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF764:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1443:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1715:
+	.string	"flightLogEvent_IMUError_t"
+.LASF1798:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF826:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF922:
+	.string	"__DECL_SIMD_erff16 "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1418:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF2129:
+	.string	"gpsHeadingInitialized"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF755:
+	.string	"__DECL_SIMD_powf128 "
+.LASF796:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1544:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2229:
+	.string	"declinationDeg"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2113:
+	.string	"mag_declination"
+.LASF2073:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1590:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF2092:
+	.string	"SENSOR_GPS"
+.LASF1916:
+	.string	"OWNER_PWMIO"
+.LASF992:
+	.string	"__f32x(x) x ##f32x"
+.LASF2000:
+	.string	"DEVHW_BMP388"
+.LASF813:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1044:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1606:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1726:
+	.string	"DEBUG_AGL"
+.LASF1089:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1026:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1163:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1381:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1058:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1643:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1416:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1780:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1521:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1527:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1201:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1435:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1622:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF1829:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1116:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1736:
+	.string	"DEBUG_SMARTAUDIO"
+.LASF1921:
+	.string	"OWNER_SOFTSERIAL"
+.LASF791:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1574:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1468:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1663:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1463:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1306:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1047:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2238:
+	.string	"q0q1"
+.LASF2239:
+	.string	"q0q2"
+.LASF2240:
+	.string	"q0q3"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1501:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF782:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1193:
+	.string	"_PTRDIFF_T "
+.LASF1679:
+	.string	"pgRegistry_s"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1812:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2145:
+	.string	"accGetMeasuredAcceleration"
+.LASF1782:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1324:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1086:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2078:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1503:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF878:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1703:
+	.string	"adjustmentFunction"
+.LASF2043:
+	.string	"ALIGN_DEFAULT"
+.LASF1375:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF847:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1613:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1670:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1183:
+	.string	"USE_VTX_TRAMP "
+.LASF1111:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF953:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1943:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1639:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1106:
+	.string	"USE_SERIALRX_FPORT "
+.LASF772:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1075:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2065:
+	.string	"init"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1913:
+	.string	"gpsSolutionData_t"
+.LASF1789:
+	.string	"FEATURE_UNUSED_5"
+.LASF1790:
+	.string	"FEATURE_UNUSED_6"
+.LASF1794:
+	.string	"FEATURE_UNUSED_7"
+.LASF1947:
+	.string	"OWNER_1WIRE"
+.LASF1802:
+	.string	"FEATURE_UNUSED_9"
+.LASF1293:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1031:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1816:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1494:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1140:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF2172:
+	.string	"nearness"
+.LASF1366:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1731:
+	.string	"DEBUG_ALWAYS"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1174:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1099:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1926:
+	.string	"OWNER_RANGEFINDER"
+.LASF2131:
+	.string	"imuConfig_Registry"
+.LASF2180:
+	.string	"rateSlopeMax"
+.LASF1245:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1407:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF820:
+	.string	"__DECL_SIMD_coshf "
+.LASF1002:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1844:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF901:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1316:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1877:
+	.string	"imuConfig_Copy"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF893:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF985:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2155:
+	.string	"calculateCosTiltAngle"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1066:
+	.string	"FP_ZERO 2"
+.LASF952:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1800:
+	.string	"FEATURE_VTX"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2021:
+	.string	"DEVHW_SRF10"
+.LASF2266:
+	.string	"imuUpdateEulerAngles"
+.LASF2141:
+	.string	"gyroIsCalibrationComplete"
+.LASF910:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1291:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1666:
+	.string	"PGR_PGN_MASK"
+.LASF982:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1018:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1021:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1005:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2069:
+	.string	"magADCRaw"
+.LASF1113:
+	.string	"USE_NAV "
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1417:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF2184:
+	.string	"accBF"
+.LASF2152:
+	.string	"cos_approx"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2254:
+	.string	"quaternionScale"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1429:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF708:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1967:
+	.string	"RESOURCE_SPI_CS"
+.LASF1760:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF871:
+	.string	"__DECL_SIMD_log10l "
+.LASF1722:
+	.string	"debug"
+.LASF1335:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF1424:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1284:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1540:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1903:
+	.string	"validEPE"
+.LASF1279:
+	.string	"USE_PITOT_ADC"
+.LASF1618:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF748:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1823:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1108:
+	.string	"USE_ADC_AVERAGING "
+.LASF1442:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1569:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF984:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF699:
+	.string	"__DECL_SIMD_cos "
+.LASF1012:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1677:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF2053:
+	.string	"sensorAccInitFuncPtr"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1431:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1796:
+	.string	"FEATURE_UNUSED_10"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2109:
+	.string	"mag_s"
+.LASF2111:
+	.string	"mag_t"
+.LASF877:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF2201:
+	.string	"vGravity"
+.LASF780:
+	.string	"__DECL_SIMD_asinf "
+.LASF1136:
+	.string	"USE_OPFLOW_MSP "
+.LASF2167:
+	.string	"magWeight"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2074:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1966:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1936:
+	.string	"OWNER_MPU"
+.LASF1329:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1403:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1051:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2195:
+	.string	"vForward"
+.LASF1022:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1035:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2169:
+	.string	"useAcc"
+.LASF1133:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF747:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF700:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1464:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1946:
+	.string	"OWNER_TEMPERATURE"
+.LASF1411:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1793:
+	.string	"FEATURE_DASHBOARD"
+.LASF733:
+	.string	"__DECL_SIMD_logf32 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1709:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF1712:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF1213:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1937:
+	.string	"OWNER_INVERTER"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1552:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1713:
+	.string	"flightLogEvent_IMUError_s"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1659:
+	.string	"uint8_t"
+.LASF2126:
+	.string	"vCorrectedMagNorth"
+.LASF2241:
+	.string	"q1q2"
+.LASF2242:
+	.string	"q1q3"
+.LASF2133:
+	.string	"atan2_approx"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1126:
+	.string	"USE_RX_UIB "
+.LASF1567:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1592:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1025:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1389:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1822:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1533:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2075:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1830:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF765:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF2170:
+	.string	"canUseCOG"
+.LASF1732:
+	.string	"DEBUG_SAG_COMP_VOLTAGE"
+.LASF1428:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1571:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF919:
+	.string	"__DECL_SIMD_erf "
+.LASF2035:
+	.string	"param"
+.LASF1285:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2041:
+	.string	"scratchpad"
+.LASF1542:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF2117:
+	.string	"mag_to_use"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1236:
+	.string	"_GCC_WCHAR_T "
+.LASF1231:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1956:
+	.string	"RESOURCE_IO"
+.LASF1727:
+	.string	"DEBUG_FLOW_RAW"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1858:
+	.string	"imuMeasuredAccelBF"
+.LASF2223:
+	.string	"sinPitch"
+.LASF1311:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1305:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF766:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF2042:
+	.string	"busDevice_t"
+.LASF1162:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF376:
+	.string	"unix 1"
+.LASF1065:
+	.string	"FP_INFINITE 1"
+.LASF1055:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF819:
+	.string	"__DECL_SIMD_cosh "
+.LASF1057:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF709:
+	.string	"__DECL_SIMD_sin "
+.LASF1902:
+	.string	"validMag"
+.LASF1131:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1242:
+	.string	"NULL ((void *)0)"
+.LASF2089:
+	.string	"SENSOR_RANGEFINDER"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF704:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1984:
+	.string	"DEVHW_LSM303DLHC"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2009:
+	.string	"DEVHW_MAG3110"
+.LASF2022:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF975:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1270:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2202:
+	.string	"vEstGravity"
+.LASF1211:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2116:
+	.string	"magZero"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1122:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1222:
+	.string	"__need_size_t"
+.LASF1918:
+	.string	"OWNER_PPMINPUT"
+.LASF1769:
+	.string	"ioTag_t"
+.LASF1842:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF752:
+	.string	"__DECL_SIMD_powf16 "
+.LASF783:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1000:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1132:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF821:
+	.string	"__DECL_SIMD_coshl "
+.LASF1323:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2175:
+	.string	"axis"
+.LASF1039:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1576:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1190:
+	.string	"_STDDEF_H "
+.LASF2212:
+	.string	"imuResetOrientationQuaternion"
+.LASF906:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1249:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF2142:
+	.string	"resetHeadingHoldTarget"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2144:
+	.string	"compassIsHealthy"
+.LASF705:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF802:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2215:
+	.string	"imuUseFastGains"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1698:
+	.string	"flightLogEvent_flightMode_s"
+.LASF1701:
+	.string	"flightLogEvent_flightMode_t"
+.LASF737:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1579:
+	.string	"LON 1"
+.LASF2090:
+	.string	"SENSOR_PITOT"
+.LASF1570:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1028:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1572:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1300:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1610:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1345:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF773:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1121:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1890:
+	.string	"PID_POS_HEADING"
+.LASF1982:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2183:
+	.string	"gyroBF"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1836:
+	.string	"FIXED_WING_LEGACY"
+.LASF2099:
+	.string	"accVibeSq"
+.LASF1333:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1216:
+	.string	"_SIZE_T_DECLARED "
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF2107:
+	.string	"useExternal"
+.LASF1728:
+	.string	"DEBUG_FLOW"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2165:
+	.string	"useCOG"
+.LASF832:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1401:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1120:
+	.string	"USE_PITOT_ADC "
+.LASF1599:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2216:
+	.string	"imuComputeQuaternionFromRPY"
+.LASF2179:
+	.string	"rateSlopeMin"
+.LASF1218:
+	.string	"___int_size_t_h "
+.LASF1975:
+	.string	"BUSTYPE_NONE"
+.LASF1517:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1568:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2205:
+	.string	"imuCheckAndResetOrientationQuaternion"
+.LASF974:
+	.string	"__f128(x) x ##f128"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1030:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1690:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1438:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1655:
+	.string	"__uint64_t"
+.LASF1409:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF1449:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1550:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF2233:
+	.string	"imuConfigure"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF794:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1945:
+	.string	"OWNER_COMPASS"
+.LASF1363:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF781:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF960:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1681:
+	.string	"year"
+.LASF2225:
+	.string	"sinYaw"
+.LASF2086:
+	.string	"SENSOR_ACC"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1546:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF925:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1673:
+	.string	"address"
+.LASF1455:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1037:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1441:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1514:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1303:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1288:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF701:
+	.string	"__DECL_SIMD_cosl "
+.LASF1959:
+	.string	"RESOURCE_UART_RX"
+.LASF2080:
+	.string	"int16_flightDynamicsTrims_s"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1179:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2210:
+	.string	"check"
+.LASF1013:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1241:
+	.string	"NULL"
+.LASF1368:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF1524:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1832:
+	.string	"GPS_FIX_HOME"
+.LASF1148:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1029:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1958:
+	.string	"RESOURCE_UART_TX"
+.LASF1861:
+	.string	"pitch"
+.LASF1927:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF2236:
+	.string	"q2q2"
+.LASF2243:
+	.string	"q2q3"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1343:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF466:
+	.string	"__PMT"
+.LASF1384:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1237:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1135:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1972:
+	.string	"RESOURCE_RX_CE"
+.LASF1929:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1694:
+	.string	"FlightLogEvent"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2001:
+	.string	"DEVHW_DPS310"
+.LASF1744:
+	.string	"DEBUG_DYNAMIC_FILTER_FREQUENCY"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1509:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF1739:
+	.string	"DEBUG_ERPM"
+.LASF1638:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1985:
+	.string	"DEVHW_L3GD20"
+.LASF1176:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1081:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1763:
+	.string	"LOG_TOPIC_OSD"
+.LASF2114:
+	.string	"mag_align"
+.LASF880:
+	.string	"__DECL_SIMD_log2f "
+.LASF1807:
+	.string	"ARMED"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1839:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1831:
+	.string	"armingFlags"
+.LASF2105:
+	.string	"externalRotation"
+.LASF1042:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF929:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1543:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1721:
+	.string	"flightLogEventData_t"
+.LASF2082:
+	.string	"flightLogEventData_u"
+.LASF1669:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2151:
+	.string	"pt1FilterReset"
+.LASF1971:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1067:
+	.string	"FP_SUBNORMAL 3"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF972:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF2164:
+	.string	"useMag"
+.LASF1741:
+	.string	"DEBUG_RPM_FREQ"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1695:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF1697:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF1530:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1413:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF2230:
+	.string	"declinationRad"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1227:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1607:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1559:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1383:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1225:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1118:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1327:
+	.string	"UNIT_TESTED "
+.LASF2134:
+	.string	"feature"
+.LASF1280:
+	.string	"USE_1WIRE"
+.LASF1977:
+	.string	"BUSTYPE_SPI"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1620:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF778:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1773:
+	.string	"ADC_CURRENT"
+.LASF1229:
+	.string	"_WCHAR_T_ "
+.LASF1591:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF2185:
+	.string	"magBF"
+.LASF2139:
+	.string	"pt1FilterApply4"
+.LASF1787:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1719:
+	.string	"loggingResume"
+.LASF777:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2197:
+	.string	"vMag"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1490:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF988:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1458:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1847:
+	.string	"AIRMODE_ACTIVE"
+.LASF1818:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF717:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1342:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1207:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2083:
+	.string	"flightDynamicsTrims_u"
+.LASF1662:
+	.string	"uint64_t"
+.LASF1704:
+	.string	"floatFlag"
+.LASF1038:
+	.string	"_Mdouble_ _Float128"
+.LASF2168:
+	.string	"accWeight"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF2247:
+	.string	"result"
+.LASF2196:
+	.string	"vErr"
+.LASF1911:
+	.string	"groundCourse"
+.LASF1881:
+	.string	"PID_PITCH"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1845:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1103:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1632:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF1577:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1869:
+	.string	"dcm_ki_acc"
+.LASF1846:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1446:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1825:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF1855:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF891:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1804:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF2251:
+	.string	"quaternionRotateVector"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF818:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1892:
+	.string	"GPS_NO_FIX"
+.LASF723:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1871:
+	.string	"dcm_ki_mag"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1626:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1420:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF1714:
+	.string	"errorCode"
+.LASF2095:
+	.string	"acc_extremes_t"
+.LASF1374:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1772:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1003:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF785:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1757:
+	.string	"LOG_TOPIC_PWM"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1608:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2262:
+	.string	"vectorNormalize"
+.LASF1778:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF769:
+	.string	"__DECL_SIMD_atan "
+.LASF815:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1692:
+	.string	"FLIGHT_LOG_EVENT_IMU_FAILURE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1137:
+	.string	"USE_PITOT_MS4525 "
+.LASF1046:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2106:
+	.string	"onBoard"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1808:
+	.string	"WAS_EVER_ARMED"
+.LASF1548:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1675:
+	.string	"reset"
+.LASF2070:
+	.string	"sensorMagReadFuncPtr"
+.LASF1129:
+	.string	"USE_RANGEFINDER "
+.LASF1445:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1979:
+	.string	"busType_e"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF803:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2098:
+	.string	"accADCf"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1803:
+	.string	"FEATURE_UNUSED_11"
+.LASF1493:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1378:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1614:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF786:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1930:
+	.string	"OWNER_SDCARD"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1092:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF889:
+	.string	"__DECL_SIMD_log1p "
+.LASF961:
+	.string	"__DECL_SIMD_tanl "
+.LASF816:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1893:
+	.string	"GPS_FIX_2D"
+.LASF1157:
+	.string	"USE_LOG "
+.LASF1076:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2203:
+	.string	"vAcc"
+.LASF1850:
+	.string	"MULTIROTOR"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1309:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2255:
+	.string	"quaternionMultiply"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2120:
+	.string	"pitchDeciDegrees"
+.LASF2030:
+	.string	"devHardwareType_e"
+.LASF1647:
+	.string	"signed char"
+.LASF989:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF2200:
+	.string	"vTmp"
+.LASF734:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1164:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1724:
+	.string	"DEBUG_NONE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF833:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1204:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1062:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1601:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1700:
+	.string	"lastFlags"
+.LASF1425:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1233:
+	.string	"_WCHAR_T_H "
+.LASF1799:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2057:
+	.string	"readFn"
+.LASF2227:
+	.string	"imuTransformVectorBodyToEarth"
+.LASF2237:
+	.string	"q3q3"
+.LASF1894:
+	.string	"GPS_FIX_3D"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1421:
+	.string	"sq(x) ((x)*(x))"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1130:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1050:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1393:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1990:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF991:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1212:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1826:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1271:
+	.string	"USE_DASHBOARD"
+.LASF1184:
+	.string	"USE_VTX_FFPV "
+.LASF1586:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1874:
+	.string	"acc_ignore_slope"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1093:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF928:
+	.string	"__DECL_SIMD_erff128x "
+.LASF905:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1215:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1319:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1475:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1554:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF2088:
+	.string	"SENSOR_MAG"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1085:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF980:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1243:
+	.string	"__need_NULL"
+.LASF1154:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1301:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2119:
+	.string	"rollDeciDegrees"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1299:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1032:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2147:
+	.string	"accGetClipCount"
+.LASF2220:
+	.string	"cosRoll"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1751:
+	.string	"state"
+.LASF1404:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1827:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1182:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1277:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2146:
+	.string	"gyroGetMeasuredRotationRate"
+.LASF1336:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1923:
+	.string	"OWNER_SERIAL"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1192:
+	.string	"_ANSI_STDDEF_H "
+.LASF2245:
+	.string	"imuConfig"
+.LASF1077:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1934:
+	.string	"OWNER_OSD"
+.LASF725:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1317:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF1950:
+	.string	"OWNER_PINIO"
+.LASF774:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1667:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1467:
+	.string	"PG_PID_PROFILE 14"
+.LASF1768:
+	.string	"fpQuaternion_t"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1114:
+	.string	"USE_TELEMETRY "
+.LASF1949:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1781:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1784:
+	.string	"FEATURE_UNUSED_3"
+.LASF2211:
+	.string	"normSq"
+.LASF1785:
+	.string	"FEATURE_UNUSED_4"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1680:
+	.string	"_dateTime_s"
+.LASF1084:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1489:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1318:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1360:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1898:
+	.string	"hasNewData"
+.LASF1801:
+	.string	"FEATURE_UNUSED_8"
+.LASF1541:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1001:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1496:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2198:
+	.string	"vHeadingEF"
+.LASF1105:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF726:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1520:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1528:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF885:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF729:
+	.string	"__DECL_SIMD_log "
+.LASF2056:
+	.string	"initFn"
+.LASF1338:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1935:
+	.string	"OWNER_BARO"
+.LASF2003:
+	.string	"DEVHW_AK8963"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1369:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF888:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1595:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF911:
+	.string	"__DECL_SIMD_acoshl "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2029:
+	.string	"DEVHW_IRLOCK"
+.LASF742:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1282:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1139:
+	.string	"USE_1WIRE_DS2482 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF2005:
+	.string	"DEVHW_IST8310_0"
+.LASF2006:
+	.string	"DEVHW_IST8310_1"
+.LASF1805:
+	.string	"FEATURE_OSD"
+.LASF1674:
+	.string	"copy"
+.LASF1957:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1815:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF1696:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF979:
+	.string	"__HAVE_FLOAT64 1"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1857:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1820:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2027:
+	.string	"DEVHW_UG2864"
+.LASF1365:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2004:
+	.string	"DEVHW_AK8975"
+.LASF1472:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1745:
+	.string	"DEBUG_IRLOCK"
+.LASF1197:
+	.string	"_PTRDIFF_T_ "
+.LASF1980:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF882:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1604:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1593:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1165:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1269:
+	.string	"USE_USB_MSC"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1621:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF1924:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1867:
+	.string	"imuConfig_s"
+.LASF1875:
+	.string	"imuConfig_t"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1427:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1733:
+	.string	"DEBUG_VIBE"
+.LASF1743:
+	.string	"DEBUG_DYNAMIC_FILTER"
+.LASF753:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1539:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1124:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1391:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2093:
+	.string	"SENSOR_GPSMAG"
+.LASF1883:
+	.string	"PID_POS_Z"
+.LASF1196:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1991:
+	.string	"DEVHW_BMI160"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF2002:
+	.string	"DEVHW_HMC5883"
+.LASF1014:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1206:
+	.string	"_SIZE_T "
+.LASF1534:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2186:
+	.string	"accWScaler"
+.LASF1353:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1973:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1379:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1388:
+	.string	"EXPAND_I(x) x"
+.LASF1619:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF1885:
+	.string	"PID_VEL_XY"
+.LASF1917:
+	.string	"OWNER_PWMINPUT"
+.LASF1020:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1661:
+	.string	"uint32_t"
+.LASF1210:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1295:
+	.string	"U_ID_1 1"
+.LASF1617:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF1394:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1258:
+	.string	"USE_UART6 "
+.LASF994:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1627:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1624:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF1998:
+	.string	"DEVHW_LPS25H"
+.LASF879:
+	.string	"__DECL_SIMD_log2 "
+.LASF1276:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF886:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1308:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1955:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF898:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1686:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF995:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1049:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1470:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF908:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1558:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1253:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1605:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF1332:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF489:
+	.string	"__flexarr []"
+.LASF997:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1910:
+	.string	"groundSpeed"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1646:
+	.string	"long unsigned int"
+.LASF1635:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2040:
+	.string	"descriptorPtr"
+.LASF1189:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1083:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1010:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF2163:
+	.string	"courseOverGround"
+.LASF1486:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1723:
+	.string	"debugMode"
+.LASF1226:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1160:
+	.string	"CMS_MENU_OSD "
+.LASF2265:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1358:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1246:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF718:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1312:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1172:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1925:
+	.string	"OWNER_TIMER"
+.LASF2054:
+	.string	"accDev_s"
+.LASF2071:
+	.string	"accDev_t"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF2058:
+	.string	"acc_1G"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1457:
+	.string	"PG_CF_START 1"
+.LASF2258:
+	.string	"quaternionInitUnit"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1115:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1109:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2063:
+	.string	"sensorMagInitFuncPtr"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1578:
+	.string	"LAT 0"
+.LASF2235:
+	.string	"q1q1"
+.LASF1656:
+	.string	"char"
+.LASF1052:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1759:
+	.string	"LOG_TOPIC_IMU"
+.LASF875:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF789:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1565:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF1238:
+	.string	"__DEFINED_wchar_t "
+.LASF983:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1779:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2102:
+	.string	"extremes"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1304:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2024:
+	.string	"DEVHW_MS4525"
+.LASF872:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1978:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1770:
+	.string	"IO_t"
+.LASF1806:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1535:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1423:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF829:
+	.string	"__DECL_SIMD_expm1 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1167:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF876:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF768:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1992:
+	.string	"DEVHW_ICM20689"
+.LASF1522:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1636:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1603:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1705:
+	.string	"newValue"
+.LASF1444:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1171:
+	.string	"USE_RX_MSP "
+.LASF1380:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1452:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1868:
+	.string	"dcm_kp_acc"
+.LASF706:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1505:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1314:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2149:
+	.string	"sensors"
+.LASF2055:
+	.string	"busDev"
+.LASF760:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1214:
+	.string	"_SIZE_T_DEFINED "
+.LASF1809:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1151:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF746:
+	.string	"__DECL_SIMD_expf32x "
+.LASF943:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1155:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1119:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1440:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1987:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF2246:
+	.string	"quaternionRotateVectorInv"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1746:
+	.string	"DEBUG_CD"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1221:
+	.string	"__size_t "
+.LASF848:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1376:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1454:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1481:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1880:
+	.string	"PID_ROLL"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF784:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2010:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF2050:
+	.string	"CW180_DEG_FLIP"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF940:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1386:
+	.string	"STR_HELPER(x) #x"
+.LASF1702:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF1708:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1485:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1104:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1687:
+	.string	"dateTime_t"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1385:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1563:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1325:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2097:
+	.string	"accTargetLooptime"
+.LASF2159:
+	.string	"imuUpdateAttitude"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1357:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF956:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF810:
+	.string	"__DECL_SIMD_exp10f "
+.LASF743:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2091:
+	.string	"SENSOR_OPFLOW"
+.LASF2213:
+	.string	"accNorm"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1074:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF1961:
+	.string	"RESOURCE_EXTI"
+.LASF1240:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2259:
+	.string	"vectorScale"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1195:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF909:
+	.string	"__DECL_SIMD_acosh "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1419:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF2154:
+	.string	"accUpdate"
+.LASF1161:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1602:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1112:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1061:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1672:
+	.string	"size"
+.LASF1866:
+	.string	"rMat"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1094:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1064:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1166:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1513:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2232:
+	.string	"imuUpdateAccelerometer"
+.LASF822:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1080:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1870:
+	.string	"dcm_kp_mag"
+.LASF2045:
+	.string	"CW90_DEG"
+.LASF2132:
+	.string	"acos_approx"
+.LASF2253:
+	.string	"quaternionConjugate"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF965:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF2052:
+	.string	"sensor_align_e"
+.LASF1884:
+	.string	"PID_POS_XY"
+.LASF735:
+	.string	"__DECL_SIMD_logf128 "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF2157:
+	.string	"isImuReady"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1364:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF2207:
+	.string	"imuErrorEvent"
+.LASF1525:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1589:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF759:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1841:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF830:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1370:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF736:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1347:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1398:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2250:
+	.string	"refConj"
+.LASF1402:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1575:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1706:
+	.string	"newFloatValue"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1322:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1041:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1117:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF999:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1907:
+	.string	"numSat"
+.LASF1091:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2064:
+	.string	"magDev_s"
+.LASF2108:
+	.string	"magDev_t"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1664:
+	.string	"double"
+.LASF1637:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF2140:
+	.string	"sqrtf"
+.LASF1838:
+	.string	"FLAPERON_AVAILABLE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF762:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF2224:
+	.string	"cosYaw"
+.LASF998:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1549:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1824:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF2176:
+	.string	"_abs0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1397:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1557:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1460:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF936:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1400:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1230:
+	.string	"_BSD_WCHAR_T_ "
+.LASF807:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1430:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1783:
+	.string	"FEATURE_GPS"
+.LASF1835:
+	.string	"SMALL_ANGLE"
+.LASF1940:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1848:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF2161:
+	.string	"accVibeLevels"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1244:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1555:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1079:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1750:
+	.string	"pt1Filter_s"
+.LASF1752:
+	.string	"pt1Filter_t"
+.LASF1652:
+	.string	"__int32_t"
+.LASF1006:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1653:
+	.string	"__uint32_t"
+.LASF770:
+	.string	"__DECL_SIMD_atanf "
+.LASF1596:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1814:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1908:
+	.string	"magData"
+.LASF1792:
+	.string	"FEATURE_LED_STRIP"
+.LASF1585:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1473:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2037:
+	.string	"irqPin"
+.LASF1993:
+	.string	"DEVHW_MPU9250"
+.LASF1691:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF1283:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF2036:
+	.string	"busdev"
+.LASF1843:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF2112:
+	.string	"compassConfig_s"
+.LASF2122:
+	.string	"compassConfig_t"
+.LASF2261:
+	.string	"vectorCrossProduct"
+.LASF1931:
+	.string	"OWNER_FLASH"
+.LASF761:
+	.string	"__DECL_SIMD_acosl "
+.LASF1474:
+	.string	"PG_RX_CONFIG 24"
+.LASF1478:
+	.string	"PG_GPS_CONFIG 30"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1034:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1900:
+	.string	"validVelNE"
+.LASF939:
+	.string	"__DECL_SIMD_asinh "
+.LASF1128:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1177:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1015:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1145:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF897:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF750:
+	.string	"__DECL_SIMD_powf "
+.LASF1181:
+	.string	"USE_VTX_CONTROL "
+.LASF1390:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF756:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1220:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1141:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1191:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF779:
+	.string	"__DECL_SIMD_asin "
+.LASF2032:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1729:
+	.string	"DEBUG_SBUS"
+.LASF1852:
+	.string	"BOAT"
+.LASF2148:
+	.string	"accGetVibrationLevels"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1048:
+	.string	"__MATHCALL"
+.LASF873:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1515:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF941:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1788:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF1941:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1477:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF2174:
+	.string	"accWeight_RateIgnore"
+.LASF2188:
+	.string	"vGyroDriftEstimate"
+.LASF1158:
+	.string	"USE_STATS "
+.LASF1251:
+	.string	"USE_MAG "
+.LASF1948:
+	.string	"OWNER_AIRSPEED"
+.LASF1986:
+	.string	"DEVHW_L3G4200"
+.LASF1040:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1887:
+	.string	"PID_LEVEL"
+.LASF1095:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2135:
+	.string	"blackboxLogEvent"
+.LASF926:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1756:
+	.string	"LOG_TOPIC_PITOT"
+.LASF899:
+	.string	"__DECL_SIMD_atanh "
+.LASF712:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1239:
+	.string	"_BSD_WCHAR_T_"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1008:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1007:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF811:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1518:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF949:
+	.string	"__DECL_SIMD_erfc "
+.LASF2192:
+	.string	"vTheta"
+.LASF2101:
+	.string	"isClipped"
+.LASF1315:
+	.string	"__FAST_MATH__ 1"
+.LASF1408:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF2189:
+	.string	"prevOrientation"
+.LASF990:
+	.string	"__f32(x) x ##f32"
+.LASF1198:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1228:
+	.string	"__WCHAR_T "
+.LASF1096:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF1499:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1628:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1487:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF966:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1609:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF790:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF2125:
+	.string	"isAccelUpdatedAtLeastOnce"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2166:
+	.string	"measuredMagBF"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1758:
+	.string	"LOG_TOPIC_TIMER"
+.LASF775:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1070:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1631:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF1678:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF927:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1294:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2260:
+	.string	"vectorAdd"
+.LASF1476:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1997:
+	.string	"DEVHW_MS5607"
+.LASF754:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF720:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1665:
+	.string	"pgn_t"
+.LASF970:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1774:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1734:
+	.string	"DEBUG_CRUISE"
+.LASF1362:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1720:
+	.string	"imuError"
+.LASF1983:
+	.string	"DEVHW_MMA8452"
+.LASF776:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1098:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1414:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1657:
+	.string	"int16_t"
+.LASF1372:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF800:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1508:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF716:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1775:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1399:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1547:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2193:
+	.string	"deltaQ"
+.LASF2012:
+	.string	"DEVHW_LM75_1"
+.LASF1349:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1895:
+	.string	"gpsFixType_e"
+.LASF969:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1566:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1153:
+	.string	"USE_D_BOOST "
+.LASF1996:
+	.string	"DEVHW_MS5611"
+.LASF1209:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1123:
+	.string	"USE_GYRO_KALMAN "
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2023:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1297:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1033:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1461:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1272:
+	.string	"USE_OLED_UG2864"
+.LASF1330:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF890:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1355:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1561:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1188:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1310:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1265:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1896:
+	.string	"gpsLocation_s"
+.LASF1968:
+	.string	"RESOURCE_ADC_CH1"
+.LASF1969:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1970:
+	.string	"RESOURCE_ADC_CH3"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF827:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF884:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1821:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1754:
+	.string	"LOG_TOPIC_GYRO"
+.LASF1915:
+	.string	"OWNER_FREE"
+.LASF2028:
+	.string	"DEVHW_SDCARD"
+.LASF809:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1545:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1641:
+	.string	"MAX_ACC_SQ_NEARNESS 25"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF823:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF797:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2008:
+	.string	"DEVHW_QMC5883"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1321:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF714:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1178:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1138:
+	.string	"USE_1WIRE "
+.LASF930:
+	.string	"__DECL_SIMD_tanhf "
+.LASF2128:
+	.string	"rotRateFilter"
+.LASF1597:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF962:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2150:
+	.string	"sin_approx"
+.LASF2187:
+	.string	"magWScaler"
+.LASF2062:
+	.string	"sensorAccReadFuncPtr"
+.LASF2034:
+	.string	"devHwType"
+.LASF987:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1616:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1688:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF1718:
+	.string	"inflightAdjustment"
+.LASF1281:
+	.string	"USE_1WIRE_DS2482"
+.LASF1556:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF757:
+	.string	"__DECL_SIMD_powf64x "
+.LASF707:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF2153:
+	.string	"degreesToRadians"
+.LASF1326:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1266:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF771:
+	.string	"__DECL_SIMD_atanl "
+.LASF1260:
+	.string	"USE_UART8 "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1582:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1764:
+	.string	"LOG_TOPIC_COUNT"
+.LASF950:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1410:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1199:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF869:
+	.string	"__DECL_SIMD_log10 "
+.LASF902:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1853:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF2178:
+	.string	"rotRateMagnitudeFiltered"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1710:
+	.string	"logIteration"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF2257:
+	.string	"quaternionInitFromVector"
+.LASF1110:
+	.string	"USE_BLACKBOX "
+.LASF1434:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF763:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1856:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1367:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF850:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1981:
+	.string	"DEVHW_BMA280"
+.LASF1482:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1854:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF751:
+	.string	"__DECL_SIMD_powl "
+.LASF1999:
+	.string	"DEVHW_SPL06"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1974:
+	.string	"BUSTYPE_ANY"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1584:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF728:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF933:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1776:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1107:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1142:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1351:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1267:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1036:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1290:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1439:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1498:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1150:
+	.string	"USE_DJI_HD_OSD "
+.LASF1328:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2085:
+	.string	"SENSOR_GYRO"
+.LASF1043:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1217:
+	.string	"__DEFINED_size_t "
+.LASF1448:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1630:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF1634:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1965:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1928:
+	.string	"OWNER_SPI"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF2199:
+	.string	"vCoG"
+.LASF1491:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1149:
+	.string	"USE_FRSKYOSD "
+.LASF1275:
+	.string	"USE_RANGEFINDER"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF920:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1073:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1507:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1090:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1053:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1261:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1611:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF702:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1173:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1581:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1912:
+	.string	"hdop"
+.LASF1863:
+	.string	"attitudeEulerAngles_t"
+.LASF1938:
+	.string	"OWNER_LED_STRIP"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1254:
+	.string	"USE_UART2 "
+.LASF1588:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1523:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1580:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1339:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1891:
+	.string	"PID_ITEM_COUNT"
+.LASF859:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1738:
+	.string	"DEBUG_ITERM_RELAX"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1511:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1492:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF721:
+	.string	"__DECL_SIMD_sincosl "
+.LASF2127:
+	.string	"imuRuntimeConfig"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1004:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2079:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1748:
+	.string	"DEBUG_SDCARD"
+.LASF1994:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1650:
+	.string	"short int"
+.LASF1735:
+	.string	"DEBUG_REM_FLIGHT_TIME"
+.LASF1716:
+	.string	"syncBeep"
+.LASF1904:
+	.string	"validTime"
+.LASF2264:
+	.string	"vectorNormSquared"
+.LASF1484:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1437:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1693:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF801:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1255:
+	.string	"USE_UART3 "
+.LASF1433:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1016:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1488:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1730:
+	.string	"DEBUG_FPORT"
+.LASF1516:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1100:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1767:
+	.string	"fpMat3_t"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1382:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1205:
+	.string	"__SIZE_T__ "
+.LASF1344:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1186:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1180:
+	.string	"USE_RCDEVICE "
+.LASF1453:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1289:
+	.string	"USE_RCDEVICE"
+.LASF1564:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF2110:
+	.string	"magADC"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF840:
+	.string	"__DECL_SIMD_sinhf "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF2173:
+	.string	"accWeight_Nearness"
+.LASF1671:
+	.string	"pgResetFunc"
+.LASF2226:
+	.string	"imuTransformVectorEarthToBody"
+.LASF1426:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF1717:
+	.string	"flightMode"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF913:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1645:
+	.string	"unsigned int"
+.LASF2072:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1256:
+	.string	"USE_UART4 "
+.LASF1465:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF793:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1562:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1504:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF958:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1063:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1766:
+	.string	"fpVector3_t"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF860:
+	.string	"__DECL_SIMD_atan2f "
+.LASF719:
+	.string	"__DECL_SIMD_sincos "
+.LASF931:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1168:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF2191:
+	.string	"spin_rate_sq"
+.LASF1170:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1352:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1922:
+	.string	"OWNER_ADC"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF2061:
+	.string	"accAlign"
+.LASF1127:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF710:
+	.string	"__DECL_SIMD_sinf "
+.LASF1676:
+	.string	"pgRegistry_t"
+.LASF862:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF745:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF921:
+	.string	"__DECL_SIMD_erfl "
+.LASF1640:
+	.string	"SPIN_RATE_LIMIT 20"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1257:
+	.string	"USE_UART5 "
+.LASF1747:
+	.string	"DEBUG_KALMAN"
+.LASF1059:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1906:
+	.string	"fixType"
+.LASF1377:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1960:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF951:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1415:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF1273:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1331:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1625:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF2046:
+	.string	"CW180_DEG"
+.LASF977:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1202:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF2244:
+	.string	"compassConfig"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2020:
+	.string	"DEVHW_MAX7456"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1078:
+	.string	"M_E 2.7182818284590452354"
+.LASF1699:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1689:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1262:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF945:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2138:
+	.string	"constrainf"
+.LASF1615:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1685:
+	.string	"seconds"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF851:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1532:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2352:
+	.string	"rx_pwm.h"
+.LASF2336:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2285:
+	.string	"/usr/include"
+.LASF2342:
+	.string	"mathcalls-helper-functions.h"
+.LASF2338:
+	.string	"floatn-common.h"
+.LASF2321:
+	.string	"stdint.h"
+.LASF2268:
+	.string	"src/main/build"
+.LASF2282:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2361:
+	.string	"barometer.h"
+.LASF2320:
+	.string	"stdbool.h"
+.LASF2291:
+	.string	"time.h"
+.LASF2325:
+	.string	"wordsize.h"
+.LASF2307:
+	.string	"bus.h"
+.LASF2279:
+	.string	"src/main/target/SITL"
+.LASF2348:
+	.string	"common_post.h"
+.LASF2322:
+	.string	"libc-header-start.h"
+.LASF2343:
+	.string	"platform.h"
+.LASF2286:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2272:
+	.string	"src/main/drivers/barometer"
+.LASF2295:
+	.string	"filter.h"
+.LASF2316:
+	.string	"blackbox.h"
+.LASF2306:
+	.string	"resource.h"
+.LASF2313:
+	.string	"imu.c"
+.LASF2276:
+	.string	"src/main/flight"
+.LASF2303:
+	.string	"imu.h"
+.LASF2293:
+	.string	"debug.h"
+.LASF2319:
+	.string	"stdc-predef.h"
+.LASF2309:
+	.string	"accgyro.h"
+.LASF2297:
+	.string	"vector.h"
+.LASF2334:
+	.string	"math.h"
+.LASF2356:
+	.string	"exti.h"
+.LASF2298:
+	.string	"quaternion.h"
+.LASF2323:
+	.string	"features.h"
+.LASF2281:
+	.string	"src/main"
+.LASF2277:
+	.string	"src/main/io"
+.LASF2273:
+	.string	"src/main/drivers/compass"
+.LASF0:
+	.string	"./src/main/flight/imu.c"
+.LASF2310:
+	.string	"compass.h"
+.LASF2271:
+	.string	"src/main/drivers/accgyro"
+.LASF2302:
+	.string	"runtime_config.h"
+.LASF2301:
+	.string	"config.h"
+.LASF2340:
+	.string	"fp-logb.h"
+.LASF2318:
+	.string	"gyro.h"
+.LASF2332:
+	.string	"time64.h"
+.LASF2296:
+	.string	"log.h"
+.LASF2345:
+	.string	"target.h"
+.LASF2359:
+	.string	"bus_spi.h"
+.LASF2314:
+	.string	"maths.h"
+.LASF2351:
+	.string	"parameter_group_ids.h"
+.LASF2333:
+	.string	"wchar.h"
+.LASF2326:
+	.string	"timesize.h"
+.LASF2269:
+	.string	"src/main/common"
+.LASF2284:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2358:
+	.string	"rcc_types.h"
+.LASF2353:
+	.string	"stats.h"
+.LASF2305:
+	.string	"gps.h"
+.LASF2312:
+	.string	"acceleration.h"
+.LASF2346:
+	.string	"stddef.h"
+.LASF2341:
+	.string	"fp-fast.h"
+.LASF2275:
+	.string	"src/main/fc"
+.LASF2337:
+	.string	"floatn.h"
+.LASF2357:
+	.string	"bus_i2c.h"
+.LASF2344:
+	.string	"common.h"
+.LASF2330:
+	.string	"stubs-64.h"
+.LASF2329:
+	.string	"stubs.h"
+.LASF2290:
+	.string	"parameter_group.h"
+.LASF2304:
+	.string	"pid.h"
+.LASF2324:
+	.string	"features-time64.h"
+.LASF2315:
+	.string	"feature.h"
+.LASF2355:
+	.string	"mixer.h"
+.LASF2311:
+	.string	"sensors.h"
+.LASF2335:
+	.string	"math-vector.h"
+.LASF2289:
+	.string	"stdint-uintn.h"
+.LASF2300:
+	.string	"adc.h"
+.LASF2328:
+	.string	"long-double.h"
+.LASF2327:
+	.string	"cdefs.h"
+.LASF2339:
+	.string	"flt-eval-method.h"
+.LASF2317:
+	.string	"mathcalls.h"
+.LASF2331:
+	.string	"typesizes.h"
+.LASF2267:
+	.string	"src/main/blackbox"
+.LASF2308:
+	.string	"sensor.h"
+.LASF2347:
+	.string	"sanity_check.h"
+.LASF2360:
+	.string	"dma.h"
+.LASF2280:
+	.string	"src/main/target"
+.LASF2294:
+	.string	"axis.h"
+.LASF2274:
+	.string	"src/main/drivers"
+.LASF2350:
+	.string	"utils.h"
+.LASF2349:
+	.string	"build_config.h"
+.LASF2278:
+	.string	"src/main/sensors"
+.LASF2288:
+	.string	"stdint-intn.h"
+.LASF2354:
+	.string	"hil.h"
+.LASF2270:
+	.string	"src/main/config"
+.LASF2287:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2292:
+	.string	"blackbox_fielddefs.h"
+.LASF2299:
+	.string	"io_types.h"
+.LASF2283:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`U\004\225\017"
+	.string	"\364\022I\005"
+	.string	"+"
+	.string	"\364\324\253\336\t\030\002"
+	.string	"\002\001\002\001\221\353\322\264\004.\002"
+	.string	"\002\003\002\004\002\004\003\002\005\002\005\003\356\220\344\266\n\003\334\355\360\220\005\032\006\004\240\342\234\212\n\005\006\217\313\340\227\r\b\003\007\360\215\216\377\007\022\005\b\220\357\207\262\n\024\002"
+	.string	"\002\007\002\b\t\002\n\002\013\f\r\016\017\376\361\257\256\002 \f\002\f"
+	.string	"\b\020\021\022\272\254\245\373\b\023\244\217\223\366\n\020\024\372\365\245\313\017\236\001\004"
+	.string	"\002\r\003\002\003\025\026\227\361\305\246\t\027\030\321\237\336\365\t\031\333\263\237\234\002\032\245\212\357\203\017$\016\017\002\020\021\002\022\013\002\013\033\036\037\321\376\341\350\f\002 !\264\373\273\227\004\024\002\023\002\n\r\"\354\316\306\321\r\006#\223\221\352\315\b\024\002\t\002\r\002"
+	.string	"\002"
+	.string	"\024%\233\332\257\222\t&\327\360\251\220'\301\204\247\320\017"
+	.string	"(\363\314\247\245\017\022\002\t\002\t\021\002\025+\302\305\267\223\b\f\002\026,-\262\310\275\257\006"
+	.string	".\357\355\245\330\016\006\016\002\016/\236\273\270\324\016\0040\223\272\266\215\f1\205\247\304\230\0012\240\342\234\212\n"
+	.string	"T\250\2011a\206\306F\222\244\305P\202bH\254:\022 \3621\226\0039\204\2301\b\tF0\023XH\321L\344\272\r)L\017\322\223\316x\002\\\t\177]\205\335\220O\232\311\177\211P\236\031)\213\316r\001`A\232G\351Q\351f02"
+	.ascii	"E\022\370b\235\364\314\277\366\310\361D%\277\372\356\034\217"
+	.ascii	"P\230}Y\337b\344\236\2175\317\342\027\212\007\017i\371\2050T"
+	.ascii	"\257\352rwwi\\\375k\210\202\332`H\364[-+tt\326\246\355!\314Z"
+	.ascii	"\025i\374\223\330\365\2743\247\367\233\207\276\347\344\354_'"
+	.ascii	"Ghl\0050\302s\206\025\241\201\005\026\3564jZ\215h\236\345\201"
+	.ascii	"5D\006\314\323\372\345`\035\023"
+	.text
+	.section	.gnu.lto_.ipa_sra.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\363\001}\007"
+	.string	"\222\b\030\036\240)\215\001\377\377\377\377\200_\377\377\377\340\373n\326\374\316\357\327\266\235s\267K\276\2242\245\232\0225#\220\307:\264\361\030c_(>\261\210\303\357\033\366(\003\3762\245T\206\n\372\274\025\341\201@U\033\251U\300\177\227\265\353\365&\033\323|\350\356\312)\333\226\246\371\030t\237\226Sg&\253\022E\250\260\322X5\006\220\202)\032\243\007\022@5McBU\023L~&-.l=\003\332\022b\362\370"
+	.ascii	"\373\341*0\363\207\330\221.\273)\240i\252\342I\273\020\035\371"
+	.ascii	"\213/\205U\030\n\373\323}\354C\b\2378\303\036\264Gm\273\220\345"
+	.ascii	"\245\231? \240\035(^B\371\033I\b\036I\252}\354t\211\211\016X"
+	.ascii	"\207\206K\002\210\223\tw\223\265\301U\323\017VP\005\216\361T"
+	.ascii	"\222\226\202\023\016+\206|\225\"\374\020\022\030T\307\221%<\006"
+	.text
+	.section	.gnu.lto_.inline.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\007\fE$"
+	.string	"\306/\230C\320\332&\215\001"
+	.string	"4c\247\235F\2506\034\030B\344\257V\016F\240\323\242\311\006\301\031\303\311\261T\325\200\253\335]\354\267!c)T\312H\325\253O2\307(\017"
+	.string	"\204\270\330\025F\202\366!$M\332\226r\247y"
+	.string	"\204"
+	.string	"\211"
+	.string	"\360\024\f\016\327?@L\370\251~\252\220\245\262\335\275\371\226\302v\367\304\255\362:XZythw\035t0\201HgT\020\026}r(\013\bRP\204A\037]52\235\007%5\357lk\033w\317\334\023\252\221\301\205{z\336\371aV\\C\327\235\034w\232\376\362m;\343\361\\\301\363\334\301yV\356\356F\n\253T\236\327u0_?\220\020n+OF\331\335\n\257\263)M\273/\005\023\370w\264\364\200\334\027M\252\374\2048\221>|\2101\332\260\200\005h9\244S0R\251\005Q\233\"G%\244"
+	.string	"\3312\346&o\tf)\367\247\372\251~\252\357J\240\335\227\tg\257\203\372:]J\301\240\342@\016\356\334\352\265yo^w\\\275\362\316\245Cv\267\303\226\237\022\236\017\217\300S\246\200\237\003\004Gh\247L\261\266\236P,\273\353a\355\327\236'\255\354.\211<\314\356bX\341\247`\360\f\031\217\307Ou\330\370\"\203\303\334\\Kahf]8\274\355+\205\241\345\006\223xT\261\307O;z\236\206=\232\310c\327Eng\314b:\364\214\334\236Q\225\263\230\020\024\270ig\251\246\262?\275\361Cc\2106\224y.\210\314bB0\b\301\237\252\250\2041\241\356u:\taO\212\320P\331\023\037\"\2011W@\026Z\314\036\315YQd\0170dz\3005?)"
+	.string	" ?t\177\252\t\3762q\336\325\302\024`\025\214E\001\357\250\254\225\301g\367\205\362\262\373\"0\206)I\214\020mK\244\034u1}\001&\227\240$GP;\213\345@]\001\016\203\030!bc\341\207\220\030C\nL\023\036\2624W\026\315bB7KH\331\361N#\274\016Ax\302\230\035Dui\231\335\315\271\301\237\017\\)\333]\0033\370\262Ez\301\3530\005\333\376\0017@EG5P\3448\314\3600\232\212\tu\214\221\343\270\273\016\356\237\354n\225F?T\256\304\273\273\226\262Q\342dGj\270;+\201\016\2501A\247\324\210\210(HJ\222\244\003!\005\304)\207\024\204>\022\2003)\013\024\235R$\"2J\nRP>\225,sOn\206\024K9X\026!3"
+	.string	"P\206*\361\374\301\007?$\273\212\001\352\305Dp\303\321n)\262\256\275*==\222\253\302\250M\023\212\021\374b\374*\265o\253t&\236A\332\346\031\370I\375E\030\334\245\374Vq\227\331\355\340\211\377\235\240\002\276\221=\300b\336\307;\b^|\177\272W);h)\317PG\035\205\214\212d\215;\367B3NS\215\2469[\f$\356\200\017x\363\325\032\303EUR?OBc\341j\002\324\247\352G\257\324};I"
+	.string	"\205\036h7\363!\277\352ZO\023\346`\025\323&\316\022\236g6\241\236\n\025nf\266H\211r\317\002"
+	.ascii	"\2503\371e\211\312B\272\311(\362\3160\363\214Yr\250\374\210\337"
+	.ascii	"<\001\013m\301\037\030\374UQP\037\331*}\350\332\243\306\341\316"
+	.ascii	"R\305CA\301\313#9\306\351\313\255s\306\"\242yD\210&\236\025\253"
+	.ascii	"\216\007\212\320|Vk7\017\213\377:1\206\320sc\377'\363r>\226\241"
+	.ascii	"\201\006\301\275\332\037\377M\005\351\346I>n@|\207L=#\370\251"
+	.ascii	"\262\0020(\241q\"_\377\t\246\330\020TS\212\026D<\350\027\301"
+	.ascii	"\020\345[\\\367\370l\265\216\024\004\002\332(3\237\213e\225\330"
+	.ascii	"&Oy!\256.\364(60\002l\375\264\013?\323B4\303\n\271\220\343\322"
+	.ascii	"\211i\3423\f\225\370\246Q}\343\023\004 \310\324\030\344\2244"
+	.ascii	"1D\306\214\2671,J\312\001V\205\312\f\300\302\033\016\b\373\315"
+	.ascii	"\\\360\3672\204\241\320V\241=\213\352\001\216X\316[p\177M#>W"
+	.ascii	"L%\355\3157!\t\2031\210\221\204D\232E\213\003\372\302{O\354e"
+	.ascii	"\214\250i\300\0056\265CB\006\352_\263U\232-\"\276'u\365\001\212"
+	.ascii	"\350U\367\n\326\266t`}\227\3114\247\365X\307\247\257ux'\332\026"
+	.ascii	"rY\356s'S%\013\357\243\321|\211\365\344\255c"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\333\006\305\020"
+	.string	"\326\32294`E\223t0\f\303\024\013X\271:\303Pc|\021\004A0\205NE3\240\240\023H\020\330\371\241\021\220P\310f\377\217h\366\267\023(\313\032\332\223O\210L2%"
+	.string	","
+	.string	"-"
+	.ascii	"$\213\231\255/2\362\356\255\003<\200o\r{\r\353\344ty\370\362"
+	.ascii	"L\262\373*\033_^\266G\361+6:>\001U\020\311>w\310bt:\027\230\002"
+	.ascii	"H\357C\217\257\203\021#\325\200\357\002>#I\255P\225\236Z\312"
+	.ascii	"\264^\221Z'\244\237\252\264\362\023?)U\006lm?\242n\031\340L6"
+	.ascii	"\013U\005\236k\243\320[\213M\252\026[/r\253l=5MC\t\274U\204?"
+	.ascii	"X\344\203\267$\001$'\240\003\022\021\bn{\251*i\201xh\035\310"
+	.ascii	"\006\326`x:b|\222\020\323.\244\205$\205\020\364\021`m\224\340"
+	.ascii	"\210Yd\034\261~\001\200\210\250\341A2\222$)\r\233\001`\002\221"
+	.ascii	"RF\345\001\022 \022i\220\343Y\306\030\203\220\200 \206\224\204"
+	.ascii	"QRFI\212\205\003\314/;tN\266\263^#\224Z;\371\016\201\360\270"
+	.ascii	"pdm\306\007\310\371\315;X\277\355\267\255\201\027\325\207\201"
+	.ascii	"\256\272w\235+Mg\021\317\3254R\035\201X`\226\311\242\020\254"
+	.ascii	"\331V\235\335\036k{%\356\2456\232\320\223%R\207Ov[5\201\\-\231"
+	.ascii	"\324\322p\233\031np/\361y\364h\035)\031\230CW\346\004\325\274"
+	.ascii	":\362\375M\336\374\177\235q\232C\343Z\264\005D\204_\020n]\037"
+	.ascii	"\221\016\343\360\276\314\0219\374\205i\326,\217d\205p\302V\202"
+	.ascii	"hL\3462\340\016\357\365k\222\363\210\031%|\270t\350\211\274m"
+	.ascii	"\233B>b2?P\375J\037;\311\213\241V\006&.i\201\035\317\032#\031"
+	.ascii	"6_1\254L/\304 \206\240\032\034\263\223&\260z\006\230}\214\357"
+	.ascii	"\363\t]L\213dk5\257G\343\006\216\212\364\322\002\320*\340c\025"
+	.ascii	"\003\026\353\004\301R\t\205\361f\365\362\376\n\225\272\245\314"
+	.ascii	"TU\242\232o\024"
+	.text
+	.section	.gnu.lto_.pureconst.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 M\035\002"
+	.string	"\322\304\017\031\220+\035\377\307R\327\357\356n\"\027\331i@\331\245@?\223\3326\266\221\035c\326\254&5\247)\315\350B\367\231\316l&3\227\251\234!\367\270\306,&q\207)\314\340\002\267\335K\356\356\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\242\002=\013"
+	.string	"r\016+,`k\222\0160\f\333\302\224\005\311\224>b\252E\203"
+	.string	"(\253\302\212Y\343\267~\254\3056\177~\354\312\r\021h\321V\342\373Q#R\246?P\354\307\224\372\"E\345Q;\335 ]\241\264\326\0068\371a\246\034\323J\022\246rF\bO\225_\346A9C'T\016\025"
+	.string	"\202\024lTh\034-0.&$\356.\3429\225\225\235\341\340\020\371\021\t8^\310;,\022l)\267\2647\002\020w\234\013\235\255\274Uj\363\310\\9V\235\035W\310\372\327\327\027\345\213OZ\316\343\315\237r\205\362\362\332\223\335\240\\R\376U\345X\354\347\346\031EU\250QI\207\206jR\220\3020\007P\2021U\224\036\022\240\2648\316u\314\2710\201\353\377]\r\037\004\fHc\224\251\236\213#\244\221\226\352\035\037\002\033\352={H\274"
+	.string	"\303\n\222\212\327N\224\315\333}\211\262g\304n'\024\276Q\\U\206\300\037<K\352CmN\273\303\007\253\214\354\266\224\264\354\224\246\246\262\265\377\201$\330\363O\032\300\026\224$R\270\314\330x\330r\235\003\302Z\332R\026"
+	.ascii	"\251\326,\354;\231q+4\370a\027\035\312\354d\002\331[,\021F\313"
+	.ascii	"\237\201\370\005]yU\013\252.\325\330\337\354+\354\201\214\207"
+	.ascii	"\r^\207\036\346i\237X\320W\272\242B\001)"
+	.text
+	.section	.gnu.lto_.lto.2620a55cd7894ccc,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_vectorNormalize.23.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`2\004\345\030"
+	.string	"&m\235H\300VQ:\024.b9\260\226\300"
+	.string	"\343\305\223n\236\254\\\360\n\0071?\243\345k\34669f9\377\342\343\323\352\336\360d{\252\361\305QQ]Wu\r\370\237\374\307T&\033\037\032g\355\243?\201\233\265}B\266\224)\005\210"
+	.string	"|"
+	.string	"\213"
+	.string	";\0372\022\212gD\354\307\024\342\312\234\363\300C;@=\244\311\277\304\033\214\030\035uf\002\246OHF\003\324\303\333O\214\365A\274\267\346\004\352\"d\316\021\201\r\240\036\332\366q<\307\216y\263\361\005\t\026\013\020\035\210\266\3149\332<\036&>D\375%>\\\027\347=\224\253<\377t\2237P \371"
+	.string	"y\036\232\270T\001M|\003"
+	.ascii	"}\2226\347<\321\365\003\260G\365t\233sZ}\200$n\361\266!\330~"
+	.ascii	"`K\017\001\036{t[\330\227s\201l\251\226IuL\252aR\r#\325/\251"
+	.ascii	"vIu\353A\277\352CwJ\252O\037\177Q\252W\252U\252?\023\2154\231"
+	.ascii	"Y\231SD\223\227\251\024\022\221\361\241\337\276_\364#{\345\234"
+	.ascii	"\007}\037!\217\242\033s\316\325C\243\317\337\210\224\b\026 \016"
+	.ascii	"<\274\375\210Q\275Q\316G\235\365\360@K\323\2259G\004\017\375"
+	.ascii	"\242\034{\365\360\366\216O\344\325\255FL\217\013\005<\273-\214"
+	.ascii	"d[\t\310V\202\320\024\237r\261\006U\244\366C\247\005P\331\332"
+	.ascii	"\270\nz\237\324\322|\313\363\023\375'~?J\261\205Y\331\206Y`\013"
+	.ascii	"\333\330\212_hn\244\bl\023\274\266\2650\273N~)\\\353\332\327"
+	.ascii	"\312*\030>D\210k\013\234\366\264\255\325\244\037\215\036\347"
+	.ascii	"\036Dw\344\r\007b\203\232\323\247\340\307\016\307\217\241#><"
+	.ascii	"-KJPO\233\374\243\253\202%\226\356\343)\033ML\342\336\350\264"
+	.ascii	"\236v\261\006\177\226\246vq\026n*\324\3402\210\034n\234\314\204"
+	.ascii	"\004\013p\024dj35\234\034\r\353&\003\216\rn'"
+	.string	"\332Bm\247\273\231\301q\260\325\350r9\335\214\255\206F&g\233\331\331\330j\003\254\323\200\333\331nt\272\235m5\366.\347\002\251\226\301\212\336\366X\203EB*Sv@y\242\203i\t\026eK\017\207\334\265i\256\304\004\266kC\327\306\360\244%\256\325\032k\347\256\304H\366\206'\211\200\232s*@rA\206\025%\006O|\250I>XR{\332\357\036\371)\001\020\234\241s\316K\250q<\002\0212\b\"\242\214\264$\031\003\240\002\241\2412\017\021P1$c\001NX\\P(m\034\"\213(gj\004\001\033\230q'\n\030R\305\326i]4\240c\302\202\221\235\026\013\030\264\021\341T\225\332\320\272\351\266\bS\2722\201\007\362zpw\333'\304\341e\333\304\313\267\233Lm\233\\\250\241\354%w\312\t\273\231\304r\260\f\227\231\210\362\356z8\022\365\261\377\236:\025\353\376\274m\266\344\231\306\033*\224z"
+	.string	"\b\375\213Y\016\244x\371\224\262\016\364{\""
+	.string	"\204\307O%\323\364}7"
+	.ascii	"p\373\314\037"
+	.text
+	.section	.gnu.lto_quaternionMultiply.32.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\257\005\305\034"
+	.string	"V\264\261H\240\330M:\2005^z\002\006\363{\343+\270\236}\020\276\020\343\2373\217\031\373\023#r\2073w\354\334{p,\360\255\234\225\313\r\254\362\0320;G\311\323\3652f0\223\005/\263\342\337\360o\276\351\337\244\021\262\223\224)\236"
+	.string	"\213"
+	.string	"\233"
+	.string	"\206\311\265(\327\241\\K\271\276\\\257\\k\020\f\213\t\316\327\234 \276\260\314\255p\210\f\333P\326\240eDSt:\024\b\245;4\214Q!b>r\360\2402\347$\240\241\035\214\032\352\244iM$\342\302\221\245\001\022\335\3766\374`0jH\244\245\363jV\357F\233\034r|\0202\347/\310B\243\206\266\2556\364\006\224{\267\337\013\0212RY\036\200U\346\374\345\374S\233\250\341\2505Q\303\273\320\236n\317\252A\2254R\004\251\252\242ta\n\346\234^\252*\021\352\253\355"
+	.ascii	"\266'\330\342N{\375\277\300),) W{\233\275\244>\232\30699\fY{"
+	.ascii	"\364\260\236F\030\032Z7\210\032\352g^Y\276\3752l\204\006\253"
+	.ascii	"\232\314\275b\377\242\366-l\225\363,l\315R\035\2408T\005\350"
+	.ascii	"O5\200\\\003\311\365\217\\\373\310u\217\\\363\310\365\216\\\353"
+	.ascii	"\3105N\256s\344\032G\256o\344\332F\256or]#\3274rm\223\353\031"
+	.ascii	"\271\256\311\265\214\\\307\3105M\256a\344\372E\256gr\355\"\327"
+	.ascii	"2\271n\221\353\230\\\217r\003\3079\316*|\316\315m\2163~\177s"
+	.ascii	"{\315m~\371\233\276\346\004\315\222-\b#\317\366\231\323\270<"
+	.ascii	"v[\3552\237y\b\234\262\032_\2139\3552V\362\373\230K\340\024\226"
+	.ascii	"\236\246\301\0220?b+\022M\002\245J\2545v\bA#A\325a\022\360\203"
+	.ascii	"QC\036\031\264\226\20744\260\302\267W\374r\331a\016\233\335\345"
+	.ascii	"/\277\031\231]\201\030"
+	.string	"\264\210\313\211Z\016\273\354a\354\343[.\022\211]\267\323!\343\203\304\377\260\0378u%\265_\016//^\n\t\017\300+\313\307\323 X\362\270\b\226\200\224\344\001\003\005\226\200\224\244\222R\320\"\365QQ\005]\202#\013EBFBO;$\030\247\fOMGL\242/\b%\361\220\222\230\216\234\212\236\226rI\274\335\216g\224KB*\332\345\214\230\232rB;\346)\0351\345\234x<\246\234\3547U\316\263\260\355\001\327\255\360]\312\326.'[\272\252Dw\306\224*\270K\261\326\202\256\0324\217R\3453\236X1\341\333\257%\365\262\326\002\256\032s\316!+\224^\f\r\n\245'j8\3632\341S\001\304\325%\001\303\317}\016\264\377\3519\317}\256\302\367\354\\\347<\362;z\035\024\270&N\"\354r\002q\250aT\204\315\221\231\2212\322J\226\003 #\021R\325\001\021\3608\351P\312\244\205%\271g"
+	.ascii	"\301\301Q\305\353T\243(\301\016\264\214$U\304\372\nD\305\b\265"
+	.ascii	"\226\207T\254\254\352/Nv\027KDA6\201\2669\262\215\316)4\237p"
+	.ascii	"\027\245X\016\332\t\0333R~M\210\270\276>lQ\310\034\021\331Va"
+	.ascii	"\220\2076ER\034nD\366-\246v\\\257\222\303\346\337\033\222\374"
+	.ascii	"~SH\357UO\274\237I\222\317N\374qP\362R&\036\333\321,\f\"j.\377"
+	.ascii	"A\002\261\222\251\344\304\372G\314\3032\002W\241\275\211\357"
+	.ascii	"\233-\315&\245&Z\363\304\333Hw\320}M\333e\251\350|\3420\024a"
+	.ascii	"oQ\266^=\257\213O\260\363\302{\250\246\303\377\001"
+	.text
+	.section	.gnu.lto_quaternionNormalize.36.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\354\003\245\031"
+	.string	"f1\250I\240\230Q: \352\364-`\rx\360\034\350\002\347S\263\006\326\024\222\225\022\272\027Tx\006t\372?\323\264\365O\037\332\310\370\337.w\370\363t\030\035^\344\301_\260k\264\177c\236\336\031\217n\213\266h\326K\006![\312\224\002\224"
+	.string	"\207"
+	.string	"\232"
+	.ascii	"G\362Q\325\374\240\261\177\344\367x\221\317\215\274$\352\202"
+	.ascii	"b\200\236f<\231s&8h\n\342A\230<+\254\341A\243z\036c\017\220\t"
+	.ascii	"\342\301\032\0334\326\3578Q\3165`\362\212L\b\231sT\340\230x\320"
+	.ascii	"\266\237\343:|\234s\2152\204V!X\2108\2422\347(\363\370VxP<+<"
+	.ascii	"\2701\236;(Ws>K\004y\203FR\317\247;\b\300\227\342RL\361\025\340"
+	.ascii	"\343I\330\234\363GW\022\276\037U\226\bsNk\317't\207\267m\301"
+	.ascii	"v\005[J\bW:l\247P\326\037\223\323T({\374\321\205a_\316}aK\365"
+	.ascii	"K\252g\244\332%\3252R\035#\325-\251\206\221j\226T\257\244\372"
+	.ascii	"\345D\177\313\215n\225T\247>\376\242T\207R\rJ\265\224j%\240\022"
+	.ascii	"Z\202 i\316\023QWf\023H\244\306\215~\373~\322\177\266\312<G\362"
+	.ascii	"}\200BE\250\3149U\007\225>\201\202RB!X$8\370\240\247\304\363"
+	.ascii	"\261'\303|\220\223\013\034O\346\034\025\034\364\223xl\325\301"
+	.ascii	";:\2027\3169\027\250\356\322K(\031j\232\206\020\0255\304\233"
+	.ascii	"sg\340\265\031\212\222\360\324\212\365gD\2657:,\200\276\326\346"
+	.ascii	"p\243\357\251\026\306[\335\177\364\243\37015\315\254\314\276"
+	.ascii	"\326\345Z\327\316\354\313\303\231\\\373 1\013\2632\033\032im"
+	.ascii	"kc\226\345\251\366!\255m\300\332\227\205\331"
+	.string	"\225\002\264b\265\253e-xt\373\322j\017\2446\265/\253O@C?\306y\220\034qN\036\003\037\210m\307\247\321\023\036L\255\213\023\242\235F\371\277\003@\232\342t\037\277\n\244(L\304\r\032n\265\305\271i3\r4\rh\033f1\233\330N\355\306E\347\303N\016\r\027\272C\314v\273\261\341h:\263\035\034\231\355V\253\335ld\266\233YMf\203\313\221\305\n\370\006\202\206\223\351\334n8\231j\334]\316}\321\262\016Z\354\366\307\372\303\007\206k{x\223kC(p\355\332\225\264\026\254\"\327\276=\311j\345\024]\033\347H\274$\3169\031\370G6\\pi2\347\314\205\007\365\251\007E\265\251\325\335' $-?)NS'_\264em\f3}\317ru\026\3276\356\t@\2501,$\021\"\020\232!\2112\223\302\214\001\300\242\221#z\021p\271E\001I)(\260\354o2\371>j#\201\241\312"
+	.string	""
+	.ascii	"\2622\245\232\322\211m;\377\202\030\310\213\330\365Ki)*FV\035"
+	.ascii	"\227$\254<\312v6x\305E\033\233z\366[\206\337.\023\304\252\313"
+	.ascii	"a\272\256\335\336\306\263\244\036\206@\020\216\326!\204$\205"
+	.ascii	"\216\323\363Z\332\244\375\225]\342g\n\354!\331\\\004D\221\232"
+	.ascii	"\r\255c\nN%-\303\313\034\277\n&\244m\216B\267)\375\017"
+	.text
+	.section	.gnu.lto_quaternionRotateVector.37.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\261\005E\035"
+	.string	"61\256I\240\230Q:\300k\\\301<;\247\371\026\266\240\227\374\311G\341\220\234\343\331\341<\226,\215\026\300\340\244\317\037\3672\330\354K2k\315\215\376\332\341\\\240f\205E\016\217\266t\254xk\200\254\231#3\245\3741BH\354\226)\005\226"
+	.string	"\216"
+	.string	"\234"
+	.string	"~\361g\277N\336\036\362\237\036\345W\217\f\250 \036\232Z{$Qu8O\366\334\2401y\323\320\235\202N\"#\032c\323TV\255F\013N\032\303y\362\265\346\003\312\236J\243LBc,\200\241\355\260\305R\205\363d\204#\315\373%`\254\246\276X\"\244\252u\330\300\262\363\244m\037\311\223\f\031\030\033\376\260!"
+	.string	"\251\030\243i\253\326\341\314\303\027(O\236\037P\236\244>\016\374\002\375G\335\245\024\304\212\260\006\321\327\234Pk\365\nk\330\270\351m+\260-\302.\r\004\257\034[\304qUw\214=t\261\024\311\276\253\322#\333\\\357\230k\035s\235c\256q\314u\314\\\337\230k\233/\3755g\372a\037\3764\346\2724\327\244\271v\231kj\256\327\\\377\300K\n\026\006Zj\245q\206L\275B:\021r\247\037\352k\337/\276\312~\371w\242?u\252\r^\224j\255/c\023\24104\27276\021\372\002\243v\236\224\352\275\026\031\321\320@*f\325:\\p\262\247\013\255\334K\375\276\324\033Qo\204\2054#\353dA\242\221\035\037\035\272\343\363.:Erj84\247v.8Db\267\033\032\243kUt\273\226\033j\003\2048\344\312\206>\331\bk\022jy\367,\307\"\361\301O\022*O\332\320\002\257:"
+	.ascii	"\242\216\253J\365\037\tq`\301\350\215\347\t\022\377\324\023^"
+	.ascii	"\352<A#\224\332> n\245\n-\262\324\256\331Ne\312\0229\265o;%\324"
+	.ascii	"\262q\217R\302\006:\024\024g\255/\034X\245\310\235I'\375\026"
+	.ascii	"\345\311\323\233-K[\034b\264\275\b\354\335\243l\fp\254\265: "
+	.ascii	"p\334\n\356\031\007+\356\263\3754\234't;\n?8\236\371\203\343"
+	.ascii	"Q\337\r\307\302e\234\215\004\355\001\356\307&\273\311~9 \001"
+	.ascii	"\276\024\277\036\216W\332\204L\267\003\322\361p>\333o\305L\267"
+	.ascii	"\313\345v\267\231\016\310\226\233\335x\275\231\314\200w*p\274"
+	.ascii	"\231o\267\343\315^\303\340]\225\036\325P\b;\202\324\205S\220"
+	.ascii	"\253V\036\022\016\365g1E)\251\rb\203K\344SZ\221\324L\231\032"
+	.ascii	"\371\304E\305\330\030&\303V\b\r\260#\260\214P\353t\321\235*\030"
+	.ascii	"\335\242\222\225\035\023\034\211\217\2629x\330\013\315SD\211"
+	.ascii	"\374:rU\377\250_P\272\022y\250aH)\031\232\032\005)((IZ\003\300"
+	.ascii	"\"!*\242\007\0210\275c\206LKZXh?\003\025I\311\n\334\217\330K"
+	.ascii	"Fr\205\214\212h\246V\205\2126\351\324\346\214h\3309\251\035\017"
+	.ascii	"\370k\213N\200\016\314\271\035\355\261i\365Js\262P\210'i\237"
+	.ascii	"\030\370#\204y=Y\200\016\225\247\336\222PEF\223\026\033v\300"
+	.ascii	"\257\263cX\035p]/\333c\201Q)7%a9J\345\246$\\\316\201\006\204"
+	.ascii	"\302\370\354\244\336\345$\005TX\034\372\204\302\260\213\256\211"
+	.ascii	"\352\234\262\302hqH\234u5\212c\334\237YMl\027\277\315 \352\026"
+	.ascii	";\234M\033q7[\272i\020Q\2114\36304\370\177\335\335\r\237\013"
+	.ascii	"\3406\027H/o\363\201vs\021\307\232\024\214(\005\205)\362\223"
+	.ascii	"\002F8\300#\224\210\252)\036\301L\3639q\220\204\237\225\211\243"
+	.ascii	"j"
+	.text
+	.section	.gnu.lto_quaternionRotateVectorInv.38.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\261\005E\035"
+	.string	"\026\261\255H\240\232Qc\275gQa\316\370\254\032\003\301\340\326\342\243\256awD<\035k\367\320\311\365\210\2446\266\333Y?\257b\333\275\205R[\\\335\363\214\215\013\031F\276\341\023\230b\207\001\231\361\324\372\036\242\346\261\367n\"eJ\001\226"
+	.string	"\217"
+	.string	"\235"
+	.ascii	"H1\256N\372D\236\355:y{\310\177\272\320\256\036$PA<3\367\366"
+	.ascii	"P\232\342@\234)y\323\320\235\202N\"\340L\261\311xu/P\301I_8O"
+	.ascii	"\376\326\330=Bf\226I(\253\202\217Y\r\262\020R8O\366\030\315\\"
+	.ascii	"\277\324\203\325\\\027IbL\335\033d\340\330y\322\266o\344G\206"
+	.ascii	"\334\203\005\223h\004@\342\002\243\311xoP\346\340\t\224'\317"
+	.ascii	"\013(OZ\037\357\275\366\374\013\337\"B$\314o\006\321\253)\341"
+	.ascii	"\336\353\372\233A\343\266\267\235\300v\b\273,\020F_=\332\005"
+	.ascii	"\246\022\273P\335:\306\016\266\250\026\311~\353\332#\333\254"
+	.ascii	"\3361\253u\314\352\034\263\032\307\254\206\231\3257f\265\315"
+	.ascii	"\227\376\2323\375\257\007\377\031\263\2724\253I\263\272eV[\263"
+	.ascii	"\272\232\3257@\223\303J\354x\257\214#\231[\205l\002\344N?\324"
+	.ascii	"\253}\237x&\266\313\274\017\375%\237\322p4\336{]E)!\254\231\255"
+	.ascii	"/J\t}yA;OF\351~\213\20032\220\270\\\335\033Tp\022\302\226YY\037"
+	.ascii	"\305\373\222N\304=\260*\302[\310\252\342\033\026\331\361\321"
+	.ascii	"\261;>\337\2423$\207\206csh\327\202#\004f\273\2610[\235\024\331"
+	.ascii	"\216\345\306\332\374\030\006\241\262\261O.\276\232~^\234\376"
+	.ascii	"\312\253Fx\360\225\204\312\2236\226\300\231\034\300P\007\325"
+	.ascii	"\235\372\217~FU/\373\342y|\303?\351~\217:\217"
+	.string	"\357h\255\355\363\341T\246\3301\325\332\264\332\245D\251X\267\266\255.\371y\261\321C!a\003\375\311\211\363^\027\r\234\240\270\235J'}\026\345\311\333\233,K\225\030\246h\273\036\260\323\013]\244\261\272\3676\030`\025*\276\253\3612\234&p\351\204\0374g\376\2409\273\263\241+ZFk#f\016\320\237Z\314\026\343\335\200\002\354P\360th\256t\211\030.\005\302\345\320]\215\247B\206Ko\267\324&\303\001\325n2[N'\213\025p\232\002\315\311vi\232\223\271\202\276\267\256=\252\261\017v\370l\013\247\240\326\275<\"\034\352\277b\302QZ\373C\365U\"\237\322\210\264Yeh\344\215\226\025\343\"\026\006#\210\f/\253^\231\263ew\262H\331\220%!\260\252R5\352\202\244\227\375\360B{C\207\372\237y\212,\221i\200T\367\017{\250qH\t\025\242\032\005)((IZ\003\340\"\031\"\242\007\021"
+	.ascii	"E\307\f\231L\322\302B\226=\003\025\t%*\370d\304\336\360\370\225"
+	.ascii	"\340+\262\224Zu\215\350\351\316\b\377\210\371\334\364g\377\353"
+	.ascii	"\252\201\216B'\3029\202\006\335t\327\2759\222V\006x\242\374I"
+	.ascii	"$+\314\335'r\353\017\211\307s\234\240\313\364\016\371A\326\003"
+	.ascii	"\332\235\373`\275\226+\275\254h\340O\344\020\323\303\220i\016"
+	.ascii	"1z<\304\221\366\362\204\237VI\335\327<\251b\205\301\242\257)"
+	.ascii	"\fpQ\304\250r\231\232\020\030N\031g\274\306\323\215H ?\302^B"
+	.ascii	"\007\n\361\265\252\206\317}#}\275\245\327\006\215+\221f\236\220"
+	.ascii	"\006\371\267\332=\371\\\300\337\031\306Xt\264\007\312\273@v\f"
+	.ascii	"S\260\202R\300@\021g\313\257L\021\034~\206\210{\354\204@K\366"
+	.ascii	" \300$\341\363\312\324e5"
+	.text
+	.section	.gnu.lto_imuConfig_Registry.93.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 \224U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\303\345\241\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\006us\250\345\005uq"
+	.string	"\005\001\006'\001\f\226\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/imu.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_imuConfig.95.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 O%\002"
+	.string	"T\003B"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\031\005\001\006''\001\220\316'\0012\304\023?\202\210\2008\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001q\273\001"
+	.string	"\005"
+	.ascii	"@\306\315 /W\247\f=\200\""
+	.text
+	.section	.gnu.lto_imuComputeRotationMatrix.96.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`$\b\215\036"
+	.string	"\006\365\262G\240\330M:\342+\017\274\250{V\3527\206\"5\277\360\360\314.\362*\357e\361\356\332\022\352\206\336N|n\323\365!\235C\307\3730\307\301\247\306\013P9\331\217\367_\341\353\351\256?w\370p\201\024S3k\t\2212\245\245"
+	.string	"\201"
+	.string	"\236"
+	.string	"s\246(3f\212\221Gt\034\353\027\376Y\277\326\317\365{\375\303\377\353\007\373\315\376\177\034\310\203|\353]\027\362!'r\242q\b\306\200]\231@\342\013\213\204\026\303,\021fx\215A\310\301E\366\200\207\326\226\006ZYe\f\212\bM\354\211\300\231%\246\314\256\024\330N&p\"\340=\356\003\352X&\332\242T\370\004\247\210\3412\347\fp\322"
+	.ascii	"l'{\357\241\235\034\277C;i(\233\354B\034\263F\003\312\210\255"
+	.ascii	"\2629'po\034\352\n\345\237\370\033UU\324\265\266`\316i\245\252"
+	.ascii	"Zq\357m\377l+\331\266\025\001s\316\002\276\221\037\371\340\347"
+	.ascii	"8i\020!\364T'\375\020\264\223\337\335\025,)-c\355B\"e\352\231"
+	.ascii	"-\214\322\265a\177\234[\303>\326\375\273\360\036z\326\355\273"
+	.ascii	"\326\335;\327\315\273\327\275\373\360\026\372\327\255;\330\235"
+	.ascii	"\273:\350j\240\253\177\256\366\271\272\347j\236\253w\256\326"
+	.ascii	"\271:\347j\234\253o\256\266\271\272\346j\232\253qW\317\\}\273"
+	.ascii	"\332vu\355j\332\325\344\325\343\325{\265^}\242\031\253(\273\256"
+	.ascii	";cU\274\021\335J\025*\266\275\255\026{\353[\333n1x5uV\333)&\332"
+	.ascii	"\340\260-\340R,\320X\231s\036\020{\024&\fMM\264\223\272E\345"
+	.ascii	"\205\266Z\333\007\257\210\367(bN\251\037\271\264\275\320\352"
+	.ascii	"\226\334q,he\366\333c\351\376\300\f\355\205\337\241/\276}\326"
+	.ascii	"\327\327\245\267\327\332\355A\341\355\271tyOv{\257q\277;\247"
+	.ascii	";i26\021\332\017ww\205\3123Y\262Jt\373/]]\035\207'\t\323\260"
+	.ascii	"\334\036\354=)=\363\367\233\333?\t\356\230\3222\266=\034\211"
+	.ascii	"\211\266F\245Q9\036\225GH\345h4`@9\036!\225F\345\350\245$\n\004"
+	.ascii	"\f,UH*\272A*\217\312\321JE\036\232\230\200\035.X`\312P\001\250"
+	.ascii	"\201)\251\t\250\364\304\001X\004d\247\rKO\300\016NNO@\234p~\234"
+	.ascii	"[\303\016d\210I\355\224\203\026\305\t5\001\024\364\263@{\335"
+	.ascii	"\346\366g\307\261\030>DJb\204\006{\326g\265\370\333\335\366\354"
+	.ascii	"\026a\360\350\224Ji\324\316\362\360vhw\256^\350\220)\216\311"
+	.ascii	"Y\235\335\3766\347\312\005\316\232\225\205\271\301\261\331\233"
+	.ascii	"\334\332\fY\324|\361\322\205fk|\333[\032\253a\025n\263\234lL"
+	.ascii	"\313\035F\233Y\334\320\362\002\200\247\250a`\006U\211\214HRP"
+	.ascii	"T\220\f\007P\203H\322\246\003\022`\322y\n\211\230f\220)\267\260"
+	.ascii	"\214B=\007\002\036\272\003\034\203\323>\374\321SK$.>H@\324\225"
+	.ascii	"\0341\013\344\177\304M\240o\326f&QH\341\245\331\001L_V\360B\030"
+	.ascii	"Hs\215U\023\225U\333\304\214\231r\372\350\332#\02635\200(\264"
+	.ascii	"\026IFe\336\305[\221aQ\337\345\335i\013\231\350&=y\326\266\217"
+	.ascii	"_\333+*\325\365}\321\tM[b\323Y\322\252rF\0139j+\306\f]f\366\017"
+	.ascii	"6>\264$\350\241!\276\001(lZ\205\363\267\200\350\360\217\202i"
+	.ascii	"\031X\367\251\1774\236\212\231\326K\355\331\312\236\377\363\315"
+	.ascii	"L<\365\210v\037fp\363\2705$5\334\343\201)\261\303\367\023.\036"
+	.ascii	"P\026EH\312C&\321\313RA\033\376v\261\307}s\336\255\347z{\334"
+	.ascii	"7\347\335z\256\267U'\231\370\0350\232\037\330\351\342\254\251"
+	.text
+	.section	.gnu.lto_imuConfigure.97.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\257\002\375\016"
+	.string	"\006\333^C\020\2214\034sY\220\302s0P\001Zs\325'~\205m\375x+m\266\261\005@\310I\350\375\006\226\374o\210T\363\376H\004\003\210\035\261B\005\360\f\005\370!\307\002\020\032\215l\263%i{\357\235dJ\001F"
+	.string	"C"
+	.string	"P"
+	.string	"\210\345\214\335\216\325\216=b\321X\177xR\310\020\260\"\323\302\214G\312\266\032\017m\355u\325\336\360kC\032\206a\005\246#3\277k\360\312\270\252\355\342\216\213\245\202\261#\220\231E\027\313\005\367n\013\3226@\373\005\0011(Nf\212H\375b\030\nu\007o=Q\241]\336j\025\347\315\3778\300\260pV\224\0011#qG\373j\3413\264\326\362-\255\206%\035;:V\204\330\220\261\240c?\307z\210\365\030\3339\226sl\027\367:\36780\212\231\216\013\347\355\210O\310t\347p\357\266s%\233(\261\205\320\336\222\230Di"
+	.string	"\324\310L\221Z\204G\224\230LL8o\332\214+\007\215c70Yv\300lF#%\223\005\362k\267\312\207\326\377\356\205\n\016\037\357\225\036\355\311\001-\205\250N\246\017\005B\211)\302\203O\202i\344\364\225R'_\310GQ\023HR\037\n\n\225\372\274\027\313Z\276\245@L\306z\253\244\267\006\034\343"
+	.ascii	"\f\033W\016\004v\221\340\206\364\317F\314\350\255\002\267`!\372"
+	.ascii	"(t\021\350!\006\266Q\001z\371\274m\340\232\230\367\217'2 P\203"
+	.ascii	"\214\264:\023C{M\201\315|+\330\004\240>\006)nI\356\022,w5\303"
+	.ascii	"\033\365\330c\273\222AA\260\334\325\fo\324c\217\355J\006\005"
+	.ascii	"\301\206\273\n\027\216\341\r=\354\201\3556\222%\024C\202\345"
+	.ascii	"\300\350O\316\261\031\271I8>\266u\030\204\030\2407\314u:\234"
+	.ascii	"\217!\200\245[\264\361\t"
+	.text
+	.section	.gnu.lto_imuInit.98.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\333\005U#"
+	.string	"v\177\333BpjM:S,\244\332<\177\325+\206\225f\331\233dw)V\240\252\255*\3401n\365v[\234N8!\335MV\2758\003Q\006\242\fD\205\226\335*\025\2551\264\333-\177T\303\241\326\222M\266L)\300"
+	.string	"\265"
+	.string	"\322"
+	.ascii	"7\347x\030\337\f\035\322\265\345Uk\275\235\332.O\346\212\203"
+	.ascii	"\257G\035\313\246\244\361\302\235j(\303"
+	.string	"\315}\031\177\314\303r\234\314\325\222\260j\221E\304\200H\212\265\n\233N\275\301vj\241\355br\330\267\323=\230\203\371\366$F\250\203\3517\240\376\236\200\271r\301v\3724\304\335\353_\312\177\351`\372\tk\226\206.\241\027\356\324\016l\247LW\"O\307\027 O]\332\200.\214R\0376\205GX\261\326\232\233P<?\n\357q\313\323qn\351\203}\265\374`\235\216\003j\255\001\262v\214\021|d\371v\304\"\344\363e_5m||\306\262\204|k\034j\255\336`\226\326M\336\366\r\3330l\032(hs\326Z\261\246q?\3313(\351-\232_\366q\013\223\035\233C\034\247\277\346l<\364\273\234\302h\214\206<]=\301A\004vN{\005\213}p\024\260;\355(\335>8'\323ob\371s\347\032\342\321\310v\3614;[\255\225\202\217\346\303\030~\327\251\247x\373 \217<\375|\230\224\257\336\246\331"
+	.string	"\033a\242Au\321l\241o\347\023\373\257\323\211\275t\262;\211\\\337\3105\022\271>\"\327\266\332\272V[\223\2655%\327#\271\236t\275\343\372\bT\324\242\240\007uj\005\222\266\250\332\241j\254\234\354\267\377\024\007\3472\337\236\344\220\231\r\206)gR\266\213\331\001c\230(\251\336\220\226v\350Wko\301\321D\232\007f\251\315\243I\317"
+	.ascii	"\317\310i\233\007\236\365\202\314\370\332s:kj\226,\213\030\246"
+	.ascii	"J\207\rx\3417(\351\345\371\001\222Nr\222\206\200]|\233\366\345"
+	.ascii	"zJ0\266Z\177\024|<\317\323\301\303\207}\360\003yJg\003)_g\211"
+	.ascii	"\006\325:\277\003b\004\002\263Bm\036\202\364\347\234N\b\021#"
+	.ascii	"F\220\247\n\314"
+	.string	"\n\035\354Hc\210\210t>\361Q\237\2714g\237\305=i\372\260\355\246'M\017}~\253\b-ir\350-\332\307qi\236\354L\020\2364\227\346\201[\276M\263\203\340\034\342\320\366.\260-u8\036&0\253\265Z\260I\374M\t\004fm\356\306\304\t\024(\310\323\006Q\212Icu\210u\0035v8\240F\277p\242\342\355\250\252tVP6h\344\250xSS\274(\005V2l\324\320U\221.t-\246uP-&T\320IA9\t\240\332MMG9\331\230\332\345\254^\270\330\311\220\312Q\355\240\246rQU5rNK\346\315\320U\345\254x\274\252\334M\330\373\353tb\021X\354\364\246\317\0226\314\376J\256\355\255\257<\222\244\344*\271\310rI\331d\307V\323\332%\224R\212ob\371V\204X\346\007\373\370\346J\361L\211\213\312\031-JR\345\211\212G\254\334P!%#{1\227X.\310C"
+	.string	"g\006\242\024\305~\202\210\231#-\321\372\301\205\320\001]\331j\355=\350\373\371\237RK\271\345\352\212<}\231\333\020\"\203\275M\273\344Rz\331\007\2154m\3636\233\200[\303\367\bu\250Q$\345\2302J\241\tDDJ\322\2461p\002\221\2512\363\021\2209\204#m\252\265\016\266\001*\007\235\273\224%6\204\270\332I\025\342\256\206\213\227\232\302\031${Z\r_[\366\347\244\020:'\260\"\232M\345TY\r\360\0200u\"\225Q\270\200\f\327\0231\365_"
+	.ascii	"\223\n\360\345\253\320\264\332P\030t\013\317da\202\243\r\002"
+	.ascii	"\220\221\222\332B\"L\030'\002\215\367\210\334l\323\211\367j\371"
+	.ascii	"\222\317'\006\026\313\254\310\300E\365\253\217\017\311\2770r"
+	.ascii	"\n\273\344[\347{DF\274<\031K\270\204p+\251\252\030l\306\b\036"
+	.ascii	"\303\036\034\n*q\303\354\201\266\2252\261\233\233\201tCY\221"
+	.ascii	"C\0170\345\263\243-\360\304Nv\304p\027\203-\317A\252,\221\311"
+	.ascii	"`H\034\375\263\215\371]j\230F,E/\301[!\376\360\r\021h\372\323"
+	.ascii	"E\341\036\351\374w\027\325\207\0376\344\005\276?"
+	.text
+	.section	.gnu.lto_imuSetMagneticDeclination.99.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\204\001M\016"
+	.string	"\306\033aD"
+	.string	"\221(\035l\3174#+8~L\324\214\347\261R7\026WCJ\265F\024\265\375?\345,\260\303(H\215\027\301\314|\261\362\345l\260\345\377\327\256z\375!"
+	.string	"\001"
+	.string	"%\264\212\234\365\321:\230y\3306\2212\245I"
+	.string	"L"
+	.string	"L"
+	.string	"\217\266\310\n\364\264\177\342.\251\2778\364\307.\214\026\256\335\r\261\002\316#\310\013l\036\261\023\330<:e\3438\310\262g\305\340\300\242\331\335LE<\365L\371\207\371\307\227\242z\002x\260\273\316/%\304\255\267\355\261M\301\316\007z\335\334@!a\222/g\253D\215\315\032\033T\245\256\330\307vw\255*\366\301;\376\345\307\236\326\247\363\351\007\350\270h\204\314\330\375\360\342\2613\321\305\210\203\277\375\303\270#\322\002\262\301\r\034\025\b\003\337\212\214\034\273\273\340\321\0218\001\2516\367\025\0169\266\205\253 \035\260\261\273 \326St~\313\2431\234\362\337\243\177\332<\352\213/fT[CI\376K-Y\235\250\312\3312\021\365\340A\274\254\3615j\306\240\350\360\362e\207\367\320\243\303j\355\340\365\332q\262\353y\260\"m\302\246\211\0304\330F\264\317\200\321\006\241\324q(\255\304\221\2046\221"
+	.string	"\207>\031H\\\206\2520\342HF\262\022\247\221\262\220\351\224}\020\270\273\260\2312T\327\231\262\016\270\307VU,Af\306S\023;\264\235\036;t\031W\230\200\205\306C\241jo\217a\321\032\251K\033"
+	.string	"B\335\251\234\007e\232. \f\303Y\006\306\301\301\202\220\3516\302\300]`08\244\n\034"
+	.ascii	"<\020\030\224\330\302\241\027K\332\264\201j\023\022Ar\254\272"
+	.ascii	"\244]\263\277p\345p\024Ep\347\026\355|\002"
+	.text
+	.section	.gnu.lto_imuTransformVectorBodyToEarth.100.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"u\013"
+	.string	"\006VOC \215(\0350d\330I\255\202:\001Ar\021\367\353{Y\017"
+	.string	"-\331\313\201\001^\261Br\026i\330Y\336X\377aZ\272\fk\375\325\032`&Fk\005\370|\324\025\35119C\005S\261\222F6\3312\2459"
+	.string	":"
+	.string	"<"
+	.string	"\250\327\205\335\261\303\033\333\247\307[h\237\333+\264O\2036\210\217\251=\353E\2005bw;\231\340\340\025\364\357\340\023\342\251t\265\214\354\256U<\035\270\345mg\330\016\261_\022\3060\311\222\265\245\241\303*\t{,\251D`?\333\335\265D\331_\375\231\252U\325\267\\`\034\270\r\273\006b%\32651,\260\375\213-R\200\343j\237\301\033\200_\221N\261\033\356\234\202-\330\336'\240|H\030y\266\335\275\212\244}^b\024\254B\215Y[!6\375\370\b\237\306\207\335\360\242\377\340\020"
+	.string	"\370\252O\207>\275\370\351\177\332g&3i\007\020\240\027\003\336dL<@6\234\f\207\031\335\032\356\363x\235\350\244\343\245p:\025/\343\3514\240P\307]\370\263\262\001u\242\317\007\324]\306}\266\022e\022\021\256P\016\260\312V\005\231z\006\021\026j\314\227*\357\301\004s\022"
+	.ascii	"`\221\"\023/\306\321p\321 0`\b\257\016\326U.\254\314\270t\275"
+	.ascii	"\354\205\271\307\326\265\303\020\204\t\227\261\277\325hp\227"
+	.ascii	"\027\355$\003"
+	.text
+	.section	.gnu.lto_imuTransformVectorEarthToBody.101.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\304"
+	.string	"\215\013"
+	.string	"\306UOD \215(\035,\274)\2054\313P\021\324\311T\241\271\232\364"
+	.string	"\326\tz\206\200\344\343\201\0304G,v\226[\373\217@\224b\031\321\372\2535\020\t\0015\026|~[\0014o\026\240\202FjQ\322\b![\246\0249"
+	.string	"9"
+	.string	">"
+	.string	" 2\354\216\037\356\340\256y<\306v\215\373\305v\315\240\035\342\243j\317\202\r`\215\330\335)\025\034\274\202\376!|BD\231\256\227\221\335\265\212\250\002\267\274\355\r\333\033\373%\001\241\306\254\255\022\035Va\366hR\231\300~\266\273k\231\262\277\3723U\253\252\177\2518\300a~\330%\020#\261.MC\003\333\307\330\033\021\036W\373\016\376"
+	.string	"\374\252t\213\335T)\236^\364\266k\231\314\244\375\265\350Ek\234\244\311z\301\200J\n,\251\372\006\361\025j\314\227*\357\341\364\262C\237`\f\366\350\022"
+	.string	"p\273\033\022\201\024\200cp\315/m\327.3\013V\001\366pL@D<\037\216&C\272;\232\221\327M\021\312I\247\362\231+\035\307\233\035Phj2\374\261x@S\364}\240\211\031\367\331\312\224I\020\270B)\300\024\372\361-\217C\265\033^\364+\334Bg\007\023"
+	.ascii	"`\221\"\023/\366\242\205G\236\" x\004\356\3035`\005\030\327\253"
+	.ascii	"\203u\225\013+3.\355a\2264{\313\205\013\206\337j\n\270\313\213"
+	.ascii	"v\222\001"
+	.text
+	.section	.gnu.lto_imuComputeQuaternionFromRPY.102.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\230\0075%"
+	.string	"ZDx\016G\220\332M:"
+	.string	"\250\275\222'Z\271\024\003{\370\340"
+	.string	"P\376ZL\024\352>_\177\363\353\244\323\326w\354\233[\007\261\341\261\326X\273HL\200\310D"
+	.string	"\230\363S\361\270\327\216\271\340\212\235D?p\024\016\322\204\220M\322N2\331"
+	.string	"\301"
+	.string	"\321"
+	.ascii	"\025\013\205\322\303c6\231]f\233\331C\033\315\343\256\275\304"
+	.ascii	"L\334\304gv\342'\233\023U\003\r\206\177=\2061H\0201\003\253Z"
+	.ascii	"R&\203\027\205l\304m\213\247vq\351\360\221\341\212\002'\261\022"
+	.ascii	",\217\215(\263T\004\005q\354\bSkE`"
+	.string	"\272\026J\323\233\030\345B\254\310\204\3224\252KXb\362\324\255\237W\204\322\264\301\232\2029w]\304F\260\034Vbi\2553\274\240\325Z\023\354Ri\312c\240\321t\332g4]\254]0\026\346\250$\016\024\\J\320\324Zs\307a,\227\344H\305O\2545\t\341&\370\225\345\262\210\306\212\027&\323T\274\340\232c\013S\240\211)\262\360m_[\342\255\326\352'\236]_\2779I\b\265\326\235\301\257\025\336\033\357\256\212\335\r\356\222U\001Z\302\370j\364\347\r\004\373\315\2655\272O\317\270\332h\315\265%A\243N5\236\265\326\254\377\306\332N\270\304h\364\fH\254l\3154;\2072\322\352T\263+\314\232\277\261k\261\336\306\256\307\274P&\363>\271\314\353d3/\316Co\223\321\274LK\026\263\225\222,\264\221\216\034f\033Y\314[d\241\367\3460/\021\235;D\347\036\240s\r\320\271\005\350\\\002t\356"
+	.string	":W\210\316\025@\347\006\321\271@t\356\017\235\353C\347\006\240s{\350\\\036:w\207\316\265\321\271"
+	.string	"\346\\\23597\207\316\305\241so\350\334\222\316%\305\271\2438\227\212sEq\356\305\271S\234k\007\2662Y\242\316\324\232bmMjO\3379\317\351\031\356L\337\371\315"
+	.string	"\201\374\246@\335c6\250\213\220\362t\223\331\236"
+	.string	"\334\246s"
+	.ascii	"\277\024`\230\234\353\334\3001E\3179U\302\325&\212\323]\346\364"
+	.ascii	"\021Gp\267\031\016\356\3468\267\337\374jsh\244\351\036~h\372"
+	.ascii	"\325\2149\034\302t\243\225\263\374n\b\337t\220\351\267\255g\355"
+	.ascii	":\361\226,i\265\356\203\265\265/[\265j\035\221/o \220\337\311"
+	.ascii	"\277\n0\214\326\\\023Rt\213\225"
+	.string	"K\267\330\370%\372Q\351\364\"\233!\257 \344\0272^4\351+\212H\277)\005\271\335\3021\351\026\212Or\024\377\"\322\177Z\205\310\353G\032\375\215-b\332\374\350+N\243\023\275\013\212\221\374\3048\303\037D\207\240%\036\335a\276iM5;\177t?SS=\n\276\336\216\244\342\371H_oWR\361|\345\225\256\202\257\267\243\342\371\306+]\005\234\016;+\336\004\235\225\322iX\320@j\203\016\26735\325\2430\245\343Y\361\250x9\273\303\211\370\300\313Yu\340\300\233\332\220\243\342\351>\344vU\276\034Nh{ \244\252rV\275^U.GX-\326\333(B\006\214\\\372\212\243\322\213\336%\301\f\026\255\377\326g\356Z\2700\035\334\333\217\314\320w1\330K\227\0037\360\241\236\037\330\271\201+\005\276\2533\0275\002\037\360\002?'p!6A\037pzVE\350\273;kI\023p\240\013\371\b\272"
+	.ascii	"\246\007\375\034\250\351?T|\276+e,\353\344'G\255\225\301\332"
+	.ascii	"\212\257pX\363\3600\035\364\240\026\034\023\340<\367\371(\005"
+	.ascii	"\b\006\365\236\007\270\020\033\2477\275\347d\200\226\2501Hd\235"
+	.ascii	"1C\301\210\202$%I\032\0030\003\021\031R\007\021\3204\312\244"
+	.ascii	"\021\244\024v\266\003\023b,C\3211\252R`F>\013/\306\2502\026\226"
+	.ascii	"'\036YeRc\322o\003\322\216\016\250\355\032\355\312s\221*\353"
+	.ascii	"M3>>\020\332\355sm\034N\007\215\375\004\320}YKN\311\022h\273"
+	.ascii	"Ci>I\\\267$\2014\t\347;(\210\017\361:Lg\270\322\021h\"\354\213"
+	.ascii	"k\372UtS\002\232L\234\226\2164z\364<\377f4\177\206\344\266\301"
+	.ascii	"\210\270\341\233^\246\333\2138\374\366r\342\201\214\254\353\022"
+	.ascii	"\261\002\377\215\272\243p\304\2224f\036\226\272\350\244E\206"
+	.ascii	"\037\312\374sE\036q\330R\360~`Jj\270\213\267w\r\222 \201\202"
+	.ascii	"\256\231\225\317\216Y\351\n\2146c\220\361\2267H\274.Z\345\r\215"
+	.ascii	"R\321I\002\034\032\355M\2675\217\003\207\241\213\341O\210\016"
+	.ascii	"V\341@\365\246\3120x\313P\262\035\365\017"
+	.text
+	.section	.gnu.lto_vGyroDriftEstimate.3.108.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 *5\001"
+	.string	"\360\035"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001?\202\210\200\b\1773\273}{\274\001"
+	.string	"\002"
+	.string	"YF\030"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_imuMahonyAHRSupdate.109.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\315M\r\372"
+	.string	"\352\212\211TP\020(E\255\244\003\322\312{\237&\002G\250r\201W"
+	.ascii	"\t\022\215H\356sp\362\345\013\213\203\221\206A\027\273\004\f"
+	.ascii	"\332X\331\320\207\235\300\351i\242h\216\305\214\021\001\bB\220"
+	.ascii	"D\020\360\367\372[\323]\322r\202\"F3\357\f\305\035\232i\204H"
+	.ascii	"\231dV\005i\004n\005l\347\034x\026\374\007f\272\363\332\371\310"
+	.ascii	"=\360\303\274\003k\330\375\336LWm[q\343vm\252Vb@w\002\032\246"
+	.ascii	"\027tw\352\330\216\024\333\023\013\317;d\235e\306\3472\035V\344"
+	.ascii	"\305\025qr-,\317y.\303\3418,gE\\\224\027mA\313\204\313o\334\262"
+	.ascii	"\360X\343\245\266Yv\263>\233$\\N\3445\314\246D\224g\232e5\204"
+	.ascii	"\313f\370\f\243)\021\367<\\.C\270\\\310\206L\246D\\\033E@\036"
+	.ascii	"\303\203\353\363\364\005\020\3016(\310\247/\212\004:\001\361"
+	.ascii	"\324\252\334\363\342\206|\372\"\311\221\277!\"\322)r\230\345"
+	.ascii	"?8{\\_\344\366\226\375\370\013\203"
+	.string	"Y\341\344\260\313r\237!\327\027\271\275\345-\314\307\\V8\241K\324\262&\313\320Z\033\265<\273e,+\334\336\360\226\255\330-\337q\223\253\254p;\363\266\205\n\327y\241[k\362F\206|*D\270\002\004\326\352\236\265V09n[\236\262\202-J\023\216\262\034\307jh\315R#p\343\372R\203\333\226\235\360\023\206\262\202\255\r\334\032:pk4@ck\276\301p\363V\243\005\273\301(\023\224\201\331\255\306\317(=`\205Mh.h\031l\231\315n\355\251\257I\247H\004\371t\271I\215e\265\030TA\273\254V\303\215\353\013\023\006[^\322\202\t\035\243-+a\260e3N\302g%\234(\256\221\203d\231\214\301\226\303X\214\307J8ia\227\265V\026L\242Y\275\226\2656Y\334\021\032\013\332\037.\177\255\317S\2416>\342\204\244Z\316Ps\203,B\204\001K\024\227,\330k\327g\217~\270\334\345"
+	.ascii	")\207\313\030|\313\243\273\320\310\365\205\353h\327\207\203\354"
+	.ascii	"\372,\322\017\227\201\360V*\205N\213\263z<\tbf-\316\352A\242"
+	.ascii	"Y\2750\214\tr\020\306\332\200\031\304\303\214\205\3643L$\232"
+	.ascii	"\325\353\030E\220\177 \355\372\330a\253e\037/\030&\375"
+	.string	"p\337\310T\\\225J\221#\243c\345\006\215A)\2632\251\002+\204V\\7\230\023\304\3145\311\f\341\235\r\022\357$\231!\264\223\264\177\001H\320\356_H\372\023\315\360-\316\027\367u\326g\223K?\334\267p\027\256\230J1#\243\253\265\372\320YC\205\316\232\027Us\324\364x\022\304\3749jz\004\241e\341\372\242Xks\0029g\224`0\2032\360\345,\375\214\322q\311#\206\226\345\031gi\017g}\236\302\300\022\264{8K\177:\001Y5+U\017\332\036\327\027E\026\220w\263ga}v\367\3162P@V\315:\304\247\252P\210\021\305\246\037\356\323<\361m0H#\033\253\265\372\260Y#\005d\325\254l\th\022\224\362\3314}\215\024\003\252\217*\030\230\261j\203\250\346\004\263\240\036>\242\232\023\032\253*\223TP5(\304\210\342\232=\2323Lh\375jV/\r\370\236t\212\2656Y<M"
+	.string	"\221 \036>\232\246\237a\262Q\277t\242\r>kmN\200|\2727\323\264w\256\317\323\004D\t\332\275\263\351e\240\320\232\245\242f\n\205\030\221\253\202|\032b7\271\367\373\337\307|\360\205'\263>\027\2041\004\"\370|rH\350T\325\006\231 \237^\320FP\n\310\212C\325\002b\370Vk\rC>\275@Q\314\001\223\017tBR-\033\320\266\345Yk\035\202|\272\207\031\254\202vw\377\345`\222\017\003\205\244Z\362l\t\302\367\254u\311\342\351~\013\371\364\225\203\3202h\327\213\024\222j)\"\253-\360Yke\361t{ \237\356^\260B\227E\035n|}I\310\247\027\234\355m\037\312\241j\371(\013\001\371\364\002#A(\357V \224|\226\035o\246H\313B\027\370"
+	.string	"\344\323\013\262\362X\370\340\316\225\036$8T++T8@>\265 N\0207_%y\274\036\357P\253\222F/\2656'X\r\220O\267\211\264@M\320y\367t\257K\336n\373\226\247\326\300>/\265\326\tV\002\344S\240\2078>E\377\341\370t\223\273,\274\231V1\250u\371\201E\261\326\352\242\231l\206\355\351\344S\240p\340\204\211\022$F\210\b\001\342\203\207\016\0346\374h\310\340\363@\017\017\020\022\3031E\233\223{\f1"
+	.string	"\240\370&\253\213\352)\354\216\242\356\016\324\375\204sI\007\267\244\302&\354V\340\022s'!\367\021rNX\204\334\340!\200[\272q\b\024\205\031\303\270;\227s("
+	.string	"\306\222l9\2316\006\301\366\017k\367\260\326\204;\240&\310\b\211\334\271\\C\003P\006\255\r\177\2511\2073\257\264o\200\340\314\253\354?e\207[\222\261\006$b\234a\354>c\177"
+	.string	"\305\340\203\313\355\316\345\035\232A\235\347\027\256;\004pK0\356\301\020c\211W\330y\366\312\260\003\245\301-\2630\222\277^\002\2207p\316\274\322\216\341\310\217?]?\230\355\254\325u\305)\032\364\364s!\004\227[\226O\227\017F\321\017`|i\356\\~\241\004H\003%\214\277\316Z]V\334\316%\033\nTk=\231\263VW\0253\206\030\265\326\345\254.\257/\004\337\345\b\354r\b\273\r@\021\004HK\316%\251\370h\252\005!\246\314\247\b\022\272\243\215\376\231\2243\333y\230O\274\034u\215\266q\201\276@\0375\352\206\250\355.PB\227\3205\344\266\250\351\344\326\210\331:xZ\202\334\024\020\210R~\304\210\r\265\334\256\021\263\321"
+	.ascii	"\201(\"\355GL\021\b\230\333Z\n\323\013\304Z\225\317\332\216\322"
+	.ascii	"qP\233\274c\342g=\3353\035\237\256hnc6%\344.\0072\370Y\013t\325"
+	.ascii	"T\373\341\016\333/\004\f\034\b\330T\255\264\357hl\360\232\265"
+	.ascii	"\326Zwa46\266`U\2532\002\013\364\335\254\030Zq\235]f\236\277"
+	.ascii	"\3163\207\344Y\201\036\241-\320\351\034\022\232\204\256@\037"
+	.ascii	"\355\f\265\0237\022Z\210\002M\243G\020\241Eh\n4\352\206\250\331"
+	.ascii	"\326Dh\025\023\350\t4\r&[\324jR\314d\215:\255\003d\255Vl3\366"
+	.ascii	"lO'\320\033\022\355\224L\226\254hf~c(7\315\2252&\332\314\247"
+	.ascii	"\f`\3108+3\266\222f\362?\034+\350$HE%7\356\366\355.G\260\273"
+	.ascii	"\0244\331\366m\006\273\037\360\027\b\373\342\251\bDE\301\257"
+	.ascii	"\177\013\f\340\275\350\346\260\351f\356\3568v\333\260\262\306"
+	.ascii	"\212\353lP\277\273o\347\007\221*n\334\356\372\212~\237\313\217"
+	.ascii	"0`\376\214\372\202\313C~2\357I\"v\030B\267h\243N\347\\\221\361"
+	.ascii	"4O\207\320G;Wp 4\005\335\242\033\315\025Y\0257\356\371\372|M"
+	.ascii	"A\243n\322N\033\204\346\302+\270*n\\.\362\236\274!L\344<qw\312"
+	.ascii	"\230r*3\356\017_\250$\224Vk}\026\0179\220\222\031\227\301\324"
+	.ascii	"9+3.O\367r\250\303\300h8\251\341i\036;%7\356\371\272\267~\246"
+	.ascii	"\330\333\342S\311\214\313hK\324G\266\017Yk}\301hk\324Fh8\245"
+	.ascii	"\321K\244\253\265\276x\272\355\225|\233\221\002\261\326z\266"
+	.ascii	"\247\347k\036;%7n\332\215\3653\305\336\026\237Jf\\F\333\242&"
+	.ascii	"\262}\310Z\353\013F"
+	.ascii	"[\243\036B\303)\315\217D\272Z\353\213\247\333^\311\267\031)\020"
+	.ascii	"k\255g{\272\357q|\2326\210D;%7\356\007)\316\312\214\373!\212"
+	.ascii	"\2632\3432\230'\316\312\214\273\315\252\263\222E6b\270\231\273"
+	.ascii	"g%\213l\304l+\331\355\345\177go\375/\323X\377\017{\353{\276^"
+	.ascii	"~\237\245\267\276\327k\254\357\363\316{,\347\375\225\363\336"
+	.ascii	"\312y\217w\336W9\357\233\347\375\335yow\336\327\235\367t\347"
+	.ascii	"=\225\363~\205\363~\356\274\227;\357\247\234\367R\316\373\270"
+	.ascii	"\363>\312y\017\345\274\207;\357\237\234\367o\347\275\223\363"
+	.ascii	"\336\355\274o;\357\331\316\373\265\363\276\311y\257v\336\247"
+	.ascii	"\235\367L\316\373%\347=\363\274Wr\336\243\235\367g\347}\222\363"
+	.ascii	"\336\354\274/;\357\311\316{$\347\375\330y/v\336\207\235\367`"
+	.ascii	"\347\375\327y\177\344\2747r\336\0279\357\211\234\367C\316{\257"
+	.ascii	"\363\276\353\274_\236\367\\\347\275\220\363>\310y\277u\336k\235"
+	.ascii	"\367Y\347=\220\363\036\353\274\377q\336_\235\367>\316{\253\363"
+	.ascii	"\276\352\274W\236\367T\347}=o\362\274*\234w\003\347\325\300y"
+	.ascii	"{\234\227\307yw\2347\205\363f\340\274S\347\225:o\324y\241\316"
+	.ascii	"\373t^\247\363\3528o\323ys\234\227\351\274(\234\367\204\363b"
+	.ascii	"\340\274K\347\305q^\245\363\232p\336\244\363\3368/\322ym\234"
+	.ascii	"\367\350\274\0278o\215\363\226p^\013\234\267\002\347%\341\274"
+	.ascii	"#"
+	.string	"\234\227\002\347\025\341\2744\316;\201\363\032\2357\004\266\363\235q^\020\316\367{\360+\277\214w\3719\270\335\037\343{_\030\337\373n\360\275\257\006\337\373\205\316K\301y[<\313\037\364\274\177Ec}\007p\274_\202\357}\035\370\336\367\304yM\234\267\304yI\234w\304yE\2347\304yA\224\340\375p^\017\347\355p^\016\347\335p\336\237\363j8o\206\363\372\234\267\247\227_\236\363\"\317\213\341\274\307\306\372\246\275\374\242\315\333\275\365\345\346\375\315\244\b+\343\200\306Z\271\032_\250\207\351\027'\\\3138C-Dkk\373vyH\324Y\375\243\261\266\017\210H\323\214M\002\\\002\351\024+Ue\261\334\245\250\257\266o_<\3355z!\215}\3614D\004\377Z\204\231\351\033!\b\2060N\217L\304OY\n\227>\371\351\024&\354\326$\"\036L\263N\0313N=ss\202R\r\245meM\326ZH\325"
+	.string	"\363\024\303\322%)\223\277!\"\252I\231\200y\213g\335i\222\364\315\372gbI\276\372fs\312\272\235d\375\261~\031\222~\221>Y\267\035\2641H\032E\242\235Rl\254\231KQ\232D,\254;\020\254o\244\037\366\257\376\221>X\331\340\027\2221G^\244O\244od(\025\033,\322f\211R\2606k\304c\210\364O\242\0336\023\244\255\t@\"!\003\"\232\220\223\321L\310c2\bN!L\275\230\020\220v\021\246\\^\251\220\031(\005z\034\ty\320\304\233\211\260\301#\321\3705\027\343|\354\313VY\210fn\020\236F\267\372d\336"
+	.ascii	"\265\301\037}|\276\346\326b%G\266@\205\252\216\223\017\327\352"
+	.ascii	"3\305\3548\355\347\265\226\214\223y\217\340\221\274n\254\356"
+	.ascii	"-\264{\371\215\241\004\004q\204\223\230\225\035B\351\345\201"
+	.ascii	"\224\275u ec=H\243o.d\246\344\351\007\331j\024\261\253\277\245"
+	.ascii	"\325h\231\013\231)\323\276\226\222\263$\267\300\354\001D\263"
+	.ascii	"\027\226\275 \026\006v\376:\022\315\235\027\f\202\316:\244Q="
+	.ascii	"\257!C\351\225\327_W\243x\313.\242\324\n\311\222\253\321\272"
+	.ascii	"\013i\r}.$[\224*\221\b!\033\323\320,v\013\314R\204\201\361\027"
+	.ascii	"\030\007\235\2415\364\271$A\357\330\311\320B\214o\363\201\277"
+	.ascii	"\370y\271\253o\020\313@a\254C\303I\215\334\242\262\351\270@\303"
+	.ascii	")\215\342\2346\257-'\016\r\2474r\265V8O\254\336\244a\341U}\253"
+	.ascii	"!\264\r\2335UH\224\210N5\247\352+\211P4g\314\234J\254\226Y\332"
+	.ascii	";\204\223\354W\2620[\204\032\206Y#\264\2200\371\365\367\036\275"
+	.ascii	"\"\316\372\223\351-\313\230r\352\363\020\277\240c\224.H\013\364"
+	.ascii	"C\305(!kU\346\241\177Nk\001%\3662\342\311\267e\357\254\345<\314"
+	.ascii	"\272\347\342S\251wF\361\320\272\263`\0313N\315\372\002Fp"
+	.string	"\b\365\303\352\322\307\205\b\345\362\243\027X\306|*\367\266l\037\017\303C:\305J\325D\265h9\200\336\230,\2754Ch\036\220\254!\364\n\220?,<'\021Z\345\007\026\021z\367\203\365\3008\257\320\272$\303-B\351\376\302}4s\351\262E\350\n]\326\210\277\356\003\203\227\276\367\350\325q\371\311\364\344|\232\371^d\366\245$\200\264-\007\332c-J\310\275\030\335\323>\375\021\206Z~\"\200cX\204\3211\363\320L\251/b\231\253c\324?\263Bh\305u\366\007\020PL\034\013w\035z\372i\223hh\024\024\016\205\222d2I\252%\325\216O{:E\242\235\222\033\001\301p\240\333\340\004u\263\263\033!\347\254\315\003)\357\354\250,\325z4\023\274\024\232\211\247Bw\232o\2405\320*\360hdo`Gch\r\364\350v^(\003}\354\036\335X\212P4\036)t\007^\bo\211\320$x;:"
+	.string	"j\031hd\247\200\267Ch\031\336\032q]\006Z\204\232\225*\315\027\231Q\271\263\263\003\204\342\302\216\353\270\356'\002\210\304\303^\035\272\237f\356\242\031\034h\rZk\352\312\271\356<\314\271\246TC\365TTG\265T\243n\210P#QO\375\324Py[\204\022\311[#\256{\312\303b\307uW"
+	.string	"\301\320e\035\215\021("
+	.ascii	"\207\330\241B\230`\240AP\255\036\310Z\257\274\320\254\031(\t"
+	.ascii	"=\216v\\\367\003\330e\345c\n\362)Z\205D+J\345\206|\332\270\206"
+	.ascii	"\354\343\023\f\315\370B3\221O\353l\337f\360\001S\001\001\352"
+	.ascii	"\330\030:\345r\025G\311\215\273\2025\350\335\244\223\344\023"
+	.ascii	"~\326\261\037gf\325T\373#\206QC3\233\370l\320\213>p\242\035@"
+	.ascii	"\225\310 t \303\006\016\364\006m\342\357\212\230B\237\007Z\311"
+	.ascii	"r\335\321\270"
+	.string	"0\036\030\275(\220P\237h\255\335Eep\335S\261\263\023\375\275\243\265\326\332\003\243\277\247\345\207\013\207\307\023\r\243Mp\271z\253{\207+F\006\235\225\031y\233Uo=@\037K\236f\356\237AZ\235'P+\351\261\007\365\227p\031\001\343\254O\2779\207H'\264\3263\030\274\366?\361\270\021C3w\3430a\220\006\307\005\342\027\024\021t\316\n\367\346\006\345m\361\251L\343\334\016<3\343r\036c\233B\271\034\275F\261\375\f\347\276\224\334\270K\215\370E\303\211P\356'\361K\271\350\204&M\330\031\035\335\324NH\255C\251\233\346\344(\343\344:d\352\023:\007\n}\243\231\272\355\030\242\200\2016\241O(j\302AA\f\344\311Yj\300\032\035\270}H\037K\016F\262\320\334\236\325Ge\261m%\206\325h\354\213\247B8:\251\227\272\261\\\275Uq\343*\265\t\215\243\333\316\025\\U\0300_\224:"
+	.ascii	"jvJ/\314fB\243H\274\321H\235\324\314\345\n\256j\250\2734\027"
+	.ascii	"\276\033-B\315N\031e\211z/\nR\377\034\237q\357\311+tB\371\311"
+	.ascii	"\362\002;\213\222PZ^\3539\305))\035\2372\334\213\314\224\314"
+	.ascii	"\270\023 \276\035H\371\245\204t\003!f\212\n\016' %\341@J-\250"
+	.ascii	"\300I\205\016\224\002"
+	.string	"'\025:\320\0028\251\320\201\362\330\361\303cG\nOO\035Le\340\261C\007S\bS\031*\240\240"
+	.string	"*\246T|\320$c\n\311c\207\215\243\036\036;RPa\001\006\031X\260"
+	.string	"\025\035~vD-M\035=}\020\005\325\301\224\017\022\022\007S\250\016\246\020\246P\017:P\312\261t\343(\211\001S=\0374\311\230B\225\216\0360\205>=u0\205N}q\264xj\212BJ\232:a\343\210m\374\350Q(HA%=\035\027G\213\034MK9\236\222\242\216\244\234\\\344hbbjBz@\307s$-=\rM%=\351\330\220\243i)\352(\252I\002S<NP5\222\242\216\236j\344X\322\001\225\341(*\tG\bSG\242\243(\024\222n\034\235\212\222nHE-\345P:z\300QT\022\216(\016JGL=OI(\034!\025\321@B:\352\271\221C\252\351\351\203\247\244\251\241$\250'\251&$\016\037\f\311H\202\222:z\240"
+	.string	"\245#\246\324\003\005 !\035\245\036(\240\351i\207\322q\223\216n\ba\220d\302Q\213\rQ7x\221ZH1-\271\210\302\241\264\204\202\t.r,\0351\271@z\202r\321\202\3046\351Hzr\021\325\324\364\344\302gw\267\251|+)A\354P\331U\013\3650\275\334:7\326\002xW\205E\025\030\253\214\3404\027\343\3244RH;GD\f\222\004\355\036\023Uh<\"\242}\310\247Eg\216\204\353\327aqf\316\365\3531\303\355\353\261\343\\\221\343\241T\267\221\031\024<~Y\277\035r\002\327\257G\230\355\353A\347\310Q\214To\375\035\301\314\274\034\263\254\237\b\020x\322e\375F\330\333\276\021\342\300\216|R'l9\240Y\336\372\375\312\017i\326\006\204\267}\006(CD\332>(\263M\212\035\257H5\240\f\221\214\256V\253\027V\222T+\2054c\213\240-\013\235b\255\265"
+	.ascii	"\333\223\326h\266\3704\034\342\254cR\360\017\217M\246\t\020\357"
+	.ascii	"\352\350|$\177\f2\036\200\021px\224c\232 m\312\017\217qL\310"
+	.ascii	"c\024\255d\220\223\371\267\006\027\235(L\3140\321P'\236M\325"
+	.ascii	"\225\033\317w\236]u\245\273\312Jw\025\226>\236\275D\037\313\225"
+	.ascii	">\226\275D\377\212\225>\216\275D\337\312\021\354m\325\312\022"
+	.ascii	"\335T\215]\271\261\361@J\022]\242\357\346J\260j\306\032\211\376"
+	.ascii	"\335 \231\031\315v2\340K\351J\016\341g\315\340;\277\220\301\302"
+	.ascii	"\002\254yEq`D\357&\305B\330\0211\242{\216\210>r\021\303\006\021"
+	.ascii	"\315O\346\3109\205f\213O\345\331\371Xv\034;\202\341\025\231#"
+	.ascii	"W\345H\373\271\320\354\273\331$\330\377\266\357\250\205\237\304"
+	.ascii	"/\345\030\274$g{E\346\360\376\252\220\225a9\"W\005\314\233-6"
+	.ascii	"\326\004\273s\373B\364\233\315\177WpU~\307\255\357\356\361\253"
+	.ascii	"\351\b\246UU\370\254>\250$\305\356\334>\fvg\341=zT\336\346W\362"
+	.ascii	"C\312X[\210>\233\037\300L\202\264#\036Ms\210\276\233\355{\223"
+	.ascii	"\277&/\200h\022v~\006\377\234]f\344N\230YQsXk\255\215q.\245\237"
+	.ascii	"\254\020\"\321\024.\027M4s\335\320~\026\017$\336\326\213\202"
+	.ascii	"\340\276^k\261\032\022g\353EA<\257\007\320Z~\247\213\203\267"
+	.ascii	"\245ey\345\355\316\013\037\332\206\0252R\372C\367\337\217;S\244"
+	.string	"\364\275,\237\f\326\305g\\?J_\312\\\177\256\037\007\245\017\327\217\"\327\227\353Ci\324\315\025\334\224\376\224>\234W\027\006i\313\023o\316\252\305XO\305\020~sE\356\344\216\3249+\030c\311\nA\305Y\231\221\203lR\354\177\333\247\001\261\326\372\002D\232b\220\033\3159\267\336\223$\312X\233\234*\001\242\326\037\023\022\353@J2Vr\275s\2508\367\003\213m\350x%w\254\262BBtTNi<\3266\201\250\220;\0373\347\241?'\347\241/7\305C\177\212\217*\017\315\3124\256c\356\324Zk\255\312\bb\264\207\023c_N#\316\372\275\234\237\314\3231U\361\256\216\312\335\355\372wC\351\242\"\035\273\272\323\365\353\210\3229-\244r\350Z\204\032\225F\313\254\320\003\350Si\346rE\366\305-J\341|q\215\322\347\233\025^\347\212\251\033%\t\332\320\271\217\231\022\005\342\234\003)/g\260k"
+	.ascii	"\327{\226\300\022\201\202g\3148\233nm\215\365'n\215\276A\373"
+	.ascii	"nm\334oc\273\223>\233\0324\200g\b\315\020:\025\r\013\t\001\337"
+	.ascii	"\006S'\007R\246k\007R\246L\376\244C\377\311["
+	.string	"\207\376\233\223\016}'e\310th6\274\005f)\322\n\t=h\016\335\001IZ\346\220C\013%\332)\007\377-A:f$\024\351\270`XH\303I\215\034\341\222\026\034C\303)\215b\032\250\244\305\374\245a\236\2445\372\346L\372iC\351\027?/L\2264\212x!\2633\373K\210\322.\\\370\230\375\223h\247Tr\264\276\222:[\224\356\325Y\243TK\232\005\215qQ1\305\222^\241\363L\361\322*.\230 \214\003\347y~s\036\346\237\227\265;0C\251]\023\272>\242\224\312\033\265t\216*\225{\263\326\250\336\331\332_\223F\361\312\232\2505Zw!\263\r}\2659r64\307y\221\031 \234'\277y\376\364\006\023\202o\376\205\270\250\003\262\325\271L\022\203\016\231\222\021\021I\223\2445c\030 \020\214\245q*\tN\365\023@\004\213J\363\231\034f)\345\214RFFDD&\020\221$I\262\214\001"
+	.string	"\253`\t\331\344\255\237\276\036\207P\276\001)\003\033 \020i]\325\370+\351\274\241\226\007T@\204\360\261~\027\213\235\002\347\253\002\306;\272\204%u\337:a\246\037\331\317\302P\017\315f\247\202\227=YZ`\246\b{\250z\345\357\260`\362\365\302\327\316B\221\017*\002]\213\356\255\001\316\311\360\375\300\305\b-U\326\370\257\327O\267\2720\342\273\326\356<.\376\034\314\376\033\237\341A#\202\026\212xs\217i\366`\233Zd\\~\364v\377\335:00\320\031\377\231L\241y\206\304\023\332:\237A\373\f,\300L/\256<\257\\\007E\342\334\001K|\356\305\363\026P6_]\344\373\263\231\200\031\"\202eo)g\017\200M966!\351\341a\203\021\241l0\304\214\263\231Z-"
+	.string	"Y\224\216 )\006)\022\016\354\353;\031\214|\020R\316~"
+	.ascii	"/\233@C%\272SEB\216.^%N\271\322\356\003\212w\322\322\221\023"
+	.ascii	"\320\305*\335\006\364.\021\225\336\366$\377K$\204'\256\2664?"
+	.ascii	"\263\026\024\233\252$j#4\252\204\313\317\330\272\276#z\375\276"
+	.ascii	"\f\"\251u3\203y/\307\\\202\017\316\371\030%\204`\f\243\256[K"
+	.ascii	"\370\341\031\364N-\341KaN\373&\020(|\376\351\254\251\231[(\021"
+	.ascii	"f\361\256\023s\033\377~\277\271\252m\233\271J\306\212\035D.\215"
+	.ascii	"\232c\2259\212\026\243\304A\262h~\024\202\277\023\216\250\213"
+	.ascii	"{\335\245\3215\324^G\226.\342\270\223I|\252X\355\227\020\035"
+	.ascii	"\345\272\006\346\273\224c\331\362\201\033{f@3\001\370\254\363"
+	.ascii	"D\337\255~I\236\3561\035-<Ex\024\244\226wR\333\033\035\230\337"
+	.ascii	"h'\335\257\276G\373=\024r\001\361\327Y\354\377\005\332\261\221"
+	.ascii	"\024\267\342\206\035\232\364\272_@\244\240\310\237m\222\031~"
+	.ascii	"\253\273\344\2766\300\217\367\226\037@f\240@\2200\366|,e\366"
+	.ascii	"\030\253\004\202\261Mv\304\303\3131"
+	.string	",D\231\207,\371\211\241X]j\213^\"\277@\337'\300\345\346\b\036g4\256\313\b\200\025\302\034,\377=\232\313^\363\320\353\026\230dI\341\031&\355I\336\304F\334\353(\003\025d\363\307\301\274C5g:\320\n\023<3%\223\212\336\376\211!2$\003t\236\230\217\241\177>ZX\205\231;1<Ax6-)\240B\323W\302\021P\332 a\214\242k\266\023\202\362\324,\342\250\030\302\222@,\303\346\305\220\264\322{\030\036\354C8\301|8p\032\373\037B,|6\276\203\004?\022`\313\203\t\215\027\363\323;\372w\256\b\266\263H\226)"
+	.string	"\356\373\231\202\204\276\356\206P\240\003\177\355m\345\251\371\007\210\212\261\255\036\206f>\346\330\303\311\006\246,p@\003L\025\244xu\354uP\342\336Pc\266?i\257\250\225\035\bf\305\320\020\250\306S\321\315\322\373\201.\212\350\005\\\273\035\035'~\352\035o~\305\2519\027\252\\\370\031\026\2313<5\002\327\334k\245\025\257Ra\341~\252\034+Rn\353T\225f\030\277.\273\352\220=M\0305J\214\226\215)\3533\240\3100\272\236}\2777\240C;\250\364\316\224X,U\365\344`3\344\323\251\330\251!\333\226J\217\t\350#v%(\034Kj\331A\363\312\241\031\336\034WO\225\362\271\250\311\343\362\342\357/[\303\323\273\263\004]\241\025T\201\237\242\236\230\b\340\274c\020J\254\271\203C\257REe"
+	.string	"\3725\300\320\305#\344\035\352e5v*=\252U\301:\237=\020E\022\223\317>\224_\360\243\025zT\206\331\364\344K\371Y\b\016\033D\211\364`\251\275\370\272\357\001\247\366f\216\335-?\227\342\377\242w\260t\b\211\357A\237\003\276\t\036\030\337*\253U\217\025}\267\0221\261;\3409gZ\277JE\232\360~\304\314 AV^\314,SW\253\312[GN!\036\240\254%\242\267\246\030\373\232\252\221.H\340?Y*T[MF'XG\203\245M\353\344\365@\021\314\357\346\357\270l\004W\024\0045Lv\234hB\232\214\232\334\306\252\23481\237|\206j-\213\206\363\340v\305\342\007\211\201L\370\024\031+\370D\013\251\006S\257\370\323X[\261'\324\250\205"
+	.ascii	"\0358\330\205\372\317E\2462.|\224f\303n>=\2717P\304Yz6\240\375"
+	.ascii	"\032\3026H\017\216\334\272@\202\326 "
+	.string	"B\275\037\360\024'\3242\017\2207~\2755+\220;\220t2&L\263s\364\252;/\022e\3350C\206\327\275\235\345\207\264c\3577p*\366f\373\251UVW\006\350\253\301j66\372\237i\343T\264\017\316b\224_\235\230\337})?o\2108\027]\312:\001\367\227YR\364\312\333\352\210H:\312\2169\221m\340\2445\033h/b\352\241\220\36277\024IQ\275W8\267\276\240\177\237^0%\331\360a\301\353{-4\361\3209\273\017\326\322\027\310\034\\5\375\367\244\243\322\212R\033\335\346\324#\034\266I\300\253\034l\220\244\342\016\365\001\345^F\277\250u\244\031y\365'\013\034\323\001\352)\311!\036YA\272\240\270R9|_\035\351/\340\314$eG*\275(\2272\205\242\013'!\302T\n\032\241p\315\\\004J\216Xz\3040_*\231U\370\203#\213L\241\257\270f\324\036E0\235\035\367Dy"
+	.string	"X\305W\216f\220\274r\t:\b\306X\207o\366\244j\303\213b9Y\031FII\250S2w\007`P\0178\367\267\2526\353R\001c\2022\240j\027X\302Ct\026\250Zg5\214\r(@\035\035<\025\013'\2244\250\022<t\224\031\325\342%M5\210W\001\332@\255A\327\254a"
+	.string	"\321W3\214\277I\204\036\017WVA\034\270\247&\316\2542\1777\264L\206\317Z\247\320Jc\203%-\355\3650\367\026\230T\001\313\371R\026\001\235[\353\030\213;16m\"B\376W\031UA.\r\207t*s\320n\261L\001A\251\3736\315\351q\n\t"
+	.ascii	"\306Jmb)\275L\002A\030\330\272\240(%1ik\235\264\311\304\\\222"
+	.ascii	"Wl\310\272\202uZ(ti\023BU\313\235\363\246w\341\231\220'\362l"
+	.ascii	"y\f\245l)\351\0244\227PN\002eaG\276$?G/\324\027\214\350t\023"
+	.ascii	"\255\346A\227\210g\355p\\\334+\350\032%\200\270U\206R\025\277"
+	.ascii	"L\211\177T{\346z\327\222\226\031\321\230\276\275\3758\362R\253"
+	.ascii	"J\340J\240\\\024\263\262\305\003?\312Wc\337\263\022"
+	.string	"\346\374\017h\004\323\217\326\316uO\316\262^X\031S\253A9N\r6\345\003\3262=}\372\2255\222\310'\351\024\363\207\027t\024\214x\rj\370\004\3044g\364L\fj\022A\301<\020=\\V\212U\026Sy\312\020H\207\245j6i\260\336\330\233p\f\0257F\013\264 i\340\332*#d\327S\013\216H[`\330\3232.\202\357\261\307[\226\033e\3002\266\004\\(\246\225\233U\342\302\324\344\324\314\236\253\031\276\272\325\313y\354m\245\230\303\325\331L\255\312,\356<$\316s:\252\001\210{L&\032\251ZTL\031P\266\223\240q\017\350=\232\262an{\320\240\216\311i\331\"n\301\257\032\2354\340\313\025q\020\324\242\365\226i\230\306\223\203\265u\332\034\213GSx\354G\226D\031rz\201\354\362r\202?}\211\035n\212q#D\364g*\360_?>\321\005-Z\366'\377+(\334\372\243\246\263"
+	.string	"\220\2441\317\215S\305\270r\021\231P\200\365\207\250\366\313\364e\026\202\265\255sN,\352\315G\0345\347\332j3\254\334x\356V\230l\376\350\304\335u\276[\313\003\221\346Y\324\013v\273"
+	.string	""
+	.string	"A5\320Q7p\336\347#\333~m\213\232\346\337\276\250\254\253}Q\205n\326E\rB\226\374f\233s\271\201\207@z\216\331\177\202\r\023\002]\017\355\303\251\353\325\034K=\221\271(\003\311\365\374t\336\354[\200`\204h\254Fk\216\027\005\320\200L\303Z\237\"e\305\366\347H%0\026\023\025\213\212\r\030\031\003s"
+	.string	"\365\021\362\222\221\251\256\204\252\303\223q\002d\221Z9B\2479\030\031\r\201:\326\005\223\020ps\177\227\213\033\3509\005\210\020\365{\337\264\367xyH\177\325\021\314\177\021\236\3033\344\021\252\314B\030\207K{\267\030\202\021u\274\020\240E\026R\232|\2764\301\333+Pj\005\240,\274FPO\203\332\375\347k\005\223S\211X\320X\204\371^\276\303%\250\322\211x\200wN)\226\303\322\332:N\300\240\243\313x\203\317X\224\t\342\356\267\\\354MZS\354\016\324\261\026\2433\024\255\304\204\246-\324\037e\235o^t\273\347\304Aq\330\211\304\223\362\225\177\305\035\225\354L\005\003\346\257b\224\262L\370+\314\330\003}1\243\266\2276_\347W\"w.\327f\224\237\201=\002\253\025n\230c\204\273\301.[\331;8\273+\366w\300o\232Fx\245J\226\033\340\322\261\004\312\270\242\213"
+	.ascii	"\3075u\242\323\213%\016\030\332\346\356\227\\\342.\217\fl~\341"
+	.ascii	"\t\253\245\254\262\f\\e\234W\367\034\314a\337\273\274y\246\344"
+	.ascii	"\250U\275\034\325\027l\210L\2330PTV\373i\203/\350J\035\230w\370"
+	.ascii	"Q\375\265\313M\021M\r\232\364UW\350\376\252\023t\362\335\326"
+	.ascii	"\244-\234\303\330\263\213q0\341\354<\030\207\005 \270K\ta\356"
+	.ascii	"}\303 \020\370f\n\2154\240V:\320\235\242fG\322\263"
+	.ascii	"\217\006\261\200\355G\217\221\230t\001"
+	.text
+	.section	.gnu.lto_imuUpdateEulerAngles.110.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\"\006\255\037"
+	.string	"\2467\276I\220\332M:BB\256\fa\024Ww\001\303^f\270\004}1\264j\002W\225\322\310\214AU\037q\2510\221\375\335\233\267&\232G\260\351+\200 \222H N"
+	.string	"\022\023x\017\322\264\315\314\321j\322A5\326\337,!\233H)S\233"
+	.string	"\237"
+	.string	"\267"
+	.ascii	"\267a~\r\363q\314\247a\376\255\3716\346\3170\277\306|\032\363"
+	.ascii	"M\346\227\315\247\314'\231\337\314g\346\257\001\001E2\025Fj\225"
+	.ascii	":\236\3251\352u\343\377~\207\233\305b\177\274\251\276x\324Zm"
+	.ascii	"K\277C\026\277m\351\332\356\373\263\254\326U5oHEm\201\251\265"
+	.ascii	"\362\232\306\372\326,)\331\354\373\232\fjA\241\323\232T[\316"
+	.ascii	"\b\251\226\342\204'\371Sk\205brj\233$@\026\343\nN\370D\002\260"
+	.ascii	"\n\233Z\037\313-\204@f\223A\255\365\034\024\276\330\323\366?"
+	.ascii	"\212\377\005\376rE\333\265\001\227 \311rq@J\342\r&\005\315\310"
+	.ascii	"\246\335_g\221\270RVK`\324\347\236j\375\r\350&\233\307xb\001"
+	.ascii	"\371\370\033os\377J!x\203\335?P\355d`\217\030\351!(\302]#r\242"
+	.ascii	"O\225Z\253\002\255\035\322[pUkU\020d\205,}m,}\211&\336`S\271"
+	.ascii	"\224\367_\345\322m\2372\257\037\037\317E\035R*\217\371\265\200"
+	.ascii	"\3343\376%k\313\370\231o\304\374\"\346\0231\177\210\371B\314"
+	.ascii	"\017b>\020\345\363P\376\216\362w(_\307|\235\346\347H~\016\311"
+	.ascii	"\307i\376\rs@\035T\226\265Y\273WVr\330\2128\031\013\303\205\213"
+	.ascii	"_d.\313Q\017\226\r\271+9\235\353\355q\261)J\234\316\351\306r"
+	.ascii	"Z\3354N\367VT\231[\021\310*1\222\301\350\037\2257\335aH\330\023"
+	.ascii	"\2139\027\2077\375S\330*T\246\330\364M7WM\333\340\272\246\333"
+	.ascii	"x\232\375nM\203\223B\326C0F\3235\257\242XoA\330\255}z\330\372"
+	.ascii	"\257\260O\2344\231i[\267Xn\246{\214'\026\255O\\$Q^\306\270\326"
+	.ascii	";\256\023\207\216\315\376-\\\340\r\322\372\347\251\235^\266\331"
+	.ascii	";\261\323\314h\227\234\270`^\275e\242\244\354\005\333A\373\307"
+	.ascii	"\260\304#\335\325\237!G:p\242\247\3043\001\342\203\222\b\017"
+	.ascii	"\274\021J\034z<$\246&\336\201\335\227H$1\361L,-1\361lZ\277m\031"
+	.ascii	"\032\242\214\375\032h\362@\325\034\217\307/"
+	.string	"\273\346\351\215\252\342\337\016J\271\323\3373\256\264\365\rK]\357\364FM\001\367l\311\370\206> \r\032\224Ku\255+\253\002\343Z\253\023\355\0317j\235o\230\025s\342\327\306\035\274\353]\345R\235^\037\313H\206WV\303\252\"\243\336\023\007\220$\352\242\336\023k\250\203\232\250M\343i%\324B=\324\001\266\036\254\261\213P/\223\032@\r\324AM\305N,\340!\254\331\211\264\325\262[\"H\2300\241\\\032~\250\2018#\021b\214h\024$)J\2061\300\002\021!:n\021\0205c\310\021\233\271\265\031\263\360\235\030+\202ym\t\347\314\\\3153\304\377\257\213\321\n6\275U\265\331\030D\230O\332\016\n\224eF\021E\320\314\340\303\373\b\r\322m<3\350\322\355IFb\363\304\302\304\361\266^\200\202H\301\237\331!\304\335\344Mo\263\370\032\221\326\220X\203\367\360\360P\332\"\037\243\250#\031\002\351\037"
+	.ascii	"\267\207CQ#6\374\337\332\355\377\230Sn\246\213\317\243wg\242"
+	.ascii	"sy\326)\344\306J^\346w\305\272#\344\354\b\177\316]7\372\361\256"
+	.ascii	"\356Q\321%\277C7\313\274\214N\227\330\36710(D\"2\002\351NoEG"
+	.ascii	"\335\235Q\224\205\372\361\267\340\3521r\\,\221\317\306\236`9"
+	.ascii	"!2\246\255\341m\247\313\272dB\3570\261\n\001\227\323\017#{\201"
+	.ascii	"^\372\305\321\216A\241\233\342@5"
+	.text
+	.section	.gnu.lto_imuCalculateAccelerometerWeight.111.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`K\f\005@"
+	.string	"jpH\030>@\346Q\007\207Ya\303Y$\275\007$V\217#G\335\352\273\372\230\307-q\265\306\207\250"
+	.string	"}s\205z\034q\007\364~\376\036\201~E\037\337\341\201p=0\020\264\345\261f\204\354-SJ)z\001P\001r\001zqz\017\363\220\201t\035n=+\320"
+	.string	"r\232\271\367\0169\331x|\330\313\366\274k\027\366\334\230\271j\325\253\256\370\336y\270\355\364\035 \215\307\007\324\363\2565\244i\332\235\244{\237YoO`\227sN\323\221r7\251\213\023\330jW\026\273\026S\273\026\002l\225\033\n\204y\330jW\2218<\354j\3261\264\357\332\365<EH\340\350%)\025\271\335p\323\361\220k\372\206\355"
+	.string	"\313\324\200s\3208\275\037\300V-s\222;M\257\3516=\307C.:9\206\002\313\324\n,\027\231\321\263q\207M\020\342\031\200\233\206\004N\227\030R5ALT\312#\001l\225KQ\221\371\311P\342\331\363j\231\320\247g\346\252U\266\300\205\246\330\336qA8xo\036Jv\367\236e\261\025\260\325.\323f\222\314P\373\274\242\345\007\035\203\326F\322\275w\213\330Ok\253\266\007\254\255\276\025\376\266\317f\353\311nbZ\032\n\203\300\337\252\332\367$\367\317\313\366\261\325\255\031D\327,\353&85\2473\375\274\332\326\234\275$U\213\002\247\006\305\207\266\2507\007\322\023\022.\314'.t\342\301V:\033H\247\027H\325\330\026\300\2515\361\037\223^-qi\211sh\256Z"
+	.ascii	"\367\336\246\246\020\373 \255i\346\326\213\222\376\246k\307\023"
+	.ascii	"5\033D\327T\322\376\363\272\367\2623\233k\315N\315\334Z\314,"
+	.ascii	"\210yx\025Q\237\326t\035\364\023\251\357\273\276\347\032\230"
+	.ascii	"(\222\034\357\274\206\372\264\254\216\372\r\206\316\234\322^"
+	.ascii	"\033\224\373\036G\275\227\322\367\332\332\b\337o\260:\352#|["
+	.ascii	"9\371\244]\337rM\204z\377\256\3776Kg\177\277\277\232h\tg\346"
+	.ascii	"\323\020\035\210\241V\025\230i4 0\005W\356\275\023\244\375\307"
+	.ascii	"\006\267\226V9\f\351\315D\256\255\366[a\271S\372\224\227\360"
+	.ascii	"\246\377\367\336\262\347+\fM\327\026L\233\343\361I\241\314\354"
+	.ascii	"T-\327\024\246(}\217\237\"='5\272\276\307\3744\363wc\356\276"
+	.ascii	"O\2059B\227u\346\202\320|\232\265\254s\226u\306j\274\346+\353"
+	.ascii	"\\\264\316\016\254s\003\353l\325v\315U\035\327\315\240\357\232"
+	.ascii	"\251\254\363\002\353L\264\316\t\272\256\031\201u\236\352g\263"
+	.ascii	"T\277i\216\202\262\316\006\254s\201\237\363\323\352L\300:\017"
+	.ascii	"\260\316\002~\316\001\254\263\323\317\271\351\347\314\324r\315"
+	.ascii	"K?\347\341\352,\\\235\203\2533Pu\376\251\316\253\352\254\252"
+	.ascii	"\316\326:\277uv\353\334\022\232\r"
+	.string	"!'\22472?\350y\221L+\335<\365\356\255\371t\343u\333u\337u\327u\277\351~v\3135\220\271\273\302\024\271OGy\330%\006\217o\017\033>A\216\274\365\005\3111k\262L\362\2147\263\352{\316\024\264/\343\245\350#\252\357\273&\022\235\370\314\0326x3\251\236x\366e\314\235\247\233N\013\375L\325&\3519\370\005O|\365\221\325[\375\202_\3718\370\020\264\245\325K\310\372\342;\370\017\264tb=\326\027\337&\362\340gn\346J\254g\320\340\033|\326{\237%\234\031\177\360\033d\017\203\350\251\210V\373\032\274S\2418\345\236\026\312%\221\352\351 \230>&n\216n\235\256t\002\353\312\275\312frS\352=\022%N\234X[\355<MT\322\351.\022u$\275\276'\234\303#d\330*V\340/\3051\247\350H*\200\367\236M\340~\324\220X\270x\361\342\373N\2418\341\273q+\352\337{\025"
+	.string	"m\\\327\3775\202\261~\r4y\3163lJ\237v\360\335\232%\3615/\360\335\330W\005ouhPu\352\323\270\215\253\3721\326\030\262m\\\355\253\337hl}\250\021\031\271\265\360\327\321\233y\\[\265o"
+	.string	"\013\233G\031\365\223/oR\243\251o5\366\367n\316\317{\357j-\324/\t\023\374CZ\203\347\321&\322\004\337l\232\316\024e\202/\366YJ\0226\333\020|\3275Q\331n\232\020\374T\233%\234\3313\264\331\317\356UR\375\037H\264\354\322qZE\323v\347Z\030e\"U\337\215\203\206>\302\373\210\244\310\257:b`=\214\"\2168\2207N\034\311\214cK\\Ck\fI\366u\344\261%\206\f\013C~M\361h"
+	.string	"2\216cG\262\033`\035\310\220cP\017t\3040\302Pu\200\3650\332\034'\2162v\220\201\211\3210\212\370\37226\211\001u\3508\212\215\031\217#\004\034\307\220b4>\034\311\214&`\034U|}\031\t\360\321(C\002\205\343\f\243\226\023\n\031\316_Z;\302\300\266\310j\320"
+	.string	"\2731cK\f\314\030\266\3655\246cK\013\212\2218\216c[dH\344\330\326\360\251\354\247Re\331<\262\004\341\255,\233r\230\302\370\024\001\273PKq=Q\371f<\365R\317\365\317\267\2043\233\353\276\"\375\"\365^\375l\253'm\222W\326\364n\\\325\266\206\317\231S*\360\006\276\227pO_\340\243\002-\365\b\374\2233\n\201\277P("
+	.string	"!)\223\037\021;&\023\204\357g\226\017\260\222\304\342\315\204\360\366\262}\031\027]\353\257\276\352\231\223[\222o\336\314\001\337M\246,\277\214\233\220\264\251\365\315G\300k\005x\001\001\234Q>\351\3257\336\021>#S2L\247\220\234\376\352?\316\022\256\351\235\036\201\235\245\036\323\017\277\351\243\332,\273\004\237\351\245\022\241\365\375\360\033\255O\351S_\342J\204O\001K\264\373Ht\357\343\226{K\222:\370cI/\276\346\315\340\037\300\022\247\214N\252\372\266\253r\006O\365]\307\217$\307"
+	.string	"\275\210\033I\202\341\326\022&9\306\233\031\200\362\250Q$\346\034s\210fDD\222\024$\031\016\220\002\221\2512n\021p-T\250\206$I\251\322f\201\222&\345\r7+D\313\303[\342\273\035=r\204\373\364}`Q|H\030\224}\310\325\371\364(\250\260s\336\206\343b\203\376$6\030\025\220\3751\231\335\233tQ\232\353\302\024\266\224\347j\207\326\022\016i@\034\310\b\213\201\"\220\365\233C\221R\240\322a\354\006k\033\t\364H\314\360D\332/C\243\221'P\325T\201\332PD\2756\367\344\216\034\232\375\3620\345t\350\260+\374\303\033\265D?gY\346:-:\232\235\270W\006L\273\314&\245t\357\027Z[I\366j;A\265d\360\304\203\357\3616\262b9k?d\263b\325p\303\013\235\201+C\323`\235\3352\002n\372\347\021\306\313P#\233\251\311`8\241\314\005\026\006\\{\013,\343\272."
+	.ascii	"\"i\3028\317\312\013d|&C\214\234-\023\334>\353\245\247w\204$"
+	.ascii	"\220\"}\007B\254\275\003P\215\002\3542X*L2\231+\314&zY\244UB"
+	.ascii	"\263\247e\367\306\246\357T\206\2244)\255\b\026\340k\336\031\016"
+	.ascii	"\261@TP\371\202\321j\313P\300'\226\013\210\007\235\b\025\234"
+	.ascii	"\007\361\004\356\017\355\321\230\372\246\371\343\315\220P\241"
+	.ascii	">q r@c\272P\022\322\233\373x\377\033\320.\f\257\0229\247:\240"
+	.ascii	"(n@g\206Hb\214\373\240`_\231X#\017\366{\221|f\204\357g|t\245"
+	.ascii	"5'\323\250\025\035\2223\210\370\374\330d\343\267\261\337\364"
+	.ascii	"\310n*\022U\236y\357\230\f\342\305\r\227\005y"
+	.ascii	"\332\035E\340F\202R\251(n\021\301\372;\312%H\360\275\300\235"
+	.ascii	"R\206\031\277\206\003\206\345_\237\324v\231\351\332Dy\001\375"
+	.ascii	"\376\203+\373f\240tEH\013n\367\203\220~)\206\n"
+	.text
+	.section	.gnu.lto_imuCalculateEstimatedAttitude.112.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\273\016=K"
+	.ascii	"Z\2018\034T@\022\346\244\003\371\034z\207)\363\300\230Y\342\f"
+	.ascii	"\204p\327\235\201\354\330iD\304\2629\360\350O\224\224ZJ\235)"
+	.ascii	"\367&I\315\332\211\"W)\226:\272\343s\376\204\335\001\301<\261"
+	.ascii	"\351\231\241.Q\362\233W_\2017w\244\334s\267\373\377f\215X\"M"
+	.ascii	"\312$\003\256\001\215"
+	.string	"\001\256\001K.u\315<[r+?\330/\366K\371\307\376\262\237\273\037*\376\354\317\366j\333\033\272\262\242\204\3254\305K\213\020\264\312\020TtfcW?<m\267\267I\017by\254\272\216\266\333\373\331\302\260E\341b\345Uk\005\002\204\335\336\017I\273\275\233\375\035\376\344P\336\303}8\331\2177\333\236\220\223)K\257\302J\002\027c1y\240\017e{<\333\210k \244\215)\345\352T\3556\242\233\227\r\034\264IQ:\261\210I\037zSH\211\237\335GI/6B\256\212\345\214]\272j}\252`\355E(\216\207\022rU\354]\306eW\004\303\237]\260\022z\230\276*\027\017k\352\253\322@o\016\021\371\031J \375\327R\317\357\253:\351\332\246\304\274\264\324\372\005tsa\2407w\205d\3709\357\336\353:\244o\262\307\335\325*\304\333\224Z\253\001\353\203\336\3549\316y3w\233\363\346\246\273I\354"
+	.string	"\251?\004\214E\206P\264\324Z\203\032\311\323\363\354\350\344\340\334\330\324\320\314\310\304\300\274\364x;Tw\232\271\346t\257\233\261#B\375\316s\303wl\270\201u\226<G\311\022\306I\362\033\256$l\303U\005\006\256y\3414[/\360\314V\232\026\313\304\230Y1\f"
+	.string	"/\305\367\220OE\324\016"
+	.ascii	"\223\247*\346\355\201\305\357\250r=L\236V`T7\303H\nV\327!\237"
+	.ascii	"\246\2566\344\363\310'\026\204l\242Q\317\365\324Z{P@\270s?I\263"
+	.ascii	"&b\240\230r8NJ\2107;7A\005\231u3j\255\313D\250\024\276(\276\373"
+	.ascii	"\260\335\215\332\205\241 _Hzf\337H\322\354\233\267\251\273\265"
+	.ascii	"E\375X\021\241\002\357hlXG\354|\372.\b\251\236\224phge\371\036"
+	.ascii	"\211'\241$\301\004\023\2347\005pc\"&Lj\354:\256\200n\310.\310"
+	.ascii	"\005B\007\033\264t\235\265@W\321H\027C\306!}\372V\336\003\344"
+	.ascii	"\270\n|Z\367\244\354\n\366o\257\366\013\021Ji)\341\316\316Z\316"
+	.ascii	"\001\235\271\030\213\303c\027p\025\335\264\353;s\235\301\314"
+	.ascii	"}gw\256?\234\n\362r\367X^\204o\317\265\026\350\340\023u\2347"
+	.ascii	"\273s\336\246\200\274\\\016\223z\222\342\246\204c\353'e\027\013"
+	.ascii	"\243\2048\356.\007\360\262\273X\002\220T\220?{`\t\025~\312e\\"
+	.ascii	"\0019\3564;\353\r\003X\024*\271\316b;\327\360\356\005\030\360"
+	.ascii	"\211\334G\273\n\366\357\327\332\222\234\322\235\265W:\337\374"
+	.ascii	"\304\023#\230x\313\3120z\337\271{\304\203O|\353\272\224]L\375"
+	.ascii	"[\016#\222T\302U\216\333\375\nrg\355>W\373\310\356y\213P^\006"
+	.ascii	"P\336\030(\357\002\347\205\201\362*\200\362\276@y]\034\354;\364"
+	.ascii	"&\377\001@\267\362\365\351\361\262\350\361\256\340\361\252\270"
+	.ascii	"\224o\212\217\225}yx\274;\347\3259o\016\217\027\347\2747<^\233"
+	.ascii	"\363\326\360xix\2743;^\231\035o\f\217\027f\307\373\302\343\355"
+	.ascii	"\355xy<\336\335\216\027=\257n\307{\232\274&\312\233Cy\333\344"
+	.ascii	"e\223\367\016\360\220=i\343\301\310B\027\361U\235\002\334;\333"
+	.ascii	"w\030\223\260\035E7\361\313\257<\346W~\265\363\264\214>\f\217"
+	.ascii	"=\240\276\331\321#\214\\\303\343\356W\316\363\267\307h\246\341"
+	.ascii	"\311[\356\276s\201\216\301-\244T:\026\350\025[Si\347\225-\221"
+	.ascii	"A\374C\206\304\265\241\235w\244B\265(\257\224K\324\266%\262r"
+	.ascii	"\334\346\264\025\027mN\234\316a*.\222\026\217V\225b\235\314m"
+	.ascii	"\005\376\242\2357qn\206X\312\246o\f\340\250\264x(n*\244XEZDl"
+	.ascii	"\372P\336\316jzw\205\030j\217[\365\036R\026\226\350\346\211p"
+	.ascii	"4]\223\334\002\330)-\022\275\330M[\340!)V\013\026\302(\244Y)"
+	.ascii	"\222t\213OL\267\316\2334M\264u\006\344%/\2548\205\247_\206\242"
+	.ascii	"9nS\364\f\231\316\332\261\363Z[\332\032\220k\255\277\030\263"
+	.ascii	"\323\210\265\241q\032\020'#\314\017\317$I\227\310\364L\177\370"
+	.ascii	"\304y\316\230\226i&\023\342\0204\362\t7b\270\rS'\th\2610\246"
+	.ascii	"c\274}1\223\217\033\023>&\003\360\256{\r\323\273\351\fi\r|\342"
+	.ascii	"\366\b\373\267/\rs\003\377n\024qM\235\020-_\272\210\327\2754"
+	.ascii	"\207w\271q4\255Mu8\227\324\311\311\334\266<\216F\r\007\0348o"
+	.ascii	"\362\372hh\357\232\311\206Ohq\002\355_\331jr\023VU\225p0Z\252"
+	.ascii	"\220x\271\224\203@\005\324/{\017\360W\330\220\265\256\214\345"
+	.ascii	"2\t\246Z\201\001\350\032\250shB&g\353z\007\ta\022\2706\316\304"
+	.ascii	"\r\264\326J\264\207\373\022\021\354\271n.\216\0349\316\233g\267"
+	.ascii	"xk\302bmR*\\\b6r\324\260A\003\307QR\005\036\030\371v;<P\372\201"
+	.ascii	"d\003\351H\204\034GIHJ?|3"
+	.string	"<\214p\330\310Q\343\201\006x\030\341\330q\204\244\224dt\344\003\206\207\221\217\335\221\005>\237\321\316\347\243q\224\244t\356\221\321\216\004\\\034i`\324B\206\202\035\274\276\026J>z\004\205\260\001\217\036\035h\020\344A\017#\037A>\244\244\240\026;\373\343\203#\244\240\020~\374@\n\352}\001\237\253;\254\344\034fl\242\263&(\273\254\274X\240XjX\003vpG\310\325jD\306\305\376$\030/\267\001\3365\241\213\t\313`\fWJ8\031\\\324C\315\323;\275\242Y\364\3178\2064\b\013\267Z\201'.\033\231\311\b\3014H\220\363&\220t\310'n\256V\365\017\345\351\254s\247\217,\347\354{\234714\r\2178\373\036\322 ;\2661\031\254\274\210+\272\t\206\017\341\bA\262-\321\246\306\304[r:\235\305\373\025\314\351#\273$\274a\255\237\312!\030\222\r\2176\214\3440\272\251\206\021)z\207"
+	.ascii	",R\314\225\256\260\244T\302\203A\252\326n\376\353\235Tv\001\211"
+	.ascii	"\f\365\301\336\003\243uz\250\231\f\006\037\200B\352\304'\352"
+	.ascii	"\264\227\320X\225I\246\376\341\334\034\271\002U\024\350W\371"
+	.ascii	"\271\206,\327\202\375\263\351\254]\022\322\354\361\225\217\366"
+	.ascii	"\335\225Rmf\217\277\252\025e\252\025\030@\321\0136r\027\375\302"
+	.ascii	"\005\027U\206\240\"\004\026\250\242>\017\257AXL*\22354E\212O"
+	.ascii	"\241N\006\254\020\361>-\215J\245\370D\006z\315\211\2442\031\354"
+	.ascii	"\337\314\313\331\256\030\225\260\355\326\214c\303c\357Y.\244"
+	.ascii	"d\030%E7\275t\031\263dy\201(\250Q(D\031S\210fDD\202$I\222\016"
+	.ascii	"!\005\004!'-\244\007\021`\251C\314\321L\222\fs\326X\024f\324"
+	.ascii	"\\\363u>\232\306\004S\257\001\344(\357\236];q\200\300\225Qe\354"
+	.ascii	"\264\227v,\"\367\342I\016\220\030\222'\305\231F\221x\r\240\362"
+	.ascii	"vD\337\264I\032\2258plm\230\201\226\264\355\205\262\222IC[\221"
+	.ascii	"D\2141\005\233u`\251 Yk(c\202\341C\204\304{\3558\310&\233\210"
+	.ascii	"\033\371K\214\310~\013\317\212)/Z\025\356e]\243Hbp\334J\337\310"
+	.ascii	"z\033\304bc#\310\327\233*\322\303\311+\242\314\251\206O\333\203"
+	.ascii	"@1\021"
+	.ascii	"\t\317\013+\363\242\202\f\300\370\013\311\336\237nt\245\300\f"
+	.ascii	"\260\2705n\336\333kn(\254\331U\013-\377\2440s\204\351\210\033"
+	.ascii	"\355v\362\036"
+	.string	":\1774\237\224\310\212X\240Z+\322\337MakF\244\035\276'8\370!1z\263\3625(\nm\223m1\356\2103(]\213\253Et\276$7\210\331\314\361yC\363\302\224\3359\356>\321\224\313\210\330P\035{B-\217.\352i\330\223&\323 \242\257r\021\312\214\246\203\322 D%?G\212\242#\263\310\3037 \\V\315g\326\322V\227e\276\207u1;\002\305\312\224\312;\005E6fr\302\255=\2340\277\r\353\322\022<(\332\246l\257\321 \002\320qc\325\333l\031\354\322a\002g\321\264\361\3451\232\336lGn\345\354A\365E\005\001\"\362\260\266\325\227t\316\257\024\340\256,+B\215\255\004>\312\306\242P\353\177\360}\370\267}\222\216\nz\013\322j\b~Mp\233\206R\200\330C\374\301@W\006\373\271\260\376\016\035G\240S\r\2306\202\254\362>.\2674R\214B\203\320:OVF\366\201"
+	.ascii	"\034\243\337o$\270\257_\262\367\033-q\346|\266\331+\320\032+"
+	.ascii	"\022\333\315>_\363\264q\036\244\360p\035\377\332\246\277\224"
+	.ascii	"\005~h77\036\313\f4\212\264L-\366\327n\204\332@\242\241\355\240"
+	.ascii	"\210\330\203+y$'\023Lb\033\022\260V\314(\345&F\231\214T\321\211"
+	.ascii	"3\b\243,[K%\337\027\357%\332\f\022+\331\031\223m39W\327,^\263"
+	.ascii	"\326\343\017"
+	.text
+	.section	.gnu.lto_imuUpdateAccelerometer.113.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`E"
+	.string	"\265\b"
+	.string	"\026P<70\221\322\001"
+	.string	"\3745\"\222\340\"\310 \361W\264\314Py|\307\374P\251\273\214\356W\202\314\006\364\337\306\326J\235=\030\030\bd\234p+\030\305\033\034U\377\311\2262\245+"
+	.string	","
+	.string	","
+	.string	"\251\371\177=\200\353\266CO\307\025\026|/5\002\335\n\016\260D\270\277\236\032\235*\023\340`w\235\\\307qg\267\215`\233\300vK\332\262\237~gT\302\332\350\356\301\262\313\312\301\331\230\ff\304\366\355\237h\366\307\232=s\317\265 \022\224\f\025\233\335\215\032r\355P\003\234U\267\273b\237\213\372\242s]H\221Ye\314Y\346):v\205E\236\273\032|\254ts\256\230|0\232\315\033\333\333RA\354\303\r\026\205&J\244\230r\030\221\036\032\"\004I\241\024E'T\f\201l\212`8\305\224\311t\212\037o\017W[Nxy\260\017CU\320\223\266\004*\037\r"
+	.ascii	"3\241\251/F\326\300]X\026\250\366A\n\210\270\rC(\256\211\037"
+	.ascii	"C \3422\307l\222\006\246\366"
+	.text
+	.section	.gnu.lto_imuCheckVibrationLevels.114.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`I\004\235\027"
+	.string	"&\252\224H\260\230Qc\300VF\f4\305\353\314\t,\007\240\2024\253\226\367]N\243\216\216\336\030\202\317\024c\352\3316+\352 \264\325\204\200o#5gaJ/?\350R\036\365\231\326(\275\023\375L\242\351;I\333M\266\224R\246\024\200"
+	.string	"x"
+	.string	"}"
+	.string	"%\024|\306i\334\356\003\361{t/\342\205\024\224\252{\177\bn]`\274\205\271\213x[\017\023o}\263\245\374\267\342\276HQ\355pX\271\367\312\250\212\337\336\"G\226h+\2357\377\301\223\274\036\321[K'\227b`\030)\3151\306\351(\351\25431J\332M\321\304mQ\210Y\221N\353\201&$H-=]uY\222\"\312\203\237#z\2719Y\017\356\275\236\274\336\321\355\272\355\030\266o\354Z\023v\255\303<\017F\177\002E\216\b9\177\343A\333\310\263="
+	.ascii	"\315\363\f\243\243D\326\021b`\370\203\311\235V\366\217hR(\373"
+	.ascii	"\365\322'\373\276\033f\247]v\272U\247\311:=\332iV\235\026\353"
+	.ascii	"\264\265\323\265N\323:=\351\364\007\274\262\360\350\235\351\352"
+	.ascii	"^\022WX\256\320\002qq\337\017\374\264\377\032\017\332E\263\373"
+	.ascii	"\335\306\355\300!\362I\312I\325\275F\020\306[\013_4\001\242\f"
+	.ascii	"Z+\265\235\340?&\3108\271\3676\360\247\356\203\202\037uk\013"
+	.ascii	"88<*\224V*\366(\242\302M=\207[t\367\342\bLJ\351K\223\"\030\271"
+	.ascii	"ye\373\302yx\312\306\360`\206\361\336\313\340v\322\337x\342;"
+	.ascii	"\223\323\235V\177\013^\223\220R(\223\237\211\2479\301'\272y\305"
+	.ascii	"~\216\353\230\371Q\246\225\363\274[\277\024oO\005\260H\302\315"
+	.ascii	"+\317\f\217\300\350}\207\301M+\277f@;\345\2072B\251\241V\201"
+	.ascii	"F\233\001p9\333\260\240\246\314\231\305\002\004\365\b\331l|j"
+	.ascii	";64\332\354eZL\210\247&\013\342\240S\333\311\221\365\324f<2\332"
+	.ascii	"\017\220,\366b\233O\371#\013\262\331~d\256\337=}\3628\254\"\304"
+	.ascii	"\321\234\207\352\275N\016\016\374\253\200J-W\354K\2040\352\242"
+	.ascii	"b\217]\026r\312\330\242HN\225d\336CD\222\266FJJ\270\221\221\245"
+	.ascii	"Dd\311\274\b\021\221\262,\025o\036\304Z\n\345\035\237\031&\t"
+	.ascii	"L\250AD\305\021\241)\n\222\221\024&i\003\340\002\021\2511\017"
+	.ascii	"\021\0209\204\f\024\334\204\311\021s9sY\235\034\261Df\340\367"
+	.ascii	"\366\026>@{\215\277\331\217\t\034\224x\177\374\325\241\276k\214"
+	.ascii	"\230\243\275\244C\236\342{\330\257\236\3366\216\226/4C]\330\207"
+	.ascii	"\020m\222\363\227\320\024%\350\022%P1\244D\0330\300\002\236Q"
+	.ascii	"S\013\022yRQ\021\370Ne\n\270\344AD\210\347D\262\265\036!\322"
+	.ascii	"5\207P\322\204\205\206\210y\272\304s\024\231\023\365\3500\262"
+	.ascii	"\314\330w\244\bed\273k\n~\324"
+	.text
+	.section	.gnu.lto_imuUpdateAttitude.115.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`k\003\235\027"
+	.string	"\206\352\226E\240ZQ:\260\0371iV5{Y\271\034\262\367X\367\277\375pd/:\204\207\310\031\363\374"
+	.string	"\230\204\232\332\246\227\360\377\2767\374\355o\347\324\363\370z\274x\225\033\376\317\213\327y\206g\202&7?\222M\266L)\177"
+	.string	"y"
+	.string	"\205"
+	.ascii	"Nl`\355n\204Owh}\306B\nS?W\373P\036ew)3N`W\t\013\227]\337\004"
+	.ascii	";h}\332\367\003\342g\353\005\304O\357\3546\367--\254\211\235"
+	.ascii	"\032NsvW&\213|wq\206Rw>\217\206p\310\221\251\261Wtq\212C\214"
+	.ascii	"P"
+	.string	"\215=\036\017C\bX]\344\034HB2\276zG*\005\364h\204\261\335}\323\365F\317H\225G\303\356Z\307\236\216\233\347\266Y\330\006\262%S<\006R\206\362HLTJ\tsB\302\272\354\221*\217\244\304H\203\366\235\3764\303gr\214\027\372\361\323\177!~^6\260\362\301\323\240\205rT\351\323\024,:oV\263l_\221J\"\366\303\225J\366\177\267\353R\376\036Q-\212\3529\325\341T\313P\255\241\372\006\204\340$\341\350=\310\325nR\320\316\236\231QI\376\273\3247\371E\341\352\347\276S\331\375'\343\253c\025\215R#f\372\221\204PT\325j\226\013\350\253\\j\326\332\345}\364\243\356\245\204\317\364i\023\263\031\255\246\037\035\003\360\364e-\025\345\311R(\211d\271(9\370[\0165d\013\n\022?E\271\340\272\273ErH\234\362D\023\360H\353\370\245\372\025\242\215\313\351\307)+\b9\222E~"
+	.string	"\354\321#\261,\260\002\362"
+	.string	"\270\303%\377{\214\247Y\016\245K\252\226\032wx]\216\364\343J\310\230\254%\\\326\316\020\f\2169\332\r\"P\250m4\024?\027l)h>\003\206F\330p7\021D-l:\035\214Z"
+	.string	"\327|`\340n2\"\025A7\026)d-n4\234\254\246\033\222\371\300\234sa\323\311\210r9\235\354\345\333\207+\225\334\002\3069\303\223F\342\327\034h\305F\357/\242\233\tW\223\246\352W\200TP\266\225\201m\t\2472\024\002\f\366n\312\315l\020\260\264\273\026\310\274\f\207\016@@\342\247\202\2459d\344\221\237\02513\201\272\244\355\341\003\030\230\332 B\030I\205\231\nE\250a@\244\224RLM(\243\2408n\240\002\021*\234\007\020`8\0244i\016\204S\323\007\332\341\271\315\343\025\356n\274\031m\327vFHj+\203\234\244\242\006\320\2218\360@c\233i\370Q\036\302Z\212\253\224\266\222t\023\332YP\260\274e\277\352\2007$\025\013y=y\f\0258\013\350\326Q\210Nn\212\017\333\315\236R\347@\253yf\276\243\314\177d."
+	.ascii	"\341jM\230]q\025\252\301i\013\373i?\301\bEb\361H\265\20576\316"
+	.ascii	"'\026\rn\313P\001"
+	.text
+	.section	.gnu.lto_isImuReady.116.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\224"
+	.string	"\235\n"
+	.string	"\246\023IA \3078\035\007o\342IL=\021$\210\031\234\301\235\201S\337\004\323a\325\204o\002\005 F\250\233A\237\262\313\263\215\230YF\370\005F\t\001 "
+	.string	"\320\"\373\225$\214U<\3341\315\262nD\312\224\0027"
+	.string	"6"
+	.string	"6"
+	.string	"\331*\350\337\365\013\221\265`$\303k\b'\3172s\316\216,\321\315 ^\003\024,\220\243\254\301\2442\336u-\221\242*\306b\316i\035I\223{\273m\f\333\017\3661\001\241\256\312~67e[\315\251z\325OPh! \317J0\247)\346`\032\320\b\264l\337v\310\356<A\0212\370rebXa!\001`0g\351m\312\301k\001\252/\313%@\201lU-WN\355/D?\352\036\345$n\370\257`/\001kp\373*\352\345\300Ha\336T\017\332\354\021\022\375\370\2558\2156t\207\232\332\300.\003\336h@\035\216\367\351\340\340xlx\037\234\214\216\267\361\210x\032\007\177 \032\036\357\363}\036\257+\3477e\315\"\256+\361\335\222mn3\242\025\275\313\355I\017D\032\333\264\r\021"
+	.ascii	"M\b\230P\307\323\243\306\020\302\001c\240\252\002\b\3305\204"
+	.ascii	"\322\020\212k\"\034\202\"w\004x#F\020\264\252\311\225\013Y\326"
+	.ascii	"\204\002"
+	.text
+	.section	.gnu.lto_isImuHeadingValid.117.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`r\001\245\r"
+	.string	"\306\031X@0q\222\016\203\030\037\220~ph\036d\236=S\364\303\2017|\255\361\007\277\020=\362\031\253\2555\202z\f\366\013D\334\266\214:i)(\3009qO\b\374\036I\224zXD"
+	.string	"\331{o)S\nH"
+	.string	"C"
+	.string	"C"
+	.string	"N\260@\304\330\267\020$\004J\244pPb\354n\224\2028\366\b\237\323\304\374\330\021\255x"
+	.string	"\265\350h\331c\264\341\360q.\244\2334\f\251\002\264\215\263\354\356M<G4Mf\354\330]gG\323pG\267\235\261}\300\276I"
+	.string	"VN^lR\206cF\277\240\035b!\337\2712\340\260\321\314S\207\315\031\366\226\245~\354\273U\217\355\264\244\351\3504\314\364\313\264\313\264f\372S"
+	.string	"\022\031\264\203V\354\222\204h\254\312S1\302\266\210=\005(\236\202U\037\037\360\017\352a\274o\273\373\364s\3627\340\027t\372P\234\236\205\013\247\356\202\252\371!\367\027LU=\247D\223!\373\333O\\>\310\027\353\371\026\374KU \242$\223\241\347\356fj\f^\003\366\340\b\271T\024\210\204\b\325\004\b\024\205\312\301\205\362\300\\\024G\001[\025\036`(\020\313\302P\323\266w\253\036\247\333x\276\215'D\360\250#\266%\265dT\343\250\222\032H\301\251\221\311\220\024\365\343\377*\273\013\325cr\250\r\374# \300\202\031\231\273\001\317\204\306q\206\222\243\242\260\033-p\005\2137%k\336\214jE`\267Q,8\326\300\217\211v,\263@$O\006\020"
+	.ascii	"\002\366C(\257P\374\304\006\033\231\032\370\204\221\t\357\353"
+	.ascii	"\036(kP\0208\313\235Y\311\\\345\275\355Zz"
+	.text
+	.section	.gnu.lto_calculateCosTiltAngle.118.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\263"
+	.string	"u\n"
+	.string	"V\223E?0\307(\035"
+	.string	"\273g\013\252:yv\301\345\354\321\357\234n\246\2675uD\251G>(\223\322@j\255\021\r\003\353\233\366\226\307q(\f\006F\fPR\0204<K$\211\005#\226\354-eJ\0015"
+	.string	"/"
+	.string	"3"
+	.string	"\316\370/\007\260\331/\350\241t\016-\006B\\\rvW\323|\001{\204W\300\036\365\344\333s\363\037\340\025-\225\002\250T\351\211\231\330]'*5r\353\ra\237\",S~\316\224l:\260\275R\252\211}\270\252\262\237\316\236\306\236\216O\303\247\365\351|\372\b\t.]\352\335\267+\362=X\005\361\300\212}\326\346P1\f8\022UU\250\r\256\320\t\264T\217 \345zM\215\t\270\325)?\333\243\017\360+\333]\t_\300=\017\277{\364\007)\217z\364I\330\3435bA\346lF\236\216&\322\310\350l`h\034\035\013\217\306\001\205\264\r\203?\035\027 M\364\371\200\264\214\267\207\253\252L5&=\031\323\314\364\034\313\353\206 \273\246\207\250\230\236[\005\025"
+	.ascii	"2\241\277(\360\t\r\016\310\013\224h\257\016\361\026\304\214h"
+	.ascii	"L\\\005C#8p@\006\030W+\251\305W\342\270&J\302\304\226\031\221"
+	.ascii	"\270\323\322lx\314\301\001"
+	.text
+	.section	.gnu.lto_vForward.1.146.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 V%\002"
+	.string	"D\003I"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\002#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001?\202\210\200\030\1773\276\0014\275\001\274\001\273\b}{\277\001"
+	.string	"\005"
+	.string	"3\245\"\025\004\216\0342M\035"
+	.ascii	"\034"
+	.text
+	.section	.gnu.lto_vGravity.0.147.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375 V-\002"
+	.string	"d\003I"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"\005\001\006\025\001\002\005\001#\002"
+	.string	""
+	.string	""
+	.string	"?\202\210\200\030\1773\276\0014\275\001\274\001\273\b}{\277\001"
+	.string	"\005"
+	.string	"3E\261\324\"3"
+	.string	"@\346"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_quaternionNormalize.part.0.156.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\257\002\225\022"
+	.string	"V rI\360\260(\035\340Q\210\312\321V\210\221Y\241\272\207\241\034\366\034\005r\215\217\007\365\354m\275\346\265sQ\351\333\336\006\302\324\213\363\255V$\222\233\333\375\303\3420\331e\021V\374)\311\033v\266X!@\207\232\323\324v\223\275S\nY"
+	.string	"`"
+	.string	"Z"
+	.ascii	":n\360\275N\233,\327V3\241(}\236\306\237y\212\330U\310F\004,"
+	.ascii	"mE\007\235\335\322\344\325\244\357\325\345\t\204^\277\017\b\275"
+	.ascii	"\232\264y\274\334\035\251\270d\260\371\331]\220\2228y:=\322O"
+	.ascii	"9}\356\223\345\003\210\317\321\275\217\223\335\365\027\342\256"
+	.ascii	"\267]\262\375\300\246\007\002\337\331\"\217\307\361_T\333\216"
+	.ascii	"(\207\001K\316\370\033\f\302\276\326\363\"c\242\033}\037G\372"
+	.ascii	"7\317Yd\36257\330w\245\006\300\246\342\342\263[\036\027\023\275"
+	.ascii	"\232pJ\366]\370,n\023{\013\357\276\224\232\310\212\216\022>\273"
+	.ascii	"[\362j\007\337\253\001\317\202aS\003\255\334]\004\246[\211\316"
+	.ascii	"\327\334`\272\027\\\276\211W_\026z\025\211\371\231\315 ?\367"
+	.ascii	"s\310\325\350\331Iav~\334\347\004\362o\377l\002\231z\024\306"
+	.ascii	"\276\267\273k:\302>\315\377\217Q\202\231]\017A=VD\215qB\206e"
+	.ascii	"\323\262\2212\346\3460\034\322B\333\022\333\243\275{-\244e\303"
+	.ascii	"\213\214\317\353q\367\354\373\272(bHYw\352\204RZ\220\212p\"\241"
+	.ascii	"Hc\250\002yQ\030]\251V\310\022H+Q\265j\245^\247\221\005\256\304"
+	.ascii	"0\024Q\340Ju\nAT\313\005\222\nX\254\220j\201/Ql\201\242\237\314"
+	.ascii	"(\006:\3419p\204\347\341\261=Il\3616\002\344n\364\354\004\362"
+	.ascii	"\244\355\316Hl\326ix\007\262cw\025\3703\002; \220\002\2311\263"
+	.ascii	"\003\004\002tN\205\021\250\b\024\335\326\020\336\306\360*O\341"
+	.ascii	"\302\270\330\207\300pY\335\006\200\003\304\267A9\f\311lb\\T\346"
+	.ascii	"\317\327\021\356_\2169\022\334\007\240\304\3215.\354\fo\031\252"
+	.ascii	"#\3408\\D+VHZ/1\264\n\322pa\003\356\262X\204L\205\220\216\201"
+	.ascii	"2\374\013V\210v\373b\r\247jg\003\326JM\330\205\341\256\361\245"
+	.ascii	"\205B\274\022\334A\356=\212\340\346\261\351\202\232|\302\303"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_imuUpdateAccelerometer.part.0.187.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"U\b"
+	.string	"bO77Po\322\001\200\315<\331:\313\245k\350\370\211(We*\226\315bd\352@uk(\0178\331\246\205NH\364\233\310\314aDwh\005\032\267\324\301\220\037vo\271S\n\336h\264\3165A\020\234+\342aJ\\\r\235\271\311>S\22316\341\220M\020\206e\323\262\r\037WMf\350>\225\312HIV\325\323=\030\377\373\210\307\377\360G\203\347.}\rs\211\200\3022\202+sBR\021\332\024\025\360\234\017H*2AI\267\252\225\205.PO\326\370\270j\262cD\235\024l\354^\254^\226C\232\200\330\367B\266\345{\233m]\276\263\035\302\360f\247\374\363\330\fJ\304\202\244ew\347\245v|\273\302\270\371\367.\300\225D\327\201R\306\241\301#\300\302\356:@\343\226\267\255`;\301v*\021"
+	.ascii	"j\023\030\017\036\215\031\324C<x\206\001\310\003#\\14L\2609c"
+	.ascii	"\351\fe3o\247\005\340\332\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`V\b\305\035"
+	.string	"\206\357\251Ap,'\035\016\346\360\225l!\370JA\233mH\030\235(\331\336\263D\2137;\214\210\032A\024\211\370\232"
+	.string	"\320SLYDHU\241Q\271-\356\236\261\224\004\252pyG\007\204\361\233Z3b\345\226)\227"
+	.string	"\225"
+	.string	"\232"
+	.string	"\342\031\242wL\205\272\033\020\353D\374\260L<\034\217\330\241\377U\007,\025\2219|\320\206\333\021\371\337\263$\260]\242\325\345\210\025}$\250\216\206>\241\232\241\017T\f\275Z.\034N\325\351\210\026\372\205*\237y\372\035\021\3677\342_\341y(\254\222\t\373D\374_@\302\"\0217B\337\020U;U\b\375@\365\301\353\210\377\357g\343\252\007\317\267\365\343\341`\360=\321\b\370\034q\327\3573\325\t\244\032\201\2544\3152\314\337?\034\256\215\225eY:\350\002\365?"
+	.string	"\024\001\017\363\321o\324\243\377\210G_\322\216~$\255\336$:z\227\344\350m\322\353\205\202\243\367JV\257\025\254^)7z\271J\033\275S\270x\275Qj\364\035mY\226?.\354\252\017i\177\032\327#\376D|[?\035\275\031\337#\376\274-\036\326V\326/\313w\325\003\362=\325\3108\237X\214>#\030\375E/\372\212\\\254)\266\350'\252,\326\210\270bKQE\037Q\212\376\241\032C\321\007t\242?\254&\016&n\211\276\220D\377O5K1#\372~\252\210\307\t\333\300K\327\227\335\310\325\2149\033\271\216Iw\265\314y\302E\fp\273\230\333\324\006l\201\300:r\243R#\027\t.\225\027\330\327\324\310\277\035\031\227\256\255\312\0262\263\221\235\204k@P\351\244\216lK\2676\335\270\206\356n\\\033\312\206\022\230x\317\2151\261\326\371\200\306\275\341\262\231$\220 \320\030wR\321\230"
+	.ascii	"\27256v\220\354h"
+	.string	"<\013\356f\334\023\262\214\237N\022\rpk\nJ\311\230i8%\343[jV\276\2457sc\345\362\257\027\213\257\367H\220\336\023H\177\322\217\016gp6\013\026\260MH\352\330\006\214\322qm\250Fw:e\300x}\215\216g\247\216\027}\232(\306z0\212\327\304)`\253\215U)\340M7\266\t8\303\306*\002~B\223c2\335\315q\223p\027*\307\213\356\346\236\346X\206B\361\006\241~\006\307C\200L$\013\021\216$\373L\032\311?\264\320\t$?\241\024HvJw\311Q\026B2\222k\303\n\344z\201}\311\261@\262U\025\311K]R<,\274\215\254\024\006\334\355\"\263h\320GV\232\024\234\032J\215\254T\350\f\200\222\2501 \245P\254F\222\024$Y\016\320\002\251!\342\034\021\320\240U\004\031\221\210\310\320\310\314\036y\033C\f\3210\003W7>w\267\327yA\307\244\006\263\0256\027\372,"
+	.string	"gl\315\375s)\005C\207o\020\256\274\240\274\346\213\2416@\353i\321\214\205iPF\257\362\375Q7&?\346\374\025]\350\211z\006\020g\301]aY\210\361\374\013\201\215\230\036Gj!\310\016\337\264\024R#\326Y_t~.\020\222"
+	.string	"q\346{\230\203^f\3747\342\277\021\371\317\330o\216~\036\230\311'\177>\034\331\325\310\262 O\325\305\251\324\026;\207H\265]DWG\305E\314"
+	.ascii	"/\2133\257y\232\r\350\353\216\353\017\005\371\224*YO\327hQ\006"
+	.ascii	"XP\r\361X\360O\366\321\256\024`\217\327\363\034OS\360\\\214\002"
+	.ascii	"a\255\303Y\346\310x\030\205)\354\255\022;\017}\222\367\\X7\020"
+	.ascii	"\300\302\253\254\270\037\320GU\342<\246?%\222G\032\325\350\341"
+	.ascii	"T\001"
+	.text
+	.section	.gnu.lto_.refs.2620a55cd7894ccc,"e",@progbits
+	.string	"(\265/\375`\203\001\275\r"
+	.string	"\226\342a? \2154\351\001\020\242\322\231(\204\r;\214\007\301\001\020'"
+	.string	"\243\220\316@Fl\301"
+	.string	"\300"
+	.string	"\300"
+	.string	"\300\262\224a\357\277\217\356\265|\346'\2444\205)Z\303\225\341\357oF\266\375\377?\355\266e\nK"
+	.string	"V"
+	.string	"Q"
+	.ascii	"c\334[\252\016\271Gw\246z\020\357\317\360~\301{\021\n\017\231"
+	.ascii	"\3763\275gz\355}\001\3519\321[0_\244\357\260!\373$\331E\262%"
+	.ascii	"\256\217\301u\005\256'p=\304u\217\353\233\353\035\3279\256S\371"
+	.string	"Q~%\037shzd\020('&\024\254\207&H\210pu\b\302\203\353!\007\327\343\b\353q$q\034\271\300[\202D\n\312\325{b\"\342\372Z\260\276\025\022o\003\013\374\223\304\377\300a\363k\330<Hb\005\307\037\251{\244\377\220\372&\275\207\3469\371\035\371Y\325\255\252S\270\327\270\317T\rh-@\372mz\264\351\226M;\2401\253c\274\277\254^\361\236\302\352\324\373g\365\313\373\212\325\361\315\021\235\033\r\320G\311\360S&\374\020\036\242\277\204D\343\277\240\361\237\352=X\337\252\327\252\357d<G\306g\330c`=#\215Q\235H\023\211C\001{\360\203\017\017@'\b\036ao\221>\245?\24050\035\303\364\013L\007\220\341\232\t\2476>\332:\264m\3402G\353\231\326-\264Ni\375\342q\307]I$\3201q@G@\341\037\331\267\354Z\366N\366\213\363\026X\257\330\350R\326+\232\036\024"
+	.ascii	"\3157b$\210b\020\n\310\002\220\2018\224`<\003\202\020 \212(1"
+	.ascii	"\214\n\001qA\024\210\013\302\003W\007\300\020\212Q\245\226\332"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_.decls.2620a55cd7894ccc,"e",@progbits
+	.ascii	"(\265/\375`bc\375\226\001:\251\326\224R\0200e\3514\006\372{6"
+	.ascii	"\016\371\016\353\303\013+\224\353[^Q+\355\345\327q\214\227Y\003"
+	.ascii	"\371\332\237\265\\\225\255\350\354\212\320m\032\024\023\001r"
+	.ascii	"\327\372\312\304\247g\351\356g\021\260\243\323\327\267\367\334"
+	.ascii	"Gt\317\301c\256\"|\356\211\303J\344\336[J)S1\b\037\t\247\tW\207"
+	.ascii	"\02727\213\226\272.W\313\306}=\300\254\314r\357\244\t\270\273"
+	.ascii	"\345R\3318\254\020\234\2541s\311\\17\314\035s\313\3348\253\274"
+	.ascii	"p\027\314\2756~\023p\227\313\325\372YJ\356*\224m\327!\363\366"
+	.ascii	"Nj$\326\325SP~\346\323\317w\3729\215~\206\323\317n\372Y\251\237"
+	.ascii	"\305\364\325l\207\363\331K\377\327\355\002\240d\216\251\037m"
+	.ascii	"!2\324I\303D\206\345N\321\303s\243q3S\223\235\353te\334\245\237"
+	.ascii	"\337\336]{\310\275\223vw\356\222\215SSavg\271w\362:\335)\367"
+	.ascii	"\311z\371iJ\356\243\007|5\252\362\254\335\235b\2276\017\237U"
+	.ascii	"I\200\tj\271\367\266l\246\3306o\303gU\024<\311E\331M\261u,\337"
+	.ascii	"\3171\271\2518\350\253Q\225\247v\253\\*\327\312e\273k\367\312"
+	.ascii	"\225b\225w\312E\373M\273\312;\345\316\270g\307\020\364jT\345"
+	.ascii	"\355\275\361\214d\261\332\220\317\244\355p\236\316r8\237{\350"
+	.ascii	"\344\007]\247\214\023s\363\363\r\375\023\034\240\270e\227\306"
+	.ascii	"\245\3729\006m&\271\"\310\275\223\277U\277\225Rv\257n\026N\272"
+	.ascii	"\221\340Edy\313n\fW\013'\335\264\214\264!6\312\177\235n\331\025"
+	.ascii	"\273L\360Y\225\266\302\004\366_\263\033\345B\271O.\331ur\233"
+	.ascii	"X\345-\273[\277P7\352\037\222{7}]#5\322|\2308r\225|\360T\365"
+	.ascii	"\233!\247\265\334;\371\023\277\225Rv}\\!6\016+\271m\374\244}"
+	.ascii	"\3710\313\333;)B\204\bLCm\r_P\276K\254\334\034\275\250\233\217"
+	.ascii	"\313\350;\366\214\266\225\001/\345\030\323v\363q\027\375_%IV"
+	.ascii	"\274\351\321v3\022\236*SQ\316n>^\323\310\033\326S7c\273\271\371"
+	.ascii	"\030\212>fR\344\202\021\321F\346xl\351*BDNm\323\r\371%r7g\335"
+	.ascii	"\261\213\336\216\033\344\007_\216\267\260\233\217\237\364\255"
+	.ascii	"\362\002\271?\330\304\242\256\334|\177\374\034\240\260|>{\233"
+	.ascii	"\355\275-\360\321\023C\346\306\315\227s\273\376\377~\322@i\323"
+	.ascii	"r\273.\327\324\231\335u\363\177\253\274\\w+\271?\374\346\320"
+	.ascii	"\331)\273\371\327\216\376\235\243\357\216\313\303*5\270=\222"
+	.ascii	"@\267\210\235*i7\377\332\351[\rN\334\327g58\177\323X]\033\027"
+	.ascii	"\313\2426\266\234e\271\371\336\2708\254\022\304\315q\313\345"
+	.ascii	"\352\270\271\224\334\311\2757\220\305\373b\262\2729\310v8\177"
+	.ascii	"\311h\022\354mA\234\266\257\317\2028\177\275\350\022\266\303"
+	.ascii	"yZ\016\347\335l\207\363J\335)\253\274\340\3268\007(\216\217h"
+	.ascii	"@\031\3564\271\263w\363o\233\276\275\340\264}\366\202\3637\251"
+	.ascii	"\177\315\364M\332\016g\b\"\372\267Kc`9\234\277X\272\204\345p"
+	.ascii	"\332\276\273\2552\304=\376\327\224\334\312\275\223@\2774pz\250"
+	.ascii	"\335\374K\245oC\234@}}}}6\304\371\273\244-\337\265{\326\316-"
+	.ascii	"\237\325;\007(\356\323\264\315\366NZ\276\274\367\222\265\031"
+	.ascii	"\374X\233\201\311\305\310R\332\231o\371\364-\236\316\373\255"
+	.ascii	"\033\373\306\3221\351\324\250#w\263\235\363!\303\030+Sqn\276"
+	.ascii	"\225\323\267Q\360\334 \341\330;\017\354jT\345\311\261q\254\322"
+	.ascii	"\302Q\373\240\233\250\256\252\364-\231\276\r\3236i;\234\037,"
+	.ascii	"\207\363I\313\341\274%\242\037W\267&\303W_\022\355\3465\277U"
+	.ascii	"c\351\254\227\237\333\032\033c7\337-\333\341,@\2329\234E\013"
+	.ascii	"\312\017\020@[\262\260\234\240\221\233\263\343Hv\263=\223l\332"
+	.ascii	"{\203\260`l\234t\334|\253\245o\305\3744\005\355M\344\311\322"
+	.ascii	"\226\261[\254\027\033\247\226\2278Y\232\261qVi\313\200\340\371"
+	.ascii	"B\222\243\315\231o\315\276\020\001\363E\306\216\261pVi\305\344"
+	.ascii	"\344O\210\261a\336\366\323\224\334`!\230\315\270!\342\203\b\237"
+	.ascii	"#I1x:\337n}\022\350\213@\377\266\313\255\227\337j\261O\336v\267"
+	.ascii	"\366n\332{{\270e\356\264\362n\266\\L\334v\341pVa%\267\332\336"
+	.ascii	"\033\b\273uy\342\273\371Z\016\347A\240}l\026+\371H\031W\2277"
+	.ascii	"\267\353\206\t\216\225\2156\231\202#\356\346\337\266\375\266"
+	.ascii	"\314\232Y,\030Jjk\253\355\235\324\360\203,\362\003\315\315\226"
+	.ascii	"-ye\357\375\301t\322\205\306\353\346\267\240\177\002m\307o\253"
+	.ascii	"\3305\253f\257X\245\265\362[)v\312sr\357+f\311\"O\250\274\355"
+	.ascii	"\347\267\367\2270\267\275\367m\224\337\304o\241\330(\326\212"
+	.ascii	"={\233\215S\333Ng!\360I\331\365\345\355\275E|\020!B\004\317Q"
+	.ascii	"\213Y\033\236\374\020\264\335\266\303\031d9\234>B\267i\337pf"
+	.ascii	"\243x\217\276\3267\365\257\306\300v8\263\345p>\316v8\237\264"
+	.ascii	"\035Nm9\234\377\367n\221l\002\004\212\267\245];\270\2673\331"
+	.ascii	"\313\321\377D\202U\360\371O!?n\021\002|\002\317\177\372\300:"
+	.ascii	"\227\300\f\030A\007M\371\351\377^\006~\034\001\030\317\340?\251"
+	.ascii	"4\270!\354\017\361\307z\331\351\307\035\374\237\313M\377]X\220"
+	.ascii	"\231~\314\2003\004\377-\222M\354\375\367\237'\376;\202-W\375"
+	.ascii	"o1/Q\311\307\037\267\375\330"
+	.string	"-\357\377^\261}\277\315\362\337\250\\\202\037w\311$\270N\362\b>`\331\256\214,\202\037\007a8\334\342\307e\376\034\202\037\243\371\255\315 \370/\367!\307\370\263\322\321d\027\376\267\270\212\377\344\360\343\"9\351\307J2\021G\311C4\237\313\005\270X\256X\023\376w\271k\177\026j wG|\3507\255~k3\322\177\317\330\243\337~\300\2125\262\303\337\006\377\313\224[\370\361\224\374\001\r\376\341\002\037\300o\016\311\301?\263p\327\344\r\330\025\006\276\362:\313\032\270-\362\006\024Z\310\031\310\025\370\363\t\231\204\377X\034\320\366\275\026\037\341\317lh\360\177\242\370*\001\377\035a=|\202\337|\301K\f\b\306\377b\272r\007\377[`\024g\013\370\352q\237\273#0\002N\025~\374\346\277+\362\211\314\301\177\213d\023X\347\022\377%@&\361\343 \234\301\313\240\371\034\266\221\207~,'o\360\017\026\b\375\371"
+	.string	"\357\340?5\360[\245\337\376\344\002\374\026\206q\205\341\277N\231"
+	.string	"y"
+	.ascii	"n\267\300\305\377\003\374\303\177J\340\177\227\253\304J\213\026"
+	.ascii	"\317\360\233\030\370\255\007~\313\201\337j\340\267\030\370\355"
+	.ascii	"\006~\333\201\337\022\375\230\205\377\372?\251\374x\351\307P"
+	.ascii	"?\226\361c\247\0373\375\370\351\3073\376\353\2263\370q\322\217"
+	.ascii	"\217?\336\031\203\377@?\352A\310\t\027+\013\340jU\250\274E\016"
+	.ascii	"\200\027\210\337$\341\266\311\025\374O\313 \3528\374&\227\377"
+	.ascii	"j\377\253\374\247\362\337\n\333\333nV\317o\236\370\017\207\271"
+	.ascii	"2\207\377c\376\213\371\037\346q\177\336\360\377L\326p\3214\374"
+	.ascii	"\246\323\237{\376\214\376\031\377\270\357\307{?\236\363\343\345"
+	.ascii	"\217\327\374x\356\307e~\f\367c/?~\373\261\225\037S\371q\362\307"
+	.ascii	"b?\006\373q\327\217u\374\370\352\307S?\246\361c\340\217/\360"
+	.ascii	"c\025~|\302\217#\360c\022~,\302\217\035\360c\006\374\030\304"
+	.ascii	"\217A\3701\212\037\223\370\361\006?F\300\217\r\360\343\f~"
+	.ascii	"\\\301\217'\370\361\206\037\007\375\370\367c\374\337\275\377"
+	.ascii	"\306\371\357\213\377\326\375\327\356\277g\376\013\367\337-\377"
+	.ascii	"u\373/\226\377^\371\357\332\177\325\376\213\366\337\262\377*"
+	.ascii	"\371/\330\177\205\374\327\353\277Y\377\325\340\277R\377\245\361"
+	.ascii	"[\037\377\215\372\257\214\377:\375\227\351\277\307\377\226\340"
+	.ascii	"?\335\1774\377\317\374o\373\317\366\337\021\374\027\306o\355"
+	.ascii	"\177\213\377m\341\277G\377m\361_\022\376\357\375\326\303\377"
+	.ascii	"\026\377\035\361_\004\3747\304\177\013\360\337\373_\373_\205"
+	.ascii	"\337\272\3756\004\277\005\301oc\374\226\370[\026~\233\376\366"
+	.ascii	"\204\337\266\370-\213\377k\376\317\375\227\373\377\366\337\355"
+	.ascii	"?\226\377,\376\257\377\341\376\007\240\257\257\257\357\367A\341"
+	.ascii	"\007\262\277\t62\274\214q\213\272\371@[\332tZ\203*\303u\363\201"
+	.ascii	"\246\264\311\304\323f\005\313\352\346\377\320\321\346\361G\315"
+	.ascii	"W\225(7\377\207\215\316}=g\244\234m\335\374\2379=bJ\3509\357"
+	.ascii	"\331N\236\235\313AU\333\253\b2\303\227\224\215\270\233\363^\346"
+	.ascii	"\323\253\223E\3478Y\216U\036.\317y\022\350g\215\0247Jn\376O\025"
+	.ascii	"}{\270\263\004\366p\347\210\033B\317v\317xvv\356w\334KXBcguz"
+	.ascii	"y@@x\230}\335\234\227\371\356\215\233\037%\032\005W\035\033+"
+	.ascii	"\2277V\320\336C"
+	.string	"\330 \211\350\377\370\320(\354\b\331&6\273\251\311tV\356\001LP{\337@\300\333\331\215\021\377\311\241O\210\021\312o9\313\263\226\3470Zr\032\273\367\336X\373x\207\"\313L\235^\336\306\252\n\361\347\271\3474@n\302\260\300\335\234\321\274\355G\211\223)`7g9\033dI+\316\315\371\f\017\233Y\031!7g2\331\314\r/q\226fr\334\322\025>\033\366L\222on\214\231U\3462\007\221!\315\235\02467\3471\226/\317\301\231\203rs\026c\236\001y;ss\206\003\302rFW\344\346\313\371\3311,M\326n~\376\222\301\374?\323H\025)x7\377gJ?{\371\311\202D\226\2719w\321O?O\032\350#F\234<qy\356\"\346\201\023\252\251K\354\346\274\305\3043\027:\2537\0347\233\226\303\371\fx\372\277\375\375\317\275T\265\367\266a&\267\033\223\317\371\333[\323\332\020\177\006\213\355"
+	.string	"\366\002\220\222\233\211\314\217\275\267\215\363\263C,\311\225\233\377c\260\315\270*(e\327\361\001]VM]:\240\224]\373\330t\344\250\241jw\035\241\224{khj:\252\330\262\202R.m\rP\312m\265\235\316X\331\235\354:\356\246\255\255a7\355\245\255\334\262\302"
+	.string	"\252\251\313\nJ\271d\245\001J\331e\265\225];h7-UE5\355*\r[\331u\267\225[VAP\312-+(eW\231\035\022\345&\316\325\230\037B\232\3307\250\246]c\212\307RUP\034Trk\323\355m\325\236v\325\216\333{"
+	.ascii	"{\363\330\252\242[\322a\335\230\342j0]Y\332\262\311\2757\210"
+	.ascii	")&\257\255\335\024w\264;\016Jlko1\246\243=\265\367\336\035\034"
+	.ascii	"\223q{\210\215;\376\340\261\245\236\366\256`'\367\236\332\373"
+	.ascii	"h"
+	.string	"w\334\336\373\270\367F\253x$\367\216!\b\n95\2657\326\207\251\315\343\370\366\264\367U\253s\263\202Rzm\231x\233\242Dn\031\311\243\205\222\332\332\310M\327U\245\225\307\263-\265\367\266p4\322\352\n\357\346g@\323#\314\204\236\253<c\261R\354\024\253\314U\254\333\206%\213%\227\346d\271\253\260F\230f\340\224 \2719_\311l\317V\362Z\206%z\204\030\241g#\317O\224\331H\246\362;\356\245\254\020L\356\352\364\362vU\325\210)@\273O\306\234\233\237\301J\337\232\235=AB1\223\222\225\031\315*sZN\346\264\034\345T\203DM\230\237\3342\212\210\316\367\301\323\367I\243\357\023\247\3573F\347&\271,\233\375\277\036\274\032j\366n\276\017\027\375\354\344\377\257\005\2212Vn\316\231I&\373\177=5\212\260\301r\363}\330\364\363\222\377?\355f\347\020\2739\217\351'\237(\032\374\304\354\324"
+	.string	"r\344y\354\317a\031\231\305<"
+	.ascii	"\202>;tn\316I\262\222g\261\214dg\261\016\266\366^\312b@|{/\001"
+	.ascii	"Y\233\201\265\031d'^akg\276\217\023}:\333\341\314`9\234V\213"
+	.ascii	"\211\347#=d\272,\243\334|\0370\375[\345\333r\2213\344\336;\310"
+	.ascii	"\247.\016\233\332\315\367\t\242\377L\344pI\2704q\r\371\372a\n"
+	.ascii	"\323\223\022\344\371\353\277NY\b\336zsj\334|\267\355p\3420\023"
+	.ascii	"\317A\002\300\306\345\r\210\226\017\2246L\304n\316\312C\242\370"
+	.ascii	"\255\024\031w\220ON\372\252\264rT\316a\343\276\362\034\276\245"
+	.ascii	"\t\035{\310\275\223Y+C]\252\037\274\267\226\035d\346\221{\344"
+	.ascii	"\256\354\225}d\256\274\225w\344\037V\231\265r\fN\027\353g)h7"
+	.ascii	"1A!\255\224\254\225\233\274\242\226Y+c]&=T\\ab\262\035\0342\346"
+	.ascii	"&\310\367\311\241\357\363\244\337\303\247\337\363F\3438\217\314"
+	.ascii	"\351q\271\371=`4\232le\343\276\362\235\266\345\215l\303*\363"
+	.ascii	"U\236\221\257n\233\233\365c\356\275\204\005\331\343\343\207U"
+	.ascii	"\324\231\253p\036\0307+7\277'J\025\344\0322\327\310TY\312*\363"
+	.ascii	"T\246\221\247v\216:\226\331 3\347,\353\334\351\374\036'}\236"
+	.ascii	"7\372<j\364y\304\350\363(\365y\304\364y\274\364yn\350?3i\320"
+	.ascii	"\244\305\212Y^\312G\324\212n\215\233\274q\237U\346#\346;\266"
+	.ascii	"\203\357\344#\316\202\265\3308\265\354\244n\231\217w\006\336"
+	.ascii	"C\331\254\302\304\210@\315\360\020+;\263\371\305r8\377[j=6Q\234"
+	.ascii	"\306\334\374\237\032m\342\r\276\343\022b\226g\3550\035\214w%"
+	.ascii	"\017\307\301s0\034\\\007\313\261JL\007\2539\336\202\271`:\330"
+	.ascii	"\013Fc\327p\t1\313\273G\256\022\0365VB\314\362\354\350\340.\227"
+	.ascii	"\n\035\202D\210Y\036\246\203\323`7T\220\b1\303iB\246t\371\311"
+	.ascii	"\377\215Y&\261\243\fr\363\177j\372\2774l\327\203e\215\230\337"
+	.ascii	"\021\334\006\263\341\311B\207\247\006\327\035\263\301\3102nt"
+	.ascii	"n\276\034\274\346\377\317\207\f\222\006\327\315\230\356LT\025"
+	.ascii	"6L\207\325d\2602&\217\316\315\377\001\321\377m\351\237\300h\360"
+	.ascii	"\031\313\367D\016\317Y%F\363\214\3468\316\306\251\345$U\264\231"
+	.ascii	"0:O\316\374\337\r\375\023q\370\313eb\343\324T\344\251-\315\340"
+	.ascii	"2V\211\343\3420\030L\246\207\312\235\020\263\274\337\225\263"
+	.ascii	"\243\2253\3431y*\f\354\356\346\35398\253\304b\236\261\030\034"
+	.ascii	"\306\256\2512\343F\036\n\346\215\231\274\234\257\345\364u\026"
+	.ascii	"}\275\246\257\317\364u\022\235\325,\207\023k\331\272>n|O9n\276"
+	.ascii	".\242\177\374\206\331\354~P\311\270\371\326\fK\n\337\300\201"
+	.ascii	"\265\274N:.\026\220\251%\256\202\325p\033^\303X\260\033\236\202"
+	.ascii	"\225\230\n\226\202\257`+V\211\331\360\3311\032Nc\303E\360\021"
+	.ascii	"|V\245\327\322\354`6\214\004\227\3318,Sno\271\367\316A\265\304"
+	.ascii	"l\367\016\266\201\223n\021p\342q\231\330\360\225\224\0300\033"
+	.ascii	"\336\201\207\340\263\252\b\314A-u\374\327)\353f\001\231\201d"
+	.ascii	"\303D\356 1\033\216\341f\375,%\367\221\002UzK\310>\210@\245\322"
+	.ascii	"\320\306*\3108\316v8C\260\034\316\353,}\033El\353-!\033[\242"
+	.ascii	"`\342\246\267\204lI\234\336\02222\006$\365\226\2205"
+	.ascii	"\301Np\022G\301O0\024lf\225\270\354\307a\030y\213\267\222*\275"
+	.ascii	"%d\270\f'q\300VR\004\017\217-\226\025\224\257k\350\353\243>:"
+	.ascii	"G\037m\243\217\312\351\243a\364Q7}tM\177`;\234\250\345pb#\267"
+	.ascii	"\006\335\21457\037}\202\301\3201}\364\310\227\317T\030\037\336"
+	.ascii	"\315G\267\364\177\034\004\377\300@\254\022\013\301]^c\220\\x"
+	.ascii	"\353\247)h7y\301!\261\020\314\003o\3754%\267\325\002\222zK\310"
+	.ascii	"\366\336\037D\210\020a\255\004\001\213\243\363Q\031\372g\035"
+	.ascii	"\375S\216\306=\260\226U\236\013\3661\304\313q\310\315?\3554\f"
+	.ascii	"{\357m\317\345D\317\345\374\271F\377\234\323?\307\350\237]\364"
+	.ascii	"\3175\375\363\211\376\331D\377\034\323_\332\016\347O\244\266"
+	.ascii	"\262dR\322,o\376\tD\337FY\032\342\324\003\271\217E\240\3020\023"
+	.ascii	"n\272T8\211D\251x\341(\374\264ci\003G\335\276}\274\353`\314\r"
+	.ascii	"oI\036\236\3023p\r\\\205\2450\025\246a\2258\n\313\370\265s\253"
+	.ascii	"~\223{7\3419Q\262,\203\362\317&}3O\337\204\243o\332\351\233k"
+	.ascii	"\364\0079}\023N\207\260\035\316\233Z\364M,\232\347\362\201@\231"
+	.ascii	"\274\371\b\262\307\207\226u\361R\323\313\223JS\226\271\371'"
+	.string	"\276\324\231s\351\3348W\316\255c\2257\357\336\375\342]8O\270\360-\367\336yw\213\035/zH\263\233w\273X\344\222\275\245\210\237^2\314\213O\266[\266\3039\201\345p\336,\323\377]\272\351YC\302\301r3\232[\367\263\024\264\367\021\266\345\233kg\225\327\215\233\333\346f\331\270\257\354$\312r\357-\002\204\210\274\226\347\025\346\3147\231\350_\035i\254 \357\232\313\346\322Y\345\255\373\2152w\261\256 \367\336uW\315\305\262q_\017\310\262\266,B\001\262\247\363\315$\372&\230\276\371\245or\351\377\312\225\311lMbH;\003\367\333Qf\205\274\371\267\352\215\315\227\253\365c\356\2755\006\0314tT\024-Px\344\201\331\263[\3160\243I49]\313p:\307,\332\246r\200\027\024\036d7\013\327^\362DD\017\271\321\307k\246\337*\365\361\034\263AI&\271#\310\037+prZn\276^\002"
+	.ascii	"\225&\301e\347h\237\235s\354\203\336O\322\234,\207p\331Z\336"
+	.ascii	"\251\243I\340\310;\252\227\207\356\235if5\252X\210e\365\330["
+	.ascii	"\252c\022\027Vg\215.a\003\357h\034<t\216\005Z\344\272\310\276"
+	.ascii	"\264-\277\344\034\235\323fq\330\365x\202S\301\027M\"\r\233\243"
+	.ascii	"vl\320%\227\2320d=qm\276\352\2749\272$\273c\005\307\315\250\033"
+	.ascii	"\024\212\317\025W^[\233\n\252h\022I\324\034]\243\306\264iPjT"
+	.ascii	"\345\235\321\3532\207\256\202(\232\204\0233G\345\314\240s\030"
+	.ascii	"HB\204\307O\255\t\033/(\232\243s\031\344H\211\203\262\364\377"
+	.ascii	"w\222\241\342\323;\303D\017\235\031s\264\314\230\023\\ab\310"
+	.ascii	"\200\322\346\004qC&\210\036\352\002\346(\034\230\263m\0020H\275"
+	.ascii	"%z-\214\216;a*\270\241\207\244\240Z\216rA\265\240^>\3341\205"
+	.ascii	"\315\001\242\201\245\013\034\264\313Q/@o\334\204\264\331\202"
+	.ascii	"F\0175\021\312o(\026\f\205\276\235T\264\034Ib\351\226\200\210"
+	.ascii	"\241o\250[\235\254-;7\243mE@\250l\271\371 \222\372(\233\020\222"
+	.ascii	"*G\255TY\353)\242\347\244dML\013QA;\252DC\251`\340\252\213\354"
+	.ascii	"\347N\217:\275)G\251d.\272,!7\243R\322@\b\321\033\324Yr\224l"
+	.ascii	"\t\232\264h\233*\001Vj\302\220\355\215\025\342\332\2511\205\241"
+	.ascii	"Q\216&\333\230\314P\222\344f\264\f\205rF\f[\037\024\364\t\022"
+	.ascii	"#5tL\221S\346\206\t5\313\311kW\343\r\337\315\250\223&Lt\350\r"
+	.ascii	"\300\0349\212<\202\212a!}\230\300t\265)9*\326\266$\315\356\355"
+	.ascii	"f4\t\2220\020Rz\203\260\037G\203\374@\301\270\\a'UPhE\216\202"
+	.ascii	"\275\215gJ\027\266:7\243D\324\250\305p\347ft\310\3334\331\232"
+	.ascii	".;7\243_\250\020  \266\036\362\022\372\217f\035\355\221\205v"
+	.ascii	"\335\245Mn\254\255\343\335\007Z\366\202\270\345m(\254\020>f<"
+	.ascii	"z\334\351:\312\305\001\212\267\3411t\354\304\271\371\250\017"
+	.ascii	"t\213\215\311\232\233\377AM\037\325R\202$\353\313\315\277\037"
+	.ascii	"\244h\3403f\212\030\226\233\321\035Gy\374\277_\026- ]7\377\303"
+	.ascii	"\023\375\2431\374?t-\315\016\344\315\377@\246\377!\211&\301\207"
+	.ascii	"\343\250\016\034\350\225\rJ2\315\251!\367\306\nqz\231\341\025"
+	.ascii	"\311!D\223p\023\312o?Ju\324\352\267J\224\n\275\262h\233\312\002"
+	.ascii	"/p\272\310\362\366\306\n\301\303\206N\032\336\315?j\343\350\025"
+	.ascii	"Z\365\341\250\205\234\204\216N\241S\346\322\207\240\275\275\242"
+	.ascii	"\270\355*\254\021FNl|7\337\003\236\026\302\232\373\351\346B\335"
+	.ascii	"(\253<\347P\032&\230\366\322\021\f\232 \331 \007\207"
+	.string	"\327\315\350\214{\005\316\235\231\233\357aN\337\232\2759\357\326\340\235K\013\230\240J0\243[\3129\351,\031\003\347\\\376\0345\354\375\243\f\222\t\215B\241\320'\264\t\225a\225\250\323\231\207:\235q\234\316:\350\321\306a\005\355&,v\313\275\367\214\256\270\036?\371\315\355,`\202*\001\n\233%\272\321%\253D\217j\350\361\324;\373z\330\320\356T\201\020\221\001\017\r\335\2163\377g\337y\347JR\b\234\233O;(\226\0168\247\233\357AL\377\347\236U\236|r\310\336\366\354\274\020\361B\242\357\241\210\276\007\255s\216\236[\366 s\363=`\351{\270\241\357\201J\337\203\f}\017K\372?\357\316\245\251\f\023\207\314\222j\214\024\323\315\247\340\216>\333\234v@M\330\216N'\233\373\225\325\005\316\315?\353\200\252\350\366\226\233\177\032YQ%\271\371\244\323O\024\334i`\222\031\261\322E\315O\272\f<\222\374"
+	.string	"r\363\231\306\304O5f\026\034W\221\233{,\207\363\024\220\321BZB\266\211=\303\374<s\2069\345B`m\033BM\336x\214\300r\204\bIss\262\311F\016\033S7\237eN3?ZjH9\271\371g\334\327\031#c7_{.\3479\346'\231\377\327\243\244\302Uw\363)"
+	.ascii	"\243\177\212\311ddb\356\334\374\023\256\207\317\006\335\031\005"
+	.ascii	"V4hA\013\t\215\233O\001\022]\342\213\313\t\346\364\302\345\374"
+	.ascii	"\262ao\355\215D\305\214aYb4Rn\322|\301*R\325e\207.!\366\366S"
+	.ascii	"\313\333\331\006\306\252N\217\254\t\227\336\235,\024D\351\022"
+	.ascii	"\311+?\261\\9\333\344\234^z\216d\220?n>\333\220(\361\222b\273"
+	.ascii	"\243K\310\t\375\254r\252\235k\231N\320>\263\255\225\230\222\276"
+	.ascii	"\345\256J\216x\2074\372\035\256\350\022W\322~JI;\251\330\275"
+	.ascii	"\243\234\205pg\3077\345'\025,\267\273\037t\366z\\me\007'Z\237"
+	.ascii	"\t\375<\263\312\363,\177\375\327\264\227\302\220{c\215\310N\260"
+	.ascii	"\210A\273\371\035\304\264f\023\372\031\345\217r\251,\332\246"
+	.ascii	"\342\221\261T\027'\333y\223f\310\315\357P\245K\360\225\375|R"
+	.ascii	"f\202\235ef*\270#\306\306\315?\315&\310\323\037\2649\231\374"
+	.ascii	"lr29\307\364\0362\303V\223f\016Y\030\r\302\021\311O%H\316\261"
+	.ascii	"1\\?7\254\25107\377\247\330\31717\2778lW\340\230\\Suh\266$1\323"
+	.ascii	"#\216B?\303\224g\230)U\302"
+	.string	"\326\276\302"
+	.string	"\311Y\217W\025\220$B4\bM\212\3744R\304\004[\301\346H\333\353\002\363\241A\310!\344\347\020!g\224\006\270\352\364\310\256\0316^\312|M\340\244A\250\023\362\372\t\344\3642\301\364\376\240\305*\3579K\345\315?\177\344\351\021A\204~\362\370\311\305c\354\316\307\271uj\235=8\2209s\2341\234Yg\016\023\354\334&\266t\2341\234Y\247\016\023\314\356\2529'\223;\254\020#$\277\320\2608P\321\3470D#@N\350\347\215[\345y\303\234\361\001m\037Q\266\267016k\017o\312\315\347"
+	.string	"D\203\230#\364\323\306\255\362\264aB\225\260\265\257BpY\352-\311\333\033k\304\317l\312\312\316\315\347\240\245G\250\021\372I\343g\025\007(\254\362\244a\371J\200:\342\225hb\225\034q\3268\251\316\251S\212\003\22461D\350t\372)\343\267\312\323\351\214z\320\336\233io\255\036\347\325\331\t\3653\312\3155S\242\231:\237\352t\007S\204l\023k\332\371\271t2\331\271\007D\201\260\343\033\274\350s\237\307\276;hz\304\233\320\31597\367.\336\205c\225\346\034\363i\303\222\256\363\202\262\254c\352\231y&\235\rH\364\b$B7\337\334\214c\276\261sG\023\317\204s\267\334\240\245\217\006\215iw&\267MnQU\231mn\332i\344\231)\0317_\016Z\345\214K\333\315!"
+	.string	"\2313\331\230j\346\314\272\337\321\311\307\232\233u?G\250\320\354\334l\322\021\361\244D\245\3310C_\303\033=b\207\320\31517\317\214y\333\357\270\277`\225\030{\333#\3148\323\214Y\306$\243!N\217H\023\272\331\345&\334\265\2726\254\322\354b6u\300\004\t^\223\246\207\345f\023\214\031\346\213\027\r^\364\t-Ynn\311b\202\241\270\2733\265h@\323#\356\b\335t\373M7s\311\304\336KX\005h\202\244N/\357n\313L\035$z\003\237\320M,X\356R\016J6\001\341\201\334\373\313\210\037#q\250\236\334|\rA\264\206 B7\257(\315+w\251\204\255%\033\005@\202G\204G\336\336_Fdp\022\346$u\363\203\364t\2105\241\233k\267Js\315\334\030j\213"
+	.ascii	"R5\252\310\366\306\032\301B\215\316j\216\346\340\210\362\346"
+	.ascii	"\024\245\251\006\002\035\253:=*7\325\336f\251\324\231\321\"%"
+	.ascii	"\250\213~\300\324\223\233Q\236\230h@^R3n\344\235\335Dc\003\263"
+	.ascii	"\265n6\223&\027\237\22485n\276\234l\246\215\221\266$\224):\001"
+	.ascii	"r\306n2\0313\313\356\336L'7\313\256\\\026\227\246\233\315&X\211"
+	.ascii	"cL\217\233M\262\337Y\231\2542,d\034\260\343\022\"z\304\232\320"
+	.ascii	"\315#7\225(\315#vM\tP[G\007L\316\352\364\362\316\037tx<\271\331"
+	.ascii	"Db&1\221fX\020\020\r\002\2369\344f\021s\210\t\326A\331\335\345"
+	.ascii	"\334\0043\317\210\035Y#\022$\245\027@\003\310M!@L\257\240\315"
+	.ascii	"4\347\006i\006\301\323\013\370\262\343f\217\035\246\327\335"
+	.string	"\332{#\3216 V\226]7\275\270~\244\270\214\215\335l\3720\271z\332\332\206\3700\271\314-\237)t\256\216@Yk\2128\335lje3OkcZx\300i\006D1k\334\254\252af\375\366\336\307\344\246\332\300\004\345i\211\211u3\313\324A\327\206\354\272\331\304a\352\260YJ\352\344\350\310\221\353\\\201\3250\345\344\330\\7\2337\314\2538\264\262\266\233/\307\274\372\377\273KWE\340n\376\315+\323\206\020='-\226mk\347xcZ\335\326@\342\004w\363M\252\003\251\351dr\357\r\364\243'GE\347f\223\206\251\374\302\013s\363\201\310\264\031\205&\245\266\340n>P\022m\006E\342\nLW\004S\022PXU\022\224\204A\n\214\303`J\302jLW\250\306\025\224\204A\240\023\212\206\"\030 U\022\006;\254@\245\"b\021\005\243\221XL\261\201X\\\361\241\247\250H\004\030?\025)\005\252"
+	.string	"\264\006\207+\254\301\241\t\303 V\327\324H\351\003Cb\n\016Ej1uA\205\t\212\324b\252\344\202\n\032\324UEJ\022\022S\030M \026c\030\201P\3274\005b1\206\021"
+	.string	"D\250\240\303\252\222"
+	.string	"\004\246@\306a\032,JS \272(\n\372\001\002\323\037\032\343hEJ\325\022\214&\004\251\200\002\t\306\240\206\037\r\025\005\223\212\220\210%P\260\022\031Y\244=\034\f\3235\365\351 \006RR\222\b@/\206\301\264\270\032\207D \317\013\325h\230\246\240\"\245@#\022R\n4\256A\026H(\r\2156\200Ai\030D\332\240\003\017\210<\370"
+	.string	"\006\022j\221\022\022p\030$Q4*\221 \001T\223\214\030\f_\240)\206\356\013\304\342\321J\034\242/R\025)\277X\213.\030M#\021\310\363\243!\343\321\232\n+\200\201XLJJ\211\206A#O\214$b\212\237\365GCIJ\304\242\021QZL\223H\024"
+	.ascii	"8TZ\3213|qM#\221Q\222\317J44J2\207FIX\005A\320\230\215F\265X"
+	.ascii	"T\224\2421\222\210\300\\\\\223\360}b\024Wc\320HM\201hC\221jT"
+	.ascii	"\312O\327\264hU\215j\221\310()\003\221\272\246HIB\325\305\252"
+	.ascii	"\032\325\024\214\222@\254HA\027Fb\n`\207\242 RZ\001\r1\212R5"
+	.ascii	"\005%\241\t\306 \217\007\016\206\\\254\300\302\004\243\0221\b"
+	.ascii	"C-&"
+	.string	"\201\320`\376h\310H\211\005\265\210D\021RP\211\005\265\210\310\302H\211\005\265\350gDRa\250\023\250@\013@\365(\205\2220\350!F\021\021\002D\027Gk1\035\201\350\"F\021\021\002\302\"\361\205q\230\026](\t\203\027L\260\006\207&(\t\203\250\n`pU\207F)\213\025\204ZT\362Q\201\303\023Vc\252N`\025\241\310\030\004A\301\005F\251\020\237E\301a\260\250\203\bE\027l81\244\256\2510\270\032GX_\004\213*\210\305\030$\300\230 \350h-\022[\030\245,\212\324\025\250\026\213\304\02406p(1\264\026\323\244\241\n2`$\246\370\321+(\t\203\023\b\325\325\030C\205 \236\037\r\001\211\212$\200/\214F)\322\n\243aPXL{\200\300\024\257GFA\325\002EuU\205\304\242\252\256)\222\022\020)M\241$\f\n@\005A\020)\025\026\211-\2000\200B\nBbq\005"
+	.string	"\326\224E1\303\020,\256)\013uUJ\022~\20014\001\204JA\f\244\244\340\212\244\304b\303\272\256*\222\321P\204\242\212\2444\202Z\244\264\006\3275\355\260\256+ \200\244\002\201\"lX\211\214+\250\302\340\252W@\240H-*\031S\225\205\2220\330A\233\030**\246/\024\211+`\360h\025\004A\375\325\230\2768\341T\327\264(II\205\024J\020!\306\220x\224\262P\022\0069\034\030,\252C\325H\277\003\0176\360\340\003\030\320\177\240\200\022\n(q\376\003\005\2300\241"
+	.string	"\017L\350{`\002\227\030\212\261\006a\244E\022`\360\f\325`\221\330s\340\372\302E\3215\022\231X\223z\3245]\215f\212\024n\221\212\016\211\301\025\250\032\321\033\215,\020\t\323\342jL_\fe(\246G\300\\TW\244\340\nuMSX\211\305\fkJDza\002\r\203H@\265\210\310(\025\002\031\245\302\237ZL_(*\246GDF\251\320g]\211^\250E ~4\004"
+	.ascii	"%\"\2430Xta\004\006\205\351"
+	.ascii	"0\206\212\016\304\242\232\001\243T\210\252F%\"\342Jd\224\ny\326"
+	.ascii	"\24008\001U\030t\301B\020)Ma\224\n= !\021\213@AFU-\032\251*\202"
+	.ascii	"@U\305\013i\214\237\037\r]`$2J\205\346\372B\232\302\317(e\221"
+	.ascii	"\215R\026F\251P\027\245j1\217\240\032\225z~4dL\223\204D\340J"
+	.ascii	"tbMY$\275\320B\273\022S@J\207Eu\205A\r**\246D\b\f\211\250Q*\324"
+	.ascii	"F\251\360'\205\n\021\214R\341i$J\327T\305\220\030\\\225\220\210"
+	.ascii	"*\030\223\2144\244k\252\342\005\265\2051=\342YS\225\205\265\230"
+	.ascii	"\252%\030\223\214|Fh\201\244V\200G\005\222Z\201\237Q\312b\004"
+	.ascii	"\024F\320\2520\350\242(\210\224\302\370\031\215R\244\027\246"
+	.ascii	"J\264\302\230d\344\243&\305p\001C\360\005\272\246*\b\225\206"
+	.ascii	"\347\372\243!c\222\021\tbp\202\025)\305F\" q\002\306$\243\fk"
+	.ascii	"\212\204\321!\021\t\037!!\341tMU\030\245BT\305\b-\220T\030g\221"
+	.ascii	"\252&\251\320\243\032\213J\304\024EC%b\321\310\347(I\3050\222"
+	.ascii	"T\234D,:\312+\317\217\206Tap\005a\f\"!\005\205\247\221H\025\006"
+	.ascii	"]\250kZD\324SL\325\030\371h\035\022\205f\214\264\b\033\213J\304"
+	.ascii	"#\323\250\256J"
+	.string	"\303\240\0205\026\r\211@\325\210\252\302\340\232Uap\035*\245\240$\fnx!-b$$b1\037\001\327`\222\371B\032\003\033U%\244\024\306\371\243\017F\"\243\340\213!1\205\2220\330\223\004\004\246D\301$\243TH\024l\201H\b,\342Q\221\214\206)\021\022R*4\366\250kZ\004R\223\210HF\"\265H\034\032\005\211\200\3004\310H\004\004\246\346\372\243!b1\206\221\n#X,2\200J44\n\"\245D?C\243 \222\b@`\252W#\221\n\f\366\300PU\030\225XX\203C\023\206+\326\3400x\026W\024\200C\245\025E\251\232\002\020(\302\004F\"\030\252\n 0\325\303\025E\251Z$\301\004\021\020\230\236+\221\007&\326a\020}!M!\205\n\021\316\225\350\203u\030TBU\343\nD\027*(\t\203?0\324\"\254\n\203k\022\2218\201U5*\246.\200\300T\303\213\024*D"
+	.string	"\002S\324\005\025T\026\202\025"
+	.string	"\002\323\337J\304\301\211u\030T\322\353P\211\230\")\210\224\002\bL}\220\210D\b\020\231EjRR\020)\2051\370[\211\210\200\300tM\213*\222\n\004\246$\214E\242q\250\032\007"
+	.string	"C*\304\303\240\020\033U\241Z\\aP5\t0\244\302\274\022\235\250@\322\213\236\037\r\025\211+P\205\001"
+	.string	"\030l\f\013\002\013\303\256D\024Hz\361\363\243\241!18,\252k\252\344\002\211!Q($\002\005pb\222Z$\261\022\211E\022='\\\270W\323\"\024\tP_\244C@\007\001\204\024\030\254\320\202\004\r\034R\022\006I\254GFA\244\027$\206\301TH\002X4\222\030\362P\302\205k\302\205\313\201\013\367\377O\006\235%M\306\270\374\236\366\242\264\334\354\375\234\316\261\247\247\257\247\233\223\023`1\251\361c\312ix\312\340\370\300\372-\231jG\364\r\303\265\2151\371ms\006\332C/\216\255\017\365b\337\340M\255\335)\353\222,\263\304\216\t\005\207\352N\336\315\267J\315w\266A"
+	.ascii	"O\n\310\036:\007D\267\005D\352\346\004\320\321z\272"
+	.string	"\016\235\363\313\335T\250\254-\363\330\350\004\254\201\243\347h9p\3166:o:\016\234\3769\227\200\311x\273\003\353\2213W\306\315R\214\207\316\210\232%o\320\244\215\363V\347\313\215\271\321\314\212\300\331\335\245*n\342h\2641\233D\344\005A\323lP*J\226\310\372n\366\300\r\215\256\323i\320\3505(\256\350\256\327\330\255\261i\273Y\2531\257l$\341\256\314\215\351\0048\221\321r:N\223\321g\354\256\272+\321w\274\021\342\327f\256\317\370D\2359C\226\361\241\177=\306\254\253\272\352\362\022\203\306d\f\212\314\315\016x\373\242\341t\230/`\032\314\005R\272\0018\364\233\366\242\265\3507\335\305V\205yZ\222\307\345\272\013\023\220\26487\353-\246\016}\346\315\235^\0268\272\001`\252h7m\245\212n\023\203\304r\335\3063&\345x\344f\315fr\241Y\330\034\245n\326W\262\031\315'F\b\327\232\032\355"
+	.ascii	"\034gZM\247\3513M\345wT\323S\256\251\370\330I\322#\354f-\305"
+	.ascii	"\344\222\222\003v\263Vf3w\215\232\270*\2641\232\001MMtR\2275"
+	.ascii	"\321Q~\307\275\341\240\\Gy2\244-\356f\375\304\324\261V\005i\343"
+	.ascii	"fmf^\231j\\\356\372\234\260i\275D3\271&\273&\273\232\f\367\365"
+	.ascii	"\235O\320P9\307L\257\036\250>\032=\3042\025\237\255)VtJ\320\345"
+	.ascii	"\0318{s:\tX\225\254//$g\324\017\254\275*H)\037\0351\310\340\013"
+	.ascii	"C\257x\252\364\335\2659\202\316\271R\276\270\311\273\271\001"
+	.ascii	"f_\332"
+	.string	"\210&\362\245\301~\307\275\361\336ZU\220\272\3105\030\217\2273(V\327C\234\350 I%\0315i\350n\276\005Kt\322\314\207\212\252\310\326\217'\257\266\245\260\233\223=nZUnt\231Kg\0205o\244h\256S\256\216\235!4n\376\365V\026\216\342\366d\345\346\020\306\360\320>\264\026\017\263\356nm\355\215D\2638M-u\217.\375\353\035\246\235\033\276\251\276\233\031\240\247q\350\030\264\016\215Cg\375\252\260\\\223\247%dX\327Y\033+MN\016\013\246\364\257o\240]xf\210\214\335\354\246O\213\232\233\037\220\324S\332\206\246\322S\332\312\204c\006\372t\325\265U\017\331\226\f\244\256\001\200=-\004DG]\007\206\216\250\003RsRh4NQ\034\351\224B\206f\2466\315\030\223\025@@@4 \023\314\246a\353\001\023\300\304K\254da\036&\225c\204\314\210\210\210PYH\373\033\213\330\230\376J"
+	.string	"Dqs\2000\346<\003\016d7h?@,)\367iRL\255\366\006\265Zg\345\032*2\fZ<\334\216\356\243h\006=\235\246Q\264"
+	.string	"\353\231\266W\036\333f\306_\314\371\362\245\004\222\231Y\2706R\003\341\305\317\346\326\272\271i\322pk\002\343N\007\266=L\303*o\2607.OU\341\370\340-\002"
+	.string	"\216\322\313\236\021\341S\240\002M\320\354\375}\357"
+	.string	"[\365\364\237  \357<$\274XQ\312\374o\017\312\254\201\224[C\017\202t"
+	.ascii	"n\034\373\262%\375\037\340\016\315\224\"\222|F\261\236\206wO"
+	.ascii	"v\034\275{_\216\210\372WG\006\332\231\241\270\023G\362\211\240"
+	.ascii	"\323\213/\235\201\220c0\335\372>\0309\b\302\300\221\221\321\346"
+	.ascii	"\225f\034\371^|\261\0033@\215\237:\261\332\022\304\004J\360N"
+	.ascii	"LF\261\317\013\224\333}\001N\200\020\025sy\032V\353\263\202E"
+	.ascii	"\006\300)\231\320\247\033\214M\376\351\n\311\343\222\256\356"
+	.ascii	"0'\351\005q\241\354TI\372\340_\204P\254\332}\244\2744\026N\264"
+	.ascii	"\0259\231wG\007\235VF\305\270\264\203nc\241\322g\305z\200\342"
+	.ascii	"~P\215\354\316\237\223\247M.\245d\b\333}.\354\333\216w!\007f"
+	.ascii	"\273\251.\3066c\340\217]d\302\353\300\266O\256\346o\013r\264"
+	.ascii	"\276\365\007B\335l\213S\007\306wm\013\365\225ak\343\271p(\177"
+	.ascii	"L\242\201$\366\315(v\214A\003\252\311\305\352\201\2425\007\344"
+	.ascii	"f!\374\212\317Z\241\001JY"
+	.ascii	"30\214^I\367\220\326\374\234O\017bS\204s\335\350\rh\275\003_"
+	.ascii	"G\300\346\252\213uRt\334!\205(\0304\003UA\tL\257\b\f]\274\030"
+	.ascii	"\303:\275nP\276<I\031P\357\267\323\003J*\264\355\205\\\244,4"
+	.ascii	"\230\302XYh\314Hr\277\331\343\022b\234=\351\303-\037S\346 -\f"
+	.ascii	"-V\373O\267\234s\337\t\r\304"
+	.string	"\345_\337D\253\242\230\333\234CL\004\022\270\0048A\002\270\241B1\357g\303\220\374\200\270\371#\327\037g\\\363\270\252\267\313\027\352\033E\327\374\361\335\362\264l\200\021D\374\26390\3744p\335\212\177\330\036\274L\003\370\030\330\354\334&`\274sS\334a\241\242\3208\221\244\321E\265\017]z\023\331\257\205\002<\227\231\320\345/\330\373N\231Z\327\222\207\1770u\355\207\367std~\303\3046\241o/O\213%@'[\332Y\247\006\365\020\277\006!\023\002\257\r\264!\025\261\n\342e\345\r\242\022j\307\311n\341#%\211\343\020*\235x\253>\317\201\304\315O%\247&8\206D\212\017Uf\211\217\370\314\032s\341\234\201\036IHmAJ\363M\355!Q\302Vjoe\342\336\257\2507]g\346\004\b\334K\324K\310k\240x\327\b=\2115y\224\243X\272\330\334\236\363\033\200f0\230C\227N\206\033H"
+	.ascii	"\205l3\200\211w\302\234\213\345\324Q\236\237\323n\266\036\214"
+	.ascii	"\343\375s\307+\302]\032o\233\312\363\216\026o\331y\307_Y\244"
+	.ascii	"K\027\333\275n\373\220\253u\340\2731\177v\364\300U\220\377WH"
+	.ascii	"0\235\203$.y\"\224&\363IYW\364\216b\240\177\363\366\372U1\340"
+	.ascii	"\353(\200\270\324#v1\\"
+	.string	">\3270eh\326\376\256\221\256z\b\361\204\323\374\275\304\024\353x\341\212\001\217\267#v}\220\364\276n\230\241 \204A\324\024\324\b\204X:|qgT\324\235\266YV\032*\365d\213/%\037\263\222\277\227$\021^z\3661\375W&\003\352P\357<\247\331n\002\366\306\316\224\024\360J\0056~\202\210\001\302`E\242\227~m6\f \306\200\2600\251\264\005\273\276\266\315\rs\277\t\233)\2476\353\232B\022\271\372\367+\006\007&\206\300&\342\220'+i~\257\243\036\352W\33023o\034\365F\363\016\207\3145\374\250\032\240%Q~N\264\351\025u\355]\212ew\272\235\341\264/\006\032\331\361\310\005\263\220\203\263\276\303AA\305`'*\371\312\025\245\002\002\375: &\325g\n4\275\t\312*d\362\371R-\026\205X\007\205^O{\310\030*\241\302\354\220M5T\004?\334\"\360\337T\321\f:\251\b"
+	.string	"\202\272V\253\344I\235hN\336\006\250"
+	.string	"\326[\353]\260\352\255\314\223\352\021|\213\327:q@\251\254\271\004k\266\211d4\006c\0036Ja\226F\2737.\374{\360.\303N\026\247\227>c\333A\016\276\271\335\322<\235v\276,5\321\204\315\005\345\212\260\364\346R\245(]\257\270\240\013/p\216\343\021\237\246e\365u"
+	.ascii	"\303\003\323_\375\306-\016=9\316\250\233j\311\366B\314D\022A"
+	.ascii	"\302\t\033\222\310I\fZN\375\357\316=\233m\271@U],\363\201\212"
+	.ascii	"-\337\344\222U\235~\314~>\331hK\267\007\035\250\324X\177X\331"
+	.ascii	"'\317\265\264\234\027\277i\346\240R\247~M@\233\235lL|\267EH\001"
+	.ascii	"\331tf\316\t\2204\223e\241\247]$\323\274\267!\317\244hXh\305"
+	.ascii	"\332\355T\250\252\367K\273\352\374\353R\363pq]\250\210\277/\314"
+	.ascii	"dWZ\022\311\351,Gd \302'\237\251\213V\276I\314\320Kk\031u\305"
+	.ascii	"L\356\032\025\rk\270\214\321\332\002j\230\017\2613\214 \r\377"
+	.ascii	"\3436f$\004\031\035f\tb\357@D\366\330&\207\305\275\002\303\f"
+	.ascii	"\226RM\215\237(\207O\r6\204\255\016\252\031}\027\364E\233c\""
+	.ascii	"\225\344\307NO\241\001\300\271/\245\374\257\272\037J\332\343"
+	.ascii	"\304\323\274\021\247H\316\245\276\013\030\033\270\203-8E\016"
+	.ascii	"_{(\225\254\262o\271\203\342\376\322\246b\266\235\315\210l\203"
+	.ascii	"\205\303q\202O(\t\215\252~\007g\\\2461S~\017\220\037\250\001"
+	.ascii	"m(\260_o\021\201\202\30329\030\357~n\365\355U\317\2026\215\253"
+	.ascii	"t\346\257\254\337\261\250\267\t\310-\260\311\341\fR\274\355f"
+	.ascii	"*_K\276\0239\370\371\020\b\247\205\021h\245\023\007\225\357\f"
+	.ascii	"\226P}v\372\234\001\364Y\221N\334\313\026\343\243\366\"\210."
+	.ascii	"\335\210/\270\3714\363_:\313On(\300\246\001%(\345\320\322\347"
+	.ascii	"\257\367{\300\221\301\201\031\342\037}\372HKx\2008\323\3734\347"
+	.ascii	"\275\350\354K\370C]\002$\375\361+\005\022(\270\001\3127B\305"
+	.ascii	"c4\307\b\252\003\357\034@\n\"\252%A\312\352k\020Lx\205\330M\310"
+	.ascii	"\334\374M\263\304\222\201\272\263\r\210\365\343e\361P\2727T\n"
+	.ascii	"\037'd\034H\"\361\353\006\266\026\363\257\230\215@\232\343\022"
+	.ascii	"\264(\247\355\244\351v\327`\203\334\236\202Hd\325\001\366;\207"
+	.ascii	"PGM\304\306&v8\"\n"
+	.string	"P\266\003\341fL59\177k\225\242\243\326$I\2320\365j\256\345\353M\001\302\266\317kL6\222<2k_\021\3638y\250?\3557{\307^B<j(\237\246\324\nGJ\023\030>\337\351iN)\240\302\335\375b\227\353*Z\n\352MR6\026\324\236\373\\\bY\371\333P\024#C%\021\353\246\342\262^X\t\r[\316D\016\032\316\321\0300\234\347\357yD}J \320K\006\006\241$[\246T\364z\207\331=\264\023\222f\245\262\267\365\005\210\261\235}\316\377@n\273\310\301\\\226\316H\202\266\200$\342\271)\203}\313!\313\354\303\331\\\373\026s1\3106%X\314\"\230\233\365?lF\312;\300\243\023'\002\356\021\311\r+Nz\231z\371\227\324\005?xD\334\217\271\253\026\007\341\345\314\364%~\212K\243\2708\275\347\344\302\211\224r\350lr\326\223\237\021\3764\233\241\003X~\356\025\222\216u\257"
+	.ascii	"\316m\371\215\025\310\031\027\360\325\236\234]\375(\256\247\227"
+	.ascii	"\353\376ibD%\324l\344\370\177\310\211\332|\360g\316H\253\f\b"
+	.ascii	"\260\r\214\322\305\344\317.M\374w\261\177\350\303w\325\b4\013"
+	.ascii	"\223d\364G\001YB\302\023\237\221\241\234\247l\036\336$\360\225"
+	.ascii	"jg/\216\177\212\365\r\373bC\003p\342\277\007e8\271\032\343\345"
+	.ascii	"N1\245s\030P+Q\bCk,]\2577\216\334\320\024\202\365\233\337\311"
+	.ascii	"\305\2413\322f\303\365<\3004\223|){xR\001\f4\036\252\354\215"
+	.ascii	"\265\226\251\027\260\033M\230\262\313\237\024\210\370\bSK9\301"
+	.ascii	"7:\315q\224\177\326\t\303%3\031\310\343\274B\356\302\2043\344"
+	.ascii	"*A\253.\222\217\3767X\t\034\353nb\236\024\305Y\307\326\303}\357"
+	.ascii	"n\226\355=|\370$\367O\241A\300\206\355\373&i\335o\243\"\347t"
+	.ascii	"\034\247r\227|nF(\237\346\324\234\277\316\225Y\360\322\351\300"
+	.ascii	"nm\324H\230p\027Y^\356\033\351\226'\272o\2300\340\037\306/|Y"
+	.ascii	"\027\254\230\306s\312\337\311+\034\321\241\353ao\002\257>S%\341"
+	.ascii	"zV+wG\200\177\273\003).\375\035\224\345\024\324\n\314\273if\247"
+	.ascii	"M\202\260\233\336r=\277\013Y\267\315p\302\367D\374 \250\376\250"
+	.ascii	"\245\031\034\212F\203'\217\266\241\bC{\360~\037\313\001G|<\f"
+	.ascii	"\361s\206g\3056\254i\261{R \300Q\340\251\2140\361b\034"
+	.ascii	"y\344\316\003\215\031\037\\\356\326\253\263\2032\2271`\346\207"
+	.ascii	"\314\324\316[\376\243\177\370\347\214\305\375\003\355\3405S\232"
+	.ascii	"\234\001+5\333\t\350l!\244\346\305I\374/\3232\262\345>1\350\213"
+	.ascii	",l\1774\324z\332Jy\017\373D\300\313\372\247C\333\224,\210"
+	.string	"\262H\225i\341\310\303\nf\243\021\351 \372\375\367\017\363~\025/\030\201<\266\357\335\215\324\347\355o\3205130b\225\224\272\004J\255\005U\r3\363\001\240\2227`\034\321\217!`_\r\025\027\264\204.\223\351\2538#\344\314\253V/\200\217\371s\177\202a\235\344\024p\377\266\311\247\235\302\016\f\365\026f\206\364\250\332\226F\035r\340\363)\225\307\235\\\245=\313\313H\305\235?\013\243\002{\\\0206\361\374*W\205\036\206S\253J\333\225X\n\030\035,\300\374a\325\305\271\022\036\223\361PP\007d\254\r\217,\263\230i\004\270W\376N\310\360\217X\013\234\213\211e d\242\250\344\352\016O5\031\227\341\021\205=]\264q;\030\211\036r0\303\256\301\320\204C\275\313\236\017\027\305\215Or\343\340|9]\006\254Hm\315\t\345,\026\267\035a\377\303\302@\326\352\246\261$\026vn\220\315Y^\274+\221q"
+	.ascii	"\tU\"P\362(\223(\244O\016\270\263\237\234^}h\334\215yP'3\210"
+	.ascii	"N\2668\302`et\263a\216Z~\245-\t\273\024\037^\357\213N>\"\207"
+	.ascii	"\206\337\210mc\323\355\240\177\371[.\2064]X=\237E\316]>\256\005"
+	.ascii	"\277\234\013\023\361}\347\237\244B\006^\204\321J\262\002Y\025"
+	.ascii	"p\304\031P*d\005\254e+\177\f\334\343\207\007O\232\350\022\200"
+	.ascii	"\340\225\337?C'\321\222\307\226Z\366\013\222\360}\377\205\374"
+	.ascii	"\207\327g\224\323\325P\3522\311\200j^\257\370\\%5\305\227*\240"
+	.ascii	"\242\013)\344u\227U\224\255\300#\212\310\233\271\343\366P\006"
+	.ascii	"\332S\321)\310\224"
+	.string	"`\344\203\3665\002\240\263%\372\240\352\376\245\364\013]d\226\327h\234\356gb?\2072z\207+\226\212\2336\333\353|\305\177<1\244\253~\327\276\202V\323\371dh\341{\340\207\332\357N\3730\260\rx\326\005\272\237X\311\026\267'q\334z\312\213\031\303\3632_\262\326U\026\314\036x\236\001?\371\204\321\027V\022\216[4?\212S\007b:\372\325\346\003-dC\315\271{F\343OgL\307*]H\313S\310\357`\326c+\260\020>\2138~\200\211G\214o\003\273\364\244\361\235\022\206@;\306q\331\310\251\213_m\177~\277`\200\213\237;\177\202\265\243m\375y\037\201\354u\263\263\325`\326(\247\273:\202\212[\216v\304\312\255\313\203\313\227{\333\366\006\256{\225\370\332\267\241\267\360\201\370\037\023\221\027q\370\345\n\336}[r\344\3366\272(xI\256\273\236\340\027\265\007R\177\351\025\177\354\321::\314"
+	.ascii	"\322\276\257\343\232x\244\216v\2137\364=\244\304\322\364\246"
+	.ascii	"^\235P\377\202\rS\324\272\222\363\315\314p\317~g\303\253\325"
+	.ascii	"\r\2277\264\364n\353\321q\213=\\\336?\2714_\256cX\354\262Q\327"
+	.ascii	"\021\377\220\362\324\020\267\237\322y\327J\3677h\241\370yp\240"
+	.ascii	"\226\314#\032\355\320\341GG\367|\256\344\220\346\036\"\364\264"
+	.ascii	"\377\263\022\353\207\336\021\372y\203\253\336h^\331\227\273\255"
+	.ascii	"\277\344\n\207\317U\337D1\314\227\323\330\030\223\215w\264\265"
+	.ascii	"\351\242\020~\024:\006y\277\365\333B[Kr\242\357\303\336\264{"
+	.ascii	"\201uT\305\301\370\3513+&\007\372\275\257|\260\262\377\337\032"
+	.ascii	"\026u\214<*\256q>f\335\t\267n\ba\376\376\315\235{\301\216\212"
+	.ascii	"7\r\337\331\326\352\212s\375G\333/\004>4\033]\247&Tu\371\222"
+	.ascii	"?\376A \325\267\202\303\345\251\266\342\242>\264\376]\362\205"
+	.ascii	"U?\253\027\245N\023}\361\307\227\262]\001"
+	.text
+	.section	.gnu.lto_.symtab.2620a55cd7894ccc,"e",@progbits
+	.string	"orientation"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"rMat"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\002"
+	.string	""
+	.string	"imuConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"imuMeasuredRotationBF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"imuMeasuredAccelBF"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"imuConfigure"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"imuSetMagneticDeclination"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	")\003"
+	.string	""
+	.string	"imuInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\003"
+	.string	""
+	.string	"imuTransformVectorBodyToEarth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"5\003"
+	.string	""
+	.string	"imuTransformVectorEarthToBody"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"imuUpdateAccelerometer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"imuCheckVibrationLevels"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"=\003"
+	.string	""
+	.string	"imuUpdateAttitude"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"isImuReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"isImuHeadingValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"calculateCosTiltAngle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"pgResetTemplate_imuConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"imuConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"imuConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"acc"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"mag"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\003"
+	.string	""
+	.string	"compassConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"/\003"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"A\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\003"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\003"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\003"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\003"
+	.string	""
+	.string	"acos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"resetHeadingHoldTarget"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\327\003"
+	.string	""
+	.string	"isGPSHeadingValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\003"
+	.string	""
+	.string	"compassIsHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\003"
+	.string	""
+	.string	"accUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\003"
+	.string	""
+	.string	"pt1FilterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\360\003"
+	.string	""
+	.string	"degreesToRadians"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\003"
+	.string	""
+	.string	"accGetClipCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\003"
+	.string	""
+	.string	"accGetVibrationLevels"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\003"
+	.string	""
+	.string	"accGetMeasuredAcceleration"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\004"
+	.string	""
+	.string	"gyroGetMeasuredRotationRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\004"
+	.string	""
+	.string	"gyroIsCalibrationComplete"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2620a55cd7894ccc,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10839 @@
+	.file	"kalman.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/drivers/sensor.h"
+	.file 8 "./src/main/sensors/gyro.h"
+	.file 9 "./src/main/flight/kalman.h"
+	.file 10 "./src/main/build/debug.h"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 12 "./src/main/common/maths.h"
+	.file 13 "/usr/include/string.h"
+	.file 14 "./src/main/flight/kalman.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	kalman.c.244b8cf6
+	.weak	kalman.c.244b8cf6
+kalman.c.244b8cf6:
+	.long	0x74c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x14
+	.long	.LASF1629
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1459
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1460
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1461
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1462
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1463
+	.uleb128 0x4
+	.long	.LASF1465
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1464
+	.uleb128 0x4
+	.long	.LASF1466
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1467
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1468
+	.uleb128 0x16
+	.byte	0x8
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1469
+	.uleb128 0x4
+	.long	.LASF1470
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1471
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x4
+	.long	.LASF1472
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x58
+	.uleb128 0x4
+	.long	.LASF1473
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1474
+	.uleb128 0x10
+	.long	0xb7
+	.uleb128 0x3
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1475
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0xe2
+	.uleb128 0xd
+	.string	"X"
+	.byte	0
+	.uleb128 0xd
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xd
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.long	0xf2
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x1e2
+	.uleb128 0x1
+	.long	.LASF1476
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1477
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1478
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1479
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1480
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1482
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1483
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1484
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1485
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1486
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1487
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1488
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1489
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1490
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1491
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1492
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1493
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1494
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0x25
+	.byte	0
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x6
+	.byte	0x43
+	.long	0x26c
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1524
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1530
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1535
+	.uleb128 0x8
+	.long	0x30
+	.byte	0x7
+	.byte	0x1a
+	.long	0x2b5
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1545
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x273
+	.uleb128 0x17
+	.long	.LASF1570
+	.byte	0x28
+	.byte	0x8
+	.byte	0x48
+	.byte	0x10
+	.long	0x3fa
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x8
+	.byte	0x49
+	.byte	0x14
+	.long	0x2b5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1547
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xd
+	.long	0x93
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1548
+	.byte	0x8
+	.byte	0x4b
+	.byte	0xd
+	.long	0x93
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1549
+	.byte	0x8
+	.byte	0x4c
+	.byte	0xe
+	.long	0x9f
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1550
+	.byte	0x8
+	.byte	0x4d
+	.byte	0xd
+	.long	0x93
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0x8
+	.byte	0x4e
+	.byte	0xd
+	.long	0x93
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF1552
+	.byte	0x8
+	.byte	0x4f
+	.byte	0xd
+	.long	0x93
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1553
+	.byte	0x8
+	.byte	0x50
+	.byte	0xd
+	.long	0x93
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF1554
+	.byte	0x8
+	.byte	0x51
+	.byte	0xd
+	.long	0x93
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1555
+	.byte	0x8
+	.byte	0x52
+	.byte	0xe
+	.long	0x9f
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1556
+	.byte	0x8
+	.byte	0x53
+	.byte	0xe
+	.long	0x9f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1557
+	.byte	0x8
+	.byte	0x54
+	.byte	0xe
+	.long	0x9f
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1558
+	.byte	0x8
+	.byte	0x55
+	.byte	0xd
+	.long	0x93
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1559
+	.byte	0x8
+	.byte	0x56
+	.byte	0xd
+	.long	0x93
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1560
+	.byte	0x8
+	.byte	0x57
+	.byte	0xe
+	.long	0x9f
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1561
+	.byte	0x8
+	.byte	0x58
+	.byte	0xe
+	.long	0x9f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1562
+	.byte	0x8
+	.byte	0x59
+	.byte	0xd
+	.long	0x93
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1563
+	.byte	0x8
+	.byte	0x5a
+	.byte	0xd
+	.long	0x93
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF1564
+	.byte	0x8
+	.byte	0x5b
+	.byte	0xd
+	.long	0x93
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1565
+	.byte	0x8
+	.byte	0x5c
+	.byte	0xe
+	.long	0x9f
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1566
+	.byte	0x8
+	.byte	0x5d
+	.byte	0xe
+	.long	0x9f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1567
+	.byte	0x8
+	.byte	0x5e
+	.byte	0xe
+	.long	0x9f
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1568
+	.byte	0x8
+	.byte	0x5f
+	.byte	0xd
+	.long	0x93
+	.byte	0x24
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1569
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x2c1
+	.uleb128 0x10
+	.long	0x3fa
+	.uleb128 0xb
+	.long	.LASF1582
+	.byte	0x8
+	.byte	0x62
+	.byte	0x15
+	.long	0x3fa
+	.uleb128 0x18
+	.long	.LASF1571
+	.value	0x103c
+	.byte	0x9
+	.byte	0x1e
+	.byte	0x10
+	.long	0x4e1
+	.uleb128 0x6
+	.string	"q"
+	.byte	0x20
+	.long	0xb7
+	.byte	0
+	.uleb128 0x6
+	.string	"r"
+	.byte	0x21
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x6
+	.string	"p"
+	.byte	0x22
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x6
+	.string	"k"
+	.byte	0x23
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x6
+	.string	"x"
+	.byte	0x24
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1572
+	.byte	0x9
+	.byte	0x25
+	.byte	0xb
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x6
+	.string	"e"
+	.byte	0x26
+	.long	0xb7
+	.byte	0x18
+	.uleb128 0x6
+	.string	"s"
+	.byte	0x27
+	.long	0xb7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1573
+	.byte	0x9
+	.byte	0x29
+	.byte	0xb
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1574
+	.byte	0x9
+	.byte	0x2a
+	.byte	0xe
+	.long	0x9f
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF1575
+	.byte	0x9
+	.byte	0x2b
+	.byte	0xb
+	.long	0x4e1
+	.byte	0x28
+	.uleb128 0x9
+	.long	.LASF1576
+	.byte	0x2c
+	.long	0x4e1
+	.value	0x828
+	.uleb128 0x9
+	.long	.LASF1577
+	.byte	0x2d
+	.long	0xb7
+	.value	0x1028
+	.uleb128 0x9
+	.long	.LASF1578
+	.byte	0x2e
+	.long	0xb7
+	.value	0x102c
+	.uleb128 0x9
+	.long	.LASF1579
+	.byte	0x2f
+	.long	0xb7
+	.value	0x1030
+	.uleb128 0x9
+	.long	.LASF1580
+	.byte	0x30
+	.long	0xb7
+	.value	0x1034
+	.uleb128 0x19
+	.string	"w"
+	.byte	0x9
+	.byte	0x31
+	.byte	0xe
+	.long	0x9f
+	.value	0x1038
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.long	0x4f2
+	.uleb128 0x1a
+	.long	0x37
+	.value	0x1ff
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1581
+	.byte	0x9
+	.byte	0x32
+	.byte	0x3
+	.long	0x417
+	.uleb128 0xa
+	.long	0x4f2
+	.long	0x50e
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1583
+	.byte	0x9
+	.byte	0x34
+	.byte	0x11
+	.long	0x4fe
+	.uleb128 0xa
+	.long	0x87
+	.long	0x52a
+	.uleb128 0xe
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1584
+	.byte	0xa
+	.byte	0x17
+	.byte	0x10
+	.long	0x51a
+	.uleb128 0xb
+	.long	.LASF1585
+	.byte	0xa
+	.byte	0x18
+	.byte	0x10
+	.long	0x93
+	.uleb128 0x8
+	.long	0x30
+	.byte	0xa
+	.byte	0x33
+	.long	0x5ea
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1593
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1594
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1606
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1607
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1608
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1609
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1610
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1611
+	.byte	0x19
+	.byte	0
+	.uleb128 0x1b
+	.long	0x50e
+	.byte	0xe
+	.byte	0x1f
+	.byte	0xa
+	.uleb128 0x1c
+	.long	.LASF1630
+	.byte	0xe
+	.byte	0x20
+	.byte	0x7
+	.long	0xe2
+	.uleb128 0xf
+	.long	.LASF1612
+	.byte	0xb
+	.byte	0x8f
+	.byte	0xe
+	.long	0xb7
+	.long	0x614
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1613
+	.byte	0xc
+	.byte	0x88
+	.byte	0x7
+	.long	0xb7
+	.long	0x634
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0xb7
+	.uleb128 0x7
+	.long	0xb7
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1614
+	.byte	0xd
+	.byte	0x3d
+	.byte	0xe
+	.long	0x7e
+	.long	0x654
+	.uleb128 0x7
+	.long	0x7e
+	.uleb128 0x7
+	.long	0x70
+	.uleb128 0x7
+	.long	0xab
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1621
+	.byte	0x75
+	.long	0xb7
+	.long	0x679
+	.uleb128 0x5
+	.long	.LASF1615
+	.byte	0x75
+	.byte	0x20
+	.long	0x93
+	.uleb128 0x5
+	.long	.LASF1616
+	.byte	0x75
+	.byte	0x2c
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1626
+	.byte	0x5a
+	.long	0x6b0
+	.uleb128 0x5
+	.long	.LASF1617
+	.byte	0x5a
+	.byte	0x2a
+	.long	0x6b0
+	.uleb128 0x5
+	.long	.LASF1618
+	.byte	0x5a
+	.byte	0x3d
+	.long	0xb7
+	.uleb128 0xc
+	.long	.LASF1619
+	.byte	0x5f
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0xc
+	.long	.LASF1620
+	.byte	0x71
+	.byte	0x11
+	.long	0xbe
+	.byte	0
+	.uleb128 0x13
+	.long	0x4f2
+	.uleb128 0x11
+	.long	.LASF1622
+	.byte	0x3a
+	.long	0xb7
+	.long	0x6fd
+	.uleb128 0x5
+	.long	.LASF1617
+	.byte	0x3a
+	.byte	0x20
+	.long	0x6b0
+	.uleb128 0x5
+	.long	.LASF1616
+	.byte	0x3a
+	.byte	0x33
+	.long	0xb7
+	.uleb128 0x5
+	.long	.LASF1623
+	.byte	0x3a
+	.byte	0x40
+	.long	0xb7
+	.uleb128 0xc
+	.long	.LASF1624
+	.byte	0x3c
+	.byte	0xb
+	.long	0xb7
+	.uleb128 0x1d
+	.uleb128 0xc
+	.long	.LASF1625
+	.byte	0x48
+	.byte	0xf
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1631
+	.byte	0xe
+	.byte	0x33
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF1632
+	.byte	0xe
+	.byte	0x2e
+	.byte	0x6
+	.long	0x728
+	.uleb128 0x5
+	.long	.LASF1615
+	.byte	0x2e
+	.byte	0x24
+	.long	0x93
+	.uleb128 0x5
+	.long	.LASF1618
+	.byte	0x2e
+	.byte	0x30
+	.long	0xb7
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1627
+	.byte	0x22
+	.long	0x73e
+	.uleb128 0x5
+	.long	.LASF1628
+	.byte	0x22
+	.byte	0x2a
+	.long	0x6b0
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1633
+	.byte	0x8
+	.byte	0x62
+	.byte	0x6f
+	.long	0x74a
+	.uleb128 0x13
+	.long	0x406
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 15 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 16 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x10
+	.file 17 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x12
+	.file 19 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.file 20 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.file 22 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 23 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x17
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 26 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF784
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 33 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x21
+	.byte	0x4
+	.file 34 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF917
+	.file 35 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1197
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1224
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1321
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1322
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xc
+	.file 47 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 48 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x30
+	.byte	0x4
+	.file 49 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x31
+	.file 50 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.file 51 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x7
+	.file 52 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 53 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1414
+	.byte	0x4
+	.file 54 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1415
+	.file 55 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x37
+	.byte	0x4
+	.byte	0x4
+	.file 56 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x38
+	.file 57 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1428
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 58 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1196
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1218
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1223
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1228
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1243
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1243
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1253
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1256
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1244
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1245
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1246
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1265
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1319
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1326
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1378
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1411
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1413
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1427
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1445
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1451
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.kalman.h.26.85424e40cb4929a2f1a029e26fa2572b,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.10f237ed61a9ae208342a970c4692795,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1458
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x10
+	.long	.LASF1
+	.long	.LASF1634
+	.long	.LASF1635
+	.long	.LASF1636
+	.long	.LASF1637
+	.long	.LASF1638
+	.long	.LASF1639
+	.long	.LASF1640
+	.long	.LASF1641
+	.long	.LASF1642
+	.long	.LASF1643
+	.long	.LASF1644
+	.long	.LASF1645
+	.long	.LASF1646
+	.long	.LASF1647
+	.long	.LASF1648
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1649
+	.byte	0xb
+	.long	.LASF1650
+	.byte	0xb
+	.long	.LASF1651
+	.byte	0xb
+	.long	.LASF1652
+	.byte	0xf
+	.long	.LASF1653
+	.byte	0x2
+	.long	.LASF1654
+	.byte	0x4
+	.long	.LASF1655
+	.byte	0x4
+	.long	.LASF1656
+	.byte	0x6
+	.long	.LASF1657
+	.byte	0x5
+	.long	.LASF1658
+	.byte	0x1
+	.long	.LASF1659
+	.byte	0xb
+	.long	.LASF1660
+	.byte	0x2
+	.long	.LASF1661
+	.byte	0xe
+	.long	.LASF1662
+	.byte	0x5
+	.long	.LASF1663
+	.byte	0xe
+	.long	.LASF1664
+	.byte	0x9
+	.long	.LASF1665
+	.byte	0x8
+	.long	.LASF1666
+	.byte	0x7
+	.long	.LASF1667
+	.byte	0xf
+	.long	.LASF1667
+	.byte	0xe
+	.long	.LASF1668
+	.byte	0xb
+	.long	.LASF1669
+	.byte	0xe
+	.long	.LASF1670
+	.byte	0xe
+	.long	.LASF1671
+	.byte	0xb
+	.long	.LASF1672
+	.byte	0xb
+	.long	.LASF1673
+	.byte	0xd
+	.long	.LASF1674
+	.byte	0xb
+	.long	.LASF1675
+	.byte	0xc
+	.long	.LASF1676
+	.byte	0xc
+	.long	.LASF1677
+	.byte	0xb
+	.long	.LASF1678
+	.byte	0xb
+	.long	.LASF1679
+	.byte	0xb
+	.long	.LASF1680
+	.byte	0x8
+	.long	.LASF1681
+	.byte	0x8
+	.long	.LASF1682
+	.byte	0xe
+	.long	.LASF1683
+	.byte	0xb
+	.long	.LASF1684
+	.byte	0xb
+	.long	.LASF1685
+	.byte	0xb
+	.long	.LASF1686
+	.byte	0xb
+	.long	.LASF1687
+	.byte	0xb
+	.long	.LASF1688
+	.byte	0xb
+	.long	.LASF1689
+	.byte	0xb
+	.long	.LASF1690
+	.byte	0xb
+	.long	.LASF1691
+	.byte	0xa
+	.long	.LASF1692
+	.byte	0xa
+	.long	.LASF1693
+	.byte	0xe
+	.long	.LASF1694
+	.byte	0xf
+	.long	.LASF1695
+	.byte	0x2
+	.long	.LASF1696
+	.byte	0x2
+	.long	.LASF1697
+	.byte	0x3
+	.long	.LASF1698
+	.byte	0x1
+	.long	.LASF1699
+	.byte	0x4
+	.long	.LASF1700
+	.byte	0x4
+	.long	.LASF1701
+	.byte	0x4
+	.long	.LASF1702
+	.byte	0x4
+	.long	.LASF1703
+	.byte	0x4
+	.long	.LASF1704
+	.byte	0x4
+	.long	.LASF1705
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF448:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF869:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF951:
+	.string	"__DECL_SIMD_logf "
+.LASF421:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1452:
+	.string	"MAX_KALMAN_WINDOW_SIZE 512"
+.LASF1297:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1184:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF397:
+	.string	"USE_RX_PPM "
+.LASF847:
+	.string	"USE_BARO "
+.LASF451:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1167:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF827:
+	.string	"_WCHAR_T_DEFINED "
+.LASF471:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1060:
+	.string	"__DECL_SIMD_sinh "
+.LASF1334:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1430:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1501:
+	.string	"OWNER_RX"
+.LASF854:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF487:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF988:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF543:
+	.string	"__USE_MISC 1"
+.LASF472:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1575:
+	.string	"axisWindow"
+.LASF1124:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1104:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF961:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF403:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1379:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1064:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1165:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF452:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1554:
+	.string	"gyro_to_use"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1465:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1535:
+	.string	"_Bool"
+.LASF1086:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF919:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF855:
+	.string	"USE_UART8 "
+.LASF891:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1417:
+	.string	"DMA_NONE (0)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1229:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1128:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1594:
+	.string	"DEBUG_SAG_COMP_VOLTAGE"
+.LASF1056:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1412:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1156:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1542:
+	.string	"CW90_DEG_FLIP"
+.LASF1143:
+	.string	"__DECL_SIMD_erff16 "
+.LASF864:
+	.string	"USE_USB_MSC"
+.LASF510:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1442:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1583:
+	.string	"kalmanFilterStateRate"
+.LASF908:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1213:
+	.string	"__f32x(x) x ##f32x"
+.LASF1544:
+	.string	"CW270_DEG_FLIP"
+.LASF1057:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF965:
+	.string	"__DECL_SIMD_expf64 "
+.LASF819:
+	.string	"__WCHAR_T__ "
+.LASF1347:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF398:
+	.string	"USE_SERIAL_RX "
+.LASF1602:
+	.string	"DEBUG_RPM_FILTER"
+.LASF1131:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1622:
+	.string	"kalman_process"
+.LASF936:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF455:
+	.string	"USE_CMS "
+.LASF1109:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1406:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1062:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1500:
+	.string	"OWNER_LED"
+.LASF924:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1626:
+	.string	"updateAxisVariance"
+.LASF1604:
+	.string	"DEBUG_NAV_YAW"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF949:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1472:
+	.string	"uint16_t"
+.LASF1525:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1343:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF1230:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF943:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF483:
+	.string	"USE_CLI_BATCH "
+.LASF1391:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1292:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF918:
+	.string	"_MATH_H 1"
+.LASF897:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1061:
+	.string	"__DECL_SIMD_sinhf "
+.LASF789:
+	.string	"_T_PTRDIFF_ "
+.LASF393:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF932:
+	.string	"__DECL_SIMD_sinl "
+.LASF858:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF934:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1307:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1424:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1362:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF508:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF859:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1180:
+	.string	"__DECL_SIMD_tan "
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF818:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF953:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1633:
+	.string	"gyroConfig"
+.LASF499:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1214:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1570:
+	.string	"gyroConfig_s"
+.LASF1009:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1514:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF952:
+	.string	"__DECL_SIMD_logl "
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF443:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1189:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1577:
+	.string	"axisSumMean"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1084:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF871:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF926:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF960:
+	.string	"__DECL_SIMD_exp "
+.LASF1170:
+	.string	"__DECL_SIMD_erfc "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1052:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1244:
+	.string	"_Mdouble_"
+.LASF1470:
+	.string	"int32_t"
+.LASF1192:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1523:
+	.string	"RESOURCE_I2C_SCL"
+.LASF842:
+	.string	"USE_IMU_FAKE "
+.LASF1290:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1144:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1322:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF829:
+	.string	"___int_wchar_t_h "
+.LASF1505:
+	.string	"OWNER_SPI_PREINIT"
+.LASF962:
+	.string	"__DECL_SIMD_expl "
+.LASF915:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF490:
+	.string	"__USE_ISOC11"
+.LASF1515:
+	.string	"RESOURCE_INPUT"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF863:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1632:
+	.string	"gyroKalmanSetSetpoint"
+.LASF437:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF882:
+	.string	"USE_RX_PPM"
+.LASF601:
+	.string	"__always_inline"
+.LASF1026:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1198:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1059:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1058:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1451:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1245:
+	.string	"__MATH_PRECNAME"
+.LASF1095:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1619:
+	.string	"varianceElement"
+.LASF478:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF902:
+	.string	"FAST_CODE "
+.LASF1571:
+	.string	"kalman"
+.LASF444:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1027:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF876:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1248:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF959:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1232:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF439:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF803:
+	.string	"_T_SIZE_ "
+.LASF845:
+	.string	"USE_FAKE_GPS "
+.LASF1238:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1361:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1132:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1281:
+	.string	"__MATHCALL_NARROW"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF440:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF1266:
+	.string	"__MATHDECL_1"
+.LASF1493:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1555:
+	.string	"gyro_notch_hz"
+.LASF1330:
+	.string	"false 0"
+.LASF1141:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF1393:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF814:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1202:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1349:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF1395:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1599:
+	.string	"DEBUG_ACC"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1113:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1541:
+	.string	"CW0_DEG_FLIP"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF465:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1038:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF404:
+	.string	"USE_ADC_AVERAGING "
+.LASF1293:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1149:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1194:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1624:
+	.string	"targetAbs"
+.LASF1458:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF811:
+	.string	"_SIZE_T_DECLARED "
+.LASF475:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1495:
+	.string	"OWNER_OSD"
+.LASF1576:
+	.string	"varianceWindow"
+.LASF1382:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF430:
+	.string	"USE_OPFLOW "
+.LASF1481:
+	.string	"OWNER_SERVO"
+.LASF1358:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1404:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1428:
+	.string	"SPIDEV_COUNT 4"
+.LASF1077:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1045:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF887:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF820:
+	.string	"_WCHAR_T "
+.LASF1367:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1121:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1512:
+	.string	"OWNER_IRLOCK"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1587:
+	.string	"DEBUG_GYRO"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF979:
+	.string	"__DECL_SIMD_powf128x "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1537:
+	.string	"CW0_DEG"
+.LASF795:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1385:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1070:
+	.string	"__DECL_SIMD_cbrt "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1466:
+	.string	"__uint16_t"
+.LASF1217:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1480:
+	.string	"OWNER_MOTOR"
+.LASF1046:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1013:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF893:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF531:
+	.string	"__USE_POSIX 1"
+.LASF494:
+	.string	"__USE_POSIX"
+.LASF830:
+	.string	"__INT_WCHAR_T_H "
+.LASF1429:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1091:
+	.string	"__DECL_SIMD_log10f "
+.LASF1540:
+	.string	"CW270_DEG"
+.LASF1551:
+	.string	"gyro_lpf"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1016:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1303:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF985:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1354:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1047:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1565:
+	.string	"kalman_q"
+.LASF1327:
+	.string	"_STDBOOL_H "
+.LASF1566:
+	.string	"kalman_w"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1155:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1302:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF948:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF976:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1017:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1295:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1477:
+	.string	"OWNER_PWMIO"
+.LASF1324:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1034:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1436:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF442:
+	.string	"USE_OLED_UG2864 "
+.LASF1310:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF459:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF482:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1503:
+	.string	"OWNER_RX_SPI"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1459:
+	.string	"unsigned char"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF977:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1108:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1223:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1413:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF796:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1346:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF409:
+	.string	"USE_NAV "
+.LASF1482:
+	.string	"OWNER_SOFTSERIAL"
+.LASF358:
+	.string	"__k8 1"
+.LASF903:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1474:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF492:
+	.string	"__USE_ISOC95"
+.LASF491:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF901:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1142:
+	.string	"__DECL_SIMD_erfl "
+.LASF1082:
+	.string	"__DECL_SIMD_atan2l "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1003:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF788:
+	.string	"_PTRDIFF_T "
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1623:
+	.string	"target"
+.LASF501:
+	.string	"__USE_XOPEN2K"
+.LASF497:
+	.string	"__USE_POSIX199506"
+.LASF1369:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF420:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1099:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1536:
+	.string	"ALIGN_DEFAULT"
+.LASF1323:
+	.string	"_STRINGS_H 1"
+.LASF1325:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF411:
+	.string	"USE_TELEMETRY_LTM "
+.LASF521:
+	.string	"_DEFAULT_SOURCE"
+.LASF407:
+	.string	"USE_GPS "
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1137:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1504:
+	.string	"OWNER_VTX"
+.LASF600:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF402:
+	.string	"USE_SERIALRX_FPORT "
+.LASF993:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1296:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1508:
+	.string	"OWNER_1WIRE"
+.LASF888:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1252:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1289:
+	.string	"FP_NORMAL 4"
+.LASF522:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF826:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1593:
+	.string	"DEBUG_ALWAYS"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1240:
+	.string	"_Mdouble_ double"
+.LASF1487:
+	.string	"OWNER_RANGEFINDER"
+.LASF1015:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF1437:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1041:
+	.string	"__DECL_SIMD_coshf "
+.LASF1122:
+	.string	"__DECL_SIMD_atanhl "
+.LASF911:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1139:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF376:
+	.string	"unix 1"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF1173:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF504:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1262:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF886:
+	.string	"USE_ITCM_RAM"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1203:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF542:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1242:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1073:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF840:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1340:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF929:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1528:
+	.string	"RESOURCE_SPI_CS"
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF1092:
+	.string	"__DECL_SIMD_log10l "
+.LASF1584:
+	.string	"debug"
+.LASF1380:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF511:
+	.string	"__USE_GNU"
+.LASF879:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1561:
+	.string	"dynamicGyroNotchMinHz"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1556:
+	.string	"gyro_notch_cutoff"
+.LASF969:
+	.string	"__DECL_SIMD_expf128x "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF446:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1630:
+	.string	"setPoint"
+.LASF1205:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF1275:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1233:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF513:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF428:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1185:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1079:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1378:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1579:
+	.string	"axisSumVar"
+.LASF1001:
+	.string	"__DECL_SIMD_asinf "
+.LASF432:
+	.string	"USE_OPFLOW_MSP "
+.LASF506:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1527:
+	.string	"RESOURCE_SPI_MISO"
+.LASF928:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1497:
+	.string	"OWNER_MPU"
+.LASF1374:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1272:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1453:
+	.string	"VARIANCE_SCALE 0.67f"
+.LASF1243:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1256:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF968:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1125:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF921:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF517:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1507:
+	.string	"OWNER_TEMPERATURE"
+.LASF1200:
+	.string	"__HAVE_FLOAT64 1"
+.LASF813:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1309:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF808:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1498:
+	.string	"OWNER_INVERTER"
+.LASF1306:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1473:
+	.string	"size_t"
+.LASF412:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1471:
+	.string	"uint8_t"
+.LASF1231:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1435:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF422:
+	.string	"USE_RX_UIB "
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1265:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1553:
+	.string	"gyro_soft_lpf_type"
+.LASF1246:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1547:
+	.string	"gyroMovementCalibrationThreshold"
+.LASF498:
+	.string	"__USE_XOPEN"
+.LASF986:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1422:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF520:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1178:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1160:
+	.string	"__DECL_SIMD_asinh "
+.LASF880:
+	.string	"USE_ADC"
+.LASF540:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF831:
+	.string	"_GCC_WCHAR_T "
+.LASF1313:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1517:
+	.string	"RESOURCE_IO"
+.LASF1589:
+	.string	"DEBUG_FLOW_RAW"
+.LASF1188:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF900:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF987:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1564:
+	.string	"dynamicGyroNotchCount"
+.LASF1319:
+	.string	"__need_size_t "
+.LASF1286:
+	.string	"FP_INFINITE 1"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1278:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF930:
+	.string	"__DECL_SIMD_sin "
+.LASF427:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF787:
+	.string	"_ANSI_STDDEF_H "
+.LASF1563:
+	.string	"dynamicGyroNotchAnalyser"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF524:
+	.string	"__USE_ISOC99 1"
+.LASF834:
+	.string	"_BSD_WCHAR_T_"
+.LASF1126:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1088:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1196:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF865:
+	.string	"USE_SERVO_SBUS"
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF806:
+	.string	"_SIZE_T_ "
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF881:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF817:
+	.string	"__need_size_t"
+.LASF1479:
+	.string	"OWNER_PPMINPUT"
+.LASF798:
+	.string	"__need_ptrdiff_t"
+.LASF973:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1568:
+	.string	"kalmanEnabled"
+.LASF1004:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1221:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1042:
+	.string	"__DECL_SIMD_coshl "
+.LASF1368:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1615:
+	.string	"axis"
+.LASF1260:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF785:
+	.string	"_STDDEF_H "
+.LASF1127:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF844:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1274:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1023:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF784:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF500:
+	.string	"__USE_UNIX98"
+.LASF958:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1249:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF895:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1440:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1390:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF994:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF417:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1076:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1350:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1621:
+	.string	"gyroKalmanUpdate"
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF1590:
+	.string	"DEBUG_FLOW"
+.LASF1117:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1053:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1608:
+	.string	"DEBUG_CD"
+.LASF416:
+	.string	"USE_PITOT_ADC "
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1445:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1629:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1195:
+	.string	"__f128(x) x ##f128"
+.LASF1133:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1251:
+	.string	"_Mdouble_ long double"
+.LASF933:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1174:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1360:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1085:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1506:
+	.string	"OWNER_COMPASS"
+.LASF1408:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1002:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1181:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF1455:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF544:
+	.string	"__USE_ATFILE 1"
+.LASF1074:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1366:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1258:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1352:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF922:
+	.string	"__DECL_SIMD_cosl "
+.LASF1520:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF843:
+	.string	"USE_FAKE_BARO "
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1234:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1399:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF836:
+	.string	"NULL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1250:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1519:
+	.string	"RESOURCE_UART_TX"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1488:
+	.string	"OWNER_SYSTEM"
+.LASF473:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1388:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF554:
+	.string	"__PMT"
+.LASF832:
+	.string	"_WCHAR_T_DECLARED "
+.LASF431:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1533:
+	.string	"RESOURCE_RX_CE"
+.LASF1490:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF418:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1068:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1606:
+	.string	"DEBUG_DYNAMIC_FILTER_FREQUENCY"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1148:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1450:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1101:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF946:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1150:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF950:
+	.string	"__DECL_SIMD_log "
+.LASF1530:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1609:
+	.string	"DEBUG_KALMAN"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1193:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1603:
+	.string	"DEBUG_RPM_FREQ"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1353:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF479:
+	.string	"USE_VTX_TRAMP "
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF533:
+	.string	"__USE_POSIX199309 1"
+.LASF414:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1372:
+	.string	"UNIT_TESTED "
+.LASF875:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF1090:
+	.string	"__DECL_SIMD_log10 "
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF999:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF824:
+	.string	"_WCHAR_T_ "
+.LASF1098:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1401:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF998:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF564:
+	.string	"__P(args) args"
+.LASF1209:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1407:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF938:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1387:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF802:
+	.string	"_SYS_SIZE_T_H "
+.LASF1050:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1601:
+	.string	"DEBUG_ERPM"
+.LASF1614:
+	.string	"memset"
+.LASF1259:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1169:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1116:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF512:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF399:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1055:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF1357:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1112:
+	.string	"__DECL_SIMD_log1pl "
+.LASF503:
+	.string	"__USE_XOPEN2K8"
+.LASF1040:
+	.string	"__DECL_SIMD_cosh "
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1039:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF944:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF838:
+	.string	"__need_NULL"
+.LASF839:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1573:
+	.string	"axisVar"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF433:
+	.string	"USE_PITOT_MS4525 "
+.LASF1261:
+	.string	"_Mdouble_ _Float32x"
+.LASF541:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF878:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF505:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF1224:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1572:
+	.string	"lastX"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF974:
+	.string	"__DECL_SIMD_powf32 "
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1438:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1105:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF990:
+	.string	"__DECL_SIMD_atan "
+.LASF1036:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1267:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF425:
+	.string	"USE_RANGEFINDER "
+.LASF1356:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1024:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF1444:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1007:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1491:
+	.string	"OWNER_SDCARD"
+.LASF1546:
+	.string	"gyro_align"
+.LASF1110:
+	.string	"__DECL_SIMD_log1p "
+.LASF1318:
+	.string	"_STRING_H 1"
+.LASF1182:
+	.string	"__DECL_SIMD_tanl "
+.LASF1037:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF453:
+	.string	"USE_LOG "
+.LASF1456:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1268:
+	.string	"__MATHDECL"
+.LASF1136:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF904:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1460:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1463:
+	.string	"signed char"
+.LASF1210:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF955:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1120:
+	.string	"__DECL_SIMD_atanh "
+.LASF460:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1586:
+	.string	"DEBUG_NONE"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF799:
+	.string	"__size_t__ "
+.LASF535:
+	.string	"__USE_XOPEN2K 1"
+.LASF1283:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1431:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1336:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF828:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1134:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1138:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1332:
+	.string	"sq(x) ((x)*(x))"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF426:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1271:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF489:
+	.string	"_FEATURES_H 1"
+.LASF1212:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF807:
+	.string	"_BSD_SIZE_T_ "
+.LASF1494:
+	.string	"OWNER_BEEPER"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF866:
+	.string	"USE_DASHBOARD"
+.LASF480:
+	.string	"USE_VTX_FFPV "
+.LASF1416:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1314:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1434:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1291:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1102:
+	.string	"__DECL_SIMD_log2l "
+.LASF810:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1201:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF450:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1421:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF894:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1253:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1333:
+	.string	"FAST_MATH "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1381:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1484:
+	.string	"OWNER_SERIAL"
+.LASF1163:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF906:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1298:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF396:
+	.string	"USE_I2C_PULLUP "
+.LASF1019:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF912:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF1511:
+	.string	"OWNER_PINIO"
+.LASF995:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF436:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1616:
+	.string	"input"
+.LASF956:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1078:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1510:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF841:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1317:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1305:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF913:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1405:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1562:
+	.string	"dynamicGyroNotchEnabled"
+.LASF1222:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1628:
+	.string	"filter"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF401:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF947:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1106:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1211:
+	.string	"__f32(x) x ##f32"
+.LASF1383:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1496:
+	.string	"OWNER_BARO"
+.LASF1287:
+	.string	"FP_ZERO 2"
+.LASF1454:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1425:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_expf16 "
+.LASF877:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF435:
+	.string	"USE_1WIRE_DS2482 "
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF873:
+	.string	"USE_PITOT_MS4525"
+.LASF1107:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1518:
+	.string	"RESOURCE_TIMER"
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF526:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF457:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF493:
+	.string	"__USE_ISOCXX11"
+.LASF1410:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1468:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF954:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1607:
+	.string	"DEBUG_IRLOCK"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1103:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF519:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1423:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF461:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1066:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1485:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1578:
+	.string	"axisMean"
+.LASF1524:
+	.string	"RESOURCE_I2C_SDA"
+.LASF1338:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1595:
+	.string	"DEBUG_VIBE"
+.LASF1605:
+	.string	"DEBUG_DYNAMIC_FILTER"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF792:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF791:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1067:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF874:
+	.string	"USE_PITOT_ADC"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1235:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1418:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1398:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1534:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1241:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF805:
+	.string	"__SIZE_T "
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1215:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1308:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1100:
+	.string	"__DECL_SIMD_log2 "
+.LASF1365:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1409:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1516:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1119:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF804:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1216:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1270:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1548:
+	.string	"gyroSync"
+.LASF1129:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF532:
+	.string	"__USE_POSIX2 1"
+.LASF1158:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF848:
+	.string	"USE_UART1 "
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF577:
+	.string	"__flexarr []"
+.LASF1218:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF518:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF970:
+	.string	"__DECL_SIMD_pow "
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1447:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF485:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1304:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1373:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1585:
+	.string	"debugMode"
+.LASF821:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1631:
+	.string	"gyroKalmanInitialize"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF456:
+	.string	"CMS_MENU_OSD "
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1403:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF529:
+	.string	"_POSIX_C_SOURCE"
+.LASF939:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1569:
+	.string	"gyroConfig_t"
+.LASF833:
+	.string	"__DEFINED_wchar_t "
+.LASF1486:
+	.string	"OWNER_TIMER"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF1316:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF415:
+	.string	"USE_PITOT "
+.LASF405:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF477:
+	.string	"USE_VTX_CONTROL "
+.LASF1469:
+	.string	"char"
+.LASF1273:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1096:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1627:
+	.string	"gyroKalmanInitAxis"
+.LASF1204:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1625:
+	.string	"errorMultiplier"
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1345:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1093:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF1010:
+	.string	"__DECL_SIMD_hypot "
+.LASF1226:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF801:
+	.string	"_SIZE_T "
+.LASF966:
+	.string	"__DECL_SIMD_expf128 "
+.LASF530:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF463:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF925:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1097:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF989:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1377:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1448:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1433:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1355:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF467:
+	.string	"USE_RX_MSP "
+.LASF1363:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1329:
+	.string	"true 1"
+.LASF927:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF429:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF981:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF967:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF1351:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1331:
+	.string	"__bool_true_false_are_defined 1"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1199:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF816:
+	.string	"__size_t "
+.LASF1320:
+	.string	"__need_NULL "
+.LASF1069:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1326:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1176:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1005:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF837:
+	.string	"NULL ((void *)0)"
+.LASF1543:
+	.string	"CW180_DEG_FLIP"
+.LASF1559:
+	.string	"dynamicGyroNotchRange"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1161:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1557:
+	.string	"gyro_stage2_lowpass_hz"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF400:
+	.string	"USE_SERIALRX_SBUS "
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1370:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1402:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1177:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1031:
+	.string	"__DECL_SIMD_exp10f "
+.LASF964:
+	.string	"__DECL_SIMD_expf32 "
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1522:
+	.string	"RESOURCE_EXTI"
+.LASF835:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1220:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF790:
+	.string	"_T_PTRDIFF "
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1187:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1130:
+	.string	"__DECL_SIMD_acosh "
+.LASF1186:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1513:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF1432:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF408:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1282:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1315:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1285:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1207:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF462:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1087:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF419:
+	.string	"USE_GYRO_KALMAN "
+.LASF1043:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1140:
+	.string	"__DECL_SIMD_erf "
+.LASF1301:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1538:
+	.string	"CW90_DEG"
+.LASF1342:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF538:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1545:
+	.string	"sensor_align_e"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1567:
+	.string	"kalman_sharpness"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1175:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF1419:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF980:
+	.string	"__DECL_SIMD_acos "
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1051:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1075:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF957:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1392:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF507:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF917:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF413:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1145:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1312:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1475:
+	.string	"double"
+.LASF1449:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1612:
+	.string	"sqrtf"
+.LASF1162:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF983:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1420:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1239:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1153:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1157:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF825:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1028:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF395:
+	.string	"I2C2_OVERCLOCK false"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF899:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1300:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1598:
+	.string	"DEBUG_SMARTAUDIO"
+.LASF1467:
+	.string	"__int32_t"
+.LASF1227:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1294:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF991:
+	.string	"__DECL_SIMD_atanf "
+.LASF1426:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF488:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1168:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF495:
+	.string	"__USE_POSIX2"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1415:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1065:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1552:
+	.string	"gyro_soft_lpf_hz"
+.LASF1443:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF458:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF1492:
+	.string	"OWNER_FLASH"
+.LASF982:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1255:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1617:
+	.string	"kalmanState"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF502:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1197:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1236:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF441:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1118:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF971:
+	.string	"__DECL_SIMD_powf "
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF822:
+	.string	"_T_WCHAR "
+.LASF1611:
+	.string	"DEBUG_COUNT"
+.LASF815:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1146:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1008:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1550:
+	.string	"pidProcessDenom"
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF786:
+	.string	"_STDDEF_H_ "
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1000:
+	.string	"__DECL_SIMD_asin "
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1591:
+	.string	"DEBUG_SBUS"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1269:
+	.string	"__MATHCALL"
+.LASF1094:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1247:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1502:
+	.string	"OWNER_TX"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF454:
+	.string	"USE_STATS "
+.LASF846:
+	.string	"USE_MAG "
+.LASF1509:
+	.string	"OWNER_AIRSPEED"
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1147:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1580:
+	.string	"inverseN"
+.LASF1581:
+	.string	"kalman_t"
+.LASF496:
+	.string	"__USE_POSIX199309"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1032:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1411:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF910:
+	.string	"__FAST_MATH__ 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF793:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF823:
+	.string	"__WCHAR_T "
+.LASF1558:
+	.string	"gyro_stage2_lowpass_type"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1049:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1439:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1011:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF945:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF794:
+	.string	"___int_ptrdiff_t_h "
+.LASF996:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1288:
+	.string	"FP_SUBNORMAL 3"
+.LASF1206:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1263:
+	.string	"_Mdouble_ _Float64x"
+.LASF890:
+	.string	"U_ID_1 1"
+.LASF889:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1089:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF975:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF941:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1191:
+	.string	"__HAVE_FLOAT128 1"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1596:
+	.string	"DEBUG_CRUISE"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF997:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF394:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF527:
+	.string	"_POSIX_SOURCE"
+.LASF1025:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1457:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF1021:
+	.string	"__DECL_SIMD_exp2f "
+.LASF481:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF937:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF486:
+	.string	"_STDINT_H 1"
+.LASF523:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1219:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1394:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF424:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1190:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF449:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF534:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF892:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1254:
+	.string	"_Mdouble_ _Float32"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF867:
+	.string	"USE_OLED_UG2864"
+.LASF1375:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1111:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1400:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF484:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF905:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF860:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1529:
+	.string	"RESOURCE_ADC_CH1"
+.LASF536:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1531:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1532:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1048:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF909:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF1159:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1476:
+	.string	"OWNER_FREE"
+.LASF1030:
+	.string	"__DECL_SIMD_exp10 "
+.LASF539:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1044:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1018:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1135:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF916:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF935:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF537:
+	.string	"_ATFILE_SOURCE"
+.LASF474:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF434:
+	.string	"USE_1WIRE "
+.LASF1151:
+	.string	"__DECL_SIMD_tanhf "
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1183:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1478:
+	.string	"OWNER_PWMINPUT"
+.LASF1208:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1035:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF978:
+	.string	"__DECL_SIMD_powf64x "
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1371:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF861:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF528:
+	.string	"_POSIX_SOURCE 1"
+.LASF992:
+	.string	"__DECL_SIMD_atanl "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1171:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1364:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1328:
+	.string	"bool _Bool"
+.LASF907:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1123:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1029:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1063:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF920:
+	.string	"__DECL_SIMD_cos "
+.LASF406:
+	.string	"USE_BLACKBOX "
+.LASF984:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1335:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1071:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF410:
+	.string	"USE_TELEMETRY "
+.LASF972:
+	.string	"__DECL_SIMD_powl "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF1414:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1154:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF438:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1549:
+	.string	"looptime"
+.LASF1396:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF862:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1257:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF885:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1264:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF812:
+	.string	"__DEFINED_size_t "
+.LASF1359:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1446:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF447:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1526:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1489:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1339:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF445:
+	.string	"USE_FRSKYOSD "
+.LASF870:
+	.string	"USE_RANGEFINDER"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF896:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF509:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1311:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF856:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1441:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1012:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF923:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1462:
+	.string	"long unsigned int"
+.LASF1499:
+	.string	"OWNER_LED_STRIP"
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF849:
+	.string	"USE_UART2 "
+.LASF514:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1384:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1080:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1600:
+	.string	"DEBUG_ITERM_RELAX"
+.LASF1341:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF942:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1321:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1225:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1610:
+	.string	"DEBUG_SDCARD"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1464:
+	.string	"short int"
+.LASF1597:
+	.string	"DEBUG_REM_FLIGHT_TIME"
+.LASF1574:
+	.string	"windex"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF1348:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1022:
+	.string	"__DECL_SIMD_exp2l "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF850:
+	.string	"USE_UART3 "
+.LASF1344:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1237:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1620:
+	.string	"squirt"
+.LASF1592:
+	.string	"DEBUG_FPORT"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF800:
+	.string	"__SIZE_T__ "
+.LASF1389:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF476:
+	.string	"USE_RCDEVICE "
+.LASF884:
+	.string	"USE_RCDEVICE"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF872:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1588:
+	.string	"DEBUG_AGL"
+.LASF1337:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1461:
+	.string	"unsigned int"
+.LASF851:
+	.string	"USE_UART4 "
+.LASF1014:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1179:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1284:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1582:
+	.string	"gyroConfig_System"
+.LASF914:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1081:
+	.string	"__DECL_SIMD_atan2f "
+.LASF940:
+	.string	"__DECL_SIMD_sincos "
+.LASF1152:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF464:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1397:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1483:
+	.string	"OWNER_ADC"
+.LASF1033:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF423:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF931:
+	.string	"__DECL_SIMD_sinf "
+.LASF466:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1083:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1427:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1618:
+	.string	"rate"
+.LASF23:
+	.string	"_LP64 1"
+.LASF852:
+	.string	"USE_UART5 "
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1521:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1228:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1172:
+	.string	"__DECL_SIMD_erfcl "
+.LASF868:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1376:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1539:
+	.string	"CW180_DEG"
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF898:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF797:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1386:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF525:
+	.string	"__USE_ISOC95 1"
+.LASF1299:
+	.string	"M_E 2.7182818284590452354"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1560:
+	.string	"dynamicGyroNotchQ"
+.LASF857:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1166:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1613:
+	.string	"constrainf"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF853:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1072:
+	.string	"__DECL_SIMD_cbrtl "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1656:
+	.string	"gyro.h"
+.LASF1690:
+	.string	"mathcalls-helper-functions.h"
+.LASF1682:
+	.string	"math.h"
+.LASF1674:
+	.string	"long-double.h"
+.LASF1692:
+	.string	"__locale_t.h"
+.LASF1664:
+	.string	"platform.h"
+.LASF1659:
+	.string	"mathcalls.h"
+.LASF1666:
+	.string	"target.h"
+.LASF1684:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1668:
+	.string	"libc-header-start.h"
+.LASF1694:
+	.string	"stdbool.h"
+.LASF1646:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1683:
+	.string	"math-vector.h"
+.LASF1704:
+	.string	"dma.h"
+.LASF1650:
+	.string	"stdint-intn.h"
+.LASF1653:
+	.string	"axis.h"
+.LASF1645:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1648:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1675:
+	.string	"stubs.h"
+.LASF1679:
+	.string	"wchar.h"
+.LASF1640:
+	.string	"src/main/target/SITL"
+.LASF1672:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1673:
+	.string	"cdefs.h"
+.LASF1644:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1701:
+	.string	"bus_i2c.h"
+.LASF1693:
+	.string	"strings.h"
+.LASF1670:
+	.string	"features-time64.h"
+.LASF1649:
+	.string	"types.h"
+.LASF1686:
+	.string	"floatn-common.h"
+.LASF1685:
+	.string	"floatn.h"
+.LASF1662:
+	.string	"kalman.c"
+.LASF1637:
+	.string	"src/main/drivers"
+.LASF1647:
+	.string	"/usr/include"
+.LASF1657:
+	.string	"kalman.h"
+.LASF1634:
+	.string	"src/main/build"
+.LASF1680:
+	.string	"sanity_check.h"
+.LASF1702:
+	.string	"rcc_types.h"
+.LASF1669:
+	.string	"features.h"
+.LASF1638:
+	.string	"src/main/flight"
+.LASF1677:
+	.string	"typesizes.h"
+.LASF1635:
+	.string	"src/main/common"
+.LASF1636:
+	.string	"src/main/config"
+.LASF1678:
+	.string	"time64.h"
+.LASF1651:
+	.string	"stdint-uintn.h"
+.LASF1641:
+	.string	"src/main/target"
+.LASF1700:
+	.string	"bus.h"
+.LASF1703:
+	.string	"bus_spi.h"
+.LASF1642:
+	.string	"src/main"
+.LASF1639:
+	.string	"src/main/sensors"
+.LASF1687:
+	.string	"flt-eval-method.h"
+.LASF1654:
+	.string	"resource.h"
+.LASF1696:
+	.string	"time.h"
+.LASF1655:
+	.string	"sensor.h"
+.LASF1658:
+	.string	"debug.h"
+.LASF0:
+	.string	"./src/main/flight/kalman.c"
+.LASF1699:
+	.string	"io_types.h"
+.LASF1689:
+	.string	"fp-fast.h"
+.LASF1665:
+	.string	"common.h"
+.LASF1660:
+	.string	"maths.h"
+.LASF1688:
+	.string	"fp-logb.h"
+.LASF1661:
+	.string	"string.h"
+.LASF1643:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1691:
+	.string	"locale_t.h"
+.LASF1667:
+	.string	"stdint.h"
+.LASF1698:
+	.string	"build_config.h"
+.LASF1652:
+	.string	"stddef.h"
+.LASF1676:
+	.string	"stubs-64.h"
+.LASF1695:
+	.string	"vector.h"
+.LASF1671:
+	.string	"wordsize.h"
+.LASF1681:
+	.string	"common_post.h"
+.LASF1697:
+	.string	"parameter_group.h"
+.LASF1663:
+	.string	"stdc-predef.h"
+.LASF1705:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`\004"
+	.string	"\255\003"
+	.string	"4\005\370"
+	.string	"\b"
+	.string	"\347\334\367\372\004\024\002"
+	.string	"\002\001\002\002\002\003"
+	.string	"\234\273\260\314\004$"
+	.string	"\002\003\337\216\212\307\007\002\002\002\002\004\004\240\342\234\212\n\005\201\264\371\346\013"
+	.string	"\006\007\226\253\270\262\r\036\b\341\247\305\343\016\b\002\005\002\005\002\002\002\006\002\007\002\b\002\002\002\004"
+	.string	"\r"
+	.ascii	"\274\"p1g\202y\r \312\256\357\305\n\2518\220Yjg\336\212\215\233"
+	.ascii	"\004\260;k\003X"
+	.text
+	.section	.gnu.lto_.ipa_sra.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375 |5\002"
+	.string	"D\002p"
+	.string	"\006"
+	.string	"\001\001"
+	.string	"\001\002\002\001\001\003\005\007\003"
+	.string	"\003\003\001"
+	.string	""
+	.string	""
+	.string	"\b\001\003\001"
+	.string	""
+	.string	""
+	.string	"\001\001"
+	.string	""
+	.string	"\001"
+	.string	"\r"
+	.string	"]\f)!\200R\027\303$\344\2502p6\271"
+	.ascii	"\242\302\321\\v\2635\234\377^\226\203A\033"
+	.text
+	.section	.gnu.lto_.inline.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`\273\001\005\f"
+	.string	"v\323A;P\245j\030\003\304\240\220\257\205\271\256\027\3040|U\350:/\n\270\027Wck\nz\264\002\317\244V\261\001[\317\275\231~\261m{\261F\352\200/\302\270\212\337\347\346&[J\231\002-"
+	.string	"0"
+	.string	"4"
+	.string	"\337x\206Rz%\361\323\323)\211c\002\020`,x8\037\177\353\364\277\\'\227\337\356^\376\223\007vw!_A\t`w1\217\235\037\001\222\365\255\263(^\340\342Rh4\020w\2563\231\0233'\317\316\256;\232\332\335\311y\235\233\334\335EOf\354n\302{\264A;E)\235\"\332P\310\311\001\"!\247K\t\224P$\204\377\350\310F"
+	.ascii	"\003\016\226\361\363p\363ZA\352\201\"y\021O\360\257\330]\213"
+	.ascii	"Ai\332]\312\222\253\203\255\277A\342\270r\001\277uo]*\212\304"
+	.ascii	"\361a\\\256F%\020\315tj%P8\373\017$\377\022o\264\305R\261\260"
+	.ascii	"3O\244JA\001\017g\230\313\216\325H\2432f.[\323\316M3 p\002!#"
+	.ascii	"\333\r~D\200\032PL\200D\341\261\230\n\360\200\274\b\211c\330"
+	.ascii	"p=\f\312\035\005[\252\275P^\263\2307p\"\320\236a_\345~p\346T"
+	.ascii	"\353\342\007\205|2\240\225\223 Gq\335\213!S\342\275bE\303QX\\"
+	.ascii	"\\0\241\215m6\270H\373n\007\332\030\200\343|#[P\271\334\331e"
+	.ascii	"\231g\335Nk\330\371\220\354l\277\027\315u\341\026\244\230n"
+	.text
+	.section	.gnu.lto_.jmpfuncs.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\205\005"
+	.string	"r\211\035%\200EI\007lnt"
+	.string	"9120\0030\304\372%l\343\202\331\020\036pC\t<\"\303B\365\217H#[&\031\351\322\244M\257\371\022\004\n\003Cd+\020DIT1=\307o\003.\016x\200\021\f\353\375\250\177T'\244i\035N\353(\"a\243\223@\275X\311\205\3515F\222ez\3263|K'r\242Y\240J\256\270\3445-\236\326\234\227\224\365\354\251\370#\027"
+	.ascii	"C\231h\331\202\004+\f\260d\207p\017\214\003\233\355\334\r\247"
+	.ascii	"nD \0033\0248\007\b\003j@\220E(\272\206FK\207\313\314\234\240"
+	.ascii	"3Z\315\333\221I\\\001\206"
+	.text
+	.section	.gnu.lto_.pureconst.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375 \027\271"
+	.string	""
+	.string	"\023"
+	.string	""
+	.string	""
+	.string	"\006"
+	.ascii	"\232\004\002\232\004\003\230\004\005\230\004\007\232\004\b\230"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"u\006"
+	.string	"R\312 )\200)I\007\233\341\220K\270\003\377\224\351\200\331<v-\033\341\020\356\2631@\334\r\257\002\035Y\302ZJ\232\265\255Y\"e\n\027\004\240\007\016\022\004\222\r&\256!b\235\363\004(\217\224\257\320\306\321\261\027\317x\251\034\0011N~\246r%QD\n\233\233\365\356\261\256.\2345U\251\366E\265\213\207\212cp`\230\327\217Rm\370R\2636\3162\256\371\217=G\247v\007!\345\217\362W \270rz\022\004\036"
+	.string	"y\013\3244sYBi\206\340\311\340\373J\303\r\301\030"
+	.ascii	"\226\340\344g\\\b\032\323\225\305\300\f\206\260`\017\305\245"
+	.ascii	"\006\232\217\243\235\030X\b4\202\206\261b@\032\202O\212`\244"
+	.ascii	"\022\037\325\344\346\236+\313\264\254\205\201\""
+	.text
+	.section	.gnu.lto_.lto.7cc09e41214c051e,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gyroKalmanInitAxis.25.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`\350\002\255\022"
+	.string	"\206!uG\320\224M:j\2616\326\036\350\221\235\276+D\332\322+\266\361\022\344\023K\354<\250\254\025a\330\303\275-Z\241T\325Bq\325\303q\317\315*\270\212\207l\220\006\210T\2468\270\334)\004\f\267hjM\032\331D\312\224\002\\"
+	.string	"U"
+	.string	"g"
+	.string	"\316L\337\2007\243@\220]\0175%k\024y\244\260}\317^\3710x\332\007\372\213\330\203n.`\227\207H\307.m\201\023t\217\246\335\204{\354N\200{t\3146r\032\212}`CG\210iw?=\361\3303\346\037\306Q\341\016\316\363\024aw\235\341\316\207[o\033\305\266\004[;\004~\214\313\210\361{\036=\363\312\207\217\376\213{\274\" \022$\313\232\037\342\224'@w\021\247\340+\265k8\344C\237\200\212c\023\020B6\223\330\264Y\252\t\373\333\356\256\225\307~\320\277\332\322\252-\355e:\225i\324\226\356\266\364I\323\\\246\343\226\336\266\264j\006j[\370\017\034C~H 9i\307\351I\271\250\334\205\373\350\021\17761|\307\212\244T\206\347\030\241bwW6\3537\002 1\231\210\330\324n\275\206\207\272\335]\361i\264\270"
+	.string	"@\352\271i\n\225\206\276tT\302h\r\241V;\222\263+CQ\335\364\240\317,kNU\215B`\222\246^g\211\rs!W\267\233\263\022^yi9hQQi\2202"
+	.ascii	"\346b#\343z\341\334J\241a\315\310\260b>\033\r0.\231\227\217\306"
+	.ascii	"\305\232\371Z\260\232/\345\200_\033\\`\237\315\353\005\373<\232"
+	.ascii	"\354\333*\217\243\013#\231\316\254R{\302\217<\224K\241\222\247"
+	.ascii	"\251R-\002\022\245\324Sm\002\223Z\244\324\246p ,\241Rw\026\016"
+	.ascii	"\245)}\023\3503\253\360\"\"\024\213.; \340\002\0211\242\007@"
+	.ascii	"\231\240$\264\375\016\234\005+S\222\207\300\017!\272\367rw\t"
+	.ascii	"p\361\b\033wE2\324j\354/\306v\026v\310\f\302\fx-\206$8\304\336"
+	.ascii	"mx\272\033\300\t|H\024v\302\214`\020\271\257l\336\343\261P\350"
+	.ascii	"\316\367;;\016\263(\235\273l\004m\234\240\230G\027\256\261p\227"
+	.ascii	"\270\016\206\036\216\327\3550hn/\345\320Q6\340%\230\035\361\273"
+	.ascii	"N\231ux\321f2"
+	.text
+	.section	.gnu.lto_gyroKalmanSetSetpoint.26.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`u"
+	.string	"-\n"
+	.string	"6\224I> \345*\035\007,\004\030\016(8d\020G>\201\255\035hj\230L\020K\330\204\016BQ\371\033N,\271%\275\217k\366~\f\bH\301\243\001\271&;\2010\330\362\221\255\034\377A6\331;\2456"
+	.string	"6"
+	.string	"6"
+	.string	"\017\342k\034\236\273\"-\270\335\321c\207\314\251E{\200\202G\001"
+	.string	"\230\215\300\356\326Ir\361R\364\257rML\346\272$\210\330]\313\230\f\344\236\267\335`{\302\276\003\277\224\322\377\fB:\273\335\217\235\201\315\321\227\023\333\337\330\234Y\235\322>\312S\304\217\276Y\263\033\243\303\355\256\307\022\231S\206w\276S\357\b\337)GV\245\264A\001\336\270\3157\216nwE\376\312YV\276\311\2513Z\362\261S\277\365\235&\224\314\344\374\274"
+	.string	"\330\201\227\334\271\343\022`e\001{t\3119b\337\333I\263?\376\336k\001$\026\030z\206(\215D\024\241\020\350s\2602i\200\236G\237\024\210:\201\027\225eQa:\225j\312\004\242\352(\\\325\317\202U\030\244\260\262T\252\260n\306\275\267\223f\n\223{\315\016{\323\016\n"
+	.ascii	"\006Td\342\021\320h\204\213\355%\b\327\304\262,\020\006\013\023"
+	.ascii	"\303\335X\264\223\f"
+	.text
+	.section	.gnu.lto_gyroKalmanInitialize.27.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`\230"
+	.string	"\215\b"
+	.string	"\322N780s\322\001\320z1\363y\221\037O\356\345.\242\f\306\372YKT\343\346[\207%HNPV4R7\0249+\024\024\024\251\006u\347<\250\372\023\213lT\262\311\226)\005\036\205N\232\251\244M\310\224D\004\251\004!O$\315$G\034J\206\020\274Q<p2\265m\234\004}{la+\356\274VP\003\346-\177q\321[&\253ai\270k\3454\001\372\223\253T(\316\356\352\3236\303?\224\034\331]\007\224\247X\370$\217\276P\351\347\243\257\312\036m\214\f\375t\302\006\364\\0c\263\332c\177\236\302\020\373\330\302\226\035\t:\fnv?~|\366\025cJl\037\344\316\3269\340\030\310\361p\361\354\256\204\"\357\256\235\177\223\013L\226w\005\020\355\256u\262@nx\333\n\266\027\354\213\002\024"
+	.string	"3\241\211(0\007\275\005\343N\214Ap\\'\310\n\020\003["
+	.ascii	"c\340\270#p\001\032\337\204\036\266\271\264\013\343*X\3612D\270"
+	.ascii	"\034\213v\222\001"
+	.text
+	.section	.gnu.lto_kalman_process.28.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`k\006\255!"
+	.string	"\226}\317H\260RN:\254z\254\350\246\027{W\360\242\356\306]\303\362\026\217y0\020_\350\316\237\303\030& \"4\032\231k\377#\206\213\377\314hk\377\202\366\0173?\034%1\237pv\331\376\356\377\377\377\317}\177[\263\204$)S\301"
+	.string	"\241"
+	.string	"\274"
+	.string	"\023\t\371#\206\206\251\016wQzV0\353\016\353vga&\342\250F\330tXrb\002N\247\254_\326\355\230\364\354\241\211\343\004\323\255\031W\316\346\234EJ:\002nGD\207\211#\314\374"
+	.string	"\364\360\240GoWq\230\350\334\234C\236\214\3159\005\230\001N\311]\216\236\256\255B\2751\245]\0334f\316,\260\2619\273\0048"
+	.ascii	"NIw\341l[k\250\215)\233\270\200\203.D\225\016^isN\036\220\326"
+	.ascii	"\330\224\034u\306\246\344[\350\224\216\337)\253~\351h\004\305"
+	.ascii	"Z\360\212J\307\022\3721\300\231\217).WVc\215\b\030A\375\322\375"
+	.ascii	"p\005\334\275%\230sz\203W$\324\244\332n`\373\311\266\261\b=;"
+	.ascii	"\203\212\231\330\263\362\230\342\322\200\233s\352\013%\255\033"
+	.ascii	"lJ\352i\264\204jC\327\241\002U\255\025\013}\350ZV\246U\355\232"
+	.ascii	"k\250(\231k\305\356\242\332\257\260u\234\317\262\025\207"
+	.string	"\252Q\221\206\251\211\264K\025\200\016\325C\252CUh\327A\273\006\332\365\317\256}v\335\263k\236]\357\354Zg\3279\273\306\331\365\315\256mv]\263k\232]\317\354Zf\3271\273\206\331\365\313\256]v\275\333u\313\256u\273f\331un\327\270]\337vm\3335\271\353q\327\337\365\356Z\007\034(o\216\314)b\355JAb.\363\021J\271\005s\227\307<G\255${9\314u\304\3124#/\327\242\226\260\350\273\273\374V\034\372\356\266b\211U\243(\267&*XK\313\355'\f\253\301\242\003\225\247\262\356-\177Y\211Et\226\353n\223Rr\345\316\362\233W\231\206\273\211\352\265\232\263J(w\234\262r\013\210{\016\224\222\254eH\203\350\032v\273\355DW\265\222+J\205\334\256=\314\204\344m\037\305\312\264\361B'OJ)\267t\207*\210\241\fuQ\345l\354D\333+4\036)\207\023\253\255\342\035\246"
+	.ascii	"r\257 Z\325\320\304x\0374.4\210\366\353\307o\261\304\002\356"
+	.ascii	"\232\367\372\177T+\267\200RJ\334\007>%\246&(\246_\223\224\003"
+	.ascii	"\337\223\317\247\364\022\205\244 \367SZ\362\035\375l?)('&\322"
+	.ascii	"=\nI\b\220\n\024 `$\243\364;\372A\3209\311\310\351\350B\323\221"
+	.ascii	"\005\336\257\302\022S\023\005\236\023\323\321\005^\222/\212g"
+	.ascii	"\264\343'(%\037\357\367\364\344\343\351\272\246\216\363Y?\227"
+	.ascii	"\240\242\352@\357\360H\320\321\200\216\363 \256\035\240\277X"
+	.ascii	"n\001\313~\242\370\234\347?=\337\271\317G)%\027\317\215\336s"
+	.ascii	"\022\n\317i\264\204Evn'\351\223b\020M\3478\337!\3139\316u\260"
+	.ascii	"\224\324,g\207DnNs\034,\233\327\374\3466\265\222\253\211\315"
+	.ascii	"u\250\265\244\305\232\0330\0232\351\022\232\017\231\t\365KY\206"
+	.ascii	"@\306\231\333\0264\211\215\314g\376s\250q0\345\bd\250\244DR\220"
+	.ascii	"\024\024\322\030\240\002\021\261*z\021\2001D3\"\201\210(\316"
+	.ascii	"Lk\310\260\314\376&5\275\364ZJ\032\337\027L\324)=\327\253z\002"
+	.ascii	"0\335=R\\@\021\224\004+\351\246\rf-\370s&\334B\320\256sP\362"
+	.ascii	"\373\0252D\265\254\245\235Z\252#QAk\315\210\2162\254\222\020"
+	.ascii	"\344\200H\206\341'g%%\270\365y\254\332\245gs\007v\351\270\334"
+	.ascii	"\3268\n\002C\007\342\331\314\224\347\233\374\216\360-6g\317\274"
+	.ascii	"\241\023\360+\005\034t\374\227\331N\264\256\211\377:\035\373"
+	.ascii	"GX\207\235N\033N\031\307\030%\305\276P\234.\301\004.\201Cs?\b"
+	.ascii	"\363vh\226R\206\2224\003hN\200\231n\342\315 \\\273 \001@A\366"
+	.ascii	"\244\274U\266`U\247\210p\347\0012C\005\017a\217a\343\266\030"
+	.ascii	"\006WRL\312#~\374\267\004\347\024}\251\001"
+	.text
+	.section	.gnu.lto_updateAxisVariance.29.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`\320\005- "
+	.string	"\246\370\304I\240\326Q:$\026\301\342\310\340\270\342k\270\304\307\354\356\241\250//\260\017Mt\306\221g\357\250N\261'\327\232f\002\004\313\017\216\267\303\226\257\361-\3701W\312ym\372\220\241{\005\302\232\303\300\026h[\304\377\204\020\271S\n\255"
+	.string	"\237"
+	.string	"\271"
+	.string	"\277\375g\375\350\032\333\f\243\317 \026\"\030j/mQC\366\021\0225'\026\001\2048\304\272\324Z\023\274\264\005\333T\f\321\342\2134\035\313\247gj\205BF\253\326\032\344\n\265\227?\244\r8tj\177\310\257\232N4q\235Z\243\244h\325Z\f2\202\332K\027\017\300|Y;\217\371\322M6\227\027\247*\rG\020\024Y`j\255\271\315\361\246\233%\271\264\311\247I\020\016\235n\322\fc\274$\201\200\230u\335\f\203\344"
+	.string	"\343\t\035'(\371\342{3|\"\177j\255?\236\246\030\002)\245I\250\265\232\n\207-n\332m\027\331\366`\227f\001\273eA(\340\321O\237\27372=k\273\304\227\370$0Uk}`\203\270\222\244\227\267\251\006T5\276t\217\242\214\275\364$\274!\037\211\005\246Z\255\365<^\372&\314\227_\005T\304\037=35\206\271R\251\030\273\350DW\312>Y7\312\246\324@>7\336\270c\375='\376\002(\365\215R\363P\352\035J\255C\251s(5\016\245\276\241\3246JmSR\327\220\3244$\365\fI]\243\3244JmR\352\222R\223\224zKjJR\377"
+	.string	"\255\313\n\256J\255+\316\306\324\257r\253\307\215\001B\262\234\265\255\316\232eA+ \207o\361\231\263\317\022#\n\301Y-7K[\234\335\2610\237\021\302\262\004\205\335l\004\261\255\037\266\005\363i\263\344\332\252\200\364\354\303\261\370\204pE\310f!Pm\321l\315\027\315\336x\364A\256\324y\246W"
+	.string	"\002a_l\2166h\255\325iWjfk\333\301H\225'jf[\367)\274\231\r\022#\322\250m\024\336\205d\347\231\337\332nV\020\nx\234\341\323\345\323"
+	.ascii	"\321\271\034P\311\200a.mw,\b"
+	.string	"\265{\023soT\304\237\013\037\334\372,\035\013Z\001\217C\334\336\370\237\037\025\343r{\026\267\367\nV\031\235I\271\177\"v\266K\006>\245]\322\016i\302\216HIw\324\323\215\300\361\365\216D\360\230\314\235O\327#=TD\364\240\003\003\006\013\204vv>\235\357B\215\211\204\224tIH:\0209\337\007\243#\244\242\234\322\221.)G\324c\312\t\341\274\024b\327\313\371\226\226z\271\232b=\371\215r\203$\344~]A\225@{\333\024\024\236|\375\026h\236\2651\274\214\202\t\311~\347w`\035\277\252M\326\372+p[\236\3351\256\333\376\310/\334\370Q1\244y\243\0314\320\013\201\366^n<\255\323\357\244J\207Vy\332\246\005v\326fe\204\n=6\331Y{\303\273p\341\354\316\232`A+\340\225\316\332F\347\342\3636\345\025q\250A0h\215CC$\"R\220$\205\026\003\200\002\0311#;\021"
+	.string	"E\310\334\210H\212\223d\032\003io\351QG\253U\230\247\2269\tB\246\261\265>\227\377N\250h\246\336m<\376Q\b\037[\200\371\310o\236\260|\353\001r`\035 \233\254\337\202\334\224\034P\254\301\027\325\255b\240\214\\\221;\037\371\020=%a\031\335@\261\261\254\032\365\036\030\365\246u\333f\004\016\332\273\326\306\3303\020vT\204\r\265\177p\230<\b\340)Xs\337~\306\314\354\227"
+	.ascii	"\367\256Q\b\013\013\330\352\320\002\366\204\374p<\b~\036m\221"
+	.ascii	"-Y\272\261\021Go\245Bn\214aZ\316\315d\331\245T\314Sp\233\360"
+	.ascii	"\022\207^\027\333hi\230\025\321P\2042z\324\236\274\361\n&X\006"
+	.ascii	"\232\300B*\235\215\320,i\334\340\023\252\")T[A1fY\347\346\275"
+	.ascii	"?"
+	.text
+	.section	.gnu.lto_gyroKalmanUpdate.30.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`$\002\365\022"
+	.string	"\346c}H\320\362&\035*\3748\314\002\\\206u\337\">\201,\326\341\347\305\r\33182<\030\240\347=\005\030\277\003\247\365u\017\025\2760\331\\ql2\261\323~\301N\021{\340CU1b&\256l;R\265A|d\311\336R\246\024f"
+	.string	"_"
+	.string	"j"
+	.ascii	"#\227%P\237\252\275\262\300v\242\034\357\234>4\220\346\334\251"
+	.ascii	"8e\344\322\266\377\3420lv\030wAC\357!\225;\252\232s~\256\243"
+	.ascii	"x\227\361\002\274\313Mq\333\343\252\315\177\321\243\013\023M"
+	.string	"\240\356\366\330\363\215)>L=&\272\235\210\362\204\342\307\213\256 t:\252,\006sN+\250\023q\313\333~`\333\201\255\271\322\032jz\360\322\257y\227\272*\340\b\222\375\312\251\\\021\234^Yg4AM\025b\357n\272@\366\343\334\037{\325'\337\375\255\023\375$\253f\251\332[\265\\u\224\352\215jU\365\001\260\252\236\022P\315\031\342j\310t\222I+l\333\354\226]\"\365\255~\347\320$s.1!\3159U\334 <p\341\255<`gN\234\202\270r\017\020\341i\241\243W\266a\017\035^\251\005\307\354\341\215\270W\022\":\213\023S\205\374*@\037\247] \027x\216\267+c\344cG\255\354\327\270\215\034\177\310\261\030=\030\263\004\204Hl.H\211\266V\327\226\315\350A\273>\354\315\276\f\016\032\005\332\366\360\243\331\0274\347t1z\f\232?\3648\033ljd\322-21\227\013,,+\257"
+	.string	"5Y\007Xt\354U\003\233\321\300f>\234\f\030d42_\215\f6\373b7\265\357\205\3004\233\230\233\017\207F\273\371Z\273\371\3759Y\027nul@Y\013!\202\036<Y\027\317\336\274\344pD\351;$Lxy\361.Yk\"\224D\305*\261\321[\035\024^Q~\322sT\260"
+	.ascii	"\003\343]\036\004\"\327[o\212'* `\002\231\241\302\007\006*\362"
+	.ascii	"\320\334\307m\024\346Q\206r\363\007\351\300\222\371\236\373\345"
+	.ascii	"\341K\313\260^\342\365\341\233\b\270\n\201\030\267\234FM;\303"
+	.ascii	"\330\260\001,lGi\335\315\2026\256\306R>\263a\275\007\036\254"
+	.ascii	"\037\357\325\311\022\254\221\251\214\035\024\n\373p\037\241\271"
+	.ascii	"\341\240~\234\035\303\024{g\264ni\212F\241"
+	.text
+	.section	.gnu.lto_.symbol_nodes.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`h"
+	.string	"\315\005"
+	.string	"\202H )\200k:\034\216*\027V8\222\201\207a&\"Aw\341\031\200\214h\021\271B\302\272\211\210\210p\370\346\324-Jb\267\275S\n\016D\022\374|\022$d~\211\247\323M\021<\346\263qh#\224\234\177C\231t\203\007\035\002\303M\023\2322\276\273\366\366\311t;\266\210\227\302R\355U\212M\222\322\353\220\213\244\242\3557\327\202P\353\0354\343\f\\\264\r\3309\267b\253\255\211\034\332\335-h\365l\377\021\026"
+	.string	"\256\254\ra,\227\202[E`\021T\036\206\001\352\341\003\304\360K\205F0\\>\2259\213Y\255\013_\006t"
+	.ascii	"\207\340\r\340\006\020|\257\016\002t\214\004\352\t"
+	.text
+	.section	.gnu.lto_.refs.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375 =\351\001"
+	.string	"9"
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"\001\004"
+	.string	""
+	.string	"\001\020"
+	.string	""
+	.string	"\001\026"
+	.string	"\001\003\001\004\003"
+	.string	"\003\005\002\006\002"
+	.string	"\002\006\004"
+	.string	"\002\006\006"
+	.string	"\005\b\002\006\003"
+	.string	""
+	.string	"\t\006"
+	.string	""
+	.string	"\006\t"
+	.string	"\001\n\f"
+	.string	""
+	.string	"\004\017"
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.7cc09e41214c051e,"e",@progbits
+	.string	"(\265/\375`W\031\215v"
+	.ascii	":\310\370+R0\322\272I\007,z\323U\nI\343\205\r^\215\234\340\250"
+	.ascii	"\3701>\024>W\034\341=\352C\311Wt\244\205\267\203\236\326\372"
+	.ascii	"\361\363\240d\363\266\215\365\207\003\317\034\034\314\335\334"
+	.ascii	"\325\243j\004\301\334\317\265\350\245\237\001\300\200\271kr\340"
+	.ascii	"\301\232}\202\310\2262\005Y\002\263\002\260\002a\324\276\302"
+	.ascii	"~\370\201\374\002\246J\236\276\321B\026\242\257\032\007\363\351"
+	.ascii	"\034\254\247\207|\247\253\030O\323\300{\330\016\367\341!\030"
+	.ascii	"\256/\3075\261\203\254l+~;\327\341 n&\357\035\336{\317Y\264\204"
+	.ascii	"\235A\323\225%\r\017V\314zX\346\332\212\201\340e\025+Z.U[\271"
+	.ascii	"7A\226g\334\200\344\332\210 \305\214\241\202\374\362\347\326"
+	.ascii	" i\343\303\2202f\230XIZ\001s\003\224\205K\310\222\317\322\330"
+	.ascii	"K\221\360\350\016\253\300\220\022\264\025\253a/5\211f\257\256"
+	.ascii	"(Y\336\233D[c\262\242\340\321\255j[\202\2747y\016\363\347\376"
+	.ascii	"\025,\332\212\3310YM\"oU[\232\003Wqj\306\300\335\233t\240\204"
+	.ascii	"\003\265\353jN\226\b\314F\341\206\351p\033\036=8\332|\035c9\016"
+	.ascii	"\313a%\317\371\031\016\207\335\0343^\345\275I\021U\350c\355\254"
+	.ascii	"\3153\212\323\210Q\234\257]\254Y\225\330\327\243}\335\262\257"
+	.ascii	"8\354\353\265/k:\366\215\306\276\321\354{\314\276\221\366\275"
+	.ascii	"e\337\327\236\341X\024dl\004c\366\234\304\036\215\263\354\311"
+	.ascii	"\310`\317\366\263G\313\235\345-\314\205\225'\270\313\271\214"
+	.ascii	"\263\374G\230\274\311V\302G\313\2256\337\202=\2378k\\\034\237"
+	.ascii	"8O\202m\036q\0361\211\223\305x\214\225&\030\313W\260x\r\216]"
+	.ascii	"\260{\223F\"\372P\3513D\233\367\300\022-\375\027\200\315e\361"
+	.ascii	"#{6qr\034\2338\3376\211G\234IL\342d\260\023\225\250\303x\313"
+	.ascii	"\356M\"\331!\030.`m>\311$N\313#\316\237\255\224<\256\374<5\366"
+	.ascii	"\003^\300_M4\021\373\231\005/\375\334\300\317)~v\3613\212\237"
+	.ascii	"K\374\fA\362\002\374\335\3663\005T\302$\3709w\243\277\032\375"
+	.ascii	"\f\305\033\364\360\240\277\343\260\374\375\366s\213\237\225\370"
+	.ascii	"g\025?\233?;\360\363\212\237'\370\371\001<`?\027\251\202\302"
+	.ascii	"\177\006^\342\357\264\237\277~v\362\263\221\237y\374\\\374y\307"
+	.ascii	"\317W?\317\360\263\215\237i\374\f\303\317.\374\034\365\263\b"
+	.ascii	"?c\360\363\t?\227\360\263\005\377\261\374\357\362\363\b\377c"
+	.ascii	"\374\314\301\317\032\374\234\301\317\027\374\207\361\363\320"
+	.ascii	"\177\260\377I\377\317\374\007\212\213\213\213\373\233\205\337"
+	.ascii	"\314\361\217p\nm\332\330)\002\342\345\244K\233\367?lE\242\362"
+	.ascii	"\030\314\340\2305<\342@T\036op\330\025D*\336c\220\250\274\027"
+	.ascii	"\351\016\207\301\r\214\027\211\250\274Y\367\006\233,\276\311"
+	.ascii	"c\360\016\215\027\351\016\2570\2118<f\021\225\302,$\242"
+	.string	"\362\230u\225\307{t\207\302\"\216\341-\"]\345\361\355*\215YGD\2451\213\250<\002\341<\304:=\262\324\264\341\n\3434\342\360\356\300\n\",\036\261\021\223\306\353v/\227Y\335\242\002\367\0061\026\335\20480Z\025\333\216\252.B#'\357\275\004`Uq\031\357\220\215\350e\274\327\253*\352\336\245`\222\355\"a\266\240\016A\256\016\253{\013\300\2727\310\227\355\336\033\274\367\002\025\203$\357\375qDDba\335\253U\002\353\006\t\246Y\335\333ep\320\262\210J.c.\215L\211\274W\311 #\257\333\261h\225A\261\253#\b\213\314\262\241N\233\311!\264!Zz\264\331_D\210Q\273\363\303\315\016\301Yz\243\261\262\321\032\313\007Y\226s\246\300\335\242\326\003\247\233\332\023a\2243\263\242*&z\260\264\3716k-\355\345\352\301\263\243\315\336\322\\Xy\265\356\0224L^%#\031\023D\322ei"
+	.string	"]\355\354\316\222{\227!\340E-\255M 2,\"t\210\271A\006\313\337WZ\331`\325\214\022\212\2176\317\034\3065^c&\214\222>\260t\020K\206am\021\333|'\377\266\302_Z\315\333\020\2706\211x\304\311e\271wXE\023c\265\247\315\277{"
+	.string	"\003\252\2224#l\263J\t\n\230\254\321j\363?El\016\\\212<\326r\\Z\220a;\334\254\004)\3236\370\350-!\2320\"^\220\271\343\026c\227\345\337\310\226\322I\272\253\2514\224F\322K:J3i%\355\325N\372\253\237\364\224\346\201\225\335\244\213\274\215\364\016`G~X\n9\353b\326\317\230\255\214\221Q\322,\303\2324\020\366\302lG2"
+	.string	"3\243C\031\332\0203\344\275\267\261\232t\r?+\n\272\227\214\032$X7\351\037\275U4L\336\340\t\004\022\216\023\270{o\2117y\206\370X\300\374\317\225\355*6&q&\201\375\\{\263\217\275\271\307\336\324co\302\331\233x\354\315\245\2759\307\336\214co\266\2617\327\354\315/\366\275\365w\217\276\341gm\034\240\350m\b=B\264\3318\344\336Z#\316\242V\362\032\r\321\200\206I\2346k\334\025\313\3672\211\363\350J\2617\273l\222\321\344\2627\177\330$d\353h\253\037\265\345\222.`d\246 slI\226\001P\310\340\226\274:ymR\327\204\340c\207IE\356\361\"\345\207#\366\265\313|\322d\213\214-r\202h\215\314\313\254*\251I*\022K\304\022y-\265\332_{\274\376\350Q\215T7D78vk"
+	.ascii	":+sD\302]\242\026\212n\222\307\213L\016\257F^\213\254`q9vJ\024"
+	.ascii	"7\3026\253\016\257\\Zk_\226\307\312\365\007\t=)\242\224\322\346"
+	.ascii	"\355\265O\3611\037YYmV\343\345x\311\321\361\326f%r5\"\2557p;"
+	.ascii	"\324!5\rW[U\233\025H\r\302\312\237\251B^\364\345J\313\231<\366"
+	.ascii	"3\360\317\234U\353u\353\017\262^T\240\324\261c\253\217W"
+	.string	"\034\376\240\006\320\262\330\304\261\2577\370`\205\222,\275\362`e\345\321f\017\032^!\023\244\371e\206fL\215\025\212\262\364Zde-2\031\217\335\032\204\256n\237\037p\367\222y\300\344C\307\r\222*\226(L\305\361\232\243\342\250;\332\344 \331\006\036ki\025\353u\307\231\320\026Z\221'mV\0354$\261\"\240\324\340kU\r\326\2539zL\243X\017&\325\352\365\352\354\203\032\3004i\263\336\b\022\002D\237\333f\035\376\314\310L\314MI\025\002\261\"\370\354y\367\331\323q@X1gh\262\334y\307\375\260\361\352\342\003de\207\352,\275\365\260\262\365t\262\304\321\275]eKK6\206\316\017|l\321\215 \336w\202h8{t\253\342\244Y^--\024C[\332\264\334 \304\033\216\357X\201\235\265\331x\230\254\267\2228\226v\336X\242<q\336s\342\364\333\r\276-I1\316\231\002\267|\277\021\371"
+	.ascii	"\344\206\2316\233N\2739\367,i\240\3633\206bFe\213\2340\326\346"
+	.ascii	"Xz\3039+\033N\2031\307np\210k\013\221>p\367j=`\207C\326\206c"
+	.ascii	"\266\350\310R\253\265\230\367\230w\333\230vc\255\013\276\266"
+	.ascii	",\257V\021\305\337o\336n\237Ct\0178y\020\301\bi\363w\332\315"
+	.ascii	"\303\244\231\rq\343\003X\037\037U\212\250dq\362\244Me\267\351"
+	.ascii	"\"A|\2169\342\332|\257i6\177\320\317\022-X\352\264\371\223\212"
+	.ascii	"}\263\375\017*\372\202D\252i\263\325X\253\323\311\t\333\265\344"
+	.ascii	"\313\252\315\267\232\277\315p\231N\323\302"
+	.string	"I\034\036\275\332l4\275\366N\323gn\247Y2\336+\3544F{\356\025\0321'\300\234\200\371\305\305d\313i\376\\bO\036q6\231\334\273\214[V\332\rm\376\234?\354\373?\257\260x\357\345\361\223\274hUD\347\037\026\301\225\025\370o\336\212B\362\006\003\251\316\307{\372\351\371\244\244|MO\275\235\356\227\002{\276&\241G\251"
+	.ascii	"\362x\272\246\250T'\245\004Lw2\224\250zP)hP\365v\274\024K-\230"
+	.ascii	"Z\270\240\241\324\204N\001\223zO@"
+	.string	"/T\364S\372\203\001\330\333\375R\240\022\352D\305k\352\355\224~@*%\001x<\252^\217\t\265\261\003\236O:\224g\316\360\375\242R_\017(E\201R\250\324\371\363(\025JN\274\035\225\f\002P'\037\f(*\031\250SP\nGSLE\250\215\035O\267\013\240\204\024\005\332\264\267\363M\245h\214\024\215AB\0054\3259MQ\001 \205\246\300\0321\220P\033;\373\024\250{\"\341\374\351\242\232L\340\216\206\006\351\256\007B\bo\332\375\320\036\ne\277\324\"E\013\0274\200\356\242\202\b*\210\340\274\213\nr\271\nZ\344\354[\344j\372&4\325\235\200\246\2724\306\017My\273\016H\244L+$H{;\240\364Q\006\314\340\023\006\376\361\024\277\3004\230\205\024\250\343\375\240\f\344\237N\005 \032\250So7\343\234\341s\352\355V@\233z\272\335O\027C\221\024U\214\241\236\016\205a\177:\025\244\250b"
+	.string	"w4tB#\240\300\037\032Cog\037\245B\tx\337\024\372SJ}\276\237\322\020\220\tj\367\324\363\275 B\231~>`\017\005\026\365\240v<\035\223\220\023\317\027\005D\177Q(\364|\273T\367\223\261\343\351^\244=T\n\215\301\007#\251\251W#\006*\265K\247|>\236\225\362\365\320\r\200@\264\311\367+\301i7e\3644\305\2636\242\216\236\246xL\351\223\017\b"
+	.string	"\n\244b\362\245C6\242D<=\371R\252&\246\036\222\215(\001\320\251\032)\023\020\250\233\232\341\3431\255@\241t)\220\311\367\253\001U\002\205\352\351N0\001\311\306\007\275\035\214\001~(\260\006O\327\323\240D\332\243\362\275\210jJ}#\370~5<h\332I\351z5\234H\3000\303\246L-r\026\bD{S?]\024\220\351(er\221\366vT@o\361\324\344B\306\322\322\n\025"
+	.string	"\234\002\n^$\2450\202\007\266I\205R\032\005\265\343=)\365v:)\245\246\037PIE\001N(O\206\256\307AO'\305\323\275 \002K\275b#it|P2Y\267\255\351\250\272\362&\004\207\343\310\217\261\352\204\250\316\232$P\332\374YM\212\035\021\301\261\343\245\254\315\007Y\331\277Z\251_BnK\336D\ts+\352:\212\361\322C\203\351!\202pC\300\252\0216+qH\332$\352\341\365\032\305\253~\035"
+	.string	"&\270C\024\024DUe\216gT^\277\376(W\344\244\265Y\247\374\354G\254H\032\2336\253\024(lv\250\317\221W\036\216T'\275\214\221\207\013m\312)\026\201\352\250\221<g\224#2\"#\"2\222&\351\021\005\304(\007\245<n\022\3004=NJ\250\206Dd$E\005\311^k\t"
+	.ascii	"\315*\3367}\375+\343\f\317{<N[\355_\230\317h\274s\b\316\260v"
+	.ascii	"h\263\367\263\240h\034\017\245\366\250\342\n\263\335\251\207"
+	.ascii	"2\345K\302\301"
+	.string	"\"X\260W\331PD\331|\033\2150\237Y\333\260?\032\360\t\221m3\220\235x\343i\274\330\374\325c\311\004\344\325\336\022\032\204=\222\351\034\206BK'\2276Ic\266\232\337:\342 \255\213\214I\364\226\337\374\275\225\020>\007\005jm\356+\007\207\220\222\315=\233\r\314\320;\247T,\224A\005\006C\373\254M\037j\263R\270\353\257\003t\374\032\034\250H\215\232\203D\301z\254\315|\240\020\240\003\212\222\n\f\246QL\3125\213$Lrc\227\3073\021\232`\353u\217C2\325\342)sVqEB\304H\234\342\221\f\006\354\307\333r\222\210\341R\255\002z\241\024\2134\3057\026\033\326X\177\366\030\243p\363l[\226\362\033\344\302\027\017\230\336\025\237s|\221\255\r%\335\273\036p\237\205\22420\177\260J\305\215\020\306\334\364\035k\351*\344\215\005\027\366\246\003/D\003I)\025r\301\331\372\342\321\312\207\302"
+	.string	""
+	.string	"\004\203\306\027\326\255b\021F\316\315\246\275\376u\212\033\340\204\270\021\020\224\205n\270CL\220\374\217\334^\244\207Nzc*\277\265\320*\261\260\232\0024\f\260k\241\002\276\030\240a\001\213U\371\355pS\3009lN\025\367\n8\207\204\266|]\"|\275\236sNZj\213\036E\270\341\313\364\374g9\200\236\032\207t\244!p\266x\305\t\032[\244\370u\355c\377\3465\325\030\\\352\235\207\213\232\002D\337\263I"
+	.string	"\2305\270\213\235\266\231\326/\251\231\372C\203%\233Y\325\230\323sz\265\024R\303\363}\222\3222*E\235\327\f\347\343J\260d\301\350\025\321\361\242\036\202\333s26\272\337\216\300:\360\262q\017q\361\367\335Am\331\344\334\353\214|\013/\215\224\370\303m\230\356\257\037 \205#\255\227\315;\302&E\236\353\275N\252\\\300\363\b\350\333\363Eh\016\024\237\207\304\205wT\342%\240.yd$\242\245^\252o\354\236\214\256\375\262\213~$\311\266\325\210\376\255\316\257\325\323\247\351&\036S\315p\333\"\247\352\215AC\203cu\343\250\024\336\235[\277T\363\225\343\351f\354\211\001\231i\366f\005pY\013\025iKP\177\324R\334\337\2159\274\314\376\034\224k\302FA\303}[\370\265\007\302p.\201%\253$\0021a&\0016U\312\223\316\003A"
+	.string	"r\nw\021$D\254\341\267\325\240\037\205\377\247ad\r\341y\020B\026\2461\252\206\206~#\325(\005\330W8\277\263\b\315\250\232n\336Vx\225\320$\255\262\021&\325\340\316\274\356\206\343\306kC=@\275AJ\220)\301\037\202\370{\211A-\223\316\342\323\331P^TlGGL  ),\342z#\270\242\037\030\037\202u\n\303cL\302\256\317b\t\020;\365\236 \216A\311\r\365\005\217|\013\364\340\b:\323\207\243i\226\031\300\2351284\224\300v\373\0202\300X\242\r\364\302\370n\335\354\272\276\351\300\360\312\323,\326o\260\376ux\017\344.\001\177=\316\036\267D\301q\366\337\332I\352\003\020\016\200\235i|6s\032\370l\235\207>\314\f\360\021H\307"
+	.string	"_\375\323\222\377\356|y\241q\272\025\267\211\345\352jm\276\370Y\330"
+	.ascii	"v\237\302v\271\037I\331e\177\237\037\335f\221A\275\202U\277\226"
+	.ascii	"A=\2031\267*"
+	.text
+	.section	.gnu.lto_.symtab.7cc09e41214c051e,"e",@progbits
+	.string	"gyroKalmanSetSetpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\001"
+	.string	""
+	.string	"setPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\001"
+	.string	""
+	.string	"gyroKalmanInitialize"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\001"
+	.string	""
+	.string	"kalmanFilterStateRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\001"
+	.string	""
+	.string	"kalman_process"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\001"
+	.string	""
+	.string	"gyroKalmanUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\001"
+	.string	""
+	.string	"gyroConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\001"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\001"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.7cc09e41214c051e,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
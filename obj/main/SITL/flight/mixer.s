@@ -0,0 +1,16208 @@
+	.file	"mixer.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/common/global_functions.h"
+	.file 7 "./src/main/flight/mixer.h"
+	.file 8 "./src/main/drivers/pwm_mapping.h"
+	.file 9 "./src/main/drivers/adc.h"
+	.file 10 "./src/main/fc/config.h"
+	.file 11 "./src/main/fc/rc_controls.h"
+	.file 12 "./src/main/fc/rc_modes.h"
+	.file 13 "./src/main/fc/runtime_config.h"
+	.file 14 "./src/main/flight/pid.h"
+	.file 15 "./src/main/navigation/navigation.h"
+	.file 16 "./src/main/flight/mixer.c"
+	.file 17 "./src/main/flight/failsafe.h"
+	.file 18 "./src/main/sensors/battery.h"
+	.file 19 "./src/main/common/maths.h"
+	.file 20 "./src/main/drivers/pwm_output.h"
+	.file 21 "./src/main/drivers/time.h"
+	.file 22 "./src/main/config/feature.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	mixer.c.966f03f5
+	.weak	mixer.c.966f03f5
+mixer.c.966f03f5:
+	.long	0x1586
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x27
+	.long	.LASF2127
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1662
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1663
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1664
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1665
+	.uleb128 0x5
+	.long	.LASF1667
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1666
+	.uleb128 0x5
+	.long	.LASF1668
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1669
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1670
+	.uleb128 0x5
+	.long	.LASF1671
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1672
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1673
+	.uleb128 0x5
+	.long	.LASF1674
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x29
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1675
+	.uleb128 0x5
+	.long	.LASF1676
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1677
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x5
+	.long	.LASF1678
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1679
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0xd
+	.long	0xcf
+	.uleb128 0x5
+	.long	.LASF1680
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x5
+	.long	.LASF1681
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x5
+	.long	.LASF1682
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x132
+	.uleb128 0x4
+	.long	.LASF1683
+	.value	0xfff
+	.uleb128 0x4
+	.long	.LASF1684
+	.value	0xf000
+	.uleb128 0x4
+	.long	.LASF1685
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1686
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1687
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1688
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x13e
+	.uleb128 0x20
+	.long	0x149
+	.uleb128 0xa
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2a
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x168
+	.uleb128 0x21
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x21
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x168
+	.byte	0
+	.uleb128 0xe
+	.long	0x132
+	.uleb128 0x12
+	.long	.LASF1723
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1c8
+	.uleb128 0x15
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0xf8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1689
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1c8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1c8
+	.byte	0x10
+	.uleb128 0x15
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1cd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x149
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0xc3
+	.uleb128 0xe
+	.long	0x1c8
+	.uleb128 0x5
+	.long	.LASF1693
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x16d
+	.uleb128 0xd
+	.long	0x1d2
+	.uleb128 0x5
+	.long	.LASF1694
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe0
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1695
+	.uleb128 0xd
+	.long	0x1ef
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x1f
+	.long	0x249
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0xa
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x6
+	.byte	0x2d
+	.long	0x27f
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x40
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1714
+	.byte	0x6
+	.byte	0x45
+	.byte	0x11
+	.long	0xec
+	.uleb128 0x13
+	.long	0x7c
+	.long	0x29b
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1715
+	.byte	0x6
+	.byte	0x4c
+	.byte	0xc
+	.long	0x28b
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x28
+	.long	0x2dd
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1724
+	.byte	0x10
+	.byte	0x7
+	.byte	0x38
+	.long	0x31e
+	.uleb128 0x2
+	.long	.LASF1725
+	.byte	0x7
+	.byte	0x39
+	.byte	0xb
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1726
+	.byte	0x7
+	.byte	0x3a
+	.byte	0xb
+	.long	0x1ef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1727
+	.byte	0x7
+	.byte	0x3b
+	.byte	0xb
+	.long	0x1ef
+	.byte	0x8
+	.uleb128 0x15
+	.string	"yaw"
+	.byte	0x7
+	.byte	0x3c
+	.byte	0xb
+	.long	0x1ef
+	.byte	0xc
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1728
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x3
+	.long	0x2dd
+	.uleb128 0xd
+	.long	0x31e
+	.uleb128 0x13
+	.long	0x31e
+	.long	0x33f
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1729
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x15
+	.long	0x32f
+	.uleb128 0x6
+	.long	.LASF1730
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x4c
+	.long	0x32f
+	.uleb128 0x12
+	.long	.LASF1731
+	.byte	0x8
+	.byte	0x7
+	.byte	0x41
+	.long	0x3a5
+	.uleb128 0x2
+	.long	.LASF1732
+	.byte	0x7
+	.byte	0x42
+	.byte	0xc
+	.long	0xab
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1733
+	.byte	0x7
+	.byte	0x43
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1734
+	.byte	0x7
+	.byte	0x44
+	.byte	0x9
+	.long	0x3a5
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1735
+	.byte	0x7
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1736
+	.byte	0x7
+	.byte	0x46
+	.byte	0xe
+	.long	0xcf
+	.byte	0x6
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1737
+	.uleb128 0x5
+	.long	.LASF1738
+	.byte	0x7
+	.byte	0x47
+	.byte	0x3
+	.long	0x357
+	.uleb128 0xd
+	.long	0x3ac
+	.uleb128 0x6
+	.long	.LASF1739
+	.byte	0x7
+	.byte	0x49
+	.byte	0x16
+	.long	0x3ac
+	.uleb128 0x6
+	.long	.LASF1740
+	.byte	0x7
+	.byte	0x49
+	.byte	0x3f
+	.long	0x3ac
+	.uleb128 0x12
+	.long	.LASF1741
+	.byte	0x6
+	.byte	0x7
+	.byte	0x4b
+	.long	0x409
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0x7
+	.byte	0x4c
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xe
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1744
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1745
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x3
+	.long	0x3d5
+	.uleb128 0xd
+	.long	0x409
+	.uleb128 0x6
+	.long	.LASF1746
+	.byte	0x7
+	.byte	0x51
+	.byte	0x21
+	.long	0x409
+	.uleb128 0x6
+	.long	.LASF1747
+	.byte	0x7
+	.byte	0x51
+	.byte	0x60
+	.long	0x409
+	.uleb128 0x12
+	.long	.LASF1748
+	.byte	0x1c
+	.byte	0x7
+	.byte	0x53
+	.long	0x4c1
+	.uleb128 0x2
+	.long	.LASF1749
+	.byte	0x7
+	.byte	0x55
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1750
+	.byte	0x7
+	.byte	0x56
+	.byte	0xe
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1751
+	.byte	0x7
+	.byte	0x57
+	.byte	0xe
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1752
+	.byte	0x7
+	.byte	0x58
+	.byte	0xd
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1753
+	.byte	0x7
+	.byte	0x59
+	.byte	0xe
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1754
+	.byte	0x7
+	.byte	0x5a
+	.byte	0xe
+	.long	0xcf
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1755
+	.byte	0x7
+	.byte	0x5b
+	.byte	0xe
+	.long	0xcf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1756
+	.byte	0x7
+	.byte	0x5c
+	.byte	0xb
+	.long	0x1ef
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1757
+	.byte	0x7
+	.byte	0x5d
+	.byte	0xb
+	.long	0x1ef
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1758
+	.byte	0x7
+	.byte	0x5e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1759
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x3
+	.long	0x432
+	.uleb128 0xd
+	.long	0x4c1
+	.uleb128 0x6
+	.long	.LASF1760
+	.byte	0x7
+	.byte	0x61
+	.byte	0x16
+	.long	0x4c1
+	.uleb128 0x6
+	.long	.LASF1761
+	.byte	0x7
+	.byte	0x61
+	.byte	0x3f
+	.long	0x4c1
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x63
+	.long	0x508
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1765
+	.byte	0x7
+	.byte	0x67
+	.byte	0x3
+	.long	0x4ea
+	.uleb128 0xd
+	.long	0x508
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x69
+	.long	0x537
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1769
+	.byte	0x7
+	.byte	0x6d
+	.byte	0x3
+	.long	0x519
+	.uleb128 0x13
+	.long	0xb7
+	.long	0x553
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1770
+	.byte	0x7
+	.byte	0x6f
+	.byte	0x10
+	.long	0x543
+	.uleb128 0x6
+	.long	.LASF1771
+	.byte	0x7
+	.byte	0x70
+	.byte	0x10
+	.long	0x543
+	.uleb128 0x6
+	.long	.LASF1772
+	.byte	0x7
+	.byte	0x71
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x8
+	.byte	0x27
+	.long	0x5bf
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x9
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x9
+	.byte	0x16
+	.long	0x5e9
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xa
+	.byte	0x26
+	.long	0x6e4
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1796
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1797
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1798
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1799
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1800
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1801
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1802
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1803
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF1804
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF1805
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF1806
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF1807
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF1808
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF1809
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF1810
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF1811
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF1812
+	.long	0x1000000
+	.uleb128 0x3
+	.long	.LASF1813
+	.long	0x2000000
+	.uleb128 0x3
+	.long	.LASF1814
+	.long	0x4000000
+	.uleb128 0x3
+	.long	.LASF1815
+	.long	0x8000000
+	.uleb128 0x3
+	.long	.LASF1816
+	.long	0x10000000
+	.uleb128 0x3
+	.long	.LASF1817
+	.long	0x20000000
+	.uleb128 0x3
+	.long	.LASF1818
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2128
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xb
+	.byte	0x18
+	.byte	0xe
+	.long	0x757
+	.uleb128 0x1
+	.long	.LASF1819
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1820
+	.byte	0x1
+	.uleb128 0x2c
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1821
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1822
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1824
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0x2b
+	.long	0x76f
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1836
+	.byte	0xb
+	.byte	0x2e
+	.byte	0x3
+	.long	0x757
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0x30
+	.long	0x793
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1839
+	.byte	0xb
+	.byte	0x33
+	.byte	0x3
+	.long	0x77b
+	.uleb128 0x13
+	.long	0xb7
+	.long	0x7af
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1840
+	.byte	0xb
+	.byte	0x51
+	.byte	0x10
+	.long	0x79f
+	.uleb128 0x12
+	.long	.LASF1841
+	.byte	0xa
+	.byte	0xb
+	.byte	0x53
+	.long	0x823
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0xb
+	.byte	0x54
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0xb
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1844
+	.byte	0xb
+	.byte	0x56
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0xb
+	.byte	0x57
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1846
+	.byte	0xb
+	.byte	0x58
+	.byte	0xe
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1847
+	.byte	0xb
+	.byte	0x59
+	.byte	0xd
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1848
+	.byte	0xb
+	.byte	0x5a
+	.byte	0xe
+	.long	0xcf
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1849
+	.byte	0xb
+	.byte	0x5b
+	.byte	0x3
+	.long	0x7bb
+	.uleb128 0xd
+	.long	0x823
+	.uleb128 0x6
+	.long	.LASF1850
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x1b
+	.long	0x823
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xc
+	.byte	0x1c
+	.long	0x94e
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xd
+	.byte	0x15
+	.long	0xa19
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1897
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1898
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1899
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1900
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1901
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1902
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1903
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1904
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF1905
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF1906
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF1907
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF1908
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF1909
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF1910
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF1911
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF1912
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF1913
+	.long	0x1000000
+	.uleb128 0x3
+	.long	.LASF1914
+	.long	0x2000000
+	.uleb128 0x3
+	.long	.LASF1915
+	.long	0x4000000
+	.uleb128 0x3
+	.long	.LASF1916
+	.long	0x8000000
+	.uleb128 0x3
+	.long	.LASF1917
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1918
+	.byte	0xd
+	.byte	0x47
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xd
+	.byte	0x54
+	.long	0xa92
+	.uleb128 0x1
+	.long	.LASF1919
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1920
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1924
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1925
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1926
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1927
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1928
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1929
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1930
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1931
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1932
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1933
+	.value	0x4000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1934
+	.byte	0xd
+	.byte	0x66
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xd
+	.byte	0x6c
+	.long	0xb63
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x80
+	.uleb128 0x4
+	.long	.LASF1943
+	.value	0x100
+	.uleb128 0x4
+	.long	.LASF1944
+	.value	0x200
+	.uleb128 0x4
+	.long	.LASF1945
+	.value	0x400
+	.uleb128 0x4
+	.long	.LASF1946
+	.value	0x800
+	.uleb128 0x4
+	.long	.LASF1947
+	.value	0x1000
+	.uleb128 0x4
+	.long	.LASF1948
+	.value	0x2000
+	.uleb128 0x4
+	.long	.LASF1949
+	.value	0x4000
+	.uleb128 0x4
+	.long	.LASF1950
+	.value	0x8000
+	.uleb128 0x3
+	.long	.LASF1951
+	.long	0x10000
+	.uleb128 0x3
+	.long	.LASF1952
+	.long	0x20000
+	.uleb128 0x3
+	.long	.LASF1953
+	.long	0x40000
+	.uleb128 0x3
+	.long	.LASF1954
+	.long	0x80000
+	.uleb128 0x3
+	.long	.LASF1955
+	.long	0x100000
+	.uleb128 0x3
+	.long	.LASF1956
+	.long	0x200000
+	.uleb128 0x3
+	.long	.LASF1957
+	.long	0x400000
+	.uleb128 0x3
+	.long	.LASF1958
+	.long	0x800000
+	.uleb128 0x3
+	.long	.LASF1959
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1960
+	.byte	0xd
+	.byte	0x8c
+	.byte	0x11
+	.long	0xe0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1961
+	.uleb128 0x13
+	.long	0xb7
+	.long	0xb86
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xe
+	.byte	0x39
+	.long	0xbda
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0xb
+	.byte	0
+	.uleb128 0x13
+	.long	0xb7
+	.long	0xbe5
+	.uleb128 0x2d
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1974
+	.byte	0xe
+	.byte	0xa6
+	.byte	0x10
+	.long	0xbda
+	.uleb128 0x19
+	.byte	0xa
+	.byte	0x92
+	.byte	0x9
+	.long	0xc7c
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0xf
+	.byte	0x93
+	.byte	0x15
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0xf
+	.byte	0x94
+	.byte	0x15
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0xf
+	.byte	0x95
+	.byte	0x15
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0xf
+	.byte	0x96
+	.byte	0x15
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0xf
+	.byte	0x97
+	.byte	0x15
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0xf
+	.byte	0x98
+	.byte	0x15
+	.long	0xc3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1981
+	.byte	0xf
+	.byte	0x99
+	.byte	0x15
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0xf
+	.byte	0x9a
+	.byte	0x15
+	.long	0xc3
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF1983
+	.byte	0xf
+	.byte	0x9b
+	.byte	0x15
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1984
+	.byte	0xf
+	.byte	0x9c
+	.byte	0x15
+	.long	0xc3
+	.byte	0x9
+	.byte	0
+	.uleb128 0x19
+	.byte	0x2e
+	.byte	0x91
+	.byte	0x5
+	.long	0xd7c
+	.uleb128 0x2
+	.long	.LASF1985
+	.byte	0xf
+	.byte	0x9d
+	.byte	0xb
+	.long	0xbf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1986
+	.byte	0xf
+	.byte	0x9f
+	.byte	0x11
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF1987
+	.byte	0xf
+	.byte	0xa0
+	.byte	0x12
+	.long	0xcf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1988
+	.byte	0xf
+	.byte	0xa1
+	.byte	0x12
+	.long	0xcf
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF1989
+	.byte	0xf
+	.byte	0xa2
+	.byte	0x12
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1990
+	.byte	0xf
+	.byte	0xa3
+	.byte	0x12
+	.long	0xcf
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1991
+	.byte	0xf
+	.byte	0xa4
+	.byte	0x12
+	.long	0xcf
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1992
+	.byte	0xf
+	.byte	0xa5
+	.byte	0x12
+	.long	0xcf
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1993
+	.byte	0xf
+	.byte	0xa6
+	.byte	0x12
+	.long	0xcf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1994
+	.byte	0xf
+	.byte	0xa7
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF1995
+	.byte	0xf
+	.byte	0xa8
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1996
+	.byte	0xf
+	.byte	0xa9
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF1997
+	.byte	0xf
+	.byte	0xaa
+	.byte	0x12
+	.long	0xcf
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1998
+	.byte	0xf
+	.byte	0xab
+	.byte	0x12
+	.long	0xcf
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0xf
+	.byte	0xac
+	.byte	0x12
+	.long	0xcf
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0xf
+	.byte	0xad
+	.byte	0x12
+	.long	0xcf
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2001
+	.byte	0xf
+	.byte	0xae
+	.byte	0x12
+	.long	0xcf
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2002
+	.byte	0xf
+	.byte	0xaf
+	.byte	0x12
+	.long	0xcf
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2003
+	.byte	0xf
+	.byte	0xb0
+	.byte	0x12
+	.long	0xcf
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x19
+	.byte	0x18
+	.byte	0xb3
+	.byte	0x5
+	.long	0xe2e
+	.uleb128 0x2
+	.long	.LASF2004
+	.byte	0xf
+	.byte	0xb4
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2005
+	.byte	0xf
+	.byte	0xb5
+	.byte	0x12
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2006
+	.byte	0xf
+	.byte	0xb6
+	.byte	0x12
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2007
+	.byte	0xf
+	.byte	0xb7
+	.byte	0x12
+	.long	0xcf
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2008
+	.byte	0xf
+	.byte	0xb8
+	.byte	0x12
+	.long	0xcf
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2009
+	.byte	0xf
+	.byte	0xb9
+	.byte	0x12
+	.long	0xcf
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2010
+	.byte	0xf
+	.byte	0xba
+	.byte	0x11
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2011
+	.byte	0xf
+	.byte	0xbb
+	.byte	0x12
+	.long	0xcf
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2012
+	.byte	0xf
+	.byte	0xbc
+	.byte	0x12
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2013
+	.byte	0xf
+	.byte	0xbd
+	.byte	0x12
+	.long	0xcf
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2014
+	.byte	0xf
+	.byte	0xbe
+	.byte	0x11
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0xf
+	.byte	0xbf
+	.byte	0x11
+	.long	0xc3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0xf
+	.byte	0xc0
+	.byte	0x11
+	.long	0xc3
+	.byte	0x16
+	.byte	0
+	.uleb128 0x19
+	.byte	0x2e
+	.byte	0xc3
+	.byte	0x5
+	.long	0xf96
+	.uleb128 0x2
+	.long	.LASF2004
+	.byte	0xf
+	.byte	0xc4
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2017
+	.byte	0xf
+	.byte	0xc5
+	.byte	0x11
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2018
+	.byte	0xf
+	.byte	0xc6
+	.byte	0x11
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2019
+	.byte	0xf
+	.byte	0xc7
+	.byte	0x12
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2020
+	.byte	0xf
+	.byte	0xc8
+	.byte	0x12
+	.long	0xcf
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0xf
+	.byte	0xc9
+	.byte	0x11
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0xf
+	.byte	0xca
+	.byte	0x12
+	.long	0xcf
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0xf
+	.byte	0xcb
+	.byte	0x12
+	.long	0xcf
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0xf
+	.byte	0xcc
+	.byte	0x11
+	.long	0xc3
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0xf
+	.byte	0xcd
+	.byte	0x12
+	.long	0xcf
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0xf
+	.byte	0xce
+	.byte	0x10
+	.long	0xab
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2027
+	.byte	0xf
+	.byte	0xcf
+	.byte	0x12
+	.long	0xcf
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0xf
+	.byte	0xd0
+	.byte	0x12
+	.long	0xcf
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0xf
+	.byte	0xd1
+	.byte	0x12
+	.long	0xcf
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0xf
+	.byte	0xd2
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2031
+	.byte	0xf
+	.byte	0xd3
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0xf
+	.byte	0xd4
+	.byte	0x12
+	.long	0xcf
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0xf
+	.byte	0xd5
+	.byte	0x12
+	.long	0xcf
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2034
+	.byte	0xf
+	.byte	0xd6
+	.byte	0x12
+	.long	0xcf
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2035
+	.byte	0xf
+	.byte	0xd7
+	.byte	0x12
+	.long	0xcf
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0xf
+	.byte	0xd8
+	.byte	0x12
+	.long	0xcf
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2037
+	.byte	0xf
+	.byte	0xd9
+	.byte	0x11
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2038
+	.byte	0xf
+	.byte	0xda
+	.byte	0x11
+	.long	0xc3
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2039
+	.byte	0xf
+	.byte	0xdb
+	.byte	0x11
+	.long	0xc3
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2040
+	.byte	0xf
+	.byte	0xdc
+	.byte	0x11
+	.long	0x3a5
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0xf
+	.byte	0xdd
+	.byte	0xd
+	.long	0x3a5
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2042
+	.byte	0xf
+	.byte	0xde
+	.byte	0x11
+	.long	0xc3
+	.byte	0x2d
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2043
+	.byte	0x74
+	.byte	0xf
+	.byte	0x8f
+	.long	0xfc8
+	.uleb128 0x2
+	.long	.LASF2044
+	.byte	0xf
+	.byte	0xb1
+	.byte	0x7
+	.long	0xc7c
+	.byte	0
+	.uleb128 0x15
+	.string	"mc"
+	.byte	0xf
+	.byte	0xc1
+	.byte	0x7
+	.long	0xd7c
+	.byte	0x2e
+	.uleb128 0x15
+	.string	"fw"
+	.byte	0xf
+	.byte	0xdf
+	.byte	0x7
+	.long	0xe2e
+	.byte	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2045
+	.byte	0xf
+	.byte	0xe0
+	.byte	0x3
+	.long	0xf96
+	.uleb128 0xd
+	.long	0xfc8
+	.uleb128 0x6
+	.long	.LASF2046
+	.byte	0xf
+	.byte	0xe2
+	.byte	0x14
+	.long	0xfc8
+	.uleb128 0xc
+	.long	0x553
+	.byte	0x3b
+	.byte	0x3f
+	.uleb128 0xc
+	.long	0x55f
+	.byte	0x3c
+	.byte	0x3f
+	.uleb128 0x7
+	.long	.LASF2047
+	.byte	0x3d
+	.byte	0xe
+	.long	0x1ef
+	.uleb128 0x7
+	.long	.LASF2048
+	.byte	0x3e
+	.byte	0xe
+	.long	0x1ef
+	.uleb128 0x7
+	.long	.LASF2049
+	.byte	0x3f
+	.byte	0x15
+	.long	0x32f
+	.uleb128 0x7
+	.long	.LASF2050
+	.byte	0x40
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0xc
+	.long	0x56b
+	.byte	0x41
+	.byte	0x6
+	.uleb128 0x7
+	.long	.LASF2051
+	.byte	0x42
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2052
+	.byte	0x43
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2053
+	.byte	0x44
+	.byte	0x28
+	.long	0x537
+	.uleb128 0x7
+	.long	.LASF2054
+	.byte	0x45
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2055
+	.byte	0x46
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2056
+	.byte	0x47
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2057
+	.byte	0x48
+	.byte	0xc
+	.long	0x7c
+	.uleb128 0x7
+	.long	.LASF2058
+	.byte	0x49
+	.byte	0xf
+	.long	0xab
+	.uleb128 0x6
+	.long	.LASF2059
+	.byte	0x10
+	.byte	0x4b
+	.byte	0x27
+	.long	0x415
+	.uleb128 0xc
+	.long	0x41a
+	.byte	0x4b
+	.byte	0x68
+	.uleb128 0xc
+	.long	0x426
+	.byte	0x4b
+	.byte	0xa0
+	.uleb128 0x6
+	.long	.LASF2060
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xd7
+	.long	0x1de
+	.uleb128 0x2e
+	.long	0x1098
+	.value	0x10b
+	.uleb128 0x1d
+	.long	0x107e
+	.byte	0x4d
+	.byte	0x20
+	.uleb128 0x6
+	.long	.LASF2061
+	.byte	0x10
+	.byte	0x53
+	.byte	0x1c
+	.long	0x3b8
+	.uleb128 0xc
+	.long	0x3bd
+	.byte	0x53
+	.byte	0x47
+	.uleb128 0xc
+	.long	0x3c9
+	.byte	0x53
+	.byte	0x69
+	.uleb128 0x6
+	.long	.LASF2062
+	.byte	0x10
+	.byte	0x53
+	.byte	0x95
+	.long	0x1de
+	.uleb128 0x1e
+	.long	0x10cc
+	.byte	0xbe
+	.uleb128 0x1d
+	.long	0x10b2
+	.byte	0x55
+	.byte	0x15
+	.uleb128 0x6
+	.long	.LASF2063
+	.byte	0x10
+	.byte	0x67
+	.byte	0x1c
+	.long	0x4cd
+	.uleb128 0xc
+	.long	0x4d2
+	.byte	0x67
+	.byte	0x47
+	.uleb128 0xc
+	.long	0x4de
+	.byte	0x67
+	.byte	0x69
+	.uleb128 0x6
+	.long	.LASF2064
+	.byte	0x10
+	.byte	0x67
+	.byte	0x95
+	.long	0x1de
+	.uleb128 0x1e
+	.long	0x10ff
+	.byte	0xbe
+	.uleb128 0x1d
+	.long	0x10e5
+	.byte	0x69
+	.byte	0x15
+	.uleb128 0xc
+	.long	0x33f
+	.byte	0x75
+	.byte	0xe
+	.uleb128 0xc
+	.long	0x34b
+	.byte	0x75
+	.byte	0x3e
+	.uleb128 0x6
+	.long	.LASF2065
+	.byte	0x10
+	.byte	0x75
+	.byte	0x79
+	.long	0x1de
+	.uleb128 0x1e
+	.long	0x1126
+	.byte	0xa8
+	.uleb128 0x5
+	.long	.LASF2066
+	.byte	0x10
+	.byte	0x77
+	.byte	0x10
+	.long	0x1144
+	.uleb128 0xe
+	.long	0x1149
+	.uleb128 0x20
+	.long	0x1154
+	.uleb128 0xa
+	.long	0x1f6
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2067
+	.byte	0x78
+	.byte	0x24
+	.long	0x1138
+	.uleb128 0x2f
+	.long	.LASF2068
+	.byte	0xf
+	.value	0x1e9
+	.byte	0x5
+	.long	0x3a5
+	.uleb128 0x16
+	.long	.LASF2073
+	.byte	0xb
+	.byte	0x6c
+	.byte	0x12
+	.long	0x76f
+	.long	0x1182
+	.uleb128 0xa
+	.long	0x793
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2069
+	.byte	0x11
+	.byte	0xa7
+	.byte	0x5
+	.long	0x3a5
+	.uleb128 0x1a
+	.long	.LASF2070
+	.byte	0x11
+	.byte	0xa0
+	.byte	0x5
+	.long	0x3a5
+	.uleb128 0x1a
+	.long	.LASF2071
+	.byte	0x12
+	.byte	0xa0
+	.byte	0x7
+	.long	0x1ef
+	.uleb128 0x1a
+	.long	.LASF2072
+	.byte	0x12
+	.byte	0x94
+	.byte	0x5
+	.long	0x3a5
+	.uleb128 0x16
+	.long	.LASF2074
+	.byte	0x6
+	.byte	0x4f
+	.byte	0x7
+	.long	0x1ef
+	.long	0x11c8
+	.uleb128 0xa
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2075
+	.byte	0x13
+	.byte	0x87
+	.byte	0x5
+	.long	0x7c
+	.long	0x11e8
+	.uleb128 0xa
+	.long	0x7c
+	.uleb128 0xa
+	.long	0x7c
+	.uleb128 0xa
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2076
+	.byte	0x14
+	.byte	0x1c
+	.long	0x11f9
+	.uleb128 0xa
+	.long	0xc3
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2077
+	.byte	0x15
+	.byte	0x19
+	.long	0x120a
+	.uleb128 0xa
+	.long	0x1e3
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2078
+	.byte	0x14
+	.byte	0x1b
+	.long	0x1220
+	.uleb128 0xa
+	.long	0xc3
+	.uleb128 0xa
+	.long	0xcf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2079
+	.byte	0x13
+	.byte	0x88
+	.byte	0x7
+	.long	0x1ef
+	.long	0x1240
+	.uleb128 0xa
+	.long	0x1ef
+	.uleb128 0xa
+	.long	0x1ef
+	.uleb128 0xa
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2080
+	.byte	0x16
+	.byte	0x1e
+	.byte	0x5
+	.long	0x3a5
+	.long	0x1256
+	.uleb128 0xa
+	.long	0xe0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2081
+	.value	0x24f
+	.long	0x126e
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x250
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2114
+	.byte	0x10
+	.value	0x240
+	.byte	0xf
+	.long	0x508
+	.uleb128 0x17
+	.long	.LASF2082
+	.value	0x1bd
+	.long	0x1398
+	.uleb128 0x22
+	.string	"dT"
+	.value	0x1bd
+	.byte	0x1b
+	.long	0x1f6
+	.uleb128 0x8
+	.long	.LASF2083
+	.value	0x1bf
+	.byte	0xd
+	.long	0xb76
+	.uleb128 0x8
+	.long	.LASF2084
+	.value	0x1ce
+	.byte	0xd
+	.long	0x543
+	.uleb128 0x8
+	.long	.LASF2085
+	.value	0x1cf
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2086
+	.value	0x1d0
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2087
+	.value	0x1dd
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2088
+	.value	0x1de
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2089
+	.value	0x1df
+	.byte	0xd
+	.long	0xb7
+	.uleb128 0x8
+	.long	.LASF2090
+	.value	0x1df
+	.byte	0x1a
+	.long	0xb7
+	.uleb128 0x11
+	.long	0x1301
+	.uleb128 0x10
+	.string	"i"
+	.value	0x1d3
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x1321
+	.uleb128 0x8
+	.long	.LASF2091
+	.value	0x20c
+	.byte	0xa8
+	.long	0x1ef
+	.uleb128 0x31
+	.long	.LASF2092
+	.byte	0x10
+	.value	0x20c
+	.value	0x136
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x1331
+	.uleb128 0x10
+	.string	"i"
+	.value	0x218
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x134f
+	.uleb128 0x8
+	.long	.LASF2093
+	.value	0x220
+	.byte	0x56
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF2094
+	.value	0x220
+	.byte	0xce
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x11
+	.long	0x136d
+	.uleb128 0x8
+	.long	.LASF2095
+	.value	0x221
+	.byte	0x56
+	.long	0x7c
+	.uleb128 0x8
+	.long	.LASF2096
+	.value	0x221
+	.byte	0xce
+	.long	0x1ef
+	.byte	0
+	.uleb128 0x11
+	.long	0x138b
+	.uleb128 0x8
+	.long	.LASF2097
+	.value	0x227
+	.byte	0x1d
+	.long	0x514
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x228
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x237
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.long	.LASF2124
+	.byte	0x10
+	.value	0x1b0
+	.byte	0xc
+	.long	0x7c
+	.long	0x13b6
+	.uleb128 0x8
+	.long	.LASF2098
+	.value	0x1b2
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF2099
+	.value	0x1ab
+	.uleb128 0x23
+	.long	.LASF2100
+	.value	0x1a4
+	.uleb128 0x17
+	.long	.LASF2101
+	.value	0x19b
+	.long	0x13e7
+	.uleb128 0x22
+	.string	"mc"
+	.value	0x19b
+	.byte	0x1d
+	.long	0xb7
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x19e
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2102
+	.value	0x145
+	.long	0x140d
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x147
+	.byte	0xe
+	.long	0x7c
+	.uleb128 0xf
+	.uleb128 0x8
+	.long	.LASF2103
+	.value	0x148
+	.byte	0x12
+	.long	0xcf
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2104
+	.value	0x10b
+	.long	0x1431
+	.uleb128 0x8
+	.long	.LASF2105
+	.value	0x10d
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0xf
+	.uleb128 0x10
+	.string	"i"
+	.value	0x122
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2106
+	.byte	0xf0
+	.uleb128 0x25
+	.long	.LASF2107
+	.byte	0xca
+	.long	0x14a3
+	.uleb128 0x26
+	.string	"dT"
+	.byte	0xca
+	.byte	0x29
+	.long	0x1f6
+	.uleb128 0x7
+	.long	.LASF2108
+	.byte	0xcc
+	.byte	0x12
+	.long	0x14a3
+	.uleb128 0x11
+	.long	0x1465
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0xd0
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.uleb128 0x11
+	.long	0x1497
+	.uleb128 0x7
+	.long	.LASF2109
+	.byte	0xd6
+	.byte	0x18
+	.long	0xdb
+	.uleb128 0x7
+	.long	.LASF2110
+	.byte	0xd7
+	.byte	0x15
+	.long	0x1f6
+	.uleb128 0x7
+	.long	.LASF2111
+	.byte	0xd8
+	.byte	0x15
+	.long	0x1f6
+	.uleb128 0xf
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0xda
+	.byte	0x12
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0xeb
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x1ef
+	.long	0x14b3
+	.uleb128 0x14
+	.long	0x37
+	.byte	0xb
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2112
+	.byte	0xc5
+	.long	0x14c8
+	.uleb128 0x26
+	.string	"dT"
+	.byte	0xc5
+	.byte	0x28
+	.long	0x1f6
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2113
+	.byte	0x9d
+	.uleb128 0x1c
+	.long	.LASF2115
+	.byte	0x98
+	.byte	0x5
+	.long	0x3a5
+	.uleb128 0x1c
+	.long	.LASF2116
+	.byte	0x93
+	.byte	0x7
+	.long	0x1ef
+	.uleb128 0x1c
+	.long	.LASF2117
+	.byte	0x8f
+	.byte	0x9
+	.long	0xc3
+	.uleb128 0x33
+	.long	.LASF2129
+	.byte	0x10
+	.byte	0x83
+	.byte	0xd
+	.long	0x1507
+	.uleb128 0xf
+	.uleb128 0x1b
+	.string	"i"
+	.byte	0x86
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2118
+	.byte	0x7a
+	.byte	0x5
+	.long	0x7c
+	.uleb128 0x18
+	.long	.LASF2119
+	.byte	0xf
+	.byte	0xe2
+	.byte	0x6a
+	.long	0x151e
+	.uleb128 0xe
+	.long	0xfd4
+	.uleb128 0x18
+	.long	.LASF2120
+	.byte	0xb
+	.byte	0x5d
+	.byte	0x8d
+	.long	0x152f
+	.uleb128 0xe
+	.long	0x82f
+	.uleb128 0x18
+	.long	.LASF2121
+	.byte	0x7
+	.byte	0x61
+	.byte	0x74
+	.long	0x1540
+	.uleb128 0xe
+	.long	0x4cd
+	.uleb128 0x18
+	.long	.LASF2122
+	.byte	0x7
+	.byte	0x51
+	.byte	0xab
+	.long	0x1551
+	.uleb128 0xe
+	.long	0x415
+	.uleb128 0x18
+	.long	.LASF2123
+	.byte	0x7
+	.byte	0x49
+	.byte	0x74
+	.long	0x1562
+	.uleb128 0xe
+	.long	0x3b8
+	.uleb128 0x34
+	.long	.LASF2125
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x8f
+	.long	0x1584
+	.long	0x1584
+	.uleb128 0x35
+	.long	.LASF2126
+	.byte	0x7
+	.byte	0x3f
+	.byte	0xa5
+	.long	0x7c
+	.byte	0
+	.uleb128 0xe
+	.long	0x32a
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x5
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 23 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x19
+	.file 26 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 28 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 29 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1d
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 32 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 39 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2c
+	.file 45 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 46 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 47 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF922
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF928
+	.file 49 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 50 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 51 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 52 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 53 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.file 54 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1045
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x16
+	.byte	0x4
+	.file 55 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x14
+	.file 56 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 57 "./src/main/flight/servos.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1151
+	.byte	0x4
+	.file 58 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1152
+	.byte	0x4
+	.file 59 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1156
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xc
+	.file 60 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3c
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 61 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x3d
+	.file 62 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3e
+	.file 63 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x40
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1469
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1496
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x45
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x47
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x4
+	.file 73 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0xf
+	.file 74 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 75 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1661
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF942
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF965
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF977
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF980
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.global_functions.h.29.fb1af0cee01f455e1be8fe7fa6b2a019,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1120
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1129
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_mapping.h.29.5f2a3671df9c4f1621241af7b58f1e07,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1160
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1461
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1468
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1490
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1495
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1498
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1515
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1515
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1528
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1516
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1517
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1518
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1519
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1537
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1538
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1539
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1540
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1547
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1548
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1549
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1550
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1551
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1552
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1589
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1612
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1623
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1651
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1657
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2130
+	.long	.LASF2131
+	.long	.LASF2132
+	.long	.LASF2133
+	.long	.LASF2134
+	.long	.LASF2135
+	.long	.LASF2136
+	.long	.LASF2137
+	.long	.LASF2138
+	.long	.LASF2139
+	.long	.LASF2140
+	.long	.LASF2141
+	.long	.LASF2142
+	.long	.LASF2143
+	.long	.LASF2144
+	.long	.LASF2145
+	.long	.LASF2146
+	.long	.LASF2147
+	.long	.LASF2148
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4c
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2149
+	.byte	0xf
+	.long	.LASF2150
+	.byte	0xf
+	.long	.LASF2151
+	.byte	0xf
+	.long	.LASF2152
+	.byte	0x3
+	.long	.LASF2153
+	.byte	0x2
+	.long	.LASF2154
+	.byte	0x2
+	.long	.LASF2155
+	.byte	0x6
+	.long	.LASF2156
+	.byte	0x4
+	.long	.LASF2157
+	.byte	0x4
+	.long	.LASF2158
+	.byte	0x5
+	.long	.LASF2159
+	.byte	0x5
+	.long	.LASF2160
+	.byte	0x5
+	.long	.LASF2161
+	.byte	0x5
+	.long	.LASF2162
+	.byte	0x6
+	.long	.LASF2163
+	.byte	0x8
+	.long	.LASF2164
+	.byte	0x6
+	.long	.LASF2165
+	.byte	0x6
+	.long	.LASF2166
+	.byte	0xa
+	.long	.LASF2167
+	.byte	0x2
+	.long	.LASF2168
+	.byte	0x4
+	.long	.LASF2153
+	.byte	0x4
+	.long	.LASF2169
+	.byte	0x3
+	.long	.LASF2170
+	.byte	0x12
+	.long	.LASF2171
+	.byte	0x13
+	.long	.LASF2172
+	.byte	0x13
+	.long	.LASF2172
+	.byte	0x12
+	.long	.LASF2173
+	.byte	0xf
+	.long	.LASF2174
+	.byte	0x12
+	.long	.LASF2175
+	.byte	0x12
+	.long	.LASF2176
+	.byte	0xf
+	.long	.LASF2177
+	.byte	0xf
+	.long	.LASF2178
+	.byte	0x11
+	.long	.LASF2179
+	.byte	0xf
+	.long	.LASF2180
+	.byte	0x10
+	.long	.LASF2181
+	.byte	0x10
+	.long	.LASF2182
+	.byte	0xf
+	.long	.LASF2183
+	.byte	0xf
+	.long	.LASF2184
+	.byte	0xf
+	.long	.LASF2185
+	.byte	0x12
+	.long	.LASF2186
+	.byte	0x13
+	.long	.LASF2187
+	.byte	0xe
+	.long	.LASF2188
+	.byte	0xe
+	.long	.LASF2189
+	.byte	0x12
+	.long	.LASF2190
+	.byte	0xd
+	.long	.LASF2191
+	.byte	0xc
+	.long	.LASF2192
+	.byte	0xb
+	.long	.LASF2193
+	.byte	0xc
+	.long	.LASF2194
+	.byte	0xc
+	.long	.LASF2195
+	.byte	0x1
+	.long	.LASF2196
+	.byte	0x1
+	.long	.LASF2197
+	.byte	0x2
+	.long	.LASF2198
+	.byte	0x2
+	.long	.LASF2199
+	.byte	0x2
+	.long	.LASF2200
+	.byte	0x2
+	.long	.LASF2201
+	.byte	0x3
+	.long	.LASF2202
+	.byte	0x4
+	.long	.LASF2203
+	.byte	0x6
+	.long	.LASF2204
+	.byte	0x4
+	.long	.LASF2205
+	.byte	0x5
+	.long	.LASF2206
+	.byte	0x2
+	.long	.LASF2207
+	.byte	0x6
+	.long	.LASF2208
+	.byte	0x2
+	.long	.LASF2209
+	.byte	0x12
+	.long	.LASF2210
+	.byte	0xf
+	.long	.LASF2211
+	.byte	0xf
+	.long	.LASF2212
+	.byte	0xf
+	.long	.LASF2213
+	.byte	0xf
+	.long	.LASF2214
+	.byte	0xf
+	.long	.LASF2215
+	.byte	0xf
+	.long	.LASF2216
+	.byte	0xf
+	.long	.LASF2217
+	.byte	0xf
+	.long	.LASF2218
+	.byte	0xf
+	.long	.LASF2219
+	.byte	0x2
+	.long	.LASF2220
+	.byte	0x7
+	.long	.LASF2221
+	.byte	0x9
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2006:
+	.string	"auto_disarm_delay"
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1223:
+	.string	"__DECL_SIMD_logf "
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF2098:
+	.string	"directionValue"
+.LASF1033:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF939:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF932:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF1559:
+	.string	"FP_ZERO 2"
+.LASF858:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1971:
+	.string	"PID_VEL_Z"
+.LASF1630:
+	.string	"MIDRC_MIN 1200"
+.LASF1821:
+	.string	"THROTTLE"
+.LASF1144:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF1156:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2007:
+	.string	"braking_speed_threshold"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1809:
+	.string	"FEATURE_TRANSPONDER"
+.LASF983:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1354:
+	.string	"__DECL_SIMD_atan2l "
+.LASF865:
+	.string	"USE_UART7 "
+.LASF1196:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1838:
+	.string	"THROTTLE_STATUS_TYPE_COMMAND"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1129:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1861:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1783:
+	.string	"ADC_BATTERY"
+.LASF2109:
+	.string	"motorRange"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1561:
+	.string	"FP_NORMAL 4"
+.LASF1396:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2023:
+	.string	"max_throttle"
+.LASF1094:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1291:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF943:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1452:
+	.string	"__DECL_SIMD_tan "
+.LASF1995:
+	.string	"land_slowdown_maxalt"
+.LASF1437:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2101:
+	.string	"writeAllMotors"
+.LASF1880:
+	.string	"BOXCAMERA1"
+.LASF1940:
+	.string	"ANTI_WINDUP"
+.LASF1668:
+	.string	"__uint8_t"
+.LASF2100:
+	.string	"stopMotors"
+.LASF1967:
+	.string	"PID_VEL_XY"
+.LASF1873:
+	.string	"BOXGCSNAV"
+.LASF982:
+	.string	"FAST_MATH "
+.LASF1900:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1737:
+	.string	"_Bool"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1358:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1191:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1508:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1534:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1501:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1400:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1242:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2090:
+	.string	"throttleMax"
+.LASF2076:
+	.string	"pwmShutdownPulsesForAllMotors"
+.LASF1380:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF698:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1119:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1970:
+	.string	"PID_HEADING"
+.LASF1618:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1886:
+	.string	"BOXNAVCRUISE"
+.LASF1906:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1062:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1734:
+	.string	"hasFlaps"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF1724:
+	.string	"motorMixer_s"
+.LASF1728:
+	.string	"motorMixer_t"
+.LASF1706:
+	.string	"GLOBAL_FUNCTION_ACTION_LAST"
+.LASF1639:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1297:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1844:
+	.string	"pos_hold_deadband"
+.LASF914:
+	.string	"NOINLINE "
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1485:
+	.string	"__f32x(x) x ##f32x"
+.LASF1888:
+	.string	"BOXUSER1"
+.LASF1889:
+	.string	"BOXUSER2"
+.LASF1329:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1237:
+	.string	"__DECL_SIMD_expf64 "
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF996:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1612:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1169:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF1504:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1712:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_YAW"
+.LASF1403:
+	.string	"__DECL_SIMD_acoshf "
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1208:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF787:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF970:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1334:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1479:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1710:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_ROLL"
+.LASF1052:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF383:
+	.string	"SITL 1"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1161:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1798:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1605:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1679:
+	.string	"uint16_t"
+.LASF1234:
+	.string	"__DECL_SIMD_expl "
+.LASF2048:
+	.string	"mixerScale"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF1569:
+	.string	"MATH_ERREXCEPT 2"
+.LASF373:
+	.string	"linux 1"
+.LASF992:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF1772:
+	.string	"mixerThrottleCommand"
+.LASF2022:
+	.string	"min_throttle"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1915:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF1440:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF955:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1564:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF2069:
+	.string	"failsafeRequiresMotorStop"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1997:
+	.string	"rth_altitude"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2040:
+	.string	"allow_manual_thr_increase"
+.LASF2046:
+	.string	"navConfig_System"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1634:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF2020:
+	.string	"cruise_speed"
+.LASF1073:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1747:
+	.string	"reversibleMotorsConfig_Copy"
+.LASF1055:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1158:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1457:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF2002:
+	.string	"rth_home_offset_distance"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1760:
+	.string	"motorConfig_System"
+.LASF2038:
+	.string	"launch_max_angle"
+.LASF1597:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1011:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1049:
+	.string	"GLOBAL_FUNCTION_FLAG(mask) (globalFunctionsFlags & (mask))"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF2011:
+	.string	"braking_boost_timeout"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1036:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1937:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1225:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1475:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1700:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_ROLL"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1733:
+	.string	"platformType"
+.LASF1281:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2041:
+	.string	"useFwNavYawControl"
+.LASF1964:
+	.string	"PID_YAW"
+.LASF2119:
+	.string	"navConfig"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1224:
+	.string	"__DECL_SIMD_logl "
+.LASF1498:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1839:
+	.string	"throttleStatusType_e"
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1461:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1897:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1032:
+	.string	"BIT(x) (1 << (x))"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1968:
+	.string	"PID_SURFACE"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF2102:
+	.string	"writeMotors"
+.LASF2001:
+	.string	"max_terrain_follow_altitude"
+.LASF1307:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2059:
+	.string	"pgResetTemplate_reversibleMotorsConfig"
+.LASF1057:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF1464:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1954:
+	.string	"ROVER"
+.LASF1626:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF1562:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1718:
+	.string	"PLATFORM_HELICOPTER"
+.LASF2026:
+	.string	"land_dive_angle"
+.LASF1416:
+	.string	"__DECL_SIMD_erff32 "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1159:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1152:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1175:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1064:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1658:
+	.string	"DEFAULT_PWM_PROTOCOL PWM_TYPE_STANDARD"
+.LASF2027:
+	.string	"launch_velocity_thresh"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1298:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1417:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1739:
+	.string	"mixerConfig_System"
+.LASF1808:
+	.string	"FEATURE_UNUSED_10"
+.LASF1815:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1330:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1645:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1952:
+	.string	"AIRPLANE"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1204:
+	.string	"__DECL_SIMD_sinl "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1076:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1365:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1367:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1702:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_YAW"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF2055:
+	.string	"throttleDeadbandHigh"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF1685:
+	.string	"PGR_SIZE_MASK"
+.LASF1930:
+	.string	"NAV_WP_MODE"
+.LASF1527:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1549:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1299:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF1520:
+	.string	"_Mdouble_ float"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1336:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1324:
+	.string	"__DECL_SIMD_expm1l "
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1780:
+	.string	"PWM_TYPE_DSHOT600"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1010:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1404:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1983:
+	.string	"rth_climb_ignore_emerg"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1260:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1544:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1190:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1538:
+	.string	"__MATHDECL_1"
+.LASF1122:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1659:
+	.string	"DEFAULT_PWM_RATE 400"
+.LASF396:
+	.string	"false 0"
+.LASF1413:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1725:
+	.string	"throttle"
+.LASF957:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1146:
+	.string	"MAX_MOTORS 12"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1474:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF998:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF2089:
+	.string	"throttleMin"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1767:
+	.string	"MOTOR_DIRECTION_BACKWARD"
+.LASF1853:
+	.string	"BOXHORIZON"
+.LASF1356:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1919:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2030:
+	.string	"launch_idle_throttle"
+.LASF1136:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF959:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1326:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1987:
+	.string	"waypoint_radius"
+.LASF1174:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1292:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1758:
+	.string	"motorPoleCount"
+.LASF1913:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1310:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF2066:
+	.string	"motorRateLimitingApplyFnPtr"
+.LASF2063:
+	.string	"pgResetTemplate_motorConfig"
+.LASF1517:
+	.string	"__MATH_PRECNAME"
+.LASF1547:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF1512:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1598:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1735:
+	.string	"appliedMixerPreset"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2018:
+	.string	"max_dive_angle"
+.LASF1027:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF977:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF1186:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1371:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF946:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1789:
+	.string	"FEATURE_VBAT"
+.LASF1898:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF1035:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1469:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1007:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF968:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1705:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_CHANNEL"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1317:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1088:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1016:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1155:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1177:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF2012:
+	.string	"braking_boost_speed_threshold"
+.LASF1657:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1103:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1251:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1449:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2104:
+	.string	"mixerResetDisarmedMotors"
+.LASF1602:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1647:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1640:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1726:
+	.string	"roll"
+.LASF2082:
+	.string	"mixTable"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF949:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1624:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1669:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1599:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1671:
+	.string	"__uint16_t"
+.LASF1489:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1991:
+	.string	"max_manual_speed"
+.LASF1128:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF1318:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1864:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF1363:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1807:
+	.string	"FEATURE_BLACKBOX"
+.LASF1093:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1288:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1460:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1610:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1265:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1003:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1072:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1810:
+	.string	"FEATURE_AIRMODE"
+.LASF1748:
+	.string	"motorConfig_s"
+.LASF1759:
+	.string	"motorConfig_t"
+.LASF1319:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1415:
+	.string	"__DECL_SIMD_erff16 "
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1427:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1834:
+	.string	"THROTTLE_LOW"
+.LASF1105:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1248:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1289:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1121:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2126:
+	.string	"_index"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF938:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1643:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1755:
+	.string	"digitalIdleOffsetValue"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF978:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1306:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF1582:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1021:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1551:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1314:
+	.string	"__DECL_SIMD_coshl "
+.LASF1920:
+	.string	"HORIZON_MODE"
+.LASF1662:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1606:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1792:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1495:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1114:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1120:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF995:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF741:
+	.string	"USE_NAV "
+.LASF1284:
+	.string	"__DECL_SIMD_hypotl "
+.LASF358:
+	.string	"__k8 1"
+.LASF1611:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1061:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1752:
+	.string	"motorPwmProtocol"
+.LASF1695:
+	.string	"float"
+.LASF1707:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_ARMING_SAFETY"
+.LASF2091:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2093:
+	.string	"_left2"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2095:
+	.string	"_left4"
+.LASF2110:
+	.string	"motorMaxInc"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1851:
+	.string	"BOXARM"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF2125:
+	.string	"primaryMotorMixer"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1928:
+	.string	"FAILSAFE_MODE"
+.LASF1540:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1887:
+	.string	"BOXBRAKING"
+.LASF1414:
+	.string	"__DECL_SIMD_erfl "
+.LASF1621:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1847:
+	.string	"airmodeHandlingType"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1275:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2039:
+	.string	"cruise_yaw_rate"
+.LASF1723:
+	.string	"pgRegistry_s"
+.LASF1693:
+	.string	"pgRegistry_t"
+.LASF1699:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_POWER_LEVEL"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1899:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1084:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1794:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1652:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF933:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1579:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1096:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF1117:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF1296:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1980:
+	.string	"rth_tail_first"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF979:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1340:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1862:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF374:
+	.string	"__unix 1"
+.LASF1687:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF739:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1446:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF967:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1443:
+	.string	"__DECL_SIMD_erfcf "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1822:
+	.string	"AUX1"
+.LASF1823:
+	.string	"AUX2"
+.LASF1824:
+	.string	"AUX3"
+.LASF1825:
+	.string	"AUX4"
+.LASF1793:
+	.string	"FEATURE_UNUSED_1"
+.LASF1827:
+	.string	"AUX6"
+.LASF1681:
+	.string	"uint64_t"
+.LASF1797:
+	.string	"FEATURE_UNUSED_4"
+.LASF1801:
+	.string	"FEATURE_UNUSED_5"
+.LASF1802:
+	.string	"FEATURE_UNUSED_6"
+.LASF1806:
+	.string	"FEATURE_UNUSED_7"
+.LASF1813:
+	.string	"FEATURE_UNUSED_8"
+.LASF1814:
+	.string	"FEATURE_UNUSED_9"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1661:
+	.string	"THROTTLE_CLIPPING_FACTOR 0.33f"
+.LASF1524:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1903:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1087:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2010:
+	.string	"braking_boost_factor"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1364:
+	.string	"__DECL_SIMD_log10l "
+.LASF1642:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1776:
+	.string	"PWM_TYPE_MULTISHOT"
+.LASF1287:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1164:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1056:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1843:
+	.string	"yaw_deadband"
+.LASF1765:
+	.string	"motorStatus_e"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1322:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1947:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1394:
+	.string	"__DECL_SIMD_atanhl "
+.LASF922:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1411:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1637:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1386:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF2024:
+	.string	"pitch_to_throttle"
+.LASF1214:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1445:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1812:
+	.string	"FEATURE_VTX"
+.LASF1113:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1556:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1362:
+	.string	"__DECL_SIMD_log10 "
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1338:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1683:
+	.string	"PGR_PGN_MASK"
+.LASF2122:
+	.string	"reversibleMotorsConfig"
+.LASF2103:
+	.string	"motorValue"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1514:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF2124:
+	.string	"getReversibleMotorsThrottleDeadband"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1703:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF989:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1201:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1751:
+	.string	"motorPwmRate"
+.LASF1620:
+	.string	"HDOP_SCALE (100)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1178:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1859:
+	.string	"BOXNAVRTH"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF1744:
+	.string	"neutral"
+.LASF1241:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1910:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1982:
+	.string	"rth_allow_landing"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+.LASF1002:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1387:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2114:
+	.string	"getMotorStatus"
+.LASF1477:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1192:
+	.string	"__DECL_SIMD_cos "
+.LASF1694:
+	.string	"timeMs_t"
+.LASF1568:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1631:
+	.string	"MIDRC_MAX 1700"
+.LASF1837:
+	.string	"THROTTLE_STATUS_TYPE_RC"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2014:
+	.string	"braking_bank_angle"
+.LASF1591:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1351:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1836:
+	.string	"throttleStatus_e"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2029:
+	.string	"launch_time_thresh"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF942:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1370:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1273:
+	.string	"__DECL_SIMD_asinf "
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF1689:
+	.string	"size"
+.LASF1584:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF2088:
+	.string	"throttleRange"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1316:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF2107:
+	.string	"applyMotorRateLimiting"
+.LASF1311:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1236:
+	.string	"__DECL_SIMD_expf32 "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1043:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1450:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1515:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1528:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1095:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1397:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1785:
+	.string	"ADC_CURRENT"
+.LASF1193:
+	.string	"__DECL_SIMD_cosf "
+.LASF1636:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1892:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1337:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1805:
+	.string	"FEATURE_DASHBOARD"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1581:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1486:
+	.string	"__f64x(x) x ##f64x"
+.LASF1008:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1578:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1635:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1771:
+	.string	"motor_disarmed"
+.LASF1137:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF1688:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1218:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1678:
+	.string	"uint8_t"
+.LASF1503:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF1604:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1529:
+	.string	"_Mdouble_ _Float64"
+.LASF1518:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1270:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1909:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1171:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1917:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1894:
+	.string	"ARMED"
+.LASF1081:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2129:
+	.string	"computeMotorCount"
+.LASF1608:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1130:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1412:
+	.string	"__DECL_SIMD_erf "
+.LASF1820:
+	.string	"PITCH"
+.LASF1860:
+	.string	"BOXNAVPOSHOLD"
+.LASF891:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1963:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1259:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF925:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF376:
+	.string	"unix 1"
+.LASF1558:
+	.string	"FP_INFINITE 1"
+.LASF1548:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1312:
+	.string	"__DECL_SIMD_cosh "
+.LASF1550:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1145:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF1202:
+	.string	"__DECL_SIMD_sin "
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF2072:
+	.string	"isAmperageConfigured"
+.LASF1215:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1468:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF892:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1131:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1993:
+	.string	"land_descent_rate"
+.LASF950:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1945:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1245:
+	.string	"__DECL_SIMD_powf16 "
+.LASF2074:
+	.string	"getThrottleScale"
+.LASF1276:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1493:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1646:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF2062:
+	.string	"mixerConfig_Registry"
+.LASF1519:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1532:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1613:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1773:
+	.string	"PWM_TYPE_STANDARD"
+.LASF1399:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1042:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1651:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1761:
+	.string	"motorConfig_Copy"
+.LASF1896:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1295:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1496:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1439:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1230:
+	.string	"__DECL_SIMD_logf64x "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1607:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2003:
+	.string	"rth_home_offset_direction"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1609:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF964:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF954:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1877:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1348:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1972:
+	.string	"PID_POS_HEADING"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2064:
+	.string	"motorConfig_Registry"
+.LASF1228:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1790:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF2052:
+	.string	"motorValueWhenStopped"
+.LASF1436:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1389:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1969:
+	.string	"PID_LEVEL"
+.LASF1846:
+	.string	"mid_throttle_deadband"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF1041:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1232:
+	.string	"__DECL_SIMD_exp "
+.LASF2127:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1106:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1405:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1523:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1596:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1110:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1150:
+	.string	"MAX_INPUTS 8"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1848:
+	.string	"airmodeThrottleThreshold"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1674:
+	.string	"__uint64_t"
+.LASF1009:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1127:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1200:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1357:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1085:
+	.string	"PG_CF_END 56"
+.LASF1274:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1456:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1628:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1453:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF930:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1123:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1557:
+	.string	"FP_NAN 0"
+.LASF1346:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1757:
+	.string	"throttleScale"
+.LASF1690:
+	.string	"address"
+.LASF1015:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1530:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1001:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1764:
+	.string	"MOTOR_RUNNING"
+.LASF2078:
+	.string	"pwmWriteMotor"
+.LASF1352:
+	.string	"__DECL_SIMD_atan2 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1194:
+	.string	"__DECL_SIMD_cosl "
+.LASF1782:
+	.string	"PWM_TYPE_SERIALSHOT"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1719:
+	.string	"PLATFORM_TRICOPTER"
+.LASF1855:
+	.string	"BOXHEADINGHOLD"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1148:
+	.string	"PWM_TIMER_HZ 1000000"
+.LASF1924:
+	.string	"NAV_POSHOLD_MODE"
+.LASF963:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF719:
+	.string	"NULL"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF2121:
+	.string	"motorConfig"
+.LASF1935:
+	.string	"GPS_FIX_HOME"
+.LASF1280:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1878:
+	.string	"BOXAUTOTRIM"
+.LASF1727:
+	.string	"pitch"
+.LASF1746:
+	.string	"reversibleMotorsConfig_System"
+.LASF1553:
+	.string	"__MATHCALL_NARROW"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1975:
+	.string	"use_thr_mid_for_althold"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1981:
+	.string	"disarm_on_landing"
+.LASF466:
+	.string	"__PMT"
+.LASF1024:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2047:
+	.string	"motorMixRange"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1272:
+	.string	"__DECL_SIMD_asin "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1017:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1102:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2004:
+	.string	"max_bank_angle"
+.LASF2073:
+	.string	"calculateThrottleStatus"
+.LASF1574:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1850:
+	.string	"rcControlsConfig_System"
+.LASF1373:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1942:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1918:
+	.string	"armingFlags"
+.LASF1535:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1422:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1181:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1638:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1686:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1560:
+	.string	"FP_SUBNORMAL 3"
+.LASF1901:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1465:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1398:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1852:
+	.string	"BOXANGLE"
+.LASF1876:
+	.string	"BOXFLAPERON"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1904:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF2087:
+	.string	"rpyMixRange"
+.LASF1729:
+	.string	"primaryMotorMixer_SystemArray"
+.LASF1263:
+	.string	"__DECL_SIMD_atanf "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2081:
+	.string	"loadPrimaryMotorMixer"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2017:
+	.string	"max_climb_angle"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1023:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1777:
+	.string	"PWM_TYPE_BRUSHED"
+.LASF936:
+	.string	"UNIT_TESTED "
+.LASF2080:
+	.string	"feature"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1990:
+	.string	"max_auto_climb_rate"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2025:
+	.string	"loiter_radius"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1271:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1741:
+	.string	"reversibleMotorsConfig_s"
+.LASF1745:
+	.string	"reversibleMotorsConfig_t"
+.LASF965:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1147:
+	.string	"MAX_SERVOS 16"
+.LASF1656:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1083:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1481:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1051:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1950:
+	.string	"AIRMODE_ACTIVE"
+.LASF1905:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF951:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF944:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1153:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1531:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1441:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1388:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2013:
+	.string	"braking_boost_disengage_speed"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1948:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1676:
+	.string	"int8_t"
+.LASF1327:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1720:
+	.string	"PLATFORM_ROVER"
+.LASF1949:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1006:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2008:
+	.string	"braking_disengage_speed"
+.LASF1958:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1384:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1266:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1936:
+	.string	"GPS_FIX"
+.LASF1216:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1989:
+	.string	"max_auto_speed"
+.LASF1840:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1552:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1533:
+	.string	"_Mdouble_ _Float32x"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1784:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1999:
+	.string	"min_rth_distance"
+.LASF1333:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1090:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1278:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1977:
+	.string	"user_control_mode"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1377:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1623:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1262:
+	.string	"__DECL_SIMD_atan "
+.LASF2057:
+	.string	"throttleRangeMax"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1539:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2085:
+	.string	"rpyMixMax"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1895:
+	.string	"WAS_EVER_ARMED"
+.LASF1692:
+	.string	"reset"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF1005:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF984:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1285:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1974:
+	.string	"axisPID"
+.LASF1018:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1925:
+	.string	"HEADFREE_MODE"
+.LASF1279:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1585:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF972:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF1466:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1454:
+	.string	"__DECL_SIMD_tanl "
+.LASF1749:
+	.string	"maxthrottle"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF785:
+	.string	"USE_LOG "
+.LASF1198:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1978:
+	.string	"rth_alt_control_mode"
+.LASF931:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1677:
+	.string	"int16_t"
+.LASF1408:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1575:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1663:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1953:
+	.string	"MULTIROTOR"
+.LASF1666:
+	.string	"signed char"
+.LASF1482:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF997:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1732:
+	.string	"motorDirectionInverted"
+.LASF1210:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1831:
+	.string	"AUX10"
+.LASF1832:
+	.string	"AUX11"
+.LASF1833:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1555:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1509:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1331:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF985:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1926:
+	.string	"NAV_LAUNCH_MODE"
+.LASF2028:
+	.string	"launch_accel_thresh"
+.LASF1811:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2092:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2094:
+	.string	"_right3"
+.LASF2096:
+	.string	"_right5"
+.LASF1803:
+	.string	"FEATURE_RSSI_ADC"
+.LASF1943:
+	.string	"COMPASS_CALIBRATED"
+.LASF1410:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF981:
+	.string	"sq(x) ((x)*(x))"
+.LASF1206:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1378:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1543:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1231:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1048:
+	.string	"GLOBAL_FUNCTION_FLAG_ENABLE(mask) (globalFunctionsFlags |= (mask))"
+.LASF1922:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1893:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1484:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1586:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1633:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1858:
+	.string	"BOXCAMSTAB"
+.LASF1374:
+	.string	"__DECL_SIMD_log2l "
+.LASF1698:
+	.string	"GLOBAL_FUNCTION_ACTION_SWAP_ROLL_YAW"
+.LASF2117:
+	.string	"getMotorCount"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1473:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1871:
+	.string	"BOXAIRMODE"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1525:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1914:
+	.string	"ARMING_DISABLED_OOM"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF945:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1142:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1435:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF1979:
+	.string	"rth_climb_first"
+.LASF1570:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF923:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF1267:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2083:
+	.string	"input"
+.LASF1684:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1060:
+	.string	"PG_PID_PROFILE 14"
+.LASF1750:
+	.string	"mincommand"
+.LASF1350:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF2058:
+	.string	"motorYawMultiplier"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2042:
+	.string	"yawControlDeadband"
+.LASF1796:
+	.string	"FEATURE_UNUSED_3"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1856:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1577:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1082:
+	.string	"PG_VTX_CONFIG 54"
+.LASF924:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF969:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1179:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1494:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1089:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1219:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1522:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1151:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1112:
+	.string	"PG_INAV_END 1023"
+.LASF1998:
+	.string	"rth_home_altitude"
+.LASF1222:
+	.string	"__DECL_SIMD_log "
+.LASF1038:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF947:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1869:
+	.string	"BOXFAILSAFE"
+.LASF1463:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1799:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1345:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF929:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1381:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1743:
+	.string	"deadband_high"
+.LASF1212:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1235:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1325:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1170:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF2118:
+	.string	"getThrottleIdleValue"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1817:
+	.string	"FEATURE_OSD"
+.LASF1691:
+	.string	"copy"
+.LASF1770:
+	.string	"motor"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1902:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1472:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1891:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1960:
+	.string	"stateFlags"
+.LASF1649:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1907:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1305:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF974:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1673:
+	.string	"long int"
+.LASF1881:
+	.string	"BOXCAMERA2"
+.LASF1882:
+	.string	"BOXCAMERA3"
+.LASF1226:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1065:
+	.string	"PG_SERVO_MIXER 21"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1375:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF1722:
+	.string	"PLATFORM_OTHER"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2037:
+	.string	"launch_climb_angle"
+.LASF987:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1187:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1866:
+	.string	"BOXOSD"
+.LASF1246:
+	.string	"__DECL_SIMD_powf32 "
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF2053:
+	.string	"reversibleMotorsThrottleState"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF2065:
+	.string	"primaryMotorMixer_Registry"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1031:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1965:
+	.string	"PID_POS_Z"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF1132:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1339:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1217:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1730:
+	.string	"primaryMotorMixer_CopyArray"
+.LASF1507:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF926:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1185:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF2115:
+	.string	"mixerIsOutputSaturated"
+.LASF1921:
+	.string	"HEADING_MODE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2016:
+	.string	"posResponseExpo"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1019:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1996:
+	.string	"emerg_descent_rate"
+.LASF1342:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1774:
+	.string	"PWM_TYPE_ONESHOT125"
+.LASF1740:
+	.string	"mixerConfig_Copy"
+.LASF1927:
+	.string	"MANUAL_MODE"
+.LASF1257:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1513:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1680:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1467:
+	.string	"__f128(x) x ##f128"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF1929:
+	.string	"AUTO_TUNE"
+.LASF1487:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1580:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1328:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1372:
+	.string	"__DECL_SIMD_log2 "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1497:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1014:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF2056:
+	.string	"throttleRangeMin"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1068:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2086:
+	.string	"rpyMixMin"
+.LASF1391:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1854:
+	.string	"BOXNAVALTHOLD"
+.LASF1488:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1542:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1163:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1063:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF1401:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1303:
+	.string	"__DECL_SIMD_exp10f "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1069:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1490:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF1868:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1665:
+	.string	"long unsigned int"
+.LASF1704:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_BAND"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1385:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1576:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1857:
+	.string	"BOXHEADADJ"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1079:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF962:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF1258:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1149:
+	.string	"PULSE_1MS (1000)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1211:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1932:
+	.string	"FLAPERON"
+.LASF1875:
+	.string	"BOXSURFACE"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1188:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1050:
+	.string	"PG_CF_START 1"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1650:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF1711:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_INVERT_PITCH"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1615:
+	.string	"LAT 0"
+.LASF1675:
+	.string	"char"
+.LASF1545:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF1368:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1430:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1592:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1865:
+	.string	"BOXNAVLAUNCH"
+.LASF1428:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1476:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1715:
+	.string	"globalFunctionValues"
+.LASF1791:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF994:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1721:
+	.string	"PLATFORM_BOAT"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF2097:
+	.string	"currentMotorStatus"
+.LASF1282:
+	.string	"__DECL_SIMD_hypot "
+.LASF1818:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1173:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1238:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1775:
+	.string	"PWM_TYPE_ONESHOT42"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1197:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1369:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1261:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF941:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1115:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1154:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF2060:
+	.string	"reversibleMotorsConfig_Registry"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1004:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1020:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1012:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF2111:
+	.string	"motorMaxDec"
+.LASF1107:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1199:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1098:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1168:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1253:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1239:
+	.string	"__DECL_SIMD_expf32x "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1768:
+	.string	"MOTOR_DIRECTION_DEADBAND"
+.LASF1000:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1133:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1471:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1819:
+	.string	"ROLL"
+.LASF1395:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF1994:
+	.string	"land_slowdown_minalt"
+.LASF1341:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF980:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1344:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1233:
+	.string	"__DECL_SIMD_expf "
+.LASF1240:
+	.string	"__DECL_SIMD_expf64x "
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1654:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF1074:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1962:
+	.string	"PID_ROLL"
+.LASF1448:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1277:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1470:
+	.string	"__HAVE_FLOAT16 0"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1480:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2123:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1433:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1160:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1409:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1141:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF1026:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF1992:
+	.string	"max_manual_climb_rate"
+.LASF2070:
+	.string	"failsafeIsActive"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1600:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF934:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1756:
+	.string	"throttleIdle"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF966:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2009:
+	.string	"braking_timeout"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1180:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1567:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1300:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1655:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1459:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1402:
+	.string	"__DECL_SIMD_acosh "
+.LASF1046:
+	.string	"MAX_GLOBAL_FUNCTIONS 8"
+.LASF1458:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1554:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1379:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1587:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1763:
+	.string	"MOTOR_STOPPED_AUTO"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1359:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF1315:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1573:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1140:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF1708:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE_SCALE"
+.LASF1778:
+	.string	"PWM_TYPE_DSHOT150"
+.LASF1697:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE_SCALE"
+.LASF991:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1165:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF1505:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1966:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2000:
+	.string	"rth_abort_threshold"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1047:
+	.string	"GLOBAL_FUNCTION_FLAG_DISABLE(mask) (globalFunctionsFlags &= ~(mask))"
+.LASF973:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1118:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1252:
+	.string	"__DECL_SIMD_acos "
+.LASF1867:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1138:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2031:
+	.string	"launch_throttle"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1944:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1323:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1347:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF952:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1229:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2021:
+	.string	"control_smoothness"
+.LASF956:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1984:
+	.string	"auto_overrides_motor_stop"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF928:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1571:
+	.string	"M_E 2.7182818284590452354"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2043:
+	.string	"navConfig_s"
+.LASF2045:
+	.string	"navConfig_t"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF2071:
+	.string	"calculateThrottleCompensationFactor"
+.LASF1961:
+	.string	"double"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF1941:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1434:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1255:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1034:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1491:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1126:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1911:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1769:
+	.string	"reversibleMotorsThrottleState_e"
+.LASF1660:
+	.string	"DEFAULT_MAX_THROTTLE 1850"
+.LASF1511:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF1184:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1037:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1425:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1594:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1053:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1766:
+	.string	"MOTOR_DIRECTION_FORWARD"
+.LASF1429:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2128:
+	.string	"rc_alias"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1795:
+	.string	"FEATURE_GPS"
+.LASF1938:
+	.string	"SMALL_ANGLE"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1951:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1841:
+	.string	"rcControlsConfig_s"
+.LASF1849:
+	.string	"rcControlsConfig_t"
+.LASF1166:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1931:
+	.string	"NAV_CRUISE_MODE"
+.LASF1874:
+	.string	"BOXKILLSWITCH"
+.LASF1499:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1566:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1672:
+	.string	"__uint32_t"
+.LASF1845:
+	.string	"alt_hold_deadband"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1986:
+	.string	"pos_failure_timeout"
+.LASF1804:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1066:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1406:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1916:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF1988:
+	.string	"waypoint_safe_distance"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1301:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1946:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1254:
+	.string	"__DECL_SIMD_acosl "
+.LASF1067:
+	.string	"PG_RX_CONFIG 24"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1516:
+	.string	"_Mdouble_"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1182:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1492:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1432:
+	.string	"__DECL_SIMD_asinh "
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1390:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1243:
+	.string	"__DECL_SIMD_powf "
+.LASF1510:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF1030:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1249:
+	.string	"__DECL_SIMD_powf32x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1736:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF2049:
+	.string	"currentMixer"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1716:
+	.string	"PLATFORM_MULTIROTOR"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1541:
+	.string	"__MATHCALL"
+.LASF1366:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1108:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1800:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF1939:
+	.string	"FIXED_WING_LEGACY"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1070:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF786:
+	.string	"USE_STATS "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1099:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1879:
+	.string	"BOXAUTOTUNE"
+.LASF2032:
+	.string	"launch_motor_timer"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1419:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1392:
+	.string	"__DECL_SIMD_atanh "
+.LASF1205:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF1863:
+	.string	"BOXLEDLOW"
+.LASF1826:
+	.string	"AUX5"
+.LASF1500:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1828:
+	.string	"AUX7"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1829:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1830:
+	.string	"AUX9"
+.LASF1111:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1442:
+	.string	"__DECL_SIMD_erfc "
+.LASF1934:
+	.string	"flightModeFlags"
+.LASF975:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF921:
+	.string	"__FAST_MATH__ 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1483:
+	.string	"__f32(x) x ##f32"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF1589:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1092:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1629:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1080:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1644:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1890:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1321:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1283:
+	.string	"__DECL_SIMD_hypotf "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2033:
+	.string	"launch_motor_spinup_time"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF1268:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1478:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1563:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1420:
+	.string	"__DECL_SIMD_erff64x "
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1361:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2036:
+	.string	"launch_max_altitude"
+.LASF1714:
+	.string	"globalFunctionsFlags"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1247:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2113:
+	.string	"mixerUpdateStateFlags"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1213:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1682:
+	.string	"pgn_t"
+.LASF1521:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1622:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1786:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF971:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1625:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1269:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1616:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF976:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1293:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1101:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1209:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1787:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1039:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1124:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1731:
+	.string	"mixerConfig_s"
+.LASF1738:
+	.string	"mixerConfig_t"
+.LASF1462:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1603:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1029:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1872:
+	.string	"BOXHOMERESET"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2067:
+	.string	"motorRateLimitingApplyFn"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1779:
+	.string	"PWM_TYPE_DSHOT300"
+.LASF1028:
+	.string	"EXPAND_I(x) x"
+.LASF1139:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2120:
+	.string	"rcControlsConfig"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1526:
+	.string	"_Mdouble_ _Float32"
+.LASF2054:
+	.string	"throttleDeadbandLow"
+.LASF1717:
+	.string	"PLATFORM_AIRPLANE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1054:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2005:
+	.string	"hover_throttle"
+.LASF1383:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1713:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_THROTTLE"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1040:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1320:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2050:
+	.string	"motorCount"
+.LASF1908:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF1431:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1302:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1376:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1290:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1407:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF927:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF1207:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF1753:
+	.string	"motorAccelTimeMs"
+.LASF1423:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1167:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1455:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF2061:
+	.string	"pgResetTemplate_mixerConfig"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1593:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1250:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1183:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1162:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1025:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1393:
+	.string	"__DECL_SIMD_atanhf "
+.LASF935:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1264:
+	.string	"__DECL_SIMD_atanl "
+.LASF866:
+	.string	"USE_UART8 "
+.LASF1335:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1619:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1506:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1304:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1013:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2106:
+	.string	"mixerInit"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1189:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF394:
+	.string	"bool _Bool"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1308:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1956:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1418:
+	.string	"__DECL_SIMD_erff128 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1203:
+	.string	"__DECL_SIMD_sinf "
+.LASF1044:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1256:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1959:
+	.string	"FW_HEADING_USE_YAW"
+.LASF1653:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF2051:
+	.string	"throttleIdleValue"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1343:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1075:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1957:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF1244:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1221:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1426:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1788:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF2112:
+	.string	"nullMotorRateLimiting"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF960:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF999:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1870:
+	.string	"BOXNAVWP"
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1091:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF937:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1536:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1816:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF1078:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF988:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2084:
+	.string	"rpyMix"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1976:
+	.string	"extra_arming_safety"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1955:
+	.string	"BOAT"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1447:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF2068:
+	.string	"navigationIsFlyingAutonomousMode"
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1100:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1583:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1546:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1835:
+	.string	"THROTTLE_HIGH"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1195:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1176:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1116:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1617:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF948:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1973:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF990:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1565:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF2034:
+	.string	"launch_min_time"
+.LASF1045:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1648:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF2035:
+	.string	"launch_timeout"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF2105:
+	.string	"motorZeroCommand"
+.LASF1421:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1157:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1912:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1059:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1632:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1313:
+	.string	"__DECL_SIMD_coshf "
+.LASF1077:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1709:
+	.string	"GLOBAL_FUNCTION_FLAG_OVERRIDE_SWAP_ROLL_YAW"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1701:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_PITCH"
+.LASF1294:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1762:
+	.string	"MOTOR_STOPPED_USER"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF993:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1883:
+	.string	"BOXOSDALT1"
+.LASF1884:
+	.string	"BOXOSDALT2"
+.LASF1885:
+	.string	"BOXOSDALT3"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1667:
+	.string	"__int8_t"
+.LASF1109:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1220:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1627:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF2015:
+	.string	"posDecelerationTime"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1022:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF953:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF1614:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1601:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1135:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1134:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1923:
+	.string	"NAV_RTH_MODE"
+.LASF2077:
+	.string	"delay"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF986:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1349:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2044:
+	.string	"general"
+.LASF1086:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1696:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_ARMING_SAFETY"
+.LASF1664:
+	.string	"unsigned int"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF2019:
+	.string	"cruise_throttle"
+.LASF1286:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1097:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1451:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1588:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1781:
+	.string	"PWM_TYPE_DSHOT1200"
+.LASF1143:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF1590:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1172:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2099:
+	.string	"stopPwmAllMotors"
+.LASF2116:
+	.string	"getMotorMixRange"
+.LASF1353:
+	.string	"__DECL_SIMD_atan2f "
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1424:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF961:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1502:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1670:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1842:
+	.string	"deadband"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1355:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF1058:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1537:
+	.string	"__MATHDECL_1_IMPL"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1933:
+	.string	"TURN_ASSISTANT"
+.LASF1444:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1572:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF940:
+	.string	"EXTENDED_FASTRAM "
+.LASF1382:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1595:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1309:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1641:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2075:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1360:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1742:
+	.string	"deadband_low"
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF958:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2108:
+	.string	"motorPrevious"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1332:
+	.string	"__DECL_SIMD_sinh "
+.LASF1985:
+	.string	"flags"
+.LASF1104:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1227:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1438:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF2079:
+	.string	"constrainf"
+.LASF1754:
+	.string	"motorDecelTimeMs"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF1071:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1125:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2202:
+	.string	"io_types.h"
+.LASF2194:
+	.string	"common_post.h"
+.LASF2209:
+	.string	"math.h"
+.LASF2179:
+	.string	"long-double.h"
+.LASF2188:
+	.string	"__locale_t.h"
+.LASF0:
+	.string	"./src/main/flight/mixer.c"
+.LASF2138:
+	.string	"src/main/rx"
+.LASF2203:
+	.string	"servos.h"
+.LASF2192:
+	.string	"target.h"
+.LASF2215:
+	.string	"fp-logb.h"
+.LASF2166:
+	.string	"battery.h"
+.LASF2173:
+	.string	"libc-header-start.h"
+.LASF2171:
+	.string	"stdbool.h"
+.LASF2146:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2137:
+	.string	"src/main/navigation"
+.LASF2150:
+	.string	"stdint-intn.h"
+.LASF2159:
+	.string	"rc_controls.h"
+.LASF2197:
+	.string	"axis.h"
+.LASF2145:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2148:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2157:
+	.string	"adc.h"
+.LASF2164:
+	.string	"mixer.c"
+.LASF2140:
+	.string	"src/main/target/SITL"
+.LASF2221:
+	.string	"rx.h"
+.LASF2210:
+	.string	"math-vector.h"
+.LASF2136:
+	.string	"src/main/io"
+.LASF2155:
+	.string	"mixer.h"
+.LASF2162:
+	.string	"pid.h"
+.LASF2144:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2165:
+	.string	"failsafe.h"
+.LASF2158:
+	.string	"config.h"
+.LASF2207:
+	.string	"imu.h"
+.LASF2189:
+	.string	"strings.h"
+.LASF2175:
+	.string	"features-time64.h"
+.LASF2169:
+	.string	"feature.h"
+.LASF2156:
+	.string	"pwm_mapping.h"
+.LASF2213:
+	.string	"floatn-common.h"
+.LASF2212:
+	.string	"floatn.h"
+.LASF2161:
+	.string	"runtime_config.h"
+.LASF2133:
+	.string	"src/main/drivers"
+.LASF2147:
+	.string	"/usr/include"
+.LASF2211:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2130:
+	.string	"src/main/build"
+.LASF2183:
+	.string	"time64.h"
+.LASF2174:
+	.string	"features.h"
+.LASF2135:
+	.string	"src/main/flight"
+.LASF2182:
+	.string	"typesizes.h"
+.LASF2168:
+	.string	"pwm_output.h"
+.LASF2131:
+	.string	"src/main/common"
+.LASF2132:
+	.string	"src/main/config"
+.LASF2163:
+	.string	"navigation.h"
+.LASF2160:
+	.string	"rc_modes.h"
+.LASF2151:
+	.string	"stdint-uintn.h"
+.LASF2141:
+	.string	"src/main/target"
+.LASF2199:
+	.string	"utils.h"
+.LASF2200:
+	.string	"logic_condition.h"
+.LASF2204:
+	.string	"rx_pwm.h"
+.LASF2218:
+	.string	"mathcalls.h"
+.LASF2139:
+	.string	"src/main/sensors"
+.LASF1:
+	.string	"/root/repo"
+.LASF2214:
+	.string	"flt-eval-method.h"
+.LASF2142:
+	.string	"src/main"
+.LASF2206:
+	.string	"bitarray.h"
+.LASF2153:
+	.string	"time.h"
+.LASF2201:
+	.string	"parameter_group_ids.h"
+.LASF2195:
+	.string	"debug.h"
+.LASF2184:
+	.string	"wchar.h"
+.LASF2216:
+	.string	"fp-fast.h"
+.LASF2205:
+	.string	"stats.h"
+.LASF2220:
+	.string	"gps.h"
+.LASF2134:
+	.string	"src/main/fc"
+.LASF2191:
+	.string	"common.h"
+.LASF2219:
+	.string	"quaternion.h"
+.LASF2180:
+	.string	"stubs.h"
+.LASF2154:
+	.string	"global_functions.h"
+.LASF2167:
+	.string	"maths.h"
+.LASF2177:
+	.string	"timesize.h"
+.LASF2185:
+	.string	"string.h"
+.LASF2193:
+	.string	"sanity_check.h"
+.LASF2143:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2187:
+	.string	"locale_t.h"
+.LASF2172:
+	.string	"stdint.h"
+.LASF2196:
+	.string	"build_config.h"
+.LASF2186:
+	.string	"stddef.h"
+.LASF2181:
+	.string	"stubs-64.h"
+.LASF2217:
+	.string	"mathcalls-helper-functions.h"
+.LASF2208:
+	.string	"vector.h"
+.LASF2176:
+	.string	"wordsize.h"
+.LASF2149:
+	.string	"types.h"
+.LASF2178:
+	.string	"cdefs.h"
+.LASF2152:
+	.string	"parameter_group.h"
+.LASF2190:
+	.string	"platform.h"
+.LASF2170:
+	.string	"stdc-predef.h"
+.LASF2198:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \bA"
+	.string	""
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001'"
+	.text
+	.section	.gnu.lto_.icf.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`5\003\215\020"
+	.string	"\264\023)\004"
+	.string	"2"
+	.string	"\250\320\377\273\f"
+	.string	"\001\300\210\210\310\b\b\002"
+	.string	"\002"
+	.string	"\002\001\002\002\352\263\360\321\b\003\240\342\234\212\n\004\323\377\206\345\b$\002\003\002\004\002\005\002\006\002\007\002\007\002\001\002\b\002\t\002\t\007\002\007\005\006\353\263\241\237\002\007\b\t\n\344\347\334\240\013\004\002\n\002\n\002\007\002\013\r\215\272\206\361\016\f\t\002\t\016\263\264\300\262\004\002\017\320\375\270\353\017\002\002\005\002\005\020\021\351\241\346\355\002\022\360\276\207\245\016&\f\r\023\024\243\253\353\265\f0"
+	.string	"\002"
+	.string	"\003\002\004\025\026\027\030\031\032\307\254\277\243\017\"\002\016\002\016\017\002\020\005\002\005\002\001\002\021\022\023\002\f\002\023\033\034\035\315\343\301\244\013\037 !\242\302\263\302\013\"\235\243\330\243\r\004#\255\312\206\340$\245\370\320\323\f\b%\264\317\250\346\t&\322\210\263\372\016\002'\261\332\314\323\002\242\001\002\003\002\024\025\005\002\020\002\026\002\026\027\024\004\002\004-/\253\276\312\225\013\0040\313\346\310\307\t12\261\226\235\364\0173\251\224\213\251\01345\373\210\337\313\0036\210\306\274\324\00678\271\245\270\264\0029\370\235\267\254\f:\240\342\234\212\n"
+	.string	"s\250Q\252`H\306\024\024\262\263\006p\202\241\"\243\007\022"
+	.ascii	"\006\232b\241\314&-\354\177\006\360/\365n\367\357\306\264U\206"
+	.ascii	"\307\250q\240d\226b|,\232\344\357\364\245\353o\237\236\206\230"
+	.ascii	"\205d\277>\333\275\264\344aG-\351FtQ\334[\351\354=\177\253\302"
+	.ascii	"\345q\332\357\207\212x#*%\261~s\250\374P\271z\017\243\2049\025"
+	.ascii	"\034\326\225\332}\222\0029\f/FU\331\006\275\366\341\363y\242"
+	.ascii	"\346\242w\327nM\207\261r\346\035\237]!0C\304\022\035\003\330"
+	.ascii	"C \337\316ie\035\230xf\"6Pw\266\207 \013\202\034\370\351~\315"
+	.ascii	"\323Z\372?\314\2350\201\250\363eS\032\343\377\241\346\325t\335"
+	.ascii	"\022\225\0176\237X3\024\037\216\361W\034\354\341W\027T\377\352"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \252e\003"
+	.string	"\344\003\236"
+	.string	"\022"
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\001\001\001"
+	.string	"\003"
+	.string	""
+	.string	"\004\003"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	"\r"
+	.string	"\003\016"
+	.string	"\003\017"
+	.string	"\003\021"
+	.string	"\003\022"
+	.string	"\001\024"
+	.string	"\032"
+	.string	"\001\"#\001"
+	.string	"\001$%&"
+	.string	"\003"
+	.string	"\002'\001\001\001/"
+	.string	"\001"
+	.string	"\023"
+	.string	"A\t\220S@\205\307\241\226=\265\017\254\350\\\200\262\b+9\225`,\221)u\001\314\376\264a1pi\bj]/Xm"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\312\002\305\r"
+	.string	"\226\322F< \261\322\001\270G\323e\002\247\316\311\374\240\r>\361\n\037x0\240\b\376E\\0\275\032\342a\354\025\0203\\\327\004\002QH\020\b@\r\277%$d\232\311\311\344\204\205C\210\224;\005/"
+	.string	"5"
+	.string	";"
+	.ascii	"&~\275b^*\305\376|\332\r\217\363\344(\377.r\210;\272\233\334"
+	.ascii	"\277\216\266\244\273\307\327\177\001\376\211\356F\375\373W\320"
+	.ascii	"vw\363_\236G\002:\364\006\301\027:\364\306\360\022\364\205\026"
+	.ascii	"|\207\005\"v\371\373(\332\217\356.\020m\332\335\345\003\376s"
+	.ascii	"\366&+D&f\361!-jKq\371<\274\311\342\277\216`0\032\256\232\201"
+	.ascii	"#\220\370\346\244\245\341\017D&q\353\244\245\342\376\325\264"
+	.ascii	"0\027\215L\274AXS\313\222\253\265L\023c\344j\034\r\377\224\026"
+	.ascii	"U\365f\240\022\307T\275\331\303=\243\265\005_Y\361pc\313\212"
+	.ascii	"\207\013\357@~\037\301\312\331\023\357t\0258vI\254\211\315\214"
+	.ascii	"\310\246\b\026P\233\001\222S!a\251t\327\271\302M\226\210I\022"
+	.ascii	"\252\354\244\245\236\375ki\003D\250A\255s\002\231\242[V\332p"
+	.ascii	"\002\231A*\017\021\360\0345\322D\026\beX\317\006\031\222\311"
+	.ascii	"\242\027^\001JR*\340\311\200\224\300\370?\233\351b\267\247\323"
+	.ascii	")y()k\"\024\266P?\246\203f7\377 ;\247p\347Ic\2334\360\202_a\234"
+	.ascii	"\326\020:O%\335\223\3052\006H[\276P\2036\314gt6}\005\254H2I\377"
+	.ascii	"\333\"XzV\224\007\201)D\026\346\354;\275\372jx\303\277) \256"
+	.ascii	"\004\372z43\254#\200%\3123b\317\322\345H2;\307\211\332\314;"
+	.text
+	.section	.gnu.lto_.jmpfuncs.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\201\001\025\b"
+	.ascii	"b\312\037&\220)i\f\377\377x\035\217\022\200\377\377\301Zs3\323"
+	.ascii	"\2633A\f\261\332\003?\006\020\200L>i\020'\325\3362\245*C\343"
+	.ascii	"h2\177\234\331\024\243\205m\264\326\304K\354k=(\265\025g;\333"
+	.ascii	"+\230\340\013\301\341\270\341\016d\fDk\001\3148g\234\215$-\220"
+	.ascii	"\201 PE\007\024Q\001\rh\2347\316\376\364\250\035\261\231.\032"
+	.ascii	"\325\250[\314A\237\364\364$\247g\223\037g\213\351\253h\016\001"
+	.ascii	"7 @\002\202\024K;[@\246\355\270\f\360\300Ap\016bd\206\353@\220"
+	.ascii	"\r\301\033\200\337\255\377\305\265\200T3n\004 .\016\322\361i"
+	.ascii	"\232\231q@{\320\315\001\342g6\031\334\367\3000o\206^\311\361"
+	.ascii	"\361\353\267!\002zN@!W\352X\264\3738\314=h\227]\210q\214\242"
+	.ascii	"\257\306\2677\261\021<A\207\031x``.\337-\254\354\007Z|`\256\330"
+	.ascii	"p\232 \322\205-\340\211\006&\304\002\270\001"
+	.text
+	.section	.gnu.lto_.pureconst.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 ;\331\001"
+	.string	"7"
+	.string	""
+	.string	""
+	.string	"\022"
+	.ascii	"\200\004\001\230\004\004\230\004\n\230\004\r\230\004\016\204"
+	.ascii	"\004\017\204\004\021\204\004\022\230\004\024\230\004\032\231"
+	.ascii	"\004\"\230\004#\230\004$\230\004%\230\004&\230\004'\230\004/"
+	.ascii	"\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\240"
+	.string	"\245\005"
+	.ascii	"\242\207\024\032\220+\303\001\377\377\377\377\177\212\377d\023"
+	.ascii	"2\362\375\247B~\216\205\204\375;\311\024\252{<\233\255\347\202"
+	.ascii	"\230\002\215.\225Y\246T\345\034\204\2169\0304=\202K\274\313N"
+	.ascii	"=\325\017T\331\241'z\201\342\351\330\245g\343\0012\236\213]\362"
+	.ascii	"L\336g\301E\002* `\2021\307\354\006-\024$\016\270\023\342\335"
+	.ascii	"\210\275\220(\274\334\3301\t2\200\002}\270r\262\255@Q`\3126\356"
+	.ascii	"\367\022\333\026\200\2709':\b\264F\327a\342\023\214X\034\271"
+	.ascii	"\201u\353\231!\006o'ao\301\306[P.\321\304~`\307\271.\274\354"
+	.ascii	"\273j0\266g+\275X\344W\\7"
+	.text
+	.section	.gnu.lto_.lto.c50d13f54ce853f5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_reversibleMotorsConfig_Registry.121.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \224M\004"
+	.string	"\264\007`"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\315\221\023\031\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\314\030us\327\007uq"
+	.string	"\005\001\006'\001\006\032?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\302\303,\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_reversibleMotorsConfig.123.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 1]\001"
+	.string	"\004\002$"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\264\013\352\376\n?\202\210\200\030\177}\275\001{\274\001y\273\001"
+	.string	"\003"
+	.ascii	"`\204\3125\003(\002"
+	.text
+	.section	.gnu.lto_mixerConfig_Registry.127.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \226e\004"
+	.string	"\344\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\325\201\025\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\006us\250\366\005uq"
+	.string	"\005\001\006'\001\b\224\340"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_mixerConfig.129.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 @\315\001"
+	.string	"\304\0023"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\031\001\177\005\001\006\177\035\030\001"
+	.string	"?\202\210\200(}{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\004"
+	.ascii	")\"^\316\244X=\200\""
+	.text
+	.section	.gnu.lto_motorConfig_Registry.133.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \226M\004"
+	.string	"\224\007b"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001\212\001\206\200\200\374\342\303\347\361\023\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\250\335\006us\350\365\005uq"
+	.string	"\005\001\006'\001\034\206\2400om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\005"
+	.string	"Z\tN\271\t&\361\024u\337"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetTemplate_motorConfig.135.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \202\r\003"
+	.string	"\244\004u"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\016\005\001#\202\200\200\204\002"
+	.string	""
+	.string	"\200\001\317"
+	.string	"\b\360\006'\001'\001\220\003\350\007\272\016?\202\210\200\310\001\177}\302\001{\301\001y\300\001w\277\001u\276\001s\276\001q\275\001o\274\001m\273\001"
+	.string	"\t"
+	.string	"@\260\312Q\212\005[\315\200{`\263\234\331\005\004\f"
+	.ascii	"\016"
+	.text
+	.section	.gnu.lto_primaryMotorMixer_Registry.139.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \207\365\003"
+	.string	"\004\007S"
+	.string	""
+	.string	""
+	.string	"("
+	.string	"\005\001?\202\210\200\b\177}0\005\001\006{\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\366\261\027\006yw\350\354\005yu"
+	.string	"\005\001\006'\001\300\001\0040sq\300\001o\277\001m\276\001k\275\001i\274\001g\273\001"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/flight/mixer.c"
+	.string	"\004"
+	.ascii	"\\\205\240r?h\2227\200\""
+	.text
+	.section	.gnu.lto_getThrottleIdleValue.141.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\317\001\275\017"
+	.string	"&]eD\360\260(\035\352\377c\262\322K\345\020\275\226G\301\343\246\340\217\211\016{\346\377w-\343\255\204\253\221\346\372\207D\370\026\367\354\244\005Ap\213\303%\311\254\2432\024\304q\311v)\260\372V\373\366\177Bv\222)\005Q"
+	.string	"F"
+	.string	"U"
+	.ascii	"7\322\205\246\202C\353W\252\035\325\037\f\"\325\352<XLg\027\036"
+	.ascii	"\026\02252\223\013\261\200\315\332s\200\315\33278\345wL\325\237"
+	.ascii	"\221\347!&\346\352V\3740\370\035\035\353\205d\246C\030-t+\304"
+	.ascii	"\317Hf\026]]\213\253\271m\202\266\004ZT\020\365L)4\007\355\262"
+	.ascii	"V7g\263\346\223d\031T8+\306l\300H\354ia+<L\353\227\177i\215\365"
+	.ascii	"0\266t,\351\330\321\261\242cC\307\202\214\375\030\273!V;\366"
+	.ascii	"\031{\304\242\261\006 jy\001\322\"\363\302,&B\307\024\262\327"
+	.ascii	"\347\240\203\320h\355l\377\374\003G\253\303\ng\325\276=p\254"
+	.ascii	"\204v\237\220\275\376\367\rGk\347\277Yr\264'\036q\002e\262\016"
+	.ascii	"\3245\266\231P\317X+\212\212\312f\ro@\346E\212\365`f\256\374"
+	.ascii	"0\005\3543\260\221\261\220\247\265\b\303\252\023%\021A\225T0"
+	.ascii	"\235p)\016LL\020\032p\021L\013N8\022\024\n'\362\321\223\204\022"
+	.ascii	"\024\227r:\241\270\021L\345\227\177\361x\210\352\253\342x\274"
+	.ascii	"C\346\246{\245\243\260K\306K\377\212\026\213\321\337I\032p\354"
+	.ascii	"\022\243\006\226E0\233\315`e\252\006\210>\272[4\241\203.\242"
+	.ascii	"Y\231\370\306\024' p\002\241)\244\007bB_I\340:\302\026\\LI\300"
+	.ascii	"\020\320\222\345$\215\201 \222\034\006\211I+\224\206`s\267\017"
+	.ascii	"\321k\342\352\373\302\027Dq\241K\371\214#\212+\333\271\t\241"
+	.ascii	"\244h3.@J7a$J\231u\n+\346\352\357v&2\307\210(=8\240\013\321\306"
+	.ascii	")\253\261]\270\f"
+	.text
+	.section	.gnu.lto_getMotorCount.143.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \354\245\006"
+	.string	"b\214.5Pm\222\016\260&\210\251Is\026u\267\216\002\334\317\306\225\271\341\337\267n\330\277\333\211\334*\270\303\242\031v\334\314L\221\210{+\204e\244\251D\255\265O\266L\001g0\230&\302\332<\016\303\202\325\240\360\034\254\204\315\313`\020\017\023\360\365\240\301\036\347\272\260WmYGB'"
+	.string	"r\023\337\217\202dwc\211\016V+u;\226R\350"
+	.string	"L\025 <]]$\242\374\366AW\372V\322\221~\034\335\200\251%&\231\241SJ\222P#\034\277\347\253\r\016<g\3352B\226\222\005E\310I\346\366\034F\263bv\353\321J\207\206\210&\372\024/\b\2319j\242Qw\375\t\376\202\177\024\b"
+	.ascii	"2\001\0038\003Z\034\240k\370_\304XB\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_getMotorMixRange.144.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \376\005\007"
+	.string	"\202\21516@o\222\016@\265\220\246O\321\375\200\307\354\321\276\030\374P\021\366\030Xj\233\352\3775\325m\\\215\356\252\357q\206ab\212\271y\350\241\n\341\340\353\330\326\032!2\005o4\031'\342\352D\017\303\302\325\240\020\035\256\204N\334d\020QC0\366\300\311\242\007\303\262huY\310=\230\001\301\211/I\273IW\264\304\243\327\255\324}T\225z0\200\343\002\364J[\030\371\\\276\373<\230\361\235\022r\337\367\203"
+	.string	"')\007+\231\025\245\227D\241L>~\355\255\033R\021\355IS\267!\252\212\007EIKf\306L\007\252RS\005\252RP\243Z\237v;\322\t\244\203e\013}\3720\b\231\371\333B\026\035\366/\370\r~.\b"
+	.ascii	"2\001\0178c`\034\240k\370n\304\320Bd\342\256\230\332I\006"
+	.text
+	.section	.gnu.lto_mixerIsOutputSaturated.145.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"5\007"
+	.string	"R\316250\217\222\016\260\024\352`\314\001\345"
+	.string	"r\330\367\327\033I\272\f\306\250\217\245\226\033\302\257\315\375\331\017\272_CUPP\310\200\321\201D<=\237A\236\017\331\275e\no4\030\247\242\343i \210\207N\204C\223\3504x\332\006\243h\232\201?\023\034\254\201>\037\254e\262\354\210\005$,\275\253\337E&\311\240\210X\023\253t\257\357HY\273.\310\026\267\256\247b\356-\200b\212\004\036\031\244{\235\321\310c\371lt\250\372^23\307\215\377\306\273{\021PAIpe\242^-y\202)\t\371C\237Ya!\264\250Y\007\252\252\225\211d%3k\310QQOt+\322K\312\207\311)5\352\0050d\346wJat\354\177\360#\374\253\t"
+	.ascii	"2\003\302\2606\334\340m\371\024\304\236k\364\022\"\207;gj\347"
+	.ascii	"\023"
+	.text
+	.section	.gnu.lto_mixerUpdateStateFlags.146.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\372\005%\031"
+	.string	"v(\222K\240\024R:\244\347\227\205\336\021\257y\024\365n\254b\237\034\354B\032\314\004\332\350\\\332=\362\227r\273\200\337\317\353CI\016Zu\312\3516\351x\n\257\323\353\360:\274\2709z\377\223\032\277\004q\205\265=\233\261\366\023B\210\224I\006~"
+	.string	"i"
+	.string	"\204"
+	.ascii	"\273U'\376\324+\025\365\224\220\324Zo\215\3423\257\321f\250,"
+	.ascii	"v\302^.\263$\307\346\231\275\231\362\362\001i^\243\001}\366C"
+	.ascii	"\364\023\241\037\017\243'\262\341\016\307\316\021B?\021\f{I\375"
+	.ascii	"t\306\002B\277\020\3542Sj\255\357\301\031\336\274\324O\330\343"
+	.ascii	"2\347"
+	.string	"\344\006\r<\006\337\243\202!\217 \n\264\031\003D\231 r\242\363\r\220\307l\246\324Z\227}@\234\257\355\273?\260\273\tv\311\236\2470'x\342p\021\370\242\033\355\366AkA\206\357;\271\227)O\276\001P\tk8]\216\221JUN\262K\344q\237\330\375X\333g\367\274&\347\265\235\267v^Z\363\316\316\213\236Wv\336\330y\317\363\302\316\373:\257\353\274\346y\313\363\222\347\035\231\267\317\313\347\275\0014'j\201V\255\036R%\025\212dR\261\273?w&N;^M?[W6^\233\001\275\321\301KYQ%\\\256\034D\263]8n0\231K&yT\2265\230\004\331\245\013\"\031d\013\240\022\306\212C\344(\241\213-\306\021Fs\250\277\357J\356\261\271H/\310BhE\254\310\363\024\276!T\337\245\354VI\242\262\341\255\335\305]\311\305U\253\r\203}\322_\274\354\203Nn\016\006\246<\331="
+	.string	"\310\250\270\323H\367\035\231-\351\245V\337\225on\236\321\023\3628\335\273\202\242c\271\200{\271\305Dh\301M\200p\243\200{\360r[\321\355n(\0046W\201Ew\213\311\345t\267\223X\363\366q"
+	.ascii	"\002\252\246y5\023\2544M\217\276+mm\322\357\t\257l4>\320jUK\374"
+	.ascii	"\256\244u\255?\204\226r\255\225f\206\241\234\265J\222\020\226"
+	.ascii	"\007i\231\232-AQ \262F\265~\310\262\020du\320\2211\326Z!=M\305"
+	.ascii	"bPM?;f\344\351\364\321`\bHuv\017\030\314\351\277Z\277+_\r\013"
+	.ascii	"\200\210\250A\214\003\t\221H\212\222\222J: \003\021\021\352\034"
+	.ascii	"\021`@\311\020tS\301\232\031\003S\301\355\202j\234\260\b\007"
+	.ascii	"\274\202\031\225;\272\205\027\346\027\310\354\367m<\247d\302"
+	.ascii	"\210\230y\354\276\264R\235\244\277\225t\030\364kjv1X\3023*S\246"
+	.ascii	"\n\312\305\00628R\312\343S\032z6\276\327\356Ka>f\bHy\027B \270"
+	.ascii	"\257\342)K\336\260\207\003\016h\201\"\225q\\\202\3157\252\201"
+	.ascii	"=\277\b\232\245\360\334\033\207\2402\024E\250\242I\271\306@;"
+	.ascii	"@o,\225e\037\322d\200M\021\216->_\313\303\311(j\261\377\366O"
+	.ascii	"R\374\367\336\225R_ \"\253fH\213\334\342-x\004\231\267\020\202"
+	.ascii	"~\240d\341\227`\222\364\003\261\353#\361-\007\b\272\315\024\206"
+	.ascii	"\251\001"
+	.text
+	.section	.gnu.lto_nullMotorRateLimiting.147.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"e\007"
+	.string	"\002\21646@s\322\001@\301\022:\373\212L\376\231Q\3245\211\241\002\247mZ\274\237Q\013ko9P\027\370L\253\336'\311\225\tK\25710\230@9&\350\323j\t\3312\245m\320\030\026\264\321\350!\033\230\250\310\222\262\256\304\261\231\342\351\302b\303\320b\306Fa\212\244n#f\006\3454J]<q\\\027C\337}\035\256*\301R\343\001?\2322&7\317\235\366C%<i}\375\177\341\252M\201\025\033\207\234\177\244\207\3475\030\215J[\207Z\021+\301\331\272\305,\317.\035\005\375\255\326\314\017\242PQ\200\261\003\027|\214]&\370\030\253\327\342\370K\271cDB`t\376G\210b\317\351\325~1(\245B9\001\"\3767S*\022\027\272-B[\210\266%\001\b"
+	.ascii	"{\311\"c/\364\254\305YK\227A\254\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_applyMotorRateLimiting.148.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\n\013\2456"
+	.string	"\032^T\024BPdR\007\223\337a\255m&|\332\270\366\016\035v2"
+	.string	"\314\346G\373\314A\311\320\343\253 \211m\004\257\032\236ID\220\202\241\202\204\212\264\202\243\024\215\025\361\2277,\205 \255\264\322v\333\275wJ)\0057\001\027\0016\001\334v\334w,d\372\300\262\274\363\245\351z\f\013{]\362\t\323b\274\272.G{\311\264ebP\364\356\225\023\321\366z\364\345\024\214\016e\330\361\222\211E\221\222\241\355\225y\275\350h\277\314\220\310\232X\301j{]\246qr\313qsa\341\322\215\223y\216\321\264_fm\035]\233\336\275\267\331+?h{}!\363r\316\331\316\334Z\032\316\253\343t0\360\3365l\310\334\0336\305\314\266We\037\261\275\252m\304\366\312^\314\177Z\256\3556]\021\261/\205\356\275T\337\244H\345a\253r\315F\325\253\215\212\220Gc\2218\024\006\201\355\217]\325O\272\027\367\017K"
+	.ascii	"\034\241\261\263\2576r\"u\363\242\267F\366\363\255\217wE\334"
+	.ascii	"\310\004-I\027\241\210j=Dr\304\205jF<x\327\025\232`\001\264\206"
+	.ascii	"\226\244\201?\25454\"\335\3221#B\305,\315\177\301\263!\315\212"
+	.ascii	"\365\030\250\257\352o\007\020(M\307\254M\275\332\323\303k.\355"
+	.ascii	"dg`\256\006\247\b\351o\205t\262x\266CU\336{{KCQ1{\342\376\303"
+	.ascii	"\272\367\262\217\235\2415\0375s\24313\n\346`0\377S\250\336\323"
+	.ascii	"\373\274\236t\232\022\355\275\367\212\373L\2431\301\375\244W"
+	.ascii	">\241\265rk}\201=xO\357\343\346\322]\0265\363]\247\017\2270\377"
+	.ascii	"l\334\315$\004\316J\322\006\333\217\242\013\2370\337c\242+o\263"
+	.ascii	"`\231\267\\x\217\365+P\022\366_\\\324\342\321+t\256\3631\313"
+	.ascii	"\201\371\2631\367U\333\236\036\377\022\346,\b\016X\347+\326\231"
+	.ascii	"A\307u[u]sU\002\326y\212uvv\264\271\331v\315R=\327\314l\235\227"
+	.ascii	"?g\003\253s\001\3269\252u&\360s\036\300:\013h\235\241Vg%\353"
+	.ascii	"\374\324:;\261\316M\2543\323\352\274\304:+\261\316\001"
+	.string	"X\347$\326\031@\353\214\304:\037\261\316I\326\331\250u.\002:#Y\347c\353ld\235\211\254\363\220u\026\266\316A\2403\020\350\334\266\316?\2403\333:\257?g\225u\376\325\331U\347\216`\3242\247A\234{\201\364\035\272rV\274(\035\355\266\353\256\353\236\353\367\225\271\231C\244,d\246\321\321\271a\2229\003w\334\356\fq\360\367c\t\241\262\366\352\247\232 \224\364]\253pk\303\350t\352\333\013\020\300\037\375\025\322\003@>R\362\217\214>Y\364FE\317\036\312B\327>\033\373\312\322\336\273\367\"\325\030\3042x\347\223\351i$\205\366\323\007\t\310\371\r\246I(y:\237\372;>\361\031\274\322\035\264\215\361\217\317\224\007|\343;\345I\333P_\237\234{9\031v\357s\300\360\211\317\224g\365\302\037~C\251\004_\370\r\325\253\372\340/M\2738\246\366\206}\266\034,\360\211L\272\360a\266\320y\360"
+	.ascii	"\177\301\236\270a4\016\235\252\357\272\366\331\257\372\377\002"
+	.ascii	"\225\362\373"
+	.string	"\266N\333a4\027\370\f\237a{\375}{qK\303\320sr\264\367\206Yq\307i9\0326p\340\300\366\312~\225[\334\230n\037\321\274\365\331X\370\366\020~}K6\233\371d\314__\002\034\365\327o\261D\334o:\317\003\367\023\006\021\"\304\003\323TBk\314\307z:_\373\275\367Ke\b\337s\255|:\037;\233\371\020\276\241j`\336\307See\376\333\260\264\251mM\263\031\201\203\004\t\266\327\036\013\344\377\001*X\3048\321!\250\025\343\202\226\212\t7Nh\350\342\242\301\005C\270\325\\\265B\001\202\025VV\r\016 ?\244p\326:\320\245\342\306\026\f*\032-Xl\275XA\025c\353\004\f*\255\256\031T\007\224\230K\206\212.*\032\\\\]TB\271g\377\222-\335J\341\344<\037\214\215\236\215\311\007\231\365\254\036\023|\263\371K\003\277,3 m5N\363;\332\255\026e}G\233\237e"
+	.string	"H\225\002\357\243\204\261\315\311\242\276\300;\032(\2346\357\301\322\326yD=\201=x\322+O\247f\307\031RmvK\273-\304\027glv\202'\343>\026\035\374\372\006l\266\224\324\023\030\360\004\034:\340N\352\333\316\350\340\333N\352\035L]L\361)\fL\235\216\005\"B\024\340_,\215\362\253|\001\257J\203\354\351\341\r\241\336\351\233J\027\345C%B\244\374&7\274\244\364\214\001M\347,\021>\033?}\323\367Z\2277N\377\304\347\364Qni\305h_\323\033*\364\323\261@J\017\360J\317\364\314Y\022\274\307\232^\t\375/^z&\275\347T\320\322/p\303{~\322+}C\2458?\351\003\274\372\005\252\366\326\201X\332\002J\372\016\200\341\250Q<F\225S2\"#\005I\222Bk\260\002\021)*v\021"
+	.string	"\255t\020\221\214&\205\264oja\026\265\3675\350;\265\036Ln\r\320\013\227'\031#\277@j0\317\215R&(\356\240\233\201\325d\222\033\231\031cZ\t@\212\202&=\b10,b\373\206\222d\310\t^o\247\313~d\212\037\334\216z\260n\236\003\360o\244\004\003"
+	.string	"\205\344\213\036)\302\316\243Bq\036A\330\374\344\020lD{\3073\254\262\013'zG\201\270\235\304\261!\225\260\210O\t:-\b\33762\246\352\311/\2620^\277\363\231\254\217_\357\005\020\222\210%\212\220\233\207\320wy_\034\\\002\024\224\201\"\373zw\006\330\001\277L\3133\202UW\025\214!\350\3512\227d\336\317z\213\"\367\347\327\007\222\0252\326(\217q\340\241={\006o\221#\376\330\355\351\030\2221{\305\266':<\304\b-\241J\222\200\336\377\247T!\002p\200R\372\374UV\305\033\271A\027\314\253\332x\355\273\\%\n\021y\3124\337"
+	.string	"\266\225\304\205\316\202\227\344\262\326\032\020\031^\022\002\351\026\366\270o\253\234eK\\\312\206\351Tp\256\007\004\214\355\211T@\007\317\352'\317!\313\001\005\240\310"
+	.ascii	":\370\024\254\301\"\377:\370\366\222\260\rD\226\231\260@h\365"
+	.ascii	";\371\261l\255\371\342\214\001E\342\242\377*\225\021\227\255"
+	.ascii	"\210!\241x\027U\377\323\351\265\244\"\332\254\376\217>\030\n"
+	.ascii	"\241\365I\240\324\305\035\026\2142M\256W\303\312`\026\335=\216"
+	.ascii	".\277\307\251;\327i\242\312}gs\220\350\2100\310\263\206J\263"
+	.ascii	"\0017\240\366\026w5"
+	.text
+	.section	.gnu.lto_mixerInit.149.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`K\t=1"
+	.string	"ZP\304\021EP^N:u\356eRp\217\321\302\355$C\265b\366\257l\240\230\202=\377\232\376\331\353\354\247\322_\033\211\004"
+	.string	"\004\005\217X\303}\246q(\f \002X\361\300'x_\\\310\240\336I\367\367kB\b!{'\031\004\001"
+	.string	"\001\f\001\007\003\344n\355D\225\3561\350\025X\305\005\341io`\275\234\255\337\326~\331\035\344h\235\212%\303\320\\\327\375\033\336\313\323\372]\032"
+	.ascii	"\016\273\337\245\257\366\265 W\266SXT\272G\rI=\264\341\323n\300"
+	.ascii	">\025\036I}\212\036\200\372\264\237\026\244;\370\024\007\273"
+	.ascii	"\355\266se\322\275\333\234!m~\256\3536\345(j\007\035U\276\331"
+	.ascii	"\334\376\310\250\210hH((\b\364\303\256j\212f\334\366W\247\004"
+	.ascii	"a\232\306#\325\217\214V\247\261,)/\"Kb\242\241\325Ik\315\017"
+	.ascii	"\3559\226%v\241\260\240%`88\226\365u\240;\254/T\310\345\b\256"
+	.ascii	"`y\341\237\337au5\207`\026\001\224,\256\257(\212\347om\350XD"
+	.ascii	"3\030\213]\254\216D\254\002\231)y\372\227\353(\252!m\013\331"
+	.ascii	"\320Q\b\232\275\270\231\t\036\2138\277\355x\316\215(\347\355"
+	.ascii	"\250\344xur]\267\261\361\230\365\006\360\356\323\350\356\026"
+	.ascii	"\335l\217\305\n\177\353>\3613,\326\262\265\345\025\232\353\272"
+	.ascii	"\026\314\274\316E\277\354\351\227/\236\240\324\247G"
+	.string	"Y\001\236\332\213\003\377\266\263}d\334\247^pm\314\r\363k\361\351se\306\207\224\017\346\302\027\377u\320\233\031^R&O.\367\360g\373\006&o\333\321\263\2617\260G\251}2\247\213\352\227\265\024\r|#\r\365i\200d\337\213\003\373\313\003\275}\261}c\254<\371p\323y\347\342\277n%\021gd\367\031TI\243\247\363\223\356%\026w\001\245\244\263\275\221~p\037\261\270\213\316|\013\255\270Y\025\367\252\342V3\3564\343F3\356\254\342\306)\3563\241puQ\360\262\034\245{$\020\320\265K\347\252\234\355g\036w\277\201\\\256?\346G\027\235\037K\205\305\326a\021\323\213;\263\337l}\224)h3|\334\305\364\341\024\334\301\371X\227^J1>\200\374K?\f\206\343\002\343\206!Y\347@\3170\343j\270\311w\347\0063\262\371F]\367e\352\327\271\235n\216hf3\325\247II\277\240\346\232;"
+	.string	"f\352"
+	.string	"\002\361P\237a,\007`\241{\022j\267\t\024y\002\223b\246j\"4w.\323\312S\357\365\373\311H\006ykRn\024\025\312J\331\352m\256\264\365\205y.?\301\207\311S\357=\352\272\256\313&\3453\225rR\325\231\373\334s\347\346\310y\361\304\354\026q8,\222\346\364\335\374M\247xR\237\3468+\257W\356aUgXc\224\362\345.|\233\377\325\2273\254\347^\256\223{Rd\315\310^\363\322\245\234\363\360\360H\331\252\235*R\356\220W\304{\330\2149\275Y\256\234m\251K\371l\027>8R^:`\004\273+\220\355n\334{\224Z\224\013\344W\205\021q`\257)\312Hx\\/\016\374\325\233\026#\357\031\261T\035\276\321<\274P\266\352n%\225\037\232\221+\272\0333\035\345\251%^\021\357\351/[\305\321\254"
+	.string	"\241e\027=\343\007T\214\033R.\324\246 c\202\004\031\025*\\\210`$\365~\2120\005\365C\312F\323\216\031QR5d4\335\220za\243\351iJGS\004\002\215#\007\324T\323\016\0348\246\232\202\375>?)\201\305\356\315\304\243k\211\031e\344[$jc,|l\221$i\267\332-\365\251\201d\337\334WQF\366\333/\225\355\302F\332/l\205\257Z0\261\266I\333D}\312f\001s]DN\210\314!\371\241\223\247\317PF6\262\215\262 \351\272\357\215\215\213XHK6\245\245B\305iT\022\270\264|\263G\350\201_3\216S\005\277\230j\315\032\202<\250j\206\2614{\037\300\363i\261\264g\255\226V\213\372T\315\002\310\324\210"
+	.string	"\231\270\264i\370\306\026\0223U\343\3463}\266\263]k\272\354\354{\316i^\343\252\302\210x\320\334\317s=\355\344\320tt\306\275\234\203j\320\274\266UY!\346\234?\244Ow8\237\007\266\177\347{\037\032D\210\020\352S\234\317$\013\200\326\250\2010\346\230R\204fDD\222$Ic\200\002\221\2512\333\021`\265s\212d4%\311\262\006\263h?c\344TR\225\335P\352\231\371\306\267\334\031\244\200\247\245c^\005!\3259#\207K3\341\316\303\022(-\231\234\016\316\266\247\002\354Hl\244\325[2\210\364y/T\365\273\001`Q\235\314\300\216\330p\357^`j@\270\r\240Q\264&\201\245\261V\216H\326\326\221\200\307\215\262\355\311\250y\274\341\334\nT\271a\213u\227\030\337\205\220\351\035\f\356@p\303v\336\232\264\353o\262V\250\177\0204\301q\t89\204"
+	.string	"\3304\345\230r\262\340\304A\263cH\320.\334i\2667\221\322(\257\273\241\237X\376\214\303\3113\376\315\322L\0262\251\n\344>\023ed\263\013\310\003_\2028-\365\344h\240\\E<BF\236\213\0177?\214\377]\225\215CZ\320'\376\232;#K@\205w?/ZC\031\274\343\217\345t\326L\347;\244\\y\346\214)\266c8[\222h$>\333`\360Tgt_\006\245\324\2435\335\307/.J\033\020\254:-3\203\343\210aS\301\034\212S\f\r\3646\036\024\222\233\341\314\242bO\200\023Z=\250\321g\251\200uY\373]C4\250\013\256n>*wP\314']\310\341\232\251i\212\235s|\016\"\217A\307\250\214I\347\273\320\3628]?S\001\030G\341\240\021x,\270F \330\030"
+	.ascii	"\376\235\360\221\"C\303\tR\252\002?\346<\246\367\304uu\240\007"
+	.ascii	"3Q_x\204\033\3337E!\212F\177\n\2616\245\336\245\334\177%\346"
+	.ascii	"\017"
+	.text
+	.section	.gnu.lto_mixerResetDisarmedMotors.150.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\372\b\365+"
+	.string	"ZKD\020Cp\236\316p\363`\f8\226\330"
+	.string	"1\321\270\304\030=\2505\353R\233\\|\245\216\201c\340\357 ON\312#u\2106\335\205\027YX`\232\251\234Cwg\370-Z\322\223@\354\333LDDh\223-eJ\001\361"
+	.string	"\322"
+	.string	"\003\001~\204  f,\2549\317\034y{\3162\275:&\227\373\217W\373Jj\017|7\177\316B\2455\271\271*t\030~q\2768.x\177\263\205\226q7\003w\220yr\236\247\360=\177\212\f[\370\336\276\315B%\264\007\217r)^?\032\371\233Q\366\223c\013\022\347<O\246\367\274\364{\257\350B\346{\345\203\314\367\354e\303\271[\222\363U\322\304\250\340\235\347Y\\$\036\276t\273\201\324\353"
+	.ascii	"\200~\204A \361\3473{\345\252\227\357\253\002\216\231\3158\200"
+	.ascii	"\262\254\243\247\355g\312\206\224\020\306\300\246|.\210\002\375"
+	.ascii	"\310Y\222\377\b\215\212\234\245=\230\366\006D\201\2761\311\211"
+	.ascii	"\276\252\"gB\376;S\366\303\310I\031\232\372\314\036\357\205\305"
+	.ascii	"\321\3202h\346\343K4\003+\213\316\363|\333\225\314\354K\325W"
+	.ascii	"u\236\247u\314\354\354\016p\373\001lg\260\177e\001\276\022\223"
+	.ascii	"\360\235\357\314\367v\t\260\241\331\021\355\217/2.\321.R\254"
+	.ascii	"\217]\342X\256~\347\t6\345[\371\025,_\311{F\241\245\037\3232"
+	.ascii	"\337\323\235b;\0325\317\303\272-A]\336\354\331]\363c\230_\023"
+	.ascii	"pm\3004\217\203Zt~\313\264\271Z\350\307\276QD\300v\206\005\034"
+	.ascii	"\265\016\312"
+	.string	"\231S\365\330n_\272k\366\223\230\200\301\363\252\331\245\232\252T70\325S\246Z\312T30\325Q\246zA\251VP\252\241V]4\325O\245\332i\325M\245\232\251T'(\325K\246Z\311T'\231j\004\246\032\311T\037(\325G\245\332\300\252\215\212\210L\365P\251\026\n\"^\356\036\376x\013{\352\240\252\201\245\372\267j\337\252\315R\335[uY\252w\325\252\032x~\273\346\363\2203\203\366I\0368\226h\205KFw \020P\353\356\370\024L_\316\347P\250`\301\202\371\036\022\033:m\017\326\315\021n\225\321\367\213\343\333\037\234\2537>1\t\334\264=I\215\013\334\032\272d\202%\262\241)\235\231\271\264F\203\322.\355\212\t\033\223\264C\253$\304Yn\304\315\233\333yZB^\036\035\260\3634\036!\330\244}\230\023\244=\260\b\234|]x\232\fh\220V\261$\217G{`\013\324\t\213c`\217v"
+	.string	"\237\260&_\232g\2435\260\027\353c\0177S\306ho%y\f\332\2415\371\204\305\231\323\003tc\247Oo\327\314t\2415\001\227\034\243\301wB;L\242\0315\317\217{\005\2743\207{\2076\"x\346\f\353\300\004\231\033\264\213\334\3600`\314mJ~){\373\205\203\357\0269&\247\334\336\336\303\273 \317\345\003\b\021\"\266)yD\356\332\215\370\230\234k\371\026#\003Z\267TV\024T\326\324\224\203\247"
+	.string	"'V\224\330\332\342\262\342\352\302\n\321\305\365\202k\013\310WO]X0\264\266\212/R\240\320R\221U\\\241Ub\253x\325\345\242\3704\300\\,\260\272\212/\270\270\272\212B7\343W\355g\227V\306\270_\006\260kIm~\212\326%\221\270\303%3\322\034\256\325\347^\222)2\334\313\375/\201\212\366rM\037n\321>LH\001\035<\202k;KoxA\031bs\236'\225\225LmxI\361j\2330\301\024npW\214X\237\317\3756\354|\354z\321\242V\343\207JkX\321!\363\245bT\302\006Jcj\033H\355\323N]\315\031\254T\324.X\006\027\364K\215Q\nv\001\324*(.\224\007=\363\212N\373\324\264No\336p>{\232\326\211\355\030d\312\303\3646\3456\352\370"
+	.string	"w\315\372c\372\347\376\303\363c\211\220\351\304%\363\211\302\3053\322\312w\005\222\001\200\276\250A@g\225BC\"\022\024$IA\322\001\300\002\031\031\033\353\021 \265D\bI\022\325Hc\331\"\r\241.\236tp\210\320S\275B\340O\027\202c[\262\rcc\006$\354g\367B\262\235\240R\300\226\303\222zR$i\230BX\364\241 \232\220\343n\006R\376\300p\377\251\262\322O\274\361E\210\207Gt0\321\266"
+	.string	"S\224\300\020\322\301\203"
+	.string	"\277>\303%1\2431\021\223\374`\312\027\273\337P\262\265\266L\033\246\256\333\026F\fR\356,&\004\217\337\333{"
+	.string	"s\247\344\366\006\307\270\373 \004\342\217\210\277V\272\017Q\377s\006\304\342\260\273\345b5HVVt7e\026\272t\322\354\350<\344\202M^\345\374\"\240\251~\311\267\245\236\333\302\255\344\314\217HS7bt\217sE3\371\006-\026\336\255e\240*\366suF\323\276\025N\245\252$\202\336%_\267\213\203\252/\247o\243\350\351{4"
+	.string	"f\271\356.\315X\240\005\327\371*\332\023:^>REa9\247UB\324\316g\3458.B>\237=@8u\t\365bD/\0355\212\177KI\005\030\b\025\211\325\020\210C f\367*X\250j\002*\0351\375\233O\327+PR"
+	.ascii	"1\3776<\031&\013s\033\326\332\345\3558\325g\306\203\262\370/"
+	.ascii	"\362\f#5n\b\375\003"
+	.text
+	.section	.gnu.lto_writeMotors.151.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`&\002E\023"
+	.string	"\226\344~H\340\320(\035j\013&\264\r:gn\217\336\237\367\206A\365\023I\027H\320\275Q\227\017\202Q)1\206\273\341\213\366o\254c\253\254>m\303\247\004y\210a\035jq\376\303:G;\317]\320\233;\0033\032\233\335[\312\224\002i"
+	.string	"f"
+	.string	"i"
+	.string	"&b\277Y\350\223\315|9 \031\335\2343ui\003\337\245\310CJ\227\361\003J\227\007\035\263o<\324\231\007\332"
+	.ascii	"\363s4\347T\355\007\203<\206w\324\330e\\\215\371=\327\0161d\227"
+	.ascii	"\321D\223\001\001\300F\213%I\272\240\030\333\213F\036\232\357"
+	.ascii	"\303\253P\316\247\306\n\033\315\325t2\347\264\326l\034\356\322"
+	.ascii	"m\277l;\260\025%\341\243\210\233\020\036\035\322n*\317\016e\272"
+	.ascii	"9\366Kt\222t^\034\033<\356>\255\332\364\333-W\035\243zW\255\252"
+	.ascii	">\310\207f\216p@\3201\247Lo\307\234!\203B\034\367\337\256\366"
+	.ascii	"Q<R\376\t\377\307 \252\007\212\373\304\216\273\360M\027_\r\250"
+	.ascii	"F7gh\362]\006P\324.\345\223\360C\203\227\250\034\251\227x\217"
+	.ascii	"s\316\031\301\375\355\"\007.\027\334g\360\360\242\275"
+	.string	"\217\021\240\252%\264\3645\265\241\255\314rMk\255\355f\332\333\203\300 *:\355q\027\231\355i\225\006L\017\333\260\253p}s\316\022?\367\024\025\374\235K\267\270\350k\227\276\313\026\260\0214\323\236/\024\036\355\346\317\257\341\005O\321T\336nn\210f[\247Llf\312\363\003+\027\026\224\007/\027\314\325\372\260\002\225\004\bTHH\026\214\b`\335)#\257\225\005VK\005\213\260\302bQQM`\241\264T)\257\026\325\b\001\273(\254^*\230\313\365R\201\341\374\342\270\347\r\206f\220t\263}\221\233\343\223\321\202\273F\232\272\334\030\333\226\033\227\201\f\f\232\344\335\350\263x\213\024\177\307\253\225\225\322\345\356\251f\246=\242\033\271'3\345\005, P\002A*\351\016r\262\204\255\275[f\026\201\204Uy\030\223D$==\032\007[,\241\325\256R\274\024#\221r\016\370G\032\350(qb\361\0168x\b"
+	.ascii	"a\f\303(f<\031\205J\207\207Gy\013\354j$&\222\352*\022\333\310"
+	.ascii	"c\202\343u\302\277W\360W\271\204X2\303y#m\201\332\225\255\326"
+	.ascii	"\352p\"\257\313<\001"
+	.text
+	.section	.gnu.lto_writeAllMotors.152.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\264\001\025\021"
+	.string	"\266!uG\320\362&\035\216\0011`\316~Ae\247\200x\254;7\005\360\003\322\221\335#\022\017\277\005\221gP\022T7kE@>C\n\333\306\200#X\301\027\017\360)\030F(9\203\027D\021\374\200\251\243vd\352\3266\2212\245`"
+	.string	"]"
+	.string	"a"
+	.string	"@3vW\201\021\250\036\005|\004\365\230'\200z4h\357x\315g_\244\302f\250\307\356~J\302\"\357jw\227\340c\247\t\372B?\240\343\210\026\306\036\273T\r\216\t"
+	.ascii	"aM\207\342\324d\364\333\363&\234e\207\"\347\372\333\023\344\340"
+	.ascii	"A\013s\236\251\224\335u\322\302\0167\352\266]lG\260\217\013\261"
+	.ascii	"\324\036\373(>NMV\036\333{\320\237\272\355\326L\247\246\017b"
+	.ascii	" \347F\013\216]\234\234\217U\212F'n\373\355\257"
+	.string	"\220X\037z-d\225\304\262\177\363Y\274\005x\233i\250b\034TDEAM\273[\362h\b\252G\222\356~\r\264C\354\225\fV\346\205\374\025\007\002\037D\343\270\253\023\377\361\353\345E=\020\262\314\331\330QM\221%\356\335\356n\347\351m'a]\325\323o\0301\313\234W!\236\226Rj{\346/h\002\370\354.\212\357\342D0\376\317\2433\310\344i\217\276\f\352q\244\204\bY\346,\202\224S%:\252\t\325%\277\355\017td\211\363o\357R\354$\322\323\322&\316\256\005\255\273\001\013\203\005,''\016L\006\250\270\322*&\260\225\231\226\353\213\261P\241u\201\345siQp}*0\230\317\244\200_\030V`_\314\353\005\373Bj{\345\361\204\017J2\235Y$\355VK\236f\222\231\306|\241\203$y\210\332c\217I=U\246,\271\352\215m\253\246J\250\241!\235|M\275\315\017\037\306c\270\034\036"
+	.ascii	"{\311\"\323\032\325\316\004\261:\353\315=\241!\355\310+\263V"
+	.ascii	".\2461\327\3054\263\032VAC\3124b\211\027\002@\260\247\002r*\354"
+	.ascii	"J\314\340j\264\3306\213\021\320\204e%0\270\214\313\033\245-T"
+	.ascii	"\205\337O\"\235k>\001"
+	.text
+	.section	.gnu.lto_stopMotors.153.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\270\003]\032"
+	.string	"\2661\252G\240\232M:\274_\030RV\tu:\332\002\034\203\310\360\244\347\264N)\206\356\270\332\241f\307\211\035\036\333\346\276\036\301JBr\202\307\347\361\301\225.\341\32210\3101\363\026y4"
+	.string	"\027\023\357\035\352\326\b\331D\312\224\002\223"
+	.string	"\213"
+	.string	"\231"
+	.string	"\177\222\303e\263\377\304\227\272\223\244\367\234%\2464#V\225%\3655\347\264]zA\354\262\366\001\341%\370"
+	.ascii	"\341\245\037\225d\217\227\037\215\263\313\274\3674\2375%\306"
+	.ascii	"\024\2329\347m\203\330\346`\357\026\025\367\230\030Jp\025\347"
+	.ascii	"\213=\n\310h\355xJ\217\201\342\213\246\"\367\315\310\001\362"
+	.ascii	"\200}Y9\026\f\025\221\340x(\366`\235\301\2303;\036\216\313\033"
+	.ascii	"\007g\274\033_\032o\t\254\3159\017ue\342\351T\305\2369\247u\307"
+	.ascii	"\243q\313n\273\207\355\n\366j\005EF\372\335W\204\217\245U\262"
+	.ascii	"r\361\360M\r\263{:]'\373<O`_^ \366\252qD\365\rm\3256\277\272"
+	.ascii	"\307U\317Nu\313V\035\206j)\325`\250^\251VP}\001\006\222|Aaf\316"
+	.ascii	"\246_\232\331%\255\030\371\325Ou\265\357C\371\225\217\345\321"
+	.ascii	"\270[\331Io\342W\201\b\303d\3169^\332\306}\n\t\234O\026\262\246"
+	.ascii	"\344h\331VO\345G\271\224\244O!u\2105\021\201rpi\n\261K\034\315"
+	.ascii	"\331\262\035\312\243\034\266\211sA\272y\232s\362\370Z\276\305"
+	.ascii	"\303\007\037\237\360r\200\220\0359\375]\306\326o\253\264\274"
+	.ascii	"\340\205\353d\005g{\250\373p)\2636\033.\223m\373\257N\301G\016"
+	.ascii	"\353\340\222\037V\237m\251\361\275\352\243\2163`d\253a\016W\266"
+	.ascii	"VP\312\235\201+C<\313\225c\021\3613bDx\t\356\311\b\001wm\326"
+	.ascii	"\201\356\356c\2541\211W)\021\233si\307\327:\025 \177\310\245"
+	.ascii	"\203\206\364\273\241=\0261R9\375\035\260\021\305d\335\"\374\022"
+	.ascii	"\210\342\265\244`\036\2656\177\"\264\003@Ej\tB\021\036\b\355"
+	.ascii	"\354L\320\001@t\003\351\034\005\271 *\272\26101D\204B\350\226"
+	.ascii	"\202\250D\321\r\350h\305M\247\200\215T\004\035\335X\030\031\035"
+	.ascii	"\335\306^\356\013\304?J\272r\253s\002\205p\234\223\320\266p\301"
+	.ascii	"\300\021\337\364\251~\250\377\354\350B\240\276\025\206\f\372"
+	.ascii	"\235k\272U\342\252\341\213\255\223e^!m\327K\332>.\023\316\216"
+	.ascii	"{\241\313\315\342\234\353]4\370C\274\201\003\207\360\362fe9r"
+	.ascii	"\372\3632\272'\007\3169\247H\333_\275\226\32307\370\270\264="
+	.ascii	"\214\036:\3759G\207\032\237UG\250Q\034%\225R\206 fB\021\2321"
+	.ascii	"h\016`\002)Te\036\020Pj\212\263\254\001rRP\362'\241\231\033\341"
+	.ascii	"+$\204\302]\315\330\321J\250\365:A\231\002\310\034\363\320\220"
+	.ascii	"\250\357.o\260^\333\344v\367\345\201&\022\221\363az\316 \013"
+	.ascii	"\222\022\355i\031\304=;\253Z\356!\216\355\344\227W\301~\263x"
+	.ascii	"t*o2\n\307\274>\305\316\024\243x\307\314J\272P\202\b\250\tK\316"
+	.ascii	"Fj\033c\201Fv\347\244\006\003\356(_zI\004;V\300[ \251\027^|\251"
+	.ascii	"\230\340\013;\302o\035S\001"
+	.text
+	.section	.gnu.lto_stopPwmAllMotors.154.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"%\007"
+	.string	"\362\r25Pm\222\016\263&\b\224H:\315x\224\027\255\2464\231F\321j\354R}8\326\376x\224\261.\272%A3\354xdf\212X\301M :\240\376\036l\232%[\246o4\031\207\302\272\236\247\201\301rXx\017\226\302\3656Y\347i\006\306 8\331\363`X\3662\247\354%\035)\301\224\n\271\212\005\020\335Gt\260\333\005\026\016t\035\272\212X\256\251!\022\267\343\211\017vku?"
+	.string	"\255\3520\031!l\031Q%\223D\225?\201\320i|/\351H\2178\026oE"
+	.string	"Rr\235d^\264\254d\252\"\361\370\233Y{\224\2368\262#(\221HJf>\267Q\255\250\335\226\212\331F\240b"
+	.string	"Bf\216\333\b\243\273\376\006\377\301\377\021\t"
+	.ascii	"3\241s\037x\2079'\241lqMD\030\002y\031\002\\\272E;\237"
+	.text
+	.section	.gnu.lto_getReversibleMotorsThrottleDeadband.155.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`7\002=\022"
+	.string	"\366\241xG\340\322&\035*I\325\350\371\024\026\366\314\025\037M\231M8\255M"
+	.string	"\313~\274\337lR\177%\332\366\276\262\267\266\361~\233\214\262\261\027C\337\203\006\031\343\034y&\247c~\0339b\372\f1\365^S\263\226\354\275\245L)b"
+	.string	"]"
+	.string	"f"
+	.string	"\007\036]\340\364\350\253\370\212\231]\004\201H|\035\206\0357B@\346\234\336\352&\362\021^\200|\334\021\237\275\223\021\256\316|\211\242\007\215\333G{\327\341\222\344\273\201\2539\347\005\2159\207\251/\347\013\r\350\330\340@\362\331\240\tR\b\036\377\271\342|6\252]\313\234\323z\3736\334\247\333\226\331f`\353+\276\217ij\364\267G\277F>~Q\222<\324\264\311'54W\224c\252\020\033\310F\227\307>\234sN\357\216\r\325\252\024\n\252\273\343n\251\352\270j\250\352U\265^}"
+	.string	"'LH/\242934\r\231Gq\306\211\343~{\346\377x\004\245g\301q.:\3214\234\206J(\371\230s\006\213cA\302U\375\bR*\321"
+	.string	"\177 m\027\226\376\006\227\345\203mi\376\317S\271%\351\226ZD\355\242Z\207\361bq\250\214%$\020\320\251=\356\253\332\246v\205n\212\3300w\341:\315i[\361\205>4\301\367y\264\f\f&\037uUzp\252\\\356&n:G\273<\237\221_\bAI6\rb\237\305[\314\004VyQ\200\340ee\205%\245\244U\023\343\322\340\005s\311X\255\230+\002\211Y)\261V\005\227\214'\223"
+	.ascii	"\343\212y\361^.\027\031\217\025\243\361R\b\030F\241\025\363d"
+	.ascii	"0X\314\033\001\252}w\254Q\256J\325v\213c\273\333Umm`\027W\265"
+	.ascii	"\003t8x\f\242\270\tD\020I\201\253i\323\234\223&\227\3077b\202"
+	.ascii	"\250=\222\321\215M\255\f* \220\002)\261\362\001\267'T\324\342"
+	.ascii	"\212c\204(Q\347\226\310\264\335\025\022\021\003\217&\256G\201"
+	.ascii	"\003r\"\306\032\177|6\246v\031\227-\327\005\035\336\353\336\214"
+	.ascii	"\202*\"&\020;h\030H\231\314:\350\022\315\344\350\371N\366\\8"
+	.ascii	"\004\321\200M\204\263\210j\001>\030k\347\311\215)xc\274\324\250"
+	.ascii	"qA("
+	.text
+	.section	.gnu.lto_mixTable.156.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\303&\345\242"
+	.string	"J\001\3017H\020\020\307\255\f\007\365\310\327Z\202\314J\272\006\212IRV\373A+ \020C{p\212]W\357h\326\255\f\254MO\bKc\376u\323\325\035w\377\272\343\354\333\221V\217\332\006\024\313J\353\372!4\267\336do\"e\222\001_\003)\003\210\0030T^\002P\336\027(\357"
+	.string	"*\257\013&\336\026(/\013\224w\205\312\253B\345\3152\362\246h\342E\241\362\n\240\362\236Py\261\230x\257T^\253\f\274U\031xM,\361\226X\342%\261\304K\245\362N)\361\2160\362\212HyC\244\274 R^\251\2247*\345\375\220\362zPy;\250\274P*/\007\225wC\022\257\206\224\367)\345uJy\233R^\246\2247C\312\273\224\362*\031yU#o\222\22175\362\032\215\274\250\221\367Dy\213(o\243\274\214\362\376\221\204\304"
+	.string	"\230\244\321\272RI\214a\025t\372)\363\35000u\264J\324\220Q\324R\241\321\265\231\231\005R\241\2500*\025\303s\20226&\261\271~\255)\366\177\322\315\272\262ke\374<\242\237\3607\364\017\372\007\177\300?\360\367\373\001\375|\277\336/\347\247\363\333\371\353\376<\377\236\037\357P\273\307*k\256\022\226\224\342Z\247\200\034\"3\221\262\366\204\373C\253t\225\270G\b\303*\375\274Rdh\311\"\271\273\346\272\322\321\335\021:s\225\256\362\006\331\b\032\204GNn\371\027V\351J"
+	.string	"\201\253\024\363B&N\016\340\336eqq$W\327t[\341o\225\256\300|E[\037\005NnM\363\352+\320\373V\351\n\311\267wTbNk\331\223=\274-\351\317+4@\253t\002k[\237\302\254\221\343R%Q\326\276\205\375\336*Y1\312\332\325[e\372e\226\336\271\023\323<K\177\032?\347u~\347x\256\347v\357s\345*Y\235\371\371\237\343\363P\030\223X\226\376l\201\256\361\371\335\361xM\3262lf.\226\376<\335\007\253\344\236.)\244\311\003\247d"
+	.ascii	"up@\260\263\323E\005\346\264\212Q\2313\323\303\005:]T\347\272"
+	.ascii	"\266\255\341A\220\376\264\022\314:\335\007p\274\234\256t\305"
+	.ascii	"K\247\334\305i\256\353\232\342\347\332H\177:\261\0252\353\274"
+	.ascii	"\3737\207s\374\234\223MZ\327=7x\353*\246b\005H\177R\035\n\375"
+	.ascii	"Y\374\006\364\347\036w\017\235\016n\275\035\342X\035G\353\272"
+	.ascii	"\262\3500&\254>\354\322\213t\337\364<\376\312\252\312D\t\022"
+	.ascii	"TS#D\204\300\002!\025\365\301\303\211\016P\0346hxrjb\312\260"
+	.ascii	"\244\244&\245F\364,6\037\367E/T\032\221\235}\375\252\271\207"
+	.ascii	"\255\354^\305\347\020\0346\241\347%\362\234D\021ji\226\247\210"
+	.ascii	"\342\020\036\246\232\252\373\2108s,\342\320\323\027\344\366\022"
+	.ascii	"\271\241\351y\b\273c\335)\3370\b)7\217b\363W\206?\030q\200A["
+	.ascii	"s\017{\2605?Q\224b\343\263\362\245Y\233\242\025\240\027\030\366"
+	.ascii	"\270\003\324\030\346\300\002oX\232\2219c&\2065\030q<9%\341\270"
+	.ascii	"\311\210\243L\241Dnh\3113u\311\260V\244:c\306\306KE("
+	.string	"*d\310\2764\213+\242h\366a\3643f\\X\311\210\303\r\215\314\325\245\331\026\022g\314\264pR\321\370\204\n\231/\315\324\2122\016\233~\2767\306)\t0hi7\032q\354\375,#&\221\033Z\332\321S\003G\210\310\316\260\274\250t&\306\315t\366\244H\265\256\353\225\347\262\2630f#\216u]\227\311\316\320\276\002|\267?\354n\241]\023i\002\215>\264\207\216\352\323P\r\207\331\273\033\203`r\330\200{\373\3207\230s\035\332C\237\206P\315\241;t\321\016\252\317:c\22164\207>R\221\206\336\320\037\213\004\306n\354\345\310\346\350\346\b\347\b\007\375\251\241[O\357Q\232Sg\350\247~\013\207\210\220lM\315\324N\335v\3078\334\266w*\272\344\300bkj\025L\275u\330\b\331l\245\316\320\335\207<\263\b0\227\275[\001\267\256k\214\335ub\206\267\344\310\032\\\327\225\325X\313\002\r<\360"
+	.string	"\372s\251W$\347\3008Q\251O8D\204l\202q\342\245\370\271\320w\364\236\234\031\373m_\b\346T\373r\211\374\212\306\276\033,gR\237M\">E\264\337\246\313^\210<\323\276\362Ii\022\315\025\317>\233.\333MQ\243\rl\357\3054n\253\336r\315B\243\r\314\257\317\273\320\3579\215\021s\313Uy\325\017\316re\323/l\303\fi\357\246q\200\241*\226+j\217H\223T\005-\251\247\320\244fS\230J\004:(\240"
+	.ascii	"\375\231\366TR\016\005\033\237\225\323\330?\274\026K)3\366\324"
+	.ascii	"\026\264\317\350?Tp\024(hW1\325\316~\341}\264\2011\244edW\272"
+	.ascii	"\256\253\214e1~b\301\271;x\360@\177\236]\225\364\263\344\227"
+	.ascii	"\205\211\214\215\257\370\304\027\233\025\361z-\264\273\310_\031"
+	.ascii	"t\237N\362!\254\300Y\323\253\205r\1770\247\220\030\037\256\323"
+	.ascii	"\265\3207\367\307\322\3028q\3671\034Qk\317\302\372\370\301'\373"
+	.ascii	"\201\376|w`\246\201q\342\216@\343@\211\313\225!\355\322\205q"
+	.ascii	"\277\355^\006\334as\373\313.\342\347\376?r\264\250\360\206\276"
+	.ascii	"'4\304$4H\360\205\017\372>\360\203\337/\001\005\035\360\373\277"
+	.ascii	"\007~\357w;\337\363\005\002\204\347\200\276\257;\337\367w^\367"
+	.ascii	"\303\357\335\234\321\367m^\370=\2331G\364=\013'\374^\314\375"
+	.ascii	"\276\217\273\234\357\223\247\363=\334\365\276\017s0\337\363\375"
+	.ascii	"\233\023\357\277xq[\241M\211\367]\330\326\270l\321\242\226\226"
+	.ascii	"\005\313\025+U\320\316\314\230xO\245\211\367ST\220RF\026\005"
+	.ascii	"\312X\312{\344\0231\225\367aK\274\0073\362\376kEy\217)\257W\312"
+	.ascii	"\353D\345\005\200\312\333\245\362\246\220\3626Iy\231\244\274"
+	.ascii	"(\250\274'\250\274K\214\274\\*\257\tF\336-\225\267\204\224WI"
+	.ascii	"\312\233D\345E\242\362\222\220\362\036IyGHyEPy\215\250\274E\214"
+	.ascii	"\274!\250\274DT\336!J\274 \030y\205\244\274\037\244\274A\214"
+	.ascii	"\274\036\244\274@R\336\016R\336\037K\274\034,\361\372X\342\335"
+	.ascii	"@\345\325Ry5Py3Hy{\244\274<R^\fR\336\035*\357\005*\257\005)o"
+	.ascii	"\005*/\005M\274\0234\361\352h\342\225@\345\215 \345\205 \345"
+	.ascii	"}@\345u \345m \345e \345] \345U@\345\315\241\362&\300\304\213"
+	.ascii	"\300\363|q\250\2747T^\033F\336\032*\357\001*/\r#\257\001*\357"
+	.ascii	"\f\225W\206\312[\200\312\033\203\2117\375\301\034\277\023\313"
+	.ascii	"? \275\234\354/{\347\025h\371p\037\231\242\016\372G\003\351\263"
+	.ascii	"\016\022P\030'v\320\247\022\331|\323?\232\t\221\315>\276\276"
+	.ascii	"\035\016\372|\315}>z\203\346@\203\366\241\325\033t\321n,\222"
+	.ascii	"^\240\276\034\255~ 75\255?K:\032\364\001\265i\320\034\230i'\226"
+	.ascii	"}:d\300v<\235\001\007e\217>\236~\217\376a\210lvp\241\256\017"
+	.ascii	"\210\313\353\272\330(\231V\350v\247\317\307\243+\350\337i\025"
+	.ascii	"u\220l\030\364\216\346q\306\202?/@>\031\006\335\364\347\202\336"
+	.ascii	"\3215\020\221M\013\372\0025\013\272\373\230i\024t\005Y(\350\256"
+	.ascii	"\303L\003\353\373\371\3476\270d\3637\007j\202^j\303\0234\212"
+	.ascii	"\206\377E\307\f\007\035\023\bz\021\342\223\351\350\3079\2249"
+	.ascii	"x6\364\033\343\271\004\275u\t\232\206\232\b\332\f\202\216"
+	.ascii	"\240\333\020\351\367@7\320\0208\320\017\364\221\315\236\342@"
+	.ascii	"?\0223\255\025\350\006\316D\300\013\364\256\227!/B>\031\003\215"
+	.ascii	"\272A\324eN\310\026\350\0232\347r\264\002\035\325\207l\336h\033"
+	.ascii	"\235\243QD\244\231\260\265\004\032\212\022\201N\240\221\375\004"
+	.ascii	"\201+7:\254\277nT\261\221XV\243m\364\021c\250\321YL?u\313\263"
+	.ascii	"\24478l\032\0168\224\3213\232\306\001\0064\215.\326i\304\310"
+	.ascii	"\200\206\301\364\263hF')\222\321U\3114\304\002\232^\211\020\311"
+	.ascii	"\0241\300\273^\206^\215\370d\005\364\253\264\205\365\327.\375"
+	.ascii	"Az\212A\370\006\243cx=bC\205`\024\0220\250\226\350\202\177<\246"
+	.ascii	"\031"
+	.string	"\346\324oK@g\365\311\314\351\013\\%\244\315#\240\263\222i\034\272\350\025\003\t\032kz\321\200\220\022\023\023\257\205\016\320/\330o\200\016\301LS\252\340{\373\343\002\220a\213v\261\247\327\242W0\347\274\020\321\345?\234\347\205\350\225x\374\372B\177\252\030\\\304\364\027\247J\233\025&\026\335\207\346\024*\256\353\212f\201\347cE\337.I\r\235\n\031\372m;\253\267\346\374\361\t\333<\025]\305LK\321Y+x\217\236\024\355!\351G\215\006D\253\226\245 (\212\032L\265{\034;F\341\223\241\350\027mb\375\265\374\207Fi\005\260SfH\246h\006c\265U\237\350\335#\225\343\031\237L\200\246B\366\027\323\361\234U\016\200\345\034\253\\9f\311\202\3764\236X\303\232S\333<%\331Ucm\3417\307\265t]\305b,\267a7\307.\307\025\216^\274\240?\257:\2139\367\267\305\252\327\254\362m\363\322\260"
+	.ascii	"V\031f"
+	.string	"\363\362ZD2\355R\376\324\324\364`\032G\272\250\313\252\226\356\307$j\242\253\314\260\3341)\3468f\f\372\323DO1\323\246\260,\327HK\304\272\022\3757}\022M\325%\372H38\232\304\0275U\027\t!-\327\244~\333\244B\306\275\247\217\f\347\320\024\177\2301\247!\022L\227m\321\370\302\324\2600\022\372\326e\033\246\247:\207\337\210\236\032\303d\216e\344\216h\320\240?Gt\322\237\333\372=\317\243\367\342\272\256k\252w\252\254?L\037\261\217d\013\013\303\2467\246\237\007\314\230Ea\035,Z\256\205\375=\347\267\026\321/\354e$\243\260\302\245\210~\237\256&2E!ZD\3678$\204\364\003\321R\035\242\217<\023\226\344\270\275K\263|\226\017\372\023D\273\210\352\247\226\352\343\035\006\003\270hQe4a\tW\020\256\035[I\270\222\350\340B2dkk\211\020\r\004\300\030\340E\013.\"C\216"
+	.ascii	"A]l\0011\0329\327\022%H\214\234(\223 H\214\350HbbDG\023%[JCB"
+	.ascii	"@\022\344\202\fH\2140\t\242c\310\021.\256$[E\270\224\026\006"
+	.ascii	"\221\027-\210\304\2101c\305\023\006 \360\nY\2615\204\211\021"
+	.ascii	"\022Xp\025\t\301\310\021\",\220\030\tB\002\013![&\260X!\265I"
+	.ascii	"\224\f\331b\301\225$\311\026\013%:\260\367\227M\003\021\005\201"
+	.ascii	"u\3306)\256\253\333\215\343\375M9\374G\275\377\322K\325\204z"
+	.ascii	"\320kN\035\257;w\276t\022\244\345zUuC}\306a\245\370Y\360\342"
+	.ascii	"\326\367\"\350\326D\304zO\250\310Y\031\352#b\241o\350o\271B\007"
+	.ascii	"vA-\301\264\240\256\364\017\317\n\215\225l\376i00\221\\\230)"
+	.ascii	"\210U%\356\250\317\270\020)\312VL\016\277.\375\266\276.\207\b"
+	.ascii	"\017w\330\3043\341\250O(\246\357(P\216"
+	.string	"\257\224`\013\004h\255\317\266\267\246\027\330\005\257\016\211/A\335\224T\\\224y[\372\\\262\364\323\372Z\266\250\365\265\364\301S\343\363\226\326I{\262\364\210d\032\234\251~\303\322y\272<\300\341\271\322\307\322mv+W\232\nY\245o\245[\260\355t\245u\252\264\n\246\237\263>Z\267`\317\221s\3266\230sf\335\202t\307\2658\247\322\347K\316q] \233\325\223\005\022\331\210O\351\273\351\371\224\336\241f\271\252\320o\272\240\340\266\333\264\233&^v^w^wR\372*\364\313\244\220\365\313\272\250\034\213\364\260('k*$\224~\224.\n\"\375\306\240\364\207>\257>\255f\357\336\002\\\013 \307\363\006;\315\307\372-$\347\220}4eO\372u\230b\375\260.~\365\301\340\3765\030\210\346X\3120\262\"\"\005\2176\260C/\302\2213\324C\351\245G\330W\036\206?\325\005v\311s\370&\204\225\337\032"
+	.string	"\254\376\262\250\032\026\251\0136\232eP\324\t\365\223]\206\252!\245\016\330\035\354d\361\213\372\240>\\\227}-^\013=\366\327&\243\345\302\217c{\200\013\\[\256p}:\311\276\034\020\202}9\202^\375\027\372^\201\375AN\232I?\220\r"
+	.string	"\355\244\253\2274"
+	.string	"\372]}\300\262?\230B\177\331R\206)0\253"
+	.ascii	"^P\037P\003a\223\276\240&=\001!\262\331\350\257\017\310\244Q"
+	.ascii	"\350\377\365\fC&\r\201 \362\314\t\215B\337\350C6\227t\t}B\037"
+	.ascii	"@\310\325K\370\232\253m\030\"\333\250W\374\372\201&t\t}\277\226"
+	.ascii	"2\334j\023:\356\177\323[=\325WB\213\020<\323\324\005\236y(k\201"
+	.ascii	"\213T\277\021R\322'\324L\230\244Gh%H:\t\t]\244\221\364I@\034"
+	.ascii	"t\244?\310o\204\026\241\217\264\321\016\356\260)\350Fbb\f\035"
+	.ascii	"\364\b-\245D\2361\322\"\264\321\016\331,\322D\332H\027\373\220"
+	.ascii	"l!t\021~\024z\276\016\241QAd\2330@M\244\213}OuK"
+	.string	"HQ\375\266Jq\036\316\3543\356D\212?.\256\207\200\320C:\tB'\245\025\033\271\3711\03126\300\017\314\276_\\\237y\342-\023\ti\250\017ZH\037\351\007\244\203\364\007}\017:H3\242\223\270\367\351\362\240\241\236\006\227\205\315R`8T\301\303I\254}\311;\321_\366\356\313b\353\nf\002H\203\177\250\362(%\320\222\316)3#\"\"I\222\2445\"\013\020\bcY\032\306\260\007\022\340\204A\251\031\203Ff\222T\n\355\006\300f\226\340\2021A_Y\226\327\367\255\332\262\302\247\355d\314\242w\213D\377\024\267\300w\265(\252\216y\241\253\020\377b\217\254U\205\251V\345\025\036n\253\201\017\237Qa\376\311\025\3114@\017v\020dR/W\311\314\223\364\234?7en\232!\366B\006@\230\240k\304\305\031\271\201\274\267\246 \212\215(\202+\321\300\241\257#\355\2508\266\211\b\265\343l0) "
+	.ascii	"p\326\rx1\007<\337\311\336\347L\022}\006\363\030\f\327\350\262"
+	.ascii	"\373\340\377\013\371\323s\207\340G<\006\233F\224$\375\363S\343"
+	.ascii	"j\240\\d\016O\017%\"\270Fr\325t\250\214\001\226\0245\034O\026"
+	.ascii	"P\347\303\325O\235\005\341\240`\030S\314;\201A\037\353\267I\366"
+	.ascii	"\330zp#<5\354\244\352\003\310\255\350\251\365\214>\341\031P\277"
+	.ascii	"\355\003\351\201\"U\r\213j\201\347Y\301\316\017\261|i\017\227"
+	.ascii	"\267W\"9\200\\\020\006Z\340|\242\330{\023\214+\354\363\2048\324"
+	.ascii	"%\354#?4\356\021\306\024h\316\373h\037\304\210w1S$\256Cm\345"
+	.ascii	"\235$\036{\222\230\252\256\237\002In\372\362\332\026R\013\nH"
+	.ascii	"q\345\364:&g\243\362j\211G\266\227\310V\321\253t#^\303\"\232"
+	.ascii	"\226-\032\036\026\r&Ra\351;g\005XX\236\023\0223]\004\b\226\257"
+	.ascii	"\270N'jad=o\315a\336e(\262\001\340\363\221\036"
+	.ascii	"C>\303\rU\323c.u\316\034\tu\370\342"
+	.string	"\"\325+\3432\344{\203\f1&(9\270B\2251\3174\230Ct5\3310\f\274G\343\307\323x\013v\365E\373t\255jne\256\246q\305\f\274)\301`V\361f3\rrr\017\346\363\324\362\255)\355?\352g\306\2761_\311\332a\036\030\233\347\377'\301?\241\3008\017\365\232\033\216j\320\365y\360x\027\177\303?\271&|\345\004\276\345\t\354U\242u^\016\\a\020wN\331\200\261l\255\253\354\024F\016\271\252 \201\034x\221c\230\361\235\035\241\036\277\274%\253\\\232\237\021p\305a\037\232\276+1\2321\240;\225\221\222\345h|\303\254\256V\264e\005\3771\003\253\261o\202\210C\241* !\237L\027n\376\350.,\262\323\306\275\036=P\2235<\037\320<\274\306\342\024\265\003\226!\026:\305\205\267J\210u\207\201\207i9\230\232xF2d\370.\031%\304z\\\300\303\202z\256\302\265\177&\016"
+	.string	";_\264o\372D5r\213L@\346\375\353\3339i\205\335\325\007%?\317\314\244\263\3475\n\341\275\355\016&\255\3218\330~\234\331\217\203\361\360l\027\211!\307\236\200F\206\223\265\221V\362"
+	.ascii	"\352\220\260\021n\030\263\355w\242\270\243\025v\363\367"
+	.string	"\372\271\3142\n\261\267\224\241}a\037p\270\245/\330\254\306\200\241\223\323\nL\244#\205X\362\035*\326J\356)\205\030-G0\356\022>\36364\265\252\225\237\026\247\345y*\370\236]\335H\035\214\234\037\016b\205L\027~Y\274\234\006\306\210\234I\206\310\203x+'D46\236\034\373\236b\241\277\205\016\206f0\231\301\317\224\374@*\003\036\2274t\002\222\0326\200\230\301\335YL\217\263[\030\026\333\215Z\213a\023\3007\251i\030\374\313\334a\374\230\300\003\0047\363\016J\223\351Tz7<\273\027;\004X\r\241\263<\027\357\240\220G\020v\2777\020\274\200*\344\034;\275\r6\305&$\213\027\215\371_Y \273\363\217-\036\032\2047k\331\216\021\332\211\357\337t\006]\344B\263\300\177\351\306\003\033R\302\242\230\016\347\223\313\352^\023\226\025>S_\036,\273\241\327\302\267\373\320\032\256\005%~g\224p"
+	.string	"\004\374\245\370{+^\034\275\3317e\311\340\216\311l\372!j\221\232n\244\225D\"\302\035\023\272f\2248\357\353\266\034\030:\200<\005\325"
+	.string	"]L\312X\206\373\022\242\211\276\372\302\2454[\376\336\313A\355\b\361\266d[\343\234H\366\337\223\271\315\3745\2776\203\201g\230]miHt\336En\304\333\006\350\306z\207\"\210\215(\237`\005\224\250\346\200\222gF\200\220\2071\320(s\002\013\341hE\263lp\2430\302&6\313\370\204R\246\231\002v\020f;'\243f9\004P\315\264\344\212\321F\243\356/f~\350\202\214\305\311[\321\240\032af\254\210\375\342\354\305\375\202\f#O\321\217\314\202\337lgz\0018k=\214\023{\333\361\002\021GD\004\222)@\003\255\304\313v\024\020r\225eh\360*\t\021\236\250\b@\220,|\251\177\207\214\364&W\313q\300\3312\312\251\b\274Z\021Au\237P\t\312RX\235"
+	.string	".\256}x\223+\320\020W\350D,\0331r\360\243\322\203o\277\374\013\301?\276\212\373\311\253\274_\232\023,4\0239\334\254\320\362X\3715\221\020\001\1774\023:\036p| \f\270c\205I\267y\003\036\272q_\336%\266\357ZQ\230\330J\022\251\311\256\340\357\233e\373\027\234\325kh6\327%\352\037\2170\364\227\374\301\217\n\002\366\373A"
+	.ascii	"$\023\257\026(\240\265.\034\237\212\274\023\235\245\205\351\270"
+	.ascii	"\265F\225RX\344-Zm\333\fKrt\236\324T{\207\360\305\302\235P\372"
+	.ascii	"\032\223\242\376\251\265a\371|-\034+\245@\242|m\365\361\005\276"
+	.ascii	":9j^\3549\365\024\013\242\353\313\026\022usvC\320\317\026\340"
+	.ascii	"\027\265\025\223\226\353\364`-\323 ]\002\230V\2577\351%D\006"
+	.ascii	"\377\013\317\342\034\013\375\373gI8\225\365c\273\236\177B\222"
+	.ascii	"\006K\232\260\033\356\004\021#\210\204\340\b\354\215\211\236"
+	.ascii	"\255 \005r\005\367\017\2560\023%\tzk\274\020\t\231\031t\222\330"
+	.ascii	"\013\260/Z[\310E\305\f\245\241\375\321X\314N\312\226\222\020"
+	.ascii	"\322\271\211\030\273e@|\316\215\213\364N\247\201Pw2C\017N\234"
+	.ascii	"E\023%\310Z\031\344|\377s\177\330\331^\264\257\023J\003 \\hh"
+	.ascii	"H\313\343\243\211e\240\006v\361-\024\304\006\341\322\002"
+	.text
+	.section	.gnu.lto_getMotorStatus.157.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`?\001m\016"
+	.string	"\306\033cE\020\221\223\016\360\250\020\006&\033\275\332h\320M\f\340\276\035uy\005\317\001v\262k\bz\367\033\203<\373\033R\353}q\376\350\273o\215D\003\006"
+	.string	""
+	.string	"*\240\005\024%x\260\250\306 Q\362\314-\"{o)S\nS"
+	.string	"K"
+	.string	"M"
+	.ascii	"\307\"|\253%\177\232\216}\250\036\001l+\033n\252\016_\210\206"
+	.ascii	"\030\031>S\345\201dt\270\341\231(}\017\304\002\202\363L\225\027"
+	.ascii	"\202\203E\316g\246\350\276\002/\033t|\346\366@`\334\244\356\272"
+	.ascii	"\256L"
+	.string	"\224*6\"\245\264r\023\303\375q\333\024l\037\260\337\022Ry\330\257M\227e\177\273\256\353\274/\366Sw\254\306V\375V\275\252VU_@\200\032\255\371\325\n)Y\272\036\362\006\266\ba_\006\305\366\3701/\201\342\222\002\324i&\020q!E\223C\312W\006rP<|\037\020\017\027\346\245\361\355\346\\^\213\273o\237Zm\332\331G\361\031\315o\371\201\b\372\242x\270{\025\037V'\355\024\346\005\215\232w\023\327U\022#\335\217\370wp\350j\326\026\342\227\301\214\215\024\335aLm\223\tz\356\213\300e[\223\357\372=\340\264\314\b&\021!\205*h\242\354\304A\211\006\241A\026A[ \312HH&\231\b\001\217$\204H\331\311hD\312<\257\323cg\357\272\001\016\376\245\210\355\212ml=r\332\315OJ)\261\217\332\241\022=\327\331]\223O\270\270\210\211\313J\201\243R\031\233\026\r\\\226\257\005\031"
+	.ascii	"s\b\330t\330)\3530\030\234\263V7F\266O\030\276W\007\256A`\343"
+	.ascii	"\262!\026\270\032d\003{\2472\222\312.\260\362jwr\260E]f\313\214"
+	.ascii	"\b\270\273oF\256p\250[.l\006"
+	.text
+	.section	.gnu.lto_loadPrimaryMotorMixer.158.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\036\002\235\022"
+	.string	"\326\342{I\320\362&\035\212\311E]#\200\333\315\317\n\021\0253\233|\342\303=p\201\320ES\340\211\313\022\360\330\305vL>\013\232\364\325\201\333\236\331\301\201x\220\253\031\344lyd\246s:\212(\214\355\333\363\206B\317\032\331{\357\224\002a"
+	.string	"e"
+	.string	"j"
+	.string	"\325\nF^Y\037\340\275\322\013\360^\357\337b\366\347\230\335\343c\320\026(:!B)\267\273\340Ta"
+	.ascii	"\247\343Me\354\225N\031\363\217N}lO\265\020\304+\245@tb\2000"
+	.ascii	"\004\235P\253A\372xy\023\316$%\322\371\374\370\352c[\252\205"
+	.ascii	":\227\253\224\335\265\254\2059\267w\3331\266+\3302%>\202!\035"
+	.ascii	"9\317\037\273^\274\357\2214\r\275H\361\235\335.\211\335\220\205"
+	.ascii	"\2525\206.\376\366Ms$?If\347\306g;\306\252\0317<n'w\313-\b\322"
+	.ascii	"\222\3628\232\267\260\023\0357\374l;\232\211\006\257F\031y-\331"
+	.ascii	"\321:\322o\337kIT\313\376\350\2578\213\330E;}s\3666\271\242 "
+	.ascii	"\252\335m=[\345CI\006\314JH\304\341\334`<\306\213\203\367j\373"
+	.ascii	"\303\231`\b\360\330\335\b\276\213/u\360\205^\355aF\276\366\352"
+	.ascii	"\317x\257\263\351\306&\223;\373\270\177\374yhF%\252\250>\261"
+	.ascii	"'\351\327!R\004\207\350\307\316\343\316b\222\2621s\314\370\031"
+	.ascii	"1\335\372\305\243\240\220I\235?\236\032\365$\220\242\021\265"
+	.ascii	"Rg\21739\201\034n\221Y\301\360\342\262\340\031\002\313\003\007"
+	.ascii	",''\022LH\\\267\212\tlE\306\345\002\306\264dpi`\001_\\\027\\"
+	.ascii	"@\025\030\fhb\300\257\r+00\346\365\202\201\337(\373\321o#\205"
+	.ascii	"\003J6gu\002y55\353\234S\262\365\317\033;y\237\024\246j\244\220"
+	.ascii	"\247;E&u\247\273\273\264\316\213g1\370g\235\247\361\314\344\316"
+	.ascii	"\007hF\001) `\0021\244\265\r\263k\311\317\022\265\346-W\262@"
+	.ascii	"q\027\032\263\365z\220A\270\253\263Ysa-h$\201\013\f[s\242m\371"
+	.ascii	"\307\224\017H\242S \\\364z5m\266\361\324\302\305\302ds\353*|"
+	.ascii	"\265\220\2259+Z\023\003\267\273VXlm\267\366\353.\303\"\334+\326"
+	.ascii	"x\300\211\230\256\365\004"
+	.text
+	.section	.gnu.lto_motorPrevious.0.161.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375 \037\371"
+	.string	""
+	.string	"\022"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"?\202\210\200\b\1773\273\001"
+	.text
+	.section	.gnu.lto_getMotorStatus.part.0.210.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\370\002\315\027"
+	.string	"v\255\237F\260\034'\035\\\r\020\016\377 \265mT{d\201\006H\023I\234V\rJv{\201\233\210\272!\215!Ei\377\237|rA&\251\366L\214\264I\337\324\264\307B\375K}Eney\n\232\216Rk\204\354\275\245\224)\216"
+	.string	"\204"
+	.string	"\211"
+	.ascii	"G\377\277J\026\027\343\341\005\031Eb\204\333\f\330\023\250Zu"
+	.ascii	"\253\235;[\200\356\224K\200\356l\037\033n\352\363\350\224\315"
+	.ascii	"\252\360\3131\221hSK\3446KC\2731\356'w\300\264\031A\361%\023"
+	.ascii	"\324f\224Y1G3\366@\021\306T6@\323\304\006\024\215d\001\033Bb"
+	.ascii	"2\021\306s\\)u`R\332\360@!\241\001\2122\270\245\201\333X%\200"
+	.ascii	"\370\222\f\230v\267\315-\327\020]\314\003V\345I\250\265~\213"
+	.ascii	"r\354\301\375\037\344\277\206\237\327\004U"
+	.string	"`r\212x\316\003\360N\335\037\372\003\261xc\333\213#\351\325D\337\334\256m\247CL\3457\334\265\267je\355\036\277\212\237\232\374/\305\367&\237~\374\371\361\245\307o\312\347\311_\001<.\300\325jc\016\234\2324\263\fq2t\027\262\316\306\314t8\250\372\3229h\262K0\356\342\200\316v\303;\202k2r\335\267\377\036\306\352\256B\032\241@\325Z\301\375\346\206~\360\233\213\361\203;\225\206\036J\235M\f\337\300\201\003\335\351\365\346Vza\302\204\333\241\264\304\213\242\255nW\346\024E#\263feMX\316P\026\2246\200$:\374w\360\300\033\243M\243\222\\M\364\336\335\242fD\232\275M\344\207\023\233\354\332\271\326\345\241\263[Kf^\354\346\\\217\226\207\312\236\275\260\231\213\347\374;e\251\374|\201\374\003\210\371\005Aw\312~\3604\333(;\036\314\264\273\215\335\265\377!h\367\210\245\247\027\273\271"
+	.string	"\346\376E\370\360\306\272w\232{\0037\321\023\304\022\362\001b\265\360I\241\340$zZ?/X(VB&\200X'J\254R\260|P\254H\264V\254z\020<H\305Ok%\024\024\324Z\201+k\367\270\001\243\233\354\373\206Tft\263\"yC\232\352\032\377S}\tE\355z\257\254\265\326\024\210\024\2456\355\353\264+\362+]\224|\371\272ve\277\326\331\205J_\203qhp\\I\336\004\3525"
+	.ascii	"3KO\177\230[.\0238\314Oa\267T`/\266[X-\030\330\212S\255/\bM\233"
+	.ascii	"%\303\027\310\3163 p\"As\347\001\226\037\370\255D\355p\r\023"
+	.ascii	"\364\353\215l\300;\235\224#\003\356\262\rK],`\265\305\027\217"
+	.ascii	"\003\335#f\262m\272R\256Q6J\267\250Q..E\340\031\340Mj0]n\324"
+	.ascii	"\300f\320\351C\265\215\032\233\366=\216\302\332\270\273\f\330"
+	.ascii	"\215\371\r\371%S\324\362lkb\344\362\352\335\2739\362\013f\306"
+	.ascii	"\022\240\326A\374\202\315\360|(^!2\273T\036"
+	.text
+	.section	.gnu.lto_.symbol_nodes.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\237\005\205\030"
+	.string	"\346f\220C`\236\316p\2627\314\353\006\332\361E6`\206\221\337\0310e\361x\363\372\3048HgG\031\006\223\367\230\034\334NA\264\316pP\243\034\230\201A@\205>\033\351\215O\304~\235\f\336\023\361\210\370\335\344N2|"
+	.string	"\202"
+	.string	"|"
+	.ascii	"h\354 \365\271\316]\036-\236a\337\310\205\276\226\205m\203\032"
+	.ascii	"\365\263*\364\213\250n\024\372D\316\t\277\"\341L\320\3355\240"
+	.ascii	"\256k\262-B\177\314\ta\343\240\017\276:\3307(\253\r>\206\356"
+	.ascii	"\"\221KJPF\251)\244\261\251\250h\325\240Fg~z\f\372[\347.\027"
+	.ascii	",\037\312\273O\306)X=T]W\265\215\250\017v\256qn\273\275+&\353"
+	.ascii	"@UU\325\004\375#\347\356\366\200\005\333\254\361*\032\267\232"
+	.ascii	"\361+t\3278e<N1!e\374G\214\003Aw}HM!\237\234\230\244\224\234"
+	.ascii	"\242\366I:\030\027\362\242\037v\272\270Z\213\205\303\342h+\016"
+	.ascii	"E\305\237\244\370\031\212\233\241'\372J\270\331l6M\364\227\224"
+	.ascii	"\350\177\221\350{\215\350'9U\021\375\2563\304\326\001\361!\037"
+	.ascii	"V\216\2077\351\260n8,\036\272\313\342\261\3726\364\221\234\032"
+	.ascii	"\226M\206\315\303\260t\210;\007M\332=5M\013C\\\034\342\340*t"
+	.ascii	"\200\001$\317ug\256\2646N\210\203\326\037 \036p\007\304@\312"
+	.ascii	"\343\360\207\213A~\022)\310=\314\277\314\236\327VR\360dx\254"
+	.ascii	"\304\210A\016R\376vxr^\216\200|\034\0029\230<G\365\245\364\350"
+	.ascii	"O\341\321O\203\352G\331\321\257\242\243\357$G\277\354\251\257"
+	.ascii	"\304\321\247\342\324\267\322\324_c\352\223]U\325\335\002\315"
+	.ascii	"c_\3547\266oi\357\030\367\317\306\346Q\n{\366\231I\201\347\032"
+	.ascii	";\3467L\327_\020.Jb\312\347\333\335\317\225\306\267ubY\357\003"
+	.ascii	"\306O\2130\345oa\236(\315\334\322\245|7\345_\305Tc\273;c\315"
+	.ascii	"}\331.)\237m\230\362\327\224\017P\006\027\266u)\037-y3\262\373"
+	.ascii	"\344\251_O\231\352n\2302U\362\004\266\340\262,3\345\036\271\177"
+	.ascii	")F\346-(\274\337X\263\216(\344\342y\347\204+\207\200}\224\273"
+	.ascii	"\034b\001d\001i\2501\fC4\321\004\"\"\242 I\261\001\320\002!\242"
+	.ascii	"\332\006\021\2400I\r\212\244\002\221`f\024\364\334\016\b\270"
+	.ascii	"\233\177\366\363\351\024\226\236=\317\351\371\032\243\244\233"
+	.ascii	"\252\350\342\354E:P\302\222\201\377\"\263~\267\354xbj#\301\240"
+	.ascii	"\026\374D\0221 \250\234\220_3\370Y\244\317Q\360<\004=\336\267"
+	.ascii	"\324-s\221\262@\"\231\241\251\267QS\201\331\220>\020+G@\245@"
+	.ascii	"\312\306\021\240\266\226o\253v\035\224E\035@:\352\376t\3750\362"
+	.ascii	"\261\023W\324/0\233\300S!\263\217\365\354\237\223F\204\243\030"
+	.ascii	"\006\025V\313\356\350?.\006\251|:?#\312\264\241+=\270,\205\354"
+	.ascii	"\\8\344Q\341\367\250\220\375\224hTyW\300\3673p\324"
+	.text
+	.section	.gnu.lto_.refs.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`t\002\265\022"
+	.string	"&.\200F\340\320&\351\364\221<B\326@\347%\220\025\200\233\b\004$\004q\325\200r\026$\033dg\250\217x \303\032d\230a\206\031f\230\333p\375\352#2\030\210\001\374\241\223\307\206o_6\365\210\177\220\337H\353f\333\226)d"
+	.string	"j"
+	.string	"l"
+	.ascii	"\261\257\304G\211\275$\376H\354_\374S\354\321\373.\366\214\237"
+	.ascii	"<\220\236\037{\364\344\356\350^\367 ]\347\200\017\341k\360\263"
+	.ascii	"\333\264\335\301\361\\\274\224OtB\353\227\330\376!\356\367\351"
+	.ascii	"\331\372:\332\337to\263\365\230\366\260\355U\340\253\340\207"
+	.ascii	"t\357\301\367\340\036n}\323&\235>e_\312~\313>\313K\372\354@\371"
+	.ascii	";\255\216C\312qZ\265\201O#\322gLzL\311\277\220\364\326\352[\254"
+	.ascii	"\356q\035\204{\323\352I\\G\274\037R\365\203R}\240\356\377\351"
+	.ascii	"\372!\340\343\300\277\201_\323=,\325a\262\273\240\272\013>\313"
+	.ascii	"\327W\272O\351\272\t"
+	.string	"\374\025|\024\252\233\340\307\257\227DBR\317\023\343\033\210\375&~\215\367\261\330a\361cb\177\305w\005\n\2627\201\311\027A\354\337\260\361\365k\320\230\221}\031\361\217!\362\303p\375G\257\276\221\200\337\005\252\337\002\376E_\177E\367\023\271\330\220|\214\3652'\377\302z\027\326\253Z\376ky\257\345?\\or}\311\365[\200\317\342,\013\275\305WT\272\212\373\223\3269\370\244\354\024\322\034\334kZ\001\344\0367J\376\317I\177\304\211\367\357\034\027H\233\314\262&#\220\261\364\222&\033\220\260\2049\223\311\344*c\362n\365\035\2530y\276h}\036\261(R}\252\340>Q\230H}\222\020\n\372>\201P\237?\"\264O\036\235\017ZO\016\254\317\r\257\317\234\227\257\021\367M\361\321\033\344\323\003\302\303\353\333AC\206\034\f\027,|\275\025\272/\205\t\022^\275\021\\_\b\337\367\001\352\353 \325\333\340\353e"
+	.ascii	"\277\013P\275\001# `\"cV\365\204\020\206\017\210*.\303\337\242"
+	.ascii	"\020\342\316(\341b\334\203\235C8Guq\020\301*B\032G\034L'\246"
+	.ascii	"C`\013\310\214*.-\017p\201\231PE\322\217\222\353\201[\214K\023"
+	.ascii	"\033 ,q\343\243{\205\210j\246\222mB\003\f,\025\005"
+	.text
+	.section	.gnu.lto_.decls.c50d13f54ce853f5,"e",@progbits
+	.string	"(\265/\375`\376R\205Q\001\2720ZzT \fY:\215\001\325\247\362\245\203\2540r.\234\003Y\260\307\321~\354\206+\n\037\266\277S\371\224\331\2019\030\261\234i\206\023\333.\"\2020\035\177Z[J\247\033\276F&?\337\372\261\260\370q\0353\n\217\307\326q\221y\326xc\2140\253\311\266\267\224R\246\226\006\213\007\371\007|:\311\026\235?\327\350\237i\364/\330\r\037\313 .\226>\330(\337\200\355]\271\240\323@\b\226\030\017\245\263\032jd7\224\326L\230\231\222\315\353\207\262\307\327\322\232\311qy\254"
+	.string	"[*)\355\024KW\266\223\311\244\274\345\033\260=\213\227\225\227\001\034\2707`{?h,/\226\215\025@\254\031\034=\226y2\224(\001Y\321\245\274X5\216L\271j\227\310]r\213\\#\027\355\256\027\312E\341\276]\266\313\344J\271Hn\333]\273On\222K\345F\271Mn\332ur\253\\\267{\304\256,\256\325\357\005\373\225\314\274\226q\27753V\2464\304\336\001I\t\355)3WJ\032Rv \271J\356\227\025\333\331rF\227\275\003\222ZwVT\330\033\260#{\257\2770\376\213\365\027@\203\253\344\306\270\\\226\256kK\351]"
+	.string	"g}\003\266\267\367\n\264\246\347&\213\203\374\363\210\376Y\246\177\322\320?Y\350\233t\364M4\372f\027}\363M\337L\3237\201\350\253\343\356\260\253\321-\0233\345\302\353\346\233e\372\004\333\032\235\357\263F\347\315.}SJ?\253\321\317[\364\363\023\375\\D?\213\351/m\321\371\314B\037\307\321\307v\372\030\213>v\242\217\205\350\267\331\242\363XL\037W\351\247`\213\316\313u\357\326}\361\313u\265^"
+	.string	"\r\356Cu\271\362\336Ik9"
+	.string	"Y\313\301\234;K:9\363qR\377\342\351\337.\372\310\022\235?c\213\316_-\372.m\321)\302\022\235_\357\212\244\2378e\246\216\\\025|<,\360h\310\271\371\226\355\315\217<\275$k\376\006D%\264[L\241)\367\336\326\214\345\263j\376\206\233h]PQ\227\266\304[*\261f\316,1"
+	.ascii	"\034\275\302\311\331\362\356\233\274SW\352RY:\266\216\235sS\330"
+	.ascii	">\273Z>\273w\033\307\312"
+	.string	"y^o\343\n\240\201\345\263m\354\035^\225?\266\261#K46H\324\370\254\033 \312\275W\020F @\200\270{A\336\260.dKg\213\316\r\226\350\374u\323\277L\364/\021\375\273C\377\312\320\277)\364m\033}8/\372t\266\350\274\205\323\267j\332\242\261vv\255\300\246y\00148\226R\333h{\257A?|H\370\346\334|\233D\337Vp\332>[\301yk\246\205\312T\020\264\312\300\"#3&(i\225\2475\346\267bl\335\337\356\211\"zx7\343m\213N\f\302\320\331:T\3128Zn\351~\273\305r\261`l\030\006\354E+M\212\233m\027\353\305\256\031\354\227\035d\365\312\246\266n\276\035\323&\330\333f8m_\237\315p\332\325\026\235F\226\350\264)(\335j!:\265\272\326\335\266\367\0162ip\301avsO\226\f?#q7t`\221\013\332R\203k\337|\003T\361b\243b\247"
+	.ascii	"%\2056\325\324\227r\357\365V\355W\272\225\263mv\n^\3416\325T"
+	.ascii	"\230\017jSV\304\331\333{\375o\255\330+v\316\256V\316\276\335"
+	.ascii	"\302\331\270\337uo\252\2757\b\020 \214\260\023.\251*:c`\213\316"
+	.ascii	"\323\022\235_\322\317\200>\tm\243X)v\375`\335n\241X\266\233\311"
+	.ascii	"u\257{\257A\327\254N\024'7\277\001\372\366\303\211\373\372\354"
+	.ascii	"\207\363\007\320B\266\350\274\226\350\374\355\223\017"
+	.string	"\232\312\212\033\332\315\277]\373\255\022\213f\235\340\252\253\260\335\266\367:d:\331\222$y\263M\263K\354j\235\374\266\211U{V\013\333k{\257?8)\303\313\333\315G\266\350\314\226\350\364A\372\037\224\334\032\374\352\333\2443\250\257\257\257\317&\235_m\321\251-\321i]X\034?>\373m\220\037\373\370\257\211\315\376\013\202\257\004\374X\001=~\374\341\003\314\301\2173\300<~\274\343\277$\362\326\355\237\213U.\223\023\3747\004|\003\203\320\201\373\201\035\202@\316\372-\032\f\302\r\001\337\370\257\222\r\200\375\027\004_?6z\375\326n\3006\256\360\007|B\215\337\356\375\327\310=b#\021L\303\266E\371-\333T\336\177\201\340\375\367\354\232\331q\340\307]\030p\214\037\303\370\017F\316A\360\233%\374\227\263CW;\321\237\025\360\343\fp}\3477'\360\343\022\277\345\333\262\331\350\035~\363\203\377\246\270\305\375R"
+	.string	"\226\200\226\tn\377\2351\342t\307Y\227\001\307\313\335\204\022\367\360g-\277M\302.\260\256\221\265\373o\026\276Jq\213\377\022\355\030\026\330\352\277*\254\333o\345\\\251*\025\300\360?"
+	.ascii	"L0\213\037\357\037\340\317}?\036Q\202\363=\315\353\276\334\f"
+	.ascii	"\360\207\337\322!\3017\030\335\003X9\347\360\347\021~+'+\341"
+	.ascii	"\021`\024\377\335\201\372-\035|b\303\377\017\007\3723\025;\344"
+	.ascii	"\344\0258\376s\021)O\223\315~{\317w1\216\372/\003\002P\"\343"
+	.ascii	"\220\262W\376\363\233T\376\367\375\326\376\366\376\026\377\237"
+	.ascii	"\363\237\316\1779\277\315\377\371\376\233\367\237\3477\311t\200"
+	.ascii	"\243\260\t\323\315o\221\374\026\355\267i\277U\362\333$?\316\277"
+	.ascii	"\035\372\377\373\317\236'(\254R\360_\356\277\225\377W~\214\341"
+	.ascii	"\177\376O\245\377z\371o\335\177\305\374\227\356\277_\376\033"
+	.ascii	"\346\277d\376\333\001\371_\267\377v\371/\227\343\377\240\377"
+	.ascii	"\364\340\307\"\370q\b~\354\364\343\245\037w\340\307\032\370\361"
+	.ascii	"\005~<\201\037\203\360c\007\374\270\203\037c\360\343\244\037"
+	.ascii	"w\370\361\321\217\215~\034\364\343\237\037\233\377\245\363_9"
+	.ascii	"\377\325\373\357\231\377\226\371/\223\377*\371/\222\377\032\371"
+	.ascii	"o\221\377\002\371\357\331\177\315\376\313\343\277\021\370o\216"
+	.ascii	"\377\342\370\357\327\177g\374\367\305\177\265\376{\365_\253\377"
+	.ascii	"\252\370\357\324\177\245\376{\202\377\222\340\277\352\177\217"
+	.ascii	"\3775\376\227\370_\341\177\237\376\333\364_\364\277\036\370/"
+	.ascii	"\007\376\213\201\377\226\370/\005\376+\201\377\222\370/\003\376"
+	.ascii	"\333\301\177\023\360\337\003\3747\203\377\006\340\277\035\376"
+	.ascii	"{\364\337\n\376k\364[\271\337Z\371-\225\377\356\374\367\367\337"
+	.ascii	"\204\377\232\377\301\374\257\300\377\272\377\342\377\336\377"
+	.ascii	"\376\267|\377\277\374\226\316o\345\3746\316o\331\374V\357\267"
+	.ascii	"\313\337\336\3756\315o\311\374\366\312o\337~[\345\267\353o\231"
+	.ascii	"\374V\310o\317\377%\374\326\374O\346\377\230\377#\374\247\373"
+	.ascii	"\217\345\377\334\377\265\377N\376\213\340?\227\377\024\364\365"
+	.ascii	"\365\365\375<\035\374BE~\016\352\004\033\354\306\031$\371#G\330"
+	.ascii	"\325\315l\031\n\317\025\031C\270n\316O\254\013-\030\313\233O"
+	.ascii	"\264\324yM\215(\214>\221\233>\322\201\024\302\346%K>Gb'\2670"
+	.ascii	"\b\"\266C\234\b\211\346\220\207\364\214v\273f\264\\u\201\275"
+	.ascii	"\223]\035 \321\373\001i\243&\316\315'\322\241\217` \345#6'Ys"
+	.ascii	"\022{g\264\245\364\216\202$\211l\350[{w&\271!Y$6\243\220wd#v"
+	.ascii	"\214\003XT\355\315\225\304FM+\304\211\260\364+\324\321\026\220"
+	.ascii	"Az.{&\262\3462K\227\327U\312\002<!]!N8qsin\316\312,$\017\371"
+	.ascii	"wz\364\\\230\231s\363+\270\321\317A\376\357T\240\007\030\267"
+	.ascii	"\233\263\375\334\371\374#\003\371wz\\\230\245\251"
+	.string	"r\363+\250\321\317gz\315\226A\344\346\354C\253\250"
+	.string	"\346\303\016\221:.r\364x\366\361g\263{5\202\276:pn\376\261Dg\346\241\364\334\343\013\226%\223\233},\321\371\nZt\222\021\262g\035dl\304\272\222x\324r\220\275\345\250\240\2469X!=\213\3315\213\345)\236\255\337L\331Xn\255\256\020?;\276\304\302\334\374\nd\372\b\r)\203\331\034\266\346\260,Eb'c\034\005Q\373\001\266\267\265\326\020\257\240B\337f\251\363CW\215g\257\032\371\313\356\275w\327\226\312S\362\222\324J\372\357\346\371k\256\210]Z\020\033\037\022\243\0050\004)\267\310W\317X\317]\277]3\026\266\323{o\251ug\031\345\311\375"
+	.string	"\333\333]^I<pTe\312\233\237e\344\031\377\216y\026\345\211\336\315\037Z\242\237c\374\337\001\222S*\301\334\234ah\025CF>\350\037gIT\334\234a<\277"
+	.ascii	"\301YE%F\344\346\274\225\271\236_d\255\374\"\203\260\275\223"
+	.ascii	"\371E\020\235\275\223A\326r\260\226CN2\006D\312\231?$Dg\027J"
+	.ascii	"\317Y\370\314V\\\214\233MKt~\310K\377\366\367?wRk\357\315e\256"
+	.ascii	"\033n\312\347\374\355\255im\322\377c\261\355\360?_\002\030X7"
+	.ascii	"\325\225\273\275\267m\003d\203\210\220)G\333\244\323\252Z\023"
+	.ascii	"\223r\200\330\026\225\330\214\2525\261\255\241\2525\261-E\365"
+	.ascii	"CjHk\213IU\255\355=DE%\005B\330V\325Zr\017U\255\355\255\235B"
+	.ascii	"\314\226\335\253\230\324\246\n\333C\233j'\367Z\330\326Q\025\225"
+	.ascii	"\330V\325Zrk\250jMlk\257\211m\241M\225\324bA\265\265\206\366"
+	.ascii	"\232X\336^\013\333\022\252Z\013\333\252Z\023\213b\347X\365\350"
+	.ascii	"\202\361v\307\003\314\346UQm\027X^I-!\272\2525l\237\331\333\266"
+	.ascii	"\251\330Z\233n\357\016{{\205i\235I\316\260pSt.\246\246$\303\354"
+	.ascii	"\272\367\316\20055\026\266\251\350\244\354\246\253\"\022\266"
+	.ascii	"7\221\251\247\215\265\367\336\031H\255t"
+	.string	"\233\207\245\223\"\363\332W*\366\326\260\327\275\261\366\226\262\233n\357-\265\367\376iy\255{\327\020\252Rba\355\335e\204\265\275\244\342T\354}\333\354\340\266\252\326\306\302\224\342\240\254)\367\212U\312V]\205m\345>#\246\245\327\244\232\354\253\275\267e\243\225[/\3642\213&cVfn\276\020\032\235W\230k\264\270\275\335|!.:\247\270\200^\026\253\233/\364\266\366\300\201E\201qsN\032\335\264\271\033Fn\276\020\n:\357\240:o\246\240\221\301\307\224\203\355\312\315\027\302\322I\230\316\016\325\032\264S\206\315W\333\315\027\242\322M|\354\332Pi\223\023'\263\275x\322\205\337\034\307\3711\034\274\3679\323\b\233\235\327\315w\265Eg\222%:\261\033\245\3437=T0\244\374\270y\247\315\271d!sT8\330\350\355d1\303E\354X\017\214\r\323\362\311\253r7\226\2674\321\325\265\004\357x\t\306\206a"
+	.string	"z\361\344H\215\233\361\032\245c\274\016\314\310\222\334\214\325\030\375\244\241\343\345\313]\232;\207\305\225\267\233oW\234\306.\303i\315\271Asl\3675>{C\216\223c\213\336\315w\203\317\374\337\371\215\021\013\353q\363\0336#\245\334{\013\231Ye\340\244p\363\203\370\364\217\313\214\001\2021\267\333n\276UK\001\213\301t\230\f\006\203\353p\030\374\305\256x\f\366r\331\266\374X\242\3411\030\213\006\\\352\316\262\324!\321R\007D\211\307\340.\366\256H\223>\256\275\275W\223\005\027\273)\241\374\240*\372AO\364\203\216\350\007\351\320\017\202\241\017\304\247\017d\247\017\024\247\177<\207\257\360\\\225Y\223\004_\371q\034\226\303Vn\330\233/S6\236c\303\026\347f\237m\213N\273\302a7+\004\20561\336p\225L\304\315\r\n7SY\247\354\275\215~rV\226X7\037hM\337"
+	.string	"kq\224Qp\033\226\202\247\330\025\273\341'\267f0\224\347u\357)jN\344\340\261\375\rhg\357\0246v\303j\177\003\242Z\267\217\r\346l/5\276\\\361\344\003\255\332n[t\036h\210>P\017}\240\034\372@7\364\217\233\\.%X\306\332n\376\361\312\304\307\b\233\026kn\376\217\223\3404\274\004\243a%v\305L0\22266\024.\027^\225?(cW\313\"\026\214\245+\333y\n\313J\251\201\221\026\230\t>ry\374\246\254\254\224{\230\t&b\247"
+	.string	"%\327\255\365s\342\302J\271\267\367\312C\205\252O\212O>\320\226\376\217\034\375\0375\372?c\364\177\342\364\177\212\350\037\017\301\312+X|\250\270\371\016\177}@\353\r\330\221[\205\225\267\305U\002\224\\\267T\324r\377\307A0\020,\304\256X\211}\034\237\341\037\027\013+/\334\265\263te\246\031\026K#\020\327N\371\303K\347_\230-:\337\306\022\235\377\341\241o\361\334\244\240\274Xj\316\260\331\"\307\315\232i\243%o\r\230\213\245\307e\217\21253G\n\376\302\033\273\300\2532\0042u\332\226\370\353\3621Y.\275\\,\274/=\260\016\f\206o`\0328\007\346\201w`3l\003\327\300d\270\013\227\3411\354\205q\3400,fW\374E'J\336\2337%\234*\312\274.\370\353\306\231\262\334{\375\t\363\302\215MR\376\225Sq\004W\261\370\021\227\002\211\006-|\240%\225(\257\314\330\254\316V"
+	.ascii	"QJ\241)q\026~\201\261p\f<\003ka\031x\013\303\300\\v\305.\376"
+	.ascii	"\333g\363n\361\324\257\204]`*\267\034Ao\300\316\342\\\310\377"
+	.ascii	"\331\322\367\251\243\357\223F\337\007\2136\262E\347}\240\350"
+	.ascii	"\373\030\321\367\311\241\357\363Bs`\213\316\367\320\321\357\021"
+	.ascii	"\243\337\323E\363X\242\363=m\372=G\364{p\350\367p\351\363\360"
+	.ascii	"\351\363\250\321\347\311\242\317\363D\237G\251\317cC\237\247"
+	.ascii	"J\177g\216\376\016\032\375\235\024\364w\326\364w\312\364w\262"
+	.ascii	"\364\265\033}\255F\337\346i\211\243\244\273a\356\230\013\346"
+	.ascii	"\326]4\367\313Ms\305\\3\267\314=s\311\330\365\332e\231\303\346"
+	.ascii	"EM\034\227\024x]\236\254\031rw\205o\211%\005\035\245\322\226"
+	.ascii	"\275\345\225\263B\246O\031Wew\347\236\324\261\273)\330\273\034"
+	.ascii	"r\226{\257 \214@\374\274\222F\220l\310\327_\364\365\024}MD_{"
+	.ascii	"\351\353+"
+	.string	"\375\037\034\375_\030\375\237\023\375_\016\375\037\227\376\031f\240\\\361(s\024\246=\264y\371\t\306\313Yg\325v\326\005\330\340\325\270nC\312\240\210\371Y7\247\342\256\215\230\233\3170\237\233\023\205\311\230\233O\272\317\375\270|\031\273\361\271\030qJ\274|9\222\241=$\265\374\344\242\305\202\0266p\340\200z(\225\350\330BG{8c\345\347\234\2253\213Q\0306\343D\316\336\221\275\273\222\264\0331i`'\226\237Y\224\310\2553\354\2359\366\346\356\355\212\005_\264\2078T~\276Q9\343\214\302\260\231\027|2\216\354\030\201\263\262\341~\306\245\210\322\206\373\200\2664\331\032S\305\2024}\201\025\224\237mPN7\266!r\366\366\312\210l\201\235R~\272\331\355\330\222s\363\031\305\336\375\337\301Yps\210L\371\277\223\231\f\351\322\301f\201\013\355\301\205\332\3175\265\rL\301\201;\202\335Z\260\020\343\004\214\356"
+	.string	"f\311\317uI\016c\325vV\321\034\2557`AgxR\326\230"
+	.ascii	"`\211\356p'\344'\021!'\232Q\230\224^\222"
+	.string	"\222&}\\i\235!6\216\374D;\225\340\026l\250\374@r&\361\3513Sw\206\304\315i\344\007\333\027\230\233O\024\200\262\316\3360\271\371"
+	.string	"\350\322g\221!"
+	.ascii	"\330\372\202\260\036?}\3648\225\033\254L\341\325\360\231\322"
+	.ascii	"\"\366\006\344\247\362\r\005'j\342n>\177\230Mr\304\211\271\371"
+	.ascii	"<\013\252\322\344\214\331\337l\221*H\244\230m\321\027\254H\271"
+	.ascii	"\305\177\222\375<\311\3162\253\266\263\354\216\2724r\366\366"
+	.ascii	"\356J\272=d(\227\234;~\226\375\270yB\267\244\316\377\235\363"
+	.ascii	"K\026\03597\377\254\240\210\346\260\205\364\363\024\313SWh\357"
+	.ascii	"\034m\230\356\355k\306\315\257\200\206\346@v\326\370\031v\326"
+	.ascii	"\340\321Qg\003\243\261{2u\363\tv\3368\277N\257\323F\034\315\301"
+	.ascii	"l\353\347\214s\353\354*\001\202-7\365\265\334Z^!\262Z\234^\032"
+	.ascii	"\225~K\301V\347\3463\306)\003\306\213\223KNsx\202\3643\353\314"
+	.ascii	"\312VFB\233\312\311\016\031Yr\310\315\337\320DsH\341\\\361\023"
+	.ascii	"\353\\a\266\363C\215\024\256\233\317\026\347\325iu\2628\2536"
+	.ascii	"\370\320\034\276\360\375\244\342;S$u%\3052(b\216\371X\303\254"
+	.ascii	"m?-\276\324\221\271\371L\236S\247\324\271\3736hi\016{H7\351\230"
+	.ascii	"trU\222\320\336cZ\254\220\024\253\234>\335\241E\233\233r\332"
+	.ascii	"\230eNP\261\303\304\311\333r\255\216V\332\315\346\236\031\007"
+	.ascii	"\216\371\306\215\235\356\260ew3\317\2643\365Htm\256\f\224p\371"
+	.ascii	"H\271@Sw\363\251\005\312\233\362fs\215\271\004\262\342\342*\311"
+	.ascii	"\3157\361\376\357\360\224\2119+r\363\265\237;M5=kl8\354n\276"
+	.ascii	"ygu\034\351\302w\363\3154=t\270\3164\241\240\313\207\020\200"
+	.ascii	"\005iq\363)Xu\207\033H7\317\234\301W\362\320\336I>\270\255\325"
+	.ascii	"\025\302\334\343\243\343q\363) \323\035\204 Y$\326lr3J\023\263"
+	.ascii	"\214\322\324N\236\035\245\311y\205\370y\023\243\314\227\233\311"
+	.ascii	"\254w\n\233\27407\237\202\031\372\026M\2129\005\315\222\212\351"
+	.ascii	"\266a\252\212\004\332\231%\234)g\351\312\034\200\202\227e\025"
+	.ascii	"\323\rHjho20\312/\346\030\263\316\fc\2021\305\330\325\2443\255"
+	.ascii	"\030\255{S\261\231t\346\233\003\320\276\320\231W\314.\226\256"
+	.ascii	"KhSUQ\263\334{\363X\211"
+	.string	"\321}\001e)W\263a\252\212\304\2224K\223\213\351\305\256f\227\033\031\340W\352b\316\231[,]\327\272\271z\25081r%\003\210\037\2751gl\234\3717\267\230Z\246\254;\330\334l\246\360\353\232\301%\305\315\327PF\377&\026\273\232Y\264\233#qsn\276\233\253\371\277\323\223\245\307X\235\276\006/\372\032\340\3148Mf\371\365\345\346k\220\242\257\001\212\276\206&\372\032\220\350k \242\177s\212\351f\256mic\272\331\273:/WS7_\203R\233lf[\020\022*R)\314'7\241\374;\267\214\006\02667_\203\231\276\271\026\244uf_\271\371\246\223\377;N[YBn6\325\264\n\r`\037\314#gnXL\265?\363\260x?^B\310r\334|\rS\372\002,i\346j21\323r\031\273\265\336\234C\364~\200\355\361\030\241\313\313Z\222A\215\266@\003\351\246\022SI\020=1B~\222"
+	.ascii	"Iqu\363"
+	.string	"3\204\321G7\220n\"A\362\271\274\356-\243 \\4\302\324\021s\3633L\321\246\r\244\233F\354j\032\301q\254\226\335\233m\312k\231\306%\210\222\233\237\301\210\316}H7\203\0041\213\340\252\260\244\330\005A\254\364\220\343\241\202\223\363u\263)\304\034b\327s1\211|\r\342!\333r\205\315\315\317P\245o\317\345<\201=\227\363Fl4\0062H7\201\374@\260\336U\333R\033\250\323\321\346\310*\266\246\335|#9\035\004\004\351\346\331\031^&\205%\305\216\212l\365q\001\245\265\371\260\273\371Fm\272\210\013\351\246\231i\206D\f\006R\005\004\310\021}\301\234\0357y\354\300vuL\260\"iRe@\364\007\024\306n\346\030\343\202\271$\263\364\270\371&\231\021\230\376\220f\336\270\211\303\274\221\313\b\355)5S\224\273\253+\251\307\212\225\275(7\337\f3z\241?\254\2314L0\323\206I\303\264Y\204\374"
+	.string	";r\356\024p<L\257\233_Axp;\356n\276\033\013F\331\306\207T\r#*\375\301\214\031\343\346\f3F\020\271\037`{=X$o\276)\003\303\236>b\203dnY\363\205\371\342\3620\332Ry\035\f\341\"\243\255\275<\316\016W\220n\2720]\230Z\270j'\3110`bf\335\331\310j\273\371\030\242\350cP\352#6\244\020\326\2742\257\3440xi!\"H7\253\354jV\231VIa\373\305"
+	.string	"\214\304\365q]1&qb\334l\262\370\371\270{B\345\346c`\241\177!O[\300\207dRYS\205\251\342o$\254\022\215oYF\377\315^\252\275\223\036\202r\244\235\211q\363\021\013\244\233SS\370\n\211uK\365"
+	.ascii	"\321\273\240Ew\350B\272)eWS\n_\331\251\332{\213\20349\263\032"
+	.ascii	"w6n\376\005%:)H\235\347\276:Fu\222@_\222O\334\360]\b\242-\270"
+	.ascii	"Cz~\363<\347\215\245#qw\n>:K\237%:\274\250\2709\307\311r\236"
+	.ascii	"\3672\234\013b\372(H\2336-.\\\351\2433zz]s\364\221\027\244\020"
+	.ascii	"6/\227\237\313B\233j,Ki\247\217\344\326\254\021S4\247\223\260"
+	.ascii	"\354\236\357\354r\231\f/\204\254\030\363\322J\203\2469,Az>\263"
+	.ascii	"\3463\331Jio\262\256\016\212\3407\261\27527\277\210\207\026@"
+	.ascii	"[\3353\231\272\\\306>I\323\241\247\205E\2315\246\030\"?\244\214"
+	.ascii	")z\241\005P\345\3133\335\227\034\206\304\316\222\374\001\266"
+	.ascii	"\007\364\246\367V%\314\345\332\t2d\354\n\f\035m\001\033\244\347"
+	.ascii	".]\376\226\327\355\343\367&ga\215\026\200\226,\317Z\262\344-"
+	.ascii	";\013 c\346\003C\312\232\302\226\277\355t\231i\245\340E\013`"
+	.ascii	"\214\334\363\025\271<Wa\357\275\225?(9n,-\222\030I\2649{\327"
+	.ascii	"\203f\353H\232\2257\rbE\225\034\227\341\252\344/-e\201\311\216"
+	.ascii	"\225\032\032\2737\013I\264\005Z\220\236\247\334\256yJV\221\024"
+	.ascii	"\266\2710\210\023\326\025\"\bk\310Y\214\233o\201\207\276"
+	.string	"P\207\364,E\n\256C\",\311u\201\02551B\366\366N!\004\320Y\233\254\264\233O\304\247\277\256\231\355\334\333\256aYZ\273K+\351\2025Mr[v\322$\263](\271\367\324\016;CP\306aqiH\210)=B\245N\35015\016=@\006-\374I\004\212c\252\252\350\t#\220\307\"\222\230\"C@\022S\343\260\370\201\207\035cQ-\001\231\036\203P\"HI\310p,\206\200L\221B\250\022\304\250\"\223\n\365T\3020\312X\301\237D\244\303\240j\376ID\0218\2142\216@\036S\023\301#\323\221\006\206Q\306\237?\211\250 5\021T\227<@\212\2206\241Ha\020m\022J\231\212# \241\212\303\"\261\250By\340D\f\242\020\206\200\024\341(\005\246F\024&\250\250\020jI\210.a\370\223\b\344\223\212\016\233\210A\364\250\"\211\305%\236?\211\030\221\036\241T4m\372\2410\026?\240 "
+	.ascii	"\026\214\305\017\204\200\026\216\252(\223\232\"\177\200\251\212"
+	.ascii	"\n\215\303\324\004\nP\030\213\037P\240\376I\204\021\252xt\002"
+	.ascii	"\036S5"
+	.string	"\035\242G\3248\302)\330D\274`\211\b\025\202\223\261\207\330tM$\320\311\350\243\002\211NF\223\350d\304\351\b\202\310\214D\246G&&\364\207\302X\\\312G\325\210\231R$T\376\021\350d\364AqT\221A\247\224\004\r%\230\320\242\260\250\307\002\262\t8\202X\034\016\213KH*0\203\r\220D\250\020\204\350\tE\241\223\205?\211`\n\032\215@\020\241\0042x\002\375}\260t\334a*\216\020\224\nO@M8\021\034\352aT\t!cQE\362 ="
+	.ascii	"R\203\307\250\236c\032\024\032\203\252\020j\204(t\003G\265\004"
+	.ascii	"\005\304"
+	.string	"\020P\b\215F\017\206FQE\n\020\251\030xTbz<B-\371\240@\217G\017\216\3500x4V\240\006\211\"\3540\245L\251\321XTK \246O\032(:\201\022\203#\b=9\005IX@2\245 \250)2%\301\250\202\2122\0311P\304\224\252\350\021JEKP\241\214*\224\005\220\"\\p\"\242$\234\b\216 \364\243\246N\026\204\376$b\211\bu\034\261d\001\322\t\025\206\220\252\250\212\344I\201@\030\210P\217\250Q\004\022JE\325\022\324\324\251(\0252\2110T\201\347\007\003\021H\250b\320Dz,\021\304\224\022\235\202B\364\207\374\035\211<\0018D\217*\022m\022\361c\242\020\032\215\350\205a\252\"Q\224P\001\tj\352\344\341K\351\b\202\303\240j,\352\253H\264\311\002\347\021}Z\312N\304\240\032\034\006)\220\252(\tB!\024\261\350KA\375\f6 \300\006\034\234\370\235\203\004`\220"
+	.string	"\f\316s\220"
+	.string	"%\245\004l\240\244\277\201\022VUUM\201\251\212\252%X\240\002U\255\002\013`"
+	.ascii	"\025-\n\233\314?\211@.\035G,5mX:V\320Q(\n\037d\321\310$,>\001"
+	.ascii	"U!:\004d\n\016\213R#\n\023\234\210A!\023\021%AdB\312T\034\036"
+	.ascii	"\203\250\221\032\205\242\300H\240\026\n\213\307l\3760\245\352"
+	.ascii	"15A\024\001\204\013\251\021\205\t\303c\261IE\205F\037\244\021"
+	.ascii	"\025\206\200D\237\264\232\"\323c\211cz\"8\002S\032\024\032\215"
+	.ascii	"\250\007OKj\260\0041\252\b\202\t\304\340\bQM\024\230@\211=L\302"
+	.ascii	"\342\223*D\201\307b\023\220)8\004\"\2410\240P\235\210\301\341"
+	.ascii	"\021\005\242G\365DJtL\221PC)Sq\bT\205\250\205 \025y\f6\001\205"
+	.ascii	"AT\005>\251G bq\310\211\030d\"\242B`z,\022\235\202\352\361\202"
+	.ascii	"\261\250\"S\246\340\361\230\232(f@:\241\302&3=B\t\203h\023\020"
+	.ascii	"Y4\022\005\245M(\022\250\022\203E#\n4\352\002PQ\205\":\201\016"
+	.ascii	"\213\206T!J\f\252B\364\004:\004\022\243\212LQE!\322\202JL\227"
+	.ascii	"\220)\023\320\351\230\016\323\n>CO\352\021H\f\016\205\324c\361"
+	.ascii	"\004\024\370\244\036\211\212M@b\020=\036S\n\322%\"\252\"\215"
+	.ascii	"\210\305\240\272\224\036\203L\300\"0\035\026\237\200O\3521\203"
+	.ascii	"\020=\246\304\324\351wLM\024\237\200P\240\302\224\t8<\242\310"
+	.ascii	" \023\260\250B\241"
+	.string	"C\0300\004\035\213\352\022\332d\241\210IXtB\235\210)2\310\004T\221\305b\005N\304`\b\320\343\t\025\322a\320\204c\212,\032\211\212\306\023\020H\221\304\242\021\231\222\200,\032\203\226\206\367O\"\212A\025u\n\232@\211\036B@DO8\201\016\203N\240C \24645\"}\220\310\224\370\244\026\213C$p\251\0021x\002\035\372\024U\340\323\222\0324\016!\241\202L\350\021xL\325`Qx\246&\202L@&\"*\fB\241\006\227\212\302\324\304\205'd\232.-\241O\310t\030T+\244B\246\240\205c:\f\252\025\214P\304\240\021\t<\026\325\242\0211\030\244B\025\323aP\005J\231\240\324\240*$:a\030\024.UH\205ND\024x\002\035\002\237\226\210P\250P(U\321#0\nE\001L\221A\250\343RP\212D\323\343\0221\b<>\251@!\nED\207\300\250\242P\210f\020\026\213\017"
+	.ascii	"\232\0330\201V *\204\024\tU\001\004a\361\250\022\213\037D\241"
+	.ascii	"(*D5\335\237\023\350\260\207\211\210\016\207\305%bp\310\223\252"
+	.ascii	"(\t>\302\342RQ-\036K\f"
+	.string	"\243J,y\200\034!\035\006M\020\246K)\bB)\224\020\315\200\232\"\233\232,\220\n\231D\020\242j\320)\310t!\0252\211\340\223\n\321\245\022R\241\252\026\217O\352\217\n\344@%\006\241~*\021\252\370A*,\2268\026\325\342\020\350\367'\r/\032\323\343\b\265X<\216\350A\002\235\202M\304\342\007\310cQ-\216\220\nO\b\"\217\251\211\364h\024U\024\372<9\005\237\200LD\364\004&4e\372Q\201\033(\251\304 \224\026\242G\025*%\376\256A\223\0010h\332`\003\004\210\030:\002\020\360\301\021\006*\020\001\275$\342\230\236\b\016G\250ONAa\323\bb\020\035\216X:\"G\210\310\360\2738kgn>\343\202\367\303\207\n\236-eS|\230\235ha\326\031v=~<\354\233\274,`n\306n\222\220\271\031\004\327\017\307\257\3547\366\303\361\333\361\n_Iq\302\336\200\375v\3500\341\250"
+	.string	"\251\241#\207\017_\013\2625d9E\020\230$dpd\330\207O\017\036k\f1\037\372\377\205\261e\024\206X\005\271\221\267\374,i\353\352\002\226\303<@\357*\307\357\353\314\343\211\322\227w\367\363\312_Ac?\322\336~6\316:\314\243\357\n\233_\r\263H\n\033xy7\377f\374\272\376\243\361\037\215\373\243\201\373\372\316\2641l\347\372\263\304\rF\023\030\377\305"
+	.string	"c\177\\W\232\310\335l\241(\375\007\003\016\213\n:/\316,@{[\310\260\340:\343V>$i\266N\267\213\307\002\315\205\226\224yef\r-\353\3628\205\204\331{q\363\016\312S[^x\375\260L\255\214\205\316\r\220\337U\231\034\205F\331\330\257\205\325\230\032<%7\2030\363K\376\254~T\277\344\217\305\016\317\222>+\345\336\356\202\221\364\377R\374\307\342Wu\326-\277\254~U\277\025r|zyT\326M\244L\317\212]\177*\360\223\377\177\201\206\307\232\337T\r-"
+	.ascii	"\274\223\357'\365\333'_\006qB\316>\016U\372?\353(y\316\234\231"
+	.ascii	"A\201\316Yv&,\307\325\315+\332\336+\320\211\202\217\025q7\257"
+	.ascii	">YYfaqp\035\035e\r]\213\275\\\205\301l\265\251\002\307\324\003"
+	.ascii	"\242kQ\243\353M\266\352\331\032\"'\351\346L\361K\303QeI\236\n"
+	.ascii	"\212\223\323\363q\236]u\262\250\301\273\331\203\0205?\361\324"
+	.ascii	"\234y\033\206\260\351!\207\001\036oJ\226?\363\336,\233]\030+"
+	.ascii	"k\340h\017:\320\374L\203&\2071\322;-\207\217\345\336]I?m\350"
+	.ascii	"\226\330\331\211\321\036j\220\371i\206L\336b\024&\005\247G\353"
+	.ascii	"JG\227\r\205\277\250CRDRH6\244(&\231RH\212F\264M:\323\025@ X"
+	.ascii	"8\"\024\214\2679>\023\300\004\314\3523\222 %\231RhDDDD\342B\246"
+	.ascii	"9\206\016\"\337)\220\311\315\027\245\221\321\006\222C2\247\332"
+	.ascii	"\253\274\035\206\214Y\026\357\b\021\177\316\217?_/\226\001=\\"
+	.ascii	"e=\341\021h\013\2003\315\376@+\347\037\r\343\214j\354p\274\223"
+	.ascii	"|%\207\222\202\032.!\206\030\321\361\221JJ\373\371+\203M!\322"
+	.ascii	"\353y\254\210M\337^\\\203\223\315V\254\364\262\231?\177PY\tC"
+	.string	"\035v\260\310\32301z\2276N\245\305V'\336V\313\004\337>-L\356(\325\344\027$S\257\025\372H\276R\225P\013\312;\006\020i\364\347\274,\212\225\333\013\035\0133x\t\357K\360i\261\335VRGH\264\261\235\232\327)\017I\021\177p\366g\332b\344G\205},\346]\224\342]x\252|6\306\311\237o\257\312\217?\223\033\232\220n\320\360\271\260qW\2717\251\307\362\235\002~\215iC\244:\fc\017K\262\371/\301\006\375\t\207\337\320\226\220\321S\323S\034\206\302\334\364\271A/\324>\316\346\003\344@}\361\264l\206\024\206\034\202c\324cp\267\241on\235\030`\300$\022\377\034]\255\303\203~*\350\b\037\326}\241$\203\367\357l\221\031\345V\023!_\002TT\2506\332:\314\324\303s\002\350;\032\341\200\332"
+	.ascii	"\361\371'o,b&?\253\302\205\230\322\004\301\374P$\033\246\265"
+	.ascii	"k.\276\224&,\253\025\222\b\241\277\330@\223M\341{\267\2545q\322"
+	.ascii	"\251'_\254O\"Z\037\332\2364\211_\200\274\220\302Pv\302\020\332"
+	.ascii	"\002\310\362V\363\314\204\221\031n\305\037\347u)\344_\226XIf"
+	.ascii	"B\376M\3521\346y\320\005\3116\312\020\253\025\343\335\360>\224"
+	.ascii	"r\332\241.\"E\310Rc}U\361\021\314\032[\\\256r\360V?\215\016\257"
+	.ascii	"1H\265\377k\307\222\304\266\004\007B\215s\260:\362#\365\351H"
+	.ascii	"\303t\016\037\245 CZ\235A\342\314\215\f\231\223.\362\323\375"
+	.ascii	")\334\267\232\315\037\240\243\302\017\306\t}\\4\244f\331\n\205"
+	.ascii	"\374w\323jv\0338\261\365\372\353\335\3645L1q\223R\331\327mf\263"
+	.ascii	"\005J\024\357\362<>\r\252\005\351cd\231\351\020\300\332\t\034"
+	.ascii	"$Q\027\255\315\341z\364V4\211'\244\004"
+	.string	"\005\177.\302\352\277\357\020\366o\241\210\306\262E\036L>\333\254vC]\333\032\351\242\032\374\335\303e\340\021\252*\310\034\217\3774\350\272\320<%\2671\374\370M\365g\372\341;\022\017=\335\031(Ud\236:xX\307\233\234\270@\325\257\277+!\n\203Ei\377i\035\255\310\330\007\345N\230\265\310\301B\346\031\037\223\230\034U\344\243%V\024\334\264\323=\320\215S\242,]\353\"\317\373\356[\311\314&\234\023\213\307\270/<\254\247\303A[\335\367\366(\211\r\351\226\003<\346\343\\\335\326\301e\f\004\364\246\221\366;\220R\224\226o\365\0040\346\264\177&Q.\017y<\345p,\357s\373y\243n\t\300\231}\333':\n\265;\026\250wK~\227\220\013np\231O\330)\b\311\002\373J'\260o\323\214Oo\260<~\217\357\006l\325\264\351\236\316\234\024\275\033q6\355\262\300\274\237B\264|@Lg\005S"
+	.string	"\234d\237\304@\272\3136CY\\\322\207\366\314\204\002\213\310VxC\026\242\200L\223\n\036\240~\231\327\2367q\205\340\245n\016 \332\305\231\375\3240\367A\035\316Q\tS\027"
+	.string	"\314:\223W\301\004S'\217\347\322\322r\273\357\240\232H\323JnDP{\372xn\240,A\245<\034\361$\fo\207\203\335E\375k\235\001V\322\233\305U\rr\360%\267e\260\274R\024\207"
+	.string	"\030\326\207C\023\260E\272"
+	.string	"\240\303:\007r\215`\035\245\261\270,\346\216\217\326`\302\340X\324\345)\226\r\"I\242C\206z\336P\3403\301`\302b\270\302\214\036J\313P\372\370\232\246A\335H\343\032dSL\\?\213\237W\275S\225+0\327r\355\t\331\217\020\300\342\324\334\346\300\270p\273\350*\263Y&-\310n\005\330\023\260\223\303\324K\034)\267]\002\275\365\3523[l\220\225\225\367`,\2245Q\002\336P\207\374\322\024AW\305\304Ai(FCx|\224\213q8\003\320\237\016\224\320:\355\262\032\034(\312\370N\001\3776;\350w\324\322}\006\352"
+	.string	"b\247\304<\b##\221\025U\"\022Q\332\374,\372\037e\275\216\322\244\322v\235\211\371mb\0223\234!B\350W\377n\303I\373\205\026\225\025\023\226iqq*\002\251l\360\305%k\342\330\026W_\027\320\207\246g\003\033\214\240\332\304Ae=\352n\335\026\247@\247\265\333c\332\3729\204\201\223\177_\232\232XPK\256Qii"
+	.string	"\270\200\217\2415\350Z#\270\303\205\030C2\272\265\311\351gD\020\333\235L\364o\016\367L\326\212\222W\222\276M\036=\273\260\307\323\007.M@\234\237C0\316\335\243\317\203,\3450.>v\376\2626\316H\222\255_$\213\252\222\372P\212\031]T\333\037:b\033\022\372\301`iK\214W\350\344\343\033=\r\332\023\226\253\bG\300\202z\360\275\305KO\030\351\357\357\001\200\035\304\347F\037\344\\-g\322\024\"{>r\022`\346\340 :\233\255:\243\254C\030\005\265\325@\233n\003i-R\330%\3159\332\031\036\027\222\321.\3066\201\252\0376\317\260\253=cn\363\313\225\007\262`p\252\342\272\301\016\0277\3137\306\353\352\352_5\330o]\370S\027(\360\004\215Q\360\276\355@\202u\211\t\320\267M;\203\351\332h\205"
+	.string	"\274\323\r|\245\355\256\022\213\b4KZk\035\305\274E\254P\361\002qB\344\026\007\034\350!\272\354\350\210W\227\356\375(E\\\204\272\020\272^\227\245\275\027\212\352)\330\257\300\212\327\276M\363J"
+	.string	"c\213\277\333\"\314A\n\2348\354\261\254\347>y\034M\372\ba\201\340t6V\003\220\024\222kq"
+	.string	"A;\344\327rS\b\206O\020&\221\030\347\317\3650\222*\213\347\323\361y\345\266[\021$\253yY2%P\030\366\204\017t\202\355\356j\377\220\t\205(fjW\027\310\371\004\314\255\345\300\025\201\354@\231-A\0165\240\337\253\214:\227G\312\237m\267\013\271\r\025?\363\2523\214p\345x((\025\333\355\024N\311\024\342X\262\343&\314\330](\\ I&j\363\317b\375|\301\230\207\264q@h\3557\237\201M\226;@\226q\266\337\204\020M\0268\203 \003)u\205$\360*m\330\322qW\344\371\037\342\371\026\350\233\"\2741=\354e\304d\312\224y\007\310\267\240O\t\224kM,\241\257\210\251H\357\352M\213\255\030\017\266F\260\343\326\202D\211Y\263Vl\016\342e\n\250\247\236\313\227C\017\"\234\215X\013\304\322\b\314\372\254"
+	.string	"\"Z\251iN\004k\300]\235\337l\354\t\242\236\017\n>-\361\221\200\375\261\222\336\273\256\027\360S\325\0160\372\006\366\265$\317\356\322\244\220\003\222\224\340\273\203\222\305]\nPM\310\340w\037"
+	.string	"\3224Tz\336\024vNq\305\370S"
+	.ascii	"E\027p\351M*\177\327\337\227#\326!\316\324:\256\r\311\233)\217"
+	.ascii	"o\376\032&\002\2713\035w\200\207 gbxx\033\323\200\022\033\311"
+	.ascii	"\344\002\236\032\017\210\202\335\030M3\363|\013P\333`'\252p\024"
+	.ascii	"\024\363T\034\036\320\205\346\016\270\231y\217\036\212\207\224"
+	.ascii	"\337\371\231\"\017\337\344\310\n8S\327V\264\353\321\322\351\017"
+	.ascii	"~B)vr{\263\357eQ\3112\250y\212\250\271+A\223\221g\230\343E\317"
+	.ascii	"\267'-\021\342\207\2010[\303\320\023\375\363<\330\341\030\366"
+	.ascii	"\337BE\200mG\322\356;\241\312\027,i@\0035*\226\201\375w\334\227"
+	.ascii	"\303\366\244\331\316\274&\207\270P\2043a\201\017\026\032\033"
+	.ascii	"\"\275\307[9=\266\036\020\335\003\344\342\205 5f\242I?@\002\356"
+	.ascii	"\330$\334\240#\032\367\013V\024C\361"
+	.ascii	"4\2640\272\241\002x\211\013\214#\250\271\n\366\204\350a\203\177"
+	.ascii	"\216\026\367\365\365F\303\212\2257\314\007\020\304Pmjz\177\350"
+	.ascii	"U_qm\017.\201\250\346\256\270@\202\037\003\026>\205\254\237\333"
+	.ascii	"\204\332\201\237f\226\n\"\035\t\271\312\342x\200\200|k\300\365"
+	.ascii	"QZ\240\226\0240\251\304\022+,\340T\272\336\203\374\222\321\365"
+	.ascii	"\216\b\240m\266v\234\201{Z\222E\271\3267?\271\351\255\243p\374"
+	.ascii	"\302\3467\237\317P2`\222$s`\225\233\005\331\007\233\245DtGe\317"
+	.ascii	"Q\250}\235LE\374,\335B\023\305\266x\225\226\002\030D\313!l\240"
+	.ascii	"D:\310\314lN\022\254b\301\332V`\021\023uk&4\202[\335\220W\357"
+	.ascii	"\330\200\275\207\326\364\370;\324l\274\376+%\354\326\030\307"
+	.ascii	"\336\303\376"
+	.string	"K\243\273\177\261])\317\374r@U\372\035\020|\315\275\214S\351\212:\244}\270$o\350\263[\346\032D\253/A\233\243\023\313\0279\210mR\217s\rd\020B\002F:\243\222\201\203\246\270)<\212\327\376\013\034a\336\220o7M\273\217\2730/\325E\240\310\r\356\375\032),\352\006\353\251_\r\356\265\366R\003\244T%\337\263\320<v\250l\304h\204\326\352\341\307\036\265\300\bFfM\375\341\234\003et\316;\343\260\027wM\372\266rr\354\343e\247om\300\371\341\224\267\026\365\025PA\242O\244\201|Ns\240\206\324\3538\341\267Z\240Y(\300\255\317\226\022\002\352KDT\275\020>\336F?\332\265\235\024=\303\236\236*3\005\005<\2178\303\201N\372L\257_\311\305\230\032\211\300.\026\352\255\3614\346>\031\373%\312\277\326z\341\245\377\233\272\277\334>%\353u\247\023\357|\240\337\240\311~\027\263"
+	.ascii	"A/\033\3741A\017\037,\233\263Vr\r\007?\001\177K\261\300|seL\313"
+	.ascii	"\355\006T.\373\377\314\225\217\313\373\367-\036,v\346\325\257"
+	.ascii	"/\370\177\n\236]\347\352\307\264\001\245\016\036~\243\364\342"
+	.ascii	"\334\375\fGw\315\231R\342J\377\255\370\342\330\373\275\211.\333"
+	.ascii	"\031\006Vm~\231\034~\003\377\212\332{\314kiH\006\3454\254\341"
+	.ascii	"\304\342x\003a\376>\316\207.\034k\255Y\320\346\2554 t\201]\345"
+	.ascii	"?\203^\233\204\324q\273_2/,\037VpK\333\247\362=\354\217\272\334"
+	.ascii	"\266\007\257~\305j\031\032\207R|^T\276\264\236\003\3236c?\254"
+	.ascii	"%J\337\213\313\037\323}Re\004\206\235\035m\357\303\f^\366/l\242"
+	.ascii	"\342\367\315\312n\023\333q\030\342\362%\244;\365KL\270\275O`"
+	.ascii	"r\332\276>\233(\335V\342\006q\277\272C\030y>\245\0358^\231\357"
+	.ascii	"]\362\255\361v\334h\026\232\276\3428.\334\303\273\273-\237\330"
+	.ascii	"\036\3241\306\363k\223\255\357c\306\037\177\273\340\276\365\270"
+	.ascii	"\f\355\251\342~\373~\230}!\317\340K\026\317Xw\255\366G\231W\343"
+	.ascii	"u\323b{!\221\365\317\21543V|\n\257\213\360\267;\\p\324\255_!"
+	.ascii	"\277\025\275m\344\322\237\234\205\256"
+	.text
+	.section	.gnu.lto_.symtab.c50d13f54ce853f5,"e",@progbits
+	.string	"nullMotorRateLimiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\002"
+	.string	""
+	.string	"reversibleMotorsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\002"
+	.string	""
+	.string	"applyMotorRateLimiting"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\002"
+	.string	""
+	.string	"motor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\002"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"getThrottleIdleValue"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\002"
+	.string	""
+	.string	"getMotorCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\002"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\002"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\002"
+	.string	""
+	.string	"mixerUpdateStateFlags"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"mixerResetDisarmedMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"motor_disarmed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"mixerInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\002"
+	.string	""
+	.string	"primaryMotorMixer_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\002"
+	.string	""
+	.string	"writeMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\002"
+	.string	""
+	.string	"writeAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"stopMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"stopPwmAllMotors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"getMotorStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\002"
+	.string	""
+	.string	"mixTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"mixerThrottleCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"loadPrimaryMotorMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"primaryMotorMixer_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"primaryMotorMixer_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"pgResetTemplate_motorConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\002"
+	.string	""
+	.string	"motorConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\002"
+	.string	""
+	.string	"motorConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\002"
+	.string	""
+	.string	"pgResetTemplate_mixerConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"mixerConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"mixerConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"pgResetTemplate_reversibleMotorsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\030\003"
+	.string	""
+	.string	"reversibleMotorsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"reversibleMotorsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\002"
+	.string	""
+	.string	"navConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"rcControlsConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"axisPID"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"globalFunctionsFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\265\002"
+	.string	""
+	.string	"globalFunctionValues"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\003"
+	.string	""
+	.string	"calculateThrottleStatus"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\003"
+	.string	""
+	.string	"navigationIsFlyingAutonomousMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"failsafeIsActive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"pwmWriteMotor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"delay"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Q\003"
+	.string	""
+	.string	"pwmShutdownPulsesForAllMotors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"failsafeRequiresMotorStop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\003"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"calculateThrottleCompensationFactor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.string	"isAmperageConfigured"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"getThrottleScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"q\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.c50d13f54ce853f5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits